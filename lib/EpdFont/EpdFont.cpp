@@ -17,8 +17,9 @@ void EpdFont::getTextBounds(const char* string, const int startX, const int star
 
   int cursorX = startX;
   const int cursorY = startY;
+  const EpdGlyph* previous = nullptr;
   uint32_t cp;
-  while ((cp = utf8NextCodepoint(reinterpret_cast<const uint8_t**>(&string)))) {
+  while ((cp = nextCodepoint(reinterpret_cast<const uint8_t**>(&string)))) {
     const EpdGlyph* glyph = getGlyph(cp);
 
     if (!glyph) {
@@ -30,6 +31,8 @@ void EpdFont::getTextBounds(const char* string, const int startX, const int star
       continue;
     }
 
+    cursorX += getKerning(previous, glyph);
+    previous = glyph;
     *minX = std::min(*minX, cursorX + glyph->left);
     *maxX = std::max(*maxX, cursorX + glyph->left + glyph->width);
     *minY = std::min(*minY, cursorY + glyph->top - glyph->height);
@@ -47,7 +50,79 @@ void EpdFont::getTextDimensions(const char* string, int* w, int* h) const {
   *h = maxY - minY;
 }
 
+int EpdFont::getTextAdvanceX(const char* string, const EpdAdvance* advances) const {
+  const auto* text = reinterpret_cast<const unsigned char*>(string);
+  const int8_t* kernMatrix = data->kernMatrix;
+  const uint64_t ligatureStarts = data->ligatureStartMask;
+  int width = 0;
+  uint32_t previousRow = 0;  // Kerning matrix row of the previous glyph, row 0 (class 0) never kerns
+
+  while (*text) {
+    uint32_t cp = *text < 0x80 ? *text++ : utf8NextCodepoint(&text);
+    if (cp == 0) {
+      break;
+    }
+    // Only a formed ligature leaves the table, an "f" that starts none is measured from its entry
+    if ((ligatureStarts & ligatureStartBit(cp)) != 0) {
+      cp = foldLigatures(cp, &text);
+    }
+
+    // Table path: one read per code point instead of the glyph lookup, the glyph and both kerning classes
+    const uint32_t slot = advances ? glyphLookupSlot(cp) : GLYPH_LOOKUP_SIZE;
+    if (slot < GLYPH_LOOKUP_SIZE && advances[slot].advanceX != EpdAdvance::SLOW_PATH) {
+      const EpdAdvance& advance = advances[slot];
+      if (kernMatrix) {
+        width += kernMatrix[previousRow + advance.kernRightClass];
+      }
+      width += advance.advanceX;
+      previousRow = advance.kernLeftRow;
+      continue;
+    }
+
+    const EpdGlyph* glyph = getGlyph(cp);
+    if (!glyph) glyph = getGlyph(REPLACEMENT_GLYPH);
+    if (!glyph) continue;
+
+    if (kernMatrix) {
+      const uint32_t index = glyph - data->glyph;
+      width += kernMatrix[previousRow + data->kernRightClasses[index]];
+      previousRow = data->kernLeftClasses[index] * data->kernRightClassCount;
+    }
+    width += glyph->advanceX;
+  }
+  return width;
+}
+
+bool EpdFont::buildAdvanceTable(EpdAdvance* advances) const {
+  if (!data->glyphLookup) {
+    return false;
+  }
+
+  for (uint32_t slot = 0; slot < GLYPH_LOOKUP_SIZE; slot++) {
+    EpdAdvance& advance = advances[slot];
+    const uint16_t index = data->glyphLookup[slot];
+    // Missing glyphs are drawn as the replacement glyph, which has no entry
+    if (index == GLYPH_LOOKUP_MISSING || data->glyph[index].advanceX == EpdAdvance::SLOW_PATH) {
+      advance = {EpdAdvance::SLOW_PATH, 0, 0};
+      continue;
+    }
+    advance.advanceX = data->glyph[index].advanceX;
+    advance.kernRightClass = data->kernMatrix ? data->kernRightClasses[index] : 0;
+    advance.kernLeftRow = data->kernMatrix ? data->kernLeftClasses[index] * data->kernRightClassCount : 0;
+  }
+  return true;
+}
+
 const EpdGlyph* EpdFont::getGlyph(const uint32_t cp) const {
+  // Direct-mapped fast path for the code points that make up most text
+  if (data->glyphLookup) {
+    const uint32_t slot = glyphLookupSlot(cp);
+    if (slot < GLYPH_LOOKUP_SIZE) {
+      const uint16_t index = data->glyphLookup[slot];
+      return index == GLYPH_LOOKUP_MISSING ? nullptr : &data->glyph[index];
+    }
+  }
+
   const EpdUnicodeInterval* intervals = data->intervals;
   const int count = data->intervalCount;
 
@@ -74,3 +149,62 @@ const EpdGlyph* EpdFont::getGlyph(const uint32_t cp) const {
 
   return nullptr;
 }
+
+uint32_t EpdFont::getLigature(const uint32_t first, const uint32_t second) const {
+  const EpdLigaturePair* ligatures = data->ligatures;
+  int left = 0;
+  int right = static_cast<int>(data->ligatureCount) - 1;
+
+  while (left <= right) {
+    const int mid = left + (right - left) / 2;
+    const EpdLigaturePair* pair = &ligatures[mid];
+
+    if (first < pair->first || (first == pair->first && second < pair->second)) {
+      right = mid - 1;
+    } else if (first > pair->first || second > pair->second) {
+      left = mid + 1;
+    } else {
+      return pair->ligature;
+    }
+  }
+
+  return 0;
+}
+
+bool EpdFont::startsLigature(const uint32_t cp) const {
+  if ((data->ligatureStartMask & ligatureStartBit(cp)) == 0) {
+    return false;
+  }
+  const EpdLigaturePair* ligatures = data->ligatures;
+  int left = 0;
+  int right = static_cast<int>(data->ligatureCount) - 1;
+
+  while (left <= right) {
+    const int mid = left + (right - left) / 2;
+    if (cp < ligatures[mid].first) {
+      right = mid - 1;
+    } else if (cp > ligatures[mid].first) {
+      left = mid + 1;
+    } else {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+uint32_t EpdFont::foldLigatures(uint32_t cp, const unsigned char** string) const {
+  // Keep folding while the result forms another ligature with what follows ("ff" + "i" -> "ffi"). Most code points
+  // start none, which saves decoding the next one.
+  while (startsLigature(cp)) {
+    const unsigned char* lookahead = *string;
+    const uint32_t next = utf8NextCodepoint(&lookahead);
+    const uint32_t ligature = next != 0 ? getLigature(cp, next) : 0;
+    if (ligature == 0) {
+      return cp;
+    }
+    cp = ligature;
+    *string = lookahead;
+  }
+  return cp;
+}
@@ -1,6 +1,18 @@
 #pragma once
+#include <Utf8.h>
+
 #include "EpdFontData.h"
 
+/// Advance width and kerning of a glyphLookup code point, see EpdFont::buildAdvanceTable(). The left class is stored
+/// as its kerning matrix row (class * kernRightClassCount), so a pair costs one matrix read.
+struct EpdAdvance {
+  static constexpr uint8_t SLOW_PATH = 0xFF;  // advanceX of code points measured through getGlyph() instead
+
+  uint8_t advanceX;
+  uint8_t kernRightClass;
+  uint16_t kernLeftRow;
+};
+
 class EpdFont {
   void getTextBounds(const char* string, int startX, int startY, int* minX, int* minY, int* maxX, int* maxY) const;
 
@@ -9,6 +21,33 @@ class EpdFont {
   explicit EpdFont(const EpdFontData* data) : data(data) {}
   ~EpdFont() = default;
   void getTextDimensions(const char* string, int* w, int* h) const;
+  // Sum of the glyph advances and kerning of a string, with an advance table (may be NULL) for the glyphLookup range
+  int getTextAdvanceX(const char* string, const EpdAdvance* advances = nullptr) const;
+  // Fills GLYPH_LOOKUP_SIZE entries, false if the font has no glyphLookup
+  bool buildAdvanceTable(EpdAdvance* advances) const;
 
   const EpdGlyph* getGlyph(uint32_t cp) const;
+
+  // Kerning adjustment in pixels to apply between two glyphs of this font, a null glyph never kerns
+  int getKerning(const EpdGlyph* left, const EpdGlyph* right) const {
+    if (data->kernMatrix == nullptr || left == nullptr || right == nullptr) {
+      return 0;
+    }
+    // Class 0 has an all-zero row and column, so glyphs without kerning need no special case
+    const uint8_t leftClass = data->kernLeftClasses[left - data->glyph];
+    const uint8_t rightClass = data->kernRightClasses[right - data->glyph];
+    return data->kernMatrix[leftClass * data->kernRightClassCount + rightClass];
+  }
+
+  // Code point of the ligature glyph replacing the pair, 0 if the font has none
+  uint32_t getLigature(uint32_t first, uint32_t second) const;
+  // Like utf8NextCodepoint, but folds runs the font draws as a single ligature glyph (e.g. "fi" -> U+FB01)
+  uint32_t nextCodepoint(const unsigned char** string) const {
+    const uint32_t cp = utf8NextCodepoint(string);
+    return cp != 0 && (data->ligatureStartMask & ligatureStartBit(cp)) != 0 ? foldLigatures(cp, string) : cp;
+  }
+
+ private:
+  bool startsLigature(uint32_t cp) const;
+  uint32_t foldLigatures(uint32_t cp, const unsigned char** string) const;
 };
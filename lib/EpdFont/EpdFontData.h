@@ -11,7 +11,7 @@ typedef struct {
   uint8_t advanceX;     ///< Distance to advance cursor (x axis)
   int16_t left;         ///< X dist from cursor pos to UL corner
   int16_t top;          ///< Y dist from cursor pos to UL corner
-  uint16_t dataLength;  ///< Size of the font data.
+  uint16_t dataLength;  ///< Size of the font data (of the run-length stream for rleBitmaps fonts)
   uint32_t dataOffset;  ///< Pointer into EpdFont->bitmap (or within-group offset for compressed fonts)
 } EpdGlyph;
 
@@ -21,7 +21,7 @@ typedef struct {
   uint32_t compressedSize;    ///< Compressed DEFLATE stream size
   uint32_t uncompressedSize;  ///< Decompressed size
   uint16_t glyphCount;        ///< Number of glyphs in this group
-  uint16_t firstGlyphIndex;   ///< First glyph index in the global glyph array
+  uint16_t firstGlyphIndex;   ///< Lowest glyph index in the group (groups are contiguous only without glyphGroups)
 } EpdFontGroup;
 
 /// Glyph interval structure
@@ -31,9 +31,47 @@ typedef struct {
   uint32_t offset;  ///< Index of the first code point into the glyph array
 } EpdUnicodeInterval;
 
+/// Ligature substitution: a pair of code points drawn as a single ligature glyph
+typedef struct {
+  uint32_t first;     ///< First code point of the pair, may itself be a ligature (e.g. U+FB00 "ff" for "ffi")
+  uint32_t second;    ///< Second code point of the pair
+  uint32_t ligature;  ///< Code point of the ligature glyph
+} EpdLigaturePair;
+
+/// Code points with a direct entry in EpdFontData::glyphLookup: U+0000-00FF, followed by General Punctuation
+/// U+2000-206F (curly quotes, dashes, ellipsis), which covers nearly every character of Latin-script text
+constexpr uint32_t GLYPH_LOOKUP_LATIN_END = 0x100;
+constexpr uint32_t GLYPH_LOOKUP_PUNCTUATION_FIRST = 0x2000;
+constexpr uint32_t GLYPH_LOOKUP_PUNCTUATION_END = 0x2070;
+constexpr uint32_t GLYPH_LOOKUP_SIZE =
+    GLYPH_LOOKUP_LATIN_END + GLYPH_LOOKUP_PUNCTUATION_END - GLYPH_LOOKUP_PUNCTUATION_FIRST;
+constexpr uint16_t GLYPH_LOOKUP_MISSING = 0xFFFF;
+
+/// Index of a code point into EpdFontData::glyphLookup, GLYPH_LOOKUP_SIZE if it has no direct entry
+inline uint32_t glyphLookupSlot(const uint32_t cp) {
+  if (cp < GLYPH_LOOKUP_LATIN_END) {
+    return cp;
+  }
+  if (cp >= GLYPH_LOOKUP_PUNCTUATION_FIRST && cp < GLYPH_LOOKUP_PUNCTUATION_END) {
+    return GLYPH_LOOKUP_LATIN_END + (cp - GLYPH_LOOKUP_PUNCTUATION_FIRST);
+  }
+  return GLYPH_LOOKUP_SIZE;
+}
+
+/// Bit of a code point in EpdFontData::ligatureStartMask, a clear bit means the code point starts no ligature
+inline uint64_t ligatureStartBit(const uint32_t cp) { return uint64_t{1} << (cp & 63); }
+
+/// Loads glyph bitmaps of fonts that are not memory mapped, e.g. fonts read from the SD card (SdFont)
+class EpdBitmapSource {
+ public:
+  virtual ~EpdBitmapSource() = default;
+  /// Bitmap of a glyph of the font (run-length stream for rleBitmaps fonts), valid until the next call
+  virtual const uint8_t* getBitmap(const EpdGlyph* glyph) = 0;
+};
+
 /// Data stored for FONT AS A WHOLE
 typedef struct {
-  const uint8_t* bitmap;                ///< Glyph bitmaps, concatenated
+  const uint8_t* bitmap;                ///< Glyph bitmaps, concatenated (NULL when read through bitmapSource)
   const EpdGlyph* glyph;                ///< Glyph array
   const EpdUnicodeInterval* intervals;  ///< Valid unicode intervals for this font
   uint32_t intervalCount;               ///< Number of unicode intervals.
@@ -43,4 +81,15 @@ typedef struct {
   bool is2Bit;
   const EpdFontGroup* groups;  ///< NULL for uncompressed fonts
   uint16_t groupCount;         ///< 0 for uncompressed fonts
+  const uint8_t* kernLeftClasses;   ///< Kerning class of each glyph as the left of a pair, 0 = none (NULL if no kerning)
+  const uint8_t* kernRightClasses;  ///< Kerning class of each glyph as the right of a pair, 0 = none
+  const int8_t* kernMatrix;         ///< Adjustment in pixels, indexed [left class * kernRightClassCount + right class]
+  uint8_t kernRightClassCount;      ///< Number of right classes, including class 0
+  const EpdLigaturePair* ligatures;  ///< Sorted by first, then second code point (NULL if no ligatures)
+  uint16_t ligatureCount;            ///< 0 if no ligatures
+  uint64_t ligatureStartMask;        ///< ligatureStartBit() of every ligature's first code point
+  const uint16_t* glyphLookup;  ///< GLYPH_LOOKUP_SIZE glyph indices (GLYPH_LOOKUP_MISSING if absent), may be NULL
+  const uint8_t* glyphGroups;   ///< Compression group of each glyph (NULL for uncompressed fonts)
+  bool rleBitmaps;  ///< Glyph bitmaps are run-length encoded (see EpdGlyphRuns.h), never combined with groups
+  EpdBitmapSource* bitmapSource;  ///< Loads the glyph bitmaps when they are not in memory (NULL for builtin fonts)
 } EpdFontData;
@@ -12,12 +12,12 @@ class EpdFontFamily {
   void getTextDimensions(const char* string, int* w, int* h, Style style = REGULAR) const;
   const EpdFontData* getData(Style style = REGULAR) const;
   const EpdGlyph* getGlyph(uint32_t cp, Style style = REGULAR) const;
+  // Font used for a style, resolve once when walking a whole string
+  const EpdFont* getFont(Style style) const;
 
  private:
   const EpdFont* regular;
   const EpdFont* bold;
   const EpdFont* italic;
   const EpdFont* boldItalic;
-
-  const EpdFont* getFont(Style style) const;
 };
@@ -0,0 +1,34 @@
+#pragma once
+#include <cstdint>
+
+/// Reader for run-length encoded glyph bitmaps (EpdFontData::rleBitmaps), see scripts/glyph_runs.py for the encoder.
+/// Pixels are in the same row-major order as packed bitmaps. Each nibble, high nibble first, holds a pixel value in
+/// its upper two bits and a length digit of 1-4 in its lower two. A nibble that repeats the value of the one before
+/// continues that run with the next, four times heavier, digit, so every nibble can be drawn as soon as it is read.
+class EpdGlyphRuns {
+ public:
+  EpdGlyphRuns(const uint8_t* data, const uint16_t dataLength) : data(data), end(data + dataLength) {}
+
+  /// Next stretch of pixels of one value, consecutive stretches may share a value. The glyph's pixel count tells when
+  /// to stop, past the end of the data every stretch is empty.
+  void next(uint8_t* value, int* length) {
+    if (data == end) {
+      *value = 0;
+      *length = 0;
+      return;
+    }
+    const uint8_t nibble = highNibble ? (*data >> 4) : (*data++ & 0x0F);
+    highNibble = !highNibble;
+    *value = nibble >> 2;
+    weight = *value == previousValue ? weight * 4 : 1;
+    previousValue = *value;
+    *length = ((nibble & 0x3) + 1) * weight;
+  }
+
+ private:
+  const uint8_t* data;
+  const uint8_t* end;
+  bool highNibble = true;
+  uint8_t previousValue = 0xFF;
+  int weight = 1;
+};
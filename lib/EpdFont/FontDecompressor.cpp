@@ -1,24 +1,36 @@
 #include "FontDecompressor.h"
 
+#include <Arduino.h>
 #include <Logging.h>
 #include <uzlib.h>
 
+#include <algorithm>
 #include <cstdlib>
 #include <cstring>
 
 bool FontDecompressor::init() {
   clearCache();
   memset(&decomp, 0, sizeof(decomp));
+  resetStats();
+
+  const uint32_t freeHeap = ESP.getFreeHeap();
+  cacheBudget = std::min(MAX_CACHE_BYTES, std::max(MIN_CACHE_BYTES, freeHeap / 4));
+  LOG_DBG("FDC", "Caching up to %u bytes of groups (%u bytes free)", cacheBudget, freeHeap);
   return true;
 }
 
+void FontDecompressor::freeEntry(CacheEntry& entry) {
+  if (entry.data) {
+    free(entry.data);
+    entry.data = nullptr;
+    cachedBytes -= entry.dataSize;
+  }
+  entry.valid = false;
+}
+
 void FontDecompressor::freeAllEntries() {
   for (auto& entry : cache) {
-    if (entry.data) {
-      free(entry.data);
-      entry.data = nullptr;
-    }
-    entry.valid = false;
+    freeEntry(entry);
   }
 }
 
@@ -29,7 +41,20 @@ void FontDecompressor::clearCache() {
   accessCounter = 0;
 }
 
+void FontDecompressor::trimCache() {
+  auto validEntries =
+      std::count_if(std::begin(cache), std::end(cache), [](const CacheEntry& entry) { return entry.valid; });
+  for (; validEntries > MIN_CACHE_SLOTS; validEntries--) {
+    evictLeastRecentlyUsed(nullptr);
+  }
+}
+
 uint16_t FontDecompressor::getGroupIndex(const EpdFontData* fontData, uint16_t glyphIndex) {
+  if (fontData->glyphGroups) {
+    return fontData->glyphGroups[glyphIndex];
+  }
+
+  // Fonts generated before the glyph-to-group table was added
   for (uint16_t i = 0; i < fontData->groupCount; i++) {
     uint16_t first = fontData->groups[i].firstGlyphIndex;
     if (glyphIndex >= first && glyphIndex < first + fontData->groups[i].glyphCount) {
@@ -40,7 +65,8 @@ uint16_t FontDecompressor::getGroupIndex(const EpdFontData* fontData, uint16_t g
 }
 
 FontDecompressor::CacheEntry* FontDecompressor::findInCache(const EpdFontData* fontData, uint16_t groupIndex) {
-  for (auto& entry : cache) {
+  for (uint8_t i = 0; i < MAX_CACHE_SLOTS; i++) {
+    CacheEntry& entry = cache[i];
     if (entry.valid && entry.font == fontData && entry.groupIndex == groupIndex) {
       return &entry;
     }
@@ -50,33 +76,52 @@ FontDecompressor::CacheEntry* FontDecompressor::findInCache(const EpdFontData* f
 
 FontDecompressor::CacheEntry* FontDecompressor::findEvictionCandidate() {
   // Find an invalid slot first
-  for (auto& entry : cache) {
-    if (!entry.valid) {
-      return &entry;
+  for (uint8_t i = 0; i < MAX_CACHE_SLOTS; i++) {
+    if (!cache[i].valid) {
+      return &cache[i];
     }
   }
   // Otherwise evict LRU
   CacheEntry* lru = &cache[0];
-  for (auto& entry : cache) {
-    if (entry.lastUsed < lru->lastUsed) {
-      lru = &entry;
+  for (uint8_t i = 1; i < MAX_CACHE_SLOTS; i++) {
+    if (cache[i].lastUsed < lru->lastUsed) {
+      lru = &cache[i];
     }
   }
   return lru;
 }
 
+bool FontDecompressor::evictLeastRecentlyUsed(const CacheEntry* keep) {
+  CacheEntry* lru = nullptr;
+  for (uint8_t i = 0; i < MAX_CACHE_SLOTS; i++) {
+    CacheEntry& entry = cache[i];
+    if (&entry != keep && entry.valid && (!lru || entry.lastUsed < lru->lastUsed)) {
+      lru = &entry;
+    }
+  }
+  if (!lru) {
+    return false;
+  }
+  freeEntry(*lru);
+  return true;
+}
+
 bool FontDecompressor::decompressGroup(const EpdFontData* fontData, uint16_t groupIndex, CacheEntry* entry) {
   const EpdFontGroup& group = fontData->groups[groupIndex];
 
   // Free old buffer if reusing a slot
-  if (entry->data) {
-    free(entry->data);
-    entry->data = nullptr;
-  }
-  entry->valid = false;
+  freeEntry(*entry);
 
-  // Allocate output buffer
+  // Stay within the byte budget, then allocate the output buffer, giving up older groups under memory pressure rather
+  // than failing the glyph
+  bool withinBudget = cachedBytes + group.uncompressedSize <= cacheBudget;
+  while (!withinBudget && evictLeastRecentlyUsed(entry)) {
+    withinBudget = cachedBytes + group.uncompressedSize <= cacheBudget;
+  }
   auto* outBuf = static_cast<uint8_t*>(malloc(group.uncompressedSize));
+  while (!outBuf && evictLeastRecentlyUsed(entry)) {
+    outBuf = static_cast<uint8_t*>(malloc(group.uncompressedSize));
+  }
   if (!outBuf) {
     LOG_ERR("FDC", "Failed to allocate %u bytes for group %u", group.uncompressedSize, groupIndex);
     return false;
@@ -85,6 +130,7 @@ bool FontDecompressor::decompressGroup(const EpdFontData* fontData, uint16_t gro
   // Decompress using uzlib
   const uint8_t* inputBuf = &fontData->bitmap[group.compressedOffset];
 
+  const unsigned long inflateStart = micros();
   uzlib_uncompress_init(&decomp, NULL, 0);
   decomp.source = inputBuf;
   decomp.source_limit = inputBuf + group.compressedSize;
@@ -93,6 +139,7 @@ bool FontDecompressor::decompressGroup(const EpdFontData* fontData, uint16_t gro
   decomp.dest_limit = outBuf + group.uncompressedSize;
 
   int res = uzlib_uncompress(&decomp);
+  stats.inflateMicros += micros() - inflateStart;
 
   if (res < 0 || decomp.dest != decomp.dest_limit) {
     LOG_ERR("FDC", "Decompression failed for group %u (status %d)", groupIndex, res);
@@ -105,6 +152,7 @@ bool FontDecompressor::decompressGroup(const EpdFontData* fontData, uint16_t gro
   entry->data = outBuf;
   entry->dataSize = group.uncompressedSize;
   entry->valid = true;
+  cachedBytes += entry->dataSize;
   return true;
 }
 
@@ -122,6 +170,7 @@ const uint8_t* FontDecompressor::getBitmap(const EpdFontData* fontData, const Ep
   // Check cache
   CacheEntry* entry = findInCache(fontData, groupIndex);
   if (entry) {
+    stats.hits++;
     entry->lastUsed = ++accessCounter;
     if (glyph->dataOffset + glyph->dataLength > entry->dataSize) {
       LOG_ERR("FDC", "dataOffset %u + dataLength %u out of bounds for group %u (size %u)", glyph->dataOffset,
@@ -132,6 +181,7 @@ const uint8_t* FontDecompressor::getBitmap(const EpdFontData* fontData, const Ep
   }
 
   // Cache miss - decompress
+  stats.misses++;
   entry = findEvictionCandidate();
   if (!decompressGroup(fontData, groupIndex, entry)) {
     return nullptr;
@@ -8,6 +8,13 @@
 
 class FontDecompressor {
  public:
+  struct Stats {
+    uint32_t hits = 0;
+    uint32_t misses = 0;
+    uint32_t inflateMicros = 0;  // Total time spent inflating groups on misses
+  };
+
+  // Sizes the cache from the free heap, call once the heap has settled at startup
   bool init();
   void deinit();
 
@@ -15,11 +22,25 @@ class FontDecompressor {
   // Valid until LRU eviction (safe for the duration of one glyph render).
   const uint8_t* getBitmap(const EpdFontData* fontData, const EpdGlyph* glyph, uint16_t glyphIndex);
 
-  // Evict all cached decompressed groups (call between pages for within-page-only caching).
+  // Evict all cached decompressed groups. Groups otherwise stay cached across pages and are only evicted when the
+  // cache is full or a new group cannot be allocated, so only call this to hand the memory back to someone else.
   void clearCache();
+  // Evict the least recently used groups down to MIN_CACHE_SLOTS, keeping the ones the current page draws with. Call
+  // before another large allocation, such as an image decoder.
+  void trimCache();
+  uint32_t getCachedBytes() const { return cachedBytes; }
+
+  const Stats& getStats() const { return stats; }
+  void resetStats() { stats = {}; }
 
  private:
-  static constexpr uint8_t CACHE_SLOTS = 4;
+  static constexpr uint8_t MIN_CACHE_SLOTS = 4;
+  static constexpr uint8_t MAX_CACHE_SLOTS = 12;
+  // The cache holds up to a quarter of the free heap at startup in decompressed groups, within these limits. A page in
+  // one font family touches 1-2 hot groups per style (ASCII and punctuation with the frequent letters of each script),
+  // which inflate to 4-15KB each.
+  static constexpr uint32_t MIN_CACHE_BYTES = 32 * 1024;
+  static constexpr uint32_t MAX_CACHE_BYTES = 64 * 1024;
 
   struct CacheEntry {
     const EpdFontData* font = nullptr;
@@ -31,12 +52,17 @@ class FontDecompressor {
   };
 
   struct uzlib_uncomp decomp = {};
-  CacheEntry cache[CACHE_SLOTS] = {};
+  CacheEntry cache[MAX_CACHE_SLOTS] = {};
+  uint32_t cacheBudget = MIN_CACHE_BYTES;
+  uint32_t cachedBytes = 0;
   uint32_t accessCounter = 0;
+  Stats stats;
 
   void freeAllEntries();
-  uint16_t getGroupIndex(const EpdFontData* fontData, uint16_t glyphIndex);
+  static uint16_t getGroupIndex(const EpdFontData* fontData, uint16_t glyphIndex);
   CacheEntry* findInCache(const EpdFontData* fontData, uint16_t groupIndex);
   CacheEntry* findEvictionCandidate();
+  bool evictLeastRecentlyUsed(const CacheEntry* keep);
+  void freeEntry(CacheEntry& entry);
   bool decompressGroup(const EpdFontData* fontData, uint16_t groupIndex, CacheEntry* entry);
 };
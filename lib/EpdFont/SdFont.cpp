@@ -0,0 +1,224 @@
+#include "SdFont.h"
+
+#include <Arduino.h>
+#include <Logging.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+namespace {
+constexpr char SD_FONT_MAGIC[4] = {'E', 'P', 'D', 'F'};
+constexpr uint8_t SD_FONT_VERSION = 1;
+constexpr uint8_t SD_FONT_FLAG_2BIT = 0x01;
+constexpr uint8_t SD_FONT_FLAG_RLE_BITMAPS = 0x02;
+
+// See scripts/sd_font_file.py, the tables after the header are stored in the layout of the structs they are read into
+struct SdFontHeader {
+  char magic[4];
+  uint8_t version;
+  uint8_t flags;
+  uint8_t advanceY;
+  uint8_t kernRightClassCount;  // 0 if the font has no kerning
+  int16_t ascender;
+  int16_t descender;
+  uint16_t intervalCount;
+  uint16_t glyphCount;
+  uint16_t ligatureCount;
+  uint16_t kernLeftClassCount;
+  uint16_t pageSize;
+  uint16_t reserved;
+  uint32_t bitmapOffset;
+  uint32_t bitmapSize;
+};
+static_assert(sizeof(SdFontHeader) == 32, "SD font header must match scripts/sd_font_file.py");
+static_assert(sizeof(EpdUnicodeInterval) == 12 && sizeof(EpdGlyph) == 16 && sizeof(EpdLigaturePair) == 12,
+              "SD font tables must match scripts/sd_font_file.py");
+
+constexpr uint32_t align4(const uint32_t size) { return (size + 3) & ~3u; }
+}  // namespace
+
+bool SdFont::load(const char* path) {
+  unload();
+  if (!Storage.openFileForRead("SDF", path, file)) {
+    return false;
+  }
+
+  SdFontHeader header;
+  if (file.read(&header, sizeof(header)) != static_cast<int>(sizeof(header)) ||
+      memcmp(header.magic, SD_FONT_MAGIC, sizeof(SD_FONT_MAGIC)) != 0 || header.version != SD_FONT_VERSION) {
+    LOG_ERR("SDF", "Not a font file or unsupported version: %s", path);
+    file.close();
+    return false;
+  }
+
+  // All tables are read with one allocation and used in place, each starts at a multiple of 4 bytes
+  const bool hasKerning = header.kernRightClassCount != 0;
+  const uint32_t glyphsOffset = align4(header.intervalCount * sizeof(EpdUnicodeInterval));
+  const uint32_t lookupOffset = glyphsOffset + align4(header.glyphCount * sizeof(EpdGlyph));
+  const uint32_t ligaturesOffset = lookupOffset + align4(GLYPH_LOOKUP_SIZE * sizeof(uint16_t));
+  const uint32_t kernLeftOffset = ligaturesOffset + align4(header.ligatureCount * sizeof(EpdLigaturePair));
+  const uint32_t kernRightOffset = kernLeftOffset + (hasKerning ? align4(header.glyphCount) : 0);
+  const uint32_t kernMatrixOffset = kernRightOffset + (hasKerning ? align4(header.glyphCount) : 0);
+  const uint32_t tablesSize = kernMatrixOffset + align4(header.kernLeftClassCount * header.kernRightClassCount);
+  if (header.glyphCount == 0 || header.pageSize == 0 || sizeof(header) + tablesSize > header.bitmapOffset) {
+    LOG_ERR("SDF", "Corrupt font file: %s", path);
+    file.close();
+    return false;
+  }
+
+  tables = static_cast<uint8_t*>(malloc(tablesSize));
+  if (!tables) {
+    LOG_ERR("SDF", "Failed to allocate %u bytes for %s", tablesSize, path);
+    file.close();
+    return false;
+  }
+  if (file.read(tables, tablesSize) != static_cast<int>(tablesSize)) {
+    LOG_ERR("SDF", "Failed to read font tables: %s", path);
+    unload();
+    return false;
+  }
+
+  data.bitmap = nullptr;
+  data.glyph = reinterpret_cast<const EpdGlyph*>(tables + glyphsOffset);
+  data.intervals = reinterpret_cast<const EpdUnicodeInterval*>(tables);
+  data.intervalCount = header.intervalCount;
+  data.advanceY = header.advanceY;
+  data.ascender = header.ascender;
+  data.descender = header.descender;
+  data.is2Bit = (header.flags & SD_FONT_FLAG_2BIT) != 0;
+  data.groups = nullptr;
+  data.groupCount = 0;
+  data.kernLeftClasses = hasKerning ? tables + kernLeftOffset : nullptr;
+  data.kernRightClasses = hasKerning ? tables + kernRightOffset : nullptr;
+  data.kernMatrix = hasKerning ? reinterpret_cast<const int8_t*>(tables + kernMatrixOffset) : nullptr;
+  data.kernRightClassCount = header.kernRightClassCount;
+  data.ligatures =
+      header.ligatureCount != 0 ? reinterpret_cast<const EpdLigaturePair*>(tables + ligaturesOffset) : nullptr;
+  data.ligatureCount = header.ligatureCount;
+  data.ligatureStartMask = 0;
+  for (uint32_t i = 0; i < data.ligatureCount; i++) {
+    data.ligatureStartMask |= ligatureStartBit(data.ligatures[i].first);
+  }
+  data.glyphLookup = reinterpret_cast<const uint16_t*>(tables + lookupOffset);
+  data.glyphGroups = nullptr;
+  data.rleBitmaps = (header.flags & SD_FONT_FLAG_RLE_BITMAPS) != 0;
+  data.bitmapSource = this;
+
+  // The tables are indexed without bounds checks when drawing, so a user supplied file must not point outside them
+  bool valid = true;
+  for (uint32_t i = 0; i < data.intervalCount && valid; i++) {
+    const EpdUnicodeInterval& interval = data.intervals[i];
+    valid = interval.first <= interval.last && interval.offset + (interval.last - interval.first) < header.glyphCount;
+  }
+  for (uint32_t i = 0; i < GLYPH_LOOKUP_SIZE && valid; i++) {
+    valid = data.glyphLookup[i] < header.glyphCount || data.glyphLookup[i] == GLYPH_LOOKUP_MISSING;
+  }
+  for (uint32_t i = 0; i < header.glyphCount && hasKerning && valid; i++) {
+    valid = data.kernLeftClasses[i] < header.kernLeftClassCount &&
+            data.kernRightClasses[i] < header.kernRightClassCount;
+  }
+  if (!valid) {
+    LOG_ERR("SDF", "Corrupt font tables: %s", path);
+    unload();
+    return false;
+  }
+
+  bitmapOffset = header.bitmapOffset;
+  bitmapSize = header.bitmapSize;
+  pageSize = header.pageSize;
+  LOG_DBG("SDF", "Loaded %s: %u glyphs, %u bytes of tables, %u pages of %u bytes", path, header.glyphCount,
+          tablesSize, (bitmapSize + pageSize - 1) / pageSize, pageSize);
+  return true;
+}
+
+void SdFont::unload() {
+  free(tables);
+  tables = nullptr;
+  if (file) {
+    file.close();
+  }
+  data = {};
+  for (auto& entry : cache) {
+    free(entry.data);
+    entry = {};
+  }
+  accessCounter = 0;
+}
+
+SdFont::CacheEntry* SdFont::readPage(const uint16_t page) {
+  const uint32_t start = static_cast<uint32_t>(page) * pageSize;
+  if (start >= bitmapSize) {
+    LOG_ERR("SDF", "Page %u out of range", page);
+    return nullptr;
+  }
+
+  // An empty slot, otherwise the least recently used one
+  CacheEntry* entry = &cache[0];
+  for (auto& candidate : cache) {
+    if (!candidate.valid) {
+      entry = &candidate;
+      break;
+    }
+    if (candidate.lastUsed < entry->lastUsed) {
+      entry = &candidate;
+    }
+  }
+
+  entry->valid = false;
+  if (!entry->data) {
+    entry->data = static_cast<uint8_t*>(malloc(pageSize));
+    if (!entry->data) {
+      LOG_ERR("SDF", "Failed to allocate %u bytes for page %u", pageSize, page);
+      return nullptr;
+    }
+  }
+
+  const auto size = static_cast<uint16_t>(std::min<uint32_t>(pageSize, bitmapSize - start));
+  const unsigned long readStart = micros();
+  const bool read = file.seekSet(bitmapOffset + start) && file.read(entry->data, size) == size;
+  stats.readMicros += micros() - readStart;
+  if (!read) {
+    LOG_ERR("SDF", "Failed to read page %u", page);
+    return nullptr;
+  }
+
+  entry->page = page;
+  entry->size = size;
+  entry->valid = true;
+  return entry;
+}
+
+const uint8_t* SdFont::getBitmap(const EpdGlyph* glyph) {
+  if (!tables) {
+    return nullptr;
+  }
+
+  // Glyphs never cross a page boundary
+  const auto page = static_cast<uint16_t>(glyph->dataOffset / pageSize);
+  const uint32_t offset = glyph->dataOffset % pageSize;
+
+  CacheEntry* entry = nullptr;
+  for (auto& candidate : cache) {
+    if (candidate.valid && candidate.page == page) {
+      entry = &candidate;
+      break;
+    }
+  }
+  if (entry) {
+    stats.hits++;
+  } else {
+    stats.misses++;
+    entry = readPage(page);
+    if (!entry) {
+      return nullptr;
+    }
+  }
+
+  entry->lastUsed = ++accessCounter;
+  if (offset + glyph->dataLength > entry->size) {
+    LOG_ERR("SDF", "Glyph data at %u + %u out of bounds for page %u", glyph->dataOffset, glyph->dataLength, page);
+    return nullptr;
+  }
+  return entry->data + offset;
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <HalStorage.h>
+
+#include <cstdint>
+
+#include "EpdFontData.h"
+
+/// Font read from a font file (.epf) on the SD card, written by fontconvert.py --sd-font or export_sd_fonts.py (see
+/// docs/file-formats.md). Glyph metrics, kerning and ligatures are loaded into memory, glyph bitmaps are read in pages
+/// when first drawn and the most recently used pages are kept in a small cache.
+class SdFont final : public EpdBitmapSource {
+ public:
+  struct Stats {
+    uint32_t hits = 0;
+    uint32_t misses = 0;
+    uint32_t readMicros = 0;  // Total time spent reading pages on misses
+  };
+
+  SdFont() = default;
+  ~SdFont() override { unload(); }
+  SdFont(const SdFont&) = delete;
+  SdFont& operator=(const SdFont&) = delete;
+
+  bool load(const char* path);
+  void unload();
+  bool isLoaded() const { return tables != nullptr; }
+
+  // Font data to construct an EpdFont from, its tables are only valid while the font is loaded
+  const EpdFontData* getData() const { return &data; }
+  const uint8_t* getBitmap(const EpdGlyph* glyph) override;
+
+  const Stats& getStats() const { return stats; }
+  void resetStats() { stats = {}; }
+
+ private:
+  // Text in one script touches 3-5 pages per style (ASCII and punctuation with the frequent letters of each script are
+  // stored first), pages are only allocated once needed
+  static constexpr uint8_t PAGE_CACHE_SLOTS = 6;
+
+  struct CacheEntry {
+    uint8_t* data = nullptr;  // pageSize bytes
+    uint16_t page = 0;
+    uint16_t size = 0;
+    uint32_t lastUsed = 0;
+    bool valid = false;
+  };
+
+  EpdFontData data = {};
+  FsFile file;
+  uint8_t* tables = nullptr;
+  uint32_t bitmapOffset = 0;
+  uint32_t bitmapSize = 0;
+  uint16_t pageSize = 0;
+  CacheEntry cache[PAGE_CACHE_SLOTS] = {};
+  uint32_t accessCounter = 0;
+  Stats stats;
+
+  CacheEntry* readPage(uint16_t page);
+};
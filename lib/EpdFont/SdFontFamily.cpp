@@ -0,0 +1,41 @@
+#include "SdFontFamily.h"
+
+#include <Logging.h>
+
+#include <string>
+
+namespace {
+// Indexed by EpdFontFamily::Style
+constexpr const char* STYLE_NAMES[] = {"regular", "bold", "italic", "bolditalic"};
+}  // namespace
+
+bool SdFontFamily::load(const char* directory, const char* name) {
+  unload();
+  for (int style = 0; style < STYLE_COUNT; style++) {
+    const std::string path = std::string(directory) + "/" + name + "_" + STYLE_NAMES[style] + ".epf";
+    const bool regular = style == EpdFontFamily::REGULAR;
+    if (!Storage.exists(path.c_str())) {
+      if (regular) {
+        return false;
+      }
+      continue;
+    }
+    if (!fonts[style].load(path.c_str()) && regular) {
+      return false;
+    }
+  }
+  LOG_INF("SDF", "Loaded font %s from %s", name, directory);
+  return true;
+}
+
+void SdFontFamily::unload() {
+  for (auto& font : fonts) {
+    font.unload();
+  }
+}
+
+EpdFontFamily SdFontFamily::getFamily() const {
+  const auto styleFont = [this](const int style) { return fonts[style].isLoaded() ? &epdFonts[style] : nullptr; };
+  return EpdFontFamily(styleFont(EpdFontFamily::REGULAR), styleFont(EpdFontFamily::BOLD),
+                       styleFont(EpdFontFamily::ITALIC), styleFont(EpdFontFamily::BOLD_ITALIC));
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "EpdFontFamily.h"
+#include "SdFont.h"
+
+/// The styles of one font read from the SD card, named like the builtin fonts: <directory>/<name>_<style>.epf, e.g.
+/// /fonts/bookerly_14_regular.epf. Only the regular style is required, missing styles fall back like in EpdFontFamily.
+class SdFontFamily {
+ public:
+  bool load(const char* directory, const char* name);
+  void unload();
+  bool isLoaded() const { return fonts[EpdFontFamily::REGULAR].isLoaded(); }
+
+  // Only valid while the family is loaded
+  EpdFontFamily getFamily() const;
+
+ private:
+  static constexpr int STYLE_COUNT = 4;
+
+  SdFont fonts[STYLE_COUNT];
+  EpdFont epdFonts[STYLE_COUNT] = {EpdFont(fonts[0].getData()), EpdFont(fonts[1].getData()),
+                                   EpdFont(fonts[2].getData()), EpdFont(fonts[3].getData())};
+};
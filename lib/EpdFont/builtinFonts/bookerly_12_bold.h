@@ -3,1502 +3,1546 @@
  * name: bookerly_12_bold
  * size: 12
  * mode: 2-bit  compressed: true
- * Command used: fontconvert.py bookerly_12_bold 12 ../builtinFonts/source/Bookerly/Bookerly-Bold.ttf --2bit --compress
+ * Command used: fontconvert.py bookerly_12_bold 12 ../builtinFonts/source/Bookerly/Bookerly-Bold.ttf --2bit --compress --frequency-corpus ../../../test/hyphenation_eval/resources/english_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/french_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/german_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/italian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/russian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/spanish_hyphenation_tests.txt
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t bookerly_12_boldBitmaps[23827] = {
-    0x8D, 0x58, 0x3F, 0x90, 0xD6, 0xC6, 0x15, 0x7F, 0x92, 0x38, 0x94, 0x89, 0x66, 0xBC, 0x14, 0x5C,
-    0xEC, 0xF8, 0x1C, 0x2B, 0x85, 0x0B, 0xA7, 0xC9, 0x36, 0x29, 0x5C, 0x00, 0xAB, 0x98, 0xCC, 0x5C,
-    0x41, 0xC1, 0x37, 0x93, 0xFB, 0x92, 0xC2, 0x85, 0x7B, 0x32, 0xC9, 0xA5, 0x48, 0x91, 0x02, 0x4E,
-    0x02, 0x0A, 0x0A, 0x17, 0x47, 0x95, 0x22, 0x29, 0x3C, 0x99, 0xA1, 0xC0, 0x37, 0x9E, 0xA1, 0x71,
-    0x91, 0x82, 0x43, 0x3A, 0x2E, 0x33, 0x14, 0x2E, 0xAC, 0x84, 0xCC, 0xA4, 0xA0, 0x40, 0xB1, 0x93,
-    0x49, 0x62, 0x0A, 0x16, 0x10, 0xB1, 0x0C, 0xAB, 0x7D, 0xF9, 0xBD, 0xD5, 0x77, 0x70, 0x24, 0xE0,
-    0xF1, 0xA7, 0x3F, 0x9F, 0xB4, 0xD2, 0xEE, 0xBE, 0x7D, 0x7F, 0x7E, 0xEF, 0xF7, 0xF4, 0xCD, 0xF3,
-    0xCE, 0x5C, 0xE8, 0xCB, 0xE3, 0xBD, 0x49, 0xEC, 0xB4, 0xEB, 0xC8, 0x12, 0x1D, 0xD2, 0xBB, 0xCE,
-    0x34, 0xB3, 0x8D, 0xBC, 0xDC, 0xBC, 0x7D, 0xF3, 0x41, 0xEF, 0x46, 0xA3, 0xD5, 0xC7, 0xBB, 0xF7,
-    0xBB, 0x81, 0x16, 0x3F, 0x9D, 0x74, 0x64, 0xD2, 0x96, 0x8E, 0x65, 0xCD, 0xD2, 0xB5, 0x77, 0xFF,
-    0x92, 0x33, 0xBB, 0x57, 0x7D, 0xFD, 0x2F, 0x1A, 0x34, 0x45, 0xBD, 0xA1, 0xD8, 0x1E, 0xA3, 0x92,
-    0xD9, 0x32, 0x8E, 0xAC, 0x75, 0x94, 0x35, 0x03, 0xA9, 0x9D, 0x9E, 0xD4, 0x39, 0x3B, 0xF5, 0x4F,
-    0x0B, 0x8A, 0x5B, 0xA2, 0x8F, 0x88, 0x36, 0x8A, 0x88, 0x7D, 0xCC, 0xDC, 0xBA, 0x7B, 0xC3, 0x99,
-    0x23, 0x47, 0xF3, 0xCD, 0xA5, 0xF4, 0x71, 0x43, 0x8C, 0x77, 0xB9, 0xC3, 0x18, 0x94, 0x70, 0x5B,
-    0x3D, 0x70, 0xFD, 0x91, 0xF2, 0xD8, 0x4B, 0xF9, 0xE6, 0x3F, 0xDF, 0xBF, 0x8E, 0x37, 0x73, 0xAE,
-    0xE8, 0xFB, 0x44, 0x59, 0x45, 0x71, 0x47, 0xF4, 0x07, 0xA2, 0xEF, 0xED, 0x89, 0x75, 0xF0, 0x22,
-    0xBD, 0x4E, 0x11, 0x5B, 0x72, 0xA4, 0x6E, 0x75, 0x90, 0x6F, 0x5B, 0x35, 0x86, 0xB0, 0x2E, 0x2C,
-    0x4A, 0x35, 0x57, 0x55, 0x45, 0x58, 0xE1, 0x55, 0x22, 0xA7, 0x76, 0x5B, 0x8A, 0xFB, 0x0D, 0x9D,
-    0x8D, 0x09, 0xDB, 0xDE, 0x8F, 0xB1, 0x57, 0x17, 0x20, 0x27, 0x9D, 0xD6, 0x89, 0xA5, 0xA4, 0x73,
-    0x59, 0x83, 0x25, 0x5A, 0x4D, 0x34, 0xA8, 0x46, 0xC4, 0xD7, 0xC7, 0x3B, 0x3A, 0x43, 0xA6, 0xC6,
-    0x58, 0x54, 0x5A, 0x11, 0xFF, 0x30, 0xED, 0xFF, 0x65, 0x1E, 0x27, 0x03, 0xB9, 0xC8, 0xAB, 0x06,
-    0xE3, 0xA3, 0x7F, 0xE4, 0x94, 0x9C, 0xF2, 0x82, 0x68, 0x3C, 0x8A, 0xA7, 0xFE, 0xBB, 0x44, 0x31,
-    0x43, 0x38, 0xC5, 0x3B, 0x6C, 0xF5, 0x27, 0x9D, 0x21, 0xB3, 0x0A, 0x7D, 0x99, 0xD8, 0xE3, 0x54,
-    0xD4, 0x4C, 0xA6, 0xD2, 0x9E, 0x74, 0xA7, 0xF8, 0xA2, 0x82, 0xE2, 0x46, 0x28, 0xE5, 0x5D, 0x47,
-    0x4B, 0x33, 0x9A, 0x6D, 0xF8, 0x71, 0x1C, 0xAF, 0x5E, 0xC5, 0x4A, 0xDF, 0xA4, 0xED, 0xD8, 0xA5,
-    0x56, 0xB5, 0x79, 0x63, 0x0A, 0x43, 0x1B, 0x74, 0x8D, 0xC6, 0x27, 0xDB, 0x35, 0x2A, 0x31, 0x90,
-    0xAE, 0x54, 0x9B, 0xD9, 0x64, 0x20, 0x4F, 0x47, 0x88, 0x5E, 0xC3, 0xBA, 0x63, 0x47, 0xBA, 0x49,
-    0x7A, 0x3C, 0x55, 0x6D, 0x3C, 0xC8, 0x9F, 0xDC, 0x8D, 0x78, 0x57, 0xB5, 0x89, 0xE8, 0x6A, 0x43,
-    0x2E, 0x1B, 0xD5, 0xA6, 0x36, 0xE9, 0xF1, 0xE4, 0xA3, 0xB0, 0xA4, 0x43, 0xB4, 0xDA, 0x1C, 0x3D,
-    0x9D, 0x3C, 0xFE, 0x51, 0xC6, 0x3B, 0xB5, 0x33, 0x1F, 0xBD, 0x7D, 0xA3, 0xA1, 0xAB, 0xF2, 0xE0,
-    0xEA, 0xD3, 0xFD, 0x94, 0xBF, 0x5C, 0xF3, 0xB8, 0xE5, 0x2F, 0xEF, 0x6F, 0xC4, 0x2F, 0x2A, 0x4C,
-    0x53, 0x47, 0x2E, 0x6B, 0x4D, 0xDC, 0xAB, 0xE2, 0x0D, 0xD2, 0x7C, 0x92, 0x3F, 0xE3, 0xFE, 0xDB,
-    0xF9, 0x9D, 0xD1, 0x2F, 0x89, 0xA6, 0xE0, 0x41, 0x15, 0xA4, 0xA1, 0x14, 0xDA, 0xEE, 0xA1, 0x25,
-    0x82, 0xF0, 0x7B, 0xAD, 0xCD, 0xBE, 0x56, 0xBF, 0xAF, 0x35, 0x0B, 0xAD, 0x34, 0x8D, 0x0F, 0x2B,
-    0x0F, 0x18, 0x76, 0x88, 0x78, 0x7D, 0x50, 0x56, 0xD9, 0xB2, 0xD0, 0x37, 0x1D, 0x95, 0x9B, 0x36,
-    0xF2, 0xA6, 0x49, 0x9C, 0x27, 0xF5, 0x60, 0x20, 0x33, 0xDD, 0xA6, 0x3D, 0x74, 0xBB, 0xE3, 0x23,
-    0x9F, 0xF8, 0x75, 0x9B, 0x32, 0x17, 0x09, 0x5C, 0x8B, 0xD6, 0x16, 0x9E, 0x4C, 0x2B, 0x5C, 0xC0,
-    0xCF, 0x0C, 0x13, 0xD5, 0x5F, 0xB5, 0x47, 0x7C, 0xC9, 0xB0, 0xC3, 0x4E, 0x58, 0x81, 0xE6, 0x22,
-    0xE7, 0x51, 0xC6, 0x2B, 0x0B, 0x5E, 0xB5, 0x19, 0x7C, 0xBE, 0x2E, 0x48, 0x59, 0x8A, 0x47, 0xBC,
-    0x5B, 0x51, 0x0E, 0x1F, 0x19, 0x28, 0xF2, 0xE1, 0x46, 0x63, 0x9D, 0x08, 0x10, 0x04, 0xC4, 0x2E,
-    0x43, 0xEA, 0x25, 0x8A, 0x6A, 0x31, 0x6E, 0xCB, 0xEF, 0xB8, 0x63, 0x54, 0xA7, 0x30, 0x0E, 0xA9,
-    0x8E, 0xF2, 0x2E, 0xAA, 0x2D, 0x41, 0xBA, 0xD7, 0xD7, 0x6D, 0xE8, 0x59, 0x86, 0x9E, 0xDA, 0x2E,
-    0xD5, 0xBD, 0xE1, 0x3E, 0x83, 0xCC, 0xCB, 0x61, 0xED, 0x14, 0x04, 0x8A, 0x21, 0x6F, 0x8A, 0x43,
-    0x31, 0x4D, 0xB2, 0xA3, 0xCD, 0xC1, 0x3F, 0xFB, 0x9A, 0xB2, 0xAE, 0xA6, 0xBC, 0xA9, 0xC9, 0x6C,
-    0xF1, 0x65, 0x4C, 0x0A, 0x99, 0xD9, 0x2D, 0xCD, 0xEB, 0xB5, 0xD0, 0xEF, 0xC9, 0x31, 0x0D, 0x06,
-    0x31, 0x6A, 0x78, 0x23, 0xBB, 0xAC, 0x23, 0xF8, 0x0C, 0x71, 0x21, 0x6E, 0xAC, 0xD8, 0x45, 0xEF,
-    0x70, 0x58, 0x46, 0x02, 0x2B, 0xC8, 0x14, 0x0D, 0x99, 0x6E, 0xA9, 0xB6, 0xA5, 0xF8, 0x6F, 0x3B,
-    0x75, 0x46, 0x08, 0x94, 0xF0, 0x2A, 0x6E, 0x72, 0x5F, 0x24, 0x3E, 0xF4, 0xCD, 0x31, 0x0A, 0x7F,
-    0x89, 0x21, 0xC6, 0xD4, 0xD7, 0xB6, 0x2E, 0xEA, 0xF7, 0xFA, 0xC4, 0x95, 0x85, 0xB9, 0x31, 0x24,
-    0x00, 0x14, 0x73, 0x8E, 0xDF, 0xEF, 0x15, 0x7B, 0x51, 0x9F, 0x68, 0x11, 0xBF, 0x64, 0x92, 0x0F,
-    0x8A, 0x81, 0x2E, 0xCC, 0xF1, 0x56, 0x75, 0xAF, 0x88, 0xDD, 0x4D, 0x50, 0x66, 0x34, 0x86, 0x89,
-    0xD3, 0x3E, 0x88, 0x80, 0xB1, 0xE3, 0xA9, 0x41, 0x64, 0x82, 0x4F, 0xD0, 0x0C, 0x03, 0x60, 0x18,
-    0xE0, 0x41, 0xC6, 0x1C, 0x79, 0x58, 0xA1, 0x31, 0xE7, 0x87, 0x64, 0xD0, 0x6D, 0x4D, 0x7C, 0xA5,
-    0x4D, 0x81, 0x22, 0x1A, 0x8B, 0xB9, 0xC3, 0xC9, 0xA0, 0x06, 0x48, 0xF1, 0xB1, 0x4D, 0x5C, 0x5D,
-    0x98, 0xDD, 0xF1, 0xDD, 0x5E, 0x43, 0x8A, 0x12, 0x52, 0x2C, 0x4F, 0x43, 0x68, 0x86, 0x22, 0x81,
-    0x02, 0xEB, 0xD6, 0x54, 0xF5, 0x85, 0xFD, 0x32, 0xEB, 0xEB, 0xFC, 0x3B, 0x87, 0x78, 0x6C, 0x56,
-    0x78, 0x12, 0xC3, 0xB4, 0xA4, 0x1C, 0xE6, 0x44, 0xF7, 0x0A, 0xE0, 0x44, 0x4B, 0x08, 0x70, 0xBD,
-    0xFE, 0xD8, 0xB9, 0x05, 0x04, 0xAD, 0x3E, 0xE2, 0xF2, 0x6C, 0x91, 0xB5, 0xE5, 0x0E, 0xC7, 0xFD,
-    0x13, 0x80, 0x58, 0x22, 0x96, 0xC0, 0xD5, 0x05, 0x82, 0xE2, 0x28, 0x5D, 0x9C, 0x1A, 0x7F, 0x4D,
-    0x29, 0x7C, 0xB6, 0x4B, 0x21, 0x4A, 0x27, 0xFE, 0x63, 0x7A, 0x98, 0xB4, 0x10, 0xA5, 0xA2, 0x1D,
-    0x4F, 0x61, 0x28, 0x1E, 0xB1, 0x9F, 0xDA, 0xBA, 0x2C, 0x06, 0x9B, 0xAF, 0x4D, 0xB7, 0x53, 0xE7,
-    0xB7, 0x26, 0x0F, 0x19, 0xE0, 0x09, 0x05, 0xE9, 0x5E, 0x74, 0x93, 0x39, 0xAA, 0xDB, 0x7C, 0x94,
-    0xF6, 0xB7, 0x68, 0xE1, 0x2B, 0x75, 0x97, 0x8A, 0xC9, 0xEC, 0x1B, 0x79, 0x2B, 0x41, 0xA4, 0x25,
-    0x42, 0xD7, 0x61, 0xF0, 0x82, 0xFB, 0x04, 0x3D, 0x1A, 0x00, 0xE6, 0x14, 0xED, 0x08, 0x2F, 0x2C,
-    0xAD, 0x9E, 0xB4, 0x1A, 0x4E, 0x07, 0xD9, 0x4B, 0x9C, 0x61, 0xED, 0xA4, 0xBF, 0x9C, 0xD7, 0x6D,
-    0x2C, 0xD1, 0xD8, 0xC0, 0x5B, 0x81, 0x54, 0x2E, 0x42, 0xC8, 0x64, 0x1D, 0x3C, 0x6F, 0xDB, 0xC4,
-    0x76, 0x3B, 0x7A, 0xE8, 0xD2, 0xB3, 0x43, 0x7A, 0xA7, 0xA3, 0xB4, 0xCB, 0xAF, 0x14, 0x19, 0x57,
-    0xDB, 0x63, 0x34, 0x5E, 0x4B, 0xEE, 0xF7, 0x6A, 0x67, 0x50, 0xEF, 0x75, 0xE6, 0xC4, 0x43, 0x07,
-    0x97, 0x84, 0xB7, 0x21, 0x50, 0x4E, 0x0C, 0xA2, 0x47, 0x0A, 0xD1, 0x2D, 0x2E, 0x08, 0xB7, 0xC1,
-    0xF9, 0xF3, 0x2B, 0x83, 0xAC, 0x57, 0x30, 0x74, 0xC5, 0x07, 0x05, 0xBD, 0x2A, 0x27, 0x5E, 0xBC,
-    0x02, 0x4F, 0x69, 0x16, 0xA7, 0xEC, 0x36, 0x52, 0x87, 0xDA, 0x44, 0x2A, 0xD1, 0x27, 0x71, 0x32,
-    0x88, 0x34, 0xDA, 0x10, 0x9F, 0x18, 0x7F, 0x0A, 0xDD, 0x30, 0x2C, 0x8B, 0xE8, 0x62, 0x81, 0x6A,
-    0x2E, 0x52, 0x24, 0x11, 0x20, 0x1B, 0x96, 0x56, 0xBB, 0x98, 0x1D, 0x62, 0x16, 0xB1, 0x70, 0xEA,
-    0x12, 0x3C, 0x94, 0x2B, 0xCD, 0xDC, 0x25, 0x4E, 0xC1, 0x29, 0x52, 0x58, 0x3C, 0x91, 0x7F, 0x1C,
-    0xC0, 0x44, 0xAC, 0x18, 0x07, 0xAE, 0x57, 0x5C, 0x12, 0xB6, 0x78, 0xC4, 0x31, 0x5D, 0x8F, 0xEB,
-    0x83, 0xF4, 0x33, 0xEC, 0x17, 0xF6, 0xF6, 0x05, 0x66, 0x6B, 0x30, 0x1E, 0xD4, 0xE9, 0x34, 0x00,
-    0x95, 0x29, 0xBB, 0x00, 0xC3, 0x23, 0x76, 0x45, 0x78, 0x91, 0x4B, 0xE1, 0xD6, 0x00, 0x72, 0xEA,
-    0x26, 0x2C, 0x25, 0xE1, 0x2A, 0x5A, 0x05, 0xC0, 0x03, 0x14, 0x6C, 0x2C, 0xE3, 0xC0, 0x09, 0x97,
-    0x4E, 0x7D, 0x20, 0xA2, 0x73, 0x2B, 0xA2, 0x43, 0x70, 0x60, 0x01, 0x7A, 0x96, 0x2D, 0xA2, 0xA0,
-    0x6E, 0xE0, 0xF2, 0x8C, 0x2D, 0x81, 0x14, 0x18, 0x4B, 0x89, 0xA1, 0xF6, 0x9A, 0x20, 0x12, 0x02,
-    0x03, 0x4D, 0x30, 0x47, 0x93, 0x41, 0xB1, 0xBF, 0x0D, 0xEB, 0xEA, 0x31, 0xD6, 0x97, 0x0B, 0xD7,
-    0x5B, 0x9E, 0xCF, 0xD7, 0x04, 0x02, 0xD0, 0x0C, 0xF1, 0x23, 0xE9, 0x71, 0x1A, 0xC7, 0x0F, 0x44,
-    0xB2, 0x70, 0x4C, 0xCB, 0x6D, 0x12, 0xBF, 0x55, 0x2C, 0xDA, 0x0E, 0xE1, 0x38, 0x82, 0xE3, 0x2A,
-    0xDA, 0x42, 0x3F, 0xF4, 0x1F, 0x30, 0xCE, 0x8F, 0x21, 0x1C, 0x6E, 0xAD, 0x69, 0x4B, 0x28, 0xC4,
-    0x9A, 0xE6, 0x3B, 0xD2, 0x41, 0x22, 0xD2, 0x6F, 0x55, 0x80, 0x46, 0x0C, 0x53, 0x2D, 0xE2, 0x73,
-    0xEF, 0x0F, 0x08, 0x06, 0x2D, 0xCB, 0x2A, 0x0F, 0xD6, 0x17, 0x71, 0x2D, 0x48, 0x0B, 0x2F, 0x40,
-    0x9E, 0xD1, 0x1D, 0xD2, 0xB3, 0xA5, 0x5C, 0xCC, 0x27, 0x81, 0x1D, 0x4C, 0x6D, 0x9A, 0x68, 0x7E,
-    0xD2, 0x26, 0xFC, 0x05, 0xBC, 0xD8, 0x01, 0x3B, 0x39, 0xEF, 0xC9, 0xEC, 0x72, 0x01, 0x84, 0xF7,
-    0x57, 0x5C, 0x2A, 0x76, 0xD5, 0xB2, 0xB2, 0x65, 0x84, 0xEE, 0xBC, 0x98, 0xCF, 0x15, 0x03, 0x1C,
-    0x3F, 0xE5, 0x01, 0xF0, 0x88, 0xB1, 0xA0, 0x7E, 0x64, 0x6B, 0x2C, 0x5E, 0x06, 0x84, 0x04, 0x75,
-    0x31, 0x35, 0xF2, 0xA4, 0x11, 0x84, 0x8E, 0xF9, 0x7C, 0x8B, 0x8B, 0xE7, 0xBF, 0x89, 0x89, 0x3A,
-    0x2D, 0x70, 0xB8, 0x29, 0x63, 0x76, 0xCB, 0xF3, 0xE3, 0x3C, 0x6A, 0x59, 0x0F, 0xDE, 0x7C, 0xF1,
-    0xA9, 0xD5, 0x7C, 0x93, 0xC7, 0x68, 0xBE, 0x96, 0x8A, 0x6F, 0x0D, 0x01, 0x28, 0xBF, 0xE6, 0x5E,
-    0x49, 0x72, 0x60, 0x42, 0xF8, 0x9B, 0x81, 0x10, 0x9E, 0xC1, 0x56, 0xC5, 0x7C, 0xC6, 0xAC, 0xF8,
-    0xCF, 0xDC, 0xAB, 0x11, 0x0F, 0xCB, 0x0A, 0x5E, 0x09, 0xF2, 0x64, 0x11, 0xD3, 0x66, 0x57, 0x10,
-    0xA8, 0x14, 0x07, 0x1A, 0x04, 0xF8, 0xC5, 0xAB, 0x6E, 0x23, 0x00, 0x58, 0x0B, 0x4C, 0x1B, 0x50,
-    0x1C, 0x8B, 0x93, 0x69, 0x4A, 0x71, 0xFC, 0x12, 0x10, 0xD7, 0x94, 0x03, 0xF4, 0x55, 0xB6, 0x01,
-    0xAB, 0x31, 0x34, 0x54, 0x2F, 0xE6, 0xA8, 0xE8, 0x89, 0xE9, 0xBF, 0xFA, 0x10, 0x17, 0x38, 0x83,
-    0x63, 0x7B, 0xBF, 0x1B, 0x44, 0xF3, 0x22, 0x9A, 0xCF, 0x94, 0xF8, 0x0C, 0x92, 0x29, 0x40, 0xB6,
-    0x25, 0xEE, 0x32, 0xD8, 0x4E, 0x60, 0x86, 0xA2, 0xC7, 0x7D, 0x5E, 0x17, 0xD1, 0x17, 0x83, 0x36,
-    0x45, 0xFC, 0x1F, 0x77, 0x0C, 0xE7, 0x7B, 0xEE, 0xA8, 0xA9, 0x62, 0x3B, 0x9E, 0x36, 0x55, 0x62,
-    0xEB, 0x01, 0x6A, 0xB3, 0x65, 0x2F, 0x67, 0x63, 0x41, 0x4B, 0xAC, 0xEE, 0x74, 0x23, 0x8C, 0x06,
-    0xE7, 0x4E, 0x35, 0xBA, 0x35, 0xFE, 0x60, 0x21, 0xC9, 0x12, 0xA1, 0xE2, 0x96, 0xD7, 0x20, 0x76,
-    0xCE, 0x85, 0xE6, 0xEB, 0x61, 0x32, 0xE5, 0x91, 0xD8, 0x00, 0xBA, 0x20, 0x08, 0xC8, 0x50, 0x4E,
-    0x52, 0x15, 0xD8, 0xCC, 0xED, 0x1E, 0x8D, 0xF7, 0x19, 0x8D, 0xCE, 0xDC, 0x43, 0x63, 0xE2, 0x85,
-    0xE2, 0xD4, 0xB7, 0x31, 0xB8, 0x0A, 0x5C, 0x10, 0x39, 0xDB, 0x08, 0x62, 0x4B, 0x5F, 0x44, 0x2A,
-    0x19, 0x9B, 0x73, 0x93, 0xBA, 0x05, 0xCE, 0x1D, 0x7C, 0x54, 0x50, 0x16, 0x58, 0x01, 0xFC, 0x03,
-    0x03, 0x5A, 0x44, 0x2E, 0x9F, 0x87, 0x77, 0x38, 0xD1, 0xF9, 0xAD, 0x1E, 0x71, 0x27, 0x59, 0xF1,
-    0xF6, 0x93, 0x8B, 0x01, 0xBA, 0x41, 0x28, 0x9B, 0x1B, 0xE2, 0x41, 0xC6, 0x46, 0x20, 0x75, 0xFF,
-    0xA8, 0x1B, 0x89, 0x66, 0x8C, 0x03, 0xCB, 0x80, 0xB2, 0x85, 0x78, 0x16, 0x47, 0x97, 0x58, 0x4C,
-    0x5C, 0x3E, 0x24, 0x6E, 0xFF, 0x96, 0xE2, 0x3E, 0xEF, 0x31, 0xA1, 0xB8, 0x26, 0x72, 0xE7, 0xC5,
-    0x67, 0x35, 0x3F, 0x4A, 0x42, 0x6A, 0x83, 0xB5, 0x82, 0x74, 0x42, 0x16, 0xC2, 0x68, 0x89, 0x8F,
-    0xB8, 0x11, 0xF1, 0x2A, 0xF8, 0x2D, 0xC3, 0x2F, 0x92, 0x11, 0x77, 0xAA, 0x17, 0xB1, 0x6E, 0x0A,
-    0xF6, 0x9D, 0x14, 0x21, 0x01, 0x35, 0xCA, 0x8A, 0x80, 0x3B, 0x5C, 0x00, 0xB9, 0xB0, 0x6E, 0xE8,
-    0xEE, 0x37, 0x4C, 0x41, 0xC2, 0x38, 0xE4, 0x0F, 0x38, 0x1E, 0x4D, 0x8E, 0x51, 0xFA, 0x4B, 0x32,
-    0x1B, 0xD0, 0x29, 0x0B, 0xA0, 0x3C, 0xDB, 0x43, 0x22, 0x81, 0x35, 0x8C, 0xCB, 0xF1, 0x02, 0x65,
-    0x84, 0x65, 0xC1, 0xB9, 0x04, 0x78, 0xC0, 0x4E, 0x12, 0x07, 0x96, 0x22, 0xA9, 0x1C, 0x72, 0xA1,
-    0x2F, 0x87, 0x70, 0xC7, 0x69, 0x9A, 0xB8, 0xE1, 0x00, 0x4F, 0x0D, 0x5C, 0x90, 0x3B, 0xB8, 0xA0,
-    0x80, 0xBA, 0x10, 0xAE, 0xF5, 0x4B, 0x48, 0x27, 0x3B, 0x52, 0x18, 0x90, 0x64, 0xD8, 0xBC, 0xCB,
-    0x56, 0x45, 0xEA, 0x1E, 0xC6, 0x69, 0xF1, 0x04, 0x22, 0x20, 0x32, 0xDD, 0x9B, 0xC4, 0xEB, 0x94,
-    0xDF, 0x6A, 0xB3, 0xFB, 0x3E, 0x1D, 0x6A, 0x76, 0x39, 0x94, 0xBA, 0x3C, 0x13, 0x1C, 0x43, 0x48,
-    0x4E, 0x5E, 0xC8, 0xBB, 0x7D, 0xB9, 0xE3, 0x8E, 0x25, 0x42, 0xE4, 0x4D, 0x33, 0x1C, 0x48, 0xDC,
-    0x52, 0x80, 0x9C, 0xA0, 0xBF, 0xAF, 0xBA, 0x90, 0x35, 0x97, 0xD0, 0x66, 0x06, 0x35, 0x48, 0xB0,
-    0x21, 0xA5, 0xEE, 0xB0, 0x07, 0x13, 0xA8, 0x07, 0x09, 0xB3, 0xF6, 0x6B, 0x9F, 0x00, 0xBB, 0x02,
-    0x21, 0xF0, 0x60, 0xC1, 0x8F, 0x18, 0xFA, 0x2D, 0x42, 0xEA, 0x81, 0x2E, 0x25, 0xEB, 0xCF, 0x69,
-    0x6F, 0xF8, 0x46, 0x9C, 0xB9, 0xA8, 0x7B, 0x21, 0x0D, 0xE2, 0x74, 0x26, 0xF4, 0x80, 0x76, 0x41,
-    0xC4, 0xA1, 0xA4, 0xC0, 0x9B, 0x20, 0x59, 0x79, 0x5D, 0xD0, 0x52, 0x22, 0x5C, 0xDF, 0x44, 0x4C,
-    0x2B, 0xA4, 0x52, 0xE8, 0xB7, 0x11, 0x92, 0x57, 0x09, 0x46, 0x17, 0x13, 0xE5, 0x5B, 0x24, 0xCD,
-    0x09, 0x2A, 0x30, 0xCD, 0x1A, 0xE8, 0x57, 0x49, 0xA2, 0x93, 0xA2, 0xA6, 0x72, 0x00, 0x03, 0x00,
-    0xBC, 0x41, 0x3A, 0xF8, 0x09, 0xBC, 0x1D, 0x34, 0xB3, 0xD1, 0x55, 0xEC, 0x11, 0x32, 0x06, 0x75,
-    0x16, 0x78, 0x2F, 0xD8, 0x34, 0xA7, 0x77, 0xED, 0x06, 0x5C, 0xE0, 0xC4, 0xC7, 0x76, 0x1B, 0xF3,
-    0x6E, 0xDE, 0xE8, 0x65, 0xE6, 0x4F, 0xCE, 0x3B, 0xB8, 0xAE, 0xBE, 0x1D, 0x8F, 0xBD, 0x30, 0x2A,
-    0x29, 0xA2, 0x08, 0xE1, 0x16, 0x1C, 0x63, 0x04, 0xAD, 0xA0, 0xC0, 0x55, 0x44, 0x8D, 0x01, 0xE3,
-    0x9E, 0x0A, 0x21, 0x78, 0x75, 0x02, 0x78, 0x35, 0xAC, 0x78, 0xB1, 0x38, 0x0C, 0x7F, 0xD6, 0x21,
-    0x76, 0x91, 0x73, 0x43, 0x6E, 0x8B, 0x65, 0x84, 0x44, 0x24, 0xCF, 0x82, 0xE3, 0x61, 0xAE, 0xF4,
-    0xB1, 0x4C, 0x78, 0x12, 0xDE, 0x3B, 0x00, 0xDD, 0x75, 0xA3, 0xAD, 0x60, 0x30, 0xA8, 0x65, 0xCA,
-    0x5E, 0xD2, 0x94, 0x5D, 0x9E, 0x47, 0xF3, 0x13, 0x3C, 0x94, 0xBE, 0x44, 0x65, 0x58, 0xD5, 0x8D,
-    0xEA, 0x24, 0x6F, 0xC1, 0x8D, 0x41, 0x0B, 0x79, 0x15, 0x14, 0x53, 0xC8, 0x96, 0xBE, 0x5B, 0x09,
-    0xE6, 0x60, 0xB8, 0xF1, 0xF9, 0x26, 0x6F, 0x27, 0xDF, 0xC4, 0xA0, 0xB4, 0x34, 0x9F, 0xA3, 0xC0,
-    0x02, 0x88, 0x00, 0x5A, 0x5B, 0x35, 0x80, 0x75, 0x37, 0xBF, 0x0A, 0xD9, 0xA9, 0x0B, 0x4A, 0xCD,
-    0x6D, 0x20, 0xAF, 0x0A, 0x0A, 0xC0, 0x0A, 0x61, 0x9E, 0x5F, 0x9A, 0x2E, 0xF9, 0x14, 0x71, 0xB3,
-    0xF9, 0x68, 0x6B, 0x84, 0xB7, 0xD9, 0x5A, 0x38, 0x10, 0x7E, 0xA7, 0x7E, 0xCF, 0x7F, 0x7D, 0x94,
-    0x57, 0x1B, 0xD1, 0x00, 0x9A, 0xF3, 0xA2, 0xBF, 0x71, 0x15, 0x75, 0x1B, 0x24, 0x05, 0xA3, 0xA6,
-    0x89, 0xA8, 0x02, 0x99, 0x50, 0x6E, 0xC1, 0xFC, 0xA1, 0x80, 0x01, 0xC5, 0x02, 0x11, 0x43, 0x21,
-    0x26, 0xA5, 0x0D, 0x88, 0xFF, 0x82, 0xEF, 0xCA, 0x4B, 0xD3, 0xEB, 0x89, 0x14, 0xC9, 0xA7, 0xAE,
-    0xF0, 0xCF, 0x6C, 0x99, 0xBE, 0x68, 0xBF, 0x57, 0x4A, 0x2A, 0x14, 0x9A, 0xDC, 0x09, 0xED, 0x4B,
-    0xEE, 0x56, 0xD1, 0x03, 0x40, 0xDD, 0x19, 0x3A, 0x06, 0x0C, 0x8D, 0xAD, 0x6A, 0x36, 0xD2, 0x56,
-    0xED, 0xDA, 0xB8, 0xBF, 0x44, 0xDF, 0xC3, 0x9B, 0x78, 0xFB, 0xF3, 0xAD, 0xAD, 0x4B, 0xAF, 0x24,
-    0xAD, 0xF9, 0xA1, 0x4B, 0xBB, 0x6F, 0x08, 0xE5, 0x28, 0x85, 0x87, 0xF7, 0x69, 0x5F, 0x36, 0x48,
-    0xE6, 0x34, 0x83, 0xE2, 0x5E, 0x06, 0x7F, 0x04, 0x40, 0x3E, 0x76, 0x19, 0x52, 0x3B, 0x23, 0xB8,
-    0x1E, 0xD6, 0x6D, 0x50, 0xDB, 0x66, 0x1F, 0x15, 0x60, 0xFB, 0x07, 0xB0, 0x06, 0x11, 0xD6, 0x05,
-    0x67, 0xD8, 0x87, 0x59, 0xCB, 0x02, 0x8D, 0xC8, 0xF2, 0x3C, 0x24, 0x7C, 0x25, 0xB0, 0xA4, 0x05,
-    0x67, 0xF2, 0x89, 0x43, 0xD9, 0xF5, 0x0C, 0x7F, 0x0A, 0xB8, 0xD7, 0xC5, 0x82, 0x2D, 0x01, 0x28,
-    0x0B, 0x21, 0xDF, 0x30, 0x94, 0xB9, 0xE9, 0xF2, 0xB6, 0x54, 0xF6, 0xA5, 0xA7, 0x15, 0x07, 0x52,
-    0xB2, 0x98, 0xA7, 0x7C, 0xF4, 0x61, 0x26, 0x79, 0x0C, 0x3D, 0x42, 0xD1, 0x06, 0x52, 0x0A, 0x7F,
-    0x14, 0xEE, 0x1D, 0xC2, 0x59, 0x4F, 0xC7, 0xD2, 0x3A, 0xD8, 0x6B, 0x00, 0xD4, 0x56, 0xF5, 0xBA,
-    0xCD, 0x5B, 0xA4, 0x92, 0xE6, 0x39, 0x47, 0xA7, 0x5B, 0xFD, 0x08, 0xEF, 0xB0, 0xE4, 0xEB, 0xCD,
-    0x91, 0x0E, 0x47, 0x93, 0x10, 0xC8, 0xC2, 0x20, 0x36, 0xE7, 0x46, 0x54, 0xD6, 0x9B, 0x9D, 0xFA,
-    0x0C, 0x6B, 0x41, 0x38, 0x23, 0x47, 0x03, 0xF5, 0x04, 0x90, 0xCB, 0x7F, 0xFF, 0x1C, 0x5D, 0xE0,
-    0x45, 0x41, 0x88, 0xE8, 0x12, 0x10, 0xA4, 0xCD, 0x18, 0x48, 0xBE, 0x11, 0xBB, 0x38, 0xD4, 0xA9,
-    0x95, 0x4C, 0x5F, 0x73, 0xFF, 0x2D, 0x5E, 0x13, 0x06, 0x8E, 0x72, 0x65, 0x51, 0x02, 0xEE, 0xBF,
-    0x01, 0x07, 0x05, 0x4C, 0xC8, 0x8C, 0x33, 0x81, 0x63, 0xD8, 0xE5, 0xFC, 0x90, 0xFF, 0x51, 0xB5,
-    0x52, 0xCD, 0x7B, 0x1A, 0x93, 0x3E, 0xF6, 0x35, 0xB2, 0x14, 0x9C, 0x7D, 0xAB, 0x10, 0x77, 0x48,
-    0x1E, 0xCE, 0x0B, 0x35, 0xE5, 0x91, 0xEB, 0x7E, 0x8B, 0xF3, 0x36, 0x06, 0x70, 0xE6, 0x1D, 0xDF,
-    0x01, 0x2E, 0xC3, 0xB9, 0xEB, 0xBF, 0x0B, 0x75, 0xA7, 0x95, 0x51, 0xC0, 0xA2, 0x98, 0xF4, 0x01,
-    0x56, 0x33, 0xF1, 0xA9, 0x3A, 0x9A, 0x91, 0xBE, 0x25, 0xA8, 0x2A, 0x3C, 0xF3, 0x2E, 0x8C, 0x5B,
-    0xD5, 0x85, 0x68, 0x26, 0x83, 0xD5, 0x63, 0xF0, 0x73, 0xB0, 0x9E, 0xF2, 0x99, 0x86, 0x98, 0xFF,
-    0xC4, 0xF7, 0xB0, 0x70, 0x47, 0x85, 0x3C, 0x6D, 0x74, 0x17, 0x4D, 0xA5, 0x4A, 0xDD, 0x95, 0x03,
-    0xE8, 0x7F, 0x59, 0xE5, 0x5D, 0x3A, 0x44, 0x4F, 0x2F, 0x62, 0xEE, 0x01, 0xA4, 0x07, 0x10, 0xC4,
-    0x4A, 0xCA, 0x89, 0xF0, 0x21, 0xE6, 0x50, 0x8E, 0x7A, 0x09, 0x81, 0x94, 0xD9, 0x18, 0x53, 0xE2,
-    0xD1, 0xB3, 0x17, 0xF2, 0x9D, 0x03, 0xFC, 0xB1, 0x2B, 0x6D, 0x76, 0x31, 0x08, 0xBF, 0x6E, 0xA7,
-    0x38, 0x96, 0x28, 0xCC, 0x9E, 0x39, 0x40, 0xEB, 0x40, 0x15, 0xE0, 0x8C, 0x55, 0x66, 0x3D, 0x65,
-    0xF7, 0x87, 0x90, 0x20, 0xB2, 0xC7, 0xF8, 0xBF, 0x3F, 0xCA, 0x73, 0x1C, 0x32, 0x8F, 0xB6, 0x7A,
-    0x54, 0xAE, 0xF4, 0x62, 0x27, 0x64, 0xF4, 0x43, 0x2B, 0x23, 0x94, 0x51, 0x62, 0x55, 0xB1, 0x2C,
-    0x51, 0xBF, 0xE0, 0x22, 0xE5, 0xFB, 0x58, 0xE8, 0x6C, 0x19, 0xB1, 0x90, 0xB9, 0xBA, 0x2F, 0x7B,
-    0x61, 0x97, 0x35, 0xD3, 0xBA, 0xAF, 0x7D, 0x0D, 0x94, 0xCF, 0x5C, 0x86, 0x15, 0xCA, 0x86, 0xE5,
-    0xCA, 0x96, 0x77, 0xB2, 0xA5, 0x83, 0x6C, 0xCF, 0x79, 0xA0, 0x7D, 0xEE, 0x73, 0x50, 0xB7, 0xF7,
-    0xB0, 0xB5, 0x32, 0xAE, 0x8C, 0x1A, 0x18, 0x2B, 0x46, 0xEC, 0xA6, 0x4E, 0x24, 0x5D, 0x0C, 0x3A,
-    0x28, 0x34, 0x24, 0xCF, 0x36, 0x68, 0xAF, 0xF8, 0x24, 0xDF, 0x90, 0x92, 0x72, 0x06, 0x3F, 0x01,
-    0xCC, 0x72, 0x08, 0x97, 0xBC, 0xCD, 0xB1, 0x52, 0xB3, 0x0B, 0xD5, 0x49, 0xAD, 0x62, 0x1A, 0x15,
-    0x6E, 0x31, 0x7D, 0xEA, 0x73, 0x9B, 0x85, 0xB4, 0xB9, 0xF8, 0x9E, 0x51, 0x1C, 0x8E, 0xF8, 0x7D,
-    0x8F, 0x26, 0x9F, 0x22, 0x0E, 0xB3, 0x1E, 0x81, 0x00, 0x1B, 0x22, 0x31, 0x9C, 0x43, 0x18, 0x66,
-    0x36, 0x1D, 0x74, 0x93, 0x4B, 0x6D, 0x1C, 0xFB, 0x77, 0xC0, 0x98, 0xA5, 0x52, 0xE8, 0xA9, 0x5E,
-    0x23, 0x58, 0x25, 0x68, 0xDC, 0x08, 0x5A, 0xF6, 0xF4, 0xEA, 0x56, 0x45, 0x93, 0x0C, 0x12, 0x98,
-    0xE3, 0x24, 0x83, 0x6E, 0x99, 0xEA, 0xE3, 0x88, 0x64, 0x25, 0x5F, 0x3B, 0x9A, 0xE9, 0x16, 0x1A,
-    0x4F, 0x19, 0xA9, 0x0D, 0x0E, 0x9A, 0x79, 0x14, 0xB0, 0xE2, 0x76, 0xD9, 0x5E, 0xED, 0x83, 0xE2,
-    0x14, 0xA8, 0xB9, 0xF5, 0x01, 0xCD, 0x0E, 0xEB, 0x7B, 0x63, 0xFD, 0xC5, 0xB8, 0x82, 0x70, 0x19,
-    0x0F, 0x20, 0x0E, 0xFE, 0x7F, 0x07, 0x29, 0x45, 0x22, 0x43, 0xD6, 0xCC, 0xF9, 0x9C, 0x67, 0xD5,
-    0x9C, 0x29, 0xE9, 0x9E, 0x94, 0xD7, 0xC0, 0x8A, 0x01, 0x3E, 0x56, 0x94, 0x77, 0x2A, 0x53, 0x17,
-    0x28, 0x7E, 0xFF, 0x26, 0x68, 0x3E, 0x7D, 0x7B, 0x70, 0x22, 0x77, 0x2C, 0xA5, 0x38, 0xB2, 0xDF,
-    0xF0, 0xF2, 0x38, 0x03, 0x70, 0x3C, 0x67, 0xE7, 0x0F, 0x43, 0xCC, 0xF5, 0x8B, 0x0F, 0x0E, 0xB0,
-    0xAA, 0xCB, 0x38, 0x13, 0x07, 0x45, 0x61, 0x68, 0x45, 0xA3, 0x89, 0x0B, 0xB5, 0x94, 0x70, 0x9B,
-    0xA7, 0x0D, 0x05, 0x0A, 0x8D, 0x47, 0xA1, 0x30, 0x82, 0x2B, 0x0D, 0xDC, 0x44, 0xB3, 0xC3, 0x40,
-    0x20, 0x85, 0xED, 0x1C, 0xD8, 0x57, 0xA1, 0xAB, 0x1C, 0x20, 0x0B, 0x26, 0x87, 0x18, 0x3C, 0xDE,
-    0x03, 0x85, 0x45, 0x14, 0x49, 0xA7, 0xE5, 0x14, 0x89, 0x91, 0x24, 0x0C, 0xA9, 0xF9, 0xB2, 0xC5,
-    0x17, 0xCF, 0xD2, 0xA7, 0x6D, 0x6D, 0xB9, 0xD7, 0x67, 0xC1, 0x08, 0x30, 0x1B, 0xF0, 0x30, 0x75,
-    0x69, 0x9B, 0x0C, 0xBA, 0x37, 0xC0, 0x18, 0xC6, 0x00, 0x7A, 0xF7, 0xF6, 0x0D, 0xF0, 0xBC, 0x5F,
-    0x18, 0x14, 0xE9, 0xBE, 0xDF, 0x06, 0x5E, 0x80, 0x9B, 0x08, 0xD0, 0x49, 0xFA, 0xCC, 0x7A, 0x54,
-    0x77, 0x48, 0x21, 0xF9, 0x5E, 0xEE, 0x35, 0xA3, 0x71, 0x06, 0x09, 0x34, 0x45, 0x61, 0x1D, 0x7B,
-    0x33, 0xA5, 0x56, 0x0D, 0xE5, 0x2B, 0xB1, 0x24, 0xDE, 0xBD, 0x06, 0xB4, 0x19, 0xEA, 0x02, 0xE1,
-    0x83, 0x72, 0x0B, 0xC5, 0xD4, 0x20, 0x44, 0x44, 0x71, 0xFE, 0x64, 0x01, 0xDD, 0xF3, 0x16, 0x60,
-    0xFE, 0x77, 0x01, 0x92, 0x97, 0x22, 0xF9, 0xF0, 0x8B, 0xE1, 0xE5, 0x0B, 0x40, 0x2D, 0x1C, 0x47,
-    0x12, 0xBB, 0xB4, 0x69, 0x16, 0x6F, 0xDB, 0x7D, 0x58, 0x76, 0x7D, 0xDE, 0xBD, 0x92, 0x4B, 0x09,
-    0x22, 0xA8, 0x0D, 0x51, 0x53, 0x97, 0xA5, 0x2E, 0xB9, 0xE9, 0x7F, 0x62, 0x03, 0x63, 0x9B, 0x58,
-    0x0B, 0x98, 0x4A, 0x5B, 0xCF, 0xE4, 0x63, 0x23, 0x72, 0xDC, 0x36, 0x72, 0x5D, 0xDA, 0x21, 0xFB,
-    0xF9, 0x50, 0xE7, 0xA4, 0x3D, 0x6D, 0x50, 0x5E, 0x65, 0x5D, 0x1C, 0xBE, 0x4D, 0xCA, 0x77, 0x4B,
-    0x84, 0x40, 0x1F, 0xB2, 0x3B, 0x6D, 0x3F, 0xF7, 0x87, 0xB8, 0x71, 0x11, 0x7A, 0x0A, 0xC7, 0x07,
-    0xC1, 0x6F, 0x42, 0xDF, 0xED, 0x89, 0x93, 0x05, 0x68, 0x2B, 0x32, 0xF9, 0xE0, 0xB9, 0x21, 0xC4,
-    0x5F, 0xDE, 0x41, 0x54, 0x44, 0x41, 0x90, 0xF8, 0x62, 0x94, 0xF2, 0xDB, 0x9F, 0xB1, 0x1F, 0xA0,
-    0x98, 0xD7, 0xF0, 0xCA, 0x7F, 0x01, 0xBD, 0x59, 0x3D, 0x6C, 0xDD, 0xD6, 0x15, 0x3E, 0xE4, 0xD5,
-    0x33, 0x93, 0x10, 0x30, 0x55, 0xC0, 0x42, 0xD3, 0xA6, 0x2D, 0x33, 0x14, 0x85, 0x07, 0x27, 0xCC,
-    0x90, 0xC1, 0x2D, 0x2C, 0x91, 0x8E, 0x06, 0x0F, 0x41, 0xAB, 0x57, 0x40, 0x42, 0x87, 0x0C, 0xF6,
-    0xD0, 0xA1, 0x49, 0x87, 0x64, 0xD0, 0x90, 0xC1, 0x36, 0x99, 0x78, 0xF0, 0x10, 0xA0, 0xF2, 0x10,
-    0x64, 0xE8, 0x54, 0x20, 0x2E, 0x90, 0x08, 0x45, 0xED, 0x21, 0x28, 0x32, 0x48, 0xE6, 0x95, 0x05,
-    0x54, 0x43, 0x06, 0xD3, 0x36, 0x82, 0x0C, 0x19, 0x4C, 0x27, 0x08, 0x0C, 0xD4, 0x83, 0x19, 0x9B,
-    0xAE, 0x69, 0xE9, 0x92, 0xA7, 0xDF, 0xB9, 0x7C, 0xCF, 0xB2, 0x83, 0x36, 0x4D, 0xFC, 0xF7, 0xDE,
-    0x23, 0x45, 0x5E, 0xF2, 0x9E, 0x73, 0xEE, 0xF9, 0xF9, 0xCE, 0x39, 0x57, 0x03, 0x65, 0xE2, 0x0B,
-    0x86, 0x88, 0x82, 0xCC, 0x04, 0x1A, 0xBF, 0x36, 0x28, 0xF0, 0xEB, 0xC2, 0xCB, 0x6D, 0xB4, 0x76,
-    0x12, 0xE3, 0xE4, 0x54, 0x44, 0x87, 0x89, 0x42, 0x22, 0x2F, 0x23, 0xB7, 0xA6, 0x90, 0xCB, 0x90,
-    0xBB, 0xF0, 0xB3, 0xB9, 0x73, 0x17, 0x2E, 0x5C, 0xAC, 0x3E, 0xFA, 0x81, 0xD9, 0x43, 0xA9, 0x4F,
-    0xE1, 0x59, 0xED, 0x55, 0xA7, 0xA9, 0xDB, 0x47, 0xF1, 0xB5, 0x57, 0x8E, 0x31, 0x97, 0x31, 0x97,
-    0x74, 0x04, 0x64, 0x89, 0x94, 0x26, 0x02, 0x8D, 0x7D, 0x44, 0x4F, 0x09, 0xBD, 0x09, 0x22, 0x9F,
-    0x13, 0x62, 0x4E, 0xFC, 0x2A, 0xA7, 0x38, 0x31, 0x8E, 0x51, 0xDA, 0xC7, 0x0B, 0x91, 0xA6, 0x01,
-    0x2F, 0x50, 0xCE, 0xC6, 0x39, 0xB5, 0x79, 0x02, 0x4F, 0xC8, 0x81, 0x60, 0x1E, 0x9E, 0xE0, 0xF2,
-    0xA9, 0x6E, 0x79, 0x35, 0x66, 0xAE, 0x99, 0x59, 0x9F, 0xA0, 0x5D, 0x42, 0x48, 0x65, 0xC3, 0xBD,
-    0x67, 0xF2, 0x6B, 0x6B, 0xCC, 0x95, 0x7F, 0xB9, 0x25, 0xA3, 0xCA, 0x20, 0x9B, 0xB1, 0x7F, 0x8A,
-    0xD6, 0xC1, 0xE0, 0x19, 0xBE, 0xB6, 0xFE, 0xD6, 0x70, 0x2F, 0x8D, 0x3E, 0x21, 0xAF, 0xF1, 0x0D,
-    0x2E, 0xD3, 0x3A, 0x2A, 0x55, 0xA5, 0x0C, 0x56, 0x92, 0x26, 0x86, 0x82, 0x0A, 0x42, 0xB6, 0x31,
-    0x29, 0xBE, 0x64, 0x20, 0x13, 0x13, 0xA5, 0x9A, 0xFC, 0x53, 0x9B, 0xA5, 0x0B, 0x66, 0x44, 0xB8,
-    0xA7, 0x18, 0xF2, 0x07, 0x90, 0x22, 0xE5, 0x82, 0x22, 0xC6, 0xC5, 0xEA, 0xE8, 0xF3, 0xAA, 0x90,
-    0x3D, 0x32, 0xBE, 0x93, 0x9B, 0x14, 0xD3, 0x8C, 0x9F, 0x99, 0x30, 0x39, 0x8C, 0xD5, 0xC4, 0x35,
-    0x4D, 0x33, 0xED, 0x4B, 0xCB, 0x19, 0xBF, 0x09, 0xB3, 0xD6, 0xAF, 0x9F, 0x77, 0x39, 0xA0, 0xF4,
-    0x1C, 0xD6, 0xFF, 0x24, 0x75, 0x31, 0xAD, 0xC4, 0x49, 0x13, 0x71, 0x29, 0xDA, 0x98, 0xC4, 0x64,
-    0xB7, 0x3E, 0x1A, 0x2F, 0xDD, 0xA8, 0xCF, 0x4C, 0x38, 0x58, 0xF9, 0x87, 0x18, 0xC8, 0xC1, 0x30,
-    0x4C, 0xDC, 0x12, 0xDA, 0x73, 0xCA, 0x80, 0x96, 0xF7, 0x17, 0x8B, 0x21, 0xBB, 0xEB, 0xBA, 0xDE,
-    0xE7, 0xFD, 0xC6, 0xD7, 0x27, 0x76, 0xBE, 0x38, 0x43, 0xB4, 0xB7, 0x68, 0x88, 0x6E, 0xCC, 0x96,
-    0xA4, 0xFE, 0xE4, 0x6B, 0xDA, 0xB9, 0x27, 0xFC, 0x97, 0x5E, 0x5C, 0x0C, 0x3B, 0xA5, 0xAB, 0x41,
-    0xF2, 0x1C, 0x26, 0x62, 0xF6, 0x6D, 0xB1, 0x43, 0xCA, 0x19, 0xD1, 0x60, 0x08, 0x1B, 0x94, 0x01,
-    0x7B, 0xEB, 0x9A, 0xEA, 0x67, 0xDA, 0xF0, 0xE0, 0xCB, 0xC7, 0x2E, 0x30, 0x47, 0x4B, 0x09, 0xB9,
-    0xCB, 0xFF, 0x60, 0x33, 0x52, 0x94, 0xA7, 0xA7, 0xDD, 0x26, 0xD4, 0xB9, 0x57, 0xC5, 0x67, 0x5B,
-    0x55, 0xC7, 0x59, 0x7C, 0xD6, 0x50, 0xE7, 0x57, 0xAA, 0x89, 0xB4, 0xAF, 0x8F, 0xC8, 0x2B, 0xAF,
-    0x2D, 0x7F, 0x90, 0x73, 0x8B, 0x1F, 0x09, 0xED, 0xFE, 0xB7, 0x2B, 0xE2, 0x39, 0xFE, 0x12, 0x4A,
-    0x1B, 0x88, 0x81, 0x33, 0x2F, 0x0B, 0xE9, 0xD3, 0xE1, 0xDE, 0xDD, 0x67, 0x8A, 0xF5, 0xD9, 0xA5,
-    0x9D, 0x2F, 0xFC, 0xB2, 0x78, 0x5F, 0x35, 0xFE, 0x0B, 0xBF, 0x2A, 0xDE, 0x3F, 0x7E, 0xE9, 0xD7,
-    0x3F, 0x99, 0xFF, 0x85, 0x3E, 0x4D, 0x8B, 0xEE, 0x57, 0xAB, 0xB2, 0xD0, 0x94, 0x4F, 0xF1, 0xE5,
-    0x85, 0x21, 0x0D, 0x49, 0xBC, 0xE6, 0xE5, 0xC2, 0x18, 0xFF, 0x5C, 0xB6, 0xB2, 0x1A, 0x6C, 0x70,
-    0x1D, 0xB6, 0x34, 0x45, 0xF4, 0x07, 0xA2, 0x95, 0xD1, 0x6F, 0x61, 0x75, 0x7E, 0xC4, 0x78, 0x65,
-    0x7B, 0x10, 0xEE, 0x30, 0xB5, 0x30, 0x1E, 0x87, 0xC3, 0xBE, 0xEB, 0x72, 0x95, 0xE6, 0xEF, 0xAC,
-    0x35, 0xBB, 0xC3, 0x4C, 0x55, 0xD4, 0xC2, 0x7F, 0x02, 0xED, 0x6D, 0x42, 0xE4, 0xB3, 0xCB, 0x27,
-    0x9D, 0x77, 0x7D, 0xDE, 0xB8, 0x52, 0x17, 0xAB, 0x94, 0x3A, 0x4C, 0x79, 0x45, 0x67, 0x28, 0xCC,
-    0x5E, 0xFF, 0x9C, 0x4B, 0x51, 0x10, 0x3D, 0xA5, 0xBE, 0xB8, 0x69, 0x56, 0x9E, 0x20, 0x4A, 0x28,
-    0x89, 0xB5, 0x7C, 0xD3, 0xEC, 0x5B, 0xBF, 0x3A, 0xCF, 0xD2, 0x7F, 0x73, 0x91, 0xF2, 0xD5, 0x2E,
-    0xE5, 0x63, 0x26, 0xDD, 0x45, 0xC3, 0x54, 0x1C, 0x21, 0xE9, 0x8F, 0x1C, 0x87, 0x75, 0x13, 0x67,
-    0x61, 0xE8, 0xC1, 0x75, 0x73, 0xBE, 0xED, 0xF3, 0x67, 0x3A, 0xE6, 0x83, 0x0E, 0xB7, 0x87, 0x7D,
-    0xBE, 0x59, 0x45, 0xB8, 0x4D, 0xF9, 0x20, 0xE1, 0xD6, 0xC1, 0xAD, 0xB3, 0xF5, 0x99, 0xA6, 0xE0,
-    0x20, 0xD1, 0x34, 0x62, 0xEE, 0x66, 0x45, 0xEA, 0xEE, 0x5B, 0x58, 0xF9, 0x9F, 0x36, 0xA4, 0xE8,
-    0x59, 0x84, 0x4B, 0xB4, 0x65, 0xB0, 0xDC, 0xE7, 0xA3, 0xD2, 0x4C, 0x1F, 0x7D, 0x92, 0x68, 0xD2,
-    0x69, 0x15, 0x27, 0xAF, 0x17, 0x70, 0xEC, 0x55, 0x8A, 0x12, 0x5F, 0x2E, 0xCE, 0x28, 0xAE, 0x97,
-    0x3F, 0xD8, 0xD1, 0x60, 0xC9, 0x6B, 0x5B, 0x65, 0x8C, 0xBF, 0xEE, 0x96, 0xAE, 0xE1, 0xA2, 0x70,
-    0x1A, 0x67, 0xF9, 0xF4, 0xD8, 0xE4, 0xCF, 0x3B, 0x15, 0x8C, 0x9D, 0xE4, 0x5E, 0xED, 0xD7, 0x69,
-    0x06, 0x53, 0xE7, 0x07, 0x9A, 0x74, 0xB6, 0x89, 0x55, 0x1D, 0x39, 0x35, 0xDD, 0xF3, 0x51, 0x19,
-    0xC9, 0xD0, 0x0A, 0x02, 0x26, 0x01, 0x66, 0x88, 0x8F, 0xBB, 0x12, 0xBB, 0x89, 0xB8, 0x00, 0x38,
-    0x06, 0x5A, 0x6E, 0xE4, 0x15, 0xDC, 0xC4, 0x18, 0x8C, 0x12, 0x4F, 0x87, 0x22, 0x4B, 0xA3, 0x5A,
-    0x17, 0x16, 0xA5, 0xAD, 0x22, 0xE6, 0xD9, 0x32, 0x9A, 0x06, 0xB1, 0x15, 0x6F, 0xBD, 0xC0, 0x7A,
-    0x92, 0x1A, 0x37, 0x0A, 0x9A, 0xB0, 0xEE, 0xC4, 0xF0, 0x7A, 0x50, 0x51, 0x85, 0x50, 0x20, 0x3C,
-    0x89, 0x21, 0x6B, 0x22, 0x16, 0xB9, 0xE7, 0x03, 0x38, 0x09, 0x13, 0xF9, 0xF5, 0xAF, 0x43, 0x0E,
-    0x0F, 0xB4, 0x56, 0x49, 0x95, 0x22, 0x80, 0xC8, 0xE4, 0x17, 0xD4, 0x58, 0x31, 0x56, 0xE0, 0x46,
-    0xAB, 0x34, 0x1D, 0xB2, 0x8E, 0x92, 0x28, 0x58, 0xAF, 0xF3, 0x36, 0x78, 0xA9, 0x04, 0x9A, 0xCC,
-    0x69, 0xA1, 0xED, 0x69, 0xC1, 0x17, 0x4C, 0xC3, 0x19, 0xD3, 0x70, 0xC6, 0xB4, 0x74, 0x21, 0xC1,
-    0x1A, 0x63, 0x44, 0xFB, 0x51, 0x38, 0x73, 0x43, 0x51, 0xCF, 0xF4, 0x6E, 0x19, 0x26, 0x2C, 0x20,
-    0x86, 0x1D, 0x91, 0x21, 0x6F, 0xAB, 0x16, 0x51, 0x16, 0xA3, 0x04, 0xFE, 0x86, 0xA5, 0x88, 0x53,
-    0xEE, 0x30, 0xA2, 0x1F, 0xF8, 0xB4, 0xC8, 0xE2, 0x44, 0x80, 0xA6, 0x23, 0xE4, 0x34, 0x3E, 0x94,
-    0x01, 0xCF, 0xA8, 0x55, 0xEB, 0x71, 0x19, 0x41, 0x19, 0x69, 0xED, 0x15, 0x50, 0xC6, 0x90, 0x1A,
-    0xAB, 0x8C, 0x90, 0xAC, 0x32, 0x4A, 0xAB, 0x8C, 0x95, 0x5E, 0x19, 0x99, 0x28, 0x43, 0x08, 0xE3,
-    0xC9, 0x4C, 0xAF, 0x8C, 0xCC, 0x8A, 0xB0, 0x4B, 0x70, 0x89, 0x2D, 0x38, 0xC9, 0xE7, 0x67, 0x90,
-    0xDF, 0xC9, 0x89, 0xAB, 0xB8, 0xF3, 0x6F, 0x63, 0x32, 0x00, 0xE1, 0x30, 0xA9, 0xFA, 0xE9, 0x90,
-    0x8B, 0xBC, 0x73, 0x58, 0x8F, 0x25, 0xDF, 0x69, 0xE1, 0x50, 0x6E, 0xC3, 0x46, 0xE2, 0x5D, 0x82,
-    0x86, 0x7E, 0x74, 0x67, 0x61, 0x3F, 0x96, 0x93, 0x00, 0x9F, 0x03, 0x13, 0xC3, 0xCE, 0x7A, 0x74,
-    0xF2, 0x2F, 0x89, 0xB1, 0x96, 0xC4, 0xDA, 0x73, 0x02, 0xCA, 0x1E, 0x26, 0x1F, 0x55, 0x70, 0xA1,
-    0xF6, 0x77, 0xA0, 0xC0, 0xDC, 0x91, 0x2B, 0x00, 0x0A, 0x41, 0x39, 0xF1, 0x4A, 0xE0, 0x68, 0x50,
-    0x50, 0x5C, 0xE4, 0x06, 0x90, 0xC8, 0x70, 0x4D, 0xB3, 0xED, 0x41, 0x16, 0xEB, 0x31, 0x45, 0x28,
-    0x77, 0x82, 0x7C, 0xC9, 0xE3, 0x62, 0x2E, 0x7F, 0xC5, 0x73, 0x41, 0x4F, 0x1C, 0x75, 0x16, 0xA4,
-    0xF6, 0xD0, 0x89, 0x47, 0xCE, 0x7C, 0x90, 0x80, 0x5E, 0x78, 0x1D, 0x54, 0x62, 0x18, 0x94, 0xF6,
-    0x48, 0x4A, 0x99, 0x18, 0x3C, 0xA6, 0x45, 0xC7, 0x78, 0x44, 0xA9, 0x25, 0x20, 0xA7, 0x29, 0x27,
-    0x79, 0xF4, 0x7C, 0x7F, 0x6F, 0xF5, 0x2C, 0x65, 0xC5, 0x1C, 0x28, 0x07, 0x08, 0x14, 0x0A, 0xDE,
-    0xC1, 0x95, 0x27, 0xE6, 0x86, 0xB3, 0x3F, 0x52, 0xE6, 0x0B, 0x0B, 0x0B, 0xF3, 0xA2, 0x69, 0xE0,
-    0x2D, 0xED, 0xC0, 0x59, 0xA8, 0xF0, 0x00, 0x0F, 0xE2, 0x54, 0x23, 0x90, 0xC3, 0xA5, 0xCA, 0x05,
-    0x87, 0x75, 0x51, 0x8F, 0x5F, 0x8A, 0x04, 0xAA, 0x8A, 0x91, 0xB7, 0xDC, 0x3A, 0x60, 0xCB, 0xA6,
-    0x5B, 0xA6, 0xBE, 0x14, 0x40, 0x6A, 0x62, 0x3D, 0x00, 0x48, 0x04, 0x95, 0x2A, 0xA2, 0x4C, 0x19,
-    0xA7, 0x0E, 0x0A, 0x87, 0x97, 0xDB, 0x88, 0x15, 0x5E, 0x08, 0x50, 0x51, 0x58, 0x1E, 0x5D, 0x02,
-    0x91, 0x00, 0xEA, 0xAC, 0x50, 0x86, 0x44, 0x85, 0xAA, 0x98, 0xFC, 0xE3, 0x00, 0xAF, 0xA8, 0xB0,
-    0x2B, 0x14, 0xE1, 0x03, 0xDC, 0xC6, 0xB0, 0x43, 0xAE, 0xED, 0x7A, 0x15, 0x67, 0xCE, 0x01, 0x66,
-    0x80, 0x00, 0x57, 0x2E, 0x96, 0x24, 0x69, 0xCE, 0xC1, 0x42, 0x05, 0x98, 0x05, 0xC1, 0x00, 0x26,
-    0x2E, 0x2E, 0x77, 0x8C, 0x0C, 0xF5, 0xA2, 0x54, 0x03, 0x72, 0x08, 0x42, 0x08, 0x22, 0x1F, 0xB2,
-    0xC3, 0x53, 0x58, 0x28, 0xB8, 0x9A, 0x08, 0x87, 0x6A, 0x51, 0x47, 0x19, 0x3A, 0x8C, 0xE3, 0x45,
-    0x61, 0x68, 0x0F, 0x48, 0x65, 0x8F, 0x6E, 0x39, 0x19, 0x8D, 0x4D, 0xE2, 0xD8, 0x87, 0x63, 0x05,
-    0x63, 0x76, 0x1E, 0xE6, 0x37, 0x3D, 0x93, 0x9F, 0xF6, 0x4C, 0x3C, 0x48, 0x1C, 0x60, 0xE8, 0x49,
-    0x7A, 0xF8, 0x3C, 0x04, 0xC4, 0x02, 0x6B, 0x08, 0x84, 0x22, 0x70, 0xED, 0x2F, 0xEE, 0xC3, 0xE7,
-    0x61, 0x80, 0xFE, 0x6D, 0xAC, 0x1D, 0x13, 0x67, 0x34, 0x1C, 0x3C, 0x6C, 0xFA, 0x25, 0xA0, 0x0B,
-    0x06, 0x04, 0x66, 0x3A, 0x99, 0x64, 0x75, 0xD0, 0xBD, 0xC0, 0x0D, 0x5E, 0x8C, 0xF5, 0xFF, 0x3E,
-    0x21, 0xF1, 0xB5, 0x36, 0xF0, 0xC5, 0x92, 0x91, 0x0E, 0x0C, 0x50, 0xEF, 0xE7, 0x74, 0x1F, 0xD3,
-    0x03, 0x88, 0x49, 0xAB, 0x26, 0x52, 0x5F, 0x64, 0x4F, 0x7C, 0xFF, 0xE9, 0xAA, 0x3A, 0x92, 0xCE,
-    0xDD, 0xAA, 0xBB, 0x5D, 0x82, 0x00, 0x53, 0x0B, 0xB3, 0x0C, 0x3F, 0xCE, 0xBE, 0x6D, 0x26, 0x4E,
-    0x45, 0xC4, 0x17, 0xB9, 0x1D, 0xBC, 0xF6, 0xA1, 0x0D, 0x89, 0xC2, 0xB5, 0xE1, 0xC4, 0x4E, 0x8E,
-    0x0A, 0x9A, 0xD2, 0x02, 0x99, 0x27, 0x47, 0x8D, 0x04, 0x27, 0x47, 0x40, 0xB6, 0x7F, 0xEC, 0x4E,
-    0x06, 0x37, 0xA5, 0xF4, 0x2F, 0xE2, 0xA2, 0x1F, 0x12, 0x4D, 0x87, 0xA5, 0x4D, 0x52, 0xB1, 0x86,
-    0x6F, 0xF3, 0x9F, 0x39, 0x8B, 0xA4, 0xB0, 0x66, 0xBE, 0x3D, 0x06, 0x21, 0x47, 0xB0, 0x51, 0xB5,
-    0xFB, 0x04, 0x08, 0x24, 0xE6, 0xF6, 0x4A, 0xCD, 0x44, 0x63, 0x70, 0x74, 0x16, 0x12, 0x67, 0xE1,
-    0xB7, 0x5C, 0xBB, 0x62, 0x3D, 0x4A, 0x5B, 0xE4, 0x53, 0x74, 0x05, 0x71, 0x4B, 0x29, 0x05, 0xAC,
-    0x43, 0xE8, 0xA3, 0x41, 0x87, 0xD0, 0xF2, 0x7E, 0x0C, 0x46, 0x15, 0x06, 0xD7, 0x19, 0x83, 0x55,
-    0x7C, 0xA5, 0x22, 0xE3, 0xB7, 0x18, 0x04, 0x2B, 0xA8, 0x0D, 0xEF, 0xAA, 0xCA, 0xE1, 0x4A, 0xE6,
-    0x1A, 0xC5, 0x95, 0x62, 0x07, 0xB1, 0x9E, 0xEA, 0xBB, 0x38, 0xB9, 0x72, 0x03, 0x9F, 0xE9, 0x71,
-    0xCB, 0x17, 0x74, 0x70, 0xB2, 0xD1, 0xB3, 0xD7, 0x4F, 0x4A, 0x35, 0x5E, 0x0B, 0xA6, 0x14, 0x41,
-    0xE3, 0xB1, 0xDB, 0x22, 0x44, 0xB0, 0xEE, 0x7C, 0xA3, 0x81, 0xE8, 0x10, 0x38, 0xBE, 0x54, 0xE3,
-    0x82, 0xEF, 0x5C, 0xA0, 0x30, 0xFA, 0xC4, 0x60, 0xFD, 0xE0, 0x90, 0xCF, 0x32, 0x85, 0x55, 0xD8,
-    0xBD, 0x62, 0x04, 0x4E, 0x84, 0x0E, 0xA8, 0x2E, 0xDC, 0xC1, 0xFE, 0xD3, 0x23, 0xAE, 0x51, 0x3D,
-    0xCA, 0xC4, 0x3F, 0xA7, 0x47, 0xCE, 0x34, 0xCA, 0x7A, 0x24, 0x76, 0x36, 0x05, 0x5B, 0x51, 0x26,
-    0x78, 0xD9, 0xEE, 0x47, 0xC9, 0x74, 0xE0, 0x8C, 0x2C, 0x9C, 0x02, 0x2D, 0xD5, 0x3B, 0xB5, 0x2D,
-    0x5D, 0xFA, 0xCF, 0x8E, 0xCD, 0x04, 0x05, 0x16, 0x27, 0x08, 0x3F, 0xD8, 0x36, 0x4B, 0x2B, 0x60,
-    0x26, 0xEA, 0x68, 0xE8, 0x3F, 0x05, 0xE5, 0xCF, 0xEF, 0xE5, 0x25, 0x17, 0x10, 0xC3, 0x00, 0x44,
-    0xE3, 0x0D, 0xBC, 0x53, 0xC7, 0xB0, 0xA9, 0xC3, 0x5F, 0xE5, 0x5A, 0x70, 0xD4, 0x16, 0x6A, 0xB6,
-    0xC7, 0xE9, 0xDB, 0x98, 0x12, 0x26, 0x64, 0x54, 0x5B, 0xC1, 0xD7, 0xB8, 0xD8, 0x35, 0x78, 0x94,
-    0x0C, 0x27, 0x68, 0xF2, 0x63, 0x75, 0xB1, 0x89, 0x8F, 0x6D, 0x35, 0x40, 0x76, 0x0F, 0x4E, 0xD6,
-    0xA8, 0x2D, 0xDC, 0x36, 0x8D, 0x2A, 0x32, 0x70, 0x76, 0xF2, 0x13, 0xCF, 0xA2, 0x77, 0x6C, 0xA5,
-    0xA0, 0x83, 0xF3, 0xA1, 0x18, 0x2B, 0x7C, 0xE8, 0x58, 0x22, 0x23, 0xAF, 0x42, 0x34, 0x8D, 0x75,
-    0x54, 0xF8, 0xE7, 0x6A, 0x44, 0x5B, 0x80, 0xD3, 0x0A, 0x4E, 0x17, 0x2A, 0x9C, 0xAE, 0xEA, 0x00,
-    0x55, 0x31, 0xB2, 0x4F, 0x68, 0x90, 0x4B, 0x02, 0x89, 0xC9, 0x80, 0xDF, 0x63, 0x12, 0x3C, 0xA2,
-    0xC3, 0x68, 0x1D, 0x51, 0xF4, 0xCF, 0x8F, 0x8D, 0xEA, 0x25, 0x36, 0x9F, 0xC9, 0xC9, 0x76, 0x41,
-    0x6C, 0x57, 0x4B, 0x63, 0x14, 0x4F, 0xA4, 0x43, 0x5A, 0x63, 0x74, 0x29, 0x49, 0xDE, 0x20, 0xA7,
-    0x06, 0xC5, 0x77, 0x3E, 0x21, 0x86, 0x0B, 0x04, 0x72, 0x04, 0x28, 0x81, 0x04, 0x2E, 0x24, 0x48,
-    0x6C, 0x1E, 0x86, 0x1C, 0x62, 0xCA, 0x6D, 0x5F, 0x76, 0x04, 0xA3, 0xA4, 0x95, 0x47, 0x23, 0x2C,
-    0xC9, 0x5D, 0xC2, 0xE7, 0xC4, 0x63, 0x95, 0x20, 0xA5, 0x71, 0x5D, 0x79, 0x4B, 0x52, 0xCD, 0x5A,
-    0x23, 0x9B, 0x0E, 0x87, 0x1E, 0xA3, 0x04, 0xC1, 0x59, 0xC9, 0xFB, 0xEB, 0xE0, 0x1B, 0xCA, 0x69,
-    0x40, 0xC3, 0xC7, 0xB9, 0xFC, 0x37, 0x46, 0x60, 0x12, 0x7E, 0x03, 0x4C, 0xD0, 0x7D, 0x4E, 0x81,
-    0xFB, 0x71, 0xBE, 0x82, 0xA6, 0xA3, 0x01, 0xB6, 0x75, 0x40, 0xF6, 0x10, 0x89, 0x4C, 0xA1, 0x63,
-    0xAB, 0x8F, 0x62, 0xD2, 0x39, 0x4D, 0x6E, 0x07, 0x81, 0x03, 0x5B, 0xF6, 0x14, 0x7D, 0x5E, 0xB4,
-    0x5B, 0x1F, 0xDB, 0x17, 0xAD, 0x60, 0x63, 0x27, 0x51, 0x5C, 0xCA, 0x7A, 0x6C, 0x2D, 0xFB, 0x4C,
-    0x37, 0x4E, 0xA1, 0x9D, 0x84, 0x14, 0xD2, 0x42, 0x68, 0x94, 0xFD, 0xBA, 0x6D, 0x7F, 0xC8, 0xD7,
-    0x43, 0xF3, 0x87, 0x94, 0xC1, 0x9C, 0xA9, 0xEE, 0x5D, 0xFB, 0x3E, 0x9A, 0xB1, 0xBE, 0x16, 0x76,
-    0x5E, 0x95, 0x65, 0x14, 0x00, 0x8B, 0xCA, 0x6D, 0xFD, 0x5A, 0x35, 0xAA, 0xF6, 0x6A, 0x55, 0xFB,
-    0xE8, 0x48, 0xFD, 0x2A, 0xCA, 0xFC, 0x6A, 0x15, 0x1E, 0x85, 0xD0, 0xAB, 0x3A, 0x1C, 0xAC, 0xFD,
-    0x2A, 0xC5, 0x78, 0x68, 0x7C, 0x44, 0x11, 0x3C, 0x8D, 0xFD, 0xAF, 0x75, 0xE7, 0xDF, 0x28, 0xDB,
-    0xF4, 0x06, 0x9B, 0xFC, 0x6B, 0x08, 0x86, 0x4A, 0x4A, 0xDA, 0x89, 0x95, 0xDE, 0x11, 0x45, 0x19,
-    0xB8, 0x1C, 0xF5, 0x4B, 0xCE, 0x10, 0xD5, 0x8D, 0xEC, 0xEC, 0x24, 0xE9, 0x01, 0x83, 0x8E, 0x57,
-    0x0F, 0x20, 0x8A, 0x93, 0x6A, 0x1F, 0x65, 0x01, 0xE7, 0x3A, 0x57, 0x26, 0xC0, 0x20, 0xBF, 0xD2,
-    0xFA, 0x52, 0x2C, 0x34, 0x9C, 0x48, 0xA6, 0x94, 0x10, 0x6A, 0x2C, 0x66, 0x4A, 0xF5, 0x02, 0x62,
-    0x2E, 0xDD, 0x3F, 0xB1, 0x89, 0x3E, 0x44, 0x61, 0xBF, 0x19, 0xF4, 0x67, 0xEB, 0x15, 0x55, 0x3B,
-    0xEF, 0x9B, 0x98, 0x9B, 0xC1, 0x0B, 0xE6, 0xA0, 0xC9, 0x8A, 0x2E, 0xC3, 0x34, 0xCE, 0xC8, 0xD1,
-    0x60, 0x9F, 0x4E, 0x1C, 0xC3, 0xAB, 0x53, 0x9D, 0x82, 0xCA, 0x10, 0xB6, 0xFB, 0xA1, 0x81, 0x7E,
-    0x75, 0xBC, 0x05, 0xB5, 0x81, 0x0A, 0x88, 0xDD, 0xCC, 0x8B, 0x9C, 0xF9, 0x2C, 0x2F, 0xD5, 0x4E,
-    0x62, 0xA1, 0xD8, 0x69, 0x62, 0x8A, 0x36, 0x6A, 0xD7, 0xA4, 0x20, 0x94, 0xDC, 0x3F, 0xA5, 0x55,
-    0xE8, 0xBC, 0x21, 0xEF, 0x98, 0xA6, 0x37, 0xF7, 0x91, 0xB7, 0xA1, 0x29, 0xAA, 0x2C, 0xD8, 0xDF,
-    0x97, 0xB6, 0xA6, 0x30, 0x33, 0xE4, 0x90, 0xA5, 0xEA, 0xE0, 0xF0, 0x3C, 0xBF, 0xDD, 0x42, 0x0C,
-    0xD5, 0xCC, 0x07, 0x65, 0x88, 0x46, 0x57, 0xB8, 0x32, 0x7F, 0x18, 0x5F, 0x69, 0xC8, 0x85, 0x38,
-    0x02, 0x93, 0x68, 0xE2, 0x3F, 0xE5, 0xDB, 0x7F, 0xC7, 0x23, 0xAE, 0xF3, 0x26, 0x02, 0x15, 0xB4,
-    0x5E, 0x24, 0x07, 0x60, 0x34, 0x46, 0x65, 0x72, 0xD1, 0x84, 0x45, 0x1A, 0x54, 0x3B, 0xC5, 0x05,
-    0xD9, 0xBA, 0x35, 0x0A, 0x73, 0x57, 0x76, 0xFD, 0x36, 0xFF, 0x06, 0xCE, 0x70, 0xED, 0x84, 0xE6,
-    0xED, 0x76, 0x96, 0xD4, 0xEE, 0x8D, 0xDD, 0xF9, 0xC4, 0x92, 0x9E, 0xEE, 0x4B, 0xEE, 0x69, 0xDB,
-    0x36, 0xCB, 0xAE, 0x64, 0x98, 0x8D, 0x7D, 0x0A, 0x5A, 0xCA, 0x51, 0xD8, 0x30, 0xDC, 0xB0, 0x4E,
-    0xA9, 0x8B, 0xB3, 0x78, 0x89, 0xF9, 0x4B, 0x14, 0x8B, 0xDD, 0x98, 0xBC, 0xC3, 0x7F, 0xFD, 0x28,
-    0x66, 0xA9, 0xC2, 0x44, 0x0B, 0x44, 0xDA, 0x7A, 0x51, 0x6C, 0xB7, 0x35, 0x83, 0x64, 0xDC, 0xFC,
-    0x7E, 0x7F, 0x3A, 0xB6, 0x9C, 0x46, 0xB1, 0xE2, 0xDE, 0x2A, 0xA9, 0x3E, 0x4C, 0x1F, 0xFB, 0xF7,
-    0x4D, 0x07, 0x25, 0x73, 0x3A, 0x57, 0x06, 0xEB, 0x35, 0x25, 0x93, 0x76, 0x60, 0x1E, 0x3A, 0x29,
-    0x11, 0xAE, 0xAA, 0x89, 0xCE, 0x43, 0xE1, 0x1D, 0xE8, 0x30, 0x0B, 0x9D, 0xA6, 0x57, 0x5B, 0x81,
-    0xF2, 0xE1, 0xBD, 0x02, 0x4A, 0xF6, 0x65, 0xBF, 0x2F, 0xA1, 0x27, 0xA4, 0x32, 0x6D, 0xB0, 0x20,
-    0xB7, 0xB2, 0xBA, 0x82, 0xFA, 0x9A, 0xB0, 0xA3, 0x3C, 0x0B, 0x4B, 0xAF, 0x71, 0x3A, 0x4A, 0xB7,
-    0x2F, 0x72, 0xD4, 0xA2, 0x09, 0x70, 0x29, 0x48, 0x00, 0x6C, 0x25, 0x7A, 0x9D, 0x43, 0xDF, 0xE5,
-    0x7D, 0xB4, 0x65, 0xA8, 0xD6, 0xA6, 0xCD, 0x4C, 0xB0, 0x64, 0x93, 0xCC, 0xFF, 0x7D, 0xDF, 0x3B,
-    0xDF, 0x70, 0x74, 0xEE, 0x0B, 0x33, 0xD9, 0x87, 0x85, 0x8B, 0x4C, 0xDF, 0xE0, 0x7D, 0xE0, 0x69,
-    0xFA, 0xCD, 0x53, 0xC4, 0xB3, 0xDC, 0xEF, 0x72, 0x1D, 0x7A, 0x03, 0x4E, 0xAA, 0xED, 0xAE, 0x48,
-    0x8C, 0xFC, 0xFF, 0x79, 0xD5, 0x6F, 0xFC, 0x06, 0x82, 0x4E, 0x3A, 0x84, 0xEF, 0xF2, 0x81, 0xCE,
-    0xAB, 0x7D, 0x83, 0x34, 0x8C, 0x16, 0x2F, 0x46, 0x07, 0xC9, 0xE8, 0x0C, 0xED, 0x6D, 0x9E, 0xA5,
-    0xFB, 0xF9, 0xB8, 0x91, 0x3E, 0xD0, 0x91, 0xAA, 0x60, 0x4A, 0x36, 0x13, 0xC1, 0x3B, 0xB8, 0x59,
-    0x82, 0x26, 0x06, 0xEC, 0x26, 0xFB, 0x44, 0x1F, 0xA3, 0x03, 0xE8, 0x3D, 0xFF, 0x04, 0xA1, 0x00,
-    0xC0, 0xDC, 0xC1, 0x57, 0x45, 0x6C, 0x59, 0x41, 0x80, 0x35, 0x28, 0x59, 0x85, 0x0C, 0xC4, 0xF7,
-    0x0C, 0xC0, 0x1C, 0x5C, 0xB3, 0x41, 0xFD, 0xFB, 0xEC, 0xA8, 0x8B, 0x2A, 0xAD, 0x5C, 0xB2, 0xC7,
-    0x33, 0x4E, 0xF2, 0x52, 0x0A, 0xE4, 0x1D, 0x10, 0x1C, 0xA5, 0xF7, 0x81, 0xD6, 0xAB, 0xBD, 0xFF,
-    0x26, 0x27, 0xF4, 0xF0, 0xD6, 0x48, 0x4E, 0x77, 0x2C, 0xA7, 0xE4, 0x68, 0x55, 0x58, 0x7F, 0x94,
-    0x1E, 0x54, 0x76, 0xAD, 0x9E, 0x7E, 0x50, 0x92, 0xD4, 0x93, 0x93, 0x5E, 0x12, 0x39, 0xB9, 0x99,
-    0x21, 0xA5, 0x17, 0x1F, 0x8C, 0xE4, 0xEE, 0x09, 0x24, 0x8E, 0x37, 0x49, 0xAA, 0x9E, 0x45, 0xE9,
-    0x85, 0x7B, 0x4F, 0x95, 0xE4, 0x87, 0x2E, 0x46, 0xBA, 0xB7, 0xF8, 0x3C, 0xEF, 0x6F, 0x9D, 0x6D,
-    0x1A, 0x77, 0x91, 0x2C, 0xC3, 0x32, 0xBD, 0xCC, 0x92, 0x63, 0x84, 0xB7, 0xC5, 0x04, 0xB2, 0x3E,
-    0x82, 0xE2, 0xB5, 0xA2, 0x2E, 0xD2, 0x94, 0x4C, 0x3C, 0x30, 0x39, 0xE0, 0x44, 0x27, 0x7E, 0x0A,
-    0xC9, 0xFA, 0xFD, 0x71, 0x9C, 0x65, 0x7C, 0x65, 0x7B, 0x5C, 0x8A, 0x45, 0x97, 0x37, 0xED, 0x56,
-    0x81, 0x09, 0xEB, 0xB0, 0x88, 0x2A, 0x80, 0xDB, 0x3A, 0x5A, 0x9B, 0xE0, 0xFA, 0x75, 0x13, 0x5F,
-    0x03, 0x9B, 0x2A, 0x3E, 0xCB, 0xD4, 0x79, 0xAD, 0x54, 0x7E, 0x4C, 0xB7, 0x24, 0xA3, 0x49, 0x89,
-    0x27, 0x06, 0x09, 0x92, 0xFE, 0xDF, 0x21, 0x76, 0x2B, 0x40, 0x76, 0x3B, 0xC5, 0x19, 0xEE, 0xD4,
-    0xF4, 0x15, 0xBE, 0x26, 0x32, 0x52, 0x9F, 0x92, 0x6C, 0x5C, 0x07, 0x95, 0xC8, 0x0A, 0xA0, 0x63,
-    0xBA, 0x6B, 0x00, 0x09, 0x99, 0xF2, 0xAB, 0x2C, 0xFA, 0xC7, 0xE2, 0xBE, 0x64, 0x08, 0x3F, 0x1C,
-    0x11, 0x8A, 0x46, 0xBB, 0x82, 0xE2, 0x56, 0xE2, 0x0E, 0xDB, 0xFB, 0x62, 0x0F, 0x4A, 0x5D, 0xCC,
-    0x6E, 0x46, 0x05, 0xE1, 0x2A, 0x42, 0xED, 0x08, 0x58, 0x3D, 0xE7, 0xEA, 0x87, 0x47, 0x3D, 0xF6,
-    0x0B, 0x0A, 0x2F, 0xA2, 0x52, 0xAF, 0x44, 0xCD, 0x13, 0xDB, 0x72, 0x23, 0xB3, 0xE8, 0xBC, 0xCA,
-    0x2B, 0xCF, 0x78, 0xDF, 0x20, 0x76, 0x0F, 0xF5, 0x3A, 0xA8, 0x5C, 0x3E, 0x65, 0xA4, 0xEB, 0xA9,
-    0x3D, 0x5E, 0x32, 0xA3, 0x4D, 0x32, 0x81, 0xA6, 0x99, 0x51, 0xBF, 0x24, 0x1B, 0xDB, 0x12, 0x6C,
-    0x94, 0x6D, 0x53, 0x4F, 0x39, 0x40, 0x76, 0x7A, 0x9B, 0x33, 0x4E, 0x22, 0x09, 0x57, 0x74, 0xCC,
-    0x5E, 0x89, 0x36, 0x08, 0x45, 0x15, 0x9A, 0x0F, 0xD7, 0xAC, 0xF6, 0x3B, 0x1D, 0x01, 0x4B, 0x24,
-    0xE8, 0x7E, 0x03, 0x48, 0x0C, 0x28, 0x51, 0x26, 0x5B, 0x91, 0x6E, 0x67, 0x63, 0x81, 0x22, 0x1C,
-    0xAE, 0xDD, 0xBD, 0x98, 0x44, 0xAB, 0xA0, 0x6D, 0x11, 0x06, 0x79, 0x69, 0xF4, 0x5F, 0x31, 0xCA,
-    0x91, 0xEC, 0x5B, 0xF9, 0x47, 0x11, 0xAA, 0xB7, 0x4D, 0xD6, 0x79, 0xC2, 0x2F, 0x19, 0x17, 0xE5,
-    0x8F, 0xD7, 0x44, 0x3A, 0x2C, 0x73, 0x4A, 0xDF, 0x36, 0x4E, 0xEB, 0x63, 0x55, 0xD1, 0x57, 0x79,
-    0x96, 0x73, 0x23, 0x69, 0xD6, 0xBF, 0x99, 0xF4, 0x73, 0xFB, 0x3D, 0x56, 0x24, 0x36, 0xA7, 0x77,
-    0x47, 0x7C, 0x8E, 0x62, 0x31, 0xD1, 0x06, 0xFA, 0x97, 0xCB, 0x60, 0x32, 0xDC, 0x56, 0x17, 0x7A,
-    0xE2, 0xD8, 0xA4, 0x9D, 0xDF, 0xA1, 0xD4, 0x3B, 0x23, 0x18, 0x24, 0x39, 0x35, 0x73, 0x5B, 0xD9,
-    0x61, 0x3B, 0x86, 0xD7, 0xAF, 0xC3, 0x76, 0xAD, 0x6C, 0xDF, 0xB4, 0xFD, 0x36, 0x91, 0x35, 0xA8,
-    0xB8, 0x8C, 0xEC, 0x30, 0x0A, 0x2A, 0xA1, 0xC5, 0xB7, 0xF1, 0x9A, 0x37, 0xA3, 0x56, 0xE4, 0x3F,
-    0xBD, 0x5A, 0x31, 0x8C, 0xDD, 0x56, 0x76, 0xBD, 0x24, 0x35, 0x43, 0x5B, 0x2C, 0xA8, 0x00, 0x33,
-    0xB0, 0x77, 0x15, 0x2F, 0x53, 0xA4, 0x30, 0x10, 0x67, 0xB9, 0xC5, 0x16, 0x2E, 0x64, 0x91, 0x96,
-    0x02, 0xB8, 0x70, 0xA1, 0x09, 0xA0, 0x9F, 0x05, 0xB2, 0x85, 0x5D, 0x6C, 0x93, 0x2C, 0xD6, 0x93,
-    0x72, 0x0B, 0xC9, 0xA4, 0xAD, 0xC2, 0xC5, 0x16, 0x9A, 0x6A, 0x8B, 0xA4, 0xD9, 0xC2, 0x01, 0x12,
-    0x39, 0x80, 0x54, 0xB8, 0xF0, 0x02, 0x92, 0x49, 0x69, 0x02, 0xA8, 0x50, 0xB1, 0x94, 0x85, 0x24,
-    0x85, 0x03, 0x88, 0xB6, 0x95, 0xCD, 0xAE, 0x54, 0x98, 0xA3, 0x50, 0x30, 0x25, 0x93, 0xBC, 0x39,
-    0xE7, 0x3D, 0xFE, 0x3F, 0x1A, 0xD9, 0x92, 0x2D, 0x69, 0xE4, 0x99, 0x21, 0xE7, 0xFF, 0x47, 0xF2,
-    0xBD, 0x7B, 0xEF, 0xBB, 0xEF, 0xDC, 0x73, 0xEF, 0xA3, 0x2C, 0xCD, 0x52, 0x91, 0x58, 0x2B, 0x91,
-    0x44, 0x4B, 0xB9, 0xFB, 0xE7, 0xFB, 0x3C, 0x29, 0x0E, 0x47, 0x71, 0x8B, 0xC7, 0xAB, 0xE6, 0x14,
-    0x5C, 0xC5, 0xCD, 0xE1, 0xC9, 0x06, 0x8F, 0x1D, 0xC1, 0x29, 0xF1, 0x3B, 0x91, 0x37, 0xBD, 0x5E,
-    0x64, 0xF8, 0xC9, 0x80, 0x07, 0x74, 0x14, 0x57, 0x55, 0xC5, 0x6B, 0x44, 0x53, 0xBF, 0x96, 0xAC,
-    0x0C, 0x2B, 0x49, 0xAA, 0xA2, 0x77, 0xB5, 0xD7, 0xC1, 0xD3, 0x3E, 0xD4, 0xC6, 0xC1, 0xF5, 0xA5,
-    0xD9, 0x9A, 0x19, 0x66, 0x55, 0x24, 0x1B, 0x21, 0x41, 0xEB, 0xB7, 0x59, 0x99, 0xA1, 0x9F, 0xB5,
-    0xA4, 0x94, 0x67, 0x7A, 0x29, 0xB4, 0x4C, 0xBE, 0xEC, 0x83, 0x26, 0x29, 0xD5, 0xEB, 0xC3, 0x5B,
-    0x45, 0x55, 0xA8, 0x5E, 0xD0, 0x93, 0xAD, 0x93, 0xAE, 0x88, 0x3C, 0x25, 0x10, 0xE9, 0xA0, 0x53,
-    0x51, 0x74, 0x88, 0x14, 0x52, 0x42, 0xE7, 0xDD, 0x27, 0x2E, 0x3A, 0xBB, 0x6D, 0x7C, 0x89, 0xFE,
-    0xB3, 0x96, 0xA2, 0x17, 0xE7, 0xB7, 0xF2, 0xE8, 0x1A, 0x3C, 0x49, 0x19, 0x63, 0x74, 0x28, 0x67,
-    0xD9, 0xBF, 0x91, 0x58, 0x37, 0x70, 0x2A, 0xD0, 0xAB, 0x2C, 0x3D, 0x8A, 0xB0, 0xC7, 0x20, 0x4E,
-    0x2A, 0x4E, 0x2B, 0x12, 0xFD, 0x01, 0xFD, 0x40, 0x44, 0x3B, 0x71, 0xF2, 0xBC, 0x88, 0xDF, 0x98,
-    0x96, 0x00, 0x32, 0x7E, 0xCF, 0x36, 0x3A, 0xC5, 0x06, 0xFA, 0x6A, 0x42, 0xD5, 0x52, 0xD3, 0x24,
-    0x68, 0xA5, 0x4F, 0x4A, 0xF7, 0x13, 0x48, 0x8E, 0x8F, 0x82, 0xA1, 0xA8, 0xB2, 0x87, 0xAF, 0x21,
-    0x1E, 0x89, 0xF1, 0x74, 0x06, 0xB9, 0xB4, 0x96, 0xBF, 0x86, 0x4E, 0x2F, 0xAB, 0x52, 0x8E, 0x5C,
-    0x96, 0x28, 0x7F, 0x6E, 0x54, 0xC8, 0xF0, 0x50, 0xCA, 0xF1, 0xDD, 0x74, 0x6E, 0x6B, 0x58, 0x5E,
-    0x35, 0xD7, 0x23, 0x4D, 0xF6, 0x32, 0xFA, 0x7E, 0x31, 0x6C, 0x84, 0xD6, 0x41, 0xB7, 0x49, 0x25,
-    0x01, 0x66, 0x45, 0xAF, 0x9F, 0x89, 0xB5, 0x77, 0x74, 0x10, 0x67, 0x12, 0x14, 0x16, 0xA2, 0xFE,
-    0xB4, 0xEC, 0xB9, 0xB0, 0x74, 0xAA, 0xA7, 0x77, 0x57, 0x52, 0x63, 0x06, 0x0F, 0xF3, 0xF2, 0x45,
-    0xE5, 0xB4, 0x67, 0xE5, 0xFD, 0xE0, 0xD1, 0x24, 0x75, 0x30, 0x4D, 0x11, 0x25, 0xCD, 0xC5, 0xC1,
-    0xB0, 0x8E, 0xED, 0x5A, 0xD6, 0xAF, 0x61, 0xB6, 0x7A, 0x4F, 0xB5, 0x49, 0xAA, 0xF0, 0xC2, 0x20,
-    0x09, 0xBA, 0xF9, 0x20, 0x83, 0x41, 0x28, 0x5A, 0x33, 0x49, 0x9A, 0x72, 0x7C, 0xF6, 0x29, 0x11,
-    0x85, 0xEF, 0x64, 0x25, 0x53, 0xAD, 0x70, 0xE0, 0xD9, 0xDA, 0xF4, 0x8E, 0xA9, 0x0F, 0xEC, 0xF8,
-    0x85, 0xF9, 0xC2, 0x9F, 0xA3, 0x70, 0xA5, 0xC6, 0xD3, 0xD1, 0x1B, 0x92, 0xF3, 0x83, 0xDF, 0xA8,
-    0xD4, 0xE8, 0x6C, 0x2E, 0x65, 0x4A, 0xA5, 0x7D, 0x3D, 0x55, 0xC2, 0x46, 0xBE, 0xB6, 0x73, 0x55,
-    0xBD, 0x32, 0x92, 0xF0, 0x42, 0x2B, 0xD1, 0xE7, 0xA9, 0x44, 0xB0, 0x4C, 0x98, 0xEF, 0xAA, 0x31,
-    0xB1, 0x34, 0xDA, 0x58, 0x92, 0x28, 0xF5, 0xD0, 0x80, 0xE7, 0xDC, 0xFC, 0xD1, 0xA7, 0xDD, 0x85,
-    0xA8, 0x12, 0x9C, 0xA7, 0x90, 0x9F, 0xA3, 0x9B, 0x90, 0x8B, 0x21, 0x9C, 0x30, 0xCE, 0xF9, 0xDB,
-    0x53, 0x29, 0x10, 0x0F, 0x7A, 0x15, 0x1C, 0x3E, 0x29, 0xD7, 0xD1, 0x3D, 0x8C, 0x87, 0x3E, 0xE3,
-    0x06, 0x7D, 0x27, 0x25, 0x06, 0xD7, 0x14, 0xEB, 0x6C, 0x40, 0x53, 0xD8, 0x2E, 0x9A, 0xF0, 0xEB,
-    0x77, 0x1E, 0x9F, 0x08, 0x1B, 0x77, 0x94, 0xE4, 0xF7, 0x45, 0x1D, 0x28, 0x06, 0x4D, 0x74, 0x4C,
-    0x17, 0xF8, 0x93, 0xA6, 0xB2, 0x7F, 0x88, 0xB1, 0x9E, 0x3F, 0x82, 0x09, 0x87, 0x83, 0x50, 0xF9,
-    0x0A, 0x54, 0x19, 0x5E, 0x94, 0xA5, 0xF5, 0xCB, 0x12, 0xE0, 0x6E, 0x4C, 0x67, 0x25, 0x7A, 0x68,
-    0xC0, 0x84, 0xC7, 0x95, 0xD7, 0x63, 0x2E, 0x93, 0xF2, 0x2B, 0x1F, 0xEA, 0xB8, 0x72, 0xF5, 0xF4,
-    0x00, 0x74, 0x63, 0xFF, 0x1D, 0x9E, 0x58, 0x71, 0x30, 0x77, 0x7F, 0xFF, 0xAF, 0x84, 0x01, 0xAD,
-    0x08, 0x03, 0x00, 0x01, 0xA7, 0x68, 0x20, 0x4E, 0x56, 0x41, 0xC2, 0x62, 0x2E, 0xA1, 0x37, 0xFC,
-    0x7C, 0x7C, 0x37, 0xBC, 0xA5, 0x5A, 0x27, 0x15, 0xCC, 0x63, 0x9A, 0x7A, 0xDC, 0x15, 0xD5, 0xB8,
-    0x4B, 0x31, 0x04, 0x16, 0xAC, 0xFE, 0xA3, 0xE6, 0x31, 0x0D, 0xA0, 0x7A, 0x7B, 0x1B, 0xF4, 0xB1,
-    0xD0, 0xB1, 0x52, 0x3C, 0xC6, 0x83, 0xF5, 0x4A, 0x96, 0x8B, 0x3F, 0x62, 0x74, 0x78, 0x56, 0x5C,
-    0xC9, 0x5F, 0x14, 0x1C, 0xB1, 0x82, 0xB2, 0x55, 0x04, 0xC9, 0x62, 0x88, 0x99, 0xDC, 0x7B, 0xB0,
-    0xFD, 0x8E, 0x56, 0x14, 0xD8, 0xD3, 0x93, 0x83, 0x91, 0x77, 0x36, 0xA3, 0xB8, 0xF6, 0x98, 0x7E,
-    0x56, 0x67, 0xB3, 0xA3, 0xB0, 0x7D, 0x8F, 0xE1, 0x7B, 0x6F, 0x70, 0x28, 0xD9, 0x31, 0x1C, 0x3F,
-    0xE6, 0x84, 0x9A, 0x03, 0x5E, 0x64, 0x8E, 0xF1, 0x54, 0x3A, 0xB5, 0xED, 0xC3, 0x71, 0x00, 0xC7,
-    0x59, 0xB4, 0x99, 0xE7, 0xF0, 0x7C, 0xE7, 0xC2, 0x2E, 0xAA, 0xE9, 0xEA, 0xCC, 0x58, 0x1E, 0xEE,
-    0x13, 0x63, 0x42, 0xB0, 0x4E, 0xDE, 0x1E, 0xA2, 0x32, 0x39, 0x59, 0x87, 0x9F, 0xE1, 0x1E, 0x00,
-    0x66, 0x92, 0x1B, 0xA7, 0x86, 0xF7, 0x65, 0x7F, 0xFC, 0x05, 0x64, 0x4B, 0x0B, 0x38, 0xF7, 0x51,
-    0x91, 0x7D, 0x90, 0xAE, 0x0D, 0x52, 0x23, 0x59, 0x82, 0xAB, 0xCB, 0x1B, 0xBB, 0x2A, 0x1D, 0xFB,
-    0x7A, 0xDF, 0x4B, 0x93, 0x7F, 0x2A, 0x7D, 0x98, 0x33, 0xCE, 0x17, 0x4B, 0xAE, 0xC6, 0xD3, 0x5E,
-    0x17, 0x5F, 0xEE, 0xBD, 0x6E, 0x94, 0x11, 0xB7, 0x9E, 0x54, 0xFD, 0xAC, 0x9B, 0xFB, 0xB2, 0x3F,
-    0xFE, 0xBA, 0xC2, 0xB4, 0x04, 0xD3, 0x92, 0x73, 0x72, 0xB3, 0x70, 0xCD, 0x52, 0xE7, 0xFF, 0x09,
-    0x16, 0x76, 0x4D, 0xC8, 0x1D, 0xB8, 0xE0, 0xC8, 0x23, 0x09, 0xB9, 0x7B, 0x16, 0x0B, 0x19, 0xD6,
-    0x21, 0xC1, 0x9B, 0x38, 0xB2, 0x1A, 0x43, 0x35, 0x66, 0x5E, 0x1F, 0x6E, 0x6A, 0x5F, 0x4B, 0x25,
-    0xC8, 0xC5, 0xC3, 0xE3, 0x63, 0x2E, 0x51, 0x33, 0x8F, 0x57, 0x75, 0x90, 0x3A, 0x5D, 0x22, 0xF2,
-    0xE1, 0x59, 0x0B, 0x41, 0x7E, 0xB5, 0xBB, 0x96, 0xB4, 0xD0, 0x15, 0x6F, 0x43, 0xD7, 0xC6, 0x02,
-    0xBA, 0xB0, 0xDA, 0xB4, 0x1C, 0x83, 0x36, 0x83, 0x25, 0xF3, 0x84, 0x96, 0xC4, 0x03, 0xA3, 0x01,
-    0xC6, 0xB0, 0x05, 0x74, 0xFD, 0xF3, 0xFB, 0x89, 0x0E, 0xEE, 0x5D, 0xD0, 0x25, 0x89, 0x58, 0xE5,
-    0x13, 0x06, 0x40, 0xA8, 0xB2, 0x57, 0xFE, 0x6C, 0xA2, 0x36, 0x80, 0x99, 0x42, 0x89, 0x85, 0x40,
-    0xA7, 0x2A, 0xAC, 0x8A, 0xDC, 0x6D, 0xD1, 0xCD, 0xB1, 0xA8, 0xB6, 0x58, 0x4B, 0x11, 0x85, 0xEC,
-    0x0A, 0x00, 0xA5, 0x57, 0x5B, 0x47, 0x6F, 0x8E, 0x68, 0x03, 0xDC, 0x6A, 0x08, 0x10, 0x39, 0xAF,
-    0x77, 0x8A, 0x26, 0xB2, 0x80, 0x7B, 0x0D, 0x6B, 0x73, 0x1A, 0x2D, 0xA3, 0x9A, 0xB0, 0xCA, 0x9B,
-    0x08, 0xF3, 0xC7, 0x24, 0x48, 0xCF, 0x58, 0x8C, 0x5C, 0x5B, 0x01, 0x51, 0xEB, 0x71, 0x7B, 0x3D,
-    0xFA, 0x5B, 0x5E, 0x1B, 0x56, 0x61, 0x09, 0xF1, 0xD3, 0x41, 0x8A, 0xD3, 0x0D, 0x57, 0x8D, 0x7F,
-    0x7D, 0xC3, 0x08, 0x3A, 0xCC, 0xD6, 0x3C, 0xE3, 0x0D, 0xDA, 0x14, 0xA7, 0x8A, 0x8B, 0xC0, 0xD4,
-    0xA8, 0xF2, 0xBB, 0xE4, 0x8E, 0x22, 0x76, 0x74, 0x12, 0x13, 0x5E, 0xF6, 0x08, 0xA3, 0xF8, 0xFB,
-    0x62, 0x08, 0x0A, 0x17, 0xDB, 0x82, 0xAD, 0xFD, 0xFC, 0x36, 0x09, 0x0D, 0xC2, 0x10, 0x31, 0x23,
-    0x4D, 0x0E, 0x8D, 0x12, 0x54, 0x2A, 0x4E, 0x93, 0xE5, 0x06, 0x76, 0x8C, 0xE3, 0x43, 0xA9, 0xD5,
-    0xA3, 0xC0, 0x2D, 0xCD, 0x2A, 0x5F, 0x2F, 0x75, 0x12, 0x6E, 0x29, 0xE6, 0x22, 0x01, 0x76, 0xF9,
-    0x7A, 0x5D, 0x4B, 0xC4, 0xB9, 0x06, 0x7D, 0x6C, 0x88, 0x73, 0x74, 0x0A, 0xF8, 0xE9, 0x8F, 0x04,
-    0xEB, 0x4E, 0x32, 0x0C, 0x34, 0x2D, 0x3C, 0x39, 0xBA, 0x24, 0xB8, 0xCF, 0x87, 0xE1, 0x93, 0xB7,
-    0xFA, 0x74, 0xF0, 0x5A, 0xAF, 0x09, 0xEB, 0xB0, 0x4A, 0xD2, 0xF8, 0x46, 0x4F, 0xEE, 0xEB, 0xDC,
-    0x79, 0xD7, 0x44, 0x87, 0x64, 0x76, 0x14, 0xBA, 0x61, 0x36, 0xE0, 0x12, 0xD7, 0x4F, 0x6F, 0x0D,
-    0x12, 0x5F, 0x6C, 0x9D, 0x31, 0x1C, 0x8B, 0x26, 0x06, 0x12, 0x06, 0x06, 0xE5, 0x5F, 0x17, 0xB3,
-    0x5C, 0x4C, 0x60, 0xE3, 0xA2, 0x9C, 0x33, 0xA2, 0xDD, 0x57, 0x66, 0xC9, 0x8E, 0xC4, 0x59, 0xE5,
-    0x40, 0x53, 0xE0, 0xDE, 0x4D, 0x65, 0x96, 0x11, 0xB9, 0xE1, 0xC3, 0x0C, 0x86, 0x55, 0xD2, 0x7A,
-    0x6D, 0x5C, 0x83, 0x24, 0x35, 0x12, 0x91, 0x77, 0x92, 0x63, 0x18, 0x8E, 0x9A, 0x94, 0xCE, 0xEC,
-    0x08, 0xD4, 0xFA, 0x62, 0x90, 0xAC, 0x07, 0x41, 0x51, 0xD0, 0x8C, 0x64, 0x53, 0xD3, 0xB0, 0xC9,
-    0xC6, 0xD3, 0xBD, 0xAF, 0x86, 0x68, 0x60, 0x9E, 0x57, 0x89, 0x58, 0xBF, 0xC1, 0x03, 0xA3, 0x58,
-    0xCB, 0x07, 0x50, 0x1A, 0x2C, 0xD5, 0x5A, 0x88, 0xF0, 0x82, 0x90, 0x2C, 0x70, 0xD3, 0xA0, 0xB4,
-    0x3E, 0x0E, 0xBD, 0xDC, 0xCE, 0x5E, 0x59, 0x4A, 0xD7, 0xD0, 0x51, 0x03, 0xBD, 0x4E, 0x74, 0xD1,
-    0xBF, 0x53, 0x99, 0x04, 0xDD, 0x40, 0x37, 0x77, 0x2C, 0x4A, 0xFA, 0x4D, 0x84, 0x90, 0xCD, 0x05,
-    0x78, 0x6B, 0x96, 0x62, 0xA9, 0x57, 0x10, 0xFA, 0xC2, 0x78, 0x4A, 0xA3, 0xCA, 0xED, 0xB3, 0x34,
-    0xAA, 0xF5, 0x86, 0x42, 0x4D, 0x10, 0xF3, 0x6B, 0xF3, 0x30, 0x13, 0x70, 0x5C, 0x9F, 0x92, 0xF8,
-    0x37, 0x6A, 0x8A, 0x81, 0x85, 0xEF, 0xD4, 0x7B, 0xA7, 0xAB, 0xB3, 0x99, 0xC3, 0x85, 0x0F, 0x18,
-    0xFB, 0x95, 0xD6, 0xB1, 0xE6, 0x98, 0xCB, 0x02, 0xFA, 0x08, 0xA3, 0x2F, 0x57, 0x92, 0x8A, 0x09,
-    0xC6, 0x6C, 0x64, 0xB4, 0xC5, 0x94, 0x32, 0x56, 0x9E, 0x7A, 0x6F, 0xDE, 0x78, 0xEF, 0x9D, 0x58,
-    0x61, 0x79, 0xA1, 0x87, 0x80, 0x49, 0xEC, 0xD3, 0x3A, 0x1D, 0xE9, 0x9C, 0x47, 0x7A, 0x3F, 0x40,
-    0xEE, 0x18, 0xCB, 0xD8, 0xC9, 0x9F, 0x32, 0x8B, 0xC1, 0x44, 0x59, 0xB3, 0x0E, 0x0C, 0x13, 0x32,
-    0x76, 0xA6, 0x7F, 0xB8, 0x3D, 0xA1, 0xEE, 0x63, 0xA5, 0x17, 0x81, 0x89, 0x8C, 0x5A, 0xBA, 0x23,
-    0x2E, 0xC6, 0x15, 0xB4, 0x1C, 0x9C, 0xFB, 0x7D, 0x08, 0xF4, 0x15, 0x3D, 0x0F, 0x3C, 0xEC, 0x11,
-    0x09, 0x67, 0xB3, 0x50, 0xDB, 0x44, 0x3F, 0xE5, 0x72, 0xAC, 0x8D, 0x90, 0xCF, 0x8C, 0xB3, 0xD7,
-    0x6E, 0xBF, 0xA6, 0x6A, 0x18, 0xE4, 0x42, 0x72, 0xAB, 0x8E, 0x61, 0x16, 0xD7, 0x4F, 0xE9, 0x7D,
-    0x14, 0x6F, 0x49, 0x42, 0x14, 0xA9, 0xC0, 0x49, 0xF6, 0x59, 0xCB, 0x3E, 0x01, 0xAF, 0x99, 0xD2,
-    0x2D, 0x8A, 0xBB, 0x7E, 0x27, 0x67, 0x2A, 0x61, 0x17, 0x43, 0x7C, 0xFE, 0xB7, 0x12, 0x7C, 0x69,
-    0x78, 0x09, 0xE0, 0xE5, 0xB2, 0xA6, 0x20, 0x03, 0x55, 0x80, 0x3C, 0xC3, 0xC8, 0x59, 0xA4, 0x59,
-    0x6A, 0x64, 0x9D, 0x1A, 0x3C, 0xBD, 0xAC, 0x5B, 0x94, 0x79, 0x39, 0x3D, 0x34, 0xBE, 0x90, 0xE8,
-    0x95, 0x8B, 0xFD, 0x9E, 0x25, 0x03, 0xC7, 0x87, 0x75, 0x30, 0xD3, 0x61, 0x48, 0xD6, 0xFD, 0x4E,
-    0x98, 0xFD, 0x2B, 0x3A, 0xEC, 0x75, 0xC2, 0xAD, 0x1B, 0x7A, 0xFB, 0xA3, 0x9E, 0x26, 0xE5, 0x4A,
-    0xA9, 0xB3, 0x0E, 0xA4, 0x2C, 0xCB, 0xA3, 0xDA, 0xEF, 0x9C, 0xED, 0x0F, 0xAE, 0xB6, 0x3A, 0x2C,
-    0xB1, 0xE7, 0x29, 0xC9, 0x35, 0x53, 0xFF, 0x91, 0x76, 0x0F, 0x1C, 0xA3, 0xF4, 0x88, 0xC9, 0x09,
-    0x79, 0xF4, 0x69, 0xFD, 0xC4, 0xA6, 0xAB, 0xC1, 0xE8, 0x83, 0x36, 0xED, 0xEC, 0xDD, 0x7C, 0x88,
-    0xF5, 0x88, 0x56, 0x4F, 0xC9, 0xE1, 0xFA, 0x39, 0x0C, 0xA1, 0xAD, 0x81, 0xB7, 0x87, 0xD2, 0x45,
-    0xE4, 0x07, 0xF2, 0xDE, 0xAD, 0x56, 0xBB, 0xE5, 0x6B, 0xDF, 0xAC, 0xCB, 0x43, 0xF5, 0xEC, 0xD6,
-    0x58, 0x36, 0x40, 0x03, 0xDD, 0x08, 0x06, 0x22, 0x48, 0x2A, 0x59, 0x0A, 0xC6, 0x5C, 0xE4, 0x8E,
-    0x8D, 0x50, 0xAE, 0xE6, 0x59, 0x87, 0xAF, 0x58, 0xF1, 0xD9, 0xBD, 0xA7, 0x58, 0x0F, 0x63, 0x7E,
-    0x0F, 0x82, 0xE6, 0x23, 0x01, 0x44, 0xFE, 0x87, 0x64, 0x6F, 0x4D, 0x7E, 0x26, 0x31, 0x6C, 0x83,
-    0x93, 0x59, 0xD5, 0x0F, 0xA9, 0xE5, 0x83, 0x2D, 0xB8, 0x3A, 0x7B, 0x79, 0x36, 0x83, 0x37, 0xA8,
-    0xC6, 0xFA, 0xB6, 0xDE, 0x26, 0x1D, 0xAF, 0x1F, 0xED, 0x54, 0x51, 0x42, 0x0C, 0x0A, 0x27, 0xC4,
-    0x14, 0xC6, 0xE5, 0x04, 0xD7, 0x4C, 0xAF, 0x4C, 0xB0, 0x93, 0xC8, 0xE4, 0x03, 0xF5, 0x82, 0xF8,
-    0xEE, 0x83, 0x63, 0xF6, 0x01, 0x38, 0x40, 0x00, 0xB7, 0x80, 0x69, 0xE6, 0x01, 0x6A, 0x4F, 0xDC,
-    0x45, 0x7D, 0xD6, 0x25, 0x7D, 0xD0, 0xF9, 0x3D, 0xB9, 0xFF, 0x83, 0x0E, 0xD8, 0x0B, 0x6C, 0xE0,
-    0xF0, 0x9C, 0x3B, 0x74, 0x16, 0xF2, 0x41, 0x65, 0x1C, 0x42, 0x82, 0x2D, 0x18, 0x44, 0x25, 0x43,
-    0xFB, 0xD0, 0x7B, 0xCD, 0x9B, 0x6E, 0xFE, 0xAC, 0xF5, 0x46, 0x9F, 0x01, 0xA3, 0xA3, 0x84, 0xDF,
-    0xF6, 0x2F, 0xA7, 0x26, 0x4A, 0x7C, 0x43, 0xBA, 0x17, 0x55, 0x73, 0xD0, 0xEB, 0x99, 0xE7, 0x1C,
-    0xEF, 0xBC, 0xCB, 0xCD, 0x0F, 0x5C, 0xE3, 0xEA, 0xA9, 0x0F, 0x6C, 0xEF, 0xC9, 0x83, 0x60, 0x83,
-    0x02, 0x08, 0xC3, 0x40, 0x72, 0xEF, 0x47, 0xE6, 0x38, 0x35, 0xF2, 0x9D, 0xA8, 0x73, 0x00, 0x39,
-    0xD7, 0x38, 0xA9, 0xE9, 0x6C, 0x4D, 0x35, 0xC4, 0x22, 0x69, 0x41, 0x1C, 0x14, 0x33, 0x44, 0x05,
-    0xA1, 0x0D, 0x42, 0x59, 0xB2, 0x89, 0x25, 0xAF, 0xC8, 0x41, 0x3D, 0xC3, 0xD9, 0x08, 0x00, 0xC9,
-    0x55, 0xA8, 0xA9, 0x31, 0x99, 0x24, 0x74, 0x0B, 0x9B, 0x84, 0xF9, 0x52, 0xC6, 0x1A, 0x45, 0xD6,
-    0xC6, 0x08, 0x6A, 0x20, 0x6B, 0x06, 0xE9, 0x64, 0x45, 0x64, 0x6F, 0x6A, 0x29, 0x07, 0x60, 0x91,
-    0x09, 0x25, 0xE3, 0x67, 0x2C, 0x53, 0x88, 0x00, 0xC2, 0xAC, 0xB3, 0x27, 0x1C, 0xD1, 0xC4, 0x78,
-    0xB7, 0x0F, 0xED, 0x82, 0x26, 0x6B, 0x83, 0x26, 0xC9, 0x83, 0x06, 0xD1, 0xEB, 0x66, 0x87, 0x5C,
-    0xAA, 0x01, 0xE6, 0xE0, 0xFF, 0xCD, 0x81, 0xD7, 0x71, 0x64, 0x65, 0xD0, 0xC4, 0x4D, 0x3C, 0x84,
-    0x7D, 0x36, 0x92, 0x17, 0xA2, 0x57, 0xBA, 0xB9, 0xD7, 0xDA, 0x40, 0xE3, 0x4E, 0xC4, 0x6F, 0x62,
-    0xBA, 0xC1, 0x18, 0x23, 0x8A, 0xBE, 0x43, 0x87, 0x2C, 0x90, 0xD7, 0x65, 0xE2, 0x8C, 0x10, 0x2C,
-    0x03, 0xBE, 0x45, 0xE8, 0xD9, 0xBF, 0x35, 0x22, 0x15, 0x07, 0x68, 0x66, 0x98, 0xD0, 0xA8, 0x2A,
-    0xCA, 0x78, 0x0C, 0x87, 0x10, 0xAC, 0x26, 0x5F, 0x74, 0xE0, 0x13, 0x09, 0x99, 0xDE, 0x96, 0x26,
-    0x03, 0x9F, 0xAA, 0x14, 0x34, 0x1F, 0x02, 0x2A, 0x58, 0x3F, 0x66, 0x7D, 0x41, 0x24, 0x1F, 0x7C,
-    0x90, 0x50, 0x1E, 0xC7, 0x71, 0x6E, 0x07, 0xA9, 0xDC, 0x23, 0x11, 0x64, 0xCB, 0x9A, 0x1F, 0xB2,
-    0x63, 0x07, 0x51, 0x43, 0x5B, 0x9F, 0x60, 0x4A, 0x64, 0x75, 0xEF, 0xF7, 0x21, 0xC3, 0xE2, 0x29,
-    0x77, 0x4D, 0x04, 0xFE, 0x2C, 0xE7, 0x76, 0xA9, 0x30, 0xA4, 0x32, 0xA4, 0x47, 0xB9, 0xE5, 0x22,
-    0xFB, 0xF6, 0xC3, 0x1E, 0x69, 0xF6, 0x20, 0x61, 0xF8, 0xC1, 0xD7, 0x9B, 0xA6, 0x30, 0xF5, 0x2E,
-    0xA6, 0x3D, 0xAC, 0xBC, 0x06, 0x58, 0x32, 0x67, 0x4C, 0x6E, 0x0D, 0xFC, 0x68, 0xB0, 0xE2, 0xB1,
-    0xFE, 0x4F, 0x00, 0x28, 0x3C, 0xF8, 0x99, 0xF3, 0x68, 0x82, 0xEE, 0xFB, 0x93, 0xE2, 0x23, 0xD5,
-    0x57, 0x2F, 0x0E, 0x07, 0x83, 0xB6, 0x41, 0xC6, 0x5D, 0xFC, 0x15, 0x44, 0x40, 0x40, 0x8B, 0x19,
-    0xF5, 0xBE, 0xE6, 0xA3, 0xAF, 0xCD, 0x03, 0xED, 0xE4, 0xB4, 0x4C, 0x9A, 0xED, 0xAF, 0xDB, 0x7E,
-    0xF3, 0xF0, 0xB2, 0x0C, 0xBF, 0xD1, 0xD6, 0x14, 0xF4, 0x48, 0xC5, 0x8B, 0x9D, 0xFF, 0x0E, 0x75,
-    0x01, 0x98, 0x7A, 0x71, 0xB8, 0x0F, 0xDA, 0xBD, 0xF7, 0x5E, 0x03, 0x24, 0xAB, 0x71, 0x66, 0x56,
-    0x45, 0x3D, 0xC2, 0x64, 0x31, 0x2E, 0xB8, 0xBC, 0x05, 0xAE, 0xB0, 0x39, 0x63, 0xD9, 0xB3, 0x89,
-    0xB7, 0x15, 0x4B, 0x37, 0x22, 0x5F, 0xD8, 0x3B, 0x42, 0xDC, 0xE1, 0x57, 0x61, 0x03, 0x29, 0x21,
-    0x11, 0x78, 0xB8, 0x32, 0xBE, 0xE7, 0xB2, 0x07, 0x0E, 0x03, 0x92, 0x91, 0x55, 0x86, 0x43, 0xF0,
-    0xF4, 0xDF, 0x2E, 0xB0, 0xD0, 0x4C, 0x0D, 0x2E, 0x38, 0xEB, 0xDB, 0x17, 0xAA, 0x48, 0x2F, 0xD8,
-    0x02, 0x27, 0x7F, 0x4C, 0x02, 0x30, 0xCE, 0x8B, 0x93, 0xE6, 0x24, 0x7F, 0x3E, 0xBF, 0x08, 0x11,
-    0x67, 0x47, 0x41, 0xAD, 0x0B, 0x0D, 0xB4, 0x8C, 0x40, 0x73, 0x3B, 0x4E, 0x2B, 0xC0, 0x03, 0x2C,
-    0xAD, 0xF1, 0xB1, 0xE6, 0x47, 0x07, 0x78, 0x9F, 0x55, 0x68, 0xBC, 0xD4, 0xA3, 0xB1, 0xD1, 0x8B,
-    0x8D, 0xF4, 0xE1, 0x6D, 0x34, 0xBA, 0x8A, 0xC6, 0x12, 0x11, 0xD2, 0x03, 0x99, 0x44, 0x23, 0xD8,
-    0xA4, 0x79, 0x56, 0x98, 0xD1, 0x80, 0xFA, 0x9A, 0x45, 0x6F, 0x73, 0xDC, 0xE7, 0xC5, 0x16, 0x97,
-    0x0C, 0x83, 0x6C, 0xEC, 0xCA, 0x9D, 0x27, 0x41, 0x4E, 0x7A, 0x54, 0xE2, 0x9B, 0x5A, 0x31, 0x93,
-    0x71, 0x8A, 0x3B, 0x8A, 0xE8, 0xC1, 0x40, 0xE2, 0x31, 0x94, 0x30, 0x98, 0x24, 0x68, 0x08, 0x77,
-    0x36, 0x14, 0x5D, 0x82, 0x50, 0x0E, 0x69, 0x57, 0x8F, 0x62, 0x75, 0xE2, 0x7F, 0x0C, 0x7D, 0x1B,
-    0x64, 0xE6, 0xE1, 0x28, 0x14, 0xBC, 0xA2, 0xE0, 0x3D, 0x05, 0x47, 0x34, 0x94, 0xF0, 0x6A, 0x8B,
-    0xC6, 0x9B, 0x8A, 0xC6, 0x3E, 0xD9, 0x42, 0xA3, 0x37, 0x52, 0xF0, 0xE2, 0x2A, 0x04, 0x0F, 0x8D,
-    0xE0, 0x2C, 0x1A, 0x01, 0x24, 0xCC, 0xB3, 0x50, 0x08, 0x88, 0x1E, 0x69, 0xE9, 0xF7, 0x73, 0x1C,
-    0x33, 0xC1, 0x23, 0x4B, 0xA7, 0xE2, 0xA3, 0x05, 0x39, 0xB7, 0x9D, 0x5F, 0x95, 0xB5, 0x55, 0x09,
-    0xFA, 0xA2, 0x35, 0xC4, 0x79, 0x7D, 0x2C, 0x20, 0xAA, 0xFF, 0x00, 0xD9, 0xD9, 0x00, 0xE8, 0x41,
-    0x7C, 0xBC, 0xA8, 0xD5, 0x62, 0x3D, 0x12, 0xD2, 0x4C, 0xA2, 0x1C, 0xA5, 0xD6, 0x52, 0xCE, 0xA2,
-    0x00, 0xE5, 0xA7, 0x07, 0x38, 0x1C, 0x33, 0xE9, 0xE4, 0x43, 0x99, 0xE2, 0x9D, 0x05, 0xD9, 0xEF,
-    0x6C, 0x02, 0x59, 0x5D, 0x89, 0x40, 0x79, 0xBD, 0x4F, 0x19, 0x00, 0x1B, 0x9B, 0x9D, 0xCA, 0xBF,
-    0x3C, 0xFE, 0x04, 0x86, 0x46, 0xCD, 0x42, 0x16, 0xF5, 0x6D, 0x63, 0x5C, 0x48, 0xB5, 0x84, 0xEC,
-    0xF9, 0x38, 0xCC, 0xDA, 0x78, 0x75, 0x01, 0xB2, 0xBB, 0x97, 0x96, 0x35, 0xF5, 0xD4, 0x82, 0xD5,
-    0x52, 0x87, 0x05, 0xD2, 0x96, 0x59, 0x0D, 0x7C, 0xBD, 0xE6, 0x9A, 0x43, 0x24, 0xFB, 0x4A, 0xB3,
-    0xAB, 0x9F, 0x40, 0xAD, 0x10, 0x39, 0x41, 0x39, 0x39, 0x8A, 0xDC, 0xE3, 0x28, 0xE5, 0x3D, 0x8E,
-    0xD2, 0x6C, 0x3B, 0xCA, 0x65, 0x3A, 0x4A, 0xBF, 0xED, 0x28, 0x5F, 0xEE, 0x74, 0x14, 0xD7, 0x3A,
-    0x4A, 0x4D, 0x47, 0xE9, 0xE6, 0xE1, 0xEF, 0x45, 0x66, 0x41, 0xC4, 0x1E, 0x2C, 0xFF, 0x39, 0x3D,
-    0x81, 0x77, 0x14, 0x97, 0xC0, 0xE9, 0x55, 0x97, 0xF5, 0xC6, 0x48, 0xDF, 0xA0, 0x35, 0x60, 0x84,
-    0xB7, 0x60, 0x0C, 0x1A, 0xE5, 0xAE, 0xAF, 0xF1, 0xE8, 0x81, 0x44, 0x13, 0x9B, 0x59, 0x13, 0xEE,
-    0x4D, 0xD8, 0x74, 0x59, 0xA4, 0x69, 0x4D, 0x25, 0x65, 0x75, 0x26, 0x16, 0x35, 0xB2, 0x29, 0x25,
-    0x99, 0x8A, 0xCA, 0xF0, 0xCF, 0x02, 0x40, 0xC2, 0xA4, 0x2F, 0xEC, 0x7C, 0x05, 0x02, 0x84, 0x1D,
-    0x39, 0xFF, 0xC5, 0x4E, 0xBC, 0x01, 0xF6, 0x4A, 0xAE, 0xB6, 0xF8, 0xA0, 0x8B, 0x0F, 0x08, 0xFA,
-    0x97, 0x7A, 0x16, 0x12, 0x70, 0xCF, 0x61, 0xCE, 0x72, 0x34, 0xFE, 0xB4, 0x67, 0x0E, 0x2A, 0xA6,
-    0x74, 0xCB, 0x4A, 0x82, 0xC3, 0x8C, 0x92, 0x15, 0x25, 0x5B, 0x8E, 0x93, 0xA5, 0x35, 0x08, 0x02,
-    0x4A, 0xC3, 0xB2, 0x4A, 0xD4, 0x46, 0x55, 0x84, 0xF8, 0x9C, 0x6C, 0xC2, 0x20, 0x61, 0x03, 0x92,
-    0x50, 0x86, 0xE6, 0xEB, 0xE8, 0x8C, 0xFE, 0x18, 0x35, 0x80, 0x2C, 0x3C, 0x5B, 0xB3, 0xF4, 0x44,
-    0x0E, 0x90, 0x8A, 0x5F, 0x1E, 0xB0, 0x32, 0xBB, 0x6C, 0x5D, 0x14, 0x0B, 0x96, 0xEF, 0x00, 0x30,
-    0x15, 0xF9, 0x32, 0x13, 0x17, 0xD8, 0xBF, 0x01, 0xA0, 0xEB, 0x09, 0xF0, 0x98, 0x9E, 0xB4, 0xE4,
-    0xE3, 0x9D, 0x32, 0xF3, 0x03, 0xD4, 0xE9, 0xC1, 0x59, 0x93, 0x8B, 0x4C, 0x6D, 0x92, 0xC6, 0x51,
-    0x47, 0xFF, 0xA7, 0x28, 0x99, 0x67, 0x1A, 0x59, 0x29, 0xA4, 0x5D, 0x31, 0xF9, 0xF3, 0x12, 0xFF,
-    0x57, 0x25, 0x09, 0xDC, 0x61, 0xFF, 0xC6, 0xB4, 0x4C, 0xCC, 0xC4, 0xB0, 0xF6, 0x93, 0x5C, 0xD6,
-    0x97, 0x07, 0x67, 0x87, 0xE0, 0x73, 0x3D, 0xE0, 0xB7, 0xD9, 0x27, 0xCA, 0xDA, 0xB7, 0x81, 0x6C,
-    0x53, 0x25, 0x5F, 0x7B, 0xCA, 0xBA, 0xBE, 0xDF, 0xC0, 0x4B, 0x47, 0xD0, 0x83, 0x04, 0x29, 0xB0,
-    0x9B, 0xFE, 0xE8, 0x09, 0x1A, 0x5F, 0x9E, 0x46, 0x5E, 0xFB, 0xD2, 0x41, 0x71, 0xB7, 0x5A, 0x09,
-    0x4F, 0x96, 0x72, 0x0C, 0xE6, 0x2B, 0x2D, 0x56, 0xB0, 0x8E, 0x00, 0xD1, 0x90, 0xC5, 0x8A, 0xBE,
-    0x32, 0xF8, 0xAD, 0xFF, 0x15, 0x1D, 0xF8, 0x35, 0xCF, 0xDE, 0xD2, 0x77, 0x7A, 0xE4, 0x6E, 0x25,
-    0x27, 0x8D, 0x55, 0x2B, 0xA6, 0xC8, 0x40, 0x0A, 0xC4, 0x37, 0x56, 0x5A, 0x79, 0x0E, 0x06, 0x77,
-    0x58, 0xEA, 0xE2, 0x1A, 0x02, 0x23, 0x92, 0xE1, 0xFC, 0x7A, 0x96, 0x33, 0x75, 0x35, 0x21, 0x55,
-    0x4C, 0xD2, 0x5A, 0x2E, 0xCE, 0xE3, 0xA9, 0x54, 0x4D, 0x7B, 0xC1, 0x7B, 0xF6, 0x65, 0xBC, 0xFF,
-    0x40, 0xD2, 0xE0, 0x7C, 0x36, 0x1C, 0x7F, 0x82, 0x30, 0xC5, 0x10, 0x05, 0xCF, 0x5C, 0x57, 0x43,
-    0x32, 0x56, 0x6C, 0x09, 0x17, 0x4B, 0x38, 0xE0, 0x7A, 0x33, 0x17, 0x4B, 0xAC, 0x81, 0xB7, 0x07,
-    0x7A, 0x4E, 0xF8, 0x7F, 0x2C, 0xCF, 0x2B, 0x6B, 0x5A, 0xCA, 0x8F, 0xC8, 0xB2, 0x4B, 0xBB, 0x03,
-    0x40, 0x57, 0xAF, 0x23, 0x06, 0xDD, 0x77, 0xF4, 0xF6, 0x1B, 0x81, 0x8E, 0xA6, 0x32, 0x70, 0xC8,
-    0x54, 0x36, 0x17, 0xD5, 0x34, 0xF9, 0x87, 0x89, 0xEA, 0x9B, 0x48, 0xC6, 0x2D, 0x92, 0x45, 0x34,
-    0x9B, 0x6F, 0x04, 0x54, 0xDC, 0x08, 0xC0, 0xFC, 0x97, 0x45, 0xB9, 0x5D, 0x2F, 0x0F, 0xED, 0x56,
-    0x00, 0x7C, 0x4B, 0xF7, 0xF7, 0xAC, 0x04, 0xE6, 0x30, 0x23, 0x84, 0x4D, 0x7E, 0x47, 0x8E, 0x6A,
-    0x04, 0x88, 0x17, 0x6C, 0x37, 0x81, 0x17, 0x37, 0x49, 0x07, 0x6C, 0x4C, 0x6A, 0x5B, 0xF7, 0x73,
-    0x4C, 0x15, 0x12, 0x9C, 0x09, 0xC9, 0x57, 0xCC, 0x4D, 0x4B, 0x03, 0xFD, 0x2B, 0xF1, 0xD6, 0x50,
-    0x7C, 0x31, 0xEC, 0xD7, 0xDE, 0x1F, 0xF6, 0x00, 0x08, 0xBE, 0xFA, 0x07, 0xAF, 0xCB, 0xB4, 0x9C,
-    0x17, 0xFA, 0x53, 0x1A, 0x1F, 0xC4, 0xC2, 0xDD, 0x29, 0x14, 0x4B, 0xFD, 0x0E, 0x6B, 0x7B, 0xEB,
-    0x8D, 0xAD, 0xD1, 0x33, 0x41, 0xA7, 0x89, 0x48, 0xC1, 0xB9, 0x8D, 0x43, 0xB7, 0x2F, 0xD5, 0x68,
-    0x53, 0x82, 0xE7, 0x68, 0x4D, 0x07, 0xC8, 0x4D, 0x79, 0xD7, 0x6E, 0x3E, 0x32, 0xBE, 0x93, 0x13,
-    0x9B, 0x10, 0x6B, 0x22, 0x89, 0x09, 0x4E, 0xDF, 0x5A, 0x40, 0x31, 0xB5, 0x1E, 0x84, 0x21, 0x74,
-    0x82, 0xD8, 0xC6, 0xF2, 0xC6, 0xDD, 0xF1, 0x27, 0x3E, 0x5C, 0x4F, 0xE1, 0x27, 0x69, 0xEE, 0x8A,
-    0x3E, 0x4F, 0xD0, 0xE0, 0x0E, 0x72, 0xB8, 0xB2, 0x43, 0xC0, 0x41, 0x12, 0x43, 0x4E, 0xF5, 0xFD,
-    0x87, 0x33, 0xB8, 0xB9, 0xFB, 0x05, 0x03, 0xA4, 0x90, 0x09, 0x40, 0x6C, 0xB7, 0x34, 0x9D, 0x0F,
-    0x37, 0x7C, 0x53, 0x6B, 0xDB, 0xEC, 0xBD, 0xAD, 0x41, 0x80, 0x34, 0x7F, 0x09, 0x0F, 0xE2, 0x16,
-    0x09, 0xF2, 0x04, 0x9F, 0x65, 0x1A, 0x8E, 0xD6, 0xFC, 0xC6, 0x1B, 0xCE, 0x4A, 0xB6, 0x9E, 0xC6,
-    0x97, 0xBA, 0xE8, 0x53, 0x53, 0xC7, 0xAA, 0x85, 0x48, 0xF8, 0xB4, 0xC8, 0x71, 0x86, 0xA8, 0x38,
-    0x97, 0xCE, 0x54, 0xF3, 0x59, 0x25, 0xF3, 0xB5, 0x2E, 0x8A, 0xCD, 0x26, 0x7A, 0xAD, 0x3C, 0x80,
-    0xDC, 0x90, 0x58, 0x36, 0x4A, 0x31, 0xEC, 0x8B, 0xEE, 0xD4, 0xE1, 0xE7, 0x55, 0xB2, 0xAE, 0x1D,
-    0xA0, 0x6F, 0x0A, 0xE7, 0xE0, 0x0F, 0x48, 0xDB, 0x83, 0xAB, 0x55, 0x50, 0x9D, 0x9D, 0xB6, 0x2E,
-    0x1F, 0x53, 0x22, 0x43, 0x1D, 0xE2, 0xC6, 0xF9, 0xA2, 0x09, 0x4F, 0x54, 0xBF, 0x64, 0x06, 0xF3,
-    0x10, 0x12, 0xAD, 0xBF, 0xEB, 0xA8, 0x9E, 0x47, 0x6F, 0x8A, 0x71, 0xD3, 0x24, 0xAA, 0x83, 0x57,
-    0x06, 0xC3, 0x49, 0x23, 0xAD, 0x1C, 0xB5, 0x24, 0x36, 0xEE, 0x9F, 0x17, 0x5D, 0x97, 0xE8, 0xE3,
-    0x2A, 0xB8, 0x89, 0x78, 0x55, 0xB0, 0x86, 0xDC, 0xC9, 0x2A, 0x9C, 0xEB, 0x03, 0x13, 0xE0, 0x18,
-    0xB0, 0x61, 0x0B, 0xCC, 0xEB, 0xCF, 0x0C, 0xCC, 0x46, 0xFA, 0xF6, 0xA8, 0x61, 0x79, 0x3C, 0x93,
-    0x2D, 0xE2, 0x6D, 0xEB, 0x11, 0x70, 0xDA, 0x34, 0xBB, 0x91, 0x27, 0x45, 0x3A, 0x14, 0x08, 0xC9,
-    0x23, 0xB3, 0x8D, 0x37, 0x00, 0x2A, 0x7C, 0xD0, 0xAB, 0xE0, 0xAC, 0xB6, 0x76, 0xC1, 0x2D, 0xBE,
-    0x3E, 0x4A, 0xA3, 0xCF, 0x53, 0xE6, 0xD7, 0x76, 0x2F, 0xF2, 0xF1, 0xAC, 0xB3, 0xC7, 0x49, 0x3F,
-    0x88, 0x5E, 0x6E, 0x21, 0x00, 0xAB, 0x16, 0xB6, 0x86, 0xFF, 0xAD, 0xAD, 0xB3, 0x0A, 0xC4, 0x3C,
-    0xAC, 0x36, 0x21, 0xD0, 0xCD, 0x36, 0x3B, 0xDF, 0x1F, 0xF4, 0xFA, 0x70, 0xB3, 0x4A, 0xCA, 0x6E,
-    0x8F, 0xD7, 0x2F, 0x59, 0x22, 0x6F, 0x58, 0xFD, 0x03, 0x3E, 0x30, 0x4D, 0xCE, 0x20, 0x2D, 0xF7,
-    0x09, 0xED, 0x0F, 0x93, 0x3F, 0x73, 0xC9, 0x2C, 0xD4, 0x7E, 0xDA, 0x1E, 0x30, 0xB9, 0xE6, 0x0A,
-    0xBF, 0xBB, 0xE6, 0x2F, 0xE2, 0xB0, 0xDD, 0x33, 0xC3, 0x9A, 0xC7, 0x58, 0xF1, 0x95, 0x3F, 0xFD,
-    0x37, 0x97, 0x1C, 0xAD, 0xA5, 0x25, 0xC1, 0x18, 0x91, 0xD5, 0x32, 0x42, 0x95, 0x7C, 0x59, 0xE0,
-    0xD9, 0xF9, 0xAA, 0x7D, 0x09, 0xBE, 0x0A, 0xAC, 0xF2, 0xBE, 0x6C, 0xA6, 0xED, 0xD2, 0x69, 0xD1,
-    0x3A, 0x33, 0xBB, 0x49, 0xA2, 0x9B, 0x46, 0xB9, 0x57, 0xFA, 0x68, 0xB3, 0x4E, 0xCA, 0xFE, 0x25,
-    0x28, 0x97, 0xA7, 0x49, 0xB9, 0xF6, 0x8D, 0x3A, 0xF1, 0x03, 0xF2, 0x56, 0xF1, 0x4D, 0x6A, 0x63,
-    0x48, 0xEC, 0x2F, 0x45, 0x8E, 0x71, 0x8B, 0x7F, 0xE5, 0x03, 0xE9, 0xCF, 0xB8, 0xFD, 0xEB, 0x0F,
-    0xA5, 0xC1, 0xB7, 0x32, 0xF4, 0x7B, 0xE3, 0x86, 0x45, 0xC6, 0x67, 0x86, 0xF4, 0x1B, 0x0D, 0x7D,
-    0x7F, 0x43, 0xE2, 0x43, 0x02, 0x02, 0xB8, 0x90, 0xEA, 0x6E, 0x43, 0x3A, 0x1B, 0xE8, 0x39, 0xE8,
-    0x68, 0x2E, 0xA6, 0x63, 0x21, 0x89, 0xE5, 0x82, 0x87, 0xB3, 0x86, 0x72, 0xB4, 0xC0, 0x62, 0x19,
-    0xE1, 0x78, 0x45, 0xC7, 0xEA, 0x49, 0xF5, 0xAD, 0x4F, 0x2C, 0x38, 0xB0, 0x8C, 0xC5, 0x42, 0x1B,
-    0x62, 0xAD, 0xFE, 0x9A, 0x21, 0xC0, 0x6C, 0xC5, 0x32, 0xFF, 0x33, 0x21, 0xFF, 0x7B, 0x10, 0x20,
-    0xFE, 0xAC, 0x34, 0x43, 0x7B, 0x9B, 0x9D, 0xAD, 0x9E, 0xCC, 0x7F, 0x0A, 0xE0, 0x6A, 0xD1, 0x14,
-    0x8D, 0xDF, 0xFB, 0x26, 0x74, 0x9A, 0x88, 0x41, 0x78, 0x35, 0x38, 0xBB, 0x68, 0x68, 0x91, 0x34,
-    0xEA, 0xE9, 0xDE, 0x6C, 0x85, 0xFB, 0x7A, 0xB2, 0x97, 0x55, 0x4A, 0x6F, 0xDE, 0xCD, 0xB1, 0x1A,
-    0x69, 0x73, 0x17, 0x6D, 0x7C, 0xD2, 0x1A, 0x99, 0x9D, 0x58, 0xAC, 0xCE, 0xF9, 0xBB, 0x41, 0xA6,
-    0x44, 0xD3, 0xE3, 0x17, 0x89, 0x8A, 0x64, 0x65, 0xF6, 0x35, 0x0A, 0x2C, 0x1A, 0x52, 0x30, 0xF5,
-    0x3B, 0x66, 0xAB, 0x4E, 0xD3, 0xAC, 0xD3, 0xD2, 0x59, 0x5B, 0x61, 0x95, 0x66, 0x1F, 0x77, 0x83,
-    0xCE, 0x4C, 0x8A, 0xF8, 0x06, 0xE4, 0xFF, 0xEE, 0x3B, 0xD2, 0x86, 0x3F, 0x07, 0x04, 0xF3, 0xF3,
-    0xFB, 0x06, 0xC4, 0x03, 0xAD, 0xFB, 0xEB, 0x5D, 0x9A, 0x1F, 0x13, 0x99, 0x4C, 0x45, 0xD1, 0xDB,
-    0xA4, 0x37, 0x5F, 0xE0, 0x3E, 0xC3, 0x95, 0x72, 0x9E, 0xA9, 0xAF, 0x3C, 0x79, 0xDD, 0x96, 0x59,
-    0x08, 0xE2, 0x3B, 0x1D, 0x9B, 0x18, 0xBA, 0x79, 0x1F, 0xDC, 0xF3, 0x80, 0x5D, 0xE1, 0x96, 0xC8,
-    0x71, 0x87, 0x15, 0xBF, 0x7D, 0xDC, 0x93, 0x71, 0xDF, 0x47, 0x37, 0x36, 0xF0, 0xED, 0x8A, 0xE2,
-    0x86, 0x9A, 0x77, 0x1C, 0x1C, 0xFD, 0x4C, 0xB9, 0x0B, 0xC4, 0x9A, 0xAB, 0x8B, 0xD3, 0x4B, 0xDC,
-    0x24, 0x1A, 0x23, 0xE0, 0x51, 0x87, 0x90, 0x1C, 0x54, 0xF0, 0xF0, 0x65, 0xA9, 0xBE, 0x9B, 0xB9,
-    0x5B, 0xF6, 0x90, 0x4D, 0x6D, 0x31, 0x4E, 0x01, 0x29, 0xCE, 0x1E, 0x87, 0x30, 0x3F, 0x14, 0xD9,
-    0xEB, 0x6F, 0xCF, 0xDF, 0xE3, 0xE8, 0xF7, 0x38, 0xC2, 0x7B, 0xDB, 0xC2, 0x8F, 0x46, 0xF8, 0xEB,
-    0x73, 0xE1, 0x23, 0x23, 0xFC, 0x6B, 0xE5, 0x1C, 0xB6, 0x13, 0x73, 0xFA, 0x03, 0x0B, 0x04, 0x9D,
-    0xD9, 0xCD, 0x7D, 0xCC, 0xE5, 0x64, 0x8A, 0x31, 0xF4, 0x36, 0x7A, 0xF1, 0x98, 0xDB, 0x02, 0xAD,
-    0x6C, 0x2F, 0x54, 0xF9, 0xD0, 0xC6, 0x0A, 0x9B, 0x68, 0x9A, 0x2D, 0x37, 0xDC, 0xF3, 0xB6, 0xC1,
-    0x8F, 0xE7, 0x64, 0xE3, 0x6E, 0x10, 0x11, 0xD6, 0x1F, 0xB4, 0xCC, 0x84, 0x48, 0x9B, 0x16, 0x92,
-    0x75, 0x01, 0x87, 0xE4, 0xD4, 0x80, 0xBA, 0x45, 0x66, 0xE3, 0xA5, 0x8C, 0x73, 0x77, 0x44, 0xD4,
-    0x4E, 0x10, 0xDA, 0x3D, 0xAD, 0xA1, 0x8D, 0xFA, 0x9F, 0x37, 0x60, 0xA9, 0xC5, 0xAB, 0x97, 0x9A,
-    0x73, 0x40, 0xEE, 0x93, 0x17, 0x5B, 0xEE, 0x25, 0xFF, 0xEE, 0x44, 0xCF, 0xE4, 0xFD, 0xAA, 0x3B,
-    0xF0, 0x0D, 0x35, 0xCC, 0x06, 0x51, 0x6B, 0xE4, 0xCB, 0x45, 0xE4, 0x4D, 0x2C, 0x00, 0x60, 0xBE,
-    0xB3, 0xD2, 0x14, 0xE3, 0x93, 0x9D, 0x6F, 0x38, 0xCE, 0x8D, 0x64, 0xCB, 0x23, 0x91, 0x61, 0xC0,
-    0xED, 0x31, 0x1A, 0x29, 0x3F, 0xB3, 0xE3, 0xAE, 0x6C, 0xF4, 0xAB, 0xA2, 0xD1, 0x36, 0x7E, 0x8B,
-    0xA9, 0x0D, 0x98, 0x8F, 0x8B, 0x55, 0xEB, 0x57, 0x5E, 0x17, 0xB7, 0x09, 0xD8, 0xA8, 0xD6, 0x98,
-    0x8F, 0xCD, 0xAB, 0x17, 0xC1, 0x66, 0xDF, 0x48, 0x60, 0xFB, 0xB1, 0x3D, 0x07, 0x7A, 0x83, 0xF9,
-    0xE5, 0x9B, 0x34, 0xEC, 0x3C, 0x68, 0xF9, 0x86, 0x5C, 0x04, 0xCD, 0x76, 0x74, 0xCB, 0x2A, 0xAA,
-    0xCF, 0xB1, 0xEF, 0xE0, 0xEA, 0x41, 0x1F, 0x77, 0xE7, 0xCF, 0x4E, 0xF1, 0x76, 0x6D, 0x15, 0x0E,
-    0xF2, 0x8E, 0xFE, 0xAF, 0xD6, 0x31, 0x6D, 0x83, 0xA9, 0xAE, 0xA2, 0x12, 0x86, 0x40, 0x76, 0xD7,
-    0xBE, 0x49, 0xAD, 0x4B, 0x90, 0x21, 0x53, 0x7C, 0x9F, 0x02, 0xD9, 0xD7, 0x04, 0xDE, 0x81, 0x9A,
-    0x8D, 0x8C, 0x71, 0xB5, 0xD9, 0xE0, 0xB0, 0x3B, 0xAD, 0x44, 0x88, 0x3B, 0xB0, 0xD1, 0xD9, 0x83,
-    0x40, 0x27, 0x6F, 0xBB, 0x28, 0x90, 0x69, 0xA8, 0x20, 0x62, 0x9A, 0x6B, 0x1A, 0xB3, 0xFA, 0x02,
-    0xFA, 0x83, 0xAC, 0xB5, 0x38, 0x8C, 0x11, 0x6B, 0x86, 0xC5, 0x73, 0xF6, 0x65, 0x04, 0xEE, 0xFD,
-    0x91, 0x5E, 0x0B, 0x39, 0x37, 0xEB, 0x72, 0xA4, 0x71, 0x66, 0x1B, 0x77, 0xB4, 0x45, 0xCB, 0x78,
-    0x9C, 0xB2, 0x0A, 0xCB, 0x29, 0x6A, 0x56, 0x2C, 0x11, 0x16, 0x83, 0x86, 0x41, 0x76, 0x69, 0xFE,
-    0xF6, 0x8A, 0x33, 0x7B, 0x15, 0xA4, 0x69, 0xCC, 0x46, 0x57, 0xF3, 0xA2, 0x0C, 0x6B, 0xBE, 0x79,
-    0x01, 0x87, 0x4A, 0xE0, 0xCB, 0xAF, 0xD4, 0xD0, 0x81, 0xFB, 0xA5, 0x7C, 0x69, 0xCB, 0xA0, 0xF6,
-    0xF0, 0xF5, 0x9C, 0xA2, 0xB2, 0x39, 0x8F, 0x4F, 0x1D, 0xE7, 0x55, 0xCB, 0xA8, 0x32, 0xD5, 0x8F,
-    0xF8, 0x9A, 0xE5, 0x96, 0x86, 0xBA, 0xAC, 0xC5, 0x7C, 0x31, 0x81, 0x3C, 0xC1, 0x1B, 0xC3, 0x3C,
-    0x6E, 0x9E, 0x63, 0xD2, 0xC8, 0x17, 0xD1, 0xC0, 0xF2, 0x59, 0xB1, 0x23, 0x15, 0x1A, 0xAD, 0x3B,
-    0x6B, 0xFA, 0xA7, 0xB8, 0xD0, 0x15, 0xA5, 0xFF, 0xD9, 0x78, 0xAA, 0x38, 0x62, 0x5F, 0x0B, 0xB1,
-    0x11, 0x10, 0x74, 0xCB, 0x69, 0x8C, 0xA6, 0x1F, 0x9A, 0xCA, 0xCA, 0xF2, 0x02, 0x09, 0x74, 0x0C,
-    0xD0, 0xF9, 0xAD, 0xAC, 0x6E, 0xA3, 0xFA, 0xD9, 0x88, 0xE9, 0x09, 0xDF, 0xEA, 0xC0, 0x8C, 0xFB,
-    0x7D, 0xE0, 0xF7, 0xDE, 0x95, 0xF1, 0x6F, 0x1A, 0xC3, 0x54, 0xAC, 0x98, 0xCB, 0xA9, 0x2D, 0xD5,
-    0xE0, 0x9B, 0xDF, 0x2E, 0xF6, 0x11, 0xC0, 0xAF, 0x82, 0x69, 0x34, 0x90, 0xCB, 0x13, 0x75, 0xD0,
-    0xFB, 0x69, 0x62, 0xF7, 0x14, 0x62, 0x46, 0x0F, 0x61, 0x97, 0x4C, 0xDF, 0xAC, 0xC0, 0x3E, 0x2E,
-    0x1C, 0x04, 0x85, 0xEF, 0xF4, 0xD4, 0xE9, 0x2B, 0x58, 0xA2, 0x7C, 0x76, 0xFE, 0xB6, 0x09, 0x9C,
-    0x2C, 0x40, 0x3E, 0xDC, 0xCB, 0xB4, 0x29, 0xCA, 0x60, 0xA3, 0x1D, 0x7A, 0x0E, 0xFF, 0x43, 0x4F,
-    0x54, 0x59, 0xFE, 0x7A, 0x66, 0x37, 0x90, 0x2A, 0x89, 0x6B, 0x28, 0xFD, 0x02, 0xB2, 0xEB, 0x23,
-    0xB7, 0x7F, 0xBA, 0x49, 0x4A, 0xAF, 0x8B, 0x79, 0x0B, 0x40, 0xCE, 0x12, 0x78, 0x64, 0x72, 0x6E,
-    0x7A, 0x11, 0x67, 0x57, 0x8D, 0xE9, 0xC8, 0x9A, 0x57, 0x1F, 0x93, 0x73, 0x2F, 0x19, 0xFF, 0xD5,
-    0x69, 0x4B, 0xE8, 0x51, 0x8C, 0xB9, 0x81, 0x25, 0x5F, 0x02, 0xF9, 0xC2, 0xE6, 0x9C, 0xDF, 0x3E,
-    0xED, 0xDA, 0xD7, 0x98, 0xE2, 0x92, 0x1B, 0x46, 0x0F, 0xFC, 0xE2, 0x33, 0xC5, 0x18, 0xE5, 0xFF,
-    0x01, 0x55, 0x90, 0x3D, 0x4E, 0xC3, 0x40, 0x10, 0x85, 0x67, 0xBD, 0x8E, 0x1D, 0x30, 0xC2, 0x29,
-    0x92, 0x82, 0x28, 0xC2, 0x0D, 0x05, 0x0D, 0x71, 0x43, 0x41, 0xE1, 0x78, 0x17, 0x59, 0x22, 0x27,
-    0x48, 0x4F, 0xC1, 0x21, 0x28, 0x12, 0xCC, 0x4F, 0x91, 0x92, 0x48, 0x94, 0x5C, 0x00, 0x89, 0x82,
-    0x0B, 0x18, 0xB1, 0x71, 0x0A, 0x4A, 0x4C, 0x28, 0x68, 0x83, 0xB8, 0xC0, 0x46, 0xDA, 0xC2, 0x91,
-    0xC6, 0x59, 0x16, 0x3A, 0xA6, 0x99, 0x79, 0xD2, 0x9B, 0xD1, 0x37, 0xAF, 0xE9, 0x16, 0xA9, 0x85,
-    0x6E, 0x51, 0xB7, 0xE8, 0x12, 0x71, 0x54, 0x07, 0x53, 0x81, 0xA0, 0x6B, 0x78, 0x56, 0x81, 0x97,
-    0x17, 0x47, 0x46, 0x3A, 0xC7, 0x74, 0x1D, 0x31, 0x3D, 0x7B, 0x2D, 0xC1, 0x06, 0xD3, 0x35, 0xB6,
-    0x06, 0x1C, 0x80, 0x8A, 0x0E, 0xBB, 0xCF, 0xB5, 0x72, 0x4A, 0xA8, 0x51, 0x64, 0xB3, 0xD2, 0x36,
-    0x5E, 0x2A, 0xB3, 0xD4, 0xFF, 0x94, 0x95, 0x4D, 0xC0, 0x5B, 0x30, 0x1C, 0xF6, 0xF6, 0x22, 0xA2,
-    0x5C, 0x41, 0xB9, 0xB3, 0x08, 0x31, 0x8A, 0xCE, 0x0F, 0x7A, 0x51, 0xA0, 0x08, 0x77, 0x28, 0xC7,
-    0xCC, 0xBF, 0xCD, 0x97, 0xAA, 0xD7, 0xB5, 0xAE, 0x84, 0x59, 0xB4, 0x49, 0x22, 0x32, 0x16, 0x80,
-    0x2E, 0xDC, 0x12, 0xDA, 0xD0, 0xD9, 0xA0, 0xDF, 0x92, 0x85, 0x44, 0x95, 0xDE, 0x58, 0x1C, 0xEE,
-    0x1B, 0x03, 0x79, 0x00, 0xAD, 0xE2, 0xA7, 0x19, 0x1F, 0x36, 0x08, 0x10, 0x6B, 0x29, 0x91, 0xF9,
-    0x79, 0xD9, 0x08, 0xFD, 0x2F, 0xBC, 0x08, 0x83, 0x13, 0x1E, 0x87, 0x6F, 0x73, 0x15, 0xBB, 0xC5,
-    0x69, 0x33, 0x8E, 0xA3, 0xE8, 0xB0, 0x11, 0x24, 0x8B, 0x12, 0x23, 0xC3, 0x44, 0x4A, 0x36, 0xC3,
-    0x5D, 0xBE, 0xE3, 0x8C, 0x65, 0x95, 0xFA, 0xF3, 0xC9, 0x59, 0xBB, 0x5F, 0x49, 0xBD, 0x9D, 0x4E,
-    0x27, 0x9B, 0x9E, 0xC4, 0x98, 0xD5, 0xA0, 0x9B, 0x98, 0x00, 0xB2, 0xD0, 0xE2, 0x40, 0xD4, 0xC8,
-    0x13, 0x2F, 0x77, 0x15, 0x81, 0x47, 0xAD, 0xB5, 0x04, 0x68, 0x40, 0x28, 0x5C, 0x0D, 0x2B, 0x8C,
-    0xE9, 0x3B, 0x37, 0xC7, 0x2C, 0xB1, 0xC5, 0xFA, 0xE6, 0x69, 0x6F, 0x65, 0x90, 0xBC, 0xEB, 0x64,
-    0x3D, 0x8C, 0x75, 0x7E, 0xA3, 0x8C, 0x68, 0x0D, 0x12, 0x8D, 0x4C, 0x8B, 0x7F, 0x9C, 0xBF, 0x25,
-    0x21, 0xE4, 0xAE, 0x04, 0x04, 0xFF, 0x2F, 0x1F, 0xC3, 0xF0, 0x21, 0xD1, 0x8C, 0xCD, 0xC0, 0x9B,
-    0x6A, 0x76, 0x09, 0x3F, 0xCD, 0x5C, 0x41, 0xB0, 0xD6, 0xD6, 0x75, 0xBE, 0x92, 0xFC, 0x50, 0xC6,
-    0x9A, 0x58, 0x2C, 0xA0, 0xF6, 0xD8, 0x6D, 0xE4, 0xC9, 0x64, 0xE1, 0x34, 0x6E, 0xD4, 0x45, 0x16,
-    0x5D, 0x00, 0x12, 0x30, 0x19, 0x2F, 0xBC, 0xE0, 0x35, 0xF3, 0xFE, 0x78, 0xC1, 0xC2, 0x99, 0xAE,
-    0x5A, 0xCF, 0x24, 0xAF, 0x8B, 0x2C, 0x3C, 0x53, 0xE0, 0x0A, 0x58, 0x78, 0x91, 0x05, 0x64, 0x3A,
-    0x6E, 0x16, 0x5D, 0x84, 0x85, 0x3B, 0xD3, 0x90, 0xB6, 0x78, 0xE1, 0x45, 0x3A, 0x83, 0x91, 0x1E,
-    0x2C, 0x58, 0x78, 0x61, 0x01, 0xC3, 0x78, 0x3A, 0x5E, 0x58, 0x36, 0x76, 0x92, 0xDA, 0x0B, 0x04,
-    0x16, 0xB1, 0x1E, 0xBE, 0xD2, 0xED, 0xF7, 0x9D, 0xAB, 0xFF, 0xBD, 0x07, 0x06, 0x0C, 0x06, 0xD2,
-    0x60, 0xEB, 0xF2, 0xFF, 0xFA, 0xA5, 0xAB, 0x7B, 0xCF, 0x3D, 0xE7, 0x3B, 0xDF, 0x39, 0xF7, 0x08,
-    0xA5, 0xF0, 0xE7, 0x7B, 0x38, 0x4A, 0x1E, 0xB5, 0x52, 0x49, 0x87, 0x0F, 0x3F, 0xE2, 0x59, 0xB5,
-    0x75, 0x36, 0x5B, 0xCA, 0xAC, 0x35, 0x29, 0x8E, 0x60, 0xF0, 0x4C, 0x60, 0xD4, 0x3E, 0x1C, 0xDF,
-    0xC3, 0xA1, 0xE4, 0xB0, 0xB6, 0x92, 0x63, 0x3C, 0x9E, 0x4F, 0xE7, 0x36, 0xE3, 0xD8, 0x86, 0xE3,
-    0x24, 0xCE, 0xC9, 0x7D, 0xB8, 0xBF, 0x97, 0xCE, 0x4C, 0x9A, 0xFB, 0x43, 0x56, 0x79, 0x26, 0x2B,
-    0xD4, 0xE2, 0xC2, 0x03, 0xED, 0x1F, 0xFD, 0xCC, 0xF2, 0xD8, 0x5A, 0xDB, 0xE2, 0x6A, 0x6B, 0xD4,
-    0x90, 0x36, 0x07, 0xD4, 0x8E, 0xB0, 0x8F, 0x8B, 0x78, 0xE7, 0x18, 0x60, 0x4E, 0xBA, 0xC0, 0xD3,
-    0x92, 0x06, 0x4D, 0x68, 0xED, 0x51, 0xE5, 0x59, 0x3B, 0xE2, 0xE4, 0xC7, 0xB6, 0xC6, 0xC9, 0xC8,
-    0xA8, 0xB0, 0x57, 0x56, 0x79, 0xA3, 0xCA, 0x6A, 0x5C, 0x19, 0x75, 0x2A, 0x6D, 0xFC, 0x41, 0x95,
-    0x36, 0x2F, 0x55, 0x66, 0xEB, 0xAC, 0x9A, 0xDF, 0x1B, 0xB7, 0xCA, 0x89, 0xC7, 0xB7, 0x94, 0x91,
-    0x6E, 0xD4, 0x86, 0x3F, 0xFF, 0x88, 0xDF, 0x1B, 0xF4, 0x5C, 0xC8, 0x15, 0xDF, 0x92, 0x73, 0x0B,
-    0x6E, 0x7E, 0x7D, 0x69, 0x6D, 0x93, 0x5D, 0x5C, 0xCE, 0xAD, 0xDA, 0x1F, 0x18, 0xAF, 0x8D, 0xDB,
-    0xA0, 0x60, 0xAF, 0xD6, 0xCD, 0x92, 0xDD, 0xDE, 0xFC, 0xB5, 0x56, 0x11, 0xC4, 0x96, 0x59, 0x3C,
-    0x62, 0xD3, 0xF5, 0x1C, 0x63, 0xE9, 0x30, 0xB3, 0x3E, 0xEE, 0xFC, 0x3E, 0xAD, 0xBD, 0x1E, 0x57,
-    0x77, 0x3A, 0x57, 0x47, 0xB9, 0x64, 0x16, 0x63, 0x91, 0xE3, 0xF8, 0x31, 0x65, 0x73, 0x7C, 0xC7,
-    0x54, 0xCB, 0x4A, 0xBD, 0x9C, 0x35, 0x90, 0xF8, 0xF0, 0xB8, 0x89, 0xF0, 0x23, 0xE6, 0x5B, 0xAB,
-    0x85, 0x25, 0xA5, 0x96, 0x5F, 0xC3, 0xC7, 0x15, 0xC8, 0xC9, 0x2A, 0xA3, 0xF3, 0x0C, 0x93, 0x7F,
-    0x6E, 0xC0, 0x2D, 0x9D, 0x4A, 0x6C, 0x8D, 0x5F, 0xF0, 0xD0, 0x56, 0xA5, 0xE6, 0x19, 0x65, 0x97,
-    0x55, 0xF2, 0x6E, 0x1D, 0x5D, 0x1D, 0x43, 0x8C, 0xDD, 0x24, 0x18, 0xCA, 0xD6, 0x45, 0xAC, 0xD6,
-    0x6E, 0x3B, 0xA4, 0x16, 0x43, 0xC7, 0x30, 0x6F, 0xDF, 0xD4, 0xA9, 0xBD, 0x60, 0xD1, 0x6B, 0xD0,
-    0xEE, 0xD7, 0x7B, 0x3E, 0xEB, 0xC6, 0x2D, 0x5E, 0xAE, 0xEE, 0xED, 0x5E, 0x6F, 0xB6, 0x14, 0xDA,
-    0x21, 0xA0, 0x00, 0xAA, 0xBB, 0xFE, 0xBF, 0x50, 0x65, 0x01, 0x11, 0x86, 0x58, 0xC5, 0x5E, 0x25,
-    0xB5, 0xC8, 0x1F, 0x6A, 0xB1, 0xC8, 0xC5, 0xC6, 0xAC, 0x20, 0x23, 0xC8, 0x40, 0xC5, 0x95, 0x55,
-    0x37, 0xB5, 0xC5, 0xD4, 0x42, 0x3C, 0x49, 0xCE, 0x8B, 0xD8, 0x1A, 0x95, 0x2A, 0xCB, 0xBE, 0xD0,
-    0xA5, 0x55, 0x3B, 0xA4, 0x7D, 0x93, 0xED, 0xD3, 0x46, 0x59, 0x6F, 0xD4, 0x50, 0x98, 0x65, 0x53,
-    0xB6, 0x09, 0x84, 0xAB, 0x0B, 0xA8, 0x61, 0xFE, 0xC8, 0xA4, 0xD0, 0xF9, 0x6C, 0x06, 0xB5, 0xC5,
-    0x54, 0x21, 0x48, 0x7B, 0x90, 0x72, 0x80, 0xCA, 0x8F, 0xB2, 0xB2, 0xD4, 0xA1, 0x1B, 0xBF, 0x40,
-    0xE6, 0xA2, 0xE4, 0x56, 0xD6, 0x1A, 0x7F, 0x3A, 0x68, 0xF5, 0x89, 0xEB, 0xB6, 0xE2, 0x65, 0xFE,
-    0x28, 0x97, 0x25, 0x8D, 0xDC, 0xE3, 0xBE, 0xA4, 0x35, 0xEF, 0x59, 0x86, 0xE2, 0x9F, 0xC3, 0xD5,
-    0xF2, 0x1C, 0xAE, 0xF9, 0xDC, 0x98, 0x66, 0x39, 0xA7, 0x69, 0x95, 0xB3, 0x82, 0xF8, 0xFC, 0x18,
-    0x36, 0xCE, 0x0C, 0x54, 0x97, 0x34, 0xDB, 0xD5, 0x64, 0x07, 0x1C, 0x01, 0x0C, 0x61, 0xA4, 0x72,
-    0x25, 0x22, 0x1B, 0x58, 0x42, 0xC3, 0xD3, 0xD0, 0x1B, 0x31, 0x05, 0x3C, 0x89, 0x9A, 0xA8, 0x0B,
-    0xE8, 0xA2, 0x2F, 0x66, 0x51, 0xDA, 0xE7, 0xA9, 0x82, 0x43, 0x66, 0xEB, 0xE9, 0x71, 0x41, 0x31,
-    0x61, 0x46, 0x6C, 0x94, 0xD3, 0x3A, 0x7F, 0x1A, 0xC9, 0xC2, 0x6C, 0xD1, 0x3F, 0x8A, 0x0B, 0x75,
-    0x55, 0x62, 0x11, 0x31, 0xE5, 0x14, 0x32, 0x53, 0x06, 0xB3, 0x8E, 0x6A, 0x68, 0x77, 0x86, 0x89,
-    0x9F, 0x96, 0x05, 0xA9, 0x38, 0xD0, 0x1C, 0xA7, 0xF0, 0xC4, 0x6C, 0x05, 0xA3, 0xB2, 0xC1, 0x80,
-    0xAB, 0x42, 0x0C, 0xBD, 0x8D, 0xA9, 0x0D, 0x49, 0x0F, 0x85, 0x4C, 0xFB, 0xCC, 0x56, 0x29, 0x31,
-    0x64, 0x61, 0x6E, 0x6B, 0xAF, 0xB3, 0xC9, 0xF2, 0xF9, 0xC3, 0x39, 0x6E, 0x4C, 0xEB, 0xD8, 0xF4,
-    0xEB, 0x6C, 0xE6, 0xD1, 0xEC, 0x6A, 0x8B, 0x31, 0xD7, 0xA2, 0x73, 0x78, 0x3C, 0x66, 0xE2, 0x54,
-    0xAC, 0xC5, 0x97, 0x8C, 0xFA, 0x96, 0xF1, 0xA4, 0xE6, 0x49, 0x8D, 0x1F, 0xAD, 0xE6, 0x8F, 0x5C,
-    0xE6, 0x98, 0x43, 0x0E, 0xE4, 0x0E, 0xAB, 0x44, 0x29, 0x61, 0x57, 0xA5, 0xDD, 0x25, 0x93, 0xE7,
-    0x78, 0x9F, 0xF1, 0x0B, 0x15, 0xD6, 0x3B, 0x30, 0x82, 0x17, 0x6B, 0x68, 0x17, 0x46, 0xE6, 0x2D,
-    0xCD, 0x97, 0xC0, 0x9B, 0xED, 0xB5, 0x5D, 0x66, 0xF5, 0xE8, 0xE3, 0xDA, 0x22, 0x6A, 0x31, 0x17,
-    0xA8, 0x52, 0x9D, 0x40, 0x35, 0x83, 0x56, 0x45, 0xED, 0x01, 0xDC, 0x75, 0xA4, 0x52, 0xFE, 0x80,
-    0xBB, 0x62, 0x3B, 0x21, 0x2E, 0x65, 0xAD, 0xD2, 0x5C, 0x05, 0x01, 0x56, 0xE4, 0x14, 0xBE, 0x44,
-    0x5C, 0x54, 0x4D, 0x49, 0x2F, 0x4E, 0x4A, 0x85, 0xF9, 0x5C, 0xB0, 0x63, 0x6A, 0x0F, 0xD9, 0x3E,
-    0x60, 0x87, 0x5F, 0xB5, 0x19, 0x67, 0xBA, 0x81, 0xCE, 0xD8, 0x91, 0xEA, 0x36, 0xBA, 0x05, 0x54,
-    0x9A, 0xCD, 0x0E, 0x36, 0xDB, 0xD7, 0x1A, 0xD1, 0xE7, 0x27, 0xD9, 0x70, 0x94, 0x1E, 0x07, 0x14,
-    0x60, 0xC1, 0x5C, 0x13, 0xBD, 0x47, 0x53, 0x3A, 0x82, 0x45, 0x4C, 0xF7, 0x10, 0xAD, 0xA0, 0x34,
-    0xEA, 0x00, 0x67, 0x31, 0xBC, 0x40, 0x38, 0x41, 0xC7, 0xBE, 0xA8, 0x21, 0x24, 0x98, 0x43, 0x05,
-    0x75, 0x15, 0xD7, 0x10, 0x63, 0x69, 0x7C, 0x6B, 0x68, 0xD7, 0x06, 0xAA, 0xBA, 0x48, 0x5C, 0xC4,
-    0x48, 0xFA, 0x60, 0xF8, 0x61, 0x07, 0x50, 0xC4, 0xA1, 0x5A, 0x1C, 0x79, 0x30, 0xE4, 0x54, 0x8B,
-    0x22, 0x20, 0x9A, 0x9B, 0xA7, 0xE0, 0x13, 0xFC, 0x01, 0xBF, 0x0F, 0xEE, 0x6F, 0xFC, 0x37, 0x2E,
-    0xF3, 0xBE, 0x26, 0xB3, 0xA3, 0xD3, 0xB6, 0x97, 0x5E, 0xA3, 0xED, 0xD0, 0x08, 0xA1, 0xB4, 0x80,
-    0x56, 0x13, 0xA2, 0xAF, 0x80, 0x7F, 0xE3, 0x88, 0xEB, 0xC9, 0x87, 0x4C, 0x7D, 0x05, 0x53, 0x7F,
-    0xBE, 0xFB, 0x3C, 0xDC, 0xD8, 0x17, 0xC7, 0x85, 0x81, 0x7F, 0x80, 0xA3, 0xB0, 0xB3, 0x37, 0x39,
-    0xAC, 0xB8, 0x0D, 0x61, 0x8D, 0x8F, 0xDD, 0x09, 0xAB, 0xF9, 0x35, 0x87, 0xB5, 0x37, 0x98, 0x79,
-    0x31, 0x81, 0x8E, 0x98, 0x34, 0x9A, 0x06, 0x28, 0x53, 0xE6, 0x5F, 0x68, 0x0A, 0x34, 0x89, 0x34,
-    0x39, 0x9A, 0x54, 0xA1, 0xC9, 0xD8, 0x1C, 0x60, 0xF3, 0x26, 0x1B, 0x83, 0x26, 0x1C, 0x66, 0xB6,
-    0xD0, 0xB4, 0x65, 0x38, 0x10, 0x3B, 0x60, 0x99, 0x3C, 0x23, 0x4D, 0x46, 0x77, 0xCA, 0x05, 0xEB,
-    0x9F, 0x45, 0xF3, 0xC6, 0x03, 0xF5, 0xA5, 0x7E, 0x01, 0xFB, 0xDD, 0x54, 0xC4, 0x5D, 0x0C, 0xD3,
-    0x6B, 0x62, 0xF8, 0x8F, 0x42, 0xB7, 0x31, 0x00, 0x48, 0x61, 0x32, 0x99, 0x1A, 0x3D, 0xAC, 0x75,
-    0x52, 0x8C, 0x58, 0x5B, 0x15, 0x55, 0x63, 0x44, 0xF5, 0x6D, 0xC7, 0xB8, 0x52, 0xB2, 0xE4, 0xB9,
-    0x38, 0x58, 0xAA, 0x48, 0xDC, 0x8E, 0x84, 0xB8, 0xB4, 0x19, 0x63, 0xB8, 0x43, 0x5D, 0x8D, 0xB0,
-    0x04, 0xA0, 0xC4, 0x18, 0x50, 0x37, 0xD0, 0x8B, 0xCD, 0xA3, 0x81, 0x76, 0x55, 0xA7, 0x3D, 0x1E,
-    0x94, 0x75, 0xBA, 0x49, 0x2C, 0x8C, 0x7E, 0x81, 0x46, 0xED, 0x2D, 0xAA, 0xEF, 0xFC, 0x1E, 0xD0,
-    0x84, 0x0B, 0xA0, 0x2E, 0x6D, 0x64, 0xE0, 0xC7, 0xDB, 0xED, 0x10, 0xF4, 0x66, 0x6F, 0x10, 0x99,
-    0xC3, 0x4E, 0xF1, 0x93, 0x52, 0x7B, 0xB9, 0x0C, 0x38, 0x15, 0xF5, 0xDB, 0x54, 0x7A, 0x09, 0x28,
-    0xB3, 0xA7, 0x8F, 0x38, 0x91, 0x8A, 0x1E, 0x8B, 0x46, 0x29, 0x78, 0x1C, 0xD3, 0x22, 0xCF, 0xDB,
-    0x2E, 0xB2, 0xCD, 0x1C, 0x05, 0xC4, 0xB6, 0x09, 0x31, 0x55, 0x4C, 0x43, 0x8F, 0x21, 0x16, 0x93,
-    0xBC, 0x8D, 0x93, 0xC9, 0x19, 0x9C, 0x7C, 0xAF, 0x22, 0x0A, 0x54, 0x44, 0x81, 0x8A, 0x57, 0x3A,
-    0xFF, 0xC4, 0x3B, 0x3A, 0x71, 0x51, 0x75, 0x69, 0xF7, 0xB0, 0xCF, 0x5A, 0x85, 0xF9, 0xCB, 0x9C,
-    0x7F, 0x8A, 0x41, 0x9F, 0x7A, 0x91, 0xB3, 0x16, 0x78, 0xDC, 0x3A, 0x01, 0x21, 0x60, 0x68, 0x81,
-    0x0A, 0x25, 0xAE, 0x2F, 0x2F, 0xC7, 0x09, 0x4F, 0x26, 0x38, 0x92, 0x6E, 0x2D, 0x07, 0x02, 0xAC,
-    0xCE, 0x56, 0x0C, 0x4E, 0x5E, 0x31, 0x78, 0xE6, 0x60, 0xF8, 0x23, 0xD7, 0x2F, 0x33, 0xF3, 0x51,
-    0x4E, 0x43, 0x86, 0x71, 0xF8, 0x76, 0x88, 0x6C, 0x27, 0x7D, 0x62, 0x72, 0x8F, 0xC2, 0x55, 0xED,
-    0xB4, 0xA0, 0x23, 0x31, 0x2F, 0x2D, 0x5B, 0x2A, 0x3E, 0xAE, 0x04, 0x96, 0x64, 0x15, 0xE5, 0x1D,
-    0x09, 0xC4, 0x72, 0x5C, 0x74, 0x44, 0x67, 0x78, 0x0A, 0xB6, 0x0A, 0xB3, 0xE8, 0x70, 0x55, 0x42,
-    0x61, 0x10, 0x0F, 0x73, 0x62, 0x42, 0x55, 0x36, 0xB8, 0xB2, 0x24, 0xA7, 0xD9, 0xE2, 0x94, 0x98,
-    0x2B, 0x59, 0xC7, 0xB4, 0xE6, 0xA0, 0xC5, 0xA0, 0xC5, 0x5D, 0x66, 0x54, 0x9D, 0x1E, 0x63, 0x09,
-    0xE0, 0x96, 0xE8, 0x29, 0x15, 0x29, 0x8D, 0xF2, 0xC1, 0x69, 0x70, 0x01, 0x4E, 0xD1, 0x55, 0xFA,
-    0x30, 0x40, 0x3F, 0x86, 0xE8, 0x12, 0xFA, 0x8E, 0x12, 0xE2, 0xBD, 0x36, 0x2A, 0x6D, 0xEB, 0xDC,
-    0x09, 0x25, 0xF7, 0x66, 0x8B, 0x94, 0xB8, 0x6D, 0x43, 0x5B, 0xE3, 0x7F, 0x28, 0x56, 0xC4, 0x05,
-    0xC5, 0x75, 0xCA, 0xFB, 0xBC, 0x4B, 0xCA, 0xDC, 0xFB, 0xAC, 0x4F, 0xB3, 0xDC, 0xFF, 0x83, 0xD9,
-    0x81, 0xF6, 0x8A, 0xD9, 0x9E, 0x15, 0x7E, 0x3B, 0xEC, 0xCB, 0x8A, 0xA0, 0x2D, 0xC1, 0x7D, 0x82,
-    0x56, 0x77, 0x6C, 0xB3, 0x36, 0x45, 0x9B, 0x36, 0x69, 0x15, 0xB6, 0x71, 0x8D, 0xB6, 0x89, 0x2B,
-    0x38, 0xC8, 0x71, 0x53, 0x6E, 0x8D, 0x46, 0x57, 0xC4, 0x99, 0xF9, 0xF2, 0x7F, 0x60, 0x7B, 0xB7,
-    0xFC, 0x02, 0x84, 0xA0, 0x78, 0x18, 0xE5, 0xC0, 0xA5, 0x28, 0x73, 0x77, 0xD2, 0x3A, 0x1E, 0x05,
-    0x39, 0x65, 0x1F, 0x1F, 0xB7, 0xF9, 0xAD, 0xAF, 0xC4, 0xF2, 0x37, 0xB2, 0xFC, 0x47, 0xD8, 0x67,
-    0x23, 0xD4, 0x0C, 0xFC, 0x2A, 0x0F, 0x78, 0x1F, 0xED, 0x24, 0xC5, 0x64, 0x0E, 0xE3, 0x2E, 0x03,
-    0x47, 0x9B, 0xBD, 0xDB, 0x41, 0x39, 0x61, 0x12, 0xD9, 0x7B, 0x6B, 0x1F, 0x28, 0x7B, 0x38, 0xAB,
-    0xEC, 0x2C, 0x7B, 0xCE, 0x5A, 0xCF, 0x7A, 0xF6, 0xA3, 0xB2, 0x0A, 0xE9, 0x84, 0xC9, 0xF7, 0xD4,
-    0xC2, 0xA2, 0xF3, 0xE3, 0x33, 0x92, 0x59, 0x7B, 0xDA, 0xCA, 0x0A, 0x74, 0x30, 0x1F, 0x7A, 0x7F,
-    0xAA, 0x4A, 0x48, 0x6D, 0xF0, 0x44, 0x7F, 0xEE, 0xF6, 0x24, 0x6F, 0x4F, 0xE9, 0xB9, 0x20, 0x08,
-    0x6D, 0xAB, 0x85, 0x97, 0x7E, 0x45, 0xBC, 0x84, 0x1A, 0xC3, 0xA1, 0x9B, 0xA4, 0x0F, 0xCC, 0xC6,
-    0xFF, 0x42, 0x7C, 0x4F, 0xC8, 0x35, 0x29, 0x91, 0x3C, 0x18, 0x8F, 0xAA, 0x35, 0xFC, 0x30, 0xCE,
-    0xD6, 0xD0, 0x95, 0x12, 0x16, 0xB0, 0x69, 0xCC, 0x61, 0xF2, 0x70, 0xA3, 0xF4, 0xDA, 0x06, 0xD2,
-    0x82, 0x1B, 0x8F, 0x5E, 0x81, 0xB1, 0x43, 0x08, 0x6B, 0xF8, 0x88, 0xAF, 0x20, 0xA2, 0x74, 0xD0,
-    0x74, 0x21, 0x81, 0x2D, 0xBC, 0xE7, 0x20, 0x2B, 0x4E, 0xD8, 0x27, 0xE6, 0x6E, 0x75, 0xD3, 0xDD,
-    0x6D, 0x1D, 0xF8, 0xD8, 0x33, 0x9D, 0x5E, 0x31, 0x3B, 0xA0, 0x9F, 0x67, 0x40, 0xBB, 0xFB, 0x47,
-    0x02, 0xB3, 0xE0, 0xF0, 0x55, 0x3C, 0xE4, 0x1D, 0x3E, 0xD0, 0x57, 0x42, 0xC1, 0x20, 0xC4, 0xE1,
-    0x21, 0x39, 0x61, 0x5C, 0xD8, 0xB2, 0x69, 0x26, 0x8F, 0xB8, 0xC9, 0xBE, 0x26, 0xCC, 0xB2, 0x88,
-    0x46, 0xAB, 0xDB, 0xA4, 0x29, 0x23, 0x68, 0x66, 0x19, 0xC0, 0x80, 0x4B, 0x46, 0x39, 0xAE, 0x09,
-    0x4C, 0xDA, 0x94, 0xE0, 0x5F, 0xAB, 0x76, 0x59, 0x22, 0x93, 0x02, 0xD2, 0xFB, 0x70, 0xA2, 0x4D,
-    0xBE, 0x3D, 0x36, 0x75, 0x0A, 0x8C, 0x10, 0xA0, 0x5A, 0x24, 0x61, 0x39, 0x6F, 0xFB, 0xA7, 0x00,
-    0x14, 0x55, 0x0A, 0x94, 0x38, 0x68, 0xF0, 0x08, 0xB8, 0x4E, 0x11, 0x95, 0xCF, 0x47, 0x07, 0x7C,
-    0x34, 0x80, 0x13, 0x5D, 0x60, 0x84, 0xE1, 0xE7, 0x68, 0xB2, 0x3D, 0x50, 0xAA, 0x1E, 0x31, 0x47,
-    0x5A, 0xA5, 0x2D, 0x35, 0xB5, 0xD5, 0x36, 0xB4, 0x23, 0x1D, 0x41, 0x2B, 0xCC, 0x21, 0x26, 0x5C,
-    0x1C, 0xA2, 0xB3, 0x25, 0x9D, 0x2B, 0x73, 0x21, 0x02, 0x98, 0x03, 0x54, 0x3B, 0xAB, 0x70, 0xC3,
-    0x3D, 0x9C, 0x5C, 0x9D, 0x89, 0x9F, 0xA5, 0x2A, 0x39, 0x3A, 0xAD, 0xC2, 0x56, 0x42, 0x3B, 0xE1,
-    0x63, 0x22, 0x25, 0x21, 0x98, 0xF5, 0x1A, 0x1B, 0xFA, 0x01, 0x99, 0xC6, 0x3B, 0xB6, 0xD1, 0x23,
-    0xC3, 0xAB, 0x4A, 0xD8, 0xA5, 0x90, 0x4B, 0x2D, 0xC8, 0x4A, 0x68, 0x23, 0x2C, 0x46, 0xE4, 0xAB,
-    0x11, 0xCD, 0x60, 0xD3, 0xAF, 0x24, 0xDE, 0xE2, 0x3C, 0x65, 0x45, 0x24, 0xE6, 0x02, 0x05, 0xC3,
-    0xAF, 0xD4, 0x25, 0x5B, 0x6F, 0x9D, 0x7D, 0x7F, 0xF6, 0xB7, 0xB3, 0x25, 0x6B, 0x33, 0xFB, 0xB6,
-    0xBD, 0x6A, 0xBB, 0x72, 0x48, 0xC7, 0x9C, 0x1D, 0xC5, 0xEC, 0x16, 0x1F, 0x0A, 0x72, 0x00, 0xC5,
-    0xA7, 0xE1, 0x43, 0xAF, 0xBE, 0xE2, 0x4F, 0xAF, 0xEA, 0x8B, 0xCB, 0xAD, 0xCC, 0x15, 0x9C, 0x45,
-    0xFE, 0xB4, 0xD3, 0x93, 0xF9, 0xDC, 0x4F, 0x29, 0x5E, 0x2E, 0xD6, 0x87, 0xD3, 0xDD, 0x0F, 0xF6,
-    0xAF, 0x71, 0x66, 0x67, 0x65, 0xED, 0x9E, 0x3E, 0x48, 0x60, 0x30, 0x11, 0x14, 0x35, 0xB8, 0xBF,
-    0xCC, 0x0D, 0x7F, 0x9D, 0x74, 0x7F, 0xBD, 0xBC, 0x1E, 0x08, 0x48, 0x1C, 0x40, 0xE8, 0x07, 0xCE,
-    0x9F, 0x83, 0x2C, 0x77, 0x50, 0x96, 0x1D, 0x65, 0x99, 0x3B, 0xF1, 0x2E, 0xA9, 0x89, 0x7B, 0x53,
-    0x29, 0xB3, 0x15, 0x7C, 0x42, 0x54, 0xA3, 0x88, 0x00, 0x74, 0x87, 0x70, 0xF4, 0xA0, 0x29, 0x0C,
-    0x34, 0x08, 0x15, 0x40, 0x11, 0xD1, 0x5A, 0x47, 0x45, 0x95, 0x20, 0xAA, 0x12, 0x48, 0x55, 0x0E,
-    0x53, 0x1D, 0x54, 0x3A, 0xAC, 0x9C, 0xC0, 0x92, 0x68, 0x79, 0x2D, 0x77, 0xC0, 0xCA, 0x88, 0x1A,
-    0x52, 0xE4, 0x0F, 0x2B, 0xB6, 0x20, 0xE0, 0xC2, 0x43, 0xD5, 0xE4, 0x60, 0x72, 0x87, 0x95, 0x3B,
-    0x10, 0x2C, 0xE4, 0xF1, 0x6A, 0x59, 0x13, 0x60, 0x1D, 0xC2, 0x82, 0xB8, 0xDB, 0x66, 0xFD, 0xB1,
-    0xC4, 0x1C, 0xA8, 0xF0, 0x8D, 0x78, 0x24, 0x98, 0xB4, 0x38, 0xE7, 0x8B, 0xC0, 0xB3, 0xE8, 0x4B,
-    0xF9, 0xA2, 0x5A, 0xFE, 0x90, 0x54, 0xA5, 0xA1, 0xF1, 0x2A, 0x0D, 0xD7, 0x97, 0x14, 0xA1, 0x09,
-    0x10, 0xE1, 0x14, 0x3F, 0x22, 0x70, 0x4A, 0x6C, 0xE6, 0x64, 0x57, 0xA9, 0x97, 0x4E, 0xB8, 0x13,
-    0x88, 0x8D, 0x02, 0xD8, 0xE3, 0xEE, 0x1E, 0x40, 0x66, 0x7F, 0x0E, 0xE3, 0x74, 0x42, 0xC9, 0xE7,
-    0x1C, 0x43, 0x9D, 0x38, 0x8A, 0x19, 0xE6, 0x29, 0xD8, 0x13, 0x08, 0xAD, 0x50, 0x3F, 0x12, 0x05,
-    0xBA, 0x41, 0x1A, 0x24, 0x27, 0x0C, 0x85, 0xC7, 0x24, 0x81, 0x40, 0x39, 0xE7, 0x1B, 0x8C, 0xB2,
-    0x36, 0x11, 0xB8, 0x0F, 0xA7, 0xD5, 0x64, 0x1F, 0xA1, 0xB3, 0xB2, 0xB0, 0x08, 0xB6, 0x38, 0xEA,
-    0x48, 0x56, 0x81, 0x0E, 0x5A, 0x17, 0x74, 0xD1, 0xD4, 0x8B, 0x5C, 0x5F, 0xD3, 0x8E, 0x7B, 0x90,
-    0x16, 0x01, 0xED, 0x0A, 0x61, 0xBF, 0x8B, 0x2E, 0xE2, 0x21, 0x14, 0x1B, 0x2E, 0x7A, 0x9E, 0x35,
-    0x34, 0xB3, 0x80, 0xFC, 0x31, 0xAB, 0x22, 0xD2, 0x6A, 0xF6, 0x11, 0x8C, 0xBB, 0x0D, 0x17, 0x1B,
-    0x3E, 0x1B, 0xD7, 0xF9, 0x46, 0x57, 0x4A, 0xF3, 0x4C, 0x4B, 0xC2, 0xC1, 0x8B, 0xB1, 0x00, 0x69,
-    0x9B, 0xD9, 0xB7, 0x4C, 0x68, 0xCD, 0x94, 0x9C, 0x01, 0xFA, 0x8D, 0x10, 0x79, 0x17, 0x76, 0xBA,
-    0x62, 0x74, 0xB4, 0x88, 0x75, 0x7D, 0x1C, 0x97, 0x02, 0xF3, 0x3F, 0x37, 0x11, 0xEE, 0xB4, 0x00,
-    0xEA, 0x6B, 0x25, 0x46, 0x04, 0x4F, 0x75, 0xA4, 0xF3, 0xF2, 0x2D, 0x53, 0xFC, 0xF7, 0x13, 0x92,
-    0x61, 0x50, 0x8E, 0x60, 0x38, 0x51, 0x94, 0x2E, 0x2D, 0x62, 0xB6, 0xE2, 0x1C, 0x27, 0xDD, 0x67,
-    0x8D, 0xBE, 0x60, 0xBC, 0x11, 0x76, 0xF6, 0x29, 0x06, 0x8C, 0xBF, 0xAE, 0x62, 0x3E, 0x08, 0x73,
-    0x6B, 0xFB, 0x0B, 0x3C, 0x1B, 0xE8, 0x80, 0x89, 0x91, 0x05, 0x6E, 0xA5, 0x57, 0xAD, 0xC9, 0xEC,
-    0xB5, 0x0F, 0x2A, 0x9F, 0x54, 0xDA, 0x93, 0xDF, 0xB5, 0x0C, 0xA8, 0xD6, 0x6A, 0x84, 0xD7, 0x6F,
-    0xB4, 0xCF, 0x10, 0xF8, 0xB0, 0x03, 0x23, 0x2A, 0x2B, 0xF4, 0xA6, 0xD6, 0x87, 0x10, 0xEE, 0xEE,
-    0x07, 0xEE, 0x22, 0x88, 0xCE, 0x21, 0x73, 0x10, 0x51, 0x00, 0x0F, 0xC3, 0x5E, 0x7C, 0x29, 0xB1,
-    0x34, 0x2E, 0xF2, 0x1C, 0x45, 0x5E, 0x41, 0x03, 0xA5, 0x05, 0x9F, 0x50, 0xDB, 0xB1, 0x48, 0x09,
-    0x5D, 0x7E, 0x65, 0x1D, 0xE1, 0x21, 0xCD, 0x39, 0x49, 0xF9, 0xC1, 0x36, 0x84, 0x7F, 0xA3, 0x01,
-    0xC9, 0x8B, 0x2F, 0x80, 0xFD, 0xB4, 0x70, 0x1D, 0x27, 0x11, 0x28, 0x7D, 0x03, 0xB2, 0xF2, 0x72,
-    0x0E, 0x38, 0x05, 0x76, 0x80, 0xC8, 0x1E, 0x1A, 0x92, 0x2A, 0x3B, 0xD2, 0xC4, 0x97, 0x30, 0x55,
-    0x86, 0x59, 0x05, 0x11, 0x8C, 0x7E, 0x53, 0xFF, 0xEF, 0x8F, 0x21, 0x7F, 0x04, 0x92, 0xB9, 0x5A,
-    0x92, 0x48, 0xD6, 0x53, 0x3A, 0xC0, 0x72, 0xFA, 0x36, 0x02, 0x37, 0x7E, 0x14, 0xB3, 0xC9, 0x5E,
-    0x57, 0x26, 0x39, 0x0D, 0x94, 0xEB, 0x35, 0x60, 0xD4, 0xBF, 0x3E, 0xD0, 0x81, 0x52, 0x4D, 0x54,
-    0xB9, 0xFC, 0x56, 0x8B, 0x29, 0x68, 0x1A, 0xE6, 0x0A, 0x5C, 0xAD, 0xCF, 0xAB, 0xB1, 0x5E, 0xBA,
-    0xD5, 0x2B, 0x16, 0x24, 0xB5, 0xAC, 0xA8, 0x06, 0x9B, 0x29, 0x34, 0xCF, 0x0E, 0xCC, 0xF6, 0x0C,
-    0x51, 0xFF, 0x35, 0xC5, 0x09, 0xA3, 0x07, 0x08, 0xB2, 0x51, 0x7F, 0x36, 0x7A, 0x20, 0x80, 0x75,
-    0x7C, 0x65, 0x08, 0x11, 0x4F, 0x23, 0x12, 0xEB, 0x39, 0xEE, 0x6C, 0x8C, 0x41, 0x65, 0x77, 0xDB,
-    0x4A, 0xE7, 0x59, 0x91, 0xD4, 0x69, 0x13, 0x76, 0x69, 0xEF, 0x01, 0x51, 0x95, 0x5E, 0xC6, 0x09,
-    0x1B, 0x37, 0xA1, 0x0D, 0x7A, 0xB0, 0x08, 0x9C, 0xC0, 0x15, 0x65, 0x97, 0x0E, 0xBC, 0xC5, 0xF1,
-    0xDB, 0xD4, 0x87, 0x33, 0xAD, 0xE1, 0xA3, 0x46, 0x3C, 0x28, 0x19, 0xD7, 0x53, 0x61, 0x58, 0xE4,
-    0x21, 0x1B, 0x62, 0x0B, 0xB6, 0xCE, 0xFB, 0x4A, 0xF4, 0x5C, 0xA2, 0xE7, 0x12, 0x3D, 0x9F, 0xC4,
-    0x09, 0x83, 0x9E, 0x0D, 0x7A, 0x36, 0xE8, 0x19, 0x57, 0xC0, 0x49, 0x97, 0x1D, 0x6F, 0xA1, 0xA7,
-    0xCD, 0xC6, 0xA0, 0xC3, 0xAD, 0x3D, 0xC6, 0xF1, 0xFB, 0xB0, 0xCB, 0x54, 0xD8, 0x9D, 0x54, 0xE1,
-    0xF5, 0x1E, 0x51, 0x85, 0x51, 0x21, 0x58, 0x24, 0x7A, 0xC9, 0x71, 0xBE, 0xC2, 0xEF, 0x4D, 0x8A,
-    0xEB, 0x70, 0xBD, 0xDC, 0x07, 0xCD, 0xA0, 0x76, 0xF4, 0x6A, 0x7F, 0x52, 0xAB, 0x7D, 0xD3, 0x71,
-    0x12, 0xC7, 0x6F, 0x70, 0xF4, 0x38, 0xBA, 0xA4, 0xFE, 0x66, 0x9B, 0xD4, 0x30, 0xF7, 0x06, 0x36,
-    0x6C, 0xF4, 0x2E, 0x6B, 0xA8, 0xAE, 0xCC, 0x04, 0xF4, 0x65, 0x87, 0x31, 0x20, 0xC8, 0x31, 0x1E,
-    0x86, 0xD2, 0x86, 0x97, 0x0F, 0x5F, 0xAE, 0x12, 0xFD, 0x5D, 0xAD, 0xF6, 0x1F, 0xB8, 0x86, 0x08,
-    0xD0, 0x9E, 0x6D, 0xC3, 0xF3, 0x58, 0xD5, 0x64, 0x77, 0x8B, 0x53, 0xD1, 0x4E, 0x13, 0xC2, 0x2A,
-    0x86, 0x0C, 0x17, 0xF7, 0x94, 0xC5, 0x11, 0x88, 0xAF, 0x86, 0x70, 0xAA, 0xA4, 0x46, 0xAC, 0xC8,
-    0x50, 0xD6, 0x1E, 0xA7, 0x96, 0x22, 0x08, 0xF9, 0xE8, 0x45, 0x77, 0x02, 0x0A, 0x4E, 0xF1, 0x55,
-    0x65, 0xEF, 0xC4, 0x57, 0xD0, 0x6C, 0x7D, 0xC9, 0xF9, 0x20, 0x54, 0x4B, 0x30, 0xB4, 0x04, 0xDC,
-    0x89, 0xF4, 0xDC, 0xD2, 0x0B, 0xD1, 0x05, 0xF1, 0x2B, 0x5C, 0x66, 0x38, 0x26, 0x6D, 0x24, 0x79,
-    0x39, 0x20, 0xE1, 0x92, 0x28, 0x38, 0xD6, 0x0B, 0x7D, 0xEB, 0x42, 0x43, 0xAA, 0x10, 0x62, 0xE7,
-    0x84, 0xA8, 0xDC, 0x02, 0xDE, 0x74, 0xA2, 0xE4, 0x42, 0x8C, 0x09, 0xD6, 0x2B, 0xDF, 0xE2, 0xD9,
-    0x5F, 0x8E, 0xE8, 0x6A, 0x0C, 0xED, 0x09, 0xE0, 0x6E, 0xDC, 0x81, 0x2E, 0x34, 0xA5, 0xD2, 0x87,
-    0x60, 0x8B, 0x60, 0x48, 0x7D, 0x8A, 0xF1, 0x97, 0xC0, 0xE2, 0x71, 0x2F, 0x88, 0x32, 0xBD, 0x7C,
-    0xA7, 0xCA, 0x25, 0x00, 0x05, 0x60, 0xBD, 0x15, 0x0E, 0x17, 0xE2, 0xCC, 0x93, 0xC7, 0x01, 0x3A,
-    0xD4, 0x75, 0xDA, 0x50, 0x93, 0x5D, 0x30, 0x10, 0x68, 0xDC, 0x3E, 0x46, 0x84, 0xB4, 0xC2, 0xC6,
-    0xC0, 0xF7, 0x10, 0xDD, 0x29, 0x7D, 0xFD, 0x3F, 0x22, 0x31, 0x55, 0xEA, 0x7A, 0x26, 0x96, 0x60,
-    0x2F, 0xBD, 0x3F, 0x26, 0x47, 0x76, 0xF7, 0xDB, 0xB7, 0xC7, 0x4D, 0xBB, 0x39, 0x3B, 0xA8, 0xA8,
-    0x9D, 0x41, 0x2F, 0xE8, 0xC0, 0xE4, 0x1D, 0xBF, 0x22, 0x48, 0xF2, 0x2C, 0x23, 0x85, 0xD8, 0x26,
-    0x60, 0x2C, 0x05, 0x10, 0xB5, 0x48, 0x40, 0xEA, 0x41, 0x4B, 0x1B, 0x55, 0xEE, 0x86, 0x2F, 0x6B,
-    0x88, 0x5D, 0x6F, 0xE2, 0x06, 0x4D, 0xD3, 0x00, 0xFE, 0x32, 0xD4, 0x24, 0xC1, 0x24, 0x0F, 0x41,
-    0x64, 0xEA, 0xC1, 0x25, 0x7A, 0x1F, 0x30, 0x07, 0x41, 0xA6, 0x8A, 0xC3, 0x77, 0xB9, 0x67, 0x66,
-    0x33, 0x98, 0x42, 0xF2, 0xC4, 0xA3, 0x48, 0x16, 0x8C, 0xFA, 0xCA, 0xE7, 0xCB, 0x00, 0xA2, 0x29,
-    0x65, 0x51, 0xA4, 0x97, 0x56, 0xED, 0xC1, 0x21, 0x6E, 0xB0, 0x10, 0xD9, 0x41, 0x50, 0xB8, 0x31,
-    0xE8, 0xF1, 0x7F, 0x7C, 0x09, 0xFA, 0x9A, 0x1D, 0xE1, 0x29, 0x06, 0xB4, 0x6D, 0xF6, 0xBB, 0x55,
-    0x4A, 0x00, 0x74, 0xE5, 0x29, 0x3E, 0xE8, 0xC6, 0xBE, 0x94, 0x3E, 0x3A, 0x11, 0xC5, 0xBF, 0x3C,
-    0x0E, 0x0B, 0x83, 0xA6, 0x64, 0xA0, 0x67, 0xA1, 0x49, 0x2A, 0x7F, 0xCC, 0x1C, 0x71, 0x4B, 0xBB,
-    0x29, 0x75, 0x80, 0x7B, 0x4E, 0xE1, 0xC9, 0x7D, 0x99, 0x03, 0x4F, 0x6B, 0x44, 0xC1, 0xA6, 0xEC,
-    0xC9, 0x84, 0x53, 0x28, 0xD5, 0x39, 0x8B, 0xC5, 0x04, 0x6E, 0xC1, 0x47, 0x15, 0x77, 0xFA, 0xD0,
-    0x87, 0xBD, 0x3F, 0xE7, 0xCF, 0x15, 0xB3, 0x03, 0x73, 0x1A, 0x26, 0x03, 0xA2, 0xA9, 0x3E, 0x5D,
-    0x1A, 0xFC, 0xD7, 0x6B, 0x00, 0x1A, 0x95, 0x74, 0xFD, 0x80, 0xC5, 0xD4, 0x3E, 0xB1, 0x73, 0xEB,
-    0x32, 0x13, 0xFF, 0xEE, 0x40, 0xDC, 0x04, 0x74, 0x34, 0xD9, 0xA0, 0xAF, 0xD9, 0xD6, 0x5E, 0xB1,
-    0x67, 0x81, 0xC0, 0x80, 0xDE, 0xCE, 0x23, 0x0A, 0xD7, 0x82, 0xC4, 0x39, 0xD1, 0x78, 0x50, 0xB7,
-    0x3B, 0xBD, 0x73, 0x08, 0x11, 0x6C, 0xCF, 0xC7, 0x04, 0x50, 0x7C, 0x00, 0x5D, 0x49, 0xC2, 0xCA,
-    0xED, 0x24, 0x44, 0xC2, 0x0A, 0x52, 0x01, 0xA1, 0x7D, 0xB2, 0xBC, 0x42, 0x42, 0xBD, 0x3C, 0x63,
-    0xF4, 0x86, 0x6B, 0x76, 0x60, 0x16, 0xDB, 0x71, 0x6C, 0x4B, 0x2E, 0xE6, 0x8F, 0x30, 0x15, 0xC0,
-    0x54, 0x02, 0x1C, 0x8C, 0xA2, 0x8A, 0xCB, 0x71, 0x6E, 0x84, 0x1F, 0x80, 0xA5, 0x3A, 0x82, 0x91,
-    0xD9, 0x3C, 0xB1, 0x67, 0x98, 0xBF, 0x01, 0xEE, 0x90, 0xC0, 0x68, 0x32, 0x97, 0xF0, 0xDA, 0x22,
-    0x3F, 0xDA, 0x26, 0xA5, 0x9C, 0x76, 0x0D, 0x74, 0x98, 0xF8, 0xD8, 0xA5, 0xA7, 0xF1, 0x71, 0x97,
-    0x7C, 0xD4, 0x87, 0x10, 0x8F, 0xDB, 0xB6, 0xC4, 0x3C, 0xFB, 0x84, 0xC2, 0x77, 0x9D, 0x11, 0x6F,
-    0x43, 0x66, 0x3D, 0x72, 0x60, 0xD6, 0x22, 0xBB, 0x08, 0xE9, 0xC6, 0x76, 0x63, 0x8A, 0x69, 0x85,
-    0x5B, 0x79, 0x23, 0xC5, 0x32, 0x6D, 0x8C, 0x6C, 0x85, 0xC8, 0xD9, 0x4F, 0x3D, 0x84, 0xE6, 0x09,
-    0xE6, 0x7E, 0x62, 0x38, 0x4F, 0xD0, 0x88, 0x51, 0x6D, 0xD5, 0x07, 0x55, 0x72, 0xA1, 0x8E, 0x26,
-    0xD0, 0x0E, 0x71, 0x83, 0x24, 0x48, 0xD0, 0x06, 0xF4, 0xB0, 0x45, 0x36, 0x88, 0x4B, 0xCC, 0xED,
-    0x8B, 0xBD, 0xF4, 0x5D, 0xE1, 0x21, 0x01, 0x81, 0xB0, 0xC0, 0x17, 0xB0, 0x11, 0x13, 0xAE, 0x96,
-    0xFC, 0x28, 0x67, 0x3B, 0x68, 0x58, 0x01, 0xE0, 0x7B, 0xB1, 0x05, 0x72, 0x32, 0x0F, 0x07, 0xAA,
-    0x35, 0x39, 0x7A, 0x7A, 0x55, 0x52, 0xC1, 0x72, 0x77, 0x0F, 0x6D, 0x07, 0xA7, 0xCB, 0x0A, 0x28,
-    0xBA, 0x08, 0x93, 0x24, 0xCC, 0x90, 0x1E, 0x43, 0x64, 0xBB, 0x7B, 0x44, 0x39, 0x06, 0x3E, 0xA7,
-    0xDB, 0xAC, 0xDC, 0x26, 0x11, 0x5C, 0x60, 0x52, 0x89, 0xCE, 0x21, 0xBA, 0x52, 0xC5, 0x9C, 0x38,
-    0x94, 0x4C, 0x7E, 0x55, 0x63, 0xD4, 0xC1, 0x4D, 0x67, 0x45, 0x06, 0xA7, 0x4C, 0x7F, 0x38, 0xCE,
-    0x31, 0xC2, 0xB3, 0xFF, 0xF6, 0x46, 0xC6, 0x39, 0x0F, 0xCC, 0xF5, 0x4C, 0x9B, 0x43, 0x7A, 0x4F,
-    0x13, 0x9F, 0xE9, 0x54, 0x2E, 0x5D, 0x03, 0x37, 0x10, 0xF0, 0xC0, 0x49, 0x07, 0x7D, 0x7A, 0x0E,
-    0x8E, 0x62, 0x54, 0xA3, 0x73, 0xEE, 0x97, 0x7A, 0x87, 0x35, 0xB5, 0x0A, 0xC7, 0x7F, 0x41, 0x50,
-    0xDB, 0x31, 0x2E, 0xA0, 0x50, 0x36, 0x2B, 0x0F, 0x61, 0x1C, 0x41, 0x21, 0x84, 0x49, 0x2E, 0x5F,
-    0x3F, 0xC6, 0xE0, 0x94, 0xD2, 0x14, 0x0C, 0xBB, 0x22, 0x81, 0x4B, 0x01, 0xAA, 0xE2, 0xC3, 0x63,
-    0x44, 0x5D, 0xD4, 0x23, 0x1E, 0x6C, 0xCA, 0x1C, 0x2B, 0x08, 0xFC, 0x83, 0x2D, 0xE1, 0xEB, 0x25,
-    0xE0, 0xF8, 0x8B, 0xF6, 0xD0, 0x3C, 0xAD, 0x57, 0xF0, 0x4E, 0xF6, 0x49, 0xD7, 0x96, 0x62, 0x6A,
-    0x5E, 0x21, 0x36, 0x75, 0x4A, 0x42, 0x9D, 0x14, 0xD8, 0x32, 0xF7, 0x77, 0xF7, 0x40, 0x3B, 0x1C,
-    0x7A, 0x82, 0xD9, 0xF6, 0x59, 0x71, 0x2A, 0xA9, 0x62, 0x92, 0x83, 0xF1, 0x3F, 0x49, 0x1E, 0xB3,
-    0x8F, 0x0B, 0xF9, 0x82, 0xAB, 0x57, 0x7F, 0xE2, 0x98, 0x42, 0x41, 0x7A, 0x39, 0x83, 0xF6, 0x1E,
-    0x1A, 0x6D, 0x5C, 0xED, 0xD7, 0xEA, 0x0A, 0x69, 0x2E, 0xA2, 0x73, 0x18, 0x7C, 0x97, 0xEB, 0x4F,
-    0x8A, 0xAC, 0xCC, 0x87, 0xD2, 0xBE, 0x0F, 0x4D, 0x21, 0xA1, 0xC8, 0x61, 0x30, 0x25, 0x50, 0xDD,
-    0x3B, 0x2A, 0xA3, 0x2A, 0x1B, 0xDD, 0x83, 0x4F, 0xC2, 0x4F, 0x34, 0x61, 0xEF, 0xAD, 0x7F, 0xC0,
-    0xBD, 0x04, 0xAD, 0xF0, 0x5C, 0x6F, 0xD3, 0xB7, 0x3F, 0x30, 0x9B, 0x3D, 0xB9, 0xDA, 0x87, 0x82,
-    0x82, 0xDE, 0x16, 0x44, 0x95, 0x9B, 0x1B, 0xA2, 0x51, 0x07, 0x0C, 0x4D, 0xAB, 0xB8, 0x83, 0xBB,
-    0xFD, 0x36, 0xAF, 0xDF, 0x0C, 0x17, 0x0E, 0xCD, 0xAB, 0xA2, 0x16, 0x52, 0x2A, 0xF1, 0xD3, 0x8D,
-    0x1F, 0x18, 0xC6, 0x64, 0xF0, 0xB6, 0xBA, 0x8D, 0x8E, 0x2A, 0x71, 0xCC, 0xA1, 0x30, 0x99, 0xFD,
-    0x88, 0x6B, 0xD5, 0x3E, 0x36, 0x27, 0xD3, 0x8B, 0x6C, 0x80, 0xA1, 0x7D, 0xFA, 0x89, 0x41, 0xB3,
-    0x32, 0x78, 0x50, 0xE1, 0xE1, 0x9B, 0x2D, 0x1A, 0xDD, 0xA4, 0xA7, 0x4D, 0x59, 0x95, 0xB6, 0x87,
-    0x6E, 0xDB, 0xA3, 0x42, 0x2C, 0xC5, 0x91, 0x05, 0x80, 0x45, 0x50, 0xA1, 0x8E, 0x68, 0x4B, 0x0F,
-    0xC7, 0x8F, 0xAB, 0x34, 0x31, 0x2B, 0x46, 0x36, 0x62, 0x16, 0xAF, 0x96, 0x87, 0x98, 0x02, 0xEE,
-    0x89, 0x22, 0xD9, 0x41, 0xF9, 0x98, 0x9D, 0xB6, 0x0D, 0x0D, 0x6E, 0x4C, 0x26, 0x93, 0x13, 0xB2,
-    0xF4, 0xD4, 0xE0, 0x9C, 0x88, 0x04, 0xF9, 0x50, 0x18, 0x2C, 0x8C, 0x61, 0xE0, 0x82, 0xC5, 0xAD,
-    0x9C, 0xCA, 0xF8, 0x1C, 0x38, 0x74, 0x86, 0x0C, 0xBD, 0x86, 0xD2, 0x74, 0xFE, 0x40, 0x19, 0xE7,
-    0x3A, 0x87, 0xBA, 0xE0, 0x44, 0x28, 0x27, 0x7C, 0x8C, 0xE9, 0x0A, 0x7C, 0x9C, 0x71, 0xDB, 0x7E,
-    0xFB, 0x5D, 0x98, 0xC6, 0x3C, 0x29, 0x53, 0x09, 0x5E, 0x31, 0x57, 0x93, 0xAF, 0x4C, 0x6E, 0xD4,
-    0xD7, 0x88, 0x7A, 0xD5, 0xE4, 0x63, 0xE8, 0x2C, 0x7D, 0x22, 0xDE, 0x13, 0xEB, 0x8C, 0xEB, 0xBE,
-    0x78, 0xDC, 0x3E, 0x74, 0x9D, 0xEE, 0x6E, 0x65, 0x28, 0x4A, 0xF7, 0x6B, 0x9D, 0xC2, 0x11, 0xC0,
-    0xD8, 0xC7, 0x88, 0xA3, 0x38, 0xC5, 0x28, 0x82, 0x39, 0xC3, 0xC2, 0x1F, 0x98, 0xCC, 0x3F, 0x0C,
-    0xEA, 0x77, 0x15, 0xEB, 0x49, 0x8E, 0x4A, 0xE6, 0x16, 0xDA, 0x69, 0x13, 0x08, 0x68, 0xA0, 0xE0,
-    0xAD, 0x1F, 0x09, 0xD0, 0xDF, 0xCF, 0x3A, 0x38, 0x12, 0xD2, 0xD7, 0x6E, 0x02, 0x6D, 0x3A, 0xB6,
-    0x3D, 0xF6, 0x39, 0x2C, 0x52, 0x4E, 0xFA, 0x92, 0x88, 0x83, 0xF3, 0x06, 0x2A, 0xE7, 0x17, 0x4E,
-    0x80, 0xE0, 0x94, 0x93, 0x07, 0x71, 0x81, 0x6E, 0x36, 0x09, 0xC1, 0x6F, 0xA6, 0x0D, 0xEB, 0x97,
-    0x8E, 0x33, 0xA3, 0x44, 0x51, 0xF3, 0xC1, 0xC4, 0xA0, 0x4C, 0x12, 0xF7, 0x50, 0x83, 0xE0, 0xC3,
-    0xF2, 0xFB, 0x5D, 0xBC, 0x13, 0x71, 0xDD, 0x36, 0x44, 0x09, 0x6E, 0x54, 0x88, 0x66, 0x48, 0x18,
-    0x98, 0xB5, 0xBD, 0xCE, 0x5D, 0xBE, 0x8A, 0x31, 0x10, 0xF7, 0x7D, 0x19, 0xF4, 0x86, 0x0C, 0xD1,
-    0xD2, 0xDF, 0xDA, 0x5C, 0xD4, 0x34, 0x9D, 0xC7, 0x8A, 0xEA, 0x49, 0xA0, 0x00, 0xCC, 0x96, 0x87,
-    0x68, 0x05, 0x8E, 0x4C, 0xA0, 0xDB, 0xB6, 0xDB, 0xD2, 0x15, 0x1E, 0xCD, 0x16, 0x39, 0xFF, 0x3F,
-    0xB4, 0x6B, 0xDC, 0xF9, 0x8E, 0xC1, 0x35, 0xA3, 0x3B, 0x4E, 0x93, 0x8A, 0xD3, 0x39, 0x3B, 0x83,
-    0xBC, 0x31, 0x5B, 0x98, 0xAF, 0x65, 0x0B, 0x43, 0x03, 0x47, 0x91, 0xBD, 0xCB, 0x30, 0x81, 0x3E,
-    0xEE, 0x3D, 0xC6, 0x1A, 0xF6, 0xD5, 0x99, 0x66, 0xDA, 0xD0, 0x94, 0x85, 0x64, 0x0B, 0xA1, 0x16,
-    0xAD, 0xBA, 0x55, 0xB6, 0x70, 0x23, 0x95, 0xEC, 0xE3, 0x0E, 0x90, 0x02, 0xA0, 0x4E, 0xCF, 0x0C,
-    0xB3, 0x32, 0xA6, 0xF4, 0x5E, 0xDD, 0x2B, 0x5F, 0x0D, 0xA2, 0x25, 0x84, 0x6C, 0x1B, 0xA9, 0x24,
-    0xC2, 0x56, 0xAF, 0x43, 0x2C, 0x17, 0x19, 0xD0, 0xB4, 0x64, 0x60, 0x9A, 0x99, 0x3B, 0x6F, 0x9A,
-    0xC1, 0x4A, 0x49, 0x16, 0x47, 0x16, 0x45, 0xC1, 0xDB, 0x5D, 0x54, 0x8B, 0x33, 0xCC, 0xBE, 0x9C,
-    0x61, 0xAC, 0xFF, 0x0E, 0xEE, 0x8F, 0x3F, 0xE1, 0x06, 0x10, 0x85, 0x12, 0x52, 0xF6, 0x01, 0x35,
-    0xC9, 0x17, 0x67, 0xB2, 0x21, 0x0C, 0x80, 0xEB, 0xAD, 0xD2, 0x0B, 0xB6, 0x49, 0xFA, 0xAC, 0x8E,
-    0xE1, 0xDB, 0x82, 0xAB, 0xE0, 0x97, 0x10, 0x11, 0x42, 0x86, 0xA0, 0x3F, 0x00, 0xB5, 0x00, 0x86,
-    0x26, 0xEF, 0x31, 0x14, 0x63, 0xF6, 0x8E, 0xD9, 0x35, 0x3C, 0xC8, 0x9F, 0x72, 0x1A, 0x2A, 0xCA,
-    0x7F, 0x4A, 0x03, 0xE2, 0xAA, 0x0F, 0xCB, 0x54, 0x2C, 0xF1, 0xAF, 0x33, 0xF5, 0x90, 0x53, 0xEB,
-    0x3D, 0xFB, 0x94, 0x49, 0xC8, 0xD6, 0x18, 0x8D, 0x4D, 0x71, 0x77, 0x43, 0x85, 0x8C, 0x30, 0xBD,
-    0x8D, 0x5B, 0xFE, 0x69, 0xC0, 0xDD, 0x9D, 0x5B, 0xC5, 0x3F, 0x1D, 0x59, 0x1F, 0xE2, 0x1F, 0x26,
-    0x94, 0x34, 0x40, 0x35, 0xA9, 0x10, 0xFF, 0xB4, 0x88, 0x7F, 0xCC, 0xCD, 0xF1, 0x8F, 0x91, 0xF8,
-    0x07, 0x4F, 0xED, 0xF4, 0x38, 0xED, 0x69, 0xF2, 0x69, 0x7C, 0x98, 0x3C, 0xEB, 0xE9, 0x2F, 0xE4,
-    0x3E, 0xBE, 0x33, 0x1E, 0x63, 0xA0, 0xF9, 0x95, 0x72, 0x1F, 0x9B, 0x80, 0x71, 0xCC, 0xB3, 0x89,
-    0x1E, 0x47, 0xDC, 0xA1, 0xEE, 0x36, 0xD9, 0x7F, 0x9F, 0xBE, 0xF8, 0xC3, 0x12, 0xB0, 0xAE, 0x4E,
-    0x3F, 0x1F, 0xC0, 0x45, 0x0F, 0x41, 0x52, 0x4C, 0x5F, 0xAE, 0x8C, 0x80, 0xD6, 0x54, 0x48, 0xAE,
-    0xBA, 0x73, 0xE6, 0xF8, 0x33, 0x7C, 0xD7, 0xED, 0x7A, 0xE6, 0xF8, 0x17, 0x05, 0x46, 0x91, 0xDF,
-    0x32, 0x73, 0xFC, 0xE5, 0xC1, 0xC8, 0x59, 0xB0, 0xB4, 0xC7, 0x2C, 0x62, 0xFB, 0xCE, 0x05, 0x23,
-    0xF0, 0x2C, 0x4B, 0x6F, 0x40, 0x35, 0xEA, 0x9B, 0x83, 0x11, 0x81, 0xD7, 0x1D, 0xE8, 0xFF, 0xFD,
-    0xD9, 0xEC, 0x54, 0x26, 0x5B, 0x77, 0x43, 0x30, 0xCC, 0x98, 0xE5, 0xE2, 0x63, 0xBF, 0xEC, 0xAF,
-    0x41, 0x72, 0xAB, 0x6B, 0x79, 0xA6, 0x6F, 0x88, 0x5F, 0xCF, 0x32, 0x26, 0x17, 0x6D, 0xD8, 0x2F,
-    0xC0, 0xFB, 0xDD, 0xF2, 0xFF, 0x94, 0x69, 0xEF, 0xEA, 0xCE, 0xBB, 0x85, 0x8F, 0x8F, 0xDC, 0x05,
-    0xAC, 0x3D, 0x7D, 0xF1, 0x4E, 0xBB, 0x85, 0x8E, 0x3A, 0x34, 0xFA, 0x60, 0x9F, 0x34, 0xDB, 0x85,
-    0x3A, 0x88, 0x37, 0x38, 0x71, 0xFD, 0x8B, 0xD4, 0x81, 0x8F, 0xA3, 0x4D, 0xCB, 0xD6, 0x2A, 0x2D,
-    0x1D, 0xF2, 0xA5, 0x8A, 0xBF, 0x2C, 0x7D, 0xB2, 0xEF, 0xC0, 0x4A, 0xAF, 0xB8, 0xFC, 0x63, 0x0B,
-    0x3C, 0x0B, 0x5D, 0x62, 0xC7, 0xBA, 0x2C, 0x0F, 0xF7, 0x7C, 0x2C, 0x07, 0xFE, 0xB6, 0x6D, 0xB9,
-    0x33, 0x47, 0x49, 0x72, 0xDF, 0x36, 0xA2, 0x89, 0x33, 0x26, 0xF9, 0x70, 0xCE, 0x65, 0x0A, 0xE2,
-    0x93, 0xCE, 0x41, 0xC7, 0x83, 0x8A, 0x71, 0x55, 0x72, 0x91, 0x0E, 0xB6, 0xF3, 0x6C, 0xD9, 0x81,
-    0x9B, 0x83, 0x9D, 0xA7, 0xB5, 0x56, 0xFA, 0x67, 0x36, 0x1F, 0xE9, 0xD0, 0x5C, 0xDC, 0x50, 0x3A,
-    0xE7, 0x04, 0x48, 0x85, 0x82, 0xA9, 0x03, 0x60, 0x5D, 0xFF, 0x9F, 0xDB, 0x88, 0x83, 0xDB, 0x46,
-    0x1C, 0x6E, 0x95, 0x25, 0x75, 0x11, 0x83, 0xFA, 0x9B, 0xC9, 0x56, 0x1F, 0x4A, 0x26, 0x46, 0xAF,
-    0x3F, 0x37, 0x68, 0x1C, 0x98, 0xB1, 0x85, 0x1B, 0x7F, 0x10, 0xFB, 0x9A, 0xDA, 0xCD, 0xE2, 0x07,
-    0xAD, 0xB8, 0x25, 0xAE, 0x9F, 0xA7, 0xEE, 0x31, 0xF5, 0x43, 0xFE, 0xB0, 0x4F, 0x6D, 0x3A, 0x20,
-    0xA0, 0xBD, 0x23, 0x57, 0x0F, 0x6D, 0x2B, 0x51, 0xB2, 0xCD, 0xA7, 0x28, 0x63, 0x56, 0x4C, 0x05,
-    0xFC, 0x16, 0xDF, 0x0F, 0x1F, 0x1A, 0xA7, 0xEE, 0xF6, 0x4F, 0x2B, 0xB9, 0x8D, 0xDB, 0x95, 0x18,
-    0xBD, 0x14, 0x9C, 0x24, 0x2D, 0x7C, 0x81, 0x64, 0x4B, 0x35, 0x1B, 0x56, 0x9C, 0xBC, 0xCE, 0x21,
-    0x5E, 0x25, 0x5A, 0x7E, 0xDA, 0x70, 0xFC, 0x35, 0x1B, 0x7E, 0xFD, 0x8C, 0x3F, 0x7C, 0xCA, 0x4B,
-    0xAE, 0x30, 0xEF, 0x4D, 0x07, 0x40, 0x63, 0x09, 0x98, 0xAF, 0xC5, 0x0C, 0x12, 0x10, 0x8F, 0x2A,
-    0x14, 0x05, 0x92, 0xD4, 0x1A, 0x44, 0x09, 0x1D, 0x81, 0x6D, 0x43, 0xFB, 0x5F, 0x0F, 0xAF, 0xC6,
-    0xB9, 0x67, 0xDE, 0x01, 0x7D, 0xF8, 0xA7, 0x5A, 0xF2, 0xA9, 0xE1, 0xA7, 0xCB, 0x3C, 0xD1, 0x2A,
-    0xFD, 0xF4, 0x08, 0x62, 0x01, 0x02, 0x06, 0x40, 0x94, 0x3A, 0x12, 0x86, 0xA5, 0x93, 0x70, 0xF3,
-    0x35, 0xE1, 0xEA, 0xF6, 0x3B, 0x23, 0x08, 0x94, 0xB5, 0xC9, 0xFD, 0xEE, 0xD3, 0x02, 0xD0, 0xB1,
-    0x54, 0xEE, 0x88, 0xDC, 0x81, 0xB8, 0x21, 0x6C, 0x97, 0xAF, 0xC7, 0x1D, 0x50, 0xBC, 0xE3, 0x5E,
-    0x57, 0xD4, 0x02, 0xF2, 0xFF, 0xD0, 0x01, 0xF6, 0xF1, 0xF7, 0x95, 0x01, 0xDF, 0x41, 0x02, 0x5A,
-    0x5D, 0x30, 0xE3, 0xA0, 0xF1, 0x84, 0x92, 0x6E, 0x1F, 0xD3, 0x04, 0xBE, 0xA8, 0xBF, 0xA7, 0x27,
-    0x49, 0x40, 0x6F, 0x10, 0x1D, 0x06, 0x1D, 0xD5, 0x60, 0x07, 0x9E, 0x5F, 0x05, 0x35, 0x37, 0xCE,
-    0x1E, 0x89, 0xB9, 0x73, 0xA6, 0x6C, 0x2C, 0x1B, 0xDD, 0xBD, 0x72, 0x25, 0x3C, 0xAE, 0x7C, 0x07,
-    0x53, 0x90, 0x9C, 0x86, 0xC0, 0x1B, 0x95, 0x2A, 0x6E, 0xE9, 0xCD, 0x69, 0x99, 0xC0, 0x2F, 0xF0,
-    0x83, 0x98, 0x66, 0xB9, 0x56, 0x58, 0xE2, 0xE5, 0xF4, 0x4A, 0x87, 0xE1, 0x6B, 0xC7, 0xF8, 0x15,
-    0xAC, 0x3E, 0xA2, 0x75, 0xA3, 0x5A, 0xFD, 0x7C, 0xA5, 0x76, 0x8E, 0xA7, 0x94, 0x28, 0x80, 0x4A,
-    0xDE, 0x21, 0xA0, 0x3C, 0x8F, 0x68, 0x71, 0x88, 0x49, 0xF9, 0xD3, 0x06, 0x44, 0x32, 0x03, 0x91,
-    0x6D, 0xB8, 0x1D, 0x84, 0xC9, 0xCB, 0xEE, 0x2E, 0x08, 0x60, 0x2C, 0x7B, 0x5B, 0xE5, 0xE8, 0x36,
-    0x69, 0xDD, 0xA6, 0xED, 0x17, 0x3E, 0xCA, 0xFE, 0x6E, 0x26, 0x09, 0xDF, 0xF1, 0xF8, 0x89, 0xEE,
-    0x76, 0xD7, 0x82, 0x91, 0x15, 0x92, 0x64, 0x3F, 0xC3, 0x7E, 0xC5, 0x82, 0x85, 0x3B, 0x4A, 0x56,
-    0xC5, 0xA5, 0x55, 0x54, 0xBF, 0x6E, 0xD1, 0x42, 0xBC, 0x0F, 0xC3, 0x81, 0x77, 0xA1, 0x64, 0xDA,
-    0x73, 0x2A, 0x2B, 0x3F, 0x7C, 0x2C, 0x3C, 0x0D, 0x1F, 0x5E, 0xD5, 0xD5, 0x0D, 0x3F, 0x21, 0xAA,
-    0x2D, 0x0D, 0xEF, 0xAA, 0x27, 0x84, 0x10, 0x72, 0x41, 0x6C, 0x0A, 0xD9, 0xF9, 0xB7, 0x64, 0x52,
-    0x6E, 0xCF, 0xDA, 0x9E, 0xE6, 0xA6, 0xB5, 0x15, 0x66, 0x7A, 0xCE, 0xC8, 0x00, 0x65, 0x77, 0x7D,
-    0x88, 0x59, 0xD2, 0x54, 0xEE, 0x74, 0x9B, 0xD4, 0xCA, 0x4D, 0xCD, 0xED, 0x5D, 0xBB, 0xCD, 0x6B,
-    0x35, 0xFD, 0x20, 0x53, 0x72, 0xFB, 0xD7, 0x6E, 0x92, 0x52, 0xC0, 0xD0, 0x28, 0x99, 0x60, 0x11,
-    0xBB, 0x3D, 0x6C, 0x8E, 0x65, 0x64, 0xB6, 0x76, 0xE4, 0xF0, 0x0E, 0xB0, 0xD9, 0xC1, 0x66, 0x7B,
-    0x38, 0xFE, 0xDA, 0x28, 0x99, 0x44, 0xB8, 0xFA, 0x02, 0x19, 0x68, 0xB0, 0xB1, 0x49, 0xE1, 0xBF,
-    0x73, 0x49, 0x66, 0x72, 0x03, 0x77, 0x49, 0x9E, 0x6F, 0x3B, 0x41, 0x6F, 0x32, 0x42, 0xD9, 0x41,
-    0x9F, 0x28, 0x99, 0xAB, 0xB6, 0x50, 0x8E, 0x6B, 0x71, 0x3C, 0xF1, 0x95, 0x25, 0xF9, 0x09, 0xAE,
-    0x97, 0x3F, 0x59, 0xD9, 0x06, 0x1C, 0xF6, 0x4A, 0xF1, 0x95, 0xF3, 0x5A, 0x59, 0x15, 0xF5, 0x72,
-    0x17, 0xAB, 0xDF, 0xE4, 0xBB, 0xE5, 0xEE, 0xFB, 0x98, 0x42, 0x26, 0x26, 0xEC, 0xB9, 0x01, 0x49,
-    0xF6, 0x3C, 0x2F, 0x4F, 0x92, 0xBD, 0x27, 0xAE, 0x52, 0x29, 0x94, 0xC0, 0x05, 0x79, 0xC1, 0xB8,
-    0x21, 0x3E, 0x17, 0x60, 0xB5, 0x12, 0x34, 0x96, 0xF4, 0x0C, 0x5C, 0x4F, 0xC4, 0x1A, 0xF4, 0x6E,
-    0x75, 0x72, 0x59, 0x32, 0x69, 0xD6, 0x30, 0xF0, 0xD8, 0x6B, 0x78, 0x3A, 0x6A, 0x71, 0x1A, 0x76,
-    0x8C, 0xD3, 0x2A, 0xFB, 0x19, 0x22, 0x16, 0xFA, 0xBA, 0x74, 0x90, 0xF8, 0x6B, 0x2A, 0x2E, 0x14,
-    0x7A, 0xE8, 0x4E, 0x68, 0x2E, 0x61, 0x2A, 0x1A, 0x02, 0x2C, 0x55, 0x9B, 0x7E, 0xC3, 0x73, 0x86,
-    0xAE, 0x6C, 0xE7, 0x6B, 0xB2, 0xC7, 0x93, 0x63, 0x1A, 0x65, 0x9D, 0x55, 0x63, 0x0C, 0xBB, 0x1B,
-    0xA2, 0xAE, 0x64, 0x0E, 0xC8, 0xEE, 0xE2, 0x4C, 0x82, 0xE9, 0x13, 0x1A, 0xF0, 0xAE, 0xF2, 0xE0,
-    0x40, 0x1B, 0xB2, 0x71, 0x0D, 0x97, 0xA2, 0x8B, 0x78, 0x48, 0x5C, 0x5E, 0xF2, 0x84, 0x5A, 0xB6,
-    0xE5, 0x40, 0x2C, 0xCA, 0x99, 0xB6, 0x57, 0x49, 0xCF, 0x14, 0xC8, 0x3F, 0x20, 0xC4, 0x00, 0xBD,
-    0x5E, 0x19, 0x70, 0xE7, 0x90, 0x9E, 0xE9, 0x75, 0x08, 0x6F, 0xB9, 0x62, 0xB2, 0x57, 0x5A, 0x1D,
-    0xB7, 0x26, 0x3D, 0x64, 0xD2, 0x23, 0x55, 0x76, 0xC6, 0xD6, 0xE1, 0x68, 0x7F, 0x2B, 0xF5, 0x51,
-    0x6A, 0x0B, 0x1C, 0xE3, 0x83, 0xD8, 0xB7, 0x4F, 0x1D, 0xFC, 0xFE, 0x9D, 0x73, 0x41, 0xE1, 0xE4,
-    0x82, 0xEE, 0x2D, 0x33, 0x0C, 0x9D, 0x4F, 0x94, 0xF7, 0xCB, 0x82, 0x0F, 0x89, 0x8F, 0x3E, 0xC8,
-    0x3A, 0x80, 0x46, 0xF2, 0xB9, 0x53, 0x36, 0x76, 0x98, 0xC2, 0x46, 0x71, 0x17, 0xC1, 0x3C, 0x47,
-    0x77, 0xF7, 0x29, 0x69, 0x6E, 0xF4, 0xB9, 0xB0, 0x24, 0x6C, 0x5C, 0x3E, 0x75, 0xFB, 0xC4, 0xCB,
-    0xBD, 0xD9, 0xF3, 0xB6, 0xD7, 0x23, 0xCB, 0x0C, 0x8A, 0x92, 0x1B, 0xC9, 0xD4, 0x2A, 0x80, 0x67,
-    0xAE, 0xEC, 0x73, 0x70, 0x36, 0x86, 0xA4, 0xEA, 0x32, 0x6D, 0x81, 0x4C, 0x6B, 0xB8, 0xF5, 0xC0,
-    0x6B, 0x25, 0xEC, 0x33, 0x9C, 0xD2, 0xDE, 0xF1, 0x5A, 0xDA, 0xBB, 0x95, 0xB4, 0x77, 0x7B, 0x63,
-    0xDA, 0x5B, 0x4B, 0xDA, 0xBB, 0x58, 0x4F, 0x7B, 0x13, 0xF3, 0x05, 0x9A, 0xF4, 0x04, 0x54, 0x82,
-    0xC2, 0xB8, 0xC2, 0x3F, 0x7E, 0xF4, 0xB6, 0x23, 0x6C, 0xE0, 0xD3, 0x2D, 0x78, 0x49, 0xD0, 0x63,
-    0x09, 0xD2, 0xF7, 0xA6, 0x11, 0x9E, 0xB0, 0xAF, 0x71, 0xE3, 0xB3, 0x10, 0xE2, 0x71, 0x37, 0x23,
-    0x5C, 0x4B, 0xCC, 0xEF, 0x9A, 0x8F, 0x70, 0x3F, 0xB9, 0x33, 0x9E, 0x7F, 0xD9, 0x25, 0xE6, 0x3D,
-    0x7D, 0x8D, 0xF1, 0x76, 0xE5, 0x62, 0xBA, 0x5B, 0x8F, 0x30, 0x67, 0x21, 0xE0, 0x79, 0xDB, 0xA5,
-    0xF6, 0x60, 0xD9, 0x04, 0x96, 0x56, 0xC5, 0xB2, 0x07, 0x17, 0x6F, 0x92, 0x24, 0x63, 0x29, 0x8B,
-    0xA9, 0xEE, 0xC1, 0x27, 0x2F, 0x8C, 0x38, 0xF5, 0xE4, 0x72, 0xE3, 0x0A, 0x1F, 0x10, 0xD6, 0x82,
-    0xC2, 0x03, 0x54, 0x65, 0xF3, 0xB9, 0x62, 0xE5, 0x83, 0x29, 0x6D, 0x24, 0xC0, 0x2D, 0x4F, 0x75,
-    0xB8, 0x2D, 0x56, 0x2A, 0x08, 0xE1, 0x6A, 0xE5, 0xEE, 0x31, 0x29, 0x3F, 0x94, 0xBD, 0x44, 0x40,
-    0xC3, 0x04, 0xD9, 0x27, 0xA7, 0xCD, 0x76, 0x10, 0x8F, 0xD9, 0xCE, 0x19, 0x5C, 0x19, 0x78, 0x35,
-    0x7C, 0x99, 0xD1, 0x7D, 0x1C, 0x5F, 0x81, 0x85, 0x6F, 0xCB, 0xCE, 0xAE, 0x8C, 0xEA, 0x98, 0xFD,
-    0xBA, 0xF8, 0x70, 0xE6, 0x01, 0xB9, 0xFF, 0x5B, 0x4C, 0xC5, 0xBF, 0x56, 0x7D, 0xE9, 0xE9, 0xD5,
-    0x59, 0x29, 0x15, 0x49, 0xF0, 0xC5, 0xD6, 0xCE, 0x93, 0xD4, 0xF9, 0x3A, 0xA7, 0x94, 0x7C, 0xB7,
-    0x28, 0xB5, 0x7A, 0x6C, 0x0E, 0x71, 0x03, 0xE2, 0x4A, 0x34, 0xDD, 0x36, 0xFD, 0x57, 0x49, 0xB5,
-    0x4D, 0x3F, 0x9B, 0x54, 0xCF, 0xE8, 0x27, 0x12, 0xA6, 0x38, 0x6E, 0xD7, 0xE4, 0x29, 0x93, 0xFF,
-    0x74, 0xF5, 0x53, 0x79, 0x81, 0x34, 0x6F, 0xAE, 0x91, 0x64, 0x72, 0x2B, 0xCE, 0xD1, 0x9B, 0x2D,
-    0x4A, 0xC5, 0x93, 0x46, 0xB8, 0xD6, 0x48, 0x05, 0xC7, 0x86, 0xC6, 0xB8, 0xC8, 0xDB, 0x2A, 0xA9,
-    0xE3, 0x90, 0xD8, 0x44, 0x32, 0x66, 0xEA, 0xC9, 0xD7, 0xEC, 0x1A, 0x3C, 0x6F, 0x68, 0x64, 0x09,
-    0x85, 0x4E, 0xDF, 0x76, 0x8D, 0x5E, 0x77, 0xE9, 0xCB, 0x7B, 0xDB, 0xB3, 0x18, 0x1D, 0x81, 0x12,
-    0x72, 0x78, 0x60, 0x2A, 0x62, 0xE5, 0x04, 0x9E, 0xB8, 0x73, 0x15, 0xCA, 0x0A, 0xBD, 0xCC, 0xD7,
-    0xB9, 0x3F, 0xFE, 0xD3, 0x1B, 0xAA, 0x50, 0x4E, 0x11, 0xD3, 0xBF, 0xC7, 0x0E, 0x2F, 0xDC, 0xB2,
-    0x0A, 0xA5, 0x34, 0xD4, 0x0A, 0x04, 0xF9, 0x2D, 0xB3, 0xE5, 0x38, 0xAE, 0xEC, 0x69, 0xE2, 0xAB,
-    0x47, 0x98, 0x83, 0x6C, 0x58, 0x5D, 0xA0, 0x1E, 0x7F, 0xBB, 0x51, 0xFE, 0x91, 0xC6, 0x81, 0x09,
-    0xA0, 0xDB, 0x93, 0x7A, 0x3D, 0xE5, 0x02, 0xE0, 0x54, 0x74, 0xDA, 0xA8, 0x2F, 0x36, 0x63, 0xD9,
-    0xB9, 0xAD, 0xE9, 0xC0, 0xFE, 0xDA, 0x09, 0xB6, 0x90, 0x1D, 0xFC, 0x9B, 0x9B, 0x41, 0x8A, 0xBA,
-    0xCE, 0x10, 0x2D, 0xCF, 0x62, 0xD0, 0x37, 0x67, 0x33, 0x69, 0x64, 0xBE, 0x94, 0x09, 0x79, 0x8B,
-    0x2A, 0x7D, 0x57, 0xA6, 0x06, 0xE4, 0xBE, 0x0C, 0x8A, 0x5B, 0x94, 0x37, 0x24, 0x2F, 0xEF, 0x94,
-    0xCD, 0x84, 0xA7, 0x60, 0xDE, 0xA5, 0xE7, 0x80, 0x59, 0x39, 0xD0, 0x44, 0xDD, 0x37, 0x28, 0xAF,
-    0x18, 0xA4, 0x2C, 0x3D, 0x0B, 0xC1, 0x44, 0x57, 0x07, 0x3B, 0xFB, 0xA1, 0x61, 0xF6, 0xD5, 0x32,
-    0x60, 0x03, 0x65, 0x36, 0x6B, 0x4B, 0x2D, 0x2C, 0x2D, 0x92, 0x05, 0xC6, 0x9C, 0x37, 0xA3, 0x8F,
-    0x13, 0x3D, 0x15, 0x64, 0x50, 0x12, 0x02, 0x4D, 0x65, 0x92, 0x5B, 0x5D, 0x65, 0x13, 0xD4, 0xE1,
-    0xCF, 0xB3, 0x43, 0xC3, 0x3E, 0xAD, 0xC6, 0x93, 0xA5, 0xB2, 0xE8, 0x11, 0xBE, 0x9E, 0x3B, 0xF4,
-    0x53, 0x6F, 0xCC, 0xCA, 0xEA, 0xD5, 0x1F, 0x2B, 0xA6, 0x22, 0x18, 0xFC, 0xCB, 0xA6, 0xC5, 0x43,
-    0x18, 0x5F, 0x30, 0x8D, 0x6F, 0x55, 0xB9, 0x7C, 0x9F, 0x80, 0xBE, 0xE4, 0x72, 0xA7, 0xBA, 0xE8,
-    0xB5, 0xE8, 0xE5, 0xAB, 0x8C, 0x5C, 0xB4, 0x47, 0x4F, 0xB9, 0x4C, 0x1E, 0xDF, 0xC5, 0xF1, 0x17,
-    0xF7, 0xFA, 0x62, 0xC5, 0x63, 0x4A, 0x2A, 0xDD, 0x53, 0x09, 0xA9, 0x40, 0x93, 0x1D, 0x1A, 0x4C,
-    0x85, 0xF9, 0xB3, 0xF5, 0x34, 0xD4, 0x9F, 0x46, 0x25, 0xAF, 0xFB, 0x13, 0x17, 0x1C, 0x6C, 0x26,
-    0xD2, 0x1C, 0x85, 0x3A, 0x95, 0xDD, 0x5A, 0x1C, 0xC8, 0x00, 0x0B, 0x61, 0x34, 0x58, 0x4C, 0xDA,
-    0x96, 0x8D, 0xAE, 0x4E, 0x34, 0x3A, 0xF8, 0x5C, 0xC5, 0x88, 0xAF, 0xC1, 0x58, 0x5F, 0x61, 0xA9,
-    0x45, 0x7A, 0xE2, 0xBD, 0x4A, 0x18, 0x5C, 0x8E, 0x50, 0xC6, 0xE0, 0x7E, 0xFD, 0x4A, 0xCB, 0xB0,
-    0x2D, 0x39, 0x3D, 0x60, 0x60, 0x9A, 0xB4, 0x3A, 0xB4, 0x40, 0xF3, 0x36, 0x33, 0x91, 0x71, 0x21,
-    0x3D, 0xA3, 0xAE, 0xDD, 0x4C, 0x06, 0x21, 0x26, 0xE4, 0x4B, 0x3C, 0x60, 0x6F, 0xF4, 0xA7, 0x8C,
-    0xB7, 0x02, 0x76, 0x9C, 0x41, 0x6E, 0xC1, 0x14, 0x14, 0xD4, 0x01, 0xA8, 0x0D, 0x4B, 0xBF, 0x7A,
-    0x11, 0x36, 0xC5, 0xED, 0x3E, 0xD4, 0xB8, 0xD4, 0x92, 0x43, 0x19, 0x61, 0x7A, 0x5C, 0x4B, 0xD6,
-    0x08, 0x45, 0x92, 0x6B, 0x9E, 0x3C, 0xD2, 0x34, 0x09, 0xDB, 0xC7, 0x17, 0x10, 0x08, 0x1C, 0x1C,
-    0xA2, 0xEB, 0x8C, 0x65, 0x93, 0xF3, 0xC0, 0xF6, 0x92, 0x2F, 0xD5, 0x34, 0xE1, 0x2A, 0x44, 0x82,
-    0x11, 0x80, 0x4C, 0x1E, 0x1C, 0x94, 0xD0, 0x48, 0x5C, 0xDC, 0x08, 0xA4, 0x13, 0xFB, 0xF8, 0xD1,
-    0xBA, 0x18, 0xEE, 0xBF, 0x1F, 0x78, 0xE5, 0xED, 0x2A, 0xDD, 0x76, 0x93, 0x3B, 0xB5, 0x93, 0xDD,
-    0x70, 0x09, 0x38, 0x44, 0x97, 0x5D, 0xD6, 0xEB, 0x1E, 0x4B, 0x27, 0x46, 0xBD, 0xCB, 0x8E, 0x5B,
-    0xC4, 0x13, 0x51, 0x81, 0xBC, 0x76, 0xCA, 0xC8, 0x17, 0x0F, 0xBE, 0xD8, 0x36, 0x65, 0xBD, 0x53,
-    0x04, 0xF5, 0xED, 0x82, 0x75, 0xB3, 0x95, 0xCD, 0xFB, 0xB2, 0x9A, 0xD2, 0xCF, 0x9E, 0x2D, 0xE6,
-    0x0E, 0x30, 0x99, 0x4A, 0x31, 0x60, 0x46, 0xE0, 0x26, 0x2D, 0x6B, 0xA0, 0x5C, 0x8D, 0x17, 0xF3,
-    0x26, 0xD7, 0x5E, 0x74, 0x27, 0x68, 0x97, 0xBC, 0xA2, 0x84, 0x24, 0x33, 0x2B, 0xDD, 0xD2, 0xEB,
-    0xE9, 0x69, 0xD3, 0x27, 0x6D, 0x5C, 0x89, 0x40, 0x7A, 0x54, 0x3D, 0xB4, 0xDA, 0xE1, 0xB7, 0xD9,
-    0x27, 0x6D, 0x96, 0x5B, 0xC4, 0x53, 0xBE, 0xDB, 0xAC, 0xBD, 0x81, 0x11, 0xAB, 0xFB, 0x8C, 0x2B,
-    0xD7, 0xB6, 0x89, 0xE6, 0xC9, 0xA7, 0x6D, 0xCA, 0x25, 0x21, 0x1E, 0x64, 0x31, 0x66, 0x2C, 0xB9,
-    0x30, 0x40, 0x8E, 0x0C, 0x5F, 0x8A, 0x40, 0xB9, 0xFF, 0xEB, 0xD4, 0xCA, 0xF9, 0x6F, 0xF5, 0x55,
-    0x8A, 0x0E, 0x14, 0xF3, 0x89, 0x4C, 0x4E, 0xF1, 0xA0, 0x6A, 0x01, 0x1C, 0xEE, 0xBB, 0x60, 0xBC,
-    0xB8, 0x8B, 0x82, 0xF1, 0x41, 0x0A, 0xC6, 0x25, 0x41, 0xE1, 0x56, 0x24, 0xE8, 0xD6, 0x99, 0x56,
-    0x28, 0x4C, 0x2B, 0x9C, 0x6B, 0x1A, 0x4B, 0x86, 0x52, 0x38, 0xCE, 0x0E, 0x98, 0x01, 0x8F, 0x62,
-    0x77, 0xA1, 0x61, 0xCD, 0x50, 0xF8, 0xDE, 0x5B, 0xBF, 0xAC, 0xC2, 0x77, 0x2E, 0xBF, 0x58, 0x85,
-    0x17, 0x6C, 0x52, 0x49, 0xD1, 0x50, 0x58, 0x1B, 0x36, 0x6F, 0x20, 0x98, 0xEC, 0x21, 0x11, 0x56,
-    0x0D, 0x99, 0xB9, 0x21, 0x4A, 0xE7, 0xB2, 0x44, 0x12, 0x96, 0x30, 0xAE, 0x4B, 0xE1, 0xCD, 0x9B,
-    0xF4, 0x76, 0x9B, 0xAA, 0xF3, 0x0F, 0xA1, 0xBD, 0x8A, 0x5E, 0x9E, 0xF1, 0x6B, 0x16, 0x76, 0x92,
-    0xB1, 0xEE, 0x6D, 0xA6, 0xFD, 0x91, 0xF9, 0x8B, 0x48, 0x0F, 0xF1, 0xDD, 0x1D, 0xF6, 0xD8, 0xA6,
-    0xB2, 0x61, 0x08, 0x20, 0x0F, 0x6D, 0x71, 0x7F, 0xC5, 0x82, 0xCE, 0x27, 0x68, 0x19, 0x0A, 0x9B,
-    0xAD, 0x5E, 0xFE, 0xC7, 0x98, 0x41, 0x9F, 0x81, 0x21, 0x74, 0xBE, 0xD1, 0xF0, 0x14, 0xF9, 0x7D,
-    0xCC, 0xC0, 0xE5, 0x3E, 0x5C, 0xE9, 0xCD, 0x26, 0xF7, 0xA2, 0x61, 0x66, 0x17, 0xE8, 0x1E, 0xC0,
-    0xCF, 0xB0, 0x28, 0x47, 0x5A, 0x1F, 0x63, 0x65, 0x42, 0x4F, 0x45, 0x8D, 0xD8, 0x11, 0x60, 0x07,
-    0xA1, 0x70, 0x27, 0xFC, 0x77, 0x78, 0x61, 0x3C, 0x2E, 0x6E, 0x4D, 0x2A, 0x30, 0x6C, 0xB5, 0xA0,
-    0xB8, 0xC7, 0x1A, 0xD4, 0x69, 0x21, 0x9B, 0x09, 0xF0, 0x1E, 0xC7, 0xE1, 0xBE, 0x02, 0x29, 0xB8,
-    0x5E, 0x91, 0x67, 0x6C, 0x55, 0x5B, 0xB0, 0xD2, 0x89, 0x95, 0x3C, 0x4B, 0x72, 0xCE, 0x1E, 0x1A,
-    0x30, 0xD4, 0xA0, 0x5F, 0x8A, 0x9B, 0xA4, 0xF5, 0x4A, 0xF7, 0xCA, 0xC0, 0xAF, 0xB2, 0xDF, 0x81,
-    0x68, 0x61, 0xC8, 0xCC, 0x1D, 0xC2, 0xD3, 0x5F, 0xB4, 0xAB, 0xFF, 0xC5, 0x17, 0x88, 0xBA, 0xB2,
-    0x87, 0x2F, 0xDC, 0x22, 0xD5, 0x12, 0xC7, 0x1E, 0x55, 0x78, 0x40, 0xA1, 0x06, 0x20, 0x1F, 0x77,
-    0x9E, 0x5C, 0x1D, 0xE9, 0x03, 0x7D, 0xE1, 0xB7, 0x8B, 0xF3, 0x2C, 0xAC, 0xE3, 0x4F, 0xDA, 0xB9,
-    0xAB, 0xBF, 0xE7, 0x92, 0x8E, 0x13, 0xAF, 0x31, 0xEB, 0x2E, 0x25, 0xC8, 0x60, 0xA9, 0xED, 0x4F,
-    0x25, 0x2D, 0x11, 0xAE, 0xED, 0x28, 0xCD, 0x66, 0x2F, 0x0C, 0xB2, 0x57, 0xCA, 0x03, 0xE7, 0xDC,
-    0x11, 0xF5, 0x84, 0xE5, 0xEC, 0xA3, 0xB2, 0x4E, 0x64, 0xAF, 0xB5, 0x77, 0x44, 0x53, 0x8A, 0x6C,
-    0x98, 0x1E, 0x5F, 0x7D, 0xCA, 0x6C, 0x71, 0x45, 0x36, 0xB3, 0x17, 0x7A, 0x57, 0x57, 0x74, 0xA4,
-    0x89, 0x2F, 0xF4, 0x61, 0x5B, 0x3E, 0x07, 0x02, 0xD3, 0x7B, 0x78, 0xF8, 0xA4, 0x83, 0x41, 0x7B,
-    0x00, 0x51, 0x0E, 0xBA, 0xED, 0xC0, 0x38, 0x16, 0x27, 0x85, 0x7D, 0x90, 0x83, 0x02, 0x10, 0x74,
-    0xFB, 0x21, 0x86, 0x2A, 0x7B, 0xBE, 0x99, 0xF4, 0x10, 0x8C, 0x29, 0xB1, 0xB8, 0x6A, 0x88, 0x7F,
-    0x5E, 0xAE, 0xE4, 0xE4, 0xF1, 0xE3, 0xC2, 0x4C, 0xAF, 0x15, 0xD0, 0x0C, 0x59, 0xA1, 0xA3, 0x4E,
-    0x17, 0x08, 0xD4, 0x59, 0xD6, 0xB7, 0x65, 0xC3, 0x76, 0x64, 0x72, 0x58, 0xC0, 0x2A, 0x3B, 0x2B,
-    0xD2, 0x4F, 0xCF, 0x88, 0xD0, 0x17, 0xD6, 0x18, 0xD8, 0x9F, 0x16, 0x1F, 0x8C, 0x4E, 0xCB, 0x1B,
-    0xD4, 0x7B, 0x88, 0x7E, 0x46, 0x42, 0xDB, 0xA9, 0xEE, 0xE7, 0xA1, 0xF1, 0x41, 0x71, 0xAE, 0x2B,
-    0xBD, 0x40, 0x0D, 0x5F, 0x43, 0x9F, 0xD6, 0xD3, 0x3F, 0x55, 0x78, 0x8E, 0x6C, 0xD5, 0x19, 0x68,
-    0x05, 0x5C, 0x62, 0x00, 0xDF, 0xED, 0x89, 0x5F, 0x62, 0x15, 0x78, 0x2B, 0xEF, 0x68, 0x2C, 0x94,
-    0xEE, 0xA5, 0x6C, 0x55, 0x1E, 0x66, 0xC2, 0xA0, 0x8A, 0x3B, 0x5B, 0x94, 0xB0, 0x35, 0x32, 0x8C,
-    0xE2, 0xB6, 0x4B, 0xB9, 0x34, 0x5F, 0xCA, 0xBA, 0x2C, 0x0A, 0xB0, 0x3C, 0xF8, 0x49, 0xF2, 0xCD,
-    0x51, 0x79, 0xCB, 0x0D, 0xCC, 0x66, 0xBB, 0xB2, 0x60, 0x55, 0x87, 0x2D, 0xEB, 0xC9, 0x0B, 0x2E,
-    0xE5, 0xC2, 0x6C, 0xE6, 0x3B, 0xE3, 0x3B, 0x0F, 0x8F, 0x8E, 0xE1, 0x78, 0xF0, 0x05, 0xBC, 0xCB,
-    0x73, 0x55, 0x16, 0x2C, 0xA6, 0xF0, 0xCA, 0x4A, 0x22, 0xBB, 0xA4, 0xC9, 0xBD, 0x61, 0xBB, 0x4A,
-    0xDF, 0x19, 0xF6, 0xD2, 0xE2, 0x00, 0x53, 0x85, 0x9A, 0x31, 0xFF, 0xC6, 0xFA, 0xD0, 0x4B, 0xD7,
-    0x4F, 0xB4, 0x6D, 0xD4, 0x3E, 0x8B, 0x5B, 0x43, 0x16, 0x2B, 0x4B, 0x4E, 0xC7, 0xF6, 0x12, 0x77,
-    0x26, 0x9D, 0xEC, 0x2B, 0x66, 0xF8, 0x74, 0xA1, 0x8A, 0xAE, 0xF4, 0x21, 0xC2, 0x23, 0x16, 0x7D,
-    0xAB, 0x27, 0x8F, 0x71, 0x5B, 0x7D, 0x51, 0x49, 0x30, 0xAD, 0xE6, 0x05, 0xE6, 0x6A, 0xED, 0x9D,
-    0x5E, 0x89, 0x52, 0x62, 0xBE, 0x70, 0xE1, 0xCB, 0x4B, 0xA8, 0x6B, 0xEF, 0xC7, 0xBA, 0x97, 0x65,
-    0x03, 0x6E, 0xBA, 0x53, 0x5E, 0x36, 0xFC, 0x14, 0x27, 0xCF, 0xB6, 0x38, 0xF9, 0x19, 0x37, 0x1E,
-    0x25, 0x81, 0xCD, 0xF7, 0x2F, 0xDD, 0xBB, 0xB7, 0xEE, 0x15, 0xBC, 0x01, 0x66, 0x13, 0x31, 0xED,
-    0x73, 0x41, 0xFA, 0xC4, 0xD3, 0x2A, 0xC5, 0x5A, 0x20, 0x19, 0xC0, 0x3C, 0x66, 0x00, 0x03, 0x22,
-    0xA5, 0x6E, 0x5D, 0x5D, 0x6B, 0xD4, 0x7B, 0x43, 0x04, 0x36, 0xFB, 0x3C, 0x54, 0xFF, 0xDD, 0xB7,
-    0x11, 0x69, 0x9F, 0x81, 0xAD, 0x56, 0x23, 0x0B, 0xEB, 0xA5, 0xF2, 0x35, 0x1D, 0x22, 0xCC, 0xFD,
-    0xF0, 0xFC, 0x05, 0x65, 0xBF, 0x23, 0x03, 0xB2, 0x4C, 0x6A, 0x66, 0xAF, 0x90, 0x4D, 0xE4, 0x8B,
-    0x7F, 0x94, 0xB7, 0xF2, 0x26, 0x5B, 0x44, 0x60, 0x78, 0x15, 0xEC, 0xBC, 0x07, 0xED, 0x9E, 0x2A,
-    0xAC, 0xEE, 0xB3, 0x34, 0x9A, 0xA1, 0x28, 0x0D, 0x0D, 0x8A, 0x89, 0x11, 0x29, 0xB5, 0x65, 0xFE,
-    0x36, 0xF4, 0x43, 0x79, 0x09, 0x4D, 0x9E, 0x77, 0xAE, 0x57, 0xD9, 0x5B, 0x70, 0xF3, 0x50, 0xC2,
-    0xE9, 0xFD, 0x76, 0x86, 0x97, 0xA9, 0xD4, 0x1B, 0x54, 0xD9, 0x39, 0xBB, 0x13, 0x80, 0xBA, 0xB1,
-    0x60, 0x79, 0x5E, 0xBF, 0x8C, 0x40, 0x41, 0xBF, 0x4F, 0x95, 0x04, 0xF4, 0x8F, 0x92, 0x16, 0xFE,
-    0x13, 0xAB, 0x7D, 0xB9, 0x7B, 0x71, 0x3E, 0xA8, 0x91, 0x7E, 0xB9, 0x38, 0x0B, 0xBB, 0x93, 0xF2,
-    0x6B, 0x7C, 0x93, 0x5D, 0xDC, 0xDB, 0x32, 0x07, 0xBE, 0x8A, 0x79, 0xF0, 0x6B, 0x15, 0x03, 0x03,
-    0xCB, 0x1B, 0xC4, 0x29, 0x31, 0x03, 0x18, 0x37, 0xC1, 0x2C, 0xBE, 0x60, 0xD4, 0x1C, 0xCD, 0x24,
-    0x25, 0xC2, 0xEA, 0x25, 0xBE, 0xD7, 0x1F, 0x76, 0x21, 0x31, 0x5D, 0x57, 0xDB, 0xE1, 0x7F, 0x36,
-    0x29, 0xCF, 0xED, 0xC1, 0x78, 0x1C, 0x18, 0x24, 0xA6, 0x36, 0x1D, 0xB7, 0x53, 0xA2, 0x37, 0x69,
-    0xB6, 0xC1, 0x1C, 0xB3, 0x22, 0x32, 0xF1, 0x6A, 0x62, 0xE4, 0x4D, 0x92, 0x44, 0x72, 0x2C, 0x73,
-    0x37, 0xF8, 0xA6, 0x07, 0xBF, 0x93, 0x81, 0x8F, 0x6C, 0xF4, 0x51, 0x29, 0x81, 0x4D, 0xAF, 0x14,
-    0xE2, 0xA3, 0x94, 0x7B, 0x5D, 0xC7, 0x7B, 0xA1, 0xDF, 0x4C, 0x58, 0x2A, 0x27, 0x60, 0x23, 0x88,
-    0x2C, 0x4D, 0x2F, 0xF0, 0x08, 0xF3, 0xCA, 0xA6, 0x2A, 0x59, 0x67, 0x88, 0xC0, 0x94, 0x12, 0x36,
-    0xF3, 0x99, 0x95, 0xED, 0x5D, 0xF0, 0x5B, 0x70, 0xB5, 0xCA, 0x1F, 0x30, 0x68, 0xF9, 0x67, 0x02,
-    0xCA, 0x90, 0x49, 0x6A, 0xB3, 0x21, 0x49, 0x1D, 0xCD, 0x73, 0xD3, 0x3E, 0x1E, 0xFA, 0xD7, 0x08,
-    0x98, 0xA2, 0xCB, 0x95, 0x4B, 0x25, 0x48, 0x82, 0x5D, 0xD6, 0x90, 0x6C, 0x8A, 0x70, 0xB2, 0xB0,
-    0x01, 0x4A, 0x58, 0xDE, 0x0B, 0x66, 0x5D, 0xB2, 0x8C, 0xAF, 0x41, 0x20, 0xC8, 0x55, 0x02, 0x1C,
-    0xD6, 0xC0, 0xD4, 0x9E, 0x0F, 0xA2, 0x63, 0xB9, 0xB9, 0x12, 0x49, 0xD2, 0x92, 0x07, 0xF8, 0xC6,
-    0x94, 0x52, 0x2F, 0xF3, 0x05, 0x6D, 0x3A, 0x1B, 0xFA, 0xC1, 0x53, 0xF3, 0x5E, 0x21, 0x18, 0xDC,
-    0xBB, 0x87, 0x20, 0x8B, 0x75, 0xD9, 0x32, 0xB1, 0x86, 0x87, 0xF4, 0xFE, 0x21, 0xFF, 0x1C, 0x80,
-    0x37, 0x4E, 0xCF, 0xA2, 0x8B, 0xF7, 0xF1, 0xFB, 0xE2, 0x23, 0x0F, 0xB1, 0x52, 0x4F, 0xA9, 0xA7,
-    0xBF, 0x86, 0xC1, 0xED, 0x84, 0xBA, 0x13, 0xC2, 0xB0, 0x9E, 0x2A, 0x01, 0xE3, 0xF7, 0x8A, 0x6F,
-    0x3D, 0xCC, 0xA5, 0x7B, 0x74, 0x13, 0xE4, 0x70, 0x09, 0x8F, 0xE9, 0x20, 0x19, 0x73, 0x12, 0xB1,
-    0x2B, 0x02, 0xCA, 0xAF, 0x3F, 0xBA, 0x0E, 0x9F, 0x0F, 0xE1, 0xD5, 0x00, 0xC9, 0x79, 0x63, 0x69,
-    0x82, 0x9E, 0xAF, 0x2A, 0x9D, 0x37, 0xE4, 0x4C, 0xF9, 0xFA, 0x24, 0x53, 0x10, 0xAF, 0x41, 0x32,
-    0xDF, 0x2E, 0x52, 0x2E, 0xE2, 0xD6, 0x05, 0xCF, 0xE2, 0x05, 0xC4, 0xAB, 0x31, 0x35, 0x50, 0x4A,
-    0xB1, 0x31, 0x55, 0xEF, 0xA5, 0x7F, 0x5E, 0x8F, 0x94, 0xD7, 0x82, 0x67, 0x49, 0xC5, 0xDA, 0xA9,
-    0x5C, 0x91, 0xC3, 0xD9, 0x41, 0xD0, 0x70, 0xEE, 0x21, 0x5F, 0x5F, 0xC7, 0xAF, 0x12, 0x32, 0xDF,
-    0xDF, 0xBF, 0x59, 0xD0, 0xBA, 0x3D, 0xFC, 0xD2, 0x25, 0x73, 0xE6, 0x3B, 0x5C, 0xCF, 0xDE, 0x6B,
-    0x59, 0x33, 0x65, 0xDC, 0x4B, 0x06, 0x83, 0xB7, 0xAF, 0x13, 0x07, 0xEA, 0x0C, 0xCE, 0x5D, 0x19,
-    0x24, 0x83, 0x20, 0x65, 0x31, 0x6B, 0x40, 0x4B, 0x47, 0xAC, 0xC4, 0x13, 0x03, 0x6B, 0x47, 0x52,
-    0x13, 0xF1, 0xC5, 0x1B, 0x5E, 0x20, 0xBC, 0xE1, 0xCD, 0xC2, 0x25, 0xF9, 0x81, 0xF5, 0xB8, 0xFC,
-    0x97, 0x7E, 0x2A, 0xFE, 0x90, 0xF4, 0x1B, 0x5E, 0x20, 0x4C, 0xAB, 0xF5, 0x37, 0x0B, 0x43, 0x79,
-    0xB3, 0xF0, 0x5F, 0x87, 0x60, 0x64, 0xBE, 0x59, 0x8A, 0xFA, 0xA4, 0x9E, 0xFE, 0x86, 0x3F, 0x59,
-    0x24, 0x55, 0xBE, 0x1C, 0x9A, 0x96, 0x9C, 0xD8, 0x3A, 0x03, 0x15, 0xE3, 0x66, 0xC5, 0x93, 0x01,
-    0x59, 0x8B, 0x59, 0xAE, 0xCA, 0xF7, 0x01, 0xDC, 0xAB, 0x01, 0x33, 0x7E, 0xB4, 0xA3, 0xBC, 0x1A,
-    0xD0, 0xF1, 0x6C, 0xB6, 0xFE, 0x3E, 0x80, 0xBC, 0x1A, 0xF0, 0x5C, 0xCF, 0xBC, 0x95, 0x8D, 0x00,
-    0x39, 0xF6, 0xA0, 0x35, 0xEA, 0x2E, 0xFE, 0x65, 0x89, 0x2F, 0xAB, 0x15, 0x63, 0x76, 0xA9, 0x71,
-    0x3B, 0x3E, 0x08, 0x2A, 0xBF, 0xCD, 0x78, 0xA9, 0x76, 0xF9, 0x7D, 0x75, 0x97, 0x15, 0x64, 0xB9,
-    0xD4, 0xB8, 0xFD, 0x86, 0x19, 0x67, 0xFF, 0x72, 0xCE, 0xFC, 0xD9, 0xA3, 0xF9, 0x7D, 0xBF, 0x74,
-    0x1C, 0xAF, 0xBF, 0x74, 0xDC, 0x68, 0x28, 0xC2, 0x69, 0xD6, 0xE9, 0xE5, 0xD3, 0x3F, 0x30, 0x23,
-    0xD9, 0x2D, 0xEE, 0xA2, 0x08, 0x7B, 0x29, 0x8B, 0xB5, 0x8D, 0x37, 0xDB, 0x6A, 0xB8, 0x0D, 0x5C,
-    0x09, 0x08, 0x64, 0x87, 0xA5, 0xDB, 0x76, 0x46, 0x20, 0xA2, 0x4E, 0x0D, 0x02, 0x6D, 0xA5, 0x6F,
-    0xE2, 0x01, 0xF6, 0xC8, 0xB7, 0x31, 0x24, 0x3B, 0xCA, 0xD4, 0xDC, 0x29, 0xE9, 0x32, 0x80, 0x9A,
-    0x44, 0x1F, 0xDE, 0x76, 0xE4, 0x8A, 0x23, 0xF7, 0xEC, 0x9B, 0x6E, 0xE4, 0xF2, 0xCF, 0x3C, 0x85,
-    0x6E, 0xDB, 0x5F, 0x46, 0xCE, 0x5D, 0xF3, 0x3D, 0x1D, 0x47, 0xDE, 0xDE, 0xEA, 0x75, 0xE9, 0x8D,
-    0xDB, 0x82, 0x1E, 0xB7, 0x05, 0x71, 0x97, 0xA7, 0x57, 0x59, 0x13, 0x5C, 0xB9, 0x6D, 0xC1, 0xE1,
-    0x0B, 0xEF, 0xEA, 0xFC, 0x1F, 0x95, 0x54, 0xBD, 0x6F, 0xDC, 0x36, 0x14, 0x7F, 0x12, 0xCF, 0x96,
-    0x7B, 0x32, 0x40, 0x0F, 0xCE, 0x60, 0xC0, 0x80, 0x16, 0x0F, 0x71, 0x11, 0x80, 0x19, 0x32, 0x78,
-    0xC8, 0x1D, 0x55, 0x7B, 0xC8, 0x90, 0xC1, 0x37, 0xC4, 0xAB, 0xDB, 0x02, 0x45, 0x81, 0x2C, 0x4D,
-    0x80, 0x76, 0xC8, 0x70, 0x67, 0xC9, 0x0E, 0x10, 0xA3, 0x9B, 0x51, 0xF4, 0x0F, 0x08, 0x90, 0x0C,
-    0xC5, 0x75, 0x68, 0x97, 0x00, 0x19, 0x2E, 0x27, 0xDA, 0x37, 0x18, 0xE8, 0xA4, 0xE4, 0xFE, 0x80,
-    0x28, 0xC9, 0xE6, 0x0E, 0x7E, 0x41, 0x35, 0x08, 0x31, 0x25, 0xF6, 0x51, 0xBE, 0x83, 0x33, 0x04,
-    0xF9, 0x20, 0x75, 0xC7, 0x47, 0xF2, 0xF7, 0x3E, 0xF8, 0xDE, 0x8F, 0x9C, 0xFD, 0x71, 0xDA, 0x00,
-    0xD8, 0xBC, 0x88, 0x51, 0x1E, 0xFE, 0xFE, 0x15, 0x1C, 0x7C, 0xF0, 0x03, 0xDB, 0x52, 0x58, 0xDB,
-    0xDA, 0x3E, 0xF9, 0x4B, 0x2D, 0xAB, 0x87, 0x87, 0xB1, 0x82, 0x8F, 0xF5, 0x90, 0xE0, 0x1E, 0x2C,
-    0xC3, 0x93, 0xAD, 0x77, 0x7F, 0x5E, 0x63, 0x4D, 0xE6, 0x6E, 0x00, 0xFB, 0x68, 0x77, 0x84, 0xD9,
-    0x34, 0x6F, 0x4C, 0x3E, 0x19, 0x2E, 0x6D, 0x6D, 0x6D, 0x1A, 0xF3, 0x9F, 0x31, 0xBA, 0xDF, 0xEF,
-    0x47, 0xC6, 0x9C, 0x1A, 0x93, 0xF7, 0xEB, 0x96, 0x98, 0x8B, 0xA6, 0x3F, 0xB0, 0x74, 0x6B, 0x46,
-    0xFA, 0xA7, 0x47, 0x67, 0x38, 0xD4, 0x22, 0xF9, 0x12, 0xA1, 0x3F, 0x7B, 0x40, 0xEA, 0xE4, 0xEA,
-    0xA4, 0xDF, 0x7F, 0x4C, 0xD1, 0x5F, 0x4C, 0x9C, 0xB0, 0xCB, 0xF7, 0x50, 0x32, 0x94, 0x7B, 0x05,
-    0xC0, 0x8C, 0xAB, 0x03, 0xA5, 0xB9, 0x2A, 0x04, 0x4B, 0x09, 0xE6, 0x16, 0xA2, 0x9E, 0x05, 0x2C,
-    0x5D, 0xB4, 0x7B, 0xF2, 0x3E, 0x4A, 0x27, 0xE7, 0xF1, 0x75, 0x00, 0x27, 0xEC, 0x04, 0x9E, 0x2A,
-    0xDA, 0xFE, 0x11, 0x4A, 0xAE, 0xB4, 0x64, 0x45, 0xE5, 0xBF, 0x26, 0x0B, 0x30, 0xE3, 0x84, 0x89,
-    0x38, 0xD4, 0x11, 0x43, 0xCD, 0x47, 0xD8, 0x26, 0xE3, 0x03, 0xBE, 0x91, 0xD6, 0x29, 0x86, 0xA1,
-    0xD8, 0xD3, 0xC9, 0x74, 0x63, 0x17, 0xBB, 0xB4, 0xB1, 0x38, 0x73, 0xAE, 0x31, 0x2A, 0x2A, 0x5A,
-    0x25, 0x53, 0xBD, 0x20, 0x2C, 0xDA, 0x80, 0xD7, 0x2D, 0xFE, 0x36, 0x40, 0x02, 0x10, 0x01, 0xEC,
-    0xC0, 0x4A, 0x6B, 0x49, 0x9A, 0x8A, 0xBE, 0xD5, 0xD6, 0x12, 0xB4, 0x60, 0xF2, 0xB5, 0xEB, 0x6F,
-    0xA7, 0xC6, 0x44, 0xB5, 0x8B, 0xD5, 0xA9, 0xDC, 0xBE, 0x50, 0x21, 0xC1, 0xC2, 0xEA, 0x45, 0xD2,
-    0x6A, 0xEF, 0xFC, 0x64, 0xD7, 0x87, 0xC3, 0x89, 0x7A, 0x54, 0x7B, 0x69, 0x10, 0x4F, 0xB4, 0x79,
-    0x59, 0x9A, 0x31, 0x9D, 0x62, 0x05, 0x82, 0xD4, 0x33, 0xDF, 0x98, 0x32, 0x32, 0x2F, 0xCD, 0x7E,
-    0xE5, 0x14, 0xB0, 0x00, 0xB0, 0x14, 0xFC, 0x5B, 0x56, 0x0D, 0x98, 0x0D, 0x7F, 0x90, 0x47, 0xA5,
-    0x1C, 0x57, 0xF4, 0x3F, 0x03, 0x9D, 0xD9, 0x70, 0x36, 0x74, 0x42, 0x03, 0x51, 0x2C, 0x47, 0xA5,
-    0x5B, 0x39, 0x86, 0xA3, 0x97, 0x33, 0x4D, 0xC7, 0xA2, 0x1C, 0x89, 0x6F, 0xCF, 0x74, 0x39, 0xA5,
-    0x57, 0xB8, 0x9D, 0x7E, 0x19, 0xBD, 0x9C, 0x77, 0xDE, 0xE7, 0xD1, 0x8B, 0x2A, 0x15, 0xFB, 0xD9,
-    0xEA, 0x1F, 0xDF, 0xFF, 0xEA, 0xC4, 0x9F, 0xEE, 0x54, 0xBC, 0x06, 0x34, 0xAF, 0x41, 0x73, 0xED,
-    0xD2, 0xF6, 0xE5, 0x93, 0xC1, 0xCF, 0xCE, 0xF1, 0xFC, 0xF2, 0xDD, 0xAB, 0x0F, 0xC8, 0x33, 0x03,
-    0x98, 0x07, 0xB8, 0x0A, 0x9F, 0x10, 0x29, 0x17, 0x94, 0xAE, 0xE5, 0x87, 0xEE, 0x3F, 0x70, 0xE5,
-    0xC9, 0xAD, 0xF1, 0xC9, 0xDF, 0xE3, 0x50, 0x3D, 0xDA, 0x80, 0xDF, 0x3E, 0x47, 0x77, 0x2A, 0x36,
-    0x60, 0xDA, 0x6E, 0x83, 0x93, 0xD1, 0xE0, 0x18, 0x04, 0x6D, 0xE7, 0xE5, 0x10, 0x7A, 0x76, 0x7C,
-    0xC6, 0x95, 0xB4, 0x23, 0x71, 0x33, 0xB0, 0x23, 0x57, 0x03, 0x4E, 0xB1, 0x03, 0x51, 0xD5, 0x57,
-    0x76, 0x81, 0x68, 0x64, 0x79, 0x15, 0x8A, 0x1B, 0xAF, 0x31, 0xA1, 0x72, 0x31, 0x83, 0x79, 0x55,
-    0x7A, 0x06, 0x45, 0x56, 0xF4, 0x88, 0x4C, 0xCF, 0x00, 0xBA, 0x82, 0x61, 0x11, 0xC4, 0xD0, 0x26,
-    0xE5, 0x1E, 0xCB, 0x80, 0xA6, 0x82, 0xF8, 0x05, 0x3C, 0xD6, 0xFC, 0x38, 0xEB, 0x81, 0xAF, 0xC4,
-    0x46, 0xA6, 0x05, 0x78, 0x29, 0x3B, 0x43, 0x71, 0x1A, 0x33, 0x84, 0x08, 0x99, 0x89, 0xE1, 0x17,
-    0x2A, 0x1E, 0x55, 0xF0, 0xBD, 0xC6, 0x63, 0xE9, 0x6A, 0x9E, 0x12, 0x7D, 0x79, 0xB8, 0x68, 0x17,
-    0x58, 0xD6, 0x65, 0x58, 0xF9, 0x58, 0xF2, 0x17, 0x5A, 0x8C, 0x72, 0xE9, 0x67, 0x2D, 0x5F, 0x2D,
-    0xBA, 0xE7, 0xE8, 0xB6, 0xA7, 0x72, 0xDA, 0x0D, 0x54, 0xC2, 0xC7, 0x9A, 0x00, 0x72, 0x5D, 0xCB,
-    0x9B, 0x19, 0x61, 0x34, 0x4B, 0x07, 0x64, 0xC0, 0x85, 0x0E, 0xA1, 0x9E, 0x7A, 0xC8, 0x33, 0xA1,
-    0x64, 0x18, 0xC1, 0x00, 0xEC, 0xD9, 0xE8, 0xDA, 0xC9, 0x9B, 0x28, 0x8F, 0x31, 0x18, 0x15, 0xFE,
-    0x2B, 0xCD, 0x70, 0xE8, 0x60, 0x1B, 0x3A, 0x73, 0xD6, 0xA4, 0x8B, 0x64, 0x9F, 0x76, 0x35, 0xD3,
-    0x11, 0xCF, 0x08, 0x10, 0xC1, 0x90, 0xFE, 0x09, 0xC3, 0x55, 0x40, 0xC1, 0x10, 0x8C, 0x62, 0xFE,
-    0x0E, 0xBC, 0x0C, 0xA2, 0xCC, 0x7B, 0x93, 0xED, 0xB0, 0xEC, 0x3C, 0x96, 0xAE, 0x5B, 0xF8, 0x28,
-    0xC9, 0x8B, 0x54, 0x3C, 0x63, 0x05, 0xB9, 0x22, 0x63, 0x99, 0x87, 0x3E, 0xFA, 0x39, 0xCF, 0x92,
-    0x1B, 0xB9, 0x74, 0x71, 0x72, 0xC8, 0xBB, 0x00, 0x57, 0xBA, 0x9E, 0xEA, 0x0A, 0xFF, 0x39, 0xFA,
-    0xA3, 0x7D, 0xE5, 0xDA, 0xD4, 0x3F, 0x6D, 0xC1, 0x5C, 0x3B, 0xEF, 0x48, 0xFE, 0xBC, 0xB0, 0xBF,
-    0x06, 0xC9, 0x50, 0xB4, 0xC8, 0x04, 0x0F, 0xFD, 0xE3, 0x7D, 0x65, 0xB1, 0x56, 0x87, 0x74, 0x2F,
-    0x5B, 0x1B, 0xCD, 0xF8, 0x6B, 0x8E, 0x74, 0x9F, 0xF9, 0xDB, 0x92, 0x15, 0x51, 0x58, 0xF1, 0x94,
-    0x9E, 0x0D, 0x9E, 0x6A, 0x96, 0x4B, 0x28, 0x39, 0x25, 0x1C, 0xFD, 0x54, 0xBB, 0xB9, 0x80, 0x9E,
-    0xA7, 0x78, 0x58, 0x53, 0x69, 0x41, 0xA8, 0x68, 0x13, 0xE5, 0x58, 0xFB, 0xB8, 0x08, 0x9D, 0x8B,
-    0xC7, 0x49, 0xE4, 0xF4, 0x5C, 0x86, 0xE7, 0xA1, 0xAD, 0x01, 0xD8, 0xB2, 0xD3, 0xE5, 0x14, 0x36,
-    0xF7, 0x60, 0x8F, 0x41, 0xEA, 0x36, 0xF4, 0x9E, 0xAD, 0x0E, 0x38, 0x58, 0xDF, 0xE6, 0x0B, 0x90,
-    0x47, 0xEC, 0x20, 0x46, 0x05, 0xE7, 0x20, 0x5B, 0x4C, 0xC7, 0x3A, 0x73, 0x4D, 0xEC, 0x57, 0x10,
-    0x19, 0x30, 0x9A, 0x19, 0xCD, 0x0D, 0xAE, 0x04, 0x69, 0x27, 0x8A, 0x41, 0x5A, 0x34, 0x21, 0x3D,
-    0x65, 0x95, 0x07, 0x70, 0x07, 0x9D, 0x44, 0x25, 0xA5, 0x63, 0x72, 0x6E, 0x42, 0x59, 0x82, 0x09,
-    0xDD, 0xD2, 0x5A, 0xA7, 0xCD, 0x7B, 0x00, 0xD3, 0x8C, 0x35, 0xEC, 0x75, 0xF0, 0x91, 0xDE, 0x0B,
-    0x02, 0xB0, 0xD2, 0x8A, 0x42, 0x01, 0x11, 0xA4, 0x63, 0xBD, 0x35, 0xF7, 0x4C, 0x4C, 0xE5, 0x32,
-    0x20, 0xEF, 0x93, 0xB7, 0x82, 0x3C, 0xC9, 0x90, 0x08, 0x9D, 0x93, 0x1F, 0x69, 0xAB, 0x8D, 0xE4,
-    0x45, 0x42, 0x52, 0x12, 0xA9, 0xC8, 0x87, 0x75, 0x81, 0xB5, 0x87, 0x7B, 0xF5, 0x69, 0x26, 0xE6,
-    0x6B, 0x93, 0xD6, 0x38, 0x09, 0x52, 0x59, 0xD3, 0xCD, 0xB8, 0x41, 0x8F, 0x15, 0x9D, 0x42, 0xEE,
-    0x1A, 0xED, 0x51, 0x7C, 0x18, 0x85, 0x07, 0xD1, 0x46, 0x4E, 0x27, 0x20, 0xB3, 0xFE, 0x88, 0x74,
-    0x07, 0x12, 0x9C, 0x64, 0x84, 0xAE, 0xA1, 0xAC, 0x4B, 0xB2, 0x4F, 0xA1, 0x09, 0xEA, 0x0E, 0x3A,
-    0x13, 0x56, 0x2C, 0x50, 0x17, 0x4A, 0x28, 0xA6, 0x69, 0x4B, 0x92, 0x40, 0x11, 0x13, 0x27, 0x29,
-    0xDB, 0xB2, 0x70, 0xC7, 0xA6, 0x4A, 0xEE, 0xAC, 0x9B, 0x62, 0x05, 0x86, 0xE1, 0x7B, 0x57, 0x60,
-    0x17, 0x5B, 0x9E, 0x92, 0xFC, 0x95, 0x96, 0x7B, 0x5A, 0x6E, 0xBE, 0xB5, 0xCC, 0x97, 0x9B, 0x98,
-    0xF0, 0x17, 0x85, 0xB4, 0x34, 0x3C, 0xCA, 0xF9, 0x3A, 0xB6, 0x78, 0x6C, 0xD9, 0x3D, 0x07, 0xFF,
-    0x03, 0x45, 0x90, 0xB1, 0x6E, 0x14, 0x31, 0x10, 0x86, 0xC7, 0x6B, 0x45, 0x96, 0x70, 0xB1, 0x14,
-    0xA4, 0x20, 0x14, 0x6E, 0x28, 0x10, 0x42, 0xDA, 0x27, 0xC8, 0xDA, 0x40, 0x11, 0x09, 0xEA, 0xAB,
-    0x78, 0x82, 0x40, 0xC1, 0x0B, 0x44, 0xE7, 0x55, 0x1A, 0x0A, 0x9A, 0x2B, 0x90, 0x90, 0x68, 0x48,
-    0x41, 0x95, 0x86, 0x17, 0xB8, 0x3D, 0xFB, 0x94, 0x62, 0x8B, 0x34, 0x8B, 0xF2, 0x00, 0x38, 0xA2,
-    0x48, 0x41, 0x11, 0x17, 0x06, 0xBC, 0xC1, 0x77, 0x83, 0x77, 0x53, 0x60, 0xB9, 0x18, 0x79, 0xFC,
-    0xFF, 0x33, 0xFF, 0x07, 0x87, 0x20, 0x90, 0x6C, 0xB1, 0xEC, 0x37, 0xB2, 0x18, 0x22, 0xBB, 0x72,
-    0xE2, 0x73, 0xD3, 0x4A, 0xEA, 0xB7, 0xD5, 0x1A, 0x13, 0x31, 0x0D, 0xE4, 0x43, 0x14, 0xAC, 0x80,
-    0x45, 0x90, 0x8E, 0x5E, 0x37, 0x55, 0x4D, 0x7C, 0x2C, 0x3F, 0x06, 0x89, 0xF1, 0xB5, 0x59, 0x40,
-    0x04, 0xEA, 0xF2, 0x97, 0x9D, 0x19, 0xC5, 0x1E, 0xC3, 0x11, 0x88, 0x05, 0x47, 0xF5, 0xCA, 0x67,
-    0x81, 0x50, 0x55, 0x97, 0xDF, 0x26, 0x87, 0xFB, 0x20, 0x12, 0x1F, 0x48, 0x02, 0xF9, 0x81, 0xA1,
-    0x6F, 0xDF, 0x9E, 0xDB, 0xD4, 0xF2, 0xCE, 0x27, 0x89, 0xCA, 0xF4, 0xB9, 0xBF, 0x3B, 0x63, 0x98,
-    0x34, 0x76, 0x36, 0x3C, 0xAC, 0x81, 0xDB, 0xEC, 0x2A, 0x47, 0xDF, 0x76, 0xAC, 0x8F, 0xA6, 0x15,
-    0xBE, 0x30, 0x3C, 0xBB, 0x1C, 0x42, 0x2D, 0xC5, 0x01, 0x3E, 0xC5, 0xCB, 0xB8, 0x4A, 0x25, 0xD2,
-    0x3F, 0x18, 0xF4, 0x38, 0x9D, 0x2C, 0x0A, 0x74, 0xDA, 0xBC, 0xB4, 0x69, 0x59, 0x9E, 0xBB, 0xEC,
-    0x6A, 0xCD, 0xE8, 0x20, 0x7A, 0x1D, 0x69, 0x9C, 0xE4, 0x3B, 0x20, 0x4D, 0x2F, 0xFE, 0x7A, 0xBE,
-    0xFE, 0x7F, 0xC5, 0x45, 0x94, 0x57, 0x89, 0xA0, 0x92, 0xF8, 0x6C, 0xA3, 0x4B, 0xDB, 0xCE, 0x6F,
-    0x09, 0x54, 0xB7, 0x04, 0x8C, 0x69, 0x30, 0xC2, 0xE1, 0x28, 0x7F, 0x52, 0xA0, 0xC2, 0xBE, 0x08,
-    0x79, 0xA1, 0x4A, 0xF1, 0xA9, 0x20, 0xC6, 0xE1, 0x66, 0x77, 0x06, 0x3C, 0x52, 0x0C, 0xAB, 0xEA,
-    0xFD, 0x3A, 0xDE, 0xAB, 0x14, 0xF3, 0x39, 0xE2, 0x1C, 0xAA, 0x86, 0x63, 0x32, 0x68, 0x67, 0x8A,
-    0xC7, 0x12, 0xBB, 0xE3, 0xD0, 0x2C, 0xA1, 0xA5, 0xA8, 0xDE, 0x84, 0xB1, 0xF9, 0xC9, 0x9C, 0xA3,
-    0xCD, 0xB6, 0xBC, 0x81, 0x6D, 0x96, 0x83, 0x76, 0xF4, 0x7B, 0xB3, 0x5F, 0x17, 0x2E, 0x8A, 0x9F,
-    0x43, 0xA6, 0x0A, 0x35, 0xE4, 0xFC, 0xC5, 0xE2, 0xCE, 0xE9, 0x73, 0xFC, 0x76, 0x73, 0x92, 0x91,
-    0x06, 0x86, 0x96, 0x4D, 0xDA, 0x17, 0xA6, 0x9B, 0xB4, 0x5A, 0xC9, 0x58, 0x86, 0x9C, 0x4D, 0x0F,
-    0x1C, 0x43, 0x0E, 0x6D, 0x97, 0x6D, 0x79, 0x76, 0x13, 0x05, 0xC2, 0x9E, 0x7A, 0x7C, 0xFA, 0x0E,
-    0xD3, 0xFC, 0x6B, 0x77, 0xEC, 0xEF, 0xEE, 0x43, 0x69, 0x49, 0xC8, 0x28, 0x98, 0x83, 0xE5, 0x08,
-    0xF3, 0x11, 0xB0, 0x0D, 0xC7, 0x8B, 0x7E, 0x88, 0xB5, 0x34, 0x14, 0x0B, 0xFC, 0xED, 0x75, 0x2A,
-    0xAF, 0x0F, 0x7E, 0xA0, 0xDB, 0x6B, 0xC6, 0x2C, 0x3E, 0x67, 0x19, 0x31, 0x76, 0xBF, 0x52, 0x85,
-    0xF6, 0x41, 0x00, 0x43, 0x8C, 0xD5, 0x9E, 0x9C, 0xC0, 0x3F, 0x2D, 0x50, 0x31, 0x4E, 0x03, 0x31,
-    0x10, 0x9C, 0xC4, 0x44, 0x96, 0xB8, 0xE2, 0x0A, 0x0A, 0x10, 0xCD, 0x3D, 0x00, 0xA1, 0x7B, 0x82,
-    0x8D, 0xF8, 0xC0, 0x15, 0xE1, 0x1D, 0x7C, 0x00, 0xE9, 0x4E, 0x50, 0xD0, 0xD2, 0xF0, 0x08, 0x68,
-    0x68, 0x52, 0x46, 0xB1, 0x9F, 0x70, 0x12, 0xD0, 0x47, 0x42, 0xE9, 0x5D, 0xB8, 0x38, 0x22, 0x5F,
-    0x86, 0xF5, 0x05, 0x4B, 0x2B, 0x79, 0x67, 0x76, 0x67, 0x67, 0x17, 0x40, 0x41, 0x8E, 0x8E, 0xDC,
-    0xBA, 0xD7, 0x8D, 0x8E, 0x6A, 0xDB, 0xDA, 0x6B, 0x1D, 0x81, 0xD6, 0x42, 0x93, 0x68, 0x19, 0xF4,
-    0xEF, 0x32, 0x67, 0x8E, 0xBE, 0x60, 0x42, 0xE6, 0x5C, 0x27, 0xF8, 0x94, 0x01, 0x27, 0x59, 0xA0,
-    0x03, 0xD9, 0xE9, 0xE0, 0x60, 0x6C, 0x42, 0x52, 0x5E, 0x07, 0xE0, 0xFE, 0xBB, 0x29, 0x49, 0x7B,
-    0x3E, 0x2E, 0x51, 0xEE, 0x1A, 0xD1, 0xF2, 0x97, 0x87, 0x37, 0x64, 0xA6, 0xEE, 0x70, 0x7A, 0x78,
-    0xDF, 0x18, 0x32, 0xCA, 0x5C, 0xDF, 0x60, 0x09, 0x2C, 0x2C, 0xF2, 0x53, 0xE2, 0x63, 0xFA, 0x08,
-    0xD9, 0x4F, 0x9F, 0xF6, 0x91, 0x47, 0x66, 0x28, 0xC2, 0x6C, 0x62, 0xBA, 0xF6, 0x26, 0x4E, 0x80,
-    0x0E, 0xB5, 0x9D, 0x00, 0xA7, 0xF7, 0x2F, 0xF5, 0x56, 0x0D, 0xF5, 0x0F, 0x59, 0xD1, 0x1B, 0x0E,
-    0x57, 0xFB, 0xA7, 0xF0, 0xA0, 0x38, 0x8A, 0x21, 0x73, 0x6B, 0xCD, 0x17, 0x54, 0x9C, 0xD3, 0xAA,
-    0x41, 0xAA, 0x6D, 0x49, 0x69, 0x11, 0x00, 0x55, 0x3A, 0x02, 0x17, 0x95, 0x37, 0x3D, 0x54, 0x3A,
-    0xF3, 0xA9, 0x96, 0xA9, 0x86, 0xE6, 0xE3, 0x59, 0x5A, 0xC1, 0xCF, 0x7F, 0x33, 0x16, 0x79, 0xCE,
-    0x02, 0x98, 0x73, 0x40, 0x25, 0x6B, 0xB7, 0xFD, 0x1A, 0xC4, 0x7A, 0x9E, 0xB0, 0xCA, 0x12, 0xB5,
-    0x40, 0x46, 0xA2, 0xC8, 0x6B, 0xEF, 0x57, 0x72, 0xAA, 0x80, 0x22, 0x66, 0x8B, 0x12, 0x07, 0x60,
-    0xC6, 0xDD, 0x5A, 0x2E, 0x26, 0x05, 0x59, 0xF0, 0x0E, 0x7F, 0x75, 0x52, 0x31, 0x8B, 0xD4, 0x40,
-    0x18, 0x7D, 0x33, 0x23, 0x44, 0x08, 0x92, 0x6D, 0x05, 0xB9, 0xF8, 0x07, 0xEE, 0xD2, 0x58, 0x58,
-    0xDC, 0x6D, 0xD2, 0x58, 0x2B, 0xE8, 0xD5, 0xFA, 0x23, 0x2C, 0x6C, 0xDC, 0x0D, 0x5C, 0xB9, 0x8D,
-    0x3F, 0xC1, 0x7A, 0xAE, 0x58, 0x04, 0x8B, 0x2B, 0xEE, 0x36, 0x11, 0x11, 0xCB, 0x5D, 0x5C, 0xEC,
-    0xC3, 0xFE, 0x82, 0x39, 0x37, 0x70, 0xC3, 0x99, 0xCD, 0xF8, 0x26, 0x89, 0x8B, 0x22, 0x0E, 0x79,
-    0x24, 0xDF, 0x97, 0x79, 0xDF, 0xFB, 0xE6, 0x7D, 0x03, 0x70, 0xDD, 0x23, 0xA2, 0x92, 0x58, 0x0D,
-    0x6F, 0xE7, 0xDC, 0x67, 0xC2, 0x14, 0x5A, 0x37, 0x21, 0x93, 0x58, 0x10, 0x21, 0xFF, 0x20, 0x27,
-    0xEE, 0x76, 0xBB, 0xA2, 0x86, 0xFB, 0xCA, 0xB8, 0xD8, 0x85, 0xCB, 0x65, 0xBE, 0xBE, 0x2E, 0xD1,
-    0x00, 0x69, 0xF7, 0x47, 0x19, 0xFC, 0x13, 0xEC, 0x97, 0x60, 0x15, 0xE1, 0x13, 0xB1, 0x2F, 0xD7,
-    0xEC, 0xA5, 0x5A, 0x7D, 0x6E, 0x01, 0x39, 0x00, 0xB6, 0xD7, 0xB9, 0xFF, 0xDF, 0x82, 0x7D, 0xB0,
-    0xFE, 0x51, 0x36, 0x3B, 0x16, 0x69, 0xC0, 0x87, 0x1D, 0x75, 0x3C, 0xAE, 0x87, 0x12, 0x18, 0x4B,
-    0x83, 0x34, 0x9B, 0x62, 0x4C, 0x4A, 0x4A, 0x89, 0x98, 0xF8, 0x76, 0xAB, 0xE7, 0x55, 0x92, 0x05,
-    0x95, 0xB2, 0xA1, 0xC1, 0x89, 0x30, 0x10, 0x18, 0x01, 0xAF, 0x11, 0xD4, 0x98, 0xD6, 0x81, 0xAB,
-    0x27, 0x6D, 0xBD, 0xDD, 0x96, 0xAC, 0x9C, 0x7A, 0x15, 0x65, 0xC4, 0xD3, 0x2F, 0x71, 0x7A, 0x92,
-    0x3A, 0x56, 0x40, 0x6A, 0x7C, 0x76, 0xD4, 0x09, 0x84, 0xF9, 0x60, 0x00, 0xB5, 0x83, 0xE5, 0x32,
-    0x7B, 0x7E, 0x9D, 0xF5, 0x5D, 0x91, 0x20, 0xB6, 0xDB, 0x15, 0x19, 0xCA, 0x19, 0x4F, 0x91, 0x15,
-    0x9C, 0x6B, 0xD8, 0x00, 0x8F, 0xEA, 0x8F, 0xEC, 0x0F, 0xD0, 0xD7, 0xB7, 0x50, 0x15, 0xA2, 0xFC,
-    0xF1, 0x58, 0x5A, 0x9B, 0x9C, 0x6D, 0xEA, 0x68, 0xEE, 0x5A, 0xE7, 0x6C, 0xAB, 0xDF, 0x35, 0x10,
-    0x3B, 0x88, 0x1A, 0x22, 0xFB, 0x73, 0xBF, 0xEF, 0xC7, 0x4F, 0x21, 0x09, 0x71, 0xB9, 0x90, 0x66,
-    0x11, 0x96, 0x93, 0xC4, 0xB5, 0x85, 0xDB, 0xE9, 0xB9, 0x77, 0x9F, 0x86, 0xBE, 0x05, 0x9E, 0x0D,
-    0x3E, 0xFB, 0xB1, 0x25, 0xD9, 0x03, 0x5C, 0x89, 0x46, 0xD4, 0x71, 0x19, 0x7C, 0xB2, 0x88, 0xD9,
-    0x41, 0x33, 0xA5, 0xD7, 0x0B, 0xAD, 0xF3, 0x2B, 0xEE, 0x69, 0x07, 0xA3, 0xF3, 0x81, 0xA3, 0xF2,
-    0x4E, 0xAD, 0x07, 0x9D, 0x52, 0x7E, 0x38, 0xB7, 0x5A, 0xBF, 0x67, 0x8C, 0x84, 0x81, 0x24, 0xCA,
-    0xE4, 0xC9, 0xE9, 0x2B, 0xE9, 0x33, 0xA9, 0xA7, 0x64, 0xBF, 0xE7, 0xDA, 0x27, 0x94, 0xE3, 0x2B,
-    0x85, 0xB2, 0x05, 0xD2, 0x8D, 0x53, 0x37, 0xB3, 0x69, 0x70, 0x70, 0xF8, 0x08, 0x6F, 0x3E, 0x42,
-    0x6C, 0x56, 0x08, 0x67, 0x19, 0x8E, 0x8E, 0x80, 0x8B, 0x0B, 0xC8, 0x4D, 0xC5, 0x30, 0xEF, 0xC2,
-    0xFD, 0x0A, 0xFB, 0xE3, 0xFA, 0x4A, 0x63, 0x7D, 0x6E, 0xFC, 0xE5, 0x90, 0x9A, 0x1F, 0xCC, 0x1C,
-    0xD3, 0xC1, 0x96, 0x89, 0x56, 0x9E, 0xBE, 0x98, 0x30, 0x1E, 0x0F, 0x0D, 0x04, 0x03, 0x75, 0x34,
-    0xFA, 0xAB, 0xE4, 0xA0, 0x10, 0x50, 0xF0, 0xE0, 0x10, 0x5E, 0xFF, 0xC3, 0x66, 0x7D, 0xF6, 0x73,
-    0x56, 0xA8, 0x36, 0x31, 0xD2, 0x2E, 0x20, 0x6F, 0x2A, 0x48, 0x1A, 0xC0, 0xF1, 0xF4, 0xFC, 0x3B,
-    0xBC, 0x50, 0x8A, 0xD7, 0x3A, 0xBF, 0x44, 0xF4, 0xFD, 0x65, 0xE9, 0xBD, 0x8A, 0xA8, 0xFD, 0x95,
-    0x33, 0xAB, 0x0B, 0x8E, 0x85, 0x09, 0x8B, 0x86, 0x57, 0x37, 0x2A, 0x39, 0x68, 0x73, 0xDC, 0xD3,
-    0x7E, 0x01, 0xA5, 0x56, 0x3D, 0x6C, 0xDD, 0xD6, 0x15, 0x3E, 0x97, 0xEC, 0x33, 0x81, 0xB0, 0xED,
-    0xF5, 0x50, 0x0D, 0x95, 0x00, 0x73, 0xC9, 0x54, 0x20, 0xE6, 0xDA, 0x41, 0x12, 0x59, 0x77, 0xC8,
-    0x90, 0xC1, 0x6E, 0xA1, 0xE7, 0x00, 0xED, 0xF0, 0x32, 0xBB, 0x83, 0x96, 0x0E, 0x1E, 0x64, 0x91,
-    0x8D, 0x87, 0x8C, 0x15, 0x0A, 0x78, 0xEA, 0xE0, 0xC5, 0x05, 0x6C, 0x6A, 0xD0, 0x52, 0x14, 0x46,
-    0xF3, 0x2C, 0x32, 0x79, 0x43, 0x86, 0x2C, 0x74, 0x93, 0xC0, 0x83, 0x87, 0xD0, 0xFD, 0x0B, 0x10,
-    0x0F, 0xBE, 0x4E, 0xE8, 0x94, 0xB2, 0x2E, 0x79, 0xF2, 0x1D, 0xF2, 0x3D, 0x49, 0x09, 0xAA, 0xC6,
-    0x46, 0x09, 0xF1, 0x89, 0xF7, 0x9E, 0x7B, 0xCF, 0xFD, 0xCE, 0x3D, 0xDF, 0xF9, 0x59, 0x8A, 0x49,
-    0xFD, 0xB2, 0x23, 0xDA, 0x0F, 0x0C, 0xE9, 0x82, 0x63, 0x65, 0xFD, 0x86, 0xA2, 0x38, 0xFA, 0x7C,
-    0xD7, 0xB8, 0xCC, 0x1D, 0x85, 0xCC, 0x05, 0x31, 0x35, 0xA4, 0xEB, 0x30, 0xA6, 0xE4, 0xBA, 0x21,
-    0xD7, 0x5E, 0x23, 0x0A, 0x1F, 0x16, 0xA4, 0xBA, 0x86, 0x48, 0x33, 0x11, 0xE5, 0x15, 0x91, 0xDB,
-    0xE2, 0x23, 0x4A, 0xF1, 0x13, 0xE3, 0x3D, 0x13, 0x53, 0xD4, 0x51, 0xC4, 0xD5, 0x0F, 0x1C, 0xDB,
-    0x4F, 0xEB, 0x8A, 0xF0, 0x95, 0xB3, 0x62, 0x7E, 0xAF, 0xDB, 0x34, 0xAD, 0xD3, 0xEC, 0x53, 0x87,
-    0x73, 0x26, 0x85, 0xFE, 0xC0, 0x78, 0x8F, 0xAC, 0x5B, 0x27, 0x8E, 0xD5, 0xFF, 0xB6, 0x0E, 0x5B,
-    0x0A, 0xA1, 0x17, 0xCF, 0xD2, 0x78, 0x1C, 0x30, 0x3F, 0x60, 0x6E, 0x6E, 0x5C, 0x06, 0xC2, 0x3C,
-    0xA5, 0xB0, 0x22, 0xA0, 0x73, 0xBA, 0x88, 0xF9, 0xF7, 0xCC, 0x7F, 0xCF, 0xFE, 0x28, 0x83, 0x23,
-    0xC9, 0x41, 0xB7, 0xDB, 0xE5, 0xCC, 0x9B, 0x82, 0xB8, 0x7F, 0x5E, 0x39, 0x50, 0x25, 0x8C, 0xB8,
-    0x19, 0x27, 0xCC, 0x35, 0xF0, 0xE5, 0x45, 0x04, 0x5B, 0x7E, 0xD6, 0x92, 0xEE, 0x7C, 0x43, 0xCF,
-    0x6D, 0x14, 0xEB, 0x77, 0x4C, 0x4B, 0x8D, 0x9E, 0x19, 0x9D, 0x26, 0xBA, 0x6C, 0x94, 0x8D, 0x2E,
-    0xA6, 0xBE, 0xE9, 0x2C, 0x45, 0x6F, 0x73, 0xA1, 0xAC, 0x6B, 0x29, 0xA8, 0x74, 0xF7, 0x26, 0x03,
-    0x38, 0x1B, 0xFF, 0x03, 0x6E, 0xE9, 0xFB, 0x34, 0xA6, 0xC5, 0x73, 0x17, 0x6F, 0x6F, 0x7E, 0x09,
-    0x13, 0x81, 0x39, 0xC0, 0x40, 0xEF, 0x95, 0xE4, 0x7D, 0x64, 0xC9, 0x35, 0x18, 0x34, 0x41, 0x45,
-    0x53, 0x28, 0x89, 0x88, 0xE3, 0x20, 0x85, 0xAA, 0xC2, 0xB5, 0x9E, 0x21, 0xBE, 0x50, 0x53, 0x80,
-    0x83, 0x3D, 0x0B, 0x60, 0x82, 0x97, 0xCB, 0xD1, 0x78, 0x3C, 0xD6, 0xDC, 0x5B, 0xCB, 0x86, 0x63,
-    0xC7, 0xC2, 0xA0, 0xF6, 0x5B, 0x3B, 0xDD, 0x8A, 0x72, 0xD9, 0x59, 0xD9, 0xC1, 0x07, 0xF9, 0x26,
-    0x8E, 0x7C, 0x92, 0x92, 0x2B, 0xF6, 0xE6, 0x06, 0x67, 0xD7, 0x70, 0x83, 0xDC, 0xDD, 0x59, 0x41,
-    0x37, 0x1E, 0xC7, 0x2B, 0x50, 0x06, 0x07, 0xDA, 0xE8, 0x79, 0x76, 0x07, 0x0A, 0x49, 0x63, 0x11,
-    0xCE, 0x17, 0x4F, 0x90, 0x98, 0xC4, 0xF2, 0x3E, 0x7E, 0x9E, 0x65, 0x99, 0x4C, 0x24, 0xF1, 0xB0,
-    0x42, 0x71, 0x2C, 0xB6, 0x70, 0x07, 0x5F, 0x71, 0x71, 0x06, 0x3A, 0x20, 0xFC, 0x91, 0x78, 0x97,
-    0x68, 0xB4, 0xF9, 0xB1, 0xC2, 0x26, 0x07, 0x92, 0x19, 0xEF, 0x76, 0x7F, 0xE8, 0xA8, 0xC5, 0x15,
-    0x44, 0x94, 0x50, 0x98, 0x86, 0x85, 0x2E, 0x7D, 0x08, 0x0E, 0xF1, 0x76, 0x79, 0xD6, 0x65, 0x7B,
-    0xC5, 0x36, 0x79, 0x42, 0x1B, 0xD6, 0x05, 0x05, 0x87, 0x60, 0x00, 0x24, 0x15, 0x34, 0x0B, 0x11,
-    0x64, 0x17, 0x8E, 0x99, 0xBB, 0x8A, 0x00, 0x35, 0x95, 0x4B, 0xC6, 0x0A, 0x9B, 0xEF, 0x00, 0x0C,
-    0x98, 0x14, 0x42, 0x78, 0x42, 0x61, 0x96, 0xDD, 0xC4, 0x84, 0xDB, 0x63, 0xFF, 0xD7, 0x78, 0x2C,
-    0x92, 0x22, 0x11, 0x74, 0x97, 0xB3, 0x5B, 0x30, 0x16, 0x6C, 0xE3, 0x54, 0x0B, 0xEC, 0x2C, 0x13,
-    0x42, 0x0A, 0x33, 0x28, 0x92, 0x1D, 0xB8, 0x16, 0x12, 0x66, 0xF0, 0x1E, 0x5E, 0x58, 0xBB, 0x2B,
-    0x77, 0xD4, 0xCD, 0x2D, 0x96, 0x15, 0xC9, 0xDF, 0xC4, 0x07, 0xF2, 0x46, 0xDC, 0xC5, 0x34, 0x82,
-    0xC8, 0x85, 0xD1, 0xA3, 0x6E, 0x03, 0x97, 0xCB, 0x0D, 0x09, 0xEC, 0x65, 0x98, 0x0B, 0xB8, 0x61,
-    0xE5, 0x1A, 0x40, 0xD8, 0x47, 0x8C, 0x04, 0x85, 0x7E, 0x2C, 0x0A, 0xF1, 0x72, 0xB6, 0xF7, 0x79,
-    0x9E, 0x3A, 0x35, 0x58, 0xBE, 0xED, 0xD5, 0xA4, 0x67, 0x96, 0x9C, 0xC3, 0x16, 0x57, 0xDF, 0x01,
-    0x50, 0xDB, 0xEB, 0xE8, 0xAF, 0x8F, 0x74, 0xD9, 0x5B, 0x9B, 0xF3, 0x81, 0xC0, 0x6D, 0xC4, 0xE5,
-    0x38, 0x7F, 0x45, 0xC4, 0xB9, 0x88, 0x8F, 0x15, 0xC2, 0x88, 0x74, 0x58, 0xAF, 0x9F, 0x8E, 0xC7,
-    0x9B, 0x0D, 0xE6, 0x1A, 0x6C, 0xA9, 0xCF, 0x64, 0x7F, 0x8A, 0x25, 0x34, 0x06, 0xBE, 0xF0, 0xFB,
-    0xF2, 0x53, 0xC2, 0xF3, 0x49, 0x21, 0x6C, 0x05, 0xB9, 0x40, 0x2B, 0x18, 0xA5, 0x58, 0x7C, 0xF9,
-    0x7F, 0x4D, 0x36, 0x20, 0x76, 0xC4, 0xF7, 0x99, 0x35, 0xD7, 0x09, 0x17, 0xA0, 0xE8, 0x86, 0xF8,
-    0x4E, 0x08, 0x85, 0x85, 0xF7, 0x10, 0x89, 0x6B, 0x08, 0xAA, 0x55, 0xD5, 0x87, 0x00, 0xB0, 0x46,
-    0xC0, 0x0A, 0x01, 0xF9, 0xF5, 0x70, 0xE7, 0xC2, 0x25, 0x71, 0xA1, 0xDC, 0x72, 0x4B, 0xDF, 0x03,
-    0x33, 0x03, 0x84, 0x5D, 0x04, 0x97, 0xE7, 0x30, 0x44, 0x82, 0xB8, 0xED, 0xB9, 0x80, 0xE7, 0x4A,
-    0x76, 0x3B, 0xE7, 0x36, 0xCB, 0x6E, 0xF7, 0xB7, 0x14, 0xA6, 0x62, 0x37, 0x88, 0x0A, 0x2D, 0x0A,
-    0xF2, 0xFD, 0xA3, 0xD9, 0xE2, 0xC4, 0x6C, 0x77, 0x62, 0xD6, 0x37, 0x83, 0x97, 0x31, 0x15, 0x93,
-    0x0F, 0xE7, 0xDB, 0x5E, 0x22, 0x5C, 0x6F, 0x7B, 0x92, 0x89, 0x14, 0x17, 0x8C, 0xA5, 0x4E, 0xD3,
-    0xEF, 0x83, 0xA7, 0x44, 0x09, 0x96, 0xCB, 0xA2, 0x61, 0xB9, 0xF8, 0xBC, 0x67, 0xFA, 0x96, 0xFC,
-    0xAD, 0x6E, 0x5D, 0xCD, 0xF7, 0x6D, 0xC0, 0x95, 0x8B, 0x10, 0xE4, 0x2A, 0xCF, 0x2D, 0x66, 0xCE,
-    0xF6, 0x22, 0xAC, 0x51, 0xB7, 0x14, 0x9B, 0x28, 0xFF, 0xB0, 0x98, 0x4E, 0xBD, 0x0F, 0x8B, 0xAD,
-    0xED, 0xC9, 0x8C, 0x6B, 0x5F, 0xDC, 0x18, 0xBE, 0x6E, 0x93, 0x59, 0x7D, 0x94, 0x23, 0xFC, 0x72,
-    0xE0, 0x12, 0x89, 0xEC, 0x9A, 0xC8, 0xC5, 0xCD, 0xB8, 0x2D, 0x0F, 0x02, 0x47, 0x04, 0xD6, 0xC9,
-    0x68, 0x4D, 0x71, 0x11, 0x50, 0x62, 0xFC, 0x02, 0x51, 0x5F, 0x51, 0xF8, 0x3B, 0xD8, 0x63, 0xA6,
-    0x90, 0xAD, 0x63, 0xC3, 0x45, 0x60, 0x7C, 0x8C, 0x7B, 0x64, 0xD8, 0x15, 0x42, 0xB3, 0x67, 0xE7,
-    0xF4, 0x45, 0x64, 0xD1, 0x25, 0xBA, 0xC0, 0xEA, 0x29, 0x7F, 0xD1, 0xD8, 0xA8, 0x5E, 0x73, 0x6B,
-    0x1D, 0xB7, 0xC8, 0x3C, 0x65, 0x6E, 0x3B, 0x6D, 0x75, 0xB1, 0x41, 0x6F, 0xA9, 0x58, 0xC5, 0x41,
-    0x1D, 0x98, 0xA8, 0x4D, 0xEC, 0xB5, 0xA8, 0x9E, 0x4E, 0x75, 0xB9, 0x3A, 0xD5, 0xD5, 0xEA, 0x34,
-    0xAC, 0xA7, 0x89, 0xCD, 0x9B, 0xD0, 0x84, 0x66, 0x14, 0x8F, 0xE2, 0x25, 0xEA, 0x6F, 0x67, 0xC0,
-    0x6A, 0x17, 0x6C, 0x7D, 0xF1, 0x09, 0x89, 0x5B, 0x78, 0x94, 0xE7, 0x8C, 0x1E, 0x9E, 0x3F, 0xE3,
-    0xF5, 0xEA, 0x45, 0x18, 0xCA, 0x1E, 0xE1, 0x83, 0x23, 0x95, 0x02, 0x99, 0x71, 0x30, 0x42, 0x58,
-    0xD2, 0x73, 0x5F, 0x68, 0xD3, 0x87, 0x7D, 0x9F, 0xC2, 0x64, 0x87, 0xA4, 0x8B, 0x0E, 0x74, 0xE3,
-    0x03, 0x21, 0x79, 0xB5, 0x94, 0x9C, 0xF2, 0xFC, 0x64, 0x63, 0x14, 0xF9, 0x9F, 0xBE, 0xFF, 0x1F,
-    0x73, 0xCF, 0x86, 0xC9, 0xCB, 0x7C, 0x5C, 0x39, 0x93, 0x92, 0xBA, 0x34, 0xB0, 0x86, 0x3C, 0x39,
-    0x56, 0xB0, 0x07, 0x80, 0xE5, 0x1C, 0x02, 0x56, 0x24, 0x64, 0x7A, 0x04, 0xD8, 0xAD, 0xE4, 0xAF,
-    0x62, 0x1F, 0xC8, 0x40, 0x96, 0x08, 0xAB, 0x7D, 0x83, 0x14, 0x8A, 0x3A, 0x52, 0x80, 0x5A, 0x1D,
-    0xF0, 0x7A, 0x06, 0x97, 0x11, 0xBD, 0x61, 0x90, 0x59, 0x41, 0x9F, 0xD1, 0xEB, 0xF8, 0x68, 0xB0,
-    0x39, 0xBA, 0xD0, 0x80, 0x9A, 0x58, 0xD3, 0x92, 0xE4, 0x0E, 0xCF, 0x38, 0x7D, 0x6D, 0x8D, 0x1D,
-    0xD1, 0xA3, 0x8B, 0x76, 0xD0, 0xEC, 0x7D, 0x21, 0x94, 0x4C, 0xC4, 0x5E, 0x49, 0xE2, 0xED, 0x1C,
-    0x86, 0xB7, 0xC8, 0x19, 0x9B, 0xFF, 0x44, 0x95, 0xB5, 0xB8, 0x61, 0xEB, 0xD7, 0x1E, 0xD4, 0x7A,
-    0x4F, 0x2D, 0xE9, 0x07, 0x60, 0xC9, 0x24, 0xA5, 0x7B, 0xDB, 0xE4, 0x3C, 0xC3, 0x21, 0xFF, 0x7B,
-    0x58, 0x02, 0xD4, 0x2F, 0xBE, 0x73, 0xD5, 0x89, 0x61, 0x8D, 0x13, 0x66, 0x88, 0x7F, 0xBF, 0xDB,
-    0x6C, 0x90, 0x67, 0x53, 0x8F, 0xE1, 0x9C, 0x0D, 0x71, 0xE9, 0x72, 0xDC, 0xD7, 0x9B, 0x88, 0x53,
-    0xC7, 0x6E, 0xC1, 0x79, 0x71, 0x5F, 0xF3, 0xBB, 0xC1, 0x6B, 0x08, 0xAA, 0x97, 0x1D, 0xAA, 0x47,
-    0xB8, 0xC6, 0x27, 0xB8, 0x55, 0x64, 0x91, 0x50, 0x92, 0xA3, 0xB3, 0x48, 0xDD, 0x92, 0x52, 0x82,
-    0x92, 0x4E, 0x7F, 0x76, 0x48, 0xED, 0x30, 0xFA, 0x8E, 0x04, 0x45, 0xFD, 0x22, 0xB0, 0x17, 0x97,
-    0x48, 0xC5, 0xE7, 0x62, 0x3A, 0x8F, 0x24, 0x14, 0x3D, 0x80, 0x05, 0x75, 0x3B, 0x54, 0xBA, 0xD3,
-    0x9E, 0x1F, 0xCF, 0x79, 0x28, 0x71, 0xAB, 0xDA, 0x79, 0x91, 0x73, 0x9B, 0x64, 0x66, 0x97, 0x17,
-    0x4B, 0x96, 0x7F, 0x8E, 0x68, 0x86, 0xF8, 0x25, 0xD4, 0xFE, 0x57, 0x58, 0xD2, 0x14, 0x45, 0x8D,
-    0xF3, 0x11, 0xEA, 0xD8, 0xE6, 0x05, 0x6E, 0x5E, 0xA5, 0xFD, 0x78, 0xB1, 0x7E, 0xA5, 0x52, 0x6F,
-    0xF3, 0x41, 0x30, 0x79, 0xC8, 0xF6, 0xAA, 0xC3, 0xE9, 0xE2, 0x60, 0x24, 0x43, 0x14, 0xB7, 0x67,
-    0x27, 0xC2, 0x69, 0x3E, 0xBC, 0x8F, 0xD4, 0x2F, 0x4D, 0x96, 0xDB, 0x41, 0xDD, 0x41, 0x73, 0x90,
-    0xB7, 0xAB, 0x7D, 0xEF, 0x45, 0x79, 0xFC, 0xDB, 0xBC, 0xDD, 0x8E, 0x12, 0xBE, 0xA8, 0x38, 0x8D,
-    0x47, 0xD2, 0x05, 0x9C, 0x45, 0x11, 0x9E, 0x61, 0x8F, 0xDA, 0xEB, 0x76, 0x16, 0xE7, 0xFD, 0x86,
-    0x6F, 0x69, 0x09, 0xD6, 0x6C, 0x17, 0xCE, 0xEB, 0x9B, 0x35, 0x52, 0x25, 0xB9, 0x25, 0x12, 0x30,
-    0xFE, 0xAE, 0xE4, 0xB7, 0x91, 0xE0, 0x96, 0x0E, 0x36, 0x86, 0x21, 0x32, 0x95, 0x86, 0xBC, 0xDF,
-    0xA8, 0xE6, 0xFD, 0xC9, 0x1C, 0x39, 0xCA, 0x6C, 0xF6, 0x0E, 0x86, 0x93, 0x79, 0x0E, 0x97, 0x58,
-    0x1F, 0x86, 0x2D, 0xCA, 0x13, 0xA2, 0xEA, 0x55, 0xB9, 0xA6, 0xB0, 0x76, 0x38, 0x46, 0xEF, 0x91,
-    0xA3, 0x79, 0xAC, 0xC8, 0x83, 0x63, 0xF1, 0xCF, 0xB7, 0x43, 0xF3, 0x84, 0x8A, 0x32, 0x1C, 0x83,
-    0xEF, 0xD5, 0x3E, 0xF8, 0xD1, 0xFA, 0x01, 0x3C, 0x05, 0x8D, 0x64, 0x89, 0x95, 0x06, 0xDF, 0xF8,
-    0xC4, 0xFC, 0x4F, 0x89, 0xBE, 0xB5, 0x5E, 0x9E, 0x73, 0xE4, 0x14, 0xA8, 0x5C, 0xBE, 0xC1, 0xBA,
-    0xCD, 0xDA, 0x43, 0xC3, 0xB2, 0x13, 0x34, 0x6E, 0x87, 0x54, 0xA2, 0xA4, 0x2D, 0x2C, 0x91, 0x2D,
-    0x3D, 0x8E, 0xD1, 0x9E, 0x05, 0x2D, 0x50, 0x60, 0x25, 0xEA, 0xA4, 0xAA, 0x24, 0x81, 0x1F, 0x3D,
-    0x3F, 0x24, 0xA7, 0x14, 0x3A, 0x8A, 0xB8, 0x5A, 0x69, 0x49, 0xF5, 0xBB, 0x1C, 0x96, 0xA6, 0x2E,
-    0x2C, 0x11, 0x83, 0x49, 0x15, 0x08, 0x8C, 0xC4, 0x88, 0x7A, 0x99, 0xC0, 0xCA, 0x9A, 0x5E, 0x5B,
-    0xEC, 0x3F, 0xB5, 0x92, 0x57, 0xF3, 0x44, 0x96, 0xCF, 0xDB, 0xE2, 0x53, 0x2A, 0xF9, 0x71, 0x6B,
-    0x45, 0x41, 0xDA, 0x97, 0x8B, 0xE5, 0x6F, 0x74, 0x42, 0xC8, 0x36, 0x69, 0xDF, 0x5A, 0xC1, 0x4A,
-    0x74, 0x1E, 0x8D, 0x53, 0x43, 0x23, 0xAE, 0x15, 0xAD, 0x95, 0x6B, 0x51, 0x00, 0xF2, 0x27, 0x9F,
-    0x1C, 0x77, 0x42, 0xAA, 0xCB, 0x6E, 0x49, 0xB5, 0x3C, 0x4A, 0xCD, 0xC3, 0x33, 0x9A, 0x8F, 0xFA,
-    0xD6, 0x0F, 0xFB, 0x71, 0x7F, 0xC7, 0x90, 0xF5, 0xA7, 0x48, 0x5F, 0x55, 0x8E, 0x0A, 0x09, 0xC8,
-    0x16, 0x90, 0xF7, 0x71, 0x80, 0x9C, 0x1A, 0x48, 0x3B, 0x57, 0xEA, 0xA7, 0x6F, 0x3E, 0x3B, 0x01,
-    0x39, 0xBF, 0x13, 0xF7, 0x38, 0x8F, 0xF2, 0xFE, 0x40, 0x05, 0x30, 0x12, 0x79, 0xBA, 0x94, 0x3E,
-    0x3B, 0x79, 0x9E, 0xDD, 0x96, 0x4E, 0x40, 0xEC, 0x95, 0x03, 0xD5, 0x37, 0x5B, 0xCB, 0x1B, 0xE3,
-    0x4B, 0x58, 0xD9, 0x0A, 0x97, 0x62, 0xF5, 0xAB, 0x2C, 0x1D, 0xEE, 0x90, 0xA5, 0x57, 0xE2, 0x37,
-    0xA4, 0x95, 0x59, 0x02, 0x75, 0xD0, 0x16, 0x54, 0xC2, 0xA5, 0x18, 0x4D, 0x50, 0x2D, 0xBB, 0xE6,
-    0x9D, 0x62, 0x5F, 0xE3, 0xDB, 0x45, 0xE3, 0xF6, 0xDE, 0x78, 0x9C, 0xDF, 0x97, 0xC2, 0x80, 0x63,
-    0xCB, 0x57, 0xB2, 0x1B, 0x47, 0x24, 0x6D, 0x30, 0xD1, 0x41, 0x07, 0x88, 0xA4, 0xEE, 0xF4, 0xB5,
-    0x09, 0xE9, 0xFB, 0xE1, 0xCD, 0x52, 0xD5, 0xE7, 0xBD, 0x52, 0xD3, 0x5D, 0xAF, 0xB8, 0xEB, 0x54,
-    0xFE, 0xF5, 0xC2, 0x4F, 0xF5, 0x39, 0x3A, 0x4F, 0x6B, 0xDB, 0xE8, 0x55, 0xBF, 0x92, 0x12, 0xF3,
-    0xD9, 0x27, 0xBF, 0xBE, 0x31, 0x99, 0xC8, 0xD4, 0x2A, 0xF8, 0x69, 0x64, 0x55, 0x5A, 0xFB, 0xE9,
-    0x96, 0x6A, 0xCE, 0xFB, 0xA5, 0xEA, 0xFE, 0xDA, 0x0A, 0x56, 0x40, 0x1E, 0x89, 0xDF, 0x8E, 0x55,
-    0x7F, 0x3C, 0x81, 0x6A, 0x14, 0x74, 0x8D, 0x42, 0x5D, 0x80, 0xD7, 0x50, 0x0D, 0x73, 0x03, 0x88,
-    0xA1, 0x3A, 0x5B, 0xA8, 0x1E, 0x8F, 0xA1, 0x9A, 0x44, 0x35, 0x41, 0x35, 0x56, 0xA5, 0xB0, 0x06,
-    0xAA, 0x49, 0x54, 0x5F, 0xFE, 0x2E, 0xD5, 0xC8, 0x3D, 0xC5, 0xBB, 0xC6, 0x7D, 0x7C, 0x7D, 0x66,
-    0xD6, 0xF5, 0x39, 0xF7, 0xCB, 0x6A, 0xED, 0x2A, 0x88, 0xFE, 0x17, 0x74, 0xA3, 0xCE, 0x67, 0x69,
-    0x64, 0xFC, 0x89, 0xFB, 0x0F, 0xB3, 0xB6, 0xBA, 0xEE, 0x1A, 0xF3, 0x6E, 0xE5, 0x1E, 0xA6, 0x1D,
-    0xD8, 0xF1, 0xA2, 0xAA, 0x91, 0xC2, 0x81, 0x1A, 0xAA, 0x0B, 0x5A, 0x07, 0x6A, 0x17, 0xAA, 0x69,
-    0x5D, 0x54, 0x57, 0x50, 0xBD, 0x4E, 0x50, 0x5D, 0x01, 0x35, 0x3A, 0x11, 0xA8, 0x06, 0xEA, 0xEE,
-    0x34, 0xD4, 0xF2, 0x13, 0x0D, 0xBD, 0x81, 0x50, 0x43, 0x28, 0xF2, 0x22, 0x43, 0xE9, 0x92, 0xF3,
-    0xA1, 0xEB, 0xAD, 0x16, 0xCD, 0x53, 0x90, 0xFA, 0x85, 0x5F, 0x22, 0x74, 0xD3, 0x64, 0xD6, 0x3A,
-    0x08, 0x3C, 0xBF, 0xF2, 0xCC, 0xBC, 0xC3, 0xA3, 0xAF, 0x01, 0x1D, 0xCD, 0xB1, 0x0D, 0xC2, 0x40,
-    0x0C, 0x05, 0xD0, 0x9F, 0x13, 0x1D, 0x43, 0x64, 0x02, 0xF0, 0x06, 0x80, 0x32, 0x53, 0x0A, 0x1A,
-    0x74, 0xEE, 0x18, 0xEB, 0x76, 0x60, 0x82, 0x24, 0x13, 0x50, 0xBA, 0x48, 0xCE, 0xF1, 0xB7, 0x25,
-    0x3F, 0xF9, 0xDB, 0x85, 0x01, 0xBC, 0xC0, 0x7A, 0xA7, 0x55, 0x53, 0xA3, 0xF3, 0xC8, 0x30, 0xE7,
-    0xE5, 0x73, 0xB9, 0x46, 0xA8, 0xBE, 0x18, 0x3D, 0x44, 0x43, 0xFF, 0x1A, 0x5D, 0x5D, 0x43, 0x6D,
-    0x26, 0x6E, 0x78, 0xF6, 0xE2, 0x3B, 0x5A, 0x87, 0xF8, 0xE4, 0x1D, 0xC5, 0xB7, 0x10, 0xB2, 0xC7,
-    0x26, 0x02, 0x67, 0xC8, 0x8F, 0x96, 0xFF, 0x83, 0x3F, 0x6E, 0x77, 0x5A, 0x7A, 0x3E, 0xCF, 0x19,
-    0x43, 0xF4, 0x09,
+static const uint8_t bookerly_12_boldBitmaps[24536] = {
+    0xBD, 0x9A, 0x31, 0xF0, 0xDF, 0xC6, 0x95, 0xDF, 0x3F, 0xC0, 0xEA, 0x4F, 0x38, 0xC6, 0x8C, 0x97,
+    0x05, 0xFF, 0x39, 0x9D, 0x75, 0x67, 0xB8, 0x50, 0xE1, 0x9B, 0x49, 0x6E, 0x9B, 0x2B, 0x5C, 0x48,
+    0xDC, 0xB5, 0x99, 0x19, 0x16, 0x2A, 0xF8, 0xCF, 0x84, 0xBF, 0x5C, 0xA1, 0xC2, 0x57, 0x2B, 0x93,
+    0x63, 0x8A, 0x2B, 0xAE, 0x10, 0x09, 0x88, 0x2A, 0x54, 0xB8, 0x20, 0x2B, 0x17, 0x49, 0xE1, 0x64,
+    0x46, 0x99, 0xF1, 0xFD, 0xE7, 0x66, 0x94, 0xC2, 0x85, 0x0B, 0x52, 0x58, 0xF2, 0x9F, 0x19, 0x15,
+    0x2A, 0x0C, 0x59, 0x99, 0x49, 0xE1, 0x82, 0x38, 0x29, 0x99, 0x4B, 0xAC, 0x42, 0x2B, 0x09, 0x8A,
+    0x20, 0x69, 0x81, 0x6F, 0x0A, 0xFC, 0xFE, 0x24, 0xA5, 0xD0, 0x8E, 0x2D, 0x4B, 0xC6, 0x6F, 0x81,
+    0xDF, 0xE2, 0x01, 0xFB, 0xDE, 0xC3, 0xDB, 0xDD, 0xB7, 0xEF, 0x7D, 0x81, 0xAF, 0xBF, 0x98, 0xFD,
+    0x4B, 0x53, 0x7B, 0x61, 0xF2, 0x26, 0x6D, 0xC5, 0x15, 0x09, 0xCE, 0xBA, 0x93, 0xEC, 0xE3, 0xD1,
+    0xB5, 0xA6, 0xBD, 0x71, 0xEF, 0xCD, 0x0F, 0xA6, 0xBC, 0x78, 0x67, 0x5F, 0x3F, 0x79, 0x7F, 0x9C,
+    0xD9, 0x6F, 0xCE, 0x8C, 0xF8, 0x6A, 0xE0, 0x7C, 0x1D, 0x0F, 0x5E, 0xFD, 0xC1, 0x7F, 0x6B, 0xA4,
+    0xFC, 0xCD, 0xB5, 0xFF, 0x5F, 0xCC, 0x8E, 0x62, 0xF2, 0x94, 0xE9, 0x3C, 0xAD, 0x94, 0x24, 0xA5,
+    0x7A, 0xC8, 0xD4, 0x71, 0xC6, 0xDE, 0x99, 0xB0, 0xD7, 0xD3, 0xD6, 0xBE, 0x0A, 0x94, 0x03, 0xFC,
+    0x14, 0xAE, 0x85, 0x42, 0x6B, 0x29, 0x0D, 0xF9, 0xBD, 0xF9, 0xEA, 0x53, 0x4F, 0x37, 0x37, 0x0E,
+    0xAA, 0x4F, 0x23, 0x9A, 0xB0, 0x1A, 0x69, 0x85, 0xD1, 0xD0, 0x7D, 0x90, 0xA7, 0xA7, 0xDA, 0xF3,
+    0xDF, 0x68, 0x6E, 0xFC, 0xE3, 0x8F, 0xEF, 0x4A, 0x43, 0xA3, 0x8E, 0x3F, 0x87, 0xBA, 0xA3, 0x1C,
+    0xE1, 0x67, 0xF0, 0x67, 0xA7, 0x6A, 0x9D, 0xB9, 0xC9, 0xB7, 0x28, 0x94, 0xC8, 0xD8, 0x5F, 0x8E,
+    0xD5, 0xC0, 0x6D, 0x1B, 0x3D, 0x26, 0xF9, 0x22, 0x61, 0xE3, 0x2D, 0xDB, 0xE1, 0x4D, 0xBA, 0x05,
+    0xD9, 0x9E, 0x0C, 0x94, 0xD3, 0x35, 0x57, 0x2F, 0x46, 0x69, 0x5A, 0x97, 0x72, 0xB5, 0x2F, 0x0D,
+    0x19, 0x9E, 0x77, 0x26, 0x61, 0xC6, 0x5C, 0x47, 0x9C, 0x49, 0x0E, 0x66, 0x1B, 0x33, 0x75, 0x74,
+    0x17, 0x46, 0xAE, 0xE2, 0x7B, 0x4C, 0xA2, 0x4D, 0x54, 0x81, 0x73, 0x3C, 0xBC, 0xD5, 0x2B, 0xE0,
+    0xD5, 0xC1, 0x6A, 0x23, 0xE4, 0x3A, 0x52, 0x64, 0x1B, 0x29, 0x72, 0x13, 0x60, 0x79, 0x1A, 0x58,
+    0xBF, 0x0D, 0xA5, 0x0A, 0x25, 0xAB, 0x3B, 0x4A, 0xEE, 0xE7, 0xA3, 0xC7, 0x5F, 0x9C, 0x1D, 0xBE,
+    0x5C, 0x1D, 0x3E, 0xF4, 0xC2, 0x77, 0x6E, 0xC5, 0x8D, 0x56, 0x37, 0xAD, 0xA4, 0xA5, 0x94, 0x7E,
+    0x90, 0x39, 0x38, 0xE2, 0xE8, 0xDA, 0xBA, 0x2C, 0xCB, 0xAD, 0x5B, 0x3F, 0x83, 0xEF, 0x70, 0xBB,
+    0xCC, 0x55, 0xB2, 0x43, 0x13, 0x7D, 0xF0, 0x5C, 0xE3, 0x55, 0x96, 0xFB, 0xBF, 0x57, 0x69, 0xF1,
+    0xC1, 0x75, 0x76, 0xA8, 0x93, 0x99, 0x59, 0x79, 0x0A, 0xFE, 0x04, 0x1B, 0xCB, 0x8C, 0x8B, 0x66,
+    0xA2, 0xC5, 0x0E, 0xE5, 0x4C, 0x8B, 0x8D, 0x66, 0x62, 0xC1, 0x07, 0x3B, 0x98, 0x44, 0xE6, 0x1A,
+    0x3E, 0xD8, 0x68, 0x87, 0x2A, 0x99, 0xC9, 0x4C, 0xFC, 0x14, 0x80, 0xB3, 0x5C, 0x8C, 0x4F, 0x3F,
+    0x6F, 0x3E, 0xFD, 0x17, 0xB5, 0xEE, 0xF4, 0xD9, 0xFF, 0xF4, 0xFB, 0xAF, 0x45, 0x6E, 0x01, 0xDC,
+    0x7A, 0x50, 0x9E, 0x5B, 0x7F, 0xD2, 0x6B, 0x39, 0x5E, 0x7F, 0xF2, 0x30, 0x11, 0x28, 0x82, 0x8F,
+    0x7D, 0x91, 0xEB, 0xC1, 0x97, 0x93, 0x0D, 0x4F, 0xE2, 0x74, 0x49, 0x6F, 0x6B, 0xFA, 0xE3, 0xE6,
+    0x9D, 0x65, 0x3D, 0x00, 0x3C, 0xB8, 0x0E, 0x3B, 0x50, 0x25, 0xCC, 0x44, 0x91, 0xE1, 0xD5, 0xFB,
+    0xD4, 0xF8, 0x10, 0x75, 0x7D, 0x88, 0x5A, 0x27, 0xCC, 0xB4, 0x99, 0xBB, 0x08, 0x14, 0x9A, 0x71,
+    0x9A, 0x0B, 0x5D, 0x99, 0x6D, 0xB2, 0xA9, 0x0D, 0xEE, 0xCD, 0x4C, 0x7B, 0x23, 0x15, 0xAB, 0x8F,
+    0x26, 0xAF, 0xD8, 0x0F, 0x66, 0xFC, 0x76, 0x5A, 0x4D, 0xC2, 0xDF, 0x59, 0x8B, 0xD5, 0xAC, 0x57,
+    0x52, 0x25, 0x05, 0xA3, 0x11, 0x2E, 0xEF, 0x47, 0x32, 0x4F, 0x28, 0xB4, 0xC2, 0x0B, 0xFA, 0xDF,
+    0x54, 0x0A, 0xBD, 0xEC, 0x95, 0xBD, 0x32, 0x07, 0xE0, 0x14, 0x1A, 0x2D, 0x66, 0xBD, 0x92, 0xDA,
+    0xA0, 0x8B, 0xA9, 0x9E, 0x3C, 0x7D, 0xC0, 0x26, 0xCA, 0x05, 0xFA, 0x8E, 0x26, 0x51, 0xCD, 0x14,
+    0x2B, 0xF4, 0x1D, 0x6E, 0xA0, 0x92, 0x72, 0x2B, 0x9D, 0x48, 0x33, 0x07, 0x14, 0xFD, 0x52, 0x4A,
+    0x83, 0x9E, 0xCD, 0xE7, 0xE9, 0x2B, 0x5C, 0xC4, 0x8E, 0x34, 0x63, 0xD1, 0x27, 0xA4, 0xF0, 0xAD,
+    0x2B, 0x89, 0x62, 0x85, 0xB6, 0xC3, 0x0D, 0xB8, 0x74, 0xD0, 0x4F, 0x5E, 0x53, 0xAD, 0x91, 0x43,
+    0x80, 0x02, 0xE8, 0xA1, 0x14, 0x54, 0x02, 0x2B, 0x36, 0xDD, 0x7B, 0xC8, 0x3D, 0x66, 0xEA, 0xA9,
+    0xC7, 0x9E, 0x26, 0xF6, 0xF8, 0x63, 0xFD, 0xA4, 0x95, 0xB2, 0x97, 0xF2, 0xC1, 0xAE, 0xBF, 0x0C,
+    0x3D, 0x0F, 0xF6, 0x8D, 0x99, 0x34, 0xF4, 0x4A, 0x4E, 0xB9, 0x1E, 0x31, 0x33, 0x28, 0xE0, 0xD5,
+    0x59, 0xE5, 0xE2, 0x59, 0x75, 0x34, 0x09, 0x93, 0x41, 0xE0, 0x23, 0x7E, 0x3C, 0xE8, 0x53, 0xAB,
+    0x64, 0x35, 0x6C, 0x8D, 0xCF, 0x41, 0x3B, 0xD1, 0x2A, 0x36, 0x6B, 0x30, 0x2B, 0x28, 0xD0, 0x8C,
+    0x18, 0x7D, 0x8C, 0xD7, 0x52, 0xAD, 0x7D, 0xEA, 0x43, 0xFF, 0xC3, 0xC9, 0xE4, 0x36, 0xF8, 0xD7,
+    0x66, 0x93, 0x7D, 0xF4, 0xD7, 0xF5, 0xE3, 0xC9, 0x6A, 0xC5, 0x29, 0x70, 0x00, 0x80, 0xD9, 0xF4,
+    0x3B, 0x91, 0xF2, 0x79, 0xFC, 0x85, 0xC1, 0x8E, 0x8F, 0x17, 0x19, 0x7C, 0xC0, 0x26, 0x8A, 0x05,
+    0x7C, 0xA4, 0x9A, 0x40, 0xD0, 0x8C, 0x94, 0x1B, 0xC1, 0x64, 0x70, 0x1D, 0x1C, 0x01, 0x07, 0xD0,
+    0xA8, 0xAB, 0xA5, 0x62, 0xAD, 0x27, 0x1F, 0xFD, 0x8B, 0xB3, 0x99, 0xDD, 0xD0, 0xA3, 0x57, 0x86,
+    0x4A, 0x13, 0x4E, 0x9D, 0x7D, 0x47, 0x66, 0xB6, 0x73, 0x1B, 0xFC, 0xEB, 0xC9, 0xE4, 0x3E, 0xF8,
+    0x93, 0xE5, 0x07, 0x93, 0xD3, 0x4A, 0xAB, 0xC0, 0xE1, 0xC6, 0xC2, 0x09, 0xAB, 0xA5, 0x5C, 0xAF,
+    0x24, 0xDF, 0xF5, 0x2F, 0x3D, 0xAC, 0xB3, 0xBB, 0xAB, 0xFF, 0x90, 0xAD, 0x14, 0x9F, 0xD0, 0xA6,
+    0x86, 0x1F, 0xB0, 0x99, 0x46, 0xB4, 0xEA, 0x8C, 0x06, 0x0E, 0x02, 0xB8, 0x2B, 0x9F, 0xE6, 0xBC,
+    0x77, 0x41, 0x17, 0x3F, 0x51, 0xFB, 0x42, 0xA8, 0x87, 0xF6, 0x8E, 0xCA, 0xE9, 0xBE, 0x83, 0x38,
+    0x40, 0x65, 0xAE, 0x92, 0x0B, 0xB9, 0x1E, 0x9E, 0xE6, 0xE6, 0x46, 0xFC, 0x5B, 0xAA, 0x4C, 0x3B,
+    0x56, 0x2B, 0xED, 0x48, 0x1F, 0xF0, 0x13, 0x95, 0x02, 0xED, 0x44, 0x95, 0xE1, 0x6F, 0x81, 0x5E,
+    0x4B, 0xAF, 0xE5, 0xB9, 0xE3, 0x9F, 0x00, 0x87, 0xBB, 0xCB, 0xDB, 0xE9, 0xD6, 0xF8, 0xBB, 0xDB,
+    0x08, 0x99, 0x29, 0x15, 0x70, 0x13, 0xE5, 0x42, 0x9D, 0xE9, 0x87, 0x66, 0xA1, 0xED, 0xF8, 0x2E,
+    0xFB, 0xB1, 0xD2, 0x8F, 0x95, 0x92, 0x55, 0x7A, 0xB2, 0x19, 0xB0, 0x11, 0x07, 0xB7, 0xB8, 0x92,
+    0x9C, 0x82, 0x26, 0xB3, 0x50, 0x47, 0xBE, 0xB5, 0x9F, 0xED, 0x75, 0xC2, 0x0F, 0xF4, 0x9B, 0x55,
+    0x39, 0x02, 0xCE, 0x68, 0x0D, 0x14, 0x92, 0x22, 0xEE, 0xE3, 0x5D, 0x3F, 0x94, 0x2B, 0xF8, 0xE8,
+    0x22, 0xF8, 0x2E, 0x17, 0xC2, 0xD7, 0xA3, 0x17, 0xB7, 0x7D, 0x99, 0x6E, 0x17, 0x1F, 0xE6, 0xEA,
+    0x85, 0xB9, 0x7A, 0x67, 0xA4, 0x1A, 0x9B, 0x57, 0x42, 0xAD, 0xEE, 0xF6, 0x52, 0x2C, 0xAF, 0x9A,
+    0xF7, 0x27, 0x7B, 0x67, 0xB6, 0x3F, 0x1C, 0xFD, 0x33, 0x1F, 0xE6, 0x26, 0xF6, 0xD2, 0xE0, 0xE9,
+    0x9F, 0x99, 0x11, 0x00, 0xEB, 0x36, 0x04, 0x03, 0x0D, 0x85, 0x7E, 0xF5, 0xCA, 0x0C, 0xBD, 0xD4,
+    0xC1, 0x13, 0xEB, 0x4D, 0x80, 0x6F, 0x02, 0x68, 0x7F, 0x0B, 0x46, 0x71, 0x7F, 0xA8, 0xEF, 0x0D,
+    0x60, 0x6F, 0x24, 0x70, 0x97, 0x12, 0xF8, 0x6A, 0x86, 0x6B, 0x26, 0xC3, 0xF2, 0x97, 0x0B, 0x48,
+    0x2B, 0xA5, 0x24, 0x4C, 0x42, 0xA1, 0x1A, 0x69, 0xA3, 0x1D, 0xF0, 0x43, 0x9F, 0x4B, 0x65, 0x2D,
+    0x46, 0xF9, 0xE0, 0xB9, 0x97, 0xF1, 0x52, 0xE7, 0xA4, 0xD1, 0x64, 0x9B, 0x4C, 0xAE, 0x26, 0x93,
+    0x4D, 0x32, 0xB9, 0x4A, 0x26, 0xDB, 0xC1, 0x48, 0xD1, 0x48, 0xC9, 0xE4, 0x27, 0xB2, 0xC9, 0x26,
+    0x9B, 0x5C, 0x2E, 0x26, 0x97, 0x5B, 0x7D, 0xB9, 0x32, 0x3B, 0x69, 0xF4, 0x5A, 0xF7, 0xFD, 0xBD,
+    0x86, 0x52, 0x8A, 0x5E, 0x32, 0x0B, 0xD9, 0x0D, 0x26, 0x89, 0xFA, 0xA5, 0x09, 0xDC, 0x00, 0x02,
+    0x93, 0xC1, 0x4E, 0xE0, 0x47, 0xE8, 0x23, 0x85, 0x02, 0x46, 0x5D, 0x71, 0x51, 0x5A, 0x2A, 0x29,
+    0x95, 0x5A, 0xE1, 0x10, 0x0E, 0x9E, 0xFB, 0x3B, 0x90, 0x34, 0x94, 0x92, 0x12, 0x2A, 0xFA, 0x64,
+    0x32, 0xED, 0x60, 0x13, 0x7D, 0xF4, 0x11, 0x21, 0xCC, 0x62, 0x32, 0x76, 0xB2, 0x09, 0x3F, 0x9C,
+    0x92, 0xB2, 0xC9, 0x34, 0xA3, 0x4D, 0x08, 0x1F, 0xEB, 0x19, 0xFD, 0x7B, 0x75, 0x4E, 0x9A, 0x90,
+    0x3E, 0xDE, 0x0F, 0xBD, 0xC3, 0xDD, 0xEE, 0xB2, 0x97, 0xB2, 0x93, 0xB2, 0x59, 0x8A, 0x6C, 0x32,
+    0xCF, 0x9B, 0xCC, 0x5F, 0x98, 0xBC, 0x69, 0xB7, 0x7F, 0xDC, 0x68, 0xD6, 0xE3, 0xB0, 0xA7, 0x9D,
+    0x35, 0x99, 0xA7, 0x4C, 0xE6, 0x96, 0x59, 0x8F, 0xB3, 0xDB, 0xA6, 0xE8, 0x7C, 0xB8, 0xDB, 0xFD,
+    0x2B, 0x49, 0x4E, 0x4A, 0x7E, 0x68, 0x4D, 0x2E, 0x93, 0x8F, 0x7F, 0x6A, 0xF2, 0x36, 0x23, 0xD7,
+    0xE3, 0xCE, 0x2B, 0x1B, 0xA9, 0xDB, 0xCF, 0xCF, 0xD3, 0xBF, 0x01, 0xA7, 0xD1, 0x68, 0x85, 0x33,
+    0xFD, 0x4D, 0x9C, 0x84, 0x97, 0x06, 0x3F, 0x99, 0xC9, 0x8D, 0xDC, 0xB6, 0x89, 0xA6, 0x9A, 0xA1,
+    0x5C, 0xF6, 0x5D, 0xED, 0x63, 0xB1, 0xBB, 0x94, 0x8C, 0x3E, 0x5A, 0x68, 0x73, 0xDF, 0xA1, 0x66,
+    0xC2, 0x9F, 0x28, 0xD8, 0xD4, 0xAE, 0xAF, 0xE4, 0x4A, 0x12, 0x4E, 0x1F, 0xC3, 0x61, 0xE0, 0x70,
+    0x17, 0x76, 0x3B, 0xAB, 0xC9, 0xEB, 0x2D, 0xCD, 0xB5, 0x46, 0x9B, 0x70, 0x83, 0xC9, 0xD4, 0x13,
+    0xA2, 0x5C, 0xF0, 0x91, 0x3E, 0x6C, 0x44, 0x6D, 0x16, 0xD1, 0x82, 0xFF, 0xD5, 0xB1, 0xC2, 0xA3,
+    0xEF, 0x9C, 0xF0, 0xA3, 0xD3, 0xD0, 0xEB, 0x86, 0x26, 0xAF, 0xF1, 0x70, 0x77, 0x41, 0x8B, 0x53,
+    0xE7, 0xA3, 0xC9, 0xFC, 0xFA, 0xC3, 0xE0, 0xF4, 0xA6, 0x96, 0x62, 0x77, 0xB9, 0xD2, 0x62, 0x34,
+    0xE3, 0xE3, 0x6F, 0x5D, 0x3A, 0xFA, 0x0E, 0x51, 0xAD, 0xF8, 0x99, 0x66, 0xD8, 0xFA, 0x2A, 0xEC,
+    0x8E, 0x24, 0xAB, 0x5F, 0x68, 0xB2, 0x0B, 0xA2, 0xED, 0x4C, 0xAE, 0x66, 0x6C, 0x6A, 0x3B, 0xFC,
+    0xC9, 0x04, 0x6A, 0x03, 0x46, 0x33, 0x58, 0x4D, 0xE0, 0xEF, 0x25, 0x90, 0x4B, 0x98, 0xEC, 0x13,
+    0x36, 0xF9, 0x84, 0x8F, 0x6D, 0x42, 0xA1, 0x9D, 0x9C, 0x62, 0x3B, 0x4B, 0xB4, 0x03, 0x70, 0x8E,
+    0xC3, 0x5D, 0xC0, 0x6B, 0xC0, 0xA9, 0xE3, 0x7E, 0xD7, 0xFF, 0xE6, 0xFD, 0x29, 0x93, 0xB9, 0x6A,
+    0x32, 0xB7, 0x1F, 0x1E, 0x06, 0xC5, 0x2E, 0x14, 0xBB, 0x23, 0xAB, 0x68, 0x94, 0x2A, 0x0D, 0x95,
+    0x06, 0x34, 0xD6, 0x02, 0x25, 0x2B, 0x8A, 0x4F, 0xA7, 0xA6, 0x0F, 0xC5, 0x47, 0xB3, 0xF3, 0xA1,
+    0xFC, 0x3F, 0xF9, 0xBC, 0x0F, 0xE5, 0x7B, 0xF9, 0x69, 0xDF, 0x95, 0x69, 0x79, 0xDE, 0x77, 0x26,
+    0xF5, 0xB3, 0x8F, 0x26, 0xB5, 0x93, 0x8F, 0x26, 0xF9, 0xE4, 0xA2, 0x49, 0x6E, 0x74, 0xB1, 0x4A,
+    0x76, 0x70, 0xB1, 0x1A, 0x6D, 0x74, 0x83, 0x5F, 0xCF, 0x04, 0xE5, 0x56, 0x14, 0xCA, 0x87, 0x97,
+    0x39, 0xDC, 0x35, 0x0A, 0x4E, 0x77, 0x95, 0x2A, 0x0D, 0x76, 0xA5, 0x89, 0x46, 0x43, 0x95, 0x50,
+    0x2E, 0x32, 0x5E, 0x5D, 0x8B, 0xBD, 0x37, 0x35, 0xD1, 0xBC, 0xAF, 0x2A, 0x91, 0xFD, 0x7B, 0x19,
+    0x6F, 0xD6, 0x16, 0x1B, 0xFB, 0x7B, 0xD1, 0x24, 0xAB, 0x44, 0x46, 0x19, 0x4F, 0x23, 0x9A, 0x68,
+    0x14, 0xBD, 0xF0, 0xA9, 0x51, 0xAC, 0xF2, 0xDE, 0xCF, 0x9D, 0xF9, 0x24, 0x50, 0x4B, 0xC1, 0x48,
+    0x0B, 0xEA, 0xDA, 0xE4, 0x06, 0xF4, 0x62, 0xA6, 0xCE, 0x6D, 0x87, 0xFF, 0xE5, 0x84, 0x59, 0x14,
+    0xF0, 0xF7, 0xEE, 0x57, 0x66, 0x4C, 0xEE, 0x23, 0xFE, 0xB5, 0x4C, 0x3D, 0xF9, 0x54, 0xA8, 0xD0,
+    0xFF, 0xEC, 0x63, 0x25, 0x25, 0x6A, 0xCD, 0x70, 0x70, 0xB4, 0xCD, 0x67, 0x2F, 0x0D, 0x4E, 0x9A,
+    0x4C, 0x6E, 0x66, 0x93, 0x1F, 0xFE, 0x55, 0xB3, 0xC9, 0xCD, 0x64, 0xA4, 0xC1, 0x48, 0xC1, 0xAC,
+    0x37, 0x3F, 0x6B, 0xF9, 0x05, 0x9C, 0x06, 0xBC, 0x86, 0x4D, 0xBB, 0x52, 0x1A, 0xF0, 0xD2, 0x60,
+    0xD6, 0x42, 0xD1, 0x0D, 0xA8, 0x13, 0xA5, 0xAA, 0x19, 0xB3, 0xB8, 0x01, 0x3B, 0x29, 0xE0, 0xDF,
+    0x5C, 0x40, 0x97, 0x26, 0xCC, 0xE2, 0x47, 0x6C, 0xEA, 0x23, 0xFE, 0x8E, 0x42, 0xB9, 0x18, 0xD1,
+    0xA4, 0x4A, 0x3F, 0x12, 0x95, 0x94, 0x28, 0xB5, 0x00, 0x7D, 0x07, 0xDB, 0xC0, 0x68, 0xD7, 0x97,
+    0xC1, 0x69, 0x84, 0x5A, 0x00, 0x47, 0xA7, 0x9E, 0x28, 0x94, 0x92, 0x02, 0x2A, 0xF7, 0x5E, 0xC6,
+    0x26, 0x9B, 0xF0, 0xD1, 0x47, 0x54, 0xAC, 0x98, 0x7C, 0x25, 0x61, 0xB5, 0x82, 0xD7, 0x08, 0xF2,
+    0x11, 0x93, 0x7D, 0xDC, 0x0B, 0x8E, 0x8A, 0x08, 0x45, 0xA7, 0xA8, 0x51, 0x42, 0x1D, 0x70, 0x19,
+    0xAE, 0xBC, 0x5C, 0x48, 0x77, 0xA4, 0x24, 0x72, 0x1B, 0x7C, 0x33, 0xD6, 0x17, 0x17, 0xD0, 0x44,
+    0xA3, 0xA1, 0x90, 0xA8, 0x95, 0x70, 0xF9, 0x3B, 0xE8, 0x0A, 0xCD, 0x2F, 0x87, 0xFA, 0xFD, 0xB5,
+    0x9A, 0x7B, 0xE5, 0x46, 0x33, 0x87, 0x47, 0x1C, 0xEE, 0x76, 0xBB, 0x0B, 0xDA, 0x46, 0xA1, 0x4E,
+    0xA6, 0xF6, 0x4E, 0x3E, 0x6F, 0xB2, 0x3D, 0x19, 0x7C, 0x9C, 0x1F, 0x33, 0xF9, 0x00, 0x7C, 0xDC,
+    0xEC, 0xF7, 0x9B, 0x2A, 0xED, 0x00, 0xAD, 0x06, 0x6A, 0x2D, 0x1C, 0xEE, 0xC2, 0xEE, 0x72, 0xAF,
+    0x3B, 0x5A, 0x5B, 0x85, 0x7E, 0xAE, 0x66, 0xEC, 0xF0, 0x5B, 0x1F, 0x32, 0xCD, 0x60, 0x32, 0x2E,
+    0x9A, 0x05, 0x1F, 0x4B, 0xFD, 0x48, 0x01, 0x69, 0x05, 0xA7, 0x09, 0xD8, 0x71, 0xCA, 0x3E, 0x2A,
+    0xB7, 0x0A, 0xFD, 0x64, 0x33, 0x4D, 0xAC, 0x32, 0x3E, 0x9A, 0x05, 0x1F, 0x4A, 0xD1, 0x82, 0x58,
+    0x41, 0x21, 0x43, 0x7B, 0x37, 0xB3, 0xCD, 0x70, 0xF7, 0x66, 0x02, 0xFB, 0xCE, 0x08, 0x56, 0x11,
+    0x2A, 0x75, 0x60, 0x14, 0xB6, 0x90, 0x6F, 0xBF, 0x68, 0x6E, 0xAE, 0x02, 0x76, 0x97, 0x5B, 0xC5,
+    0x16, 0x65, 0xAF, 0xD0, 0xD3, 0xCE, 0x75, 0x46, 0xC1, 0x0E, 0x55, 0x2E, 0x14, 0x9B, 0x68, 0x96,
+    0x52, 0xD1, 0x75, 0xE5, 0x6A, 0x34, 0xF8, 0x50, 0xC8, 0x68, 0xF4, 0xA0, 0xEA, 0xDD, 0x74, 0x0D,
+    0xFA, 0x67, 0x5E, 0x4F, 0xB7, 0xA1, 0xBD, 0xF1, 0xDA, 0x94, 0xC1, 0xFF, 0xFC, 0xC5, 0x3C, 0x83,
+    0xBB, 0x57, 0x2E, 0x13, 0x34, 0x2A, 0x94, 0xC0, 0xAE, 0x68, 0x84, 0x7A, 0xA1, 0x1F, 0xA0, 0xCA,
+    0xB4, 0x11, 0xCC, 0x8C, 0x8F, 0x3C, 0x50, 0x62, 0x77, 0x24, 0x3D, 0xA3, 0x5F, 0x68, 0x7E, 0x62,
+    0x45, 0xD1, 0x45, 0xF4, 0x42, 0xA6, 0x90, 0x1D, 0x28, 0xB5, 0x42, 0xA9, 0x11, 0x8C, 0x80, 0x7A,
+    0x01, 0xFA, 0x0C, 0xD5, 0xA7, 0x19, 0xFC, 0xA5, 0x19, 0x33, 0x37, 0x13, 0x2E, 0xBA, 0x54, 0x2E,
+    0xF8, 0xD4, 0xAA, 0xD2, 0xAA, 0xEC, 0x94, 0x0E, 0x77, 0xC5, 0xEE, 0x19, 0xCD, 0xED, 0xDA, 0xAE,
+    0xA5, 0xBA, 0x3E, 0xDA, 0xD1, 0x2C, 0x45, 0xA6, 0x49, 0x3E, 0xA0, 0x8B, 0x23, 0x26, 0x67, 0x70,
+    0xEF, 0x76, 0xA0, 0x04, 0xD5, 0xF2, 0xE8, 0x2E, 0x1F, 0xB6, 0xB1, 0x59, 0x69, 0xE5, 0x60, 0xB7,
+    0x0B, 0xBD, 0x74, 0x57, 0x92, 0x1D, 0xEC, 0x7C, 0x9E, 0x3E, 0xFE, 0x8D, 0xC9, 0xE0, 0x47, 0x4A,
+    0x41, 0x93, 0x40, 0x01, 0x3B, 0x43, 0x1B, 0x31, 0x0B, 0xFF, 0xCE, 0x8F, 0xE6, 0x2D, 0xD1, 0xDC,
+    0xF8, 0xE4, 0x78, 0xF1, 0x52, 0xEA, 0xA5, 0x08, 0xF0, 0xDC, 0x7F, 0xD2, 0x7F, 0xFF, 0xA4, 0xE9,
+    0xAE, 0x15, 0x73, 0x35, 0xFE, 0xDA, 0xBF, 0xE5, 0xA2, 0x7E, 0x90, 0x7D, 0xA0, 0x1E, 0x61, 0x0B,
+    0x54, 0xAB, 0x04, 0x0B, 0x34, 0x11, 0x33, 0x41, 0x0F, 0x36, 0x52, 0xCE, 0xE0, 0xC1, 0x8E, 0xEC,
+    0xE3, 0xDD, 0x2A, 0x9D, 0xDE, 0x6E, 0x12, 0xF0, 0xDC, 0x2B, 0xFA, 0x37, 0xA9, 0xAD, 0x7E, 0x5D,
+    0x79, 0xAF, 0x95, 0x84, 0x0F, 0xD8, 0x91, 0x3A, 0x63, 0xDE, 0xED, 0x8A, 0x0F, 0x12, 0xF9, 0x2A,
+    0xE7, 0x6D, 0x74, 0x65, 0xB2, 0xF1, 0x5A, 0x35, 0xD8, 0x93, 0x54, 0x4E, 0x2F, 0xF3, 0x67, 0x92,
+    0x5A, 0xE9, 0x57, 0xC7, 0xC7, 0x2F, 0x3F, 0x6E, 0x06, 0xFF, 0xBD, 0x5C, 0x8D, 0x5F, 0xE3, 0x10,
+    0xDA, 0x15, 0xA7, 0xA9, 0x9A, 0xDA, 0xD8, 0x9A, 0xCC, 0x91, 0x8F, 0xFC, 0x51, 0xA6, 0x57, 0xF4,
+    0x9F, 0xE6, 0x3A, 0xF9, 0x28, 0x93, 0xED, 0x87, 0xFD, 0xD0, 0x4B, 0x77, 0x75, 0x63, 0x2A, 0xC2,
+    0x39, 0x78, 0x0C, 0x9A, 0x0C, 0x3E, 0x43, 0xF5, 0x99, 0x95, 0xE2, 0x10, 0xB3, 0x68, 0x34, 0xD2,
+    0x6C, 0xF4, 0x4A, 0x36, 0xD9, 0x2C, 0xFB, 0x98, 0x69, 0x35, 0xB9, 0x58, 0x3F, 0x1B, 0x3F, 0x35,
+    0x93, 0x91, 0xC6, 0x52, 0x0A, 0x9B, 0xA3, 0x0C, 0x38, 0xE1, 0x35, 0xFA, 0x37, 0x73, 0x33, 0xB4,
+    0x36, 0x7D, 0xE3, 0x41, 0xC6, 0x61, 0x27, 0x4A, 0x41, 0xFB, 0xC9, 0xDF, 0xD7, 0x12, 0xAD, 0xC2,
+    0x96, 0xB4, 0x05, 0x8A, 0x7E, 0xC0, 0x68, 0xD8, 0xA6, 0xB3, 0xDB, 0xF6, 0x83, 0x2B, 0x03, 0xBD,
+    0x06, 0x23, 0x0D, 0x76, 0x72, 0x43, 0x33, 0xB8, 0xC1, 0xC7, 0x47, 0xEC, 0xA3, 0x1B, 0xDC, 0x27,
+    0x1A, 0xAC, 0xB4, 0x18, 0xDD, 0x58, 0x38, 0x57, 0x6C, 0x4A, 0xAC, 0x78, 0x25, 0x7F, 0x7D, 0x69,
+    0xA2, 0xBF, 0x31, 0xDA, 0xB7, 0xA5, 0x59, 0x5A, 0x7D, 0x87, 0x4D, 0x98, 0x05, 0xDA, 0xFF, 0xFD,
+    0x6F, 0xAD, 0x14, 0xFA, 0x4D, 0x89, 0xE2, 0x65, 0x6A, 0x0D, 0xB5, 0x72, 0x35, 0x5F, 0x2B, 0x73,
+    0xC9, 0x0A, 0xBE, 0xA3, 0xD7, 0xD0, 0x6B, 0xFA, 0xA7, 0xBA, 0x4C, 0xDB, 0xD1, 0x8C, 0xA7, 0x29,
+    0xE0, 0xC3, 0x27, 0xA5, 0x32, 0x12, 0x1C, 0x84, 0xA3, 0x4A, 0x4A, 0xAD, 0xF4, 0xE2, 0xDC, 0xFC,
+    0x57, 0x3B, 0xF8, 0xE0, 0x59, 0x59, 0xCC, 0x54, 0xAE, 0x7D, 0x34, 0xCA, 0x34, 0xC7, 0x81, 0x0C,
+    0xE6, 0xC3, 0x5D, 0xB0, 0xDB, 0x3A, 0x72, 0x77, 0x3D, 0x56, 0x33, 0x94, 0xB9, 0x0D, 0xCD, 0xA8,
+    0x77, 0x54, 0x4A, 0x23, 0xFD, 0xFF, 0x80, 0xB3, 0xF0, 0xC4, 0x02, 0x56, 0x61, 0xB3, 0x47, 0x3D,
+    0xED, 0xE3, 0xA9, 0xBE, 0x38, 0xC2, 0xFD, 0x52, 0xD4, 0x52, 0x2A, 0xF5, 0x6E, 0xA6, 0xEF, 0xFA,
+    0xE0, 0x86, 0x66, 0xA8, 0xA7, 0x6A, 0x2A, 0x97, 0x62, 0xA1, 0x0F, 0xED, 0x67, 0x08, 0xA5, 0xDE,
+    0xD0, 0x7B, 0x9A, 0x95, 0x09, 0xC5, 0x42, 0x1F, 0xDD, 0x58, 0x6C, 0xA9, 0x4A, 0x3F, 0xB6, 0x73,
+    0xB9, 0xD2, 0x76, 0xCD, 0x58, 0xCD, 0xC5, 0x83, 0x4A, 0xA9, 0x49, 0x0B, 0x8F, 0xE1, 0xA2, 0x9D,
+    0xCC, 0xB2, 0x01, 0x31, 0x67, 0x9B, 0x6C, 0x45, 0x1B, 0xEB, 0x54, 0x66, 0x7A, 0xDC, 0xE7, 0x2A,
+    0xC2, 0x77, 0x7E, 0x68, 0xC7, 0x36, 0xD5, 0x37, 0xE1, 0x2C, 0x5C, 0x49, 0xDB, 0x3C, 0x6E, 0x12,
+    0xD4, 0x9F, 0xD9, 0x35, 0xD7, 0xA9, 0x9D, 0xEA, 0xE4, 0xBB, 0x3A, 0xAD, 0xD4, 0xEF, 0xCF, 0xD4,
+    0x4A, 0xD4, 0x9F, 0xCE, 0xD4, 0xEF, 0x2F, 0xD4, 0x49, 0xD4, 0xA9, 0x8D, 0x75, 0x72, 0xC9, 0x2D,
+    0x36, 0xB7, 0xAB, 0x59, 0x80, 0x23, 0xCE, 0x3E, 0xB1, 0x58, 0x85, 0x76, 0xA8, 0xA7, 0x72, 0xA1,
+    0x0F, 0xEE, 0xD7, 0x54, 0x2A, 0xBD, 0xAF, 0xCC, 0xD1, 0x21, 0x87, 0xD4, 0xB9, 0x9F, 0xDA, 0xA9,
+    0x92, 0xD4, 0x8B, 0x2B, 0x6B, 0xBF, 0xF6, 0x43, 0x35, 0xD7, 0xB9, 0x9E, 0x8B, 0xB5, 0x58, 0x8B,
+    0x95, 0xB6, 0x6B, 0xBB, 0xB6, 0x6B, 0xC6, 0x66, 0x6C, 0xC6, 0x6A, 0xAE, 0xE6, 0xEA, 0x51, 0x17,
+    0xDC, 0xDA, 0xAC, 0x8D, 0xAC, 0x7E, 0xA8, 0x1F, 0x6A, 0xE0, 0x68, 0xE3, 0x5A, 0x49, 0xE2, 0xCA,
+    0xDA, 0x8F, 0x5B, 0x23, 0x56, 0xDA, 0xCE, 0x77, 0xCD, 0x68, 0xC7, 0x6A, 0x36, 0x9F, 0x25, 0xB8,
+    0xD5, 0xEA, 0x92, 0x5E, 0xD3, 0xC0, 0xC1, 0x11, 0xA5, 0x66, 0xBC, 0xB2, 0x59, 0x9A, 0xA9, 0x19,
+    0x9A, 0x24, 0xFC, 0x49, 0x46, 0x36, 0x99, 0xEC, 0xA3, 0x4D, 0xC2, 0x9F, 0xAC, 0xC5, 0x5A, 0xAD,
+    0x4D, 0xAA, 0x25, 0xEA, 0x53, 0x3C, 0x23, 0x9C, 0x2B, 0xF4, 0xE3, 0xB5, 0x96, 0xD6, 0x4A, 0xAF,
+    0xE4, 0x7A, 0xB2, 0x93, 0x8B, 0x6E, 0xEC, 0x69, 0xAF, 0xE7, 0x62, 0xAD, 0x53, 0x35, 0xBB, 0xD8,
+    0x0C, 0x3D, 0x2A, 0xD7, 0x67, 0xE7, 0x5A, 0xEA, 0x9C, 0x26, 0xFA, 0xCB, 0x94, 0x79, 0xB3, 0xB8,
+    0x1F, 0xA9, 0x34, 0xF1, 0xCD, 0xE3, 0x8E, 0x4D, 0x07, 0xE1, 0xB5, 0x6C, 0x3A, 0xB8, 0x41, 0xF4,
+    0x17, 0x72, 0xB9, 0xD8, 0x54, 0x4F, 0x3E, 0x6E, 0xA7, 0xAB, 0x59, 0x2A, 0xF5, 0x93, 0x95, 0x86,
+    0x7A, 0xED, 0x03, 0xE5, 0xB2, 0x0D, 0x3F, 0x37, 0x80, 0x3A, 0x9C, 0x22, 0xC7, 0x7F, 0xC7, 0xD1,
+    0x39, 0xF7, 0xDE, 0xD2, 0x7F, 0xB4, 0x3C, 0xA1, 0x5C, 0x2D, 0x8F, 0x55, 0x33, 0xFF, 0x6F, 0x71,
+    0xEA, 0x5A, 0x45, 0x76, 0x34, 0xBA, 0xBE, 0xCA, 0xC6, 0xAB, 0x2D, 0xEF, 0xA9, 0x33, 0x9A, 0x8C,
+    0xE6, 0x52, 0x53, 0x68, 0xDF, 0xE9, 0x7C, 0x1F, 0x96, 0x5E, 0xFF, 0xA0, 0x95, 0x83, 0x0D, 0x7B,
+    0xC8, 0x94, 0x99, 0x32, 0xD3, 0x28, 0x7B, 0xCD, 0x7F, 0xB4, 0x1C, 0x99, 0xCC, 0x23, 0x8A, 0xFE,
+    0xBE, 0x54, 0x46, 0xD3, 0x1E, 0x70, 0xA8, 0x73, 0x9D, 0x6B, 0xD5, 0xA2, 0x8D, 0x6D, 0xB4, 0xC9,
+    0x26, 0x93, 0x4D, 0x46, 0x08, 0x1F, 0xFD, 0x43, 0x84, 0x20, 0xDC, 0x27, 0x8A, 0x46, 0x52, 0x68,
+    0x67, 0xC5, 0xE2, 0xE8, 0x1C, 0xAD, 0xAC, 0xAC, 0xAE, 0xAB, 0x53, 0x70, 0x5D, 0x93, 0x6C, 0x34,
+    0xB9, 0x1A, 0xE9, 0x2F, 0x4C, 0xD8, 0x31, 0x53, 0xE6, 0xDB, 0xD0, 0xB6, 0xDB, 0x4C, 0x2C, 0x14,
+    0xB7, 0x9C, 0xAF, 0xDE, 0x23, 0x9E, 0xED, 0x5A, 0x0D, 0x7D, 0xD2, 0xE4, 0x5E, 0x50, 0x14, 0x22,
+    0x97, 0xB9, 0xCA, 0xD5, 0x60, 0x66, 0x37, 0x79, 0x6C, 0xD2, 0x98, 0x71, 0x27, 0xF7, 0x5E, 0x1B,
+    0xF0, 0x7F, 0xED, 0x1D, 0xAC, 0xD3, 0xED, 0x99, 0x42, 0x77, 0x34, 0x60, 0x64, 0x04, 0xF5, 0x54,
+    0xCF, 0xD0, 0xC4, 0xE6, 0x74, 0xED, 0xF5, 0x8B, 0xCF, 0x7E, 0x6E, 0xA6, 0x2A, 0x37, 0xB1, 0x5C,
+    0xFD, 0xB6, 0xB4, 0xBA, 0x09, 0x6C, 0x02, 0x3F, 0xC3, 0xAB, 0x2B, 0xE5, 0xDC, 0x87, 0x3A, 0xF9,
+    0xC1, 0x4F, 0x6D, 0xEE, 0x67, 0xE5, 0x56, 0x56, 0xCD, 0xFD, 0x07, 0x18, 0x1F, 0xF5, 0x00, 0xFE,
+    0xF3, 0x0F, 0x50, 0x25, 0x28, 0x66, 0x20, 0x43, 0xB9, 0x42, 0xBF, 0x82, 0x5B, 0xA1, 0x9C, 0x01,
+    0xA7, 0xB5, 0x96, 0x4E, 0x3E, 0x6C, 0xC7, 0xA9, 0x19, 0x1F, 0x6F, 0x12, 0x36, 0x61, 0x27, 0xEA,
+    0x99, 0x2A, 0xD7, 0x55, 0x36, 0x6F, 0xAE, 0xFF, 0x3A, 0x49, 0xF9, 0x34, 0x5B, 0x6E, 0xD1, 0xD0,
+    0x1F, 0xF9, 0x60, 0xA3, 0x49, 0xDC, 0xC6, 0x75, 0xD5, 0x58, 0x64, 0x56, 0x44, 0xDB, 0x55, 0x13,
+    0xD7, 0x68, 0xBA, 0x7A, 0x2C, 0x27, 0x16, 0x3C, 0x36, 0x96, 0x33, 0x7E, 0xAA, 0x16, 0x80, 0xDB,
+    0x8F, 0xDC, 0x7C, 0xD7, 0xE4, 0xA2, 0xED, 0xAA, 0x44, 0xC6, 0xD3, 0xC4, 0x7A, 0x2C, 0x27, 0x6E,
+    0x6F, 0x31, 0x59, 0x1F, 0xDA, 0xE0, 0x42, 0x3D, 0x94, 0x33, 0xD7, 0x68, 0xA2, 0x49, 0x64, 0xD6,
+    0x4A, 0xC5, 0x0A, 0x50, 0xDE, 0x2C, 0x2A, 0x7D, 0xFF, 0x6D, 0xAD, 0xF3, 0xD4, 0xE6, 0x3F, 0x29,
+    0x37, 0x58, 0xBB, 0x8A, 0x4F, 0x97, 0x73, 0x13, 0xFB, 0x2A, 0xF9, 0xBB, 0x8B, 0x99, 0x7C, 0xE7,
+    0xEF, 0x66, 0xD6, 0x3A, 0x99, 0xD9, 0xC5, 0x3A, 0x5E, 0xDD, 0x9B, 0xFD, 0xCF, 0x8B, 0x54, 0x25,
+    0x1F, 0xFA, 0x6A, 0xAA, 0xA7, 0xB6, 0x5B, 0xEB, 0xD4, 0x5F, 0x9C, 0xDB, 0x0B, 0xB3, 0x37, 0x93,
+    0x2B, 0x1E, 0xC0, 0x3D, 0x7C, 0x03, 0xA0, 0x89, 0x40, 0x33, 0xB3, 0x8F, 0x51, 0xF8, 0xE3, 0xFB,
+    0x97, 0xBF, 0x2A, 0x68, 0x63, 0xCF, 0xDE, 0x74, 0x80, 0x8B, 0x80, 0x22, 0x98, 0x15, 0x28, 0xC3,
+    0x1F, 0x4A, 0x78, 0x66, 0x1F, 0xAF, 0xD6, 0xF7, 0x22, 0xB8, 0x0B, 0x09, 0xFE, 0xD9, 0x29, 0xE2,
+    0xF5, 0x55, 0x0B, 0xF7, 0xD5, 0x08, 0xED, 0xA5, 0x04, 0xFE, 0x52, 0x82, 0xC3, 0x22, 0x7C, 0xE5,
+    0x72, 0xBF, 0x24, 0x00, 0xA8, 0x98, 0xA1, 0x9E, 0xC1, 0x8C, 0xD0, 0x04, 0xCA, 0x19, 0xCE, 0xEC,
+    0x55, 0xFF, 0x8B, 0x53, 0xD4, 0x76, 0x80, 0x66, 0x02, 0xFE, 0xEA, 0x4B, 0xC5, 0x75, 0x36, 0x21,
+    0x7F, 0xBA, 0x09, 0xA9, 0x04, 0x76, 0x86, 0x7F, 0xC2, 0x97, 0x2F, 0xC3, 0x24, 0xB0, 0x79, 0x73,
+    0x31, 0xD9, 0x76, 0xFC, 0xC7, 0xF2, 0xCB, 0x97, 0x91, 0x5D, 0x28, 0x17, 0x1F, 0x8B, 0xEC, 0x3B,
+    0x8E, 0x0E, 0xBE, 0x6C, 0xFE, 0x23, 0x2E, 0x16, 0x0A, 0xD5, 0x42, 0xD1, 0x41, 0xB1, 0xBB, 0xEC,
+    0xF5, 0x0B, 0xCD, 0xBF, 0x11, 0x1F, 0x8A, 0x66, 0x29, 0xB5, 0x78, 0x0D, 0x5B, 0x4F, 0xBA, 0x68,
+    0xB3, 0x59, 0x79, 0x92, 0x2F, 0xD0, 0xDC, 0x46, 0x23, 0x6E, 0x67, 0x67, 0xDE, 0xEA, 0xBE, 0xF6,
+    0xBB, 0x37, 0x37, 0xE9, 0x6A, 0x7B, 0xE9, 0xA3, 0x69, 0x3D, 0x57, 0x04, 0xF8, 0x9D, 0xC0, 0x2D,
+    0x8A, 0x10, 0xC0, 0x2C, 0x4F, 0x41, 0x21, 0x01, 0xDF, 0xED, 0xC3, 0x06, 0x9B, 0x6F, 0x20, 0xF3,
+    0x2E, 0x14, 0xBB, 0x7F, 0xA9, 0xA9, 0x54, 0x76, 0xA2, 0x5D, 0xD0, 0x58, 0x64, 0xFC, 0x42, 0x8B,
+    0x55, 0x6C, 0xA2, 0xD1, 0x5C, 0x25, 0x16, 0x7D, 0x2F, 0xE3, 0x5D, 0x6A, 0xB1, 0x27, 0x6A, 0xA2,
+    0x49, 0xFE, 0x1F, 0x13, 0xB9, 0x5E, 0x32, 0x1E, 0x09, 0x1B, 0xAD, 0xA2, 0x49, 0x85, 0x52, 0x91,
+    0xF1, 0xD9, 0x28, 0x19, 0x15, 0xDA, 0x32, 0xCE, 0xFB, 0x92, 0xCA, 0x08, 0xF8, 0xEE, 0x34, 0x9F,
+    0xCC, 0x40, 0xD1, 0xED, 0xAF, 0x5D, 0x79, 0x19, 0x7A, 0x4D, 0x78, 0x69, 0xB0, 0x73, 0xA5, 0x72,
+    0xC1, 0xCE, 0x3E, 0xD2, 0xBF, 0x36, 0x63, 0x96, 0xFE, 0x33, 0x00, 0xCE, 0x84, 0x59, 0xD4, 0xE1,
+    0x5F, 0xCF, 0x98, 0xDC, 0x46, 0xFA, 0x0B, 0xA2, 0x49, 0xCD, 0xFA, 0x6C, 0xA6, 0x95, 0xA0, 0x57,
+    0x07, 0xBB, 0xFB, 0xFE, 0xF2, 0xBF, 0xEC, 0xA5, 0xBA, 0x69, 0xEF, 0xC8, 0x9F, 0xE4, 0x2B, 0x17,
+    0xEA, 0x3A, 0xA8, 0x56, 0x28, 0x3E, 0x99, 0xE1, 0x5A, 0x1D, 0xA9, 0xBA, 0xEF, 0x7C, 0xD5, 0x42,
+    0xAB, 0x31, 0x83, 0x9A, 0x01, 0xFB, 0x5E, 0x86, 0x73, 0xA7, 0x56, 0xFF, 0x4A, 0xF0, 0xB1, 0xFB,
+    0xAF, 0x81, 0xA1, 0x1E, 0x4F, 0xC1, 0x81, 0x42, 0xF0, 0xC0, 0xED, 0x7D, 0xC5, 0xF0, 0xCC, 0xE9,
+    0xE8, 0x1D, 0xD8, 0x07, 0x69, 0xED, 0x08, 0x1B, 0x52, 0x75, 0xF3, 0x0F, 0xAA, 0x41, 0xCB, 0xE9,
+    0x3A, 0xFD, 0x51, 0x02, 0x7B, 0x67, 0x86, 0xAF, 0xEF, 0x5D, 0xFC, 0x1F, 0x46, 0x03, 0x7B, 0x77,
+    0x02, 0x77, 0x32, 0x43, 0x73, 0x32, 0xC3, 0x01, 0x47, 0x7F, 0x10, 0xE1, 0x65, 0x80, 0x5B, 0xFB,
+    0xC4, 0xA3, 0xDB, 0x5E, 0x1C, 0x6F, 0x93, 0xB9, 0x38, 0xA2, 0xDA, 0x10, 0x82, 0xF6, 0x62, 0xAE,
+    0x92, 0x8F, 0x07, 0x26, 0x53, 0xB4, 0xB1, 0x56, 0x36, 0xEA, 0x63, 0x6F, 0xB2, 0x4D, 0x3E, 0xEA,
+    0xD9, 0xA5, 0x96, 0xB2, 0x9B, 0x15, 0xCE, 0x15, 0x81, 0x33, 0xC0, 0x7C, 0x1F, 0x3E, 0xB9, 0x05,
+    0x25, 0x5F, 0x9C, 0xD9, 0x63, 0xDB, 0xA8, 0x54, 0xE0, 0xFC, 0x2D, 0xEA, 0x93, 0x44, 0xFA, 0xC6,
+    0x17, 0x67, 0x06, 0xC5, 0xEC, 0x71, 0xAF, 0x4D, 0x65, 0x6E, 0x29, 0xD8, 0x22, 0x92, 0x2F, 0x84,
+    0xBF, 0xFC, 0xCE, 0x58, 0xC9, 0xD5, 0x2D, 0x0A, 0x99, 0xE1, 0x79, 0xB8, 0x0D, 0x8F, 0x6F, 0xC1,
+    0xC3, 0xD3, 0xD0, 0x44, 0x8A, 0x0C, 0x4D, 0x77, 0x6A, 0xF4, 0x43, 0xE8, 0x67, 0xA4, 0xB8, 0xD6,
+    0x53, 0xCB, 0xEA, 0x3B, 0x7F, 0x43, 0x7A, 0x5B, 0x9A, 0xD7, 0x53, 0xF6, 0x85, 0xFE, 0xF3, 0x4F,
+    0xBD, 0x96, 0x52, 0x0B, 0xC5, 0x11, 0x10, 0xE1, 0x16, 0xF8, 0xED, 0x65, 0x6D, 0x38, 0x0D, 0x30,
+    0x7F, 0x77, 0x3E, 0x60, 0x12, 0x46, 0x94, 0x1F, 0x8D, 0x4C, 0xCF, 0xF3, 0xB3, 0xFA, 0x0B, 0xF3,
+    0xC9, 0x2E, 0xB4, 0x97, 0x46, 0x7B, 0x32, 0x11, 0xCE, 0x02, 0x70, 0x99, 0x52, 0xA3, 0x91, 0xCC,
+    0xEC, 0xDE, 0xC8, 0x66, 0x5E, 0x59, 0xBD, 0x74, 0x43, 0x7A, 0x7B, 0x3E, 0x7D, 0x95, 0x5B, 0xAD,
+    0x3F, 0x1A, 0xA4, 0xA9, 0xD6, 0xC4, 0x41, 0xE0, 0x6B, 0xD8, 0x68, 0x66, 0x7C, 0x28, 0x13, 0x8F,
+    0x6F, 0x7E, 0x78, 0x6E, 0x56, 0xFA, 0xCF, 0xC3, 0x1E, 0xB4, 0x5D, 0xBF, 0x78, 0x05, 0x9E, 0xC4,
+    0x06, 0x3B, 0x54, 0xA3, 0x19, 0xF7, 0x33, 0xF6, 0xFF, 0x73, 0x3F, 0x2C, 0xB4, 0xF1, 0xE9, 0x7C,
+    0xDE, 0xDE, 0x28, 0x86, 0xDF, 0xE6, 0xFE, 0xEA, 0x8D, 0x59, 0xEE, 0xE7, 0x6F, 0xE5, 0xB3, 0xC5,
+    0xB6, 0x02, 0xAA, 0x6B, 0x67, 0xFA, 0xAE, 0x9A, 0x69, 0x3F, 0x7F, 0x70, 0xBA, 0xA0, 0x89, 0xAF,
+    0x17, 0x60, 0x3F, 0x1C, 0xA9, 0x34, 0xC3, 0x2F, 0x32, 0xF0, 0xD8, 0xFE, 0x0D, 0x74, 0x71, 0x44,
+    0xFF, 0xBA, 0x42, 0x2B, 0xA5, 0x33, 0x7A, 0x67, 0xC3, 0x2E, 0x1E, 0x09, 0x44, 0x9C, 0x12, 0x4A,
+    0x8D, 0x9A, 0x94, 0xDB, 0x85, 0x6F, 0xEF, 0x83, 0xB7, 0x11, 0xEC, 0x00, 0x75, 0xBC, 0xEF, 0xA5,
+    0x8B, 0xCB, 0xD0, 0xAF, 0x58, 0x09, 0x5D, 0x5C, 0xAA, 0xA9, 0xBA, 0x8F, 0x4F, 0x3C, 0x0C, 0x57,
+    0x74, 0xED, 0x0B, 0x7A, 0x29, 0x97, 0x52, 0x2C, 0x35, 0xEF, 0x3F, 0x3D, 0xB8, 0x09, 0x66, 0x00,
+    0x1F, 0x28, 0x66, 0xB0, 0x1D, 0x7B, 0x8B, 0xFF, 0x1E, 0x2C, 0xD9, 0xD8, 0x09, 0x6C, 0x0B, 0xF3,
+    0x79, 0x4C, 0xFC, 0x9B, 0xDF, 0x9B, 0x65, 0xF5, 0xC6, 0x8C, 0x7F, 0x3D, 0xB1, 0xBA, 0x48, 0xD8,
+    0xDB, 0x72, 0x07, 0x4E, 0x9D, 0x91, 0xA2, 0x7F, 0x43, 0xDF, 0x5B, 0x8A, 0xCF, 0x00, 0x33, 0xA7,
+    0x2C, 0xC7, 0x66, 0x6C, 0xFF, 0x41, 0xF4, 0x4A, 0xF4, 0x2B, 0x1C, 0x84, 0xED, 0x09, 0x6D, 0xD8,
+    0x72, 0x6A, 0x7A, 0xA0, 0x1A, 0x80, 0x6F, 0x3F, 0x48, 0x1B, 0x5D, 0x72, 0xC9, 0x65, 0x97, 0x0B,
+    0x15, 0x9F, 0x07, 0x24, 0x1E, 0x46, 0x28, 0x16, 0x93, 0xE9, 0xDF, 0x11, 0x56, 0x5A, 0x0A, 0xBD,
+    0x2D, 0x0E, 0xC2, 0xD1, 0x9E, 0x91, 0xDB, 0xE7, 0x9D, 0x76, 0xD8, 0xEC, 0xFB, 0x20, 0xF3, 0xFA,
+    0x7D, 0xB9, 0x03, 0x45, 0xDE, 0x2F, 0x91, 0xB7, 0x27, 0xB8, 0xEA, 0xE0, 0x9F, 0x97, 0xF1, 0xCB,
+    0xE3, 0xEE, 0xEB, 0x81, 0xE6, 0xCD, 0x19, 0x93, 0x16, 0x38, 0xFB, 0xD8, 0x03, 0xBD, 0xFB, 0xD8,
+    0xC7, 0x3E, 0xF5, 0xA9, 0xCA, 0xD5, 0xA3, 0xA0, 0x9A, 0x53, 0xC2, 0x64, 0x53, 0xA9, 0x57, 0x32,
+    0x5E, 0x9A, 0x2A, 0xDD, 0xC8, 0xFB, 0xF4, 0x6F, 0xB7, 0xDB, 0x1D, 0xE1, 0x24, 0xCD, 0xA5, 0x24,
+    0xCD, 0xF5, 0x52, 0x2E, 0x07, 0xB3, 0x1B, 0xCB, 0x85, 0xC9, 0xC7, 0x72, 0xE1, 0xAF, 0xDA, 0xAE,
+    0x5C, 0xA0, 0x0F, 0xE5, 0x02, 0xA2, 0x94, 0xE2, 0xFD, 0xE3, 0x7A, 0x1C, 0x14, 0xB6, 0x8F, 0x7A,
+    0xCA, 0x85, 0xB3, 0x6D, 0x2C, 0x17, 0x9E, 0xF2, 0xA9, 0x5C, 0xB8, 0x65, 0xD7, 0xBF, 0x5C, 0x8F,
+    0xB3, 0x91, 0xA4, 0xCC, 0x15, 0x49, 0x33, 0xDB, 0x57, 0x61, 0x07, 0xA1, 0x38, 0xA2, 0xD6, 0x5D,
+    0x25, 0x23, 0x49, 0x51, 0x17, 0x75, 0x7D, 0x69, 0x86, 0x26, 0xD9, 0x0F, 0x32, 0x42, 0x3E, 0x5A,
+    0xE9, 0x83, 0x8C, 0xB4, 0xFA, 0x68, 0x13, 0x26, 0x23, 0xF0, 0x63, 0x33, 0x51, 0xE8, 0x25, 0x7D,
+    0xFC, 0xD7, 0xB5, 0x56, 0x69, 0x70, 0xFA, 0xFE, 0xF6, 0xB5, 0xD0, 0x11, 0xC7, 0xC7, 0xC7, 0xAD,
+    0xF4, 0xAE, 0x34, 0x1D, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0xF7, 0x7A, 0xB0, 0xE5, 0x22, 0x3C, 0x6F,
+    0xAF, 0x27, 0x6F, 0x92, 0xBF, 0x3E, 0xC3, 0x41, 0x99, 0x9B, 0x98, 0x6D, 0x9C, 0x9D, 0x19, 0xA0,
+    0x08, 0x47, 0x4D, 0x15, 0xE7, 0xF3, 0xF5, 0xDD, 0xE4, 0x6D, 0xCC, 0xDE, 0xCC, 0x6B, 0xFD, 0xD6,
+    0x0C, 0x1C, 0x14, 0xA1, 0x77, 0x77, 0x72, 0x6B, 0x52, 0xB6, 0x27, 0xE9, 0xBC, 0xBD, 0x9E, 0x6E,
+    0xD9, 0x0B, 0x03, 0x70, 0x26, 0x9C, 0x09, 0x45, 0x10, 0x6D, 0xE7, 0x4F, 0x96, 0x72, 0x2D, 0x64,
+    0x53, 0x35, 0x99, 0x7C, 0xC0, 0x01, 0x45, 0xF8, 0xBF, 0xAD, 0x58, 0x3D, 0xCC, 0x25, 0x47, 0x56,
+    0x3D, 0xDD, 0xE5, 0x6F, 0x0A, 0x6D, 0x4B, 0x5B, 0x0E, 0xFC, 0x01, 0x5A, 0x4B, 0x34, 0x22, 0x04,
+    0x44, 0x25, 0x84, 0x9E, 0xA9, 0xB2, 0x3F, 0x21, 0x82, 0x0D, 0xE6, 0x03, 0x4D, 0x43, 0xE0, 0xC0,
+    0xC4, 0x96, 0x60, 0xD2, 0x0D, 0x6C, 0x57, 0xCF, 0x38, 0x20, 0x1C, 0x13, 0x00, 0x21, 0x04, 0x9B,
+    0xEC, 0x08, 0xC9, 0x04, 0x04, 0x04, 0x63, 0x77, 0x8D, 0x27, 0x70, 0xB0, 0x81, 0xCB, 0xB6, 0x56,
+    0x04, 0x04, 0x6E, 0x3C, 0xB6, 0x58, 0x48, 0xB6, 0xBC, 0x5B, 0x03, 0x65, 0xEF, 0xAD, 0x3A, 0x1B,
+    0xF4, 0x1B, 0x7B, 0xBD, 0x0B, 0xCB, 0x8F, 0xAC, 0xA7, 0xAA, 0x5B, 0xEF, 0xBC, 0xF7, 0x4E, 0x55,
+    0xDD, 0xEA, 0x3E, 0xF7, 0xBC, 0x06, 0x00, 0x88, 0xF5, 0x63, 0x73, 0x71, 0x10, 0xB7, 0xE2, 0xF2,
+    0x0C, 0x00, 0x70, 0xBE, 0x2C, 0x37, 0x1C, 0x29, 0x96, 0x14, 0xD5, 0x06, 0x51, 0x82, 0x97, 0x94,
+    0xE0, 0x77, 0x95, 0x00, 0x4A, 0x00, 0x45, 0x46, 0x45, 0x46, 0xD5, 0xEF, 0xFA, 0x13, 0xF6, 0xA4,
+    0x12, 0x3C, 0xA3, 0x04, 0xF7, 0x54, 0xBF, 0x2B, 0x96, 0x14, 0x47, 0x56, 0xE0, 0x1B, 0x00, 0x40,
+    0x00, 0x03, 0x3D, 0xA0, 0x18, 0x4F, 0xDD, 0xF4, 0x41, 0x02, 0xCC, 0x9D, 0x0C, 0xD8, 0xEB, 0x19,
+    0x70, 0xBA, 0x02, 0xAF, 0x28, 0x01, 0xDA, 0x1F, 0x37, 0x80, 0xEC, 0x18, 0x49, 0x42, 0x65, 0xD0,
+    0xEB, 0x1D, 0x21, 0x9A, 0x04, 0x97, 0x36, 0x19, 0x29, 0x6C, 0x8A, 0x72, 0xBE, 0x2C, 0x97, 0x8E,
+    0xAC, 0x96, 0xAC, 0xAA, 0xFD, 0x51, 0x51, 0x32, 0x14, 0x25, 0xC8, 0x4A, 0xE0, 0x55, 0xF3, 0x50,
+    0xE4, 0xAA, 0xC8, 0xAC, 0xE4, 0x69, 0x51, 0x32, 0x36, 0x25, 0x43, 0x3B, 0xA2, 0x12, 0xD5, 0x6F,
+    0x56, 0x4B, 0xEE, 0x8E, 0x1D, 0x00, 0x70, 0xF6, 0xE2, 0xB7, 0xE1, 0xC8, 0xD5, 0x92, 0xBB, 0x12,
+    0x93, 0x95, 0xE8, 0xA2, 0x44, 0x65, 0x25, 0x3A, 0x2B, 0x31, 0xE9, 0xB4, 0xDB, 0x13, 0x97, 0x3A,
+    0xF1, 0x8D, 0xC7, 0xB8, 0x7D, 0x99, 0xEB, 0x7C, 0x59, 0x2E, 0x49, 0x7E, 0x48, 0x72, 0xE5, 0xF2,
+    0x86, 0x92, 0xA1, 0x98, 0xAC, 0xA3, 0x8B, 0x5F, 0x07, 0x8F, 0xDC, 0x99, 0x0C, 0xB8, 0x88, 0x9F,
+    0x7B, 0xEB, 0x61, 0xB9, 0x83, 0x5C, 0x81, 0x65, 0x59, 0x2E, 0x41, 0xB2, 0x82, 0xE4, 0x0E, 0x13,
+    0x37, 0xFF, 0x73, 0xDD, 0xBA, 0x79, 0xCC, 0xEB, 0xE6, 0x31, 0xFB, 0xCD, 0xC3, 0x62, 0xF3, 0x70,
+    0xD8, 0x3C, 0x5E, 0xC1, 0xE6, 0xF1, 0x06, 0x36, 0x0F, 0xC1, 0xE6, 0x75, 0x5B, 0xB8, 0x06, 0x92,
+    0xB2, 0x91, 0x6C, 0x01, 0x18, 0x24, 0x00, 0x83, 0x38, 0x00, 0x72, 0x0D, 0x40, 0xFD, 0x6D, 0x00,
+    0xFF, 0xF0, 0x95, 0x9E, 0xFA, 0xB8, 0x9E, 0x2D, 0x97, 0x57, 0x56, 0x53, 0x0C, 0xB3, 0xDD, 0x8D,
+    0x4C, 0x5C, 0x43, 0x36, 0x1D, 0x1D, 0xDC, 0xE1, 0xD0, 0x87, 0x0A, 0xCC, 0x6B, 0x57, 0x19, 0x98,
+    0x62, 0x9F, 0x12, 0xA0, 0x72, 0x37, 0x11, 0x18, 0x49, 0x7A, 0x40, 0x93, 0x8C, 0x80, 0xC9, 0x7D,
+    0xDE, 0x01, 0xBB, 0x77, 0x53, 0x80, 0x10, 0xBB, 0x16, 0x80, 0x6B, 0x57, 0x1D, 0x23, 0xD1, 0x07,
+    0xFA, 0xA9, 0x81, 0x7E, 0x4B, 0xB6, 0x1A, 0x66, 0x57, 0xC2, 0x3E, 0x33, 0x1B, 0x39, 0xF3, 0x00,
+    0x86, 0x4B, 0xFC, 0xD6, 0xF7, 0x31, 0xB3, 0x81, 0x6C, 0x2A, 0x4F, 0x62, 0x56, 0x93, 0xAF, 0xC2,
+    0xC5, 0x27, 0x87, 0x06, 0x98, 0x0C, 0x47, 0x80, 0x04, 0x9E, 0x27, 0xA0, 0x1A, 0x30, 0xD5, 0x67,
+    0x60, 0x1F, 0x0A, 0x78, 0xBD, 0x4E, 0x62, 0xC9, 0x38, 0xB3, 0x62, 0xB8, 0x01, 0x9C, 0x2F, 0x7E,
+    0x59, 0x0C, 0x8B, 0xE3, 0x7B, 0x2C, 0x13, 0x77, 0x93, 0xE1, 0xA2, 0x12, 0x98, 0x0C, 0xC2, 0x08,
+    0x5C, 0x34, 0x84, 0xC9, 0x86, 0x51, 0xC9, 0xFC, 0x4E, 0x06, 0xE7, 0x07, 0x02, 0xF7, 0x41, 0x24,
+    0x0C, 0xA3, 0x8B, 0x8A, 0xD1, 0x64, 0x30, 0x2A, 0x81, 0x8B, 0x20, 0x4C, 0x81, 0x4B, 0x96, 0x69,
+    0xE3, 0x75, 0x16, 0xC7, 0x04, 0xED, 0xBF, 0x05, 0xA8, 0x6C, 0x01, 0xBC, 0xF9, 0x42, 0x04, 0x0C,
+    0x13, 0x80, 0x73, 0x0F, 0x00, 0xC0, 0xB0, 0xDC, 0x38, 0x5B, 0x2E, 0xC9, 0x0B, 0x36, 0x4B, 0xBF,
+    0x75, 0x10, 0x9F, 0x33, 0x9D, 0x68, 0x99, 0x41, 0x50, 0xE0, 0xEE, 0x0B, 0x61, 0x3E, 0x11, 0x17,
+    0x55, 0x13, 0x93, 0x41, 0x51, 0x02, 0x27, 0x8F, 0x57, 0x79, 0x5A, 0xB2, 0x57, 0x6D, 0x64, 0x9B,
+    0x58, 0xC8, 0x0B, 0xB6, 0xF3, 0xC5, 0x7F, 0xCD, 0x93, 0xCF, 0x72, 0x64, 0x31, 0x02, 0x62, 0xCB,
+    0x4A, 0x54, 0x86, 0xC9, 0xD6, 0xC3, 0x45, 0x01, 0x38, 0x45, 0x28, 0x12, 0x30, 0x6C, 0x80, 0x7B,
+    0x20, 0x00, 0x75, 0x85, 0x12, 0x53, 0x60, 0xF2, 0x9C, 0xE1, 0xA2, 0xCB, 0xA0, 0x0F, 0xBB, 0x65,
+    0xDC, 0x76, 0x12, 0xDB, 0x0E, 0xE0, 0xA9, 0xE3, 0x22, 0xD6, 0x24, 0x93, 0x21, 0x3B, 0x54, 0x76,
+    0x11, 0x26, 0x12, 0x70, 0x4A, 0x80, 0x6A, 0x32, 0xD4, 0xEE, 0x22, 0x66, 0x4F, 0xE0, 0x65, 0x25,
+    0x18, 0xB3, 0xC9, 0x30, 0xD1, 0x45, 0x5C, 0x03, 0x31, 0x16, 0x25, 0xA3, 0x89, 0x26, 0xCF, 0x1D,
+    0x2E, 0x6D, 0xD9, 0xF0, 0x51, 0x47, 0x60, 0xF2, 0x47, 0x52, 0xFC, 0xB0, 0x5C, 0x1A, 0x46, 0xC5,
+    0xAC, 0x99, 0x34, 0x13, 0xB8, 0x4F, 0x04, 0x98, 0x0D, 0x31, 0xFC, 0xB8, 0xCC, 0x9B, 0x1F, 0xFE,
+    0xB3, 0x5A, 0xE7, 0xC7, 0xFF, 0x90, 0x6B, 0xCE, 0x8F, 0x9F, 0xC8, 0x55, 0xB7, 0x8E, 0xB9, 0xBD,
+    0xE4, 0x56, 0x95, 0xB7, 0xEA, 0xA2, 0xCA, 0xA1, 0xB8, 0xA8, 0xB2, 0xCB, 0x36, 0xAA, 0x6C, 0x77,
+    0x1B, 0x75, 0x36, 0xC9, 0x46, 0xBD, 0x9B, 0x68, 0x93, 0xEB, 0x57, 0x3C, 0x25, 0x10, 0x03, 0xE5,
+    0x8B, 0xE3, 0xFF, 0x90, 0xF5, 0x38, 0x7E, 0x9B, 0x94, 0x60, 0x2A, 0x20, 0xC6, 0x06, 0x17, 0xB1,
+    0xF9, 0x03, 0x24, 0x59, 0x40, 0xB2, 0xC1, 0xFD, 0xFB, 0x5D, 0xFA, 0xFF, 0xFA, 0x9B, 0x05, 0x6E,
+    0xB7, 0x4C, 0x1B, 0xEF, 0xB0, 0x38, 0xEE, 0xB8, 0xF2, 0x99, 0xC7, 0x44, 0x7A, 0x45, 0x36, 0x70,
+    0x0D, 0xD9, 0x26, 0xF0, 0x55, 0xC1, 0x24, 0x61, 0x85, 0xFB, 0xE7, 0x02, 0xD5, 0xE8, 0xE1, 0x3E,
+    0xF8, 0x7C, 0x50, 0xA1, 0x64, 0x8B, 0x70, 0x6F, 0x0B, 0xA6, 0xE2, 0xF2, 0xC0, 0x81, 0x1F, 0x6F,
+    0x51, 0x93, 0x19, 0x13, 0x2B, 0x70, 0x76, 0x09, 0x9C, 0x2F, 0xCB, 0xB2, 0x18, 0x92, 0x7C, 0x8B,
+    0x24, 0x93, 0x29, 0x08, 0x51, 0x09, 0xE6, 0x0C, 0x42, 0x0B, 0x5C, 0x1C, 0x08, 0x93, 0xFF, 0xD7,
+    0x60, 0x41, 0x88, 0x96, 0x89, 0x34, 0x2C, 0x81, 0xF1, 0xEC, 0xC5, 0xEF, 0xC0, 0x91, 0xC9, 0x92,
+    0x45, 0xC9, 0x5C, 0x95, 0xFC, 0xF4, 0x4B, 0x57, 0x25, 0x73, 0x51, 0x64, 0x52, 0xA4, 0x57, 0xFD,
+    0x35, 0x7C, 0xAE, 0x1F, 0x72, 0xDC, 0x6B, 0x96, 0x09, 0x8E, 0x09, 0xB8, 0xD2, 0xFD, 0x48, 0x46,
+    0x47, 0xAA, 0x06, 0xB1, 0x49, 0x65, 0x62, 0xFA, 0xF3, 0x02, 0xD8, 0xF4, 0x85, 0x3E, 0x16, 0xC0,
+    0xED, 0xC0, 0x16, 0x31, 0xD0, 0x43, 0x71, 0x1D, 0x7E, 0x9F, 0x6C, 0x9A, 0xCC, 0x23, 0x3B, 0x70,
+    0x7E, 0x6C, 0xF7, 0x82, 0x87, 0xF8, 0xF0, 0x41, 0x09, 0xF7, 0xE5, 0x9A, 0x12, 0xF3, 0x20, 0xB9,
+    0x58, 0x9F, 0x50, 0x72, 0x76, 0xE8, 0xAB, 0x12, 0xFC, 0xC2, 0x41, 0x48, 0x40, 0x60, 0xC2, 0xC4,
+    0x86, 0xF3, 0x65, 0x58, 0x9E, 0x67, 0x71, 0x0C, 0x7D, 0x64, 0xE2, 0x3A, 0x65, 0x2D, 0x10, 0xD8,
+    0x34, 0xAF, 0xA0, 0xCA, 0x98, 0xF2, 0x2B, 0x80, 0xBB, 0x13, 0x31, 0xB6, 0x0A, 0x18, 0x02, 0xD8,
+    0xD2, 0x89, 0xC7, 0x7A, 0x28, 0xB5, 0x03, 0x6F, 0x0A, 0x30, 0xD1, 0x1F, 0xC4, 0xB8, 0x04, 0x00,
+    0xC3, 0x0C, 0x18, 0xEE, 0xA7, 0x8A, 0x78, 0x85, 0xDF, 0xC6, 0x40, 0x72, 0x9D, 0x3A, 0x43, 0x9E,
+    0xF7, 0x6D, 0xAA, 0x2E, 0x6E, 0x4A, 0x5C, 0xDC, 0xC6, 0xF6, 0xB8, 0x53, 0x62, 0xF7, 0x4D, 0x57,
+    0xF3, 0x29, 0x6F, 0x66, 0x45, 0x72, 0x85, 0xE5, 0x47, 0x00, 0x36, 0x00, 0x23, 0xFF, 0xF6, 0x44,
+    0x7A, 0xB6, 0x5C, 0xE2, 0x7C, 0xF1, 0xCB, 0x25, 0xF9, 0x4D, 0xBE, 0xC7, 0xFA, 0x74, 0x07, 0xA3,
+    0x8D, 0xE0, 0x2D, 0xC1, 0x40, 0x93, 0x30, 0xB2, 0x03, 0x23, 0x77, 0x40, 0x11, 0xC0, 0xD4, 0x00,
+    0x6C, 0x02, 0xE8, 0x1F, 0x0B, 0xE0, 0xAE, 0x57, 0xA8, 0x3A, 0x17, 0xD8, 0x68, 0xF3, 0xD8, 0xE0,
+    0x72, 0xA0, 0x66, 0xA7, 0x58, 0xE6, 0xF3, 0xC5, 0x2F, 0x37, 0x0C, 0x0B, 0x79, 0x9B, 0xD5, 0x72,
+    0x35, 0x19, 0x9B, 0x57, 0x02, 0x9B, 0x40, 0x4C, 0x05, 0x2E, 0x8E, 0x0D, 0xFF, 0x07, 0xF0, 0xD3,
+    0x85, 0xAB, 0x25, 0x49, 0x43, 0x92, 0x09, 0x80, 0xCE, 0x00, 0x20, 0x00, 0xE0, 0x00, 0xC0, 0xAC,
+    0x00, 0x86, 0x74, 0xAA, 0x48, 0xC3, 0xF2, 0x87, 0xEC, 0x8E, 0xFF, 0xC4, 0x3D, 0xF4, 0xA1, 0xC3,
+    0x45, 0x5D, 0x41, 0xCC, 0xBB, 0x12, 0x84, 0x68, 0x32, 0x08, 0x17, 0x55, 0x07, 0x31, 0x91, 0x82,
+    0x89, 0xCC, 0xB8, 0xF2, 0x1D, 0x17, 0x4F, 0x29, 0x56, 0x82, 0xA3, 0xC2, 0xC2, 0x25, 0x60, 0x62,
+    0x01, 0x1C, 0xD3, 0xF9, 0xF2, 0x7B, 0xCB, 0x1F, 0x2C, 0x37, 0x48, 0xC7, 0x77, 0xF8, 0x43, 0x96,
+    0xAD, 0xD9, 0xEE, 0x09, 0x17, 0xCD, 0xAE, 0x04, 0x84, 0x5B, 0x4D, 0x56, 0x82, 0x0E, 0x17, 0x4D,
+    0x56, 0x15, 0xFF, 0xCF, 0x8F, 0xFE, 0x32, 0x7C, 0xEF, 0x66, 0xB6, 0x24, 0x49, 0x21, 0x49, 0x32,
+    0x9F, 0x66, 0x76, 0x7C, 0x87, 0x3F, 0xA2, 0x58, 0x7E, 0x93, 0xEF, 0xF1, 0xA3, 0xD3, 0xAF, 0xBF,
+    0xDA, 0xD0, 0x17, 0x2E, 0x5B, 0x3A, 0x66, 0x6F, 0x8E, 0x24, 0x4F, 0x06, 0x05, 0xED, 0x08, 0xF2,
+    0xA5, 0x70, 0xEF, 0x08, 0xDF, 0x3A, 0x02, 0xCE, 0x97, 0xC5, 0x83, 0x24, 0x14, 0x59, 0x60, 0xDE,
+    0x25, 0x70, 0x4D, 0x09, 0x50, 0x4C, 0x06, 0xFC, 0x91, 0xDE, 0x1B, 0x80, 0x22, 0x3D, 0x0C, 0xB9,
+    0xC2, 0xDD, 0xA7, 0x07, 0x87, 0x0E, 0x25, 0x4A, 0x60, 0xB2, 0xD9, 0xE1, 0xE2, 0xE6, 0x07, 0xDE,
+    0x14, 0x38, 0x32, 0x0E, 0xE4, 0x47, 0x8F, 0xA9, 0x3D, 0x96, 0xC5, 0xB0, 0xC0, 0xF1, 0x43, 0x56,
+    0x1C, 0x9A, 0x7A, 0x48, 0xE5, 0xA1, 0x95, 0x27, 0xB1, 0xC4, 0xE6, 0xCD, 0x23, 0x7F, 0x08, 0xEB,
+    0x3A, 0x15, 0x90, 0x32, 0x36, 0xB8, 0xFB, 0x5C, 0x37, 0x6F, 0xB2, 0xC9, 0x36, 0x29, 0x19, 0x65,
+    0x2A, 0x20, 0x38, 0x36, 0xB8, 0x18, 0xE2, 0xE6, 0xCD, 0xA7, 0x5B, 0x72, 0xBB, 0xE5, 0xA1, 0xB0,
+    0x5C, 0x1D, 0xF7, 0x2F, 0xA6, 0x75, 0x4C, 0xB0, 0x5C, 0xBF, 0xAC, 0x47, 0x02, 0xA8, 0x76, 0xF9,
+    0xD8, 0x2F, 0x16, 0x25, 0xD3, 0xFF, 0xE8, 0x17, 0x71, 0xF3, 0x23, 0x8C, 0xE4, 0x3E, 0x90, 0x44,
+    0xF0, 0x61, 0x9F, 0x57, 0x2D, 0x2A, 0x61, 0x5B, 0xFF, 0x04, 0x73, 0x06, 0x94, 0x60, 0x3E, 0x72,
+    0x17, 0xF1, 0xE2, 0xEB, 0x07, 0x80, 0xA1, 0xAB, 0x08, 0x5E, 0x54, 0x6C, 0x91, 0x7F, 0xC1, 0x68,
+    0x8F, 0xA4, 0xF8, 0xC7, 0x1E, 0x03, 0xAF, 0xBF, 0x06, 0xD2, 0x5B, 0xD6, 0x91, 0x55, 0x91, 0x15,
+    0x84, 0x4B, 0xB6, 0x28, 0x19, 0x1B, 0x5C, 0x36, 0xD9, 0x64, 0x84, 0xE8, 0x62, 0x58, 0x41, 0xCF,
+    0xB1, 0x41, 0x75, 0x45, 0x16, 0x4C, 0xD5, 0x90, 0x09, 0x76, 0x77, 0x1F, 0xD3, 0x63, 0x5B, 0x39,
+    0x76, 0x8C, 0x4D, 0xC9, 0x24, 0x30, 0xD9, 0xE4, 0x39, 0x23, 0xAC, 0x2E, 0xBA, 0xAC, 0x04, 0xF4,
+    0xE1, 0x51, 0x38, 0xBC, 0x47, 0x03, 0x89, 0xC0, 0x15, 0x38, 0x0A, 0x06, 0xB0, 0x2C, 0x7E, 0x24,
+    0x05, 0x24, 0xBD, 0xDB, 0x5D, 0xD4, 0x55, 0x09, 0x36, 0xEF, 0xE2, 0x54, 0x94, 0x20, 0xAC, 0x2E,
+    0xAA, 0x7E, 0x21, 0x30, 0x64, 0xC4, 0x4C, 0xC1, 0x28, 0x21, 0x22, 0x5C, 0x08, 0x4C, 0x76, 0x51,
+    0x35, 0x25, 0xD8, 0x62, 0x88, 0x36, 0x3B, 0x7E, 0x57, 0x34, 0xE5, 0xF4, 0x37, 0x02, 0x08, 0x1D,
+    0x96, 0x45, 0x97, 0x10, 0x83, 0x12, 0x5C, 0xBA, 0x88, 0x5F, 0x11, 0x6C, 0x8C, 0xEE, 0xC7, 0x32,
+    0x65, 0x17, 0xA9, 0xC4, 0x3C, 0xDA, 0xD2, 0x46, 0xBE, 0xC5, 0x3B, 0x65, 0xF0, 0x4F, 0x1D, 0x09,
+    0x3E, 0xFB, 0x33, 0x58, 0xEE, 0x86, 0x4D, 0xB5, 0xD7, 0xD7, 0x0D, 0x30, 0x3B, 0x06, 0x39, 0x87,
+    0x65, 0x57, 0x64, 0x75, 0x7B, 0x78, 0x5F, 0x86, 0xEE, 0xA2, 0xF9, 0x91, 0x80, 0x2E, 0x9A, 0x1F,
+    0x36, 0x70, 0xDE, 0xE7, 0xC4, 0xBF, 0x16, 0x4D, 0x62, 0xE6, 0x8A, 0x33, 0x0F, 0x9C, 0x7B, 0x45,
+    0x26, 0x47, 0xAE, 0x61, 0x14, 0x9D, 0xE7, 0x18, 0x06, 0xD1, 0x24, 0x02, 0x8B, 0x2E, 0x21, 0x05,
+    0x74, 0x9D, 0xCD, 0x1E, 0xC6, 0x66, 0xC9, 0x57, 0x0F, 0x31, 0x82, 0x23, 0xEF, 0x90, 0x29, 0xDC,
+    0x2E, 0xF3, 0xFE, 0xB2, 0xAE, 0x66, 0xE8, 0xA3, 0x0F, 0x2B, 0xE6, 0x1D, 0xBA, 0x62, 0xE8, 0x40,
+    0x58, 0xB1, 0x11, 0x8E, 0x11, 0x8A, 0xEC, 0x20, 0xE9, 0xD5, 0x4E, 0xA0, 0xB8, 0x88, 0xAB, 0x26,
+    0x63, 0x56, 0x82, 0x29, 0xF2, 0x30, 0x3C, 0xD5, 0x64, 0xDC, 0x53, 0x82, 0x00, 0x0E, 0x24, 0x5B,
+    0x20, 0xF9, 0x42, 0x84, 0x79, 0x3F, 0x43, 0xE5, 0x0A, 0xDC, 0xBB, 0x0A, 0xFC, 0xDA, 0x19, 0x30,
+    0x78, 0x9C, 0x79, 0xD8, 0x0E, 0xC7, 0xEC, 0x6E, 0xB7, 0x39, 0xBA, 0x3B, 0xBB, 0x79, 0x48, 0x56,
+    0xB2, 0xBB, 0x15, 0x26, 0x43, 0x35, 0x20, 0xFC, 0xDB, 0x9F, 0x1A, 0xD2, 0x6F, 0xF4, 0xB8, 0x81,
+    0x33, 0x00, 0x03, 0x82, 0x62, 0xDA, 0x46, 0x4E, 0x5D, 0xCB, 0xD7, 0xBA, 0xCE, 0xEE, 0xEF, 0x21,
+    0xF3, 0x5B, 0x05, 0xA8, 0xC1, 0xAC, 0x18, 0x3F, 0x6B, 0x02, 0x18, 0xB2, 0x00, 0xDB, 0xCD, 0xEF,
+    0x66, 0xE8, 0x1A, 0xCC, 0x0E, 0x77, 0x5F, 0x6C, 0x1A, 0xBB, 0xCE, 0x2E, 0xDA, 0x1C, 0x72, 0xB8,
+    0x4F, 0xC5, 0xB8, 0xC5, 0x4B, 0x00, 0x4F, 0x02, 0xE7, 0x7E, 0x60, 0x1B, 0xC8, 0xD4, 0xA6, 0xFA,
+    0x4B, 0xE8, 0x40, 0x80, 0xA1, 0x57, 0xDC, 0xF1, 0xCB, 0x7D, 0x80, 0x7B, 0x90, 0xCC, 0x27, 0x4D,
+    0x57, 0x47, 0x19, 0x59, 0x31, 0x78, 0xB8, 0x6E, 0x78, 0x9D, 0x17, 0x8C, 0xC1, 0xBB, 0x75, 0x4E,
+    0x76, 0xD7, 0xC5, 0xD6, 0xA1, 0xD9, 0x8E, 0x70, 0xD3, 0xAD, 0x33, 0xCD, 0xAE, 0xA9, 0xEA, 0x40,
+    0x74, 0x04, 0xEF, 0xD6, 0xAD, 0xD8, 0xE6, 0xBA, 0xE1, 0xE1, 0x6F, 0xED, 0x98, 0x31, 0x25, 0xC1,
+    0xD0, 0x3B, 0x30, 0x9F, 0xEE, 0x2E, 0x00, 0x60, 0x75, 0xCD, 0x35, 0xC3, 0xA1, 0xA1, 0x23, 0xF8,
+    0x6D, 0x9D, 0xD3, 0xB6, 0xEB, 0xB2, 0xD5, 0xA1, 0xDD, 0xEB, 0x08, 0xE2, 0xD6, 0x59, 0xCC, 0xAE,
+    0x45, 0xD5, 0xA1, 0xA1, 0x8F, 0x4C, 0x5B, 0x61, 0x75, 0x0D, 0xC0, 0xA5, 0xEB, 0xAA, 0xB8, 0x66,
+    0xAA, 0x2E, 0xF6, 0xFB, 0xBA, 0x38, 0xE8, 0x72, 0x0F, 0xFA, 0xB3, 0x0A, 0x4D, 0x81, 0x7E, 0xD4,
+    0xA1, 0xCB, 0xE6, 0x75, 0x71, 0x51, 0x17, 0xBB, 0xDB, 0x66, 0xAA, 0xEB, 0xAA, 0x01, 0xB8, 0xD4,
+    0xA4, 0x68, 0xB2, 0xE2, 0xE5, 0x39, 0xE1, 0xA5, 0x53, 0xBB, 0x37, 0x27, 0xFC, 0xE3, 0x9C, 0x50,
+    0xE7, 0x84, 0x32, 0xA7, 0xDF, 0xC8, 0x73, 0x0A, 0xFB, 0xBC, 0x6F, 0x91, 0x12, 0x9E, 0xA3, 0x3C,
+    0x05, 0xC0, 0x09, 0x5C, 0xDD, 0xCA, 0xC8, 0x14, 0xB2, 0x91, 0x81, 0x69, 0xCB, 0xFA, 0x07, 0xAF,
+    0xFE, 0x20, 0xCE, 0xE1, 0x77, 0x02, 0x5E, 0x7E, 0xE5, 0x91, 0x0C, 0x85, 0x6F, 0x67, 0xFD, 0x5E,
+    0x9B, 0xE3, 0x7C, 0x91, 0x03, 0x5E, 0x9E, 0x9E, 0x15, 0xDD, 0x61, 0x9B, 0x93, 0x81, 0xD5, 0x75,
+    0xC3, 0x3B, 0xBC, 0x60, 0x0A, 0xDE, 0xC5, 0x39, 0x99, 0xAC, 0x8B, 0x92, 0x81, 0x77, 0x89, 0x40,
+    0xC6, 0xF9, 0xE3, 0x17, 0x0E, 0xA0, 0x81, 0x08, 0xDE, 0xC5, 0xAD, 0x1E, 0xE9, 0x5B, 0x71, 0x76,
+    0x89, 0x91, 0x15, 0x8E, 0xA2, 0xDA, 0x5C, 0xE6, 0x34, 0x67, 0xC2, 0x3D, 0x10, 0xD0, 0x64, 0x25,
+    0x2E, 0x9A, 0x4C, 0xB8, 0x07, 0x7D, 0xE8, 0xBA, 0xCF, 0x79, 0x22, 0x31, 0x71, 0x07, 0x6E, 0x00,
+    0x8E, 0xE4, 0x75, 0x92, 0x31, 0xAC, 0x61, 0x9D, 0x93, 0xD9, 0x75, 0x39, 0x92, 0x88, 0xE3, 0x00,
+    0x7F, 0x06, 0xD8, 0xAA, 0x6B, 0xAE, 0xCF, 0xF4, 0xF0, 0x4F, 0x0D, 0xFC, 0x9B, 0x3E, 0x91, 0x5D,
+    0xF3, 0x75, 0x99, 0x8A, 0x29, 0x36, 0xDA, 0x7D, 0x43, 0xB8, 0x2D, 0x43, 0x9F, 0xB2, 0xAE, 0x36,
+    0xCE, 0x69, 0x03, 0xC7, 0xFE, 0x7C, 0x9D, 0xC8, 0xD5, 0xB2, 0x60, 0xBB, 0x81, 0x51, 0x80, 0x29,
+    0x03, 0x6E, 0x87, 0x66, 0xC1, 0x37, 0xEE, 0xAE, 0xC0, 0x99, 0x87, 0x25, 0x1C, 0x77, 0xF7, 0xBE,
+    0xCC, 0x29, 0x98, 0xFC, 0x75, 0x25, 0x00, 0x01, 0x17, 0x61, 0x0A, 0x46, 0x02, 0xE1, 0xB3, 0xBF,
+    0x9B, 0x48, 0x04, 0x7A, 0xDC, 0x80, 0x23, 0x2B, 0xC9, 0x87, 0xFF, 0xD2, 0xE7, 0x3B, 0x17, 0xF5,
+    0xEA, 0x55, 0xB3, 0xE7, 0x27, 0xDD, 0x2D, 0xA0, 0x03, 0xAA, 0x02, 0x66, 0x07, 0xDC, 0x0A, 0x74,
+    0xC0, 0xD2, 0x0F, 0xEC, 0x08, 0x34, 0x9C, 0x79, 0x9B, 0x2B, 0xBD, 0x5D, 0xE7, 0xDD, 0x44, 0x25,
+    0x7A, 0xC7, 0x76, 0x51, 0x60, 0x76, 0xC1, 0x28, 0x6F, 0x00, 0x2E, 0x00, 0x86, 0x1E, 0x03, 0xE3,
+    0x61, 0x30, 0x75, 0x06, 0x86, 0x8A, 0x01, 0x82, 0xE1, 0xC3, 0x06, 0xB0, 0x01, 0xB6, 0x01, 0x63,
+    0x05, 0x00, 0x3C, 0x01, 0xC0, 0x56, 0x60, 0xE0, 0x0E, 0x20, 0xAC, 0x00, 0x3A, 0x8E, 0xF9, 0x61,
+    0x76, 0x60, 0x3A, 0x3D, 0xB2, 0x58, 0xED, 0xC3, 0x4F, 0x79, 0xAB, 0x99, 0x9D, 0x26, 0xBB, 0x5B,
+    0xCD, 0xC5, 0xAE, 0x6A, 0x57, 0xD5, 0x3C, 0x14, 0xB3, 0xBB, 0x3B, 0xD9, 0xDD, 0x6A, 0x76, 0xEF,
+    0x26, 0xBB, 0x7F, 0xFD, 0x94, 0x70, 0x64, 0xC6, 0xD3, 0x6C, 0x3F, 0xCB, 0x85, 0xF0, 0xDA, 0xC9,
+    0x28, 0xFE, 0xE6, 0x5D, 0x0F, 0xD7, 0x9C, 0xB8, 0x3A, 0x17, 0x2D, 0x73, 0x1C, 0xBB, 0x3B, 0x8C,
+    0x9B, 0x2D, 0xA7, 0x47, 0x07, 0x15, 0x78, 0xB3, 0x63, 0xAC, 0x9B, 0x9F, 0xB2, 0x4B, 0xAE, 0x04,
+    0xD9, 0x2A, 0xC5, 0xD1, 0xF2, 0x82, 0xEF, 0x72, 0xD7, 0x45, 0x57, 0x04, 0x1F, 0xD6, 0x5F, 0x34,
+    0xA8, 0xBA, 0x8E, 0x8F, 0xFD, 0x73, 0x04, 0x06, 0x79, 0x6C, 0xC3, 0x2A, 0x00, 0xE3, 0x01, 0xFC,
+    0xFA, 0x26, 0x9B, 0x6C, 0x35, 0x54, 0x93, 0xE7, 0xF4, 0xD3, 0x4D, 0x93, 0x69, 0x24, 0x13, 0xCE,
+    0x6F, 0x26, 0x60, 0x3E, 0xDA, 0x40, 0x81, 0xA2, 0xB8, 0x16, 0x1E, 0x31, 0xF3, 0x13, 0xBE, 0xCD,
+    0x35, 0x0C, 0xA2, 0xCB, 0x20, 0x3A, 0xCF, 0x49, 0xE7, 0x39, 0x06, 0x3F, 0xC7, 0x30, 0x34, 0xFC,
+    0x77, 0xF0, 0xB3, 0x4D, 0x97, 0x89, 0x8F, 0xD7, 0xC4, 0xFC, 0x55, 0x50, 0x75, 0x47, 0x92, 0x15,
+    0x00, 0xA6, 0x1D, 0x87, 0x55, 0x07, 0xF0, 0x12, 0x00, 0x20, 0x03, 0xC0, 0xE0, 0x1D, 0x1B, 0x1C,
+    0x2B, 0xAE, 0xCD, 0x09, 0x57, 0xE7, 0x84, 0x67, 0xE6, 0xEF, 0xF9, 0x27, 0x66, 0x56, 0xCC, 0x6C,
+    0x98, 0x13, 0x31, 0xA7, 0xED, 0x68, 0xEF, 0x76, 0x6C, 0x94, 0x81, 0x87, 0xC1, 0x70, 0xF4, 0x33,
+    0x1F, 0x70, 0x07, 0xAB, 0x2E, 0x18, 0x1B, 0x82, 0x87, 0x4D, 0xFA, 0xD1, 0xE5, 0xD8, 0x10, 0xB8,
+    0xDB, 0xA4, 0xC9, 0xE7, 0x1A, 0xC2, 0x85, 0xD8, 0xA4, 0x8B, 0x7D, 0xAB, 0x21, 0x3C, 0x27, 0x36,
+    0xE9, 0x12, 0x6E, 0xB7, 0x91, 0xCC, 0x9B, 0x38, 0xD6, 0x99, 0x11, 0x27, 0x32, 0xC5, 0x1D, 0xBA,
+    0x00, 0xC1, 0x43, 0x3F, 0xBA, 0x44, 0xE0, 0xAE, 0xC9, 0x35, 0x5C, 0x88, 0x2E, 0x36, 0x86, 0xE7,
+    0x44, 0x97, 0x70, 0x9B, 0xCC, 0xEE, 0xD8, 0x0E, 0xCE, 0x31, 0xB0, 0x8D, 0x64, 0x6A, 0x5A, 0x7E,
+    0x15, 0x9B, 0x87, 0xD9, 0x0D, 0xAB, 0x62, 0xC7, 0x79, 0xB8, 0x85, 0xF9, 0xFD, 0x34, 0x9D, 0x44,
+    0x5B, 0xB3, 0xE2, 0xCC, 0x03, 0xC0, 0x99, 0x57, 0xDC, 0x0D, 0x57, 0xD7, 0x34, 0x89, 0xE0, 0xF9,
+    0x42, 0xD5, 0xC5, 0xC6, 0x10, 0xC3, 0x85, 0x28, 0xD1, 0xE4, 0x6A, 0x63, 0x60, 0x1D, 0x45, 0x7F,
+    0xBA, 0xAD, 0xF6, 0x84, 0x16, 0x97, 0xDC, 0x1A, 0x9E, 0xE3, 0x0B, 0xD9, 0x36, 0xC3, 0xA6, 0xB8,
+    0x5B, 0x9E, 0x0A, 0x3D, 0x02, 0x8B, 0x21, 0xD7, 0xED, 0xA2, 0xAA, 0x6A, 0x76, 0x93, 0xDD, 0x6A,
+    0xF7, 0x0E, 0xC7, 0x0A, 0xC7, 0x1D, 0xE2, 0x56, 0x93, 0x3B, 0xB6, 0x8B, 0x3A, 0x55, 0x27, 0xE1,
+    0x3E, 0xCB, 0x93, 0x27, 0xA9, 0x17, 0xEB, 0xC3, 0xF5, 0xDD, 0x3C, 0x28, 0xF0, 0x07, 0x74, 0x03,
+    0x23, 0x77, 0x45, 0xAA, 0x6A, 0xDF, 0x15, 0x55, 0x3B, 0xFA, 0x51, 0x94, 0x1F, 0xD6, 0x43, 0x23,
+    0x12, 0x74, 0xFF, 0xAB, 0x44, 0x96, 0x89, 0x05, 0x67, 0x1E, 0x3F, 0x01, 0xBD, 0xBC, 0x4F, 0xAC,
+    0x1D, 0xC7, 0x95, 0xE6, 0xF9, 0xCB, 0x0C, 0x3E, 0xA6, 0xAC, 0x1C, 0x38, 0xD8, 0x00, 0x1F, 0xEC,
+    0xB2, 0xAA, 0x2A, 0x8D, 0x46, 0xA3, 0xA1, 0x46, 0xBB, 0x1C, 0xB5, 0xF0, 0xC2, 0x33, 0x20, 0x19,
+    0x29, 0x71, 0x66, 0xB4, 0x30, 0xBA, 0xF5, 0x1A, 0xE0, 0xED, 0x06, 0xDA, 0x0B, 0x79, 0x51, 0x8B,
+    0x29, 0x37, 0xA6, 0x58, 0x0B, 0x2F, 0xBC, 0x20, 0x99, 0x29, 0x69, 0xE1, 0x85, 0x81, 0x21, 0x81,
+    0xA9, 0xAA, 0x01, 0xA6, 0x16, 0x6D, 0xA0, 0xD5, 0x80, 0xCD, 0x9A, 0x69, 0x69, 0x61, 0x34, 0xDC,
+    0x00, 0xA9, 0x0C, 0xF2, 0x35, 0x9A, 0x0B, 0x2F, 0x94, 0x92, 0xE0, 0x36, 0x1A, 0x6E, 0x40, 0x29,
+    0xCB, 0xF5, 0x4F, 0x5A, 0x28, 0x28, 0xA7, 0xC6, 0x49, 0x2A, 0x32, 0xBF, 0x59, 0xE4, 0xBD, 0x8F,
+    0x94, 0x2C, 0xCB, 0x25, 0x59, 0xAA, 0xFB, 0x6E, 0xE6, 0xCD, 0x8C, 0x7B, 0xDF, 0xCD, 0x13, 0x91,
+    0x11, 0x27, 0xBE, 0x73, 0xBE, 0x2F, 0xEE, 0x9E, 0x49, 0xFE, 0xA5, 0x04, 0xD8, 0x36, 0xD9, 0x90,
+    0x6C, 0x98, 0x6D, 0x3F, 0xDB, 0x7E, 0xA9, 0x5E, 0x9D, 0xDD, 0x8D, 0x67, 0x00, 0xB2, 0x08, 0x17,
+    0xA0, 0x82, 0xA2, 0x25, 0x1F, 0xA9, 0x34, 0x54, 0x5A, 0xAA, 0x1F, 0x3F, 0xFE, 0xC2, 0x4B, 0x2F,
+    0xBD, 0x1C, 0xBF, 0xFF, 0x0F, 0xD2, 0x17, 0x68, 0x4A, 0xAA, 0x9B, 0xA1, 0x88, 0xCF, 0xB1, 0x9C,
+    0xC2, 0xBF, 0xF9, 0xD5, 0xA7, 0xA5, 0xC1, 0x6B, 0xE0, 0x22, 0x58, 0x30, 0x01, 0x22, 0x9C, 0x82,
+    0x07, 0x01, 0x8E, 0x41, 0xA9, 0x1A, 0xA9, 0x2E, 0x63, 0x87, 0xAF, 0x53, 0x96, 0x4C, 0x28, 0x23,
+    0xB8, 0xC0, 0x9E, 0x36, 0x74, 0x4A, 0xD9, 0xB3, 0x77, 0xAF, 0xE0, 0x6B, 0xB2, 0x04, 0x45, 0x04,
+    0x5F, 0xF3, 0xE0, 0x72, 0xF5, 0xBA, 0x97, 0x46, 0x49, 0xE1, 0x0A, 0x27, 0x01, 0x4C, 0x7B, 0xF0,
+    0xE5, 0xE7, 0xBB, 0x37, 0x6F, 0x48, 0xB1, 0x7C, 0x75, 0x26, 0x99, 0xC1, 0xB6, 0x67, 0x48, 0x66,
+    0xB0, 0xFD, 0x9C, 0x49, 0xF1, 0x79, 0xBD, 0x79, 0xF8, 0xE4, 0xC1, 0x97, 0xD9, 0x3E, 0x2A, 0xDD,
+    0xD0, 0xCF, 0x35, 0x34, 0xA3, 0x1B, 0x4C, 0x34, 0x29, 0x1F, 0x69, 0xEA, 0x84, 0x8D, 0x17, 0x61,
+    0xF6, 0x18, 0xBD, 0x92, 0x90, 0x04, 0x4D, 0xA0, 0x7C, 0xF6, 0xEE, 0x90, 0x4B, 0x23, 0x08, 0xF0,
+    0x01, 0x6C, 0x84, 0x46, 0x3D, 0x4E, 0x11, 0xAE, 0x6F, 0x1F, 0x7F, 0x08, 0x70, 0x71, 0x77, 0x06,
+    0xD0, 0x0C, 0xB9, 0x52, 0xD9, 0xA6, 0xAA, 0xBE, 0xE0, 0x02, 0x7E, 0xE4, 0xB4, 0x38, 0xD5, 0x0C,
+    0x67, 0xCA, 0xA9, 0x6A, 0xE7, 0x72, 0xFC, 0x62, 0x2E, 0x4B, 0xF3, 0x02, 0xA5, 0x3E, 0xC5, 0xE2,
+    0xB9, 0xE6, 0xEB, 0xC9, 0x69, 0x28, 0x55, 0x73, 0x02, 0xC8, 0xC7, 0x4B, 0xFE, 0xF2, 0xCF, 0xC7,
+    0xE7, 0x8F, 0x65, 0x35, 0xD9, 0xF7, 0x80, 0x4E, 0x3D, 0x55, 0x9D, 0x0F, 0x44, 0xB2, 0xC1, 0x72,
+    0xF5, 0x91, 0xFE, 0x1B, 0x95, 0xF2, 0xC3, 0x30, 0x9E, 0x2A, 0xFE, 0x79, 0x19, 0xAE, 0x7C, 0xFA,
+    0x4B, 0x67, 0xE0, 0xCB, 0xFD, 0x04, 0x3F, 0x3F, 0x3B, 0x60, 0xFE, 0x8F, 0x32, 0xF0, 0xE9, 0x2F,
+    0x54, 0xAF, 0x87, 0x6F, 0x7C, 0xA3, 0x5A, 0x4C, 0x88, 0x7B, 0xF5, 0xEF, 0x11, 0xC9, 0x07, 0xEE,
+    0x70, 0x11, 0x1A, 0xB5, 0xB0, 0x77, 0x00, 0x0F, 0x0E, 0x56, 0xC5, 0x61, 0x60, 0x7C, 0x68, 0xAE,
+    0x9E, 0xF8, 0xCA, 0xD3, 0x2F, 0x49, 0xEE, 0x72, 0x4D, 0x7E, 0xF5, 0x3F, 0x2A, 0x01, 0x5F, 0xBF,
+    0xFA, 0xDD, 0x4E, 0x73, 0xA7, 0x19, 0x2E, 0xEE, 0x9E, 0x27, 0x9D, 0x1E, 0xD7, 0x6B, 0x1A, 0xD9,
+    0x83, 0x52, 0x6D, 0xD1, 0x56, 0xFC, 0xE8, 0xE0, 0xCB, 0x0F, 0x3F, 0xDF, 0x1F, 0x9E, 0xBD, 0xFC,
+    0xE9, 0xDF, 0xFF, 0x1F, 0xFB, 0x7F, 0x67, 0xA6, 0xF2, 0xF7, 0xFF, 0xA7, 0xFE, 0xDF, 0x7D, 0xEB,
+    0x95, 0x7F, 0xF6, 0xDB, 0xE7, 0xFE, 0x71, 0x78, 0x8E, 0x6F, 0xE4, 0x7F, 0x79, 0x9D, 0xEC, 0x7B,
+    0x34, 0x7A, 0x56, 0xAF, 0x6E, 0x0E, 0x38, 0x40, 0x83, 0xD7, 0x57, 0xFA, 0x94, 0xCA, 0x17, 0xDA,
+    0x6B, 0xD7, 0xED, 0x2D, 0x8D, 0xD5, 0xCC, 0x3E, 0xFC, 0x6F, 0x70, 0x6D, 0xFB, 0xDC, 0x5C, 0x3F,
+    0xB7, 0xBD, 0xF0, 0xB5, 0x7B, 0x85, 0x9C, 0x64, 0x7F, 0xB3, 0x2B, 0x87, 0xEC, 0x4F, 0x72, 0xC5,
+    0xA6, 0xFB, 0xF6, 0x8D, 0xE9, 0xE1, 0xAA, 0x35, 0x91, 0x19, 0x5F, 0xDB, 0x50, 0xDC, 0xFD, 0x6E,
+    0xA7, 0x9B, 0x57, 0x9F, 0xC9, 0xFE, 0xA4, 0xD4, 0xAD, 0xBF, 0x1E, 0xFB, 0xEB, 0x34, 0x99, 0xE8,
+    0x22, 0xCF, 0x53, 0xB5, 0xE7, 0x7F, 0xA2, 0x41, 0x2D, 0xF0, 0xA0, 0xF9, 0xE9, 0xDB, 0xE9, 0xDA,
+    0x03, 0x50, 0x53, 0xFB, 0xE0, 0x83, 0x0F, 0x4D, 0xFB, 0x81, 0x7F, 0xA1, 0x6B, 0x9B, 0xFF, 0x4F,
+    0x7D, 0xA3, 0x37, 0x96, 0x46, 0x4F, 0xA7, 0xE6, 0x24, 0x07, 0x0D, 0xD0, 0xD4, 0xEB, 0xD6, 0xD5,
+    0xF0, 0x87, 0x00, 0xD9, 0xE6, 0xA0, 0x90, 0x42, 0xA7, 0x3B, 0xA5, 0x7E, 0x1C, 0xBC, 0x9E, 0xC8,
+    0x34, 0x5F, 0x28, 0xF5, 0x76, 0x74, 0xFA, 0x71, 0x68, 0xF4, 0x04, 0x9A, 0x2F, 0x64, 0x7A, 0x3B,
+    0x66, 0xEF, 0xFC, 0x38, 0x60, 0x9F, 0x80, 0xD3, 0x17, 0xE0, 0xED, 0x88, 0xB9, 0xFF, 0x74, 0xC0,
+    0xFC, 0x17, 0xB0, 0xC0, 0xE7, 0xC1, 0xB9, 0x77, 0xD2, 0x0C, 0x5F, 0x74, 0x43, 0x3A, 0x7D, 0xE9,
+    0x53, 0x70, 0x22, 0x9B, 0x8D, 0xEA, 0xF3, 0x7D, 0x3E, 0x72, 0x1D, 0x57, 0x97, 0x7D, 0x3E, 0xF2,
+    0xBC, 0xD1, 0x78, 0xF5, 0xBB, 0xC7, 0xA7, 0x52, 0xB7, 0x6E, 0xBC, 0x33, 0xF8, 0xA9, 0x54, 0xFE,
+    0x4E, 0x18, 0x95, 0xCA, 0x09, 0xB2, 0xAB, 0xCF, 0x29, 0x71, 0xFF, 0xC3, 0xB4, 0x64, 0x23, 0x5C,
+    0xC3, 0xA8, 0xC6, 0xB6, 0xF8, 0x91, 0x3C, 0x82, 0xAB, 0xB9, 0x08, 0xF9, 0x88, 0x0D, 0xE0, 0xEA,
+    0x6C, 0x84, 0x7C, 0xC4, 0x73, 0x11, 0x57, 0x17, 0xA1, 0xEA, 0xF3, 0x91, 0xC9, 0xCC, 0xB9, 0xC6,
+    0x8A, 0x77, 0x7A, 0xAF, 0xB3, 0x83, 0x3B, 0x0D, 0x5C, 0x2B, 0x0E, 0x7B, 0xB0, 0xF5, 0x78, 0x1A,
+    0x4C, 0x74, 0x6B, 0x57, 0x91, 0x7A, 0x6C, 0xC0, 0xF4, 0xE4, 0x23, 0x9C, 0x06, 0x0F, 0x59, 0x0D,
+    0xF5, 0xBB, 0xEC, 0xE0, 0x14, 0x54, 0x35, 0x55, 0xCD, 0xFA, 0x71, 0x3F, 0x52, 0xF4, 0x70, 0x1D,
+    0x33, 0x80, 0xAB, 0xF3, 0x08, 0x65, 0xCF, 0x04, 0xF9, 0xC8, 0xB5, 0x6A, 0xE6, 0x3A, 0xA7, 0x2B,
+    0x05, 0x57, 0x3B, 0x7B, 0x38, 0x76, 0xB3, 0x7D, 0x74, 0xB8, 0xEE, 0xF5, 0x78, 0xC0, 0x43, 0x11,
+    0xF0, 0x35, 0x66, 0xC0, 0xD7, 0xE4, 0x11, 0x5F, 0xC3, 0x44, 0xB3, 0xA9, 0xB9, 0x86, 0x57, 0xE4,
+    0x12, 0xA5, 0x26, 0xDC, 0x7A, 0xD1, 0xFB, 0x6D, 0x38, 0x06, 0x45, 0x4B, 0xB5, 0x40, 0xA2, 0x78,
+    0x67, 0xA4, 0xAA, 0xF9, 0x86, 0xAB, 0x4D, 0x04, 0x13, 0xB9, 0x06, 0xC7, 0x13, 0xB6, 0x05, 0x0D,
+    0x79, 0x84, 0xCC, 0xB5, 0x67, 0xB8, 0x48, 0x36, 0x95, 0xA1, 0xEA, 0x69, 0xEA, 0xD1, 0xCC, 0x85,
+    0x06, 0xC7, 0x3B, 0x7D, 0x33, 0x16, 0xBD, 0x3B, 0xCD, 0x01, 0x53, 0x71, 0xD8, 0x43, 0xC5, 0x78,
+    0x1A, 0xCC, 0xE0, 0x34, 0xC3, 0xB5, 0xB5, 0x31, 0x5A, 0x4C, 0x8F, 0x89, 0x70, 0x1A, 0xCE, 0xAC,
+    0x8D, 0xD1, 0x02, 0x70, 0x12, 0x1B, 0x11, 0x36, 0xAE, 0x16, 0xFD, 0x2E, 0x79, 0xCC, 0x3A, 0x14,
+    0xFD, 0x52, 0xDE, 0xE1, 0x1A, 0x65, 0xE0, 0x02, 0x66, 0xFC, 0x6C, 0xA5, 0xBE, 0x5B, 0x32, 0x05,
+    0x60, 0xAF, 0xAE, 0xA1, 0x7A, 0xAB, 0x07, 0xAF, 0x1E, 0xBE, 0xE0, 0x03, 0x1C, 0xDB, 0x3B, 0xAA,
+    0xD3, 0xE7, 0x60, 0x75, 0x54, 0x99, 0x6A, 0x30, 0x0A, 0xDB, 0x5D, 0xF9, 0x4A, 0x0F, 0xF6, 0x72,
+    0x04, 0xF7, 0x78, 0x04, 0x5F, 0x4C, 0x70, 0xC9, 0x24, 0x98, 0xFF, 0xD5, 0x0C, 0xD2, 0x42, 0x2E,
+    0x09, 0x13, 0x51, 0x5D, 0x0C, 0x34, 0xC1, 0xF6, 0xF8, 0xBE, 0x4B, 0xB9, 0x92, 0x66, 0xA3, 0x04,
+    0x7F, 0x00, 0x18, 0x01, 0xF6, 0xF1, 0x1A, 0x6C, 0xD1, 0x82, 0xFD, 0x76, 0x0D, 0xC5, 0x02, 0x70,
+    0xF0, 0xC9, 0x5E, 0x7C, 0xB3, 0xD9, 0x9C, 0x03, 0x2F, 0x29, 0x70, 0x5C, 0x52, 0x04, 0xAF, 0xBD,
+    0x04, 0xBE, 0x09, 0x0E, 0xAA, 0xCB, 0x31, 0x07, 0x7B, 0x98, 0x80, 0x72, 0x10, 0x60, 0xA2, 0xD7,
+    0x48, 0x3E, 0x5A, 0x25, 0x98, 0xFF, 0xD5, 0x72, 0x95, 0xD5, 0xA1, 0xD3, 0x48, 0x61, 0x0F, 0x8F,
+    0x8D, 0xA6, 0x77, 0xAD, 0x49, 0xD9, 0x68, 0xFB, 0x4C, 0x57, 0x67, 0x27, 0x23, 0xC9, 0xEA, 0x86,
+    0xA4, 0xB0, 0xF7, 0xF5, 0xEF, 0x81, 0xA4, 0x3E, 0x97, 0x14, 0x51, 0xD6, 0x45, 0x93, 0x68, 0x7A,
+    0x1B, 0xE9, 0x82, 0x0F, 0x08, 0x61, 0xE6, 0x7F, 0xB3, 0x3C, 0x63, 0xDF, 0x96, 0x06, 0xDF, 0xFB,
+    0x7E, 0x2D, 0x4A, 0x26, 0x51, 0x0D, 0x36, 0x22, 0x7C, 0x28, 0x27, 0xF4, 0x7F, 0xAB, 0x75, 0xD2,
+    0x88, 0x74, 0x67, 0x77, 0x87, 0xF6, 0x32, 0x30, 0xF3, 0x29, 0x68, 0x14, 0x30, 0xDF, 0x1E, 0x61,
+    0x9D, 0xC1, 0x80, 0xE3, 0x77, 0x6B, 0x4A, 0xA9, 0x36, 0xD2, 0x8C, 0xDA, 0x26, 0xBA, 0x1E, 0x3D,
+    0x9D, 0x28, 0x53, 0xD3, 0xE2, 0x7F, 0x32, 0x62, 0x66, 0xD5, 0xF8, 0x57, 0x8E, 0x0E, 0x26, 0x4C,
+    0xEA, 0x02, 0xFE, 0x56, 0xA2, 0x1C, 0x7D, 0xCC, 0x94, 0xE9, 0x2F, 0xBB, 0x50, 0x48, 0x91, 0x52,
+    0xD3, 0xEA, 0xE3, 0x8F, 0x71, 0xE2, 0x07, 0xE6, 0xE5, 0xC9, 0x3F, 0xFD, 0xCE, 0x64, 0xD4, 0x16,
+    0x09, 0x3F, 0x99, 0x77, 0x26, 0xFF, 0xF4, 0x34, 0x99, 0xBE, 0xDD, 0x83, 0xAC, 0xBB, 0xF2, 0x79,
+    0x9C, 0xE6, 0x6B, 0x48, 0x8A, 0x66, 0xC9, 0xD4, 0x97, 0x23, 0x7E, 0xB0, 0x91, 0x2E, 0x56, 0x43,
+    0xAE, 0xD1, 0xF5, 0xE5, 0x0B, 0xA3, 0xEF, 0x9D, 0x1D, 0x7D, 0x7F, 0xCD, 0x8E, 0xFE, 0xA5, 0x68,
+    0x47, 0xFF, 0x46, 0xB0, 0xD1, 0x09, 0x1B, 0xAB, 0x84, 0xEB, 0x6D, 0xC2, 0x07, 0xAB, 0x3F, 0x13,
+    0x4E, 0x4A, 0x5C, 0x70, 0x1A, 0x38, 0x91, 0x9D, 0x3B, 0xEA, 0x96, 0x7F, 0x0C, 0xF8, 0x16, 0xAA,
+    0x11, 0x8A, 0x19, 0xF8, 0x47, 0x6B, 0x79, 0xB6, 0x39, 0xD8, 0x3F, 0xD7, 0xE9, 0x5B, 0xFA, 0x6B,
+    0x0D, 0x6E, 0x2A, 0x13, 0x0B, 0xBE, 0xAF, 0x42, 0x26, 0x33, 0x62, 0xC7, 0x4B, 0xE0, 0x5F, 0x08,
+    0xE4, 0xCB, 0x04, 0x56, 0x40, 0xD3, 0x83, 0x49, 0xDB, 0x69, 0xF8, 0xDE, 0xC1, 0x0C, 0x46, 0x0B,
+    0x34, 0x1A, 0xD8, 0xDF, 0xD4, 0x78, 0xF5, 0x3C, 0xB4, 0xAC, 0x9F, 0x30, 0x5A, 0x6A, 0x23, 0x45,
+    0x93, 0xAA, 0x64, 0x92, 0x49, 0x26, 0xE5, 0xF3, 0xBA, 0x99, 0x64, 0x52, 0x31, 0x99, 0xB9, 0x8B,
+    0x46, 0x6A, 0xCD, 0xF2, 0x27, 0x98, 0x04, 0x95, 0xC2, 0x3A, 0xB2, 0xB2, 0x3F, 0x04, 0xA7, 0x9E,
+    0x4E, 0x31, 0x9F, 0xCB, 0xD1, 0x4C, 0x66, 0x2C, 0x46, 0x33, 0x96, 0xB1, 0x88, 0x65, 0x74, 0x6D,
+    0x19, 0xAF, 0x53, 0xC6, 0x44, 0x19, 0x17, 0xCA, 0xA8, 0x50, 0xC6, 0x26, 0x96, 0xB1, 0x4A, 0x65,
+    0x34, 0x4B, 0x19, 0x51, 0x79, 0x3B, 0x2C, 0xE5, 0xCF, 0x87, 0xB9, 0xF9, 0xB9, 0x52, 0x77, 0x5B,
+    0x03, 0xEC, 0x93, 0xB7, 0x35, 0x7A, 0x9C, 0x4A, 0x91, 0x57, 0x67, 0xC8, 0xD6, 0x36, 0xD8, 0x87,
+    0x66, 0xC1, 0x69, 0x2C, 0xC6, 0x26, 0x34, 0x26, 0x71, 0xE0, 0x03, 0x9F, 0x49, 0x74, 0x0A, 0xFE,
+    0x9D, 0x54, 0x46, 0x1F, 0x64, 0x92, 0x7D, 0xBB, 0xEB, 0x3B, 0xE9, 0xA6, 0x2E, 0x8F, 0x59, 0x7D,
+    0x12, 0xAE, 0x83, 0x9F, 0x28, 0x9E, 0x0E, 0x7C, 0xF3, 0x14, 0xC5, 0xAD, 0x80, 0x8B, 0x70, 0x12,
+    0xB2, 0x03, 0x0A, 0x0D, 0xB9, 0x54, 0x37, 0x8F, 0xA5, 0x22, 0xFA, 0xB0, 0x67, 0x12, 0x59, 0x13,
+    0x4A, 0x25, 0xA3, 0x2E, 0x74, 0x26, 0xD9, 0xE8, 0x83, 0xBE, 0x3A, 0x97, 0x52, 0x72, 0x93, 0xEA,
+    0x93, 0x59, 0xCD, 0x3E, 0x27, 0xA9, 0x54, 0x29, 0x97, 0xA4, 0xEA, 0x45, 0x3D, 0x35, 0x37, 0x26,
+    0x99, 0xE9, 0x9C, 0x1D, 0xAA, 0x98, 0x75, 0xD2, 0x4D, 0x49, 0xDF, 0xF3, 0x7F, 0x3D, 0x91, 0xA7,
+    0x32, 0x62, 0x63, 0x35, 0xE0, 0x7F, 0xA4, 0x3B, 0xFF, 0xA1, 0x93, 0x34, 0x76, 0x93, 0x53, 0x7D,
+    0x92, 0xBD, 0xAD, 0x67, 0xFD, 0xDA, 0x1F, 0x53, 0x28, 0x50, 0x4D, 0xE0, 0x47, 0xCC, 0x4F, 0xE2,
+    0x8A, 0x97, 0x6C, 0x4F, 0xA7, 0x50, 0x49, 0xB5, 0x1E, 0x5B, 0x8A, 0xB1, 0x4C, 0x3E, 0xD8, 0x28,
+    0xFC, 0x61, 0x42, 0x36, 0x9A, 0xE4, 0x83, 0x8D, 0x5D, 0xDB, 0x3C, 0xA2, 0x6F, 0xA5, 0x5C, 0x0A,
+    0x99, 0x26, 0xD8, 0x07, 0x1E, 0x3E, 0x86, 0x49, 0xDF, 0xC4, 0x69, 0xE0, 0x1B, 0x1D, 0x70, 0x62,
+    0xBD, 0xCA, 0x06, 0x9C, 0x5A, 0x23, 0x05, 0xFF, 0xA2, 0x1E, 0x99, 0xB3, 0xA3, 0xEF, 0xB8, 0xFF,
+    0x2B, 0x87, 0x6A, 0x68, 0x5E, 0x15, 0x9D, 0x22, 0xDD, 0xC2, 0xCE, 0xC2, 0xEB, 0xB0, 0xC0, 0x0C,
+    0x27, 0xB6, 0x00, 0xE7, 0xEB, 0x57, 0xBF, 0x0B, 0x70, 0xED, 0x5E, 0x39, 0x7B, 0x07, 0xE4, 0xBA,
+    0x1B, 0xBC, 0x64, 0x52, 0x35, 0x56, 0xBD, 0x8B, 0xCA, 0x75, 0x98, 0x9C, 0xEC, 0x5B, 0x6F, 0x25,
+    0xFF, 0xA6, 0x8D, 0x8A, 0xFE, 0xA6, 0x58, 0x8A, 0xD9, 0x46, 0x27, 0xF1, 0x0B, 0x0D, 0x70, 0x0E,
+    0xE0, 0x6B, 0xC0, 0x19, 0xC0, 0xB5, 0x60, 0x03, 0x94, 0x81, 0x9D, 0xAF, 0x07, 0xA0, 0x91, 0x55,
+    0xA5, 0xA7, 0xD4, 0xAA, 0x76, 0x6D, 0x35, 0xD8, 0x60, 0x52, 0x31, 0xD0, 0x9D, 0x1D, 0xB1, 0x43,
+    0x22, 0x4F, 0xD7, 0xC1, 0x37, 0x60, 0x55, 0x93, 0x29, 0x80, 0x1F, 0x56, 0xD4, 0x9B, 0x4D, 0x40,
+    0x82, 0x7C, 0x81, 0x6E, 0x01, 0xB7, 0x40, 0x3E, 0x01, 0x9C, 0x20, 0xEB, 0x02, 0x56, 0x50, 0x24,
+    0xD8, 0x62, 0x67, 0xBA, 0xAC, 0xCE, 0x67, 0x0D, 0xA5, 0x34, 0xB8, 0xBB, 0x0A, 0x5D, 0xAD, 0x47,
+    0x53, 0xBE, 0x94, 0xB1, 0x98, 0x5C, 0xA8, 0x86, 0x8E, 0xE6, 0xA9, 0x94, 0xCD, 0x65, 0xB4, 0xD1,
+    0xFD, 0x65, 0xD7, 0x76, 0x9A, 0x72, 0xA9, 0x2E, 0xDF, 0xAE, 0xD7, 0xFF, 0x05, 0xB3, 0x40, 0xA3,
+    0x3A, 0x5B, 0x9B, 0x06, 0xB8, 0x64, 0x03, 0xEE, 0x56, 0xA4, 0x7C, 0x35, 0xC1, 0xC1, 0xB1, 0xA3,
+    0xFA, 0x64, 0x4A, 0x3E, 0x35, 0x4B, 0xB9, 0x98, 0x99, 0xE7, 0x69, 0x5A, 0x8F, 0x8D, 0x55, 0x9B,
+    0xCF, 0xB6, 0xC7, 0x3F, 0x1D, 0x29, 0xDF, 0x1A, 0x61, 0x4E, 0xE0, 0x67, 0x28, 0x04, 0xA8, 0x85,
+    0x2A, 0x40, 0x31, 0x80, 0x89, 0x50, 0x4E, 0xE4, 0x9A, 0xA0, 0x9B, 0xA0, 0x1C, 0x00, 0xF6, 0x36,
+    0xF5, 0x3A, 0xF2, 0xF0, 0x0A, 0xEF, 0x42, 0x0C, 0x9F, 0xD4, 0xFC, 0x62, 0x15, 0x33, 0x89, 0xBD,
+    0xCD, 0xC1, 0x47, 0x1F, 0x90, 0x0F, 0x50, 0xC3, 0x99, 0xAC, 0x07, 0xA7, 0xB0, 0xDE, 0x40, 0xB2,
+    0x67, 0xFE, 0x1E, 0xE6, 0x65, 0x88, 0x05, 0xD5, 0x7F, 0x1D, 0xE8, 0x12, 0xD9, 0x7F, 0xFA, 0x0D,
+    0x5C, 0xCA, 0x27, 0x69, 0xA3, 0xAB, 0xD7, 0x11, 0x06, 0x09, 0x40, 0x57, 0x80, 0xAE, 0x07, 0xF6,
+    0x3E, 0x8A, 0xB1, 0x17, 0xC0, 0xD6, 0x64, 0x23, 0x54, 0x7F, 0x03, 0x5D, 0xD8, 0xC2, 0x0F, 0x78,
+    0x78, 0x1D, 0x2C, 0x5D, 0xA0, 0x9C, 0xE0, 0xB7, 0xB6, 0x5D, 0xB4, 0xBB, 0x42, 0xA7, 0x68, 0xA5,
+    0xA0, 0xDA, 0x97, 0x23, 0xC9, 0x87, 0xFC, 0xD5, 0x19, 0xCA, 0x71, 0x9D, 0x3F, 0xB4, 0x4E, 0x21,
+    0x76, 0x02, 0x17, 0xD7, 0x49, 0x46, 0x03, 0xFF, 0x42, 0xD2, 0x23, 0x52, 0xA2, 0x53, 0xBB, 0xFA,
+    0x8E, 0x16, 0xAE, 0x41, 0x03, 0xBE, 0xC6, 0xD6, 0xE4, 0xF5, 0xAE, 0xAD, 0xBB, 0x84, 0xD4, 0xEA,
+    0xF1, 0xD8, 0x3C, 0x92, 0x7C, 0xF8, 0xB2, 0x8D, 0x98, 0x04, 0x02, 0xDF, 0x53, 0x26, 0x32, 0xBD,
+    0xFE, 0x9C, 0x53, 0xCA, 0x34, 0x93, 0x6D, 0x0D, 0xB5, 0x3D, 0x74, 0x3D, 0xE5, 0x2B, 0x3D, 0xD7,
+    0x6D, 0xC8, 0xFA, 0x4F, 0x7D, 0xBC, 0x96, 0x42, 0x11, 0x31, 0x0B, 0xF9, 0x2F, 0xFA, 0x6C, 0xBC,
+    0xC6, 0xF7, 0xCB, 0x8F, 0x66, 0x69, 0x76, 0x05, 0xAA, 0x1E, 0xBA, 0x96, 0x6C, 0x5E, 0x61, 0x2B,
+    0xC0, 0xF9, 0x9F, 0xE1, 0x94, 0x8C, 0x14, 0x7D, 0x6F, 0x6F, 0xCE, 0x78, 0x1B, 0xF9, 0x41, 0x53,
+    0x93, 0xCF, 0xAB, 0xAF, 0xF7, 0x01, 0x54, 0x63, 0x16, 0x28, 0xD3, 0x3A, 0xE7, 0xFB, 0x89, 0x93,
+    0x8D, 0xD4, 0x37, 0x12, 0x4E, 0x03, 0xD9, 0x01, 0xEC, 0x41, 0xB9, 0x5E, 0xBF, 0x83, 0x2D, 0x82,
+    0x3D, 0x47, 0xAE, 0x68, 0xB4, 0x98, 0xD9, 0xDF, 0x98, 0x8B, 0x28, 0x06, 0x1F, 0xD8, 0x59, 0x59,
+    0xE3, 0x22, 0x85, 0xAE, 0x86, 0x4E, 0xB1, 0xD0, 0xB8, 0xAB, 0xAA, 0x09, 0x15, 0xF6, 0xE6, 0x48,
+    0xF5, 0x66, 0x4D, 0x35, 0x81, 0x6D, 0x3F, 0xD6, 0xC6, 0xAC, 0x4F, 0x32, 0x3A, 0x7C, 0x55, 0x1B,
+    0xB5, 0xF8, 0x40, 0xDE, 0x7E, 0xF4, 0xDB, 0x9E, 0x87, 0x0A, 0xCA, 0x1B, 0x13, 0xD8, 0x37, 0x5B,
+    0xB0, 0x89, 0x75, 0x96, 0x00, 0xC8, 0xFE, 0xF5, 0xD5, 0x1A, 0x2F, 0x8D, 0x74, 0x52, 0xC2, 0x87,
+    0xF3, 0x09, 0x51, 0x8D, 0x26, 0xE1, 0xA2, 0x8D, 0xF8, 0xE0, 0x03, 0xAA, 0x85, 0x99, 0x4D, 0xC2,
+    0x8E, 0x47, 0x45, 0x88, 0x62, 0x32, 0x09, 0x1F, 0x6C, 0xCC, 0x17, 0xFC, 0x5F, 0x75, 0x43, 0x29,
+    0xCD, 0x78, 0x2D, 0xF7, 0xA2, 0x9D, 0xBA, 0xE6, 0xA1, 0xD9, 0x61, 0xF4, 0x52, 0xA4, 0x98, 0xCF,
+    0x80, 0x7B, 0x39, 0x90, 0xCF, 0x5F, 0x66, 0xEF, 0xFC, 0x8B, 0x94, 0x9A, 0x31, 0x52, 0x8F, 0x1E,
+    0x9D, 0xA9, 0x7A, 0xD7, 0x9B, 0x94, 0xCF, 0xF8, 0xF0, 0x4B, 0x07, 0x83, 0xEB, 0x73, 0x3D, 0x3B,
+    0x63, 0xA5, 0x19, 0x3F, 0xA9, 0xE7, 0x64, 0x06, 0x9F, 0x24, 0x5A, 0x86, 0x9A, 0xAC, 0xEB, 0x31,
+    0xEA, 0xE1, 0x7C, 0xCF, 0xF1, 0xEE, 0x6F, 0xB1, 0x5A, 0xC0, 0xF5, 0xFC, 0xD3, 0xAE, 0xCF, 0xA5,
+    0xBE, 0x94, 0xFA, 0x6A, 0x70, 0xBD, 0x0B, 0xAE, 0xF7, 0xEF, 0xDD, 0x06, 0xD7, 0xBB, 0xBB, 0xEA,
+    0xAD, 0x34, 0x1B, 0x5D, 0x9E, 0x39, 0x99, 0xC1, 0x66, 0x03, 0xD2, 0xBA, 0x6D, 0x1F, 0xFB, 0x9B,
+    0xCD, 0x39, 0x2F, 0x25, 0x27, 0x25, 0x33, 0x67, 0xC9, 0x24, 0x2E, 0x98, 0xC4, 0x97, 0x4C, 0xDA,
+    0xA1, 0x48, 0x05, 0x23, 0x05, 0xB3, 0x5C, 0xAD, 0xB7, 0x65, 0x27, 0x4C, 0xE2, 0x94, 0x49, 0x5C,
+    0x33, 0xCB, 0xD5, 0xE4, 0xA4, 0xE4, 0xA5, 0x29, 0xD7, 0x8C, 0x54, 0xEF, 0x6F, 0x6A, 0x80, 0xBD,
+    0x1A, 0xB7, 0xE0, 0x15, 0xFD, 0x53, 0x73, 0x15, 0xFC, 0xE5, 0xC1, 0xBE, 0x26, 0x4D, 0xD2, 0xE2,
+    0x5B, 0x6C, 0xC4, 0xCC, 0xD0, 0xFC, 0xED, 0xFF, 0x6E, 0xA5, 0xBA, 0x53, 0xCD, 0x39, 0x38, 0x91,
+    0xC1, 0x58, 0xD6, 0x48, 0xEB, 0x8C, 0x79, 0xFC, 0xCA, 0xC7, 0x6A, 0x1D, 0xC0, 0xF7, 0x4D, 0xED,
+    0xFF, 0x3C, 0x14, 0xEA, 0x71, 0xED, 0xD1, 0x90, 0x1B, 0x8C, 0x64, 0x26, 0xF7, 0x62, 0x32, 0xD3,
+    0xC2, 0xE2, 0xA5, 0xCB, 0xD2, 0x6B, 0xD3, 0xAE, 0x2F, 0x17, 0xCB, 0x9F, 0xF5, 0xD2, 0x58, 0x6E,
+    0x87, 0x5C, 0xD6, 0xAE, 0x30, 0xC3, 0xC6, 0xF5, 0x75, 0xEB, 0x16, 0x3E, 0x36, 0x23, 0xDF, 0xE5,
+    0x17, 0x32, 0x3E, 0x92, 0x91, 0x1F, 0x5F, 0x8B, 0xD9, 0x7A, 0x05, 0x74, 0x97, 0x80, 0x66, 0x00,
+    0x1F, 0x61, 0xAF, 0xFE, 0x90, 0xB7, 0xF6, 0x89, 0x9A, 0xB2, 0xC5, 0x0C, 0xB0, 0xB4, 0x54, 0x71,
+    0x37, 0x5F, 0x0D, 0x65, 0x9D, 0x4D, 0x1E, 0x9E, 0xBF, 0xB6, 0xBA, 0xA0, 0xA2, 0xFF, 0x78, 0x5B,
+    0x72, 0x75, 0x5D, 0xEE, 0x9E, 0xEB, 0xBA, 0x72, 0xE4, 0xBA, 0x26, 0xA4, 0xB0, 0x94, 0x63, 0xC3,
+    0xE2, 0x5B, 0x7F, 0x59, 0x7A, 0x4D, 0x9A, 0x16, 0xF0, 0x01, 0x3B, 0x92, 0xE9, 0xDF, 0x7F, 0xDF,
+    0x6B, 0xCE, 0xEF, 0x73, 0x5D, 0x78, 0xD6, 0xCA, 0xFB, 0x06, 0xBC, 0x19, 0x78, 0x90, 0xCF, 0x6F,
+    0xA1, 0xCD, 0x52, 0xD3, 0x29, 0x21, 0xA9, 0x56, 0x6F, 0xFB, 0xAE, 0xCD, 0x47, 0x1F, 0xB8, 0x50,
+    0x0D, 0xAB, 0xAF, 0x35, 0x09, 0x10, 0x7B, 0x1B, 0x1F, 0xAC, 0x5E, 0x19, 0x33, 0xBD, 0xB5, 0x60,
+    0x52, 0xD3, 0x23, 0x3B, 0xE3, 0x6F, 0xE8, 0x6E, 0x17, 0xAB, 0xD5, 0xE1, 0xFE, 0x0C, 0x36, 0x3B,
+    0x9C, 0xBC, 0x26, 0x1B, 0xDC, 0x25, 0xB2, 0xF1, 0x02, 0x65, 0xFD, 0xDC, 0xEA, 0x23, 0x0F, 0x4E,
+    0x66, 0x52, 0xAA, 0xA4, 0x61, 0x29, 0x6E, 0x9B, 0xD1, 0xF6, 0x36, 0xF8, 0xD6, 0xD7, 0x33, 0xDD,
+    0xB3, 0x11, 0x89, 0xE2, 0xF5, 0x2B, 0x78, 0x60, 0xDE, 0x1C, 0x18, 0x69, 0x2C, 0xA5, 0xD8, 0x5D,
+    0xED, 0x6E, 0x8D, 0x74, 0x55, 0x5F, 0x4C, 0xFE, 0xAE, 0x42, 0xA7, 0x09, 0x77, 0x07, 0x38, 0x46,
+    0x8D, 0xAD, 0xBF, 0x8F, 0xD1, 0x16, 0x9E, 0x1E, 0xA1, 0xB5, 0x7F, 0x73, 0x87, 0x5C, 0x8A, 0x46,
+    0x9A, 0x8D, 0x6A, 0xFF, 0xE8, 0x42, 0xD9, 0x8B, 0x2C, 0x36, 0x2D, 0xB8, 0x7E, 0xED, 0xF8, 0x26,
+    0xB1, 0x7F, 0x4E, 0x78, 0x35, 0x7D, 0xA1, 0x1F, 0x4E, 0xD8, 0xDB, 0xAA, 0x4D, 0xF2, 0x23, 0x2A,
+    0xF4, 0xBA, 0x42, 0x23, 0xC5, 0x5C, 0xBA, 0xC2, 0x2E, 0x06, 0xB6, 0xF5, 0xEF, 0xE3, 0xFF, 0x3C,
+    0xD0, 0xCC, 0xEC, 0x06, 0x1E, 0xE7, 0xF6, 0x68, 0xA4, 0x42, 0x9A, 0xFC, 0x93, 0xA9, 0x9E, 0xCD,
+    0x68, 0xA2, 0x1D, 0x6C, 0xEF, 0x6B, 0xF7, 0x46, 0xC2, 0x2B, 0x64, 0x77, 0x9F, 0xC1, 0x06, 0xF0,
+    0x9B, 0x73, 0x48, 0x73, 0x2E, 0x25, 0xF7, 0xFA, 0xB3, 0xB7, 0x67, 0xDC, 0xAD, 0x31, 0x5B, 0xEC,
+    0xD2, 0x45, 0xA7, 0x85, 0x72, 0xA9, 0xB7, 0x71, 0x47, 0xB7, 0x8D, 0x87, 0xCB, 0xC8, 0x11, 0x22,
+    0xFA, 0xF8, 0x2B, 0xB3, 0xB7, 0x5E, 0xC9, 0x6C, 0x83, 0x8D, 0x5D, 0xEA, 0xE9, 0x63, 0xAC, 0xCC,
+    0xF1, 0xEE, 0x0A, 0x4E, 0xC2, 0x4B, 0xBD, 0x1F, 0xCD, 0xE8, 0x06, 0xAE, 0xDB, 0x48, 0x55, 0x4C,
+    0x90, 0xCF, 0xEC, 0x12, 0xF1, 0xD9, 0xE6, 0xF1, 0x68, 0xF4, 0x8B, 0x99, 0x26, 0x75, 0x2D, 0xAA,
+    0x46, 0xFC, 0xA1, 0x6A, 0x1B, 0x9B, 0xE5, 0xD9, 0x54, 0x48, 0xC2, 0xE9, 0x0E, 0xEC, 0xD7, 0x90,
+    0x7D, 0x07, 0x58, 0xB6, 0x51, 0x59, 0xD9, 0xAF, 0xC1, 0x07, 0x07, 0xAC, 0xEE, 0xA5, 0x02, 0xC6,
+    0x35, 0x52, 0xF3, 0xDB, 0x20, 0x6B, 0x5A, 0xDF, 0xD9, 0xAB, 0x0F, 0x0A, 0x29, 0x36, 0xD2, 0xD3,
+    0x53, 0xF5, 0x9F, 0x6D, 0xEF, 0x6B, 0xCF, 0xC2, 0x6C, 0xC6, 0x7C, 0xE9, 0x82, 0x51, 0xA2, 0xBA,
+    0x5A, 0x93, 0xC0, 0xBC, 0xBD, 0xA9, 0xAD, 0xD4, 0x3B, 0xE9, 0xE6, 0x72, 0x55, 0x55, 0x9F, 0xA7,
+    0xA6, 0xAE, 0x06, 0xBD, 0xA1, 0x5C, 0x1A, 0xE8, 0x7E, 0xB6, 0x9B, 0x66, 0xCA, 0x81, 0x6D, 0xC2,
+    0xAC, 0x78, 0x63, 0x80, 0x62, 0xB8, 0x06, 0xD9, 0xF0, 0xE0, 0xF6, 0xDD, 0xCD, 0x26, 0xDB, 0x9C,
+    0xF3, 0xEA, 0xA5, 0x6F, 0x6B, 0x70, 0x6A, 0x7D, 0xA0, 0xAB, 0x6D, 0xC4, 0xF5, 0x26, 0x51, 0x8E,
+    0x88, 0x7C, 0x66, 0x2D, 0x94, 0xD4, 0x1B, 0x49, 0x23, 0xBA, 0xFA, 0x17, 0xBB, 0xC2, 0xF7, 0x7E,
+    0xB2, 0x47, 0x6D, 0xA7, 0x47, 0xB5, 0x78, 0xF5, 0xD2, 0xDA, 0xE9, 0xAA, 0x1E, 0x8C, 0xEA, 0x35,
+    0x28, 0x73, 0x66, 0x20, 0x6B, 0x1F, 0x58, 0x53, 0xA1, 0x59, 0xD7, 0xAF, 0xE3, 0x80, 0xA6, 0xDF,
+    0xB6, 0xB3, 0xEB, 0x21, 0x4F, 0x7B, 0x35, 0xEE, 0x27, 0x22, 0x97, 0x12, 0x6E, 0x51, 0xC8, 0x97,
+    0x7C, 0xC6, 0xF5, 0x55, 0x9F, 0xCF, 0xD9, 0xAF, 0x3A, 0x28, 0xF5, 0x98, 0x6E, 0x68, 0x52, 0xDA,
+    0xDF, 0xD4, 0x9B, 0x8D, 0xD5, 0xE8, 0xF5, 0x53, 0x8D, 0xA5, 0x06, 0x1B, 0x71, 0xFD, 0x67, 0x96,
+    0xCD, 0x13, 0x77, 0x9E, 0x90, 0xA4, 0xE8, 0xFB, 0x23, 0xCB, 0xD7, 0xEA, 0x48, 0x33, 0xFE, 0xF5,
+    0xAB, 0xFA, 0x15, 0x15, 0x1F, 0xF1, 0x83, 0x53, 0xDF, 0xE9, 0xB2, 0x46, 0xAF, 0x81, 0x13, 0xF0,
+    0xD0, 0xBC, 0x0D, 0xB7, 0x5C, 0x0F, 0xE7, 0xEF, 0xB6, 0x38, 0x8D, 0xEB, 0x60, 0x70, 0x37, 0xFE,
+    0x13, 0xE5, 0x3B, 0xEA, 0x73, 0x29, 0xD1, 0xBD, 0xA8, 0xDA, 0xF5, 0xAE, 0x2F, 0xC7, 0x62, 0xCC,
+    0xE7, 0x6C, 0xA6, 0xAB, 0x9B, 0xDA, 0xF5, 0xD5, 0x51, 0x81, 0xD1, 0x8B, 0xBA, 0xAD, 0x49, 0xE9,
+    0x78, 0xFD, 0xE8, 0xF2, 0x05, 0xAF, 0x97, 0x6F, 0xA5, 0x63, 0x7B, 0xC0, 0xFE, 0xE6, 0xAC, 0x66,
+    0xA7, 0xD6, 0x07, 0x93, 0xF8, 0xD5, 0xBB, 0xDE, 0xE9, 0x65, 0xCD, 0x0F, 0x66, 0xF6, 0xF6, 0x1B,
+    0xBA, 0xF3, 0x52, 0x62, 0x8D, 0x91, 0xBB, 0xA1, 0x99, 0xF2, 0x85, 0xA6, 0xAD, 0x86, 0x62, 0xCA,
+    0xEE, 0x1D, 0xE4, 0x1A, 0x35, 0xEF, 0x6D, 0xCE, 0x6A, 0xDE, 0x06, 0xB9, 0xD9, 0xE6, 0x9C, 0xD7,
+    0x4B, 0x9A, 0x3E, 0xF0, 0x1A, 0xC1, 0xCC, 0xB9, 0x66, 0xAF, 0x7E, 0xC7, 0xA6, 0x00, 0xE5, 0x52,
+    0xA8, 0x75, 0xEF, 0xFE, 0x76, 0x9A, 0xB6, 0x1A, 0x9C, 0x1E, 0x57, 0xFF, 0x00, 0x67, 0x87, 0xDF,
+    0xF1, 0x0A, 0x1A, 0xB3, 0x67, 0x3E, 0x6C, 0x5D, 0xE0, 0x77, 0xF9, 0x8B, 0xB7, 0x47, 0x4D, 0xC7,
+    0x7F, 0xF6, 0xEB, 0xEB, 0xF2, 0xA1, 0xBE, 0x39, 0x1F, 0x48, 0xD8, 0x80, 0xAE, 0x94, 0x33, 0x7B,
+    0x50, 0xD3, 0xD4, 0x65, 0xA2, 0x6B, 0xB3, 0x75, 0x86, 0xCA, 0xD5, 0x36, 0x13, 0x5D, 0x5B, 0x4C,
+    0x34, 0xEF, 0xDD, 0x39, 0x9D, 0xD5, 0xC8, 0x19, 0x6C, 0x9B, 0x8D, 0x54, 0x7F, 0x43, 0x17, 0x38,
+    0xE0, 0x0F, 0x70, 0xC1, 0xCC, 0xB8, 0xC0, 0xC1, 0x87, 0xAF, 0xE5, 0x07, 0xB7, 0xE0, 0xFE, 0xE6,
+    0x91, 0xCD, 0xC6, 0xEB, 0x65, 0xC9, 0xE9, 0x29, 0xDD, 0x31, 0x09, 0x37, 0x7C, 0xB4, 0x5D, 0x6F,
+    0x66, 0x5C, 0xEF, 0xD4, 0xBB, 0xDE, 0xAB, 0x77, 0x61, 0xEB, 0xAE, 0xE9, 0xDA, 0x6D, 0x66, 0xBD,
+    0x4A, 0x80, 0x1D, 0x8E, 0x80, 0xEF, 0x89, 0x62, 0xCC, 0x53, 0x99, 0xCC, 0x5C, 0x4E, 0x26, 0x65,
+    0x57, 0xD8, 0x4D, 0x50, 0xC7, 0xDC, 0x54, 0xA5, 0x66, 0xF2, 0xA9, 0x9C, 0x8A, 0x54, 0x4C, 0xE6,
+    0x03, 0x37, 0xA7, 0xB3, 0xC9, 0xEB, 0xEC, 0x0E, 0x3B, 0x4C, 0x5B, 0xFE, 0x72, 0x20, 0x53, 0x0B,
+    0x6B, 0xC2, 0xA0, 0x0A, 0xF8, 0xC8, 0x9C, 0x4C, 0xBC, 0x94, 0xB7, 0x9F, 0x5D, 0x7B, 0x63, 0xA1,
+    0xD9, 0x68, 0xC2, 0x87, 0xBF, 0xF3, 0xB3, 0xA5, 0x6B, 0x11, 0xC5, 0x82, 0x9F, 0xA8, 0xFA, 0x9D,
+    0xD3, 0x4B, 0xD8, 0xC4, 0xC5, 0xC9, 0xBC, 0x18, 0x7F, 0x37, 0x0F, 0x00, 0x75, 0x21, 0x7C, 0xA2,
+    0x8A, 0xB8, 0x40, 0x47, 0x9E, 0x28, 0x7F, 0xF9, 0xD0, 0x24, 0xEC, 0x80, 0xEA, 0x6A, 0xCA, 0x14,
+    0xF2, 0x9F, 0xC1, 0xFE, 0xA6, 0xDE, 0x1C, 0x48, 0x56, 0x2F, 0x69, 0xB4, 0x33, 0xA2, 0x69, 0x4D,
+    0x2A, 0x26, 0x6C, 0x6C, 0x5A, 0xFC, 0xE1, 0x08, 0x6A, 0x6A, 0x8C, 0x26, 0xB0, 0x1A, 0xC1, 0xBF,
+    0x12, 0x41, 0x2E, 0x62, 0x92, 0x8F, 0xD8, 0xE8, 0x23, 0x3E, 0x34, 0x11, 0xD5, 0xCD, 0xE8, 0x14,
+    0x9A, 0x49, 0xA2, 0xE9, 0xD7, 0xEC, 0xFB, 0x83, 0xF5, 0x0A, 0x39, 0x60, 0x66, 0x4D, 0x4B, 0xAD,
+    0x7C, 0xD1, 0xC1, 0x9A, 0x71, 0x3C, 0x1F, 0x41, 0x11, 0xAA, 0x2D, 0xE2, 0xBD, 0xB7, 0x69, 0x2A,
+    0x63, 0x33, 0x96, 0xD1, 0xB7, 0x65, 0x5C, 0x28, 0xDF, 0x9A, 0x28, 0x15, 0x29, 0xDF, 0x99, 0x28,
+    0xDF, 0x9A, 0x29, 0xA3, 0x28, 0x63, 0x13, 0xCA, 0xE8, 0xA2, 0x9B, 0x6D, 0x6A, 0x16, 0x33, 0x03,
+    0x07, 0x64, 0x57, 0xC0, 0x8C, 0xEB, 0x44, 0x93, 0x6F, 0x81, 0xDF, 0x16, 0xE9, 0x96, 0x8B, 0x53,
+    0xA1, 0x6F, 0xA9, 0x75, 0x43, 0x47, 0x31, 0x35, 0x64, 0x4B, 0x03, 0x8D, 0x6A, 0x2A, 0x45, 0x8A,
+    0xB7, 0x17, 0xB2, 0xD9, 0xF7, 0x34, 0x67, 0x13, 0x55, 0xDF, 0x05, 0xB7, 0xD8, 0xD9, 0x2A, 0x74,
+    0xED, 0xD1, 0x17, 0x14, 0xF5, 0x9A, 0x01, 0x54, 0xC0, 0x2C, 0xEC, 0xB2, 0x14, 0x47, 0x79, 0x71,
+    0xA7, 0x96, 0x23, 0x20, 0xF9, 0xC1, 0xDB, 0x29, 0x93, 0xB8, 0x68, 0x12, 0xD7, 0xDF, 0x05, 0x2A,
+    0x8F, 0x51, 0xB5, 0x6E, 0x68, 0xE2, 0x17, 0x6B, 0x20, 0xCB, 0xBA, 0x5E, 0x63, 0x31, 0xD3, 0xD5,
+    0xAE, 0x2F, 0xC7, 0xFC, 0x57, 0x1D, 0x34, 0x72, 0x0A, 0x1F, 0x9B, 0x09, 0x00, 0xC7, 0xDB, 0x75,
+    0xA8, 0x94, 0xC3, 0x3A, 0xA5, 0x57, 0xED, 0x8A, 0x45, 0x4E, 0x3C, 0x34, 0x5B, 0xD5, 0xCD, 0x07,
+    0x19, 0x53, 0x8E, 0xF9, 0x5C, 0xE8, 0x2D, 0x25, 0xE0, 0x19, 0x1A, 0x6C, 0x6F, 0x62, 0x36, 0x1E,
+    0x21, 0xA6, 0x7C, 0xD8, 0xDF, 0x9C, 0x8D, 0x5E, 0x2F, 0x0F, 0x4E, 0x4F, 0x07, 0x93, 0x4C, 0x6B,
+    0x52, 0xF6, 0xD1, 0x0C, 0x3D, 0xF1, 0x0F, 0xBA, 0x97, 0xA4, 0xAF, 0xDC, 0x9A, 0xCF, 0x94, 0x63,
+    0x74, 0x2F, 0x87, 0xEE, 0x7F, 0xCE, 0x67, 0xCA, 0x11, 0xD7, 0xD3, 0xD5, 0xEF, 0x73, 0x58, 0x28,
+    0x7E, 0x60, 0x3B, 0x65, 0xA3, 0x49, 0xBB, 0xBF, 0x7C, 0xFC, 0xF5, 0x97, 0xE7, 0xB8, 0x6A, 0x34,
+    0x92, 0xA9, 0xA6, 0x1C, 0xA1, 0x7B, 0xF7, 0xCB, 0xA3, 0x53, 0x39, 0xFA, 0xD0, 0x9D, 0x4D, 0xE5,
+    0xF8, 0xE0, 0x7B, 0xDF, 0xAB, 0x69, 0x44, 0xA9, 0xC8, 0xDE, 0xE6, 0x00, 0xA3, 0x79, 0x4D, 0x3B,
+    0x6F, 0xB1, 0xFC, 0x4E, 0x07, 0xF1, 0xDC, 0x8A, 0x9E, 0x35, 0x42, 0xD7, 0x93, 0x2B, 0xC2, 0x2F,
+    0xD6, 0x4F, 0x58, 0x7C, 0x28, 0x7A, 0x1B, 0xF3, 0xD1, 0x2C, 0x57, 0x53, 0x29, 0xC9, 0x48, 0x6A,
+    0x39, 0x96, 0x75, 0xBD, 0x9F, 0x69, 0xFA, 0x7C, 0xC6, 0xF5, 0xF9, 0x8C, 0xFB, 0xEF, 0xB9, 0x7A,
+    0x37, 0xE6, 0x33, 0x5D, 0xEF, 0xE7, 0xEC, 0xFC, 0xBD, 0x37, 0xFA, 0x4A, 0x37, 0xEF, 0x71, 0xD7,
+    0xCF, 0xB1, 0xC5, 0x70, 0x99, 0xEA, 0xED, 0x6E, 0x47, 0x22, 0xC1, 0xE6, 0x80, 0xCD, 0xB9, 0x66,
+    0xA6, 0x53, 0xA9, 0x50, 0xA9, 0xF6, 0x13, 0x0D, 0x56, 0x75, 0x15, 0x8C, 0x62, 0x11, 0xD1, 0x92,
+    0x25, 0x7C, 0xD3, 0x37, 0xD8, 0x1F, 0xA6, 0x2A, 0x98, 0xA8, 0x5B, 0x91, 0x64, 0xEF, 0x24, 0x7C,
+    0xAE, 0x06, 0x1B, 0xBC, 0x82, 0x89, 0x46, 0x91, 0x44, 0x93, 0x68, 0xB0, 0x42, 0x09, 0x85, 0x46,
+    0x54, 0x91, 0x6D, 0x8C, 0xFB, 0x30, 0x6B, 0x72, 0xA9, 0xEC, 0xD7, 0x34, 0x63, 0x1E, 0x57, 0x8E,
+    0x1E, 0x20, 0xAB, 0xCF, 0xE1, 0xDE, 0x52, 0x5F, 0x49, 0x29, 0xEB, 0xEE, 0xAA, 0xAD, 0x86, 0x6A,
+    0x28, 0x26, 0x33, 0x65, 0x0B, 0x0B, 0x4D, 0xEB, 0xDB, 0x6A, 0xB0, 0xEF, 0x2E, 0xE8, 0x26, 0x3F,
+    0x7B, 0x55, 0xAA, 0xF7, 0xCF, 0xB1, 0xBF, 0xA9, 0x54, 0x3B, 0xDD, 0x54, 0x2C, 0xD4, 0xDB, 0x85,
+    0x2A, 0x18, 0xF5, 0x45, 0x44, 0x29, 0x4B, 0x78, 0xB5, 0x0D, 0xF6, 0x95, 0xB1, 0x0A, 0xE6, 0x2D,
+    0x15, 0x91, 0xE4, 0x6F, 0x27, 0xBC, 0x59, 0x1A, 0x6C, 0xE8, 0x5E, 0x09, 0x26, 0x5A, 0x45, 0x12,
+    0x4A, 0x78, 0x2A, 0x51, 0x05, 0xA3, 0xE0, 0x85, 0x8F, 0x95, 0x42, 0x91, 0x76, 0x7E, 0xEC, 0x19,
+    0xB6, 0x8A, 0x05, 0x6C, 0xBF, 0x73, 0x72, 0xF9, 0x78, 0xC4, 0xDD, 0x1E, 0xEC, 0x53, 0xA6, 0x6E,
+    0x2C, 0x24, 0x71, 0x7E, 0xE9, 0x86, 0x62, 0x2A, 0x3E, 0xC0, 0xF6, 0x6A, 0xB0, 0x83, 0x5B, 0xAC,
+    0x1E, 0xD7, 0x2D, 0xF5, 0x47, 0xE3, 0xD1, 0x8C, 0xDB, 0x40, 0xB9, 0xAA, 0xD7, 0x96, 0xCA, 0x8E,
+    0x12, 0x50, 0x45, 0x7D, 0x0A, 0xF2, 0xF1, 0x0C, 0xE0, 0x9F, 0xDF, 0x31, 0xC9, 0x3B, 0x52, 0xFE,
+    0xEF, 0xE9, 0x06, 0x9E, 0xC8, 0xA0, 0x32, 0x03, 0xE6, 0xA7, 0x11, 0x9A, 0xB8, 0x46, 0xA7, 0x7C,
+    0xF7, 0x37, 0xBF, 0x81, 0xB6, 0x66, 0x1B, 0x7E, 0x6D, 0xF3, 0xDB, 0x26, 0x02, 0xD8, 0xB0, 0x97,
+    0x1D, 0x70, 0xB1, 0x4C, 0x5D, 0x34, 0x43, 0x27, 0xC5, 0x07, 0x39, 0xBF, 0x74, 0x3D, 0x74, 0x6D,
+    0x57, 0x93, 0xCF, 0xD9, 0x02, 0xE5, 0x58, 0x4C, 0xE0, 0xFA, 0x6A, 0x80, 0xAE, 0x6E, 0xDA, 0x5F,
+    0x2E, 0xCE, 0xF5, 0xAA, 0x22, 0x56, 0xDF, 0x56, 0xD8, 0x76, 0x14, 0xDE, 0xD3, 0x51, 0xC2, 0x7B,
+    0x3A, 0x4A, 0xBC, 0xD7, 0x51, 0x5E, 0x4C, 0x78, 0x93, 0xEE, 0x75, 0x94, 0x77, 0xDE, 0xDD, 0x51,
+    0xF2, 0xB5, 0xA3, 0x0C, 0x95, 0x42, 0x31, 0xED, 0xA6, 0xBF, 0x2F, 0x7B, 0xC0, 0xA9, 0x85, 0x52,
+    0x3B, 0x78, 0x72, 0xB0, 0x4F, 0xF7, 0x43, 0x3D, 0x26, 0xE9, 0xB8, 0xDE, 0x58, 0x8A, 0xA9, 0x98,
+    0xAA, 0xC1, 0x0E, 0x4D, 0xEB, 0x9F, 0x5C, 0x58, 0x8A, 0xC9, 0xDC, 0x7F, 0xEA, 0x16, 0x33, 0x29,
+    0xD9, 0x01, 0x9A, 0x9A, 0x3C, 0x41, 0x15, 0xC9, 0x05, 0x7E, 0x84, 0x33, 0xB0, 0xBF, 0x61, 0xF5,
+    0x1A, 0x8D, 0xEE, 0xE3, 0xC5, 0x38, 0xFF, 0x0C, 0x74, 0x1A, 0xF1, 0x52, 0x6F, 0xA7, 0x42, 0xF9,
+    0x8C, 0x9D, 0x7C, 0xA0, 0xBB, 0x35, 0x61, 0xE6, 0xEE, 0x5D, 0xB4, 0xF7, 0x88, 0x99, 0xD5, 0xE2,
+    0x7F, 0x98, 0x30, 0xA9, 0x09, 0x74, 0x67, 0x45, 0x15, 0xAB, 0xE5, 0xAB, 0x89, 0x46, 0x82, 0x4E,
+    0x2D, 0x6C, 0x20, 0xD3, 0x42, 0xA9, 0x69, 0x65, 0x94, 0xD8, 0xD2, 0x7A, 0x13, 0x5E, 0xC9, 0xCC,
+    0xD5, 0x58, 0xF5, 0xD5, 0x7B, 0x19, 0x48, 0xE1, 0x0F, 0x97, 0x6C, 0x29, 0x96, 0x2A, 0x96, 0x12,
+    0xE5, 0x8E, 0xD6, 0x3B, 0x41, 0x4D, 0x11, 0x4E, 0xAD, 0x36, 0xE7, 0x1A, 0xEE, 0x4B, 0x16, 0x7C,
+    0x22, 0x9C, 0x3D, 0x40, 0xD1, 0x3E, 0x8C, 0xFB, 0x71, 0x8F, 0x5F, 0xE0, 0xA1, 0x2B, 0xBF, 0x21,
+    0xED, 0x79, 0xF0, 0xC0, 0xDA, 0xF5, 0x8B, 0xD8, 0xC1, 0xE2, 0x02, 0xBE, 0x18, 0xC8, 0xEB, 0xDF,
+    0xFF, 0x04, 0x1B, 0x9F, 0x4F, 0x3D, 0x08, 0xA7, 0xCF, 0x90, 0xDF, 0x1E, 0xB1, 0x97, 0x03, 0x17,
+    0x4E, 0x41, 0x58, 0x7D, 0x45, 0x76, 0x0E, 0xBA, 0x05, 0x2B, 0xA1, 0xC7, 0xE6, 0x62, 0x2C, 0xDE,
+    0x8F, 0x0D, 0x56, 0xDB, 0x3C, 0xB9, 0x65, 0x83, 0xF3, 0x1D, 0x1B, 0x7C, 0x4F, 0x4C, 0x60, 0x87,
+    0xED, 0x24, 0x50, 0x8D, 0xF7, 0x4D, 0x04, 0xBB, 0x1C, 0x7A, 0x4F, 0x27, 0xF5, 0xF8, 0xD0, 0x85,
+    0x7B, 0xA9, 0x66, 0xBB, 0x66, 0xD1, 0x9B, 0x16, 0x3D, 0x94, 0x30, 0x52, 0x8B, 0xD5, 0x04, 0xFE,
+    0x85, 0x08, 0xB2, 0x11, 0x93, 0xDC, 0x11, 0x50, 0xF4, 0xB1, 0x54, 0xF4, 0x93, 0x57, 0xF0, 0xC3,
+    0x9A, 0x32, 0xCB, 0x5A, 0xCC, 0x40, 0x39, 0x60, 0x03, 0x0E, 0x1E, 0x00, 0xE0, 0xE0, 0xA4, 0xBB,
+    0x3D, 0x77, 0xBF, 0x98, 0x1F, 0x52, 0x2A, 0xE6, 0x63, 0xC5, 0xC4, 0x2F, 0x3F, 0x9D, 0xDA, 0xE6,
+    0x9E, 0xA2, 0xA4, 0xCE, 0x25, 0xD5, 0x28, 0x7F, 0xB7, 0x51, 0x3E, 0xA0, 0x6C, 0xC1, 0xA4, 0xF3,
+    0x71, 0x4D, 0x6F, 0x7B, 0x0D, 0x20, 0x1F, 0x30, 0xC9, 0x07, 0x6C, 0xEC, 0x02, 0x3E, 0x28, 0x20,
+    0x14, 0x9C, 0x82, 0x06, 0x09, 0xB5, 0xC0, 0xB9, 0x2D, 0x6F, 0xB7, 0xB0, 0x25, 0x84, 0xCB, 0x7E,
+    0xEB, 0x84, 0x39, 0xF8, 0x30, 0x06, 0x02, 0xD9, 0x77, 0x30, 0x23, 0xF9, 0x44, 0x3E, 0x62, 0x86,
+    0x1D, 0x9E, 0x5C, 0x5D, 0xB7, 0x3B, 0x3B, 0x6C, 0x3D, 0xB7, 0x8F, 0xF7, 0x39, 0xEE, 0x4F, 0xB0,
+    0xC1, 0x33, 0x4E, 0x14, 0x61, 0x32, 0x3F, 0x8D, 0x99, 0x02, 0x5D, 0xBD, 0xD6, 0xF2, 0x43, 0xD5,
+    0x07, 0xBE, 0x00, 0x4D, 0x4D, 0x17, 0xE8, 0xDA, 0x2D, 0x1B, 0x98, 0x3D, 0x7F, 0xA5, 0x90, 0x0A,
+    0xE9, 0x30, 0x99, 0xDB, 0x33, 0xA9, 0x69, 0x7F, 0xAF, 0x1A, 0x31, 0xEA, 0x69, 0x54, 0x17, 0x4A,
+    0x38, 0x05, 0xBA, 0xF8, 0x1D, 0x33, 0x5F, 0xA3, 0x39, 0x5F, 0xBB, 0x1F, 0x4E, 0xD5, 0x4F, 0xA5,
+    0xD8, 0x68, 0x60, 0x53, 0xC3, 0xA7, 0xE0, 0x22, 0x26, 0xE2, 0x5A, 0x26, 0xB2, 0x16, 0x60, 0xBF,
+    0x2E, 0x34, 0x74, 0xDD, 0x61, 0xAC, 0x9E, 0x08, 0xA7, 0x9A, 0x01, 0xCD, 0x68, 0xA1, 0x9B, 0x4F,
+    0x54, 0x77, 0x07, 0xFB, 0x66, 0xEF, 0xCF, 0x6B, 0x6A, 0xD4, 0x6E, 0x67, 0x42, 0xDB, 0x53, 0xCE,
+    0x94, 0xAF, 0xF4, 0x65, 0x7F, 0x6D, 0xCB, 0xFA, 0xFD, 0x86, 0x16, 0x81, 0x19, 0x71, 0x31, 0xFB,
+    0x45, 0xB4, 0x4F, 0xF7, 0xDF, 0x2C, 0xEA, 0x0F, 0x65, 0xD1, 0xF9, 0x67, 0x32, 0xE9, 0x86, 0x14,
+    0x45, 0x6A, 0x6A, 0x5F, 0x0D, 0xE5, 0x63, 0x33, 0x68, 0xA4, 0x52, 0x9F, 0x69, 0xC5, 0x7F, 0x2E,
+    0x3D, 0x8C, 0xCE, 0x53, 0xFD, 0xA4, 0x2F, 0xDF, 0x5A, 0x8A, 0xA9, 0x53, 0xAA, 0x34, 0xB1, 0x7F,
+    0x00, 0x3F, 0x80, 0xAE, 0xC5, 0x44, 0x98, 0xC8, 0xA6, 0x55, 0x21, 0xB6, 0xA1, 0xD2, 0x53, 0x8B,
+    0x6C, 0xB8, 0xD8, 0x70, 0x5B, 0xAD, 0xD1, 0x68, 0x34, 0xE5, 0x1A, 0xEB, 0xE6, 0x8D, 0xD6, 0x77,
+    0xF5, 0xDC, 0xE9, 0x55, 0x2D, 0xEC, 0xC1, 0x1F, 0x91, 0x2F, 0x30, 0x61, 0x7A, 0x2E, 0xB1, 0x86,
+    0xFD, 0x79, 0xA8, 0x48, 0x55, 0x5D, 0xBD, 0x59, 0x67, 0x6A, 0xB7, 0x34, 0xDE, 0x6F, 0xD6, 0x3A,
+    0xC7, 0xB2, 0xFA, 0x07, 0xD5, 0x23, 0xE3, 0x94, 0x2B, 0x98, 0xB4, 0x4D, 0x7F, 0xFF, 0x9D, 0x5B,
+    0x67, 0x7F, 0xB3, 0xD9, 0x9C, 0xD5, 0x8A, 0xA5, 0x75, 0x38, 0x36, 0x37, 0xD2, 0x19, 0x93, 0xEC,
+    0x61, 0xEF, 0xC3, 0x74, 0xCC, 0xA4, 0xBD, 0xF7, 0x8A, 0x90, 0xDE, 0xFF, 0xA0, 0xE9, 0x57, 0xAD,
+    0x70, 0xA9, 0x79, 0x3B, 0x64, 0xBE, 0x58, 0x6F, 0xDF, 0x2A, 0xFB, 0x2D, 0x5C, 0xF0, 0x6C, 0xC3,
+    0xB4, 0x93, 0x90, 0xC8, 0x13, 0x79, 0xA2, 0x52, 0xF2, 0x9A, 0x3E, 0x33, 0x1F, 0x98, 0xC4, 0xFB,
+    0x3C, 0xF5, 0xFF, 0xE4, 0x4A, 0xAC, 0x32, 0xDC, 0xAA, 0xC6, 0xF7, 0x98, 0x81, 0x22, 0xE0, 0x6A,
+    0x3E, 0xBB, 0x1B, 0xB5, 0xA7, 0xE1, 0xA2, 0x0D, 0x98, 0x77, 0xE2, 0x96, 0x69, 0x74, 0x3B, 0xCD,
+    0xD5, 0xCA, 0x2F, 0xE8, 0x50, 0x52, 0xF2, 0x8F, 0xA5, 0xEA, 0x70, 0xF0, 0x21, 0x9D, 0x36, 0xC9,
+    0xB6, 0xB5, 0x0F, 0x07, 0xBF, 0xB6, 0x4E, 0x3E, 0xAC, 0x22, 0xAE, 0x42, 0xF3, 0xAA, 0x4B, 0x86,
+    0x6F, 0xC2, 0x05, 0xB8, 0xC6, 0xC9, 0x1F, 0x90, 0x9E, 0xCB, 0xD3, 0xD7, 0x3E, 0x54, 0x0D, 0xFE,
+    0x4E, 0x0D, 0xFD, 0x17, 0xCB, 0x95, 0xD5, 0x33, 0x7E, 0x66, 0xAE, 0x7F, 0x6D, 0x43, 0xFF, 0xEA,
+    0x86, 0xFC, 0xCC, 0x7C, 0xE0, 0x15, 0x8B, 0x23, 0xAB, 0xEE, 0x6F, 0xC8, 0xEC, 0x4A, 0x0D, 0xE5,
+    0x14, 0xC1, 0x2A, 0x82, 0xAD, 0x06, 0xEE, 0x41, 0xD8, 0xFD, 0x4D, 0xBD, 0x39, 0xD7, 0xE9, 0x86,
+    0x96, 0x46, 0x75, 0x37, 0x15, 0x13, 0xB6, 0xFF, 0x3B, 0xEF, 0x12, 0x55, 0x6F, 0xD2, 0x9A, 0xA3,
+    0xF2, 0x21, 0xD7, 0x9F, 0xA9, 0x46, 0x5A, 0x58, 0x53, 0x95, 0x6C, 0x80, 0xDF, 0xDA, 0x03, 0xF7,
+    0x5A, 0xC0, 0x2A, 0x62, 0x0E, 0xA7, 0x7B, 0x52, 0x27, 0x80, 0x2E, 0x74, 0xA1, 0x8B, 0x5D, 0x2C,
+    0x52, 0x91, 0x10, 0xC2, 0x07, 0x1F, 0x6C, 0xB4, 0xD1, 0x24, 0x73, 0x5F, 0xC1, 0x68, 0x63, 0xAE,
+    0x67, 0x13, 0x5E, 0x1A, 0x0B, 0x5D, 0x4E, 0xEC, 0x67, 0x35, 0xAB, 0xAC, 0x65, 0xAD, 0x91, 0xE2,
+    0x7D, 0x88, 0xEB, 0x93, 0xAE, 0x91, 0xB4, 0x2A, 0x78, 0x76, 0xB2, 0x1A, 0x80, 0x32, 0x95, 0xA9,
+    0x54, 0x29, 0x9A, 0xD0, 0xBC, 0x4F, 0x05, 0x8E, 0x0A, 0x6A, 0xE1, 0xEE, 0x2A, 0x18, 0x49, 0x75,
+    0x33, 0x29, 0x64, 0x07, 0x27, 0x21, 0xE3, 0x04, 0xD8, 0xFA, 0xB9, 0x6D, 0x45, 0x0A, 0x05, 0xB6,
+    0xBA, 0xEB, 0xBF, 0x87, 0xDA, 0xAC, 0x8A, 0xE5, 0x80, 0xFD, 0xAB, 0x48, 0xA6, 0x11, 0x1E, 0x1A,
+    0x3E, 0xA6, 0xFB, 0xC3, 0x6F, 0xC1, 0x9A, 0x8C, 0x33, 0x87, 0x01, 0xCC, 0xCD, 0x1E, 0xCC, 0xCB,
+    0x61, 0x17, 0xE4, 0x9E, 0xFC, 0xE4, 0xEB, 0x76, 0x7C, 0x80, 0x52, 0x60, 0x0E, 0x7B, 0x88, 0xDF,
+    0x87, 0xD3, 0xA7, 0xB6, 0x32, 0xCD, 0xAD, 0x32, 0xD5, 0x45, 0x17, 0x5D, 0x72, 0x29, 0x53, 0xF6,
+    0xAB, 0xEA, 0x16, 0x6D, 0x34, 0xB3, 0x49, 0x74, 0x6F, 0x08, 0x2B, 0xCD, 0x99, 0x5E, 0x13, 0x7B,
+    0xF5, 0x01, 0x70, 0x2C, 0x07, 0x4E, 0x97, 0x01, 0x96, 0x2A, 0x60, 0xA6, 0xA6, 0xA6, 0xEC, 0x27,
+    0x38, 0x4E, 0xFF, 0xF7, 0x73, 0xEF, 0x8E, 0x9B, 0x9A, 0xFC, 0x76, 0x84, 0x29, 0xC1, 0xB5, 0x8B,
+    0x70, 0xFA, 0x8B, 0xF0, 0x60, 0x71, 0xEF, 0xFE, 0xFD, 0x26, 0xF5, 0xFB, 0x4D, 0x8C, 0x37, 0xF7,
+    0x8C, 0x5F, 0xF0, 0x21, 0xD7, 0xEB, 0x3B, 0xE3, 0x2B, 0x8D, 0xC0, 0x13, 0x61, 0xE7, 0xB6, 0x3D,
+    0x80, 0xFF, 0x1B, 0xA0, 0x9A, 0x60, 0xC7, 0xCA, 0x7E, 0xF4, 0xE1, 0x64, 0xDB, 0x95, 0xF1, 0x32,
+    0x03, 0xB0, 0xB4, 0x6B, 0x6E, 0x93, 0x7B, 0x03, 0x95, 0xE7, 0xB7, 0xF2, 0xBE, 0x96, 0x1D, 0x5B,
+    0x05, 0xD5, 0x53, 0x11, 0xE0, 0x77, 0xB8, 0x72, 0xBF, 0x13, 0x81, 0xCD, 0xB9, 0x46, 0xA1, 0x41,
+    0xC9, 0xAB, 0xEE, 0x68, 0xA6, 0x32, 0xA1, 0xDA, 0xF6, 0x45, 0xCA, 0x14, 0xAA, 0x60, 0xE6, 0x5C,
+    0xC1, 0xB5, 0xF9, 0x62, 0xD4, 0xFB, 0x3A, 0x93, 0xD1, 0xE0, 0x41, 0xC5, 0x9B, 0xF1, 0x12, 0x74,
+    0x5F, 0xF9, 0x61, 0xBC, 0x0E, 0xCD, 0xE5, 0x5B, 0x63, 0x02, 0xFF, 0xC2, 0xD3, 0x69, 0x02, 0xF7,
+    0x4A, 0x3E, 0x8F, 0x50, 0x29, 0x53, 0x04, 0xBB, 0xA0, 0x01, 0xCA, 0x99, 0xAE, 0x87, 0x22, 0xD1,
+    0x04, 0x30, 0xD3, 0x9A, 0x3B, 0x7F, 0xD7, 0xC3, 0x73, 0x94, 0x59, 0xA8, 0x2E, 0x01, 0x8C, 0x17,
+    0x80, 0xB2, 0x7D, 0xEE, 0x5D, 0x9F, 0x6A, 0x96, 0xA2, 0xEF, 0xA2, 0x46, 0xF7, 0xA4, 0x82, 0x10,
+    0x29, 0x4F, 0x45, 0x2A, 0x7A, 0x33, 0xB9, 0xD1, 0x63, 0xA3, 0x86, 0x84, 0x3B, 0x7C, 0xE5, 0x56,
+    0x8F, 0xFF, 0x23, 0xEF, 0x60, 0x19, 0xAF, 0x4F, 0x64, 0xBA, 0xA1, 0x1E, 0x23, 0x23, 0x28, 0xC7,
+    0x72, 0x82, 0x2A, 0x54, 0xEF, 0xBE, 0x7E, 0xD5, 0x6E, 0x15, 0x8E, 0x77, 0x27, 0x38, 0x53, 0xF4,
+    0x98, 0xF6, 0xB3, 0x9F, 0x90, 0xC6, 0x19, 0xEA, 0x2D, 0x49, 0xA9, 0x1A, 0xEE, 0x46, 0xB8, 0x76,
+    0x06, 0x4E, 0x99, 0xF6, 0x13, 0x94, 0x99, 0x02, 0x14, 0x43, 0x02, 0x55, 0x03, 0x65, 0x9C, 0xE1,
+    0xE4, 0xDE, 0x4E, 0xF8, 0x91, 0x6D, 0xBE, 0xA2, 0xA9, 0x59, 0x9A, 0x25, 0x57, 0xDB, 0x05, 0x3B,
+    0x98, 0x39, 0x4B, 0x54, 0xD1, 0xD7, 0xE8, 0xB1, 0x01, 0x93, 0x12, 0xB8, 0x37, 0xDB, 0x35, 0x87,
+    0x5E, 0xCC, 0xEF, 0x8F, 0x29, 0xFA, 0x35, 0xE6, 0x29, 0xB4, 0xDC, 0x4B, 0xF8, 0x55, 0x3D, 0xB9,
+    0xC0, 0xFD, 0x6C, 0xC5, 0x96, 0x90, 0x6D, 0x36, 0x07, 0x4E, 0x8A, 0x9D, 0x74, 0x38, 0x9A, 0xC5,
+    0xB6, 0x2E, 0xFE, 0x0E, 0x5A, 0x35, 0x5C, 0x5D, 0xA0, 0x48, 0xE0, 0x7B, 0xCC, 0xB2, 0x76, 0x67,
+    0xD5, 0xBF, 0x6D, 0x27, 0xA6, 0x2E, 0x14, 0xAF, 0x2D, 0x57, 0xBB, 0xC7, 0x57, 0x45, 0xC5, 0x3A,
+    0x03, 0xE6, 0x35, 0x59, 0x84, 0x04, 0xCF, 0xC3, 0x19, 0x38, 0x7E, 0xE4, 0x09, 0xB4, 0x94, 0xD2,
+    0xE1, 0xDB, 0xCD, 0x30, 0x56, 0xC3, 0x67, 0xAB, 0x88, 0x8D, 0xD8, 0x91, 0x72, 0xA2, 0x48, 0x65,
+    0x91, 0xCC, 0xCB, 0xCB, 0xBF, 0x8C, 0x52, 0xF2, 0x5B, 0x33, 0x8F, 0xAF, 0x2B, 0x80, 0xF2, 0x05,
+    0x8A, 0xF1, 0x28, 0x05, 0xBF, 0xD9, 0x9C, 0x2B, 0xB7, 0x57, 0x9B, 0xD1, 0xD3, 0x43, 0x99, 0x8A,
+    0xDA, 0xAF, 0xE9, 0x78, 0x17, 0xC9, 0x04, 0x76, 0x04, 0xB5, 0x5B, 0x83, 0x0B, 0xB3, 0x70, 0xC6,
+    0xC5, 0x6C, 0xD2, 0xD5, 0x67, 0x5F, 0x96, 0x54, 0x6A, 0x9B, 0xF6, 0xDC, 0x87, 0x2A, 0x50, 0x8E,
+    0x64, 0x09, 0x8E, 0x34, 0xB7, 0x9D, 0x26, 0x27, 0xD9, 0x1F, 0xE9, 0xE9, 0xBE, 0x69, 0xBF, 0xD6,
+    0xAC, 0xDC, 0x4B, 0x8F, 0x1B, 0xA8, 0xE2, 0x17, 0xAA, 0x68, 0x1F, 0xBF, 0xF3, 0xD5, 0x43, 0x29,
+    0xEE, 0x12, 0xE5, 0x40, 0xC9, 0x05, 0x7C, 0xD1, 0xE3, 0xAF, 0x6F, 0x35, 0x2C, 0x1F, 0x6B, 0x63,
+    0x66, 0x1C, 0x98, 0xE1, 0x02, 0xD7, 0x4F, 0x63, 0x05, 0xDA, 0xB2, 0x29, 0x1F, 0xA5, 0x31, 0xAF,
+    0x50, 0x29, 0x54, 0x1A, 0x6D, 0xBC, 0x5E, 0x8C, 0x9F, 0xCA, 0x57, 0x05, 0x90, 0x0B, 0x94, 0x91,
+    0x0F, 0x3C, 0x29, 0x34, 0xE5, 0x5A, 0x38, 0x59, 0xF4, 0x4D, 0x9E, 0x8A, 0xFE, 0x81, 0xDC, 0xDC,
+    0x4E, 0xE9, 0xE2, 0x03, 0x2B, 0xB3, 0x65, 0x16, 0xAE, 0x8F, 0x55, 0x79, 0xB3, 0xFF, 0x32, 0x70,
+    0xFC, 0x11, 0xB3, 0x9C, 0xF2, 0x3A, 0xBC, 0x35, 0x71, 0x0C, 0xAF, 0x43, 0xA5, 0xFD, 0x4D, 0x0D,
+    0x26, 0xFC, 0xB6, 0xFF, 0xF3, 0x9B, 0x1A, 0x8F, 0x4F, 0xEC, 0x99, 0xE4, 0x0F, 0xA7, 0x63, 0x80,
+    0x89, 0xD7, 0x1A, 0xFB, 0xE3, 0x38, 0x1F, 0xCB, 0x28, 0x07, 0x9F, 0x2E, 0x9C, 0xFE, 0x47, 0xA7,
+    0xB2, 0xB1, 0x08, 0xA6, 0x3E, 0x3E, 0xB8, 0x74, 0xEA, 0xD4, 0x37, 0x7F, 0xEF, 0xF4, 0xA9, 0x6A,
+    0xCC, 0xEA, 0xE3, 0xA6, 0x4E, 0xD7, 0xEC, 0xE5, 0x9B, 0xB7, 0xC7, 0xD3, 0x5F, 0xCC, 0x9F, 0x0C,
+    0xC0, 0xB1, 0xEC, 0x6C, 0xB8, 0xE6, 0x2B, 0xD4, 0x17, 0x13, 0x9F, 0xE3, 0xB7, 0x3F, 0x65, 0x5E,
+    0x8B, 0xDE, 0x65, 0xE3, 0x54, 0x7E, 0x2B, 0x7C, 0xE9, 0x61, 0x20, 0xFB, 0x2E, 0x1A, 0xCF, 0x3C,
+    0x7B, 0x58, 0x5F, 0x38, 0x91, 0x91, 0xE5, 0xB7, 0x63, 0xF2, 0xF6, 0xE6, 0x74, 0xC2, 0xD9, 0x57,
+    0xD3, 0x25, 0x57, 0xFD, 0xAF, 0xF5, 0x19, 0xF7, 0xC2, 0x4B, 0xE3, 0x99, 0xA2, 0xFF, 0xDA, 0xC9,
+    0x33, 0x67, 0x4E, 0x9D, 0xFA, 0xD2, 0x89, 0xEA, 0xEC, 0x30, 0xA5, 0x53, 0xC7, 0x20, 0x9B, 0xFC,
+    0x61, 0xFA, 0xDD, 0xFA, 0xB7, 0x8E, 0x7F, 0x2B, 0xCE, 0x8D, 0x7D, 0xE9, 0xCA, 0x1F, 0x7C, 0xEE,
+    0xB1, 0x39, 0xEA, 0xD3, 0xCD, 0x8D, 0x2B, 0x0F, 0x96, 0x31, 0x9D, 0xF1, 0x7B, 0x7C, 0xF1, 0x6C,
+    0x2A, 0xFA, 0x6B, 0x2E, 0xAF, 0xC9, 0xC6, 0x8B, 0x65, 0xE8, 0xFE, 0xCF, 0x39, 0xE3, 0x2F, 0xD6,
+    0x05, 0x33, 0x27, 0x70, 0xA1, 0x10, 0x77, 0xD2, 0x19, 0xF3, 0x62, 0x7D, 0x0C, 0xF2, 0xF0, 0x3F,
+    0xF8, 0xC7, 0x6E, 0x6A, 0x2C, 0xEF, 0x00, 0xE5, 0x53, 0x67, 0x97, 0x0B, 0x67, 0x74, 0xF3, 0xE9,
+    0x71, 0xCB, 0x9F, 0x26, 0xAF, 0xF0, 0x2E, 0x3B, 0x01, 0x22, 0xAE, 0x2E, 0x22, 0x09, 0x0B, 0x98,
+    0x38, 0x37, 0xF6, 0xE5, 0x98, 0x80, 0x93, 0x55, 0x79, 0x43, 0x7E, 0xEB, 0x7E, 0xBE, 0xB4, 0xCD,
+    0x85, 0x76, 0xFD, 0x36, 0x3B, 0xF3, 0xB5, 0x8F, 0x55, 0xD5, 0xB4, 0xBF, 0xD9, 0x6C, 0x6A, 0xAB,
+    0x55, 0xD3, 0xA2, 0xC4, 0xEC, 0x86, 0x4B, 0x9C, 0x29, 0x26, 0xDB, 0xDA, 0x47, 0x16, 0xD3, 0x43,
+    0xD3, 0x02, 0xD5, 0x00, 0x14, 0xD2, 0x15, 0x32, 0x69, 0x81, 0xE6, 0x75, 0xF5, 0x54, 0x43, 0x99,
+    0x28, 0x26, 0x44, 0xB6, 0xE0, 0x7B, 0x9A, 0xB6, 0x1C, 0x71, 0x43, 0x3E, 0xD3, 0xA9, 0xEE, 0xF0,
+    0xEA, 0x7D, 0xD8, 0xFD, 0xAF, 0x8D, 0xAC, 0xE6, 0xE7, 0x1A, 0xB7, 0xD2, 0x2F, 0xEE, 0xCF, 0x40,
+    0xD9, 0x95, 0x40, 0xAD, 0xC6, 0x5D, 0xF6, 0x69, 0x6F, 0xAD, 0xDF, 0xD4, 0x49, 0x83, 0xFF, 0xD1,
+    0xF9, 0x5A, 0x5C, 0x34, 0x29, 0x8B, 0x36, 0x9A, 0x76, 0xA7, 0x36, 0x4D, 0xF7, 0xE9, 0x63, 0xEF,
+    0x3B, 0xED, 0x29, 0x35, 0xAD, 0x19, 0x9F, 0xE3, 0x77, 0x6B, 0x3A, 0x8D, 0x46, 0x9A, 0xEC, 0x98,
+    0x4F, 0xAE, 0xCF, 0x26, 0x1F, 0x18, 0x9B, 0x9A, 0x2B, 0x1D, 0xB0, 0x2A, 0x24, 0x46, 0x74, 0xF5,
+    0x3B, 0xA8, 0x5E, 0xC5, 0xF4, 0x5D, 0xE0, 0x9B, 0x7E, 0x20, 0xB9, 0xF9, 0x33, 0xA9, 0x94, 0xC6,
+    0x4C, 0xEA, 0xD9, 0x3B, 0xF7, 0x1B, 0x06, 0xF7, 0x1F, 0x92, 0x42, 0x37, 0xF1, 0x62, 0xF3, 0xF8,
+    0x2F, 0xC6, 0xE5, 0x64, 0x56, 0x7F, 0x48, 0xFA, 0xFD, 0x63, 0x63, 0x9A, 0x37, 0x9B, 0xCD, 0x01,
+    0xD9, 0xDA, 0xD5, 0x25, 0xF5, 0x60, 0x83, 0x78, 0xCF, 0xBE, 0xDD, 0xEE, 0xCF, 0x41, 0x55, 0x4B,
+    0x3D, 0x55, 0x2D, 0x25, 0x1C, 0x2A, 0x16, 0x3C, 0x42, 0x9C, 0x41, 0x88, 0xEB, 0x08, 0x7D, 0x3E,
+    0xA1, 0x6C, 0x69, 0x26, 0x74, 0x3E, 0x75, 0xB1, 0x92, 0xC6, 0xA6, 0x75, 0x52, 0x7D, 0xEC, 0x08,
+    0xB5, 0x6E, 0x30, 0x9A, 0x9D, 0x22, 0x4E, 0x4F, 0x6A, 0x06, 0x1F, 0xB2, 0x95, 0x25, 0xAB, 0x86,
+    0xF7, 0x9E, 0xF4, 0x99, 0xC0, 0x48, 0xD2, 0x84, 0x97, 0xA4, 0xD1, 0x2C, 0x57, 0x9F, 0xBD, 0xAB,
+    0xE0, 0x43, 0xB6, 0xE4, 0x8B, 0x49, 0x54, 0x43, 0x35, 0xF8, 0x90, 0x2D, 0xAC, 0x27, 0xAE, 0xF7,
+    0x7D, 0xA6, 0xF3, 0xC9, 0xE9, 0x45, 0x49, 0x46, 0xB3, 0x93, 0xEA, 0x7B, 0x7A, 0xD5, 0x4D, 0x8D,
+    0x24, 0xB1, 0x8E, 0x02, 0xFB, 0xD2, 0x52, 0x0C, 0xEB, 0x30, 0x60, 0xAC, 0x86, 0xD3, 0x6C, 0xC7,
+    0x41, 0xB6, 0x00, 0x14, 0x8B, 0x06, 0xA8, 0xA4, 0x08, 0xCD, 0xEB, 0x1A, 0xC8, 0x16, 0xBA, 0xB0,
+    0x0E, 0x05, 0xAA, 0xC1, 0x24, 0x68, 0x5A, 0x1B, 0xC9, 0x17, 0x7C, 0x4F, 0xA7, 0xAF, 0x68, 0x34,
+    0x9A, 0xBD, 0xFA, 0x7B, 0x6B, 0x46, 0xD7, 0x31, 0x6D, 0xD3, 0x76, 0x09, 0xC7, 0x8E, 0x56, 0xDE,
+    0xDB, 0x1C, 0xE4, 0x57, 0xBC, 0xFA, 0x26, 0x74, 0xB3, 0x11, 0x3E, 0xB8, 0x84, 0x48, 0x98, 0x54,
+    0xF6, 0xD8, 0xE8, 0xC1, 0xDF, 0x8C, 0x20, 0x05, 0x8C, 0x54, 0x63, 0xA3, 0xC0, 0xDF, 0x58, 0x40,
+    0x66, 0xC6, 0xA4, 0x22, 0x61, 0xA3, 0x4D, 0xF8, 0xBE, 0x9A, 0x4A, 0x45, 0x37, 0x79, 0x05, 0x37,
+    0x71, 0x4F, 0x57, 0xB6, 0x12, 0x7F, 0xBE, 0xDE, 0x5D, 0x9C, 0x6E, 0x9B, 0xAA, 0x7C, 0xAF, 0x66,
+    0xEA, 0x2B, 0xEA, 0x57, 0xCD, 0x94, 0xB0, 0x71, 0xDB, 0xC5, 0x22, 0xC2, 0x27, 0x7C, 0xF0, 0xC2,
+    0xC6, 0xC6, 0x07, 0x93, 0x1A, 0x1B, 0x51, 0x63, 0x12, 0x5E, 0x08, 0x2B, 0x7C, 0x30, 0x5A, 0x57,
+    0x61, 0x9A, 0x84, 0xEF, 0x51, 0xDD, 0xE9, 0x51, 0xCD, 0x5E, 0xBD, 0x54, 0xF3, 0x70, 0xDE, 0x52,
+    0xF4, 0x67, 0xC0, 0x3F, 0xD1, 0x93, 0x69, 0xE2, 0x48, 0xD1, 0xB7, 0xBF, 0xC9, 0x36, 0x5F, 0xD5,
+    0xE8, 0xD5, 0x2C, 0xB9, 0x7A, 0xB5, 0x65, 0x2C, 0x12, 0x09, 0xD7, 0x57, 0x2D, 0x32, 0x91, 0x32,
+    0x5E, 0x02, 0x7F, 0x39, 0x90, 0xCF, 0x3B, 0x68, 0xD7, 0xED, 0xA0, 0x9D, 0xAB, 0x31, 0x66, 0x80,
+    0xE7, 0xD3, 0xBA, 0xFE, 0x7D, 0x15, 0x22, 0x1C, 0xEC, 0x42, 0x21, 0xAF, 0x97, 0xB5, 0x38, 0x3D,
+    0xA5, 0x69, 0x95, 0x8D, 0x7C, 0xC4, 0xDD, 0xB2, 0x69, 0x06, 0x27, 0x69, 0xF1, 0x92, 0x96, 0x2D,
+    0x41, 0xD5, 0xB0, 0x5D, 0xA1, 0xC4, 0xE9, 0xA3, 0xDD, 0xB1, 0xD5, 0x49, 0x9F, 0x86, 0x2A, 0x90,
+    0xA5, 0x15, 0xCB, 0xB6, 0x1F, 0x4D, 0x2B, 0x7A, 0x82, 0xAC, 0xEB, 0xB1, 0xAA, 0x29, 0x66, 0x38,
+    0x7F, 0xF7, 0x3B, 0xB9, 0xD6, 0xFC, 0x6D, 0x9E, 0xA0, 0xBC, 0xAD, 0xD6, 0x49, 0x6D, 0x27, 0xE5,
+    0x8B, 0x99, 0xCB, 0xB1, 0x9C, 0x5C, 0x5F, 0x0D, 0x5D, 0xDD, 0x3C, 0x35, 0x67, 0x4B, 0x39, 0x16,
+    0x93, 0xEB, 0xAB, 0xD7, 0xD4, 0x37, 0x4F, 0xE8, 0xA9, 0x9D, 0x77, 0x6C, 0xC9, 0x13, 0x59, 0xD7,
+    0x53, 0x2D, 0xAB, 0x80, 0x2F, 0x6B, 0x61, 0x82, 0xE7, 0xC1, 0x83, 0x83, 0xFC, 0x08, 0xFE, 0x4B,
+    0x97, 0xA5, 0xBE, 0x79, 0x6A, 0xAC, 0x86, 0x8B, 0xC5, 0x64, 0xB3, 0x25, 0xAF, 0x9B, 0x96, 0x6A,
+    0xA0, 0x98, 0xC8, 0x16, 0x68, 0x5A, 0x3A, 0xAD, 0xAB, 0x8A, 0xF6, 0x6A, 0x9C, 0x5A, 0xAF, 0xC9,
+    0xB7, 0xCF, 0x57, 0xC1, 0xDA, 0x88, 0x59, 0xFE, 0x5F, 0xA4, 0xDA, 0xBF, 0xDE, 0xDA, 0xB8, 0xAE,
+    0x7F, 0xBA, 0xF3, 0x47, 0xAB, 0x7E, 0xB7, 0xCD, 0xCE, 0x7D, 0x88, 0xC4, 0x26, 0x75, 0x36, 0xD3,
+    0x05, 0x37, 0x6C, 0xB5, 0x4C, 0x1F, 0xA8, 0x9A, 0x82, 0xE2, 0xC5, 0x49, 0xEE, 0x85, 0x9F, 0xA6,
+    0xED, 0x0C, 0xFB, 0xEB, 0x95, 0x4F, 0xC7, 0x70, 0xC1, 0x8E, 0x66, 0xE6, 0x9F, 0x00, 0x9C, 0xA8,
+    0x92, 0x15, 0x4D, 0x28, 0x63, 0x9E, 0xE8, 0x70, 0xEF, 0x39, 0x10, 0xBE, 0xF5, 0x7D, 0x33, 0x34,
+    0xB1, 0xBC, 0x42, 0x21, 0x4D, 0x14, 0xD2, 0x08, 0x17, 0x5D, 0x80, 0x0B, 0x2E, 0xC0, 0x35, 0xF7,
+    0x23, 0xB8, 0xE6, 0x14, 0x99, 0xDC, 0x1B, 0x89, 0xC9, 0xDD, 0x98, 0xB3, 0xD1, 0x85, 0xF9, 0x1F,
+    0x46, 0x17, 0xE6, 0x66, 0x70, 0x37, 0x53, 0x17, 0x3A, 0x4D, 0x4D, 0x2D, 0x5D, 0x39, 0x09, 0xE0,
+    0x97, 0x4A, 0xB5, 0xD1, 0x8B, 0x8A, 0x14, 0xA3, 0x99, 0xA0, 0xA9, 0x7D, 0x4B, 0x31, 0x9A, 0x3B,
+    0x07, 0x34, 0x92, 0x86, 0x42, 0x5A, 0xD4, 0x36, 0x7F, 0xDA, 0x3D, 0x95, 0x8A, 0xD1, 0x4C, 0x55,
+    0x68, 0x6A, 0xFF, 0x64, 0x2A, 0x46, 0x33, 0xF9, 0x9B, 0x1A, 0xA4, 0xE8, 0x97, 0xEA, 0x08, 0x9B,
+    0xDE, 0xAF, 0xDF, 0x6B, 0x7A, 0x38, 0x7F, 0xF7, 0x3B, 0x38, 0xA5, 0x75, 0x4D, 0xBD, 0x0B, 0x6B,
+    0x97, 0xC9, 0xA5, 0x89, 0x4E, 0xC2, 0x0D, 0xBE, 0x2F, 0xC7, 0xF2, 0xFD, 0xF5, 0x7B, 0xF9, 0x4E,
+    0xBF, 0xB7, 0xCE, 0xC8, 0x17, 0x57, 0x3A, 0x33, 0x9B, 0xD6, 0x20, 0x37, 0x3B, 0x0A, 0x8E, 0x0E,
+    0xFC, 0x62, 0x46, 0x3F, 0xDB, 0xA9, 0x18, 0xDD, 0xDF, 0x14, 0xA3, 0xA7, 0x18, 0xAF, 0x51, 0xDC,
+    0x9D, 0x28, 0x94, 0x28, 0xDE, 0x5E, 0x28, 0xC6, 0xAE, 0x2E, 0x46, 0x1F, 0x8A, 0xD1, 0x0D, 0x6E,
+    0xB6, 0x93, 0xDF, 0xC9, 0x76, 0x1E, 0x60, 0x1B, 0x34, 0x4F, 0xDB, 0xE5, 0xAC, 0x79, 0x84, 0x5D,
+    0xC2, 0x75, 0x6D, 0x1B, 0xAB, 0xC7, 0x75, 0x56, 0xA1, 0xA9, 0x7D, 0x5B, 0xF5, 0x6E, 0x28, 0x46,
+    0x37, 0x65, 0xB3, 0x5B, 0x68, 0xCE, 0xFB, 0xB6, 0x92, 0x1D, 0x0A, 0x99, 0x29, 0x13, 0x0B, 0x4D,
+    0xED, 0xDB, 0x6E, 0x74, 0xB3, 0x5F, 0xEC, 0xD6, 0xAB, 0x5F, 0x28, 0x03, 0xEE, 0x6C, 0xA4, 0xB8,
+    0x3B, 0x41, 0x33, 0x7D, 0x2C, 0x4B, 0xEC, 0x8E, 0x99, 0x48, 0xF1, 0xED, 0x11, 0xA3, 0x11, 0xBA,
+    0x71, 0xAB, 0x40, 0xF5, 0x72, 0x7A, 0x5C, 0x8F, 0xA9, 0x6D, 0xEA, 0xA6, 0xAD, 0xFA, 0x6A, 0x28,
+    0xC6, 0x62, 0xCA, 0xE6, 0x6C, 0xE1, 0x97, 0x0B, 0xDA, 0xA6, 0xED, 0xB6, 0xA9, 0xD9, 0x7B, 0xD9,
+    0xEA, 0x32, 0x40, 0x3E, 0x6C, 0xB1, 0xDE, 0xD7, 0xAF, 0xD6, 0xAB, 0x40, 0x24, 0x53, 0x0B, 0x59,
+    0x5A, 0xD7, 0x69, 0xB7, 0x92, 0x16, 0xF3, 0xB3, 0xEE, 0x7F, 0x19, 0xED, 0x23, 0xC9, 0xF4, 0xA7,
+    0x8A, 0x68, 0x57, 0xAB, 0x68, 0x96, 0x9A, 0x4C, 0xEA, 0x29, 0xEE, 0xAA, 0xA7, 0x0A, 0x4D, 0xA0,
+    0x41, 0x64, 0xC9, 0x24, 0x8A, 0x68, 0x23, 0xEE, 0xAF, 0x54, 0x17, 0xD2, 0x88, 0x3B, 0x0A, 0x06,
+    0x3F, 0xD7, 0x92, 0x2B, 0x90, 0x2B, 0xAC, 0xBD, 0xC2, 0x05, 0xBC, 0x14, 0xBD, 0x14, 0x4F, 0xB9,
+    0x1B, 0xF1, 0x94, 0xBB, 0x31, 0x9C, 0x74, 0x01, 0xDC, 0x7F, 0xAB, 0x71, 0x1A, 0x71, 0x3F, 0x4E,
+    0xB8, 0xB0, 0xAC, 0xDB, 0xCD, 0x39, 0x93, 0xA6, 0x5C, 0xBA, 0xF2, 0x3E, 0x8C, 0x6D, 0x7D, 0xC4,
+    0xD8, 0x16, 0xA9, 0xA9, 0xF1, 0x3F, 0x89, 0x98, 0x59, 0x92, 0x5E, 0x91, 0x34, 0xEB, 0x4F, 0x37,
+    0xCD, 0x2B, 0x23, 0x26, 0x75, 0x2D, 0xFE, 0x56, 0xA2, 0x18, 0x7D, 0xE4, 0x7D, 0x19, 0xDB, 0xFB,
+    0xB8, 0xE5, 0xC9, 0x8E, 0x55, 0xB0, 0x71, 0xC1, 0x1D, 0xCE, 0x9B, 0xCE, 0x4A, 0xC9, 0xFF, 0xE9,
+    0x57, 0xE3, 0x82, 0x3B, 0x4C, 0x2C, 0x45, 0x2A, 0xDF, 0xC5, 0x2D, 0xEF, 0x6F, 0xEA, 0x6C, 0xEC,
+    0x14, 0xCA, 0xD4, 0xA8, 0xAE, 0x66, 0x9B, 0xF0, 0xA9, 0x48, 0x34, 0x98, 0x99, 0x8E, 0x5C, 0xCC,
+    0x20, 0x12, 0xE8, 0xD1, 0x09, 0x9A, 0xC3, 0x11, 0xFC, 0x61, 0x04, 0xF7, 0xE3, 0x01, 0xEC, 0x1B,
+    0x3D, 0x58, 0x05, 0x28, 0xD4, 0x6E, 0x85, 0xBD, 0xB9, 0x76, 0x74, 0xE0, 0x4E, 0x2D, 0x58, 0x29,
+    0xB8, 0x97, 0x35, 0x54, 0x93, 0xEF, 0xED, 0x5C, 0x24, 0xF3, 0x16, 0xCA, 0x47, 0x5C, 0x9F, 0x30,
+    0xD3, 0x25, 0xE8, 0x1C, 0x54, 0xAF, 0x84, 0x75, 0x89, 0x4D, 0x13, 0xD7, 0x00, 0x30, 0xDF, 0x09,
+    0x6F, 0xCA, 0xFA, 0x1B, 0x60, 0x06, 0x0F, 0xCC, 0xE7, 0xDB, 0x75, 0x7D, 0xF4, 0xBD, 0x8C, 0x68,
+    0xB6, 0x39, 0xB7, 0xB7, 0x39, 0x90, 0xCE, 0x6A, 0x76, 0xAA, 0xBB, 0x65, 0x3B, 0x8B, 0x6E, 0x27,
+    0x61, 0x05, 0x93, 0x50, 0x44, 0x28, 0xE1, 0x6F, 0x24, 0x61, 0x6F, 0x27, 0x1F, 0xCC, 0x9C, 0x6C,
+    0x44, 0xC9, 0x24, 0x7C, 0x42, 0xD8, 0x2D, 0x22, 0xB4, 0x11, 0xD5, 0x66, 0xCE, 0x35, 0x97, 0x9A,
+    0xA4, 0xB3, 0xEB, 0xDD, 0xEF, 0xD8, 0x0E, 0xB6, 0x75, 0xA5, 0x54, 0xD1, 0x03, 0xD9, 0xFD, 0x68,
+    0xDC, 0x99, 0x01, 0x1B, 0x12, 0xD9, 0xB2, 0x40, 0x75, 0x5F, 0xC5, 0x35, 0xFA, 0xD9, 0x27, 0xAB,
+    0x2C, 0xB1, 0xD0, 0xD0, 0xB5, 0x55, 0xE8, 0x86, 0x22, 0x76, 0x53, 0x96, 0xAE, 0x2D, 0x34, 0xC9,
+    0xB7, 0x55, 0xB2, 0x43, 0x91, 0xCC, 0x94, 0x25, 0x96, 0x5C, 0xBD, 0x26, 0x8D, 0xCD, 0xB2, 0x85,
+    0x1B, 0x36, 0x6C, 0x75, 0x79, 0x03, 0xF0, 0xF9, 0x5F, 0xD2, 0xCF, 0xFD, 0xD3, 0xE5, 0x3B, 0x78,
+    0xAD, 0xEB, 0x54, 0xCC, 0x7C, 0x80, 0x91, 0x5A, 0x23, 0x8D, 0x26, 0x95, 0xDB, 0x35, 0xE6, 0xD9,
+    0xBD, 0x75, 0xE6, 0xCB, 0xF9, 0xC9, 0x49, 0xC3, 0x51, 0xA0, 0xFB, 0x1D, 0x5C, 0xA2, 0xD4, 0x2E,
+    0x84, 0x75, 0x1A, 0x8F, 0xEB, 0xBB, 0xBB, 0x78, 0x76, 0x3E, 0x47, 0xA7, 0xDE, 0xBD, 0x33, 0x97,
+    0xD1, 0x3F, 0x95, 0x6C, 0xEC, 0x4C, 0x72, 0x37, 0x96, 0x46, 0x72, 0x2B, 0x87, 0xB4, 0xF7, 0xF5,
+    0xEF, 0xE1, 0x57, 0xB5, 0xF9, 0x68, 0x52, 0x35, 0xDD, 0x93, 0x84, 0x99, 0x64, 0xD2, 0x2F, 0x26,
+    0x93, 0x9A, 0x68, 0x56, 0x7D, 0x78, 0x6D, 0x96, 0xFF, 0xAB, 0x35, 0x29, 0xAF, 0x8F, 0x82, 0xAC,
+    0x79, 0x5D, 0x5A, 0xEB, 0xD5, 0x43, 0x7D, 0x32, 0xD3, 0xBF, 0x5D, 0x4A, 0x69, 0x29, 0xF4, 0x6C,
+    0x2A, 0x47, 0x3B, 0xBA, 0xE0, 0xB6, 0x6B, 0x83, 0xD7, 0xA5, 0xC2, 0xB7, 0xAA, 0xBE, 0xFB, 0xB4,
+    0xF2, 0xD9, 0x8D, 0xA5, 0xD4, 0x3A, 0x25, 0xBA, 0x73, 0xDF, 0xCF, 0x13, 0x7D, 0x19, 0xC1, 0x0F,
+    0x14, 0x1A, 0xF9, 0xDC, 0xD5, 0x96, 0xD5, 0xBD, 0x9E, 0x01, 0xF3, 0xEA, 0x66, 0xF3, 0xBC, 0x97,
+    0x7E, 0x2A, 0xCD, 0x66, 0xDE, 0xD4, 0x3E, 0x60, 0x12, 0xFC, 0xBA, 0x97, 0x99, 0x5C, 0xCB, 0x1A,
+    0x01, 0xAD, 0x3F, 0x83, 0x81, 0x03, 0xEF, 0x25, 0x2F, 0x15, 0xD3, 0xDE, 0xFB, 0xD2, 0xBC, 0xC5,
+    0x84, 0x53, 0xF0, 0x0A, 0xFB, 0x9B, 0xCD, 0x81, 0xA4, 0x9F, 0x4A, 0x6A, 0xB5, 0xB9, 0x6E, 0x52,
+    0x36, 0xDA, 0x58, 0x04, 0x1F, 0x3E, 0x8D, 0xE0, 0x33, 0xCB, 0x01, 0x52, 0x9F, 0x35, 0x3F, 0xFA,
+    0xE5, 0x18, 0xAC, 0xC6, 0x69, 0x40, 0x6A, 0xB7, 0xD0, 0x61, 0x68, 0x9E, 0x9C, 0xAA, 0xE1, 0x74,
+    0x31, 0xD9, 0x6C, 0xA1, 0x50, 0xE2, 0xD9, 0xBB, 0xBF, 0x0C, 0x1D, 0xF6, 0x37, 0x9B, 0x03, 0x2B,
+    0xA5, 0x5C, 0x12, 0x76, 0xAC, 0x82, 0x49, 0x79, 0x44, 0x7C, 0xF3, 0xE8, 0xB7, 0x81, 0x8C, 0x34,
+    0x20, 0x09, 0xFF, 0xBA, 0xA2, 0x8D, 0xC5, 0x6C, 0x12, 0x5D, 0x10, 0x36, 0xFA, 0x60, 0x92, 0x1D,
+    0x91, 0x53, 0xF0, 0x2F, 0x28, 0x56, 0xC3, 0xAA, 0x23, 0x2D, 0xA6, 0x75, 0xA5, 0xA4, 0xD2, 0x9A,
+    0xEC, 0x5A, 0xB1, 0x4C, 0x2B, 0xCD, 0x34, 0xF5, 0x98, 0x25, 0x13, 0x8A, 0x08, 0xD5, 0x8F, 0x0E,
+    0x68, 0x34, 0x66, 0xEA, 0xC6, 0x22, 0x56, 0xB1, 0x0A, 0xAE, 0x6F, 0x68, 0xBE, 0xAD, 0x7A, 0xF1,
+    0x8B, 0x19, 0xB7, 0x2B, 0x35, 0xD7, 0xC9, 0xA9, 0x09, 0xB8, 0x04, 0x97, 0x6A, 0xF2, 0x76, 0x6F,
+    0x73, 0x70, 0xBC, 0xB5, 0xA3, 0x55, 0x74, 0x83, 0x4D, 0xA5, 0xDA, 0x26, 0xDA, 0x85, 0x05, 0x0D,
+    0x78, 0x96, 0x6C, 0x82, 0xAA, 0x5D, 0x4C, 0x84, 0x32, 0x2C, 0x65, 0x0F, 0x26, 0x2E, 0x36, 0xC0,
+    0xAA, 0x53, 0xA0, 0x90, 0x14, 0xC0, 0xC6, 0xA5, 0x1A, 0xC0, 0x0D, 0x8B, 0x1D, 0xA1, 0x09, 0x4B,
+    0x91, 0x40, 0xED, 0x62, 0x16, 0x72, 0xB1, 0x64, 0xAA, 0xCB, 0x19, 0xD5, 0x5D, 0xEF, 0x26, 0xAB,
+    0xE8, 0xC7, 0x66, 0xA8, 0x14, 0xED, 0xBC, 0x57, 0x03, 0xD9, 0xCC, 0x3D, 0x65, 0xD4, 0x76, 0x15,
+    0x30, 0x5C, 0x58, 0x5F, 0x76, 0xBF, 0xC8, 0xB4, 0x07, 0x64, 0x34, 0x46, 0x7D, 0x97, 0xAB, 0x5C,
+    0x8A, 0xF4, 0xE0, 0x52, 0x44, 0xFF, 0x1C, 0xA9, 0xBA, 0x39, 0xC2, 0xD4, 0xD8, 0x96, 0xFC, 0xEE,
+    0x9C, 0xC0, 0x4A, 0x23, 0x74, 0xE7, 0x7F, 0x18, 0x29, 0xA6, 0xC6, 0x0E, 0xF8, 0x1B, 0xC9, 0xF5,
+    0xF9, 0x52, 0x44, 0x1F, 0x5C, 0x6C, 0x62, 0x73, 0x43, 0x46, 0xA1, 0x0B, 0x07, 0x3B, 0xAC, 0xBB,
+    0x55, 0x64, 0x0D, 0xAB, 0x33, 0x03, 0x78, 0x80, 0xFF, 0x1F, 0xCD, 0xBB, 0x4F, 0x8C, 0x25, 0xC7,
+    0x9D, 0xE7, 0xF7, 0xC9, 0x8C, 0xAE, 0x4E, 0x99, 0x39, 0x52, 0x34, 0xB0, 0x5D, 0x9E, 0x11, 0x29,
+    0x2B, 0x07, 0x06, 0x0F, 0x9A, 0x19, 0x89, 0x39, 0x07, 0x1D, 0x74, 0xE8, 0xAA, 0x48, 0xB2, 0xD7,
+    0x20, 0x60, 0x1E, 0xBA, 0x3C, 0xEE, 0x37, 0x04, 0x86, 0xC0, 0x70, 0xBC, 0x58, 0x2C, 0x4C, 0x2D,
+    0xBC, 0x3D, 0xC0, 0xEA, 0x40, 0xC0, 0xDD, 0x9D, 0x49, 0x36, 0x60, 0xC2, 0xE0, 0x81, 0xF4, 0x7A,
+    0x65, 0x03, 0xDE, 0x83, 0x08, 0x98, 0x06, 0xA4, 0x47, 0xDB, 0x3D, 0x06, 0xB4, 0x0B, 0xAE, 0xA7,
+    0xBA, 0x32, 0x9A, 0x85, 0x45, 0x03, 0xD6, 0x41, 0x49, 0xB6, 0x08, 0x1E, 0x74, 0x60, 0x92, 0x5C,
+    0xAD, 0x06, 0xE4, 0x81, 0xD1, 0x64, 0x52, 0xCA, 0x6E, 0x46, 0xE6, 0xD7, 0x87, 0x7C, 0xD5, 0xDD,
+    0xD4, 0x88, 0x94, 0x34, 0x7F, 0x0C, 0xE7, 0xAB, 0xCC, 0x8A, 0x88, 0x97, 0x2F, 0xF2, 0x97, 0xF1,
+    0x8B, 0xF8, 0xFD, 0xFD, 0x06, 0x7F, 0xF0, 0x57, 0x14, 0x9A, 0x90, 0x26, 0x13, 0xF2, 0x68, 0x1B,
+    0x1B, 0x76, 0x70, 0xFE, 0x44, 0x32, 0x81, 0x0D, 0x38, 0x81, 0x04, 0x8F, 0x09, 0xCC, 0x04, 0xF9,
+    0x78, 0x8A, 0xF2, 0x9D, 0x88, 0xCE, 0x8C, 0x79, 0x2C, 0x25, 0x5F, 0x68, 0x24, 0xA9, 0x81, 0xF3,
+    0xF0, 0x47, 0x81, 0x54, 0x9E, 0x3C, 0x42, 0x02, 0x6C, 0x57, 0x89, 0xA6, 0x44, 0xEA, 0xA6, 0x7C,
+    0xFC, 0x1C, 0x33, 0xD4, 0x58, 0x55, 0x46, 0x3D, 0xFF, 0xF1, 0x9C, 0xE0, 0x0E, 0x3B, 0x7B, 0x63,
+    0xCA, 0x46, 0xA7, 0x98, 0x6A, 0x24, 0x0D, 0x70, 0x9E, 0xE3, 0x17, 0x49, 0x05, 0xBB, 0x15, 0xDB,
+    0xAB, 0xEA, 0x9E, 0x4A, 0x7A, 0x50, 0xA9, 0x06, 0x1B, 0x11, 0x6D, 0x30, 0xD1, 0x04, 0x6C, 0x28,
+    0x2B, 0x9C, 0x8F, 0xA0, 0xDC, 0x63, 0x24, 0xB0, 0x9A, 0xC0, 0x1D, 0x46, 0x50, 0x36, 0x62, 0xA2,
+    0x1D, 0xB0, 0xA1, 0x08, 0x38, 0xEF, 0x02, 0xAA, 0xEA, 0xBE, 0x94, 0x6F, 0x7B, 0x89, 0xB6, 0x07,
+    0x9C, 0x07, 0x0E, 0x80, 0x64, 0x00, 0x8C, 0x07, 0x2C, 0x9B, 0x63, 0xCF, 0xCD, 0x66, 0x70, 0x93,
+    0x1D, 0xB3, 0xA1, 0xFC, 0xAB, 0x6C, 0x70, 0x64, 0xC3, 0x3E, 0xD9, 0xAD, 0x91, 0x4C, 0x91, 0xEC,
+    0xA3, 0x99, 0x6C, 0x68, 0xAB, 0x6C, 0x70, 0x3E, 0x1B, 0xCA, 0xBE, 0x9C, 0xEC, 0xE8, 0x66, 0x33,
+    0x6F, 0xBA, 0xBB, 0xB0, 0x8C, 0x01, 0xA7, 0x80, 0x93, 0xDB, 0xAB, 0x2A, 0x7D, 0xDE, 0xA9, 0x2B,
+    0x42, 0xA9, 0xCA, 0x05, 0x13, 0xA9, 0x83, 0x89, 0x44, 0x4C, 0xFC, 0x8B, 0x11, 0x13, 0x3F, 0x08,
+    0x98, 0xF8, 0x61, 0x8F, 0x91, 0x3A, 0x8C, 0x14, 0x30, 0xF1, 0xE7, 0x23, 0x26, 0x7E, 0x18, 0x31,
+    0xF1, 0xC6, 0x8C, 0x89, 0xA8, 0x32, 0x91, 0xD6, 0x9B, 0x09, 0x17, 0x4A, 0xF9, 0x22, 0x3A, 0xF9,
+    0x6C, 0x02, 0xD8, 0x03, 0x4E, 0x58, 0x55, 0xB5, 0x91, 0x77, 0xBE, 0xF0, 0xE5, 0x5F, 0x64, 0x1F,
+    0xD8, 0x2A, 0x89, 0x6F, 0x78, 0xEA, 0xFF, 0xB6, 0xA3, 0x50, 0x24, 0xFB, 0xF0, 0x5C, 0x95, 0xC4,
+    0x37, 0x02, 0xF5, 0xEF, 0xCE, 0x14, 0xBE, 0xE8, 0xCA, 0x68, 0xA2, 0x15, 0xCE, 0x43, 0x52, 0x6D,
+    0x06, 0xB7, 0xBA, 0x3D, 0xB8, 0x75, 0xF8, 0x83, 0xF9, 0x52, 0x40, 0x2A, 0xFE, 0x76, 0x83, 0x7B,
+    0x92, 0xE3, 0x2F, 0x40, 0x1B, 0x96, 0x33, 0x5F, 0xCE, 0xAA, 0x55, 0x16, 0xCE, 0xDD, 0xB2, 0x43,
+    0x1E, 0xDC, 0x90, 0x87, 0x8B, 0xE4, 0x21, 0x92, 0xFF, 0x6C, 0x20, 0x57, 0x24, 0xBF, 0x31, 0x91,
+    0x07, 0x91, 0x87, 0xBA, 0xC9, 0x83, 0xEB, 0xEA, 0x68, 0x87, 0x36, 0x66, 0x11, 0xD8, 0xDB, 0x5E,
+    0xAD, 0xF8, 0xAF, 0x8D, 0x34, 0x14, 0xC1, 0x69, 0x32, 0x32, 0x83, 0x68, 0xC3, 0xAE, 0x0D, 0x85,
+    0x37, 0x9D, 0x4C, 0xE0, 0x98, 0x0D, 0x17, 0x01, 0x59, 0x0F, 0x56, 0x23, 0x20, 0x79, 0xB0, 0x41,
+    0x80, 0xF2, 0x01, 0x6C, 0x70, 0x1E, 0x94, 0x0A, 0x6C, 0xB0, 0x23, 0xA8, 0x6A, 0x3B, 0x5A, 0x19,
+    0x55, 0x56, 0xC1, 0x4E, 0x00, 0xC7, 0x00, 0x92, 0x4A, 0xEA, 0xDD, 0x25, 0xE9, 0xF4, 0x6C, 0x9F,
+    0x19, 0xCA, 0xBF, 0xDA, 0x29, 0xBA, 0x48, 0xA8, 0x1F, 0xF1, 0x3C, 0x38, 0x1F, 0x40, 0xA6, 0x08,
+    0xC5, 0x1B, 0x23, 0xD4, 0x8F, 0x0C, 0x24, 0x93, 0x0D, 0x64, 0x43, 0xD9, 0xD3, 0x0E, 0xAE, 0xCF,
+    0xD4, 0xBB, 0x0E, 0x38, 0xC9, 0xF6, 0xAA, 0x5A, 0xAD, 0x8C, 0x26, 0xAB, 0xB1, 0x54, 0xD3, 0xCE,
+    0x38, 0x4F, 0x5B, 0x99, 0x48, 0x3E, 0xFC, 0xF5, 0xA2, 0xA4, 0x01, 0x27, 0xA9, 0x32, 0xF3, 0xFA,
+    0xF2, 0xF0, 0x69, 0xF7, 0x76, 0xA8, 0x29, 0xD5, 0xB5, 0x3A, 0xD4, 0x64, 0x15, 0x01, 0x0A, 0x0F,
+    0x24, 0x11, 0xC0, 0x36, 0x00, 0x23, 0x40, 0x5E, 0x01, 0xE0, 0x66, 0xAB, 0x4B, 0xEA, 0x34, 0x64,
+    0x83, 0x89, 0xD4, 0x95, 0xF3, 0x4B, 0xE1, 0xDD, 0xD6, 0x67, 0x52, 0xA4, 0xFE, 0x76, 0xED, 0x3F,
+    0xF1, 0x55, 0xAA, 0xBE, 0x8D, 0x6E, 0xB6, 0xEA, 0x80, 0x08, 0x58, 0x0F, 0xEC, 0x03, 0x59, 0x03,
+    0xDC, 0xBF, 0xBD, 0xAA, 0x56, 0xAB, 0x95, 0xD5, 0xE0, 0xA4, 0x57, 0x34, 0xE6, 0x52, 0xB0, 0x81,
+    0xF2, 0xD5, 0x68, 0x22, 0xF9, 0xB0, 0x8B, 0x48, 0x27, 0xDB, 0x38, 0x4F, 0xFB, 0x60, 0x65, 0x03,
+    0x65, 0xC7, 0xF2, 0x6A, 0x48, 0x9A, 0xC0, 0xBD, 0xBB, 0x56, 0xC5, 0xE6, 0x8B, 0x48, 0x3E, 0x80,
+    0x48, 0x27, 0x96, 0x97, 0xC4, 0x0E, 0xB8, 0x9E, 0x52, 0x5D, 0xAB, 0xC6, 0x6A, 0x70, 0xEA, 0x71,
+    0xB3, 0xD5, 0xEC, 0x26, 0xAB, 0x39, 0x1B, 0x4C, 0xBC, 0x98, 0x0D, 0x26, 0xEE, 0x66, 0x83, 0x89,
+    0x3B, 0xD9, 0xFC, 0x52, 0x24, 0x93, 0x22, 0xD9, 0xCD, 0x47, 0x23, 0xD9, 0x60, 0xEE, 0xBE, 0x94,
+    0x73, 0xAE, 0xCA, 0xCD, 0x56, 0xCD, 0xF6, 0x6A, 0xB5, 0x3A, 0x0B, 0x92, 0x34, 0x90, 0x4A, 0x52,
+    0x03, 0xAA, 0x6C, 0x00, 0x13, 0x71, 0x1E, 0x6C, 0x40, 0x80, 0xF3, 0x26, 0x02, 0xC2, 0xDE, 0x38,
+    0x8B, 0x89, 0x38, 0xCD, 0xD8, 0x80, 0x24, 0x9C, 0x37, 0xD3, 0x63, 0x42, 0xD8, 0x90, 0x4D, 0x26,
+    0xE2, 0x7C, 0x3E, 0xDA, 0x80, 0x28, 0x7A, 0xE7, 0x4D, 0xC4, 0x79, 0x55, 0x76, 0x60, 0x2E, 0xF5,
+    0x8A, 0x62, 0x36, 0x4A, 0x56, 0xA1, 0xEC, 0x00, 0x10, 0x00, 0xF9, 0x00, 0x90, 0xB4, 0x0D, 0x90,
+    0x68, 0x04, 0x30, 0xF3, 0x91, 0xA0, 0x71, 0x92, 0x40, 0xD2, 0x08, 0x75, 0xD5, 0x42, 0x32, 0x25,
+    0x11, 0xB2, 0x21, 0x0B, 0x50, 0x74, 0xC5, 0xFB, 0x23, 0x75, 0x55, 0x2B, 0x26, 0x53, 0x32, 0x3F,
+    0x16, 0xB3, 0x21, 0x0B, 0x79, 0x28, 0xBA, 0xC2, 0x17, 0x5D, 0x5D, 0xD5, 0xB8, 0x67, 0xF5, 0xB0,
+    0xAA, 0xD9, 0xCD, 0xE5, 0x64, 0x46, 0x80, 0xA2, 0x03, 0x68, 0x01, 0x96, 0x86, 0xDA, 0x03, 0x65,
+    0x04, 0xD8, 0xAD, 0xE0, 0xF8, 0xCB, 0x40, 0x1D, 0x21, 0xD5, 0x83, 0x2F, 0x92, 0x8F, 0x56, 0x55,
+    0xD1, 0xBB, 0xB6, 0x73, 0x7E, 0xB6, 0xA1, 0x6E, 0xA6, 0x7C, 0x68, 0x1F, 0x8A, 0xD9, 0xA0, 0x87,
+    0x62, 0x36, 0xCA, 0x6C, 0x4A, 0x83, 0x1E, 0x9A, 0xF2, 0xD0, 0x3E, 0x35, 0xD9, 0xE0, 0xBC, 0x6C,
+    0x57, 0x86, 0xBA, 0x6E, 0xEC, 0x54, 0xCC, 0xA4, 0x92, 0x2E, 0x73, 0x4E, 0xED, 0x04, 0x7B, 0x54,
+    0x24, 0x15, 0x14, 0x23, 0xB8, 0xEE, 0x09, 0xCA, 0x57, 0xD4, 0x17, 0x57, 0xA7, 0x29, 0x0F, 0x53,
+    0x79, 0x38, 0xD6, 0x59, 0x98, 0x8B, 0xAB, 0xD1, 0x3D, 0x13, 0x6A, 0x1B, 0x62, 0xF9, 0x74, 0x2C,
+    0x9F, 0xF3, 0xEE, 0x50, 0x5D, 0x36, 0xEB, 0x3F, 0x34, 0xA5, 0xD4, 0x73, 0x72, 0xAB, 0xE2, 0xF8,
+    0x5C, 0xA5, 0x92, 0x77, 0x92, 0x99, 0x88, 0x65, 0x67, 0x82, 0xC8, 0x9F, 0x19, 0xA0, 0xEC, 0x40,
+    0x60, 0x22, 0xD8, 0x01, 0x5C, 0x0F, 0xAD, 0x27, 0x51, 0x85, 0x51, 0x93, 0x3C, 0x2C, 0x4D, 0x99,
+    0x14, 0x52, 0xCD, 0x50, 0x2E, 0xE2, 0xF7, 0x1F, 0x2D, 0x2A, 0x28, 0xDB, 0xA8, 0xA0, 0xAD, 0x8A,
+    0x52, 0x38, 0xF5, 0xEE, 0x7A, 0x2C, 0xBA, 0xDA, 0x86, 0x2F, 0x98, 0x08, 0x02, 0xE7, 0xB1, 0x03,
+    0xA9, 0xA0, 0xBE, 0xF5, 0xBF, 0xE7, 0x12, 0xB5, 0x2A, 0xF6, 0xA1, 0x20, 0xF9, 0x4E, 0x43, 0xEB,
+    0xB1, 0xCF, 0xB3, 0xBD, 0x5A, 0xAD, 0x4E, 0x4B, 0x8A, 0x4E, 0xD2, 0xE1, 0x50, 0x5F, 0x8D, 0xBB,
+    0x26, 0xDA, 0xC3, 0xCE, 0xF9, 0xF1, 0x98, 0x89, 0x5B, 0x8B, 0x2A, 0x31, 0x91, 0xCF, 0x2C, 0xD4,
+    0x1D, 0xD4, 0xEA, 0xC9, 0x35, 0x03, 0xB6, 0x07, 0x26, 0x20, 0xF7, 0x1B, 0x75, 0x61, 0xFC, 0xD1,
+    0x84, 0x18, 0x25, 0xBD, 0xF3, 0xD6, 0x5C, 0x3C, 0x77, 0x7A, 0xDC, 0xD9, 0xB1, 0x7D, 0x38, 0xE1,
+    0x9E, 0x82, 0x79, 0xE1, 0xA8, 0xED, 0xC1, 0x35, 0x30, 0x43, 0x29, 0x9F, 0x48, 0x90, 0x46, 0xC8,
+    0x7A, 0xB0, 0x15, 0xEC, 0x00, 0xBF, 0xCB, 0xF6, 0x2A, 0x59, 0x3D, 0xA2, 0xB1, 0x9E, 0xEB, 0x39,
+    0x55, 0xD3, 0x7A, 0xDB, 0x9B, 0x29, 0x89, 0x14, 0xC1, 0x55, 0xE8, 0xE1, 0x1E, 0x13, 0x23, 0x94,
+    0xEF, 0x37, 0xA0, 0x00, 0xD9, 0xF4, 0xCB, 0x09, 0xEF, 0xC0, 0xA9, 0x27, 0xD3, 0x4C, 0x2D, 0x2B,
+    0xAB, 0xA7, 0xD5, 0xA8, 0x2A, 0x9B, 0x22, 0x58, 0x6F, 0x62, 0x16, 0x68, 0x4F, 0x0F, 0xD8, 0x3E,
+    0x92, 0xC6, 0x2B, 0x50, 0xD7, 0x60, 0xD5, 0x90, 0xC8, 0x2F, 0xFC, 0xC9, 0xC3, 0x46, 0x34, 0xD5,
+    0x1B, 0x41, 0x95, 0x0F, 0xCB, 0x1D, 0xE9, 0xFA, 0xF9, 0x4F, 0xA5, 0xB0, 0x2F, 0x2B, 0x64, 0x7A,
+    0xCC, 0xB8, 0x0F, 0xE5, 0x9B, 0x1B, 0x0A, 0x2F, 0xEB, 0x45, 0x0A, 0xA9, 0xC1, 0x4C, 0xBF, 0x1E,
+    0x85, 0xBD, 0xF5, 0x26, 0x66, 0x3D, 0xED, 0x43, 0x47, 0x14, 0x5E, 0x00, 0xE7, 0xC0, 0xBE, 0x5F,
+    0x91, 0xC8, 0x93, 0xD4, 0x1F, 0x91, 0x48, 0x9E, 0xF4, 0xD3, 0x29, 0xAC, 0x56, 0x7B, 0x4E, 0xAF,
+    0x69, 0x28, 0xF5, 0x54, 0xDB, 0x1B, 0xD1, 0x82, 0x9E, 0x8A, 0x50, 0x1F, 0x0E, 0x50, 0xAA, 0x87,
+    0x5C, 0x0D, 0x18, 0x01, 0xA9, 0x2A, 0xC8, 0xE5, 0xA1, 0x78, 0xBF, 0x07, 0x77, 0x66, 0x84, 0x39,
+    0x9B, 0x48, 0x63, 0x2A, 0xF2, 0x01, 0xF9, 0x5A, 0x99, 0x62, 0xAB, 0x5C, 0x91, 0x85, 0x65, 0x1B,
+    0xB9, 0x3D, 0x02, 0x0C, 0x00, 0xDF, 0x5F, 0xF8, 0x3F, 0xB9, 0xE8, 0xC6, 0x62, 0xC8, 0x62, 0xE1,
+    0xD3, 0xD9, 0x41, 0x1B, 0xA1, 0x1C, 0xC0, 0x06, 0x70, 0x23, 0x1C, 0xCC, 0xA4, 0x63, 0x5B, 0xE5,
+    0xC1, 0x75, 0x6E, 0xA8, 0xA7, 0x76, 0xD4, 0xB4, 0x99, 0x4A, 0x71, 0x23, 0xAD, 0x9F, 0x5C, 0x0C,
+    0x8F, 0xD5, 0x83, 0xAB, 0x4A, 0x52, 0xA9, 0x4B, 0x52, 0xAC, 0x47, 0x6B, 0x6F, 0x84, 0xBA, 0x39,
+    0xE5, 0xAE, 0x5D, 0x9D, 0x79, 0x41, 0x9F, 0xCF, 0x46, 0x4C, 0xA4, 0xE8, 0xB1, 0x81, 0xBA, 0xC1,
+    0xF9, 0x64, 0x06, 0xF1, 0x2B, 0x9B, 0x6F, 0xAE, 0xDA, 0xCE, 0x48, 0xD2, 0x50, 0x48, 0x52, 0x0F,
+    0xE0, 0x2A, 0x36, 0x8F, 0xC7, 0x04, 0x8E, 0x26, 0x35, 0x5F, 0x38, 0x12, 0x71, 0x53, 0x1D, 0x9D,
+    0xA6, 0x7A, 0x38, 0x55, 0x7F, 0xAD, 0xF0, 0xA7, 0xEA, 0xAF, 0x16, 0xFE, 0x2B, 0xF5, 0xEF, 0x14,
+    0x9E, 0x9A, 0x4F, 0xBB, 0x54, 0x65, 0x97, 0x4A, 0x9A, 0x8C, 0xA4, 0x19, 0x60, 0x06, 0xB8, 0xC2,
+    0x66, 0xAD, 0x70, 0x8A, 0xE5, 0x1D, 0x93, 0xD5, 0x5E, 0xAB, 0xE7, 0x34, 0xD4, 0x73, 0xA6, 0x3E,
+    0x1B, 0x17, 0x4A, 0x8F, 0x2E, 0x11, 0x61, 0x22, 0xC2, 0xCC, 0x88, 0x54, 0x12, 0xB4, 0x12, 0xDC,
+    0xFB, 0xA2, 0x6E, 0x8B, 0xE7, 0xBB, 0x2E, 0x15, 0xE4, 0x8A, 0x60, 0x3F, 0x9D, 0x47, 0x7F, 0x01,
+    0x40, 0x1B, 0xDB, 0xD8, 0x8E, 0xF5, 0x68, 0x43, 0xD1, 0xDD, 0x7D, 0x66, 0x52, 0x97, 0x4A, 0x1D,
+    0xDB, 0xE7, 0xBA, 0x45, 0x16, 0x17, 0x1D, 0x89, 0xE6, 0xC5, 0x80, 0xE2, 0x00, 0xB8, 0xC8, 0xB2,
+    0x48, 0x4F, 0x01, 0xBF, 0xB3, 0xBD, 0x4A, 0x56, 0x7F, 0xA4, 0xD9, 0xE9, 0x0D, 0xF5, 0xF5, 0x9C,
+    0xCC, 0x38, 0x9F, 0x8D, 0x88, 0xA2, 0x37, 0x91, 0xFA, 0xAA, 0x0D, 0xE8, 0xF3, 0xCE, 0x9B, 0xF9,
+    0x5B, 0x22, 0x97, 0x22, 0xB9, 0x14, 0x38, 0x7E, 0x50, 0x7B, 0xF8, 0xBA, 0x80, 0xEB, 0x91, 0x65,
+    0x5E, 0xE0, 0x3A, 0xC8, 0x35, 0x80, 0x53, 0xD7, 0xC6, 0x7A, 0x6A, 0x47, 0x17, 0x6D, 0xB0, 0xBD,
+    0x0D, 0xB6, 0xB7, 0x37, 0xCE, 0xF4, 0xF6, 0x83, 0xE7, 0xFA, 0x4C, 0xEA, 0x53, 0xA9, 0xE7, 0xB7,
+    0x7F, 0xD8, 0x93, 0x3E, 0xD7, 0x2F, 0xC2, 0xA4, 0x9D, 0x48, 0x34, 0x6D, 0xAF, 0x2A, 0x70, 0xEA,
+    0xA0, 0x54, 0xB3, 0x59, 0x5E, 0xBF, 0x78, 0x99, 0xDB, 0x01, 0x23, 0xCD, 0x18, 0xBD, 0xB4, 0x0C,
+    0x6C, 0x63, 0x22, 0xF5, 0x5F, 0xBB, 0x4C, 0xD4, 0xBE, 0xD4, 0xA1, 0xA2, 0xD3, 0x35, 0x45, 0x4E,
+    0xC0, 0x7D, 0x13, 0x58, 0x55, 0x8B, 0x0C, 0xCC, 0x07, 0x48, 0x27, 0xA0, 0x4D, 0xF6, 0x28, 0x7F,
+    0x2C, 0x72, 0x29, 0xA4, 0x7A, 0x3F, 0xD2, 0x36, 0x6D, 0x55, 0x76, 0x45, 0x97, 0x0F, 0xD9, 0x90,
+    0x4E, 0xC9, 0x44, 0x5B, 0xD5, 0x9F, 0x68, 0x48, 0xF5, 0xAA, 0x6E, 0x68, 0x54, 0x84, 0xE3, 0x73,
+    0x05, 0x85, 0x46, 0x28, 0x25, 0x4F, 0xD1, 0xE7, 0xC3, 0x97, 0x6D, 0x40, 0xF6, 0x91, 0x81, 0xF2,
+    0xDA, 0xF5, 0x48, 0xFE, 0xC1, 0xA4, 0xD5, 0x1F, 0xC7, 0x5A, 0x92, 0x32, 0x49, 0xF2, 0x59, 0xBC,
+    0xCD, 0x6A, 0xD7, 0x01, 0x79, 0x04, 0x12, 0x75, 0x9C, 0xA0, 0xD4, 0xE5, 0x91, 0x54, 0x9A, 0xA0,
+    0xD0, 0x04, 0x6C, 0x57, 0xC0, 0x36, 0xA4, 0xEA, 0xB1, 0x8A, 0x5F, 0x72, 0x4F, 0x4F, 0xE7, 0x6B,
+    0xE6, 0xFD, 0x16, 0xD5, 0xD2, 0x5C, 0x4A, 0x33, 0xDA, 0xF4, 0xD6, 0x56, 0x50, 0xDF, 0xFC, 0x6F,
+    0x28, 0x35, 0x91, 0x69, 0x80, 0x6D, 0xFE, 0x5E, 0xE8, 0x33, 0x1B, 0xFA, 0x6E, 0x02, 0xA5, 0x67,
+    0x11, 0xFA, 0x24, 0x23, 0x9B, 0x29, 0x75, 0xC7, 0x7B, 0xF9, 0x9B, 0x50, 0x9E, 0x6B, 0x58, 0x04,
+    0xA1, 0xDB, 0x9C, 0x0F, 0x00, 0xFF, 0x09, 0xDB, 0xAB, 0xD3, 0x9A, 0x4A, 0x35, 0x1B, 0x53, 0xE7,
+    0xD3, 0x2E, 0x5D, 0xA9, 0xEB, 0x9A, 0xE0, 0x0B, 0xBC, 0x00, 0x50, 0x26, 0x03, 0x40, 0xF1, 0xC6,
+    0x22, 0x0D, 0xB4, 0x98, 0x43, 0xAB, 0xDB, 0xF4, 0x91, 0x36, 0x5B, 0xAB, 0xBD, 0xE3, 0x8D, 0x1D,
+    0xAC, 0x42, 0xD9, 0xDB, 0x98, 0xAB, 0xA9, 0x83, 0x9D, 0x99, 0x51, 0x8F, 0x63, 0x4E, 0x46, 0x28,
+    0x9A, 0xD9, 0x04, 0xC8, 0xFD, 0x9C, 0x77, 0x60, 0xC2, 0x6C, 0x3D, 0xA4, 0x92, 0x2A, 0xC8, 0xB4,
+    0xB1, 0xEF, 0xE7, 0xA2, 0x87, 0xB2, 0x9F, 0xED, 0x00, 0xB5, 0x9F, 0xB3, 0x08, 0x6A, 0x66, 0x33,
+    0x93, 0x8A, 0x39, 0x51, 0x95, 0x4F, 0xA8, 0x6A, 0xBB, 0x72, 0xB4, 0x0A, 0x6E, 0xA8, 0xFB, 0x42,
+    0xC1, 0xC6, 0xAD, 0x0A, 0x48, 0xF6, 0x36, 0xB4, 0xD8, 0x66, 0x00, 0x5C, 0xD6, 0x03, 0x73, 0x0B,
+    0xD0, 0x0E, 0xB7, 0xFD, 0x40, 0xE0, 0x44, 0x16, 0xDC, 0x94, 0x87, 0x32, 0xB4, 0x7D, 0xED, 0x2F,
+    0xF7, 0xB5, 0xF9, 0x18, 0x7B, 0x35, 0x96, 0x15, 0xF6, 0x99, 0x30, 0x42, 0x79, 0xF9, 0x4D, 0x0F,
+    0x92, 0x2A, 0xF2, 0x9F, 0xC5, 0x16, 0xEA, 0x67, 0xC2, 0x8C, 0x89, 0xC5, 0x2B, 0x13, 0x65, 0x5F,
+    0x9B, 0x98, 0x2A, 0x53, 0x16, 0x8B, 0xE0, 0x62, 0x1E, 0xB7, 0x80, 0x84, 0xED, 0x55, 0x75, 0xCF,
+    0x69, 0x4D, 0x66, 0x2A, 0x55, 0xA9, 0x73, 0xBE, 0x9C, 0x4C, 0xCC, 0x02, 0xCE, 0x47, 0x4C, 0x2C,
+    0x2B, 0xDC, 0x1B, 0x01, 0xB3, 0x71, 0x0A, 0x3A, 0x33, 0x65, 0xC2, 0x79, 0x3B, 0x9A, 0x88, 0xF3,
+    0xCE, 0x9B, 0xB8, 0x14, 0x3A, 0x13, 0x4B, 0x79, 0x77, 0xA8, 0x68, 0xC6, 0x0D, 0x2F, 0x8B, 0xB0,
+    0xCC, 0x1A, 0xA7, 0x8D, 0x46, 0xDA, 0xBC, 0x84, 0x46, 0x7B, 0x5D, 0x9D, 0x9E, 0x9A, 0xF2, 0x5B,
+    0xD9, 0xE0, 0x28, 0x5E, 0x0B, 0xD4, 0x6D, 0x97, 0x48, 0x7D, 0x76, 0xB3, 0xEE, 0x8B, 0xCE, 0xF9,
+    0xBA, 0xAA, 0x9F, 0x9A, 0x98, 0xCB, 0xC9, 0x8C, 0x1A, 0x6D, 0x0F, 0xAE, 0x22, 0x89, 0x8B, 0x84,
+    0xD0, 0xE2, 0xC3, 0xFD, 0x5B, 0x58, 0xAD, 0x56, 0x7B, 0x99, 0xA4, 0xCE, 0x4A, 0x33, 0x26, 0x38,
+    0x8F, 0xF5, 0x02, 0x67, 0x22, 0x8C, 0x36, 0x60, 0x7A, 0xE7, 0x29, 0x2A, 0xC1, 0x05, 0x13, 0x49,
+    0x83, 0x0D, 0x58, 0xEF, 0x3C, 0xBB, 0x88, 0x74, 0x30, 0x31, 0xB5, 0xDE, 0x86, 0x62, 0xC6, 0x75,
+    0x6D, 0xB0, 0xBA, 0x39, 0x53, 0xAB, 0xAF, 0x96, 0x69, 0x97, 0x8E, 0x47, 0x0E, 0xC7, 0x0E, 0x40,
+    0x0F, 0x40, 0x26, 0xC5, 0x4C, 0x1A, 0xB9, 0x50, 0x74, 0x9C, 0xDF, 0x9C, 0xFB, 0x45, 0xC7, 0xCB,
+    0x45, 0xC7, 0x58, 0x74, 0x0C, 0x45, 0xF7, 0x9F, 0x86, 0xA2, 0xAB, 0xFB, 0xA2, 0x6F, 0xBD, 0xE6,
+    0xFA, 0x21, 0xCD, 0x27, 0x21, 0x2E, 0xCB, 0x22, 0x09, 0x90, 0xF6, 0x40, 0xB3, 0xBD, 0xAA, 0x36,
+    0x8E, 0xCB, 0xDB, 0x1A, 0x73, 0xF5, 0x36, 0x50, 0x76, 0x8B, 0x0F, 0x22, 0xD2, 0x69, 0xF1, 0x40,
+    0x96, 0x46, 0x49, 0xC3, 0xE2, 0xB0, 0xB8, 0x77, 0xD7, 0xAA, 0x7E, 0xF9, 0x9D, 0x03, 0x65, 0x57,
+    0xAA, 0xCB, 0x07, 0xAB, 0xC1, 0xDC, 0x59, 0xB6, 0x75, 0x03, 0xB4, 0x1E, 0xAC, 0x3C, 0x24, 0x6A,
+    0x8E, 0x14, 0x60, 0xA1, 0xE7, 0x74, 0x5A, 0x5D, 0xDD, 0x38, 0x5F, 0xF4, 0x36, 0x64, 0xA3, 0x89,
+    0x89, 0x24, 0x6A, 0xC9, 0x17, 0x1F, 0x3D, 0xBE, 0x34, 0xCC, 0x88, 0xBA, 0x71, 0xBE, 0x1D, 0x6D,
+    0x70, 0x32, 0x71, 0xA3, 0xF5, 0xEA, 0x6A, 0x59, 0xEE, 0x65, 0x4F, 0xA2, 0x1E, 0xCA, 0xC5, 0x36,
+    0xF9, 0xBB, 0x7D, 0x1D, 0xD7, 0x97, 0xEA, 0x5A, 0xFD, 0x50, 0x83, 0x53, 0x00, 0xB2, 0xE1, 0x48,
+    0x03, 0x2E, 0x6A, 0x7D, 0xF7, 0x2E, 0xF9, 0xF2, 0x37, 0xF7, 0x2B, 0xFD, 0xC6, 0x2B, 0x71, 0x80,
+    0xE9, 0x37, 0x5A, 0x30, 0xA9, 0x3E, 0x5B, 0x0D, 0x7A, 0x1B, 0x10, 0xCE, 0x9B, 0x99, 0x4F, 0xA8,
+    0xC1, 0xEF, 0x39, 0xBF, 0x19, 0x77, 0xF3, 0x09, 0x35, 0x68, 0x35, 0x40, 0xAB, 0x6E, 0x21, 0x3F,
+    0x0B, 0x40, 0xD1, 0x1C, 0x4D, 0xAB, 0x45, 0x7F, 0xFF, 0xA6, 0x0A, 0x3C, 0x62, 0x14, 0x31, 0x03,
+    0xA4, 0x61, 0x39, 0x93, 0x00, 0xEC, 0x91, 0xAC, 0xAA, 0x64, 0xB5, 0x67, 0xE5, 0x8D, 0x42, 0xA6,
+    0x2E, 0x53, 0x87, 0xFA, 0x5C, 0xA0, 0x60, 0x45, 0xF2, 0xF1, 0x50, 0xB4, 0x55, 0xF2, 0xF3, 0xB1,
+    0x74, 0x55, 0xFA, 0xB3, 0xB8, 0xEB, 0xAA, 0xF4, 0x46, 0xDC, 0x71, 0x4D, 0x1A, 0xA6, 0xF3, 0xAE,
+    0x31, 0xA1, 0x1D, 0x5D, 0x63, 0x42, 0x3D, 0x38, 0x6F, 0x82, 0x0B, 0xA5, 0x37, 0xA1, 0xEC, 0x4B,
+    0x9F, 0x05, 0xDB, 0x95, 0x3E, 0xEB, 0xAD, 0x2F, 0x3B, 0x37, 0x1F, 0xAF, 0x34, 0xD5, 0x22, 0xD1,
+    0xC4, 0x6D, 0x8E, 0x98, 0xE1, 0x8E, 0xA5, 0x95, 0x79, 0x8E, 0xFC, 0x73, 0xC0, 0x45, 0xDC, 0x58,
+    0x4E, 0xB4, 0x43, 0x26, 0xE4, 0x33, 0x3D, 0x24, 0x9F, 0xBD, 0x7F, 0xE9, 0x7D, 0x9F, 0xBD, 0xF9,
+    0x83, 0xEF, 0xF8, 0xEC, 0x8D, 0xF7, 0x1F, 0xF7, 0xD9, 0x75, 0x15, 0x3E, 0x7B, 0x6D, 0x2A, 0x7C,
+    0xD6, 0xC5, 0xC2, 0x67, 0xDD, 0xF7, 0x0B, 0x5F, 0x8C, 0xB4, 0xD1, 0xC5, 0x64, 0xB1, 0x7B, 0xC6,
+    0xA3, 0xCE, 0x4D, 0x7F, 0xE4, 0x96, 0x24, 0x15, 0x94, 0xBA, 0xA6, 0xBE, 0xF4, 0x79, 0x48, 0x23,
+    0x2D, 0x9F, 0x56, 0xC8, 0xF4, 0x81, 0x22, 0x5F, 0x49, 0x3B, 0xD8, 0x35, 0x01, 0xDC, 0x63, 0x3D,
+    0x14, 0xF2, 0x90, 0x9C, 0xBD, 0x2D, 0xFD, 0xEF, 0x3D, 0x5A, 0x31, 0x89, 0x2A, 0x30, 0xF2, 0x9B,
+    0x4B, 0xFE, 0x66, 0x07, 0xF6, 0xB9, 0x00, 0xE5, 0x99, 0x00, 0x2E, 0x1B, 0xE1, 0xA2, 0x89, 0x30,
+    0x3D, 0x3A, 0x81, 0xB4, 0x38, 0x9C, 0x98, 0x80, 0xAA, 0xAC, 0xA7, 0xF6, 0xB6, 0xC3, 0x75, 0x6D,
+    0x4C, 0x15, 0x35, 0x19, 0x45, 0x20, 0x09, 0x25, 0xE5, 0xE9, 0xC0, 0xDC, 0x92, 0x6D, 0xD6, 0xDF,
+    0x36, 0xD4, 0x33, 0xA5, 0x86, 0x6C, 0xA8, 0x7D, 0x6D, 0x22, 0x7B, 0xCE, 0xF3, 0xDB, 0x91, 0x56,
+    0xDE, 0x7D, 0x1C, 0xF3, 0xE0, 0xBC, 0x4C, 0xB4, 0x1F, 0xB5, 0x5D, 0x2B, 0xBD, 0xA2, 0xE7, 0x86,
+    0xA4, 0x3A, 0x79, 0xE4, 0x9C, 0x67, 0x3D, 0xD4, 0x67, 0x02, 0xB8, 0x33, 0x01, 0xB6, 0x93, 0xEA,
+    0xFF, 0x8B, 0x37, 0x18, 0x1D, 0xE5, 0xB5, 0x21, 0x8D, 0x35, 0x09, 0xD5, 0xDF, 0xE2, 0x0D, 0x96,
+    0xD8, 0x87, 0x93, 0xE4, 0x39, 0x2E, 0x29, 0x80, 0xD3, 0x56, 0x04, 0x57, 0xFB, 0x12, 0x8A, 0xE7,
+    0x42, 0x0A, 0xF6, 0x30, 0x02, 0x79, 0x2F, 0xC0, 0x04, 0xA7, 0x81, 0x74, 0xB0, 0x8A, 0x30, 0x3D,
+    0x3A, 0xAF, 0x41, 0x12, 0x50, 0x4B, 0x7E, 0x0B, 0x87, 0x0D, 0xA6, 0x2B, 0x1B, 0x13, 0x93, 0xC1,
+    0x76, 0x89, 0xD6, 0x53, 0x29, 0x23, 0xC9, 0xEA, 0xAA, 0x24, 0xCF, 0x36, 0x27, 0x29, 0x54, 0x28,
+    0x95, 0xA4, 0xE2, 0x55, 0x3D, 0x3D, 0xD5, 0x26, 0x9A, 0xF1, 0xAC, 0xED, 0x8B, 0x90, 0xB4, 0xD2,
+    0x2B, 0x92, 0xBE, 0xE7, 0x7E, 0x3A, 0x92, 0xC6, 0x3C, 0x60, 0x43, 0xD1, 0xE3, 0x5E, 0xD7, 0xCD,
+    0xFF, 0xB3, 0x95, 0x34, 0xB4, 0x63, 0xA9, 0xEA, 0x24, 0x5B, 0x15, 0xBC, 0x70, 0x0F, 0xC9, 0x60,
+    0x1B, 0xA6, 0xBA, 0xA2, 0x9E, 0x61, 0x6B, 0x51, 0xD4, 0xDB, 0xAB, 0xD5, 0x59, 0x27, 0xC5, 0x52,
+    0x8A, 0x66, 0x4A, 0xA2, 0x89, 0x9C, 0x37, 0x91, 0xAF, 0x9B, 0xB8, 0x48, 0x00, 0x23, 0x79, 0x23,
+    0x79, 0x33, 0xAF, 0xAB, 0x4D, 0xDB, 0x09, 0x13, 0x39, 0x65, 0x22, 0xFB, 0x66, 0x5E, 0xC7, 0x72,
+    0xF1, 0xDF, 0x17, 0x5B, 0xDE, 0x56, 0x2E, 0xEB, 0xEC, 0x7B, 0xE1, 0x48, 0xD5, 0x9F, 0x25, 0x55,
+    0x6F, 0x24, 0x33, 0x96, 0xAF, 0x46, 0x33, 0xCE, 0xCC, 0x4E, 0x7A, 0x4E, 0x7A, 0x67, 0x5C, 0x82,
+    0x04, 0x1D, 0xD9, 0xFC, 0x3F, 0x75, 0xD2, 0x90, 0x6B, 0x60, 0xAB, 0x82, 0xCB, 0x2F, 0x62, 0x25,
+    0x9C, 0xE4, 0xDB, 0xAA, 0x0E, 0xDF, 0xC2, 0x0E, 0x90, 0x1D, 0x91, 0x32, 0xAD, 0x56, 0x8F, 0x4E,
+    0x92, 0x96, 0x13, 0x13, 0x97, 0x33, 0x1F, 0xDB, 0xCA, 0x06, 0xF7, 0x93, 0xB6, 0x2B, 0xA4, 0xCA,
+    0x68, 0x5C, 0x0C, 0xCD, 0x6D, 0x36, 0xE1, 0xF1, 0x9B, 0xF7, 0xC5, 0x93, 0xB4, 0x15, 0xB6, 0x5F,
+    0x3D, 0x3A, 0x4A, 0xB3, 0x93, 0x9E, 0xEB, 0xED, 0xF5, 0x31, 0x0B, 0xED, 0xC3, 0xA3, 0xD5, 0x98,
+    0x68, 0x60, 0x33, 0x07, 0x4D, 0xB8, 0x48, 0x36, 0x0A, 0x33, 0xB4, 0xB0, 0xB7, 0x99, 0xB0, 0x7F,
+    0x97, 0x44, 0x41, 0x3A, 0x5C, 0x60, 0x76, 0xDE, 0x3D, 0xD2, 0x6F, 0xE6, 0x61, 0xB2, 0x47, 0xA1,
+    0xAE, 0xD0, 0x64, 0xFF, 0x87, 0xF6, 0x6A, 0x95, 0x0F, 0x30, 0x6F, 0xAD, 0xEA, 0xE7, 0xA4, 0x77,
+    0xA4, 0x71, 0x66, 0x72, 0x4D, 0x9D, 0x0F, 0x75, 0x23, 0x35, 0x85, 0x2A, 0x4E, 0xDE, 0xB1, 0xF6,
+    0x28, 0x2E, 0x05, 0x00, 0x77, 0x6D, 0x04, 0x28, 0x0F, 0x07, 0x80, 0xAD, 0xDB, 0x16, 0xD8, 0xFF,
+    0xBF, 0xEC, 0xC1, 0xFC, 0x95, 0x01, 0xA8, 0xCF, 0xF4, 0x40, 0x74, 0x15, 0x50, 0x9D, 0xF8, 0xFB,
+    0xB5, 0x07, 0x01, 0xEC, 0xD5, 0x91, 0xFA, 0x4C, 0x60, 0x72, 0x3E, 0xD9, 0xF0, 0x33, 0x3D, 0x68,
+    0x92, 0xC5, 0xD8, 0xEA, 0x1C, 0xAD, 0x1F, 0x91, 0xE9, 0x4C, 0x4C, 0x28, 0x3A, 0x10, 0x46, 0x01,
+    0xAB, 0xC0, 0x56, 0x1B, 0x16, 0xC5, 0xD7, 0x5E, 0xF2, 0xE9, 0xEC, 0xBC, 0x1D, 0xD4, 0xB4, 0xAF,
+    0x48, 0x31, 0x91, 0x9A, 0x4F, 0x65, 0xE5, 0xD9, 0x23, 0x56, 0x76, 0x6D, 0xD3, 0xD8, 0x9E, 0x2C,
+    0xA0, 0x01, 0x37, 0x93, 0x9C, 0xEB, 0x4F, 0x98, 0xB8, 0x83, 0x8A, 0xAE, 0xBE, 0x24, 0xF9, 0x52,
+    0x0D, 0x27, 0x61, 0x6B, 0xB5, 0x4A, 0x97, 0xC5, 0xF7, 0xDA, 0x60, 0xA2, 0xA3, 0x4D, 0xFA, 0xD2,
+    0x93, 0x05, 0x92, 0x08, 0x6E, 0xC2, 0x68, 0x20, 0x69, 0x3D, 0xE9, 0x04, 0x45, 0x5F, 0x25, 0xD3,
+    0x0E, 0xE5, 0x1B, 0xD3, 0x63, 0xD1, 0x49, 0xB4, 0x6A, 0x58, 0x55, 0x94, 0xD2, 0x19, 0xE9, 0x9D,
+    0x5B, 0x97, 0x43, 0xC8, 0xC3, 0x57, 0xB3, 0x40, 0x16, 0x30, 0x01, 0x33, 0x81, 0x46, 0x4A, 0x35,
+    0x14, 0x03, 0xC9, 0x0C, 0xAE, 0xA1, 0xB8, 0xEE, 0xF3, 0x1B, 0x63, 0x16, 0x6B, 0xC5, 0x4C, 0x91,
+    0x7B, 0x5F, 0x80, 0x64, 0xB5, 0x07, 0x89, 0x66, 0xA0, 0x3E, 0xB2, 0xAC, 0x00, 0xD8, 0x5A, 0xED,
+    0x6D, 0xAF, 0x4E, 0x6B, 0xB2, 0x1A, 0xDA, 0x29, 0xD5, 0x68, 0xE2, 0x12, 0xD5, 0x5D, 0x9C, 0x13,
+    0x61, 0x83, 0x91, 0x37, 0xD1, 0x28, 0xA0, 0xEC, 0xC3, 0x88, 0xBB, 0x16, 0x84, 0xFD, 0x79, 0x70,
+    0xDE, 0x28, 0xD8, 0x80, 0x82, 0x89, 0xB8, 0x80, 0xB0, 0x01, 0xE7, 0xCD, 0x84, 0x1D, 0x72, 0x0D,
+    0xA5, 0xAE, 0x6B, 0xB2, 0x1A, 0xA8, 0xE5, 0x29, 0x15, 0x16, 0x02, 0x8E, 0x7C, 0x06, 0x5D, 0xD2,
+    0x75, 0x75, 0x0A, 0x45, 0x67, 0xFB, 0x6C, 0xC8, 0xC7, 0x64, 0xCA, 0x67, 0xEA, 0x47, 0xD4, 0x14,
+    0x3F, 0xFE, 0x61, 0x9F, 0xE9, 0x70, 0x4C, 0xE4, 0x67, 0x6A, 0xEF, 0x9A, 0xA2, 0xB3, 0x7D, 0x39,
+    0xE5, 0x3A, 0xA3, 0x4B, 0x1B, 0x3F, 0x88, 0x74, 0x70, 0x80, 0xCA, 0x0E, 0xDC, 0x33, 0x01, 0x92,
+    0x6A, 0xD3, 0x73, 0xB2, 0x3A, 0xBB, 0xB5, 0xDA, 0x93, 0x4E, 0x6B, 0x2A, 0x55, 0xB5, 0xF3, 0xD1,
+    0x5B, 0x2C, 0xB4, 0xC9, 0x9B, 0x88, 0x02, 0x42, 0x11, 0x77, 0x35, 0x0A, 0x7B, 0x23, 0x3A, 0x6F,
+    0xA6, 0x68, 0x03, 0x8A, 0x26, 0xE2, 0x22, 0xC2, 0x6E, 0x9C, 0x32, 0x1B, 0x50, 0x65, 0xA6, 0x54,
+    0x53, 0xAE, 0x41, 0x3A, 0xBD, 0x98, 0x10, 0x14, 0x97, 0x7A, 0xEC, 0x07, 0x91, 0x74, 0xAC, 0xE1,
+    0x44, 0x72, 0x67, 0x1C, 0x35, 0xBA, 0xC9, 0x4D, 0x56, 0xC9, 0xC4, 0x4C, 0x5D, 0xB5, 0x4D, 0xD1,
+    0xB5, 0x7D, 0x36, 0xB4, 0x63, 0x32, 0xED, 0xCF, 0xD4, 0xD1, 0x35, 0x45, 0xB4, 0x7D, 0x16, 0xCD,
+    0x98, 0x4C, 0xCC, 0xA9, 0xBA, 0x76, 0xD0, 0xE8, 0x96, 0x4E, 0xB3, 0x3E, 0x82, 0x8A, 0x0E, 0x7B,
+    0x23, 0xC2, 0xC9, 0xAD, 0x4D, 0x97, 0xC7, 0x6F, 0x55, 0xE4, 0x52, 0x65, 0xA4, 0x09, 0x35, 0x75,
+    0x28, 0x3B, 0x74, 0x29, 0x92, 0xC7, 0xBA, 0xC1, 0xFD, 0x78, 0xC0, 0x4C, 0xAA, 0x70, 0x6F, 0xDE,
+    0x2E, 0x8C, 0x98, 0xD8, 0x7A, 0xDC, 0xB5, 0x48, 0x3E, 0xB8, 0x90, 0x28, 0xD1, 0x4F, 0x5A, 0x9F,
+    0x49, 0x81, 0x5C, 0xE3, 0x6D, 0x5D, 0x40, 0xF6, 0xEA, 0x88, 0xFB, 0x41, 0x60, 0x2E, 0x3D, 0xD5,
+    0x31, 0x8E, 0xDC, 0xCB, 0x52, 0x8D, 0x91, 0xBC, 0x7B, 0x55, 0x0F, 0x4E, 0x89, 0x6C, 0x30, 0xD1,
+    0x79, 0x1B, 0x84, 0x3B, 0x8C, 0x2C, 0xD5, 0xBE, 0xE8, 0xEB, 0xB7, 0x44, 0xAB, 0x40, 0x3B, 0xC3,
+    0x56, 0xF5, 0x8B, 0x44, 0x56, 0xB7, 0x89, 0xCC, 0x62, 0x5D, 0xE1, 0x7E, 0x1C, 0x30, 0x93, 0x24,
+    0xBD, 0x29, 0x69, 0xD2, 0xB7, 0x57, 0xF5, 0x9B, 0x03, 0x26, 0xB6, 0x0D, 0xEE, 0x5A, 0x24, 0x1B,
+    0x5C, 0xE0, 0x97, 0x12, 0xB9, 0xB5, 0x47, 0xAA, 0x11, 0xA7, 0x68, 0x46, 0x3B, 0x14, 0xDE, 0x86,
+    0x99, 0xF2, 0x70, 0x5A, 0xB5, 0x56, 0x8A, 0xEE, 0xDB, 0x8F, 0x85, 0x99, 0xF2, 0x30, 0x32, 0x67,
+    0x31, 0x0F, 0xB9, 0x44, 0xAE, 0x1E, 0x8E, 0x4C, 0xA4, 0x5F, 0x6B, 0x38, 0xFF, 0xAE, 0x28, 0xFD,
+    0xD5, 0xC3, 0xD9, 0xE8, 0xC1, 0x88, 0x6C, 0x9F, 0x46, 0xF7, 0xFA, 0x63, 0x41, 0xD2, 0xE1, 0xCD,
+    0x55, 0x6B, 0xFB, 0x34, 0x3A, 0x6F, 0xFB, 0xDA, 0xB7, 0x9F, 0x18, 0x4E, 0x80, 0x58, 0x34, 0xD4,
+    0x67, 0x02, 0xF6, 0x7A, 0xE4, 0x48, 0x9A, 0x71, 0x7C, 0xAE, 0x28, 0x35, 0x53, 0x48, 0x21, 0x1B,
+    0xB2, 0x39, 0x19, 0xA9, 0xFD, 0x0E, 0xF9, 0x78, 0x9C, 0x64, 0xC9, 0xC1, 0x24, 0x52, 0xC0, 0x29,
+    0x72, 0x7C, 0xAD, 0x4D, 0xA0, 0xB7, 0xE8, 0x4F, 0x61, 0x07, 0xD7, 0xE4, 0xD1, 0xDE, 0x2C, 0x62,
+    0x2A, 0x45, 0x0A, 0x0D, 0x47, 0x2A, 0x0A, 0x13, 0xAE, 0x24, 0x93, 0x6B, 0x9C, 0xED, 0x3E, 0xA1,
+    0xA3, 0x4A, 0x4D, 0xB6, 0xAB, 0xAF, 0x36, 0xF9, 0x00, 0x33, 0x52, 0xE3, 0xD4, 0x27, 0x8F, 0x8E,
+    0x27, 0x92, 0x69, 0x87, 0x76, 0x23, 0xD8, 0x6A, 0x35, 0x9C, 0x05, 0xB6, 0x57, 0x15, 0x46, 0x11,
+    0x9C, 0xFC, 0xED, 0xB5, 0x90, 0xAC, 0xF6, 0xB6, 0x57, 0xAD, 0x4E, 0xEB, 0xE7, 0xEA, 0xCB, 0xC9,
+    0x8E, 0xB4, 0xD4, 0xDE, 0xFA, 0x74, 0x4A, 0x46, 0x6C, 0x70, 0xD0, 0x66, 0x3D, 0x66, 0x8C, 0x77,
+    0x05, 0xA9, 0xF3, 0xA3, 0xD8, 0x74, 0x3A, 0xC0, 0x1F, 0xEE, 0x42, 0xFE, 0xBE, 0x5F, 0x42, 0x09,
+    0xD9, 0x04, 0x6C, 0xC1, 0x92, 0x40, 0xAF, 0xE5, 0xD9, 0xBA, 0x4B, 0x94, 0x14, 0x3A, 0xD4, 0x35,
+    0xF5, 0x6D, 0xEF, 0xBA, 0xBC, 0xCF, 0x46, 0x13, 0x50, 0x32, 0x52, 0x76, 0x13, 0x66, 0x74, 0xD0,
+    0x96, 0x15, 0xF6, 0x4D, 0x8F, 0x51, 0x07, 0x75, 0x00, 0x3B, 0x6E, 0xC2, 0x92, 0x17, 0xA1, 0x72,
+    0xF0, 0x64, 0x5B, 0xE1, 0x54, 0x91, 0xAB, 0x5A, 0x42, 0x8C, 0x47, 0x03, 0x03, 0xED, 0x99, 0x40,
+    0x16, 0x66, 0x38, 0xB9, 0xB1, 0x1A, 0xB6, 0x57, 0xC9, 0xEA, 0x31, 0x0D, 0x4E, 0xF5, 0x9C, 0xAA,
+    0x53, 0x93, 0x87, 0x2C, 0x12, 0x29, 0xBB, 0xA2, 0x41, 0x26, 0x90, 0x87, 0x8B, 0xE0, 0x9E, 0xF3,
+    0xA4, 0xD3, 0x08, 0x56, 0x40, 0xDB, 0x6D, 0x1C, 0xAC, 0xB2, 0xC2, 0x98, 0x1E, 0x0E, 0x22, 0xCB,
+    0xB3, 0xEA, 0x6E, 0xA3, 0x10, 0x01, 0xB8, 0x68, 0x3D, 0xE5, 0xB5, 0x40, 0xFE, 0x56, 0x84, 0xBD,
+    0x63, 0x77, 0x46, 0x52, 0xD1, 0xC5, 0x7A, 0xCE, 0x67, 0x33, 0x71, 0x40, 0xDD, 0x38, 0x6C, 0x28,
+    0x9A, 0x74, 0xB2, 0x1D, 0xEE, 0x52, 0x20, 0xFF, 0x60, 0x80, 0x69, 0xD1, 0x21, 0x64, 0x02, 0xD4,
+    0x2C, 0xC1, 0xF8, 0xAC, 0xE7, 0x98, 0x09, 0x64, 0xCF, 0x0E, 0x18, 0x0D, 0xCB, 0x48, 0xE6, 0x4B,
+    0x58, 0xE0, 0x77, 0x3F, 0x07, 0xF6, 0xC1, 0x80, 0x19, 0x6B, 0x68, 0x8B, 0x8E, 0xE2, 0x74, 0x20,
+    0x69, 0xEE, 0xFF, 0xFB, 0x64, 0xDD, 0x3D, 0xC7, 0xC1, 0xBC, 0x13, 0x48, 0x86, 0x11, 0xE2, 0x3E,
+    0x9C, 0xDA, 0x81, 0xCF, 0xDF, 0x73, 0x47, 0x7C, 0xD6, 0xB2, 0x2A, 0xFE, 0x7A, 0x06, 0xE2, 0xEE,
+    0x1C, 0x89, 0xAB, 0x97, 0x38, 0xE8, 0xED, 0x1C, 0x49, 0x16, 0x20, 0x19, 0x49, 0x88, 0x24, 0x6F,
+    0x4F, 0xA0, 0x09, 0xCA, 0x69, 0xE3, 0x83, 0x2D, 0xC7, 0x95, 0xA2, 0xC1, 0x8C, 0x2D, 0xD8, 0xD7,
+    0x22, 0x6C, 0x6D, 0x18, 0x99, 0xAC, 0xF6, 0xB6, 0x57, 0xA5, 0xDE, 0xD1, 0x54, 0xCF, 0x99, 0xFA,
+    0xC5, 0x53, 0x6E, 0x6C, 0x58, 0x9C, 0xE7, 0x88, 0xB0, 0xC1, 0x44, 0x5C, 0x6F, 0x03, 0xAD, 0xE4,
+    0x97, 0xB8, 0xF7, 0x37, 0xFF, 0xC7, 0x3B, 0x9E, 0xF2, 0x6D, 0xE7, 0x79, 0x02, 0x5A, 0x55, 0x98,
+    0x45, 0x3F, 0x24, 0xE3, 0x2E, 0x26, 0xB6, 0x8B, 0x7A, 0xA8, 0xEE, 0xF0, 0xF1, 0x6F, 0xE2, 0x32,
+    0x6F, 0xAF, 0x56, 0x7B, 0x92, 0xDE, 0x96, 0xD4, 0x68, 0x75, 0xC5, 0xC4, 0x64, 0xB0, 0x21, 0xF3,
+    0xCE, 0x7F, 0xE1, 0x76, 0x32, 0x2F, 0x2C, 0xA4, 0xFC, 0x62, 0xB5, 0xA2, 0x54, 0x58, 0x72, 0xF8,
+    0xED, 0x12, 0xCC, 0x39, 0xCA, 0x70, 0x7D, 0xF5, 0x28, 0x4B, 0xF6, 0x9C, 0xD4, 0xD5, 0x4F, 0x0F,
+    0x45, 0x7F, 0x21, 0x1B, 0x6D, 0x32, 0xA7, 0x55, 0xDD, 0x50, 0xF4, 0x64, 0x23, 0xC9, 0x0C, 0x75,
+    0x43, 0x2B, 0x9C, 0x3C, 0x59, 0x80, 0x11, 0x76, 0x97, 0x9F, 0xDF, 0x31, 0x1C, 0x8A, 0xD3, 0x01,
+    0xB0, 0x37, 0x26, 0xC0, 0xC4, 0x1A, 0xEE, 0x12, 0xB4, 0x24, 0xAB, 0xB3, 0x6C, 0xAD, 0xF6, 0xA4,
+    0xCA, 0x68, 0x2E, 0xD5, 0xD0, 0xCE, 0x88, 0x4D, 0xC4, 0x64, 0x09, 0xAE, 0x2C, 0x81, 0x14, 0xF2,
+    0x01, 0x9D, 0x25, 0x9D, 0x70, 0x1A, 0x69, 0x2B, 0x2B, 0xF9, 0xB2, 0x33, 0xB1, 0x18, 0xF3, 0x01,
+    0xA1, 0x74, 0xC2, 0xF9, 0xD2, 0xB7, 0x95, 0x0D, 0x36, 0x94, 0x9D, 0x89, 0x59, 0xCC, 0x07, 0xF4,
+    0xAF, 0x26, 0x33, 0xA7, 0xD2, 0x94, 0x6B, 0x94, 0x46, 0xA3, 0x99, 0x4F, 0x1C, 0x2E, 0xF7, 0x90,
+    0xDF, 0x98, 0x80, 0xDA, 0xFA, 0x4F, 0x58, 0xA0, 0x00, 0x46, 0x43, 0xA2, 0xE8, 0x66, 0xAC, 0x9A,
+    0xBA, 0xA2, 0xEC, 0xB2, 0x81, 0x74, 0xA2, 0x5E, 0x51, 0x76, 0x99, 0xE6, 0x74, 0xA2, 0xD6, 0x50,
+    0x76, 0xD9, 0xE0, 0x5E, 0x99, 0xA8, 0x1F, 0x8A, 0x65, 0x97, 0x0D, 0xE5, 0x2B, 0x13, 0xF5, 0xC3,
+    0x63, 0xD9, 0x95, 0x52, 0xAE, 0x43, 0xE9, 0xA9, 0x05, 0x42, 0x00, 0x9F, 0xCD, 0xA5, 0xDF, 0x9E,
+    0xF7, 0x90, 0xBA, 0xA4, 0x7E, 0xFD, 0x97, 0x73, 0x69, 0x40, 0xEA, 0x97, 0x8C, 0x4F, 0x09, 0xBF,
+    0x37, 0x82, 0xBA, 0x25, 0xBE, 0x7F, 0xC4, 0xA5, 0xBE, 0x7E, 0x6A, 0x2C, 0xFA, 0x9D, 0x6C, 0xB4,
+    0xC9, 0x4C, 0xA6, 0xC8, 0xE5, 0x5B, 0x9F, 0xE0, 0x52, 0xE5, 0xD4, 0xC3, 0xCB, 0xF0, 0x00, 0xE9,
+    0xFB, 0x15, 0xAD, 0xE7, 0x9E, 0x6A, 0x49, 0xBF, 0x49, 0x8F, 0xE8, 0x35, 0x8D, 0xF7, 0xCD, 0xC8,
+    0x97, 0x1E, 0x3D, 0x15, 0x49, 0x64, 0x3B, 0x52, 0xCD, 0x4B, 0x80, 0x7B, 0x49, 0xBE, 0xE5, 0x13,
+    0x4B, 0x9A, 0x2C, 0xFB, 0x38, 0x2E, 0xB9, 0x37, 0x33, 0xDA, 0x81, 0xD2, 0x97, 0x21, 0x9D, 0x70,
+    0x7D, 0x2D, 0xDC, 0x2B, 0x8A, 0xB4, 0x15, 0x24, 0xF3, 0x51, 0x74, 0xAB, 0xF6, 0x8B, 0xD0, 0xA1,
+    0x6D, 0x6E, 0x27, 0xDE, 0x14, 0xEA, 0xAE, 0xBE, 0x1A, 0x69, 0x9F, 0xF3, 0xB4, 0x71, 0x11, 0x7E,
+    0x02, 0x3B, 0xC3, 0xC1, 0x44, 0xFE, 0x56, 0xA4, 0x4D, 0xA3, 0x9D, 0xCC, 0xD8, 0x8E, 0xD9, 0xB0,
+    0x44, 0x47, 0x4B, 0x0F, 0x07, 0x90, 0x0D, 0x18, 0x35, 0xE4, 0xFF, 0xFE, 0x53, 0x29, 0x47, 0xB6,
+    0x23, 0xD1, 0x95, 0x85, 0xF2, 0x44, 0x9A, 0xC9, 0x96, 0xB4, 0x7F, 0x84, 0xEC, 0xE3, 0x11, 0xDC,
+    0x99, 0x01, 0x33, 0xDA, 0x70, 0x9B, 0xF2, 0x50, 0x2B, 0xD3, 0xAC, 0x58, 0x2A, 0xDC, 0x9D, 0x16,
+    0x4C, 0x66, 0x07, 0x75, 0x24, 0xA9, 0x6F, 0x56, 0x99, 0xE4, 0x97, 0xB4, 0xE0, 0x74, 0x77, 0x5A,
+    0x30, 0xB6, 0xA3, 0xE2, 0xF1, 0x7F, 0x72, 0x74, 0x80, 0xF9, 0xAD, 0xB2, 0x09, 0xEE, 0xEA, 0xBF,
+    0xFC, 0x8F, 0x78, 0xFE, 0x97, 0xFE, 0x01, 0xD0, 0xF1, 0x8D, 0xD5, 0x9F, 0xBE, 0x7B, 0xD9, 0x7F,
+    0xC9, 0xBF, 0x70, 0xB5, 0xF1, 0x7C, 0xD6, 0xA7, 0x02, 0x32, 0xBE, 0xC4, 0xBF, 0x5E, 0xDD, 0x7A,
+    0xE9, 0xEB, 0xE6, 0x1E, 0x93, 0x9E, 0xC6, 0x7C, 0xE6, 0x27, 0x29, 0x75, 0x46, 0xEF, 0x68, 0xD8,
+    0xFC, 0xDB, 0x5E, 0xAD, 0xCE, 0x48, 0x1F, 0x4A, 0x71, 0xBD, 0x5E, 0xAF, 0xD7, 0xEB, 0x56, 0x77,
+    0x8E, 0x78, 0x76, 0xCB, 0xE5, 0xEF, 0xBF, 0xF2, 0x71, 0x38, 0x88, 0x65, 0xFB, 0x9B, 0x14, 0xD6,
+    0xC7, 0x9F, 0x97, 0x54, 0x4B, 0xEF, 0xAE, 0xD7, 0x2F, 0x02, 0x77, 0x55, 0xD2, 0xB1, 0xF4, 0xD1,
+    0xFA, 0xB1, 0x30, 0xDD, 0x49, 0xB6, 0xD2, 0xE8, 0x2E, 0x05, 0x97, 0x0C, 0xB6, 0x39, 0x05, 0xC0,
+    0x41, 0xF9, 0x74, 0x6C, 0x4D, 0x88, 0xF6, 0x30, 0xEC, 0xDA, 0xA7, 0xC2, 0x79, 0x7B, 0xBA, 0x3B,
+    0xB9, 0xC5, 0x56, 0x52, 0xB5, 0xE5, 0xE1, 0x38, 0xDB, 0xC3, 0xE0, 0xAC, 0xBF, 0x50, 0x54, 0xE3,
+    0x2E, 0xE1, 0x14, 0xC0, 0x13, 0xD0, 0x42, 0x0D, 0x17, 0xB9, 0x7F, 0xE7, 0x8B, 0x4E, 0xB3, 0xD3,
+    0xFC, 0x7B, 0x3B, 0x5F, 0x64, 0x87, 0xCD, 0xDF, 0x2E, 0xEC, 0xC2, 0x45, 0xA8, 0x97, 0xE8, 0x36,
+    0xFC, 0xDE, 0x51, 0x79, 0xF7, 0xCE, 0x4F, 0xEE, 0xDF, 0xF9, 0x22, 0xBB, 0x9B, 0x46, 0x76, 0xD8,
+    0xBD, 0xF8, 0xCF, 0x9C, 0x66, 0x77, 0x70, 0xB0, 0xF9, 0x79, 0x0D, 0x2D, 0x1C, 0x03, 0x13, 0xF5,
+    0xE6, 0xA4, 0xEB, 0x23, 0xDC, 0x4F, 0xD1, 0x65, 0x7A, 0x50, 0x53, 0xAD, 0x37, 0xF5, 0xCC, 0x9C,
+    0x8C, 0x9C, 0x80, 0x2F, 0x16, 0xEF, 0x4D, 0xF3, 0x31, 0x8E, 0x57, 0xFF, 0xD8, 0xBD, 0x32, 0xB9,
+    0xEB, 0xB3, 0x7B, 0x65, 0xDA, 0x62, 0xAF, 0x7C, 0xFC, 0xE3, 0x38, 0x1D, 0xB1, 0xB5, 0xFA, 0xD3,
+    0xEE, 0x37, 0x63, 0x6B, 0x72, 0x2B, 0xFB, 0xF5, 0xD8, 0x0A, 0x69, 0x93, 0xF7, 0xBF, 0xF7, 0xDD,
+    0xFF, 0xEA, 0xBF, 0x4F, 0x9A, 0x5F, 0xFD, 0x81, 0xE4, 0x18, 0xF7, 0x7C, 0x9D, 0x7B, 0xBE, 0xB1,
+    0xFD, 0xA7, 0x5F, 0x79, 0x77, 0xFF, 0x9F, 0x27, 0xD7, 0x7E, 0xEB, 0x4B, 0x7F, 0xFE, 0x87, 0xFF,
+    0x1D, 0x1E, 0x03, 0xBF, 0x05, 0x7F, 0xC8, 0xAF, 0x28, 0x9E, 0x00, 0x8E, 0xF1, 0xA5, 0x17, 0xD2,
+    0xFF, 0x87, 0xAF, 0xFE, 0xEB, 0xB3, 0xD7, 0xDF, 0xFD, 0x8B, 0xEB, 0x95, 0xFF, 0x5F, 0x4F, 0xF3,
+    0x2F, 0x7E, 0x9D, 0xDF, 0x1E, 0x15, 0xEF, 0x28, 0xB5, 0x27, 0x48, 0x7A, 0x20, 0x51, 0x58, 0xC2,
+    0xDC, 0xD3, 0x01, 0x17, 0x00, 0xAE, 0x58, 0xEF, 0x00, 0x9C, 0x09, 0x05, 0x80, 0xF5, 0xFB, 0xB6,
+    0x59, 0x22, 0x64, 0x4B, 0x6A, 0x3B, 0xDA, 0xC3, 0x0E, 0xA8, 0xCA, 0x87, 0xDF, 0x0E, 0x6D, 0x97,
+    0xC9, 0x28, 0x0C, 0xF3, 0x94, 0x29, 0x94, 0xFD, 0x78, 0xC1, 0x1E, 0x86, 0x2B, 0x70, 0xBE, 0x34,
+    0x61, 0x2C, 0x1A, 0x76, 0xAD, 0xDF, 0xBF, 0x60, 0x7A, 0x4A, 0x13, 0xCA, 0xA2, 0x1A, 0xB1, 0x4D,
+    0xB4, 0xD7, 0xFA, 0x0B, 0xE4, 0xBE, 0x3C, 0xDD, 0xC7, 0x92, 0xAC, 0x33, 0x1F, 0x87, 0xF2, 0xFD,
+    0xC6, 0x04, 0xEA, 0x60, 0xD4, 0xF0, 0x2D, 0x92, 0x8A, 0xAD, 0xBB, 0xE5, 0xBD, 0x6D, 0x5C, 0x1A,
+    0x6D, 0xD7, 0x9A, 0x60, 0x97, 0xD8, 0xA4, 0xE9, 0xCF, 0x9B, 0x30, 0xE7, 0x61, 0xB2, 0xAF, 0xC5,
+    0xF2, 0x70, 0x70, 0x79, 0xBF, 0x93, 0xFB, 0x93, 0xE9, 0x72, 0xF7, 0x6E, 0xE6, 0x07, 0x13, 0xE6,
+    0xC2, 0xB7, 0xF6, 0x7A, 0xB4, 0xAF, 0x45, 0xF7, 0x50, 0x74, 0x8F, 0xF4, 0x2E, 0xEF, 0xA3, 0xE9,
+    0xF6, 0x6D, 0x75, 0x32, 0x65, 0x0F, 0x78, 0x39, 0x0B, 0xB6, 0x2F, 0xBD, 0xAB, 0x6A, 0xF6, 0x69,
+    0x80, 0xD2, 0x74, 0xEE, 0x91, 0xE0, 0xAE, 0x85, 0xE2, 0x70, 0xCC, 0xDF, 0x8A, 0x26, 0x1C, 0x24,
+    0x61, 0x97, 0xBD, 0xCF, 0x01, 0xA4, 0x61, 0x27, 0xF7, 0xEE, 0x91, 0x10, 0x4D, 0xAC, 0x6D, 0x5F,
+    0x1C, 0x8E, 0x35, 0x07, 0xC5, 0xE1, 0x68, 0xC2, 0x81, 0xF5, 0x85, 0xE9, 0xCF, 0xB3, 0xF7, 0xB9,
+    0xA4, 0xE2, 0xCF, 0xC8, 0x7A, 0xEA, 0x3E, 0x7B, 0xA7, 0xBF, 0x68, 0x16, 0x43, 0x8D, 0xF3, 0xE9,
+    0x98, 0x07, 0xE7, 0x5D, 0xE5, 0xBC, 0xED, 0xCD, 0xC8, 0x3E, 0x90, 0xF6, 0x59, 0xC8, 0x43, 0x3E,
+    0xD8, 0xBE, 0x7D, 0x78, 0x70, 0x69, 0xD8, 0xBC, 0xE4, 0x9F, 0xC3, 0x57, 0xCF, 0x67, 0xFE, 0x7C,
+    0x99, 0xBF, 0x1A, 0xF2, 0xC3, 0x67, 0x7C, 0x1A, 0x0A, 0x78, 0x79, 0x87, 0xCF, 0xED, 0x0E, 0x7B,
+    0xCE, 0xBE, 0x3A, 0x3A, 0xFB, 0xEA, 0x78, 0x6C, 0x77, 0xD8, 0x63, 0xDC, 0x21, 0xED, 0x6D, 0x95,
+    0x5F, 0x7B, 0xC6, 0x97, 0xF9, 0xAB, 0xE1, 0x7C, 0xE6, 0xCF, 0xFF, 0x39, 0x7C, 0x05, 0xE0, 0x9E,
+    0xE6, 0xF7, 0x6D, 0x28, 0x0F, 0x47, 0x7B, 0x63, 0x32, 0x63, 0x5D, 0xCD, 0xB6, 0x73, 0x97, 0x82,
+    0xED, 0xA2, 0x19, 0x1C, 0x93, 0xF5, 0xE5, 0xE9, 0x90, 0x77, 0x31, 0x1D, 0x4A, 0x2E, 0x64, 0xDE,
+    0x56, 0xC0, 0x31, 0x4E, 0x94, 0xBE, 0x3E, 0x13, 0xDC, 0xF5, 0x98, 0x87, 0x93, 0xEC, 0xDD, 0x91,
+    0x18, 0xE5, 0xA0, 0x77, 0x8E, 0x52, 0x68, 0xDF, 0x58, 0xF4, 0xDB, 0x08, 0xE5, 0x12, 0x15, 0xDF,
+    0x07, 0x5B, 0x91, 0x06, 0xB8, 0x00, 0xB6, 0x21, 0x09, 0xB0, 0x7B, 0xF7, 0x4D, 0x59, 0x07, 0x11,
+    0x8A, 0xE5, 0xA6, 0x4D, 0x94, 0xE7, 0x18, 0xA9, 0x9A, 0x7C, 0xA6, 0x16, 0x8A, 0x46, 0xD1, 0x2A,
+    0xDC, 0x5F, 0x74, 0x7B, 0x75, 0x83, 0x83, 0x48, 0x1A, 0xC8, 0x3C, 0x25, 0xEC, 0x73, 0x2E, 0x24,
+    0xAD, 0x6F, 0xA7, 0x44, 0x83, 0x55, 0xE5, 0x26, 0x54, 0xA5, 0x13, 0xB9, 0xA7, 0x84, 0x27, 0xE1,
+    0x68, 0xC4, 0x8E, 0xC1, 0x09, 0xF2, 0x40, 0xD1, 0xA1, 0xCA, 0x4C, 0xE4, 0x81, 0xD2, 0x73, 0x12,
+    0xF6, 0x48, 0xE0, 0x9E, 0xA7, 0xD5, 0x98, 0x58, 0x0B, 0x77, 0x49, 0xD1, 0x8C, 0xF7, 0x17, 0x9D,
+    0xAB, 0x70, 0x66, 0x20, 0x0D, 0x0E, 0x4A, 0x13, 0x38, 0x17, 0x1C, 0xED, 0x64, 0x82, 0x55, 0xE5,
+    0x50, 0x95, 0x86, 0xDC, 0x53, 0xF2, 0xE4, 0x92, 0xDC, 0x58, 0xBA, 0xCF, 0x03, 0xA5, 0x57, 0x65,
+    0xA6, 0x3C, 0xE0, 0xFC, 0x49, 0xD8, 0xBB, 0xA7, 0x39, 0x86, 0x89, 0xF9, 0x8C, 0x7B, 0x4A, 0x31,
+    0x1B, 0xAC, 0x42, 0x5D, 0x3D, 0x5F, 0x9F, 0x1E, 0x20, 0x3A, 0xC8, 0x0F, 0x03, 0xEC, 0x3B, 0x92,
+    0xF6, 0x30, 0xA4, 0x1A, 0x1C, 0x6E, 0x32, 0xC1, 0x4C, 0x94, 0x94, 0x24, 0x21, 0xD9, 0xCC, 0x8A,
+    0x13, 0x9C, 0xA0, 0xF4, 0xA5, 0x37, 0xD1, 0x2C, 0xE6, 0x11, 0x7B, 0xEC, 0x41, 0x05, 0x6E, 0x4C,
+    0xAF, 0x6B, 0x6E, 0xCF, 0x3D, 0xA4, 0xF1, 0x7E, 0x0E, 0xAA, 0xBB, 0x96, 0xC0, 0x53, 0x61, 0x27,
+    0xF3, 0xCE, 0xBE, 0x15, 0xDD, 0xD3, 0xD1, 0x9D, 0xB9, 0x31, 0xD9, 0xD7, 0xA2, 0x3B, 0x13, 0x5A,
+    0xFB, 0xDA, 0xE8, 0x4C, 0x38, 0xB0, 0xAF, 0x0C, 0xF6, 0xA1, 0xB0, 0x63, 0x9B, 0x93, 0x29, 0x7B,
+    0x9F, 0x83, 0x27, 0x28, 0x94, 0xCC, 0xB2, 0xDD, 0xE4, 0xD2, 0x9B, 0x63, 0xF6, 0xD3, 0xBE, 0xF8,
+    0x4E, 0x73, 0xC5, 0x99, 0x30, 0x97, 0x57, 0x15, 0x17, 0x28, 0x1E, 0x49, 0xC5, 0x01, 0xD9, 0x88,
+    0xEB, 0xCD, 0xFB, 0x4D, 0xB9, 0x9B, 0x84, 0xD1, 0xFE, 0xCF, 0x83, 0xD3, 0xF8, 0xCD, 0xF6, 0x79,
+    0xC6, 0x25, 0xF9, 0xB1, 0xB5, 0x32, 0xEA, 0x34, 0x9C, 0xA7, 0x78, 0x3E, 0x57, 0xF5, 0x58, 0xE0,
+    0x80, 0xA2, 0x2A, 0xAF, 0xA9, 0x5B, 0x02, 0x50, 0x5F, 0xA4, 0x88, 0xF9, 0xCD, 0x24, 0xE2, 0xFE,
+    0x65, 0xA6, 0x70, 0xE5, 0xDC, 0x0F, 0x7C, 0xBC, 0x92, 0x5F, 0x0B, 0xD1, 0xA9, 0x6A, 0x3B, 0x60,
+    0x7B, 0x95, 0x29, 0xD6, 0xBA, 0xE6, 0x87, 0xFB, 0x77, 0xC9, 0x3D, 0x23, 0x0E, 0xD3, 0x73, 0x85,
+    0xDC, 0x2F, 0x30, 0x96, 0xE4, 0xC5, 0x4C, 0x87, 0x6F, 0xDD, 0x1C, 0x76, 0x5D, 0xF1, 0xB0, 0x1E,
+    0xD4, 0x5B, 0xE3, 0x41, 0xB4, 0x32, 0x3F, 0xD7, 0x50, 0xF7, 0x40, 0xF2, 0x7C, 0xAA, 0xBE, 0x6E,
+    0x1F, 0xF1, 0x71, 0xDF, 0xFE, 0xA0, 0x8F, 0x4E, 0xBE, 0x1D, 0x71, 0x14, 0x5D, 0x3D, 0x2E, 0xE0,
+    0xBE, 0x64, 0x0B, 0xD7, 0x76, 0xC5, 0xC7, 0x21, 0xBF, 0x7A, 0xE7, 0xAF, 0xB8, 0x3E, 0xBA, 0x9F,
+    0xC6, 0x44, 0x95, 0xD3, 0x43, 0x53, 0x6D, 0xFD, 0x95, 0x8B, 0xCB, 0x08, 0x94, 0xCB, 0x08, 0xB4,
+    0x6D, 0xA3, 0x91, 0x27, 0x00, 0xBE, 0x9A, 0xAA, 0x52, 0x97, 0x0E, 0x5C, 0xA1, 0xAC, 0xF2, 0x2E,
+    0x1D, 0xB8, 0x92, 0xB4, 0xBD, 0xA6, 0xED, 0x15, 0xF9, 0x68, 0x34, 0x1C, 0x94, 0xCF, 0x5E, 0x1D,
+    0x4F, 0x96, 0x55, 0x16, 0x92, 0xC8, 0x45, 0xCA, 0x26, 0x57, 0x6C, 0xE5, 0x57, 0x55, 0x3E, 0x5A,
+    0x5D, 0x7B, 0x7A, 0x68, 0xF6, 0xB9, 0x62, 0x54, 0xFD, 0xD3, 0x81, 0x8B, 0x94, 0xFF, 0x4B, 0xFB,
+    0x03, 0xF9, 0x27, 0x20, 0x6F, 0x98, 0xC9, 0x47, 0xEA, 0xDE, 0xBC, 0xD9, 0xEC, 0xEC, 0xA6, 0xFD,
+    0x58, 0xBC, 0x77, 0xD3, 0x69, 0x64, 0x17, 0x46, 0xD2, 0xE7, 0xEF, 0x59, 0x9F, 0xD6, 0xAB, 0xB7,
+    0x5E, 0x38, 0x4F, 0x31, 0x64, 0xF2, 0xD9, 0xC0, 0x45, 0xCA, 0xFF, 0xBC, 0xBD, 0x26, 0xFF, 0x04,
+    0xD4, 0x95, 0x1B, 0xED, 0x60, 0x46, 0xEA, 0x9B, 0xB9, 0x86, 0x7D, 0xFB, 0x03, 0xBF, 0x7F, 0xC5,
+    0x1E, 0xDE, 0x1A, 0x0B, 0x71, 0x6F, 0xF5, 0xFB, 0xEB, 0x67, 0x14, 0x2F, 0x5E, 0xBE, 0xF6, 0x74,
+    0x38, 0xB1, 0x83, 0xF5, 0xC9, 0x80, 0x23, 0xEB, 0xD9, 0x27, 0xF7, 0x7C, 0x85, 0x6C, 0xCA, 0x75,
+    0xBD, 0xBB, 0x39, 0xEE, 0xBA, 0xD6, 0x28, 0xD5, 0xCF, 0x42, 0x1D, 0xED, 0xFB, 0x0F, 0xBF, 0xA3,
+    0xFE, 0xDE, 0x26, 0x1F, 0x8D, 0xC2, 0x41, 0xF9, 0xAC, 0x8F, 0xFB, 0xF6, 0xDA, 0x47, 0xB1, 0x94,
+    0xBF, 0x6F, 0xA0, 0x4D, 0x5A, 0x5F, 0x87, 0xE4, 0x85, 0x05, 0x9F, 0xA0, 0xA9, 0x95, 0xFA, 0xF6,
+    0xDB, 0x07, 0xD9, 0x60, 0xFA, 0xBA, 0xFA, 0x5A, 0x36, 0x40, 0x5D, 0x91, 0x49, 0xD4, 0x0A, 0xD9,
+    0xCD, 0xB3, 0xD4, 0x15, 0xAD, 0x7C, 0xAE, 0x48, 0x36, 0x40, 0xDB, 0x50, 0x2F, 0x35, 0x38, 0xB6,
+    0xE0, 0xC0, 0xA4, 0x26, 0x0B, 0x2D, 0xAE, 0x8A, 0x44, 0xE3, 0xB3, 0x00, 0xE7, 0x5E, 0xDF, 0xB3,
+    0x52, 0xF5, 0xDB, 0xD3, 0x59, 0xEC, 0x4F, 0xF6, 0x32, 0xC9, 0xDF, 0x3B, 0x7F, 0x8F, 0x2C, 0x40,
+    0xD9, 0x70, 0xCF, 0xBC, 0x3E, 0x70, 0xD2, 0xD0, 0x4A, 0x7E, 0x8F, 0xB3, 0xB7, 0x43, 0x27, 0x66,
+    0x03, 0xA9, 0xC2, 0x69, 0x13, 0x2D, 0xAC, 0x9F, 0x5E, 0x60, 0xA4, 0x66, 0xCC, 0x43, 0x02, 0xE0,
+    0x9A, 0xFA, 0xC1, 0x01, 0x30, 0x63, 0x16, 0xCA, 0x0A, 0x70, 0x4D, 0x9B, 0xDD, 0x7A, 0xBE, 0xEC,
+    0xCD, 0x58, 0xBE, 0x23, 0x15, 0xF2, 0x4E, 0xE3, 0x1F, 0xDC, 0xBA, 0x14, 0xCE, 0x1B, 0x4D, 0xB8,
+    0xCA, 0x9D, 0xAE, 0xDC, 0x8F, 0x30, 0x43, 0xAA, 0xCA, 0x8C, 0xE0, 0x2A, 0x2B, 0x5C, 0x83, 0x19,
+    0x28, 0xE2, 0xD2, 0xF0, 0x3B, 0x85, 0x77, 0x1D, 0x26, 0xFE, 0x03, 0x1F, 0x4B, 0x75, 0x38, 0xB9,
+    0xCB, 0xCF, 0x68, 0x02, 0x5D, 0xDF, 0x10, 0x53, 0x51, 0x2D, 0x7E, 0x70, 0xAA, 0x91, 0x42, 0x91,
+    0xBA, 0xDB, 0x47, 0xEC, 0xA7, 0x91, 0xEF, 0x9B, 0x11, 0x4A, 0x45, 0x9C, 0x22, 0x79, 0x80, 0x73,
+    0xB7, 0xBE, 0x4F, 0xAB, 0x40, 0x3E, 0x2C, 0xD9, 0x5E, 0x33, 0x43, 0xA2, 0x9F, 0xEC, 0x53, 0x2B,
+    0x2E, 0x51, 0xAE, 0x0D, 0x0E, 0xE4, 0xF3, 0x9B, 0x84, 0xBF, 0xED, 0x36, 0xFF, 0x25, 0x1D, 0x4A,
+    0x0A, 0xED, 0x7A, 0x1D, 0xF3, 0x6E, 0x03, 0x98, 0xCA, 0x3D, 0x8B, 0xD7, 0xF6, 0x39, 0xB0, 0x1E,
+    0x1B, 0xB1, 0xF2, 0x45, 0x3B, 0xE5, 0x3F, 0xFC, 0x61, 0x73, 0xFD, 0x86, 0x27, 0x82, 0x03, 0xEB,
+    0x31, 0x81, 0xBF, 0x56, 0xB9, 0x13, 0x85, 0xF0, 0x9B, 0xA0, 0x49, 0xE1, 0x81, 0x78, 0xFB, 0x51,
+    0xF3, 0xFA, 0xA5, 0x71, 0x71, 0xB7, 0xD3, 0x71, 0x03, 0xF4, 0xFA, 0x1C, 0x7C, 0xF1, 0x53, 0x3B,
+    0x5C, 0x2A, 0xD7, 0x3F, 0xF0, 0x71, 0x8A, 0x56, 0x11, 0x45, 0x6C, 0xDC, 0x00, 0xC4, 0xE0, 0x77,
+    0x53, 0xD8, 0x4D, 0x03, 0xAE, 0xAA, 0xD9, 0xC5, 0x04, 0x27, 0xA9, 0x90, 0xF4, 0xDA, 0xAD, 0xF5,
+    0xE5, 0xBE, 0xAC, 0xB2, 0xDE, 0x8C, 0x79, 0x60, 0x27, 0x09, 0x24, 0x9C, 0x80, 0x6F, 0x91, 0x0D,
+    0xD4, 0x43, 0xA6, 0xE1, 0xE2, 0x3C, 0x7C, 0xF8, 0xA1, 0xB7, 0x7E, 0x51, 0x04, 0x26, 0x24, 0x67,
+    0xFE, 0x5D, 0xE1, 0x76, 0x9C, 0x82, 0x13, 0x2E, 0xE0, 0x16, 0xBB, 0x07, 0xF2, 0x66, 0x33, 0x00,
+    0x56, 0x31, 0xFB, 0xE1, 0x0F, 0xAB, 0xFF, 0xF2, 0x46, 0xB5, 0x50, 0x95, 0x9C, 0xF9, 0x77, 0xC9,
+    0x87, 0x1F, 0x76, 0x4E, 0xC1, 0x28, 0xE0, 0x02, 0x69, 0xCF, 0x92, 0xEF, 0xB2, 0x5A, 0xC2, 0x5A,
+    0x26, 0xB0, 0xF4, 0x3F, 0x62, 0x7A, 0x6C, 0xF3, 0x8D, 0xDD, 0x74, 0x1C, 0xCB, 0x4B, 0x6F, 0x0F,
+    0xF6, 0xB2, 0x66, 0x69, 0x9C, 0xD7, 0xCF, 0x47, 0x92, 0x89, 0x64, 0x93, 0x62, 0xBA, 0x7D, 0x7F,
+    0xC4, 0x04, 0x72, 0x4F, 0x99, 0xB3, 0x7F, 0x90, 0x86, 0x83, 0xDC, 0x5F, 0x2C, 0x35, 0xB7, 0x9A,
+    0xD6, 0x97, 0x3D, 0x91, 0xC2, 0x73, 0xE1, 0x4E, 0x18, 0x28, 0xEF, 0xA0, 0xAC, 0xBE, 0xC4, 0x95,
+    0x24, 0x26, 0x43, 0xE1, 0xB3, 0xAB, 0x23, 0x85, 0x95, 0x62, 0x2D, 0x85, 0x83, 0xF5, 0xBA, 0xB9,
+    0xB2, 0x01, 0x35, 0x8C, 0xDC, 0x71, 0xC5, 0x4D, 0xB3, 0xE4, 0x9B, 0x4D, 0x00, 0x73, 0x6B, 0x7D,
+    0xD9, 0x48, 0x3A, 0xBC, 0xB5, 0x5E, 0xBF, 0x10, 0x80, 0x52, 0x52, 0x2A, 0xC9, 0x97, 0xFF, 0xD9,
+    0xEA, 0xCF, 0xD2, 0x70, 0x04, 0x1E, 0x38, 0xD2, 0x0C, 0xC9, 0xD2, 0x60, 0x04, 0xCE, 0x61, 0xC6,
+    0x16, 0xF7, 0xB6, 0xCC, 0xCF, 0x9F, 0xAD, 0xB3, 0x2F, 0x7F, 0xED, 0xEB, 0x3C, 0xF9, 0x7D, 0x92,
+    0xB7, 0x3B, 0xF2, 0x67, 0x2B, 0x1E, 0x78, 0x00, 0x5E, 0x7E, 0x99, 0xF4, 0xED, 0x9E, 0xFC, 0xD9,
+    0x86, 0x07, 0x1E, 0xB8, 0x6B, 0x72, 0xE4, 0x47, 0x09, 0x6F, 0xC7, 0xEE, 0xFA, 0xA5, 0x60, 0x25,
+    0xA5, 0xEB, 0xF5, 0x4B, 0x01, 0x38, 0xE5, 0xA4, 0xD9, 0x4A, 0x73, 0xBA, 0x3A, 0x7B, 0x71, 0x83,
+    0x83, 0x70, 0x40, 0xB6, 0xF9, 0xE9, 0x89, 0x13, 0x9F, 0xE8, 0x72, 0xF3, 0x84, 0xEC, 0xD9, 0x8A,
+    0x2F, 0x7F, 0x0D, 0x9E, 0xFC, 0x3E, 0xFF, 0xD7, 0xDB, 0xD7, 0x2F, 0x7D, 0xFC, 0x6C, 0x6B, 0xE6,
+    0x32, 0xA4, 0xE3, 0x01, 0xE9, 0xCF, 0x7B, 0xD2, 0x79, 0x03, 0x4B, 0x01, 0x4E, 0x1C, 0x03, 0x6B,
+    0x3C, 0xB6, 0xD9, 0xC7, 0xBE, 0xFE, 0xB8, 0xB7, 0x52, 0xB4, 0xEB, 0xF5, 0x4B, 0xD7, 0x3C, 0x0C,
+    0xAD, 0x34, 0x5A, 0x69, 0x24, 0x26, 0x11, 0xEB, 0x23, 0x1B, 0xEF, 0x03, 0xB6, 0x2B, 0x92, 0x3F,
+    0x9A, 0xE1, 0xA0, 0x08, 0x58, 0xAF, 0x2A, 0x89, 0xF9, 0x88, 0xAB, 0xDC, 0xBB, 0x2F, 0x05, 0x23,
+    0xCD, 0x0B, 0xE6, 0x4C, 0x8C, 0xD8, 0xA1, 0xAC, 0xA8, 0x2F, 0x05, 0x4C, 0xBC, 0x00, 0xE5, 0x8F,
+    0x3D, 0xC9, 0x7C, 0x3B, 0xB2, 0xD7, 0x6F, 0xA2, 0x3F, 0xAE, 0x01, 0x2A, 0xE0, 0x78, 0x85, 0x9B,
+    0x71, 0xEA, 0x3F, 0x9F, 0x46, 0x70, 0x0D, 0xB6, 0x27, 0x8D, 0xB4, 0x4A, 0xA4, 0xAB, 0xF3, 0xB9,
+    0x30, 0xA5, 0xE3, 0x01, 0xB3, 0xAB, 0xDC, 0xE3, 0xDE, 0x5E, 0x0B, 0xD9, 0x5B, 0xD1, 0x0C, 0x75,
+    0x1A, 0xED, 0x7F, 0x88, 0xA9, 0x22, 0xE5, 0x78, 0x14, 0x4D, 0x28, 0xA4, 0x37, 0xA4, 0xF1, 0xDB,
+    0x7F, 0x3C, 0x43, 0xDB, 0x50, 0xF6, 0xE4, 0x23, 0xE9, 0x26, 0xA3, 0xFA, 0xF6, 0xFA, 0x5F, 0x8D,
+    0xA4, 0x77, 0xBE, 0xB9, 0x39, 0xBF, 0x34, 0xB7, 0xD2, 0x39, 0x1D, 0x45, 0x5F, 0xEF, 0xB9, 0x99,
+    0x74, 0x46, 0xFA, 0x4E, 0x55, 0x4B, 0x83, 0x99, 0x68, 0xBD, 0xF3, 0xE8, 0xC1, 0x09, 0x3B, 0xE7,
+    0x81, 0x5B, 0xD1, 0x55, 0xF6, 0x99, 0x30, 0x31, 0xDA, 0xC3, 0x60, 0x9B, 0xDA, 0x76, 0x63, 0x12,
+    0xDD, 0x99, 0x26, 0x0F, 0x73, 0xC4, 0x3D, 0x2D, 0x9F, 0x44, 0x13, 0x29, 0x7A, 0x3B, 0x3F, 0x2A,
+    0x5A, 0x29, 0xE4, 0xD7, 0x34, 0xF1, 0x5B, 0x77, 0x61, 0xCF, 0x5E, 0x3E, 0x02, 0xBF, 0x75, 0x0B,
+    0x9E, 0xB6, 0x10, 0xD8, 0xCB, 0x1D, 0xD9, 0xF5, 0x88, 0x09, 0x82, 0xB1, 0xE8, 0xD9, 0x37, 0x11,
+    0x87, 0xAA, 0xE2, 0x28, 0x92, 0x17, 0xD0, 0x43, 0x03, 0x45, 0x98, 0xC8, 0x62, 0x2D, 0xE9, 0x9C,
+    0xA4, 0x6E, 0x6B, 0xB5, 0x5A, 0x59, 0x49, 0x6F, 0x48, 0x0A, 0xAA, 0xD2, 0x58, 0xF6, 0x4C, 0xBF,
+    0xF0, 0x4B, 0xB3, 0xA0, 0x90, 0x8B, 0x3E, 0x2E, 0x3C, 0x68, 0xCF, 0x41, 0xF1, 0x7E, 0xB3, 0xC0,
+    0x05, 0xDA, 0xB0, 0xE0, 0xD9, 0xCD, 0xC8, 0x66, 0x89, 0xAF, 0x56, 0xD5, 0x7D, 0x52, 0x28, 0xA5,
+    0xE8, 0x6E, 0xAD, 0xBF, 0x57, 0xF6, 0x4B, 0xB8, 0x25, 0x0B, 0x1B, 0xF0, 0x47, 0x2B, 0xA9, 0x95,
+    0xF4, 0xDE, 0xAD, 0xF5, 0x7A, 0x1D, 0x37, 0xF0, 0x20, 0x1B, 0x36, 0x40, 0x84, 0x42, 0x9A, 0x13,
+    0x49, 0xFE, 0xB8, 0x14, 0x80, 0x93, 0xCB, 0x74, 0xDD, 0x3A, 0xF7, 0xA3, 0xA4, 0x5D, 0xD6, 0xD1,
+    0xA1, 0x5E, 0x9A, 0xFF, 0xC5, 0xCC, 0x84, 0x70, 0xD4, 0x94, 0x4D, 0xE9, 0x6D, 0x97, 0x4B, 0xFA,
+    0x58, 0xD2, 0xDC, 0xAE, 0xE7, 0xF5, 0x65, 0x7F, 0x91, 0x6C, 0x28, 0x2B, 0x64, 0x3D, 0xC5, 0xC7,
+    0x3D, 0xA9, 0xA4, 0xBE, 0x90, 0x22, 0xAD, 0x84, 0x3B, 0x12, 0xA2, 0x00, 0xF7, 0x49, 0x4D, 0x2B,
+    0x05, 0x49, 0xB1, 0x7D, 0x7E, 0x01, 0x40, 0x95, 0x1E, 0xEE, 0xEA, 0x70, 0xBD, 0xFE, 0xCE, 0x11,
+    0x5E, 0xBB, 0xFD, 0xC9, 0x6A, 0x95, 0x4B, 0xF2, 0xB5, 0x14, 0xF8, 0xE3, 0xF5, 0x8B, 0xAB, 0x55,
+    0x85, 0x93, 0x1A, 0x2B, 0xCD, 0xC9, 0x7A, 0xDD, 0xF6, 0x90, 0xCE, 0x47, 0x08, 0xEF, 0x01, 0x98,
+    0x5B, 0x49, 0x97, 0x25, 0xDD, 0x5A, 0xAF, 0x5F, 0x1A, 0xEF, 0x02, 0x44, 0x39, 0x0F, 0xF5, 0x6B,
+    0x92, 0x3A, 0x49, 0x9D, 0xD3, 0xBC, 0x78, 0x4C, 0x26, 0xC0, 0xD6, 0x7C, 0x16, 0x23, 0x8D, 0x48,
+    0xEA, 0xEF, 0xD5, 0x4B, 0x33, 0x85, 0x2F, 0x7B, 0x13, 0x4C, 0xE4, 0x00, 0x57, 0x15, 0xDE, 0xBE,
+    0x27, 0xE9, 0x96, 0x24, 0xAD, 0x2F, 0xBF, 0xDB, 0x36, 0xE9, 0x60, 0x7B, 0x2E, 0x66, 0x03, 0xF6,
+    0x30, 0x92, 0x7E, 0x3C, 0x95, 0xCB, 0x8A, 0x9F, 0xCC, 0x82, 0x15, 0x70, 0x2C, 0x1A, 0x0A, 0x68,
+    0x75, 0x13, 0xB7, 0xAC, 0x49, 0x79, 0xB8, 0x6F, 0xDC, 0x6C, 0xB5, 0xB8, 0xAB, 0xC3, 0xF5, 0xBA,
+    0x6D, 0x36, 0x1A, 0xED, 0xC6, 0x6A, 0x75, 0x6E, 0x94, 0x34, 0x3A, 0x69, 0x38, 0xBE, 0xFE, 0xDF,
+    0x2A, 0xB6, 0x57, 0x9B, 0xF9, 0xA2, 0x57, 0x24, 0xA9, 0xB3, 0x03, 0xB5, 0x37, 0x91, 0x22, 0x2C,
+    0x68, 0x65, 0xE7, 0x13, 0x61, 0xC3, 0xDF, 0xAE, 0x71, 0xA4, 0xED, 0x9C, 0x5E, 0x95, 0xAC, 0x86,
+    0x5A, 0x7E, 0x6B, 0xB5, 0x3A, 0x5B, 0x6C, 0x50, 0x13, 0x45, 0xE0, 0x4A, 0x3E, 0xB2, 0x63, 0x26,
+    0x4E, 0x25, 0xDA, 0x44, 0xBE, 0x5C, 0xB7, 0xC1, 0x0D, 0x0E, 0xCB, 0x98, 0xDB, 0xB0, 0xB0, 0xB0,
+    0xAE, 0x60, 0xE2, 0x98, 0x19, 0x29, 0xF2, 0x80, 0x2B, 0x3C, 0xAD, 0x5B, 0x20, 0x09, 0x53, 0xA1,
+    0x25, 0x74, 0xF8, 0xCD, 0xF5, 0x77, 0x5B, 0x4D, 0xEB, 0xF5, 0x77, 0xC1, 0x41, 0xD9, 0x60, 0x3B,
+    0xB2, 0x80, 0x19, 0x48, 0x22, 0x1C, 0xDC, 0x6E, 0xF5, 0x77, 0xB5, 0xCE, 0x77, 0xB5, 0xE6, 0x61,
+    0x03, 0x65, 0xC2, 0x55, 0xE4, 0x3D, 0x44, 0x28, 0x1B, 0xB2, 0x00, 0x13, 0x14, 0x1E, 0x33, 0x40,
+    0x0B, 0xD6, 0x93, 0x8E, 0x8B, 0xEE, 0xED, 0x97, 0x7C, 0x73, 0x45, 0x16, 0x8E, 0x6E, 0x5F, 0x70,
+    0x50, 0x27, 0xE1, 0x3C, 0x9C, 0xE7, 0xD4, 0xF9, 0x27, 0xDB, 0x83, 0x58, 0xA8, 0x37, 0xAA, 0x0A,
+    0xF5, 0x6D, 0x1B, 0x4F, 0x9D, 0x7F, 0xF2, 0xC4, 0x79, 0x38, 0x0F, 0x27, 0x49, 0x5E, 0x4C, 0x14,
+    0x5C, 0xFB, 0x03, 0xBF, 0xBF, 0x9F, 0xFD, 0xC0, 0x9F, 0xBF, 0xF8, 0xF8, 0xA1, 0x86, 0x7C, 0x04,
+    0xCA, 0x87, 0x63, 0x7D, 0x38, 0xDC, 0xD1, 0x08, 0xDD, 0x46, 0x23, 0x8C, 0x9B, 0xFD, 0x7C, 0xE5,
+    0x66, 0x87, 0x55, 0xD6, 0x2D, 0xF8, 0x2F, 0x62, 0xBA, 0x66, 0x27, 0x91, 0x2F, 0xA8, 0x43, 0xEE,
+    0x99, 0x4C, 0x4F, 0xF9, 0x54, 0xC0, 0x84, 0x7D, 0x88, 0xBB, 0x50, 0x9E, 0xA9, 0xC8, 0xDE, 0xF3,
+    0xA0, 0x7E, 0x81, 0xEF, 0x67, 0x47, 0x78, 0xBE, 0xB2, 0x82, 0x3D, 0x1E, 0x52, 0x72, 0x43, 0x1F,
+    0x8C, 0xD1, 0x0D, 0x3B, 0x66, 0xB0, 0xD5, 0x64, 0x82, 0xBA, 0x36, 0xCE, 0x36, 0x5A, 0x7F, 0x96,
+    0x3F, 0x4B, 0xAA, 0xA4, 0x2A, 0x86, 0x22, 0xB8, 0xA9, 0x8E, 0x17, 0xDC, 0xB0, 0xBF, 0x6F, 0xBB,
+    0x53, 0xFB, 0xB6, 0x3F, 0xB5, 0x5F, 0x0E, 0xFB, 0x75, 0x6C, 0xC7, 0x32, 0x94, 0x61, 0xAB, 0xDA,
+    0xAA, 0xB6, 0x37, 0x26, 0x94, 0x09, 0x1B, 0xA0, 0x9E, 0xFB, 0xCD, 0x1A, 0x8E, 0xF6, 0xB4, 0x6C,
+    0x66, 0xF4, 0x72, 0x7C, 0xFF, 0x28, 0x42, 0x7A, 0x7B, 0xA3, 0x45, 0xE9, 0x37, 0x90, 0xED, 0xA2,
+    0xDF, 0xBC, 0x84, 0x0D, 0x9B, 0xB9, 0x9F, 0x0F, 0x1B, 0xDC, 0xE3, 0x02, 0xEC, 0xDB, 0x20, 0x32,
+    0xE6, 0x52, 0xD2, 0x4D, 0x49, 0xEA, 0xB7, 0xEB, 0x4F, 0x39, 0x7E, 0xFF, 0xEC, 0x96, 0xCB, 0xDF,
+    0x7C, 0xE5, 0xE7, 0xE1, 0x4A, 0x2C, 0xEB, 0xDF, 0xA4, 0xF0, 0xCD, 0xE3, 0xCD, 0x02, 0xD6, 0x70,
+    0x15, 0x64, 0x23, 0x20, 0x0F, 0xC5, 0x0C, 0xE9, 0xC7, 0x01, 0x9C, 0xAB, 0x96, 0x24, 0xD4, 0x64,
+    0x3D, 0x85, 0x3F, 0xC0, 0x8C, 0x59, 0xC0, 0xE1, 0xAA, 0x3C, 0xA4, 0x91, 0x09, 0xEB, 0x0B, 0xCF,
+    0x6C, 0x46, 0xB2, 0xE0, 0xC0, 0x3D, 0x12, 0x48, 0xE3, 0x49, 0xD8, 0x7A, 0x38, 0x90, 0x8E, 0xAE,
+    0xC2, 0x3D, 0x34, 0x92, 0x87, 0xC2, 0x33, 0x31, 0x53, 0xF8, 0x2C, 0xA4, 0x23, 0xAE, 0x72, 0x55,
+    0x3A, 0x66, 0x01, 0xEB, 0xA7, 0xA5, 0xE7, 0xEC, 0x83, 0x71, 0x49, 0xE8, 0xA4, 0x0A, 0x60, 0xA7,
+    0x0D, 0x19, 0xD9, 0x91, 0xCC, 0x38, 0xF7, 0xEF, 0xB1, 0x8A, 0x48, 0x31, 0x1F, 0xB2, 0xD1, 0x55,
+    0xD9, 0x8D, 0x88, 0x7D, 0xA3, 0xA7, 0x7C, 0xBC, 0xE1, 0xCA, 0x45, 0xD2, 0x8F, 0x46, 0xF2, 0xCF,
+    0xAE, 0x76, 0x27, 0xE1, 0xBF, 0xF8, 0x95, 0x77, 0xDD, 0x55, 0x1D, 0x22, 0xF6, 0x70, 0xA4, 0xCD,
+    0xE7, 0x73, 0x63, 0x2E, 0x35, 0x99, 0x86, 0x4D, 0x4A, 0xF9, 0xDE, 0x0A, 0x23, 0x8F, 0x53, 0x93,
+    0xC6, 0xF3, 0xD8, 0x50, 0x1D, 0xED, 0x21, 0xFA, 0x85, 0x2D, 0x45, 0xBF, 0x6E, 0x35, 0x79, 0x6B,
+    0xC2, 0xBE, 0xBF, 0x6C, 0x0A, 0x2E, 0x3B, 0x16, 0x7B, 0x26, 0x9D, 0x37, 0x22, 0xA5, 0xE8, 0xF8,
+    0xF4, 0xE3, 0x79, 0x92, 0xE7, 0x85, 0x99, 0x6A, 0x8F, 0xCE, 0xF4, 0x94, 0x7E, 0x8F, 0xA4, 0xFA,
+    0x72, 0xC5, 0x03, 0x45, 0xC0, 0xBD, 0x11, 0xB1, 0xC3, 0xB4, 0x81, 0x39, 0x7E, 0xCA, 0xF1, 0xC5,
+    0xCD, 0x3C, 0xCC, 0x47, 0x48, 0xA6, 0x8D, 0x92, 0x33, 0x63, 0x7D, 0x18, 0xEF, 0xBD, 0x8D, 0xCE,
+    0x3B, 0x1D, 0xEB, 0xC3, 0x11, 0x7E, 0x83, 0x6E, 0x7F, 0x29, 0x59, 0x9F, 0x11, 0x91, 0xB8, 0xAF,
+    0x4F, 0x9E, 0xD6, 0xCD, 0xE2, 0xF1, 0x1F, 0x2B, 0x3E, 0x99, 0xDE, 0x86, 0xA3, 0xDC, 0xBB, 0x5E,
+    0x7F, 0xB7, 0x96, 0x3E, 0xBA, 0x6B, 0x39, 0x6D, 0xAA, 0xAF, 0xAE, 0x56, 0x2B, 0xA8, 0x30, 0x73,
+    0x7A, 0x5D, 0x37, 0xC7, 0x9B, 0xED, 0x74, 0xCA, 0x4C, 0x00, 0x6D, 0xF5, 0xAD, 0x76, 0xBA, 0xE8,
+    0x6A, 0x9D, 0x49, 0xD4, 0x54, 0x5B, 0x9C, 0x80, 0x13, 0xF3, 0xFA, 0xF2, 0xA1, 0xA4, 0xE4, 0xF2,
+    0xFC, 0xFC, 0xD1, 0xF3, 0xFE, 0xA9, 0x5E, 0xB4, 0x52, 0x74, 0xEB, 0x97, 0x42, 0xC5, 0x26, 0xD5,
+    0xDD, 0x61, 0xBA, 0x56, 0x53, 0xAB, 0xE9, 0x9B, 0xED, 0x77, 0x39, 0xCF, 0xF6, 0xCD, 0xB3, 0x4B,
+    0xD5, 0x36, 0xD8, 0x23, 0x5C, 0x51, 0xB2, 0xB1, 0x4F, 0x36, 0x94, 0x27, 0xEB, 0xF5, 0xFA, 0x19,
+    0x49, 0x8F, 0xEB, 0x28, 0xFD, 0x43, 0xB6, 0x54, 0xA7, 0xED, 0xD5, 0x6A, 0x0F, 0xEE, 0x27, 0x8D,
+    0x94, 0x43, 0xAA, 0xAA, 0xEC, 0x69, 0x2B, 0xEA, 0x9E, 0x6C, 0x86, 0xBA, 0x27, 0x8F, 0x8B, 0xF1,
+    0xB4, 0x5A, 0x6D, 0x1E, 0xB3, 0x00, 0x78, 0xEB, 0x86, 0x72, 0x24, 0x51, 0x43, 0x31, 0x92, 0x4E,
+    0xDC, 0x37, 0x26, 0x6A, 0x8A, 0x91, 0xBA, 0xE1, 0x1B, 0x0B, 0x90, 0xE0, 0xAE, 0xFB, 0x01, 0xBE,
+    0x4C, 0xEA, 0xA9, 0x7D, 0x1E, 0x12, 0x35, 0xE7, 0x86, 0x6C, 0x4E, 0xF4, 0x7C, 0x31, 0x9A, 0x99,
+    0x7C, 0x48, 0x66, 0x68, 0xBB, 0x72, 0x20, 0x53, 0xD5, 0x76, 0x14, 0x53, 0xAA, 0x8A, 0xDA, 0xDB,
+    0x81, 0xA4, 0x5F, 0x02, 0x26, 0x9B, 0xE3, 0x0B, 0xA4, 0x1D, 0x66, 0x44, 0x15, 0x75, 0x7F, 0xDF,
+    0x44, 0xD2, 0x76, 0xE5, 0x40, 0x2A, 0xDA, 0x8E, 0xB2, 0xCB, 0x46, 0xEA, 0xBE, 0x18, 0x13, 0x35,
+    0x75, 0xC8, 0xE6, 0x44, 0x5D, 0x36, 0xA2, 0x8A, 0x81, 0xAF, 0xDD, 0x4E, 0x66, 0x7E, 0x9A, 0x26,
+    0xEF, 0x37, 0x82, 0xAC, 0xDD, 0x98, 0xC5, 0x9F, 0xA2, 0xC9, 0xEF, 0x98, 0x56, 0x14, 0x0D, 0xE4,
+    0x1D, 0xF7, 0x7E, 0xC2, 0x12, 0x72, 0xB8, 0xA6, 0x6C, 0x4A, 0x6F, 0x7D, 0x1E, 0x4C, 0x30, 0x63,
+    0x3A, 0xD0, 0x12, 0x29, 0xFD, 0xC5, 0x05, 0xE0, 0xDF, 0xBE, 0xFF, 0xFA, 0x1D, 0x4B, 0x28, 0x99,
+    0xD7, 0x2F, 0x72, 0x70, 0x97, 0x68, 0xDE, 0xC0, 0x9A, 0x36, 0xB5, 0x2C, 0x40, 0x3A, 0xD0, 0x6A,
+    0xBA, 0x8B, 0x64, 0xFB, 0xE6, 0x48, 0xD6, 0xB7, 0x98, 0xC1, 0xF6, 0x44, 0x33, 0x72, 0x40, 0x8B,
+    0xC3, 0x35, 0x85, 0xB7, 0x5D, 0xDE, 0xD9, 0x1B, 0x8F, 0x7E, 0x74, 0x17, 0xC9, 0xED, 0xF7, 0x2A,
+    0x8A, 0xE6, 0x2E, 0xB9, 0xBF, 0xC9, 0x71, 0xAE, 0x28, 0xA5, 0xAE, 0x96, 0x86, 0xFA, 0xD6, 0xFA,
+    0xBB, 0xAE, 0x5B, 0xDE, 0x37, 0xBB, 0xBD, 0x71, 0xEF, 0xB6, 0x69, 0xF9, 0xED, 0xD5, 0x5E, 0x29,
+    0x4D, 0x89, 0xA4, 0x2A, 0xF9, 0x93, 0x75, 0xB3, 0x8C, 0xA1, 0xA6, 0x52, 0xD2, 0x23, 0x92, 0xBA,
+    0xED, 0xD5, 0x1E, 0x85, 0xD4, 0x67, 0x92, 0xAA, 0xF5, 0xBA, 0x1D, 0x58, 0x30, 0x1D, 0xC5, 0x91,
+    0x25, 0x37, 0x1D, 0x19, 0x6E, 0x57, 0x57, 0xAB, 0xF6, 0x55, 0x49, 0x7D, 0x2D, 0x75, 0xF7, 0xAC,
+    0xBF, 0x7D, 0x7B, 0x92, 0x8E, 0xB5, 0x34, 0x17, 0x92, 0x1A, 0x92, 0xEF, 0x6D, 0x36, 0x70, 0x17,
+    0x3F, 0xFE, 0x4E, 0x97, 0x0C, 0x0F, 0x64, 0x9D, 0xE5, 0xE5, 0xCC, 0xBF, 0x9C, 0xF6, 0xF9, 0x25,
+    0x9F, 0x37, 0xF6, 0xCB, 0x3C, 0xC0, 0xCE, 0xC5, 0xF5, 0xBC, 0xFE, 0x99, 0x24, 0xFD, 0xF4, 0xF5,
+    0xC7, 0xBE, 0xFD, 0xF8, 0xE3, 0x3C, 0xC0, 0xCE, 0x29, 0x5E, 0x26, 0xBC, 0x9C, 0xF6, 0x79, 0x33,
+    0xE4, 0xCD, 0xF9, 0x64, 0x7C, 0x20, 0xEF, 0x92, 0xF9, 0xFF, 0x9E, 0xA0, 0x55, 0xB3, 0x89, 0xB0,
+    0xDC, 0xE9, 0xFA, 0x47, 0x8F, 0x77, 0xC9, 0x40, 0xD6, 0xD9, 0x8A, 0xCC, 0xBF, 0x0C, 0xF9, 0x25,
+    0x0F, 0xB6, 0x00, 0x76, 0x2E, 0xAE, 0xD7, 0x47, 0x5D, 0xAF, 0x56, 0x8F, 0x3F, 0x0E, 0xEC, 0x9C,
+    0x02, 0xC2, 0xCB, 0x90, 0x37, 0x03, 0x9C, 0x4F, 0x46, 0xF2, 0x2E, 0x99, 0xFF, 0xF8, 0x57, 0x75,
+    0x1D, 0x70, 0xFE, 0x2F, 0x83, 0x79, 0xEF, 0xD2, 0x61, 0xD8, 0xB5, 0x5F, 0x36, 0x1F, 0xF6, 0x3B,
+    0x4F, 0x9A, 0x99, 0x7F, 0xD3, 0x9B, 0x90, 0xFE, 0xB4, 0x71, 0x21, 0x7F, 0xDC, 0xBC, 0x13, 0x76,
+    0x4E, 0xED, 0x9A, 0x10, 0xFE, 0xB2, 0x37, 0x1F, 0x37, 0x33, 0x26, 0xFE, 0xBA, 0x5D, 0x57, 0x38,
+    0xFF, 0x32, 0xE6, 0xBD, 0x4B, 0x9E, 0x5D, 0x5B, 0x60, 0xFA, 0x9D, 0x27, 0xD9, 0xE5, 0xDF, 0xF4,
+    0xA6, 0x4F, 0x7F, 0xDA, 0xEC, 0x92, 0x3F, 0x6E, 0x7A, 0x76, 0x4E, 0xED, 0x42, 0xF8, 0xCB, 0x9E,
+    0xBC, 0x99, 0x3F, 0x8D, 0xEA, 0xAD, 0x6A, 0x99, 0x78, 0x71, 0x99, 0x1A, 0xD6, 0xFF, 0x7A, 0xD5,
+    0x52, 0x9A, 0xDB, 0xC5, 0xEA, 0xED, 0x8F, 0x8C, 0xA7, 0xA2, 0xC9, 0x7D, 0xDE, 0xA9, 0x6A, 0x9B,
+    0xFA, 0x70, 0x4A, 0xE7, 0x44, 0x79, 0x9F, 0x05, 0x73, 0xC7, 0xAA, 0x4A, 0x5E, 0x84, 0xF6, 0xA6,
+    0x22, 0x4E, 0x52, 0x67, 0x3F, 0xAA, 0xC3, 0x95, 0x34, 0x26, 0x53, 0x5A, 0x39, 0x5F, 0x78, 0xCC,
+    0x98, 0xC6, 0x65, 0x8F, 0xB6, 0x6F, 0x25, 0xC5, 0xAD, 0xF6, 0xF5, 0xFA, 0x75, 0xB2, 0x31, 0x8D,
+    0x50, 0x37, 0xA5, 0xFF, 0xD5, 0xC5, 0x52, 0xB9, 0x7A, 0xA3, 0xA0, 0x19, 0x78, 0xA2, 0x5A, 0x60,
+    0x0D, 0x4E, 0x13, 0x76, 0x28, 0xBB, 0x34, 0x32, 0x2E, 0x16, 0xCD, 0xB8, 0xD8, 0x28, 0xBE, 0xDD,
+    0x3C, 0xC4, 0x67, 0x63, 0x1A, 0xA9, 0x9B, 0xF2, 0xB3, 0x0A, 0xA5, 0x72, 0x1D, 0x2A, 0x28, 0xC2,
+    0x13, 0xFF, 0x70, 0xE1, 0x85, 0x53, 0xC4, 0x0E, 0xCE, 0x27, 0x53, 0x1A, 0x71, 0xBE, 0xF4, 0x66,
+    0x4C, 0x63, 0xAA, 0x58, 0xFA, 0x56, 0xAF, 0xC4, 0xAD, 0xF6, 0x47, 0xE5, 0x6F, 0xDA, 0x33, 0xFC,
+    0x49, 0x05, 0xED, 0x58, 0xCB, 0xE3, 0x24, 0x09, 0x3B, 0xD4, 0x63, 0x11, 0xD2, 0xC8, 0xCC, 0x05,
+    0x9C, 0x2F, 0x3A, 0x96, 0x71, 0x5A, 0x06, 0x4A, 0x7D, 0x2B, 0x49, 0xF3, 0x56, 0xFB, 0x7A, 0xFD,
+    0xFA, 0xB9, 0x3E, 0x1B, 0xD3, 0xC8, 0x4C, 0xDD, 0x94, 0xDE, 0xFE, 0xBA, 0x95, 0x52, 0x85, 0x1E,
+    0xD6, 0x75, 0x7D, 0xA0, 0xB1, 0x9D, 0x01, 0xFE, 0xE4, 0x1F, 0x2E, 0x14, 0xF4, 0x38, 0x49, 0xF3,
+    0x42, 0x41, 0x9F, 0x46, 0xC4, 0x8C, 0xF3, 0x45, 0x67, 0x7B, 0x33, 0xA6, 0x91, 0x39, 0x95, 0x34,
+    0xDB, 0xBE, 0x95, 0xD4, 0xCF, 0x5B, 0xED, 0xEB, 0xF5, 0x8F, 0xEC, 0xDF, 0x01, 0x05, 0xC9, 0x8B,
+    0x40, 0x39, 0x03, 0xAD, 0x20, 0x89, 0x5F, 0x3B, 0x49, 0x3A, 0x12, 0x31, 0x63, 0x12, 0x97, 0x57,
+    0x2F, 0x25, 0xC5, 0x56, 0x52, 0x7C, 0x6C, 0x7A, 0x74, 0x3A, 0x9B, 0x8D, 0x69, 0xE4, 0xB3, 0x2E,
+    0x13, 0xD9, 0x98, 0xEA, 0xFF, 0x28, 0x75, 0x55, 0xD3, 0x12, 0x42, 0xDF, 0xC0, 0xFE, 0x9E, 0x07,
+    0xEC, 0x02, 0x22, 0x50, 0x03, 0x17, 0xB2, 0x08, 0xB9, 0x2F, 0x3B, 0x78, 0x39, 0x99, 0xE0, 0x51,
+    0x5F, 0xF4, 0xB4, 0xCA, 0x35, 0x95, 0xEF, 0x05, 0xE9, 0x7A, 0x28, 0x8E, 0xCF, 0x67, 0x6B, 0x42,
+    0xD1, 0x67, 0x33, 0xC9, 0x8C, 0x53, 0x55, 0xF4, 0x68, 0x4E, 0x66, 0x12, 0x0D, 0x45, 0x9F, 0x24,
+    0x7A, 0x6A, 0xE6, 0x65, 0x33, 0x16, 0xBD, 0xED, 0xDC, 0x83, 0x5A, 0xB7, 0xEA, 0xAD, 0x7E, 0xAA,
+    0x91, 0x3A, 0xB2, 0xB7, 0x31, 0xC4, 0x16, 0x2D, 0xFC, 0x24, 0xB7, 0x77, 0x0B, 0x51, 0x8F, 0x00,
+    0xDF, 0x2A, 0x1A, 0xE0, 0x5B, 0x3C, 0x09, 0x5C, 0x38, 0x96, 0x37, 0x50, 0xAB, 0x1F, 0xA1, 0xD6,
+    0x54, 0x36, 0xD4, 0xD2, 0x33, 0x23, 0xB5, 0xF4, 0x96, 0x9A, 0x5A, 0x6A, 0xDA, 0xB1, 0xD4, 0x88,
+    0x9B, 0x53, 0x45, 0xDA, 0x99, 0x52, 0x0F, 0x69, 0x26, 0xD5, 0xDB, 0x9A, 0xA1, 0x8C, 0xED, 0x0C,
+    0xE9, 0xB2, 0x6D, 0xB6, 0x7C, 0x6D, 0x06, 0xD2, 0xB0, 0x0B, 0xF0, 0xB5, 0x07, 0x60, 0x63, 0xA5,
+    0x2D, 0xBB, 0xFB, 0x16, 0x13, 0xE1, 0xFF, 0x05,
 };
 
 static const EpdGlyph bookerly_12_boldGlyphs[] = {
@@ -1602,7 +1646,7 @@ static const EpdGlyph bookerly_12_boldGlyphs[] = {
     { 4, 23, 8, 2, 20, 23, 5799 }, // |
     { 9, 25, 10, 0, 20, 57, 5822 }, // }
     { 13, 5, 16, 1, 11, 17, 5879 }, // ~
-    { 0, 0, 5, 0, 0, 0, 0 }, //  
+    { 0, 0, 5, 0, 0, 0, 5896 }, //  
     { 6, 20, 7, 0, 14, 30, 0 }, // ¡
     { 13, 25, 16, 1, 20, 82, 30 }, // ¢
     { 15, 19, 16, 0, 18, 72, 112 }, // £
@@ -1613,642 +1657,649 @@ static const EpdGlyph bookerly_12_boldGlyphs[] = {
     { 10, 5, 17, 3, 20, 13, 393 }, // ¨
     { 19, 19, 20, 0, 18, 91, 406 }, // ©
     { 9, 13, 11, 1, 18, 30, 497 }, // ª
-    { 14, 11, 15, 0, 12, 39, 527 }, // «
-    { 12, 7, 16, 2, 12, 21, 566 }, // ¬
-    { 9, 3, 10, 0, 8, 7, 587 }, // ­
-    { 14, 14, 15, 0, 20, 49, 594 }, // ®
-    { 9, 3, 17, 4, 18, 7, 643 }, // ¯
-    { 10, 10, 13, 2, 18, 25, 650 }, // °
-    { 12, 16, 16, 2, 15, 48, 675 }, // ±
-    { 10, 12, 11, 1, 21, 30, 723 }, // ²
-    { 9, 13, 11, 1, 21, 30, 753 }, // ³
-    { 5, 6, 17, 6, 21, 8, 783 }, // ´
-    { 16, 20, 16, 1, 14, 80, 791 }, // µ
-    { 15, 22, 15, 0, 18, 83, 871 }, // ¶
-    { 5, 5, 7, 1, 9, 7, 954 }, // ·
-    { 5, 6, 17, 6, -1, 8, 961 }, // ¸
-    { 9, 12, 11, 1, 21, 27, 969 }, // ¹
-    { 9, 13, 11, 1, 18, 30, 996 }, // º
-    { 13, 11, 15, 1, 12, 36, 1026 }, // »
-    { 26, 21, 27, 1, 19, 137, 1062 }, // ¼
-    { 25, 21, 27, 1, 19, 132, 1199 }, // ½
-    { 26, 21, 27, 1, 19, 137, 1331 }, // ¾
-    { 10, 20, 12, 1, 14, 50, 1468 }, // ¿
-    { 20, 25, 19, 0, 25, 125, 1518 }, // À
-    { 20, 25, 19, 0, 25, 125, 1643 }, // Á
-    { 20, 25, 19, 0, 25, 125, 1768 }, // Â
-    { 20, 24, 19, 0, 24, 120, 1893 }, // Ã
-    { 20, 24, 19, 0, 24, 120, 2013 }, // Ä
-    { 20, 25, 19, 0, 25, 125, 2133 }, // Å
-    { 25, 18, 25, -1, 18, 113, 2258 }, // Æ
-    { 15, 25, 16, 1, 18, 94, 2371 }, // Ç
-    { 16, 25, 16, 0, 25, 100, 2465 }, // È
-    { 16, 25, 16, 0, 25, 100, 2565 }, // É
-    { 16, 25, 16, 0, 25, 100, 2665 }, // Ê
-    { 16, 24, 16, 0, 24, 96, 2765 }, // Ë
-    { 10, 25, 10, 0, 25, 63, 2861 }, // Ì
-    { 10, 25, 10, 0, 25, 63, 2924 }, // Í
-    { 10, 25, 10, 0, 25, 63, 2987 }, // Î
-    { 10, 24, 10, 0, 24, 60, 3050 }, // Ï
-    { 19, 19, 19, 0, 18, 91, 3110 }, // Ð
-    { 21, 25, 20, 0, 24, 132, 3201 }, // Ñ
-    { 18, 26, 20, 1, 25, 117, 3333 }, // Ò
-    { 18, 26, 20, 1, 25, 117, 3450 }, // Ó
-    { 18, 26, 20, 1, 25, 117, 3567 }, // Ô
-    { 18, 25, 20, 1, 24, 113, 3684 }, // Õ
-    { 18, 25, 20, 1, 24, 113, 3797 }, // Ö
-    { 11, 11, 16, 2, 14, 31, 3910 }, // ×
-    { 20, 19, 20, 0, 18, 95, 3941 }, // Ø
-    { 20, 26, 20, 0, 25, 130, 4036 }, // Ù
-    { 20, 26, 20, 0, 25, 130, 4166 }, // Ú
-    { 20, 26, 20, 0, 25, 130, 4296 }, // Û
-    { 20, 25, 20, 0, 24, 125, 4426 }, // Ü
-    { 18, 25, 18, 0, 25, 113, 4551 }, // Ý
-    { 16, 18, 16, 0, 18, 72, 4664 }, // Þ
-    { 16, 21, 17, 0, 20, 84, 4736 }, // ß
-    { 14, 22, 14, 1, 21, 77, 4820 }, // à
-    { 14, 22, 14, 1, 21, 77, 4897 }, // á
-    { 14, 22, 14, 1, 21, 77, 4974 }, // â
-    { 14, 21, 14, 1, 20, 74, 5051 }, // ã
-    { 14, 21, 14, 1, 20, 74, 5125 }, // ä
-    { 14, 22, 14, 1, 21, 77, 5199 }, // å
-    { 19, 15, 21, 1, 14, 72, 5276 }, // æ
-    { 13, 21, 13, 0, 14, 69, 5348 }, // ç
-    { 13, 22, 14, 0, 21, 72, 5417 }, // è
-    { 13, 22, 14, 0, 21, 72, 5489 }, // é
-    { 13, 22, 14, 0, 21, 72, 5561 }, // ê
-    { 13, 21, 14, 0, 20, 69, 5633 }, // ë
-    { 9, 21, 9, 0, 21, 48, 5702 }, // ì
-    { 9, 21, 9, 0, 21, 48, 5750 }, // í
-    { 9, 21, 9, 0, 21, 48, 5798 }, // î
-    { 10, 20, 9, 0, 20, 50, 5846 }, // ï
-    { 15, 22, 15, 0, 21, 83, 5896 }, // ð
-    { 17, 20, 17, 0, 20, 85, 5979 }, // ñ
-    { 15, 22, 15, 0, 21, 83, 6064 }, // ò
-    { 15, 22, 15, 0, 21, 83, 6147 }, // ó
-    { 15, 22, 15, 0, 21, 83, 6230 }, // ô
-    { 15, 21, 15, 0, 20, 79, 6313 }, // õ
-    { 15, 21, 15, 0, 20, 79, 6392 }, // ö
-    { 12, 13, 16, 2, 15, 39, 6471 }, // ÷
-    { 15, 15, 15, 0, 14, 57, 6510 }, // ø
-    { 17, 22, 16, 0, 21, 94, 6567 }, // ù
-    { 17, 22, 16, 0, 21, 94, 6661 }, // ú
-    { 17, 22, 16, 0, 21, 94, 6755 }, // û
-    { 17, 21, 16, 0, 20, 90, 6849 }, // ü
-    { 17, 27, 16, 0, 21, 115, 6939 }, // ý
-    { 15, 26, 16, 0, 20, 98, 7054 }, // þ
-    { 17, 26, 16, 0, 20, 111, 7152 }, // ÿ
-    { 20, 23, 19, 0, 23, 115, 0 }, // Ā
-    { 14, 19, 14, 1, 18, 67, 115 }, // ā
-    { 20, 24, 19, 0, 24, 120, 182 }, // Ă
-    { 14, 21, 14, 1, 20, 74, 302 }, // ă
-    { 20, 24, 19, 0, 18, 120, 376 }, // Ą
-    { 14, 20, 14, 1, 14, 70, 496 }, // ą
-    { 15, 26, 16, 1, 25, 98, 566 }, // Ć
-    { 13, 22, 13, 0, 21, 72, 664 }, // ć
-    { 15, 26, 16, 1, 25, 98, 736 }, // Ĉ
-    { 13, 22, 13, 0, 21, 72, 834 }, // ĉ
-    { 15, 25, 16, 1, 24, 94, 906 }, // Ċ
-    { 13, 21, 13, 0, 20, 69, 1000 }, // ċ
-    { 15, 26, 16, 1, 25, 98, 1069 }, // Č
-    { 13, 22, 13, 0, 21, 72, 1167 }, // č
-    { 19, 26, 19, 0, 25, 124, 1239 }, // Ď
-    { 18, 21, 16, 0, 20, 95, 1363 }, // ď
-    { 19, 19, 19, 0, 18, 91, 1458 }, // Đ
-    { 16, 21, 16, 0, 20, 84, 1549 }, // đ
-    { 16, 23, 16, 0, 23, 92, 1633 }, // Ē
-    { 13, 19, 14, 0, 18, 62, 1725 }, // ē
-    { 16, 24, 16, 0, 24, 96, 1787 }, // Ĕ
-    { 13, 21, 14, 0, 20, 69, 1883 }, // ĕ
-    { 16, 24, 16, 0, 24, 96, 1952 }, // Ė
-    { 13, 21, 14, 0, 20, 69, 2048 }, // ė
-    { 16, 24, 16, 0, 18, 96, 2117 }, // Ę
-    { 13, 20, 14, 0, 14, 65, 2213 }, // ę
-    { 16, 25, 16, 0, 25, 100, 2278 }, // Ě
-    { 13, 22, 14, 0, 21, 72, 2378 }, // ě
-    { 17, 26, 19, 1, 25, 111, 2450 }, // Ĝ
-    { 15, 27, 15, 0, 21, 102, 2561 }, // ĝ
-    { 17, 25, 19, 1, 24, 107, 2663 }, // Ğ
-    { 15, 26, 15, 0, 20, 98, 2770 }, // ğ
-    { 17, 25, 19, 1, 24, 107, 2868 }, // Ġ
-    { 15, 26, 15, 0, 20, 98, 2975 }, // ġ
-    { 17, 25, 19, 1, 18, 107, 3073 }, // Ģ
-    { 15, 28, 15, 0, 22, 105, 3180 }, // ģ
-    { 21, 25, 22, 0, 25, 132, 3285 }, // Ĥ
-    { 18, 26, 17, -1, 26, 117, 3417 }, // ĥ
-    { 21, 18, 22, 0, 18, 95, 3534 }, // Ħ
-    { 17, 20, 17, 0, 20, 85, 3629 }, // ħ
-    { 10, 24, 10, 0, 24, 60, 3714 }, // Ĩ
-    { 9, 20, 9, 0, 20, 45, 3774 }, // ĩ
-    { 10, 23, 10, 0, 23, 58, 3819 }, // Ī
-    { 9, 18, 9, 0, 18, 41, 3877 }, // ī
-    { 10, 24, 10, 0, 24, 60, 3918 }, // Ĭ
-    { 9, 20, 9, 0, 20, 45, 3978 }, // ĭ
-    { 10, 24, 10, 0, 18, 60, 4023 }, // Į
-    { 10, 26, 9, 0, 20, 65, 4083 }, // į
-    { 10, 24, 10, 0, 24, 60, 4148 }, // İ
-    { 9, 14, 9, 0, 14, 32, 4208 }, // ı
-    { 20, 24, 20, 0, 18, 120, 4240 }, // Ĳ
-    { 16, 26, 17, 0, 20, 104, 4360 }, // ĳ
-    { 12, 31, 10, -2, 25, 93, 4464 }, // Ĵ
-    { 11, 27, 8, -2, 21, 75, 4557 }, // ĵ
-    { 19, 25, 19, 0, 18, 119, 4632 }, // Ķ
-    { 16, 27, 16, 0, 20, 108, 4751 }, // ķ
-    { 17, 15, 16, 0, 14, 64, 4859 }, // ĸ
-    { 16, 25, 16, 0, 25, 100, 4923 }, // Ĺ
-    { 9, 26, 9, 0, 26, 59, 5023 }, // ĺ
-    { 16, 25, 16, 0, 18, 100, 5082 }, // Ļ
-    { 9, 27, 9, 0, 20, 61, 5182 }, // ļ
-    { 16, 20, 16, 0, 20, 80, 5243 }, // Ľ
-    { 11, 20, 9, 0, 20, 55, 5323 }, // ľ
-    { 16, 18, 16, 0, 18, 72, 5378 }, // Ŀ
-    { 14, 20, 13, 0, 20, 70, 5450 }, // ŀ
-    { 17, 18, 16, -1, 18, 77, 5520 }, // Ł
-    { 10, 20, 9, -1, 20, 50, 5597 }, // ł
-    { 21, 26, 20, 0, 25, 137, 5647 }, // Ń
-    { 17, 21, 17, 0, 21, 90, 5784 }, // ń
-    { 21, 25, 20, 0, 18, 132, 5874 }, // Ņ
-    { 17, 21, 17, 0, 14, 90, 6006 }, // ņ
-    { 21, 26, 20, 0, 25, 137, 6096 }, // Ň
-    { 17, 21, 17, 0, 21, 90, 6233 }, // ň
-    { 23, 18, 23, 0, 18, 104, 6323 }, // ŉ
-    { 21, 23, 20, 0, 18, 121, 6427 }, // Ŋ
-    { 15, 20, 16, 0, 14, 75, 6548 }, // ŋ
-    { 18, 24, 20, 1, 23, 108, 6623 }, // Ō
-    { 15, 19, 15, 0, 18, 72, 6731 }, // ō
-    { 18, 25, 20, 1, 24, 113, 6803 }, // Ŏ
-    { 15, 21, 15, 0, 20, 79, 6916 }, // ŏ
-    { 18, 26, 20, 1, 25, 117, 6995 }, // Ő
-    { 15, 22, 15, 0, 21, 83, 7112 }, // ő
-    { 24, 19, 25, 1, 18, 114, 7195 }, // Œ
-    { 22, 15, 23, 0, 14, 83, 7309 }, // œ
-    { 19, 26, 18, 0, 25, 124, 7392 }, // Ŕ
-    { 12, 21, 12, 0, 21, 63, 7516 }, // ŕ
-    { 19, 25, 18, 0, 18, 119, 7579 }, // Ŗ
-    { 12, 21, 12, 0, 14, 63, 7698 }, // ŗ
-    { 19, 26, 18, 0, 25, 124, 7761 }, // Ř
-    { 12, 21, 12, 0, 21, 63, 7885 }, // ř
-    { 13, 26, 15, 1, 25, 85, 7948 }, // Ś
-    { 11, 22, 13, 1, 21, 61, 8033 }, // ś
-    { 13, 26, 15, 1, 25, 85, 8094 }, // Ŝ
-    { 11, 22, 13, 1, 21, 61, 8179 }, // ŝ
-    { 13, 25, 15, 1, 18, 82, 8240 }, // Ş
-    { 11, 21, 13, 1, 14, 58, 8322 }, // ş
-    { 13, 26, 15, 1, 25, 85, 8380 }, // Š
-    { 11, 22, 13, 1, 21, 61, 8465 }, // š
-    { 18, 25, 18, 0, 18, 113, 8526 }, // Ţ
-    { 12, 24, 11, -1, 17, 72, 8639 }, // ţ
-    { 18, 25, 18, 0, 25, 113, 8711 }, // Ť
-    { 12, 21, 11, -1, 20, 63, 8824 }, // ť
-    { 18, 18, 18, 0, 18, 81, 8887 }, // Ŧ
-    { 12, 18, 11, -1, 17, 54, 8968 }, // ŧ
-    { 20, 25, 20, 0, 24, 125, 9022 }, // Ũ
-    { 17, 21, 16, 0, 20, 90, 9147 }, // ũ
-    { 20, 24, 20, 0, 23, 120, 9237 }, // Ū
-    { 17, 19, 16, 0, 18, 81, 9357 }, // ū
-    { 20, 25, 20, 0, 24, 125, 9438 }, // Ŭ
-    { 17, 21, 16, 0, 20, 90, 9563 }, // ŭ
-    { 20, 26, 20, 0, 25, 130, 9653 }, // Ů
-    { 17, 22, 16, 0, 21, 94, 9783 }, // ů
-    { 20, 26, 20, 0, 25, 130, 9877 }, // Ű
-    { 17, 22, 16, 0, 21, 94, 10007 }, // ű
-    { 20, 24, 20, 0, 18, 120, 10101 }, // Ų
-    { 17, 20, 16, 0, 14, 85, 10221 }, // ų
-    { 28, 26, 28, 0, 25, 182, 10306 }, // Ŵ
-    { 23, 22, 23, 0, 21, 127, 10488 }, // ŵ
-    { 18, 25, 18, 0, 25, 113, 10615 }, // Ŷ
-    { 17, 27, 16, 0, 21, 115, 10728 }, // ŷ
-    { 18, 24, 18, 0, 24, 108, 10843 }, // Ÿ
-    { 15, 26, 15, 0, 25, 98, 10951 }, // Ź
-    { 13, 22, 13, 0, 21, 72, 11049 }, // ź
-    { 15, 25, 15, 0, 24, 94, 11121 }, // Ż
-    { 13, 21, 13, 0, 20, 69, 11215 }, // ż
-    { 15, 26, 15, 0, 25, 98, 11284 }, // Ž
-    { 13, 22, 13, 0, 21, 72, 11382 }, // ž
-    { 13, 20, 10, 0, 20, 65, 11454 }, // ſ
-    { 6, 6, 0, -4, 21, 9, 0 }, // ̀
-    { 5, 6, 0, -2, 21, 8, 9 }, // ́
-    { 10, 7, 0, -5, 21, 18, 17 }, // ̂
-    { 10, 5, 0, -5, 20, 13, 35 }, // ̃
-    { 10, 3, 0, -5, 18, 8, 48 }, // ̄
-    { 10, 5, 0, -5, 20, 13, 56 }, // ̆
-    { 6, 5, 0, -3, 20, 8, 69 }, // ̇
-    { 10, 5, 0, -5, 20, 13, 77 }, // ̈
-    { 8, 7, 0, -4, 22, 14, 90 }, // ̉
-    { 8, 7, 0, -4, 21, 14, 104 }, // ̊
-    { 10, 7, 0, -4, 21, 18, 118 }, // ̋
-    { 10, 6, 0, -5, 21, 15, 136 }, // ̌
-    { 10, 7, 0, -6, 21, 18, 151 }, // ̏
-    { 10, 5, 0, -5, 20, 13, 169 }, // ̑
-    { 5, 8, 0, -3, 22, 10, 182 }, // ̒
-    { 5, 7, 0, -2, 22, 9, 192 }, // ̓
-    { 5, 7, 0, -3, 22, 9, 201 }, // ̔
-    { 4, 7, 0, -2, 22, 7, 210 }, // ̕
-    { 5, 6, 0, -3, 16, 8, 217 }, // ̛
-    { 6, 5, 0, -3, -1, 8, 225 }, // ̣
-    { 10, 4, 0, -5, -2, 10, 233 }, // ̤
-    { 6, 6, 0, -3, -1, 9, 243 }, // ̥
-    { 5, 6, 0, -3, -1, 8, 252 }, // ̦
-    { 6, 6, 0, -3, -1, 9, 260 }, // ̧
-    { 6, 7, 0, -3, 1, 11, 269 }, // ̨
-    { 3, 7, 7, 2, -1, 6, 280 }, // ̩
-    { 10, 6, 0, -5, -1, 15, 286 }, // ̭
-    { 10, 6, 0, -5, -1, 15, 301 }, // ̮
-    { 10, 5, 0, -5, -2, 13, 316 }, // ̰
-    { 10, 3, 0, -5, -2, 8, 329 }, // ̱
-    { 10, 5, 0, -5, 20, 13, 337 }, // ͂
-    { 10, 11, 0, -5, 26, 28, 350 }, // ̈́
-    { 5, 6, 0, -2, -1, 8, 378 }, // ͅ
-    { 16, 25, 16, 0, 25, 100, 0 }, // Ѐ
-    { 16, 24, 16, 0, 24, 96, 100 }, // Ё
-    { 21, 24, 22, 0, 18, 126, 196 }, // Ђ
-    { 15, 25, 16, 0, 25, 94, 322 }, // Ѓ
-    { 16, 19, 17, 1, 18, 76, 416 }, // Є
-    { 13, 19, 15, 1, 18, 62, 492 }, // Ѕ
-    { 10, 18, 10, 0, 18, 45, 554 }, // І
-    { 10, 24, 10, 0, 24, 60, 599 }, // Ї
-    { 12, 24, 10, -2, 18, 72, 659 }, // Ј
-    { 24, 19, 25, 0, 18, 114, 731 }, // Љ
-    { 26, 19, 27, 0, 18, 124, 845 }, // Њ
-    { 23, 18, 23, 0, 18, 104, 969 }, // Ћ
-    { 19, 26, 19, 0, 25, 124, 1073 }, // Ќ
-    { 21, 25, 21, 0, 25, 132, 1197 }, // Ѝ
-    { 18, 25, 18, 0, 24, 113, 1329 }, // Ў
-    { 20, 24, 21, 0, 18, 120, 1442 }, // Џ
-    { 20, 18, 19, 0, 18, 90, 1562 }, // А
-    { 16, 19, 16, 0, 18, 76, 1652 }, // Б
-    { 16, 19, 16, 0, 18, 76, 1728 }, // В
-    { 15, 18, 16, 0, 18, 68, 1804 }, // Г
-    { 20, 24, 20, 0, 18, 120, 1872 }, // Д
-    { 16, 18, 16, 0, 18, 72, 1992 }, // Е
-    { 28, 19, 28, 0, 18, 133, 2064 }, // Ж
-    { 15, 19, 16, 0, 18, 72, 2197 }, // З
-    { 21, 18, 21, 0, 18, 95, 2269 }, // И
-    { 21, 24, 21, 0, 24, 126, 2364 }, // Й
-    { 19, 19, 19, 0, 18, 91, 2490 }, // К
-    { 19, 19, 19, 0, 18, 91, 2581 }, // Л
-    { 24, 18, 24, 0, 18, 108, 2672 }, // М
-    { 21, 18, 22, 0, 18, 95, 2780 }, // Н
-    { 18, 19, 20, 1, 18, 86, 2875 }, // О
-    { 21, 18, 21, 0, 18, 95, 2961 }, // П
-    { 16, 18, 16, 0, 18, 72, 3056 }, // Р
-    { 15, 19, 16, 1, 18, 72, 3128 }, // С
-    { 18, 18, 18, 0, 18, 81, 3200 }, // Т
-    { 18, 19, 18, 0, 18, 86, 3281 }, // У
-    { 20, 19, 20, 0, 18, 95, 3367 }, // Ф
-    { 19, 18, 19, 0, 18, 86, 3462 }, // Х
-    { 21, 24, 21, 0, 18, 126, 3548 }, // Ц
-    { 19, 18, 19, 0, 18, 86, 3674 }, // Ч
-    { 27, 18, 28, 0, 18, 122, 3760 }, // Ш
-    { 28, 24, 28, 0, 18, 168, 3882 }, // Щ
-    { 19, 19, 20, 0, 18, 91, 4050 }, // Ъ
-    { 25, 19, 26, 0, 18, 119, 4141 }, // Ы
-    { 16, 19, 16, 0, 18, 76, 4260 }, // Ь
-    { 17, 19, 17, 0, 18, 81, 4336 }, // Э
-    { 27, 19, 28, 0, 18, 129, 4417 }, // Ю
-    { 18, 19, 18, 0, 18, 86, 4546 }, // Я
-    { 14, 15, 14, 1, 14, 53, 4632 }, // а
-    { 14, 21, 15, 0, 20, 74, 4685 }, // б
-    { 14, 15, 15, 0, 14, 53, 4759 }, // в
-    { 13, 13, 13, 0, 13, 43, 4812 }, // г
-    { 17, 18, 17, 0, 13, 77, 4855 }, // д
-    { 13, 15, 14, 0, 14, 49, 4932 }, // е
-    { 23, 15, 22, 0, 14, 87, 4981 }, // ж
-    { 13, 15, 13, 0, 14, 49, 5068 }, // з
-    { 17, 13, 17, 0, 13, 56, 5117 }, // и
-    { 17, 20, 17, 0, 20, 85, 5173 }, // й
-    { 16, 15, 16, 0, 14, 60, 5258 }, // к
-    { 16, 14, 16, 0, 13, 56, 5318 }, // л
-    { 19, 13, 20, 0, 13, 62, 5374 }, // м
-    { 17, 13, 18, 0, 13, 56, 5436 }, // н
-    { 15, 15, 15, 0, 14, 57, 5492 }, // о
-    { 17, 13, 17, 0, 13, 56, 5549 }, // п
-    { 15, 20, 16, 0, 14, 75, 5605 }, // р
-    { 13, 15, 13, 0, 14, 49, 5680 }, // с
-    { 15, 13, 15, 0, 13, 49, 5729 }, // т
-    { 17, 19, 16, 0, 13, 81, 5778 }, // у
-    { 19, 26, 20, 0, 20, 124, 5859 }, // ф
-    { 16, 13, 16, 0, 13, 52, 5983 }, // х
-    { 18, 18, 18, 0, 13, 81, 6035 }, // ц
-    { 16, 13, 16, 0, 13, 52, 6116 }, // ч
-    { 23, 13, 23, 0, 13, 75, 6168 }, // ш
-    { 23, 18, 23, 0, 13, 104, 6243 }, // щ
-    { 16, 14, 17, 0, 13, 56, 6347 }, // ъ
-    { 22, 14, 22, 0, 13, 77, 6403 }, // ы
-    { 14, 14, 14, 0, 13, 49, 6480 }, // ь
-    { 13, 15, 14, 0, 14, 49, 6529 }, // э
-    { 22, 15, 22, 0, 14, 83, 6578 }, // ю
-    { 15, 14, 15, 0, 13, 53, 6661 }, // я
-    { 13, 22, 14, 0, 21, 72, 6714 }, // ѐ
-    { 13, 21, 14, 0, 20, 69, 6786 }, // ё
-    { 15, 26, 16, 0, 20, 98, 6855 }, // ђ
-    { 13, 21, 13, 0, 21, 69, 6953 }, // ѓ
-    { 13, 15, 13, 0, 14, 49, 7022 }, // є
-    { 11, 15, 13, 1, 14, 42, 7071 }, // ѕ
-    { 9, 20, 9, 0, 20, 45, 7113 }, // і
-    { 10, 20, 9, 0, 20, 50, 7158 }, // ї
-    { 9, 26, 8, -2, 20, 59, 7208 }, // ј
-    { 20, 14, 20, 0, 13, 70, 7267 }, // љ
-    { 22, 14, 22, 0, 13, 77, 7337 }, // њ
-    { 17, 20, 17, 0, 20, 85, 7414 }, // ћ
-    { 16, 22, 16, 0, 21, 88, 7499 }, // ќ
-    { 17, 21, 17, 0, 21, 90, 7587 }, // ѝ
-    { 17, 26, 16, 0, 20, 111, 7677 }, // ў
-    { 17, 18, 17, 0, 13, 77, 7788 }, // џ
-    { 19, 21, 19, 0, 20, 100, 7865 }, // Ѣ
-    { 16, 19, 16, 0, 18, 76, 7965 }, // ѣ
-    { 18, 19, 20, 1, 18, 86, 8041 }, // Ѳ
-    { 15, 15, 15, 0, 14, 57, 8127 }, // ѳ
-    { 20, 19, 20, 0, 18, 95, 8184 }, // Ѵ
-    { 17, 15, 17, 0, 14, 64, 8279 }, // ѵ
-    { 21, 30, 21, 0, 24, 158, 8343 }, // Ҋ
-    { 17, 25, 17, 0, 20, 107, 8501 }, // ҋ
-    { 16, 19, 16, 0, 18, 76, 8608 }, // Ҍ
-    { 13, 19, 14, 0, 18, 62, 8684 }, // ҍ
-    { 16, 18, 16, 0, 18, 72, 8746 }, // Ҏ
-    { 15, 20, 16, 0, 14, 75, 8818 }, // ҏ
-    { 14, 21, 14, 0, 21, 74, 8893 }, // Ґ
-    { 12, 17, 13, 0, 17, 51, 8967 }, // ґ
-    { 15, 18, 15, 0, 18, 68, 9018 }, // Ғ
-    { 13, 13, 13, 0, 13, 43, 9086 }, // ғ
-    { 17, 24, 18, 0, 18, 102, 9129 }, // Ҕ
-    { 15, 19, 15, 0, 13, 72, 9231 }, // ҕ
-    { 28, 24, 28, 0, 18, 168, 9303 }, // Җ
-    { 23, 19, 22, 0, 14, 110, 9471 }, // җ
-    { 15, 24, 16, 0, 18, 90, 9581 }, // Ҙ
-    { 13, 19, 13, 0, 14, 62, 9671 }, // ҙ
-    { 19, 24, 19, 0, 18, 114, 9733 }, // Қ
-    { 16, 19, 16, 0, 14, 76, 9847 }, // қ
-    { 20, 19, 20, 0, 18, 95, 9923 }, // Ҝ
-    { 17, 15, 17, 0, 14, 64, 10018 }, // ҝ
-    { 19, 19, 19, 0, 18, 91, 10082 }, // Ҟ
-    { 16, 19, 16, 0, 18, 76, 10173 }, // ҟ
-    { 22, 19, 22, 0, 18, 105, 10249 }, // Ҡ
-    { 19, 15, 19, 0, 14, 72, 10354 }, // ҡ
-    { 22, 24, 22, 0, 18, 132, 10426 }, // Ң
-    { 18, 18, 18, 0, 13, 81, 10558 }, // ң
-    { 25, 18, 25, 0, 18, 113, 10639 }, // Ҥ
-    { 20, 13, 21, 0, 13, 65, 10752 }, // ҥ
-    { 27, 24, 28, 0, 18, 162, 10817 }, // Ҧ
-    { 23, 19, 24, 0, 13, 110, 10979 }, // ҧ
-    { 20, 19, 21, 1, 18, 95, 11089 }, // Ҩ
-    { 17, 15, 17, 0, 14, 64, 11184 }, // ҩ
-    { 15, 24, 16, 1, 18, 90, 11248 }, // Ҫ
-    { 13, 19, 13, 0, 14, 62, 11338 }, // ҫ
-    { 18, 24, 18, 0, 18, 108, 11400 }, // Ҭ
-    { 15, 18, 15, 0, 13, 68, 11508 }, // ҭ
-    { 18, 18, 18, 0, 18, 81, 11576 }, // Ү
-    { 17, 19, 16, 0, 13, 81, 11657 }, // ү
-    { 18, 18, 18, 0, 18, 81, 11738 }, // Ұ
-    { 17, 19, 16, 0, 13, 81, 11819 }, // ұ
-    { 20, 24, 20, 0, 18, 120, 11900 }, // Ҳ
-    { 16, 18, 16, 0, 13, 72, 12020 }, // ҳ
-    { 23, 24, 23, 0, 18, 138, 12092 }, // Ҵ
-    { 20, 18, 20, 0, 13, 90, 12230 }, // ҵ
-    { 20, 24, 20, 0, 18, 120, 12320 }, // Ҷ
-    { 16, 18, 16, 0, 13, 72, 12440 }, // ҷ
-    { 19, 18, 19, 0, 18, 86, 12512 }, // Ҹ
-    { 16, 13, 16, 0, 13, 52, 12598 }, // ҹ
-    { 20, 18, 19, 0, 18, 90, 12650 }, // Һ
-    { 17, 20, 17, 0, 20, 85, 12740 }, // һ
-    { 21, 19, 21, 0, 18, 100, 12825 }, // Ҽ
-    { 16, 15, 17, 0, 14, 60, 12925 }, // ҽ
-    { 21, 24, 21, 0, 18, 126, 12985 }, // Ҿ
-    { 16, 19, 17, 0, 14, 76, 13111 }, // ҿ
-    { 10, 18, 10, 0, 18, 45, 13187 }, // Ӏ
-    { 28, 25, 28, 0, 24, 175, 13232 }, // Ӂ
-    { 23, 21, 22, 0, 20, 121, 13407 }, // ӂ
-    { 18, 24, 19, 0, 18, 108, 13528 }, // Ӄ
-    { 15, 20, 16, 0, 14, 75, 13636 }, // ӄ
-    { 19, 24, 19, 0, 18, 114, 13711 }, // Ӆ
-    { 16, 18, 16, 0, 13, 72, 13825 }, // ӆ
-    { 21, 24, 21, 0, 18, 126, 13897 }, // Ӈ
-    { 17, 19, 17, 0, 13, 81, 14023 }, // ӈ
-    { 21, 24, 21, 0, 18, 126, 14104 }, // Ӊ
-    { 18, 18, 18, 0, 13, 81, 14230 }, // ӊ
-    { 19, 24, 19, 0, 18, 114, 14311 }, // Ӌ
-    { 16, 18, 16, 0, 13, 72, 14425 }, // ӌ
-    { 24, 24, 24, 0, 18, 144, 14497 }, // Ӎ
-    { 20, 18, 20, 0, 13, 90, 14641 }, // ӎ
-    { 9, 20, 10, 1, 20, 45, 14731 }, // ӏ
-    { 20, 24, 19, 0, 24, 120, 14776 }, // Ӑ
-    { 14, 21, 14, 1, 20, 74, 14896 }, // ӑ
-    { 20, 24, 19, 0, 24, 120, 14970 }, // Ӓ
-    { 14, 21, 14, 1, 20, 74, 15090 }, // ӓ
-    { 25, 18, 25, -1, 18, 113, 15164 }, // Ӕ
-    { 19, 15, 21, 1, 14, 72, 15277 }, // ӕ
-    { 16, 24, 16, 0, 24, 96, 15349 }, // Ӗ
-    { 13, 21, 14, 0, 20, 69, 15445 }, // ӗ
-    { 16, 19, 17, 1, 18, 76, 15514 }, // Ә
-    { 13, 15, 14, 0, 14, 49, 15590 }, // ә
-    { 16, 25, 17, 1, 24, 100, 15639 }, // Ӛ
-    { 13, 21, 14, 0, 20, 69, 15739 }, // ӛ
-    { 28, 25, 28, 0, 24, 175, 15808 }, // Ӝ
-    { 23, 21, 22, 0, 20, 121, 15983 }, // ӝ
-    { 15, 25, 16, 0, 24, 94, 16104 }, // Ӟ
-    { 13, 21, 13, 0, 20, 69, 16198 }, // ӟ
-    { 14, 19, 15, 0, 18, 67, 16267 }, // Ӡ
-    { 13, 19, 14, 0, 13, 62, 16334 }, // ӡ
-    { 21, 23, 21, 0, 23, 121, 16396 }, // Ӣ
-    { 17, 18, 17, 0, 18, 77, 16517 }, // ӣ
-    { 21, 24, 21, 0, 24, 126, 16594 }, // Ӥ
-    { 17, 20, 17, 0, 20, 85, 16720 }, // ӥ
-    { 18, 25, 20, 1, 24, 113, 16805 }, // Ӧ
-    { 15, 21, 15, 0, 20, 79, 16918 }, // ӧ
-    { 18, 19, 20, 1, 18, 86, 16997 }, // Ө
-    { 15, 15, 15, 0, 14, 57, 17083 }, // ө
-    { 18, 25, 20, 1, 24, 113, 17140 }, // Ӫ
-    { 15, 21, 15, 0, 20, 79, 17253 }, // ӫ
-    { 17, 25, 17, 0, 24, 107, 17332 }, // Ӭ
-    { 13, 21, 14, 0, 20, 69, 17439 }, // ӭ
-    { 18, 24, 18, 0, 23, 108, 17508 }, // Ӯ
-    { 17, 24, 16, 0, 18, 102, 17616 }, // ӯ
-    { 18, 25, 18, 0, 24, 113, 17718 }, // Ӱ
-    { 17, 26, 16, 0, 20, 111, 17831 }, // ӱ
-    { 18, 26, 18, 0, 25, 117, 17942 }, // Ӳ
-    { 17, 27, 16, 0, 21, 115, 18059 }, // ӳ
-    { 19, 24, 19, 0, 24, 114, 18174 }, // Ӵ
-    { 16, 20, 16, 0, 20, 80, 18288 }, // ӵ
-    { 15, 24, 16, 0, 18, 90, 18368 }, // Ӷ
-    { 13, 18, 13, 0, 13, 59, 18458 }, // ӷ
-    { 25, 25, 26, 0, 24, 157, 18517 }, // Ӹ
-    { 22, 21, 22, 0, 20, 116, 18674 }, // ӹ
-    { 15, 24, 15, 0, 18, 90, 18790 }, // Ӻ
-    { 13, 18, 13, 0, 13, 59, 18880 }, // ӻ
-    { 19, 24, 19, 0, 18, 114, 18939 }, // Ӽ
-    { 15, 19, 15, 0, 13, 72, 19053 }, // ӽ
-    { 19, 18, 19, 0, 18, 86, 19125 }, // Ӿ
-    { 16, 13, 16, 0, 13, 52, 19211 }, // ӿ
-    { 0, 0, 13, 0, 0, 0, 0 }, //  
-    { 0, 0, 25, 0, 0, 0, 0 }, //  
-    { 0, 0, 13, 0, 0, 0, 0 }, //  
-    { 0, 0, 25, 0, 0, 0, 0 }, //  
-    { 0, 0, 8, 0, 0, 0, 0 }, //  
-    { 0, 0, 6, 0, 0, 0, 0 }, //  
-    { 0, 0, 4, 0, 0, 0, 0 }, //  
-    { 0, 0, 16, 0, 0, 0, 0 }, //  
-    { 0, 0, 7, 0, 0, 0, 0 }, //  
-    { 0, 0, 5, 0, 0, 0, 0 }, //  
-    { 0, 0, 1, 0, 0, 0, 0 }, //  
-    { 0, 0, 0, 0, 0, 0, 0 }, // ​
-    { 2, 21, 0, -1, 15, 11, 0 }, // ‌
-    { 6, 23, 0, -3, 17, 35, 11 }, // ‍
-    { 8, 24, 0, -4, 18, 48, 46 }, // ‎
-    { 8, 24, 0, -4, 18, 48, 94 }, // ‏
-    { 9, 3, 10, 0, 8, 7, 142 }, // ‐
-    { 9, 3, 10, 0, 8, 7, 149 }, // ‑
-    { 13, 3, 16, 1, 10, 10, 156 }, // ‒
-    { 13, 3, 13, 0, 8, 10, 166 }, // –
-    { 25, 3, 25, 0, 8, 19, 176 }, // —
-    { 25, 3, 25, 0, 8, 19, 195 }, // ―
-    { 9, 26, 13, 2, 20, 59, 214 }, // ‖
-    { 13, 7, 13, 0, -1, 23, 273 }, // ‗
-    { 6, 9, 6, 0, 19, 14, 296 }, // ‘
-    { 6, 9, 6, 0, 19, 14, 310 }, // ’
-    { 6, 9, 6, 0, 4, 14, 324 }, // ‚
-    { 6, 9, 6, 0, 19, 14, 338 }, // ‛
-    { 11, 9, 11, 0, 19, 25, 352 }, // “
-    { 11, 9, 11, 0, 19, 25, 377 }, // ”
-    { 11, 9, 11, 0, 4, 25, 402 }, // „
-    { 11, 9, 11, 0, 19, 25, 427 }, // ‟
-    { 12, 17, 12, 0, 18, 51, 452 }, // †
-    { 12, 20, 12, 0, 18, 60, 503 }, // ‡
-    { 6, 7, 8, 1, 10, 11, 563 }, // •
-    { 9, 9, 16, 3, 13, 21, 574 }, // ‣
-    { 5, 5, 7, 1, 4, 7, 595 }, // ․
-    { 12, 5, 13, 0, 4, 15, 602 }, // ‥
-    { 23, 5, 25, 1, 4, 29, 617 }, // …
-    { 5, 5, 7, 1, 9, 7, 646 }, // ‧
-    { 0, 0, 0, 0, 0, 0, 653 }, //  
-    { 0, 0, 0, 0, 0, 0, 653 }, //  
-    { 8, 24, 0, -4, 18, 48, 653 }, // ‪
-    { 8, 24, 0, -4, 18, 48, 701 }, // ‫
-    { 8, 24, 0, -4, 18, 48, 749 }, // ‬
-    { 11, 24, 0, -5, 18, 66, 797 }, // ‭
-    { 11, 24, 0, -5, 18, 66, 863 }, // ‮
-    { 0, 0, 3, 0, 0, 0, 929 }, //  
-    { 33, 21, 35, 1, 19, 174, 929 }, // ‰
-    { 7, 9, 7, 0, 18, 16, 1103 }, // ′
-    { 12, 9, 12, 0, 18, 27, 1119 }, // ″
-    { 18, 9, 18, 0, 18, 41, 1146 }, // ‴
-    { 7, 9, 7, 0, 18, 16, 1187 }, // ‵
-    { 12, 9, 13, 0, 18, 27, 1203 }, // ‶
-    { 18, 9, 18, 0, 18, 41, 1230 }, // ‷
-    { 11, 6, 12, 1, 0, 17, 1271 }, // ‸
-    { 8, 11, 8, 0, 12, 22, 1288 }, // ‹
-    { 7, 11, 8, 1, 12, 20, 1310 }, // ›
-    { 16, 18, 16, 0, 17, 72, 1330 }, // ※
-    { 13, 20, 15, 1, 19, 65, 1402 }, // ‼
-    { 13, 3, 13, 0, 21, 10, 1467 }, // ‾
-    { 7, 3, 8, 0, 8, 6, 1477 }, // ⁃
-    { 14, 21, 5, -5, 19, 74, 1483 }, // ⁄
-    { 22, 20, 23, 1, 19, 110, 1557 }, // ⁇
-    { 18, 20, 19, 1, 19, 90, 1667 }, // ⁈
-    { 18, 20, 19, 1, 19, 90, 1757 }, // ⁉
-    { 15, 6, 25, 5, 10, 23, 1847 }, // ⁓
-    { 23, 9, 23, 0, 18, 52, 1870 }, // ⁗
-    { 0, 0, 6, 0, 0, 0, 1922 }, //  
-    { 0, 0, 0, 0, 0, 0, 1922 }, // ⁠
-    { 0, 0, 0, 0, 0, 0, 1922 }, // ⁡
-    { 0, 0, 0, 0, 0, 0, 1922 }, // ⁢
-    { 0, 0, 0, 0, 0, 0, 1922 }, // ⁣
-    { 0, 0, 0, 0, 0, 0, 1922 }, // ⁤
-    { 11, 13, 11, 0, 21, 36, 0 }, // ⁰
-    { 11, 13, 11, 0, 21, 36, 36 }, // ⁴
-    { 9, 13, 11, 1, 21, 30, 72 }, // ⁵
-    { 10, 13, 11, 1, 21, 33, 102 }, // ⁶
-    { 10, 13, 11, 1, 21, 33, 135 }, // ⁷
-    { 9, 13, 11, 1, 21, 30, 168 }, // ⁸
-    { 10, 13, 11, 1, 21, 33, 198 }, // ⁹
-    { 12, 9, 14, 1, 18, 27, 231 }, // ⁿ
-    { 11, 12, 11, 0, 8, 33, 258 }, // ₀
-    { 9, 13, 11, 1, 9, 30, 291 }, // ₁
-    { 10, 12, 11, 1, 8, 30, 321 }, // ₂
-    { 9, 12, 11, 1, 8, 27, 351 }, // ₃
-    { 11, 12, 11, 0, 8, 33, 378 }, // ₄
-    { 9, 12, 11, 1, 8, 27, 411 }, // ₅
-    { 10, 12, 11, 1, 8, 30, 438 }, // ₆
-    { 10, 12, 11, 1, 8, 30, 468 }, // ₇
-    { 9, 12, 11, 1, 8, 27, 498 }, // ₈
-    { 10, 12, 11, 1, 8, 30, 525 }, // ₉
-    { 14, 18, 16, 1, 18, 63, 0 }, // ₣
-    { 15, 19, 16, 0, 18, 72, 63 }, // ₤
-    { 34, 19, 34, 0, 18, 162, 135 }, // ₧
-    { 16, 19, 16, 0, 18, 76, 297 }, // €
-    { 17, 12, 25, 4, 15, 51, 0 }, // ←
-    { 13, 17, 25, 6, 17, 56, 51 }, // ↑
-    { 17, 12, 25, 4, 15, 51, 107 }, // →
-    { 13, 17, 25, 6, 17, 56, 158 }, // ↓
-    { 17, 11, 25, 4, 14, 47, 214 }, // ↔
-    { 11, 17, 25, 7, 17, 47, 261 }, // ↕
-    { 13, 18, 25, 6, 18, 59, 308 }, // ↨
-    { 11, 18, 25, 7, 18, 50, 367 }, // ↲
-    { 11, 18, 25, 7, 18, 50, 417 }, // ↳
-    { 15, 14, 25, 5, 16, 53, 467 }, // ↵
-    { 17, 15, 25, 4, 16, 64, 520 }, // ⇐
-    { 15, 17, 25, 5, 17, 64, 584 }, // ⇑
-    { 17, 15, 25, 4, 16, 64, 648 }, // ⇒
-    { 15, 17, 25, 5, 17, 64, 712 }, // ⇓
-    { 17, 13, 25, 4, 15, 56, 776 }, // ⇔
-    { 18, 19, 25, 3, 18, 86, 0 }, // ∀
-    { 13, 21, 16, 1, 20, 69, 86 }, // ∂
-    { 13, 18, 25, 6, 18, 59, 155 }, // ∃
-    { 19, 21, 25, 3, 19, 100, 214 }, // ∅
-    { 17, 18, 17, 0, 18, 77, 314 }, // ∆
-    { 17, 19, 25, 4, 18, 81, 391 }, // ∇
-    { 17, 18, 25, 4, 18, 77, 472 }, // ∈
-    { 17, 23, 25, 4, 20, 98, 549 }, // ∉
-    { 17, 15, 25, 4, 16, 64, 647 }, // ∊
-    { 17, 18, 25, 4, 18, 77, 711 }, // ∋
-    { 17, 23, 25, 4, 20, 98, 788 }, // ∌
-    { 17, 15, 25, 4, 16, 64, 886 }, // ∍
-    { 21, 22, 21, 0, 18, 116, 950 }, // ∏
-    { 16, 23, 17, 0, 18, 92, 1066 }, // ∑
-    { 12, 3, 16, 2, 10, 9, 1158 }, // −
-    { 13, 20, 13, 0, 18, 65, 1167 }, // ∕
-    { 13, 20, 13, 0, 18, 65, 1232 }, // ∖
-    { 12, 13, 16, 2, 15, 39, 1297 }, // ∗
-    { 10, 10, 16, 3, 13, 25, 1336 }, // ∘
-    { 6, 5, 16, 5, 9, 8, 1361 }, // ∙
-    { 17, 24, 16, -1, 21, 102, 1369 }, // √
-    { 13, 10, 16, 1, 13, 33, 1471 }, // ∝
-    { 16, 10, 16, 0, 13, 40, 1504 }, // ∞
-    { 17, 18, 25, 4, 18, 77, 1544 }, // ∟
-    { 19, 18, 25, 3, 18, 86, 1621 }, // ∠
-    { 4, 26, 13, 4, 20, 26, 1707 }, // ∣
-    { 9, 26, 13, 2, 20, 59, 1733 }, // ∥
-    { 18, 18, 25, 4, 18, 81, 1792 }, // ∧
-    { 18, 18, 25, 4, 18, 81, 1873 }, // ∨
-    { 15, 18, 25, 5, 18, 68, 1954 }, // ∩
-    { 15, 19, 25, 5, 18, 72, 2022 }, // ∪
-    { 15, 26, 16, 0, 20, 98, 2094 }, // ∫
-    { 17, 15, 25, 4, 14, 64, 2192 }, // ∴
-    { 17, 15, 25, 4, 14, 64, 2256 }, // ∵
-    { 6, 15, 8, 1, 16, 23, 2320 }, // ∶
-    { 17, 15, 25, 4, 14, 64, 2343 }, // ∷
-    { 15, 6, 25, 5, 10, 23, 2407 }, // ∼
-    { 15, 15, 25, 5, 16, 57, 2430 }, // ≅
-    { 13, 11, 16, 1, 14, 36, 2487 }, // ≈
-    { 15, 10, 25, 5, 12, 38, 2523 }, // ≍
-    { 12, 13, 16, 2, 15, 39, 2561 }, // ≠
-    { 15, 13, 25, 5, 14, 49, 2600 }, // ≡
-    { 12, 15, 16, 2, 15, 45, 2649 }, // ≤
-    { 12, 16, 16, 2, 16, 48, 2694 }, // ≥
-    { 21, 13, 25, 2, 15, 69, 2742 }, // ≪
-    { 21, 13, 25, 2, 15, 69, 2811 }, // ≫
-    { 17, 15, 25, 4, 16, 64, 2880 }, // ⊃
-    { 17, 23, 25, 4, 20, 98, 2944 }, // ⊄
-    { 17, 23, 25, 4, 20, 98, 3042 }, // ⊅
-    { 17, 18, 25, 4, 18, 77, 3140 }, // ⊆
-    { 17, 18, 25, 4, 18, 77, 3217 }, // ⊇
-    { 19, 19, 25, 3, 18, 91, 3294 }, // ⊕
-    { 19, 19, 25, 3, 18, 91, 3385 }, // ⊖
-    { 19, 19, 25, 3, 18, 91, 3476 }, // ⊗
-    { 19, 19, 25, 3, 18, 91, 3567 }, // ⊘
-    { 15, 18, 25, 5, 18, 68, 3658 }, // ⊥
-    { 6, 5, 16, 5, 9, 8, 3726 }, // ⋅
-    { 23, 5, 25, 1, 9, 29, 3734 }, // ⋯
-    { 25, 24, 25, 0, 21, 150, 0 }, // �
+    { 14, 11, 15, 0, 12, 39, 5896 }, // «
+    { 12, 7, 16, 2, 12, 21, 527 }, // ¬
+    { 9, 3, 10, 0, 8, 7, 548 }, // ­
+    { 14, 14, 15, 0, 20, 49, 555 }, // ®
+    { 9, 3, 17, 4, 18, 7, 604 }, // ¯
+    { 10, 10, 13, 2, 18, 25, 611 }, // °
+    { 12, 16, 16, 2, 15, 48, 636 }, // ±
+    { 10, 12, 11, 1, 21, 30, 684 }, // ²
+    { 9, 13, 11, 1, 21, 30, 714 }, // ³
+    { 5, 6, 17, 6, 21, 8, 744 }, // ´
+    { 16, 20, 16, 1, 14, 80, 752 }, // µ
+    { 15, 22, 15, 0, 18, 83, 832 }, // ¶
+    { 5, 5, 7, 1, 9, 7, 915 }, // ·
+    { 5, 6, 17, 6, -1, 8, 922 }, // ¸
+    { 9, 12, 11, 1, 21, 27, 930 }, // ¹
+    { 9, 13, 11, 1, 18, 30, 957 }, // º
+    { 13, 11, 15, 1, 12, 36, 5935 }, // »
+    { 26, 21, 27, 1, 19, 137, 987 }, // ¼
+    { 25, 21, 27, 1, 19, 132, 1124 }, // ½
+    { 26, 21, 27, 1, 19, 137, 1256 }, // ¾
+    { 10, 20, 12, 1, 14, 50, 1393 }, // ¿
+    { 20, 25, 19, 0, 25, 125, 5971 }, // À
+    { 20, 25, 19, 0, 25, 125, 6096 }, // Á
+    { 20, 25, 19, 0, 25, 125, 6221 }, // Â
+    { 20, 24, 19, 0, 24, 120, 1443 }, // Ã
+    { 20, 24, 19, 0, 24, 120, 6346 }, // Ä
+    { 20, 25, 19, 0, 25, 125, 1563 }, // Å
+    { 25, 18, 25, -1, 18, 113, 1688 }, // Æ
+    { 15, 25, 16, 1, 18, 94, 6466 }, // Ç
+    { 16, 25, 16, 0, 25, 100, 6560 }, // È
+    { 16, 25, 16, 0, 25, 100, 6660 }, // É
+    { 16, 25, 16, 0, 25, 100, 6760 }, // Ê
+    { 16, 24, 16, 0, 24, 96, 6860 }, // Ë
+    { 10, 25, 10, 0, 25, 63, 6956 }, // Ì
+    { 10, 25, 10, 0, 25, 63, 7019 }, // Í
+    { 10, 25, 10, 0, 25, 63, 7082 }, // Î
+    { 10, 24, 10, 0, 24, 60, 7145 }, // Ï
+    { 19, 19, 19, 0, 18, 91, 1801 }, // Ð
+    { 21, 25, 20, 0, 24, 132, 7205 }, // Ñ
+    { 18, 26, 20, 1, 25, 117, 7337 }, // Ò
+    { 18, 26, 20, 1, 25, 117, 7454 }, // Ó
+    { 18, 26, 20, 1, 25, 117, 7571 }, // Ô
+    { 18, 25, 20, 1, 24, 113, 1892 }, // Õ
+    { 18, 25, 20, 1, 24, 113, 7688 }, // Ö
+    { 11, 11, 16, 2, 14, 31, 2005 }, // ×
+    { 20, 19, 20, 0, 18, 95, 2036 }, // Ø
+    { 20, 26, 20, 0, 25, 130, 7801 }, // Ù
+    { 20, 26, 20, 0, 25, 130, 7931 }, // Ú
+    { 20, 26, 20, 0, 25, 130, 8061 }, // Û
+    { 20, 25, 20, 0, 24, 125, 8191 }, // Ü
+    { 18, 25, 18, 0, 25, 113, 2131 }, // Ý
+    { 16, 18, 16, 0, 18, 72, 2244 }, // Þ
+    { 16, 21, 17, 0, 20, 84, 2316 }, // ß
+    { 14, 22, 14, 1, 21, 77, 8316 }, // à
+    { 14, 22, 14, 1, 21, 77, 8393 }, // á
+    { 14, 22, 14, 1, 21, 77, 8470 }, // â
+    { 14, 21, 14, 1, 20, 74, 2400 }, // ã
+    { 14, 21, 14, 1, 20, 74, 8547 }, // ä
+    { 14, 22, 14, 1, 21, 77, 2474 }, // å
+    { 19, 15, 21, 1, 14, 72, 2551 }, // æ
+    { 13, 21, 13, 0, 14, 69, 8621 }, // ç
+    { 13, 22, 14, 0, 21, 72, 8690 }, // è
+    { 13, 22, 14, 0, 21, 72, 8762 }, // é
+    { 13, 22, 14, 0, 21, 72, 8834 }, // ê
+    { 13, 21, 14, 0, 20, 69, 8906 }, // ë
+    { 9, 21, 9, 0, 21, 48, 8975 }, // ì
+    { 9, 21, 9, 0, 21, 48, 9023 }, // í
+    { 9, 21, 9, 0, 21, 48, 9071 }, // î
+    { 10, 20, 9, 0, 20, 50, 9119 }, // ï
+    { 15, 22, 15, 0, 21, 83, 2623 }, // ð
+    { 17, 20, 17, 0, 20, 85, 9169 }, // ñ
+    { 15, 22, 15, 0, 21, 83, 9254 }, // ò
+    { 15, 22, 15, 0, 21, 83, 9337 }, // ó
+    { 15, 22, 15, 0, 21, 83, 9420 }, // ô
+    { 15, 21, 15, 0, 20, 79, 2706 }, // õ
+    { 15, 21, 15, 0, 20, 79, 9503 }, // ö
+    { 12, 13, 16, 2, 15, 39, 2785 }, // ÷
+    { 15, 15, 15, 0, 14, 57, 2824 }, // ø
+    { 17, 22, 16, 0, 21, 94, 9582 }, // ù
+    { 17, 22, 16, 0, 21, 94, 9676 }, // ú
+    { 17, 22, 16, 0, 21, 94, 9770 }, // û
+    { 17, 21, 16, 0, 20, 90, 9864 }, // ü
+    { 17, 27, 16, 0, 21, 115, 2881 }, // ý
+    { 15, 26, 16, 0, 20, 98, 2996 }, // þ
+    { 17, 26, 16, 0, 20, 111, 3094 }, // ÿ
+    { 20, 23, 19, 0, 23, 115, 3205 }, // Ā
+    { 14, 19, 14, 1, 18, 67, 3320 }, // ā
+    { 20, 24, 19, 0, 24, 120, 3387 }, // Ă
+    { 14, 21, 14, 1, 20, 74, 3507 }, // ă
+    { 20, 24, 19, 0, 18, 120, 3581 }, // Ą
+    { 14, 20, 14, 1, 14, 70, 3701 }, // ą
+    { 15, 26, 16, 1, 25, 98, 3771 }, // Ć
+    { 13, 22, 13, 0, 21, 72, 3869 }, // ć
+    { 15, 26, 16, 1, 25, 98, 3941 }, // Ĉ
+    { 13, 22, 13, 0, 21, 72, 4039 }, // ĉ
+    { 15, 25, 16, 1, 24, 94, 4111 }, // Ċ
+    { 13, 21, 13, 0, 20, 69, 4205 }, // ċ
+    { 15, 26, 16, 1, 25, 98, 4274 }, // Č
+    { 13, 22, 13, 0, 21, 72, 4372 }, // č
+    { 19, 26, 19, 0, 25, 124, 4444 }, // Ď
+    { 18, 21, 16, 0, 20, 95, 4568 }, // ď
+    { 19, 19, 19, 0, 18, 91, 4663 }, // Đ
+    { 16, 21, 16, 0, 20, 84, 4754 }, // đ
+    { 16, 23, 16, 0, 23, 92, 4838 }, // Ē
+    { 13, 19, 14, 0, 18, 62, 4930 }, // ē
+    { 16, 24, 16, 0, 24, 96, 4992 }, // Ĕ
+    { 13, 21, 14, 0, 20, 69, 5088 }, // ĕ
+    { 16, 24, 16, 0, 24, 96, 5157 }, // Ė
+    { 13, 21, 14, 0, 20, 69, 5253 }, // ė
+    { 16, 24, 16, 0, 18, 96, 5322 }, // Ę
+    { 13, 20, 14, 0, 14, 65, 5418 }, // ę
+    { 16, 25, 16, 0, 25, 100, 5483 }, // Ě
+    { 13, 22, 14, 0, 21, 72, 5583 }, // ě
+    { 17, 26, 19, 1, 25, 111, 5655 }, // Ĝ
+    { 15, 27, 15, 0, 21, 102, 5766 }, // ĝ
+    { 17, 25, 19, 1, 24, 107, 5868 }, // Ğ
+    { 15, 26, 15, 0, 20, 98, 5975 }, // ğ
+    { 17, 25, 19, 1, 24, 107, 6073 }, // Ġ
+    { 15, 26, 15, 0, 20, 98, 6180 }, // ġ
+    { 17, 25, 19, 1, 18, 107, 6278 }, // Ģ
+    { 15, 28, 15, 0, 22, 105, 6385 }, // ģ
+    { 21, 25, 22, 0, 25, 132, 6490 }, // Ĥ
+    { 18, 26, 17, -1, 26, 117, 6622 }, // ĥ
+    { 21, 18, 22, 0, 18, 95, 6739 }, // Ħ
+    { 17, 20, 17, 0, 20, 85, 6834 }, // ħ
+    { 10, 24, 10, 0, 24, 60, 6919 }, // Ĩ
+    { 9, 20, 9, 0, 20, 45, 6979 }, // ĩ
+    { 10, 23, 10, 0, 23, 58, 7024 }, // Ī
+    { 9, 18, 9, 0, 18, 41, 7082 }, // ī
+    { 10, 24, 10, 0, 24, 60, 7123 }, // Ĭ
+    { 9, 20, 9, 0, 20, 45, 7183 }, // ĭ
+    { 10, 24, 10, 0, 18, 60, 7228 }, // Į
+    { 10, 26, 9, 0, 20, 65, 7288 }, // į
+    { 10, 24, 10, 0, 24, 60, 7353 }, // İ
+    { 9, 14, 9, 0, 14, 32, 7413 }, // ı
+    { 20, 24, 20, 0, 18, 120, 7445 }, // Ĳ
+    { 16, 26, 17, 0, 20, 104, 7565 }, // ĳ
+    { 12, 31, 10, -2, 25, 93, 7669 }, // Ĵ
+    { 11, 27, 8, -2, 21, 75, 7762 }, // ĵ
+    { 19, 25, 19, 0, 18, 119, 7837 }, // Ķ
+    { 16, 27, 16, 0, 20, 108, 7956 }, // ķ
+    { 17, 15, 16, 0, 14, 64, 8064 }, // ĸ
+    { 16, 25, 16, 0, 25, 100, 8128 }, // Ĺ
+    { 9, 26, 9, 0, 26, 59, 8228 }, // ĺ
+    { 16, 25, 16, 0, 18, 100, 8287 }, // Ļ
+    { 9, 27, 9, 0, 20, 61, 8387 }, // ļ
+    { 16, 20, 16, 0, 20, 80, 8448 }, // Ľ
+    { 11, 20, 9, 0, 20, 55, 8528 }, // ľ
+    { 16, 18, 16, 0, 18, 72, 8583 }, // Ŀ
+    { 14, 20, 13, 0, 20, 70, 8655 }, // ŀ
+    { 17, 18, 16, -1, 18, 77, 8725 }, // Ł
+    { 10, 20, 9, -1, 20, 50, 8802 }, // ł
+    { 21, 26, 20, 0, 25, 137, 8852 }, // Ń
+    { 17, 21, 17, 0, 21, 90, 8989 }, // ń
+    { 21, 25, 20, 0, 18, 132, 9079 }, // Ņ
+    { 17, 21, 17, 0, 14, 90, 9211 }, // ņ
+    { 21, 26, 20, 0, 25, 137, 9301 }, // Ň
+    { 17, 21, 17, 0, 21, 90, 9438 }, // ň
+    { 23, 18, 23, 0, 18, 104, 9528 }, // ŉ
+    { 21, 23, 20, 0, 18, 121, 9632 }, // Ŋ
+    { 15, 20, 16, 0, 14, 75, 9753 }, // ŋ
+    { 18, 24, 20, 1, 23, 108, 9828 }, // Ō
+    { 15, 19, 15, 0, 18, 72, 9936 }, // ō
+    { 18, 25, 20, 1, 24, 113, 10008 }, // Ŏ
+    { 15, 21, 15, 0, 20, 79, 10121 }, // ŏ
+    { 18, 26, 20, 1, 25, 117, 10200 }, // Ő
+    { 15, 22, 15, 0, 21, 83, 10317 }, // ő
+    { 24, 19, 25, 1, 18, 114, 9954 }, // Œ
+    { 22, 15, 23, 0, 14, 83, 10068 }, // œ
+    { 19, 26, 18, 0, 25, 124, 10400 }, // Ŕ
+    { 12, 21, 12, 0, 21, 63, 10524 }, // ŕ
+    { 19, 25, 18, 0, 18, 119, 10587 }, // Ŗ
+    { 12, 21, 12, 0, 14, 63, 10706 }, // ŗ
+    { 19, 26, 18, 0, 25, 124, 10769 }, // Ř
+    { 12, 21, 12, 0, 21, 63, 10893 }, // ř
+    { 13, 26, 15, 1, 25, 85, 10956 }, // Ś
+    { 11, 22, 13, 1, 21, 61, 11041 }, // ś
+    { 13, 26, 15, 1, 25, 85, 11102 }, // Ŝ
+    { 11, 22, 13, 1, 21, 61, 11187 }, // ŝ
+    { 13, 25, 15, 1, 18, 82, 11248 }, // Ş
+    { 11, 21, 13, 1, 14, 58, 11330 }, // ş
+    { 13, 26, 15, 1, 25, 85, 11388 }, // Š
+    { 11, 22, 13, 1, 21, 61, 11473 }, // š
+    { 18, 25, 18, 0, 18, 113, 11534 }, // Ţ
+    { 12, 24, 11, -1, 17, 72, 11647 }, // ţ
+    { 18, 25, 18, 0, 25, 113, 11719 }, // Ť
+    { 12, 21, 11, -1, 20, 63, 11832 }, // ť
+    { 18, 18, 18, 0, 18, 81, 11895 }, // Ŧ
+    { 12, 18, 11, -1, 17, 54, 11976 }, // ŧ
+    { 20, 25, 20, 0, 24, 125, 12030 }, // Ũ
+    { 17, 21, 16, 0, 20, 90, 12155 }, // ũ
+    { 20, 24, 20, 0, 23, 120, 12245 }, // Ū
+    { 17, 19, 16, 0, 18, 81, 12365 }, // ū
+    { 20, 25, 20, 0, 24, 125, 12446 }, // Ŭ
+    { 17, 21, 16, 0, 20, 90, 12571 }, // ŭ
+    { 20, 26, 20, 0, 25, 130, 12661 }, // Ů
+    { 17, 22, 16, 0, 21, 94, 12791 }, // ů
+    { 20, 26, 20, 0, 25, 130, 12885 }, // Ű
+    { 17, 22, 16, 0, 21, 94, 13015 }, // ű
+    { 20, 24, 20, 0, 18, 120, 13109 }, // Ų
+    { 17, 20, 16, 0, 14, 85, 13229 }, // ų
+    { 28, 26, 28, 0, 25, 182, 13314 }, // Ŵ
+    { 23, 22, 23, 0, 21, 127, 13496 }, // ŵ
+    { 18, 25, 18, 0, 25, 113, 13623 }, // Ŷ
+    { 17, 27, 16, 0, 21, 115, 13736 }, // ŷ
+    { 18, 24, 18, 0, 24, 108, 13851 }, // Ÿ
+    { 15, 26, 15, 0, 25, 98, 13959 }, // Ź
+    { 13, 22, 13, 0, 21, 72, 14057 }, // ź
+    { 15, 25, 15, 0, 24, 94, 14129 }, // Ż
+    { 13, 21, 13, 0, 20, 69, 14223 }, // ż
+    { 15, 26, 15, 0, 25, 98, 14292 }, // Ž
+    { 13, 22, 13, 0, 21, 72, 14390 }, // ž
+    { 13, 20, 10, 0, 20, 65, 14462 }, // ſ
+    { 6, 6, 0, -4, 21, 9, 14527 }, // ̀
+    { 5, 6, 0, -2, 21, 8, 14536 }, // ́
+    { 10, 7, 0, -5, 21, 18, 14544 }, // ̂
+    { 10, 5, 0, -5, 20, 13, 14562 }, // ̃
+    { 10, 3, 0, -5, 18, 8, 14575 }, // ̄
+    { 10, 5, 0, -5, 20, 13, 14583 }, // ̆
+    { 6, 5, 0, -3, 20, 8, 14596 }, // ̇
+    { 10, 5, 0, -5, 20, 13, 14604 }, // ̈
+    { 8, 7, 0, -4, 22, 14, 14617 }, // ̉
+    { 8, 7, 0, -4, 21, 14, 14631 }, // ̊
+    { 10, 7, 0, -4, 21, 18, 14645 }, // ̋
+    { 10, 6, 0, -5, 21, 15, 14663 }, // ̌
+    { 10, 7, 0, -6, 21, 18, 14678 }, // ̏
+    { 10, 5, 0, -5, 20, 13, 14696 }, // ̑
+    { 5, 8, 0, -3, 22, 10, 14709 }, // ̒
+    { 5, 7, 0, -2, 22, 9, 14719 }, // ̓
+    { 5, 7, 0, -3, 22, 9, 14728 }, // ̔
+    { 4, 7, 0, -2, 22, 7, 14737 }, // ̕
+    { 5, 6, 0, -3, 16, 8, 14744 }, // ̛
+    { 6, 5, 0, -3, -1, 8, 14752 }, // ̣
+    { 10, 4, 0, -5, -2, 10, 14760 }, // ̤
+    { 6, 6, 0, -3, -1, 9, 14770 }, // ̥
+    { 5, 6, 0, -3, -1, 8, 14779 }, // ̦
+    { 6, 6, 0, -3, -1, 9, 14787 }, // ̧
+    { 6, 7, 0, -3, 1, 11, 14796 }, // ̨
+    { 3, 7, 7, 2, -1, 6, 14807 }, // ̩
+    { 10, 6, 0, -5, -1, 15, 14813 }, // ̭
+    { 10, 6, 0, -5, -1, 15, 14828 }, // ̮
+    { 10, 5, 0, -5, -2, 13, 14843 }, // ̰
+    { 10, 3, 0, -5, -2, 8, 14856 }, // ̱
+    { 10, 5, 0, -5, 20, 13, 14864 }, // ͂
+    { 10, 11, 0, -5, 26, 28, 14877 }, // ̈́
+    { 5, 6, 0, -2, -1, 8, 14905 }, // ͅ
+    { 16, 25, 16, 0, 25, 100, 14913 }, // Ѐ
+    { 16, 24, 16, 0, 24, 96, 0 }, // Ё
+    { 21, 24, 22, 0, 18, 126, 15013 }, // Ђ
+    { 15, 25, 16, 0, 25, 94, 15139 }, // Ѓ
+    { 16, 19, 17, 1, 18, 76, 15233 }, // Є
+    { 13, 19, 15, 1, 18, 62, 15309 }, // Ѕ
+    { 10, 18, 10, 0, 18, 45, 15371 }, // І
+    { 10, 24, 10, 0, 24, 60, 15416 }, // Ї
+    { 12, 24, 10, -2, 18, 72, 15476 }, // Ј
+    { 24, 19, 25, 0, 18, 114, 15548 }, // Љ
+    { 26, 19, 27, 0, 18, 124, 15662 }, // Њ
+    { 23, 18, 23, 0, 18, 104, 15786 }, // Ћ
+    { 19, 26, 19, 0, 25, 124, 15890 }, // Ќ
+    { 21, 25, 21, 0, 25, 132, 16014 }, // Ѝ
+    { 18, 25, 18, 0, 24, 113, 16146 }, // Ў
+    { 20, 24, 21, 0, 18, 120, 16259 }, // Џ
+    { 20, 18, 19, 0, 18, 90, 96 }, // А
+    { 16, 19, 16, 0, 18, 76, 186 }, // Б
+    { 16, 19, 16, 0, 18, 76, 262 }, // В
+    { 15, 18, 16, 0, 18, 68, 338 }, // Г
+    { 20, 24, 20, 0, 18, 120, 406 }, // Д
+    { 16, 18, 16, 0, 18, 72, 526 }, // Е
+    { 28, 19, 28, 0, 18, 133, 598 }, // Ж
+    { 15, 19, 16, 0, 18, 72, 731 }, // З
+    { 21, 18, 21, 0, 18, 95, 803 }, // И
+    { 21, 24, 21, 0, 24, 126, 898 }, // Й
+    { 19, 19, 19, 0, 18, 91, 1024 }, // К
+    { 19, 19, 19, 0, 18, 91, 1115 }, // Л
+    { 24, 18, 24, 0, 18, 108, 1206 }, // М
+    { 21, 18, 22, 0, 18, 95, 1314 }, // Н
+    { 18, 19, 20, 1, 18, 86, 1409 }, // О
+    { 21, 18, 21, 0, 18, 95, 1495 }, // П
+    { 16, 18, 16, 0, 18, 72, 1590 }, // Р
+    { 15, 19, 16, 1, 18, 72, 1662 }, // С
+    { 18, 18, 18, 0, 18, 81, 1734 }, // Т
+    { 18, 19, 18, 0, 18, 86, 1815 }, // У
+    { 20, 19, 20, 0, 18, 95, 1901 }, // Ф
+    { 19, 18, 19, 0, 18, 86, 1996 }, // Х
+    { 21, 24, 21, 0, 18, 126, 2082 }, // Ц
+    { 19, 18, 19, 0, 18, 86, 2208 }, // Ч
+    { 27, 18, 28, 0, 18, 122, 2294 }, // Ш
+    { 28, 24, 28, 0, 18, 168, 2416 }, // Щ
+    { 19, 19, 20, 0, 18, 91, 2584 }, // Ъ
+    { 25, 19, 26, 0, 18, 119, 2675 }, // Ы
+    { 16, 19, 16, 0, 18, 76, 2794 }, // Ь
+    { 17, 19, 17, 0, 18, 81, 2870 }, // Э
+    { 27, 19, 28, 0, 18, 129, 2951 }, // Ю
+    { 18, 19, 18, 0, 18, 86, 3080 }, // Я
+    { 14, 15, 14, 1, 14, 53, 3166 }, // а
+    { 14, 21, 15, 0, 20, 74, 3219 }, // б
+    { 14, 15, 15, 0, 14, 53, 3293 }, // в
+    { 13, 13, 13, 0, 13, 43, 3346 }, // г
+    { 17, 18, 17, 0, 13, 77, 3389 }, // д
+    { 13, 15, 14, 0, 14, 49, 3466 }, // е
+    { 23, 15, 22, 0, 14, 87, 3515 }, // ж
+    { 13, 15, 13, 0, 14, 49, 3602 }, // з
+    { 17, 13, 17, 0, 13, 56, 3651 }, // и
+    { 17, 20, 17, 0, 20, 85, 3707 }, // й
+    { 16, 15, 16, 0, 14, 60, 3792 }, // к
+    { 16, 14, 16, 0, 13, 56, 3852 }, // л
+    { 19, 13, 20, 0, 13, 62, 3908 }, // м
+    { 17, 13, 18, 0, 13, 56, 3970 }, // н
+    { 15, 15, 15, 0, 14, 57, 4026 }, // о
+    { 17, 13, 17, 0, 13, 56, 4083 }, // п
+    { 15, 20, 16, 0, 14, 75, 4139 }, // р
+    { 13, 15, 13, 0, 14, 49, 4214 }, // с
+    { 15, 13, 15, 0, 13, 49, 4263 }, // т
+    { 17, 19, 16, 0, 13, 81, 4312 }, // у
+    { 19, 26, 20, 0, 20, 124, 4393 }, // ф
+    { 16, 13, 16, 0, 13, 52, 4517 }, // х
+    { 18, 18, 18, 0, 13, 81, 4569 }, // ц
+    { 16, 13, 16, 0, 13, 52, 4650 }, // ч
+    { 23, 13, 23, 0, 13, 75, 4702 }, // ш
+    { 23, 18, 23, 0, 13, 104, 4777 }, // щ
+    { 16, 14, 17, 0, 13, 56, 4881 }, // ъ
+    { 22, 14, 22, 0, 13, 77, 4937 }, // ы
+    { 14, 14, 14, 0, 13, 49, 5014 }, // ь
+    { 13, 15, 14, 0, 14, 49, 5063 }, // э
+    { 22, 15, 22, 0, 14, 83, 5112 }, // ю
+    { 15, 14, 15, 0, 13, 53, 5195 }, // я
+    { 13, 22, 14, 0, 21, 72, 16379 }, // ѐ
+    { 13, 21, 14, 0, 20, 69, 5248 }, // ё
+    { 15, 26, 16, 0, 20, 98, 16451 }, // ђ
+    { 13, 21, 13, 0, 21, 69, 16549 }, // ѓ
+    { 13, 15, 13, 0, 14, 49, 16618 }, // є
+    { 11, 15, 13, 1, 14, 42, 16667 }, // ѕ
+    { 9, 20, 9, 0, 20, 45, 16709 }, // і
+    { 10, 20, 9, 0, 20, 50, 16754 }, // ї
+    { 9, 26, 8, -2, 20, 59, 16804 }, // ј
+    { 20, 14, 20, 0, 13, 70, 16863 }, // љ
+    { 22, 14, 22, 0, 13, 77, 16933 }, // њ
+    { 17, 20, 17, 0, 20, 85, 17010 }, // ћ
+    { 16, 22, 16, 0, 21, 88, 17095 }, // ќ
+    { 17, 21, 17, 0, 21, 90, 17183 }, // ѝ
+    { 17, 26, 16, 0, 20, 111, 17273 }, // ў
+    { 17, 18, 17, 0, 13, 77, 17384 }, // џ
+    { 19, 21, 19, 0, 20, 100, 17461 }, // Ѣ
+    { 16, 19, 16, 0, 18, 76, 17561 }, // ѣ
+    { 18, 19, 20, 1, 18, 86, 17637 }, // Ѳ
+    { 15, 15, 15, 0, 14, 57, 17723 }, // ѳ
+    { 20, 19, 20, 0, 18, 95, 17780 }, // Ѵ
+    { 17, 15, 17, 0, 14, 64, 17875 }, // ѵ
+    { 21, 30, 21, 0, 24, 158, 17939 }, // Ҋ
+    { 17, 25, 17, 0, 20, 107, 18097 }, // ҋ
+    { 16, 19, 16, 0, 18, 76, 18204 }, // Ҍ
+    { 13, 19, 14, 0, 18, 62, 18280 }, // ҍ
+    { 16, 18, 16, 0, 18, 72, 18342 }, // Ҏ
+    { 15, 20, 16, 0, 14, 75, 18414 }, // ҏ
+    { 14, 21, 14, 0, 21, 74, 18489 }, // Ґ
+    { 12, 17, 13, 0, 17, 51, 18563 }, // ґ
+    { 15, 18, 15, 0, 18, 68, 18614 }, // Ғ
+    { 13, 13, 13, 0, 13, 43, 18682 }, // ғ
+    { 17, 24, 18, 0, 18, 102, 18725 }, // Ҕ
+    { 15, 19, 15, 0, 13, 72, 18827 }, // ҕ
+    { 28, 24, 28, 0, 18, 168, 18899 }, // Җ
+    { 23, 19, 22, 0, 14, 110, 19067 }, // җ
+    { 15, 24, 16, 0, 18, 90, 0 }, // Ҙ
+    { 13, 19, 13, 0, 14, 62, 90 }, // ҙ
+    { 19, 24, 19, 0, 18, 114, 152 }, // Қ
+    { 16, 19, 16, 0, 14, 76, 266 }, // қ
+    { 20, 19, 20, 0, 18, 95, 342 }, // Ҝ
+    { 17, 15, 17, 0, 14, 64, 437 }, // ҝ
+    { 19, 19, 19, 0, 18, 91, 501 }, // Ҟ
+    { 16, 19, 16, 0, 18, 76, 592 }, // ҟ
+    { 22, 19, 22, 0, 18, 105, 668 }, // Ҡ
+    { 19, 15, 19, 0, 14, 72, 773 }, // ҡ
+    { 22, 24, 22, 0, 18, 132, 845 }, // Ң
+    { 18, 18, 18, 0, 13, 81, 977 }, // ң
+    { 25, 18, 25, 0, 18, 113, 1058 }, // Ҥ
+    { 20, 13, 21, 0, 13, 65, 1171 }, // ҥ
+    { 27, 24, 28, 0, 18, 162, 1236 }, // Ҧ
+    { 23, 19, 24, 0, 13, 110, 1398 }, // ҧ
+    { 20, 19, 21, 1, 18, 95, 1508 }, // Ҩ
+    { 17, 15, 17, 0, 14, 64, 1603 }, // ҩ
+    { 15, 24, 16, 1, 18, 90, 1667 }, // Ҫ
+    { 13, 19, 13, 0, 14, 62, 1757 }, // ҫ
+    { 18, 24, 18, 0, 18, 108, 1819 }, // Ҭ
+    { 15, 18, 15, 0, 13, 68, 1927 }, // ҭ
+    { 18, 18, 18, 0, 18, 81, 1995 }, // Ү
+    { 17, 19, 16, 0, 13, 81, 2076 }, // ү
+    { 18, 18, 18, 0, 18, 81, 2157 }, // Ұ
+    { 17, 19, 16, 0, 13, 81, 2238 }, // ұ
+    { 20, 24, 20, 0, 18, 120, 2319 }, // Ҳ
+    { 16, 18, 16, 0, 13, 72, 2439 }, // ҳ
+    { 23, 24, 23, 0, 18, 138, 2511 }, // Ҵ
+    { 20, 18, 20, 0, 13, 90, 2649 }, // ҵ
+    { 20, 24, 20, 0, 18, 120, 2739 }, // Ҷ
+    { 16, 18, 16, 0, 13, 72, 2859 }, // ҷ
+    { 19, 18, 19, 0, 18, 86, 2931 }, // Ҹ
+    { 16, 13, 16, 0, 13, 52, 3017 }, // ҹ
+    { 20, 18, 19, 0, 18, 90, 3069 }, // Һ
+    { 17, 20, 17, 0, 20, 85, 3159 }, // һ
+    { 21, 19, 21, 0, 18, 100, 3244 }, // Ҽ
+    { 16, 15, 17, 0, 14, 60, 3344 }, // ҽ
+    { 21, 24, 21, 0, 18, 126, 3404 }, // Ҿ
+    { 16, 19, 17, 0, 14, 76, 3530 }, // ҿ
+    { 10, 18, 10, 0, 18, 45, 3606 }, // Ӏ
+    { 28, 25, 28, 0, 24, 175, 3651 }, // Ӂ
+    { 23, 21, 22, 0, 20, 121, 3826 }, // ӂ
+    { 18, 24, 19, 0, 18, 108, 3947 }, // Ӄ
+    { 15, 20, 16, 0, 14, 75, 4055 }, // ӄ
+    { 19, 24, 19, 0, 18, 114, 4130 }, // Ӆ
+    { 16, 18, 16, 0, 13, 72, 4244 }, // ӆ
+    { 21, 24, 21, 0, 18, 126, 4316 }, // Ӈ
+    { 17, 19, 17, 0, 13, 81, 4442 }, // ӈ
+    { 21, 24, 21, 0, 18, 126, 4523 }, // Ӊ
+    { 18, 18, 18, 0, 13, 81, 4649 }, // ӊ
+    { 19, 24, 19, 0, 18, 114, 4730 }, // Ӌ
+    { 16, 18, 16, 0, 13, 72, 4844 }, // ӌ
+    { 24, 24, 24, 0, 18, 144, 4916 }, // Ӎ
+    { 20, 18, 20, 0, 13, 90, 5060 }, // ӎ
+    { 9, 20, 10, 1, 20, 45, 5150 }, // ӏ
+    { 20, 24, 19, 0, 24, 120, 5195 }, // Ӑ
+    { 14, 21, 14, 1, 20, 74, 5315 }, // ӑ
+    { 20, 24, 19, 0, 24, 120, 5389 }, // Ӓ
+    { 14, 21, 14, 1, 20, 74, 5509 }, // ӓ
+    { 25, 18, 25, -1, 18, 113, 5583 }, // Ӕ
+    { 19, 15, 21, 1, 14, 72, 5696 }, // ӕ
+    { 16, 24, 16, 0, 24, 96, 5768 }, // Ӗ
+    { 13, 21, 14, 0, 20, 69, 5864 }, // ӗ
+    { 16, 19, 17, 1, 18, 76, 5933 }, // Ә
+    { 13, 15, 14, 0, 14, 49, 6009 }, // ә
+    { 16, 25, 17, 1, 24, 100, 6058 }, // Ӛ
+    { 13, 21, 14, 0, 20, 69, 6158 }, // ӛ
+    { 28, 25, 28, 0, 24, 175, 6227 }, // Ӝ
+    { 23, 21, 22, 0, 20, 121, 6402 }, // ӝ
+    { 15, 25, 16, 0, 24, 94, 6523 }, // Ӟ
+    { 13, 21, 13, 0, 20, 69, 6617 }, // ӟ
+    { 14, 19, 15, 0, 18, 67, 6686 }, // Ӡ
+    { 13, 19, 14, 0, 13, 62, 6753 }, // ӡ
+    { 21, 23, 21, 0, 23, 121, 6815 }, // Ӣ
+    { 17, 18, 17, 0, 18, 77, 6936 }, // ӣ
+    { 21, 24, 21, 0, 24, 126, 7013 }, // Ӥ
+    { 17, 20, 17, 0, 20, 85, 7139 }, // ӥ
+    { 18, 25, 20, 1, 24, 113, 7224 }, // Ӧ
+    { 15, 21, 15, 0, 20, 79, 7337 }, // ӧ
+    { 18, 19, 20, 1, 18, 86, 7416 }, // Ө
+    { 15, 15, 15, 0, 14, 57, 7502 }, // ө
+    { 18, 25, 20, 1, 24, 113, 7559 }, // Ӫ
+    { 15, 21, 15, 0, 20, 79, 7672 }, // ӫ
+    { 17, 25, 17, 0, 24, 107, 7751 }, // Ӭ
+    { 13, 21, 14, 0, 20, 69, 7858 }, // ӭ
+    { 18, 24, 18, 0, 23, 108, 7927 }, // Ӯ
+    { 17, 24, 16, 0, 18, 102, 8035 }, // ӯ
+    { 18, 25, 18, 0, 24, 113, 8137 }, // Ӱ
+    { 17, 26, 16, 0, 20, 111, 8250 }, // ӱ
+    { 18, 26, 18, 0, 25, 117, 8361 }, // Ӳ
+    { 17, 27, 16, 0, 21, 115, 8478 }, // ӳ
+    { 19, 24, 19, 0, 24, 114, 8593 }, // Ӵ
+    { 16, 20, 16, 0, 20, 80, 8707 }, // ӵ
+    { 15, 24, 16, 0, 18, 90, 8787 }, // Ӷ
+    { 13, 18, 13, 0, 13, 59, 8877 }, // ӷ
+    { 25, 25, 26, 0, 24, 157, 8936 }, // Ӹ
+    { 22, 21, 22, 0, 20, 116, 9093 }, // ӹ
+    { 15, 24, 15, 0, 18, 90, 9209 }, // Ӻ
+    { 13, 18, 13, 0, 13, 59, 9299 }, // ӻ
+    { 19, 24, 19, 0, 18, 114, 9358 }, // Ӽ
+    { 15, 19, 15, 0, 13, 72, 9472 }, // ӽ
+    { 19, 18, 19, 0, 18, 86, 9544 }, // Ӿ
+    { 16, 13, 16, 0, 13, 52, 9630 }, // ӿ
+    { 0, 0, 13, 0, 0, 0, 9682 }, //  
+    { 0, 0, 25, 0, 0, 0, 9682 }, //  
+    { 0, 0, 13, 0, 0, 0, 9682 }, //  
+    { 0, 0, 25, 0, 0, 0, 9682 }, //  
+    { 0, 0, 8, 0, 0, 0, 9682 }, //  
+    { 0, 0, 6, 0, 0, 0, 9682 }, //  
+    { 0, 0, 4, 0, 0, 0, 9682 }, //  
+    { 0, 0, 16, 0, 0, 0, 9682 }, //  
+    { 0, 0, 7, 0, 0, 0, 9682 }, //  
+    { 0, 0, 5, 0, 0, 0, 9682 }, //  
+    { 0, 0, 1, 0, 0, 0, 9682 }, //  
+    { 0, 0, 0, 0, 0, 0, 9682 }, // ​
+    { 2, 21, 0, -1, 15, 11, 9682 }, // ‌
+    { 6, 23, 0, -3, 17, 35, 9693 }, // ‍
+    { 8, 24, 0, -4, 18, 48, 9728 }, // ‎
+    { 8, 24, 0, -4, 18, 48, 9776 }, // ‏
+    { 9, 3, 10, 0, 8, 7, 9824 }, // ‐
+    { 9, 3, 10, 0, 8, 7, 9831 }, // ‑
+    { 13, 3, 16, 1, 10, 10, 9838 }, // ‒
+    { 13, 3, 13, 0, 8, 10, 10151 }, // –
+    { 25, 3, 25, 0, 8, 19, 10161 }, // —
+    { 25, 3, 25, 0, 8, 19, 9848 }, // ―
+    { 9, 26, 13, 2, 20, 59, 9867 }, // ‖
+    { 13, 7, 13, 0, -1, 23, 9926 }, // ‗
+    { 6, 9, 6, 0, 19, 14, 10180 }, // ‘
+    { 6, 9, 6, 0, 19, 14, 10194 }, // ’
+    { 6, 9, 6, 0, 4, 14, 9949 }, // ‚
+    { 6, 9, 6, 0, 19, 14, 9963 }, // ‛
+    { 11, 9, 11, 0, 19, 25, 10208 }, // “
+    { 11, 9, 11, 0, 19, 25, 10233 }, // ”
+    { 11, 9, 11, 0, 4, 25, 9977 }, // „
+    { 11, 9, 11, 0, 19, 25, 10002 }, // ‟
+    { 12, 17, 12, 0, 18, 51, 10027 }, // †
+    { 12, 20, 12, 0, 18, 60, 10078 }, // ‡
+    { 6, 7, 8, 1, 10, 11, 10138 }, // •
+    { 9, 9, 16, 3, 13, 21, 10149 }, // ‣
+    { 5, 5, 7, 1, 4, 7, 10170 }, // ․
+    { 12, 5, 13, 0, 4, 15, 10177 }, // ‥
+    { 23, 5, 25, 1, 4, 29, 10258 }, // …
+    { 5, 5, 7, 1, 9, 7, 10192 }, // ‧
+    { 0, 0, 0, 0, 0, 0, 10199 }, //  
+    { 0, 0, 0, 0, 0, 0, 10199 }, //  
+    { 8, 24, 0, -4, 18, 48, 10199 }, // ‪
+    { 8, 24, 0, -4, 18, 48, 10247 }, // ‫
+    { 8, 24, 0, -4, 18, 48, 10295 }, // ‬
+    { 11, 24, 0, -5, 18, 66, 10343 }, // ‭
+    { 11, 24, 0, -5, 18, 66, 10409 }, // ‮
+    { 0, 0, 3, 0, 0, 0, 10475 }, //  
+    { 33, 21, 35, 1, 19, 174, 10475 }, // ‰
+    { 7, 9, 7, 0, 18, 16, 10649 }, // ′
+    { 12, 9, 12, 0, 18, 27, 10665 }, // ″
+    { 18, 9, 18, 0, 18, 41, 10692 }, // ‴
+    { 7, 9, 7, 0, 18, 16, 10733 }, // ‵
+    { 12, 9, 13, 0, 18, 27, 10749 }, // ‶
+    { 18, 9, 18, 0, 18, 41, 10776 }, // ‷
+    { 11, 6, 12, 1, 0, 17, 10817 }, // ‸
+    { 8, 11, 8, 0, 12, 22, 10834 }, // ‹
+    { 7, 11, 8, 1, 12, 20, 10856 }, // ›
+    { 16, 18, 16, 0, 17, 72, 10876 }, // ※
+    { 13, 20, 15, 1, 19, 65, 10948 }, // ‼
+    { 13, 3, 13, 0, 21, 10, 11013 }, // ‾
+    { 7, 3, 8, 0, 8, 6, 11023 }, // ⁃
+    { 14, 21, 5, -5, 19, 74, 11029 }, // ⁄
+    { 22, 20, 23, 1, 19, 110, 11103 }, // ⁇
+    { 18, 20, 19, 1, 19, 90, 11213 }, // ⁈
+    { 18, 20, 19, 1, 19, 90, 11303 }, // ⁉
+    { 15, 6, 25, 5, 10, 23, 11393 }, // ⁓
+    { 23, 9, 23, 0, 18, 52, 11416 }, // ⁗
+    { 0, 0, 6, 0, 0, 0, 11468 }, //  
+    { 0, 0, 0, 0, 0, 0, 11468 }, // ⁠
+    { 0, 0, 0, 0, 0, 0, 11468 }, // ⁡
+    { 0, 0, 0, 0, 0, 0, 11468 }, // ⁢
+    { 0, 0, 0, 0, 0, 0, 11468 }, // ⁣
+    { 0, 0, 0, 0, 0, 0, 11468 }, // ⁤
+    { 11, 13, 11, 0, 21, 36, 11468 }, // ⁰
+    { 11, 13, 11, 0, 21, 36, 11504 }, // ⁴
+    { 9, 13, 11, 1, 21, 30, 11540 }, // ⁵
+    { 10, 13, 11, 1, 21, 33, 11570 }, // ⁶
+    { 10, 13, 11, 1, 21, 33, 11603 }, // ⁷
+    { 9, 13, 11, 1, 21, 30, 11636 }, // ⁸
+    { 10, 13, 11, 1, 21, 33, 11666 }, // ⁹
+    { 12, 9, 14, 1, 18, 27, 11699 }, // ⁿ
+    { 11, 12, 11, 0, 8, 33, 11726 }, // ₀
+    { 9, 13, 11, 1, 9, 30, 11759 }, // ₁
+    { 10, 12, 11, 1, 8, 30, 11789 }, // ₂
+    { 9, 12, 11, 1, 8, 27, 11819 }, // ₃
+    { 11, 12, 11, 0, 8, 33, 11846 }, // ₄
+    { 9, 12, 11, 1, 8, 27, 11879 }, // ₅
+    { 10, 12, 11, 1, 8, 30, 11906 }, // ₆
+    { 10, 12, 11, 1, 8, 30, 11936 }, // ₇
+    { 9, 12, 11, 1, 8, 27, 11966 }, // ₈
+    { 10, 12, 11, 1, 8, 30, 11993 }, // ₉
+    { 14, 18, 16, 1, 18, 63, 12023 }, // ₣
+    { 15, 19, 16, 0, 18, 72, 12086 }, // ₤
+    { 34, 19, 34, 0, 18, 162, 12158 }, // ₧
+    { 16, 19, 16, 0, 18, 76, 12320 }, // €
+    { 17, 12, 25, 4, 15, 51, 12396 }, // ←
+    { 13, 17, 25, 6, 17, 56, 12447 }, // ↑
+    { 17, 12, 25, 4, 15, 51, 12503 }, // →
+    { 13, 17, 25, 6, 17, 56, 12554 }, // ↓
+    { 17, 11, 25, 4, 14, 47, 12610 }, // ↔
+    { 11, 17, 25, 7, 17, 47, 12657 }, // ↕
+    { 13, 18, 25, 6, 18, 59, 12704 }, // ↨
+    { 11, 18, 25, 7, 18, 50, 12763 }, // ↲
+    { 11, 18, 25, 7, 18, 50, 12813 }, // ↳
+    { 15, 14, 25, 5, 16, 53, 12863 }, // ↵
+    { 17, 15, 25, 4, 16, 64, 12916 }, // ⇐
+    { 15, 17, 25, 5, 17, 64, 12980 }, // ⇑
+    { 17, 15, 25, 4, 16, 64, 13044 }, // ⇒
+    { 15, 17, 25, 5, 17, 64, 13108 }, // ⇓
+    { 17, 13, 25, 4, 15, 56, 13172 }, // ⇔
+    { 18, 19, 25, 3, 18, 86, 13228 }, // ∀
+    { 13, 21, 16, 1, 20, 69, 13314 }, // ∂
+    { 13, 18, 25, 6, 18, 59, 13383 }, // ∃
+    { 19, 21, 25, 3, 19, 100, 13442 }, // ∅
+    { 17, 18, 17, 0, 18, 77, 13542 }, // ∆
+    { 17, 19, 25, 4, 18, 81, 13619 }, // ∇
+    { 17, 18, 25, 4, 18, 77, 13700 }, // ∈
+    { 17, 23, 25, 4, 20, 98, 13777 }, // ∉
+    { 17, 15, 25, 4, 16, 64, 13875 }, // ∊
+    { 17, 18, 25, 4, 18, 77, 13939 }, // ∋
+    { 17, 23, 25, 4, 20, 98, 14016 }, // ∌
+    { 17, 15, 25, 4, 16, 64, 14114 }, // ∍
+    { 21, 22, 21, 0, 18, 116, 14178 }, // ∏
+    { 16, 23, 17, 0, 18, 92, 14294 }, // ∑
+    { 12, 3, 16, 2, 10, 9, 14386 }, // −
+    { 13, 20, 13, 0, 18, 65, 14395 }, // ∕
+    { 13, 20, 13, 0, 18, 65, 14460 }, // ∖
+    { 12, 13, 16, 2, 15, 39, 14525 }, // ∗
+    { 10, 10, 16, 3, 13, 25, 14564 }, // ∘
+    { 6, 5, 16, 5, 9, 8, 14589 }, // ∙
+    { 17, 24, 16, -1, 21, 102, 14597 }, // √
+    { 13, 10, 16, 1, 13, 33, 14699 }, // ∝
+    { 16, 10, 16, 0, 13, 40, 14732 }, // ∞
+    { 17, 18, 25, 4, 18, 77, 14772 }, // ∟
+    { 19, 18, 25, 3, 18, 86, 14849 }, // ∠
+    { 4, 26, 13, 4, 20, 26, 14935 }, // ∣
+    { 9, 26, 13, 2, 20, 59, 14961 }, // ∥
+    { 18, 18, 25, 4, 18, 81, 15020 }, // ∧
+    { 18, 18, 25, 4, 18, 81, 15101 }, // ∨
+    { 15, 18, 25, 5, 18, 68, 15182 }, // ∩
+    { 15, 19, 25, 5, 18, 72, 15250 }, // ∪
+    { 15, 26, 16, 0, 20, 98, 15322 }, // ∫
+    { 17, 15, 25, 4, 14, 64, 15420 }, // ∴
+    { 17, 15, 25, 4, 14, 64, 15484 }, // ∵
+    { 6, 15, 8, 1, 16, 23, 15548 }, // ∶
+    { 17, 15, 25, 4, 14, 64, 15571 }, // ∷
+    { 15, 6, 25, 5, 10, 23, 15635 }, // ∼
+    { 15, 15, 25, 5, 16, 57, 15658 }, // ≅
+    { 13, 11, 16, 1, 14, 36, 15715 }, // ≈
+    { 15, 10, 25, 5, 12, 38, 15751 }, // ≍
+    { 12, 13, 16, 2, 15, 39, 15789 }, // ≠
+    { 15, 13, 25, 5, 14, 49, 15828 }, // ≡
+    { 12, 15, 16, 2, 15, 45, 15877 }, // ≤
+    { 12, 16, 16, 2, 16, 48, 15922 }, // ≥
+    { 21, 13, 25, 2, 15, 69, 15970 }, // ≪
+    { 21, 13, 25, 2, 15, 69, 16039 }, // ≫
+    { 17, 15, 25, 4, 16, 64, 16108 }, // ⊃
+    { 17, 23, 25, 4, 20, 98, 16172 }, // ⊄
+    { 17, 23, 25, 4, 20, 98, 16270 }, // ⊅
+    { 17, 18, 25, 4, 18, 77, 16368 }, // ⊆
+    { 17, 18, 25, 4, 18, 77, 16445 }, // ⊇
+    { 19, 19, 25, 3, 18, 91, 16522 }, // ⊕
+    { 19, 19, 25, 3, 18, 91, 16613 }, // ⊖
+    { 19, 19, 25, 3, 18, 91, 16704 }, // ⊗
+    { 19, 19, 25, 3, 18, 91, 16795 }, // ⊘
+    { 15, 18, 25, 5, 18, 68, 16886 }, // ⊥
+    { 6, 5, 16, 5, 9, 8, 16954 }, // ⋅
+    { 23, 5, 25, 1, 9, 29, 16962 }, // ⋯
+    { 22, 20, 19, 0, 20, 110, 16991 }, // ﬀ
+    { 18, 20, 17, 0, 20, 90, 17101 }, // ﬁ
+    { 18, 20, 18, 0, 20, 90, 17191 }, // ﬂ
+    { 26, 20, 26, 0, 20, 130, 17281 }, // ﬃ
+    { 26, 20, 26, 0, 20, 130, 17411 }, // ﬄ
+    { 20, 21, 20, 0, 20, 105, 17541 }, // ﬅ
+    { 22, 21, 23, 1, 20, 116, 17646 }, // ﬆ
+    { 25, 24, 25, 0, 21, 150, 17762 }, // �
 };
 
 static const EpdUnicodeInterval bookerly_12_boldIntervals[] = {
@@ -2315,32 +2366,313 @@ static const EpdUnicodeInterval bookerly_12_boldIntervals[] = {
     { 0x22A5, 0x22A5, 0x2E7 },
     { 0x22C5, 0x22C5, 0x2E8 },
     { 0x22EF, 0x22EF, 0x2E9 },
-    { 0xFFFD, 0xFFFD, 0x2EA },
+    { 0xFB00, 0xFB06, 0x2EA },
+    { 0xFFFD, 0xFFFD, 0x2F1 },
 };
 
 static const EpdFontGroup bookerly_12_boldGroups[] = {
-    { 0, 3350, 5896, 100, 0 },
-    { 3350, 3130, 7263, 96, 100 },
-    { 6480, 4673, 11519, 128, 196 },
-    { 11153, 339, 386, 33, 324 },
-    { 11492, 7953, 19263, 220, 357 },
-    { 19445, 1100, 1922, 74, 577 },
-    { 20545, 441, 555, 18, 651 },
-    { 20986, 272, 373, 4, 669 },
-    { 21258, 504, 832, 15, 673 },
-    { 21762, 1960, 3763, 58, 688 },
-    { 23722, 105, 150, 1, 746 },
+    { 0, 4489, 10287, 151, 5 },
+    { 4489, 2835, 5317, 66, 358 },
+    { 7324, 8254, 19177, 263, 0 },
+    { 15578, 8958, 17912, 274, 473 },
+};
+
+static const uint8_t bookerly_12_boldGlyphGroups[754] = {
+    2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0,
+    2, 2, 2, 2, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0,
+    0, 2, 2, 2, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0,
+    0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 3, 3, 3, 0, 0, 3, 3, 0, 0, 3,
+    3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+};
+
+static const uint8_t bookerly_12_boldKernLeftClasses[754] = {
+    0, 0, 0, 0, 0, 0, 0, 84, 0, 0, 0, 0, 84, 70, 0, 72,
+    0, 3, 33, 3, 30, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 2, 100, 76, 12, 0, 60, 0, 0, 0, 41,
+    51, 32, 115, 17, 12, 68, 63, 24, 66, 11, 10, 6, 6, 89, 4, 110,
+    79, 54, 0, 0, 0, 0, 29, 15, 73, 0, 65, 23, 44, 27, 0, 0,
+    75, 78, 27, 27, 15, 15, 92, 31, 62, 62, 53, 9, 9, 99, 9, 62,
+    80, 0, 0, 0, 0, 97, 0, 0, 0, 0, 0, 0, 0, 0, 0, 85,
+    0, 33, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 57,
+    0, 0, 0, 39, 2, 2, 2, 2, 2, 2, 0, 76, 0, 0, 0, 0,
+    0, 0, 0, 0, 12, 17, 12, 12, 12, 12, 12, 0, 83, 10, 10, 10,
+    10, 4, 52, 101, 29, 29, 29, 29, 29, 29, 65, 73, 65, 65, 65, 65,
+    0, 0, 34, 34, 15, 27, 15, 15, 15, 15, 15, 0, 15, 53, 53, 53,
+    53, 9, 15, 9, 2, 29, 2, 29, 49, 77, 76, 73, 76, 73, 76, 73,
+    76, 73, 12, 26, 12, 0, 0, 65, 0, 65, 0, 65, 0, 107, 0, 65,
+    0, 44, 0, 44, 0, 44, 0, 44, 0, 27, 0, 27, 0, 34, 0, 34,
+    0, 34, 0, 111, 0, 0, 41, 0, 41, 108, 51, 75, 75, 32, 78, 32,
+    78, 0, 26, 0, 0, 32, 82, 17, 27, 17, 27, 17, 27, 27, 17, 27,
+    12, 15, 12, 15, 12, 15, 0, 65, 24, 31, 24, 31, 24, 31, 66, 62,
+    66, 62, 66, 62, 66, 62, 11, 116, 11, 0, 11, 62, 10, 53, 10, 53,
+    10, 53, 10, 53, 10, 53, 10, 93, 6, 9, 4, 9, 4, 110, 62, 110,
+    62, 110, 62, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 98, 98, 71, 0, 117, 106, 18, 18, 55, 20, 20,
+    50, 5, 18, 1, 18, 21, 113, 61, 13, 25, 98, 5, 61, 18, 18, 5,
+    18, 103, 18, 8, 18, 36, 105, 13, 1, 58, 46, 25, 18, 18, 25, 20,
+    18, 20, 8, 8, 18, 48, 14, 114, 43, 47, 62, 45, 62, 69, 69, 45,
+    69, 69, 69, 14, 69, 14, 73, 43, 19, 14, 95, 47, 69, 69, 47, 28,
+    69, 28, 14, 14, 69, 62, 62, 81, 43, 0, 62, 112, 94, 0, 28, 28,
+    67, 45, 69, 19, 69, 90, 102, 8, 14, 40, 74, 25, 47, 20, 28, 36,
+    14, 38, 86, 35, 43, 0, 0, 37, 91, 61, 62, 37, 91, 5, 45, 5,
+    45, 5, 45, 25, 47, 0, 0, 0, 0, 104, 96, 105, 73, 13, 43, 22,
+    19, 22, 19, 59, 88, 25, 47, 25, 47, 18, 69, 56, 67, 109, 62, 109,
+    62, 18, 5, 45, 98, 69, 25, 47, 55, 87, 25, 47, 18, 69, 25, 47,
+    78, 21, 48, 21, 48, 98, 62, 98, 62, 8, 14, 8, 14, 5, 45, 61,
+    62, 0, 0, 18, 69, 18, 69, 8, 14, 8, 14, 8, 14, 8, 14, 1,
+    19, 1, 19, 1, 19, 18, 69, 13, 43, 18, 69, 35, 43, 64, 88, 46,
+    95, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 33, 33, 0, 33, 33, 33, 0, 0, 7, 16, 42, 7, 7, 16, 3,
+    7, 0, 0, 0, 0, 0, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 85, 57, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 23, 0, 78, 0, 78, 62,
+    62, 0,
+};
+
+static const uint8_t bookerly_12_boldKernRightClasses[754] = {
+    0, 0, 0, 0, 0, 0, 0, 69, 0, 0, 0, 0, 69, 0, 58, 46,
+    0, 33, 30, 3, 36, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 102,
+    99, 0, 0, 0, 43, 0, 2, 65, 5, 65, 65, 65, 5, 65, 65, 81,
+    65, 65, 106, 65, 5, 65, 5, 65, 72, 25, 11, 27, 27, 90, 15, 0,
+    0, 21, 94, 0, 0, 0, 18, 31, 1, 1, 1, 91, 22, 31, 95, 88,
+    31, 31, 48, 48, 1, 108, 1, 48, 17, 44, 35, 20, 20, 78, 13, 86,
+    0, 0, 92, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 47,
+    0, 30, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 84,
+    0, 0, 0, 101, 2, 2, 2, 2, 2, 2, 40, 5, 65, 65, 65, 65,
+    65, 65, 65, 65, 65, 65, 5, 5, 5, 5, 5, 0, 76, 11, 11, 11,
+    11, 15, 65, 89, 18, 18, 18, 74, 75, 18, 18, 1, 1, 1, 1, 63,
+    107, 95, 60, 24, 1, 48, 1, 1, 1, 1, 1, 0, 68, 35, 35, 35,
+    35, 13, 87, 13, 2, 77, 2, 79, 2, 18, 5, 1, 5, 1, 5, 1,
+    5, 1, 65, 1, 65, 1, 65, 1, 65, 1, 65, 1, 65, 1, 65, 1,
+    5, 22, 5, 57, 5, 22, 5, 22, 65, 31, 65, 83, 65, 24, 65, 24,
+    65, 24, 65, 95, 65, 95, 65, 95, 81, 61, 65, 31, 48, 65, 31, 65,
+    31, 65, 31, 65, 31, 65, 67, 65, 48, 65, 48, 65, 48, 48, 65, 48,
+    5, 1, 5, 1, 5, 1, 5, 1, 65, 48, 65, 48, 65, 98, 72, 17,
+    72, 17, 72, 17, 72, 62, 25, 44, 25, 44, 25, 44, 11, 35, 11, 35,
+    11, 35, 11, 35, 11, 35, 11, 35, 27, 20, 15, 13, 15, 0, 86, 0,
+    86, 0, 97, 89, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 70, 70, 10, 70, 12, 104, 70, 70, 82, 38, 70,
+    10, 70, 70, 34, 70, 16, 70, 70, 70, 59, 70, 49, 64, 70, 70, 70,
+    38, 96, 70, 12, 70, 70, 12, 10, 34, 52, 55, 70, 23, 70, 70, 10,
+    70, 70, 0, 70, 66, 37, 105, 8, 8, 51, 4, 39, 54, 8, 8, 8,
+    29, 8, 8, 4, 8, 93, 4, 9, 19, 4, 42, 8, 7, 8, 8, 9,
+    8, 8, 54, 8, 50, 4, 4, 100, 8, 4, 71, 0, 80, 73, 29, 8,
+    100, 8, 8, 26, 8, 10, 9, 12, 4, 56, 19, 70, 8, 0, 110, 70,
+    93, 70, 8, 70, 8, 70, 8, 49, 39, 64, 54, 70, 8, 70, 8, 0,
+    0, 10, 9, 70, 8, 70, 8, 70, 8, 12, 4, 12, 4, 10, 9, 41,
+    19, 41, 19, 55, 42, 0, 9, 23, 7, 23, 7, 70, 100, 32, 14, 32,
+    14, 70, 49, 39, 70, 8, 38, 29, 70, 8, 70, 8, 23, 7, 0, 8,
+    100, 16, 37, 16, 37, 45, 37, 70, 4, 103, 85, 0, 85, 49, 39, 64,
+    54, 0, 109, 70, 8, 70, 8, 12, 4, 12, 4, 12, 4, 0, 54, 34,
+    26, 34, 53, 34, 26, 0, 7, 70, 8, 70, 8, 70, 8, 55, 42, 55,
+    42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 30, 30, 0, 30, 30, 30, 0, 0, 6, 28, 3, 6, 6, 28, 3,
+    6, 0, 0, 0, 0, 0, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 47, 84, 0, 0, 0, 0, 0,
+    43, 43, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 91, 91, 91, 91, 91, 91,
+    17, 0,
+};
+
+static const int8_t bookerly_12_boldKernMatrix[13098] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -3, -3, 0, 0, -1, -2, -1, 0, 0, -2, 0, -3, 0, -4, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, -1, 0, -1, -3, 0, 0, -2, -2, -2, -2, 0, 1, -2, 0, 0, -4, 0, -2, 0, 0, -4, -3, -2, -1, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, -3, 0, 0, 0, 0, -2, 0, -2, 0, -3, 0, 0, 0, 0, -2, -2, 0, 0, 0, -3, 0, -3, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, -1, -2, -2, 0, -1, -2, -1, -1, -2, -1, -2, 1, 0, 0, -2, -2, 0, 0, -2, 0, -2, -2, -3, -1, 0, 0, 0, -2, 0, -1, -1, 0, 0, 0, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, -3, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, -2, 0, -1, 0, -2, 0, 2, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, -1, -3, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 2, 1, -2, -2, 0, 0, 0, 0, -2, 0, 0, 0, -1, 0, -2, -1, -2, -1, -1, -1, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, -2, 0, -2, -1, 0, -1, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -2, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0,
+    0, -2, -4, -3, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, -2, 0, -1, 0, -2, 0, 2, 0, 0, 0, 0, 0, -1, 1, 0, -3, 0, -1, -3, 0, 0, 0, -4, 0, 0, 0, 0, 0, 1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 2, 2, -2, -2, 0, 0, 0, 1, -2, 0, 0, 0, -1, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, 1, -1, 0, -1, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0,
+    0, -1, -2, -2, -1, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, -2, -1, 0, 1, 1, 0, -1, 0, 1, 1, 1, 0, 0, -1, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, -3, 0, 1, 0, 0, -3, 0, 0, 0, 0, -1, -1, 0, 1, 0, 0, 0, -1, 0, -2, 1, 1, -1, -1, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, -2, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, -2, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 1, -1, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, -3, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, 0, 0, 0, -2, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -3, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 1, 0, -2, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0,
+    0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -2, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -2, 0, 0, -3, -1, -2, 0, 0, 0, 0, 0, 0, -2, 0, -1, 0, 0, -2, -2, -1, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, -3, -2, -2, -1, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -3, -2, -1, 0, 0, 0, -2, 0, 1, 0, 0, 0, 0, -2, 0, 0, 0, -2, 0, 0, 0, -1, -2, 0, -4, 0, 0, 0, 0, -4, 0, 0, 0, 0, -2, -2, 0, 0, 0, 0, 0, -2, 0, -2, 1, 1, -2, -2, 0, 0, -1, 0, -2, 0, 0, -2, 0, 0, -1, -1, -1, -1, 0, -1, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 2, 2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -2, 0, 0, 0, -2, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, -2, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -3, -2, 0, -1, -3, 0, 0, 0, -1, 0, 1, 0, 0, -1, 0, -2, 0, -3, 0, 0, -1, 0, -2, 1, -1, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, -2, 0, -1, 0, 1, -2, -1, 0, 0, 0, 0, -1, -1, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, -2, 0, 0, -1, -1, -1, 0, 0, -1, 0, -2, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, -1, 0, -1, -2, 1, 0, -3, -2, -2, -2, 0, 0, -1, 0, 0, -2, 0, -1, 0, -1, -2, -2, -1, -1, -1, 0, 1, 0, 0, -2, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 3, 0, 0, 0, 2, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 2, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, 2, 1, 1, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 1, 0, 0, 0, 2, 0, 2, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0,
+    0, 0, 1, 0, 0, -1, -2, 0, 0, 0, 0, -1, 0, -1, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, -2, 0, -2, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 2, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 2, 1, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 3, 1, 0, 0, 1, 2, 0, 2, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -3, 0, 0, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, -2, 0, -2, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -2, -2, -2, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, -2, -1, -1, -4, 0, -1, 0, 0, -4, 0, 0, -1, 0, -2, -3, -1, 0, -1, 0, 0, -2, 0, -1, 0, 0, -2, -2, 0, 0, 0, 0, -2, 0, 0, -2, -1, 0, -2, -2, -1, -2, -1, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0,
+    0, 0, 0, -2, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, -2, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, -2, 0, 0, 0, 0, -1, -3, 0, 0, 0, -1, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, 0, -2, -1, -2, 0, 0, 0, 0, 0, 0, -3, 1, 0, 0, 0, -2, -2, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, -2, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, -3, 1, 0, 0, -1, -1, -2, 0, 1, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, -2, 0, -2, -1, 0, -1, 0, -2, 0, 0, 0, 0, 1, 0, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, -2, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, -2, 0, 0, -2, -2, -1, 0, 0, -1, 0, -3, 0, -3, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, 0, -2, -1, 0, 0, -2, -2, -2, -1, 0, 0, -1, 0, 0, -3, 0, 0, 0, 0, -2, -2, -1, -1, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0,
+    0, -1, 0, 0, -1, -1, 0, 0, 0, 0, -1, -1, -1, 0, 0, -2, 0, -1, -1, -1, -1, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, -1, 0, 0, -1, 0, 1, -1, -1, -1, -1, -1, -1, 0, 1, 1, -1, 0, 0, -1, -1, 1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, -2, 0, 0, 0, -1, -1, 0, 0, 0, 0, -2, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, 0, -1, -2, 0, 0, 0, -1, -2, -1, 0, 0, 0, 0, 0, -4, 0, -1, 0, -1, -2, -2, -1, 0, -2, 0, 0, 0, 0, -3, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, -1, -2, -2, 0, -1, -2, -1, -1, -1, -1, -2, 1, 0, 0, -1, -2, 0, 0, -2, 0, -2, -1, -3, -1, 0, 0, 0, -2, 0, -1, -1, 0, 0, 0, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -2, 0, -2, 0, 0, -1, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, -2, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, -3, 0, 0, 0, 0, -2, 0, -2, 0, -3, 0, 0, 0, 0, -2, -2, 0, 0, 0, -3, 0, -3, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, -2, 0, -1, -2, 0, 0, 0, -1, 0, 0, 0, 0, -2, 0, -4, 0, -3, 0, 0, -2, 0, -1, 0, 0, 0, -2, 0, -2, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1, -2, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, -2, -1, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, -2, 0, 0, -3, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, -1, 0, -1, -2, -1, -1, -1, 0, -2, 0, 0, 0, -1, -1, 0, 0, -2, 0, -2, -1, -2, 0, 0, 0, 0, -2, 0, -1, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -2, 0, -1, -2, 0, 0, 0, -1, 0, 0, 0, 0, -2, 0, -4, 0, -3, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0, -2, 0, -1, 0, 0, -1, 0, 0, 0, -2, 0, 0, 0, -2, 0, -1, 0, 0, 0, -2, -1, 0, 0, -2, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -2, 0, -2, 0, 0, -1, 0, -2, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, -2, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 1, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -2, 0, 0, 0, -3, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0, 0, 0, -2, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 2, 0, -1, 0, 2, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -2, 0, -2, 0, 0, -1, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, -2, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -3, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, -2, 0, 0, -2, 0, 0, 0, -3, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 1, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0, 0, 0, 1, 2, 2, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -3, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 1, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 2, 2, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0,
+    0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -2, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t bookerly_12_boldGlyphLookup[368] = {
+    0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0001, 0x0002, 0xFFFF, 0xFFFF, 0xFFFF, 0x0003, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0004, 0xFFFF, 0xFFFF,
+    0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, 0x0010, 0x0011, 0x0012, 0x0013, 0x0014,
+    0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, 0x0020, 0x0021, 0x0022, 0x0023, 0x0024,
+    0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, 0x0030, 0x0031, 0x0032, 0x0033, 0x0034,
+    0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, 0x0040, 0x0041, 0x0042, 0x0043, 0x0044,
+    0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051, 0x0052, 0x0053, 0x0054,
+    0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, 0x0060, 0x0061, 0x0062, 0x0063, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x0072, 0x0073,
+    0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, 0x0080, 0x0081, 0x0082, 0x0083,
+    0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F, 0x0090, 0x0091, 0x0092, 0x0093,
+    0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F, 0x00A0, 0x00A1, 0x00A2, 0x00A3,
+    0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF, 0x00B0, 0x00B1, 0x00B2, 0x00B3,
+    0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF, 0x00C0, 0x00C1, 0x00C2, 0x00C3,
+    0x0241, 0x0242, 0x0243, 0x0244, 0x0245, 0x0246, 0x0247, 0x0248, 0x0249, 0x024A, 0x024B, 0x024C, 0x024D, 0x024E, 0x024F, 0x0250,
+    0x0251, 0x0252, 0x0253, 0x0254, 0x0255, 0x0256, 0x0257, 0x0258, 0x0259, 0x025A, 0x025B, 0x025C, 0x025D, 0x025E, 0x025F, 0x0260,
+    0x0261, 0x0262, 0x0263, 0x0264, 0x0265, 0x0266, 0x0267, 0x0268, 0x0269, 0x026A, 0x026B, 0x026C, 0x026D, 0x026E, 0x026F, 0x0270,
+    0x0271, 0xFFFF, 0x0272, 0x0273, 0x0274, 0x0275, 0x0276, 0x0277, 0x0278, 0x0279, 0x027A, 0x027B, 0x027C, 0xFFFF, 0x027D, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x027E, 0x027F, 0xFFFF, 0xFFFF, 0x0280, 0x0281, 0x0282, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x0283, 0xFFFF, 0xFFFF, 0xFFFF, 0x0284, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0285,
+    0x0286, 0x0287, 0x0288, 0x0289, 0x028A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
 };
 
 static const EpdFontData bookerly_12_bold = {
     bookerly_12_boldBitmaps,
     bookerly_12_boldGlyphs,
     bookerly_12_boldIntervals,
-    64,
+    65,
     33,
     27,
     -7,
     true,
     bookerly_12_boldGroups,
-    11,
+    4,
+    bookerly_12_boldKernLeftClasses,
+    bookerly_12_boldKernRightClasses,
+    bookerly_12_boldKernMatrix,
+    111,
+    nullptr,
+    0,
+    0,
+    bookerly_12_boldGlyphLookup,
+    bookerly_12_boldGlyphGroups,
+    false,
+    nullptr,
 };
@@ -3,1618 +3,1660 @@
  * name: bookerly_12_bolditalic
  * size: 12
  * mode: 2-bit  compressed: true
- * Command used: fontconvert.py bookerly_12_bolditalic 12 ../builtinFonts/source/Bookerly/Bookerly-BoldItalic.ttf --2bit --compress
+ * Command used: fontconvert.py bookerly_12_bolditalic 12 ../builtinFonts/source/Bookerly/Bookerly-BoldItalic.ttf --2bit --compress --frequency-corpus ../../../test/hyphenation_eval/resources/english_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/french_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/german_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/italian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/russian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/spanish_hyphenation_tests.txt
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t bookerly_12_bolditalicBitmaps[25695] = {
-    0x7D, 0x58, 0x31, 0x8C, 0xE4, 0xC6, 0x95, 0xFD, 0x24, 0x67, 0x45, 0x43, 0x84, 0xC1, 0xC1, 0x41,
-    0x2B, 0x1C, 0x24, 0xE3, 0x4A, 0x81, 0x93, 0x03, 0xD6, 0xC7, 0xC4, 0x81, 0x82, 0xDD, 0x29, 0x6A,
-    0x15, 0xEC, 0x01, 0x0A, 0x2C, 0x1C, 0xD4, 0xC9, 0x5D, 0xB0, 0x0E, 0x1C, 0x18, 0x52, 0xB0, 0x17,
-    0x28, 0x70, 0xB0, 0x33, 0xE4, 0x6A, 0x03, 0x1D, 0xB0, 0x81, 0x26, 0x38, 0x43, 0xA1, 0x14, 0x28,
-    0x90, 0x07, 0x06, 0xA4, 0xE0, 0x02, 0xC3, 0x9E, 0x6D, 0x72, 0x67, 0x02, 0x05, 0x1B, 0x88, 0xB0,
-    0x0C, 0x38, 0x50, 0x20, 0xAE, 0x6C, 0x9F, 0x0D, 0x0B, 0xB8, 0x29, 0x79, 0x29, 0x8B, 0xE3, 0x2E,
-    0x56, 0xDD, 0x7B, 0xC5, 0xEE, 0x99, 0x31, 0xCE, 0xB8, 0x9E, 0xEE, 0xE9, 0x6E, 0x36, 0x59, 0xF5,
-    0xFF, 0xFB, 0xEF, 0xBF, 0xFF, 0x3F, 0xE5, 0x87, 0x91, 0x4D, 0xC6, 0x74, 0x48, 0x4D, 0xD6, 0xE7,
-    0x5D, 0xDE, 0xE2, 0xAF, 0x56, 0xA5, 0x92, 0x42, 0xBE, 0x23, 0x22, 0x5B, 0x52, 0x49, 0x23, 0xF7,
-    0x65, 0x5B, 0xB2, 0x37, 0x8F, 0x06, 0xAB, 0x8B, 0xBB, 0x7F, 0x1A, 0xF6, 0x74, 0xFA, 0x89, 0xB9,
-    0xBD, 0x93, 0xDD, 0xAD, 0x65, 0xFD, 0x28, 0x92, 0x5E, 0x74, 0xDA, 0xC9, 0x4E, 0xD6, 0x5E, 0x5A,
-    0xDE, 0xFC, 0x95, 0xF2, 0x7E, 0x7A, 0xC6, 0x35, 0x7F, 0x90, 0xB1, 0x90, 0x68, 0xD0, 0x12, 0x9B,
-    0x1D, 0xA9, 0xBC, 0x37, 0x0D, 0x5E, 0x69, 0x6F, 0x25, 0x6B, 0x47, 0xC9, 0x1F, 0x0C, 0x92, 0xBF,
-    0x61, 0xD6, 0x0B, 0x5C, 0x11, 0x49, 0xB0, 0xDA, 0xEB, 0x22, 0xB7, 0x6A, 0x9C, 0x5A, 0xAA, 0x13,
-    0x9B, 0x3C, 0xFA, 0xB4, 0xDB, 0xBD, 0x72, 0x35, 0x7D, 0x7C, 0x5C, 0xEA, 0x51, 0x62, 0xDF, 0x4A,
-    0xE6, 0xB1, 0x93, 0x95, 0xC8, 0xF7, 0xB7, 0xAF, 0x34, 0xF9, 0xF1, 0xB1, 0x99, 0x9E, 0xDF, 0xCB,
-    0x56, 0x37, 0x5B, 0xED, 0x07, 0x69, 0x46, 0x89, 0x7A, 0xA1, 0xC9, 0x49, 0x2B, 0x72, 0x55, 0xE4,
-    0x89, 0x72, 0x63, 0x1C, 0x6C, 0x8F, 0x5B, 0x29, 0x46, 0x51, 0x75, 0xB2, 0x1A, 0xC4, 0x4A, 0x71,
-    0xA3, 0xCF, 0x5A, 0xB1, 0x79, 0xBD, 0x2B, 0x69, 0xB7, 0x03, 0xD3, 0x8B, 0x17, 0x60, 0xA4, 0x1C,
-    0xE6, 0x0F, 0x8C, 0xC4, 0xC3, 0x5E, 0x7E, 0xDD, 0xA5, 0x2B, 0x33, 0x6A, 0x97, 0xBA, 0xEC, 0xD8,
-    0x58, 0x91, 0xDB, 0xEA, 0xFA, 0x20, 0x49, 0x67, 0x71, 0x91, 0x4E, 0x0C, 0xDD, 0xC9, 0x6B, 0xAC,
-    0x56, 0xEA, 0xAC, 0xC3, 0x6A, 0x6E, 0x29, 0x79, 0x0B, 0x9B, 0xB8, 0xF7, 0x0F, 0xB8, 0xD9, 0xF9,
-    0xA3, 0xA2, 0x7B, 0x8D, 0xE7, 0xA7, 0x1C, 0x56, 0xE9, 0x18, 0xDF, 0x79, 0xA9, 0xA4, 0x8F, 0x46,
-    0xF9, 0x7E, 0xB4, 0x1A, 0xA2, 0x43, 0xA9, 0xFA, 0xC2, 0x49, 0xD3, 0x36, 0xA7, 0xE2, 0x07, 0x3D,
-    0xC8, 0xA4, 0xB7, 0x6E, 0xE3, 0xEC, 0x5E, 0x4B, 0x71, 0x67, 0x52, 0x65, 0xD6, 0x17, 0x9F, 0xB5,
-    0xB1, 0x4D, 0xE0, 0x7D, 0xB5, 0xDF, 0xF4, 0x80, 0xC0, 0xFB, 0x7D, 0xA9, 0x5C, 0x81, 0x03, 0x58,
-    0xBA, 0x9F, 0xF7, 0xC9, 0xEE, 0x7D, 0x62, 0xEC, 0x9E, 0xBA, 0x71, 0x14, 0xBE, 0x7F, 0x4B, 0x64,
-    0x92, 0xD4, 0x88, 0xC2, 0x35, 0x02, 0x03, 0xE3, 0x91, 0xDF, 0x60, 0x2B, 0x6C, 0x50, 0xB5, 0x14,
-    0xA5, 0xC0, 0xD9, 0x8B, 0x4F, 0x1C, 0xC1, 0xB9, 0xF8, 0x35, 0xEB, 0x25, 0x31, 0x12, 0xC1, 0xE5,
-    0xFB, 0x22, 0x7F, 0x2F, 0xF2, 0x1C, 0xBF, 0xF2, 0xDA, 0x9E, 0xBF, 0x16, 0xF5, 0xBC, 0x5E, 0x32,
-    0x70, 0x31, 0x7C, 0xBB, 0x0F, 0xB4, 0xF8, 0x83, 0xE6, 0x16, 0x78, 0xDF, 0xE3, 0xE9, 0x45, 0x89,
-    0x2F, 0x45, 0x8B, 0x7F, 0xBA, 0x96, 0xEF, 0x07, 0xF4, 0x6F, 0xB4, 0x57, 0x0F, 0x53, 0xBF, 0x95,
-    0xF9, 0x07, 0x8D, 0xAD, 0x3E, 0x7C, 0xF1, 0x61, 0x2D, 0x3F, 0xA3, 0x9D, 0x87, 0xE7, 0xCF, 0x57,
-    0xDD, 0xFB, 0x8D, 0x9F, 0x0E, 0xDC, 0xFB, 0x17, 0x0F, 0xE2, 0x11, 0xED, 0x17, 0x6D, 0x55, 0xDA,
-    0xB4, 0xD7, 0xA9, 0xF9, 0x27, 0x3A, 0x3C, 0x79, 0xE7, 0xA7, 0x4B, 0xF9, 0xC3, 0x3F, 0x8D, 0x4F,
-    0xE1, 0x2B, 0xB6, 0xA7, 0xE5, 0xB0, 0x49, 0xD2, 0x3E, 0xB8, 0xF2, 0xB7, 0x8F, 0xE4, 0xFF, 0xDF,
-    0x91, 0xF9, 0x81, 0xE5, 0x52, 0x60, 0xAA, 0xBD, 0x11, 0xFF, 0xCE, 0x98, 0xD8, 0xC4, 0x66, 0x26,
-    0xB6, 0x79, 0x17, 0x5B, 0xF8, 0x62, 0x75, 0x8D, 0x57, 0x99, 0xD8, 0x4A, 0x92, 0xB1, 0x01, 0x22,
-    0x8D, 0xE4, 0x7D, 0x53, 0xC2, 0xB6, 0xBA, 0x2A, 0xF5, 0xCA, 0x89, 0x02, 0x03, 0x53, 0x5F, 0x9F,
-    0xF1, 0xED, 0x09, 0x1B, 0x35, 0x36, 0xF6, 0xA3, 0xFC, 0x1B, 0xB0, 0x02, 0x46, 0x86, 0x4F, 0x05,
-    0xA2, 0x75, 0xA2, 0xDB, 0xF5, 0xB3, 0xAA, 0xA5, 0x29, 0x05, 0x54, 0x47, 0xDC, 0x71, 0xB9, 0xBC,
-    0x0C, 0x96, 0x38, 0xC9, 0xBD, 0x13, 0xFF, 0xB6, 0x4D, 0x4D, 0x3A, 0xE4, 0xA5, 0xEA, 0xB6, 0x04,
-    0xEC, 0x49, 0xC1, 0x98, 0xAA, 0x95, 0xD4, 0x86, 0xB7, 0x0C, 0xDF, 0x9A, 0x5A, 0xF2, 0x41, 0x22,
-    0x07, 0x67, 0x91, 0x52, 0xE0, 0xC4, 0x91, 0xF7, 0xF8, 0x35, 0xAC, 0x31, 0x61, 0x8D, 0x49, 0x9A,
-    0xB7, 0x6D, 0x62, 0x32, 0x93, 0x22, 0x14, 0x12, 0x4D, 0xC2, 0x9D, 0x9F, 0x05, 0x15, 0x70, 0x56,
-    0xF6, 0x01, 0x16, 0x80, 0x39, 0xFC, 0x45, 0xB8, 0x82, 0xB9, 0xF4, 0x9A, 0x2F, 0x1B, 0x3A, 0x7E,
-    0x7A, 0xC6, 0xDC, 0x32, 0xC0, 0x18, 0x36, 0xC0, 0x3E, 0x00, 0x46, 0x79, 0x89, 0x4E, 0x41, 0xFA,
-    0x7B, 0x5D, 0x34, 0xEA, 0x52, 0xB5, 0x36, 0x82, 0x8D, 0xCC, 0x73, 0x6C, 0xFE, 0x67, 0xBC, 0xDA,
-    0x00, 0x3B, 0xF8, 0x11, 0x73, 0xF5, 0x6E, 0x2D, 0x0B, 0xD8, 0x4E, 0x03, 0x05, 0x7D, 0xF0, 0xAE,
-    0x2C, 0x85, 0xB4, 0x14, 0x38, 0x8C, 0xF5, 0x90, 0xAC, 0x1E, 0x8E, 0x45, 0xF8, 0x42, 0x1C, 0x48,
-    0x95, 0xF0, 0xA2, 0xB3, 0x4E, 0x9E, 0x46, 0x32, 0x6B, 0x0F, 0xA8, 0xA6, 0x8D, 0x39, 0x51, 0x09,
-    0xD3, 0x3B, 0x69, 0x5C, 0x99, 0xC3, 0x24, 0x1F, 0xBC, 0xE7, 0x4A, 0x29, 0x17, 0xF7, 0x53, 0xE4,
-    0x3E, 0x40, 0xB8, 0x32, 0xA3, 0x6B, 0xD5, 0x39, 0xA9, 0x92, 0x11, 0x91, 0x33, 0x79, 0xAF, 0xBE,
-    0xF2, 0x30, 0x01, 0xC0, 0xBB, 0xF3, 0x94, 0xD4, 0xDE, 0x3F, 0x80, 0xB9, 0xC8, 0xA3, 0x51, 0x63,
-    0x4B, 0x44, 0x3A, 0xAA, 0x01, 0x44, 0x0C, 0xF4, 0x54, 0x17, 0xF0, 0x20, 0x34, 0x08, 0x0C, 0x41,
-    0xD7, 0x33, 0x04, 0x3C, 0x42, 0xEB, 0xD6, 0x08, 0xCF, 0x6C, 0x41, 0xD6, 0x26, 0xF0, 0x41, 0x77,
-    0x2E, 0xB2, 0xF1, 0x48, 0xE9, 0x2C, 0xDA, 0x46, 0xF4, 0x89, 0x61, 0x14, 0x63, 0x04, 0x54, 0x9F,
-    0x0C, 0xC9, 0x98, 0x9B, 0x02, 0x36, 0x4D, 0xA2, 0x5F, 0xA4, 0x4D, 0xA7, 0xB7, 0x3A, 0xE5, 0x19,
-    0xE3, 0xFA, 0x22, 0xEB, 0x90, 0x4B, 0x14, 0xB0, 0xB7, 0x21, 0x25, 0xD1, 0x84, 0xE4, 0x73, 0xF1,
-    0xFC, 0x82, 0x5B, 0x88, 0x9C, 0xFF, 0xC2, 0x42, 0x10, 0x47, 0x64, 0xBE, 0x09, 0x51, 0x64, 0xEC,
-    0x81, 0x91, 0x34, 0x83, 0x50, 0x04, 0x8A, 0x75, 0xCC, 0x62, 0xA3, 0xBA, 0xAA, 0x1C, 0xCE, 0xFC,
-    0x7C, 0x2A, 0x31, 0x45, 0xBB, 0xA4, 0xB9, 0x0A, 0xC4, 0x4B, 0x07, 0x19, 0x2E, 0xE8, 0x12, 0x74,
-    0xAA, 0x81, 0xBB, 0x89, 0x89, 0x46, 0x41, 0x20, 0xE7, 0x74, 0x0C, 0x8F, 0x1F, 0x91, 0x65, 0x55,
-    0x8F, 0x0D, 0xAA, 0x9E, 0x28, 0x68, 0xF2, 0xBA, 0x94, 0x6A, 0x08, 0xEC, 0xFB, 0x51, 0x90, 0xB3,
-    0x09, 0xCF, 0x57, 0x0F, 0xDE, 0xC7, 0xE7, 0xCB, 0x8B, 0x57, 0xE6, 0xAF, 0xF3, 0xC5, 0xCF, 0x87,
-    0x60, 0x16, 0x14, 0xEB, 0x52, 0x8A, 0x41, 0xE2, 0x49, 0x32, 0x2B, 0x4D, 0xA7, 0x26, 0x1E, 0x7F,
-    0x7E, 0xBD, 0x85, 0x32, 0x95, 0x6D, 0xDC, 0xEB, 0x40, 0x5F, 0xAE, 0x09, 0x48, 0xAA, 0xDA, 0x1D,
-    0x24, 0xBB, 0x6F, 0xC9, 0x83, 0x2D, 0x68, 0x88, 0x03, 0x4D, 0x82, 0x88, 0x5E, 0x96, 0xB0, 0x5D,
-    0x4F, 0x1E, 0x01, 0x80, 0xD4, 0x95, 0xCF, 0x8E, 0x5C, 0x08, 0xB9, 0x01, 0x28, 0x32, 0x48, 0xE4,
-    0xDE, 0x95, 0xFC, 0x68, 0xC8, 0xBD, 0xD1, 0x79, 0x7D, 0xBF, 0xA8, 0xED, 0x61, 0xDA, 0x5F, 0x4B,
-    0x1E, 0x1B, 0x1D, 0x99, 0xFC, 0xAD, 0x7A, 0x84, 0xBC, 0xEF, 0xA6, 0xFD, 0x6E, 0xF2, 0xE5, 0xA0,
-    0xEE, 0x0E, 0xC5, 0x8D, 0xAE, 0x6A, 0x7E, 0x39, 0xAA, 0xDA, 0x3F, 0xF4, 0x75, 0x15, 0x5B, 0xF5,
-    0xDB, 0x10, 0xCD, 0x10, 0x77, 0x94, 0x8C, 0x49, 0xA2, 0x77, 0xE1, 0xE8, 0x01, 0x02, 0x83, 0xA0,
-    0x12, 0xAA, 0x5B, 0x3F, 0x99, 0xAD, 0xFD, 0xE1, 0xE6, 0x24, 0xFA, 0x2F, 0x39, 0x3D, 0x2D, 0xF8,
-    0x6F, 0x87, 0x7C, 0x86, 0x1E, 0xA0, 0xBE, 0xE1, 0x1F, 0xAB, 0x02, 0x44, 0x51, 0x97, 0x10, 0x16,
-    0x30, 0xA5, 0x60, 0x3E, 0x54, 0xFC, 0x37, 0xCD, 0x52, 0x48, 0xAC, 0x11, 0x06, 0x5C, 0xE9, 0xA7,
-    0xCA, 0xC5, 0x00, 0xEC, 0x99, 0x9F, 0x97, 0x31, 0xAB, 0xA1, 0x3F, 0xB1, 0x51, 0xF1, 0x00, 0x04,
-    0xA9, 0x9D, 0xE8, 0x12, 0x40, 0x95, 0x40, 0x0C, 0x0A, 0xDB, 0x80, 0x16, 0xB4, 0x64, 0x7A, 0x16,
-    0x01, 0x8A, 0xA7, 0xD8, 0x46, 0x53, 0x62, 0x51, 0x08, 0x40, 0xD8, 0x74, 0x04, 0x84, 0x58, 0xBC,
-    0x39, 0xCB, 0xD7, 0xD7, 0xDE, 0x05, 0xE4, 0xBE, 0x85, 0xE9, 0x26, 0x71, 0xC0, 0x74, 0x92, 0x1D,
-    0x60, 0x9F, 0x4B, 0xA8, 0x3C, 0x65, 0xE0, 0x71, 0x20, 0x71, 0x42, 0x1F, 0x78, 0x30, 0x1C, 0x18,
-    0xE5, 0x9B, 0xB1, 0xAF, 0x55, 0x8D, 0x94, 0x68, 0x53, 0x1F, 0x68, 0xB8, 0xE6, 0xE5, 0x33, 0x3F,
-    0xDF, 0x67, 0xA5, 0x19, 0xE8, 0xC3, 0x28, 0x2F, 0x19, 0xC4, 0x52, 0xB7, 0x85, 0x41, 0x68, 0x74,
-    0x0B, 0x2A, 0x51, 0xF9, 0x90, 0x17, 0x10, 0xC2, 0x01, 0x2B, 0x16, 0x5D, 0x0E, 0xAA, 0x60, 0x1F,
-    0xDA, 0x07, 0x4F, 0xB1, 0x11, 0xD2, 0xA2, 0x56, 0x26, 0xF2, 0xD0, 0x15, 0xAC, 0xD0, 0xC3, 0xB6,
-    0xDF, 0x6E, 0x08, 0xB6, 0x58, 0x2C, 0xB8, 0x6A, 0x17, 0x96, 0x6F, 0xE4, 0x36, 0x56, 0x54, 0x10,
-    0xD3, 0xB4, 0xC4, 0xBA, 0x33, 0xD0, 0x8C, 0x38, 0x05, 0x31, 0xFF, 0xDD, 0x2B, 0xB2, 0x3E, 0xB8,
-    0x8D, 0x15, 0xBF, 0x83, 0x35, 0xA1, 0x88, 0xBF, 0xBB, 0xD9, 0xB2, 0x93, 0x28, 0x42, 0x94, 0xB0,
-    0x18, 0x74, 0xC4, 0xE3, 0x12, 0x24, 0x3A, 0x68, 0xA4, 0xDB, 0x6B, 0x38, 0xEB, 0x6A, 0xF0, 0xB9,
-    0xE1, 0xEB, 0x5F, 0x6B, 0x61, 0x14, 0xBC, 0xAF, 0xA9, 0x81, 0x5C, 0x9E, 0x10, 0x24, 0xE3, 0x5A,
-    0x53, 0xF1, 0x53, 0x13, 0x7C, 0x7E, 0xED, 0x3D, 0x09, 0x49, 0x46, 0x28, 0x80, 0xCB, 0x08, 0x04,
-    0xF3, 0x12, 0x2B, 0x18, 0xA2, 0x16, 0x4F, 0x6B, 0xC4, 0x70, 0xED, 0xE2, 0x15, 0xDD, 0xE6, 0xFE,
-    0x18, 0x31, 0x1A, 0x70, 0xC4, 0x01, 0xED, 0xBC, 0x07, 0x3A, 0x88, 0xEB, 0x69, 0x43, 0xFC, 0x2D,
-    0x58, 0xB4, 0x89, 0xCA, 0xE2, 0x95, 0x4B, 0x8B, 0x97, 0x95, 0xEF, 0x90, 0xF1, 0xCD, 0x90, 0xF9,
-    0x3A, 0xA0, 0x83, 0x85, 0xF0, 0x0E, 0x0B, 0x58, 0x01, 0x4A, 0xBC, 0xA3, 0x3C, 0xC0, 0xDC, 0x86,
-    0xFE, 0xE4, 0xF4, 0x45, 0xDC, 0xE2, 0xA6, 0xE1, 0x89, 0x4E, 0x2E, 0x5E, 0x60, 0xE7, 0x92, 0x91,
-    0x50, 0x0C, 0x5E, 0xF4, 0x58, 0x0E, 0x14, 0x28, 0x85, 0xFE, 0x3B, 0xF6, 0x3E, 0xC5, 0x5C, 0x55,
-    0x6A, 0x3E, 0xB9, 0x5C, 0x08, 0xB3, 0xA3, 0xF2, 0xC3, 0xFA, 0xF9, 0x7A, 0x78, 0x5C, 0x51, 0xE7,
-    0x4B, 0xE2, 0x26, 0xBC, 0x8E, 0x17, 0x06, 0xD5, 0x63, 0x25, 0xA0, 0x83, 0x14, 0xB9, 0x80, 0x9D,
-    0xCC, 0x2F, 0x52, 0x05, 0xA7, 0xFD, 0x1F, 0xEC, 0x00, 0x7D, 0xC6, 0x56, 0xA6, 0x97, 0x2B, 0x05,
-    0x89, 0x5E, 0x53, 0xF3, 0xA4, 0xE8, 0xD7, 0x4E, 0x47, 0x7E, 0xD2, 0xF4, 0x59, 0xD1, 0xAE, 0x60,
-    0x19, 0x16, 0xD2, 0x77, 0x89, 0xF8, 0xF7, 0x70, 0x4E, 0x13, 0xB6, 0x08, 0xB5, 0x20, 0xF0, 0x31,
-    0xEC, 0x00, 0xB0, 0x51, 0x62, 0x5B, 0xEC, 0xA1, 0x0C, 0x36, 0x41, 0x10, 0xD2, 0x31, 0xF1, 0x58,
-    0x3B, 0xF2, 0x1D, 0x3A, 0xA8, 0xAA, 0xDD, 0x60, 0x0A, 0x80, 0x51, 0x53, 0xE1, 0x05, 0x2D, 0xD0,
-    0x73, 0x09, 0xA3, 0x41, 0xF4, 0xA1, 0x99, 0x6D, 0x84, 0x5D, 0x74, 0x03, 0x26, 0x7F, 0x37, 0x37,
-    0x49, 0x0F, 0x86, 0xBD, 0xE0, 0x16, 0x16, 0xB4, 0xF9, 0x1C, 0x00, 0x97, 0x72, 0x69, 0xC1, 0x67,
-    0xC6, 0x7C, 0x41, 0xDF, 0x66, 0x90, 0x03, 0xA2, 0xAC, 0xCC, 0xFD, 0x25, 0x44, 0x36, 0x39, 0xE9,
-    0xF6, 0xB0, 0xC8, 0xD7, 0xC3, 0x0E, 0x12, 0xFB, 0x70, 0xA9, 0xD0, 0xE8, 0xE8, 0xE2, 0xAD, 0x7B,
-    0x68, 0x81, 0xDE, 0xFC, 0xFA, 0x08, 0x66, 0xB5, 0x1E, 0x35, 0x06, 0x09, 0x8F, 0x6A, 0x23, 0x63,
-    0x3E, 0xA0, 0xD6, 0xED, 0x22, 0x2F, 0xA1, 0xC6, 0xB2, 0x0B, 0x1E, 0xE4, 0xED, 0x3F, 0x60, 0x6F,
-    0x24, 0x7A, 0xE4, 0xAD, 0xC2, 0x66, 0x8C, 0xE8, 0xA2, 0x8C, 0x16, 0x25, 0x8A, 0x10, 0x7C, 0x6E,
-    0xCC, 0x13, 0x1E, 0x89, 0x5F, 0xB2, 0x6B, 0xB2, 0xEC, 0xA5, 0x7C, 0xA7, 0x88, 0x5E, 0x04, 0x81,
-    0xFD, 0xCC, 0x14, 0xD8, 0xB0, 0xBA, 0x8B, 0x66, 0xE1, 0xD8, 0x42, 0x4F, 0xAC, 0xFA, 0x7D, 0x8F,
-    0x86, 0xCD, 0xB3, 0xCD, 0xCA, 0xD8, 0x9B, 0xF0, 0x92, 0x24, 0xD8, 0x5B, 0x31, 0x7B, 0xA9, 0x26,
-    0x65, 0xE6, 0xBB, 0xD4, 0xCC, 0x4D, 0x07, 0x1E, 0xAF, 0xEE, 0x03, 0x4F, 0x64, 0x32, 0x7C, 0x2D,
-    0xD5, 0xA0, 0x2C, 0x44, 0x4B, 0x77, 0xD8, 0xD0, 0x01, 0xD4, 0xE2, 0x73, 0x30, 0xC1, 0x01, 0xB1,
-    0xE2, 0x37, 0x76, 0xFE, 0xA0, 0x3F, 0x21, 0x31, 0xF0, 0xA1, 0xB9, 0x3B, 0x41, 0x96, 0x0B, 0x93,
-    0xB2, 0xDC, 0xF8, 0x32, 0x88, 0x01, 0x16, 0x96, 0x8D, 0x1A, 0x90, 0x9F, 0x2E, 0xA4, 0xED, 0x56,
-    0x93, 0xD9, 0x10, 0x4F, 0xD0, 0x1E, 0x52, 0x90, 0x1B, 0x4A, 0x12, 0x04, 0x0B, 0x07, 0x4F, 0x2C,
-    0x08, 0x4C, 0x99, 0xDE, 0x9F, 0xF3, 0x38, 0xE8, 0x0C, 0x08, 0xA5, 0xFA, 0x39, 0xD3, 0x0A, 0xDF,
-    0x6F, 0x4C, 0x0C, 0xEA, 0xC6, 0xF5, 0xD8, 0x5E, 0xA8, 0x99, 0xDD, 0x90, 0xBB, 0x12, 0xE9, 0x44,
-    0x43, 0x7B, 0x72, 0x96, 0x5A, 0x83, 0x8F, 0x89, 0x5D, 0x7F, 0xD4, 0x5D, 0xB2, 0x49, 0x83, 0xA6,
-    0x66, 0x7E, 0xE2, 0x44, 0x83, 0x77, 0xF1, 0xFF, 0x1D, 0x1A, 0x01, 0x36, 0xC4, 0x2A, 0x24, 0xB3,
-    0x0E, 0xFB, 0x90, 0xDB, 0xDC, 0xE8, 0xA0, 0x96, 0xA8, 0xF1, 0xE3, 0xA6, 0x11, 0x97, 0xCB, 0xA5,
-    0x3C, 0x0D, 0x87, 0x20, 0x20, 0x75, 0xEA, 0xBF, 0x98, 0xE4, 0xEF, 0x48, 0x38, 0x5D, 0x7B, 0x90,
-    0x0E, 0x8C, 0xAA, 0x4A, 0x0F, 0x62, 0x21, 0x27, 0x1A, 0xD4, 0x1A, 0xF6, 0x51, 0x81, 0x9E, 0xEA,
-    0x53, 0x43, 0x76, 0x82, 0x08, 0x47, 0x13, 0xC9, 0x89, 0xF3, 0xEA, 0xA6, 0xAB, 0x7C, 0xEC, 0xEF,
-    0x79, 0x93, 0x8D, 0xEB, 0x0A, 0x1C, 0x60, 0x6A, 0x21, 0x6C, 0x65, 0x55, 0x1E, 0xC6, 0x16, 0x53,
-    0x82, 0xC9, 0x4A, 0xA8, 0x26, 0xAB, 0x67, 0x30, 0xA7, 0x61, 0x03, 0x87, 0xF7, 0xC2, 0xE4, 0x70,
-    0xE3, 0x90, 0x3A, 0x9F, 0xA0, 0x29, 0xA8, 0x3A, 0xB4, 0x30, 0x6B, 0xDB, 0x05, 0xD4, 0x5C, 0x2C,
-    0xD8, 0xE5, 0x7F, 0x82, 0xD7, 0x30, 0xAA, 0xEE, 0x70, 0x37, 0x33, 0x45, 0x8E, 0xF3, 0x5E, 0x28,
-    0x1D, 0xDA, 0x20, 0xE6, 0x0E, 0xBB, 0x80, 0x6C, 0x23, 0xE7, 0x6E, 0xAD, 0xF1, 0xC5, 0x05, 0x8D,
-    0xCF, 0x3D, 0x27, 0x85, 0x81, 0x05, 0x3A, 0x5A, 0xFC, 0x8B, 0xB7, 0xB9, 0xFF, 0xB5, 0xEF, 0x8A,
-    0x53, 0xFC, 0xA4, 0x5A, 0x24, 0xC7, 0x32, 0x28, 0x0F, 0x82, 0x94, 0x53, 0xAC, 0x41, 0xAB, 0x96,
-    0x5D, 0x07, 0x2A, 0x2A, 0xF2, 0x48, 0x43, 0xDB, 0xC1, 0x4B, 0x8F, 0x2A, 0x4B, 0xB0, 0xEB, 0x8C,
-    0xE7, 0xA1, 0xCF, 0xA3, 0x26, 0x33, 0xC7, 0xCF, 0x5A, 0x97, 0xCB, 0x0B, 0x24, 0xA3, 0x77, 0x29,
-    0x92, 0xAA, 0xCB, 0x5C, 0x58, 0x0C, 0x97, 0x83, 0x98, 0x1D, 0x72, 0x41, 0xD7, 0xC8, 0x1A, 0xC7,
-    0xD9, 0xC3, 0x62, 0x76, 0x48, 0x59, 0x1D, 0xD5, 0x11, 0xEC, 0xD1, 0xEC, 0xBB, 0x27, 0xB4, 0xF6,
-    0xF1, 0x0A, 0x41, 0xE2, 0x3C, 0xC7, 0xFE, 0x72, 0xCE, 0x63, 0x39, 0xEB, 0xF6, 0x2E, 0x2F, 0xD0,
-    0x23, 0x2E, 0x5E, 0xF4, 0x28, 0xE1, 0x8D, 0x2D, 0x5C, 0x34, 0x22, 0x61, 0x9A, 0x12, 0xC2, 0xDB,
-    0xB2, 0xE0, 0xA0, 0x9C, 0x56, 0x65, 0xD3, 0x6A, 0xCC, 0x21, 0x39, 0x57, 0xD7, 0xD7, 0x7D, 0xCB,
-    0xA1, 0xE4, 0x9A, 0xE5, 0x64, 0x73, 0xEF, 0xE3, 0x63, 0xEA, 0xC7, 0x60, 0x31, 0xC1, 0x14, 0x1F,
-    0x64, 0x1F, 0xB7, 0xDC, 0x6A, 0x49, 0x7D, 0xB0, 0x59, 0xE8, 0x38, 0xEB, 0xAA, 0x63, 0x0F, 0x92,
-    0xCE, 0xD8, 0x11, 0xB9, 0xBC, 0x4D, 0xCC, 0x79, 0x6B, 0x44, 0x01, 0x03, 0x35, 0x73, 0x44, 0xD2,
-    0x45, 0x4C, 0xB5, 0x52, 0x13, 0x58, 0x94, 0xF6, 0x68, 0xD2, 0xAC, 0xA5, 0x27, 0x25, 0x2D, 0x27,
-    0x0C, 0x33, 0xDB, 0x68, 0xBA, 0x1E, 0x43, 0xB7, 0xCB, 0x7F, 0x54, 0xB8, 0xE2, 0x0D, 0xB6, 0x93,
-    0xEC, 0x04, 0x54, 0x4B, 0x7D, 0x9F, 0xB0, 0x9A, 0xF6, 0x2F, 0x41, 0x5C, 0x18, 0x90, 0x1B, 0xE8,
-    0xD8, 0xAD, 0x1E, 0xD1, 0x63, 0xA1, 0x4E, 0x96, 0xE8, 0x5B, 0xE1, 0x43, 0x19, 0x32, 0x11, 0x17,
-    0x3D, 0x64, 0x13, 0x3A, 0xAE, 0xB1, 0xA1, 0xEA, 0x51, 0x70, 0x83, 0x99, 0x8C, 0x78, 0x48, 0x2A,
-    0x46, 0x99, 0x11, 0x8E, 0x43, 0xDF, 0xB5, 0x80, 0x24, 0xB2, 0x1B, 0x00, 0xA1, 0x0D, 0x46, 0xF7,
-    0x21, 0xE9, 0x21, 0x0D, 0x1F, 0x66, 0x76, 0xEE, 0x58, 0xF8, 0x62, 0x92, 0x84, 0x17, 0xE2, 0x17,
-    0x07, 0x0C, 0xE4, 0x75, 0xBC, 0x34, 0x67, 0x8F, 0xDA, 0xFF, 0xF8, 0x26, 0xE8, 0x87, 0x4B, 0xBD,
-    0x5F, 0xF3, 0xF8, 0xC9, 0x9F, 0xB0, 0xCD, 0xC9, 0xFF, 0xF0, 0x57, 0xB3, 0xE2, 0x5E, 0x18, 0x09,
-    0x2D, 0x9F, 0xE8, 0x19, 0x31, 0x41, 0x21, 0xC8, 0xF3, 0x6C, 0x88, 0x11, 0x6A, 0x1E, 0x2D, 0xD7,
-    0xD3, 0xE5, 0x3E, 0xC1, 0x40, 0xDB, 0xB8, 0x17, 0x46, 0xCF, 0x81, 0xBF, 0x73, 0x76, 0x0C, 0x0B,
-    0x85, 0x8B, 0x93, 0x30, 0x8B, 0xE2, 0x54, 0xBD, 0x5E, 0x33, 0x31, 0x9B, 0x93, 0xCE, 0xB7, 0x7F,
-    0xF2, 0xE2, 0x56, 0x66, 0x7D, 0x0A, 0xC7, 0xD0, 0x8B, 0x5B, 0xFD, 0x0D, 0xE3, 0x2E, 0x85, 0xBD,
-    0x35, 0xA9, 0x56, 0xB2, 0x0E, 0x00, 0x87, 0xE4, 0xA4, 0x8E, 0x1E, 0x1B, 0xB1, 0xBB, 0xB2, 0x93,
-    0xB7, 0x05, 0xB2, 0xB2, 0xDD, 0x4B, 0xBB, 0xFC, 0xD8, 0xC4, 0xC3, 0x7B, 0xF2, 0x8F, 0x48, 0x32,
-    0x80, 0xF7, 0xC7, 0x83, 0x83, 0xF7, 0xBE, 0x9D, 0xB6, 0x4B, 0x30, 0xAA, 0xBD, 0xC2, 0x71, 0x83,
-    0x48, 0xBF, 0x53, 0x2B, 0x00, 0x0C, 0xE5, 0x44, 0xFE, 0xD5, 0x5A, 0xD0, 0x82, 0x25, 0x86, 0xAA,
-    0xA7, 0x21, 0x11, 0x36, 0x1B, 0x93, 0xE1, 0x17, 0x9F, 0xE7, 0xAB, 0xCF, 0x26, 0x6D, 0x75, 0x5F,
-    0xD5, 0xEE, 0xAC, 0x9F, 0xC7, 0x4C, 0xCE, 0x79, 0x83, 0x23, 0x50, 0x20, 0x01, 0x06, 0xA2, 0x2D,
-    0xF0, 0x7E, 0x48, 0x1E, 0xFB, 0x76, 0x67, 0x65, 0xD3, 0x49, 0xB5, 0xCD, 0x1D, 0x8C, 0x27, 0xAA,
-    0xC5, 0x8A, 0xE0, 0xC8, 0x1B, 0x98, 0xA3, 0xD0, 0xFC, 0x25, 0x53, 0x85, 0xC6, 0xC6, 0x64, 0x27,
-    0xE3, 0xD9, 0x04, 0x86, 0x46, 0xDA, 0xDB, 0xE4, 0xF4, 0x30, 0xEF, 0xB7, 0x55, 0x98, 0xBE, 0xE1,
-    0x92, 0x0E, 0x0A, 0xA0, 0xEB, 0x0F, 0x35, 0x7B, 0x20, 0x24, 0xDE, 0xF9, 0xBC, 0xD6, 0x74, 0xA1,
-    0x55, 0x67, 0x1A, 0x91, 0xCF, 0xB8, 0x64, 0x7B, 0x29, 0xF9, 0x6A, 0x88, 0xD8, 0xD3, 0x3C, 0x42,
-    0x93, 0x14, 0x8F, 0x70, 0x00, 0x53, 0x8A, 0xE6, 0x74, 0x01, 0x57, 0xFB, 0xBC, 0x6D, 0x6A, 0xFD,
-    0xD2, 0xF2, 0x39, 0x7F, 0x1F, 0x6A, 0x73, 0xEC, 0xD2, 0x31, 0xEF, 0xFF, 0x7A, 0x6F, 0x33, 0xE5,
-    0xAD, 0x55, 0x77, 0xC6, 0x02, 0xCD, 0x36, 0x4E, 0x65, 0xE2, 0x6D, 0x6B, 0xF9, 0x2F, 0xFD, 0xC5,
-    0x70, 0x71, 0xEF, 0xA7, 0xB1, 0x29, 0x6F, 0x50, 0x40, 0x21, 0x50, 0x74, 0xC7, 0xAB, 0xF3, 0x74,
-    0x1D, 0x1A, 0x88, 0x64, 0xD6, 0xDD, 0x36, 0x8C, 0xB5, 0xF2, 0xF4, 0xF4, 0xF2, 0x9A, 0xC6, 0xAC,
-    0x0B, 0x21, 0xDF, 0x43, 0xED, 0xA2, 0x74, 0x85, 0xF9, 0x30, 0x9C, 0x1E, 0x86, 0xC7, 0x6A, 0xD3,
-    0x76, 0x07, 0x93, 0xE0, 0x75, 0x7C, 0x87, 0x68, 0x9E, 0x74, 0x61, 0xC0, 0x0D, 0x43, 0xD0, 0x1A,
-    0xEF, 0x88, 0x0D, 0xA6, 0xF3, 0x43, 0x64, 0xB1, 0xEB, 0x04, 0xCF, 0x35, 0xC4, 0x2C, 0x6F, 0xD1,
-    0x3D, 0x9D, 0xFA, 0xB9, 0x57, 0x67, 0x77, 0xC0, 0x41, 0x3F, 0x76, 0x73, 0x59, 0x48, 0x9C, 0xEF,
-    0x93, 0x21, 0x9D, 0xC2, 0x2D, 0x0A, 0x40, 0xD4, 0xA9, 0xAF, 0x6E, 0xB1, 0x47, 0x05, 0x5B, 0x5C,
-    0x39, 0xCF, 0x76, 0x9C, 0x4F, 0xFB, 0xD9, 0xCC, 0x69, 0x36, 0xB2, 0xA8, 0x4B, 0x99, 0x50, 0x8E,
-    0x10, 0x45, 0xF5, 0x3F, 0xE8, 0x76, 0x1F, 0xD9, 0xD8, 0x65, 0x50, 0x78, 0x5D, 0xEB, 0x3A, 0xCC,
-    0xC2, 0x81, 0x25, 0xF5, 0xF4, 0xDC, 0x94, 0xF8, 0x8F, 0x4C, 0xEE, 0xD0, 0xF8, 0x6C, 0xEA, 0x67,
-    0xDE, 0x66, 0xD4, 0xD2, 0xFB, 0x81, 0x58, 0x55, 0x0F, 0x18, 0xD1, 0xEE, 0x53, 0x19, 0x60, 0x05,
-    0x38, 0x52, 0x49, 0xF1, 0x1F, 0x39, 0x7A, 0xBA, 0xB6, 0x39, 0xBB, 0x9D, 0xC6, 0x73, 0x51, 0x36,
-    0xD9, 0x78, 0xE6, 0xF3, 0xC1, 0x2D, 0x56, 0x8D, 0x20, 0x0A, 0x34, 0xA6, 0x99, 0x71, 0x99, 0x02,
-    0xD2, 0xBC, 0x5D, 0x03, 0x04, 0x89, 0x1D, 0x70, 0xDA, 0xFC, 0xDC, 0xF1, 0xF8, 0xEB, 0xBA, 0xCC,
-    0x39, 0xD7, 0x23, 0x11, 0x4F, 0x03, 0x5A, 0xE8, 0x1D, 0xE8, 0x18, 0xF6, 0x25, 0x39, 0xAB, 0xE0,
-    0x56, 0x7E, 0x64, 0x93, 0xAF, 0x7D, 0xBD, 0xFA, 0x08, 0x34, 0x1E, 0x8B, 0xF6, 0x30, 0xEF, 0xEE,
-    0x27, 0x2B, 0x8B, 0xC6, 0x48, 0x96, 0xF7, 0x45, 0x7F, 0xAF, 0xCD, 0x8F, 0xDC, 0x0D, 0xA3, 0xFF,
-    0x32, 0xCE, 0xA3, 0x92, 0x3C, 0x95, 0x39, 0xC5, 0x11, 0x8D, 0x63, 0xC9, 0x88, 0x71, 0x84, 0xF7,
-    0x0D, 0x91, 0x17, 0xBC, 0x73, 0xA8, 0x5A, 0x40, 0xF0, 0xCF, 0x48, 0x88, 0x51, 0x07, 0xDF, 0x23,
-    0xD9, 0x8E, 0xFC, 0x8D, 0x51, 0xF5, 0xFA, 0x2B, 0x8C, 0x5D, 0xA2, 0x97, 0x6E, 0x65, 0x12, 0x9F,
-    0x8F, 0x95, 0xE8, 0x07, 0x1E, 0xD5, 0x66, 0x2C, 0x30, 0x19, 0xA3, 0x77, 0x80, 0x6C, 0xF5, 0xFA,
-    0x05, 0x0C, 0xBC, 0x29, 0xA7, 0xE5, 0x16, 0x65, 0x11, 0x09, 0xD2, 0x6B, 0x5B, 0xD4, 0x00, 0xF3,
-    0x2E, 0x72, 0x52, 0x6F, 0xA0, 0xDC, 0x06, 0x80, 0x9D, 0x4F, 0xFC, 0x3B, 0x4E, 0xDC, 0x0A, 0xFD,
-    0x21, 0xC6, 0xEE, 0x41, 0x97, 0x55, 0x8D, 0xC9, 0x23, 0x85, 0x11, 0x08, 0x46, 0x89, 0x09, 0x3A,
-    0xFD, 0xF2, 0x86, 0x51, 0x88, 0x40, 0x33, 0x4C, 0xE2, 0xCE, 0x6E, 0x20, 0x64, 0xBC, 0xD5, 0x62,
-    0xD4, 0x23, 0x87, 0xF3, 0x3E, 0x32, 0xD9, 0x63, 0x38, 0x84, 0x9F, 0x75, 0xA9, 0x6F, 0x76, 0xEA,
-    0x18, 0x6D, 0x9C, 0xBF, 0x69, 0x94, 0xEF, 0xA3, 0x75, 0xDB, 0xB3, 0x25, 0x68, 0xD3, 0xB2, 0x31,
-    0xF5, 0xB7, 0x50, 0x05, 0x97, 0x08, 0x58, 0xCF, 0x2E, 0x84, 0x05, 0x03, 0x26, 0x03, 0x3C, 0x24,
-    0x2F, 0x06, 0x2D, 0xB0, 0x2E, 0x33, 0xB1, 0xBB, 0xD5, 0xA1, 0xF5, 0x2F, 0x81, 0x5A, 0x80, 0x7F,
-    0x9E, 0x4E, 0xE7, 0xCA, 0x56, 0x21, 0x62, 0xAF, 0x1E, 0xCC, 0x92, 0x92, 0xB8, 0x3D, 0x90, 0xB5,
-    0xD3, 0x6F, 0xE2, 0x9A, 0xE2, 0x0E, 0x2E, 0x46, 0x2A, 0x26, 0x43, 0x86, 0xD2, 0xE2, 0x30, 0xAC,
-    0xF7, 0xD5, 0x4B, 0x53, 0xE2, 0x56, 0xAD, 0xB6, 0x36, 0x72, 0x0C, 0x2B, 0x1B, 0x85, 0x3A, 0x84,
-    0xAA, 0xE2, 0x2D, 0x51, 0x79, 0xF2, 0x60, 0x5F, 0xB6, 0xB7, 0xA0, 0x1F, 0xC7, 0xFE, 0x1D, 0x93,
-    0x7D, 0x66, 0xE3, 0xD5, 0x8F, 0x59, 0x81, 0x50, 0x7F, 0x40, 0x95, 0xCC, 0x04, 0x02, 0x4C, 0x73,
-    0x50, 0xDB, 0x39, 0x6D, 0x98, 0xC7, 0x28, 0xE5, 0x53, 0x32, 0xDC, 0xA6, 0x86, 0xB2, 0x27, 0xAD,
-    0x83, 0x3E, 0x0D, 0xDF, 0x48, 0xC6, 0x22, 0x1E, 0xF5, 0xAF, 0x8D, 0xE6, 0x24, 0x36, 0xF7, 0x1D,
-    0xDC, 0x11, 0xB4, 0xD1, 0xEC, 0x1C, 0xBC, 0x7F, 0x50, 0xFD, 0xE7, 0x7C, 0x17, 0x11, 0x8B, 0x35,
-    0x5C, 0x1B, 0x3F, 0x55, 0xE9, 0x1D, 0x16, 0x7C, 0x93, 0x4D, 0xE7, 0x9A, 0xA3, 0x3E, 0xF2, 0x10,
-    0x3F, 0x6C, 0x01, 0x6D, 0x01, 0x01, 0x2A, 0x59, 0x92, 0x13, 0x64, 0x03, 0x92, 0x24, 0x05, 0x45,
-    0xAA, 0x2F, 0xDF, 0x5A, 0x7D, 0xEC, 0x41, 0x0A, 0x53, 0xB5, 0xCB, 0x75, 0x18, 0xB7, 0xB2, 0x41,
-    0x7D, 0xEA, 0x93, 0xF1, 0x56, 0xEB, 0x80, 0x42, 0x0D, 0x95, 0x29, 0xEE, 0x9A, 0xEC, 0xD1, 0x10,
-    0x8D, 0xA3, 0xEC, 0x1D, 0x52, 0xFF, 0x59, 0xAB, 0xF0, 0xDC, 0xD9, 0x5C, 0x20, 0x25, 0xE4, 0x4B,
-    0x3D, 0x74, 0xD0, 0xCA, 0x37, 0x6C, 0xDE, 0x2D, 0xD1, 0x7F, 0x5F, 0xC7, 0x2E, 0x2E, 0x6B, 0x8B,
-    0x37, 0xED, 0x8E, 0xEC, 0x15, 0x5F, 0x0E, 0x32, 0xFA, 0x8F, 0xDB, 0xE4, 0x8B, 0x0F, 0x76, 0x25,
-    0xB7, 0x70, 0x52, 0xFF, 0x12, 0x7E, 0x4D, 0xC4, 0xA5, 0x57, 0xE7, 0xD5, 0x7D, 0x9B, 0xA3, 0x74,
-    0xE6, 0xB3, 0xE9, 0x52, 0x75, 0xF3, 0xA7, 0xA2, 0x99, 0x67, 0xEB, 0xBB, 0x61, 0x61, 0xA0, 0x61,
-    0xDD, 0xE0, 0xDD, 0x4F, 0xC4, 0x7C, 0xF0, 0xEF, 0xE9, 0x1E, 0x53, 0x5E, 0x7D, 0x46, 0xBE, 0x2D,
-    0xCC, 0x6A, 0x0A, 0x70, 0x25, 0x1C, 0x6B, 0x30, 0x02, 0xC0, 0x72, 0x99, 0x00, 0x0B, 0x6C, 0x97,
-    0xF4, 0xD1, 0x00, 0xFC, 0xD0, 0xD8, 0xE8, 0x6B, 0x58, 0xE6, 0x84, 0x82, 0x38, 0xDF, 0xEB, 0x9A,
-    0x5B, 0xE0, 0x36, 0x64, 0xEA, 0xF3, 0x8A, 0xF7, 0xD1, 0xDA, 0xF9, 0x4E, 0xE1, 0x8C, 0x45, 0x24,
-    0xC5, 0x60, 0xD9, 0xBC, 0x2E, 0x01, 0x6B, 0x3D, 0xC9, 0xBF, 0x23, 0x85, 0x51, 0x1D, 0x79, 0x8B,
-    0x92, 0x0D, 0x4C, 0x59, 0x67, 0xBD, 0x8A, 0xFD, 0x0A, 0x71, 0xF2, 0xC9, 0x23, 0x3F, 0x0F, 0x41,
-    0x08, 0x0A, 0xA2, 0x76, 0x8A, 0x48, 0x45, 0xF3, 0x9D, 0xD8, 0x52, 0x0E, 0x29, 0xF9, 0x79, 0x8B,
-    0x41, 0x8D, 0x11, 0xAC, 0xE7, 0x5A, 0xCB, 0x1B, 0xDB, 0xE1, 0xBD, 0xE3, 0xFB, 0x61, 0x28, 0xC6,
-    0x5E, 0x36, 0xED, 0xAA, 0x64, 0x6C, 0x7B, 0x2C, 0x20, 0x56, 0x65, 0xF8, 0x08, 0xE8, 0xCF, 0x3F,
-    0xEE, 0x62, 0xD5, 0xF3, 0x8F, 0xEB, 0x16, 0xA9, 0xA8, 0xA1, 0x1F, 0x4F, 0x34, 0x61, 0x2D, 0x43,
-    0x65, 0xDA, 0x3D, 0x7B, 0xE7, 0xFC, 0x62, 0x24, 0xDC, 0x08, 0x48, 0x37, 0xDB, 0x9A, 0xF9, 0xDE,
-    0x30, 0x68, 0x85, 0xAE, 0xD3, 0xC9, 0x8C, 0x63, 0xBC, 0x1F, 0xA5, 0xFE, 0xFA, 0x6F, 0xBC, 0x1B,
-    0x87, 0xCA, 0x7E, 0x0B, 0x12, 0xFC, 0xBF, 0xBD, 0x59, 0x3D, 0x8C, 0x15, 0xD7, 0x15, 0x3E, 0x33,
-    0x97, 0x65, 0x1C, 0x46, 0xE6, 0x6E, 0x01, 0x92, 0x63, 0xD9, 0x19, 0x17, 0x28, 0x72, 0xA2, 0x78,
-    0xC7, 0x85, 0x0B, 0x12, 0xB1, 0x7B, 0x07, 0x28, 0x56, 0x0A, 0x4A, 0xD8, 0x82, 0x57, 0x3B, 0x92,
-    0x5D, 0x58, 0xB6, 0x22, 0x37, 0x5B, 0x50, 0xC0, 0xCE, 0x60, 0x0A, 0x2C, 0x59, 0x0A, 0xDB, 0xB8,
-    0x4E, 0x24, 0x27, 0x92, 0x8D, 0x0B, 0x53, 0x50, 0xA0, 0x64, 0xF7, 0xCD, 0x85, 0x2D, 0x28, 0xB6,
-    0x60, 0x30, 0x72, 0x5C, 0xA4, 0x60, 0x6C, 0x6C, 0x21, 0xC5, 0xC5, 0x5E, 0x9B, 0xB1, 0x18, 0x60,
-    0x66, 0x6E, 0xBE, 0x73, 0x67, 0xDE, 0x5B, 0x70, 0x17, 0xA3, 0xF5, 0xF3, 0xFA, 0xF1, 0xDE, 0xDD,
-    0xB9, 0xE7, 0xEF, 0x7E, 0xE7, 0x3B, 0xE7, 0xDC, 0x25, 0x22, 0xA9, 0x43, 0xE3, 0x37, 0xB4, 0x8F,
-    0x88, 0x84, 0xF6, 0x0C, 0xAD, 0xD1, 0x02, 0xC9, 0x2C, 0x28, 0xFC, 0x8A, 0x1A, 0x4A, 0x29, 0xD6,
-    0xB2, 0x0C, 0x2A, 0x3C, 0x70, 0x99, 0xDC, 0x2B, 0xD0, 0xC4, 0x1F, 0xC3, 0x84, 0xC8, 0x10, 0x45,
-    0x09, 0xC5, 0x36, 0x89, 0x6C, 0x13, 0x3E, 0xFC, 0x4F, 0xD6, 0x1E, 0xA2, 0xF8, 0x6C, 0x26, 0xCC,
-    0x32, 0xA5, 0x21, 0x05, 0xC6, 0x50, 0xBA, 0x97, 0xC4, 0xF7, 0xE5, 0x45, 0xD5, 0xE5, 0x64, 0x6D,
-    0x26, 0xEC, 0x2A, 0x05, 0x99, 0xDB, 0x2D, 0x87, 0xDD, 0x44, 0xDE, 0xAA, 0x93, 0x8A, 0xEF, 0x81,
-    0x4D, 0x28, 0xB4, 0x86, 0x82, 0xB2, 0x25, 0x61, 0xA2, 0xC4, 0xAF, 0x83, 0x04, 0x16, 0x10, 0x6C,
-    0x20, 0xEF, 0xED, 0xCF, 0x12, 0x88, 0x30, 0xF4, 0xF6, 0x83, 0xBF, 0x93, 0xC7, 0x8B, 0x63, 0xFC,
-    0xAF, 0x88, 0xAD, 0x27, 0xB2, 0x0F, 0x3E, 0x36, 0xA9, 0xB5, 0x75, 0xF4, 0x45, 0xDE, 0x78, 0x49,
-    0x6F, 0x26, 0x85, 0x94, 0x1C, 0x94, 0xB7, 0xBA, 0x46, 0x58, 0x5B, 0x7A, 0x75, 0x94, 0x89, 0x52,
-    0x6A, 0x51, 0xC0, 0x31, 0x1D, 0x25, 0xA2, 0x54, 0x14, 0x59, 0x4B, 0x63, 0x6B, 0x8B, 0xE5, 0xFD,
-    0xBE, 0x1E, 0xB6, 0xC0, 0x95, 0x6B, 0xF6, 0x96, 0xBD, 0x61, 0xCB, 0x34, 0x8B, 0xE0, 0xB6, 0x2C,
-    0xFC, 0x26, 0x2C, 0x48, 0x2D, 0x96, 0x24, 0x6F, 0x1B, 0x52, 0x9D, 0xD5, 0x7B, 0x72, 0x5B, 0x50,
-    0x58, 0x43, 0xA7, 0x6D, 0xF0, 0x78, 0x07, 0x23, 0xE0, 0x91, 0x2C, 0x60, 0x7E, 0x05, 0x7F, 0xAC,
-    0x26, 0x09, 0x2B, 0x9D, 0x7E, 0x2D, 0x0C, 0xCC, 0x5F, 0x40, 0x88, 0xDC, 0xC7, 0x9A, 0x7E, 0x45,
-    0xD3, 0xD7, 0x3C, 0xC5, 0x93, 0xD5, 0xD3, 0x14, 0xC3, 0x09, 0xD1, 0x6F, 0xF2, 0x6D, 0x16, 0xD8,
-    0x2A, 0x28, 0xD7, 0x85, 0x91, 0x3E, 0x84, 0xDF, 0x29, 0xE8, 0xE0, 0x98, 0x64, 0x68, 0x44, 0x99,
-    0xD2, 0x4A, 0x50, 0x86, 0xE5, 0x29, 0xCA, 0x25, 0x85, 0x77, 0x35, 0x9D, 0x36, 0x07, 0xC2, 0x7A,
-    0xC1, 0x6B, 0x64, 0xB1, 0x2E, 0x6C, 0x4B, 0x71, 0x3D, 0xF1, 0xFB, 0xEA, 0x9D, 0xEF, 0xDA, 0x7A,
-    0x9D, 0x76, 0x21, 0x6A, 0x1F, 0xE1, 0x3B, 0x1B, 0x8C, 0x60, 0x96, 0x88, 0xB7, 0x57, 0x4A, 0xBA,
-    0x70, 0xB8, 0x58, 0x8E, 0xAC, 0xBF, 0xA1, 0xAB, 0x43, 0xC1, 0x1F, 0x43, 0xBD, 0xBA, 0xF7, 0x95,
-    0x05, 0xA2, 0x83, 0x05, 0x76, 0xDF, 0x3D, 0x5A, 0x92, 0xF8, 0x4B, 0xA8, 0x69, 0xEF, 0x6F, 0xA2,
-    0xFF, 0xEA, 0xE5, 0xE5, 0xA8, 0x13, 0xDA, 0xCC, 0x24, 0x2F, 0x61, 0x23, 0x76, 0xDF, 0x87, 0xA1,
-    0x94, 0x5A, 0x38, 0x3B, 0xB3, 0x04, 0xA9, 0xFF, 0x58, 0x4D, 0x1B, 0xF9, 0xDE, 0xD5, 0xF2, 0xD2,
-    0x21, 0x29, 0xAE, 0x9A, 0xD3, 0xE3, 0xD7, 0xBA, 0x2E, 0x3A, 0x8E, 0x5F, 0xFE, 0xFA, 0x93, 0x4D,
-    0x5B, 0x4D, 0xBC, 0xBC, 0x1C, 0x20, 0x88, 0xB9, 0xD7, 0xCA, 0x32, 0x2A, 0x3A, 0xEA, 0xE0, 0x45,
-    0x13, 0x6B, 0x51, 0xA9, 0x2C, 0x30, 0x2A, 0x11, 0xC5, 0x82, 0x7B, 0xE8, 0xCD, 0x0B, 0x1F, 0xE6,
-    0xB6, 0xC5, 0x0F, 0xB1, 0x86, 0xFE, 0x67, 0x5F, 0xDE, 0xDA, 0x0E, 0x2B, 0x33, 0x70, 0x07, 0x11,
-    0xC9, 0x22, 0xFA, 0x6C, 0xE9, 0xE0, 0x8B, 0xE3, 0x62, 0xE3, 0xE8, 0xF9, 0xBD, 0x2F, 0xFF, 0xB6,
-    0xF8, 0x40, 0xD4, 0xE1, 0xCB, 0xBF, 0x2B, 0x3E, 0x38, 0x77, 0xEB, 0x0F, 0xCF, 0x9D, 0xF8, 0xA5,
-    0xBE, 0x48, 0xCB, 0xFE, 0xD7, 0xEB, 0xEC, 0xAD, 0xB2, 0xAF, 0xDA, 0x1B, 0xA3, 0x25, 0x5A, 0x22,
-    0x5B, 0x2A, 0x7B, 0xAC, 0x68, 0x9A, 0xF0, 0x7A, 0xB6, 0xB6, 0x2E, 0xAF, 0xD9, 0x2A, 0x6A, 0x69,
-    0x3F, 0xD1, 0x1B, 0x04, 0x78, 0xF7, 0x3F, 0xA3, 0xF5, 0x13, 0x83, 0xDE, 0xB5, 0xED, 0x45, 0x64,
-    0xC1, 0xFE, 0xD1, 0x64, 0x1D, 0xAF, 0x9F, 0x43, 0x7F, 0x32, 0x4E, 0x45, 0xB1, 0xE6, 0xE1, 0x84,
-    0x62, 0xE0, 0x12, 0xA0, 0x0B, 0x4A, 0x1A, 0x8F, 0x10, 0xF3, 0x3D, 0x17, 0x56, 0xE9, 0x75, 0xCF,
-    0x16, 0xF7, 0xEB, 0x57, 0xE6, 0x00, 0xE5, 0x3C, 0xC9, 0x4B, 0x88, 0x88, 0x29, 0x3E, 0x6F, 0xDF,
-    0xE9, 0x7A, 0x18, 0xBE, 0x22, 0xAF, 0x36, 0x2A, 0xD4, 0x7F, 0xEA, 0xE3, 0xA1, 0x92, 0x8E, 0x22,
-    0xAD, 0x28, 0x34, 0x91, 0xF6, 0xEB, 0xB0, 0xA4, 0xD6, 0xAF, 0x21, 0xAF, 0xC5, 0xF9, 0x43, 0x2A,
-    0x2F, 0x36, 0xD2, 0x50, 0x1E, 0x36, 0xB3, 0xCA, 0x6E, 0xAD, 0x49, 0xFB, 0x79, 0x17, 0x6C, 0x15,
-    0x9D, 0xCF, 0xD0, 0x68, 0x06, 0xB8, 0x47, 0xC0, 0x2A, 0x36, 0xF2, 0x89, 0xF0, 0x6B, 0x66, 0xE4,
-    0x0E, 0xD8, 0xB7, 0x5B, 0xAB, 0xBE, 0x05, 0x28, 0x6C, 0x8D, 0xFD, 0xDD, 0x49, 0x04, 0xE2, 0xCF,
-    0x00, 0xE2, 0x66, 0x22, 0x26, 0x8B, 0x51, 0x7B, 0x92, 0xBC, 0xAD, 0x39, 0xA4, 0xF8, 0x26, 0x2C,
-    0xC3, 0x22, 0x9D, 0x84, 0xD8, 0x97, 0x4E, 0x02, 0xBB, 0x2F, 0x61, 0xF1, 0x3A, 0x43, 0x2F, 0xF1,
-    0xFE, 0x8D, 0x14, 0x4C, 0xB1, 0xBE, 0xDB, 0x25, 0x65, 0x70, 0xBB, 0xE9, 0xE6, 0x28, 0x3C, 0xD3,
-    0x0A, 0x7D, 0x79, 0x65, 0x77, 0x42, 0xFB, 0x76, 0xB7, 0xB2, 0x81, 0x25, 0xB5, 0x57, 0xF9, 0xC6,
-    0x07, 0x24, 0x83, 0x52, 0x35, 0x6F, 0x7E, 0x48, 0x6F, 0x52, 0xDC, 0x84, 0x1B, 0x37, 0xAA, 0x85,
-    0x58, 0x7C, 0x5A, 0x9E, 0x9A, 0x93, 0x67, 0xAC, 0xE1, 0x64, 0x00, 0x16, 0x8E, 0xD9, 0x72, 0x80,
-    0x42, 0x04, 0x14, 0xA5, 0xA2, 0xA2, 0x3C, 0x30, 0x64, 0x25, 0xF8, 0x26, 0xD2, 0xC0, 0x84, 0x83,
-    0x86, 0x6E, 0xA9, 0x0E, 0x35, 0xFD, 0xE0, 0x75, 0x89, 0xBC, 0xD6, 0x65, 0x37, 0x52, 0x0A, 0x51,
-    0x9F, 0x41, 0x00, 0xD6, 0xF1, 0x3D, 0xE3, 0x1F, 0xAF, 0xE2, 0x25, 0x66, 0x0F, 0x9C, 0x18, 0xC2,
-    0x13, 0x25, 0x32, 0x53, 0x24, 0x4A, 0x51, 0x0B, 0x3E, 0x01, 0x7B, 0xC4, 0xEA, 0x88, 0xE6, 0x4D,
-    0xDA, 0x20, 0xDF, 0x5F, 0x85, 0xAC, 0x1A, 0x76, 0x21, 0xB9, 0xA9, 0x06, 0xE2, 0xC2, 0x22, 0x46,
-    0xE6, 0x7A, 0xB5, 0x07, 0x42, 0xE2, 0x88, 0x42, 0x33, 0x67, 0x6F, 0x4D, 0x03, 0xBF, 0x79, 0x3F,
-    0xB0, 0x03, 0x3C, 0x17, 0x15, 0x38, 0x1C, 0x52, 0x66, 0xB0, 0x03, 0xBC, 0x88, 0xAC, 0xF6, 0x6A,
-    0x47, 0x7E, 0xB5, 0x23, 0xC4, 0xDE, 0x8C, 0x53, 0x41, 0x87, 0xE8, 0xCC, 0x87, 0xB6, 0x5C, 0xA0,
-    0x05, 0x51, 0x34, 0xB9, 0x89, 0x69, 0x75, 0x21, 0x6D, 0x98, 0x23, 0x9D, 0xE9, 0x71, 0xC2, 0x0E,
-    0xF5, 0x4A, 0x57, 0x88, 0x71, 0x04, 0xAC, 0x43, 0x68, 0x6A, 0x39, 0xFF, 0x23, 0x04, 0xEB, 0x92,
-    0xD3, 0xB9, 0xEB, 0x51, 0x03, 0xD8, 0x20, 0xA8, 0xB6, 0x50, 0x97, 0x51, 0x57, 0xF3, 0xF3, 0x7B,
-    0xC3, 0xCC, 0x01, 0xA2, 0x62, 0x89, 0xDE, 0x3A, 0x3C, 0x07, 0x0A, 0x0A, 0x5E, 0x9A, 0x89, 0x99,
-    0x4D, 0x32, 0xCF, 0x88, 0x42, 0xD4, 0x20, 0xCE, 0x9A, 0xEC, 0xEF, 0x73, 0x3D, 0x87, 0x60, 0xD8,
-    0x32, 0xD4, 0x1C, 0x0C, 0xAF, 0x72, 0xC1, 0x58, 0x70, 0xC1, 0x90, 0x9A, 0x83, 0xE1, 0x57, 0x2E,
-    0x18, 0x2B, 0x7D, 0x30, 0xB4, 0x0B, 0x46, 0xF5, 0x78, 0x30, 0x1E, 0xA9, 0x11, 0x51, 0x21, 0x1B,
-    0x2F, 0x85, 0xEF, 0xB1, 0xFB, 0x8F, 0xD9, 0xCD, 0xAF, 0x0E, 0xE4, 0x9D, 0xB4, 0x99, 0xCD, 0xA6,
-    0x1B, 0x9E, 0x77, 0x74, 0x9A, 0xF1, 0x1B, 0xC3, 0x37, 0x60, 0x73, 0xE9, 0xC5, 0xA9, 0x53, 0x6F,
-    0x30, 0xD7, 0x35, 0x93, 0x5F, 0x48, 0xCE, 0xB5, 0x98, 0xDF, 0x16, 0x98, 0xD6, 0x1B, 0x26, 0xFC,
-    0x2A, 0xE5, 0xD0, 0x70, 0xAC, 0x0A, 0xC5, 0x61, 0x03, 0xCD, 0xC6, 0x16, 0x58, 0x48, 0xF9, 0x0D,
-    0x74, 0x87, 0x04, 0x82, 0x29, 0x1C, 0xB6, 0x12, 0x3B, 0x6D, 0x9B, 0x76, 0x7E, 0x9F, 0xB2, 0xFC,
-    0x12, 0x4E, 0x31, 0x63, 0x8A, 0x09, 0x4B, 0xF0, 0xBA, 0x9F, 0xFC, 0x54, 0xCA, 0xD7, 0x1C, 0x8F,
-    0x33, 0x74, 0xB6, 0x60, 0x81, 0x5A, 0x04, 0xBA, 0x4E, 0x7A, 0xD9, 0x8E, 0x2B, 0xF7, 0x13, 0x78,
-    0x18, 0x7D, 0x09, 0x6D, 0x0A, 0xCF, 0xD1, 0xA1, 0x34, 0x79, 0x0C, 0x49, 0x3B, 0xEB, 0x74, 0xB4,
-    0xC8, 0xAE, 0x1E, 0x67, 0xE5, 0x0C, 0xA0, 0x7D, 0x33, 0x3F, 0x81, 0xDE, 0xD7, 0xF9, 0xA0, 0x39,
-    0xCE, 0xF2, 0x38, 0x5C, 0x95, 0xDC, 0x90, 0xB8, 0x6C, 0x0F, 0x9C, 0x51, 0x4B, 0x3B, 0xAA, 0xDC,
-    0x1B, 0x8D, 0x46, 0x09, 0x47, 0xDA, 0x59, 0xE2, 0x1E, 0x46, 0xFF, 0xC2, 0x47, 0xEF, 0xDD, 0x33,
-    0xDC, 0xE3, 0x2C, 0xAC, 0x10, 0x48, 0x5F, 0x6E, 0x16, 0x6C, 0x81, 0x71, 0xE8, 0x5F, 0x97, 0x5C,
-    0x19, 0xA3, 0x77, 0xD0, 0x77, 0xB0, 0xCA, 0xF7, 0x97, 0xB8, 0x89, 0xE0, 0x3C, 0x83, 0x14, 0x1C,
-    0x54, 0x58, 0x06, 0xC8, 0x5A, 0xF4, 0x36, 0x63, 0xB0, 0x42, 0x4A, 0xF2, 0xEB, 0x57, 0x75, 0x5C,
-    0x4B, 0x74, 0x35, 0xA1, 0xBD, 0x62, 0x2D, 0x88, 0x99, 0xDE, 0xFA, 0x1B, 0x70, 0x05, 0xAA, 0x40,
-    0x1F, 0x24, 0xC0, 0x34, 0x80, 0xF5, 0x82, 0x8F, 0xDA, 0x41, 0x1C, 0x03, 0x3E, 0x6D, 0x05, 0x23,
-    0x50, 0x3F, 0x48, 0xB0, 0x3A, 0x5E, 0x74, 0x0B, 0x35, 0x3D, 0x8D, 0xAE, 0x22, 0xCA, 0xA0, 0x45,
-    0x07, 0xE8, 0x77, 0xE0, 0xDF, 0x00, 0xC6, 0x39, 0x8E, 0x09, 0x13, 0x34, 0xB7, 0x0E, 0xA7, 0xC8,
-    0x11, 0x2C, 0x1D, 0x98, 0x9E, 0xDC, 0xC1, 0xA1, 0xDC, 0xB8, 0xF4, 0x89, 0xD9, 0x91, 0xBE, 0x8C,
-    0xC1, 0xF7, 0x13, 0x1E, 0x5B, 0x84, 0x40, 0xA1, 0x41, 0x42, 0xC7, 0x68, 0xB1, 0x5B, 0x65, 0xCF,
-    0x33, 0x51, 0xA2, 0xB6, 0x31, 0xFA, 0xA1, 0x82, 0x55, 0xB1, 0x93, 0xC3, 0x62, 0x02, 0xAB, 0x2E,
-    0x51, 0x87, 0xCE, 0x27, 0x7D, 0x3F, 0xE5, 0xED, 0x3A, 0xE7, 0x27, 0xA6, 0xCD, 0x5A, 0xAF, 0x8B,
-    0xC9, 0x42, 0xC1, 0xA4, 0x3D, 0xC9, 0x4E, 0xA9, 0x42, 0xED, 0x20, 0x0F, 0xD1, 0xF4, 0x1E, 0xA2,
-    0xAD, 0x61, 0x0E, 0xBC, 0x24, 0x92, 0x1D, 0x52, 0xB5, 0xC0, 0x94, 0xBF, 0x69, 0x28, 0xBC, 0x09,
-    0x9D, 0xC9, 0xEC, 0x50, 0xB0, 0x47, 0x4B, 0x01, 0xA3, 0x06, 0xCF, 0x25, 0xA1, 0x09, 0xB4, 0x60,
-    0x55, 0x1D, 0x2D, 0xBB, 0x13, 0x64, 0xCA, 0x0A, 0xD1, 0x54, 0x0A, 0x3E, 0xEF, 0x0E, 0x08, 0xEB,
-    0x17, 0x3D, 0x1C, 0xAB, 0xCF, 0x84, 0x5E, 0x79, 0xDD, 0xA8, 0xC1, 0x76, 0xEB, 0xF7, 0x88, 0x70,
-    0x87, 0x04, 0x2C, 0xA7, 0xDA, 0x59, 0xE8, 0xCE, 0x67, 0x34, 0xF2, 0x20, 0x21, 0xAF, 0x59, 0x18,
-    0x00, 0x00, 0x40, 0xE3, 0x07, 0x72, 0x72, 0x87, 0x89, 0x8E, 0xCB, 0x2A, 0x50, 0x83, 0xAC, 0x80,
-    0xE9, 0x01, 0x6A, 0x84, 0x4D, 0xF2, 0x5E, 0x14, 0xF9, 0x19, 0xD7, 0x39, 0x94, 0x78, 0x59, 0x0D,
-    0x74, 0xE9, 0x71, 0x4C, 0x3A, 0x8A, 0x3B, 0x97, 0x45, 0xD6, 0x35, 0xBB, 0x40, 0x0C, 0xAA, 0xFB,
-    0xF6, 0x77, 0x44, 0x22, 0x9C, 0x7E, 0x4F, 0x33, 0xCF, 0xF9, 0x36, 0x90, 0x2D, 0x00, 0x95, 0x6B,
-    0x1A, 0x37, 0xC0, 0x7E, 0x32, 0xEF, 0x38, 0xF0, 0x09, 0x25, 0x46, 0x8B, 0x85, 0xBC, 0x5D, 0x0B,
-    0x24, 0xD4, 0xEC, 0xAE, 0x3E, 0x9C, 0x88, 0x66, 0xCD, 0xDE, 0xC2, 0x7F, 0xC6, 0x7D, 0x37, 0x95,
-    0x30, 0xFD, 0x0E, 0xDF, 0xE3, 0xC9, 0x77, 0xAF, 0x43, 0x9A, 0x56, 0x2E, 0x85, 0x9F, 0xFD, 0xE7,
-    0x2A, 0x62, 0x8D, 0x04, 0xE4, 0xC9, 0x81, 0x8E, 0x99, 0xB8, 0x42, 0xB8, 0x62, 0x3E, 0x0B, 0xA5,
-    0x61, 0x4E, 0x9E, 0x20, 0xEE, 0xDD, 0xB3, 0xF6, 0xC3, 0xA0, 0xCA, 0xAD, 0x89, 0x8B, 0xA8, 0x44,
-    0x04, 0x53, 0x9C, 0x37, 0xEC, 0x42, 0x09, 0x64, 0x78, 0xA8, 0x2C, 0x32, 0x9E, 0x7D, 0xCB, 0x26,
-    0x90, 0x50, 0xE2, 0x44, 0xBE, 0x9A, 0xA6, 0xCE, 0x6E, 0xE6, 0x62, 0x1F, 0xE3, 0xD0, 0x40, 0xC6,
-    0xE2, 0x98, 0x79, 0xAC, 0xA9, 0x18, 0x25, 0xDE, 0x28, 0x89, 0x70, 0x4A, 0xF0, 0xCC, 0xEC, 0xB6,
-    0x09, 0x7A, 0x2F, 0x6E, 0x0C, 0xB8, 0xB9, 0x12, 0xB6, 0x40, 0x9D, 0x4F, 0x3B, 0xE0, 0x34, 0xB8,
-    0x85, 0x06, 0x82, 0xD6, 0xD2, 0xB3, 0x38, 0x94, 0x8D, 0x06, 0x1C, 0xD5, 0x44, 0x77, 0x4A, 0x74,
-    0x01, 0x76, 0x1D, 0x25, 0x3B, 0xB4, 0xDC, 0x49, 0x60, 0x8B, 0x30, 0x48, 0x6F, 0x26, 0x8C, 0x9A,
-    0xB9, 0x0D, 0xA0, 0xB2, 0x45, 0xE0, 0xB4, 0xCD, 0x4E, 0xB4, 0xED, 0xE5, 0xB3, 0xE5, 0x1C, 0x8F,
-    0xCC, 0xA4, 0x2C, 0x3E, 0x33, 0x31, 0x14, 0x13, 0x82, 0x44, 0x34, 0x80, 0x29, 0x34, 0x01, 0x87,
-    0xAD, 0x4E, 0xB5, 0x68, 0x71, 0xFC, 0xF1, 0x17, 0x96, 0xFC, 0x0E, 0x61, 0x8B, 0x6F, 0xA3, 0x3F,
-    0xE8, 0x80, 0x23, 0xFE, 0x20, 0x5A, 0x06, 0xD4, 0x46, 0x83, 0x01, 0x48, 0x15, 0x1E, 0x40, 0x48,
-    0x69, 0x21, 0xBB, 0x9C, 0x43, 0x88, 0x80, 0xE6, 0xED, 0x63, 0x3E, 0x02, 0x4D, 0xFD, 0xA4, 0xC6,
-    0x01, 0x50, 0xC5, 0x23, 0x15, 0x78, 0x07, 0x95, 0xAE, 0x0F, 0x0D, 0x07, 0x97, 0x5E, 0xBF, 0x9A,
-    0xC7, 0xA0, 0x35, 0xA9, 0xBC, 0x3B, 0xA3, 0xF4, 0x00, 0x50, 0x18, 0x7D, 0x57, 0xE0, 0xD4, 0xE0,
-    0xE9, 0x21, 0x95, 0xF4, 0x93, 0x6C, 0x3F, 0xD7, 0xAC, 0x92, 0x63, 0x0B, 0x80, 0x23, 0x89, 0xAA,
-    0xA8, 0x41, 0x09, 0x52, 0x05, 0x8E, 0xBA, 0xC3, 0x29, 0xC4, 0x5F, 0xB6, 0xDB, 0xBA, 0xDC, 0x07,
-    0x75, 0x93, 0x13, 0x12, 0x1F, 0xF2, 0xB3, 0x2D, 0xCE, 0x29, 0x36, 0xA8, 0x62, 0xF6, 0x1B, 0x9B,
-    0x38, 0xC6, 0x0E, 0xB7, 0x89, 0x72, 0x48, 0x02, 0x12, 0x75, 0x37, 0xD4, 0xDA, 0x64, 0x76, 0x07,
-    0x15, 0xEE, 0xA2, 0xD9, 0xCB, 0xE2, 0x66, 0xAD, 0xCE, 0x3E, 0xAC, 0x05, 0x06, 0x31, 0x48, 0xAC,
-    0xC5, 0x43, 0x7C, 0xAD, 0x6B, 0x51, 0x64, 0xD3, 0x22, 0xBF, 0xFB, 0x23, 0x34, 0x5C, 0xCA, 0xDE,
-    0x2B, 0x59, 0x37, 0xDE, 0x0A, 0xCC, 0x10, 0x08, 0x2F, 0x9E, 0x46, 0xB1, 0xCA, 0xA2, 0x52, 0x6C,
-    0x95, 0x61, 0x25, 0x3E, 0xAF, 0x45, 0x13, 0xDC, 0xE8, 0xC8, 0x06, 0x45, 0x9A, 0xA9, 0x73, 0x45,
-    0x5C, 0xC8, 0x3B, 0x5A, 0x1A, 0x81, 0xB2, 0x84, 0x36, 0x95, 0x1F, 0x77, 0x46, 0x84, 0xF6, 0x13,
-    0x7E, 0xE3, 0xA3, 0xBA, 0xCA, 0xE5, 0x31, 0xDB, 0x76, 0x9C, 0x81, 0xCC, 0x3C, 0x06, 0x02, 0x9F,
-    0x7C, 0x9A, 0x20, 0x79, 0x66, 0x94, 0xF0, 0xDC, 0x26, 0xEC, 0xF7, 0xB6, 0x0A, 0xBB, 0xC4, 0x82,
-    0xC9, 0xC0, 0x97, 0x71, 0x06, 0x26, 0x40, 0x9A, 0x91, 0xA8, 0x20, 0x5E, 0x42, 0x1B, 0x12, 0x45,
-    0x65, 0x7E, 0x0D, 0x12, 0x94, 0x45, 0xC8, 0xC3, 0x9C, 0xD2, 0x00, 0xA9, 0x05, 0x07, 0xF9, 0xFC,
-    0x5C, 0xC0, 0x5C, 0x20, 0x99, 0xE8, 0xC3, 0xE9, 0xE8, 0x32, 0xC1, 0xB3, 0xEE, 0xAF, 0x22, 0x98,
-    0x20, 0xFB, 0xBE, 0xD2, 0xCF, 0x7E, 0x2A, 0xDD, 0xA7, 0x27, 0x2D, 0x0C, 0xA8, 0x14, 0x8D, 0x42,
-    0xB5, 0x8D, 0xEB, 0x1D, 0xD7, 0x2D, 0xB9, 0x7F, 0xED, 0xC0, 0xA9, 0xA2, 0x6A, 0x78, 0x20, 0x98,
-    0x14, 0xE6, 0xA5, 0xFD, 0xA3, 0xD8, 0x6A, 0x34, 0x44, 0xAD, 0x6F, 0x57, 0x9D, 0xB0, 0x8E, 0x5B,
-    0x18, 0x90, 0x68, 0x16, 0x73, 0xE7, 0x64, 0x41, 0x4C, 0xD0, 0xCD, 0xD7, 0x28, 0xA8, 0x50, 0x20,
-    0x4E, 0xBE, 0x42, 0x9A, 0x58, 0xA2, 0x61, 0x63, 0x8E, 0xE7, 0x50, 0x31, 0x5D, 0xB1, 0x2B, 0x51,
-    0x5C, 0xEB, 0xC7, 0x5D, 0x7E, 0x8E, 0x86, 0x6B, 0x15, 0x6E, 0x6D, 0x81, 0xF5, 0xC9, 0xED, 0x09,
-    0x6B, 0x3E, 0x91, 0x5A, 0x69, 0x37, 0x6C, 0x96, 0x96, 0x80, 0x0F, 0xA8, 0x1A, 0x0A, 0x44, 0xC5,
-    0x04, 0xBA, 0x61, 0x40, 0x39, 0x3C, 0x26, 0x6E, 0x21, 0x3A, 0xB9, 0x19, 0x82, 0xC6, 0x37, 0x34,
-    0x6E, 0x20, 0x65, 0xC0, 0x70, 0x83, 0xE4, 0x9A, 0x23, 0xBE, 0xBB, 0x89, 0x1D, 0xCE, 0x47, 0x27,
-    0x88, 0x6B, 0x12, 0x21, 0xBD, 0x1D, 0x3B, 0x2A, 0x9E, 0x0C, 0x61, 0x4F, 0xBA, 0xD8, 0x50, 0xEE,
-    0x71, 0x78, 0x00, 0x5A, 0xB8, 0xD4, 0xA1, 0x2D, 0x68, 0xC3, 0xCA, 0xEF, 0xF2, 0x52, 0xB0, 0xDD,
-    0xDD, 0x2A, 0x17, 0x50, 0xAE, 0xA0, 0xA8, 0x4F, 0xFD, 0x69, 0xAC, 0xBA, 0x4B, 0x24, 0xD7, 0x19,
-    0x1A, 0x9E, 0x7F, 0x1A, 0x72, 0xB3, 0x3D, 0x22, 0x03, 0xF3, 0x44, 0xC5, 0x63, 0x6E, 0x13, 0x40,
-    0x67, 0xCA, 0x23, 0x5B, 0x0C, 0x62, 0x27, 0x79, 0xA3, 0xE1, 0x76, 0x30, 0xC5, 0x54, 0xDB, 0xF0,
-    0xBD, 0x52, 0x8A, 0xCA, 0x83, 0x8D, 0x30, 0x53, 0x72, 0x33, 0x28, 0x0C, 0xB6, 0x7B, 0xCD, 0xF8,
-    0xED, 0x8C, 0xC6, 0xCE, 0xAE, 0xA3, 0xD6, 0x0D, 0x91, 0xC4, 0xA5, 0x9A, 0xFC, 0x23, 0xD8, 0xE1,
-    0x3D, 0x70, 0x97, 0x64, 0xCC, 0x49, 0x61, 0x1F, 0xC4, 0xDD, 0xEE, 0x86, 0xC9, 0x5D, 0x1A, 0x70,
-    0x15, 0x75, 0x2D, 0xCF, 0x90, 0xD0, 0x6C, 0xDA, 0x9D, 0x12, 0xC7, 0x9D, 0xA8, 0x73, 0x28, 0x65,
-    0x6C, 0x97, 0x4A, 0x72, 0x34, 0x93, 0x75, 0x68, 0x64, 0xA1, 0xB4, 0x42, 0xAC, 0xDB, 0xB9, 0xFA,
-    0x6C, 0x77, 0xCF, 0x1E, 0xB7, 0xB2, 0x8E, 0x4A, 0xF5, 0x83, 0xFC, 0x5B, 0xEB, 0x35, 0xC3, 0x27,
-    0x8F, 0x0D, 0xD8, 0x9E, 0x51, 0xED, 0x5F, 0xB3, 0x08, 0x49, 0x0B, 0xB6, 0x09, 0x4D, 0x8C, 0x71,
-    0xBC, 0xF5, 0x1B, 0x61, 0x64, 0x19, 0x43, 0xBE, 0x25, 0xB8, 0x26, 0xAA, 0x7F, 0x7D, 0x29, 0x1F,
-    0xDE, 0x6A, 0x55, 0xA3, 0xCA, 0x34, 0xEB, 0x06, 0x91, 0x98, 0x28, 0x71, 0x82, 0x3C, 0x5C, 0xFB,
-    0xF7, 0xC0, 0xC1, 0x08, 0x90, 0x79, 0xFA, 0xC9, 0x2C, 0xF5, 0x50, 0x7B, 0xD5, 0xB5, 0x84, 0x19,
-    0x59, 0x72, 0x77, 0x3B, 0x8C, 0x40, 0x60, 0x49, 0x79, 0x9F, 0xA7, 0xFE, 0x42, 0x82, 0xF1, 0x73,
-    0x1F, 0x4D, 0x84, 0x2C, 0x60, 0x1C, 0x9F, 0x2A, 0xC0, 0x63, 0xA4, 0xCE, 0x33, 0x75, 0x6C, 0xFC,
-    0x82, 0x5D, 0xB7, 0x37, 0xED, 0x46, 0x17, 0xD4, 0x72, 0x3B, 0x0F, 0xE6, 0x23, 0xF0, 0x2D, 0x32,
-    0x07, 0xF0, 0xDA, 0xE5, 0x3D, 0xA1, 0xB8, 0xF5, 0x9E, 0x40, 0x2E, 0x5E, 0x22, 0x71, 0xA5, 0x70,
-    0x03, 0x4B, 0x04, 0xFF, 0x67, 0x9E, 0xC8, 0x61, 0x0F, 0x88, 0xB9, 0xAF, 0x2A, 0xB0, 0xBF, 0xC5,
-    0xD3, 0x51, 0xD9, 0xF0, 0x05, 0x53, 0x83, 0xED, 0x47, 0x2A, 0x98, 0x14, 0xE2, 0xC1, 0x3C, 0x4F,
-    0x70, 0x0C, 0x35, 0x29, 0x61, 0x93, 0x59, 0x75, 0xCC, 0x92, 0x51, 0x5B, 0xE9, 0xC7, 0x06, 0x67,
-    0x61, 0x91, 0xA0, 0xE1, 0xB4, 0x9E, 0x25, 0x7C, 0x8F, 0x08, 0x21, 0xF7, 0xD7, 0x64, 0x39, 0x8B,
-    0x86, 0x1C, 0x13, 0x3C, 0x8A, 0x9A, 0x72, 0x8D, 0xA8, 0xCA, 0x2E, 0x02, 0xD5, 0x48, 0x99, 0xD0,
-    0x1D, 0x9E, 0x5F, 0x22, 0x28, 0x7C, 0x6B, 0x02, 0x1C, 0x84, 0x05, 0xFD, 0xAC, 0xE7, 0xE2, 0x79,
-    0x07, 0x0D, 0x64, 0x11, 0x50, 0x3E, 0x60, 0x6E, 0x22, 0xD3, 0xB4, 0x52, 0x37, 0xD1, 0x99, 0x3A,
-    0x86, 0x41, 0x08, 0x0E, 0xF2, 0x0B, 0xA6, 0xD0, 0x25, 0xF5, 0x4D, 0x35, 0x95, 0x39, 0x19, 0xDE,
-    0x7D, 0xE3, 0x5A, 0x87, 0xC6, 0x8D, 0x25, 0x4F, 0x4D, 0x4C, 0xC3, 0x33, 0x12, 0xE6, 0x6E, 0x20,
-    0xD5, 0x9B, 0xA0, 0x5C, 0xF1, 0xCD, 0x98, 0x3A, 0x74, 0x6B, 0x3C, 0xA0, 0xED, 0x12, 0x26, 0x4C,
-    0xEC, 0x27, 0x45, 0xCC, 0x77, 0x61, 0x03, 0x62, 0x97, 0x18, 0x59, 0x88, 0x75, 0x7C, 0x9A, 0xD6,
-    0xE2, 0x09, 0xAC, 0xFE, 0x4F, 0x63, 0xE4, 0xA2, 0x96, 0xB7, 0xAB, 0xED, 0x7E, 0x93, 0xD1, 0x94,
-    0x97, 0x10, 0x40, 0x8D, 0x4A, 0x10, 0xE1, 0x95, 0xA0, 0x84, 0x04, 0xB9, 0x05, 0x42, 0xC8, 0xC0,
-    0xAD, 0x09, 0x44, 0xC8, 0x07, 0xAD, 0xBF, 0x7D, 0x1F, 0xEB, 0x65, 0x02, 0xED, 0x18, 0xBA, 0xAF,
-    0x75, 0x77, 0x25, 0x32, 0x1B, 0xD5, 0xA8, 0xA0, 0x10, 0x18, 0x18, 0x6C, 0x2B, 0xA4, 0x8E, 0x74,
-    0xFC, 0xAE, 0x42, 0x4E, 0xC4, 0xE5, 0xD4, 0x79, 0xCE, 0x77, 0x4E, 0xF1, 0xB5, 0xA1, 0xF6, 0xCD,
-    0x52, 0xCA, 0xE2, 0x89, 0x6F, 0xC5, 0x79, 0x48, 0x1A, 0x3B, 0xBF, 0x30, 0xA2, 0xA2, 0xA9, 0xCB,
-    0x24, 0xD0, 0x02, 0x96, 0x1A, 0x8A, 0x01, 0xFF, 0xC6, 0xEA, 0xF8, 0x74, 0x78, 0xB5, 0x74, 0xFE,
-    0x7A, 0x14, 0x71, 0xDD, 0xC6, 0x2A, 0xDF, 0x2F, 0x62, 0xA7, 0xE4, 0x5B, 0x22, 0xBE, 0x7C, 0xCC,
-    0x54, 0x8B, 0xC2, 0x3B, 0xD1, 0x8A, 0xF1, 0xBD, 0x53, 0x47, 0x4D, 0xD3, 0xD3, 0xBB, 0x47, 0x81,
-    0x0B, 0x2B, 0x1E, 0x76, 0xB6, 0x84, 0x25, 0x23, 0xA0, 0x61, 0x09, 0xF1, 0xBB, 0x64, 0x2B, 0x6C,
-    0x0C, 0xB7, 0xD9, 0x7A, 0xF9, 0x65, 0x8A, 0xB6, 0x12, 0x1E, 0x41, 0x40, 0xB6, 0x1E, 0xA8, 0xFC,
-    0x29, 0x00, 0xC0, 0xAF, 0x78, 0xCC, 0x94, 0x08, 0x74, 0x97, 0x6B, 0xEB, 0x6E, 0xFB, 0x36, 0x6A,
-    0x0F, 0x31, 0x03, 0xE7, 0x09, 0xCC, 0xDC, 0x29, 0x72, 0xA4, 0x50, 0xDF, 0x70, 0x02, 0xA1, 0xF6,
-    0xF4, 0xD6, 0xF3, 0x05, 0x46, 0xBA, 0x39, 0x24, 0x6E, 0x31, 0x49, 0x5C, 0x8F, 0x66, 0x83, 0x56,
-    0x1A, 0x75, 0xDF, 0x22, 0xCC, 0x38, 0x29, 0x1C, 0xBA, 0x3D, 0x5A, 0x21, 0x9F, 0x74, 0xAC, 0x53,
-    0xEA, 0x44, 0xCD, 0x92, 0x22, 0x9D, 0xEE, 0xC3, 0xF8, 0xF5, 0x65, 0x13, 0xDA, 0xE3, 0xC5, 0x90,
-    0x69, 0xA0, 0x26, 0x51, 0x38, 0x0C, 0x01, 0x8D, 0x7C, 0x5B, 0xF7, 0xF4, 0x10, 0x23, 0x6E, 0x93,
-    0x53, 0xF4, 0x7F, 0xE7, 0x6A, 0x95, 0x59, 0xC4, 0xFF, 0x7A, 0x19, 0xDE, 0xAD, 0x38, 0xBF, 0xDB,
-    0x34, 0x49, 0x61, 0xD5, 0xD1, 0x36, 0xD5, 0x29, 0xDF, 0xC3, 0x6F, 0xDF, 0x18, 0xF1, 0x98, 0x05,
-    0x6A, 0x62, 0x4C, 0xAA, 0xFE, 0x2F, 0x20, 0x2F, 0x0C, 0xA9, 0x87, 0xC2, 0x55, 0xB0, 0x13, 0x90,
-    0x26, 0x4B, 0x75, 0x05, 0x79, 0x8B, 0xFA, 0xB7, 0x01, 0x71, 0x2A, 0x51, 0x8B, 0x15, 0xDF, 0x73,
-    0xB7, 0x02, 0xF2, 0xF8, 0x6E, 0x2F, 0xAD, 0xB6, 0x39, 0x0F, 0xF1, 0x44, 0x9B, 0x0A, 0x64, 0x46,
-    0x81, 0x96, 0x49, 0xF9, 0xA3, 0x0C, 0x63, 0xA2, 0xB3, 0xBF, 0xE0, 0x1A, 0xE6, 0x6F, 0xD4, 0xD3,
-    0x70, 0xFD, 0x28, 0x8B, 0xF8, 0x2E, 0xF1, 0x34, 0xC5, 0xE7, 0x0B, 0xBE, 0xAA, 0x18, 0x28, 0xEE,
-    0xC7, 0x4A, 0x5A, 0x77, 0x43, 0x57, 0xCB, 0xB8, 0xED, 0xAF, 0xF6, 0xF1, 0x3E, 0x5C, 0x8B, 0x4D,
-    0xD6, 0x11, 0x02, 0xE8, 0xC8, 0xBF, 0x63, 0xE9, 0xA5, 0xD7, 0x61, 0xB4, 0x6A, 0xD1, 0x2A, 0xA4,
-    0x02, 0x23, 0xD5, 0xD1, 0x2D, 0x2D, 0xAF, 0x6D, 0x96, 0xE2, 0xE1, 0x06, 0xBA, 0xF4, 0x33, 0xE8,
-    0x20, 0x33, 0xF0, 0xEE, 0xB7, 0xE8, 0x53, 0x50, 0x70, 0x65, 0xD4, 0x0E, 0x37, 0x92, 0x4C, 0x97,
-    0x87, 0xFA, 0xF1, 0x82, 0x39, 0x88, 0x6F, 0x64, 0x3D, 0x3D, 0xE1, 0xE5, 0xB8, 0x0A, 0xBE, 0xB5,
-    0xE0, 0x3C, 0x98, 0x07, 0xF2, 0x34, 0x7C, 0xAF, 0x1E, 0xA3, 0xDE, 0xB4, 0x9C, 0x76, 0xB1, 0x8E,
-    0xAE, 0x58, 0x1A, 0x47, 0xCD, 0x6B, 0xDD, 0x5D, 0x7B, 0xDD, 0xCA, 0x06, 0x9D, 0xEF, 0x23, 0x05,
-    0xEE, 0xF9, 0xBE, 0x68, 0xF2, 0x05, 0xBB, 0x72, 0x57, 0xBA, 0xAE, 0x94, 0xF6, 0xDC, 0x9C, 0x17,
-    0xD1, 0x35, 0x3B, 0x91, 0xC3, 0x89, 0x9B, 0xD2, 0xB8, 0x47, 0x1F, 0xB8, 0x9E, 0xD2, 0xA0, 0xF1,
-    0xEB, 0xF4, 0xDB, 0xF3, 0x0F, 0xAF, 0x5B, 0x90, 0xAA, 0x49, 0xF5, 0xF8, 0x91, 0x02, 0x67, 0x5C,
-    0x81, 0x13, 0xF7, 0xC0, 0xA7, 0x61, 0xE6, 0x0D, 0x4C, 0xF4, 0x44, 0x96, 0x9E, 0x8A, 0x5D, 0x3F,
-    0x26, 0x37, 0xCA, 0x49, 0x7D, 0xC3, 0x3F, 0x61, 0xEB, 0x35, 0x69, 0xCD, 0x7F, 0xB6, 0xC2, 0x01,
-    0x51, 0xE3, 0x35, 0x4C, 0x32, 0x83, 0xF4, 0x10, 0xD2, 0x53, 0x1D, 0x9F, 0xB3, 0xCF, 0xD8, 0x35,
-    0x7B, 0x17, 0xCD, 0x53, 0xD0, 0x84, 0x8F, 0x36, 0x7A, 0x92, 0x3B, 0x8A, 0xA2, 0xB7, 0x95, 0xC3,
-    0xE9, 0x2E, 0x80, 0x5F, 0x98, 0xFC, 0x76, 0x17, 0x06, 0xF2, 0xA8, 0x08, 0x2D, 0xB7, 0x96, 0x1A,
-    0x9D, 0x4F, 0x05, 0x53, 0x5A, 0xE4, 0x28, 0x77, 0x30, 0xC1, 0x17, 0x15, 0xD2, 0x0B, 0xA7, 0xAB,
-    0xE6, 0xB9, 0xF1, 0x1A, 0xEE, 0xE4, 0x5C, 0x0F, 0x94, 0xF5, 0x97, 0x3A, 0xE0, 0xAA, 0x83, 0xF8,
-    0x97, 0xFF, 0x38, 0xE6, 0x72, 0x7D, 0x3C, 0xD0, 0x33, 0x13, 0x7A, 0xBF, 0x22, 0x07, 0xCD, 0x6E,
-    0x5E, 0x5C, 0xF7, 0x78, 0xB2, 0x01, 0xC5, 0x5D, 0x07, 0x37, 0x6C, 0xE5, 0xDA, 0xB7, 0x8B, 0x98,
-    0xB6, 0x0F, 0xF3, 0x34, 0x81, 0x29, 0xB7, 0x88, 0xB3, 0x00, 0xE5, 0xD0, 0xAF, 0xC1, 0x46, 0x2D,
-    0x13, 0xDB, 0xE7, 0x20, 0x34, 0x50, 0x46, 0x88, 0xEA, 0xE6, 0x86, 0xDC, 0x76, 0xF8, 0x4B, 0x49,
-    0xFC, 0x55, 0xDF, 0xC9, 0xED, 0xB9, 0x30, 0x0D, 0xDB, 0x9C, 0x4C, 0x28, 0xDA, 0x2C, 0x29, 0xFC,
-    0xD4, 0x3C, 0x32, 0x37, 0xE1, 0x70, 0xF3, 0xC3, 0x3C, 0x88, 0xA3, 0x41, 0x6E, 0x40, 0x1E, 0xEA,
-    0x08, 0x53, 0x1F, 0xE6, 0xA5, 0x1A, 0x62, 0x56, 0x22, 0x6C, 0x79, 0x0F, 0xBD, 0xDB, 0x5D, 0x6E,
-    0x83, 0xFB, 0x83, 0xE4, 0xFB, 0x11, 0x87, 0x3B, 0x67, 0x2E, 0x7A, 0xB4, 0x33, 0x4C, 0x7C, 0xF8,
-    0x9C, 0xD6, 0x3D, 0x76, 0xE8, 0x7F, 0xBD, 0x5A, 0x4D, 0x8C, 0xDD, 0xD6, 0x75, 0x3E, 0x24, 0x35,
-    0xA2, 0x6D, 0xD6, 0xE6, 0x20, 0x90, 0xD2, 0xD4, 0x46, 0x43, 0x2F, 0xBC, 0x70, 0x81, 0xD8, 0xDC,
-    0x78, 0x91, 0x85, 0x34, 0x97, 0x8E, 0x17, 0x36, 0xE0, 0x85, 0xA6, 0xC5, 0xBC, 0x06, 0x68, 0x17,
-    0x2A, 0xD0, 0x2C, 0x82, 0x7A, 0x61, 0x2F, 0xBC, 0x70, 0x01, 0x49, 0xA4, 0xAD, 0x85, 0x03, 0x78,
-    0x91, 0x59, 0xD4, 0x2B, 0x2F, 0xAC, 0x85, 0x17, 0x2D, 0x0A, 0x38, 0x5E, 0x68, 0xE1, 0xBA, 0xA3,
-    0x47, 0x4A, 0xB3, 0xD0, 0x22, 0x8B, 0xD0, 0x36, 0x02, 0x01, 0xED, 0x42, 0x94, 0x6B, 0xC5, 0x45,
-    0x04, 0x74, 0x28, 0x9B, 0x46, 0x38, 0x1A, 0x92, 0xB7, 0xDF, 0x77, 0x2F, 0xF9, 0xDE, 0x53, 0xEA,
-    0xC4, 0x89, 0x92, 0xE9, 0x40, 0xEF, 0xCD, 0xE8, 0x3D, 0x92, 0xF7, 0xFC, 0x7E, 0xE7, 0x3B, 0xE7,
-    0x5E, 0x91, 0xB5, 0x59, 0x22, 0x12, 0xEB, 0x42, 0x44, 0xF1, 0x6D, 0xE5, 0xE7, 0x87, 0x78, 0xB9,
-    0x1D, 0xDE, 0x7C, 0xBE, 0x85, 0x3D, 0xDE, 0x62, 0xBE, 0x6D, 0xCC, 0xF1, 0xD6, 0xA5, 0x22, 0x4E,
-    0x83, 0x37, 0xAF, 0x56, 0x22, 0x41, 0xA9, 0x12, 0x09, 0x0B, 0x95, 0xE1, 0x49, 0x78, 0x4A, 0xCA,
-    0xB7, 0x5E, 0xE2, 0xC2, 0x6D, 0x25, 0x2A, 0xBD, 0x5A, 0xA2, 0x0A, 0x77, 0xEA, 0x3E, 0x1D, 0x5C,
-    0xDD, 0x4B, 0x84, 0x2F, 0xB5, 0x16, 0x99, 0x6D, 0x99, 0x65, 0x1C, 0xBC, 0xF4, 0xDB, 0x59, 0x84,
-    0x6F, 0x86, 0xA8, 0x0E, 0xEA, 0x38, 0x53, 0xD2, 0xBB, 0x9D, 0x57, 0x87, 0x55, 0x5C, 0xA8, 0x44,
-    0x4B, 0x17, 0xB4, 0x5E, 0xF3, 0xEF, 0x9F, 0x84, 0x07, 0xD7, 0x7B, 0xD5, 0xA9, 0x2A, 0xCD, 0x86,
-    0x51, 0xC0, 0xFB, 0x04, 0xA2, 0x3F, 0xE9, 0x40, 0xEA, 0x78, 0x2F, 0x83, 0x84, 0xFC, 0xDC, 0xD9,
-    0x3C, 0x74, 0xF9, 0x8F, 0xE0, 0xF6, 0x57, 0x3C, 0x71, 0xF7, 0x77, 0xC4, 0xC3, 0x75, 0xEE, 0x7F,
-    0xDB, 0xE5, 0xD6, 0xB1, 0xC6, 0x7E, 0xEB, 0x68, 0x5D, 0x86, 0x37, 0xB4, 0xE4, 0x6E, 0x0B, 0x0D,
-    0x4A, 0x68, 0x20, 0x03, 0x94, 0x69, 0xC2, 0x3A, 0x2C, 0xF2, 0x4C, 0x3D, 0x3F, 0x7F, 0x54, 0x5F,
-    0xD2, 0x1F, 0xEB, 0xDD, 0xC1, 0x6F, 0xC3, 0xEA, 0x90, 0x05, 0xC5, 0xE5, 0x30, 0x90, 0x9C, 0xE4,
-    0x1A, 0x3B, 0x7C, 0xCB, 0x2F, 0xE0, 0x4D, 0x95, 0xD6, 0xE8, 0xF7, 0x66, 0x77, 0xC8, 0x1C, 0xE2,
-    0xD7, 0x19, 0xDC, 0x7F, 0x07, 0x32, 0x75, 0x2B, 0xF1, 0x12, 0xE0, 0x15, 0xD1, 0x19, 0x35, 0x16,
-    0xC1, 0x75, 0x0F, 0x24, 0xF6, 0x73, 0xE7, 0xDD, 0x4C, 0x02, 0x38, 0x3C, 0x84, 0xB0, 0x21, 0xAD,
-    0xD2, 0x48, 0x1B, 0x34, 0x72, 0x82, 0x37, 0x3B, 0x94, 0x52, 0x53, 0x2A, 0xDC, 0x18, 0xD6, 0xE3,
-    0x13, 0xCD, 0x07, 0x95, 0x3C, 0x15, 0x0C, 0x72, 0x0E, 0xA1, 0xA2, 0x11, 0x32, 0x3A, 0x91, 0x7C,
-    0x58, 0x59, 0xCC, 0xCB, 0xC4, 0xAD, 0xC5, 0xC1, 0xD5, 0x9D, 0x91, 0xE6, 0x3E, 0xFB, 0x71, 0x22,
-    0xB8, 0x27, 0xC4, 0x3A, 0xBF, 0x80, 0x1A, 0xEB, 0x7E, 0x2D, 0x30, 0x0C, 0x0C, 0x24, 0xB0, 0x5A,
-    0x54, 0x8A, 0xD7, 0x06, 0x78, 0x5C, 0x11, 0xEB, 0xD2, 0xD5, 0xD9, 0xF2, 0x59, 0x4E, 0x83, 0x17,
-    0x16, 0x70, 0x0E, 0x78, 0xFD, 0x86, 0x48, 0xE3, 0x1D, 0x96, 0xE4, 0x9B, 0xE2, 0x35, 0x12, 0x76,
-    0x12, 0x9F, 0x95, 0x9D, 0x58, 0xEA, 0x07, 0x47, 0xA1, 0xE3, 0x56, 0x74, 0xE7, 0xED, 0xEF, 0x40,
-    0x66, 0x58, 0x30, 0xCE, 0x28, 0x2F, 0xFE, 0xA5, 0x78, 0xCF, 0xDE, 0x53, 0xBA, 0x86, 0xC4, 0xC1,
-    0xF8, 0x0C, 0x27, 0x61, 0x28, 0x88, 0x51, 0x1D, 0x6B, 0x88, 0xAC, 0x8D, 0x8F, 0x3E, 0xFA, 0x01,
-    0xF3, 0xB8, 0x43, 0x1A, 0x6B, 0x88, 0x80, 0x18, 0x29, 0xBD, 0x2A, 0x2E, 0xA5, 0xA6, 0x6C, 0x7E,
-    0xB3, 0x2A, 0xDF, 0x5D, 0x02, 0x67, 0x52, 0xC6, 0xAD, 0xD3, 0x7A, 0x1A, 0xB7, 0xA6, 0x88, 0x05,
-    0x57, 0xB7, 0x2B, 0xC2, 0xD6, 0x12, 0xE0, 0x5F, 0x69, 0x82, 0xE5, 0xF7, 0x95, 0x94, 0x3F, 0xEF,
-    0xF9, 0xB8, 0x08, 0xF7, 0x7B, 0x07, 0x88, 0xBA, 0x14, 0x0B, 0xFB, 0xC5, 0x21, 0x99, 0xF6, 0x31,
-    0x3F, 0x89, 0x82, 0xC2, 0xBB, 0x56, 0x48, 0x5E, 0x0A, 0x52, 0xCB, 0xB9, 0x30, 0xA1, 0x0B, 0x44,
-    0x56, 0x30, 0xC9, 0x5B, 0xC8, 0x9A, 0x04, 0x32, 0x07, 0x15, 0x7D, 0xC0, 0xA0, 0x80, 0xD0, 0x61,
-    0xF5, 0x1D, 0x68, 0x2E, 0xB9, 0x4E, 0x82, 0xBB, 0xA2, 0xAB, 0x88, 0xB1, 0xF2, 0x79, 0x2C, 0x1D,
-    0xE5, 0x62, 0x23, 0x5A, 0x9E, 0x9C, 0xEC, 0xFC, 0xEE, 0x3B, 0x30, 0x92, 0xC1, 0x31, 0x3D, 0xC8,
-    0x37, 0xBA, 0xA0, 0x87, 0x8C, 0x01, 0xEC, 0x9E, 0x85, 0x35, 0x24, 0x8F, 0x4B, 0x58, 0x2C, 0xCD,
-    0xE2, 0x02, 0x7F, 0x6B, 0x09, 0x1A, 0xAF, 0x45, 0x7A, 0x22, 0xF6, 0xB0, 0x08, 0xDC, 0x00, 0x4D,
-    0x54, 0x11, 0x56, 0x48, 0xF4, 0xF4, 0x3F, 0x74, 0x89, 0x27, 0xB4, 0x58, 0x7B, 0x7F, 0xB9, 0x30,
-    0x53, 0x26, 0xFF, 0xA8, 0x12, 0x5F, 0x9F, 0x42, 0x80, 0xF6, 0x27, 0x20, 0xCA, 0x6D, 0xA4, 0x52,
-    0xF4, 0x53, 0xE0, 0xCB, 0xFC, 0x98, 0x84, 0x07, 0x0D, 0x22, 0x15, 0x39, 0x4F, 0x88, 0x21, 0xC6,
-    0x08, 0x41, 0x46, 0x88, 0x32, 0x84, 0x19, 0x28, 0x06, 0xCD, 0x09, 0x34, 0x42, 0xA4, 0x11, 0x40,
-    0x4D, 0xE9, 0x01, 0x6B, 0x64, 0x05, 0x6C, 0x1E, 0xFE, 0x60, 0x9B, 0x86, 0x6F, 0x88, 0x1D, 0xAD,
-    0x3C, 0x5F, 0xC7, 0x0D, 0x24, 0x82, 0x82, 0x03, 0x7E, 0x21, 0x4C, 0xF2, 0x04, 0x92, 0x0F, 0x0F,
-    0xEB, 0x7F, 0xF6, 0x9B, 0x1C, 0xDE, 0x2C, 0xA3, 0x0A, 0x72, 0xA7, 0x89, 0xD7, 0xE1, 0xE9, 0x51,
-    0x09, 0x67, 0xC0, 0x92, 0x59, 0x54, 0x3B, 0xFA, 0x05, 0x9D, 0xE0, 0x09, 0x15, 0x2C, 0xF1, 0xE9,
-    0x5D, 0xE2, 0xC3, 0x1C, 0x90, 0x1E, 0x7F, 0x84, 0x70, 0xDE, 0xBF, 0x02, 0x23, 0x72, 0x96, 0x15,
-    0x20, 0x59, 0x0A, 0x73, 0xF3, 0x6F, 0xFD, 0x62, 0x6D, 0x24, 0x57, 0x49, 0x6F, 0x04, 0x27, 0xDC,
-    0x18, 0xB9, 0x81, 0x37, 0x92, 0x42, 0x6C, 0x02, 0x8E, 0x91, 0x7A, 0x89, 0xF4, 0xA6, 0x56, 0xA4,
-    0x88, 0xD5, 0x48, 0x97, 0x8B, 0xC5, 0x8E, 0xCF, 0x66, 0x09, 0x2C, 0xD8, 0x18, 0x67, 0xC0, 0xC6,
-    0x70, 0x83, 0x5F, 0x78, 0xAD, 0x53, 0x9A, 0xF8, 0x31, 0x7E, 0x83, 0x86, 0x21, 0xBE, 0xF4, 0xF6,
-    0x67, 0x32, 0x7E, 0x78, 0x04, 0x6A, 0x06, 0x49, 0x58, 0x79, 0xA5, 0xBF, 0xFF, 0xFD, 0x1A, 0xB7,
-    0x77, 0x01, 0x6F, 0xC7, 0xC3, 0x59, 0xFF, 0x9C, 0xD9, 0xE6, 0xDD, 0x30, 0xB2, 0xDB, 0x84, 0x45,
-    0xE7, 0x57, 0xE7, 0xDC, 0x7A, 0x2E, 0x03, 0x4C, 0x44, 0x98, 0x3D, 0xE2, 0xD5, 0x41, 0xA2, 0x7F,
-    0x52, 0xAE, 0xC2, 0xC8, 0x26, 0xE2, 0xEC, 0x8C, 0x9F, 0xF0, 0x1E, 0x04, 0x07, 0x14, 0x5E, 0xB3,
-    0xE0, 0xB7, 0x36, 0x9B, 0x6D, 0xFA, 0x5C, 0x20, 0x47, 0xB0, 0x06, 0x94, 0xAF, 0x73, 0x68, 0xEB,
-    0x97, 0x19, 0x7C, 0x10, 0x1A, 0xF6, 0x42, 0x10, 0x79, 0x8C, 0xE4, 0x61, 0x96, 0x8C, 0x1F, 0x3A,
-    0xD0, 0xC4, 0x2D, 0x11, 0x38, 0x8D, 0x33, 0xCC, 0x3A, 0xDC, 0xAE, 0xA1, 0x22, 0xAE, 0x40, 0x85,
-    0xF9, 0xB6, 0x14, 0xC1, 0x2F, 0xE0, 0x04, 0x24, 0xA5, 0x8D, 0x6F, 0x14, 0xA3, 0xBC, 0x42, 0x4A,
-    0x4A, 0xA7, 0x92, 0x2E, 0x2C, 0xCE, 0xF9, 0x55, 0x1C, 0x54, 0xE1, 0x5E, 0xE5, 0xE9, 0x0C, 0x1A,
-    0x27, 0x4A, 0x2E, 0x86, 0x77, 0x7A, 0x16, 0x83, 0x78, 0x4A, 0x6B, 0x03, 0x20, 0xCD, 0x98, 0x65,
-    0xE9, 0x12, 0x40, 0xFE, 0xA8, 0xA2, 0xFE, 0x16, 0xEC, 0xA8, 0x7B, 0x98, 0x34, 0x7A, 0xB5, 0x85,
-    0x9C, 0x0A, 0x15, 0x11, 0x3E, 0x4F, 0xD6, 0x21, 0xA6, 0xBA, 0xD5, 0x2C, 0xB1, 0x63, 0x36, 0x9B,
-    0x31, 0x3E, 0x4B, 0x13, 0xA8, 0x39, 0xF0, 0x5D, 0xD1, 0xBD, 0x95, 0x9F, 0x10, 0xC8, 0x4C, 0xA9,
-    0xCC, 0x75, 0x05, 0x87, 0x01, 0x4B, 0x6F, 0x6E, 0xC9, 0xF8, 0xE1, 0x3A, 0x62, 0xF3, 0x09, 0xA6,
-    0x61, 0x12, 0xDD, 0x3C, 0x5D, 0xE0, 0x76, 0x80, 0x11, 0xAE, 0x10, 0xB9, 0x88, 0x57, 0x63, 0x8B,
-    0x96, 0x44, 0xA8, 0xD6, 0x5E, 0x6F, 0x0D, 0xF7, 0x3B, 0x8A, 0x84, 0x4C, 0xFB, 0x8E, 0xC0, 0x0C,
-    0x02, 0x14, 0xB8, 0x83, 0x18, 0x4E, 0xCC, 0xBD, 0xFC, 0xB9, 0xE8, 0x97, 0x2B, 0xE8, 0x86, 0x97,
-    0x6F, 0xA3, 0xD3, 0x99, 0xCD, 0xB6, 0x1C, 0xDA, 0x01, 0x02, 0x94, 0x2E, 0xCD, 0xA8, 0xA9, 0x43,
-    0xF6, 0xE7, 0x2C, 0x42, 0xB4, 0x0A, 0x01, 0x24, 0x03, 0x88, 0x95, 0xA2, 0xDE, 0xDC, 0x9C, 0x3E,
-    0x44, 0x92, 0x41, 0xD4, 0x01, 0xF5, 0x3A, 0x7D, 0x33, 0xE5, 0xED, 0x45, 0xCE, 0x2B, 0xBE, 0x1E,
-    0xD9, 0xC2, 0x52, 0x79, 0x35, 0xC4, 0x0F, 0xAE, 0xB4, 0xDE, 0x01, 0x14, 0xAA, 0x28, 0x7F, 0x58,
-    0x3C, 0xE1, 0x0D, 0x79, 0xF2, 0xEB, 0xC8, 0x26, 0x8A, 0x14, 0x03, 0xB1, 0x40, 0x99, 0x9D, 0x2E,
-    0x26, 0xAE, 0x5D, 0x98, 0x0A, 0x48, 0x82, 0xCC, 0xD5, 0x99, 0x29, 0x05, 0x3A, 0x0B, 0x33, 0x30,
-    0x85, 0x06, 0x98, 0x1C, 0x1A, 0xE8, 0x45, 0x29, 0xB1, 0x38, 0xAC, 0x8A, 0xB5, 0xD9, 0x33, 0xB8,
-    0xA0, 0x43, 0x22, 0x69, 0xFC, 0x11, 0x56, 0x40, 0x65, 0xF0, 0x8D, 0x24, 0x2C, 0x43, 0xFD, 0x96,
-    0xA9, 0x3F, 0x24, 0x26, 0xDB, 0x2B, 0xE1, 0x46, 0x8F, 0xB1, 0xC0, 0xCA, 0x1D, 0xA8, 0xDE, 0x82,
-    0x8F, 0xBC, 0xE2, 0x2F, 0x4A, 0x8C, 0x59, 0x32, 0x38, 0xD0, 0xA5, 0x0F, 0x7E, 0x03, 0x1C, 0x28,
-    0xA4, 0x43, 0xD9, 0x56, 0x08, 0xA9, 0xE0, 0x33, 0xDC, 0x96, 0xC3, 0x71, 0xB4, 0x4F, 0x84, 0x44,
-    0x03, 0x3E, 0xC0, 0x70, 0x00, 0xB8, 0x03, 0x48, 0x57, 0x46, 0x4D, 0xC0, 0x75, 0x09, 0x24, 0xE9,
-    0xCF, 0xF3, 0x2C, 0xA0, 0x45, 0x63, 0x03, 0xA5, 0x8F, 0xC2, 0x34, 0x61, 0xF2, 0x1E, 0x4A, 0xC6,
-    0x84, 0x45, 0x47, 0x47, 0x2A, 0x22, 0x2F, 0xBC, 0xC3, 0x54, 0x6F, 0x8D, 0x90, 0xB0, 0x42, 0x8B,
-    0x50, 0x08, 0x13, 0x78, 0xD4, 0x54, 0x49, 0xB7, 0x1F, 0x6B, 0x0E, 0xF4, 0x9C, 0x6D, 0x01, 0xA7,
-    0xF5, 0x6E, 0x07, 0x01, 0xF0, 0xC9, 0xE0, 0x0D, 0xC4, 0xA9, 0x06, 0x55, 0x43, 0xEF, 0xE7, 0x85,
-    0xB1, 0x90, 0xBF, 0xC4, 0x6D, 0x24, 0xA6, 0x9C, 0x70, 0x33, 0x09, 0xAF, 0x95, 0x46, 0x40, 0x79,
-    0x64, 0x7B, 0xA9, 0x7C, 0x84, 0xAC, 0x89, 0xF7, 0x34, 0x4A, 0x0F, 0x6C, 0x55, 0x42, 0xC7, 0x1A,
-    0x45, 0xA8, 0x83, 0x1F, 0xE3, 0xB7, 0x41, 0x37, 0xE8, 0x60, 0xA6, 0x12, 0x2B, 0x79, 0x5C, 0x31,
-    0xC7, 0x80, 0xDD, 0x7B, 0x03, 0x95, 0x2A, 0xE3, 0x0C, 0x84, 0xA5, 0x92, 0xDE, 0xD1, 0x7F, 0x8D,
-    0x47, 0xE0, 0x31, 0x92, 0x7F, 0x3A, 0x3D, 0x95, 0x88, 0x2A, 0x06, 0xD4, 0xBB, 0x91, 0x43, 0x1F,
-    0xA2, 0x7E, 0xC6, 0x87, 0xC4, 0x8F, 0x61, 0x0C, 0x20, 0x47, 0x0E, 0x53, 0xBF, 0x43, 0x51, 0xE2,
-    0x2F, 0xC4, 0xF2, 0x26, 0x23, 0xBF, 0xC7, 0x3C, 0xA5, 0x42, 0xF7, 0x2F, 0x13, 0xE3, 0xC4, 0xF8,
-    0x22, 0x5D, 0x8E, 0x12, 0x9B, 0xCB, 0xCE, 0xC4, 0x6F, 0x8F, 0x31, 0x80, 0x51, 0xED, 0x06, 0xDD,
-    0x38, 0x80, 0x59, 0xE9, 0xF1, 0x28, 0x85, 0x6F, 0xC3, 0x62, 0x40, 0x23, 0xA0, 0x2D, 0x61, 0x27,
-    0x0E, 0xF9, 0xD0, 0xD1, 0xA5, 0x99, 0x72, 0xD4, 0xE6, 0x41, 0x57, 0x5E, 0xE3, 0xF7, 0x8C, 0xD1,
-    0x6C, 0x0E, 0xE3, 0x44, 0x5F, 0xBE, 0xC8, 0x82, 0x59, 0xA1, 0xBA, 0x24, 0x8B, 0x75, 0x79, 0x87,
-    0xCD, 0x0E, 0x39, 0xC7, 0xE5, 0xA2, 0xF3, 0x7C, 0x44, 0x39, 0x49, 0x86, 0xFE, 0x6C, 0x36, 0x73,
-    0x74, 0x1F, 0xEA, 0x2A, 0xD0, 0x49, 0x4E, 0x36, 0x01, 0xE4, 0x86, 0xF2, 0x40, 0x64, 0x95, 0xE1,
-    0x37, 0x56, 0x45, 0x3B, 0x90, 0x13, 0x1A, 0x03, 0x83, 0xBD, 0x78, 0xAB, 0x81, 0x8B, 0x33, 0x4D,
-    0x88, 0xA7, 0x1F, 0x56, 0x6E, 0x28, 0x78, 0x43, 0xCB, 0x52, 0xAF, 0x1B, 0x85, 0xC7, 0x69, 0x9F,
-    0x08, 0xC9, 0xF4, 0x80, 0x7D, 0x89, 0x74, 0x97, 0x36, 0x24, 0x28, 0x5E, 0x99, 0x9C, 0xCB, 0xFA,
-    0x16, 0x41, 0x1B, 0x64, 0x23, 0xC4, 0x37, 0xE5, 0xC2, 0x6D, 0x8F, 0x48, 0xF8, 0x11, 0x1C, 0xA8,
-    0x3A, 0x67, 0xB8, 0x55, 0xFB, 0x43, 0x54, 0xC4, 0x55, 0x2E, 0xDA, 0x6B, 0xBD, 0x36, 0x2C, 0xA2,
-    0x22, 0x35, 0xAD, 0x4F, 0x1B, 0x7E, 0x84, 0x58, 0x40, 0xEF, 0xA2, 0x3F, 0xE9, 0x8C, 0xC7, 0x4C,
-    0x0D, 0x5F, 0x9B, 0x6D, 0xA2, 0x80, 0xC3, 0xD1, 0x79, 0x83, 0x38, 0x30, 0x8C, 0xC2, 0x49, 0x7F,
-    0xFE, 0xFD, 0x01, 0x72, 0xB0, 0xF0, 0xA4, 0x19, 0xB3, 0xBE, 0x11, 0x43, 0x14, 0x88, 0xED, 0x64,
-    0x79, 0x28, 0x36, 0xA7, 0x6B, 0x42, 0xC0, 0x20, 0xE6, 0x06, 0xC8, 0x4E, 0xA2, 0x43, 0x1E, 0xC5,
-    0x1B, 0x48, 0x5A, 0x9F, 0xD1, 0x78, 0x5C, 0x9D, 0x42, 0xF5, 0x63, 0x06, 0x13, 0x1D, 0xA6, 0x20,
-    0x6C, 0xF2, 0xF0, 0x70, 0x81, 0x74, 0x9F, 0x2C, 0x55, 0xFA, 0x47, 0x4A, 0xEF, 0x73, 0x5D, 0x44,
-    0x7B, 0xE0, 0x61, 0x37, 0x3A, 0x57, 0x07, 0x08, 0x26, 0x95, 0xA9, 0xAC, 0x77, 0x00, 0x37, 0xA6,
-    0xF9, 0xC9, 0xFA, 0x47, 0x41, 0x3B, 0xAE, 0xD6, 0xE1, 0x10, 0x17, 0xB1, 0xC5, 0xF1, 0xFB, 0x1D,
-    0x89, 0x3E, 0x07, 0xAA, 0xD5, 0xDE, 0x6E, 0x63, 0xB3, 0x1C, 0xEE, 0x40, 0x91, 0x6C, 0xE9, 0x5D,
-    0x20, 0x36, 0xF1, 0x70, 0x30, 0x4B, 0x41, 0xAE, 0xE5, 0xFF, 0x21, 0x7F, 0x3C, 0xFD, 0xDF, 0x01,
-    0xF9, 0x22, 0x45, 0x81, 0x0D, 0xB6, 0xD7, 0xF1, 0xB0, 0x03, 0xCD, 0x67, 0x39, 0x16, 0xC0, 0x7D,
-    0xC3, 0x28, 0x60, 0x58, 0xC5, 0x48, 0x43, 0x2A, 0x80, 0x49, 0xC3, 0x3F, 0xB5, 0xC4, 0x3F, 0x12,
-    0xDD, 0xA0, 0xB9, 0x0C, 0xDA, 0x91, 0xE9, 0x88, 0x29, 0x44, 0xF5, 0x82, 0xF9, 0x80, 0xF8, 0x54,
-    0x44, 0x1A, 0xF8, 0x14, 0x49, 0x41, 0xF7, 0x8C, 0xEB, 0x4E, 0xFF, 0x67, 0x75, 0xCF, 0xA7, 0xFF,
-    0xC3, 0xE3, 0x11, 0xEF, 0x6F, 0x20, 0x4B, 0x0D, 0x9A, 0x83, 0xEA, 0x6A, 0x50, 0x2B, 0x25, 0x4D,
-    0x40, 0xBA, 0xB0, 0x71, 0x2C, 0x80, 0x28, 0xEC, 0x4D, 0x60, 0x55, 0xF8, 0x38, 0x0B, 0x75, 0xA2,
-    0x90, 0x57, 0x96, 0xDE, 0x3C, 0x06, 0x3B, 0x38, 0x85, 0x8F, 0xF6, 0x08, 0x4B, 0x5A, 0x66, 0x73,
-    0xEF, 0x76, 0x70, 0x58, 0x72, 0x8A, 0xF9, 0x8B, 0x0E, 0xD4, 0xF9, 0xB7, 0xDF, 0xCF, 0x0E, 0x4C,
-    0x84, 0x41, 0x4C, 0x0E, 0xD0, 0xFD, 0x58, 0x0F, 0xFF, 0x18, 0x2D, 0xA6, 0x3B, 0x18, 0xA8, 0x34,
-    0x82, 0xCD, 0x86, 0x07, 0x74, 0x4E, 0x19, 0xE0, 0x09, 0x13, 0xBA, 0x66, 0xB3, 0xE8, 0xA2, 0x78,
-    0xEB, 0xD1, 0x82, 0x61, 0x11, 0xD4, 0xB8, 0xE8, 0x92, 0x59, 0x3E, 0xAD, 0xB0, 0x7A, 0x8F, 0xC5,
-    0xA3, 0x22, 0x40, 0xC2, 0x62, 0xE9, 0x14, 0x2B, 0x87, 0x88, 0xAB, 0x2C, 0x4F, 0x82, 0xC4, 0xCF,
-    0x3C, 0x80, 0x4B, 0x02, 0x55, 0x92, 0xD5, 0xA6, 0xA8, 0xB2, 0x38, 0x7C, 0x8F, 0x42, 0xAD, 0x47,
-    0xAD, 0x42, 0x7B, 0xED, 0xD5, 0x88, 0xBE, 0x0A, 0x95, 0x13, 0x99, 0x13, 0xFF, 0x48, 0xA1, 0xD1,
-    0x26, 0x48, 0xE2, 0x99, 0x26, 0x55, 0x6E, 0x98, 0x07, 0x4F, 0xA9, 0x32, 0x46, 0x7E, 0x6B, 0x57,
-    0xC1, 0x6F, 0xDF, 0xA6, 0x0A, 0xA5, 0x31, 0xC4, 0x1C, 0x8B, 0x85, 0x53, 0xAA, 0xF4, 0xFC, 0x1D,
-    0xDF, 0x95, 0x2A, 0x66, 0xED, 0x34, 0x41, 0x18, 0x04, 0x26, 0x90, 0x88, 0x52, 0x27, 0xC8, 0xEB,
-    0x0C, 0x06, 0x48, 0xCA, 0x34, 0x75, 0x17, 0x5C, 0x01, 0x16, 0x42, 0x27, 0xE3, 0xB7, 0x60, 0x81,
-    0x3D, 0xEC, 0xB4, 0x31, 0x72, 0x0E, 0x5A, 0x2B, 0xAE, 0x55, 0x1B, 0x77, 0xB0, 0x58, 0x6A, 0x6C,
-    0x46, 0xAB, 0xD1, 0x6E, 0x1E, 0x91, 0x97, 0xB6, 0x83, 0xF5, 0xA0, 0x4C, 0x58, 0xC1, 0x82, 0x70,
-    0xDE, 0x65, 0x86, 0x11, 0xD9, 0xB8, 0xB2, 0x4D, 0xC1, 0x83, 0x6C, 0x51, 0x34, 0x4B, 0x03, 0xA4,
-    0x88, 0xB7, 0x17, 0x38, 0xB8, 0x61, 0xFB, 0x3B, 0x51, 0x70, 0x4A, 0x1A, 0x14, 0x08, 0x92, 0xED,
-    0x91, 0x4C, 0x6D, 0x09, 0x2D, 0x2C, 0xF1, 0x20, 0xB2, 0xA0, 0xF6, 0xA6, 0x35, 0xAC, 0x44, 0x96,
-    0x84, 0xF0, 0xAB, 0x3E, 0x34, 0x3D, 0x63, 0x26, 0x0B, 0xDA, 0x05, 0x1B, 0xB8, 0x57, 0x3A, 0xFB,
-    0xB8, 0x74, 0xB0, 0x8C, 0x62, 0x2C, 0x63, 0xF0, 0xA7, 0xA0, 0x76, 0xC8, 0x59, 0xE4, 0x4E, 0x73,
-    0x02, 0x00, 0xFC, 0xB8, 0x4C, 0x04, 0xDB, 0xD5, 0x62, 0xB0, 0xD1, 0xB0, 0xE5, 0x7C, 0xB4, 0x5C,
-    0x6F, 0x4B, 0x2F, 0x2B, 0x04, 0x97, 0x62, 0x0A, 0x92, 0x55, 0x23, 0x68, 0xCD, 0x4A, 0x44, 0x4B,
-    0xE4, 0xD4, 0xCB, 0x2A, 0x31, 0xB3, 0x2E, 0x94, 0x22, 0xAB, 0x2B, 0x41, 0x10, 0x68, 0xAE, 0x88,
-    0x81, 0x11, 0x63, 0xC6, 0x44, 0x0D, 0xAE, 0x50, 0xE7, 0xF1, 0x84, 0xF4, 0x14, 0xA4, 0xC8, 0x59,
-    0x2F, 0x73, 0xD3, 0x03, 0x1B, 0x1D, 0x8C, 0xDA, 0xC8, 0x65, 0x17, 0x8C, 0x0B, 0xDE, 0x8C, 0x98,
-    0xDF, 0x28, 0x8B, 0x70, 0x8D, 0x86, 0x47, 0x1D, 0x5D, 0xE6, 0xDA, 0xB4, 0xD6, 0xE6, 0x87, 0x5C,
-    0xCE, 0x94, 0x6A, 0x87, 0x6F, 0x2E, 0x1D, 0x6D, 0x48, 0xE9, 0x9A, 0xAD, 0x62, 0x00, 0x74, 0xA2,
-    0x23, 0x25, 0xED, 0x8C, 0x3E, 0x71, 0x96, 0x84, 0x57, 0x3A, 0xEF, 0x57, 0x3A, 0x3B, 0xB8, 0x5A,
-    0xA5, 0x59, 0x1B, 0x17, 0x3B, 0x61, 0x79, 0xC9, 0x3B, 0xE8, 0x98, 0x9E, 0xF3, 0x4B, 0xA2, 0x4E,
-    0x15, 0xE1, 0x95, 0xE1, 0xD9, 0x5A, 0xDD, 0x69, 0x8D, 0x45, 0xE5, 0x01, 0x31, 0x9C, 0x1E, 0x0F,
-    0x7E, 0x1F, 0x3C, 0xCE, 0x54, 0x46, 0x20, 0xC9, 0xD3, 0x3A, 0x19, 0x54, 0xA3, 0x2A, 0x75, 0xAA,
-    0xF3, 0xBE, 0xA8, 0x12, 0xF5, 0x3E, 0x82, 0x0A, 0x4A, 0x20, 0x30, 0xF7, 0x32, 0xE9, 0x76, 0x24,
-    0xBA, 0x5A, 0xBF, 0xDA, 0xA9, 0x3E, 0x7E, 0x4D, 0xEF, 0x8E, 0xD1, 0x67, 0x7F, 0x1E, 0xB7, 0x16,
-    0x63, 0x47, 0x0B, 0x91, 0x1E, 0x9B, 0xE0, 0x0D, 0x1E, 0xEA, 0x0D, 0x77, 0xE0, 0x9A, 0xAC, 0xFA,
-    0x70, 0x22, 0x5D, 0xCF, 0x5B, 0x19, 0xB1, 0xDA, 0x1A, 0x9C, 0x6E, 0xCD, 0xE5, 0x41, 0x44, 0x78,
-    0x8B, 0xDE, 0xAF, 0x04, 0x6D, 0x66, 0x47, 0x6D, 0x59, 0xB3, 0x08, 0xD8, 0x76, 0x15, 0xF5, 0xDE,
-    0x3E, 0x81, 0xFB, 0x18, 0xBA, 0x24, 0x14, 0x32, 0x78, 0x05, 0x99, 0x54, 0x98, 0x82, 0x0C, 0x1B,
-    0xA4, 0x7C, 0xE0, 0x5D, 0x9F, 0x3E, 0x07, 0xB0, 0x51, 0xAD, 0xD7, 0x4F, 0x4D, 0x27, 0x53, 0x03,
-    0x65, 0xD7, 0x2C, 0xCC, 0xE8, 0x1A, 0x6C, 0x70, 0x51, 0x86, 0xDC, 0xF2, 0x61, 0xC6, 0x5B, 0x4A,
-    0xE7, 0xC8, 0x53, 0x61, 0xED, 0x55, 0x68, 0x54, 0x9E, 0x46, 0x27, 0x84, 0xEE, 0xE3, 0x13, 0xDB,
-    0x08, 0xB1, 0x96, 0xDB, 0xB9, 0x98, 0xB2, 0x93, 0x26, 0x72, 0x8B, 0xBF, 0x33, 0x1E, 0xC9, 0xAB,
-    0x74, 0x05, 0x77, 0x5A, 0x93, 0x50, 0x71, 0x11, 0x2E, 0x20, 0x28, 0x0B, 0x3F, 0x82, 0x38, 0xBA,
-    0xE2, 0xC4, 0xCE, 0xC9, 0xC0, 0x57, 0x36, 0xC0, 0xC5, 0xC3, 0xC4, 0x59, 0x49, 0x99, 0xD9, 0xD6,
-    0x49, 0x98, 0xEA, 0x0C, 0x82, 0xE9, 0x7D, 0xDC, 0x0A, 0x4E, 0x52, 0x6C, 0x9A, 0x80, 0x37, 0x21,
-    0x34, 0x46, 0xAB, 0xB6, 0x11, 0x4B, 0xFB, 0x51, 0x4A, 0x5A, 0x0B, 0x49, 0xDD, 0xB0, 0xFF, 0x65,
-    0x07, 0x6F, 0xCC, 0x75, 0xEC, 0x48, 0x30, 0xC4, 0xD1, 0xB0, 0x21, 0xFD, 0x49, 0xE9, 0xCE, 0x38,
-    0xDD, 0x45, 0xB7, 0x7D, 0x14, 0x12, 0x41, 0x12, 0xDF, 0xA0, 0x1D, 0x73, 0xB6, 0x64, 0xF6, 0x8E,
-    0x43, 0x9F, 0xE7, 0x04, 0xD5, 0x01, 0xA8, 0xA9, 0xCA, 0xC9, 0x52, 0xF4, 0x98, 0x61, 0xEB, 0xB4,
-    0x0D, 0x4D, 0x65, 0xC5, 0x80, 0x68, 0x48, 0x91, 0x1C, 0x0B, 0x6B, 0xF4, 0x60, 0x5F, 0x2B, 0x06,
-    0xFB, 0x6E, 0x12, 0x8E, 0x9E, 0xF1, 0x89, 0x1B, 0x39, 0xE1, 0x18, 0xC5, 0xD8, 0x09, 0x6E, 0x77,
-    0xE1, 0x8D, 0x2E, 0x2C, 0x2F, 0xFC, 0x36, 0x31, 0xBE, 0xCA, 0x61, 0x5F, 0xE2, 0x62, 0xF2, 0xA2,
-    0x8A, 0x03, 0x56, 0xD3, 0x40, 0xE4, 0xBF, 0xD9, 0x61, 0x6B, 0x60, 0x10, 0xBE, 0x66, 0x74, 0x28,
-    0xEA, 0x3E, 0xA7, 0xEA, 0xBA, 0x8A, 0x10, 0xFD, 0x8E, 0xCE, 0x54, 0xE3, 0x4C, 0x9F, 0x7E, 0x84,
-    0x26, 0x3C, 0x1C, 0x44, 0x27, 0xAB, 0xCD, 0xD5, 0xCB, 0x7C, 0x23, 0xDD, 0x90, 0x88, 0x90, 0x1A,
-    0x98, 0x38, 0xFA, 0xC1, 0xF4, 0xED, 0xDA, 0x96, 0x1C, 0x47, 0x5F, 0x08, 0x1E, 0xC7, 0xA6, 0xF2,
-    0xC5, 0x86, 0x78, 0xD3, 0x71, 0x86, 0x0C, 0x85, 0x54, 0x8F, 0x84, 0xF5, 0xB1, 0x50, 0x22, 0x67,
-    0x35, 0xD2, 0x36, 0xB8, 0xDA, 0x22, 0x5E, 0x3A, 0xB5, 0x0B, 0xDB, 0x5F, 0x1E, 0xCE, 0x21, 0x9D,
-    0x43, 0x34, 0x6C, 0x71, 0x92, 0xE3, 0x86, 0x9A, 0x63, 0x67, 0x45, 0xA6, 0x03, 0x51, 0x50, 0x1C,
-    0x74, 0x89, 0xE4, 0xC9, 0x7B, 0x03, 0x4F, 0xCB, 0x56, 0xE0, 0x21, 0x0B, 0x50, 0x4C, 0x2F, 0x46,
-    0x1E, 0xA9, 0xF3, 0xD8, 0xAD, 0x00, 0xC3, 0x4B, 0xED, 0xE9, 0xB7, 0x07, 0x19, 0x0E, 0x00, 0x22,
-    0xA8, 0x3F, 0x0D, 0xE8, 0x78, 0xD6, 0xB9, 0xA0, 0x42, 0xE8, 0xE6, 0x32, 0x95, 0x90, 0x15, 0xDD,
-    0x7E, 0xB6, 0x8E, 0x40, 0x85, 0xF2, 0xA6, 0x97, 0xB1, 0x28, 0xCC, 0x12, 0x07, 0xC4, 0x63, 0xE0,
-    0x52, 0x79, 0x7D, 0x54, 0x27, 0xEC, 0xF9, 0x0A, 0x7A, 0x80, 0x4A, 0x94, 0xE8, 0xD0, 0xD2, 0x01,
-    0x01, 0xEE, 0x5F, 0xAF, 0xD1, 0x55, 0xEE, 0xA4, 0xE7, 0x21, 0xF9, 0x6E, 0x47, 0x25, 0xA2, 0xCF,
-    0x2A, 0xF4, 0x6F, 0xFA, 0x92, 0xB8, 0xE0, 0x69, 0x94, 0x5C, 0x51, 0x09, 0x72, 0xCB, 0x94, 0xAD,
-    0x28, 0x27, 0xD6, 0xA8, 0x4A, 0xA5, 0x5F, 0x4F, 0xBD, 0x94, 0x19, 0x5B, 0x9B, 0xC6, 0xC6, 0x4C,
-    0x91, 0x6C, 0xF7, 0x6E, 0xE7, 0xD8, 0x47, 0xFF, 0x20, 0x15, 0xD0, 0xA3, 0x19, 0xFE, 0xBF, 0x63,
-    0x5B, 0x80, 0x27, 0x6D, 0x07, 0xBA, 0x18, 0x29, 0xB3, 0x04, 0x6D, 0x70, 0x45, 0xF7, 0xA0, 0x1A,
-    0xDB, 0x64, 0x19, 0x2B, 0xDF, 0xFF, 0xA7, 0xFB, 0xEE, 0x77, 0x4A, 0x39, 0x03, 0x1B, 0x7E, 0xC9,
-    0x22, 0x99, 0x18, 0xB0, 0x3E, 0x9A, 0x8D, 0xC5, 0x28, 0x89, 0xD0, 0xEA, 0xE8, 0xCF, 0x10, 0x8A,
-    0x73, 0x04, 0x1F, 0x1A, 0xFE, 0x1E, 0x6D, 0x45, 0xA5, 0x98, 0x65, 0xA8, 0x0A, 0x60, 0x12, 0x30,
-    0x83, 0xD3, 0xFD, 0x65, 0xE7, 0xEB, 0x37, 0xEA, 0xB8, 0x57, 0x89, 0x32, 0x37, 0xBA, 0x2C, 0x3D,
-    0x06, 0x77, 0x8D, 0x91, 0x4D, 0xCB, 0x11, 0xD0, 0xB2, 0x61, 0x06, 0x53, 0xAA, 0xA8, 0x8B, 0xCB,
-    0x13, 0xAA, 0x63, 0x51, 0x3E, 0xB8, 0xC5, 0x45, 0x9F, 0x45, 0x8D, 0x19, 0x38, 0x28, 0x45, 0xBA,
-    0x01, 0xF0, 0xA0, 0x60, 0x50, 0x9B, 0xD1, 0x29, 0x62, 0x1B, 0x4B, 0x3C, 0xC7, 0x37, 0x42, 0x26,
-    0x52, 0x2F, 0xCE, 0xC6, 0xE4, 0x3B, 0xC4, 0xF0, 0xC8, 0x97, 0xE1, 0x41, 0x6F, 0x3C, 0x48, 0xD1,
-    0xED, 0x9C, 0x3A, 0x36, 0x7E, 0x9D, 0x27, 0x26, 0x26, 0x1C, 0xFD, 0x4C, 0xA7, 0xF6, 0x81, 0x97,
-    0xF3, 0x81, 0x21, 0xA1, 0xCA, 0xDE, 0x47, 0x4B, 0x02, 0xCB, 0xA0, 0x2B, 0xCC, 0x7A, 0xAF, 0x85,
-    0xBC, 0x64, 0xFB, 0x71, 0x31, 0xF7, 0x9A, 0xB0, 0x34, 0xA5, 0x3B, 0xCE, 0x5C, 0x08, 0x02, 0xEA,
-    0xE3, 0xB3, 0xD3, 0xD9, 0x1E, 0x27, 0x8D, 0x31, 0x2B, 0x8F, 0x5E, 0xDD, 0xDB, 0x38, 0xFA, 0x2F,
-    0x62, 0x26, 0x89, 0x3E, 0xFA, 0x12, 0x47, 0x3F, 0xAD, 0x8B, 0xB4, 0x80, 0xE5, 0x11, 0x02, 0x37,
-    0x34, 0x38, 0x13, 0xA8, 0x61, 0xFC, 0x5F, 0x80, 0x96, 0x01, 0x88, 0xC3, 0x3F, 0xBC, 0x9E, 0x14,
-    0x0D, 0x7D, 0x69, 0xD0, 0xAA, 0xD2, 0xD1, 0xE0, 0x0F, 0x69, 0x19, 0x0E, 0x79, 0x63, 0x06, 0xEC,
-    0xB6, 0xB4, 0xF3, 0x27, 0xD2, 0x05, 0x57, 0x31, 0x3B, 0x70, 0x63, 0xBB, 0x85, 0xAB, 0x71, 0xF1,
-    0xEB, 0xF0, 0xA4, 0xBA, 0x8C, 0x60, 0x56, 0x59, 0xBC, 0xDB, 0x78, 0x2D, 0xDC, 0xF8, 0x6C, 0xE3,
-    0xD7, 0x08, 0x6A, 0xAF, 0x4F, 0x8B, 0x88, 0x03, 0x9E, 0x66, 0x7C, 0xC6, 0x36, 0xF8, 0x09, 0xB8,
-    0x39, 0xF8, 0x75, 0x37, 0xEE, 0x80, 0x1D, 0x9F, 0x64, 0xFE, 0x07, 0xA8, 0x43, 0x50, 0x05, 0xB4,
-    0x21, 0x6A, 0xA2, 0x0E, 0xE0, 0xA7, 0x4A, 0xB8, 0x65, 0x00, 0x83, 0x88, 0x3F, 0xE9, 0x97, 0xE2,
-    0x9A, 0x3F, 0xD4, 0xC7, 0xA4, 0x8A, 0xF8, 0x23, 0x3F, 0x0F, 0xEE, 0x58, 0xC7, 0xB5, 0x8F, 0xB4,
-    0xBC, 0xA5, 0x13, 0x9F, 0x8F, 0x08, 0x16, 0x63, 0x57, 0x2C, 0xE7, 0x54, 0x7F, 0x22, 0xF1, 0x5B,
-    0x05, 0x87, 0x90, 0x6E, 0x2B, 0xF7, 0x2E, 0xBA, 0xC9, 0xF5, 0x6F, 0xBB, 0x2C, 0xF2, 0x24, 0xCD,
-    0xD7, 0xC8, 0x6D, 0x51, 0xB7, 0x1E, 0x74, 0xA6, 0xB5, 0x1E, 0x7E, 0xC7, 0x1A, 0xDD, 0x31, 0xD3,
-    0x76, 0x68, 0xE0, 0x68, 0xD0, 0x04, 0x5A, 0xBD, 0x02, 0xDF, 0xC9, 0x5F, 0xA3, 0x0A, 0x20, 0x07,
-    0x30, 0x32, 0xF4, 0xA8, 0xC8, 0xB2, 0x9E, 0xA1, 0x0E, 0xF8, 0x28, 0xAE, 0x68, 0x77, 0xC9, 0x0B,
-    0xC0, 0x30, 0x95, 0x70, 0xCC, 0x20, 0x70, 0x61, 0x78, 0x91, 0x64, 0x53, 0xFC, 0x5D, 0x30, 0xEA,
-    0x38, 0xF1, 0x6E, 0xA3, 0x39, 0x0A, 0x13, 0x79, 0xE9, 0xA9, 0xC5, 0x44, 0x2A, 0xA6, 0x9F, 0x3B,
-    0xEA, 0x82, 0x94, 0x42, 0xDC, 0xC7, 0x68, 0xF2, 0x73, 0xF0, 0xDB, 0x16, 0x3C, 0xBD, 0x4C, 0x93,
-    0x14, 0xDD, 0x7F, 0x43, 0x6D, 0xD8, 0x00, 0xF9, 0x8B, 0x02, 0xF0, 0x37, 0x6F, 0xCE, 0xC8, 0x5B,
-    0xF0, 0x83, 0xAE, 0x0A, 0x3F, 0xAD, 0x37, 0xE0, 0xD2, 0x93, 0x1E, 0x67, 0xD3, 0xA1, 0xCB, 0x4E,
-    0xDC, 0xCB, 0xB4, 0x49, 0xE6, 0x3C, 0x61, 0xE8, 0xD1, 0xD4, 0xBA, 0xA2, 0xB0, 0x9A, 0x9B, 0x04,
-    0x1C, 0x64, 0x0E, 0xE6, 0x6B, 0x55, 0xE0, 0xEB, 0x75, 0x62, 0x02, 0xAC, 0xA3, 0xB9, 0x5F, 0x90,
-    0xA9, 0x3B, 0xF9, 0xCD, 0xBF, 0x2D, 0x39, 0x5E, 0xD5, 0xBC, 0x5E, 0x2F, 0xF7, 0x68, 0x60, 0xFA,
-    0x4D, 0x40, 0x09, 0x6D, 0x33, 0xA4, 0x83, 0xDF, 0xA6, 0x4D, 0xCA, 0x81, 0xDC, 0x39, 0x4A, 0x4D,
-    0x1F, 0x9C, 0x07, 0x2E, 0xAA, 0x9F, 0x14, 0x78, 0x03, 0xC0, 0x24, 0xE9, 0xF6, 0x11, 0x95, 0xE8,
-    0xEC, 0x84, 0xBA, 0xA6, 0x7F, 0xD9, 0x45, 0xFA, 0xBA, 0xAE, 0x7D, 0xA0, 0xE8, 0x5D, 0x25, 0x8C,
-    0xBB, 0x78, 0x94, 0x82, 0xA4, 0x97, 0xBB, 0x43, 0xCB, 0x6D, 0xBC, 0x17, 0xCC, 0xBE, 0x07, 0xBA,
-    0x88, 0x21, 0x2F, 0x9D, 0xF8, 0xB2, 0x26, 0x0D, 0x05, 0xE3, 0xC8, 0xB8, 0xAF, 0x81, 0x3F, 0x72,
-    0x54, 0xF6, 0xE0, 0x76, 0x6E, 0xC7, 0x9A, 0x21, 0x1C, 0x0D, 0xD2, 0x0A, 0x5B, 0xEE, 0xA2, 0x7C,
-    0x03, 0x5E, 0x70, 0x9D, 0x06, 0x65, 0x0D, 0x7A, 0x74, 0xA0, 0x31, 0x28, 0xDA, 0xD4, 0x5A, 0x8E,
-    0x7B, 0x79, 0xDE, 0xFF, 0xDD, 0xCB, 0x5B, 0x3F, 0xE2, 0xF7, 0xD1, 0xAE, 0x7E, 0xBB, 0x0E, 0xAE,
-    0x77, 0xEE, 0xC1, 0x9B, 0x94, 0x05, 0x26, 0x8B, 0x2A, 0xD3, 0x50, 0xDA, 0x5D, 0xBD, 0xD4, 0xB0,
-    0x0D, 0x33, 0x05, 0xFB, 0xE6, 0x07, 0x09, 0x0D, 0x93, 0xF9, 0xFA, 0x56, 0x2F, 0xDF, 0x20, 0x49,
-    0xE6, 0x82, 0x5E, 0xCB, 0xCD, 0x98, 0x44, 0x13, 0xBE, 0x4A, 0xC9, 0x1F, 0xB1, 0xDB, 0x01, 0x86,
-    0x52, 0x47, 0xFF, 0x59, 0x8F, 0x81, 0x77, 0xA5, 0xB7, 0x9A, 0xA4, 0x59, 0x5E, 0xA6, 0x48, 0xD6,
-    0x37, 0x74, 0x3D, 0xF6, 0x05, 0xF2, 0xF0, 0x34, 0x34, 0x8A, 0xF9, 0x47, 0xB5, 0x3A, 0x34, 0x3A,
-    0x82, 0x12, 0xF4, 0x61, 0x17, 0x0E, 0x69, 0x01, 0xF9, 0x64, 0x7E, 0x33, 0x61, 0xB5, 0x80, 0xCD,
-    0x20, 0x20, 0x49, 0x2B, 0x1E, 0x4C, 0x2B, 0xA6, 0x16, 0x76, 0xC7, 0x02, 0xFA, 0x03, 0x5B, 0xCF,
-    0x5A, 0xB3, 0x87, 0xCA, 0x02, 0xB4, 0xBE, 0x64, 0x0E, 0x60, 0xE9, 0xFE, 0xE5, 0xD6, 0xB6, 0x3F,
-    0x86, 0x55, 0x8C, 0xB3, 0xE4, 0x43, 0xB2, 0xFB, 0xDD, 0x43, 0xE5, 0x72, 0x1A, 0x2A, 0x27, 0xEB,
-    0x11, 0x02, 0x08, 0x4A, 0xC5, 0x69, 0x1D, 0xFC, 0xCF, 0x96, 0x37, 0x18, 0x9D, 0xD2, 0x6C, 0xB4,
-    0x33, 0x54, 0xA2, 0x9B, 0x72, 0xCB, 0xEE, 0x16, 0xDE, 0xE3, 0x07, 0x51, 0x6B, 0x86, 0x58, 0xD3,
-    0xA4, 0xF5, 0xDD, 0x6D, 0xB8, 0x03, 0x20, 0x0E, 0xE0, 0x2F, 0x63, 0x7C, 0xBF, 0xE3, 0x75, 0x6E,
-    0x19, 0xE0, 0xDE, 0xA8, 0xB7, 0xA8, 0x1D, 0xD3, 0x56, 0x6C, 0xC1, 0x3A, 0xAF, 0x08, 0x51, 0x12,
-    0xE2, 0x02, 0x78, 0xE3, 0x0D, 0xA7, 0x9B, 0x50, 0x13, 0x74, 0xAA, 0x65, 0x44, 0xBA, 0x85, 0x69,
-    0x66, 0x70, 0xDF, 0x25, 0x43, 0x02, 0xEE, 0x5F, 0x6C, 0xF5, 0x72, 0xFB, 0xB0, 0x0C, 0x3F, 0xAC,
-    0xE9, 0x22, 0xAC, 0x0D, 0x11, 0xCC, 0xC0, 0xAA, 0x71, 0x65, 0x70, 0xEB, 0x38, 0xD3, 0xA7, 0x0B,
-    0xC5, 0x3D, 0x9A, 0x95, 0x63, 0x0D, 0x3B, 0x5C, 0x10, 0xFE, 0x40, 0x20, 0x7C, 0x58, 0xCB, 0x2B,
-    0x6E, 0xF6, 0x47, 0x15, 0x76, 0xD3, 0x6E, 0x74, 0x95, 0x72, 0xB6, 0x93, 0x93, 0xA1, 0x3C, 0xE1,
-    0x16, 0xD3, 0xA0, 0x9E, 0x63, 0x71, 0x20, 0x21, 0xA9, 0x02, 0x9B, 0x8B, 0x94, 0x23, 0x40, 0x5E,
-    0x79, 0x1F, 0x22, 0x14, 0xE5, 0xA8, 0x4F, 0x85, 0x9B, 0x2E, 0xE3, 0x74, 0xC2, 0xFD, 0xC0, 0xEC,
-    0x94, 0x05, 0x9A, 0xED, 0xFA, 0x8E, 0xDB, 0xB9, 0x75, 0x58, 0x07, 0x09, 0x37, 0x21, 0x89, 0x9D,
-    0x39, 0x6C, 0x91, 0xB3, 0x79, 0x6B, 0xB9, 0x31, 0x19, 0x22, 0x29, 0x76, 0x0C, 0x3A, 0x75, 0xE1,
-    0x7E, 0x5A, 0x2A, 0xB3, 0x2F, 0x69, 0xB5, 0x0A, 0x32, 0xEB, 0xA6, 0x0D, 0xCB, 0xFE, 0x62, 0x78,
-    0x66, 0x7B, 0xDC, 0x88, 0x01, 0x1B, 0x07, 0x86, 0x9D, 0x81, 0xDD, 0x3C, 0xC2, 0x6B, 0xC6, 0x3D,
-    0xA4, 0xA8, 0x81, 0x30, 0xB1, 0xDB, 0xAA, 0x6B, 0xB5, 0xB2, 0xBB, 0x1E, 0x66, 0xEB, 0x84, 0xFE,
-    0x3E, 0xC1, 0x98, 0x05, 0x69, 0x38, 0x3A, 0xCD, 0x06, 0x60, 0x47, 0xEE, 0x8E, 0xFA, 0x7B, 0x85,
-    0xC5, 0x89, 0xF7, 0x97, 0x82, 0xC3, 0x90, 0x10, 0xBE, 0x71, 0x7A, 0xB7, 0xA6, 0xE4, 0xB4, 0x24,
-    0x2F, 0x71, 0x58, 0x41, 0x28, 0x3A, 0x4D, 0xC9, 0x62, 0x0B, 0x70, 0xA6, 0xEC, 0xB4, 0x25, 0xC0,
-    0xA9, 0x50, 0x37, 0x61, 0x1F, 0x53, 0x60, 0x47, 0x63, 0x7E, 0xCB, 0xCB, 0xBC, 0x12, 0x50, 0xBF,
-    0x61, 0x50, 0x88, 0x49, 0xB4, 0x6C, 0xC8, 0x21, 0x3F, 0x1C, 0x0F, 0x05, 0x48, 0xE6, 0x68, 0xCF,
-    0xA8, 0x35, 0xDB, 0x60, 0x08, 0x40, 0xE8, 0x40, 0xD7, 0x43, 0x09, 0x0F, 0x4F, 0x1B, 0xB5, 0x58,
-    0x9B, 0xCD, 0x66, 0x9C, 0x8D, 0x7E, 0x8C, 0x57, 0xD3, 0x46, 0xE5, 0xCE, 0xD9, 0xA0, 0x8E, 0x43,
-    0x58, 0xEC, 0xE9, 0x64, 0x70, 0xC6, 0xAD, 0xAC, 0x69, 0x42, 0xD0, 0x8D, 0xFD, 0xFD, 0xB4, 0xE9,
-    0x35, 0xED, 0x3F, 0x33, 0xB3, 0x02, 0x3D, 0xD6, 0x2E, 0x9A, 0x96, 0x18, 0x64, 0x18, 0x64, 0x24,
-    0xD6, 0xB8, 0x36, 0x2E, 0xD7, 0x18, 0xAC, 0x66, 0x94, 0x85, 0xAB, 0xB5, 0xBE, 0x9C, 0xFE, 0x13,
-    0x22, 0x97, 0xA3, 0x2C, 0x64, 0x1A, 0xEF, 0xC1, 0x57, 0xA9, 0xFF, 0xAA, 0x1E, 0x90, 0x8F, 0xB6,
-    0x3D, 0xF8, 0x47, 0xE2, 0x05, 0x1C, 0x84, 0xC6, 0xAE, 0x59, 0x6C, 0xE6, 0xFB, 0xD9, 0x49, 0x34,
-    0x8B, 0xE7, 0xE0, 0xC0, 0xF9, 0xB8, 0x5F, 0x75, 0x72, 0xB1, 0xE9, 0xB9, 0xC5, 0x02, 0x70, 0x8A,
-    0xEA, 0x54, 0xE9, 0xF7, 0x6E, 0x37, 0xE8, 0xD8, 0x4F, 0x84, 0xF5, 0xC9, 0x35, 0xAF, 0x5D, 0x1B,
-    0xC7, 0x23, 0xAB, 0x92, 0xB7, 0xBF, 0x3E, 0x33, 0x61, 0x3B, 0xC0, 0x9D, 0x12, 0x5B, 0xD1, 0x1F,
-    0x32, 0x3B, 0xF2, 0x20, 0xAC, 0xC7, 0x6A, 0x39, 0xF7, 0x5D, 0x36, 0x54, 0x21, 0x9B, 0x25, 0xC4,
-    0x51, 0xBD, 0x36, 0x6C, 0x9A, 0x63, 0x13, 0xE4, 0x7E, 0x06, 0xD2, 0x06, 0x7B, 0x8C, 0xE2, 0x72,
-    0x85, 0xBA, 0xE7, 0xA0, 0x3E, 0xC6, 0xCD, 0xEF, 0x68, 0x5C, 0x37, 0xFF, 0xA5, 0xDD, 0xB5, 0xFE,
-    0xD3, 0x3E, 0xF9, 0x3A, 0xE3, 0xFE, 0x06, 0xF3, 0x21, 0x37, 0x03, 0x54, 0xD4, 0xAF, 0x30, 0x1F,
-    0xB2, 0x8E, 0x27, 0x6F, 0x3E, 0x67, 0x78, 0x01, 0x03, 0xDC, 0xDD, 0x76, 0xD9, 0x04, 0x39, 0xB3,
-    0xCD, 0xE3, 0xB3, 0x18, 0x2D, 0x74, 0x9F, 0xF6, 0xAE, 0xDE, 0x36, 0x85, 0x75, 0x00, 0x8B, 0x35,
-    0x23, 0xF3, 0x98, 0x27, 0x67, 0x34, 0xE9, 0x38, 0x99, 0x2C, 0xC0, 0x6D, 0xCE, 0x7D, 0xEE, 0xC6,
-    0xE5, 0x50, 0x9F, 0xD5, 0x80, 0xC3, 0xF2, 0x16, 0x70, 0x19, 0x17, 0x8E, 0xB6, 0x1B, 0x9F, 0xD5,
-    0xEA, 0xE1, 0x08, 0x37, 0x81, 0x6E, 0x6F, 0x24, 0xDE, 0x5E, 0x27, 0x0F, 0x71, 0x0E, 0x71, 0x64,
-    0x0A, 0xCE, 0x00, 0x9D, 0x47, 0x3A, 0x52, 0x71, 0x25, 0x9D, 0x99, 0x2F, 0xDB, 0x8E, 0x44, 0xBA,
-    0xA0, 0xF6, 0x6B, 0x60, 0xEB, 0xEB, 0xFA, 0x5B, 0x7A, 0x47, 0x7F, 0xA1, 0x77, 0xB5, 0xDF, 0x05,
-    0xD5, 0x24, 0xAA, 0xD8, 0xDD, 0xED, 0x5C, 0xAF, 0x54, 0x63, 0x8E, 0x8B, 0x9E, 0xE7, 0xCC, 0xF6,
-    0xB4, 0x4E, 0xF2, 0x4F, 0xAD, 0x58, 0x99, 0xDB, 0x9A, 0xC1, 0x3E, 0xDC, 0xC2, 0xCC, 0x11, 0xB6,
-    0xD6, 0x7E, 0xCD, 0x73, 0x06, 0x19, 0x04, 0xE9, 0x19, 0x66, 0xA3, 0x4E, 0x1C, 0x6E, 0xC4, 0xBC,
-    0x2E, 0xB5, 0xDB, 0x8D, 0xCC, 0x92, 0xC5, 0x80, 0x2F, 0xB6, 0xC7, 0xB0, 0x96, 0x5B, 0xDE, 0xA8,
-    0x04, 0xD1, 0x55, 0x9D, 0x0D, 0x86, 0xDE, 0xD4, 0x76, 0x96, 0x3F, 0xF7, 0x5A, 0x72, 0x65, 0xB0,
-    0x68, 0x98, 0xBD, 0x73, 0xDB, 0xF4, 0xF6, 0x8F, 0x0F, 0x7E, 0xA6, 0x55, 0xA7, 0xA0, 0xC6, 0x7C,
-    0x32, 0x04, 0x73, 0x80, 0xA4, 0x2D, 0x35, 0xD3, 0x06, 0x96, 0xCB, 0xD9, 0xE1, 0xDB, 0xFF, 0x88,
-    0xD9, 0x7F, 0x15, 0x6F, 0x9F, 0xA3, 0xA6, 0x42, 0x8E, 0x7E, 0xFA, 0x87, 0xD9, 0x5F, 0xFE, 0x8C,
-    0xA5, 0x8C, 0xA6, 0x7F, 0xE2, 0x09, 0xBC, 0xD5, 0xE8, 0xE4, 0xDD, 0x6B, 0xC5, 0x98, 0x7B, 0x08,
-    0x63, 0x6E, 0xC3, 0x6C, 0xE5, 0x20, 0x4B, 0x5F, 0xEA, 0x26, 0x18, 0x92, 0x55, 0x8B, 0x0F, 0xB4,
-    0x38, 0x4F, 0x76, 0x4C, 0x72, 0x8F, 0x0E, 0xE2, 0x41, 0x10, 0x65, 0xD9, 0x1C, 0x0A, 0x55, 0xE5,
-    0xF2, 0x3A, 0x5F, 0x9B, 0x23, 0x09, 0x44, 0xB4, 0x65, 0x89, 0x63, 0x75, 0x8B, 0x90, 0x05, 0xF5,
-    0x7B, 0xE2, 0xBD, 0x86, 0x3A, 0x7B, 0x1A, 0xFF, 0xAD, 0xCD, 0xC8, 0x6E, 0x9D, 0x33, 0x49, 0xFF,
-    0xB6, 0x9E, 0xE4, 0xE7, 0xB8, 0x18, 0xCC, 0x6E, 0xF2, 0x51, 0x5C, 0x44, 0xA0, 0x03, 0xF3, 0xA8,
-    0xFB, 0xFB, 0xE1, 0x0B, 0xFD, 0x33, 0x1D, 0x82, 0xF6, 0xC4, 0xD9, 0xCA, 0x59, 0x8C, 0x57, 0x02,
-    0x0E, 0x42, 0x48, 0x8C, 0x4F, 0x03, 0x5F, 0x6E, 0x40, 0x95, 0xA7, 0xFC, 0x64, 0xB1, 0xAB, 0x74,
-    0x58, 0xEA, 0x48, 0x86, 0x55, 0xCF, 0x17, 0x72, 0x4E, 0x89, 0xF7, 0x39, 0x10, 0x1C, 0x3D, 0xF1,
-    0x85, 0x97, 0x26, 0xBE, 0x7F, 0x4F, 0xEA, 0x1C, 0x9F, 0x39, 0xB3, 0xBF, 0xD2, 0x5D, 0xA8, 0xAF,
-    0xE9, 0x32, 0xDE, 0xBF, 0x2B, 0x5E, 0x38, 0x95, 0x0C, 0x79, 0x2E, 0x65, 0x14, 0x6D, 0x0A, 0xAF,
-    0x24, 0x5E, 0x24, 0x06, 0x8F, 0xE6, 0x04, 0xBC, 0x2E, 0x32, 0x1B, 0xEE, 0x24, 0x80, 0x31, 0x0B,
-    0x90, 0x19, 0x8E, 0x12, 0xBC, 0x0D, 0xA9, 0xF3, 0xEE, 0x24, 0xE3, 0x01, 0x3C, 0xE7, 0xDE, 0xD2,
-    0x81, 0xED, 0xFB, 0x7B, 0x78, 0x44, 0x62, 0xB7, 0x11, 0x87, 0xC4, 0x6E, 0x55, 0x2E, 0xC9, 0xB5,
-    0x63, 0x63, 0x37, 0x35, 0xC0, 0x6B, 0xCE, 0x15, 0xA1, 0xA6, 0x9A, 0xCF, 0x2E, 0xBA, 0xD3, 0x55,
-    0x1C, 0x76, 0xCB, 0xF1, 0x2D, 0x20, 0x74, 0x1B, 0xE8, 0x2B, 0xBA, 0x8A, 0xB2, 0xB8, 0x09, 0xE8,
-    0x0C, 0xB4, 0x23, 0xC8, 0xF5, 0x38, 0xF3, 0x1B, 0x70, 0x10, 0x26, 0xBE, 0x2E, 0xB8, 0x5F, 0x13,
-    0x73, 0x33, 0x52, 0x3D, 0x73, 0xFD, 0x4A, 0x03, 0xA8, 0xDF, 0x61, 0x3B, 0xAD, 0x7E, 0x7C, 0xEA,
-    0xA7, 0x68, 0xA9, 0xEE, 0xD4, 0x3B, 0x6C, 0x6F, 0xE7, 0xC1, 0x1E, 0x7B, 0xB3, 0x22, 0xE7, 0x51,
-    0xA6, 0x16, 0x2D, 0x1D, 0x80, 0xD8, 0x0C, 0x8B, 0x43, 0x5A, 0x89, 0x84, 0x5B, 0xAD, 0xA0, 0xCD,
-    0xDA, 0xB4, 0x2D, 0x40, 0xEE, 0xC3, 0x49, 0xB8, 0xF8, 0x60, 0x49, 0xE0, 0x31, 0x53, 0x50, 0x39,
-    0xB2, 0x8E, 0xEE, 0xD9, 0xFF, 0x5C, 0xBF, 0x8A, 0x9E, 0x1A, 0xA4, 0x23, 0xCE, 0x3A, 0x4E, 0x8B,
-    0x1B, 0xF5, 0x5A, 0x1D, 0xDC, 0xD0, 0x61, 0x16, 0xBD, 0xD1, 0x9D, 0x95, 0x0D, 0xF5, 0x45, 0x2D,
-    0x77, 0x6E, 0x5D, 0x4F, 0x3C, 0x1D, 0x23, 0x3A, 0x9A, 0x1C, 0x12, 0x7E, 0x0F, 0x0F, 0x6C, 0xFD,
-    0xBB, 0xCE, 0x97, 0x1A, 0x3A, 0x4D, 0x3F, 0x90, 0xF1, 0x46, 0x57, 0x50, 0x63, 0xAA, 0xFB, 0x17,
-    0xA8, 0xB1, 0x95, 0xEA, 0x10, 0xE9, 0x99, 0xA5, 0x68, 0x90, 0x3C, 0x76, 0x42, 0x73, 0x7B, 0x36,
-    0x80, 0x03, 0x15, 0xA7, 0xC3, 0x0D, 0x9C, 0x2B, 0x73, 0xBE, 0x6C, 0x5D, 0x46, 0x9A, 0x63, 0xF4,
-    0xA1, 0x55, 0x59, 0x54, 0xCC, 0xD0, 0xD3, 0x6C, 0x1A, 0xD8, 0x3A, 0x37, 0xED, 0x60, 0x1B, 0x2A,
-    0xF2, 0xAB, 0xCA, 0x8C, 0xF8, 0xE5, 0xE2, 0x03, 0xCB, 0x46, 0x34, 0x46, 0x63, 0x17, 0x73, 0xD7,
-    0x3A, 0x37, 0x45, 0x86, 0xCB, 0xA1, 0xD8, 0xCD, 0x39, 0x6A, 0x7C, 0x1D, 0xCC, 0xFC, 0x13, 0x3C,
-    0xB3, 0x63, 0x6F, 0x06, 0x02, 0x19, 0x76, 0x23, 0x2C, 0x0C, 0xE3, 0x96, 0x00, 0x4C, 0x58, 0xA5,
-    0xE6, 0x08, 0x91, 0x21, 0x89, 0x6E, 0xBB, 0xA4, 0x9B, 0xE8, 0x1B, 0xA2, 0xAB, 0x10, 0xB9, 0x05,
-    0x58, 0xAE, 0xD9, 0xFD, 0x22, 0x13, 0xCD, 0xCF, 0xEA, 0x5A, 0x77, 0xAA, 0xF5, 0x07, 0x9E, 0xA7,
-    0x4A, 0x82, 0xDA, 0xEC, 0x79, 0x99, 0x06, 0x9C, 0x87, 0xBD, 0x4A, 0xC3, 0x50, 0xC7, 0x3D, 0x87,
-    0x62, 0xA4, 0x1A, 0xAC, 0x99, 0xC1, 0xA4, 0x1A, 0x75, 0x0C, 0x0D, 0x20, 0x2E, 0x7B, 0xDA, 0xEF,
-    0x8E, 0xE2, 0xD0, 0xA6, 0x6C, 0x20, 0x1E, 0x9B, 0x42, 0x6A, 0xB6, 0xC9, 0xB6, 0x94, 0x7B, 0xAA,
-    0x05, 0xB2, 0xA4, 0x44, 0x3B, 0x59, 0xB9, 0x3C, 0xF2, 0x65, 0x50, 0x86, 0x2F, 0xCE, 0xDE, 0xCD,
-    0xAB, 0xB5, 0xAE, 0xF7, 0x3B, 0xA7, 0x84, 0x5D, 0x3B, 0x68, 0x79, 0xCE, 0x1B, 0x66, 0x68, 0xA0,
-    0x78, 0xAB, 0x5E, 0x25, 0xE5, 0x3C, 0x08, 0x0A, 0xD2, 0x43, 0xE6, 0xDD, 0xDB, 0x2C, 0xCA, 0xA6,
-    0x10, 0x89, 0x1B, 0x1E, 0x04, 0x2A, 0xE6, 0xA8, 0xD0, 0x59, 0x2F, 0x2F, 0xC1, 0x8C, 0x01, 0x02,
-    0xB2, 0x31, 0xF4, 0x3D, 0x4E, 0xB2, 0xA0, 0x8A, 0x5C, 0x7D, 0x80, 0x92, 0xA6, 0xBD, 0x1B, 0x13,
-    0x35, 0x5F, 0x1B, 0x27, 0x7D, 0xE6, 0x68, 0x4C, 0x2B, 0x8B, 0xC6, 0x08, 0xDC, 0x82, 0x03, 0x88,
-    0x8E, 0x87, 0x8A, 0x98, 0xCE, 0xC9, 0x06, 0xB4, 0x0B, 0x40, 0x1D, 0xAD, 0x5D, 0xF8, 0xE2, 0xF4,
-    0xC9, 0xBC, 0x2A, 0x7B, 0x4E, 0x2F, 0xAA, 0xD1, 0xD9, 0xD4, 0x3C, 0x50, 0xE8, 0xB4, 0xE1, 0xFE,
-    0xAC, 0x67, 0x2F, 0xCE, 0x2D, 0xF1, 0x6C, 0xC9, 0xD1, 0x95, 0x1D, 0x83, 0x9D, 0x5B, 0x39, 0x01,
-    0x7A, 0x2F, 0x42, 0x4F, 0xE7, 0x04, 0x3B, 0xD8, 0x81, 0xE9, 0x6C, 0x98, 0x70, 0x7C, 0x58, 0x46,
-    0x7F, 0xDC, 0xCF, 0xBC, 0xCB, 0x8D, 0x6C, 0x9C, 0x35, 0x6D, 0x16, 0x7B, 0xDE, 0x1F, 0x4E, 0xC1,
-    0xEB, 0xEA, 0x53, 0x45, 0xAA, 0xBB, 0x60, 0x4F, 0xCB, 0xFB, 0x61, 0xE9, 0x7B, 0x93, 0xD4, 0x56,
-    0x85, 0xFB, 0x64, 0xEE, 0xD4, 0xB1, 0xCE, 0x61, 0x88, 0x7A, 0x23, 0x9A, 0x86, 0x5A, 0xDF, 0xE4,
-    0x29, 0x30, 0x7B, 0xEA, 0x1B, 0x00, 0xD1, 0x9E, 0x18, 0x27, 0xAD, 0xCC, 0x1F, 0x13, 0x6D, 0xDC,
-    0xBF, 0xB2, 0x47, 0x3D, 0xBA, 0x69, 0x74, 0x68, 0x5A, 0xBE, 0x7E, 0x9A, 0x21, 0x72, 0x47, 0xC3,
-    0x1C, 0x42, 0x59, 0x5E, 0x9E, 0x4E, 0xE7, 0x98, 0x4D, 0x47, 0x0E, 0x13, 0xBA, 0xAF, 0xB2, 0x87,
-    0xDA, 0x2B, 0xC7, 0xCD, 0x45, 0xD3, 0x7A, 0xFE, 0x2F, 0x1D, 0x90, 0xBD, 0x52, 0xC2, 0x40, 0x14,
-    0x85, 0x4F, 0x7E, 0x74, 0x67, 0xD8, 0xC1, 0xA4, 0xA0, 0x12, 0xC7, 0x58, 0x5A, 0x20, 0xB1, 0xA4,
-    0xD8, 0xB0, 0x71, 0x78, 0x01, 0x0A, 0xA8, 0x7D, 0x03, 0xC6, 0x92, 0x02, 0x49, 0xD4, 0x82, 0xC2,
-    0x42, 0xDE, 0x40, 0x1F, 0x81, 0x82, 0xC2, 0x22, 0x4A, 0x20, 0xCE, 0x58, 0x9A, 0xB1, 0xB5, 0x70,
-    0xA9, 0x6D, 0x56, 0xA5, 0x48, 0x11, 0x58, 0x83, 0xB7, 0xFB, 0x66, 0xEE, 0x99, 0xF3, 0xDD, 0x5B,
-    0x21, 0x71, 0x60, 0x64, 0x34, 0x3E, 0x40, 0x31, 0x0D, 0x3A, 0xCF, 0x39, 0x89, 0x8F, 0x80, 0x0A,
-    0x02, 0x70, 0xD1, 0x1C, 0x70, 0xEB, 0x1E, 0x29, 0xB0, 0xEB, 0x9F, 0x6D, 0x6A, 0x4D, 0x95, 0x8C,
-    0x56, 0x30, 0xE1, 0xAA, 0x37, 0xB5, 0xEC, 0xB6, 0x6D, 0x4C, 0xC9, 0xBA, 0x17, 0xE4, 0xD5, 0xB1,
-    0x19, 0xA8, 0xB5, 0x0D, 0x68, 0x32, 0xE2, 0xE7, 0xC9, 0x77, 0x66, 0x02, 0xD5, 0x77, 0xF5, 0x69,
-    0x75, 0x18, 0x4D, 0x1F, 0xB5, 0x22, 0x4D, 0x84, 0x93, 0x33, 0xD6, 0xA8, 0x79, 0x7D, 0x57, 0x6A,
-    0x3E, 0x42, 0x9F, 0x8E, 0xE2, 0x21, 0x37, 0x7E, 0x64, 0xD3, 0x81, 0xB8, 0xD8, 0x16, 0x9F, 0xD2,
-    0x1E, 0x7D, 0xFD, 0x88, 0x55, 0xEC, 0xA4, 0xFA, 0x18, 0xB0, 0xFB, 0xD3, 0x28, 0x63, 0x83, 0x13,
-    0xAF, 0xBC, 0xD5, 0xEA, 0x68, 0x6A, 0xA1, 0x32, 0x51, 0xB7, 0xF5, 0x02, 0x98, 0xA5, 0x0B, 0xCF,
-    0x10, 0x1C, 0x3E, 0x49, 0x67, 0x86, 0xF4, 0xE8, 0x42, 0x1E, 0xA3, 0xEE, 0xDE, 0x25, 0x22, 0xB2,
-    0xB4, 0xB0, 0xD2, 0xF4, 0x06, 0x8F, 0xD2, 0x26, 0x61, 0x64, 0x2D, 0x24, 0xD3, 0x80, 0xFA, 0x6C,
-    0xD3, 0x2F, 0xE9, 0xAD, 0x55, 0xCE, 0x9D, 0x79, 0xF8, 0x50, 0x6A, 0x6D, 0x26, 0x5F, 0x7B, 0x41,
-    0xDC, 0xDE, 0x6D, 0xC9, 0x8C, 0x79, 0x26, 0x68, 0xB8, 0x36, 0xD2, 0xC8, 0xD5, 0x7D, 0x0D, 0x82,
-    0x91, 0xF0, 0xF9, 0x26, 0x37, 0xB1, 0x4F, 0x13, 0x99, 0x5D, 0xBA, 0xFE, 0xFF, 0x13, 0x7C, 0x2E,
-    0x87, 0xC3, 0x21, 0x79, 0x41, 0x81, 0x13, 0x63, 0x7D, 0x38, 0xCB, 0x5D, 0x01, 0xD0, 0xAB, 0x6B,
-    0xC5, 0x3C, 0x95, 0xB4, 0x64, 0x61, 0xB4, 0xD3, 0xB5, 0xD4, 0xAF, 0xCA, 0xD0, 0x76, 0xF2, 0x40,
-    0x49, 0x37, 0x2C, 0x6F, 0x0F, 0xEA, 0xC3, 0x8A, 0x8D, 0x15, 0x9E, 0x40, 0x0B, 0x30, 0x96, 0xAB,
-    0x67, 0x7E, 0xBB, 0xD8, 0x2E, 0x9B, 0x16, 0x99, 0x6F, 0x38, 0xF0, 0x07, 0xCD, 0x7C, 0x4D, 0x8C,
-    0x1D, 0xD7, 0x95, 0xDE, 0xAD, 0xAA, 0x6E, 0x96, 0xC7, 0x35, 0x9E, 0xDB, 0x01, 0xA8, 0x81, 0xC7,
-    0xB2, 0x55, 0x5A, 0x4C, 0x80, 0x89, 0x47, 0x52, 0x79, 0xE1, 0x05, 0x17, 0x64, 0xDF, 0xA2, 0x18,
-    0x80, 0x0B, 0x2D, 0xD8, 0x40, 0xD8, 0x98, 0xC5, 0x20, 0xE0, 0x00, 0xC9, 0x62, 0x60, 0x0F, 0x86,
-    0x46, 0xA0, 0x85, 0x80, 0x90, 0x5D, 0x45, 0x11, 0x19, 0x1A, 0xD0, 0x42, 0x4C, 0x02, 0xC3, 0x8B,
-    0x2C, 0xA4, 0x85, 0x83, 0x24, 0x9A, 0x20, 0x32, 0x06, 0x5A, 0xD8, 0x33, 0xCD, 0x57, 0x45, 0x76,
-    0x02, 0x22, 0xE0, 0x42, 0x25, 0x11, 0x83, 0x01, 0x22, 0xCC, 0xA8, 0x28, 0x86, 0x16, 0x1C, 0x06,
-    0xE9, 0xA2, 0x58, 0x8C, 0xAA, 0xD5, 0x55, 0x75, 0xF3, 0x7D, 0xE7, 0xD6, 0x7B, 0xDD, 0x94, 0xEC,
-    0x91, 0x28, 0x91, 0x76, 0x5A, 0xEA, 0xD7, 0xE4, 0xEB, 0x57, 0xB7, 0xEE, 0xF9, 0xFB, 0xCE, 0x77,
-    0xCE, 0x3D, 0x45, 0xA5, 0xF8, 0x75, 0x08, 0xDF, 0x71, 0xA9, 0x54, 0x30, 0xE0, 0x0F, 0x49, 0x85,
-    0x97, 0x3F, 0x92, 0xF7, 0xBD, 0xF5, 0xF5, 0x93, 0x9E, 0xB5, 0x36, 0x4D, 0xAC, 0xAD, 0xFC, 0xDE,
-    0x6B, 0x94, 0x55, 0x67, 0x94, 0xC9, 0xBF, 0xA1, 0x62, 0x7C, 0x28, 0x6A, 0x94, 0xF2, 0xAD, 0xCD,
-    0x15, 0x7E, 0xA9, 0xCC, 0x0F, 0xD6, 0xE6, 0x6F, 0xA6, 0x41, 0xAF, 0xDE, 0x50, 0xA3, 0x3A, 0xA2,
-    0xB2, 0x1F, 0x64, 0xBC, 0xBC, 0x2C, 0xF8, 0x09, 0xF7, 0xB5, 0xAA, 0x73, 0x95, 0x5C, 0x6B, 0x54,
-    0x74, 0xBD, 0x55, 0x2A, 0x5D, 0x91, 0xF7, 0x96, 0xD7, 0xD7, 0xD7, 0x42, 0x6B, 0x07, 0x85, 0xCF,
-    0xA5, 0x51, 0x13, 0x96, 0x01, 0x6F, 0x35, 0xAA, 0xE7, 0x55, 0x96, 0x62, 0x3F, 0xD8, 0x58, 0x64,
-    0x47, 0x15, 0xE0, 0x97, 0x6A, 0x5C, 0x4F, 0xA7, 0x37, 0x3D, 0xA5, 0x1B, 0xBF, 0x0A, 0x3A, 0xD5,
-    0x7A, 0xE3, 0x7A, 0x8F, 0xCB, 0xAD, 0xCF, 0x9D, 0x62, 0xAD, 0x75, 0x8D, 0x3F, 0x5C, 0xC7, 0x77,
-    0xD3, 0x25, 0x65, 0x7F, 0x26, 0x6A, 0x56, 0x75, 0xD0, 0x69, 0x85, 0x05, 0x95, 0xCA, 0xFE, 0x31,
-    0xAE, 0xB5, 0x9D, 0xC2, 0x47, 0xCA, 0xA0, 0x8B, 0x5B, 0x35, 0xE0, 0xED, 0x2C, 0x35, 0x65, 0x52,
-    0xEA, 0x5A, 0x37, 0x41, 0x87, 0x05, 0x07, 0x6D, 0xAB, 0x2C, 0xB2, 0x0D, 0x6F, 0xAC, 0x2B, 0xB5,
-    0x04, 0x91, 0xF4, 0x2B, 0x0D, 0xEE, 0x0F, 0x79, 0x8B, 0xB9, 0x1C, 0xF2, 0xF5, 0x5B, 0xCA, 0x6D,
-    0x2F, 0xAB, 0xF1, 0x8D, 0xDF, 0xFC, 0x8E, 0xBA, 0x4F, 0x6D, 0xB8, 0x93, 0x2D, 0xFD, 0x3E, 0xA0,
-    0xDA, 0x3A, 0xA8, 0xED, 0x08, 0x34, 0xF4, 0x5B, 0x4E, 0x6D, 0x3D, 0x3E, 0x66, 0xF1, 0x6D, 0x72,
-    0xB5, 0xD0, 0x65, 0xC0, 0x37, 0x65, 0x93, 0xB9, 0xC2, 0xE5, 0xB8, 0x19, 0x74, 0x8B, 0xAF, 0xEF,
-    0x5E, 0xA4, 0x9A, 0x4B, 0x88, 0xD8, 0x84, 0x83, 0xEA, 0xC3, 0x4E, 0xAD, 0xE2, 0xA3, 0xDA, 0xA3,
-    0xB1, 0x0A, 0xAE, 0x61, 0xF1, 0x37, 0x2A, 0x68, 0x7C, 0xCD, 0x5D, 0x6F, 0x4A, 0xF5, 0xA4, 0x6E,
-    0x55, 0xEC, 0xD9, 0x34, 0x2E, 0xCD, 0x68, 0x6B, 0xA8, 0xAE, 0x56, 0xB1, 0xBD, 0xE8, 0xB6, 0xE7,
-    0xFF, 0x65, 0x8A, 0xA5, 0xCB, 0x08, 0xDA, 0xCA, 0xD2, 0x4D, 0xBF, 0xF7, 0x1B, 0xDD, 0x44, 0x69,
-    0x82, 0x1D, 0x64, 0xB0, 0x49, 0xD1, 0xE1, 0x1B, 0x3B, 0xC9, 0xF0, 0x33, 0x69, 0x34, 0x16, 0xDB,
-    0x54, 0x45, 0xD0, 0x06, 0xBD, 0xDE, 0xC9, 0x2A, 0x03, 0x23, 0xC5, 0x6E, 0x57, 0x4A, 0xAD, 0xAF,
-    0x7B, 0xB8, 0x2B, 0x3E, 0x0F, 0x15, 0xE0, 0x96, 0x10, 0x05, 0xFF, 0xC3, 0x38, 0x85, 0x88, 0x36,
-    0x2A, 0x6C, 0xD0, 0x1F, 0x28, 0x2A, 0x76, 0x8B, 0x4D, 0x67, 0x36, 0x2D, 0x60, 0x41, 0xBA, 0xDA,
-    0xF1, 0x4A, 0xDF, 0xEC, 0x82, 0xA6, 0x57, 0x2B, 0x4B, 0xCE, 0xFE, 0x30, 0x7F, 0xC7, 0x95, 0xA0,
-    0x06, 0x6A, 0x61, 0x14, 0xC5, 0x40, 0x2F, 0x7B, 0x7F, 0xC7, 0xBA, 0xC9, 0xFC, 0xEF, 0xDE, 0xA8,
-    0x42, 0xDB, 0xFA, 0x76, 0x90, 0x4D, 0x28, 0xEE, 0x42, 0xB6, 0x4D, 0x45, 0xD2, 0x1C, 0xA6, 0x74,
-    0x8A, 0xA5, 0xA3, 0x14, 0x93, 0x92, 0xAC, 0xD3, 0x2D, 0x95, 0x46, 0xE5, 0x73, 0x55, 0x98, 0x5A,
-    0x85, 0xAD, 0xD3, 0xBD, 0xAE, 0xD5, 0x53, 0xB8, 0x34, 0x83, 0x6C, 0x19, 0x3E, 0x96, 0xD4, 0xCE,
-    0x8C, 0xF0, 0x36, 0x45, 0x47, 0xA2, 0xD3, 0x58, 0xBE, 0xD7, 0x31, 0x4C, 0xD4, 0x59, 0x5E, 0xA2,
-    0x12, 0x31, 0x98, 0x2E, 0xA9, 0xF2, 0xA0, 0xE2, 0xCD, 0xBC, 0x26, 0xA1, 0xA3, 0xF7, 0x9A, 0xD6,
-    0x3B, 0x1B, 0x74, 0x58, 0x26, 0x51, 0x03, 0x8D, 0x95, 0x67, 0x69, 0x81, 0x8F, 0x26, 0x65, 0x72,
-    0xF9, 0xB9, 0x4A, 0x37, 0xBA, 0xB6, 0x4D, 0xD0, 0xC7, 0x8D, 0x69, 0x62, 0xAC, 0x0E, 0xCF, 0xB3,
-    0x73, 0xE3, 0x40, 0xA2, 0x93, 0xCB, 0xEB, 0xA9, 0x67, 0x7B, 0x83, 0xBD, 0x14, 0x6D, 0xC2, 0xDD,
-    0x94, 0xBC, 0x9F, 0xC9, 0x35, 0x5F, 0x53, 0x4D, 0x67, 0x4B, 0xE1, 0x98, 0x90, 0x8B, 0xBB, 0x41,
-    0xD0, 0xE0, 0x62, 0xBC, 0xC0, 0x0D, 0xC6, 0xF5, 0xE2, 0xCF, 0x46, 0xAF, 0xC7, 0xEF, 0x2D, 0xA4,
-    0x2C, 0x60, 0x38, 0xBE, 0x5A, 0x48, 0x3A, 0x7A, 0x03, 0x64, 0x1D, 0xA3, 0x3E, 0xB3, 0x30, 0x7C,
-    0x53, 0x58, 0x78, 0x4C, 0xAA, 0xE6, 0xE1, 0xB7, 0xCE, 0xEB, 0x87, 0x80, 0xA2, 0xEA, 0x17, 0x7B,
-    0x5D, 0x32, 0x68, 0x54, 0x63, 0xF2, 0xD6, 0x39, 0x14, 0xB5, 0xA4, 0x92, 0xED, 0x51, 0x94, 0x01,
-    0x94, 0x08, 0x21, 0x51, 0x85, 0x3D, 0x65, 0x69, 0x52, 0xCA, 0x7D, 0x18, 0x39, 0xD8, 0x60, 0x0C,
-    0x41, 0xB6, 0xB8, 0x78, 0x6C, 0xCB, 0xB9, 0x38, 0x21, 0xEF, 0x92, 0xC0, 0x1A, 0x1E, 0xFD, 0x26,
-    0xA4, 0xCD, 0x0E, 0xA4, 0x0B, 0x51, 0xD5, 0x7F, 0xF4, 0xEC, 0x10, 0xC2, 0x8B, 0x5A, 0x3D, 0x40,
-    0x4E, 0xF3, 0x27, 0x30, 0x1E, 0xB4, 0x6A, 0xCE, 0xE1, 0x8E, 0xD9, 0x31, 0x48, 0x5A, 0x68, 0x11,
-    0x91, 0x16, 0xA4, 0xF3, 0x0C, 0x58, 0xC9, 0x1B, 0x20, 0xB6, 0xDF, 0x43, 0x0F, 0x41, 0x4F, 0x87,
-    0x60, 0xCC, 0x86, 0x1D, 0x5C, 0x2D, 0xB3, 0x8A, 0x3E, 0xC6, 0xF8, 0xD9, 0xFF, 0xF5, 0xBC, 0x38,
-    0x7D, 0xC7, 0xD7, 0xA8, 0x97, 0x2D, 0xC9, 0xAB, 0x7A, 0x75, 0xFE, 0x81, 0xC7, 0xD6, 0x15, 0x03,
-    0x16, 0x71, 0xDF, 0xF8, 0xB6, 0x82, 0xC6, 0x21, 0x13, 0x7C, 0x49, 0x33, 0x6E, 0xA9, 0x76, 0x78,
-    0xDC, 0xE0, 0xC1, 0x09, 0xA2, 0x86, 0xBE, 0x9F, 0x5C, 0xF9, 0x08, 0x42, 0xD8, 0xE4, 0x25, 0xDC,
-    0x7A, 0xB7, 0x85, 0xAF, 0xC5, 0x36, 0xA5, 0x03, 0x36, 0xD0, 0x52, 0x60, 0xE9, 0xA5, 0xB8, 0xB0,
-    0x60, 0x14, 0x43, 0xF9, 0xB1, 0xAD, 0x18, 0x23, 0x16, 0xFE, 0x3A, 0xDD, 0xEC, 0x77, 0xFD, 0x1C,
-    0x8E, 0xF0, 0x02, 0x56, 0xC0, 0x67, 0x42, 0xEA, 0x64, 0x39, 0x9D, 0x50, 0x63, 0xED, 0xB1, 0x93,
-    0xC6, 0x06, 0xF6, 0x6D, 0x5B, 0xC5, 0x5D, 0xD4, 0xAA, 0x1E, 0xC6, 0x4E, 0x52, 0x88, 0xD7, 0x40,
-    0x33, 0xD8, 0x43, 0x1F, 0xA7, 0x4A, 0x5F, 0x87, 0x0F, 0xCC, 0x36, 0x79, 0x25, 0xAE, 0x32, 0x73,
-    0xD4, 0x48, 0x52, 0xE5, 0x87, 0xD0, 0x16, 0x5C, 0x40, 0x69, 0x5A, 0xAC, 0x48, 0xEF, 0x73, 0xA7,
-    0x18, 0x78, 0xD8, 0x3B, 0x6F, 0xF2, 0xE9, 0x1D, 0xD0, 0xB2, 0x68, 0x8E, 0x02, 0xC2, 0x97, 0x28,
-    0x1A, 0x0D, 0x5D, 0x38, 0xB1, 0x7D, 0x09, 0x39, 0x4A, 0x46, 0x7C, 0x5D, 0x5C, 0xD0, 0xF2, 0x02,
-    0x0A, 0xF6, 0x83, 0x53, 0x30, 0x3D, 0x3C, 0xA1, 0x8E, 0xE8, 0x35, 0xD8, 0x02, 0xA3, 0x41, 0x19,
-    0x25, 0x71, 0xC0, 0xD7, 0xC3, 0xF2, 0x47, 0x71, 0x01, 0x87, 0xF0, 0xEA, 0x8F, 0xD5, 0x04, 0x7A,
-    0xA2, 0x7B, 0x2D, 0x79, 0x86, 0x2F, 0xAB, 0x33, 0xBC, 0xF4, 0x19, 0xA4, 0x6F, 0x33, 0x2E, 0x84,
-    0x45, 0xA2, 0xCA, 0x40, 0xCE, 0x12, 0x01, 0x4C, 0xF8, 0xE4, 0x8D, 0x4A, 0x45, 0xDF, 0x80, 0x05,
-    0xB1, 0x9F, 0x46, 0xC5, 0x35, 0xAE, 0xB4, 0x43, 0x36, 0x12, 0x00, 0xE8, 0xBA, 0xFC, 0x04, 0x7D,
-    0x1A, 0x7B, 0x73, 0x28, 0xAB, 0x81, 0xB2, 0x74, 0x59, 0xB9, 0x21, 0x41, 0x54, 0x10, 0xB2, 0x2A,
-    0xCA, 0xB0, 0x89, 0x5A, 0xA4, 0x31, 0x5C, 0xAE, 0x32, 0x7C, 0xD2, 0x94, 0x71, 0x9D, 0x55, 0xB8,
-    0xBC, 0x4A, 0x16, 0xC1, 0xF0, 0xB5, 0xBF, 0x4C, 0x7D, 0x02, 0xAD, 0xDD, 0xEE, 0xBD, 0xE4, 0xF2,
-    0x80, 0x4F, 0x41, 0x13, 0x29, 0x7C, 0x2B, 0xED, 0x09, 0x83, 0x58, 0xAE, 0x82, 0x27, 0x22, 0x6F,
-    0x3C, 0xDE, 0x7B, 0xBD, 0x3F, 0x70, 0xB5, 0xA0, 0x07, 0xC6, 0x77, 0x01, 0x80, 0x39, 0x6E, 0x32,
-    0xC9, 0x76, 0x3B, 0x73, 0x80, 0xBC, 0x6F, 0x73, 0xB0, 0x67, 0xB9, 0x0A, 0xA4, 0xD1, 0x69, 0xD8,
-    0x06, 0xB9, 0xDB, 0x9C, 0x43, 0x6B, 0xC2, 0xCF, 0xDE, 0x8E, 0x17, 0x79, 0x81, 0x81, 0x0E, 0xE1,
-    0x13, 0xBB, 0x87, 0x46, 0x86, 0x51, 0x8E, 0x0D, 0x62, 0xBB, 0x41, 0xCD, 0x0F, 0x9D, 0x0D, 0x88,
-    0x60, 0x25, 0xD1, 0x87, 0xC1, 0xA0, 0xE2, 0x14, 0x97, 0x03, 0xD1, 0x71, 0xC9, 0x2A, 0xD4, 0x06,
-    0x6D, 0x12, 0x23, 0x7A, 0x2E, 0x9C, 0x20, 0xCD, 0x41, 0xC5, 0x84, 0x3D, 0xBA, 0x96, 0xCA, 0x68,
-    0x52, 0x2C, 0x68, 0x5B, 0x06, 0x3E, 0x92, 0x01, 0x0D, 0x10, 0x56, 0xBC, 0xF0, 0x0C, 0xB6, 0x53,
-    0x85, 0xB8, 0xF0, 0x0C, 0xA3, 0x27, 0x5C, 0xC4, 0xAB, 0x13, 0xA8, 0x8A, 0xA8, 0x81, 0x82, 0x54,
-    0xA0, 0x8C, 0xB1, 0xF7, 0x30, 0xDD, 0xA7, 0xED, 0x1A, 0x4B, 0xB6, 0x4A, 0xDF, 0x3A, 0x39, 0x17,
-    0x68, 0x05, 0x02, 0x3D, 0xCD, 0x30, 0x4A, 0xE3, 0x5B, 0xA7, 0x4A, 0x5C, 0x0E, 0x90, 0x64, 0x34,
-    0xFC, 0x23, 0xF5, 0xD8, 0x49, 0xEF, 0x47, 0xCA, 0xE6, 0xB6, 0x47, 0x58, 0xDA, 0x32, 0xAB, 0x93,
-    0x5E, 0xFD, 0x87, 0x3A, 0xCE, 0xB3, 0x3F, 0x86, 0x00, 0x49, 0xCE, 0x80, 0x6D, 0xCD, 0x31, 0xFA,
-    0x56, 0x67, 0xB8, 0x17, 0xB5, 0x99, 0xE9, 0x54, 0xEE, 0x41, 0x0D, 0x49, 0x82, 0xA5, 0xD6, 0x06,
-    0x88, 0x82, 0x4D, 0xF4, 0x82, 0xFC, 0x97, 0x7B, 0xE2, 0x85, 0x7D, 0xB6, 0x23, 0x3A, 0x8C, 0x41,
-    0x8B, 0x3D, 0xE8, 0x8E, 0xD9, 0x4B, 0x65, 0x4D, 0x02, 0x8F, 0x41, 0x54, 0x9A, 0x71, 0x5F, 0x74,
-    0x1C, 0xF8, 0x29, 0x79, 0x05, 0xC2, 0xD4, 0xAA, 0x4D, 0xD8, 0xB1, 0x06, 0xFB, 0x90, 0x14, 0x32,
-    0x88, 0x4D, 0x08, 0xBE, 0x4C, 0x2E, 0x8F, 0x53, 0x91, 0x4C, 0x30, 0xF5, 0x21, 0x95, 0x9D, 0x07,
-    0x72, 0xEB, 0x7B, 0x19, 0x7C, 0x66, 0x7F, 0x2E, 0x3C, 0xE9, 0x31, 0x89, 0xB5, 0x86, 0xD6, 0x4E,
-    0x5D, 0x26, 0x93, 0xA8, 0x71, 0xE9, 0x0B, 0x81, 0x1A, 0xB6, 0x21, 0x6D, 0x59, 0x32, 0xBD, 0x14,
-    0xD1, 0x6D, 0x04, 0x53, 0x3F, 0xC3, 0x9D, 0xF4, 0x76, 0xC5, 0x18, 0x1C, 0x18, 0x68, 0xB6, 0x64,
-    0xF8, 0xF5, 0xDC, 0x9E, 0x21, 0xAE, 0x22, 0xCF, 0x69, 0x46, 0xDA, 0x31, 0xDB, 0xF9, 0xB6, 0x8F,
-    0x27, 0x0E, 0xC5, 0xBD, 0xFF, 0xF3, 0x00, 0xAF, 0x41, 0xFD, 0x34, 0x63, 0xE9, 0x36, 0xBD, 0x83,
-    0x3B, 0x5D, 0x20, 0xC9, 0xAF, 0x10, 0xD2, 0x1E, 0x31, 0x82, 0x7F, 0xCC, 0xE9, 0xD5, 0xDC, 0xE9,
-    0x25, 0x6D, 0x97, 0x8C, 0x9E, 0x9E, 0x49, 0x51, 0x73, 0xB7, 0x5E, 0xC3, 0xFC, 0x6F, 0xE8, 0x86,
-    0x61, 0x45, 0x1B, 0x6E, 0x52, 0xF7, 0x3A, 0xC7, 0x05, 0x01, 0x05, 0x39, 0x78, 0x09, 0x22, 0x04,
-    0xB6, 0xC4, 0x05, 0xA6, 0xD1, 0x20, 0x45, 0x50, 0xEA, 0x38, 0xD7, 0xD7, 0xF2, 0x3A, 0xFF, 0x8F,
-    0x40, 0x0A, 0x6D, 0xE9, 0x51, 0x67, 0xA0, 0x1F, 0x74, 0x4A, 0xBC, 0xA5, 0xA0, 0xA6, 0x60, 0xBB,
-    0xDA, 0xC0, 0x62, 0x1F, 0xB6, 0xAB, 0x08, 0x92, 0xCD, 0x59, 0x0C, 0x19, 0x4C, 0xF2, 0xF2, 0x4B,
-    0xB5, 0xD2, 0x17, 0x3E, 0xBC, 0x82, 0xBD, 0x97, 0xB6, 0x1A, 0x89, 0x5E, 0x48, 0x99, 0xAA, 0xD3,
-    0x2D, 0x92, 0xF3, 0x59, 0x60, 0x42, 0x8B, 0xEC, 0x7F, 0x16, 0xAE, 0xA4, 0xCB, 0x27, 0x98, 0x2A,
-    0x07, 0xF8, 0x2C, 0xAC, 0x98, 0x2A, 0x3A, 0x2E, 0x61, 0x79, 0x6D, 0x52, 0x65, 0x1B, 0xD9, 0xDC,
-    0xD9, 0x47, 0xCC, 0xCE, 0x54, 0x0A, 0xDC, 0x03, 0xF2, 0x2B, 0x04, 0x28, 0x09, 0x15, 0xE3, 0x45,
-    0x8B, 0xBF, 0x8F, 0xEB, 0xC0, 0x5E, 0x7C, 0x70, 0x6E, 0x50, 0x77, 0x41, 0x2F, 0x17, 0xD0, 0x38,
-    0x74, 0x16, 0x2C, 0x07, 0x1C, 0x82, 0xAA, 0xBF, 0x73, 0x51, 0x09, 0x37, 0x47, 0xCC, 0xA5, 0x71,
-    0x1B, 0xF7, 0xC0, 0x5E, 0x53, 0xD9, 0xD4, 0x1F, 0x63, 0x64, 0x94, 0xF7, 0x40, 0xCD, 0x46, 0x5C,
-    0x96, 0xDC, 0xEC, 0xDD, 0x1F, 0xCC, 0x75, 0xAE, 0x84, 0x3F, 0x14, 0xE7, 0xE1, 0xD8, 0x4D, 0x42,
-    0xB2, 0x69, 0x6F, 0xDB, 0x34, 0xE4, 0x12, 0xD1, 0x82, 0xC0, 0xAF, 0xD3, 0x24, 0xB1, 0xB0, 0x8D,
-    0x82, 0x38, 0xC4, 0xF4, 0x00, 0x6D, 0x94, 0xE1, 0x22, 0x3D, 0x80, 0xC2, 0xD3, 0xFD, 0x49, 0x60,
-    0x19, 0x44, 0xBA, 0x21, 0xE9, 0x1A, 0x19, 0x56, 0xC0, 0xEF, 0x9E, 0x1B, 0xE7, 0xDD, 0x40, 0xBF,
-    0xB9, 0x71, 0x88, 0x97, 0xE5, 0x14, 0xD3, 0x3E, 0x67, 0x1B, 0x6C, 0x9C, 0x26, 0xF9, 0x9A, 0x10,
-    0xD4, 0x51, 0xA0, 0x66, 0xA9, 0x88, 0xF8, 0x79, 0x8B, 0x95, 0x12, 0xDC, 0x83, 0xC9, 0x89, 0xB7,
-    0xA1, 0xC8, 0xDB, 0xA4, 0xBD, 0x50, 0xFE, 0x78, 0xF1, 0xEF, 0xC3, 0x4D, 0xF5, 0xDD, 0x57, 0x85,
-    0x3E, 0x23, 0xCC, 0x9B, 0x60, 0x54, 0x3D, 0x6A, 0x9C, 0x55, 0x78, 0x9A, 0x96, 0x8F, 0x13, 0x36,
-    0x05, 0x7F, 0xE7, 0x89, 0xD4, 0xCE, 0x01, 0xB9, 0x53, 0x5F, 0x81, 0x13, 0xC4, 0xB9, 0x71, 0xCC,
-    0xBB, 0xC2, 0x6A, 0xF9, 0x82, 0x2D, 0x45, 0x53, 0x81, 0xD1, 0x76, 0x71, 0xB5, 0x09, 0x32, 0x98,
-    0x68, 0x40, 0xC2, 0xD1, 0x74, 0xF4, 0xA6, 0xE2, 0xE4, 0x13, 0x84, 0x7E, 0x2A, 0x63, 0xE6, 0xB7,
-    0x81, 0xF7, 0x41, 0xA3, 0x2D, 0xC3, 0xD4, 0x5B, 0x3F, 0x66, 0x1B, 0x33, 0x24, 0x88, 0xC6, 0xBC,
-    0x48, 0x75, 0x19, 0xB4, 0x7E, 0xCB, 0xD4, 0xC4, 0xF0, 0x80, 0xC2, 0x2E, 0xE3, 0x43, 0x03, 0x93,
-    0xE2, 0xED, 0xD2, 0xD1, 0xF3, 0x60, 0xBE, 0x43, 0x7C, 0x4C, 0x3D, 0xB9, 0xC1, 0xB5, 0x08, 0x78,
-    0x90, 0x34, 0x6A, 0x17, 0x8C, 0xC7, 0x27, 0x0F, 0x10, 0x93, 0x11, 0xEC, 0xD5, 0xE9, 0x5B, 0x02,
-    0x9A, 0xA9, 0xDE, 0x1D, 0x6D, 0x6A, 0xC1, 0x3D, 0xA3, 0xC6, 0x3C, 0xDB, 0x9B, 0xB4, 0x0F, 0xEF,
-    0x0C, 0x61, 0x93, 0x5C, 0x6D, 0x93, 0x72, 0xD4, 0xF5, 0x08, 0x39, 0xDE, 0xBF, 0x67, 0x53, 0xC3,
-    0x6C, 0xF5, 0xB8, 0xFD, 0x9F, 0x13, 0x67, 0x4A, 0x3A, 0xDE, 0xB4, 0xA5, 0xE0, 0xE9, 0x44, 0x27,
-    0xA0, 0x5D, 0xDC, 0x35, 0x1A, 0xC9, 0xE8, 0x50, 0x3B, 0x51, 0x2E, 0x60, 0xB0, 0x27, 0x40, 0x6C,
-    0xB6, 0x53, 0xDE, 0x9A, 0xBA, 0x92, 0x17, 0x6E, 0x55, 0x19, 0x59, 0x88, 0x3B, 0x4F, 0x4E, 0x60,
-    0xA7, 0xC9, 0x8B, 0x3D, 0xEB, 0x4D, 0x52, 0x7C, 0xA6, 0xA0, 0x0C, 0x28, 0x55, 0x1A, 0xDA, 0xFF,
-    0x91, 0xB2, 0x95, 0x86, 0x56, 0xB3, 0xC2, 0xFF, 0xC4, 0x2F, 0xCE, 0x0A, 0x21, 0x14, 0x92, 0xF2,
-    0x13, 0xF9, 0xE3, 0x02, 0x3A, 0x97, 0x61, 0x93, 0xD6, 0x8E, 0xC9, 0x00, 0x39, 0x0A, 0x18, 0x0E,
-    0xEC, 0xB6, 0xE7, 0x2D, 0x72, 0xA4, 0xBA, 0x4E, 0xEA, 0x45, 0xDD, 0xD2, 0xC1, 0xC9, 0x85, 0x59,
-    0x16, 0x2C, 0xFF, 0xFB, 0x61, 0x2A, 0x04, 0xC5, 0xE2, 0x14, 0x39, 0x64, 0x6D, 0x41, 0xAD, 0xB9,
-    0x58, 0x7F, 0xEC, 0x24, 0xD1, 0xB8, 0xB7, 0x1D, 0xE5, 0xAA, 0xF9, 0x1F, 0xA1, 0x32, 0x97, 0x92,
-    0xC9, 0xE4, 0xDC, 0x70, 0xCA, 0x02, 0x41, 0xF1, 0x45, 0xE2, 0xA6, 0x70, 0x02, 0x8E, 0x4A, 0x42,
-    0x67, 0x00, 0xA5, 0xE7, 0x0B, 0x73, 0x02, 0xC9, 0x06, 0x83, 0x28, 0xE8, 0x25, 0x80, 0x80, 0x9D,
-    0x94, 0x14, 0x99, 0x0E, 0x29, 0x06, 0xAC, 0x31, 0x72, 0xC2, 0x0A, 0x42, 0xCB, 0x8F, 0x7D, 0x77,
-    0xDF, 0xF9, 0x45, 0x77, 0x4F, 0xEF, 0xBF, 0x7B, 0xF1, 0x50, 0xEE, 0x6E, 0xDD, 0xDD, 0xAD, 0xD3,
-    0x68, 0xE6, 0x7E, 0x9C, 0x75, 0x3F, 0x36, 0xDD, 0x8F, 0x9F, 0xB8, 0x1F, 0x6F, 0xEC, 0x21, 0x30,
-    0xF1, 0x77, 0xAA, 0x55, 0x51, 0xB8, 0xAB, 0xB3, 0xC4, 0x0E, 0x2C, 0xEF, 0x1D, 0x9D, 0x17, 0xBA,
-    0x2C, 0xAE, 0x58, 0x5A, 0x05, 0x6D, 0x52, 0x7B, 0xBD, 0x94, 0x36, 0x85, 0x9A, 0x4A, 0xF7, 0x9A,
-    0xEC, 0x2B, 0x76, 0x56, 0xBE, 0xB8, 0xA8, 0x2E, 0xC4, 0x99, 0x6A, 0x12, 0xC5, 0xA2, 0x85, 0x4F,
-    0x13, 0xAC, 0xA6, 0x52, 0x95, 0xDB, 0x6F, 0xA5, 0xD4, 0x86, 0xFC, 0xC0, 0x2E, 0xC6, 0x2B, 0x65,
-    0x1F, 0xE9, 0x5F, 0xAC, 0xA6, 0xA1, 0x81, 0x41, 0xB7, 0xF0, 0x30, 0x38, 0xEA, 0x15, 0x27, 0xB2,
-    0xD4, 0xB9, 0xE6, 0x3C, 0x11, 0x3A, 0x6C, 0x59, 0xEB, 0xFE, 0x99, 0x95, 0xBA, 0xD6, 0x9E, 0x77,
-    0xB7, 0x2D, 0xAC, 0xDA, 0x63, 0xDD, 0x7B, 0x65, 0x69, 0x32, 0x95, 0xA3, 0x0C, 0x8F, 0x45, 0x49,
-    0x2A, 0x6D, 0x93, 0x46, 0x0D, 0xD1, 0x3E, 0x1A, 0xE9, 0xCD, 0x69, 0x64, 0x4B, 0xE4, 0x5B, 0xD0,
-    0xC8, 0xDF, 0xFE, 0x29, 0x6B, 0x7C, 0xB0, 0xDF, 0x5D, 0x9B, 0x47, 0x65, 0xDC, 0xF8, 0xB5, 0x3F,
-    0xAA, 0xEF, 0xED, 0xC7, 0x2D, 0xED, 0x3C, 0xB1, 0x54, 0xAF, 0xBD, 0xDE, 0x38, 0x20, 0x80, 0x69,
-    0x4A, 0x1F, 0xFC, 0xC7, 0x43, 0xFA, 0xFA, 0xA1, 0x34, 0x22, 0xB0, 0x9F, 0x9D, 0xBD, 0xCD, 0x01,
-    0x14, 0x43, 0x0B, 0x7D, 0x21, 0xC5, 0xD8, 0x67, 0x2D, 0x7F, 0x34, 0x49, 0x1B, 0x03, 0x79, 0x2E,
-    0x5B, 0x16, 0xBF, 0x23, 0x93, 0x24, 0xB0, 0x08, 0xEA, 0x01, 0x39, 0xBA, 0x32, 0xF0, 0x26, 0x05,
-    0xB6, 0x8B, 0x48, 0xE0, 0x6D, 0x4C, 0xA9, 0x6F, 0x59, 0xD2, 0x93, 0xEC, 0x58, 0xAF, 0x48, 0xA9,
-    0xE5, 0xE3, 0x40, 0x95, 0xCA, 0x67, 0x98, 0x14, 0xD8, 0x24, 0x7E, 0x89, 0xE4, 0x01, 0xE5, 0x80,
-    0xA7, 0xD5, 0xC4, 0xA3, 0x62, 0x67, 0x5F, 0x49, 0xE6, 0x89, 0x7E, 0x60, 0x16, 0x61, 0x92, 0x60,
-    0xF4, 0xA2, 0x59, 0xE7, 0x8F, 0xCA, 0x05, 0x04, 0xB3, 0x7B, 0xB2, 0x63, 0x5D, 0xEF, 0x07, 0xD2,
-    0xC1, 0x09, 0xC2, 0x1B, 0xC4, 0xCE, 0x2B, 0xA4, 0xB2, 0xB8, 0x2F, 0x92, 0x00, 0x12, 0x25, 0xDB,
-    0x21, 0x48, 0xBB, 0x96, 0xB7, 0x9D, 0xAB, 0xDF, 0x23, 0xF8, 0xBC, 0x92, 0xC7, 0xB8, 0x06, 0xA9,
-    0x0E, 0x92, 0x01, 0x4E, 0x07, 0xF6, 0x61, 0x98, 0x43, 0x0C, 0x08, 0x72, 0x1F, 0xC1, 0x65, 0xFF,
-    0xEA, 0x3D, 0xBD, 0xFB, 0xEE, 0x60, 0x7A, 0x53, 0x67, 0xF9, 0xB8, 0xBF, 0x5E, 0xFC, 0x23, 0x98,
-    0xA9, 0x64, 0x1B, 0x80, 0x30, 0x0D, 0x67, 0x62, 0xA9, 0x7D, 0x89, 0xD4, 0x63, 0x4D, 0x25, 0xA7,
-    0x3B, 0xB2, 0xFF, 0x70, 0xC0, 0x96, 0xC1, 0x31, 0x2C, 0x4B, 0x02, 0xBF, 0xD3, 0x95, 0x46, 0xCD,
-    0x92, 0xA1, 0xD2, 0xEF, 0x82, 0x21, 0x43, 0xBA, 0xE8, 0x5D, 0x61, 0x37, 0xD1, 0x35, 0x10, 0x42,
-    0xD0, 0x30, 0x5D, 0x02, 0xD0, 0x0D, 0x98, 0xC9, 0xB1, 0x8F, 0x00, 0xC2, 0xB6, 0x33, 0x69, 0x11,
-    0x97, 0xF1, 0x56, 0xE3, 0x80, 0x57, 0x68, 0x9A, 0x8B, 0x03, 0xA2, 0xA7, 0xB5, 0x17, 0xAA, 0xD9,
-    0x97, 0x80, 0xBF, 0x49, 0x05, 0x6A, 0x85, 0x7A, 0x10, 0xA5, 0xBB, 0x42, 0xF5, 0x92, 0xBC, 0xD5,
-    0x1B, 0x5B, 0x65, 0x9D, 0xE3, 0xAE, 0x6B, 0x8E, 0xB0, 0x58, 0xF5, 0x6D, 0x9A, 0xDC, 0x94, 0x92,
-    0x06, 0xE3, 0xD2, 0x1B, 0xC1, 0x5C, 0x80, 0xA8, 0x3F, 0x04, 0xC1, 0x8A, 0x2F, 0x23, 0x62, 0x4D,
-    0x9E, 0x9C, 0x6F, 0x83, 0xD6, 0xA8, 0x0C, 0x4B, 0xD4, 0xE6, 0x28, 0x72, 0x60, 0x96, 0x92, 0x4E,
-    0x66, 0xF5, 0x62, 0x93, 0x80, 0x79, 0x0B, 0x0D, 0x0D, 0xD8, 0x66, 0x7C, 0xAE, 0x4B, 0xF0, 0xB1,
-    0x22, 0x07, 0x6C, 0x67, 0xE9, 0x8A, 0x51, 0x6F, 0x98, 0xDB, 0x2D, 0x62, 0x2F, 0x72, 0x5A, 0x3A,
-    0xA8, 0x56, 0xBC, 0x34, 0xEC, 0xC3, 0x32, 0x2B, 0x8B, 0xDE, 0x84, 0xF6, 0xD8, 0x76, 0xD3, 0x99,
-    0x3F, 0xF9, 0x8A, 0xBE, 0x76, 0x9D, 0xD0, 0x9E, 0x25, 0xF4, 0xEE, 0x41, 0x92, 0x06, 0x25, 0xD2,
-    0xEF, 0xD2, 0x2A, 0x67, 0x0A, 0x44, 0x7D, 0x70, 0xFD, 0x83, 0xEE, 0xA9, 0x27, 0x66, 0xFA, 0x02,
-    0xB2, 0x7C, 0x73, 0x44, 0x5B, 0x7F, 0xF4, 0x9A, 0xA4, 0x56, 0x7B, 0x46, 0x2B, 0x3A, 0x98, 0x39,
-    0xAC, 0x66, 0xBE, 0xDA, 0x60, 0x89, 0xF2, 0xFB, 0x00, 0x93, 0x46, 0xFD, 0x36, 0x64, 0xEA, 0xBF,
-    0xAE, 0x7A, 0x13, 0x74, 0x06, 0x5A, 0x74, 0x1D, 0x24, 0x46, 0x51, 0x15, 0x5F, 0xB5, 0x30, 0xDC,
-    0x00, 0x76, 0x0F, 0xE5, 0xC6, 0x65, 0xA6, 0x66, 0x44, 0x22, 0x18, 0x03, 0xAE, 0x93, 0x85, 0xBD,
-    0xDF, 0x65, 0x77, 0x5E, 0xDE, 0x7D, 0xD3, 0xC2, 0xC2, 0x4D, 0x56, 0xCE, 0xE6, 0xF7, 0xC9, 0xD5,
-    0xF3, 0x21, 0x6C, 0x79, 0x18, 0xD6, 0x15, 0xB2, 0xCD, 0xAF, 0x25, 0x78, 0x19, 0x00, 0x2E, 0x43,
-    0xD5, 0x40, 0x4B, 0x1A, 0x85, 0x50, 0x14, 0x55, 0xE5, 0x2C, 0xFD, 0x40, 0x51, 0x43, 0xAC, 0x90,
-    0x5C, 0xB0, 0x5F, 0xB5, 0x9B, 0xF6, 0xAE, 0xDD, 0xB2, 0x61, 0x1F, 0xB9, 0x7D, 0xAF, 0xA8, 0xA3,
-    0xD8, 0x83, 0xE9, 0x4C, 0x6D, 0x4E, 0xFC, 0x3C, 0xB8, 0x8B, 0x28, 0x38, 0xA3, 0x42, 0x64, 0xC0,
-    0xA2, 0x93, 0xBC, 0x3C, 0x5C, 0x52, 0xB0, 0xF0, 0xBF, 0xEE, 0x91, 0xDF, 0x2F, 0xDB, 0xAD, 0x76,
-    0xBA, 0x48, 0x79, 0x6B, 0xB0, 0xD6, 0x28, 0xD5, 0x7A, 0x70, 0x07, 0xBE, 0x02, 0x06, 0xA9, 0xCF,
-    0x23, 0xB8, 0x50, 0xEB, 0x40, 0xF1, 0x6A, 0x95, 0xF4, 0x51, 0x97, 0x2B, 0x7D, 0xFC, 0xDF, 0x4C,
-    0x1B, 0x8F, 0x06, 0xF5, 0x2E, 0x5B, 0x2B, 0x73, 0x2D, 0xC1, 0x56, 0x3D, 0x3B, 0x7B, 0xF0, 0xA2,
-    0x52, 0xE0, 0x5C, 0x3D, 0xD3, 0x1F, 0x01, 0x3F, 0x3C, 0xFD, 0xF4, 0xA6, 0x0A, 0xAE, 0xBD, 0x9B,
-    0x28, 0xEF, 0x8E, 0x3D, 0x51, 0xA2, 0x58, 0xDA, 0xC2, 0x52, 0xF1, 0x0D, 0xAC, 0x1D, 0x36, 0x67,
-    0xBF, 0x65, 0x2F, 0x77, 0x49, 0x6F, 0xAA, 0x23, 0xD1, 0xA0, 0xAB, 0xDF, 0x90, 0xD6, 0xE1, 0x54,
-    0x9D, 0x67, 0xB5, 0xDE, 0x42, 0xF1, 0xA5, 0x46, 0x12, 0x56, 0xC8, 0x8F, 0x00, 0xC9, 0x6C, 0xCF,
-    0x1A, 0x58, 0xDF, 0xCA, 0x28, 0x3F, 0x50, 0xA9, 0x39, 0x0E, 0xA8, 0x48, 0xF2, 0xAC, 0x05, 0x23,
-    0x9C, 0x9A, 0x15, 0xE2, 0xD6, 0x31, 0x20, 0xE4, 0x06, 0xA8, 0x83, 0xB9, 0xDA, 0x44, 0x77, 0x3B,
-    0xBF, 0x47, 0xBC, 0x41, 0x7B, 0xA7, 0xAA, 0x78, 0x0B, 0x66, 0xB0, 0xA7, 0x70, 0x51, 0xED, 0x4D,
-    0x6E, 0xBD, 0xE2, 0xA9, 0xAC, 0xB2, 0x81, 0x7D, 0x05, 0xC8, 0xBA, 0x0B, 0x3B, 0x47, 0xB5, 0x6E,
-    0x71, 0xA7, 0x1C, 0xEE, 0x19, 0x22, 0x06, 0x8C, 0xBB, 0x53, 0x78, 0x07, 0x77, 0x1A, 0x93, 0xB2,
-    0x68, 0x07, 0x35, 0xC5, 0xE4, 0x92, 0x42, 0x41, 0x1E, 0x75, 0xA1, 0x3D, 0x0D, 0xCA, 0x37, 0x43,
-    0x41, 0x5E, 0x33, 0xD9, 0x33, 0x09, 0x0F, 0x52, 0x53, 0x23, 0xB0, 0x41, 0xEA, 0x5A, 0x0F, 0x56,
-    0xF2, 0xC7, 0xD3, 0x15, 0xBB, 0xC4, 0xC1, 0x2E, 0x94, 0x0A, 0x20, 0xE4, 0x37, 0x75, 0x1E, 0x13,
-    0xE8, 0xE1, 0x86, 0xDF, 0x79, 0x6D, 0xBF, 0xAF, 0xEF, 0x6C, 0xEA, 0x7A, 0x05, 0x75, 0x08, 0xB9,
-    0x7C, 0x2A, 0xF5, 0x30, 0xA1, 0xE7, 0xC7, 0x86, 0xF5, 0xE9, 0xDC, 0xD7, 0xA1, 0xEF, 0x15, 0xCF,
-    0x1E, 0xEF, 0xE2, 0xDA, 0xDC, 0xB3, 0xD7, 0x00, 0x32, 0xB3, 0x71, 0x17, 0x10, 0xA8, 0xBB, 0x8C,
-    0x48, 0x19, 0x21, 0xE9, 0x24, 0xD5, 0x40, 0x36, 0xAA, 0x91, 0x83, 0x10, 0x58, 0x8A, 0x7C, 0x2A,
-    0x8F, 0x4B, 0xC0, 0xC2, 0x39, 0x44, 0x9F, 0xE9, 0x93, 0x7C, 0x08, 0xEC, 0xF9, 0x16, 0x5A, 0xDD,
-    0x6B, 0x1C, 0x2F, 0x01, 0x32, 0x63, 0xD4, 0xD0, 0x01, 0x3B, 0xA7, 0x23, 0xB3, 0x59, 0x8E, 0x54,
-    0x03, 0x86, 0x09, 0x1F, 0x08, 0x6F, 0x20, 0xE1, 0x75, 0x08, 0x16, 0x73, 0x04, 0xB1, 0xB3, 0x3D,
-    0xF1, 0x3D, 0xE9, 0xF5, 0xE4, 0xAE, 0x47, 0x0F, 0x56, 0x78, 0x28, 0x66, 0x85, 0x56, 0x3A, 0x90,
-    0x99, 0xCD, 0x17, 0x75, 0x54, 0x0D, 0x88, 0x80, 0x05, 0x5E, 0x70, 0xED, 0x98, 0xA0, 0x76, 0x69,
-    0x97, 0xA9, 0x48, 0xE0, 0x36, 0x7B, 0xE5, 0x1A, 0x6C, 0xDC, 0x9B, 0x2B, 0x9D, 0x3E, 0xD7, 0x9B,
-    0xA3, 0xAD, 0xDE, 0x6A, 0x92, 0xA3, 0x7D, 0x86, 0x72, 0x7B, 0xAB, 0x35, 0x40, 0x88, 0xAD, 0x06,
-    0x78, 0x9D, 0x15, 0x64, 0xBC, 0x35, 0x96, 0x7F, 0x75, 0x22, 0x48, 0x88, 0x92, 0x25, 0x94, 0xDE,
-    0xFE, 0xFB, 0x6C, 0x40, 0x32, 0x64, 0xA6, 0x9B, 0xAE, 0x30, 0x73, 0x45, 0x36, 0x1A, 0x96, 0xB3,
-    0x53, 0xFF, 0x59, 0x19, 0x80, 0x64, 0xDC, 0xB9, 0xA4, 0x24, 0x3D, 0xD5, 0xD6, 0x7D, 0xFA, 0x12,
-    0x0C, 0xD7, 0xDA, 0x1F, 0x99, 0xBA, 0x40, 0xD2, 0x34, 0x8B, 0x22, 0x36, 0x01, 0x69, 0x60, 0xC4,
-    0x31, 0x64, 0x19, 0xC1, 0x61, 0x03, 0x36, 0x08, 0x47, 0x60, 0x04, 0x32, 0x84, 0x63, 0xA6, 0xA2,
-    0x0B, 0xF6, 0xF7, 0xCC, 0x36, 0x22, 0xB8, 0x47, 0x24, 0x34, 0xCF, 0x90, 0x2C, 0xB4, 0x7B, 0xDF,
-    0x62, 0x5F, 0xC1, 0x59, 0x54, 0xE3, 0xE7, 0x2D, 0x43, 0x35, 0x6C, 0x82, 0x26, 0x29, 0x63, 0xE0,
-    0xC2, 0x46, 0xD8, 0x7A, 0xA3, 0x83, 0x47, 0xEF, 0xDF, 0x70, 0x57, 0xEF, 0xB9, 0xDD, 0x40, 0x30,
-    0x7F, 0x50, 0x8B, 0x4A, 0x3A, 0x82, 0x77, 0x27, 0xC7, 0xED, 0x51, 0x5A, 0xB0, 0x9A, 0xF1, 0x72,
-    0xF3, 0x6C, 0xE7, 0xE1, 0x6F, 0x83, 0xC2, 0xDF, 0x8C, 0x82, 0x56, 0xC0, 0x2F, 0x2E, 0xC3, 0x98,
-    0x21, 0x78, 0x73, 0xE7, 0xB7, 0xC5, 0x85, 0x4B, 0xDF, 0xB2, 0xBB, 0xBB, 0x6F, 0x0E, 0xA6, 0xB3,
-    0x5B, 0x63, 0x08, 0xE3, 0x8D, 0xEA, 0x8B, 0x2D, 0xF7, 0x6D, 0x2C, 0xF7, 0x2E, 0x97, 0xBB, 0x6A,
-    0xB9, 0xDC, 0x87, 0xD4, 0xB8, 0xD7, 0x2C, 0xA8, 0x52, 0xA2, 0x5C, 0x83, 0x8F, 0xBD, 0x1D, 0x84,
-    0x1D, 0x04, 0xDA, 0x82, 0x75, 0xDA, 0x08, 0xB1, 0x5C, 0x46, 0x27, 0x58, 0xA1, 0xD6, 0xE1, 0xEE,
-    0x18, 0x40, 0x7B, 0xB8, 0xB7, 0xF1, 0x3A, 0xFD, 0xD6, 0xC0, 0xC2, 0x36, 0x19, 0xE6, 0x11, 0xCE,
-    0x43, 0x0B, 0x7D, 0x15, 0x3E, 0x84, 0x0C, 0xA5, 0xE4, 0x38, 0x02, 0x79, 0xE1, 0x5F, 0xC1, 0xE3,
-    0xAD, 0xCD, 0xFB, 0x60, 0xB4, 0xC7, 0xA1, 0xFC, 0x59, 0x92, 0x6F, 0x78, 0xDD, 0xE0, 0x75, 0xD1,
-    0x75, 0x04, 0x7B, 0xA6, 0x41, 0xF0, 0x9B, 0xAC, 0xD5, 0xE3, 0x3C, 0xDE, 0xB1, 0x4E, 0xD2, 0xB2,
-    0x00, 0x21, 0xDF, 0xA3, 0x9B, 0x22, 0xA5, 0x75, 0xA8, 0x27, 0x74, 0x99, 0xA1, 0x46, 0x8A, 0xF3,
-    0x0D, 0x24, 0x1A, 0xCD, 0x46, 0x52, 0x3E, 0xA1, 0x03, 0xB8, 0x3B, 0x32, 0x55, 0xFC, 0x6C, 0x1F,
-    0x90, 0xFE, 0xE9, 0xD2, 0xFF, 0xF3, 0x06, 0x14, 0x54, 0xFD, 0x43, 0x66, 0xF5, 0x73, 0x25, 0xB3,
-    0x4C, 0x6D, 0x48, 0xF6, 0x26, 0x74, 0x40, 0xDA, 0x8B, 0x3B, 0xCF, 0x22, 0x62, 0x42, 0xDB, 0x05,
-    0x5D, 0xFC, 0x3E, 0x42, 0x9A, 0x89, 0xAA, 0x99, 0xC1, 0xA6, 0x1F, 0x11, 0x83, 0x2D, 0x30, 0x59,
-    0x7F, 0x04, 0x54, 0xD7, 0x6F, 0xE1, 0x77, 0xB8, 0x5D, 0x04, 0x89, 0x6D, 0x51, 0x26, 0xCC, 0xFB,
-    0x26, 0x4D, 0xBA, 0x05, 0xF5, 0x92, 0xEA, 0x2F, 0x84, 0xB7, 0x9B, 0x63, 0x8D, 0xDF, 0xC1, 0xA9,
-    0xAA, 0x99, 0x4A, 0xAE, 0xB0, 0xD5, 0xC5, 0x6E, 0xA2, 0xF2, 0xEF, 0x80, 0x4A, 0x3D, 0x77, 0x3D,
-    0xE9, 0x4C, 0x6F, 0x4B, 0xFB, 0x76, 0x3F, 0xF7, 0x86, 0xAF, 0x2A, 0x75, 0x44, 0xC2, 0x06, 0x64,
-    0x24, 0xAC, 0x94, 0x57, 0x3D, 0x70, 0x66, 0x64, 0x37, 0xE6, 0x78, 0xA9, 0x6F, 0xB6, 0x7B, 0x47,
-    0x1B, 0x8C, 0x4B, 0x20, 0x34, 0x24, 0x67, 0xBD, 0xA5, 0xCB, 0x8D, 0xB0, 0xC6, 0x0A, 0x7A, 0x1B,
-    0x92, 0xE7, 0x40, 0x61, 0xA4, 0x9A, 0x37, 0xF4, 0x47, 0x03, 0x09, 0xEA, 0x5C, 0x80, 0x83, 0x72,
-    0x41, 0x3C, 0xCA, 0xD9, 0xD3, 0xD7, 0xEC, 0x7F, 0xF1, 0x79, 0xF4, 0xD6, 0x91, 0x3D, 0xA6, 0x41,
-    0x03, 0x42, 0x95, 0x75, 0xE1, 0x76, 0x51, 0x16, 0x57, 0x7A, 0x90, 0xD3, 0xD2, 0x7A, 0x7D, 0x5C,
-    0xC5, 0x57, 0x24, 0xC7, 0x1B, 0xE6, 0xF8, 0x4C, 0x65, 0x51, 0x43, 0xCC, 0x23, 0x49, 0xCA, 0x0F,
-    0x20, 0x42, 0x46, 0xD4, 0xBA, 0xB4, 0xFD, 0xC4, 0x47, 0x0E, 0x09, 0x97, 0xE9, 0x69, 0x47, 0x08,
-    0xE9, 0x4F, 0x94, 0xC3, 0xB7, 0x35, 0xEC, 0x19, 0x3F, 0xDB, 0x91, 0x73, 0xB0, 0x24, 0xC3, 0xFE,
-    0x52, 0xD2, 0x41, 0x90, 0x5C, 0xF5, 0xE3, 0xE2, 0x78, 0x43, 0x5B, 0x8E, 0x0B, 0xAE, 0x80, 0xFC,
-    0x33, 0x86, 0x3B, 0x67, 0x75, 0xB5, 0x14, 0x03, 0x3C, 0x6F, 0xA3, 0x48, 0xCE, 0xCD, 0x3A, 0xED,
-    0x6C, 0xD2, 0x17, 0xCC, 0xED, 0x2E, 0x21, 0x1D, 0x4E, 0x17, 0x1F, 0x56, 0x16, 0x39, 0xFA, 0x0C,
-    0xBC, 0x26, 0x18, 0xE4, 0x10, 0x80, 0xE2, 0xB5, 0x5F, 0x0A, 0xBA, 0xC4, 0xEF, 0xCC, 0xDF, 0x70,
-    0xE5, 0x68, 0x4E, 0xDC, 0x34, 0x38, 0x24, 0x98, 0xE6, 0x25, 0x01, 0xDE, 0xAC, 0x86, 0x96, 0x61,
-    0x44, 0x16, 0x89, 0x00, 0x09, 0xEC, 0x39, 0x53, 0xC9, 0xF7, 0xB5, 0x3D, 0x66, 0xCB, 0x62, 0x12,
-    0x26, 0x3E, 0x5E, 0x8E, 0x30, 0x72, 0xEF, 0x49, 0xEC, 0x79, 0x0A, 0x5C, 0x09, 0xD7, 0x40, 0x6F,
-    0x06, 0x95, 0x0A, 0xA1, 0x1F, 0xA8, 0x2E, 0xA9, 0x20, 0xF9, 0xBE, 0xA2, 0x73, 0x96, 0x51, 0xB7,
-    0x47, 0xF3, 0x2E, 0x49, 0xA7, 0x80, 0xD6, 0xD7, 0xF9, 0xDC, 0x54, 0x49, 0xC3, 0x86, 0x8F, 0x00,
-    0x4B, 0xE1, 0xBA, 0xB2, 0x83, 0x20, 0x2E, 0x2B, 0x20, 0xB8, 0x45, 0x20, 0x76, 0x58, 0xFC, 0xBA,
-    0xE2, 0xFB, 0xCF, 0x1B, 0xB2, 0x3B, 0x5A, 0xD8, 0xDF, 0x99, 0x27, 0x77, 0x95, 0xF5, 0x04, 0x5D,
-    0x9E, 0x31, 0x7D, 0x40, 0x9C, 0xDA, 0x22, 0x1A, 0x9E, 0x6F, 0x52, 0xB8, 0x07, 0xA8, 0x76, 0x42,
-    0x46, 0xBB, 0x8A, 0xC8, 0x61, 0x96, 0x37, 0x2B, 0xF4, 0x0A, 0xD3, 0x22, 0x6A, 0x4D, 0x1D, 0x59,
-    0x20, 0xA4, 0x3F, 0xA7, 0x8E, 0x0C, 0x5D, 0x28, 0x21, 0xC5, 0xBE, 0x59, 0x87, 0xE1, 0xAE, 0x04,
-    0x0F, 0x6C, 0x67, 0x58, 0x61, 0xD1, 0x01, 0xAF, 0xB1, 0xBB, 0xBD, 0xBE, 0x35, 0xF3, 0x5B, 0x60,
-    0x4C, 0xF8, 0x16, 0x38, 0x49, 0x82, 0xEC, 0x79, 0x05, 0x39, 0xC7, 0xF0, 0x0A, 0x33, 0x97, 0xF5,
-    0xA0, 0x64, 0x06, 0x8F, 0x3D, 0x02, 0xD8, 0x13, 0x2E, 0x05, 0x2A, 0xDF, 0xCA, 0x91, 0xCC, 0xE0,
-    0x21, 0x98, 0x8B, 0x34, 0x7E, 0xD3, 0xAA, 0x8D, 0x5D, 0xE4, 0x7C, 0x49, 0xCA, 0xB9, 0x29, 0x07,
-    0x0F, 0x79, 0x4C, 0x78, 0x73, 0x3E, 0x3C, 0x89, 0x04, 0x76, 0xB5, 0xD1, 0x48, 0xCA, 0x49, 0x75,
-    0xDF, 0x99, 0x0A, 0xD4, 0x42, 0xBF, 0xDC, 0x70, 0xFA, 0x5B, 0xFB, 0xFC, 0x7C, 0x68, 0xD9, 0x9D,
-    0x18, 0x78, 0xD3, 0x91, 0x1C, 0x1B, 0x1B, 0x5E, 0x39, 0xD7, 0x00, 0xB2, 0xC4, 0x1D, 0x3B, 0x27,
-    0x62, 0x41, 0xC3, 0x24, 0x91, 0xCC, 0x59, 0x1F, 0x80, 0x1E, 0x39, 0x62, 0x16, 0xF7, 0xFF, 0x6C,
-    0xBC, 0x6B, 0xDF, 0xB4, 0xBA, 0x8F, 0x9B, 0x24, 0xDF, 0xA3, 0x93, 0x87, 0x83, 0x5C, 0x25, 0x7E,
-    0xA5, 0xC2, 0xDD, 0xFB, 0x0E, 0x6E, 0xB1, 0x1B, 0x54, 0x94, 0x45, 0x03, 0x4D, 0xB3, 0x03, 0x09,
-    0xDD, 0xC1, 0x92, 0x00, 0xC6, 0x0E, 0xA1, 0xBF, 0x11, 0xA7, 0x2A, 0x7E, 0x09, 0x86, 0xBE, 0x8B,
-    0x8F, 0x8F, 0x8D, 0x3B, 0x61, 0x61, 0x1E, 0xE3, 0xC6, 0xB8, 0x41, 0x46, 0xCE, 0xB9, 0xDE, 0xD9,
-    0x96, 0x34, 0xDC, 0x89, 0xF0, 0xC0, 0x74, 0xF4, 0xBF, 0xCF, 0xA4, 0xF2, 0xE5, 0x69, 0x09, 0xF2,
-    0x2A, 0x17, 0x96, 0x33, 0xB1, 0x6F, 0xBE, 0xC6, 0xC6, 0x57, 0x4A, 0xC2, 0xB2, 0x7C, 0xEA, 0xDE,
-    0x1A, 0xFB, 0x9E, 0xF8, 0xEE, 0xCE, 0x24, 0x65, 0x8B, 0xEF, 0xE6, 0x77, 0x4D, 0x7E, 0xD1, 0x55,
-    0x91, 0x63, 0x2E, 0x36, 0xB4, 0x8F, 0x83, 0x26, 0x79, 0x2C, 0xD3, 0x79, 0xE8, 0x07, 0x06, 0xE7,
-    0xA3, 0x8A, 0x7C, 0xBC, 0xE3, 0x59, 0x65, 0x36, 0xEF, 0x6D, 0x82, 0x78, 0x91, 0x79, 0x21, 0x6F,
-    0xBC, 0x42, 0x2F, 0xDA, 0x65, 0x47, 0x17, 0xA6, 0x83, 0xA1, 0x97, 0x54, 0x76, 0xCE, 0x8E, 0x4C,
-    0xE0, 0x03, 0xA8, 0x8A, 0x87, 0x8A, 0xA4, 0x07, 0x1D, 0x45, 0x22, 0xB9, 0xD0, 0x00, 0x63, 0x61,
-    0x6F, 0x5B, 0xED, 0xC1, 0xD2, 0xC7, 0xBB, 0x89, 0x7A, 0xEA, 0x26, 0x2A, 0x7F, 0x44, 0x14, 0xC5,
-    0xEF, 0x21, 0xB4, 0x47, 0x9E, 0x25, 0xDC, 0x64, 0xD3, 0xC1, 0xFC, 0xF5, 0x7A, 0x36, 0xEF, 0x26,
-    0x66, 0xA8, 0x97, 0x75, 0x93, 0x34, 0x08, 0x7E, 0xFB, 0xB3, 0x4F, 0x74, 0x13, 0x85, 0x47, 0xAA,
-    0x89, 0x47, 0x56, 0xC9, 0xD5, 0x26, 0xBC, 0x3B, 0xBE, 0xD6, 0x73, 0x89, 0xF5, 0xEC, 0x94, 0x94,
-    0x47, 0x95, 0x8D, 0xF7, 0xF1, 0xC8, 0xC7, 0xD6, 0x95, 0xFF, 0x2A, 0xE0, 0x46, 0xF7, 0xC8, 0x6F,
-    0x86, 0xCD, 0xE3, 0xE2, 0x8D, 0xB0, 0x15, 0x3C, 0xF3, 0xA5, 0x13, 0xC1, 0x3E, 0x51, 0x54, 0xB9,
-    0xEE, 0x99, 0x9C, 0x98, 0x79, 0x3D, 0x99, 0x50, 0xCF, 0xE6, 0xC3, 0x20, 0xD4, 0x85, 0xE4, 0xA1,
-    0x68, 0x94, 0x3B, 0xB1, 0x9F, 0xFA, 0x53, 0x6A, 0xCF, 0x39, 0x96, 0x20, 0xF1, 0x68, 0xFA, 0xC0,
-    0x06, 0x7D, 0xF4, 0x91, 0xDF, 0xC7, 0xF0, 0x12, 0xA2, 0xC9, 0x26, 0xBE, 0x41, 0xCD, 0xC6, 0x1A,
-    0xB6, 0xC7, 0xCA, 0x84, 0x37, 0xA2, 0x16, 0x73, 0xC7, 0x3E, 0x4C, 0x79, 0x88, 0xBD, 0xF9, 0xFA,
-    0xF3, 0xF6, 0xE6, 0xAD, 0xF4, 0xE6, 0xFB, 0xBD, 0x46, 0x97, 0x70, 0x07, 0xC7, 0x25, 0x84, 0x10,
-    0x2A, 0xBD, 0xAF, 0xD8, 0xFD, 0x22, 0xE5, 0xD0, 0x21, 0x94, 0x43, 0x37, 0xC1, 0x46, 0x2E, 0xF0,
-    0x00, 0x47, 0xF9, 0x8D, 0x5B, 0xF9, 0x27, 0xEE, 0xE8, 0xEF, 0x4B, 0x9F, 0x68, 0x82, 0x78, 0xD9,
-    0x5F, 0x83, 0x53, 0x8E, 0x9F, 0xAB, 0x09, 0xE2, 0xBD, 0x01, 0x89, 0x7D, 0xE0, 0xFE, 0x25, 0x20,
-    0x16, 0xE8, 0xCD, 0x01, 0xFB, 0x2A, 0x52, 0x02, 0x6C, 0xBC, 0x71, 0x10, 0x7F, 0x03, 0x11, 0x31,
-    0xDE, 0xD0, 0x05, 0x1F, 0xD6, 0xF1, 0x2B, 0x97, 0x59, 0x21, 0x4F, 0xD8, 0x77, 0x7F, 0x23, 0x99,
-    0x0E, 0x5B, 0xB2, 0x25, 0x1D, 0x97, 0x61, 0x7B, 0xBC, 0xF1, 0xFB, 0xBF, 0xE8, 0x54, 0x11, 0xE3,
-    0xCD, 0x77, 0xD8, 0x41, 0x41, 0x9E, 0x18, 0x5F, 0x81, 0x29, 0xFC, 0xF2, 0x97, 0x34, 0x92, 0x3F,
-    0xB5, 0x10, 0xF9, 0x07, 0x48, 0xF2, 0x7F, 0x81, 0x42, 0xE4, 0x5F, 0x36, 0xFE, 0x60, 0xA6, 0x42,
-    0xC4, 0xB2, 0x6A, 0x4F, 0xC1, 0x03, 0xF3, 0x4F, 0x16, 0x22, 0x72, 0xAE, 0x46, 0x08, 0xF0, 0x5A,
-    0x6F, 0x7D, 0x1D, 0x39, 0x95, 0xAC, 0xCD, 0xBA, 0x26, 0xD5, 0x27, 0x86, 0x43, 0x1E, 0x68, 0x62,
-    0x64, 0xD9, 0x99, 0x1E, 0xBF, 0x5D, 0x45, 0xBC, 0x91, 0x02, 0xFF, 0x61, 0x23, 0x2B, 0xCC, 0x24,
-    0x7F, 0x21, 0x71, 0x21, 0x4E, 0x3C, 0xF9, 0x7B, 0x54, 0xA4, 0x24, 0x6D, 0x45, 0xFE, 0xA9, 0x47,
-    0x96, 0xBE, 0x6C, 0x6C, 0xD9, 0x9E, 0x84, 0x11, 0xAD, 0x53, 0xCE, 0xA7, 0x1C, 0x59, 0xB2, 0x95,
-    0x71, 0xCE, 0xDA, 0x97, 0x2E, 0xCE, 0x96, 0xFC, 0xEE, 0xCB, 0x00, 0x6E, 0x40, 0x40, 0x0E, 0x85,
-    0x0F, 0x87, 0xC2, 0x26, 0x4C, 0xDE, 0xBA, 0x04, 0x02, 0x98, 0xED, 0xFC, 0x82, 0xDB, 0x7A, 0x3C,
-    0x00, 0x39, 0x8B, 0xDB, 0x3E, 0x31, 0xDD, 0x61, 0x65, 0x7E, 0xB0, 0x38, 0xE2, 0xCD, 0x0C, 0xD6,
-    0x0B, 0x51, 0x6C, 0x42, 0x70, 0x2B, 0xED, 0x53, 0x18, 0xB4, 0x0E, 0xE1, 0x2D, 0x5E, 0x9F, 0x58,
-    0x19, 0xC6, 0x30, 0x6E, 0x37, 0x47, 0xB2, 0x52, 0x0E, 0xE8, 0xFC, 0x89, 0x8B, 0xC4, 0xD6, 0x1E,
-    0x67, 0x5F, 0xE4, 0x28, 0xF0, 0xF9, 0x50, 0xD0, 0x2C, 0x79, 0x9C, 0x74, 0x61, 0xBF, 0x1B, 0xE5,
-    0x99, 0x45, 0x62, 0xB9, 0x02, 0xF4, 0x80, 0x7B, 0x1B, 0x5E, 0x0F, 0x5E, 0x13, 0x55, 0x5F, 0x82,
-    0xED, 0x6E, 0xC3, 0xDB, 0xC0, 0x1F, 0x2E, 0xFE, 0x7A, 0xCF, 0x2B, 0x5D, 0x3A, 0x8C, 0x9D, 0x91,
-    0x62, 0x27, 0x4E, 0xE2, 0x2C, 0xF6, 0xB4, 0xFB, 0xF1, 0xD4, 0x22, 0xA2, 0x1F, 0x5A, 0x7F, 0xE6,
-    0xC5, 0xD1, 0x6B, 0xE2, 0xBF, 0xDB, 0x6B, 0xD6, 0xFA, 0x52, 0x93, 0x08, 0x59, 0xF2, 0x2E, 0x89,
-    0xFF, 0x56, 0x0F, 0xE7, 0x00, 0x95, 0x36, 0x06, 0x13, 0x3B, 0x95, 0x0A, 0x00, 0x99, 0xFC, 0x41,
-    0x1B, 0x42, 0x87, 0xC9, 0x1F, 0xF4, 0x26, 0x0F, 0x6D, 0xFC, 0x8B, 0x02, 0x3B, 0x3F, 0x02, 0xBC,
-    0x46, 0x6C, 0xFA, 0xC2, 0x44, 0x49, 0x09, 0x03, 0x99, 0x92, 0xD4, 0xED, 0x45, 0xCE, 0x38, 0x1D,
-    0xE7, 0xE4, 0x0C, 0xA5, 0xD8, 0x3B, 0x93, 0x1C, 0x89, 0x4E, 0x9F, 0x38, 0x93, 0xEC, 0x3F, 0x76,
-    0x26, 0x59, 0x09, 0x43, 0x9D, 0xAB, 0x20, 0x56, 0xF3, 0x97, 0x6F, 0x2C, 0x9A, 0x29, 0x9F, 0x8D,
-    0xFC, 0x8C, 0x20, 0x3F, 0xD7, 0xDB, 0x68, 0x70, 0xC1, 0xBF, 0x2A, 0x3F, 0x18, 0x8C, 0xCF, 0xC8,
-    0xD6, 0xBF, 0xC9, 0x1B, 0x66, 0xE0, 0xC4, 0x69, 0xC6, 0x33, 0x76, 0x9E, 0xA7, 0xE6, 0x3C, 0x62,
-    0xF9, 0x1F, 0x30, 0x5C, 0x78, 0xF7, 0x65, 0x54, 0xE1, 0xFD, 0x3B, 0x72, 0xA0, 0x4A, 0xF7, 0xE1,
-    0x09, 0x83, 0x7E, 0x27, 0x93, 0xDF, 0x30, 0xE9, 0xBD, 0xC7, 0xB3, 0x90, 0x15, 0xE9, 0xE8, 0x6B,
-    0x9E, 0x13, 0xFA, 0xC4, 0x3E, 0xA4, 0x69, 0x04, 0x46, 0xB8, 0x97, 0xA6, 0x56, 0x38, 0xF7, 0x66,
-    0xBA, 0x00, 0x5C, 0x25, 0xFA, 0xDF, 0xC1, 0xBD, 0x58, 0x05, 0x1F, 0x1E, 0x06, 0x4B, 0x7A, 0x03,
-    0xE1, 0x8A, 0xAD, 0xFE, 0x2D, 0x14, 0xF9, 0xB7, 0x67, 0x55, 0xFC, 0x5F, 0xCD, 0x6F, 0xC6, 0x25,
-    0x3B, 0x18, 0x71, 0xE7, 0x86, 0x8E, 0x7E, 0xF1, 0xC0, 0x8E, 0x97, 0x55, 0x9B, 0x40, 0x84, 0x7B,
-    0x8B, 0xE3, 0xDE, 0xE8, 0x0B, 0x0D, 0xEC, 0x30, 0x66, 0x21, 0xC4, 0xA9, 0x52, 0xF2, 0x6A, 0x9C,
-    0xAF, 0x18, 0xAB, 0xDF, 0x2E, 0xFE, 0xED, 0x10, 0x34, 0x63, 0xB9, 0xB1, 0xAA, 0xA2, 0x77, 0x90,
-    0x02, 0x1A, 0xA9, 0x68, 0x46, 0x94, 0x71, 0x6F, 0x96, 0x7E, 0x3F, 0xFB, 0x4D, 0x73, 0x1E, 0x64,
-    0x32, 0xE9, 0x32, 0xC9, 0xC6, 0x72, 0x90, 0xF0, 0x4D, 0x00, 0x49, 0x95, 0xDD, 0xE4, 0x4B, 0xDB,
-    0x71, 0x97, 0x67, 0xC1, 0x70, 0x94, 0x46, 0xCD, 0x91, 0x7A, 0x47, 0x07, 0x46, 0xA5, 0x78, 0x00,
-    0x2B, 0x42, 0xAC, 0x45, 0x7E, 0xD7, 0xCE, 0x48, 0xF0, 0x64, 0x9E, 0x4A, 0x58, 0x7E, 0x29, 0xFC,
-    0x1F, 0x5B, 0x0E, 0xA1, 0x27, 0x76, 0x5B, 0xB2, 0x0A, 0xF9, 0x7A, 0xAE, 0x44, 0xD0, 0x96, 0x25,
-    0xD8, 0x14, 0x8C, 0xE7, 0xBC, 0x3D, 0x1C, 0x9F, 0xF8, 0xF9, 0x11, 0x93, 0xA8, 0xA7, 0x61, 0x6E,
-    0xB5, 0xB1, 0x6F, 0x82, 0x6E, 0xA0, 0xD3, 0x9A, 0xDF, 0x00, 0x2C, 0x21, 0xB5, 0xC5, 0x28, 0x5A,
-    0xA3, 0x7A, 0x31, 0x91, 0xF3, 0x00, 0x47, 0xBF, 0xCD, 0x03, 0x1C, 0xFD, 0xF6, 0x72, 0xF4, 0x5B,
-    0x2E, 0xE6, 0x9D, 0x24, 0xF5, 0xBB, 0xB8, 0x3D, 0xB2, 0x37, 0x93, 0xE3, 0x98, 0x75, 0x0C, 0xB8,
-    0x33, 0x6C, 0x98, 0x74, 0x28, 0xBA, 0x5A, 0x5D, 0x83, 0xB6, 0x56, 0xA1, 0xC3, 0xE0, 0x92, 0xAD,
-    0x3F, 0xA6, 0x7E, 0x38, 0xC0, 0xD7, 0x41, 0x65, 0xE1, 0x04, 0x19, 0x9C, 0xC0, 0xBC, 0x30, 0x41,
-    0x41, 0xEF, 0x58, 0x8F, 0xF4, 0xD8, 0x72, 0x91, 0x87, 0xE7, 0x2C, 0x95, 0x9C, 0x09, 0xB7, 0x91,
-    0x0C, 0x3D, 0x62, 0x87, 0xBD, 0x6C, 0x51, 0xE7, 0x22, 0x54, 0x2B, 0x52, 0x2D, 0x4D, 0x62, 0x39,
-    0xB9, 0x26, 0xC1, 0x9C, 0x64, 0x4E, 0xB4, 0x49, 0x36, 0x27, 0xDC, 0x24, 0x9D, 0x13, 0xCF, 0x1D,
-    0x6D, 0xAB, 0xF9, 0xD9, 0xB6, 0x2B, 0x8E, 0xB4, 0xBD, 0x0E, 0xCB, 0xC0, 0x10, 0x7E, 0x9F, 0x40,
-    0x86, 0x1B, 0x1D, 0x0A, 0xAA, 0x13, 0x79, 0xE6, 0xC6, 0x05, 0xA0, 0xB8, 0x5B, 0x3C, 0x9A, 0x46,
-    0x7E, 0x66, 0x0F, 0x13, 0x59, 0x38, 0x06, 0x5F, 0xCA, 0x33, 0x0E, 0x7D, 0xDA, 0x7D, 0x23, 0x2D,
-    0xEB, 0x92, 0x1A, 0xAC, 0x64, 0x03, 0xEB, 0xB6, 0xE0, 0xE6, 0x72, 0xE4, 0x74, 0xA5, 0x9B, 0x4E,
-    0x70, 0x19, 0x01, 0x51, 0xE3, 0x0D, 0xCC, 0x45, 0x6E, 0x84, 0x94, 0x67, 0x21, 0x3C, 0x88, 0x34,
-    0xE7, 0x90, 0xD5, 0xAA, 0xB0, 0xE5, 0x1C, 0x90, 0x8C, 0xC4, 0xF1, 0x28, 0x44, 0x8E, 0xA9, 0x2D,
-    0xC1, 0x07, 0xF9, 0xC9, 0xEF, 0xB3, 0x31, 0x04, 0x2B, 0x79, 0xC9, 0xD6, 0xB6, 0x0F, 0xDD, 0x39,
-    0x6D, 0x21, 0x66, 0x48, 0x04, 0x4F, 0xFE, 0x9D, 0xBC, 0x25, 0xF3, 0x8C, 0x6A, 0xAF, 0x97, 0x20,
-    0xD4, 0x3D, 0x6E, 0x0D, 0x4C, 0xBD, 0x83, 0xEC, 0x17, 0xEC, 0x6E, 0xD7, 0xE4, 0xEE, 0x8C, 0x22,
-    0x64, 0x70, 0x30, 0x24, 0xCB, 0x1A, 0xCD, 0x22, 0xAE, 0x92, 0xCB, 0x03, 0xAC, 0x95, 0x17, 0x31,
-    0x9B, 0xB7, 0x2C, 0x3D, 0x4C, 0x92, 0xA3, 0xE8, 0x30, 0x20, 0x8A, 0x1B, 0x6A, 0x62, 0xA9, 0x34,
-    0xDA, 0x32, 0x8F, 0xBC, 0xE2, 0xD7, 0x2B, 0x0A, 0x9C, 0xBA, 0x43, 0x4A, 0xF5, 0x1D, 0x39, 0x2F,
-    0xC6, 0x5B, 0xE1, 0x88, 0xEC, 0x16, 0xF5, 0xD8, 0x67, 0xD8, 0x45, 0xBB, 0x3C, 0xE1, 0x6B, 0xCC,
-    0x51, 0x42, 0x44, 0x0D, 0x1E, 0x00, 0xAC, 0xC5, 0xB2, 0x83, 0x1C, 0xA0, 0xC0, 0x61, 0x40, 0xA1,
-    0x46, 0x1F, 0x39, 0x0B, 0x6F, 0x86, 0x8D, 0x6E, 0xF4, 0x56, 0xEB, 0x59, 0x1E, 0x12, 0x9B, 0x9D,
-    0x02, 0x95, 0xBD, 0x9C, 0xFC, 0xC5, 0xF6, 0xF5, 0xB9, 0x24, 0xA4, 0xBE, 0x88, 0x6B, 0x7F, 0x38,
-    0x90, 0x87, 0x75, 0x86, 0x6C, 0xBB, 0xD3, 0x27, 0xC7, 0x9A, 0x4D, 0x13, 0x54, 0x9B, 0x26, 0xAC,
-    0x90, 0xA3, 0x4A, 0x24, 0xCC, 0xB7, 0x1B, 0x73, 0xEC, 0xFD, 0x2A, 0xB9, 0x02, 0x6E, 0x6F, 0xED,
-    0x3F, 0xF5, 0xED, 0x76, 0xEF, 0xF8, 0xF4, 0xC3, 0x3C, 0xBE, 0xE7, 0x5C, 0x1A, 0x83, 0xFF, 0x87,
-    0xD3, 0xCC, 0xAE, 0xAE, 0xD5, 0xC7, 0x0E, 0x40, 0x3E, 0xB5, 0x29, 0xDC, 0xF0, 0xFF, 0x55, 0x60,
-    0x7B, 0xAD, 0xBE, 0x9C, 0x3E, 0xA4, 0x61, 0x00, 0x36, 0x1D, 0xE6, 0x5D, 0x55, 0x46, 0x2C, 0x11,
-    0x54, 0x06, 0xE9, 0x9A, 0xBD, 0xC3, 0x91, 0xCF, 0xDB, 0x86, 0x7E, 0x8B, 0x6D, 0xE8, 0x41, 0xDA,
-    0xD0, 0x5B, 0x6C, 0x43, 0x9F, 0x91, 0xC4, 0x2D, 0x30, 0x70, 0x66, 0x71, 0x00, 0xEE, 0xC0, 0xE2,
-    0x88, 0x8C, 0x23, 0x1C, 0x47, 0xF6, 0xEF, 0x4D, 0x17, 0x0A, 0xBB, 0x4A, 0xA5, 0x99, 0x84, 0xC2,
-    0x90, 0xB5, 0x1C, 0xBC, 0xE6, 0x1A, 0xCB, 0x62, 0xE9, 0x32, 0x3B, 0xA8, 0x76, 0xF3, 0x05, 0x94,
-    0x48, 0x26, 0x62, 0xF9, 0xAE, 0xCC, 0xE3, 0xB0, 0xC9, 0xEA, 0xDC, 0x79, 0x29, 0x6A, 0xE3, 0x77,
-    0x6C, 0xD0, 0x9D, 0x2E, 0xC1, 0x6E, 0x92, 0x74, 0xD0, 0x65, 0x72, 0xBE, 0x0E, 0x6F, 0x34, 0x5E,
-    0xD7, 0xA9, 0xD5, 0x4D, 0x26, 0x7C, 0x0E, 0x9D, 0x0F, 0x6A, 0x41, 0xBA, 0x64, 0x9A, 0x10, 0xEF,
-    0xA2, 0xE4, 0x7B, 0xED, 0x47, 0x0F, 0xB6, 0xA3, 0xE5, 0xE2, 0x16, 0xB3, 0x4E, 0xFD, 0x10, 0x76,
-    0xF4, 0x98, 0x5D, 0x63, 0x49, 0xF0, 0x0B, 0x76, 0xF4, 0xA8, 0x26, 0x20, 0x2A, 0x4E, 0x40, 0x74,
-    0x53, 0x63, 0x6A, 0x62, 0x77, 0x42, 0x34, 0x1C, 0x66, 0x37, 0x7B, 0xA8, 0xF0, 0x19, 0x9B, 0xEE,
-    0xDF, 0x36, 0xAD, 0x6D, 0x4D, 0xCD, 0x46, 0x07, 0xBB, 0x18, 0x5C, 0xC1, 0x6B, 0x5D, 0x67, 0x99,
-    0x89, 0x48, 0xE7, 0x28, 0x3A, 0xD2, 0xF5, 0x35, 0x54, 0x1C, 0x2F, 0x11, 0xBA, 0x87, 0x78, 0x0C,
-    0xAE, 0xB7, 0xEC, 0xA9, 0xC4, 0x5B, 0x48, 0x7E, 0x87, 0x8A, 0x6F, 0x70, 0x9A, 0x42, 0xBA, 0x69,
-    0xF8, 0x9F, 0x61, 0xA0, 0x64, 0x00, 0x40, 0xB9, 0xF9, 0x0B, 0x37, 0xED, 0x2D, 0xA6, 0x63, 0x63,
-    0xAA, 0x91, 0xF1, 0x1E, 0x29, 0x9D, 0x8A, 0xF5, 0x3F, 0xE8, 0x58, 0xC7, 0x00, 0x03, 0xAC, 0x83,
-    0x55, 0x4E, 0x21, 0x2E, 0x26, 0x44, 0x5D, 0xB9, 0xEC, 0xE6, 0x44, 0x17, 0x85, 0x68, 0xC2, 0x43,
-    0x65, 0x7C, 0xA3, 0x34, 0x7E, 0xD8, 0xC7, 0x03, 0x7F, 0xFF, 0x38, 0x47, 0xFB, 0x20, 0xE3, 0x1C,
-    0x3C, 0x3D, 0xB0, 0xD3, 0xE8, 0xCD, 0xDE, 0xF9, 0xCA, 0x91, 0xFD, 0x79, 0xF5, 0xB3, 0x1D, 0x45,
-    0xDC, 0x84, 0x36, 0x59, 0xD4, 0x43, 0x71, 0x1F, 0xE6, 0x8E, 0x45, 0x6E, 0xBA, 0x3C, 0x8D, 0xF0,
-    0x87, 0x91, 0xE8, 0xF5, 0xFF, 0x64, 0xDF, 0x9E, 0xE3, 0x4A, 0xC6, 0x5C, 0x58, 0x6F, 0xEA, 0x1B,
-    0x5B, 0xC8, 0x48, 0x4F, 0x21, 0xAB, 0xDC, 0xBD, 0xDA, 0xCE, 0xF7, 0xDC, 0xA8, 0x03, 0x3B, 0x80,
-    0x96, 0x88, 0x99, 0xF3, 0x03, 0x2C, 0xBC, 0x34, 0xDF, 0x7C, 0xE0, 0xB2, 0x5A, 0xEA, 0x36, 0x16,
-    0x6F, 0x59, 0x45, 0x08, 0x6D, 0x79, 0x58, 0x10, 0x7F, 0x3F, 0x53, 0x1B, 0xFF, 0xA2, 0xF3, 0xC6,
-    0xED, 0x4A, 0x36, 0xF6, 0x53, 0x7C, 0xFC, 0x9D, 0x3B, 0xCA, 0x4F, 0xDC, 0xC6, 0xBC, 0x71, 0x31,
-    0x2B, 0xA0, 0x64, 0xF2, 0x90, 0xAC, 0xC6, 0x9F, 0xEB, 0x43, 0xC2, 0x9E, 0xCE, 0x1E, 0xEE, 0xB2,
-    0x78, 0x64, 0x5D, 0xB6, 0x73, 0x9A, 0xB9, 0xB0, 0x48, 0x91, 0x09, 0x1B, 0xC9, 0xA0, 0xA2, 0x68,
-    0x19, 0x97, 0xC9, 0xE3, 0x9A, 0xF1, 0x72, 0xCD, 0x7E, 0x00, 0x15, 0xDE, 0xDF, 0x8D, 0xA4, 0x07,
-    0xD1, 0x4E, 0x49, 0x9E, 0x82, 0x2A, 0xD6, 0xC1, 0x5D, 0x5B, 0xC6, 0xFF, 0x07, 0xA9, 0xEB, 0x46,
-    0xEF, 0x8F, 0x11, 0x32, 0x0B, 0xEB, 0x3B, 0xD7, 0x7D, 0xF8, 0xA5, 0xDD, 0xC8, 0x3F, 0xCD, 0x27,
-    0x0E, 0x87, 0xB4, 0x7F, 0xE0, 0xDC, 0xE8, 0x8F, 0x09, 0xAC, 0x65, 0x57, 0xE1, 0xA6, 0xE3, 0x2A,
-    0x39, 0x85, 0xC9, 0x4A, 0x10, 0x50, 0x0E, 0xAC, 0x85, 0xE2, 0x8E, 0xC4, 0x86, 0xE9, 0x25, 0x77,
-    0x28, 0xF6, 0x3D, 0xA0, 0x39, 0x3D, 0x78, 0x2C, 0x6A, 0x52, 0x12, 0x56, 0x8C, 0x0B, 0xB2, 0xBC,
-    0xCC, 0xEC, 0xC8, 0x09, 0x62, 0xF8, 0xF8, 0xF0, 0x55, 0x13, 0xDC, 0xB9, 0xD3, 0xC5, 0x2F, 0xBD,
-    0x74, 0xA5, 0x8B, 0xB3, 0x02, 0xC9, 0x85, 0x9D, 0x6C, 0x0F, 0x45, 0xC1, 0xD3, 0xCA, 0xDC, 0x6E,
-    0x45, 0xD1, 0xC5, 0x22, 0xA5, 0x3C, 0xB2, 0x7D, 0x51, 0xEF, 0x2E, 0x96, 0x8E, 0x2C, 0x86, 0xAD,
-    0x0F, 0x2F, 0x66, 0xAD, 0x3F, 0xCF, 0x86, 0x8F, 0x38, 0x78, 0xA0, 0x17, 0xF3, 0x91, 0x96, 0x6F,
-    0x7F, 0x91, 0x87, 0x3B, 0xA4, 0x07, 0xA6, 0x0E, 0xC8, 0x22, 0xD2, 0x58, 0xE2, 0xD7, 0xE8, 0x0E,
-    0x0C, 0x93, 0xC9, 0xA9, 0x4E, 0xEE, 0x6B, 0x40, 0x4D, 0x65, 0xB5, 0x01, 0xFE, 0xA1, 0xDC, 0xD5,
-    0x7D, 0x84, 0xAA, 0xB7, 0xF4, 0x4F, 0xE5, 0x33, 0x6F, 0x78, 0x95, 0x75, 0x75, 0x4A, 0x91, 0x8F,
-    0xE8, 0x4A, 0xE6, 0xC6, 0xCF, 0x37, 0x6C, 0x63, 0xF9, 0x77, 0x7A, 0x91, 0xBC, 0x70, 0x3D, 0xCE,
-    0x42, 0x82, 0x52, 0x65, 0x27, 0xB6, 0x24, 0x2E, 0xCF, 0x37, 0xBC, 0x19, 0x2A, 0x6B, 0x92, 0x79,
-    0x53, 0xCD, 0x84, 0xCE, 0xD7, 0x26, 0x2D, 0x52, 0x12, 0xC6, 0x8A, 0xDD, 0x32, 0x57, 0x5A, 0xF3,
-    0x69, 0x85, 0x3C, 0xB9, 0xEF, 0x81, 0x1E, 0x6A, 0xF0, 0x29, 0xBF, 0x24, 0x52, 0x3E, 0xC1, 0x3C,
-    0x49, 0x92, 0xBA, 0x8F, 0x91, 0x79, 0xA9, 0x07, 0xFF, 0xCD, 0xCA, 0x33, 0x21, 0x00, 0x78, 0xAB,
-    0xC9, 0xDA, 0x55, 0xAB, 0xCF, 0xFF, 0xDF, 0xB2, 0xEA, 0x2F, 0xA1, 0x8A, 0xF3, 0x3F, 0xFC, 0x80,
-    0x80, 0x63, 0xDF, 0x95, 0xC2, 0x82, 0x10, 0x32, 0xF0, 0xF2, 0xF0, 0xDA, 0x2E, 0xD6, 0x43, 0x81,
-    0xF0, 0xE2, 0xE5, 0xDB, 0x75, 0xC7, 0x38, 0x08, 0x2A, 0xB0, 0x89, 0x3A, 0xF6, 0x47, 0xF5, 0xC0,
-    0x8F, 0x41, 0x54, 0x44, 0xA0, 0x8E, 0x87, 0x01, 0x83, 0x34, 0x09, 0x69, 0x00, 0x2B, 0xC3, 0x39,
-    0x6E, 0xDA, 0x2D, 0xE4, 0x4B, 0xC6, 0x28, 0x47, 0x55, 0x35, 0x4C, 0x33, 0xF7, 0x4B, 0x64, 0x9C,
-    0xCF, 0x9C, 0x66, 0xC0, 0x31, 0x21, 0xC5, 0xFB, 0xFA, 0x95, 0x28, 0x58, 0x67, 0xA6, 0x4B, 0x1A,
-    0x73, 0xE1, 0xE7, 0x41, 0x0B, 0x9A, 0x1E, 0xA3, 0x90, 0xAC, 0xE8, 0x16, 0x1A, 0x02, 0x0C, 0x3C,
-    0x61, 0xE3, 0x21, 0x5C, 0x8B, 0xD0, 0x3B, 0xD6, 0x32, 0x0B, 0x1A, 0x36, 0x96, 0x3C, 0x24, 0xDF,
-    0xD5, 0x22, 0x05, 0x51, 0x94, 0x7E, 0xCF, 0x23, 0x9C, 0xD1, 0x6D, 0x38, 0xA3, 0xBB, 0x6F, 0x64,
-    0xAF, 0x5F, 0xD4, 0x34, 0x61, 0x75, 0xDF, 0xF0, 0x98, 0x9C, 0xBA, 0xC0, 0x9A, 0x52, 0x68, 0xEB,
-    0xAB, 0x8D, 0xCC, 0x54, 0x04, 0x75, 0xCF, 0x8E, 0x0C, 0x6E, 0x02, 0x36, 0xC7, 0xA1, 0x8A, 0xF8,
-    0x58, 0xE3, 0xE9, 0xCB, 0xFD, 0x8F, 0x51, 0x15, 0xF6, 0xA6, 0x4E, 0x40, 0xA5, 0xE5, 0x04, 0x9D,
-    0x6E, 0xEF, 0xD7, 0xD3, 0x99, 0x6B, 0xE3, 0xBC, 0xE0, 0x91, 0x8D, 0xE7, 0xA6, 0x26, 0x47, 0x09,
-    0xE3, 0x6A, 0x00, 0x91, 0x8C, 0xD3, 0x45, 0xC1, 0xDF, 0x50, 0x32, 0x76, 0x06, 0xD5, 0xE2, 0xF4,
-    0xE7, 0x33, 0x0D, 0x67, 0x8C, 0x28, 0x6C, 0x5A, 0x77, 0x26, 0x52, 0xA8, 0x81, 0x34, 0x8E, 0xCB,
-    0x19, 0xE5, 0x3D, 0xDB, 0x82, 0xE7, 0x97, 0x72, 0x0E, 0x75, 0x3A, 0xFF, 0x55, 0x95, 0x9C, 0xED,
-    0x22, 0xC9, 0x0B, 0xAB, 0xF4, 0xDA, 0x05, 0x32, 0x3D, 0x58, 0xC9, 0xF9, 0xD4, 0x54, 0x72, 0xF6,
-    0x28, 0x39, 0x3B, 0x67, 0x13, 0xDA, 0x87, 0xAC, 0x55, 0x4B, 0x23, 0xF6, 0xA1, 0x8D, 0x68, 0x46,
-    0xF3, 0x11, 0x4D, 0x86, 0x17, 0xFB, 0x81, 0x92, 0x8B, 0xC5, 0x11, 0xBE, 0xB2, 0x6F, 0x5A, 0xCD,
-    0xA6, 0x33, 0x03, 0x1A, 0x62, 0x58, 0x46, 0x26, 0xE5, 0x46, 0xD0, 0xA1, 0x8C, 0x49, 0xB3, 0x82,
-    0x05, 0xA0, 0x3A, 0xF0, 0x5C, 0x23, 0xBC, 0x9E, 0x25, 0x19, 0x23, 0xA0, 0x24, 0x3E, 0x07, 0x0E,
-    0x54, 0xE9, 0x59, 0x87, 0x7E, 0x85, 0xD3, 0xE5, 0xA3, 0x9B, 0x2E, 0x4F, 0xD5, 0xBC, 0x53, 0x35,
-    0xC5, 0x89, 0x6B, 0xFB, 0xBB, 0xC7, 0x74, 0xD4, 0xFE, 0x89, 0xAB, 0xCF, 0x35, 0x4B, 0xF4, 0x3C,
-    0x67, 0x89, 0x06, 0xCE, 0x12, 0x59, 0xCE, 0x12, 0x89, 0xED, 0x85, 0xCF, 0xB9, 0xA1, 0x85, 0x76,
-    0x11, 0x99, 0x48, 0xF5, 0x8F, 0x9D, 0x54, 0x2E, 0x8D, 0xC4, 0x42, 0x0F, 0xF7, 0xCA, 0x2A, 0x99,
-    0x0A, 0x9D, 0x29, 0xC7, 0x20, 0x3D, 0x99, 0x0A, 0xF7, 0x65, 0x24, 0x33, 0xE0, 0x41, 0xBD, 0x9A,
-    0x66, 0xF9, 0x52, 0x3E, 0x53, 0xC9, 0x26, 0x99, 0x4F, 0xB7, 0x86, 0x43, 0xCB, 0xC1, 0xB8, 0x3B,
-    0x63, 0x7D, 0xB4, 0x0F, 0x16, 0xF1, 0xDE, 0x2F, 0x04, 0x69, 0xD0, 0x1C, 0x96, 0xD3, 0x2A, 0x3D,
-    0x2C, 0x9C, 0x58, 0xEF, 0x74, 0x1E, 0x2A, 0x4A, 0x7D, 0x03, 0xBB, 0xF4, 0x3B, 0xBA, 0x30, 0x00,
-    0x7B, 0x8A, 0x50, 0xF0, 0x54, 0x64, 0xD9, 0xE7, 0x66, 0x4F, 0xDA, 0x4B, 0xA8, 0x09, 0xB7, 0xC6,
-    0xB0, 0xDB, 0x2B, 0x31, 0xDD, 0x79, 0x35, 0xC4, 0x38, 0x41, 0x59, 0x68, 0x9E, 0x83, 0xCB, 0xBF,
-    0x02, 0x31, 0xE0, 0x88, 0x31, 0x82, 0x1C, 0x7E, 0xB2, 0xD5, 0xA8, 0x25, 0xEF, 0x0B, 0x8A, 0x31,
-    0x3D, 0x13, 0x69, 0xE4, 0xB9, 0x2F, 0x77, 0x6F, 0x64, 0x49, 0xB2, 0x57, 0xEF, 0xC3, 0x26, 0x04,
-    0xD2, 0xAC, 0x6E, 0x70, 0x7E, 0x52, 0xB3, 0x2C, 0x43, 0xF6, 0x16, 0xC0, 0xBE, 0x24, 0x2C, 0x28,
-    0x7E, 0x91, 0x71, 0x06, 0x09, 0x7E, 0xB0, 0xA6, 0xE4, 0x09, 0x2A, 0x59, 0x85, 0xC3, 0x50, 0x35,
-    0x00, 0xA1, 0x82, 0x0B, 0xCC, 0xE0, 0xCE, 0x99, 0xD2, 0xB7, 0x4E, 0x95, 0x49, 0x07, 0xFC, 0xE9,
-    0x22, 0x7B, 0x99, 0x8F, 0x25, 0x31, 0xEB, 0xC2, 0x4F, 0x77, 0x8C, 0xD0, 0xDD, 0x3E, 0x40, 0x15,
-    0x2C, 0xB3, 0x1F, 0x1C, 0xA7, 0x7C, 0xB6, 0xC5, 0xA6, 0x59, 0x15, 0x14, 0x45, 0x6A, 0x52, 0x64,
-    0x46, 0x13, 0xD8, 0x74, 0xC5, 0x3C, 0x67, 0x55, 0x63, 0xB6, 0xB3, 0x3F, 0x07, 0xD8, 0xA0, 0xAA,
-    0xD0, 0x75, 0x34, 0xA8, 0x7D, 0x4E, 0xFF, 0x7B, 0x48, 0xF0, 0x89, 0x57, 0xAB, 0xE8, 0xA3, 0x46,
-    0xA8, 0xAE, 0x5A, 0x5E, 0x7B, 0x14, 0x4F, 0x3B, 0x7B, 0xEA, 0x09, 0x55, 0xE9, 0x12, 0xD1, 0x0E,
-    0x8F, 0x6E, 0x3F, 0xDF, 0x30, 0xC8, 0x81, 0xFF, 0x24, 0x59, 0xDF, 0xE7, 0xCC, 0x69, 0x1D, 0xF5,
-    0x61, 0xCE, 0x71, 0x05, 0xA1, 0xE6, 0xD2, 0x60, 0x5D, 0x5E, 0x5F, 0xB7, 0x09, 0x0F, 0x4B, 0x61,
-    0x0E, 0x20, 0x78, 0x4F, 0x16, 0xC0, 0x87, 0x31, 0x8B, 0x34, 0xA9, 0xB2, 0x9F, 0x81, 0xDC, 0xC8,
-    0x84, 0x6D, 0x35, 0x67, 0xB2, 0x20, 0xDD, 0xA1, 0xED, 0xE2, 0x73, 0xFD, 0x37, 0x94, 0xB0, 0xB7,
-    0x6C, 0x08, 0x76, 0x7A, 0x30, 0x2B, 0xE3, 0x77, 0x1B, 0x41, 0xB3, 0x11, 0x83, 0x82, 0xA5, 0xFB,
-    0xD8, 0x41, 0x74, 0x05, 0xCE, 0x74, 0x95, 0xDF, 0xC0, 0x4F, 0x2F, 0x7D, 0xE8, 0x1B, 0x22, 0x56,
-    0x9C, 0xF5, 0xBB, 0xC1, 0x6F, 0xFB, 0xE9, 0x49, 0xF0, 0x07, 0xDE, 0xA2, 0x9B, 0x2B, 0x97, 0x2E,
-    0xBC, 0x92, 0xE2, 0x9B, 0x1D, 0x57, 0xF9, 0xDB, 0xDA, 0xC1, 0x4F, 0x50, 0xCC, 0x5F, 0xEF, 0x93,
-    0x66, 0xF3, 0x4A, 0x97, 0x35, 0xBD, 0xD7, 0x93, 0x16, 0x85, 0xEF, 0xB5, 0xF3, 0x69, 0xE5, 0x47,
-    0xC9, 0x2E, 0xF9, 0xF5, 0x8C, 0x46, 0xCA, 0x2F, 0x54, 0x84, 0x3B, 0x2E, 0x4F, 0xF7, 0xFB, 0xEE,
-    0x45, 0xAC, 0xD3, 0x78, 0x9C, 0x98, 0x2F, 0x4D, 0xF9, 0x0C, 0x78, 0xD7, 0xF7, 0x08, 0x40, 0xE4,
-    0x0F, 0x23, 0xE7, 0x81, 0xA4, 0x65, 0xE2, 0x71, 0x6C, 0xA2, 0xC8, 0x61, 0xE1, 0x20, 0x0F, 0x3B,
-    0xC3, 0x07, 0x71, 0xFE, 0x80, 0x73, 0x27, 0x95, 0xB7, 0x57, 0x21, 0x21, 0x4B, 0x55, 0xD1, 0xCD,
-    0x8E, 0x56, 0x9C, 0x66, 0x9E, 0x56, 0x78, 0x7D, 0x60, 0x07, 0x0F, 0xC4, 0xF1, 0x49, 0x30, 0x37,
-    0x80, 0xD2, 0xEF, 0x37, 0xCC, 0x78, 0xDE, 0x69, 0x3E, 0x80, 0xF8, 0x75, 0x10, 0xC2, 0x72, 0x64,
-    0xEE, 0x34, 0xC3, 0xBC, 0x09, 0x8B, 0x34, 0x01, 0xA1, 0x2C, 0xAF, 0x01, 0xE7, 0x43, 0xE1, 0xE7,
-    0x55, 0xCC, 0xD1, 0xD6, 0xE5, 0x6B, 0x32, 0x70, 0xB2, 0x3B, 0x69, 0x39, 0xC5, 0x15, 0x0A, 0x98,
-    0x2A, 0x66, 0xFB, 0x24, 0x35, 0xA5, 0xF9, 0x19, 0xA7, 0xDB, 0x39, 0x70, 0x3D, 0x79, 0x55, 0x61,
-    0x39, 0xFD, 0xDC, 0x7B, 0x3B, 0x7F, 0xD8, 0x62, 0x9D, 0x4A, 0x71, 0xA2, 0x9C, 0x59, 0x26, 0x98,
-    0x3F, 0xE9, 0x3D, 0x4E, 0xDD, 0x19, 0xAE, 0x1F, 0x2F, 0xBE, 0xBF, 0x8E, 0x40, 0x5F, 0xE5, 0x79,
-    0xCB, 0x6D, 0x44, 0x1F, 0x22, 0xD6, 0x97, 0x07, 0x42, 0xDD, 0x33, 0x2F, 0x92, 0x8C, 0x02, 0x77,
-    0xA4, 0xBE, 0x6F, 0x84, 0x7D, 0x6D, 0x79, 0xEA, 0x7A, 0x03, 0xAA, 0xA9, 0xB0, 0xA4, 0xE4, 0x5C,
-    0xAD, 0x65, 0x83, 0x84, 0xBD, 0x5F, 0x3E, 0x90, 0x12, 0xB3, 0x1F, 0x42, 0x5D, 0xF9, 0x7D, 0xF2,
-    0x3A, 0xB2, 0xC8, 0x07, 0x88, 0x06, 0x65, 0x8A, 0x63, 0x9C, 0x20, 0x01, 0xFF, 0x61, 0xFE, 0x67,
-    0x67, 0xA5, 0xF1, 0xE5, 0xC2, 0x88, 0x0F, 0x51, 0x60, 0x5F, 0x32, 0x1B, 0x50, 0xCF, 0x3B, 0xDD,
-    0xEC, 0x8D, 0xB0, 0x40, 0x5F, 0x5F, 0x53, 0x5F, 0x70, 0xF4, 0x79, 0x2F, 0x5A, 0x82, 0x96, 0x9A,
-    0x67, 0x46, 0xD8, 0x9F, 0x85, 0x20, 0xCF, 0x63, 0xEB, 0x8E, 0xD4, 0x39, 0x9A, 0xC8, 0x8A, 0xA2,
-    0x9D, 0x08, 0x1F, 0xD8, 0x9A, 0x3C, 0x7E, 0x93, 0x31, 0x57, 0x87, 0x32, 0x9E, 0x30, 0xE3, 0x83,
-    0x8A, 0xD7, 0xE4, 0xCC, 0x69, 0x80, 0xD0, 0xEC, 0x70, 0xE7, 0x24, 0x14, 0x14, 0x46, 0x1E, 0xC0,
-    0xE9, 0xA5, 0x2B, 0x04, 0xC4, 0x53, 0xF2, 0x68, 0x24, 0xC2, 0xFF, 0xF2, 0x94, 0x93, 0xD4, 0x99,
-    0x04, 0x9B, 0xE8, 0xB1, 0x85, 0x5A, 0x2D, 0xA9, 0x2F, 0x36, 0x84, 0x3D, 0xA5, 0xD6, 0x0A, 0x5A,
-    0x1F, 0xA7, 0xCC, 0x3A, 0xFD, 0xC3, 0x12, 0x8F, 0xE8, 0x11, 0x38, 0x87, 0x5C, 0x2A, 0x79, 0xB9,
-    0x62, 0x86, 0x9B, 0x72, 0x2A, 0x00, 0xD2, 0x67, 0x5C, 0xC0, 0xA2, 0x17, 0xD8, 0x19, 0x9F, 0x06,
-    0xEF, 0xB7, 0xE0, 0xCF, 0x10, 0xE6, 0x38, 0x58, 0x3A, 0xC4, 0xE0, 0xE3, 0x01, 0x31, 0x74, 0x97,
-    0xB5, 0xFF, 0x3F, 0x0D, 0xD5, 0x3C, 0x80, 0x06, 0x1F, 0xD2, 0x0E, 0x7F, 0xB9, 0x06, 0xCB, 0xB9,
-    0x06, 0xAB, 0xE4, 0x32, 0x1C, 0xC0, 0xFC, 0xAF, 0xD7, 0xB7, 0xF8, 0xB0, 0xC4, 0x7A, 0x76, 0xBC,
-    0xE1, 0xFC, 0xEC, 0x10, 0xF4, 0x1F, 0xD3, 0xA0, 0x14, 0x1A, 0x67, 0xE1, 0x82, 0x6C, 0x51, 0x70,
-    0xE8, 0x47, 0x4D, 0x13, 0xEA, 0x00, 0x38, 0x60, 0x4C, 0xEE, 0x59, 0xB0, 0xCF, 0x4D, 0x94, 0xCA,
-    0xCF, 0xA8, 0xA4, 0x0E, 0xEF, 0x3B, 0x26, 0x60, 0xA1, 0xC3, 0x47, 0xC3, 0xBF, 0xFC, 0x9A, 0x9D,
-    0x1E, 0x99, 0x37, 0xE5, 0x61, 0x7C, 0x0A, 0x45, 0x48, 0xA3, 0x77, 0xB2, 0x46, 0xCE, 0x90, 0xE2,
-    0xBD, 0x7F, 0x99, 0x41, 0x08, 0x9C, 0xBE, 0xDE, 0x04, 0x4D, 0x37, 0x7F, 0xAE, 0xFD, 0xE0, 0x1E,
-    0xD4, 0x95, 0xDF, 0x0A, 0xA5, 0x4F, 0xFC, 0xCD, 0x82, 0xC7, 0x85, 0x3E, 0x27, 0x2E, 0x3A, 0x42,
-    0xDD, 0x65, 0x40, 0xDD, 0xB8, 0x80, 0x3A, 0x09, 0x63, 0xC6, 0x75, 0x64, 0x9B, 0xFD, 0x58, 0xF2,
-    0x28, 0x1E, 0xFD, 0x97, 0x13, 0x25, 0xDE, 0xCB, 0xC1, 0xD8, 0x23, 0x9B, 0x3D, 0x97, 0x06, 0x0D,
-    0x36, 0x78, 0xB3, 0x73, 0x59, 0x78, 0x6E, 0x82, 0x47, 0xF4, 0x74, 0xE3, 0x94, 0xD1, 0x52, 0x15,
-    0x5F, 0x03, 0x0A, 0xBD, 0xDD, 0xEC, 0x73, 0xD6, 0x47, 0x31, 0xDC, 0x27, 0xAB, 0x7A, 0x9C, 0xE7,
-    0x2A, 0xD8, 0xF7, 0x86, 0x83, 0xEB, 0x1A, 0x7A, 0xAD, 0xBE, 0xF2, 0x48, 0x4D, 0xB7, 0xEC, 0xE3,
-    0x43, 0x57, 0x90, 0x3B, 0xEF, 0x20, 0x79, 0xB4, 0xD8, 0x0C, 0xBF, 0xBF, 0x77, 0x68, 0xAF, 0x98,
-    0x06, 0xA1, 0x4A, 0x13, 0xCA, 0xC8, 0xF3, 0x6A, 0x5D, 0xCD, 0x60, 0x4B, 0xA8, 0x7E, 0x46, 0xB5,
-    0x5E, 0x40, 0x29, 0xFA, 0x1E, 0x7D, 0x91, 0x67, 0x01, 0xB8, 0x2B, 0xA7, 0x2A, 0xE4, 0x9F, 0xF6,
-    0x19, 0xA7, 0x87, 0xF1, 0xA0, 0x8C, 0x3A, 0x73, 0x0D, 0x07, 0xD6, 0x53, 0x7E, 0x77, 0x5F, 0x76,
-    0xD0, 0xFC, 0xA7, 0x79, 0x48, 0xA3, 0xE6, 0xA4, 0xEF, 0xE1, 0x3F, 0x11, 0x39, 0xCF, 0x00, 0xF7,
-    0xA0, 0xCC, 0xAB, 0x8B, 0x0C, 0x40, 0x4E, 0x34, 0xC0, 0x54, 0x92, 0xC8, 0x32, 0xB6, 0x89, 0xBC,
-    0x8E, 0x83, 0xF2, 0x59, 0x1A, 0x6F, 0xF7, 0x64, 0x2B, 0xEA, 0x77, 0x38, 0xDF, 0x39, 0x3E, 0xC9,
-    0x16, 0x91, 0x68, 0x6C, 0xEA, 0xDE, 0x3D, 0xCC, 0x7F, 0x68, 0x41, 0xBA, 0x18, 0xFC, 0xED, 0xEA,
-    0x74, 0x58, 0xB8, 0xE8, 0xED, 0x7F, 0xFA, 0x93, 0x59, 0x75, 0xF6, 0x7E, 0xCE, 0x31, 0x8E, 0x4D,
-    0x56, 0xDC, 0xA7, 0x53, 0xAF, 0xFD, 0x58, 0xE9, 0x37, 0xE5, 0x5D, 0x87, 0xB0, 0xC0, 0xBB, 0xB5,
-    0xFD, 0xCF, 0x0B, 0xFE, 0xDA, 0x9E, 0x55, 0x94, 0xAF, 0x00, 0xC1, 0x0F, 0x3C, 0x86, 0x02, 0x2E,
-    0x91, 0x40, 0xCF, 0x23, 0x8A, 0xC8, 0xCC, 0xEA, 0xA9, 0x47, 0x74, 0x86, 0xA4, 0x53, 0x2C, 0x12,
-    0xD5, 0xE8, 0x75, 0x6B, 0xA0, 0x1B, 0x96, 0xC7, 0xED, 0xDB, 0x28, 0x4C, 0xFB, 0xE8, 0xBD, 0x2E,
-    0xAC, 0xE3, 0x97, 0xAB, 0x38, 0xBF, 0x64, 0x96, 0xB2, 0xB0, 0xB1, 0x8D, 0xB5, 0xF0, 0x75, 0x5B,
-    0xEB, 0xF6, 0x21, 0xCF, 0x95, 0xD1, 0x55, 0xD9, 0x9A, 0xE5, 0x73, 0x1F, 0x3F, 0x64, 0x21, 0xBD,
-    0xFF, 0x18, 0xF7, 0x53, 0x06, 0xCE, 0x66, 0xC6, 0x76, 0xD9, 0x6E, 0x4D, 0xAB, 0x1E, 0x51, 0x7F,
-    0x05, 0x78, 0x9F, 0xC6, 0x85, 0x1E, 0xF0, 0x3C, 0x4F, 0xC6, 0x46, 0x25, 0x7E, 0x85, 0x9E, 0x9D,
-    0xE0, 0xF1, 0xC5, 0x8B, 0x83, 0x9C, 0xE7, 0xB1, 0xC9, 0x81, 0x2C, 0x90, 0xF1, 0xE9, 0x25, 0x54,
-    0x2A, 0x32, 0x8D, 0xCC, 0x08, 0xF7, 0x64, 0xA8, 0xF9, 0x9E, 0x78, 0xA2, 0x30, 0xAF, 0x7D, 0x25,
-    0xCC, 0x03, 0x3C, 0x44, 0x83, 0x45, 0xEB, 0xCC, 0x3D, 0x24, 0x29, 0xF3, 0xDB, 0x71, 0xAE, 0x0E,
-    0x02, 0x5E, 0x36, 0x0A, 0x37, 0x71, 0xCE, 0x8A, 0xF4, 0x33, 0x49, 0x23, 0xE0, 0x5D, 0xB0, 0x98,
-    0x4D, 0xA4, 0x56, 0xFD, 0xEC, 0xCF, 0x67, 0x7F, 0x7C, 0xBB, 0xC9, 0x25, 0x27, 0xCC, 0xA9, 0x7B,
-    0xA9, 0xCC, 0x93, 0x71, 0xC2, 0x91, 0xAB, 0xB9, 0xED, 0xDE, 0xF7, 0xCC, 0xCF, 0xFF, 0x03, 0x95,
-    0x54, 0xBF, 0x6F, 0x14, 0x47, 0x14, 0x7E, 0xBB, 0x73, 0x66, 0x09, 0x83, 0x32, 0x57, 0xD8, 0x05,
-    0x92, 0x95, 0x6D, 0x28, 0x40, 0x22, 0x2C, 0x05, 0x05, 0x05, 0x77, 0xB3, 0x70, 0x85, 0x8B, 0x14,
-    0x10, 0x09, 0xB7, 0x0E, 0x69, 0x22, 0x92, 0x06, 0xA4, 0x50, 0x1E, 0xB7, 0x0B, 0x48, 0xB1, 0x22,
-    0x37, 0x56, 0x94, 0x3F, 0xC0, 0x52, 0x52, 0x44, 0x4E, 0x91, 0x14, 0x41, 0xA2, 0xF0, 0x71, 0x63,
-    0x53, 0x20, 0xA5, 0x5A, 0x8B, 0x3F, 0xC0, 0xA3, 0xA4, 0xB3, 0x0B, 0x46, 0xC9, 0x4A, 0x19, 0xC1,
-    0xEC, 0x4D, 0xBE, 0xD9, 0xC3, 0x82, 0x02, 0xF1, 0x63, 0x76, 0xF7, 0x66, 0xE6, 0xE6, 0x7B, 0x3F,
-    0xE6, 0xBD, 0xEF, 0xBD, 0x23, 0x5F, 0x1D, 0x0E, 0x22, 0x76, 0x3C, 0x2B, 0x8D, 0xDC, 0xFE, 0xF1,
-    0x23, 0x5A, 0x7F, 0xE3, 0x4B, 0x61, 0x54, 0x74, 0x61, 0x79, 0x65, 0xFF, 0x37, 0xB5, 0xA8, 0x36,
-    0xB6, 0x4B, 0x45, 0x6F, 0x7B, 0x72, 0xC0, 0x13, 0x5A, 0xA4, 0x07, 0xCB, 0xCF, 0x7F, 0x3D, 0xCF,
-    0x8E, 0xB1, 0x78, 0x40, 0xEC, 0xAD, 0x4F, 0x34, 0x69, 0xFC, 0xD4, 0x37, 0xB3, 0xDF, 0x85, 0xE5,
-    0xE5, 0x2B, 0xDE, 0xFF, 0xEB, 0xBD, 0xDB, 0xDC, 0xDC, 0x2C, 0xBC, 0x7F, 0xE6, 0x7D, 0xBD, 0xD9,
-    0x8E, 0x89, 0x7F, 0x35, 0xDC, 0x1B, 0xFE, 0xBA, 0x36, 0x27, 0xF9, 0xDE, 0xCE, 0x7F, 0x66, 0xEC,
-    0xB2, 0xE2, 0x43, 0x16, 0xDF, 0x1C, 0x29, 0x21, 0x0E, 0x53, 0xFB, 0x9B, 0x9B, 0x3F, 0xC3, 0xF7,
-    0xD7, 0x36, 0xF9, 0x50, 0xDC, 0x37, 0x23, 0x5E, 0x4D, 0x79, 0x45, 0x14, 0xE5, 0x93, 0xC4, 0x14,
-    0xBC, 0x72, 0x19, 0xAB, 0x42, 0x48, 0x9C, 0xA8, 0x9C, 0xD8, 0xA9, 0xFB, 0x5C, 0x75, 0xA9, 0xC3,
-    0xEA, 0x09, 0xD7, 0x45, 0x6C, 0x44, 0x39, 0x8C, 0x4A, 0xCA, 0xBB, 0x29, 0xAB, 0xAC, 0x14, 0x3B,
-    0x66, 0x04, 0xC4, 0x48, 0xFC, 0xE5, 0xB2, 0x25, 0xDD, 0xC6, 0x91, 0x12, 0xED, 0x12, 0xE3, 0x98,
-    0x71, 0x49, 0x65, 0x71, 0x9E, 0x0E, 0x74, 0x4F, 0x94, 0xDD, 0xB9, 0x70, 0x24, 0x85, 0x6A, 0xE4,
-    0xC0, 0x38, 0xF1, 0xD8, 0x8C, 0xB3, 0x81, 0xB6, 0x19, 0x34, 0x77, 0xA8, 0x13, 0x51, 0x23, 0x3F,
-    0xFB, 0xC7, 0x65, 0x6B, 0xBA, 0x48, 0xD5, 0x56, 0x46, 0xB6, 0x1F, 0x19, 0x18, 0xB9, 0x4E, 0x27,
-    0xE0, 0x03, 0x31, 0x4D, 0x82, 0x68, 0x18, 0xB7, 0x31, 0x58, 0xBF, 0xD8, 0x21, 0x43, 0x89, 0xA2,
-    0xB3, 0x44, 0x96, 0xE0, 0x66, 0x9A, 0x07, 0x88, 0x69, 0x2D, 0x47, 0xEB, 0x01, 0x4F, 0x7D, 0x0A,
-    0x02, 0x89, 0x82, 0x84, 0xF1, 0xDE, 0x76, 0x7B, 0x1D, 0x12, 0x39, 0x71, 0xD5, 0xC2, 0x2C, 0x9D,
-    0xBE, 0xF3, 0xB5, 0xF0, 0x7E, 0xE9, 0xE0, 0x40, 0xC5, 0x3A, 0xEC, 0x03, 0x3E, 0x2B, 0x67, 0xBE,
-    0xCB, 0xC7, 0xFE, 0x4A, 0x23, 0x4D, 0x81, 0x0C, 0x9F, 0xA4, 0xB4, 0x4A, 0xFC, 0x25, 0xDF, 0x14,
-    0x7E, 0xCF, 0xAF, 0x4E, 0x23, 0x4B, 0x5D, 0xA2, 0x13, 0xE9, 0x41, 0x33, 0xED, 0xC0, 0xAF, 0xCF,
-    0x9D, 0xD8, 0x33, 0x93, 0x9B, 0xF7, 0x5C, 0x37, 0xCA, 0x4F, 0xD0, 0x1C, 0xCD, 0xA5, 0x4A, 0x54,
-    0xE2, 0x99, 0xE1, 0x35, 0x7B, 0x61, 0x23, 0x47, 0xAE, 0x4B, 0xF3, 0xD4, 0xA1, 0xEC, 0x8B, 0x17,
-    0xAE, 0x39, 0xA4, 0x57, 0xBE, 0x52, 0x7D, 0x18, 0xBD, 0xA2, 0xE7, 0xC9, 0xFB, 0xD1, 0x8B, 0x28,
-    0x2E, 0xB9, 0x3E, 0xFD, 0xCB, 0x97, 0xDF, 0x47, 0xE5, 0xBB, 0x1F, 0x04, 0xAA, 0x43, 0xC7, 0xCE,
-    0xD3, 0xB1, 0x0B, 0x0B, 0x2B, 0xA7, 0xF6, 0xB7, 0xBE, 0x8D, 0x9E, 0x1C, 0x5F, 0xBC, 0x75, 0xEE,
-    0x3B, 0x58, 0x66, 0x44, 0xC7, 0x89, 0xCE, 0xD1, 0x3B, 0x96, 0x08, 0x04, 0xEE, 0xB6, 0xB8, 0x11,
-    0xFF, 0x49, 0x67, 0x1E, 0x5C, 0x7B, 0xBA, 0xFF, 0xFB, 0xD3, 0x5C, 0xFD, 0x34, 0xA0, 0x1F, 0xDE,
-    0x47, 0xF6, 0x70, 0xD9, 0xA1, 0xC3, 0x01, 0xEF, 0xCF, 0x84, 0x39, 0xB3, 0x94, 0x86, 0x34, 0xC8,
-    0x49, 0x2E, 0x54, 0xD8, 0x2F, 0x69, 0x1E, 0x66, 0xA1, 0x6C, 0x12, 0xE8, 0x98, 0x54, 0x7D, 0x16,
-    0x28, 0x16, 0xD7, 0xE9, 0xA0, 0xCD, 0xF7, 0x96, 0xD8, 0x6E, 0x67, 0x00, 0xEB, 0x4C, 0xD3, 0x64,
-    0xE9, 0x85, 0xB1, 0x72, 0x1A, 0xF9, 0xBA, 0xD0, 0x5B, 0x52, 0x6C, 0xDB, 0x02, 0xAC, 0x49, 0x2F,
-    0xD7, 0x0E, 0xDA, 0x7A, 0x42, 0x6D, 0xF5, 0x91, 0x7E, 0xC9, 0x8C, 0x4C, 0x73, 0x4B, 0xE0, 0x98,
-    0x58, 0xAB, 0xC6, 0x60, 0x8F, 0xE4, 0xBB, 0xB5, 0x84, 0x0D, 0x71, 0xA0, 0x8B, 0x02, 0x73, 0xE4,
-    0x35, 0xF7, 0x14, 0x57, 0x74, 0x24, 0xA7, 0x85, 0xD9, 0x55, 0x67, 0xA3, 0x97, 0x98, 0x47, 0x62,
-    0xC7, 0x4A, 0xA6, 0xE6, 0xC3, 0x56, 0x0C, 0x54, 0x91, 0xDE, 0xB3, 0x8D, 0x78, 0x62, 0x1E, 0x65,
-    0x81, 0xD2, 0x89, 0x9A, 0x9F, 0x9B, 0x21, 0xEB, 0x4F, 0x98, 0x2A, 0xC4, 0xAE, 0xCD, 0x56, 0x4D,
-    0x03, 0x89, 0x82, 0x6B, 0x07, 0xC4, 0x58, 0x28, 0x73, 0x16, 0xA0, 0x98, 0xAE, 0xE2, 0x0E, 0xD5,
-    0x88, 0x99, 0xAC, 0x74, 0xBC, 0xEA, 0x53, 0xB8, 0xF3, 0xA7, 0x49, 0x39, 0x12, 0x4A, 0x72, 0x0D,
-    0x19, 0xD4, 0x13, 0x4A, 0x90, 0xE9, 0x21, 0x95, 0xAD, 0x25, 0x7E, 0x49, 0x5F, 0x44, 0x4D, 0x01,
-    0x8D, 0xC3, 0xA0, 0x93, 0x99, 0x71, 0xAA, 0xC6, 0x80, 0x89, 0xBB, 0xA6, 0x07, 0x10, 0x02, 0x78,
-    0x1D, 0x55, 0x47, 0x85, 0x4E, 0xFE, 0xD6, 0x23, 0xF6, 0xB2, 0x0C, 0x79, 0x29, 0x74, 0x5A, 0xA5,
-    0x95, 0xD0, 0xCC, 0x91, 0xCC, 0x13, 0x43, 0xBD, 0x59, 0x79, 0xAA, 0xC4, 0xC4, 0x8E, 0x3C, 0x4D,
-    0xA2, 0x26, 0xA9, 0x53, 0xD5, 0x7F, 0x79, 0xBF, 0x5B, 0x48, 0xC3, 0x30, 0x51, 0xC3, 0x8C, 0xEF,
-    0x1A, 0xFE, 0x78, 0x55, 0xC5, 0x26, 0x25, 0x7A, 0xD8, 0xA3, 0xA3, 0xFD, 0xFA, 0xAA, 0xC4, 0x6D,
-    0xC2, 0xD7, 0xC1, 0x9A, 0x6C, 0x8F, 0x62, 0x2D, 0x72, 0xFE, 0x64, 0x55, 0x05, 0x6C, 0x90, 0x81,
-    0xEC, 0xA9, 0x56, 0xC9, 0x8D, 0x68, 0x23, 0x31, 0x99, 0x92, 0xE5, 0x14, 0xCA, 0x4D, 0x58, 0x66,
-    0xE5, 0x94, 0xE0, 0x31, 0x33, 0x08, 0xB1, 0x1A, 0x51, 0x3F, 0xAA, 0xA3, 0x1A, 0x2E, 0xA8, 0x0C,
-    0x39, 0x78, 0x48, 0x7F, 0xCC, 0x1A, 0x4D, 0x04, 0x3A, 0x14, 0x91, 0x8D, 0x9D, 0xD0, 0xBC, 0x92,
-    0x79, 0x07, 0x61, 0x7F, 0xD5, 0xA3, 0x26, 0x7B, 0x8D, 0x57, 0x2F, 0x9D, 0x4C, 0x50, 0x1B, 0xA1,
-    0x8A, 0xE3, 0x1A, 0x42, 0xF8, 0x42, 0xF9, 0x86, 0x92, 0xA7, 0x61, 0xC8, 0x10, 0xB5, 0xB5, 0x0C,
-    0xC5, 0x44, 0x69, 0x48, 0x51, 0x1E, 0xC8, 0x43, 0xA1, 0xF2, 0x29, 0x30, 0x28, 0x44, 0xE6, 0x50,
-    0x18, 0xB6, 0x5F, 0x1B, 0x91, 0x27, 0xA9, 0x0B, 0x27, 0xFC, 0x9A, 0xD7, 0xDE, 0xDD, 0x96, 0x1F,
-    0xF3, 0x0A, 0xC0, 0x3B, 0xD0, 0x18, 0xBC, 0x8E, 0x6B, 0x6C, 0xC6, 0x28, 0xEA, 0x2C, 0xEF, 0x43,
-    0x19, 0xD4, 0x59, 0xF2, 0x2A, 0xB5, 0x09, 0xA6, 0x99, 0x7C, 0x0E, 0x87, 0x47, 0x01, 0xAB, 0x81,
-    0x6A, 0x40, 0x63, 0xA4, 0xE4, 0x6A, 0x1B, 0x8F, 0xD4, 0x44, 0xAE, 0x70, 0xCC, 0x4E, 0xA6, 0xAC,
-    0xBE, 0x2D, 0x91, 0x04, 0xE4, 0x18, 0x6C, 0xAC, 0xD0, 0x5B, 0x55, 0x88, 0x09, 0xDA, 0x46, 0xD9,
-    0x07, 0x0D, 0xB7, 0xE0, 0x31, 0x74, 0x52, 0x51, 0x9E, 0x6D, 0x35, 0xA2, 0x2B, 0x42, 0x63, 0x41,
-    0x53, 0x9A, 0x40, 0xE1, 0x18, 0xFA, 0xC1, 0xC4, 0x1B, 0x38, 0x28, 0x92, 0x86, 0xE4, 0x7D, 0x8F,
-    0xC4, 0x7A, 0xB4, 0xD9, 0xF3, 0x32, 0xB6, 0x70, 0xA9, 0xC1, 0xBD, 0x24, 0xA1, 0x37, 0x43, 0x27,
-    0xD3, 0xCC, 0x44, 0xC1, 0xE3, 0x21, 0x02, 0x94, 0x81, 0x14, 0x3C, 0x17, 0x33, 0x4A, 0x04, 0x1D,
-    0x05, 0x49, 0x42, 0x52, 0x14, 0xAF, 0xE0, 0x47, 0x1E, 0x5A, 0x0D, 0x5E, 0x69, 0xE3, 0xA7, 0x7E,
-    0x3A, 0xB9, 0x79, 0xD9, 0xDB, 0x93, 0xF4, 0x28, 0x7F, 0x15, 0x17, 0x01, 0xEA, 0xF1, 0x32, 0x70,
-    0x19, 0x76, 0x30, 0xB9, 0x40, 0x67, 0x51, 0xA1, 0x0E, 0x6A, 0x54, 0x52, 0x4B, 0xC1, 0x58, 0x0F,
-    0x45, 0x19, 0x48, 0x7D, 0x94, 0xFE, 0x07, 0x35, 0x91, 0xB1, 0x6E, 0x14, 0x31, 0x14, 0x45, 0xAF,
-    0xC7, 0xDA, 0x58, 0x62, 0x0A, 0xD3, 0xAC, 0x50, 0x48, 0xE1, 0x9E, 0xC6, 0x3F, 0x00, 0x3B, 0xB3,
-    0xA2, 0x48, 0x41, 0xB1, 0x5B, 0xB0, 0xA2, 0xA0, 0xA0, 0xA1, 0x41, 0x14, 0xFC, 0xC0, 0x64, 0xC7,
-    0xA2, 0x4D, 0xC1, 0x7E, 0x44, 0xAA, 0xFD, 0x02, 0x8A, 0xDD, 0x8C, 0x81, 0x1F, 0x18, 0x29, 0x45,
-    0x5A, 0xF7, 0x29, 0x30, 0xC2, 0x0A, 0x13, 0x8D, 0x67, 0x1E, 0x1E, 0x24, 0x5E, 0xE1, 0xC2, 0x7E,
-    0xE7, 0xF9, 0xDE, 0xFB, 0x70, 0x0A, 0x41, 0x66, 0x5B, 0x73, 0x7F, 0xD4, 0xCB, 0x10, 0xC5, 0x8D,
-    0xD3, 0xCA, 0xC4, 0xAD, 0x68, 0x63, 0x91, 0x91, 0xCF, 0x06, 0x00, 0x6B, 0x48, 0x8B, 0x11, 0xB2,
-    0xC3, 0x9F, 0x56, 0xAE, 0x10, 0x2A, 0x79, 0x1B, 0x6A, 0xF2, 0x9B, 0xEB, 0x92, 0x79, 0x08, 0x83,
-    0xF9, 0x9A, 0x53, 0xAB, 0xF6, 0xF8, 0x0A, 0xDE, 0x41, 0x0E, 0x60, 0x11, 0x99, 0x4F, 0x0C, 0x1B,
-    0xD2, 0x7D, 0xA2, 0xA6, 0x9A, 0x99, 0x9C, 0xF8, 0x03, 0x22, 0xF4, 0x4E, 0x90, 0x3B, 0x7E, 0x5A,
-    0x99, 0xAE, 0x93, 0x97, 0xDF, 0x42, 0x3D, 0xA2, 0x29, 0xE7, 0x1B, 0x49, 0xFD, 0x5D, 0x6F, 0xE3,
-    0xFA, 0x80, 0x0B, 0x2C, 0x50, 0x40, 0x97, 0xD2, 0x8A, 0x36, 0x8D, 0x9F, 0xEA, 0x69, 0x99, 0x14,
-    0x2E, 0x74, 0xE6, 0xAB, 0xA4, 0x2E, 0x1F, 0x50, 0x07, 0xF1, 0xC3, 0x2F, 0x44, 0xDB, 0xE9, 0x8C,
-    0x42, 0x36, 0x02, 0xA7, 0xC8, 0x09, 0xC7, 0x9A, 0xBB, 0x4A, 0x2E, 0xFD, 0x22, 0xB7, 0x0D, 0xA1,
-    0x09, 0x50, 0x26, 0x8B, 0x09, 0x94, 0x0E, 0x33, 0x56, 0x0E, 0x0D, 0xFA, 0x03, 0xFF, 0xE5, 0xE5,
-    0xA5, 0xA9, 0x5E, 0x64, 0xEE, 0x5E, 0x9E, 0xC7, 0xE7, 0xD2, 0x4C, 0xD3, 0x6B, 0x23, 0xC9, 0x1E,
-    0x8B, 0x73, 0x77, 0xA1, 0x59, 0x88, 0xF9, 0x8D, 0x2B, 0x94, 0xE9, 0xD2, 0x90, 0xF1, 0x9A, 0x51,
-    0x8B, 0xF7, 0x53, 0x4B, 0x25, 0xE3, 0xA3, 0x88, 0x0E, 0x81, 0x85, 0xCC, 0x73, 0xCF, 0xDD, 0x59,
-    0xA8, 0xE3, 0x7C, 0x8D, 0x66, 0x42, 0xA3, 0xCE, 0xEC, 0x01, 0xC2, 0x61, 0x3B, 0x1D, 0xC7, 0x29,
-    0x2B, 0xA2, 0x97, 0x14, 0xB1, 0x01, 0x1B, 0x39, 0x39, 0x1F, 0x1F, 0x2F, 0x50, 0x33, 0x2A, 0x3F,
-    0x7A, 0x54, 0x28, 0xE6, 0xCD, 0x8A, 0x96, 0x57, 0x40, 0xF2, 0xA6, 0x6D, 0x12, 0xAF, 0x03, 0xFB,
-    0x6D, 0x95, 0x62, 0xFE, 0xA0, 0x68, 0x28, 0x68, 0xEA, 0x49, 0x4F, 0xAC, 0xC4, 0xFE, 0x8A, 0x93,
-    0xD5, 0x9B, 0xF4, 0x2D, 0x1F, 0x71, 0x92, 0x5C, 0xFE, 0x4B, 0x55, 0x99, 0x37, 0x91, 0x93, 0x39,
-    0xD9, 0x01, 0xCA, 0xA9, 0x31, 0x0F, 0xAC, 0x43, 0xD1, 0x09, 0x4A, 0xF8, 0x17, 0xD3, 0x45, 0xF9,
-    0xEA, 0xD6, 0x17, 0x11, 0x1F, 0xF0, 0x6C, 0xFF, 0x8E, 0xFA, 0xCF, 0xF7, 0xB6, 0x4B, 0xFC, 0xFF,
-    0x50, 0x95, 0xC9, 0x2D, 0x76, 0x93, 0xE3, 0xFC, 0xA7, 0xAD, 0x54, 0xE6, 0x0F, 0xBC, 0xB7, 0x79,
-    0xC4, 0x43, 0xCC, 0xBF, 0x87, 0x94, 0xE7, 0x90, 0x54, 0x3A, 0xBC, 0x46, 0xDA, 0x88, 0x24, 0x13,
-    0x35, 0x6F, 0xA7, 0x3C, 0x8B, 0xB7, 0x36, 0x2D, 0xE9, 0x49, 0x92, 0x5B, 0x9E, 0x05, 0x31, 0x62,
-    0x56, 0xE2, 0x2F, 0x4D, 0x50, 0x31, 0x4E, 0xC4, 0x30, 0x10, 0x9C, 0x8B, 0xC5, 0x59, 0x28, 0x85,
-    0x9F, 0xE0, 0x27, 0xE4, 0x09, 0x76, 0xC1, 0x03, 0x52, 0x9C, 0x84, 0x44, 0xC3, 0x4B, 0x50, 0xC2,
-    0x0F, 0x78, 0xC2, 0x15, 0x34, 0xE8, 0xBE, 0x70, 0x52, 0x72, 0x3F, 0x48, 0x03, 0x0D, 0x8D, 0x91,
-    0xA0, 0x8F, 0x84, 0x91, 0x72, 0x27, 0x5F, 0x86, 0x75, 0xB8, 0x02, 0x4B, 0xF6, 0x4A, 0xB3, 0xDE,
-    0xD9, 0x99, 0x01, 0xE4, 0x58, 0x32, 0x94, 0xE4, 0x04, 0xF7, 0xFA, 0x00, 0x13, 0x0C, 0x54, 0x54,
-    0xED, 0x2A, 0x49, 0xA7, 0x93, 0xEB, 0x38, 0xC2, 0x48, 0x53, 0x1F, 0x37, 0x28, 0x04, 0x5C, 0xF3,
-    0x19, 0x05, 0x67, 0xC0, 0x0C, 0x80, 0x8E, 0x79, 0x3C, 0xC8, 0x87, 0x98, 0x99, 0xE0, 0x05, 0xA2,
-    0x47, 0x29, 0x33, 0x7A, 0x3C, 0x43, 0x8D, 0xD6, 0x17, 0x93, 0xF6, 0x38, 0xCB, 0x5C, 0x77, 0xE7,
-    0x15, 0xD9, 0xE3, 0xFE, 0xAB, 0xC6, 0xED, 0xCF, 0x46, 0x88, 0x13, 0xD6, 0xF3, 0x8B, 0x6C, 0xC8,
-    0x1A, 0x7A, 0x80, 0xA7, 0xDD, 0xD8, 0x88, 0x0E, 0xFB, 0xD1, 0xA5, 0x95, 0x5F, 0xF8, 0x36, 0xCB,
-    0x8B, 0xEA, 0x42, 0xEF, 0xC8, 0x36, 0xD7, 0x6B, 0xDA, 0x0B, 0xF0, 0x38, 0x2F, 0xD5, 0x0C, 0xAE,
-    0xCD, 0x88, 0x1E, 0x4D, 0xD8, 0x4B, 0x2D, 0x92, 0x8E, 0xAE, 0x2E, 0xB6, 0xA0, 0x4A, 0x9C, 0x4B,
-    0xC2, 0xBD, 0xA7, 0xEA, 0xA4, 0xDF, 0x7A, 0x71, 0xA2, 0x62, 0x21, 0xEA, 0xF8, 0x84, 0x84, 0xCE,
-    0x67, 0x47, 0x0E, 0x26, 0x82, 0x8B, 0x86, 0xCE, 0xBB, 0x16, 0x65, 0xB8, 0x29, 0x83, 0x0D, 0x50,
-    0xC7, 0xEF, 0x43, 0x74, 0x62, 0x87, 0x47, 0xA6, 0x8A, 0x03, 0x6C, 0xB4, 0x13, 0xFE, 0x9D, 0x5A,
-    0x16, 0x49, 0x32, 0xAB, 0xEC, 0xAA, 0xF9, 0xDC, 0xC3, 0x86, 0xB2, 0x55, 0x13, 0xB6, 0x68, 0x72,
-    0x76, 0x62, 0xCF, 0x64, 0xBD, 0xD9, 0x5A, 0x45, 0x42, 0xCC, 0x07, 0x2C, 0xB1, 0x5A, 0x49, 0x0E,
-    0xF4, 0x57, 0x92, 0xD3, 0x2E, 0x48, 0x4F, 0xB0, 0xE6, 0xCF, 0x07, 0x7E, 0x01, 0x75, 0x52, 0x31,
-    0x8B, 0xD4, 0x40, 0x18, 0x7D, 0x33, 0x23, 0x44, 0x08, 0x92, 0x6D, 0x05, 0xB9, 0xF8, 0x07, 0xEE,
-    0xD2, 0x58, 0x58, 0xDC, 0x6D, 0xD2, 0x58, 0x2B, 0xE8, 0xD5, 0xFA, 0x23, 0x2C, 0x6C, 0xDC, 0x0D,
-    0x5C, 0xB9, 0x8D, 0x3F, 0xC1, 0x7A, 0xAE, 0x58, 0x04, 0x8B, 0x2B, 0xEE, 0x36, 0x11, 0x11, 0xCB,
-    0x5D, 0x5C, 0xEC, 0xC3, 0xFE, 0x82, 0x39, 0x37, 0x70, 0xC3, 0x99, 0xCD, 0xF8, 0x26, 0x89, 0x8B,
-    0x22, 0x0E, 0x79, 0x24, 0xDF, 0x97, 0x79, 0xDF, 0xFB, 0xE6, 0x7D, 0x03, 0x70, 0xDD, 0x23, 0xA2,
-    0x92, 0x58, 0x0D, 0x6F, 0xE7, 0xDC, 0x67, 0xC2, 0x14, 0x5A, 0x37, 0x21, 0x93, 0x58, 0x10, 0x21,
-    0xFF, 0x20, 0x27, 0xEE, 0x76, 0xBB, 0xA2, 0x86, 0xFB, 0xCA, 0xB8, 0xD8, 0x85, 0xCB, 0x65, 0xBE,
-    0xBE, 0x2E, 0xD1, 0x00, 0x69, 0xF7, 0x47, 0x19, 0xFC, 0x13, 0xEC, 0x97, 0x60, 0x15, 0xE1, 0x13,
-    0xB1, 0x2F, 0xD7, 0xEC, 0xA5, 0x5A, 0x7D, 0x6E, 0x01, 0x39, 0x00, 0xB6, 0xD7, 0xB9, 0xFF, 0xDF,
-    0x82, 0x7D, 0xB0, 0xFE, 0x51, 0x36, 0x3B, 0x16, 0x69, 0xC0, 0x87, 0x1D, 0x75, 0x3C, 0xAE, 0x87,
-    0x12, 0x18, 0x4B, 0x83, 0x34, 0x9B, 0x62, 0x4C, 0x4A, 0x4A, 0x89, 0x98, 0xF8, 0x76, 0xAB, 0xE7,
-    0x55, 0x92, 0x05, 0x95, 0xB2, 0xA1, 0xC1, 0x89, 0x30, 0x10, 0x18, 0x01, 0xAF, 0x11, 0xD4, 0x98,
-    0xD6, 0x81, 0xAB, 0x27, 0x6D, 0xBD, 0xDD, 0x96, 0xAC, 0x9C, 0x7A, 0x15, 0x65, 0xC4, 0xD3, 0x2F,
-    0x71, 0x7A, 0x92, 0x3A, 0x56, 0x40, 0x6A, 0x7C, 0x76, 0xD4, 0x09, 0x84, 0xF9, 0x60, 0x00, 0xB5,
-    0x83, 0xE5, 0x32, 0x7B, 0x7E, 0x9D, 0xF5, 0x5D, 0x91, 0x20, 0xB6, 0xDB, 0x15, 0x19, 0xCA, 0x19,
-    0x4F, 0x91, 0x15, 0x9C, 0x6B, 0xD8, 0x00, 0x8F, 0xEA, 0x8F, 0xEC, 0x0F, 0xD0, 0xD7, 0xB7, 0x50,
-    0x15, 0xA2, 0xFC, 0xF1, 0x58, 0x5A, 0x9B, 0x9C, 0x6D, 0xEA, 0x68, 0xEE, 0x5A, 0xE7, 0x6C, 0xAB,
-    0xDF, 0x35, 0x10, 0x3B, 0x88, 0x1A, 0x22, 0xFB, 0x73, 0xBF, 0xEF, 0xC7, 0x4F, 0x21, 0x09, 0x71,
-    0xB9, 0x90, 0x66, 0x11, 0x96, 0x93, 0xC4, 0xB5, 0x85, 0xDB, 0xE9, 0xB9, 0x77, 0x9F, 0x86, 0xBE,
-    0x05, 0x9E, 0x0D, 0x3E, 0xFB, 0xB1, 0x25, 0xD9, 0x03, 0x5C, 0x89, 0x46, 0xD4, 0x71, 0x19, 0x7C,
-    0xB2, 0x88, 0xD9, 0x41, 0x33, 0xA5, 0xD7, 0x0B, 0xAD, 0xF3, 0x2B, 0xEE, 0x69, 0x07, 0xA3, 0xF3,
-    0x81, 0xA3, 0xF2, 0x4E, 0xAD, 0x07, 0x9D, 0x52, 0x7E, 0x38, 0xB7, 0x5A, 0xBF, 0x67, 0x8C, 0x84,
-    0x81, 0x24, 0xCA, 0xE4, 0xC9, 0xE9, 0x2B, 0xE9, 0x33, 0xA9, 0xA7, 0x64, 0xBF, 0xE7, 0xDA, 0x27,
-    0x94, 0xE3, 0x2B, 0x85, 0xB2, 0x05, 0xD2, 0x8D, 0x53, 0x37, 0xB3, 0x69, 0x70, 0x70, 0xF8, 0x08,
-    0x6F, 0x3E, 0x42, 0x6C, 0x56, 0x08, 0x67, 0x19, 0x8E, 0x8E, 0x80, 0x8B, 0x0B, 0xC8, 0x4D, 0xC5,
-    0x30, 0xEF, 0xC2, 0xFD, 0x0A, 0xFB, 0xE3, 0xFA, 0x4A, 0x63, 0x7D, 0x6E, 0xFC, 0xE5, 0x90, 0x9A,
-    0x1F, 0xCC, 0x1C, 0xD3, 0xC1, 0x96, 0x89, 0x56, 0x9E, 0xBE, 0x98, 0x30, 0x1E, 0x0F, 0x0D, 0x04,
-    0x03, 0x75, 0x34, 0xFA, 0xAB, 0xE4, 0xA0, 0x10, 0x50, 0xF0, 0xE0, 0x10, 0x5E, 0xFF, 0xC3, 0x66,
-    0x7D, 0xF6, 0x73, 0x56, 0xA8, 0x36, 0x31, 0xD2, 0x2E, 0x20, 0x6F, 0x2A, 0x48, 0x1A, 0xC0, 0xF1,
-    0xF4, 0xFC, 0x3B, 0xBC, 0x50, 0x8A, 0xD7, 0x3A, 0xBF, 0x44, 0xF4, 0xFD, 0x65, 0xE9, 0xBD, 0x8A,
-    0xA8, 0xFD, 0x95, 0x33, 0xAB, 0x0B, 0x8E, 0x85, 0x09, 0x8B, 0x86, 0x57, 0x37, 0x2A, 0x39, 0x68,
-    0x73, 0xDC, 0xD3, 0x7E, 0x01, 0xA5, 0x56, 0x3F, 0x6C, 0xDE, 0xC6, 0x15, 0x7F, 0x47, 0xF6, 0x33,
-    0x81, 0xB0, 0xED, 0x79, 0x88, 0x86, 0x5A, 0x80, 0xB9, 0x64, 0x2A, 0x50, 0x73, 0xED, 0x20, 0x89,
-    0xAC, 0x97, 0x0C, 0x19, 0xEC, 0x16, 0xFA, 0x1C, 0xA0, 0x1D, 0xD4, 0xD9, 0x1D, 0xB4, 0x74, 0xF0,
-    0x20, 0x8B, 0x6C, 0x3C, 0x64, 0xAC, 0x10, 0xC0, 0x53, 0x07, 0x2F, 0x2E, 0x60, 0x53, 0x83, 0x96,
-    0x22, 0x30, 0x12, 0x59, 0x64, 0xA2, 0x21, 0x43, 0x16, 0xBA, 0x49, 0xE0, 0xC1, 0x43, 0xE8, 0xFE,
-    0x0B, 0x10, 0x0F, 0x3E, 0xA7, 0x74, 0x4B, 0x59, 0x47, 0xBE, 0xFE, 0xDE, 0xF1, 0xFB, 0x24, 0x27,
-    0x88, 0x12, 0x1B, 0x3D, 0x88, 0x9F, 0xC8, 0xBB, 0x77, 0xEF, 0x7E, 0xEF, 0xDE, 0xEF, 0xFD, 0x59,
-    0x48, 0x49, 0xFD, 0x6A, 0x20, 0xDA, 0x8B, 0x0C, 0xE9, 0x8A, 0x53, 0x65, 0xC3, 0x8E, 0x92, 0x34,
-    0xF9, 0x72, 0xDB, 0xF8, 0xCC, 0x03, 0xC5, 0xCC, 0x15, 0x31, 0x75, 0xA4, 0xDB, 0x38, 0xA5, 0xEC,
-    0x9A, 0x21, 0xDF, 0x5E, 0x25, 0x8A, 0x1F, 0x54, 0xA4, 0x86, 0x8E, 0x48, 0x33, 0x11, 0x95, 0x0D,
-    0x91, 0xDF, 0xE3, 0x25, 0xC9, 0xF1, 0x93, 0xE2, 0x39, 0x95, 0x52, 0x32, 0x50, 0xC2, 0xCD, 0x8F,
-    0x3C, 0xEB, 0xA6, 0x75, 0x43, 0x78, 0x2B, 0x59, 0x31, 0x7F, 0x30, 0xAC, 0x9B, 0xDE, 0xEB, 0xF6,
-    0x68, 0xC0, 0x39, 0x6B, 0x95, 0xFE, 0xC8, 0x04, 0x0F, 0xAD, 0xDF, 0x66, 0x9E, 0xD5, 0xFF, 0xB2,
-    0x1E, 0x5B, 0x8A, 0xA1, 0x17, 0x63, 0x61, 0x3A, 0x8D, 0x98, 0xEF, 0x33, 0x77, 0xD7, 0x2F, 0x01,
-    0x61, 0x99, 0x53, 0xDC, 0x10, 0xD0, 0x79, 0x43, 0xC2, 0xFC, 0x47, 0xE6, 0xBF, 0x15, 0x7F, 0x92,
-    0x8F, 0xA3, 0x95, 0x83, 0x61, 0x7B, 0x28, 0x99, 0xD7, 0x05, 0xB1, 0x1B, 0xAF, 0x1C, 0xA8, 0x1A,
-    0x46, 0xDC, 0x48, 0x33, 0xE6, 0x16, 0xF8, 0xCA, 0x2A, 0x81, 0x2D, 0xBF, 0xE8, 0x49, 0x0F, 0xA1,
-    0xA1, 0x67, 0x36, 0x49, 0xF5, 0xDB, 0xA6, 0xA7, 0x4E, 0xEF, 0x1B, 0x9D, 0x67, 0xBA, 0xEE, 0x94,
-    0x4D, 0x2E, 0xE4, 0xA1, 0x19, 0x2C, 0x25, 0x6F, 0x71, 0xA5, 0xAC, 0x6F, 0x29, 0x6A, 0xF4, 0xF0,
-    0x26, 0x03, 0x38, 0x9B, 0xF0, 0x23, 0xEE, 0xE9, 0x87, 0x34, 0xA5, 0xF9, 0xB8, 0x83, 0xC7, 0x99,
-    0x5F, 0xC3, 0x44, 0x60, 0x8E, 0xF0, 0xA1, 0x77, 0x6A, 0x0A, 0x3E, 0xB1, 0xE4, 0x1B, 0x7C, 0x74,
-    0x51, 0x43, 0xBB, 0x50, 0x92, 0x10, 0xA7, 0x51, 0x0E, 0x55, 0x95, 0x6F, 0x03, 0x43, 0x7C, 0xBE,
-    0xA5, 0x08, 0x07, 0x07, 0x16, 0xC0, 0x04, 0x2F, 0xD7, 0x93, 0xE9, 0x74, 0xAA, 0xD9, 0x59, 0xCB,
-    0x86, 0x53, 0xCF, 0xC2, 0xA0, 0xFE, 0x1B, 0x3B, 0xFD, 0x86, 0x4A, 0xD9, 0xD9, 0xD8, 0xD1, 0x07,
-    0xE5, 0x3A, 0x8E, 0x7C, 0x9C, 0x93, 0x2F, 0xF6, 0x96, 0x06, 0x67, 0xB7, 0x70, 0x83, 0xDC, 0xDD,
-    0x69, 0x41, 0x37, 0x9D, 0xA6, 0x8B, 0x50, 0x06, 0x07, 0xDA, 0xE4, 0x59, 0x71, 0x1B, 0x0A, 0x49,
-    0x43, 0x08, 0xE7, 0x8B, 0x27, 0x48, 0x4C, 0x62, 0x79, 0x1E, 0x3D, 0x2B, 0x8A, 0x42, 0x26, 0xB2,
-    0x74, 0x94, 0x50, 0x9C, 0x8A, 0x2D, 0x3C, 0xC0, 0x57, 0x5C, 0x9D, 0x82, 0x0E, 0x2C, 0xBE, 0x2A,
-    0xDE, 0x25, 0x9A, 0xAC, 0x7F, 0xAA, 0xB0, 0xC9, 0xC3, 0xCA, 0x3E, 0x6F, 0x0F, 0xEF, 0x0C, 0xD4,
-    0xE3, 0x0A, 0x12, 0xCA, 0x28, 0xCE, 0xE3, 0x4A, 0xD7, 0x21, 0x16, 0x0E, 0xF1, 0x0C, 0x65, 0x31,
-    0x14, 0x3B, 0xD5, 0x26, 0x05, 0x42, 0x1B, 0xD6, 0x15, 0x45, 0x87, 0x60, 0x00, 0x56, 0x1A, 0x68,
-    0x16, 0x22, 0xC8, 0x2E, 0x1C, 0x33, 0x73, 0x15, 0x01, 0x6A, 0x2E, 0x97, 0x0C, 0x09, 0x5B, 0x6E,
-    0x01, 0x0C, 0x98, 0x14, 0x63, 0xF1, 0x39, 0x85, 0x45, 0x71, 0x03, 0x13, 0xBE, 0xC3, 0xFE, 0xCF,
-    0xE9, 0x54, 0x56, 0xAA, 0x4C, 0xD0, 0x5D, 0x2A, 0x6E, 0xC2, 0x58, 0xB0, 0x8D, 0x73, 0x2D, 0xB0,
-    0x8B, 0x42, 0x08, 0x29, 0xCC, 0xA0, 0x44, 0x76, 0xE0, 0x5A, 0x48, 0x98, 0xC1, 0x3B, 0x78, 0x60,
-    0xED, 0xB6, 0xDC, 0xD1, 0x30, 0xB3, 0x58, 0x24, 0xB2, 0xBF, 0x8A, 0x0F, 0xE4, 0x49, 0x78, 0x48,
-    0x69, 0x82, 0x25, 0x1F, 0x46, 0x4F, 0x86, 0x55, 0x5C, 0x2E, 0x77, 0x24, 0xB0, 0xCF, 0xC0, 0x5C,
-    0xC0, 0x8D, 0x1B, 0xDF, 0x00, 0xC2, 0x1E, 0x62, 0x24, 0xAA, 0xF4, 0x23, 0x51, 0x88, 0x87, 0x8B,
-    0x9D, 0x2F, 0xCB, 0xDC, 0x6B, 0xC1, 0xF2, 0xCD, 0xA0, 0x25, 0xBD, 0x6F, 0xC9, 0x3B, 0xEC, 0x71,
-    0xF5, 0x03, 0x00, 0xF5, 0x4E, 0x87, 0xBB, 0x3E, 0xD2, 0xB5, 0xB3, 0xB6, 0xE4, 0x03, 0x81, 0xDB,
-    0x89, 0xCB, 0x71, 0xFE, 0xA2, 0x2C, 0x97, 0xB2, 0x7C, 0xAC, 0x10, 0x46, 0xE4, 0xA3, 0xBC, 0x7E,
-    0x32, 0x9D, 0xAE, 0x77, 0x98, 0xEB, 0xB0, 0xA5, 0x3D, 0x55, 0xFC, 0x39, 0x95, 0xD0, 0x18, 0xF9,
-    0xC2, 0x1F, 0xCA, 0x4F, 0x0D, 0xCF, 0x67, 0x95, 0xB0, 0x15, 0xE4, 0x02, 0xAD, 0x60, 0x94, 0x62,
-    0xF1, 0xE5, 0xFF, 0x35, 0xD9, 0x81, 0xD8, 0x09, 0xDF, 0x63, 0xD6, 0xDC, 0x66, 0x5C, 0x81, 0xA2,
-    0xAB, 0xE2, 0x3B, 0x21, 0x14, 0x04, 0xEF, 0x22, 0x12, 0x97, 0x11, 0x54, 0x4B, 0xCA, 0x85, 0x00,
-    0xB0, 0x26, 0xC0, 0x8A, 0x05, 0x0A, 0xDB, 0xF1, 0xCE, 0x85, 0x4B, 0xE2, 0x42, 0xB9, 0xE5, 0x9E,
-    0x7E, 0x00, 0x66, 0x46, 0x08, 0xBB, 0x04, 0x2E, 0x2F, 0x61, 0x88, 0x04, 0x71, 0xEF, 0xB8, 0x80,
-    0x71, 0xB9, 0xB8, 0x55, 0x72, 0x5F, 0x14, 0xB7, 0xE0, 0xB6, 0x76, 0x64, 0x05, 0xE6, 0x83, 0xC6,
-    0x5D, 0xDA, 0xB7, 0xCF, 0xE8, 0xEF, 0x9A, 0x91, 0x91, 0xA4, 0x14, 0x36, 0x6E, 0x26, 0xCE, 0x1D,
-    0xEB, 0x7B, 0xA7, 0x46, 0x90, 0x95, 0x4E, 0xD8, 0xEB, 0xDC, 0x56, 0xF8, 0x4C, 0x59, 0x27, 0x2E,
-    0x42, 0xA3, 0xB8, 0x78, 0xDF, 0x71, 0x7E, 0x43, 0xFE, 0x96, 0x36, 0xAE, 0x94, 0x7B, 0x36, 0xE2,
-    0xC6, 0x47, 0x30, 0x72, 0x53, 0x96, 0x16, 0x33, 0xA7, 0xDD, 0x12, 0x64, 0xD4, 0x4D, 0xC5, 0x26,
-    0x29, 0x3F, 0xAE, 0x76, 0x77, 0x83, 0x8F, 0xAB, 0x8D, 0xCD, 0xB5, 0x7D, 0x6E, 0x43, 0x71, 0x68,
-    0xFC, 0xBA, 0xCD, 0xF6, 0xDB, 0xA3, 0x6C, 0x11, 0xD6, 0x23, 0xAB, 0x48, 0xD6, 0xAE, 0xCA, 0xBA,
-    0x38, 0x1C, 0xF7, 0x16, 0x60, 0xC1, 0x93, 0x05, 0xEB, 0x15, 0xB4, 0xAC, 0xB8, 0x8A, 0x28, 0x33,
-    0x61, 0x85, 0xF8, 0x6F, 0x28, 0xFE, 0x03, 0x12, 0xAE, 0xD9, 0xC5, 0xDA, 0x0A, 0x36, 0x5C, 0x00,
-    0xC6, 0x47, 0xB0, 0x92, 0x61, 0x57, 0x0C, 0xCD, 0x81, 0x9D, 0x11, 0x19, 0x31, 0x46, 0x17, 0xE9,
-    0x3C, 0xAB, 0x27, 0xFC, 0x55, 0x67, 0x93, 0x76, 0xD9, 0x6F, 0x75, 0xDA, 0x23, 0x07, 0xD5, 0xA5,
-    0x1D, 0xB4, 0xD5, 0xD5, 0x2A, 0xFD, 0x56, 0xA5, 0x2A, 0x8D, 0xDA, 0xC8, 0x24, 0x7D, 0x66, 0xAF,
-    0x26, 0xED, 0xEE, 0xAE, 0xAE, 0x97, 0x76, 0x75, 0xB3, 0xB4, 0x1B, 0xB7, 0xBB, 0x99, 0x2D, 0xBB,
-    0xD8, 0xC4, 0x66, 0x92, 0x4E, 0xD2, 0x05, 0x1A, 0xAF, 0xD2, 0x61, 0xB5, 0x73, 0xDE, 0xBE, 0xF8,
-    0x84, 0x44, 0x30, 0x7C, 0xCB, 0x33, 0x6E, 0x8F, 0xE3, 0x2F, 0x78, 0x82, 0x76, 0x1E, 0x90, 0xB2,
-    0x47, 0x98, 0xE1, 0x49, 0xCD, 0x88, 0x9A, 0x99, 0x11, 0xC2, 0x17, 0x17, 0x05, 0x42, 0x20, 0x97,
-    0x00, 0x5C, 0x32, 0x93, 0x1D, 0x92, 0x38, 0x06, 0x10, 0x8F, 0x0F, 0x84, 0xEE, 0xCD, 0x42, 0x76,
-    0xC2, 0xF8, 0xE9, 0xEA, 0x24, 0x09, 0x3F, 0xFF, 0xF0, 0xBF, 0xE6, 0xAE, 0x8D, 0xB3, 0x97, 0x79,
-    0xB9, 0x7C, 0x2A, 0x27, 0x75, 0x71, 0x64, 0x0D, 0x05, 0x72, 0xAC, 0x60, 0x8F, 0x00, 0xCB, 0x3B,
-    0x04, 0xAC, 0x44, 0xC8, 0xF4, 0x10, 0xB0, 0x7B, 0xC9, 0x64, 0xD5, 0x1E, 0x90, 0x81, 0x2C, 0x09,
-    0xA4, 0x43, 0x83, 0x64, 0x8A, 0x8A, 0x52, 0x81, 0x5A, 0x03, 0xF0, 0x06, 0x06, 0x97, 0x91, 0xBC,
-    0x61, 0x90, 0x63, 0x41, 0x9F, 0xC9, 0xEB, 0x78, 0xE9, 0xB0, 0x39, 0x39, 0xDF, 0x51, 0x68, 0x20,
-    0xD3, 0x93, 0x64, 0x91, 0xC0, 0x78, 0xAE, 0xCA, 0xA6, 0x9E, 0xE8, 0xD1, 0x55, 0x3F, 0x6A, 0x0E,
-    0xBE, 0x12, 0x4A, 0x66, 0x62, 0xAF, 0xA4, 0xF3, 0x7E, 0x06, 0x23, 0x98, 0x67, 0x8F, 0xF5, 0x7F,
-    0xA0, 0xDE, 0x5A, 0xDC, 0xB0, 0x0D, 0xDB, 0x00, 0x6A, 0x83, 0x27, 0x96, 0xF4, 0x7D, 0xB0, 0x64,
-    0x2D, 0xA7, 0xBB, 0x9B, 0xE4, 0x3D, 0xC5, 0x21, 0xDF, 0xFD, 0x59, 0x03, 0xD4, 0x2F, 0xBF, 0x57,
-    0xEA, 0xB9, 0xCF, 0x16, 0x27, 0xEC, 0x23, 0x13, 0x84, 0xC3, 0x7A, 0x87, 0x8C, 0x9B, 0x07, 0x0C,
-    0xE7, 0xAC, 0x8A, 0x4B, 0xCF, 0xA4, 0xAE, 0xF2, 0x24, 0x9C, 0x7B, 0x76, 0x03, 0xCE, 0x4B, 0x5D,
-    0xF5, 0x1F, 0x46, 0xAF, 0xE9, 0x86, 0x5E, 0xF6, 0x53, 0x3D, 0xC4, 0x35, 0x3E, 0xC6, 0xAD, 0x22,
-    0x9F, 0xC4, 0x92, 0x26, 0xBD, 0x79, 0x12, 0x97, 0xE4, 0x12, 0xD5, 0x74, 0xF2, 0xD8, 0x22, 0xB5,
-    0xC5, 0xE8, 0x40, 0x32, 0x94, 0xF7, 0x0B, 0xC0, 0x5E, 0x5D, 0x24, 0x95, 0x9E, 0x4D, 0xE9, 0x1C,
-    0xD2, 0x51, 0x72, 0x1F, 0x16, 0xB4, 0xFD, 0x58, 0xF3, 0x4E, 0x1A, 0x3F, 0x99, 0xF1, 0x50, 0xE2,
-    0x56, 0xF5, 0xB3, 0x72, 0x47, 0x57, 0xF5, 0xC3, 0x5E, 0x02, 0x74, 0x14, 0x09, 0x0C, 0x87, 0xCD,
-    0x69, 0x7A, 0x09, 0xB5, 0xDF, 0x0A, 0x4B, 0xDA, 0xA3, 0xA4, 0xF3, 0x3E, 0x41, 0x45, 0x5B, 0x3F,
-    0xCF, 0xDD, 0x6B, 0xB4, 0x97, 0xCE, 0xE5, 0x17, 0x1B, 0xF5, 0x16, 0x1F, 0x44, 0x6B, 0x0F, 0xD8,
-    0x5E, 0xF1, 0x78, 0x7E, 0xF0, 0x19, 0xA4, 0x45, 0x94, 0xB9, 0xA7, 0xCF, 0x85, 0xD3, 0xEC, 0xF3,
-    0x1E, 0x8A, 0x80, 0xB4, 0x5B, 0xFE, 0x00, 0x75, 0x07, 0xDD, 0x41, 0xD9, 0x2F, 0xB9, 0x2E, 0x8C,
-    0xCA, 0xF4, 0xF7, 0x65, 0xBF, 0x99, 0x64, 0x7C, 0x41, 0x71, 0x9E, 0x4E, 0xA4, 0x1F, 0x38, 0x8D,
-    0x72, 0xBC, 0x8F, 0x3D, 0x6A, 0x67, 0xD8, 0x9A, 0x9F, 0xF7, 0x3B, 0xBE, 0xA9, 0x25, 0x58, 0x8B,
-    0x6D, 0x38, 0xCF, 0xB5, 0x6D, 0xA4, 0x6A, 0xF2, 0x6B, 0xA4, 0x62, 0xFC, 0x5D, 0x2E, 0x6F, 0x21,
-    0xC1, 0x2D, 0x1C, 0xAC, 0x8E, 0x9F, 0xB8, 0x08, 0x8D, 0x75, 0xB7, 0x51, 0xCD, 0x3A, 0x95, 0x19,
-    0x72, 0x14, 0xDC, 0xE2, 0x6D, 0x7C, 0xAE, 0xCD, 0xB2, 0xB9, 0xC4, 0xFA, 0xF8, 0xD9, 0xA3, 0x50,
-    0x21, 0xAA, 0x5E, 0x93, 0x6B, 0x8A, 0x5B, 0x8F, 0x53, 0x74, 0x21, 0x25, 0xDA, 0xC8, 0x86, 0x02,
-    0x38, 0x16, 0xFF, 0x42, 0x3B, 0xB6, 0x51, 0xA8, 0x2D, 0xE3, 0x31, 0x78, 0x5F, 0x72, 0xC1, 0x8F,
-    0x26, 0x10, 0xE0, 0x29, 0xEA, 0x24, 0x4B, 0x2C, 0x76, 0x78, 0xC7, 0x2B, 0xE6, 0x7F, 0x4E, 0xF4,
-    0x0D, 0x79, 0x19, 0x67, 0xC9, 0xAB, 0x50, 0xC3, 0x42, 0x03, 0xB9, 0xF5, 0x36, 0x40, 0xEB, 0xB2,
-    0x15, 0x75, 0xFE, 0x80, 0x54, 0xA2, 0xA4, 0x41, 0xAC, 0x91, 0x2D, 0x03, 0x4E, 0xD1, 0xA8, 0x45,
-    0x3D, 0x50, 0x40, 0x12, 0x15, 0x53, 0x35, 0x92, 0xC0, 0x8F, 0xC6, 0x8F, 0xC9, 0xAB, 0x85, 0x8E,
-    0xB2, 0xDC, 0x2C, 0xF6, 0xA4, 0xDC, 0x2E, 0x8F, 0xA5, 0xBD, 0x8B, 0x6B, 0xC4, 0x60, 0xD6, 0x44,
-    0x02, 0x23, 0x33, 0xA2, 0x5E, 0x26, 0x20, 0xD9, 0xD2, 0xCF, 0xE6, 0xFB, 0x4F, 0xAC, 0xE9, 0xCD,
-    0x2C, 0x91, 0x95, 0xB3, 0x06, 0xF9, 0x84, 0x9A, 0x7E, 0xDC, 0x64, 0x51, 0x94, 0xBB, 0x72, 0x71,
-    0xE6, 0x6B, 0x3D, 0x11, 0xB2, 0x4D, 0xEE, 0x9A, 0x2C, 0x58, 0x89, 0x1E, 0xA4, 0x43, 0xC9, 0x2B,
-    0x91, 0x7D, 0x63, 0x34, 0x59, 0xBE, 0x45, 0x01, 0x28, 0x1F, 0x7F, 0x76, 0xDC, 0x13, 0xA9, 0xA1,
-    0xB8, 0x89, 0x26, 0xE5, 0x38, 0x35, 0x8F, 0x63, 0x32, 0xFB, 0x72, 0x4D, 0x20, 0xF6, 0xE3, 0xFE,
-    0x8E, 0x21, 0xEB, 0xCF, 0x91, 0xBE, 0x9A, 0x12, 0x15, 0x12, 0x90, 0x2D, 0x20, 0xEF, 0xE1, 0x00,
-    0x39, 0x35, 0x92, 0xC6, 0xAE, 0xD6, 0x4F, 0xDE, 0x7C, 0xFA, 0x1C, 0xE4, 0xF2, 0x76, 0xEA, 0x70,
-    0x1E, 0xE5, 0xFD, 0x91, 0x0A, 0x60, 0x24, 0xF2, 0x74, 0x2D, 0x1D, 0x77, 0xF6, 0xAC, 0xB8, 0x25,
-    0x3D, 0x81, 0xD8, 0x2B, 0x07, 0xAA, 0xAF, 0x37, 0x99, 0xD7, 0xA7, 0x17, 0x21, 0xD9, 0x0B, 0x97,
-    0x52, 0xF5, 0xEB, 0x22, 0x1F, 0xEF, 0x90, 0xA5, 0x6B, 0xE2, 0x37, 0xA4, 0xA9, 0x59, 0x00, 0x75,
-    0xD0, 0x20, 0x34, 0xC2, 0xA5, 0x14, 0xED, 0x50, 0x2B, 0xBB, 0x66, 0x3D, 0xA3, 0xEB, 0xE9, 0xFA,
-    0x79, 0x0B, 0xF7, 0xC1, 0x74, 0x5A, 0xDE, 0x93, 0xC2, 0x80, 0x63, 0xEB, 0x57, 0x8A, 0xEB, 0x47,
-    0x24, 0xED, 0x30, 0x31, 0x40, 0x07, 0x88, 0xA4, 0x6E, 0xBB, 0xDA, 0x84, 0xF4, 0xFD, 0xE0, 0x46,
-    0xAD, 0xDA, 0x73, 0x41, 0xAD, 0xE9, 0x4E, 0x50, 0xDD, 0xF1, 0x9A, 0xF0, 0x5A, 0x15, 0xE6, 0xFA,
-    0x2C, 0x9D, 0xA3, 0xE5, 0x4D, 0x74, 0xAD, 0xFF, 0x91, 0x12, 0xF3, 0xC5, 0x67, 0xBF, 0xB9, 0xBE,
-    0xB6, 0x26, 0x53, 0x4B, 0xE0, 0xA7, 0x11, 0xA9, 0xBC, 0x0D, 0xF3, 0x0D, 0xD5, 0x9D, 0x0B, 0x6B,
-    0x35, 0xBC, 0xD7, 0x0B, 0x56, 0x40, 0x9E, 0x88, 0xDF, 0x8E, 0x55, 0x7F, 0xBA, 0x06, 0xD5, 0x28,
-    0xE8, 0x1A, 0x85, 0xBA, 0x02, 0xAF, 0xA1, 0x1A, 0xE6, 0x46, 0x58, 0x86, 0xEA, 0x62, 0xAE, 0x7A,
-    0x3A, 0x85, 0x6A, 0x12, 0xD5, 0x04, 0xD5, 0x90, 0xCA, 0x61, 0x0D, 0x54, 0x93, 0xA8, 0xBE, 0xF4,
-    0x7D, 0xAA, 0x91, 0x7B, 0xAA, 0xF7, 0x8D, 0xFF, 0xE8, 0xDA, 0xBE, 0x59, 0xD1, 0x67, 0xFD, 0x7F,
-    0x37, 0xCB, 0x57, 0x40, 0xF4, 0x77, 0xD1, 0x97, 0x7A, 0x5F, 0xE4, 0x89, 0x09, 0xD7, 0xFC, 0xBF,
-    0x9B, 0xE5, 0xA5, 0x15, 0xDF, 0x98, 0xF7, 0x1B, 0xFF, 0x30, 0x1F, 0xC0, 0x8E, 0x17, 0x55, 0x8D,
-    0x14, 0x0E, 0xD4, 0x50, 0x5D, 0xD1, 0x0A, 0x50, 0xFB, 0x50, 0x4D, 0x2B, 0xA2, 0xBA, 0x81, 0xEA,
-    0x15, 0x82, 0xEA, 0x06, 0xA8, 0xD1, 0x89, 0x40, 0x35, 0x50, 0x0F, 0x27, 0xA1, 0x96, 0x9F, 0x64,
-    0xEC, 0x0D, 0x84, 0x1A, 0x42, 0x91, 0x17, 0xF9, 0x94, 0x7E, 0xB9, 0x1C, 0xFB, 0xDF, 0x66, 0xDE,
-    0x3C, 0x45, 0x79, 0x58, 0x85, 0x35, 0x42, 0x37, 0xCF, 0xF6, 0x7B, 0x0F, 0x81, 0x17, 0x36, 0x81,
-    0xF1, 0x67, 0x5D, 0xD5, 0xFF, 0x00, 0x1D, 0xCD, 0xB1, 0x0D, 0xC2, 0x40, 0x0C, 0x05, 0xD0, 0x9F,
-    0x13, 0x1D, 0x43, 0x64, 0x02, 0xF0, 0x06, 0x80, 0x32, 0x53, 0x0A, 0x1A, 0x74, 0xEE, 0x18, 0xEB,
-    0x76, 0x60, 0x82, 0x24, 0x13, 0x50, 0xBA, 0x48, 0xCE, 0xF1, 0xB7, 0x25, 0x3F, 0xF9, 0xDB, 0x85,
-    0x01, 0xBC, 0xC0, 0x7A, 0xA7, 0x55, 0x53, 0xA3, 0xF3, 0xC8, 0x30, 0xE7, 0xE5, 0x73, 0xB9, 0x46,
-    0xA8, 0xBE, 0x18, 0x3D, 0x44, 0x43, 0xFF, 0x1A, 0x5D, 0x5D, 0x43, 0x6D, 0x26, 0x6E, 0x78, 0xF6,
-    0xE2, 0x3B, 0x5A, 0x87, 0xF8, 0xE4, 0x1D, 0xC5, 0xB7, 0x10, 0xB2, 0xC7, 0x26, 0x02, 0x67, 0xC8,
-    0x8F, 0x96, 0xFF, 0x83, 0x3F, 0x6E, 0x77, 0x5A, 0x7A, 0x3E, 0xCF, 0x19, 0x43, 0xF4, 0x09,
+static const uint8_t bookerly_12_bolditalicBitmaps[26368] = {
+    0xBD, 0x9A, 0x3D, 0xAC, 0x1D, 0xC7, 0x95, 0xE7, 0x7F, 0xDD, 0x45, 0xAA, 0x67, 0xDD, 0xF0, 0x16,
+    0xB1, 0xA0, 0x0C, 0xAF, 0x3D, 0x9E, 0x72, 0x30, 0xC1, 0x2E, 0x20, 0xBB, 0x92, 0x09, 0x14, 0x88,
+    0xAC, 0x92, 0x14, 0x70, 0x01, 0x05, 0x22, 0x16, 0xBC, 0xC9, 0x4C, 0x20, 0x03, 0x3B, 0xC1, 0xC0,
+    0x0E, 0x34, 0x81, 0x02, 0x07, 0xE4, 0xAB, 0x96, 0x19, 0xC8, 0x80, 0x02, 0x33, 0x58, 0xC1, 0xA1,
+    0x1D, 0x38, 0xB0, 0x89, 0x05, 0xE4, 0xC0, 0x81, 0xA1, 0x7D, 0x7C, 0x5D, 0x22, 0x03, 0x07, 0x0A,
+    0xD4, 0x18, 0x2D, 0xE0, 0xC0, 0x81, 0x5A, 0xD2, 0x78, 0x67, 0x30, 0x02, 0x96, 0xA5, 0x51, 0x79,
+    0x55, 0xF4, 0xAB, 0xEE, 0xB3, 0x41, 0xDF, 0xFB, 0x48, 0x61, 0x66, 0x3F, 0xC6, 0x5E, 0xB9, 0x71,
+    0x2F, 0x5E, 0x77, 0xDF, 0xEE, 0x3A, 0xA7, 0xCF, 0xF7, 0xFF, 0xFF, 0x9A, 0xBF, 0x6A, 0xAA, 0x2A,
+    0x5D, 0xEE, 0x52, 0x3F, 0xEB, 0x49, 0x47, 0x1D, 0xF5, 0x60, 0xBC, 0xC1, 0xF2, 0x35, 0xE0, 0x1C,
+    0x81, 0x91, 0x3B, 0x5C, 0xA0, 0x7F, 0xE5, 0x6E, 0xAE, 0xCE, 0xDE, 0xFC, 0xC7, 0x7C, 0xE4, 0xBA,
+    0x77, 0xD2, 0xF5, 0xCB, 0xFD, 0xCD, 0x81, 0xFD, 0x66, 0xD5, 0x8C, 0xEB, 0x26, 0x2E, 0xF7, 0xF1,
+    0xFC, 0xC9, 0x0B, 0xFF, 0xCD, 0x88, 0x2C, 0x5F, 0x5A, 0xC7, 0xBF, 0xA7, 0x58, 0x9A, 0xEC, 0x68,
+    0xD3, 0x65, 0x82, 0x48, 0x1A, 0x45, 0x52, 0x37, 0x57, 0xFA, 0x58, 0xD0, 0x6F, 0x66, 0xF4, 0x77,
+    0xD2, 0x7E, 0x81, 0x27, 0x40, 0x0D, 0xF0, 0x12, 0xBC, 0x38, 0x10, 0xC4, 0x9B, 0xFB, 0x55, 0xBD,
+    0xF7, 0xAB, 0xE9, 0xC6, 0x13, 0x4F, 0x75, 0x1F, 0xDF, 0xF3, 0xAE, 0xD0, 0x4A, 0xA4, 0x17, 0xB0,
+    0x95, 0x46, 0xE6, 0xEB, 0x4F, 0x8C, 0xFA, 0xDE, 0xBD, 0xB4, 0x3C, 0x79, 0xD4, 0x9F, 0xBE, 0x10,
+    0x9D, 0x64, 0xC6, 0x42, 0x33, 0xC3, 0xD7, 0x40, 0x45, 0x78, 0x0A, 0x1E, 0xF3, 0x07, 0xE5, 0xB8,
+    0x40, 0x1B, 0xB1, 0x05, 0x33, 0xA8, 0xD3, 0x4C, 0xC5, 0x5E, 0x99, 0xFB, 0x48, 0xD5, 0xC3, 0x0D,
+    0xBA, 0xE9, 0xB2, 0x9A, 0xB1, 0x4F, 0x67, 0x07, 0xC7, 0xFA, 0xCD, 0x44, 0x9B, 0x8F, 0xF4, 0x33,
+    0x6B, 0x77, 0x9A, 0x8A, 0x5B, 0xBB, 0xB5, 0xBF, 0x97, 0x2A, 0x5C, 0x37, 0xCF, 0x64, 0xD4, 0x54,
+    0xFB, 0x88, 0x53, 0xC9, 0xD1, 0x26, 0x3D, 0x14, 0x8C, 0x77, 0xFD, 0x44, 0x65, 0x3D, 0x41, 0xC7,
+    0x46, 0x66, 0xBE, 0x06, 0x7F, 0x09, 0x17, 0x78, 0xB8, 0x85, 0x04, 0x8C, 0x02, 0x04, 0x1D, 0xC1,
+    0xB5, 0x09, 0xF4, 0x50, 0xA0, 0x7B, 0xAF, 0xF0, 0x8D, 0xE6, 0x34, 0x37, 0xC7, 0x84, 0xD9, 0xAE,
+    0x8C, 0x71, 0x7C, 0x80, 0x64, 0x97, 0x59, 0xDC, 0xB9, 0xEB, 0x04, 0x3D, 0x3B, 0xEC, 0xCB, 0x8B,
+    0xF1, 0xFD, 0x6C, 0xDF, 0x8D, 0x6D, 0x55, 0x12, 0x09, 0xB7, 0xC6, 0x99, 0x5E, 0x44, 0x6E, 0x11,
+    0x56, 0x2B, 0x11, 0x18, 0xE7, 0x4D, 0x4E, 0xFF, 0xEA, 0x3B, 0xA9, 0x1E, 0x99, 0x2B, 0x77, 0x67,
+    0x80, 0x3F, 0x86, 0x85, 0x2E, 0x61, 0x22, 0x01, 0x2A, 0x6D, 0xA1, 0x4B, 0xF4, 0x13, 0x3A, 0x62,
+    0x06, 0xAC, 0xC7, 0xF1, 0xA9, 0x8F, 0xF5, 0x98, 0x88, 0x8E, 0xF4, 0x33, 0x2A, 0xD1, 0x54, 0xB8,
+    0x03, 0x5F, 0x84, 0xAF, 0xA2, 0x12, 0x5D, 0xA2, 0x9F, 0xD1, 0x11, 0x3B, 0x6C, 0xEB, 0xA9, 0x4C,
+    0x3F, 0x61, 0x07, 0xEE, 0xD0, 0x66, 0x74, 0xC4, 0xD1, 0x16, 0x74, 0xE4, 0x08, 0x95, 0xB0, 0xBE,
+    0x2D, 0xD8, 0xD8, 0x16, 0xDC, 0xC0, 0x37, 0x80, 0x0B, 0x5C, 0x89, 0x4F, 0x1D, 0x77, 0x72, 0xAE,
+    0x97, 0x37, 0xC7, 0x1A, 0x7E, 0xFA, 0xEC, 0x5B, 0x03, 0x3F, 0x07, 0x38, 0x7E, 0xF8, 0xF9, 0xE6,
+    0xFA, 0xE3, 0x51, 0x96, 0xDB, 0xEB, 0x8F, 0x1F, 0x3D, 0x09, 0x34, 0xB7, 0x6C, 0x0C, 0xBE, 0x76,
+    0xB3, 0xEB, 0xD2, 0xD7, 0x81, 0x71, 0x91, 0x55, 0x96, 0xF3, 0xFA, 0xAD, 0x7F, 0x2C, 0x17, 0x81,
+    0x36, 0x83, 0x89, 0x50, 0xA1, 0x9B, 0xC1, 0xFD, 0xEF, 0xCE, 0xE8, 0xFF, 0xD3, 0x99, 0x6D, 0xBB,
+    0x08, 0x9D, 0x44, 0x9C, 0x24, 0xE4, 0x07, 0x45, 0x55, 0x55, 0xFB, 0xD4, 0x56, 0x3D, 0xB5, 0xD5,
+    0xC6, 0xB6, 0xBA, 0xA1, 0xAD, 0xCE, 0xAB, 0x1A, 0x50, 0x65, 0xA4, 0x4B, 0x23, 0x7A, 0x1E, 0xBD,
+    0x8D, 0x61, 0x08, 0xDE, 0x9D, 0xAE, 0x18, 0xC9, 0x74, 0x32, 0x9C, 0xC5, 0xDB, 0x63, 0xB5, 0x19,
+    0x6B, 0x2B, 0x85, 0xBF, 0xC8, 0xF4, 0x19, 0x9D, 0xD0, 0x09, 0x33, 0x63, 0x27, 0x5C, 0xDC, 0x7F,
+    0xC2, 0xC0, 0xE8, 0x11, 0x6F, 0x24, 0x3B, 0xC9, 0x70, 0x15, 0xC2, 0x8A, 0x96, 0x15, 0xF9, 0x7E,
+    0xED, 0x52, 0x97, 0xB5, 0x37, 0xD3, 0x39, 0x04, 0xBA, 0x02, 0x21, 0xD2, 0x55, 0x08, 0x91, 0xBE,
+    0xC0, 0x38, 0xA0, 0x33, 0xCD, 0x0A, 0x46, 0x24, 0x89, 0xC8, 0x5D, 0x91, 0xCA, 0xB6, 0xC6, 0x82,
+    0x96, 0x85, 0xF1, 0xFB, 0x55, 0xA5, 0x3E, 0x75, 0xD8, 0x48, 0xB3, 0x80, 0x9D, 0xF8, 0x72, 0xA5,
+    0x95, 0x4A, 0xFF, 0x7A, 0x01, 0x9D, 0xC0, 0x46, 0x58, 0xC1, 0xA4, 0xF3, 0xDF, 0x12, 0x3F, 0x4A,
+    0x42, 0x1E, 0x9C, 0x45, 0xAE, 0x07, 0x13, 0x37, 0x01, 0x99, 0x46, 0x22, 0x46, 0x68, 0x1E, 0x14,
+    0xCC, 0xAB, 0x53, 0x53, 0x9C, 0x37, 0xB1, 0x36, 0xB5, 0x4B, 0x46, 0x64, 0x11, 0x91, 0xFF, 0x29,
+    0x22, 0x11, 0x13, 0x21, 0x40, 0x5B, 0x40, 0x4F, 0xFB, 0xB2, 0x20, 0x15, 0x27, 0x05, 0x77, 0xFB,
+    0x87, 0x9C, 0x00, 0x0B, 0x20, 0x9E, 0x46, 0x0A, 0x8D, 0x08, 0x34, 0xE2, 0x21, 0x0C, 0xE0, 0xF6,
+    0x5F, 0x81, 0x6E, 0xE5, 0x0B, 0x63, 0xC1, 0xC9, 0x84, 0x5B, 0x0E, 0xEA, 0x34, 0x9E, 0x56, 0x26,
+    0xC6, 0xD5, 0xEB, 0x15, 0x64, 0x40, 0x67, 0x10, 0x4F, 0x27, 0x05, 0x27, 0x4B, 0xB3, 0xBE, 0x5E,
+    0xFB, 0xD4, 0x27, 0x37, 0x98, 0x69, 0x25, 0xA8, 0xD2, 0x56, 0x9D, 0xF4, 0x6C, 0x7E, 0x23, 0x58,
+    0x49, 0x98, 0xF5, 0x61, 0x4A, 0x3A, 0x91, 0x37, 0x45, 0xA4, 0x17, 0x29, 0x0E, 0x37, 0x14, 0x55,
+    0x9B, 0xC1, 0x46, 0xDA, 0x0A, 0x66, 0x82, 0x75, 0x33, 0xCD, 0xE8, 0xE9, 0x0A, 0xB8, 0xCD, 0x04,
+    0x3A, 0x6D, 0xDA, 0xED, 0x2D, 0xBC, 0x45, 0x8B, 0x5D, 0x51, 0x22, 0xB8, 0x69, 0x6D, 0x6A, 0x5B,
+    0xFA, 0x59, 0x4F, 0x36, 0x8E, 0xB8, 0xFB, 0x89, 0xB0, 0xD2, 0x4A, 0xC6, 0xDD, 0xCF, 0xAA, 0xE8,
+    0x64, 0x07, 0x33, 0x2D, 0xB8, 0x67, 0x4B, 0x5B, 0xF5, 0x83, 0x17, 0x27, 0x23, 0x2B, 0xFA, 0x2C,
+    0x52, 0x2E, 0x42, 0x27, 0x13, 0x56, 0x32, 0xE3, 0xF7, 0x2B, 0x6B, 0xB3, 0x34, 0x95, 0xB5, 0xDD,
+    0xBE, 0x4B, 0xB3, 0x36, 0x0B, 0xF2, 0x61, 0x25, 0x48, 0xA1, 0x97, 0x04, 0x76, 0x82, 0x71, 0xA0,
+    0x5B, 0x61, 0xCC, 0x58, 0x89, 0xD8, 0xBD, 0xCF, 0xDA, 0x64, 0xA6, 0xE0, 0xF3, 0xD9, 0x73, 0x5E,
+    0x54, 0xC9, 0xC6, 0x13, 0xAE, 0x82, 0xC1, 0xCC, 0x5D, 0x26, 0x3F, 0x52, 0x97, 0xF8, 0x4B, 0x46,
+    0xCC, 0xA4, 0x52, 0x53, 0xA8, 0x4D, 0xDD, 0xD2, 0x11, 0x80, 0x6F, 0xD3, 0x55, 0xC2, 0xDC, 0xAD,
+    0x84, 0x99, 0xD1, 0xE3, 0x32, 0x9D, 0x78, 0x42, 0xA6, 0xAB, 0xF0, 0x6D, 0x60, 0x94, 0x65, 0x94,
+    0xE5, 0x9B, 0xB7, 0x7F, 0x0C, 0x3C, 0xBE, 0xBB, 0xB6, 0x1D, 0x6E, 0x37, 0x3F, 0x09, 0x61, 0xC0,
+    0x16, 0x5A, 0xF1, 0xD8, 0x4C, 0xBB, 0xD0, 0x57, 0xC6, 0xC9, 0x2C, 0x84, 0x81, 0x27, 0xF7, 0x22,
+    0x4C, 0x0A, 0x75, 0x5C, 0x5F, 0x72, 0x38, 0x2E, 0x51, 0x55, 0x32, 0xF1, 0x32, 0xC7, 0x48, 0x0C,
+    0x03, 0x9C, 0xE3, 0x88, 0x95, 0x65, 0x2B, 0xA2, 0x8F, 0x03, 0x8C, 0x32, 0x83, 0x15, 0x29, 0x74,
+    0xAB, 0xFF, 0x72, 0x21, 0x0C, 0x74, 0xA9, 0x4B, 0xD0, 0xCF, 0x8E, 0xA3, 0x27, 0xF4, 0xDD, 0xAC,
+    0x25, 0x39, 0x3D, 0xDC, 0xB1, 0x43, 0x3D, 0xEE, 0xE6, 0x4B, 0xEA, 0xE3, 0xE4, 0x9A, 0xA4, 0xBF,
+    0x37, 0x14, 0x3D, 0xDC, 0xB8, 0xD1, 0xCD, 0x37, 0xD4, 0x47, 0xD9, 0xDC, 0xCC, 0xF6, 0xCA, 0x14,
+    0xC6, 0xBF, 0x29, 0x66, 0x90, 0xB7, 0x64, 0x08, 0x6D, 0x35, 0x7F, 0x4B, 0x05, 0x68, 0x2B, 0x80,
+    0x5A, 0x68, 0x7E, 0x48, 0x27, 0xB7, 0x65, 0x40, 0x89, 0x64, 0xE0, 0xC5, 0x9F, 0x6C, 0xDA, 0xFE,
+    0xD5, 0xE1, 0xA2, 0xAE, 0x02, 0x7A, 0x01, 0xEC, 0x02, 0x5C, 0x3E, 0x01, 0x6A, 0x80, 0x26, 0x07,
+    0x50, 0xC9, 0x41, 0x3F, 0x39, 0x8F, 0x8E, 0x6E, 0xC0, 0x8A, 0x44, 0x82, 0x48, 0x64, 0xD9, 0x4A,
+    0xA1, 0x99, 0x54, 0xC2, 0xCC, 0x76, 0x41, 0x96, 0xB0, 0xB6, 0xB2, 0xF0, 0xA5, 0x37, 0x7C, 0x2B,
+    0x92, 0x3A, 0xB9, 0x5F, 0x1B, 0xFB, 0xE6, 0x82, 0x1B, 0x56, 0x9C, 0x5F, 0x08, 0xBE, 0x32, 0xAA,
+    0xCC, 0x28, 0x13, 0x22, 0x99, 0xE5, 0xCB, 0xB5, 0xA9, 0xED, 0xD2, 0xD6, 0x66, 0x51, 0xB5, 0xAD,
+    0xAA, 0xA8, 0xDA, 0x15, 0x93, 0x82, 0x48, 0x1C, 0xCF, 0xF2, 0xF5, 0x5B, 0x3F, 0xA4, 0x15, 0x89,
+    0x4A, 0x24, 0xA9, 0x95, 0xAA, 0x16, 0x2E, 0xB7, 0x0B, 0x1A, 0x01, 0x82, 0x07, 0x17, 0xB7, 0x20,
+    0x56, 0x15, 0x10, 0xF6, 0x27, 0x0A, 0x9F, 0x6F, 0x65, 0x30, 0x83, 0x13, 0x89, 0x9D, 0xC8, 0x84,
+    0x3D, 0xC4, 0xE5, 0x97, 0xDE, 0xB8, 0x45, 0x2F, 0x92, 0x09, 0x22, 0x85, 0xE7, 0x92, 0xCD, 0xB8,
+    0x68, 0x13, 0x2B, 0x2E, 0x76, 0x99, 0xD1, 0xDB, 0xD8, 0xAC, 0x8C, 0x74, 0x59, 0x55, 0xEC, 0xA4,
+    0x67, 0x46, 0x82, 0x57, 0xB5, 0xAD, 0x98, 0x49, 0x27, 0x04, 0x37, 0x98, 0xD4, 0xC8, 0xB7, 0xC4,
+    0x07, 0x91, 0xB9, 0x15, 0xF9, 0xDB, 0x43, 0x80, 0xED, 0x76, 0x3B, 0x82, 0xC8, 0xD4, 0x8B, 0x64,
+    0x46, 0xAE, 0xE3, 0xA2, 0x41, 0xCF, 0x9D, 0xEF, 0xF2, 0xDE, 0xD0, 0xA3, 0xCC, 0x38, 0xC9, 0xE8,
+    0x5F, 0x5F, 0x63, 0x7F, 0xF2, 0x02, 0xC2, 0xD7, 0x70, 0x83, 0xF6, 0xE6, 0xD7, 0x2F, 0xC4, 0x20,
+    0x92, 0xAC, 0x48, 0x86, 0xDD, 0x6E, 0xD7, 0x88, 0x08, 0xA3, 0x08, 0x36, 0x5E, 0xC6, 0xC5, 0x4B,
+    0xB8, 0xE1, 0x29, 0x82, 0x87, 0xD1, 0xC3, 0xF8, 0xE7, 0x03, 0x22, 0x11, 0x91, 0xA1, 0x59, 0xB6,
+    0xE5, 0x55, 0x05, 0x55, 0xF6, 0x35, 0x55, 0x22, 0xA3, 0x0C, 0xC0, 0xB7, 0x7E, 0x04, 0x41, 0x0A,
+    0x4E, 0x24, 0xEA, 0x42, 0x51, 0x0B, 0xDA, 0x8F, 0x9E, 0xA4, 0x13, 0xB4, 0xCB, 0xDE, 0x62, 0xAA,
+    0xB2, 0xBB, 0xE6, 0xA2, 0x96, 0x7B, 0x95, 0x31, 0xBB, 0xC8, 0xAA, 0x56, 0xF4, 0x6C, 0x33, 0x0B,
+    0xF2, 0x60, 0x8C, 0x4A, 0xA4, 0xD2, 0x9D, 0x79, 0x65, 0x77, 0xED, 0xFC, 0xEE, 0xAA, 0x91, 0x49,
+    0x56, 0xC6, 0xDC, 0xCB, 0xD0, 0x56, 0xCC, 0x84, 0x8B, 0x6D, 0x45, 0x15, 0x5C, 0x24, 0x78, 0x55,
+    0xE8, 0x33, 0xC1, 0x33, 0x8A, 0x64, 0xB4, 0x88, 0xC0, 0xBA, 0x7B, 0x21, 0x61, 0x26, 0x56, 0x1E,
+    0xBD, 0xA1, 0x6E, 0x2D, 0x43, 0x55, 0x82, 0x3C, 0x2B, 0xB9, 0x97, 0x14, 0xC4, 0xB3, 0xDB, 0x35,
+    0xB2, 0x32, 0x16, 0xEC, 0xD6, 0x55, 0x06, 0xDC, 0x40, 0xF0, 0x8C, 0x20, 0xB0, 0xD2, 0x2C, 0xB4,
+    0x0B, 0xDB, 0xFD, 0x5D, 0x21, 0x88, 0x1F, 0xC5, 0xC3, 0x6E, 0x47, 0x23, 0x2B, 0x8C, 0x65, 0xAB,
+    0x7A, 0x36, 0x6E, 0x0F, 0xE8, 0x86, 0x2D, 0x5E, 0x46, 0xB6, 0xAF, 0x00, 0x2B, 0xFC, 0x13, 0xDB,
+    0x65, 0xE8, 0x13, 0xE8, 0x99, 0x27, 0x6C, 0x24, 0xC8, 0x40, 0x58, 0xC1, 0xCE, 0xFB, 0x87, 0x6E,
+    0x64, 0x71, 0x2B, 0x63, 0x36, 0x05, 0x1B, 0x6D, 0xC4, 0x45, 0x01, 0x77, 0xB3, 0x40, 0x78, 0x7E,
+    0x86, 0x31, 0x78, 0x18, 0x17, 0x40, 0x2A, 0x20, 0x2B, 0x34, 0xCB, 0xE8, 0x69, 0xAB, 0x8B, 0xA8,
+    0x6A, 0x12, 0xAA, 0xE8, 0x42, 0x57, 0x94, 0x10, 0xA4, 0x91, 0x69, 0x14, 0x42, 0x3C, 0xD8, 0x94,
+    0x4E, 0x32, 0xBD, 0x78, 0xFA, 0xB4, 0x29, 0xBD, 0x6E, 0x0A, 0xD9, 0x08, 0xE3, 0xA6, 0xA3, 0x9E,
+    0x21, 0x78, 0xDA, 0xCA, 0x9F, 0xE9, 0xA4, 0x66, 0x17, 0xCD, 0xD3, 0xEB, 0xAE, 0x06, 0x91, 0xF7,
+    0x45, 0xC4, 0x73, 0x7E, 0xC7, 0xF9, 0x1D, 0xBD, 0x44, 0x25, 0xB1, 0x91, 0xD4, 0xCA, 0x80, 0xA9,
+    0x6C, 0xF3, 0xA5, 0x24, 0xD4, 0xFD, 0xE9, 0xA8, 0xC2, 0x27, 0xF9, 0x72, 0x80, 0xE3, 0x13, 0x63,
+    0x07, 0x9C, 0xFD, 0xDE, 0xAB, 0x33, 0xFA, 0x95, 0x4F, 0xEE, 0x16, 0xBA, 0x28, 0xD3, 0x8A, 0x4A,
+    0x2E, 0xB9, 0x81, 0xA2, 0xB3, 0x9E, 0xB8, 0xD1, 0x56, 0x95, 0xB1, 0xDC, 0x60, 0x41, 0xC7, 0x3F,
+    0x21, 0x78, 0xBB, 0xD0, 0x48, 0x35, 0xE2, 0x11, 0x81, 0x9D, 0x6F, 0x76, 0xDE, 0xAC, 0x8C, 0x0B,
+    0x63, 0x7A, 0x4C, 0x7C, 0x2B, 0x5E, 0x47, 0x5C, 0xA5, 0xA2, 0x64, 0x32, 0x03, 0x61, 0x6D, 0x32,
+    0xDD, 0xBB, 0xC9, 0xC2, 0x71, 0xB8, 0x99, 0xD0, 0xF7, 0xAA, 0x83, 0x6A, 0xFE, 0x6E, 0xC6, 0x0C,
+    0x72, 0x87, 0x36, 0xF7, 0x12, 0x71, 0xB8, 0x8A, 0x4A, 0xAD, 0x0C, 0x04, 0x74, 0xC1, 0x2E, 0x88,
+    0xEF, 0x65, 0xEA, 0xD2, 0x36, 0x74, 0x00, 0xDF, 0xBC, 0x05, 0x22, 0x13, 0x41, 0xC4, 0x9B, 0x6C,
+    0x6A, 0x57, 0x71, 0x93, 0xF8, 0x76, 0x35, 0x09, 0xFB, 0xFE, 0x42, 0xBB, 0xBA, 0x88, 0xFD, 0xA0,
+    0x6E, 0x3B, 0xEE, 0x9D, 0x8A, 0xAA, 0x2E, 0x32, 0xDE, 0x5C, 0x30, 0xC9, 0xA6, 0x6E, 0x41, 0x3E,
+    0x14, 0xDF, 0x89, 0x4C, 0xF4, 0xB2, 0x6F, 0xE2, 0x7C, 0xE9, 0x0D, 0xCF, 0x28, 0x2B, 0x41, 0x64,
+    0x3A, 0x37, 0xF6, 0x15, 0x17, 0x05, 0x3D, 0xDB, 0xD8, 0x65, 0x9D, 0xDA, 0xAA, 0x0A, 0xA3, 0xAA,
+    0xB8, 0xFB, 0x15, 0x2D, 0x85, 0x6E, 0xBD, 0xB5, 0xE5, 0xB1, 0xB0, 0x05, 0x94, 0x99, 0xB7, 0x4C,
+    0xB3, 0x32, 0x1F, 0x54, 0x64, 0x94, 0x09, 0x82, 0x08, 0x98, 0x6C, 0xB6, 0xE8, 0x9E, 0x10, 0xAF,
+    0x56, 0x4C, 0xC2, 0xCE, 0xED, 0x42, 0xBB, 0xE2, 0x22, 0x76, 0x56, 0x75, 0xBF, 0xEB, 0x26, 0x75,
+    0x48, 0x83, 0x71, 0x50, 0x0B, 0x3A, 0x61, 0x93, 0x5A, 0x40, 0xFE, 0xBB, 0x78, 0x3A, 0x91, 0x08,
+    0x46, 0x06, 0xC0, 0xCD, 0xB0, 0xC5, 0x36, 0x8C, 0x72, 0x7B, 0xA0, 0x19, 0xA5, 0x1C, 0x06, 0x71,
+    0x1E, 0xF7, 0x7C, 0xE1, 0x0D, 0x8F, 0x15, 0x19, 0x3A, 0xF9, 0x70, 0xE1, 0xDF, 0x54, 0x93, 0x70,
+    0x83, 0xA0, 0x4A, 0x9F, 0x08, 0x5E, 0xE8, 0x93, 0x99, 0x18, 0xBF, 0x5C, 0xD0, 0xB2, 0x6C, 0xE1,
+    0x69, 0x7E, 0x95, 0x68, 0xAB, 0x1B, 0x70, 0x77, 0x17, 0x54, 0xD1, 0x89, 0x30, 0x8C, 0x53, 0x90,
+    0x56, 0x5E, 0x95, 0xD4, 0x97, 0x7D, 0x07, 0x7E, 0xC3, 0x33, 0x4A, 0xEC, 0x45, 0x7C, 0xF0, 0xC7,
+    0x6D, 0x6D, 0x93, 0x4E, 0xBD, 0xB7, 0x09, 0x42, 0xDE, 0xD4, 0x19, 0x2B, 0x84, 0x02, 0x36, 0x69,
+    0x5C, 0x3C, 0x66, 0x54, 0x59, 0x55, 0xFD, 0x20, 0x4C, 0x4E, 0x96, 0xBD, 0xEE, 0x70, 0x7E, 0xB7,
+    0xDB, 0xF5, 0x22, 0xF2, 0x8E, 0x88, 0xE4, 0x62, 0xA6, 0xE3, 0x1B, 0x7D, 0xB2, 0x5A, 0x55, 0xFD,
+    0xB4, 0x5F, 0x1B, 0x4F, 0xF0, 0xDB, 0x14, 0xD0, 0x1F, 0xCA, 0xF9, 0xBA, 0xAF, 0xF1, 0xF6, 0x91,
+    0x1A, 0xAF, 0x65, 0xA6, 0x97, 0x0C, 0x8F, 0xEF, 0x9A, 0xDD, 0x7F, 0x94, 0xAA, 0xE5, 0x97, 0x32,
+    0xD9, 0x07, 0xAA, 0x62, 0xA2, 0x9E, 0x39, 0x21, 0x78, 0x55, 0xDA, 0x8A, 0x9E, 0x74, 0xC2, 0xE1,
+    0x62, 0x53, 0x59, 0xE9, 0xE7, 0x2E, 0xE3, 0xBC, 0x8D, 0x54, 0x84, 0x2E, 0xA9, 0x8A, 0x1B, 0xFA,
+    0xD2, 0x56, 0x8C, 0xC8, 0x8C, 0x93, 0x95, 0x87, 0x2D, 0x82, 0xC7, 0x77, 0xEC, 0xAE, 0xC9, 0xDA,
+    0xC9, 0xFB, 0x32, 0xF5, 0x6B, 0x5B, 0xD1, 0x53, 0x97, 0x09, 0xE8, 0x49, 0x65, 0xDC, 0x60, 0x07,
+    0x56, 0x2A, 0x6D, 0xED, 0x67, 0xBA, 0xE4, 0xC0, 0xDC, 0xCD, 0xE0, 0x74, 0x84, 0xE5, 0x18, 0xDA,
+    0xD3, 0x19, 0x7A, 0x01, 0x4C, 0xDE, 0x57, 0x57, 0xCE, 0xA6, 0xBD, 0xC7, 0x77, 0x9E, 0x66, 0xF7,
+    0xAC, 0x14, 0x3D, 0x8C, 0xD5, 0xAE, 0x4D, 0x69, 0xC5, 0x8F, 0xDE, 0x45, 0x1D, 0xBB, 0xAC, 0x6A,
+    0x5B, 0x08, 0x7E, 0x8C, 0x0E, 0x95, 0x75, 0xED, 0x67, 0xDC, 0x33, 0x12, 0x2B, 0x2A, 0x5F, 0xAA,
+    0xD6, 0xE3, 0x5E, 0x7D, 0xFB, 0x5E, 0x42, 0x95, 0x5C, 0xEF, 0x80, 0x7D, 0xBD, 0x7F, 0x3B, 0xD2,
+    0x9E, 0xCE, 0x27, 0x19, 0x6C, 0xED, 0x05, 0x1A, 0x19, 0xC2, 0x04, 0x26, 0x75, 0x9B, 0xED, 0x82,
+    0x07, 0x1D, 0x55, 0x7A, 0x38, 0x1A, 0xED, 0xAE, 0x9D, 0xDF, 0x11, 0x44, 0x4B, 0xEC, 0xD7, 0x46,
+    0x06, 0x82, 0x77, 0xA0, 0x93, 0xF3, 0x34, 0x8B, 0xF3, 0xE0, 0xEE, 0x7B, 0xE8, 0x65, 0x00, 0xB6,
+    0x68, 0x8B, 0x80, 0x2B, 0x80, 0x15, 0xC0, 0x3E, 0x3F, 0x83, 0xFD, 0x4E, 0x05, 0x13, 0xDD, 0x80,
+    0x89, 0x7D, 0x26, 0x2C, 0x5A, 0xA2, 0x93, 0xE7, 0x24, 0xF1, 0xF8, 0xAE, 0xD9, 0x5D, 0x91, 0x24,
+    0xD5, 0x95, 0x6E, 0x45, 0x70, 0xBE, 0x4F, 0xFD, 0x8C, 0xF3, 0x15, 0x55, 0x1D, 0x98, 0xB7, 0x26,
+    0x58, 0xCB, 0xDE, 0x36, 0x21, 0x6E, 0x05, 0x97, 0xE0, 0x37, 0x8F, 0x23, 0x6C, 0x5E, 0xD6, 0x32,
+    0xD3, 0xCA, 0x02, 0xEC, 0x76, 0xD7, 0x08, 0x22, 0xD1, 0x8A, 0x24, 0x1D, 0x75, 0x56, 0xB3, 0x2E,
+    0xFC, 0xB4, 0xAF, 0xDB, 0xC4, 0xD2, 0x55, 0x50, 0xCB, 0xFE, 0xBB, 0x42, 0x2B, 0xD0, 0x08, 0x2F,
+    0x35, 0x82, 0x43, 0xBC, 0x19, 0xE4, 0xB5, 0x17, 0x26, 0x27, 0x92, 0xB4, 0xC8, 0x3E, 0x8E, 0x3F,
+    0xF7, 0x13, 0xF4, 0x82, 0xFE, 0xFB, 0x4F, 0x61, 0xC5, 0x23, 0xB8, 0x03, 0x15, 0x2A, 0x4D, 0xA1,
+    0xCD, 0xA8, 0xBC, 0xC7, 0x86, 0xDD, 0xBC, 0x87, 0x96, 0x7B, 0x74, 0x79, 0x0B, 0x57, 0x70, 0x99,
+    0x23, 0xA8, 0xB4, 0x99, 0x6E, 0xC3, 0x8E, 0x1E, 0xB7, 0xBF, 0x59, 0x25, 0xFA, 0x09, 0x33, 0xE0,
+    0xF6, 0x6B, 0xAA, 0x74, 0xB8, 0xE8, 0xA1, 0xF8, 0xCF, 0x3D, 0x2A, 0x2A, 0xED, 0x2F, 0xE9, 0x67,
+    0xF4, 0xA3, 0xA2, 0xFE, 0x19, 0xE5, 0xCE, 0x17, 0x5C, 0xC6, 0x65, 0x70, 0x1E, 0x3D, 0xD3, 0x57,
+    0xD4, 0xFD, 0xA1, 0xF9, 0x38, 0x51, 0x6F, 0x70, 0x59, 0x47, 0xDB, 0x26, 0x1D, 0x8F, 0xBA, 0x49,
+    0xDF, 0x4B, 0x6D, 0xFE, 0x11, 0xFF, 0x5E, 0x44, 0x82, 0xC8, 0x3F, 0xDC, 0xBE, 0xFD, 0xA3, 0x3F,
+    0xED, 0xE2, 0x89, 0xCA, 0x3A, 0x3E, 0x01, 0x34, 0x80, 0xFC, 0x60, 0x30, 0xB2, 0xB0, 0x9A, 0xD4,
+    0x27, 0x3B, 0x38, 0x96, 0xB6, 0xAA, 0xA4, 0x67, 0x1B, 0x9D, 0x17, 0x6A, 0x5F, 0x54, 0xFE, 0xAF,
+    0xEF, 0xEB, 0xD3, 0x77, 0x17, 0x57, 0xDD, 0x1C, 0x86, 0xF5, 0x6C, 0x9E, 0x1F, 0x67, 0xCC, 0xBA,
+    0x41, 0xA0, 0x0A, 0x26, 0xD2, 0x96, 0x73, 0x38, 0x9D, 0xD5, 0xC7, 0x12, 0x2F, 0x9F, 0xD6, 0x6E,
+    0x31, 0x71, 0x7C, 0xB9, 0xEA, 0x64, 0xE2, 0xD2, 0x56, 0x13, 0xDD, 0x77, 0x6A, 0x97, 0xDC, 0xB0,
+    0xAA, 0x25, 0xC4, 0x20, 0xA9, 0xBF, 0x5F, 0xCE, 0x10, 0x98, 0x2D, 0x48, 0x55, 0x0F, 0x8E, 0xF5,
+    0x7C, 0xC1, 0x44, 0xEC, 0x80, 0xF3, 0x38, 0x4F, 0xF0, 0xB8, 0xE1, 0xA7, 0x4E, 0x92, 0x95, 0xA9,
+    0x5F, 0x1F, 0xE2, 0xB5, 0x71, 0xA2, 0x13, 0x0F, 0x0B, 0xA8, 0x04, 0x26, 0x72, 0xE1, 0x04, 0x7D,
+    0x9A, 0x1B, 0x91, 0xA8, 0xDF, 0x13, 0xC6, 0xB6, 0xA8, 0xA4, 0x27, 0x1B, 0x1D, 0x6B, 0x5B, 0x55,
+    0xD6, 0xB3, 0x8E, 0xE3, 0xE0, 0x9E, 0x3B, 0xF9, 0xAA, 0xDC, 0x91, 0x77, 0xE4, 0xDE, 0xDA, 0x15,
+    0x3D, 0x7F, 0x5A, 0x76, 0x5A, 0x74, 0xAC, 0xE6, 0xE5, 0x62, 0xFB, 0xD9, 0x8D, 0x83, 0x2B, 0x04,
+    0x7F, 0xC1, 0xF1, 0x33, 0xF7, 0x61, 0x7E, 0x54, 0xF6, 0x17, 0x3C, 0x28, 0x89, 0xE0, 0xC4, 0xD3,
+    0x96, 0xA7, 0x36, 0x74, 0xCD, 0xC8, 0x3E, 0x78, 0x47, 0x89, 0x68, 0x59, 0xE1, 0x0B, 0xCB, 0xD5,
+    0x7D, 0x18, 0xBB, 0x61, 0x9F, 0xEF, 0x5D, 0x62, 0x2B, 0x5D, 0x9C, 0x1C, 0x2E, 0xD7, 0x13, 0x10,
+    0x0E, 0x63, 0xB7, 0x9E, 0x01, 0xE7, 0x69, 0x5F, 0xAE, 0x60, 0xEE, 0x4F, 0x10, 0x16, 0x60, 0x1C,
+    0x0E, 0xF6, 0x6E, 0x44, 0xE6, 0x76, 0x95, 0xDC, 0x54, 0x1D, 0x59, 0x54, 0xC2, 0x35, 0x15, 0x1D,
+    0x57, 0xDA, 0x07, 0xB2, 0xCD, 0xEA, 0x5D, 0xDE, 0x80, 0x7E, 0xBB, 0x6E, 0x6D, 0x41, 0xAD, 0x32,
+    0xAB, 0xDC, 0x2D, 0x6D, 0xC1, 0x0D, 0x27, 0xE8, 0xC9, 0xFC, 0xE6, 0xC5, 0xB9, 0x15, 0x99, 0xE9,
+    0x57, 0xBF, 0x61, 0xBB, 0x42, 0x23, 0xF3, 0xA6, 0xE6, 0xB2, 0x29, 0x69, 0x07, 0xCF, 0x62, 0x67,
+    0xF5, 0xB1, 0x44, 0xF3, 0x3F, 0x46, 0xC2, 0x7B, 0xB5, 0x5D, 0xFB, 0xA4, 0x93, 0x1B, 0xDC, 0x50,
+    0x9B, 0xDA, 0x6D, 0x51, 0x32, 0x2C, 0x5F, 0x5D, 0x94, 0xFC, 0x22, 0xE9, 0xD5, 0x46, 0x7B, 0xE8,
+    0x9F, 0x3A, 0xF6, 0x49, 0x55, 0xEE, 0x00, 0x0D, 0x61, 0x76, 0x85, 0x05, 0x87, 0x89, 0xFD, 0xAC,
+    0x32, 0x95, 0x80, 0xFD, 0xAE, 0x96, 0x67, 0x25, 0x8E, 0x67, 0x74, 0x1A, 0x77, 0xC0, 0xCC, 0xB4,
+    0x0B, 0xE8, 0xED, 0xE4, 0x39, 0xB0, 0x89, 0x5E, 0x36, 0x65, 0xC6, 0xCD, 0x2E, 0x0B, 0xE8, 0x48,
+    0x53, 0xC1, 0x46, 0x54, 0x01, 0xE7, 0xCF, 0x7E, 0x9E, 0x68, 0x2A, 0x2F, 0x39, 0xAF, 0x25, 0x21,
+    0x95, 0xF6, 0x01, 0x70, 0x91, 0x56, 0x86, 0x46, 0x66, 0x54, 0x86, 0x0A, 0x01, 0xEC, 0xE0, 0xF5,
+    0xDD, 0xAA, 0x3E, 0x91, 0xE1, 0xF4, 0x17, 0x73, 0x18, 0x8A, 0x8D, 0xC7, 0x7A, 0xBA, 0xA3, 0x4E,
+    0x6B, 0x23, 0x89, 0x93, 0x3B, 0xB8, 0xE7, 0xA3, 0xBE, 0xBB, 0x5E, 0x49, 0xEE, 0xB7, 0x65, 0x83,
+    0x4A, 0x5C, 0xEC, 0x57, 0xB3, 0xB2, 0x50, 0x9B, 0xDA, 0x16, 0x55, 0x54, 0xEE, 0x52, 0x9F, 0xF4,
+    0xAC, 0x27, 0x1D, 0x4D, 0xB4, 0x83, 0xFB, 0x0F, 0xAE, 0xBA, 0xE2, 0x26, 0x80, 0x86, 0x0B, 0x8D,
+    0x5C, 0x29, 0x66, 0x76, 0xBF, 0x91, 0xB7, 0x04, 0x77, 0xB2, 0x9E, 0x26, 0x25, 0xBA, 0x04, 0xDC,
+    0x9B, 0xD2, 0xCF, 0x5D, 0xB1, 0xD3, 0xC2, 0xA8, 0xAA, 0x8E, 0x7A, 0x76, 0x4F, 0x57, 0x96, 0x2E,
+    0xD9, 0xC1, 0xC4, 0x51, 0xE5, 0x97, 0xAB, 0x9E, 0x5D, 0xB5, 0xC3, 0xA2, 0xE4, 0x66, 0xD6, 0xD1,
+    0x1D, 0x4C, 0x79, 0xA1, 0x21, 0x4C, 0xA2, 0xE4, 0x07, 0x2B, 0xEB, 0x69, 0x51, 0xD2, 0xCF, 0x3A,
+    0x3B, 0x1F, 0x86, 0xDA, 0xD6, 0x2E, 0xE9, 0xD9, 0x0D, 0xCE, 0x2F, 0x4D, 0xED, 0x3E, 0xBA, 0x92,
+    0xCC, 0x6A, 0xE3, 0x98, 0x17, 0xD6, 0x33, 0x02, 0xA1, 0x17, 0x6F, 0x24, 0x99, 0xF7, 0x56, 0x3D,
+    0xBB, 0x5F, 0xA4, 0xFE, 0xE3, 0xD2, 0xD6, 0x85, 0xD5, 0x79, 0xF7, 0xC2, 0x64, 0xEE, 0x65, 0x3D,
+    0xC9, 0x0B, 0xC9, 0xC8, 0xDC, 0xEC, 0xC7, 0x9E, 0x73, 0xF8, 0x56, 0xFA, 0xD2, 0xC9, 0x8B, 0x15,
+    0x77, 0xB2, 0xE0, 0xE6, 0x15, 0x17, 0x57, 0x82, 0x5F, 0x18, 0xA9, 0x2C, 0x6D, 0xA5, 0xAA, 0xDC,
+    0xD4, 0x3E, 0xB5, 0xEB, 0x8B, 0x93, 0x12, 0xF1, 0xEA, 0xB4, 0xD2, 0xA5, 0xCD, 0x43, 0xFD, 0xBC,
+    0x75, 0xB6, 0x20, 0xF0, 0xCD, 0xDB, 0x5B, 0x49, 0x51, 0xEB, 0x51, 0x23, 0x32, 0xB9, 0x57, 0x6A,
+    0x9F, 0xEC, 0xCB, 0x55, 0x65, 0x1B, 0x9D, 0xCA, 0x7D, 0x72, 0x7E, 0x55, 0xC9, 0xCE, 0xE1, 0xB9,
+    0x45, 0xAD, 0xA7, 0xD1, 0xD5, 0xDA, 0xAC, 0x3A, 0xD2, 0x14, 0xB0, 0x03, 0x2A, 0x43, 0x18, 0x08,
+    0xC2, 0xE7, 0x6E, 0xDF, 0xE2, 0xC2, 0xB9, 0x6E, 0x31, 0xF7, 0xE4, 0x07, 0xA9, 0x7F, 0xB7, 0xB6,
+    0xA7, 0xAF, 0x21, 0x03, 0x2E, 0x62, 0x66, 0xFA, 0x84, 0x2A, 0xB0, 0x6C, 0x4E, 0x8D, 0x5B, 0xDA,
+    0xE0, 0xB1, 0x15, 0x59, 0x54, 0xBE, 0xAE, 0x12, 0x6A, 0xA1, 0x91, 0x81, 0x71, 0xC6, 0xE4, 0x3F,
+    0x52, 0xC5, 0xB6, 0xC5, 0xFD, 0x32, 0x39, 0x99, 0x7A, 0xD9, 0xE6, 0x0E, 0x9A, 0x82, 0x9E, 0x70,
+    0xF4, 0x92, 0x45, 0xDE, 0x0C, 0xFF, 0x79, 0x63, 0x11, 0x6D, 0x64, 0x44, 0x15, 0xF4, 0x44, 0xE8,
+    0x5E, 0x96, 0xB5, 0x93, 0xD4, 0x2F, 0x0F, 0x6B, 0x8E, 0xF9, 0x85, 0x0C, 0x2B, 0x8B, 0xCA, 0x2A,
+    0xE9, 0x68, 0x62, 0xE0, 0x44, 0x15, 0x95, 0xF5, 0xA4, 0xE3, 0x48, 0xE8, 0x6A, 0x5B, 0xC2, 0x47,
+    0xDF, 0x3B, 0x7D, 0x5B, 0x5C, 0x75, 0x29, 0xC4, 0x93, 0xBD, 0x1B, 0xCF, 0xF5, 0xD9, 0xFC, 0x4A,
+    0x54, 0x79, 0x31, 0xAE, 0x2A, 0xDB, 0x61, 0xD1, 0xD1, 0xDE, 0x4C, 0xFD, 0x7B, 0xB9, 0x29, 0x85,
+    0xA3, 0x63, 0xF4, 0x82, 0x5A, 0x61, 0x85, 0xCB, 0x87, 0x1B, 0xF0, 0x63, 0x5B, 0xCC, 0x5B, 0x6B,
+    0x97, 0xDC, 0x77, 0xAA, 0x9E, 0x4E, 0x54, 0x72, 0xCF, 0x64, 0x3D, 0xAD, 0x7D, 0xB4, 0xAF, 0xD4,
+    0xCB, 0x1C, 0xD9, 0x8F, 0x32, 0x45, 0xDE, 0x8E, 0xEA, 0xC3, 0xD7, 0x6F, 0xA0, 0xEB, 0x38, 0xE3,
+    0xFE, 0x46, 0x60, 0xE9, 0x13, 0x6A, 0x36, 0x0F, 0xBB, 0xFB, 0x85, 0x76, 0x69, 0x6B, 0x2F, 0xFD,
+    0x72, 0x3E, 0xBC, 0xF0, 0x5F, 0x70, 0x77, 0xC0, 0xEC, 0xD9, 0xB0, 0x3E, 0x81, 0xCE, 0xE0, 0x2A,
+    0xDC, 0xA9, 0xB8, 0x2C, 0x3F, 0x72, 0xF3, 0x98, 0xDD, 0x70, 0x16, 0x7C, 0xE7, 0xE8, 0xB3, 0x99,
+    0x7A, 0x51, 0x05, 0x1B, 0x57, 0x54, 0xB6, 0x03, 0x8B, 0x9E, 0xB0, 0x37, 0x13, 0xDD, 0x7B, 0x99,
+    0xA6, 0x1C, 0x83, 0xBB, 0x04, 0xFA, 0x3E, 0x28, 0xD9, 0xB8, 0xAE, 0x6D, 0x04, 0x8E, 0xA0, 0x23,
+    0x4F, 0x9A, 0x88, 0x91, 0xB8, 0x31, 0x85, 0x9B, 0x2D, 0x1A, 0x6C, 0xAE, 0x9D, 0x48, 0x3C, 0x91,
+    0xD4, 0x0F, 0x0B, 0x7F, 0xED, 0x3C, 0xFD, 0x44, 0x9B, 0xE1, 0x0E, 0x58, 0x3F, 0xF4, 0xB3, 0x69,
+    0xE5, 0x34, 0x39, 0x11, 0xF5, 0x9E, 0x6C, 0x20, 0xA8, 0x4B, 0xC8, 0xD4, 0x3F, 0xC0, 0xD1, 0x6C,
+    0x4C, 0xAC, 0xE7, 0x18, 0x95, 0xD0, 0xB1, 0x59, 0xD0, 0x13, 0x6E, 0xD8, 0x7A, 0xAD, 0x9A, 0xB1,
+    0x50, 0x51, 0x13, 0x16, 0x8E, 0x69, 0x33, 0x9D, 0x70, 0x18, 0x57, 0xE9, 0xA3, 0x4A, 0x54, 0x2E,
+    0x63, 0x7C, 0x1F, 0x55, 0xA2, 0x70, 0xF4, 0x70, 0xF7, 0x06, 0xF6, 0x91, 0xDD, 0xFD, 0x88, 0x64,
+    0x87, 0x56, 0x86, 0xC7, 0x46, 0x38, 0xA6, 0x4D, 0xE8, 0x81, 0x1B, 0x67, 0x7F, 0x9B, 0x4C, 0x97,
+    0xD0, 0x33, 0x23, 0xDD, 0x41, 0x6C, 0xDA, 0xB8, 0xE1, 0xA6, 0x60, 0xA2, 0x5E, 0xD9, 0xEC, 0xD8,
+    0xDE, 0x6A, 0x3A, 0x79, 0xE6, 0x03, 0x59, 0x4B, 0x0E, 0xF5, 0x8F, 0xDB, 0xBD, 0x32, 0x3F, 0xEF,
+    0xA2, 0x9E, 0xC7, 0x66, 0xD1, 0xB3, 0x99, 0x56, 0xD6, 0x3E, 0xA9, 0x6A, 0xA3, 0xCA, 0x6E, 0xE8,
+    0x92, 0xF3, 0x6A, 0xBA, 0x7C, 0xE6, 0x3F, 0x43, 0x22, 0xA8, 0xCC, 0xD8, 0x25, 0x44, 0xA7, 0xB6,
+    0x9A, 0x68, 0xA6, 0xB5, 0x59, 0xF4, 0x6C, 0xE2, 0x42, 0xE9, 0xE3, 0xA3, 0x2C, 0xD7, 0x57, 0x00,
+    0xEC, 0x00, 0xD8, 0x74, 0x60, 0x70, 0xF8, 0x77, 0x67, 0x3F, 0x7F, 0x56, 0xD4, 0xCE, 0x7E, 0x53,
+    0xC3, 0xA1, 0xB5, 0xC9, 0xB0, 0x0D, 0x60, 0xB4, 0xFE, 0x0F, 0x25, 0xFC, 0x98, 0x6D, 0xD6, 0xA3,
+    0xBF, 0x1F, 0xC1, 0x5D, 0x99, 0xE0, 0xDB, 0xCD, 0xF0, 0x87, 0x11, 0x6E, 0xAE, 0x44, 0x70, 0xCF,
+    0x4F, 0xFB, 0x71, 0xFF, 0xE2, 0xF9, 0xCF, 0xFE, 0xA1, 0xFF, 0x7F, 0x13, 0x60, 0x5F, 0x3F, 0x4C,
+    0x1E, 0x05, 0xB8, 0xBE, 0x35, 0x64, 0xFE, 0xF4, 0xEC, 0x39, 0x9E, 0x64, 0xCB, 0x69, 0xB5, 0xB0,
+    0xA1, 0x31, 0xBE, 0xB1, 0x65, 0xF3, 0x6E, 0x77, 0xAD, 0x11, 0x11, 0x6F, 0x45, 0xA6, 0xB6, 0x36,
+    0x09, 0xE1, 0x3A, 0x6E, 0xF8, 0x0A, 0x66, 0x0F, 0xD9, 0x5A, 0x91, 0x01, 0x91, 0x09, 0xF7, 0xDA,
+    0xD5, 0xC3, 0x49, 0xAF, 0x2A, 0x3F, 0x63, 0xE5, 0x12, 0xE1, 0xB5, 0xD0, 0x88, 0x48, 0x1C, 0xE5,
+    0x0C, 0x7C, 0xD3, 0xEF, 0x65, 0xD9, 0xB4, 0x21, 0xDB, 0xCF, 0xF9, 0xCF, 0x4A, 0x54, 0x93, 0x37,
+    0x46, 0xBE, 0x39, 0x4D, 0xB4, 0xE5, 0x32, 0xFC, 0x4C, 0xF9, 0xCF, 0x48, 0xD4, 0x65, 0x3D, 0x60,
+    0xDF, 0x4A, 0xF4, 0xEF, 0x64, 0xF0, 0x17, 0x0E, 0xC0, 0xF7, 0x6A, 0x27, 0xB2, 0x30, 0x8A, 0xF8,
+    0x3E, 0x75, 0x51, 0xD5, 0x26, 0xB1, 0xF2, 0xD2, 0x19, 0xBC, 0xED, 0x65, 0x45, 0x89, 0x78, 0xD6,
+    0xDD, 0x1E, 0x08, 0xC7, 0x06, 0x9D, 0xDA, 0x49, 0x15, 0x72, 0xB3, 0xEE, 0x6A, 0x27, 0x22, 0xAD,
+    0x88, 0xF8, 0xBD, 0x93, 0x4E, 0xB6, 0x7F, 0x98, 0xA4, 0xBD, 0x7F, 0x7E, 0x47, 0xB6, 0x0C, 0x68,
+    0x07, 0xBA, 0x84, 0xAE, 0xE8, 0xBC, 0x4F, 0xE2, 0x66, 0x77, 0xAD, 0x91, 0x15, 0xBB, 0xD2, 0x56,
+    0x10, 0x70, 0x03, 0x7A, 0xA6, 0xCB, 0x8F, 0x1C, 0x9B, 0x89, 0xFE, 0xEC, 0x38, 0x0C, 0x8D, 0x2C,
+    0x1C, 0x16, 0xE4, 0x0E, 0x8C, 0x91, 0x93, 0xCA, 0x1D, 0xED, 0x2F, 0x35, 0xC3, 0xEF, 0xBF, 0xA2,
+    0xB9, 0x32, 0xE9, 0x0F, 0x8A, 0x4A, 0x95, 0x0B, 0xE7, 0x36, 0x73, 0x5E, 0xED, 0xA4, 0x30, 0x16,
+    0xFA, 0x84, 0xAA, 0xB0, 0x9E, 0xAD, 0x70, 0x76, 0x1C, 0x3C, 0xF6, 0x70, 0xDC, 0xAC, 0x74, 0x92,
+    0xB7, 0x2C, 0x7E, 0xCC, 0x7B, 0x68, 0x97, 0xA7, 0x00, 0x27, 0x11, 0xD4, 0x73, 0xE9, 0xD1, 0xBA,
+    0xFA, 0x07, 0x24, 0xB4, 0x00, 0xFE, 0x35, 0xDB, 0x7F, 0x95, 0x30, 0x67, 0x60, 0xE1, 0x8B, 0xFB,
+    0x9F, 0x1E, 0xFB, 0x09, 0x68, 0x59, 0xE8, 0x44, 0x72, 0x23, 0x4F, 0x4B, 0x0C, 0x51, 0x2D, 0x3A,
+    0x63, 0xDF, 0x13, 0xDA, 0xD5, 0x4E, 0x0F, 0xB9, 0x2E, 0xFB, 0x41, 0x45, 0x2D, 0x2E, 0xE2, 0xEE,
+    0x55, 0xFA, 0xE2, 0xA6, 0x46, 0x5A, 0x21, 0x4C, 0x7A, 0x1D, 0x33, 0x41, 0x96, 0x3D, 0x23, 0xF9,
+    0x70, 0x6B, 0x07, 0x68, 0x2A, 0x20, 0x11, 0xDC, 0xF4, 0x48, 0xF1, 0xFE, 0x0C, 0x85, 0xDE, 0xD9,
+    0xF7, 0xAA, 0xFE, 0x7E, 0xA4, 0xCD, 0x97, 0xE0, 0xD2, 0xA1, 0x68, 0x7F, 0x76, 0x42, 0xCD, 0x95,
+    0x09, 0x55, 0xD6, 0x7D, 0xB5, 0xF6, 0x07, 0xB3, 0x7F, 0x26, 0x54, 0xE2, 0x99, 0x3F, 0x19, 0x81,
+    0x46, 0x0E, 0x7B, 0x07, 0x87, 0x9E, 0xDF, 0xF9, 0xDD, 0xB5, 0x51, 0x94, 0xFC, 0x46, 0x72, 0xBF,
+    0x7A, 0xA1, 0x4B, 0xAA, 0x60, 0x07, 0x33, 0xB1, 0x32, 0xA2, 0xB2, 0xAA, 0xE8, 0xA8, 0x13, 0x01,
+    0x37, 0xB4, 0xA5, 0x59, 0xD0, 0x53, 0x7F, 0x46, 0x61, 0x09, 0x7A, 0x6E, 0x57, 0x46, 0x3A, 0x91,
+    0x82, 0x16, 0x19, 0xE8, 0x65, 0xE6, 0xD3, 0x6E, 0x8D, 0x7B, 0x74, 0xA9, 0xEB, 0xBE, 0x33, 0xB7,
+    0xC3, 0x1F, 0x4A, 0xF6, 0x8D, 0x43, 0xE7, 0x3B, 0xA9, 0xD0, 0xCF, 0xF9, 0xA1, 0x7B, 0x3F, 0x73,
+    0xD9, 0xFA, 0xCA, 0x04, 0xAB, 0x1B, 0x50, 0xB9, 0x42, 0xC3, 0xA1, 0x89, 0x5C, 0x7D, 0x7C, 0x67,
+    0x25, 0xCA, 0x12, 0x96, 0x56, 0x6E, 0x7D, 0x8A, 0x07, 0x1C, 0x6C, 0x64, 0x41, 0x50, 0xE9, 0x53,
+    0xB4, 0x61, 0x6E, 0x1F, 0x6A, 0x12, 0x55, 0x61, 0x1C, 0x6C, 0x6C, 0x64, 0x2B, 0xCC, 0x33, 0xED,
+    0x81, 0x44, 0x82, 0xC7, 0x80, 0x4B, 0x40, 0xDD, 0x5A, 0x7E, 0x93, 0xA1, 0x99, 0xCE, 0xC8, 0x0A,
+    0xF7, 0x77, 0x73, 0x27, 0xE2, 0xDD, 0x2B, 0xB5, 0xAD, 0xFD, 0xAC, 0xA3, 0xF3, 0x23, 0x55, 0x95,
+    0x3E, 0xE9, 0xC9, 0x45, 0xD7, 0xAE, 0x2C, 0x5F, 0x2F, 0x37, 0xD7, 0x4F, 0xE4, 0x79, 0xD1, 0xC5,
+    0xCC, 0x6E, 0xF8, 0x74, 0xF4, 0x1C, 0x6F, 0x20, 0xCB, 0x41, 0x93, 0xA0, 0xDD, 0xB7, 0xAF, 0xDF,
+    0x95, 0xB4, 0xE1, 0x22, 0xA8, 0x0C, 0x2E, 0xD1, 0x7E, 0x32, 0x61, 0xFB, 0x48, 0xFA, 0xFC, 0xEF,
+    0xAF, 0xE9, 0x25, 0x83, 0x2A, 0x0B, 0xFA, 0x5E, 0xE2, 0x5C, 0x73, 0x78, 0x31, 0x00, 0xFD, 0xA0,
+    0x34, 0x22, 0xD3, 0x3F, 0x4B, 0xC8, 0xA4, 0xFF, 0x2B, 0x21, 0xF3, 0xFF, 0x40, 0x06, 0xB5, 0x33,
+    0xAA, 0xC0, 0xCF, 0x69, 0x12, 0xFD, 0xC4, 0xBF, 0xDA, 0x92, 0xEB, 0xD2, 0xF6, 0xA2, 0x47, 0xA4,
+    0x9B, 0x0E, 0x6E, 0xF8, 0x97, 0x91, 0x3C, 0xA0, 0x06, 0xDA, 0xED, 0xE5, 0x90, 0x0A, 0xD7, 0xE1,
+    0x8F, 0x0E, 0xAA, 0xF5, 0x2B, 0x5A, 0xA2, 0xBE, 0x97, 0x75, 0xAC, 0xDD, 0x7C, 0xD4, 0xA6, 0x13,
+    0xD6, 0x15, 0x57, 0x30, 0xD3, 0x39, 0x95, 0x7A, 0x2F, 0xAF, 0x4F, 0x56, 0xA6, 0xF6, 0x30, 0x5B,
+    0x5D, 0x45, 0x65, 0x74, 0xC5, 0xDE, 0xE0, 0xD8, 0x1E, 0x2C, 0xFD, 0x2F, 0x54, 0x46, 0x5F, 0x89,
+    0xFA, 0x83, 0xFC, 0xB0, 0xD9, 0x71, 0x0E, 0xC6, 0x19, 0xA9, 0x54, 0xE7, 0xAB, 0x8E, 0x47, 0xDD,
+    0x6C, 0xFB, 0x59, 0xDF, 0x9F, 0x95, 0x0C, 0xCD, 0x82, 0x77, 0xFC, 0x4C, 0xFF, 0x76, 0x69, 0x65,
+    0xC1, 0x6E, 0x01, 0xDA, 0x0C, 0x6A, 0xEA, 0x52, 0x5B, 0xB8, 0xC3, 0x57, 0x80, 0x0B, 0xA6, 0xB8,
+    0xA2, 0xB2, 0x4A, 0x87, 0x97, 0xA0, 0x4C, 0xB4, 0xDF, 0x75, 0x8B, 0xAB, 0x76, 0x3E, 0x7B, 0x78,
+    0x47, 0x53, 0xD1, 0x91, 0x63, 0x18, 0x36, 0x67, 0x86, 0x59, 0xC9, 0xC0, 0x82, 0x4A, 0x98, 0xC8,
+    0x09, 0x2A, 0xA3, 0x23, 0x81, 0xB6, 0x0C, 0x5A, 0xBC, 0xAB, 0x07, 0x96, 0xEA, 0x3C, 0x2A, 0x23,
+    0xD1, 0xDE, 0xE8, 0xEF, 0xCE, 0xE9, 0xF3, 0x40, 0x83, 0x29, 0x4A, 0x06, 0x95, 0x71, 0x74, 0x89,
+    0x13, 0xF4, 0x44, 0xC5, 0xC4, 0xB6, 0x0C, 0x6E, 0x51, 0x12, 0x0F, 0x52, 0xCD, 0x95, 0xB8, 0xBA,
+    0x67, 0x53, 0xDD, 0xF2, 0xB5, 0xA1, 0x5B, 0x71, 0x7B, 0x90, 0xDE, 0x54, 0xFA, 0x19, 0xE7, 0xA9,
+    0x74, 0x09, 0xFB, 0x5D, 0x24, 0x2B, 0x89, 0x7B, 0x70, 0xD7, 0x7A, 0x4F, 0x78, 0xCB, 0x2B, 0xA9,
+    0x68, 0x3D, 0xC1, 0xB9, 0x7D, 0x82, 0x5C, 0xE8, 0x16, 0x9D, 0xDC, 0x03, 0x99, 0xF5, 0xFD, 0x71,
+    0x70, 0xE9, 0x04, 0x79, 0x36, 0x77, 0x45, 0x47, 0x1B, 0x03, 0xEB, 0x86, 0xDB, 0x4D, 0x0C, 0x17,
+    0x43, 0x23, 0xEF, 0xD7, 0x5E, 0x9E, 0x9F, 0xF6, 0xE1, 0xD7, 0x82, 0xDA, 0xE8, 0x4C, 0xBB, 0xF1,
+    0x12, 0x9F, 0xDF, 0x3F, 0x16, 0x76, 0x21, 0x48, 0x0C, 0xAF, 0x14, 0x37, 0x88, 0x89, 0xF6, 0xED,
+    0xB9, 0xFF, 0x38, 0xAB, 0xB2, 0xB0, 0x04, 0x1F, 0xF4, 0xE4, 0x9E, 0x5D, 0x42, 0x0C, 0x32, 0x74,
+    0xF2, 0x10, 0xF7, 0xF0, 0x24, 0xF4, 0x1B, 0x69, 0xE5, 0xA0, 0x8B, 0xF0, 0xD5, 0x47, 0xDE, 0xF0,
+    0x68, 0x44, 0x08, 0xAF, 0x14, 0x3D, 0xBB, 0x37, 0x6B, 0x5B, 0xDD, 0x60, 0xEF, 0x65, 0x55, 0x9C,
+    0x77, 0x57, 0x72, 0x97, 0x9C, 0x5F, 0xD4, 0x12, 0xA2, 0x91, 0x99, 0x90, 0x1F, 0x66, 0xAE, 0xF3,
+    0xD8, 0x84, 0xBD, 0x81, 0xE9, 0xA2, 0xF6, 0xF3, 0xEF, 0xAC, 0x58, 0xBE, 0x81, 0xFD, 0xDE, 0xD4,
+    0xA6, 0x7A, 0xC8, 0xD6, 0xDF, 0x49, 0xA3, 0xF3, 0xC0, 0x53, 0xDB, 0xE0, 0xA0, 0xCA, 0xF6, 0xAA,
+    0x51, 0x13, 0x0F, 0xB9, 0x6F, 0x73, 0xF7, 0x91, 0x6C, 0x24, 0x15, 0x55, 0xA5, 0x2E, 0x99, 0x68,
+    0x0F, 0xE4, 0x89, 0x8D, 0xE6, 0x4D, 0xE1, 0xC4, 0xD4, 0xFF, 0xB4, 0x7E, 0x2C, 0x6F, 0x8B, 0xAE,
+    0x26, 0xD9, 0xE1, 0xD3, 0x50, 0xB6, 0x6E, 0xB4, 0x92, 0x83, 0x36, 0x6D, 0xF5, 0xF5, 0xF7, 0x22,
+    0x61, 0x2E, 0x6E, 0x3C, 0xB1, 0x4B, 0xA8, 0x4F, 0x22, 0xB6, 0x1F, 0x9A, 0x7D, 0x2E, 0xFE, 0x5E,
+    0x9A, 0x5E, 0xB7, 0xA8, 0x5C, 0xD1, 0xF7, 0xE6, 0x7D, 0xD4, 0x71, 0x0E, 0xFA, 0xA5, 0xA9, 0xA1,
+    0xE8, 0x59, 0x4F, 0xCE, 0x3B, 0x36, 0xBA, 0xF4, 0xB0, 0x7A, 0x9F, 0xBA, 0x14, 0xA2, 0x7D, 0x45,
+    0xBE, 0x28, 0xC7, 0xF2, 0xB1, 0xDC, 0x93, 0xAE, 0xF6, 0xFB, 0xF0, 0xFF, 0xF3, 0xD7, 0x76, 0x3B,
+    0x1A, 0x11, 0x91, 0x59, 0x89, 0x88, 0x14, 0xB5, 0xFA, 0xC0, 0x25, 0xB5, 0x60, 0xA3, 0x6E, 0x17,
+    0xF4, 0xAC, 0x06, 0x41, 0x65, 0x18, 0x7D, 0x53, 0xC1, 0x45, 0x46, 0x99, 0x75, 0xC2, 0x4A, 0x56,
+    0x05, 0xFD, 0xEB, 0x6B, 0xAC, 0x5B, 0x65, 0x8F, 0x4D, 0xE5, 0x82, 0xCE, 0x8C, 0xFC, 0x49, 0x2B,
+    0xB8, 0xA8, 0x07, 0xF7, 0xDB, 0xF1, 0xD7, 0x7F, 0x31, 0x75, 0x22, 0x22, 0x09, 0x2B, 0xF2, 0xB0,
+    0x71, 0x35, 0x9E, 0xAB, 0xD8, 0x62, 0x6A, 0x23, 0x6B, 0x58, 0xBB, 0x12, 0x72, 0xD0, 0xB3, 0x9B,
+    0x8F, 0x4C, 0xB4, 0xB1, 0xBA, 0xC1, 0xDE, 0xCC, 0xCE, 0xBB, 0xD7, 0xA3, 0xF3, 0x6E, 0x21, 0xF8,
+    0x70, 0xEB, 0x9C, 0xF3, 0x32, 0x3C, 0xE5, 0x7E, 0x29, 0xFF, 0x50, 0x8D, 0xBC, 0x2B, 0xA9, 0x13,
+    0xB5, 0x0F, 0xAB, 0xDB, 0xB7, 0x6F, 0x07, 0x91, 0xFB, 0x22, 0xF9, 0xF6, 0xED, 0xDB, 0xB7, 0x6F,
+    0xDF, 0x1E, 0xE5, 0xE1, 0x56, 0xF1, 0xD7, 0xF5, 0xCD, 0x74, 0xD4, 0x4F, 0x6B, 0x3F, 0x41, 0xE3,
+    0xC7, 0x2E, 0x85, 0x7E, 0xAA, 0x56, 0x4D, 0x80, 0xBF, 0x60, 0xD4, 0x54, 0x9C, 0xBE, 0x9B, 0x8E,
+    0xF4, 0xDD, 0x7C, 0xA4, 0xDF, 0xAF, 0xF6, 0xCA, 0xDE, 0x28, 0xDD, 0x5C, 0xBB, 0x54, 0x55, 0xAA,
+    0xDD, 0x54, 0xF4, 0xDD, 0x64, 0x9E, 0x9D, 0x2F, 0xE9, 0xE1, 0xC2, 0x79, 0xFE, 0x2D, 0xE7, 0x39,
+    0x6F, 0xA2, 0x9E, 0xF4, 0xFD, 0xD4, 0x67, 0x75, 0x5A, 0x9A, 0x4A, 0xBD, 0xC0, 0x45, 0xCE, 0xF1,
+    0xBF, 0x00, 0xAD, 0x98, 0xBF, 0xCF, 0x65, 0xC7, 0x59, 0xC7, 0x3F, 0xE7, 0x8C, 0x5F, 0x0E, 0x68,
+    0x14, 0xE6, 0x2D, 0xE2, 0x08, 0xC5, 0x28, 0x43, 0x83, 0x04, 0x02, 0x67, 0x52, 0xA4, 0x48, 0xC1,
+    0xEE, 0xCC, 0x7A, 0x8B, 0x2D, 0x52, 0xD8, 0xC5, 0xDE, 0xDA, 0x14, 0x14, 0x51, 0x12, 0xC9, 0x14,
+    0x2E, 0x28, 0xBC, 0x3B, 0xC7, 0xAC, 0xC0, 0x45, 0x8A, 0x18, 0x24, 0x94, 0xD2, 0x29, 0x82, 0x40,
+    0x01, 0x09, 0x0A, 0x17, 0x49, 0x58, 0xBF, 0x67, 0x76, 0x57, 0xC8, 0x85, 0x8B, 0x9C, 0xB0, 0x7F,
+    0x80, 0x8F, 0x13, 0x2C, 0x0B, 0xB9, 0xD8, 0x31, 0x9E, 0xC8, 0x63, 0xBF, 0x73, 0xCE, 0x43, 0x71,
+    0xEE, 0xFB, 0xEE, 0x12, 0x21, 0x0A, 0xC4, 0x95, 0xAE, 0xE6, 0xEA, 0xEA, 0x9E, 0xE7, 0xC7, 0xF7,
+    0x79, 0x9E, 0xEF, 0xF3, 0x9D, 0x0B, 0x00, 0x57, 0xCD, 0x88, 0x7B, 0x27, 0xA3, 0x1F, 0x16, 0x08,
+    0xA7, 0x00, 0x9C, 0x1C, 0x0E, 0x2F, 0x0C, 0x22, 0x2B, 0x93, 0x48, 0xD0, 0x79, 0x48, 0xAA, 0x75,
+    0x99, 0x8D, 0x97, 0x89, 0x01, 0x5C, 0x02, 0x2D, 0x1B, 0x4A, 0x24, 0xB0, 0x1D, 0xC2, 0xF1, 0xCB,
+    0x0E, 0x93, 0xFB, 0x59, 0x55, 0x4A, 0xB7, 0x1D, 0xDA, 0x20, 0x22, 0xBD, 0x88, 0x04, 0xE0, 0x1B,
+    0x40, 0xDF, 0x80, 0xA1, 0x01, 0x66, 0x05, 0xDC, 0x0A, 0x5C, 0x3D, 0x03, 0x5A, 0x84, 0xAE, 0x44,
+    0x50, 0xD9, 0x83, 0x9E, 0x7D, 0xC0, 0x24, 0x3F, 0xE2, 0x44, 0x12, 0x51, 0x24, 0xB1, 0xE2, 0x52,
+    0x5F, 0xB1, 0xB3, 0xCA, 0xD8, 0xC5, 0xAD, 0xC8, 0x1A, 0xB7, 0x5E, 0x56, 0x0E, 0x87, 0x03, 0x51,
+    0x24, 0x69, 0x91, 0xCC, 0x44, 0xC5, 0x8F, 0x57, 0x30, 0xF3, 0x6F, 0x32, 0x94, 0xA3, 0xC3, 0x49,
+    0x46, 0xBC, 0x34, 0xCC, 0x3C, 0xA5, 0x21, 0xEB, 0xD2, 0xB7, 0x6E, 0x45, 0x88, 0xF8, 0xD1, 0x27,
+    0xBB, 0xC4, 0x39, 0x8A, 0xCC, 0x4E, 0xB6, 0x00, 0x00, 0x5F, 0xFC, 0x49, 0xE8, 0x45, 0xF2, 0x20,
+    0x8F, 0x5A, 0xE7, 0xEE, 0xAD, 0xF8, 0x71, 0xC3, 0x87, 0x95, 0x18, 0x1A, 0x93, 0x2A, 0x4C, 0x32,
+    0x23, 0x52, 0x58, 0x9F, 0x69, 0x5D, 0xEB, 0xD7, 0xBE, 0x75, 0xAB, 0x6A, 0x7D, 0x53, 0x55, 0xB5,
+    0xA1, 0xDA, 0x1C, 0x45, 0xD2, 0x24, 0x9F, 0xEE, 0xB6, 0x7E, 0x25, 0xB8, 0x86, 0x4F, 0x57, 0x31,
+    0x8B, 0x09, 0x43, 0x51, 0xE3, 0x1E, 0x1C, 0xE0, 0x13, 0x98, 0x85, 0xC7, 0x11, 0x0B, 0xE0, 0x47,
+    0xB0, 0x0B, 0x44, 0x49, 0x38, 0x59, 0x80, 0xEE, 0x70, 0x38, 0x04, 0xBC, 0x48, 0xA3, 0x17, 0xD9,
+    0x02, 0x6A, 0xF1, 0x23, 0xDC, 0x52, 0x05, 0x74, 0x8A, 0x01, 0x9A, 0xCE, 0x60, 0x83, 0x40, 0x9F,
+    0xCD, 0x02, 0x57, 0x59, 0x41, 0xCF, 0x36, 0x41, 0xEB, 0x1B, 0xB8, 0xE0, 0x13, 0x2A, 0xAB, 0x0A,
+    0x0D, 0x1F, 0x88, 0x49, 0x17, 0xBC, 0x88, 0x14, 0x25, 0x22, 0x12, 0x22, 0xA8, 0x3C, 0xCC, 0x70,
+    0x95, 0x57, 0x60, 0x98, 0x87, 0x04, 0xAF, 0xF0, 0x32, 0x0C, 0x47, 0x6C, 0x2E, 0x12, 0x9A, 0xB5,
+    0x48, 0x61, 0xE2, 0x15, 0x7C, 0xB2, 0x98, 0x65, 0x08, 0x4F, 0xA0, 0xBD, 0xE0, 0xA5, 0x60, 0xDE,
+    0xBF, 0x79, 0x91, 0xD0, 0x29, 0xC2, 0xB3, 0xF8, 0xD1, 0x04, 0xFB, 0xFE, 0x8B, 0x29, 0x8A, 0x64,
+    0x27, 0x52, 0xE0, 0xF7, 0x79, 0xFA, 0x66, 0xF7, 0x03, 0x64, 0x94, 0xA6, 0x1B, 0x92, 0xE2, 0xE2,
+    0x1A, 0x7F, 0xB7, 0xD8, 0x31, 0x7E, 0x83, 0x3E, 0xBB, 0xB1, 0x02, 0xC5, 0x5F, 0xCF, 0x40, 0xF5,
+    0x43, 0x02, 0xEE, 0x46, 0x13, 0x80, 0x49, 0x04, 0xE8, 0x44, 0x04, 0x18, 0xCA, 0xEA, 0x03, 0x98,
+    0xA5, 0xB9, 0x04, 0xFE, 0x5E, 0x33, 0x09, 0xE4, 0xB9, 0x6A, 0x16, 0xD4, 0xA6, 0xCA, 0x50, 0x30,
+    0x55, 0x15, 0xD5, 0x88, 0xD9, 0x6D, 0xBD, 0x10, 0x47, 0xBF, 0x31, 0x5D, 0x24, 0xC4, 0xAF, 0xFD,
+    0x18, 0x25, 0x82, 0x15, 0xE1, 0xAE, 0x6A, 0xFD, 0xA2, 0xF3, 0x80, 0x4B, 0xB0, 0x82, 0x59, 0x70,
+    0x1B, 0xC8, 0x06, 0xCF, 0xAC, 0xA0, 0x2B, 0xD8, 0xE5, 0x6B, 0xC4, 0x3B, 0x59, 0x35, 0xF3, 0xCB,
+    0x38, 0x3B, 0x59, 0xB1, 0x32, 0x1E, 0x91, 0xB9, 0xD9, 0x1D, 0x5E, 0x18, 0xA4, 0x78, 0x49, 0x5A,
+    0xC2, 0x54, 0xD1, 0x99, 0x18, 0xF0, 0x49, 0x35, 0xD8, 0xF0, 0x99, 0xA1, 0x0C, 0x92, 0x70, 0x29,
+    0x6E, 0x30, 0xE9, 0x0F, 0x0B, 0xAA, 0x9D, 0xB9, 0x84, 0x79, 0x34, 0x0B, 0xC4, 0x55, 0x55, 0x7A,
+    0x49, 0x76, 0xC6, 0x34, 0xA6, 0x80, 0x4F, 0x7D, 0xA3, 0xDB, 0x30, 0x99, 0x28, 0xD7, 0xA5, 0xF6,
+    0xD2, 0xAC, 0xCC, 0x00, 0x04, 0xE0, 0x4F, 0x54, 0x00, 0xB5, 0x3C, 0x0B, 0x98, 0x0F, 0x17, 0xC0,
+    0x6D, 0x00, 0x27, 0x97, 0x79, 0x3D, 0x7D, 0xE0, 0x70, 0xB3, 0x93, 0xD5, 0x48, 0xEE, 0x65, 0x76,
+    0x1B, 0x7D, 0xC3, 0xCE, 0x98, 0x8C, 0x80, 0x1F, 0x4D, 0xA3, 0x5B, 0x3B, 0xC9, 0xE8, 0x6C, 0x65,
+    0xC4, 0xDD, 0xFF, 0x6C, 0x05, 0x71, 0xDF, 0xC9, 0xA8, 0xF3, 0xE2, 0x13, 0x56, 0xC2, 0x06, 0x53,
+    0x1E, 0x0A, 0x4A, 0x70, 0x33, 0x26, 0x33, 0x41, 0x1C, 0x55, 0xC3, 0xCA, 0x2C, 0x1B, 0x93, 0x0C,
+    0x52, 0xE0, 0x70, 0x93, 0xBF, 0xEF, 0x64, 0x1D, 0x36, 0xA6, 0x62, 0x56, 0x5C, 0xF2, 0xDF, 0xC6,
+    0xA7, 0x06, 0xFE, 0xD5, 0x02, 0xF1, 0xFA, 0x02, 0x93, 0x49, 0x30, 0x09, 0x20, 0x12, 0x60, 0x75,
+    0x23, 0xDD, 0x6A, 0x13, 0x7D, 0x33, 0x0B, 0xAA, 0xE9, 0x8C, 0xAA, 0xAA, 0x32, 0xD4, 0x7E, 0x25,
+    0x0A, 0x12, 0x26, 0x21, 0x1E, 0x61, 0xFD, 0x95, 0xA6, 0xE7, 0xA2, 0xE9, 0x87, 0x02, 0x3A, 0x4D,
+    0x40, 0x33, 0x19, 0x4C, 0xD8, 0xA0, 0xCB, 0x76, 0x06, 0xDF, 0x37, 0x18, 0x66, 0x97, 0xE0, 0xAE,
+    0x6A, 0x60, 0x46, 0x3F, 0xA2, 0xF2, 0x50, 0xF8, 0xFC, 0x5B, 0x4C, 0x28, 0x49, 0x26, 0xE3, 0xB3,
+    0x91, 0x45, 0xD5, 0x5E, 0xB6, 0x0B, 0xBC, 0x4E, 0x0E, 0x9C, 0x1C, 0xD0, 0x92, 0x94, 0xA4, 0x4E,
+    0x72, 0x2F, 0x23, 0xB6, 0x21, 0x09, 0x2D, 0x48, 0x46, 0x3D, 0x9A, 0x6F, 0x37, 0xF8, 0xA4, 0x5C,
+    0x8D, 0x70, 0xF7, 0xCC, 0xBA, 0x11, 0xEF, 0xBE, 0xFB, 0x9D, 0x05, 0xF3, 0xDA, 0x27, 0xF7, 0x2B,
+    0x43, 0x92, 0x79, 0x43, 0x65, 0x9F, 0xFD, 0x48, 0x35, 0xC5, 0xCC, 0xDC, 0xEA, 0x9B, 0x2A, 0x38,
+    0x6E, 0xB1, 0x62, 0xD2, 0x97, 0x88, 0xC1, 0xAD, 0x74, 0xD2, 0xAC, 0x04, 0x44, 0xE0, 0x70, 0xF3,
+    0xE4, 0xF0, 0xC2, 0x11, 0xCA, 0xA2, 0x65, 0xDC, 0xEB, 0xE3, 0x53, 0xDF, 0x50, 0x15, 0x9F, 0x88,
+    0x41, 0x55, 0x74, 0x21, 0x06, 0x26, 0x91, 0x82, 0x11, 0x11, 0xD8, 0x0E, 0x2F, 0x66, 0xEC, 0xCC,
+    0x45, 0x41, 0xF7, 0x07, 0x1A, 0x3E, 0xED, 0xC5, 0x89, 0x72, 0x5D, 0x8A, 0x96, 0x1C, 0x25, 0xC0,
+    0x37, 0x5F, 0x07, 0x91, 0x99, 0x28, 0x12, 0x6C, 0xB1, 0x6D, 0x68, 0xF8, 0x59, 0x42, 0xBF, 0xD9,
+    0x8C, 0xFB, 0xF9, 0x4A, 0xBF, 0xF9, 0x84, 0xFB, 0x45, 0xDB, 0x3F, 0xF8, 0x87, 0x0D, 0xD5, 0x7C,
+    0x62, 0xBA, 0xB3, 0x62, 0xB3, 0xCB, 0xC3, 0x8A, 0x7C, 0x28, 0x61, 0x10, 0x99, 0xD1, 0xC7, 0xE6,
+    0x83, 0xC3, 0xE1, 0x70, 0x08, 0x56, 0x44, 0x1A, 0x93, 0xC8, 0x16, 0xFA, 0x46, 0x1C, 0xF1, 0x69,
+    0x28, 0xA8, 0xCA, 0x04, 0x31, 0xE8, 0x8C, 0xCE, 0x08, 0x4C, 0x98, 0x05, 0x93, 0xBB, 0x15, 0x36,
+    0x5C, 0xC2, 0xCE, 0xAA, 0xD1, 0x37, 0x7C, 0xC2, 0x27, 0x55, 0x51, 0x8D, 0x18, 0x88, 0xA3, 0x2E,
+    0x44, 0xF9, 0xBA, 0x64, 0x2D, 0x59, 0x36, 0xF8, 0xE2, 0x4F, 0x02, 0x93, 0x6C, 0x44, 0x91, 0xF9,
+    0xA9, 0x49, 0x37, 0x7C, 0x12, 0xCC, 0xE2, 0xD2, 0x50, 0x4C, 0xEE, 0x9B, 0xAA, 0x4C, 0xAA, 0xE1,
+    0x1F, 0x35, 0x8C, 0x54, 0x86, 0xED, 0xF5, 0xFF, 0x8D, 0x37, 0xF9, 0xD6, 0xF7, 0xE9, 0x45, 0x92,
+    0x12, 0xC9, 0x6A, 0xA3, 0xA9, 0x95, 0xAB, 0xFD, 0x8A, 0x41, 0x80, 0x18, 0x8E, 0xFC, 0x9B, 0x41,
+    0x5D, 0xDA, 0x48, 0x60, 0x2A, 0x9F, 0xEB, 0x65, 0xB4, 0xA3, 0x17, 0x49, 0x83, 0xC8, 0x8C, 0x3B,
+    0x8E, 0xFA, 0xC9, 0xE1, 0x70, 0xD0, 0x22, 0xF2, 0x50, 0x44, 0x4A, 0xB5, 0xF3, 0xDD, 0x5B, 0x3A,
+    0x3B, 0xA3, 0x9A, 0xB9, 0x16, 0xB6, 0xEE, 0xB8, 0x08, 0x67, 0xD0, 0x17, 0x16, 0xB7, 0xA3, 0x1B,
+    0xF7, 0x84, 0x1B, 0x23, 0x0B, 0x5A, 0x0A, 0x3C, 0x7D, 0xE8, 0x0E, 0xD7, 0x25, 0xFB, 0xD5, 0xAD,
+    0x9D, 0x8C, 0x53, 0x30, 0x49, 0x95, 0xBE, 0xE0, 0x47, 0x4F, 0xDF, 0x4C, 0xC2, 0xDE, 0x2B, 0xB0,
+    0x7A, 0xD0, 0x1F, 0x26, 0x88, 0x05, 0xD4, 0x45, 0x84, 0x7D, 0x81, 0xDF, 0xB9, 0x0D, 0x46, 0x12,
+    0xC8, 0x02, 0xBA, 0x5C, 0x34, 0x33, 0xBD, 0x34, 0xF6, 0x92, 0xA9, 0x0A, 0xBC, 0xF4, 0x3E, 0x4C,
+    0x22, 0xC1, 0x9C, 0x6F, 0x12, 0xC4, 0x2C, 0xA2, 0xB3, 0x7F, 0xAE, 0xF9, 0xD0, 0x86, 0x8F, 0xD6,
+    0x21, 0xBB, 0xB7, 0x8B, 0x4B, 0x9B, 0x59, 0x36, 0x9D, 0xDD, 0x07, 0xBF, 0x94, 0xE0, 0x45, 0x32,
+    0xCF, 0xC8, 0xBF, 0x43, 0x5F, 0x01, 0x57, 0x41, 0x49, 0x81, 0x93, 0x43, 0x60, 0xEF, 0x5B, 0xA2,
+    0x18, 0x49, 0x7A, 0xEB, 0x64, 0x24, 0x06, 0x0F, 0x26, 0xFB, 0x40, 0xB7, 0xFA, 0x00, 0xFE, 0x51,
+    0x00, 0x2D, 0x23, 0x20, 0xE3, 0x31, 0x54, 0x7C, 0x05, 0x9C, 0x00, 0xEE, 0xF9, 0x05, 0xDC, 0x9F,
+    0x37, 0xB0, 0xC9, 0x8F, 0xD8, 0xA4, 0x0B, 0x71, 0x35, 0x92, 0xBC, 0x7C, 0x5D, 0xF2, 0x6E, 0x3E,
+    0x58, 0x79, 0x28, 0x8D, 0xA9, 0xEC, 0xB4, 0x15, 0x03, 0x3E, 0xE9, 0x8C, 0xAA, 0x08, 0xC4, 0x60,
+    0x32, 0x3A, 0xB3, 0xC1, 0xB4, 0x33, 0x5A, 0xBF, 0x33, 0x6C, 0xC2, 0xCE, 0xAA, 0x3E, 0x7E, 0xE0,
+    0xB2, 0x1D, 0xFF, 0xE6, 0xC5, 0x4C, 0x14, 0x91, 0xAC, 0x65, 0x5F, 0x19, 0x0C, 0x0B, 0xC0, 0x2D,
+    0x00, 0x9D, 0x00, 0x7E, 0x04, 0xA0, 0x2F, 0xA9, 0xF3, 0xE4, 0x70, 0x5D, 0x8A, 0x6C, 0x6E, 0xD5,
+    0x32, 0x4E, 0xB8, 0x64, 0xB2, 0x6A, 0x6C, 0xF8, 0xD1, 0x2C, 0x43, 0x65, 0x23, 0x06, 0x53, 0x74,
+    0x46, 0x44, 0x50, 0x22, 0x0B, 0x27, 0x7F, 0xBB, 0xB2, 0x17, 0x58, 0xB5, 0x63, 0xCA, 0x43, 0x85,
+    0x41, 0x0A, 0xC7, 0x59, 0x7F, 0xFA, 0xE6, 0xE1, 0x66, 0x27, 0x4D, 0xAA, 0x34, 0xA6, 0x65, 0x5A,
+    0xA6, 0x05, 0x97, 0xFC, 0xE8, 0x47, 0xFC, 0xE8, 0xC7, 0x18, 0xF0, 0x21, 0x86, 0x09, 0x62, 0x98,
+    0xF6, 0xB9, 0x99, 0xF6, 0x04, 0x37, 0x56, 0xD8, 0x58, 0xBB, 0x06, 0x6B, 0xD7, 0xFA, 0x46, 0xD7,
+    0xFA, 0xA6, 0x1A, 0x7D, 0x53, 0x4D, 0x55, 0x54, 0x53, 0x55, 0x15, 0x54, 0x55, 0x65, 0xC8, 0x0C,
+    0x55, 0x17, 0xBD, 0x27, 0x2B, 0x1B, 0xD3, 0x7E, 0x3C, 0xE1, 0xFD, 0xD3, 0xFF, 0xC9, 0x7B, 0xF8,
+    0xEF, 0xDE, 0xA7, 0xFF, 0x17, 0xEF, 0xB2, 0x7B, 0x97, 0x1D, 0xD1, 0xB8, 0x1F, 0xB7, 0xF6, 0xE3,
+    0xEE, 0x7E, 0xFC, 0x68, 0x3F, 0xDE, 0x7C, 0xCC, 0xC0, 0x07, 0xB4, 0xC8, 0xA2, 0x44, 0x16, 0xAA,
+    0x4B, 0xDC, 0x32, 0x0B, 0x46, 0x15, 0xBA, 0x6B, 0xEB, 0x51, 0x29, 0x39, 0x99, 0x31, 0x22, 0xA8,
+    0xE2, 0x96, 0xAE, 0xA9, 0xC6, 0xC4, 0x84, 0x4F, 0x2E, 0x99, 0xC5, 0x2C, 0x43, 0xB5, 0xD9, 0xEE,
+    0x55, 0x7E, 0xFD, 0x62, 0x27, 0x73, 0x72, 0x08, 0x56, 0x96, 0x5E, 0x56, 0xA6, 0xC2, 0x33, 0x12,
+    0xFA, 0x06, 0x3E, 0xE1, 0x47, 0x54, 0x45, 0x15, 0x88, 0x23, 0x31, 0x30, 0x14, 0x74, 0x86, 0x09,
+    0xA6, 0x2D, 0x98, 0x8C, 0x91, 0x8D, 0x0D, 0x56, 0x53, 0xEC, 0x8C, 0x4D, 0xFE, 0xFE, 0x9E, 0xB2,
+    0x4B, 0xF8, 0xE4, 0xEF, 0x34, 0x54, 0x1D, 0x8A, 0x1F, 0x89, 0x7F, 0x29, 0x43, 0x25, 0x8A, 0xDC,
+    0xD9, 0xDD, 0x4E, 0x72, 0x39, 0x81, 0x87, 0x9B, 0x74, 0xB2, 0xC1, 0x54, 0xF7, 0xC6, 0xF0, 0x23,
+    0xF8, 0xB0, 0x33, 0xC1, 0x74, 0x54, 0xA5, 0x22, 0x99, 0x55, 0x3F, 0x21, 0x23, 0xBB, 0x0B, 0x19,
+    0x59, 0xA2, 0xC8, 0x7C, 0x29, 0x23, 0xBF, 0xF0, 0x63, 0xF0, 0x52, 0xB1, 0xE7, 0x32, 0xEA, 0x64,
+    0x73, 0xBF, 0xF4, 0x1B, 0x7F, 0xFA, 0x24, 0x6F, 0x99, 0xBD, 0x13, 0x13, 0x3F, 0xFC, 0xA7, 0xBC,
+    0x13, 0x81, 0x6A, 0x2A, 0xF5, 0x9B, 0x2A, 0x9D, 0x20, 0xDF, 0x13, 0x9C, 0x08, 0xDD, 0x85, 0x3D,
+    0x0E, 0x37, 0xF9, 0xD6, 0xF7, 0x19, 0x24, 0x5B, 0xA9, 0x68, 0x79, 0x4E, 0xA4, 0xA2, 0xB3, 0x2B,
+    0xB6, 0xE0, 0xEF, 0x09, 0x6E, 0x61, 0x33, 0x19, 0x9F, 0x54, 0x89, 0x23, 0x82, 0xBD, 0xBF, 0xA2,
+    0x1A, 0x93, 0x64, 0x4C, 0x56, 0x22, 0x09, 0x9F, 0xCC, 0xFB, 0x42, 0xB7, 0x11, 0xAF, 0x37, 0x74,
+    0xE9, 0x9B, 0xC9, 0xF8, 0xA4, 0xB3, 0x9F, 0xFB, 0x0D, 0x3F, 0x4E, 0xC9, 0xE6, 0x6E, 0x43, 0x3E,
+    0x14, 0xA2, 0x74, 0x22, 0x4B, 0x2F, 0x8D, 0xE9, 0x53, 0x1E, 0xBF, 0xBA, 0xC3, 0x4D, 0x3A, 0x91,
+    0x15, 0x2D, 0x52, 0xB0, 0xCB, 0x8E, 0xEC, 0xDE, 0x8F, 0xEC, 0x03, 0x91, 0x26, 0x70, 0x9F, 0xCA,
+    0x7E, 0xCF, 0x40, 0xC9, 0x0A, 0xC3, 0x7B, 0x0D, 0xCC, 0xFD, 0x06, 0xEE, 0x7A, 0x83, 0x49, 0x55,
+    0x7C, 0x1B, 0x2A, 0x3E, 0x7B, 0xC1, 0x8F, 0x97, 0xF0, 0x77, 0x80, 0xBC, 0x31, 0x5A, 0x59, 0xD9,
+    0x6C, 0xD6, 0xD9, 0x8D, 0x9E, 0xB5, 0x6F, 0x2A, 0x9B, 0xC5, 0x25, 0x1F, 0x84, 0xA6, 0xAB, 0x2A,
+    0xFF, 0xF2, 0x73, 0x73, 0xFE, 0xEE, 0xEA, 0x9B, 0x5F, 0xE2, 0xB8, 0x3D, 0x11, 0x1B, 0x7F, 0x0C,
+    0x31, 0x11, 0x37, 0x8C, 0x2C, 0xC8, 0xEB, 0x98, 0x19, 0xDE, 0x02, 0xB5, 0xBC, 0x80, 0x7B, 0xA9,
+    0x22, 0x52, 0x86, 0xD5, 0x2E, 0x6E, 0x76, 0x49, 0x98, 0x54, 0xE9, 0xAB, 0x99, 0xCD, 0xEC, 0x43,
+    0x64, 0x55, 0x55, 0xAD, 0x31, 0x0D, 0xD2, 0x18, 0x2E, 0x84, 0x21, 0x01, 0x2D, 0xC1, 0x48, 0x36,
+    0xA9, 0x99, 0xE4, 0x87, 0xD9, 0x5D, 0xFF, 0x4C, 0x82, 0x48, 0xF5, 0x61, 0xB2, 0xC9, 0x3E, 0xC8,
+    0x3B, 0xF1, 0x4A, 0xEE, 0x8F, 0x1B, 0xF6, 0x04, 0x2D, 0xA3, 0xC8, 0x6B, 0xF3, 0xD9, 0xAF, 0xF7,
+    0x15, 0x37, 0x0F, 0x1B, 0x32, 0xDB, 0xC2, 0xC6, 0x90, 0xB5, 0xFB, 0x59, 0xF3, 0x32, 0xC7, 0xBA,
+    0x6B, 0xD7, 0x17, 0x76, 0xC1, 0x22, 0x7C, 0x55, 0x17, 0xF0, 0x89, 0xBE, 0x81, 0x4D, 0xDD, 0xD6,
+    0x10, 0x49, 0xFE, 0x7B, 0xCD, 0x2C, 0xF6, 0x5E, 0xEB, 0x9B, 0x1F, 0xDD, 0x9D, 0xA2, 0x8A, 0x27,
+    0x0E, 0x59, 0x2F, 0xFE, 0x5A, 0x53, 0x6B, 0x0C, 0x56, 0x66, 0xE2, 0x72, 0x19, 0xA4, 0xAB, 0x48,
+    0x53, 0x79, 0x35, 0xA9, 0xD9, 0x57, 0xAB, 0xD3, 0x8B, 0x9F, 0x46, 0x5F, 0x89, 0xE1, 0xD4, 0xF3,
+    0xA6, 0xFF, 0xB0, 0x38, 0x99, 0xF5, 0x8E, 0xD2, 0xE7, 0x39, 0xED, 0xC2, 0xD0, 0x86, 0x14, 0xD3,
+    0xD4, 0xFC, 0x20, 0xD7, 0x1F, 0xE5, 0xEA, 0xBF, 0xFD, 0x39, 0xF3, 0xCE, 0xC3, 0x05, 0x5C, 0x74,
+    0xC0, 0xB4, 0x56, 0x50, 0x22, 0x33, 0x98, 0x77, 0x05, 0x78, 0x65, 0xBA, 0x0B, 0xEA, 0xE1, 0x7F,
+    0xD6, 0x3F, 0xFC, 0xD2, 0x99, 0x79, 0x4D, 0xB2, 0xE4, 0x2B, 0x46, 0xFA, 0xAD, 0xCB, 0x6E, 0xE1,
+    0x71, 0xD1, 0xA6, 0xAA, 0x64, 0x1D, 0xE6, 0xB3, 0x9E, 0xDB, 0xD0, 0xF8, 0x83, 0x4C, 0xCC, 0x7C,
+    0xA1, 0x41, 0xFB, 0x6D, 0x9A, 0x57, 0xD5, 0x4B, 0x36, 0x12, 0x8E, 0x1A, 0x78, 0x9A, 0xED, 0xDB,
+    0x32, 0x6E, 0xAC, 0xAA, 0xA8, 0x6C, 0x92, 0x4D, 0x91, 0x33, 0x55, 0x55, 0x31, 0xB3, 0x49, 0x13,
+    0x71, 0x68, 0x7D, 0x8D, 0x1F, 0x7D, 0xF7, 0xFC, 0xA7, 0xE2, 0x9B, 0xCF, 0x31, 0x9D, 0x5D, 0xF8,
+    0x19, 0x79, 0x79, 0x40, 0x2D, 0x7F, 0x84, 0x91, 0x19, 0xD3, 0x00, 0x78, 0x0A, 0xF4, 0xDA, 0xB5,
+    0x58, 0xCD, 0x62, 0x66, 0x1F, 0x3C, 0xAD, 0x6B, 0x43, 0xD6, 0x8B, 0x1F, 0x7D, 0x58, 0x69, 0x3A,
+    0x0F, 0x39, 0x26, 0xF7, 0x9A, 0xFC, 0x96, 0xDC, 0x95, 0x8F, 0xE5, 0x81, 0x0C, 0x4D, 0xEF, 0x71,
+    0x9F, 0x72, 0x4D, 0xC6, 0xCD, 0x57, 0xBF, 0xF8, 0xE7, 0xFF, 0x43, 0x7D, 0x9C, 0xF1, 0xAF, 0x30,
+    0x3C, 0x0A, 0x4C, 0x15, 0x23, 0x89, 0xF5, 0x2D, 0xEC, 0x83, 0xFC, 0x57, 0xCD, 0xAF, 0xEE, 0x9E,
+    0x3C, 0x28, 0xC7, 0x87, 0xE8, 0x5E, 0x00, 0xBF, 0x81, 0x34, 0xD4, 0x47, 0x8D, 0xE1, 0x7E, 0xC5,
+    0xDC, 0xC9, 0x98, 0xEB, 0x19, 0xA7, 0x17, 0xAE, 0x9A, 0x99, 0x5B, 0x26, 0x9D, 0x36, 0xFB, 0xAF,
+    0xBE, 0xD8, 0xCD, 0x2F, 0x6E, 0xF5, 0xA3, 0x5D, 0x2E, 0x50, 0x0A, 0xB8, 0xD6, 0x49, 0xB0, 0x12,
+    0x24, 0x31, 0x2D, 0xD3, 0xC2, 0x97, 0xDB, 0x95, 0x82, 0x79, 0xE9, 0xD9, 0xBB, 0xA8, 0x77, 0xDE,
+    0x75, 0x74, 0x1F, 0xC9, 0xF3, 0x89, 0xBB, 0xF1, 0xC1, 0xC2, 0x55, 0xFB, 0x5E, 0xC5, 0x0C, 0xF9,
+    0xD6, 0x57, 0xE4, 0x5E, 0x75, 0xCD, 0xCF, 0x57, 0xF4, 0x6A, 0xE6, 0xDF, 0xE8, 0xD6, 0x23, 0x18,
+    0xA7, 0x10, 0x17, 0xF3, 0x40, 0x52, 0x64, 0xEB, 0x9B, 0x2A, 0x66, 0x31, 0xC9, 0x87, 0x28, 0xAD,
+    0x17, 0xC9, 0xE6, 0xFD, 0x38, 0xFA, 0xB0, 0x76, 0x4D, 0xE5, 0x1B, 0xD9, 0x8A, 0x1B, 0x63, 0x59,
+    0xD9, 0xF1, 0xA7, 0x0B, 0x68, 0x09, 0x56, 0xB2, 0x7D, 0x6F, 0x33, 0x8B, 0x7F, 0x3B, 0xEB, 0x8F,
+    0x6B, 0xDF, 0x56, 0x36, 0x1F, 0xFC, 0x8B, 0xB3, 0x7D, 0x50, 0xCC, 0x2C, 0x2F, 0x66, 0x2B, 0x4B,
+    0x77, 0x6C, 0xEB, 0xD3, 0x8E, 0x38, 0x8B, 0x92, 0x37, 0x36, 0xB6, 0xF3, 0xAA, 0x44, 0x2F, 0xA6,
+    0xF8, 0x10, 0xC7, 0xD6, 0xB7, 0x21, 0x9B, 0x1D, 0xE9, 0xAE, 0x0D, 0x1F, 0xDD, 0xC8, 0x76, 0x73,
+    0x69, 0x2A, 0x2B, 0xC7, 0x99, 0x7C, 0x8A, 0xD0, 0x8B, 0xAE, 0x83, 0xBC, 0xD4, 0xF0, 0x67, 0x2B,
+    0x7E, 0xD9, 0xF0, 0x69, 0x23, 0x86, 0x95, 0x89, 0xC6, 0xDA, 0x37, 0x9A, 0x2A, 0x5D, 0xD3, 0xB9,
+    0xDF, 0x5E, 0x9A, 0x95, 0x48, 0x50, 0xE7, 0x8D, 0x21, 0xC3, 0x90, 0x41, 0x2F, 0x60, 0x0B, 0x44,
+    0x81, 0x6F, 0xFE, 0xF0, 0xC9, 0x5E, 0xFF, 0xF4, 0xAE, 0x59, 0x4E, 0x6D, 0xC2, 0x8D, 0xF8, 0x80,
+    0x0F, 0xC4, 0x80, 0x1F, 0xFF, 0xD9, 0x4B, 0x7E, 0xDC, 0xEB, 0x74, 0x9C, 0x76, 0x72, 0xA3, 0xDA,
+    0xC5, 0xFF, 0x52, 0xDE, 0x11, 0xFC, 0xD9, 0x76, 0x9E, 0x95, 0x98, 0x1A, 0xF1, 0xF7, 0x44, 0x2F,
+    0x43, 0x75, 0xF3, 0xCA, 0xA4, 0x9A, 0x49, 0x66, 0xF1, 0xD7, 0x1A, 0xEB, 0x90, 0xDD, 0x68, 0xD3,
+    0xA4, 0xCA, 0xAB, 0xCD, 0x2C, 0xBE, 0xB9, 0x71, 0x55, 0x72, 0xA7, 0x98, 0xE4, 0xE7, 0x4B, 0x7E,
+    0x79, 0x0A, 0x5D, 0xEC, 0xAC, 0x45, 0x55, 0x5C, 0xDA, 0x50, 0xC5, 0x8D, 0xAC, 0x66, 0xC6, 0xDD,
+    0xC9, 0x0C, 0xEF, 0x15, 0xBA, 0x7A, 0x17, 0xFC, 0x15, 0x30, 0x8F, 0x8E, 0x7A, 0x4F, 0xC2, 0x51,
+    0xD9, 0x26, 0x30, 0x89, 0xAF, 0xD9, 0x84, 0x95, 0xB4, 0x93, 0xCC, 0xD9, 0x85, 0xD1, 0x5D, 0xAA,
+    0x69, 0x49, 0x74, 0xF5, 0xCF, 0xC0, 0x03, 0x6A, 0xD9, 0xD7, 0x6E, 0x27, 0xDB, 0x4E, 0xB7, 0xF1,
+    0x8D, 0x77, 0x8A, 0x59, 0x9A, 0xBF, 0x5F, 0xCD, 0xAB, 0xCD, 0x5F, 0x2B, 0xE6, 0x41, 0x76, 0xD7,
+    0x5A, 0xEC, 0xB3, 0x7B, 0x50, 0xBC, 0x2A, 0xFE, 0x41, 0x96, 0x4E, 0xE2, 0x94, 0x06, 0x91, 0x85,
+    0x41, 0xBE, 0x7F, 0x14, 0x48, 0x0D, 0x9E, 0x32, 0x81, 0xFE, 0x83, 0x0C, 0xBE, 0x71, 0xE9, 0xF4,
+    0xB4, 0x5F, 0xFB, 0xA6, 0x45, 0xAF, 0x27, 0xF1, 0xC5, 0x7F, 0xC4, 0xBF, 0x05, 0xB6, 0xEE, 0x4B,
+    0x49, 0x67, 0x30, 0x65, 0xFF, 0xF5, 0x5B, 0x0D, 0x5F, 0xE4, 0x07, 0x7E, 0x99, 0x8A, 0x1F, 0xFD,
+    0xE5, 0x25, 0xD6, 0x95, 0x21, 0xC7, 0x6A, 0x16, 0x55, 0xCC, 0xAC, 0xB2, 0x49, 0x43, 0xB6, 0x49,
+    0x2F, 0x7E, 0x34, 0xB3, 0x0F, 0x26, 0x4D, 0xD8, 0x7B, 0x82, 0x7B, 0x4D, 0x7E, 0xCF, 0x3F, 0xF2,
+    0xCD, 0x37, 0x5F, 0x6C, 0xFE, 0xF2, 0x9B, 0x40, 0x79, 0xFC, 0x1E, 0x32, 0xE8, 0x11, 0x20, 0xCE,
+    0xEE, 0x8E, 0x84, 0x95, 0x36, 0x64, 0x95, 0x5D, 0xB2, 0xE3, 0xC6, 0xED, 0xA1, 0x74, 0xDB, 0x4E,
+    0x8F, 0xDD, 0x5F, 0x57, 0x30, 0x3F, 0xDF, 0xA3, 0x91, 0x85, 0x7E, 0xE5, 0xF2, 0x26, 0xAD, 0x9B,
+    0xCA, 0xEE, 0x86, 0x5C, 0x6B, 0x26, 0x99, 0xF9, 0x6C, 0xC8, 0x2A, 0xFB, 0xE7, 0x6A, 0xD7, 0x4C,
+    0x5A, 0x39, 0x1B, 0xB2, 0xC7, 0xAB, 0xE2, 0x92, 0xB9, 0xD7, 0xCC, 0x32, 0x2C, 0xA2, 0x6B, 0x5F,
+    0xA6, 0xD7, 0xDE, 0xFA, 0x8A, 0x9C, 0x9F, 0xFF, 0x74, 0xF5, 0x55, 0x1E, 0x6C, 0x43, 0x71, 0x97,
+    0xCB, 0xE3, 0xFF, 0x6A, 0xEE, 0xAB, 0x72, 0x7E, 0xFE, 0xEE, 0xEA, 0xAB, 0xBC, 0x2D, 0x43, 0x71,
+    0xE3, 0x27, 0x09, 0xE8, 0xF2, 0xA5, 0x54, 0x72, 0x00, 0x2E, 0x00, 0x36, 0x74, 0x01, 0x25, 0xF2,
+    0x40, 0x64, 0x29, 0x7A, 0xBE, 0xA2, 0x93, 0x7E, 0x3E, 0xA1, 0x65, 0x19, 0xCE, 0x37, 0x95, 0x6D,
+    0x6A, 0x2A, 0xFB, 0xAE, 0x9A, 0x9F, 0xAD, 0xBD, 0x6C, 0xFB, 0xDF, 0x6B, 0x70, 0x0A, 0x4C, 0x33,
+    0xE6, 0x6D, 0x09, 0x44, 0x56, 0xFA, 0xA6, 0x32, 0x66, 0xB1, 0x7F, 0x81, 0x0F, 0x22, 0x63, 0x53,
+    0x9B, 0xDC, 0xC8, 0x26, 0x9D, 0xB9, 0xF1, 0x76, 0x57, 0xD7, 0xAE, 0xEA, 0x87, 0xF9, 0x46, 0x8E,
+    0x46, 0x8C, 0xE4, 0x58, 0xCC, 0x76, 0x31, 0xEF, 0x9C, 0xE2, 0x0A, 0xB1, 0xA0, 0x0A, 0x2A, 0x33,
+    0xBC, 0x17, 0x8C, 0x54, 0x73, 0xBE, 0x99, 0x14, 0xED, 0xE8, 0xED, 0x78, 0xDB, 0xDE, 0x6B, 0x46,
+    0x8A, 0xDA, 0xD7, 0x5E, 0x17, 0x70, 0x1B, 0x5E, 0x66, 0xFB, 0x5C, 0x53, 0x44, 0x30, 0xA9, 0xFF,
+    0x87, 0xDC, 0x49, 0xE3, 0x77, 0x27, 0x70, 0xAF, 0x26, 0x93, 0x9A, 0x5D, 0xBC, 0x2C, 0xEA, 0x82,
+    0x1D, 0x38, 0xC1, 0xD6, 0x4E, 0x16, 0xDF, 0x06, 0xA9, 0xAA, 0xDA, 0x0F, 0x9A, 0x2A, 0xFE, 0x5A,
+    0x53, 0xF9, 0x8C, 0x36, 0x7C, 0xB6, 0xD2, 0xB4, 0xB4, 0xAE, 0x99, 0xCF, 0x5A, 0x5F, 0xCD, 0xCF,
+    0x9A, 0x2A, 0xF6, 0x5E, 0xD3, 0xD9, 0x26, 0x99, 0x92, 0x1B, 0x27, 0xC1, 0x07, 0x57, 0x2F, 0xA5,
+    0x17, 0x44, 0x49, 0x83, 0xAC, 0xF8, 0xEB, 0xB9, 0xAF, 0x36, 0xE9, 0xF9, 0x0C, 0x77, 0xBF, 0xE0,
+    0x25, 0x11, 0x85, 0xFE, 0xA3, 0x8A, 0xFD, 0xFA, 0x43, 0x57, 0x7D, 0x93, 0x24, 0xFF, 0xD6, 0x2E,
+    0xBA, 0x01, 0x30, 0x37, 0x92, 0xF9, 0x45, 0x51, 0xB9, 0x71, 0xFA, 0xD4, 0xC5, 0x54, 0x4D, 0x0B,
+    0xD2, 0x68, 0x3E, 0x34, 0x93, 0x6E, 0x0F, 0x8B, 0xD3, 0x8B, 0x79, 0xB4, 0x28, 0x19, 0xBB, 0x95,
+    0xE0, 0x79, 0xD3, 0x7C, 0xB6, 0xF6, 0xB2, 0x72, 0x74, 0xFF, 0x5F, 0xBD, 0x9C, 0x4D, 0x8C, 0x26,
+    0xC7, 0x79, 0xDF, 0x7F, 0xD5, 0xB5, 0xC3, 0xA6, 0xD9, 0x11, 0x6B, 0x62, 0x2C, 0x1D, 0x5B, 0xB2,
+    0xD5, 0x3C, 0x08, 0x81, 0x6C, 0x88, 0x5B, 0x3A, 0xE8, 0xC0, 0x04, 0xBB, 0x53, 0x45, 0x6D, 0x00,
+    0x1A, 0x21, 0x12, 0x6E, 0x82, 0x7D, 0xE3, 0x43, 0x0E, 0x34, 0x60, 0x1D, 0x0C, 0x39, 0xB1, 0x74,
+    0xE0, 0x81, 0x41, 0x76, 0xB7, 0x9B, 0x5A, 0x20, 0x34, 0x40, 0x20, 0xDA, 0x00, 0xD1, 0xC9, 0x07,
+    0x12, 0xB0, 0x02, 0xC8, 0x34, 0x20, 0x13, 0xC1, 0x1E, 0x18, 0x65, 0x76, 0xBA, 0x76, 0x27, 0x00,
+    0x11, 0xF0, 0xA0, 0x26, 0x05, 0x85, 0x40, 0x7C, 0x60, 0x53, 0x1F, 0x96, 0x63, 0x02, 0xD9, 0x22,
+    0xD9, 0x82, 0x6A, 0xB9, 0xD5, 0xFD, 0xE4, 0xD0, 0xFD, 0xCE, 0xCE, 0xDA, 0xF2, 0x07, 0x29, 0x6F,
+    0x5E, 0xCC, 0x02, 0xF3, 0xF6, 0xCC, 0x3B, 0xFD, 0xD4, 0xD3, 0x4F, 0x3D, 0x1F, 0xFF, 0xFF, 0xBF,
+    0x16, 0x30, 0xA1, 0x8A, 0x45, 0xE6, 0x24, 0xA0, 0x83, 0x8A, 0xEC, 0xB3, 0x87, 0x69, 0xCB, 0xBE,
+    0x18, 0xC9, 0x34, 0xD8, 0x60, 0x86, 0x72, 0x2C, 0x32, 0xAF, 0x00, 0x40, 0x19, 0xE0, 0x15, 0xA8,
+    0x3C, 0x44, 0xA8, 0x3D, 0x56, 0x7C, 0x2D, 0xB9, 0xBA, 0xFD, 0x27, 0xED, 0x74, 0x1A, 0x7B, 0xB9,
+    0xD5, 0xF1, 0x69, 0x9A, 0x8A, 0x32, 0x46, 0x9A, 0x07, 0xD1, 0x3F, 0x1E, 0x5E, 0x76, 0x73, 0x87,
+    0x48, 0xAB, 0xE5, 0x0A, 0x65, 0x0B, 0xAF, 0x80, 0x59, 0x3F, 0x0D, 0xEA, 0x0A, 0x00, 0x1E, 0x4A,
+    0xF1, 0x54, 0x12, 0x29, 0x87, 0x09, 0x1D, 0x6B, 0x5F, 0xA4, 0xD2, 0x93, 0x81, 0x06, 0xD4, 0x97,
+    0xBE, 0xEB, 0x11, 0x89, 0x7C, 0xE9, 0x83, 0xAF, 0xA3, 0x32, 0x70, 0x00, 0x38, 0xC0, 0x04, 0x90,
+    0x0F, 0xFE, 0x28, 0x36, 0x22, 0xA9, 0x7E, 0xBB, 0xCB, 0xCA, 0x2F, 0x66, 0x52, 0xE1, 0x1F, 0x35,
+    0x6F, 0xCD, 0x59, 0x8B, 0x0C, 0x2A, 0xD5, 0xAD, 0x1E, 0x4C, 0xD0, 0xBD, 0x69, 0xCB, 0x50, 0x7B,
+    0x3D, 0x38, 0x6A, 0x11, 0x0E, 0x44, 0xFA, 0xA7, 0x1F, 0x2A, 0xC2, 0xFA, 0x11, 0xAC, 0xBC, 0x2A,
+    0x6F, 0xC9, 0xEB, 0x32, 0x34, 0x6D, 0x1D, 0xCC, 0x60, 0xFA, 0x22, 0x57, 0x3D, 0xEE, 0xF1, 0x01,
+    0xF3, 0xFD, 0x88, 0x9B, 0x25, 0x3C, 0xD0, 0x49, 0x4F, 0x95, 0x40, 0x24, 0x63, 0x65, 0x06, 0xD7,
+    0x82, 0xE9, 0xA1, 0x1C, 0xA1, 0x96, 0x80, 0x91, 0xB8, 0xDC, 0x3F, 0xE8, 0x48, 0x66, 0x8F, 0xDA,
+    0x57, 0x41, 0x47, 0x12, 0xBF, 0xCA, 0xD1, 0xEB, 0x0C, 0x76, 0x7B, 0xF5, 0x22, 0x16, 0x13, 0xF4,
+    0xF2, 0xA1, 0x42, 0xDA, 0x52, 0xC6, 0x72, 0xB8, 0xA6, 0xA3, 0x29, 0x66, 0xF8, 0x51, 0xCF, 0xA3,
+    0x07, 0x98, 0x2A, 0xEA, 0xA1, 0xE1, 0x52, 0x39, 0x54, 0xC3, 0x05, 0x3A, 0x43, 0xF5, 0x7E, 0xE0,
+    0x62, 0xFC, 0x54, 0x95, 0xF6, 0x54, 0x36, 0xFD, 0x35, 0x2D, 0x13, 0x36, 0x6D, 0xD7, 0x7D, 0xE3,
+    0x47, 0xEF, 0x4D, 0xE9, 0x1A, 0x27, 0x40, 0xFD, 0x21, 0xD0, 0x49, 0x4F, 0xED, 0x8B, 0x81, 0x88,
+    0x1A, 0x0C, 0x2F, 0x3D, 0xD6, 0x3F, 0x5D, 0x4B, 0x71, 0x18, 0xC6, 0xD3, 0xE5, 0x3F, 0xAF, 0xC2,
+    0x95, 0x07, 0x3F, 0xB7, 0x07, 0x8F, 0xF6, 0x09, 0xDE, 0x3F, 0x3B, 0xA0, 0xFF, 0x63, 0x15, 0x78,
+    0xF0, 0x33, 0xF5, 0x9F, 0x87, 0xA7, 0x9F, 0xAE, 0x67, 0x1D, 0xE2, 0x8E, 0x7F, 0x84, 0x48, 0x31,
+    0x70, 0x8B, 0x8B, 0xD0, 0x48, 0x0B, 0x3B, 0xE7, 0x80, 0xFF, 0x72, 0xA5, 0xC9, 0xE6, 0xF9, 0x1B,
+    0xC3, 0xD5, 0xD3, 0x46, 0xDF, 0x88, 0x17, 0x0F, 0x7E, 0x6B, 0x9E, 0xEB, 0x27, 0x5B, 0xF8, 0xB5,
+    0x3F, 0x7E, 0x4D, 0x46, 0xE0, 0x8B, 0x2F, 0x7D, 0xA3, 0x93, 0xA9, 0x93, 0x09, 0x2E, 0x6E, 0xBF,
+    0x4E, 0x76, 0x93, 0xCC, 0x32, 0xB1, 0x03, 0x95, 0xB4, 0x65, 0x5B, 0xF3, 0xDD, 0x73, 0x8F, 0x7E,
+    0xFA, 0xA0, 0x3F, 0x3C, 0xFB, 0xD5, 0x07, 0x3F, 0xFB, 0x8F, 0xFA, 0x3F, 0xD0, 0xA9, 0xFA, 0xEC,
+    0x3F, 0xEE, 0xFF, 0xE0, 0xB9, 0xB7, 0xFE, 0xD9, 0x2F, 0x9F, 0xFF, 0x87, 0xE1, 0x65, 0x9E, 0x2E,
+    0x7E, 0x78, 0x0D, 0xF5, 0x87, 0x38, 0x79, 0x4A, 0x5E, 0xDF, 0x9C, 0xE3, 0x1C, 0x32, 0x38, 0x79,
+    0xA2, 0xCF, 0xB9, 0xFA, 0x76, 0xBB, 0x7F, 0xCD, 0xBC, 0x2A, 0x63, 0x3D, 0xF1, 0x10, 0xFC, 0x36,
+    0xEC, 0xAF, 0x5F, 0x9B, 0x6B, 0xE7, 0xD7, 0xFB, 0xEE, 0xDF, 0xB9, 0xC8, 0x49, 0x1E, 0xDA, 0x6C,
+    0xAF, 0x03, 0xBF, 0x44, 0x25, 0xFE, 0xA0, 0xD1, 0xFD, 0xBE, 0xD2, 0x11, 0x8B, 0x8E, 0x38, 0xCA,
+    0x81, 0x83, 0x8D, 0x96, 0xE9, 0x81, 0x97, 0xAE, 0xF0, 0x05, 0x25, 0xFD, 0xAD, 0xF4, 0xB9, 0x53,
+    0xD4, 0x74, 0xBE, 0x1B, 0xD8, 0xC7, 0x62, 0xBF, 0x2A, 0x5F, 0x99, 0x97, 0xE0, 0xFA, 0x9C, 0xB9,
+    0x91, 0x5D, 0x15, 0x7E, 0x73, 0x71, 0xB8, 0xF3, 0x33, 0x75, 0x70, 0x54, 0xB1, 0x0E, 0x45, 0xAA,
+    0x06, 0xA6, 0x22, 0xE1, 0x98, 0x30, 0xC1, 0x51, 0xC6, 0x3A, 0x14, 0xD9, 0x44, 0xBA, 0x2A, 0xEF,
+    0x3A, 0xB9, 0xB9, 0x6F, 0xE4, 0xCD, 0xB9, 0xBC, 0xD9, 0xCF, 0x45, 0x04, 0xF2, 0x1A, 0xC4, 0x75,
+    0x80, 0x6A, 0x80, 0x62, 0x00, 0x60, 0x67, 0x03, 0x9D, 0xF4, 0x85, 0xDC, 0xBC, 0x52, 0xC8, 0xFB,
+    0x01, 0x49, 0x91, 0x6E, 0x7E, 0x06, 0x27, 0xFF, 0x16, 0x23, 0xAF, 0x79, 0xBD, 0xBD, 0x58, 0x4F,
+    0xCF, 0xA0, 0x6E, 0x9E, 0x02, 0xFD, 0x9A, 0x87, 0xF7, 0x03, 0x3C, 0x13, 0xE1, 0x91, 0x67, 0xC0,
+    0x3C, 0x02, 0xFA, 0xDB, 0x50, 0x88, 0x57, 0xFF, 0x4B, 0x3C, 0x4D, 0x84, 0xFB, 0xAE, 0x00, 0x94,
+    0xDF, 0xCF, 0xF3, 0x29, 0xAA, 0x67, 0x27, 0x1D, 0x5E, 0xB9, 0x74, 0x9F, 0xE7, 0xE4, 0x7D, 0x93,
+    0xC9, 0x64, 0x92, 0x1A, 0x8B, 0x58, 0x44, 0x3D, 0x94, 0x83, 0xCB, 0x5F, 0xFC, 0x06, 0x5F, 0xC4,
+    0xE6, 0xEA, 0xF0, 0xF5, 0x71, 0xCF, 0xEA, 0x37, 0x86, 0x0B, 0xA7, 0xCC, 0xB3, 0x12, 0xCB, 0x11,
+    0xF8, 0xB5, 0x3F, 0x7E, 0x42, 0x06, 0xEE, 0x7A, 0x5D, 0x45, 0x4D, 0x60, 0x02, 0x12, 0xD0, 0x91,
+    0x9D, 0x0C, 0xD7, 0xC0, 0xB4, 0x98, 0x16, 0x35, 0xA2, 0x97, 0x9D, 0xBE, 0x0F, 0x45, 0xA4, 0xF6,
+    0xA6, 0x75, 0xE8, 0x41, 0x27, 0x3D, 0xB0, 0x8F, 0x7C, 0x5E, 0x42, 0xCD, 0x99, 0xD8, 0x64, 0xDD,
+    0x9B, 0xA7, 0x80, 0xA4, 0xDF, 0x18, 0xC0, 0x92, 0xF6, 0xA0, 0xEA, 0xAD, 0x64, 0x54, 0x52, 0x22,
+    0x2D, 0x0E, 0xAA, 0x80, 0xE9, 0x21, 0xB1, 0xE6, 0x22, 0x75, 0xB7, 0x19, 0x54, 0x9E, 0xBA, 0xA7,
+    0x8C, 0xB8, 0xB8, 0xDA, 0x51, 0x8C, 0xB0, 0x87, 0x4A, 0x50, 0x7B, 0x12, 0x94, 0x61, 0x35, 0xE3,
+    0x42, 0x39, 0x93, 0x39, 0x53, 0xC9, 0xB0, 0xC7, 0x9E, 0xEE, 0x73, 0x17, 0x2D, 0x57, 0xF6, 0x9A,
+    0x5C, 0x7B, 0x2C, 0x98, 0x16, 0xEB, 0x31, 0x61, 0xBD, 0xE9, 0x25, 0x28, 0x07, 0x2E, 0x82, 0x8E,
+    0x34, 0x12, 0x74, 0xA4, 0x96, 0x81, 0xAB, 0x00, 0x9C, 0x38, 0x6E, 0x80, 0x02, 0x22, 0x5A, 0xA0,
+    0x6E, 0x99, 0x13, 0x3A, 0xF2, 0x60, 0xD5, 0x92, 0x81, 0x11, 0xEB, 0x51, 0xD7, 0xD0, 0x03, 0x74,
+    0x3D, 0x19, 0x76, 0x2C, 0x16, 0xD3, 0xAA, 0xA8, 0x7B, 0x9D, 0x68, 0x48, 0xC8, 0x3F, 0xED, 0xC2,
+    0x29, 0xCE, 0x44, 0x19, 0xAA, 0x60, 0x9E, 0x02, 0x35, 0xEA, 0x37, 0x06, 0xD8, 0x23, 0xED, 0x81,
+    0x09, 0x56, 0x32, 0xC5, 0xA8, 0x44, 0x5A, 0x2E, 0x2D, 0xCE, 0x08, 0x90, 0x60, 0xBC, 0xDB, 0x19,
+    0xC7, 0xF2, 0x79, 0xDD, 0x9B, 0xAC, 0x1A, 0x6A, 0x6F, 0xBD, 0xF5, 0xD6, 0xD7, 0xBE, 0x0A, 0xC5,
+    0xF8, 0xA9, 0x6E, 0x36, 0xD2, 0x4A, 0xAB, 0x80, 0xC2, 0x7B, 0xA8, 0xBF, 0xD7, 0x83, 0x93, 0x00,
+    0xA7, 0x1B, 0x7F, 0xD7, 0x92, 0x7E, 0x1B, 0x28, 0x32, 0x50, 0x66, 0xC0, 0x4C, 0x80, 0x9D, 0x80,
+    0xBD, 0x03, 0x20, 0x37, 0xA0, 0xC6, 0x06, 0x74, 0x74, 0x50, 0xF5, 0xCE, 0x63, 0x82, 0x6B, 0xB1,
+    0x22, 0x81, 0x46, 0x24, 0x30, 0x61, 0x43, 0x91, 0xA8, 0x7B, 0x1D, 0xA9, 0x07, 0x3B, 0x21, 0x53,
+    0x33, 0x17, 0x32, 0x01, 0x5F, 0x00, 0xB4, 0x00, 0xE6, 0x49, 0x0F, 0xA6, 0xF2, 0x60, 0x9E, 0x02,
+    0xCA, 0x09, 0xE0, 0xDC, 0x3D, 0xBD, 0xB9, 0xDA, 0x6C, 0x36, 0x1E, 0x9C, 0xC8, 0x04, 0xCB, 0x2F,
+    0x53, 0x0A, 0xFB, 0xA0, 0x7E, 0x12, 0xCB, 0x16, 0xF6, 0x2E, 0xF1, 0x9B, 0x60, 0x5E, 0xEB, 0x81,
+    0x22, 0x66, 0x80, 0x6B, 0x46, 0x46, 0xA8, 0xBF, 0x22, 0x02, 0x3A, 0xBA, 0xAF, 0x9D, 0x03, 0x91,
+    0x11, 0x70, 0x22, 0x9C, 0xA0, 0x1A, 0xCA, 0xA8, 0x7B, 0x95, 0x39, 0xE0, 0x22, 0x0D, 0xE6, 0x87,
+    0x4F, 0x05, 0x9B, 0x8C, 0x48, 0xAA, 0xE4, 0xBA, 0x88, 0x78, 0x3E, 0xFE, 0xAD, 0x2B, 0x54, 0x22,
+    0x23, 0x8D, 0x48, 0xE2, 0x89, 0x68, 0x47, 0x5C, 0xB0, 0x91, 0x19, 0x17, 0xCA, 0x91, 0xCE, 0xDB,
+    0xA0, 0xE6, 0x8F, 0xCB, 0x37, 0xCA, 0xB1, 0x93, 0x68, 0xFB, 0x7A, 0xA0, 0xA3, 0xF1, 0x3A, 0x17,
+    0x99, 0xBA, 0x37, 0x11, 0xC1, 0xB5, 0x75, 0x54, 0xF2, 0x3B, 0xE2, 0x1B, 0x91, 0xA1, 0x10, 0xF9,
+    0xC1, 0xD1, 0x53, 0xFA, 0xD4, 0x09, 0xA8, 0xDF, 0xEB, 0xD1, 0x92, 0xE1, 0xB4, 0xF3, 0x4B, 0x39,
+    0x05, 0xE0, 0x8B, 0x57, 0x40, 0xA4, 0xA7, 0x11, 0xF1, 0xF5, 0x58, 0xE7, 0x32, 0xE3, 0x7A, 0xF1,
+    0xC5, 0x5C, 0x47, 0xEC, 0xF7, 0x26, 0x8A, 0xD9, 0x05, 0xEC, 0xF7, 0xF3, 0xF2, 0x8D, 0xFB, 0x4E,
+    0x46, 0x67, 0x17, 0xE8, 0x2E, 0x4F, 0xD4, 0xD1, 0xC6, 0x72, 0x42, 0xDE, 0x11, 0x5F, 0x8A, 0xF4,
+    0x54, 0xD2, 0xB3, 0x46, 0xFC, 0xEE, 0x2B, 0xFA, 0x3B, 0xC9, 0x5D, 0xBE, 0x9D, 0xB4, 0xB4, 0x65,
+    0xC6, 0x25, 0x7D, 0x3B, 0xB9, 0xCB, 0x29, 0xE9, 0xBE, 0xDD, 0xD9, 0x1A, 0x75, 0xDF, 0x1F, 0xEA,
+    0x16, 0x27, 0x3F, 0x19, 0x68, 0x44, 0x06, 0x9A, 0xBE, 0x89, 0x34, 0x41, 0x67, 0x5C, 0xD0, 0xD2,
+    0xD6, 0x83, 0xBE, 0x39, 0x54, 0xA3, 0x7E, 0x33, 0xE9, 0x5C, 0xBE, 0x3E, 0x23, 0x65, 0xDF, 0xB4,
+    0xEE, 0xB9, 0xDE, 0xF6, 0xE6, 0x47, 0xC1, 0x44, 0x2D, 0xA1, 0x4C, 0x48, 0xD0, 0x19, 0x1B, 0xCB,
+    0x89, 0x4A, 0xFE, 0x78, 0xA2, 0x12, 0x99, 0x28, 0x6F, 0xC8, 0x08, 0xED, 0xB1, 0x3D, 0xF7, 0xCB,
+    0xAC, 0xF5, 0x77, 0x82, 0x62, 0x86, 0x6D, 0x99, 0x55, 0x9B, 0x73, 0x0F, 0x9D, 0x6F, 0xC4, 0xC8,
+    0xA1, 0xB4, 0xCD, 0x60, 0xA2, 0x1E, 0xE9, 0x38, 0x40, 0x8F, 0x26, 0xE0, 0x0E, 0x23, 0x2A, 0x5F,
+    0x03, 0x73, 0xB3, 0x85, 0x2E, 0xAE, 0x31, 0xE6, 0xDA, 0xA5, 0x8C, 0xD3, 0x01, 0x26, 0x02, 0x02,
+    0xC8, 0x0C, 0x56, 0x7A, 0x60, 0x73, 0x1E, 0x25, 0x33, 0x74, 0x23, 0xD8, 0x00, 0x4E, 0x5A, 0x9C,
+    0x24, 0x9A, 0xC7, 0x33, 0x9D, 0x9A, 0xE9, 0x98, 0x11, 0x26, 0xE6, 0x22, 0xAB, 0xA9, 0x1A, 0x8B,
+    0xB9, 0x1B, 0xB4, 0xCC, 0xE8, 0xF9, 0x0A, 0x65, 0x82, 0x46, 0x3C, 0x9D, 0x2C, 0x19, 0xFE, 0x0A,
+    0x60, 0xC5, 0x83, 0x93, 0x08, 0xB6, 0xCD, 0x60, 0x82, 0x83, 0x6A, 0x30, 0x01, 0x3D, 0x56, 0x01,
+    0x72, 0xD9, 0x43, 0xA3, 0x07, 0xB0, 0x97, 0x23, 0x98, 0xD7, 0x33, 0xE8, 0xD8, 0xB4, 0xA8, 0x5C,
+    0x25, 0x68, 0xE8, 0x3C, 0xB6, 0x35, 0x11, 0xD3, 0xAB, 0x8C, 0x8E, 0xC1, 0xA1, 0xF2, 0xC1, 0x97,
+    0x5A, 0x0E, 0x9C, 0xB4, 0xB8, 0xB3, 0xE2, 0x31, 0x01, 0x28, 0x23, 0x14, 0x9F, 0x4F, 0xA0, 0x3E,
+    0xC8, 0x40, 0x33, 0x01, 0xD5, 0xD2, 0x2D, 0x28, 0xEF, 0x71, 0xAF, 0x7A, 0x2D, 0x19, 0x63, 0x86,
+    0xA3, 0x9D, 0xBF, 0x0B, 0xE6, 0x56, 0x52, 0x22, 0xBD, 0x79, 0x5B, 0xE8, 0x8A, 0xA4, 0xA3, 0xE9,
+    0x6D, 0x70, 0xCC, 0x45, 0xD6, 0xA3, 0x89, 0x26, 0x74, 0xAD, 0x7B, 0xE2, 0xE0, 0x61, 0xB9, 0x26,
+    0xDF, 0x91, 0xC3, 0xB9, 0x4C, 0x66, 0x2D, 0x08, 0xD7, 0xC0, 0x64, 0x78, 0xF9, 0x2A, 0xFA, 0x7A,
+    0x8F, 0x79, 0x0A, 0xEA, 0x11, 0x76, 0x96, 0x80, 0x74, 0x3F, 0x1A, 0x4A, 0x11, 0xEF, 0x9E, 0xCB,
+    0x45, 0xAE, 0x06, 0x13, 0x9C, 0xEF, 0xC8, 0x3A, 0x55, 0xD1, 0xF4, 0x2E, 0xB8, 0x62, 0x66, 0x3A,
+    0x95, 0x2E, 0xCF, 0x3F, 0x91, 0x27, 0xC5, 0xA4, 0x7A, 0x70, 0xED, 0x6A, 0xA1, 0xF2, 0xD8, 0x5B,
+    0x6E, 0x44, 0x44, 0xB2, 0x4E, 0xF5, 0x90, 0xAB, 0x58, 0x87, 0x6C, 0x82, 0xFB, 0xFC, 0x68, 0x83,
+    0xAB, 0x06, 0xD7, 0x76, 0x9D, 0x77, 0x5E, 0x12, 0x4E, 0x8B, 0xDF, 0x75, 0x4F, 0x08, 0xD1, 0xDD,
+    0x6C, 0xFE, 0x28, 0xBA, 0xEC, 0x24, 0x98, 0xA1, 0x9A, 0x8E, 0x05, 0xCB, 0xD3, 0x9F, 0xA5, 0xBE,
+    0xE9, 0x69, 0x02, 0x65, 0x46, 0xC9, 0xC0, 0xFD, 0x0E, 0x8A, 0x11, 0x2B, 0xAD, 0x91, 0xAC, 0xE7,
+    0x2E, 0x48, 0x91, 0xEB, 0x50, 0x1F, 0x26, 0x95, 0x9D, 0xB7, 0x97, 0xA3, 0x1E, 0x1B, 0x1A, 0x3D,
+    0x9A, 0xDE, 0xBD, 0x93, 0x94, 0x08, 0xA5, 0xB4, 0x47, 0x9E, 0x93, 0x4F, 0x62, 0xA5, 0x2F, 0x0E,
+    0xD3, 0xD6, 0x71, 0xCA, 0x53, 0x48, 0xAF, 0x44, 0x68, 0x9E, 0x4B, 0x66, 0x70, 0xD7, 0x73, 0x91,
+    0x5D, 0x6B, 0x0F, 0x47, 0x9D, 0x9C, 0x77, 0x8F, 0x8F, 0x65, 0x74, 0x7E, 0xD2, 0x53, 0x13, 0x6A,
+    0x19, 0x68, 0xC6, 0x23, 0xAB, 0xAE, 0xC1, 0x0C, 0x13, 0xEC, 0xAE, 0x7D, 0xD3, 0x17, 0x5F, 0xFA,
+    0x06, 0xC0, 0xFE, 0x9D, 0xEB, 0x70, 0x52, 0x41, 0xF7, 0x5E, 0xAF, 0x44, 0x06, 0x35, 0xD7, 0x03,
+    0x93, 0xCE, 0x34, 0x5A, 0x70, 0x67, 0x6F, 0x06, 0xF3, 0xEA, 0x6B, 0x83, 0xBE, 0x7D, 0x38, 0x2A,
+    0x79, 0x36, 0xE3, 0xDA, 0x09, 0xF3, 0xAE, 0x60, 0x64, 0xC6, 0xD4, 0xD3, 0x5D, 0x55, 0xD2, 0x00,
+    0x65, 0x0F, 0x3A, 0x42, 0x31, 0xB2, 0xD4, 0x8E, 0x87, 0xB7, 0x3F, 0x3D, 0x41, 0x35, 0xD6, 0x7D,
+    0x25, 0x3A, 0x61, 0xC3, 0x8C, 0x1E, 0x6D, 0xCB, 0x64, 0x7A, 0xEC, 0xE5, 0x48, 0xF9, 0xF6, 0x88,
+    0x4A, 0xFB, 0xE0, 0xCE, 0x80, 0xB9, 0xB9, 0x66, 0x6F, 0xF1, 0xCB, 0xAE, 0xA9, 0x03, 0x98, 0xC0,
+    0xA3, 0x75, 0xA0, 0x96, 0xB0, 0x78, 0xE9, 0x80, 0x35, 0x95, 0x57, 0x33, 0xCB, 0x15, 0xB3, 0xDE,
+    0x59, 0x65, 0xE0, 0x9A, 0x02, 0x67, 0x46, 0xCC, 0xB7, 0x85, 0xF2, 0x66, 0x17, 0x0A, 0x79, 0x3C,
+    0x22, 0x8F, 0x65, 0x5C, 0x68, 0x30, 0xBD, 0x6D, 0xCB, 0x68, 0xFA, 0x22, 0x95, 0x91, 0x49, 0x8F,
+    0xB8, 0x37, 0x33, 0xB5, 0x64, 0x2A, 0x49, 0x14, 0x09, 0x98, 0xD6, 0xD6, 0xC9, 0xFE, 0x60, 0xD9,
+    0x87, 0x0F, 0xBC, 0x74, 0x94, 0x14, 0x4E, 0x19, 0x4F, 0xFD, 0xDA, 0x40, 0xF5, 0x46, 0x04, 0xBF,
+    0xBB, 0xBD, 0xEC, 0xE9, 0x1E, 0x9B, 0xE8, 0xA2, 0x6B, 0x8B, 0x6C, 0x06, 0xDC, 0xE7, 0x13, 0xA6,
+    0x9F, 0x28, 0x92, 0x83, 0x4B, 0xB5, 0xA7, 0x7E, 0x3E, 0xA0, 0xDF, 0xEF, 0x61, 0x8E, 0xE0, 0x22,
+    0x98, 0x11, 0x74, 0x5A, 0xCD, 0xCD, 0xE8, 0x67, 0x33, 0x4A, 0x32, 0x34, 0x69, 0xE9, 0xD6, 0x80,
+    0x9D, 0x8D, 0x07, 0x2B, 0x61, 0xAD, 0x9F, 0xC7, 0x5E, 0xF7, 0xAA, 0x7A, 0xD5, 0x12, 0x10, 0x81,
+    0xCD, 0xF9, 0xA3, 0xAA, 0x2F, 0x2F, 0xB4, 0xB5, 0x4C, 0xCC, 0x75, 0xAC, 0xA2, 0x6D, 0x1D, 0x53,
+    0x91, 0x75, 0x34, 0x83, 0x0D, 0xCE, 0x0B, 0xB9, 0x4A, 0x7A, 0xFC, 0xEF, 0xDF, 0x33, 0xB7, 0xDF,
+    0x9A, 0x5C, 0x76, 0x43, 0xD3, 0xCE, 0xAB, 0x81, 0xF7, 0xE3, 0xE1, 0x94, 0x0A, 0x60, 0x6F, 0xB6,
+    0x60, 0x66, 0x40, 0x9D, 0xBB, 0xE7, 0xF6, 0x9F, 0x00, 0x9E, 0xD1, 0x14, 0xB7, 0xF6, 0xD1, 0x12,
+    0x28, 0xFE, 0xEC, 0x67, 0x4C, 0x39, 0xF7, 0xB0, 0x47, 0xA9, 0x3C, 0x70, 0x66, 0xDD, 0x88, 0xD0,
+    0xBD, 0x08, 0xB8, 0x7E, 0x71, 0xFA, 0x47, 0xF3, 0xFB, 0xB0, 0xEC, 0xC0, 0x0B, 0xA0, 0x3E, 0x00,
+    0x9D, 0x8F, 0xF7, 0xAE, 0xEB, 0x18, 0x60, 0x23, 0xB8, 0x01, 0x1E, 0x58, 0x4B, 0xB8, 0xFA, 0x66,
+    0x4B, 0x25, 0x82, 0x11, 0x09, 0x26, 0xE9, 0x68, 0x46, 0x52, 0x35, 0x72, 0x5A, 0x67, 0x50, 0xD3,
+    0x5A, 0xA2, 0x5C, 0x58, 0xEA, 0x95, 0xCE, 0xDB, 0x0B, 0x03, 0x9F, 0xAB, 0x66, 0x2E, 0x21, 0x22,
+    0xD4, 0x22, 0x9E, 0x6E, 0x3E, 0x76, 0x33, 0xDD, 0x52, 0x44, 0x54, 0x86, 0x0C, 0x17, 0xE0, 0xFE,
+    0xED, 0x0E, 0xA9, 0x66, 0x8C, 0x04, 0xF3, 0xA7, 0xD1, 0x0C, 0xBB, 0x65, 0xA4, 0x48, 0x30, 0x81,
+    0xF3, 0xD4, 0x3D, 0x3A, 0x55, 0x88, 0x04, 0x2B, 0x7D, 0x21, 0xC7, 0x0A, 0xB0, 0x1A, 0x41, 0x89,
+    0x47, 0xDD, 0x8E, 0x14, 0x69, 0x0F, 0x46, 0x7D, 0xAF, 0x2C, 0x3F, 0x87, 0x1E, 0x31, 0x19, 0x7B,
+    0x91, 0x7D, 0x4B, 0xFC, 0xD8, 0x6A, 0xB4, 0x4D, 0x48, 0xD6, 0xB7, 0xF6, 0xCD, 0xB0, 0x5B, 0x07,
+    0x6C, 0x8B, 0xF3, 0x38, 0x4F, 0xE3, 0x71, 0xED, 0xCB, 0x4E, 0xA2, 0x95, 0xBE, 0x5A, 0xFF, 0x86,
+    0xF2, 0xC7, 0x32, 0xD0, 0x25, 0x96, 0xDA, 0x04, 0x70, 0xDF, 0xB7, 0xC0, 0x4A, 0xC6, 0x89, 0xE0,
+    0x06, 0x13, 0x5C, 0xAF, 0x07, 0xDB, 0x13, 0x4D, 0x5C, 0x5A, 0x82, 0x3B, 0xF6, 0xDD, 0x65, 0x70,
+    0x4B, 0x6F, 0x93, 0x4A, 0x5A, 0x24, 0xD3, 0xC8, 0x44, 0x21, 0xE9, 0x98, 0xB1, 0x91, 0x2A, 0x52,
+    0xF5, 0xDB, 0x0C, 0xFC, 0xA1, 0x2C, 0x05, 0x78, 0xB9, 0x0C, 0xD8, 0xAA, 0x47, 0xDF, 0xEE, 0xA1,
+    0x09, 0x0B, 0xF6, 0x72, 0x4F, 0x5C, 0xFB, 0xA9, 0xD2, 0xD7, 0x55, 0xD0, 0x6F, 0x06, 0xBA, 0x1E,
+    0x33, 0xA0, 0x5E, 0xDC, 0x66, 0x17, 0x9B, 0x70, 0x82, 0xFB, 0xFD, 0xE0, 0x5A, 0x5F, 0x07, 0xAA,
+    0x01, 0x3D, 0xC2, 0x04, 0x8D, 0xC7, 0x0C, 0x9F, 0xD1, 0x22, 0x74, 0xE2, 0xAB, 0xBB, 0xA2, 0x2B,
+    0x58, 0x30, 0x97, 0x23, 0xD4, 0x1D, 0x4B, 0x44, 0x73, 0x6A, 0xEB, 0xE7, 0x6F, 0x7E, 0x9D, 0x42,
+    0x64, 0xA2, 0x16, 0x99, 0xF9, 0xF9, 0x5C, 0x4D, 0x98, 0x58, 0x65, 0x5C, 0x6B, 0xA2, 0x9A, 0xB0,
+    0x7D, 0x15, 0x69, 0x5A, 0x1B, 0xD4, 0x84, 0x50, 0x8D, 0x3A, 0x61, 0x43, 0xDD, 0x23, 0x74, 0x94,
+    0xA3, 0xCE, 0xB8, 0x60, 0x86, 0x32, 0xD3, 0xFC, 0x6F, 0xE9, 0x6B, 0x91, 0x44, 0x27, 0xB7, 0xEE,
+    0xDC, 0xD8, 0x03, 0xDD, 0x1B, 0x03, 0xA5, 0x3C, 0xD9, 0xC2, 0x74, 0x1A, 0xF4, 0xBB, 0x03, 0xD4,
+    0xAF, 0xC1, 0xEE, 0xC1, 0x49, 0xCC, 0xED, 0x11, 0x25, 0x12, 0x30, 0x6F, 0x0B, 0x74, 0x45, 0x42,
+    0x47, 0xD3, 0x63, 0x83, 0x83, 0xB9, 0xC8, 0xE8, 0xD1, 0x0C, 0x98, 0xD0, 0xB5, 0xB8, 0x27, 0x0E,
+    0x1E, 0x46, 0xAE, 0x49, 0xAF, 0xE5, 0x70, 0xE6, 0x58, 0xB2, 0xB9, 0x97, 0x6D, 0x3C, 0x1E, 0xAA,
+    0x69, 0xC1, 0xC1, 0x30, 0x01, 0xFE, 0xE8, 0x03, 0xE8, 0x24, 0xC0, 0x01, 0x34, 0x8D, 0xA7, 0x93,
+    0x80, 0x7C, 0x29, 0xD2, 0x15, 0x09, 0xE7, 0x27, 0x6C, 0x70, 0x98, 0xC1, 0x06, 0x3D, 0x9A, 0x81,
+    0x5C, 0x25, 0x9A, 0x27, 0x0E, 0x1E, 0x36, 0xB7, 0xDF, 0x9A, 0xB4, 0x1C, 0xCE, 0xDC, 0xC9, 0xF4,
+    0x6C, 0xCE, 0x2F, 0xD0, 0x4D, 0xBD, 0x6D, 0xE1, 0x81, 0x87, 0x36, 0x1B, 0x5F, 0x8B, 0x8C, 0x85,
+    0xC8, 0x84, 0x0D, 0x35, 0x26, 0x96, 0x41, 0x27, 0xD5, 0xAB, 0x69, 0x6D, 0x80, 0xAD, 0x24, 0x8C,
+    0x4C, 0xE8, 0x5B, 0x1B, 0xD6, 0x8B, 0x27, 0x70, 0xA1, 0xF2, 0x66, 0xD0, 0x7D, 0x79, 0xEB, 0x37,
+    0x62, 0x2D, 0x92, 0x2B, 0x91, 0x09, 0x1A, 0xC1, 0x49, 0x50, 0x9B, 0x73, 0x77, 0xA7, 0x91, 0xC3,
+    0xD1, 0x84, 0x5C, 0x0E, 0x97, 0x8A, 0x78, 0xC0, 0x3C, 0xE3, 0x12, 0x75, 0x7F, 0x42, 0xC7, 0xCA,
+    0xCB, 0x1F, 0xF7, 0xC7, 0xD3, 0xC8, 0x39, 0x05, 0x17, 0x4A, 0x8F, 0x91, 0x40, 0x21, 0x01, 0x76,
+    0xFC, 0x5A, 0x5D, 0x37, 0xE7, 0x4A, 0x91, 0x89, 0x4E, 0xC4, 0x57, 0xB1, 0x0C, 0x3A, 0xAB, 0xC8,
+    0xCC, 0xD3, 0x34, 0x7E, 0xE9, 0xC0, 0x2B, 0x99, 0xD1, 0x22, 0x9E, 0x79, 0xE3, 0xD7, 0x8B, 0x0A,
+    0x13, 0x8B, 0x5E, 0x27, 0x46, 0x35, 0x6F, 0x72, 0x29, 0x22, 0x85, 0x88, 0x78, 0x76, 0xE1, 0x93,
+    0x84, 0xEA, 0x4F, 0x23, 0x12, 0xA9, 0x5E, 0xDC, 0x0E, 0xEF, 0xDD, 0x80, 0x64, 0xB2, 0xF3, 0xD9,
+    0x84, 0x4B, 0xE5, 0x60, 0xAB, 0xC1, 0xDC, 0x1C, 0xB4, 0xB4, 0x6A, 0xC2, 0x3B, 0xAE, 0x9A, 0x0F,
+    0xA6, 0xE2, 0x38, 0xBA, 0xA6, 0x3C, 0xE8, 0x71, 0xDD, 0x65, 0xCD, 0x9D, 0x04, 0xF2, 0x77, 0x6A,
+    0xEA, 0x5F, 0x93, 0x3B, 0xE2, 0x64, 0x42, 0xAE, 0x9F, 0x4D, 0xB6, 0x1A, 0x5C, 0xD7, 0xBA, 0x44,
+    0xE3, 0x77, 0x1D, 0x57, 0xDD, 0x3B, 0xE3, 0x9D, 0xDC, 0xB1, 0xD9, 0x6C, 0x68, 0x44, 0xFA, 0x4A,
+    0x64, 0xA4, 0xE3, 0x02, 0x2E, 0xD4, 0x98, 0xA1, 0xF4, 0xE5, 0xB8, 0x96, 0xCA, 0x4E, 0x06, 0x9C,
+    0x8C, 0x98, 0x1F, 0x9E, 0x67, 0xBD, 0xB8, 0x8B, 0xF0, 0x08, 0xAE, 0x35, 0xBE, 0xFE, 0xE1, 0x53,
+    0xA1, 0x11, 0x89, 0x76, 0x19, 0x70, 0xAF, 0xAE, 0x5D, 0xE2, 0x05, 0xA0, 0xFE, 0x33, 0xD0, 0xD3,
+    0x0A, 0x11, 0xFC, 0xED, 0x4C, 0x12, 0xF8, 0x0C, 0x3C, 0x0D, 0x11, 0x3E, 0xF0, 0x74, 0xFE, 0x08,
+    0x5E, 0xB8, 0x5A, 0xF6, 0xC7, 0xB2, 0x5B, 0xBF, 0x34, 0xA6, 0x80, 0xDA, 0x6C, 0xCE, 0x2B, 0x11,
+    0xF1, 0x56, 0xA4, 0x2F, 0xB2, 0x8A, 0x08, 0x17, 0x70, 0xED, 0xAF, 0x50, 0xF7, 0x50, 0x45, 0x28,
+    0x44, 0x5A, 0x44, 0x7A, 0xDC, 0xD7, 0xCE, 0x6D, 0x2F, 0x7A, 0x9D, 0xB9, 0xCA, 0xCC, 0x19, 0x9A,
+    0xAF, 0x35, 0x4A, 0x44, 0x42, 0x27, 0xD2, 0xFF, 0x2D, 0x32, 0x9B, 0xE9, 0x9D, 0x8E, 0xF5, 0xB3,
+    0xA9, 0xBA, 0x91, 0xF4, 0xED, 0x84, 0x0C, 0x34, 0x7E, 0xD7, 0x84, 0x47, 0xF4, 0xDC, 0xF9, 0xBF,
+    0x98, 0xD9, 0x16, 0xC4, 0x39, 0x81, 0xBE, 0xDD, 0xA3, 0xB2, 0x85, 0x53, 0xBC, 0xB8, 0x2D, 0x20,
+    0x9E, 0x52, 0xA4, 0xD5, 0x22, 0x19, 0x69, 0x4D, 0xEB, 0x7A, 0xC6, 0x6A, 0xC4, 0x20, 0x80, 0xED,
+    0xD7, 0x3C, 0xEC, 0xC2, 0xCE, 0xE6, 0x6C, 0x46, 0xB2, 0x0B, 0x95, 0x9C, 0xCD, 0x98, 0xC1, 0x0D,
+    0xCC, 0x85, 0x78, 0xD3, 0x1B, 0xF9, 0xFD, 0x8C, 0x5B, 0x1A, 0x93, 0x2B, 0xC7, 0xC2, 0xAD, 0xC8,
+    0x4B, 0x81, 0xE5, 0x83, 0x08, 0xE9, 0x0C, 0x3C, 0x53, 0x1E, 0x95, 0x18, 0x4A, 0x91, 0xB6, 0xBA,
+    0x2D, 0x7D, 0x19, 0xDD, 0x32, 0xDA, 0xE6, 0x32, 0xE2, 0x74, 0xA2, 0xFA, 0x51, 0x5E, 0x06, 0xD5,
+    0xBA, 0x87, 0xBA, 0x5D, 0x46, 0xBE, 0x42, 0x06, 0xCC, 0x6D, 0x69, 0x4D, 0x5F, 0x8F, 0xD5, 0xC0,
+    0x5C, 0x24, 0x9C, 0x6F, 0xBE, 0xDB, 0xB5, 0x95, 0x48, 0x8B, 0xBD, 0x05, 0xF0, 0xB0, 0x02, 0xE3,
+    0x5F, 0x06, 0xD9, 0xE6, 0xA2, 0xFB, 0xB6, 0x68, 0xC2, 0xEF, 0x7C, 0x1D, 0x1A, 0x49, 0x38, 0x91,
+    0x60, 0x12, 0x49, 0x4F, 0x18, 0xDF, 0xF9, 0xA5, 0x4A, 0x16, 0xD3, 0x5A, 0x73, 0x74, 0x66, 0x73,
+    0xDE, 0x05, 0x23, 0x87, 0x99, 0x6E, 0x74, 0x81, 0x59, 0xCF, 0x98, 0xC1, 0x8E, 0x4C, 0xC8, 0xAD,
+    0x2E, 0x68, 0x91, 0x4C, 0x79, 0x27, 0x6F, 0xEF, 0x02, 0xA7, 0x8B, 0x16, 0xF3, 0x66, 0x4F, 0x21,
+    0x03, 0x7C, 0xE2, 0xCA, 0x9D, 0xC5, 0xD7, 0x32, 0x63, 0x6F, 0x8A, 0xAF, 0x43, 0xC6, 0xF4, 0x0E,
+    0x1D, 0xEB, 0x40, 0x36, 0x03, 0xF6, 0x85, 0x48, 0x21, 0x3D, 0x34, 0x7E, 0xA9, 0xE4, 0x76, 0x80,
+    0x4A, 0x5A, 0xDC, 0xCD, 0x19, 0xE7, 0x9B, 0xDE, 0xB6, 0x3A, 0x55, 0x03, 0x93, 0x92, 0x7F, 0x35,
+    0x2F, 0x48, 0x7D, 0xF7, 0x83, 0xED, 0x5F, 0xE5, 0x00, 0x30, 0xC3, 0x8A, 0xC0, 0x1E, 0x0D, 0x48,
+    0xF7, 0x66, 0x7D, 0xCA, 0xB3, 0x8C, 0x2C, 0xF3, 0x1A, 0x40, 0x8A, 0x7B, 0xB9, 0xBE, 0x7B, 0xB2,
+    0x88, 0x5F, 0x65, 0xE9, 0x9B, 0x70, 0x80, 0xEE, 0x81, 0x04, 0xFC, 0xDC, 0x9D, 0x8D, 0x71, 0x7A,
+    0xFD, 0x77, 0x06, 0xA8, 0xFD, 0xB2, 0x97, 0xD5, 0xB6, 0xBF, 0x3D, 0x09, 0x4A, 0x64, 0x28, 0x66,
+    0x19, 0x55, 0x36, 0x81, 0x49, 0x47, 0x9C, 0xCA, 0x98, 0x30, 0x53, 0xDC, 0x92, 0xA5, 0x61, 0x2F,
+    0x47, 0x28, 0x87, 0x15, 0xC3, 0xE9, 0x12, 0x7A, 0x96, 0x41, 0x8F, 0xE5, 0x54, 0x24, 0x5C, 0x7B,
+    0x80, 0xE9, 0xEB, 0x1F, 0x7F, 0x69, 0x28, 0x44, 0x06, 0xAA, 0xD9, 0x1F, 0xDD, 0xB7, 0x1C, 0x58,
+    0x77, 0x07, 0x97, 0x32, 0x50, 0x5F, 0x1E, 0xA0, 0xE8, 0xB7, 0x96, 0xED, 0x6C, 0xFC, 0x66, 0xA3,
+    0x64, 0x32, 0x32, 0x54, 0xE2, 0xBB, 0x84, 0x0D, 0x6A, 0x42, 0x67, 0x6C, 0xC0, 0xB5, 0x3A, 0x53,
+    0x8E, 0xB8, 0x96, 0xCE, 0x97, 0x23, 0x95, 0x88, 0x78, 0x44, 0x24, 0x62, 0x7E, 0xB8, 0x11, 0xD4,
+    0x84, 0x19, 0xEE, 0xFA, 0x40, 0xD0, 0x99, 0x32, 0xE1, 0x42, 0x29, 0xA3, 0x13, 0xDF, 0x49, 0x29,
+    0xE3, 0xB2, 0x3D, 0x3A, 0x4F, 0x25, 0x70, 0x6D, 0x8F, 0x2A, 0x3C, 0x73, 0x07, 0x0B, 0x68, 0xA9,
+    0xE7, 0x65, 0x86, 0x34, 0x3D, 0x34, 0x50, 0xA4, 0x13, 0x98, 0x37, 0x66, 0x9C, 0xCB, 0x6A, 0x7E,
+    0x27, 0x96, 0x73, 0x1D, 0xEC, 0xD0, 0x21, 0x3A, 0xE9, 0x64, 0x42, 0x1D, 0x1A, 0xBA, 0x22, 0xE9,
+    0x64, 0xDE, 0x30, 0xBD, 0xCB, 0x0D, 0xF2, 0xBD, 0x5C, 0x4C, 0xDB, 0x1A, 0xBE, 0xB3, 0x39, 0x57,
+    0x4B, 0x2F, 0x33, 0xDD, 0x58, 0x49, 0x5B, 0x64, 0xEA, 0x5E, 0x35, 0xDF, 0xFD, 0x8D, 0xD9, 0x77,
+    0x22, 0x32, 0xD1, 0xB4, 0x3A, 0x51, 0x8D, 0x34, 0x9E, 0x4E, 0x64, 0xC4, 0x88, 0x08, 0xCC, 0x9B,
+    0xA7, 0x22, 0x75, 0xCF, 0x4C, 0x91, 0xA9, 0x7B, 0x5C, 0x28, 0x32, 0x3A, 0xE3, 0x02, 0x4D, 0xAB,
+    0x33, 0x8D, 0x9C, 0x95, 0xB1, 0x92, 0xD8, 0x88, 0xE7, 0x24, 0xD8, 0x84, 0x92, 0x01, 0x5C, 0xCB,
+    0xC7, 0xE7, 0x17, 0x11, 0x09, 0xD8, 0x16, 0xA6, 0x4F, 0xF4, 0xFA, 0x3D, 0x09, 0xF5, 0x4D, 0xA1,
+    0x7B, 0x3B, 0x17, 0x52, 0x45, 0x13, 0x5D, 0xEB, 0xDA, 0x49, 0xE5, 0x72, 0x19, 0x7E, 0xDA, 0xE9,
+    0xE1, 0x49, 0xCB, 0xAB, 0xD1, 0xCC, 0x36, 0xD8, 0x25, 0x8F, 0xFF, 0x9C, 0xA2, 0x7E, 0xAF, 0x37,
+    0x12, 0xF5, 0xE1, 0xB8, 0xEC, 0x72, 0x76, 0x36, 0xE7, 0x4A, 0x49, 0x74, 0x89, 0x2A, 0xA2, 0x33,
+    0x2C, 0xFC, 0x59, 0xDD, 0x1F, 0x7B, 0xDF, 0x78, 0xEC, 0xF6, 0xBD, 0x9A, 0x29, 0x65, 0x2C, 0x64,
+    0x82, 0x2B, 0xBB, 0xF5, 0x7B, 0xFD, 0x6D, 0xD1, 0x87, 0xE3, 0xB2, 0x7F, 0x14, 0xE5, 0x8C, 0x4B,
+    0x98, 0x1E, 0x87, 0xCA, 0x54, 0x03, 0xCE, 0x93, 0x29, 0x23, 0xF6, 0xF7, 0x90, 0x51, 0x4B, 0x58,
+    0x41, 0xAE, 0x87, 0x36, 0x58, 0xE9, 0xAB, 0x95, 0x96, 0x83, 0x87, 0x36, 0xBE, 0x96, 0xA1, 0x90,
+    0x01, 0x1B, 0x30, 0x11, 0x9D, 0x8E, 0xEE, 0xBB, 0x7D, 0xAF, 0x26, 0xE8, 0xB6, 0xEF, 0xCB, 0x44,
+    0x2D, 0x7D, 0x25, 0x23, 0xA5, 0x44, 0x27, 0x61, 0xB3, 0x59, 0xB2, 0x56, 0x33, 0x68, 0x69, 0x99,
+    0xD0, 0x91, 0x3A, 0x70, 0x80, 0x1E, 0x31, 0x81, 0x86, 0x22, 0xB5, 0x46, 0xBC, 0xCB, 0x74, 0x4B,
+    0x7B, 0xF3, 0x29, 0x45, 0xAD, 0x42, 0x79, 0x3B, 0x22, 0xC3, 0xDA, 0xD9, 0x7C, 0x74, 0x3F, 0x28,
+    0x38, 0x45, 0x38, 0xF8, 0x92, 0x92, 0xC8, 0x7F, 0xFB, 0x70, 0x7E, 0xD8, 0x6C, 0x94, 0xCC, 0x74,
+    0x69, 0x09, 0x65, 0x5C, 0x8B, 0x6B, 0x69, 0x3C, 0x1D, 0x08, 0xCC, 0xA8, 0x89, 0x62, 0x62, 0x09,
+    0x8F, 0x32, 0xD1, 0x88, 0xEF, 0xC4, 0x73, 0x06, 0x22, 0x45, 0xA4, 0xF8, 0xC0, 0x23, 0xC7, 0x18,
+    0x06, 0x9D, 0xB9, 0x06, 0x28, 0x9A, 0xC1, 0x25, 0x26, 0x1C, 0x75, 0xA8, 0x06, 0xBD, 0x72, 0xC6,
+    0xBF, 0x67, 0xE4, 0xAC, 0xB4, 0x9D, 0xAF, 0x7C, 0xD9, 0xEA, 0xC0, 0xEC, 0x6D, 0x8F, 0x3F, 0x3E,
+    0x14, 0x0D, 0x4B, 0x1E, 0xFE, 0x88, 0x46, 0xED, 0xD6, 0xC9, 0x25, 0x3D, 0xEA, 0x58, 0xC6, 0x6A,
+    0x30, 0xBD, 0x09, 0x75, 0xB0, 0xBF, 0xE7, 0x26, 0x97, 0xED, 0x00, 0x6C, 0x36, 0x3B, 0x9B, 0x73,
+    0xB5, 0xBC, 0x2D, 0x33, 0x5D, 0xDA, 0x6E, 0x95, 0x35, 0xF2, 0xD3, 0x72, 0x17, 0x9D, 0x28, 0x97,
+    0xAD, 0x42, 0x15, 0x31, 0x71, 0xB9, 0x99, 0xD9, 0x6E, 0x95, 0x89, 0xBA, 0xC7, 0xDE, 0xB5, 0x55,
+    0x12, 0x8D, 0xF8, 0xC6, 0x57, 0x32, 0x56, 0x91, 0x35, 0x99, 0x9F, 0xB6, 0x01, 0x4A, 0x19, 0xB7,
+    0xA8, 0x6A, 0x31, 0x1F, 0xE3, 0x60, 0xFA, 0x2A, 0x96, 0x49, 0x67, 0x35, 0x71, 0x8D, 0xBD, 0xB5,
+    0xE7, 0x50, 0x34, 0x83, 0x8D, 0x2E, 0xD9, 0xCC, 0x44, 0x83, 0xA3, 0x0E, 0x75, 0xA8, 0x86, 0x6A,
+    0xD0, 0xA3, 0x1E, 0x99, 0xC8, 0x34, 0x34, 0xD8, 0x60, 0x7F, 0xCF, 0x0C, 0x46, 0xCE, 0x8E, 0x5A,
+    0xAE, 0x67, 0xBA, 0xB6, 0x03, 0xDC, 0x32, 0x14, 0x7C, 0xCC, 0x0C, 0x18, 0x89, 0x14, 0x12, 0xC1,
+    0x5E, 0x39, 0xCA, 0x83, 0x7B, 0xCB, 0x7C, 0x87, 0xBB, 0x06, 0x4D, 0x15, 0x38, 0xC5, 0x95, 0xB5,
+    0x99, 0x5A, 0x31, 0x6B, 0x3B, 0xC3, 0x51, 0x6B, 0xEF, 0xC2, 0x52, 0xFE, 0xEE, 0x34, 0x84, 0x3F,
+    0xED, 0xA2, 0xAC, 0x90, 0xF8, 0xB6, 0xED, 0xD2, 0x89, 0xE2, 0x46, 0x5E, 0xFE, 0x5C, 0x33, 0x1F,
+    0x03, 0x91, 0x17, 0x38, 0xCC, 0x8E, 0x70, 0x31, 0xA1, 0xC6, 0xD3, 0x14, 0xFD, 0xA7, 0xB7, 0x88,
+    0x22, 0x85, 0x40, 0x25, 0x6B, 0xB7, 0xDC, 0xAD, 0x9E, 0x9B, 0x96, 0xD2, 0xAB, 0xF2, 0x72, 0x2B,
+    0x9D, 0x96, 0xAE, 0xBA, 0x8C, 0xCB, 0x9D, 0x4C, 0x0F, 0x75, 0xE0, 0x69, 0xE7, 0x11, 0x01, 0xC9,
+    0xEB, 0x5A, 0x37, 0xE7, 0x77, 0x36, 0x4A, 0x26, 0x37, 0xD3, 0x8D, 0x75, 0xC2, 0x06, 0x1B, 0x70,
+    0x41, 0xC0, 0x5D, 0x4E, 0xD0, 0x3C, 0x39, 0x40, 0xD7, 0x78, 0xE8, 0x26, 0x96, 0x4F, 0x21, 0x33,
+    0xA8, 0xA9, 0xF3, 0x14, 0xD9, 0x05, 0x74, 0xAE, 0x23, 0x3A, 0x99, 0x44, 0x99, 0xB4, 0xD0, 0x88,
+    0x92, 0xBE, 0x13, 0x9A, 0x2D, 0x74, 0xF7, 0x22, 0x6B, 0xA9, 0x56, 0x09, 0x28, 0xE2, 0x8A, 0x96,
+    0x2E, 0x4D, 0xFE, 0x49, 0x0A, 0x69, 0x95, 0x2C, 0x03, 0x70, 0x86, 0x06, 0x6C, 0xEB, 0xCD, 0x8D,
+    0xAC, 0x7F, 0x22, 0xED, 0xED, 0x57, 0x87, 0xA6, 0x4D, 0x36, 0xEC, 0x9B, 0xFE, 0x9A, 0xBE, 0x9D,
+    0x95, 0x44, 0x0E, 0xAE, 0xE1, 0x9E, 0x0C, 0xE6, 0xC6, 0xFC, 0x78, 0x74, 0x1F, 0xA4, 0x22, 0x03,
+    0x3C, 0x00, 0x55, 0x8F, 0x8A, 0xF0, 0x0A, 0x3C, 0x03, 0x27, 0x81, 0x5D, 0x1E, 0x13, 0x3F, 0xBB,
+    0xD1, 0x0D, 0xEE, 0xC9, 0xAC, 0xDF, 0x1F, 0xBC, 0x7B, 0x85, 0x52, 0xA0, 0x8B, 0x98, 0x9B, 0x2D,
+    0x79, 0x9F, 0xFA, 0xD5, 0xF8, 0x6C, 0x76, 0x93, 0xFD, 0x8A, 0x1C, 0xAE, 0xD1, 0xB7, 0xBC, 0x3E,
+    0xBD, 0x78, 0x4C, 0x02, 0x66, 0x84, 0x4F, 0x6D, 0xD3, 0x1B, 0x4A, 0x26, 0x0A, 0xE9, 0x29, 0xF2,
+    0x82, 0x00, 0xB8, 0x16, 0x35, 0x2D, 0x9E, 0xB5, 0x01, 0x64, 0x71, 0x78, 0xDD, 0x43, 0xC7, 0xC7,
+    0x74, 0x26, 0x99, 0x58, 0xF6, 0xCD, 0xD7, 0x9A, 0x5A, 0x24, 0x2D, 0x5D, 0x33, 0xFC, 0x0A, 0xF5,
+    0x50, 0x4F, 0xFA, 0x16, 0xBB, 0x70, 0x92, 0x6E, 0xA8, 0x67, 0x4C, 0x4F, 0xA6, 0x0E, 0x45, 0xC2,
+    0xB5, 0x7A, 0xA4, 0xA1, 0x8A, 0xDC, 0x75, 0xF5, 0xD7, 0xB5, 0x04, 0x97, 0xF4, 0xB4, 0x1D, 0x3A,
+    0x4B, 0x19, 0xA9, 0xC4, 0x53, 0xC5, 0x25, 0xBA, 0xE6, 0x25, 0xB8, 0x6C, 0x80, 0x6E, 0xE9, 0x87,
+    0xCD, 0x00, 0x8D, 0xA7, 0xC8, 0x7C, 0xCE, 0x44, 0x3D, 0xB8, 0x50, 0x3F, 0x36, 0x6F, 0x72, 0x23,
+    0xF2, 0xBD, 0x65, 0x10, 0x82, 0x62, 0x09, 0x05, 0xDC, 0x82, 0x34, 0xD5, 0x1E, 0x7E, 0x13, 0xD8,
+    0xA1, 0x1B, 0x9A, 0x63, 0x79, 0x27, 0x31, 0xAD, 0x5A, 0x95, 0x6D, 0x0A, 0x6A, 0xCD, 0x1B, 0x5A,
+    0x82, 0x0C, 0xAE, 0x07, 0xD5, 0x92, 0xD8, 0xC3, 0x60, 0xBC, 0x3A, 0xB6, 0x65, 0x36, 0xE7, 0xCF,
+    0x28, 0x99, 0x2E, 0xD0, 0x8D, 0xAF, 0x60, 0x43, 0xC4, 0x85, 0x73, 0xB8, 0x76, 0x69, 0xB9, 0xBA,
+    0x35, 0x5A, 0x65, 0x89, 0x58, 0x35, 0x41, 0x91, 0xF9, 0x9C, 0xCE, 0x24, 0x9D, 0xD5, 0x58, 0xDE,
+    0xFA, 0x8D, 0xD8, 0x88, 0x0C, 0x9D, 0x48, 0xCF, 0xC9, 0x13, 0xD5, 0x6C, 0xEB, 0x79, 0x8F, 0xE9,
+    0x0C, 0xF9, 0x82, 0xCA, 0x57, 0x8B, 0xF4, 0xB0, 0x4E, 0xE8, 0x91, 0x32, 0x52, 0x45, 0xCC, 0x80,
+    0xE9, 0x31, 0x81, 0x15, 0xF4, 0xF9, 0x75, 0x5C, 0xC6, 0xA5, 0x05, 0x4C, 0x5C, 0x69, 0xA5, 0xE9,
+    0x18, 0xAD, 0x14, 0x58, 0xCD, 0xB8, 0x40, 0xA7, 0x32, 0x5D, 0x91, 0x11, 0xC6, 0xBF, 0xD9, 0x0C,
+    0xAA, 0x99, 0x7A, 0x61, 0x0C, 0x32, 0x2A, 0x53, 0x24, 0xB6, 0x66, 0xEC, 0x57, 0xEF, 0x66, 0xF3,
+    0x76, 0x36, 0xFD, 0x8B, 0x7F, 0x9D, 0x19, 0x3F, 0xED, 0x81, 0xFD, 0x38, 0x60, 0xC5, 0x23, 0x03,
+    0x65, 0x5E, 0x06, 0x88, 0xEE, 0xAF, 0x7E, 0x60, 0x3B, 0xD8, 0x54, 0x4A, 0xAB, 0x47, 0x1C, 0x65,
+    0xE4, 0x00, 0x33, 0x20, 0x43, 0x9D, 0x8A, 0xAC, 0xA4, 0x75, 0xA3, 0xDA, 0x5E, 0x7D, 0x03, 0x89,
+    0x66, 0x46, 0xFC, 0xF1, 0xE1, 0xEA, 0x69, 0x00, 0xDB, 0xB2, 0xB0, 0x46, 0x2C, 0xC4, 0xCD, 0x17,
+    0xB6, 0x3F, 0xDD, 0x39, 0xCF, 0x43, 0xE7, 0x95, 0x0C, 0x95, 0xF4, 0x95, 0xF0, 0xA5, 0x11, 0x3B,
+    0x92, 0xD1, 0x12, 0x4C, 0xC0, 0x4D, 0x2A, 0x51, 0xCA, 0x50, 0x7B, 0x2E, 0x4A, 0x11, 0xA9, 0x5E,
+    0x4D, 0x0E, 0xB2, 0x3B, 0x8C, 0x98, 0xEB, 0xF3, 0x25, 0x54, 0x32, 0xB7, 0x7B, 0xAC, 0xEF, 0x32,
+    0x3A, 0x6A, 0x09, 0x38, 0x6C, 0xA2, 0x8C, 0x48, 0x5B, 0x48, 0x6F, 0x46, 0xBA, 0x89, 0xE6, 0x2E,
+    0x12, 0xFD, 0xC1, 0x25, 0x41, 0x95, 0x71, 0x89, 0xBC, 0x08, 0xC5, 0x3A, 0xAD, 0x28, 0x9A, 0x5E,
+    0xB4, 0xBC, 0x30, 0x33, 0xDF, 0x4E, 0x5A, 0xAA, 0xC1, 0x8C, 0xCE, 0x37, 0x6D, 0x2E, 0x72, 0x19,
+    0xCD, 0xE0, 0x5A, 0xE7, 0x27, 0x95, 0xCB, 0x77, 0x1F, 0x8F, 0xF5, 0x6C, 0x43, 0x37, 0x4E, 0xAC,
+    0x45, 0x61, 0xE3, 0xD5, 0xC6, 0xD7, 0x33, 0xDD, 0x44, 0x17, 0xEF, 0x13, 0x5F, 0x88, 0x37, 0x01,
+    0x97, 0xC9, 0x68, 0xE9, 0xEB, 0x96, 0x66, 0x56, 0x23, 0xE5, 0x5B, 0xD1, 0xC2, 0x7E, 0x73, 0x39,
+    0x62, 0x0E, 0xB3, 0x83, 0x5C, 0xFF, 0x68, 0xA0, 0x6E, 0xE5, 0x1A, 0xC5, 0x58, 0x49, 0xC0, 0xE1,
+    0x32, 0x3A, 0x16, 0xD2, 0xD2, 0x60, 0x12, 0x76, 0x42, 0x7C, 0x25, 0x7D, 0x19, 0xB7, 0xB3, 0x54,
+    0xE5, 0x59, 0x07, 0x9B, 0x85, 0xFF, 0x5B, 0xF4, 0x01, 0x67, 0x00, 0xEE, 0xFB, 0x99, 0x96, 0x50,
+    0xB4, 0x4B, 0xFF, 0xBF, 0xBF, 0x8C, 0x00, 0xA7, 0xB6, 0x44, 0xFD, 0x0A, 0x29, 0xEF, 0x01, 0x7B,
+    0x26, 0x40, 0x71, 0x7B, 0x58, 0xC7, 0x64, 0xD6, 0xCA, 0xF7, 0xFF, 0xF3, 0xF1, 0xFD, 0x9C, 0xEA,
+    0xB9, 0x60, 0xE1, 0xC7, 0x91, 0x42, 0x3C, 0x7A, 0x84, 0xFB, 0xDA, 0xB5, 0x18, 0xF9, 0x7A, 0x74,
+    0x41, 0x7E, 0x24, 0xAD, 0x3B, 0x98, 0x91, 0x1B, 0x49, 0x4F, 0xA6, 0xAF, 0x07, 0x47, 0xA7, 0xB2,
+    0x4E, 0x66, 0x30, 0xBD, 0xF3, 0x8D, 0xCA, 0xFF, 0x22, 0x97, 0xF2, 0x7C, 0xB4, 0x93, 0xF3, 0x0B,
+    0x09, 0x59, 0x5C, 0x61, 0x49, 0x9E, 0x94, 0x71, 0x3B, 0x72, 0x54, 0x01, 0x30, 0xED, 0xAE, 0xC2,
+    0xD5, 0xD9, 0xF6, 0xA7, 0x5D, 0x96, 0x48, 0x71, 0xFB, 0x9D, 0x48, 0x21, 0x8F, 0x47, 0xF4, 0x5C,
+    0x0D, 0xE8, 0x6C, 0x7A, 0xCA, 0xD1, 0x04, 0xAA, 0x58, 0x07, 0xAA, 0xC1, 0xB6, 0x98, 0xDE, 0xFD,
+    0x3A, 0xA6, 0x77, 0x99, 0x3A, 0xB8, 0x84, 0x6D, 0xD7, 0xCD, 0x77, 0x0F, 0xC3, 0xA3, 0xBB, 0x13,
+    0x1E, 0x7B, 0xC0, 0xC7, 0xAA, 0xC0, 0x8A, 0x53, 0xDB, 0x19, 0xE0, 0xC0, 0x03, 0xBB, 0x4A, 0xC9,
+    0xD9, 0xEC, 0x6E, 0xC9, 0xE0, 0x0E, 0x66, 0x2D, 0xD5, 0xE0, 0xFA, 0xA9, 0x4C, 0x26, 0x74, 0x2A,
+    0x9B, 0xC1, 0xB6, 0x93, 0x4E, 0x75, 0x70, 0x2A, 0x97, 0xD1, 0x86, 0x03, 0x3D, 0x9A, 0x1E, 0x95,
+    0xC1, 0xB6, 0xC5, 0xE5, 0x48, 0x33, 0x51, 0x4A, 0x4B, 0x7D, 0x65, 0x45, 0x1A, 0xAD, 0xF4, 0x14,
+    0x72, 0x9C, 0xDB, 0xB8, 0xEF, 0x0F, 0xC1, 0xC8, 0x44, 0x29, 0x32, 0x2A, 0x79, 0x4C, 0x42, 0x13,
+    0xF4, 0x64, 0x46, 0xEC, 0xDB, 0x42, 0x31, 0xDB, 0xFE, 0x8E, 0x02, 0xC1, 0x7E, 0x3F, 0xA3, 0x27,
+    0x17, 0x70, 0x87, 0x99, 0x2A, 0xB9, 0x5E, 0x49, 0x21, 0x34, 0xBD, 0x99, 0xBB, 0x91, 0x46, 0xA6,
+    0xB5, 0xB4, 0x03, 0xD4, 0x12, 0x0A, 0xC9, 0x0B, 0x03, 0xF7, 0x51, 0xA9, 0xD7, 0x2B, 0x27, 0xA0,
+    0x56, 0x01, 0x35, 0xE7, 0x95, 0x01, 0x7B, 0x88, 0x7B, 0xA8, 0x9C, 0xE0, 0x04, 0xA8, 0xE1, 0xEF,
+    0x61, 0x7F, 0x3F, 0x20, 0x0B, 0xBB, 0xF2, 0x33, 0xB0, 0xC6, 0xBB, 0xF0, 0xC9, 0xA2, 0xA7, 0xC8,
+    0xAE, 0xC5, 0xBD, 0x99, 0xD1, 0xA9, 0xF1, 0x7C, 0x4C, 0x6D, 0xEF, 0xF5, 0xF1, 0xAF, 0x2F, 0x4E,
+    0x57, 0x22, 0x13, 0xF5, 0x58, 0x67, 0x25, 0x98, 0xD1, 0x8C, 0xD8, 0xA1, 0x09, 0x74, 0x5F, 0x99,
+    0x28, 0x66, 0x13, 0xA9, 0x92, 0x0B, 0xD8, 0x41, 0x40, 0xCE, 0x66, 0x74, 0x36, 0x11, 0x3B, 0xB8,
+    0x5E, 0x09, 0x5D, 0xA8, 0x47, 0xE4, 0x1D, 0xF1, 0x4A, 0x64, 0x3C, 0xE6, 0x78, 0xF0, 0xE7, 0x28,
+    0x0F, 0x7B, 0x9C, 0xF5, 0xFA, 0xDD, 0x44, 0x6D, 0x3C, 0x5F, 0xFE, 0xDC, 0x11, 0x22, 0x65, 0x27,
+    0x4A, 0xC9, 0x34, 0xCF, 0x25, 0x9D, 0x4C, 0xAC, 0x83, 0x0D, 0x33, 0x9D, 0x1E, 0x75, 0x32, 0xBD,
+    0xE9, 0x1B, 0xDF, 0x30, 0xE9, 0x51, 0x4F, 0x4D, 0x28, 0x25, 0x2D, 0xF0, 0xD2, 0xDD, 0x1C, 0x98,
+    0x1E, 0x97, 0x96, 0x11, 0x69, 0x8F, 0x91, 0x60, 0xBF, 0xF3, 0x75, 0x0A, 0x91, 0x44, 0x33, 0x77,
+    0xBD, 0xB2, 0xD7, 0x05, 0x9D, 0x4C, 0xC4, 0xB5, 0x1D, 0xE5, 0x68, 0x22, 0x9D, 0x9A, 0xA8, 0xDE,
+    0xED, 0x16, 0x50, 0xD0, 0xC8, 0x80, 0x9A, 0x3A, 0xB0, 0x87, 0x09, 0x9D, 0x6D, 0x8F, 0x6B, 0x85,
+    0x32, 0x55, 0x53, 0x29, 0xD1, 0xA6, 0x4E, 0xB6, 0x83, 0xD9, 0xCA, 0x84, 0xE9, 0xBF, 0xCC, 0x84,
+    0xED, 0x9E, 0x28, 0xA7, 0xFA, 0x50, 0x5E, 0x88, 0xD5, 0x5B, 0xB9, 0xB8, 0xFD, 0x35, 0xA4, 0xC5,
+    0x05, 0xEA, 0x81, 0x6A, 0x19, 0x17, 0xA7, 0xA5, 0xFB, 0x0B, 0x0B, 0x86, 0xF4, 0x0B, 0xDF, 0xF2,
+    0x58, 0x91, 0xB6, 0x94, 0x77, 0x26, 0x7E, 0x3E, 0xD7, 0x11, 0xD7, 0x0A, 0x3A, 0x55, 0x91, 0xC6,
+    0x0B, 0x55, 0xAC, 0x7B, 0xBA, 0x4F, 0x2C, 0x60, 0x3A, 0x32, 0x43, 0xFD, 0x27, 0x71, 0x7D, 0x6C,
+    0x37, 0xA6, 0x65, 0x25, 0x4D, 0xDB, 0xF5, 0x8D, 0x14, 0xF2, 0xBC, 0xC4, 0xB5, 0xAB, 0xE6, 0xE3,
+    0x5B, 0xC8, 0xC5, 0x02, 0x7A, 0x38, 0x0E, 0xB9, 0x9C, 0x50, 0x34, 0xAF, 0x67, 0x33, 0x37, 0xA1,
+    0x7A, 0x2B, 0x73, 0xF0, 0x43, 0x6F, 0x12, 0x08, 0xD4, 0x03, 0x45, 0x06, 0xD7, 0xA2, 0x47, 0x68,
+    0x96, 0xA4, 0xB5, 0x96, 0x9F, 0x2F, 0xB0, 0x95, 0x8B, 0x99, 0x25, 0x7D, 0xEF, 0xDE, 0xA9, 0xBB,
+    0x65, 0x4F, 0x79, 0x3D, 0x2D, 0xC3, 0x03, 0xE2, 0x8F, 0x90, 0xD8, 0x7B, 0xE4, 0xF7, 0xBB, 0x21,
+    0xD9, 0x7E, 0x0B, 0xC9, 0xFA, 0xDD, 0x7A, 0x6C, 0xCC, 0xDC, 0x04, 0xDB, 0xC4, 0xEA, 0xFF, 0x9E,
+    0xD7, 0x33, 0x08, 0x34, 0xED, 0xEA, 0x67, 0x3D, 0xA2, 0x32, 0x74, 0x4B, 0x6F, 0x74, 0xF4, 0xF4,
+    0xE8, 0xA0, 0x4E, 0x28, 0xF1, 0x47, 0x38, 0xE5, 0x37, 0xAF, 0x60, 0x25, 0x16, 0x22, 0x7D, 0xDD,
+    0x5B, 0x3A, 0xF6, 0x75, 0x2E, 0xFA, 0x2A, 0x43, 0x3D, 0x2D, 0x39, 0xCF, 0x0A, 0xD4, 0x33, 0x54,
+    0x59, 0x07, 0x13, 0x2D, 0x36, 0x4C, 0x88, 0x9E, 0x9F, 0x1A, 0x8D, 0x88, 0x2F, 0x8F, 0xAB, 0x1B,
+    0x8B, 0x80, 0x5A, 0x9E, 0xF7, 0x35, 0x38, 0x73, 0x84, 0x78, 0x79, 0x2A, 0xC1, 0x48, 0x6F, 0x5E,
+    0x8F, 0x3A, 0x82, 0x78, 0xEA, 0xB4, 0xC0, 0x3D, 0x63, 0xC1, 0x5C, 0x44, 0xDB, 0xCA, 0x53, 0xC1,
+    0x49, 0x5F, 0x1C, 0x17, 0x05, 0xEC, 0x43, 0x95, 0x61, 0x4E, 0x98, 0xD7, 0x23, 0xCF, 0x14, 0xED,
+    0xDF, 0xA9, 0xB1, 0xE7, 0x16, 0x9A, 0xA8, 0xE7, 0x62, 0xE6, 0x8C, 0xE1, 0x91, 0x45, 0xD4, 0xAC,
+    0xC0, 0x66, 0x9C, 0x78, 0xF7, 0x78, 0x30, 0x01, 0x3D, 0x41, 0x33, 0x50, 0xCD, 0xD0, 0xF4, 0xF7,
+    0xEB, 0x54, 0x85, 0x03, 0x3D, 0x35, 0x88, 0xF8, 0x6A, 0x9D, 0xED, 0x8B, 0x6F, 0x79, 0x3A, 0x09,
+    0x95, 0x88, 0x6F, 0xFC, 0x7E, 0x91, 0x8B, 0x68, 0x62, 0xE5, 0x6D, 0x84, 0x66, 0x84, 0x2E, 0x41,
+    0xB7, 0x2A, 0x20, 0x6C, 0x34, 0xB8, 0xB0, 0x4F, 0xA7, 0x47, 0x9D, 0xCD, 0xAD, 0xA6, 0x77, 0x32,
+    0x51, 0xAF, 0x94, 0x4E, 0xD5, 0x2E, 0x8F, 0x69, 0x6F, 0xE9, 0x9D, 0xAC, 0x67, 0x99, 0x47, 0x3D,
+    0x36, 0x23, 0x93, 0x1E, 0x2F, 0xE8, 0x88, 0x9E, 0x50, 0xD2, 0xD2, 0x0D, 0xD4, 0xE3, 0xFD, 0x3A,
+    0xD9, 0x22, 0xB9, 0x37, 0xA3, 0x5B, 0x38, 0x83, 0x45, 0x55, 0x9A, 0xE1, 0x34, 0x24, 0xCA, 0x61,
+    0x6D, 0x5D, 0xC0, 0xB0, 0x8F, 0xB9, 0x1C, 0x29, 0x6F, 0x86, 0x25, 0x4F, 0xBC, 0x72, 0xC7, 0x70,
+    0x2B, 0x91, 0x4E, 0x46, 0x35, 0x15, 0xB1, 0xC8, 0x45, 0xD4, 0xB9, 0xE8, 0x0B, 0x01, 0x25, 0xFD,
+    0x62, 0xBA, 0x95, 0x55, 0x88, 0xD2, 0x05, 0x83, 0x0B, 0x16, 0x1B, 0x9C, 0x77, 0xC1, 0xFD, 0x50,
+    0xBC, 0x93, 0x89, 0x23, 0x67, 0xFE, 0xA2, 0x6E, 0x75, 0x3F, 0x62, 0xF7, 0x40, 0x5A, 0xAA, 0x08,
+    0x77, 0xC6, 0x59, 0x9B, 0x31, 0xD2, 0xEB, 0xF1, 0x02, 0x6E, 0xE1, 0x42, 0xEA, 0x04, 0xDD, 0x80,
+    0x12, 0x7F, 0xBF, 0x4E, 0x45, 0xB4, 0xAD, 0x7B, 0x33, 0x6A, 0x99, 0x58, 0x57, 0xB1, 0xB3, 0xD9,
+    0x6C, 0x2A, 0x11, 0xF9, 0x8E, 0x88, 0x8C, 0xA9, 0xEE, 0xF7, 0x2F, 0x56, 0xD1, 0x1A, 0x9D, 0xCD,
+    0x63, 0x7E, 0x56, 0x2B, 0x11, 0xB4, 0x9D, 0xAF, 0xF3, 0x3A, 0x1D, 0x6F, 0x29, 0xA3, 0x2D, 0x7B,
+    0x6B, 0x64, 0xA0, 0x92, 0x35, 0xF3, 0x57, 0xED, 0x32, 0xBE, 0x71, 0x0A, 0xA8, 0x59, 0x9C, 0xBB,
+    0xC4, 0xE5, 0x0E, 0x6A, 0x05, 0x82, 0x2A, 0x19, 0x45, 0xAE, 0x37, 0xFF, 0x99, 0x89, 0x32, 0x62,
+    0x03, 0x1D, 0x3A, 0x61, 0x7A, 0x9A, 0xF2, 0x59, 0x99, 0x4B, 0x89, 0x4B, 0x73, 0xFD, 0xEF, 0x28,
+    0x32, 0x2A, 0x62, 0xBC, 0x1A, 0x8F, 0xA8, 0xF0, 0xB2, 0x3D, 0x83, 0x1A, 0x2F, 0x81, 0x3B, 0x58,
+    0xD9, 0x9E, 0x33, 0x47, 0x94, 0xE1, 0x79, 0x2B, 0x22, 0x4F, 0x8A, 0xC8, 0x77, 0x86, 0xE6, 0xF3,
+    0xEF, 0x8E, 0x36, 0xEC, 0x9F, 0x36, 0xF1, 0xCC, 0x8E, 0x4E, 0x3B, 0x2B, 0xB8, 0x70, 0xDC, 0xF2,
+    0xF4, 0x17, 0x11, 0x87, 0xB8, 0x48, 0x75, 0x16, 0x31, 0x1D, 0x0F, 0x42, 0x19, 0x28, 0x22, 0x27,
+    0x23, 0x97, 0x1E, 0xC5, 0xFD, 0x3A, 0x26, 0x60, 0xA5, 0x77, 0x12, 0x77, 0xE6, 0x73, 0x38, 0x4F,
+    0x1D, 0xA8, 0x22, 0xC5, 0x8A, 0x8F, 0x79, 0xEA, 0xEB, 0x43, 0x29, 0x49, 0x49, 0xC6, 0x8E, 0x7F,
+    0x4B, 0xE7, 0x16, 0xDD, 0x9F, 0x2F, 0x9C, 0xEF, 0x3F, 0x98, 0xFC, 0xDF, 0xE4, 0xDC, 0xBF, 0xC2,
+    0x7D, 0x85, 0x48, 0x25, 0xE9, 0xA7, 0xB9, 0x0F, 0xCE, 0xED, 0x82, 0x79, 0xAF, 0x87, 0x4E, 0x3C,
+    0xC5, 0x61, 0xBA, 0x33, 0x42, 0xA8, 0xCD, 0xB9, 0x87, 0x36, 0x56, 0x82, 0x4C, 0xCD, 0x54, 0xC8,
+    0x15, 0x17, 0x54, 0x66, 0xA6, 0x1A, 0xCA, 0x11, 0xD7, 0xDA, 0xC0, 0x84, 0xA0, 0xA3, 0xCE, 0xD4,
+    0xC1, 0x0C, 0x1C, 0xD0, 0x78, 0x3D, 0x16, 0x19, 0x13, 0x4C, 0xA4, 0xC1, 0x05, 0x9D, 0xE8, 0x5A,
+    0x1B, 0x94, 0x2C, 0xB4, 0xE1, 0x70, 0x5C, 0x5A, 0x50, 0x78, 0x4F, 0xF3, 0xBC, 0xD7, 0x37, 0x33,
+    0x0F, 0xD6, 0xFD, 0x56, 0x7D, 0x76, 0x02, 0xAA, 0x49, 0xE5, 0x66, 0x6D, 0x64, 0x1D, 0x59, 0xE5,
+    0x32, 0x56, 0x4B, 0x3F, 0x4F, 0xAE, 0x62, 0x19, 0x9B, 0x60, 0x9F, 0x93, 0x5F, 0x94, 0x7D, 0x79,
+    0x5F, 0x0E, 0xA5, 0xCC, 0xAB, 0x88, 0x49, 0x6D, 0xCE, 0xB1, 0x70, 0xC3, 0x9D, 0x1C, 0xAB, 0xC6,
+    0x9B, 0xF3, 0x3B, 0x9B, 0x27, 0x24, 0x3A, 0x79, 0x4A, 0x7C, 0xF7, 0x83, 0xC5, 0xAC, 0xB6, 0x48,
+    0x6A, 0xC2, 0x0C, 0x55, 0xC4, 0x79, 0x17, 0xC8, 0x08, 0x65, 0xD4, 0x09, 0xDB, 0xD6, 0x3D, 0x13,
+    0xDD, 0xD1, 0x9A, 0x22, 0x33, 0x76, 0xA8, 0x22, 0xCD, 0x42, 0xD6, 0x25, 0x8E, 0x09, 0x39, 0xEC,
+    0x22, 0x62, 0xBA, 0x43, 0x18, 0xD3, 0xF5, 0xF5, 0xAB, 0xD2, 0xCE, 0x4C, 0x7A, 0xD4, 0x71, 0x41,
+    0xC2, 0x0F, 0x74, 0xD2, 0xA3, 0xE9, 0x4D, 0xE8, 0x68, 0xCA, 0x5C, 0xA4, 0xE6, 0xDD, 0xAF, 0xDE,
+    0xFE, 0xB6, 0xB8, 0xEC, 0x62, 0x13, 0x0E, 0xB6, 0x8E, 0x00, 0x6A, 0xD5, 0x43, 0xD3, 0x01, 0x12,
+    0x81, 0xCD, 0xBD, 0xF7, 0xFF, 0x09, 0xE0, 0x6A, 0x89, 0xBE, 0xF5, 0x0A, 0xA5, 0x04, 0xEE, 0xFB,
+    0xC1, 0xCF, 0xE6, 0x7F, 0x7E, 0x69, 0x2B, 0x86, 0x7E, 0xE4, 0x11, 0x20, 0x3E, 0x0D, 0xC5, 0x9B,
+    0x61, 0xDD, 0x7B, 0xCA, 0xB3, 0xB3, 0xF1, 0x9B, 0xF3, 0x9D, 0x68, 0xF9, 0xB1, 0x8C, 0xD5, 0xEC,
+    0x8F, 0x7B, 0x7C, 0xA6, 0x43, 0x8F, 0xFA, 0x8E, 0xDD, 0xEB, 0x03, 0xEA, 0xAB, 0x88, 0xC3, 0x05,
+    0x95, 0x11, 0xCC, 0x50, 0xCC, 0x74, 0x94, 0x22, 0x09, 0x23, 0xD2, 0x52, 0xDD, 0x29, 0x71, 0x2A,
+    0x41, 0x9D, 0x21, 0xBE, 0x8C, 0xFE, 0x4A, 0x58, 0x24, 0x9B, 0x11, 0x76, 0x60, 0x17, 0xEC, 0x58,
+    0xBE, 0x2B, 0x5B, 0xFB, 0x75, 0x2C, 0x63, 0x1D, 0xEC, 0xF6, 0x19, 0xD9, 0x50, 0x5F, 0x17, 0x0E,
+    0xEA, 0xFC, 0x5B, 0xF3, 0xFB, 0xF2, 0x6D, 0x31, 0xB9, 0x8E, 0xB6, 0x3D, 0xA6, 0x64, 0x78, 0xA6,
+    0xF2, 0x54, 0x51, 0x40, 0x9E, 0x8A, 0x98, 0xB7, 0x27, 0xF8, 0x5C, 0xE9, 0x8F, 0x38, 0x99, 0x7B,
+    0xB5, 0x1C, 0x5A, 0x4F, 0x75, 0x39, 0x70, 0xC9, 0xA1, 0xDF, 0x1B, 0xB1, 0xB5, 0xE7, 0xC5, 0x2F,
+    0x6F, 0xBB, 0xE5, 0x8F, 0xB4, 0x9C, 0x87, 0x36, 0x6A, 0xF3, 0x2F, 0x25, 0x1B, 0x79, 0x53, 0x7A,
+    0x7B, 0xEB, 0xAE, 0x78, 0x49, 0x45, 0xC6, 0xF4, 0xE6, 0xC8, 0xB4, 0x6D, 0x78, 0x79, 0x7B, 0xB4,
+    0x31, 0x32, 0xAE, 0xAD, 0x52, 0x91, 0xA9, 0x45, 0x7A, 0x9C, 0x4C, 0x60, 0xA5, 0x5D, 0xA1, 0xC5,
+    0x9A, 0xB5, 0xA9, 0xD3, 0x1F, 0xF8, 0x55, 0xBE, 0xA6, 0x3E, 0xDA, 0x76, 0x68, 0x80, 0x97, 0xA1,
+    0xF4, 0x0B, 0x09, 0x37, 0xFB, 0x85, 0xE8, 0xBB, 0xD3, 0x5C, 0xAB, 0x25, 0x76, 0x9B, 0x1E, 0x56,
+    0x55, 0x0E, 0xE5, 0x90, 0x00, 0xAE, 0x16, 0xDB, 0xDF, 0x52, 0x9B, 0xF3, 0xF0, 0xD0, 0x79, 0x27,
+    0x6D, 0xAA, 0xE4, 0x86, 0x0C, 0x75, 0x6B, 0xC7, 0x6A, 0xD4, 0x99, 0x4C, 0xE3, 0x5D, 0xB0, 0x6D,
+    0x39, 0x56, 0x59, 0x47, 0x9C, 0x97, 0x70, 0x80, 0x1E, 0x6D, 0x36, 0x01, 0x77, 0xF6, 0xAD, 0x1B,
+    0x23, 0x3A, 0xED, 0x67, 0x07, 0xEE, 0xAB, 0x4F, 0xBE, 0xD6, 0x53, 0x7C, 0x10, 0xF7, 0x33, 0xD8,
+    0x83, 0xEA, 0xA6, 0xA7, 0x90, 0xD0, 0x45, 0xA8, 0x53, 0x39, 0x81, 0x5A, 0xA0, 0x56, 0x33, 0x94,
+    0x23, 0x90, 0x71, 0xC7, 0xB2, 0xCD, 0xCE, 0x16, 0x54, 0xAF, 0x32, 0x70, 0x31, 0x41, 0xF9, 0x7A,
+    0x84, 0x47, 0x8A, 0xF6, 0xE8, 0x6C, 0xC5, 0xAE, 0x0D, 0x07, 0xE5, 0x7B, 0xF2, 0x6C, 0x36, 0x43,
+    0xA7, 0x47, 0xDB, 0x66, 0xD3, 0x5F, 0xD3, 0xA3, 0xFB, 0x4A, 0xAC, 0xDE, 0x16, 0xD3, 0xD6, 0xCF,
+    0xE7, 0x8B, 0xEC, 0xB9, 0xF7, 0x23, 0x1F, 0xBC, 0xF3, 0x96, 0xD7, 0x62, 0x13, 0x66, 0xEC, 0x02,
+    0xEE, 0xF3, 0x19, 0x52, 0x79, 0x97, 0x3A, 0x53, 0x0F, 0xEB, 0x80, 0xE1, 0xAE, 0x41, 0x7D, 0x23,
+    0x52, 0x0C, 0x3F, 0x77, 0xAF, 0x44, 0xE3, 0x47, 0xFC, 0x6F, 0x21, 0xA0, 0x7E, 0x32, 0xA0, 0xC6,
+    0xD3, 0x70, 0xF5, 0x81, 0x3B, 0x63, 0x9C, 0xED, 0x1B, 0x6F, 0xB3, 0x19, 0xE8, 0x74, 0xC2, 0xF4,
+    0x07, 0xE8, 0xD1, 0x79, 0x0E, 0x4C, 0xA0, 0x7E, 0xAE, 0xA7, 0xFC, 0x5E, 0x84, 0x3C, 0x82, 0xDB,
+    0x5F, 0xD4, 0xD5, 0x7A, 0xDA, 0xB6, 0x09, 0x0B, 0x1F, 0x3B, 0x34, 0xD0, 0xAC, 0x4D, 0x62, 0x91,
+    0xEE, 0xB4, 0x9B, 0x16, 0xEA, 0x57, 0x23, 0x2A, 0x1D, 0xC0, 0xCE, 0x7A, 0x2C, 0xEE, 0xA1, 0x8D,
+    0xDA, 0x3C, 0x2E, 0x51, 0xB2, 0x4B, 0xE5, 0x8C, 0xE0, 0x7C, 0x15, 0xAB, 0x01, 0xE7, 0x33, 0x3A,
+    0x3B, 0xA8, 0x5F, 0xEB, 0x61, 0x4E, 0x5B, 0xC4, 0x3E, 0xAC, 0xAD, 0x46, 0xE3, 0x57, 0x00, 0x44,
+    0xD6, 0x35, 0x1A, 0x19, 0x58, 0x44, 0x92, 0xCB, 0xEB, 0xD1, 0xD5, 0x1C, 0x69, 0x97, 0x01, 0xE2,
+    0x53, 0xDB, 0x90, 0xDA, 0x9C, 0x53, 0x22, 0x42, 0x27, 0x12, 0x1C, 0xAE, 0x37, 0xAD, 0x1B, 0x8A,
+    0x60, 0xE3, 0x92, 0x65, 0xEA, 0x55, 0x64, 0x6B, 0xC6, 0x05, 0x2E, 0xAA, 0x32, 0x94, 0x59, 0xF5,
+    0x65, 0x26, 0xEB, 0x89, 0x4B, 0x7A, 0xDE, 0x34, 0x5E, 0x44, 0x82, 0x93, 0xBB, 0x8E, 0x1C, 0x0D,
+    0x60, 0x3D, 0x3A, 0xC2, 0xB4, 0xEC, 0xA2, 0x76, 0x1B, 0x22, 0x76, 0xCC, 0xA5, 0x48, 0x38, 0x90,
+    0x58, 0xB5, 0x13, 0x5F, 0x76, 0x9E, 0xAA, 0xA7, 0x18, 0xE1, 0x1A, 0x58, 0xDF, 0x56, 0x43, 0x5D,
+    0xC8, 0xED, 0xE8, 0x44, 0xF4, 0xDB, 0xDB, 0xD6, 0x7C, 0x67, 0xC5, 0xC9, 0xAA, 0xB8, 0xBA, 0x6F,
+    0xF7, 0x48, 0xD1, 0xE3, 0x4B, 0x91, 0x5C, 0x88, 0x08, 0x19, 0xF1, 0x7B, 0x48, 0x5B, 0xD1, 0x85,
+    0xC5, 0x2F, 0x4D, 0x58, 0xC4, 0xA0, 0xAE, 0x5F, 0x88, 0x97, 0x65, 0x4D, 0xA5, 0xAF, 0xA3, 0x8E,
+    0x66, 0x54, 0xC9, 0xDC, 0xDA, 0x4C, 0x5A, 0x44, 0x10, 0x39, 0x52, 0x4B, 0x9E, 0x03, 0xB7, 0x80,
+    0x48, 0x97, 0x8E, 0x9F, 0x19, 0xFA, 0x08, 0x46, 0x6F, 0x55, 0x76, 0xD9, 0x7A, 0xEA, 0x6E, 0x9D,
+    0x98, 0xED, 0xBD, 0x72, 0xFA, 0xA7, 0xCB, 0x56, 0x5F, 0x1F, 0xD9, 0xBB, 0x88, 0x12, 0x8F, 0x19,
+    0x16, 0xD1, 0x2D, 0xC0, 0x6E, 0x21, 0x4F, 0x86, 0x46, 0x72, 0x75, 0x53, 0x78, 0xC5, 0xF4, 0xA5,
+    0xDE, 0x5A, 0xBD, 0x2C, 0xE1, 0x7E, 0x0E, 0x54, 0xB4, 0xD2, 0x69, 0x91, 0xB8, 0x57, 0x6F, 0x21,
+    0xA1, 0x5F, 0xF0, 0xA0, 0x17, 0xCD, 0xB4, 0xA7, 0x48, 0xA7, 0x57, 0x9C, 0xB2, 0x63, 0x8D, 0x36,
+    0xD3, 0x6F, 0x85, 0x12, 0x79, 0x0B, 0xBC, 0xB9, 0x76, 0x25, 0x8D, 0xCA, 0xB8, 0xEA, 0x64, 0x39,
+    0xB8, 0xEB, 0xD7, 0x9B, 0xAD, 0x0A, 0xD8, 0x0C, 0x0B, 0x59, 0x56, 0x3C, 0x9B, 0xA1, 0xBE, 0xD9,
+    0xAF, 0xD4, 0x5C, 0xD7, 0x02, 0x27, 0xCB, 0xD0, 0xE8, 0x54, 0x85, 0x5F, 0x06, 0x78, 0xB4, 0xBA,
+    0x9E, 0x5D, 0x19, 0x1E, 0x86, 0x93, 0x34, 0xB8, 0x61, 0xEF, 0x82, 0x33, 0x2F, 0xD0, 0xC3, 0x7D,
+    0xFE, 0xB1, 0xF9, 0x33, 0x7B, 0x72, 0xF8, 0xDC, 0xC8, 0x09, 0xAC, 0x7C, 0x5B, 0xDE, 0xDE, 0x9C,
+    0xDB, 0xE5, 0x6A, 0x39, 0xFD, 0x6E, 0x93, 0x3F, 0x71, 0xE5, 0x44, 0x23, 0xD3, 0x2E, 0xA8, 0xB8,
+    0xEF, 0x9E, 0x3A, 0x7C, 0x37, 0x9D, 0x80, 0x4F, 0xBC, 0x21, 0x6F, 0x99, 0xF3, 0xA7, 0xAB, 0xFE,
+    0x15, 0xD5, 0x43, 0x39, 0xD4, 0xF9, 0xF4, 0xE9, 0x47, 0x3F, 0x73, 0xE6, 0x19, 0x1B, 0x95, 0xA7,
+    0xF5, 0xD5, 0x73, 0xE1, 0x92, 0xD3, 0xEF, 0xC5, 0xBD, 0x9A, 0xE1, 0xCB, 0x00, 0x9F, 0xAD, 0x7E,
+    0xB7, 0x7A, 0xF5, 0x4F, 0x82, 0x84, 0xBA, 0x2F, 0xAE, 0xC0, 0xEE, 0x33, 0x57, 0xF7, 0xD3, 0xE9,
+    0x0B, 0x8F, 0x9C, 0xF9, 0xD8, 0x2F, 0x03, 0xE7, 0x95, 0xDC, 0x90, 0x34, 0x9C, 0xDA, 0x2D, 0x80,
+    0xD3, 0xA6, 0x18, 0xCE, 0xE8, 0xC1, 0xE1, 0xCB, 0xBE, 0xD3, 0xF1, 0x4C, 0x75, 0x23, 0x7E, 0x9A,
+    0x53, 0xF6, 0xAB, 0x87, 0xC3, 0xBE, 0x51, 0xED, 0xC9, 0xBD, 0x33, 0x17, 0x5E, 0x89, 0xBB, 0x65,
+    0xBB, 0x6F, 0x6E, 0xC4, 0xD3, 0x0A, 0x4E, 0x75, 0xF3, 0x33, 0x0F, 0x14, 0x67, 0xC7, 0xEC, 0xEA,
+    0xEB, 0xED, 0x8B, 0x0F, 0x9C, 0x9D, 0x5F, 0x7E, 0xE7, 0xC1, 0x26, 0x9C, 0xBB, 0xEF, 0x6C, 0x4C,
+    0xA7, 0xCF, 0x9C, 0xA0, 0x6A, 0x27, 0xDD, 0xEF, 0xDB, 0xC2, 0x2B, 0x86, 0xD3, 0x65, 0x7B, 0x70,
+    0x39, 0x9F, 0xE0, 0xE3, 0xD5, 0x61, 0x4C, 0x17, 0xAD, 0x87, 0x93, 0x34, 0xDE, 0xC5, 0x4B, 0x97,
+    0x2E, 0x95, 0xFF, 0x03, 0x0F, 0x2F, 0xEB, 0xE9, 0x93, 0x5D, 0xB6, 0x03, 0x54, 0xCF, 0x7E, 0x45,
+    0x4E, 0x9F, 0x91, 0xC3, 0xB3, 0x11, 0xD8, 0xD9, 0x18, 0x79, 0x5F, 0x12, 0xE7, 0xEA, 0xDC, 0x48,
+    0xB4, 0xED, 0xC7, 0x00, 0x9E, 0xC1, 0x04, 0x3D, 0x72, 0x6D, 0xC1, 0x6F, 0xDE, 0x1E, 0x0F, 0xDC,
+    0xF3, 0x37, 0x22, 0x70, 0xC2, 0x94, 0xD7, 0x67, 0x77, 0x3C, 0x45, 0xD4, 0xDB, 0xAE, 0xC6, 0xF6,
+    0x2C, 0x3C, 0xCE, 0xDF, 0xB1, 0xDC, 0x6B, 0x67, 0xB3, 0xD9, 0x98, 0x75, 0x20, 0x88, 0xC9, 0x86,
+    0x7C, 0xA1, 0x8A, 0x7B, 0x46, 0x27, 0xB3, 0x66, 0xCC, 0x7F, 0xB2, 0x95, 0x35, 0x4A, 0xD0, 0xA9,
+    0x1E, 0x99, 0x98, 0x97, 0xE2, 0x16, 0xCC, 0x60, 0xA2, 0x4E, 0x3A, 0x31, 0x19, 0xE9, 0x9B, 0x4A,
+    0xA2, 0x0D, 0x60, 0x7A, 0x4E, 0x54, 0x11, 0xF3, 0x42, 0x44, 0x4B, 0x84, 0xAE, 0x3F, 0x5E, 0x45,
+    0x1E, 0x64, 0x99, 0x24, 0x9A, 0x61, 0xA9, 0xAC, 0xBF, 0xC4, 0x5D, 0x0B, 0xC2, 0x8A, 0x84, 0x22,
+    0xEB, 0x88, 0x90, 0x70, 0xED, 0x19, 0xEA, 0xFE, 0xC1, 0x65, 0x41, 0x3F, 0x95, 0x5D, 0x3D, 0x9A,
+    0xFE, 0x5A, 0x94, 0x08, 0x74, 0x4B, 0xDE, 0xF8, 0x9D, 0x2B, 0x14, 0x22, 0xA1, 0x14, 0x89, 0xE5,
+    0x44, 0x2E, 0x13, 0x7B, 0x3A, 0x63, 0xEE, 0x4C, 0x56, 0x92, 0x31, 0x32, 0xA3, 0xE7, 0x97, 0x56,
+    0x89, 0x51, 0xE0, 0x61, 0x33, 0x52, 0x2B, 0xF1, 0x75, 0x70, 0xB3, 0x0C, 0x5A, 0x64, 0xA0, 0xDE,
+    0x6A, 0xCA, 0xFE, 0x8E, 0x26, 0xFC, 0x8F, 0xC8, 0xDC, 0x03, 0xF5, 0xE3, 0xBD, 0xF9, 0x7E, 0xD2,
+    0x31, 0xB3, 0x7B, 0xE2, 0x67, 0x14, 0x85, 0xB0, 0xD9, 0xAC, 0x27, 0xB2, 0x56, 0x3E, 0xF3, 0x6E,
+    0xFA, 0xEC, 0xAF, 0x62, 0xF1, 0xD0, 0x2B, 0xE7, 0x5C, 0x8E, 0x2B, 0xDF, 0x3C, 0xF0, 0x19, 0x1B,
+    0x68, 0xA4, 0xA5, 0x99, 0x17, 0xA9, 0xD5, 0xF6, 0x94, 0xA0, 0x88, 0x44, 0xB0, 0x4B, 0x2E, 0x4C,
+    0x75, 0x00, 0x2E, 0x56, 0x11, 0xB0, 0x3A, 0x03, 0x26, 0xCC, 0x80, 0xEE, 0x1B, 0x0F, 0x2A, 0x5A,
+    0xE9, 0x21, 0x1B, 0x11, 0xB8, 0xA8, 0x93, 0x1D, 0xB0, 0x4C, 0x3A, 0x63, 0xDA, 0xC6, 0x77, 0x98,
+    0x60, 0x83, 0xBD, 0xFE, 0x44, 0x6F, 0xA2, 0x19, 0x24, 0xEA, 0x5C, 0x47, 0x17, 0x6B, 0x91, 0x68,
+    0x06, 0x23, 0x47, 0x82, 0x3F, 0x36, 0xE7, 0x77, 0x36, 0x5E, 0x49, 0x76, 0xD2, 0xD2, 0x8D, 0x76,
+    0x06, 0x1B, 0xAA, 0x08, 0xAE, 0x35, 0x11, 0x9C, 0x5F, 0x18, 0x53, 0xD3, 0x43, 0x47, 0x1D, 0xA0,
+    0x13, 0x91, 0x2B, 0x88, 0x88, 0x64, 0xE6, 0x4D, 0xF7, 0x1F, 0x66, 0x95, 0x69, 0xBC, 0x14, 0x99,
+    0x8E, 0x4E, 0x67, 0x3A, 0x44, 0x27, 0x66, 0x35, 0x95, 0x23, 0x73, 0x95, 0x1B, 0xA9, 0x44, 0x62,
+    0x27, 0x46, 0xB6, 0x22, 0xAA, 0x9D, 0xCD, 0x66, 0x83, 0x88, 0x4C, 0x5A, 0x44, 0xA2, 0xF9, 0x4A,
+    0x36, 0xE1, 0x42, 0x15, 0xF7, 0x88, 0xAE, 0x1D, 0x97, 0x80, 0x2A, 0x47, 0xC0, 0xDE, 0x9C, 0x41,
+    0x44, 0xD0, 0x53, 0x99, 0x97, 0x8E, 0xBC, 0xF1, 0x36, 0x14, 0x99, 0x0E, 0x13, 0x75, 0xC2, 0xB5,
+    0xF5, 0x60, 0xE4, 0x50, 0x62, 0x27, 0xF5, 0x9D, 0x32, 0x55, 0xFA, 0x95, 0xD3, 0x53, 0xD2, 0xAE,
+    0xA7, 0x3B, 0x8F, 0xE4, 0x84, 0x9B, 0xF3, 0x7C, 0x43, 0xC9, 0x54, 0xCE, 0x74, 0xA3, 0x99, 0xB0,
+    0xC1, 0xFD, 0x1B, 0x5C, 0xC8, 0xE0, 0x9E, 0x1D, 0xA1, 0x39, 0x3B, 0x40, 0x67, 0xC2, 0x3A, 0x95,
+    0x8A, 0x78, 0x98, 0x6C, 0x8B, 0x9A, 0xEA, 0x40, 0x91, 0xCD, 0x80, 0xCE, 0x55, 0x44, 0x27, 0x9D,
+    0x28, 0x53, 0x31, 0xD1, 0x08, 0xE2, 0x3B, 0xA1, 0x69, 0xF9, 0x4B, 0xAC, 0xE2, 0xD2, 0x17, 0x55,
+    0x99, 0xED, 0x39, 0x11, 0xB6, 0xBA, 0x4D, 0x78, 0x68, 0xC3, 0xE6, 0xBC, 0x92, 0xC9, 0x48, 0x2C,
+    0xA4, 0xB7, 0x5B, 0xA5, 0xD4, 0x22, 0x0A, 0x71, 0xAD, 0xC9, 0xA8, 0x49, 0x49, 0xA4, 0x8A, 0xB5,
+    0xB4, 0xD8, 0x1B, 0x1F, 0x4C, 0x20, 0xF6, 0xF9, 0x88, 0xBE, 0x3D, 0xBA, 0x40, 0x2D, 0x7E, 0x86,
+    0x2E, 0x96, 0x23, 0x5A, 0xB0, 0x3D, 0x26, 0xD2, 0xB1, 0xA8, 0xAB, 0x56, 0xBD, 0xD6, 0xA2, 0x13,
+    0x5B, 0xB0, 0xCF, 0xA2, 0xC5, 0x84, 0x67, 0x40, 0xBA, 0x15, 0x8B, 0x5A, 0xB5, 0xCE, 0x6A, 0x73,
+    0xEE, 0xA1, 0xF3, 0x4E, 0xB4, 0xBC, 0x21, 0x7D, 0x9D, 0xAA, 0x91, 0x8C, 0xF3, 0xD6, 0xEB, 0xA4,
+    0x23, 0x36, 0x64, 0x54, 0xAE, 0x3D, 0xE6, 0x3B, 0x11, 0x0E, 0xF6, 0x57, 0x5D, 0xA6, 0xDB, 0x66,
+    0x0D, 0xEB, 0x29, 0xCA, 0x61, 0x51, 0x3C, 0x98, 0x79, 0x85, 0x61, 0x8E, 0x85, 0x53, 0x2D, 0xDF,
+    0x91, 0xBC, 0x44, 0x53, 0x91, 0x69, 0x3C, 0x2E, 0x2C, 0x40, 0xB6, 0x40, 0xE3, 0x4D, 0x5C, 0x88,
+    0x7C, 0xBA, 0x65, 0xD9, 0x0B, 0xDE, 0xE2, 0x02, 0x75, 0xAF, 0xD3, 0x9D, 0x0F, 0x8C, 0xE8, 0x44,
+    0x07, 0xCD, 0xD7, 0x9E, 0x8A, 0x34, 0x22, 0x32, 0x54, 0x22, 0x32, 0xAD, 0x20, 0xF5, 0xD2, 0xCB,
+    0xEB, 0x7E, 0xAB, 0x05, 0x44, 0x87, 0x2D, 0x1F, 0xC9, 0x2F, 0xC2, 0x19, 0x70, 0x60, 0x03, 0x65,
+    0xCF, 0xCA, 0x50, 0x7C, 0x18, 0x45, 0xF3, 0x49, 0xE8, 0x06, 0xEA, 0x19, 0x4C, 0xCF, 0xC7, 0xE5,
+    0x9B, 0x85, 0x48, 0x5F, 0x24, 0x70, 0xDE, 0xEB, 0x28, 0x34, 0x4D, 0x2A, 0x6F, 0x76, 0xA1, 0xBB,
+    0x91, 0xCD, 0x58, 0x07, 0x51, 0xB9, 0xEE, 0xEB, 0x1B, 0xB9, 0xC8, 0xAE, 0x75, 0x97, 0x47, 0x3D,
+    0x36, 0x34, 0x55, 0xAC, 0x06, 0xC8, 0x60, 0xDB, 0xFB, 0xCA, 0xC8, 0x3C, 0x61, 0xC4, 0x1F, 0x45,
+    0xCA, 0xA3, 0x70, 0x0D, 0x32, 0x7A, 0xA4, 0xEC, 0x57, 0xA2, 0x77, 0x87, 0x42, 0x06, 0x23, 0xA9,
+    0xFE, 0x7C, 0xBA, 0xBF, 0x58, 0x84, 0x75, 0x83, 0x16, 0x5F, 0x8F, 0xB8, 0x96, 0x86, 0x97, 0xBB,
+    0xC7, 0xA3, 0x93, 0xBE, 0x9E, 0x8F, 0xE4, 0xD9, 0x59, 0xC9, 0x5C, 0xDE, 0xBA, 0x68, 0xFA, 0x13,
+    0x75, 0x8B, 0x7B, 0xA7, 0x75, 0xD2, 0xBA, 0x0D, 0x0D, 0x38, 0xFF, 0x8C, 0x7B, 0x27, 0x59, 0x89,
+    0xD5, 0xCA, 0x76, 0x7C, 0x18, 0x10, 0xF4, 0x6F, 0x2D, 0xB6, 0x0A, 0x5B, 0x52, 0xA3, 0x7E, 0x3C,
+    0xCC, 0xEE, 0x6C, 0xCC, 0x0A, 0xFF, 0xA1, 0xE4, 0x61, 0xDB, 0x93, 0x88, 0xF5, 0x40, 0x31, 0x81,
+    0x69, 0x8F, 0x10, 0xCF, 0x48, 0x25, 0x4B, 0xE7, 0xD5, 0x2D, 0xFD, 0xD5, 0x72, 0xD8, 0x5F, 0x65,
+    0xB0, 0x01, 0x9D, 0xC0, 0xF9, 0xA3, 0x1F, 0xF7, 0xA8, 0xCC, 0xD3, 0xCE, 0x1B, 0x89, 0x48, 0xA6,
+    0xB8, 0xC5, 0xF6, 0x5C, 0x59, 0x93, 0x59, 0xCE, 0xCF, 0xE9, 0xF7, 0x46, 0x28, 0x0F, 0x23, 0x98,
+    0xCB, 0xD1, 0x63, 0x1E, 0x97, 0x84, 0xAD, 0x64, 0x66, 0xCF, 0x84, 0x86, 0x8B, 0x26, 0xB8, 0xDD,
+    0x6C, 0xC2, 0x25, 0x37, 0x9A, 0xD7, 0x27, 0x37, 0x54, 0x32, 0xBA, 0xF6, 0xE8, 0xA8, 0xC0, 0x2E,
+    0xD0, 0x0C, 0xCE, 0x6B, 0x09, 0x13, 0xCC, 0x65, 0x44, 0x8F, 0x36, 0x60, 0xC2, 0xB4, 0x4B, 0x23,
+    0x32, 0x15, 0x22, 0xB7, 0xB3, 0xF9, 0xE1, 0x41, 0x31, 0xBA, 0xCF, 0xA7, 0xF2, 0xF5, 0x5C, 0x0D,
+    0xF6, 0xF1, 0x58, 0xDF, 0xC8, 0xB6, 0x75, 0x12, 0x26, 0x5C, 0xBA, 0x23, 0x49, 0x3D, 0xAE, 0x75,
+    0x94, 0x6F, 0xD2, 0xC9, 0xB8, 0x68, 0x1D, 0x15, 0x3A, 0x76, 0xBE, 0xFE, 0xB6, 0x70, 0xE9, 0x76,
+    0x2E, 0x16, 0x76, 0xBC, 0x75, 0x61, 0x52, 0xD3, 0x5F, 0xAD, 0x75, 0xDC, 0x66, 0x1A, 0x13, 0x28,
+    0x12, 0x5C, 0x5A, 0xFC, 0x77, 0x6E, 0x35, 0xF9, 0x31, 0x69, 0x67, 0x97, 0xDC, 0xE0, 0x9E, 0xFC,
+    0x3F, 0xFA, 0xFD, 0x88, 0xBB, 0x40, 0x79, 0xD3, 0xD3, 0x25, 0x8C, 0x04, 0xA6, 0x6B, 0xD4, 0x87,
+    0xF1, 0x3F, 0x65, 0x37, 0xD9, 0xEB, 0x72, 0x38, 0x6E, 0x0F, 0x16, 0x2E, 0xFB, 0x48, 0xAD, 0x85,
+    0xAA, 0x18, 0x41, 0x85, 0x9F, 0x09, 0xC8, 0x58, 0xD0, 0x85, 0xD3, 0xBA, 0xC5, 0x16, 0x3D, 0xE5,
+    0xED, 0xBB, 0xDA, 0x99, 0x7B, 0x70, 0x36, 0xF2, 0x43, 0xA3, 0x18, 0xFF, 0xF3, 0x00, 0xAE, 0x2E,
+    0x39, 0xC4, 0x78, 0x54, 0x5E, 0x2B, 0xC5, 0xAF, 0xBD, 0xE4, 0xE9, 0xC4, 0x53, 0x8F, 0xEC, 0x3C,
+    0xF5, 0xE3, 0x73, 0x4E, 0x24, 0x3B, 0x91, 0x74, 0xC1, 0x86, 0xF1, 0x82, 0x0D, 0xF1, 0x53, 0xAE,
+    0xBD, 0x82, 0xF3, 0xD0, 0xCC, 0x2D, 0x9D, 0x8C, 0xC8, 0x27, 0x26, 0x66, 0x35, 0x33, 0x31, 0xAB,
+    0xCC, 0x5C, 0xE4, 0x62, 0xD2, 0xF9, 0x13, 0xC9, 0x8A, 0x0C, 0x8D, 0xCC, 0x47, 0x22, 0x0E, 0x9A,
+    0x5E, 0xD0, 0xF2, 0xC2, 0x04, 0xF3, 0xED, 0x11, 0x2D, 0x26, 0x60, 0x46, 0x77, 0x82, 0xE6, 0x59,
+    0x99, 0x8B, 0x5C, 0xC9, 0x64, 0x06, 0xA7, 0x92, 0xF3, 0x59, 0xBF, 0x9B, 0x75, 0xAC, 0x9F, 0x8B,
+    0xE6, 0xF5, 0x6C, 0x83, 0x95, 0xFE, 0xD8, 0x69, 0x90, 0xBF, 0xC0, 0x12, 0x9B, 0x95, 0x25, 0xA6,
+    0x98, 0xEB, 0x81, 0xFA, 0x7B, 0x13, 0x6A, 0x76, 0x22, 0xF2, 0x7D, 0x11, 0x99, 0xDD, 0x77, 0x37,
+    0xCD, 0x96, 0x25, 0x6E, 0x2E, 0x67, 0x4C, 0xB4, 0x51, 0x4F, 0xC8, 0x9F, 0xFE, 0x25, 0x96, 0x58,
+    0x79, 0x2A, 0xA1, 0x96, 0x58, 0xBF, 0x3D, 0x9B, 0xDE, 0xBE, 0x1A, 0xCB, 0xF7, 0xE7, 0x97, 0xB2,
+    0xC8, 0xEC, 0x36, 0xCD, 0x53, 0xA1, 0x3E, 0x8C, 0xA6, 0x97, 0x3A, 0xD6, 0x32, 0xA8, 0xE5, 0x23,
+    0x0F, 0x6D, 0x28, 0x5E, 0x74, 0xD2, 0x9A, 0x6C, 0x27, 0x5C, 0xAE, 0x22, 0xDD, 0xD5, 0x72, 0x24,
+    0xA3, 0xC7, 0x62, 0x44, 0x27, 0x1D, 0xD1, 0xA9, 0xEA, 0x29, 0xB2, 0x09, 0x4B, 0x1D, 0x51, 0xD9,
+    0x01, 0xF9, 0x22, 0x30, 0x65, 0xE0, 0x60, 0x64, 0x41, 0x34, 0x16, 0x84, 0xC8, 0x85, 0x6D, 0x42,
+    0x5F, 0x83, 0xE3, 0x84, 0x4D, 0xCC, 0x2E, 0x6B, 0xD1, 0xB9, 0xFA, 0xA0, 0xC8, 0x75, 0x5B, 0x64,
+    0x87, 0xCA, 0xFB, 0xA8, 0x3C, 0xA2, 0xE6, 0x01, 0x25, 0x61, 0x51, 0x61, 0xCB, 0x3A, 0xA7, 0xA5,
+    0xBB, 0x4F, 0x65, 0x7D, 0x41, 0x7B, 0xD0, 0xC3, 0x23, 0x80, 0x79, 0x67, 0x38, 0x92, 0x1E, 0xEC,
+    0xF8, 0x0F, 0x57, 0x84, 0x87, 0x8F, 0x5A, 0x84, 0x85, 0x4E, 0xCA, 0x45, 0x93, 0x50, 0x0E, 0xAC,
+    0xA4, 0xC9, 0x7A, 0xAE, 0x53, 0x0F, 0xDB, 0x93, 0xD1, 0x47, 0x20, 0x22, 0x4F, 0x97, 0xE8, 0xE1,
+    0x34, 0x46, 0x7A, 0x4C, 0xFE, 0x50, 0xE8, 0xEE, 0xA3, 0xB2, 0x2F, 0xDF, 0x97, 0x43, 0x79, 0x2E,
+    0x57, 0x79, 0xC1, 0xF9, 0xCC, 0x42, 0x52, 0xE9, 0x00, 0xF7, 0x1F, 0xFB, 0x3F, 0x04, 0x12, 0xD8,
+    0x80, 0x6A, 0xBE, 0x4B, 0x29, 0xF3, 0xB1, 0x6E, 0x55, 0x5A, 0x44, 0x22, 0x53, 0x95, 0x55, 0x2E,
+    0xA6, 0x22, 0xAB, 0x49, 0x67, 0x95, 0x75, 0xD2, 0xB9, 0x4C, 0xF5, 0xD8, 0x88, 0xF4, 0xDB, 0x33,
+    0x6F, 0xEA, 0x2A, 0x5D, 0x2C, 0xBA, 0x96, 0x6B, 0xE8, 0x58, 0xC8, 0x7C, 0x9F, 0xBC, 0xB8, 0x68,
+    0x90, 0x2F, 0x9D, 0x2C, 0x64, 0x36, 0xB7, 0x67, 0xA7, 0xA6, 0xA4, 0x7F, 0x32, 0xD4, 0x2F, 0x5C,
+    0xCF, 0x4E, 0xFA, 0x35, 0xF7, 0x7D, 0xFC, 0x5B, 0x9E, 0x4E, 0x66, 0x1A, 0x91, 0xFE, 0x44, 0x57,
+    0x66, 0x5C, 0xE8, 0x30, 0x43, 0x1D, 0xCA, 0xF1, 0xF1, 0x58, 0xE4, 0xFF, 0x9A, 0xE8, 0xEA, 0x8C,
+    0xFB, 0x93, 0x8C, 0x91, 0x4C, 0x39, 0xBF, 0x40, 0x91, 0x8B, 0x70, 0x67, 0x5C, 0x19, 0xA0, 0x91,
+    0x80, 0x95, 0x61, 0x91, 0xD4, 0x14, 0x52, 0xA5, 0x52, 0xBE, 0x94, 0x71, 0x07, 0x13, 0x6E, 0x98,
+    0x71, 0x61, 0xA6, 0xF1, 0x13, 0x1D, 0x99, 0xE9, 0xEF, 0x67, 0xF2, 0x7F, 0x1D, 0x55, 0xFE, 0xF7,
+    0xB1, 0x98, 0x5C, 0xAF, 0x45, 0xBC, 0xBE, 0x2D, 0x94, 0xB1, 0xF2, 0x65, 0xD4, 0x6D, 0x35, 0x2C,
+    0x5A, 0xAF, 0x46, 0xE0, 0x8B, 0x2F, 0x1D, 0x35, 0x8C, 0xBA, 0x07, 0x35, 0xAA, 0xCD, 0x26, 0x2B,
+    0x91, 0x19, 0x2B, 0xE2, 0x7F, 0xEA, 0xC8, 0xF4, 0xA1, 0xE6, 0xA8, 0x9D, 0xE5, 0xD1, 0x67, 0xD8,
+    0x2B, 0x45, 0xB4, 0x08, 0xFF, 0x7A, 0xE1, 0x96, 0x0E, 0xC0, 0x79, 0x4C, 0xBF, 0x15, 0x02, 0x1C,
+    0x50, 0x75, 0x5E, 0x4B, 0x7B, 0x24, 0x13, 0x58, 0xCF, 0x53, 0x85, 0x4A, 0x24, 0xD2, 0x91, 0x71,
+    0x61, 0x0F, 0x33, 0x18, 0x5F, 0x8E, 0x85, 0x2F, 0x32, 0xEC, 0xC8, 0x79, 0x4A, 0x59, 0x08, 0xF8,
+    0x9F, 0x22, 0x9F, 0xBD, 0xCB, 0x63, 0x3B, 0x54, 0xF2, 0xAC, 0xC8, 0xF3, 0x57, 0x0E, 0x4E, 0x14,
+    0xE9, 0x81, 0x3A, 0xD8, 0x09, 0x69, 0xEB, 0xCC, 0xF4, 0x68, 0x19, 0x4B, 0xFB, 0xFA, 0x35, 0x27,
+    0x43, 0x73, 0xEB, 0xA7, 0xDC, 0x56, 0x25, 0x5C, 0xB8, 0x88, 0x19, 0x3E, 0xB9, 0xDE, 0x61, 0x77,
+    0x7B, 0x8C, 0x6B, 0xC6, 0x0C, 0x4D, 0x28, 0xC7, 0x32, 0x15, 0x99, 0x19, 0xC1, 0xB5, 0xAE, 0x35,
+    0x43, 0x3D, 0x94, 0x63, 0x23, 0x2A, 0x5B, 0x09, 0xDB, 0x83, 0x27, 0xAE, 0xE5, 0x4C, 0x13, 0xA8,
+    0xA5, 0xA5, 0x58, 0x7B, 0x91, 0x5A, 0xE4, 0x71, 0x91, 0xE0, 0x1E, 0x8B, 0x26, 0x3C, 0xAA, 0xE3,
+    0x09, 0x95, 0xA0, 0x13, 0xEF, 0x64, 0x34, 0x41, 0xCA, 0x58, 0xDF, 0x48, 0x3A, 0x4E, 0x64, 0x87,
+    0x83, 0xBA, 0xA5, 0xEA, 0xEF, 0x2F, 0x63, 0xF5, 0x4E, 0x2C, 0x24, 0x62, 0xAF, 0xF0, 0xFF, 0x00,
+    0xC5, 0xBC, 0x4F, 0x90, 0x1D, 0xC7, 0x9D, 0xE7, 0xF7, 0xA9, 0x4A, 0x34, 0x4A, 0xC3, 0x92, 0x26,
+    0xFB, 0x40, 0x8C, 0x97, 0x22, 0x87, 0xA9, 0xC3, 0x1C, 0x34, 0x5A, 0x11, 0x35, 0x07, 0x1D, 0x78,
+    0x40, 0x77, 0x26, 0x09, 0x3B, 0x78, 0xE0, 0x01, 0x58, 0x2F, 0xDE, 0x28, 0x62, 0x15, 0x1E, 0xC8,
+    0x11, 0xB6, 0x43, 0x2B, 0x4D, 0x18, 0x0A, 0x5B, 0x07, 0x1E, 0x1A, 0x5D, 0x45, 0x22, 0x62, 0x61,
+    0x07, 0x0E, 0x84, 0xC7, 0xAB, 0xDD, 0xC3, 0x1E, 0x46, 0x11, 0xE6, 0x86, 0xA5, 0xA6, 0x23, 0x38,
+    0x8E, 0xE0, 0x6E, 0x70, 0x3D, 0x8D, 0xAE, 0x04, 0xDA, 0x1B, 0x8C, 0x30, 0x0F, 0x2A, 0x0A, 0x2B,
+    0x2B, 0xC2, 0x8C, 0xB5, 0x8A, 0xD0, 0x6A, 0x14, 0x23, 0x3A, 0x8C, 0x24, 0x51, 0x1C, 0x26, 0x88,
+    0xAC, 0xFA, 0xF9, 0x50, 0xF5, 0x80, 0xE6, 0x8C, 0xFE, 0x90, 0x3B, 0x33, 0xEB, 0x6C, 0xF4, 0x7B,
+    0xAF, 0x1E, 0xDE, 0xCB, 0xFA, 0xE5, 0x2F, 0x7F, 0x7F, 0xBE, 0xBF, 0x3F, 0xD9, 0xFC, 0x2E, 0x27,
+    0xCE, 0x65, 0x2F, 0x21, 0x8D, 0xA4, 0x32, 0x21, 0xBE, 0xEE, 0xAB, 0xC4, 0xFF, 0xDC, 0x9B, 0xA6,
+    0xFE, 0x1A, 0x79, 0xA8, 0x9A, 0x08, 0x0C, 0xF6, 0x74, 0x00, 0xA2, 0x2D, 0x3C, 0xB0, 0x5F, 0x6B,
+    0x07, 0xB4, 0x22, 0x40, 0x26, 0x22, 0x40, 0x31, 0x8C, 0xD6, 0x81, 0xEE, 0x53, 0xE5, 0xC1, 0x5E,
+    0x4F, 0xDA, 0x83, 0x3C, 0x1D, 0x75, 0x8F, 0x9A, 0xD4, 0x50, 0x0C, 0xE8, 0xA8, 0x06, 0x95, 0xA8,
+    0x43, 0x35, 0xE5, 0x42, 0xDD, 0xD8, 0x89, 0xD6, 0x03, 0x60, 0x9A, 0xF9, 0xC9, 0x01, 0x50, 0x01,
+    0xC0, 0x13, 0xF3, 0xD3, 0x17, 0x59, 0x8F, 0x87, 0xD9, 0xCC, 0x5C, 0x91, 0x0A, 0x5F, 0xFB, 0x36,
+    0xD9, 0x42, 0x4E, 0xDF, 0x0E, 0xD1, 0xFE, 0xE1, 0x67, 0xF4, 0x1B, 0x37, 0x7B, 0xA8, 0xEA, 0x0A,
+    0x68, 0xC7, 0x08, 0x4A, 0xA4, 0x03, 0xFD, 0x63, 0x01, 0x76, 0xDA, 0x7D, 0x50, 0x37, 0xDF, 0x8B,
+    0x5F, 0x7C, 0xFC, 0x40, 0x5F, 0x96, 0x20, 0x61, 0x4B, 0xCB, 0x0B, 0x53, 0x16, 0xCC, 0xFF, 0x0D,
+    0xC0, 0x6B, 0x00, 0x79, 0x00, 0xD0, 0x0D, 0x90, 0x5D, 0x03, 0x28, 0x3A, 0x38, 0xFE, 0xAF, 0x50,
+    0x22, 0x18, 0x11, 0xF6, 0x55, 0xCA, 0xFB, 0x32, 0x14, 0x54, 0x1E, 0x46, 0xD0, 0x3D, 0xD5, 0x04,
+    0x32, 0xC1, 0xA3, 0x23, 0x94, 0x11, 0x4C, 0xFF, 0x24, 0xF5, 0xA5, 0xA0, 0x92, 0x7E, 0xBF, 0xEE,
+    0x2A, 0x19, 0x31, 0xD2, 0xC0, 0x00, 0x79, 0x4F, 0x7E, 0xDE, 0xA1, 0x13, 0xD8, 0x79, 0x95, 0x64,
+    0xD0, 0x46, 0x25, 0x63, 0xD1, 0x1D, 0xE4, 0xEC, 0x42, 0xE2, 0xEF, 0x06, 0xEA, 0xC0, 0x6F, 0x25,
+    0x48, 0x8F, 0x91, 0xAC, 0x8A, 0x56, 0x82, 0x16, 0xC7, 0x29, 0x38, 0x85, 0xDE, 0x47, 0x47, 0xF2,
+    0xAB, 0xB0, 0x3A, 0xC7, 0x4B, 0x99, 0x8C, 0xE5, 0x48, 0x3B, 0x54, 0x89, 0xCA, 0xD7, 0x5F, 0xC3,
+    0xFA, 0x08, 0xF6, 0x85, 0x00, 0xF5, 0x33, 0x1D, 0xB4, 0xBA, 0x81, 0x56, 0x00, 0x11, 0x07, 0x53,
+    0xE5, 0xC9, 0x46, 0xE3, 0xC9, 0x93, 0xEE, 0x51, 0xA9, 0x0C, 0xA8, 0xA8, 0x12, 0x45, 0xCC, 0x47,
+    0x6A, 0x41, 0x5C, 0x2B, 0xD4, 0x1D, 0xA0, 0xFD, 0x9A, 0x05, 0x86, 0xF5, 0xC3, 0x6F, 0x2F, 0x8C,
+    0xDF, 0xE4, 0x29, 0x69, 0x26, 0x1B, 0x6D, 0x6F, 0xCF, 0xFC, 0xB9, 0xBA, 0x13, 0xB0, 0x3B, 0x14,
+    0xB7, 0x1D, 0x6D, 0x44, 0x8B, 0x67, 0xBC, 0x86, 0x39, 0x0C, 0xFF, 0x43, 0xB2, 0x53, 0x75, 0x5D,
+    0x6E, 0x0E, 0xE5, 0x08, 0xAA, 0x83, 0x6D, 0x50, 0x1D, 0x59, 0x82, 0x93, 0xB0, 0x3A, 0xC7, 0x17,
+    0xA8, 0x85, 0xBA, 0x2B, 0xC5, 0xD5, 0x03, 0x2D, 0xF6, 0x0F, 0xB1, 0x8D, 0x05, 0xFD, 0x7F, 0x55,
+    0x50, 0xDC, 0x79, 0xD1, 0x91, 0xA7, 0xB7, 0x3C, 0xB4, 0xE2, 0xC1, 0xCA, 0x00, 0xFA, 0xAD, 0x1A,
+    0x8A, 0x3B, 0x2F, 0x76, 0xE4, 0xE9, 0x56, 0x82, 0x69, 0xB3, 0x76, 0x58, 0xA7, 0x03, 0xA6, 0xCB,
+    0x27, 0x6A, 0xC1, 0x76, 0x95, 0xF8, 0x22, 0xDE, 0x97, 0x90, 0x4D, 0x33, 0x30, 0xDA, 0xA8, 0x46,
+    0x35, 0x94, 0xFF, 0x8F, 0x7A, 0xDF, 0xA0, 0x3E, 0x38, 0x45, 0x71, 0xEF, 0x55, 0x4A, 0x89, 0xE8,
+    0x7F, 0xBB, 0x8F, 0xFE, 0xB7, 0x17, 0x31, 0xFF, 0xBB, 0xFD, 0xB4, 0xF1, 0x36, 0x55, 0x8D, 0x89,
+    0xD6, 0xE9, 0x1E, 0x80, 0xD5, 0x39, 0xBE, 0x9B, 0xC9, 0x58, 0x4C, 0xB4, 0x83, 0x1E, 0xA9, 0xBC,
+    0xFD, 0xC3, 0xAC, 0xEE, 0xF6, 0x29, 0xE4, 0xFD, 0x01, 0xEA, 0xD3, 0x3D, 0xB4, 0xA5, 0x3F, 0xCA,
+    0xDA, 0xB1, 0x6A, 0x7E, 0x01, 0x6B, 0xE3, 0x5F, 0x62, 0x6D, 0x73, 0x9F, 0xB6, 0xDA, 0x63, 0x12,
+    0x9C, 0xF7, 0x10, 0xC1, 0x34, 0x9B, 0x56, 0xF4, 0x0F, 0xDA, 0xFF, 0x71, 0x54, 0x61, 0xF2, 0xBB,
+    0xDB, 0x94, 0x6F, 0x35, 0x5C, 0x0B, 0x68, 0x71, 0x4C, 0x11, 0xF3, 0x7D, 0x9F, 0xA7, 0x83, 0x4F,
+    0xDB, 0x4B, 0x72, 0x38, 0x54, 0xB1, 0x66, 0x04, 0xD8, 0x58, 0xAD, 0xF8, 0x42, 0x29, 0xD2, 0xD5,
+    0x3F, 0x11, 0xE9, 0xEA, 0x21, 0x56, 0xDE, 0xFE, 0xE1, 0x45, 0xDD, 0x5B, 0xB4, 0x8A, 0x95, 0xCB,
+    0x9E, 0x1A, 0xB5, 0x5B, 0x24, 0xC0, 0x8A, 0x07, 0x2D, 0x03, 0xA8, 0xE1, 0x00, 0xB2, 0x64, 0x3C,
+    0xB4, 0x2A, 0x82, 0xF5, 0x2D, 0xE8, 0x5E, 0xF7, 0x14, 0x51, 0x8D, 0x18, 0xF1, 0x75, 0xA7, 0x25,
+    0xAC, 0x99, 0x98, 0x39, 0x8E, 0x69, 0xF1, 0x93, 0x95, 0x4B, 0x72, 0xCA, 0x9C, 0xF9, 0xF3, 0x2D,
+    0x5B, 0xF1, 0x84, 0xDD, 0x81, 0xDD, 0x01, 0xDA, 0x08, 0x6D, 0x82, 0x71, 0x17, 0x92, 0xFD, 0x8D,
+    0x2C, 0x55, 0x63, 0x9E, 0x4C, 0x52, 0x43, 0xB9, 0x66, 0xE2, 0xC6, 0xEA, 0xAC, 0x91, 0x4E, 0x26,
+    0xDA, 0xA1, 0x94, 0x26, 0x4F, 0x98, 0x0E, 0xEB, 0xF3, 0x84, 0x8A, 0x58, 0x4F, 0xED, 0x54, 0xA4,
+    0x1C, 0xA8, 0x1D, 0xAD, 0x48, 0x40, 0x8B, 0x08, 0x4C, 0xAB, 0xF3, 0x01, 0xD3, 0x31, 0x71, 0xF4,
+    0x0B, 0x09, 0xEB, 0xA9, 0x1B, 0x95, 0xA8, 0xE5, 0xB4, 0xA4, 0x52, 0x42, 0x2D, 0x1E, 0xC8, 0x23,
+    0x40, 0xE5, 0xEE, 0xEB, 0xED, 0x16, 0x80, 0xF2, 0xF7, 0x65, 0x15, 0x13, 0x55, 0xB0, 0xA9, 0x08,
+    0x2A, 0x96, 0x41, 0x0D, 0xBA, 0x57, 0x41, 0x77, 0x85, 0x88, 0x2F, 0x45, 0xBC, 0xFE, 0x69, 0xDD,
+    0xE8, 0xCE, 0x3A, 0xE3, 0xED, 0x63, 0xC6, 0xD7, 0xA9, 0x6A, 0xEA, 0x68, 0x9D, 0x7D, 0x6E, 0x31,
+    0x05, 0x09, 0x88, 0x50, 0x04, 0x28, 0x1A, 0x56, 0xE7, 0x36, 0x56, 0x2B, 0x67, 0xA4, 0x13, 0x49,
+    0xB4, 0x43, 0x29, 0xE2, 0xF3, 0x84, 0xE9, 0x12, 0xD6, 0xE7, 0x49, 0x37, 0x2A, 0x62, 0xFD, 0x40,
+    0xED, 0x54, 0x3C, 0xB6, 0x2C, 0x6B, 0x5E, 0xD7, 0xB2, 0xB0, 0x79, 0x65, 0xF3, 0xD2, 0x96, 0xB5,
+    0xCD, 0x8B, 0x5B, 0x56, 0x37, 0x2F, 0x8F, 0x5A, 0x4E, 0xCB, 0x40, 0x29, 0xA1, 0x16, 0x07, 0x9B,
+    0x40, 0xDD, 0x6B, 0xB9, 0x29, 0xBE, 0x16, 0x3F, 0xE5, 0xA9, 0x52, 0x83, 0x7E, 0x3B, 0x6A, 0x6F,
+    0xCF, 0x34, 0xB5, 0x24, 0x72, 0x91, 0x80, 0xFE, 0x69, 0xDD, 0x60, 0xDD, 0x48, 0x96, 0x54, 0x70,
+    0x45, 0x30, 0x42, 0xD5, 0xD4, 0x03, 0x23, 0xE2, 0x16, 0x46, 0xAC, 0x56, 0xAB, 0x15, 0x18, 0x11,
+    0x89, 0xD0, 0x8A, 0xCC, 0x24, 0xB4, 0x80, 0xF5, 0x3A, 0x80, 0x8A, 0x4C, 0x40, 0xED, 0x74, 0x0F,
+    0x65, 0xC8, 0xC6, 0x4D, 0x68, 0xA9, 0x24, 0xA2, 0x83, 0x12, 0x09, 0x4C, 0xD8, 0xE7, 0xA5, 0x31,
+    0x5D, 0x31, 0xA8, 0x94, 0x27, 0x6A, 0x57, 0x79, 0xEB, 0xCB, 0x90, 0x27, 0x15, 0x11, 0x2A, 0x5F,
+    0x37, 0xBA, 0xCF, 0x53, 0x3D, 0x15, 0xD2, 0xD9, 0x2B, 0xD2, 0x4B, 0x2A, 0x06, 0x00, 0x5A, 0x80,
+    0xCD, 0xCA, 0x03, 0xFA, 0x9F, 0x0D, 0x00, 0x32, 0x02, 0x94, 0xD3, 0x03, 0x3D, 0xCD, 0xC0, 0x0C,
+    0xB6, 0xC3, 0xDE, 0x95, 0x1E, 0x75, 0xEF, 0x76, 0x8F, 0x12, 0xDD, 0xA3, 0x92, 0xEE, 0x28, 0xA2,
+    0x91, 0x50, 0x86, 0x4A, 0x92, 0xEE, 0xAB, 0xEB, 0xA3, 0xEE, 0x6C, 0xD3, 0x1A, 0x6F, 0x5D, 0x6D,
+    0x7C, 0x8D, 0xAD, 0x9A, 0x96, 0xDA, 0xBA, 0x89, 0x5D, 0x60, 0xD6, 0x8B, 0x04, 0x1B, 0x6A, 0x00,
+    0xF3, 0x4A, 0x07, 0x46, 0x1C, 0x14, 0x11, 0xF8, 0x3A, 0x90, 0x4B, 0x07, 0xC5, 0x94, 0xBD, 0x44,
+    0x99, 0x0A, 0xE9, 0x8A, 0x58, 0xDE, 0x4B, 0x2A, 0xA9, 0x60, 0x9F, 0x1A, 0xD5, 0x50, 0xF6, 0x2D,
+    0x49, 0x45, 0xEB, 0x6B, 0x46, 0xDD, 0x57, 0xDE, 0xAA, 0x58, 0xF6, 0xC6, 0x4F, 0x79, 0xD4, 0xBD,
+    0xF5, 0x75, 0x11, 0x74, 0xD0, 0x87, 0x43, 0x26, 0x4A, 0x06, 0xEC, 0xDD, 0x76, 0xF8, 0x94, 0x12,
+    0x11, 0xC1, 0xC8, 0x2B, 0xEB, 0x95, 0x6C, 0x38, 0xA8, 0x3D, 0xF9, 0x78, 0xBC, 0x29, 0xFA, 0x7A,
+    0xD0, 0xFE, 0x6E, 0xAA, 0x4E, 0x87, 0x7D, 0xAB, 0xBA, 0x7D, 0x5B, 0x74, 0xC9, 0x16, 0x3E, 0xDA,
+    0xE2, 0x07, 0xC1, 0x9E, 0xFE, 0x59, 0x57, 0xDD, 0x90, 0x46, 0x8B, 0xFC, 0x67, 0xB9, 0xDC, 0x4E,
+    0x80, 0x83, 0x6F, 0x7C, 0x87, 0x5C, 0xC4, 0x2B, 0x91, 0xA0, 0x26, 0x92, 0x1A, 0xD9, 0xCE, 0x47,
+    0x34, 0x02, 0xD4, 0x0E, 0xAC, 0x07, 0x1D, 0x40, 0x25, 0x40, 0x58, 0xDE, 0x88, 0x7C, 0x26, 0x97,
+    0xC6, 0x34, 0x56, 0xC4, 0x17, 0x22, 0x1D, 0x95, 0x34, 0x70, 0x0A, 0xD0, 0x0E, 0xFE, 0xA9, 0x87,
+    0xBA, 0x87, 0xC5, 0xAA, 0x01, 0x8E, 0x2A, 0x22, 0x49, 0xDD, 0xDD, 0xD7, 0xFD, 0xA6, 0xF1, 0x54,
+    0x0D, 0xD6, 0x61, 0x1D, 0xB5, 0xC3, 0x36, 0x7F, 0x62, 0x25, 0x54, 0xD2, 0x95, 0x13, 0x04, 0x08,
+    0x6C, 0x07, 0x6C, 0xCF, 0x43, 0x8E, 0x8D, 0xD5, 0x6A, 0x55, 0x8A, 0xC8, 0x4D, 0x11, 0x19, 0xA2,
+    0xE9, 0xF6, 0x2F, 0x96, 0xA1, 0xD2, 0x2A, 0xE9, 0xA7, 0xDC, 0x94, 0x39, 0x6A, 0x07, 0x55, 0x07,
+    0xE5, 0x9A, 0xBE, 0x69, 0x21, 0xBA, 0x3A, 0x42, 0xB4, 0x96, 0x40, 0x29, 0x09, 0x38, 0x58, 0x34,
+    0xB6, 0xF4, 0xB3, 0x6B, 0x20, 0xAC, 0xC9, 0xCB, 0xD8, 0xCC, 0xE4, 0x99, 0x68, 0x7A, 0xFB, 0xBE,
+    0xBC, 0x21, 0xD8, 0x83, 0xE9, 0x5E, 0x50, 0xA2, 0x63, 0x8D, 0xBD, 0x2E, 0x65, 0x5F, 0xC4, 0xAA,
+    0x1B, 0x69, 0x55, 0xD2, 0x5E, 0xF7, 0xF6, 0xA9, 0xC4, 0x58, 0x84, 0xAA, 0x31, 0xBE, 0x55, 0xC3,
+    0x9B, 0x49, 0xF7, 0x76, 0xAC, 0x9A, 0x51, 0xC9, 0xE1, 0xA0, 0xBD, 0xDD, 0x01, 0x28, 0x3C, 0xC0,
+    0x0E, 0xCC, 0xF7, 0x5A, 0x8C, 0xC5, 0x16, 0x27, 0x56, 0xD9, 0xEA, 0x19, 0x09, 0x92, 0x6C, 0x2C,
+    0x26, 0x04, 0xEB, 0xCA, 0x50, 0xF6, 0x58, 0x97, 0x50, 0xC9, 0x82, 0x79, 0xA3, 0x83, 0x29, 0x42,
+    0x29, 0xB3, 0xA9, 0x46, 0xC5, 0x65, 0x45, 0x65, 0x58, 0xD8, 0xAF, 0x03, 0x68, 0xE9, 0xC9, 0x67,
+    0x71, 0x3E, 0x56, 0x0E, 0xE6, 0x2D, 0x51, 0xF1, 0x82, 0x9F, 0xD4, 0x50, 0xB9, 0x51, 0xFB, 0xEA,
+    0x52, 0x5F, 0xBC, 0x1D, 0xB2, 0x18, 0xD9, 0xDE, 0x47, 0x27, 0xD4, 0x08, 0x23, 0x58, 0x30, 0x0D,
+    0x65, 0x87, 0x0A, 0x90, 0x50, 0xD2, 0x67, 0x7B, 0x2F, 0x7D, 0x32, 0x8A, 0x36, 0xDA, 0x9F, 0x82,
+    0x48, 0xFF, 0x37, 0x40, 0xD1, 0x09, 0x39, 0xAB, 0x25, 0xFD, 0x22, 0x8A, 0x58, 0x9D, 0xDB, 0x58,
+    0x51, 0x8B, 0x16, 0x5F, 0x4E, 0x99, 0x34, 0xD4, 0xCE, 0x82, 0x0E, 0xD6, 0x91, 0x8D, 0xD6, 0x81,
+    0xBD, 0xED, 0xA0, 0x94, 0x06, 0x90, 0x66, 0x91, 0x47, 0x6C, 0x04, 0x2A, 0x01, 0xAA, 0x33, 0x3D,
+    0x54, 0x2F, 0x24, 0x30, 0xDE, 0x36, 0x18, 0x5F, 0x0E, 0xD4, 0xA3, 0x96, 0xCE, 0xCA, 0xB3, 0x12,
+    0x01, 0xAE, 0xDD, 0x47, 0x77, 0xBA, 0xB9, 0x6F, 0xB3, 0xC3, 0x03, 0xAB, 0x90, 0x8F, 0x79, 0x2A,
+    0xA5, 0x1C, 0x37, 0xEA, 0xF3, 0xFF, 0x0B, 0xF6, 0x1A, 0x98, 0x38, 0x2F, 0xB2, 0x0C, 0xA0, 0x07,
+    0xB0, 0x09, 0xAE, 0xA5, 0x2F, 0xD9, 0x41, 0x06, 0xDB, 0xB7, 0xC1, 0x36, 0x36, 0xCC, 0x33, 0x64,
+    0x03, 0x64, 0x01, 0xCA, 0x1E, 0x74, 0x93, 0xAD, 0x56, 0x6E, 0x75, 0xB6, 0x12, 0xB9, 0x22, 0x9D,
+    0xC8, 0x68, 0x26, 0x75, 0x73, 0x08, 0x95, 0x37, 0xE6, 0xD0, 0xB7, 0x3C, 0xD9, 0xFE, 0xB6, 0x8A,
+    0xE4, 0x11, 0xDD, 0xA1, 0x3B, 0x6A, 0x87, 0x25, 0x4F, 0x64, 0x09, 0x1D, 0x28, 0x03, 0xB6, 0xC1,
+    0x36, 0x8C, 0x30, 0x52, 0x04, 0x54, 0xA0, 0xF2, 0x18, 0x8F, 0x40, 0xBB, 0xFA, 0x72, 0xA4, 0x12,
+    0x11, 0x41, 0x66, 0xB3, 0x0A, 0x65, 0x07, 0x60, 0x61, 0x76, 0x1C, 0x8B, 0x78, 0xA3, 0xD7, 0x6B,
+    0xAA, 0xC4, 0x63, 0xC5, 0x73, 0x62, 0xB5, 0x56, 0x47, 0xAA, 0xA1, 0x08, 0x75, 0xD4, 0xBD, 0x1A,
+    0x74, 0xA7, 0x82, 0xF6, 0x45, 0x30, 0xBE, 0xEC, 0x6D, 0xA3, 0x3B, 0xEB, 0xB4, 0x6F, 0x31, 0xD7,
+    0x85, 0xEA, 0xB2, 0x7C, 0xDE, 0xDE, 0xB6, 0xC9, 0x26, 0x3B, 0x98, 0x70, 0xF2, 0x55, 0x60, 0x78,
+    0xF0, 0x5B, 0x04, 0x28, 0x9B, 0x13, 0xAB, 0x8D, 0xD5, 0x69, 0x19, 0x64, 0xAA, 0xC6, 0x52, 0x9A,
+    0x96, 0xCA, 0xEB, 0xA0, 0x12, 0x13, 0xB6, 0xD1, 0x7D, 0x31, 0x30, 0x51, 0x3B, 0x3D, 0x94, 0x01,
+    0x11, 0x41, 0x89, 0xF4, 0x6C, 0xFC, 0xF3, 0x91, 0x59, 0x45, 0x55, 0x5A, 0xF6, 0xAF, 0x88, 0x50,
+    0x48, 0x02, 0x11, 0x0F, 0xF9, 0xB0, 0x2C, 0x46, 0xF5, 0x8B, 0x63, 0xBD, 0xEF, 0x57, 0xA1, 0xEE,
+    0xAA, 0x4B, 0xE2, 0x46, 0x52, 0x11, 0x54, 0xA8, 0xBC, 0x69, 0x26, 0x76, 0x8B, 0x21, 0x9B, 0xC4,
+    0x2B, 0x11, 0xB2, 0x3F, 0x8A, 0xA0, 0x7F, 0xE2, 0xB0, 0x23, 0x48, 0x40, 0x7D, 0xD0, 0xCC, 0x28,
+    0x72, 0x7F, 0xF6, 0xD3, 0x95, 0x23, 0x1B, 0x38, 0xB1, 0xCA, 0x56, 0x7F, 0xFF, 0x08, 0xCD, 0xA6,
+    0xD3, 0x21, 0x4F, 0x4C, 0x58, 0xAF, 0xDF, 0x3E, 0x8C, 0x4C, 0x5F, 0xAC, 0x1B, 0x7D, 0xE7, 0xF5,
+    0x61, 0x4D, 0x73, 0xE0, 0xF8, 0xDD, 0x09, 0x4A, 0xD3, 0xC1, 0x7B, 0x23, 0x1C, 0x5B, 0x13, 0xAF,
+    0x66, 0xAF, 0xE6, 0x66, 0xC2, 0xCC, 0xA1, 0x30, 0x91, 0xD4, 0xA0, 0x82, 0xF1, 0xE6, 0xBF, 0xAB,
+    0xD9, 0xFD, 0x6F, 0x62, 0x36, 0xDD, 0xEE, 0x94, 0x08, 0xD9, 0xBF, 0x4A, 0xF0, 0xD6, 0xBB, 0xE4,
+    0xD5, 0x4C, 0x58, 0xB6, 0x18, 0xEF, 0xD5, 0x39, 0x30, 0xD2, 0xCD, 0xA8, 0x26, 0x5F, 0xF3, 0x43,
+    0x45, 0xC0, 0x3A, 0x28, 0xEE, 0x49, 0x43, 0x2B, 0x13, 0xFA, 0xEE, 0x85, 0xC0, 0x44, 0xEB, 0x4C,
+    0x57, 0x84, 0x3C, 0xB1, 0x30, 0x3A, 0x32, 0x51, 0x37, 0xA6, 0xAF, 0x45, 0xCB, 0x1B, 0xF2, 0x9E,
+    0x24, 0x1E, 0x86, 0x2A, 0x92, 0x49, 0x3F, 0x23, 0xFD, 0x71, 0xDE, 0xA7, 0xAA, 0x71, 0x8C, 0x55,
+    0xAF, 0xEE, 0x88, 0x37, 0xFF, 0x6F, 0x4B, 0xFD, 0x76, 0xCA, 0xA7, 0x32, 0xE8, 0x60, 0x1B, 0xDB,
+    0xA4, 0x2C, 0x15, 0xA1, 0x0C, 0x55, 0x63, 0x9B, 0xF1, 0x73, 0xA3, 0x92, 0xD7, 0x83, 0x9E, 0x2A,
+    0x5F, 0x75, 0x0B, 0xC3, 0xFF, 0xEB, 0x66, 0xC1, 0x70, 0xB5, 0xA4, 0xE3, 0xCF, 0x4F, 0xF9, 0x54,
+    0x15, 0x11, 0xD9, 0xD6, 0x81, 0x69, 0xDB, 0x74, 0x4C, 0xB6, 0xF6, 0xD9, 0x68, 0x44, 0x24, 0x15,
+    0x22, 0x12, 0xA9, 0xDD, 0x62, 0xB2, 0x66, 0xD8, 0x59, 0x7B, 0xBE, 0x89, 0xED, 0x55, 0xA0, 0x9A,
+    0xDA, 0x1E, 0x2D, 0xD2, 0x90, 0xCB, 0x7D, 0xB0, 0xBC, 0x01, 0xB9, 0x34, 0x58, 0x41, 0x85, 0xF1,
+    0xEF, 0x58, 0xF5, 0xEE, 0xBB, 0xD1, 0x5C, 0xB9, 0x72, 0x23, 0x9A, 0xBA, 0x6D, 0xAC, 0xF4, 0x98,
+    0x21, 0x43, 0xFB, 0x27, 0xB0, 0xEF, 0x0C, 0xB4, 0xE2, 0x68, 0xEF, 0xBB, 0x94, 0xBF, 0x35, 0xBA,
+    0xAC, 0x5B, 0xEB, 0xD2, 0x16, 0xCC, 0x4E, 0x6D, 0x7E, 0xD8, 0xFC, 0xF7, 0x25, 0x78, 0x6B, 0x36,
+    0x0F, 0xCA, 0xC3, 0x6F, 0x02, 0x5F, 0x02, 0x56, 0xAB, 0x4C, 0x26, 0xDA, 0x48, 0xE5, 0xB1, 0x7E,
+    0x51, 0xF7, 0xDA, 0xD1, 0x82, 0xC0, 0x44, 0x36, 0x92, 0x8F, 0xCC, 0x08, 0xB4, 0x88, 0xD4, 0xE2,
+    0x16, 0x31, 0xC3, 0x01, 0x1C, 0xE7, 0x4B, 0x00, 0xAA, 0x3F, 0x05, 0xC0, 0x74, 0x30, 0xAB, 0xF9,
+    0x22, 0x54, 0xE7, 0x78, 0x30, 0x96, 0xB0, 0xDA, 0x76, 0x56, 0x72, 0x41, 0xA7, 0x72, 0xCA, 0xC5,
+    0xE7, 0xE7, 0x9B, 0x83, 0x6C, 0xFC, 0x0E, 0x79, 0xA8, 0x5C, 0x04, 0xB6, 0x74, 0x97, 0x00, 0x7D,
+    0x29, 0xEC, 0x03, 0xF9, 0xBB, 0x69, 0x0B, 0xA0, 0x95, 0x69, 0x7E, 0x12, 0x0F, 0xD4, 0x67, 0x0E,
+    0x07, 0xC0, 0x5E, 0x0A, 0x07, 0x80, 0xBD, 0x9E, 0x8C, 0x07, 0xDB, 0x1D, 0xA8, 0x08, 0xB6, 0xB7,
+    0xAE, 0x75, 0xD4, 0xBD, 0xEE, 0x74, 0xA0, 0x9D, 0x43, 0x6B, 0xD3, 0x6B, 0x69, 0xEE, 0x8B, 0xD1,
+    0x1A, 0x16, 0xF3, 0xC5, 0xDC, 0x43, 0x36, 0x3C, 0x0E, 0x14, 0x12, 0x3E, 0x82, 0xC8, 0x32, 0x97,
+    0xF1, 0x30, 0xB5, 0xDF, 0x29, 0x52, 0x29, 0x87, 0xA1, 0x1E, 0xB6, 0x45, 0x5F, 0xFA, 0x0B, 0xDF,
+    0xA5, 0x6B, 0xDB, 0x90, 0x7F, 0xF0, 0x5E, 0x80, 0x52, 0x7E, 0xDC, 0x80, 0x95, 0x11, 0x18, 0x25,
+    0x40, 0xF1, 0xC6, 0x3D, 0x0F, 0x5B, 0xB6, 0x7A, 0xE1, 0xFA, 0x3B, 0x7D, 0xAC, 0x45, 0x8B, 0xEA,
+    0x24, 0x54, 0xBD, 0xC9, 0xEF, 0x4F, 0xFB, 0x0B, 0xA2, 0x2A, 0xAC, 0x4F, 0x60, 0x9F, 0xBF, 0x1F,
+    0x55, 0x69, 0x0F, 0xAD, 0x74, 0x20, 0x12, 0x61, 0x2A, 0x46, 0xB2, 0x31, 0x13, 0xF2, 0x84, 0xA0,
+    0x12, 0x2D, 0x2A, 0xD2, 0x52, 0x44, 0x5A, 0x6A, 0x61, 0xA2, 0x15, 0x46, 0x66, 0x8D, 0x3D, 0x56,
+    0x0C, 0x70, 0xF2, 0x42, 0x0F, 0x56, 0x9A, 0xD9, 0x5B, 0xAC, 0xC7, 0x53, 0xD2, 0x1C, 0xD8, 0x58,
+    0x05, 0x7B, 0xF9, 0xCF, 0xD5, 0x10, 0xB1, 0x86, 0xE2, 0x4E, 0x47, 0x2B, 0x4E, 0xCB, 0xC8, 0x58,
+    0x06, 0xE3, 0xED, 0x53, 0x49, 0x0D, 0x55, 0x63, 0x4F, 0x0F, 0x2A, 0x80, 0x85, 0xA2, 0xCF, 0x5C,
+    0x62, 0xBB, 0x75, 0x85, 0x74, 0x98, 0x1E, 0xB2, 0xD5, 0x6A, 0xE5, 0xB0, 0x32, 0x83, 0xEE, 0x09,
+    0x54, 0x6F, 0x1B, 0xB8, 0x58, 0x0C, 0x50, 0xFA, 0x16, 0x48, 0x3A, 0x80, 0x76, 0x13, 0x64, 0xC1,
+    0x74, 0x60, 0xF3, 0x04, 0x45, 0x57, 0x79, 0xD8, 0x57, 0x09, 0x74, 0x63, 0x1B, 0x54, 0x28, 0x06,
+    0x1E, 0xBE, 0x46, 0x8B, 0x12, 0xAF, 0x03, 0x36, 0x68, 0x09, 0x2A, 0xE6, 0x22, 0x00, 0x45, 0xBF,
+    0x40, 0xD8, 0x25, 0xA6, 0x29, 0x3A, 0x80, 0x57, 0xEF, 0x2F, 0x24, 0x3B, 0x0B, 0x5A, 0x1A, 0xB4,
+    0x78, 0xF4, 0xEB, 0x81, 0xE2, 0x46, 0x44, 0xF5, 0x09, 0x06, 0x0B, 0xFB, 0x55, 0xC3, 0xB6, 0xEE,
+    0x30, 0xA7, 0x43, 0xA6, 0xAF, 0xA7, 0x3F, 0x91, 0xAE, 0x4E, 0xB6, 0xAF, 0x44, 0xF7, 0x85, 0x34,
+    0xB3, 0xD8, 0xE7, 0xFD, 0xEC, 0x19, 0x09, 0xB3, 0x14, 0x7C, 0xC2, 0x18, 0x6D, 0xF8, 0xD8, 0x31,
+    0x9A, 0xB3, 0x4D, 0x29, 0x61, 0x8E, 0x01, 0x04, 0x40, 0x77, 0xA0, 0x7E, 0x94, 0x80, 0x5A, 0x98,
+    0x75, 0xF7, 0x81, 0x30, 0xD6, 0xBD, 0x3E, 0x14, 0x5F, 0x33, 0xE5, 0x49, 0x0D, 0xBA, 0xD7, 0xDE,
+    0xBA, 0x5A, 0x52, 0x2E, 0x12, 0xF4, 0x4F, 0xEB, 0xC6, 0xBA, 0x29, 0x4B, 0x6A, 0x28, 0x82, 0xF1,
+    0x55, 0xD3, 0x32, 0xE6, 0x71, 0x9E, 0xCE, 0x92, 0x3D, 0x3D, 0x60, 0x5E, 0xF1, 0xD4, 0x09, 0x2E,
+    0x34, 0xFF, 0xA1, 0x42, 0xCE, 0xE1, 0xBE, 0x93, 0x2F, 0x3D, 0x33, 0xDA, 0x58, 0x2C, 0xD3, 0x27,
+    0x0B, 0x39, 0xBF, 0xB8, 0x84, 0x9C, 0xC9, 0x3A, 0x1B, 0xE7, 0x3D, 0xC9, 0xFB, 0x19, 0xB5, 0x6A,
+    0xE0, 0x18, 0xBF, 0xDA, 0xA7, 0xC7, 0x8F, 0xEF, 0xD3, 0x4B, 0x19, 0x40, 0x64, 0xCE, 0xEB, 0x64,
+    0x71, 0xC9, 0xE8, 0x64, 0x01, 0xF8, 0xCC, 0x03, 0x2D, 0xC9, 0xC4, 0x1D, 0xD8, 0x41, 0x77, 0x36,
+    0x4B, 0x2A, 0x54, 0x7E, 0x57, 0xC5, 0xA2, 0xAF, 0x5D, 0xDD, 0x06, 0x25, 0xC2, 0xF1, 0x67, 0x03,
+    0x4C, 0xA0, 0x3B, 0x8A, 0x44, 0x2E, 0x1E, 0xEB, 0x50, 0xB3, 0x51, 0x55, 0x1E, 0x9E, 0x04, 0x36,
+    0x56, 0x6C, 0xAC, 0x28, 0xC5, 0x2B, 0xF1, 0x99, 0x84, 0x5C, 0x1A, 0x4C, 0x42, 0x3C, 0xA5, 0x20,
+    0x01, 0x75, 0xBB, 0xDB, 0x4D, 0xF0, 0xC1, 0xB0, 0x5D, 0xC3, 0xFE, 0x81, 0xA9, 0x1A, 0x6C, 0xF5,
+    0xE2, 0x95, 0x1E, 0x7D, 0xF9, 0x83, 0x1B, 0x91, 0xC2, 0x4B, 0x37, 0xA1, 0x82, 0x0D, 0xB6, 0x21,
+    0xEA, 0x41, 0x77, 0x5C, 0xCC, 0x93, 0x1A, 0xA8, 0xB8, 0xC8, 0x88, 0xF6, 0x8F, 0x53, 0xBB, 0x6A,
+    0x24, 0x93, 0xC9, 0x88, 0x9B, 0xD3, 0x2E, 0x4B, 0xA6, 0x6A, 0xD1, 0x13, 0xD5, 0x03, 0xA8, 0x19,
+    0x43, 0xF6, 0x0F, 0x82, 0x0A, 0x1C, 0x55, 0xCA, 0xC4, 0x19, 0x71, 0xE2, 0x69, 0xFB, 0xB6, 0xE7,
+    0x64, 0xDA, 0x1A, 0xD0, 0x17, 0x9E, 0xD8, 0x47, 0xBD, 0xF1, 0xE3, 0x8A, 0xEC, 0x5D, 0x39, 0xE3,
+    0xD9, 0xAF, 0x0F, 0x7B, 0xB6, 0xCD, 0xDB, 0x11, 0x5D, 0x84, 0x8B, 0xDF, 0x92, 0xEB, 0xB1, 0x1A,
+    0x6D, 0xB7, 0x55, 0x8A, 0xEE, 0x7E, 0x23, 0x13, 0xBF, 0xC6, 0x73, 0x59, 0x60, 0x41, 0x5F, 0xB3,
+    0x66, 0x3E, 0x0C, 0x27, 0xCE, 0x31, 0xBB, 0x11, 0xE3, 0xF9, 0x48, 0x58, 0x05, 0x35, 0x1C, 0x30,
+    0x23, 0xC8, 0x2C, 0x91, 0x27, 0xF2, 0x88, 0x1A, 0x50, 0x03, 0x56, 0xE6, 0x04, 0x12, 0x38, 0x78,
+    0x84, 0x0E, 0xB6, 0xF3, 0x0E, 0xEC, 0x2B, 0x1E, 0xCC, 0xB4, 0x68, 0xFB, 0x32, 0xBE, 0xB6, 0x18,
+    0x39, 0x8A, 0x04, 0xE8, 0x11, 0xA8, 0x46, 0x60, 0xFB, 0x00, 0x48, 0x35, 0x64, 0x43, 0x0D, 0x2A,
+    0x58, 0x28, 0x3B, 0xEB, 0xD0, 0xDE, 0x36, 0x54, 0x22, 0x9E, 0x5A, 0xC4, 0x33, 0x52, 0xF9, 0x3C,
+    0x62, 0x3A, 0x15, 0x30, 0x7D, 0x35, 0x22, 0x63, 0x3D, 0xCD, 0x81, 0x82, 0xE3, 0x39, 0xE5, 0x54,
+    0x38, 0x45, 0x29, 0xDD, 0x3C, 0xF1, 0x2C, 0xC4, 0xFA, 0x6E, 0xCC, 0x44, 0x3A, 0xFD, 0xB6, 0xD0,
+    0xE6, 0x51, 0x05, 0xDD, 0x55, 0xDE, 0x2E, 0x1A, 0x1A, 0xB4, 0x6F, 0x1B, 0xFB, 0xEC, 0xC1, 0xE7,
+    0xE4, 0x9A, 0xDC, 0x94, 0xC3, 0xA9, 0x88, 0x0F, 0x42, 0x4C, 0xC0, 0x3C, 0xE3, 0xC1, 0x9E, 0xE9,
+    0xC0, 0x6A, 0x0F, 0x0F, 0x6F, 0xFC, 0x07, 0x58, 0x06, 0x6C, 0x19, 0x54, 0x1C, 0xD1, 0x87, 0x81,
+    0x63, 0xD9, 0x5F, 0x73, 0x19, 0xB3, 0xB1, 0xC7, 0x8A, 0x8C, 0x30, 0xDF, 0x9B, 0x42, 0xD8, 0x87,
+    0xEC, 0x83, 0x50, 0x34, 0xB0, 0xBD, 0xCB, 0x57, 0x41, 0xBF, 0xD1, 0x01, 0x79, 0x48, 0x00, 0xD7,
+    0xB4, 0x0C, 0x60, 0x5E, 0x10, 0x01, 0x15, 0xEC, 0xB7, 0xCF, 0x82, 0xC8, 0x00, 0x58, 0x11, 0x8E,
+    0x51, 0xF6, 0x45, 0x50, 0x5D, 0x96, 0x38, 0xE0, 0x22, 0x35, 0xFA, 0xA7, 0xE7, 0x7D, 0x15, 0xB5,
+    0x48, 0x2C, 0xE5, 0xBA, 0x88, 0x38, 0x32, 0x97, 0x39, 0xAA, 0xBB, 0x76, 0x40, 0x44, 0x92, 0x8A,
+    0xA6, 0x4F, 0x65, 0x30, 0x3E, 0x69, 0x6F, 0x9F, 0x1E, 0x2A, 0x6F, 0xCB, 0xDE, 0x36, 0x6D, 0xEB,
+    0xAC, 0x93, 0x88, 0x55, 0xE2, 0x36, 0xED, 0xB3, 0x42, 0xB0, 0xB7, 0xEB, 0x97, 0x83, 0x4D, 0x56,
+    0xBC, 0xEE, 0xCB, 0x91, 0x23, 0x42, 0xFF, 0xF9, 0xDC, 0x53, 0x65, 0x3D, 0xE5, 0x87, 0x01, 0x24,
+    0xC0, 0xC6, 0xD9, 0xF5, 0xDA, 0xCE, 0x65, 0x22, 0xE2, 0x2A, 0x91, 0x2E, 0x4F, 0x59, 0x40, 0xD8,
+    0xC1, 0x36, 0xBF, 0x8D, 0x59, 0x62, 0xF8, 0x5C, 0xA4, 0x41, 0xA4, 0xC3, 0x7E, 0xFB, 0xEC, 0xFA,
+    0x4D, 0xA7, 0x12, 0xAF, 0x32, 0xB1, 0x45, 0xFD, 0xED, 0x3A, 0x13, 0x11, 0xDF, 0x8A, 0x74, 0x40,
+    0xC6, 0xE3, 0x74, 0xDA, 0x87, 0x5C, 0x06, 0xEC, 0x9C, 0xF3, 0x39, 0x06, 0x6D, 0x8F, 0x24, 0x92,
+    0x75, 0x49, 0xFB, 0xDD, 0xA2, 0xAF, 0xCA, 0x5E, 0xDF, 0xEE, 0x95, 0x34, 0xD9, 0x88, 0xB3, 0xBC,
+    0xAA, 0x3F, 0x1C, 0x73, 0x19, 0xA9, 0x16, 0x1F, 0x7D, 0xFC, 0x7B, 0xD0, 0x4A, 0x97, 0x8B, 0x0C,
+    0x45, 0x5F, 0xA6, 0xA2, 0xC9, 0x47, 0x66, 0x68, 0x2E, 0x80, 0x6C, 0xAC, 0x56, 0x52, 0x89, 0x4C,
+    0x56, 0x64, 0xAC, 0x9D, 0x4A, 0x2D, 0x2A, 0xB6, 0xE8, 0xD0, 0xBA, 0xAA, 0xAB, 0xFF, 0x4C, 0x9A,
+    0x4A, 0x46, 0x4A, 0xE9, 0xD6, 0x48, 0x36, 0x93, 0xBE, 0x90, 0x68, 0x9E, 0x4F, 0xBF, 0xCD, 0x48,
+    0x3E, 0x52, 0x8F, 0xEA, 0x6E, 0xD2, 0x5D, 0xB2, 0x79, 0xDC, 0x55, 0x61, 0xD7, 0x74, 0x56, 0xDC,
+    0x11, 0x74, 0x50, 0xDE, 0x08, 0x98, 0xD7, 0x03, 0xE6, 0xF5, 0x9E, 0x8D, 0xCC, 0xFD, 0x8D, 0x13,
+    0x04, 0x0C, 0x17, 0xF3, 0x38, 0xE6, 0x43, 0xC2, 0x6D, 0xFE, 0x7B, 0x91, 0x08, 0xC0, 0x45, 0x03,
+    0xC0, 0x68, 0x1D, 0x40, 0x9A, 0xA3, 0xCC, 0xB3, 0x0F, 0xFF, 0x15, 0x88, 0xF9, 0xFF, 0x4B, 0xE5,
+    0xC6, 0x7D, 0x94, 0x56, 0x2A, 0xDD, 0x40, 0x96, 0x5A, 0xA0, 0xB8, 0x35, 0x2C, 0x12, 0xF9, 0xB7,
+    0x8A, 0x2E, 0x01, 0x4E, 0xEA, 0x26, 0x4F, 0x2D, 0xE5, 0xAD, 0x81, 0x8D, 0xE5, 0x7E, 0xDF, 0xB8,
+    0x8A, 0x95, 0x90, 0x89, 0x84, 0xD2, 0x5B, 0x7F, 0x92, 0x96, 0x6F, 0xE6, 0x69, 0xC6, 0x0F, 0x13,
+    0xB9, 0xF4, 0x68, 0xE9, 0xC9, 0xDA, 0x0E, 0xDA, 0x86, 0x6C, 0x52, 0x4D, 0x11, 0x2D, 0xD6, 0xCB,
+    0x97, 0xC7, 0x5C, 0xA4, 0xCB, 0x1E, 0x44, 0x48, 0xE8, 0xCB, 0x5D, 0xF9, 0x93, 0x98, 0x0F, 0x89,
+    0xCD, 0x63, 0x8B, 0x75, 0xC9, 0xA5, 0x57, 0x32, 0x66, 0x43, 0xD5, 0x7C, 0xAE, 0xE8, 0x51, 0x81,
+    0xBF, 0x1B, 0x30, 0x89, 0xEC, 0x82, 0x47, 0x85, 0xC7, 0x48, 0xDA, 0x4F, 0x4A, 0x04, 0x3B, 0xAE,
+    0x93, 0xB0, 0xE7, 0x10, 0x19, 0x11, 0x19, 0xB3, 0x41, 0xC5, 0x3C, 0xE8, 0x90, 0x75, 0xD6, 0x83,
+    0xCC, 0xFE, 0xBA, 0x9C, 0x66, 0x74, 0x47, 0xED, 0xC1, 0x74, 0x19, 0xBA, 0x33, 0x18, 0x6F, 0x9D,
+    0xF5, 0xF6, 0xCF, 0x84, 0x4A, 0x12, 0xC5, 0x5A, 0xAA, 0x5A, 0x49, 0x88, 0xA4, 0xEC, 0xEE, 0x57,
+    0x86, 0x3C, 0xE8, 0x8E, 0xC6, 0x3A, 0x18, 0x41, 0x0D, 0x4B, 0x82, 0x64, 0x5A, 0xB2, 0x33, 0xD6,
+    0x83, 0xB9, 0xFF, 0xFB, 0x18, 0xB6, 0xD9, 0xA6, 0xC5, 0xBE, 0x33, 0x52, 0xC9, 0x40, 0x3E, 0x39,
+    0x60, 0x63, 0x35, 0x8B, 0x01, 0xA0, 0x24, 0x7D, 0x64, 0x23, 0xB3, 0xD5, 0xD9, 0x8D, 0x25, 0xEB,
+    0x4D, 0x35, 0xE6, 0xD2, 0x53, 0xF9, 0x6C, 0x04, 0x41, 0x07, 0x54, 0x44, 0x3C, 0xA6, 0x33, 0x02,
+    0x6D, 0x26, 0x91, 0x3C, 0x55, 0xAF, 0x74, 0xE8, 0xF7, 0x62, 0x0B, 0xB6, 0x3D, 0x9D, 0xC8, 0x64,
+    0xD0, 0x3D, 0xA5, 0x50, 0x3B, 0x6C, 0xC8, 0x47, 0x10, 0xCA, 0x40, 0x11, 0xB1, 0x3E, 0x93, 0x51,
+    0x4B, 0xBF, 0xCE, 0x74, 0x57, 0xE2, 0x11, 0x21, 0x5B, 0x9D, 0x5D, 0xBB, 0xC4, 0xB6, 0x33, 0xAF,
+    0x4B, 0x33, 0x31, 0xAA, 0x41, 0x05, 0xED, 0x8D, 0xAF, 0x39, 0x50, 0x51, 0x0D, 0xBA, 0xD3, 0xBE,
+    0xA5, 0x2E, 0x52, 0x1E, 0xEB, 0x77, 0x5F, 0xBC, 0xF7, 0x7D, 0xB1, 0xC9, 0x86, 0xDA, 0x1F, 0xFC,
+    0x55, 0x6D, 0x51, 0xC3, 0x08, 0xE8, 0xC3, 0xC0, 0x51, 0x2F, 0xB4, 0xB1, 0x72, 0x27, 0x56, 0x33,
+    0xA8, 0x9B, 0x61, 0x22, 0x2D, 0xC5, 0xB0, 0x00, 0x3E, 0xDD, 0x2B, 0x81, 0xDA, 0xD5, 0x89, 0x3C,
+    0x15, 0xD2, 0x53, 0x86, 0x83, 0xD6, 0x61, 0xDF, 0xB8, 0x95, 0x60, 0x1A, 0x75, 0xA0, 0x90, 0xCE,
+    0x36, 0x54, 0x29, 0x1B, 0x41, 0x7C, 0x39, 0xA0, 0x12, 0x95, 0xC7, 0xF4, 0x08, 0x85, 0x0C, 0x56,
+    0x9A, 0x4A, 0xAE, 0x2F, 0x3E, 0x89, 0x9D, 0x0A, 0x35, 0x24, 0xF4, 0x61, 0xCF, 0x2C, 0x34, 0x1C,
+    0x83, 0x72, 0xCC, 0x52, 0x1D, 0x75, 0xAF, 0x3B, 0xEB, 0x2C, 0x73, 0xDC, 0xDF, 0xDB, 0xC6, 0xBA,
+    0x91, 0x54, 0x86, 0x22, 0xD4, 0xBE, 0xBA, 0x2C, 0x7F, 0x47, 0xF6, 0xE5, 0x8E, 0x1C, 0x4A, 0x91,
+    0xCA, 0xFE, 0xA8, 0x6B, 0xED, 0x50, 0x71, 0x5A, 0x3C, 0xEB, 0x6C, 0x4E, 0x80, 0xAF, 0x5F, 0x05,
+    0x91, 0x8E, 0x5A, 0xC4, 0x99, 0xC1, 0xA4, 0x22, 0x61, 0x3B, 0x71, 0xF9, 0x64, 0x02, 0xD5, 0xAD,
+    0x91, 0x7C, 0xB2, 0x9E, 0xEA, 0x27, 0x69, 0x7E, 0x61, 0x6F, 0x26, 0x54, 0xB2, 0x9E, 0xF6, 0xD2,
+    0x88, 0x09, 0x55, 0x28, 0x46, 0xE4, 0x1D, 0x71, 0x85, 0x48, 0xF7, 0x11, 0xBB, 0x05, 0xC3, 0x45,
+    0xAA, 0x17, 0xBB, 0x3C, 0xA4, 0xB5, 0x4F, 0xCD, 0x1C, 0xB9, 0x74, 0x99, 0x08, 0xF5, 0xE5, 0xA8,
+    0x7B, 0x7B, 0x3D, 0xE5, 0xC9, 0x36, 0xD5, 0xE1, 0xA0, 0xA2, 0x75, 0xF6, 0x99, 0xA1, 0x08, 0xD6,
+    0x8D, 0x6A, 0xAC, 0xBD, 0x91, 0x9E, 0x7A, 0xF8, 0x85, 0xF4, 0xE9, 0x85, 0x3E, 0xF2, 0xC9, 0xF4,
+    0x98, 0x5B, 0x23, 0xD9, 0x64, 0x45, 0xE4, 0x27, 0x22, 0x32, 0xD9, 0x1F, 0xAE, 0xEA, 0x35, 0x7D,
+    0xF5, 0xA5, 0x84, 0x0E, 0x55, 0x50, 0x23, 0xF2, 0x67, 0x7F, 0x85, 0xBE, 0xCC, 0x51, 0x0A, 0x46,
+    0x82, 0x79, 0x7B, 0xD2, 0x5D, 0xF5, 0x7A, 0x28, 0xEE, 0x4C, 0x7B, 0x49, 0x64, 0xB2, 0xAB, 0xFA,
+    0xBC, 0x37, 0x87, 0x41, 0x77, 0x62, 0x82, 0x91, 0x3E, 0x3B, 0xBA, 0xA4, 0x8F, 0xC5, 0xC1, 0xBF,
+    0x21, 0x0A, 0x7F, 0x39, 0x07, 0xFD, 0x9A, 0x83, 0x5D, 0x75, 0x3D, 0x65, 0xC9, 0xFE, 0xFC, 0x95,
+    0x43, 0x91, 0x68, 0x57, 0xF5, 0x33, 0xA1, 0x08, 0x96, 0x51, 0xA5, 0xBF, 0xC4, 0x41, 0x20, 0x1B,
+    0x2E, 0xC2, 0x64, 0x1B, 0xAC, 0xF6, 0x64, 0x73, 0x02, 0x82, 0xEC, 0x1B, 0x57, 0x51, 0x22, 0x4D,
+    0x26, 0x6D, 0x64, 0x3F, 0x13, 0x4E, 0x52, 0xF5, 0xC5, 0x47, 0xCA, 0x04, 0x22, 0x01, 0x2B, 0x89,
+    0x87, 0xF6, 0x04, 0x68, 0x1D, 0x58, 0x7F, 0x8A, 0xAA, 0xB7, 0xCE, 0x04, 0x7D, 0xB7, 0x0E, 0xB9,
+    0x48, 0xC0, 0xC8, 0xD5, 0x8F, 0x00, 0x38, 0x7D, 0x33, 0xA8, 0x10, 0xD9, 0x5C, 0x17, 0xDB, 0xEF,
+    0x9B, 0x3A, 0xFF, 0x7B, 0x45, 0x80, 0xC4, 0x17, 0x5A, 0x8C, 0xF8, 0xFC, 0x2B, 0x81, 0x3C, 0x3E,
+    0x46, 0xD2, 0xD7, 0x27, 0x25, 0xD3, 0x7D, 0x53, 0x97, 0xAD, 0xCE, 0x42, 0x2D, 0x8E, 0x52, 0xC2,
+    0x51, 0x5B, 0x72, 0xE2, 0x9C, 0x15, 0x25, 0x3F, 0x90, 0xCE, 0xC4, 0x72, 0x20, 0x61, 0x5D, 0xE5,
+    0x54, 0x54, 0x81, 0xCA, 0x27, 0xB2, 0x64, 0x1C, 0xFA, 0x66, 0x80, 0x83, 0x7D, 0x28, 0xC4, 0x81,
+    0x5D, 0x97, 0x14, 0x2A, 0x47, 0x5E, 0xF4, 0x20, 0x69, 0xB6, 0x6D, 0x47, 0x5D, 0x8E, 0x8C, 0xF3,
+    0xBD, 0x66, 0x33, 0x36, 0x2B, 0x59, 0x39, 0x98, 0xAE, 0x14, 0x15, 0xA9, 0xFC, 0x84, 0x1A, 0xAA,
+    0x86, 0x51, 0x77, 0x54, 0x97, 0x02, 0xC5, 0xDB, 0x03, 0x59, 0xDC, 0x07, 0xBB, 0x05, 0xFA, 0x36,
+    0x28, 0x01, 0xC4, 0xCD, 0x89, 0x3A, 0xE3, 0x41, 0x7B, 0x9E, 0x34, 0x1E, 0x23, 0x9E, 0x42, 0x9A,
+    0xB9, 0x60, 0x31, 0x8F, 0x2D, 0xED, 0xD0, 0x3F, 0x89, 0xB3, 0x17, 0x5E, 0x6F, 0xC1, 0x89, 0x55,
+    0xB6, 0x3A, 0x2D, 0xC1, 0x8E, 0xD5, 0x98, 0x49, 0xD3, 0x3A, 0xED, 0xD5, 0x90, 0x0F, 0xD8, 0xC6,
+    0x92, 0x27, 0xED, 0x31, 0xD7, 0x07, 0x18, 0x2D, 0x94, 0xEF, 0x78, 0xA8, 0x87, 0xE5, 0x8E, 0x76,
+    0x49, 0xB1, 0x7E, 0x6E, 0x17, 0xB4, 0x78, 0x90, 0x1E, 0xCA, 0xE1, 0xA3, 0x7E, 0xF4, 0xA4, 0x76,
+    0x98, 0x37, 0x7A, 0xCA, 0x1F, 0x84, 0x23, 0xC2, 0x8A, 0xA3, 0x7D, 0x6A, 0xA4, 0x0D, 0xB6, 0xC9,
+    0x93, 0xEE, 0xB1, 0x4F, 0x47, 0x74, 0x37, 0x92, 0x47, 0x0B, 0xBB, 0xC6, 0x61, 0xAE, 0x78, 0xD4,
+    0x9D, 0x0E, 0xA6, 0x30, 0xF3, 0x50, 0x0F, 0x73, 0x36, 0x33, 0x4B, 0x40, 0x42, 0x3D, 0x9F, 0xC8,
+    0x24, 0x41, 0x1D, 0xE7, 0x34, 0xF9, 0x32, 0x6B, 0xD6, 0x3F, 0x01, 0x6D, 0x19, 0xB0, 0x37, 0x13,
+    0xBA, 0x1F, 0xA1, 0xFB, 0xCC, 0xDF, 0xEA, 0xD6, 0x6D, 0xE4, 0xA0, 0x6E, 0xF4, 0xA8, 0x77, 0x23,
+    0xF9, 0x10, 0x61, 0x88, 0xF0, 0xCD, 0x27, 0x1F, 0x04, 0xD3, 0x55, 0x57, 0xBB, 0x2A, 0xE9, 0x9E,
+    0x56, 0x45, 0x74, 0x77, 0x80, 0x1A, 0xAC, 0xE3, 0x40, 0x7B, 0xCC, 0xE5, 0x8E, 0xE2, 0x56, 0x80,
+    0x34, 0x80, 0xDD, 0x07, 0x9D, 0x40, 0x8D, 0xEB, 0xF2, 0xD3, 0x1C, 0xA3, 0xF7, 0xF5, 0x9C, 0x70,
+    0x30, 0xD3, 0xBA, 0xFC, 0x73, 0xDF, 0x3B, 0xE8, 0x9B, 0xC3, 0x0C, 0xA3, 0xD6, 0xA0, 0xEF, 0x6F,
+    0x2C, 0xDC, 0x2E, 0xD6, 0xE1, 0xF6, 0xDA, 0x03, 0xBC, 0x9F, 0xD0, 0xAF, 0xDF, 0xF7, 0x00, 0x40,
+    0x31, 0xE6, 0xD1, 0x0E, 0xBA, 0xD3, 0xBE, 0xC6, 0xE6, 0x29, 0x8B, 0xBA, 0x2F, 0xFA, 0xDA, 0x99,
+    0xDB, 0x09, 0x2B, 0x81, 0x47, 0xAA, 0x06, 0xA6, 0xCF, 0xA1, 0xC4, 0xA3, 0xA7, 0xB9, 0xB8, 0x36,
+    0x17, 0x71, 0xA9, 0xE7, 0x3C, 0x42, 0xA0, 0x25, 0x61, 0xFD, 0x36, 0xBA, 0xD7, 0xAE, 0x18, 0x54,
+    0x93, 0xA7, 0xA5, 0xDA, 0x6A, 0xFD, 0x5C, 0xF1, 0x2B, 0x86, 0x25, 0xD6, 0x12, 0x16, 0xD1, 0xEE,
+    0xA1, 0x16, 0x4F, 0x25, 0xFD, 0x92, 0xC5, 0x48, 0xC0, 0xF6, 0x52, 0x2C, 0xBC, 0x9F, 0xDB, 0xDF,
+    0xA0, 0x94, 0x46, 0xE4, 0x72, 0x77, 0xF0, 0xA9, 0x3C, 0x52, 0x75, 0xC5, 0x84, 0x74, 0x66, 0x60,
+    0xA2, 0x08, 0x65, 0xF5, 0x66, 0xB2, 0xD2, 0xD7, 0x3F, 0x6B, 0x38, 0x09, 0xFB, 0xA8, 0x9E, 0x0B,
+    0x2E, 0x1B, 0xFE, 0x52, 0xE8, 0xB7, 0xF8, 0xDD, 0xD9, 0xC2, 0x92, 0xB9, 0x07, 0x61, 0xEC, 0xEA,
+    0x1C, 0x1B, 0x2B, 0x67, 0xA4, 0xCF, 0x65, 0xA4, 0x1D, 0x78, 0x54, 0x5C, 0x9E, 0x58, 0x32, 0xAF,
+    0x2A, 0xA2, 0x06, 0xA8, 0x1B, 0x6A, 0x47, 0x31, 0x50, 0x06, 0x68, 0xA1, 0x9D, 0x9C, 0x0E, 0x68,
+    0x99, 0x98, 0x60, 0xD4, 0x83, 0xE9, 0x30, 0xDE, 0xDE, 0x48, 0xE4, 0x49, 0xA5, 0xCA, 0x63, 0xBD,
+    0xBD, 0x94, 0x50, 0xB1, 0x18, 0x6C, 0x43, 0xFD, 0x8F, 0xA4, 0x88, 0xD4, 0x22, 0x97, 0x24, 0x94,
+    0x22, 0x57, 0x97, 0x00, 0xFB, 0xFE, 0x50, 0x6F, 0x0F, 0x50, 0xBD, 0xD8, 0xC3, 0x35, 0xCB, 0x03,
+    0x8D, 0xCA, 0x80, 0x72, 0x84, 0x54, 0x0F, 0x14, 0x41, 0x77, 0x54, 0xDE, 0xC2, 0x94, 0xC5, 0xB3,
+    0x6A, 0xD0, 0x12, 0xB5, 0xB7, 0xB7, 0x87, 0x9A, 0x54, 0xDE, 0x8A, 0x45, 0x6F, 0x5E, 0xEC, 0x4C,
+    0x73, 0xCD, 0x1E, 0xAB, 0x8B, 0x20, 0x41, 0xA4, 0x10, 0x27, 0xBD, 0x1E, 0xF8, 0x75, 0x3B, 0x94,
+    0xBB, 0x3C, 0xC1, 0x86, 0x9C, 0xA3, 0x10, 0x99, 0x37, 0xE3, 0x57, 0xEC, 0x50, 0x04, 0x1E, 0x07,
+    0xCA, 0x06, 0xFE, 0x69, 0x07, 0xF6, 0x68, 0x19, 0x77, 0x83, 0x52, 0x9E, 0x17, 0xB9, 0x72, 0xF5,
+    0xE0, 0x58, 0x1E, 0x1F, 0x32, 0xBE, 0x1A, 0x91, 0xC6, 0x24, 0xC6, 0x27, 0x8B, 0x50, 0x54, 0x6F,
+    0x1E, 0x58, 0x89, 0xF5, 0xBD, 0x1E, 0xED, 0xD8, 0xE2, 0x4F, 0x43, 0x2E, 0x4B, 0xBB, 0xD0, 0x27,
+    0xAC, 0xE7, 0x75, 0xCC, 0x25, 0x36, 0x2A, 0x71, 0x50, 0x9D, 0x09, 0x50, 0xBD, 0x30, 0x82, 0xF1,
+    0xD6, 0x63, 0x7C, 0x11, 0xA8, 0x47, 0x26, 0xAC, 0xB8, 0xAA, 0x59, 0x52, 0x97, 0x59, 0x3E, 0x40,
+    0xF6, 0x7E, 0x02, 0xDA, 0x11, 0xD0, 0x47, 0x42, 0x98, 0x8F, 0x5B, 0xCF, 0xC3, 0x0E, 0x13, 0xB6,
+    0xAF, 0xB1, 0x8D, 0x75, 0x50, 0x35, 0x60, 0x1A, 0x1E, 0x36, 0x8E, 0xDD, 0x16, 0xEA, 0x04, 0xA6,
+    0xFB, 0x98, 0xAB, 0x29, 0xA4, 0x81, 0x56, 0xA4, 0xA1, 0x12, 0xE9, 0x3E, 0x4E, 0x75, 0xD2, 0x5B,
+    0x79, 0x76, 0x76, 0x58, 0x1F, 0x25, 0xB7, 0xBA, 0x36, 0x2F, 0xE6, 0xFC, 0xFB, 0x4E, 0x89, 0x74,
+    0x98, 0x61, 0x9E, 0x6D, 0x26, 0xF7, 0x25, 0xDB, 0xB7, 0x83, 0x6D, 0x6C, 0x07, 0x70, 0xFC, 0xBF,
+    0x5A, 0x0F, 0x50, 0x9F, 0xAE, 0x9A, 0x60, 0xAF, 0xFF, 0xE3, 0xDF, 0xE0, 0xEA, 0x2F, 0xFC, 0x07,
+    0x40, 0xC7, 0x93, 0xAB, 0x3F, 0xF8, 0xF9, 0x2B, 0xFE, 0x31, 0xFF, 0x9D, 0xEB, 0x8D, 0xE7, 0x57,
+    0xFD, 0x38, 0xA0, 0xE0, 0x31, 0xFE, 0xC5, 0xEA, 0xC3, 0x97, 0xBF, 0xA4, 0x1E, 0x52, 0xF9, 0x69,
+    0xD4, 0xAF, 0xFC, 0xC9, 0xDA, 0x51, 0x26, 0x19, 0xE7, 0xC7, 0x13, 0xAB, 0xD5, 0x19, 0x91, 0x3B,
+    0x22, 0x69, 0x6F, 0x6F, 0x6F, 0x6F, 0x6F, 0xAF, 0x95, 0x07, 0x23, 0x9D, 0xDB, 0xB0, 0xE5, 0x8F,
+    0x6F, 0x7C, 0x10, 0xAE, 0xA5, 0xAA, 0xFE, 0x24, 0x2F, 0xBE, 0x7E, 0xBC, 0x11, 0x91, 0x5A, 0xE4,
+    0xE7, 0x7B, 0x7B, 0x2F, 0x01, 0x47, 0x2F, 0x92, 0xEE, 0x92, 0xBE, 0x31, 0x6C, 0x97, 0x7E, 0x93,
+    0x63, 0x6A, 0x68, 0xCB, 0xBE, 0xCE, 0x83, 0x6E, 0x76, 0xB2, 0x66, 0x36, 0x0E, 0xA3, 0x3D, 0x1D,
+    0x92, 0x3E, 0x0C, 0xD7, 0xAA, 0xD3, 0x7D, 0xAC, 0x4A, 0xBF, 0x79, 0x8C, 0x63, 0x19, 0xA3, 0x7D,
+    0xF6, 0xBD, 0x54, 0x5D, 0xE9, 0x6B, 0xE3, 0xF7, 0x2B, 0xE2, 0x76, 0x16, 0x76, 0xB2, 0xE6, 0xAB,
+    0x3C, 0x02, 0x09, 0xD5, 0xA3, 0x61, 0x27, 0x17, 0x11, 0x91, 0xAB, 0xA7, 0x8E, 0x11, 0x28, 0x3C,
+    0x27, 0x21, 0xA2, 0x3A, 0x8C, 0x23, 0xAD, 0xD3, 0x7F, 0xD9, 0x55, 0x48, 0xB0, 0x0D, 0x1A, 0x0A,
+    0x9F, 0x8B, 0x04, 0x91, 0xB8, 0xB9, 0x75, 0x0C, 0xED, 0x28, 0x3D, 0x2A, 0x40, 0xE4, 0x77, 0x2F,
+    0xFE, 0x43, 0x2D, 0xF2, 0xCC, 0x3B, 0xEF, 0xF8, 0xBC, 0x87, 0x08, 0xDB, 0xB3, 0xC4, 0x01, 0xD8,
+    0x43, 0x39, 0x33, 0xDA, 0x50, 0x3B, 0xF8, 0x1D, 0x4C, 0x57, 0xC8, 0x53, 0x32, 0xD6, 0xF2, 0x63,
+    0xB9, 0x3C, 0x65, 0x91, 0x4D, 0x78, 0xC4, 0xBC, 0x33, 0x4E, 0xC7, 0x78, 0x84, 0xBF, 0x97, 0xF4,
+    0x8F, 0x43, 0x7B, 0xE1, 0x85, 0xB4, 0x99, 0xB9, 0xEA, 0xFC, 0xBD, 0x34, 0xAE, 0xB7, 0xD5, 0xFD,
+    0x41, 0xF7, 0xC9, 0xB6, 0x35, 0xFB, 0xB0, 0xF8, 0x78, 0xDB, 0x0A, 0x79, 0x53, 0xF6, 0xBF, 0xFB,
+    0xDD, 0xFF, 0xFC, 0xBF, 0xCF, 0x9A, 0x5F, 0xFF, 0x03, 0xD9, 0x31, 0x1E, 0xFA, 0x12, 0x0F, 0x3D,
+    0x79, 0xE2, 0x0F, 0x3E, 0xFF, 0xF3, 0xFD, 0xFF, 0x36, 0x7B, 0xFD, 0xD3, 0x8F, 0x7D, 0xF3, 0xF7,
+    0xFE, 0x11, 0x1E, 0x05, 0x9F, 0x86, 0xDF, 0xE3, 0xD7, 0xBC, 0xDC, 0x04, 0x8E, 0xF1, 0xD8, 0x77,
+    0xF2, 0xFF, 0x83, 0x2F, 0xFE, 0x8B, 0x73, 0x37, 0x7F, 0xFE, 0x27, 0x37, 0x9D, 0xFF, 0x9F, 0x4E,
+    0xF3, 0x47, 0x1F, 0xE7, 0xBB, 0xEB, 0x97, 0xC7, 0x8E, 0xE6, 0xA6, 0xBE, 0x08, 0x50, 0xC5, 0xB9,
+    0xD5, 0xD3, 0xB6, 0x4E, 0x7B, 0xA0, 0x7A, 0xA6, 0x2F, 0x3D, 0xA0, 0x7D, 0x2C, 0x3A, 0xA0, 0xE8,
+    0xB6, 0x55, 0x0F, 0xE4, 0x83, 0x39, 0x1D, 0x00, 0xF6, 0xF5, 0xF5, 0xC0, 0xFC, 0xC1, 0xA1, 0xEA,
+    0x69, 0x9F, 0xB9, 0x17, 0xA2, 0x9D, 0x32, 0x19, 0xEA, 0x7E, 0xDF, 0xEA, 0xEB, 0xB1, 0x86, 0x1D,
+    0xF3, 0xF4, 0x90, 0xB4, 0x67, 0x4B, 0xFB, 0xFD, 0x6D, 0x15, 0xB0, 0x2A, 0x58, 0xE3, 0x22, 0x15,
+    0x51, 0x5F, 0xE9, 0xAE, 0x61, 0x9C, 0x2D, 0xDF, 0x1C, 0x2C, 0xDA, 0xEB, 0x77, 0xFA, 0xBA, 0x46,
+    0xFB, 0x4C, 0xFA, 0x52, 0xC8, 0x3B, 0x8E, 0x3B, 0x4E, 0xC0, 0xE6, 0x03, 0xAC, 0x57, 0x84, 0x03,
+    0x7D, 0x23, 0x5A, 0xE5, 0x1F, 0x06, 0xD0, 0xA7, 0x7D, 0x6D, 0x5E, 0x88, 0xA3, 0x7E, 0x3D, 0x1C,
+    0x54, 0xA7, 0x43, 0xD2, 0x85, 0x5F, 0x87, 0x94, 0xC3, 0xE3, 0xCA, 0xD7, 0xFA, 0xCD, 0x58, 0x5D,
+    0x0E, 0xA3, 0xBE, 0x11, 0xEB, 0xB2, 0x4F, 0xD5, 0xE9, 0x70, 0x4D, 0xFB, 0x70, 0xB2, 0xF0, 0x0F,
+    0xE7, 0x9C, 0x85, 0xBC, 0xDB, 0x55, 0xA1, 0x6A, 0x52, 0xD9, 0x6D, 0xD3, 0x00, 0x4F, 0x14, 0xCD,
+    0xAE, 0xF6, 0xB6, 0xEC, 0xAB, 0xCB, 0x41, 0xDF, 0x18, 0xCA, 0x2E, 0xA9, 0x7E, 0x87, 0xE6, 0x61,
+    0x80, 0xF2, 0xA9, 0xFE, 0x54, 0xD1, 0xA7, 0xAA, 0x49, 0xD5, 0xE5, 0x50, 0x5D, 0x0E, 0xA3, 0x0A,
+    0xD7, 0x8C, 0xBF, 0xA6, 0x6F, 0x0C, 0xFA, 0xF9, 0xB0, 0x45, 0xF3, 0x70, 0x06, 0x5F, 0xA5, 0xE8,
+    0xA9, 0xFB, 0xE2, 0x27, 0xFD, 0xAE, 0x5A, 0xDC, 0x42, 0xD9, 0xE8, 0xDE, 0x74, 0xA6, 0xD3, 0xBD,
+    0x4A, 0x58, 0x57, 0x84, 0xB9, 0x6E, 0x4A, 0xE1, 0x8B, 0x90, 0x27, 0x84, 0x36, 0x1B, 0x8B, 0xC1,
+    0xF8, 0xED, 0x65, 0x7D, 0xDF, 0x84, 0x2F, 0xEE, 0x14, 0x7E, 0xA7, 0x2A, 0xDF, 0x0C, 0xE5, 0xE1,
+    0x65, 0x9F, 0x07, 0x03, 0xAF, 0x6D, 0xF1, 0xA9, 0xED, 0xE1, 0xAC, 0xD5, 0x6F, 0x46, 0xAB, 0xDF,
+    0x8C, 0xC7, 0xB6, 0x87, 0xB3, 0xC4, 0x2D, 0xF2, 0x5E, 0xBB, 0xF2, 0xF5, 0xCB, 0xBE, 0x2A, 0xDF,
+    0x0C, 0x3B, 0x85, 0xDF, 0xF9, 0x26, 0x7C, 0x7E, 0x4E, 0xE8, 0x66, 0xDF, 0x29, 0x42, 0xE5, 0x6D,
+    0x33, 0x65, 0x63, 0x11, 0x8A, 0x50, 0xF9, 0xAA, 0x99, 0x18, 0x55, 0x50, 0x41, 0x7B, 0xED, 0x77,
+    0xD9, 0xCE, 0x86, 0x6C, 0x28, 0x7C, 0xE1, 0x2B, 0x2A, 0x5E, 0xE3, 0xD5, 0xB9, 0x23, 0x22, 0xE3,
+    0x18, 0x75, 0x16, 0xF3, 0xA4, 0xFB, 0xB2, 0xB3, 0xEE, 0x18, 0x9B, 0x47, 0x0C, 0x47, 0xFB, 0xE3,
+    0x51, 0xD6, 0x60, 0xA4, 0x70, 0x73, 0x42, 0x3F, 0x1F, 0x96, 0x42, 0x4B, 0x5C, 0x60, 0xCB, 0xCE,
+    0x52, 0x17, 0xDE, 0x5E, 0x9A, 0x48, 0xCC, 0x02, 0x63, 0xB4, 0x9F, 0xCB, 0x32, 0x45, 0x37, 0xD7,
+    0x03, 0xD6, 0x5F, 0x9E, 0x7B, 0x7B, 0x1F, 0x94, 0x3A, 0xB0, 0x7D, 0x9D, 0xB4, 0x5C, 0x91, 0x5E,
+    0xD2, 0xB7, 0xEC, 0x6F, 0x96, 0x9D, 0x0A, 0x5C, 0x64, 0x0B, 0xED, 0xB5, 0xCF, 0x07, 0x15, 0xB8,
+    0x96, 0x25, 0x2A, 0xB7, 0x4D, 0xE9, 0x4B, 0x4F, 0x44, 0xBC, 0x89, 0x45, 0x44, 0xD6, 0x48, 0x79,
+    0x93, 0x5D, 0xB4, 0xD7, 0x7D, 0x96, 0x18, 0x31, 0x4D, 0x06, 0x67, 0x01, 0xBE, 0x66, 0x42, 0x96,
+    0xEA, 0xA4, 0x62, 0x3B, 0xA9, 0xE1, 0x5B, 0xB6, 0x08, 0xD8, 0xB2, 0x67, 0x4B, 0x77, 0x24, 0xED,
+    0xE7, 0x2C, 0x86, 0x6E, 0xB6, 0x31, 0x6E, 0x1F, 0x83, 0x78, 0x43, 0xDD, 0x9C, 0x5C, 0x22, 0x96,
+    0x63, 0xEC, 0x52, 0x33, 0xD1, 0x32, 0x72, 0x8D, 0x4D, 0x36, 0xE7, 0x74, 0x79, 0x5D, 0x8C, 0xD8,
+    0x4B, 0xD2, 0x99, 0x4E, 0x52, 0x11, 0xBE, 0x64, 0xF3, 0x48, 0xE9, 0x47, 0x54, 0xB0, 0xE4, 0x41,
+    0x7B, 0x15, 0x54, 0xAF, 0x42, 0x36, 0xA8, 0xC0, 0x4E, 0x36, 0x50, 0x51, 0xF7, 0xE5, 0xBA, 0x8D,
+    0x75, 0x93, 0x4D, 0x6A, 0x2C, 0x95, 0xAF, 0x7C, 0xD9, 0x95, 0x3D, 0x0E, 0x07, 0x0E, 0x6C, 0xCC,
+    0x6F, 0xCA, 0xD4, 0x5E, 0x78, 0x5A, 0xE2, 0xEF, 0x70, 0x70, 0x24, 0x77, 0xA7, 0x9F, 0xEA, 0x4F,
+    0x95, 0x4D, 0xAD, 0xDF, 0x8C, 0x36, 0x8F, 0xB5, 0x7E, 0x33, 0xE9, 0x1B, 0xB1, 0xD6, 0xDD, 0x81,
+    0xBE, 0x31, 0x58, 0x15, 0xAE, 0xE9, 0x1B, 0x83, 0xCE, 0xFB, 0x1D, 0xDD, 0x3C, 0x9C, 0x73, 0xF6,
+    0x53, 0xF0, 0x08, 0x85, 0x34, 0xBB, 0xB5, 0x0A, 0xD7, 0xAA, 0xA7, 0x86, 0x54, 0xDC, 0xEC, 0x2B,
+    0xD3, 0xA4, 0xDD, 0xA2, 0x4B, 0x36, 0x97, 0x90, 0x8F, 0xC0, 0x59, 0xB4, 0x67, 0x42, 0x47, 0x3E,
+    0xE8, 0xF4, 0x19, 0x86, 0x1D, 0xFD, 0xA3, 0xA1, 0x96, 0xB0, 0x3A, 0x70, 0x59, 0xA0, 0x68, 0x38,
+    0x71, 0x56, 0x49, 0x67, 0xF6, 0x78, 0x0D, 0x15, 0xD1, 0x73, 0x89, 0x24, 0xA0, 0x7D, 0x36, 0x2A,
+    0xE9, 0x16, 0xF8, 0xB0, 0xD1, 0x94, 0xA2, 0xEE, 0x92, 0xA8, 0xAE, 0x16, 0xD2, 0x5F, 0xBB, 0x70,
+    0xA6, 0x89, 0x51, 0x5F, 0xB9, 0x3E, 0xD4, 0x13, 0xAD, 0x3B, 0xB1, 0xD2, 0x72, 0xEF, 0x9D, 0x7B,
+    0x3E, 0x9D, 0xDD, 0xE7, 0x22, 0xDB, 0x58, 0x2A, 0xA7, 0x7D, 0xD1, 0xCD, 0x45, 0x1A, 0x3E, 0xEB,
+    0x0A, 0x69, 0xB6, 0xAB, 0x3C, 0xEC, 0x14, 0x37, 0xFB, 0x72, 0xA4, 0x1E, 0x8A, 0xC3, 0xB0, 0x5D,
+    0x74, 0xB1, 0xCA, 0x65, 0xC8, 0x27, 0x78, 0x84, 0x52, 0xB8, 0x56, 0xAB, 0x7E, 0x47, 0x3F, 0x15,
+    0xB6, 0x4B, 0xDF, 0x0A, 0xED, 0x80, 0x69, 0xF2, 0x54, 0x48, 0xA3, 0x7B, 0x36, 0x32, 0x37, 0xB6,
+    0xDC, 0xDB, 0x57, 0xEF, 0x06, 0x7D, 0xA5, 0xD9, 0xD9, 0xCA, 0xFB, 0xBF, 0xD0, 0xCF, 0xA4, 0x53,
+    0xBA, 0x01, 0xA8, 0x1B, 0x2D, 0xFE, 0x9A, 0x7D, 0xA6, 0xBF, 0x58, 0x65, 0x43, 0x2A, 0x6F, 0xF6,
+    0xD6, 0x34, 0x71, 0xBB, 0xF4, 0xD3, 0x41, 0x26, 0x1D, 0xFF, 0x05, 0xC0, 0x8E, 0x4E, 0x0F, 0x25,
+    0x22, 0x43, 0x36, 0xE4, 0x41, 0x05, 0xD5, 0x3F, 0x3A, 0xD4, 0xE9, 0xC4, 0x59, 0xDA, 0x46, 0x8B,
+    0x4F, 0x55, 0xEE, 0xF7, 0x29, 0x7A, 0x76, 0x29, 0x7A, 0xAE, 0xA1, 0x3D, 0x22, 0xA7, 0x25, 0xB1,
+    0x22, 0x9B, 0x94, 0xF4, 0x21, 0x6D, 0x6E, 0x53, 0x67, 0xE2, 0xBE, 0x11, 0xD8, 0xC1, 0x9E, 0x68,
+    0xCF, 0xC8, 0x53, 0x2F, 0x41, 0x16, 0xA8, 0x7C, 0x3E, 0x51, 0x0D, 0xD9, 0x1D, 0x6F, 0x4C, 0x16,
+    0xF6, 0x8D, 0x8C, 0x56, 0x02, 0x3B, 0x64, 0x81, 0xCC, 0xB1, 0xF7, 0x92, 0x12, 0x5F, 0xAD, 0x88,
+    0xA8, 0x89, 0xE3, 0x13, 0x24, 0xF2, 0x80, 0x69, 0xBE, 0x9C, 0x94, 0x34, 0xC7, 0xAF, 0x82, 0xE9,
+    0xCD, 0x54, 0x0E, 0x59, 0xC4, 0xC6, 0x42, 0xC2, 0xBE, 0x79, 0xB1, 0x89, 0x49, 0x3F, 0xFB, 0xA3,
+    0x60, 0x13, 0xFF, 0x90, 0x2F, 0xEC, 0x9D, 0x97, 0x7B, 0x2F, 0xFC, 0x85, 0x8F, 0x44, 0xD6, 0x4C,
+    0x35, 0x4D, 0xE9, 0xB9, 0x0A, 0x75, 0x53, 0xDE, 0xF6, 0x3B, 0x26, 0x0F, 0xFB, 0xEA, 0x9E, 0x2F,
+    0x13, 0x77, 0x53, 0x79, 0x63, 0xD8, 0x2E, 0xBA, 0xB1, 0xCE, 0xA4, 0xE7, 0x1C, 0xB4, 0x4E, 0x4B,
+    0x93, 0x2A, 0xD5, 0xED, 0xE8, 0xA7, 0x82, 0xFD, 0x8A, 0xAF, 0x27, 0xFE, 0xA3, 0x40, 0xE5, 0x1E,
+    0x1D, 0x8A, 0x89, 0x8D, 0x45, 0xD4, 0x8C, 0x48, 0x5F, 0x8A, 0x44, 0xEC, 0x0F, 0x2F, 0xA2, 0x7B,
+    0x8D, 0x1A, 0x54, 0x93, 0xDD, 0x0F, 0x60, 0x24, 0xA0, 0x25, 0x52, 0xDC, 0x3D, 0x47, 0x9E, 0xE0,
+    0xB8, 0xBC, 0x44, 0x2E, 0x73, 0xED, 0x91, 0x62, 0x00, 0x23, 0xFD, 0xDC, 0x72, 0x32, 0xE7, 0x09,
+    0x8B, 0x25, 0xCD, 0x50, 0x84, 0x11, 0x15, 0x8C, 0xCB, 0x63, 0xE1, 0x18, 0xE1, 0x78, 0xFB, 0x0F,
+    0x9C, 0x12, 0xF1, 0x9C, 0xFF, 0xE9, 0x59, 0xBE, 0xFC, 0xFE, 0x39, 0xAC, 0x24, 0x8E, 0x4F, 0xDF,
+    0x9B, 0x8B, 0xB7, 0xC6, 0x83, 0x7C, 0xF8, 0x72, 0xA8, 0x45, 0xA2, 0x79, 0xBB, 0x4D, 0x4B, 0x10,
+    0x78, 0x6E, 0xDD, 0xA9, 0x35, 0x4F, 0x6F, 0x65, 0x2E, 0x54, 0xFF, 0x86, 0x98, 0xE5, 0x8D, 0xE7,
+    0xE7, 0x8C, 0xB3, 0xEE, 0x6C, 0x33, 0x00, 0x45, 0xD0, 0xFD, 0x3E, 0x90, 0xA7, 0x62, 0xB0, 0x67,
+    0xF3, 0xEF, 0x20, 0x2A, 0xC9, 0x54, 0x0A, 0xF6, 0xAD, 0x54, 0x7D, 0x58, 0xFC, 0x9F, 0x5E, 0x4B,
+    0x54, 0x43, 0x1E, 0x28, 0xE4, 0x2A, 0x89, 0x76, 0x8E, 0x77, 0xD0, 0x03, 0x02, 0xC6, 0xD3, 0x3A,
+    0xDB, 0x50, 0xF6, 0xFF, 0x71, 0xD9, 0x9B, 0x1E, 0x75, 0xF7, 0xCE, 0xF5, 0xC1, 0x8A, 0x43, 0xEE,
+    0x4A, 0xAA, 0xA4, 0xC3, 0x0C, 0x1F, 0xAD, 0x02, 0x9C, 0x85, 0x5C, 0x22, 0x99, 0x88, 0xA7, 0xFE,
+    0x77, 0xFB, 0x98, 0xBE, 0x6C, 0x54, 0xE4, 0x3B, 0xD4, 0x4B, 0x4A, 0x58, 0x8B, 0x34, 0x18, 0x0F,
+    0xD5, 0x3A, 0x46, 0xCD, 0x12, 0x33, 0x64, 0x46, 0xDC, 0x06, 0xA5, 0xBC, 0xDC, 0x53, 0x49, 0x82,
+    0xFA, 0x68, 0xE6, 0xFC, 0x33, 0x4B, 0x25, 0x55, 0x77, 0xCB, 0xB3, 0x88, 0x1C, 0x8A, 0x48, 0x68,
+    0xF7, 0xF6, 0x52, 0xD9, 0x2D, 0x4D, 0x9B, 0xA5, 0x07, 0x1A, 0xE0, 0x53, 0xA0, 0x3D, 0x3A, 0xA1,
+    0xC5, 0x9B, 0x76, 0x2C, 0xBF, 0xFF, 0xFD, 0xE6, 0xE6, 0xBB, 0x9E, 0x04, 0x16, 0xB4, 0x5F, 0x3A,
+    0x09, 0x3F, 0x7A, 0xF1, 0xC0, 0xF6, 0xFA, 0x25, 0x0D, 0x61, 0x3C, 0x90, 0xEE, 0xDF, 0x6A, 0xDA,
+    0x7B, 0x39, 0xCE, 0x41, 0x7A, 0x1E, 0x17, 0x43, 0xFF, 0x29, 0x78, 0xE4, 0x97, 0x4E, 0x38, 0x5F,
+    0xDC, 0x7C, 0xCF, 0xA7, 0x31, 0x69, 0x49, 0x48, 0x42, 0xA7, 0xA5, 0xEF, 0x0E, 0x3E, 0x97, 0xC3,
+    0x76, 0x1E, 0xB0, 0xAE, 0x66, 0x1B, 0x15, 0xAC, 0x88, 0x18, 0x11, 0xF9, 0xC1, 0x87, 0x7B, 0xAF,
+    0xF4, 0x95, 0x2B, 0x7A, 0x15, 0xCB, 0xC0, 0x56, 0x16, 0xC8, 0xD8, 0x84, 0x6F, 0x51, 0x0C, 0xD4,
+    0x43, 0x21, 0xC3, 0xEE, 0x34, 0xDC, 0xB9, 0xE3, 0xB5, 0xC7, 0x42, 0x42, 0x85, 0xEC, 0xCC, 0xBF,
+    0x36, 0x76, 0xCB, 0x4A, 0xB0, 0x82, 0x0D, 0xD8, 0x35, 0x44, 0x28, 0x9B, 0x85, 0x01, 0x5A, 0x52,
+    0xF1, 0xFD, 0xEF, 0xBB, 0xBF, 0xFF, 0xAE, 0x9B, 0xA9, 0xCA, 0xCE, 0xFC, 0xEB, 0xEC, 0xCE, 0x9D,
+    0xCE, 0x4A, 0x50, 0x12, 0xB0, 0x81, 0xBC, 0x47, 0x24, 0x59, 0x11, 0x3D, 0x77, 0xF0, 0xA0, 0x02,
+    0xF3, 0xFC, 0x11, 0xD5, 0xA3, 0x9B, 0x27, 0xB7, 0xF3, 0x18, 0xAB, 0x4B, 0xB7, 0x06, 0xFD, 0x8A,
+    0x4C, 0x22, 0x71, 0xDA, 0xBB, 0x9A, 0xC8, 0x46, 0xB2, 0x81, 0xCC, 0x1D, 0xFD, 0x7C, 0x42, 0x05,
+    0x4A, 0x4F, 0x55, 0xB2, 0x7F, 0x90, 0x87, 0x83, 0xD2, 0xEF, 0x56, 0x32, 0xB5, 0x32, 0xEE, 0xBD,
+    0xE2, 0x49, 0x18, 0xCF, 0xC5, 0xC5, 0x0F, 0x2D, 0xCD, 0x88, 0x95, 0x7B, 0x8C, 0x6B, 0x59, 0xCA,
+    0x06, 0xE3, 0x8B, 0xEB, 0x11, 0xA3, 0x45, 0x52, 0x2D, 0x12, 0x0E, 0xF6, 0xF6, 0x9A, 0x6B, 0x4B,
+    0xA6, 0x24, 0x2E, 0x9B, 0x0A, 0xA0, 0x9A, 0xD9, 0x63, 0xAA, 0x00, 0xEA, 0xC3, 0xBD, 0x57, 0x94,
+    0x88, 0x1C, 0x7E, 0xB8, 0xB7, 0xF7, 0x9D, 0x00, 0x54, 0x22, 0x92, 0x8B, 0x88, 0xAF, 0xFE, 0x93,
+    0xD5, 0x57, 0xF3, 0xB0, 0x6E, 0x0E, 0x74, 0x0F, 0x60, 0x1D, 0x76, 0xCE, 0x6D, 0x59, 0x8B, 0x8A,
+    0x2D, 0xF6, 0x96, 0xA8, 0x0F, 0xAE, 0xD4, 0xC5, 0xE3, 0x4F, 0x7C, 0x89, 0xE7, 0x5E, 0x25, 0xBB,
+    0xD5, 0x51, 0x5E, 0x71, 0x9C, 0x3C, 0x09, 0xAF, 0xBD, 0x46, 0x7E, 0xAB, 0xA7, 0xBC, 0xD2, 0x70,
+    0xF2, 0xE4, 0x11, 0xE1, 0x28, 0xD7, 0x05, 0x7C, 0xCB, 0xF6, 0xDE, 0xCB, 0x41, 0x8B, 0x48, 0xBE,
+    0xB7, 0xF7, 0x72, 0x00, 0x4E, 0x59, 0x91, 0x49, 0x8B, 0x4C, 0xF9, 0xEA, 0xDC, 0xEE, 0xE2, 0xF9,
+    0x2D, 0x50, 0xAC, 0x03, 0xCC, 0xCD, 0x8F, 0x4C, 0xB9, 0xDC, 0xA1, 0xB8, 0xE2, 0x78, 0xFC, 0x09,
+    0x78, 0xEE, 0x55, 0xFE, 0xD7, 0x5B, 0x37, 0x2F, 0xDD, 0xBB, 0xD2, 0xAA, 0xA9, 0x0A, 0x79, 0x3C,
+    0x20, 0xFF, 0xA0, 0x27, 0x9F, 0xE6, 0x9E, 0x0B, 0x80, 0xCD, 0x63, 0xA0, 0x95, 0x47, 0x37, 0xFB,
+    0xE8, 0x1F, 0x9E, 0xF7, 0x5A, 0x24, 0xE9, 0xBD, 0xBD, 0x97, 0x5F, 0xF7, 0x30, 0xB4, 0x22, 0x51,
+    0x8B, 0x44, 0x52, 0x96, 0xD0, 0x3E, 0x41, 0x58, 0x3A, 0x3E, 0x4E, 0x38, 0xB2, 0xFF, 0x74, 0x82,
+    0x03, 0x13, 0xD0, 0x5E, 0x5C, 0x96, 0xCA, 0x88, 0x75, 0xF6, 0xE7, 0x2F, 0x07, 0x25, 0x32, 0xCD,
+    0xD5, 0x6B, 0x21, 0xA2, 0x87, 0xCA, 0x51, 0x5F, 0x0A, 0xA8, 0x74, 0x11, 0xAA, 0xB7, 0x3C, 0xD9,
+    0x14, 0x41, 0x0B, 0xD0, 0xF6, 0x4B, 0xEA, 0xCA, 0x36, 0x4B, 0x6B, 0xD9, 0x71, 0x87, 0x9D, 0xB0,
+    0xD2, 0x7F, 0x26, 0x9F, 0x0F, 0x0B, 0xE9, 0x9E, 0x3C, 0xD1, 0x4A, 0x26, 0x72, 0x7D, 0xBA, 0x10,
+    0xC6, 0x3C, 0x1E, 0x30, 0x59, 0x67, 0xCF, 0x7B, 0xFD, 0x7A, 0x28, 0xDE, 0x4E, 0x6A, 0xA8, 0xF3,
+    0xA4, 0xFF, 0x2C, 0xE5, 0x92, 0xD6, 0x75, 0xD5, 0x13, 0xAB, 0x95, 0x11, 0xF9, 0x91, 0x48, 0xFC,
+    0xF6, 0xEF, 0x4F, 0xD0, 0x36, 0x54, 0x3D, 0x65, 0x24, 0x9F, 0xAC, 0xC8, 0x8B, 0x22, 0xB7, 0xF6,
+    0xFE, 0x59, 0x24, 0x7F, 0xF0, 0x3F, 0x77, 0xA7, 0x97, 0xA7, 0x56, 0xE4, 0x82, 0xAC, 0xE1, 0xD7,
+    0x43, 0x77, 0xB3, 0x4E, 0x89, 0xFC, 0xB1, 0xAB, 0x45, 0x06, 0x35, 0xD2, 0x7A, 0xEB, 0x91, 0xA7,
+    0x46, 0xF4, 0x54, 0x06, 0x3E, 0x4C, 0xD6, 0xE9, 0xCB, 0x61, 0x24, 0xEA, 0xC3, 0xA0, 0x9B, 0x5A,
+    0x77, 0x31, 0x4B, 0xF6, 0x4C, 0x53, 0x86, 0x29, 0x61, 0x5F, 0x10, 0x9F, 0x25, 0x95, 0x30, 0xBD,
+    0x9E, 0xBE, 0x2C, 0xB4, 0x22, 0xA1, 0x7C, 0x5D, 0x46, 0x3E, 0xCD, 0xEA, 0xFE, 0x6E, 0xBF, 0xB6,
+    0xE4, 0x3E, 0xDA, 0x25, 0x38, 0x37, 0x02, 0xFA, 0x95, 0x8E, 0xE2, 0x66, 0x42, 0x05, 0x81, 0x68,
+    0x7A, 0xF6, 0x55, 0xC2, 0x22, 0xCE, 0x34, 0xA6, 0xD7, 0x5E, 0xA5, 0x22, 0x20, 0x4F, 0x0F, 0x98,
+    0x30, 0x52, 0xA4, 0x5A, 0x44, 0x2E, 0x88, 0x48, 0xB7, 0xB1, 0x5A, 0xAD, 0xB4, 0x88, 0xFC, 0x48,
+    0x44, 0x82, 0xB8, 0x3C, 0x55, 0x3D, 0xE3, 0x5F, 0xFA, 0xA6, 0xEA, 0x69, 0x9F, 0x1E, 0x30, 0x7D,
+    0x9A, 0xF7, 0xA0, 0xBD, 0x00, 0xE6, 0x76, 0x83, 0x12, 0x0F, 0xED, 0x91, 0x2C, 0xE9, 0xAC, 0xE2,
+    0xAB, 0x95, 0x7B, 0x54, 0x24, 0x54, 0x22, 0xC9, 0x7E, 0xB8, 0xF7, 0xBD, 0xAA, 0x9F, 0xD3, 0x15,
+    0x45, 0x58, 0xB2, 0x36, 0xAD, 0x88, 0xB4, 0x22, 0xF2, 0xCE, 0x87, 0x7B, 0x7B, 0x7B, 0x69, 0xE9,
+    0x6A, 0xD4, 0x01, 0x32, 0x71, 0x60, 0x44, 0xA6, 0x4C, 0x44, 0xFC, 0x71, 0x91, 0x30, 0x77, 0x89,
+    0x60, 0x61, 0xE3, 0xC2, 0xBF, 0xC9, 0xDA, 0x59, 0x8F, 0x0E, 0xE5, 0xE5, 0xE9, 0x8F, 0x26, 0x46,
+    0x04, 0x4B, 0x4D, 0xD5, 0x54, 0x5E, 0x77, 0xA5, 0x88, 0xDC, 0x13, 0x91, 0xA9, 0xDD, 0x9B, 0xF6,
+    0x5E, 0xF1, 0xBB, 0x14, 0x43, 0xE5, 0x10, 0xED, 0x31, 0xF7, 0x7A, 0x72, 0x11, 0xE9, 0x8D, 0x48,
+    0xA2, 0x15, 0xB9, 0xEF, 0xC6, 0x00, 0x78, 0x54, 0xA4, 0x69, 0x45, 0x82, 0x88, 0xA4, 0xF6, 0xEA,
+    0xDC, 0x5D, 0x59, 0x79, 0x38, 0x32, 0xE1, 0xDE, 0xDE, 0x1F, 0xAF, 0x53, 0x95, 0xED, 0x4F, 0xE7,
+    0x8E, 0x7E, 0x5F, 0x8B, 0x04, 0x7E, 0x7F, 0xEF, 0xA5, 0xA5, 0xB9, 0xAD, 0xD1, 0x22, 0x53, 0xB6,
+    0xB7, 0xD7, 0xF6, 0x90, 0x4F, 0xEB, 0x36, 0xD8, 0x01, 0x98, 0x5A, 0x11, 0x79, 0x45, 0x44, 0x3E,
+    0xDC, 0xDB, 0x7B, 0x39, 0x1E, 0x69, 0xF2, 0xB7, 0x1E, 0xEA, 0x1F, 0x88, 0x48, 0x27, 0x22, 0x9D,
+    0x95, 0xC9, 0xB1, 0xB1, 0x68, 0xF1, 0xC6, 0x74, 0x0E, 0x25, 0x12, 0x11, 0x91, 0xFE, 0xB3, 0xF2,
+    0xF2, 0x84, 0xF1, 0x55, 0xAF, 0x82, 0x4A, 0x1C, 0x60, 0x9D, 0xF1, 0xFA, 0x1D, 0x11, 0xF9, 0x50,
+    0x44, 0x64, 0xEF, 0x95, 0x9F, 0xB7, 0x4D, 0x3E, 0xE8, 0x9E, 0xDD, 0x62, 0x40, 0x1F, 0x26, 0xF2,
+    0x7B, 0x63, 0x35, 0x6B, 0xFC, 0xA8, 0xE6, 0xFE, 0x6A, 0xBB, 0xF4, 0x91, 0x01, 0xAD, 0xDC, 0xC5,
+    0xCE, 0x3A, 0x29, 0x1E, 0x1E, 0x8D, 0x0B, 0x76, 0x38, 0x32, 0xE1, 0xDE, 0x5E, 0xDB, 0x2C, 0x1E,
+    0xED, 0xDD, 0xD5, 0xEA, 0x42, 0x14, 0x91, 0x68, 0x45, 0x86, 0xE3, 0x7B, 0xFF, 0xDC, 0x71, 0x62,
+    0xB5, 0xC8, 0x8B, 0xDC, 0x10, 0x11, 0xE9, 0xF4, 0x40, 0xED, 0x55, 0xC2, 0x04, 0x84, 0x22, 0x61,
+    0x7D, 0x26, 0xE8, 0xF0, 0xD7, 0x7B, 0x33, 0xD2, 0x76, 0x56, 0xDE, 0x14, 0xD1, 0x32, 0xD4, 0xE2,
+    0x37, 0x56, 0xAB, 0x73, 0x46, 0x24, 0x55, 0x22, 0xC9, 0x04, 0xAE, 0x95, 0x91, 0x2D, 0x35, 0x72,
+    0x2A, 0x13, 0xA0, 0x6D, 0xE6, 0x94, 0x9B, 0x09, 0x73, 0x11, 0x40, 0x0D, 0xB3, 0x2C, 0x55, 0x7E,
+    0xE6, 0xF2, 0xC8, 0x31, 0x15, 0x31, 0x65, 0xC0, 0x1A, 0x4F, 0x6B, 0x97, 0xEE, 0x03, 0x23, 0x73,
+    0xBD, 0xF6, 0xEB, 0x7B, 0xDF, 0x6D, 0x65, 0xDC, 0xDB, 0xFB, 0xEE, 0x1C, 0xED, 0x18, 0x0F, 0x69,
+    0xCE, 0xC9, 0xD9, 0x5F, 0xF6, 0x8E, 0xFE, 0x55, 0xEF, 0x30, 0x37, 0xE0, 0x96, 0x3D, 0x24, 0xA8,
+    0x1A, 0x8A, 0x00, 0x23, 0x18, 0x8F, 0x1A, 0xA0, 0x05, 0xED, 0xC9, 0xE3, 0xEC, 0x85, 0x67, 0x90,
+    0x61, 0x1D, 0x73, 0x65, 0x88, 0xAA, 0x59, 0xB2, 0x30, 0x0F, 0xC3, 0x0E, 0xEC, 0x70, 0x6A, 0xE7,
+    0xB9, 0xF6, 0x20, 0x19, 0xE9, 0x95, 0x38, 0x23, 0x7D, 0xDB, 0xA6, 0x53, 0x3B, 0xCF, 0x6D, 0xEE,
+    0xC0, 0x0E, 0x3C, 0x4C, 0xF6, 0x52, 0x26, 0xC1, 0xB6, 0x6F, 0xF8, 0xFD, 0xFD, 0xE2, 0x0D, 0xBF,
+    0xB3, 0x7B, 0xFE, 0x50, 0x86, 0x32, 0x02, 0xD5, 0x33, 0xA9, 0x3E, 0x7C, 0x90, 0x5C, 0x2E, 0xBB,
+    0xC5, 0x37, 0x44, 0xE0, 0xE2, 0x12, 0xF7, 0xE9, 0x66, 0x8E, 0xF5, 0xF2, 0x00, 0xA4, 0x7C, 0x8F,
+    0xAD, 0x4C, 0xBC, 0xA1, 0x0E, 0xA5, 0x67, 0x54, 0x3D, 0xD5, 0xF3, 0x01, 0x15, 0xF6, 0x21, 0x6D,
+    0x43, 0x75, 0xC6, 0x51, 0xBC, 0xB3, 0x94, 0x5A, 0xAA, 0x61, 0x69, 0x43, 0x9A, 0x96, 0x6E, 0xCB,
+    0xB3, 0x3C, 0x2D, 0xD9, 0xBB, 0xF2, 0x5E, 0x4C, 0x76, 0xD8, 0x52, 0x83, 0x76, 0xA3, 0x0A, 0xD2,
+    0xB5, 0x69, 0xD2, 0x49, 0xFB, 0x73, 0x7C, 0x35, 0x73, 0x99, 0x33, 0x83, 0x09, 0x76, 0xAC, 0xD3,
+    0x45, 0x3B, 0xEC, 0xEF, 0xEB, 0xEE, 0xD4, 0xBE, 0xEE, 0x4F, 0xED, 0x57, 0xC3, 0x7E, 0x9D, 0xDA,
+    0x58, 0x85, 0x2A, 0x6C, 0xB8, 0x0D, 0x77, 0x62, 0x01, 0x53, 0x2A, 0x2C, 0xB1, 0xAA, 0xFD, 0x64,
+    0x6F, 0xC8, 0x8C, 0x16, 0x64, 0x91, 0xED, 0x79, 0xBC, 0xCA, 0x8C, 0x7D, 0x67, 0x85, 0x4C, 0x4B,
+    0xD9, 0x21, 0x1F, 0x99, 0xB3, 0xC6, 0x4C, 0xCB, 0x09, 0x10, 0x5A, 0x96, 0x2A, 0x52, 0xDD, 0xAC,
+    0x1B, 0xD8, 0x3D, 0xE4, 0x22, 0x32, 0x55, 0x22, 0x72, 0x57, 0x44, 0xA4, 0x3F, 0x51, 0xFF, 0x92,
+    0xF1, 0x85, 0xBF, 0x46, 0x1E, 0x70, 0xEE, 0x57, 0xB3, 0xEB, 0x13, 0x57, 0xB2, 0xB4, 0xB1, 0xE5,
+    0xF7, 0x02, 0x58, 0xEB, 0x28, 0xDF, 0x4E, 0x30, 0x6A, 0x8F, 0xF1, 0x07, 0xA8, 0x58, 0x04, 0x2C,
+    0xD6, 0x95, 0x21, 0x4F, 0x8C, 0x68, 0x6F, 0x3C, 0x93, 0x8A, 0x14, 0xC1, 0x82, 0x7D, 0x36, 0x90,
+    0xA7, 0x87, 0x61, 0xE3, 0x99, 0x40, 0x1E, 0xAD, 0xC3, 0x3E, 0x1D, 0x29, 0x83, 0xF1, 0x8C, 0x4C,
+    0x18, 0x5F, 0x84, 0x3C, 0x62, 0x9D, 0x75, 0x79, 0x2C, 0x02, 0xDA, 0x8F, 0xF3, 0xCC, 0xC5, 0x7B,
+    0x11, 0x6C, 0x0D, 0xB9, 0x84, 0xA5, 0xBF, 0x4C, 0x96, 0xA2, 0x0C, 0x16, 0xB8, 0xF0, 0xEF, 0xD0,
+    0x73, 0xE3, 0x44, 0x39, 0x14, 0xD1, 0xBA, 0xE2, 0xDD, 0x84, 0xFE, 0x51, 0x4F, 0x75, 0xBE, 0xE1,
+    0xDA, 0x2E, 0xF9, 0xFB, 0x91, 0xF2, 0x57, 0x5F, 0x76, 0x0F, 0xC3, 0xDF, 0xFB, 0xB5, 0x9F, 0x3A,
+    0x72, 0x39, 0x24, 0xF4, 0x61, 0xA4, 0x2D, 0xA7, 0x0B, 0xB1, 0x14, 0x69, 0x0A, 0x19, 0x96, 0x28,
+    0xE3, 0xB3, 0x0E, 0x25, 0x1E, 0x2B, 0x4D, 0x9E, 0x76, 0xD0, 0xC1, 0x61, 0x1B, 0x98, 0xE6, 0x5D,
+    0xD3, 0xCB, 0xC1, 0x81, 0x4F, 0x70, 0x99, 0xBD, 0x3D, 0xA2, 0x6F, 0x07, 0xAC, 0x2C, 0x15, 0xA3,
+    0x7C, 0x6D, 0xC4, 0xDB, 0x66, 0x09, 0x01, 0x7E, 0xD9, 0xB8, 0x4A, 0x76, 0x55, 0x50, 0x63, 0xED,
+    0x91, 0x33, 0x3D, 0x95, 0x3F, 0x4B, 0xE6, 0x1E, 0x77, 0x9C, 0x34, 0x01, 0xFB, 0xA3, 0x84, 0x1E,
+    0xC6, 0xD9, 0xE7, 0xFD, 0xB2, 0xF1, 0xC8, 0x22, 0x87, 0x65, 0x84, 0x6C, 0x5C, 0xDC, 0x1D, 0x17,
+    0xF5, 0xDB, 0xA3, 0x5E, 0x63, 0xCB, 0x47, 0x8A, 0x20, 0x65, 0xBF, 0xC9, 0x27, 0x98, 0xF6, 0x17,
+    0x92, 0xF5, 0x2B, 0x12, 0x18, 0x8F, 0xF6, 0xD9, 0x0B, 0x72, 0xD7, 0x9C, 0x7F, 0x4B, 0xD2, 0x73,
+    0x0F, 0x3A, 0x8C, 0x3F, 0xBB, 0xB7, 0xF7, 0xDD, 0x5A, 0xE4, 0xFD, 0x23, 0xEA, 0xB4, 0x5C, 0xBE,
+    0xB9, 0x5A, 0xAD, 0xC0, 0xA1, 0xA6, 0xFC, 0xA6, 0xDC, 0x8D, 0x77, 0xDB, 0xF1, 0x94, 0x1A, 0x01,
+    0x5A, 0xF7, 0xAD, 0x76, 0xDC, 0xB5, 0xB5, 0x9C, 0xC9, 0xA4, 0x71, 0x1B, 0x6C, 0xC2, 0xE6, 0xB4,
+    0xF7, 0xCA, 0xA1, 0x88, 0x64, 0xAF, 0x4C, 0xF7, 0x2B, 0xE5, 0xDF, 0x90, 0x97, 0xB4, 0x48, 0xB2,
+    0x7B, 0x2F, 0x07, 0xB7, 0x9C, 0x08, 0xC8, 0x3A, 0x54, 0xD7, 0xCA, 0xD8, 0xCA, 0xF8, 0xF5, 0xF6,
+    0xBB, 0xEC, 0x70, 0xE2, 0xEE, 0xB9, 0xF9, 0x52, 0x37, 0xE8, 0x75, 0x1B, 0x54, 0xB6, 0x20, 0x95,
+    0x85, 0xF2, 0x6C, 0x6F, 0x6F, 0xEF, 0xB2, 0x88, 0x9C, 0x97, 0xFB, 0xDD, 0x37, 0xC5, 0x7C, 0x39,
+    0x9E, 0x58, 0xAD, 0xCE, 0xC2, 0xEF, 0x90, 0x27, 0xAA, 0x21, 0x17, 0x57, 0xF5, 0xB4, 0x8E, 0xBA,
+    0xA7, 0x98, 0xA0, 0xEE, 0x29, 0xD3, 0x0C, 0xA3, 0x56, 0xAB, 0xE5, 0x36, 0x73, 0x2F, 0x72, 0xDD,
+    0xCC, 0xC7, 0x4F, 0x1A, 0x4C, 0x24, 0x1F, 0x79, 0x34, 0x66, 0xD2, 0x98, 0x48, 0xDD, 0xF0, 0xE4,
+    0xBA, 0x17, 0xE9, 0xFE, 0xE7, 0x01, 0x1E, 0x27, 0xF7, 0xD4, 0xBE, 0x0C, 0x99, 0x34, 0x17, 0x86,
+    0x62, 0xCA, 0xE4, 0xAA, 0x89, 0x6A, 0xA2, 0x1C, 0xB2, 0x09, 0xDA, 0xAE, 0x1A, 0x28, 0xC4, 0xB5,
+    0x1D, 0x66, 0xCC, 0xC5, 0x51, 0x7B, 0x3D, 0x90, 0xF5, 0xF3, 0xE1, 0xBA, 0x65, 0xFC, 0x26, 0x79,
+    0x87, 0x8A, 0x88, 0xA3, 0xEE, 0x1F, 0x1D, 0xC9, 0xDA, 0xAE, 0x1A, 0xC8, 0x85, 0xB6, 0xA3, 0xEA,
+    0x8A, 0x48, 0xDD, 0x9B, 0x98, 0x49, 0x53, 0x87, 0x62, 0xCA, 0xA4, 0x2B, 0x22, 0xE2, 0x18, 0xD6,
+    0x27, 0xFB, 0x7F, 0x85, 0x4F, 0xEF, 0x17, 0x43, 0xD6, 0x2E, 0x00, 0xF9, 0x97, 0xF8, 0xF4, 0x07,
+    0x20, 0x0B, 0xD3, 0x40, 0xD9, 0xF1, 0xD9, 0x8F, 0x60, 0x22, 0x8B, 0x6D, 0xAA, 0xA6, 0xF2, 0xDA,
+    0x97, 0x41, 0x05, 0x15, 0xF3, 0x81, 0x96, 0x44, 0xE5, 0x77, 0x51, 0xA9, 0x72, 0xB4, 0xB7, 0x7F,
+    0xF8, 0x00, 0x13, 0x65, 0xD3, 0xDE, 0x4B, 0x1C, 0x1C, 0x31, 0xCD, 0xF7, 0xCF, 0xC9, 0xA0, 0xFD,
+    0x02, 0x02, 0x07, 0x5A, 0x19, 0x8F, 0x90, 0xAC, 0x7F, 0x1C, 0x29, 0xFA, 0x16, 0x35, 0xE8, 0x9E,
+    0xA4, 0x22, 0x07, 0xB4, 0x58, 0x6C, 0x63, 0xBC, 0xEE, 0xCA, 0x4E, 0xBF, 0xFB, 0xE5, 0xF7, 0x8F,
+    0x90, 0xDC, 0x7E, 0xCF, 0x61, 0x9A, 0x23, 0x76, 0x7F, 0xDD, 0x9D, 0x49, 0x25, 0xD2, 0xD5, 0x22,
+    0x43, 0xFD, 0xE1, 0xDE, 0x77, 0x6D, 0xB7, 0xE4, 0x3D, 0xC2, 0x12, 0x35, 0x3F, 0x00, 0x99, 0xDF,
+    0x5E, 0x9D, 0xAD, 0x44, 0xC6, 0x4C, 0x44, 0x5C, 0xF6, 0x0F, 0xF6, 0x9A, 0xE5, 0x90, 0xC8, 0x58,
+    0x89, 0xC8, 0xB3, 0x22, 0xD2, 0x9D, 0x58, 0x9D, 0xC5, 0x88, 0xF4, 0x85, 0x88, 0xB8, 0xBD, 0xBD,
+    0x76, 0x80, 0x4C, 0x16, 0xCC, 0xA8, 0x86, 0xE5, 0xC0, 0x6C, 0xED, 0xC0, 0x5E, 0x5F, 0xAD, 0xDA,
+    0x37, 0x45, 0xA4, 0xAF, 0x45, 0xBA, 0x87, 0xF6, 0xBE, 0x7D, 0x5F, 0x48, 0x63, 0x2D, 0x32, 0x19,
+    0x11, 0x69, 0xC8, 0xBE, 0xC7, 0x7C, 0x30, 0xCC, 0xBC, 0xF5, 0xC7, 0x5D, 0x36, 0x9C, 0x2C, 0x3A,
+    0xCD, 0x6B, 0x85, 0x7F, 0x2D, 0xEF, 0xCB, 0x4B, 0xBE, 0x6C, 0xF4, 0xE3, 0x9C, 0x64, 0x6B, 0x77,
+    0x6F, 0xDA, 0xFB, 0x0B, 0x11, 0x91, 0x9F, 0xFD, 0xF0, 0x2B, 0xDF, 0x3E, 0x7F, 0x9E, 0x93, 0x6C,
+    0x9D, 0xE2, 0x35, 0xC2, 0x6B, 0x79, 0x5F, 0x36, 0x43, 0xD9, 0xEC, 0x64, 0xF1, 0x64, 0xD9, 0x65,
+    0xD3, 0xFF, 0x36, 0x42, 0x2B, 0xCD, 0x7C, 0x68, 0xF6, 0xC8, 0xD4, 0xFF, 0xE6, 0x7C, 0x97, 0x0D,
+    0x14, 0x9D, 0x76, 0x14, 0xFE, 0x35, 0x28, 0x2F, 0x79, 0xD0, 0x06, 0xD8, 0xDA, 0xDD, 0xDB, 0x5B,
+    0x4F, 0xBD, 0x5A, 0x9D, 0x3F, 0x0F, 0x6C, 0x9D, 0x02, 0xC2, 0x6B, 0x50, 0x36, 0x03, 0xEC, 0x64,
+    0x91, 0xB2, 0xCB, 0xA6, 0xDF, 0xFF, 0x75, 0x53, 0x07, 0xAC, 0xFF, 0xD3, 0xA0, 0xDE, 0xB9, 0x74,
+    0x18, 0xB6, 0xF5, 0xE3, 0xEA, 0x4E, 0xBF, 0xF5, 0x9C, 0x9A, 0xF8, 0x97, 0xBD, 0x0A, 0xF9, 0xCF,
+    0x1A, 0x1B, 0xCA, 0xF3, 0xEA, 0x27, 0x61, 0xEB, 0xD4, 0xB6, 0x0A, 0xE1, 0x4F, 0x7B, 0x75, 0xAF,
+    0x99, 0x50, 0xE9, 0xE3, 0x4E, 0xED, 0xB0, 0xFE, 0x35, 0xD4, 0x3B, 0x97, 0x3C, 0xDB, 0xDA, 0xA0,
+    0xFA, 0xAD, 0xE7, 0xD8, 0xE6, 0x5F, 0xF6, 0xAA, 0xCF, 0x7F, 0xD6, 0x6C, 0x53, 0x9E, 0x57, 0x3D,
+    0x5B, 0xA7, 0xB6, 0x21, 0xFC, 0x69, 0x4F, 0xD9, 0x4C, 0xBF, 0x8C, 0xEA, 0x0D, 0x37, 0x0B, 0x5E,
+    0x9A, 0x45, 0x43, 0xFB, 0x8F, 0x77, 0x59, 0x89, 0x4C, 0xED, 0x8C, 0x7F, 0xFB, 0x35, 0x78, 0x32,
+    0x4D, 0xE9, 0xCB, 0x4E, 0x5C, 0xDB, 0xD4, 0x87, 0x63, 0x3E, 0x65, 0x52, 0xF6, 0x45, 0x50, 0x47,
+    0xDB, 0x4C, 0x7E, 0xCB, 0x01, 0xED, 0xCF, 0x64, 0xCE, 0x1A, 0x89, 0x23, 0x1B, 0xCF, 0x0F, 0xA7,
+    0x40, 0x77, 0xC6, 0x03, 0x2D, 0x2D, 0xCC, 0x7F, 0xCD, 0x60, 0x8E, 0x79, 0x3C, 0x5A, 0x44, 0x26,
+    0xF8, 0xAD, 0xF1, 0xF7, 0xC7, 0xB3, 0x50, 0x06, 0xDD, 0xC3, 0x52, 0xAF, 0x65, 0x24, 0x01, 0x45,
+    0x28, 0x02, 0x50, 0xF9, 0xCA, 0x03, 0x07, 0x4C, 0xF3, 0x14, 0x03, 0xA0, 0x3B, 0xED, 0x81, 0x9A,
+    0x1A, 0xC8, 0x53, 0x9E, 0x00, 0xDD, 0xEB, 0x0E, 0xB0, 0xD4, 0x90, 0x3F, 0x3F, 0x16, 0x03, 0x98,
+    0xDB, 0x22, 0x0D, 0xD4, 0x93, 0x0C, 0x40, 0xDB, 0xFC, 0x97, 0x47, 0x8E, 0xC0, 0x50, 0x8A, 0x07,
+    0x23, 0x09, 0x4C, 0xB7, 0x0B, 0xBA, 0x3B, 0x3E, 0x6B, 0x08, 0x2A, 0xE2, 0x28, 0x45, 0x22, 0x5A,
+    0x64, 0x22, 0xBB, 0xF0, 0xC3, 0xDA, 0x51, 0x06, 0xED, 0x67, 0xC0, 0x31, 0x1F, 0x1E, 0xA9, 0x19,
+    0x99, 0x2B, 0xFC, 0x65, 0x6F, 0x3C, 0x2A, 0x96, 0xB7, 0x60, 0x54, 0xD2, 0x51, 0x23, 0x81, 0xCA,
+    0x57, 0xFD, 0x5C, 0x6C, 0x57, 0x03, 0xE4, 0xCF, 0x27, 0xC8, 0xA6, 0x11, 0xA8, 0x47, 0x66, 0x0F,
+    0x77, 0xBF, 0x5F, 0x86, 0xE3, 0x72, 0x0D, 0x72, 0x91, 0x0E, 0xDA, 0x7F, 0x32, 0x2E, 0x3C, 0xCB,
+    0x53, 0x96, 0xC0, 0x36, 0x55, 0x43, 0x25, 0x37, 0x07, 0xB4, 0x24, 0x0B, 0x5F, 0x79, 0xBF, 0x08,
+    0xD0, 0x72, 0xB0, 0x5E, 0xEE, 0x38, 0x03, 0x6A, 0xE3, 0x17, 0x2E, 0x54, 0x8D, 0x6D, 0x50, 0x51,
+    0x0D, 0x0D, 0xD6, 0xD9, 0x44, 0x11, 0x94, 0x34, 0xB4, 0xD8, 0x6E, 0x29, 0xFD, 0x8F, 0xC0, 0xE7,
+    0x8D, 0x87, 0xE2, 0xDE, 0xB0, 0x26, 0xE7, 0x48, 0x03, 0xEC, 0xCC, 0x99, 0xC9, 0xAC, 0x37, 0x32,
+    0x82, 0xF9, 0xA1, 0xF8, 0xDD, 0x99, 0xE5, 0x0F, 0x41, 0x19, 0xCA, 0xB0, 0x6C, 0x65, 0xE6, 0x28,
+    0xE7, 0x63, 0xAB, 0x5A, 0x64, 0xE1, 0xD4, 0x9A, 0x57, 0xBD, 0xF6, 0xA8, 0xA8, 0x86, 0x19, 0xF2,
+    0xA7, 0x99, 0x63, 0x0B, 0xCF, 0x2A, 0x5F, 0x43, 0xD9, 0xEB, 0xBE, 0x9A, 0x3F, 0xA3, 0x6F, 0xC1,
+    0x48, 0x52, 0xE2, 0xA9, 0xA9, 0x91, 0x9E, 0xCA, 0x57, 0xBE, 0xEA, 0xD6, 0x3B, 0xAA, 0x42, 0x11,
+    0xEE, 0x6F, 0x69, 0x36, 0xCD, 0x71, 0xDC, 0xB2, 0xA7, 0x65, 0x3C, 0x7E, 0xF6, 0x88, 0x18, 0x3A,
+    0xC8, 0xE5, 0xF2, 0xC2, 0x4F, 0x91, 0x0E, 0xEA, 0x2F, 0xCB, 0x3F, 0x49, 0xA0, 0xBB, 0x85, 0xAB,
+    0x33, 0x9B, 0x6C, 0x63, 0x9B, 0xF9, 0x54, 0x80, 0x1C, 0xCE, 0x07, 0x92, 0x52, 0x0D, 0x5F, 0x79,
+    0xFF, 0x2B, 0xEF, 0xCF, 0x0D, 0x23, 0xD3, 0x9A, 0xC3, 0x33, 0x8F, 0x13, 0x69, 0xE6, 0xF2, 0x7A,
+    0x8A, 0x38, 0x73, 0xDA, 0x3A, 0x54, 0x54, 0x83, 0x1A, 0x1C, 0xD6, 0x59, 0x6C, 0xA2, 0x08, 0x45,
+    0x28, 0xC4, 0xD1, 0xAE, 0x79, 0x3E, 0xC7, 0x9A, 0x29, 0x4B, 0xC0, 0xE7, 0x4D, 0x57, 0xCF, 0x07,
+    0x41, 0xA5, 0x7F, 0xB0, 0x84, 0x7C, 0xCA, 0xFE, 0xF1, 0x51, 0x2D, 0x42, 0x02, 0xA0, 0xE6, 0xF3,
+    0x74, 0xFD, 0xFC, 0x97, 0x54, 0x4A, 0x0F, 0x95, 0x37, 0xCD, 0xA2, 0x21, 0xB9, 0x88, 0x4C, 0x68,
+    0x11, 0x19, 0xD9, 0x68, 0x57, 0x72, 0x76, 0xA6, 0x19, 0x26, 0x46, 0x60, 0xCC, 0x12, 0x64, 0x29,
+    0x4B, 0x6B, 0xDD, 0xC8, 0xA3, 0x8A, 0xB3, 0xEE, 0x9C, 0x42, 0x0D, 0x4A, 0x66, 0xB9, 0x08, 0x94,
+    0x21, 0x97, 0x66, 0x11, 0x0C, 0xDD, 0xAD, 0x25, 0x83, 0xBA, 0x75, 0x6B, 0xD1, 0xA0, 0xBA, 0xDF,
+    0x30, 0xF2, 0x35, 0xE6, 0xC6, 0x12, 0xAA, 0x9F, 0x47, 0x50, 0x9D, 0x71, 0xB0, 0xAF, 0x06, 0x72,
+    0xB9, 0xDE, 0x4E, 0x48, 0xAA, 0xA5, 0xB3, 0xA7, 0x9F, 0x9F, 0xCE, 0xAA, 0x80, 0xEE, 0xB0, 0x5D,
+    0x96, 0xC8, 0xA4, 0x31, 0x9E, 0x72, 0xCA, 0x13, 0x98, 0xC1, 0x36, 0x34, 0xF6, 0xD2, 0x40, 0x95,
+    0xC7, 0xFA, 0xF4, 0xA5, 0xB1, 0x2E, 0x24, 0x5A, 0xE9, 0x6A, 0xA1, 0x0D, 0xB9, 0xB8, 0xA3, 0x7B,
+    0x08, 0x3C, 0x37, 0x63, 0xAC, 0xB9, 0x44, 0x12, 0x01, 0xBE, 0x65, 0x1A, 0xE0, 0x5B, 0x3C, 0x07,
+    0x5C, 0x3C, 0x56, 0x36, 0x50, 0x4B, 0x1F, 0xA1, 0x96, 0xB1, 0x6A, 0xA8, 0x45, 0x2E, 0x47, 0x6A,
+    0x91, 0xB7, 0xA5, 0xA9, 0x45, 0x9A, 0x36, 0x56, 0x12, 0xB1, 0x53, 0x2E, 0x89, 0x76, 0xA2, 0x92,
+    0xA7, 0x65, 0x22, 0x97, 0x5B, 0x32, 0x41, 0x95, 0xDA, 0x89, 0xE5, 0x04, 0x1E, 0xD5, 0x0F, 0x26,
+    0x20, 0x0F, 0xDB, 0x00, 0x4F, 0x9C, 0xE4, 0x81, 0x3E, 0x9C, 0xBC, 0x9F, 0x92, 0xFC, 0xFF, 0x00,
 };
 
 static const EpdGlyph bookerly_12_bolditalicGlyphs[] = {
@@ -1718,7 +1760,7 @@ static const EpdGlyph bookerly_12_bolditalicGlyphs[] = {
     { 9, 23, 8, -1, 20, 52, 6133 }, // |
     { 11, 25, 10, -1, 20, 69, 6185 }, // }
     { 13, 5, 16, 1, 11, 17, 6254 }, // ~
-    { 0, 0, 5, 0, 0, 0, 0 }, //  
+    { 0, 0, 5, 0, 0, 0, 6271 }, //  
     { 9, 20, 8, -1, 14, 45, 0 }, // ¡
     { 14, 25, 16, 1, 20, 88, 45 }, // ¢
     { 17, 19, 16, -1, 18, 81, 133 }, // £
@@ -1729,642 +1771,649 @@ static const EpdGlyph bookerly_12_bolditalicGlyphs[] = {
     { 9, 5, 16, 3, 20, 12, 464 }, // ¨
     { 19, 19, 20, 0, 18, 91, 476 }, // ©
     { 10, 13, 11, 1, 18, 33, 567 }, // ª
-    { 15, 11, 15, 0, 12, 42, 600 }, // «
-    { 12, 7, 16, 2, 12, 21, 642 }, // ¬
-    { 8, 3, 10, 1, 8, 6, 663 }, // ­
-    { 14, 14, 15, 0, 20, 49, 669 }, // ®
-    { 9, 3, 16, 3, 18, 7, 718 }, // ¯
-    { 10, 10, 13, 2, 18, 25, 725 }, // °
-    { 12, 16, 16, 2, 15, 48, 750 }, // ±
-    { 11, 12, 11, 0, 21, 33, 798 }, // ²
-    { 9, 13, 11, 1, 21, 30, 831 }, // ³
-    { 6, 7, 16, 5, 22, 11, 861 }, // ´
-    { 17, 20, 15, -1, 14, 85, 872 }, // µ
-    { 17, 22, 15, -1, 18, 94, 957 }, // ¶
-    { 5, 5, 8, 1, 10, 7, 1051 }, // ·
-    { 6, 6, 16, 5, -1, 9, 1058 }, // ¸
-    { 8, 12, 11, 1, 21, 24, 1067 }, // ¹
-    { 10, 13, 11, 1, 18, 33, 1091 }, // º
-    { 15, 11, 15, 0, 12, 42, 1124 }, // »
-    { 26, 21, 27, 1, 19, 137, 1166 }, // ¼
-    { 25, 21, 27, 1, 19, 132, 1303 }, // ½
-    { 26, 21, 27, 1, 19, 137, 1435 }, // ¾
-    { 9, 20, 10, 0, 14, 45, 1572 }, // ¿
-    { 20, 25, 19, -2, 25, 125, 1617 }, // À
-    { 20, 25, 19, -2, 25, 125, 1742 }, // Á
-    { 20, 25, 19, -2, 25, 125, 1867 }, // Â
-    { 20, 24, 19, -2, 24, 120, 1992 }, // Ã
-    { 20, 24, 19, -2, 24, 120, 2112 }, // Ä
-    { 20, 25, 19, -2, 25, 125, 2232 }, // Å
-    { 26, 18, 23, -2, 18, 117, 2357 }, // Æ
-    { 17, 25, 16, 0, 18, 107, 2474 }, // Ç
-    { 17, 25, 16, -1, 25, 107, 2581 }, // È
-    { 17, 25, 16, -1, 25, 107, 2688 }, // É
-    { 17, 25, 16, -1, 25, 107, 2795 }, // Ê
-    { 17, 24, 16, -1, 24, 102, 2902 }, // Ë
-    { 12, 25, 10, -1, 25, 75, 3004 }, // Ì
-    { 13, 25, 10, -1, 25, 82, 3079 }, // Í
-    { 13, 25, 10, -1, 25, 82, 3161 }, // Î
-    { 13, 24, 10, -1, 24, 78, 3243 }, // Ï
-    { 19, 19, 18, -1, 18, 91, 3321 }, // Ð
-    { 22, 25, 19, -1, 24, 138, 3412 }, // Ñ
-    { 18, 26, 18, 0, 25, 117, 3550 }, // Ò
-    { 18, 26, 18, 0, 25, 117, 3667 }, // Ó
-    { 18, 26, 18, 0, 25, 117, 3784 }, // Ô
-    { 18, 25, 18, 0, 24, 113, 3901 }, // Õ
-    { 18, 25, 18, 0, 24, 113, 4014 }, // Ö
-    { 11, 11, 16, 2, 14, 31, 4127 }, // ×
-    { 21, 20, 18, -1, 19, 105, 4158 }, // Ø
-    { 19, 26, 20, 2, 25, 124, 4263 }, // Ù
-    { 19, 26, 20, 2, 25, 124, 4387 }, // Ú
-    { 19, 26, 20, 2, 25, 124, 4511 }, // Û
-    { 19, 25, 20, 2, 24, 119, 4635 }, // Ü
-    { 18, 25, 16, 1, 25, 113, 4754 }, // Ý
-    { 16, 18, 15, -1, 18, 72, 4867 }, // Þ
-    { 21, 26, 16, -5, 20, 137, 4939 }, // ß
-    { 15, 22, 15, 0, 21, 83, 5076 }, // à
-    { 15, 23, 15, 0, 22, 87, 5159 }, // á
-    { 15, 22, 15, 0, 21, 83, 5246 }, // â
-    { 15, 21, 15, 0, 20, 79, 5329 }, // ã
-    { 15, 21, 15, 0, 20, 79, 5408 }, // ä
-    { 15, 22, 15, 0, 21, 83, 5487 }, // å
-    { 20, 15, 20, 0, 14, 75, 5570 }, // æ
-    { 12, 21, 11, 0, 14, 63, 5645 }, // ç
-    { 12, 22, 12, 0, 21, 66, 5708 }, // è
-    { 13, 23, 12, 0, 22, 75, 5774 }, // é
-    { 12, 22, 12, 0, 21, 66, 5849 }, // ê
-    { 13, 21, 12, 0, 20, 69, 5915 }, // ë
-    { 8, 22, 8, 0, 21, 44, 5984 }, // ì
-    { 11, 23, 8, 0, 22, 64, 6028 }, // í
-    { 10, 22, 8, 0, 21, 55, 6092 }, // î
-    { 11, 21, 8, 0, 20, 58, 6147 }, // ï
-    { 14, 22, 14, 0, 21, 77, 6205 }, // ð
-    { 15, 21, 16, 0, 20, 79, 6282 }, // ñ
-    { 13, 22, 14, 0, 21, 72, 6361 }, // ò
-    { 14, 23, 14, 0, 22, 81, 6433 }, // ó
-    { 13, 22, 14, 0, 21, 72, 6514 }, // ô
-    { 14, 21, 14, 0, 20, 74, 6586 }, // õ
-    { 14, 21, 14, 0, 20, 74, 6660 }, // ö
-    { 12, 13, 16, 2, 15, 39, 6734 }, // ÷
-    { 17, 15, 14, -2, 14, 64, 6773 }, // ø
-    { 15, 22, 15, 0, 21, 83, 6837 }, // ù
-    { 15, 23, 15, 0, 22, 87, 6920 }, // ú
-    { 15, 22, 15, 0, 21, 83, 7007 }, // û
-    { 15, 21, 15, 0, 20, 79, 7090 }, // ü
-    { 17, 28, 13, -4, 22, 119, 7169 }, // ý
-    { 17, 26, 14, -3, 20, 111, 7288 }, // þ
-    { 17, 26, 13, -4, 20, 111, 7399 }, // ÿ
-    { 20, 23, 19, -2, 23, 115, 0 }, // Ā
-    { 15, 19, 15, 0, 18, 72, 115 }, // ā
-    { 20, 24, 19, -2, 24, 120, 187 }, // Ă
-    { 15, 21, 15, 0, 20, 79, 307 }, // ă
-    { 20, 24, 19, -2, 18, 120, 386 }, // Ą
-    { 15, 20, 15, 0, 14, 75, 506 }, // ą
-    { 17, 26, 16, 0, 25, 111, 581 }, // Ć
-    { 13, 23, 11, 0, 22, 75, 692 }, // ć
-    { 17, 26, 16, 0, 25, 111, 767 }, // Ĉ
-    { 12, 22, 11, 0, 21, 66, 878 }, // ĉ
-    { 17, 25, 16, 0, 24, 107, 944 }, // Ċ
-    { 12, 21, 11, 0, 20, 63, 1051 }, // ċ
-    { 17, 26, 16, 0, 25, 111, 1114 }, // Č
-    { 13, 22, 11, 0, 21, 72, 1225 }, // č
-    { 19, 26, 18, -1, 25, 124, 1297 }, // Ď
-    { 19, 21, 16, 0, 20, 100, 1421 }, // ď
-    { 19, 19, 18, -1, 18, 91, 1521 }, // Đ
-    { 17, 21, 15, 0, 20, 90, 1612 }, // đ
-    { 17, 23, 16, -1, 23, 98, 1702 }, // Ē
-    { 13, 19, 12, 0, 18, 62, 1800 }, // ē
-    { 17, 24, 16, -1, 24, 102, 1862 }, // Ĕ
-    { 13, 21, 12, 0, 20, 69, 1964 }, // ĕ
-    { 17, 24, 16, -1, 24, 102, 2033 }, // Ė
-    { 12, 21, 12, 0, 20, 63, 2135 }, // ė
-    { 17, 24, 16, -1, 18, 102, 2198 }, // Ę
-    { 12, 20, 12, 0, 14, 60, 2300 }, // ę
-    { 17, 25, 16, -1, 25, 107, 2360 }, // Ě
-    { 13, 22, 12, 0, 21, 72, 2467 }, // ě
-    { 18, 26, 18, 0, 25, 117, 2539 }, // Ĝ
-    { 17, 27, 13, -2, 21, 115, 2656 }, // ĝ
-    { 18, 25, 18, 0, 24, 113, 2771 }, // Ğ
-    { 17, 26, 13, -2, 20, 111, 2884 }, // ğ
-    { 18, 25, 18, 0, 24, 113, 2995 }, // Ġ
-    { 17, 26, 13, -2, 20, 111, 3108 }, // ġ
-    { 18, 25, 18, 0, 18, 113, 3219 }, // Ģ
-    { 17, 28, 13, -2, 22, 119, 3332 }, // ģ
-    { 22, 25, 20, -1, 25, 138, 3451 }, // Ĥ
-    { 15, 27, 15, 0, 26, 102, 3589 }, // ĥ
-    { 22, 18, 20, -1, 18, 99, 3691 }, // Ħ
-    { 15, 21, 15, 0, 20, 79, 3790 }, // ħ
-    { 13, 24, 10, -1, 24, 78, 3869 }, // Ĩ
-    { 11, 21, 8, 0, 20, 58, 3947 }, // ĩ
-    { 13, 23, 10, -1, 23, 75, 4005 }, // Ī
-    { 11, 19, 8, 0, 18, 53, 4080 }, // ī
-    { 13, 24, 10, -1, 24, 78, 4133 }, // Ĭ
-    { 11, 21, 8, 0, 20, 58, 4211 }, // ĭ
-    { 12, 24, 10, -1, 18, 72, 4269 }, // Į
-    { 9, 26, 8, 0, 20, 59, 4341 }, // į
-    { 12, 24, 10, -1, 24, 72, 4400 }, // İ
-    { 8, 15, 8, 0, 14, 30, 4472 }, // ı
-    { 22, 23, 19, -1, 18, 127, 4502 }, // Ĳ
-    { 17, 26, 16, 0, 20, 111, 4629 }, // ĳ
-    { 17, 30, 9, -5, 25, 128, 4740 }, // Ĵ
-    { 16, 27, 8, -5, 21, 108, 4868 }, // ĵ
-    { 20, 25, 18, -1, 18, 125, 4976 }, // Ķ
-    { 13, 27, 13, 0, 20, 88, 5101 }, // ķ
-    { 14, 15, 14, 0, 14, 53, 5189 }, // ĸ
-    { 15, 25, 14, -1, 25, 94, 5242 }, // Ĺ
-    { 10, 27, 8, 0, 26, 68, 5336 }, // ĺ
-    { 15, 25, 14, -1, 18, 94, 5404 }, // Ļ
-    { 9, 27, 8, -1, 20, 61, 5498 }, // ļ
-    { 16, 20, 14, -1, 20, 80, 5559 }, // Ľ
-    { 12, 21, 9, 0, 20, 63, 5639 }, // ľ
-    { 16, 18, 14, -1, 18, 72, 5702 }, // Ŀ
-    { 12, 21, 11, 0, 20, 63, 5774 }, // ŀ
-    { 15, 18, 14, -1, 18, 68, 5837 }, // Ł
-    { 10, 21, 8, -1, 20, 53, 5905 }, // ł
-    { 22, 26, 19, -1, 25, 143, 5958 }, // Ń
-    { 15, 23, 16, 0, 22, 87, 6101 }, // ń
-    { 22, 25, 19, -1, 18, 138, 6188 }, // Ņ
-    { 15, 21, 16, 0, 14, 79, 6326 }, // ņ
-    { 22, 26, 19, -1, 25, 143, 6405 }, // Ň
-    { 15, 22, 16, 0, 21, 83, 6548 }, // ň
-    { 20, 20, 21, 1, 19, 100, 6631 }, // ŉ
-    { 22, 23, 19, -1, 18, 127, 6731 }, // Ŋ
-    { 14, 20, 15, 0, 14, 70, 6858 }, // ŋ
-    { 18, 24, 18, 0, 23, 108, 6928 }, // Ō
-    { 14, 19, 14, 0, 18, 67, 7036 }, // ō
-    { 18, 25, 18, 0, 24, 113, 7103 }, // Ŏ
-    { 14, 21, 14, 0, 20, 74, 7216 }, // ŏ
-    { 19, 26, 18, 0, 25, 124, 7290 }, // Ő
-    { 15, 22, 14, 0, 21, 83, 7414 }, // ő
-    { 25, 19, 25, 0, 18, 119, 7497 }, // Œ
-    { 20, 15, 20, 0, 14, 75, 7616 }, // œ
-    { 18, 26, 17, -1, 25, 117, 7691 }, // Ŕ
-    { 13, 22, 12, 0, 22, 72, 7808 }, // ŕ
-    { 18, 25, 17, -1, 18, 113, 7880 }, // Ŗ
-    { 14, 21, 12, -1, 14, 74, 7993 }, // ŗ
-    { 18, 26, 17, -1, 25, 117, 8067 }, // Ř
-    { 13, 21, 12, 0, 21, 69, 8184 }, // ř
-    { 15, 26, 14, -1, 25, 98, 8253 }, // Ś
-    { 13, 23, 11, -1, 22, 75, 8351 }, // ś
-    { 15, 26, 14, -1, 25, 98, 8426 }, // Ŝ
-    { 13, 22, 11, -1, 21, 72, 8524 }, // ŝ
-    { 15, 25, 14, -1, 18, 94, 8596 }, // Ş
-    { 12, 21, 11, -1, 14, 63, 8690 }, // ş
-    { 16, 26, 14, -1, 25, 104, 8753 }, // Š
-    { 14, 22, 11, -1, 21, 77, 8857 }, // š
-    { 17, 25, 17, 1, 18, 107, 8934 }, // Ţ
-    { 11, 24, 11, 0, 17, 66, 9041 }, // ţ
-    { 17, 25, 17, 1, 25, 107, 9107 }, // Ť
-    { 13, 21, 11, 0, 20, 69, 9214 }, // ť
-    { 17, 18, 17, 1, 18, 77, 9283 }, // Ŧ
-    { 11, 18, 11, 0, 17, 50, 9360 }, // ŧ
-    { 19, 25, 20, 2, 24, 119, 9410 }, // Ũ
-    { 15, 21, 15, 0, 20, 79, 9529 }, // ũ
-    { 19, 24, 20, 2, 23, 114, 9608 }, // Ū
-    { 15, 19, 15, 0, 18, 72, 9722 }, // ū
-    { 19, 25, 20, 2, 24, 119, 9794 }, // Ŭ
-    { 15, 21, 15, 0, 20, 79, 9913 }, // ŭ
-    { 19, 26, 20, 2, 25, 124, 9992 }, // Ů
-    { 15, 22, 15, 0, 21, 83, 10116 }, // ů
-    { 19, 26, 20, 2, 25, 124, 10199 }, // Ű
-    { 15, 22, 15, 0, 21, 83, 10323 }, // ű
-    { 19, 24, 20, 2, 18, 114, 10406 }, // Ų
-    { 15, 20, 15, 0, 14, 75, 10520 }, // ų
-    { 26, 26, 25, 1, 25, 169, 10595 }, // Ŵ
-    { 19, 22, 19, 0, 21, 105, 10764 }, // ŵ
-    { 18, 25, 16, 1, 25, 113, 10869 }, // Ŷ
-    { 17, 27, 13, -4, 21, 115, 10982 }, // ŷ
-    { 18, 24, 16, 1, 24, 108, 11097 }, // Ÿ
-    { 17, 26, 16, -1, 25, 111, 11205 }, // Ź
-    { 14, 23, 12, -1, 22, 81, 11316 }, // ź
-    { 17, 25, 16, -1, 24, 107, 11397 }, // Ż
-    { 14, 21, 12, -1, 20, 74, 11504 }, // ż
-    { 17, 26, 16, -1, 25, 111, 11578 }, // Ž
-    { 14, 22, 12, -1, 21, 77, 11689 }, // ž
-    { 19, 26, 11, -5, 20, 124, 11766 }, // ſ
-    { 6, 7, 0, -4, 21, 11, 0 }, // ̀
-    { 6, 7, 0, -2, 22, 11, 11 }, // ́
-    { 9, 7, 0, -5, 21, 16, 22 }, // ̂
-    { 10, 5, 0, -5, 20, 13, 38 }, // ̃
-    { 9, 3, 0, -5, 18, 7, 51 }, // ̄
-    { 8, 5, 0, -4, 20, 10, 58 }, // ̆
-    { 4, 5, 0, -2, 20, 5, 68 }, // ̇
-    { 10, 5, 0, -5, 20, 13, 73 }, // ̈
-    { 7, 8, 0, -3, 22, 14, 86 }, // ̉
-    { 8, 7, 0, -4, 21, 14, 100 }, // ̊
-    { 11, 7, 0, -5, 21, 20, 114 }, // ̋
-    { 9, 6, 0, -4, 21, 14, 134 }, // ̌
-    { 8, 7, 0, -5, 21, 14, 148 }, // ̏
-    { 9, 5, 0, -5, 20, 12, 162 }, // ̑
-    { 6, 8, 0, -3, 22, 12, 174 }, // ̒
-    { 6, 7, 0, -3, 22, 11, 186 }, // ̓
-    { 5, 7, 0, -3, 22, 9, 197 }, // ̔
-    { 4, 7, 0, -2, 22, 7, 206 }, // ̕
-    { 6, 6, 0, -3, 16, 9, 213 }, // ̛
-    { 4, 5, 0, -2, -1, 5, 222 }, // ̣
-    { 10, 4, 0, -5, -2, 10, 227 }, // ̤
-    { 6, 6, 0, -3, -1, 9, 237 }, // ̥
-    { 5, 6, 0, -3, -1, 8, 246 }, // ̦
-    { 6, 6, 0, -3, -1, 9, 254 }, // ̧
-    { 6, 7, 0, -3, 1, 11, 263 }, // ̨
-    { 5, 7, 7, -1, -1, 9, 274 }, // ̩
-    { 9, 6, 0, -5, -1, 14, 283 }, // ̭
-    { 8, 6, 0, -4, -1, 12, 297 }, // ̮
-    { 10, 5, 0, -5, -2, 13, 309 }, // ̰
-    { 9, 3, 0, -5, -2, 7, 322 }, // ̱
-    { 8, 5, 0, -4, 20, 10, 329 }, // ͂
-    { 10, 11, 0, -5, 26, 28, 339 }, // ̈́
-    { 5, 6, 0, -2, -1, 8, 367 }, // ͅ
-    { 17, 25, 16, -1, 25, 107, 0 }, // Ѐ
-    { 17, 24, 16, -1, 24, 102, 107 }, // Ё
-    { 17, 24, 19, 1, 18, 102, 209 }, // Ђ
-    { 17, 25, 14, -1, 25, 107, 311 }, // Ѓ
-    { 17, 19, 16, 0, 18, 81, 418 }, // Є
-    { 15, 19, 14, -1, 18, 72, 499 }, // Ѕ
-    { 12, 18, 10, -1, 18, 54, 571 }, // І
-    { 13, 24, 10, -1, 24, 78, 625 }, // Ї
-    { 16, 23, 9, -5, 18, 92, 703 }, // Ј
-    { 25, 19, 23, -2, 18, 119, 795 }, // Љ
-    { 24, 19, 24, -1, 18, 114, 914 }, // Њ
-    { 19, 18, 21, 1, 18, 86, 1028 }, // Ћ
-    { 20, 26, 18, -1, 25, 130, 1114 }, // Ќ
-    { 23, 25, 20, -1, 25, 144, 1244 }, // Ѝ
-    { 18, 26, 17, 1, 25, 117, 1388 }, // Ў
-    { 22, 24, 19, -1, 18, 132, 1505 }, // Џ
-    { 20, 18, 19, -2, 18, 90, 1637 }, // А
-    { 17, 19, 16, -1, 18, 81, 1727 }, // Б
-    { 16, 19, 16, -1, 18, 76, 1808 }, // В
-    { 17, 18, 14, -1, 18, 77, 1884 }, // Г
-    { 22, 24, 19, -2, 18, 132, 1961 }, // Д
-    { 17, 18, 16, -1, 18, 77, 2093 }, // Е
-    { 28, 19, 24, -2, 18, 133, 2170 }, // Ж
-    { 15, 19, 14, -1, 18, 72, 2303 }, // З
-    { 23, 18, 20, -1, 18, 104, 2375 }, // И
-    { 23, 25, 20, -1, 25, 144, 2479 }, // Й
-    { 20, 19, 18, -1, 18, 95, 2623 }, // К
-    { 22, 19, 18, -2, 18, 105, 2718 }, // Л
-    { 25, 18, 22, -2, 18, 113, 2823 }, // М
-    { 22, 18, 20, -1, 18, 99, 2936 }, // Н
-    { 18, 19, 18, 0, 18, 86, 3035 }, // О
-    { 22, 18, 19, -1, 18, 99, 3121 }, // П
-    { 17, 18, 15, -1, 18, 77, 3220 }, // Р
-    { 17, 19, 16, 0, 18, 81, 3297 }, // С
-    { 17, 18, 17, 1, 18, 77, 3378 }, // Т
-    { 18, 19, 17, 1, 18, 86, 3455 }, // У
-    { 19, 19, 19, 0, 18, 91, 3541 }, // Ф
-    { 21, 18, 17, -2, 18, 95, 3632 }, // Х
-    { 22, 24, 19, -1, 18, 132, 3727 }, // Ц
-    { 18, 18, 18, 1, 18, 81, 3859 }, // Ч
-    { 28, 18, 25, -1, 18, 126, 3940 }, // Ш
-    { 28, 24, 25, -1, 18, 168, 4066 }, // Щ
-    { 17, 19, 18, 1, 18, 81, 4234 }, // Ъ
-    { 26, 19, 24, -1, 18, 124, 4315 }, // Ы
-    { 16, 19, 15, -1, 18, 76, 4439 }, // Ь
-    { 17, 19, 16, -1, 18, 81, 4515 }, // Э
-    { 27, 19, 26, -1, 18, 129, 4596 }, // Ю
-    { 20, 19, 17, -2, 18, 95, 4725 }, // Я
-    { 15, 15, 15, 0, 14, 57, 4820 }, // а
-    { 15, 22, 14, 0, 21, 83, 4877 }, // б
-    { 13, 15, 13, 0, 14, 49, 4960 }, // в
-    { 11, 15, 11, 0, 14, 42, 5009 }, // г
-    { 14, 21, 14, 0, 20, 74, 5051 }, // д
-    { 12, 15, 12, 0, 14, 45, 5125 }, // е
-    { 23, 15, 22, 0, 14, 87, 5170 }, // ж
-    { 12, 15, 12, -1, 14, 45, 5257 }, // з
-    { 15, 15, 15, 0, 14, 57, 5302 }, // и
-    { 15, 21, 15, 0, 20, 79, 5359 }, // й
-    { 14, 15, 14, 0, 14, 53, 5438 }, // к
-    { 16, 15, 16, -1, 14, 60, 5491 }, // л
-    { 21, 15, 20, -1, 14, 79, 5551 }, // м
-    { 15, 15, 16, 0, 14, 57, 5630 }, // н
-    { 13, 15, 14, 0, 14, 49, 5687 }, // о
-    { 15, 15, 16, 0, 14, 57, 5736 }, // п
-    { 16, 20, 14, -2, 14, 80, 5793 }, // р
-    { 12, 15, 11, 0, 14, 45, 5873 }, // с
-    { 22, 15, 22, 0, 14, 83, 5918 }, // т
-    { 17, 20, 13, -4, 14, 85, 6001 }, // у
-    { 18, 26, 18, 0, 20, 117, 6086 }, // ф
-    { 16, 15, 14, -1, 14, 60, 6203 }, // х
-    { 16, 19, 16, 0, 14, 76, 6263 }, // ц
-    { 15, 15, 15, 0, 14, 57, 6339 }, // ч
-    { 21, 15, 21, 0, 14, 79, 6396 }, // ш
-    { 21, 19, 21, 0, 14, 100, 6475 }, // щ
-    { 13, 15, 14, 0, 14, 49, 6575 }, // ъ
-    { 19, 15, 20, 0, 14, 72, 6624 }, // ы
-    { 12, 15, 13, 0, 14, 45, 6696 }, // ь
-    { 13, 15, 12, -1, 14, 49, 6741 }, // э
-    { 20, 15, 20, 0, 14, 75, 6790 }, // ю
-    { 15, 15, 15, 0, 14, 57, 6865 }, // я
-    { 12, 22, 12, 0, 21, 66, 6922 }, // ѐ
-    { 13, 21, 12, 0, 20, 69, 6988 }, // ё
-    { 14, 26, 14, 0, 20, 91, 7057 }, // ђ
-    { 12, 23, 11, 0, 22, 69, 7148 }, // ѓ
-    { 12, 15, 12, 0, 14, 45, 7217 }, // є
-    { 12, 15, 11, -1, 14, 45, 7262 }, // ѕ
-    { 9, 21, 8, 0, 20, 48, 7307 }, // і
-    { 11, 21, 8, 0, 20, 58, 7355 }, // ї
-    { 14, 26, 8, -5, 20, 91, 7413 }, // ј
-    { 20, 15, 20, -1, 14, 75, 7504 }, // љ
-    { 19, 15, 19, 0, 14, 72, 7579 }, // њ
-    { 15, 21, 15, 0, 20, 79, 7651 }, // ћ
-    { 14, 23, 14, 0, 22, 81, 7730 }, // ќ
-    { 15, 22, 15, 0, 21, 83, 7811 }, // ѝ
-    { 17, 26, 13, -4, 20, 111, 7894 }, // ў
-    { 15, 19, 15, 0, 14, 72, 8005 }, // џ
-    { 16, 21, 18, 1, 20, 84, 8077 }, // Ѣ
-    { 19, 15, 20, 0, 14, 72, 8161 }, // ѣ
-    { 18, 19, 18, 0, 18, 86, 8233 }, // Ѳ
-    { 13, 15, 14, 0, 14, 49, 8319 }, // ѳ
-    { 20, 19, 19, 1, 18, 95, 8368 }, // Ѵ
-    { 16, 15, 15, -1, 14, 60, 8463 }, // ѵ
-    { 23, 31, 20, -1, 25, 179, 8523 }, // Ҋ
-    { 15, 25, 15, 0, 20, 94, 8702 }, // ҋ
-    { 16, 19, 15, -1, 18, 76, 8796 }, // Ҍ
-    { 11, 19, 13, 1, 18, 53, 8872 }, // ҍ
-    { 17, 18, 15, -1, 18, 77, 8925 }, // Ҏ
-    { 16, 20, 14, -2, 14, 80, 9002 }, // ҏ
-    { 17, 21, 14, -1, 21, 90, 9082 }, // Ґ
-    { 13, 18, 12, 0, 17, 59, 9172 }, // ґ
-    { 17, 18, 14, -1, 18, 77, 9231 }, // Ғ
-    { 11, 15, 11, 0, 14, 42, 9308 }, // ғ
-    { 17, 24, 17, -1, 18, 102, 9350 }, // Ҕ
-    { 13, 19, 14, 0, 13, 62, 9452 }, // ҕ
-    { 28, 24, 25, -2, 18, 168, 9514 }, // Җ
-    { 23, 19, 22, 0, 14, 110, 9682 }, // җ
-    { 15, 24, 14, -1, 18, 90, 9792 }, // Ҙ
-    { 12, 19, 12, -1, 14, 57, 9882 }, // ҙ
-    { 20, 24, 18, -1, 18, 120, 9939 }, // Қ
-    { 14, 19, 14, 0, 14, 67, 10059 }, // қ
-    { 21, 19, 18, -1, 18, 100, 10126 }, // Ҝ
-    { 16, 15, 16, 0, 14, 60, 10226 }, // ҝ
-    { 20, 19, 18, -1, 18, 95, 10286 }, // Ҟ
-    { 14, 20, 14, 0, 19, 70, 10381 }, // ҟ
-    { 21, 19, 21, 1, 18, 100, 10451 }, // Ҡ
-    { 16, 15, 16, 0, 14, 60, 10551 }, // ҡ
-    { 22, 24, 20, -1, 18, 132, 10611 }, // Ң
-    { 16, 19, 16, 0, 14, 76, 10743 }, // ң
-    { 26, 18, 23, -1, 18, 117, 10819 }, // Ҥ
-    { 19, 15, 19, 0, 14, 72, 10936 }, // ҥ
-    { 26, 24, 26, -1, 18, 156, 11008 }, // Ҧ
-    { 20, 20, 21, 0, 14, 100, 11164 }, // ҧ
-    { 21, 19, 21, 0, 18, 100, 11264 }, // Ҩ
-    { 16, 15, 16, 0, 14, 60, 11364 }, // ҩ
-    { 17, 24, 16, 0, 18, 102, 11424 }, // Ҫ
-    { 12, 19, 11, 0, 14, 57, 11526 }, // ҫ
-    { 17, 24, 17, 1, 18, 102, 11583 }, // Ҭ
-    { 22, 19, 22, 0, 14, 105, 11685 }, // ҭ
-    { 18, 18, 16, 1, 18, 81, 11790 }, // Ү
-    { 13, 20, 13, 0, 14, 65, 11871 }, // ү
-    { 18, 18, 16, 1, 18, 81, 11936 }, // Ұ
-    { 13, 20, 13, 0, 14, 65, 12017 }, // ұ
-    { 21, 24, 17, -2, 18, 126, 12082 }, // Ҳ
-    { 16, 19, 14, -1, 14, 76, 12208 }, // ҳ
-    { 23, 24, 23, 1, 18, 138, 12284 }, // Ҵ
-    { 16, 23, 16, 0, 18, 92, 12422 }, // ҵ
-    { 18, 24, 18, 1, 18, 108, 12514 }, // Ҷ
-    { 15, 19, 15, 0, 14, 72, 12622 }, // ҷ
-    { 18, 18, 18, 1, 18, 81, 12694 }, // Ҹ
-    { 15, 15, 15, 0, 14, 57, 12775 }, // ҹ
-    { 18, 18, 18, -1, 18, 81, 12832 }, // Һ
-    { 15, 21, 15, 0, 20, 79, 12913 }, // һ
-    { 20, 19, 21, 0, 18, 95, 12992 }, // Ҽ
-    { 15, 15, 15, 0, 14, 57, 13087 }, // ҽ
-    { 20, 24, 21, 0, 18, 120, 13144 }, // Ҿ
-    { 15, 19, 15, 0, 14, 72, 13264 }, // ҿ
-    { 12, 18, 10, -1, 18, 54, 13336 }, // Ӏ
-    { 29, 26, 24, -3, 25, 189, 13390 }, // Ӂ
-    { 23, 21, 22, 0, 20, 121, 13579 }, // ӂ
-    { 20, 24, 18, -1, 18, 120, 13700 }, // Ӄ
-    { 14, 20, 14, 0, 14, 70, 13820 }, // ӄ
-    { 22, 24, 18, -2, 18, 132, 13890 }, // Ӆ
-    { 17, 19, 16, -1, 14, 81, 14022 }, // ӆ
-    { 22, 24, 20, -1, 18, 132, 14103 }, // Ӈ
-    { 15, 20, 15, 0, 14, 75, 14235 }, // ӈ
-    { 22, 24, 20, -1, 18, 132, 14310 }, // Ӊ
-    { 16, 19, 16, 0, 14, 76, 14442 }, // ӊ
-    { 18, 24, 18, 1, 18, 108, 14518 }, // Ӌ
-    { 14, 19, 15, 0, 14, 67, 14626 }, // ӌ
-    { 25, 24, 23, -2, 18, 150, 14693 }, // Ӎ
-    { 21, 19, 20, -1, 14, 100, 14843 }, // ӎ
-    { 12, 20, 10, -1, 20, 60, 14943 }, // ӏ
-    { 20, 25, 19, -2, 25, 125, 15003 }, // Ӑ
-    { 15, 21, 15, 0, 20, 79, 15128 }, // ӑ
-    { 20, 24, 19, -2, 24, 120, 15207 }, // Ӓ
-    { 15, 21, 15, 0, 20, 79, 15327 }, // ӓ
-    { 26, 18, 23, -2, 18, 117, 15406 }, // Ӕ
-    { 20, 15, 20, 0, 14, 75, 15523 }, // ӕ
-    { 17, 25, 16, -1, 25, 107, 15598 }, // Ӗ
-    { 13, 21, 12, 0, 20, 69, 15705 }, // ӗ
-    { 16, 19, 17, 0, 18, 76, 15774 }, // Ә
-    { 12, 15, 12, 0, 14, 45, 15850 }, // ә
-    { 16, 25, 17, 0, 24, 100, 15895 }, // Ӛ
-    { 12, 21, 12, 0, 20, 63, 15995 }, // ӛ
-    { 28, 25, 24, -2, 24, 175, 16058 }, // Ӝ
-    { 23, 21, 22, 0, 20, 121, 16233 }, // ӝ
-    { 15, 25, 14, -1, 24, 94, 16354 }, // Ӟ
-    { 13, 21, 12, -1, 20, 69, 16448 }, // ӟ
-    { 16, 19, 14, -1, 18, 76, 16517 }, // Ӡ
-    { 16, 19, 13, -2, 13, 76, 16593 }, // ӡ
-    { 23, 23, 20, -1, 23, 133, 16669 }, // Ӣ
-    { 15, 19, 15, 0, 18, 72, 16802 }, // ӣ
-    { 23, 24, 20, -1, 24, 138, 16874 }, // Ӥ
-    { 15, 21, 15, 0, 20, 79, 17012 }, // ӥ
-    { 18, 25, 18, 0, 24, 113, 17091 }, // Ӧ
-    { 14, 21, 14, 0, 20, 74, 17204 }, // ӧ
-    { 18, 19, 18, 0, 18, 86, 17278 }, // Ө
-    { 13, 15, 14, 0, 14, 49, 17364 }, // ө
-    { 18, 25, 18, 0, 24, 113, 17413 }, // Ӫ
-    { 14, 21, 14, 0, 20, 74, 17526 }, // ӫ
-    { 17, 25, 16, -1, 24, 107, 17600 }, // Ӭ
-    { 13, 21, 12, -1, 20, 69, 17707 }, // ӭ
-    { 18, 24, 17, 1, 23, 108, 17776 }, // Ӯ
-    { 17, 24, 13, -4, 18, 102, 17884 }, // ӯ
-    { 18, 25, 17, 1, 24, 113, 17986 }, // Ӱ
-    { 17, 26, 13, -4, 20, 111, 18099 }, // ӱ
-    { 18, 26, 17, 1, 25, 117, 18210 }, // Ӳ
-    { 17, 27, 13, -4, 21, 115, 18327 }, // ӳ
-    { 18, 24, 18, 1, 24, 108, 18442 }, // Ӵ
-    { 15, 21, 15, 0, 20, 79, 18550 }, // ӵ
-    { 17, 24, 14, -1, 18, 102, 18629 }, // Ӷ
-    { 11, 19, 11, 0, 14, 53, 18731 }, // ӷ
-    { 26, 25, 24, -1, 24, 163, 18784 }, // Ӹ
-    { 19, 21, 20, 0, 20, 100, 18947 }, // ӹ
-    { 17, 24, 14, -1, 18, 102, 19047 }, // Ӻ
-    { 11, 19, 11, 0, 14, 53, 19149 }, // ӻ
-    { 21, 24, 17, -2, 18, 126, 19202 }, // Ӽ
-    { 16, 20, 14, -1, 14, 80, 19328 }, // ӽ
-    { 21, 18, 17, -2, 18, 95, 19408 }, // Ӿ
-    { 16, 15, 14, -1, 14, 60, 19503 }, // ӿ
-    { 0, 0, 13, 0, 0, 0, 0 }, //  
-    { 0, 0, 25, 0, 0, 0, 0 }, //  
-    { 0, 0, 13, 0, 0, 0, 0 }, //  
-    { 0, 0, 25, 0, 0, 0, 0 }, //  
-    { 0, 0, 8, 0, 0, 0, 0 }, //  
-    { 0, 0, 6, 0, 0, 0, 0 }, //  
-    { 0, 0, 4, 0, 0, 0, 0 }, //  
-    { 0, 0, 16, 0, 0, 0, 0 }, //  
-    { 0, 0, 8, 0, 0, 0, 0 }, //  
-    { 0, 0, 5, 0, 0, 0, 0 }, //  
-    { 0, 0, 1, 0, 0, 0, 0 }, //  
-    { 0, 0, 0, 0, 0, 0, 0 }, // ​
-    { 2, 21, 0, -1, 15, 11, 0 }, // ‌
-    { 6, 23, 0, -3, 17, 35, 11 }, // ‍
-    { 8, 24, 0, -4, 18, 48, 46 }, // ‎
-    { 8, 24, 0, -4, 18, 48, 94 }, // ‏
-    { 8, 3, 10, 1, 8, 6, 142 }, // ‐
-    { 8, 3, 10, 1, 8, 6, 148 }, // ‑
-    { 13, 3, 16, 1, 10, 10, 154 }, // ‒
-    { 13, 3, 13, 0, 8, 10, 164 }, // –
-    { 25, 3, 25, 0, 8, 19, 174 }, // —
-    { 25, 3, 25, 0, 8, 19, 193 }, // ―
-    { 9, 26, 13, 2, 20, 59, 212 }, // ‖
-    { 13, 7, 13, 0, -1, 23, 271 }, // ‗
-    { 6, 9, 8, 2, 19, 14, 294 }, // ‘
-    { 6, 9, 8, 1, 19, 14, 308 }, // ’
-    { 6, 9, 8, 0, 4, 14, 322 }, // ‚
-    { 6, 9, 8, 1, 19, 14, 336 }, // ‛
-    { 11, 9, 13, 2, 19, 25, 350 }, // “
-    { 12, 9, 13, 1, 19, 27, 375 }, // ”
-    { 11, 9, 13, 0, 4, 25, 402 }, // „
-    { 11, 9, 13, 1, 19, 25, 427 }, // ‟
-    { 11, 17, 12, 1, 18, 47, 452 }, // †
-    { 13, 20, 12, -1, 18, 65, 499 }, // ‡
-    { 7, 7, 8, 0, 10, 13, 564 }, // •
-    { 9, 9, 16, 3, 13, 21, 577 }, // ‣
-    { 5, 5, 7, 1, 4, 7, 598 }, // ․
-    { 11, 5, 13, 1, 4, 14, 605 }, // ‥
-    { 21, 5, 25, 2, 4, 27, 619 }, // …
-    { 5, 5, 7, 1, 9, 7, 646 }, // ‧
-    { 0, 0, 0, 0, 0, 0, 653 }, //  
-    { 0, 0, 0, 0, 0, 0, 653 }, //  
-    { 8, 24, 0, -4, 18, 48, 653 }, // ‪
-    { 8, 24, 0, -4, 18, 48, 701 }, // ‫
-    { 8, 24, 0, -4, 18, 48, 749 }, // ‬
-    { 11, 24, 0, -5, 18, 66, 797 }, // ‭
-    { 11, 24, 0, -5, 18, 66, 863 }, // ‮
-    { 0, 0, 3, 0, 0, 0, 929 }, //  
-    { 33, 21, 35, 1, 19, 174, 929 }, // ‰
-    { 6, 9, 6, 0, 18, 14, 1103 }, // ′
-    { 11, 9, 11, 0, 18, 25, 1117 }, // ″
-    { 17, 9, 17, 0, 18, 39, 1142 }, // ‴
-    { 6, 9, 6, 0, 18, 14, 1181 }, // ‵
-    { 12, 9, 12, 0, 18, 27, 1195 }, // ‶
-    { 17, 9, 17, 0, 18, 39, 1222 }, // ‷
-    { 11, 6, 12, 1, 0, 17, 1261 }, // ‸
-    { 9, 11, 9, 0, 12, 25, 1278 }, // ‹
-    { 8, 11, 9, 0, 12, 22, 1303 }, // ›
-    { 16, 18, 16, 0, 17, 72, 1325 }, // ※
-    { 15, 20, 15, 1, 19, 75, 1397 }, // ‼
-    { 13, 3, 13, 0, 21, 10, 1472 }, // ‾
-    { 6, 3, 8, 1, 8, 5, 1482 }, // ⁃
-    { 17, 21, 7, -5, 19, 90, 1487 }, // ⁄
-    { 18, 20, 20, 2, 19, 90, 1577 }, // ⁇
-    { 16, 20, 17, 2, 19, 80, 1667 }, // ⁈
-    { 17, 20, 17, 1, 19, 85, 1747 }, // ⁉
-    { 15, 6, 25, 5, 10, 23, 1832 }, // ⁓
-    { 23, 9, 23, 0, 18, 52, 1855 }, // ⁗
-    { 0, 0, 6, 0, 0, 0, 1907 }, //  
-    { 0, 0, 0, 0, 0, 0, 1907 }, // ⁠
-    { 0, 0, 0, 0, 0, 0, 1907 }, // ⁡
-    { 0, 0, 0, 0, 0, 0, 1907 }, // ⁢
-    { 0, 0, 0, 0, 0, 0, 1907 }, // ⁣
-    { 0, 0, 0, 0, 0, 0, 1907 }, // ⁤
-    { 11, 12, 11, 0, 21, 33, 0 }, // ⁰
-    { 11, 12, 11, 0, 21, 33, 33 }, // ⁴
-    { 11, 13, 11, 0, 21, 36, 66 }, // ⁵
-    { 10, 12, 11, 1, 21, 30, 102 }, // ⁶
-    { 9, 13, 11, 2, 21, 30, 132 }, // ⁷
-    { 11, 12, 11, 0, 21, 33, 162 }, // ⁸
-    { 11, 12, 11, 0, 21, 33, 195 }, // ⁹
-    { 11, 10, 14, 2, 18, 28, 228 }, // ⁿ
-    { 11, 12, 11, 0, 8, 33, 256 }, // ₀
-    { 8, 13, 11, 1, 9, 26, 289 }, // ₁
-    { 11, 12, 11, 0, 8, 33, 315 }, // ₂
-    { 9, 12, 11, 1, 8, 27, 348 }, // ₃
-    { 11, 12, 11, 0, 8, 33, 375 }, // ₄
-    { 11, 12, 11, 0, 8, 33, 408 }, // ₅
-    { 10, 12, 11, 1, 8, 30, 441 }, // ₆
-    { 9, 12, 11, 2, 8, 27, 471 }, // ₇
-    { 11, 12, 11, 0, 8, 33, 498 }, // ₈
-    { 11, 12, 11, 0, 8, 33, 531 }, // ₉
-    { 17, 18, 16, -1, 18, 77, 0 }, // ₣
-    { 17, 19, 16, -1, 18, 81, 77 }, // ₤
-    { 33, 19, 33, 0, 18, 157, 158 }, // ₧
-    { 18, 19, 16, -1, 18, 86, 315 }, // €
-    { 17, 12, 25, 4, 15, 51, 0 }, // ←
-    { 13, 17, 25, 6, 17, 56, 51 }, // ↑
-    { 17, 12, 25, 4, 15, 51, 107 }, // →
-    { 13, 17, 25, 6, 17, 56, 158 }, // ↓
-    { 17, 11, 25, 4, 14, 47, 214 }, // ↔
-    { 11, 17, 25, 7, 17, 47, 261 }, // ↕
-    { 13, 18, 25, 6, 18, 59, 308 }, // ↨
-    { 11, 18, 25, 7, 18, 50, 367 }, // ↲
-    { 11, 18, 25, 7, 18, 50, 417 }, // ↳
-    { 15, 14, 25, 5, 16, 53, 467 }, // ↵
-    { 17, 15, 25, 4, 16, 64, 520 }, // ⇐
-    { 15, 17, 25, 5, 17, 64, 584 }, // ⇑
-    { 17, 15, 25, 4, 16, 64, 648 }, // ⇒
-    { 15, 17, 25, 5, 17, 64, 712 }, // ⇓
-    { 17, 13, 25, 4, 15, 56, 776 }, // ⇔
-    { 18, 19, 25, 3, 18, 86, 0 }, // ∀
-    { 13, 21, 16, 1, 20, 69, 86 }, // ∂
-    { 13, 18, 25, 6, 18, 59, 155 }, // ∃
-    { 19, 21, 25, 3, 19, 100, 214 }, // ∅
-    { 17, 18, 17, 0, 18, 77, 314 }, // ∆
-    { 17, 19, 25, 4, 18, 81, 391 }, // ∇
-    { 17, 18, 25, 4, 18, 77, 472 }, // ∈
-    { 17, 23, 25, 4, 20, 98, 549 }, // ∉
-    { 17, 15, 25, 4, 16, 64, 647 }, // ∊
-    { 17, 18, 25, 4, 18, 77, 711 }, // ∋
-    { 17, 23, 25, 4, 20, 98, 788 }, // ∌
-    { 17, 15, 25, 4, 16, 64, 886 }, // ∍
-    { 21, 22, 21, 0, 18, 116, 950 }, // ∏
-    { 16, 23, 17, 0, 18, 92, 1066 }, // ∑
-    { 12, 3, 16, 2, 10, 9, 1158 }, // −
-    { 15, 20, 13, -1, 18, 75, 1167 }, // ∕
-    { 13, 20, 13, 0, 18, 65, 1242 }, // ∖
-    { 12, 13, 16, 2, 15, 39, 1307 }, // ∗
-    { 10, 10, 16, 3, 13, 25, 1346 }, // ∘
-    { 6, 5, 16, 5, 9, 8, 1371 }, // ∙
-    { 17, 24, 16, -1, 21, 102, 1379 }, // √
-    { 13, 10, 16, 1, 13, 33, 1481 }, // ∝
-    { 16, 10, 16, 0, 13, 40, 1514 }, // ∞
-    { 17, 18, 25, 4, 18, 77, 1554 }, // ∟
-    { 19, 18, 25, 3, 18, 86, 1631 }, // ∠
-    { 4, 26, 13, 4, 20, 26, 1717 }, // ∣
-    { 9, 26, 13, 2, 20, 59, 1743 }, // ∥
-    { 18, 18, 25, 4, 18, 81, 1802 }, // ∧
-    { 18, 18, 25, 4, 18, 81, 1883 }, // ∨
-    { 15, 18, 25, 5, 18, 68, 1964 }, // ∩
-    { 15, 19, 25, 5, 18, 72, 2032 }, // ∪
-    { 15, 26, 16, 0, 20, 98, 2104 }, // ∫
-    { 17, 15, 25, 4, 14, 64, 2202 }, // ∴
-    { 17, 15, 25, 4, 14, 64, 2266 }, // ∵
-    { 6, 15, 8, 1, 16, 23, 2330 }, // ∶
-    { 17, 15, 25, 4, 14, 64, 2353 }, // ∷
-    { 15, 6, 25, 5, 10, 23, 2417 }, // ∼
-    { 15, 15, 25, 5, 16, 57, 2440 }, // ≅
-    { 13, 11, 16, 1, 14, 36, 2497 }, // ≈
-    { 15, 10, 25, 5, 12, 38, 2533 }, // ≍
-    { 12, 13, 16, 2, 15, 39, 2571 }, // ≠
-    { 15, 13, 25, 5, 14, 49, 2610 }, // ≡
-    { 12, 15, 16, 2, 15, 45, 2659 }, // ≤
-    { 12, 16, 16, 2, 16, 48, 2704 }, // ≥
-    { 21, 13, 25, 2, 15, 69, 2752 }, // ≪
-    { 21, 13, 25, 2, 15, 69, 2821 }, // ≫
-    { 17, 15, 25, 4, 16, 64, 2890 }, // ⊃
-    { 17, 23, 25, 4, 20, 98, 2954 }, // ⊄
-    { 17, 23, 25, 4, 20, 98, 3052 }, // ⊅
-    { 17, 18, 25, 4, 18, 77, 3150 }, // ⊆
-    { 17, 18, 25, 4, 18, 77, 3227 }, // ⊇
-    { 19, 19, 25, 3, 18, 91, 3304 }, // ⊕
-    { 19, 19, 25, 3, 18, 91, 3395 }, // ⊖
-    { 19, 19, 25, 3, 18, 91, 3486 }, // ⊗
-    { 19, 19, 25, 3, 18, 91, 3577 }, // ⊘
-    { 15, 18, 25, 5, 18, 68, 3668 }, // ⊥
-    { 6, 5, 16, 5, 9, 8, 3736 }, // ⋅
-    { 23, 5, 25, 1, 9, 29, 3744 }, // ⋯
-    { 25, 24, 25, 0, 21, 150, 0 }, // �
+    { 15, 11, 15, 0, 12, 42, 6271 }, // «
+    { 12, 7, 16, 2, 12, 21, 600 }, // ¬
+    { 8, 3, 10, 1, 8, 6, 621 }, // ­
+    { 14, 14, 15, 0, 20, 49, 627 }, // ®
+    { 9, 3, 16, 3, 18, 7, 676 }, // ¯
+    { 10, 10, 13, 2, 18, 25, 683 }, // °
+    { 12, 16, 16, 2, 15, 48, 708 }, // ±
+    { 11, 12, 11, 0, 21, 33, 756 }, // ²
+    { 9, 13, 11, 1, 21, 30, 789 }, // ³
+    { 6, 7, 16, 5, 22, 11, 819 }, // ´
+    { 17, 20, 15, -1, 14, 85, 830 }, // µ
+    { 17, 22, 15, -1, 18, 94, 915 }, // ¶
+    { 5, 5, 8, 1, 10, 7, 1009 }, // ·
+    { 6, 6, 16, 5, -1, 9, 1016 }, // ¸
+    { 8, 12, 11, 1, 21, 24, 1025 }, // ¹
+    { 10, 13, 11, 1, 18, 33, 1049 }, // º
+    { 15, 11, 15, 0, 12, 42, 6313 }, // »
+    { 26, 21, 27, 1, 19, 137, 1082 }, // ¼
+    { 25, 21, 27, 1, 19, 132, 1219 }, // ½
+    { 26, 21, 27, 1, 19, 137, 1351 }, // ¾
+    { 9, 20, 10, 0, 14, 45, 1488 }, // ¿
+    { 20, 25, 19, -2, 25, 125, 6355 }, // À
+    { 20, 25, 19, -2, 25, 125, 6480 }, // Á
+    { 20, 25, 19, -2, 25, 125, 6605 }, // Â
+    { 20, 24, 19, -2, 24, 120, 1533 }, // Ã
+    { 20, 24, 19, -2, 24, 120, 6730 }, // Ä
+    { 20, 25, 19, -2, 25, 125, 1653 }, // Å
+    { 26, 18, 23, -2, 18, 117, 1778 }, // Æ
+    { 17, 25, 16, 0, 18, 107, 6850 }, // Ç
+    { 17, 25, 16, -1, 25, 107, 6957 }, // È
+    { 17, 25, 16, -1, 25, 107, 7064 }, // É
+    { 17, 25, 16, -1, 25, 107, 7171 }, // Ê
+    { 17, 24, 16, -1, 24, 102, 7278 }, // Ë
+    { 12, 25, 10, -1, 25, 75, 7380 }, // Ì
+    { 13, 25, 10, -1, 25, 82, 7455 }, // Í
+    { 13, 25, 10, -1, 25, 82, 7537 }, // Î
+    { 13, 24, 10, -1, 24, 78, 7619 }, // Ï
+    { 19, 19, 18, -1, 18, 91, 1895 }, // Ð
+    { 22, 25, 19, -1, 24, 138, 7697 }, // Ñ
+    { 18, 26, 18, 0, 25, 117, 7835 }, // Ò
+    { 18, 26, 18, 0, 25, 117, 7952 }, // Ó
+    { 18, 26, 18, 0, 25, 117, 8069 }, // Ô
+    { 18, 25, 18, 0, 24, 113, 1986 }, // Õ
+    { 18, 25, 18, 0, 24, 113, 8186 }, // Ö
+    { 11, 11, 16, 2, 14, 31, 2099 }, // ×
+    { 21, 20, 18, -1, 19, 105, 2130 }, // Ø
+    { 19, 26, 20, 2, 25, 124, 8299 }, // Ù
+    { 19, 26, 20, 2, 25, 124, 8423 }, // Ú
+    { 19, 26, 20, 2, 25, 124, 8547 }, // Û
+    { 19, 25, 20, 2, 24, 119, 8671 }, // Ü
+    { 18, 25, 16, 1, 25, 113, 2235 }, // Ý
+    { 16, 18, 15, -1, 18, 72, 2348 }, // Þ
+    { 21, 26, 16, -5, 20, 137, 2420 }, // ß
+    { 15, 22, 15, 0, 21, 83, 8790 }, // à
+    { 15, 23, 15, 0, 22, 87, 8873 }, // á
+    { 15, 22, 15, 0, 21, 83, 8960 }, // â
+    { 15, 21, 15, 0, 20, 79, 2557 }, // ã
+    { 15, 21, 15, 0, 20, 79, 9043 }, // ä
+    { 15, 22, 15, 0, 21, 83, 2636 }, // å
+    { 20, 15, 20, 0, 14, 75, 2719 }, // æ
+    { 12, 21, 11, 0, 14, 63, 9122 }, // ç
+    { 12, 22, 12, 0, 21, 66, 9185 }, // è
+    { 13, 23, 12, 0, 22, 75, 9251 }, // é
+    { 12, 22, 12, 0, 21, 66, 9326 }, // ê
+    { 13, 21, 12, 0, 20, 69, 9392 }, // ë
+    { 8, 22, 8, 0, 21, 44, 9461 }, // ì
+    { 11, 23, 8, 0, 22, 64, 9505 }, // í
+    { 10, 22, 8, 0, 21, 55, 9569 }, // î
+    { 11, 21, 8, 0, 20, 58, 9624 }, // ï
+    { 14, 22, 14, 0, 21, 77, 2794 }, // ð
+    { 15, 21, 16, 0, 20, 79, 9682 }, // ñ
+    { 13, 22, 14, 0, 21, 72, 9761 }, // ò
+    { 14, 23, 14, 0, 22, 81, 9833 }, // ó
+    { 13, 22, 14, 0, 21, 72, 9914 }, // ô
+    { 14, 21, 14, 0, 20, 74, 2871 }, // õ
+    { 14, 21, 14, 0, 20, 74, 9986 }, // ö
+    { 12, 13, 16, 2, 15, 39, 2945 }, // ÷
+    { 17, 15, 14, -2, 14, 64, 2984 }, // ø
+    { 15, 22, 15, 0, 21, 83, 10060 }, // ù
+    { 15, 23, 15, 0, 22, 87, 10143 }, // ú
+    { 15, 22, 15, 0, 21, 83, 10230 }, // û
+    { 15, 21, 15, 0, 20, 79, 10313 }, // ü
+    { 17, 28, 13, -4, 22, 119, 3048 }, // ý
+    { 17, 26, 14, -3, 20, 111, 3167 }, // þ
+    { 17, 26, 13, -4, 20, 111, 3278 }, // ÿ
+    { 20, 23, 19, -2, 23, 115, 3389 }, // Ā
+    { 15, 19, 15, 0, 18, 72, 3504 }, // ā
+    { 20, 24, 19, -2, 24, 120, 3576 }, // Ă
+    { 15, 21, 15, 0, 20, 79, 3696 }, // ă
+    { 20, 24, 19, -2, 18, 120, 3775 }, // Ą
+    { 15, 20, 15, 0, 14, 75, 3895 }, // ą
+    { 17, 26, 16, 0, 25, 111, 3970 }, // Ć
+    { 13, 23, 11, 0, 22, 75, 4081 }, // ć
+    { 17, 26, 16, 0, 25, 111, 4156 }, // Ĉ
+    { 12, 22, 11, 0, 21, 66, 4267 }, // ĉ
+    { 17, 25, 16, 0, 24, 107, 4333 }, // Ċ
+    { 12, 21, 11, 0, 20, 63, 4440 }, // ċ
+    { 17, 26, 16, 0, 25, 111, 4503 }, // Č
+    { 13, 22, 11, 0, 21, 72, 4614 }, // č
+    { 19, 26, 18, -1, 25, 124, 4686 }, // Ď
+    { 19, 21, 16, 0, 20, 100, 4810 }, // ď
+    { 19, 19, 18, -1, 18, 91, 4910 }, // Đ
+    { 17, 21, 15, 0, 20, 90, 5001 }, // đ
+    { 17, 23, 16, -1, 23, 98, 5091 }, // Ē
+    { 13, 19, 12, 0, 18, 62, 5189 }, // ē
+    { 17, 24, 16, -1, 24, 102, 5251 }, // Ĕ
+    { 13, 21, 12, 0, 20, 69, 5353 }, // ĕ
+    { 17, 24, 16, -1, 24, 102, 5422 }, // Ė
+    { 12, 21, 12, 0, 20, 63, 5524 }, // ė
+    { 17, 24, 16, -1, 18, 102, 5587 }, // Ę
+    { 12, 20, 12, 0, 14, 60, 5689 }, // ę
+    { 17, 25, 16, -1, 25, 107, 5749 }, // Ě
+    { 13, 22, 12, 0, 21, 72, 5856 }, // ě
+    { 18, 26, 18, 0, 25, 117, 5928 }, // Ĝ
+    { 17, 27, 13, -2, 21, 115, 6045 }, // ĝ
+    { 18, 25, 18, 0, 24, 113, 6160 }, // Ğ
+    { 17, 26, 13, -2, 20, 111, 6273 }, // ğ
+    { 18, 25, 18, 0, 24, 113, 6384 }, // Ġ
+    { 17, 26, 13, -2, 20, 111, 6497 }, // ġ
+    { 18, 25, 18, 0, 18, 113, 6608 }, // Ģ
+    { 17, 28, 13, -2, 22, 119, 6721 }, // ģ
+    { 22, 25, 20, -1, 25, 138, 6840 }, // Ĥ
+    { 15, 27, 15, 0, 26, 102, 6978 }, // ĥ
+    { 22, 18, 20, -1, 18, 99, 7080 }, // Ħ
+    { 15, 21, 15, 0, 20, 79, 7179 }, // ħ
+    { 13, 24, 10, -1, 24, 78, 7258 }, // Ĩ
+    { 11, 21, 8, 0, 20, 58, 7336 }, // ĩ
+    { 13, 23, 10, -1, 23, 75, 7394 }, // Ī
+    { 11, 19, 8, 0, 18, 53, 7469 }, // ī
+    { 13, 24, 10, -1, 24, 78, 7522 }, // Ĭ
+    { 11, 21, 8, 0, 20, 58, 7600 }, // ĭ
+    { 12, 24, 10, -1, 18, 72, 7658 }, // Į
+    { 9, 26, 8, 0, 20, 59, 7730 }, // į
+    { 12, 24, 10, -1, 24, 72, 7789 }, // İ
+    { 8, 15, 8, 0, 14, 30, 7861 }, // ı
+    { 22, 23, 19, -1, 18, 127, 7891 }, // Ĳ
+    { 17, 26, 16, 0, 20, 111, 8018 }, // ĳ
+    { 17, 30, 9, -5, 25, 128, 8129 }, // Ĵ
+    { 16, 27, 8, -5, 21, 108, 8257 }, // ĵ
+    { 20, 25, 18, -1, 18, 125, 8365 }, // Ķ
+    { 13, 27, 13, 0, 20, 88, 8490 }, // ķ
+    { 14, 15, 14, 0, 14, 53, 8578 }, // ĸ
+    { 15, 25, 14, -1, 25, 94, 8631 }, // Ĺ
+    { 10, 27, 8, 0, 26, 68, 8725 }, // ĺ
+    { 15, 25, 14, -1, 18, 94, 8793 }, // Ļ
+    { 9, 27, 8, -1, 20, 61, 8887 }, // ļ
+    { 16, 20, 14, -1, 20, 80, 8948 }, // Ľ
+    { 12, 21, 9, 0, 20, 63, 9028 }, // ľ
+    { 16, 18, 14, -1, 18, 72, 9091 }, // Ŀ
+    { 12, 21, 11, 0, 20, 63, 9163 }, // ŀ
+    { 15, 18, 14, -1, 18, 68, 9226 }, // Ł
+    { 10, 21, 8, -1, 20, 53, 9294 }, // ł
+    { 22, 26, 19, -1, 25, 143, 9347 }, // Ń
+    { 15, 23, 16, 0, 22, 87, 9490 }, // ń
+    { 22, 25, 19, -1, 18, 138, 9577 }, // Ņ
+    { 15, 21, 16, 0, 14, 79, 9715 }, // ņ
+    { 22, 26, 19, -1, 25, 143, 9794 }, // Ň
+    { 15, 22, 16, 0, 21, 83, 9937 }, // ň
+    { 20, 20, 21, 1, 19, 100, 10020 }, // ŉ
+    { 22, 23, 19, -1, 18, 127, 10120 }, // Ŋ
+    { 14, 20, 15, 0, 14, 70, 10247 }, // ŋ
+    { 18, 24, 18, 0, 23, 108, 10317 }, // Ō
+    { 14, 19, 14, 0, 18, 67, 10425 }, // ō
+    { 18, 25, 18, 0, 24, 113, 10492 }, // Ŏ
+    { 14, 21, 14, 0, 20, 74, 10605 }, // ŏ
+    { 19, 26, 18, 0, 25, 124, 10679 }, // Ő
+    { 15, 22, 14, 0, 21, 83, 10803 }, // ő
+    { 25, 19, 25, 0, 18, 119, 10392 }, // Œ
+    { 20, 15, 20, 0, 14, 75, 10511 }, // œ
+    { 18, 26, 17, -1, 25, 117, 10886 }, // Ŕ
+    { 13, 22, 12, 0, 22, 72, 11003 }, // ŕ
+    { 18, 25, 17, -1, 18, 113, 11075 }, // Ŗ
+    { 14, 21, 12, -1, 14, 74, 11188 }, // ŗ
+    { 18, 26, 17, -1, 25, 117, 11262 }, // Ř
+    { 13, 21, 12, 0, 21, 69, 11379 }, // ř
+    { 15, 26, 14, -1, 25, 98, 11448 }, // Ś
+    { 13, 23, 11, -1, 22, 75, 11546 }, // ś
+    { 15, 26, 14, -1, 25, 98, 11621 }, // Ŝ
+    { 13, 22, 11, -1, 21, 72, 11719 }, // ŝ
+    { 15, 25, 14, -1, 18, 94, 11791 }, // Ş
+    { 12, 21, 11, -1, 14, 63, 11885 }, // ş
+    { 16, 26, 14, -1, 25, 104, 11948 }, // Š
+    { 14, 22, 11, -1, 21, 77, 12052 }, // š
+    { 17, 25, 17, 1, 18, 107, 12129 }, // Ţ
+    { 11, 24, 11, 0, 17, 66, 12236 }, // ţ
+    { 17, 25, 17, 1, 25, 107, 12302 }, // Ť
+    { 13, 21, 11, 0, 20, 69, 12409 }, // ť
+    { 17, 18, 17, 1, 18, 77, 12478 }, // Ŧ
+    { 11, 18, 11, 0, 17, 50, 12555 }, // ŧ
+    { 19, 25, 20, 2, 24, 119, 12605 }, // Ũ
+    { 15, 21, 15, 0, 20, 79, 12724 }, // ũ
+    { 19, 24, 20, 2, 23, 114, 12803 }, // Ū
+    { 15, 19, 15, 0, 18, 72, 12917 }, // ū
+    { 19, 25, 20, 2, 24, 119, 12989 }, // Ŭ
+    { 15, 21, 15, 0, 20, 79, 13108 }, // ŭ
+    { 19, 26, 20, 2, 25, 124, 13187 }, // Ů
+    { 15, 22, 15, 0, 21, 83, 13311 }, // ů
+    { 19, 26, 20, 2, 25, 124, 13394 }, // Ű
+    { 15, 22, 15, 0, 21, 83, 13518 }, // ű
+    { 19, 24, 20, 2, 18, 114, 13601 }, // Ų
+    { 15, 20, 15, 0, 14, 75, 13715 }, // ų
+    { 26, 26, 25, 1, 25, 169, 13790 }, // Ŵ
+    { 19, 22, 19, 0, 21, 105, 13959 }, // ŵ
+    { 18, 25, 16, 1, 25, 113, 14064 }, // Ŷ
+    { 17, 27, 13, -4, 21, 115, 14177 }, // ŷ
+    { 18, 24, 16, 1, 24, 108, 14292 }, // Ÿ
+    { 17, 26, 16, -1, 25, 111, 14400 }, // Ź
+    { 14, 23, 12, -1, 22, 81, 14511 }, // ź
+    { 17, 25, 16, -1, 24, 107, 14592 }, // Ż
+    { 14, 21, 12, -1, 20, 74, 14699 }, // ż
+    { 17, 26, 16, -1, 25, 111, 14773 }, // Ž
+    { 14, 22, 12, -1, 21, 77, 14884 }, // ž
+    { 19, 26, 11, -5, 20, 124, 14961 }, // ſ
+    { 6, 7, 0, -4, 21, 11, 15085 }, // ̀
+    { 6, 7, 0, -2, 22, 11, 15096 }, // ́
+    { 9, 7, 0, -5, 21, 16, 15107 }, // ̂
+    { 10, 5, 0, -5, 20, 13, 15123 }, // ̃
+    { 9, 3, 0, -5, 18, 7, 15136 }, // ̄
+    { 8, 5, 0, -4, 20, 10, 15143 }, // ̆
+    { 4, 5, 0, -2, 20, 5, 15153 }, // ̇
+    { 10, 5, 0, -5, 20, 13, 15158 }, // ̈
+    { 7, 8, 0, -3, 22, 14, 15171 }, // ̉
+    { 8, 7, 0, -4, 21, 14, 15185 }, // ̊
+    { 11, 7, 0, -5, 21, 20, 15199 }, // ̋
+    { 9, 6, 0, -4, 21, 14, 15219 }, // ̌
+    { 8, 7, 0, -5, 21, 14, 15233 }, // ̏
+    { 9, 5, 0, -5, 20, 12, 15247 }, // ̑
+    { 6, 8, 0, -3, 22, 12, 15259 }, // ̒
+    { 6, 7, 0, -3, 22, 11, 15271 }, // ̓
+    { 5, 7, 0, -3, 22, 9, 15282 }, // ̔
+    { 4, 7, 0, -2, 22, 7, 15291 }, // ̕
+    { 6, 6, 0, -3, 16, 9, 15298 }, // ̛
+    { 4, 5, 0, -2, -1, 5, 15307 }, // ̣
+    { 10, 4, 0, -5, -2, 10, 15312 }, // ̤
+    { 6, 6, 0, -3, -1, 9, 15322 }, // ̥
+    { 5, 6, 0, -3, -1, 8, 15331 }, // ̦
+    { 6, 6, 0, -3, -1, 9, 15339 }, // ̧
+    { 6, 7, 0, -3, 1, 11, 15348 }, // ̨
+    { 5, 7, 7, -1, -1, 9, 15359 }, // ̩
+    { 9, 6, 0, -5, -1, 14, 15368 }, // ̭
+    { 8, 6, 0, -4, -1, 12, 15382 }, // ̮
+    { 10, 5, 0, -5, -2, 13, 15394 }, // ̰
+    { 9, 3, 0, -5, -2, 7, 15407 }, // ̱
+    { 8, 5, 0, -4, 20, 10, 15414 }, // ͂
+    { 10, 11, 0, -5, 26, 28, 15424 }, // ̈́
+    { 5, 6, 0, -2, -1, 8, 15452 }, // ͅ
+    { 17, 25, 16, -1, 25, 107, 15460 }, // Ѐ
+    { 17, 24, 16, -1, 24, 102, 0 }, // Ё
+    { 17, 24, 19, 1, 18, 102, 15567 }, // Ђ
+    { 17, 25, 14, -1, 25, 107, 15669 }, // Ѓ
+    { 17, 19, 16, 0, 18, 81, 15776 }, // Є
+    { 15, 19, 14, -1, 18, 72, 15857 }, // Ѕ
+    { 12, 18, 10, -1, 18, 54, 15929 }, // І
+    { 13, 24, 10, -1, 24, 78, 15983 }, // Ї
+    { 16, 23, 9, -5, 18, 92, 16061 }, // Ј
+    { 25, 19, 23, -2, 18, 119, 16153 }, // Љ
+    { 24, 19, 24, -1, 18, 114, 16272 }, // Њ
+    { 19, 18, 21, 1, 18, 86, 16386 }, // Ћ
+    { 20, 26, 18, -1, 25, 130, 16472 }, // Ќ
+    { 23, 25, 20, -1, 25, 144, 16602 }, // Ѝ
+    { 18, 26, 17, 1, 25, 117, 16746 }, // Ў
+    { 22, 24, 19, -1, 18, 132, 16863 }, // Џ
+    { 20, 18, 19, -2, 18, 90, 102 }, // А
+    { 17, 19, 16, -1, 18, 81, 192 }, // Б
+    { 16, 19, 16, -1, 18, 76, 273 }, // В
+    { 17, 18, 14, -1, 18, 77, 349 }, // Г
+    { 22, 24, 19, -2, 18, 132, 426 }, // Д
+    { 17, 18, 16, -1, 18, 77, 558 }, // Е
+    { 28, 19, 24, -2, 18, 133, 635 }, // Ж
+    { 15, 19, 14, -1, 18, 72, 768 }, // З
+    { 23, 18, 20, -1, 18, 104, 840 }, // И
+    { 23, 25, 20, -1, 25, 144, 944 }, // Й
+    { 20, 19, 18, -1, 18, 95, 1088 }, // К
+    { 22, 19, 18, -2, 18, 105, 1183 }, // Л
+    { 25, 18, 22, -2, 18, 113, 1288 }, // М
+    { 22, 18, 20, -1, 18, 99, 1401 }, // Н
+    { 18, 19, 18, 0, 18, 86, 1500 }, // О
+    { 22, 18, 19, -1, 18, 99, 1586 }, // П
+    { 17, 18, 15, -1, 18, 77, 1685 }, // Р
+    { 17, 19, 16, 0, 18, 81, 1762 }, // С
+    { 17, 18, 17, 1, 18, 77, 1843 }, // Т
+    { 18, 19, 17, 1, 18, 86, 1920 }, // У
+    { 19, 19, 19, 0, 18, 91, 2006 }, // Ф
+    { 21, 18, 17, -2, 18, 95, 2097 }, // Х
+    { 22, 24, 19, -1, 18, 132, 2192 }, // Ц
+    { 18, 18, 18, 1, 18, 81, 2324 }, // Ч
+    { 28, 18, 25, -1, 18, 126, 2405 }, // Ш
+    { 28, 24, 25, -1, 18, 168, 2531 }, // Щ
+    { 17, 19, 18, 1, 18, 81, 2699 }, // Ъ
+    { 26, 19, 24, -1, 18, 124, 2780 }, // Ы
+    { 16, 19, 15, -1, 18, 76, 2904 }, // Ь
+    { 17, 19, 16, -1, 18, 81, 2980 }, // Э
+    { 27, 19, 26, -1, 18, 129, 3061 }, // Ю
+    { 20, 19, 17, -2, 18, 95, 3190 }, // Я
+    { 15, 15, 15, 0, 14, 57, 3285 }, // а
+    { 15, 22, 14, 0, 21, 83, 3342 }, // б
+    { 13, 15, 13, 0, 14, 49, 3425 }, // в
+    { 11, 15, 11, 0, 14, 42, 3474 }, // г
+    { 14, 21, 14, 0, 20, 74, 3516 }, // д
+    { 12, 15, 12, 0, 14, 45, 3590 }, // е
+    { 23, 15, 22, 0, 14, 87, 3635 }, // ж
+    { 12, 15, 12, -1, 14, 45, 3722 }, // з
+    { 15, 15, 15, 0, 14, 57, 3767 }, // и
+    { 15, 21, 15, 0, 20, 79, 3824 }, // й
+    { 14, 15, 14, 0, 14, 53, 3903 }, // к
+    { 16, 15, 16, -1, 14, 60, 3956 }, // л
+    { 21, 15, 20, -1, 14, 79, 4016 }, // м
+    { 15, 15, 16, 0, 14, 57, 4095 }, // н
+    { 13, 15, 14, 0, 14, 49, 4152 }, // о
+    { 15, 15, 16, 0, 14, 57, 4201 }, // п
+    { 16, 20, 14, -2, 14, 80, 4258 }, // р
+    { 12, 15, 11, 0, 14, 45, 4338 }, // с
+    { 22, 15, 22, 0, 14, 83, 4383 }, // т
+    { 17, 20, 13, -4, 14, 85, 4466 }, // у
+    { 18, 26, 18, 0, 20, 117, 4551 }, // ф
+    { 16, 15, 14, -1, 14, 60, 4668 }, // х
+    { 16, 19, 16, 0, 14, 76, 4728 }, // ц
+    { 15, 15, 15, 0, 14, 57, 4804 }, // ч
+    { 21, 15, 21, 0, 14, 79, 4861 }, // ш
+    { 21, 19, 21, 0, 14, 100, 4940 }, // щ
+    { 13, 15, 14, 0, 14, 49, 5040 }, // ъ
+    { 19, 15, 20, 0, 14, 72, 5089 }, // ы
+    { 12, 15, 13, 0, 14, 45, 5161 }, // ь
+    { 13, 15, 12, -1, 14, 49, 5206 }, // э
+    { 20, 15, 20, 0, 14, 75, 5255 }, // ю
+    { 15, 15, 15, 0, 14, 57, 5330 }, // я
+    { 12, 22, 12, 0, 21, 66, 16995 }, // ѐ
+    { 13, 21, 12, 0, 20, 69, 5387 }, // ё
+    { 14, 26, 14, 0, 20, 91, 17061 }, // ђ
+    { 12, 23, 11, 0, 22, 69, 17152 }, // ѓ
+    { 12, 15, 12, 0, 14, 45, 17221 }, // є
+    { 12, 15, 11, -1, 14, 45, 17266 }, // ѕ
+    { 9, 21, 8, 0, 20, 48, 17311 }, // і
+    { 11, 21, 8, 0, 20, 58, 17359 }, // ї
+    { 14, 26, 8, -5, 20, 91, 17417 }, // ј
+    { 20, 15, 20, -1, 14, 75, 17508 }, // љ
+    { 19, 15, 19, 0, 14, 72, 17583 }, // њ
+    { 15, 21, 15, 0, 20, 79, 17655 }, // ћ
+    { 14, 23, 14, 0, 22, 81, 17734 }, // ќ
+    { 15, 22, 15, 0, 21, 83, 17815 }, // ѝ
+    { 17, 26, 13, -4, 20, 111, 17898 }, // ў
+    { 15, 19, 15, 0, 14, 72, 18009 }, // џ
+    { 16, 21, 18, 1, 20, 84, 18081 }, // Ѣ
+    { 19, 15, 20, 0, 14, 72, 18165 }, // ѣ
+    { 18, 19, 18, 0, 18, 86, 18237 }, // Ѳ
+    { 13, 15, 14, 0, 14, 49, 18323 }, // ѳ
+    { 20, 19, 19, 1, 18, 95, 18372 }, // Ѵ
+    { 16, 15, 15, -1, 14, 60, 18467 }, // ѵ
+    { 23, 31, 20, -1, 25, 179, 18527 }, // Ҋ
+    { 15, 25, 15, 0, 20, 94, 18706 }, // ҋ
+    { 16, 19, 15, -1, 18, 76, 18800 }, // Ҍ
+    { 11, 19, 13, 1, 18, 53, 18876 }, // ҍ
+    { 17, 18, 15, -1, 18, 77, 18929 }, // Ҏ
+    { 16, 20, 14, -2, 14, 80, 19006 }, // ҏ
+    { 17, 21, 14, -1, 21, 90, 19086 }, // Ґ
+    { 13, 18, 12, 0, 17, 59, 19176 }, // ґ
+    { 17, 18, 14, -1, 18, 77, 19235 }, // Ғ
+    { 11, 15, 11, 0, 14, 42, 19312 }, // ғ
+    { 17, 24, 17, -1, 18, 102, 19354 }, // Ҕ
+    { 13, 19, 14, 0, 13, 62, 19456 }, // ҕ
+    { 28, 24, 25, -2, 18, 168, 0 }, // Җ
+    { 23, 19, 22, 0, 14, 110, 168 }, // җ
+    { 15, 24, 14, -1, 18, 90, 278 }, // Ҙ
+    { 12, 19, 12, -1, 14, 57, 368 }, // ҙ
+    { 20, 24, 18, -1, 18, 120, 425 }, // Қ
+    { 14, 19, 14, 0, 14, 67, 545 }, // қ
+    { 21, 19, 18, -1, 18, 100, 612 }, // Ҝ
+    { 16, 15, 16, 0, 14, 60, 712 }, // ҝ
+    { 20, 19, 18, -1, 18, 95, 772 }, // Ҟ
+    { 14, 20, 14, 0, 19, 70, 867 }, // ҟ
+    { 21, 19, 21, 1, 18, 100, 937 }, // Ҡ
+    { 16, 15, 16, 0, 14, 60, 1037 }, // ҡ
+    { 22, 24, 20, -1, 18, 132, 1097 }, // Ң
+    { 16, 19, 16, 0, 14, 76, 1229 }, // ң
+    { 26, 18, 23, -1, 18, 117, 1305 }, // Ҥ
+    { 19, 15, 19, 0, 14, 72, 1422 }, // ҥ
+    { 26, 24, 26, -1, 18, 156, 1494 }, // Ҧ
+    { 20, 20, 21, 0, 14, 100, 1650 }, // ҧ
+    { 21, 19, 21, 0, 18, 100, 1750 }, // Ҩ
+    { 16, 15, 16, 0, 14, 60, 1850 }, // ҩ
+    { 17, 24, 16, 0, 18, 102, 1910 }, // Ҫ
+    { 12, 19, 11, 0, 14, 57, 2012 }, // ҫ
+    { 17, 24, 17, 1, 18, 102, 2069 }, // Ҭ
+    { 22, 19, 22, 0, 14, 105, 2171 }, // ҭ
+    { 18, 18, 16, 1, 18, 81, 2276 }, // Ү
+    { 13, 20, 13, 0, 14, 65, 2357 }, // ү
+    { 18, 18, 16, 1, 18, 81, 2422 }, // Ұ
+    { 13, 20, 13, 0, 14, 65, 2503 }, // ұ
+    { 21, 24, 17, -2, 18, 126, 2568 }, // Ҳ
+    { 16, 19, 14, -1, 14, 76, 2694 }, // ҳ
+    { 23, 24, 23, 1, 18, 138, 2770 }, // Ҵ
+    { 16, 23, 16, 0, 18, 92, 2908 }, // ҵ
+    { 18, 24, 18, 1, 18, 108, 3000 }, // Ҷ
+    { 15, 19, 15, 0, 14, 72, 3108 }, // ҷ
+    { 18, 18, 18, 1, 18, 81, 3180 }, // Ҹ
+    { 15, 15, 15, 0, 14, 57, 3261 }, // ҹ
+    { 18, 18, 18, -1, 18, 81, 3318 }, // Һ
+    { 15, 21, 15, 0, 20, 79, 3399 }, // һ
+    { 20, 19, 21, 0, 18, 95, 3478 }, // Ҽ
+    { 15, 15, 15, 0, 14, 57, 3573 }, // ҽ
+    { 20, 24, 21, 0, 18, 120, 3630 }, // Ҿ
+    { 15, 19, 15, 0, 14, 72, 3750 }, // ҿ
+    { 12, 18, 10, -1, 18, 54, 3822 }, // Ӏ
+    { 29, 26, 24, -3, 25, 189, 3876 }, // Ӂ
+    { 23, 21, 22, 0, 20, 121, 4065 }, // ӂ
+    { 20, 24, 18, -1, 18, 120, 4186 }, // Ӄ
+    { 14, 20, 14, 0, 14, 70, 4306 }, // ӄ
+    { 22, 24, 18, -2, 18, 132, 4376 }, // Ӆ
+    { 17, 19, 16, -1, 14, 81, 4508 }, // ӆ
+    { 22, 24, 20, -1, 18, 132, 4589 }, // Ӈ
+    { 15, 20, 15, 0, 14, 75, 4721 }, // ӈ
+    { 22, 24, 20, -1, 18, 132, 4796 }, // Ӊ
+    { 16, 19, 16, 0, 14, 76, 4928 }, // ӊ
+    { 18, 24, 18, 1, 18, 108, 5004 }, // Ӌ
+    { 14, 19, 15, 0, 14, 67, 5112 }, // ӌ
+    { 25, 24, 23, -2, 18, 150, 5179 }, // Ӎ
+    { 21, 19, 20, -1, 14, 100, 5329 }, // ӎ
+    { 12, 20, 10, -1, 20, 60, 5429 }, // ӏ
+    { 20, 25, 19, -2, 25, 125, 5489 }, // Ӑ
+    { 15, 21, 15, 0, 20, 79, 5614 }, // ӑ
+    { 20, 24, 19, -2, 24, 120, 5693 }, // Ӓ
+    { 15, 21, 15, 0, 20, 79, 5813 }, // ӓ
+    { 26, 18, 23, -2, 18, 117, 5892 }, // Ӕ
+    { 20, 15, 20, 0, 14, 75, 6009 }, // ӕ
+    { 17, 25, 16, -1, 25, 107, 6084 }, // Ӗ
+    { 13, 21, 12, 0, 20, 69, 6191 }, // ӗ
+    { 16, 19, 17, 0, 18, 76, 6260 }, // Ә
+    { 12, 15, 12, 0, 14, 45, 6336 }, // ә
+    { 16, 25, 17, 0, 24, 100, 6381 }, // Ӛ
+    { 12, 21, 12, 0, 20, 63, 6481 }, // ӛ
+    { 28, 25, 24, -2, 24, 175, 6544 }, // Ӝ
+    { 23, 21, 22, 0, 20, 121, 6719 }, // ӝ
+    { 15, 25, 14, -1, 24, 94, 6840 }, // Ӟ
+    { 13, 21, 12, -1, 20, 69, 6934 }, // ӟ
+    { 16, 19, 14, -1, 18, 76, 7003 }, // Ӡ
+    { 16, 19, 13, -2, 13, 76, 7079 }, // ӡ
+    { 23, 23, 20, -1, 23, 133, 7155 }, // Ӣ
+    { 15, 19, 15, 0, 18, 72, 7288 }, // ӣ
+    { 23, 24, 20, -1, 24, 138, 7360 }, // Ӥ
+    { 15, 21, 15, 0, 20, 79, 7498 }, // ӥ
+    { 18, 25, 18, 0, 24, 113, 7577 }, // Ӧ
+    { 14, 21, 14, 0, 20, 74, 7690 }, // ӧ
+    { 18, 19, 18, 0, 18, 86, 7764 }, // Ө
+    { 13, 15, 14, 0, 14, 49, 7850 }, // ө
+    { 18, 25, 18, 0, 24, 113, 7899 }, // Ӫ
+    { 14, 21, 14, 0, 20, 74, 8012 }, // ӫ
+    { 17, 25, 16, -1, 24, 107, 8086 }, // Ӭ
+    { 13, 21, 12, -1, 20, 69, 8193 }, // ӭ
+    { 18, 24, 17, 1, 23, 108, 8262 }, // Ӯ
+    { 17, 24, 13, -4, 18, 102, 8370 }, // ӯ
+    { 18, 25, 17, 1, 24, 113, 8472 }, // Ӱ
+    { 17, 26, 13, -4, 20, 111, 8585 }, // ӱ
+    { 18, 26, 17, 1, 25, 117, 8696 }, // Ӳ
+    { 17, 27, 13, -4, 21, 115, 8813 }, // ӳ
+    { 18, 24, 18, 1, 24, 108, 8928 }, // Ӵ
+    { 15, 21, 15, 0, 20, 79, 9036 }, // ӵ
+    { 17, 24, 14, -1, 18, 102, 9115 }, // Ӷ
+    { 11, 19, 11, 0, 14, 53, 9217 }, // ӷ
+    { 26, 25, 24, -1, 24, 163, 9270 }, // Ӹ
+    { 19, 21, 20, 0, 20, 100, 9433 }, // ӹ
+    { 17, 24, 14, -1, 18, 102, 9533 }, // Ӻ
+    { 11, 19, 11, 0, 14, 53, 9635 }, // ӻ
+    { 21, 24, 17, -2, 18, 126, 9688 }, // Ӽ
+    { 16, 20, 14, -1, 14, 80, 9814 }, // ӽ
+    { 21, 18, 17, -2, 18, 95, 9894 }, // Ӿ
+    { 16, 15, 14, -1, 14, 60, 9989 }, // ӿ
+    { 0, 0, 13, 0, 0, 0, 10049 }, //  
+    { 0, 0, 25, 0, 0, 0, 10049 }, //  
+    { 0, 0, 13, 0, 0, 0, 10049 }, //  
+    { 0, 0, 25, 0, 0, 0, 10049 }, //  
+    { 0, 0, 8, 0, 0, 0, 10049 }, //  
+    { 0, 0, 6, 0, 0, 0, 10049 }, //  
+    { 0, 0, 4, 0, 0, 0, 10049 }, //  
+    { 0, 0, 16, 0, 0, 0, 10049 }, //  
+    { 0, 0, 8, 0, 0, 0, 10049 }, //  
+    { 0, 0, 5, 0, 0, 0, 10049 }, //  
+    { 0, 0, 1, 0, 0, 0, 10049 }, //  
+    { 0, 0, 0, 0, 0, 0, 10049 }, // ​
+    { 2, 21, 0, -1, 15, 11, 10049 }, // ‌
+    { 6, 23, 0, -3, 17, 35, 10060 }, // ‍
+    { 8, 24, 0, -4, 18, 48, 10095 }, // ‎
+    { 8, 24, 0, -4, 18, 48, 10143 }, // ‏
+    { 8, 3, 10, 1, 8, 6, 10191 }, // ‐
+    { 8, 3, 10, 1, 8, 6, 10197 }, // ‑
+    { 13, 3, 16, 1, 10, 10, 10203 }, // ‒
+    { 13, 3, 13, 0, 8, 10, 10586 }, // –
+    { 25, 3, 25, 0, 8, 19, 10596 }, // —
+    { 25, 3, 25, 0, 8, 19, 10213 }, // ―
+    { 9, 26, 13, 2, 20, 59, 10232 }, // ‖
+    { 13, 7, 13, 0, -1, 23, 10291 }, // ‗
+    { 6, 9, 8, 2, 19, 14, 10615 }, // ‘
+    { 6, 9, 8, 1, 19, 14, 10629 }, // ’
+    { 6, 9, 8, 0, 4, 14, 10314 }, // ‚
+    { 6, 9, 8, 1, 19, 14, 10328 }, // ‛
+    { 11, 9, 13, 2, 19, 25, 10643 }, // “
+    { 12, 9, 13, 1, 19, 27, 10668 }, // ”
+    { 11, 9, 13, 0, 4, 25, 10342 }, // „
+    { 11, 9, 13, 1, 19, 25, 10367 }, // ‟
+    { 11, 17, 12, 1, 18, 47, 10392 }, // †
+    { 13, 20, 12, -1, 18, 65, 10439 }, // ‡
+    { 7, 7, 8, 0, 10, 13, 10504 }, // •
+    { 9, 9, 16, 3, 13, 21, 10517 }, // ‣
+    { 5, 5, 7, 1, 4, 7, 10538 }, // ․
+    { 11, 5, 13, 1, 4, 14, 10545 }, // ‥
+    { 21, 5, 25, 2, 4, 27, 10695 }, // …
+    { 5, 5, 7, 1, 9, 7, 10559 }, // ‧
+    { 0, 0, 0, 0, 0, 0, 10566 }, //  
+    { 0, 0, 0, 0, 0, 0, 10566 }, //  
+    { 8, 24, 0, -4, 18, 48, 10566 }, // ‪
+    { 8, 24, 0, -4, 18, 48, 10614 }, // ‫
+    { 8, 24, 0, -4, 18, 48, 10662 }, // ‬
+    { 11, 24, 0, -5, 18, 66, 10710 }, // ‭
+    { 11, 24, 0, -5, 18, 66, 10776 }, // ‮
+    { 0, 0, 3, 0, 0, 0, 10842 }, //  
+    { 33, 21, 35, 1, 19, 174, 10842 }, // ‰
+    { 6, 9, 6, 0, 18, 14, 11016 }, // ′
+    { 11, 9, 11, 0, 18, 25, 11030 }, // ″
+    { 17, 9, 17, 0, 18, 39, 11055 }, // ‴
+    { 6, 9, 6, 0, 18, 14, 11094 }, // ‵
+    { 12, 9, 12, 0, 18, 27, 11108 }, // ‶
+    { 17, 9, 17, 0, 18, 39, 11135 }, // ‷
+    { 11, 6, 12, 1, 0, 17, 11174 }, // ‸
+    { 9, 11, 9, 0, 12, 25, 11191 }, // ‹
+    { 8, 11, 9, 0, 12, 22, 11216 }, // ›
+    { 16, 18, 16, 0, 17, 72, 11238 }, // ※
+    { 15, 20, 15, 1, 19, 75, 11310 }, // ‼
+    { 13, 3, 13, 0, 21, 10, 11385 }, // ‾
+    { 6, 3, 8, 1, 8, 5, 11395 }, // ⁃
+    { 17, 21, 7, -5, 19, 90, 11400 }, // ⁄
+    { 18, 20, 20, 2, 19, 90, 11490 }, // ⁇
+    { 16, 20, 17, 2, 19, 80, 11580 }, // ⁈
+    { 17, 20, 17, 1, 19, 85, 11660 }, // ⁉
+    { 15, 6, 25, 5, 10, 23, 11745 }, // ⁓
+    { 23, 9, 23, 0, 18, 52, 11768 }, // ⁗
+    { 0, 0, 6, 0, 0, 0, 11820 }, //  
+    { 0, 0, 0, 0, 0, 0, 11820 }, // ⁠
+    { 0, 0, 0, 0, 0, 0, 11820 }, // ⁡
+    { 0, 0, 0, 0, 0, 0, 11820 }, // ⁢
+    { 0, 0, 0, 0, 0, 0, 11820 }, // ⁣
+    { 0, 0, 0, 0, 0, 0, 11820 }, // ⁤
+    { 11, 12, 11, 0, 21, 33, 11820 }, // ⁰
+    { 11, 12, 11, 0, 21, 33, 11853 }, // ⁴
+    { 11, 13, 11, 0, 21, 36, 11886 }, // ⁵
+    { 10, 12, 11, 1, 21, 30, 11922 }, // ⁶
+    { 9, 13, 11, 2, 21, 30, 11952 }, // ⁷
+    { 11, 12, 11, 0, 21, 33, 11982 }, // ⁸
+    { 11, 12, 11, 0, 21, 33, 12015 }, // ⁹
+    { 11, 10, 14, 2, 18, 28, 12048 }, // ⁿ
+    { 11, 12, 11, 0, 8, 33, 12076 }, // ₀
+    { 8, 13, 11, 1, 9, 26, 12109 }, // ₁
+    { 11, 12, 11, 0, 8, 33, 12135 }, // ₂
+    { 9, 12, 11, 1, 8, 27, 12168 }, // ₃
+    { 11, 12, 11, 0, 8, 33, 12195 }, // ₄
+    { 11, 12, 11, 0, 8, 33, 12228 }, // ₅
+    { 10, 12, 11, 1, 8, 30, 12261 }, // ₆
+    { 9, 12, 11, 2, 8, 27, 12291 }, // ₇
+    { 11, 12, 11, 0, 8, 33, 12318 }, // ₈
+    { 11, 12, 11, 0, 8, 33, 12351 }, // ₉
+    { 17, 18, 16, -1, 18, 77, 12384 }, // ₣
+    { 17, 19, 16, -1, 18, 81, 12461 }, // ₤
+    { 33, 19, 33, 0, 18, 157, 12542 }, // ₧
+    { 18, 19, 16, -1, 18, 86, 12699 }, // €
+    { 17, 12, 25, 4, 15, 51, 12785 }, // ←
+    { 13, 17, 25, 6, 17, 56, 12836 }, // ↑
+    { 17, 12, 25, 4, 15, 51, 12892 }, // →
+    { 13, 17, 25, 6, 17, 56, 12943 }, // ↓
+    { 17, 11, 25, 4, 14, 47, 12999 }, // ↔
+    { 11, 17, 25, 7, 17, 47, 13046 }, // ↕
+    { 13, 18, 25, 6, 18, 59, 13093 }, // ↨
+    { 11, 18, 25, 7, 18, 50, 13152 }, // ↲
+    { 11, 18, 25, 7, 18, 50, 13202 }, // ↳
+    { 15, 14, 25, 5, 16, 53, 13252 }, // ↵
+    { 17, 15, 25, 4, 16, 64, 13305 }, // ⇐
+    { 15, 17, 25, 5, 17, 64, 13369 }, // ⇑
+    { 17, 15, 25, 4, 16, 64, 13433 }, // ⇒
+    { 15, 17, 25, 5, 17, 64, 13497 }, // ⇓
+    { 17, 13, 25, 4, 15, 56, 13561 }, // ⇔
+    { 18, 19, 25, 3, 18, 86, 13617 }, // ∀
+    { 13, 21, 16, 1, 20, 69, 13703 }, // ∂
+    { 13, 18, 25, 6, 18, 59, 13772 }, // ∃
+    { 19, 21, 25, 3, 19, 100, 13831 }, // ∅
+    { 17, 18, 17, 0, 18, 77, 13931 }, // ∆
+    { 17, 19, 25, 4, 18, 81, 14008 }, // ∇
+    { 17, 18, 25, 4, 18, 77, 14089 }, // ∈
+    { 17, 23, 25, 4, 20, 98, 14166 }, // ∉
+    { 17, 15, 25, 4, 16, 64, 14264 }, // ∊
+    { 17, 18, 25, 4, 18, 77, 14328 }, // ∋
+    { 17, 23, 25, 4, 20, 98, 14405 }, // ∌
+    { 17, 15, 25, 4, 16, 64, 14503 }, // ∍
+    { 21, 22, 21, 0, 18, 116, 14567 }, // ∏
+    { 16, 23, 17, 0, 18, 92, 14683 }, // ∑
+    { 12, 3, 16, 2, 10, 9, 14775 }, // −
+    { 15, 20, 13, -1, 18, 75, 14784 }, // ∕
+    { 13, 20, 13, 0, 18, 65, 14859 }, // ∖
+    { 12, 13, 16, 2, 15, 39, 14924 }, // ∗
+    { 10, 10, 16, 3, 13, 25, 14963 }, // ∘
+    { 6, 5, 16, 5, 9, 8, 14988 }, // ∙
+    { 17, 24, 16, -1, 21, 102, 14996 }, // √
+    { 13, 10, 16, 1, 13, 33, 15098 }, // ∝
+    { 16, 10, 16, 0, 13, 40, 15131 }, // ∞
+    { 17, 18, 25, 4, 18, 77, 15171 }, // ∟
+    { 19, 18, 25, 3, 18, 86, 15248 }, // ∠
+    { 4, 26, 13, 4, 20, 26, 15334 }, // ∣
+    { 9, 26, 13, 2, 20, 59, 15360 }, // ∥
+    { 18, 18, 25, 4, 18, 81, 15419 }, // ∧
+    { 18, 18, 25, 4, 18, 81, 15500 }, // ∨
+    { 15, 18, 25, 5, 18, 68, 15581 }, // ∩
+    { 15, 19, 25, 5, 18, 72, 15649 }, // ∪
+    { 15, 26, 16, 0, 20, 98, 15721 }, // ∫
+    { 17, 15, 25, 4, 14, 64, 15819 }, // ∴
+    { 17, 15, 25, 4, 14, 64, 15883 }, // ∵
+    { 6, 15, 8, 1, 16, 23, 15947 }, // ∶
+    { 17, 15, 25, 4, 14, 64, 15970 }, // ∷
+    { 15, 6, 25, 5, 10, 23, 16034 }, // ∼
+    { 15, 15, 25, 5, 16, 57, 16057 }, // ≅
+    { 13, 11, 16, 1, 14, 36, 16114 }, // ≈
+    { 15, 10, 25, 5, 12, 38, 16150 }, // ≍
+    { 12, 13, 16, 2, 15, 39, 16188 }, // ≠
+    { 15, 13, 25, 5, 14, 49, 16227 }, // ≡
+    { 12, 15, 16, 2, 15, 45, 16276 }, // ≤
+    { 12, 16, 16, 2, 16, 48, 16321 }, // ≥
+    { 21, 13, 25, 2, 15, 69, 16369 }, // ≪
+    { 21, 13, 25, 2, 15, 69, 16438 }, // ≫
+    { 17, 15, 25, 4, 16, 64, 16507 }, // ⊃
+    { 17, 23, 25, 4, 20, 98, 16571 }, // ⊄
+    { 17, 23, 25, 4, 20, 98, 16669 }, // ⊅
+    { 17, 18, 25, 4, 18, 77, 16767 }, // ⊆
+    { 17, 18, 25, 4, 18, 77, 16844 }, // ⊇
+    { 19, 19, 25, 3, 18, 91, 16921 }, // ⊕
+    { 19, 19, 25, 3, 18, 91, 17012 }, // ⊖
+    { 19, 19, 25, 3, 18, 91, 17103 }, // ⊗
+    { 19, 19, 25, 3, 18, 91, 17194 }, // ⊘
+    { 15, 18, 25, 5, 18, 68, 17285 }, // ⊥
+    { 6, 5, 16, 5, 9, 8, 17353 }, // ⋅
+    { 23, 5, 25, 1, 9, 29, 17361 }, // ⋯
+    { 27, 26, 19, -5, 20, 176, 17390 }, // ﬀ
+    { 21, 26, 16, -5, 20, 137, 17566 }, // ﬁ
+    { 22, 26, 17, -5, 20, 143, 17703 }, // ﬂ
+    { 29, 26, 24, -5, 20, 189, 17846 }, // ﬃ
+    { 30, 26, 25, -5, 20, 195, 18035 }, // ﬄ
+    { 24, 26, 19, -5, 20, 156, 18230 }, // ﬅ
+    { 22, 19, 21, -1, 18, 105, 18386 }, // ﬆ
+    { 25, 24, 25, 0, 21, 150, 18491 }, // �
 };
 
 static const EpdUnicodeInterval bookerly_12_bolditalicIntervals[] = {
@@ -2431,32 +2480,327 @@ static const EpdUnicodeInterval bookerly_12_bolditalicIntervals[] = {
     { 0x22A5, 0x22A5, 0x2E7 },
     { 0x22C5, 0x22C5, 0x2E8 },
     { 0x22EF, 0x22EF, 0x2E9 },
-    { 0xFFFD, 0xFFFD, 0x2EA },
+    { 0xFB00, 0xFB06, 0x2EA },
+    { 0xFFFD, 0xFFFD, 0x2F1 },
 };
 
 static const EpdFontGroup bookerly_12_bolditalicGroups[] = {
-    { 0, 3671, 6271, 100, 0 },
-    { 3671, 3535, 7510, 96, 100 },
-    { 7206, 5475, 11890, 128, 196 },
-    { 12681, 339, 375, 33, 324 },
-    { 13020, 8275, 19563, 220, 357 },
-    { 21295, 1112, 1907, 74, 577 },
-    { 22407, 444, 564, 18, 651 },
-    { 22851, 282, 401, 4, 669 },
-    { 23133, 504, 832, 15, 673 },
-    { 23637, 1953, 3773, 58, 688 },
-    { 25590, 105, 150, 1, 746 },
+    { 0, 5042, 10722, 151, 5 },
+    { 5042, 3081, 5456, 66, 358 },
+    { 8123, 8933, 19518, 261, 0 },
+    { 17056, 9312, 18641, 276, 471 },
+};
+
+static const uint8_t bookerly_12_bolditalicGlyphGroups[754] = {
+    2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0,
+    2, 2, 2, 2, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0,
+    0, 2, 2, 2, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0,
+    0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 3, 3, 3, 0, 0, 3, 3, 0, 0, 3,
+    3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+};
+
+static const uint8_t bookerly_12_bolditalicKernLeftClasses[754] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 55, 0, 110,
+    0, 1, 87, 1, 29, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 105,
+    105, 0, 0, 0, 0, 0, 2, 101, 91, 14, 41, 79, 54, 23, 23, 43,
+    65, 40, 123, 32, 14, 71, 53, 21, 64, 17, 4, 26, 48, 83, 10, 90,
+    69, 31, 0, 0, 0, 0, 19, 22, 74, 129, 56, 33, 15, 36, 124, 116,
+    114, 0, 36, 36, 22, 22, 95, 49, 74, 0, 19, 30, 30, 112, 30, 80,
+    62, 0, 0, 0, 0, 72, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 87, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 84,
+    0, 0, 0, 57, 2, 2, 2, 2, 2, 2, 41, 91, 41, 41, 41, 41,
+    23, 23, 23, 23, 14, 32, 14, 14, 14, 14, 14, 0, 14, 4, 4, 4,
+    4, 10, 68, 130, 19, 19, 19, 19, 19, 19, 56, 113, 56, 56, 56, 56,
+    124, 125, 27, 27, 22, 36, 22, 22, 22, 22, 22, 0, 94, 19, 19, 19,
+    19, 30, 22, 30, 2, 19, 2, 19, 47, 63, 91, 74, 91, 74, 91, 74,
+    91, 74, 14, 24, 14, 129, 41, 56, 41, 56, 41, 56, 100, 107, 41, 56,
+    54, 15, 54, 15, 54, 15, 54, 15, 23, 36, 93, 36, 23, 27, 23, 27,
+    23, 27, 75, 109, 23, 19, 43, 116, 43, 104, 65, 114, 74, 40, 0, 40,
+    127, 0, 24, 0, 0, 40, 117, 32, 36, 32, 36, 32, 36, 36, 32, 116,
+    14, 22, 14, 22, 14, 22, 41, 56, 21, 49, 21, 49, 21, 49, 64, 74,
+    64, 74, 64, 113, 64, 74, 17, 128, 17, 0, 17, 0, 4, 19, 4, 19,
+    4, 19, 4, 19, 4, 19, 4, 63, 26, 30, 10, 30, 10, 90, 80, 90,
+    80, 90, 80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 41, 41, 77, 0, 0, 64, 11, 11, 58, 18, 18,
+    59, 8, 11, 3, 11, 12, 131, 39, 9, 25, 41, 8, 39, 11, 11, 8,
+    11, 96, 11, 16, 11, 34, 106, 9, 3, 66, 50, 25, 11, 11, 25, 18,
+    11, 18, 16, 16, 11, 13, 119, 70, 74, 98, 86, 102, 70, 13, 13, 99,
+    13, 13, 13, 28, 36, 28, 74, 36, 37, 98, 85, 6, 13, 13, 6, 108,
+    13, 44, 28, 28, 13, 86, 86, 122, 74, 74, 126, 124, 97, 115, 44, 44,
+    36, 99, 13, 37, 13, 103, 44, 16, 28, 45, 82, 25, 6, 18, 44, 34,
+    28, 38, 81, 42, 74, 0, 0, 73, 61, 39, 70, 67, 61, 8, 99, 8,
+    99, 8, 99, 25, 6, 0, 0, 0, 0, 78, 70, 106, 74, 9, 6, 20,
+    92, 20, 89, 46, 76, 25, 6, 25, 6, 11, 13, 60, 36, 0, 86, 0,
+    86, 11, 8, 102, 51, 111, 25, 6, 58, 115, 25, 6, 11, 0, 25, 6,
+    118, 12, 13, 12, 13, 41, 86, 41, 86, 16, 28, 16, 28, 8, 102, 39,
+    70, 120, 121, 11, 13, 11, 13, 16, 28, 16, 28, 16, 28, 16, 28, 3,
+    37, 3, 37, 3, 37, 11, 13, 9, 74, 11, 13, 42, 74, 52, 88, 50,
+    85, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 87, 87, 0, 87, 87, 87, 0, 0, 7, 5, 35, 7, 7, 5, 1,
+    0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 84, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 124, 0, 124, 0, 0,
+    0, 0,
+};
+
+static const uint8_t bookerly_12_bolditalicKernRightClasses[754] = {
+    0, 0, 0, 0, 0, 0, 97, 96, 0, 0, 0, 0, 96, 0, 73, 25,
+    0, 21, 36, 2, 31, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 42,
+    41, 0, 0, 0, 57, 0, 3, 39, 7, 39, 9, 9, 7, 9, 9, 48,
+    9, 9, 86, 9, 7, 39, 7, 39, 89, 30, 12, 20, 20, 70, 16, 0,
+    0, 11, 87, 0, 0, 0, 1, 4, 1, 1, 1, 13, 14, 4, 79, 55,
+    4, 4, 38, 38, 1, 38, 1, 38, 34, 78, 37, 18, 18, 95, 69, 68,
+    0, 0, 82, 0, 0, 106, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33,
+    0, 36, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 84,
+    0, 0, 0, 103, 3, 3, 3, 3, 3, 3, 44, 7, 9, 9, 9, 9,
+    9, 9, 9, 9, 39, 9, 7, 7, 7, 7, 7, 0, 7, 12, 12, 12,
+    12, 16, 9, 83, 1, 1, 1, 1, 56, 1, 1, 1, 1, 1, 1, 1,
+    94, 79, 46, 46, 1, 38, 1, 1, 1, 1, 1, 0, 67, 37, 37, 37,
+    37, 18, 4, 18, 3, 1, 3, 1, 3, 1, 7, 1, 7, 1, 7, 1,
+    7, 56, 39, 1, 39, 1, 9, 1, 9, 1, 9, 1, 9, 1, 9, 1,
+    7, 14, 7, 14, 7, 14, 7, 14, 9, 4, 9, 58, 9, 46, 9, 46,
+    9, 46, 9, 79, 9, 38, 9, 79, 48, 101, 9, 4, 38, 9, 4, 9,
+    4, 9, 4, 9, 4, 9, 54, 9, 38, 9, 38, 9, 38, 38, 9, 38,
+    7, 1, 7, 1, 7, 1, 7, 1, 39, 38, 39, 38, 39, 38, 89, 34,
+    89, 34, 89, 34, 89, 77, 30, 78, 30, 78, 30, 78, 12, 37, 12, 37,
+    12, 37, 12, 37, 12, 37, 12, 37, 20, 18, 16, 18, 16, 0, 68, 0,
+    68, 0, 68, 83, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 6, 6, 19, 6, 22, 102, 6, 6, 60, 28, 6,
+    19, 6, 6, 51, 6, 23, 6, 81, 6, 63, 6, 43, 92, 6, 6, 6,
+    28, 75, 6, 22, 6, 81, 22, 19, 51, 85, 26, 6, 24, 6, 6, 19,
+    6, 6, 104, 6, 66, 5, 90, 5, 72, 88, 5, 47, 49, 35, 35, 59,
+    17, 65, 59, 5, 59, 93, 5, 59, 8, 5, 71, 35, 15, 35, 35, 76,
+    35, 35, 49, 59, 62, 5, 5, 32, 72, 5, 80, 97, 98, 45, 17, 59,
+    32, 59, 35, 8, 35, 19, 59, 22, 5, 61, 53, 6, 59, 107, 100, 81,
+    59, 6, 91, 6, 72, 6, 59, 43, 47, 92, 49, 6, 59, 6, 59, 0,
+    0, 19, 0, 6, 59, 6, 59, 6, 59, 22, 5, 22, 5, 19, 59, 40,
+    8, 40, 8, 26, 71, 0, 0, 24, 15, 24, 15, 6, 32, 50, 29, 50,
+    29, 6, 43, 47, 6, 59, 28, 17, 6, 59, 6, 59, 24, 15, 0, 65,
+    99, 23, 5, 23, 5, 52, 5, 6, 5, 105, 74, 0, 74, 43, 47, 92,
+    49, 97, 64, 6, 35, 6, 35, 22, 5, 22, 5, 22, 5, 0, 49, 51,
+    8, 51, 8, 51, 8, 0, 15, 6, 72, 6, 35, 6, 72, 26, 71, 26,
+    71, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 36, 36, 0, 36, 36, 36, 0, 0, 10, 27, 2, 10, 10, 27, 2,
+    0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 84, 0, 97, 0, 0, 0,
+    57, 57, 97, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 13, 13, 13, 13, 13,
+    34, 0,
+};
+
+static const int8_t bookerly_12_bolditalicKernMatrix[14256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 1, -1, -1, 1, -2, 0, -1, 1, 0, -2, -2, 0, -1, -1, -2, 0, -1, 1, -2, 0, 1, -2, 1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -2, 0, 0, 1, 1, 3, 0, 0, 3, 0, -3, 0, 1, -1, 0, 3, 0, 0, 0, 0, 3, -2, 0, 1, 0, 0, 1, 0, 0, -1, 1, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, -1, 0, 0, -2, -4, -1, 0, 0, 0, -2, 0, -2, 0, -3, 0, 0, 0, 0, -1, 0, -2, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -3, 0, 0, -2, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -4, 0, 0, 0, -3, 0, -3, 1, 2, 1, 1, -2, -2, 0, -2, 2, 0, 0, 0, 0, 0, 0, 0, 1, -1, -1, 0, 0, 0, 0, -2, 0, -1, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 1, -2, -2, -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, -2, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -2, -2, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, -4, -4, 0, -2, -1, -2, 0, -1, 0, 0, -1, -1, -3, 0, 0, -4, 0, -1, -1, -4, -2, -4, 0, 0, -1, 0, -3, -2, -1, 0, 0, 0, -2, -1, 0, -1, 0, 0, 0, 0, 0, -1, -4, 0, 0, -2, -1, -2, 0, 0, -4, 0, 0, 0, -2, -1, 0, 0, -1, -1, -3, -3, 0, -2, -2, -2, -1, 0, -1, -1, -1, 0, 0, -1, 0, -2, 0, -1, -2, 0, 0, 0, 0, -1, -1, 0, -2, -1, -2, -2, -2, 0, -1, -1, 0, -1, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, -2, -3, 0, -2, -1, 0, 0, -1, 0, 0, -1, -1, -2, 0, 0, -4, 0, 0, -1, -2, 0, -3, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, -1, 0, 0, 0, 0, -3, 0, 0, 0, -2, 0, 0, 0, 0, -1, -2, -2, 0, -1, -2, -2, -1, 0, 0, 0, 0, 0, -1, -1, 0, -2, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, -2, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, 0, -1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 1, 0, 1, -2, 0, 0, 1, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, -1, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, -2, 0, -2, 0, 2, 0, 1, -1, -2, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, 0, -1, 0, 0, -2, 1, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -2, -2, 1, 0, 0, -1, 0, 0, 0, 1, 0, 0, -1, 0, 1, 0, 0, 0, 0, -2, 0, 0, 0, 2, 0, 0, 0, 0, 0, -2, 0, -1, -1, 0, -1, 0, 0, 1, 0, -2, -2, 0, -2, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2, -4, 0, 0, 0, -2, 0, 0, 0, -2, 0, 0, -1, 1, -3, -1, 2, -2, 1, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -2, 0, 0, 1, 0, 0, 0, 0, 0, 0, -3, -1, 1, -2, 0, 0, 0, -1, 0, 0, 0, -3, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 2, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 2, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -2, -2, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -2, 0, 0, 0, 2, 0, 1, 0, 0, 0, -2, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -2, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -2, 0, 0, 0, -2, -1, -2, 1, 2, 1, 0, -2, -2, 0, -2, 1, -1, 0, 0, -1, 0, 0, 0, 1, -1, -1, 0, 0, 0, 0, -1, 0, -1, 0, 1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, -1, -1, -1, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, -1, 1, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, -1, 0, 0, -1, -2, -2, 0, 0, 0, -2, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, -1, 0, 0, -2, 0, 0, -1, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 2, 3, 0, 1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 3, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 1, 1, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 2, 0, 0, 0, 1, 1, 1, 0, 0, 2, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, -3, -3, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, -2, 0, 1, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, -1, 0, -1, 0, 0, 1, 0, -2, -2, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -2, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, -2, 1, -2, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, 0, -3, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, -1, 0, 0, 1, 0, -2, -1, 0, -1, 0, 0, 0, 0, 0, 0, -3, 0, 0, -2, 0, -2, 0, 0, -3, 0, 1, 0, -2, 0, 1, 0, 0, 0, -2, -2, -1, -2, -1, -2, -2, 0, 0, -1, -1, 0, -2, -1, -1, -2, -1, 0, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 2, 1, 0, 1, 0, -1, 1, 0, 0, -1, 2, 2, -2, -2, 0, -1, -1, -2, 0, 0, 2, -2, 0, 2, 0, 2, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 1, -2, 0, 0, 1, 1, 1, 0, 0, 3, 0, -2, 0, 1, -1, 1, 1, 0, 0, 1, 0, 3, -2, 0, 2, 0, 0, 2, 0, 0, -1, 2, 1, 0, 0, 0, 1, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -1, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 2, 0, 0, 0, 0, 0, 1, 3, 0, 0, -1, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 2, 0, 2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -3, 0, 0, 0, -2, 0, -2, 0, 0, 0, 0, -2, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 1, -1, 0, 1, -2, 0, -1, 2, 0, -2, -2, 0, -1, -1, -2, 0, -1, 1, -2, 0, 1, -2, 1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -2, 0, 0, 1, 1, 3, 0, 0, 3, 0, -3, 0, 1, 0, 0, 3, 0, 0, 0, 0, 3, -2, 0, 1, 0, 0, 1, 0, 0, 1, 1, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -3, 0, 0, 0, -2, 0, -2, 0, 1, 0, 1, -2, -3, 0, -2, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -2, 0, -2, 0, 1, -3, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -2, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, -1, 0, 0, 0, -2, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -1, 0, -2, 0, 0, 0, 1, -1, -1, 0, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 1, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, -1, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -3, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, -2, -1, -3, 0, 0, 0, 0, -2, -2, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, -2, -2, 0, 0, 0, 0, -1, 0, -1, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, 0, -1, -1, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 1, 0, 2, 0, 0, 1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 1, 0, 1, 2, 0, 2, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 2, 0, 4, 0, 0, 0, 0, -1, 0, 2, 2, 0, 0, 0, 0, 0, 0, 4, 0, 0, 2, 1, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 1, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 1, 0, 0, 0, -1, 0, 0, -2, -4, -1, 3, 2, 0, -2, 0, -2, 0, -3, 0, 0, 0, 0, -1, 0, -2, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 4, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, -3, -3, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, -2, 0, 1, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, -1, 0, -1, 0, 0, 1, 0, -2, -2, 0, -4, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, -2, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 1, 0, 0, -2, 0, 0, 0, 0, 0, 1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, 1, 0, 1, 1, 0, 1, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, -2, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, -2, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, 0,
+    0, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, 1, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, -1, 0, 0, 1, 1, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 2, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 2, 0, -2, 1, -1, -1, -1, 0, 0, 0, 0, 0, -2, 0, -2, 1, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -2, 0, 0, -1, 0, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, -1, 0, 0, 0, -1, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, -1, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 2, 0, 0, -1, 2, 0, 0, 0, 0, 4, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 2, 0, 0, 0, 0, 2, 2, 4, 0, 0, 2, 0, 2, 0, 0, 1, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, 3, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 3, 0, 0, 3, 0, 0, 0, 0, 0, -1, 3, -1, 0, -1, 0, 3, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, -1, 0, 1, 1, 0, 0, 0, 0, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, -2, 0, 0, 0, -2, 0, 0, 0, -3, 0, 0, -1, 0, -3, -1, 1, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -3, 0, 0, 0, -2, 0, 0, 0, -3, 0, 0, 0, 0, -3, -3, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, 2, -1, 0, 0, 1, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 2, 0, 0, 0, 0, 1, 2, 3, -1, 0, 2, 0, 2, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, 4, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 3, 0, 0, 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 3, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, -2, 0, 0, 0, 0, 0, -1, 0, -3, 0, 0, 0, 0, -2, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 2, 0, 0, 0, 0, 0, 2, 2, 0, 0, 2, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, -3, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 2, 0, 0, 2, 0, 0, 0, 0, 0, -1, 2, 0, 0, -1, 0, 2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 3, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 1, 3, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -2, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, 2, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, -2, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 1, -1, 0, 2, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 1, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, 1, 0, 1, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 1, 1, 0, 0, -1, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, -1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t bookerly_12_bolditalicGlyphLookup[368] = {
+    0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0001, 0x0002, 0xFFFF, 0xFFFF, 0xFFFF, 0x0003, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0004, 0xFFFF, 0xFFFF,
+    0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, 0x0010, 0x0011, 0x0012, 0x0013, 0x0014,
+    0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, 0x0020, 0x0021, 0x0022, 0x0023, 0x0024,
+    0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, 0x0030, 0x0031, 0x0032, 0x0033, 0x0034,
+    0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, 0x0040, 0x0041, 0x0042, 0x0043, 0x0044,
+    0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051, 0x0052, 0x0053, 0x0054,
+    0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, 0x0060, 0x0061, 0x0062, 0x0063, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x0072, 0x0073,
+    0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, 0x0080, 0x0081, 0x0082, 0x0083,
+    0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F, 0x0090, 0x0091, 0x0092, 0x0093,
+    0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F, 0x00A0, 0x00A1, 0x00A2, 0x00A3,
+    0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF, 0x00B0, 0x00B1, 0x00B2, 0x00B3,
+    0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF, 0x00C0, 0x00C1, 0x00C2, 0x00C3,
+    0x0241, 0x0242, 0x0243, 0x0244, 0x0245, 0x0246, 0x0247, 0x0248, 0x0249, 0x024A, 0x024B, 0x024C, 0x024D, 0x024E, 0x024F, 0x0250,
+    0x0251, 0x0252, 0x0253, 0x0254, 0x0255, 0x0256, 0x0257, 0x0258, 0x0259, 0x025A, 0x025B, 0x025C, 0x025D, 0x025E, 0x025F, 0x0260,
+    0x0261, 0x0262, 0x0263, 0x0264, 0x0265, 0x0266, 0x0267, 0x0268, 0x0269, 0x026A, 0x026B, 0x026C, 0x026D, 0x026E, 0x026F, 0x0270,
+    0x0271, 0xFFFF, 0x0272, 0x0273, 0x0274, 0x0275, 0x0276, 0x0277, 0x0278, 0x0279, 0x027A, 0x027B, 0x027C, 0xFFFF, 0x027D, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x027E, 0x027F, 0xFFFF, 0xFFFF, 0x0280, 0x0281, 0x0282, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x0283, 0xFFFF, 0xFFFF, 0xFFFF, 0x0284, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0285,
+    0x0286, 0x0287, 0x0288, 0x0289, 0x028A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
 };
 
 static const EpdFontData bookerly_12_bolditalic = {
     bookerly_12_bolditalicBitmaps,
     bookerly_12_bolditalicGlyphs,
     bookerly_12_bolditalicIntervals,
-    64,
+    65,
     33,
     27,
     -7,
     true,
     bookerly_12_bolditalicGroups,
-    11,
+    4,
+    bookerly_12_bolditalicKernLeftClasses,
+    bookerly_12_bolditalicKernRightClasses,
+    bookerly_12_bolditalicKernMatrix,
+    108,
+    nullptr,
+    0,
+    0,
+    bookerly_12_bolditalicGlyphLookup,
+    bookerly_12_bolditalicGlyphGroups,
+    false,
+    nullptr,
 };
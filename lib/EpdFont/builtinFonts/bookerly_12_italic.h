@@ -3,1539 +3,1557 @@
  * name: bookerly_12_italic
  * size: 12
  * mode: 2-bit  compressed: true
- * Command used: fontconvert.py bookerly_12_italic 12 ../builtinFonts/source/Bookerly/Bookerly-Italic.ttf --2bit --compress
+ * Command used: fontconvert.py bookerly_12_italic 12 ../builtinFonts/source/Bookerly/Bookerly-Italic.ttf --2bit --compress --frequency-corpus ../../../test/hyphenation_eval/resources/english_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/french_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/german_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/italian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/russian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/spanish_hyphenation_tests.txt
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t bookerly_12_italicBitmaps[24426] = {
-    0x85, 0x58, 0x4D, 0x6C, 0x1C, 0x67, 0x19, 0x7E, 0x67, 0xBE, 0xC4, 0x03, 0x99, 0x26, 0x9F, 0x41,
-    0x0D, 0x6A, 0xEB, 0xD8, 0x93, 0x03, 0x95, 0xAA, 0xE2, 0xDD, 0xE1, 0xD0, 0x83, 0xA5, 0xCE, 0xEE,
-    0x4E, 0x13, 0x10, 0x87, 0x1C, 0x6A, 0xA4, 0x2C, 0x48, 0x48, 0x28, 0x5C, 0x4B, 0x85, 0xDC, 0x43,
-    0x0E, 0x5B, 0x69, 0xEC, 0x1D, 0x9A, 0x43, 0x0F, 0x39, 0x10, 0x21, 0xAE, 0x88, 0x0B, 0x07, 0xE2,
-    0x4A, 0x24, 0x02, 0xA3, 0x2E, 0x62, 0xED, 0xFD, 0x92, 0x1C, 0x7A, 0xC8, 0x21, 0xD3, 0x46, 0xA8,
-    0x07, 0x24, 0x3A, 0x21, 0x2E, 0x45, 0x8A, 0x4A, 0xBE, 0xB6, 0x13, 0x75, 0xEC, 0x8C, 0xF7, 0xE3,
-    0x79, 0xBF, 0xD9, 0xB5, 0x5D, 0xC4, 0xCF, 0x26, 0xDE, 0x9F, 0xEF, 0xF7, 0xFD, 0x79, 0xDE, 0xE7,
-    0x7D, 0xDF, 0xA1, 0x27, 0x45, 0x16, 0x50, 0x29, 0x32, 0x49, 0x89, 0x9B, 0xF9, 0x14, 0x51, 0x2E,
-    0xD2, 0x79, 0x7A, 0x8D, 0xF0, 0x9A, 0x77, 0x4A, 0x4F, 0x1D, 0xA1, 0x63, 0x9E, 0xFF, 0xE6, 0xAD,
-    0xF7, 0x72, 0xBD, 0xB1, 0x14, 0x1D, 0x3F, 0xE1, 0x89, 0x97, 0xE2, 0x98, 0x4E, 0xB8, 0x8A, 0x8E,
-    0x8B, 0x94, 0xE6, 0x45, 0x4C, 0x8B, 0x3E, 0x49, 0x63, 0xAA, 0xA3, 0x7F, 0xBC, 0x70, 0x9E, 0x2E,
-    0x1E, 0x27, 0xBA, 0x7E, 0x8A, 0x48, 0x2F, 0xD2, 0xC9, 0x47, 0xAB, 0xCB, 0x7D, 0x63, 0x72, 0x57,
-    0x5D, 0x24, 0xA1, 0xAE, 0x93, 0x48, 0x35, 0x79, 0x71, 0x8E, 0x63, 0xB1, 0x86, 0xCF, 0xC7, 0x11,
-    0xB4, 0x12, 0x53, 0x68, 0x32, 0xF7, 0xDE, 0x07, 0x4A, 0xFA, 0x32, 0x4E, 0x96, 0x22, 0x47, 0x67,
-    0x24, 0x3E, 0x27, 0xF2, 0x2B, 0x22, 0x6F, 0x8F, 0x48, 0xE0, 0x6F, 0xBE, 0xA2, 0xF8, 0x7A, 0x29,
-    0xC5, 0xA5, 0xBC, 0x75, 0x5C, 0xA6, 0xD5, 0x6B, 0x43, 0xC7, 0x3C, 0xCC, 0x68, 0x54, 0x12, 0x2D,
-    0x11, 0x39, 0x38, 0x45, 0xE2, 0xC0, 0x08, 0x7F, 0x57, 0x68, 0xF2, 0x72, 0xB0, 0x99, 0x1C, 0x13,
-    0x93, 0xA6, 0x41, 0x42, 0x2D, 0x92, 0xAE, 0xF2, 0x53, 0x57, 0x35, 0x1C, 0x4D, 0x91, 0xAB, 0x22,
-    0xC8, 0x12, 0xF9, 0x31, 0xF5, 0xC4, 0x4F, 0x73, 0x88, 0xA6, 0x23, 0xBF, 0x68, 0xAF, 0x4A, 0xF1,
-    0xBE, 0x32, 0x67, 0x32, 0xDD, 0x20, 0xEA, 0xCD, 0x3B, 0x19, 0x49, 0xA1, 0xE6, 0x31, 0x89, 0xE5,
-    0x34, 0xC0, 0x07, 0x05, 0x84, 0x2D, 0x42, 0x89, 0x77, 0x35, 0x15, 0x24, 0x4B, 0x3A, 0x46, 0xF4,
-    0x24, 0x7D, 0xE1, 0x15, 0xB2, 0x6E, 0xED, 0x21, 0xDE, 0x1A, 0x38, 0x9C, 0xEF, 0x84, 0x14, 0xB8,
-    0x81, 0xDC, 0x7B, 0x9A, 0x66, 0xE9, 0x4F, 0x39, 0x9D, 0xA2, 0x4E, 0x4A, 0x2B, 0xD4, 0x4F, 0xE7,
-    0xC6, 0xF4, 0xBA, 0xEE, 0x14, 0xB4, 0xD4, 0x5A, 0xB8, 0x48, 0x91, 0xA7, 0x16, 0xA1, 0x42, 0x29,
-    0x21, 0x96, 0xBC, 0x0C, 0x99, 0x1D, 0x93, 0x52, 0x9B, 0x42, 0x45, 0xDE, 0xD8, 0x8C, 0x89, 0xFA,
-    0x63, 0xB9, 0xC3, 0xE7, 0xF7, 0xF3, 0xFA, 0x9E, 0x63, 0xCD, 0x56, 0xB4, 0xF4, 0xC2, 0x6B, 0xCB,
-    0x44, 0xA7, 0xC9, 0x57, 0x54, 0x92, 0x8C, 0x21, 0x92, 0x9F, 0x52, 0x02, 0x79, 0x69, 0x81, 0xF0,
-    0xA3, 0xFE, 0x1C, 0x90, 0x9B, 0x11, 0x44, 0x69, 0xF0, 0x57, 0xA8, 0x8E, 0x51, 0xFC, 0x82, 0xB1,
-    0x30, 0xD0, 0xB2, 0x16, 0x3B, 0xCD, 0xFF, 0x31, 0x83, 0xFF, 0x58, 0xCA, 0xF3, 0x29, 0xCF, 0x63,
-    0x66, 0x83, 0xDC, 0x9C, 0x7F, 0x35, 0xF9, 0x2B, 0x26, 0x30, 0xDA, 0x9B, 0x1C, 0xAB, 0xF9, 0x94,
-    0x01, 0x4F, 0x0E, 0xF8, 0xEA, 0x1F, 0x59, 0xA1, 0x1A, 0xE2, 0xB2, 0xF3, 0x38, 0xF5, 0x1E, 0x9E,
-    0xD9, 0x7D, 0xFF, 0xAF, 0xF4, 0x73, 0x45, 0xD7, 0xAD, 0x73, 0x74, 0xBD, 0xF5, 0xE4, 0x6A, 0xD7,
-    0x98, 0x4F, 0xBE, 0xFF, 0xE7, 0xB8, 0x3E, 0x1B, 0xA3, 0x29, 0x9B, 0x4A, 0xE8, 0xA6, 0xC8, 0x7A,
-    0x81, 0x87, 0x1F, 0xDD, 0xF3, 0x66, 0x6F, 0xFD, 0x37, 0xD4, 0xEC, 0xAF, 0xCE, 0xC2, 0x7B, 0xB9,
-    0x5D, 0xC6, 0x46, 0xD4, 0x56, 0x52, 0x5E, 0xA1, 0xAD, 0xD8, 0x38, 0x0E, 0xEA, 0xB1, 0x14, 0xFC,
-    0x6D, 0x60, 0x5D, 0x0F, 0xC9, 0x21, 0x9B, 0xFD, 0x56, 0x6F, 0xAC, 0x5F, 0xF0, 0x4E, 0x60, 0xC8,
-    0x1D, 0x1B, 0xEA, 0xD0, 0xA6, 0xAB, 0x61, 0xDF, 0x58, 0xE8, 0x21, 0xC9, 0x5B, 0x19, 0xB5, 0x43,
-    0xA2, 0xB2, 0x22, 0x71, 0x37, 0xA7, 0x00, 0x1A, 0x54, 0x2D, 0x12, 0x59, 0x41, 0xA1, 0xC8, 0x1D,
-    0x2D, 0xB3, 0x30, 0x0E, 0x4C, 0x41, 0xC1, 0x78, 0xDF, 0xAF, 0xCE, 0xD0, 0x35, 0xAA, 0x33, 0x31,
-    0x73, 0x40, 0x38, 0xAA, 0x8D, 0xF5, 0xB8, 0xC8, 0x53, 0x84, 0xF3, 0x52, 0x3B, 0x3A, 0x37, 0xF6,
-    0xB1, 0x0B, 0x6E, 0xA6, 0x51, 0x41, 0xA3, 0x51, 0x16, 0xA4, 0x7D, 0x91, 0x09, 0xFD, 0x14, 0x2E,
-    0x27, 0x01, 0xB1, 0x00, 0xE7, 0x30, 0x26, 0x3F, 0x23, 0x17, 0xAB, 0x36, 0x89, 0x87, 0x83, 0xD4,
-    0xFE, 0xDE, 0xE9, 0x2E, 0x8F, 0x8C, 0x39, 0x87, 0x48, 0x21, 0x5A, 0x06, 0x68, 0x35, 0xB6, 0xAB,
-    0x20, 0x5E, 0x75, 0x95, 0xC8, 0x8E, 0xC0, 0xA7, 0x7C, 0x83, 0x97, 0x93, 0x57, 0x90, 0x67, 0x32,
-    0x7A, 0x76, 0x04, 0x81, 0x70, 0x44, 0x10, 0xB3, 0x20, 0xB4, 0x05, 0x58, 0xA8, 0x57, 0x4D, 0x2E,
-    0x4C, 0x3E, 0x15, 0x37, 0xB6, 0x27, 0x3B, 0x88, 0x9B, 0x00, 0x0B, 0x3E, 0x87, 0xFD, 0x2F, 0xC0,
-    0x66, 0x70, 0xD5, 0xD9, 0x8C, 0x0A, 0x89, 0xD3, 0x12, 0x2A, 0xDD, 0x5C, 0xA6, 0x32, 0xC5, 0xB5,
-    0x9F, 0x18, 0x03, 0xB0, 0x01, 0x45, 0xEC, 0x68, 0xB6, 0x2C, 0x9B, 0x15, 0x2F, 0xCF, 0x54, 0x34,
-    0x32, 0x0A, 0x2A, 0x03, 0x1A, 0x3C, 0x27, 0x30, 0x07, 0x1B, 0x38, 0x2B, 0xF8, 0x19, 0xA6, 0x56,
-    0x1F, 0xDE, 0x35, 0xB4, 0xE2, 0x09, 0xC0, 0xA7, 0xA2, 0xB7, 0x0C, 0xF9, 0xE3, 0xF8, 0x40, 0x0C,
-    0xC7, 0x28, 0xEA, 0x6F, 0x93, 0x5F, 0x58, 0x31, 0xA1, 0x2A, 0xAD, 0xE1, 0x9C, 0xDD, 0x5F, 0xC3,
-    0x2D, 0x25, 0x95, 0x33, 0x25, 0xDB, 0x27, 0xC0, 0x29, 0x09, 0x85, 0xB8, 0x64, 0xE8, 0x65, 0xE0,
-    0x20, 0xD5, 0xA1, 0xE0, 0x81, 0x3E, 0x6C, 0x7D, 0xCF, 0x98, 0xFB, 0xC6, 0x94, 0x58, 0xD0, 0xA3,
-    0xE4, 0x14, 0xDB, 0x03, 0x80, 0x68, 0x43, 0x08, 0xE8, 0x47, 0xEC, 0x13, 0xA9, 0x58, 0x12, 0xD8,
-    0x18, 0x52, 0x20, 0x18, 0x58, 0xA4, 0xA6, 0x65, 0x00, 0xAA, 0xED, 0x99, 0xD3, 0xD6, 0x8A, 0x0A,
-    0x29, 0xC1, 0x75, 0xAA, 0x85, 0x8F, 0x5C, 0xC6, 0xE1, 0x9B, 0xA0, 0x0F, 0xC0, 0x78, 0x4C, 0xDE,
-    0xFD, 0xD2, 0xD1, 0x7E, 0xD6, 0xA2, 0x8E, 0xAF, 0x18, 0x1D, 0x6D, 0x9F, 0x65, 0x78, 0xA8, 0x2D,
-    0xBB, 0x4C, 0x8E, 0xA0, 0x7E, 0x45, 0xDE, 0x6E, 0x45, 0x6B, 0x4E, 0x29, 0x72, 0x57, 0xCB, 0xF8,
-    0x40, 0xE4, 0x1C, 0xA7, 0x6D, 0x5F, 0x88, 0x25, 0xAC, 0x35, 0xF3, 0x56, 0x66, 0xBD, 0xCA, 0x52,
-    0xE0, 0xC3, 0xD7, 0xF4, 0xB5, 0x31, 0x71, 0x24, 0x93, 0x35, 0xC9, 0x32, 0xAB, 0xA6, 0x0F, 0xC8,
-    0xC2, 0xCD, 0x03, 0xB5, 0xCA, 0x53, 0x47, 0xA1, 0x80, 0x60, 0x4E, 0xF9, 0xC2, 0xAB, 0x8D, 0x51,
-    0xA0, 0xB9, 0x00, 0xB0, 0x13, 0x06, 0xF7, 0xE4, 0x75, 0x91, 0xBC, 0x92, 0xFA, 0x19, 0x88, 0x11,
-    0x44, 0x02, 0x6B, 0x06, 0x39, 0x39, 0x63, 0xCB, 0x3C, 0xB0, 0x3F, 0x7D, 0x1D, 0x2B, 0x9E, 0x5F,
-    0xBF, 0x6A, 0xCC, 0xF4, 0x1E, 0xC7, 0x98, 0x4F, 0xD7, 0xD7, 0x39, 0xD6, 0x5E, 0x80, 0x16, 0x31,
-    0x05, 0x85, 0x25, 0x45, 0xDE, 0x55, 0xD9, 0x93, 0x52, 0xBF, 0xE4, 0x93, 0x9E, 0xB3, 0xAB, 0xFD,
-    0xBC, 0x53, 0xB5, 0xB7, 0x66, 0x01, 0x11, 0xC4, 0x57, 0xE2, 0x68, 0x4F, 0x81, 0xF3, 0x68, 0x2D,
-    0xEE, 0xC4, 0x47, 0x30, 0xFB, 0x1C, 0x0C, 0x5B, 0x31, 0xBE, 0xA7, 0x6C, 0xC7, 0xAA, 0x05, 0x8C,
-    0x5A, 0xB1, 0x43, 0x9E, 0xB6, 0xBE, 0xCD, 0x3C, 0xD8, 0xC0, 0x83, 0x95, 0xB7, 0x9E, 0x93, 0x6E,
-    0x26, 0x4D, 0xD6, 0x90, 0x54, 0x04, 0xB4, 0xB1, 0xE1, 0xA5, 0x91, 0xB8, 0xA5, 0x22, 0x27, 0x93,
-    0x92, 0xB4, 0x4F, 0xBD, 0x1E, 0x0F, 0xDC, 0xC8, 0x9B, 0x60, 0x00, 0x2F, 0x4D, 0x5E, 0xBC, 0xA9,
-    0x17, 0x1C, 0x73, 0x67, 0x8C, 0x04, 0x54, 0x06, 0x57, 0x6A, 0x53, 0xB8, 0x56, 0x07, 0x36, 0x26,
-    0xE0, 0xB5, 0xF3, 0xD2, 0x0A, 0x46, 0x6C, 0x84, 0xD0, 0x8F, 0x27, 0x24, 0xCF, 0xB4, 0xC3, 0x08,
-    0xA4, 0x0E, 0x8C, 0x28, 0x18, 0x2F, 0xF3, 0xA0, 0x03, 0xFA, 0x04, 0x3B, 0xBC, 0xB3, 0x18, 0x8F,
-    0x00, 0x0D, 0x17, 0x8E, 0x85, 0x36, 0x18, 0xDF, 0xF9, 0x9E, 0x66, 0x24, 0x29, 0x6A, 0x75, 0x57,
-    0x62, 0x18, 0xB6, 0xC5, 0x74, 0x51, 0x62, 0x46, 0x68, 0x7F, 0x9B, 0x82, 0x6D, 0xA3, 0x05, 0xAC,
-    0x36, 0x73, 0x95, 0x4D, 0x96, 0x3B, 0xBF, 0x3A, 0x53, 0x02, 0x5C, 0x43, 0x60, 0x2C, 0x01, 0x96,
-    0x38, 0x81, 0x94, 0xC8, 0x1B, 0x9A, 0xFA, 0xD0, 0x79, 0x6B, 0x94, 0x23, 0x7E, 0x0A, 0x48, 0x59,
-    0x72, 0x76, 0x01, 0x0C, 0x10, 0x4D, 0x4E, 0x01, 0x74, 0xE5, 0x73, 0xBB, 0xA3, 0xB4, 0x6F, 0x26,
-    0xC0, 0x71, 0x5E, 0x89, 0x11, 0x41, 0x99, 0xFC, 0x70, 0x94, 0x56, 0xD4, 0x00, 0x48, 0xAF, 0x27,
-    0xE4, 0x5E, 0xCA, 0x2D, 0x6A, 0x19, 0xA3, 0x4C, 0x0A, 0x08, 0x1D, 0x86, 0x32, 0x07, 0x13, 0xEB,
-    0x8B, 0x28, 0x7F, 0x42, 0x16, 0x33, 0x1A, 0xD9, 0x94, 0x7C, 0xC4, 0xBA, 0x7D, 0x1D, 0xBD, 0x1A,
-    0x93, 0x60, 0xD5, 0x9F, 0x2E, 0x2E, 0x80, 0x02, 0x14, 0x4C, 0x1D, 0xF2, 0xCA, 0x01, 0xE3, 0x26,
-    0xC3, 0x77, 0x28, 0x92, 0xE0, 0x9F, 0xAB, 0x71, 0x84, 0xAF, 0x24, 0xA7, 0x8E, 0x16, 0x87, 0x32,
-    0xFF, 0x02, 0x43, 0xAD, 0x62, 0x09, 0xEE, 0x2A, 0x11, 0x83, 0x90, 0x2F, 0x83, 0x7E, 0xDB, 0x53,
-    0x17, 0x76, 0xBB, 0x5D, 0xEA, 0xC0, 0x28, 0xCE, 0xEE, 0xBA, 0xC6, 0x09, 0x4B, 0x58, 0xF9, 0x04,
-    0xD3, 0x3A, 0xB3, 0x9B, 0x25, 0x5C, 0x5A, 0x03, 0x78, 0x42, 0xDC, 0x2D, 0x0F, 0x0F, 0x26, 0xC8,
-    0x63, 0x7C, 0xAD, 0x4C, 0xBD, 0x74, 0xCE, 0x98, 0x2C, 0xB0, 0x80, 0xEB, 0x76, 0xCF, 0x13, 0xAA,
-    0x00, 0x0A, 0xD6, 0x87, 0x50, 0x91, 0xCF, 0x7A, 0xC1, 0x72, 0x4A, 0x6B, 0xF2, 0xB7, 0xB6, 0xCE,
-    0xF6, 0x88, 0x39, 0x42, 0xAD, 0x87, 0xB1, 0x85, 0xA9, 0x85, 0xF5, 0x66, 0x53, 0xCC, 0x21, 0xC5,
-    0xF5, 0xCD, 0xC4, 0x6E, 0x21, 0xCE, 0x19, 0xFF, 0xA0, 0x82, 0xF7, 0x23, 0x18, 0x6E, 0x09, 0x16,
-    0xFB, 0x66, 0xDB, 0x5E, 0x6C, 0x2D, 0x67, 0x8F, 0x00, 0x6E, 0xF7, 0x4A, 0x9A, 0x01, 0x8B, 0x13,
-    0xC2, 0xD6, 0xD1, 0x7D, 0x44, 0x54, 0x47, 0x21, 0x1C, 0x21, 0x90, 0x63, 0x26, 0xF4, 0xD1, 0x3D,
-    0xEF, 0x74, 0x11, 0x9C, 0x71, 0x7F, 0x8F, 0x29, 0x71, 0x93, 0x2F, 0x04, 0x64, 0x98, 0xFC, 0x39,
-    0x55, 0x00, 0x20, 0x2D, 0x9B, 0x8C, 0x32, 0xF6, 0x49, 0x9F, 0xB5, 0xF0, 0x0D, 0x6F, 0x2D, 0x79,
-    0x08, 0xB3, 0x89, 0xCD, 0x75, 0x8A, 0x67, 0x07, 0x2C, 0x28, 0x86, 0xDA, 0x2C, 0xFC, 0x1C, 0x22,
-    0xE7, 0x0A, 0xC8, 0x38, 0x34, 0x7C, 0x05, 0xA8, 0xD7, 0x29, 0x39, 0x17, 0x84, 0xBC, 0x6C, 0xBA,
-    0x93, 0x97, 0xA7, 0xF5, 0xF9, 0xDE, 0xE4, 0xCA, 0xB9, 0xD2, 0xE1, 0x14, 0x81, 0x2D, 0x44, 0x8C,
-    0x12, 0x88, 0xC4, 0x6B, 0x2D, 0x20, 0xB0, 0xE0, 0x0B, 0xD6, 0x3A, 0xAC, 0xEA, 0x7F, 0xB0, 0x16,
-    0xB3, 0xB4, 0xA7, 0xEC, 0xF6, 0xF6, 0x96, 0x25, 0x66, 0x3A, 0xC6, 0x71, 0xD1, 0x5D, 0x3E, 0x09,
-    0x2F, 0x14, 0x1D, 0xB8, 0x21, 0x95, 0xAC, 0x16, 0x13, 0x25, 0xA7, 0x8B, 0x26, 0x47, 0x66, 0x8B,
-    0x6F, 0x69, 0x0D, 0xA7, 0xA5, 0xC4, 0x88, 0xDF, 0x76, 0xF8, 0xF4, 0x82, 0xC7, 0x74, 0x87, 0xEF,
-    0x80, 0x50, 0xAE, 0xF6, 0x11, 0xD4, 0xB9, 0x28, 0xD9, 0x29, 0x06, 0xE5, 0x07, 0x75, 0xD4, 0xD4,
-    0x9E, 0xC4, 0x89, 0x06, 0xEA, 0xDA, 0xDB, 0xF9, 0xB8, 0x41, 0x0D, 0x0C, 0xD6, 0x23, 0xA9, 0xE5,
-    0x63, 0xAC, 0xB4, 0x6A, 0x91, 0xB1, 0x28, 0x0B, 0xC9, 0x87, 0x16, 0x09, 0x80, 0xF2, 0x2E, 0x72,
-    0x0D, 0xF0, 0x7C, 0x9E, 0x9C, 0x2E, 0x62, 0xD1, 0xA6, 0x87, 0x30, 0x23, 0x40, 0x42, 0x22, 0x63,
-    0x82, 0xC1, 0xFF, 0x49, 0x2D, 0x54, 0x22, 0x0F, 0xD2, 0x06, 0xA4, 0xF9, 0x83, 0x96, 0x30, 0x47,
-    0x94, 0xF8, 0x80, 0xE3, 0x82, 0x14, 0x6F, 0xA0, 0x16, 0x39, 0x7B, 0x57, 0x71, 0x61, 0xB3, 0x93,
-    0xB3, 0x51, 0x9B, 0xA0, 0x61, 0x1A, 0x78, 0x08, 0x3B, 0xDC, 0x55, 0xE1, 0x2E, 0x89, 0x4F, 0x64,
-    0xE4, 0xF4, 0x18, 0x94, 0xF6, 0x38, 0x3F, 0x6E, 0x4B, 0xC3, 0x24, 0x05, 0xA1, 0x71, 0x5F, 0xDC,
-    0x01, 0x28, 0x72, 0xB7, 0x64, 0x74, 0xF7, 0xB9, 0x60, 0x00, 0x63, 0x62, 0xCF, 0x10, 0x5B, 0xC4,
-    0x9D, 0x14, 0xD5, 0xC4, 0xA7, 0x9A, 0xEB, 0xC1, 0x16, 0x8E, 0x6B, 0xF8, 0x8A, 0x4F, 0x2B, 0x30,
-    0xA3, 0xDA, 0x0B, 0xB0, 0x88, 0x77, 0x1B, 0x33, 0xF4, 0x58, 0xA1, 0xFC, 0x08, 0x78, 0x46, 0x54,
-    0x04, 0xCA, 0x58, 0xE3, 0xE2, 0x42, 0xEE, 0x67, 0xBB, 0x57, 0x38, 0x51, 0xA1, 0x44, 0xF8, 0x70,
-    0x45, 0x49, 0xE5, 0x94, 0x40, 0x6D, 0x07, 0xCA, 0x7B, 0x28, 0x30, 0xE8, 0x91, 0xAE, 0x8D, 0x2E,
-    0xC1, 0x90, 0xDE, 0x1D, 0x98, 0xF7, 0x33, 0x0C, 0x96, 0x30, 0x61, 0x02, 0x83, 0xB7, 0x3D, 0x0E,
-    0xE1, 0x3D, 0x08, 0x25, 0x77, 0x21, 0xEB, 0x68, 0x87, 0xA6, 0x51, 0x7F, 0x98, 0x89, 0x90, 0x6E,
-    0xA0, 0x5E, 0x13, 0x7F, 0x48, 0x60, 0x90, 0x19, 0xF6, 0x44, 0x6C, 0x6C, 0x5E, 0x4B, 0xC9, 0xEC,
-    0xFC, 0xBF, 0x68, 0xA2, 0x5A, 0x32, 0x2B, 0x1A, 0xB1, 0x6C, 0x9C, 0x30, 0x3B, 0xEC, 0x1A, 0x0F,
-    0xE1, 0x82, 0x5A, 0xC2, 0xB1, 0x35, 0x16, 0x0B, 0x18, 0xB7, 0xD9, 0x65, 0x92, 0x11, 0xC0, 0x87,
-    0x94, 0x8C, 0x3E, 0xBE, 0x1A, 0x28, 0x82, 0x98, 0x90, 0x96, 0xE5, 0x84, 0xA0, 0x1C, 0x5D, 0x96,
-    0xE6, 0x7C, 0x4B, 0xD5, 0x61, 0x66, 0x53, 0xCD, 0x15, 0x7B, 0xD3, 0x18, 0xB8, 0xF0, 0x2D, 0x51,
-    0x1F, 0x8D, 0x59, 0x0B, 0x62, 0x42, 0x7C, 0xBA, 0x40, 0x9D, 0xCF, 0x22, 0x33, 0xA1, 0xFA, 0x69,
-    0x00, 0xC8, 0xE0, 0x16, 0x8D, 0xD0, 0x4A, 0x82, 0xCC, 0x66, 0x12, 0xF9, 0x10, 0x2C, 0xF7, 0x1E,
-    0x24, 0xD1, 0xF0, 0x6E, 0x82, 0x89, 0x26, 0xD7, 0xB5, 0x69, 0x90, 0xCE, 0xED, 0xB8, 0x55, 0x60,
-    0xD2, 0xA0, 0x46, 0xE0, 0xCC, 0x2F, 0xB8, 0x5D, 0x08, 0xBF, 0x8D, 0xA4, 0x02, 0x3F, 0xF9, 0xAE,
-    0x76, 0x62, 0xD4, 0x52, 0x32, 0xB7, 0x69, 0x0D, 0x45, 0x39, 0x32, 0x1A, 0x18, 0xFD, 0x34, 0xAD,
-    0xCE, 0x93, 0x3C, 0x17, 0x7B, 0x37, 0xA1, 0xC7, 0xE8, 0x2D, 0xED, 0xD5, 0x5C, 0x7A, 0xB2, 0xDB,
-    0xFD, 0x2E, 0x20, 0xF8, 0x60, 0x7D, 0x7C, 0x0D, 0xC5, 0xC0, 0x22, 0x6A, 0x8F, 0xDF, 0xC5, 0x43,
-    0x97, 0xB3, 0x81, 0x75, 0x64, 0x54, 0x9B, 0x90, 0x73, 0x4A, 0xFB, 0xA0, 0x16, 0x9A, 0xB0, 0x35,
-    0x0C, 0xEA, 0x80, 0x94, 0x08, 0xE1, 0xD5, 0xFD, 0xBE, 0x51, 0xC1, 0x78, 0x2E, 0x03, 0x04, 0x06,
-    0xB5, 0x22, 0x91, 0xAD, 0xB8, 0xB1, 0xB2, 0xC7, 0x14, 0x1C, 0x03, 0xB8, 0x9A, 0x69, 0xC0, 0x46,
-    0xBF, 0xC7, 0x25, 0x33, 0xE8, 0x20, 0xC3, 0xB9, 0x11, 0xBE, 0xC8, 0x54, 0x68, 0x36, 0x04, 0x1F,
-    0x06, 0x5A, 0xAA, 0x5F, 0x27, 0xBB, 0x88, 0x5C, 0x53, 0xFA, 0x46, 0x6D, 0x01, 0xBC, 0x88, 0x57,
-    0xC9, 0x41, 0x35, 0xE0, 0xC5, 0x0A, 0xC2, 0x34, 0x59, 0x04, 0x94, 0x58, 0x8C, 0x79, 0x4F, 0x71,
-    0x45, 0xC8, 0x21, 0xD7, 0x62, 0xD1, 0x0A, 0x76, 0xFA, 0xFB, 0x88, 0x38, 0x9F, 0x43, 0x38, 0x60,
-    0xBB, 0x77, 0x68, 0xC2, 0x19, 0xF5, 0xD1, 0x20, 0x1B, 0xA7, 0x7B, 0xCE, 0xA8, 0x05, 0x94, 0x31,
-    0x41, 0xC6, 0xB0, 0x81, 0x65, 0x01, 0xB7, 0x58, 0xA6, 0xBE, 0xE6, 0xEC, 0x85, 0x10, 0x47, 0x36,
-    0x4C, 0x9B, 0x5A, 0x70, 0xA7, 0x73, 0x07, 0xE5, 0xBE, 0xAF, 0x36, 0x50, 0x28, 0xD2, 0x50, 0xCA,
-    0x33, 0x19, 0x79, 0x37, 0x33, 0xC4, 0x02, 0x25, 0x91, 0xFF, 0x26, 0x6E, 0xBF, 0x1D, 0x0F, 0x70,
-    0x63, 0xA4, 0xBD, 0x5F, 0xC2, 0x3C, 0x1F, 0xA3, 0xF6, 0xC4, 0x7D, 0x0A, 0x95, 0x04, 0xD7, 0x87,
-    0x1D, 0x7B, 0xB9, 0xC8, 0x0F, 0xAA, 0x98, 0x93, 0xE7, 0x11, 0xED, 0xA6, 0x0C, 0xF7, 0x50, 0x32,
-    0x22, 0x65, 0x49, 0xC6, 0x96, 0x97, 0x71, 0x35, 0x99, 0x4F, 0x73, 0x35, 0x47, 0xFE, 0x44, 0xE6,
-    0xBE, 0x85, 0x11, 0x67, 0xF3, 0xDB, 0x6A, 0xAA, 0x23, 0x03, 0x9A, 0x73, 0x2D, 0x9C, 0x84, 0xB4,
-    0xB2, 0x8D, 0x7A, 0xCA, 0x54, 0x48, 0x8D, 0x27, 0x41, 0xEC, 0x81, 0x39, 0x63, 0xDE, 0x65, 0x62,
-    0x07, 0xC3, 0xA4, 0x28, 0x3D, 0x50, 0x8C, 0x43, 0x83, 0x00, 0xDB, 0xC4, 0xDF, 0x20, 0xC3, 0x90,
-    0xA9, 0x88, 0xAD, 0x53, 0x4C, 0xA8, 0x94, 0x9D, 0xCA, 0x7E, 0x66, 0xAF, 0xDA, 0x58, 0x19, 0x03,
-    0x2B, 0xB6, 0x54, 0x42, 0xEA, 0x42, 0xB0, 0x55, 0xEE, 0xEE, 0x7A, 0x25, 0x14, 0xB0, 0xAF, 0xBC,
-    0xCC, 0xB1, 0x4B, 0x0F, 0xE5, 0x66, 0x86, 0x05, 0x6A, 0x6E, 0xA4, 0x53, 0x4B, 0xCA, 0xB0, 0xE3,
-    0x75, 0xC4, 0x91, 0x0E, 0x21, 0x19, 0x32, 0x47, 0xC6, 0x69, 0xD4, 0xAA, 0xFC, 0xCC, 0x15, 0x77,
-    0x8F, 0x59, 0x45, 0x81, 0x33, 0xFC, 0xD8, 0x12, 0x13, 0xDA, 0x99, 0x06, 0x0F, 0xFC, 0xB7, 0x51,
-    0x74, 0x37, 0x5B, 0x31, 0x42, 0x29, 0xE2, 0x8E, 0x78, 0xDA, 0x5F, 0x2D, 0xF1, 0x5C, 0x83, 0xEC,
-    0xD2, 0xBA, 0xF3, 0x6A, 0xF0, 0x16, 0x39, 0x69, 0xC7, 0x22, 0xDB, 0x24, 0xD5, 0xB7, 0xB9, 0xFF,
-    0xF3, 0x68, 0xB8, 0x93, 0xFE, 0x6D, 0xF4, 0xD5, 0x94, 0x03, 0x37, 0xE1, 0x78, 0x86, 0xF3, 0xDD,
-    0x0F, 0x48, 0xBC, 0x93, 0x7A, 0x97, 0x14, 0x4A, 0xB6, 0x80, 0xD0, 0xFF, 0xC2, 0xDD, 0xBD, 0x01,
-    0x45, 0xB3, 0x74, 0x04, 0xD1, 0xC2, 0xCA, 0xD1, 0x71, 0x5F, 0xA1, 0x7B, 0xAA, 0xAB, 0xCA, 0xB9,
-    0x7B, 0xC8, 0x7B, 0x3A, 0x38, 0x83, 0x76, 0xB5, 0x85, 0x26, 0x02, 0xC6, 0xBA, 0x91, 0xBB, 0xF9,
-    0x86, 0x53, 0x80, 0x87, 0x65, 0x3C, 0xF2, 0xF4, 0xEF, 0xEF, 0x8C, 0x0A, 0x23, 0xB5, 0x75, 0x29,
-    0xEA, 0x45, 0x17, 0x34, 0xF4, 0xAA, 0xB2, 0x16, 0x1F, 0xD8, 0xC4, 0x00, 0x15, 0xBC, 0x9B, 0xA5,
-    0x7B, 0xD7, 0xC4, 0x6F, 0xDF, 0xCA, 0xDB, 0x6A, 0x28, 0x55, 0xE8, 0x65, 0xFE, 0x1B, 0x9A, 0x5B,
-    0x30, 0x8D, 0x10, 0x09, 0xA8, 0xE5, 0xA7, 0x6D, 0x31, 0xDE, 0x72, 0x1E, 0xEF, 0xED, 0x37, 0x01,
-    0x95, 0x6B, 0xB2, 0xC1, 0x53, 0x0B, 0x2C, 0x3F, 0x33, 0x08, 0xB7, 0xE0, 0x5C, 0x4A, 0x9C, 0x53,
-    0xBD, 0xBE, 0x71, 0x4D, 0x4D, 0xC3, 0x0E, 0xF0, 0x59, 0xD9, 0xCB, 0x58, 0x37, 0xAE, 0x63, 0x0A,
-    0xBE, 0xCD, 0xDD, 0xD1, 0x5C, 0x10, 0xAC, 0xA2, 0xB2, 0x47, 0x11, 0x97, 0x73, 0x2F, 0x8F, 0xF2,
-    0xD3, 0x4F, 0x21, 0xB2, 0x8C, 0x3B, 0x54, 0xF8, 0xFA, 0xE5, 0x9B, 0x77, 0x22, 0xC8, 0x2C, 0x2A,
-    0xA9, 0xA6, 0x85, 0xF3, 0x88, 0x9A, 0x23, 0x37, 0x4B, 0x16, 0x1C, 0xAD, 0xE5, 0x77, 0xDE, 0x28,
-    0x9A, 0x23, 0x32, 0x57, 0x6C, 0x6A, 0x3F, 0xD2, 0x41, 0xAD, 0x61, 0xE2, 0xD1, 0x21, 0x94, 0xDB,
-    0xE7, 0x14, 0xCE, 0x63, 0x8E, 0x8B, 0x2F, 0xD5, 0xBD, 0xAA, 0x0D, 0x3F, 0x7E, 0x28, 0xC1, 0x55,
-    0x9C, 0xE0, 0x50, 0xB7, 0xC5, 0x13, 0xB7, 0xA6, 0xB6, 0xBF, 0xE2, 0xEC, 0xEE, 0x1F, 0x5E, 0xC7,
-    0xD6, 0xB1, 0x54, 0xC3, 0x64, 0x64, 0xB3, 0xE7, 0xFE, 0x3A, 0x2E, 0x63, 0x6F, 0x70, 0x4F, 0x81,
-    0x53, 0x9C, 0x83, 0xB6, 0x28, 0x1C, 0x83, 0x80, 0xD0, 0xC3, 0x24, 0xB8, 0xAF, 0xE5, 0xB0, 0x7F,
-    0x19, 0x24, 0xB8, 0x01, 0x7E, 0xA0, 0x60, 0xAF, 0x6E, 0x12, 0x2D, 0x46, 0x18, 0xFB, 0x21, 0x6A,
-    0xBE, 0xAD, 0x91, 0x72, 0x0A, 0xB4, 0x09, 0xE8, 0x56, 0x63, 0x6E, 0x78, 0x65, 0x86, 0x90, 0xE4,
-    0xC2, 0x72, 0x86, 0x9B, 0x36, 0x14, 0xF6, 0xA1, 0xAE, 0x8D, 0x17, 0x4C, 0xD2, 0xFA, 0xE4, 0xC1,
-    0x4A, 0x2F, 0xC8, 0xDC, 0xF7, 0x4C, 0x2A, 0x9B, 0xC8, 0x41, 0xD9, 0xC0, 0xD9, 0x13, 0x99, 0xAF,
-    0xA5, 0x65, 0xF2, 0x92, 0xAD, 0x29, 0x63, 0x74, 0x09, 0xB3, 0x03, 0xFA, 0xEC, 0x16, 0xDA, 0x12,
-    0x49, 0x53, 0x13, 0xBA, 0x9A, 0xFB, 0x1B, 0xDB, 0x56, 0xE8, 0xBE, 0xE2, 0x67, 0x4B, 0xE8, 0xBB,
-    0x12, 0xA6, 0xB0, 0xE8, 0x2B, 0x9F, 0xDD, 0xAE, 0xB8, 0xF6, 0xB1, 0x2F, 0x51, 0x97, 0x13, 0xC9,
-    0x21, 0x73, 0xA2, 0x75, 0xE2, 0xA7, 0x3F, 0x81, 0xAD, 0x1F, 0xD8, 0x20, 0x85, 0x35, 0x5D, 0x60,
-    0x6D, 0xC6, 0x86, 0xD4, 0x76, 0x7D, 0xD3, 0xDA, 0x06, 0x4B, 0x30, 0xF4, 0x77, 0xD4, 0xE6, 0xDA,
-    0xB6, 0x98, 0x50, 0x04, 0xE5, 0xC4, 0x33, 0x05, 0xAF, 0xE2, 0xA7, 0x1A, 0x39, 0x4F, 0x8B, 0x9B,
-    0xA5, 0xF8, 0x60, 0xD3, 0x2B, 0x1A, 0xE8, 0xF4, 0x64, 0x3A, 0x90, 0x9E, 0x0E, 0x46, 0x71, 0x58,
-    0x52, 0x0B, 0xC9, 0xB4, 0x0D, 0xC4, 0xA5, 0x3D, 0x7F, 0x67, 0xC3, 0xB1, 0x68, 0x5B, 0xEE, 0xDF,
-    0xB8, 0x56, 0x0B, 0x1B, 0xA1, 0x31, 0x4C, 0x11, 0x0D, 0xCC, 0xEC, 0x03, 0xFB, 0x78, 0xEC, 0xAB,
-    0x1F, 0xFD, 0xAC, 0x0A, 0xA7, 0x82, 0xCF, 0xE5, 0x61, 0xBC, 0xE5, 0x57, 0x1D, 0x0D, 0x6A, 0x6D,
-    0x25, 0x8F, 0xB4, 0x3F, 0x5C, 0xD0, 0x91, 0xA8, 0x7C, 0xA4, 0x95, 0x3D, 0x51, 0x00, 0xC1, 0x54,
-    0xF1, 0x83, 0xB5, 0x16, 0xD2, 0x1C, 0x12, 0x5E, 0x0F, 0x56, 0x8B, 0x1B, 0xB3, 0xE0, 0x16, 0xF9,
-    0x93, 0x04, 0xE9, 0x61, 0xDC, 0x84, 0xBF, 0xF6, 0xE1, 0x8D, 0x3A, 0xD6, 0xCF, 0x47, 0xB7, 0x0C,
-    0xF5, 0x8A, 0xC2, 0x1F, 0x4A, 0x32, 0xFC, 0x1C, 0xA2, 0xC9, 0x0F, 0xE5, 0x02, 0x86, 0x2C, 0x77,
-    0x54, 0x83, 0xB3, 0x4A, 0xFE, 0x30, 0x21, 0x73, 0x39, 0x95, 0xFB, 0xD0, 0x5B, 0xC9, 0x5D, 0x83,
-    0x52, 0x23, 0x81, 0x63, 0x5A, 0xD4, 0x46, 0x9B, 0x32, 0xA0, 0x16, 0x68, 0xA4, 0xA0, 0x01, 0x5A,
-    0x93, 0xA1, 0xC8, 0xFB, 0xD7, 0xD2, 0x60, 0xFF, 0x0E, 0x67, 0xCB, 0xD3, 0xEE, 0x38, 0xAC, 0x68,
-    0xA1, 0x37, 0xA4, 0x26, 0x77, 0xBC, 0x69, 0x04, 0xDE, 0x8D, 0x6C, 0x49, 0x91, 0xC0, 0xE1, 0x03,
-    0x26, 0x5A, 0xEE, 0x39, 0x3D, 0xE5, 0x98, 0x11, 0xB9, 0x0F, 0x4B, 0xFB, 0x64, 0x85, 0x61, 0x60,
-    0xCB, 0x4D, 0x28, 0x0E, 0x22, 0xA7, 0xE7, 0xAF, 0xD6, 0xE7, 0x05, 0x96, 0x07, 0x42, 0x74, 0x6C,
-    0xE0, 0x81, 0x98, 0x79, 0xE0, 0x66, 0xEE, 0x66, 0xC5, 0x94, 0x07, 0x84, 0x7E, 0x3B, 0x1D, 0x3D,
-    0xCA, 0xA4, 0xDE, 0xB0, 0xCE, 0x93, 0xD6, 0x99, 0x5C, 0x7F, 0x83, 0x70, 0x6C, 0x47, 0xBA, 0xE5,
-    0xDF, 0xAE, 0x46, 0xCE, 0x47, 0xFF, 0xF0, 0x06, 0xD4, 0x54, 0x30, 0x05, 0x80, 0x00, 0x7E, 0x1D,
-    0xDA, 0x02, 0x9A, 0xA6, 0xFC, 0x06, 0xCB, 0xEC, 0xB9, 0x26, 0xEF, 0x7D, 0x59, 0xDA, 0xA9, 0x82,
-    0x33, 0x1C, 0xFA, 0xBD, 0xEA, 0xB4, 0x77, 0x3B, 0xDD, 0x18, 0xFD, 0x76, 0x1A, 0xF9, 0xFC, 0x3C,
-    0x69, 0x03, 0xDB, 0x8E, 0x99, 0xFB, 0x66, 0xCF, 0x76, 0x77, 0x96, 0x27, 0xBC, 0xC9, 0x13, 0x2A,
-    0xFD, 0x94, 0xF4, 0x53, 0xA3, 0x6D, 0xB5, 0x12, 0x2A, 0xEF, 0x72, 0xC5, 0x4E, 0x95, 0xDC, 0xE2,
-    0xFA, 0xA8, 0xFD, 0x0A, 0x51, 0x13, 0x83, 0xAF, 0x5A, 0x68, 0xF0, 0xB3, 0x17, 0xD3, 0x96, 0x7C,
-    0xFD, 0xAE, 0x79, 0xA7, 0x0A, 0xF2, 0xF6, 0x14, 0x90, 0x99, 0xBC, 0x5D, 0x01, 0xD0, 0xFC, 0x0C,
-    0x01, 0xDD, 0xA4, 0x97, 0x36, 0x39, 0xDD, 0x68, 0xD2, 0xE8, 0x4F, 0x7A, 0x24, 0x23, 0x2E, 0x09,
-    0x39, 0x4F, 0x2C, 0x1E, 0x60, 0x78, 0x13, 0x99, 0xFF, 0x2F, 0x15, 0xDA, 0x91, 0xB4, 0xF0, 0x55,
-    0x5B, 0xA0, 0x0A, 0x06, 0x24, 0x36, 0x01, 0x25, 0x81, 0xCC, 0x1A, 0x05, 0xF9, 0x06, 0xE9, 0xCF,
-    0x2F, 0x29, 0xF1, 0xCE, 0xCB, 0x0D, 0xEC, 0x8F, 0x72, 0x88, 0x05, 0x9A, 0xDC, 0xE4, 0xE7, 0x28,
-    0x99, 0x3C, 0x14, 0x0A, 0xCE, 0x80, 0x2A, 0xBF, 0xC2, 0xF1, 0x6D, 0xF9, 0x2D, 0x0A, 0x90, 0x0E,
-    0xE4, 0xC0, 0xC6, 0x87, 0x0D, 0x03, 0x54, 0xE9, 0xB4, 0x80, 0xEF, 0xBD, 0x82, 0x66, 0xD1, 0x03,
-    0x75, 0x54, 0x47, 0x77, 0xE2, 0x4E, 0xBA, 0xBF, 0x79, 0x0D, 0x1A, 0x1A, 0x7E, 0x92, 0x90, 0x36,
-    0x91, 0xBE, 0x1A, 0x96, 0x1E, 0x44, 0x86, 0x2C, 0x93, 0x5D, 0x44, 0x5C, 0x20, 0x3C, 0xEE, 0x65,
-    0xE4, 0xDC, 0x87, 0x6B, 0x1F, 0xE0, 0xA2, 0x8F, 0xC9, 0xC6, 0xA1, 0x2D, 0x20, 0x6B, 0x0E, 0x78,
-    0x16, 0xC4, 0xD1, 0xC1, 0x15, 0x4D, 0xD8, 0xD8, 0xDB, 0x3E, 0x25, 0xCD, 0x6A, 0xE3, 0x42, 0xB9,
-    0x08, 0xEB, 0x7A, 0xB6, 0x23, 0x4A, 0x26, 0x4F, 0x14, 0x25, 0xCD, 0x76, 0x96, 0x97, 0xF8, 0x09,
-    0xCD, 0xC8, 0x26, 0x88, 0x99, 0x0C, 0x1C, 0x93, 0x4C, 0x53, 0x11, 0xDE, 0x4E, 0xD4, 0x99, 0xC7,
-    0xE3, 0xE7, 0x19, 0x01, 0xA7, 0x2F, 0x3B, 0x15, 0x30, 0xB8, 0x6C, 0x82, 0xEA, 0xF1, 0xDB, 0x5A,
-    0xEC, 0x4E, 0x1F, 0xB8, 0xE4, 0x5E, 0xDC, 0x40, 0x84, 0xA8, 0x13, 0x74, 0x91, 0x8D, 0x11, 0xF1,
-    0xC0, 0x22, 0x0F, 0x2C, 0x60, 0x00, 0x6E, 0x8B, 0x9C, 0x9C, 0x9F, 0x0C, 0x36, 0x63, 0x98, 0x85,
-    0xEB, 0xF5, 0xFD, 0x4C, 0x37, 0x49, 0x72, 0x0B, 0x64, 0x4B, 0x47, 0x4C, 0xED, 0xA7, 0xBE, 0xE9,
-    0x5B, 0x83, 0xBE, 0xA1, 0x7C, 0x8B, 0xAB, 0xA3, 0x74, 0xA4, 0xA3, 0xE7, 0xB7, 0xC6, 0x43, 0x1D,
-    0x16, 0x48, 0x1C, 0xFF, 0x02, 0xB5, 0x59, 0x4F, 0x6C, 0x1C, 0x57, 0x19, 0xFF, 0x66, 0x5E, 0xEC,
-    0xD7, 0x66, 0x5A, 0xBF, 0x1C, 0x5A, 0x68, 0x9B, 0xC4, 0xD3, 0x43, 0x91, 0xA2, 0x2A, 0xEB, 0xE1,
-    0x90, 0xC3, 0x22, 0xF6, 0xCF, 0xB4, 0x39, 0xE4, 0x50, 0x41, 0x8C, 0x94, 0x6D, 0x0F, 0x05, 0x5A,
-    0xA4, 0x1E, 0x0A, 0x08, 0x92, 0x83, 0x85, 0x8C, 0xD8, 0xD8, 0x43, 0x2D, 0xD4, 0x43, 0x44, 0x6B,
-    0x09, 0x7A, 0x85, 0x4A, 0x70, 0x48, 0x53, 0xA4, 0x18, 0xC9, 0x87, 0x05, 0xAD, 0xB3, 0x2F, 0xB5,
-    0x50, 0x0F, 0x91, 0xC8, 0x24, 0x15, 0x70, 0xE8, 0xA1, 0x13, 0x25, 0x51, 0x51, 0x03, 0xCA, 0x4B,
-    0x33, 0xA1, 0xD3, 0x64, 0xBC, 0x8F, 0xDF, 0xF7, 0xC6, 0x6B, 0x9B, 0x82, 0x84, 0x9A, 0xD6, 0xEB,
-    0x9D, 0xC9, 0xCE, 0x9F, 0xF7, 0xFD, 0xFF, 0x7E, 0xDF, 0xF7, 0xBD, 0x10, 0x51, 0x97, 0x4A, 0xCA,
-    0x89, 0x3F, 0xC7, 0x68, 0x89, 0x32, 0xCA, 0xBC, 0xD4, 0x4F, 0x85, 0x16, 0x5A, 0x6A, 0x95, 0xA8,
-    0x38, 0xA4, 0x16, 0xED, 0x73, 0x8F, 0xF1, 0xCC, 0x4B, 0xC9, 0xD7, 0x24, 0xF0, 0x4D, 0x69, 0x7E,
-    0x4D, 0xD8, 0xA1, 0x3A, 0x71, 0xCF, 0xD4, 0x04, 0x35, 0xEE, 0xA7, 0xDE, 0x1E, 0xCA, 0xF1, 0xDD,
-    0x47, 0x79, 0x9D, 0xFA, 0x07, 0xEE, 0x99, 0x5B, 0xEA, 0x45, 0x36, 0x0B, 0x86, 0x31, 0xA5, 0xE4,
-    0x69, 0xB7, 0x28, 0xE1, 0xAF, 0xEF, 0x08, 0xC5, 0x44, 0xD2, 0xC6, 0x24, 0xAF, 0x19, 0xD0, 0xEA,
-    0x82, 0x98, 0x22, 0xCF, 0x78, 0x44, 0x3D, 0x3C, 0x6B, 0xE2, 0x08, 0xF1, 0x86, 0xB5, 0x86, 0xBE,
-    0x78, 0x6B, 0x9A, 0x9C, 0x6C, 0x5D, 0x1C, 0x53, 0x38, 0x14, 0x56, 0x1E, 0xD2, 0x5E, 0xDC, 0xC6,
-    0x53, 0xF5, 0x57, 0x5B, 0x78, 0x71, 0x25, 0x19, 0x8D, 0x13, 0xED, 0x97, 0x27, 0xD6, 0x96, 0xBD,
-    0xE1, 0x40, 0x93, 0x09, 0x12, 0x3F, 0x95, 0x09, 0x34, 0x88, 0x85, 0x56, 0x60, 0x31, 0x45, 0xC1,
-    0xAD, 0x21, 0x35, 0x07, 0xEF, 0x27, 0xC7, 0x76, 0xF8, 0xC9, 0xFA, 0x12, 0x8A, 0xAC, 0xB0, 0x6F,
-    0x0F, 0x69, 0x3E, 0x69, 0x81, 0x6E, 0xA0, 0x83, 0xC4, 0x33, 0x52, 0x53, 0x0B, 0xDA, 0xC9, 0xD5,
-    0x94, 0xDA, 0xFF, 0xB2, 0xF1, 0xF8, 0xE0, 0x36, 0xA4, 0x36, 0x44, 0x03, 0x5B, 0xD0, 0x23, 0xC3,
-    0x93, 0x2C, 0x19, 0x51, 0x00, 0x0A, 0x22, 0x03, 0x4F, 0x68, 0x17, 0xD8, 0xAC, 0x32, 0x8D, 0x8C,
-    0x6B, 0x64, 0x84, 0x9E, 0xA0, 0x19, 0x5F, 0xEF, 0x1C, 0x71, 0x78, 0x5D, 0xE8, 0x49, 0xBE, 0xA1,
-    0xA8, 0xE1, 0x65, 0x41, 0x25, 0x6B, 0x64, 0xBC, 0xDB, 0xA5, 0xD4, 0x0D, 0x95, 0xD4, 0xA7, 0x34,
-    0xD5, 0x0D, 0xD5, 0xBB, 0x54, 0x57, 0x71, 0x43, 0xA4, 0x61, 0x6C, 0x64, 0x3A, 0xEB, 0x15, 0x75,
-    0x6A, 0xD6, 0x49, 0xD5, 0x77, 0x89, 0x7C, 0x49, 0x98, 0x42, 0xEA, 0x33, 0xA7, 0xE3, 0xA8, 0xE0,
-    0xA5, 0xF7, 0xF8, 0x6A, 0xE1, 0xFD, 0x0B, 0x79, 0xBC, 0x8B, 0xBC, 0x37, 0x88, 0x85, 0x4A, 0x29,
-    0x8C, 0xFD, 0x8C, 0x0C, 0x79, 0x99, 0xA2, 0xEF, 0x79, 0xE9, 0x8C, 0x1A, 0xFA, 0xAB, 0xDA, 0xD4,
-    0xE5, 0xD7, 0x65, 0x3C, 0x3D, 0x71, 0x60, 0x3F, 0x51, 0x3D, 0x5D, 0x22, 0xBA, 0xF9, 0x24, 0xCC,
-    0xFF, 0x8A, 0x4C, 0x68, 0x62, 0xBF, 0x7A, 0x2D, 0x99, 0xC1, 0x5B, 0x42, 0x1B, 0x8F, 0x05, 0x26,
-    0xAC, 0xFE, 0x98, 0x8E, 0x13, 0xCD, 0x5B, 0x28, 0x35, 0x06, 0x6B, 0xD3, 0x77, 0xE2, 0xF9, 0x5C,
-    0x29, 0x5F, 0x9B, 0xC6, 0xFD, 0xE2, 0x25, 0x3D, 0xDB, 0x5D, 0x58, 0x2B, 0xE1, 0x61, 0xA2, 0xC7,
-    0xDF, 0x54, 0xD0, 0x75, 0x7F, 0x40, 0x4D, 0x15, 0xE3, 0x3B, 0x17, 0x26, 0x2D, 0x84, 0xC7, 0xAA,
-    0xA1, 0xBC, 0x49, 0x0A, 0x36, 0xCB, 0xEA, 0x2C, 0xE2, 0x83, 0x9D, 0x8E, 0xB5, 0x37, 0x3A, 0xCF,
-    0x68, 0x52, 0x44, 0x0D, 0x02, 0x07, 0xA2, 0xCE, 0x11, 0xBB, 0x76, 0xEA, 0x24, 0x8D, 0xC1, 0x72,
-    0x36, 0x91, 0x49, 0x48, 0x17, 0xA6, 0xEB, 0xFB, 0xE6, 0xD2, 0xD5, 0x83, 0xAF, 0x4C, 0x7C, 0xF9,
-    0x2B, 0xE9, 0x6F, 0x44, 0x11, 0xF0, 0x3F, 0x0B, 0xE7, 0xBE, 0xB6, 0xE7, 0xC8, 0x17, 0xF4, 0x12,
-    0xEC, 0x75, 0x75, 0x85, 0x15, 0x7C, 0xFC, 0x94, 0x82, 0x82, 0x44, 0xD3, 0xBE, 0x3D, 0x78, 0xF5,
-    0x46, 0x36, 0x39, 0x23, 0x7E, 0xE5, 0x5D, 0x4E, 0xCD, 0x7C, 0xEE, 0x2D, 0x12, 0x3D, 0xC6, 0xA4,
-    0x45, 0xC5, 0xC5, 0xB3, 0xF6, 0xC3, 0x37, 0x3F, 0x48, 0x46, 0x0C, 0x71, 0x97, 0x3F, 0xB8, 0xFB,
-    0xBE, 0xB5, 0x9A, 0x1E, 0xA6, 0x70, 0x4D, 0x5C, 0x34, 0xC7, 0x14, 0xF9, 0x29, 0xE2, 0x28, 0x84,
-    0xFB, 0x10, 0xBC, 0x39, 0xB5, 0xED, 0x5B, 0xA7, 0x7E, 0x4B, 0x2F, 0x78, 0x56, 0x67, 0x66, 0xD7,
-    0x7E, 0x9A, 0xA4, 0x33, 0x34, 0xAF, 0x11, 0x81, 0x53, 0x14, 0x8E, 0x0F, 0x9E, 0x1C, 0x82, 0x42,
-    0x43, 0xBD, 0x65, 0xBA, 0x1B, 0xBE, 0x9C, 0x45, 0x72, 0xE4, 0x9E, 0x21, 0xC3, 0x06, 0x17, 0xA9,
-    0x07, 0x67, 0xFB, 0x19, 0xD2, 0x24, 0x95, 0x48, 0x15, 0xD0, 0xD4, 0x2A, 0x96, 0x3A, 0x8A, 0x65,
-    0xF6, 0x93, 0x9F, 0x05, 0xF6, 0xF2, 0x9A, 0x1A, 0xBC, 0x94, 0xB3, 0xD9, 0x26, 0xD7, 0x23, 0xB7,
-    0xB6, 0x1E, 0xDA, 0xF5, 0x11, 0x3D, 0x1A, 0x3B, 0x82, 0x24, 0x18, 0x52, 0x74, 0xFB, 0x0A, 0x0D,
-    0x6E, 0x69, 0xCF, 0x7E, 0xA8, 0x85, 0xBD, 0x99, 0x54, 0xC7, 0xE5, 0x58, 0xD8, 0xBF, 0x91, 0xB0,
-    0xE7, 0xA0, 0xC6, 0x9F, 0x89, 0xBE, 0x8F, 0x43, 0xFC, 0x1C, 0xC7, 0x37, 0x91, 0x38, 0xF0, 0x6A,
-    0x00, 0x2A, 0x13, 0x07, 0x88, 0xEE, 0x87, 0x73, 0x6B, 0x29, 0x3D, 0x3F, 0x88, 0x69, 0x00, 0x53,
-    0x3D, 0x0C, 0xAA, 0x0F, 0xAD, 0x94, 0xCB, 0x3B, 0x9F, 0x28, 0x85, 0x5E, 0x6E, 0x21, 0xA1, 0x1E,
-    0x8D, 0xCE, 0x0E, 0x68, 0x96, 0x63, 0xAF, 0x41, 0x46, 0x26, 0xB5, 0xF1, 0xE1, 0xE3, 0x27, 0xF1,
-    0x5A, 0x94, 0xCB, 0x05, 0x38, 0x78, 0x52, 0xBC, 0x95, 0xCE, 0xEE, 0x55, 0x74, 0x27, 0x95, 0x57,
-    0x9C, 0x87, 0x0F, 0xD9, 0x6C, 0xA7, 0x9F, 0x88, 0x24, 0xF3, 0xB3, 0x1E, 0x15, 0x2D, 0x2A, 0xDB,
-    0x7E, 0xBE, 0x22, 0xCF, 0x9A, 0x50, 0xEA, 0xFA, 0x04, 0x6D, 0x7E, 0x76, 0x81, 0x35, 0x8D, 0x1B,
-    0xD6, 0x28, 0x34, 0x6C, 0x1A, 0xF6, 0x33, 0x47, 0x21, 0x1B, 0x1F, 0x66, 0x46, 0xA8, 0xE3, 0x07,
-    0x54, 0xC7, 0xB9, 0x41, 0x4D, 0x44, 0xDE, 0x12, 0x95, 0x32, 0xF6, 0x52, 0x51, 0x86, 0x8B, 0x22,
-    0x51, 0xF5, 0x81, 0x41, 0x4A, 0xCC, 0xB0, 0x55, 0xCC, 0x32, 0xD6, 0x23, 0x1C, 0xB1, 0x3E, 0x80,
-    0x35, 0x84, 0xF6, 0x9E, 0xBE, 0xC2, 0xEB, 0x81, 0x34, 0xC8, 0x35, 0xE0, 0xC6, 0x1E, 0xFA, 0xE4,
-    0x07, 0xDC, 0x0F, 0x38, 0xEE, 0xCB, 0xCC, 0x1D, 0x4C, 0x2B, 0xA7, 0xE3, 0x07, 0x42, 0x00, 0xDC,
-    0x6B, 0x8E, 0xEF, 0xAC, 0x3B, 0x1B, 0x55, 0xC8, 0xC4, 0xD7, 0x73, 0x2B, 0x32, 0x96, 0xF1, 0xD2,
-    0x64, 0xB8, 0x38, 0x41, 0xBB, 0x6A, 0x03, 0xD3, 0x70, 0x90, 0xB2, 0x0C, 0xD4, 0xE1, 0x65, 0x81,
-    0x83, 0x34, 0x78, 0x49, 0x39, 0xB4, 0x99, 0x22, 0x71, 0xFB, 0x24, 0x9E, 0x0B, 0x9B, 0x03, 0x12,
-    0x3F, 0xF9, 0xD9, 0x41, 0x0C, 0x68, 0x6D, 0xC7, 0xB5, 0xD9, 0xE5, 0x05, 0xF7, 0x04, 0x0E, 0xB9,
-    0x40, 0x02, 0x97, 0xBB, 0x59, 0x63, 0x96, 0xAB, 0xE6, 0x1C, 0x3F, 0x09, 0x68, 0x91, 0x08, 0x4D,
-    0xA5, 0x19, 0xE4, 0xD4, 0x8D, 0x67, 0xE1, 0x0A, 0x55, 0xB7, 0x40, 0x27, 0xB5, 0x97, 0x97, 0x28,
-    0x67, 0x2A, 0xCE, 0x1F, 0x3F, 0x63, 0xFD, 0x21, 0x50, 0xE7, 0x0F, 0xCE, 0x9C, 0x7B, 0x9D, 0x2C,
-    0x20, 0xBD, 0xEF, 0x3F, 0xF9, 0x23, 0xDC, 0x0C, 0x24, 0xE7, 0x8F, 0x4A, 0xC7, 0x0B, 0x70, 0x08,
-    0xF1, 0x17, 0xE1, 0x50, 0x24, 0x13, 0x68, 0x33, 0xF7, 0x83, 0xC0, 0xC6, 0x83, 0x78, 0x5D, 0xD6,
-    0x2A, 0xEA, 0x68, 0x8D, 0x4F, 0x2B, 0x7C, 0x7A, 0x80, 0x36, 0x21, 0x93, 0xA8, 0x8F, 0x43, 0x30,
-    0xC2, 0xB2, 0x42, 0xDE, 0xBB, 0x00, 0x01, 0xC5, 0x10, 0x37, 0xD3, 0x60, 0xE1, 0x70, 0xBF, 0x86,
-    0x5C, 0x61, 0x3C, 0x25, 0xF5, 0xDA, 0x51, 0x46, 0x89, 0x92, 0xC4, 0x5F, 0x9E, 0xCE, 0xD9, 0x44,
-    0x29, 0x84, 0x54, 0x09, 0x9E, 0xB4, 0xE9, 0x4C, 0xEC, 0x0D, 0x0F, 0x5B, 0x64, 0x14, 0xA7, 0x1D,
-    0x33, 0x8E, 0x18, 0x25, 0x19, 0xB2, 0x00, 0xF2, 0xE4, 0xC7, 0xDB, 0xCB, 0xF1, 0xB1, 0x11, 0xC1,
-    0x16, 0x4E, 0xF2, 0x82, 0x61, 0x44, 0xD0, 0xDB, 0xC9, 0xD1, 0xA9, 0xD8, 0x3E, 0x01, 0xCD, 0xAE,
-    0x97, 0x44, 0x3B, 0x95, 0xDE, 0xEA, 0x9E, 0x6D, 0xE1, 0xB8, 0x13, 0x79, 0x40, 0x65, 0x84, 0x50,
-    0xC9, 0xCA, 0xAD, 0xCC, 0xBC, 0x64, 0xDD, 0xD8, 0xCE, 0xBF, 0x8A, 0x2D, 0xFE, 0x23, 0x70, 0x14,
-    0x6F, 0xE3, 0x75, 0xE4, 0x35, 0x78, 0xC0, 0xF9, 0x41, 0x0C, 0x8E, 0x0D, 0xA0, 0x96, 0xB8, 0xFA,
-    0xAC, 0xA6, 0xD0, 0x82, 0xDE, 0xAD, 0xCE, 0x0A, 0x57, 0xB1, 0x1C, 0xA1, 0x2A, 0x90, 0xEB, 0x88,
-    0xCE, 0x68, 0x91, 0xE6, 0x7F, 0x61, 0xB5, 0xB2, 0xAC, 0xCC, 0x0B, 0x23, 0x62, 0x4B, 0xC0, 0x17,
-    0x71, 0x16, 0xB7, 0x02, 0x26, 0xA6, 0x18, 0xCC, 0xC7, 0x98, 0xDB, 0x43, 0x38, 0x7C, 0xE3, 0x22,
-    0x90, 0x9D, 0x0C, 0x29, 0xE4, 0x0F, 0x19, 0x30, 0x11, 0xFF, 0x5E, 0x8A, 0xFB, 0x8A, 0xF5, 0x5B,
-    0x56, 0xB1, 0x2B, 0xBD, 0xD4, 0xEA, 0xF4, 0x19, 0x8D, 0xA1, 0x58, 0xE7, 0xD9, 0x14, 0x99, 0xA2,
-    0x50, 0x95, 0xD1, 0x54, 0xE0, 0x49, 0xE9, 0x7F, 0x4C, 0xF2, 0xE3, 0x76, 0x49, 0x96, 0xD5, 0xEA,
-    0x74, 0x3A, 0xAE, 0xAA, 0xB1, 0x0C, 0x62, 0x78, 0xCA, 0xF0, 0x99, 0xF1, 0xD2, 0x7F, 0x2F, 0xBE,
-    0x1F, 0x84, 0x2F, 0x3B, 0x3B, 0xDF, 0x60, 0xB6, 0x64, 0xD8, 0xC2, 0xB4, 0xDC, 0x7E, 0x13, 0xF7,
-    0x66, 0xB9, 0x2E, 0x51, 0xF3, 0x19, 0x7E, 0xDC, 0xB6, 0xFC, 0xB8, 0xD9, 0x29, 0x5C, 0xF2, 0xB5,
-    0xE8, 0x3E, 0x97, 0x80, 0x8A, 0x53, 0x43, 0xA3, 0xF2, 0x64, 0xD2, 0xDA, 0x34, 0x2A, 0x15, 0x0B,
-    0x43, 0xDE, 0x77, 0x63, 0x2E, 0xA1, 0xEA, 0xEA, 0x20, 0x29, 0xA9, 0x06, 0x2F, 0x2E, 0x75, 0xC9,
-    0x5F, 0xC8, 0xAA, 0x1A, 0xDF, 0xAF, 0x4A, 0xBC, 0x82, 0x6A, 0x2D, 0x5C, 0x96, 0x95, 0xBE, 0x32,
-    0xA3, 0xFB, 0x54, 0x3E, 0x6E, 0x40, 0x00, 0xB5, 0x2C, 0xAD, 0x1C, 0x8E, 0x57, 0xDA, 0x49, 0x05,
-    0xF0, 0xA6, 0xF2, 0xC6, 0xF4, 0x3A, 0x4A, 0x39, 0xE0, 0x0F, 0xB8, 0x41, 0x18, 0x8C, 0x9C, 0x05,
-    0x03, 0x76, 0x3A, 0xD3, 0xC2, 0x42, 0xE1, 0xF0, 0xD4, 0x69, 0x4E, 0xE6, 0x04, 0x84, 0xF5, 0x46,
-    0xE7, 0xC3, 0x76, 0x96, 0x1F, 0x9C, 0x24, 0x1F, 0x58, 0x40, 0xC5, 0xD6, 0x9B, 0xDA, 0xD3, 0x78,
-    0xD3, 0xE0, 0xE6, 0xAC, 0x37, 0xB0, 0x6B, 0x30, 0xA8, 0x75, 0x3D, 0xC1, 0x7A, 0x04, 0xA0, 0x76,
-    0xD1, 0x20, 0xA9, 0xB2, 0xE1, 0x73, 0xE7, 0xC2, 0x3D, 0x93, 0xCF, 0x36, 0xB8, 0x8E, 0x76, 0x28,
-    0xCB, 0x01, 0xB2, 0xF7, 0x6D, 0x03, 0x97, 0x25, 0x98, 0x70, 0x25, 0x4C, 0x28, 0x92, 0xE9, 0x46,
-    0x84, 0xA3, 0x9F, 0x88, 0x9D, 0xBB, 0xE6, 0x4E, 0xF5, 0xE1, 0x98, 0x09, 0x60, 0xB5, 0xE0, 0xA6,
-    0xA5, 0x6A, 0x0B, 0x1B, 0xDC, 0x2B, 0x9E, 0x7A, 0x1D, 0xBE, 0x28, 0x9C, 0xBB, 0x36, 0x6F, 0x92,
-    0xE4, 0x37, 0xB5, 0xC8, 0xBC, 0x6C, 0xDC, 0xDA, 0x5C, 0xB2, 0x90, 0x0C, 0x7D, 0x39, 0x89, 0x82,
-    0x7C, 0x08, 0xF3, 0xBC, 0x13, 0x3F, 0x6E, 0x0F, 0x09, 0x1C, 0xBB, 0xEC, 0x5D, 0x24, 0x44, 0x93,
-    0x5F, 0x40, 0x0F, 0x18, 0xB1, 0xBC, 0x88, 0x61, 0x45, 0xD5, 0x23, 0x95, 0x78, 0x83, 0x24, 0x64,
-    0x30, 0x1B, 0x67, 0x6B, 0x7B, 0x43, 0x0A, 0x72, 0xBA, 0xD7, 0x09, 0xD8, 0x39, 0x42, 0x60, 0x0E,
-    0x1A, 0xA1, 0xF3, 0xC3, 0x94, 0xD3, 0xB2, 0xE9, 0xCA, 0x4B, 0xDF, 0x69, 0x9D, 0xBB, 0xCA, 0x68,
-    0x98, 0x0C, 0x44, 0xDC, 0x5D, 0xA0, 0x6F, 0xE6, 0xCE, 0x90, 0x08, 0x46, 0xB9, 0x83, 0x46, 0xA4,
-    0x4B, 0xB9, 0xAC, 0x6C, 0x89, 0x9A, 0x9F, 0x31, 0x25, 0x08, 0xC0, 0xC1, 0xD6, 0x73, 0x74, 0x90,
-    0x44, 0xEB, 0xD7, 0x45, 0x75, 0x4D, 0x9B, 0xD7, 0x10, 0xCA, 0x43, 0x8D, 0xE2, 0xA6, 0xAC, 0xFD,
-    0x54, 0x8A, 0x6E, 0x65, 0xC3, 0x68, 0xA4, 0x90, 0x94, 0x73, 0x2E, 0x94, 0x03, 0xED, 0xEC, 0x95,
-    0xBB, 0xD5, 0xD5, 0xB5, 0xA8, 0xAE, 0x1B, 0x5B, 0xAE, 0xC7, 0x87, 0x68, 0x46, 0x60, 0xF6, 0xB1,
-    0x37, 0x90, 0xB4, 0x16, 0x72, 0x3C, 0x9C, 0x3F, 0xC7, 0xA6, 0x90, 0x06, 0x5A, 0x21, 0xEC, 0x7B,
-    0xAE, 0x82, 0xE1, 0x37, 0x9B, 0x64, 0x6C, 0xE5, 0x88, 0x6F, 0x90, 0x6A, 0x01, 0x06, 0x04, 0xA4,
-    0x87, 0xB3, 0x1A, 0xEC, 0x87, 0x81, 0x01, 0xAD, 0x64, 0xC4, 0xE4, 0x0A, 0x74, 0x53, 0xBB, 0x6F,
-    0x0F, 0x52, 0x78, 0xF6, 0xCA, 0x26, 0x5A, 0xB9, 0xF2, 0x65, 0x18, 0xA0, 0xAE, 0xB3, 0xA3, 0x2E,
-    0x16, 0x5B, 0xB1, 0x0C, 0xCD, 0xE7, 0x83, 0x47, 0xC4, 0x1A, 0x85, 0x68, 0x89, 0x12, 0xF0, 0x93,
-    0x5C, 0x42, 0xFD, 0x21, 0x33, 0xBC, 0xA3, 0xB9, 0x8F, 0x28, 0xB8, 0xC0, 0x47, 0x28, 0x7D, 0x72,
-    0x21, 0x6D, 0x22, 0x04, 0xFB, 0x78, 0x62, 0xD4, 0x41, 0x3C, 0x11, 0x97, 0x60, 0x37, 0xEA, 0xE2,
-    0x49, 0xA2, 0xFA, 0x78, 0xE2, 0x59, 0xB6, 0x79, 0x5B, 0x03, 0x42, 0x65, 0xE6, 0x21, 0x78, 0xF2,
-    0x0D, 0x11, 0xE2, 0xF5, 0x20, 0xE1, 0x8C, 0xE5, 0x30, 0xA8, 0xF0, 0x9A, 0xFF, 0x5D, 0xAC, 0x9A,
-    0xE0, 0xE1, 0xD3, 0x25, 0xB2, 0x3D, 0x04, 0x24, 0x08, 0x03, 0x1F, 0x1E, 0x47, 0xF6, 0xAB, 0xE7,
-    0x20, 0xF1, 0xBB, 0xC8, 0xAF, 0x8F, 0x20, 0x7A, 0x17, 0x8B, 0x22, 0xBE, 0xF9, 0x2A, 0x1C, 0xB5,
-    0xCA, 0x3E, 0x3D, 0x0E, 0x6F, 0xA8, 0x14, 0xE2, 0xDA, 0xD3, 0x30, 0x82, 0x5D, 0xDC, 0xD0, 0xE8,
-    0xF9, 0x0A, 0x47, 0x10, 0x2D, 0xE4, 0xB3, 0xCF, 0x17, 0xB7, 0x8D, 0x15, 0x37, 0xA9, 0x8A, 0xE1,
-    0x0A, 0x15, 0x5E, 0x1D, 0x42, 0x57, 0x1C, 0x1F, 0xDB, 0x2E, 0x56, 0xD3, 0xC0, 0xB5, 0xE1, 0x1E,
-    0xA6, 0x8A, 0xB8, 0x6B, 0xC7, 0xEB, 0x5E, 0xDD, 0x0E, 0x56, 0x3E, 0x66, 0x01, 0x91, 0xAF, 0x70,
-    0xE1, 0xDB, 0x12, 0x26, 0x8F, 0xA0, 0x35, 0xE4, 0x3E, 0xF1, 0xE3, 0x67, 0x0D, 0xFA, 0xA0, 0x39,
-    0x1C, 0xEA, 0x2C, 0xF2, 0x2B, 0xE7, 0xEC, 0x00, 0x3B, 0x85, 0x7A, 0x2A, 0xDE, 0x4B, 0xC8, 0xBB,
-    0x09, 0x56, 0x7D, 0xDC, 0x6C, 0x81, 0x55, 0x08, 0x70, 0x57, 0x3F, 0xCD, 0x11, 0xA1, 0xED, 0x38,
-    0xD4, 0x82, 0x47, 0xC4, 0x68, 0x38, 0xEA, 0x4A, 0x02, 0xDA, 0xD3, 0x95, 0x67, 0x6F, 0x18, 0x59,
-    0x72, 0xA4, 0x97, 0xDE, 0x0D, 0xD3, 0x95, 0xE7, 0x1C, 0x9A, 0xB3, 0x4E, 0x3B, 0x98, 0x5B, 0x8D,
-    0xD4, 0xD5, 0xA3, 0x98, 0x18, 0x38, 0x11, 0x4A, 0x94, 0x41, 0x64, 0x73, 0x2B, 0x47, 0x94, 0xE7,
-    0x39, 0xF7, 0xFE, 0x39, 0xD2, 0x80, 0x72, 0x95, 0x34, 0x3C, 0xA3, 0x12, 0x03, 0x55, 0x16, 0x00,
-    0x3B, 0xEA, 0xD7, 0x48, 0x1E, 0x85, 0x97, 0x13, 0xE8, 0x85, 0x85, 0xB9, 0x57, 0xD2, 0xA4, 0x3D,
-    0x9D, 0x51, 0x7D, 0x93, 0xB3, 0x37, 0xEA, 0xCE, 0x5C, 0xAB, 0x10, 0xA4, 0xA3, 0xEA, 0x8A, 0x04,
-    0x3E, 0x42, 0x9D, 0x67, 0xAC, 0x0E, 0x87, 0xBB, 0x53, 0x64, 0x71, 0x8F, 0x07, 0xE4, 0x04, 0xE9,
-    0x0A, 0xF0, 0xD2, 0xC8, 0xD8, 0x59, 0x06, 0xAB, 0x18, 0x48, 0x63, 0x1C, 0x44, 0x81, 0x02, 0xCF,
-    0xAD, 0x93, 0x0C, 0x55, 0x69, 0xC0, 0xED, 0x67, 0x17, 0x6C, 0x05, 0x9B, 0x27, 0x62, 0xD4, 0x73,
-    0x78, 0x33, 0xF2, 0xDE, 0x7A, 0xB5, 0x88, 0x38, 0x58, 0xF2, 0xCD, 0x98, 0xDC, 0x2E, 0x86, 0xF7,
-    0x8E, 0xB4, 0x03, 0xD2, 0xD1, 0xF1, 0x90, 0xE1, 0xEB, 0xD8, 0x76, 0x32, 0xF4, 0x93, 0xA5, 0xAA,
-    0x51, 0x52, 0x0B, 0x66, 0x13, 0x77, 0x3A, 0xF1, 0x58, 0x67, 0xBE, 0xF4, 0xEC, 0xA5, 0x15, 0x78,
-    0xD0, 0xC1, 0x7C, 0xC1, 0x4D, 0x77, 0x8C, 0x46, 0xD1, 0x00, 0x33, 0x60, 0x90, 0x65, 0x6E, 0x82,
-    0x1C, 0x1F, 0xC7, 0xB0, 0x8B, 0xA9, 0x00, 0x0C, 0x6B, 0x48, 0x5F, 0xDE, 0x06, 0xC1, 0xEB, 0x6D,
-    0xFC, 0xF9, 0xDC, 0x99, 0x48, 0xBB, 0x59, 0x9C, 0x80, 0x21, 0x1E, 0x94, 0x13, 0x10, 0x41, 0x22,
-    0xD4, 0xBC, 0xC5, 0x11, 0xBB, 0x07, 0xBF, 0x61, 0xF3, 0x68, 0x2D, 0x4C, 0xBD, 0x02, 0x8A, 0xF4,
-    0x40, 0xB7, 0x8B, 0xD8, 0x6B, 0xA0, 0x0A, 0x80, 0x43, 0x0B, 0x6A, 0x05, 0xE7, 0xB9, 0x6D, 0x62,
-    0x3F, 0xC4, 0x0E, 0x80, 0x3F, 0x59, 0xBC, 0xF0, 0xE0, 0xEF, 0x54, 0x75, 0xB7, 0x9D, 0x69, 0xE0,
-    0x71, 0xEA, 0xF8, 0x40, 0x10, 0xE8, 0x1B, 0xD3, 0x99, 0x01, 0xA0, 0x38, 0xC4, 0x50, 0x11, 0x81,
-    0x6E, 0xDF, 0x47, 0x03, 0xC7, 0xFB, 0x34, 0x4D, 0x84, 0xA6, 0x89, 0xB4, 0x44, 0x41, 0x88, 0x7E,
-    0xE9, 0x88, 0xED, 0xBE, 0x42, 0x9E, 0xAD, 0xCC, 0x30, 0xCE, 0x31, 0xC7, 0xBF, 0xC5, 0xD5, 0x92,
-    0x6B, 0x4A, 0x97, 0xB9, 0x34, 0x38, 0xFA, 0x66, 0x98, 0x27, 0x1E, 0x74, 0xB9, 0xC5, 0xEC, 0x49,
-    0xBC, 0xB7, 0xCC, 0x93, 0x5E, 0xCE, 0x73, 0xAB, 0x09, 0x91, 0x6C, 0x06, 0x81, 0x89, 0x41, 0xD7,
-    0x70, 0x3D, 0x2C, 0xAA, 0x21, 0x47, 0xBA, 0xD3, 0x39, 0x40, 0x71, 0xF0, 0xEA, 0x07, 0x30, 0xDC,
-    0x41, 0x08, 0xC5, 0x75, 0xDD, 0x49, 0xEE, 0x22, 0x7A, 0x86, 0x37, 0x6C, 0x06, 0xCC, 0x3B, 0x1A,
-    0x6D, 0xB7, 0xA0, 0xC8, 0x71, 0x57, 0xD8, 0xAF, 0x14, 0x9E, 0x19, 0xD9, 0xF0, 0xE8, 0xCB, 0xF1,
-    0xC0, 0xEA, 0xE3, 0x41, 0x06, 0xE7, 0xB7, 0x30, 0x72, 0x53, 0x28, 0x93, 0xE0, 0xA5, 0x54, 0xA6,
-    0xB9, 0x30, 0x4D, 0xBF, 0x0C, 0xDF, 0x3A, 0xDF, 0xB2, 0xEF, 0x94, 0x6D, 0xBD, 0xD9, 0xF7, 0x62,
-    0x62, 0x42, 0x83, 0x20, 0xDC, 0x97, 0xD2, 0xBB, 0xA7, 0x03, 0x11, 0xE7, 0x11, 0x0B, 0x86, 0x1A,
-    0x35, 0x6A, 0x8A, 0xE4, 0x6E, 0xE9, 0x04, 0x17, 0xB4, 0x1C, 0x1A, 0x7F, 0x35, 0xA7, 0x5D, 0xBB,
-    0x46, 0x01, 0x77, 0x66, 0x2F, 0x62, 0xC5, 0xCB, 0xA3, 0x04, 0xE1, 0x54, 0x10, 0xA6, 0xCD, 0xEE,
-    0x24, 0x4D, 0x05, 0x71, 0x78, 0x30, 0x55, 0x80, 0x0B, 0x33, 0x1F, 0x34, 0xEE, 0xD8, 0xC3, 0xC6,
-    0x8A, 0xCA, 0x39, 0x0F, 0x8C, 0x51, 0xF4, 0x54, 0x1A, 0xA0, 0x7C, 0xC7, 0x23, 0x0A, 0xE3, 0xC5,
-    0x4C, 0x60, 0x4B, 0x99, 0x9E, 0x41, 0x98, 0x1E, 0xCC, 0x78, 0xB7, 0xC6, 0xCC, 0x52, 0xAF, 0x46,
-    0xC7, 0x55, 0xDC, 0x16, 0x69, 0x74, 0xB6, 0xDC, 0x7F, 0xF3, 0xFA, 0x5A, 0x7B, 0xB5, 0xAC, 0x66,
-    0x0F, 0x04, 0x1E, 0x0A, 0xA5, 0x77, 0x11, 0x2D, 0xEC, 0x31, 0xDA, 0xBF, 0x9F, 0x24, 0xF2, 0xE1,
-    0xC5, 0xBB, 0xB4, 0x8A, 0xBF, 0x16, 0x14, 0xA8, 0xDA, 0xD7, 0xD2, 0xE3, 0xBE, 0x99, 0xE2, 0x6D,
-    0xA9, 0x8B, 0x99, 0x4C, 0xFA, 0x58, 0xDE, 0x46, 0xFF, 0x3C, 0x9F, 0x2C, 0x0B, 0x1B, 0xAB, 0x18,
-    0xED, 0x6C, 0x8E, 0x69, 0xE0, 0xF0, 0xC2, 0xF9, 0xB8, 0x37, 0x30, 0x76, 0x28, 0x0A, 0x61, 0x37,
-    0xA6, 0x3C, 0x59, 0xFA, 0x36, 0xED, 0x3D, 0x34, 0x59, 0xC5, 0x8A, 0x1B, 0x33, 0x90, 0x6A, 0x05,
-    0x3D, 0xA5, 0x67, 0xE7, 0xAD, 0xEF, 0xDE, 0x7B, 0x91, 0xBB, 0x62, 0x7E, 0x01, 0xF9, 0x57, 0xCD,
-    0xA3, 0x1E, 0x17, 0x2D, 0x86, 0xA6, 0xC8, 0x4D, 0xBE, 0x95, 0xF0, 0x3A, 0x38, 0xAD, 0x97, 0x21,
-    0x71, 0xB7, 0x21, 0x2E, 0x64, 0x2B, 0xB8, 0x68, 0x5F, 0x61, 0x84, 0x48, 0x3D, 0xA5, 0xBB, 0x21,
-    0x1A, 0xF9, 0x8D, 0xFE, 0xC1, 0xE7, 0x8D, 0xB0, 0x8A, 0xCF, 0x81, 0x4F, 0xBD, 0x38, 0xE4, 0x0A,
-    0xAD, 0xBA, 0x64, 0x30, 0xB0, 0x64, 0x9F, 0x6A, 0xF1, 0xF4, 0x03, 0x7E, 0xBE, 0xE2, 0x63, 0x16,
-    0xD9, 0xF0, 0xDB, 0x51, 0xED, 0x5F, 0x33, 0xC1, 0x13, 0x66, 0xD2, 0x33, 0x0D, 0x91, 0xCE, 0x46,
-    0xF1, 0x1F, 0x31, 0xDB, 0x2C, 0x72, 0x32, 0xE6, 0x14, 0x97, 0x52, 0xCF, 0xDB, 0x78, 0xC4, 0x78,
-    0x0F, 0xE5, 0x3E, 0xAA, 0x85, 0xC7, 0x11, 0x1C, 0x9D, 0xB5, 0x8C, 0x45, 0x41, 0xD2, 0xC4, 0x49,
-    0x37, 0xC9, 0x1C, 0x3A, 0x1F, 0x99, 0xB9, 0x91, 0x6E, 0xC8, 0x7D, 0xFE, 0xAB, 0x34, 0x8B, 0x74,
-    0x88, 0x88, 0x5D, 0xDF, 0xC6, 0x82, 0xF9, 0xFA, 0xC8, 0x37, 0xB5, 0x43, 0x9E, 0xF7, 0x2D, 0xCD,
-    0x6D, 0x28, 0x14, 0x66, 0xAA, 0xAB, 0x82, 0xC3, 0x95, 0x3A, 0xFF, 0x6F, 0xC5, 0x98, 0xF7, 0x64,
-    0xBE, 0x12, 0x05, 0x7A, 0x5D, 0x09, 0x40, 0x48, 0xB9, 0xC5, 0x75, 0x21, 0xF7, 0x9A, 0x4D, 0x4C,
-    0x81, 0xD4, 0x35, 0x41, 0xB9, 0xCE, 0x63, 0xDC, 0x23, 0xF1, 0x61, 0xCA, 0x1D, 0x16, 0xC0, 0x01,
-    0xA6, 0xF3, 0x79, 0x4B, 0xD4, 0xD0, 0xE0, 0x77, 0xDE, 0xD0, 0xC6, 0x79, 0x90, 0x15, 0x54, 0x74,
-    0x19, 0xE8, 0xD4, 0xE1, 0x58, 0xAC, 0x62, 0xA4, 0xCD, 0xA9, 0xD7, 0x44, 0xF4, 0xE9, 0xA6, 0x37,
-    0x3C, 0x43, 0xE1, 0x66, 0x79, 0xF0, 0xF3, 0x63, 0x34, 0x7F, 0x9D, 0x82, 0x30, 0xA5, 0x5D, 0xD3,
-    0x1B, 0xA1, 0x1F, 0x64, 0x83, 0x55, 0x4B, 0xB3, 0x79, 0x1E, 0xA0, 0xC5, 0xB3, 0xA8, 0xAA, 0xE9,
-    0x14, 0x15, 0x40, 0x3C, 0x1E, 0x62, 0x25, 0xAC, 0xD3, 0x3B, 0xA8, 0xD5, 0xB7, 0xBA, 0x64, 0x4F,
-    0x24, 0x2A, 0x1B, 0x51, 0xDA, 0xE3, 0xE6, 0xB4, 0xC8, 0x81, 0x8B, 0x37, 0x02, 0x85, 0xA3, 0x99,
-    0x6F, 0x0B, 0x78, 0x2C, 0xA2, 0x66, 0x93, 0x5A, 0x5D, 0x6A, 0x02, 0x8A, 0x31, 0xF3, 0x42, 0x1A,
-    0x24, 0x65, 0x5F, 0x64, 0xF3, 0xA7, 0x93, 0x2D, 0xC2, 0xA0, 0xE4, 0x1F, 0x77, 0x03, 0x02, 0x90,
-    0x25, 0xBE, 0x1B, 0x0A, 0xB0, 0x2D, 0x86, 0x0B, 0x98, 0xA3, 0x59, 0xA3, 0x7C, 0xE2, 0x6E, 0x28,
-    0x04, 0x97, 0xFE, 0x1B, 0x4B, 0x06, 0x09, 0x08, 0x08, 0x13, 0xFA, 0xC0, 0x92, 0x9C, 0xED, 0xDA,
-    0x1C, 0xD9, 0xD5, 0x87, 0x9D, 0x4D, 0x44, 0x85, 0xBC, 0x8D, 0xA1, 0x62, 0xBD, 0xC5, 0xFD, 0x5F,
-    0x58, 0x32, 0xE4, 0x5D, 0x6A, 0x88, 0x80, 0x3E, 0xE5, 0x60, 0x2A, 0x2E, 0xA1, 0x1D, 0xEE, 0xB1,
-    0x30, 0x4A, 0xC5, 0xC1, 0x02, 0xB0, 0x05, 0x42, 0x84, 0xD7, 0xD0, 0x26, 0xA7, 0x9B, 0x6A, 0xC0,
-    0xAB, 0x93, 0x6E, 0xB8, 0x41, 0x8D, 0xB6, 0x7F, 0x72, 0x63, 0x39, 0x65, 0x7C, 0x77, 0xB3, 0x13,
-    0x1B, 0x47, 0x13, 0x18, 0x61, 0xF2, 0x29, 0x65, 0xE6, 0xA3, 0x44, 0x88, 0xB4, 0x0D, 0xDF, 0xDC,
-    0xCC, 0x82, 0x97, 0x57, 0x53, 0xF5, 0x6D, 0xA0, 0x56, 0x11, 0x24, 0x8A, 0x77, 0xBC, 0x74, 0x8B,
-    0xDA, 0x90, 0xEF, 0xF7, 0x5B, 0xCA, 0x26, 0xEF, 0xCE, 0xB4, 0x68, 0xA3, 0xA4, 0xED, 0xDD, 0xD8,
-    0x8F, 0xD7, 0xF2, 0x44, 0x49, 0x39, 0x6F, 0xD9, 0x77, 0x39, 0x19, 0x26, 0xF1, 0x1B, 0x24, 0xE0,
-    0x75, 0xE4, 0x84, 0x87, 0x08, 0xF8, 0x6A, 0xD2, 0x54, 0x3F, 0x7E, 0xC7, 0xBE, 0x5D, 0x86, 0x59,
-    0x6B, 0x93, 0x5A, 0x5A, 0xCD, 0x45, 0x89, 0x1B, 0x73, 0x0E, 0x7C, 0x36, 0x62, 0x61, 0x55, 0xCD,
-    0x3F, 0x4A, 0xA9, 0x36, 0x89, 0x42, 0x93, 0xDD, 0x35, 0xB1, 0x87, 0xC6, 0x49, 0x5E, 0xC8, 0xA9,
-    0x8F, 0x61, 0x91, 0xE2, 0xCF, 0x24, 0x92, 0xDB, 0x55, 0xE0, 0xFE, 0x80, 0xCB, 0x26, 0x17, 0xD8,
-    0x2D, 0xFB, 0x81, 0x73, 0x20, 0x64, 0x61, 0x4B, 0x95, 0x4C, 0xE1, 0x71, 0x0D, 0x69, 0xDB, 0x40,
-    0xF8, 0x36, 0x80, 0x19, 0x33, 0xB0, 0x06, 0xDA, 0xE2, 0x4B, 0x69, 0xB5, 0x6F, 0x72, 0x0D, 0x76,
-    0xFA, 0x27, 0x8E, 0xA2, 0xDA, 0xC7, 0x10, 0x15, 0xA9, 0x2F, 0xF5, 0xAB, 0x1D, 0xAA, 0xA9, 0xB8,
-    0xEA, 0x46, 0x81, 0x08, 0x34, 0xDE, 0x77, 0x11, 0xE0, 0xFE, 0x93, 0xA3, 0x59, 0x31, 0x97, 0x2F,
-    0x15, 0x54, 0x6B, 0xE7, 0xF4, 0xD1, 0x6A, 0x26, 0xFE, 0x81, 0x20, 0xD2, 0x53, 0x48, 0x94, 0x1E,
-    0xC7, 0x23, 0x6F, 0xAD, 0x34, 0xA8, 0xC7, 0x7B, 0xE1, 0x41, 0x02, 0x47, 0x5F, 0xCB, 0xE8, 0xCE,
-    0x9A, 0x73, 0x2A, 0x87, 0xCF, 0x72, 0xC5, 0x68, 0x1E, 0x03, 0x37, 0x66, 0x74, 0xEE, 0x97, 0x1E,
-    0x85, 0x22, 0x85, 0x33, 0xCC, 0xA6, 0x55, 0x3E, 0x57, 0x2D, 0xFE, 0x0D, 0xB5, 0x5A, 0x4F, 0x6C,
-    0x1C, 0xD7, 0x79, 0xFF, 0x66, 0x46, 0xE4, 0xC4, 0x9A, 0xD8, 0x8F, 0x05, 0xAC, 0xC6, 0x36, 0x2D,
-    0x8E, 0x0F, 0x2D, 0x60, 0x04, 0xE2, 0x8E, 0x0F, 0x3E, 0xA8, 0xE8, 0x2C, 0x77, 0x6C, 0x21, 0xF5,
-    0x21, 0x40, 0xAD, 0x00, 0xDA, 0x14, 0xA8, 0xD1, 0x3A, 0xB7, 0xD6, 0x31, 0x10, 0xFA, 0x60, 0x14,
-    0x34, 0xBA, 0xE4, 0x3E, 0xB9, 0x05, 0x7C, 0xF0, 0xC1, 0x04, 0x92, 0xF6, 0x96, 0x5A, 0x87, 0x1C,
-    0x62, 0xBA, 0x08, 0x85, 0x96, 0x87, 0x8D, 0x43, 0x71, 0x1E, 0xC5, 0x83, 0x0E, 0x3A, 0x68, 0x64,
-    0x23, 0xE8, 0xC1, 0x28, 0x3C, 0x6A, 0x14, 0x27, 0xB0, 0xE0, 0xFA, 0xC5, 0x1E, 0xC7, 0x23, 0x6A,
-    0xB9, 0xAF, 0xBF, 0xEF, 0xCD, 0xCC, 0xEE, 0x5A, 0x76, 0x63, 0xCB, 0x96, 0x57, 0x5C, 0x8A, 0xFB,
-    0x66, 0xF6, 0xBD, 0xEF, 0xFB, 0xBD, 0xEF, 0xCF, 0xEF, 0xFB, 0xDE, 0x10, 0xD9, 0x57, 0xDF, 0x10,
-    0x39, 0xA6, 0xA4, 0xA9, 0x97, 0x23, 0xF1, 0x2B, 0xE2, 0xBF, 0x0E, 0xF0, 0x16, 0x7C, 0xED, 0x1F,
-    0x72, 0x22, 0xEF, 0x82, 0x22, 0x3A, 0x2A, 0xF0, 0x49, 0xB7, 0x89, 0x82, 0xA4, 0x20, 0x8A, 0xDD,
-    0x9C, 0xBC, 0x5F, 0x3F, 0xA1, 0x28, 0x34, 0x98, 0xE6, 0xC3, 0xEE, 0x39, 0x0A, 0x24, 0x15, 0x14,
-    0x93, 0x97, 0xE3, 0x8A, 0x50, 0xD1, 0x3A, 0xF5, 0x7F, 0x68, 0x94, 0x30, 0x8A, 0xBE, 0xB9, 0x81,
-    0x9B, 0xD4, 0x64, 0x91, 0xF9, 0x2B, 0x59, 0x64, 0x74, 0xF8, 0x68, 0x29, 0xA8, 0x2D, 0xA4, 0xF0,
-    0x94, 0xBF, 0x8B, 0xEF, 0x6C, 0x39, 0x45, 0x9B, 0x86, 0x22, 0x49, 0x7D, 0xFD, 0x9F, 0x97, 0xD2,
-    0xC2, 0x08, 0xDD, 0xA9, 0x6E, 0x3F, 0xC4, 0xBF, 0x56, 0x7C, 0x08, 0x77, 0x7D, 0x40, 0xE4, 0x1A,
-    0x88, 0xE8, 0x9C, 0x6C, 0xE6, 0x9A, 0xE5, 0x5F, 0xDB, 0x78, 0x7B, 0x90, 0x89, 0x3A, 0x90, 0xD5,
-    0x79, 0x13, 0x37, 0x88, 0x10, 0x9F, 0x9E, 0x8D, 0x31, 0xAC, 0x30, 0xBE, 0xE8, 0x65, 0x90, 0x1C,
-    0xF2, 0x89, 0x7F, 0x59, 0x66, 0xB5, 0x87, 0xE4, 0xFD, 0xF2, 0xBB, 0x05, 0xB5, 0x08, 0xE3, 0x9A,
-    0x84, 0xC4, 0x95, 0x0E, 0xED, 0x24, 0xCE, 0xE8, 0x71, 0x43, 0x1D, 0xC3, 0x33, 0xDE, 0x49, 0xD2,
-    0xBF, 0xAC, 0xC9, 0x68, 0x0A, 0xF2, 0x06, 0x9A, 0x9D, 0xA3, 0xAE, 0x31, 0x4E, 0x11, 0x49, 0xED,
-    0x65, 0x25, 0xE9, 0x98, 0x7A, 0x0B, 0xD4, 0x0A, 0x92, 0xF0, 0x44, 0x26, 0x54, 0x11, 0xE8, 0x7E,
-    0x10, 0xDF, 0x30, 0x8F, 0x6B, 0xE3, 0xE9, 0xFA, 0x0B, 0xDF, 0xC3, 0x3B, 0x60, 0xB5, 0x3B, 0x09,
-    0xE4, 0x18, 0xE1, 0x8F, 0xA3, 0x90, 0x9F, 0x7E, 0x87, 0xEB, 0xFE, 0x09, 0x8C, 0xC7, 0x22, 0x21,
-    0x37, 0x03, 0x9E, 0x82, 0x30, 0x7E, 0xFD, 0xBB, 0x9A, 0x7C, 0x03, 0x98, 0xDA, 0xDD, 0xE5, 0x04,
-    0x08, 0xB6, 0x31, 0x4C, 0x25, 0xAE, 0x78, 0x3A, 0xB8, 0x4A, 0xE1, 0x55, 0xA3, 0x3D, 0xC3, 0x33,
-    0xAF, 0xE0, 0xED, 0xF3, 0x2E, 0x2D, 0xF2, 0x1A, 0x3B, 0x98, 0xDA, 0x19, 0x7D, 0x11, 0x64, 0x81,
-    0xA7, 0x87, 0xF5, 0x21, 0xC7, 0xCF, 0x13, 0x0A, 0x6B, 0x25, 0x1F, 0xB0, 0x12, 0x3B, 0x80, 0x20,
-    0x02, 0x62, 0xEB, 0xD5, 0xE0, 0x1F, 0xFF, 0x88, 0x02, 0x73, 0x40, 0xA3, 0x27, 0x4A, 0xA1, 0xDC,
-    0x6C, 0x48, 0x81, 0xAF, 0xE8, 0xC1, 0x25, 0xAC, 0xAB, 0x2B, 0xFD, 0xF0, 0x27, 0x04, 0xC5, 0xBE,
-    0x43, 0x13, 0x55, 0x59, 0xCF, 0x1A, 0x91, 0x32, 0xC9, 0x32, 0x19, 0x88, 0x9C, 0x1E, 0x8C, 0xC5,
-    0x73, 0x33, 0x0A, 0x13, 0x18, 0x09, 0x14, 0x7F, 0xB8, 0x1E, 0xEA, 0xAB, 0xC0, 0x24, 0x83, 0x7B,
-    0xA0, 0x51, 0xCC, 0x13, 0x62, 0x27, 0x00, 0x48, 0x81, 0xC9, 0x9C, 0x40, 0xAD, 0xC0, 0x6A, 0xA2,
-    0xA2, 0xBA, 0xEF, 0x30, 0xDE, 0xD0, 0x53, 0xEC, 0x60, 0xAD, 0x18, 0x16, 0xF8, 0xD0, 0x6D, 0x16,
-    0x2D, 0x64, 0x18, 0x45, 0x8F, 0xF4, 0x96, 0x48, 0xF2, 0x5B, 0x13, 0xAD, 0xB6, 0x40, 0xDE, 0x77,
-    0x28, 0xD6, 0xBC, 0x6E, 0x93, 0x68, 0x7E, 0x42, 0x43, 0x0A, 0x25, 0x9D, 0x6C, 0x64, 0x8A, 0x0E,
-    0x82, 0xD3, 0xA7, 0x73, 0x88, 0x84, 0xF9, 0x06, 0xBC, 0x20, 0xE0, 0x94, 0x87, 0xB6, 0xFD, 0x17,
-    0x8C, 0x9E, 0x08, 0xE4, 0xF3, 0xF5, 0x5D, 0x4D, 0xDE, 0x47, 0x98, 0x9A, 0x0D, 0xBA, 0x57, 0xDB,
-    0xF0, 0x53, 0x09, 0x45, 0xA6, 0x60, 0xA9, 0x20, 0xEE, 0x16, 0x16, 0x3E, 0x0B, 0x47, 0x39, 0xB3,
-    0x54, 0xDF, 0xB1, 0x5D, 0xC9, 0x34, 0x7E, 0x0F, 0xEB, 0x31, 0x16, 0xAC, 0x93, 0xCD, 0xC3, 0x99,
-    0x0D, 0xFC, 0x6F, 0xA2, 0x76, 0xBE, 0x08, 0xBC, 0xE8, 0xB5, 0x9C, 0x3A, 0x92, 0x42, 0x1A, 0xEF,
-    0xA8, 0x6B, 0xB2, 0xE0, 0xB4, 0x5C, 0x80, 0x85, 0xDB, 0x69, 0x07, 0x8C, 0x1A, 0xFF, 0x94, 0x94,
-    0x6C, 0xFB, 0x12, 0x51, 0x67, 0x1A, 0x39, 0x57, 0xB5, 0x80, 0xC0, 0xF3, 0x80, 0x21, 0xFC, 0x01,
-    0xC7, 0x1E, 0x06, 0xBF, 0xD5, 0xB8, 0xDC, 0xF7, 0xA1, 0xB6, 0x41, 0x84, 0x9A, 0x5D, 0xFD, 0xC6,
-    0x01, 0x90, 0x73, 0x00, 0xA3, 0x72, 0x4A, 0x76, 0x5C, 0x8D, 0x09, 0x03, 0xE5, 0x21, 0xFC, 0xF0,
-    0xCA, 0xDB, 0xF8, 0xE7, 0x6A, 0x60, 0x09, 0xA3, 0x4F, 0xB0, 0x4D, 0x31, 0x3E, 0x01, 0xE8, 0x30,
-    0x01, 0xD2, 0x25, 0xA0, 0x8E, 0xE4, 0xEC, 0x68, 0xB3, 0x80, 0xE7, 0x5F, 0x9F, 0x8A, 0x75, 0x49,
-    0xE5, 0x44, 0xCE, 0xA3, 0x19, 0xF9, 0x43, 0x88, 0xFA, 0xF4, 0x1E, 0xDC, 0xAA, 0xF7, 0x0C, 0xB6,
-    0xE7, 0x34, 0x59, 0x79, 0xD9, 0x03, 0xDD, 0xEB, 0x1A, 0xFE, 0x00, 0xCB, 0x5B, 0x0D, 0x32, 0x7C,
-    0xC6, 0xC4, 0x39, 0x16, 0x8D, 0xE1, 0x86, 0x3E, 0x87, 0x0D, 0xB8, 0x16, 0xF6, 0x00, 0xEE, 0x84,
-    0x00, 0x90, 0x88, 0xF3, 0x97, 0x62, 0x82, 0x7F, 0x91, 0x37, 0x14, 0x4D, 0xB8, 0x9B, 0x79, 0x25,
-    0x21, 0xCF, 0x98, 0x9C, 0xEE, 0x2D, 0x9E, 0x2C, 0xB0, 0x67, 0xBE, 0xC6, 0x56, 0xFB, 0x39, 0x6F,
-    0x9D, 0x42, 0xF4, 0x89, 0x78, 0x8D, 0xDE, 0xCC, 0xB9, 0x53, 0xAE, 0xEE, 0x18, 0x1D, 0x28, 0x21,
-    0x21, 0xAD, 0x35, 0x33, 0x18, 0x9C, 0xC2, 0x16, 0xAF, 0xE2, 0x16, 0xE8, 0x55, 0xD2, 0x0E, 0xCD,
-    0xEF, 0xA7, 0x99, 0x63, 0xCC, 0xD5, 0x49, 0xB0, 0x4E, 0xAC, 0xAB, 0xCE, 0x6E, 0x5B, 0xAB, 0x72,
-    0x37, 0xAF, 0xD2, 0xE1, 0x14, 0x2A, 0x68, 0x9A, 0xFD, 0xA1, 0x22, 0xC8, 0x2C, 0x5E, 0x28, 0xA8,
-    0xF0, 0x54, 0x20, 0x59, 0xEE, 0x15, 0x07, 0x91, 0x00, 0xD1, 0x2A, 0x41, 0x28, 0x60, 0x69, 0x4F,
-    0x20, 0x16, 0x04, 0x88, 0x57, 0xE3, 0x30, 0x6B, 0x5F, 0x1C, 0xFD, 0xC4, 0x54, 0xAC, 0x3E, 0xD2,
-    0xED, 0x26, 0x82, 0xED, 0x71, 0x6D, 0x63, 0x1B, 0x40, 0xDF, 0xC5, 0x98, 0x03, 0x82, 0x1A, 0x9F,
-    0x98, 0x1D, 0x67, 0xE3, 0x0C, 0x0C, 0xBD, 0xB4, 0x86, 0x3C, 0x19, 0x84, 0x05, 0xF2, 0xEE, 0xC0,
-    0x57, 0xF2, 0x59, 0x63, 0x0A, 0x04, 0x36, 0xD8, 0xD2, 0xC6, 0x4F, 0x1D, 0xFE, 0xAF, 0x79, 0x2D,
-    0x2B, 0xF7, 0x9A, 0x0E, 0x1E, 0xD1, 0x0B, 0x8E, 0x8E, 0xBD, 0x6C, 0x25, 0x4A, 0x5E, 0x1B, 0x92,
-    0x59, 0xAF, 0x6C, 0x25, 0x19, 0xFA, 0xAA, 0x6F, 0x92, 0xA8, 0x4E, 0x4E, 0x73, 0x3C, 0xAF, 0x9B,
-    0x90, 0x78, 0x93, 0xA3, 0x13, 0xC4, 0x9B, 0xA9, 0x1C, 0x6D, 0xA6, 0xDB, 0x3D, 0xE9, 0xF1, 0xDC,
-    0xE1, 0xC6, 0x26, 0xC0, 0xF5, 0xA4, 0xAB, 0x89, 0xDD, 0x82, 0x18, 0x43, 0x86, 0x96, 0xFC, 0x77,
-    0x7E, 0x0A, 0x93, 0x1D, 0x55, 0xF6, 0x3C, 0x1E, 0x54, 0x8E, 0xC2, 0x9D, 0x1A, 0x83, 0x2B, 0x4E,
-    0x6A, 0x0E, 0x80, 0xAA, 0x8D, 0xFA, 0x94, 0x7D, 0xCD, 0x29, 0x7A, 0x1C, 0xF5, 0x23, 0x79, 0xEB,
-    0x42, 0x5A, 0x6B, 0xD6, 0xB5, 0xDB, 0xB4, 0x27, 0x63, 0xB7, 0x55, 0x48, 0xC4, 0x83, 0x0E, 0xC1,
-    0x05, 0x9C, 0x3A, 0xD2, 0xCC, 0x0E, 0xE9, 0xB5, 0x21, 0xE4, 0x5B, 0xF1, 0xF7, 0x54, 0x7B, 0x21,
-    0xC8, 0x5E, 0x1B, 0x7A, 0xA3, 0xC4, 0xFA, 0xC0, 0xDC, 0xD0, 0xDF, 0x35, 0x07, 0x36, 0x5D, 0x12,
-    0x75, 0xBB, 0x5D, 0xEC, 0xAD, 0x51, 0xCE, 0xFE, 0x86, 0x86, 0x4F, 0x1E, 0x87, 0x55, 0x7D, 0x9D,
-    0x23, 0x1A, 0x67, 0x40, 0xB6, 0x18, 0xF8, 0xF8, 0x86, 0x44, 0x68, 0x60, 0x0F, 0x9A, 0x1A, 0xEC,
-    0xD1, 0xFD, 0xD6, 0x44, 0x85, 0xF4, 0xE5, 0xBC, 0x31, 0x59, 0x68, 0x6C, 0x0E, 0xCA, 0xEB, 0xF7,
-    0x16, 0x3B, 0x2C, 0xB2, 0x84, 0x37, 0xDE, 0x55, 0x27, 0xA5, 0x56, 0xEA, 0x66, 0x3D, 0xC0, 0xA5,
-    0xC5, 0x63, 0xCF, 0x17, 0xAD, 0x14, 0x68, 0x61, 0x3A, 0x91, 0x1C, 0xEA, 0x38, 0x1A, 0x60, 0xA5,
-    0xB0, 0x6B, 0x64, 0x66, 0xE4, 0x65, 0x12, 0xEB, 0x36, 0xCB, 0xD4, 0xAF, 0x67, 0xD9, 0x97, 0xFD,
-    0xAC, 0x0A, 0x59, 0x1D, 0xC5, 0x99, 0xBB, 0x9A, 0xB1, 0xDB, 0x3D, 0x45, 0xAC, 0xBA, 0xFF, 0xCE,
-    0xAB, 0x0A, 0x66, 0x9E, 0xC3, 0xD5, 0x1F, 0xB2, 0x11, 0x82, 0x83, 0x2D, 0xDF, 0x04, 0x9D, 0x88,
-    0x52, 0x23, 0x6D, 0x48, 0x1D, 0x0F, 0x6A, 0x7A, 0x06, 0x77, 0xC6, 0x18, 0x5C, 0xA0, 0x65, 0x63,
-    0x92, 0xBE, 0xA9, 0xCD, 0xFA, 0x53, 0x83, 0xD6, 0x2D, 0x6C, 0x33, 0x33, 0x8E, 0x80, 0x83, 0x38,
-    0x76, 0x23, 0xD8, 0x43, 0xEC, 0x90, 0x75, 0x2E, 0x9B, 0xFD, 0x09, 0xD0, 0x80, 0x27, 0xF4, 0xFF,
-    0x75, 0x84, 0x88, 0x19, 0xC8, 0x55, 0xE4, 0x3B, 0x88, 0x74, 0x86, 0x17, 0x19, 0x43, 0x5D, 0x58,
-    0x54, 0x43, 0x83, 0x7C, 0xD3, 0xC7, 0x40, 0x20, 0xD9, 0x73, 0x22, 0x44, 0x71, 0xAF, 0xC4, 0x78,
-    0xDF, 0x06, 0xD8, 0xE9, 0x20, 0x55, 0x05, 0xE0, 0x3E, 0xB4, 0x6A, 0x63, 0xCD, 0x18, 0xC6, 0x11,
-    0x7B, 0x93, 0x24, 0x43, 0xE9, 0x8D, 0xC4, 0xD9, 0xC7, 0xB6, 0x6A, 0x44, 0xDB, 0x02, 0xE1, 0x22,
-    0x76, 0xB0, 0x83, 0xD8, 0x3A, 0x2F, 0xC3, 0x42, 0x7D, 0xBC, 0x81, 0xA8, 0xA5, 0x0B, 0xD6, 0x30,
-    0xD3, 0x75, 0x72, 0xF7, 0x81, 0x64, 0x16, 0x80, 0xC2, 0x20, 0xB4, 0xD8, 0xD8, 0x95, 0x84, 0x12,
-    0xD6, 0x29, 0x69, 0xDE, 0x2E, 0x9B, 0x80, 0x6D, 0x69, 0x24, 0xDB, 0xCE, 0x26, 0xBE, 0xC7, 0x4E,
-    0x71, 0x84, 0xBE, 0x4A, 0xED, 0xEE, 0x84, 0x27, 0xF8, 0x97, 0x61, 0x4B, 0x6C, 0x57, 0xC1, 0xFA,
-    0x94, 0x23, 0x99, 0x77, 0xC9, 0xBF, 0x06, 0x59, 0xD5, 0x0A, 0xA6, 0xC6, 0x22, 0x9A, 0xF3, 0x30,
-    0x5B, 0xCD, 0x89, 0x0C, 0x21, 0x00, 0x8B, 0x81, 0x49, 0x60, 0x6B, 0xAB, 0x64, 0xEA, 0x8E, 0x12,
-    0x0A, 0xAE, 0xC1, 0xC3, 0x92, 0x48, 0x89, 0xC4, 0x29, 0xB0, 0x76, 0x1B, 0x0C, 0x76, 0x0D, 0xB1,
-    0x0C, 0x5E, 0xB5, 0x3C, 0x0E, 0x99, 0x8C, 0x86, 0x25, 0x8A, 0xD3, 0xA4, 0xF7, 0xF6, 0x6B, 0x06,
-    0x9E, 0xC3, 0x3E, 0x4A, 0x74, 0xAE, 0xA1, 0xAF, 0xF5, 0x2B, 0x30, 0x5B, 0x14, 0x6E, 0x42, 0x4E,
-    0xDE, 0xA6, 0xA4, 0x07, 0x4B, 0x85, 0x06, 0x1A, 0xDE, 0xDE, 0x86, 0xDD, 0xFA, 0x06, 0x1A, 0xAD,
-    0xD6, 0x14, 0x8F, 0xF9, 0x40, 0x80, 0x09, 0xA3, 0x4D, 0x8D, 0xB1, 0x14, 0xEA, 0xF8, 0x19, 0x27,
-    0x7B, 0xAF, 0xC0, 0xC4, 0x1D, 0x48, 0xEB, 0xA4, 0x16, 0xAD, 0xEF, 0x83, 0xC3, 0x61, 0xF7, 0xFC,
-    0xEB, 0xCB, 0x39, 0x67, 0x15, 0x28, 0xB8, 0x88, 0x48, 0x7C, 0x98, 0x59, 0xC6, 0x24, 0xC4, 0x24,
-    0x36, 0x9A, 0x18, 0x30, 0xCF, 0x6F, 0x30, 0x7F, 0x1F, 0x70, 0x96, 0x71, 0xED, 0xE6, 0x4B, 0x64,
-    0x24, 0xF6, 0xE9, 0xC8, 0xD4, 0xD8, 0x3F, 0xC8, 0xF7, 0xCB, 0x8A, 0x97, 0xD8, 0x10, 0xA0, 0xEB,
-    0xF0, 0x5B, 0xBF, 0x8E, 0xD5, 0xCC, 0xF3, 0x2E, 0x96, 0x2F, 0xA9, 0xC1, 0x61, 0xF7, 0xBF, 0xA7,
-    0xBE, 0x21, 0x1A, 0x65, 0xB4, 0x06, 0x2F, 0xEF, 0x61, 0xBF, 0xDA, 0x10, 0x43, 0x40, 0x1D, 0x4F,
-    0x21, 0x29, 0x80, 0x83, 0x52, 0x08, 0x56, 0x83, 0x8C, 0x49, 0x4E, 0x5E, 0x1B, 0x76, 0x84, 0xAD,
-    0xD9, 0x49, 0x95, 0x53, 0xB8, 0x48, 0x4A, 0xC4, 0xC9, 0xC9, 0xCB, 0x44, 0x06, 0x4D, 0x38, 0x65,
-    0xCE, 0x8E, 0xAC, 0xA5, 0xDB, 0x99, 0xD9, 0xE3, 0xA0, 0x29, 0xBB, 0xF0, 0xA0, 0x6D, 0x29, 0x42,
-    0x13, 0x3A, 0xBA, 0xA7, 0x1C, 0xCE, 0x51, 0x49, 0xFF, 0x80, 0x79, 0xD2, 0x39, 0x4B, 0xD5, 0x14,
-    0xE3, 0x57, 0x72, 0xA2, 0xB2, 0xA1, 0xD0, 0x3A, 0x04, 0x3B, 0x7B, 0x9F, 0x75, 0x0D, 0x4C, 0x15,
-    0x6A, 0x6D, 0x58, 0x62, 0x82, 0x62, 0xBF, 0x10, 0x32, 0x5E, 0xF0, 0x12, 0x0C, 0x2D, 0xF1, 0x76,
-    0xCF, 0xC3, 0x20, 0xD6, 0x7D, 0x03, 0x3E, 0x0D, 0x71, 0xD9, 0x05, 0x81, 0x21, 0xBE, 0xD6, 0x6B,
-    0x8F, 0x1D, 0xDE, 0x61, 0x81, 0xC6, 0xE9, 0xD7, 0x9A, 0x4A, 0x5C, 0x01, 0xE6, 0x9F, 0x3E, 0xA0,
-    0x45, 0xC4, 0x8B, 0xF7, 0xFF, 0x47, 0x7B, 0xFF, 0x1D, 0xC8, 0x10, 0x24, 0x3F, 0x25, 0xED, 0x6A,
-    0x1F, 0xF9, 0xBD, 0x85, 0x9B, 0x0A, 0x47, 0x7B, 0xBB, 0x48, 0xCB, 0x70, 0xE7, 0x7E, 0xA6, 0x69,
-    0xF8, 0x07, 0x14, 0x71, 0xD3, 0x8D, 0x8D, 0x91, 0x44, 0xE8, 0x46, 0xFE, 0xF8, 0xB8, 0x22, 0xF9,
-    0x17, 0x50, 0x04, 0x1B, 0x19, 0x41, 0xBE, 0xA7, 0x15, 0xA7, 0x68, 0x3A, 0x3C, 0x5A, 0xA7, 0xA7,
-    0xF7, 0x13, 0x9B, 0x6D, 0x56, 0x0E, 0x4B, 0xF7, 0xB2, 0x91, 0x22, 0x5A, 0xA3, 0x76, 0x3E, 0x70,
-    0x46, 0x1E, 0x62, 0x84, 0x00, 0x8A, 0x3D, 0x2A, 0x99, 0xF1, 0x88, 0x24, 0xA4, 0x78, 0x6E, 0x40,
-    0x1F, 0xEC, 0x65, 0xFE, 0x81, 0xA0, 0x9A, 0xDE, 0xCC, 0x38, 0x24, 0xAE, 0xC0, 0x80, 0xB4, 0xBB,
-    0x57, 0xD4, 0x56, 0x32, 0xD3, 0x4D, 0x3C, 0x88, 0x06, 0x05, 0x10, 0x8D, 0x38, 0xE8, 0x0C, 0xAC,
-    0x0D, 0xB2, 0x79, 0x57, 0x9F, 0xCB, 0xEA, 0x33, 0x4D, 0x3E, 0x3B, 0xA9, 0x74, 0x2A, 0x52, 0x79,
-    0xEE, 0xFE, 0xF0, 0xC6, 0xF9, 0xBD, 0xE2, 0x50, 0xE5, 0x32, 0x30, 0x89, 0xBE, 0x9A, 0x10, 0x5D,
-    0x87, 0x99, 0x13, 0x54, 0x8D, 0xE7, 0xFC, 0x4B, 0x94, 0x2A, 0x3F, 0x1F, 0x53, 0x77, 0x03, 0x11,
-    0xF2, 0x31, 0x61, 0x81, 0xCF, 0x4B, 0x66, 0xAC, 0xA1, 0x0D, 0x0D, 0xCC, 0x55, 0x0A, 0xBB, 0x64,
-    0xF5, 0xD9, 0xAB, 0x3E, 0xC7, 0x53, 0x9F, 0x67, 0x47, 0x70, 0xBD, 0x8C, 0x0E, 0x6F, 0x9C, 0x1E,
-    0xB3, 0x93, 0xCF, 0xB5, 0xF4, 0x1C, 0x7B, 0x81, 0xF2, 0xDE, 0xCE, 0x29, 0xCD, 0xEB, 0x7C, 0xFC,
-    0xA5, 0xB4, 0xCF, 0xBE, 0x16, 0x3E, 0xA6, 0x80, 0x65, 0xF9, 0xF9, 0x45, 0xE8, 0x9E, 0xC2, 0x72,
-    0x08, 0x08, 0xBE, 0x35, 0xF8, 0xC1, 0xD8, 0x12, 0x78, 0xFB, 0x65, 0x65, 0x2F, 0x7E, 0xED, 0x0B,
-    0xF3, 0x25, 0x2F, 0x03, 0x97, 0x3D, 0x6B, 0x73, 0xEF, 0x8F, 0x9A, 0xDC, 0xEB, 0xEA, 0x50, 0xAD,
-    0x56, 0xC1, 0x49, 0xF7, 0x95, 0xA0, 0x9E, 0x9B, 0x23, 0x32, 0xB9, 0x5A, 0x24, 0xF1, 0x1F, 0x7D,
-    0x70, 0x71, 0x18, 0xAA, 0x63, 0x94, 0x05, 0xB4, 0x74, 0xB2, 0x9F, 0x54, 0x9C, 0x19, 0x5B, 0xDF,
-    0xAF, 0xC2, 0x61, 0xA5, 0x6F, 0x67, 0xC4, 0xEA, 0xDA, 0x25, 0x9B, 0x0A, 0xA9, 0x59, 0x92, 0xA5,
-    0xA1, 0x46, 0x1A, 0xE8, 0x19, 0x22, 0x89, 0x5E, 0x18, 0x7A, 0xAA, 0x17, 0xC8, 0x22, 0x74, 0x75,
-    0xDB, 0xDB, 0xED, 0xDD, 0x18, 0xAE, 0x59, 0x35, 0x66, 0x40, 0x4F, 0x46, 0x81, 0x61, 0x72, 0xDF,
-    0x67, 0x05, 0x20, 0xBD, 0x55, 0x17, 0x53, 0x5A, 0x93, 0xEF, 0xF1, 0xBC, 0x11, 0x4D, 0x5D, 0xC1,
-    0x8C, 0xCD, 0x15, 0xFD, 0x29, 0x57, 0x60, 0xF5, 0x20, 0xAC, 0x26, 0x61, 0x4E, 0x60, 0x0D, 0xFC,
-    0x10, 0xFB, 0x67, 0xF0, 0xB2, 0x6A, 0xA2, 0xC8, 0x37, 0x93, 0x86, 0xB1, 0xB9, 0x79, 0xA8, 0x18,
-    0x83, 0xD5, 0xE9, 0x40, 0xAD, 0x19, 0x0D, 0xC6, 0x03, 0x88, 0x30, 0x26, 0x8C, 0x4A, 0x80, 0x88,
-    0xDD, 0x66, 0x4A, 0x26, 0x12, 0x5F, 0xC5, 0x73, 0x2D, 0xE7, 0x03, 0xD4, 0xFD, 0xD0, 0x27, 0x94,
-    0x51, 0x95, 0x21, 0x98, 0x78, 0x80, 0x99, 0xBC, 0x0D, 0xC1, 0x98, 0x1C, 0x54, 0x7B, 0x74, 0x86,
-    0xAA, 0x12, 0xEC, 0x46, 0x6E, 0x4B, 0x57, 0xDA, 0xF2, 0xC6, 0xD8, 0x11, 0x1B, 0x0B, 0xC3, 0x67,
-    0xC3, 0xA8, 0x8D, 0xD9, 0xDB, 0x75, 0xF9, 0x23, 0x92, 0x9B, 0x06, 0x6F, 0x22, 0x37, 0x53, 0x83,
-    0x96, 0x2B, 0xDA, 0xBB, 0xBD, 0x6B, 0x9C, 0x49, 0xF1, 0x3E, 0x3C, 0xC9, 0xA4, 0x10, 0xCD, 0x41,
-    0xD4, 0x15, 0x8C, 0x13, 0x42, 0xFE, 0x38, 0x6C, 0xB2, 0x81, 0xD9, 0x60, 0xE0, 0x57, 0xC1, 0x80,
-    0x4D, 0x95, 0x17, 0x14, 0x55, 0x2D, 0xC8, 0x7E, 0xC3, 0xCB, 0xC5, 0x93, 0xE0, 0xD6, 0xAE, 0xFE,
-    0xC4, 0xE8, 0x9F, 0x6D, 0x5B, 0x16, 0xEE, 0x5A, 0x2B, 0xE8, 0x9E, 0x3C, 0x02, 0x82, 0x56, 0x74,
-    0xB8, 0x4C, 0x15, 0x1C, 0x9C, 0x20, 0x54, 0xC4, 0x41, 0xBE, 0xC5, 0xD9, 0xB6, 0xCD, 0xD0, 0xB4,
-    0x2D, 0x87, 0x61, 0x38, 0x52, 0xFE, 0x75, 0x9D, 0xBF, 0x57, 0xF0, 0x18, 0xD7, 0x1E, 0x8E, 0x06,
-    0x00, 0xAE, 0x06, 0x5A, 0x5E, 0x8E, 0x64, 0x0A, 0x1A, 0x62, 0xA8, 0x3F, 0xB2, 0x14, 0x70, 0x8C,
-    0x9F, 0x63, 0x57, 0xE2, 0x5F, 0x36, 0x73, 0x58, 0x6A, 0x38, 0x53, 0xF9, 0xA0, 0x28, 0xE8, 0xBE,
-    0x82, 0x6D, 0x80, 0x4B, 0xA0, 0xDC, 0xA2, 0x70, 0xBE, 0xF4, 0xDE, 0x3A, 0xE7, 0x17, 0x8B, 0x41,
-    0xD6, 0x16, 0x72, 0x20, 0x7C, 0x1D, 0xA6, 0xCC, 0xDE, 0xDA, 0x3D, 0x8A, 0x97, 0xA8, 0x17, 0xCA,
-    0x95, 0xE0, 0xFA, 0x96, 0x73, 0x50, 0xCF, 0x5D, 0x95, 0xA6, 0x9A, 0xE7, 0x74, 0x2A, 0x2A, 0x28,
-    0xD7, 0xD2, 0x5D, 0xE3, 0xBF, 0xF0, 0xCB, 0xE0, 0x6F, 0x49, 0xAC, 0x90, 0xD0, 0xFC, 0x13, 0x6E,
-    0x51, 0x0B, 0x5F, 0x6F, 0x3B, 0x71, 0xF8, 0x97, 0x3D, 0x31, 0xDC, 0xF2, 0x8A, 0x31, 0x17, 0x84,
-    0x1E, 0x61, 0x4E, 0x2E, 0xE6, 0xBB, 0x63, 0xB2, 0xB1, 0xF0, 0x0A, 0xBB, 0xAF, 0xBD, 0x8A, 0x79,
-    0xD5, 0xF0, 0xF1, 0x4A, 0x7E, 0x5D, 0xEC, 0x97, 0xD3, 0x70, 0xDF, 0x89, 0x9B, 0xCE, 0x82, 0x64,
-    0xEF, 0x82, 0xE7, 0xD7, 0x1C, 0xDB, 0xC9, 0xFC, 0x22, 0x2C, 0xEF, 0x5A, 0xB7, 0x9A, 0xF6, 0xD5,
-    0x7D, 0x4C, 0xDB, 0x5B, 0x00, 0xDF, 0x63, 0x12, 0x3C, 0x40, 0x0E, 0x1E, 0xFF, 0xC9, 0x9D, 0x22,
-    0x7F, 0xD7, 0xFD, 0x8D, 0x34, 0xAA, 0x2A, 0x5B, 0x40, 0x98, 0xD9, 0xB0, 0x98, 0x81, 0x34, 0xAB,
-    0x35, 0x9B, 0x9B, 0x8C, 0x45, 0x12, 0xB5, 0x48, 0x95, 0x05, 0x64, 0x11, 0x68, 0x39, 0x98, 0x0C,
-    0x48, 0xFE, 0xE5, 0xA6, 0x18, 0x72, 0xE5, 0xC7, 0xEE, 0x12, 0x35, 0x11, 0xB8, 0x35, 0x69, 0x1C,
-    0x89, 0x69, 0x79, 0x4C, 0xD4, 0xF0, 0x92, 0x2D, 0x11, 0xBB, 0xA7, 0x62, 0x32, 0xE5, 0x0A, 0x30,
-    0x3A, 0x0B, 0x8B, 0xC9, 0x21, 0x63, 0x62, 0xCD, 0xBE, 0x5D, 0xBF, 0xA7, 0xBB, 0x11, 0x45, 0xB5,
-    0x3E, 0x66, 0x7F, 0x98, 0x61, 0x42, 0x4D, 0xA9, 0xB9, 0x16, 0xA9, 0x08, 0xFD, 0x1C, 0x2C, 0x62,
-    0x26, 0x78, 0x6C, 0x18, 0xDF, 0xA7, 0x73, 0xFF, 0x02, 0xB5, 0x0E, 0x71, 0x87, 0xA6, 0x49, 0x82,
-    0x36, 0x1A, 0x4E, 0x35, 0x6F, 0x10, 0x0D, 0x77, 0xA9, 0xB5, 0x42, 0x46, 0xD5, 0x41, 0x96, 0xA1,
-    0x22, 0xEE, 0x80, 0xF2, 0x5E, 0x85, 0x35, 0xED, 0xAA, 0xE4, 0xF8, 0x7B, 0xE2, 0x42, 0xB9, 0xE7,
-    0x0C, 0x21, 0xC7, 0xFA, 0x67, 0xCA, 0x71, 0x12, 0x85, 0x38, 0x40, 0x09, 0xC9, 0x76, 0xEE, 0x20,
-    0x40, 0x8F, 0x97, 0xDC, 0x3A, 0x2A, 0x1E, 0xD3, 0x7A, 0x35, 0x74, 0xC6, 0xA3, 0x73, 0xC1, 0xBF,
-    0x61, 0xF5, 0xA0, 0x89, 0xDE, 0xFF, 0xEF, 0x3E, 0xED, 0xC0, 0x5F, 0x50, 0x5A, 0x14, 0xF0, 0x33,
-    0x49, 0x87, 0xFF, 0xC0, 0x3E, 0xCD, 0x50, 0xA8, 0x9D, 0x4D, 0x16, 0xCA, 0x76, 0x33, 0x6D, 0xBE,
-    0xD8, 0x51, 0x01, 0xB3, 0xC4, 0x94, 0x96, 0x26, 0xA3, 0xBB, 0xF4, 0xF3, 0x5C, 0x0C, 0x69, 0xA7,
-    0x71, 0xFE, 0x86, 0x0D, 0xB3, 0x71, 0x53, 0xD5, 0xFF, 0x9B, 0x1D, 0x17, 0xAC, 0x27, 0xE9, 0xC8,
-    0x29, 0x0F, 0x2C, 0x64, 0xC4, 0x75, 0xF0, 0x80, 0x7C, 0x8D, 0x0D, 0x76, 0x47, 0x6C, 0x01, 0x37,
-    0xB8, 0xE5, 0x12, 0x97, 0x4C, 0x5F, 0x23, 0x94, 0x7F, 0xFE, 0x3F, 0x81, 0xDA, 0xB8, 0xD9, 0xB6,
-    0x60, 0x16, 0x7B, 0x02, 0x57, 0xBC, 0x2B, 0xC8, 0x7E, 0xD4, 0xC3, 0x15, 0x29, 0xB6, 0x71, 0x85,
-    0xFB, 0x13, 0x9A, 0x7D, 0x79, 0x27, 0xF1, 0x73, 0xC7, 0x68, 0x2A, 0xA6, 0xD9, 0x3F, 0xF3, 0xE4,
-    0x55, 0x6B, 0x95, 0xAC, 0xF4, 0xC3, 0xE3, 0x62, 0x4C, 0xEE, 0x04, 0xC3, 0x8E, 0xF6, 0x5F, 0x7A,
-    0x3C, 0xF9, 0x85, 0xD2, 0x42, 0x87, 0x74, 0x80, 0xF0, 0x2B, 0xC1, 0x26, 0x3D, 0xD5, 0xA2, 0x1E,
-    0xA8, 0xC9, 0x3F, 0xC7, 0xF4, 0xE1, 0x7F, 0x29, 0x51, 0x0E, 0xA8, 0xEA, 0x7D, 0x76, 0x51, 0x26,
-    0x26, 0x1D, 0xAC, 0x96, 0x63, 0x63, 0x01, 0x7C, 0x9F, 0xA7, 0x8E, 0x72, 0x6E, 0xEE, 0x72, 0x0D,
-    0xE8, 0x5D, 0xE2, 0x6E, 0xD4, 0xFB, 0x1A, 0xD9, 0x6F, 0xA5, 0x8D, 0xA5, 0x16, 0x03, 0xC5, 0xC4,
-    0xB4, 0xC0, 0x15, 0xB5, 0xB4, 0x00, 0xF0, 0xFC, 0x8B, 0xB8, 0x02, 0xE5, 0xA0, 0x67, 0xC8, 0x57,
-    0x50, 0xD0, 0x06, 0x57, 0x41, 0x22, 0x42, 0x33, 0x69, 0xE9, 0xB9, 0xB2, 0x89, 0x41, 0x55, 0x71,
-    0x1F, 0x36, 0x99, 0x65, 0x6C, 0xD8, 0xB3, 0x65, 0x90, 0xA7, 0x7B, 0x86, 0x56, 0x8A, 0x22, 0x00,
-    0x24, 0xC6, 0xD1, 0x22, 0x6B, 0x51, 0xC9, 0xE5, 0x4B, 0xEC, 0xE6, 0xBE, 0x6A, 0xD3, 0xE0, 0x84,
-    0x12, 0x7F, 0xD3, 0x23, 0xF3, 0xA2, 0x14, 0xD6, 0x04, 0x66, 0x13, 0x6B, 0xE6, 0xBC, 0xFB, 0x45,
-    0xD5, 0x8C, 0x9A, 0x2E, 0x8D, 0x74, 0xDD, 0xBE, 0xA6, 0x73, 0xB6, 0x19, 0x35, 0x8E, 0x81, 0x76,
-    0xCD, 0x53, 0x88, 0x33, 0x64, 0x12, 0xDF, 0x48, 0x58, 0x53, 0x8B, 0xB8, 0x35, 0x96, 0x50, 0x2A,
-    0xB1, 0x3D, 0x4B, 0xDC, 0x34, 0x10, 0x4B, 0xCC, 0xBB, 0x2F, 0xAA, 0x45, 0xF8, 0x47, 0x01, 0x1D,
-    0xB6, 0x22, 0xDE, 0x38, 0x2F, 0x63, 0xED, 0xE0, 0x77, 0xBE, 0x0A, 0xF9, 0x8A, 0xF7, 0x1E, 0x17,
-    0xF1, 0x96, 0x67, 0xC0, 0x0E, 0xA2, 0x75, 0x4E, 0xBF, 0xC3, 0xE9, 0xDE, 0x05, 0x79, 0xC9, 0x16,
-    0xC5, 0xD8, 0xFD, 0x6B, 0x92, 0x58, 0xE4, 0xDE, 0x17, 0xDE, 0x23, 0x4B, 0x90, 0x22, 0xFE, 0xC5,
-    0x79, 0xD6, 0x66, 0x30, 0x8E, 0x8A, 0x96, 0x32, 0xBB, 0x59, 0xEA, 0x0C, 0xEF, 0xF4, 0x87, 0x1D,
-    0x68, 0xF7, 0xC1, 0x1B, 0x39, 0xF9, 0xFF, 0x0E, 0x89, 0x23, 0x2E, 0x1A, 0x46, 0x9C, 0xE4, 0x6D,
-    0xE7, 0x1E, 0xA5, 0x01, 0x56, 0xE7, 0x18, 0x0F, 0x5B, 0x16, 0x09, 0xBC, 0x38, 0x06, 0x0F, 0x72,
-    0xF4, 0xD8, 0x93, 0xBF, 0xB8, 0x09, 0xB4, 0xD8, 0x04, 0xBC, 0x4F, 0x35, 0x81, 0x55, 0x6B, 0x02,
-    0xD4, 0xE4, 0x1C, 0x36, 0x58, 0xFA, 0x7D, 0xDE, 0x64, 0xB3, 0xD9, 0x2A, 0xCD, 0xCE, 0xE7, 0xD1,
-    0x8B, 0xC0, 0x62, 0xA1, 0xDD, 0xC6, 0xB6, 0x7B, 0x43, 0x5F, 0x01, 0x8A, 0x25, 0x2A, 0xB0, 0xEB,
-    0xE0, 0xFE, 0x40, 0x82, 0x0F, 0x0C, 0x20, 0x7A, 0x8B, 0xD1, 0x6B, 0x59, 0x9B, 0x09, 0xA4, 0xF7,
-    0xA6, 0x42, 0x20, 0xB0, 0x71, 0xC7, 0xA2, 0xC3, 0xD4, 0xB3, 0x3F, 0x9A, 0x02, 0xFE, 0xBE, 0xC4,
-    0xF6, 0x1D, 0xBD, 0xEB, 0x4F, 0x68, 0x4F, 0xD3, 0x1A, 0xDE, 0x62, 0x17, 0x49, 0xAE, 0x60, 0x06,
-    0x89, 0x79, 0xC4, 0x32, 0x44, 0x7A, 0x4B, 0x92, 0xF3, 0x01, 0x04, 0xD9, 0xC6, 0xE0, 0x12, 0xD2,
-    0x6E, 0x08, 0x72, 0x26, 0x4E, 0x73, 0x63, 0x14, 0x55, 0xBD, 0xF2, 0x46, 0x29, 0x88, 0xD8, 0xA8,
-    0xB6, 0xDF, 0x4F, 0x1C, 0xC2, 0x94, 0x28, 0xFA, 0x64, 0xC7, 0xD1, 0x11, 0x17, 0x9F, 0xE2, 0x05,
-    0xE5, 0xBD, 0x9E, 0x53, 0x51, 0x70, 0x8B, 0xA1, 0x25, 0xA4, 0x00, 0x01, 0x94, 0xFD, 0x4D, 0x69,
-    0x6B, 0xD2, 0xC6, 0xC4, 0xF3, 0xAF, 0x63, 0x99, 0x1F, 0x40, 0x7A, 0x96, 0xF3, 0xEE, 0xC6, 0xE8,
-    0xD7, 0xB9, 0x1A, 0x91, 0x34, 0xFA, 0xEE, 0xD0, 0x76, 0xAA, 0x87, 0xD8, 0x2F, 0xC8, 0xB7, 0x0A,
-    0x71, 0xC4, 0x93, 0x90, 0x11, 0x7A, 0xD2, 0x47, 0x6C, 0x39, 0x90, 0x31, 0xE2, 0xC1, 0x97, 0x40,
-    0x8E, 0xF7, 0xB0, 0xAB, 0x39, 0xEA, 0x6C, 0x38, 0x08, 0x82, 0x8B, 0xD9, 0xE4, 0xA2, 0x6C, 0x7D,
-    0xDA, 0xF4, 0xA5, 0x77, 0xF3, 0xE9, 0x4B, 0x2A, 0x5D, 0x53, 0x7A, 0x1A, 0xBC, 0x91, 0x7B, 0x1B,
-    0x25, 0x98, 0x18, 0xF2, 0xCF, 0xE3, 0x89, 0xB7, 0x97, 0xB9, 0x79, 0x49, 0xD0, 0xA2, 0xF4, 0xF7,
-    0x4B, 0xDB, 0xF2, 0x98, 0xBC, 0xB2, 0xFB, 0x21, 0x1B, 0xA6, 0x88, 0xF6, 0x86, 0x24, 0x32, 0x64,
-    0xE8, 0xEC, 0xCE, 0x29, 0xA9, 0x43, 0xEE, 0x76, 0xFD, 0x7A, 0x59, 0x31, 0xBC, 0xC4, 0x62, 0xC3,
-    0xA3, 0xC3, 0x13, 0x5C, 0x1F, 0x30, 0xBE, 0xDF, 0x66, 0x9F, 0xE4, 0xCC, 0x20, 0x98, 0x9D, 0x30,
-    0xC0, 0x82, 0x59, 0x3D, 0xB6, 0xA9, 0xF4, 0xB9, 0x6F, 0xCB, 0x08, 0x5B, 0xC9, 0xDD, 0xA9, 0x8E,
-    0x2C, 0x82, 0xD8, 0x31, 0x12, 0x17, 0x32, 0xFE, 0x02, 0xE4, 0x0B, 0x3C, 0x39, 0xF6, 0x97, 0x9C,
-    0xE1, 0x16, 0xAA, 0xC7, 0xF2, 0xB7, 0x69, 0xC9, 0x57, 0x5E, 0x36, 0x60, 0xE4, 0xD9, 0xC3, 0x51,
-    0x90, 0x0B, 0xDA, 0xF6, 0x72, 0xD6, 0x20, 0x6C, 0xCE, 0x24, 0xBA, 0xDC, 0xF8, 0x8A, 0x10, 0xE4,
-    0xF3, 0x60, 0xFF, 0x89, 0x77, 0x36, 0xE5, 0x0E, 0x22, 0xCE, 0xD1, 0x20, 0x43, 0x3C, 0x7E, 0x66,
-    0xD5, 0xD2, 0x1C, 0x5B, 0xDC, 0x86, 0xD6, 0x27, 0x11, 0x6A, 0xF7, 0x5F, 0xF1, 0xB8, 0x22, 0x2C,
-    0x6C, 0x07, 0xB9, 0xAA, 0xFC, 0xC8, 0x16, 0x06, 0x1E, 0xD3, 0xE3, 0x59, 0xC8, 0x5C, 0xD2, 0x71,
-    0x91, 0x79, 0x99, 0x9B, 0x89, 0xFD, 0x14, 0xA9, 0x03, 0xD5, 0xE3, 0x4D, 0x67, 0x7F, 0x69, 0xD2,
-    0x97, 0x91, 0x79, 0x69, 0xF3, 0x84, 0x0E, 0x75, 0x0B, 0x1A, 0xB2, 0x39, 0x94, 0xC1, 0x05, 0x48,
-    0xBA, 0x0D, 0xAC, 0x53, 0x59, 0x50, 0x27, 0xC7, 0xF7, 0x99, 0xCD, 0x0B, 0xE5, 0x44, 0x88, 0x3E,
-    0x83, 0xFE, 0x66, 0x6A, 0x54, 0xBF, 0xE8, 0x4C, 0x60, 0x3F, 0x59, 0x65, 0x6E, 0x3E, 0x94, 0xF2,
-    0x58, 0x95, 0x66, 0x5B, 0xFF, 0x7A, 0x9D, 0x8F, 0xB7, 0xA4, 0xF3, 0xF2, 0x5F, 0x70, 0x81, 0xD0,
-    0x21, 0xAE, 0x86, 0x69, 0x00, 0xF7, 0x6E, 0x43, 0x30, 0x68, 0x8F, 0x14, 0x75, 0x00, 0x2C, 0x21,
-    0xD1, 0xA8, 0xA8, 0x68, 0xA3, 0x80, 0x92, 0xBE, 0x82, 0x6A, 0x88, 0x2B, 0x54, 0x3A, 0xA5, 0x93,
-    0xAE, 0x47, 0xBB, 0xA6, 0x74, 0x26, 0x2D, 0x64, 0x8F, 0x0B, 0x0D, 0xDB, 0x63, 0xA0, 0x67, 0x6A,
-    0xB6, 0xFB, 0xFC, 0xFB, 0x26, 0x52, 0xCF, 0xED, 0x3B, 0xFF, 0x4B, 0xC1, 0x59, 0x3E, 0x78, 0x2B,
-    0xC9, 0xEE, 0x56, 0xC5, 0x0A, 0x44, 0xD5, 0x5B, 0x99, 0x79, 0x85, 0x4D, 0xB6, 0xA4, 0x7B, 0x8B,
-    0x65, 0xD4, 0x1A, 0x16, 0x1F, 0x4E, 0xD7, 0x21, 0xF7, 0x1E, 0x50, 0x6F, 0xA0, 0x2A, 0xEC, 0x85,
-    0x19, 0x6F, 0x17, 0x89, 0xF7, 0x90, 0x9A, 0x5E, 0xD7, 0xD5, 0xB1, 0x67, 0x0F, 0x17, 0x5A, 0x2C,
-    0xAC, 0x0C, 0xE5, 0xFC, 0x75, 0x77, 0x18, 0x1A, 0x19, 0xAA, 0xF1, 0xE1, 0xD4, 0xC7, 0xFA, 0xDF,
-    0xF1, 0x54, 0xDF, 0x67, 0x27, 0x50, 0xE9, 0x45, 0xED, 0xFC, 0xE6, 0xB7, 0xF4, 0x8F, 0x92, 0x5A,
-    0x10, 0xC2, 0x6E, 0x1D, 0x33, 0xDA, 0xED, 0xA6, 0x18, 0x64, 0xEE, 0x99, 0x37, 0xED, 0x97, 0x3A,
-    0x1B, 0x6A, 0xFB, 0x33, 0x37, 0x39, 0x26, 0x41, 0xF8, 0xDA, 0xC6, 0x6E, 0x8B, 0x4D, 0xB2, 0x5D,
-    0x7F, 0xDB, 0xFB, 0xB2, 0x07, 0x4D, 0x3F, 0xC1, 0x67, 0x98, 0xF2, 0xDF, 0x5D, 0xE6, 0x96, 0x01,
-    0x22, 0xC0, 0xB6, 0x25, 0x03, 0xA8, 0x87, 0x50, 0xFC, 0x78, 0x8A, 0x01, 0x42, 0x49, 0x95, 0x62,
-    0x3F, 0x3A, 0xE7, 0x2A, 0xBB, 0x66, 0x93, 0x63, 0xBF, 0xA7, 0x01, 0x04, 0x59, 0x82, 0xF1, 0x2F,
-    0x5F, 0x45, 0xB5, 0x33, 0xE2, 0xBA, 0xAE, 0xB6, 0x04, 0x15, 0x3B, 0xB9, 0xA6, 0x8F, 0x32, 0x2E,
-    0xC6, 0x9A, 0xC3, 0x98, 0xE8, 0x79, 0x0D, 0x3D, 0xFC, 0x97, 0xCF, 0xF8, 0x03, 0xC6, 0x56, 0x70,
-    0xA1, 0xC5, 0x4D, 0xB8, 0xC8, 0x6A, 0x11, 0xDB, 0x9F, 0x95, 0x9A, 0x5B, 0x00, 0xF3, 0x40, 0x73,
-    0xC2, 0x98, 0xAD, 0xC2, 0xC7, 0x53, 0x89, 0x6B, 0x0E, 0xDC, 0xE2, 0xC9, 0x47, 0x34, 0xC8, 0x02,
-    0x9D, 0x8D, 0xE8, 0x6E, 0x18, 0x32, 0xE7, 0x85, 0x10, 0x30, 0x00, 0x67, 0x1F, 0xDB, 0xDE, 0x71,
-    0xC9, 0xBF, 0x9C, 0x51, 0xB1, 0x45, 0xBD, 0x88, 0x96, 0x82, 0xFD, 0x94, 0xFA, 0x93, 0xE3, 0x39,
-    0xC7, 0x52, 0x39, 0x1B, 0xD8, 0x1B, 0x9A, 0xB0, 0x9C, 0x05, 0x46, 0xAE, 0xDC, 0xC1, 0x45, 0xA2,
-    0x05, 0x15, 0x1C, 0x86, 0x65, 0x52, 0x32, 0x0C, 0xE4, 0x56, 0x74, 0x4D, 0x36, 0x87, 0x4C, 0xDF,
-    0xB3, 0xBD, 0x9B, 0x35, 0x4D, 0x30, 0xE2, 0x15, 0x37, 0xB9, 0x2D, 0xE2, 0x84, 0x7C, 0x37, 0x4A,
-    0xAA, 0x62, 0x25, 0x68, 0x4E, 0x0B, 0x3F, 0xA7, 0x38, 0xB3, 0x28, 0xBC, 0x4D, 0x16, 0x7D, 0x0B,
-    0xD9, 0x01, 0x29, 0x28, 0x70, 0xB5, 0x93, 0xF0, 0xAE, 0xC0, 0x20, 0x10, 0x69, 0xF9, 0xBC, 0xBD,
-    0x2F, 0xE1, 0xB1, 0x0F, 0xD0, 0xEA, 0x51, 0x6C, 0x55, 0xE2, 0x9F, 0xD7, 0x5E, 0x9E, 0xBE, 0xAA,
-    0xB9, 0x3F, 0xC1, 0xC8, 0xAE, 0x73, 0x9E, 0xB7, 0xED, 0x03, 0xC9, 0x50, 0xD4, 0x6C, 0x61, 0xF6,
-    0xC0, 0x35, 0xF9, 0xCA, 0x1D, 0x00, 0x68, 0x9B, 0xBB, 0x9B, 0x58, 0x19, 0x86, 0x3F, 0x7C, 0xC0,
-    0xBF, 0x28, 0xB7, 0xD2, 0x9F, 0xB9, 0x36, 0x82, 0x3F, 0xC8, 0xFB, 0x71, 0x17, 0x76, 0x1E, 0x76,
-    0x57, 0x47, 0x6E, 0x4F, 0x2E, 0xF2, 0x21, 0xB1, 0x83, 0x5D, 0x0E, 0x8A, 0xF1, 0x81, 0xC5, 0x53,
-    0x30, 0x15, 0x94, 0xE9, 0xDF, 0x2A, 0x7C, 0x15, 0x24, 0xC0, 0x26, 0x50, 0x33, 0xDC, 0xC5, 0xF4,
-    0xCA, 0x0A, 0x1C, 0x3E, 0x60, 0x87, 0x84, 0x34, 0x04, 0x3A, 0xD9, 0xB3, 0xD4, 0x0E, 0x12, 0xF6,
-    0xD0, 0x92, 0xE1, 0x09, 0x4D, 0x32, 0x7D, 0x2E, 0x38, 0xA0, 0xE7, 0x72, 0x26, 0x7E, 0x93, 0x16,
-    0x7B, 0x06, 0x29, 0x7D, 0xB9, 0x0E, 0x31, 0xB9, 0xEF, 0x52, 0xD8, 0x10, 0xD1, 0xE1, 0x86, 0xC2,
-    0x03, 0xBE, 0x1A, 0x04, 0x49, 0xFA, 0xB3, 0xFA, 0x5C, 0xF0, 0x48, 0xB7, 0xFB, 0x1D, 0xC4, 0xA6,
-    0x6B, 0x1B, 0xA3, 0x4D, 0xF0, 0x88, 0x63, 0x08, 0xCB, 0xFF, 0x91, 0x6C, 0xBB, 0xC9, 0xCD, 0x15,
-    0x69, 0x7D, 0x86, 0x5A, 0x97, 0xDD, 0x61, 0x15, 0x76, 0x50, 0x3D, 0x36, 0x67, 0x4C, 0xCE, 0x19,
-    0x8B, 0xAB, 0xED, 0x52, 0xC6, 0xD5, 0xFD, 0x63, 0xCD, 0x41, 0x7A, 0x04, 0x1D, 0x36, 0xBF, 0x82,
-    0x15, 0x8C, 0xF9, 0xBA, 0x2F, 0xAB, 0xF3, 0x54, 0x7D, 0x8F, 0x08, 0xA4, 0xD1, 0x8C, 0x09, 0xCD,
-    0x72, 0x1F, 0xCE, 0xE5, 0x26, 0x43, 0x34, 0x3E, 0x71, 0xC9, 0x02, 0xEB, 0x40, 0xC1, 0x5B, 0x89,
-    0xA5, 0x64, 0xA2, 0x6E, 0xFC, 0x74, 0x4F, 0xA1, 0x10, 0xD8, 0x7F, 0x27, 0x7D, 0xF5, 0x2D, 0x2A,
-    0x82, 0xD8, 0x57, 0xC7, 0xD6, 0x23, 0xC4, 0xBE, 0x9B, 0x8A, 0xEA, 0x4F, 0xD4, 0x5D, 0xEC, 0x3D,
-    0xDC, 0xE6, 0xEC, 0xDB, 0x92, 0xEB, 0x61, 0x0E, 0x03, 0x01, 0x97, 0x2C, 0xC7, 0x33, 0xF7, 0x75,
-    0x7C, 0xCB, 0x4D, 0xCB, 0x8E, 0xC9, 0x82, 0x49, 0x2B, 0x67, 0xA1, 0xE9, 0xF2, 0x38, 0x32, 0x6E,
-    0x21, 0x41, 0xBA, 0x07, 0x9F, 0x8D, 0xD8, 0xCC, 0xDA, 0x49, 0xEA, 0xC0, 0xAA, 0x3F, 0x13, 0xB1,
-    0x4F, 0xC1, 0x25, 0x30, 0xE5, 0xF2, 0x3B, 0xC9, 0x27, 0x70, 0xA9, 0xC2, 0x7C, 0xE7, 0x45, 0xC0,
-    0x9A, 0x42, 0x91, 0x33, 0x53, 0xA7, 0x7A, 0x47, 0x4E, 0x51, 0xF7, 0xAF, 0x8C, 0x0A, 0x47, 0xF3,
-    0x19, 0x22, 0xCB, 0xA0, 0x8A, 0xA9, 0xB1, 0x8D, 0xBF, 0x58, 0x71, 0x85, 0xDB, 0x44, 0x09, 0x42,
-    0x8A, 0xB6, 0xCD, 0x21, 0x56, 0xCB, 0x6A, 0xD5, 0x03, 0xCA, 0x01, 0xD3, 0x50, 0x6E, 0xE3, 0x78,
-    0xCC, 0x78, 0x22, 0xCB, 0x88, 0x0E, 0xA6, 0xF3, 0x53, 0xF9, 0x10, 0x75, 0xDE, 0x23, 0x1F, 0x9B,
-    0x3A, 0x77, 0xF7, 0xA4, 0x89, 0xB1, 0x92, 0x2A, 0x91, 0xC4, 0x3C, 0x4F, 0x88, 0x7C, 0x92, 0x33,
-    0x51, 0xB4, 0x1C, 0x74, 0x1B, 0xBC, 0x5B, 0xB6, 0xBD, 0x81, 0x97, 0x7D, 0xF4, 0xE3, 0xCE, 0xB0,
-    0xBF, 0x3B, 0xF2, 0xF2, 0xC9, 0x5C, 0x8C, 0xF7, 0xA4, 0x69, 0xC8, 0xA7, 0x4C, 0xC9, 0x4C, 0xB7,
-    0x3F, 0x74, 0xCC, 0x95, 0x73, 0xE4, 0xE7, 0x16, 0xF0, 0x92, 0xB8, 0xED, 0x49, 0x31, 0x8C, 0xCD,
-    0xE7, 0x06, 0xCF, 0x16, 0x77, 0x93, 0xAD, 0xC4, 0x56, 0xF4, 0x1E, 0xF6, 0xCA, 0x67, 0xB6, 0x08,
-    0x9F, 0xE3, 0x83, 0xDA, 0x12, 0xF9, 0xB2, 0xC3, 0xBD, 0x78, 0x45, 0xB5, 0xB7, 0x56, 0xA4, 0xCB,
-    0x37, 0x7A, 0xAA, 0xE0, 0xB9, 0x75, 0x71, 0x9D, 0xE6, 0xE9, 0x17, 0xFF, 0x6D, 0x0C, 0xD8, 0x43,
-    0xA8, 0x53, 0x5F, 0x35, 0xD2, 0x9E, 0xFC, 0x13, 0x6A, 0xCF, 0x43, 0x99, 0x8C, 0x66, 0xF3, 0x2F,
-    0x81, 0xF4, 0xBD, 0xF5, 0x33, 0x44, 0xEE, 0x79, 0x7E, 0xDC, 0x05, 0x64, 0xCC, 0xDD, 0x53, 0x75,
-    0xC5, 0x79, 0xF7, 0x57, 0x05, 0xB9, 0x03, 0xC2, 0x01, 0xDE, 0xBB, 0x70, 0x94, 0xDC, 0xDD, 0x8C,
-    0x8E, 0x1D, 0xB3, 0x01, 0xDD, 0xB5, 0x2C, 0x24, 0x52, 0xFE, 0x8B, 0x43, 0x3E, 0x11, 0xC7, 0x54,
-    0x0E, 0x8A, 0x8A, 0x05, 0xFC, 0x9D, 0x09, 0xAE, 0xCD, 0x02, 0xD5, 0x76, 0x50, 0xA7, 0xFD, 0xB9,
-    0x6C, 0x8B, 0xE7, 0xDE, 0x30, 0x17, 0x86, 0x61, 0xBE, 0x34, 0x65, 0x77, 0x4C, 0x23, 0xD7, 0x90,
-    0x21, 0xA2, 0xBD, 0xB2, 0xA6, 0x91, 0xF7, 0x7E, 0x95, 0x46, 0xC3, 0xAF, 0xE3, 0xF7, 0xF3, 0xD9,
-    0xA2, 0x53, 0x0C, 0x99, 0x09, 0xF9, 0x27, 0x1A, 0x1A, 0x79, 0xCB, 0x1A, 0x7C, 0x79, 0x1B, 0x49,
-    0x6E, 0xB2, 0x91, 0x56, 0x15, 0x28, 0xAA, 0xC3, 0xDF, 0x80, 0xA9, 0x6F, 0xD3, 0xA9, 0xBB, 0x15,
-    0xE1, 0x3A, 0x64, 0x1F, 0x3D, 0x3A, 0x5B, 0x85, 0xC6, 0x0F, 0xEB, 0xF3, 0x9D, 0xF1, 0x69, 0x4F,
-    0xFD, 0xB1, 0x3E, 0xBC, 0xB6, 0x07, 0x3E, 0x53, 0x27, 0x3E, 0xAC, 0x15, 0xC0, 0xFF, 0xB6, 0x01,
-    0x27, 0xEA, 0x0F, 0xC3, 0x0C, 0xF2, 0x9D, 0x03, 0x94, 0x7D, 0x08, 0x2B, 0x64, 0xC0, 0x0F, 0x7E,
-    0x94, 0x64, 0xB8, 0xE9, 0x24, 0x5B, 0xB0, 0x4F, 0xB0, 0x9C, 0x4B, 0x10, 0x36, 0x50, 0x5B, 0x05,
-    0xD6, 0xDA, 0x16, 0x82, 0x9F, 0xF7, 0x38, 0x9F, 0x15, 0xFC, 0x70, 0x4A, 0x1C, 0xBC, 0x90, 0x10,
-    0x8A, 0xFF, 0x01, 0x9F, 0xAD, 0x6A, 0xFF, 0xC7, 0x50, 0xED, 0x5D, 0x2E, 0x87, 0xA1, 0x13, 0x73,
-    0x00, 0x24, 0x29, 0x7E, 0x38, 0xA2, 0x43, 0xD3, 0xA1, 0xA3, 0x7A, 0xB1, 0x48, 0xF6, 0xD8, 0x7B,
-    0x11, 0xF1, 0xD0, 0xBD, 0x82, 0xEF, 0x2F, 0xB8, 0x53, 0xD5, 0x55, 0x94, 0xC4, 0xCE, 0xEF, 0x0D,
-    0x6A, 0xFF, 0xBC, 0xCD, 0x95, 0x54, 0x01, 0x04, 0xDC, 0x3C, 0x4A, 0x00, 0xEF, 0x01, 0xF0, 0xF1,
-    0xCB, 0x45, 0xD4, 0x59, 0x60, 0x58, 0xBF, 0x7B, 0xE3, 0x62, 0xE2, 0x5D, 0x12, 0xC7, 0xA1, 0x2F,
-    0x50, 0x8C, 0x92, 0x21, 0xB7, 0x87, 0xC7, 0xD3, 0xDC, 0x63, 0x41, 0xC5, 0x9B, 0x3B, 0xB5, 0x30,
-    0xAF, 0x85, 0x0A, 0x01, 0x98, 0xDD, 0x91, 0xEF, 0x98, 0x22, 0x3A, 0x08, 0x33, 0xA7, 0x74, 0xAB,
-    0x9E, 0x1B, 0xF8, 0xAB, 0xE2, 0x46, 0x17, 0xC4, 0x5A, 0xC2, 0x0E, 0x05, 0x97, 0xEA, 0xA6, 0x33,
-    0x17, 0xDC, 0x1C, 0xF7, 0x6F, 0x7A, 0x3A, 0x03, 0x17, 0x7E, 0x4B, 0xF5, 0xA3, 0x6E, 0x54, 0x37,
-    0x96, 0x79, 0x1B, 0x7F, 0x01, 0x1E, 0x92, 0xB3, 0xE9, 0x9E, 0x1D, 0x6B, 0xB2, 0x86, 0xCD, 0x34,
-    0xC8, 0x1B, 0x7C, 0x72, 0x15, 0xA8, 0x45, 0x7B, 0x96, 0xE7, 0x65, 0x31, 0x2C, 0xE4, 0x59, 0x30,
-    0x73, 0x54, 0xA4, 0x57, 0x32, 0x72, 0x7E, 0x85, 0xEF, 0x5E, 0x83, 0x64, 0xEF, 0x56, 0xE7, 0x9E,
-    0xAE, 0x1E, 0xA7, 0x98, 0x3F, 0xDD, 0xAE, 0x48, 0x43, 0x8B, 0xD3, 0x64, 0xF0, 0x08, 0x6A, 0xFB,
-    0x7C, 0x48, 0xFC, 0x3C, 0xDA, 0xE4, 0xE9, 0x08, 0xEA, 0x3E, 0x66, 0xB2, 0xB4, 0xE8, 0x27, 0xF0,
-    0x21, 0x05, 0x7F, 0x29, 0xEC, 0x59, 0x07, 0xA7, 0x3B, 0x2E, 0x61, 0x90, 0x41, 0xA3, 0xB8, 0xC6,
-    0xFA, 0x5C, 0xDD, 0xA1, 0xBB, 0xE9, 0x19, 0x05, 0x38, 0x3C, 0x72, 0x7D, 0x9D, 0xC4, 0x90, 0x98,
-    0xF8, 0x70, 0x24, 0xAA, 0x08, 0x5D, 0x53, 0x7E, 0x20, 0x3D, 0x83, 0x24, 0x0F, 0xDD, 0xFD, 0x8D,
-    0xA1, 0xA7, 0x50, 0x82, 0x29, 0x3F, 0x73, 0xAC, 0xD6, 0x4B, 0xD5, 0xF1, 0xA5, 0x5B, 0x33, 0x8A,
-    0xB0, 0x3E, 0x82, 0x2D, 0xED, 0xF3, 0x5C, 0x67, 0xC1, 0xA6, 0xC1, 0x93, 0xDD, 0x1C, 0xA9, 0x3D,
-    0xEB, 0x98, 0xA9, 0xF2, 0xF9, 0xD9, 0xEA, 0x49, 0x30, 0x26, 0x61, 0x4D, 0x49, 0xE9, 0x5F, 0xBD,
-    0x5F, 0x98, 0xD5, 0xC5, 0x27, 0xCB, 0x63, 0xD0, 0xC1, 0x57, 0x55, 0x65, 0xE6, 0xE8, 0xAA, 0xEE,
-    0x98, 0xEB, 0x9C, 0x3C, 0x8E, 0x72, 0x4B, 0xA7, 0x7A, 0xFC, 0x48, 0x23, 0xAF, 0xBC, 0x53, 0xB7,
-    0x39, 0xE9, 0xF6, 0x4B, 0x09, 0x3A, 0xC3, 0xDD, 0x00, 0x59, 0xF5, 0xC9, 0x6F, 0x51, 0x3E, 0x7B,
-    0xC0, 0x0B, 0x2E, 0xF0, 0x28, 0xEE, 0x7C, 0x4B, 0x72, 0xEF, 0xAF, 0x3A, 0x4D, 0xBE, 0xFD, 0x48,
-    0x7E, 0x1A, 0x55, 0xBC, 0x45, 0x49, 0xEB, 0x42, 0xF3, 0x06, 0xFB, 0xF0, 0x1D, 0xF5, 0xC3, 0x91,
-    0xF5, 0xD3, 0x5B, 0x55, 0x9F, 0xA9, 0xD5, 0x74, 0x6E, 0xDA, 0x4D, 0x1F, 0xA7, 0xD7, 0x74, 0x9F,
-    0x9A, 0xFB, 0xAC, 0x25, 0xF1, 0xFA, 0xF6, 0xD9, 0xA6, 0x8F, 0xDD, 0xC7, 0x4F, 0x69, 0x5E, 0xC6,
-    0xE5, 0xCE, 0x90, 0x9F, 0x01, 0xC5, 0xC0, 0xFF, 0x01, 0x55, 0x8F, 0x21, 0x4F, 0xC3, 0x40, 0x18,
-    0x86, 0xBF, 0xBB, 0xEB, 0xDA, 0xAC, 0xCD, 0x76, 0x35, 0x24, 0x08, 0xA0, 0x7F, 0x60, 0xA5, 0x06,
-    0x31, 0x71, 0x5D, 0x4B, 0xEA, 0x50, 0x13, 0xFC, 0x02, 0xE4, 0xD4, 0x44, 0xC5, 0x44, 0x81, 0x5B,
-    0xC0, 0x61, 0xF6, 0x23, 0x30, 0x73, 0x88, 0x89, 0x89, 0x35, 0xED, 0x40, 0x20, 0x66, 0xEE, 0x1F,
-    0x70, 0x68, 0x02, 0x29, 0xA4, 0x09, 0x10, 0xBA, 0x8D, 0xDB, 0x12, 0x04, 0x6F, 0x5E, 0xF3, 0x88,
-    0x2F, 0xDF, 0xF3, 0x02, 0xE6, 0x09, 0x29, 0x28, 0x6F, 0x81, 0x0A, 0xB3, 0xE6, 0x05, 0x33, 0x60,
-    0x1B, 0x0F, 0x1C, 0xE1, 0xCC, 0x28, 0xA5, 0x48, 0x6C, 0x30, 0x38, 0xC9, 0xDE, 0x9E, 0x2B, 0xE8,
-    0xF6, 0xC6, 0xD9, 0x6A, 0xC3, 0x7D, 0x92, 0x1E, 0x04, 0x95, 0x35, 0x72, 0x2F, 0x52, 0xBB, 0x86,
-    0xA2, 0xA2, 0xEA, 0x50, 0x1E, 0xDA, 0x3A, 0x5F, 0x2F, 0xE8, 0x2E, 0x23, 0x79, 0x82, 0x72, 0x00,
-    0x34, 0xA2, 0x65, 0x8B, 0xB5, 0x55, 0xBD, 0x42, 0xE7, 0xEA, 0x28, 0x6E, 0xD3, 0x9B, 0x87, 0xF7,
-    0x72, 0xE6, 0x37, 0x8D, 0x70, 0xFB, 0x64, 0x9F, 0x3C, 0x5E, 0x89, 0x4F, 0xE1, 0x08, 0x2C, 0x15,
-    0x1D, 0xF5, 0xA7, 0x93, 0x64, 0xC0, 0x58, 0x63, 0x4F, 0x81, 0x8D, 0xD6, 0xC3, 0x9F, 0x52, 0xBA,
-    0x36, 0x56, 0xD0, 0xB2, 0x8E, 0xA5, 0x4F, 0x44, 0x80, 0xB8, 0x69, 0xC8, 0x2F, 0xDF, 0xA1, 0x16,
-    0xD4, 0xE9, 0xE2, 0x5E, 0xC4, 0x4D, 0x94, 0x6B, 0x2E, 0x63, 0xF1, 0x1D, 0xE8, 0x3C, 0xA1, 0xC3,
-    0xA2, 0x0D, 0xB0, 0x31, 0xAA, 0xE3, 0x3F, 0x23, 0x33, 0x7A, 0xED, 0xBF, 0x34, 0x82, 0xBC, 0xAB,
-    0x47, 0x72, 0xCA, 0x5C, 0x0D, 0x4C, 0x9E, 0x62, 0x31, 0x38, 0x44, 0x21, 0x02, 0xC1, 0x8C, 0xF0,
-    0x3C, 0xAA, 0x00, 0x4C, 0x32, 0x97, 0x13, 0x56, 0xDB, 0xEE, 0x84, 0x40, 0x76, 0x7C, 0x9F, 0x5C,
-    0x2B, 0x03, 0x28, 0xCC, 0x65, 0x72, 0x59, 0xEA, 0xCA, 0xD5, 0xD3, 0xB3, 0xA7, 0x8F, 0x65, 0xF7,
-    0x76, 0xE7, 0x34, 0x5B, 0xF5, 0xC6, 0xFF, 0xE4, 0x08, 0x60, 0x89, 0x0A, 0x28, 0x61, 0x02, 0x36,
-    0xE6, 0x67, 0x65, 0x5A, 0x79, 0x1A, 0x02, 0x8D, 0x92, 0xFC, 0x3B, 0x80, 0x5F, 0xC5, 0x7C, 0x5D,
-    0x8C, 0xDC, 0x56, 0x76, 0xE6, 0x21, 0x29, 0x35, 0x6D, 0xD1, 0xD6, 0x55, 0x00, 0x6B, 0x76, 0x62,
-    0x59, 0x4D, 0x3D, 0x78, 0x80, 0x89, 0xD1, 0x5D, 0x9C, 0x87, 0x09, 0x22, 0x64, 0xC8, 0x22, 0x2D,
-    0x4D, 0xE0, 0x2C, 0x84, 0x5D, 0x6B, 0x13, 0xD5, 0x4C, 0x10, 0x27, 0xB1, 0x1F, 0x13, 0x24, 0xBB,
-    0xD2, 0x83, 0x91, 0xF4, 0x06, 0x6C, 0x15, 0x6D, 0xED, 0x62, 0x10, 0x0C, 0xB0, 0x6E, 0xE4, 0x67,
-    0xF3, 0x34, 0xB3, 0x5E, 0xC0, 0x0F, 0x4E, 0x2B, 0x49, 0x2B, 0x9B, 0x4E, 0x50, 0x33, 0xA9, 0xEE,
-    0xA2, 0xAC, 0x87, 0x01, 0x62, 0x20, 0xA6, 0x2D, 0x38, 0x79, 0x30, 0x26, 0xA6, 0x6D, 0x79, 0x66,
-    0xA0, 0xC6, 0x44, 0xD7, 0x31, 0x15, 0xB3, 0x25, 0x56, 0xDD, 0xFD, 0xCE, 0x25, 0xEB, 0xA7, 0x65,
-    0xC9, 0x91, 0x6D, 0xC9, 0xD3, 0x72, 0xB5, 0x54, 0x45, 0xD6, 0xBD, 0xE7, 0x9E, 0x7B, 0xCE, 0x77,
-    0xBE, 0x73, 0xEE, 0xA1, 0x89, 0xF6, 0x11, 0x51, 0x0B, 0x2F, 0x27, 0xC7, 0xAF, 0x01, 0x5E, 0x46,
-    0x42, 0xFC, 0xB3, 0xBB, 0xD3, 0x39, 0x6E, 0x29, 0x55, 0x91, 0xBB, 0xBA, 0x46, 0x76, 0x6A, 0x25,
-    0xA6, 0xA4, 0x94, 0x7A, 0xB8, 0x12, 0xE0, 0x25, 0xF0, 0xB2, 0x2F, 0xBF, 0x48, 0xA6, 0x1A, 0x11,
-    0x95, 0xB3, 0x1F, 0xA6, 0x46, 0x8A, 0x3B, 0x25, 0x3E, 0x5C, 0x32, 0x06, 0x6A, 0x68, 0x28, 0xA5,
-    0xF0, 0xF1, 0xB9, 0x45, 0xA2, 0x0D, 0x37, 0x21, 0xCF, 0xCE, 0x68, 0xFC, 0xB3, 0xBF, 0xD3, 0x89,
-    0x84, 0x52, 0x92, 0x4E, 0xAF, 0xF6, 0xC9, 0xA5, 0xBD, 0xE4, 0xA4, 0x16, 0x99, 0x2C, 0x46, 0x81,
-    0x97, 0x8F, 0x97, 0xBB, 0xFA, 0x3C, 0x39, 0xAA, 0x24, 0x6B, 0xC7, 0x87, 0x64, 0xF3, 0x9D, 0xA9,
-    0x95, 0x1B, 0xF9, 0x9C, 0x52, 0x85, 0xCD, 0x42, 0x62, 0xAC, 0xE3, 0x5D, 0xA5, 0xCA, 0xEF, 0xAE,
-    0xAD, 0x16, 0xD2, 0xA5, 0x73, 0xB9, 0x47, 0x32, 0x6A, 0x53, 0xA4, 0xE5, 0xE2, 0x6F, 0x9D, 0x56,
-    0x29, 0x0D, 0x30, 0x57, 0x69, 0x96, 0x18, 0xA9, 0x32, 0x24, 0xF5, 0xF1, 0x8A, 0x21, 0x6A, 0x8C,
-    0xD1, 0xFB, 0x07, 0x4A, 0x2A, 0x07, 0x15, 0xCF, 0x81, 0x4F, 0xC8, 0xCA, 0xE8, 0xCB, 0x10, 0x36,
-    0x1C, 0x12, 0x79, 0xF9, 0x58, 0xDC, 0x7B, 0xF0, 0xEA, 0x63, 0x81, 0x15, 0x3E, 0xC4, 0x22, 0x1E,
-    0xAE, 0x3F, 0xED, 0x74, 0x3A, 0xC4, 0x4B, 0x74, 0x57, 0x37, 0x21, 0x59, 0x8B, 0x3C, 0x5A, 0xC4,
-    0xEF, 0x05, 0x3D, 0x2F, 0xBF, 0xE2, 0xFA, 0x5B, 0x5A, 0x47, 0xBC, 0x02, 0x8C, 0x8E, 0x79, 0xEB,
-    0x59, 0x30, 0xF4, 0x81, 0x6D, 0xA2, 0xEE, 0x88, 0xB5, 0xFE, 0x5B, 0xF8, 0x87, 0xCA, 0xC4, 0xBB,
-    0x83, 0xA4, 0xA2, 0x45, 0x91, 0xD2, 0xB9, 0x98, 0xCC, 0x33, 0x19, 0x2F, 0x97, 0x68, 0xF3, 0x6C,
-    0x8E, 0xAD, 0x88, 0x04, 0x76, 0xA6, 0x8D, 0xB7, 0x95, 0xFE, 0xFE, 0x9C, 0x9D, 0x93, 0x2F, 0x72,
-    0x5B, 0x42, 0x87, 0x91, 0xA3, 0x1A, 0x39, 0xE7, 0xFE, 0x98, 0x3C, 0x95, 0x79, 0xBF, 0x50, 0xB8,
-    0xB4, 0xE8, 0xA4, 0x8E, 0x29, 0x8D, 0x68, 0x03, 0x3B, 0x93, 0x93, 0xA1, 0x22, 0x12, 0x90, 0xA2,
-    0x9B, 0x90, 0x25, 0x0F, 0xD1, 0xF2, 0x41, 0x12, 0xC7, 0x22, 0xFB, 0x25, 0x69, 0xE5, 0x83, 0xB3,
-    0xD2, 0x56, 0xF5, 0xB6, 0x74, 0x4E, 0x58, 0x2A, 0x37, 0x4A, 0xEC, 0x22, 0x16, 0x82, 0xCD, 0x86,
-    0x22, 0x44, 0x84, 0x35, 0x60, 0x3A, 0x4C, 0x1E, 0xB0, 0xF8, 0xF5, 0xA5, 0x92, 0x0E, 0x94, 0x86,
-    0xC2, 0x82, 0x16, 0x1C, 0x0A, 0x8F, 0x65, 0xE2, 0x25, 0x39, 0xD9, 0x54, 0x12, 0x2A, 0xA1, 0xD3,
-    0x5A, 0x70, 0x27, 0xD5, 0xFB, 0x59, 0x68, 0x55, 0xD4, 0xEF, 0xAD, 0xFA, 0xBD, 0x3F, 0xF3, 0x7E,
-    0x6E, 0x44, 0xF5, 0xFC, 0x9D, 0x13, 0x44, 0xD8, 0x6D, 0x82, 0xEA, 0x79, 0x5A, 0xBD, 0x74, 0xAF,
-    0x31, 0xCF, 0xDB, 0xD4, 0xA7, 0x95, 0xB2, 0x09, 0xEA, 0xAF, 0xB7, 0x37, 0x89, 0x42, 0xDC, 0xB6,
-    0x67, 0x65, 0xBC, 0x4F, 0xB0, 0x56, 0x36, 0x57, 0x3A, 0xFD, 0x04, 0xCF, 0xE6, 0xF3, 0x7D, 0xE4,
-    0x3B, 0xFC, 0x7B, 0x89, 0x55, 0x4B, 0xE7, 0x78, 0x52, 0x92, 0x6C, 0xC6, 0x46, 0xEE, 0x62, 0x15,
-    0x66, 0xEA, 0xAD, 0x15, 0x18, 0xB3, 0x0D, 0x95, 0x3B, 0x51, 0x80, 0xC9, 0x05, 0x24, 0xF7, 0xB1,
-    0xC5, 0xB1, 0xFE, 0xD3, 0xA3, 0xDE, 0xCF, 0x16, 0x30, 0x29, 0x19, 0xC2, 0x12, 0x07, 0x69, 0x18,
-    0xB9, 0x6A, 0x7B, 0x6C, 0x2E, 0x9D, 0xE3, 0xBB, 0x31, 0xA3, 0x2A, 0xBC, 0x11, 0x2F, 0x08, 0x7B,
-    0x85, 0xE5, 0xB0, 0x74, 0x9E, 0x96, 0xAF, 0xC5, 0x6B, 0xC7, 0x82, 0x9C, 0x84, 0x7F, 0xF3, 0xBC,
-    0xB0, 0x5E, 0xCC, 0x38, 0x50, 0x0A, 0x33, 0x96, 0xB8, 0xCE, 0xC6, 0xD8, 0xC6, 0x35, 0x89, 0x57,
-    0x80, 0x25, 0x62, 0x5E, 0x36, 0x56, 0xEA, 0x63, 0x99, 0x3D, 0xA3, 0x38, 0x50, 0x9A, 0x6A, 0x90,
-    0x75, 0x2B, 0xA1, 0x86, 0x53, 0x77, 0xFA, 0x08, 0x17, 0xD8, 0xCF, 0x2E, 0x20, 0x69, 0xB0, 0x55,
-    0x62, 0x64, 0x1E, 0x9B, 0xCD, 0xBF, 0x67, 0xB0, 0x43, 0x48, 0x2A, 0xE0, 0x4B, 0xF2, 0x40, 0x69,
-    0x6F, 0x0F, 0x2A, 0x97, 0x15, 0x64, 0xF2, 0x78, 0xCB, 0xEC, 0xD1, 0xAC, 0x5E, 0xFE, 0x64, 0xAE,
-    0x99, 0x04, 0x6B, 0x7A, 0x10, 0x7E, 0x61, 0x0E, 0xB1, 0xA6, 0x90, 0xFD, 0x27, 0x87, 0xEA, 0xB1,
-    0x3F, 0xCE, 0x33, 0xB8, 0x33, 0x60, 0xCD, 0x15, 0xE7, 0xB0, 0x03, 0x57, 0xB0, 0x2C, 0x8F, 0xC1,
-    0xA4, 0x0C, 0xD8, 0x9B, 0xB0, 0x61, 0xC2, 0xC0, 0x6E, 0xC5, 0x96, 0xC4, 0xED, 0x80, 0x00, 0x91,
-    0x88, 0xD4, 0x18, 0xAC, 0xB8, 0x29, 0xB4, 0xEC, 0xA5, 0xCD, 0xD8, 0xBB, 0xF4, 0x6F, 0x6D, 0x48,
-    0x42, 0x9B, 0x63, 0x97, 0xB7, 0x63, 0xEC, 0x68, 0x6C, 0x1E, 0x06, 0x03, 0x46, 0xD4, 0xE5, 0xC9,
-    0x69, 0x83, 0xF7, 0x5D, 0xB0, 0x31, 0x5A, 0x25, 0x5B, 0x99, 0xE2, 0x85, 0x06, 0x12, 0xB3, 0x09,
-    0x97, 0x67, 0x82, 0x45, 0x3A, 0xE7, 0x25, 0xDC, 0xA5, 0x5C, 0x62, 0x2B, 0xFE, 0x0D, 0xB6, 0x9C,
-    0xEB, 0x09, 0xB4, 0xEE, 0x42, 0x7F, 0x64, 0x16, 0xDA, 0x44, 0xD8, 0x86, 0xE0, 0xFA, 0xDD, 0x15,
-    0x18, 0xA0, 0xA7, 0x9A, 0x79, 0x0E, 0x59, 0xF0, 0x94, 0xE8, 0x14, 0xBE, 0x89, 0x85, 0xD9, 0xD8,
-    0x14, 0xDA, 0x1D, 0x4D, 0xF7, 0xD4, 0x53, 0xA6, 0xCA, 0xBB, 0x91, 0x9D, 0xEB, 0xDD, 0x70, 0x79,
-    0x98, 0xC2, 0xC8, 0xB1, 0x22, 0x98, 0x74, 0xDF, 0x89, 0xC8, 0x3E, 0x8F, 0xAD, 0x0E, 0xF0, 0xC6,
-    0xDC, 0x62, 0x13, 0xCE, 0x6B, 0x7F, 0xD5, 0x5B, 0x8C, 0xDB, 0xE8, 0x8B, 0x10, 0xC3, 0xE2, 0x99,
-    0xC2, 0x64, 0xBA, 0x2E, 0x68, 0x35, 0x1C, 0xDA, 0x2A, 0x85, 0xE7, 0x75, 0xD9, 0xDD, 0x60, 0x8D,
-    0x1E, 0xFB, 0x1E, 0xAC, 0x83, 0x17, 0xC4, 0xA2, 0x17, 0xEC, 0x09, 0xD3, 0x2B, 0x22, 0x31, 0xC6,
-    0x57, 0x24, 0xFB, 0x47, 0xCC, 0x13, 0x4C, 0xAF, 0x1C, 0x80, 0xA1, 0xC3, 0x18, 0x19, 0x5C, 0x35,
-    0x62, 0xE8, 0xE9, 0xB5, 0xF9, 0x11, 0x69, 0xA0, 0xF8, 0xF2, 0x54, 0xE1, 0xF4, 0x14, 0x69, 0x4F,
-    0x84, 0x48, 0xB8, 0xC9, 0xE2, 0xDD, 0x3E, 0xC8, 0x30, 0xFF, 0x1E, 0xBE, 0x6B, 0x1F, 0xC5, 0xE7,
-    0x3E, 0xBE, 0x6C, 0x66, 0x01, 0xE3, 0x3B, 0x3E, 0xDF, 0xFE, 0x1A, 0x30, 0x40, 0x01, 0x4D, 0x83,
-    0xCE, 0xC9, 0x08, 0x7A, 0x0F, 0x18, 0xF6, 0x4B, 0xC6, 0x0A, 0xE9, 0x5C, 0x22, 0xF7, 0x92, 0x92,
-    0x16, 0x66, 0xED, 0xC0, 0x97, 0x15, 0x4C, 0xD3, 0xD5, 0xD0, 0xEE, 0x43, 0xB4, 0xC3, 0x10, 0x73,
-    0xDF, 0xC4, 0x8D, 0xBB, 0xD8, 0xAE, 0xCD, 0xB5, 0x1C, 0xD6, 0x57, 0x10, 0xDB, 0xFB, 0x0E, 0x5B,
-    0xB4, 0xF2, 0x03, 0xA3, 0x41, 0xD2, 0x65, 0x28, 0xD0, 0x90, 0xF6, 0x67, 0x00, 0x2F, 0xC0, 0xD2,
-    0xFF, 0x39, 0x52, 0x62, 0xAC, 0x3E, 0xC6, 0x8A, 0x31, 0x56, 0x8C, 0x71, 0x4A, 0xED, 0x13, 0x5D,
-    0x6C, 0xD1, 0xE6, 0xE0, 0xC3, 0x63, 0xE5, 0x46, 0x61, 0x65, 0x18, 0xEB, 0xDA, 0xCC, 0x58, 0x77,
-    0x0A, 0xAE, 0x6B, 0x3C, 0xE9, 0xB2, 0x1E, 0xE6, 0xAE, 0xB2, 0x9D, 0xAE, 0xB3, 0x27, 0xFB, 0xD0,
-    0x3F, 0xD4, 0xC1, 0x8A, 0x8B, 0x78, 0x9F, 0x53, 0x46, 0xAF, 0x9C, 0xAF, 0xAC, 0xF3, 0x15, 0x9F,
-    0xAF, 0x30, 0x76, 0xE0, 0x1E, 0xF6, 0x99, 0x08, 0x8A, 0xB5, 0x13, 0x5C, 0x01, 0x22, 0x48, 0xE2,
-    0xED, 0x4A, 0x80, 0xE5, 0xAA, 0xE0, 0x7D, 0x8A, 0x79, 0x5A, 0x97, 0x96, 0xF8, 0xB6, 0x83, 0x10,
-    0x20, 0xB5, 0x31, 0xD4, 0xF3, 0x34, 0x5D, 0x45, 0x88, 0xB9, 0x8D, 0x6B, 0xAB, 0x6C, 0x84, 0x87,
-    0xB1, 0x8C, 0xFB, 0x34, 0x94, 0xF0, 0x2C, 0xDA, 0x83, 0x4E, 0xAF, 0xC2, 0x50, 0x14, 0x9B, 0xE5,
-    0xCC, 0x87, 0x31, 0x3D, 0x84, 0x3B, 0x05, 0x3E, 0xB4, 0x13, 0x58, 0x48, 0xE6, 0x6A, 0xFB, 0xF8,
-    0x22, 0xED, 0x3F, 0x6E, 0x3C, 0x6F, 0x0D, 0x2D, 0x95, 0x86, 0xA9, 0x53, 0x41, 0x69, 0x8A, 0xE5,
-    0x4D, 0xD9, 0x6E, 0xA4, 0x6B, 0x66, 0x3C, 0x79, 0x6F, 0x9E, 0xCD, 0xE7, 0x4C, 0xC6, 0xA3, 0x38,
-    0x82, 0xDD, 0x9C, 0xC2, 0x4D, 0xD6, 0x8F, 0x75, 0xFD, 0x3A, 0xDB, 0x93, 0xE7, 0x7C, 0x03, 0x32,
-    0x1B, 0x45, 0xC0, 0xF3, 0xB9, 0x89, 0x64, 0xE4, 0xAE, 0x6C, 0x1E, 0x42, 0xA4, 0x2D, 0x56, 0xE8,
-    0x90, 0xD6, 0xE1, 0x06, 0x6E, 0xE6, 0x14, 0x66, 0x69, 0x0C, 0x49, 0x49, 0xB3, 0x9C, 0xF0, 0x80,
-    0xCF, 0xAD, 0x00, 0xF6, 0xA2, 0xF6, 0xD7, 0x01, 0xBC, 0x81, 0x0D, 0x9D, 0x24, 0x58, 0x3F, 0x56,
-    0x8F, 0xFF, 0x7E, 0x1B, 0x56, 0x0F, 0x6D, 0x3B, 0x99, 0xF6, 0x21, 0xEF, 0x1E, 0x12, 0xDF, 0x8C,
-    0xEC, 0x8B, 0xD2, 0x96, 0xDD, 0x2B, 0x33, 0x21, 0xEB, 0xB3, 0x41, 0x05, 0xA2, 0xE4, 0x7E, 0x06,
-    0x52, 0x23, 0x65, 0x53, 0x60, 0x07, 0xD1, 0x50, 0x49, 0xFB, 0x69, 0x02, 0x8D, 0xD1, 0x7E, 0x18,
-    0x3D, 0xF8, 0x48, 0x06, 0x3F, 0x86, 0xCC, 0x2E, 0x4B, 0x0D, 0xCB, 0x81, 0xA7, 0xB7, 0x48, 0x20,
-    0x8E, 0x64, 0xD6, 0x9B, 0x6C, 0x65, 0xEF, 0x71, 0x10, 0xF5, 0x61, 0x1A, 0x7D, 0x17, 0x36, 0x25,
-    0xBE, 0x91, 0xC0, 0xF0, 0xAE, 0xE6, 0xB0, 0x01, 0xD1, 0x83, 0xAA, 0x00, 0xB7, 0xD8, 0x49, 0x0F,
-    0xA8, 0xC2, 0x16, 0x27, 0x22, 0x63, 0x90, 0xD8, 0xDB, 0xD4, 0x1D, 0x9A, 0xBC, 0x57, 0x1D, 0xDE,
-    0x29, 0x08, 0x85, 0x19, 0xB0, 0x4B, 0x36, 0x74, 0x4B, 0x1E, 0x47, 0xD8, 0x9E, 0xCB, 0xDB, 0x8C,
-    0x1B, 0xC4, 0x31, 0xDE, 0x7C, 0xE8, 0xD6, 0xBC, 0xCE, 0xEF, 0x98, 0x40, 0x04, 0xEC, 0xDB, 0xD2,
-    0x85, 0xA9, 0xA5, 0x21, 0x87, 0x9F, 0x65, 0xB6, 0xEE, 0x0A, 0xA6, 0x6C, 0x54, 0x86, 0x2A, 0xCD,
-    0x8A, 0x66, 0x8C, 0xAA, 0x0E, 0x90, 0xA7, 0x9F, 0xC8, 0x9B, 0xF0, 0xA8, 0xA3, 0xA3, 0x0E, 0x8E,
-    0x3A, 0x36, 0x72, 0x68, 0x44, 0x64, 0x64, 0x8B, 0xF0, 0x48, 0xC7, 0x45, 0x1D, 0x16, 0x75, 0x54,
-    0xAC, 0x0D, 0x1B, 0xF1, 0x89, 0x38, 0x24, 0x12, 0x22, 0xE2, 0x88, 0x38, 0x20, 0x36, 0xD0, 0xB9,
-    0xFB, 0x04, 0x19, 0x1D, 0x00, 0x07, 0x5C, 0x39, 0x65, 0xFE, 0xC4, 0x6C, 0xA4, 0xA0, 0x01, 0x08,
-    0xC0, 0xBF, 0xF0, 0xFE, 0x18, 0x5B, 0xC9, 0x22, 0xCC, 0xE4, 0x6F, 0xA4, 0xC0, 0x92, 0xFC, 0xD8,
-    0x81, 0x0A, 0xE6, 0x85, 0xF5, 0x6C, 0x4E, 0xCE, 0xD1, 0x8B, 0x29, 0x87, 0xE0, 0xED, 0x9C, 0xD9,
-    0x47, 0x4B, 0x42, 0x8C, 0x9E, 0x0D, 0xBF, 0x86, 0x1E, 0x2B, 0x18, 0x35, 0x4C, 0x06, 0x73, 0xDB,
-    0xC9, 0x1E, 0xA6, 0x85, 0x30, 0x48, 0xF7, 0x92, 0xC0, 0x86, 0xF1, 0xA6, 0xDD, 0xC4, 0x2E, 0x9C,
-    0x86, 0xBA, 0x98, 0xAC, 0xD7, 0x9A, 0xCD, 0x58, 0x7A, 0x9B, 0xBA, 0xEC, 0x08, 0x8E, 0xAA, 0xB9,
-    0xEC, 0x98, 0xF3, 0x90, 0xFE, 0x82, 0xCB, 0x34, 0x88, 0xE9, 0xCF, 0xCD, 0xEC, 0xE2, 0xB7, 0x38,
-    0x3E, 0x94, 0x24, 0xDE, 0x3D, 0x99, 0x22, 0x9E, 0x95, 0xB0, 0xBB, 0x10, 0x5A, 0xB3, 0x2F, 0x42,
-    0x7D, 0x57, 0x39, 0x1E, 0x72, 0xDC, 0x03, 0x13, 0xB2, 0x5F, 0x01, 0x95, 0x78, 0x1F, 0x1F, 0x96,
-    0xD8, 0x98, 0x18, 0x9B, 0xD0, 0x46, 0x08, 0xF4, 0xE0, 0x13, 0x5D, 0x12, 0xD7, 0x30, 0xCE, 0x60,
-    0x7B, 0xBA, 0x05, 0xDA, 0xB1, 0xE1, 0xD9, 0xA3, 0xD5, 0x01, 0x0B, 0xE1, 0x68, 0xBC, 0xCF, 0xF9,
-    0xEF, 0xE2, 0x56, 0x91, 0x80, 0xA6, 0x91, 0xE0, 0xC3, 0x57, 0x40, 0xD3, 0x38, 0x12, 0x1C, 0x61,
-    0xEB, 0xD9, 0xBD, 0x03, 0x48, 0x63, 0xDC, 0x15, 0xC0, 0x32, 0xE1, 0x1F, 0xF8, 0xB7, 0x8F, 0x95,
-    0x73, 0x78, 0xDE, 0x58, 0x4B, 0x88, 0x49, 0xCC, 0xAD, 0xC0, 0x4F, 0x69, 0xAE, 0x1A, 0xC1, 0x63,
-    0x6F, 0xE4, 0xAA, 0x79, 0x4D, 0xD8, 0xFA, 0xF5, 0xCD, 0x3B, 0xB9, 0x2A, 0x81, 0xFF, 0xDC, 0x27,
-    0x8A, 0x39, 0xE6, 0xAA, 0x50, 0x74, 0x36, 0x26, 0x2C, 0xFF, 0x05, 0x6B, 0xDD, 0x5A, 0x1D, 0xAD,
-    0xC5, 0x56, 0xB6, 0x00, 0xD0, 0xF8, 0x7F, 0x51, 0xDF, 0xE4, 0x98, 0xA2, 0xC3, 0x95, 0x5F, 0xCF,
-    0xCE, 0x16, 0xD8, 0xAE, 0xD1, 0x98, 0x71, 0xB1, 0x99, 0x02, 0xB2, 0x18, 0xA0, 0xFD, 0xCC, 0x47,
-    0x3A, 0xBF, 0xA4, 0xA4, 0x37, 0xC2, 0xE6, 0x9F, 0xD6, 0xDC, 0x0A, 0xDF, 0x61, 0x2F, 0x06, 0x60,
-    0x95, 0xB8, 0xDF, 0x49, 0xD7, 0xA1, 0x12, 0xBC, 0xB1, 0x2E, 0x32, 0xEB, 0x5A, 0x6F, 0xE8, 0x8C,
-    0x48, 0x1B, 0x7C, 0xC7, 0x15, 0x93, 0xA1, 0x2B, 0xE4, 0x35, 0x4E, 0x21, 0xC9, 0x60, 0x75, 0xCD,
-    0x15, 0x35, 0xF7, 0x34, 0x06, 0xA3, 0x88, 0xD4, 0xA6, 0xA2, 0xD3, 0x56, 0x5A, 0x89, 0x68, 0xC9,
-    0x7E, 0x4D, 0x3A, 0x49, 0x10, 0x20, 0x52, 0x5D, 0x4C, 0x61, 0x7F, 0xBE, 0x21, 0xED, 0x0B, 0xD9,
-    0x3C, 0x95, 0xA1, 0x99, 0x9D, 0xA6, 0xD1, 0xE6, 0x20, 0x31, 0x99, 0xC9, 0xE9, 0x50, 0xC2, 0x98,
-    0xEC, 0xB0, 0x0B, 0x74, 0x8E, 0xF3, 0x82, 0x4F, 0xC0, 0x0B, 0x54, 0xE9, 0x0D, 0xC9, 0x63, 0x42,
-    0x28, 0x52, 0x28, 0xC9, 0xCE, 0x5A, 0x63, 0x3C, 0xE1, 0x80, 0xCB, 0x1E, 0x01, 0x69, 0x34, 0xFB,
-    0xD1, 0x72, 0x70, 0x48, 0x7E, 0x99, 0x09, 0x2D, 0xA3, 0x78, 0xC0, 0xAA, 0xE4, 0x20, 0x07, 0x1D,
-    0x21, 0xAE, 0x5E, 0x32, 0x54, 0xA2, 0x2A, 0x56, 0xE7, 0xA7, 0xA1, 0x10, 0xFD, 0x5B, 0x52, 0x08,
-    0x95, 0x70, 0x4C, 0x62, 0x2D, 0xE8, 0xC5, 0x68, 0xDD, 0xC3, 0xE1, 0x99, 0x20, 0x6A, 0x26, 0xD1,
-    0x84, 0x23, 0x2C, 0xAB, 0xE3, 0x2A, 0xC0, 0xD2, 0x06, 0x60, 0xCB, 0x83, 0xCA, 0x45, 0x82, 0x18,
-    0x9E, 0x61, 0x3E, 0x66, 0xAD, 0x01, 0x73, 0x24, 0x20, 0x2C, 0x94, 0x92, 0x03, 0xCD, 0x8B, 0x66,
-    0x30, 0xAF, 0xD1, 0x8E, 0x0E, 0x4E, 0x05, 0x6F, 0x4B, 0x44, 0x56, 0x0D, 0x71, 0xFB, 0x8F, 0x73,
-    0xE6, 0x79, 0x01, 0x7F, 0xB0, 0x1A, 0xB3, 0xB0, 0x0A, 0xEC, 0x2A, 0x0F, 0x8A, 0xEF, 0xB0, 0xB5,
-    0xC2, 0x1F, 0x0B, 0xBD, 0x26, 0x2B, 0x65, 0xCC, 0xD4, 0x61, 0x5C, 0xE3, 0x0E, 0x1C, 0x5B, 0xEA,
-    0x89, 0xC1, 0x2E, 0x23, 0x41, 0x1A, 0x19, 0xD8, 0x2B, 0x0C, 0x09, 0x75, 0x61, 0x08, 0x7C, 0x8A,
-    0x5B, 0x99, 0x53, 0xE3, 0xD6, 0x42, 0x2F, 0x71, 0xED, 0x9A, 0xBA, 0xC4, 0x19, 0xAA, 0xFA, 0x49,
-    0xCC, 0xFC, 0xA3, 0x7A, 0x66, 0xAD, 0x5F, 0x9D, 0x14, 0x8C, 0x55, 0x8C, 0xF0, 0xAB, 0x7F, 0xD7,
-    0x5A, 0xA6, 0x3D, 0xD3, 0x84, 0xF9, 0x04, 0xFB, 0xAF, 0xB3, 0x5A, 0x6A, 0x74, 0x86, 0xC3, 0x98,
-    0x51, 0xAF, 0x56, 0xA1, 0xCE, 0x20, 0x46, 0x91, 0x79, 0x4D, 0x25, 0x4E, 0xE2, 0x69, 0x9F, 0x86,
-    0x1F, 0x20, 0x6D, 0xCF, 0x3C, 0x8C, 0x59, 0x22, 0x5F, 0x18, 0xA9, 0x47, 0xD5, 0x38, 0x49, 0x04,
-    0x39, 0x63, 0x7B, 0x41, 0xA4, 0xD1, 0x06, 0x53, 0x5B, 0x4C, 0x6D, 0x18, 0x8D, 0xCD, 0xD4, 0xA6,
-    0xC1, 0xB6, 0x51, 0x68, 0x1F, 0x00, 0xE9, 0x61, 0xEB, 0x58, 0x63, 0x6E, 0x22, 0x92, 0x50, 0x5F,
-    0xB6, 0x53, 0x6D, 0x3A, 0x45, 0x9B, 0x95, 0x10, 0x6B, 0xE3, 0xF1, 0xF4, 0x65, 0x8F, 0x57, 0x38,
-    0x52, 0x47, 0x18, 0x78, 0xB6, 0x2D, 0x95, 0x4F, 0x89, 0x2E, 0xF1, 0x3B, 0x9E, 0xD1, 0x4E, 0x6B,
-    0x13, 0x98, 0x15, 0x5F, 0x41, 0xFC, 0x41, 0x82, 0xAF, 0x23, 0xA4, 0xB4, 0x99, 0xC5, 0x41, 0x7C,
-    0x24, 0x31, 0x22, 0x42, 0x6E, 0x0E, 0x42, 0xF8, 0xCC, 0x44, 0xFC, 0xCF, 0xBD, 0x00, 0xC1, 0x2B,
-    0x6A, 0xFF, 0x6F, 0x44, 0x00, 0xA3, 0xB4, 0x13, 0x53, 0xDE, 0x47, 0x76, 0x33, 0x4A, 0x40, 0x8F,
-    0xAC, 0x16, 0xC4, 0xBC, 0x4C, 0x8F, 0xAF, 0xA7, 0x4A, 0xA8, 0xED, 0x44, 0x96, 0x0C, 0xB1, 0x4E,
-    0x10, 0x07, 0xC4, 0xD2, 0xA9, 0x3C, 0x0F, 0x46, 0x9C, 0xAE, 0x7A, 0xF0, 0x57, 0x37, 0x71, 0xFF,
-    0x71, 0x84, 0x75, 0xDB, 0x99, 0xC5, 0x8E, 0x02, 0x0C, 0x49, 0xCC, 0xBC, 0xC5, 0x00, 0x16, 0x68,
-    0x1C, 0xB1, 0x32, 0x1D, 0xDE, 0x98, 0x6C, 0x62, 0x47, 0x79, 0xD7, 0xB0, 0xEF, 0x98, 0x91, 0x37,
-    0xB7, 0x60, 0x35, 0x49, 0xE8, 0xCF, 0xC5, 0x9F, 0x0A, 0x2B, 0x32, 0x25, 0xE2, 0x7F, 0x0F, 0xAB,
-    0x08, 0xA3, 0x50, 0x67, 0xCA, 0x08, 0xE2, 0x2A, 0xB3, 0xD5, 0x0A, 0x4D, 0x21, 0x06, 0x90, 0x60,
-    0xB0, 0x9C, 0xE1, 0x65, 0xF8, 0x33, 0xB6, 0xAA, 0x36, 0xA7, 0xBE, 0xF6, 0x6E, 0xCC, 0x68, 0xA7,
-    0x2E, 0xE7, 0x41, 0x50, 0x90, 0xE0, 0x75, 0xBB, 0x6B, 0x1C, 0x7F, 0xFD, 0x26, 0xD3, 0x8A, 0x1D,
-    0x96, 0x02, 0xE6, 0xB4, 0x01, 0x3D, 0x75, 0xF3, 0x03, 0x97, 0xA8, 0xE6, 0x07, 0xE3, 0x9F, 0x03,
-    0x6F, 0x21, 0x40, 0x49, 0xF7, 0x48, 0x09, 0x7C, 0x82, 0x4D, 0xC2, 0x5E, 0xCF, 0xE7, 0x66, 0xBE,
-    0x0E, 0x82, 0x46, 0x40, 0xB0, 0x81, 0x2D, 0xFF, 0xFA, 0x95, 0x41, 0xA1, 0x84, 0x0C, 0x9B, 0xFB,
-    0x8F, 0xF3, 0x48, 0x88, 0xCC, 0x06, 0xA6, 0x5A, 0xD6, 0xA8, 0xC8, 0x58, 0x0B, 0x2B, 0x14, 0x9E,
-    0x34, 0xD5, 0x5A, 0x1A, 0x26, 0x31, 0xDB, 0x77, 0xCC, 0x64, 0xC2, 0x82, 0x4C, 0xBE, 0x03, 0x8F,
-    0xEE, 0xB1, 0x81, 0x61, 0x89, 0x1C, 0x31, 0xA6, 0x55, 0x9D, 0x41, 0xE2, 0xAE, 0x3D, 0x9B, 0xB7,
-    0xE6, 0xA9, 0x27, 0xED, 0xEF, 0x9D, 0xAF, 0x3C, 0x55, 0x96, 0xC6, 0x07, 0x60, 0x3E, 0x91, 0x68,
-    0x53, 0x79, 0xFA, 0x64, 0x32, 0x28, 0x9A, 0x1B, 0xC1, 0x0F, 0x06, 0x23, 0x2B, 0x89, 0x77, 0xC1,
-    0x5A, 0xDC, 0xC8, 0x64, 0xFC, 0x76, 0x18, 0x8D, 0xAC, 0x6C, 0x37, 0x40, 0x36, 0xBC, 0x92, 0x86,
-    0x45, 0x93, 0x16, 0x1A, 0x2A, 0x73, 0xFE, 0xB4, 0xD8, 0xC5, 0xD6, 0x18, 0xE8, 0x60, 0xD0, 0xA2,
-    0x47, 0xFE, 0xD2, 0x54, 0x23, 0x27, 0x39, 0x0D, 0xC7, 0x04, 0xC4, 0x40, 0x2E, 0xC8, 0x54, 0x50,
-    0x0F, 0xBB, 0x50, 0x1A, 0x79, 0xDF, 0x4E, 0xBB, 0x6B, 0xE4, 0x8E, 0xE1, 0xDC, 0x18, 0x50, 0x6B,
-    0x60, 0x66, 0xF1, 0xBC, 0x21, 0xA5, 0x78, 0xEC, 0xD9, 0xA2, 0x35, 0x20, 0xB5, 0xA2, 0xA3, 0xFC,
-    0x2E, 0x18, 0x32, 0xCC, 0x6E, 0x90, 0x4F, 0x35, 0xE7, 0xA6, 0x0F, 0xD1, 0xA6, 0xAD, 0xAC, 0x34,
-    0x94, 0xB9, 0x8C, 0xC5, 0x2F, 0xDC, 0xE3, 0x88, 0x67, 0xA1, 0x8A, 0xBF, 0x2D, 0xB0, 0x11, 0xCE,
-    0xDF, 0xE9, 0xE8, 0xC3, 0x91, 0x5C, 0xFC, 0xE7, 0x7F, 0xC6, 0xC0, 0x6F, 0x6D, 0xE3, 0x9F, 0x87,
-    0xBD, 0x79, 0xFA, 0x2A, 0xE0, 0x59, 0x2E, 0xA9, 0xD4, 0x17, 0xCA, 0x91, 0x76, 0xD4, 0x9D, 0xE4,
-    0x76, 0x64, 0x8E, 0xA8, 0x3B, 0xB0, 0x92, 0x60, 0x17, 0x97, 0x4E, 0x92, 0xDD, 0x3D, 0x10, 0x23,
-    0x0E, 0x86, 0xCE, 0x4B, 0xE4, 0xF9, 0x46, 0x31, 0x5A, 0x4B, 0x6A, 0xFF, 0xF7, 0x52, 0xFB, 0x9B,
-    0xC8, 0xCA, 0x2D, 0x04, 0x14, 0x30, 0x7F, 0x27, 0x99, 0xC7, 0xBF, 0x33, 0xD0, 0x2A, 0x33, 0x77,
-    0xD2, 0x00, 0x64, 0x2F, 0xFB, 0x4A, 0x12, 0x88, 0xFF, 0x7E, 0x51, 0x7D, 0xAF, 0x72, 0xF3, 0x76,
-    0x33, 0x74, 0x64, 0x26, 0x5F, 0xA4, 0xD8, 0x8E, 0xEC, 0x7F, 0x04, 0xB0, 0x8E, 0x17, 0x0B, 0x3E,
-    0xB7, 0x34, 0x48, 0x45, 0x84, 0x5C, 0x83, 0x2D, 0xA8, 0x67, 0xE4, 0x02, 0xEE, 0x24, 0x2D, 0xA6,
-    0xE1, 0x56, 0xE6, 0x26, 0x81, 0xD5, 0xB3, 0xB2, 0x0F, 0xBE, 0x15, 0x56, 0xDD, 0xF3, 0x23, 0x6B,
-    0xBC, 0xEE, 0x03, 0xB9, 0xF3, 0x72, 0x25, 0xE4, 0xBC, 0xF8, 0x15, 0xE7, 0x71, 0x84, 0x1B, 0xA2,
-    0x0F, 0x22, 0xFA, 0x0A, 0x98, 0x11, 0xF8, 0xC7, 0x73, 0x91, 0x75, 0x5E, 0xEE, 0x93, 0xC1, 0xE1,
-    0xD8, 0xA9, 0x16, 0x69, 0x38, 0x55, 0x94, 0x07, 0xB9, 0x61, 0x72, 0xB8, 0x4A, 0xF6, 0x11, 0x2C,
-    0x08, 0x0A, 0xDD, 0x0B, 0xA3, 0x39, 0x88, 0x17, 0x83, 0xD3, 0x61, 0x58, 0xE8, 0xBA, 0xF8, 0xEA,
-    0x17, 0xA4, 0x58, 0x08, 0x33, 0x51, 0x84, 0x91, 0x98, 0x9A, 0xC8, 0x5C, 0xC9, 0xD5, 0x83, 0x02,
-    0x79, 0x80, 0x90, 0x42, 0xD2, 0xCF, 0xA5, 0xBF, 0x97, 0xD0, 0x1B, 0x47, 0xBF, 0x45, 0xF6, 0xC1,
-    0x85, 0x75, 0x5A, 0x58, 0x42, 0xA4, 0xCE, 0xB7, 0x04, 0x59, 0x47, 0x0B, 0x9F, 0x1E, 0x12, 0xE7,
-    0xF3, 0x13, 0x79, 0x60, 0x7F, 0x5B, 0x45, 0xD2, 0xFD, 0xD7, 0xC2, 0xE4, 0xC2, 0x52, 0xA3, 0xAF,
-    0x63, 0x15, 0xDB, 0x1F, 0xE7, 0xA4, 0x20, 0x85, 0x2E, 0x5D, 0xFD, 0x5A, 0x2E, 0xD4, 0xD0, 0xB8,
-    0xFA, 0x75, 0xAC, 0x14, 0x74, 0xC2, 0x41, 0x3E, 0xFE, 0x9D, 0x7F, 0x4A, 0x45, 0xD9, 0xA3, 0xCD,
-    0xF1, 0xBC, 0x27, 0x73, 0x53, 0x81, 0xA4, 0xC5, 0xC0, 0x47, 0x20, 0x8C, 0x36, 0x9A, 0xA0, 0xD0,
-    0x76, 0x83, 0xA4, 0xB1, 0x6F, 0xE5, 0xDD, 0xB5, 0xC4, 0x1D, 0x4E, 0x64, 0x74, 0xF2, 0xC1, 0x05,
-    0x45, 0x4B, 0x45, 0xE1, 0xF4, 0x05, 0x29, 0x43, 0x0A, 0x44, 0x6A, 0x6C, 0x84, 0xCB, 0x9B, 0xC2,
-    0xBE, 0xD7, 0x3B, 0x9A, 0x8A, 0x5F, 0x8F, 0x49, 0x7D, 0x33, 0x11, 0x13, 0xFB, 0x31, 0x36, 0x6D,
-    0x69, 0x8E, 0xBC, 0x8A, 0xE6, 0x97, 0xFA, 0xD4, 0x42, 0xCE, 0x1C, 0x42, 0x8C, 0x50, 0x47, 0xC1,
-    0xA6, 0x5E, 0xC4, 0xE1, 0x1B, 0x41, 0x01, 0x92, 0x03, 0x14, 0xC8, 0xBC, 0x82, 0xD0, 0x91, 0xD5,
-    0xDE, 0xA6, 0x4B, 0x57, 0x5C, 0x37, 0x81, 0x08, 0x8F, 0xFC, 0x59, 0x1D, 0x14, 0x2A, 0x53, 0x65,
-    0xBD, 0xCF, 0xCF, 0xF3, 0xB5, 0xB8, 0xE6, 0x80, 0x40, 0x9C, 0x92, 0x8E, 0xA5, 0x4B, 0x5D, 0x65,
-    0x8E, 0xA9, 0x35, 0xEF, 0x9F, 0x17, 0x6D, 0x3A, 0x55, 0x28, 0x55, 0x3A, 0x1F, 0xC4, 0x57, 0xA5,
-    0xD3, 0x9F, 0x97, 0xBE, 0x55, 0x39, 0x88, 0x10, 0x43, 0xAB, 0x70, 0x92, 0x36, 0x55, 0x2C, 0x38,
-    0xEC, 0xC0, 0x49, 0x90, 0x53, 0x42, 0x3B, 0xD1, 0xE2, 0x3E, 0xD8, 0x84, 0xF8, 0xAF, 0x31, 0x4C,
-    0x63, 0xD4, 0x42, 0x9A, 0x39, 0xB3, 0xB3, 0xD0, 0x71, 0x6C, 0x28, 0xF8, 0x99, 0x48, 0xB8, 0x4C,
-    0xB5, 0x88, 0xD9, 0x7D, 0x78, 0xA5, 0x0F, 0x49, 0x9F, 0x06, 0x36, 0x81, 0xAC, 0xBF, 0x95, 0x91,
-    0xF1, 0x0E, 0xC4, 0xDD, 0xC2, 0x8A, 0x7F, 0x4C, 0x1A, 0xD0, 0x35, 0x49, 0xAC, 0xF9, 0xD9, 0x17,
-    0xE0, 0xA7, 0xB0, 0x72, 0x6A, 0x4D, 0xE4, 0xE3, 0x9A, 0x69, 0x0B, 0x9F, 0x2E, 0xED, 0xAA, 0x13,
-    0x51, 0x59, 0xD7, 0x42, 0x0E, 0x8C, 0x22, 0x1D, 0xCF, 0x2E, 0xBE, 0x5A, 0x22, 0x70, 0xF4, 0x7D,
-    0xCC, 0xD3, 0xC3, 0xAB, 0xB0, 0x13, 0xBF, 0x70, 0xA2, 0x18, 0xAF, 0x5E, 0x4F, 0x18, 0x72, 0x59,
-    0x38, 0xA9, 0x77, 0x45, 0xD1, 0x9C, 0xBA, 0xA4, 0xA1, 0x09, 0x99, 0x86, 0x66, 0x87, 0x4F, 0x01,
-    0x9F, 0x06, 0x33, 0xF3, 0x18, 0x3D, 0xAA, 0x9C, 0xCA, 0x42, 0x60, 0x10, 0x5F, 0x25, 0x17, 0x37,
-    0x09, 0xF6, 0xD9, 0xBA, 0x9C, 0xAB, 0xCB, 0xDB, 0xF3, 0xF8, 0xF7, 0x52, 0x41, 0xFB, 0x64, 0x9F,
-    0x42, 0xF8, 0x37, 0xB0, 0x39, 0xB9, 0x3D, 0xDF, 0xFB, 0x83, 0x40, 0xFC, 0x7E, 0xED, 0x7B, 0x3F,
-    0x9F, 0xEA, 0xA9, 0xAD, 0xFA, 0x2F, 0x6C, 0x86, 0xB1, 0x72, 0x32, 0x71, 0x42, 0x18, 0x44, 0xCF,
-    0xCC, 0x17, 0xA9, 0xC0, 0xD7, 0x00, 0x1D, 0x34, 0x04, 0x0A, 0x5E, 0xCF, 0xF4, 0x42, 0xFD, 0x7D,
-    0xE4, 0xFA, 0xE4, 0x54, 0x64, 0x54, 0xF5, 0x64, 0x0E, 0xAD, 0x0F, 0x90, 0x3E, 0x61, 0xBE, 0x36,
-    0xA2, 0x4D, 0xCA, 0xD3, 0x24, 0xBE, 0x89, 0x09, 0x97, 0x2C, 0x38, 0x2C, 0x0C, 0xA3, 0x05, 0x5B,
-    0x83, 0x9F, 0x4A, 0x37, 0xF1, 0x9D, 0xFC, 0x2B, 0x5F, 0xF5, 0x17, 0xE5, 0xD6, 0xAF, 0x85, 0x57,
-    0xD5, 0xCB, 0xA5, 0x97, 0x8E, 0xEC, 0x9C, 0x3E, 0xD1, 0x28, 0xBF, 0xC8, 0xA3, 0xFC, 0x0E, 0x8F,
-    0x52, 0xF1, 0x28, 0x2F, 0x52, 0x53, 0x16, 0xAF, 0x7F, 0x1D, 0xA6, 0x9A, 0x6B, 0xD7, 0xB5, 0x7F,
-    0x53, 0x0D, 0x8E, 0x28, 0x95, 0xE5, 0xD8, 0x06, 0x27, 0xDA, 0xCD, 0x25, 0x2D, 0x95, 0x58, 0x97,
-    0x2B, 0x03, 0x83, 0x17, 0x6C, 0x06, 0x70, 0xB7, 0x9E, 0x71, 0xB5, 0xDF, 0x60, 0xCE, 0x81, 0x9C,
-    0xAC, 0x33, 0xE0, 0xD4, 0x4B, 0x26, 0x13, 0x07, 0x0C, 0xA7, 0x29, 0x02, 0x08, 0x03, 0x54, 0x79,
-    0xB9, 0x6C, 0xC1, 0xE4, 0x2E, 0xE0, 0x8B, 0x31, 0xBE, 0xE6, 0x9C, 0x39, 0x2F, 0x48, 0xC6, 0xF9,
-    0xF6, 0x06, 0x76, 0x49, 0x45, 0xB5, 0x27, 0x1F, 0x40, 0x2A, 0x38, 0xAE, 0x2C, 0x73, 0xC9, 0x22,
-    0x19, 0x9D, 0x3C, 0x93, 0xBA, 0x70, 0xB2, 0x25, 0xE3, 0x3D, 0x29, 0x8E, 0xFE, 0xA0, 0xB4, 0xC7,
-    0x66, 0xCE, 0x48, 0x0A, 0x5C, 0x6E, 0xDF, 0xC3, 0x49, 0xB2, 0xDC, 0xFD, 0x44, 0x1A, 0x2A, 0x3A,
-    0xDE, 0x23, 0xEB, 0x35, 0xDE, 0xEB, 0x62, 0x73, 0x26, 0xB2, 0xD0, 0x5C, 0x45, 0x5E, 0x0E, 0xF5,
-    0xA8, 0x24, 0x76, 0xB2, 0x18, 0x11, 0xD3, 0xCA, 0xC0, 0x52, 0xDA, 0xE2, 0xB1, 0xD4, 0x7A, 0x15,
-    0xC4, 0x21, 0x70, 0x9F, 0x4C, 0xAC, 0x97, 0xB2, 0x92, 0x7A, 0x81, 0xC3, 0xC1, 0x11, 0xC0, 0x18,
-    0x5B, 0xD7, 0x4A, 0x67, 0xC6, 0xFB, 0x55, 0x6A, 0x8E, 0x2A, 0x30, 0x90, 0x44, 0x20, 0x0A, 0x22,
-    0xED, 0x15, 0x91, 0x44, 0xCA, 0x43, 0xC6, 0xF5, 0x9C, 0xFC, 0x80, 0xB0, 0x92, 0x9F, 0x92, 0xFE,
-    0x3B, 0x43, 0xBB, 0x0A, 0xA3, 0x31, 0x1A, 0x1B, 0x69, 0xCD, 0x9F, 0xF9, 0xBF, 0x83, 0x63, 0xC0,
-    0x49, 0x9D, 0xB5, 0x74, 0xDD, 0xB5, 0x93, 0xD8, 0xB7, 0x5E, 0xCD, 0x37, 0xF0, 0x26, 0xBC, 0xA4,
-    0xF3, 0x38, 0x03, 0x28, 0xE4, 0x22, 0x89, 0xAC, 0x51, 0xFB, 0xF8, 0x03, 0x66, 0xB1, 0x61, 0xC2,
-    0x2A, 0xA3, 0x7D, 0x93, 0x2F, 0x9A, 0x5B, 0xD2, 0x79, 0x54, 0x22, 0x64, 0xF9, 0x56, 0xB6, 0xE4,
-    0x45, 0xDF, 0xAD, 0x10, 0xB3, 0x48, 0xF3, 0x8C, 0xA8, 0x42, 0x78, 0x53, 0x51, 0xF3, 0xDD, 0x7D,
-    0xD8, 0x2E, 0xA2, 0xDF, 0xD6, 0x15, 0x93, 0x3D, 0xA3, 0xBE, 0x85, 0x1C, 0x56, 0x68, 0x1C, 0x31,
-    0x41, 0xC7, 0xDF, 0x53, 0x69, 0x70, 0xB5, 0x40, 0xC4, 0x70, 0xA4, 0x78, 0x16, 0x4A, 0x00, 0xF9,
-    0x04, 0x14, 0x81, 0xA4, 0x20, 0x7C, 0x5F, 0xC8, 0xAC, 0x9C, 0xCF, 0x69, 0x98, 0x82, 0xF9, 0x1C,
-    0x52, 0x1F, 0x72, 0xC1, 0xAA, 0x88, 0xBE, 0xD3, 0x68, 0x5B, 0x27, 0xC6, 0x1A, 0x6F, 0xBE, 0x34,
-    0x0E, 0xA3, 0xCC, 0x93, 0x32, 0x9D, 0x43, 0x80, 0x6D, 0x6D, 0x00, 0xC3, 0x4D, 0x9D, 0x71, 0x4A,
-    0xE3, 0x68, 0x36, 0x2F, 0xAE, 0x4B, 0x31, 0x9C, 0x04, 0xDC, 0xC8, 0x53, 0x66, 0xFE, 0xC5, 0x79,
-    0xBD, 0xAB, 0xAF, 0xAF, 0xE0, 0x6B, 0x45, 0x9D, 0x57, 0xDC, 0x18, 0x70, 0xE7, 0x40, 0x5B, 0xF2,
-    0xA5, 0x7B, 0x31, 0x09, 0xE2, 0x7E, 0xC1, 0x45, 0x98, 0x30, 0xA2, 0xEA, 0x90, 0xFD, 0x72, 0xB2,
-    0x3E, 0xF8, 0xCB, 0x31, 0xC0, 0x99, 0xD2, 0x4D, 0x97, 0xF5, 0xBF, 0x1C, 0xD9, 0x65, 0x27, 0x35,
-    0x11, 0xD3, 0x62, 0x13, 0x66, 0xE8, 0xFF, 0xD4, 0xFB, 0x2F, 0x57, 0x7C, 0x5A, 0xB0, 0xDB, 0x38,
-    0x52, 0x6C, 0x78, 0x4E, 0xDA, 0x28, 0x10, 0x1E, 0x5D, 0xCD, 0x60, 0xA6, 0xCB, 0xE8, 0x14, 0x20,
-    0x54, 0x51, 0x2C, 0xE1, 0x88, 0xA7, 0x27, 0x40, 0x67, 0xD5, 0x64, 0x34, 0x9E, 0xC1, 0x3E, 0xE0,
-    0x05, 0x6E, 0xE1, 0xB5, 0xDB, 0x93, 0xC3, 0x8B, 0xE6, 0xB0, 0x22, 0xD1, 0x40, 0x22, 0xF5, 0xFD,
-    0x2D, 0xED, 0xFC, 0xB8, 0x05, 0x1F, 0xFD, 0x00, 0x14, 0x4C, 0xEA, 0x22, 0xD5, 0x98, 0x02, 0x31,
-    0x17, 0xE5, 0x44, 0x59, 0x2E, 0x61, 0x98, 0x23, 0x78, 0xB7, 0xC0, 0x25, 0xB3, 0xBC, 0xFD, 0x22,
-    0xD9, 0x8F, 0xC2, 0xFE, 0xE0, 0x56, 0x05, 0xE5, 0xEC, 0xB2, 0x91, 0x74, 0xFE, 0x23, 0x82, 0x95,
-    0x1F, 0x66, 0xCE, 0x3F, 0x65, 0x43, 0x72, 0x86, 0xE3, 0xE8, 0xF6, 0x10, 0x12, 0xC1, 0x80, 0xCB,
-    0x44, 0xDA, 0xA7, 0xC0, 0x87, 0x48, 0x74, 0xBE, 0xFB, 0x02, 0xB2, 0xE7, 0xA1, 0xDB, 0x91, 0x1E,
-    0xFB, 0x76, 0x60, 0xE4, 0x2E, 0x52, 0xCF, 0xC5, 0x98, 0xB6, 0xFB, 0x3D, 0x70, 0xC0, 0xC6, 0x1A,
-    0xC8, 0x93, 0xDA, 0x1C, 0x58, 0x62, 0xD8, 0x03, 0x85, 0x5C, 0x04, 0xE4, 0x13, 0x0E, 0xDE, 0xD2,
-    0x2E, 0x09, 0x67, 0x84, 0x80, 0xD7, 0x33, 0xB6, 0x10, 0x03, 0x00, 0x56, 0x1E, 0x06, 0xAF, 0x40,
-    0x37, 0x33, 0x8E, 0xA0, 0xFE, 0xBE, 0x9E, 0xF1, 0xFE, 0x85, 0xCC, 0x1E, 0x8A, 0x3A, 0x3F, 0xAE,
-    0x7F, 0x84, 0xCE, 0x96, 0x9D, 0x54, 0xEB, 0x63, 0xCC, 0x6B, 0x4E, 0x26, 0x9E, 0x27, 0xC3, 0x74,
-    0x29, 0x78, 0x6A, 0x11, 0xD2, 0x2D, 0x90, 0xF5, 0x7D, 0xA2, 0x2B, 0x11, 0x2D, 0x23, 0x91, 0x0C,
-    0x48, 0xD8, 0xE9, 0xD1, 0xB4, 0x78, 0x4B, 0x7A, 0x72, 0xDD, 0x9A, 0xB8, 0xA4, 0x51, 0xA7, 0xF1,
-    0x7C, 0x0A, 0xC0, 0xDC, 0xFF, 0xE0, 0x84, 0x46, 0x7C, 0x02, 0xE2, 0x03, 0x46, 0x08, 0x05, 0x59,
-    0xE9, 0x61, 0xB2, 0xDE, 0x45, 0x34, 0x52, 0xC9, 0xDD, 0x88, 0x5C, 0x1F, 0x43, 0xB0, 0xB7, 0xDB,
-    0x3A, 0x17, 0xDE, 0x5B, 0x17, 0xD7, 0xE3, 0x3A, 0x63, 0x7B, 0xE4, 0x45, 0x62, 0x36, 0xDD, 0x64,
-    0x38, 0x1E, 0xE2, 0xDC, 0x68, 0x34, 0x38, 0xF3, 0x8C, 0x3C, 0x78, 0xBF, 0x93, 0x9C, 0xDB, 0xD7,
-    0x54, 0x34, 0x6C, 0xF5, 0x3C, 0xB9, 0x0A, 0x40, 0x64, 0x72, 0xD9, 0x1B, 0x16, 0xED, 0xA4, 0x31,
-    0xB5, 0xB8, 0x84, 0x01, 0x60, 0x7A, 0x66, 0xB0, 0x55, 0x0A, 0x7D, 0x60, 0x35, 0x89, 0xF2, 0xB0,
-    0x4D, 0xEC, 0xF4, 0xFC, 0xE1, 0x1E, 0x39, 0x3D, 0xAC, 0xAE, 0xC2, 0xE6, 0x54, 0xD6, 0xE5, 0xA4,
-    0x6D, 0xA8, 0xCA, 0x05, 0xDD, 0x3A, 0x96, 0x04, 0xE6, 0x3B, 0x10, 0x72, 0x1D, 0xBE, 0xEE, 0xC7,
-    0xB4, 0xB1, 0xDC, 0x9A, 0x98, 0xD4, 0x4D, 0x6A, 0x55, 0xDE, 0x8E, 0x5A, 0xD5, 0xE6, 0xEA, 0xEA,
-    0x1A, 0x9F, 0x41, 0xBD, 0x82, 0xE4, 0xEF, 0x56, 0xB5, 0xAA, 0xD1, 0x4C, 0xAD, 0xAA, 0xE6, 0x53,
-    0xA3, 0x0A, 0xDA, 0x70, 0x99, 0x84, 0x83, 0x2C, 0xB6, 0x06, 0x0A, 0xF9, 0x7D, 0x20, 0x29, 0x06,
-    0xC9, 0xE9, 0x99, 0x32, 0x1C, 0xF3, 0xA9, 0xFD, 0x27, 0x68, 0xEE, 0x39, 0x95, 0x5A, 0x95, 0xB7,
-    0x02, 0xBB, 0x2E, 0x75, 0x45, 0x40, 0x57, 0x1E, 0x62, 0xAE, 0x16, 0x70, 0xB1, 0x3B, 0xD7, 0xB6,
-    0x4E, 0x81, 0x9D, 0xD4, 0x75, 0xCC, 0x00, 0xCA, 0x34, 0xDF, 0xC6, 0xAE, 0xCC, 0x23, 0x36, 0x19,
-    0xD7, 0x49, 0x1F, 0x61, 0x36, 0x27, 0x29, 0xC9, 0x8C, 0xBB, 0x9E, 0x24, 0x6B, 0xAB, 0x42, 0x34,
-    0x2F, 0xAC, 0x77, 0x2D, 0xF0, 0x33, 0x11, 0xE5, 0xB4, 0x88, 0x01, 0xD7, 0xB1, 0xDD, 0x17, 0x13,
-    0x72, 0x7E, 0x07, 0x7B, 0x99, 0xB1, 0x59, 0xE8, 0xF0, 0x66, 0xCF, 0x7E, 0xF3, 0x27, 0x5A, 0xD0,
-    0x1D, 0x8D, 0x0B, 0xBA, 0xCD, 0xF1, 0x4C, 0x9D, 0xFD, 0x6B, 0x67, 0x59, 0xD4, 0xC0, 0x14, 0x4D,
-    0xA5, 0xBC, 0x5D, 0x9A, 0x4F, 0x9A, 0xE6, 0xCF, 0x4F, 0x68, 0xFE, 0x2F, 0x67, 0x1F, 0x7C, 0x1B,
-    0x34, 0xFF, 0xD5, 0x11, 0x18, 0x11, 0x59, 0x5C, 0xC2, 0xD5, 0x26, 0xCA, 0xA6, 0xBE, 0xEF, 0xC6,
-    0x5C, 0xDC, 0x18, 0xBC, 0x08, 0xC4, 0x92, 0x1F, 0x3F, 0x17, 0x9F, 0x3B, 0x47, 0xDD, 0x8C, 0x31,
-    0x22, 0xE6, 0x88, 0xA1, 0xCA, 0xB9, 0xD1, 0x8A, 0xA1, 0x01, 0xC7, 0xC7, 0xAE, 0x55, 0xCE, 0xE5,
-    0x0A, 0x42, 0x49, 0xAE, 0x93, 0x81, 0xA7, 0x7B, 0x4F, 0xA6, 0x61, 0x2D, 0xFF, 0xCD, 0x0B, 0x91,
-    0x08, 0x4D, 0xFB, 0x62, 0xF2, 0x0F, 0x97, 0x14, 0x03, 0xC4, 0x36, 0x06, 0x48, 0x2B, 0x15, 0xD3,
-    0x89, 0x84, 0xA4, 0x99, 0xDE, 0xB4, 0x10, 0x79, 0x73, 0xC6, 0x1D, 0xEC, 0x64, 0xDC, 0xE7, 0x60,
-    0x8C, 0xBF, 0x0B, 0xC6, 0x1D, 0x36, 0x8C, 0x5B, 0x41, 0x52, 0x07, 0x6A, 0xB0, 0xA2, 0x9B, 0x30,
-    0x6E, 0x7D, 0xF2, 0xC9, 0x48, 0xBE, 0x6E, 0x74, 0x3A, 0x20, 0xF7, 0x70, 0x3F, 0xFB, 0xF2, 0x6A,
-    0xA4, 0xC9, 0x51, 0xBF, 0x39, 0x8A, 0x66, 0x05, 0xB1, 0xA2, 0x26, 0x1F, 0xB6, 0xC7, 0x1F, 0xA6,
-    0x37, 0x7C, 0x78, 0xF2, 0xD2, 0x54, 0xD0, 0xFA, 0x32, 0x13, 0x42, 0x73, 0x30, 0x34, 0xB8, 0xA9,
-    0x21, 0xD5, 0x24, 0x78, 0x49, 0x6F, 0x39, 0xBE, 0xDE, 0x5C, 0xD6, 0xEF, 0xCD, 0x2B, 0x75, 0x2F,
-    0xC6, 0x6D, 0x1C, 0x59, 0xED, 0xDE, 0x38, 0x01, 0x08, 0xA9, 0x6E, 0xE3, 0xC8, 0x6A, 0x36, 0xE3,
-    0xBE, 0x47, 0x44, 0xED, 0x02, 0x3E, 0xED, 0xFC, 0x0B, 0xF5, 0x1F, 0xB8, 0x31, 0xE3, 0xFE, 0xF7,
-    0x0E, 0xEF, 0x4E, 0x23, 0xDD, 0x1F, 0x20, 0x6F, 0x2D, 0x0D, 0x7D, 0x90, 0x8C, 0x19, 0xE3, 0x1B,
-    0x7A, 0x29, 0x7A, 0xDD, 0xE1, 0x4C, 0x2F, 0xC5, 0xC3, 0xDC, 0x4B, 0x31, 0x9A, 0xF4, 0x52, 0x84,
-    0xAA, 0x0C, 0xE1, 0x55, 0xE9, 0x39, 0x27, 0x79, 0x0A, 0xEB, 0xE6, 0x00, 0x73, 0x32, 0x07, 0x0A,
-    0x7A, 0x11, 0xAC, 0x25, 0xF0, 0xF5, 0x7F, 0x4B, 0x1C, 0x74, 0x63, 0x46, 0x4F, 0x43, 0xEE, 0xB1,
-    0x33, 0xA1, 0x22, 0xFB, 0xD2, 0x67, 0x7F, 0x54, 0x55, 0xD5, 0x47, 0x55, 0x35, 0x84, 0x1A, 0x3B,
-    0x0A, 0x75, 0xF3, 0xF5, 0xE6, 0x9C, 0xAB, 0xAD, 0x66, 0x27, 0xB0, 0x7C, 0xA2, 0x1A, 0x82, 0xF1,
-    0x3F, 0xA6, 0x35, 0x84, 0x63, 0x5C, 0x43, 0x38, 0xA5, 0x67, 0x8B, 0x26, 0xE5, 0xC0, 0xBA, 0xF0,
-    0x9A, 0x37, 0x47, 0xE2, 0x9F, 0xFC, 0xD0, 0x8C, 0xAB, 0x8A, 0x18, 0x7B, 0x41, 0x1F, 0xF5, 0x8E,
-    0x6E, 0xBF, 0x4E, 0x71, 0x89, 0x1C, 0xFE, 0xD6, 0x03, 0x20, 0xC2, 0x91, 0x2E, 0xFD, 0x7E, 0x8A,
-    0xC3, 0x28, 0xFA, 0xF0, 0x61, 0x14, 0xFB, 0x84, 0xD6, 0xB4, 0xD6, 0xB3, 0xD6, 0xF2, 0xFC, 0x58,
-    0xC3, 0x66, 0x4A, 0x1F, 0x51, 0xA9, 0x08, 0x81, 0xCC, 0x7D, 0x72, 0x9E, 0x23, 0xEB, 0x25, 0x79,
-    0x48, 0x06, 0x0B, 0xB1, 0xA3, 0x16, 0x69, 0xD4, 0x38, 0x9B, 0x26, 0x30, 0x6E, 0x44, 0x73, 0x11,
-    0xD7, 0xE0, 0x7F, 0x06, 0x70, 0x0E, 0x82, 0xE0, 0x46, 0x40, 0x60, 0x97, 0xAF, 0x78, 0x9A, 0xFB,
-    0x9E, 0xC2, 0x24, 0xC1, 0x5F, 0xF1, 0x09, 0xED, 0x3B, 0x09, 0x9B, 0x37, 0xB7, 0xDC, 0xF0, 0xAF,
-    0xED, 0x97, 0xF1, 0xF6, 0xDF, 0x2E, 0x60, 0xA8, 0x7F, 0x3D, 0x03, 0xAC, 0x94, 0xD0, 0x2E, 0x16,
-    0xC8, 0x05, 0x3E, 0x08, 0x0E, 0xC7, 0x0A, 0x23, 0xAE, 0x8B, 0xA6, 0x33, 0x75, 0x8D, 0xD3, 0x83,
-    0xD4, 0xCD, 0x97, 0xAC, 0xD7, 0x9D, 0xE3, 0x92, 0x3E, 0x58, 0x20, 0xF1, 0x7B, 0xBA, 0x48, 0x32,
-    0x7F, 0x36, 0x32, 0xBF, 0xEF, 0x93, 0x7F, 0x34, 0x43, 0x72, 0x76, 0x3F, 0x60, 0xE5, 0xE5, 0xC8,
-    0x92, 0x4D, 0x47, 0xC1, 0x8D, 0x3A, 0x34, 0x07, 0x7F, 0x08, 0x00, 0x55, 0x4F, 0x7E, 0xDA, 0x03,
-    0xBD, 0xB9, 0x5C, 0x13, 0xD9, 0xF9, 0x26, 0x19, 0x20, 0x31, 0x72, 0x5E, 0xDA, 0x3C, 0xA6, 0x35,
-    0x77, 0x6C, 0x56, 0x73, 0x3B, 0x6A, 0x3C, 0x76, 0xB5, 0x08, 0x62, 0xAF, 0x4B, 0xCD, 0xC7, 0x8D,
-    0xFF, 0x8B, 0x24, 0xD0, 0x7B, 0x63, 0x15, 0x82, 0xF9, 0x2C, 0x98, 0xC4, 0xE6, 0x9A, 0xD1, 0x9D,
-    0x38, 0x69, 0xC4, 0xB5, 0xD2, 0x7A, 0x5B, 0xE5, 0xDD, 0x7F, 0xB0, 0x1F, 0x7B, 0xDD, 0x5F, 0xF0,
-    0xE9, 0xF8, 0xFB, 0x20, 0xD2, 0x7F, 0x0E, 0x61, 0xB1, 0xF5, 0x9B, 0xB9, 0x3E, 0xAB, 0x11, 0x88,
-    0x99, 0xB1, 0xF8, 0x4F, 0x66, 0xEE, 0x81, 0x15, 0x85, 0xB7, 0x6C, 0x00, 0xB9, 0x53, 0x47, 0x7A,
-    0x97, 0xF4, 0x91, 0x5E, 0x32, 0x89, 0xC2, 0x1A, 0x37, 0x0C, 0xED, 0x6C, 0x07, 0xC7, 0xF4, 0xF5,
-    0xF6, 0xEA, 0x4E, 0xFF, 0xD3, 0xA7, 0xBF, 0xF9, 0x61, 0x2A, 0xAA, 0x1E, 0x6D, 0xA4, 0xEC, 0x2F,
-    0xBA, 0xBE, 0xE3, 0xD7, 0x87, 0x1D, 0x2B, 0x7A, 0x09, 0x7C, 0x52, 0xA3, 0xC3, 0x1F, 0x48, 0xC5,
-    0xE5, 0x42, 0x77, 0x57, 0x2D, 0xEA, 0x55, 0x38, 0x7C, 0x53, 0x60, 0x46, 0x96, 0x8E, 0xA8, 0x54,
-    0x68, 0x2F, 0xD0, 0x0B, 0x61, 0xFE, 0x58, 0x52, 0xD3, 0x83, 0x55, 0x2F, 0xB0, 0x5E, 0x0B, 0x7F,
-    0x3B, 0xD7, 0x39, 0x67, 0x31, 0xBE, 0xAC, 0x4F, 0x28, 0x11, 0x12, 0xA2, 0x41, 0xA5, 0xE5, 0x1D,
-    0x9D, 0xE4, 0x8E, 0x8C, 0x98, 0xA4, 0x8F, 0x10, 0x1B, 0x40, 0xE4, 0x7B, 0xAD, 0xD7, 0x9F, 0xE0,
-    0xD8, 0x0A, 0x23, 0xEE, 0x48, 0xDD, 0x49, 0x21, 0xA2, 0x16, 0xC2, 0x8F, 0xF3, 0x2D, 0x43, 0x02,
-    0x13, 0xA6, 0x05, 0x33, 0x7D, 0x1C, 0x49, 0xA2, 0x3E, 0x1D, 0x71, 0x57, 0xCF, 0xD6, 0x91, 0x25,
-    0xD0, 0xA7, 0x37, 0x1C, 0xAD, 0x30, 0x73, 0xAC, 0x43, 0x82, 0x53, 0x97, 0xAF, 0x4A, 0x7D, 0xB6,
-    0x23, 0x9E, 0x1C, 0xF2, 0x07, 0x7C, 0xB0, 0xC1, 0x75, 0x3E, 0x17, 0x2C, 0x45, 0x1F, 0x57, 0x49,
-    0x68, 0xDB, 0xCE, 0x5C, 0x16, 0x3F, 0xD0, 0xBD, 0x33, 0x0C, 0xBA, 0xB8, 0x31, 0x3E, 0x50, 0x9A,
-    0xA3, 0xC8, 0xF9, 0x9E, 0x4A, 0xB1, 0xC4, 0x72, 0xE6, 0x14, 0x44, 0x1F, 0x0D, 0x99, 0xCF, 0xE8,
-    0x8F, 0xC2, 0x51, 0x03, 0x52, 0xB3, 0x3F, 0x27, 0x13, 0x48, 0xCA, 0x45, 0x3A, 0xB2, 0x9F, 0x7B,
-    0x3C, 0x22, 0xAE, 0xD3, 0x91, 0x90, 0xBA, 0x6C, 0xEE, 0x0D, 0x32, 0x90, 0x17, 0x55, 0xB8, 0xD4,
-    0x36, 0x2A, 0xA6, 0x16, 0x7D, 0xCD, 0x07, 0x7C, 0xAC, 0x2E, 0x8E, 0xA1, 0xAB, 0xB8, 0xC7, 0x51,
-    0x8B, 0xEA, 0x13, 0x88, 0xBA, 0x28, 0xC5, 0x7A, 0xBC, 0x9F, 0x57, 0xA2, 0x69, 0x20, 0xD7, 0x8B,
-    0x0C, 0x2E, 0x93, 0x0C, 0x00, 0x75, 0x6E, 0x76, 0x00, 0x0E, 0x6A, 0x5E, 0xCF, 0x45, 0x02, 0x3A,
-    0xDC, 0x47, 0xF6, 0x75, 0x06, 0x19, 0x53, 0x9B, 0xA9, 0x4B, 0x59, 0x99, 0xD2, 0x7A, 0x07, 0x39,
-    0x81, 0x78, 0x3C, 0x69, 0x53, 0xBF, 0xCD, 0xFD, 0x59, 0xF8, 0xC8, 0x35, 0xC1, 0xCB, 0xC0, 0xE9,
-    0xC5, 0x73, 0x89, 0x93, 0x0B, 0x6C, 0xF4, 0xB5, 0x41, 0xF6, 0x94, 0xAD, 0xB6, 0x74, 0x4A, 0x5B,
-    0x93, 0x3B, 0x3E, 0x88, 0x6C, 0xF3, 0x51, 0xF6, 0x77, 0x8A, 0x96, 0xFD, 0x4C, 0x2E, 0x03, 0x64,
-    0xBD, 0xD2, 0x0D, 0xEC, 0xB4, 0x57, 0xB8, 0xD6, 0x85, 0x2C, 0x9E, 0x17, 0x89, 0xC4, 0x38, 0x57,
-    0xA2, 0xF0, 0x4F, 0x8B, 0x7D, 0xDE, 0xA8, 0xC9, 0x72, 0x6E, 0xDE, 0x27, 0xF8, 0xF1, 0xCE, 0x5E,
-    0x9B, 0x84, 0x07, 0x64, 0xD0, 0x95, 0xE3, 0x2E, 0xAB, 0xDB, 0x2A, 0x37, 0xE6, 0xF8, 0xCE, 0xBE,
-    0x1C, 0x7C, 0xF2, 0xC1, 0x4F, 0x79, 0x7A, 0x3B, 0x02, 0xFF, 0x1B, 0x36, 0xA4, 0x3C, 0xAD, 0x39,
-    0xEF, 0xB9, 0x9D, 0x61, 0xF4, 0x36, 0x4B, 0x9A, 0xCB, 0xB3, 0x25, 0xCD, 0x87, 0xB9, 0xA4, 0xF9,
-    0xEB, 0x5C, 0xD2, 0x54, 0x5C, 0xD2, 0x1C, 0xA5, 0x93, 0x7E, 0x32, 0x7F, 0xE2, 0xD3, 0xBA, 0x11,
-    0x6A, 0x0E, 0xC4, 0xDE, 0xE8, 0xF0, 0xA9, 0xF8, 0xAB, 0x0C, 0x25, 0x48, 0xAB, 0x12, 0x3E, 0xCE,
-    0xC2, 0xDE, 0x01, 0x1D, 0x60, 0x76, 0xD6, 0xDB, 0x58, 0x45, 0x5F, 0xD6, 0xFD, 0x6F, 0x66, 0x71,
-    0x0B, 0x9A, 0x67, 0x8E, 0x92, 0xFA, 0xC8, 0x92, 0xCD, 0x25, 0x13, 0x2F, 0xF3, 0xB6, 0x33, 0x04,
-    0x08, 0xAE, 0x1B, 0xB5, 0x78, 0x40, 0x49, 0xB2, 0x20, 0x1F, 0xB9, 0x3B, 0xB2, 0xD0, 0x4A, 0xEF,
-    0x87, 0x6E, 0x96, 0xD0, 0x8C, 0x3B, 0xE7, 0xB0, 0xCE, 0xB9, 0xEB, 0xEA, 0xF3, 0x74, 0x1B, 0xD2,
-    0x6C, 0x34, 0xD2, 0xFC, 0x87, 0xED, 0x08, 0x60, 0x20, 0xEF, 0x80, 0x34, 0x43, 0xE4, 0x83, 0x05,
-    0x3D, 0x79, 0x62, 0x5C, 0xE8, 0x98, 0x48, 0x73, 0x37, 0xCE, 0xA9, 0x57, 0xF8, 0x9C, 0x3A, 0x1F,
-    0x3B, 0xB5, 0x8E, 0xEE, 0x3A, 0x1B, 0x73, 0x68, 0xFC, 0xEB, 0x63, 0xD5, 0x70, 0xBF, 0xB4, 0x4F,
-    0x6E, 0xC8, 0xBA, 0x86, 0xDB, 0x3A, 0x47, 0x93, 0xA2, 0xB2, 0xEE, 0xBC, 0xCA, 0xB8, 0x5B, 0x71,
-    0x77, 0xA7, 0x63, 0x74, 0x6C, 0xA5, 0x2E, 0xAA, 0xD7, 0x7E, 0xF0, 0x6F, 0x08, 0x49, 0xB2, 0x87,
-    0x18, 0x76, 0x38, 0x10, 0x66, 0x7E, 0xAF, 0xB0, 0xE0, 0xF3, 0x90, 0x20, 0xD0, 0xAD, 0x42, 0x34,
-    0x7E, 0x63, 0xEA, 0xB4, 0xA5, 0x98, 0x7D, 0x73, 0xC3, 0x15, 0x3E, 0x0C, 0x5F, 0xE1, 0xEE, 0x0C,
-    0x1D, 0xC8, 0x82, 0x89, 0x49, 0xE9, 0xB6, 0x3A, 0x43, 0x97, 0x7F, 0x4E, 0x35, 0xCB, 0x78, 0x64,
-    0x15, 0xCA, 0x9D, 0x39, 0x8F, 0xBB, 0x8D, 0x53, 0x99, 0x3F, 0xCA, 0x3E, 0xF8, 0x8B, 0xFA, 0x54,
-    0xE6, 0xCF, 0x27, 0xF5, 0x65, 0xFE, 0x0B, 0xD6, 0xF7, 0xD3, 0x77, 0xE8, 0x88, 0x5D, 0xAD, 0xC0,
-    0x42, 0x76, 0x34, 0x6B, 0x27, 0x8D, 0xE0, 0xA7, 0x1A, 0x3C, 0x75, 0x44, 0xC9, 0xB5, 0x8E, 0x16,
-    0xF7, 0xAB, 0x71, 0x53, 0x8F, 0xC4, 0xDE, 0xBF, 0x81, 0x78, 0x72, 0x25, 0xD2, 0xBA, 0x15, 0xF7,
-    0x90, 0x81, 0x50, 0x8D, 0x2C, 0xD4, 0x00, 0x7B, 0xE0, 0xB2, 0x31, 0x8F, 0xB0, 0xA4, 0xFD, 0xDA,
-    0x4C, 0x3E, 0x42, 0xC8, 0x53, 0x10, 0x72, 0x01, 0x42, 0xFE, 0xAF, 0x59, 0x21, 0x81, 0x5C, 0xB4,
-    0x00, 0x21, 0xF7, 0xDE, 0xAC, 0x0F, 0x60, 0x67, 0x55, 0x7D, 0x97, 0x6F, 0xFD, 0x7D, 0x48, 0xDC,
-    0x90, 0x70, 0x3D, 0xA3, 0x53, 0x92, 0x1E, 0xF2, 0xF7, 0x19, 0xB3, 0x55, 0xF5, 0x1D, 0xAD, 0xC3,
-    0x1F, 0x6A, 0x1B, 0x1E, 0x64, 0xC4, 0x0D, 0x80, 0x9B, 0x70, 0xC0, 0x52, 0x1F, 0xB0, 0xC6, 0x3B,
-    0xFB, 0x0D, 0x49, 0xF7, 0xBE, 0x76, 0xB9, 0xF7, 0x75, 0x67, 0x01, 0x4D, 0x17, 0x6F, 0xD2, 0x5A,
-    0x57, 0x4B, 0x6E, 0x66, 0xBE, 0xA6, 0x12, 0xD1, 0x42, 0xB2, 0x9A, 0xF5, 0x8C, 0x21, 0x10, 0x07,
-    0xDC, 0x9B, 0x7B, 0x11, 0x4B, 0x3E, 0xAF, 0x6D, 0x0A, 0x68, 0x74, 0x43, 0x01, 0xCD, 0x78, 0x81,
-    0xEB, 0xE9, 0x05, 0x19, 0xC3, 0x27, 0xB3, 0x64, 0x99, 0xDA, 0x4B, 0x22, 0xB2, 0xAE, 0x1F, 0x81,
-    0x02, 0x0A, 0x38, 0xE1, 0xD6, 0x1B, 0x30, 0x2F, 0x8F, 0xDB, 0x7D, 0xBC, 0xCB, 0xAB, 0x2F, 0xEA,
-    0xCC, 0xD1, 0x1D, 0x57, 0xE2, 0xDD, 0x48, 0x03, 0x38, 0xA8, 0x7D, 0x6E, 0x4B, 0x4E, 0x99, 0xE0,
-    0x72, 0xE5, 0x4C, 0xEC, 0xB3, 0xC1, 0x6A, 0xB6, 0x32, 0x92, 0xAD, 0x07, 0x7C, 0xEB, 0xE2, 0x37,
-    0x92, 0xFE, 0xD3, 0x85, 0x67, 0xBF, 0xA9, 0x2B, 0xB4, 0xBC, 0x76, 0x0C, 0x81, 0x9C, 0xA0, 0xC7,
-    0x09, 0xB4, 0x35, 0xAE, 0x9F, 0xDF, 0x5C, 0x14, 0x09, 0x51, 0x82, 0x4F, 0x26, 0x4A, 0x39, 0x86,
-    0x53, 0xBE, 0x69, 0xEF, 0x38, 0x71, 0xDE, 0xF5, 0xB1, 0x04, 0x1C, 0x8C, 0xB4, 0x80, 0xAC, 0xE4,
-    0xC3, 0x75, 0xD9, 0xE3, 0xCB, 0xF8, 0xEB, 0x13, 0x75, 0xA2, 0x4F, 0x7E, 0x56, 0xF6, 0xD4, 0xE9,
-    0x92, 0xEE, 0x71, 0xF5, 0xEA, 0x7C, 0xAD, 0x29, 0x3C, 0xEC, 0x9F, 0xDE, 0xB5, 0x87, 0x5B, 0xD2,
-    0x7E, 0x93, 0x54, 0xA4, 0xA4, 0x90, 0xA6, 0x42, 0x24, 0x51, 0x29, 0x02, 0x11, 0x9F, 0xE2, 0xF3,
-    0x01, 0x26, 0xA7, 0x5C, 0xE7, 0x5A, 0x1A, 0xA3, 0xF2, 0x82, 0xC3, 0x87, 0x79, 0x81, 0xF3, 0x00,
-    0x12, 0x57, 0x34, 0x3F, 0x1E, 0x8D, 0x78, 0x40, 0xE7, 0xA5, 0xB7, 0x78, 0xED, 0xCB, 0xE2, 0x68,
-    0xCE, 0x61, 0x56, 0xB7, 0xCC, 0x85, 0x7C, 0xEE, 0xC2, 0xCD, 0xB0, 0x00, 0x72, 0x24, 0x08, 0x8B,
-    0x00, 0x49, 0xBB, 0x40, 0x62, 0xB3, 0x89, 0x40, 0x1B, 0x56, 0xD3, 0xC3, 0x48, 0x6A, 0x88, 0xC0,
-    0xCA, 0x7D, 0x6C, 0xA2, 0x9C, 0xE1, 0x98, 0x57, 0x79, 0x15, 0x62, 0xF8, 0xE9, 0x73, 0xC9, 0x5B,
-    0x9E, 0x47, 0xDF, 0x34, 0x65, 0x93, 0x3B, 0x52, 0xB6, 0xBA, 0xFA, 0x43, 0xE6, 0x35, 0xA5, 0x5B,
-    0x39, 0x58, 0xD7, 0x21, 0x6B, 0x7B, 0x99, 0xF5, 0x5D, 0xD4, 0x0D, 0x42, 0x25, 0xF6, 0x02, 0xE9,
-    0x4F, 0xCC, 0xAC, 0x5E, 0x8E, 0xAD, 0x00, 0x21, 0xF2, 0x3E, 0x0E, 0xF7, 0x4C, 0x3B, 0x69, 0x7A,
-    0x36, 0x09, 0x4F, 0x6E, 0x0D, 0x52, 0x65, 0x3F, 0xFB, 0xBA, 0xF3, 0x58, 0x84, 0x7C, 0x5C, 0x1C,
-    0x24, 0x31, 0x48, 0xDC, 0x2B, 0xE0, 0xBC, 0x25, 0x68, 0x99, 0xCF, 0x7C, 0xCC, 0x5F, 0xAF, 0x73,
-    0x7D, 0x8C, 0x6F, 0x48, 0x70, 0x30, 0x17, 0x44, 0xE5, 0xD2, 0xDD, 0x6D, 0x49, 0xF4, 0x26, 0x18,
-    0xDE, 0x1B, 0x33, 0x7D, 0x6B, 0x47, 0x16, 0x7F, 0x5B, 0xE7, 0xDB, 0xBF, 0xF8, 0x05, 0x29, 0x16,
-    0xC3, 0x4C, 0x54, 0x61, 0x24, 0x98, 0x22, 0x3C, 0xDD, 0xD4, 0x5F, 0xB2, 0x7A, 0x34, 0xE3, 0xCE,
-    0xE7, 0x2C, 0xC9, 0x24, 0x67, 0x71, 0xF9, 0xA9, 0x09, 0xAD, 0xFE, 0x7A, 0x1D, 0xDA, 0xD0, 0x33,
-    0x36, 0x21, 0x4F, 0xD3, 0xE4, 0xC9, 0x16, 0x20, 0x07, 0x40, 0x0A, 0x90, 0x01, 0xF4, 0x5A, 0xDC,
-    0xCB, 0xED, 0x32, 0xFD, 0x07, 0xFB, 0x07, 0xF9, 0xD7, 0xEF, 0xE7, 0xC1, 0xFC, 0x1F, 0x45, 0x28,
-    0xEA, 0x4D, 0xAA, 0x4F, 0x50, 0x9E, 0xF5, 0x66, 0xC4, 0xFE, 0xC0, 0xAE, 0x7F, 0x17, 0xB3, 0xAE,
-    0x7C, 0xD2, 0x60, 0x5B, 0xB7, 0x22, 0xC4, 0x13, 0x86, 0x66, 0x66, 0x93, 0x2E, 0xF5, 0xDB, 0xCA,
-    0xBA, 0xFE, 0xC0, 0xA7, 0xEF, 0xFC, 0x30, 0x75, 0x86, 0x3D, 0xEA, 0xD6, 0x50, 0xE2, 0xD4, 0xC5,
-    0xF8, 0x05, 0xDE, 0x84, 0x3B, 0xD6, 0xA0, 0xC6, 0x31, 0x5D, 0x43, 0xE2, 0x52, 0x53, 0xA8, 0x75,
-    0xA6, 0xCF, 0x4B, 0xD1, 0xBF, 0x77, 0x0E, 0x3C, 0x3E, 0x44, 0xF2, 0xB4, 0xD2, 0x80, 0x2C, 0x6C,
-    0x25, 0x08, 0xBC, 0x0F, 0x7C, 0x86, 0xDD, 0xB1, 0x3F, 0x1A, 0x77, 0xC7, 0x4E, 0xEA, 0xE8, 0x35,
-    0x3C, 0xEA, 0x45, 0x36, 0x4A, 0xA7, 0x6C, 0xD6, 0x0D, 0x3E, 0x5E, 0xAF, 0xC6, 0x5B, 0x7F, 0x9C,
-    0x07, 0xF6, 0x73, 0xDC, 0xAB, 0x71, 0xAD, 0x30, 0xB9, 0xBC, 0xD0, 0x50, 0xA4, 0xA7, 0xC7, 0x34,
-    0xE9, 0xA1, 0x31, 0xEC, 0x71, 0xF5, 0x79, 0x6E, 0x9B, 0x3F, 0x74, 0xA7, 0xF0, 0xEE, 0x6B, 0xE3,
-    0x6A, 0x4C, 0x7C, 0x72, 0x49, 0x17, 0xCD, 0x37, 0xA3, 0x69, 0x27, 0xF6, 0x21, 0x13, 0x11, 0x23,
-    0x43, 0x5E, 0x2E, 0x9E, 0xC9, 0x9B, 0x74, 0x6D, 0xF7, 0x04, 0x6F, 0x3E, 0x4F, 0x75, 0xD6, 0x53,
-    0x3F, 0x43, 0xC2, 0x59, 0x93, 0xFD, 0xDF, 0x38, 0x03, 0x88, 0xD9, 0x2D, 0x65, 0x43, 0x50, 0xD7,
-    0x75, 0xBD, 0x15, 0xCA, 0x6C, 0x77, 0xFA, 0x5C, 0x8A, 0x86, 0xAA, 0x3A, 0x4F, 0x70, 0xC7, 0x96,
-    0xE0, 0xA2, 0x70, 0x9B, 0xA9, 0x43, 0x65, 0x6E, 0x93, 0xBD, 0x0D, 0xC4, 0xAE, 0xE9, 0xDE, 0xBD,
-    0xB4, 0xE2, 0x24, 0xA7, 0xCC, 0xAB, 0x3D, 0x0D, 0x0C, 0x4D, 0xE9, 0xF9, 0x20, 0x6C, 0xC6, 0x28,
-    0xBC, 0x44, 0x1F, 0xAD, 0x4A, 0x9F, 0x1B, 0x4D, 0x5B, 0x4E, 0xE4, 0x1E, 0xCD, 0x44, 0x5A, 0x38,
-    0xB2, 0xEB, 0xF8, 0xD7, 0xD5, 0xE3, 0x52, 0x35, 0xA5, 0x1E, 0xDA, 0xC3, 0x20, 0x5F, 0x79, 0x98,
-    0x39, 0xAF, 0x66, 0x55, 0xAC, 0x0D, 0x48, 0xE3, 0x11, 0x43, 0x3F, 0x3F, 0xA3, 0x45, 0xBF, 0xCB,
-    0x8F, 0x32, 0x7D, 0x8F, 0xCF, 0xC9, 0x58, 0x7D, 0x32, 0x60, 0x50, 0xE3, 0x83, 0x48, 0x38, 0x9C,
-    0xF5, 0xEE, 0x13, 0x29, 0x53, 0x51, 0xA2, 0xAB, 0x9D, 0x8D, 0x3A, 0x49, 0x03, 0x95, 0xC8, 0xD9,
-    0x15, 0x53, 0x6F, 0x85, 0xBA, 0x7F, 0xA4, 0x52, 0x01, 0x23, 0x7A, 0x60, 0x37, 0x79, 0xC7, 0x32,
-    0xE7, 0x25, 0x39, 0x3D, 0x54, 0x9E, 0x2B, 0x9F, 0x76, 0x54, 0x65, 0x67, 0x9B, 0x60, 0x2B, 0x47,
-    0x41, 0x59, 0xA4, 0x21, 0x97, 0xA8, 0xB7, 0x88, 0xF0, 0x15, 0x85, 0x56, 0xE6, 0x9D, 0xAF, 0x16,
-    0xDE, 0xBF, 0x32, 0x0C, 0x2F, 0x54, 0x63, 0xEE, 0xA2, 0xB3, 0x7F, 0x7E, 0x22, 0x89, 0xB3, 0xFB,
-    0xD1, 0xAA, 0xD4, 0x0F, 0x87, 0xC0, 0xB5, 0xCC, 0x37, 0xA3, 0xFB, 0xA9, 0x3E, 0x46, 0x6B, 0x92,
-    0x01, 0x92, 0x7D, 0x5D, 0xA6, 0x0C, 0xCF, 0x6A, 0x6C, 0x66, 0xA2, 0x1F, 0x7C, 0x5D, 0x27, 0x08,
-    0x9A, 0x04, 0x07, 0x9D, 0x52, 0xD3, 0xB1, 0x36, 0xDD, 0x47, 0xF3, 0xC4, 0x1D, 0x92, 0x02, 0x76,
-    0x67, 0x27, 0x2E, 0xFC, 0x1F, 0x00, 0x50, 0xE9, 0x87, 0x00, 0x6B, 0x9E, 0x3C, 0x74, 0x10, 0xCC,
-    0xD5, 0x56, 0xB6, 0x6C, 0xCA, 0x16, 0xE8, 0xB2, 0xF5, 0x5A, 0x6E, 0x27, 0x88, 0x11, 0x45, 0x88,
-    0xBB, 0xBB, 0xC9, 0x3A, 0xB8, 0x82, 0x88, 0x06, 0xB0, 0x0E, 0x98, 0xE2, 0xE3, 0x67, 0x5E, 0x89,
-    0x7A, 0x03, 0xA9, 0x46, 0x56, 0x69, 0xCD, 0x84, 0x1B, 0x38, 0x14, 0x14, 0x3A, 0x0F, 0xE7, 0xB7,
-    0x01, 0xDD, 0xA4, 0xFB, 0x9E, 0x9B, 0x84, 0xBB, 0xAE, 0x6B, 0x23, 0xEE, 0x5D, 0x3E, 0xCB, 0xE7,
-    0x09, 0x9C, 0x9B, 0x7C, 0x69, 0x5A, 0xD1, 0xE7, 0x3C, 0xEA, 0xDA, 0x2A, 0x2F, 0x38, 0xB9, 0x31,
-    0xB9, 0x3A, 0x85, 0x3B, 0x7D, 0x7C, 0x38, 0x4F, 0x27, 0x15, 0x80, 0x50, 0x6B, 0x84, 0x43, 0xF7,
-    0xBD, 0x66, 0xFE, 0x10, 0x9B, 0xC4, 0x20, 0xFB, 0xD8, 0xE7, 0xF6, 0x73, 0x2F, 0x20, 0xB2, 0x0D,
-    0x29, 0xFC, 0x5A, 0x05, 0xAF, 0xAB, 0x0C, 0x5D, 0xF5, 0x9C, 0xCD, 0xDD, 0x4B, 0x24, 0x1A, 0xEF,
-    0x40, 0x58, 0xEC, 0x7F, 0x3F, 0x26, 0xEB, 0x35, 0xF0, 0x34, 0x27, 0x35, 0x0A, 0x17, 0x08, 0x16,
-    0x9E, 0x2D, 0xF4, 0x91, 0xC5, 0xA4, 0x57, 0x39, 0x0A, 0x95, 0x99, 0xB5, 0x77, 0x01, 0xB6, 0x20,
-    0xEB, 0x20, 0xF5, 0xD6, 0x9C, 0xAC, 0xD7, 0xB7, 0x2E, 0xA4, 0x2D, 0x61, 0xCA, 0x76, 0x77, 0x7C,
-    0x36, 0xEC, 0xC0, 0xFC, 0x36, 0xBC, 0xC8, 0xAA, 0xF7, 0x4A, 0xFF, 0x3C, 0xB8, 0x42, 0xDC, 0xC9,
-    0x38, 0x7C, 0x42, 0x72, 0x7F, 0xE4, 0xAE, 0xBA, 0x89, 0x72, 0x2C, 0x00, 0xCB, 0x03, 0x01, 0x9E,
-    0x43, 0xBE, 0xE3, 0x93, 0x89, 0x7D, 0x16, 0xC7, 0x90, 0x93, 0x7A, 0xB8, 0x29, 0x46, 0x14, 0x18,
-    0xAD, 0x65, 0x34, 0x6E, 0xB8, 0x78, 0xEA, 0xF3, 0x46, 0xB1, 0xBC, 0xA3, 0x7F, 0xA1, 0x9B, 0x81,
-    0xC3, 0x3B, 0x51, 0xB9, 0xAB, 0x0E, 0xC0, 0xE0, 0xE9, 0x9B, 0x7D, 0x08, 0xE5, 0xC1, 0x49, 0xCC,
-    0x1C, 0x11, 0x1C, 0x52, 0x4D, 0xDA, 0xF3, 0x16, 0x74, 0xFA, 0x67, 0x15, 0x9A, 0x57, 0x4D, 0x1F,
-    0x24, 0x9C, 0xFC, 0x3C, 0x4F, 0x9D, 0x68, 0x2E, 0x11, 0x05, 0xA0, 0x4B, 0x81, 0x9C, 0xDB, 0x88,
-    0xB6, 0xC4, 0x8D, 0x2E, 0x2C, 0x60, 0x1A, 0x73, 0x55, 0xDC, 0x31, 0x73, 0x06, 0xE4, 0xBD, 0x82,
-    0x9F, 0x56, 0xA2, 0x05, 0x5F, 0x67, 0xFB, 0xA3, 0xEB, 0x1A, 0x7D, 0xAE, 0xF0, 0xA3, 0x68, 0xD4,
-    0x6F, 0x31, 0x53, 0xB2, 0xB9, 0x0B, 0x84, 0xB8, 0x8D, 0x9B, 0x1F, 0xCE, 0x41, 0x7A, 0x5C, 0x72,
-    0x0A, 0xDB, 0x03, 0x5A, 0x58, 0x85, 0x99, 0xC1, 0x4D, 0xBB, 0x91, 0x97, 0x39, 0x39, 0x00, 0x54,
-    0xA5, 0xCE, 0xB4, 0x27, 0x70, 0xB7, 0x11, 0x31, 0xA4, 0xB0, 0xDA, 0x42, 0xED, 0x1B, 0x93, 0x65,
-    0xD6, 0xFA, 0xAF, 0x0C, 0xDC, 0xDD, 0xC5, 0x86, 0xAB, 0xBD, 0xC2, 0x4E, 0x8B, 0xE3, 0xC9, 0xB9,
-    0x12, 0x61, 0xC7, 0x39, 0x79, 0x0C, 0x33, 0xFF, 0xDD, 0x5F, 0x71, 0x11, 0xE4, 0x15, 0x5D, 0x02,
-    0xF9, 0x31, 0xA7, 0xAF, 0xEE, 0xB7, 0x31, 0xF5, 0xB3, 0xEF, 0xE5, 0xBB, 0x22, 0x19, 0x08, 0xFB,
-    0xB9, 0xCA, 0x4A, 0x95, 0x1C, 0xD0, 0xD3, 0xF6, 0x54, 0x1B, 0x91, 0xF7, 0x58, 0xEE, 0x4C, 0xD4,
-    0xB0, 0xFB, 0x05, 0x7E, 0x9E, 0x53, 0xFC, 0x09, 0x6E, 0x14, 0x8F, 0x66, 0x56, 0x76, 0xA8, 0x69,
-    0x40, 0x88, 0xE9, 0xC1, 0x21, 0x36, 0x2F, 0xD1, 0xE5, 0x89, 0x90, 0xA9, 0x28, 0x59, 0x6F, 0x67,
-    0x46, 0x51, 0x19, 0x95, 0x7B, 0xBD, 0x1A, 0x13, 0xE2, 0x0F, 0x77, 0x96, 0x0C, 0x12, 0xFB, 0xBA,
-    0xDC, 0x4B, 0x05, 0xD7, 0xF9, 0xC1, 0x7A, 0xB8, 0x10, 0x98, 0x70, 0x85, 0xC8, 0x94, 0x87, 0x4C,
-    0x09, 0xE5, 0x8E, 0xD6, 0x92, 0x70, 0x38, 0xEE, 0x36, 0x86, 0x2F, 0x0C, 0xE9, 0xDA, 0x2A, 0x42,
-    0x09, 0x74, 0x94, 0x21, 0x88, 0x33, 0xA7, 0x65, 0xA2, 0xA7, 0x0F, 0x76, 0x86, 0xBA, 0xD3, 0xA3,
-    0x6E, 0xA6, 0xB7, 0xF5, 0xEB, 0x1E, 0xC4, 0x56, 0x9F, 0xFB, 0x83, 0xA9, 0x4B, 0xDE, 0x56, 0x35,
-    0xE9, 0xF4, 0x87, 0xD7, 0x49, 0xB0, 0x02, 0x5C, 0x5B, 0x26, 0xAC, 0xC1, 0x68, 0xAA, 0x98, 0x6C,
-    0x67, 0x5C, 0x79, 0x70, 0x21, 0xEC, 0x01, 0xB6, 0xFF, 0xA6, 0x1C, 0xC4, 0x98, 0x17, 0x1B, 0xB8,
-    0xB4, 0x17, 0x11, 0xE0, 0xB4, 0x59, 0xF2, 0x49, 0x07, 0x3D, 0x32, 0xED, 0x9D, 0x35, 0x75, 0x12,
-    0xEB, 0xEE, 0x70, 0xFA, 0xCF, 0xE4, 0xF1, 0x9B, 0x4F, 0x90, 0xD6, 0x7F, 0xA8, 0xD9, 0x72, 0x9E,
-    0xAB, 0x5C, 0x96, 0xE4, 0x08, 0xD0, 0x9E, 0x69, 0xB3, 0xF8, 0x8C, 0x56, 0xF0, 0xF9, 0x39, 0xB2,
-    0x5F, 0x2D, 0xD8, 0x8D, 0x0D, 0x8A, 0x3E, 0x71, 0x0B, 0x86, 0x99, 0x9E, 0xAB, 0x1D, 0xB6, 0xF2,
-    0x66, 0xE4, 0x7F, 0x30, 0x02, 0x16, 0x21, 0x9F, 0xDB, 0x7E, 0x42, 0x62, 0x27, 0x4F, 0xE3, 0x25,
-    0x80, 0xC0, 0x46, 0x81, 0xCD, 0x0A, 0xB8, 0xBD, 0xFC, 0x24, 0xD6, 0xFD, 0x66, 0xD3, 0x5D, 0xD0,
-    0xC7, 0x87, 0x6D, 0x0C, 0xE6, 0x42, 0x05, 0xE2, 0x99, 0x02, 0x76, 0x03, 0x62, 0x9E, 0x5A, 0x23,
-    0x50, 0x1E, 0x6F, 0xD4, 0x08, 0x76, 0xB3, 0x10, 0xC6, 0x2D, 0xEB, 0xB9, 0x80, 0xDB, 0x23, 0x84,
-    0x65, 0x16, 0xB2, 0x2F, 0xE4, 0x41, 0x41, 0x40, 0x42, 0x44, 0xCE, 0x99, 0x9C, 0x3B, 0xB9, 0x72,
-    0x77, 0x2B, 0x37, 0xC6, 0x66, 0xF7, 0x93, 0xEC, 0x79, 0xB8, 0x6D, 0x25, 0x39, 0x3B, 0x95, 0xB4,
-    0xBA, 0x7A, 0xF6, 0x4D, 0x88, 0xC4, 0xE2, 0xC4, 0xB7, 0x52, 0x52, 0x32, 0x55, 0x12, 0x36, 0xD4,
-    0x7D, 0xEC, 0xC3, 0x4A, 0xBA, 0x2E, 0x21, 0xA3, 0x9D, 0x3A, 0x67, 0x52, 0x03, 0xD6, 0xD2, 0x83,
-    0x90, 0x50, 0xD2, 0xE3, 0x64, 0x5F, 0x80, 0xFB, 0x41, 0x4A, 0x31, 0x55, 0x12, 0xDB, 0x63, 0x15,
-    0xEE, 0xE0, 0x24, 0xBF, 0xBA, 0xA2, 0x4B, 0x8C, 0xD7, 0x20, 0x62, 0x6A, 0xE7, 0xF3, 0x98, 0xF7,
-    0x4B, 0x3A, 0x13, 0x08, 0x34, 0x13, 0x5E, 0x3D, 0x0B, 0x70, 0x57, 0xD3, 0x6A, 0xB3, 0x6B, 0x42,
-    0x71, 0x8B, 0x40, 0x81, 0x8A, 0xCF, 0xF0, 0x06, 0xE9, 0x24, 0x19, 0x07, 0xF8, 0xC8, 0x3E, 0x5B,
-    0xFA, 0x2C, 0xF8, 0x20, 0xDB, 0xA6, 0x92, 0x5B, 0xF8, 0x80, 0x60, 0xE0, 0x5E, 0x20, 0x57, 0xC7,
-    0x39, 0xEF, 0x3B, 0x64, 0xC8, 0x75, 0x2B, 0xDB, 0x3C, 0x99, 0xCC, 0x04, 0x36, 0x6E, 0xB8, 0xC3,
-    0xFE, 0xCD, 0x34, 0x67, 0xDF, 0x9D, 0xE7, 0x6F, 0xCD, 0xD5, 0xE7, 0xF1, 0x51, 0xB1, 0x23, 0xE8,
-    0xDC, 0xC9, 0x16, 0x58, 0x3B, 0x39, 0x47, 0xAC, 0x62, 0x12, 0x67, 0xE4, 0xDD, 0x5E, 0x0B, 0x25,
-    0x87, 0xB0, 0x29, 0xA5, 0x76, 0xF2, 0xA9, 0x87, 0xDF, 0x85, 0x96, 0x5E, 0x23, 0x03, 0x95, 0xDF,
-    0x04, 0x48, 0x79, 0x17, 0xE0, 0x60, 0x19, 0xC4, 0xCA, 0x7E, 0xFA, 0xAE, 0x2E, 0x4C, 0x07, 0x47,
-    0xF0, 0xCE, 0x98, 0x1F, 0xDE, 0xEC, 0x13, 0xFB, 0xBE, 0xF5, 0x6C, 0x7A, 0x57, 0x16, 0xE8, 0x70,
-    0x2B, 0xEB, 0xAB, 0xFC, 0x50, 0xCF, 0xF2, 0x0C, 0x38, 0x1B, 0x9D, 0xC7, 0x54, 0xAA, 0x0A, 0x2F,
-    0x72, 0x10, 0x09, 0xF9, 0x79, 0x1F, 0x7E, 0x96, 0x47, 0x27, 0x58, 0xDC, 0x1E, 0xCA, 0xFD, 0x31,
-    0x26, 0xF7, 0x88, 0x02, 0xB9, 0xD5, 0x46, 0x53, 0x3E, 0x73, 0x52, 0x9A, 0xFE, 0x0F, 0x2D, 0xF4,
-    0x63, 0xCF, 0x08, 0x62, 0x9C, 0x4F, 0x3C, 0x7C, 0x2F, 0x53, 0x09, 0x71, 0x26, 0x9F, 0xF8, 0x06,
-    0xF2, 0xAC, 0xBF, 0x1E, 0xF1, 0x73, 0x1D, 0x2D, 0x70, 0x9B, 0x08, 0x8E, 0xE7, 0x5B, 0x52, 0xBC,
-    0x01, 0x32, 0xBC, 0xA1, 0xE3, 0xA1, 0x75, 0x5E, 0x57, 0x5E, 0x01, 0x8F, 0x6E, 0x7A, 0x27, 0x9E,
-    0x63, 0xBE, 0xD6, 0x34, 0xA6, 0x8C, 0xEB, 0xA4, 0x4D, 0x4B, 0xF5, 0x24, 0xE3, 0xFE, 0xA8, 0xC7,
-    0x33, 0xEE, 0x81, 0x7C, 0x80, 0xB9, 0xEE, 0xF7, 0x39, 0xD1, 0xE6, 0xCE, 0xAD, 0x84, 0xEB, 0x72,
-    0xBA, 0x73, 0x38, 0xE3, 0x44, 0xCF, 0x28, 0xF5, 0xB9, 0xC0, 0xB2, 0x1B, 0xED, 0x24, 0x72, 0xFB,
-    0x3B, 0xA4, 0x2B, 0x09, 0x09, 0x47, 0x22, 0xFE, 0x1F, 0x44, 0xE8, 0x08, 0xC7, 0x0F, 0x37, 0xEA,
-    0x32, 0xB7, 0x59, 0xF7, 0xCE, 0x15, 0x5A, 0xA8, 0x40, 0xA7, 0xCA, 0xAE, 0xE2, 0x36, 0x31, 0x67,
-    0x6B, 0xC8, 0x05, 0x06, 0x86, 0x7D, 0xE2, 0xA7, 0xA7, 0x3C, 0x16, 0x35, 0xA8, 0x9F, 0xB6, 0xE1,
-    0xCB, 0xA9, 0x93, 0xF2, 0x65, 0x6E, 0x9D, 0x9B, 0x53, 0x83, 0x6C, 0xB0, 0x62, 0xAB, 0x51, 0xA4,
-    0xA6, 0xC5, 0xD2, 0x95, 0x87, 0x6B, 0xE2, 0xC6, 0x7E, 0x41, 0xBB, 0x8C, 0xD9, 0x33, 0xA6, 0x4F,
-    0xD5, 0xBA, 0x7C, 0x47, 0x3A, 0x73, 0x38, 0x41, 0xD5, 0xDD, 0xFF, 0x89, 0x6E, 0xF6, 0x80, 0x0D,
-    0x8F, 0x4B, 0xDA, 0x1F, 0xDD, 0xB1, 0x03, 0x93, 0x7B, 0x3A, 0xBC, 0x92, 0x87, 0x1F, 0x24, 0x74,
-    0x3F, 0x97, 0x11, 0x1E, 0x4B, 0xAD, 0x8A, 0xF6, 0x44, 0x77, 0xE1, 0xF0, 0x06, 0x9B, 0xC2, 0x3D,
-    0xAB, 0x3B, 0x3A, 0xC6, 0x33, 0x7E, 0x90, 0x52, 0x23, 0xF3, 0x20, 0xFA, 0xD8, 0x87, 0x37, 0x4D,
-    0x03, 0xBE, 0x4F, 0x21, 0x17, 0xEA, 0xB4, 0xF9, 0x35, 0x26, 0x78, 0x18, 0x63, 0x73, 0x0F, 0x12,
-    0x57, 0xF1, 0x3F, 0x7A, 0x1D, 0x86, 0x5E, 0x07, 0xE7, 0x61, 0x8F, 0x0C, 0x56, 0x75, 0xDD, 0xE9,
-    0xF6, 0x1F, 0x96, 0xFC, 0x08, 0x49, 0x2D, 0x4E, 0xED, 0xC4, 0xAD, 0x1F, 0x15, 0xF8, 0xFF, 0x95,
-    0x54, 0xBF, 0x6F, 0x1B, 0x37, 0x14, 0xFE, 0x78, 0x54, 0x42, 0xD4, 0x8C, 0x4D, 0x0F, 0xCE, 0x10,
-    0xD4, 0x36, 0x97, 0x0E, 0x29, 0x20, 0xDB, 0x19, 0x3C, 0x68, 0x38, 0x49, 0x8C, 0x35, 0x78, 0xE8,
-    0x10, 0x0F, 0xD6, 0x1A, 0xA4, 0x4B, 0xD1, 0xAD, 0x06, 0xDA, 0xC1, 0xC3, 0xC9, 0xB9, 0xD4, 0x40,
-    0x83, 0x6E, 0x45, 0xD1, 0x3F, 0xC0, 0x40, 0x97, 0xD4, 0x1D, 0xAA, 0x41, 0x01, 0x52, 0x40, 0xB6,
-    0x69, 0x7B, 0x08, 0xD0, 0x2C, 0x74, 0x3C, 0x74, 0xE8, 0xD0, 0x2B, 0xD0, 0x16, 0xA8, 0x3B, 0x94,
-    0x83, 0x5A, 0x08, 0x89, 0xEC, 0xEB, 0xE3, 0xC9, 0x0A, 0x32, 0x18, 0xF9, 0xF1, 0x78, 0x77, 0xE4,
-    0x91, 0xEF, 0x7D, 0xE4, 0x7B, 0xEF, 0x7B, 0xBC, 0xFC, 0xD1, 0x48, 0x00, 0x7E, 0x65, 0x21, 0xF5,
-    0xF5, 0xFD, 0x6F, 0xDE, 0xC1, 0x57, 0x17, 0x3E, 0x08, 0xE2, 0x50, 0x69, 0xDE, 0x3E, 0xF9, 0xC1,
-    0x4E, 0xDB, 0xAD, 0xFD, 0xD4, 0xE2, 0x55, 0xCD, 0x90, 0xBA, 0xC0, 0x34, 0x1E, 0x36, 0x9F, 0x7D,
-    0xBF, 0xC8, 0xC7, 0x78, 0xD4, 0x00, 0x7F, 0x65, 0x63, 0xCD, 0xD5, 0xFC, 0x74, 0xFB, 0xC1, 0xF9,
-    0x97, 0xBA, 0xFC, 0x8C, 0xBE, 0xCD, 0x66, 0xB3, 0x9E, 0xE7, 0x7F, 0x34, 0x9B, 0x2B, 0xCD, 0x42,
-    0xEE, 0xE6, 0x41, 0xFE, 0x2D, 0xC6, 0xAB, 0x17, 0x4C, 0x4D, 0x5D, 0x4A, 0xF4, 0xDB, 0xB5, 0x8F,
-    0xC7, 0xC8, 0x9A, 0x30, 0x1C, 0x10, 0x6D, 0x6F, 0x7F, 0x47, 0x3F, 0x69, 0x70, 0xD5, 0x54, 0x54,
-    0xE4, 0x62, 0x69, 0x77, 0x84, 0x8D, 0xD2, 0x1D, 0xE1, 0x12, 0x99, 0xFA, 0x72, 0x44, 0x0B, 0x2D,
-    0x91, 0x55, 0x85, 0x7D, 0xA4, 0xB8, 0x9D, 0xC4, 0x94, 0xBE, 0x75, 0x90, 0x25, 0x8A, 0xB9, 0x32,
-    0xCC, 0xE4, 0x04, 0x4F, 0x7D, 0x2C, 0x97, 0x5C, 0xAC, 0x22, 0xDF, 0x95, 0x4F, 0x7B, 0x5A, 0x58,
-    0x66, 0x56, 0x16, 0x3E, 0x70, 0x2D, 0x7D, 0xD3, 0x27, 0xF2, 0xF3, 0x8C, 0x16, 0x5C, 0x67, 0x9C,
-    0x87, 0xC8, 0xE8, 0x65, 0xB7, 0xA1, 0xD3, 0x5E, 0x55, 0xEC, 0xFB, 0x79, 0x02, 0x8E, 0x03, 0x5A,
-    0x09, 0x53, 0x97, 0xC4, 0x51, 0x6F, 0x50, 0x27, 0xD5, 0x44, 0x73, 0xEB, 0x67, 0x84, 0x69, 0x97,
-    0x71, 0x0D, 0xE8, 0x83, 0x3B, 0x28, 0xA0, 0xC2, 0xCE, 0xF2, 0x5F, 0xF2, 0x3D, 0x94, 0x01, 0x0F,
-    0x9E, 0x62, 0x16, 0xE8, 0x80, 0xDB, 0xB0, 0x94, 0x20, 0xCA, 0x8A, 0x14, 0x5D, 0x36, 0x50, 0x29,
-    0x94, 0x09, 0x93, 0x13, 0xD0, 0xFF, 0x9C, 0x2E, 0x9C, 0x0D, 0x10, 0x23, 0x3C, 0x09, 0xD0, 0x0D,
-    0x16, 0xAB, 0xED, 0x3B, 0x79, 0xEE, 0xFF, 0xFA, 0x33, 0x63, 0x19, 0x22, 0x17, 0xB0, 0xE9, 0x21,
-    0x79, 0x77, 0x79, 0xB0, 0xF7, 0x64, 0x50, 0x07, 0xDE, 0x83, 0x76, 0x22, 0xBF, 0x99, 0x9F, 0xDE,
-    0xCD, 0x7F, 0xCD, 0xEF, 0x9F, 0xB1, 0x3E, 0x26, 0x81, 0x79, 0x7D, 0xE8, 0xA9, 0xE3, 0x6E, 0x7E,
-    0x57, 0x3C, 0xB7, 0xAD, 0x49, 0x56, 0x6C, 0x47, 0x9B, 0x49, 0x2B, 0x9E, 0x64, 0xDC, 0xF3, 0xFF,
-    0x3C, 0x7A, 0x18, 0x90, 0x0A, 0x4A, 0xB8, 0xA6, 0x1E, 0xFB, 0xCE, 0x90, 0x30, 0xE6, 0xB6, 0x7B,
-    0x3B, 0xC2, 0xB0, 0x67, 0xE2, 0xCD, 0x08, 0x43, 0x09, 0x4B, 0x65, 0xF6, 0xFE, 0x83, 0x0F, 0xBF,
-    0x64, 0xE9, 0xEB, 0x1B, 0xC0, 0x4A, 0x18, 0x5B, 0xC4, 0x58, 0xE5, 0xEA, 0xED, 0xEB, 0x27, 0xDD,
-    0x4F, 0xD9, 0xE3, 0x2B, 0xD3, 0x6B, 0x37, 0xBE, 0xA0, 0x9D, 0x39, 0x70, 0x05, 0xB8, 0x81, 0xD7,
-    0x0C, 0x87, 0x9E, 0x4D, 0x6F, 0x45, 0x3F, 0xA1, 0xFC, 0x70, 0xF5, 0xF8, 0xA4, 0x7D, 0x6C, 0xEC,
-    0xB7, 0x0D, 0x7C, 0xFD, 0x26, 0xB6, 0xA3, 0x61, 0x09, 0x23, 0x21, 0xB4, 0x35, 0xEA, 0x58, 0x6E,
-    0x28, 0x97, 0x80, 0xBC, 0x6F, 0x8B, 0x24, 0xA8, 0xC8, 0xCA, 0xC0, 0xBF, 0x72, 0xE4, 0x74, 0x50,
-    0x8B, 0x23, 0x1B, 0x87, 0xBE, 0xC2, 0x6D, 0x88, 0x27, 0xD6, 0xF9, 0xBD, 0x22, 0xCF, 0x81, 0x31,
-    0x7B, 0x46, 0xF9, 0x5A, 0x4B, 0xF1, 0x9F, 0x6D, 0xAB, 0xAB, 0x7A, 0x73, 0xC4, 0x2E, 0x4F, 0xCC,
-    0x58, 0x9F, 0x61, 0x4F, 0xDD, 0x1C, 0x31, 0x24, 0x66, 0xC7, 0x76, 0x8E, 0xE8, 0x11, 0x47, 0x87,
-    0x84, 0x21, 0xD3, 0x98, 0x1F, 0xA6, 0x31, 0x34, 0x62, 0xD9, 0x20, 0xAC, 0x18, 0x55, 0xCD, 0x9F,
-    0x66, 0x94, 0x32, 0xD5, 0x67, 0x44, 0xF9, 0x2D, 0x30, 0x83, 0xA9, 0x17, 0xC7, 0x23, 0x62, 0xF4,
-    0x93, 0x9A, 0x96, 0x8D, 0xA2, 0x18, 0xD0, 0x99, 0x53, 0x9B, 0x47, 0xBE, 0x5B, 0x53, 0xF7, 0xF7,
-    0x7D, 0xA7, 0x4A, 0x4C, 0x3F, 0xD7, 0x9A, 0x23, 0xAC, 0x7E, 0x55, 0x2F, 0x1F, 0x84, 0x35, 0xD2,
-    0x48, 0x16, 0x64, 0xC3, 0xF9, 0xCA, 0x44, 0x41, 0x72, 0x22, 0x8B, 0xAD, 0x45, 0x5E, 0x99, 0x2E,
-    0x77, 0xE3, 0xC5, 0xBF, 0x9F, 0xE5, 0x59, 0x57, 0xDA, 0x9E, 0x5A, 0xF2, 0x0B, 0xDC, 0x51, 0x19,
-    0x2D, 0xCA, 0x73, 0x20, 0xC5, 0xB2, 0x98, 0xD6, 0x48, 0x57, 0x35, 0x3C, 0x2D, 0xB7, 0x22, 0x5F,
-    0x95, 0x96, 0x34, 0x3C, 0x37, 0xED, 0xA1, 0x31, 0xEE, 0x40, 0x64, 0x68, 0x65, 0x62, 0x3F, 0x4B,
-    0x58, 0x11, 0x84, 0x32, 0x7A, 0xDC, 0xE9, 0xB4, 0x86, 0x3A, 0x11, 0x9E, 0xEA, 0x80, 0x26, 0xC7,
-    0x88, 0xF4, 0xF3, 0xA8, 0x61, 0x20, 0x5D, 0x22, 0x6C, 0xE5, 0x1C, 0x7D, 0x8B, 0x92, 0x50, 0x89,
-    0x4C, 0x65, 0x42, 0xD8, 0x8C, 0x2F, 0x35, 0x52, 0xE6, 0xA8, 0x3A, 0x3E, 0x2B, 0xA3, 0x34, 0xD3,
-    0x86, 0xA6, 0x1A, 0xD4, 0xD2, 0x7A, 0x4C, 0xB7, 0x8B, 0x39, 0xE6, 0x24, 0x78, 0x63, 0xD3, 0x8E,
-    0x93, 0x6E, 0xB0, 0xD9, 0x2A, 0x12, 0x48, 0x32, 0x85, 0x15, 0x65, 0xAA, 0xCC, 0x4B, 0x5B, 0x43,
-    0x9F, 0x13, 0x42, 0xCC, 0xBC, 0xB0, 0xF3, 0xE8, 0x44, 0x64, 0x11, 0xC3, 0x73, 0x3B, 0x81, 0x0A,
-    0x32, 0x61, 0x66, 0xB0, 0xC6, 0xEC, 0xC8, 0x31, 0xCC, 0xA0, 0x2D, 0x32, 0x6D, 0x92, 0xC8, 0x33,
-    0x4A, 0xFF, 0x4B, 0xF7, 0xD9, 0xAD, 0xD3, 0xED, 0x51, 0x18, 0xAF, 0xA3, 0xA8, 0xCE, 0xC0, 0x04,
-    0x2A, 0x48, 0x08, 0x9A, 0x57, 0x28, 0x6A, 0x16, 0x21, 0xEB, 0x59, 0x88, 0x24, 0x71, 0xA4, 0x40,
-    0x23, 0x2E, 0x5C, 0xAC, 0x39, 0x72, 0x56, 0x66, 0xD8, 0xE1, 0xB9, 0xAD, 0x0F, 0x6A, 0xBB, 0xFC,
-    0xEF, 0xDF, 0xE0, 0x27, 0x75, 0x50, 0xF1, 0x14, 0xB2, 0x39, 0xDA, 0x44, 0x58, 0x8D, 0x70, 0x6E,
-    0x24, 0xCC, 0x07, 0x32, 0x10, 0xB2, 0xF8, 0x1D, 0x1B, 0xA6, 0x6E, 0x78, 0x8F, 0x6A, 0x70, 0x48,
-    0xD0, 0x28, 0xA5, 0x23, 0x75, 0x21, 0xAD, 0xB2, 0x08, 0xC5, 0x3F, 0xAC, 0xF5, 0x4B, 0x84, 0x5C,
-    0xAD, 0x0F, 0xD0, 0xAD, 0xED, 0xA2, 0x3F, 0xA9, 0x02, 0x75, 0x08, 0x63, 0x96, 0x2E, 0x9E, 0x24,
-    0x72, 0x8C, 0xFC, 0x17, 0x96, 0x13, 0x3A, 0x27, 0x96, 0x09, 0xB3, 0x61, 0x04, 0xEA, 0xF4, 0x96,
-    0x5E, 0xB8, 0x28, 0x09, 0x51, 0x9B, 0x01, 0x16, 0x08, 0xB0, 0x84, 0x82, 0x6B, 0x55, 0xF6, 0x23,
-    0x9D, 0x21, 0x77, 0x2A, 0xDD, 0x18, 0x10, 0xFD, 0xA5, 0xF1, 0xE4, 0x15, 0x05, 0xC2, 0x13, 0x7F,
-    0x3B, 0xE4, 0xEE, 0x23, 0x1E, 0xF6, 0xCF, 0xE8, 0xAD, 0x60, 0x9D, 0x7C, 0xAF, 0xA5, 0x02, 0x32,
-    0x94, 0xCB, 0xCA, 0x79, 0x68, 0x67, 0xA0, 0x53, 0x95, 0x8A, 0x50, 0x3B, 0x06, 0x43, 0xCE, 0xE9,
-    0x8C, 0xDD, 0x7B, 0x7E, 0xFA, 0xC9, 0x04, 0xDB, 0xA3, 0xEB, 0xEA, 0xEA, 0x79, 0x48, 0x96, 0x1C,
-    0xDD, 0xB1, 0x9B, 0x47, 0xBD, 0x44, 0xCB, 0x03, 0x3F, 0xA8, 0x8D, 0x86, 0x59, 0xA7, 0x4A, 0x75,
-    0x94, 0x55, 0xC6, 0xC5, 0xD0, 0xF6, 0x7F, 0x25, 0x90, 0xB1, 0x6B, 0x14, 0x41, 0x18, 0xC5, 0xDF,
-    0xEC, 0x70, 0x0E, 0xB8, 0x70, 0x1F, 0x88, 0x57, 0x68, 0xC8, 0xAE, 0x9D, 0x20, 0x26, 0xD7, 0x5E,
-    0x31, 0xBA, 0x83, 0x16, 0x29, 0x2C, 0xBC, 0xC2, 0xFC, 0x07, 0x29, 0x04, 0x8B, 0x34, 0x57, 0x5C,
-    0x11, 0xB9, 0x09, 0x16, 0x96, 0xDA, 0x68, 0x29, 0x16, 0xA9, 0xD2, 0xB8, 0xC5, 0x42, 0xAE, 0x38,
-    0xCF, 0x31, 0x16, 0x29, 0x6C, 0x26, 0x04, 0xFB, 0x81, 0x1C, 0x36, 0xD7, 0x0C, 0xB8, 0x81, 0x83,
-    0xEC, 0xDD, 0x38, 0xA7, 0xED, 0x07, 0xEF, 0x7B, 0xEF, 0xF7, 0xC3, 0x1E, 0x8A, 0x9A, 0x9E, 0x9D,
-    0x5A, 0x29, 0xF9, 0x99, 0x96, 0x95, 0x78, 0x87, 0xCA, 0x53, 0xFA, 0xC4, 0x8E, 0x16, 0x6C, 0x09,
-    0x40, 0x81, 0x34, 0x96, 0xA0, 0x12, 0x7F, 0x0C, 0xB5, 0xE1, 0x07, 0xF4, 0x71, 0x56, 0x04, 0x0F,
-    0x09, 0x38, 0x24, 0x0A, 0xBB, 0xAA, 0xDB, 0xF0, 0x5F, 0x6A, 0x80, 0xD4, 0x62, 0xDF, 0x60, 0x1B,
-    0xCC, 0x23, 0x83, 0x30, 0xAF, 0xBC, 0x98, 0x01, 0x2D, 0x2D, 0x96, 0x49, 0x8D, 0x31, 0xA8, 0x9F,
-    0x04, 0x2B, 0x49, 0xE8, 0x6A, 0x98, 0x3E, 0x35, 0xBE, 0xFB, 0x15, 0x53, 0xB4, 0x76, 0xD3, 0x70,
-    0xF9, 0xA1, 0x36, 0x43, 0xF4, 0xE2, 0xBB, 0xAD, 0x18, 0x23, 0x08, 0xCD, 0x0D, 0x3E, 0x03, 0x2F,
-    0x11, 0xAC, 0x97, 0xBD, 0x36, 0x11, 0x0B, 0xB8, 0x36, 0x7E, 0x58, 0xD1, 0x96, 0x38, 0x9B, 0x9B,
-    0x91, 0xC6, 0x1D, 0xE4, 0x0D, 0x3F, 0x75, 0x25, 0x11, 0x7C, 0xDD, 0x16, 0x73, 0x7B, 0x73, 0x02,
-    0x52, 0xC2, 0x6E, 0xD4, 0x7C, 0x86, 0x16, 0xE3, 0x57, 0x8D, 0x38, 0x31, 0x13, 0x49, 0x3B, 0xDA,
-    0x97, 0x9B, 0x74, 0xCB, 0x2C, 0x1F, 0x92, 0x62, 0x2B, 0x8C, 0x16, 0xB9, 0xF8, 0x61, 0xE4, 0x01,
-    0xFF, 0xA9, 0xA4, 0xFF, 0x47, 0x99, 0xA7, 0x6F, 0x4D, 0x51, 0x63, 0x2F, 0x52, 0xDE, 0xF8, 0x1E,
-    0xD8, 0x01, 0x73, 0xA9, 0x92, 0xF0, 0xDC, 0x64, 0x18, 0x77, 0x9B, 0x8E, 0xC2, 0x48, 0x77, 0xA7,
-    0xE2, 0xD0, 0xDF, 0xCB, 0xC0, 0x2D, 0x2A, 0x3C, 0x5A, 0xD7, 0x98, 0xE4, 0xEA, 0x45, 0x11, 0x4C,
-    0x47, 0xB1, 0x65, 0x72, 0x6D, 0x6C, 0x19, 0x97, 0xBF, 0x8E, 0xDF, 0xEF, 0x5B, 0x0C, 0x23, 0xC2,
-    0x3E, 0xAD, 0xD8, 0x11, 0xC0, 0x2C, 0xBA, 0x8A, 0x35, 0xD8, 0xF4, 0xEC, 0xC2, 0x64, 0x6D, 0xE6,
-    0x06, 0x14, 0x9A, 0x07, 0x5F, 0xDE, 0x47, 0x50, 0xE6, 0xC0, 0xC0, 0x8E, 0x75, 0xD1, 0x70, 0x8D,
-    0x68, 0xAD, 0x5E, 0x8B, 0xCB, 0xD6, 0xE7, 0x2D, 0xE4, 0x3A, 0x58, 0xD6, 0x07, 0x36, 0x2C, 0xCD,
-    0xB8, 0x43, 0x8D, 0xFC, 0x88, 0xCF, 0x7D, 0x2F, 0xDD, 0xD1, 0x55, 0x2F, 0xE5, 0xE7, 0x2E, 0x5F,
-    0xE0, 0x36, 0xEE, 0x1E, 0x3F, 0x0F, 0x97, 0xCA, 0xEB, 0x32, 0xA6, 0xFF, 0x7B, 0x23, 0xA4, 0x2A,
-    0x5A, 0xEB, 0x83, 0x4D, 0xD9, 0x6F, 0x17, 0xAD, 0x65, 0xE9, 0x27, 0xAC, 0xD8, 0xC5, 0xB9, 0x93,
-    0x25, 0x6D, 0xA7, 0x6F, 0x82, 0xEE, 0x00, 0xDF, 0xD4, 0xE3, 0x89, 0x38, 0x74, 0x7E, 0x6D, 0x6D,
-    0x9C, 0x25, 0xC1, 0xC4, 0xBD, 0x39, 0x72, 0x53, 0xB8, 0xD8, 0xF8, 0x17, 0x45, 0x90, 0x2F, 0x4F,
-    0xC4, 0x40, 0x10, 0xC5, 0xDF, 0x74, 0x45, 0x13, 0x2E, 0x61, 0xCF, 0x21, 0x48, 0x6E, 0xBF, 0x00,
-    0x01, 0x83, 0x3C, 0x68, 0x1D, 0x16, 0x83, 0xE2, 0x13, 0xA0, 0x8A, 0x44, 0x90, 0x50, 0x8F, 0x41,
-    0xF1, 0x09, 0x50, 0x67, 0x40, 0x20, 0x2A, 0xB8, 0x5C, 0x3D, 0x66, 0x05, 0xC1, 0x60, 0x9A, 0x10,
-    0x12, 0x02, 0x66, 0x05, 0xA2, 0x40, 0xB9, 0xE1, 0xED, 0x22, 0x98, 0x64, 0xF3, 0xF6, 0xCF, 0xBC,
-    0xDF, 0xCC, 0x0E, 0xC0, 0x50, 0x1D, 0x50, 0x71, 0x59, 0x4C, 0xE1, 0xB0, 0x8D, 0x4D, 0x8C, 0xB1,
-    0xC3, 0xFB, 0xB8, 0xCE, 0xB4, 0xC6, 0x42, 0x4B, 0x34, 0xDC, 0x7F, 0x00, 0x2B, 0x5F, 0x35, 0x9C,
-    0xB6, 0xC8, 0x02, 0x60, 0x3A, 0x60, 0xFD, 0x33, 0xA6, 0x44, 0x08, 0x4A, 0x20, 0x67, 0x62, 0xFE,
-    0x1E, 0x90, 0xB7, 0xA7, 0x30, 0xDE, 0x42, 0x82, 0x20, 0x39, 0x49, 0x12, 0xA5, 0xAD, 0x7A, 0xBB,
-    0x48, 0x36, 0xA7, 0x3F, 0x90, 0xF9, 0x01, 0x58, 0x0A, 0x2C, 0x0B, 0xEC, 0xD5, 0x52, 0x16, 0xAA,
-    0xC1, 0x3E, 0x6A, 0x2F, 0x65, 0xC4, 0xC9, 0x7E, 0xA2, 0x3A, 0xED, 0xA3, 0x64, 0x8B, 0xC3, 0x90,
-    0x34, 0xD8, 0x3A, 0xEA, 0x2E, 0xEE, 0xA2, 0x18, 0x3F, 0x6A, 0x6F, 0xA8, 0x53, 0x34, 0x13, 0x4A,
-    0xDE, 0xDA, 0xEC, 0x05, 0x47, 0x68, 0xCC, 0xB3, 0x86, 0x22, 0xD8, 0xCB, 0x7E, 0xED, 0xC1, 0x0A,
-    0x88, 0x38, 0x41, 0x80, 0x63, 0x73, 0xA5, 0xAD, 0x85, 0xA0, 0x5B, 0x14, 0xB1, 0x34, 0x2B, 0x0F,
-    0xC6, 0x83, 0x6F, 0xC6, 0xB3, 0xC5, 0xC9, 0xEA, 0xF1, 0x86, 0x7B, 0x85, 0x7C, 0xDF, 0x3F, 0x9D,
-    0xAB, 0x87, 0xED, 0x0A, 0x8F, 0xFF, 0x60, 0x3F, 0x19, 0x49, 0xA2, 0xD7, 0x2D, 0xE6, 0x04, 0x3A,
-    0xD2, 0x68, 0x1E, 0xA7, 0x0F, 0x56, 0xB3, 0x2B, 0x58, 0xE5, 0x20, 0x1C, 0x0F, 0x5B, 0xBA, 0x64,
-    0xC3, 0xB3, 0x3A, 0x4D, 0x29, 0xDD, 0x20, 0x7E, 0x62, 0xD4, 0x89, 0xE7, 0xDB, 0xC0, 0x89, 0x2D,
-    0xFF, 0x90, 0xBF, 0x6D, 0x51, 0x3B, 0x4B, 0x03, 0x41, 0x10, 0xFE, 0xEE, 0x56, 0x39, 0xF4, 0xD0,
-    0xB5, 0x30, 0x90, 0x26, 0x6A, 0x61, 0x61, 0x71, 0x31, 0x96, 0x16, 0xA7, 0xD9, 0x90, 0x1F, 0x60,
-    0x9A, 0xAB, 0x6C, 0xAC, 0xD3, 0xA8, 0x90, 0x42, 0x7C, 0xE0, 0x59, 0xA7, 0xB1, 0xC9, 0x5F, 0x10,
-    0xBC, 0xCA, 0x22, 0xA2, 0x9D, 0x07, 0x16, 0x76, 0xF1, 0xFC, 0x01, 0xC1, 0x33, 0x22, 0x82, 0x85,
-    0x2C, 0xE6, 0x40, 0xC1, 0xC7, 0x3A, 0x9B, 0x33, 0xA2, 0xE8, 0x72, 0xB3, 0x3B, 0xAF, 0xFB, 0xE6,
-    0x9B, 0x19, 0x00, 0xB0, 0x7C, 0x60, 0x1B, 0x60, 0x21, 0xB0, 0xE0, 0x05, 0x07, 0x4A, 0xA9, 0xDB,
-    0x08, 0x83, 0x2C, 0x22, 0x97, 0x16, 0x81, 0xF4, 0x8C, 0x81, 0x49, 0x14, 0x25, 0x6B, 0x4B, 0x77,
-    0x4D, 0xEE, 0x5D, 0xF9, 0x96, 0x40, 0x0E, 0xA8, 0xC1, 0x88, 0xF0, 0x47, 0xED, 0x9F, 0x26, 0x49,
-    0x42, 0x22, 0xAB, 0x87, 0xDE, 0x13, 0x01, 0xDF, 0x08, 0x4C, 0x02, 0x86, 0x84, 0x7E, 0xB0, 0x96,
-    0x26, 0x4D, 0xFD, 0x0B, 0xF1, 0xA5, 0x8E, 0xE4, 0x9C, 0xFC, 0x7A, 0x3C, 0xFB, 0x88, 0x42, 0x8C,
-    0xD9, 0x3E, 0xAC, 0x2D, 0x6A, 0xD8, 0x40, 0x93, 0x88, 0x37, 0x77, 0x3C, 0xEF, 0x99, 0x80, 0xBB,
-    0x21, 0x38, 0x35, 0x20, 0x59, 0xC8, 0x61, 0x61, 0xAE, 0x0F, 0x4C, 0x8C, 0x77, 0x13, 0xAB, 0x9D,
-    0xB8, 0x35, 0x59, 0x8A, 0xC4, 0x2F, 0xE0, 0xA1, 0x5C, 0x96, 0xBC, 0x0B, 0xD7, 0xD4, 0x12, 0x8A,
-    0xBA, 0xBB, 0x34, 0x3D, 0x6D, 0xF0, 0x57, 0x7A, 0x29, 0x2A, 0x5F, 0x2C, 0x91, 0x97, 0x29, 0x4A,
-    0x30, 0x96, 0x1B, 0x05, 0xF5, 0x91, 0xF1, 0x2A, 0x40, 0x05, 0x66, 0x44, 0x54, 0x90, 0xD7, 0x7D,
-    0x9A, 0x21, 0x6C, 0xB8, 0x0E, 0x0B, 0x8F, 0x5C, 0xF3, 0xFC, 0x6E, 0x79, 0x52, 0xBD, 0x11, 0xDB,
-    0x7C, 0xEF, 0x9B, 0xD1, 0x5C, 0xC6, 0x61, 0xC4, 0x7A, 0xD2, 0x13, 0x20, 0xE6, 0xA4, 0x32, 0x1F,
-    0xA3, 0x1C, 0xF3, 0x1C, 0x31, 0x67, 0x8D, 0x55, 0xAE, 0xDE, 0x61, 0xC6, 0x14, 0xA4, 0x6B, 0x38,
-    0x25, 0x6F, 0xE8, 0xB1, 0x0D, 0xC0, 0xE5, 0xE0, 0x5C, 0xB0, 0x4B, 0x81, 0xD7, 0x87, 0xE0, 0x4C,
-    0xA9, 0x0F, 0x37, 0xDD, 0x14, 0x3D, 0x26, 0x65, 0xAC, 0xD0, 0xFA, 0x7A, 0x56, 0x86, 0x51, 0x6C,
-    0x31, 0x08, 0x0E, 0xF4, 0xCA, 0x68, 0x20, 0x65, 0x32, 0x75, 0x9E, 0x16, 0xE3, 0x7B, 0x18, 0xAE,
-    0xB4, 0x3A, 0xC9, 0x56, 0xFD, 0xB8, 0xE5, 0x44, 0xF3, 0x47, 0xE8, 0x84, 0xAC, 0x8E, 0x51, 0x07,
-    0x3F, 0xD4, 0x71, 0xEA, 0x0B, 0xD3, 0xBA, 0xB4, 0x51, 0x81, 0x2C, 0x28, 0x25, 0xAB, 0x41, 0x40,
-    0xEB, 0x32, 0xEE, 0x09, 0x53, 0x9B, 0x00, 0xD7, 0xD1, 0x1E, 0xE8, 0x9F, 0xBF, 0xBF, 0x54, 0xB3,
-    0xE5, 0xDC, 0xBE, 0x9C, 0xB1, 0x8E, 0x64, 0xD7, 0xBA, 0xA8, 0x2E, 0xBF, 0x9F, 0x85, 0xED, 0x9F,
-    0xD2, 0x9C, 0x4E, 0x6D, 0xA5, 0x5E, 0x36, 0x83, 0xE0, 0x84, 0x78, 0x75, 0x09, 0xD3, 0x52, 0x2A,
-    0xB1, 0x7C, 0x5B, 0x58, 0x7E, 0x13, 0x03, 0x10, 0xF8, 0x04, 0xA5, 0x57, 0xBF, 0x6F, 0x14, 0x47,
-    0x14, 0x7E, 0xBB, 0x6B, 0x33, 0x81, 0x55, 0xBC, 0x2E, 0x4C, 0x94, 0x04, 0xCC, 0x51, 0x50, 0xA0,
-    0x84, 0xBB, 0x6D, 0x22, 0x74, 0x48, 0x67, 0xDF, 0x42, 0x0A, 0x8A, 0x14, 0x38, 0xC2, 0x0B, 0x15,
-    0x22, 0x75, 0x90, 0x80, 0x82, 0x44, 0x56, 0x72, 0xF6, 0x2D, 0x71, 0x91, 0x96, 0xFF, 0x20, 0x2E,
-    0x28, 0xC8, 0x52, 0xD8, 0x42, 0x2E, 0x0E, 0xC9, 0xE6, 0x96, 0xB8, 0xA0, 0x40, 0x0A, 0x0B, 0x08,
-    0xA5, 0xA0, 0xC8, 0x0A, 0x64, 0xA1, 0xB8, 0x1A, 0xA4, 0x25, 0xAC, 0xEC, 0xBB, 0x9B, 0x7C, 0x6F,
-    0x76, 0xCF, 0x18, 0x84, 0x20, 0xC0, 0xDC, 0xAD, 0xEF, 0x66, 0xEE, 0xCD, 0x9B, 0xEF, 0xFD, 0x98,
-    0xEF, 0x3D, 0x8F, 0x10, 0x0D, 0x96, 0x02, 0xB2, 0xEE, 0x4B, 0x32, 0xE5, 0x32, 0x51, 0xEA, 0x04,
-    0xD4, 0x30, 0x25, 0x55, 0xA8, 0xA9, 0x14, 0x39, 0x4A, 0x45, 0xA6, 0xB4, 0x62, 0x1A, 0x27, 0x49,
-    0x4E, 0xD4, 0x22, 0x43, 0xD6, 0x88, 0xC6, 0xF7, 0x10, 0xD9, 0xB7, 0x3D, 0xA2, 0xE7, 0x11, 0x51,
-    0x3D, 0x26, 0x12, 0x92, 0xB0, 0x93, 0xF2, 0x61, 0x10, 0xB9, 0x5D, 0xAA, 0x9C, 0x8E, 0x07, 0xA8,
-    0x43, 0x54, 0x22, 0xC2, 0x76, 0xCA, 0xE8, 0xEC, 0x0C, 0xB5, 0x55, 0x90, 0x89, 0xA4, 0x45, 0x59,
-    0x8D, 0xC6, 0x2A, 0xE4, 0x38, 0x9E, 0x58, 0x89, 0xCD, 0x24, 0x25, 0x39, 0x46, 0x2D, 0x27, 0x6A,
-    0x18, 0xBD, 0x0E, 0x95, 0x32, 0xAD, 0x63, 0xA7, 0x7F, 0x5C, 0xA9, 0x8D, 0x70, 0x3E, 0x22, 0x97,
-    0x68, 0x09, 0xC8, 0xC8, 0xC6, 0xD7, 0x9F, 0xC2, 0xAE, 0x52, 0xF9, 0xD7, 0x2D, 0xAB, 0x8A, 0x47,
-    0x92, 0x9F, 0xBD, 0xED, 0xB2, 0x11, 0x99, 0x4A, 0x1D, 0xA3, 0xFA, 0x6A, 0x5B, 0x5A, 0x29, 0xB9,
-    0x01, 0x24, 0x15, 0xA0, 0x39, 0xD3, 0x10, 0x4D, 0x5B, 0xE3, 0xE4, 0x1C, 0x96, 0x29, 0xA5, 0x38,
-    0xD8, 0x09, 0x4A, 0x8E, 0xD7, 0xA2, 0xC6, 0xB8, 0x1D, 0x98, 0x72, 0xA9, 0x45, 0xCE, 0xC5, 0x0D,
-    0x58, 0x6E, 0x75, 0x48, 0x24, 0xB6, 0xA4, 0x26, 0x35, 0x7B, 0xED, 0x44, 0xFC, 0xA1, 0xBA, 0xF4,
-    0x11, 0xED, 0x64, 0xD5, 0x13, 0x30, 0x04, 0x66, 0x0A, 0x98, 0x69, 0xC3, 0x2E, 0xA7, 0x41, 0x54,
-    0x1E, 0x23, 0xAA, 0xE1, 0x80, 0x29, 0x18, 0xB9, 0x08, 0xBF, 0x49, 0x3B, 0x32, 0x13, 0x11, 0x5B,
-    0x91, 0x95, 0x08, 0xB8, 0xCD, 0xF1, 0x8C, 0xD4, 0x81, 0xE9, 0x15, 0x80, 0xAD, 0x2B, 0xD5, 0xC5,
-    0xD3, 0x1B, 0xF4, 0xFD, 0x49, 0x38, 0x55, 0xAD, 0xAC, 0xFB, 0x67, 0x36, 0xDD, 0x6D, 0xB1, 0xBB,
-    0xA7, 0xC9, 0x81, 0x87, 0xC5, 0x2B, 0xEE, 0x4E, 0xDF, 0xEA, 0x6E, 0xF8, 0x8A, 0x84, 0x52, 0x71,
-    0x69, 0x3D, 0x9C, 0x2B, 0x41, 0x00, 0x0A, 0xD9, 0x2D, 0x64, 0xB1, 0x4B, 0x58, 0x70, 0x3C, 0x0C,
-    0xC3, 0x12, 0x1F, 0x19, 0xFB, 0xFE, 0x04, 0xEF, 0x1A, 0xC7, 0x23, 0x20, 0xC1, 0xE1, 0x21, 0x87,
-    0xC5, 0xDA, 0x4A, 0x79, 0x70, 0x5B, 0x9C, 0xEF, 0x18, 0x9C, 0xF6, 0x0C, 0xA5, 0x52, 0xD1, 0x9B,
-    0xBF, 0x22, 0x24, 0x1B, 0x63, 0x24, 0x70, 0x75, 0x8A, 0x18, 0xD6, 0xF0, 0xDA, 0x43, 0x4E, 0x38,
-    0xBF, 0xF6, 0x2B, 0x14, 0xCA, 0xF4, 0x93, 0xD5, 0xC9, 0x31, 0x5A, 0xC4, 0x91, 0x35, 0x24, 0x06,
-    0x50, 0xD6, 0x6D, 0x8F, 0xAC, 0x0D, 0xA8, 0x76, 0x59, 0x19, 0x74, 0x40, 0x9E, 0xB0, 0xA3, 0x18,
-    0x30, 0x5E, 0xFF, 0xD2, 0x5C, 0x0B, 0xE7, 0x66, 0x30, 0xAF, 0xF3, 0xF9, 0xB0, 0xCB, 0x5A, 0x0B,
-    0xE7, 0xEF, 0x42, 0x61, 0x36, 0x46, 0x39, 0x7E, 0x93, 0x61, 0xD6, 0x2F, 0xE1, 0x0B, 0x56, 0x3D,
-    0x1B, 0x5B, 0x60, 0x24, 0x95, 0x18, 0x65, 0x78, 0xB5, 0xCB, 0x42, 0x0C, 0x75, 0xA9, 0x2F, 0xCD,
-    0x56, 0xD6, 0xBE, 0x08, 0xC3, 0x79, 0xF6, 0xEC, 0x5D, 0xDF, 0x3F, 0xCC, 0x0B, 0x88, 0x0F, 0xA7,
-    0x89, 0x3E, 0xC0, 0x61, 0x48, 0x11, 0x12, 0x3A, 0x28, 0xA9, 0x1E, 0xCE, 0xC3, 0x74, 0xF0, 0x99,
-    0xA7, 0xDD, 0x46, 0x57, 0xD7, 0x94, 0x47, 0x9C, 0x2B, 0x65, 0x88, 0x0B, 0x58, 0x0B, 0x17, 0x2C,
-    0x61, 0xE2, 0xEC, 0x98, 0x5F, 0xBB, 0xBA, 0x02, 0x85, 0xA9, 0x7F, 0x76, 0xA2, 0x41, 0x22, 0x40,
-    0x90, 0x11, 0x60, 0x2A, 0x23, 0x3C, 0x62, 0x16, 0x27, 0x6C, 0x48, 0x00, 0x4A, 0xA0, 0x23, 0x2A,
-    0x1C, 0x5D, 0xEE, 0xC7, 0x63, 0x92, 0xA1, 0x26, 0x66, 0x18, 0x42, 0x73, 0x8E, 0x8E, 0x2D, 0x15,
-    0x37, 0x7B, 0x61, 0x28, 0xE1, 0x6A, 0x36, 0x00, 0xCA, 0x74, 0x94, 0x04, 0xDC, 0xBF, 0x4B, 0x02,
-    0x59, 0x82, 0x2D, 0x01, 0xF9, 0x18, 0xC7, 0x39, 0x9F, 0x21, 0x7B, 0x35, 0xD5, 0x09, 0xAE, 0xB3,
-    0x5D, 0xE7, 0x3B, 0x67, 0xFC, 0x87, 0x2D, 0x9D, 0xCB, 0x8C, 0xF6, 0x63, 0x25, 0x1D, 0x15, 0x21,
-    0x14, 0x13, 0x80, 0x72, 0xAF, 0x17, 0xCE, 0x7F, 0x9D, 0x52, 0x05, 0x19, 0x55, 0xB5, 0x13, 0x0A,
-    0xEC, 0x38, 0x77, 0x16, 0x27, 0x92, 0x1B, 0xE4, 0xB8, 0xB3, 0x1C, 0x69, 0x23, 0xBF, 0xC8, 0xE3,
-    0xDA, 0xA2, 0x11, 0x76, 0x46, 0x4A, 0xE2, 0xCE, 0x03, 0xFF, 0x06, 0xC0, 0xA7, 0x2A, 0xF7, 0x02,
-    0x6C, 0xF7, 0x95, 0x7A, 0xEA, 0xFB, 0xB0, 0xDB, 0x80, 0x65, 0x88, 0x3E, 0x32, 0x82, 0x9D, 0x83,
-    0xC8, 0x8A, 0x40, 0x7F, 0x2B, 0xE7, 0xFE, 0x4F, 0x75, 0x5E, 0xF0, 0xB7, 0x16, 0x8E, 0x84, 0x52,
-    0xE8, 0x9E, 0xCA, 0xBF, 0xE5, 0x1B, 0x79, 0xD4, 0xC8, 0x8C, 0x58, 0x4C, 0xB2, 0x9A, 0x2A, 0x4B,
-    0x8F, 0xEA, 0x09, 0x8B, 0x62, 0x02, 0x55, 0x09, 0xEF, 0x58, 0xE4, 0x49, 0x4D, 0x9F, 0xC8, 0xA3,
-    0xCA, 0xEF, 0x7D, 0xD5, 0x7D, 0x33, 0x87, 0x3A, 0x36, 0x02, 0xDC, 0x43, 0x9C, 0xE3, 0xFA, 0xA1,
-    0xEC, 0xAB, 0xEA, 0xFE, 0xFC, 0x27, 0x1E, 0x48, 0xF7, 0x23, 0xAB, 0xA9, 0xDC, 0x33, 0x65, 0xFD,
-    0x49, 0x8F, 0xE3, 0xC5, 0x66, 0x66, 0xCC, 0xD1, 0x48, 0xB7, 0x3B, 0x45, 0xFD, 0x83, 0xF3, 0x04,
-    0x6A, 0xE5, 0x17, 0xCD, 0x90, 0x39, 0x2C, 0x76, 0x00, 0x43, 0x16, 0x41, 0x18, 0xD8, 0x9E, 0x8A,
-    0x1C, 0x3A, 0x19, 0x97, 0x70, 0xD3, 0xCA, 0x39, 0x2F, 0xF2, 0x65, 0xCD, 0xB0, 0x65, 0x09, 0xE2,
-    0x35, 0x3C, 0x75, 0x6C, 0x71, 0xE3, 0xDC, 0x9B, 0xFA, 0x5A, 0x7A, 0x9A, 0x1F, 0xBB, 0xE6, 0x5D,
-    0xF5, 0x28, 0x91, 0x95, 0xB8, 0x6A, 0x25, 0x43, 0xD4, 0xB2, 0xA2, 0x9F, 0xBD, 0x1B, 0x59, 0x66,
-    0xA7, 0xFA, 0x67, 0x3B, 0xB1, 0x13, 0xB7, 0x53, 0xCF, 0xAA, 0x8E, 0xAC, 0x5D, 0x10, 0xD1, 0x01,
-    0x7E, 0xA6, 0x86, 0x64, 0x6D, 0x7C, 0x69, 0x26, 0x75, 0x92, 0x92, 0x36, 0x71, 0xA4, 0x40, 0xF8,
-    0x3E, 0xCF, 0x18, 0x08, 0x08, 0x44, 0xA4, 0xF8, 0x29, 0x8C, 0xB5, 0x82, 0xE2, 0x32, 0x95, 0xBC,
-    0x3C, 0x21, 0x35, 0x31, 0x70, 0xE8, 0x39, 0x1D, 0x8C, 0xAC, 0x7F, 0x53, 0xA3, 0x22, 0x99, 0xA7,
-    0x8B, 0x7B, 0xC7, 0x74, 0x48, 0xCB, 0xD0, 0xC7, 0x14, 0x7C, 0x0B, 0x4F, 0xE7, 0xF8, 0xDF, 0xD3,
-    0xCF, 0x5F, 0x7E, 0xFF, 0x1B, 0x8C, 0x0C, 0xD4, 0x2A, 0xEF, 0xF6, 0xDA, 0xFF, 0x99, 0x66, 0xDB,
-    0x1C, 0x05, 0x20, 0xB9, 0x38, 0xC7, 0x01, 0x76, 0x71, 0x3B, 0x20, 0xF3, 0x2E, 0x26, 0xA8, 0x17,
-    0x34, 0x65, 0x07, 0x48, 0x2A, 0xB0, 0x24, 0xFE, 0xDA, 0x01, 0xEE, 0x6D, 0x44, 0xD2, 0x60, 0x1E,
-    0xCD, 0x70, 0x89, 0x39, 0x16, 0xC8, 0x7C, 0x17, 0x77, 0xDF, 0x8A, 0xE0, 0xAD, 0x41, 0xC0, 0x15,
-    0x37, 0x51, 0xE1, 0x12, 0xEC, 0x4C, 0xB1, 0xB3, 0x01, 0xD1, 0x31, 0xBC, 0x1C, 0x84, 0x12, 0x53,
-    0xA6, 0xDC, 0x32, 0x96, 0x04, 0x28, 0x97, 0x38, 0x92, 0x15, 0x2E, 0x5B, 0x77, 0x0A, 0xCA, 0x65,
-    0xA7, 0x5B, 0x69, 0xE1, 0xA3, 0xEF, 0x2F, 0xA3, 0x28, 0x76, 0xA8, 0x77, 0xA2, 0x83, 0x4B, 0x01,
-    0xC2, 0x32, 0x9E, 0x4A, 0xB2, 0xFE, 0x8A, 0xC8, 0x39, 0x0D, 0xDF, 0x22, 0x65, 0x9E, 0xBD, 0x75,
-    0x1A, 0x03, 0xD0, 0xB7, 0xEF, 0xB2, 0x29, 0xC5, 0x74, 0x25, 0x21, 0xD7, 0x8E, 0x8D, 0xCC, 0x5E,
-    0x6F, 0x07, 0x02, 0xBC, 0x4A, 0x93, 0x45, 0x22, 0xB8, 0xB0, 0xF7, 0x21, 0x4A, 0xDB, 0x3E, 0xA6,
-    0x14, 0xCE, 0xD3, 0xF7, 0xF9, 0x40, 0x58, 0x87, 0x2B, 0x24, 0x6E, 0x45, 0xD4, 0x4C, 0xC9, 0xF8,
-    0xBD, 0xC8, 0x0B, 0x0E, 0xB8, 0x53, 0x10, 0xC2, 0x1B, 0x06, 0x10, 0x66, 0x3D, 0x32, 0x3A, 0x5D,
-    0x3C, 0xC3, 0x44, 0xC3, 0xBC, 0x86, 0xCA, 0xD6, 0xE1, 0xB5, 0x25, 0x4D, 0x1F, 0x6F, 0x18, 0xF6,
-    0x96, 0x33, 0xD0, 0x38, 0x88, 0xD9, 0xA7, 0xD9, 0x48, 0x51, 0x2C, 0xEC, 0xFB, 0x69, 0x8B, 0xDE,
-    0x45, 0xD9, 0xEB, 0x80, 0x94, 0x12, 0xE3, 0xE2, 0x46, 0xF7, 0xDC, 0x90, 0xD1, 0x96, 0xC3, 0x5C,
-    0xC7, 0x91, 0x57, 0xF5, 0xCC, 0x5C, 0x59, 0x55, 0xCB, 0x1F, 0xD3, 0xB9, 0xB8, 0xDF, 0xB1, 0x80,
-    0x75, 0x51, 0x3A, 0x3A, 0x60, 0xAF, 0x89, 0xBE, 0xED, 0x98, 0xE2, 0x8A, 0xC8, 0x1D, 0xDE, 0x40,
-    0x3D, 0x2D, 0x5F, 0x6F, 0x77, 0x16, 0x4A, 0x70, 0xBA, 0xE7, 0x26, 0xA3, 0xCD, 0x5E, 0x43, 0xBA,
-    0xD9, 0xB0, 0x79, 0x69, 0x1F, 0xD1, 0x77, 0xCC, 0x7B, 0x67, 0xD4, 0xE5, 0x3E, 0x82, 0xCF, 0xD5,
-    0x3F, 0x16, 0x96, 0xB6, 0x13, 0x7D, 0x0A, 0x61, 0x12, 0x47, 0xC2, 0x1B, 0xBF, 0xE1, 0x9A, 0x69,
-    0x9E, 0xB2, 0xB9, 0x28, 0x7C, 0xB9, 0x76, 0xE5, 0x80, 0x06, 0x81, 0x6A, 0x35, 0xD7, 0x27, 0xCD,
-    0x9C, 0x37, 0x27, 0x98, 0xF5, 0x01, 0xA4, 0xAF, 0x8B, 0x2B, 0x76, 0x7E, 0x47, 0xF7, 0x92, 0x99,
-    0x91, 0x9B, 0x98, 0x3D, 0x26, 0x93, 0x19, 0x4D, 0x29, 0x26, 0x6A, 0x48, 0x13, 0x75, 0x28, 0xD3,
-    0xA4, 0xC9, 0xA3, 0xA9, 0xB2, 0xA6, 0xEA, 0xEC, 0xD5, 0x04, 0xED, 0x26, 0x04, 0x61, 0x2D, 0xD7,
-    0xE1, 0xB7, 0x1B, 0x6F, 0xEB, 0x72, 0xE3, 0x30, 0xD6, 0xD7, 0x9D, 0x0B, 0x17, 0x93, 0xED, 0x64,
-    0x06, 0xA8, 0x8E, 0x68, 0x7A, 0xDA, 0x9E, 0x1B, 0x43, 0x73, 0xDB, 0xB3, 0x53, 0x7C, 0xA0, 0x26,
-    0x40, 0xA4, 0x19, 0x20, 0xFD, 0x8D, 0x1E, 0x3E, 0x71, 0x9A, 0xC1, 0x5A, 0x23, 0x6E, 0x3F, 0xE6,
-    0x68, 0xFF, 0x16, 0xCF, 0xEF, 0x20, 0x03, 0x2D, 0x64, 0x06, 0xAA, 0x85, 0xC3, 0x19, 0xD4, 0x96,
-    0x5D, 0x4E, 0xC4, 0x7D, 0x58, 0x6C, 0xA7, 0x2F, 0xD4, 0x63, 0xA1, 0xF7, 0x92, 0x8A, 0x9D, 0xF0,
-    0xFB, 0x96, 0x92, 0xA9, 0x89, 0x65, 0xB3, 0x4B, 0xE1, 0x89, 0x6E, 0x0C, 0xE8, 0x45, 0x63, 0x23,
-    0xB8, 0x64, 0x72, 0xFD, 0xBD, 0xF4, 0x4A, 0x02, 0xE8, 0x22, 0x0C, 0x49, 0xE3, 0xE4, 0x83, 0xA2,
-    0xD5, 0x58, 0x9F, 0xAB, 0x83, 0xF8, 0x5C, 0x30, 0x83, 0xE3, 0x39, 0xA0, 0x03, 0x2B, 0x32, 0x24,
-    0x2A, 0x45, 0x8D, 0x9B, 0x42, 0xF4, 0x2D, 0xA6, 0xEE, 0x5B, 0x8E, 0x81, 0x28, 0xB8, 0xD5, 0xD8,
-    0xC5, 0x1D, 0xC1, 0x62, 0x41, 0x95, 0xDC, 0xB7, 0xE4, 0x94, 0xBD, 0x99, 0xAD, 0x5E, 0xCE, 0xFF,
-    0xC0, 0xB4, 0xD3, 0x6F, 0x15, 0x90, 0xDB, 0x80, 0xCC, 0x0D, 0x81, 0x15, 0x01, 0xB2, 0x04, 0xE4,
-    0x29, 0xEA, 0x93, 0x8B, 0xA6, 0x97, 0xC8, 0x8C, 0xB9, 0xA9, 0xD8, 0x02, 0x99, 0x2D, 0xE1, 0x6A,
-    0x68, 0x16, 0x0D, 0xD7, 0x66, 0x16, 0x6E, 0x76, 0x47, 0xF5, 0x2D, 0xCD, 0x0B, 0x1F, 0x68, 0xC8,
-    0x02, 0xD3, 0x66, 0xBF, 0xC3, 0xC4, 0xF8, 0x02, 0x72, 0x31, 0x98, 0x88, 0xBF, 0x51, 0xBA, 0x5D,
-    0xFA, 0x70, 0x87, 0x62, 0xA1, 0xC7, 0x7D, 0x63, 0x90, 0x33, 0x02, 0x27, 0x6B, 0xE9, 0xE8, 0xD1,
-    0xD8, 0x48, 0x46, 0xCD, 0x78, 0x88, 0x2E, 0x98, 0xD1, 0x82, 0x11, 0x5B, 0xB3, 0x81, 0xF0, 0xEC,
-    0xDD, 0x28, 0xCB, 0xA3, 0x3F, 0xF8, 0xD7, 0xFD, 0x1F, 0xB9, 0x75, 0x79, 0xE2, 0x09, 0x4F, 0x9C,
-    0xE2, 0xA5, 0x2A, 0x5D, 0xA0, 0x05, 0x96, 0x0A, 0x12, 0xE1, 0xD5, 0xB0, 0xD1, 0x02, 0x83, 0x5D,
-    0x58, 0xE6, 0x7E, 0x13, 0x66, 0x0C, 0xB2, 0x6B, 0x5F, 0xA8, 0xF6, 0x04, 0x54, 0x13, 0xAB, 0x46,
-    0xD1, 0x5F, 0x00, 0xAA, 0x59, 0xAE, 0x98, 0xBB, 0xF1, 0x33, 0x54, 0xFB, 0x7D, 0xD5, 0x40, 0x7A,
-    0x8A, 0x97, 0xB8, 0x8A, 0x2F, 0xB0, 0x54, 0xC0, 0xB5, 0x16, 0x1B, 0x59, 0x35, 0xBD, 0x41, 0x35,
-    0x13, 0x2F, 0x7A, 0x5D, 0x37, 0xBA, 0x96, 0x98, 0xF7, 0x67, 0x7F, 0x49, 0xCA, 0xF6, 0x6E, 0xF3,
-    0x51, 0x3C, 0x7A, 0x1E, 0x09, 0x79, 0x30, 0x82, 0x7F, 0x9E, 0x50, 0x25, 0xB1, 0x4E, 0x99, 0xF7,
-    0x92, 0xD1, 0x6A, 0xD9, 0x4C, 0x16, 0xAE, 0xC5, 0xE6, 0xE3, 0xA0, 0x8B, 0xCB, 0xA3, 0x37, 0xBE,
-    0x59, 0x35, 0x1F, 0x3E, 0xC4, 0x17, 0x63, 0x81, 0xA0, 0x3A, 0xA0, 0xB2, 0x3D, 0x0A, 0x3B, 0x46,
-    0xCF, 0x23, 0x17, 0x0F, 0x22, 0xF8, 0x50, 0x5D, 0x26, 0xA8, 0x8E, 0x81, 0x1A, 0xD9, 0x09, 0xD5,
-    0x40, 0xDD, 0x65, 0xD4, 0xAF, 0x55, 0x8D, 0xA7, 0x92, 0x77, 0x1E, 0xDC, 0x71, 0xA0, 0x38, 0xFD,
-    0xAF, 0xE9, 0xE0, 0x89, 0xD5, 0x49, 0xF4, 0x73, 0xEB, 0xFC, 0xAF, 0xD0, 0xF0, 0x72, 0x6F, 0x69,
-    0x80, 0x06, 0xF0, 0x7F, 0x5D, 0xE4, 0x44, 0xF6, 0x43, 0x69, 0x49, 0x2B, 0xE3, 0xEE, 0xBD, 0xF1,
-    0x1F, 0x1D, 0xCD, 0xB1, 0x0D, 0xC2, 0x40, 0x0C, 0x05, 0xD0, 0x9F, 0x13, 0x1D, 0x43, 0x64, 0x02,
-    0xF0, 0x06, 0x80, 0x32, 0x53, 0x0A, 0x1A, 0x74, 0xEE, 0x18, 0xEB, 0x76, 0x60, 0x82, 0x24, 0x13,
-    0x50, 0xBA, 0x48, 0xCE, 0xF1, 0xB7, 0x25, 0x3F, 0xF9, 0xDB, 0x85, 0x01, 0xBC, 0xC0, 0x7A, 0xA7,
-    0x55, 0x53, 0xA3, 0xF3, 0xC8, 0x30, 0xE7, 0xE5, 0x73, 0xB9, 0x46, 0xA8, 0xBE, 0x18, 0x3D, 0x44,
-    0x43, 0xFF, 0x1A, 0x5D, 0x5D, 0x43, 0x6D, 0x26, 0x6E, 0x78, 0xF6, 0xE2, 0x3B, 0x5A, 0x87, 0xF8,
-    0xE4, 0x1D, 0xC5, 0xB7, 0x10, 0xB2, 0xC7, 0x26, 0x02, 0x67, 0xC8, 0x8F, 0x96, 0xFF, 0x83, 0x3F,
-    0x6E, 0x77, 0x5A, 0x7A, 0x3E, 0xCF, 0x19, 0x43, 0xF4, 0x09,
+static const uint8_t bookerly_12_italicBitmaps[24720] = {
+    0xB5, 0x99, 0x4F, 0x8C, 0x5D, 0xC7, 0x95, 0xDE, 0x7F, 0x55, 0x45, 0xF2, 0x8E, 0x59, 0x96, 0x8A,
+    0x09, 0xC4, 0xC0, 0x63, 0x8A, 0x7D, 0xB5, 0x98, 0x01, 0x8C, 0x09, 0xBB, 0xEF, 0x2C, 0xBC, 0x20,
+    0x30, 0xF7, 0xBE, 0x57, 0x96, 0x12, 0x78, 0xA1, 0x85, 0x19, 0x80, 0xCF, 0x03, 0xC4, 0x08, 0xE4,
+    0x65, 0x66, 0x8C, 0x80, 0x5A, 0x10, 0x41, 0x0F, 0x70, 0x9B, 0xAF, 0x2C, 0x2D, 0xBC, 0xF0, 0xC2,
+    0x44, 0xFE, 0x2C, 0x83, 0xCC, 0x22, 0x8B, 0x11, 0x0D, 0x84, 0x44, 0xD2, 0xC1, 0xBC, 0x24, 0xAF,
+    0xFB, 0x15, 0xC9, 0x85, 0x16, 0x5A, 0xA8, 0x24, 0x61, 0xE0, 0x85, 0x81, 0x71, 0x69, 0x4C, 0x65,
+    0x06, 0x23, 0x4C, 0x58, 0x1E, 0x5D, 0x45, 0x97, 0xD4, 0xED, 0x57, 0x59, 0xDC, 0xD7, 0x4D, 0x6A,
+    0x30, 0xC9, 0xC4, 0x8A, 0xF5, 0x80, 0xEE, 0x7E, 0xEF, 0xF6, 0xAB, 0x73, 0xEA, 0x9C, 0x3A, 0xE7,
+    0x3B, 0xE7, 0x7C, 0xC5, 0x73, 0x2A, 0x94, 0xF4, 0x2A, 0x18, 0x5A, 0x19, 0x34, 0x35, 0x51, 0xB9,
+    0x8B, 0xBC, 0x0A, 0x70, 0x51, 0xF4, 0x85, 0x3F, 0xC5, 0xD9, 0x42, 0xFF, 0xE0, 0xFE, 0xBB, 0x31,
+    0xED, 0x5F, 0xAE, 0x9F, 0x79, 0xB6, 0x50, 0xDF, 0xB0, 0x96, 0x67, 0xA5, 0xE7, 0x19, 0xE5, 0xB8,
+    0xA8, 0x2C, 0x97, 0x34, 0x26, 0xE7, 0xE1, 0xF4, 0x7F, 0x7D, 0xE5, 0x2A, 0xD7, 0x9F, 0x81, 0x3B,
+    0xCF, 0x43, 0xBA, 0xC4, 0xF9, 0x8F, 0xF7, 0xAE, 0xCC, 0x73, 0x8E, 0xD2, 0x5F, 0x47, 0xF9, 0x3B,
+    0x28, 0x97, 0x28, 0x6C, 0x04, 0x9E, 0x01, 0x5E, 0x05, 0xE9, 0xE1, 0x9A, 0xA5, 0xCA, 0x41, 0xBE,
+    0xFF, 0x33, 0x6F, 0xB4, 0xB1, 0xED, 0xE5, 0x5A, 0xA4, 0x80, 0xFA, 0x04, 0xF4, 0x00, 0xC5, 0x11,
+    0xA8, 0x23, 0xB8, 0x38, 0x60, 0xEF, 0xF4, 0x46, 0xBD, 0x1E, 0x9B, 0x67, 0x8C, 0x1B, 0x5E, 0x5D,
+    0x8A, 0xFC, 0x30, 0xB0, 0xEA, 0xE1, 0x32, 0x08, 0x0F, 0x06, 0xA8, 0x81, 0x9B, 0x6C, 0x5E, 0x02,
+    0x0A, 0x44, 0xB6, 0x24, 0x16, 0x2D, 0x0D, 0x46, 0x7A, 0xED, 0xA4, 0xDF, 0x16, 0x89, 0x5A, 0xFA,
+    0x1A, 0xE5, 0x6A, 0x6D, 0xD9, 0x55, 0xDF, 0x8F, 0x28, 0x9F, 0x6A, 0xDD, 0x4D, 0xF6, 0x8C, 0xFA,
+    0x89, 0xCF, 0x2F, 0x86, 0xB4, 0x0D, 0xBB, 0x17, 0x45, 0xC0, 0x28, 0x7F, 0x11, 0xE5, 0x6B, 0xE9,
+    0x59, 0x28, 0x5F, 0x53, 0x52, 0x6B, 0xAB, 0xBC, 0x7A, 0x27, 0xD1, 0x61, 0x7A, 0xCE, 0xC2, 0x73,
+    0x7C, 0xE6, 0x55, 0x45, 0x60, 0xB2, 0x04, 0xB6, 0xB5, 0x05, 0x23, 0x3D, 0x14, 0xDF, 0x8F, 0x20,
+    0xDF, 0x4F, 0x9C, 0xE3, 0xBF, 0x47, 0x9E, 0x67, 0xEA, 0xB8, 0xC6, 0xDC, 0x5D, 0x58, 0xF3, 0x07,
+    0x69, 0xDA, 0x71, 0xB9, 0xD9, 0xBA, 0x4E, 0x5D, 0xF8, 0x4B, 0x18, 0x7A, 0x83, 0x72, 0xE6, 0x87,
+    0x96, 0x24, 0xB2, 0x63, 0x42, 0xE5, 0x29, 0xD6, 0x79, 0x0D, 0xF3, 0xB5, 0x79, 0x04, 0x30, 0x8F,
+    0xA3, 0x9E, 0xB3, 0x3B, 0x4D, 0x7D, 0xF9, 0xEB, 0xAF, 0x5E, 0x81, 0x17, 0xD0, 0x9E, 0x1E, 0x63,
+    0xE9, 0xD0, 0x8E, 0x16, 0xE5, 0xD9, 0x82, 0x6E, 0xF3, 0x77, 0x81, 0x0C, 0x68, 0xCB, 0x36, 0x2C,
+    0x10, 0x09, 0xE5, 0xD1, 0x16, 0x03, 0xDB, 0xD0, 0x40, 0x0D, 0x2F, 0xC0, 0x0B, 0x88, 0x84, 0x48,
+    0xC8, 0x80, 0xF2, 0x68, 0x87, 0x81, 0x1A, 0xF6, 0x91, 0x11, 0xED, 0xD8, 0x81, 0x7D, 0x94, 0xC7,
+    0xC0, 0xEE, 0x46, 0x6C, 0x42, 0x5B, 0x16, 0x68, 0xC7, 0x02, 0x63, 0xF9, 0x2E, 0x00, 0xDB, 0xEA,
+    0x87, 0xE2, 0x53, 0x57, 0x3C, 0x7C, 0xF1, 0xF1, 0x4F, 0xFE, 0x94, 0x7F, 0xE5, 0xB9, 0x03, 0x97,
+    0x21, 0x8D, 0x4B, 0xCF, 0xEF, 0xCD, 0x72, 0xFE, 0xC5, 0xEF, 0xFE, 0x89, 0x1D, 0x65, 0x27, 0x94,
+    0x03, 0x26, 0x2A, 0xED, 0xA8, 0xB0, 0x5B, 0x16, 0x0E, 0x66, 0x57, 0xF3, 0xD1, 0xAD, 0x3F, 0x62,
+    0x67, 0xBE, 0x77, 0x0E, 0x44, 0x84, 0x1A, 0xB4, 0x85, 0x04, 0x0D, 0x14, 0x0E, 0x12, 0x6C, 0x83,
+    0xF2, 0xD0, 0xC1, 0xD6, 0xF8, 0x6E, 0x01, 0x06, 0x64, 0x80, 0xDD, 0xF1, 0xDD, 0xB8, 0x70, 0x7C,
+    0x3D, 0x07, 0x65, 0x46, 0xAE, 0x33, 0x53, 0x0E, 0x64, 0xA2, 0x37, 0x56, 0xA5, 0x25, 0xE6, 0x7E,
+    0x60, 0x52, 0x41, 0x3F, 0xA0, 0xDE, 0x8B, 0x94, 0xC6, 0x32, 0x34, 0xA8, 0xD0, 0x51, 0xA9, 0x28,
+    0x92, 0x09, 0x95, 0x2D, 0x73, 0x47, 0xB9, 0x3E, 0x39, 0x57, 0xB1, 0x94, 0xD9, 0x4F, 0x37, 0x6E,
+    0x2E, 0x91, 0x89, 0x09, 0x2A, 0x50, 0x53, 0x78, 0x96, 0x18, 0x47, 0x47, 0xC9, 0x85, 0xB5, 0xCE,
+    0x1D, 0x9C, 0x83, 0x55, 0xC7, 0x6A, 0x15, 0x4A, 0x37, 0x57, 0x41, 0xA5, 0xAF, 0x30, 0x05, 0x15,
+    0x61, 0x80, 0xCA, 0xA2, 0x03, 0xB2, 0x83, 0x03, 0x98, 0x42, 0xE9, 0xD0, 0x01, 0xF9, 0x68, 0x76,
+    0x65, 0x95, 0xF3, 0xCB, 0x39, 0x47, 0xB8, 0x82, 0xC8, 0x89, 0xD5, 0xCA, 0x97, 0x76, 0x4F, 0x7A,
+    0x15, 0x4E, 0xD1, 0x82, 0x71, 0x14, 0x91, 0xA2, 0xA3, 0xC8, 0x81, 0xDF, 0x5C, 0x81, 0xE8, 0xA0,
+    0xB4, 0xC8, 0x04, 0x87, 0x30, 0xF7, 0xDF, 0xCB, 0x51, 0xE5, 0x78, 0xBC, 0x5D, 0x0B, 0xA5, 0x43,
+    0x1C, 0x41, 0x99, 0xE0, 0x13, 0x8F, 0x79, 0x05, 0xBA, 0x05, 0xE6, 0xA5, 0x40, 0x67, 0x30, 0xAE,
+    0xA5, 0x97, 0xD1, 0x38, 0xE3, 0x56, 0x39, 0xFF, 0x22, 0xE7, 0xEC, 0xD0, 0x1E, 0x76, 0x80, 0x6E,
+    0x74, 0x2B, 0x50, 0xE4, 0x81, 0x55, 0xF6, 0xC6, 0x22, 0x12, 0xEC, 0x80, 0xEA, 0x60, 0xDA, 0x23,
+    0xAE, 0x25, 0xA8, 0x1C, 0x0C, 0xA0, 0x3D, 0x2C, 0xC1, 0x38, 0x54, 0x42, 0x0E, 0xFC, 0x38, 0xA3,
+    0xD7, 0xF6, 0xC9, 0x36, 0x44, 0xF6, 0xCC, 0x1F, 0xA0, 0x3B, 0x38, 0x04, 0x1D, 0xE0, 0x06, 0xA8,
+    0xC7, 0xFF, 0x81, 0x32, 0xF7, 0xF4, 0x67, 0x7A, 0x15, 0x54, 0x2A, 0xD1, 0xBE, 0xA5, 0x12, 0x89,
+    0x65, 0x11, 0x54, 0x30, 0x7E, 0x4A, 0xF9, 0x61, 0x7A, 0xDA, 0xFB, 0x45, 0xCE, 0x3F, 0xCF, 0xB9,
+    0x4F, 0x2C, 0x77, 0x69, 0x9F, 0xA7, 0x85, 0x06, 0x26, 0x50, 0x41, 0x09, 0xC6, 0x62, 0x3C, 0xDA,
+    0xA3, 0x22, 0x2A, 0x41, 0x0F, 0x4B, 0xD8, 0x01, 0x01, 0x8C, 0xFE, 0x8C, 0x1C, 0x5E, 0xF3, 0x15,
+    0xAD, 0x0A, 0xCA, 0x37, 0xB4, 0x2A, 0x1A, 0x5B, 0xFD, 0x20, 0xB0, 0x4A, 0xE8, 0x35, 0xC5, 0xCF,
+    0x7B, 0x91, 0x74, 0x68, 0x98, 0x6A, 0xAF, 0xD2, 0x92, 0x89, 0x0E, 0xC6, 0x4F, 0x1F, 0x26, 0x56,
+    0xFD, 0x46, 0xFF, 0x15, 0x98, 0x0F, 0x14, 0x8F, 0x07, 0x6E, 0x88, 0x5E, 0x45, 0x99, 0x8C, 0x7D,
+    0xB2, 0xE5, 0xA8, 0xA2, 0x79, 0xF0, 0x8A, 0x35, 0x79, 0xE0, 0xCC, 0x8F, 0x03, 0x4C, 0x41, 0x25,
+    0x98, 0x82, 0x4E, 0xFC, 0x83, 0x35, 0x22, 0x3B, 0xB0, 0x00, 0x57, 0x8C, 0x9F, 0x92, 0x9E, 0x80,
+    0x85, 0x8C, 0xA5, 0xDF, 0xC3, 0xC2, 0x69, 0x8C, 0x57, 0x89, 0xEE, 0xB3, 0x58, 0x32, 0xC1, 0x78,
+    0x19, 0xE9, 0xD8, 0xA5, 0x65, 0xF7, 0xE4, 0xF1, 0x75, 0x8A, 0x9E, 0x79, 0x28, 0x8E, 0x98, 0x3A,
+    0x6E, 0x40, 0x19, 0x11, 0x6B, 0xA8, 0x22, 0x72, 0x80, 0xDF, 0x00, 0x7E, 0xEB, 0xD6, 0x1B, 0x39,
+    0x1F, 0xEB, 0x11, 0x39, 0xFF, 0xF5, 0xAD, 0x5B, 0x0E, 0xF8, 0x3A, 0xCC, 0x2D, 0x65, 0x87, 0xC8,
+    0x96, 0x32, 0x22, 0x06, 0x8A, 0x9E, 0xB9, 0xD3, 0x3D, 0x53, 0xC7, 0xD7, 0x00, 0xD0, 0x71, 0x3A,
+    0x4C, 0x0E, 0xCF, 0x19, 0x0C, 0x5B, 0xB4, 0x22, 0x15, 0xBE, 0xA4, 0xE6, 0x86, 0x9D, 0xDA, 0x53,
+    0xC0, 0xD7, 0x58, 0x32, 0x70, 0xEE, 0x09, 0xDA, 0x65, 0x07, 0x65, 0xCE, 0x11, 0xF5, 0x88, 0x22,
+    0x71, 0x03, 0x54, 0x28, 0x02, 0x14, 0xBE, 0xE1, 0xF0, 0x6B, 0x46, 0x06, 0x93, 0xC3, 0xB6, 0xA1,
+    0x2B, 0xD9, 0xDF, 0x2F, 0x5C, 0xAD, 0xEE, 0xFB, 0x5A, 0x04, 0x63, 0x48, 0x9A, 0xDD, 0xDD, 0xC2,
+    0xD5, 0xEA, 0x6E, 0xDC, 0x51, 0x69, 0xA7, 0x70, 0xED, 0xEF, 0xDC, 0x4B, 0x5B, 0x22, 0xBF, 0xBD,
+    0xA6, 0x95, 0x7D, 0x79, 0x73, 0x74, 0x85, 0x4C, 0x30, 0x3A, 0xD3, 0xA1, 0x1E, 0x7D, 0xE3, 0x1A,
+    0xC8, 0x9C, 0x23, 0xF0, 0xFB, 0x1B, 0x90, 0xFF, 0x2E, 0x63, 0x04, 0x32, 0xB5, 0xA0, 0xD6, 0xC0,
+    0xC5, 0x05, 0xF0, 0x8B, 0x04, 0xC5, 0x4B, 0x1E, 0x6A, 0x63, 0x91, 0xA1, 0x01, 0xC3, 0x02, 0x1E,
+    0x7D, 0x3B, 0x51, 0xE4, 0xEC, 0x69, 0x66, 0xD7, 0xAC, 0x8C, 0x34, 0x18, 0xE8, 0x59, 0xA0, 0x92,
+    0x7E, 0x40, 0xF9, 0x20, 0x27, 0x95, 0x13, 0x67, 0xDE, 0x40, 0xE4, 0x1C, 0xC5, 0xBF, 0x7F, 0xB1,
+    0xA7, 0x64, 0x49, 0x45, 0xCB, 0x0E, 0x2D, 0x0D, 0x3D, 0xB5, 0x4C, 0xCC, 0xB3, 0xE3, 0x70, 0x15,
+    0xE9, 0x65, 0x47, 0x47, 0x4F, 0x62, 0x21, 0x12, 0xBD, 0x8C, 0xA2, 0x53, 0x41, 0xC5, 0x0B, 0x8F,
+    0x57, 0x6E, 0x9E, 0x37, 0x81, 0x23, 0x7E, 0xCF, 0xB2, 0xCA, 0xC1, 0x7C, 0xB0, 0x72, 0x03, 0xDB,
+    0xC6, 0x73, 0xA7, 0x45, 0xBE, 0x1E, 0xA1, 0x04, 0x96, 0x23, 0x28, 0x18, 0x07, 0x13, 0x60, 0x18,
+    0xED, 0x2D, 0x22, 0x5F, 0x36, 0xDD, 0x99, 0x64, 0x72, 0x46, 0xE7, 0x30, 0xCA, 0x39, 0xFD, 0x86,
+    0x45, 0xE5, 0x1C, 0xF9, 0xF5, 0xEE, 0x95, 0x8E, 0xC2, 0x17, 0x89, 0x8A, 0x22, 0xB2, 0xC0, 0x78,
+    0x15, 0xA8, 0x30, 0xD0, 0xD2, 0x22, 0x93, 0x4C, 0x68, 0x6F, 0x1C, 0x13, 0x1A, 0xE8, 0x48, 0x68,
+    0x5F, 0x78, 0xF6, 0xA8, 0x50, 0x91, 0x9E, 0x43, 0x2E, 0x3C, 0x5E, 0x05, 0x91, 0xF3, 0x83, 0xE3,
+    0x23, 0x9C, 0xCD, 0x66, 0x4C, 0x73, 0xF6, 0xE2, 0xF1, 0xAD, 0x44, 0xCB, 0x65, 0x2A, 0xBE, 0x8C,
+    0x76, 0xA0, 0x02, 0x90, 0x80, 0x1B, 0xB7, 0x1C, 0x55, 0x8E, 0x98, 0xA7, 0x1F, 0xB6, 0x3C, 0x4F,
+    0x85, 0xC1, 0xB8, 0xC2, 0x5D, 0xC8, 0x39, 0x94, 0x39, 0x27, 0x98, 0xCD, 0xAE, 0x92, 0xF3, 0x40,
+    0x79, 0x6B, 0x49, 0xC9, 0x65, 0x2A, 0xBE, 0xCE, 0x0E, 0xD0, 0x6C, 0x7E, 0x6E, 0xDC, 0xB2, 0xAC,
+    0xB2, 0xA5, 0x1F, 0x71, 0x86, 0x04, 0x22, 0x8D, 0x76, 0xAB, 0x08, 0x17, 0x1E, 0xC1, 0x3C, 0x6F,
+    0xFC, 0x56, 0xE5, 0x81, 0xF5, 0x3F, 0x1D, 0x54, 0xA2, 0x36, 0x9E, 0xCB, 0x25, 0xFC, 0xF6, 0x04,
+    0x68, 0x47, 0xCF, 0xD1, 0x03, 0x3D, 0xD3, 0xA3, 0x9E, 0x33, 0xFD, 0x00, 0x69, 0x89, 0x48, 0x73,
+    0x64, 0x9C, 0x7A, 0x15, 0x4D, 0xCE, 0x41, 0xE4, 0x0D, 0x7C, 0xCC, 0xAE, 0x8A, 0x99, 0x35, 0xD9,
+    0xCE, 0x8F, 0x28, 0x1D, 0x07, 0x88, 0x84, 0xF6, 0x54, 0xD0, 0x23, 0x23, 0xC6, 0xD2, 0x40, 0x42,
+    0x05, 0x4A, 0x98, 0xE7, 0x9C, 0xD0, 0x39, 0xAF, 0xA1, 0x47, 0x05, 0x8C, 0xA5, 0x85, 0x84, 0xF6,
+    0x94, 0xB0, 0x40, 0x26, 0x8C, 0x65, 0x02, 0x1D, 0x17, 0x7A, 0xE6, 0x37, 0x8B, 0x1C, 0xAA, 0x0C,
+    0xB3, 0xAB, 0x2A, 0x47, 0xD1, 0x53, 0x78, 0x2A, 0x58, 0x9C, 0xAC, 0x94, 0x09, 0xE3, 0x46, 0xF9,
+    0xC5, 0x46, 0xE5, 0x85, 0x5E, 0xE4, 0x0E, 0x98, 0x5D, 0x85, 0xDC, 0x43, 0xE9, 0xC0, 0xD8, 0x31,
+    0x20, 0x2A, 0xF8, 0x8C, 0xB7, 0x9E, 0x36, 0xF5, 0x6F, 0xF1, 0x96, 0xF2, 0x50, 0x78, 0x30, 0x96,
+    0xC9, 0x21, 0x4C, 0x7B, 0x38, 0x7B, 0x13, 0x98, 0x5D, 0x39, 0x7F, 0x95, 0xDC, 0x4D, 0x07, 0x4A,
+    0x67, 0x02, 0x25, 0x13, 0xA8, 0x44, 0x07, 0x3B, 0x45, 0x80, 0xA6, 0x02, 0x9A, 0xE5, 0x71, 0x2B,
+    0xB1, 0x8A, 0xC0, 0xA3, 0x0E, 0xE8, 0x96, 0x40, 0x9A, 0x82, 0x48, 0xA5, 0x43, 0x26, 0x1D, 0x51,
+    0x51, 0xF5, 0x5C, 0x78, 0x44, 0x66, 0xBE, 0x66, 0xEA, 0x8F, 0xFD, 0x89, 0xCA, 0x11, 0xD1, 0x8F,
+    0xDA, 0x2B, 0x60, 0x31, 0x06, 0x86, 0xB1, 0xD0, 0x8E, 0xFB, 0x33, 0x6E, 0x34, 0x21, 0x41, 0xE1,
+    0x09, 0x15, 0x9A, 0x9E, 0xF6, 0x42, 0xCE, 0xEF, 0xE4, 0x9C, 0xE1, 0xF4, 0x55, 0xC4, 0x8C, 0x22,
+    0x23, 0xB2, 0xA7, 0x0A, 0x64, 0x8B, 0xE9, 0x58, 0x79, 0xD4, 0xFF, 0xA4, 0x49, 0x88, 0x0F, 0xDD,
+    0xF6, 0x12, 0xFE, 0x4B, 0x32, 0x3B, 0x50, 0xB7, 0x5A, 0x3B, 0xB6, 0x8C, 0x7A, 0x2D, 0xA2, 0x5F,
+    0x7A, 0xCF, 0x77, 0x28, 0xFF, 0x28, 0x36, 0x90, 0x76, 0x92, 0xB1, 0x2C, 0x8A, 0x4E, 0x05, 0x1A,
+    0x06, 0x12, 0x86, 0x86, 0x9A, 0xC2, 0x9D, 0xA5, 0xA4, 0xE8, 0xA0, 0x7C, 0x60, 0x32, 0x54, 0x19,
+    0x66, 0x88, 0x99, 0x9D, 0x06, 0x91, 0xA3, 0xEC, 0xD1, 0x8E, 0x39, 0x32, 0x50, 0x45, 0x12, 0x66,
+    0x49, 0x8D, 0x7A, 0xDB, 0x6D, 0xC1, 0x5F, 0x27, 0x6D, 0xD9, 0x6D, 0x54, 0x60, 0x5B, 0xFB, 0x84,
+    0xA1, 0xAB, 0x51, 0x7E, 0xB2, 0x85, 0x48, 0xC5, 0x5B, 0x96, 0x5D, 0x3E, 0xF5, 0x6C, 0x53, 0x26,
+    0x0C, 0x6A, 0x40, 0x3F, 0xE0, 0x06, 0x65, 0xC6, 0x9C, 0x54, 0xBB, 0xDF, 0x83, 0x22, 0xF7, 0x98,
+    0x0F, 0xAE, 0x79, 0xE3, 0x45, 0x6F, 0x3C, 0xD3, 0xC2, 0x53, 0xBC, 0x17, 0xE1, 0xE3, 0x34, 0x3A,
+    0xDD, 0xDC, 0x80, 0xE2, 0x6D, 0x87, 0xFC, 0x28, 0x42, 0xDF, 0x43, 0x3B, 0x85, 0x49, 0x11, 0xA8,
+    0x38, 0x62, 0x8E, 0x79, 0x9C, 0x61, 0xF5, 0x88, 0xE3, 0xAC, 0x7F, 0x1A, 0x89, 0x5A, 0x2A, 0x1A,
+    0x76, 0x68, 0x68, 0x68, 0xA9, 0xE9, 0x69, 0x55, 0xE2, 0xE0, 0xB6, 0x23, 0x3F, 0xFA, 0xBB, 0xB2,
+    0x89, 0x71, 0x67, 0x98, 0x0F, 0xAE, 0x79, 0x8C, 0x17, 0x3D, 0xC6, 0x33, 0xA5, 0xF0, 0x14, 0x5E,
+    0x45, 0x44, 0x27, 0x12, 0x34, 0x2C, 0xC1, 0xD8, 0x09, 0x14, 0xDE, 0x38, 0x64, 0x52, 0x11, 0x7A,
+    0x7A, 0x68, 0xA9, 0x60, 0x42, 0x11, 0x98, 0xC2, 0x11, 0x73, 0x30, 0x8F, 0xD7, 0x8C, 0x01, 0x8C,
+    0xEE, 0x00, 0xAA, 0x00, 0x88, 0x7C, 0x13, 0x28, 0xF2, 0xDA, 0x83, 0xCE, 0x11, 0x38, 0x6D, 0x39,
+    0xFD, 0x06, 0xCC, 0x73, 0xCF, 0xAF, 0x77, 0xD7, 0x2C, 0xAD, 0x4A, 0x54, 0xB4, 0x68, 0x57, 0xA2,
+    0x82, 0x71, 0x24, 0xED, 0x69, 0xCB, 0x40, 0x95, 0x1D, 0xE6, 0xA1, 0x45, 0xBD, 0x9B, 0x20, 0x35,
+    0xD0, 0x6A, 0xCF, 0x0E, 0x3D, 0xC6, 0x95, 0xEE, 0xC2, 0x23, 0x39, 0x94, 0xD9, 0x95, 0x63, 0x04,
+    0x9E, 0xF9, 0x37, 0x54, 0x39, 0x54, 0xFF, 0xB8, 0x2B, 0xD9, 0xD6, 0x5E, 0xCB, 0x24, 0xEC, 0x01,
+    0x98, 0x88, 0xC8, 0x16, 0xD3, 0xC3, 0xDC, 0xA1, 0xD2, 0x0B, 0xEC, 0x5D, 0xC4, 0xBC, 0x6C, 0x8B,
+    0x7B, 0x49, 0xC5, 0xD5, 0x8F, 0x53, 0x31, 0x62, 0xE9, 0xF9, 0xD9, 0xEC, 0x9F, 0xE4, 0x9C, 0x3F,
+    0xBC, 0xB5, 0xBE, 0xDD, 0xAA, 0x70, 0x29, 0x95, 0xFC, 0x27, 0xBB, 0x94, 0x56, 0xC6, 0x31, 0x7C,
+    0xEB, 0xD1, 0x85, 0xDA, 0x8F, 0x98, 0xBC, 0xE9, 0x85, 0x36, 0x68, 0x7D, 0xE1, 0x11, 0x22, 0x0F,
+    0x70, 0xFE, 0x2A, 0xB3, 0xDF, 0xCD, 0xBE, 0x5C, 0x5F, 0x08, 0xDC, 0x60, 0x31, 0x1A, 0x52, 0xD3,
+    0xA1, 0x7C, 0x09, 0xBB, 0x32, 0xA1, 0xED, 0x0E, 0x24, 0x15, 0x30, 0x34, 0x90, 0x0A, 0xCF, 0x16,
+    0x2D, 0x32, 0x68, 0x4F, 0x4D, 0x8B, 0x71, 0x2A, 0xA9, 0x44, 0x95, 0x07, 0x98, 0x1F, 0x6D, 0x4E,
+    0xFB, 0xFC, 0x8C, 0xD9, 0x95, 0xDC, 0xEB, 0xEC, 0x0F, 0x29, 0x3A, 0xD1, 0x61, 0x50, 0x81, 0x05,
+    0xC6, 0x29, 0xCF, 0x84, 0x1D, 0x58, 0x92, 0x90, 0xC9, 0x58, 0x0A, 0xDF, 0x82, 0x51, 0x01, 0x9A,
+    0x12, 0xE8, 0x12, 0xC8, 0x9F, 0x38, 0xD0, 0x4B, 0xA0, 0x8C, 0xC0, 0x94, 0x0D, 0x66, 0x8C, 0xA2,
+    0xAF, 0x82, 0x98, 0xBD, 0x9C, 0xFD, 0x16, 0xF3, 0xA1, 0x0C, 0x2A, 0x71, 0x40, 0xCF, 0x1C, 0x63,
+    0x8D, 0xD3, 0x49, 0x24, 0x7A, 0x32, 0x0D, 0xC6, 0xED, 0x24, 0xE5, 0x59, 0xA8, 0xB7, 0xD9, 0x47,
+    0xFB, 0xFD, 0xCE, 0xC0, 0xD2, 0x98, 0x17, 0x03, 0xC5, 0xBD, 0xD0, 0xD5, 0xD0, 0xD6, 0xFA, 0x07,
+    0x96, 0xE2, 0x2D, 0xBB, 0x48, 0x50, 0xA7, 0xE2, 0xDF, 0x81, 0xFA, 0x2B, 0xE6, 0x1E, 0xA6, 0xBE,
+    0xE8, 0x41, 0x75, 0x4C, 0x81, 0x29, 0x2A, 0x3E, 0xE9, 0x62, 0xCE, 0x5F, 0x3D, 0x7D, 0x95, 0xDC,
+    0x57, 0x47, 0x54, 0xAE, 0x88, 0x18, 0x6F, 0x1C, 0x45, 0xD8, 0x01, 0x15, 0x8F, 0x6B, 0x35, 0x2B,
+    0x7F, 0xBC, 0xE7, 0x39, 0x20, 0xB2, 0x05, 0xF5, 0x96, 0x3F, 0xB6, 0x51, 0x26, 0xE8, 0xE8, 0x90,
+    0x91, 0x25, 0xE5, 0x03, 0x91, 0x5D, 0x1E, 0x74, 0x0E, 0xE7, 0xAF, 0x8A, 0x59, 0x99, 0x5F, 0xCC,
+    0xEF, 0x1C, 0x51, 0xBA, 0x0A, 0xED, 0x54, 0x28, 0x3C, 0x4B, 0xE5, 0x29, 0x55, 0x40, 0xFD, 0x59,
+    0x84, 0x65, 0x02, 0x93, 0x40, 0x76, 0x1B, 0x28, 0x9D, 0x30, 0x9E, 0xB3, 0xF2, 0x9B, 0x5C, 0x59,
+    0x3B, 0x54, 0x4E, 0xC0, 0x6C, 0x76, 0x55, 0xE4, 0x3C, 0xC8, 0xC7, 0xB7, 0x06, 0xE5, 0x65, 0x52,
+    0xBE, 0x08, 0x02, 0x63, 0x3F, 0x53, 0x9B, 0xB5, 0x87, 0xD2, 0xC2, 0xDE, 0x08, 0xCA, 0x2A, 0x71,
+    0xC7, 0x78, 0x52, 0x85, 0x8C, 0xF3, 0x9C, 0xC3, 0x34, 0xE7, 0x31, 0x42, 0xBF, 0x7A, 0x53, 0x1E,
+    0x51, 0xA3, 0x3C, 0xBB, 0x68, 0x4B, 0xC2, 0x20, 0x22, 0xDB, 0x28, 0xFF, 0x7F, 0x7C, 0x5A, 0x38,
+    0x0E, 0xAD, 0xEE, 0xA8, 0x91, 0x4F, 0xE6, 0xAB, 0xCB, 0x28, 0xCF, 0x36, 0xA4, 0x93, 0xC9, 0x6B,
+    0x1B, 0x11, 0x31, 0x9B, 0x71, 0xAC, 0x46, 0xC4, 0x63, 0x6D, 0xF2, 0xFF, 0x2A, 0x7A, 0x1F, 0xCD,
+    0xDF, 0x78, 0xFA, 0x3D, 0xA7, 0x3B, 0x68, 0xE1, 0x08, 0x32, 0xF2, 0x67, 0xA8, 0x37, 0x5D, 0xF1,
+    0xBA, 0x37, 0x32, 0x94, 0xA4, 0x6D, 0xBA, 0x9A, 0xDD, 0x05, 0xF5, 0x39, 0x4E, 0xE5, 0x9C, 0xE7,
+    0x39, 0x07, 0x9E, 0xD1, 0xBE, 0x37, 0x76, 0xEC, 0x2A, 0x2F, 0xBC, 0x1F, 0xAA, 0x9C, 0xCA, 0x17,
+    0x7B, 0x43, 0x63, 0x9C, 0x51, 0xBE, 0xB8, 0x1B, 0x65, 0xDC, 0x17, 0x5D, 0xC3, 0x60, 0xEC, 0xAA,
+    0x48, 0xFF, 0xF9, 0xED, 0x55, 0x97, 0x4D, 0x9A, 0x02, 0x70, 0x0E, 0x99, 0xE1, 0x7B, 0x1E, 0x91,
+    0x60, 0x01, 0x0D, 0x18, 0x28, 0xEE, 0xF5, 0xF2, 0xBD, 0x6C, 0xFF, 0xF8, 0x7E, 0x9C, 0xF8, 0xA5,
+    0xF1, 0x55, 0x11, 0xF4, 0x6B, 0x49, 0x85, 0x8E, 0x54, 0xD3, 0x96, 0x34, 0xDA, 0x4D, 0xD4, 0xFA,
+    0x50, 0x7C, 0x7A, 0x74, 0x32, 0x04, 0x0C, 0x32, 0x87, 0xC5, 0x57, 0xB6, 0x50, 0x9E, 0x16, 0xED,
+    0xE8, 0x30, 0x96, 0x9E, 0x97, 0xFD, 0xEE, 0x3C, 0xCB, 0x3C, 0xC2, 0xB0, 0xB0, 0x14, 0x03, 0x7C,
+    0xCF, 0x43, 0x0B, 0xDA, 0x41, 0x07, 0x06, 0xF9, 0x28, 0x89, 0xBC, 0x66, 0x4F, 0x07, 0x43, 0x2D,
+    0xA3, 0xF2, 0x35, 0xBB, 0x85, 0xD3, 0x6E, 0x5F, 0x74, 0xC6, 0x4E, 0xE9, 0x74, 0xFA, 0xD6, 0xBD,
+    0xB7, 0xEB, 0x55, 0x97, 0xD5, 0x60, 0xFC, 0x71, 0xE3, 0xBC, 0x62, 0x67, 0x25, 0x43, 0xBB, 0x25,
+    0x52, 0x32, 0xDF, 0x7C, 0xAD, 0xDB, 0x59, 0x91, 0x6F, 0xAA, 0x80, 0xB1, 0xA7, 0xA6, 0x22, 0xCD,
+    0xB3, 0x5D, 0x3D, 0x15, 0xE5, 0x14, 0x47, 0x20, 0x3E, 0x4D, 0x50, 0xFF, 0xDA, 0x38, 0xAB, 0xD2,
+    0x31, 0x92, 0x12, 0x3A, 0x07, 0x54, 0x1E, 0x36, 0xCD, 0x53, 0xCD, 0x66, 0xBE, 0x6A, 0x19, 0xF7,
+    0x77, 0xF2, 0x3D, 0x91, 0x18, 0xA1, 0x46, 0xC6, 0x4D, 0x03, 0x70, 0xF2, 0x3D, 0x63, 0x91, 0x77,
+    0x13, 0x4C, 0x07, 0x10, 0x4F, 0xC6, 0xA2, 0x6A, 0x1D, 0xB8, 0xB1, 0x4A, 0xB4, 0x85, 0xA3, 0x11,
+    0x09, 0xC3, 0x2E, 0xCA, 0xD7, 0xD0, 0x35, 0x50, 0x1E, 0x8D, 0x43, 0xA2, 0x88, 0x9B, 0xD8, 0xAF,
+    0x1E, 0xC0, 0xE1, 0xCA, 0x8B, 0x4E, 0x0E, 0x74, 0x94, 0xB6, 0x41, 0x05, 0x13, 0x8A, 0x48, 0xCE,
+    0x91, 0x33, 0x6B, 0x0B, 0xE7, 0xA0, 0x4A, 0xA3, 0xF3, 0xCA, 0x4D, 0x59, 0xDF, 0x10, 0x2B, 0xBB,
+    0x65, 0x90, 0xEF, 0x66, 0x67, 0x76, 0x2A, 0x9A, 0xB0, 0x10, 0x47, 0x2A, 0xE8, 0x64, 0xA8, 0x68,
+    0xE9, 0x65, 0x54, 0xDE, 0xD8, 0x92, 0xFA, 0xDC, 0x82, 0x8F, 0xEE, 0x87, 0xE2, 0xC8, 0x70, 0xEC,
+    0x42, 0x99, 0x4A, 0xBF, 0x37, 0x8E, 0x15, 0x69, 0xEE, 0x0D, 0xAD, 0x8C, 0xC6, 0xB6, 0x32, 0x19,
+    0x5B, 0xFF, 0xBD, 0x8F, 0xDE, 0x1A, 0x4A, 0xB7, 0xB1, 0x43, 0x8D, 0xED, 0x44, 0xFB, 0x94, 0x3B,
+    0x75, 0x42, 0x0F, 0x50, 0x42, 0xE1, 0x91, 0x11, 0x3A, 0xA8, 0xA1, 0x04, 0xED, 0x50, 0x01, 0x12,
+    0xB4, 0xB0, 0x03, 0xC6, 0x52, 0x78, 0x54, 0xE0, 0x7F, 0x24, 0xE6, 0x09, 0x1D, 0x80, 0x73, 0x98,
+    0x8E, 0xAF, 0x76, 0x30, 0xB2, 0x1A, 0x11, 0x15, 0x50, 0xF7, 0x7A, 0xF5, 0xB3, 0x83, 0xA2, 0xDB,
+    0xD6, 0xA1, 0x31, 0x6E, 0x61, 0x8A, 0x54, 0xAE, 0x6C, 0xD5, 0xD3, 0xB4, 0xD4, 0x13, 0xDA, 0xD2,
+    0xED, 0xEA, 0x47, 0xFB, 0xE2, 0x08, 0xE0, 0xCA, 0xFC, 0xEE, 0xED, 0x71, 0xB3, 0xB5, 0x48, 0xDA,
+    0x6D, 0xD3, 0x29, 0x5F, 0xB2, 0x50, 0xC1, 0xD0, 0xFE, 0xFD, 0x3F, 0xFF, 0xD1, 0x50, 0x1D, 0x6F,
+    0xFC, 0x42, 0xAC, 0xEC, 0xA1, 0x1E, 0xA6, 0x29, 0xFB, 0xAD, 0xA6, 0xFD, 0x38, 0xE9, 0xE5, 0x56,
+    0xAA, 0xD5, 0xA0, 0x53, 0xC9, 0x91, 0xEA, 0xB4, 0x9B, 0x30, 0xA8, 0x50, 0xD2, 0x90, 0xB4, 0x2B,
+    0xD9, 0x55, 0x41, 0xDB, 0xED, 0x73, 0x49, 0x79, 0xF3, 0x2F, 0x5A, 0x92, 0x5A, 0xEF, 0xB0, 0xCB,
+    0x49, 0x78, 0x73, 0xA6, 0xD7, 0x71, 0x75, 0x3F, 0xB3, 0xDB, 0x75, 0x7A, 0x69, 0xC8, 0x22, 0x99,
+    0xB0, 0x43, 0xAF, 0x42, 0x49, 0x2D, 0x63, 0xE1, 0x1B, 0x16, 0x2F, 0x79, 0xF3, 0xCF, 0x5A, 0xF2,
+    0x0F, 0x9D, 0x39, 0x09, 0xBD, 0x6B, 0x51, 0xE6, 0xDE, 0xF8, 0xB6, 0xA2, 0x69, 0x98, 0xB4, 0x34,
+    0x0B, 0x9A, 0x8E, 0xBA, 0x63, 0xD1, 0x93, 0x96, 0x2A, 0xCE, 0x6F, 0xBB, 0xF2, 0x44, 0x87, 0x38,
+    0x2C, 0x92, 0x5C, 0x57, 0x03, 0x5B, 0xBB, 0x4B, 0x76, 0x42, 0xC3, 0xD4, 0xD5, 0x4C, 0xA9, 0x69,
+    0x68, 0x69, 0x59, 0xB0, 0xA0, 0xA3, 0x93, 0x91, 0xAE, 0xF0, 0x22, 0xAF, 0x90, 0x0F, 0x7B, 0x64,
+    0x18, 0xC3, 0x40, 0xF9, 0x31, 0xAE, 0xAB, 0x23, 0xF8, 0xAD, 0x37, 0x46, 0x79, 0xE5, 0xFB, 0xA1,
+    0xCA, 0xA9, 0x92, 0x7D, 0x49, 0x63, 0xAC, 0x51, 0xBE, 0xB8, 0x17, 0x65, 0xE8, 0x8E, 0x71, 0x40,
+    0xA5, 0x3F, 0x76, 0xAB, 0x8F, 0x83, 0x49, 0xFB, 0x50, 0x8F, 0x49, 0xEF, 0x11, 0x09, 0x9D, 0x91,
+    0xB7, 0x1C, 0x70, 0xA8, 0xDF, 0x1A, 0x56, 0xE2, 0xCF, 0xFF, 0xA2, 0x58, 0xB0, 0xE3, 0x39, 0x42,
+    0x45, 0x4A, 0xCB, 0x12, 0x15, 0x46, 0x06, 0x4A, 0x8C, 0x66, 0x9E, 0x39, 0x92, 0x39, 0xEE, 0x7E,
+    0xC9, 0x58, 0x96, 0xA8, 0x8E, 0x32, 0x32, 0xB5, 0x0C, 0x2F, 0x14, 0x6F, 0xB9, 0xFD, 0xD5, 0x7F,
+    0x3C, 0xCE, 0x7C, 0x94, 0x63, 0x1F, 0xC3, 0xD9, 0xFC, 0xF3, 0x7C, 0x24, 0x23, 0xCD, 0x88, 0x13,
+    0xC5, 0x86, 0xA1, 0x4A, 0x5F, 0x31, 0xDA, 0xE5, 0xA4, 0x3B, 0xA0, 0xF2, 0xC5, 0x0F, 0x07, 0x3A,
+    0xE5, 0x0D, 0xAD, 0x48, 0xDA, 0x6D, 0xD1, 0xA9, 0x11, 0x18, 0xB4, 0x6F, 0x44, 0xAF, 0xC2, 0xEF,
+    0xB8, 0xC6, 0xFC, 0xC1, 0x7B, 0xF9, 0xCD, 0xA1, 0x8C, 0x93, 0xE3, 0x80, 0x0C, 0xE6, 0xAD, 0x41,
+    0xA6, 0x92, 0x56, 0x05, 0xC3, 0xA2, 0x70, 0x3B, 0x2A, 0x14, 0x3E, 0x91, 0x12, 0xF5, 0x2E, 0xA6,
+    0x46, 0x0D, 0x30, 0xC0, 0xA5, 0x27, 0x31, 0x7C, 0x40, 0x2A, 0x7E, 0x3A, 0xA8, 0x68, 0x5C, 0xA7,
+    0xFD, 0x44, 0x85, 0x8A, 0x4E, 0xBB, 0x03, 0xE5, 0x4B, 0xD5, 0x19, 0xEA, 0x32, 0xEE, 0x93, 0x3E,
+    0x79, 0xDD, 0xAB, 0x37, 0xBF, 0xB5, 0x8D, 0xA9, 0xEB, 0x48, 0xE5, 0x33, 0x1C, 0xA8, 0x84, 0x0C,
+    0xE6, 0xA9, 0x54, 0x10, 0x0B, 0x06, 0x3D, 0xA8, 0x81, 0x89, 0xF9, 0x47, 0x94, 0xDB, 0x60, 0x16,
+    0xA0, 0xD3, 0x88, 0x27, 0x3A, 0xC2, 0x56, 0x82, 0xDD, 0x8E, 0x73, 0x69, 0xC9, 0xD4, 0x4F, 0xD3,
+    0xD4, 0x4E, 0xDD, 0xC9, 0xE2, 0x1B, 0xB4, 0x22, 0x33, 0xC1, 0xB8, 0x1D, 0xB4, 0xDF, 0x46, 0xF9,
+    0x1A, 0x15, 0x6A, 0x64, 0xB8, 0x8E, 0x8C, 0x09, 0xF1, 0x7E, 0x40, 0xFC, 0xDC, 0xC3, 0x87, 0x20,
+    0xFE, 0x0A, 0x44, 0xBF, 0x69, 0x20, 0x47, 0x0C, 0xF8, 0xCD, 0x25, 0x4C, 0x23, 0xEC, 0x58, 0x28,
+    0x1E, 0x3C, 0x6F, 0xF2, 0xDE, 0xF6, 0x2B, 0xFD, 0x25, 0x19, 0x29, 0x3C, 0x25, 0xB4, 0x1B, 0x46,
+    0xD1, 0x70, 0x6E, 0x7A, 0xE5, 0x72, 0xCE, 0x7D, 0x5A, 0x25, 0x80, 0x33, 0x41, 0x0E, 0xB4, 0xC7,
+    0xA5, 0x88, 0xC4, 0xB3, 0x63, 0xE5, 0x29, 0xBC, 0x8C, 0x94, 0xB0, 0x3F, 0xFE, 0xAB, 0x44, 0x86,
+    0xB1, 0x40, 0xED, 0x52, 0x38, 0x6E, 0x58, 0x79, 0x4C, 0xB8, 0xC4, 0xC2, 0x6E, 0x93, 0x94, 0x7F,
+    0x96, 0xEB, 0x32, 0x18, 0x6A, 0x62, 0x61, 0x2F, 0x91, 0x94, 0xDF, 0xE2, 0xBA, 0xF4, 0x86, 0x5A,
+    0x44, 0x6D, 0x61, 0xC7, 0xAA, 0x01, 0x15, 0x9E, 0xAA, 0x74, 0x9B, 0x22, 0xB7, 0x05, 0x3D, 0xC6,
+    0xA9, 0xF0, 0xA4, 0xF4, 0x1D, 0xFF, 0xDA, 0xE6, 0x1F, 0x7A, 0x1D, 0x01, 0x4E, 0x73, 0x6A, 0x9A,
+    0x2E, 0x1E, 0xAE, 0x97, 0xA9, 0xEA, 0x10, 0x96, 0x4B, 0x9A, 0xC6, 0xD8, 0xC6, 0xD8, 0x1B, 0xA5,
+    0x9B, 0x18, 0x67, 0xEE, 0x27, 0xBA, 0x06, 0xA3, 0x3C, 0xF1, 0x32, 0xC0, 0x59, 0xE9, 0x94, 0x8B,
+    0x32, 0x2E, 0xE8, 0x27, 0x0C, 0x53, 0xD9, 0x1D, 0x14, 0x77, 0x53, 0x59, 0xF8, 0xCB, 0xCF, 0x8E,
+    0x9B, 0x3E, 0xC5, 0x06, 0xB7, 0xC7, 0xA4, 0x3E, 0xD8, 0x10, 0x90, 0x9B, 0xEC, 0x66, 0x03, 0xC3,
+    0xAA, 0x63, 0xF4, 0xA9, 0xF8, 0xA9, 0x03, 0x53, 0x02, 0xD7, 0x6B, 0x50, 0xBE, 0x83, 0x6D, 0x15,
+    0x20, 0x69, 0x87, 0xF9, 0xB7, 0xD7, 0x60, 0x9E, 0x07, 0xD4, 0x9F, 0x7C, 0xBB, 0x63, 0x07, 0x15,
+    0x48, 0x18, 0xA7, 0x1D, 0x53, 0x0E, 0xAD, 0x58, 0x7F, 0x2B, 0x33, 0xCD, 0x63, 0xB9, 0x1B, 0x47,
+    0x30, 0xDD, 0x03, 0xD9, 0x82, 0xB4, 0x5F, 0xAC, 0xC6, 0xDF, 0x38, 0x16, 0x38, 0xE9, 0xA0, 0x78,
+    0x27, 0x41, 0x2D, 0xFC, 0x17, 0xA9, 0xF1, 0xAC, 0xF4, 0x30, 0x54, 0x16, 0x15, 0x87, 0xA7, 0xD9,
+    0x31, 0xE1, 0x36, 0xA6, 0x73, 0x04, 0x98, 0x1E, 0xF8, 0x97, 0x11, 0xD4, 0x9B, 0x1E, 0x2E, 0x1A,
+    0xC6, 0x29, 0x42, 0xDB, 0x0E, 0x6A, 0x19, 0x51, 0x1F, 0x7C, 0xC7, 0x53, 0xE6, 0x0C, 0x1F, 0xCF,
+    0x0E, 0xC6, 0xE6, 0xA1, 0x46, 0x45, 0x19, 0x31, 0xBE, 0xBA, 0xC9, 0xFC, 0x5F, 0x67, 0x6F, 0xB2,
+    0xFF, 0x55, 0x11, 0x36, 0x67, 0x1C, 0x4C, 0x1D, 0x6C, 0x8F, 0x53, 0x59, 0x35, 0x52, 0x88, 0x70,
+    0x6E, 0x33, 0xE1, 0xEB, 0x08, 0xAC, 0x8E, 0x8D, 0x80, 0xD3, 0xB3, 0xD9, 0x15, 0x35, 0x12, 0x27,
+    0xB7, 0x29, 0xBC, 0x72, 0x32, 0xE1, 0x59, 0x6C, 0xC2, 0xC9, 0x00, 0xC5, 0x5F, 0xFE, 0x11, 0x72,
+    0xE4, 0x25, 0x9E, 0x7A, 0xE8, 0x85, 0x97, 0x89, 0x44, 0xCF, 0xAE, 0x58, 0xE5, 0x23, 0x91, 0x73,
+    0x06, 0xF8, 0xB5, 0x8D, 0x67, 0xE6, 0x1E, 0x56, 0x6E, 0x3C, 0xB3, 0x5F, 0xB9, 0x16, 0xE9, 0x40,
+    0x0E, 0x20, 0x1F, 0x3A, 0x54, 0xEC, 0x90, 0xE1, 0xCB, 0x5F, 0x80, 0x96, 0x3B, 0xDB, 0x70, 0x50,
+    0x3A, 0xAA, 0x22, 0x3C, 0x99, 0x28, 0x66, 0x33, 0x6B, 0x72, 0x4E, 0xDC, 0xB8, 0xB5, 0xA4, 0xE4,
+    0x59, 0xB4, 0x57, 0x63, 0xD3, 0xD4, 0x6D, 0x1A, 0xAC, 0xF2, 0xD6, 0x1F, 0xA2, 0x73, 0x3F, 0xCE,
+    0x21, 0x27, 0x0F, 0x29, 0xD0, 0x5E, 0x79, 0x15, 0x45, 0x3C, 0x93, 0x73, 0x57, 0xE4, 0x3C, 0xC0,
+    0x73, 0xD0, 0xA1, 0x7A, 0x64, 0x3F, 0xD2, 0x89, 0xA7, 0x67, 0x76, 0xBA, 0xA6, 0x74, 0x23, 0x7D,
+    0xA3, 0xDD, 0xC8, 0xA3, 0x1D, 0xD3, 0x37, 0x63, 0x61, 0xDA, 0x30, 0x3B, 0x62, 0xE5, 0xCA, 0x6C,
+    0xE1, 0x0C, 0x54, 0x88, 0x35, 0xBA, 0xE3, 0x4B, 0xC7, 0x14, 0x49, 0xEE, 0x29, 0x1D, 0x25, 0x54,
+    0xB0, 0x03, 0x0D, 0x34, 0xD0, 0xC2, 0x12, 0x7A, 0x38, 0xE9, 0x4C, 0x12, 0x2A, 0x72, 0xA1, 0x1F,
+    0xA7, 0xC0, 0x3F, 0x84, 0x35, 0x7C, 0x1A, 0xE8, 0x5A, 0xBA, 0x62, 0xF4, 0xA5, 0x55, 0x39, 0x52,
+    0x3A, 0x0A, 0x8F, 0x7C, 0xD2, 0x3D, 0xDB, 0xE3, 0xCF, 0xFD, 0x49, 0x37, 0x7D, 0xFC, 0x59, 0xAC,
+    0x9C, 0xC8, 0x1D, 0x5C, 0xD2, 0x4C, 0x5F, 0x0E, 0xE6, 0x5E, 0x7A, 0x32, 0x5E, 0x9A, 0x3C, 0xF2,
+    0xC5, 0xA0, 0x4F, 0x7A, 0xAA, 0xE6, 0xF8, 0xB3, 0xFA, 0x4C, 0x8F, 0xE5, 0x51, 0x91, 0x33, 0x6B,
+    0xC6, 0xA9, 0x59, 0x00, 0x14, 0x29, 0x82, 0x7A, 0xD8, 0x01, 0xEF, 0xF6, 0x4F, 0x27, 0xE2, 0xE9,
+    0x2B, 0x9C, 0xBF, 0xAA, 0x8E, 0x28, 0xD7, 0x54, 0x8E, 0x05, 0x45, 0x62, 0x1B, 0xB9, 0xC6, 0xC0,
+    0xA7, 0x5E, 0x79, 0xEA, 0x5E, 0x44, 0x4C, 0xC5, 0x3E, 0xC5, 0xEB, 0xA1, 0x41, 0x86, 0xA5, 0x81,
+    0x64, 0x5E, 0xF2, 0xD4, 0xEA, 0xFD, 0x48, 0x49, 0xBB, 0x4F, 0xE1, 0xCC, 0x12, 0x19, 0x44, 0x86,
+    0xC4, 0xD4, 0x73, 0x68, 0x8B, 0x28, 0xF2, 0x53, 0x8C, 0xB8, 0xB0, 0x9B, 0x93, 0x9C, 0x3A, 0x90,
+    0xFD, 0x31, 0xD8, 0x00, 0x67, 0x6E, 0xC2, 0x3C, 0x3B, 0xD6, 0xDF, 0x1E, 0x18, 0x28, 0xDD, 0x80,
+    0x4A, 0x2D, 0xEC, 0x4D, 0xC0, 0xBC, 0x02, 0xEA, 0xA7, 0x1E, 0x3E, 0x89, 0xD0, 0xF6, 0x50, 0x4D,
+    0xC0, 0xFC, 0xC8, 0x51, 0xDC, 0x4F, 0xA8, 0xB8, 0x87, 0x4C, 0x26, 0x14, 0x89, 0x7C, 0x3B, 0xA1,
+    0xF3, 0xC9, 0xC5, 0x21, 0xDF, 0x1D, 0x93, 0x5D, 0xAC, 0x41, 0x1E, 0x3D, 0x75, 0xA5, 0xF8, 0xAB,
+    0x57, 0x75, 0x16, 0x30, 0x11, 0xCC, 0x01, 0x98, 0x6F, 0x7A, 0x8C, 0x7D, 0xF5, 0x0B, 0x52, 0x25,
+    0xFD, 0x1D, 0x54, 0x77, 0x00, 0x43, 0xF5, 0xD4, 0xD9, 0x7D, 0xD5, 0x22, 0xF2, 0x1A, 0xF5, 0xE8,
+    0x3B, 0x49, 0x25, 0x6E, 0xA8, 0x84, 0xB9, 0x9B, 0x10, 0x5D, 0x0F, 0x4D, 0x0B, 0xE6, 0x1A, 0xA8,
+    0x9F, 0x39, 0xC4, 0x47, 0x11, 0x96, 0x3D, 0x4C, 0x26, 0x50, 0x1A, 0x8F, 0xF9, 0x7E, 0x87, 0xF6,
+    0x53, 0x5B, 0x7A, 0xB5, 0x5E, 0x79, 0xAA, 0xE3, 0x2B, 0x1F, 0x71, 0x5C, 0x02, 0x55, 0xC7, 0x78,
+    0xDD, 0xC3, 0xE9, 0x13, 0x0E, 0xE2, 0x0B, 0x20, 0x4D, 0x36, 0xC0, 0x5A, 0x6D, 0x6E, 0x5E, 0x4D,
+    0xF7, 0xE4, 0xB4, 0xBE, 0x28, 0x85, 0x5F, 0x3A, 0xB6, 0xEE, 0xD3, 0x00, 0x7B, 0x25, 0x98, 0xF1,
+    0x9E, 0xFC, 0x8B, 0x52, 0x28, 0xDD, 0x9D, 0xB1, 0xFE, 0x99, 0xD7, 0x9F, 0x5C, 0x1D, 0x89, 0x99,
+    0x3D, 0x3D, 0x9B, 0x0F, 0x22, 0xBF, 0x7F, 0x40, 0x11, 0xB5, 0xA3, 0xA1, 0x47, 0x79, 0x63, 0xA9,
+    0x45, 0xA2, 0x70, 0x15, 0xEC, 0xCB, 0xB8, 0xD1, 0xA3, 0x02, 0x86, 0x16, 0x11, 0x0B, 0xCF, 0x36,
+    0x4B, 0x94, 0x2F, 0x3C, 0x3D, 0x53, 0xA6, 0xC8, 0x9C, 0xFD, 0x26, 0xC9, 0x8F, 0xE7, 0xD8, 0xB1,
+    0xAF, 0x5C, 0x8E, 0x6C, 0xC7, 0xF5, 0x93, 0x31, 0xE3, 0x07, 0x76, 0x95, 0xFD, 0x9E, 0x8E, 0x35,
+    0xDD, 0x84, 0xDA, 0x50, 0x16, 0x4E, 0xBF, 0x16, 0x8A, 0xD0, 0xA9, 0xD4, 0xC8, 0xA1, 0xBC, 0xF7,
+    0xF6, 0x24, 0xBF, 0x37, 0x4C, 0xFD, 0x93, 0x12, 0xAD, 0x2D, 0x45, 0x40, 0x05, 0x54, 0x80, 0xF0,
+    0xF9, 0xE5, 0xB4, 0x30, 0x77, 0x34, 0x89, 0x7A, 0x9B, 0x46, 0xB9, 0xCF, 0x25, 0xE7, 0xB9, 0xD3,
+    0x54, 0x2F, 0x07, 0x7D, 0x2F, 0x61, 0xCF, 0x9D, 0x4C, 0x5B, 0xD7, 0x75, 0x1E, 0x8A, 0x70, 0xA8,
+    0xBC, 0x79, 0x29, 0x2A, 0x9F, 0x44, 0xDA, 0x65, 0xB1, 0xCD, 0x9E, 0xB1, 0x53, 0x15, 0xAA, 0xBB,
+    0xC3, 0xA5, 0x8F, 0x1E, 0x1E, 0x4D, 0xEF, 0x9F, 0xD0, 0x01, 0xFF, 0x0F, 0xEC, 0xC3, 0x3F, 0x47,
+    0x47, 0xB6, 0x50, 0x5E, 0xA4, 0x4D, 0xDF, 0x27, 0x3C, 0xC6, 0x52, 0x41, 0x05, 0x17, 0x8F, 0x77,
+    0xEE, 0xF5, 0x6D, 0xBF, 0x5F, 0x16, 0xAE, 0xAD, 0xD5, 0x3B, 0xF1, 0x40, 0xDF, 0xF6, 0xD3, 0x07,
+    0x74, 0xA8, 0x20, 0x8C, 0x6F, 0xCB, 0x1C, 0xAA, 0x13, 0x70, 0x95, 0x81, 0xD2, 0x8E, 0x7A, 0xBE,
+    0xFE, 0x4B, 0x2F, 0x2E, 0x11, 0x6B, 0x4C, 0x4B, 0xDA, 0x37, 0x36, 0xFE, 0x52, 0x8B, 0xAF, 0x3C,
+    0x27, 0xBB, 0x03, 0x99, 0x96, 0x4F, 0x7C, 0x75, 0xCD, 0xCB, 0x0F, 0x93, 0xFE, 0x46, 0xDA, 0x12,
+    0xA9, 0x56, 0x61, 0xB7, 0xB2, 0xFF, 0x6D, 0x20, 0xDF, 0xA4, 0x83, 0x0E, 0x3B, 0x14, 0x7E, 0x9E,
+    0xED, 0xB1, 0xE2, 0xE7, 0xE9, 0x64, 0x92, 0x49, 0x04, 0xA0, 0xBA, 0x9B, 0xA9, 0x45, 0xD2, 0xAE,
+    0x11, 0x49, 0xFB, 0x86, 0xF4, 0xCD, 0xB7, 0xAB, 0x74, 0xE3, 0xD8, 0x36, 0xD1, 0xD1, 0xD1, 0x6D,
+    0x2C, 0xAB, 0x7C, 0x99, 0xA8, 0x29, 0xD1, 0x4E, 0x05, 0x91, 0x58, 0xD2, 0x60, 0x4E, 0x15, 0x6F,
+    0xCB, 0xCC, 0x8D, 0x13, 0x83, 0xCA, 0x68, 0x5A, 0xA3, 0xBF, 0x35, 0x9A, 0xF3, 0x77, 0xAD, 0x38,
+    0x2D, 0x5E, 0xEC, 0x0E, 0x2A, 0xED, 0x37, 0x46, 0x54, 0xBE, 0x18, 0x9E, 0x3A, 0xBA, 0x12, 0x99,
+    0x68, 0x50, 0x77, 0x69, 0x93, 0x1E, 0x4E, 0x74, 0x20, 0xBB, 0x57, 0x99, 0x3F, 0x44, 0x97, 0x81,
+    0x73, 0x57, 0xFE, 0xBF, 0xE6, 0xF2, 0xE7, 0x8F, 0x2F, 0xA8, 0xB5, 0x47, 0x84, 0xCF, 0x33, 0xAC,
+    0xB3, 0x0D, 0x7B, 0xD0, 0xA1, 0x02, 0xCA, 0x7E, 0xAE, 0x71, 0x3F, 0xA1, 0x7A, 0x4C, 0x4B, 0xB3,
+    0x4D, 0xF7, 0xEC, 0x2F, 0x2D, 0xE1, 0x6F, 0xCB, 0x9A, 0x35, 0x3A, 0x47, 0xE3, 0x5B, 0xED, 0xCD,
+    0x4B, 0x41, 0xBD, 0x9F, 0xE8, 0x16, 0x34, 0x0D, 0xC6, 0x58, 0xFD, 0x7A, 0x54, 0x7E, 0xA9, 0x62,
+    0xF9, 0x61, 0x14, 0x4F, 0x00, 0x45, 0x8C, 0x4C, 0xBA, 0xE8, 0xC6, 0xDB, 0xA2, 0x8B, 0x27, 0xD4,
+    0xD5, 0xE7, 0x18, 0xC1, 0x41, 0x84, 0xB1, 0xDF, 0x71, 0xC8, 0xC8, 0x49, 0x52, 0x7C, 0x4E, 0x61,
+    0x25, 0xA8, 0x01, 0x3E, 0x09, 0x6C, 0x6F, 0xA1, 0x8F, 0x93, 0xE4, 0x73, 0x08, 0xFB, 0xCA, 0x19,
+    0x8A, 0x77, 0x3A, 0x96, 0x15, 0x02, 0xFB, 0xF9, 0xB7, 0x34, 0x9B, 0xCD, 0xAE, 0x52, 0xE5, 0x9C,
+    0xA3, 0x7E, 0xFC, 0x9D, 0xBF, 0xBC, 0xED, 0x0E, 0x29, 0xB9, 0xA8, 0x03, 0x0B, 0x5E, 0xDD, 0x43,
+    0x05, 0x54, 0xC4, 0xD8, 0x71, 0xEA, 0x66, 0x89, 0x7C, 0xFC, 0x86, 0x8A, 0xE8, 0xDC, 0x19, 0xC7,
+    0x84, 0xF1, 0x4E, 0x92, 0x9E, 0xC2, 0xA3, 0x12, 0x15, 0x67, 0x8A, 0x40, 0xCF, 0x65, 0x13, 0x54,
+    0x90, 0xC1, 0x3C, 0x5E, 0xE5, 0x8C, 0xCE, 0x39, 0x7F, 0xA6, 0x71, 0x13, 0x2B, 0x3B, 0x77, 0x55,
+    0xFE, 0xD1, 0xED, 0x97, 0x52, 0x99, 0x76, 0x2A, 0xA6, 0x74, 0x1D, 0xBD, 0x7E, 0xD3, 0xAB, 0xB0,
+    0xDC, 0xC1, 0xAC, 0x5C, 0xC7, 0x34, 0xAA, 0x20, 0x13, 0xC6, 0x19, 0x2F, 0x2A, 0xB2, 0x5D, 0xCC,
+    0x6F, 0xAF, 0xB2, 0x9F, 0x77, 0xD3, 0xEE, 0x64, 0xCF, 0xD3, 0x9C, 0x3F, 0x98, 0xCD, 0xAE, 0xCC,
+    0x66, 0xB3, 0xD9, 0x6C, 0x36, 0xCF, 0x39, 0xE7, 0xFC, 0xF1, 0x6C, 0x36, 0x9B, 0xCD, 0xAE, 0x62,
+    0x2F, 0x1B, 0x19, 0x6A, 0xED, 0x0F, 0x0A, 0x2F, 0xDD, 0x41, 0x11, 0x5A, 0xED, 0xD2, 0x25, 0x09,
+    0xF6, 0xDC, 0xB3, 0xCA, 0xA5, 0x5A, 0xBF, 0x18, 0x6A, 0x23, 0xD3, 0x52, 0xBF, 0xDB, 0x95, 0x85,
+    0x17, 0xF6, 0x4A, 0xF5, 0x72, 0xD8, 0x2B, 0xBF, 0x91, 0x5A, 0xFD, 0x5A, 0xAC, 0x8D, 0x0C, 0xFB,
+    0xCF, 0x6C, 0xC2, 0xDE, 0x38, 0xED, 0x8B, 0xB7, 0xA2, 0x4A, 0xEA, 0x7F, 0x25, 0x3A, 0x86, 0x73,
+    0xC0, 0x29, 0xFE, 0x37, 0xC5, 0x98, 0x4F, 0x8C, 0x25, 0xC7, 0x5D, 0xC7, 0x3F, 0xD5, 0xB5, 0xBB,
+    0x65, 0xA5, 0x4C, 0x6A, 0x91, 0xD8, 0x08, 0x31, 0xF6, 0xF4, 0x29, 0x52, 0x64, 0x79, 0x5E, 0x9F,
+    0x10, 0x2B, 0xDC, 0xFD, 0xBA, 0xB2, 0x6B, 0x14, 0x24, 0x4B, 0xB0, 0xA0, 0x79, 0x09, 0x52, 0x42,
+    0x92, 0x6B, 0x04, 0x68, 0x2F, 0x48, 0x0C, 0xA8, 0x3D, 0xAF, 0xEC, 0x3D, 0x58, 0xC8, 0x07, 0xF6,
+    0x04, 0xA7, 0x80, 0x0F, 0x1C, 0xC8, 0x1E, 0x18, 0x0B, 0x06, 0xF4, 0x80, 0xB7, 0xFB, 0x6A, 0xED,
+    0x43, 0x0E, 0x3E, 0xA4, 0x92, 0x95, 0xC2, 0x01, 0x89, 0xB4, 0x95, 0x0D, 0x42, 0x5E, 0x81, 0xCB,
+    0xA4, 0x56, 0xEE, 0xD9, 0xED, 0x79, 0xC5, 0xE1, 0xCD, 0xEC, 0x6C, 0x14, 0x23, 0x21, 0x2E, 0xF4,
+    0xE1, 0x1D, 0xBA, 0xEA, 0x7D, 0x7F, 0x7F, 0xEA, 0xFB, 0xFB, 0xFE, 0x7E, 0xD5, 0xF0, 0xF6, 0x0E,
+    0xDC, 0x2E, 0x1D, 0x95, 0x0A, 0x9C, 0x3E, 0x97, 0x66, 0x33, 0x6B, 0x72, 0x8E, 0xEC, 0xDF, 0x5A,
+    0x52, 0xF2, 0x69, 0xB4, 0x97, 0x14, 0x3D, 0x90, 0x80, 0x1A, 0x28, 0x6F, 0xBD, 0x85, 0xCE, 0x03,
+    0xF2, 0x27, 0x5E, 0xA2, 0xD0, 0x5E, 0x7A, 0xD9, 0x8B, 0xFE, 0x42, 0xCE, 0x49, 0xE5, 0x3C, 0x02,
+    0x7C, 0x1D, 0xD0, 0x1E, 0x68, 0x2D, 0xC8, 0x35, 0xF0, 0xFC, 0x02, 0xF8, 0x28, 0x82, 0xBA, 0xEA,
+    0xA1, 0x36, 0x96, 0x22, 0x34, 0x60, 0x58, 0xC0, 0xD1, 0x17, 0x23, 0x2A, 0x67, 0x4F, 0x33, 0xBB,
+    0x6E, 0x8B, 0x9E, 0x06, 0x03, 0x03, 0x0B, 0x64, 0xD4, 0xF7, 0x29, 0xEF, 0xE7, 0x28, 0x73, 0x64,
+    0x36, 0xDB, 0x25, 0xE7, 0x63, 0xCA, 0x5B, 0x4B, 0x4A, 0x6A, 0x2A, 0x2E, 0x33, 0xE1, 0x22, 0x0D,
+    0xD0, 0x00, 0xF3, 0x6C, 0xB9, 0x73, 0xD0, 0x33, 0x14, 0x89, 0xC4, 0x40, 0x64, 0x21, 0x22, 0x43,
+    0x11, 0x49, 0xB2, 0x97, 0xFD, 0xD6, 0x7A, 0xE5, 0xE6, 0x79, 0xD8, 0x84, 0x7B, 0xE1, 0x5B, 0x88,
+    0x9C, 0x7B, 0xF1, 0x17, 0x57, 0x06, 0x4A, 0x96, 0x54, 0x74, 0x4C, 0xE8, 0x68, 0x18, 0xA8, 0x8B,
+    0xC8, 0x3C, 0x3B, 0xEE, 0xAC, 0x7E, 0x1A, 0xAB, 0x17, 0x49, 0x06, 0xD9, 0x6F, 0x3D, 0x7A, 0x0A,
+    0x6B, 0x36, 0x9B, 0x91, 0x73, 0xA6, 0xBC, 0x75, 0x87, 0x92, 0x09, 0x15, 0x3B, 0x4C, 0x78, 0xF1,
+    0x89, 0x5F, 0x1D, 0xB0, 0x04, 0x86, 0x93, 0xBC, 0x45, 0x10, 0x11, 0x8A, 0x08, 0xB2, 0x87, 0xAD,
+    0x23, 0x98, 0xAF, 0x4F, 0x81, 0x98, 0xE7, 0xEC, 0xB9, 0xF0, 0x70, 0x6E, 0xE1, 0x50, 0x3B, 0xA8,
+    0x65, 0x00, 0x43, 0x04, 0x65, 0x3B, 0x90, 0xBE, 0x02, 0x7A, 0xED, 0xE0, 0x50, 0x06, 0xA8, 0x89,
+    0xB0, 0x43, 0x07, 0x86, 0x09, 0x68, 0x6B, 0x2C, 0xCA, 0xC9, 0x80, 0xF2, 0x44, 0xCA, 0x9C, 0xB3,
+    0x33, 0x39, 0xE7, 0x24, 0x3D, 0x74, 0x22, 0x42, 0xC9, 0x1E, 0x68, 0xFB, 0x3C, 0x14, 0x5E, 0x01,
+    0x6F, 0x71, 0x16, 0x45, 0x9B, 0xB3, 0x17, 0x8F, 0x6E, 0x45, 0x3A, 0x2E, 0x53, 0xF1, 0x2C, 0xDA,
+    0x81, 0x0C, 0x1B, 0x9F, 0xD9, 0xBF, 0xE5, 0xA8, 0x72, 0x8F, 0x79, 0xFA, 0x65, 0xC7, 0x73, 0x54,
+    0x18, 0x8C, 0x53, 0x6E, 0x2B, 0xE7, 0x50, 0xE6, 0x1C, 0xE1, 0x73, 0x5C, 0xBA, 0x26, 0xDE, 0x92,
+    0xC7, 0x32, 0xFB, 0xD6, 0xEB, 0x51, 0x24, 0x99, 0xE1, 0x50, 0xFA, 0x29, 0x10, 0xCB, 0x22, 0x40,
+    0xE1, 0x17, 0xDB, 0x80, 0xBC, 0x11, 0x22, 0xA0, 0x8D, 0x01, 0x68, 0xEF, 0x24, 0x40, 0x3E, 0x7E,
+    0xDC, 0x03, 0x95, 0x7E, 0xC3, 0x83, 0x48, 0x8D, 0x71, 0x50, 0xBA, 0x58, 0x02, 0xA3, 0xF2, 0x53,
+    0x30, 0x7E, 0xC2, 0x12, 0x8E, 0x39, 0x64, 0xA4, 0x0C, 0x3A, 0x15, 0x83, 0x38, 0x26, 0xC7, 0x62,
+    0x78, 0x42, 0xE7, 0xCF, 0xDC, 0x64, 0x95, 0xED, 0xF4, 0x4B, 0xD1, 0xD0, 0x28, 0x6B, 0xAC, 0x93,
+    0x1E, 0x11, 0x11, 0x91, 0xDF, 0x49, 0x54, 0x6B, 0xD0, 0x01, 0x46, 0xA8, 0x9E, 0xC1, 0xBC, 0x69,
+    0xD5, 0xBD, 0xA8, 0xE2, 0xFC, 0xC3, 0xA8, 0xF2, 0xA6, 0x20, 0x66, 0xBB, 0x62, 0x66, 0x4D, 0xB6,
+    0xF3, 0x63, 0x4A, 0xC7, 0x6D, 0x44, 0xC4, 0x78, 0x2A, 0xE4, 0x40, 0xD1, 0x93, 0x2D, 0x0D, 0x4D,
+    0x44, 0x06, 0x53, 0x42, 0x27, 0xDF, 0x89, 0xE8, 0xBB, 0x71, 0x0A, 0xC3, 0x9E, 0x0C, 0x98, 0xAF,
+    0xD2, 0xC1, 0x63, 0xA7, 0x3D, 0x65, 0xCF, 0x82, 0x22, 0x61, 0x2C, 0x53, 0x48, 0x6C, 0x0D, 0xCC,
+    0x6F, 0xAA, 0x1C, 0xAA, 0xFC, 0xC4, 0x4F, 0xF7, 0x33, 0x40, 0x2D, 0x3C, 0xC8, 0x7E, 0x01, 0x94,
+    0x6B, 0x80, 0x4B, 0xA7, 0xCB, 0xE7, 0x67, 0xF6, 0xD2, 0x2E, 0x39, 0xA9, 0x1C, 0xC4, 0x80, 0x0E,
+    0x94, 0x30, 0x52, 0x44, 0x5A, 0xC7, 0x04, 0x93, 0x90, 0x41, 0xFE, 0x00, 0x1A, 0x3E, 0x8A, 0x28,
+    0x5F, 0x57, 0xB0, 0x2C, 0x65, 0x8F, 0x79, 0xC3, 0x35, 0xF0, 0xB0, 0x57, 0x1E, 0xB3, 0x60, 0x89,
+    0x58, 0xA3, 0x1D, 0x95, 0x25, 0x21, 0x7B, 0x8C, 0x15, 0x2B, 0xA7, 0x8E, 0x98, 0x1F, 0x17, 0x39,
+    0xC2, 0xEC, 0x9A, 0x78, 0x4B, 0xE6, 0x50, 0x05, 0x31, 0xC8, 0x8C, 0xF2, 0x13, 0xA8, 0x8A, 0x1E,
+    0x16, 0x25, 0xC8, 0x10, 0xC1, 0xBC, 0x02, 0xEC, 0x0F, 0x50, 0x3C, 0x8E, 0x60, 0x6E, 0x04, 0x68,
+    0xB4, 0x87, 0x58, 0x5A, 0x94, 0x6F, 0xA1, 0xE2, 0x55, 0x18, 0x18, 0xD9, 0x3A, 0x12, 0xA3, 0xC8,
+    0x43, 0x31, 0xF2, 0x14, 0xA9, 0x8A, 0x9C, 0xD7, 0xB0, 0xFF, 0xE5, 0x1E, 0x6A, 0xE5, 0xA1, 0xD6,
+    0x1E, 0xF6, 0x8C, 0x83, 0xB7, 0x8D, 0x85, 0x68, 0x40, 0xF4, 0x25, 0x14, 0xBE, 0x02, 0xE9, 0xA7,
+    0xA0, 0x6D, 0x03, 0x86, 0xFA, 0x84, 0xD8, 0x1D, 0x4B, 0x7E, 0x31, 0x31, 0xD0, 0xF6, 0x17, 0xD6,
+    0xB4, 0xB6, 0xCC, 0xF6, 0x24, 0x3B, 0xBB, 0x88, 0x19, 0x2A, 0x23, 0xB2, 0xA7, 0x0A, 0x64, 0x8B,
+    0x49, 0xAC, 0x3C, 0xF2, 0x3F, 0x69, 0x22, 0xE2, 0x81, 0xDB, 0x59, 0xC2, 0xDF, 0x45, 0x33, 0x81,
+    0xBA, 0xD3, 0xDA, 0xB1, 0x6D, 0xE4, 0xEB, 0x3D, 0xFA, 0xEA, 0x3D, 0x9F, 0x90, 0xFE, 0xA8, 0x6F,
+    0x20, 0x4E, 0xA2, 0xB1, 0x2C, 0x54, 0x92, 0x81, 0x86, 0x91, 0x88, 0xA1, 0xA1, 0x46, 0xB9, 0x4F,
+    0x51, 0xA2, 0x12, 0x94, 0xF7, 0x4D, 0x86, 0x2A, 0x7F, 0x22, 0x2F, 0xB4, 0xA7, 0x82, 0x81, 0xA2,
+    0xC7, 0x58, 0x1A, 0x88, 0xC8, 0x40, 0x09, 0xF3, 0x9C, 0x23, 0x3A, 0xE7, 0x35, 0x0C, 0xC8, 0x80,
+    0xB1, 0x74, 0x10, 0xD1, 0x9E, 0x12, 0x16, 0x14, 0xF1, 0x93, 0x79, 0xF1, 0x0D, 0x50, 0x79, 0xC0,
+    0xFC, 0xE8, 0xBA, 0x37, 0x5E, 0x0C, 0xC6, 0xD3, 0x2A, 0x8F, 0xBA, 0xD7, 0xC3, 0xC3, 0x08, 0xCD,
+    0x12, 0xCC, 0x3E, 0xA8, 0xEF, 0x38, 0x8A, 0x1F, 0xF7, 0x30, 0x0C, 0xD0, 0xB5, 0x30, 0x55, 0x81,
+    0x8A, 0x63, 0xE6, 0x98, 0x47, 0x19, 0x56, 0x47, 0x67, 0x47, 0x30, 0xA3, 0xCD, 0x39, 0x7B, 0xB1,
+    0xBE, 0xB5, 0xB2, 0x74, 0x68, 0x47, 0x85, 0xEC, 0xD1, 0x8E, 0x84, 0x0C, 0x74, 0x90, 0xA8, 0xA0,
+    0xC3, 0x38, 0x2A, 0x64, 0xC0, 0xB8, 0x4D, 0x18, 0x1D, 0xC4, 0x4F, 0x58, 0xD9, 0x1A, 0xC4, 0xDA,
+    0x96, 0xF9, 0x4A, 0x8E, 0x70, 0xFE, 0x27, 0x84, 0xB4, 0xA3, 0xA2, 0x61, 0x42, 0x43, 0x43, 0x47,
+    0xCD, 0x40, 0x27, 0x23, 0xB7, 0x0F, 0x1C, 0xF9, 0xE8, 0x7F, 0x16, 0xBF, 0x0C, 0x88, 0x6F, 0x58,
+    0x56, 0x39, 0x98, 0x1F, 0xAD, 0xDC, 0xC8, 0x8E, 0xF1, 0xBC, 0xDD, 0x51, 0xDC, 0xE8, 0xA1, 0xDC,
+    0xA8, 0xA7, 0xEC, 0xC1, 0x38, 0x98, 0x02, 0xE3, 0xE6, 0xFF, 0xAA, 0xE7, 0x59, 0x93, 0x2E, 0x44,
+    0x93, 0x33, 0xFA, 0xA4, 0x72, 0x2F, 0xCD, 0x66, 0xBF, 0x91, 0x73, 0x7E, 0x70, 0x6B, 0x7D, 0xD0,
+    0xC9, 0xF0, 0x62, 0x2C, 0xF9, 0x1B, 0xBB, 0x2C, 0x6C, 0xD1, 0x83, 0xB1, 0x50, 0x6F, 0xAC, 0x6B,
+    0xBF, 0x01, 0x4A, 0x20, 0xFD, 0x13, 0x13, 0x5B, 0x47, 0x88, 0x3C, 0xC2, 0xF9, 0x19, 0xB3, 0xDF,
+    0xCC, 0xB1, 0x5A, 0xAB, 0xC4, 0x3E, 0x15, 0xCA, 0x8B, 0x48, 0xC2, 0xD8, 0x6D, 0x18, 0xA4, 0x47,
+    0xFB, 0x43, 0xE8, 0xB6, 0x41, 0xDE, 0xF3, 0x30, 0x39, 0x04, 0xB1, 0x06, 0x8C, 0x3F, 0xD1, 0xF7,
+    0x6D, 0x28, 0xDE, 0xF0, 0xD0, 0x46, 0x90, 0x67, 0x92, 0x24, 0x72, 0x84, 0x0B, 0x09, 0x98, 0x80,
+    0x58, 0xAD, 0x2D, 0xF9, 0x4E, 0x66, 0x5F, 0xFA, 0xD1, 0xD8, 0x3D, 0xF5, 0xBD, 0xA8, 0x5D, 0xD3,
+    0x90, 0xE4, 0x3D, 0x6F, 0x68, 0x6A, 0x11, 0xD5, 0xBB, 0x61, 0x9B, 0xA1, 0x2D, 0xC2, 0x3E, 0xEB,
+    0x3B, 0x2B, 0x57, 0xE4, 0xEC, 0x36, 0xAD, 0x44, 0x3B, 0xD0, 0xD9, 0xC2, 0xEC, 0x1A, 0x70, 0x69,
+    0xF7, 0xFC, 0x2E, 0x79, 0xA8, 0x8E, 0xA9, 0x9C, 0xEA, 0x31, 0xDE, 0x38, 0x54, 0x98, 0x9C, 0xEA,
+    0xC9, 0x47, 0x11, 0x58, 0x79, 0xA0, 0x05, 0x98, 0x03, 0x22, 0x5B, 0x90, 0xEF, 0x79, 0x30, 0x32,
+    0x40, 0x53, 0x44, 0x48, 0x24, 0x8A, 0x9E, 0x25, 0xE5, 0x7D, 0x91, 0x5D, 0x1E, 0x75, 0x0E, 0xCC,
+    0x76, 0xCF, 0xCF, 0x68, 0x8F, 0x55, 0xF6, 0x62, 0x60, 0x6E, 0x9F, 0x22, 0x81, 0x3E, 0xA3, 0xC7,
+    0x4F, 0x11, 0x47, 0x44, 0x64, 0x60, 0x09, 0x91, 0x09, 0x74, 0x18, 0xFB, 0xD4, 0xCA, 0x56, 0xCE,
+    0xD9, 0x95, 0x39, 0xE7, 0xC4, 0x49, 0x5F, 0xA4, 0x04, 0xD0, 0x16, 0x28, 0x3C, 0x67, 0xED, 0xE8,
+    0xD2, 0xEE, 0xF9, 0x59, 0x99, 0x65, 0x0E, 0xB7, 0xA9, 0x6C, 0x85, 0xF6, 0xC6, 0xC9, 0x5E, 0x06,
+    0x12, 0x91, 0x9A, 0x86, 0x12, 0xE3, 0xB4, 0x2F, 0x72, 0xEE, 0xA9, 0xD6, 0xE9, 0x04, 0xAC, 0x3A,
+    0xC9, 0x8E, 0x0C, 0x9B, 0x93, 0x10, 0x6B, 0x8B, 0xDC, 0x48, 0xDC, 0xA5, 0x6B, 0xB3, 0x6B, 0x32,
+    0xBF, 0x9B, 0xDF, 0xCD, 0x5E, 0x0C, 0x45, 0x92, 0x09, 0xE5, 0xB5, 0x37, 0x8E, 0x8A, 0x09, 0x0D,
+    0x2C, 0x48, 0x44, 0x64, 0x90, 0x5E, 0x79, 0x0C, 0xE5, 0xC6, 0xF9, 0x25, 0x03, 0x45, 0x94, 0xBD,
+    0x0C, 0x18, 0x67, 0xAC, 0x81, 0x86, 0x9A, 0x0E, 0xA2, 0x88, 0x45, 0x8F, 0xF2, 0xDA, 0x19, 0xCB,
+    0x84, 0x29, 0x0D, 0x0C, 0x24, 0x11, 0xD9, 0xCA, 0x07, 0x8F, 0xF2, 0x7D, 0x91, 0x73, 0xCE, 0xFF,
+    0x1F, 0x96, 0xFF, 0x7D, 0x63, 0x39, 0x01, 0xA0, 0x3C, 0x4F, 0x52, 0x0C, 0x87, 0xF0, 0x24, 0xCB,
+    0x7C, 0xEA, 0x6C, 0xEE, 0xDB, 0x15, 0x39, 0xF7, 0xFA, 0xD6, 0x40, 0xAD, 0x3C, 0xB1, 0xA4, 0xB0,
+    0x8B, 0x4D, 0x0A, 0x8D, 0x85, 0xF9, 0xDA, 0x16, 0x8F, 0xB2, 0xD3, 0xAE, 0xA2, 0xA1, 0x21, 0x92,
+    0x94, 0x97, 0xA1, 0xA2, 0x64, 0x10, 0x69, 0x6B, 0x9D, 0x3F, 0x9F, 0x73, 0x7F, 0xA2, 0x33, 0xBB,
+    0x9C, 0x9F, 0xD1, 0xAE, 0xD1, 0xD9, 0x8B, 0x81, 0x0D, 0x63, 0x36, 0xC4, 0x38, 0xE1, 0xCC, 0x86,
+    0x1A, 0x2C, 0x21, 0xC1, 0x04, 0xE6, 0x6B, 0x8C, 0xA5, 0x3A, 0x48, 0xD2, 0x63, 0x5C, 0x2B, 0x22,
+    0x32, 0x28, 0xBF, 0x84, 0x48, 0x9A, 0x42, 0x47, 0x67, 0x2C, 0x15, 0x95, 0xF4, 0x18, 0x57, 0x89,
+    0xC8, 0xD6, 0x3A, 0x5F, 0x59, 0xDB, 0x32, 0x1F, 0xC9, 0x53, 0xA3, 0x30, 0xDB, 0x45, 0xE6, 0x1E,
+    0x31, 0x6C, 0xC2, 0xAD, 0x80, 0xA7, 0xDD, 0xCF, 0xB6, 0x78, 0xB4, 0x72, 0xC6, 0x55, 0xB6, 0x61,
+    0x4A, 0x64, 0xA1, 0xBC, 0xEC, 0x2B, 0x8C, 0x1D, 0x18, 0xB6, 0xD6, 0xAB, 0xD7, 0x9E, 0xB8, 0xFF,
+    0x99, 0xBF, 0x44, 0xE7, 0x91, 0xE9, 0x9F, 0x8E, 0x44, 0x31, 0x28, 0x57, 0xC4, 0x67, 0x51, 0x27,
+    0x28, 0x0D, 0x2F, 0xDC, 0x4A, 0xE4, 0x7C, 0x82, 0x3F, 0x80, 0xF2, 0x8E, 0xA9, 0xB6, 0x32, 0xB6,
+    0xCC, 0xED, 0xFC, 0xC3, 0xC8, 0xFC, 0xF8, 0xCC, 0x9F, 0x5F, 0xB0, 0x98, 0xEC, 0xAA, 0xEC, 0x28,
+    0x5D, 0xF9, 0xFD, 0x35, 0x22, 0xAA, 0x20, 0x13, 0x15, 0x09, 0xE3, 0x8A, 0x7E, 0x02, 0x23, 0x8D,
+    0xF4, 0x68, 0x2F, 0x43, 0x07, 0x1D, 0xF3, 0xEC, 0x50, 0x5E, 0xE7, 0x04, 0x4B, 0x06, 0x63, 0xD1,
+    0xCE, 0xD8, 0x04, 0x89, 0x68, 0x1C, 0x25, 0x25, 0x23, 0x32, 0x14, 0x51, 0x07, 0x16, 0x4C, 0x69,
+    0x6D, 0xCB, 0xD6, 0x20, 0xF2, 0xCA, 0xA9, 0x1C, 0x54, 0xBE, 0xC9, 0x99, 0xC4, 0xCC, 0xAE, 0x21,
+    0x72, 0xF6, 0xB4, 0x1F, 0x24, 0x8A, 0xA4, 0xFC, 0x86, 0x4E, 0x4B, 0x12, 0x45, 0x2F, 0x3D, 0xCA,
+    0x97, 0x60, 0xC2, 0x02, 0x4C, 0xEE, 0xA1, 0x3C, 0xB0, 0x10, 0x6B, 0xD0, 0xAF, 0x45, 0xE8, 0xB4,
+    0x43, 0xF9, 0x06, 0x6E, 0x13, 0x99, 0xF7, 0x5B, 0xF7, 0xD9, 0xCC, 0x07, 0xA7, 0xCF, 0xD6, 0xFB,
+    0xA1, 0xCA, 0xB1, 0xBC, 0x32, 0x18, 0x1A, 0xE3, 0x8C, 0xF4, 0xEA, 0x6E, 0x5F, 0xF4, 0x87, 0x22,
+    0x35, 0x8C, 0xC6, 0xAE, 0x54, 0xFC, 0xDB, 0xEF, 0xAC, 0x52, 0x36, 0xB1, 0x3D, 0xD9, 0x7F, 0x0D,
+    0x6E, 0x23, 0xB2, 0x17, 0xB9, 0xE7, 0x55, 0xD8, 0xDE, 0x68, 0xED, 0x21, 0x98, 0x2A, 0x16, 0xF9,
+    0xC0, 0xB7, 0xAE, 0x93, 0xBD, 0x0C, 0x1D, 0x8D, 0xF6, 0x32, 0x2C, 0xA8, 0xB5, 0xD3, 0x7E, 0x41,
+    0x52, 0x7E, 0x4A, 0x7B, 0xE0, 0xC8, 0x67, 0x97, 0x93, 0x95, 0x2B, 0x0F, 0x5E, 0xEF, 0x27, 0xDB,
+    0x2C, 0xA2, 0xFA, 0xF6, 0xDD, 0xB1, 0xCA, 0xC3, 0x20, 0x3E, 0x0E, 0xF2, 0x07, 0xD6, 0x4C, 0x19,
+    0xF6, 0xAF, 0xBB, 0x55, 0x3A, 0xD9, 0x78, 0x61, 0xCD, 0x6A, 0x2D, 0x5D, 0x77, 0x4E, 0x44, 0x4A,
+    0x5B, 0x24, 0xF6, 0xD1, 0x81, 0x25, 0x32, 0x9C, 0x37, 0x76, 0xAF, 0xFD, 0xD0, 0xB7, 0x9B, 0x9D,
+    0xE7, 0x10, 0x39, 0xE8, 0x3F, 0x4B, 0xE7, 0x58, 0x42, 0x03, 0x53, 0x98, 0xF0, 0xC2, 0x5F, 0x17,
+    0x79, 0xAD, 0xDD, 0x7E, 0xC5, 0xA4, 0xA6, 0xE9, 0x68, 0x16, 0xD4, 0x89, 0x45, 0x22, 0x0E, 0xA2,
+    0x5F, 0x2A, 0x3F, 0x3F, 0xA0, 0x3C, 0x95, 0x73, 0xB1, 0x62, 0xB2, 0x2A, 0x42, 0xB7, 0x2D, 0x62,
+    0x34, 0x5F, 0x78, 0x3D, 0x4D, 0x56, 0xE4, 0x9B, 0x32, 0x60, 0xEC, 0xB9, 0x56, 0xC4, 0x79, 0xB6,
+    0xAB, 0xFE, 0x2C, 0x73, 0xA5, 0x7F, 0x8E, 0x3B, 0x2A, 0x4B, 0xDF, 0xC6, 0x3E, 0x76, 0xE6, 0x57,
+    0x9E, 0xD1, 0xE6, 0x75, 0x0F, 0x7F, 0x9F, 0x16, 0xA0, 0xFF, 0xA9, 0x04, 0x96, 0x3F, 0xEE, 0xC1,
+    0xFC, 0xDA, 0xBF, 0x82, 0x78, 0xFF, 0xA8, 0x87, 0xCB, 0xD5, 0x36, 0x2F, 0x1B, 0x19, 0xE2, 0x5E,
+    0xF6, 0xB5, 0xC9, 0x3A, 0x2A, 0x3B, 0x77, 0x4F, 0xF0, 0x8A, 0x35, 0xF3, 0x95, 0x74, 0xCD, 0x39,
+    0x22, 0xCA, 0x9D, 0x5F, 0xD0, 0xF6, 0xA8, 0x1E, 0xFD, 0x0E, 0x55, 0x2D, 0xD2, 0xFA, 0xC0, 0x6D,
+    0xEA, 0xBF, 0xF2, 0xEA, 0xCD, 0x91, 0x24, 0xBD, 0xA1, 0x13, 0x51, 0xBB, 0x6D, 0x92, 0x0C, 0x86,
+    0xBA, 0xE8, 0xB5, 0x6F, 0xC4, 0x20, 0xC3, 0x4B, 0xAE, 0x31, 0x7F, 0x78, 0x2F, 0x7F, 0x7B, 0x2C,
+    0xFB, 0xE9, 0x09, 0xB4, 0x2D, 0xDC, 0xE7, 0xE8, 0x94, 0x55, 0xDF, 0xEF, 0xA9, 0x4E, 0x83, 0x2D,
+    0x46, 0xF6, 0x56, 0xDE, 0xD8, 0x9A, 0xA8, 0x7C, 0xC9, 0x42, 0xF4, 0xC6, 0x36, 0x44, 0xE9, 0x27,
+    0x2C, 0x65, 0x28, 0x5D, 0x23, 0x17, 0x32, 0x7C, 0xFC, 0xCD, 0x76, 0x9C, 0xDF, 0x5D, 0xCB, 0xD3,
+    0xB8, 0xB7, 0x7A, 0xFD, 0xDE, 0x68, 0xE2, 0xB6, 0xF9, 0x2D, 0xFD, 0xEB, 0xC8, 0xF7, 0xE0, 0x63,
+    0xCB, 0x4B, 0x81, 0xB2, 0x43, 0xFF, 0x89, 0x95, 0x77, 0xE3, 0xC5, 0xD8, 0x5C, 0xEE, 0xF4, 0xB8,
+    0xC3, 0xF1, 0x59, 0xA2, 0xAA, 0x04, 0x39, 0x22, 0xEF, 0x46, 0xD4, 0x95, 0x1E, 0x2D, 0x03, 0x9F,
+    0x96, 0x9E, 0xE7, 0xA5, 0xA7, 0x56, 0x9E, 0xCB, 0xDA, 0x71, 0x68, 0x5E, 0xFE, 0x6C, 0x34, 0x2F,
+    0xB6, 0xC1, 0xA4, 0xD6, 0x9A, 0x33, 0x8A, 0x5C, 0x18, 0x28, 0x5D, 0x9B, 0xC4, 0x31, 0x26, 0x9A,
+    0xC8, 0x2F, 0xF9, 0x3F, 0x70, 0xFC, 0xCB, 0xD5, 0x6F, 0xA2, 0x9E, 0x7F, 0xF1, 0x90, 0x17, 0xF7,
+    0xEE, 0x79, 0xFA, 0x07, 0x06, 0x79, 0x35, 0xD5, 0x3C, 0x67, 0xEE, 0xF6, 0xBB, 0x7D, 0xA3, 0xFE,
+    0x3C, 0xDB, 0x58, 0xFE, 0x57, 0x2A, 0xD8, 0x3F, 0xB1, 0xEE, 0xD5, 0x2B, 0x23, 0x49, 0x79, 0xC3,
+    0x82, 0x68, 0x6C, 0xC9, 0xC3, 0x2F, 0xF6, 0x26, 0x1F, 0x8B, 0x87, 0x5F, 0xF2, 0x13, 0x3A, 0x19,
+    0xB4, 0xAB, 0xF9, 0x87, 0x7F, 0xF6, 0x66, 0x58, 0x70, 0xE7, 0xD4, 0xEE, 0xF5, 0xBE, 0xC8, 0x83,
+    0xF1, 0x5D, 0x45, 0xD3, 0x30, 0xED, 0x68, 0x16, 0x34, 0x89, 0x3A, 0xB1, 0x18, 0x88, 0x4B, 0xD9,
+    0xCF, 0x0F, 0x5C, 0x79, 0xFC, 0xC4, 0x47, 0xDD, 0xAF, 0xDE, 0xCD, 0xEC, 0xA5, 0xA4, 0x97, 0x86,
+    0x2C, 0xA2, 0x09, 0x13, 0x06, 0x19, 0x4A, 0xEA, 0xA2, 0x57, 0xBE, 0x61, 0x71, 0xD5, 0x9B, 0xDF,
+    0xEE, 0xC8, 0x6F, 0x3A, 0xF3, 0x84, 0x3F, 0xE2, 0x8E, 0x8A, 0xC5, 0xBA, 0x1A, 0xD9, 0xDE, 0x5B,
+    0x32, 0x09, 0x0D, 0xAD, 0xAB, 0x69, 0xA9, 0x69, 0xE8, 0xE8, 0x58, 0xB0, 0x20, 0x91, 0x8A, 0x9E,
+    0xA4, 0xBC, 0xC8, 0x2B, 0x8A, 0x0F, 0x07, 0x8A, 0xB0, 0xA9, 0x36, 0xE9, 0x41, 0x39, 0xA8, 0x8E,
+    0xE1, 0x85, 0x6F, 0x6D, 0x9A, 0xC2, 0x58, 0xE4, 0xB0, 0xF8, 0xF9, 0x6D, 0xA4, 0xDF, 0xCC, 0x82,
+    0x09, 0x63, 0x19, 0x78, 0xC5, 0xEF, 0xCD, 0x73, 0x71, 0x3A, 0x5A, 0xC3, 0x56, 0x5F, 0xD9, 0x3B,
+    0x7A, 0x6C, 0x63, 0xF6, 0xDB, 0x4D, 0xF7, 0x30, 0xEA, 0xE5, 0x76, 0xAC, 0xE5, 0xA8, 0x63, 0xC9,
+    0xB1, 0x4C, 0xDA, 0x4D, 0x19, 0x65, 0x28, 0x69, 0x88, 0xDA, 0x95, 0xEC, 0xC9, 0xA0, 0xED, 0xCE,
+    0xC5, 0x28, 0xBD, 0xF9, 0xBD, 0x8E, 0x28, 0xD7, 0x13, 0xF6, 0x9E, 0x3E, 0x59, 0xF6, 0xE9, 0x44,
+    0x66, 0x8A, 0x71, 0x13, 0xB4, 0xDF, 0x41, 0xFA, 0x1A, 0x19, 0x6A, 0x8A, 0xF0, 0xFB, 0x14, 0x7D,
+    0x44, 0xBC, 0x1F, 0x10, 0x3F, 0xF4, 0xF0, 0x00, 0xC4, 0x7F, 0x80, 0x18, 0x4E, 0x86, 0xC4, 0xCD,
+    0x7C, 0xF6, 0xD9, 0x25, 0xB4, 0x3D, 0x4C, 0x9E, 0xF8, 0xA7, 0x46, 0x98, 0x2C, 0x61, 0xEF, 0xDC,
+    0xE6, 0x22, 0x1A, 0x41, 0xF4, 0xB0, 0xB5, 0xB6, 0x22, 0xE7, 0x5E, 0xDF, 0xFB, 0xEE, 0x50, 0x49,
+    0xBF, 0xAC, 0xA5, 0xAF, 0x17, 0xD2, 0xD7, 0x49, 0xB9, 0x3A, 0x69, 0xDB, 0x25, 0x6D, 0x17, 0x0B,
+    0x23, 0xE2, 0xAB, 0x46, 0xFB, 0xEA, 0xC3, 0xCC, 0x85, 0x7C, 0x1F, 0xB6, 0x81, 0x9D, 0xCD, 0x07,
+    0x8D, 0xAF, 0x1F, 0xC2, 0xEA, 0x29, 0x3B, 0x62, 0xC1, 0xA8, 0x47, 0x39, 0x32, 0x35, 0x2F, 0x53,
+    0xEE, 0x80, 0x59, 0x80, 0x8E, 0x9B, 0x0E, 0xA3, 0x7B, 0xD8, 0x8E, 0xB0, 0x97, 0xB8, 0x18, 0x97,
+    0xB4, 0xBE, 0x8D, 0xAD, 0x6D, 0xDD, 0xFF, 0xAE, 0xF6, 0xFE, 0xB8, 0x31, 0x7F, 0xB4, 0xA9, 0xBD,
+    0x5F, 0xF6, 0x50, 0x6F, 0x22, 0xAD, 0xC1, 0x58, 0xC4, 0xCD, 0xEB, 0x4E, 0xB7, 0xBD, 0xF2, 0x8B,
+    0xA2, 0xDF, 0x21, 0x19, 0x6A, 0xE9, 0x5B, 0x8E, 0x57, 0xAE, 0x7C, 0x1C, 0x20, 0x42, 0x7D, 0x91,
+    0xB2, 0x46, 0x8F, 0x88, 0x71, 0x63, 0x4C, 0x73, 0xB8, 0xF2, 0x15, 0x49, 0xFA, 0xA9, 0x88, 0xCA,
+    0xD7, 0x45, 0xAF, 0x5D, 0x5D, 0x04, 0xC3, 0x9E, 0xF4, 0x25, 0x49, 0xF9, 0x89, 0x88, 0xC6, 0x35,
+    0x32, 0x96, 0xAE, 0xD6, 0xFD, 0x4B, 0x2F, 0xD7, 0x3B, 0xF1, 0xC1, 0x57, 0xDA, 0x87, 0xF9, 0xBD,
+    0xA1, 0xF2, 0x6B, 0xD5, 0xF3, 0x7F, 0x42, 0xF9, 0xD5, 0x7A, 0x27, 0x3E, 0xF8, 0xDD, 0xF6, 0x61,
+    0x7E, 0x6F, 0xAC, 0xFC, 0x5A, 0xFD, 0x15, 0x27, 0xDF, 0x84, 0x36, 0x3F, 0x97, 0xD9, 0xCC, 0xDA,
+    0x08, 0x07, 0x14, 0x79, 0x75, 0x25, 0xE7, 0xD0, 0x2B, 0x57, 0x6B, 0x7B, 0x5E, 0x5B, 0x54, 0x76,
+    0xF2, 0x83, 0x51, 0x04, 0x43, 0x92, 0xA1, 0x26, 0x1A, 0xBB, 0x10, 0x0F, 0x97, 0x27, 0x9A, 0xB3,
+    0xD5, 0x23, 0x6F, 0xAC, 0x61, 0xAF, 0x08, 0x68, 0x57, 0x43, 0x92, 0x1E, 0xC3, 0x7C, 0x2D, 0xA2,
+    0xFE, 0x60, 0x98, 0x10, 0xF5, 0xBB, 0xC1, 0xD0, 0xD5, 0x44, 0x7D, 0xE3, 0xAE, 0x21, 0x76, 0xFD,
+    0xD1, 0x6D, 0x3D, 0xCA, 0x6C, 0x37, 0x95, 0xBC, 0x15, 0xC8, 0x6E, 0x73, 0x17, 0x53, 0x8E, 0x2A,
+    0xBB, 0xF5, 0xF5, 0x1B, 0xBE, 0x2C, 0xA9, 0xF7, 0xC4, 0x47, 0xD1, 0x5C, 0xFD, 0xB7, 0x41, 0x9D,
+    0xD2, 0xBC, 0x58, 0x33, 0xCF, 0xD2, 0x4F, 0x9F, 0x61, 0x89, 0x88, 0xE7, 0xBF, 0xEC, 0xDB, 0xCC,
+    0xB5, 0x05, 0xF2, 0x7B, 0x94, 0x3B, 0xA4, 0x3B, 0x4F, 0x75, 0x16, 0x2E, 0x8C, 0x54, 0xFD, 0xCA,
+    0x57, 0xD9, 0x75, 0x3A, 0x74, 0xFA, 0xB5, 0x28, 0x43, 0x9A, 0x32, 0x35, 0x5F, 0xF0, 0xF2, 0xBB,
+    0x79, 0xA4, 0x29, 0xBF, 0xE6, 0xE4, 0x3B, 0x61, 0x60, 0xD1, 0x68, 0x67, 0xA4, 0x5F, 0xCA, 0xD0,
+    0xC9, 0x47, 0x83, 0x7E, 0xAA, 0xFA, 0xB3, 0x2F, 0xD6, 0x23, 0x0B, 0xE5, 0x0C, 0x87, 0x44, 0x83,
+    0xB1, 0x91, 0x55, 0x46, 0x3C, 0xEE, 0xA9, 0x1B, 0xF4, 0x8D, 0xBB, 0x3F, 0x1B, 0xEB, 0x1F, 0x1E,
+    0xAB, 0xB1, 0xB5, 0x1B, 0x35, 0xBE, 0xF6, 0x73, 0x45, 0xBA, 0x5D, 0xC4, 0x25, 0xF6, 0xE2, 0xA9,
+    0xD8, 0xF8, 0xE2, 0x41, 0xD4, 0x9F, 0x8F, 0xDB, 0x22, 0xD6, 0x32, 0xEC, 0x55, 0xF6, 0x1F, 0x47,
+    0xF2, 0x4D, 0x12, 0x24, 0xEC, 0xA8, 0xFC, 0x3C, 0xDB, 0x4D, 0x02, 0xFF, 0x1B, 0xB5, 0x9C, 0x51,
+    0x8C, 0x24, 0xC7, 0x79, 0xDF, 0x7F, 0xD5, 0xC5, 0xDD, 0xA2, 0xAE, 0xCD, 0xAB, 0x0D, 0xA0, 0xB3,
+    0x25, 0xDD, 0x71, 0x5B, 0x0F, 0x0A, 0x40, 0x10, 0xB7, 0xD3, 0x7A, 0x60, 0x80, 0x33, 0xD2, 0x3D,
+    0x53, 0xE2, 0xC1, 0x11, 0x12, 0x21, 0xD6, 0x19, 0xB9, 0x91, 0x80, 0x28, 0xB1, 0x94, 0xC0, 0x40,
+    0x2C, 0x29, 0xF1, 0xF1, 0xE1, 0x60, 0xAC, 0xE1, 0xB9, 0x9D, 0x22, 0xE9, 0x80, 0x0F, 0x44, 0xAC,
+    0x05, 0x2C, 0xE7, 0xCD, 0x16, 0x01, 0xEB, 0x81, 0x3A, 0x1A, 0xB9, 0x4D, 0xBC, 0x0F, 0x23, 0x79,
+    0xEE, 0xA6, 0x8E, 0x87, 0x40, 0x0F, 0x04, 0xCC, 0xA2, 0x04, 0xDB, 0x0F, 0x82, 0xC1, 0xA6, 0x75,
+    0x94, 0x0C, 0x5E, 0x64, 0x16, 0xC5, 0xA6, 0xD9, 0x77, 0xEC, 0x9D, 0xCA, 0x43, 0xCF, 0xCC, 0x2E,
+    0x29, 0xDA, 0x12, 0x29, 0x72, 0x80, 0x05, 0x38, 0x3D, 0x73, 0x53, 0x5F, 0x57, 0x7D, 0xF5, 0xD5,
+    0xFF, 0xFB, 0xFF, 0xFF, 0x4D, 0x60, 0x44, 0x4B, 0x0D, 0xC0, 0x43, 0xEC, 0x51, 0x51, 0x09, 0x9F,
+    0x78, 0xE9, 0xA4, 0x53, 0x4E, 0x5B, 0x6D, 0x32, 0xFA, 0xDC, 0x07, 0x00, 0x15, 0xC2, 0x93, 0x38,
+    0xA4, 0x43, 0x7A, 0xC6, 0x07, 0x32, 0xCE, 0xF5, 0xE3, 0x77, 0xF7, 0x8E, 0x53, 0xDC, 0xC3, 0xE4,
+    0x14, 0xF5, 0x29, 0xEA, 0xFB, 0xA8, 0xCF, 0x30, 0x7D, 0xE0, 0xEE, 0x9D, 0xBD, 0x49, 0x1E, 0xAB,
+    0x74, 0x6E, 0xF0, 0x08, 0x47, 0xE2, 0x90, 0x16, 0x69, 0x49, 0x00, 0x30, 0xA0, 0xA2, 0x41, 0xDD,
+    0x0A, 0x48, 0x37, 0x42, 0x7A, 0x8D, 0x08, 0x02, 0x26, 0x40, 0x09, 0x64, 0x18, 0x62, 0x0C, 0xFC,
+    0xD2, 0x6B, 0xE7, 0xA0, 0x06, 0x46, 0x40, 0x0F, 0xD0, 0x06, 0x3E, 0xE9, 0x84, 0x19, 0xC4, 0x18,
+    0xF4, 0x5F, 0xC5, 0x46, 0x98, 0x2E, 0x32, 0xD6, 0xE1, 0xB4, 0x7A, 0xFC, 0x60, 0x5F, 0xCC, 0x67,
+    0x8E, 0x90, 0xDA, 0xC4, 0x2B, 0x2B, 0x9D, 0x32, 0xD2, 0x69, 0xA4, 0xEB, 0x91, 0xBE, 0x36, 0xA7,
+    0x9C, 0xFD, 0xD0, 0x3E, 0x74, 0x57, 0x62, 0x17, 0xFF, 0x84, 0x3C, 0xCA, 0xF8, 0xED, 0x39, 0x63,
+    0xDB, 0x47, 0x9B, 0xD4, 0xA5, 0x56, 0x04, 0xE5, 0xE8, 0x4B, 0x87, 0xBA, 0xE1, 0x19, 0xFC, 0x43,
+    0x34, 0xEB, 0xB3, 0x3B, 0x16, 0x19, 0x60, 0x16, 0x1B, 0x3E, 0x32, 0x7F, 0x12, 0x32, 0x20, 0xB5,
+    0x20, 0x2B, 0x58, 0x9F, 0x1B, 0xD2, 0x58, 0x75, 0x53, 0xA3, 0xCC, 0x16, 0x41, 0xBA, 0xE3, 0x5C,
+    0x4C, 0xDC, 0xB1, 0xE5, 0x08, 0x4F, 0x48, 0xB7, 0xC9, 0xC5, 0xC4, 0x69, 0x0A, 0x51, 0xA5, 0x5D,
+    0xAC, 0x79, 0x10, 0x77, 0x5A, 0xE5, 0x0A, 0x6D, 0xCF, 0xF4, 0x1C, 0x67, 0x02, 0x67, 0x46, 0x9C,
+    0xD1, 0xA6, 0x90, 0x3E, 0x33, 0x41, 0xF9, 0x6D, 0xD1, 0x9C, 0xA1, 0x3C, 0x83, 0x3E, 0xB3, 0x21,
+    0xEB, 0x3D, 0x19, 0x1A, 0xE5, 0xAE, 0x5D, 0x31, 0x79, 0x03, 0x70, 0x77, 0xA2, 0x1F, 0xFD, 0xE1,
+    0x73, 0xB5, 0xD9, 0x40, 0x7C, 0x03, 0x98, 0x45, 0x4F, 0x66, 0x92, 0x8A, 0x80, 0xA8, 0x34, 0x5F,
+    0x12, 0xFE, 0xA2, 0x9E, 0x27, 0x37, 0x5C, 0x38, 0xA3, 0x7E, 0x55, 0x99, 0x73, 0xC7, 0x1F, 0x38,
+    0x0D, 0x67, 0xFC, 0x1E, 0xBC, 0xFA, 0xA0, 0x43, 0xFE, 0xBE, 0xB2, 0x1C, 0x3F, 0xAD, 0xFF, 0xD0,
+    0x5E, 0xBC, 0xA8, 0xE7, 0xD2, 0x05, 0x61, 0xB6, 0x08, 0x24, 0x15, 0xB7, 0xB9, 0x04, 0xE3, 0x68,
+    0x61, 0xED, 0x1C, 0xF0, 0x9F, 0xCC, 0xB8, 0xD6, 0x3A, 0x71, 0xA1, 0xB8, 0x47, 0x3E, 0xE2, 0xB6,
+    0x47, 0x8F, 0x1E, 0xB4, 0xBD, 0xE3, 0xC0, 0xFD, 0x4F, 0xE9, 0x58, 0x9D, 0x18, 0x0E, 0x63, 0x7C,
+    0x65, 0xF8, 0x59, 0x87, 0x86, 0x02, 0x02, 0x30, 0x3C, 0x1F, 0x0F, 0x2E, 0x3F, 0xC9, 0x1A, 0xA4,
+    0xD1, 0x2A, 0x9B, 0xF1, 0xDC, 0xB9, 0x33, 0xF7, 0xED, 0xF8, 0x1B, 0x67, 0x7F, 0xFF, 0xF8, 0xC7,
+    0x7F, 0xD9, 0xFF, 0x89, 0x6C, 0xD2, 0x8F, 0xFF, 0xB2, 0xFF, 0x93, 0x47, 0x9F, 0xF9, 0xB7, 0xA7,
+    0xCE, 0xFF, 0xA2, 0xDB, 0xE3, 0x62, 0xF2, 0xE2, 0x55, 0xC4, 0x37, 0xB8, 0xFF, 0xB2, 0x8E, 0x1E,
+    0x38, 0x97, 0xC4, 0xB3, 0x2F, 0xBE, 0x52, 0x6D, 0x5E, 0x94, 0x7F, 0x2C, 0xBE, 0xEF, 0xC3, 0xB8,
+    0x16, 0xBB, 0xF0, 0x31, 0x08, 0xC8, 0x6E, 0x14, 0x11, 0xE3, 0x8F, 0x9F, 0x7A, 0xC9, 0x2E, 0x07,
+    0x94, 0x0E, 0x00, 0x11, 0xE3, 0x0F, 0x63, 0x74, 0x7C, 0x98, 0xEC, 0x40, 0x7E, 0x27, 0x3C, 0xA4,
+    0x49, 0x3C, 0x23, 0x32, 0x52, 0x2B, 0x3D, 0x35, 0x83, 0xF8, 0xF4, 0xE5, 0xAF, 0xF3, 0x1B, 0x22,
+    0xBA, 0x2A, 0x6C, 0x9C, 0x66, 0x93, 0x6B, 0x8C, 0x1D, 0x13, 0x7A, 0x64, 0xEB, 0xB3, 0x07, 0xE7,
+    0x40, 0xA1, 0x9F, 0x0E, 0xA3, 0xD5, 0x52, 0x6D, 0xB3, 0x47, 0x2D, 0x02, 0x21, 0xA9, 0x08, 0xD2,
+    0x8B, 0x20, 0x5D, 0x52, 0x49, 0x27, 0xBD, 0x72, 0xD2, 0xA5, 0x56, 0x3A, 0x6D, 0x94, 0xCB, 0x8D,
+    0xAA, 0x7E, 0xF7, 0xBF, 0xA7, 0xF1, 0xFB, 0x07, 0x7A, 0xF6, 0x48, 0x7D, 0x1C, 0xD8, 0x5C, 0x24,
+    0xE6, 0xD6, 0x22, 0x73, 0xCF, 0x2C, 0x7F, 0x8F, 0xB5, 0xF3, 0xA8, 0x38, 0x27, 0xBF, 0x73, 0x93,
+    0xD9, 0x6B, 0x4E, 0xC4, 0x1F, 0x3B, 0x19, 0x5F, 0xB5, 0xDD, 0xDF, 0xF7, 0x8D, 0x8C, 0x7F, 0x8D,
+    0x8C, 0xCF, 0x20, 0xE2, 0x5F, 0xC0, 0x97, 0xFF, 0x02, 0xE4, 0xFF, 0x00, 0xF9, 0x1F, 0x40, 0x9D,
+    0x86, 0xF4, 0x0C, 0x1C, 0x7F, 0x00, 0xEE, 0xD9, 0x83, 0x2D, 0xCF, 0x17, 0x66, 0x86, 0x99, 0x87,
+    0x0F, 0x03, 0x1F, 0xBA, 0xDA, 0xEE, 0x1F, 0xFB, 0x44, 0x2B, 0xDD, 0x7E, 0x5F, 0xC0, 0x47, 0xF3,
+    0xEB, 0x33, 0xB6, 0x45, 0x95, 0x9A, 0x82, 0xA0, 0xEC, 0xD6, 0xFA, 0xFC, 0xFE, 0x27, 0xF9, 0x30,
+    0x79, 0xAD, 0x1E, 0x75, 0xA1, 0xD8, 0x94, 0x4F, 0xFB, 0xED, 0x7B, 0x35, 0x6F, 0x78, 0x75, 0x13,
+    0xB8, 0xFF, 0xA9, 0x4F, 0x2E, 0x92, 0x15, 0x36, 0xE0, 0x1E, 0xD6, 0x03, 0x94, 0x64, 0x01, 0xB6,
+    0x21, 0x40, 0x40, 0x54, 0x48, 0x47, 0xE2, 0x49, 0x0D, 0xD2, 0xB1, 0x09, 0xD2, 0x51, 0x50, 0x2A,
+    0xCB, 0x1E, 0xAD, 0x32, 0xC2, 0xCB, 0x36, 0xDB, 0x95, 0x56, 0x9F, 0x99, 0x05, 0x4D, 0x71, 0x11,
+    0xB6, 0x08, 0xFB, 0xB0, 0x2D, 0x5D, 0x80, 0x90, 0xC6, 0x39, 0xD2, 0x89, 0xCF, 0xDC, 0x24, 0x35,
+    0x08, 0x4F, 0x06, 0x89, 0xE3, 0x14, 0x6F, 0x7D, 0x6D, 0xC0, 0x03, 0xAC, 0x07, 0xD8, 0x27, 0x0B,
+    0x88, 0x6A, 0xB1, 0xAC, 0xA2, 0x42, 0x43, 0xE2, 0xD9, 0x02, 0xE9, 0xD8, 0x06, 0xE9, 0x08, 0xBA,
+    0x51, 0x36, 0x71, 0x3B, 0x57, 0x95, 0x51, 0x66, 0x6F, 0x33, 0xDB, 0x3D, 0xCE, 0xC6, 0xD6, 0x2C,
+    0x14, 0x30, 0x82, 0x7D, 0x44, 0x40, 0x54, 0xA4, 0x0E, 0xE9, 0xE8, 0x81, 0x86, 0x1A, 0x7A, 0xC8,
+    0x3B, 0x4F, 0x32, 0x42, 0xC6, 0x9A, 0x87, 0x7E, 0x62, 0xF4, 0xBB, 0x40, 0x38, 0x06, 0x15, 0x04,
+    0xCA, 0x11, 0xD4, 0xDC, 0x9D, 0xC2, 0x04, 0xA4, 0x63, 0x04, 0x27, 0x1D, 0x05, 0x64, 0x81, 0x2D,
+    0xA0, 0xC7, 0x26, 0xDA, 0x28, 0xAB, 0xD1, 0x4E, 0x7A, 0x8D, 0x7E, 0xE5, 0x73, 0x55, 0x6A, 0xF4,
+    0x99, 0xE8, 0x95, 0xD5, 0xF7, 0x82, 0x74, 0x3A, 0x35, 0x48, 0xA7, 0xA5, 0x23, 0xA9, 0xD2, 0x38,
+    0x47, 0x04, 0x86, 0xDF, 0x84, 0x00, 0xF7, 0x42, 0x0D, 0x29, 0xCB, 0xEA, 0xB9, 0x7C, 0x29, 0x27,
+    0x03, 0xFB, 0x00, 0x68, 0xBF, 0xDE, 0xB0, 0x49, 0x46, 0x46, 0x4E, 0x86, 0x46, 0x59, 0x51, 0xB1,
+    0xF3, 0xDF, 0xD2, 0x68, 0x66, 0x06, 0x40, 0x18, 0x60, 0xF0, 0x38, 0x24, 0x2F, 0xB7, 0x70, 0x4C,
+    0xBB, 0xA3, 0x3F, 0xB4, 0x0E, 0x30, 0x05, 0x64, 0x0D, 0x0C, 0x2A, 0x10, 0xDF, 0xB3, 0xA0, 0x33,
+    0xE0, 0x62, 0x01, 0xD2, 0xD5, 0xB0, 0x25, 0x3D, 0x84, 0xD4, 0xA2, 0xFF, 0xF0, 0x02, 0x8C, 0x63,
+    0x8B, 0xFC, 0xCB, 0xCF, 0xD4, 0xF4, 0x90, 0x9E, 0x80, 0xB6, 0xA9, 0x65, 0xC0, 0x35, 0x23, 0xE6,
+    0x9F, 0x8E, 0x0C, 0x22, 0xF0, 0x1B, 0x80, 0x6E, 0x80, 0xBD, 0x3D, 0x90, 0xD7, 0x1D, 0xA4, 0x1A,
+    0xD0, 0x01, 0x58, 0x03, 0xF8, 0x10, 0x90, 0x04, 0x40, 0x7B, 0x20, 0x5A, 0x50, 0xBF, 0x05, 0x14,
+    0x23, 0x10, 0x3E, 0x80, 0x96, 0x1E, 0xF6, 0xB5, 0x41, 0xBA, 0x1E, 0xF4, 0x87, 0x53, 0x44, 0x8C,
+    0x01, 0x3D, 0xFC, 0x9C, 0x67, 0x82, 0x36, 0xD2, 0xD1, 0xA7, 0x07, 0x6D, 0x72, 0x1B, 0x75, 0x7B,
+    0xD0, 0x12, 0x5B, 0x60, 0x38, 0x1C, 0x02, 0xB3, 0x18, 0x1D, 0xC8, 0xF9, 0xE5, 0x00, 0x72, 0xCE,
+    0x19, 0x48, 0x9E, 0x37, 0xF7, 0x80, 0xF8, 0xBE, 0x03, 0x78, 0x25, 0x00, 0x84, 0x29, 0xC0, 0xFE,
+    0xE0, 0x29, 0x07, 0xDB, 0x3A, 0x56, 0x50, 0x7E, 0xD6, 0x01, 0x83, 0x18, 0x80, 0x72, 0xD8, 0x00,
+    0x3D, 0xFA, 0xFC, 0x02, 0x9B, 0x68, 0xA3, 0xD1, 0x28, 0xA7, 0x6C, 0x56, 0xA9, 0x18, 0x7D, 0xDE,
+    0xEA, 0x18, 0x03, 0xAC, 0x7D, 0xC3, 0x20, 0x63, 0xAC, 0xF8, 0x70, 0xFD, 0xF9, 0x1A, 0xE5, 0x54,
+    0x20, 0x47, 0x55, 0x4C, 0xD0, 0x4E, 0x7A, 0x72, 0x34, 0x8C, 0xD6, 0xAE, 0x9E, 0x4F, 0xC2, 0x20,
+    0x86, 0xD4, 0x69, 0x4B, 0x9F, 0x12, 0x6A, 0x02, 0xA9, 0x53, 0x8E, 0x4B, 0xE4, 0xC8, 0x8A, 0x86,
+    0x6B, 0x9C, 0xBC, 0x33, 0xF3, 0x22, 0xC6, 0x9B, 0xAB, 0x75, 0x39, 0xB7, 0x01, 0xF3, 0x53, 0x30,
+    0x8E, 0x70, 0x7A, 0x60, 0x40, 0x2C, 0x17, 0x6C, 0xB7, 0x2B, 0xB4, 0xF3, 0xCF, 0xB4, 0xB4, 0x64,
+    0xB6, 0x45, 0x86, 0x11, 0x5C, 0xEA, 0x83, 0xFE, 0x3C, 0xC8, 0xEF, 0x39, 0x78, 0xBD, 0x82, 0x51,
+    0x03, 0x79, 0x1F, 0xF4, 0x57, 0x2C, 0xEA, 0x46, 0x40, 0x56, 0x97, 0x48, 0x82, 0xF6, 0x2A, 0x10,
+    0xAF, 0x04, 0xD2, 0xB8, 0xBB, 0x1C, 0x2A, 0xE5, 0xD4, 0x48, 0x5D, 0x7F, 0x25, 0xA8, 0x96, 0x1C,
+    0xD5, 0x8A, 0x57, 0xC2, 0x48, 0x3D, 0xC3, 0xD6, 0x62, 0xB4, 0xBB, 0x10, 0x71, 0xBE, 0x85, 0x7E,
+    0xF1, 0x42, 0xCD, 0x00, 0x55, 0xD1, 0xA2, 0x83, 0x08, 0xF4, 0x6B, 0x59, 0x51, 0xD7, 0xCA, 0x49,
+    0x57, 0xA7, 0x4E, 0x53, 0x6B, 0x5B, 0x88, 0xA0, 0x6D, 0x48, 0x82, 0x7E, 0xD4, 0xC9, 0x4A, 0x7F,
+    0x0D, 0xE5, 0x74, 0x8B, 0xB6, 0x2A, 0x30, 0x40, 0xD5, 0xA2, 0x65, 0x33, 0x5E, 0xA9, 0x38, 0x93,
+    0xCF, 0xCD, 0xEA, 0x36, 0x2D, 0x88, 0x1A, 0x64, 0x0B, 0xAA, 0x01, 0xD1, 0x05, 0x25, 0x86, 0xE6,
+    0xC4, 0xAF, 0xC5, 0x3A, 0x3F, 0xC8, 0xBC, 0x68, 0x92, 0xC0, 0x84, 0x92, 0x11, 0xA9, 0x2B, 0x10,
+    0xA1, 0x84, 0x7E, 0x0F, 0xD2, 0x67, 0x81, 0x08, 0xE4, 0x06, 0x52, 0xD7, 0x1D, 0xA6, 0xD4, 0x40,
+    0x41, 0x77, 0xC2, 0xE6, 0x7F, 0x47, 0x97, 0x8C, 0xC3, 0x73, 0xC8, 0xE8, 0x11, 0x35, 0x28, 0x07,
+    0x79, 0x34, 0x5C, 0x9B, 0x39, 0xE9, 0x33, 0xAB, 0xC9, 0x19, 0x31, 0x4D, 0xAA, 0xA4, 0xD2, 0x56,
+    0x9B, 0x92, 0x96, 0x90, 0x3B, 0x15, 0x6B, 0xF2, 0xAF, 0x42, 0x0D, 0x27, 0x6F, 0x22, 0x62, 0xE8,
+    0x66, 0xC2, 0x00, 0x31, 0x80, 0x7C, 0xB1, 0x05, 0x6D, 0x46, 0x90, 0x51, 0x40, 0xC9, 0x45, 0x28,
+    0x08, 0x30, 0x4A, 0x1C, 0x4C, 0x94, 0x81, 0xFD, 0xE3, 0x40, 0xBD, 0x09, 0x84, 0xCC, 0x20, 0x42,
+    0xEA, 0x49, 0x2A, 0x19, 0x90, 0x9E, 0xA6, 0xAB, 0x10, 0xCA, 0x31, 0x42, 0x3D, 0xC3, 0x3E, 0xE9,
+    0x57, 0x5E, 0xAA, 0xD0, 0x67, 0xA3, 0x41, 0xB3, 0x88, 0x9C, 0x12, 0xB8, 0x38, 0x02, 0x66, 0x01,
+    0xC8, 0x97, 0x60, 0x23, 0x7D, 0xCE, 0xA9, 0x79, 0x48, 0x6E, 0xD4, 0x6C, 0x6C, 0x2C, 0x2E, 0x89,
+    0x6B, 0xF7, 0x26, 0x31, 0x8A, 0x3A, 0xB7, 0x41, 0xFA, 0x86, 0x50, 0x30, 0xDA, 0xA4, 0x97, 0x9A,
+    0xEC, 0xAC, 0xD7, 0xAE, 0x4E, 0xC3, 0x38, 0x2D, 0xDE, 0x88, 0x9F, 0x0E, 0x51, 0x76, 0x37, 0x21,
+    0x76, 0x49, 0xE6, 0x88, 0xEF, 0x38, 0xF6, 0x1E, 0xE2, 0xF4, 0x69, 0xD4, 0x01, 0xFC, 0x26, 0x00,
+    0x17, 0x1E, 0x33, 0xB3, 0xE8, 0x2E, 0xA5, 0x55, 0x41, 0xDD, 0xA7, 0xD0, 0x64, 0xCA, 0xA6, 0x8F,
+    0x78, 0xE5, 0x6B, 0x19, 0xCA, 0xA4, 0xCD, 0x9E, 0x7E, 0xB6, 0x1F, 0xBF, 0xDB, 0x0E, 0x5C, 0xBB,
+    0x5A, 0xBA, 0xE4, 0x20, 0x6D, 0x44, 0x8C, 0xB7, 0xFC, 0xA5, 0x24, 0xF4, 0xB4, 0x29, 0xE4, 0x77,
+    0x2A, 0x65, 0xA7, 0x05, 0xF5, 0x40, 0xD9, 0x6C, 0x6C, 0xF7, 0x65, 0x34, 0xDA, 0xCC, 0xA0, 0xD6,
+    0x81, 0x4F, 0x3F, 0xFA, 0xAC, 0x99, 0xCC, 0x42, 0x9C, 0xCB, 0x46, 0xC6, 0xC5, 0xEA, 0xAF, 0x0B,
+    0xE4, 0x8F, 0x3D, 0x03, 0x47, 0xEA, 0xD1, 0x23, 0x92, 0xD4, 0x42, 0x60, 0xF6, 0xA7, 0x62, 0x1E,
+    0x4D, 0x9D, 0x56, 0x0D, 0xCD, 0x88, 0x7E, 0x0F, 0xFD, 0x69, 0x23, 0x6F, 0x78, 0x42, 0xCD, 0xA4,
+    0xA4, 0xD0, 0xAE, 0x14, 0xF3, 0x6B, 0x64, 0x07, 0xAB, 0x38, 0xD2, 0x17, 0x7E, 0x72, 0x56, 0x66,
+    0x36, 0x89, 0x8D, 0x0C, 0x59, 0x12, 0xA4, 0xAF, 0x69, 0x46, 0x94, 0xCB, 0xDF, 0x49, 0xAA, 0x86,
+    0x90, 0xD3, 0xA8, 0x3B, 0x0D, 0xE3, 0x7A, 0xF9, 0x1B, 0x22, 0x90, 0x7A, 0x36, 0x01, 0x86, 0xC3,
+    0xCF, 0xC6, 0xF8, 0x7F, 0x87, 0xC3, 0x0E, 0xAB, 0xA6, 0x9E, 0xFC, 0xB0, 0x56, 0xCE, 0x4F, 0x91,
+    0xC7, 0x86, 0x56, 0x55, 0x49, 0x48, 0xBD, 0xF4, 0x83, 0x4A, 0xB9, 0x57, 0xAB, 0xF4, 0xB1, 0x1B,
+    0x5E, 0xFF, 0xBA, 0x74, 0xBA, 0x49, 0xAD, 0xF6, 0x1A, 0xED, 0xFA, 0x0C, 0xEE, 0x34, 0xFC, 0xEF,
+    0xE8, 0x8F, 0x56, 0xDA, 0xD0, 0xE5, 0x68, 0xEA, 0xBA, 0x45, 0x3E, 0x52, 0xD0, 0x77, 0x18, 0x89,
+    0x48, 0x1F, 0x6D, 0x7B, 0xA4, 0x6E, 0x0B, 0xE9, 0x0A, 0xA4, 0x2F, 0x48, 0xFC, 0x45, 0x92, 0x2A,
+    0x20, 0x5E, 0xF0, 0x5D, 0xF1, 0xBA, 0x05, 0xE2, 0x47, 0x20, 0x9A, 0xAE, 0x78, 0xCA, 0xEE, 0xA7,
+    0xFE, 0xF9, 0xB4, 0x2B, 0xDC, 0x3D, 0x03, 0x08, 0x48, 0x22, 0xAC, 0x4F, 0x41, 0x84, 0x0E, 0x66,
+    0x96, 0xDD, 0xE0, 0xEA, 0x91, 0x86, 0xAD, 0x41, 0xCD, 0xEB, 0x37, 0x2A, 0xF9, 0xFF, 0x52, 0xA7,
+    0x5D, 0x8F, 0x4B, 0x4C, 0x92, 0x20, 0xBD, 0x36, 0x9A, 0x82, 0x89, 0x08, 0xD2, 0xA5, 0xB6, 0xCF,
+    0xE0, 0x56, 0xC5, 0x1B, 0x07, 0x28, 0xD7, 0x21, 0x93, 0xFD, 0x6E, 0xA0, 0x71, 0x43, 0x72, 0xF9,
+    0x09, 0x00, 0xFB, 0x51, 0x64, 0xD5, 0xA0, 0x9E, 0xAB, 0x11, 0x98, 0xF7, 0xE5, 0x2E, 0xBA, 0xD7,
+    0x38, 0x82, 0x88, 0xCD, 0xD1, 0x49, 0x14, 0x16, 0xBA, 0x15, 0x39, 0x58, 0x1E, 0x31, 0xBF, 0x5D,
+    0x81, 0xFC, 0xB6, 0x83, 0x7B, 0x35, 0x10, 0x4A, 0x48, 0x4D, 0x0D, 0x45, 0x52, 0x21, 0x5F, 0xFC,
+    0x9C, 0x23, 0x8B, 0x11, 0x5E, 0x1B, 0x5E, 0x25, 0xB5, 0xD4, 0x14, 0xC8, 0x2A, 0xA9, 0xD0, 0x2E,
+    0xDF, 0x65, 0xFC, 0x07, 0xD1, 0xE9, 0xE8, 0xB8, 0xFF, 0x32, 0x59, 0x3C, 0x72, 0x2A, 0x9E, 0x7C,
+    0xC1, 0xE7, 0x31, 0x64, 0x0F, 0x36, 0x9A, 0x52, 0x5B, 0x2D, 0x9D, 0xBA, 0x5E, 0x25, 0xD5, 0xBE,
+    0xA8, 0x4B, 0x5A, 0x6D, 0x66, 0x2A, 0xFC, 0xD9, 0xB3, 0xB3, 0x3A, 0xEA, 0x30, 0x58, 0x61, 0x01,
+    0xD8, 0x56, 0x20, 0x6E, 0x4F, 0x20, 0x89, 0x16, 0xC4, 0xB9, 0xF7, 0xF7, 0x7C, 0xE5, 0x1E, 0xAC,
+    0x7A, 0x2E, 0x10, 0x03, 0x69, 0xF5, 0xEE, 0x4A, 0x01, 0x7C, 0x81, 0x2E, 0x1B, 0x19, 0x18, 0x90,
+    0x73, 0xE0, 0xDE, 0xC9, 0xE2, 0x7C, 0x54, 0x67, 0x1D, 0x14, 0xDA, 0x90, 0xF8, 0x12, 0x34, 0x13,
+    0xB8, 0xFD, 0x99, 0x80, 0x8A, 0xD1, 0x51, 0x0E, 0x2F, 0x98, 0xA4, 0xA2, 0x44, 0x43, 0xC3, 0x04,
+    0x19, 0xD2, 0x9B, 0x64, 0x37, 0x63, 0x90, 0x31, 0x00, 0xDB, 0x80, 0xB2, 0x0B, 0x34, 0xCB, 0x35,
+    0x03, 0x62, 0xFE, 0x6E, 0x66, 0x56, 0x81, 0x34, 0x24, 0x0E, 0xBE, 0x69, 0xC8, 0x16, 0x37, 0xF9,
+    0x51, 0x48, 0x1D, 0x22, 0x42, 0xEE, 0x61, 0x71, 0x82, 0xFD, 0xE2, 0x57, 0x49, 0xE3, 0x01, 0xF3,
+    0xCF, 0x35, 0xDA, 0x25, 0xBE, 0x25, 0x55, 0x8E, 0xFB, 0xFA, 0x8B, 0xFC, 0x77, 0xD0, 0x07, 0x9A,
+    0x6E, 0xF3, 0x69, 0xD7, 0x65, 0xCF, 0x0E, 0xB8, 0x68, 0x2E, 0x10, 0x63, 0x60, 0x76, 0x58, 0x4A,
+    0x12, 0x4F, 0x66, 0xA8, 0xD1, 0x86, 0x07, 0x96, 0x39, 0xE8, 0xD2, 0x68, 0x26, 0x1F, 0x52, 0x96,
+    0x02, 0x11, 0x48, 0x6D, 0x77, 0x82, 0xCB, 0x4A, 0xA4, 0x6E, 0x3B, 0x8B, 0x2E, 0x5F, 0xD4, 0x90,
+    0x63, 0xC0, 0x1C, 0xF4, 0x35, 0x68, 0x0A, 0x52, 0xF3, 0xF1, 0xF7, 0x38, 0xB4, 0x0C, 0x31, 0x47,
+    0x8F, 0x08, 0xFB, 0xDA, 0x54, 0xEF, 0x2C, 0xB4, 0x45, 0x06, 0xCA, 0xD0, 0xB5, 0xBE, 0xBC, 0xA7,
+    0xB3, 0xA6, 0x0C, 0x2D, 0x99, 0xE5, 0xDC, 0x32, 0xA6, 0xFC, 0x20, 0x7D, 0xF8, 0xE1, 0x8A, 0x02,
+    0xE5, 0x98, 0xA0, 0x0D, 0x35, 0xDA, 0xDE, 0x35, 0x55, 0x8F, 0xC5, 0x70, 0x18, 0x90, 0xA2, 0x40,
+    0x5D, 0x0F, 0xC8, 0xD7, 0x5D, 0x77, 0x8A, 0x8F, 0x16, 0x39, 0xFC, 0x45, 0x43, 0x1E, 0x6B, 0xE6,
+    0x9F, 0x6B, 0x64, 0x60, 0x5F, 0x3B, 0xF6, 0x32, 0x78, 0xA2, 0xBF, 0xF8, 0xC6, 0xB4, 0x8B, 0x69,
+    0xF5, 0xD7, 0x2E, 0xAE, 0xED, 0x80, 0x1B, 0xF8, 0x93, 0x4E, 0xC7, 0x48, 0x12, 0x0F, 0x6F, 0xBB,
+    0xDA, 0x22, 0xEC, 0xF3, 0xAD, 0x8A, 0x81, 0xED, 0x0E, 0xD6, 0x2E, 0xC4, 0x24, 0xFA, 0xF4, 0x61,
+    0xBB, 0x09, 0x5D, 0x03, 0x30, 0x81, 0x1A, 0x6A, 0x68, 0x30, 0x53, 0x65, 0xC7, 0x91, 0xA3, 0x33,
+    0x97, 0xB8, 0x1E, 0xE8, 0x47, 0x2A, 0xC8, 0x7E, 0x0B, 0xC8, 0xAB, 0x45, 0xB3, 0x06, 0x20, 0xBE,
+    0x74, 0x0E, 0x62, 0x6C, 0x58, 0xBF, 0xF4, 0x4B, 0x07, 0x88, 0x20, 0x5A, 0x52, 0x27, 0x1A, 0x7A,
+    0xC8, 0x40, 0x4D, 0xEA, 0xA4, 0x23, 0x23, 0x83, 0x29, 0x53, 0x92, 0x20, 0x2B, 0xB4, 0xD5, 0x86,
+    0x92, 0x82, 0x24, 0x88, 0x40, 0x66, 0x52, 0x47, 0x43, 0x9F, 0xDC, 0xAE, 0xCF, 0xAF, 0xD4, 0x8C,
+    0xE3, 0xED, 0x23, 0xB5, 0xCE, 0x74, 0x9B, 0x48, 0x3C, 0xE8, 0x51, 0x6D, 0x01, 0x5F, 0xBE, 0x61,
+    0x61, 0xF4, 0x10, 0xA4, 0x0F, 0x2F, 0xA0, 0x8E, 0x86, 0xE4, 0x76, 0x40, 0xC4, 0x39, 0x5C, 0x4A,
+    0x3D, 0x9A, 0x82, 0xA4, 0x92, 0x8E, 0x82, 0x6D, 0x94, 0x4D, 0x2D, 0xFB, 0xA2, 0x46, 0x9B, 0x01,
+    0xD4, 0x69, 0x30, 0xFA, 0xE9, 0x67, 0x0B, 0x66, 0x75, 0x44, 0xB6, 0xAB, 0x26, 0xE0, 0xFD, 0xC4,
+    0xB0, 0xC2, 0x20, 0x0E, 0xCF, 0xA2, 0xE4, 0xCA, 0x4D, 0x8E, 0xCD, 0x2C, 0x04, 0xD6, 0xFF, 0xC0,
+    0x11, 0xE7, 0xE8, 0xC7, 0x6A, 0x6A, 0xE9, 0x52, 0xAB, 0x29, 0xD8, 0x16, 0x55, 0x52, 0xA5, 0x26,
+    0x33, 0x25, 0x2D, 0x75, 0x1A, 0xCE, 0x86, 0x3F, 0x7B, 0x36, 0x8D, 0x9F, 0x0E, 0xAB, 0x32, 0x0B,
+    0x74, 0x80, 0x4E, 0x1F, 0xA9, 0xD5, 0x27, 0x86, 0x43, 0xA3, 0x63, 0x0C, 0xEC, 0x5C, 0x9E, 0x92,
+    0x71, 0x9C, 0xD4, 0x49, 0x92, 0x37, 0x41, 0xC1, 0xCB, 0x4F, 0x90, 0xC6, 0xE6, 0xAD, 0xF8, 0x50,
+    0x91, 0x3A, 0xE9, 0x64, 0x25, 0xAA, 0xF5, 0x18, 0x6B, 0x15, 0x63, 0x0B, 0x97, 0x9F, 0x14, 0xF1,
+    0x10, 0xDF, 0x70, 0xC1, 0x25, 0xB7, 0x42, 0xFA, 0x89, 0xB0, 0x29, 0x42, 0x21, 0xFD, 0x76, 0x6E,
+    0xBE, 0xD5, 0x12, 0x77, 0xBB, 0x5C, 0x31, 0xAD, 0x72, 0xE3, 0xB8, 0xA0, 0x54, 0x60, 0x03, 0x28,
+    0x12, 0x83, 0xFE, 0x9E, 0x43, 0x44, 0x07, 0x6B, 0xDD, 0x46, 0x5B, 0x1B, 0x0E, 0xCF, 0xC9, 0x18,
+    0x5B, 0xB2, 0xCB, 0x57, 0x50, 0x4E, 0xDA, 0x24, 0xE0, 0x56, 0x0C, 0x95, 0x06, 0xD4, 0x4B, 0x4F,
+    0x92, 0xC4, 0x79, 0x97, 0xCF, 0xAB, 0x8B, 0x4E, 0xB8, 0x24, 0x10, 0x68, 0xD8, 0x16, 0xB3, 0x78,
+    0x20, 0x62, 0x8C, 0x00, 0xF8, 0xBB, 0x45, 0x3D, 0x22, 0x86, 0x43, 0x4C, 0xF8, 0x0E, 0x82, 0x64,
+    0xD9, 0x73, 0xB5, 0x8B, 0xA1, 0x96, 0x29, 0xF0, 0x5E, 0x06, 0xA9, 0x0C, 0x03, 0x44, 0xC3, 0x92,
+    0x54, 0x5B, 0x6F, 0xF9, 0x56, 0x9B, 0x7E, 0x22, 0x6C, 0xAB, 0x1B, 0xAE, 0xDC, 0x4C, 0xFD, 0xB7,
+    0x5A, 0x39, 0x37, 0xDA, 0x50, 0xB2, 0xD1, 0xAA, 0xEB, 0xF1, 0x20, 0x89, 0x96, 0x45, 0xE7, 0x36,
+    0x88, 0xD1, 0x89, 0x3B, 0x97, 0x03, 0x23, 0xCE, 0x90, 0xF3, 0x0B, 0x1D, 0x47, 0xE6, 0x3B, 0xF4,
+    0xC2, 0xCE, 0x65, 0x4B, 0x1E, 0x2B, 0xF4, 0xD1, 0x8B, 0x23, 0x4E, 0x91, 0xA3, 0xD1, 0x56, 0xD9,
+    0x93, 0x31, 0xFA, 0x2C, 0xC6, 0x00, 0x54, 0x8B, 0xBF, 0x7D, 0x20, 0xDF, 0xED, 0xDA, 0x8B, 0x25,
+    0x32, 0xA4, 0x37, 0x4B, 0xFC, 0x68, 0x53, 0x84, 0xA0, 0x3F, 0xF9, 0x48, 0xDD, 0x9B, 0x11, 0x77,
+    0xA5, 0x47, 0x9B, 0xBB, 0x06, 0x22, 0x8C, 0xA3, 0x99, 0x05, 0x52, 0xB8, 0x88, 0x74, 0xE8, 0x5D,
+    0xF2, 0x43, 0x04, 0x77, 0x51, 0x3A, 0x32, 0xE5, 0xBB, 0x92, 0x35, 0x70, 0xAC, 0x38, 0xA4, 0xE1,
+    0xF0, 0x3C, 0x31, 0x46, 0xD4, 0x4B, 0x4F, 0x39, 0x11, 0xA8, 0x98, 0xF2, 0xF1, 0x15, 0xCF, 0x28,
+    0x1D, 0x88, 0x3B, 0x97, 0x61, 0x16, 0x2D, 0xFD, 0xA3, 0x17, 0x03, 0x0F, 0x31, 0xA5, 0xA0, 0xCF,
+    0x26, 0x17, 0x62, 0x34, 0xE3, 0xB8, 0x48, 0xEB, 0xB7, 0x2D, 0x5A, 0xEF, 0x60, 0x99, 0xD7, 0x81,
+    0x34, 0x40, 0x1A, 0x21, 0xBD, 0xE1, 0x51, 0x76, 0x71, 0x96, 0xAD, 0x7F, 0x1D, 0xF2, 0xD8, 0x30,
+    0xFE, 0x9F, 0x73, 0x76, 0x48, 0xED, 0x25, 0x12, 0xDF, 0x87, 0x27, 0x56, 0x74, 0xA4, 0x67, 0x49,
+    0x94, 0x66, 0x31, 0x43, 0x8C, 0xA5, 0x27, 0xB5, 0x0D, 0xB2, 0xCA, 0x0D, 0xB5, 0x6C, 0x18, 0x31,
+    0x8E, 0x91, 0xE4, 0x4D, 0x45, 0xAA, 0x2B, 0xC0, 0x63, 0x03, 0x65, 0x80, 0xA2, 0x84, 0x42, 0x1E,
+    0x1E, 0x32, 0xCC, 0xDE, 0x30, 0xE2, 0x4E, 0x74, 0x22, 0x6C, 0x42, 0xAD, 0x1C, 0x85, 0xA8, 0xD0,
+    0x04, 0xA4, 0xAF, 0x61, 0x5C, 0x83, 0xF2, 0x1D, 0x5C, 0x48, 0x02, 0x30, 0xDB, 0x25, 0xB9, 0x13,
+    0x51, 0x3E, 0x0D, 0xD2, 0x73, 0x89, 0x1A, 0x6D, 0x06, 0x26, 0xB3, 0x32, 0x46, 0xCB, 0xC9, 0xDB,
+    0x00, 0xE6, 0x2E, 0x08, 0xC7, 0x60, 0x70, 0x05, 0x54, 0x04, 0x4E, 0xF0, 0x7E, 0xDE, 0xDD, 0x3D,
+    0x38, 0xD4, 0x73, 0x55, 0xD7, 0xF9, 0xA5, 0xBB, 0x47, 0x36, 0x52, 0xFC, 0x11, 0xEA, 0x56, 0x44,
+    0xB9, 0x6D, 0xA4, 0xCF, 0x20, 0x28, 0x4B, 0x21, 0x1D, 0xFA, 0xAC, 0x47, 0x44, 0x0F, 0x99, 0xE9,
+    0xF0, 0x73, 0xEA, 0x20, 0x99, 0x1B, 0xD2, 0x5B, 0x2D, 0x99, 0xC9, 0x9D, 0x36, 0xA2, 0x96, 0x9E,
+    0x92, 0x03, 0x76, 0xD0, 0x71, 0x0E, 0x17, 0x56, 0x25, 0x53, 0xF9, 0x05, 0x50, 0x3C, 0x0A, 0x7A,
+    0xDF, 0xFB, 0x3B, 0x4B, 0x7C, 0x07, 0xBF, 0xB9, 0xBA, 0x84, 0xAF, 0xCB, 0x5E, 0x2A, 0xEE, 0x93,
+    0x5D, 0x69, 0xC9, 0x44, 0x85, 0x36, 0x23, 0xA4, 0xDB, 0x84, 0xA0, 0xA1, 0xD4, 0x06, 0x15, 0x0D,
+    0x5C, 0x5A, 0x40, 0xBC, 0x1C, 0x48, 0x6F, 0x43, 0x7E, 0x25, 0x70, 0x89, 0x19, 0x25, 0xCA, 0x6B,
+    0x43, 0x2D, 0x6B, 0xD1, 0x30, 0x88, 0x0D, 0x62, 0xB6, 0x0B, 0xF0, 0x25, 0x43, 0x12, 0xA3, 0x55,
+    0xB7, 0x2F, 0x54, 0xAA, 0x62, 0xA2, 0x3C, 0x5B, 0xB2, 0xE2, 0x98, 0x08, 0x1C, 0x32, 0xF5, 0xDA,
+    0x80, 0x72, 0x22, 0xBE, 0x12, 0xF8, 0xA5, 0x50, 0xC2, 0x44, 0x5B, 0xFA, 0x49, 0x8D, 0x36, 0x03,
+    0xAB, 0x9C, 0x8A, 0x31, 0x90, 0x2F, 0xE9, 0x8A, 0xFB, 0xA0, 0x2B, 0x01, 0xD5, 0xA2, 0x04, 0x84,
+    0x45, 0xF9, 0x5D, 0xBC, 0x4E, 0x2F, 0x90, 0xE7, 0x71, 0x20, 0x35, 0x8B, 0xC9, 0x69, 0x17, 0x8C,
+    0x13, 0x40, 0x3E, 0xF7, 0xEC, 0xCC, 0x02, 0x23, 0x65, 0x29, 0x45, 0x40, 0xB3, 0x8D, 0x74, 0x05,
+    0xD4, 0x25, 0x64, 0x07, 0x1D, 0x1F, 0x21, 0xAA, 0x45, 0x62, 0xE7, 0x37, 0xE1, 0xDA, 0xCC, 0x89,
+    0x3A, 0x69, 0xA9, 0xC9, 0x4C, 0x89, 0xF4, 0xDA, 0xAB, 0x8A, 0x18, 0x2B, 0xD6, 0x3B, 0x22, 0xE3,
+    0x43, 0x2C, 0x76, 0x1C, 0x49, 0x74, 0xC0, 0xA4, 0x04, 0x7A, 0x2C, 0x4B, 0xC7, 0xF0, 0xBC, 0x18,
+    0x1A, 0x1D, 0xCD, 0xF8, 0x80, 0xCC, 0x72, 0x15, 0x11, 0x48, 0x1D, 0x39, 0x34, 0x24, 0x15, 0xDA,
+    0x50, 0x42, 0x40, 0x7A, 0x32, 0x18, 0xC7, 0x18, 0x48, 0x63, 0x57, 0x6A, 0xA5, 0x47, 0x1B, 0x46,
+    0x10, 0x48, 0x1D, 0x19, 0x4C, 0x48, 0x02, 0xDA, 0xD0, 0x87, 0x9A, 0x93, 0x0D, 0xE3, 0x5D, 0x15,
+    0x7D, 0x1E, 0x3B, 0x6E, 0x68, 0x0C, 0x6A, 0x0E, 0xA3, 0x72, 0xB5, 0xE1, 0xDF, 0xA6, 0x15, 0x2C,
+    0x16, 0xAD, 0xE0, 0xC3, 0x07, 0x6C, 0xE5, 0x0D, 0x3F, 0xFE, 0xDB, 0x20, 0xFF, 0x26, 0xB5, 0x99,
+    0x2F, 0x99, 0x11, 0x92, 0xA0, 0x9C, 0xB6, 0x3D, 0x0A, 0x6A, 0x11, 0xE4, 0xF5, 0xD4, 0xEA, 0xA2,
+    0x64, 0xEC, 0x03, 0xED, 0x3F, 0x71, 0x23, 0xC9, 0xEC, 0xF2, 0xE5, 0xB9, 0x1D, 0xC4, 0x18, 0xDB,
+    0xB7, 0xDC, 0x48, 0xF5, 0x2E, 0x6E, 0x64, 0x03, 0xF2, 0x00, 0x5F, 0xEE, 0x5A, 0xC2, 0x63, 0xF3,
+    0x5D, 0xBE, 0x7C, 0xA7, 0x23, 0x46, 0xB6, 0x8F, 0xD9, 0xE4, 0xB9, 0x68, 0x75, 0xBE, 0x43, 0x59,
+    0x4D, 0xC4, 0x5C, 0xFA, 0x34, 0x74, 0xF4, 0x4D, 0x93, 0x54, 0xD2, 0x69, 0x93, 0x51, 0x6C, 0x4C,
+    0x78, 0xF5, 0x86, 0x57, 0x07, 0x9A, 0x05, 0xBC, 0x59, 0x13, 0xE8, 0x17, 0x9C, 0x8A, 0x21, 0xB9,
+    0x51, 0x2F, 0xB2, 0x64, 0x6D, 0x68, 0x64, 0xAC, 0xC8, 0x2C, 0xCA, 0x91, 0x04, 0x98, 0x40, 0x09,
+    0xDA, 0x2C, 0xDF, 0x37, 0xDD, 0x7B, 0x0E, 0xDF, 0x8B, 0x99, 0x15, 0x1D, 0xA8, 0xBC, 0x7A, 0x2A,
+    0x7B, 0xE3, 0xE9, 0x1B, 0xF5, 0x5D, 0xDD, 0x96, 0x49, 0x5A, 0xC6, 0xEE, 0x10, 0xE8, 0x8A, 0x40,
+    0x8E, 0xF4, 0x14, 0x1B, 0xEA, 0x59, 0x66, 0x4E, 0x55, 0x2B, 0xE8, 0x1E, 0x9D, 0x5A, 0x91, 0xE6,
+    0x27, 0x86, 0xE8, 0x68, 0xD9, 0x81, 0x0C, 0x52, 0x47, 0x52, 0x41, 0x0D, 0xE5, 0xF2, 0xBD, 0xEC,
+    0xDE, 0x17, 0x47, 0xDE, 0xAF, 0xCF, 0x51, 0xD1, 0x73, 0xEC, 0xF2, 0xC3, 0x2B, 0x74, 0xF2, 0x33,
+    0x0D, 0xBD, 0x01, 0xC7, 0x71, 0xF2, 0x07, 0x15, 0xB3, 0x6A, 0x71, 0x1E, 0xFF, 0x5C, 0x77, 0xEF,
+    0xEF, 0xCE, 0x3E, 0xE9, 0x62, 0x48, 0x9A, 0x9F, 0x3D, 0x84, 0xE1, 0x79, 0x19, 0x2B, 0xD1, 0xA0,
+    0x1C, 0x39, 0x4C, 0x56, 0x99, 0x90, 0x04, 0xB4, 0xED, 0xF2, 0x45, 0x2D, 0xF6, 0xC2, 0xC9, 0x46,
+    0xC4, 0x9A, 0xD4, 0xB0, 0x87, 0x74, 0xE8, 0xAF, 0x2E, 0xCF, 0xDE, 0x24, 0x64, 0xEE, 0x52, 0x57,
+    0x9C, 0xC2, 0xD8, 0x69, 0x46, 0x49, 0xA5, 0xCD, 0x28, 0x09, 0xDA, 0x14, 0xFF, 0xEC, 0xD5, 0x67,
+    0xDA, 0xCC, 0x9D, 0xC6, 0xA7, 0xF4, 0xCF, 0x8D, 0x4D, 0x87, 0x99, 0xB5, 0x63, 0xCC, 0x42, 0x8B,
+    0x64, 0x6D, 0x68, 0x06, 0x73, 0x32, 0xDB, 0x0D, 0xB9, 0xEC, 0x90, 0x96, 0x43, 0x4A, 0x8F, 0x66,
+    0x19, 0x8D, 0x98, 0xD9, 0x2C, 0x9A, 0xFC, 0xDB, 0xAD, 0x74, 0xA3, 0xD4, 0xD6, 0x59, 0x12, 0x4A,
+    0x79, 0x7D, 0xF4, 0x46, 0xBB, 0x03, 0x0C, 0xCF, 0xAF, 0x0D, 0x19, 0xCC, 0xD3, 0xE8, 0x44, 0xC3,
+    0xD8, 0x30, 0x42, 0xDB, 0xEE, 0x76, 0x53, 0xDB, 0xA5, 0xFC, 0x08, 0x6A, 0x72, 0x8E, 0x7C, 0xA2,
+    0xAD, 0x58, 0x7E, 0x12, 0xDE, 0xE6, 0x93, 0x93, 0x0D, 0x53, 0xB2, 0x68, 0xFA, 0x2C, 0xE0, 0xD4,
+    0x5D, 0xA9, 0x85, 0xF4, 0x6B, 0x6E, 0x59, 0x45, 0xEE, 0x37, 0x4B, 0xC4, 0x96, 0x54, 0x99, 0xCB,
+    0xDC, 0x25, 0x2E, 0x1D, 0x2D, 0xD4, 0x21, 0x0D, 0x63, 0x37, 0x76, 0x1A, 0xCD, 0x88, 0x51, 0x52,
+    0x25, 0x95, 0x36, 0xA9, 0x19, 0x51, 0x26, 0x81, 0xA0, 0x8D, 0x72, 0xC5, 0x46, 0x4F, 0xBC, 0xEA,
+    0xEA, 0xB4, 0x95, 0x2E, 0xB3, 0x79, 0x77, 0x42, 0x48, 0x07, 0x3D, 0xF8, 0x41, 0x40, 0x46, 0x96,
+    0xCC, 0xC1, 0x13, 0x0B, 0x22, 0xF5, 0x8D, 0x0A, 0x9A, 0x02, 0xF6, 0xE5, 0x6A, 0xEE, 0x90, 0xB1,
+    0x82, 0x6C, 0x71, 0xC6, 0x88, 0xB0, 0x28, 0x8A, 0x2B, 0x70, 0x73, 0xF4, 0xE2, 0x5B, 0xC0, 0xCD,
+    0x91, 0x8B, 0x74, 0xBC, 0xAB, 0xF4, 0xC8, 0x5B, 0x15, 0xC4, 0x0A, 0x8E, 0x1D, 0x9E, 0xA4, 0x39,
+    0x88, 0x03, 0xD0, 0x23, 0x08, 0x35, 0x7A, 0x55, 0x36, 0x49, 0xDA, 0xAE, 0x18, 0xA8, 0x05, 0x61,
+    0x36, 0xE9, 0x06, 0xD4, 0x5D, 0x2F, 0x98, 0x54, 0xDD, 0x70, 0xC5, 0x9B, 0x78, 0x2E, 0xD1, 0xF5,
+    0xB8, 0xBF, 0x3C, 0x45, 0x44, 0x47, 0x52, 0x03, 0x0C, 0xCF, 0x9D, 0x38, 0x4F, 0xAC, 0x07, 0x2D,
+    0x99, 0xD5, 0x9E, 0x8C, 0x3E, 0xE4, 0xA2, 0x86, 0x9E, 0xF2, 0x50, 0xE6, 0x40, 0x39, 0x05, 0xC6,
+    0x15, 0x30, 0xAB, 0x80, 0xDB, 0x35, 0x50, 0x4F, 0x81, 0x30, 0x00, 0x11, 0x32, 0x4B, 0x12, 0xD2,
+    0x0A, 0x59, 0xC9, 0x86, 0x93, 0xB7, 0x89, 0x8C, 0xE7, 0x0C, 0x96, 0x4D, 0xC8, 0x13, 0x74, 0x67,
+    0x46, 0x97, 0x74, 0xA2, 0x62, 0x01, 0x0D, 0xD7, 0xBA, 0x3D, 0xA8, 0x6B, 0x3E, 0x52, 0x43, 0x40,
+    0x04, 0x92, 0x0A, 0xE9, 0x91, 0x4F, 0x37, 0xF2, 0xF9, 0xAB, 0xAA, 0xDE, 0x4A, 0x7D, 0xA9, 0xED,
+    0x44, 0xAB, 0x90, 0xCD, 0x4C, 0xDE, 0x50, 0x8E, 0x28, 0xFA, 0x8C, 0x32, 0xBB, 0x9D, 0xDE, 0xDE,
+    0x17, 0x07, 0x8B, 0xDF, 0xEE, 0x5A, 0xD3, 0x4E, 0xDB, 0xEA, 0xA0, 0xA0, 0xDD, 0x99, 0x5D, 0x8F,
+    0xEA, 0xB1, 0xBF, 0x4C, 0x7F, 0x1D, 0xBD, 0x8D, 0x0E, 0xE8, 0x40, 0xB6, 0x4F, 0x6F, 0x44, 0x51,
+    0x8A, 0x22, 0xFB, 0xD5, 0x91, 0x6E, 0xF7, 0x65, 0xBD, 0xC2, 0x82, 0x53, 0xC8, 0x2A, 0x92, 0x03,
+    0xF8, 0xC0, 0xE1, 0xC2, 0x0E, 0xE6, 0xDD, 0xBA, 0x8E, 0x3A, 0xE4, 0xB5, 0xA4, 0x09, 0x97, 0x14,
+    0xF9, 0xA2, 0xF7, 0x5F, 0x4D, 0xF7, 0x3D, 0x49, 0x60, 0x4F, 0x5B, 0x75, 0x7D, 0x16, 0x0F, 0x16,
+    0x18, 0x5B, 0x78, 0x55, 0x67, 0xCD, 0xF1, 0x5D, 0x60, 0x8D, 0xB1, 0xFB, 0x48, 0x60, 0x44, 0x0F,
+    0x6D, 0xA4, 0x13, 0x81, 0x09, 0x5B, 0x87, 0xFF, 0x59, 0xA2, 0x51, 0xD7, 0x93, 0x1F, 0xDA, 0xE8,
+    0xBA, 0xB6, 0x65, 0x78, 0x1E, 0x19, 0x2B, 0x44, 0x73, 0x38, 0xDA, 0x72, 0x71, 0xCD, 0x2A, 0x24,
+    0x7D, 0x84, 0xB9, 0x74, 0xF8, 0x9C, 0x94, 0x86, 0xD1, 0xC9, 0x18, 0x9F, 0x5B, 0x36, 0x43, 0x89,
+    0x7D, 0xD3, 0xB7, 0xF4, 0x02, 0x08, 0xBC, 0xB3, 0x68, 0x84, 0xA5, 0xA1, 0x44, 0xA3, 0x57, 0x0A,
+    0x0B, 0x14, 0x0C, 0xCF, 0x17, 0xC4, 0x66, 0x9B, 0xCC, 0xEE, 0x91, 0x51, 0x91, 0x63, 0xE8, 0x2D,
+    0xE0, 0x4A, 0xF9, 0x16, 0x36, 0xA2, 0xEE, 0xC6, 0x17, 0x81, 0x07, 0x92, 0xC0, 0x9E, 0xAC, 0x44,
+    0x38, 0x19, 0xA3, 0xEF, 0x00, 0xFD, 0x06, 0xA2, 0x5A, 0x4B, 0x3F, 0xD9, 0x16, 0x1F, 0x09, 0x95,
+    0xFA, 0x36, 0xBD, 0xBB, 0xA8, 0x91, 0xCB, 0x43, 0xD0, 0xA3, 0xCD, 0x51, 0xF2, 0x26, 0xA0, 0xAE,
+    0xD3, 0xDB, 0x26, 0xBA, 0x45, 0x91, 0x65, 0x78, 0x1E, 0x62, 0xD3, 0xAD, 0x55, 0xB6, 0x80, 0x5D,
+    0x5D, 0x1C, 0xBF, 0x49, 0x49, 0xCB, 0x48, 0xB4, 0x4C, 0xD9, 0xFD, 0xA9, 0x71, 0x9C, 0x13, 0x91,
+    0x8F, 0x04, 0x32, 0x92, 0x8A, 0xB2, 0x93, 0x20, 0x52, 0xCB, 0xFE, 0xBD, 0xFA, 0x93, 0x21, 0x5C,
+    0xCA, 0xC4, 0xEA, 0xEA, 0x46, 0xFA, 0xC7, 0x44, 0x97, 0x2E, 0xAB, 0xF7, 0x3F, 0xBA, 0x4E, 0xD7,
+    0x60, 0xEC, 0x51, 0x35, 0x22, 0x5A, 0x8E, 0xFD, 0x13, 0xEB, 0xB4, 0x46, 0x16, 0xC4, 0x15, 0x44,
+    0xE8, 0xD8, 0xCC, 0x02, 0xE5, 0xB8, 0xE6, 0xD2, 0x5A, 0x34, 0xCC, 0xE8, 0x1F, 0x5E, 0xBD, 0xCE,
+    0x37, 0x2B, 0xDD, 0x72, 0x6D, 0xB9, 0xF9, 0x97, 0x68, 0xB8, 0xD3, 0x0C, 0xB3, 0x6A, 0x49, 0xA5,
+    0x02, 0xAC, 0x9D, 0xE3, 0xC4, 0x79, 0x79, 0x40, 0x36, 0x27, 0xB7, 0x4C, 0x50, 0x81, 0x2D, 0x92,
+    0x39, 0x1A, 0xDE, 0x70, 0xD2, 0x51, 0x34, 0xA2, 0x42, 0xE7, 0xEC, 0xA3, 0x1E, 0xF5, 0x25, 0x89,
+    0x9F, 0x6A, 0x08, 0xFA, 0xAC, 0xA3, 0x90, 0x2F, 0x54, 0x64, 0x8C, 0xF6, 0x51, 0x56, 0x4F, 0x49,
+    0xBC, 0x88, 0x10, 0x18, 0x38, 0xAE, 0x19, 0x55, 0x89, 0x18, 0xA8, 0x8F, 0xA2, 0xFF, 0xC4, 0xC3,
+    0x25, 0xD0, 0x06, 0xE9, 0x59, 0x51, 0x82, 0x5C, 0xB0, 0xD7, 0xD2, 0x76, 0x10, 0xD4, 0x57, 0x3E,
+    0x6D, 0xFE, 0xDC, 0x05, 0x1D, 0x32, 0x0E, 0x92, 0x4A, 0xDB, 0x52, 0x04, 0xE9, 0x7A, 0x8C, 0xA4,
+    0x4F, 0x7F, 0xAF, 0xE0, 0xB5, 0xBF, 0x76, 0xBA, 0x99, 0xD0, 0x71, 0x9F, 0x43, 0xC4, 0xD0, 0x0C,
+    0xBC, 0x88, 0x55, 0xD2, 0x90, 0x5A, 0xC6, 0x24, 0x9E, 0xBC, 0x22, 0xA0, 0xA7, 0x14, 0xC8, 0x67,
+    0xED, 0x26, 0xFC, 0x38, 0xA4, 0x86, 0xED, 0x52, 0x7A, 0xB6, 0x52, 0x17, 0xD0, 0xD4, 0x05, 0xD2,
+    0xF5, 0x37, 0x11, 0x41, 0x3D, 0x63, 0xD8, 0xE6, 0x0D, 0xC7, 0x16, 0x59, 0x40, 0x23, 0x5B, 0xD2,
+    0x9B, 0xEC, 0x90, 0xC5, 0x43, 0x4A, 0xAF, 0xF3, 0xA4, 0xD4, 0x4B, 0xFD, 0xA8, 0xEB, 0x1D, 0xF5,
+    0x02, 0x08, 0x76, 0xD5, 0xA0, 0x49, 0xAB, 0xD9, 0x8D, 0xC8, 0x76, 0x5D, 0xA7, 0x53, 0x4D, 0x14,
+    0x41, 0xFB, 0x1E, 0x8D, 0xF4, 0x19, 0x45, 0x52, 0x29, 0x57, 0x32, 0x39, 0xEB, 0xF4, 0x7F, 0x1C,
+    0x11, 0x1F, 0xB7, 0xBA, 0x5A, 0x8A, 0x5E, 0xD3, 0x6E, 0xF5, 0xEB, 0x8E, 0x8C, 0x3A, 0xDA, 0x1A,
+    0x85, 0x05, 0x7D, 0xCD, 0xD5, 0x1A, 0xD0, 0xAB, 0x1A, 0x08, 0x20, 0xCE, 0xB3, 0x36, 0x24, 0x1A,
+    0x15, 0x6D, 0x5A, 0xD1, 0x43, 0xB4, 0xA4, 0x86, 0x99, 0x95, 0x8E, 0x7E, 0x20, 0xA0, 0xFB, 0x6C,
+    0x23, 0x9F, 0x71, 0x5B, 0x88, 0xAA, 0xD6, 0x86, 0xFD, 0x5C, 0x3A, 0x0A, 0xE9, 0x03, 0x9A, 0x66,
+    0x1B, 0xE5, 0xB2, 0x2D, 0x44, 0x25, 0x5F, 0x86, 0xFD, 0x0E, 0x67, 0xE8, 0x40, 0xBE, 0x2B, 0x1A,
+    0xC6, 0xED, 0x51, 0xEE, 0x02, 0x69, 0xF6, 0x29, 0xB6, 0x48, 0x6E, 0x59, 0x74, 0xB5, 0xE2, 0x11,
+    0xDF, 0xC5, 0x1A, 0x09, 0xB3, 0x10, 0x13, 0xB9, 0xC4, 0xE2, 0x04, 0x4B, 0xED, 0x82, 0x2E, 0x4A,
+    0xFC, 0x4C, 0xB4, 0xF7, 0xA8, 0x76, 0x50, 0xC3, 0xAB, 0xDF, 0xAD, 0x50, 0x7F, 0xAA, 0x0D, 0xB9,
+    0x2B, 0x60, 0x2E, 0x02, 0x32, 0xA4, 0x16, 0x6D, 0x4A, 0x18, 0x11, 0x48, 0x2A, 0x75, 0x1D, 0x6D,
+    0x7A, 0xDB, 0x14, 0xCC, 0x9C, 0x08, 0xAB, 0x9D, 0xFC, 0xEE, 0x53, 0xA0, 0xB7, 0x89, 0x08, 0xF2,
+    0x6D, 0x53, 0xE0, 0x12, 0x59, 0xEC, 0x16, 0x59, 0xBA, 0x45, 0xC2, 0xF2, 0x0F, 0xD5, 0xF2, 0x34,
+    0x5B, 0xEF, 0x8E, 0xD9, 0x93, 0x55, 0xFE, 0x78, 0x3B, 0x08, 0x9B, 0x65, 0x99, 0x4E, 0xB5, 0x6C,
+    0x95, 0x3B, 0x48, 0xAA, 0x3E, 0x75, 0x46, 0x91, 0xDA, 0x4C, 0xFA, 0xD4, 0x06, 0xE9, 0x47, 0x84,
+    0x1E, 0x23, 0x16, 0xFE, 0x87, 0xD4, 0xCA, 0xEF, 0x39, 0xA2, 0x23, 0x5B, 0xF0, 0x4C, 0x22, 0xB6,
+    0x30, 0x9E, 0x1F, 0x99, 0xF8, 0x8F, 0x18, 0x44, 0x9C, 0x23, 0x6F, 0x7F, 0x2E, 0xC8, 0xC0, 0x8E,
+    0x0C, 0xE8, 0xEB, 0x01, 0x51, 0x37, 0x50, 0x8E, 0x40, 0x5F, 0x00, 0xF9, 0xBC, 0x45, 0xBC, 0x5A,
+    0xC1, 0xB4, 0x81, 0x7E, 0x1F, 0x32, 0xED, 0xD0, 0x0F, 0xD7, 0xA4, 0x6E, 0x60, 0x32, 0x27, 0xE7,
+    0x33, 0xC7, 0x4A, 0x0C, 0xFE, 0x09, 0x11, 0xA6, 0x21, 0x8F, 0x76, 0x20, 0x42, 0x4E, 0xA9, 0x8D,
+    0x7E, 0xCC, 0xC9, 0xEF, 0x54, 0xD4, 0x35, 0x45, 0x49, 0x4F, 0x5B, 0x9D, 0x04, 0x6D, 0xC7, 0x57,
+    0xAC, 0x5A, 0xA8, 0x89, 0x02, 0xA0, 0xFA, 0x05, 0xE8, 0xFF, 0x16, 0xA4, 0x73, 0xE0, 0x83, 0xEF,
+    0x9B, 0x5E, 0x0E, 0xF7, 0x60, 0xE5, 0x5B, 0xD5, 0x97, 0x77, 0x2A, 0x39, 0x02, 0xF8, 0x53, 0x30,
+    0x4E, 0x2B, 0xF2, 0x1B, 0x2D, 0xDA, 0x1F, 0x80, 0xBF, 0xE7, 0x48, 0xD4, 0x59, 0xAC, 0xD0, 0x2F,
+    0x5E, 0x70, 0x32, 0xB0, 0x43, 0x8B, 0x0C, 0x19, 0x64, 0x67, 0x2B, 0xA8, 0x47, 0xA0, 0x3F, 0xE5,
+    0xA0, 0x6E, 0x20, 0xD3, 0x96, 0x24, 0x34, 0xD0, 0xD7, 0x16, 0xE5, 0x5A, 0x68, 0x94, 0x27, 0x67,
+    0x60, 0x32, 0x47, 0xBC, 0x12, 0x48, 0x8E, 0x30, 0xB2, 0xF0, 0xC0, 0x69, 0xF4, 0xB7, 0x7D, 0x12,
+    0x1A, 0xCA, 0x1E, 0xA9, 0x5C, 0xF9, 0xD8, 0x2E, 0x54, 0xE4, 0xD1, 0x6A, 0x37, 0x4A, 0x82, 0xF4,
+    0x25, 0x7D, 0xE5, 0xA4, 0x9F, 0x50, 0x6A, 0x23, 0x5D, 0xCD, 0x44, 0x5B, 0xCD, 0x54, 0x56, 0xEA,
+    0x4E, 0x73, 0x44, 0x79, 0x3D, 0xD7, 0x9D, 0x81, 0x62, 0x0E, 0xF2, 0x80, 0x95, 0x1C, 0xC3, 0xBF,
+    0xDF, 0x45, 0xC5, 0x68, 0xC5, 0xD7, 0xFE, 0x55, 0x8D, 0x72, 0x03, 0x92, 0xA0, 0x1C, 0x13, 0x11,
+    0x28, 0x69, 0xD0, 0x4C, 0x51, 0xD7, 0x0F, 0x48, 0x62, 0x03, 0xF3, 0xBA, 0x03, 0x60, 0x5A, 0x7A,
+    0x94, 0x9B, 0x92, 0x54, 0xDA, 0xD2, 0x88, 0x46, 0xCC, 0x76, 0xF3, 0xEB, 0xB1, 0x11, 0x87, 0x64,
+    0xAC, 0x74, 0xE4, 0x88, 0x80, 0x66, 0x69, 0xC6, 0xC9, 0x1F, 0xF9, 0x71, 0xCC, 0xDD, 0xEF, 0xDC,
+    0x11, 0x7F, 0x4F, 0xBA, 0xC7, 0xC0, 0xD0, 0xA0, 0x3C, 0x39, 0xDD, 0xF9, 0xAA, 0x3B, 0x96, 0x62,
+    0xED, 0x1B, 0x30, 0x8E, 0x0D, 0x1F, 0xAE, 0x2F, 0x18, 0x46, 0x32, 0x90, 0x33, 0x22, 0xB5, 0x19,
+    0xD2, 0x6B, 0x4B, 0x48, 0x1D, 0xA3, 0xCC, 0x93, 0x47, 0x8B, 0x7E, 0xD9, 0x20, 0xBF, 0x13, 0x3A,
+    0x01, 0x71, 0x94, 0x3A, 0x7A, 0x34, 0x68, 0x9B, 0xD9, 0x93, 0xB7, 0x93, 0x36, 0x8B, 0x36, 0x73,
+    0x2B, 0x99, 0xE7, 0x4D, 0x4C, 0x72, 0x71, 0x84, 0x41, 0xB9, 0x96, 0xBA, 0xD9, 0x33, 0x41, 0xFC,
+    0xF0, 0xEF, 0xF8, 0x5D, 0x4B, 0xCF, 0xA1, 0x3D, 0xB2, 0x42, 0xD4, 0x30, 0x5D, 0xB6, 0x55, 0x9D,
+    0x43, 0x69, 0x41, 0x64, 0x2C, 0xCE, 0x95, 0x00, 0xE1, 0x08, 0x87, 0x91, 0xB8, 0x4D, 0x98, 0x66,
+    0xA0, 0xAF, 0x80, 0x88, 0x0B, 0x7F, 0x18, 0xC0, 0x2F, 0x7E, 0x1D, 0x11, 0x63, 0xC5, 0x7F, 0x79,
+    0xEE, 0x2A, 0x22, 0x68, 0xC7, 0x54, 0x04, 0x7A, 0x8C, 0xD0, 0xA6, 0x8F, 0x74, 0x39, 0x22, 0x8C,
+    0x0D, 0xB3, 0x39, 0x0C, 0xAE, 0x76, 0x19, 0x22, 0x5D, 0x8D, 0x08, 0x39, 0x4C, 0x64, 0x45, 0x9F,
+    0x1D, 0x2E, 0xDC, 0x4C, 0xC3, 0x78, 0xCE, 0x78, 0xC5, 0x87, 0xBA, 0x42, 0x54, 0x81, 0xD7, 0x3D,
+    0x63, 0xB3, 0x92, 0x35, 0xF2, 0x47, 0xC2, 0xEC, 0x99, 0xA0, 0xBE, 0xF6, 0x84, 0x9A, 0x90, 0xEE,
+    0xA1, 0x3D, 0xDA, 0x92, 0x19, 0x72, 0x28, 0xA1, 0x80, 0xA2, 0x9B, 0x5D, 0x12, 0x50, 0x9E, 0x34,
+    0xA0, 0xAB, 0xCE, 0x1F, 0x01, 0x5F, 0x34, 0x49, 0x3C, 0x48, 0xEA, 0xCF, 0x7F, 0x22, 0x24, 0x7E,
+    0xCA, 0x5E, 0xCE, 0x07, 0x53, 0x0F, 0x73, 0xC8, 0x6A, 0x88, 0x16, 0xD5, 0xC0, 0x20, 0x41, 0x3D,
+    0xE7, 0xA9, 0xF7, 0x19, 0xE5, 0xF4, 0xD3, 0x3B, 0x33, 0xC6, 0x87, 0x42, 0x97, 0xF0, 0x68, 0x43,
+    0x43, 0x6A, 0x57, 0x07, 0xEE, 0x05, 0x9F, 0x46, 0xBB, 0xFD, 0x01, 0xE9, 0x49, 0x1D, 0xDA, 0x93,
+    0x55, 0x68, 0x8F, 0x76, 0x36, 0x4B, 0xED, 0x7E, 0x7E, 0xCB, 0x2E, 0xE5, 0x9A, 0x2F, 0xC0, 0x18,
+    0x76, 0x02, 0xD3, 0x1E, 0xDB, 0x89, 0x79, 0x4F, 0xC2, 0xC9, 0x60, 0x8E, 0x1E, 0x51, 0x6F, 0xA7,
+    0x4B, 0xDD, 0xED, 0x67, 0x0C, 0x67, 0xFD, 0xAB, 0xE4, 0xD1, 0xE7, 0xBF, 0x52, 0x67, 0x6C, 0xA5,
+    0x2E, 0x4D, 0x82, 0x30, 0x57, 0x41, 0x57, 0x88, 0x68, 0xD0, 0x0D, 0x8C, 0x2D, 0x32, 0x7C, 0x94,
+    0x4B, 0xF7, 0xA2, 0x3F, 0x65, 0xD4, 0xD3, 0x41, 0x56, 0xB3, 0xA7, 0x82, 0xEA, 0x4C, 0x03, 0xC9,
+    0x2E, 0xA2, 0xED, 0x1A, 0x71, 0x4B, 0x6A, 0x97, 0xE7, 0xEE, 0xFA, 0x41, 0x12, 0xAB, 0xED, 0x0F,
+    0x68, 0xC3, 0x14, 0x59, 0x93, 0x55, 0x0C, 0x0C, 0xED, 0x47, 0xD5, 0x33, 0x76, 0x7F, 0xF6, 0xBF,
+    0x92, 0x68, 0x80, 0xFB, 0x48, 0x03, 0xC7, 0x91, 0x4E, 0xD4, 0xCB, 0x1A, 0x28, 0xED, 0x16, 0xA5,
+    0xB6, 0xE2, 0x75, 0x4F, 0x5A, 0xAF, 0xA8, 0xFF, 0x2F, 0x1A, 0x66, 0xD1, 0xE4, 0xBF, 0x52, 0x2B,
+    0x97, 0x9A, 0x29, 0x7B, 0xA9, 0x5B, 0xE3, 0x2A, 0xC8, 0xA6, 0x9B, 0x9C, 0x41, 0x05, 0x63, 0x0B,
+    0x6D, 0x82, 0xF2, 0x17, 0x29, 0x53, 0xA3, 0xDC, 0x94, 0x26, 0xBD, 0x33, 0x23, 0x8B, 0xE6, 0xA8,
+    0xC2, 0x36, 0xE1, 0x77, 0x2A, 0x06, 0xEE, 0x08, 0x59, 0xED, 0x93, 0x58, 0x29, 0xBB, 0xAB, 0x0D,
+    0xA9, 0x43, 0xD6, 0x88, 0x39, 0x0C, 0x0C, 0xDA, 0x7D, 0x54, 0xB9, 0x49, 0x6A, 0x66, 0xFF, 0x6B,
+    0xA1, 0xB0, 0x9D, 0x18, 0x0E, 0x7F, 0x2D, 0xC6, 0x78, 0xEB, 0xF2, 0xFC, 0xCA, 0x48, 0xFA, 0xD3,
+    0x21, 0xE3, 0xFF, 0x98, 0x69, 0x62, 0xDE, 0xDA, 0xDB, 0x2D, 0xD4, 0xC8, 0x7A, 0xE5, 0x15, 0x60,
+    0x0A, 0x27, 0x6F, 0xB3, 0x54, 0x6B, 0xC4, 0x13, 0xA0, 0xAB, 0x8E, 0xEF, 0x2B, 0xBA, 0xEF, 0xAF,
+    0xEE, 0x9C, 0x7D, 0x34, 0xC7, 0xE2, 0xF7, 0xE3, 0xC1, 0x21, 0xF2, 0x55, 0xB6, 0x53, 0x26, 0xC3,
+    0x87, 0x74, 0x6A, 0x63, 0x48, 0x6B, 0x60, 0xDD, 0x72, 0xB5, 0x73, 0x7F, 0xE6, 0x2B, 0xED, 0xC2,
+    0xA7, 0x48, 0x57, 0x93, 0x3E, 0x6F, 0xD0, 0xF5, 0x52, 0x3C, 0x5D, 0x1B, 0x0E, 0xCF, 0x8F, 0x63,
+    0xBC, 0xF3, 0xD2, 0xEC, 0xA9, 0xE7, 0xA9, 0xD3, 0x42, 0xB9, 0xD3, 0xBB, 0x39, 0xBB, 0x6F, 0x6D,
+    0x4F, 0x7F, 0xA2, 0x83, 0x21, 0xEF, 0xCC, 0xBE, 0xE3, 0x08, 0xF0, 0x00, 0xA2, 0x22, 0x35, 0x14,
+    0x9C, 0xF1, 0xC9, 0x77, 0xD0, 0x24, 0xB3, 0x66, 0x10, 0x7D, 0x7A, 0x48, 0x8A, 0x6C, 0x2E, 0xF9,
+    0x12, 0x61, 0x8B, 0x1E, 0x31, 0x24, 0x07, 0x3F, 0x7D, 0xC6, 0xD6, 0x76, 0xCE, 0x31, 0x88, 0xF6,
+    0xA7, 0xCF, 0xD8, 0xDB, 0xCC, 0x4B, 0x1A, 0x9B, 0x0B, 0x2F, 0x99, 0x9F, 0x98, 0x97, 0xAE, 0xCC,
+    0x0F, 0x1E, 0x87, 0x74, 0x16, 0xE0, 0x89, 0x23, 0xFA, 0xD8, 0x89, 0xF3, 0x0C, 0x3F, 0x1B, 0x5D,
+    0x36, 0x3F, 0xE9, 0xD9, 0x61, 0xD2, 0xD5, 0xD4, 0x82, 0x1A, 0xE9, 0x32, 0xD8, 0x4E, 0x02, 0xA9,
+    0xE9, 0x41, 0x90, 0x1E, 0x4D, 0x09, 0x41, 0x39, 0x36, 0x19, 0x91, 0xF8, 0xD4, 0x51, 0x30, 0x42,
+    0x5B, 0x19, 0x64, 0x20, 0x8F, 0x2D, 0x47, 0xB7, 0x1C, 0x88, 0xE6, 0xE3, 0x0C, 0x5E, 0x46, 0xE9,
+    0x8A, 0x8D, 0x0F, 0x1E, 0xD2, 0x01, 0xDB, 0x33, 0xA7, 0x4D, 0x41, 0x50, 0x2E, 0x63, 0x22, 0x2A,
+    0x6D, 0x4A, 0x82, 0x74, 0x3D, 0xA6, 0xD2, 0x67, 0xB6, 0x94, 0x13, 0xE9, 0x5F, 0xFF, 0xA3, 0x41,
+    0x3B, 0xBE, 0x3E, 0x97, 0x15, 0x6F, 0x32, 0x91, 0x1C, 0xD2, 0x6F, 0x20, 0x86, 0x66, 0x6D, 0x38,
+    0x6E, 0x45, 0x7C, 0xE1, 0x2A, 0xAA, 0x4A, 0x2D, 0x25, 0x0D, 0xD2, 0x69, 0x43, 0x21, 0x02, 0xCA,
+    0xE6, 0xB0, 0x9F, 0x54, 0x8B, 0x88, 0xA5, 0x47, 0x33, 0x42, 0x54, 0xCA, 0xB1, 0xC5, 0x14, 0xE9,
+    0x94, 0xA3, 0x61, 0xC0, 0x80, 0x24, 0x46, 0x87, 0x5A, 0x59, 0x7C, 0xEE, 0xBF, 0x8C, 0x8A, 0xE1,
+    0x48, 0xEB, 0xF0, 0xCE, 0xC3, 0x15, 0x4B, 0x1F, 0x89, 0xFA, 0x41, 0x05, 0x79, 0x03, 0x9C, 0x7F,
+    0xBF, 0x67, 0x5A, 0xDA, 0x8F, 0x51, 0x9E, 0x24, 0x89, 0x9E, 0xF5, 0xEA, 0xE7, 0x98, 0xE9, 0x0F,
+    0x2F, 0xDC, 0x38, 0xC9, 0xD3, 0x0E, 0x8A, 0x53, 0x90, 0xDC, 0x70, 0x8B, 0xDE, 0xED, 0x83, 0xEF,
+    0xD7, 0x94, 0x8B, 0x5D, 0x98, 0x39, 0x36, 0xEF, 0x25, 0xB9, 0xEE, 0x39, 0x7D, 0x1A, 0xA2, 0x25,
+    0xD9, 0x05, 0xC8, 0x9D, 0x7A, 0xBC, 0xA5, 0x96, 0x4E, 0x33, 0x12, 0x21, 0xB5, 0x9B, 0xD4, 0xD2,
+    0x6B, 0x8A, 0xA4, 0x4A, 0x5D, 0x29, 0x1A, 0xE9, 0xFF, 0xA5, 0x2D, 0xF5, 0xEF, 0x7C, 0x37, 0x7E,
+    0xBB, 0xCD, 0xAA, 0xFE, 0x91, 0xBC, 0xF3, 0xA7, 0x60, 0x27, 0xF5, 0xE4, 0x37, 0x9A, 0x05, 0x20,
+    0xFB, 0xF0, 0xFB, 0x99, 0x34, 0x00, 0x67, 0x4E, 0x91, 0xDE, 0xF0, 0xA2, 0x6E, 0x29, 0x73, 0xD4,
+    0xD9, 0x25, 0x20, 0x7B, 0xC7, 0x77, 0xF0, 0xF3, 0xE7, 0x88, 0x79, 0x4B, 0x8E, 0xF4, 0xBA, 0x42,
+    0xD1, 0xC9, 0xA8, 0xE9, 0x4D, 0x58, 0x71, 0x5E, 0xEF, 0x24, 0xB8, 0x01, 0x24, 0x0E, 0xF6, 0xBA,
+    0xD2, 0xF8, 0xDA, 0x42, 0x29, 0x59, 0xE9, 0x26, 0x8B, 0xB7, 0x0B, 0x19, 0x78, 0x52, 0xF2, 0x26,
+    0xED, 0x84, 0x13, 0xE7, 0x41, 0x0C, 0x3F, 0x15, 0xDD, 0x26, 0xE3, 0x36, 0xF3, 0x32, 0x70, 0x95,
+    0x86, 0x31, 0xDA, 0x68, 0x9B, 0x06, 0x11, 0x68, 0x88, 0x94, 0x68, 0xDB, 0x0B, 0xD2, 0x31, 0x91,
+    0xCF, 0xB2, 0x4F, 0xEA, 0xF6, 0x6B, 0x0D, 0x53, 0xAD, 0x1F, 0xF4, 0xA8, 0xA7, 0x7D, 0x5D, 0xC0,
+    0xA8, 0x48, 0x1F, 0x33, 0xA8, 0x67, 0xCC, 0x24, 0x40, 0x11, 0xD4, 0x1F, 0x81, 0xFC, 0x11, 0x63,
+    0x07, 0x03, 0xA7, 0x1A, 0x90, 0x35, 0x03, 0x60, 0xC0, 0xD1, 0xD2, 0xD1, 0xBD, 0x4A, 0x16, 0x02,
+    0xF2, 0x56, 0x0D, 0xC9, 0x0B, 0x01, 0x36, 0x93, 0x23, 0x7D, 0x4A, 0x6E, 0x0A, 0xF1, 0x0F, 0x91,
+    0x46, 0x56, 0x65, 0x12, 0xB4, 0xAD, 0x53, 0x57, 0x26, 0x55, 0x6E, 0x82, 0x72, 0x07, 0xD2, 0x69,
+    0xD5, 0x6C, 0x51, 0x94, 0x55, 0xE0, 0x95, 0xEF, 0x3E, 0x63, 0xE4, 0xB3, 0xFA, 0x0C, 0x69, 0x18,
+    0x38, 0x72, 0xD3, 0xC2, 0xBE, 0x5C, 0xFD, 0xCC, 0x87, 0x80, 0xDC, 0x41, 0xDE, 0x42, 0x9E, 0x5A,
+    0x36, 0xBB, 0x19, 0x78, 0x6F, 0x7D, 0xB0, 0x9D, 0x5B, 0xDC, 0x74, 0xCB, 0xF8, 0xE7, 0x15, 0xA2,
+    0x0A, 0x28, 0xBB, 0xF7, 0xBE, 0x18, 0xF8, 0xD2, 0x4F, 0x54, 0xA8, 0xAA, 0x45, 0xD4, 0xE5, 0x11,
+    0x9F, 0x01, 0xC3, 0x4F, 0x46, 0x3F, 0xAB, 0xC7, 0x46, 0x55, 0xA9, 0x4B, 0x2A, 0x6A, 0x11, 0xC8,
+    0x09, 0x28, 0x57, 0x43, 0x33, 0x81, 0xBC, 0x58, 0xCC, 0xF5, 0xD5, 0x05, 0xD7, 0xF5, 0x16, 0xB5,
+    0x1F, 0x66, 0x4F, 0xC0, 0xE2, 0x10, 0x3B, 0x07, 0xAA, 0xEA, 0x9C, 0x60, 0xF3, 0xC3, 0xF6, 0x63,
+    0x38, 0x3C, 0x2F, 0x62, 0x6C, 0x93, 0x3B, 0x97, 0x5B, 0xE9, 0x92, 0x20, 0x9D, 0xF2, 0x02, 0x6D,
+    0xBA, 0x03, 0xB1, 0x5D, 0xD0, 0x9D, 0xAE, 0x93, 0x67, 0x2F, 0x2D, 0x78, 0xCE, 0xC0, 0x9E, 0x76,
+    0x84, 0x9C, 0xA4, 0x1A, 0xC7, 0xE8, 0x07, 0xF1, 0x48, 0x23, 0x7A, 0xB1, 0xF3, 0x54, 0x91, 0x5A,
+    0x96, 0xCD, 0x99, 0xBA, 0x79, 0x4A, 0xC7, 0x4B, 0x5B, 0x9F, 0x6F, 0x4E, 0x27, 0x15, 0xCA, 0x91,
+    0xC1, 0x08, 0xB1, 0x78, 0xD6, 0x64, 0x63, 0x70, 0xEE, 0x4C, 0x8C, 0x4D, 0x98, 0x85, 0x95, 0x39,
+    0xB0, 0x0F, 0x5C, 0x5B, 0x10, 0x86, 0xBC, 0xF7, 0x51, 0x2A, 0x8B, 0x76, 0x68, 0xDB, 0x31, 0xCE,
+    0xEF, 0x30, 0x3E, 0xE0, 0x38, 0xFB, 0xE8, 0x07, 0x2B, 0xD4, 0xF3, 0x96, 0x64, 0xBE, 0xD0, 0x65,
+    0xDF, 0xFB, 0x99, 0x7C, 0x3B, 0xA8, 0xF8, 0x0E, 0x23, 0x5D, 0x34, 0x9A, 0x6F, 0x04, 0x28, 0x3E,
+    0xB0, 0xB0, 0x19, 0x2E, 0x7C, 0x50, 0x1D, 0x63, 0xD3, 0x5B, 0x72, 0x20, 0xE5, 0x92, 0x11, 0x19,
+    0x2D, 0x79, 0x9C, 0xE5, 0xF7, 0x08, 0x8B, 0x7D, 0x91, 0x54, 0x6F, 0xFD, 0x9E, 0x36, 0x24, 0xCF,
+    0x05, 0x18, 0xB4, 0x20, 0xAE, 0x75, 0x9C, 0xDA, 0x48, 0x06, 0x6D, 0x4F, 0x03, 0x14, 0xE9, 0xF5,
+    0x50, 0xA8, 0xA5, 0x68, 0x91, 0xF9, 0x6C, 0xAA, 0xB5, 0x16, 0x1E, 0x60, 0xF0, 0x6F, 0x66, 0x7F,
+    0xFF, 0x42, 0xCB, 0xB9, 0x2F, 0x7D, 0x63, 0x36, 0x07, 0x78, 0x48, 0x5E, 0xDD, 0x1C, 0xB4, 0xE9,
+    0xEE, 0xD6, 0xCE, 0xD5, 0x8D, 0x35, 0x71, 0x36, 0xB4, 0x7D, 0x6D, 0xCD, 0xC6, 0xBA, 0x8D, 0xCF,
+    0xE8, 0x0F, 0x15, 0xD2, 0x8D, 0x84, 0x03, 0xB1, 0xAB, 0xEB, 0xD3, 0xC5, 0x99, 0xD3, 0xC5, 0x99,
+    0x3C, 0xAC, 0x5B, 0xE0, 0xE2, 0x19, 0xFD, 0xF8, 0x8D, 0x57, 0xEA, 0x69, 0x79, 0x5C, 0x75, 0xF8,
+    0xF3, 0x5E, 0xF9, 0xED, 0x47, 0xFD, 0xEB, 0x3E, 0xF3, 0x49, 0x05, 0x3C, 0xF0, 0xD0, 0x64, 0x7F,
+    0xB4, 0x5D, 0x14, 0xF7, 0x9C, 0x02, 0x36, 0x44, 0x7C, 0xF8, 0x8D, 0xBA, 0xDA, 0xDA, 0x48, 0x80,
+    0xD3, 0xE9, 0x27, 0xAA, 0x52, 0xFA, 0x81, 0xB0, 0xC7, 0x54, 0xD5, 0x94, 0x99, 0x4E, 0xF9, 0x80,
+    0x7E, 0xE6, 0x69, 0x7F, 0xF1, 0xB8, 0x70, 0x77, 0x6D, 0x15, 0xC5, 0xC5, 0x3D, 0xD6, 0xED, 0x48,
+    0x3F, 0x1C, 0xCE, 0xC0, 0xD6, 0xCE, 0xD5, 0x8D, 0x0F, 0x24, 0xCB, 0x88, 0x8E, 0x9D, 0xFD, 0xD1,
+    0x43, 0xB7, 0xEE, 0x19, 0xB8, 0x73, 0xEB, 0x67, 0xAB, 0x49, 0xB1, 0x75, 0x17, 0xC7, 0xEC, 0xD5,
+    0xC4, 0x6F, 0xF7, 0x84, 0x11, 0xF8, 0x42, 0x99, 0x4B, 0x67, 0x5B, 0x38, 0x26, 0xAF, 0x57, 0xFB,
+    0xC5, 0x1A, 0xC0, 0x80, 0x41, 0xD5, 0x2F, 0x4B, 0xF9, 0x7B, 0xB0, 0x41, 0x38, 0x76, 0x30, 0x1A,
+    0xD7, 0xEB, 0x06, 0xF2, 0xF5, 0xD9, 0xF3, 0x3F, 0x3E, 0x38, 0xF7, 0xF5, 0x13, 0xE7, 0x67, 0xF3,
+    0x2F, 0x7D, 0xE3, 0x4D, 0xC1, 0x49, 0x92, 0x4A, 0x04, 0x6A, 0xF6, 0xD9, 0x48, 0xEC, 0x7F, 0xAE,
+    0xAF, 0xB6, 0xF9, 0x5D, 0x82, 0xBB, 0xB4, 0x74, 0xB7, 0x07, 0x0B, 0xBE, 0xBE, 0xC7, 0x42, 0x8A,
+    0x9A, 0x2D, 0xFD, 0xBD, 0xEF, 0xAD, 0x25, 0xE9, 0xC4, 0x70, 0x78, 0x6E, 0x1C, 0x63, 0xF3, 0xAD,
+    0x2B, 0x97, 0xEB, 0x90, 0xB1, 0x57, 0xE5, 0x04, 0xD3, 0xC7, 0x50, 0x2E, 0x8A, 0xE4, 0x4E, 0x74,
+    0xCC, 0x62, 0xA0, 0x49, 0x1A, 0x6A, 0x5A, 0x11, 0x98, 0x8A, 0xC0, 0x28, 0x09, 0x8C, 0x64, 0xC5,
+    0xF4, 0x64, 0x43, 0x33, 0x6B, 0xA9, 0x17, 0xC5, 0xCE, 0xF3, 0x40, 0x66, 0x19, 0x1C, 0x2C, 0xAC,
+    0x80, 0x00, 0xDC, 0xDD, 0x6D, 0x6E, 0xD5, 0x76, 0xD5, 0xE8, 0x63, 0xCB, 0xFD, 0x33, 0x24, 0xC6,
+    0x48, 0x76, 0xF9, 0x1A, 0x19, 0x3D, 0x72, 0xB6, 0xE8, 0x71, 0xFA, 0xA7, 0x68, 0x08, 0xDD, 0x28,
+    0x15, 0x9C, 0xBC, 0xBD, 0x60, 0xDC, 0xC4, 0x17, 0x61, 0x1C, 0xBD, 0x7E, 0x71, 0x66, 0x5B, 0xB6,
+    0xB4, 0x63, 0x6F, 0x44, 0xF2, 0xA8, 0xEF, 0xB2, 0xF8, 0xDA, 0x53, 0x95, 0x8C, 0xD1, 0x68, 0x7B,
+    0x74, 0x5B, 0xAE, 0xAB, 0x8A, 0x42, 0x57, 0x2A, 0xE8, 0x18, 0xCD, 0xF2, 0xE9, 0xC2, 0x9F, 0xAF,
+    0x21, 0x7D, 0xE7, 0x52, 0x2E, 0xA7, 0x53, 0x06, 0x9F, 0xF2, 0xFA, 0xE9, 0xF0, 0x73, 0x4B, 0xDF,
+    0x6F, 0xD6, 0x41, 0xB4, 0x79, 0xAB, 0x16, 0xF2, 0x33, 0xCD, 0xA7, 0x74, 0x5D, 0x1F, 0xA6, 0x0D,
+    0xFD, 0x6B, 0x30, 0x68, 0x96, 0x32, 0xE4, 0x70, 0x38, 0x84, 0x24, 0xC6, 0x39, 0xB0, 0xF3, 0x39,
+    0x0F, 0x14, 0xCA, 0x01, 0x45, 0xEA, 0x80, 0x6D, 0x6D, 0x81, 0x3D, 0x6D, 0xE8, 0x9C, 0x30, 0x88,
+    0x2A, 0x8B, 0x96, 0xC4, 0xE5, 0x57, 0x6A, 0xA4, 0xEB, 0xD3, 0x92, 0x9A, 0x92, 0x11, 0x9A, 0x82,
+    0x82, 0x2D, 0x46, 0x8C, 0x18, 0x31, 0x61, 0xF2, 0x2F, 0x6A, 0x9A, 0x24, 0x0C, 0xAA, 0xF5, 0x38,
+    0x73, 0x03, 0x93, 0x1D, 0xDA, 0x6F, 0x86, 0xE7, 0xD6, 0x86, 0x10, 0xEB, 0x7C, 0x0E, 0x99, 0x55,
+    0x15, 0x64, 0x48, 0x07, 0x39, 0xCA, 0x41, 0x8F, 0xD4, 0x41, 0xB9, 0xD0, 0xE4, 0xB4, 0x81, 0x71,
+    0x8C, 0xD1, 0x32, 0x8B, 0xF1, 0x4A, 0x4D, 0x43, 0x8F, 0x96, 0x9A, 0x3E, 0x25, 0x81, 0x92, 0x52,
+    0x04, 0x0A, 0x8A, 0x24, 0x30, 0x62, 0x2A, 0x2B, 0x26, 0xA2, 0x3E, 0xD9, 0x24, 0x71, 0xE6, 0xC7,
+    0xAD, 0x8E, 0x07, 0x87, 0x2E, 0xC9, 0x7F, 0x62, 0x0B, 0x9C, 0x80, 0x9D, 0x18, 0x98, 0xDD, 0x6A,
+    0x68, 0x69, 0xA9, 0x99, 0x8A, 0xC0, 0x44, 0x04, 0x9A, 0x24, 0x50, 0xCB, 0x4A, 0x84, 0x93, 0x8D,
+    0xBA, 0x3D, 0x6B, 0xB3, 0xF9, 0x52, 0x98, 0xB9, 0xB4, 0xD0, 0x65, 0xC4, 0xFC, 0x88, 0x2C, 0xB3,
+    0x36, 0xE4, 0x23, 0x0C, 0x0E, 0x92, 0x03, 0x32, 0x3B, 0x08, 0x8C, 0x92, 0x8A, 0x24, 0xF4, 0x20,
+    0x7D, 0x38, 0x40, 0xA9, 0x81, 0x7A, 0x0F, 0xD4, 0xCB, 0x16, 0xF2, 0x19, 0xD0, 0x94, 0x20, 0xFD,
+    0x14, 0xB4, 0xA8, 0x61, 0x24, 0x03, 0x49, 0x50, 0x1E, 0x6D, 0xB5, 0x13, 0xB3, 0xDD, 0xCC, 0x65,
+    0xD1, 0xE6, 0x8E, 0x23, 0x16, 0x7B, 0x02, 0xCB, 0x07, 0xC6, 0xE8, 0xD4, 0xFE, 0x8F, 0xF1, 0x8F,
+    0x7B, 0x6C, 0xB4, 0x23, 0x47, 0x36, 0x24, 0x15, 0xD1, 0x50, 0x52, 0x06, 0xA4, 0xD7, 0x19, 0x8C,
+    0xE4, 0xD3, 0x81, 0xF4, 0x7A, 0xE8, 0x43, 0xB3, 0x2D, 0x3D, 0xFA, 0xD7, 0x19, 0xC1, 0x1B, 0x36,
+    0x75, 0x64, 0x15, 0x13, 0x92, 0xFA, 0x6D, 0xAD, 0x29, 0x9D, 0xFF, 0x5C, 0x1A, 0xB4, 0x79, 0x08,
+    0x9A, 0x1E, 0xA8, 0x68, 0x57, 0x46, 0x4F, 0x86, 0xE7, 0xD6, 0x86, 0x79, 0x4C, 0x62, 0x35, 0x36,
+    0xAA, 0x4A, 0x02, 0x23, 0x32, 0xB4, 0xA1, 0x16, 0x15, 0xDA, 0x16, 0x30, 0x4D, 0x0D, 0xEA, 0x7A,
+    0x05, 0x65, 0x01, 0xC9, 0x2D, 0xB3, 0xD0, 0xB4, 0xDA, 0x05, 0x24, 0x13, 0x15, 0xDC, 0x37, 0x02,
+    0x19, 0x81, 0x81, 0x3D, 0xBC, 0xAF, 0xB5, 0x21, 0x83, 0x03, 0xF5, 0xAE, 0x8D, 0x07, 0x3D, 0x18,
+    0xA1, 0xCD, 0x51, 0xE3, 0x41, 0x8C, 0x73, 0x93, 0xC5, 0x18, 0x43, 0x57, 0x31, 0x3A, 0x5A, 0xA3,
+    0x83, 0xA2, 0x55, 0x47, 0x4D, 0x1C, 0x52, 0x9A, 0xC2, 0x75, 0xFF, 0x98, 0x1C, 0xEE, 0x5D, 0x59,
+    0x11, 0xD3, 0x2B, 0x6E, 0x3F, 0x53, 0x76, 0x54, 0xC8, 0xE7, 0xAA, 0xAB, 0xE9, 0x15, 0x37, 0xB8,
+    0x49, 0x8D, 0xF4, 0x42, 0xBB, 0x51, 0x16, 0xFD, 0xC2, 0x87, 0xB8, 0x41, 0x12, 0xE1, 0xCB, 0x0E,
+    0x11, 0x38, 0x36, 0x9F, 0xCA, 0x38, 0x5F, 0xB0, 0x59, 0x89, 0xBF, 0xCA, 0x2B, 0xD1, 0x95, 0xAF,
+    0xD5, 0x59, 0xD5, 0x4F, 0x83, 0x7E, 0x24, 0x48, 0xDF, 0x50, 0x17, 0x94, 0x19, 0x59, 0x6A, 0xD3,
+    0x1B, 0x5E, 0x56, 0x81, 0xCE, 0x9B, 0x52, 0x40, 0x8F, 0x53, 0x19, 0x69, 0x84, 0x6F, 0x1E, 0x7A,
+    0xF4, 0xE9, 0x3C, 0xFA, 0x1F, 0x5F, 0x51, 0xEF, 0x79, 0xB4, 0x3E, 0x87, 0x11, 0xCA, 0x73, 0x95,
+    0xCC, 0x26, 0x81, 0x1C, 0x82, 0x38, 0xEB, 0x37, 0xF5, 0x1B, 0x41, 0x1F, 0xAC, 0x48, 0x7A, 0x93,
+    0xC7, 0xA4, 0xBA, 0x6F, 0x13, 0x02, 0xEA, 0x2F, 0x77, 0xF3, 0x68, 0xEB, 0x6E, 0x62, 0x96, 0xEE,
+    0xCF, 0x65, 0x49, 0xFF, 0x19, 0x88, 0xB6, 0x9F, 0x6E, 0x4D, 0xB1, 0xB0, 0x26, 0x1E, 0xAC, 0xAF,
+    0xE6, 0xA9, 0x33, 0x1B, 0xCB, 0xC6, 0xA9, 0x5D, 0xA9, 0xAF, 0x35, 0x19, 0x49, 0xA0, 0x44, 0x5E,
+    0x67, 0x14, 0xD2, 0x96, 0x9D, 0x43, 0x98, 0xD3, 0xA9, 0xAE, 0xA3, 0x37, 0x39, 0x3E, 0x48, 0x5B,
+    0xC8, 0x3A, 0x6B, 0xCE, 0x9B, 0x4A, 0xA5, 0x5D, 0xD2, 0xC8, 0x0B, 0xFD, 0xC6, 0xA0, 0x1C, 0xD2,
+    0xF3, 0x83, 0xC0, 0x38, 0x90, 0x1E, 0x76, 0x9B, 0x33, 0x0F, 0x3A, 0x02, 0x61, 0x1B, 0xD4, 0x83,
+    0x1E, 0x4E, 0x6B, 0xA0, 0xEA, 0x3F, 0x89, 0xFA, 0x44, 0x6C, 0x29, 0x52, 0x53, 0x53, 0x15, 0x49,
+    0x95, 0x9A, 0x90, 0xFE, 0xEB, 0x91, 0xF4, 0xC5, 0xC0, 0xA7, 0x7F, 0xED, 0x0F, 0x48, 0x0F, 0x96,
+    0x8D, 0xDF, 0x29, 0x66, 0xAE, 0x44, 0xB9, 0x82, 0xD4, 0x16, 0x68, 0xB3, 0x8D, 0x1E, 0x7E, 0xEB,
+    0xEB, 0x3A, 0xC6, 0x83, 0x6C, 0x18, 0xF2, 0x9E, 0x08, 0xBA, 0x14, 0x55, 0x56, 0x88, 0xB0, 0x35,
+    0xE2, 0xF6, 0x74, 0xD2, 0xE9, 0x50, 0x3F, 0x69, 0xEC, 0x9A, 0x32, 0x88, 0x55, 0x67, 0xEC, 0x82,
+    0xC4, 0x8F, 0xD1, 0xE9, 0x9C, 0xA2, 0x9E, 0x88, 0x5B, 0xD2, 0xA7, 0xB5, 0x26, 0xB7, 0x05, 0x6D,
+    0x52, 0x49, 0xBF, 0x30, 0x76, 0x89, 0x37, 0x1B, 0xBB, 0x16, 0xD2, 0xA6, 0x76, 0xA4, 0x0E, 0xE5,
+    0x58, 0x3D, 0x8F, 0x7F, 0xC1, 0xE6, 0x79, 0x18, 0xB8, 0xED, 0xF2, 0x0B, 0x5B, 0x05, 0xFA, 0x34,
+    0xF2, 0x6F, 0xE0, 0x65, 0xC3, 0xA5, 0x40, 0xAF, 0x44, 0x2B, 0x77, 0xD6, 0xD5, 0x2F, 0x84, 0x3C,
+    0x2C, 0xFD, 0x11, 0x5D, 0x8A, 0xD3, 0x67, 0xF5, 0x74, 0xE0, 0xBD, 0xBC, 0xDB, 0x06, 0x1C, 0xB8,
+    0x0B, 0xE1, 0x4E, 0x21, 0xDD, 0x19, 0xE4, 0x8B, 0x01, 0x11, 0xED, 0xFB, 0xD1, 0x5B, 0xBD, 0x83,
+    0xC0, 0xFE, 0xB6, 0x0F, 0x4F, 0x74, 0x5E, 0xC8, 0x4E, 0x1B, 0x3D, 0x06, 0xDC, 0xFF, 0x24, 0x22,
+    0x56, 0x4B, 0x29, 0x3F, 0x8F, 0xB1, 0x9A, 0xCF, 0x67, 0x8F, 0x3E, 0x1C, 0xEE, 0xBD, 0x27, 0xB5,
+    0x7B, 0x1B, 0x0B, 0xDA, 0x50, 0xC5, 0x27, 0xC8, 0x62, 0xC3, 0x24, 0xA9, 0x65, 0x25, 0x83, 0x36,
+    0xA9, 0x1B, 0xD1, 0x13, 0x81, 0x3A, 0xB5, 0xFA, 0xE1, 0xD9, 0xAD, 0x46, 0xC7, 0x23, 0x4F, 0xF5,
+    0x54, 0x39, 0x69, 0x3B, 0xAE, 0xD8, 0x3C, 0x33, 0x21, 0x9D, 0x6C, 0x21, 0x5B, 0x0D, 0xAD, 0x7C,
+    0xC9, 0xF6, 0x45, 0x6C, 0x33, 0xF6, 0xF5, 0xA7, 0x6C, 0x99, 0x7C, 0xDF, 0x6B, 0xF6, 0x83, 0xF4,
+    0xC5, 0x88, 0xAB, 0x97, 0x7A, 0xAB, 0x94, 0xE2, 0x8B, 0xA0, 0x62, 0x83, 0x7E, 0xF1, 0x82, 0xD3,
+    0x4E, 0x34, 0xDA, 0x91, 0x2B, 0x87, 0xFA, 0x6E, 0x05, 0xAF, 0x05, 0x28, 0xAF, 0x5D, 0xBE, 0x7C,
+    0x65, 0x1C, 0x63, 0x7C, 0x76, 0x21, 0x26, 0x36, 0x0D, 0x8C, 0x06, 0xD0, 0x57, 0x9E, 0x9C, 0x03,
+    0xC6, 0xE8, 0x3B, 0x73, 0x98, 0x1D, 0xF1, 0xED, 0x5E, 0xA8, 0x92, 0x79, 0x9B, 0xBA, 0x32, 0xA3,
+    0x57, 0x90, 0x8D, 0xE8, 0xCD, 0xE2, 0xBC, 0xA6, 0x0C, 0x8C, 0x6A, 0xEA, 0x49, 0x12, 0x06, 0x57,
+    0x6C, 0x27, 0x63, 0x9D, 0x38, 0xCF, 0xFA, 0x57, 0xA2, 0x93, 0x6D, 0xBE, 0xCB, 0xCC, 0x35, 0x64,
+    0x68, 0x2B, 0x3D, 0x53, 0x46, 0xA4, 0x4E, 0xC3, 0x48, 0x54, 0x28, 0x57, 0x40, 0xA9, 0x2C, 0xD2,
+    0x07, 0x28, 0x8F, 0x43, 0xF2, 0xB7, 0x0E, 0x36, 0xCF, 0x80, 0x78, 0x83, 0x8E, 0x79, 0xEE, 0xEA,
+    0xB8, 0x3D, 0xB2, 0x5D, 0x2F, 0x20, 0x6F, 0xB5, 0x0C, 0x5C, 0x2D, 0x5F, 0x94, 0xBE, 0x87, 0x36,
+    0x15, 0x5B, 0x1A, 0xF6, 0x2F, 0x92, 0x7C, 0xD7, 0x92, 0xFE, 0x57, 0xE8, 0x79, 0xD8, 0xE9, 0x20,
+    0x8A, 0xB2, 0x6F, 0xA6, 0x1C, 0xEC, 0x3D, 0x40, 0x21, 0x1C, 0xC8, 0x6A, 0x02, 0x64, 0x73, 0x8E,
+    0x38, 0x9D, 0x59, 0x1B, 0x9A, 0x13, 0xE7, 0x89, 0xB5, 0x8A, 0x5E, 0x34, 0xA4, 0x9E, 0x0C, 0x5A,
+    0x92, 0xC0, 0xC0, 0xD2, 0x43, 0xD7, 0x48, 0x2F, 0x9F, 0x87, 0x92, 0x57, 0x02, 0xCA, 0x15, 0x39,
+    0x4C, 0x33, 0x59, 0xA1, 0x1F, 0xB3, 0x25, 0xBC, 0x56, 0x29, 0x87, 0x9E, 0x30, 0x45, 0xCC, 0x49,
+    0x2D, 0xB9, 0xE9, 0xFA, 0x5B, 0x6D, 0xC4, 0xCC, 0xAA, 0x39, 0xE3, 0x83, 0xA4, 0xE3, 0x31, 0xFB,
+    0x2C, 0x8C, 0x5B, 0x0B, 0x51, 0x7F, 0xAB, 0x93, 0xDB, 0x8F, 0x3C, 0x9F, 0x92, 0xD8, 0xFB, 0x18,
+    0x29, 0xA3, 0xFE, 0xAA, 0x62, 0xF5, 0x8C, 0xC1, 0xDB, 0x90, 0x87, 0x94, 0x04, 0xE9, 0x36, 0x57,
+    0xE4, 0xE1, 0xBF, 0xF3, 0xAF, 0xFF, 0xF1, 0xA0, 0x1D, 0x3F, 0x37, 0x97, 0x6D, 0x47, 0x30, 0xED,
+    0xC1, 0xF1, 0x2E, 0xD5, 0x37, 0xDE, 0x6A, 0x3A, 0x11, 0xB3, 0x27, 0xD1, 0x31, 0xAC, 0xCC, 0x41,
+    0xE3, 0x68, 0x92, 0x3B, 0x33, 0xAB, 0x6D, 0x6E, 0x4A, 0xFA, 0x04, 0x26, 0xCA, 0xC9, 0x2A, 0x47,
+    0x9B, 0x86, 0xE6, 0xE4, 0x7C, 0xF6, 0x70, 0x5C, 0xA0, 0xDD, 0xF5, 0x3D, 0xC6, 0x4B, 0x7B, 0x9F,
+    0x27, 0x36, 0xEB, 0xF3, 0xDD, 0xEE, 0x7F, 0x0D, 0x50, 0x20, 0xDE, 0x68, 0xD3, 0x97, 0xDA, 0x92,
+    0x10, 0xE4, 0x77, 0x9D, 0xD6, 0x4C, 0xF2, 0xCF, 0xBB, 0x41, 0xB3, 0x78, 0x1A, 0x06, 0x11, 0x63,
+    0x25, 0xBE, 0xF6, 0x60, 0x43, 0xC6, 0x88, 0x9C, 0x92, 0x1E, 0x05, 0xE5, 0xC6, 0x88, 0xE2, 0x4C,
+    0xC3, 0x28, 0x0F, 0x5C, 0x9D, 0x59, 0x62, 0x84, 0x5A, 0x5A, 0x42, 0xE2, 0x7E, 0x02, 0xB2, 0xC7,
+    0xE5, 0xE3, 0x78, 0x2A, 0x24, 0xF3, 0xBC, 0x65, 0x73, 0x7B, 0x4A, 0xCF, 0x97, 0x0C, 0x6C, 0xC9,
+    0x80, 0x82, 0x72, 0x89, 0x0F, 0xF7, 0x6A, 0xEA, 0xDF, 0xAE, 0xA8, 0x07, 0x4E, 0xC4, 0x19, 0xC9,
+    0xCB, 0x91, 0xC4, 0xA7, 0x48, 0x27, 0x8D, 0x74, 0x5D, 0x4E, 0xE4, 0x07, 0x70, 0xFF, 0x37, 0x0E,
+    0x0D, 0x31, 0x1E, 0xD8, 0x17, 0xC3, 0xE1, 0x88, 0x18, 0xE7, 0xA8, 0x97, 0x2E, 0x9B, 0x77, 0xE9,
+    0xC9, 0xBB, 0x70, 0xF3, 0x30, 0xD0, 0xEE, 0xE3, 0x00, 0x45, 0x32, 0x3B, 0x10, 0xB1, 0x59, 0x6A,
+    0x94, 0xDB, 0xB0, 0xD5, 0x69, 0x94, 0xDD, 0xC7, 0xDB, 0xB0, 0x45, 0xF2, 0x72, 0xD7, 0xA7, 0xFD,
+    0x0C, 0xFD, 0xCD, 0xDA, 0xD5, 0xF3, 0x64, 0xB1, 0xFD, 0xE9, 0xFD, 0x0D, 0xAC, 0xCF, 0x99, 0xCD,
+    0xA5, 0x1D, 0xDD, 0x25, 0xC2, 0xDD, 0xDA, 0xF4, 0x6B, 0xC6, 0xA4, 0x7F, 0xCF, 0xF4, 0x83, 0xD2,
+    0xAF, 0x69, 0xB3, 0x3D, 0x78, 0xD9, 0x0D, 0xEA, 0x25, 0x23, 0x41, 0x8C, 0x07, 0x64, 0x97, 0xA7,
+    0x64, 0x14, 0xE4, 0x9C, 0xA1, 0xC7, 0xC6, 0xAA, 0x03, 0xD8, 0x89, 0x9E, 0x59, 0xAC, 0x69, 0x44,
+    0x4B, 0xCD, 0x94, 0xC0, 0xE8, 0x2D, 0x9D, 0xDC, 0x64, 0x7C, 0x70, 0xA4, 0x93, 0xFB, 0x58, 0x66,
+    0x19, 0xCC, 0x57, 0x9D, 0xDC, 0x20, 0x36, 0x83, 0x58, 0x2B, 0xB7, 0x97, 0xDA, 0x2F, 0x68, 0x83,
+    0x06, 0x7D, 0xA1, 0xCA, 0x62, 0x93, 0x9B, 0xB6, 0xA4, 0x2C, 0x28, 0x0B, 0xCA, 0xED, 0xD5, 0x43,
+    0x63, 0x22, 0x1C, 0x53, 0x5E, 0x47, 0xA3, 0x6E, 0xF2, 0xFF, 0x01, 0xBD, 0x9B, 0x7F, 0x8C, 0x1D,
+    0xD7, 0x75, 0xDF, 0x3F, 0x77, 0x2E, 0xC9, 0x91, 0x34, 0x12, 0x2F, 0x51, 0x90, 0x89, 0x6D, 0x6A,
+    0x77, 0xF4, 0x87, 0x82, 0x2A, 0xEE, 0xEE, 0x1B, 0xFF, 0xA1, 0xA6, 0x1B, 0x74, 0xDE, 0xBE, 0x6B,
+    0x31, 0xAD, 0x0A, 0x08, 0xAD, 0x36, 0x08, 0x9F, 0x1D, 0x54, 0x70, 0xEC, 0x02, 0x41, 0x91, 0xC4,
+    0x40, 0xC8, 0xA2, 0x4C, 0xB2, 0x4D, 0x1E, 0xF9, 0x46, 0x66, 0x5B, 0x21, 0x30, 0x50, 0xB1, 0x49,
+    0x9C, 0xFE, 0x95, 0x94, 0x45, 0x85, 0xC0, 0x59, 0xA5, 0xE5, 0xC6, 0x5D, 0x37, 0xCF, 0xCD, 0x23,
+    0xDF, 0xA5, 0xF8, 0x87, 0x80, 0x08, 0xB0, 0x2F, 0xC5, 0xBA, 0xF9, 0x43, 0x70, 0x35, 0xFA, 0x15,
+    0x27, 0x22, 0x62, 0x5D, 0x45, 0x23, 0x6B, 0x28, 0xCE, 0x7B, 0xA7, 0x7F, 0xCC, 0x7B, 0xCB, 0xA5,
+    0xEC, 0xD8, 0x56, 0x62, 0x77, 0xDE, 0xEE, 0xDB, 0x99, 0x7D, 0x33, 0xF7, 0x9D, 0x7B, 0xEE, 0xB9,
+    0xE7, 0x7C, 0xCF, 0x2F, 0x1E, 0xE0, 0xC8, 0x86, 0x3A, 0xAF, 0xA7, 0x5A, 0x5C, 0xCF, 0x25, 0x8D,
+    0xAA, 0xB4, 0xC0, 0x8E, 0x76, 0xEB, 0x40, 0x48, 0x23, 0x0F, 0x91, 0x1B, 0x2D, 0x03, 0xFA, 0xAC,
+    0x0F, 0x40, 0x62, 0x0C, 0x40, 0xEF, 0x52, 0x05, 0xE8, 0x9B, 0x37, 0x4B, 0x20, 0x4B, 0x9E, 0x70,
+    0xA0, 0xAA, 0xAE, 0x29, 0x20, 0x2D, 0x42, 0x0A, 0x34, 0xB1, 0x5B, 0x07, 0xE3, 0x3A, 0x8C, 0x61,
+    0xCA, 0x0E, 0x0D, 0xA9, 0x4F, 0xAA, 0xA8, 0x51, 0x53, 0x24, 0x44, 0x53, 0x00, 0x54, 0x05, 0x40,
+    0xEC, 0x00, 0x58, 0x06, 0x80, 0x6D, 0x00, 0xA2, 0x82, 0xBD, 0x47, 0xEA, 0xEE, 0xE5, 0x52, 0x2C,
+    0xDA, 0xF5, 0x42, 0x19, 0x06, 0xE6, 0x1F, 0xDD, 0x91, 0x98, 0xCF, 0x38, 0xF8, 0x9F, 0xD5, 0x08,
+    0x92, 0x3F, 0x4E, 0x81, 0xF1, 0x5B, 0x25, 0x98, 0x7F, 0xF6, 0x7F, 0x41, 0xBD, 0x74, 0xA3, 0x84,
+    0xB5, 0x6C, 0x59, 0xFD, 0x5B, 0xA3, 0x7D, 0xD8, 0x14, 0x97, 0x1B, 0x79, 0x24, 0xC4, 0x76, 0x78,
+    0x12, 0x20, 0xB6, 0x00, 0x3B, 0x00, 0x89, 0x05, 0xA2, 0x12, 0xE0, 0x7E, 0xF8, 0xA1, 0x73, 0x4C,
+    0xC4, 0xAE, 0x7F, 0x3C, 0x18, 0xBA, 0xB1, 0x35, 0xB6, 0xD0, 0x0E, 0x15, 0x50, 0x81, 0x4F, 0x57,
+    0x64, 0x33, 0x48, 0x3C, 0x34, 0x90, 0xDD, 0x81, 0xF9, 0xAC, 0x8D, 0xAF, 0x85, 0x38, 0x0C, 0xDF,
+    0x08, 0xB1, 0x78, 0x22, 0x07, 0x27, 0x61, 0x05, 0x3D, 0x83, 0xD9, 0x82, 0xE6, 0x68, 0xC6, 0x70,
+    0xA2, 0x8B, 0xEE, 0x3E, 0x02, 0x71, 0xB1, 0x7F, 0x44, 0xAF, 0x24, 0x2E, 0x49, 0x9E, 0x21, 0xCB,
+    0x55, 0x35, 0xBB, 0x50, 0xC8, 0xAB, 0x24, 0xB0, 0xC2, 0xE1, 0xC0, 0xC4, 0x72, 0x1E, 0xE8, 0x6F,
+    0xA8, 0xF3, 0x5A, 0x7C, 0xE6, 0x55, 0xAD, 0x85, 0xD8, 0x75, 0x20, 0x8B, 0x4A, 0x18, 0xA5, 0xA0,
+    0x7D, 0x00, 0xF3, 0x08, 0x70, 0xA6, 0x86, 0xE8, 0x66, 0x00, 0x73, 0xD6, 0x43, 0x37, 0x71, 0x10,
+    0x52, 0x88, 0x5D, 0x0F, 0x32, 0x4E, 0x43, 0x4D, 0xC3, 0xD1, 0x1B, 0x6A, 0xAA, 0xA4, 0x8E, 0xA6,
+    0x0B, 0x3E, 0xC7, 0x6E, 0xC1, 0xE3, 0x6D, 0x20, 0x72, 0x0B, 0x32, 0x8F, 0x96, 0xC9, 0x73, 0x8D,
+    0x09, 0xCB, 0xE6, 0xA7, 0x93, 0x47, 0xD1, 0xCF, 0xC1, 0x3B, 0x96, 0x9E, 0x27, 0x1D, 0x93, 0x3C,
+    0x89, 0x7E, 0x26, 0xDC, 0x17, 0xBA, 0x2B, 0x83, 0x44, 0x56, 0x99, 0x39, 0x08, 0x90, 0x83, 0x81,
+    0xD4, 0x72, 0xC0, 0xD2, 0xDF, 0xE0, 0x47, 0x91, 0x4A, 0x09, 0xA9, 0x8D, 0x67, 0xA4, 0x18, 0xC8,
+    0xC8, 0xA1, 0x73, 0x72, 0x1B, 0xBA, 0x7F, 0xE8, 0x21, 0x7F, 0xA5, 0x80, 0x33, 0x02, 0x5C, 0x12,
+    0xE0, 0xC6, 0x73, 0x05, 0x7C, 0xF3, 0x8A, 0x83, 0xBF, 0x3A, 0x5B, 0xA2, 0x82, 0x0A, 0x44, 0x25,
+    0x0D, 0xDA, 0x73, 0x9A, 0xA3, 0x37, 0xE8, 0xD9, 0xE1, 0x0C, 0xB3, 0x4B, 0xDC, 0x81, 0x9A, 0x33,
+    0x13, 0x97, 0x96, 0x9B, 0xFA, 0xAB, 0xC9, 0x46, 0xE0, 0x9D, 0x15, 0xCC, 0xAF, 0x80, 0x04, 0x96,
+    0x9F, 0xB6, 0xD1, 0xD7, 0x72, 0xF2, 0x63, 0x5E, 0xBB, 0xF4, 0x9E, 0x01, 0xF2, 0x9C, 0xD5, 0x01,
+    0xBE, 0x2D, 0x0F, 0xA3, 0xC9, 0x6F, 0x94, 0x18, 0xF9, 0xE4, 0x77, 0xE5, 0xA1, 0xFD, 0x56, 0x1E,
+    0x36, 0x4A, 0xEA, 0xA8, 0x99, 0x13, 0x53, 0x92, 0x34, 0xB0, 0x0C, 0x71, 0x41, 0xE4, 0x31, 0xB3,
+    0xE4, 0x99, 0x4B, 0x8F, 0x84, 0x65, 0xF3, 0xD3, 0xC9, 0x23, 0x7B, 0x39, 0x37, 0x20, 0x79, 0xD2,
+    0xEA, 0xCB, 0xE1, 0x50, 0xE8, 0xAE, 0x0D, 0xE2, 0x66, 0x95, 0x8B, 0x00, 0x47, 0xFA, 0x1B, 0xEA,
+    0xBF, 0x88, 0xF8, 0xEC, 0x85, 0xAD, 0x5A, 0x4B, 0x1E, 0xBB, 0x0E, 0x21, 0x8B, 0xCA, 0xC8, 0x7E,
+    0x0F, 0x8B, 0xFB, 0x5D, 0x08, 0x03, 0xC8, 0x6A, 0xFD, 0xB2, 0x94, 0xC3, 0x2F, 0xC7, 0x0F, 0x7F,
+    0x35, 0x5F, 0xC9, 0xD9, 0x78, 0xCB, 0xA1, 0xFF, 0x00, 0x96, 0x2B, 0xB8, 0x54, 0xA2, 0xAF, 0x39,
+    0x4C, 0x52, 0x30, 0x30, 0xFF, 0x34, 0x2A, 0xB3, 0x60, 0x6C, 0xAF, 0x7D, 0xAA, 0x7F, 0x5C, 0xF5,
+    0xAD, 0x11, 0x3B, 0x9C, 0x92, 0x16, 0x5C, 0x44, 0x05, 0x12, 0x47, 0x06, 0x35, 0x51, 0x89, 0xB1,
+    0x74, 0x21, 0xA0, 0x3D, 0x29, 0x0C, 0x45, 0x02, 0x89, 0xC8, 0x0C, 0x6A, 0xB4, 0xC7, 0x58, 0x06,
+    0x10, 0x48, 0x1C, 0x29, 0x8C, 0x88, 0x02, 0xC6, 0xB2, 0x0E, 0x15, 0x47, 0x6B, 0x86, 0xAF, 0xC6,
+    0xE2, 0x33, 0x29, 0x00, 0x2A, 0x00, 0x03, 0xA0, 0x4A, 0x80, 0x25, 0x00, 0x35, 0x5F, 0xE4, 0xCC,
+    0xC5, 0x8F, 0x34, 0x54, 0xB1, 0x33, 0x8C, 0x08, 0xC6, 0xA6, 0xBC, 0xFD, 0xB1, 0xD2, 0xC8, 0x54,
+    0xBD, 0xFD, 0x71, 0xD7, 0x61, 0xA0, 0x7D, 0xF2, 0xEF, 0x72, 0xBE, 0xF8, 0x75, 0x67, 0x9A, 0x11,
+    0x17, 0x1D, 0xAC, 0x40, 0xE4, 0x21, 0x87, 0xA4, 0x80, 0x73, 0xF4, 0x8F, 0xAB, 0x7E, 0x9F, 0xDE,
+    0x54, 0x89, 0x94, 0xAA, 0x26, 0x79, 0xBD, 0x62, 0x40, 0x14, 0x56, 0xC9, 0xA0, 0x4E, 0x48, 0x0A,
+    0xBA, 0x91, 0xD5, 0x1E, 0x03, 0x54, 0xC4, 0x6E, 0x3E, 0x11, 0x32, 0x91, 0x1A, 0x4C, 0x41, 0x97,
+    0xF9, 0x04, 0xDB, 0xB9, 0x30, 0x20, 0x2A, 0x21, 0x83, 0x6A, 0xF1, 0xF1, 0xD1, 0x9A, 0xE1, 0x39,
+    0x52, 0xB1, 0x93, 0x06, 0x32, 0x17, 0xCF, 0x4E, 0x04, 0x2D, 0x61, 0x40, 0xC8, 0x3B, 0xE4, 0x5D,
+    0x63, 0xD3, 0x3B, 0xF5, 0x57, 0x1F, 0x2B, 0x10, 0xF1, 0x9C, 0xEE, 0x07, 0x3A, 0x0C, 0x30, 0xB6,
+    0x83, 0x76, 0xC9, 0xEF, 0xA8, 0xA0, 0x67, 0x8C, 0xB8, 0x34, 0x5F, 0xA5, 0x7E, 0xBF, 0xDF, 0x07,
+    0x23, 0x22, 0x01, 0xD2, 0xAD, 0xA7, 0x03, 0xA8, 0x40, 0x17, 0xC8, 0xD0, 0x0E, 0xA2, 0x92, 0x01,
+    0xD0, 0x25, 0x71, 0xA0, 0x1D, 0x35, 0x30, 0xC0, 0x7C, 0x72, 0x4A, 0xE2, 0x10, 0xA9, 0xA8, 0x49,
+    0x8B, 0xD4, 0x19, 0x1B, 0x95, 0x8C, 0x09, 0xAC, 0x13, 0xFB, 0x14, 0xED, 0xE9, 0x46, 0x81, 0x01,
+    0xB1, 0x5B, 0x27, 0x71, 0x0C, 0x8E, 0xD6, 0xD1, 0xCC, 0x26, 0xCF, 0x8A, 0x93, 0x9A, 0xBA, 0x55,
+    0xA0, 0x00, 0x68, 0x0F, 0x44, 0x8F, 0xD7, 0x00, 0xBD, 0xD9, 0x5C, 0x49, 0xED, 0x3D, 0x4E, 0x14,
+    0x97, 0x60, 0x72, 0x45, 0x20, 0x7E, 0xF2, 0x51, 0x4B, 0x32, 0x36, 0x60, 0x42, 0x0A, 0xC6, 0x67,
+    0x13, 0x6F, 0x8A, 0x4C, 0xAA, 0x94, 0x75, 0xD5, 0x74, 0xC8, 0x19, 0x77, 0x19, 0x30, 0xC8, 0x19,
+    0x31, 0x18, 0x50, 0x31, 0x18, 0x11, 0x18, 0x00, 0x8C, 0x00, 0xC2, 0x5C, 0xB5, 0xDE, 0x93, 0x38,
+    0x48, 0x67, 0x40, 0x52, 0x82, 0xFA, 0x3C, 0x30, 0x39, 0x0F, 0xA9, 0x3F, 0xEA, 0x55, 0x1D, 0xDD,
+    0x2C, 0x4D, 0xB1, 0x1E, 0xFB, 0xB1, 0x0A, 0xE6, 0xAC, 0x37, 0x76, 0x3D, 0x65, 0x40, 0xDD, 0x44,
+    0x41, 0xBF, 0x52, 0x26, 0xCE, 0x3C, 0x5A, 0xAC, 0x33, 0x5E, 0x67, 0xAC, 0xCB, 0x26, 0x0A, 0x69,
+    0x14, 0x62, 0x57, 0xE9, 0xD2, 0x3C, 0x59, 0x24, 0xA5, 0xA9, 0x49, 0xDE, 0x9D, 0xF8, 0x4F, 0xC5,
+    0x72, 0x5D, 0x2C, 0x60, 0x5B, 0x7B, 0x32, 0x83, 0xF5, 0xB8, 0xD2, 0xFE, 0x4B, 0x55, 0x27, 0x7E,
+    0xBC, 0x0C, 0xDD, 0xF8, 0xB9, 0x22, 0xA4, 0xDD, 0xD8, 0x8D, 0xAA, 0x54, 0x5F, 0xF1, 0x83, 0x65,
+    0x53, 0x84, 0x90, 0x46, 0x6F, 0xD8, 0xDE, 0x7F, 0xAA, 0x0E, 0x65, 0xB3, 0x56, 0x38, 0x51, 0x3F,
+    0x0F, 0x43, 0xF1, 0xE6, 0xB5, 0x49, 0xD1, 0xB0, 0x6A, 0x1C, 0xDB, 0x03, 0xA2, 0xB3, 0x65, 0xCB,
+    0xB3, 0x31, 0xE8, 0x12, 0x4C, 0x01, 0xEB, 0x40, 0x03, 0x51, 0x80, 0xB8, 0xE4, 0x6E, 0x53, 0x1D,
+    0x08, 0x46, 0x84, 0x44, 0x3C, 0x04, 0xD0, 0x0E, 0x0E, 0x42, 0x1A, 0x60, 0x68, 0x17, 0xFC, 0x8C,
+    0x9B, 0x48, 0xFC, 0xE8, 0x03, 0xCB, 0x68, 0xC7, 0x80, 0xA4, 0xA0, 0xC2, 0x58, 0x6A, 0x1E, 0x71,
+    0x9B, 0x43, 0x89, 0xC4, 0x52, 0x72, 0x90, 0x43, 0xA5, 0x6E, 0xF8, 0x10, 0x1C, 0xE9, 0xF7, 0x7F,
+    0x52, 0x44, 0xAE, 0x6F, 0xCD, 0x2E, 0x0C, 0xB4, 0x5F, 0x09, 0x29, 0x5F, 0xB0, 0xE3, 0xC8, 0x46,
+    0x25, 0x18, 0x0B, 0x39, 0xA8, 0x00, 0x89, 0x6B, 0x49, 0xA9, 0xDA, 0xAF, 0x9C, 0x13, 0x79, 0x74,
+    0x86, 0x92, 0x69, 0x7B, 0x47, 0xEC, 0x60, 0xB5, 0xD5, 0xF3, 0x7B, 0xCD, 0xE8, 0xD1, 0x32, 0xB3,
+    0x97, 0x92, 0xA6, 0x17, 0xC4, 0x2D, 0x77, 0x07, 0x6F, 0x87, 0x64, 0xBC, 0x1C, 0x72, 0xDD, 0x24,
+    0x21, 0x65, 0xAA, 0xAB, 0xA4, 0x58, 0xA7, 0xD1, 0x3E, 0xE5, 0x34, 0x21, 0x29, 0x52, 0x36, 0xB5,
+    0x4F, 0xEC, 0xEA, 0xFD, 0x41, 0x3B, 0xF3, 0x89, 0x01, 0x41, 0x4B, 0x87, 0x4D, 0x66, 0x6E, 0xB1,
+    0xB4, 0xE4, 0xBB, 0x7B, 0xDA, 0x58, 0xE0, 0x80, 0x3D, 0x72, 0x5C, 0xF5, 0x53, 0x79, 0x48, 0xAE,
+    0x4E, 0x49, 0x8B, 0x8C, 0xA4, 0xD0, 0x3E, 0x76, 0x8C, 0xB5, 0x23, 0xD5, 0x1E, 0xFD, 0x72, 0x09,
+    0xE3, 0x00, 0x26, 0x40, 0x54, 0xB5, 0x44, 0xB3, 0x3E, 0x7F, 0x5C, 0xBB, 0x96, 0xF2, 0x68, 0x56,
+    0xA0, 0xA5, 0xD5, 0xE3, 0x89, 0x37, 0xCF, 0x35, 0x51, 0x48, 0x19, 0x68, 0x6F, 0x18, 0xC5, 0x45,
+    0x47, 0xFB, 0xD8, 0x05, 0x42, 0x45, 0xBE, 0x89, 0xC9, 0xD1, 0x0D, 0x34, 0xD0, 0x05, 0x03, 0xB1,
+    0x43, 0x95, 0xB0, 0x83, 0x92, 0x82, 0xAD, 0xF3, 0x7C, 0x0F, 0xD4, 0x5C, 0x9C, 0x53, 0xF3, 0xC3,
+    0x37, 0x2C, 0x99, 0x84, 0xEF, 0x03, 0x35, 0x53, 0x62, 0xA9, 0xF8, 0xE4, 0x71, 0x62, 0x47, 0xB4,
+    0x97, 0x1A, 0x8E, 0x1C, 0xDF, 0x7F, 0x1C, 0xA9, 0xB3, 0x29, 0x59, 0x11, 0x97, 0x18, 0x67, 0x0A,
+    0x62, 0xDF, 0x01, 0x5D, 0x8E, 0x80, 0x37, 0x03, 0x30, 0x71, 0x40, 0x0F, 0x60, 0x08, 0x28, 0xB1,
+    0xA0, 0x9F, 0x73, 0x60, 0xB4, 0x87, 0x6E, 0x14, 0xA0, 0xA2, 0x22, 0x2A, 0x19, 0x93, 0xBE, 0xAA,
+    0xE4, 0x9C, 0x34, 0x89, 0x94, 0x8B, 0x4D, 0x1D, 0x3B, 0x20, 0x2E, 0x80, 0x84, 0xC5, 0x5B, 0x7B,
+    0xA8, 0x11, 0x4D, 0xD2, 0xE8, 0x86, 0x75, 0xF3, 0x13, 0xA4, 0xAB, 0x60, 0x46, 0x90, 0x84, 0xF6,
+    0xB9, 0xA4, 0x84, 0xE5, 0x00, 0x9B, 0xD5, 0x47, 0x0E, 0x85, 0x8B, 0xA1, 0xE7, 0x7A, 0xA1, 0x67,
+    0x3B, 0xDB, 0xF3, 0x45, 0x9E, 0xFF, 0xC6, 0x1E, 0x0E, 0xB0, 0xBF, 0xDF, 0x57, 0xFD, 0x58, 0xE4,
+    0x9A, 0x3C, 0xFF, 0x67, 0xDF, 0x0C, 0xA9, 0x0D, 0xA3, 0x3C, 0x76, 0x6B, 0x5D, 0x13, 0x95, 0x77,
+    0x1A, 0xCD, 0x88, 0xD8, 0xD1, 0x45, 0x05, 0x0C, 0x8B, 0x8B, 0xA8, 0xC4, 0xCC, 0x75, 0xEE, 0xE2,
+    0xE2, 0x3D, 0x9F, 0xA4, 0x22, 0x72, 0xAE, 0x27, 0x22, 0x0D, 0x40, 0x77, 0x57, 0xA4, 0xB4, 0x03,
+    0x94, 0x07, 0x38, 0x39, 0x9F, 0xC6, 0x87, 0xB7, 0x88, 0xE7, 0x6B, 0xD1, 0xA2, 0xAB, 0x86, 0xCD,
+    0x89, 0x33, 0x36, 0x27, 0xC4, 0x2E, 0x65, 0xA4, 0x4A, 0x63, 0xBB, 0x04, 0xED, 0x3A, 0x8C, 0xB5,
+    0x4F, 0x8B, 0xAE, 0x1E, 0xFD, 0xA6, 0x7F, 0xE7, 0xBF, 0xF5, 0x9A, 0xE1, 0xE5, 0x99, 0xFE, 0x83,
+    0x76, 0xC8, 0xBC, 0xFD, 0x53, 0xC1, 0x07, 0x39, 0x72, 0x7C, 0x7F, 0x3F, 0x15, 0x2D, 0xFE, 0x22,
+    0x99, 0xCD, 0x48, 0x9C, 0x29, 0x74, 0xA9, 0x3D, 0x15, 0x81, 0x9C, 0x2E, 0x29, 0xA6, 0x48, 0x5C,
+    0x24, 0x52, 0x92, 0xCD, 0x2A, 0x60, 0x00, 0x64, 0xB4, 0x56, 0x47, 0xFB, 0x76, 0x03, 0x2A, 0x39,
+    0x87, 0x96, 0x7A, 0x4E, 0xBB, 0x99, 0x2F, 0x81, 0xF2, 0xBB, 0x74, 0x9F, 0x28, 0x12, 0x53, 0xAB,
+    0x90, 0x14, 0x1D, 0x76, 0xB4, 0x37, 0xE4, 0x04, 0xE3, 0xCC, 0x0B, 0x35, 0xC3, 0x37, 0x2C, 0x04,
+    0x30, 0x77, 0xA0, 0xDE, 0x72, 0x64, 0x35, 0xEA, 0x1D, 0x0B, 0x6B, 0xED, 0x08, 0x9B, 0x90, 0x42,
+    0x54, 0x7C, 0x07, 0x22, 0x4F, 0xE6, 0x74, 0x57, 0x52, 0xCC, 0x7F, 0xD8, 0x4B, 0xE4, 0xF6, 0x00,
+    0x56, 0x32, 0x38, 0x78, 0x1B, 0x91, 0x33, 0x8B, 0x96, 0xC0, 0x89, 0x22, 0xE9, 0x95, 0xB1, 0x1B,
+    0x45, 0xE5, 0x2A, 0x95, 0xD9, 0x97, 0xEB, 0x3F, 0xE9, 0x21, 0x52, 0xA4, 0x37, 0x3D, 0x27, 0x03,
+    0xF7, 0xE6, 0x87, 0x54, 0x9A, 0x93, 0x34, 0xA8, 0x66, 0x0E, 0x0D, 0x40, 0x6A, 0x48, 0x8B, 0x56,
+    0xC9, 0x64, 0x40, 0x67, 0x3E, 0xD3, 0xEE, 0xC4, 0x33, 0x94, 0x9A, 0x4B, 0x34, 0xD4, 0x8C, 0xA9,
+    0x18, 0x10, 0x18, 0xA9, 0x40, 0x1D, 0x05, 0x2A, 0x5D, 0x12, 0x8E, 0xD6, 0xF1, 0x8D, 0x61, 0x93,
+    0xCE, 0x38, 0x04, 0x59, 0x80, 0x4F, 0xCF, 0x75, 0xD5, 0xA8, 0x5D, 0x03, 0x03, 0x6C, 0xA6, 0x3E,
+    0x7A, 0x5E, 0x0A, 0xD3, 0xC9, 0xE8, 0xFA, 0x91, 0x9A, 0x6A, 0x9F, 0x04, 0x43, 0xC6, 0x80, 0x3A,
+    0x2A, 0xB5, 0x33, 0x36, 0x25, 0x3F, 0x34, 0xE2, 0xAD, 0x2B, 0x3E, 0x9E, 0x9A, 0x5D, 0x50, 0xA8,
+    0x9E, 0x82, 0x48, 0x2A, 0xD4, 0xF4, 0x93, 0xBE, 0x38, 0xCD, 0xFA, 0xA6, 0xB1, 0xFA, 0xE6, 0x43,
+    0x25, 0x59, 0x95, 0xA3, 0xAF, 0xBF, 0xE0, 0xE8, 0x66, 0x22, 0xE2, 0xB2, 0xD7, 0xB7, 0x3E, 0xAF,
+    0xC2, 0xDC, 0xF2, 0xB5, 0x27, 0x16, 0x68, 0x88, 0xAD, 0x29, 0xE3, 0x40, 0x4F, 0x6A, 0x98, 0xD4,
+    0x7B, 0x6C, 0x5F, 0x5C, 0xA3, 0xAF, 0x7B, 0x42, 0xE7, 0x70, 0xAE, 0xAF, 0x3D, 0x51, 0x8C, 0x4F,
+    0x55, 0x59, 0xFC, 0xE2, 0xA4, 0xC8, 0xA4, 0x20, 0x03, 0x15, 0xB0, 0xC6, 0x8E, 0x10, 0x41, 0x8B,
+    0xFD, 0x4E, 0xA4, 0x04, 0xB2, 0xAA, 0xFB, 0x37, 0x23, 0xA5, 0x5E, 0xA8, 0xD3, 0x00, 0x1C, 0x04,
+    0xF0, 0xC0, 0xBE, 0xF7, 0x45, 0xE0, 0x64, 0x86, 0x16, 0x8B, 0x76, 0xB0, 0x06, 0xDA, 0xC2, 0x83,
+    0xA0, 0x81, 0xFE, 0x71, 0x2D, 0xA5, 0xAA, 0x89, 0x1D, 0x19, 0x8C, 0x76, 0x21, 0x5C, 0x14, 0xE6,
+    0x30, 0x27, 0xCC, 0x3F, 0xAA, 0x39, 0x5A, 0x2B, 0xA9, 0xF6, 0xB0, 0xE6, 0xDC, 0x5D, 0xAD, 0xBB,
+    0xF4, 0x20, 0x40, 0xD6, 0xFA, 0x6B, 0xBD, 0x96, 0x77, 0x47, 0x6E, 0xDD, 0x75, 0x17, 0xFB, 0x8F,
+    0xF3, 0x73, 0x88, 0x95, 0x60, 0x42, 0x24, 0x9C, 0x46, 0x1C, 0xAB, 0x04, 0x53, 0x40, 0x1E, 0xBB,
+    0x1D, 0x60, 0xBB, 0x13, 0x17, 0x40, 0x59, 0xE5, 0x40, 0x74, 0xE5, 0x8A, 0x03, 0xCC, 0x1B, 0x17,
+    0x01, 0x66, 0xB3, 0x1A, 0x48, 0x9E, 0x79, 0x29, 0x00, 0xA7, 0xCD, 0xB1, 0x12, 0xE2, 0x32, 0x8F,
+    0x1D, 0xF4, 0x54, 0x30, 0x05, 0x3A, 0x24, 0x45, 0x06, 0x3D, 0xBB, 0x4A, 0x8F, 0xB8, 0x8A, 0xA6,
+    0x5C, 0x62, 0x68, 0x7B, 0xCD, 0x2E, 0xB6, 0x82, 0x39, 0x10, 0x38, 0x77, 0x37, 0xD0, 0x8D, 0x1C,
+    0x44, 0x6F, 0x57, 0x80, 0x99, 0xFE, 0xED, 0x7D, 0x49, 0x7E, 0xE2, 0x96, 0x2F, 0x99, 0x84, 0xD8,
+    0x0E, 0x17, 0x86, 0xF5, 0xDB, 0xBA, 0x6C, 0xE1, 0x36, 0x97, 0xCD, 0xC2, 0x50, 0x2C, 0xD1, 0xBB,
+    0xE2, 0x30, 0x45, 0x56, 0xD0, 0xA5, 0x07, 0x81, 0xD3, 0xC4, 0x8E, 0x8A, 0x0C, 0xED, 0xA9, 0x31,
+    0xF6, 0xE8, 0x0D, 0x06, 0x4A, 0xEA, 0x28, 0x2C, 0xA4, 0x60, 0x0C, 0x77, 0x27, 0x0E, 0x26, 0x0D,
+    0x20, 0x76, 0x0F, 0x4A, 0xEB, 0x4C, 0x9C, 0xC4, 0x9F, 0xF9, 0x6A, 0xF2, 0xB0, 0x35, 0x06, 0xB3,
+    0x84, 0x99, 0x14, 0xE9, 0x1B, 0x61, 0x95, 0x3A, 0x67, 0x9C, 0x33, 0x18, 0x90, 0xEF, 0x30, 0x80,
+    0x11, 0x54, 0xA8, 0x70, 0x4F, 0xE2, 0x52, 0x21, 0x79, 0xB5, 0x05, 0xA0, 0x44, 0x22, 0x33, 0x38,
+    0xF3, 0x58, 0x09, 0x79, 0xEC, 0x20, 0x4F, 0x1C, 0x6C, 0x9A, 0x02, 0xB6, 0x8D, 0x85, 0x60, 0x40,
+    0x95, 0x29, 0x44, 0x2E, 0x03, 0xED, 0xD6, 0x21, 0xB1, 0x5D, 0x30, 0xE4, 0xB0, 0xCA, 0x00, 0x06,
+    0x8C, 0xF9, 0xFB, 0x15, 0x35, 0xBD, 0xF2, 0xC0, 0x8C, 0x9E, 0x4D, 0xC5, 0xCE, 0x15, 0x44, 0xAB,
+    0xC3, 0x47, 0x0B, 0xA4, 0xAF, 0x6F, 0xF3, 0xE2, 0xB3, 0x0A, 0x24, 0xA0, 0x2F, 0x07, 0xE2, 0x87,
+    0x4A, 0x12, 0xED, 0x39, 0xA8, 0x1D, 0x4B, 0xDA, 0x91, 0xC7, 0x8E, 0xB5, 0xA4, 0x60, 0xC7, 0xFC,
+    0x93, 0x1F, 0x09, 0x66, 0xB5, 0xE7, 0x4D, 0xD3, 0xB3, 0x66, 0x0C, 0x9C, 0x6A, 0x77, 0x83, 0xF2,
+    0xED, 0x68, 0xEA, 0xFB, 0xEF, 0xB3, 0x14, 0xBB, 0x3E, 0x4B, 0x4A, 0x2C, 0x3E, 0x0A, 0xBB, 0xF3,
+    0x88, 0x1D, 0xE0, 0x2B, 0x20, 0x9B, 0xB1, 0x77, 0x09, 0x32, 0x17, 0x9F, 0x08, 0xDA, 0x0F, 0x08,
+    0x1D, 0x72, 0x63, 0x53, 0xFD, 0xD5, 0xC7, 0x0A, 0x11, 0x7F, 0xBA, 0xDF, 0x5E, 0x2F, 0x6B, 0x97,
+    0x7C, 0x34, 0x68, 0x37, 0x22, 0xC0, 0x26, 0xAC, 0x82, 0x41, 0xBF, 0x68, 0x11, 0x47, 0x6A, 0x7F,
+    0xA0, 0x5E, 0x57, 0x19, 0x8B, 0xCF, 0x04, 0x5A, 0xD8, 0xDA, 0x5A, 0xAD, 0x56, 0x98, 0x22, 0x0F,
+    0xF0, 0x20, 0xDF, 0xAB, 0xD7, 0xF5, 0xEB, 0x39, 0x5F, 0xFA, 0xBA, 0x4B, 0xA6, 0x23, 0x86, 0xAD,
+    0x2A, 0x49, 0x80, 0x12, 0x56, 0x40, 0x7D, 0x9F, 0xAC, 0xE7, 0xCC, 0x12, 0x4B, 0x68, 0x55, 0xE2,
+    0x26, 0x2D, 0x68, 0x4D, 0x00, 0x55, 0x2C, 0xE4, 0x7C, 0xAF, 0xC5, 0x22, 0xD7, 0xAE, 0xC7, 0x74,
+    0x52, 0xA4, 0x37, 0xFD, 0x22, 0x12, 0x91, 0x42, 0x52, 0x90, 0x95, 0x18, 0x4B, 0x5C, 0xA0, 0x3C,
+    0x9C, 0x84, 0xC3, 0xC0, 0xFE, 0xE3, 0xA8, 0x3E, 0xB1, 0xA0, 0xC4, 0x91, 0x79, 0xC4, 0x62, 0x2A,
+    0x26, 0x0E, 0xFD, 0x0D, 0xBA, 0x01, 0x75, 0xBD, 0x58, 0x1D, 0xC3, 0x17, 0x83, 0xE9, 0x40, 0x3E,
+    0x48, 0x92, 0x82, 0x65, 0xA3, 0x3F, 0x53, 0x92, 0x1C, 0xBB, 0xE6, 0x2A, 0xB4, 0xBB, 0x51, 0x76,
+    0x21, 0x74, 0x82, 0xB1, 0x8C, 0xE2, 0x4A, 0x7B, 0xBA, 0x34, 0x04, 0x0C, 0x5D, 0x72, 0xE2, 0xE2,
+    0x2E, 0x52, 0xE2, 0x0A, 0xD2, 0x3F, 0x37, 0x02, 0x2D, 0xC7, 0x31, 0xC5, 0xAD, 0x70, 0x96, 0xF6,
+    0xEC, 0x32, 0x1D, 0xBF, 0x77, 0x1B, 0x1C, 0xA8, 0x49, 0x8B, 0x5E, 0xA5, 0xA6, 0x98, 0x60, 0x02,
+    0xFF, 0xC0, 0xFD, 0x4A, 0xC1, 0x0B, 0xC7, 0x7E, 0x87, 0x78, 0x69, 0x65, 0x87, 0x95, 0xCD, 0x6B,
+    0x8E, 0xF2, 0xBA, 0x41, 0x1F, 0xAB, 0x72, 0xEE, 0x35, 0x97, 0x5F, 0xFA, 0xAD, 0xB2, 0x1B, 0x3F,
+    0x29, 0x36, 0xA4, 0xEF, 0x56, 0x11, 0x3D, 0xBF, 0x80, 0x48, 0xA7, 0x16, 0x30, 0xE9, 0xDE, 0x85,
+    0xDA, 0x43, 0x4B, 0x79, 0xE0, 0x06, 0x7A, 0x2E, 0x18, 0xAD, 0xAC, 0xE4, 0xA8, 0x40, 0x32, 0x17,
+    0xF1, 0xDD, 0x8F, 0x4A, 0x8C, 0x55, 0x97, 0xEC, 0x9C, 0x6C, 0xE0, 0xBE, 0xC8, 0xA2, 0xFD, 0x12,
+    0x98, 0xC7, 0xCB, 0xB9, 0xBB, 0xB6, 0x7F, 0x57, 0xDF, 0x7C, 0x80, 0xD6, 0xEB, 0xC1, 0x78, 0x40,
+    0x0A, 0x88, 0x7F, 0x11, 0xC8, 0x07, 0xA0, 0x7C, 0x98, 0x03, 0xD4, 0x1D, 0x63, 0xD1, 0xAE, 0x03,
+    0xEB, 0xFD, 0x31, 0x4A, 0x24, 0x60, 0xFA, 0x8F, 0x79, 0x46, 0x18, 0xAB, 0x1D, 0xEB, 0x74, 0xA0,
+    0x89, 0x6E, 0x10, 0xDF, 0xE8, 0x35, 0xB4, 0x70, 0xEF, 0x4E, 0xCE, 0x25, 0xC5, 0xC9, 0xE8, 0xED,
+    0x11, 0xD9, 0xC2, 0xD6, 0xA8, 0x4B, 0x4B, 0x91, 0x88, 0xAA, 0xB2, 0x22, 0x68, 0x5F, 0x13, 0x72,
+    0x06, 0xCB, 0x74, 0x12, 0x9B, 0x1E, 0xF3, 0xC6, 0x55, 0x49, 0x18, 0x26, 0xF9, 0x4D, 0x79, 0x34,
+    0xC8, 0x3C, 0xD4, 0xC3, 0x5D, 0x91, 0x83, 0x26, 0xB3, 0xE8, 0xB2, 0xD9, 0xCB, 0x62, 0x55, 0x2C,
+    0xF4, 0xD1, 0x14, 0x30, 0x35, 0xF0, 0xCB, 0x25, 0xE8, 0x67, 0x1D, 0x2C, 0x19, 0x20, 0x74, 0x21,
+    0xB1, 0x15, 0xE4, 0x51, 0x89, 0x7E, 0xED, 0x31, 0x47, 0x2A, 0x02, 0x6F, 0xF7, 0x2F, 0xB6, 0x4E,
+    0x5A, 0x8E, 0x2E, 0xA3, 0x12, 0xE3, 0xB2, 0x73, 0x0C, 0x7F, 0x53, 0x9C, 0x11, 0xC7, 0xE1, 0xFD,
+    0x64, 0x8F, 0xF8, 0xE4, 0x99, 0x80, 0x3D, 0xB4, 0xBB, 0x94, 0xA7, 0x12, 0x69, 0x62, 0x7F, 0x49,
+    0x3B, 0x73, 0xAC, 0xD4, 0x2E, 0xA8, 0xB0, 0xC9, 0x68, 0x95, 0xD3, 0xC6, 0xF6, 0xB4, 0xCF, 0x2E,
+    0x37, 0x2B, 0x6F, 0xBD, 0x31, 0xED, 0x5D, 0x69, 0x16, 0xD8, 0xA5, 0xDF, 0xEF, 0x03, 0x13, 0x11,
+    0x07, 0x7A, 0xB6, 0x15, 0x40, 0xCF, 0x58, 0x83, 0xE8, 0x45, 0x7B, 0x0F, 0xA8, 0x57, 0x1C, 0x0B,
+    0x67, 0x80, 0x30, 0x06, 0xD8, 0xE9, 0x3D, 0xED, 0x60, 0xD3, 0x48, 0x09, 0xDD, 0x8F, 0x3B, 0xA0,
+    0x27, 0x01, 0xE8, 0xF6, 0x6B, 0xA0, 0xC3, 0x3A, 0x77, 0xB3, 0x8C, 0xB1, 0x06, 0x43, 0xEC, 0xE2,
+    0x22, 0x2D, 0x63, 0x11, 0x9F, 0x35, 0x46, 0x16, 0x58, 0x39, 0x9A, 0x26, 0xB5, 0x12, 0xB9, 0xEE,
+    0x4F, 0x47, 0xA1, 0x63, 0x6C, 0xAE, 0x9F, 0x2F, 0xE3, 0x62, 0x9C, 0x53, 0xF5, 0xE2, 0x22, 0x1D,
+    0x16, 0x3B, 0x5A, 0xAC, 0xB1, 0x13, 0xA8, 0x4C, 0xE0, 0xD1, 0xB3, 0x5F, 0xB1, 0xA3, 0x49, 0x90,
+    0x99, 0xAE, 0xF5, 0x1E, 0x73, 0x03, 0x87, 0x55, 0xC1, 0x32, 0x25, 0xF1, 0xE5, 0x00, 0x12, 0x76,
+    0x85, 0x43, 0xF5, 0xFB, 0xC7, 0x11, 0x11, 0xE2, 0xD7, 0x9F, 0x76, 0x2A, 0x50, 0x32, 0xE6, 0x23,
+    0x74, 0xF6, 0xFA, 0x51, 0xEF, 0x6E, 0xC1, 0x44, 0x8A, 0xF7, 0x3A, 0x57, 0x27, 0x19, 0x93, 0xB3,
+    0xCE, 0x32, 0x27, 0x44, 0xEC, 0x50, 0xA4, 0xE5, 0xD0, 0xB9, 0x3B, 0xA3, 0xF2, 0xDE, 0xE8, 0xED,
+    0x11, 0x93, 0xC5, 0x96, 0x39, 0xE1, 0xA2, 0xEB, 0x21, 0xF9, 0x68, 0x58, 0x56, 0x21, 0xD7, 0x7E,
+    0x33, 0xB3, 0xFF, 0xAB, 0x41, 0xCE, 0x51, 0x41, 0x85, 0x6D, 0x62, 0x37, 0x14, 0x9B, 0xB5, 0x48,
+    0xE4, 0xC0, 0x53, 0x44, 0x32, 0xA5, 0xF7, 0xB1, 0x26, 0xF2, 0x34, 0x0A, 0x55, 0xDD, 0xEE, 0xBB,
+    0xD7, 0x3D, 0x91, 0x57, 0x44, 0xC4, 0xC0, 0x78, 0x80, 0x7E, 0x3E, 0x90, 0x25, 0x4E, 0x55, 0x29,
+    0x99, 0xED, 0x3D, 0x5D, 0x91, 0xDD, 0x42, 0x09, 0x4A, 0x6C, 0x4F, 0x22, 0xBF, 0xBE, 0x8F, 0x01,
+    0x2A, 0x30, 0x71, 0xD9, 0x85, 0xC4, 0x8F, 0xC6, 0xFA, 0x8A, 0xEB, 0x98, 0x28, 0xAC, 0x0F, 0x19,
+    0x96, 0xAD, 0x53, 0x18, 0x39, 0x2E, 0x66, 0x56, 0xB7, 0x6B, 0x05, 0xC0, 0x87, 0xCE, 0x91, 0x48,
+    0xC5, 0xF4, 0xB1, 0x90, 0x58, 0x1D, 0xF6, 0x11, 0xFB, 0x3D, 0x04, 0x80, 0x2E, 0x45, 0xE4, 0x49,
+    0x91, 0x26, 0x27, 0x7A, 0x33, 0x60, 0x1E, 0x71, 0x8C, 0x33, 0x62, 0x3F, 0xE0, 0x22, 0xB3, 0x0B,
+    0x9E, 0xC9, 0x7C, 0x27, 0x7C, 0xEA, 0x03, 0xAA, 0x3A, 0x1D, 0x85, 0xF1, 0x2D, 0x51, 0x1B, 0x7A,
+    0x2D, 0x21, 0xB1, 0xF5, 0xBE, 0xD6, 0x00, 0x27, 0x0D, 0x97, 0xC6, 0x89, 0x1F, 0x65, 0x84, 0x3C,
+    0x2A, 0xF3, 0xC4, 0xAD, 0x0F, 0x49, 0x17, 0x68, 0x76, 0x25, 0x01, 0xD0, 0xD5, 0x45, 0x00, 0xF3,
+    0x4C, 0xE0, 0x3D, 0xC7, 0x79, 0xFA, 0xF6, 0x40, 0x61, 0x2A, 0x23, 0x08, 0x59, 0x88, 0xBD, 0x69,
+    0x88, 0xBC, 0xA1, 0x06, 0xED, 0x06, 0x89, 0x85, 0x24, 0x2A, 0x37, 0x81, 0x83, 0xE6, 0x98, 0x03,
+    0x56, 0xF2, 0x1C, 0x60, 0x76, 0xD3, 0x03, 0xE6, 0x8D, 0x37, 0x0A, 0x60, 0xDC, 0x49, 0x81, 0xD8,
+    0x57, 0xEB, 0xC0, 0x19, 0xED, 0x06, 0xA0, 0x43, 0x4A, 0x0D, 0x3D, 0x46, 0x51, 0x40, 0x57, 0x91,
+    0xD7, 0x81, 0xA1, 0xCD, 0x7C, 0x52, 0xC6, 0x95, 0x16, 0x97, 0x94, 0xBB, 0x04, 0xEC, 0x57, 0x16,
+    0xA2, 0x30, 0x06, 0x7A, 0xC6, 0xC1, 0xAD, 0x69, 0xB6, 0xFC, 0x6F, 0x94, 0x4B, 0xCA, 0x61, 0xC8,
+    0xB5, 0x1C, 0x34, 0xB1, 0xAB, 0x36, 0x8A, 0xED, 0x7A, 0x05, 0x92, 0x13, 0x8F, 0x14, 0xF0, 0xC7,
+    0x7F, 0x18, 0x20, 0xF9, 0xCA, 0x3A, 0x50, 0xFD, 0x65, 0x09, 0xCB, 0xE9, 0xEF, 0x82, 0xFE, 0xCC,
+    0x9B, 0xE5, 0x3E, 0x1B, 0xBA, 0x26, 0x7E, 0xB2, 0xD1, 0x4E, 0xC2, 0x84, 0x53, 0xF1, 0x2D, 0x6E,
+    0xD8, 0xEC, 0xE1, 0x32, 0xD9, 0x65, 0xC3, 0xFE, 0xA7, 0xC8, 0xC4, 0x9B, 0xCF, 0x35, 0xDA, 0x99,
+    0x8F, 0x7A, 0xED, 0xEF, 0x23, 0xD0, 0x32, 0xF5, 0x43, 0x53, 0x12, 0x29, 0x88, 0x2A, 0xE8, 0x41,
+    0xF2, 0x0C, 0xFA, 0x65, 0xAF, 0xAA, 0x46, 0x35, 0xE9, 0xCD, 0x66, 0x01, 0x88, 0x37, 0x0E, 0x47,
+    0xD5, 0xC5, 0xDB, 0x56, 0x66, 0x52, 0xC4, 0x37, 0xC3, 0x41, 0xAA, 0x7D, 0x04, 0x54, 0xC9, 0x63,
+    0x05, 0x52, 0x10, 0x97, 0x44, 0xE1, 0xBE, 0x28, 0x84, 0xD8, 0xCF, 0x2E, 0x14, 0xBD, 0x56, 0xB6,
+    0x8E, 0xF4, 0x8F, 0x33, 0x91, 0x29, 0xEF, 0x6E, 0x35, 0x84, 0x28, 0xE0, 0x13, 0x47, 0x91, 0xB5,
+    0x40, 0x2F, 0x0A, 0xA0, 0xA7, 0xA0, 0x26, 0x16, 0x8C, 0x6B, 0xCD, 0x48, 0xEC, 0xEE, 0x20, 0x71,
+    0x39, 0xA6, 0xE8, 0x31, 0x24, 0xBB, 0xDE, 0xB4, 0xD1, 0x26, 0x00, 0x91, 0x90, 0x88, 0xB8, 0x9C,
+    0xD3, 0x78, 0xED, 0xD5, 0x3C, 0x8A, 0xC9, 0x7A, 0x1B, 0x75, 0x4B, 0x2B, 0x38, 0x5A, 0x81, 0x9E,
+    0x87, 0x83, 0x0C, 0x30, 0x50, 0x44, 0xE5, 0x41, 0x52, 0xCE, 0x44, 0x35, 0x13, 0xB1, 0x7C, 0xF8,
+    0xDC, 0x2D, 0x6F, 0x5A, 0x6A, 0x20, 0xBD, 0x6D, 0xD3, 0xB3, 0xBF, 0x6F, 0x8F, 0x1C, 0x47, 0xAA,
+    0x58, 0xBC, 0xAA, 0x49, 0x3C, 0x29, 0x34, 0x44, 0x81, 0x5E, 0x41, 0x07, 0x53, 0xA1, 0xBD, 0x7E,
+    0x11, 0xBA, 0xBC, 0x19, 0x88, 0x5D, 0x9E, 0xC1, 0x38, 0xD5, 0x25, 0xE6, 0x89, 0xA2, 0x0B, 0x6F,
+    0x97, 0xB1, 0xC3, 0x8C, 0x18, 0xA3, 0x66, 0x24, 0x05, 0x99, 0xA5, 0x9A, 0x1B, 0x9E, 0x49, 0x11,
+    0xDF, 0x60, 0x38, 0x8D, 0x24, 0xFC, 0x8D, 0xDC, 0x7A, 0xED, 0xDF, 0xF9, 0x9D, 0xD6, 0xAD, 0x9F,
+    0x0B, 0xD4, 0x72, 0x54, 0x80, 0x0E, 0x0D, 0xB0, 0x7E, 0x2B, 0x75, 0xF0, 0xFF, 0x6B, 0x06, 0x1F,
+    0x38, 0x40, 0x7C, 0xB5, 0x62, 0x9C, 0xA1, 0xD8, 0x83, 0x0F, 0x3F, 0xDB, 0x50, 0x69, 0x67, 0x18,
+    0xA8, 0x90, 0x14, 0xCB, 0x54, 0xDA, 0x1B, 0xF2, 0xA8, 0x4C, 0x5C, 0x57, 0xD5, 0xDA, 0xFF, 0xC3,
+    0xA2, 0x6B, 0xFE, 0xCD, 0x35, 0x79, 0xB6, 0x49, 0xCB, 0xF5, 0x76, 0xDE, 0x6E, 0xBB, 0xDD, 0xB0,
+    0x4D, 0xB6, 0x87, 0xFE, 0x0F, 0x59, 0x94, 0xCC, 0xD0, 0x37, 0x1E, 0x0B, 0x3A, 0x70, 0x46, 0x07,
+    0xCC, 0xE5, 0x80, 0xAA, 0x6A, 0xE8, 0x0E, 0xC0, 0x9C, 0x00, 0xFD, 0x62, 0x81, 0x7A, 0xAB, 0x84,
+    0x71, 0x0D, 0xEB, 0xEB, 0x90, 0x1A, 0x87, 0x79, 0xBC, 0x22, 0x71, 0x3D, 0x9B, 0x3A, 0x3D, 0x9B,
+    0x38, 0xB2, 0xD9, 0x9C, 0xB0, 0x6F, 0x67, 0xC2, 0x66, 0x24, 0x52, 0x1A, 0x37, 0x48, 0x9C, 0x39,
+    0xE6, 0xF5, 0x4B, 0x81, 0x6A, 0x44, 0xB7, 0x8B, 0x31, 0x36, 0x39, 0x5B, 0x6A, 0x37, 0xD6, 0x65,
+    0x7A, 0xBD, 0x54, 0x0B, 0xB1, 0xFB, 0x79, 0x88, 0xA5, 0xC6, 0xBC, 0x76, 0xC2, 0x19, 0xA7, 0x6A,
+    0xE3, 0xC8, 0x62, 0x47, 0x7C, 0xAD, 0x84, 0xB7, 0x03, 0x74, 0x2F, 0x6D, 0x6D, 0x5D, 0x18, 0x8A,
+    0xC8, 0x57, 0xE6, 0x54, 0xD5, 0x35, 0x0C, 0x7A, 0xB0, 0x1E, 0x7B, 0x32, 0xA6, 0x0C, 0x31, 0xEF,
+    0xCE, 0x60, 0x72, 0x63, 0x4F, 0xCC, 0xB9, 0x8C, 0x66, 0x4D, 0xE2, 0xBA, 0x29, 0x9D, 0x9C, 0x74,
+    0x40, 0x67, 0x22, 0xB3, 0x8A, 0x6E, 0x60, 0x50, 0x51, 0x8D, 0xA2, 0xD0, 0xBB, 0x50, 0xA4, 0xD3,
+    0xF7, 0xC5, 0xA4, 0xE4, 0x76, 0x26, 0x6D, 0x6D, 0x3D, 0xFD, 0xA2, 0x88, 0xBC, 0x55, 0xC2, 0xE0,
+    0xAF, 0x63, 0x52, 0x71, 0x8B, 0x49, 0x1F, 0x38, 0x40, 0xFA, 0xF0, 0xB7, 0x32, 0xE9, 0x66, 0x48,
+    0x5C, 0x37, 0x76, 0xC9, 0x59, 0xA7, 0xDE, 0x0C, 0x8C, 0x26, 0x32, 0xEB, 0x62, 0x1E, 0x25, 0xBE,
+    0xE2, 0xB5, 0x1F, 0x45, 0xC1, 0xDC, 0x62, 0xD2, 0x72, 0x54, 0xD0, 0xF4, 0x6E, 0xC3, 0x24, 0xFF,
+    0xFC, 0x1C, 0x99, 0x04, 0xDE, 0x7D, 0x2C, 0x68, 0x17, 0x97, 0xCB, 0x24, 0xEE, 0x23, 0xA4, 0xB6,
+    0x75, 0x33, 0x2A, 0xB6, 0x9E, 0xF6, 0x5A, 0xE4, 0x56, 0xB4, 0x39, 0x8D, 0xA0, 0x5E, 0xC5, 0xB8,
+    0x46, 0x4D, 0x95, 0x4C, 0xDC, 0xAE, 0x33, 0xBE, 0x71, 0x38, 0x0A, 0x63, 0x1D, 0x9A, 0xDB, 0x94,
+    0x8F, 0x04, 0x43, 0x7D, 0x07, 0x63, 0x18, 0xD0, 0x1F, 0x23, 0x0D, 0x1B, 0x23, 0xA8, 0xEE, 0x53,
+    0x61, 0x47, 0xFB, 0x4B, 0x27, 0x8A, 0x3D, 0x86, 0x8D, 0x89, 0x40, 0x2C, 0xB7, 0x14, 0x31, 0xFD,
+    0x8D, 0xFD, 0xFD, 0x4C, 0x22, 0x29, 0x87, 0x36, 0x2E, 0xA3, 0xC0, 0x80, 0x14, 0x63, 0xA9, 0x54,
+    0x89, 0x29, 0x72, 0x18, 0x27, 0x96, 0xF8, 0x72, 0x09, 0xDD, 0x1C, 0xA2, 0xEB, 0x16, 0xD2, 0xB2,
+    0x8D, 0x83, 0x63, 0x6C, 0xEB, 0xE5, 0x3D, 0x30, 0x00, 0x2D, 0x40, 0x6F, 0xD7, 0xDB, 0x8B, 0xB6,
+    0xCE, 0xA3, 0x6F, 0x8B, 0x20, 0xC0, 0x19, 0x06, 0x4A, 0x58, 0xC7, 0x14, 0x1D, 0x12, 0xB7, 0x8A,
+    0x76, 0x39, 0xDA, 0xE7, 0x44, 0xFE, 0x14, 0x51, 0x19, 0x50, 0x2F, 0xF9, 0x16, 0x01, 0x5D, 0x07,
+    0xF5, 0x97, 0xA0, 0xEA, 0xB9, 0x52, 0x6C, 0x03, 0x47, 0x3F, 0x32, 0x86, 0x5E, 0x09, 0x1D, 0x0B,
+    0xC4, 0xC5, 0x36, 0x34, 0x3D, 0x30, 0x67, 0xC3, 0x0F, 0x7A, 0x2E, 0x14, 0xF7, 0xA1, 0xCB, 0x9A,
+    0xF8, 0x6A, 0xB5, 0x67, 0x87, 0x7F, 0x7F, 0xE7, 0xD3, 0x5A, 0x3D, 0x7F, 0x2F, 0x5C, 0x4A, 0x3C,
+    0xD9, 0x95, 0x1A, 0xE3, 0x1B, 0xF0, 0x1F, 0xFC, 0x81, 0x4E, 0x0C, 0x60, 0xE5, 0x1E, 0x18, 0xAC,
+    0x43, 0x3D, 0x46, 0xBF, 0x14, 0xD0, 0x9F, 0x71, 0x3F, 0x90, 0x09, 0x26, 0x91, 0x27, 0xB9, 0x5A,
+    0x13, 0x85, 0xD3, 0x7B, 0x94, 0xB3, 0xEA, 0x3F, 0x2C, 0x4E, 0xAA, 0xCC, 0x26, 0x3E, 0x71, 0x51,
+    0xD0, 0x25, 0x35, 0x15, 0x5D, 0x72, 0x0C, 0xC6, 0xC6, 0x4E, 0x97, 0x51, 0x60, 0x22, 0x35, 0x89,
+    0x5C, 0x9C, 0x87, 0xCF, 0x12, 0x37, 0xCF, 0xD8, 0x57, 0x73, 0x27, 0x7D, 0x78, 0x0E, 0xA4, 0x81,
+    0xFB, 0xEF, 0xA4, 0x67, 0x9C, 0x39, 0x5B, 0xEE, 0xEE, 0x8D, 0x03, 0x35, 0xFF, 0x63, 0xC6, 0x20,
+    0x29, 0x3A, 0x91, 0x37, 0x36, 0x68, 0x97, 0xEB, 0x60, 0x5E, 0xA8, 0x95, 0x5C, 0x04, 0x03, 0xFA,
+    0x32, 0xEA, 0x2D, 0xC7, 0xC4, 0x91, 0xBA, 0x05, 0x36, 0x17, 0x11, 0xD2, 0xAD, 0x4B, 0xA4, 0x74,
+    0xC8, 0x58, 0xA5, 0xC3, 0x4A, 0x1B, 0xEF, 0x9C, 0x7B, 0xB0, 0xE3, 0x79, 0x8C, 0xAE, 0x9A, 0x07,
+    0x25, 0xC2, 0x7C, 0xC6, 0x25, 0x1C, 0x7D, 0x17, 0x86, 0xB2, 0x27, 0x4E, 0xBA, 0x3A, 0x4F, 0x92,
+    0x3C, 0x78, 0xCB, 0xF1, 0x9B, 0x31, 0x99, 0xE9, 0x62, 0xB0, 0x4F, 0x05, 0x52, 0x1B, 0x55, 0x9C,
+    0x21, 0xF1, 0x8C, 0xD1, 0xFE, 0x0E, 0x63, 0x43, 0xEF, 0x42, 0x31, 0xFC, 0x1A, 0xAC, 0xA1, 0x4A,
+    0xE2, 0x82, 0x41, 0x9B, 0xBB, 0x89, 0xFC, 0x29, 0x40, 0xD5, 0x3D, 0x80, 0xD3, 0xA9, 0xBD, 0x1D,
+    0xC8, 0x1D, 0xE9, 0xA3, 0xFA, 0xD6, 0x48, 0x11, 0x49, 0xE0, 0x0C, 0xA4, 0x9E, 0x14, 0x74, 0x49,
+    0xE2, 0x68, 0x73, 0x05, 0x0C, 0xA0, 0x82, 0x0C, 0xBA, 0x90, 0x14, 0xA4, 0x52, 0x68, 0x4F, 0x72,
+    0x7D, 0x4A, 0x40, 0x97, 0xC6, 0x0D, 0xA0, 0x52, 0x21, 0x83, 0x9C, 0xAE, 0x29, 0x48, 0x49, 0xB5,
+    0x27, 0x71, 0x89, 0x0B, 0xE8, 0x32, 0x71, 0x03, 0x0E, 0xC8, 0xC4, 0x4F, 0xCE, 0xC5, 0x32, 0xB3,
+    0x72, 0x2B, 0x58, 0x7A, 0xEE, 0xFE, 0x16, 0xB8, 0xE9, 0xB2, 0x86, 0x7D, 0x6A, 0x6F, 0x8E, 0x09,
+    0x7D, 0x76, 0x06, 0x9B, 0x91, 0x27, 0x29, 0x72, 0xA8, 0xB4, 0xC3, 0x30, 0x9C, 0xA9, 0x90, 0xBC,
+    0x5E, 0x77, 0x08, 0xC9, 0x15, 0x6F, 0x18, 0xE4, 0x84, 0xE4, 0xEC, 0x65, 0x43, 0x18, 0x94, 0x37,
+    0x2E, 0x26, 0x8D, 0x16, 0x7B, 0xE6, 0x96, 0x83, 0xF4, 0x1D, 0x16, 0x61, 0xFF, 0xC5, 0xE3, 0xA4,
+    0xD2, 0xFC, 0xF5, 0x8B, 0x70, 0x03, 0x86, 0x52, 0xB4, 0x32, 0xA8, 0x0B, 0x88, 0x2D, 0x4A, 0x58,
+    0x84, 0xB4, 0xDF, 0xB3, 0x08, 0x77, 0x18, 0xBB, 0x5E, 0x31, 0x24, 0xF9, 0x06, 0xE3, 0xC3, 0xDA,
+    0x63, 0xEC, 0xA9, 0xDE, 0x1B, 0x65, 0xEF, 0x9D, 0x82, 0x7B, 0xE0, 0x24, 0x0F, 0x3B, 0xDD, 0x70,
+    0x97, 0xFD, 0x01, 0x24, 0x6F, 0x18, 0x20, 0x4D, 0x9B, 0x41, 0xDB, 0x7D, 0xF3, 0x3B, 0xA0, 0xA4,
+    0x04, 0x26, 0xF6, 0x7D, 0x27, 0x6F, 0x38, 0x14, 0xC6, 0xF4, 0x5C, 0x4E, 0xCF, 0x76, 0xE7, 0xE2,
+    0x37, 0x17, 0xC1, 0xB5, 0x1C, 0x7A, 0x55, 0x1B, 0xC5, 0xFF, 0xCE, 0xF3, 0x50, 0x6F, 0x06, 0x40,
+    0x1C, 0x7C, 0x78, 0xB2, 0x05, 0x43, 0x91, 0xEF, 0x21, 0x09, 0x55, 0x48, 0x33, 0x47, 0xA4, 0x7F,
+    0x1D, 0xA5, 0x5A, 0xC4, 0x61, 0xDE, 0x4B, 0x69, 0x2F, 0xF4, 0x6C, 0xAB, 0x89, 0x0E, 0xFC, 0xCB,
+    0xC5, 0x01, 0xFA, 0xEE, 0xAC, 0x08, 0xBD, 0xCB, 0xBF, 0x75, 0x27, 0xE7, 0xBE, 0xED, 0xCF, 0x3C,
+    0x96, 0xB2, 0xD6, 0xFF, 0x99, 0xD7, 0x2F, 0xB8, 0x7B, 0xDD, 0xF9, 0xCB, 0x85, 0xE3, 0x3B, 0xBD,
+    0x2C, 0x10, 0x73, 0x2F, 0x5F, 0xEC, 0xBF, 0xFB, 0xF4, 0x83, 0xFA, 0x2E, 0x1D, 0x1D, 0x43, 0x7F,
+    0xC7, 0x97, 0xEA, 0x1F, 0x97, 0xE9, 0xD6, 0xE7, 0xE7, 0xEF, 0xFD, 0xE3, 0x22, 0xB3, 0x7E, 0xFF,
+    0x78, 0xBF, 0xDF, 0xEF, 0xF7, 0xFB, 0x43, 0x11, 0x11, 0x79, 0xBB, 0xDF, 0xEF, 0xF7, 0xFB, 0xC7,
+    0x0F, 0xEF, 0x1F, 0xA4, 0xEF, 0xEF, 0xF5, 0x73, 0x77, 0x89, 0xC8, 0x50, 0xC4, 0x43, 0xB4, 0xB5,
+    0xF5, 0xFB, 0x22, 0xF3, 0xEC, 0xF3, 0xE9, 0xB8, 0xEC, 0xC6, 0x6E, 0x64, 0xB4, 0x3B, 0xC4, 0xE1,
+    0xF4, 0xD1, 0x67, 0xCA, 0x81, 0x51, 0x7E, 0x05, 0x48, 0x1F, 0xF6, 0x67, 0xD2, 0xA2, 0xEA, 0xC6,
+    0x97, 0x43, 0x27, 0x29, 0x42, 0x6E, 0xB4, 0x3B, 0xB4, 0x8F, 0xC3, 0xFB, 0xE3, 0xAB, 0x55, 0xD3,
+    0x4B, 0x3E, 0x53, 0x0E, 0x52, 0xED, 0xC2, 0x52, 0x6C, 0xB7, 0x57, 0xF8, 0xE0, 0x22, 0x36, 0x08,
+    0x6B, 0x6A, 0x26, 0x2F, 0xC8, 0x84, 0x15, 0x08, 0xE8, 0x82, 0x65, 0xD8, 0x41, 0x3B, 0xCC, 0xA2,
+    0xAE, 0x01, 0x38, 0x60, 0x31, 0x05, 0xC6, 0x62, 0xE0, 0x20, 0xE9, 0x1B, 0xD3, 0x6C, 0xD6, 0x90,
+    0x43, 0x0E, 0x03, 0x18, 0xC3, 0x0E, 0xC7, 0xB7, 0x3F, 0x25, 0x12, 0xFE, 0xE2, 0xCF, 0x4A, 0x55,
+    0x12, 0x79, 0xB4, 0x9F, 0xC7, 0xB3, 0x8E, 0x3E, 0xDC, 0x4C, 0x9E, 0x6B, 0x7A, 0x70, 0x3F, 0xA9,
+    0x8F, 0xE5, 0xA3, 0x32, 0x1D, 0xCA, 0x8B, 0xF2, 0xC4, 0x4C, 0xD5, 0x1C, 0x82, 0x4E, 0x7A, 0x25,
+    0x1C, 0x02, 0xED, 0x3B, 0x97, 0xE2, 0x9B, 0xEE, 0xF4, 0x21, 0xC5, 0x07, 0xCD, 0xB3, 0x61, 0xA7,
+    0x5D, 0x34, 0xFB, 0x33, 0xFE, 0xFD, 0x2D, 0x9A, 0x7A, 0x37, 0xFE, 0xDE, 0x16, 0x0D, 0xA2, 0x22,
+    0x29, 0x7F, 0xF4, 0xF3, 0xFF, 0xE2, 0xD7, 0x55, 0xF1, 0xDD, 0x5F, 0xA0, 0xF6, 0x71, 0xD7, 0x83,
+    0xDC, 0xB5, 0x76, 0xE4, 0x67, 0x1E, 0x78, 0x7D, 0xFC, 0xAF, 0xD5, 0xB3, 0x77, 0xDF, 0x7B, 0xF2,
+    0x23, 0xFF, 0x1E, 0x87, 0x86, 0xBB, 0xE1, 0x23, 0x7C, 0x97, 0xD3, 0x43, 0xC0, 0x3E, 0xEE, 0x3D,
+    0x1F, 0xFD, 0x09, 0x2B, 0x5F, 0x3C, 0x7E, 0xED, 0xF5, 0xED, 0x6B, 0xD6, 0xFD, 0xD7, 0x63, 0xFC,
+    0xC6, 0xF7, 0xF2, 0xEC, 0xE2, 0x74, 0xDF, 0xEE, 0x0E, 0x3F, 0xD4, 0xA6, 0x0A, 0x95, 0x58, 0x02,
+    0x90, 0x3C, 0xE1, 0xB4, 0x07, 0x4C, 0xE4, 0x92, 0x02, 0x58, 0x89, 0x7C, 0x0A, 0x90, 0x47, 0x2E,
+    0x07, 0x58, 0xD3, 0x6E, 0x07, 0x60, 0x53, 0x3F, 0x5E, 0x02, 0xE4, 0x46, 0xBB, 0x89, 0x35, 0x61,
+    0xFD, 0xB4, 0xD1, 0x7F, 0xEA, 0x4E, 0x8F, 0x4D, 0xB5, 0x6A, 0x22, 0x1F, 0x56, 0x60, 0x73, 0x49,
+    0x3D, 0xEF, 0x57, 0x21, 0xE4, 0xEA, 0x5A, 0x6B, 0xBD, 0xA3, 0x2B, 0x2E, 0x27, 0x29, 0x72, 0x7D,
+    0xA5, 0xC8, 0x49, 0xC9, 0x93, 0x63, 0x6E, 0x87, 0x9C, 0x6E, 0xAA, 0x9F, 0x2F, 0xA9, 0x30, 0xB5,
+    0x92, 0x82, 0xF3, 0x28, 0xCB, 0xE1, 0x3D, 0x0E, 0x99, 0xAF, 0x07, 0xEB, 0x69, 0x72, 0xAC, 0x95,
+    0xD6, 0x9D, 0x55, 0x73, 0xF6, 0x6A, 0x18, 0xAF, 0x9B, 0x27, 0x2E, 0x87, 0x9D, 0xEE, 0xC1, 0xDD,
+    0xF8, 0xFE, 0x6A, 0x72, 0xCC, 0xD5, 0xDD, 0xF4, 0xE1, 0x67, 0xC2, 0x78, 0xDD, 0x9C, 0xBD, 0x1A,
+    0x06, 0x59, 0x72, 0xCC, 0x87, 0xB5, 0x83, 0xBA, 0xD5, 0x65, 0xDA, 0xAD, 0x47, 0xC1, 0xD8, 0xB1,
+    0xF6, 0xF7, 0x00, 0x10, 0x96, 0x75, 0x39, 0x4E, 0x5C, 0x65, 0x1E, 0x0A, 0x99, 0xF6, 0xDD, 0xD8,
+    0x3D, 0xB8, 0x48, 0x58, 0x1B, 0x55, 0xE6, 0xBA, 0x1C, 0x1B, 0x3B, 0x36, 0xC7, 0x82, 0x79, 0x28,
+    0x9C, 0x8E, 0x42, 0x37, 0x71, 0xDD, 0xD8, 0x05, 0x6D, 0xB7, 0xEF, 0x99, 0x07, 0x47, 0x88, 0x4B,
+    0x4E, 0x97, 0xF1, 0xE5, 0x72, 0xD0, 0xD6, 0x13, 0xAD, 0x50, 0x69, 0x9F, 0x16, 0xEB, 0xF4, 0xDA,
+    0x68, 0x63, 0x09, 0x77, 0x71, 0x90, 0x0E, 0xEB, 0x34, 0x89, 0x1F, 0xC4, 0x6E, 0x6D, 0x37, 0xF0,
+    0xC1, 0xDD, 0x6B, 0x91, 0x5D, 0x3B, 0x18, 0xBB, 0x52, 0x3F, 0x74, 0xAC, 0x50, 0xDE, 0xC0, 0xA9,
+    0x15, 0xF6, 0x2D, 0x6D, 0x93, 0xC6, 0x97, 0x43, 0x9A, 0xB8, 0xC0, 0xBD, 0xDB, 0x70, 0x6A, 0x05,
+    0xE5, 0x13, 0xF4, 0xB1, 0xB3, 0xEE, 0x9E, 0xD8, 0x95, 0x6B, 0x91, 0x5D, 0x3B, 0x0F, 0x77, 0xB7,
+    0x4E, 0x14, 0x1B, 0xC6, 0x76, 0x55, 0x48, 0xDC, 0x3A, 0xB5, 0xF6, 0x86, 0x5C, 0x85, 0xD8, 0x75,
+    0xD8, 0x89, 0x7C, 0x42, 0x4E, 0xD0, 0xEE, 0x20, 0x6B, 0x94, 0xB1, 0x5D, 0xE2, 0xA4, 0x72, 0xBB,
+    0x99, 0xF8, 0x25, 0xB6, 0xE3, 0x32, 0xB5, 0x83, 0x28, 0x28, 0xF6, 0xD1, 0xEF, 0xF7, 0x7B, 0x22,
+    0xAF, 0xF5, 0xFB, 0x1B, 0xFD, 0x47, 0xA7, 0x5B, 0x0B, 0x36, 0x3E, 0x30, 0xC7, 0x19, 0xA1, 0x8D,
+    0x1C, 0xC7, 0x45, 0xEB, 0xB9, 0xE7, 0xF3, 0x82, 0xC5, 0xB2, 0x35, 0x6C, 0xC9, 0xBC, 0x84, 0x6A,
+    0xED, 0xDB, 0xDF, 0xB9, 0x98, 0x6C, 0x52, 0x72, 0x51, 0x8B, 0xEB, 0x35, 0xEB, 0x97, 0xF4, 0xF5,
+    0x97, 0x08, 0x87, 0x52, 0x0C, 0x04, 0x55, 0xB2, 0xCA, 0x80, 0xD8, 0xA5, 0xA8, 0x10, 0x3B, 0x06,
+    0x2A, 0x90, 0x92, 0xA3, 0x5D, 0xFC, 0x2A, 0x67, 0x6C, 0xCF, 0xEA, 0x0A, 0x3B, 0x17, 0xD0, 0xA8,
+    0xE0, 0x01, 0xC6, 0x24, 0xCE, 0x38, 0x6A, 0x0E, 0xD1, 0x5A, 0xFA, 0xFD, 0x49, 0x49, 0xB7, 0xD7,
+    0x30, 0x5E, 0xBF, 0x44, 0x7D, 0xC8, 0x50, 0x61, 0x54, 0x60, 0x39, 0x2A, 0x19, 0x44, 0x5E, 0x05,
+    0xED, 0x62, 0xA7, 0x5D, 0x8A, 0x2E, 0x72, 0x62, 0x7B, 0xC6, 0xC6, 0xF4, 0x6C, 0xBC, 0x2B, 0xF1,
+    0x0F, 0x90, 0x30, 0x26, 0xB5, 0x0D, 0x19, 0x87, 0xD8, 0xD7, 0x06, 0xEB, 0xBB, 0xEA, 0x4B, 0xA4,
+    0x88, 0x37, 0xC5, 0x99, 0x46, 0x7B, 0x12, 0x1B, 0x88, 0xFC, 0x00, 0xC2, 0x2A, 0xEC, 0x24, 0x30,
+    0xD2, 0x8E, 0x9A, 0x92, 0x9A, 0x35, 0x36, 0x59, 0x62, 0xBD, 0x88, 0x49, 0x02, 0xB0, 0x31, 0x67,
+    0xED, 0x12, 0x69, 0x61, 0x8A, 0xD8, 0x69, 0x8F, 0x9D, 0x63, 0xF4, 0xB4, 0x54, 0x8F, 0xDF, 0x9C,
+    0x9E, 0x38, 0xA8, 0x26, 0xE1, 0xD0, 0x22, 0x4B, 0x99, 0x3C, 0xE4, 0x43, 0x6E, 0xCE, 0x5E, 0xAD,
+    0x06, 0x69, 0xF2, 0x4C, 0x68, 0xD6, 0x17, 0xA7, 0xE5, 0x4E, 0xD7, 0x68, 0x57, 0xAE, 0xDD, 0x13,
+    0xCF, 0x6D, 0xEF, 0xCF, 0xD2, 0xAB, 0xCC, 0x23, 0xCF, 0xF8, 0x3C, 0xD7, 0xCF, 0x16, 0xF9, 0x4E,
+    0xFC, 0x24, 0x3B, 0xC1, 0x24, 0x0F, 0xF9, 0x61, 0xAD, 0xA6, 0x80, 0xC5, 0x14, 0x4C, 0x31, 0xDB,
+    0xBC, 0xE5, 0xCC, 0x41, 0xC2, 0x29, 0xF3, 0xDB, 0xAF, 0xF6, 0x24, 0x90, 0x43, 0x49, 0x64, 0xE9,
+    0xDB, 0xAC, 0xD1, 0x5F, 0xB5, 0xA7, 0x48, 0x3C, 0x27, 0x1C, 0x1D, 0x54, 0x60, 0x99, 0xD8, 0x7D,
+    0x3A, 0xC4, 0xAF, 0xC2, 0xFE, 0x22, 0x9E, 0x46, 0x15, 0x23, 0xCC, 0x46, 0x24, 0x3E, 0x37, 0x71,
+    0xB1, 0xB3, 0x99, 0x1C, 0x73, 0x21, 0xBB, 0xC8, 0x25, 0xF6, 0xF7, 0x13, 0x79, 0xE5, 0x73, 0x95,
+    0xDB, 0x64, 0x8D, 0x9C, 0x55, 0x96, 0x31, 0xC4, 0x85, 0x76, 0x9C, 0x87, 0x9F, 0x43, 0x7C, 0xC8,
+    0xD7, 0x0E, 0x1A, 0xA3, 0x84, 0x9B, 0x2E, 0x6C, 0xEE, 0x98, 0xD5, 0xF8, 0xD9, 0xEB, 0x6E, 0x58,
+    0xF0, 0x41, 0xD2, 0x46, 0x3F, 0x53, 0x6E, 0x1B, 0x43, 0xA8, 0x0E, 0xC6, 0xD7, 0xFD, 0x5D, 0x63,
+    0x8C, 0x8D, 0xFD, 0xD1, 0x4A, 0xBF, 0xCA, 0x7E, 0xA5, 0xDF, 0x6E, 0xE2, 0x3F, 0x72, 0xE3, 0xDC,
+    0x3C, 0x5C, 0x84, 0xED, 0x25, 0xF3, 0x77, 0xDC, 0x74, 0xC5, 0x58, 0x35, 0x63, 0x58, 0xA7, 0xF1,
+    0x15, 0x97, 0x0F, 0xF4, 0x73, 0x36, 0x0F, 0xF1, 0x93, 0xEC, 0x84, 0x34, 0x79, 0xC2, 0xF5, 0x2A,
+    0x7E, 0x16, 0x38, 0x70, 0x59, 0xD4, 0x40, 0x95, 0x89, 0xCD, 0x09, 0xDA, 0x2D, 0x33, 0xCA, 0x9A,
+    0x23, 0x96, 0x61, 0x91, 0x5D, 0x8A, 0x1F, 0x0F, 0xF7, 0x2D, 0xA3, 0x3D, 0x3B, 0x74, 0x31, 0x36,
+    0x76, 0xD1, 0xDB, 0xC7, 0x7B, 0xE2, 0x8E, 0x58, 0x35, 0x8D, 0x6E, 0x3A, 0xBF, 0x4D, 0xCE, 0x69,
+    0x35, 0xE3, 0xEF, 0x7A, 0x36, 0x59, 0xE5, 0x84, 0x99, 0xA9, 0xA7, 0x40, 0x79, 0x32, 0xAB, 0x1A,
+    0x96, 0x82, 0xBA, 0xE6, 0x96, 0x0F, 0xAA, 0xF2, 0x94, 0x91, 0xE6, 0xC3, 0x17, 0xCE, 0xB5, 0x90,
+    0x57, 0xA1, 0xB6, 0x8A, 0x5E, 0xA3, 0x0B, 0x4E, 0x91, 0x54, 0x24, 0x9E, 0x65, 0x54, 0xC9, 0x2A,
+    0x69, 0x21, 0x5E, 0x6D, 0xC0, 0x51, 0x6F, 0x5E, 0xD5, 0x25, 0x15, 0xE9, 0x53, 0xFA, 0x7A, 0x58,
+    0x4B, 0x1E, 0x2E, 0x76, 0xD6, 0x12, 0x7D, 0xB5, 0x4C, 0x6B, 0x0E, 0xF3, 0xA1, 0xAD, 0x47, 0xE5,
+    0x15, 0x1B, 0x8A, 0x6D, 0x4E, 0xCD, 0xF9, 0x66, 0x48, 0xAC, 0x76, 0x6C, 0xA0, 0x2E, 0xA9, 0x3F,
+    0x2B, 0x43, 0xBE, 0xB6, 0x9C, 0xFC, 0x2E, 0x33, 0x75, 0xED, 0x6A, 0x99, 0x6F, 0x9B, 0x4E, 0x72,
+    0x56, 0x8A, 0x23, 0x30, 0xB1, 0xEB, 0xE3, 0xF8, 0xF1, 0x32, 0x18, 0x43, 0x18, 0x2D, 0x47, 0xE2,
+    0xD8, 0x24, 0x25, 0x75, 0xBD, 0x52, 0x6D, 0x2C, 0xC2, 0x6C, 0x0D, 0x27, 0xA4, 0xC1, 0x90, 0x93,
+    0xF2, 0x20, 0x1D, 0x0E, 0xED, 0x7A, 0x04, 0x43, 0x29, 0x98, 0x88, 0x65, 0xD4, 0x82, 0xD1, 0xBB,
+    0xDE, 0x2D, 0x48, 0xC5, 0xBD, 0x07, 0x8C, 0x2E, 0xB2, 0xD2, 0xB1, 0x58, 0xE2, 0xEB, 0x81, 0xD8,
+    0x0D, 0xD0, 0xDE, 0xA0, 0x82, 0x6A, 0x13, 0xA5, 0x5D, 0x50, 0x22, 0x8E, 0x13, 0xAF, 0x9F, 0x6B,
+    0x9D, 0x7F, 0x99, 0xA2, 0x2E, 0xF6, 0x5B, 0x04, 0x67, 0x80, 0x87, 0x0B, 0x65, 0x7B, 0x22, 0xC1,
+    0xFC, 0x1F, 0xA9, 0x95, 0x05, 0x98, 0x13, 0x97, 0xB6, 0x88, 0x3C, 0x9A, 0x3C, 0x16, 0x00, 0xA2,
+    0xD0, 0xE6, 0x9F, 0xD6, 0x19, 0xB7, 0x09, 0xA8, 0xC4, 0x6D, 0x03, 0x39, 0xA3, 0x65, 0x20, 0x76,
+    0x26, 0x7A, 0x8D, 0x9F, 0x67, 0xA4, 0x5F, 0x91, 0xD0, 0x0B, 0xE6, 0xB7, 0xEB, 0x1F, 0xFE, 0xDF,
+    0x46, 0x21, 0x35, 0x9B, 0x04, 0x52, 0x4B, 0x6C, 0x4D, 0xA1, 0x02, 0xEC, 0xD0, 0xA3, 0x03, 0x06,
+    0x1A, 0xED, 0xDB, 0x3C, 0x64, 0x17, 0x96, 0x0F, 0x9E, 0x5C, 0x49, 0xFF, 0x1C, 0x75, 0xF3, 0xB9,
+    0x17, 0x3E, 0x2B, 0x1E, 0x53, 0xF6, 0xF6, 0xE6, 0xB4, 0x36, 0xDA, 0x08, 0xA2, 0x92, 0x0B, 0x8E,
+    0x8B, 0x6C, 0x92, 0x12, 0x5B, 0xED, 0x39, 0xC4, 0x08, 0x38, 0xB1, 0xF5, 0x14, 0x46, 0x64, 0x5E,
+    0x45, 0x22, 0x33, 0xA2, 0xC9, 0x56, 0xD1, 0x26, 0x94, 0x52, 0xE6, 0x0E, 0x55, 0x52, 0x2A, 0x4F,
+    0x26, 0x0D, 0x0C, 0xF7, 0x14, 0x24, 0xC6, 0x05, 0x0C, 0x5A, 0x9D, 0xD7, 0xED, 0x6F, 0xFD, 0x9E,
+    0x88, 0xBC, 0xE2, 0xD9, 0xAF, 0x7D, 0x0B, 0x7F, 0xB5, 0xDD, 0x35, 0xA1, 0x3A, 0xD0, 0x0B, 0xFA,
+    0x6B, 0x21, 0x3F, 0x19, 0x1E, 0xBF, 0x5A, 0xC4, 0x96, 0x25, 0x38, 0x85, 0xF2, 0x7C, 0xCB, 0xE9,
+    0xE2, 0xD8, 0x59, 0x38, 0x10, 0xBF, 0xF0, 0xFB, 0xFD, 0xBF, 0x12, 0x91, 0x97, 0x2C, 0x69, 0xEB,
+    0x4B, 0xA4, 0xB7, 0x8A, 0x8E, 0xEE, 0xFB, 0xB6, 0x43, 0xCC, 0x4F, 0xEF, 0x59, 0x5A, 0x59, 0xFD,
+    0x57, 0x65, 0xE7, 0x1B, 0x64, 0x25, 0x9D, 0xC5, 0xB0, 0x89, 0x3D, 0xC5, 0x26, 0x3B, 0x71, 0xC1,
+    0xCE, 0xE9, 0x7E, 0xFF, 0x1D, 0x11, 0x79, 0xCB, 0x61, 0xB4, 0x23, 0x68, 0x67, 0x88, 0xF9, 0xC8,
+    0x62, 0x60, 0x1D, 0x18, 0x56, 0xF1, 0xD7, 0xAA, 0xFC, 0x54, 0xF8, 0xA8, 0xB7, 0xB7, 0x0D, 0x7C,
+    0xE7, 0xD2, 0x07, 0xF2, 0x53, 0xA1, 0xFB, 0x22, 0xBD, 0x40, 0x0F, 0x0E, 0xCD, 0x6F, 0x6F, 0x27,
+    0x78, 0xDB, 0xED, 0x1F, 0xF5, 0xC7, 0x9E, 0x7D, 0x54, 0x7F, 0x2D, 0x68, 0x41, 0x07, 0xF5, 0xD8,
+    0xE7, 0x32, 0x99, 0x1D, 0xE9, 0x6F, 0xC0, 0x06, 0x91, 0x27, 0xB1, 0xAC, 0xC2, 0x0E, 0x91, 0x23,
+    0x21, 0x5F, 0xD1, 0x6E, 0x3B, 0x8F, 0xAE, 0xBC, 0xF6, 0x58, 0x2A, 0x4D, 0x07, 0x56, 0x61, 0xB5,
+    0x35, 0x37, 0x1C, 0x9E, 0x3B, 0x9C, 0xCB, 0xB0, 0x89, 0x2A, 0xD1, 0x05, 0x07, 0x0D, 0x6B, 0x86,
+    0xD2, 0xE8, 0xCF, 0x9D, 0x30, 0x32, 0x25, 0x2A, 0x59, 0x26, 0x2A, 0xB9, 0x6B, 0xEE, 0x93, 0x00,
+    0x61, 0x1F, 0xB9, 0xC1, 0x18, 0xAB, 0xBF, 0x62, 0xB9, 0xF9, 0xFA, 0xD6, 0x44, 0x64, 0x96, 0xEF,
+    0x16, 0x59, 0x45, 0xC0, 0xA7, 0xDA, 0xC0, 0x73, 0xCE, 0x11, 0x2D, 0x32, 0x5B, 0xDF, 0xDA, 0xFA,
+    0x3D, 0x0F, 0x5A, 0x44, 0x8E, 0x89, 0xCC, 0xB4, 0x9B, 0x27, 0x82, 0x76, 0x99, 0x91, 0x87, 0xF8,
+    0xE5, 0xEA, 0xD7, 0x3E, 0xFB, 0xC5, 0x2F, 0xAF, 0xF8, 0xB5, 0x6D, 0x5E, 0x76, 0xFA, 0xB3, 0x1C,
+    0x5C, 0x61, 0xCF, 0xE9, 0xE1, 0x8D, 0xB6, 0x4A, 0x9F, 0xA0, 0x36, 0x08, 0x99, 0x48, 0xF8, 0x85,
+    0xAD, 0xAD, 0x00, 0xEA, 0xEB, 0x22, 0x92, 0x89, 0x84, 0x76, 0xB3, 0x04, 0x50, 0xF0, 0x2D, 0x4F,
+    0xCF, 0x4F, 0xA3, 0x2F, 0xAF, 0xBC, 0x52, 0x4F, 0xF4, 0xCB, 0x41, 0xBF, 0x88, 0x0E, 0x28, 0xE0,
+    0xDC, 0x07, 0x48, 0x8A, 0x11, 0x3B, 0x8C, 0x12, 0x91, 0xFA, 0x57, 0xB7, 0xB6, 0xFE, 0xC8, 0xC1,
+    0x5B, 0x22, 0x12, 0x8B, 0x54, 0x71, 0x91, 0xD8, 0xB8, 0xD8, 0x61, 0x1F, 0x96, 0xC3, 0xB0, 0x3F,
+    0x2D, 0xD0, 0xD7, 0x02, 0x51, 0xB8, 0x08, 0x95, 0x29, 0x18, 0x44, 0x81, 0x0E, 0x43, 0x11, 0x8C,
+    0x88, 0x8B, 0x82, 0xF6, 0xAC, 0x13, 0x30, 0x6E, 0x84, 0x0A, 0x39, 0xAC, 0x2F, 0x43, 0xF2, 0x9C,
+    0x85, 0x77, 0x1C, 0xF4, 0x3C, 0xC4, 0x61, 0x51, 0x0E, 0xDD, 0x32, 0x32, 0x9B, 0xD2, 0xF9, 0xA4,
+    0xDF, 0x47, 0x03, 0x69, 0x2B, 0xD5, 0x35, 0xBF, 0x78, 0x86, 0x89, 0x14, 0x75, 0x5C, 0x8E, 0xA8,
+    0x73, 0xBA, 0x1D, 0x8C, 0xB1, 0xF1, 0x15, 0x1F, 0x95, 0x15, 0xA1, 0xCB, 0xC8, 0xB8, 0x81, 0x9A,
+    0x35, 0x8B, 0x64, 0xCF, 0x91, 0xFE, 0x4F, 0x89, 0xDC, 0xDC, 0xBA, 0xE0, 0xC8, 0x60, 0x4C, 0xD4,
+    0x56, 0x12, 0xFC, 0xEA, 0xD6, 0x54, 0x64, 0x51, 0x54, 0xB0, 0xFB, 0x5F, 0x11, 0x91, 0x45, 0xEC,
+    0xEF, 0xC0, 0x53, 0xCA, 0x45, 0x22, 0x8F, 0xD2, 0x7B, 0x6D, 0x12, 0x74, 0x45, 0x56, 0x64, 0x20,
+    0x54, 0x98, 0xD3, 0x89, 0xA3, 0x1A, 0xAD, 0x63, 0x3E, 0x1A, 0x2A, 0xAA, 0xF8, 0x8A, 0x37, 0x45,
+    0x6A, 0xEC, 0x88, 0xC1, 0x7A, 0x52, 0x44, 0x61, 0x3C, 0xC2, 0x3C, 0x7E, 0xB3, 0x60, 0xA0, 0x1B,
+    0xE2, 0x32, 0x09, 0x0C, 0x19, 0xCE, 0x26, 0x65, 0xFC, 0x8C, 0x4C, 0xB9, 0xA3, 0x35, 0xB3, 0x1B,
+    0xF3, 0xB4, 0x43, 0x05, 0x49, 0x03, 0x66, 0x00, 0xAB, 0x5D, 0xC8, 0x33, 0xD8, 0x4C, 0x61, 0xC7,
+    0x14, 0x84, 0xC4, 0x45, 0x65, 0xEC, 0xB5, 0xD3, 0x65, 0xEC, 0xA2, 0x60, 0xAC, 0xAA, 0x0C, 0xD4,
+    0x1D, 0x18, 0xF7, 0x44, 0xA6, 0x3D, 0x91, 0xD9, 0xFE, 0x7E, 0xFF, 0xB8, 0x11, 0x91, 0x2B, 0xEF,
+    0xF6, 0x3F, 0xBD, 0xCB, 0x6E, 0x1D, 0xE8, 0x70, 0x1A, 0x83, 0x71, 0xF1, 0x7B, 0xD8, 0x5D, 0x7D,
+    0x57, 0x76, 0x73, 0xA4, 0x4F, 0x2C, 0xE2, 0xD3, 0x77, 0xB7, 0xCE, 0xA7, 0xAE, 0x4D, 0xCB, 0x25,
+    0x6E, 0x5E, 0x28, 0x11, 0x80, 0xF5, 0xAD, 0xAD, 0xAD, 0x54, 0x44, 0xAE, 0xF8, 0x7E, 0x7F, 0xA3,
+    0x9A, 0x97, 0xA7, 0xC6, 0x6E, 0x11, 0x49, 0x2B, 0xDB, 0xD4, 0xAD, 0x8D, 0x44, 0x7C, 0xFB, 0xC4,
+    0xFE, 0xD3, 0x56, 0x89, 0x54, 0xF1, 0xEC, 0xC2, 0xE7, 0xE3, 0xA0, 0x9D, 0x2E, 0x55, 0x19, 0x05,
+    0x2A, 0x6A, 0x72, 0x72, 0x96, 0x31, 0x5B, 0x17, 0x5E, 0x7F, 0x42, 0x44, 0x42, 0xF5, 0x43, 0xAF,
+    0x1D, 0xEF, 0xB2, 0x83, 0x29, 0x72, 0x54, 0x58, 0x86, 0x5E, 0x62, 0xD1, 0x37, 0x1D, 0x64, 0x22,
+    0x1E, 0x91, 0x8A, 0xFC, 0x56, 0x07, 0x0C, 0xEC, 0xEF, 0xF7, 0xC9, 0x44, 0xFC, 0xF0, 0xF5, 0xAD,
+    0xF3, 0x67, 0xE6, 0x81, 0x05, 0x63, 0x41, 0xBF, 0xBE, 0x75, 0xE1, 0xAA, 0x88, 0xD4, 0xDD, 0x79,
+    0xB5, 0x41, 0x54, 0x01, 0xBD, 0x73, 0x10, 0x89, 0x88, 0x4D, 0x44, 0xFC, 0x91, 0x3E, 0xA4, 0x22,
+    0x36, 0xDA, 0x7A, 0x7A, 0xBA, 0x48, 0xD9, 0x8F, 0x17, 0x77, 0x07, 0x20, 0xFF, 0xF0, 0xD6, 0xD6,
+    0x05, 0x23, 0x22, 0x57, 0xFB, 0xFD, 0x8F, 0x86, 0x3D, 0xA5, 0x19, 0x66, 0x9E, 0x78, 0xCA, 0xDC,
+    0x50, 0xA4, 0x48, 0x65, 0xD6, 0xEE, 0xD1, 0xFD, 0x6F, 0x5B, 0x62, 0x11, 0xCF, 0xD3, 0xAF, 0x8B,
+    0x25, 0xE8, 0x8A, 0x55, 0x32, 0x62, 0xA7, 0x4B, 0x02, 0x63, 0x56, 0x31, 0x77, 0x5D, 0x78, 0xFD,
+    0xE9, 0x2B, 0x22, 0x52, 0xF5, 0x7F, 0x71, 0x63, 0x40, 0x5C, 0xA4, 0x10, 0x12, 0xC7, 0xAA, 0xF6,
+    0xC4, 0x67, 0x03, 0xDC, 0x0C, 0xA9, 0x48, 0x19, 0xB7, 0x39, 0xDE, 0x30, 0x0F, 0x8D, 0xCD, 0xD3,
+    0x61, 0xA9, 0x48, 0x19, 0x6D, 0x6D, 0x89, 0x9D, 0x53, 0xD7, 0x03, 0xE2, 0xCB, 0xB3, 0xAD, 0xAD,
+    0x30, 0x11, 0x99, 0xEE, 0x09, 0xFA, 0xC5, 0x25, 0x1C, 0x0D, 0x43, 0x91, 0x32, 0x15, 0x29, 0xE8,
+    0xF7, 0xFB, 0xFD, 0x9F, 0x12, 0x11, 0xB9, 0x3C, 0xDB, 0x7A, 0xBA, 0x8A, 0x02, 0x89, 0x4B, 0x1C,
+    0x59, 0x2B, 0xEF, 0x63, 0xA2, 0xF0, 0xB7, 0xFB, 0xD7, 0x89, 0x5A, 0x4D, 0x5E, 0x91, 0x60, 0xC4,
+    0xED, 0xEF, 0xF7, 0x37, 0x26, 0x22, 0xCF, 0xCF, 0xB6, 0x2E, 0x1C, 0xAB, 0xE8, 0xC4, 0x81, 0xB5,
+    0xA4, 0xA4, 0x48, 0x7C, 0xCB, 0xAC, 0xD4, 0x41, 0x56, 0xB4, 0x74, 0xD7, 0xCC, 0xFB, 0x07, 0x76,
+    0x33, 0x71, 0x81, 0xC3, 0x29, 0x84, 0x8A, 0xF8, 0x2B, 0x5F, 0xED, 0x5F, 0x1A, 0x8A, 0x54, 0x32,
+    0xCF, 0x74, 0x1F, 0xE9, 0xF7, 0x45, 0xDE, 0xEC, 0xF7, 0xE7, 0xE1, 0xD9, 0xBC, 0x6D, 0x46, 0x0A,
+    0xD0, 0x6D, 0xCD, 0x5E, 0x80, 0xD5, 0xDD, 0x6A, 0xD5, 0xE5, 0xF6, 0x6C, 0x04, 0xA6, 0x85, 0xFB,
+    0x9B, 0xED, 0x59, 0x39, 0x8F, 0x1F, 0x41, 0x4E, 0xE4, 0x58, 0x86, 0x40, 0x62, 0x59, 0x43, 0x3B,
+    0x96, 0x20, 0x90, 0xC0, 0x26, 0xDA, 0xB1, 0x0A, 0x25, 0x66, 0x1E, 0x0A, 0xC8, 0xE7, 0x5D, 0x18,
+    0xB0, 0x06, 0x6B, 0xDC, 0xBF, 0x76, 0xFF, 0x99, 0x1F, 0x6F, 0x12, 0xF1, 0xCC, 0x88, 0xC5, 0xF7,
+    0x7E, 0xBC, 0x7E, 0x70, 0xED, 0x81, 0xF6, 0x23, 0x00, 0x1B, 0xC9, 0x43, 0xAF, 0x55, 0x61, 0x79,
+    0x53, 0x7F, 0x99, 0x57, 0xFC, 0xCE, 0xB0, 0x56, 0xE7, 0x39, 0x3C, 0x9D, 0x6E, 0xB2, 0xF8, 0xE2,
+    0x56, 0x80, 0xE6, 0x18, 0x48, 0x85, 0x96, 0x2C, 0xED, 0x5B, 0x92, 0xE3, 0x62, 0xAB, 0x48, 0xAC,
+    0x38, 0xC3, 0xC7, 0x7D, 0x8A, 0x2E, 0x57, 0x5B, 0xBD, 0x58, 0xE5, 0x50, 0x8F, 0xDA, 0x82, 0xF0,
+    0x3C, 0xB4, 0x71, 0xE2, 0xCC, 0xB7, 0xDC, 0x34, 0xC5, 0xBC, 0x31, 0x0B, 0x35, 0x8D, 0xAE, 0xCA,
+    0xCB, 0x65, 0xE8, 0xF8, 0x35, 0x5D, 0x1E, 0x64, 0xA4, 0xDD, 0xAF, 0xD9, 0x4B, 0x75, 0x9D, 0x54,
+    0x89, 0x05, 0x92, 0x32, 0x29, 0xB3, 0xA6, 0x57, 0xAF, 0x99, 0x90, 0x9F, 0x8A, 0xDD, 0xCA, 0xA9,
+    0xD8, 0xAD, 0x6C, 0x1E, 0x0C, 0xF9, 0xFA, 0xF8, 0x4C, 0x65, 0xCA, 0xB4, 0x6C, 0x6D, 0x5B, 0x4B,
+    0xE1, 0xDF, 0xE4, 0xB7, 0xDB, 0xEF, 0x1F, 0xEF, 0x89, 0x48, 0x4F, 0x64, 0x51, 0x26, 0xA3, 0x8B,
+    0xF9, 0x66, 0x4A, 0x6D, 0x2B, 0x90, 0x34, 0x73, 0x91, 0x4D, 0x7C, 0x1B, 0xFF, 0x6E, 0x77, 0xAA,
+    0x9B, 0x0B, 0xF3, 0xE9, 0xF9, 0xBE, 0xD3, 0x01, 0xB8, 0xD8, 0xEF, 0x1F, 0xCF, 0x44, 0xE4, 0x59,
+    0x11, 0x69, 0x7E, 0xEA, 0xC5, 0xD3, 0xEF, 0xDC, 0xFE, 0xF3, 0xCD, 0xE2, 0xF0, 0xBE, 0xBC, 0xF3,
+    0xFE, 0x5E, 0x0F, 0x7C, 0xB0, 0xF5, 0x80, 0x1A, 0xA0, 0x67, 0xDB, 0x3A, 0x5B, 0x93, 0x43, 0xFC,
+    0x5C, 0x41, 0x74, 0x35, 0xB4, 0x65, 0x2E, 0x9B, 0x49, 0x41, 0x77, 0x5E, 0xB9, 0x94, 0x14, 0xB1,
+    0xD3, 0x8E, 0xA0, 0x02, 0x1D, 0x6A, 0x62, 0x97, 0x43, 0x95, 0x41, 0x66, 0x2C, 0xDA, 0x1D, 0x86,
+    0xFD, 0xA6, 0x20, 0xBE, 0x1C, 0x88, 0xCA, 0x2E, 0x54, 0x49, 0xC1, 0x40, 0x05, 0xBA, 0x74, 0x31,
+    0xC4, 0x45, 0x52, 0x10, 0xB4, 0x67, 0x55, 0x05, 0x62, 0x37, 0x82, 0x90, 0x43, 0x27, 0x05, 0xFD,
+    0x95, 0xB9, 0xCA, 0x4D, 0x4B, 0xD0, 0x8B, 0xDA, 0xFE, 0x5F, 0x78, 0x0A, 0x23, 0x0D, 0xB3, 0x8F,
+    0x35, 0x89, 0xA3, 0xEE, 0xA2, 0xDE, 0x0C, 0xE8, 0x3F, 0x75, 0x98, 0x4F, 0xB6, 0x79, 0xB9, 0xB7,
+    0xBF, 0xEB, 0xA5, 0x3F, 0x0C, 0x3F, 0xF9, 0x7E, 0x1E, 0xAA, 0x02, 0xFA, 0x4A, 0x49, 0x96, 0x78,
+    0x55, 0x27, 0xEF, 0x4E, 0x8A, 0x58, 0x2A, 0x38, 0x3E, 0x17, 0x84, 0xAC, 0x26, 0x7E, 0xC1, 0x51,
+    0xDD, 0xBF, 0x07, 0xE8, 0xBD, 0xEF, 0x3F, 0x51, 0xE0, 0x50, 0x87, 0xF8, 0x59, 0xC7, 0xB0, 0x42,
+    0xFD, 0xFE, 0x22, 0x68, 0xE1, 0x5A, 0x45, 0x7B, 0x7B, 0xF2, 0xF9, 0x5B, 0x8E, 0x01, 0xD4, 0x33,
+    0x54, 0x33, 0x45, 0x35, 0x87, 0xDA, 0x38, 0x12, 0x17, 0xA1, 0x99, 0xA1, 0x9A, 0x31, 0xD4, 0xDF,
+    0xF1, 0xE1, 0x64, 0xCF, 0x77, 0x28, 0x88, 0xCF, 0xBE, 0x59, 0xCF, 0xA3, 0x34, 0xFB, 0x93, 0x6B,
+    0xD5, 0x88, 0xF7, 0x33, 0xD8, 0xB7, 0x23, 0xE4, 0xBD, 0xEE, 0xF2, 0x06, 0xF4, 0xEA, 0xE8, 0xCA,
+    0x6B, 0x72, 0xF1, 0x1E, 0x4E, 0x2C, 0xB0, 0xBE, 0xEA, 0xF7, 0xFB, 0x46, 0xA4, 0x39, 0xD2, 0xEF,
+    0x6F, 0x2C, 0xE6, 0x2E, 0xD2, 0xF4, 0x44, 0xC2, 0x5D, 0x76, 0x5F, 0xAF, 0x5A, 0xFD, 0xD2, 0xA4,
+    0xD9, 0x4E, 0x2B, 0xB0, 0x59, 0xB9, 0x34, 0x9C, 0x0D, 0x42, 0x56, 0x1F, 0x8A, 0xCE, 0xDD, 0x0F,
+    0x9F, 0x12, 0x11, 0xF7, 0x69, 0x79, 0x6A, 0x37, 0x67, 0x2B, 0x7F, 0xA1, 0x45, 0xE4, 0x4E, 0xF8,
+    0x00, 0x58, 0xE2, 0x87, 0xB6, 0x2E, 0xFD, 0x67, 0x91, 0x56, 0x4F, 0x25, 0xA4, 0x22, 0x7F, 0xEF,
+    0xF5, 0xCF, 0xAF, 0xC0, 0x06, 0x7C, 0x78, 0x6B, 0xEB, 0xFC, 0x42, 0x69, 0xB6, 0x7A, 0x73, 0x43,
+    0x44, 0x2E, 0xB7, 0x95, 0x54, 0x73, 0x17, 0x4D, 0xAE, 0xB4, 0x7B, 0xF4, 0x3E, 0xA2, 0x9A, 0xAC,
+    0x8C, 0x66, 0x64, 0x9E, 0x33, 0x90, 0x79, 0xA2, 0x29, 0x0C, 0x3D, 0x71, 0xDD, 0x56, 0x18, 0x02,
+    0x43, 0xA9, 0x87, 0xD2, 0xDC, 0x07, 0xEB, 0x90, 0x95, 0x44, 0xB3, 0xF6, 0xBE, 0x86, 0xA8, 0x21,
+    0xF3, 0x07, 0xA6, 0xF4, 0x7C, 0x5B, 0xFD, 0x79, 0xEB, 0xE6, 0xF9, 0xC5, 0x9D, 0x44, 0x05, 0x99,
+    0x4B, 0x02, 0x13, 0x9B, 0xF9, 0x68, 0xCA, 0xC4, 0x26, 0x55, 0x34, 0x25, 0x0E, 0x34, 0x30, 0x2C,
+    0xD2, 0x12, 0x35, 0x63, 0x58, 0x10, 0xD7, 0x6A, 0x06, 0x99, 0x8B, 0x03, 0x9C, 0x6F, 0x51, 0xF6,
+    0x6E, 0x89, 0xB4, 0x2A, 0xD0, 0x35, 0x33, 0x48, 0xCB, 0xB8, 0xBE, 0xED, 0x29, 0xE3, 0x74, 0x45,
+    0xE6, 0x93, 0xEA, 0xD6, 0xF0, 0xBA, 0x62, 0x76, 0xDB, 0x10, 0x47, 0xFA, 0x1B, 0x7B, 0x4D, 0xA6,
+    0x0E, 0x7B, 0x51, 0x4A, 0xD8, 0xD3, 0x87, 0xB0, 0x00, 0x36, 0x71, 0x18, 0x8A, 0x84, 0x54, 0xE4,
+    0xDC, 0x7B, 0x04, 0x80, 0xD5, 0xF6, 0x4E, 0xF5, 0xF1, 0xAF, 0xCE, 0xA1, 0xC6, 0xBB, 0xE7, 0x7B,
+    0xE4, 0x64, 0x74, 0x30, 0xD6, 0xA0, 0x9D, 0x76, 0x2A, 0xA8, 0x92, 0x9C, 0x0A, 0x53, 0xE4, 0x44,
+    0x61, 0x19, 0x7A, 0x8F, 0x5A, 0xB4, 0x88, 0xD8, 0xA3, 0x22, 0x9E, 0x9D, 0xB9, 0xAA, 0x5C, 0x5E,
+    0xF4, 0xD2, 0xDE, 0x92, 0xD6, 0x79, 0xA5, 0x17, 0x81, 0x23, 0xFD, 0xD1, 0x9C, 0xE4, 0x89, 0x58,
+    0xE2, 0xB3, 0xA1, 0x2D, 0x29, 0x0E, 0xB1, 0x63, 0x93, 0x85, 0x72, 0x31, 0xC4, 0x45, 0xE2, 0x22,
+    0xAF, 0x4B, 0xC2, 0x1E, 0x92, 0x17, 0x1D, 0x15, 0x91, 0x5F, 0xB4, 0x1D, 0xCD, 0xA5, 0x70, 0x17,
+    0x1D, 0xF5, 0xF6, 0x80, 0x97, 0x45, 0xDF, 0x0E, 0xF9, 0x5E, 0xBC, 0xD3, 0xB3, 0xEC, 0x21, 0x79,
+    0x51, 0xA0, 0x21, 0x22, 0x8F, 0x88, 0x88, 0xFF, 0x7E, 0x30, 0x74, 0x28, 0x32, 0x4B, 0x45, 0xA4,
+    0x68, 0x35, 0x82, 0x88, 0x23, 0x7D, 0xF8, 0x61, 0xAF, 0xCA, 0xA5, 0xC8, 0x1F, 0xE4, 0x54, 0xE4,
+    0xB6, 0x95, 0xD7, 0x67, 0x8B, 0xD8, 0x26, 0xF7, 0xB2, 0xC4, 0xD2, 0x2F, 0xF5, 0xBF, 0xD4, 0xFF,
+    0x65, 0x11, 0x91, 0xAF, 0xDB, 0xD8, 0xC6, 0x9F, 0x60, 0x89, 0xA5, 0x35, 0x4E, 0xB1, 0xBD, 0xAD,
+    0xBC, 0x2E, 0xCA, 0xD8, 0xE6, 0xAA, 0x5C, 0xD2, 0x5E, 0xD5, 0xA7, 0x2E, 0xB6, 0x95, 0x73, 0x6D,
+    0xB1, 0xDD, 0xAD, 0xA1, 0x6D, 0xEC, 0x55, 0x49, 0xE4, 0x0F, 0xB6, 0x05, 0x11, 0xE8, 0xB3, 0x05,
+    0x24, 0xF7, 0x02, 0x4B, 0xBF, 0xD4, 0xEF, 0x2F, 0x86, 0x86, 0xF8, 0x13, 0xC0, 0xD2, 0x1A, 0xB0,
+    0xBD, 0x0D, 0xBA, 0x08, 0x90, 0xAB, 0x12, 0xED, 0x55, 0xCD, 0x77, 0x18, 0x3A, 0xA0, 0xBD, 0x29,
+    0xC9, 0xDC, 0x17, 0xCA, 0xE8, 0xDA, 0xD9, 0xCF, 0x94, 0xAB, 0xC9, 0xBD, 0xD1, 0xCB, 0x7E, 0xE9,
+    0x64, 0x34, 0xE5, 0xC7, 0x9C, 0x0E, 0x7C, 0x9D, 0x4E, 0xA9, 0x3F, 0x11, 0x3D, 0x5F, 0x2E, 0xAD,
+    0xAD, 0x46, 0xE5, 0xF6, 0x17, 0x7C, 0xF4, 0x4A, 0x31, 0x25, 0x6A, 0x54, 0xF8, 0xAE, 0x43, 0x97,
+    0x68, 0x7F, 0x10, 0x32, 0xB7, 0x4D, 0x74, 0xED, 0x6C, 0xC1, 0x6A, 0xB2, 0x44, 0xE4, 0x97, 0x4E,
+    0xB2, 0xCA, 0x8F, 0xB9, 0xC8, 0xF3, 0x75, 0x56, 0xD1, 0x9F, 0x88, 0x3C, 0x4B, 0x6B, 0xAB, 0xB0,
+    0xFD, 0x05, 0x8F, 0x2E, 0xA6, 0x90, 0x7F, 0xFB, 0xA1, 0xE7, 0x49, 0xAE, 0x51, 0x8B, 0x38, 0x92,
+    0xE2, 0x7B, 0xBB, 0xDC, 0xFF, 0xB1, 0xD7, 0x8E, 0x4F, 0x44, 0xDE, 0x15, 0x91, 0xF2, 0xD0, 0xC5,
+    0xD9, 0x78, 0x1F, 0xFB, 0xD8, 0x9F, 0x3A, 0xE3, 0x92, 0x17, 0x82, 0x0E, 0xBA, 0xAE, 0xA8, 0xDB,
+    0xA2, 0xE9, 0xB9, 0xA0, 0x9C, 0x9B, 0x14, 0x90, 0x88, 0x4C, 0x80, 0x9D, 0xB8, 0x3A, 0x0C, 0xB1,
+    0x8B, 0x1D, 0xD0, 0x6D, 0xBD, 0xFE, 0x40, 0x35, 0x97, 0xA7, 0x02, 0x2D, 0x2D, 0x66, 0xDD, 0x61,
+    0x04, 0xE8, 0x79, 0x24, 0xBF, 0xAD, 0xD7, 0x1D, 0x90, 0x03, 0x51, 0xA9, 0x4A, 0xC0, 0xD8, 0xA4,
+    0x00, 0x72, 0xBA, 0x6D, 0x47, 0x48, 0x60, 0x77, 0xD8, 0x4E, 0x3B, 0x6C, 0xC5, 0x4E, 0x3B, 0x84,
+    0x03, 0xD2, 0x45, 0xA0, 0x64, 0x07, 0x92, 0xF8, 0xC6, 0xD1, 0x02, 0x7A, 0x53, 0xA9, 0x81, 0x61,
+    0xD1, 0xDF, 0xBB, 0xED, 0x22, 0x29, 0x20, 0xB9, 0x5E, 0x41, 0x52, 0x74, 0x21, 0x76, 0x6A, 0x51,
+    0x88, 0x1C, 0x80, 0x48, 0xA4, 0x42, 0x8B, 0x4C, 0xC1, 0x58, 0xB3, 0x18, 0x3D, 0x44, 0x01, 0x06,
+    0x54, 0xD0, 0x21, 0x07, 0x63, 0x53, 0xD0, 0x2E, 0x29, 0x50, 0x41, 0x5F, 0x85, 0x01, 0xDF, 0x74,
+    0x74, 0x18, 0x7A, 0x8C, 0x35, 0x6E, 0xDE, 0x99, 0x15, 0x16, 0x5D, 0xBD, 0xDB, 0x03, 0xA0, 0xD7,
+    0xB4, 0xCD, 0x29, 0x7B, 0x8F, 0xC9, 0x14, 0xB8, 0x34, 0xF1, 0xF3, 0x8E, 0x81, 0x76, 0x72, 0x55,
+    0x0B, 0x61, 0x8D, 0x25, 0x11, 0x1F, 0xD0, 0xD2, 0xA4, 0xA0, 0x7D, 0x8B, 0x63, 0xBB, 0x0B, 0x82,
+    0x06, 0x6D, 0x6F, 0xEF, 0xED, 0x0F, 0xA8, 0x40, 0xB0, 0xA4, 0xA4, 0x39, 0x51, 0x19, 0x09, 0x74,
+    0x49, 0xE7, 0xD4, 0xDC, 0xAA, 0x71, 0x8F, 0x2E, 0x87, 0x05, 0x39, 0xEA, 0xF6, 0xBE, 0x56, 0xA2,
+    0x1B, 0x2D, 0x6F, 0xE4, 0xEB, 0xD7, 0x6B, 0x48, 0xEC, 0xB0, 0x58, 0x85, 0xD8, 0xE9, 0x96, 0x43,
+    0x6D, 0x62, 0xAC, 0x5D, 0xCA, 0x48, 0x64, 0xCE, 0x27, 0x91, 0x19, 0x24, 0x36, 0x29, 0x8C, 0x45,
+    0x3B, 0xED, 0xB5, 0x83, 0x40, 0x50, 0xA1, 0xA5, 0x71, 0x04, 0x1D, 0x96, 0xE9, 0xB6, 0xCB, 0xD9,
+    0xF2, 0xD3, 0xC7, 0x0E, 0x15, 0x08, 0xFA, 0x25, 0x18, 0x2C, 0x78, 0xD7, 0xA1, 0xE7, 0x31, 0x36,
+    0xB1, 0xC6, 0x2F, 0x56, 0x54, 0x85, 0x96, 0x87, 0x35, 0x3B, 0xC0, 0xF6, 0xF0, 0x3F, 0x8E, 0xD8,
+    0x5D, 0xD3, 0xB8, 0xDE, 0xBF, 0xF1, 0x1E, 0x83, 0x7D, 0xC9, 0x4E, 0xBE, 0x01, 0x4C, 0x66, 0x67,
+    0x26, 0x1E, 0x56, 0xD5, 0x8C, 0xBC, 0xA5, 0x5E, 0xCF, 0x99, 0x34, 0x68, 0xD9, 0x94, 0x14, 0x24,
+    0x22, 0x52, 0xB6, 0xE4, 0x4F, 0x0D, 0x44, 0x3E, 0x2A, 0x55, 0x68, 0xF9, 0xDB, 0x69, 0x39, 0xAC,
+    0x7D, 0x4B, 0x7F, 0xCB, 0xE5, 0x5D, 0x3E, 0xCF, 0x39, 0x3D, 0xE7, 0x35, 0x95, 0x25, 0x25, 0xC5,
+    0xE4, 0x44, 0x65, 0x54, 0x2A, 0xB1, 0x74, 0x59, 0xC5, 0xB8, 0xC5, 0x0C, 0x18, 0xCC, 0xF9, 0x5E,
+    0x24, 0x16, 0xA2, 0xCB, 0xB3, 0x7F, 0x5C, 0xDE, 0x9A, 0x82, 0x9A, 0xA9, 0xE3, 0xB7, 0x4D, 0x60,
+    0xE8, 0x01, 0x75, 0x33, 0x00, 0xDA, 0x15, 0x40, 0x5C, 0xC4, 0x76, 0x2E, 0x86, 0x18, 0xD2, 0xD6,
+    0xB5, 0x9E, 0xA2, 0xDB, 0x5E, 0xC0, 0xEE, 0x1C, 0x85, 0xB7, 0xEF, 0x03, 0x60, 0xC0, 0x08, 0x18,
+    0x51, 0x01, 0x55, 0xDB, 0x98, 0xA8, 0x02, 0xA8, 0xA0, 0xCA, 0xFB, 0x51, 0x21, 0x7A, 0xB3, 0x22,
+    0x2A, 0x23, 0x29, 0xD1, 0x9E, 0x79, 0xF7, 0xD3, 0xA2, 0x12, 0xDF, 0x58, 0x60, 0x25, 0x65, 0x21,
+    0x1A, 0x6D, 0x71, 0x0C, 0xC0, 0x91, 0x02, 0x22, 0x09, 0xA0, 0x7D, 0x0E, 0xDA, 0x2D, 0x03, 0x21,
+    0xB1, 0x1C, 0x6D, 0x8E, 0x8A, 0xCB, 0x24, 0x95, 0x72, 0x59, 0xD9, 0x01, 0xC6, 0xD2, 0x99, 0xF7,
+    0x59, 0xF4, 0xAC, 0x76, 0xC4, 0x35, 0x01, 0x7A, 0x76, 0x00, 0x3A, 0x74, 0x88, 0x18, 0x18, 0xFB,
+    0x4C, 0xB9, 0xAA, 0xAF, 0x86, 0xC9, 0x7F, 0x47, 0x42, 0x32, 0xBD, 0xF5, 0x0D, 0x8B, 0xCE, 0xE4,
+    0x16, 0x7B, 0xB4, 0x4D, 0x43, 0xC3, 0x1A, 0xE0, 0x54, 0x5A, 0x00, 0xA7, 0xD8, 0x04, 0x4E, 0xEF,
+    0x4B, 0x0A, 0x18, 0x4A, 0x59, 0xC3, 0x50, 0xA6, 0x59, 0xC1, 0x50, 0xE4, 0x89, 0x9A, 0xA1, 0xC8,
+    0x4B, 0x52, 0x0C, 0x45, 0x8A, 0x49, 0x9D, 0x49, 0x4D, 0x6F, 0x16, 0x49, 0xC3, 0x64, 0x46, 0x26,
+    0x0F, 0xC9, 0x8C, 0x48, 0x5E, 0x96, 0x19, 0x64, 0xCD, 0x64, 0xC6, 0xBC, 0xA9, 0x87, 0xEC, 0xF9,
+    0x19, 0x10, 0x85, 0x75, 0x80, 0xD5, 0xCE, 0x9E, 0x16, 0xEF, 0xCE, 0x6E, 0xF0, 0xEE, 0xFF, 0x01,
 };
 
 static const EpdGlyph bookerly_12_italicGlyphs[] = {
@@ -1639,7 +1657,7 @@ static const EpdGlyph bookerly_12_italicGlyphs[] = {
     { 7, 23, 7, 0, 20, 41, 5774 }, // |
     { 10, 25, 10, -1, 20, 63, 5815 }, // }
     { 12, 5, 16, 2, 11, 15, 5878 }, // ~
-    { 0, 0, 5, 0, 0, 0, 0 }, //  
+    { 0, 0, 5, 0, 0, 0, 5893 }, //  
     { 8, 20, 8, -1, 14, 40, 0 }, // ¡
     { 12, 25, 16, 2, 20, 75, 40 }, // ¢
     { 17, 19, 16, -1, 18, 81, 115 }, // £
@@ -1650,642 +1668,649 @@ static const EpdGlyph bookerly_12_italicGlyphs[] = {
     { 9, 4, 15, 3, 19, 9, 429 }, // ¨
     { 19, 19, 20, 0, 18, 91, 438 }, // ©
     { 10, 12, 11, 1, 18, 30, 529 }, // ª
-    { 13, 10, 13, 0, 11, 33, 559 }, // «
-    { 11, 7, 16, 2, 12, 20, 592 }, // ¬
-    { 8, 3, 9, 1, 8, 6, 612 }, // ­
-    { 14, 14, 15, 0, 20, 49, 618 }, // ®
-    { 9, 3, 15, 3, 18, 7, 667 }, // ¯
-    { 9, 9, 13, 2, 18, 21, 674 }, // °
-    { 11, 15, 16, 2, 15, 42, 695 }, // ±
-    { 10, 12, 11, 0, 21, 30, 737 }, // ²
-    { 9, 12, 11, 1, 21, 27, 767 }, // ³
-    { 6, 7, 15, 5, 21, 11, 794 }, // ´
-    { 16, 21, 15, -1, 14, 84, 805 }, // µ
-    { 16, 22, 15, -1, 18, 88, 889 }, // ¶
-    { 4, 4, 8, 2, 9, 4, 977 }, // ·
-    { 6, 6, 15, 5, -1, 9, 981 }, // ¸
-    { 7, 12, 11, 2, 21, 21, 990 }, // ¹
-    { 10, 12, 11, 1, 18, 30, 1011 }, // º
-    { 12, 10, 13, 0, 11, 30, 1041 }, // »
-    { 24, 21, 27, 2, 19, 126, 1071 }, // ¼
-    { 24, 21, 27, 2, 19, 126, 1197 }, // ½
-    { 25, 21, 27, 1, 19, 132, 1323 }, // ¾
-    { 9, 20, 10, 0, 14, 45, 1455 }, // ¿
-    { 19, 24, 18, -2, 24, 114, 1500 }, // À
-    { 19, 24, 18, -2, 24, 114, 1614 }, // Á
-    { 19, 24, 18, -2, 24, 114, 1728 }, // Â
-    { 19, 24, 18, -2, 24, 114, 1842 }, // Ã
-    { 19, 23, 18, -2, 23, 110, 1956 }, // Ä
-    { 19, 25, 18, -2, 25, 119, 2066 }, // Å
-    { 25, 18, 22, -2, 18, 113, 2185 }, // Æ
-    { 15, 25, 16, 1, 18, 94, 2298 }, // Ç
-    { 17, 24, 15, -1, 24, 102, 2392 }, // È
-    { 17, 24, 15, -1, 24, 102, 2494 }, // É
-    { 17, 24, 15, -1, 24, 102, 2596 }, // Ê
-    { 17, 23, 15, -1, 23, 98, 2698 }, // Ë
-    { 11, 24, 9, -1, 24, 66, 2796 }, // Ì
-    { 12, 24, 9, -1, 24, 72, 2862 }, // Í
-    { 13, 24, 9, -1, 24, 78, 2934 }, // Î
-    { 13, 23, 9, -1, 23, 75, 3012 }, // Ï
-    { 19, 19, 18, -1, 18, 91, 3087 }, // Ð
-    { 21, 25, 19, -1, 24, 132, 3178 }, // Ñ
-    { 17, 25, 18, 1, 24, 107, 3310 }, // Ò
-    { 17, 25, 18, 1, 24, 107, 3417 }, // Ó
-    { 17, 25, 18, 1, 24, 107, 3524 }, // Ô
-    { 17, 25, 18, 1, 24, 107, 3631 }, // Õ
-    { 17, 24, 18, 1, 23, 102, 3738 }, // Ö
-    { 10, 11, 16, 3, 14, 28, 3840 }, // ×
-    { 20, 19, 18, -1, 18, 95, 3868 }, // Ø
-    { 18, 25, 19, 2, 24, 113, 3963 }, // Ù
-    { 18, 25, 19, 2, 24, 113, 4076 }, // Ú
-    { 18, 25, 19, 2, 24, 113, 4189 }, // Û
-    { 18, 24, 19, 2, 23, 108, 4302 }, // Ü
-    { 17, 24, 16, 1, 24, 102, 4410 }, // Ý
-    { 15, 18, 15, -1, 18, 68, 4512 }, // Þ
-    { 20, 26, 16, -4, 20, 130, 4580 }, // ß
-    { 13, 22, 15, 1, 21, 72, 4710 }, // à
-    { 13, 22, 15, 1, 21, 72, 4782 }, // á
-    { 13, 22, 15, 1, 21, 72, 4854 }, // â
-    { 13, 21, 15, 1, 20, 69, 4926 }, // ã
-    { 13, 20, 15, 1, 19, 65, 4995 }, // ä
-    { 13, 22, 15, 1, 21, 72, 5060 }, // å
-    { 18, 15, 19, 1, 14, 68, 5132 }, // æ
-    { 10, 21, 11, 1, 14, 53, 5200 }, // ç
-    { 11, 22, 12, 1, 21, 61, 5253 }, // è
-    { 11, 22, 12, 1, 21, 61, 5314 }, // é
-    { 11, 22, 12, 1, 21, 61, 5375 }, // ê
-    { 12, 20, 12, 1, 19, 60, 5436 }, // ë
-    { 7, 22, 8, 1, 21, 39, 5496 }, // ì
-    { 9, 22, 8, 1, 21, 50, 5535 }, // í
-    { 9, 22, 8, 1, 21, 50, 5585 }, // î
-    { 10, 20, 8, 1, 19, 50, 5635 }, // ï
-    { 13, 21, 14, 0, 20, 69, 5685 }, // ð
-    { 14, 21, 15, 1, 20, 74, 5754 }, // ñ
-    { 12, 22, 14, 1, 21, 66, 5828 }, // ò
-    { 12, 22, 14, 1, 21, 66, 5894 }, // ó
-    { 12, 22, 14, 1, 21, 66, 5960 }, // ô
-    { 13, 21, 14, 1, 20, 69, 6026 }, // õ
-    { 13, 20, 14, 1, 19, 65, 6095 }, // ö
-    { 11, 13, 16, 2, 15, 36, 6160 }, // ÷
-    { 16, 15, 14, -1, 14, 60, 6196 }, // ø
-    { 14, 22, 15, 1, 21, 77, 6256 }, // ù
-    { 14, 22, 15, 1, 21, 77, 6333 }, // ú
-    { 14, 22, 15, 1, 21, 77, 6410 }, // û
-    { 14, 20, 15, 1, 19, 70, 6487 }, // ü
-    { 16, 27, 13, -3, 21, 108, 6557 }, // ý
-    { 15, 26, 14, -2, 20, 98, 6665 }, // þ
-    { 16, 25, 13, -3, 19, 100, 6763 }, // ÿ
-    { 19, 23, 18, -2, 23, 110, 0 }, // Ā
-    { 13, 19, 15, 1, 18, 62, 110 }, // ā
-    { 19, 24, 18, -2, 24, 114, 172 }, // Ă
-    { 13, 21, 15, 1, 20, 69, 286 }, // ă
-    { 19, 24, 18, -2, 18, 114, 355 }, // Ą
-    { 13, 20, 15, 1, 14, 65, 469 }, // ą
-    { 15, 25, 16, 1, 24, 94, 534 }, // Ć
-    { 11, 22, 11, 1, 21, 61, 628 }, // ć
-    { 15, 25, 16, 1, 24, 94, 689 }, // Ĉ
-    { 11, 22, 11, 1, 21, 61, 783 }, // ĉ
-    { 15, 25, 16, 1, 24, 94, 844 }, // Ċ
-    { 10, 20, 11, 1, 19, 50, 938 }, // ċ
-    { 16, 26, 16, 1, 25, 104, 988 }, // Č
-    { 12, 22, 11, 1, 21, 66, 1092 }, // č
-    { 19, 26, 18, -1, 25, 124, 1158 }, // Ď
-    { 18, 23, 15, 1, 22, 104, 1282 }, // ď
-    { 19, 19, 18, -1, 18, 91, 1386 }, // Đ
-    { 15, 21, 15, 1, 20, 79, 1477 }, // đ
-    { 17, 23, 15, -1, 23, 98, 1556 }, // Ē
-    { 12, 19, 12, 1, 18, 57, 1654 }, // ē
-    { 17, 24, 15, -1, 24, 102, 1711 }, // Ĕ
-    { 12, 21, 12, 1, 20, 63, 1813 }, // ĕ
-    { 17, 24, 15, -1, 24, 102, 1876 }, // Ė
-    { 11, 20, 12, 1, 19, 55, 1978 }, // ė
-    { 17, 24, 15, -1, 18, 102, 2033 }, // Ę
-    { 11, 20, 12, 1, 14, 55, 2135 }, // ę
-    { 17, 25, 15, -1, 25, 107, 2190 }, // Ě
-    { 12, 22, 12, 1, 21, 66, 2297 }, // ě
-    { 17, 25, 18, 1, 24, 107, 2363 }, // Ĝ
-    { 17, 27, 12, -3, 21, 115, 2470 }, // ĝ
-    { 17, 25, 18, 1, 24, 107, 2585 }, // Ğ
-    { 17, 26, 12, -3, 20, 111, 2692 }, // ğ
-    { 17, 25, 18, 1, 24, 107, 2803 }, // Ġ
-    { 17, 25, 12, -3, 19, 107, 2910 }, // ġ
-    { 17, 25, 18, 1, 18, 107, 3017 }, // Ģ
-    { 17, 28, 12, -3, 22, 119, 3124 }, // ģ
-    { 22, 24, 20, -1, 24, 132, 3243 }, // Ĥ
-    { 15, 27, 15, 0, 26, 102, 3375 }, // ĥ
-    { 22, 18, 20, -1, 18, 99, 3477 }, // Ħ
-    { 15, 21, 15, 0, 20, 79, 3576 }, // ħ
-    { 13, 24, 9, -1, 24, 78, 3655 }, // Ĩ
-    { 10, 21, 8, 1, 20, 53, 3733 }, // ĩ
-    { 13, 23, 9, -1, 23, 75, 3786 }, // Ī
-    { 10, 19, 8, 1, 18, 48, 3861 }, // ī
-    { 13, 24, 9, -1, 24, 78, 3909 }, // Ĭ
-    { 10, 21, 8, 1, 20, 53, 3987 }, // ĭ
-    { 11, 24, 9, -1, 18, 66, 4040 }, // Į
-    { 7, 26, 8, 1, 20, 46, 4106 }, // į
-    { 11, 24, 9, -1, 24, 66, 4152 }, // İ
-    { 6, 14, 8, 1, 13, 21, 4218 }, // ı
-    { 21, 23, 18, -1, 18, 121, 4239 }, // Ĳ
-    { 15, 26, 15, 1, 20, 98, 4360 }, // ĳ
-    { 17, 29, 9, -5, 24, 124, 4458 }, // Ĵ
-    { 15, 27, 7, -5, 21, 102, 4582 }, // ĵ
-    { 20, 25, 18, -1, 18, 125, 4684 }, // Ķ
-    { 12, 27, 13, 1, 20, 81, 4809 }, // ķ
-    { 12, 15, 14, 1, 14, 45, 4890 }, // ĸ
-    { 15, 24, 14, -1, 24, 90, 4935 }, // Ĺ
-    { 9, 27, 8, 1, 26, 61, 5025 }, // ĺ
-    { 15, 25, 14, -1, 18, 94, 5086 }, // Ļ
-    { 9, 27, 8, -1, 20, 61, 5180 }, // ļ
-    { 16, 20, 14, -1, 20, 80, 5241 }, // Ľ
-    { 11, 23, 8, 1, 22, 64, 5321 }, // ľ
-    { 16, 18, 15, -1, 18, 72, 5385 }, // Ŀ
-    { 10, 21, 10, 1, 20, 53, 5457 }, // ŀ
-    { 15, 18, 14, -1, 18, 68, 5510 }, // Ł
-    { 10, 21, 8, -1, 20, 53, 5578 }, // ł
-    { 21, 25, 19, -1, 24, 132, 5631 }, // Ń
-    { 14, 22, 15, 1, 21, 77, 5763 }, // ń
-    { 21, 25, 19, -1, 18, 132, 5840 }, // Ņ
-    { 14, 21, 15, 1, 14, 74, 5972 }, // ņ
-    { 21, 26, 19, -1, 25, 137, 6046 }, // Ň
-    { 14, 22, 15, 1, 21, 77, 6183 }, // ň
-    { 19, 20, 21, 1, 19, 95, 6260 }, // ŉ
-    { 21, 23, 19, -1, 18, 121, 6355 }, // Ŋ
-    { 13, 20, 15, 1, 14, 65, 6476 }, // ŋ
-    { 17, 24, 18, 1, 23, 102, 6541 }, // Ō
-    { 13, 19, 14, 1, 18, 62, 6643 }, // ō
-    { 17, 25, 18, 1, 24, 107, 6705 }, // Ŏ
-    { 13, 21, 14, 1, 20, 69, 6812 }, // ŏ
-    { 18, 26, 18, 1, 25, 117, 6881 }, // Ő
-    { 14, 22, 14, 1, 21, 77, 6998 }, // ő
-    { 23, 19, 24, 1, 18, 110, 7075 }, // Œ
-    { 19, 15, 20, 1, 14, 72, 7185 }, // œ
-    { 17, 25, 16, -1, 24, 107, 7257 }, // Ŕ
-    { 11, 21, 11, 1, 21, 58, 7364 }, // ŕ
-    { 17, 25, 16, -1, 18, 107, 7422 }, // Ŗ
-    { 13, 21, 11, -1, 14, 69, 7529 }, // ŗ
-    { 17, 26, 16, -1, 25, 111, 7598 }, // Ř
-    { 12, 21, 11, 1, 21, 63, 7709 }, // ř
-    { 13, 25, 13, 0, 24, 82, 7772 }, // Ś
-    { 11, 22, 10, 0, 21, 61, 7854 }, // ś
-    { 13, 25, 13, 0, 24, 82, 7915 }, // Ŝ
-    { 11, 22, 10, 0, 21, 61, 7997 }, // ŝ
-    { 13, 25, 13, 0, 18, 82, 8058 }, // Ş
-    { 10, 21, 10, 0, 14, 53, 8140 }, // ş
-    { 14, 26, 13, 0, 25, 91, 8193 }, // Š
-    { 12, 22, 10, 0, 21, 66, 8284 }, // š
-    { 15, 25, 16, 2, 18, 94, 8350 }, // Ţ
-    { 10, 24, 10, 0, 17, 60, 8444 }, // ţ
-    { 15, 25, 16, 2, 25, 94, 8504 }, // Ť
-    { 11, 21, 10, 0, 20, 58, 8598 }, // ť
-    { 15, 18, 16, 2, 18, 68, 8656 }, // Ŧ
-    { 10, 18, 10, 0, 17, 45, 8724 }, // ŧ
-    { 18, 25, 19, 2, 24, 113, 8769 }, // Ũ
-    { 14, 21, 15, 1, 20, 74, 8882 }, // ũ
-    { 18, 24, 19, 2, 23, 108, 8956 }, // Ū
-    { 14, 19, 15, 1, 18, 67, 9064 }, // ū
-    { 18, 25, 19, 2, 24, 113, 9131 }, // Ŭ
-    { 14, 21, 15, 1, 20, 74, 9244 }, // ŭ
-    { 18, 26, 19, 2, 25, 117, 9318 }, // Ů
-    { 14, 22, 15, 1, 21, 77, 9435 }, // ů
-    { 18, 26, 19, 2, 25, 117, 9512 }, // Ű
-    { 14, 22, 15, 1, 21, 77, 9629 }, // ű
-    { 18, 24, 19, 2, 18, 108, 9706 }, // Ų
-    { 14, 19, 15, 1, 13, 67, 9814 }, // ų
-    { 26, 25, 26, 2, 24, 163, 9881 }, // Ŵ
-    { 19, 22, 19, 0, 21, 105, 10044 }, // ŵ
-    { 17, 24, 16, 1, 24, 102, 10149 }, // Ŷ
-    { 16, 27, 13, -3, 21, 108, 10251 }, // ŷ
-    { 17, 23, 16, 1, 23, 98, 10359 }, // Ÿ
-    { 16, 25, 15, -1, 24, 100, 10457 }, // Ź
-    { 12, 22, 12, 0, 21, 66, 10557 }, // ź
-    { 16, 25, 15, -1, 24, 100, 10623 }, // Ż
-    { 12, 20, 12, 0, 19, 60, 10723 }, // ż
-    { 16, 26, 15, -1, 25, 104, 10783 }, // Ž
-    { 12, 22, 12, 0, 21, 66, 10887 }, // ž
-    { 18, 26, 10, -5, 20, 117, 10953 }, // ſ
-    { 6, 7, 0, -4, 21, 11, 0 }, // ̀
-    { 6, 7, 0, -2, 21, 11, 11 }, // ́
-    { 9, 7, 0, -5, 21, 16, 22 }, // ̂
-    { 8, 5, 0, -4, 20, 10, 38 }, // ̃
-    { 8, 3, 0, -4, 18, 6, 48 }, // ̄
-    { 8, 5, 0, -4, 20, 10, 54 }, // ̆
-    { 4, 4, 0, -2, 19, 4, 64 }, // ̇
-    { 10, 4, 0, -5, 19, 10, 68 }, // ̈
-    { 7, 8, 0, -3, 22, 14, 78 }, // ̉
-    { 8, 7, 0, -4, 21, 14, 92 }, // ̊
-    { 10, 7, 0, -4, 21, 18, 106 }, // ̋
-    { 9, 6, 0, -4, 21, 14, 124 }, // ̌
-    { 8, 7, 0, -5, 21, 14, 138 }, // ̏
-    { 9, 5, 0, -5, 20, 12, 152 }, // ̑
-    { 6, 8, 0, -3, 22, 12, 164 }, // ̒
-    { 5, 7, 0, -2, 22, 9, 176 }, // ̓
-    { 5, 7, 0, -3, 22, 9, 185 }, // ̔
-    { 4, 7, 0, -2, 22, 7, 194 }, // ̕
-    { 6, 6, 0, -3, 16, 9, 201 }, // ̛
-    { 4, 4, 0, -2, -2, 4, 210 }, // ̣
-    { 10, 4, 0, -5, -2, 10, 214 }, // ̤
-    { 6, 6, 0, -3, -1, 9, 224 }, // ̥
-    { 5, 6, 0, -3, -1, 8, 233 }, // ̦
-    { 6, 6, 0, -3, -1, 9, 241 }, // ̧
-    { 6, 7, 0, -3, 1, 11, 250 }, // ̨
-    { 5, 6, 7, -1, -1, 8, 261 }, // ̩
-    { 9, 6, 0, -5, -1, 14, 269 }, // ̭
-    { 8, 5, 0, -4, -1, 10, 283 }, // ̮
-    { 8, 5, 0, -4, -1, 10, 293 }, // ̰
-    { 8, 3, 0, -4, -2, 6, 303 }, // ̱
-    { 9, 5, 0, -5, 20, 12, 309 }, // ͂
-    { 9, 10, 0, -5, 25, 23, 321 }, // ̈́
-    { 5, 5, 0, -2, -1, 7, 344 }, // ͅ
-    { 17, 24, 15, -1, 24, 102, 0 }, // Ѐ
-    { 17, 23, 15, -1, 23, 98, 102 }, // Ё
-    { 16, 24, 19, 2, 18, 96, 200 }, // Ђ
-    { 16, 24, 14, -1, 24, 96, 296 }, // Ѓ
-    { 15, 19, 16, 1, 18, 72, 392 }, // Є
-    { 13, 19, 13, 0, 18, 62, 464 }, // Ѕ
-    { 11, 18, 9, -1, 18, 50, 526 }, // І
-    { 13, 23, 9, -1, 23, 75, 576 }, // Ї
-    { 16, 23, 9, -5, 18, 92, 651 }, // Ј
-    { 24, 19, 22, -2, 18, 114, 743 }, // Љ
-    { 24, 19, 23, -1, 18, 114, 857 }, // Њ
-    { 16, 18, 20, 2, 18, 72, 971 }, // Ћ
-    { 19, 25, 17, -1, 24, 119, 1043 }, // Ќ
-    { 22, 24, 20, -1, 24, 132, 1162 }, // Ѝ
-    { 18, 26, 16, 0, 25, 117, 1294 }, // Ў
-    { 21, 24, 19, -1, 18, 126, 1411 }, // Џ
-    { 19, 18, 18, -2, 18, 86, 1537 }, // А
-    { 16, 19, 15, -1, 18, 76, 1623 }, // Б
-    { 16, 19, 16, -1, 18, 76, 1699 }, // В
-    { 16, 18, 14, -1, 18, 72, 1775 }, // Г
-    { 21, 24, 18, -2, 18, 126, 1847 }, // Д
-    { 17, 18, 15, -1, 18, 77, 1973 }, // Е
-    { 27, 19, 24, -2, 18, 129, 2050 }, // Ж
-    { 13, 19, 14, 0, 18, 62, 2179 }, // З
-    { 22, 18, 20, -1, 18, 99, 2241 }, // И
-    { 22, 25, 20, -1, 25, 138, 2340 }, // Й
-    { 19, 19, 17, -1, 18, 91, 2478 }, // К
-    { 20, 19, 17, -2, 18, 95, 2569 }, // Л
-    { 25, 18, 23, -2, 18, 113, 2664 }, // М
-    { 22, 18, 20, -1, 18, 99, 2777 }, // Н
-    { 17, 19, 18, 1, 18, 81, 2876 }, // О
-    { 21, 18, 19, -1, 18, 95, 2957 }, // П
-    { 16, 18, 15, -1, 18, 72, 3052 }, // Р
-    { 15, 19, 16, 1, 18, 72, 3124 }, // С
-    { 15, 18, 16, 2, 18, 68, 3196 }, // Т
-    { 18, 19, 16, 0, 18, 86, 3264 }, // У
-    { 18, 19, 18, 0, 18, 86, 3350 }, // Ф
-    { 20, 18, 17, -2, 18, 90, 3436 }, // Х
-    { 21, 24, 19, -1, 18, 126, 3526 }, // Ц
-    { 17, 18, 17, 1, 18, 77, 3652 }, // Ч
-    { 27, 18, 25, -1, 18, 122, 3729 }, // Ш
-    { 27, 24, 25, -1, 18, 162, 3851 }, // Щ
-    { 15, 19, 17, 2, 18, 72, 4013 }, // Ъ
-    { 25, 19, 23, -1, 18, 119, 4085 }, // Ы
-    { 15, 19, 15, -1, 18, 72, 4204 }, // Ь
-    { 15, 19, 15, 0, 18, 72, 4276 }, // Э
-    { 26, 19, 25, -1, 18, 124, 4348 }, // Ю
-    { 19, 19, 16, -2, 18, 91, 4472 }, // Я
-    { 13, 15, 15, 1, 14, 49, 4563 }, // а
-    { 14, 21, 14, 1, 20, 74, 4612 }, // б
-    { 11, 15, 13, 1, 14, 42, 4686 }, // в
-    { 11, 15, 11, 0, 14, 42, 4728 }, // г
-    { 12, 21, 14, 1, 20, 63, 4770 }, // д
-    { 11, 15, 12, 1, 14, 42, 4833 }, // е
-    { 22, 15, 22, 0, 14, 83, 4875 }, // ж
-    { 11, 15, 11, 0, 14, 42, 4958 }, // з
-    { 14, 14, 15, 1, 13, 49, 5000 }, // и
-    { 14, 21, 15, 1, 20, 74, 5049 }, // й
-    { 13, 15, 14, 1, 14, 49, 5123 }, // к
-    { 16, 15, 15, -1, 14, 60, 5172 }, // л
-    { 19, 15, 19, 0, 14, 72, 5232 }, // м
-    { 14, 14, 15, 1, 13, 49, 5304 }, // н
-    { 12, 15, 14, 1, 14, 45, 5353 }, // о
-    { 14, 15, 15, 1, 14, 53, 5398 }, // п
-    { 16, 20, 14, -2, 14, 80, 5451 }, // р
-    { 10, 15, 11, 1, 14, 38, 5531 }, // с
-    { 21, 15, 22, 1, 14, 79, 5569 }, // т
-    { 16, 20, 13, -3, 14, 80, 5648 }, // у
-    { 16, 26, 17, 1, 20, 104, 5728 }, // ф
-    { 16, 15, 14, -1, 14, 60, 5832 }, // х
-    { 14, 18, 15, 1, 13, 63, 5892 }, // ц
-    { 13, 14, 15, 1, 13, 46, 5955 }, // ч
-    { 20, 14, 21, 1, 13, 70, 6001 }, // ш
-    { 20, 18, 21, 1, 13, 90, 6071 }, // щ
-    { 13, 15, 13, 0, 14, 49, 6161 }, // ъ
-    { 18, 14, 19, 0, 13, 63, 6210 }, // ы
-    { 11, 14, 12, 0, 13, 39, 6273 }, // ь
-    { 11, 15, 12, 0, 14, 42, 6312 }, // э
-    { 18, 15, 20, 1, 14, 68, 6354 }, // ю
-    { 14, 14, 14, -1, 13, 49, 6422 }, // я
-    { 11, 22, 12, 1, 21, 61, 6471 }, // ѐ
-    { 12, 20, 12, 1, 19, 60, 6532 }, // ё
-    { 13, 26, 14, 0, 20, 85, 6592 }, // ђ
-    { 11, 22, 11, 0, 21, 61, 6677 }, // ѓ
-    { 11, 15, 12, 1, 14, 42, 6738 }, // є
-    { 10, 15, 10, 0, 14, 38, 6780 }, // ѕ
-    { 7, 21, 8, 1, 20, 37, 6818 }, // і
-    { 10, 20, 8, 1, 19, 50, 6855 }, // ї
-    { 13, 26, 7, -5, 20, 85, 6905 }, // ј
-    { 19, 15, 18, -1, 14, 72, 6990 }, // љ
-    { 16, 14, 18, 1, 13, 56, 7062 }, // њ
-    { 15, 21, 15, 0, 20, 79, 7118 }, // ћ
-    { 13, 22, 14, 1, 21, 72, 7197 }, // ќ
-    { 14, 22, 15, 1, 21, 77, 7269 }, // ѝ
-    { 16, 26, 13, -3, 20, 104, 7346 }, // ў
-    { 14, 18, 15, 1, 13, 63, 7450 }, // џ
-    { 15, 21, 17, 1, 20, 79, 7513 }, // Ѣ
-    { 17, 15, 18, 1, 14, 64, 7592 }, // ѣ
-    { 17, 19, 18, 1, 18, 81, 7656 }, // Ѳ
-    { 12, 15, 14, 1, 14, 45, 7737 }, // ѳ
-    { 18, 19, 18, 2, 18, 86, 7782 }, // Ѵ
-    { 15, 15, 14, 0, 14, 57, 7868 }, // ѵ
-    { 22, 31, 20, -1, 25, 171, 7925 }, // Ҋ
-    { 14, 25, 15, 1, 20, 88, 8096 }, // ҋ
-    { 15, 19, 15, -1, 18, 72, 8184 }, // Ҍ
-    { 11, 19, 12, 1, 18, 53, 8256 }, // ҍ
-    { 16, 18, 15, -1, 18, 72, 8309 }, // Ҏ
-    { 16, 20, 14, -2, 14, 80, 8381 }, // ҏ
-    { 17, 21, 14, -1, 21, 90, 8461 }, // Ґ
-    { 13, 18, 11, 0, 17, 59, 8551 }, // ґ
-    { 16, 18, 14, -1, 18, 72, 8610 }, // Ғ
-    { 11, 15, 11, 0, 14, 42, 8682 }, // ғ
-    { 16, 24, 15, -1, 18, 96, 8724 }, // Ҕ
-    { 12, 19, 13, 1, 13, 57, 8820 }, // ҕ
-    { 27, 24, 24, -2, 18, 162, 8877 }, // Җ
-    { 22, 19, 22, 0, 14, 105, 9039 }, // җ
-    { 13, 24, 14, 0, 18, 78, 9144 }, // Ҙ
-    { 11, 19, 11, 0, 14, 53, 9222 }, // ҙ
-    { 19, 24, 17, -1, 18, 114, 9275 }, // Қ
-    { 13, 19, 14, 1, 14, 62, 9389 }, // қ
-    { 20, 19, 18, -1, 18, 95, 9451 }, // Ҝ
-    { 14, 15, 15, 1, 14, 53, 9546 }, // ҝ
-    { 19, 19, 17, -1, 18, 91, 9599 }, // Ҟ
-    { 13, 19, 14, 1, 18, 62, 9690 }, // ҟ
-    { 19, 19, 20, 2, 18, 91, 9752 }, // Ҡ
-    { 15, 15, 15, 0, 14, 57, 9843 }, // ҡ
-    { 22, 24, 20, -1, 18, 132, 9900 }, // Ң
-    { 14, 18, 16, 1, 13, 63, 10032 }, // ң
-    { 25, 18, 23, -1, 18, 113, 10095 }, // Ҥ
-    { 17, 14, 18, 1, 13, 60, 10208 }, // ҥ
-    { 26, 24, 26, -1, 18, 156, 10268 }, // Ҧ
-    { 20, 20, 21, 1, 14, 100, 10424 }, // ҧ
-    { 19, 19, 20, 1, 18, 91, 10524 }, // Ҩ
-    { 15, 15, 16, 1, 14, 57, 10615 }, // ҩ
-    { 15, 24, 16, 1, 18, 90, 10672 }, // Ҫ
-    { 10, 19, 11, 1, 14, 48, 10762 }, // ҫ
-    { 15, 24, 16, 2, 18, 90, 10810 }, // Ҭ
-    { 21, 19, 22, 1, 14, 100, 10900 }, // ҭ
-    { 17, 18, 16, 1, 18, 77, 11000 }, // Ү
-    { 13, 20, 13, 0, 14, 65, 11077 }, // ү
-    { 17, 18, 16, 1, 18, 77, 11142 }, // Ұ
-    { 13, 20, 13, 0, 14, 65, 11219 }, // ұ
-    { 20, 24, 17, -2, 18, 120, 11284 }, // Ҳ
-    { 16, 19, 14, -1, 14, 76, 11404 }, // ҳ
-    { 21, 24, 21, 1, 18, 126, 11480 }, // Ҵ
-    { 14, 23, 15, 1, 18, 81, 11606 }, // ҵ
-    { 17, 24, 17, 1, 18, 102, 11687 }, // Ҷ
-    { 14, 18, 15, 1, 13, 63, 11789 }, // ҷ
-    { 17, 18, 17, 1, 18, 77, 11852 }, // Ҹ
-    { 13, 14, 15, 1, 13, 46, 11929 }, // ҹ
-    { 16, 18, 17, -1, 18, 72, 11975 }, // Һ
-    { 15, 21, 15, 0, 20, 79, 12047 }, // һ
-    { 18, 19, 20, 1, 18, 86, 12126 }, // Ҽ
-    { 14, 15, 14, 0, 14, 53, 12212 }, // ҽ
-    { 18, 24, 20, 1, 18, 108, 12265 }, // Ҿ
-    { 14, 19, 14, 0, 14, 67, 12373 }, // ҿ
-    { 11, 18, 9, -1, 18, 50, 12440 }, // Ӏ
-    { 27, 26, 24, -2, 25, 176, 12490 }, // Ӂ
-    { 22, 21, 22, 0, 20, 116, 12666 }, // ӂ
-    { 19, 24, 17, -1, 18, 114, 12782 }, // Ӄ
-    { 12, 20, 14, 1, 14, 60, 12896 }, // ӄ
-    { 20, 24, 17, -2, 18, 120, 12956 }, // Ӆ
-    { 16, 19, 15, -1, 14, 76, 13076 }, // ӆ
-    { 22, 24, 20, -1, 18, 132, 13152 }, // Ӈ
-    { 13, 19, 14, 1, 13, 62, 13284 }, // ӈ
-    { 22, 24, 20, -1, 18, 132, 13346 }, // Ӊ
-    { 14, 18, 16, 1, 13, 63, 13478 }, // ӊ
-    { 17, 24, 17, 1, 18, 102, 13541 }, // Ӌ
-    { 13, 18, 14, 1, 13, 59, 13643 }, // ӌ
-    { 25, 24, 23, -2, 18, 150, 13702 }, // Ӎ
-    { 19, 19, 19, 0, 14, 91, 13852 }, // ӎ
-    { 11, 20, 8, -1, 20, 55, 13943 }, // ӏ
-    { 19, 25, 18, -2, 25, 119, 13998 }, // Ӑ
-    { 13, 21, 15, 1, 20, 69, 14117 }, // ӑ
-    { 19, 23, 18, -2, 23, 110, 14186 }, // Ӓ
-    { 13, 20, 15, 1, 19, 65, 14296 }, // ӓ
-    { 25, 18, 22, -2, 18, 113, 14361 }, // Ӕ
-    { 18, 15, 19, 1, 14, 68, 14474 }, // ӕ
-    { 17, 25, 15, -1, 25, 107, 14542 }, // Ӗ
-    { 12, 21, 12, 1, 20, 63, 14649 }, // ӗ
-    { 15, 19, 16, 0, 18, 72, 14712 }, // Ә
-    { 11, 15, 12, 0, 14, 42, 14784 }, // ә
-    { 15, 24, 16, 0, 23, 90, 14826 }, // Ӛ
-    { 12, 20, 12, 0, 19, 60, 14916 }, // ӛ
-    { 27, 24, 24, -2, 23, 162, 14976 }, // Ӝ
-    { 22, 20, 22, 0, 19, 110, 15138 }, // ӝ
-    { 13, 24, 14, 0, 23, 78, 15248 }, // Ӟ
-    { 12, 20, 11, 0, 19, 60, 15326 }, // ӟ
-    { 16, 19, 14, -1, 18, 76, 15386 }, // Ӡ
-    { 15, 19, 13, -2, 13, 72, 15462 }, // ӡ
-    { 22, 23, 20, -1, 23, 127, 15534 }, // Ӣ
-    { 14, 19, 15, 1, 18, 67, 15661 }, // ӣ
-    { 22, 23, 20, -1, 23, 127, 15728 }, // Ӥ
-    { 14, 20, 15, 1, 19, 70, 15855 }, // ӥ
-    { 17, 24, 18, 1, 23, 102, 15925 }, // Ӧ
-    { 13, 20, 14, 1, 19, 65, 16027 }, // ӧ
-    { 17, 19, 18, 1, 18, 81, 16092 }, // Ө
-    { 12, 15, 14, 1, 14, 45, 16173 }, // ө
-    { 17, 24, 18, 1, 23, 102, 16218 }, // Ӫ
-    { 13, 20, 14, 1, 19, 65, 16320 }, // ӫ
-    { 15, 24, 15, 0, 23, 90, 16385 }, // Ӭ
-    { 12, 20, 12, 0, 19, 60, 16475 }, // ӭ
-    { 18, 24, 16, 0, 23, 108, 16535 }, // Ӯ
-    { 16, 24, 13, -3, 18, 96, 16643 }, // ӯ
-    { 18, 24, 16, 0, 23, 108, 16739 }, // Ӱ
-    { 16, 25, 13, -3, 19, 100, 16847 }, // ӱ
-    { 18, 26, 16, 0, 25, 117, 16947 }, // Ӳ
-    { 16, 27, 13, -3, 21, 108, 17064 }, // ӳ
-    { 17, 23, 17, 1, 23, 98, 17172 }, // Ӵ
-    { 13, 20, 15, 1, 19, 65, 17270 }, // ӵ
-    { 16, 24, 14, -1, 18, 96, 17335 }, // Ӷ
-    { 11, 19, 11, 0, 14, 53, 17431 }, // ӷ
-    { 25, 24, 23, -1, 23, 150, 17484 }, // Ӹ
-    { 18, 20, 19, 0, 19, 90, 17634 }, // ӹ
-    { 16, 24, 14, -1, 18, 96, 17724 }, // Ӻ
-    { 11, 19, 11, 0, 14, 53, 17820 }, // ӻ
-    { 20, 24, 17, -2, 18, 120, 17873 }, // Ӽ
-    { 16, 20, 14, -1, 14, 80, 17993 }, // ӽ
-    { 20, 18, 17, -2, 18, 90, 18073 }, // Ӿ
-    { 16, 15, 14, -1, 14, 60, 18163 }, // ӿ
-    { 0, 0, 13, 0, 0, 0, 0 }, //  
-    { 0, 0, 25, 0, 0, 0, 0 }, //  
-    { 0, 0, 13, 0, 0, 0, 0 }, //  
-    { 0, 0, 25, 0, 0, 0, 0 }, //  
-    { 0, 0, 8, 0, 0, 0, 0 }, //  
-    { 0, 0, 6, 0, 0, 0, 0 }, //  
-    { 0, 0, 4, 0, 0, 0, 0 }, //  
-    { 0, 0, 16, 0, 0, 0, 0 }, //  
-    { 0, 0, 7, 0, 0, 0, 0 }, //  
-    { 0, 0, 5, 0, 0, 0, 0 }, //  
-    { 0, 0, 1, 0, 0, 0, 0 }, //  
-    { 0, 0, 0, 0, 0, 0, 0 }, // ​
-    { 2, 21, 0, -1, 15, 11, 0 }, // ‌
-    { 6, 23, 0, -3, 17, 35, 11 }, // ‍
-    { 8, 24, 0, -4, 18, 48, 46 }, // ‎
-    { 8, 24, 0, -4, 18, 48, 94 }, // ‏
-    { 8, 3, 9, 1, 8, 6, 142 }, // ‐
-    { 8, 3, 9, 1, 8, 6, 148 }, // ‑
-    { 12, 3, 16, 2, 10, 9, 154 }, // ‒
-    { 13, 3, 13, 0, 8, 10, 163 }, // –
-    { 25, 3, 25, 0, 8, 19, 173 }, // —
-    { 25, 3, 25, 0, 8, 19, 192 }, // ―
-    { 8, 26, 13, 2, 20, 52, 211 }, // ‖
-    { 13, 6, 13, 0, -1, 20, 263 }, // ‗
-    { 6, 8, 8, 2, 19, 12, 283 }, // ‘
-    { 6, 8, 8, 1, 19, 12, 295 }, // ’
-    { 6, 9, 8, 0, 4, 14, 307 }, // ‚
-    { 5, 8, 6, 1, 19, 10, 321 }, // ‛
-    { 11, 8, 13, 2, 19, 22, 331 }, // “
-    { 11, 8, 13, 1, 19, 22, 353 }, // ”
-    { 11, 9, 13, 0, 4, 25, 375 }, // „
-    { 10, 8, 11, 1, 19, 20, 400 }, // ‟
-    { 11, 17, 12, 1, 18, 47, 420 }, // †
-    { 12, 20, 12, 0, 18, 60, 467 }, // ‡
-    { 6, 6, 8, 1, 9, 9, 527 }, // •
-    { 9, 9, 16, 3, 13, 21, 536 }, // ‣
-    { 5, 4, 7, 1, 3, 5, 557 }, // ․
-    { 10, 5, 13, 1, 4, 13, 562 }, // ‥
-    { 21, 5, 25, 2, 4, 27, 575 }, // …
-    { 5, 4, 7, 1, 9, 5, 602 }, // ‧
-    { 0, 0, 0, 0, 0, 0, 607 }, //  
-    { 0, 0, 0, 0, 0, 0, 607 }, //  
-    { 8, 24, 0, -4, 18, 48, 607 }, // ‪
-    { 8, 24, 0, -4, 18, 48, 655 }, // ‫
-    { 8, 24, 0, -4, 18, 48, 703 }, // ‬
-    { 11, 24, 0, -5, 18, 66, 751 }, // ‭
-    { 11, 24, 0, -5, 18, 66, 817 }, // ‮
-    { 0, 0, 3, 0, 0, 0, 883 }, //  
-    { 32, 21, 34, 1, 19, 168, 883 }, // ‰
-    { 5, 9, 7, 1, 18, 12, 1051 }, // ′
-    { 10, 9, 11, 1, 18, 23, 1063 }, // ″
-    { 15, 9, 16, 1, 18, 34, 1086 }, // ‴
-    { 6, 9, 7, 0, 18, 14, 1120 }, // ‵
-    { 11, 9, 12, 0, 18, 25, 1134 }, // ‶
-    { 17, 9, 17, 0, 18, 39, 1159 }, // ‷
-    { 11, 6, 12, 1, 0, 17, 1198 }, // ‸
-    { 8, 10, 8, 0, 11, 20, 1215 }, // ‹
-    { 7, 10, 8, 0, 11, 18, 1235 }, // ›
-    { 16, 18, 16, 0, 17, 72, 1253 }, // ※
-    { 14, 20, 14, 1, 19, 70, 1325 }, // ‼
-    { 13, 3, 13, 0, 21, 10, 1395 }, // ‾
-    { 6, 3, 8, 1, 8, 5, 1405 }, // ⁃
-    { 16, 21, 6, -5, 19, 84, 1410 }, // ⁄
-    { 18, 19, 20, 2, 18, 86, 1494 }, // ⁇
-    { 16, 20, 17, 2, 19, 80, 1580 }, // ⁈
-    { 17, 20, 18, 1, 19, 85, 1660 }, // ⁉
-    { 15, 5, 25, 5, 10, 19, 1745 }, // ⁓
-    { 20, 9, 21, 1, 18, 45, 1764 }, // ⁗
-    { 0, 0, 6, 0, 0, 0, 1809 }, //  
-    { 0, 0, 0, 0, 0, 0, 1809 }, // ⁠
-    { 0, 0, 0, 0, 0, 0, 1809 }, // ⁡
-    { 0, 0, 0, 0, 0, 0, 1809 }, // ⁢
-    { 0, 0, 0, 0, 0, 0, 1809 }, // ⁣
-    { 0, 0, 0, 0, 0, 0, 1809 }, // ⁤
-    { 10, 12, 11, 1, 21, 30, 0 }, // ⁰
-    { 11, 12, 11, 0, 21, 33, 30 }, // ⁴
-    { 10, 12, 11, 1, 21, 30, 63 }, // ⁵
-    { 10, 12, 11, 1, 21, 30, 93 }, // ⁶
-    { 9, 12, 11, 2, 21, 27, 123 }, // ⁷
-    { 9, 12, 11, 1, 21, 27, 150 }, // ⁸
-    { 10, 12, 11, 0, 21, 30, 177 }, // ⁹
-    { 10, 9, 14, 2, 18, 23, 207 }, // ⁿ
-    { 10, 12, 11, 1, 8, 30, 230 }, // ₀
-    { 7, 13, 11, 2, 9, 23, 260 }, // ₁
-    { 10, 12, 11, 0, 8, 30, 283 }, // ₂
-    { 9, 12, 11, 1, 8, 27, 313 }, // ₃
-    { 11, 12, 11, 0, 8, 33, 340 }, // ₄
-    { 10, 12, 11, 1, 8, 30, 373 }, // ₅
-    { 10, 12, 11, 1, 8, 30, 403 }, // ₆
-    { 9, 12, 11, 2, 8, 27, 433 }, // ₇
-    { 9, 12, 11, 1, 8, 27, 460 }, // ₈
-    { 10, 12, 11, 0, 8, 30, 487 }, // ₉
-    { 16, 18, 16, 0, 18, 72, 0 }, // ₣
-    { 17, 19, 16, -1, 18, 81, 72 }, // ₤
-    { 30, 19, 31, 0, 18, 143, 153 }, // ₧
-    { 18, 19, 16, -1, 18, 86, 296 }, // €
-    { 15, 11, 25, 5, 14, 42, 0 }, // ←
-    { 11, 17, 25, 7, 17, 47, 42 }, // ↑
-    { 15, 11, 25, 5, 14, 42, 89 }, // →
-    { 11, 17, 25, 7, 17, 47, 131 }, // ↓
-    { 15, 11, 25, 5, 14, 42, 178 }, // ↔
-    { 11, 17, 25, 7, 17, 47, 220 }, // ↕
-    { 11, 17, 25, 7, 17, 47, 267 }, // ↨
-    { 11, 17, 25, 7, 17, 47, 314 }, // ↲
-    { 11, 17, 25, 7, 17, 47, 361 }, // ↳
-    { 13, 12, 25, 6, 15, 39, 408 }, // ↵
-    { 15, 11, 25, 5, 14, 42, 447 }, // ⇐
-    { 11, 15, 25, 7, 16, 42, 489 }, // ⇑
-    { 15, 11, 25, 5, 14, 42, 531 }, // ⇒
-    { 11, 15, 25, 7, 16, 42, 573 }, // ⇓
-    { 15, 11, 25, 5, 14, 42, 615 }, // ⇔
-    { 17, 19, 25, 4, 18, 81, 0 }, // ∀
-    { 13, 21, 16, 1, 20, 69, 81 }, // ∂
-    { 11, 18, 25, 7, 18, 50, 150 }, // ∃
-    { 19, 20, 25, 3, 19, 95, 200 }, // ∅
-    { 16, 18, 16, 0, 18, 72, 295 }, // ∆
-    { 17, 19, 25, 4, 18, 81, 367 }, // ∇
-    { 17, 18, 25, 4, 18, 77, 448 }, // ∈
-    { 17, 22, 25, 4, 19, 94, 525 }, // ∉
-    { 17, 14, 25, 4, 16, 60, 619 }, // ∊
-    { 17, 18, 25, 4, 18, 77, 679 }, // ∋
-    { 17, 22, 25, 4, 19, 94, 756 }, // ∌
-    { 17, 14, 25, 4, 16, 60, 850 }, // ∍
-    { 19, 22, 20, 1, 18, 105, 910 }, // ∏
-    { 15, 23, 15, 0, 18, 87, 1015 }, // ∑
-    { 11, 3, 16, 2, 10, 9, 1102 }, // −
-    { 14, 20, 12, -1, 18, 70, 1111 }, // ∕
-    { 10, 20, 12, 1, 18, 50, 1181 }, // ∖
-    { 12, 13, 16, 2, 15, 39, 1231 }, // ∗
-    { 9, 9, 16, 3, 13, 21, 1270 }, // ∘
-    { 4, 4, 16, 6, 9, 4, 1291 }, // ∙
-    { 16, 24, 16, 0, 21, 96, 1295 }, // √
-    { 13, 10, 16, 1, 13, 33, 1391 }, // ∝
-    { 16, 9, 16, 0, 12, 36, 1424 }, // ∞
-    { 16, 18, 25, 4, 18, 72, 1460 }, // ∟
-    { 18, 18, 25, 3, 18, 81, 1532 }, // ∠
-    { 3, 26, 13, 5, 20, 20, 1613 }, // ∣
-    { 8, 26, 13, 2, 20, 52, 1633 }, // ∥
-    { 17, 18, 25, 4, 18, 77, 1685 }, // ∧
-    { 17, 18, 25, 4, 18, 77, 1762 }, // ∨
-    { 15, 18, 25, 5, 18, 68, 1839 }, // ∩
-    { 15, 19, 25, 5, 18, 72, 1907 }, // ∪
-    { 14, 26, 16, 1, 20, 91, 1979 }, // ∫
-    { 16, 15, 25, 5, 14, 60, 2070 }, // ∴
-    { 16, 15, 25, 5, 14, 60, 2130 }, // ∵
-    { 5, 13, 8, 1, 15, 17, 2190 }, // ∶
-    { 16, 15, 25, 5, 14, 60, 2207 }, // ∷
-    { 15, 5, 25, 5, 10, 19, 2267 }, // ∼
-    { 15, 13, 25, 5, 15, 49, 2286 }, // ≅
-    { 12, 9, 16, 2, 13, 27, 2335 }, // ≈
-    { 15, 8, 25, 5, 11, 30, 2362 }, // ≍
-    { 11, 11, 16, 2, 14, 31, 2392 }, // ≠
-    { 15, 11, 25, 5, 13, 42, 2423 }, // ≡
-    { 12, 15, 16, 2, 15, 45, 2465 }, // ≤
-    { 12, 15, 16, 2, 15, 45, 2510 }, // ≥
-    { 21, 13, 25, 2, 15, 69, 2555 }, // ≪
-    { 21, 13, 25, 2, 15, 69, 2624 }, // ≫
-    { 17, 15, 25, 4, 16, 64, 2693 }, // ⊃
-    { 17, 23, 25, 4, 20, 98, 2757 }, // ⊄
-    { 17, 23, 25, 4, 20, 98, 2855 }, // ⊅
-    { 17, 18, 25, 4, 18, 77, 2953 }, // ⊆
-    { 17, 18, 25, 4, 18, 77, 3030 }, // ⊇
-    { 19, 19, 25, 3, 18, 91, 3107 }, // ⊕
-    { 19, 19, 25, 3, 18, 91, 3198 }, // ⊖
-    { 19, 19, 25, 3, 18, 91, 3289 }, // ⊗
-    { 19, 19, 25, 3, 18, 91, 3380 }, // ⊘
-    { 15, 18, 25, 5, 18, 68, 3471 }, // ⊥
-    { 4, 4, 16, 6, 9, 4, 3539 }, // ⋅
-    { 21, 4, 25, 2, 9, 21, 3543 }, // ⋯
-    { 25, 24, 25, 0, 21, 150, 0 }, // �
+    { 13, 10, 13, 0, 11, 33, 5893 }, // «
+    { 11, 7, 16, 2, 12, 20, 559 }, // ¬
+    { 8, 3, 9, 1, 8, 6, 579 }, // ­
+    { 14, 14, 15, 0, 20, 49, 585 }, // ®
+    { 9, 3, 15, 3, 18, 7, 634 }, // ¯
+    { 9, 9, 13, 2, 18, 21, 641 }, // °
+    { 11, 15, 16, 2, 15, 42, 662 }, // ±
+    { 10, 12, 11, 0, 21, 30, 704 }, // ²
+    { 9, 12, 11, 1, 21, 27, 734 }, // ³
+    { 6, 7, 15, 5, 21, 11, 761 }, // ´
+    { 16, 21, 15, -1, 14, 84, 772 }, // µ
+    { 16, 22, 15, -1, 18, 88, 856 }, // ¶
+    { 4, 4, 8, 2, 9, 4, 944 }, // ·
+    { 6, 6, 15, 5, -1, 9, 948 }, // ¸
+    { 7, 12, 11, 2, 21, 21, 957 }, // ¹
+    { 10, 12, 11, 1, 18, 30, 978 }, // º
+    { 12, 10, 13, 0, 11, 30, 5926 }, // »
+    { 24, 21, 27, 2, 19, 126, 1008 }, // ¼
+    { 24, 21, 27, 2, 19, 126, 1134 }, // ½
+    { 25, 21, 27, 1, 19, 132, 1260 }, // ¾
+    { 9, 20, 10, 0, 14, 45, 1392 }, // ¿
+    { 19, 24, 18, -2, 24, 114, 5956 }, // À
+    { 19, 24, 18, -2, 24, 114, 6070 }, // Á
+    { 19, 24, 18, -2, 24, 114, 6184 }, // Â
+    { 19, 24, 18, -2, 24, 114, 1437 }, // Ã
+    { 19, 23, 18, -2, 23, 110, 6298 }, // Ä
+    { 19, 25, 18, -2, 25, 119, 1551 }, // Å
+    { 25, 18, 22, -2, 18, 113, 1670 }, // Æ
+    { 15, 25, 16, 1, 18, 94, 6408 }, // Ç
+    { 17, 24, 15, -1, 24, 102, 6502 }, // È
+    { 17, 24, 15, -1, 24, 102, 6604 }, // É
+    { 17, 24, 15, -1, 24, 102, 6706 }, // Ê
+    { 17, 23, 15, -1, 23, 98, 6808 }, // Ë
+    { 11, 24, 9, -1, 24, 66, 6906 }, // Ì
+    { 12, 24, 9, -1, 24, 72, 6972 }, // Í
+    { 13, 24, 9, -1, 24, 78, 7044 }, // Î
+    { 13, 23, 9, -1, 23, 75, 7122 }, // Ï
+    { 19, 19, 18, -1, 18, 91, 1783 }, // Ð
+    { 21, 25, 19, -1, 24, 132, 7197 }, // Ñ
+    { 17, 25, 18, 1, 24, 107, 7329 }, // Ò
+    { 17, 25, 18, 1, 24, 107, 7436 }, // Ó
+    { 17, 25, 18, 1, 24, 107, 7543 }, // Ô
+    { 17, 25, 18, 1, 24, 107, 1874 }, // Õ
+    { 17, 24, 18, 1, 23, 102, 7650 }, // Ö
+    { 10, 11, 16, 3, 14, 28, 1981 }, // ×
+    { 20, 19, 18, -1, 18, 95, 2009 }, // Ø
+    { 18, 25, 19, 2, 24, 113, 7752 }, // Ù
+    { 18, 25, 19, 2, 24, 113, 7865 }, // Ú
+    { 18, 25, 19, 2, 24, 113, 7978 }, // Û
+    { 18, 24, 19, 2, 23, 108, 8091 }, // Ü
+    { 17, 24, 16, 1, 24, 102, 2104 }, // Ý
+    { 15, 18, 15, -1, 18, 68, 2206 }, // Þ
+    { 20, 26, 16, -4, 20, 130, 2274 }, // ß
+    { 13, 22, 15, 1, 21, 72, 8199 }, // à
+    { 13, 22, 15, 1, 21, 72, 8271 }, // á
+    { 13, 22, 15, 1, 21, 72, 8343 }, // â
+    { 13, 21, 15, 1, 20, 69, 2404 }, // ã
+    { 13, 20, 15, 1, 19, 65, 8415 }, // ä
+    { 13, 22, 15, 1, 21, 72, 2473 }, // å
+    { 18, 15, 19, 1, 14, 68, 2545 }, // æ
+    { 10, 21, 11, 1, 14, 53, 8480 }, // ç
+    { 11, 22, 12, 1, 21, 61, 8533 }, // è
+    { 11, 22, 12, 1, 21, 61, 8594 }, // é
+    { 11, 22, 12, 1, 21, 61, 8655 }, // ê
+    { 12, 20, 12, 1, 19, 60, 8716 }, // ë
+    { 7, 22, 8, 1, 21, 39, 8776 }, // ì
+    { 9, 22, 8, 1, 21, 50, 8815 }, // í
+    { 9, 22, 8, 1, 21, 50, 8865 }, // î
+    { 10, 20, 8, 1, 19, 50, 8915 }, // ï
+    { 13, 21, 14, 0, 20, 69, 2613 }, // ð
+    { 14, 21, 15, 1, 20, 74, 8965 }, // ñ
+    { 12, 22, 14, 1, 21, 66, 9039 }, // ò
+    { 12, 22, 14, 1, 21, 66, 9105 }, // ó
+    { 12, 22, 14, 1, 21, 66, 9171 }, // ô
+    { 13, 21, 14, 1, 20, 69, 2682 }, // õ
+    { 13, 20, 14, 1, 19, 65, 9237 }, // ö
+    { 11, 13, 16, 2, 15, 36, 2751 }, // ÷
+    { 16, 15, 14, -1, 14, 60, 2787 }, // ø
+    { 14, 22, 15, 1, 21, 77, 9302 }, // ù
+    { 14, 22, 15, 1, 21, 77, 9379 }, // ú
+    { 14, 22, 15, 1, 21, 77, 9456 }, // û
+    { 14, 20, 15, 1, 19, 70, 9533 }, // ü
+    { 16, 27, 13, -3, 21, 108, 2847 }, // ý
+    { 15, 26, 14, -2, 20, 98, 2955 }, // þ
+    { 16, 25, 13, -3, 19, 100, 3053 }, // ÿ
+    { 19, 23, 18, -2, 23, 110, 3153 }, // Ā
+    { 13, 19, 15, 1, 18, 62, 3263 }, // ā
+    { 19, 24, 18, -2, 24, 114, 3325 }, // Ă
+    { 13, 21, 15, 1, 20, 69, 3439 }, // ă
+    { 19, 24, 18, -2, 18, 114, 3508 }, // Ą
+    { 13, 20, 15, 1, 14, 65, 3622 }, // ą
+    { 15, 25, 16, 1, 24, 94, 3687 }, // Ć
+    { 11, 22, 11, 1, 21, 61, 3781 }, // ć
+    { 15, 25, 16, 1, 24, 94, 3842 }, // Ĉ
+    { 11, 22, 11, 1, 21, 61, 3936 }, // ĉ
+    { 15, 25, 16, 1, 24, 94, 3997 }, // Ċ
+    { 10, 20, 11, 1, 19, 50, 4091 }, // ċ
+    { 16, 26, 16, 1, 25, 104, 4141 }, // Č
+    { 12, 22, 11, 1, 21, 66, 4245 }, // č
+    { 19, 26, 18, -1, 25, 124, 4311 }, // Ď
+    { 18, 23, 15, 1, 22, 104, 4435 }, // ď
+    { 19, 19, 18, -1, 18, 91, 4539 }, // Đ
+    { 15, 21, 15, 1, 20, 79, 4630 }, // đ
+    { 17, 23, 15, -1, 23, 98, 4709 }, // Ē
+    { 12, 19, 12, 1, 18, 57, 4807 }, // ē
+    { 17, 24, 15, -1, 24, 102, 4864 }, // Ĕ
+    { 12, 21, 12, 1, 20, 63, 4966 }, // ĕ
+    { 17, 24, 15, -1, 24, 102, 5029 }, // Ė
+    { 11, 20, 12, 1, 19, 55, 5131 }, // ė
+    { 17, 24, 15, -1, 18, 102, 5186 }, // Ę
+    { 11, 20, 12, 1, 14, 55, 5288 }, // ę
+    { 17, 25, 15, -1, 25, 107, 5343 }, // Ě
+    { 12, 22, 12, 1, 21, 66, 5450 }, // ě
+    { 17, 25, 18, 1, 24, 107, 5516 }, // Ĝ
+    { 17, 27, 12, -3, 21, 115, 5623 }, // ĝ
+    { 17, 25, 18, 1, 24, 107, 5738 }, // Ğ
+    { 17, 26, 12, -3, 20, 111, 5845 }, // ğ
+    { 17, 25, 18, 1, 24, 107, 5956 }, // Ġ
+    { 17, 25, 12, -3, 19, 107, 6063 }, // ġ
+    { 17, 25, 18, 1, 18, 107, 6170 }, // Ģ
+    { 17, 28, 12, -3, 22, 119, 6277 }, // ģ
+    { 22, 24, 20, -1, 24, 132, 6396 }, // Ĥ
+    { 15, 27, 15, 0, 26, 102, 6528 }, // ĥ
+    { 22, 18, 20, -1, 18, 99, 6630 }, // Ħ
+    { 15, 21, 15, 0, 20, 79, 6729 }, // ħ
+    { 13, 24, 9, -1, 24, 78, 6808 }, // Ĩ
+    { 10, 21, 8, 1, 20, 53, 6886 }, // ĩ
+    { 13, 23, 9, -1, 23, 75, 6939 }, // Ī
+    { 10, 19, 8, 1, 18, 48, 7014 }, // ī
+    { 13, 24, 9, -1, 24, 78, 7062 }, // Ĭ
+    { 10, 21, 8, 1, 20, 53, 7140 }, // ĭ
+    { 11, 24, 9, -1, 18, 66, 7193 }, // Į
+    { 7, 26, 8, 1, 20, 46, 7259 }, // į
+    { 11, 24, 9, -1, 24, 66, 7305 }, // İ
+    { 6, 14, 8, 1, 13, 21, 7371 }, // ı
+    { 21, 23, 18, -1, 18, 121, 7392 }, // Ĳ
+    { 15, 26, 15, 1, 20, 98, 7513 }, // ĳ
+    { 17, 29, 9, -5, 24, 124, 7611 }, // Ĵ
+    { 15, 27, 7, -5, 21, 102, 7735 }, // ĵ
+    { 20, 25, 18, -1, 18, 125, 7837 }, // Ķ
+    { 12, 27, 13, 1, 20, 81, 7962 }, // ķ
+    { 12, 15, 14, 1, 14, 45, 8043 }, // ĸ
+    { 15, 24, 14, -1, 24, 90, 8088 }, // Ĺ
+    { 9, 27, 8, 1, 26, 61, 8178 }, // ĺ
+    { 15, 25, 14, -1, 18, 94, 8239 }, // Ļ
+    { 9, 27, 8, -1, 20, 61, 8333 }, // ļ
+    { 16, 20, 14, -1, 20, 80, 8394 }, // Ľ
+    { 11, 23, 8, 1, 22, 64, 8474 }, // ľ
+    { 16, 18, 15, -1, 18, 72, 8538 }, // Ŀ
+    { 10, 21, 10, 1, 20, 53, 8610 }, // ŀ
+    { 15, 18, 14, -1, 18, 68, 8663 }, // Ł
+    { 10, 21, 8, -1, 20, 53, 8731 }, // ł
+    { 21, 25, 19, -1, 24, 132, 8784 }, // Ń
+    { 14, 22, 15, 1, 21, 77, 8916 }, // ń
+    { 21, 25, 19, -1, 18, 132, 8993 }, // Ņ
+    { 14, 21, 15, 1, 14, 74, 9125 }, // ņ
+    { 21, 26, 19, -1, 25, 137, 9199 }, // Ň
+    { 14, 22, 15, 1, 21, 77, 9336 }, // ň
+    { 19, 20, 21, 1, 19, 95, 9413 }, // ŉ
+    { 21, 23, 19, -1, 18, 121, 9508 }, // Ŋ
+    { 13, 20, 15, 1, 14, 65, 9629 }, // ŋ
+    { 17, 24, 18, 1, 23, 102, 9694 }, // Ō
+    { 13, 19, 14, 1, 18, 62, 9796 }, // ō
+    { 17, 25, 18, 1, 24, 107, 9858 }, // Ŏ
+    { 13, 21, 14, 1, 20, 69, 9965 }, // ŏ
+    { 18, 26, 18, 1, 25, 117, 10034 }, // Ő
+    { 14, 22, 14, 1, 21, 77, 10151 }, // ő
+    { 23, 19, 24, 1, 18, 110, 9603 }, // Œ
+    { 19, 15, 20, 1, 14, 72, 9713 }, // œ
+    { 17, 25, 16, -1, 24, 107, 10228 }, // Ŕ
+    { 11, 21, 11, 1, 21, 58, 10335 }, // ŕ
+    { 17, 25, 16, -1, 18, 107, 10393 }, // Ŗ
+    { 13, 21, 11, -1, 14, 69, 10500 }, // ŗ
+    { 17, 26, 16, -1, 25, 111, 10569 }, // Ř
+    { 12, 21, 11, 1, 21, 63, 10680 }, // ř
+    { 13, 25, 13, 0, 24, 82, 10743 }, // Ś
+    { 11, 22, 10, 0, 21, 61, 10825 }, // ś
+    { 13, 25, 13, 0, 24, 82, 10886 }, // Ŝ
+    { 11, 22, 10, 0, 21, 61, 10968 }, // ŝ
+    { 13, 25, 13, 0, 18, 82, 11029 }, // Ş
+    { 10, 21, 10, 0, 14, 53, 11111 }, // ş
+    { 14, 26, 13, 0, 25, 91, 11164 }, // Š
+    { 12, 22, 10, 0, 21, 66, 11255 }, // š
+    { 15, 25, 16, 2, 18, 94, 11321 }, // Ţ
+    { 10, 24, 10, 0, 17, 60, 11415 }, // ţ
+    { 15, 25, 16, 2, 25, 94, 11475 }, // Ť
+    { 11, 21, 10, 0, 20, 58, 11569 }, // ť
+    { 15, 18, 16, 2, 18, 68, 11627 }, // Ŧ
+    { 10, 18, 10, 0, 17, 45, 11695 }, // ŧ
+    { 18, 25, 19, 2, 24, 113, 11740 }, // Ũ
+    { 14, 21, 15, 1, 20, 74, 11853 }, // ũ
+    { 18, 24, 19, 2, 23, 108, 11927 }, // Ū
+    { 14, 19, 15, 1, 18, 67, 12035 }, // ū
+    { 18, 25, 19, 2, 24, 113, 12102 }, // Ŭ
+    { 14, 21, 15, 1, 20, 74, 12215 }, // ŭ
+    { 18, 26, 19, 2, 25, 117, 12289 }, // Ů
+    { 14, 22, 15, 1, 21, 77, 12406 }, // ů
+    { 18, 26, 19, 2, 25, 117, 12483 }, // Ű
+    { 14, 22, 15, 1, 21, 77, 12600 }, // ű
+    { 18, 24, 19, 2, 18, 108, 12677 }, // Ų
+    { 14, 19, 15, 1, 13, 67, 12785 }, // ų
+    { 26, 25, 26, 2, 24, 163, 12852 }, // Ŵ
+    { 19, 22, 19, 0, 21, 105, 13015 }, // ŵ
+    { 17, 24, 16, 1, 24, 102, 13120 }, // Ŷ
+    { 16, 27, 13, -3, 21, 108, 13222 }, // ŷ
+    { 17, 23, 16, 1, 23, 98, 13330 }, // Ÿ
+    { 16, 25, 15, -1, 24, 100, 13428 }, // Ź
+    { 12, 22, 12, 0, 21, 66, 13528 }, // ź
+    { 16, 25, 15, -1, 24, 100, 13594 }, // Ż
+    { 12, 20, 12, 0, 19, 60, 13694 }, // ż
+    { 16, 26, 15, -1, 25, 104, 13754 }, // Ž
+    { 12, 22, 12, 0, 21, 66, 13858 }, // ž
+    { 18, 26, 10, -5, 20, 117, 13924 }, // ſ
+    { 6, 7, 0, -4, 21, 11, 14041 }, // ̀
+    { 6, 7, 0, -2, 21, 11, 14052 }, // ́
+    { 9, 7, 0, -5, 21, 16, 14063 }, // ̂
+    { 8, 5, 0, -4, 20, 10, 14079 }, // ̃
+    { 8, 3, 0, -4, 18, 6, 14089 }, // ̄
+    { 8, 5, 0, -4, 20, 10, 14095 }, // ̆
+    { 4, 4, 0, -2, 19, 4, 14105 }, // ̇
+    { 10, 4, 0, -5, 19, 10, 14109 }, // ̈
+    { 7, 8, 0, -3, 22, 14, 14119 }, // ̉
+    { 8, 7, 0, -4, 21, 14, 14133 }, // ̊
+    { 10, 7, 0, -4, 21, 18, 14147 }, // ̋
+    { 9, 6, 0, -4, 21, 14, 14165 }, // ̌
+    { 8, 7, 0, -5, 21, 14, 14179 }, // ̏
+    { 9, 5, 0, -5, 20, 12, 14193 }, // ̑
+    { 6, 8, 0, -3, 22, 12, 14205 }, // ̒
+    { 5, 7, 0, -2, 22, 9, 14217 }, // ̓
+    { 5, 7, 0, -3, 22, 9, 14226 }, // ̔
+    { 4, 7, 0, -2, 22, 7, 14235 }, // ̕
+    { 6, 6, 0, -3, 16, 9, 14242 }, // ̛
+    { 4, 4, 0, -2, -2, 4, 14251 }, // ̣
+    { 10, 4, 0, -5, -2, 10, 14255 }, // ̤
+    { 6, 6, 0, -3, -1, 9, 14265 }, // ̥
+    { 5, 6, 0, -3, -1, 8, 14274 }, // ̦
+    { 6, 6, 0, -3, -1, 9, 14282 }, // ̧
+    { 6, 7, 0, -3, 1, 11, 14291 }, // ̨
+    { 5, 6, 7, -1, -1, 8, 14302 }, // ̩
+    { 9, 6, 0, -5, -1, 14, 14310 }, // ̭
+    { 8, 5, 0, -4, -1, 10, 14324 }, // ̮
+    { 8, 5, 0, -4, -1, 10, 14334 }, // ̰
+    { 8, 3, 0, -4, -2, 6, 14344 }, // ̱
+    { 9, 5, 0, -5, 20, 12, 14350 }, // ͂
+    { 9, 10, 0, -5, 25, 23, 14362 }, // ̈́
+    { 5, 5, 0, -2, -1, 7, 14385 }, // ͅ
+    { 17, 24, 15, -1, 24, 102, 14392 }, // Ѐ
+    { 17, 23, 15, -1, 23, 98, 0 }, // Ё
+    { 16, 24, 19, 2, 18, 96, 14494 }, // Ђ
+    { 16, 24, 14, -1, 24, 96, 14590 }, // Ѓ
+    { 15, 19, 16, 1, 18, 72, 14686 }, // Є
+    { 13, 19, 13, 0, 18, 62, 14758 }, // Ѕ
+    { 11, 18, 9, -1, 18, 50, 14820 }, // І
+    { 13, 23, 9, -1, 23, 75, 14870 }, // Ї
+    { 16, 23, 9, -5, 18, 92, 14945 }, // Ј
+    { 24, 19, 22, -2, 18, 114, 15037 }, // Љ
+    { 24, 19, 23, -1, 18, 114, 15151 }, // Њ
+    { 16, 18, 20, 2, 18, 72, 15265 }, // Ћ
+    { 19, 25, 17, -1, 24, 119, 15337 }, // Ќ
+    { 22, 24, 20, -1, 24, 132, 15456 }, // Ѝ
+    { 18, 26, 16, 0, 25, 117, 15588 }, // Ў
+    { 21, 24, 19, -1, 18, 126, 15705 }, // Џ
+    { 19, 18, 18, -2, 18, 86, 98 }, // А
+    { 16, 19, 15, -1, 18, 76, 184 }, // Б
+    { 16, 19, 16, -1, 18, 76, 260 }, // В
+    { 16, 18, 14, -1, 18, 72, 336 }, // Г
+    { 21, 24, 18, -2, 18, 126, 408 }, // Д
+    { 17, 18, 15, -1, 18, 77, 534 }, // Е
+    { 27, 19, 24, -2, 18, 129, 611 }, // Ж
+    { 13, 19, 14, 0, 18, 62, 740 }, // З
+    { 22, 18, 20, -1, 18, 99, 802 }, // И
+    { 22, 25, 20, -1, 25, 138, 901 }, // Й
+    { 19, 19, 17, -1, 18, 91, 1039 }, // К
+    { 20, 19, 17, -2, 18, 95, 1130 }, // Л
+    { 25, 18, 23, -2, 18, 113, 1225 }, // М
+    { 22, 18, 20, -1, 18, 99, 1338 }, // Н
+    { 17, 19, 18, 1, 18, 81, 1437 }, // О
+    { 21, 18, 19, -1, 18, 95, 1518 }, // П
+    { 16, 18, 15, -1, 18, 72, 1613 }, // Р
+    { 15, 19, 16, 1, 18, 72, 1685 }, // С
+    { 15, 18, 16, 2, 18, 68, 1757 }, // Т
+    { 18, 19, 16, 0, 18, 86, 1825 }, // У
+    { 18, 19, 18, 0, 18, 86, 1911 }, // Ф
+    { 20, 18, 17, -2, 18, 90, 1997 }, // Х
+    { 21, 24, 19, -1, 18, 126, 2087 }, // Ц
+    { 17, 18, 17, 1, 18, 77, 2213 }, // Ч
+    { 27, 18, 25, -1, 18, 122, 2290 }, // Ш
+    { 27, 24, 25, -1, 18, 162, 2412 }, // Щ
+    { 15, 19, 17, 2, 18, 72, 2574 }, // Ъ
+    { 25, 19, 23, -1, 18, 119, 2646 }, // Ы
+    { 15, 19, 15, -1, 18, 72, 2765 }, // Ь
+    { 15, 19, 15, 0, 18, 72, 2837 }, // Э
+    { 26, 19, 25, -1, 18, 124, 2909 }, // Ю
+    { 19, 19, 16, -2, 18, 91, 3033 }, // Я
+    { 13, 15, 15, 1, 14, 49, 3124 }, // а
+    { 14, 21, 14, 1, 20, 74, 3173 }, // б
+    { 11, 15, 13, 1, 14, 42, 3247 }, // в
+    { 11, 15, 11, 0, 14, 42, 3289 }, // г
+    { 12, 21, 14, 1, 20, 63, 3331 }, // д
+    { 11, 15, 12, 1, 14, 42, 3394 }, // е
+    { 22, 15, 22, 0, 14, 83, 3436 }, // ж
+    { 11, 15, 11, 0, 14, 42, 3519 }, // з
+    { 14, 14, 15, 1, 13, 49, 3561 }, // и
+    { 14, 21, 15, 1, 20, 74, 3610 }, // й
+    { 13, 15, 14, 1, 14, 49, 3684 }, // к
+    { 16, 15, 15, -1, 14, 60, 3733 }, // л
+    { 19, 15, 19, 0, 14, 72, 3793 }, // м
+    { 14, 14, 15, 1, 13, 49, 3865 }, // н
+    { 12, 15, 14, 1, 14, 45, 3914 }, // о
+    { 14, 15, 15, 1, 14, 53, 3959 }, // п
+    { 16, 20, 14, -2, 14, 80, 4012 }, // р
+    { 10, 15, 11, 1, 14, 38, 4092 }, // с
+    { 21, 15, 22, 1, 14, 79, 4130 }, // т
+    { 16, 20, 13, -3, 14, 80, 4209 }, // у
+    { 16, 26, 17, 1, 20, 104, 4289 }, // ф
+    { 16, 15, 14, -1, 14, 60, 4393 }, // х
+    { 14, 18, 15, 1, 13, 63, 4453 }, // ц
+    { 13, 14, 15, 1, 13, 46, 4516 }, // ч
+    { 20, 14, 21, 1, 13, 70, 4562 }, // ш
+    { 20, 18, 21, 1, 13, 90, 4632 }, // щ
+    { 13, 15, 13, 0, 14, 49, 4722 }, // ъ
+    { 18, 14, 19, 0, 13, 63, 4771 }, // ы
+    { 11, 14, 12, 0, 13, 39, 4834 }, // ь
+    { 11, 15, 12, 0, 14, 42, 4873 }, // э
+    { 18, 15, 20, 1, 14, 68, 4915 }, // ю
+    { 14, 14, 14, -1, 13, 49, 4983 }, // я
+    { 11, 22, 12, 1, 21, 61, 15831 }, // ѐ
+    { 12, 20, 12, 1, 19, 60, 5032 }, // ё
+    { 13, 26, 14, 0, 20, 85, 15892 }, // ђ
+    { 11, 22, 11, 0, 21, 61, 15977 }, // ѓ
+    { 11, 15, 12, 1, 14, 42, 16038 }, // є
+    { 10, 15, 10, 0, 14, 38, 16080 }, // ѕ
+    { 7, 21, 8, 1, 20, 37, 16118 }, // і
+    { 10, 20, 8, 1, 19, 50, 16155 }, // ї
+    { 13, 26, 7, -5, 20, 85, 16205 }, // ј
+    { 19, 15, 18, -1, 14, 72, 16290 }, // љ
+    { 16, 14, 18, 1, 13, 56, 16362 }, // њ
+    { 15, 21, 15, 0, 20, 79, 16418 }, // ћ
+    { 13, 22, 14, 1, 21, 72, 16497 }, // ќ
+    { 14, 22, 15, 1, 21, 77, 16569 }, // ѝ
+    { 16, 26, 13, -3, 20, 104, 16646 }, // ў
+    { 14, 18, 15, 1, 13, 63, 16750 }, // џ
+    { 15, 21, 17, 1, 20, 79, 16813 }, // Ѣ
+    { 17, 15, 18, 1, 14, 64, 16892 }, // ѣ
+    { 17, 19, 18, 1, 18, 81, 16956 }, // Ѳ
+    { 12, 15, 14, 1, 14, 45, 17037 }, // ѳ
+    { 18, 19, 18, 2, 18, 86, 17082 }, // Ѵ
+    { 15, 15, 14, 0, 14, 57, 17168 }, // ѵ
+    { 22, 31, 20, -1, 25, 171, 17225 }, // Ҋ
+    { 14, 25, 15, 1, 20, 88, 17396 }, // ҋ
+    { 15, 19, 15, -1, 18, 72, 17484 }, // Ҍ
+    { 11, 19, 12, 1, 18, 53, 17556 }, // ҍ
+    { 16, 18, 15, -1, 18, 72, 17609 }, // Ҏ
+    { 16, 20, 14, -2, 14, 80, 17681 }, // ҏ
+    { 17, 21, 14, -1, 21, 90, 17761 }, // Ґ
+    { 13, 18, 11, 0, 17, 59, 17851 }, // ґ
+    { 16, 18, 14, -1, 18, 72, 17910 }, // Ғ
+    { 11, 15, 11, 0, 14, 42, 17982 }, // ғ
+    { 16, 24, 15, -1, 18, 96, 18024 }, // Ҕ
+    { 12, 19, 13, 1, 13, 57, 18120 }, // ҕ
+    { 27, 24, 24, -2, 18, 162, 0 }, // Җ
+    { 22, 19, 22, 0, 14, 105, 162 }, // җ
+    { 13, 24, 14, 0, 18, 78, 267 }, // Ҙ
+    { 11, 19, 11, 0, 14, 53, 345 }, // ҙ
+    { 19, 24, 17, -1, 18, 114, 398 }, // Қ
+    { 13, 19, 14, 1, 14, 62, 512 }, // қ
+    { 20, 19, 18, -1, 18, 95, 574 }, // Ҝ
+    { 14, 15, 15, 1, 14, 53, 669 }, // ҝ
+    { 19, 19, 17, -1, 18, 91, 722 }, // Ҟ
+    { 13, 19, 14, 1, 18, 62, 813 }, // ҟ
+    { 19, 19, 20, 2, 18, 91, 875 }, // Ҡ
+    { 15, 15, 15, 0, 14, 57, 966 }, // ҡ
+    { 22, 24, 20, -1, 18, 132, 1023 }, // Ң
+    { 14, 18, 16, 1, 13, 63, 1155 }, // ң
+    { 25, 18, 23, -1, 18, 113, 1218 }, // Ҥ
+    { 17, 14, 18, 1, 13, 60, 1331 }, // ҥ
+    { 26, 24, 26, -1, 18, 156, 1391 }, // Ҧ
+    { 20, 20, 21, 1, 14, 100, 1547 }, // ҧ
+    { 19, 19, 20, 1, 18, 91, 1647 }, // Ҩ
+    { 15, 15, 16, 1, 14, 57, 1738 }, // ҩ
+    { 15, 24, 16, 1, 18, 90, 1795 }, // Ҫ
+    { 10, 19, 11, 1, 14, 48, 1885 }, // ҫ
+    { 15, 24, 16, 2, 18, 90, 1933 }, // Ҭ
+    { 21, 19, 22, 1, 14, 100, 2023 }, // ҭ
+    { 17, 18, 16, 1, 18, 77, 2123 }, // Ү
+    { 13, 20, 13, 0, 14, 65, 2200 }, // ү
+    { 17, 18, 16, 1, 18, 77, 2265 }, // Ұ
+    { 13, 20, 13, 0, 14, 65, 2342 }, // ұ
+    { 20, 24, 17, -2, 18, 120, 2407 }, // Ҳ
+    { 16, 19, 14, -1, 14, 76, 2527 }, // ҳ
+    { 21, 24, 21, 1, 18, 126, 2603 }, // Ҵ
+    { 14, 23, 15, 1, 18, 81, 2729 }, // ҵ
+    { 17, 24, 17, 1, 18, 102, 2810 }, // Ҷ
+    { 14, 18, 15, 1, 13, 63, 2912 }, // ҷ
+    { 17, 18, 17, 1, 18, 77, 2975 }, // Ҹ
+    { 13, 14, 15, 1, 13, 46, 3052 }, // ҹ
+    { 16, 18, 17, -1, 18, 72, 3098 }, // Һ
+    { 15, 21, 15, 0, 20, 79, 3170 }, // һ
+    { 18, 19, 20, 1, 18, 86, 3249 }, // Ҽ
+    { 14, 15, 14, 0, 14, 53, 3335 }, // ҽ
+    { 18, 24, 20, 1, 18, 108, 3388 }, // Ҿ
+    { 14, 19, 14, 0, 14, 67, 3496 }, // ҿ
+    { 11, 18, 9, -1, 18, 50, 3563 }, // Ӏ
+    { 27, 26, 24, -2, 25, 176, 3613 }, // Ӂ
+    { 22, 21, 22, 0, 20, 116, 3789 }, // ӂ
+    { 19, 24, 17, -1, 18, 114, 3905 }, // Ӄ
+    { 12, 20, 14, 1, 14, 60, 4019 }, // ӄ
+    { 20, 24, 17, -2, 18, 120, 4079 }, // Ӆ
+    { 16, 19, 15, -1, 14, 76, 4199 }, // ӆ
+    { 22, 24, 20, -1, 18, 132, 4275 }, // Ӈ
+    { 13, 19, 14, 1, 13, 62, 4407 }, // ӈ
+    { 22, 24, 20, -1, 18, 132, 4469 }, // Ӊ
+    { 14, 18, 16, 1, 13, 63, 4601 }, // ӊ
+    { 17, 24, 17, 1, 18, 102, 4664 }, // Ӌ
+    { 13, 18, 14, 1, 13, 59, 4766 }, // ӌ
+    { 25, 24, 23, -2, 18, 150, 4825 }, // Ӎ
+    { 19, 19, 19, 0, 14, 91, 4975 }, // ӎ
+    { 11, 20, 8, -1, 20, 55, 5066 }, // ӏ
+    { 19, 25, 18, -2, 25, 119, 5121 }, // Ӑ
+    { 13, 21, 15, 1, 20, 69, 5240 }, // ӑ
+    { 19, 23, 18, -2, 23, 110, 5309 }, // Ӓ
+    { 13, 20, 15, 1, 19, 65, 5419 }, // ӓ
+    { 25, 18, 22, -2, 18, 113, 5484 }, // Ӕ
+    { 18, 15, 19, 1, 14, 68, 5597 }, // ӕ
+    { 17, 25, 15, -1, 25, 107, 5665 }, // Ӗ
+    { 12, 21, 12, 1, 20, 63, 5772 }, // ӗ
+    { 15, 19, 16, 0, 18, 72, 5835 }, // Ә
+    { 11, 15, 12, 0, 14, 42, 5907 }, // ә
+    { 15, 24, 16, 0, 23, 90, 5949 }, // Ӛ
+    { 12, 20, 12, 0, 19, 60, 6039 }, // ӛ
+    { 27, 24, 24, -2, 23, 162, 6099 }, // Ӝ
+    { 22, 20, 22, 0, 19, 110, 6261 }, // ӝ
+    { 13, 24, 14, 0, 23, 78, 6371 }, // Ӟ
+    { 12, 20, 11, 0, 19, 60, 6449 }, // ӟ
+    { 16, 19, 14, -1, 18, 76, 6509 }, // Ӡ
+    { 15, 19, 13, -2, 13, 72, 6585 }, // ӡ
+    { 22, 23, 20, -1, 23, 127, 6657 }, // Ӣ
+    { 14, 19, 15, 1, 18, 67, 6784 }, // ӣ
+    { 22, 23, 20, -1, 23, 127, 6851 }, // Ӥ
+    { 14, 20, 15, 1, 19, 70, 6978 }, // ӥ
+    { 17, 24, 18, 1, 23, 102, 7048 }, // Ӧ
+    { 13, 20, 14, 1, 19, 65, 7150 }, // ӧ
+    { 17, 19, 18, 1, 18, 81, 7215 }, // Ө
+    { 12, 15, 14, 1, 14, 45, 7296 }, // ө
+    { 17, 24, 18, 1, 23, 102, 7341 }, // Ӫ
+    { 13, 20, 14, 1, 19, 65, 7443 }, // ӫ
+    { 15, 24, 15, 0, 23, 90, 7508 }, // Ӭ
+    { 12, 20, 12, 0, 19, 60, 7598 }, // ӭ
+    { 18, 24, 16, 0, 23, 108, 7658 }, // Ӯ
+    { 16, 24, 13, -3, 18, 96, 7766 }, // ӯ
+    { 18, 24, 16, 0, 23, 108, 7862 }, // Ӱ
+    { 16, 25, 13, -3, 19, 100, 7970 }, // ӱ
+    { 18, 26, 16, 0, 25, 117, 8070 }, // Ӳ
+    { 16, 27, 13, -3, 21, 108, 8187 }, // ӳ
+    { 17, 23, 17, 1, 23, 98, 8295 }, // Ӵ
+    { 13, 20, 15, 1, 19, 65, 8393 }, // ӵ
+    { 16, 24, 14, -1, 18, 96, 8458 }, // Ӷ
+    { 11, 19, 11, 0, 14, 53, 8554 }, // ӷ
+    { 25, 24, 23, -1, 23, 150, 8607 }, // Ӹ
+    { 18, 20, 19, 0, 19, 90, 8757 }, // ӹ
+    { 16, 24, 14, -1, 18, 96, 8847 }, // Ӻ
+    { 11, 19, 11, 0, 14, 53, 8943 }, // ӻ
+    { 20, 24, 17, -2, 18, 120, 8996 }, // Ӽ
+    { 16, 20, 14, -1, 14, 80, 9116 }, // ӽ
+    { 20, 18, 17, -2, 18, 90, 9196 }, // Ӿ
+    { 16, 15, 14, -1, 14, 60, 9286 }, // ӿ
+    { 0, 0, 13, 0, 0, 0, 9346 }, //  
+    { 0, 0, 25, 0, 0, 0, 9346 }, //  
+    { 0, 0, 13, 0, 0, 0, 9346 }, //  
+    { 0, 0, 25, 0, 0, 0, 9346 }, //  
+    { 0, 0, 8, 0, 0, 0, 9346 }, //  
+    { 0, 0, 6, 0, 0, 0, 9346 }, //  
+    { 0, 0, 4, 0, 0, 0, 9346 }, //  
+    { 0, 0, 16, 0, 0, 0, 9346 }, //  
+    { 0, 0, 7, 0, 0, 0, 9346 }, //  
+    { 0, 0, 5, 0, 0, 0, 9346 }, //  
+    { 0, 0, 1, 0, 0, 0, 9346 }, //  
+    { 0, 0, 0, 0, 0, 0, 9346 }, // ​
+    { 2, 21, 0, -1, 15, 11, 9346 }, // ‌
+    { 6, 23, 0, -3, 17, 35, 9357 }, // ‍
+    { 8, 24, 0, -4, 18, 48, 9392 }, // ‎
+    { 8, 24, 0, -4, 18, 48, 9440 }, // ‏
+    { 8, 3, 9, 1, 8, 6, 9488 }, // ‐
+    { 8, 3, 9, 1, 8, 6, 9494 }, // ‑
+    { 12, 3, 16, 2, 10, 9, 9500 }, // ‒
+    { 13, 3, 13, 0, 8, 10, 9785 }, // –
+    { 25, 3, 25, 0, 8, 19, 9795 }, // —
+    { 25, 3, 25, 0, 8, 19, 9509 }, // ―
+    { 8, 26, 13, 2, 20, 52, 9528 }, // ‖
+    { 13, 6, 13, 0, -1, 20, 9580 }, // ‗
+    { 6, 8, 8, 2, 19, 12, 9814 }, // ‘
+    { 6, 8, 8, 1, 19, 12, 9826 }, // ’
+    { 6, 9, 8, 0, 4, 14, 9600 }, // ‚
+    { 5, 8, 6, 1, 19, 10, 9614 }, // ‛
+    { 11, 8, 13, 2, 19, 22, 9838 }, // “
+    { 11, 8, 13, 1, 19, 22, 9860 }, // ”
+    { 11, 9, 13, 0, 4, 25, 9624 }, // „
+    { 10, 8, 11, 1, 19, 20, 9649 }, // ‟
+    { 11, 17, 12, 1, 18, 47, 9669 }, // †
+    { 12, 20, 12, 0, 18, 60, 9716 }, // ‡
+    { 6, 6, 8, 1, 9, 9, 9776 }, // •
+    { 9, 9, 16, 3, 13, 21, 9785 }, // ‣
+    { 5, 4, 7, 1, 3, 5, 9806 }, // ․
+    { 10, 5, 13, 1, 4, 13, 9811 }, // ‥
+    { 21, 5, 25, 2, 4, 27, 9882 }, // …
+    { 5, 4, 7, 1, 9, 5, 9824 }, // ‧
+    { 0, 0, 0, 0, 0, 0, 9829 }, //  
+    { 0, 0, 0, 0, 0, 0, 9829 }, //  
+    { 8, 24, 0, -4, 18, 48, 9829 }, // ‪
+    { 8, 24, 0, -4, 18, 48, 9877 }, // ‫
+    { 8, 24, 0, -4, 18, 48, 9925 }, // ‬
+    { 11, 24, 0, -5, 18, 66, 9973 }, // ‭
+    { 11, 24, 0, -5, 18, 66, 10039 }, // ‮
+    { 0, 0, 3, 0, 0, 0, 10105 }, //  
+    { 32, 21, 34, 1, 19, 168, 10105 }, // ‰
+    { 5, 9, 7, 1, 18, 12, 10273 }, // ′
+    { 10, 9, 11, 1, 18, 23, 10285 }, // ″
+    { 15, 9, 16, 1, 18, 34, 10308 }, // ‴
+    { 6, 9, 7, 0, 18, 14, 10342 }, // ‵
+    { 11, 9, 12, 0, 18, 25, 10356 }, // ‶
+    { 17, 9, 17, 0, 18, 39, 10381 }, // ‷
+    { 11, 6, 12, 1, 0, 17, 10420 }, // ‸
+    { 8, 10, 8, 0, 11, 20, 10437 }, // ‹
+    { 7, 10, 8, 0, 11, 18, 10457 }, // ›
+    { 16, 18, 16, 0, 17, 72, 10475 }, // ※
+    { 14, 20, 14, 1, 19, 70, 10547 }, // ‼
+    { 13, 3, 13, 0, 21, 10, 10617 }, // ‾
+    { 6, 3, 8, 1, 8, 5, 10627 }, // ⁃
+    { 16, 21, 6, -5, 19, 84, 10632 }, // ⁄
+    { 18, 19, 20, 2, 18, 86, 10716 }, // ⁇
+    { 16, 20, 17, 2, 19, 80, 10802 }, // ⁈
+    { 17, 20, 18, 1, 19, 85, 10882 }, // ⁉
+    { 15, 5, 25, 5, 10, 19, 10967 }, // ⁓
+    { 20, 9, 21, 1, 18, 45, 10986 }, // ⁗
+    { 0, 0, 6, 0, 0, 0, 11031 }, //  
+    { 0, 0, 0, 0, 0, 0, 11031 }, // ⁠
+    { 0, 0, 0, 0, 0, 0, 11031 }, // ⁡
+    { 0, 0, 0, 0, 0, 0, 11031 }, // ⁢
+    { 0, 0, 0, 0, 0, 0, 11031 }, // ⁣
+    { 0, 0, 0, 0, 0, 0, 11031 }, // ⁤
+    { 10, 12, 11, 1, 21, 30, 11031 }, // ⁰
+    { 11, 12, 11, 0, 21, 33, 11061 }, // ⁴
+    { 10, 12, 11, 1, 21, 30, 11094 }, // ⁵
+    { 10, 12, 11, 1, 21, 30, 11124 }, // ⁶
+    { 9, 12, 11, 2, 21, 27, 11154 }, // ⁷
+    { 9, 12, 11, 1, 21, 27, 11181 }, // ⁸
+    { 10, 12, 11, 0, 21, 30, 11208 }, // ⁹
+    { 10, 9, 14, 2, 18, 23, 11238 }, // ⁿ
+    { 10, 12, 11, 1, 8, 30, 11261 }, // ₀
+    { 7, 13, 11, 2, 9, 23, 11291 }, // ₁
+    { 10, 12, 11, 0, 8, 30, 11314 }, // ₂
+    { 9, 12, 11, 1, 8, 27, 11344 }, // ₃
+    { 11, 12, 11, 0, 8, 33, 11371 }, // ₄
+    { 10, 12, 11, 1, 8, 30, 11404 }, // ₅
+    { 10, 12, 11, 1, 8, 30, 11434 }, // ₆
+    { 9, 12, 11, 2, 8, 27, 11464 }, // ₇
+    { 9, 12, 11, 1, 8, 27, 11491 }, // ₈
+    { 10, 12, 11, 0, 8, 30, 11518 }, // ₉
+    { 16, 18, 16, 0, 18, 72, 11548 }, // ₣
+    { 17, 19, 16, -1, 18, 81, 11620 }, // ₤
+    { 30, 19, 31, 0, 18, 143, 11701 }, // ₧
+    { 18, 19, 16, -1, 18, 86, 11844 }, // €
+    { 15, 11, 25, 5, 14, 42, 11930 }, // ←
+    { 11, 17, 25, 7, 17, 47, 11972 }, // ↑
+    { 15, 11, 25, 5, 14, 42, 12019 }, // →
+    { 11, 17, 25, 7, 17, 47, 12061 }, // ↓
+    { 15, 11, 25, 5, 14, 42, 12108 }, // ↔
+    { 11, 17, 25, 7, 17, 47, 12150 }, // ↕
+    { 11, 17, 25, 7, 17, 47, 12197 }, // ↨
+    { 11, 17, 25, 7, 17, 47, 12244 }, // ↲
+    { 11, 17, 25, 7, 17, 47, 12291 }, // ↳
+    { 13, 12, 25, 6, 15, 39, 12338 }, // ↵
+    { 15, 11, 25, 5, 14, 42, 12377 }, // ⇐
+    { 11, 15, 25, 7, 16, 42, 12419 }, // ⇑
+    { 15, 11, 25, 5, 14, 42, 12461 }, // ⇒
+    { 11, 15, 25, 7, 16, 42, 12503 }, // ⇓
+    { 15, 11, 25, 5, 14, 42, 12545 }, // ⇔
+    { 17, 19, 25, 4, 18, 81, 12587 }, // ∀
+    { 13, 21, 16, 1, 20, 69, 12668 }, // ∂
+    { 11, 18, 25, 7, 18, 50, 12737 }, // ∃
+    { 19, 20, 25, 3, 19, 95, 12787 }, // ∅
+    { 16, 18, 16, 0, 18, 72, 12882 }, // ∆
+    { 17, 19, 25, 4, 18, 81, 12954 }, // ∇
+    { 17, 18, 25, 4, 18, 77, 13035 }, // ∈
+    { 17, 22, 25, 4, 19, 94, 13112 }, // ∉
+    { 17, 14, 25, 4, 16, 60, 13206 }, // ∊
+    { 17, 18, 25, 4, 18, 77, 13266 }, // ∋
+    { 17, 22, 25, 4, 19, 94, 13343 }, // ∌
+    { 17, 14, 25, 4, 16, 60, 13437 }, // ∍
+    { 19, 22, 20, 1, 18, 105, 13497 }, // ∏
+    { 15, 23, 15, 0, 18, 87, 13602 }, // ∑
+    { 11, 3, 16, 2, 10, 9, 13689 }, // −
+    { 14, 20, 12, -1, 18, 70, 13698 }, // ∕
+    { 10, 20, 12, 1, 18, 50, 13768 }, // ∖
+    { 12, 13, 16, 2, 15, 39, 13818 }, // ∗
+    { 9, 9, 16, 3, 13, 21, 13857 }, // ∘
+    { 4, 4, 16, 6, 9, 4, 13878 }, // ∙
+    { 16, 24, 16, 0, 21, 96, 13882 }, // √
+    { 13, 10, 16, 1, 13, 33, 13978 }, // ∝
+    { 16, 9, 16, 0, 12, 36, 14011 }, // ∞
+    { 16, 18, 25, 4, 18, 72, 14047 }, // ∟
+    { 18, 18, 25, 3, 18, 81, 14119 }, // ∠
+    { 3, 26, 13, 5, 20, 20, 14200 }, // ∣
+    { 8, 26, 13, 2, 20, 52, 14220 }, // ∥
+    { 17, 18, 25, 4, 18, 77, 14272 }, // ∧
+    { 17, 18, 25, 4, 18, 77, 14349 }, // ∨
+    { 15, 18, 25, 5, 18, 68, 14426 }, // ∩
+    { 15, 19, 25, 5, 18, 72, 14494 }, // ∪
+    { 14, 26, 16, 1, 20, 91, 14566 }, // ∫
+    { 16, 15, 25, 5, 14, 60, 14657 }, // ∴
+    { 16, 15, 25, 5, 14, 60, 14717 }, // ∵
+    { 5, 13, 8, 1, 15, 17, 14777 }, // ∶
+    { 16, 15, 25, 5, 14, 60, 14794 }, // ∷
+    { 15, 5, 25, 5, 10, 19, 14854 }, // ∼
+    { 15, 13, 25, 5, 15, 49, 14873 }, // ≅
+    { 12, 9, 16, 2, 13, 27, 14922 }, // ≈
+    { 15, 8, 25, 5, 11, 30, 14949 }, // ≍
+    { 11, 11, 16, 2, 14, 31, 14979 }, // ≠
+    { 15, 11, 25, 5, 13, 42, 15010 }, // ≡
+    { 12, 15, 16, 2, 15, 45, 15052 }, // ≤
+    { 12, 15, 16, 2, 15, 45, 15097 }, // ≥
+    { 21, 13, 25, 2, 15, 69, 15142 }, // ≪
+    { 21, 13, 25, 2, 15, 69, 15211 }, // ≫
+    { 17, 15, 25, 4, 16, 64, 15280 }, // ⊃
+    { 17, 23, 25, 4, 20, 98, 15344 }, // ⊄
+    { 17, 23, 25, 4, 20, 98, 15442 }, // ⊅
+    { 17, 18, 25, 4, 18, 77, 15540 }, // ⊆
+    { 17, 18, 25, 4, 18, 77, 15617 }, // ⊇
+    { 19, 19, 25, 3, 18, 91, 15694 }, // ⊕
+    { 19, 19, 25, 3, 18, 91, 15785 }, // ⊖
+    { 19, 19, 25, 3, 18, 91, 15876 }, // ⊗
+    { 19, 19, 25, 3, 18, 91, 15967 }, // ⊘
+    { 15, 18, 25, 5, 18, 68, 16058 }, // ⊥
+    { 4, 4, 16, 6, 9, 4, 16126 }, // ⋅
+    { 21, 4, 25, 2, 9, 21, 16130 }, // ⋯
+    { 27, 26, 18, -5, 20, 176, 16151 }, // ﬀ
+    { 21, 26, 16, -5, 20, 137, 16327 }, // ﬁ
+    { 22, 26, 17, -5, 20, 143, 16464 }, // ﬂ
+    { 29, 26, 24, -5, 20, 189, 16607 }, // ﬃ
+    { 30, 26, 25, -5, 20, 195, 16796 }, // ﬄ
+    { 24, 26, 18, -5, 20, 156, 16991 }, // ﬅ
+    { 21, 19, 20, 0, 18, 100, 17147 }, // ﬆ
+    { 25, 24, 25, 0, 21, 150, 17247 }, // �
 };
 
 static const EpdUnicodeInterval bookerly_12_italicIntervals[] = {
@@ -2352,32 +2377,310 @@ static const EpdUnicodeInterval bookerly_12_italicIntervals[] = {
     { 0x22A5, 0x22A5, 0x2E7 },
     { 0x22C5, 0x22C5, 0x2E8 },
     { 0x22EF, 0x22EF, 0x2E9 },
-    { 0xFFFD, 0xFFFD, 0x2EA },
+    { 0xFB00, 0xFB06, 0x2EA },
+    { 0xFFFD, 0xFFFD, 0x2F1 },
 };
 
 static const EpdFontGroup bookerly_12_italicGroups[] = {
-    { 0, 3525, 5893, 100, 0 },
-    { 3525, 3335, 6863, 96, 100 },
-    { 6860, 5181, 11070, 128, 196 },
-    { 12041, 308, 351, 33, 324 },
-    { 12349, 7970, 18223, 220, 357 },
-    { 20319, 1048, 1809, 74, 577 },
-    { 21367, 437, 517, 18, 651 },
-    { 21804, 279, 382, 4, 669 },
-    { 22083, 423, 657, 15, 673 },
-    { 22506, 1815, 3564, 58, 688 },
-    { 24321, 105, 150, 1, 746 },
+    { 0, 4804, 9909, 151, 5 },
+    { 4804, 2889, 5092, 66, 358 },
+    { 7693, 8350, 18177, 261, 0 },
+    { 16043, 8677, 17397, 276, 471 },
+};
+
+static const uint8_t bookerly_12_italicGlyphGroups[754] = {
+    2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0,
+    2, 2, 2, 2, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0,
+    0, 2, 2, 2, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0,
+    0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 3, 3, 3, 0, 0, 3, 3, 0, 0, 3,
+    3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+};
+
+static const uint8_t bookerly_12_italicKernLeftClasses[754] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 41, 0, 87,
+    0, 1, 49, 1, 25, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 2, 79, 0, 9, 37, 61, 47, 26, 26, 55,
+    64, 28, 106, 35, 9, 52, 39, 22, 56, 19, 6, 17, 17, 90, 12, 103,
+    76, 43, 0, 0, 0, 0, 7, 10, 59, 0, 40, 38, 20, 7, 0, 105,
+    88, 0, 7, 7, 10, 10, 83, 46, 59, 59, 7, 34, 34, 99, 34, 67,
+    68, 0, 0, 0, 0, 66, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 70,
+    0, 0, 0, 54, 2, 2, 2, 2, 2, 2, 37, 0, 37, 37, 37, 37,
+    26, 26, 26, 26, 9, 35, 9, 9, 9, 9, 9, 0, 9, 6, 6, 6,
+    6, 12, 57, 113, 7, 7, 7, 7, 7, 7, 40, 84, 40, 40, 40, 40,
+    0, 0, 29, 29, 10, 7, 10, 10, 10, 10, 10, 0, 82, 7, 7, 7,
+    7, 34, 10, 34, 2, 7, 2, 7, 42, 74, 0, 59, 0, 59, 0, 59,
+    0, 59, 9, 23, 9, 0, 37, 40, 37, 40, 37, 40, 86, 91, 37, 40,
+    47, 20, 47, 20, 47, 20, 47, 20, 26, 7, 26, 7, 26, 80, 26, 29,
+    26, 29, 77, 102, 26, 7, 55, 105, 55, 104, 64, 88, 59, 28, 0, 28,
+    109, 0, 23, 0, 0, 28, 107, 35, 7, 35, 7, 35, 7, 7, 35, 100,
+    9, 10, 9, 10, 9, 10, 37, 40, 22, 46, 22, 46, 22, 46, 56, 59,
+    56, 59, 56, 84, 56, 59, 19, 84, 19, 0, 19, 59, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 78, 17, 34, 12, 34, 12, 103, 67, 103,
+    67, 103, 67, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 37, 37, 72, 0, 0, 56, 15, 15, 73, 21, 21,
+    51, 8, 15, 3, 15, 14, 0, 36, 11, 44, 37, 8, 36, 15, 15, 8,
+    15, 98, 15, 13, 15, 24, 112, 11, 3, 63, 48, 44, 15, 15, 44, 21,
+    15, 21, 13, 13, 15, 7, 97, 62, 0, 10, 40, 40, 62, 7, 7, 59,
+    7, 7, 7, 10, 53, 10, 59, 53, 27, 10, 92, 16, 7, 7, 16, 30,
+    7, 30, 10, 10, 7, 40, 40, 53, 0, 59, 59, 0, 85, 93, 30, 30,
+    53, 59, 7, 27, 7, 96, 30, 13, 10, 45, 114, 44, 16, 21, 30, 24,
+    10, 33, 69, 32, 0, 0, 0, 65, 81, 36, 62, 65, 81, 8, 59, 8,
+    59, 8, 59, 44, 16, 0, 0, 0, 0, 89, 62, 112, 59, 11, 16, 18,
+    27, 18, 27, 60, 75, 44, 16, 44, 16, 15, 7, 58, 53, 111, 40, 111,
+    40, 15, 8, 40, 110, 101, 44, 16, 71, 93, 44, 16, 15, 0, 44, 16,
+    0, 14, 7, 14, 7, 37, 40, 37, 40, 13, 10, 13, 10, 8, 40, 36,
+    62, 94, 108, 15, 7, 15, 7, 13, 10, 13, 10, 13, 10, 13, 10, 3,
+    27, 3, 27, 3, 27, 15, 7, 11, 0, 15, 7, 32, 0, 50, 95, 48,
+    92, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 49, 49, 0, 49, 49, 49, 0, 0, 5, 4, 31, 5, 5, 4, 1,
+    0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 70, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 38, 0, 0, 0, 0, 59,
+    59, 0,
+};
+
+static const uint8_t bookerly_12_italicKernRightClasses[754] = {
+    0, 0, 0, 0, 0, 0, 84, 0, 0, 0, 0, 0, 0, 0, 71, 26,
+    0, 12, 34, 2, 43, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32,
+    31, 0, 0, 0, 55, 0, 3, 58, 5, 58, 22, 22, 5, 22, 22, 48,
+    22, 22, 90, 22, 5, 58, 5, 58, 79, 28, 7, 18, 18, 72, 11, 0,
+    0, 9, 81, 0, 0, 0, 1, 25, 1, 1, 1, 10, 20, 25, 87, 57,
+    25, 25, 44, 44, 1, 94, 1, 44, 30, 50, 17, 16, 16, 92, 62, 74,
+    0, 0, 85, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 36,
+    0, 34, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 86,
+    0, 0, 0, 98, 3, 3, 3, 3, 3, 3, 42, 5, 22, 22, 22, 22,
+    22, 22, 22, 22, 58, 22, 5, 5, 5, 5, 5, 0, 5, 7, 7, 7,
+    7, 11, 22, 83, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    97, 87, 64, 64, 1, 44, 1, 1, 1, 1, 1, 0, 60, 17, 17, 17,
+    17, 16, 82, 16, 3, 1, 3, 1, 3, 1, 5, 1, 5, 1, 5, 1,
+    5, 63, 58, 1, 58, 1, 22, 1, 22, 1, 22, 1, 22, 1, 22, 1,
+    5, 20, 5, 20, 5, 20, 5, 20, 22, 25, 22, 77, 22, 91, 22, 64,
+    22, 64, 22, 87, 22, 44, 22, 87, 48, 99, 22, 25, 44, 22, 25, 22,
+    25, 22, 25, 22, 25, 22, 25, 22, 44, 22, 44, 22, 44, 44, 22, 44,
+    5, 1, 5, 1, 5, 1, 5, 1, 58, 44, 58, 44, 58, 44, 79, 30,
+    79, 30, 79, 30, 79, 67, 28, 50, 28, 50, 28, 50, 7, 17, 7, 17,
+    7, 17, 7, 17, 7, 17, 7, 17, 18, 16, 11, 16, 11, 0, 74, 0,
+    74, 0, 74, 83, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 14, 14, 13, 14, 23, 79, 14, 14, 56, 35, 14,
+    13, 14, 14, 33, 14, 24, 14, 88, 14, 51, 14, 54, 79, 14, 14, 14,
+    35, 93, 14, 23, 14, 88, 23, 13, 33, 78, 39, 14, 19, 14, 14, 13,
+    14, 14, 79, 14, 65, 4, 80, 4, 59, 68, 4, 41, 38, 27, 27, 49,
+    15, 53, 49, 4, 49, 49, 4, 49, 21, 4, 75, 27, 8, 27, 27, 61,
+    27, 27, 38, 49, 73, 4, 4, 69, 59, 4, 76, 79, 95, 46, 15, 49,
+    69, 49, 27, 21, 27, 13, 49, 23, 4, 52, 21, 14, 49, 0, 96, 88,
+    49, 14, 89, 14, 59, 14, 49, 54, 41, 79, 38, 14, 49, 14, 49, 0,
+    0, 13, 0, 14, 49, 14, 49, 14, 49, 23, 4, 23, 4, 13, 49, 37,
+    21, 37, 21, 39, 75, 0, 0, 19, 8, 19, 8, 14, 69, 47, 40, 47,
+    40, 14, 54, 41, 14, 49, 35, 15, 14, 49, 14, 49, 19, 8, 0, 53,
+    79, 24, 4, 24, 4, 45, 4, 14, 4, 100, 66, 0, 66, 54, 41, 79,
+    38, 79, 70, 14, 27, 14, 27, 23, 4, 23, 4, 23, 4, 0, 38, 33,
+    21, 33, 21, 33, 21, 0, 8, 14, 59, 14, 27, 14, 59, 39, 75, 39,
+    75, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 34, 34, 0, 34, 34, 34, 0, 0, 6, 29, 2, 6, 6, 29, 2,
+    0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 36, 86, 0, 84, 0, 0, 0,
+    55, 55, 84, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 10, 10, 10, 10, 10,
+    30, 0,
+};
+
+static const int8_t bookerly_12_italicKernMatrix[11615] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, -1, -2, -2, -3, 0, 1, -2, 0, -1, 0, 0, -2, 0, -2, -2, 0, -2, 0, -1, 1, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 1, 0, -2, 0, 1, -1, 0, 1, 0, 0, 1, 2, -3, 2, 0, 0, 1, -2, 0, 0, 0, 2, 2, 0, 0, 0, -2, -2, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, -1, -2, -2, 0, -4, 0, -2, 0, 0, 0, 0, -2, -1, -3, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -3, 0, -2, 0, 0, 0, 0, 1, 0, 0, -3, 1, 0, -3, 0, 0, 0, 2, 0, 0, 0, 0, -3, 0, 2, 0, 0, 1, 0, 0, 0, 2, 0, -2, 0, 2, -1, 1, -1, -1, 0, -2, 0, -3, 0, 0, 0, 0, 0, -2, 1, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 1, 1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, -2, -4, -4, -2, -2, 0, -1, 0, 0, -2, 0, -4, -1, -1, -4, 0, -1, -1, 0, -3, 0, -1, -2, -4, 0, 0, -1, -1, 0, -2, 0, 0, 0, 0, -3, 0, 0, -2, -1, -2, -2, -4, 0, 0, -4, 0, 0, -1, 0, 0, -3, -1, -2, -1, -1, -1, 0, -1, -2, -2, 0, 0, -2, 0, -2, 0, -2, -2, 0, 0, 0, -1, -3, -1, -1, -2, 0, -1, -1, -2, 0, 0, 0, -2, 0, 0, -1, -1, -2, -2, 0, -1, -2, 0, 0, 0, -1, 0, 0, 0,
+    0, -2, -2, -3, -2, 0, 0, -1, 0, 0, -1, 0, -2, 0, -1, -4, 0, 0, -1, 0, -2, 0, -1, 0, -3, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -2, 0, 0, -1, 0, 0, -2, -3, 0, 0, -3, 0, 0, 0, 0, 0, -2, -1, -2, 0, 0, 0, 0, -1, 0, -2, 0, 0, -2, 0, -2, -1, -2, -2, 0, -1, 0, 0, -2, -1, -1, -2, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, 0, -1, -1, 0, 0, 0, 0, -2, 0, 0,
+    0, -1, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, -1, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, -1, 0, 0, 0, -1, -1, 0, -1, 0, -1, 0, 0, 1, -2, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, -1, 0, 0, 0, 0, 0, -1, 0, -1, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, -1, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, -1, 0, 1, 0, 0, 0, 0, 0, -2, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 2, 0, 0, 1, 0, -2, -2, 1, 0, -1, -1, 0, -1, 0, -2, -1, 0, -2, 0, -2, 0, 0, 0, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, -2, -3, 0, -1, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, -2, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -2, 1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -2, 0, -2, -4, 0, 0, 0, -2, 0, 0, 0, 0, 0, -3, 0, -2, 0, -1, 1, 0, -2, -1, 0, -2, 0, 0, 0, -1, 0, 0, -1, -2, 0, 1, -2, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, -3, 0, 1, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, -3, -3, 0, -1, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 1, 0, 0, 0, -1, -2, -2, 0, -1, 0, -1, 0, 0, 0, 0, 0, -3, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -3, 0, 0, 0, 1, 0, 0, 0, -1, -2, 0, 1, -1, 0, 0, 0, -1, -1, 1, -1, -2, -1, 0, -1, 0, -2, -1, 0, -2, 0, -2, 0, 0, 0, 0, 0, -2, 0, -2, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, -1, 0, 0, 1, -1, 0, 0, -2, 0, -1, -2, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, -1, -2, -2, 0, 0, 1, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 1, -1, -2, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 1, 0, 0, 0, 2, 0, 0, 0, 0, 0, 1, 1, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -2, 0, -1, -2, 0, 0, 0, -2, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, -1, -1, -1, 0, -2, 0, -2, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, -1, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 2, 0, 0, 2, 1, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 3, 3, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 2, 0, 1, 0, 0, 0, 0, 1, 1, 0, 0, 0, 1, 0, 0, 0, 3, 0, 0, 1, 0, 0, 3, 0, 0, 0, 1, 3, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0,
+    0, 0, -3, 0, -1, 0, 0, 0, 0, -1, 0, 0, -3, 0, -1, -3, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -2, -2, 0, 0, -2, 0, 0, -1, -1, 0, -1, 0, -2, 0, -3, 0, 0, 0, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, -2, -2, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, -3, 0, -1, 0, 0, -2, 0, 0, -1, -2, 0, 0, -1, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, -2, 0, -1, -2, -3, 0, 0, -3, 0, 0, 0, 0, -1, -2, 0, -2, 0, 0, 0, 0, 0, -1, -2, -1, 0, -2, 0, -1, -2, -2, -1, 0, 0, 0, 0, -2, -2, -1, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -2, -1, 0, -2, 0, -2, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -2, 0, -1, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, -1, -2, -2, -3, 0, 2, -2, 0, -1, 0, 0, -2, 0, -2, -2, 0, -2, 0, -1, 1, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 1, 0, -2, 0, 1, -1, 0, 1, 0, 0, 1, 2, -3, 2, 0, 0, 1, -2, 0, 0, 0, 2, 2, 0, 0, 0, -2, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0,
+    0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 1, 0, -2, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2, 0, 0, 0, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, -2, 0, 0, 0, -1, 0, 0, 0, -2, 0, 0, -3, 0, 0, 0, 1, 0, 0, 0, 0, -3, 0, 1, -1, 0, 1, 0, 0, 0, 1, 0, -2, 0, 0, -2, 0, -3, -2, 0, 0, 0, -3, 0, 0, 0, -1, 0, -2, 0, -2, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, -2, 0, 0, 0, -2, 1, 0, -2, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 1, 0, 0, 2, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 1, 2, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 1, 0, 1, 0,
+    0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 1, -1, 5, 0, 0, 0, 0, 0, -1, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 1, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 4, 1, 0, 0, 0, -1, 0, 0, 0, 0, 2, 0, 0, -1, 0, 2, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 2, 0, 0, 1, 0, 0, 0, 0, 2, 4, 0, 0, -1, 0, 2, -1, 0, 0, 0, 0, -1, 2, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, -1, -2, -2, 0, -4, 3, -2, 0, 0, 0, 0, -2, -1, -3, 0, 1, 0, 0, 0, 0, 0, -2, 0, -2, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, -1, 0, 0, 0, 0, -1, 0, 3, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, -1, -2, 0, 0, -2, 0, -1, 0, 0, -1, 0, -2, -2, 2, -1, 0, 0, 1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 2, 0, -2, 0, 2, 0, 0, 1, 0, 0, 1, 0, -2, 0, 0, 0, 2, -2, 0, 1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 2, 0, 0, 0, 0, 0, 0, 2, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0, -1, -3, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, -2, 0, 0, -1, 0, -1, -1, 0, 0, 0, -3, 0, 0, 0, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 1, 0, 0, 0, 1, -2, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, 1, -2, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, 1, 0, -1, 1, 0, 0, 0, 0, -2, 0, -1, 0, 0, 0, -1, -2, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -2, 0, -2, -2, 0, 0, 0, -2, 0, 0, 0, 0, 0, -2, 0, -2, 0, -1, 0, 0, -2, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -2, 0, 1, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -3, -2, 0, 0, 0, -1, 0, -1, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 2, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, 0, 0, 0, -1, 0, 0, 0, 2, 2, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -3, -2, 0, 0, 0, 0, 0, -2, 0, -2, -3, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -3, 0, -1, 0, 0, 0, 0, -3, -1, 0, -2, 0, 0, 0, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 1, 0, 0, 0, 1, -2, 0, 0, 0, 0, 1, 2, -1, 0, 0, 0, 1, 0, 0, 1, 0, 3, 0, 0, 0, 0, -1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 0, 0, -2, 0, 0, -2, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 1, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, 0, 0, 0, -1, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 2, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 2, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 1, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, -1, -2, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 1, -1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 1, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, -1, 0, 0, -2, 0, 0, -1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, -1, 0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t bookerly_12_italicGlyphLookup[368] = {
+    0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0001, 0x0002, 0xFFFF, 0xFFFF, 0xFFFF, 0x0003, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0004, 0xFFFF, 0xFFFF,
+    0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, 0x0010, 0x0011, 0x0012, 0x0013, 0x0014,
+    0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, 0x0020, 0x0021, 0x0022, 0x0023, 0x0024,
+    0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, 0x0030, 0x0031, 0x0032, 0x0033, 0x0034,
+    0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, 0x0040, 0x0041, 0x0042, 0x0043, 0x0044,
+    0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051, 0x0052, 0x0053, 0x0054,
+    0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, 0x0060, 0x0061, 0x0062, 0x0063, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x0072, 0x0073,
+    0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, 0x0080, 0x0081, 0x0082, 0x0083,
+    0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F, 0x0090, 0x0091, 0x0092, 0x0093,
+    0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F, 0x00A0, 0x00A1, 0x00A2, 0x00A3,
+    0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF, 0x00B0, 0x00B1, 0x00B2, 0x00B3,
+    0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF, 0x00C0, 0x00C1, 0x00C2, 0x00C3,
+    0x0241, 0x0242, 0x0243, 0x0244, 0x0245, 0x0246, 0x0247, 0x0248, 0x0249, 0x024A, 0x024B, 0x024C, 0x024D, 0x024E, 0x024F, 0x0250,
+    0x0251, 0x0252, 0x0253, 0x0254, 0x0255, 0x0256, 0x0257, 0x0258, 0x0259, 0x025A, 0x025B, 0x025C, 0x025D, 0x025E, 0x025F, 0x0260,
+    0x0261, 0x0262, 0x0263, 0x0264, 0x0265, 0x0266, 0x0267, 0x0268, 0x0269, 0x026A, 0x026B, 0x026C, 0x026D, 0x026E, 0x026F, 0x0270,
+    0x0271, 0xFFFF, 0x0272, 0x0273, 0x0274, 0x0275, 0x0276, 0x0277, 0x0278, 0x0279, 0x027A, 0x027B, 0x027C, 0xFFFF, 0x027D, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x027E, 0x027F, 0xFFFF, 0xFFFF, 0x0280, 0x0281, 0x0282, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x0283, 0xFFFF, 0xFFFF, 0xFFFF, 0x0284, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0285,
+    0x0286, 0x0287, 0x0288, 0x0289, 0x028A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
 };
 
 static const EpdFontData bookerly_12_italic = {
     bookerly_12_italicBitmaps,
     bookerly_12_italicGlyphs,
     bookerly_12_italicIntervals,
-    64,
+    65,
     33,
     27,
     -7,
     true,
     bookerly_12_italicGroups,
-    11,
+    4,
+    bookerly_12_italicKernLeftClasses,
+    bookerly_12_italicKernRightClasses,
+    bookerly_12_italicKernMatrix,
+    101,
+    nullptr,
+    0,
+    0,
+    bookerly_12_italicGlyphLookup,
+    bookerly_12_italicGlyphGroups,
+    false,
+    nullptr,
 };
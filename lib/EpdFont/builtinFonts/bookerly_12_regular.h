@@ -3,1451 +3,1480 @@
  * name: bookerly_12_regular
  * size: 12
  * mode: 2-bit  compressed: true
- * Command used: fontconvert.py bookerly_12_regular 12 ../builtinFonts/source/Bookerly/Bookerly-Regular.ttf --2bit --compress
+ * Command used: fontconvert.py bookerly_12_regular 12 ../builtinFonts/source/Bookerly/Bookerly-Regular.ttf --2bit --compress --frequency-corpus ../../../test/hyphenation_eval/resources/english_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/french_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/german_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/italian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/russian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/spanish_hyphenation_tests.txt
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t bookerly_12_regularBitmaps[23024] = {
-    0x8D, 0x58, 0x4D, 0x88, 0x1C, 0xC7, 0x15, 0x7E, 0xDD, 0xA5, 0x55, 0x63, 0x37, 0x76, 0xED, 0xC1,
-    0x0A, 0xC1, 0x2B, 0xA9, 0x7D, 0xC8, 0x41, 0x31, 0xBB, 0xDB, 0x39, 0xF8, 0xA0, 0xC0, 0xCC, 0x74,
-    0xD9, 0x3E, 0xE8, 0xE0, 0x83, 0x97, 0xB0, 0x63, 0x43, 0x74, 0x70, 0x8E, 0xB6, 0xC1, 0x59, 0x1F,
-    0x14, 0x10, 0x61, 0x76, 0xA7, 0x6D, 0x1D, 0x7D, 0xB0, 0x02, 0x4E, 0x2E, 0x39, 0x04, 0x02, 0x81,
-    0x68, 0x8D, 0x91, 0x0E, 0x8B, 0x59, 0x43, 0x6B, 0xBA, 0x56, 0x3A, 0xE8, 0x20, 0x88, 0x5B, 0x51,
-    0x44, 0x0E, 0x22, 0xA8, 0x15, 0x9B, 0x38, 0x48, 0x84, 0x2D, 0x9B, 0x76, 0xD2, 0xBB, 0xEA, 0xE9,
-    0xCA, 0xF7, 0x6A, 0x66, 0x25, 0xD9, 0x92, 0x9C, 0xCC, 0xF4, 0xCE, 0x4C, 0x57, 0x75, 0xBD, 0x7A,
-    0x3F, 0xDF, 0xFB, 0xDE, 0xAB, 0x3D, 0x92, 0x35, 0x75, 0x5D, 0x57, 0x78, 0x6D, 0x6C, 0x9C, 0x38,
-    0x41, 0x74, 0x72, 0xDC, 0xCC, 0x1E, 0x59, 0xBC, 0x79, 0xE7, 0xD8, 0xBF, 0x0E, 0x6F, 0xFC, 0xF2,
-    0xCA, 0x6D, 0xF1, 0xC1, 0x3E, 0x7A, 0xD2, 0xD7, 0xF4, 0x84, 0x48, 0xE9, 0x90, 0x50, 0x34, 0x1F,
-    0x92, 0xB4, 0xB6, 0x99, 0xF9, 0xE4, 0xB5, 0x65, 0x3A, 0xF1, 0x04, 0xD1, 0xB9, 0x83, 0x44, 0x66,
-    0x9E, 0x0E, 0x7C, 0xBD, 0xBA, 0x34, 0xB4, 0xB6, 0xF4, 0xF5, 0x09, 0x12, 0xFA, 0x1C, 0x89, 0xD4,
-    0x50, 0xA0, 0x4A, 0xA2, 0xC7, 0x88, 0x0E, 0x11, 0xE1, 0xA1, 0x05, 0xF2, 0x6D, 0x25, 0x3F, 0x6A,
-    0x16, 0x0F, 0x76, 0xBB, 0x07, 0xE7, 0xBB, 0x07, 0x29, 0x3E, 0x48, 0xB2, 0x21, 0x61, 0x15, 0x0D,
-    0x0D, 0xFD, 0xB0, 0x99, 0x3D, 0xDA, 0x3D, 0x71, 0xB4, 0xBB, 0x79, 0xB4, 0x73, 0xFE, 0x68, 0x96,
-    0x58, 0x13, 0xDA, 0x94, 0x9E, 0xA3, 0xE9, 0x05, 0xB5, 0x7E, 0x46, 0x93, 0xD7, 0x0C, 0xD1, 0x11,
-    0x0A, 0xC6, 0xD8, 0xC4, 0xFB, 0xBA, 0xA2, 0x73, 0xD4, 0x09, 0xF4, 0x61, 0x0A, 0x74, 0x47, 0x68,
-    0x3A, 0x29, 0xB0, 0x79, 0x90, 0x76, 0x24, 0x8C, 0x10, 0x17, 0xF4, 0xAC, 0xD0, 0x9B, 0x47, 0x63,
-    0x13, 0xBF, 0x16, 0xCA, 0xDF, 0x6A, 0xBB, 0x75, 0xA5, 0xEC, 0x92, 0xEA, 0x2C, 0x78, 0x25, 0x85,
-    0xA2, 0x38, 0x4C, 0x54, 0x76, 0xF0, 0x73, 0x5E, 0x14, 0x8B, 0x58, 0xB2, 0x88, 0xD5, 0x86, 0x76,
-    0x36, 0xA1, 0x64, 0xD0, 0x12, 0xAC, 0x9D, 0xA1, 0xFB, 0x5F, 0xC3, 0x82, 0x28, 0xBC, 0x8D, 0x8F,
-    0x41, 0x98, 0x92, 0x5F, 0x62, 0xB1, 0x54, 0x1B, 0x44, 0x3D, 0xAC, 0xA2, 0xAC, 0x43, 0xE4, 0x19,
-    0x45, 0x14, 0x95, 0x51, 0xEB, 0xDD, 0x29, 0x86, 0x95, 0x7C, 0x49, 0x2F, 0xD0, 0x40, 0xEA, 0x13,
-    0xBE, 0x91, 0x17, 0x8A, 0x50, 0xCB, 0xEB, 0x14, 0xB1, 0xA5, 0x09, 0xC9, 0x9A, 0x86, 0xBF, 0xB1,
-    0xAD, 0x1A, 0xDA, 0x2B, 0x56, 0xCD, 0x2C, 0xD1, 0xEC, 0xB3, 0xB7, 0xDF, 0xFA, 0xF8, 0xFA, 0x53,
-    0xF4, 0x7D, 0x1A, 0x90, 0x11, 0x45, 0x98, 0x4A, 0x5A, 0xA4, 0x2E, 0x75, 0x70, 0xBB, 0x49, 0xB5,
-    0x7B, 0x6F, 0x52, 0x86, 0xBB, 0x1E, 0xC5, 0x24, 0xD3, 0x40, 0x0B, 0x43, 0x0D, 0xA6, 0xE9, 0x07,
-    0x18, 0xC1, 0x7D, 0xE1, 0x1B, 0xAA, 0xF0, 0x40, 0xD7, 0x3D, 0x10, 0x63, 0x1B, 0x7E, 0xEF, 0x89,
-    0xA8, 0x3C, 0x27, 0x73, 0x91, 0x8E, 0x4E, 0xAC, 0x38, 0x2C, 0x2E, 0xAB, 0x5D, 0x1D, 0xD8, 0x17,
-    0x76, 0x3F, 0xBB, 0x4D, 0xBF, 0x2F, 0x08, 0x16, 0x60, 0xC6, 0xC0, 0x93, 0x24, 0xE9, 0xC0, 0x6A,
-    0xDF, 0xDA, 0x2F, 0x5F, 0xBD, 0xA6, 0xE0, 0xBC, 0x8E, 0x1B, 0x4D, 0xB1, 0x64, 0x10, 0x14, 0xAB,
-    0xA1, 0xAE, 0x23, 0xA1, 0x67, 0xA9, 0xBF, 0x6C, 0xC7, 0xEB, 0x7F, 0x5C, 0x8C, 0x2E, 0x9A, 0x59,
-    0xF7, 0xC8, 0x49, 0xC2, 0xDE, 0x9E, 0x21, 0xBF, 0x60, 0x09, 0x70, 0x0C, 0x56, 0x1E, 0x76, 0x33,
-    0x03, 0x9E, 0xA1, 0x07, 0x66, 0xBA, 0x77, 0x03, 0x28, 0xAD, 0x0A, 0x76, 0x5B, 0xAA, 0x45, 0x05,
-    0x9F, 0x9C, 0x2A, 0x28, 0x1B, 0x50, 0x70, 0x59, 0xD3, 0x6A, 0x43, 0xC1, 0x8D, 0x7B, 0x5F, 0x19,
-    0x85, 0x97, 0x0A, 0x6A, 0x7A, 0x14, 0xBD, 0x50, 0x09, 0x23, 0x77, 0x1B, 0x8A, 0x5B, 0xA2, 0x03,
-    0x4E, 0x48, 0x98, 0xAE, 0xD4, 0x40, 0x88, 0x57, 0xC3, 0x0D, 0xF4, 0xA8, 0x8F, 0x39, 0x7B, 0xC9,
-    0x8E, 0x79, 0xBF, 0xBC, 0xA1, 0x36, 0xD7, 0x99, 0x5F, 0x77, 0x29, 0x91, 0x24, 0xB5, 0x12, 0x25,
-    0x79, 0x50, 0xB1, 0x41, 0xF8, 0x88, 0xCE, 0xDF, 0x77, 0xF1, 0x6D, 0x7F, 0x39, 0xB1, 0xF6, 0x3D,
-    0x6B, 0x0B, 0x7A, 0x8A, 0x62, 0x2B, 0x76, 0x6D, 0x4C, 0xD9, 0xDB, 0x78, 0x3C, 0xD0, 0x08, 0x61,
-    0x60, 0x3C, 0xAB, 0x22, 0x9B, 0xCE, 0x26, 0x0A, 0x77, 0x90, 0x00, 0x51, 0xB1, 0x12, 0xF5, 0x4F,
-    0xED, 0xBB, 0xB6, 0xA2, 0xE5, 0x29, 0x60, 0x7C, 0x08, 0x8F, 0x80, 0x17, 0x60, 0x5B, 0x8E, 0x21,
-    0xB5, 0x22, 0x71, 0xB5, 0xA0, 0x9E, 0x54, 0xBE, 0xE9, 0x22, 0x42, 0x15, 0x55, 0x2E, 0xDA, 0x0A,
-    0x1B, 0x55, 0x43, 0xDE, 0x49, 0x14, 0x8C, 0xA9, 0x89, 0x8F, 0xB0, 0xD6, 0x53, 0x2C, 0x45, 0x58,
-    0xCB, 0x97, 0xF3, 0x22, 0x5F, 0x7F, 0xA1, 0xC0, 0xA6, 0x01, 0xB6, 0x09, 0xA0, 0xF8, 0x08, 0xF8,
-    0xDB, 0xBB, 0xE0, 0xB0, 0xFA, 0x7B, 0x79, 0x09, 0xF7, 0xCC, 0xF0, 0xC2, 0x7D, 0xE4, 0xE5, 0x85,
-    0xDF, 0x2E, 0x89, 0x9A, 0x44, 0xE5, 0x0C, 0xAD, 0x89, 0xD6, 0xD6, 0x61, 0x4C, 0x2D, 0x8B, 0xE1,
-    0xA9, 0x52, 0x98, 0x9A, 0x56, 0x01, 0xA0, 0xF7, 0xB5, 0xF8, 0x7B, 0xE5, 0x21, 0x06, 0x4D, 0xB8,
-    0x3B, 0xA6, 0x21, 0x84, 0x2E, 0xF1, 0xB6, 0x48, 0xEF, 0x4B, 0xC0, 0x82, 0xF1, 0xEA, 0x13, 0x94,
-    0x1D, 0x64, 0x95, 0xB0, 0x45, 0x44, 0xEC, 0x55, 0xB8, 0x80, 0x5D, 0x67, 0x9C, 0xC4, 0x55, 0x02,
-    0xE4, 0xE0, 0x4D, 0x1E, 0x62, 0xA5, 0xF7, 0x4D, 0x82, 0x1B, 0x8F, 0x29, 0x39, 0x5B, 0xF4, 0xA8,
-    0x91, 0x2A, 0x12, 0x45, 0xA0, 0x1B, 0x51, 0x46, 0x57, 0x4B, 0x0F, 0x46, 0x26, 0x0D, 0xAD, 0xC6,
-    0xC5, 0x2A, 0x35, 0x09, 0x45, 0xEF, 0xA7, 0xE2, 0xB3, 0x92, 0xAA, 0xF3, 0x94, 0x49, 0xEC, 0x8D,
-    0x30, 0x79, 0x4B, 0x4E, 0x42, 0x5E, 0x93, 0x75, 0xA1, 0xEA, 0x21, 0x54, 0x0A, 0x00, 0xF0, 0xAA,
-    0x9A, 0xBA, 0x58, 0x70, 0xAC, 0x0A, 0xF5, 0xD0, 0x1A, 0x6F, 0x7D, 0xB2, 0x73, 0xE2, 0xAE, 0xA1,
-    0xDA, 0x6F, 0x9D, 0x87, 0x79, 0xB1, 0xBC, 0x64, 0x36, 0xF7, 0xFC, 0x7F, 0xB3, 0x49, 0x3C, 0x78,
-    0x71, 0x2C, 0x8B, 0xCD, 0xBB, 0x59, 0x1C, 0xE8, 0xD5, 0xA0, 0xC8, 0xE4, 0x3B, 0xA6, 0xE3, 0x4D,
-    0x06, 0x40, 0x16, 0x48, 0xC8, 0x02, 0x64, 0x92, 0xA4, 0xB4, 0xC6, 0x19, 0x4C, 0x1E, 0x10, 0x16,
-    0x97, 0xE4, 0x37, 0x9C, 0x63, 0x44, 0xCF, 0xAE, 0x9F, 0xB1, 0xD6, 0x4C, 0xD7, 0x7B, 0xD6, 0x7E,
-    0xB5, 0xBE, 0xCE, 0x69, 0xF1, 0x1C, 0xEF, 0x4C, 0x11, 0x7C, 0x8B, 0x00, 0xF3, 0xAA, 0xC6, 0x49,
-    0x4A, 0xC3, 0x9A, 0x25, 0x1D, 0xD9, 0x7B, 0xBE, 0xA5, 0x64, 0x2C, 0x3E, 0xAC, 0x28, 0xD4, 0xC8,
-    0x0A, 0xAF, 0x00, 0xB9, 0x44, 0x7A, 0x58, 0x43, 0xDD, 0x1D, 0x0A, 0x89, 0xDE, 0x9E, 0xAA, 0xAA,
-    0x11, 0xCA, 0x80, 0xB1, 0x36, 0x7D, 0x85, 0x16, 0xEE, 0x8C, 0x78, 0xDB, 0xB0, 0x02, 0x88, 0x18,
-    0x4A, 0x31, 0xE3, 0x92, 0x6A, 0xA9, 0xE6, 0x0A, 0x71, 0xB1, 0x8C, 0x72, 0xD5, 0x05, 0xDD, 0x6D,
-    0xFA, 0x5F, 0xE8, 0x23, 0xA0, 0x2E, 0x18, 0xB8, 0xE9, 0xDF, 0x4E, 0xF7, 0xDB, 0x74, 0xA1, 0xF6,
-    0xBF, 0xDE, 0x14, 0x97, 0xD3, 0x4E, 0x90, 0x0E, 0x36, 0x03, 0x9D, 0x45, 0xC7, 0x74, 0x92, 0xDB,
-    0xA2, 0xEB, 0xB5, 0x51, 0xE9, 0x3B, 0x2B, 0x64, 0xEA, 0xE8, 0x4C, 0x91, 0x0F, 0x6C, 0x7E, 0x70,
-    0xDC, 0xB0, 0x4D, 0xF0, 0x27, 0xBD, 0x79, 0x9A, 0xC7, 0x59, 0x05, 0xC1, 0xCF, 0x31, 0x74, 0x29,
-    0xC7, 0xB3, 0xE2, 0x06, 0x7E, 0x2C, 0x30, 0x28, 0x0D, 0x3C, 0x12, 0xBC, 0x83, 0xC9, 0xAE, 0x03,
-    0x00, 0x4C, 0x0A, 0x7F, 0xBD, 0x82, 0x14, 0xB0, 0xA0, 0xCB, 0xDD, 0xF5, 0x06, 0xE0, 0x05, 0xCE,
-    0x06, 0x58, 0x8E, 0xE9, 0x50, 0xC3, 0x85, 0xF9, 0x67, 0xB6, 0x90, 0xB6, 0x98, 0x59, 0x5F, 0x02,
-    0x9E, 0x74, 0xB4, 0x95, 0x53, 0xE6, 0x23, 0x84, 0x52, 0x65, 0xC4, 0x5F, 0xB8, 0x2B, 0x43, 0xDB,
-    0x50, 0x6E, 0x71, 0x17, 0x69, 0x70, 0x58, 0xA8, 0x45, 0x99, 0x51, 0x2F, 0xD4, 0x08, 0x92, 0xD7,
-    0xC4, 0x77, 0x2C, 0xD6, 0xA9, 0x09, 0x63, 0xFC, 0x01, 0xC0, 0x6F, 0xC4, 0xCE, 0x6B, 0x1A, 0xE4,
-    0x17, 0x11, 0x5C, 0x40, 0xF3, 0x80, 0x40, 0xA8, 0x5D, 0xBE, 0x02, 0x80, 0x9C, 0xC8, 0x7C, 0x87,
-    0x04, 0x0E, 0xA0, 0x22, 0x62, 0x80, 0xC0, 0xEC, 0x0F, 0x50, 0x8E, 0x42, 0x98, 0x07, 0x64, 0xCD,
-    0xAC, 0x9F, 0x86, 0xAA, 0xB6, 0xF0, 0x9A, 0x57, 0x2C, 0xBC, 0x19, 0xB2, 0xFE, 0x23, 0xB8, 0x44,
-    0x62, 0x63, 0xBF, 0x02, 0x8A, 0xC1, 0x72, 0x14, 0xBD, 0x0B, 0xD6, 0x2B, 0x32, 0x24, 0x4C, 0xCC,
-    0x4C, 0x8F, 0x6C, 0xE7, 0x27, 0xA0, 0xAF, 0xD4, 0xA0, 0x56, 0x1D, 0x5B, 0x9B, 0xB2, 0xB9, 0xEE,
-    0xD5, 0xEF, 0xF7, 0x5F, 0x46, 0x15, 0x8C, 0x6E, 0x7D, 0x08, 0x09, 0xF3, 0xA1, 0xF6, 0xF0, 0xB5,
-    0xA7, 0x50, 0x78, 0xAB, 0x85, 0x59, 0xE5, 0xDE, 0x9D, 0xFB, 0x7A, 0x1C, 0x5F, 0x26, 0xA3, 0xC3,
-    0x10, 0xB2, 0x6D, 0xED, 0x18, 0xCB, 0xA1, 0xCE, 0x95, 0x76, 0x1D, 0x5B, 0x1D, 0x82, 0xE1, 0x1C,
-    0x9D, 0xCC, 0xA5, 0x53, 0x78, 0xED, 0x75, 0xDF, 0x5A, 0x90, 0x90, 0x8A, 0xDD, 0xDA, 0x7B, 0x33,
-    0xF1, 0x0E, 0x4C, 0x40, 0x4C, 0xBC, 0x33, 0x28, 0x98, 0xB6, 0xF6, 0xDB, 0x57, 0xEA, 0xB0, 0xA0,
-    0xCD, 0x48, 0xD1, 0x49, 0xE4, 0xE7, 0x8F, 0xE0, 0x10, 0x87, 0x12, 0xFE, 0x6B, 0xDC, 0x5F, 0x62,
-    0x33, 0x7A, 0x7A, 0x0C, 0x9F, 0x0C, 0x86, 0xF8, 0x83, 0x53, 0x06, 0x80, 0xEA, 0x00, 0x5E, 0x71,
-    0x5E, 0x27, 0x6F, 0x19, 0x94, 0x4E, 0xFD, 0x57, 0xAD, 0x09, 0xEC, 0x4D, 0xD0, 0x64, 0x8D, 0xAD,
-    0x04, 0x6B, 0x2D, 0xD3, 0x98, 0x53, 0x1E, 0x82, 0xA6, 0x43, 0x16, 0x96, 0x43, 0xF1, 0xF6, 0xBE,
-    0xA1, 0x07, 0x9F, 0x8A, 0x6B, 0x5A, 0xF9, 0x82, 0x65, 0x95, 0x5C, 0x28, 0x22, 0xD4, 0xBD, 0x47,
-    0xBD, 0xE3, 0xDA, 0x8E, 0x67, 0xFA, 0xCA, 0x8E, 0xBD, 0x31, 0x5B, 0x98, 0xFD, 0x8F, 0x0F, 0xC4,
-    0xB7, 0x06, 0xFD, 0x04, 0x25, 0x92, 0x72, 0xE4, 0x7C, 0xBF, 0x3C, 0xD3, 0x97, 0x56, 0xDB, 0x0A,
-    0xC9, 0x51, 0xE3, 0x81, 0x55, 0x06, 0x9C, 0xA2, 0x0C, 0xDE, 0x08, 0x2F, 0xB0, 0xBB, 0x18, 0x0D,
-    0x96, 0x11, 0x8C, 0x9B, 0xF0, 0x06, 0xFB, 0x1F, 0x0E, 0x08, 0x2F, 0x30, 0xDB, 0x87, 0x86, 0x1F,
-    0x66, 0xB1, 0xB9, 0x8A, 0xE1, 0x43, 0xC8, 0x61, 0x32, 0x05, 0x6F, 0xC1, 0x17, 0x80, 0xAB, 0x83,
-    0xFE, 0x7D, 0xA1, 0x7C, 0xF4, 0xD7, 0x93, 0x93, 0x88, 0x2E, 0xC2, 0x31, 0x37, 0xB8, 0x1F, 0x02,
-    0xF5, 0xF7, 0x29, 0x41, 0xD9, 0x69, 0x29, 0x36, 0x94, 0x14, 0x34, 0xD4, 0x7E, 0x4B, 0xDE, 0xB6,
-    0x92, 0x28, 0x6E, 0x2B, 0xF4, 0x63, 0x43, 0x0B, 0x03, 0xFF, 0xAF, 0x9A, 0xCE, 0x55, 0x52, 0x92,
-    0xB8, 0x50, 0x1E, 0xED, 0x90, 0x0C, 0x2E, 0xE8, 0x8A, 0x3A, 0xF2, 0x65, 0x50, 0xBC, 0x59, 0x3C,
-    0x29, 0x95, 0xD0, 0x3D, 0x8D, 0x72, 0x47, 0x16, 0x65, 0xFF, 0xA4, 0x5F, 0xF9, 0xC6, 0x2B, 0x05,
-    0x3B, 0xEC, 0xF3, 0x19, 0x4E, 0x27, 0x80, 0xD1, 0xEA, 0xBE, 0xE2, 0x90, 0x29, 0x61, 0x6F, 0x5A,
-    0xF2, 0x60, 0x00, 0x8A, 0x6C, 0x08, 0x37, 0xAA, 0x85, 0x0C, 0xF4, 0xB2, 0xD1, 0xD0, 0x86, 0x7F,
-    0xA5, 0xC6, 0xD0, 0x0B, 0x06, 0x43, 0xC2, 0x60, 0x28, 0x28, 0x37, 0x70, 0xFF, 0xE7, 0x22, 0x54,
-    0xF2, 0xB2, 0x5A, 0x20, 0xF9, 0x11, 0xEA, 0x7E, 0x54, 0xA1, 0x34, 0x27, 0x45, 0xFC, 0x39, 0x25,
-    0x2F, 0x42, 0x2C, 0x43, 0x87, 0x90, 0x6A, 0xFB, 0xCF, 0xB0, 0xE3, 0x5A, 0x12, 0x3B, 0x73, 0x0D,
-    0x41, 0xA8, 0x81, 0x57, 0x93, 0x17, 0x41, 0x12, 0x0D, 0x9E, 0x90, 0x97, 0x39, 0xCF, 0xD8, 0xFC,
-    0x4F, 0xF5, 0xD4, 0xC7, 0x97, 0xE1, 0xAB, 0x06, 0xBC, 0x29, 0x4F, 0xA1, 0xD6, 0x57, 0x00, 0x58,
-    0x42, 0x2D, 0x12, 0x25, 0x68, 0xCF, 0xC2, 0xCB, 0xCC, 0x2B, 0x68, 0x71, 0x68, 0x42, 0x00, 0x05,
-    0x08, 0x00, 0x99, 0xD4, 0x70, 0xFC, 0x33, 0x4E, 0x2E, 0xFE, 0xC2, 0x5D, 0x4C, 0xA3, 0xBC, 0x60,
-    0xC6, 0x7B, 0xC0, 0xCB, 0x80, 0xBB, 0x64, 0x26, 0x9C, 0x39, 0xE3, 0x98, 0x17, 0xC2, 0xAF, 0xE5,
-    0x1A, 0xE5, 0x2C, 0x49, 0x59, 0x2B, 0x85, 0xFD, 0xD7, 0x02, 0xDE, 0x3F, 0x66, 0xCE, 0xE2, 0x65,
-    0x17, 0x11, 0xED, 0x98, 0xC9, 0x20, 0xC3, 0x03, 0xC2, 0x8C, 0x98, 0xED, 0xF0, 0xD4, 0x79, 0x60,
-    0x44, 0x94, 0x28, 0x85, 0x43, 0x12, 0xED, 0x59, 0x70, 0x17, 0x6A, 0x0D, 0x28, 0x82, 0x99, 0x25,
-    0x66, 0xD6, 0x8B, 0x76, 0xD4, 0x94, 0x73, 0xBD, 0x11, 0x2B, 0xCB, 0x3C, 0xA1, 0xBC, 0x66, 0xAE,
-    0x42, 0xCE, 0x25, 0xC4, 0x8A, 0xFA, 0x06, 0x00, 0xCF, 0xF0, 0x8E, 0x51, 0x0B, 0x43, 0x3D, 0x42,
-    0x1F, 0x3B, 0x76, 0x3D, 0x85, 0xDB, 0x2E, 0xDC, 0xAA, 0x91, 0xA4, 0x71, 0x4A, 0x99, 0x70, 0x4B,
-    0xD2, 0xF8, 0x9F, 0x41, 0x9D, 0x58, 0x95, 0x68, 0x57, 0xC6, 0xDF, 0x50, 0xA0, 0xAE, 0xE8, 0x5A,
-    0xD6, 0xA3, 0x4E, 0x97, 0xAF, 0xE7, 0xB0, 0x33, 0xD8, 0x31, 0x04, 0x34, 0x18, 0x6D, 0x15, 0x4A,
-    0xCD, 0x33, 0xB4, 0x6A, 0xA8, 0x5B, 0x71, 0xDF, 0xD3, 0xE4, 0x1F, 0x9A, 0xD8, 0x6A, 0xA4, 0xE6,
-    0x01, 0x50, 0x04, 0xFC, 0x66, 0x2F, 0xDE, 0xCA, 0xD7, 0x8D, 0x91, 0x69, 0xA7, 0x23, 0x4A, 0xF9,
-    0x18, 0x72, 0x4D, 0x71, 0x35, 0x76, 0x44, 0xCE, 0x65, 0x97, 0xEB, 0xF0, 0xA3, 0x07, 0xE6, 0x76,
-    0x61, 0x29, 0xB6, 0x39, 0xC0, 0xF2, 0x6C, 0x05, 0xD0, 0x8C, 0xB8, 0x56, 0x61, 0xD3, 0x12, 0x90,
-    0xE3, 0x06, 0xC4, 0x35, 0x8B, 0x40, 0xDB, 0x77, 0x0E, 0xA5, 0x18, 0x48, 0xB8, 0xEA, 0x0F, 0x29,
-    0x4A, 0xC9, 0x6E, 0xC3, 0xF2, 0x9C, 0x99, 0x88, 0x9B, 0x8D, 0x03, 0x7D, 0xEA, 0xFF, 0xC4, 0xA2,
-    0x17, 0xDB, 0x02, 0x14, 0x2B, 0xD7, 0x8F, 0xA1, 0x84, 0xB0, 0x9F, 0xF0, 0x7C, 0xA4, 0x24, 0x83,
-    0x02, 0x2D, 0x61, 0xC6, 0x3D, 0x43, 0x25, 0x39, 0x30, 0xB8, 0x0B, 0xB6, 0xA0, 0xA9, 0x7C, 0x19,
-    0xCB, 0x17, 0x71, 0x47, 0x6B, 0xAC, 0x37, 0x27, 0x2C, 0x97, 0x5D, 0xD7, 0x0A, 0xB9, 0x17, 0x44,
-    0xE3, 0x63, 0x79, 0x68, 0x51, 0x51, 0x73, 0x0E, 0x08, 0xA4, 0x16, 0x10, 0xBE, 0x46, 0x1C, 0x13,
-    0x2C, 0x90, 0x29, 0x6A, 0x8E, 0xE5, 0xEE, 0xB2, 0xF6, 0xB6, 0x53, 0x74, 0x28, 0x8D, 0x7F, 0x5D,
-    0x2F, 0x82, 0xEB, 0xC4, 0x25, 0x0D, 0x13, 0xBA, 0xC1, 0xA9, 0x02, 0xE2, 0x7B, 0x48, 0x86, 0x4D,
-    0x8E, 0x95, 0x67, 0x50, 0x4A, 0xE5, 0x93, 0x54, 0x41, 0x15, 0xF9, 0x16, 0x7D, 0x82, 0x5D, 0xC3,
-    0x8C, 0xD6, 0xB0, 0x9D, 0x00, 0x59, 0x22, 0x5C, 0x1C, 0x40, 0x98, 0xE5, 0xB3, 0xE2, 0x74, 0x4F,
-    0x89, 0x3E, 0x72, 0x24, 0x1E, 0x07, 0x15, 0x36, 0x8E, 0x34, 0x0C, 0x3A, 0xCF, 0x7C, 0x67, 0xD0,
-    0xE4, 0x46, 0x9F, 0xE2, 0xB1, 0xBC, 0x74, 0xEB, 0xB1, 0x01, 0x24, 0x04, 0x5C, 0x1E, 0xBE, 0xC2,
-    0x36, 0x5D, 0x46, 0x46, 0xCA, 0x4E, 0x03, 0xFC, 0xBA, 0x24, 0x91, 0x6B, 0x9E, 0xFD, 0x9D, 0xD5,
-    0xB9, 0x3D, 0xB0, 0xEC, 0xF5, 0x57, 0xEC, 0x3B, 0xF6, 0x66, 0x0B, 0x6B, 0xA4, 0x16, 0x28, 0xF0,
-    0xF0, 0x4D, 0x02, 0x77, 0x07, 0xDC, 0xAB, 0x34, 0xD0, 0x58, 0xFE, 0x1C, 0x4A, 0xD8, 0x29, 0x4A,
-    0x39, 0x1D, 0x5C, 0xF1, 0x66, 0x62, 0x8F, 0x69, 0x32, 0x30, 0xD7, 0xA2, 0xEF, 0x00, 0x66, 0x67,
-    0xFA, 0x7D, 0x1C, 0x26, 0xEC, 0xF3, 0xBB, 0xEB, 0xE3, 0x30, 0x15, 0xE5, 0x3C, 0xE4, 0x3C, 0xE3,
-    0x7A, 0xCF, 0x74, 0x52, 0x13, 0x61, 0xDB, 0xDA, 0xA4, 0xA6, 0x63, 0x25, 0x37, 0x82, 0x32, 0xF5,
-    0x51, 0x44, 0x25, 0x26, 0x06, 0xC0, 0x79, 0x69, 0xA7, 0x25, 0xF6, 0xD9, 0x53, 0x63, 0x74, 0x14,
-    0xDF, 0x71, 0xF5, 0xF0, 0x80, 0x6B, 0xE2, 0x25, 0xF7, 0xDE, 0xDC, 0x8D, 0x82, 0x41, 0x5C, 0x4C,
-    0xDD, 0x41, 0x00, 0x73, 0x8B, 0x93, 0x39, 0xE5, 0x3A, 0xD5, 0xC9, 0x9C, 0xD9, 0x9B, 0xA3, 0x37,
-    0xCF, 0x9A, 0x41, 0x14, 0x6C, 0x3D, 0xEC, 0xE3, 0xDF, 0x23, 0xCB, 0x07, 0x86, 0x31, 0x23, 0xC0,
-    0xBF, 0x41, 0xE2, 0x52, 0x1A, 0x9C, 0xD2, 0xD2, 0x2F, 0x22, 0x02, 0x7B, 0x55, 0x1D, 0x3A, 0xB9,
-    0x49, 0x9D, 0x59, 0xDA, 0x07, 0x4D, 0x27, 0x8D, 0xB2, 0x4E, 0xBC, 0x3A, 0x28, 0x1E, 0x9F, 0x74,
-    0x58, 0x79, 0xE9, 0xEF, 0x8E, 0x80, 0x2B, 0xDD, 0xE1, 0xFD, 0x06, 0x6C, 0xE6, 0x9C, 0xD5, 0xF1,
-    0x2D, 0x13, 0x33, 0xC7, 0x44, 0x38, 0x80, 0xE9, 0xE1, 0x59, 0xFB, 0x5E, 0x1B, 0xEB, 0x69, 0x7B,
-    0x85, 0xA6, 0xC6, 0x6F, 0x27, 0x59, 0xC2, 0xD9, 0xC2, 0x49, 0xC2, 0xC9, 0x52, 0xE7, 0x05, 0x3A,
-    0xED, 0x52, 0x56, 0x91, 0x46, 0xAB, 0x99, 0xA2, 0x8D, 0xC3, 0x6C, 0x03, 0x67, 0x19, 0xB4, 0xC9,
-    0xBA, 0xC6, 0x49, 0xAF, 0xF4, 0x90, 0x84, 0x32, 0x4D, 0x6E, 0x35, 0x0E, 0xFB, 0xAE, 0xCF, 0x46,
-    0x57, 0xA2, 0x46, 0xF9, 0x4B, 0xBA, 0xD7, 0xA1, 0x8F, 0x0D, 0xCB, 0xEA, 0xB1, 0x60, 0x78, 0x3B,
-    0x74, 0x75, 0x24, 0x46, 0xE2, 0x23, 0x97, 0x97, 0xA6, 0x6D, 0x1D, 0xF3, 0x85, 0x99, 0x84, 0x2F,
-    0x9E, 0x84, 0x13, 0x61, 0x1D, 0x5A, 0x2D, 0xEF, 0x58, 0xDC, 0x34, 0x00, 0x02, 0xB4, 0xC6, 0x61,
-    0x8B, 0x62, 0xEC, 0x9D, 0xF1, 0xDE, 0x4C, 0x3F, 0x60, 0x1D, 0xAF, 0xF1, 0x1A, 0xBF, 0xCD, 0x77,
-    0x7D, 0x7B, 0x75, 0x4C, 0x4B, 0xFB, 0x9C, 0xB0, 0x16, 0x07, 0x1A, 0x99, 0xF6, 0x06, 0x34, 0x42,
-    0x67, 0xCD, 0xAF, 0xB6, 0x22, 0xD7, 0x79, 0x01, 0xA2, 0xDC, 0xE7, 0xC7, 0x38, 0x1B, 0x61, 0x63,
-    0xFC, 0xE1, 0x50, 0x70, 0x7E, 0x48, 0xE6, 0x31, 0x57, 0xA4, 0xF9, 0x9A, 0xB3, 0xE5, 0xD0, 0x96,
-    0x93, 0xDF, 0x0F, 0xBD, 0xC2, 0x5D, 0x90, 0xC6, 0xDE, 0x01, 0x44, 0x27, 0x67, 0xB7, 0xC1, 0x3C,
-    0xE0, 0x85, 0x08, 0x38, 0xC6, 0xA1, 0x12, 0x6C, 0x58, 0x45, 0xA9, 0x00, 0xBD, 0x2F, 0xBE, 0xE1,
-    0x42, 0xEC, 0x8E, 0x2E, 0xC0, 0x11, 0x0A, 0xE1, 0xF3, 0x48, 0x4E, 0x80, 0x60, 0x13, 0x7D, 0xA0,
-    0x1E, 0xD3, 0xC8, 0xE3, 0x80, 0xE5, 0x9F, 0xBB, 0xDA, 0x22, 0x01, 0x94, 0x80, 0x99, 0x97, 0x4F,
-    0x39, 0x2E, 0xC5, 0x31, 0xE0, 0x8E, 0x3B, 0x32, 0xC2, 0x61, 0x7E, 0xDB, 0x6A, 0x6A, 0x5D, 0xAA,
-    0xE0, 0x44, 0xA8, 0x42, 0x4E, 0x8B, 0xBD, 0xA3, 0x6D, 0xFC, 0x8D, 0x01, 0x2F, 0x4F, 0x87, 0xBF,
-    0xB2, 0x86, 0x0F, 0x2B, 0x41, 0x19, 0x9A, 0xA0, 0x9C, 0x78, 0x77, 0xAE, 0x1C, 0xC2, 0xA4, 0x6F,
-    0xBF, 0xC3, 0x9D, 0x61, 0xEB, 0x5C, 0x3D, 0x76, 0x2D, 0x91, 0x63, 0x18, 0xC4, 0x81, 0x4F, 0xD4,
-    0x0F, 0x7B, 0x67, 0x54, 0x07, 0x26, 0x66, 0x06, 0x51, 0x8E, 0x8F, 0x5C, 0x67, 0xC0, 0x16, 0x6A,
-    0x87, 0x6D, 0x87, 0x64, 0x83, 0x96, 0x5E, 0xE7, 0xA5, 0x44, 0xA0, 0x3B, 0xC8, 0xB2, 0x2F, 0xE1,
-    0xF6, 0x6D, 0xCC, 0x22, 0xCB, 0x3A, 0x28, 0x92, 0xE6, 0xBC, 0xB3, 0x5C, 0x52, 0xEB, 0x8D, 0x54,
-    0x1B, 0x59, 0xC7, 0x6A, 0x4B, 0xA4, 0xE2, 0x62, 0xA5, 0x10, 0xDF, 0xF9, 0x9E, 0xDB, 0xC9, 0xA7,
-    0xAD, 0xE5, 0x7E, 0x93, 0x17, 0xC3, 0x32, 0x68, 0xED, 0x18, 0xA5, 0x38, 0x2A, 0x63, 0x60, 0x12,
-    0xB6, 0x18, 0x00, 0xBC, 0xBE, 0xF7, 0xBF, 0x00, 0x10, 0x2B, 0xFB, 0x44, 0x94, 0xCE, 0x2B, 0xF5,
-    0xDD, 0xFF, 0x01, 0xEC, 0x4D, 0x84, 0x75, 0xB0, 0xC3, 0xDD, 0xCD, 0x8B, 0xF6, 0x94, 0x2D, 0xA6,
-    0x52, 0x9D, 0x4C, 0xFE, 0x37, 0x85, 0x76, 0xCB, 0x6A, 0x27, 0x2B, 0x9A, 0xFC, 0x5F, 0xA1, 0xF4,
-    0xBE, 0x39, 0x10, 0xD6, 0x62, 0x97, 0x57, 0x6B, 0x77, 0x5E, 0xE0, 0x33, 0x19, 0x37, 0xE5, 0x03,
-    0x8A, 0x57, 0x60, 0x2F, 0x6A, 0x40, 0xE9, 0x5A, 0x9D, 0x9C, 0xC4, 0xED, 0x82, 0x8F, 0x06, 0x75,
-    0xFC, 0x8F, 0xC6, 0x03, 0x24, 0x66, 0x26, 0x60, 0x1F, 0x45, 0xB5, 0x6C, 0x6D, 0xE3, 0x8F, 0x7D,
-    0xA4, 0xAA, 0x30, 0x11, 0x70, 0x39, 0xA0, 0x08, 0xE8, 0x58, 0x0D, 0x50, 0x16, 0x26, 0xB7, 0x3D,
-    0x50, 0xA3, 0x09, 0xDA, 0x5C, 0x31, 0x8F, 0x0D, 0xC8, 0x11, 0x06, 0x8E, 0x97, 0x7C, 0xD0, 0xF4,
-    0xA1, 0xF2, 0xD3, 0xEB, 0x13, 0x0A, 0x8E, 0xEC, 0x69, 0x24, 0x88, 0x6F, 0x84, 0x59, 0xA5, 0x98,
-    0x79, 0x1F, 0xF9, 0xC1, 0xB9, 0xC1, 0x5F, 0xB8, 0xCB, 0x28, 0x09, 0x8C, 0x44, 0xCD, 0xB4, 0x34,
-    0xFC, 0xFB, 0x84, 0xE6, 0xFC, 0xBB, 0x5F, 0x3E, 0x24, 0xBF, 0x79, 0x86, 0xD1, 0x71, 0xA1, 0x19,
-    0x5E, 0x6E, 0x82, 0xF6, 0x75, 0x51, 0x3D, 0x1C, 0xF2, 0x73, 0xBB, 0xA0, 0xD1, 0xD4, 0x99, 0x1A,
-    0x1D, 0xBF, 0xAA, 0x17, 0x3A, 0x74, 0x11, 0xB5, 0xA0, 0xA2, 0x1C, 0xD7, 0x16, 0x8D, 0xDE, 0xF6,
-    0xBF, 0x48, 0x17, 0xD7, 0x8E, 0x5F, 0xC4, 0xF1, 0xD3, 0x19, 0xD8, 0x61, 0x4D, 0xE1, 0x0C, 0xFB,
-    0xA9, 0x6D, 0x1E, 0xD6, 0xB2, 0x62, 0x76, 0x78, 0x16, 0x56, 0x4C, 0x8E, 0xF1, 0xA1, 0x79, 0xBC,
-    0x0E, 0x1B, 0x31, 0xFE, 0x16, 0x92, 0x1F, 0x80, 0x36, 0x06, 0x22, 0x95, 0x28, 0xD1, 0x5A, 0x74,
-    0xFA, 0x75, 0xEE, 0x98, 0x63, 0x58, 0xA3, 0x5B, 0x3E, 0xBD, 0x52, 0x20, 0x33, 0xD0, 0x0D, 0x1A,
-    0x51, 0xF0, 0x82, 0x0E, 0x45, 0x7E, 0x49, 0x3D, 0x40, 0x72, 0x00, 0x7E, 0xFD, 0x8F, 0x76, 0xC5,
-    0x42, 0x54, 0x93, 0xA3, 0x90, 0x33, 0x22, 0x40, 0xBF, 0xD8, 0xAA, 0x8D, 0xFD, 0x63, 0x24, 0x2E,
-    0x1F, 0xB9, 0x40, 0x21, 0x58, 0x1B, 0x17, 0x8B, 0x60, 0xB2, 0x6D, 0x01, 0xBF, 0xFD, 0x02, 0x65,
-    0x58, 0x86, 0xF2, 0x98, 0xA2, 0xDA, 0x64, 0x86, 0x82, 0xBF, 0x89, 0x3F, 0xA1, 0xDC, 0x68, 0xB4,
-    0xAD, 0x7E, 0x8D, 0x0E, 0x61, 0x52, 0xB9, 0xDD, 0x2B, 0xA9, 0x93, 0xCA, 0x16, 0x79, 0xBA, 0x06,
-    0x15, 0x57, 0x91, 0xBC, 0xD9, 0xC6, 0xE4, 0x68, 0xC8, 0x09, 0x08, 0x16, 0xED, 0x80, 0xF0, 0xB6,
-    0x2A, 0xD6, 0x2E, 0xA8, 0x82, 0x3A, 0xAF, 0xF2, 0xEA, 0xFF, 0x54, 0xB9, 0x9D, 0xA8, 0xCC, 0x74,
-    0xD8, 0x9D, 0x06, 0x4D, 0xD1, 0x71, 0xF4, 0x52, 0xC0, 0x5C, 0xF0, 0xB9, 0x8B, 0x7C, 0x13, 0xDB,
-    0xF1, 0x3C, 0xD5, 0xF3, 0xCC, 0xA8, 0x9A, 0x6B, 0xF2, 0x94, 0x5F, 0x67, 0x70, 0x7E, 0x8C, 0xD4,
-    0xE1, 0x64, 0xBD, 0x4D, 0xAC, 0xCB, 0xEB, 0x55, 0x31, 0xC6, 0x10, 0x38, 0x2A, 0x04, 0xF8, 0x81,
-    0x66, 0xCD, 0x5D, 0x73, 0xA2, 0x40, 0x25, 0xEE, 0x77, 0xC0, 0xC7, 0x8E, 0x74, 0x9A, 0x1A, 0x3B,
-    0x9C, 0x93, 0xFE, 0xF5, 0xB7, 0x3E, 0xFE, 0xC6, 0xA5, 0x7A, 0x6A, 0x58, 0x78, 0x1C, 0x06, 0x7E,
-    0x1B, 0xC6, 0x26, 0x2B, 0x8F, 0x13, 0xE5, 0x9A, 0xA3, 0x3C, 0xFE, 0xBD, 0x37, 0x5B, 0xCD, 0x95,
-    0x09, 0x77, 0x3F, 0xB4, 0x2F, 0x31, 0x87, 0x46, 0x6D, 0x66, 0x00, 0x14, 0x4F, 0xFD, 0x17, 0xBD,
-    0x59, 0x41, 0x6C, 0xDC, 0xC6, 0x15, 0xFD, 0x24, 0x2D, 0xB1, 0x35, 0x13, 0x8D, 0x0F, 0x76, 0xE3,
-    0x54, 0x8E, 0x98, 0x43, 0x0E, 0x2E, 0x2A, 0x89, 0x39, 0xE4, 0xA0, 0x00, 0xBB, 0x22, 0x13, 0x1D,
-    0x72, 0x08, 0x5A, 0xEB, 0xE0, 0x4D, 0x0E, 0x3E, 0x38, 0x87, 0x5C, 0xEA, 0x22, 0x95, 0x0F, 0x3A,
-    0xF8, 0x20, 0x69, 0x09, 0x1B, 0x68, 0x0E, 0x41, 0x13, 0xE5, 0xD0, 0x5E, 0x8A, 0xB4, 0x06, 0x9A,
-    0x02, 0x89, 0x0C, 0x54, 0x2E, 0xA0, 0x06, 0x0E, 0xBA, 0x12, 0xC7, 0x16, 0x0A, 0x1F, 0x7C, 0x28,
-    0x1D, 0x1F, 0x0D, 0x14, 0x4C, 0x2A, 0xC3, 0xA8, 0x0D, 0x44, 0xE3, 0x84, 0x4E, 0x29, 0x89, 0xCB,
-    0xE9, 0xFB, 0x43, 0xAD, 0x2D, 0x23, 0x8E, 0xDB, 0x18, 0x71, 0x29, 0xEF, 0xEC, 0x72, 0xC8, 0xF9,
-    0xFF, 0xCF, 0x9F, 0xFF, 0xDF, 0x7F, 0x33, 0xA6, 0xB9, 0x95, 0x59, 0xA2, 0x03, 0x23, 0x23, 0x23,
-    0xA3, 0xB8, 0x82, 0x30, 0x0C, 0xC7, 0xC7, 0x08, 0x97, 0x25, 0x89, 0xCE, 0x12, 0x0D, 0x13, 0x79,
-    0x44, 0x76, 0x4A, 0xBE, 0x4E, 0xFD, 0xE5, 0x52, 0xBC, 0xEC, 0x7B, 0x27, 0x4F, 0x4D, 0xA4, 0xA7,
-    0x49, 0x1D, 0xA4, 0x99, 0x01, 0xF2, 0x9D, 0xD8, 0x49, 0x33, 0x2A, 0x9F, 0xA3, 0xE0, 0x57, 0xB6,
-    0xA3, 0xB5, 0x0C, 0x74, 0x4C, 0x27, 0x88, 0x1E, 0x27, 0x72, 0x22, 0xA2, 0x94, 0x68, 0x9A, 0xE8,
-    0x7B, 0x2C, 0x6F, 0x0F, 0x51, 0x3B, 0x27, 0x7F, 0x51, 0x3A, 0x69, 0x93, 0x66, 0xEC, 0x54, 0xC4,
-    0x44, 0x39, 0x91, 0x80, 0x26, 0xB5, 0x8B, 0x47, 0x3E, 0x71, 0xFB, 0x30, 0x8D, 0x62, 0x18, 0xC6,
-    0x34, 0x88, 0x5C, 0xA8, 0x3F, 0x47, 0x94, 0x68, 0x7D, 0x69, 0x5D, 0x17, 0xCF, 0xD0, 0x3E, 0x96,
-    0xE1, 0xC2, 0x9E, 0x66, 0x72, 0x33, 0xAE, 0x16, 0x53, 0x2F, 0x6E, 0x90, 0x82, 0x14, 0x1A, 0xE2,
-    0x2F, 0xBE, 0xAB, 0xA6, 0xD2, 0xA6, 0xBE, 0xFA, 0xA6, 0x31, 0xB9, 0xBE, 0x7C, 0x4D, 0xC9, 0x27,
-    0x15, 0x79, 0xA9, 0x1F, 0xDB, 0x99, 0xA3, 0x48, 0xD1, 0x38, 0x64, 0x7A, 0x12, 0xE2, 0x8B, 0x11,
-    0xB2, 0xB5, 0xC8, 0xE9, 0xE7, 0x37, 0x3F, 0x20, 0x0A, 0x63, 0x72, 0x35, 0xEC, 0x3E, 0xB3, 0x39,
-    0x4F, 0x34, 0xC3, 0x03, 0xA9, 0x36, 0x60, 0x70, 0x93, 0x85, 0x64, 0x64, 0x5F, 0x7D, 0xE3, 0xA3,
-    0xAB, 0x6F, 0xFC, 0x05, 0x4F, 0x5D, 0xFE, 0xF1, 0xD1, 0xD5, 0x88, 0x5F, 0xA8, 0xE8, 0xE3, 0x65,
-    0x2F, 0x3E, 0xD1, 0xA4, 0x93, 0x05, 0x89, 0x82, 0x1A, 0x5D, 0x52, 0x89, 0x9D, 0xB6, 0x9D, 0x34,
-    0xF0, 0xB2, 0x11, 0x37, 0x1F, 0x73, 0x8A, 0xCC, 0xDA, 0x8A, 0xA9, 0x3B, 0x6D, 0x7F, 0xA1, 0xC4,
-    0x4B, 0xB7, 0x0B, 0x4F, 0x47, 0x14, 0xD1, 0x33, 0xFD, 0xA1, 0xBB, 0x7E, 0x3E, 0x8F, 0xF6, 0x92,
-    0xF5, 0x21, 0xF1, 0x04, 0xE1, 0xDA, 0xC8, 0xCE, 0x60, 0x9C, 0x95, 0x09, 0x3A, 0x66, 0xA5, 0xD3,
-    0xA2, 0xB2, 0x57, 0xA5, 0x1A, 0x73, 0x7F, 0xEA, 0x46, 0x93, 0x03, 0xCF, 0x61, 0x36, 0x63, 0x29,
-    0x16, 0xE2, 0xCB, 0x17, 0x25, 0x39, 0x6F, 0xBB, 0x31, 0x0D, 0x0C, 0x8B, 0x5F, 0xC7, 0xD3, 0x78,
-    0xCB, 0x91, 0xCA, 0x8A, 0x46, 0x30, 0x10, 0xA3, 0x37, 0x08, 0x8B, 0xD8, 0xC6, 0x1C, 0xA8, 0x6F,
-    0x12, 0x1E, 0x9D, 0xF7, 0x3E, 0x77, 0x56, 0xE5, 0xA4, 0xF2, 0x4A, 0x71, 0xD4, 0x3D, 0x25, 0x37,
-    0x2B, 0xFF, 0x6D, 0x2C, 0xE2, 0xC2, 0x9F, 0x75, 0x41, 0xCF, 0xD9, 0xB1, 0x4F, 0xB9, 0x2B, 0x67,
-    0xED, 0xDC, 0x8F, 0xC7, 0x1D, 0xE5, 0xA8, 0x20, 0xF2, 0xE4, 0x0C, 0x8D, 0x5A, 0x8A, 0x4E, 0x38,
-    0x98, 0x34, 0xED, 0x6B, 0xB5, 0xB4, 0xBE, 0xD5, 0x7A, 0x55, 0xF2, 0xE2, 0xC0, 0x57, 0x0A, 0x7D,
-    0xAD, 0xC3, 0xBA, 0xBB, 0xF0, 0x01, 0xF5, 0x21, 0x1A, 0x74, 0xEC, 0x42, 0xC2, 0xE5, 0xC9, 0xB1,
-    0x83, 0x73, 0xE9, 0xEA, 0xC4, 0xDB, 0x03, 0xCF, 0x3E, 0x9F, 0xFE, 0xC1, 0x29, 0x3C, 0xFE, 0x3A,
-    0x75, 0xE9, 0x27, 0x07, 0x0E, 0xFF, 0x40, 0x9E, 0xA5, 0x69, 0xFB, 0xDA, 0x32, 0xCF, 0x2F, 0xD4,
-    0x53, 0x9A, 0x45, 0x4E, 0xDA, 0x7A, 0xE2, 0xDA, 0xAD, 0x6C, 0x68, 0xDA, 0xF9, 0x9D, 0xF5, 0xCF,
-    0x54, 0xB5, 0x73, 0x0B, 0xBE, 0x7C, 0x86, 0x45, 0x3B, 0xB5, 0x16, 0x4B, 0xEB, 0x2F, 0xCE, 0xDC,
-    0x88, 0x7B, 0x0A, 0x8D, 0x1D, 0x98, 0x87, 0xD6, 0xD7, 0x11, 0x19, 0xD6, 0xEB, 0x8E, 0x3E, 0x75,
-    0x59, 0xA9, 0xE6, 0x5E, 0x41, 0x5E, 0xEC, 0x4A, 0x57, 0x7A, 0xF8, 0x73, 0x74, 0xB9, 0xF0, 0x21,
-    0x66, 0xAA, 0x27, 0xCE, 0xAB, 0xA8, 0x41, 0x4D, 0x6B, 0x85, 0x92, 0x0C, 0xC3, 0xF1, 0xCE, 0x85,
-    0x44, 0xB2, 0x2B, 0x20, 0x20, 0x2D, 0xCA, 0x99, 0xED, 0x78, 0x08, 0xF0, 0x24, 0xC4, 0xD2, 0x8E,
-    0xDF, 0xF7, 0x13, 0xE0, 0x19, 0x7F, 0xC2, 0x28, 0x8C, 0x93, 0x38, 0xDC, 0xFA, 0x72, 0xB3, 0xA9,
-    0x2F, 0x74, 0x1B, 0x7B, 0x69, 0xB2, 0x89, 0xB1, 0xFC, 0x19, 0xDF, 0xFE, 0x1C, 0x64, 0x61, 0x7D,
-    0x2D, 0x5E, 0x39, 0xBD, 0x15, 0x27, 0x1B, 0x69, 0x58, 0x4D, 0xFB, 0xFA, 0x3D, 0x57, 0x5F, 0x7F,
-    0x41, 0x9B, 0x1B, 0x4F, 0xBF, 0x47, 0xFA, 0x7A, 0xE4, 0x7E, 0x9C, 0xD2, 0xC0, 0x34, 0x39, 0xEF,
-    0x11, 0x5D, 0x8F, 0xE8, 0xF9, 0xBB, 0x37, 0x58, 0xD0, 0x88, 0x13, 0xC4, 0x26, 0x7A, 0x52, 0x5C,
-    0x54, 0x4B, 0x3F, 0xF2, 0xD3, 0xA2, 0x31, 0xBB, 0x8B, 0x28, 0xF2, 0x65, 0x22, 0x9D, 0x7B, 0xFE,
-    0x82, 0xE2, 0xD8, 0x07, 0xD6, 0xFB, 0x8E, 0x5E, 0x95, 0xB7, 0x33, 0xFF, 0x84, 0xF3, 0x0F, 0xFA,
-    0x52, 0x2E, 0xAD, 0x74, 0xBC, 0x02, 0x26, 0x2C, 0x9C, 0x4D, 0x8A, 0xE3, 0x4E, 0x24, 0xA2, 0x73,
-    0x94, 0x8B, 0xD8, 0x8F, 0x4B, 0x5B, 0xF9, 0x51, 0x29, 0x64, 0xE1, 0xF1, 0xBF, 0x69, 0x27, 0xA6,
-    0x7B, 0xAE, 0x14, 0x81, 0x8F, 0x10, 0xA3, 0x44, 0xB2, 0x77, 0x9F, 0x90, 0xE4, 0x45, 0xDB, 0xCE,
-    0x47, 0x3B, 0x6C, 0xDA, 0x31, 0xD3, 0x9E, 0xB5, 0x14, 0xDA, 0xD4, 0x45, 0x6B, 0x4B, 0xA1, 0x06,
-    0xD7, 0xDC, 0x68, 0x44, 0x25, 0xA5, 0xA0, 0x73, 0x08, 0x84, 0x61, 0x2B, 0x43, 0x3B, 0x86, 0xD0,
-    0x03, 0x3A, 0xB8, 0xBA, 0x82, 0x44, 0xFB, 0xCC, 0x86, 0x59, 0x2F, 0x45, 0x08, 0x4E, 0xB4, 0x82,
-    0xD7, 0x9B, 0xAC, 0x7B, 0x94, 0x03, 0x4C, 0x3C, 0xA3, 0x17, 0xDA, 0xDD, 0x88, 0xB5, 0xD7, 0x7A,
-    0x47, 0x4C, 0xDB, 0xA8, 0xF5, 0x9A, 0x36, 0x0B, 0x8C, 0xDE, 0x8D, 0x12, 0xB3, 0x7F, 0x21, 0x6B,
-    0x0C, 0xAE, 0x09, 0x4A, 0x1B, 0x49, 0xF9, 0x94, 0x41, 0x83, 0x06, 0xB0, 0x82, 0x51, 0x89, 0x73,
-    0x33, 0xE3, 0x2C, 0xB5, 0x25, 0x77, 0xBB, 0xB1, 0x0D, 0x4B, 0x04, 0xC2, 0xA5, 0x0B, 0x38, 0xE0,
-    0x6B, 0xD7, 0x0E, 0xDD, 0x7B, 0x18, 0x8D, 0x2C, 0x84, 0x21, 0xCC, 0xBB, 0xDD, 0x61, 0x1D, 0x4F,
-    0x0B, 0x06, 0x34, 0x84, 0x12, 0x87, 0xB6, 0x1F, 0xB3, 0xE6, 0x20, 0xE7, 0xD9, 0x43, 0xE4, 0x30,
-    0x94, 0x38, 0xF2, 0x71, 0x44, 0x82, 0xA5, 0x3C, 0x0A, 0xE4, 0x91, 0xDC, 0x8D, 0x46, 0x55, 0x08,
-    0xA3, 0xFC, 0x86, 0x05, 0x7D, 0x82, 0xA7, 0x97, 0x79, 0x13, 0x8C, 0x8E, 0x40, 0x2D, 0x02, 0xD8,
-    0x2D, 0xAC, 0xC4, 0x3C, 0x05, 0x3C, 0x18, 0xA2, 0x6D, 0x97, 0xC2, 0x01, 0x14, 0x6D, 0xEB, 0x0F,
-    0x22, 0x91, 0xB2, 0xD9, 0xB5, 0x1B, 0xA6, 0x91, 0x68, 0xFA, 0x82, 0xBE, 0x5C, 0x61, 0xD9, 0x46,
-    0xD8, 0x24, 0x60, 0xE2, 0x6F, 0x4E, 0x6A, 0xE5, 0xE7, 0x30, 0xD4, 0x00, 0xE5, 0x32, 0xBF, 0x58,
-    0x71, 0x93, 0xF0, 0xED, 0xFE, 0x3B, 0x3E, 0x64, 0x81, 0x21, 0xFF, 0xE8, 0xA2, 0x31, 0x21, 0xD0,
-    0x84, 0x58, 0xFB, 0x0A, 0xA6, 0x22, 0x04, 0xEC, 0x39, 0xE1, 0x33, 0x7A, 0x8E, 0xF3, 0x2C, 0x3A,
-    0x44, 0x1F, 0xBF, 0x92, 0x13, 0x0C, 0xCC, 0x28, 0x58, 0x58, 0x94, 0xAC, 0x25, 0x82, 0xD7, 0x42,
-    0x8E, 0xE0, 0x8E, 0x0D, 0x4C, 0xAC, 0xC2, 0x2E, 0xC1, 0x5D, 0x1C, 0x84, 0x44, 0x73, 0x2C, 0x10,
-    0x60, 0x4C, 0xAC, 0xD6, 0x8E, 0x1E, 0xAD, 0xC6, 0xD7, 0x58, 0x16, 0xFB, 0x63, 0x0E, 0x8D, 0x7B,
-    0x41, 0x71, 0xF6, 0xCB, 0x47, 0xA9, 0xB1, 0x8F, 0x25, 0x27, 0x87, 0x30, 0x70, 0xBD, 0x24, 0x1A,
-    0xF0, 0xD3, 0x7B, 0x22, 0xF3, 0x51, 0x68, 0x1C, 0xC1, 0xBA, 0x5A, 0x65, 0x88, 0x04, 0xCB, 0xCA,
-    0x7B, 0xF2, 0x00, 0x61, 0x41, 0x2C, 0x94, 0xDA, 0x50, 0x6B, 0xB3, 0xB7, 0x05, 0xD7, 0x9B, 0x25,
-    0xF8, 0xDE, 0x59, 0x85, 0xDA, 0x21, 0x8E, 0x6C, 0x64, 0x33, 0x22, 0x3C, 0x20, 0x1A, 0x6D, 0x21,
-    0x16, 0x34, 0x30, 0xDB, 0xBB, 0x71, 0x46, 0x01, 0x83, 0x5C, 0x8E, 0x23, 0x21, 0xF1, 0x38, 0xA0,
-    0x04, 0x31, 0xFF, 0x8E, 0x8E, 0x42, 0xD4, 0x14, 0x7A, 0x9D, 0x23, 0x97, 0x97, 0x4F, 0x41, 0x84,
-    0x73, 0x52, 0xB2, 0xE5, 0xDC, 0xC5, 0x4E, 0x36, 0x93, 0x37, 0x0D, 0x5B, 0xE2, 0xF2, 0x5B, 0x41,
-    0x86, 0xE6, 0xDF, 0x78, 0xCB, 0x3B, 0x84, 0xC1, 0x0D, 0x4C, 0xDE, 0xCA, 0x60, 0x85, 0x88, 0x30,
-    0xF9, 0x19, 0x1B, 0xE5, 0xE4, 0xDA, 0x91, 0x94, 0x04, 0x17, 0xC4, 0x95, 0x85, 0x84, 0xEB, 0xF1,
-    0x2C, 0xA7, 0x5A, 0x49, 0x05, 0xD9, 0x0A, 0x0E, 0x0A, 0x0A, 0x9D, 0x3B, 0x3A, 0x37, 0x75, 0x02,
-    0xF3, 0x09, 0xD9, 0x40, 0x14, 0xC3, 0x85, 0xC2, 0x4C, 0x06, 0x59, 0x34, 0x64, 0xDA, 0x06, 0x4F,
-    0x8C, 0x96, 0x4C, 0xAB, 0xB8, 0xB5, 0xD3, 0x39, 0xB8, 0xCC, 0x95, 0x6D, 0xA4, 0xA2, 0xE0, 0x99,
-    0xA1, 0xB4, 0xB2, 0x4D, 0xCD, 0x16, 0xFC, 0x8A, 0x34, 0x9E, 0xA1, 0xC7, 0x90, 0x8F, 0x33, 0x34,
-    0xE2, 0x64, 0x68, 0x1B, 0xDE, 0x1A, 0xD0, 0xBF, 0x0C, 0xBB, 0x1E, 0x5A, 0xEA, 0xFB, 0x23, 0x2A,
-    0x74, 0xE9, 0x6C, 0x1C, 0x95, 0x25, 0x35, 0x7C, 0xF8, 0x2A, 0xA3, 0x61, 0x14, 0x3C, 0x60, 0x0A,
-    0x2F, 0x0A, 0x7B, 0xB4, 0xAC, 0xEF, 0x20, 0xD6, 0x55, 0xA6, 0xA2, 0x5B, 0x3A, 0xEA, 0x47, 0x55,
-    0xCF, 0x3C, 0x98, 0x67, 0xC1, 0xCE, 0x9F, 0xD5, 0x51, 0x27, 0x22, 0x83, 0x21, 0x9D, 0xDA, 0x29,
-    0x31, 0x97, 0x05, 0x93, 0x6D, 0xFD, 0x10, 0x60, 0x19, 0xC8, 0x6C, 0xB5, 0x5A, 0x87, 0xA0, 0xD3,
-    0xBF, 0x71, 0x46, 0x76, 0x68, 0xD8, 0x93, 0x16, 0xBE, 0x7A, 0x9A, 0xBC, 0x1B, 0x15, 0x70, 0x3F,
-    0xEB, 0xDD, 0x99, 0xAF, 0xDD, 0xF8, 0x52, 0x1D, 0x1A, 0x0A, 0xB4, 0x5E, 0xD7, 0x1C, 0xE0, 0x4F,
-    0x63, 0x66, 0x11, 0xE7, 0x93, 0x53, 0x98, 0x22, 0xF7, 0x1D, 0xC8, 0xEC, 0x87, 0xFB, 0x4A, 0x93,
-    0x31, 0x3E, 0x0A, 0x9F, 0x1C, 0xFE, 0x0E, 0x64, 0xDA, 0xF3, 0x27, 0xA8, 0x2D, 0xA4, 0x7B, 0x27,
-    0x42, 0xFB, 0x5A, 0x28, 0xF2, 0x5A, 0x9F, 0xAF, 0x16, 0x3A, 0x1E, 0x10, 0xB8, 0x43, 0x07, 0x76,
-    0x0C, 0x5F, 0x59, 0x84, 0x23, 0x2B, 0xDA, 0xA1, 0x41, 0xD2, 0xE9, 0x0E, 0x09, 0xA8, 0xFD, 0x4C,
-    0xEB, 0x0A, 0xE3, 0xD2, 0x49, 0xAC, 0x41, 0x12, 0xF9, 0x19, 0x27, 0x38, 0xD3, 0x05, 0x3F, 0xF5,
-    0xE4, 0x37, 0xFD, 0x21, 0x86, 0xBA, 0x40, 0xBB, 0x59, 0xA7, 0x14, 0xD9, 0x93, 0xF4, 0x3F, 0xBE,
-    0x7F, 0x9A, 0xC0, 0xE7, 0x54, 0x67, 0x7C, 0xCC, 0xC6, 0xEA, 0xB6, 0x26, 0x75, 0x17, 0xD1, 0xDC,
-    0xC1, 0xFA, 0xC1, 0x5A, 0x75, 0xDF, 0x1F, 0x49, 0xA6, 0xBB, 0x07, 0xBD, 0x97, 0xB3, 0x72, 0xD6,
-    0xE4, 0x1C, 0x0F, 0x42, 0xBE, 0xB4, 0x23, 0x3C, 0x0C, 0xE8, 0x41, 0x4D, 0x92, 0xE1, 0x3D, 0xEB,
-    0xD8, 0xFB, 0x9C, 0xEA, 0x5D, 0x72, 0x6F, 0x1D, 0x29, 0x59, 0xA8, 0xE2, 0xC7, 0x31, 0xE2, 0x05,
-    0x95, 0x16, 0xA4, 0x12, 0x3F, 0x66, 0x9F, 0xB8, 0x3D, 0xE9, 0x82, 0xA1, 0x50, 0x13, 0x3D, 0x2E,
-    0xF7, 0x70, 0xFE, 0x08, 0xCE, 0xDD, 0x1C, 0x3F, 0x98, 0x51, 0xF8, 0x12, 0x01, 0x9C, 0x19, 0xC8,
-    0xD8, 0x76, 0x33, 0x57, 0xC6, 0x64, 0xE0, 0x7E, 0x68, 0xD4, 0x77, 0x18, 0x8B, 0x00, 0x92, 0x1C,
-    0x56, 0x48, 0x5D, 0x3F, 0x46, 0x9E, 0x8E, 0x50, 0x92, 0xD2, 0x92, 0x7D, 0x55, 0x82, 0xE2, 0x1E,
-    0x92, 0x5E, 0x34, 0xE2, 0xC7, 0x23, 0xB4, 0x14, 0xA0, 0x2B, 0x0D, 0xD1, 0x15, 0xCD, 0xA1, 0x8B,
-    0x96, 0xD1, 0x45, 0x25, 0xBA, 0x68, 0x13, 0x5D, 0x88, 0xFB, 0x11, 0x72, 0xBA, 0x76, 0x15, 0x39,
-    0x79, 0xA8, 0x61, 0x55, 0x5D, 0x0E, 0xF7, 0xE2, 0xCB, 0x61, 0x40, 0x08, 0xB8, 0xA3, 0x1D, 0xEF,
-    0xA8, 0x2C, 0xFD, 0x1F, 0x32, 0xAB, 0xAB, 0xC8, 0xD9, 0x18, 0x2C, 0xA9, 0x8B, 0x79, 0x06, 0x11,
-    0x85, 0x13, 0xE0, 0xA3, 0x25, 0x52, 0x4C, 0x5C, 0xE2, 0xE4, 0xE2, 0x05, 0xFF, 0x3B, 0x2F, 0x3C,
-    0xA7, 0xD9, 0x25, 0x48, 0x28, 0x51, 0x32, 0xC4, 0x29, 0x60, 0x45, 0x8E, 0x54, 0x0B, 0x51, 0x37,
-    0x7C, 0xE9, 0x56, 0x8B, 0x70, 0x0B, 0x83, 0x01, 0x53, 0xD0, 0xBA, 0xB2, 0x58, 0x8C, 0x37, 0x9A,
-    0x4C, 0x42, 0xDE, 0x2D, 0x2C, 0x8F, 0x48, 0xE1, 0x69, 0xD6, 0xC3, 0xB0, 0x06, 0x85, 0xB6, 0x02,
-    0x2F, 0xE0, 0x40, 0x79, 0x84, 0x0A, 0x79, 0x25, 0x9D, 0x12, 0x50, 0x37, 0x0E, 0xA8, 0x74, 0x5E,
-    0x52, 0x3B, 0x78, 0xC7, 0xA3, 0x51, 0x78, 0x10, 0xD4, 0xC9, 0xE3, 0x7C, 0xDD, 0x8E, 0xE7, 0xED,
-    0xEB, 0xD8, 0x3C, 0x6F, 0x23, 0x32, 0x0A, 0xDF, 0x4D, 0xA4, 0x48, 0x29, 0xB1, 0x81, 0x3C, 0x39,
-    0x50, 0xDD, 0xBF, 0x98, 0xD6, 0x7A, 0x8C, 0x42, 0xA3, 0xC7, 0x28, 0x04, 0x46, 0x8A, 0x8B, 0x08,
-    0xC7, 0x02, 0xEF, 0x04, 0x13, 0x05, 0xC2, 0x42, 0x64, 0x56, 0x49, 0xED, 0x1B, 0x9A, 0xE5, 0xC0,
-    0x65, 0x2D, 0x96, 0xEA, 0xD1, 0x81, 0x19, 0xF7, 0xFC, 0x2D, 0xE5, 0x72, 0xEC, 0xBB, 0xA5, 0x75,
-    0x4B, 0xCD, 0xB8, 0x97, 0x98, 0xB0, 0x61, 0x55, 0x17, 0xA2, 0x3D, 0x78, 0xF3, 0xD3, 0x4C, 0xAC,
-    0x4D, 0x55, 0x98, 0x9E, 0x50, 0x5E, 0x8A, 0xB8, 0x0A, 0xB1, 0xA5, 0x3A, 0x9F, 0xD3, 0x68, 0x88,
-    0xF4, 0xCB, 0xCA, 0x80, 0x46, 0xED, 0xBC, 0xB4, 0x33, 0x6F, 0x55, 0x8D, 0x52, 0xE0, 0x7D, 0x82,
-    0x4D, 0x62, 0xF0, 0x27, 0x14, 0xC4, 0x10, 0xB5, 0x33, 0xD2, 0x9C, 0x44, 0x3C, 0xC3, 0x51, 0x7D,
-    0xA6, 0xA4, 0xCC, 0x68, 0xDD, 0xC7, 0xE1, 0xD1, 0x5F, 0x33, 0x75, 0x4E, 0x11, 0x5E, 0xBB, 0xB6,
-    0xEC, 0xF5, 0x71, 0xF6, 0x46, 0x56, 0xEB, 0x28, 0x4A, 0x5E, 0x35, 0x08, 0xEE, 0x27, 0x01, 0xE4,
-    0xA3, 0xCC, 0xCB, 0xC1, 0x7E, 0xB1, 0x01, 0x42, 0x95, 0xF2, 0xE2, 0x07, 0x76, 0x61, 0x9E, 0x29,
-    0x12, 0xC0, 0x47, 0x7D, 0xB0, 0xB0, 0x5F, 0xAB, 0x50, 0x85, 0x8C, 0x67, 0xE9, 0xB0, 0x91, 0xCE,
-    0xDA, 0xFC, 0xA8, 0x86, 0x59, 0x13, 0xAD, 0x34, 0xFF, 0x7F, 0x50, 0xCB, 0x7B, 0x09, 0xA3, 0x31,
-    0xE0, 0xF2, 0xA3, 0x78, 0xAD, 0x98, 0x8D, 0x3E, 0x62, 0xB5, 0xBB, 0xB1, 0x0D, 0xA0, 0x39, 0xC4,
-    0x90, 0xC5, 0x21, 0x70, 0xE7, 0x42, 0x35, 0x6F, 0xBD, 0xAA, 0x53, 0xA1, 0x7F, 0x59, 0x60, 0xD8,
-    0x7F, 0xD7, 0x71, 0x6F, 0xD7, 0x38, 0x6F, 0xE7, 0x4B, 0xD4, 0x77, 0x84, 0xD2, 0x1C, 0x80, 0x33,
-    0x41, 0x24, 0x6B, 0x66, 0x38, 0xFB, 0x7A, 0x0C, 0x84, 0x2B, 0x07, 0xCA, 0x83, 0x41, 0xA0, 0xBE,
-    0x3B, 0xCE, 0xDD, 0xF7, 0x8A, 0x2E, 0xFC, 0x0A, 0xFD, 0xCB, 0x18, 0xDD, 0x44, 0x6C, 0xF8, 0x1C,
-    0x90, 0x11, 0xCD, 0x82, 0x9E, 0x8B, 0x55, 0x0C, 0xF9, 0x8A, 0x87, 0x30, 0xB1, 0x61, 0x2C, 0xE9,
-    0x6C, 0x87, 0x07, 0xCB, 0xB2, 0x55, 0xDD, 0x61, 0x25, 0x6B, 0xA8, 0xF6, 0x15, 0x8A, 0x08, 0x58,
-    0x8B, 0x84, 0xB3, 0xEA, 0x02, 0xA5, 0xD7, 0x50, 0xB5, 0x94, 0x27, 0x7D, 0x94, 0x32, 0x54, 0x34,
-    0x37, 0xED, 0x50, 0x13, 0x5F, 0xB8, 0xC3, 0xF6, 0xA8, 0xCD, 0x91, 0xEE, 0xFD, 0x2B, 0xE2, 0x37,
-    0xFD, 0x35, 0x33, 0xCE, 0xF8, 0xC6, 0x07, 0x9F, 0x9A, 0x3B, 0x9A, 0x52, 0xEE, 0x64, 0x36, 0xF0,
-    0x1E, 0x2D, 0xA6, 0xE8, 0x4A, 0x27, 0x85, 0x55, 0x29, 0x76, 0x06, 0xE9, 0x12, 0x3E, 0xD8, 0x44,
-    0xA4, 0x6D, 0x7C, 0x82, 0xD4, 0x49, 0xBD, 0xDC, 0x49, 0xAD, 0x12, 0x6E, 0x98, 0x71, 0x2E, 0x53,
-    0xC3, 0xB9, 0x12, 0xCF, 0x78, 0x57, 0xAE, 0xE5, 0xE1, 0x27, 0xD8, 0xD6, 0x03, 0x73, 0x2D, 0xB3,
-    0x21, 0x60, 0x72, 0x82, 0x6D, 0x06, 0x16, 0x82, 0x76, 0xF7, 0x9C, 0xDD, 0x0F, 0xF5, 0x37, 0x0A,
-    0x07, 0x49, 0xA3, 0xC0, 0xF9, 0x6A, 0x4A, 0x32, 0x85, 0xFA, 0x86, 0x62, 0x6E, 0xA9, 0x80, 0x66,
-    0x3C, 0x19, 0x5A, 0x55, 0x52, 0x05, 0x45, 0x62, 0x48, 0xA3, 0xD9, 0xCB, 0x22, 0x65, 0x8D, 0xAC,
-    0x99, 0x1D, 0x67, 0x1C, 0xDF, 0x52, 0xCE, 0x39, 0x83, 0xFD, 0xE3, 0xC8, 0x52, 0x9F, 0x86, 0xEC,
-    0x5E, 0xED, 0x19, 0xAC, 0x28, 0x38, 0x93, 0x89, 0x08, 0x9B, 0x2E, 0xDF, 0x9C, 0x7C, 0xD8, 0xCA,
-    0x4A, 0x90, 0xA0, 0x8B, 0x36, 0x84, 0x1A, 0x39, 0xA5, 0xBB, 0xA9, 0x8B, 0xE4, 0xB3, 0xD2, 0xAA,
-    0x31, 0xDC, 0xC9, 0x9F, 0xB5, 0xF4, 0x32, 0x1D, 0xD7, 0xB4, 0xAB, 0x9F, 0x1E, 0x4A, 0xC8, 0xF7,
-    0xAD, 0x58, 0x9C, 0x2F, 0x6C, 0x35, 0x47, 0x7B, 0xFA, 0x7A, 0x12, 0xA6, 0x0A, 0xAC, 0x58, 0xDC,
-    0xC4, 0xF2, 0xF3, 0x14, 0x7D, 0x5E, 0xE5, 0x7E, 0xAD, 0xBC, 0x4D, 0xAC, 0x9E, 0x6F, 0x84, 0x38,
-    0xCA, 0xBF, 0xA9, 0x3F, 0xD3, 0x6F, 0x29, 0x1E, 0x02, 0xD6, 0x8B, 0x55, 0x9B, 0x5E, 0xA2, 0xE1,
-    0xA7, 0xC8, 0x7B, 0x29, 0xE2, 0x9B, 0xDD, 0xD1, 0xC3, 0xB9, 0x96, 0x06, 0xBB, 0x5E, 0xD7, 0xDE,
-    0x5C, 0xDE, 0xEC, 0x8A, 0x48, 0x47, 0x65, 0xC3, 0x2A, 0x2C, 0xAE, 0xE7, 0xA8, 0x9D, 0x53, 0x5A,
-    0x83, 0x86, 0xDE, 0x38, 0x1C, 0xBC, 0x8B, 0x70, 0x66, 0x71, 0x77, 0xE8, 0xF7, 0xAE, 0xF6, 0x62,
-    0xA2, 0x55, 0x92, 0x07, 0x3A, 0xDA, 0x4B, 0x7D, 0x46, 0xB1, 0xAB, 0xA3, 0x95, 0xE4, 0x65, 0x39,
-    0xDE, 0xA0, 0x8F, 0xC0, 0x02, 0x62, 0x4E, 0x09, 0x46, 0x57, 0x70, 0x05, 0x42, 0x99, 0x0F, 0xC0,
-    0xD5, 0xB4, 0x04, 0x15, 0xFD, 0x61, 0x44, 0x09, 0x1F, 0x29, 0x58, 0x9C, 0x9F, 0xF5, 0x56, 0x79,
-    0xC8, 0x30, 0xD7, 0xAE, 0x09, 0xDC, 0xE3, 0xB5, 0x49, 0xB6, 0x8E, 0xC3, 0xC5, 0xD5, 0x4C, 0xFC,
-    0x9E, 0x82, 0x73, 0xD4, 0xD6, 0x7C, 0x2D, 0x93, 0xE1, 0xE0, 0xCC, 0x70, 0x51, 0x5C, 0x3C, 0x40,
-    0x7E, 0x8D, 0x5D, 0x82, 0xC7, 0xC1, 0xD8, 0xA6, 0x39, 0x70, 0xFB, 0x36, 0x83, 0x9B, 0x28, 0x60,
-    0xE4, 0x77, 0x48, 0xE5, 0x22, 0xAA, 0xB7, 0xA8, 0xE0, 0x3E, 0xE2, 0xA6, 0x2A, 0x9C, 0xEB, 0xD2,
-    0xFB, 0x1C, 0xD9, 0xC0, 0xD7, 0x7A, 0x64, 0xF6, 0x37, 0x28, 0x5E, 0x90, 0xAB, 0x4F, 0x02, 0x46,
-    0xF6, 0x01, 0x93, 0xE7, 0x01, 0x20, 0x80, 0x0F, 0x54, 0x82, 0x7A, 0x97, 0x5B, 0x38, 0x9B, 0xE5,
-    0x38, 0x6D, 0x28, 0x7B, 0x2B, 0x76, 0xCD, 0xB0, 0xAD, 0x94, 0x8C, 0xAB, 0xA8, 0x6D, 0xCA, 0x53,
-    0x52, 0xC1, 0x4B, 0x7B, 0xB0, 0x51, 0x9E, 0x23, 0x3E, 0x70, 0xAA, 0x2D, 0x1D, 0xCC, 0xDA, 0x99,
-    0xF3, 0xB5, 0x3F, 0x6F, 0xA3, 0xCD, 0xC0, 0xD1, 0x80, 0x4F, 0x0A, 0xDC, 0x47, 0x0F, 0x7E, 0x93,
-    0x73, 0xD0, 0xEF, 0x34, 0x47, 0x97, 0xC4, 0x83, 0xDF, 0xDB, 0x6F, 0x4F, 0xA8, 0x12, 0xB5, 0x69,
-    0xDB, 0xE2, 0xFE, 0xC2, 0x42, 0xD5, 0x29, 0xD8, 0xC6, 0xAF, 0x35, 0xC1, 0x9A, 0x5F, 0x9F, 0x1F,
-    0xBD, 0x76, 0x80, 0x82, 0x5F, 0x98, 0xAD, 0x21, 0xCA, 0x51, 0x8E, 0x2D, 0xBA, 0x39, 0xAE, 0xB4,
-    0xF4, 0x2C, 0x08, 0xDD, 0x85, 0xDC, 0x55, 0x39, 0x2D, 0x83, 0x04, 0xAF, 0x80, 0xCB, 0xC5, 0xF4,
-    0xD7, 0x8C, 0x46, 0x4B, 0x12, 0x53, 0x11, 0x76, 0x72, 0x4E, 0x96, 0xFC, 0x56, 0xB9, 0xF0, 0xF1,
-    0xBE, 0x6D, 0xCE, 0xE3, 0xA5, 0xD8, 0xFA, 0x54, 0x4B, 0x64, 0x5D, 0x41, 0xFE, 0xEE, 0xD9, 0x7F,
-    0x17, 0x74, 0xA7, 0xBC, 0x8A, 0xDA, 0xEB, 0x3A, 0xB5, 0x2A, 0xB8, 0x97, 0x8F, 0xA1, 0x44, 0x0C,
-    0xB8, 0xC9, 0x10, 0x1B, 0x05, 0x92, 0x80, 0xCF, 0xA6, 0xEE, 0xE9, 0x48, 0xE2, 0xF0, 0xB4, 0xCE,
-    0xC3, 0x92, 0x4F, 0x17, 0x94, 0xD9, 0xB8, 0xBA, 0x99, 0xD9, 0xBF, 0xF7, 0xA8, 0x0E, 0x90, 0x30,
-    0x73, 0x2A, 0xFD, 0xA2, 0x72, 0x6F, 0xA9, 0x9E, 0x71, 0x98, 0x0B, 0x4C, 0x19, 0x87, 0x71, 0x8B,
-    0xF7, 0x35, 0x6E, 0xDA, 0x1C, 0x6C, 0x85, 0x75, 0xCA, 0xD1, 0xC3, 0xC9, 0x19, 0x35, 0xD8, 0x2E,
-    0x96, 0xC9, 0x7B, 0x13, 0x18, 0xBB, 0xB4, 0x2D, 0xC4, 0xD5, 0xB1, 0xD8, 0xEA, 0x22, 0x7D, 0x2F,
-    0x4A, 0xFB, 0x2B, 0x45, 0xE3, 0x5C, 0x8A, 0x8C, 0x9C, 0x2D, 0xDC, 0x2C, 0xF3, 0x06, 0x5B, 0x9C,
-    0xAC, 0xA6, 0x24, 0x7B, 0xBB, 0x55, 0x8F, 0xE8, 0x3E, 0x06, 0x77, 0x44, 0x07, 0x42, 0x69, 0x59,
-    0xF1, 0x43, 0x09, 0xB1, 0xA3, 0xD7, 0xEC, 0x7C, 0x8E, 0x3A, 0x7E, 0xBC, 0xCB, 0xEA, 0x11, 0x4E,
-    0xBF, 0xA2, 0x70, 0x3D, 0x0F, 0xA8, 0xED, 0x93, 0x77, 0x55, 0xD2, 0x16, 0xB8, 0x52, 0x2D, 0x64,
-    0x5D, 0xD2, 0x66, 0xCE, 0x5B, 0xE0, 0x71, 0x6F, 0x23, 0x21, 0x44, 0x9D, 0x65, 0x32, 0xCA, 0x32,
-    0x39, 0x3B, 0x54, 0xEF, 0xB2, 0x5E, 0xD5, 0xFA, 0x6F, 0x2D, 0x63, 0x5D, 0x66, 0x32, 0xF9, 0xAE,
-    0x83, 0x3E, 0x95, 0xE1, 0x62, 0x05, 0x54, 0x50, 0x3E, 0x6A, 0x5A, 0xC7, 0x5E, 0x3F, 0x95, 0x8D,
-    0x86, 0xE2, 0x64, 0xD6, 0x19, 0x1F, 0xB5, 0xB3, 0x2A, 0x83, 0x51, 0x28, 0x08, 0xCA, 0xCE, 0x02,
-    0x88, 0xBE, 0x0E, 0x37, 0x19, 0xD9, 0x1C, 0x7C, 0x23, 0xBD, 0x53, 0x80, 0xB2, 0xF7, 0xE3, 0xF8,
-    0xDD, 0x80, 0x08, 0xE4, 0x8F, 0xB3, 0x40, 0x09, 0xDE, 0xDA, 0x34, 0x39, 0x1C, 0x90, 0x2B, 0x4E,
-    0x8A, 0xBC, 0xBD, 0x4F, 0xC7, 0x2C, 0x73, 0xAF, 0x2D, 0xD4, 0x39, 0x60, 0xE2, 0x36, 0x04, 0x6D,
-    0xC3, 0x81, 0x91, 0x0A, 0x63, 0xCD, 0x69, 0xBA, 0x25, 0xBF, 0x23, 0xE9, 0x7C, 0x38, 0x01, 0xBC,
-    0x20, 0x1B, 0xD1, 0x6E, 0xF1, 0x59, 0x83, 0x1A, 0xB8, 0x2B, 0x39, 0xA1, 0xC5, 0x38, 0x91, 0xE1,
-    0x37, 0x08, 0xDB, 0xD9, 0x61, 0xE5, 0x28, 0xE5, 0xE1, 0xBA, 0x9E, 0x77, 0xF4, 0x5B, 0x65, 0x4D,
-    0x0F, 0x26, 0xF7, 0xD7, 0x84, 0xC4, 0x67, 0x8E, 0xDC, 0x83, 0x14, 0xC3, 0x8D, 0xEC, 0x15, 0x5B,
-    0x93, 0x7E, 0x80, 0x99, 0xBD, 0x0E, 0x37, 0x05, 0xF7, 0xD5, 0x49, 0x15, 0x89, 0x0A, 0x6C, 0xE1,
-    0x70, 0x4F, 0x40, 0x5A, 0xD3, 0xBA, 0xD2, 0x1C, 0xF7, 0x99, 0x33, 0xBE, 0xFA, 0x6A, 0x17, 0xD8,
-    0x53, 0xCE, 0x4F, 0xA5, 0x05, 0xEF, 0xDD, 0x2C, 0xB0, 0x1D, 0x16, 0xD9, 0x20, 0xDF, 0x46, 0x80,
-    0xC3, 0x81, 0x33, 0x27, 0xCC, 0x11, 0x09, 0x1F, 0xD1, 0x30, 0xEF, 0x60, 0xBA, 0xD1, 0xAC, 0x19,
-    0x07, 0x98, 0xFC, 0x11, 0x00, 0x29, 0x9F, 0x27, 0xAE, 0xB1, 0x20, 0x08, 0x4F, 0x22, 0xEA, 0xE7,
-    0xD3, 0xA3, 0xBC, 0xF6, 0x37, 0xC8, 0x8B, 0x39, 0x30, 0xBE, 0xAD, 0xA5, 0xB3, 0xAE, 0xA5, 0xC8,
-    0x02, 0xD9, 0x44, 0x76, 0xC1, 0xA3, 0x78, 0x0A, 0xA0, 0xE5, 0xFF, 0x00, 0x11, 0x51, 0x0E, 0xC6,
-    0x80, 0x19, 0x88, 0x28, 0x88, 0xC2, 0x9B, 0x39, 0xF1, 0x66, 0x61, 0xC7, 0x58, 0x88, 0x0A, 0x10,
-    0x8D, 0x0B, 0xEF, 0x33, 0x11, 0xDD, 0x4B, 0xE2, 0x02, 0x3C, 0x86, 0xF5, 0xBC, 0x5B, 0x2B, 0x5D,
-    0x00, 0xF1, 0x3B, 0x1B, 0xFD, 0x5D, 0x11, 0x83, 0x87, 0x20, 0x28, 0x9B, 0xEC, 0x0A, 0x47, 0x5A,
-    0x20, 0xDB, 0x4E, 0x06, 0x94, 0xBF, 0x18, 0x9B, 0xA3, 0x25, 0x3E, 0xEB, 0x09, 0x23, 0x53, 0x57,
-    0x58, 0x3C, 0xD0, 0x18, 0xBB, 0x83, 0x3E, 0x80, 0x19, 0x13, 0xCE, 0x39, 0x3C, 0xF8, 0x0F, 0xBD,
-    0x5A, 0x3F, 0x6C, 0xDC, 0x56, 0x9A, 0xFF, 0xC8, 0xB7, 0x12, 0x37, 0xE6, 0x9D, 0xE8, 0x22, 0xBA,
-    0xBD, 0x8D, 0x2E, 0xE6, 0x15, 0x5B, 0x18, 0x88, 0x2C, 0xA6, 0x48, 0x61, 0x2C, 0x66, 0x86, 0x8C,
-    0x0D, 0xDC, 0x1D, 0x70, 0x45, 0x54, 0x68, 0x72, 0xC0, 0xA6, 0xF0, 0x15, 0x5B, 0x6C, 0xF6, 0xB0,
-    0xAB, 0x14, 0x29, 0x5C, 0x8C, 0x44, 0x26, 0x06, 0x36, 0x45, 0x8A, 0x28, 0xC5, 0x55, 0x29, 0xD6,
-    0xC0, 0x66, 0x81, 0x8D, 0x8D, 0x85, 0x52, 0xB8, 0x50, 0x80, 0x91, 0xF8, 0x6C, 0xE1, 0xE0, 0x22,
-    0x45, 0xE8, 0x18, 0x57, 0xB9, 0x30, 0x93, 0x38, 0x71, 0xE0, 0x00, 0x27, 0x06, 0xC7, 0x24, 0xD4,
-    0x88, 0xC3, 0x77, 0xBF, 0xEF, 0x91, 0x23, 0x8D, 0xFF, 0xC8, 0x91, 0x63, 0xE5, 0x46, 0x9A, 0x19,
-    0xCE, 0x23, 0xF9, 0xDE, 0xF7, 0xBE, 0xF7, 0x7D, 0xBF, 0xEF, 0xF7, 0x7D, 0x8F, 0x34, 0xD1, 0x25,
-    0x22, 0xA5, 0x88, 0x84, 0x2A, 0x68, 0xFC, 0x35, 0x8F, 0xB7, 0x23, 0xF1, 0x11, 0x06, 0x44, 0x66,
-    0xC5, 0xBF, 0x7A, 0xF8, 0xB8, 0x94, 0xE3, 0xD2, 0xCD, 0x8C, 0xE8, 0x98, 0x85, 0x93, 0xB9, 0x13,
-    0x91, 0x25, 0x3D, 0xA2, 0xB9, 0xEE, 0x3A, 0x77, 0x53, 0x90, 0x7D, 0xE7, 0x62, 0x46, 0x6D, 0xB2,
-    0x12, 0x23, 0xC3, 0xED, 0x38, 0xED, 0x51, 0x1C, 0x99, 0xEA, 0x2D, 0x15, 0xF8, 0x2A, 0x70, 0x54,
-    0x62, 0xAB, 0x6C, 0x6F, 0x0C, 0x23, 0x4E, 0xCD, 0xC1, 0x06, 0x7A, 0x91, 0x2D, 0x5C, 0x4E, 0xE8,
-    0xDF, 0xA3, 0x19, 0x25, 0xBD, 0x3B, 0x99, 0x47, 0x3D, 0x5B, 0xBA, 0x66, 0xE6, 0xC8, 0x70, 0x55,
-    0xBD, 0x59, 0x79, 0xF2, 0xC9, 0xD1, 0x3D, 0x99, 0x05, 0x01, 0xB6, 0xD7, 0x58, 0xE0, 0x08, 0x3D,
-    0xCC, 0xEF, 0xF6, 0x05, 0x31, 0xC9, 0xE7, 0x83, 0x21, 0x3E, 0x6C, 0x9E, 0x4C, 0x1B, 0x7D, 0x9A,
-    0xD7, 0x13, 0x48, 0xCE, 0x13, 0x39, 0xEB, 0xE2, 0x9E, 0xA4, 0x43, 0xE4, 0x52, 0x9F, 0xE8, 0x83,
-    0x17, 0x73, 0xF4, 0xA0, 0x52, 0xF2, 0x2E, 0xAC, 0x4A, 0xCA, 0xC9, 0x0D, 0x30, 0x1F, 0x9F, 0x70,
-    0xBA, 0x8F, 0xC9, 0xDA, 0x95, 0x3F, 0x24, 0xC5, 0x1D, 0x59, 0xF4, 0xAC, 0x91, 0xCF, 0x92, 0x5F,
-    0x91, 0xF1, 0xC1, 0x68, 0xA8, 0x99, 0x8A, 0xBC, 0x8B, 0xA9, 0x13, 0x94, 0x42, 0xA2, 0x4F, 0xDC,
-    0x67, 0x66, 0x46, 0x5C, 0x9A, 0xD5, 0xAA, 0x99, 0x59, 0xB2, 0x6F, 0x40, 0xF8, 0xD2, 0x1A, 0xA8,
-    0x22, 0xFE, 0xB4, 0xD4, 0x42, 0x11, 0xCB, 0x2E, 0x78, 0xDA, 0x2E, 0x64, 0x81, 0x3A, 0xF0, 0xEB,
-    0x26, 0x0E, 0x4E, 0xB4, 0x79, 0x3A, 0x25, 0x7A, 0x78, 0x0D, 0x27, 0xDB, 0x22, 0x25, 0x23, 0xB3,
-    0x25, 0xD9, 0xFF, 0xB9, 0x18, 0x90, 0xAF, 0x2A, 0x32, 0x07, 0x17, 0x4A, 0x72, 0x02, 0x23, 0x87,
-    0x62, 0x44, 0x86, 0xD3, 0xB6, 0xF4, 0x52, 0x8A, 0x3F, 0x53, 0x09, 0xF4, 0x88, 0x99, 0xA5, 0xB8,
-    0x7D, 0x8E, 0xFB, 0xCF, 0xB9, 0xFF, 0x01, 0x0B, 0x5B, 0xFE, 0x10, 0xCD, 0x5A, 0x11, 0x09, 0x49,
-    0x7C, 0xD9, 0xF2, 0x3C, 0xD9, 0xB9, 0xBE, 0x7F, 0x42, 0x4B, 0x6C, 0x60, 0xD9, 0xE3, 0x80, 0x9E,
-    0xA8, 0xFB, 0x9C, 0xF8, 0x33, 0x59, 0xAA, 0x14, 0xDB, 0x67, 0x64, 0x49, 0x2D, 0x17, 0x56, 0x90,
-    0xD2, 0xEC, 0x12, 0x54, 0x0D, 0xDD, 0xF6, 0x6B, 0x5B, 0x29, 0xEB, 0x5F, 0x30, 0x05, 0x0B, 0xBD,
-    0xF9, 0x11, 0x19, 0x2A, 0x98, 0xB4, 0xA0, 0x65, 0x1B, 0x96, 0xD1, 0x2C, 0x95, 0xC3, 0xE7, 0x31,
-    0x19, 0x68, 0x3A, 0x69, 0x64, 0x55, 0x89, 0xB7, 0xFA, 0x71, 0xE6, 0xBC, 0x45, 0x27, 0xFA, 0x7C,
-    0x06, 0x46, 0xD3, 0xE1, 0xBE, 0xCC, 0x9C, 0xAC, 0x9C, 0x6C, 0xA5, 0x2C, 0xD8, 0xCC, 0x02, 0xAE,
-    0x5B, 0xD1, 0xC6, 0xE8, 0xE0, 0xF6, 0x6B, 0x19, 0x5D, 0x12, 0xC1, 0x21, 0x09, 0xD5, 0x26, 0xB3,
-    0x24, 0xB7, 0x4F, 0xD9, 0x9A, 0x1D, 0x34, 0xC6, 0x19, 0xE6, 0xF6, 0x57, 0x79, 0x5F, 0x7C, 0x26,
-    0xED, 0x45, 0xA2, 0xA2, 0x11, 0xCA, 0xE7, 0x4E, 0x60, 0x5D, 0xA6, 0x52, 0x97, 0x55, 0x49, 0xD3,
-    0xB8, 0x2E, 0xD0, 0x26, 0xC7, 0xFD, 0x76, 0x76, 0x8D, 0xFA, 0x10, 0x24, 0x6A, 0x91, 0x09, 0x4F,
-    0x4A, 0x78, 0x15, 0xF4, 0xCB, 0x1D, 0x9A, 0x83, 0xA1, 0x47, 0x45, 0x66, 0xDE, 0x90, 0x3C, 0x52,
-    0x2D, 0x91, 0x24, 0x2F, 0x60, 0x85, 0xC4, 0x2A, 0x0B, 0x15, 0x4D, 0x04, 0xB4, 0x62, 0x05, 0xCE,
-    0xF3, 0x19, 0x2D, 0xF7, 0xD0, 0x21, 0xDB, 0xFA, 0xE1, 0xAD, 0xDA, 0x49, 0x21, 0xD7, 0x5A, 0xF4,
-    0x6D, 0x42, 0x95, 0xB6, 0x93, 0x47, 0x58, 0x35, 0x33, 0x38, 0x06, 0x79, 0x5D, 0x2C, 0xDB, 0x1F,
-    0xA1, 0x2C, 0x85, 0xB7, 0x13, 0xD4, 0x1D, 0xFC, 0xEA, 0x3D, 0x76, 0xC0, 0x21, 0xB9, 0xFF, 0xB5,
-    0x98, 0x99, 0x19, 0xC5, 0x10, 0xC7, 0x4E, 0x01, 0x25, 0x25, 0x84, 0xF1, 0x4E, 0x65, 0x80, 0x90,
-    0x3E, 0x19, 0x05, 0x1A, 0xDA, 0x68, 0x70, 0xB9, 0x41, 0x62, 0x20, 0xD8, 0x2F, 0xE5, 0x68, 0x28,
-    0xE1, 0x73, 0x25, 0x56, 0xA2, 0xD0, 0x4E, 0x3C, 0xF6, 0x8A, 0xAF, 0xE0, 0xF6, 0x0C, 0x56, 0xDC,
-    0x6F, 0xC1, 0xE8, 0xA7, 0x30, 0xB7, 0xCD, 0x00, 0x0E, 0x1A, 0x41, 0x09, 0xE4, 0xEC, 0x28, 0x4C,
-    0xD5, 0x91, 0x22, 0x31, 0x79, 0xC8, 0x3E, 0x14, 0xE9, 0x41, 0x6A, 0x34, 0x45, 0x66, 0x26, 0xB8,
-    0xA1, 0x8F, 0x06, 0x57, 0xBA, 0xD2, 0xAC, 0xE2, 0x01, 0x79, 0x43, 0x3F, 0xA1, 0xF9, 0x9F, 0x60,
-    0xAE, 0xBF, 0x7D, 0xB7, 0x96, 0xD5, 0xFA, 0xFA, 0xA5, 0x12, 0x57, 0xD8, 0x7C, 0xB7, 0x17, 0xB1,
-    0xB0, 0x38, 0xB0, 0x13, 0x1C, 0x2C, 0xFD, 0xEC, 0x9B, 0x79, 0xEB, 0x36, 0x80, 0xB4, 0x6D, 0xB2,
-    0xE8, 0x68, 0xE9, 0x99, 0x8C, 0x80, 0x2C, 0x2E, 0x0E, 0x7C, 0xDD, 0x2F, 0xB4, 0x92, 0xDE, 0x23,
-    0xAF, 0x0D, 0xED, 0x3F, 0x93, 0xE9, 0x15, 0x38, 0x12, 0x9F, 0x27, 0x0F, 0xA0, 0x86, 0xCB, 0x9F,
-    0x5A, 0x95, 0x58, 0x00, 0x5A, 0xFE, 0xA7, 0x52, 0xA4, 0x26, 0xA6, 0x6C, 0x4B, 0x48, 0x0A, 0x25,
-    0xF7, 0x59, 0x50, 0x1F, 0x3F, 0x21, 0xA7, 0x51, 0x1A, 0xA5, 0x80, 0x98, 0xA6, 0xBA, 0x3E, 0xD4,
-    0x52, 0x76, 0xE7, 0x01, 0x1B, 0x52, 0xA8, 0x7C, 0x64, 0x88, 0xDD, 0xEE, 0x82, 0x82, 0xAD, 0x56,
-    0x17, 0xFA, 0xB6, 0x34, 0x71, 0xCB, 0x3F, 0x34, 0x8B, 0xCE, 0x5F, 0x1B, 0xAB, 0x58, 0xDE, 0x6A,
-    0xF4, 0xAB, 0xFE, 0x3A, 0xDF, 0x27, 0xC7, 0x96, 0xC6, 0xA7, 0x4A, 0x55, 0xB8, 0x0F, 0x50, 0x9D,
-    0xFA, 0x8C, 0xB1, 0x8D, 0xA0, 0x15, 0x55, 0xB1, 0x13, 0x75, 0x7A, 0xB4, 0x91, 0x1A, 0x8A, 0x5F,
-    0x55, 0x4E, 0x1A, 0x94, 0x30, 0x31, 0xC8, 0x5D, 0x40, 0xF4, 0xC6, 0xC5, 0x5B, 0x86, 0x64, 0x84,
-    0x76, 0x80, 0x1E, 0xD3, 0xBA, 0xA1, 0xDB, 0xED, 0xBE, 0xA0, 0x54, 0xE9, 0xDE, 0xB9, 0x08, 0x29,
-    0x66, 0x31, 0x84, 0x1C, 0x1B, 0xF7, 0x4E, 0x05, 0x0B, 0x4E, 0xC7, 0x44, 0xEB, 0xD3, 0x11, 0x7C,
-    0x65, 0x7D, 0x3A, 0xE6, 0x29, 0xB5, 0xA5, 0x34, 0x0C, 0x9F, 0x34, 0xA2, 0xE2, 0x98, 0x01, 0x8B,
-    0x1A, 0x81, 0x70, 0x9C, 0x3A, 0x5F, 0x65, 0x85, 0xB8, 0x2D, 0xED, 0xFF, 0x21, 0x57, 0x8B, 0xB3,
-    0x15, 0x68, 0xF4, 0x26, 0xA3, 0x64, 0x0F, 0x7D, 0x1D, 0xB6, 0x5B, 0x0F, 0x0E, 0x83, 0xD4, 0x46,
-    0x3D, 0x52, 0xCB, 0x63, 0x4B, 0x73, 0xAF, 0x77, 0x7A, 0x85, 0x18, 0x94, 0x1D, 0xDA, 0xCE, 0xCC,
-    0x1D, 0x58, 0x19, 0xBF, 0x76, 0x12, 0xD2, 0x91, 0x8F, 0x42, 0xE2, 0xDE, 0xE2, 0x0A, 0xDE, 0xF9,
-    0xD8, 0x3A, 0x68, 0x6B, 0xEC, 0x64, 0xF7, 0x73, 0xBF, 0xAC, 0xA3, 0xC8, 0x01, 0x97, 0x45, 0x1A,
-    0x6B, 0x0C, 0xF0, 0xAE, 0xC6, 0x77, 0xC0, 0x39, 0x4D, 0xD2, 0x2C, 0xF5, 0x60, 0x49, 0xDF, 0xA5,
-    0xDA, 0xFC, 0xDC, 0xC3, 0x5A, 0x23, 0x4B, 0xE6, 0x2D, 0xFA, 0x2E, 0x31, 0xF6, 0x40, 0xC2, 0x54,
-    0x91, 0xBF, 0xBA, 0x99, 0x3A, 0x7F, 0x24, 0x6F, 0x8D, 0x42, 0x2D, 0xDE, 0x3A, 0xC3, 0x17, 0xFB,
-    0x08, 0x1C, 0x47, 0x55, 0xB0, 0x31, 0x86, 0x76, 0x3A, 0x4F, 0x0C, 0xC2, 0x68, 0x81, 0x38, 0xE8,
-    0xB8, 0x65, 0xCA, 0x1A, 0x64, 0xDE, 0x03, 0xC2, 0xA9, 0xC2, 0xAC, 0x5E, 0x2C, 0xA0, 0xF0, 0x35,
-    0xC0, 0xC8, 0x59, 0xAC, 0xF1, 0xB3, 0xC0, 0x2F, 0x16, 0x44, 0xBF, 0x4B, 0xFD, 0xF6, 0x55, 0x9F,
-    0x9E, 0x1A, 0xA2, 0xEF, 0x1E, 0x54, 0xDE, 0xC3, 0x72, 0xF7, 0xDC, 0x94, 0x7A, 0x58, 0x8D, 0x12,
-    0x82, 0xE7, 0x64, 0x2C, 0xD4, 0xB8, 0x83, 0xEE, 0xAD, 0x2D, 0x18, 0x68, 0x87, 0xCC, 0xA4, 0xB5,
-    0xEB, 0x83, 0x3E, 0xF0, 0x71, 0x50, 0x65, 0x1D, 0x08, 0x96, 0x1B, 0x99, 0x48, 0x2C, 0xE9, 0x04,
-    0x1E, 0x79, 0xCF, 0x17, 0x38, 0x13, 0x99, 0x5F, 0xAC, 0xB0, 0xDE, 0x59, 0xFD, 0x20, 0x38, 0x39,
-    0x4C, 0x2B, 0x77, 0xC9, 0x4A, 0x21, 0xFD, 0x1B, 0x90, 0xD3, 0x49, 0xEC, 0xD4, 0xC5, 0xEC, 0xED,
-    0xAA, 0x41, 0x35, 0xD8, 0x3E, 0xF9, 0xEF, 0x44, 0xDA, 0xF8, 0x47, 0xE4, 0xE4, 0x30, 0x67, 0x81,
-    0xD7, 0x11, 0x7A, 0x96, 0x3A, 0x60, 0x1D, 0x21, 0x6E, 0x9A, 0x8B, 0x0E, 0x7F, 0x16, 0x41, 0xED,
-    0x33, 0xA2, 0xA0, 0xDD, 0x75, 0x3C, 0xF4, 0xB5, 0xC0, 0x85, 0x1B, 0xF5, 0x30, 0x46, 0xB0, 0x3B,
-    0x82, 0x03, 0xC8, 0xAB, 0x62, 0x60, 0x5C, 0x07, 0x72, 0xF6, 0xEA, 0x59, 0xD8, 0xD2, 0x4E, 0x96,
-    0x71, 0x26, 0xA5, 0x0F, 0xDE, 0x65, 0x2B, 0xD6, 0xCB, 0xE8, 0x43, 0xD6, 0x58, 0x0D, 0x2D, 0x69,
-    0x14, 0x70, 0xC6, 0x4F, 0x80, 0xB3, 0x22, 0x37, 0x0B, 0x8C, 0x10, 0x98, 0x6A, 0xE5, 0x90, 0xF5,
-    0xFD, 0xEB, 0xE6, 0x6A, 0xBE, 0x6B, 0x8D, 0x09, 0x5B, 0xAD, 0x21, 0x7E, 0x4D, 0xD5, 0x3F, 0xED,
-    0xA8, 0xD6, 0x6B, 0x71, 0xD7, 0x84, 0x80, 0xF3, 0xD2, 0x5F, 0xDD, 0x12, 0xA9, 0x13, 0x39, 0x81,
-    0x5B, 0x4F, 0x08, 0x51, 0x27, 0x77, 0x23, 0x66, 0xDA, 0x73, 0x2F, 0xEB, 0x5B, 0x39, 0x46, 0x63,
-    0xD6, 0x01, 0x9C, 0x88, 0x03, 0x37, 0xD4, 0xB2, 0x06, 0xAE, 0x27, 0x87, 0xB4, 0x01, 0x5F, 0x4E,
-    0x28, 0xBE, 0xD5, 0x08, 0xC0, 0x6B, 0x41, 0x1D, 0x7C, 0x88, 0x14, 0x23, 0x3C, 0xDD, 0x30, 0xA7,
-    0x89, 0x6E, 0x30, 0xD1, 0x45, 0xE8, 0x0F, 0x2B, 0x10, 0xCB, 0x33, 0x1C, 0x8E, 0x3A, 0x2C, 0x66,
-    0x01, 0xEF, 0x12, 0xEC, 0xAC, 0x4E, 0xDD, 0x14, 0x23, 0x4A, 0x62, 0xC1, 0xD5, 0x58, 0xD3, 0xFD,
-    0x57, 0xC1, 0x53, 0x27, 0x2B, 0xDD, 0x97, 0x66, 0xFE, 0x1E, 0xE6, 0x64, 0x31, 0xE9, 0xE7, 0x48,
-    0xDA, 0x12, 0x23, 0x2B, 0x3B, 0x4A, 0x75, 0x0C, 0x77, 0x19, 0x4C, 0x75, 0x20, 0xBF, 0xFB, 0xC0,
-    0x05, 0x0E, 0xEC, 0x00, 0xA5, 0x9D, 0x14, 0x1D, 0xE4, 0xC4, 0xF4, 0xD5, 0x66, 0x76, 0xDD, 0xDF,
-    0xE7, 0x60, 0xB2, 0x32, 0xAA, 0xE7, 0x41, 0x5F, 0xCA, 0xE9, 0x2E, 0x4D, 0x77, 0x1D, 0x25, 0x5D,
-    0x15, 0x85, 0x81, 0xB1, 0x4C, 0x5A, 0xAE, 0x67, 0x06, 0x17, 0x2E, 0x0E, 0x34, 0xB8, 0x4B, 0x2D,
-    0xB5, 0x6E, 0xD4, 0x33, 0xD1, 0x73, 0xA2, 0xB1, 0x46, 0x9E, 0x8B, 0x9E, 0xD5, 0x58, 0x23, 0xA0,
-    0x71, 0x66, 0xBB, 0xEE, 0x93, 0x57, 0xCC, 0x81, 0x84, 0x93, 0xC3, 0x46, 0xDC, 0xFF, 0x18, 0x04,
-    0x08, 0x1B, 0x49, 0xBD, 0x70, 0xCE, 0x24, 0x4C, 0xEB, 0xA6, 0x92, 0xA4, 0xDE, 0xC9, 0x75, 0x0E,
-    0xC0, 0xA2, 0x31, 0x47, 0xD0, 0x72, 0xB6, 0xD1, 0xE5, 0x78, 0x83, 0x11, 0x47, 0xE1, 0xDB, 0x2C,
-    0xF3, 0x84, 0xE1, 0x64, 0xB7, 0xB7, 0x8A, 0x6B, 0x25, 0x31, 0x45, 0xE8, 0xCE, 0xC3, 0x20, 0x73,
-    0x4D, 0x20, 0x10, 0x6D, 0xB3, 0x07, 0x1E, 0xC4, 0x29, 0x03, 0xA5, 0x7B, 0xE5, 0xAD, 0xEA, 0x7F,
-    0xAF, 0x16, 0x47, 0x7F, 0xA1, 0x55, 0xBA, 0x18, 0x85, 0x29, 0xC4, 0xC6, 0xA0, 0x91, 0xB8, 0xEB,
-    0x20, 0x7E, 0x5B, 0x15, 0x13, 0xD0, 0xC9, 0x67, 0x75, 0x40, 0x9F, 0xE8, 0x9E, 0x86, 0xCF, 0x26,
-    0xFB, 0xF4, 0x5C, 0x1F, 0x98, 0xEA, 0x9C, 0xCA, 0x63, 0x05, 0x16, 0x50, 0x2F, 0xD7, 0x64, 0x81,
-    0x35, 0xBC, 0xB7, 0x5F, 0x3E, 0xB0, 0xB7, 0xA1, 0x94, 0xA3, 0x74, 0x8C, 0xFE, 0xF4, 0x4D, 0x1E,
-    0x16, 0x8C, 0x53, 0x8F, 0x20, 0xFF, 0xFB, 0x62, 0xE8, 0x86, 0xA5, 0x7D, 0x5E, 0xA7, 0x42, 0x69,
-    0x98, 0x8A, 0xFB, 0xFE, 0xEC, 0xED, 0xB0, 0x02, 0xF7, 0x18, 0xBA, 0xEC, 0xBE, 0xFB, 0xFC, 0x79,
-    0x05, 0xC6, 0x8B, 0x8E, 0x41, 0x1C, 0xEF, 0x5D, 0x47, 0xCF, 0xD0, 0x4A, 0xED, 0xCC, 0x6A, 0xB8,
-    0xD1, 0xFE, 0xFD, 0x52, 0x2E, 0xA4, 0x25, 0xC5, 0xE7, 0x9C, 0x9B, 0x18, 0xE4, 0x24, 0xC0, 0x2E,
-    0x3D, 0xDB, 0x83, 0x8C, 0xF7, 0x70, 0x79, 0xA7, 0xBB, 0xBE, 0x7A, 0x41, 0x5D, 0x1B, 0x1A, 0x61,
-    0xC0, 0x33, 0xD6, 0x0A, 0x1D, 0x71, 0xC2, 0x83, 0x35, 0x80, 0x09, 0x64, 0x48, 0x73, 0x8B, 0x06,
-    0x68, 0x3D, 0xA6, 0xEE, 0x70, 0x9D, 0x45, 0x59, 0x3B, 0x54, 0xF3, 0x5A, 0xA6, 0xBE, 0x9D, 0x39,
-    0x40, 0xB5, 0x72, 0x0C, 0x5C, 0x37, 0xCC, 0x32, 0x4C, 0x63, 0xD9, 0xA1, 0x9E, 0x48, 0xAD, 0x7D,
-    0xBF, 0xEC, 0x6D, 0xEB, 0xAA, 0x4A, 0x7B, 0x3A, 0xE9, 0xD4, 0xF4, 0x3D, 0xE2, 0x38, 0xCA, 0x91,
-    0x13, 0x89, 0xE0, 0x71, 0xB8, 0x9D, 0xA9, 0xE4, 0x5A, 0x67, 0x8A, 0xC3, 0x29, 0xC0, 0x41, 0x0D,
-    0x91, 0xAD, 0x40, 0x3B, 0xFD, 0xEF, 0xF9, 0x40, 0x12, 0x50, 0x10, 0x87, 0x03, 0x74, 0xB4, 0xA1,
-    0xC5, 0xE9, 0x91, 0x93, 0x99, 0x5B, 0x51, 0xAF, 0xE5, 0x18, 0xF5, 0x82, 0x78, 0x12, 0x4C, 0x01,
-    0x17, 0xF7, 0x78, 0xE4, 0x07, 0x7F, 0xD8, 0xDC, 0x4B, 0x88, 0x2B, 0x91, 0x98, 0x76, 0x17, 0xD8,
-    0x72, 0xA5, 0x36, 0xD8, 0x02, 0x23, 0x2C, 0xB1, 0x72, 0x02, 0xCC, 0x3B, 0x21, 0xFB, 0x0A, 0x70,
-    0xAF, 0xDF, 0xC4, 0x7A, 0x8A, 0x19, 0x3F, 0x6F, 0xF2, 0x64, 0x80, 0xC0, 0xF6, 0x15, 0x34, 0x43,
-    0x37, 0x7C, 0x31, 0xCB, 0x15, 0x07, 0x1E, 0x40, 0x1C, 0xFD, 0xE8, 0xBC, 0x76, 0x82, 0x23, 0x1F,
-    0xD5, 0x3C, 0x4E, 0x23, 0x4E, 0xD6, 0xE4, 0xBF, 0x46, 0x13, 0xB4, 0x54, 0x93, 0x00, 0x33, 0xAE,
-    0xCA, 0x3A, 0xC6, 0x70, 0x8C, 0xCF, 0xFC, 0xA1, 0x90, 0xA0, 0x8B, 0x90, 0xAE, 0x85, 0xD5, 0xF8,
-    0x1A, 0xF4, 0x08, 0x14, 0xC0, 0x59, 0xC6, 0x59, 0x44, 0x84, 0x6C, 0x5D, 0xE3, 0xAD, 0x43, 0x95,
-    0xB1, 0x11, 0x54, 0xAE, 0xE2, 0x5E, 0x80, 0x80, 0x93, 0x4D, 0x31, 0xA1, 0x57, 0xE7, 0xD9, 0x4E,
-    0x83, 0x7D, 0x6C, 0x99, 0x49, 0x5C, 0x84, 0xC9, 0x62, 0x2E, 0xC0, 0xF1, 0x05, 0x52, 0x14, 0xF1,
-    0x31, 0xB0, 0x67, 0x4B, 0xEA, 0x72, 0x84, 0xB8, 0x91, 0x92, 0xB8, 0x8E, 0x01, 0x92, 0x0A, 0x6F,
-    0x3F, 0xB2, 0x73, 0x27, 0xF3, 0x4B, 0x5E, 0x1E, 0xDC, 0xFD, 0x53, 0xCD, 0x9C, 0x44, 0xA9, 0xB3,
-    0xEA, 0xBF, 0x6F, 0xA8, 0xE8, 0x02, 0x71, 0x2E, 0xCF, 0x75, 0x81, 0xBB, 0x98, 0xF8, 0x7E, 0x5F,
-    0x53, 0x35, 0xE9, 0x9A, 0x43, 0xBC, 0xB8, 0xC9, 0x51, 0x8A, 0x68, 0xD6, 0x2C, 0xBD, 0xFC, 0x97,
-    0x5A, 0x03, 0x5E, 0xB2, 0x98, 0x88, 0x87, 0xFE, 0xCD, 0x6C, 0xC7, 0xD5, 0xE3, 0x0F, 0xA9, 0x13,
-    0x71, 0xBF, 0xA1, 0xA2, 0xB5, 0xAE, 0x8F, 0x1E, 0x7C, 0x7C, 0x28, 0x14, 0x38, 0x64, 0xA6, 0x20,
-    0x28, 0x51, 0xC3, 0xA0, 0x8D, 0xB4, 0xBB, 0xE0, 0x3A, 0xEA, 0xE3, 0xD4, 0x4D, 0x66, 0xA9, 0x6F,
-    0x46, 0xB6, 0x3C, 0xFA, 0x88, 0x42, 0x05, 0xA7, 0x86, 0xCE, 0x62, 0x92, 0xB5, 0x8F, 0x89, 0x6B,
-    0x49, 0x7B, 0x56, 0x24, 0x41, 0x9B, 0x43, 0xEB, 0x83, 0x3F, 0x66, 0xB6, 0x41, 0x3A, 0xF7, 0xD1,
-    0xC2, 0x11, 0x0C, 0x5F, 0xC0, 0xFA, 0xA2, 0x3E, 0x9D, 0x7F, 0xF8, 0x80, 0xE4, 0x25, 0xB4, 0x98,
-    0x70, 0x8F, 0xF7, 0xFD, 0x9F, 0x14, 0xC9, 0x86, 0x48, 0xD6, 0x45, 0xF2, 0xE4, 0x3D, 0xA7, 0x66,
-    0xB6, 0x89, 0x53, 0x81, 0x6E, 0xA0, 0xC7, 0xD6, 0x75, 0xAA, 0xFE, 0xF8, 0xFB, 0x49, 0x24, 0xE1,
-    0xC0, 0x8E, 0xB8, 0x3E, 0xE7, 0x41, 0xD7, 0xC7, 0xF7, 0xCE, 0x4F, 0xB1, 0xA3, 0xE2, 0x3D, 0x87,
-    0x00, 0x38, 0x74, 0x58, 0x86, 0xA3, 0x70, 0x90, 0x99, 0x9C, 0x7D, 0x61, 0xF4, 0xF1, 0x2F, 0xB4,
-    0x23, 0x9D, 0xD4, 0x80, 0x1B, 0x06, 0x5E, 0x2E, 0x5E, 0xD8, 0x3B, 0x11, 0x4C, 0x56, 0xA7, 0xB8,
-    0xBE, 0x67, 0xB2, 0xBA, 0x99, 0x07, 0xD9, 0xEC, 0x3C, 0x1C, 0xDF, 0xCD, 0x86, 0xCB, 0x4C, 0x2C,
-    0x40, 0xB0, 0x10, 0xE1, 0xAF, 0x72, 0x33, 0x80, 0x96, 0x97, 0xD2, 0x09, 0x16, 0xE4, 0x92, 0x79,
-    0x43, 0x9A, 0x89, 0xFD, 0x82, 0xB4, 0x83, 0x13, 0x6E, 0x74, 0x82, 0x2E, 0x79, 0x68, 0x4A, 0x7C,
-    0x34, 0x05, 0xCB, 0x68, 0xA2, 0x75, 0x34, 0x51, 0x89, 0x26, 0x1A, 0xA0, 0xC9, 0x50, 0x68, 0x12,
-    0x43, 0xB3, 0x0A, 0x44, 0xEE, 0x2B, 0xA4, 0xC1, 0xE8, 0xF8, 0x27, 0x0D, 0xC2, 0x59, 0x51, 0x5D,
-    0x04, 0x03, 0x60, 0xD6, 0xB4, 0xF2, 0x95, 0x3D, 0xF4, 0x9B, 0xB9, 0xA2, 0x22, 0x77, 0x07, 0x71,
-    0x2E, 0x8C, 0x42, 0x8E, 0x4E, 0x52, 0xA4, 0xB8, 0xA4, 0x80, 0xF7, 0x75, 0x60, 0x61, 0x4E, 0x64,
-    0xDD, 0xDD, 0xE0, 0xA5, 0xCE, 0x97, 0x3E, 0x74, 0x40, 0xD0, 0x64, 0xF7, 0xDF, 0x54, 0x20, 0xD4,
-    0x27, 0x8A, 0x0C, 0x40, 0x05, 0x58, 0xBD, 0x0D, 0xC4, 0x0B, 0x4E, 0xF4, 0x21, 0xFD, 0xA5, 0x12,
-    0xA2, 0x5E, 0x2B, 0xD0, 0x74, 0x2A, 0x43, 0x93, 0xC8, 0xD0, 0x64, 0xA5, 0x10, 0xD5, 0xFE, 0x18,
-    0xA2, 0x3A, 0x1F, 0x42, 0x54, 0xE7, 0xAF, 0x90, 0xDE, 0xCD, 0x21, 0xBD, 0x9F, 0x78, 0xB7, 0xC8,
-    0x3F, 0x0D, 0xEA, 0xC2, 0xDA, 0x61, 0x34, 0xF9, 0x39, 0x35, 0xC4, 0x4F, 0x0B, 0xCB, 0x1C, 0x4F,
-    0xA3, 0xC9, 0x88, 0xFB, 0x4D, 0x66, 0x71, 0x6A, 0x55, 0x5C, 0xBE, 0x48, 0x5D, 0xC9, 0x49, 0xFA,
-    0xFE, 0xE2, 0x72, 0x83, 0x8D, 0x1C, 0xD1, 0x51, 0xA7, 0x9B, 0xC0, 0x3C, 0x19, 0xD4, 0x7A, 0x60,
-    0x78, 0xD1, 0xE9, 0x17, 0xE3, 0x8B, 0xC1, 0x67, 0xFE, 0xDD, 0xE4, 0x4A, 0x1C, 0xD8, 0x2A, 0x27,
-    0x67, 0x75, 0xD9, 0xD5, 0xCC, 0xFE, 0x7F, 0x56, 0xE8, 0x69, 0x5C, 0x22, 0x2E, 0x63, 0xD4, 0x75,
-    0xC6, 0xE4, 0xBC, 0xA1, 0xBB, 0x8F, 0xB9, 0x42, 0xB5, 0x87, 0xAF, 0xEB, 0x4F, 0x5D, 0x5F, 0x16,
-    0x3A, 0x9E, 0xD4, 0x35, 0x20, 0xAD, 0x4F, 0x33, 0x99, 0xB9, 0xAA, 0x82, 0x29, 0x53, 0x85, 0x4C,
-    0x2C, 0xC3, 0x68, 0x59, 0x5F, 0x59, 0x32, 0x37, 0xE6, 0x99, 0x6B, 0xBA, 0xA8, 0x39, 0x18, 0x69,
-    0x36, 0x76, 0x7F, 0xB3, 0x09, 0x0E, 0x19, 0x90, 0x5F, 0x7E, 0xAF, 0x3D, 0x14, 0x6C, 0x0F, 0xF9,
-    0xAE, 0x3D, 0xA4, 0x6C, 0x0F, 0x09, 0xDB, 0xC3, 0x15, 0xB6, 0x87, 0x37, 0xD9, 0x1E, 0x7E, 0xB7,
-    0x8F, 0x3D, 0x60, 0xC4, 0x49, 0x0E, 0xB9, 0x1D, 0x96, 0x4E, 0x57, 0xB0, 0xEB, 0x38, 0x49, 0x8B,
-    0x76, 0xC5, 0x56, 0x60, 0x54, 0x86, 0xAE, 0xD4, 0xB0, 0x22, 0x78, 0xFE, 0x05, 0x47, 0x6C, 0x63,
-    0xFC, 0xA7, 0x5D, 0x18, 0x99, 0xCA, 0xB9, 0x0F, 0xB7, 0x76, 0x69, 0x56, 0x44, 0x58, 0x3B, 0xE2,
-    0x1C, 0x47, 0xEB, 0xA6, 0x02, 0xEF, 0xAB, 0x60, 0xAC, 0x3A, 0xF4, 0xDB, 0x15, 0x5D, 0x40, 0x20,
-    0xFF, 0xED, 0x58, 0x3A, 0xC8, 0x07, 0x90, 0x5F, 0x60, 0xDD, 0xD0, 0xC7, 0x55, 0x2C, 0x5C, 0xC9,
-    0x04, 0xE0, 0x43, 0xD9, 0x44, 0xD3, 0x8F, 0xF8, 0x00, 0x8A, 0x76, 0xAE, 0xA2, 0xE3, 0x02, 0xD7,
-    0x78, 0xA7, 0x0B, 0x38, 0x1C, 0xE0, 0xA0, 0xA4, 0xF0, 0x8E, 0xE2, 0x7E, 0x60, 0xC3, 0x7A, 0x18,
-    0xA4, 0x7F, 0x63, 0xD4, 0x83, 0xC2, 0x82, 0x54, 0x9C, 0xF4, 0x8D, 0xB2, 0x47, 0xDE, 0x22, 0x62,
-    0x59, 0x44, 0x3C, 0x62, 0x41, 0x4E, 0x4C, 0xE2, 0xAB, 0x84, 0x2B, 0xD4, 0x85, 0xF7, 0x45, 0x69,
-    0x40, 0xBA, 0x89, 0xF9, 0x1A, 0xEA, 0xAD, 0xE8, 0x38, 0x24, 0x3D, 0x13, 0x90, 0xC1, 0xB5, 0xAC,
-    0xDD, 0x1A, 0xFC, 0xE4, 0x7B, 0x1C, 0xD5, 0x11, 0xFA, 0xB6, 0x67, 0x4A, 0x82, 0xDE, 0x33, 0x84,
-    0x7C, 0xFF, 0x74, 0x46, 0x46, 0xB9, 0xD4, 0x48, 0xCA, 0x22, 0xD7, 0x92, 0xB2, 0xC8, 0x1F, 0xF2,
-    0x24, 0xA0, 0x51, 0xE7, 0x1C, 0x38, 0x4C, 0xEE, 0x73, 0x85, 0xB5, 0x22, 0x57, 0x5A, 0xD5, 0x2A,
-    0xD7, 0x06, 0xA0, 0x8C, 0x89, 0xBA, 0x67, 0x43, 0x3E, 0x41, 0x4B, 0x36, 0x40, 0x33, 0xA2, 0xDF,
-    0x8F, 0xB4, 0x63, 0xA9, 0xC8, 0xD9, 0x19, 0xDA, 0xD2, 0xBD, 0x2A, 0xCD, 0x6F, 0x33, 0xCE, 0x8D,
-    0x90, 0x71, 0x73, 0x0C, 0xDE, 0xC1, 0x8F, 0x75, 0xAE, 0xF8, 0x3B, 0xAF, 0x57, 0x8B, 0x9A, 0xFB,
-    0x77, 0x47, 0x13, 0x3D, 0x62, 0xC0, 0xC2, 0x33, 0x0C, 0x38, 0x74, 0x91, 0xA4, 0x83, 0x6A, 0x8A,
-    0xE0, 0xFC, 0x8F, 0xA8, 0x68, 0x5D, 0x9E, 0xB1, 0x02, 0xB1, 0x99, 0x8A, 0x4F, 0x32, 0x03, 0x89,
-    0xD4, 0xFB, 0xCF, 0x8D, 0xD8, 0x9E, 0x4A, 0x45, 0xA5, 0x4E, 0x65, 0xD6, 0xD7, 0x19, 0xAD, 0x03,
-    0xD6, 0x37, 0xB4, 0xE4, 0x18, 0xBE, 0x83, 0x8C, 0x69, 0x15, 0x77, 0x64, 0x22, 0x8D, 0xDF, 0xC9,
-    0x2C, 0xB4, 0x4C, 0x07, 0x75, 0x6D, 0x86, 0xCB, 0xBC, 0x4A, 0x45, 0xDE, 0xE7, 0xE1, 0x85, 0x0D,
-    0x50, 0xAA, 0x82, 0x4E, 0xBA, 0x01, 0x4C, 0x28, 0x29, 0x35, 0x07, 0x4C, 0xB8, 0xF4, 0xE5, 0x69,
-    0x17, 0x03, 0x23, 0x19, 0x28, 0x00, 0xAD, 0xA3, 0x4A, 0x47, 0xEE, 0x35, 0x2F, 0x69, 0x83, 0xD3,
-    0x57, 0x5F, 0xE1, 0x1C, 0xC0, 0x16, 0x43, 0x26, 0x44, 0xA6, 0xBA, 0xA8, 0x60, 0xCF, 0xBA, 0xEF,
-    0xF1, 0x54, 0x3C, 0xCE, 0x1D, 0x2E, 0x2C, 0x9D, 0xD9, 0x4A, 0x91, 0x3A, 0x06, 0xBD, 0x1E, 0xF9,
-    0xD2, 0x59, 0x05, 0x43, 0xD4, 0xD6, 0xA1, 0x76, 0x52, 0x4E, 0xC1, 0x0B, 0x76, 0x63, 0x9F, 0x07,
-    0x07, 0x11, 0x06, 0xAD, 0x81, 0x89, 0x48, 0xF2, 0xBE, 0xD8, 0x51, 0xEA, 0x94, 0xCA, 0x3D, 0x15,
-    0x4D, 0x04, 0x7A, 0xE7, 0x63, 0xBE, 0xB6, 0x77, 0x2E, 0x49, 0xEB, 0x90, 0x37, 0xB2, 0x96, 0x5F,
-    0xFD, 0x99, 0x73, 0xE4, 0x9C, 0xDC, 0xCB, 0x71, 0x30, 0x56, 0x7D, 0x1D, 0x11, 0x6B, 0xC4, 0xCB,
-    0xBE, 0x9D, 0x92, 0x87, 0x48, 0x69, 0x2B, 0xDE, 0x62, 0x61, 0x6E, 0x08, 0xFE, 0xE6, 0x71, 0xF1,
-    0x4D, 0xFA, 0x7C, 0x0B, 0x3C, 0x3C, 0x0A, 0x91, 0xF1, 0x88, 0xB2, 0xD9, 0x64, 0xD1, 0x64, 0xA4,
-    0xAE, 0x8B, 0xB7, 0xF7, 0x02, 0xCC, 0xCC, 0x95, 0x32, 0xFC, 0xB0, 0xB4, 0xAA, 0xDF, 0x08, 0x5D,
-    0x19, 0xBB, 0xFF, 0x7F, 0x66, 0x10, 0x84, 0x10, 0xF7, 0x02, 0xD7, 0x4F, 0x55, 0x60, 0x94, 0x08,
-    0xAA, 0x1E, 0xF9, 0xF7, 0x12, 0xFC, 0x36, 0x1A, 0x36, 0xC8, 0xE4, 0x2C, 0x22, 0xC6, 0x80, 0x1E,
-    0xC6, 0xB1, 0x2F, 0x73, 0x29, 0x0B, 0xD4, 0xBE, 0x2F, 0xF4, 0x2D, 0x91, 0xF7, 0xA5, 0x55, 0xC0,
-    0x83, 0x7D, 0xA9, 0x59, 0xE9, 0x91, 0xD1, 0xBE, 0x4F, 0xBF, 0x61, 0xAA, 0xBB, 0x30, 0x7F, 0x60,
-    0xA1, 0x18, 0x20, 0x23, 0xEE, 0x04, 0x62, 0x80, 0x88, 0x02, 0x3F, 0x34, 0x0D, 0x3E, 0x89, 0x2B,
-    0xE0, 0x53, 0x1D, 0xBC, 0xC5, 0xB0, 0xC9, 0x36, 0x7E, 0x2C, 0x9D, 0x3E, 0x6D, 0xA4, 0xCE, 0x3F,
-    0x4B, 0xEB, 0xA6, 0x5E, 0xBD, 0x3E, 0x3D, 0xA2, 0xF8, 0x11, 0xFF, 0x00, 0x57, 0x02, 0x44, 0xAF,
-    0xE8, 0x3B, 0x5F, 0x0E, 0x2C, 0x55, 0xBA, 0xFF, 0xDD, 0xEF, 0x50, 0xAB, 0xCD, 0xFF, 0xCF, 0xF9,
-    0xE0, 0x52, 0x29, 0xD7, 0x31, 0x0D, 0x26, 0x64, 0x39, 0xB2, 0x99, 0x7F, 0xA4, 0xA5, 0x8C, 0xDA,
-    0x39, 0x2D, 0x95, 0x54, 0xC6, 0x17, 0x33, 0xAE, 0x60, 0xD6, 0x95, 0x2F, 0xC4, 0xBD, 0x40, 0xE7,
-    0xB0, 0x53, 0x23, 0x10, 0x78, 0xED, 0x9B, 0xF5, 0x96, 0x79, 0x5D, 0xFE, 0x0D, 0x64, 0x57, 0x81,
-    0x8D, 0xFF, 0xF2, 0xA8, 0x7D, 0x9B, 0xE6, 0xCE, 0x9A, 0xB7, 0x3F, 0xEF, 0x23, 0xBE, 0x4D, 0x6B,
-    0xA6, 0x1D, 0x06, 0xC6, 0x4E, 0x62, 0x5D, 0xCE, 0xEC, 0xDA, 0x24, 0x7E, 0xB0, 0x04, 0x58, 0xE3,
-    0xC4, 0xDA, 0xA2, 0x7C, 0xED, 0x84, 0x90, 0x0D, 0x72, 0xBA, 0x2F, 0x5D, 0x97, 0x27, 0x5A, 0xB4,
-    0x89, 0x53, 0x39, 0x9C, 0x86, 0xE2, 0xCB, 0xB4, 0xF1, 0x8A, 0x79, 0x3B, 0x9A, 0x5B, 0x7E, 0x69,
-    0x53, 0x65, 0x8C, 0x8C, 0x3F, 0x78, 0xB4, 0x97, 0x61, 0x67, 0x3A, 0x52, 0x7A, 0x5A, 0xED, 0xF3,
-    0x07, 0x1C, 0xF0, 0x29, 0x4E, 0x07, 0x05, 0x27, 0x64, 0x2E, 0xDB, 0xE0, 0x4F, 0xE9, 0x55, 0x07,
-    0x40, 0x73, 0x43, 0xB2, 0xFF, 0xF5, 0x1E, 0x73, 0x05, 0x84, 0x6C, 0xCD, 0x39, 0xC1, 0xB7, 0x29,
-    0x8C, 0xC3, 0x3D, 0xF0, 0x0A, 0x4C, 0x03, 0xBD, 0xC0, 0x57, 0xD5, 0xE6, 0x9D, 0xF8, 0x42, 0x86,
-    0x90, 0xD8, 0x6A, 0x89, 0xD4, 0x79, 0x82, 0x0A, 0x53, 0xD7, 0xEB, 0x19, 0x90, 0x6A, 0x52, 0xA0,
-    0x4B, 0x5C, 0xFB, 0x35, 0xCC, 0x0C, 0x38, 0x34, 0x36, 0x1B, 0x86, 0x47, 0x80, 0x53, 0x56, 0x3E,
-    0x3A, 0xCB, 0xE5, 0xA8, 0x60, 0xD7, 0xAF, 0x5A, 0x75, 0x32, 0xEA, 0xA9, 0x8F, 0x54, 0xF9, 0xA0,
-    0x5C, 0x97, 0xEB, 0xA6, 0xAB, 0xA6, 0x4A, 0xA0, 0x9A, 0xDF, 0x70, 0xF0, 0x75, 0x98, 0xDF, 0xF5,
-    0xD9, 0xAB, 0xCE, 0x8B, 0x88, 0x3A, 0x00, 0x33, 0x71, 0x1B, 0xC3, 0xF8, 0xC9, 0xEE, 0x06, 0x9A,
-    0x01, 0xF9, 0xE7, 0x21, 0x7F, 0xD9, 0xB9, 0x38, 0x58, 0x45, 0x16, 0x29, 0x36, 0x11, 0xD3, 0xB3,
-    0x15, 0x27, 0xFA, 0xC5, 0x01, 0xE4, 0x1E, 0x35, 0x18, 0xF1, 0x79, 0x78, 0x26, 0x1C, 0x48, 0x04,
-    0x2C, 0x62, 0x44, 0xAF, 0x8A, 0xAB, 0xD4, 0x3B, 0x6A, 0x49, 0x84, 0x62, 0xA5, 0xE4, 0x83, 0xF2,
-    0x72, 0xA4, 0xD5, 0x83, 0xCC, 0x1B, 0xC2, 0x09, 0x0F, 0xA0, 0xC1, 0x9F, 0x7D, 0x43, 0xDA, 0xAD,
-    0x0F, 0xA4, 0xC1, 0x07, 0xEB, 0x08, 0x11, 0xE0, 0x7E, 0x1D, 0x19, 0x01, 0x54, 0xEB, 0x6D, 0x46,
-    0x5C, 0xD6, 0x43, 0xA7, 0x6F, 0xE4, 0x63, 0x25, 0x8B, 0x6E, 0x60, 0x74, 0xCF, 0x00, 0xEC, 0xAA,
-    0x99, 0x14, 0x51, 0x1B, 0xEB, 0x30, 0xC7, 0x38, 0xB4, 0x06, 0x37, 0xE1, 0xEC, 0x0E, 0x94, 0xF9,
-    0xA1, 0x4D, 0x88, 0x99, 0x09, 0x00, 0xCA, 0x25, 0x2B, 0x33, 0x38, 0x78, 0x03, 0x8F, 0x74, 0xCC,
-    0xA7, 0x85, 0xD1, 0xB6, 0xCA, 0x39, 0xE4, 0x49, 0x03, 0x80, 0xC9, 0xBF, 0x62, 0xD0, 0xE0, 0xD7,
-    0x63, 0x3B, 0x7C, 0xB4, 0x1A, 0xC5, 0xD2, 0xDF, 0xAF, 0x3E, 0x37, 0xD6, 0x60, 0xE4, 0x80, 0x27,
-    0x7F, 0x4B, 0xAD, 0x08, 0xF5, 0x66, 0xBD, 0x61, 0xCB, 0x52, 0xB3, 0x1E, 0xE0, 0xBF, 0x7A, 0xCF,
-    0x62, 0x77, 0x4F, 0x68, 0x9E, 0x99, 0x63, 0xE2, 0xA8, 0x3F, 0x14, 0x10, 0xE8, 0xFB, 0xA5, 0xBF,
-    0xBB, 0xA9, 0x43, 0xBA, 0xD8, 0x69, 0x49, 0x50, 0x80, 0x65, 0xAC, 0x73, 0x0C, 0xB0, 0x56, 0xCC,
-    0xDD, 0x79, 0x48, 0x3E, 0x08, 0xEF, 0x62, 0x75, 0xCC, 0xFA, 0x8E, 0x14, 0x76, 0x09, 0xE8, 0xF6,
-    0x1E, 0x5E, 0x6B, 0x44, 0x83, 0x1B, 0xF8, 0x01, 0xC8, 0xC2, 0x36, 0x18, 0x59, 0x2C, 0xF7, 0x1E,
-    0x77, 0x38, 0x69, 0x60, 0x0A, 0xD5, 0xEF, 0xA9, 0xA6, 0x60, 0x23, 0xA5, 0xFD, 0xD8, 0x6B, 0xF2,
-    0x9C, 0x11, 0x91, 0xF3, 0x7A, 0x82, 0xD9, 0x21, 0xAC, 0xCD, 0xAC, 0x1C, 0xD2, 0x9A, 0xD0, 0x71,
-    0x46, 0x12, 0xBD, 0x85, 0xC4, 0x29, 0x41, 0xCA, 0x05, 0x1C, 0x36, 0x39, 0xBB, 0xAC, 0xAB, 0x3B,
-    0x20, 0xC7, 0xC8, 0x7C, 0x86, 0xA4, 0x8A, 0xC5, 0x08, 0x9C, 0xF9, 0x11, 0x26, 0xA4, 0x9B, 0x52,
-    0x8C, 0xEC, 0x68, 0x40, 0x94, 0xE0, 0x7C, 0x3E, 0x1B, 0xB2, 0xB7, 0xCB, 0x5B, 0x39, 0x15, 0xE3,
-    0x71, 0xC4, 0x1B, 0xE0, 0x3F, 0x09, 0x46, 0x3E, 0x7B, 0x12, 0xFE, 0xC2, 0x03, 0xFF, 0xA5, 0x31,
-    0x43, 0xF9, 0x4C, 0xEA, 0x65, 0xCE, 0xF7, 0xCC, 0x4A, 0x37, 0x2C, 0x81, 0xF4, 0x3A, 0x3B, 0xEA,
-    0x16, 0xA9, 0x4F, 0xF5, 0x7E, 0xFC, 0xE8, 0xF5, 0xFE, 0xDF, 0x72, 0x19, 0xA1, 0xAC, 0x79, 0xA7,
-    0x03, 0xCE, 0x40, 0xCF, 0x4D, 0x8E, 0xB6, 0x68, 0x7F, 0xBC, 0x99, 0x69, 0x7B, 0x48, 0xE0, 0xF0,
-    0x05, 0xA2, 0x47, 0x0F, 0x37, 0xB5, 0x40, 0x41, 0x9E, 0x9E, 0xDA, 0x5B, 0xB3, 0xC7, 0x99, 0xD9,
-    0xF4, 0x02, 0x50, 0x09, 0x2C, 0x41, 0x7D, 0xB2, 0xC1, 0x1B, 0xAE, 0x8F, 0x20, 0xB3, 0x6E, 0x8A,
-    0xD0, 0xE0, 0x33, 0xF2, 0x86, 0x5C, 0x20, 0x55, 0x5B, 0x65, 0xC3, 0x9A, 0x27, 0xB3, 0x86, 0x25,
-    0xE9, 0x50, 0xC5, 0x79, 0x5D, 0x9D, 0x03, 0x3F, 0x96, 0xDB, 0x84, 0x70, 0x1B, 0x8E, 0x12, 0x76,
-    0x50, 0x17, 0xAB, 0x68, 0xC8, 0x21, 0x63, 0xB4, 0xB3, 0x75, 0xBC, 0xFE, 0xAA, 0x9A, 0xFD, 0x4A,
-    0x1D, 0xD8, 0xED, 0x73, 0x69, 0xBD, 0xBF, 0x73, 0x7E, 0x77, 0xE8, 0x69, 0x26, 0xF4, 0xD3, 0x0B,
-    0xA1, 0xC2, 0x0D, 0x31, 0x33, 0x44, 0xD0, 0x41, 0xF6, 0x95, 0xE5, 0xBA, 0x36, 0xAE, 0x80, 0xB1,
-    0x46, 0xCE, 0x5F, 0xD0, 0xB7, 0xB1, 0x15, 0xB9, 0xFC, 0x68, 0xC0, 0x0D, 0x09, 0x8D, 0xF7, 0xC4,
-    0x55, 0x89, 0xD9, 0xB7, 0xAD, 0x73, 0xBC, 0xE3, 0xD8, 0x41, 0xF2, 0xB9, 0xC6, 0xE4, 0x91, 0xF3,
-    0x01, 0x72, 0xA6, 0x28, 0xE7, 0x64, 0xF6, 0x77, 0xF4, 0x01, 0x06, 0xB4, 0xFB, 0xB4, 0xCC, 0x61,
-    0xA7, 0x24, 0xE6, 0x8F, 0xCC, 0x28, 0x23, 0x9D, 0xFD, 0xBB, 0x63, 0xD8, 0xA1, 0x75, 0xA3, 0xB9,
-    0x99, 0x2E, 0x9D, 0x22, 0xCF, 0xE1, 0x49, 0x25, 0x27, 0xC7, 0xC1, 0x05, 0xA9, 0xD1, 0x2B, 0x76,
-    0xE5, 0xDF, 0xB2, 0x83, 0xC5, 0x84, 0x33, 0xE9, 0x1C, 0x59, 0x92, 0x74, 0xA9, 0x6D, 0x0E, 0xD9,
-    0x64, 0x3A, 0x59, 0x8B, 0x3C, 0xEB, 0x0C, 0x14, 0x91, 0xBD, 0x9F, 0xBF, 0x4A, 0xCE, 0x5B, 0xF6,
-    0x47, 0xC8, 0x0E, 0x92, 0x16, 0x80, 0x96, 0x35, 0x8B, 0x41, 0x61, 0xA4, 0x98, 0xCA, 0xEE, 0xD3,
-    0x60, 0x5C, 0xED, 0xD3, 0xEA, 0xD9, 0xE1, 0x7C, 0x07, 0x53, 0x79, 0xB5, 0x7E, 0xF2, 0x06, 0x58,
-    0x33, 0xFD, 0xA2, 0x2A, 0xDC, 0xCA, 0x4D, 0x91, 0xE0, 0x97, 0xBC, 0x08, 0x81, 0xCB, 0x89, 0x50,
-    0x80, 0x64, 0x0D, 0x30, 0xB1, 0x89, 0x49, 0x7C, 0x8B, 0x5B, 0xBC, 0x4C, 0x4F, 0xA6, 0xE6, 0x8E,
-    0x9C, 0xC6, 0x73, 0xE6, 0x6E, 0x36, 0xB4, 0xD8, 0x88, 0x6F, 0x01, 0xC1, 0xAA, 0xBA, 0xC0, 0x12,
-    0x07, 0xBA, 0x34, 0xDB, 0x9E, 0x23, 0x23, 0x9D, 0x1D, 0x0D, 0xEF, 0x56, 0x3C, 0x97, 0x99, 0x9C,
-    0x77, 0x65, 0xFA, 0xBC, 0x89, 0xC6, 0x8B, 0xEC, 0x00, 0x6B, 0xD7, 0x90, 0x37, 0x4A, 0x72, 0x8F,
-    0xD5, 0xCF, 0x79, 0xF1, 0x7E, 0xF8, 0xB0, 0xEE, 0x97, 0x55, 0xC2, 0x79, 0x66, 0x42, 0x7F, 0x57,
-    0x69, 0x35, 0x19, 0xDB, 0xDC, 0xD1, 0x59, 0xD0, 0x71, 0x4E, 0xFA, 0x9C, 0xCB, 0x7B, 0x41, 0x0C,
-    0xFE, 0xD7, 0x7D, 0x49, 0xA5, 0x61, 0x11, 0x46, 0x66, 0x2E, 0xD8, 0x76, 0xD6, 0xB9, 0xF6, 0x8D,
-    0x05, 0x33, 0x72, 0xAC, 0x9D, 0x0F, 0x75, 0x8B, 0x1B, 0x2C, 0x19, 0xD7, 0x93, 0x93, 0x3D, 0xB1,
-    0xEF, 0x9A, 0xC7, 0xA4, 0x5A, 0x81, 0xCE, 0x8B, 0x9A, 0x2F, 0x73, 0x43, 0x28, 0x75, 0xFD, 0xE4,
-    0xC9, 0xD1, 0xE3, 0x06, 0x0B, 0x16, 0x6F, 0xB7, 0x5E, 0x58, 0x4D, 0xD6, 0xA8, 0x63, 0x4A, 0x91,
-    0x99, 0x9C, 0xA0, 0x00, 0x60, 0xF5, 0xD3, 0x37, 0xFC, 0xD8, 0x4D, 0xAA, 0xEB, 0xA9, 0x7C, 0x2B,
-    0xAF, 0x75, 0x41, 0xB3, 0x38, 0x91, 0xAD, 0x93, 0xB5, 0xA9, 0x54, 0xE5, 0xA8, 0xDD, 0x07, 0x3A,
-    0x88, 0xF3, 0x57, 0xFD, 0xE0, 0x0F, 0xCC, 0x6B, 0xA4, 0x20, 0x57, 0x95, 0x9E, 0x1A, 0xCE, 0x52,
-    0x31, 0x2B, 0x32, 0xBD, 0xEB, 0x1F, 0x34, 0x4F, 0x08, 0x65, 0x13, 0xB6, 0x74, 0xDC, 0xE0, 0x98,
-    0x7F, 0xA1, 0xF2, 0x9B, 0xBA, 0x6D, 0x5D, 0xD4, 0x36, 0xCA, 0x51, 0x19, 0xE6, 0x50, 0xE5, 0x9B,
-    0xD3, 0x17, 0xF9, 0x7B, 0x15, 0xBF, 0x83, 0x4B, 0x66, 0x46, 0x53, 0xE4, 0xBC, 0x96, 0xEB, 0x67,
-    0x84, 0x78, 0x2F, 0xA8, 0x79, 0x44, 0xE8, 0xF0, 0x34, 0x67, 0xD3, 0x25, 0xEB, 0x4A, 0x6A, 0x7E,
-    0x27, 0xB9, 0xBC, 0xDF, 0xFE, 0x01, 0x9A, 0x9B, 0x27, 0xAF, 0xA2, 0xF5, 0x90, 0xB2, 0x27, 0xEA,
-    0xAD, 0xC6, 0x83, 0xFC, 0xDB, 0x03, 0xAE, 0xE6, 0xFC, 0x1F, 0x55, 0x8E, 0xBF, 0x4A, 0xC3, 0x50,
-    0x14, 0xC6, 0x4F, 0x72, 0x69, 0x83, 0xB9, 0xD0, 0x9B, 0xA1, 0x43, 0x2B, 0xE8, 0x5D, 0x1C, 0x44,
-    0x6A, 0xE2, 0xD0, 0x21, 0xC3, 0x49, 0x0C, 0x74, 0xE8, 0xE0, 0x52, 0x04, 0x5F, 0x41, 0x5C, 0x04,
-    0x1F, 0xA0, 0x34, 0x17, 0x9F, 0xA0, 0x8F, 0xD0, 0xD9, 0xA9, 0x43, 0x85, 0x0E, 0x56, 0x6E, 0x71,
-    0xE8, 0x1A, 0x67, 0x07, 0xB3, 0x3B, 0x98, 0x4A, 0x90, 0x8B, 0xDC, 0x36, 0x26, 0x9D, 0xF4, 0x6C,
-    0xE7, 0xE3, 0xFB, 0xF3, 0x73, 0x2C, 0x31, 0x32, 0x73, 0x2A, 0x0F, 0xA0, 0x3C, 0xA4, 0x89, 0x0A,
-    0x49, 0x04, 0x40, 0x12, 0x9A, 0xF1, 0x27, 0x74, 0x67, 0xAC, 0x92, 0x63, 0xBB, 0xF8, 0x5C, 0x6F,
-    0x9D, 0x23, 0xAF, 0x78, 0x29, 0x74, 0x25, 0xC0, 0x84, 0x28, 0x1E, 0x6B, 0x3A, 0xC1, 0xE7, 0x45,
-    0xB3, 0x65, 0xF6, 0x32, 0x1D, 0x32, 0x19, 0x39, 0xF5, 0xB1, 0xA7, 0x11, 0xBB, 0x08, 0x73, 0x2B,
-    0xA9, 0x5A, 0x8C, 0x31, 0xCF, 0x11, 0xFD, 0x0E, 0xA2, 0x97, 0xD7, 0xC7, 0x65, 0xAC, 0xEB, 0xD3,
-    0x95, 0xCC, 0x95, 0xCB, 0xC9, 0xBD, 0xDC, 0xF5, 0x10, 0x81, 0x2E, 0x83, 0xEF, 0x84, 0x28, 0xE0,
-    0xE5, 0x6B, 0x2E, 0x65, 0x10, 0x9A, 0xEB, 0x8C, 0x5D, 0x08, 0xBF, 0xB3, 0x33, 0x70, 0x15, 0x6F,
-    0x53, 0x2E, 0x6A, 0xD0, 0xC0, 0x79, 0xAE, 0x16, 0xCD, 0x36, 0x5B, 0xE6, 0x01, 0xA3, 0xBD, 0xA8,
-    0xCD, 0x56, 0xAF, 0x19, 0x5A, 0xE2, 0x0E, 0x4E, 0x03, 0xF4, 0xCF, 0x9C, 0xE3, 0x30, 0x1C, 0x4E,
-    0xE1, 0x3F, 0x8F, 0xDD, 0x5F, 0x4C, 0x3F, 0x1A, 0xB1, 0x1C, 0xD8, 0x56, 0xAA, 0x82, 0xC3, 0x1A,
-    0xEC, 0x13, 0x4D, 0xE4, 0xD0, 0x33, 0x22, 0x30, 0x52, 0xA4, 0x62, 0x74, 0xB9, 0x01, 0xB8, 0x7E,
-    0xBB, 0x7D, 0x14, 0x25, 0x49, 0xCA, 0x94, 0x1B, 0xCC, 0x99, 0x53, 0x8E, 0x66, 0xD6, 0x86, 0x9F,
-    0xEB, 0x8A, 0x38, 0xB4, 0x8B, 0xF7, 0xAF, 0xED, 0xE0, 0xA6, 0x76, 0xD5, 0x2B, 0xF4, 0xC9, 0x43,
-    0xF4, 0x07, 0x68, 0xAF, 0xF4, 0x81, 0x07, 0x44, 0xC2, 0x0C, 0x0C, 0x68, 0x99, 0xFD, 0x6C, 0xB3,
-    0x1B, 0x75, 0x18, 0x91, 0x3F, 0x5E, 0xF4, 0x0B, 0xCD, 0x7B, 0x41, 0x8C, 0xDD, 0x56, 0x96, 0xDD,
-    0x25, 0xA9, 0x2A, 0x8E, 0xCD, 0xB6, 0x9F, 0x16, 0xD2, 0xB4, 0x11, 0xD9, 0x62, 0x2F, 0x1A, 0x88,
-    0x82, 0x96, 0xC4, 0x2C, 0xBC, 0xA8, 0x20, 0xFF, 0x7F, 0x52, 0x56, 0x00, 0x2D, 0xBC, 0xB0, 0x92,
-    0xE8, 0xF7, 0x60, 0x20, 0x60, 0xDC, 0x8B, 0x59, 0xF4, 0x74, 0x03, 0x53, 0xB3, 0x30, 0x02, 0x2F,
-    0x7E, 0xD5, 0xA7, 0xAD, 0x85, 0x17, 0x5E, 0xB4, 0x1A, 0x81, 0x27, 0x8B, 0x59, 0xB4, 0x90, 0x76,
-    0x80, 0x9E, 0xD2, 0xA2, 0x84, 0x44, 0x19, 0xD4, 0x20, 0x5F, 0x45, 0x4A, 0x85, 0xC4, 0x8B, 0x5E,
-    0x98, 0x9E, 0x46, 0xA7, 0x83, 0xF4, 0xA2, 0xE9, 0x76, 0x79, 0xAC, 0x94, 0x81, 0x11, 0xC7, 0xCD,
-    0x1E, 0xB3, 0x4A, 0xFC, 0x7C, 0x39, 0xE7, 0x91, 0xBF, 0xAA, 0x54, 0x92, 0x3D, 0x92, 0x2D, 0x77,
-    0x22, 0x55, 0xB1, 0xF8, 0xF9, 0xC9, 0xF7, 0xEE, 0x7B, 0xEF, 0xDE, 0x73, 0xCF, 0xBD, 0xF7, 0x51,
-    0x62, 0x91, 0x40, 0xC4, 0x6A, 0x44, 0xE6, 0x6B, 0xFC, 0xC5, 0x47, 0x91, 0xE1, 0x70, 0xF8, 0x92,
-    0xD6, 0xB5, 0xBF, 0x75, 0x35, 0x9D, 0xC8, 0x49, 0x2F, 0xB5, 0xF0, 0x47, 0xBC, 0x54, 0x84, 0x7F,
-    0xB6, 0x1A, 0x49, 0x74, 0x3E, 0xFB, 0x64, 0xFE, 0x3C, 0x89, 0x3F, 0xC5, 0x44, 0x8E, 0x07, 0x5A,
-    0xDF, 0xD1, 0x7A, 0x6A, 0x5F, 0x7E, 0x55, 0xC6, 0x2A, 0x75, 0xF3, 0x5A, 0xDA, 0x7F, 0x73, 0xC3,
-    0xE1, 0x05, 0xAD, 0xF5, 0xCD, 0x66, 0x65, 0xE2, 0xA5, 0x36, 0x1A, 0x7B, 0x76, 0xDF, 0xE3, 0xEB,
-    0xAB, 0xB9, 0xA7, 0x1B, 0xD9, 0xD7, 0x43, 0x2A, 0x57, 0x26, 0xA2, 0xD0, 0xED, 0xAF, 0xB5, 0x6E,
-    0xF0, 0x5C, 0x76, 0x14, 0x02, 0x49, 0x88, 0x33, 0x19, 0x5C, 0xDD, 0x49, 0xA4, 0xE7, 0x64, 0xC7,
-    0x79, 0x78, 0x4A, 0xBE, 0xE9, 0x64, 0x87, 0x44, 0x9C, 0x4C, 0x66, 0x07, 0x34, 0x84, 0x83, 0xCE,
-    0xF0, 0xD1, 0x2B, 0x70, 0xB0, 0x2A, 0x7E, 0x51, 0xF3, 0x30, 0xE1, 0x61, 0xD4, 0x1E, 0xFC, 0x6D,
-    0x7C, 0xC4, 0xBD, 0x46, 0xC0, 0x12, 0xBF, 0x76, 0x81, 0x83, 0x87, 0x26, 0xE6, 0x92, 0x08, 0x27,
-    0x55, 0x27, 0xB8, 0x9C, 0xA7, 0x44, 0x96, 0x16, 0x7B, 0x6A, 0xCE, 0xCD, 0x50, 0xFE, 0x2D, 0xA4,
-    0xF2, 0xB7, 0x56, 0x5F, 0x28, 0x9C, 0x6C, 0x22, 0xD7, 0x03, 0x33, 0x41, 0x7C, 0x7E, 0x62, 0x66,
-    0x12, 0xD2, 0x1F, 0xFC, 0x60, 0xEB, 0xCB, 0x8E, 0x46, 0x93, 0xF3, 0x6F, 0xE3, 0x54, 0x47, 0xE1,
-    0x5B, 0x8D, 0x53, 0xC8, 0x5A, 0x20, 0x56, 0x0E, 0xE9, 0xCE, 0x65, 0xE6, 0x4E, 0x59, 0x5F, 0xB9,
-    0x02, 0xC1, 0x53, 0xF5, 0xF3, 0x0B, 0xE6, 0x23, 0x9E, 0x87, 0xEC, 0x72, 0xB6, 0x10, 0xEF, 0x5C,
-    0x29, 0x37, 0xBC, 0x66, 0xB5, 0x98, 0xE7, 0xE0, 0x8E, 0xE2, 0xBB, 0x3F, 0x89, 0x5C, 0x2C, 0xCE,
-    0xCF, 0x27, 0x03, 0xE9, 0xF5, 0xF9, 0xF3, 0x7C, 0x18, 0x49, 0x90, 0x8B, 0xD7, 0x40, 0xD2, 0x4C,
-    0xFC, 0x52, 0xEC, 0xFA, 0x1B, 0xB2, 0x54, 0x48, 0xBF, 0x94, 0xA5, 0x5A, 0xEA, 0xE4, 0x6A, 0x11,
-    0xE8, 0xD4, 0xBA, 0x20, 0x58, 0x84, 0xA9, 0x9F, 0x79, 0xE9, 0x67, 0xFD, 0x0F, 0x2A, 0x3D, 0x3D,
-    0xE1, 0xBD, 0x98, 0xD7, 0x4B, 0x2A, 0xE5, 0x58, 0xAD, 0xE1, 0xF9, 0x50, 0x47, 0xE3, 0x08, 0x43,
-    0x08, 0xE4, 0xF3, 0x0E, 0x49, 0x8E, 0xFB, 0xE6, 0x86, 0x91, 0x9E, 0x5A, 0x53, 0x8E, 0x79, 0xF2,
-    0x8F, 0x1C, 0xD0, 0x7C, 0x25, 0xBE, 0xB8, 0xB9, 0x5D, 0xCB, 0xBA, 0x74, 0x1A, 0x87, 0x79, 0xC7,
-    0x0A, 0xA3, 0x63, 0x7F, 0x6B, 0xCA, 0xC5, 0x88, 0x26, 0x07, 0x8E, 0x4A, 0xF6, 0x1F, 0x13, 0x1D,
-    0xE3, 0xB8, 0xBE, 0x5A, 0xCA, 0x71, 0x99, 0x58, 0xB5, 0x9C, 0xC2, 0xF5, 0x25, 0xE9, 0xE1, 0xD8,
-    0xC7, 0x02, 0xF3, 0x58, 0xE2, 0x38, 0xF9, 0x77, 0x05, 0xBE, 0xAD, 0x92, 0x74, 0xBE, 0x49, 0x8A,
-    0x24, 0x52, 0xBA, 0x89, 0x8E, 0xB4, 0x1D, 0x5E, 0xB0, 0xD0, 0xA3, 0xAE, 0x3D, 0xCE, 0x58, 0x66,
-    0xAD, 0x9B, 0xB5, 0x5A, 0xFA, 0x9C, 0x23, 0x64, 0xDB, 0x89, 0x78, 0xD4, 0x25, 0xAF, 0x58, 0xB5,
-    0xB9, 0x3E, 0xB8, 0xEF, 0xD8, 0x6F, 0xBF, 0x0D, 0x2A, 0x4B, 0x27, 0x05, 0xDB, 0xD7, 0x51, 0xAB,
-    0x4A, 0x46, 0x89, 0x15, 0x87, 0xE8, 0x6C, 0x61, 0x49, 0xA4, 0x50, 0xD1, 0xAB, 0xAD, 0x16, 0x3F,
-    0x21, 0xA5, 0x85, 0x1B, 0xFA, 0xBC, 0x4B, 0xF1, 0x6E, 0xE7, 0x63, 0x0C, 0x0E, 0xB3, 0x01, 0xF5,
-    0x1C, 0x48, 0x10, 0xE1, 0xA2, 0x93, 0x53, 0x71, 0x2B, 0x2A, 0x6B, 0xC8, 0x3B, 0x31, 0x83, 0xB8,
-    0x58, 0x88, 0x5F, 0xD9, 0x4D, 0x14, 0xEA, 0xB3, 0x3A, 0x87, 0x7A, 0x49, 0x6B, 0x42, 0x0A, 0xEA,
-    0xE7, 0x77, 0x9F, 0x8D, 0xC6, 0x46, 0xF3, 0x8E, 0x2E, 0xBC, 0xC2, 0xCF, 0xDC, 0xDA, 0x2E, 0x68,
-    0x09, 0x76, 0x8E, 0x75, 0x83, 0x66, 0xA5, 0xD7, 0xB1, 0x7A, 0x0B, 0xD0, 0x3D, 0x74, 0x14, 0xA0,
-    0x4B, 0xEF, 0x26, 0x74, 0xA7, 0x40, 0x07, 0x13, 0x97, 0x77, 0xDC, 0xC0, 0x1D, 0x2A, 0xB5, 0x0B,
-    0xAB, 0xB6, 0x75, 0x1C, 0x6C, 0xE8, 0xC2, 0xA6, 0xBD, 0x40, 0x03, 0x7F, 0x8F, 0xED, 0x0E, 0x78,
-    0xD0, 0x3C, 0xD0, 0x64, 0x30, 0x88, 0x59, 0x6F, 0x73, 0xC3, 0x50, 0xCB, 0xB8, 0xF1, 0x33, 0x59,
-    0x8C, 0xA1, 0xCA, 0x4B, 0xB4, 0xBC, 0x12, 0x5A, 0x12, 0x42, 0xF5, 0x9C, 0x3B, 0x51, 0x20, 0xFD,
-    0xBE, 0x4C, 0x9C, 0x0C, 0x97, 0xFA, 0xB0, 0xD2, 0x8D, 0x4C, 0x45, 0xC1, 0x00, 0x43, 0x4A, 0x72,
-    0x29, 0xED, 0x86, 0x86, 0x9B, 0x63, 0x6C, 0x78, 0xB0, 0x6F, 0x37, 0xF1, 0x7C, 0x33, 0x66, 0x5B,
-    0x72, 0x48, 0x22, 0x71, 0x52, 0x1F, 0xBD, 0x62, 0xD0, 0x16, 0x27, 0x06, 0xFA, 0xDC, 0x4E, 0x2B,
-    0xF4, 0xFA, 0xA2, 0xCE, 0x83, 0x06, 0x43, 0x0E, 0xA3, 0x01, 0x9E, 0x47, 0x57, 0x23, 0x51, 0x31,
-    0x66, 0x72, 0x62, 0x01, 0x03, 0x72, 0xCC, 0x6B, 0xE0, 0x62, 0x5E, 0xAA, 0xEB, 0x98, 0x9F, 0x77,
-    0xF1, 0x48, 0x08, 0x93, 0x33, 0x43, 0x31, 0x93, 0x8D, 0x99, 0xFA, 0x5A, 0x0F, 0x17, 0xB8, 0x4E,
-    0x41, 0xD6, 0xDA, 0xBC, 0x51, 0x8F, 0x97, 0x75, 0x3A, 0xD6, 0xD0, 0x8D, 0x31, 0x07, 0x40, 0xC0,
-    0x1B, 0x3C, 0xFA, 0x09, 0x10, 0x51, 0xFF, 0x88, 0x4A, 0x23, 0x16, 0x11, 0xC6, 0xA7, 0xC4, 0x85,
-    0xD1, 0xDF, 0xB6, 0xE7, 0xF6, 0x1F, 0x55, 0xD2, 0x31, 0xDF, 0xB3, 0xFF, 0x04, 0x6B, 0xEF, 0xFC,
-    0x0A, 0x27, 0xA7, 0xA8, 0x11, 0x05, 0x04, 0x75, 0x5F, 0xC3, 0x97, 0x7D, 0xE8, 0x80, 0x55, 0xA0,
-    0x65, 0xEF, 0xAD, 0xC5, 0x08, 0x68, 0xD8, 0x88, 0xBD, 0xB3, 0x52, 0x63, 0x0C, 0x56, 0x49, 0x58,
-    0x2B, 0xF0, 0x35, 0x4C, 0x38, 0x97, 0xE4, 0x03, 0x9D, 0x29, 0x9D, 0x41, 0xDB, 0xA0, 0x6C, 0x15,
-    0x80, 0x0A, 0xC6, 0x73, 0xDD, 0x4B, 0x5D, 0xC8, 0x73, 0x78, 0x86, 0xB0, 0x7A, 0x5B, 0xD6, 0x93,
-    0x0A, 0x36, 0x0F, 0x04, 0x0B, 0x01, 0xC9, 0x00, 0xEF, 0x00, 0x8B, 0x93, 0x4F, 0xA4, 0x0E, 0xEE,
-    0x6A, 0x60, 0xBF, 0x71, 0x03, 0x73, 0x2B, 0xE7, 0xD1, 0x44, 0xEA, 0xDF, 0x4C, 0xA0, 0x32, 0xD0,
-    0x7A, 0x85, 0x96, 0xF8, 0x87, 0x0A, 0xE4, 0x61, 0x0D, 0x12, 0x9A, 0x82, 0x0F, 0x38, 0xEF, 0xB7,
-    0xCF, 0xC2, 0x00, 0xDC, 0x0C, 0xB6, 0x88, 0x26, 0x54, 0xA7, 0xF6, 0x90, 0x02, 0xB8, 0xFD, 0x7E,
-    0xB3, 0x52, 0x06, 0xBC, 0xCB, 0x7B, 0xA1, 0x20, 0xFC, 0x1F, 0x7E, 0x30, 0x4E, 0x76, 0x1F, 0x82,
-    0x6D, 0x8C, 0x2E, 0x6E, 0x31, 0x01, 0xED, 0x4C, 0xE5, 0x18, 0x5C, 0x8E, 0x5C, 0xC7, 0x12, 0x7A,
-    0xD1, 0x48, 0xE4, 0x1A, 0x4E, 0x14, 0x46, 0x2C, 0x45, 0x77, 0x62, 0xE5, 0x38, 0x39, 0xC5, 0x39,
-    0x48, 0x71, 0xD2, 0xC3, 0x89, 0x17, 0xE1, 0x84, 0x5A, 0x70, 0x5A, 0xDC, 0x94, 0x4B, 0xF0, 0x1F,
-    0xB8, 0x04, 0xB0, 0x62, 0xE7, 0x37, 0x98, 0x80, 0x01, 0x57, 0xFB, 0x67, 0x38, 0x79, 0xEE, 0x04,
-    0x24, 0x4C, 0x1F, 0x83, 0xC3, 0x9B, 0x87, 0xCE, 0xC3, 0x17, 0x95, 0x4A, 0xA7, 0x61, 0x04, 0x7D,
-    0x8D, 0x42, 0x28, 0xA1, 0x47, 0x75, 0x3D, 0x65, 0x17, 0x58, 0x6A, 0x27, 0x9D, 0x78, 0x98, 0x8E,
-    0xEB, 0x81, 0x43, 0xF3, 0xF4, 0x6E, 0x61, 0x95, 0x2D, 0x7D, 0x97, 0x0B, 0x6E, 0x6C, 0x5C, 0x46,
-    0x01, 0x9B, 0xC5, 0xF4, 0xC1, 0x15, 0x85, 0x76, 0x81, 0x39, 0xF0, 0xA3, 0x09, 0x14, 0x42, 0xA5,
-    0x01, 0xF0, 0x51, 0xC1, 0x6E, 0x54, 0xA6, 0x72, 0xE0, 0xFB, 0xD4, 0xCF, 0xD1, 0x87, 0xFF, 0x7E,
-    0xD4, 0xFA, 0xA6, 0xEF, 0x5D, 0x86, 0x64, 0x99, 0xCA, 0xC6, 0x18, 0x6C, 0xF5, 0x34, 0x74, 0xDE,
-    0x40, 0x04, 0xBA, 0x85, 0x2E, 0x84, 0x70, 0x7A, 0x1A, 0x5D, 0x8C, 0xD1, 0x32, 0x55, 0x28, 0x8B,
-    0x64, 0xA9, 0x2F, 0xDE, 0x06, 0xAC, 0x39, 0xF8, 0xDB, 0xC4, 0xC0, 0xE7, 0xD1, 0x08, 0x7A, 0x2E,
-    0xF0, 0x67, 0x85, 0xAB, 0xDF, 0x9F, 0xCA, 0x7C, 0x85, 0x35, 0x70, 0xD1, 0x19, 0xEC, 0x28, 0x10,
-    0x67, 0x8A, 0x71, 0x0E, 0x60, 0xA4, 0xCE, 0xCF, 0x70, 0xA9, 0x0F, 0x8B, 0x74, 0x32, 0xD8, 0x2D,
-    0x60, 0xD5, 0xFE, 0x4D, 0x0E, 0x23, 0x6D, 0x68, 0xA4, 0x39, 0xEC, 0x16, 0xD0, 0x49, 0xEB, 0x76,
-    0xB2, 0xE0, 0xB6, 0x2C, 0x7E, 0xC4, 0xB6, 0x72, 0x63, 0xAE, 0x66, 0x7D, 0x9C, 0x1C, 0x68, 0xE2,
-    0x52, 0x8E, 0x99, 0xBD, 0x7E, 0x35, 0x00, 0x81, 0x71, 0x7C, 0x07, 0x8D, 0x26, 0xF0, 0x3F, 0x63,
-    0x4C, 0x1A, 0x06, 0x9A, 0x9E, 0x16, 0x33, 0xF7, 0x9C, 0xF9, 0xC0, 0x01, 0xB6, 0xDD, 0x81, 0x8E,
-    0xD1, 0x0B, 0x4F, 0x7C, 0x5E, 0x20, 0xFA, 0x2D, 0xE3, 0x0E, 0x8F, 0xC4, 0xA0, 0x86, 0xDA, 0xF9,
-    0x70, 0x7F, 0x76, 0x8D, 0x36, 0x02, 0x4C, 0x98, 0x75, 0x7E, 0x4F, 0xFB, 0xFC, 0x7B, 0xB4, 0xEF,
-    0xFA, 0x41, 0xED, 0x33, 0x27, 0xC7, 0x71, 0x62, 0x67, 0x9D, 0xF6, 0xB9, 0x54, 0x43, 0xD8, 0xA4,
-    0xBB, 0x88, 0xD3, 0x24, 0xB5, 0xF4, 0x9B, 0xA5, 0xE8, 0xA9, 0x71, 0x3B, 0x73, 0x98, 0x04, 0x30,
-    0x99, 0x4A, 0x54, 0x23, 0x01, 0x07, 0x0C, 0x69, 0x31, 0x24, 0xEB, 0x4E, 0xA4, 0xF0, 0xDC, 0xA2,
-    0xFC, 0x8B, 0x42, 0x4E, 0x8D, 0xEC, 0x5F, 0xA4, 0x72, 0xAD, 0x54, 0x4A, 0x9C, 0x5B, 0xF9, 0x42,
-    0x4F, 0x94, 0x7B, 0x0B, 0x7A, 0xD1, 0x53, 0x2F, 0x01, 0xB9, 0x8B, 0xD3, 0xAF, 0x02, 0xF6, 0xD3,
-    0x41, 0x3A, 0xC0, 0x2A, 0x6B, 0x59, 0x93, 0x57, 0x6D, 0xCC, 0x92, 0x95, 0x3B, 0xF4, 0xDE, 0x9B,
-    0x73, 0xB4, 0x7D, 0x68, 0x8D, 0x4E, 0xB9, 0xAC, 0x7F, 0xD0, 0x2D, 0xEB, 0x1C, 0x97, 0xD5, 0x40,
-    0x92, 0xE2, 0x6C, 0x13, 0x97, 0xA4, 0xBB, 0x04, 0xA3, 0x88, 0xA1, 0xC2, 0xCD, 0xBE, 0x4B, 0xF7,
-    0xDF, 0x15, 0x54, 0xBB, 0xCB, 0x3A, 0xFF, 0x97, 0xC4, 0x0E, 0x2C, 0xC1, 0xF6, 0xB1, 0x5A, 0xE0,
-    0xE9, 0x0B, 0xF8, 0xA6, 0x10, 0x14, 0xC5, 0xAA, 0x61, 0x5B, 0xEA, 0xA7, 0xD4, 0x34, 0x9A, 0xC8,
-    0xBB, 0xB4, 0x11, 0xE8, 0x9C, 0xF7, 0x53, 0x28, 0x7A, 0xBD, 0x8C, 0xAF, 0x2E, 0x81, 0x04, 0x95,
-    0x61, 0x0C, 0xDF, 0xD5, 0x60, 0xA2, 0x5D, 0x90, 0x19, 0xB4, 0x83, 0xB5, 0x98, 0x3B, 0x6F, 0x6C,
-    0x8F, 0x94, 0xCA, 0xD0, 0xC3, 0xAB, 0x54, 0x03, 0x52, 0x11, 0x2C, 0x48, 0x40, 0x43, 0x9B, 0x60,
-    0x89, 0x1E, 0xE1, 0x12, 0x64, 0x4D, 0x7E, 0xAC, 0x0B, 0xCC, 0x40, 0x8B, 0x5D, 0x19, 0xB0, 0x0B,
-    0xA0, 0x55, 0xF3, 0xE6, 0x89, 0x8C, 0xDA, 0x3F, 0xF8, 0x04, 0xB3, 0x4A, 0x32, 0x0F, 0x23, 0xBA,
-    0x87, 0x75, 0x1A, 0xFC, 0xD9, 0xC6, 0xFC, 0x01, 0x98, 0xE7, 0xFE, 0x13, 0xD4, 0xB6, 0x76, 0xB6,
-    0x5F, 0x4E, 0x6B, 0xE9, 0xF9, 0xE2, 0x6C, 0xE4, 0x72, 0x72, 0x69, 0xF7, 0x2E, 0xD5, 0x1A, 0x15,
-    0x3F, 0xDD, 0x80, 0x7E, 0x43, 0xBD, 0x31, 0x38, 0x4B, 0x47, 0xF3, 0xAE, 0x06, 0x52, 0x60, 0x64,
-    0x50, 0xA0, 0xA3, 0x2D, 0x02, 0xEB, 0x8D, 0xAD, 0x64, 0xA5, 0x28, 0x54, 0xDC, 0xEB, 0x39, 0xB9,
-    0x7A, 0x02, 0x93, 0x1A, 0x19, 0xD7, 0xA9, 0x62, 0x63, 0xA6, 0x42, 0x8B, 0xFD, 0xEC, 0x0B, 0xC7,
-    0x76, 0xD0, 0x34, 0x28, 0xCA, 0x57, 0xE3, 0xE5, 0xC4, 0xE7, 0xC7, 0xE4, 0xB2, 0x18, 0xEF, 0x34,
-    0x9F, 0xFC, 0x1F, 0x8C, 0x19, 0xF4, 0xBD, 0xF2, 0xDD, 0x6A, 0x19, 0xAE, 0xE6, 0x97, 0x40, 0xB0,
-    0x41, 0x6D, 0x15, 0x8E, 0x8E, 0x7D, 0xE0, 0x09, 0x4E, 0x3E, 0xCE, 0x7C, 0x99, 0x84, 0x67, 0x8A,
-    0x20, 0xD6, 0xAB, 0xAB, 0x99, 0x05, 0xF0, 0x69, 0x7D, 0x1A, 0x5C, 0x10, 0x86, 0x5F, 0x92, 0xE4,
-    0x98, 0xDF, 0xE1, 0x59, 0x5D, 0x04, 0x53, 0xB7, 0x94, 0x65, 0x2C, 0x37, 0xC6, 0x71, 0x83, 0x9A,
-    0x54, 0xC0, 0x58, 0xFC, 0x77, 0xD9, 0x21, 0x84, 0x71, 0x28, 0x19, 0x4D, 0xCD, 0x85, 0x75, 0xC9,
-    0x27, 0x78, 0xB4, 0x8F, 0x49, 0xF5, 0xE2, 0x10, 0xA2, 0xD8, 0x15, 0x19, 0x4E, 0x16, 0x6C, 0x5A,
-    0xF0, 0x9D, 0x69, 0xA2, 0xE9, 0x8C, 0x01, 0x52, 0xBE, 0xBE, 0x39, 0x95, 0xAF, 0x73, 0xA1, 0x55,
-    0x6C, 0x1C, 0x6C, 0xC0, 0xB9, 0xA2, 0x97, 0x7D, 0x84, 0x4B, 0xF4, 0x06, 0x3F, 0xD6, 0x2D, 0xD1,
-    0x34, 0x44, 0x9B, 0x26, 0xDC, 0xFA, 0x64, 0x87, 0x4E, 0xEF, 0xC9, 0x8E, 0x54, 0xCC, 0xC1, 0xFD,
-    0x9F, 0xD5, 0xEF, 0xAF, 0x03, 0xA2, 0x60, 0x71, 0x19, 0x6C, 0xAF, 0xC4, 0xFF, 0x3E, 0x05, 0x8B,
-    0x54, 0x8C, 0x0B, 0xFC, 0x38, 0x06, 0x53, 0x75, 0xE9, 0xE9, 0x8E, 0x9E, 0xCD, 0xBA, 0x40, 0xA2,
-    0xDF, 0x4D, 0x38, 0xC3, 0x11, 0xB7, 0x89, 0xA8, 0x4C, 0xC3, 0x0B, 0x6C, 0x2E, 0x84, 0x4F, 0x7C,
-    0x43, 0xBF, 0x57, 0x63, 0x4A, 0x88, 0x7A, 0x6C, 0x83, 0x5E, 0xD3, 0x60, 0x27, 0xC7, 0x0B, 0xB0,
-    0x35, 0xA8, 0xF6, 0xC5, 0xBE, 0xE0, 0xB0, 0x74, 0xC3, 0x10, 0x09, 0x4A, 0xFF, 0xBB, 0xEB, 0x70,
-    0x6C, 0x3A, 0x2C, 0xCC, 0x9C, 0xB5, 0xC1, 0xDE, 0x69, 0x73, 0xF4, 0x0C, 0x7F, 0xB0, 0x32, 0xF3,
-    0xE1, 0x9F, 0xEF, 0xF2, 0xDF, 0xD6, 0xDF, 0x81, 0xFE, 0x62, 0x5E, 0x78, 0x7F, 0x8F, 0xA4, 0xE7,
-    0xB2, 0x09, 0x36, 0xC2, 0x59, 0x13, 0x26, 0x84, 0x53, 0x5B, 0x9A, 0x97, 0xC6, 0xBC, 0x84, 0xA5,
-    0x2B, 0xA0, 0x5F, 0x88, 0x27, 0x33, 0x5C, 0xC2, 0x92, 0xD5, 0xD0, 0x8F, 0x63, 0x3B, 0xF0, 0x5F,
-    0x5A, 0x6F, 0x4A, 0x47, 0xE6, 0x11, 0xAB, 0xBC, 0x84, 0x25, 0x65, 0x7C, 0x23, 0xD6, 0x0D, 0x9A,
-    0xA8, 0x4B, 0x7C, 0x30, 0x91, 0xC0, 0x81, 0x53, 0x58, 0xE7, 0x88, 0x71, 0x03, 0xAF, 0xAA, 0x94,
-    0x57, 0x97, 0x78, 0xEA, 0xE4, 0x26, 0x6A, 0xE0, 0xA9, 0xCB, 0xAB, 0x56, 0x0D, 0xEA, 0xF0, 0xB1,
-    0xB6, 0xF5, 0x0F, 0x10, 0x33, 0xE8, 0xE9, 0x6E, 0x47, 0xC0, 0x16, 0x43, 0xD3, 0xEE, 0x43, 0x0E,
-    0x0F, 0x37, 0xAD, 0x5F, 0xFD, 0x47, 0x49, 0x95, 0x7C, 0x2F, 0x92, 0xB1, 0xCE, 0x9D, 0xED, 0xC5,
-    0x52, 0x01, 0x39, 0x7A, 0x88, 0x82, 0xAE, 0x19, 0x3C, 0x01, 0x96, 0xC2, 0x15, 0x26, 0xBA, 0x42,
-    0x18, 0x98, 0x93, 0x01, 0xF0, 0x23, 0x80, 0x0D, 0x73, 0xF5, 0x66, 0x0C, 0xAB, 0x8B, 0xBC, 0x7C,
-    0x0C, 0x57, 0x34, 0x46, 0x33, 0x56, 0x64, 0x44, 0x41, 0x3C, 0x09, 0x7F, 0xE5, 0xEB, 0x1C, 0x5E,
-    0x2F, 0xF8, 0x73, 0x4D, 0x34, 0x8C, 0x3C, 0xF2, 0x8E, 0x48, 0xA6, 0xF0, 0x7D, 0x90, 0x33, 0x9E,
-    0x30, 0x70, 0x28, 0x02, 0xDA, 0xE7, 0xC4, 0xDB, 0x22, 0xCD, 0x47, 0x04, 0x4A, 0x91, 0x27, 0x86,
-    0x72, 0x05, 0x36, 0xBE, 0xA8, 0xE9, 0x09, 0x65, 0xD0, 0x3E, 0x11, 0x4D, 0x30, 0xBB, 0xE4, 0x1D,
-    0x61, 0x8C, 0xE3, 0x6D, 0xA7, 0x49, 0x52, 0xFA, 0xC4, 0x56, 0xF6, 0x23, 0xED, 0x3A, 0x32, 0x8A,
-    0xE5, 0x00, 0x62, 0xA7, 0xE8, 0xEC, 0x62, 0x04, 0xED, 0xF0, 0xA5, 0x33, 0x94, 0x1B, 0xB8, 0xC0,
-    0xC9, 0x80, 0xA8, 0x70, 0x0F, 0xB8, 0xE0, 0x47, 0x5C, 0x3E, 0x06, 0x2D, 0x0A, 0x83, 0x60, 0x64,
-    0x3E, 0xDF, 0xBC, 0x08, 0x98, 0x7C, 0xBF, 0x8B, 0x8C, 0xAC, 0x24, 0xB7, 0x77, 0xD6, 0xA5, 0x54,
-    0x69, 0x8F, 0x38, 0x34, 0xA2, 0x61, 0x1E, 0xD3, 0x69, 0xB0, 0x05, 0x26, 0x04, 0xCC, 0xF6, 0x29,
-    0xD9, 0x78, 0x55, 0xBF, 0xD9, 0x04, 0xE9, 0x91, 0x8E, 0x31, 0x7F, 0x1B, 0xEB, 0x58, 0xA8, 0x8F,
-    0x4B, 0x98, 0x1A, 0x06, 0x82, 0x3E, 0xF8, 0xE0, 0x5F, 0x13, 0x20, 0xB5, 0xCA, 0xDD, 0xDF, 0x00,
-    0xD8, 0x31, 0x8A, 0x65, 0x71, 0xE0, 0xF4, 0xFF, 0x01, 0x81, 0xF0, 0x92, 0xF8, 0xE8, 0xFC, 0xB5,
-    0x66, 0x31, 0xF5, 0xC9, 0x7B, 0x88, 0xA9, 0xA0, 0x53, 0x49, 0xD4, 0x47, 0xD3, 0xD1, 0xC8, 0x01,
-    0xAA, 0x6D, 0xBF, 0x4C, 0x9C, 0x55, 0x67, 0x6E, 0x38, 0x99, 0x8A, 0x4B, 0xC2, 0x69, 0x19, 0xFC,
-    0x39, 0xE8, 0x00, 0x6D, 0x1A, 0xDF, 0x4C, 0x03, 0x3D, 0x75, 0xF2, 0x53, 0x4E, 0xFE, 0x9C, 0x93,
-    0x3F, 0xCB, 0x39, 0xBD, 0xF7, 0xC7, 0xDB, 0xC1, 0x3D, 0x11, 0x16, 0xAE, 0x5D, 0xBC, 0x1E, 0xF4,
-    0x9F, 0xBF, 0x0B, 0xDD, 0xEF, 0x2B, 0xF8, 0xBD, 0x86, 0xDF, 0xC2, 0x8B, 0xAD, 0xDC, 0x8B, 0xE1,
-    0xAD, 0x63, 0x7F, 0x27, 0xB9, 0x0D, 0xEB, 0x99, 0x62, 0xB0, 0xBD, 0x5E, 0xF7, 0x8B, 0x48, 0xEC,
-    0xE4, 0x61, 0x01, 0x79, 0x12, 0xC6, 0xF2, 0x4D, 0xA2, 0xE2, 0x01, 0x34, 0x35, 0xB7, 0x8C, 0x91,
-    0x35, 0xA5, 0xE9, 0x08, 0x4B, 0x04, 0xB7, 0xA7, 0x2B, 0xAC, 0x88, 0x75, 0xBE, 0x9D, 0x8B, 0xC0,
-    0xD2, 0x69, 0x1D, 0xDC, 0x5C, 0x3F, 0x5B, 0x5B, 0x79, 0xCF, 0x45, 0x4F, 0x3D, 0xD0, 0x9E, 0x85,
-    0xDE, 0x29, 0xB0, 0xCF, 0xA5, 0x57, 0x19, 0xD8, 0x61, 0xD9, 0x47, 0x3D, 0x00, 0x53, 0x05, 0x47,
-    0x66, 0x15, 0x3D, 0x98, 0x2F, 0xEE, 0xCB, 0x54, 0xBA, 0x6C, 0x17, 0x63, 0x47, 0xA7, 0x86, 0x9A,
-    0x98, 0x4E, 0xF5, 0x99, 0x1D, 0xFD, 0x24, 0xB5, 0x0E, 0x7D, 0xA5, 0x73, 0x13, 0x12, 0x15, 0xAB,
-    0x12, 0xFB, 0xEF, 0x23, 0x38, 0x94, 0x41, 0xF8, 0x17, 0x45, 0xD8, 0xC8, 0x1C, 0x96, 0x14, 0x41,
-    0xED, 0x8B, 0x53, 0x84, 0x84, 0x58, 0x51, 0xA2, 0x61, 0x8A, 0x29, 0x2B, 0xA4, 0xF4, 0x7B, 0xD2,
-    0xF7, 0x71, 0xE1, 0x8F, 0x9C, 0xD4, 0x69, 0x00, 0xA8, 0x0D, 0xC8, 0x10, 0xF0, 0x42, 0x82, 0xCB,
-    0x5E, 0x15, 0xD6, 0x0A, 0xBA, 0xF0, 0x0A, 0x10, 0xF6, 0xB4, 0x45, 0x8E, 0x09, 0x17, 0x37, 0xDE,
-    0xCD, 0xB1, 0xC0, 0xE4, 0xD3, 0xA4, 0x4C, 0xB2, 0xA0, 0x22, 0xC3, 0x41, 0xDF, 0x35, 0xB4, 0x49,
-    0x8B, 0x3A, 0xF3, 0x9B, 0xD4, 0x79, 0xAF, 0x28, 0xE4, 0xB7, 0x79, 0x4F, 0xC2, 0x1C, 0x2D, 0x83,
-    0xE6, 0x60, 0x0A, 0x0A, 0x7B, 0x5B, 0x92, 0x4B, 0x3A, 0x6D, 0x97, 0x06, 0x6E, 0xE1, 0x05, 0x1D,
-    0x4D, 0xA1, 0x3C, 0xD0, 0x82, 0xEB, 0xA2, 0xCE, 0xC6, 0x82, 0x49, 0xC3, 0x65, 0x71, 0xFE, 0x06,
-    0x78, 0x0F, 0x5C, 0xEE, 0x93, 0x8D, 0xA9, 0xD4, 0x2B, 0x55, 0x8C, 0x9B, 0x61, 0x68, 0x73, 0xCC,
-    0x10, 0x81, 0xAB, 0x6B, 0x2C, 0x44, 0x29, 0x4F, 0xA3, 0xD3, 0x05, 0xA8, 0x11, 0x56, 0xDC, 0x85,
-    0x9E, 0x9E, 0xA4, 0x0C, 0x2A, 0x72, 0xE3, 0xBE, 0x3D, 0x82, 0x0A, 0xE4, 0x5E, 0xB5, 0x2E, 0xBA,
-    0xA4, 0xA2, 0x82, 0x48, 0x27, 0xAF, 0x83, 0xF5, 0x96, 0xAA, 0xB0, 0xA7, 0x72, 0x37, 0xFE, 0x97,
-    0x99, 0xEA, 0x79, 0x7D, 0xF9, 0x24, 0xFB, 0x20, 0x53, 0xFE, 0xC9, 0xBE, 0x14, 0x9F, 0x5E, 0xCA,
-    0x94, 0x5B, 0xE0, 0x64, 0x80, 0x09, 0xB1, 0xD2, 0x3E, 0xE4, 0x74, 0x2B, 0x0D, 0xEF, 0x99, 0x72,
-    0xF8, 0x2F, 0x36, 0xF0, 0xBD, 0x83, 0x99, 0xF7, 0x00, 0xA8, 0xCA, 0xF6, 0x70, 0x89, 0x49, 0xAD,
-    0x48, 0xBD, 0xF5, 0x07, 0xED, 0x05, 0x62, 0xAC, 0x41, 0x58, 0xF4, 0x1A, 0x4E, 0x55, 0x1B, 0x41,
-    0x61, 0x9E, 0x74, 0xC2, 0xA8, 0x6A, 0x24, 0xC1, 0x22, 0x14, 0x1A, 0xB0, 0x97, 0x1B, 0x06, 0x99,
-    0x08, 0xDC, 0x31, 0xC3, 0xC3, 0x2A, 0xF8, 0xDB, 0xDA, 0x02, 0xAA, 0x81, 0x4C, 0xD1, 0x01, 0x90,
-    0xD5, 0x45, 0xE4, 0x87, 0x2A, 0x76, 0x31, 0x5F, 0x16, 0xB1, 0x7B, 0x24, 0x0F, 0xBC, 0x10, 0xE4,
-    0xFE, 0x6D, 0x76, 0x64, 0x56, 0x61, 0xDD, 0xAF, 0x54, 0xA3, 0x6B, 0x1B, 0xFE, 0xDF, 0xCD, 0x9C,
-    0xC2, 0x87, 0xAE, 0x8D, 0xC4, 0x3F, 0x53, 0x10, 0x1E, 0xAD, 0xEE, 0xE3, 0x00, 0xCE, 0xB9, 0x70,
-    0x61, 0x38, 0x00, 0x1D, 0xDA, 0x29, 0xAD, 0x8E, 0xA4, 0xC3, 0x27, 0xB3, 0xC8, 0xE4, 0x9F, 0xAC,
-    0x18, 0x91, 0x5D, 0x1D, 0xAD, 0x27, 0x2F, 0xA6, 0x88, 0xB3, 0xFE, 0x8A, 0x2E, 0x97, 0x64, 0xA6,
-    0x62, 0x7C, 0xEB, 0x31, 0xD5, 0x42, 0x7D, 0xF4, 0x75, 0x6A, 0x19, 0x61, 0x37, 0xE0, 0x0F, 0x7A,
-    0xBE, 0xB3, 0xF1, 0x5A, 0xD1, 0x5B, 0xF0, 0xED, 0x98, 0xCD, 0xF9, 0x6D, 0xAB, 0x7B, 0x7F, 0xE0,
-    0x45, 0x99, 0x3D, 0x1B, 0x57, 0x41, 0xA5, 0x2F, 0x2F, 0x42, 0x75, 0x60, 0xB4, 0xA0, 0x22, 0x88,
-    0x0A, 0xBC, 0xB4, 0x27, 0xBE, 0x9D, 0xCB, 0x00, 0xFA, 0x3E, 0x82, 0xA6, 0x7F, 0x0A, 0x48, 0x63,
-    0xFE, 0xAF, 0x6C, 0x31, 0x19, 0x1A, 0x6F, 0xE5, 0xA6, 0x89, 0x1D, 0x68, 0x03, 0x06, 0xE9, 0xB6,
-    0x01, 0x37, 0x13, 0x7C, 0xB8, 0xC5, 0xBE, 0xB1, 0xCF, 0x55, 0xCF, 0x7C, 0xB7, 0x0D, 0xDC, 0xF2,
-    0x98, 0xE2, 0xC9, 0xCA, 0xF1, 0xD9, 0xAC, 0xEF, 0x7C, 0x42, 0x7C, 0x80, 0x5E, 0x02, 0x4B, 0x4A,
-    0xE7, 0x57, 0xD0, 0xF8, 0x4F, 0x79, 0x61, 0x09, 0xFE, 0x4F, 0x65, 0x08, 0x69, 0x75, 0xA2, 0x23,
-    0xD7, 0xE4, 0x1C, 0x0F, 0xFA, 0xFF, 0x00, 0x17, 0x9F, 0xC4, 0x74, 0x84, 0x55, 0x58, 0xEA, 0x2C,
-    0x89, 0xF1, 0xBC, 0x2C, 0x91, 0xAC, 0x5D, 0x6F, 0x03, 0x7C, 0x86, 0x64, 0xB0, 0x80, 0x1E, 0x26,
-    0xE6, 0x66, 0xC9, 0x21, 0xB9, 0xA5, 0x5B, 0xC1, 0x0A, 0xCA, 0x10, 0xB3, 0xE3, 0x35, 0x0E, 0x97,
-    0x30, 0x30, 0x14, 0xC6, 0x10, 0x97, 0xCA, 0x38, 0xDF, 0x07, 0x5C, 0x08, 0xB6, 0x92, 0x8A, 0xAB,
-    0x3E, 0x1B, 0x07, 0x7D, 0xF1, 0x49, 0xAE, 0x81, 0x19, 0x69, 0x52, 0x24, 0x9F, 0xE8, 0xD7, 0x75,
-    0x54, 0x61, 0xC2, 0x10, 0x25, 0x2B, 0xF0, 0x38, 0x40, 0xAA, 0x8C, 0xBF, 0x5D, 0x00, 0x9C, 0x53,
-    0x99, 0xF3, 0x5B, 0xFE, 0xC3, 0x99, 0x3E, 0x06, 0x43, 0x07, 0x69, 0xAB, 0xC6, 0xBF, 0xD6, 0xB7,
-    0xF4, 0xB9, 0xDA, 0x2F, 0x31, 0x68, 0x83, 0xEB, 0x88, 0x6F, 0x1E, 0xF2, 0x34, 0x59, 0xD9, 0x59,
-    0xBD, 0x6D, 0x38, 0x48, 0xFA, 0xA5, 0xDB, 0x31, 0x83, 0xD2, 0x66, 0xC1, 0x4C, 0x5E, 0xCC, 0x0C,
-    0xCE, 0x8C, 0x4C, 0x2C, 0x13, 0xB2, 0x1F, 0x22, 0x36, 0x87, 0x04, 0x5B, 0xA2, 0x1D, 0x7E, 0x9F,
-    0x67, 0x4E, 0x45, 0xE9, 0xCB, 0xA2, 0xEE, 0x94, 0x26, 0x4B, 0xA8, 0x00, 0x40, 0xED, 0x2F, 0x1C,
-    0xF1, 0x55, 0xC4, 0x60, 0xAD, 0x13, 0x0B, 0x11, 0x22, 0x4E, 0x11, 0x28, 0x84, 0x90, 0x4C, 0xD8,
-    0xE5, 0xEE, 0xE1, 0xEE, 0x26, 0x0E, 0xBA, 0xE1, 0xC7, 0xC0, 0xC8, 0x72, 0x6E, 0x76, 0xF0, 0x41,
-    0x0B, 0x76, 0xA6, 0xB0, 0x4A, 0xBD, 0x19, 0xB6, 0x54, 0x00, 0x7F, 0x80, 0xD1, 0x94, 0x0D, 0x8B,
-    0x4A, 0xE1, 0xA0, 0x38, 0xE1, 0x1D, 0x28, 0xC7, 0x12, 0x35, 0xB3, 0x64, 0xAC, 0x5C, 0x04, 0x5B,
-    0x55, 0xE7, 0x40, 0xC4, 0xD8, 0x87, 0xBF, 0x5A, 0x9E, 0xE0, 0xC2, 0x2F, 0x91, 0xDF, 0x0F, 0xC7,
-    0x10, 0x48, 0x8E, 0x80, 0x2F, 0x0D, 0x8E, 0x48, 0xBF, 0x07, 0x07, 0x7F, 0x15, 0x71, 0x4B, 0x2C,
-    0x5D, 0x98, 0x0C, 0xA3, 0x1C, 0x97, 0xC0, 0xD8, 0xF5, 0x24, 0x56, 0xF1, 0xC4, 0x36, 0x1E, 0x69,
-    0x20, 0x15, 0xCD, 0x70, 0x70, 0x11, 0xF6, 0xA8, 0x80, 0x70, 0x23, 0xE7, 0xC3, 0x09, 0xD4, 0xBB,
-    0xBD, 0x08, 0x9B, 0xCD, 0x55, 0x0C, 0x92, 0xEE, 0x55, 0xFE, 0xFF, 0x04, 0xBA, 0x9D, 0x31, 0x3D,
-    0x33, 0xC0, 0xFA, 0x96, 0x06, 0x5B, 0x83, 0x4D, 0x9B, 0xA0, 0x1A, 0xA1, 0xBC, 0x2C, 0x23, 0x7A,
-    0xD0, 0x37, 0x60, 0xA6, 0x99, 0xAC, 0xC1, 0x6F, 0x13, 0x8E, 0xFA, 0x60, 0x01, 0x55, 0xE8, 0xE8,
-    0xF7, 0xA0, 0x47, 0x96, 0x20, 0x9E, 0x65, 0x5C, 0x33, 0x35, 0xBC, 0xE6, 0xCF, 0x66, 0xF2, 0xC7,
-    0xE1, 0xEA, 0x46, 0xAE, 0x7E, 0x24, 0xC1, 0x9A, 0xB4, 0xBC, 0xEF, 0x06, 0xED, 0x9A, 0x39, 0x03,
-    0x46, 0x73, 0x0D, 0xC3, 0x29, 0x70, 0x12, 0xB9, 0xBC, 0xAC, 0xD2, 0x2A, 0x94, 0xE8, 0x70, 0xE7,
-    0x9D, 0x2A, 0x67, 0xA7, 0x1E, 0xC8, 0x76, 0x61, 0xDF, 0x8D, 0x5D, 0xF3, 0xD8, 0xDD, 0x8C, 0xA0,
-    0x00, 0x22, 0x07, 0x7A, 0x97, 0xE8, 0x3C, 0x31, 0x4E, 0x85, 0xD9, 0xDF, 0x48, 0xE6, 0xA7, 0xAD,
-    0x19, 0x7D, 0x7F, 0xE7, 0x8A, 0xC5, 0x2C, 0x7E, 0xBF, 0xFD, 0xE8, 0xFC, 0x8F, 0x29, 0x26, 0xA4,
-    0x91, 0xF0, 0x87, 0x00, 0x7A, 0x0B, 0xE6, 0xE8, 0x14, 0xB4, 0xFE, 0x3E, 0x1A, 0x01, 0xF7, 0x70,
-    0x32, 0x8B, 0x1F, 0x6F, 0x26, 0x71, 0xE0, 0x33, 0x26, 0x36, 0xCB, 0xE1, 0xB7, 0x81, 0x14, 0x70,
-    0x80, 0x6D, 0xAA, 0x96, 0x7A, 0xD9, 0x58, 0xE6, 0x8C, 0x64, 0x0B, 0xB3, 0xBE, 0xD0, 0xAD, 0xCB,
-    0x43, 0xFA, 0x76, 0xEA, 0x9D, 0xCE, 0xD5, 0x56, 0x7D, 0x5A, 0x46, 0x23, 0x59, 0x40, 0x2F, 0xD5,
-    0x51, 0x2E, 0xE0, 0xF6, 0x90, 0xDD, 0x60, 0x9A, 0x98, 0x83, 0xD7, 0x35, 0x53, 0x1D, 0x47, 0x5B,
-    0xD8, 0xF6, 0x2F, 0xFE, 0x2C, 0x3D, 0xD5, 0x93, 0x8D, 0x52, 0x82, 0x52, 0x12, 0xFC, 0xDC, 0x94,
-    0xF5, 0x3F, 0xB3, 0x3F, 0x8A, 0x4F, 0x2F, 0x5F, 0xDC, 0xD0, 0x85, 0x71, 0xDE, 0x6E, 0xEE, 0x15,
-    0x1D, 0x28, 0xC9, 0xB1, 0x7C, 0x9C, 0x3B, 0xF7, 0xFD, 0xF7, 0xB6, 0xC7, 0xCD, 0x33, 0xF6, 0xD9,
-    0xA2, 0x06, 0xA1, 0xEC, 0x66, 0x74, 0xBE, 0xB2, 0xA0, 0x26, 0x15, 0xC7, 0x74, 0xDF, 0x21, 0xD8,
-    0xF4, 0x8D, 0x92, 0x4F, 0xB0, 0x76, 0x5D, 0xF1, 0xC5, 0xAE, 0x3D, 0x72, 0xE8, 0xD1, 0x03, 0xFF,
-    0x4F, 0xA4, 0x72, 0x8B, 0x20, 0x3D, 0x6D, 0x3C, 0xA2, 0xB4, 0xC4, 0xB3, 0x47, 0xF8, 0x5A, 0xD8,
-    0x77, 0x80, 0x49, 0xBD, 0x42, 0x9B, 0xBA, 0xC6, 0xFC, 0x1F, 0x66, 0xBA, 0x67, 0xE5, 0x38, 0xFC,
-    0x53, 0xA6, 0x03, 0x31, 0xE5, 0x57, 0x8B, 0x75, 0x5A, 0x96, 0x91, 0x0D, 0xD8, 0xD5, 0xC0, 0x2C,
-    0x18, 0xD2, 0x0D, 0x38, 0xC7, 0x40, 0xAB, 0x98, 0x81, 0x17, 0x5A, 0xDD, 0x1E, 0x36, 0x3F, 0x31,
-    0xEE, 0x29, 0x57, 0x6F, 0xBD, 0x4C, 0x5A, 0x6A, 0xA3, 0x91, 0x4A, 0xD6, 0x9C, 0x6C, 0x40, 0x4E,
-    0x00, 0x4F, 0x04, 0x63, 0x99, 0xFA, 0xBB, 0xE6, 0x82, 0x9E, 0x15, 0xCE, 0x8D, 0x42, 0x50, 0x0C,
-    0x68, 0x04, 0x98, 0xEE, 0x74, 0x5F, 0x80, 0x75, 0x0B, 0xBD, 0xDC, 0xC5, 0x74, 0x87, 0xEF, 0x35,
-    0x8C, 0x83, 0x63, 0x13, 0x12, 0x97, 0x26, 0xF3, 0x0F, 0x9C, 0x84, 0x7A, 0xCC, 0x2E, 0x58, 0x49,
-    0x3C, 0xFE, 0xA1, 0x2E, 0xC6, 0xDD, 0x84, 0x14, 0x6D, 0xF8, 0xBE, 0xD4, 0xEA, 0xC9, 0xD7, 0x76,
-    0x59, 0x48, 0x58, 0xBB, 0x59, 0x92, 0x85, 0x51, 0xDF, 0x01, 0x5F, 0x38, 0x85, 0x2F, 0x73, 0x81,
-    0xB2, 0x33, 0x8F, 0x26, 0x25, 0x6B, 0x47, 0x00, 0x15, 0x38, 0xC3, 0xBE, 0x03, 0xEF, 0xEF, 0xE4,
-    0xB8, 0x99, 0x39, 0xAD, 0xA8, 0xE5, 0x4D, 0x51, 0x97, 0xBE, 0x0D, 0x67, 0x79, 0xDC, 0x67, 0x65,
-    0x5F, 0xB3, 0x5F, 0x8C, 0x2D, 0xD9, 0xE9, 0x33, 0xF8, 0x08, 0x98, 0x82, 0xC6, 0x06, 0xD3, 0x59,
-    0x6B, 0x2E, 0xD0, 0xFC, 0x07, 0xDB, 0xF3, 0x53, 0x13, 0x82, 0x41, 0xC9, 0x4D, 0x95, 0xC3, 0x01,
-    0x1E, 0x60, 0x09, 0x73, 0x58, 0xE2, 0x3B, 0xB1, 0x28, 0xF2, 0xE7, 0xDC, 0x28, 0x24, 0xF5, 0x92,
-    0x83, 0x3C, 0x6E, 0x20, 0x5E, 0xAD, 0xE2, 0x22, 0xA4, 0x5B, 0x6E, 0x57, 0xEA, 0x11, 0xBD, 0xCC,
-    0xA6, 0xA9, 0xBF, 0x99, 0xE4, 0x04, 0x63, 0x3C, 0x37, 0xEA, 0xE2, 0x3B, 0x46, 0x77, 0x2B, 0x3F,
-    0x21, 0x60, 0x45, 0x9D, 0x9D, 0x91, 0xDC, 0xC1, 0xAF, 0xBB, 0x3B, 0x88, 0x1D, 0x5E, 0x51, 0xF1,
-    0x82, 0x2B, 0x95, 0x13, 0x1D, 0x9E, 0x7D, 0x85, 0x1B, 0xDF, 0x66, 0x1C, 0x68, 0x82, 0xF1, 0xD4,
-    0xF4, 0xC0, 0xC1, 0xE0, 0x64, 0xA9, 0x8D, 0xD8, 0x2B, 0x50, 0xCE, 0xC5, 0x8F, 0x35, 0x0D, 0xBE,
-    0x8B, 0x0F, 0xFE, 0xB0, 0xD5, 0x85, 0x63, 0x59, 0xBB, 0xF2, 0x7D, 0x13, 0x46, 0x3A, 0x77, 0xEF,
-    0x16, 0x4F, 0xAB, 0x17, 0xD2, 0x6F, 0xF6, 0xE7, 0x5A, 0x8C, 0xD8, 0x7A, 0x1B, 0x8F, 0x80, 0x1D,
-    0x20, 0xD6, 0x01, 0x5A, 0x12, 0x85, 0xA1, 0xA5, 0x88, 0xC8, 0x72, 0x35, 0x8B, 0xDE, 0xEE, 0x49,
-    0x5F, 0xD5, 0xB3, 0xF4, 0x55, 0x0E, 0x8E, 0x3B, 0x4B, 0x5F, 0x4D, 0x9A, 0x95, 0x95, 0xD5, 0x77,
-    0x31, 0xD0, 0xDA, 0xA4, 0xAF, 0x78, 0xE5, 0x46, 0x9B, 0xBE, 0xB2, 0x4A, 0xCC, 0xE7, 0x83, 0xD2,
-    0x57, 0x07, 0x38, 0x9A, 0xFF, 0xA7, 0xE0, 0x68, 0x6F, 0x0D, 0x89, 0x73, 0xDB, 0xC3, 0x8B, 0xE4,
-    0x68, 0xE9, 0x01, 0x8E, 0x86, 0xF8, 0xC9, 0xFA, 0x8F, 0x38, 0xA5, 0xDE, 0xDA, 0xFA, 0x0C, 0x2C,
-    0xF7, 0x5F, 0x39, 0xCC, 0xE5, 0x98, 0x50, 0xDB, 0x8F, 0x14, 0xD5, 0x08, 0x4B, 0x38, 0x01, 0x58,
-    0x91, 0xD5, 0x0A, 0x03, 0x53, 0x71, 0x99, 0x33, 0x56, 0x2F, 0x71, 0xF2, 0x11, 0x29, 0xC8, 0x72,
-    0xD6, 0xD5, 0x5E, 0x4C, 0x82, 0xA7, 0xF5, 0x8D, 0xB2, 0x2B, 0x4B, 0x1D, 0x6E, 0x3A, 0x35, 0xC8,
-    0xDE, 0xFF, 0x62, 0xAE, 0x9E, 0x2E, 0x15, 0xE8, 0x46, 0xE2, 0x8F, 0xF6, 0xC0, 0x92, 0xD6, 0xAE,
-    0xC1, 0xC6, 0x8B, 0x36, 0x3F, 0x44, 0x3A, 0xDC, 0x61, 0xE3, 0xEF, 0x3C, 0x67, 0xAB, 0x67, 0xB5,
-    0x57, 0x12, 0x48, 0x39, 0xB5, 0x9B, 0x85, 0xE9, 0x16, 0xFD, 0x2B, 0x08, 0x16, 0x38, 0x73, 0xC7,
-    0x69, 0xAF, 0xB3, 0x6E, 0x22, 0xA6, 0xAB, 0x18, 0x1E, 0x8D, 0x5B, 0x5B, 0xF9, 0xD6, 0x4E, 0x6C,
-    0x51, 0xC9, 0xBB, 0x02, 0x2C, 0x8B, 0xB5, 0xDE, 0x16, 0x30, 0x0E, 0x71, 0xF5, 0x84, 0x89, 0x79,
-    0x61, 0xF9, 0xBA, 0xA0, 0x7D, 0x30, 0x8B, 0xD8, 0xE8, 0x4C, 0xEB, 0x56, 0xB0, 0xB9, 0x58, 0x7C,
-    0xE8, 0xC8, 0xC4, 0x14, 0x76, 0x80, 0x1F, 0xBE, 0xCE, 0xE6, 0xD7, 0xDF, 0xEE, 0x3E, 0x70, 0x58,
-    0x61, 0x13, 0x21, 0x5A, 0x75, 0x10, 0x57, 0x17, 0x0E, 0x58, 0x6B, 0x01, 0x4E, 0x72, 0x6C, 0x0B,
-    0x70, 0x57, 0xED, 0xD5, 0x59, 0x0E, 0xE6, 0x2A, 0x6F, 0xE1, 0xCF, 0xAB, 0x95, 0x77, 0x4B, 0xCB,
-    0xFA, 0x6A, 0xC6, 0x72, 0xCB, 0xC4, 0x62, 0xED, 0xF6, 0x01, 0xB9, 0xCA, 0xCF, 0x23, 0xEF, 0x23,
-    0x37, 0x3D, 0x53, 0xF8, 0xEE, 0x8B, 0xE9, 0x48, 0x81, 0xBC, 0x2B, 0x90, 0x77, 0x0D, 0xF2, 0x5E,
-    0x43, 0xC3, 0x16, 0x30, 0xB9, 0xE7, 0xEF, 0x23, 0xEF, 0x70, 0xFE, 0x36, 0xAE, 0xFD, 0xD7, 0xE1,
-    0x70, 0x09, 0x2A, 0x7C, 0x6E, 0x67, 0x25, 0xFE, 0xCC, 0xB2, 0xF6, 0x7D, 0x1F, 0x92, 0x4D, 0xD6,
-    0xD4, 0x0D, 0x26, 0xA0, 0x0D, 0x0F, 0xEE, 0x30, 0xD1, 0x45, 0x4B, 0xFE, 0xF3, 0xBD, 0x38, 0xA0,
-    0x3B, 0x85, 0x1E, 0x84, 0x3A, 0x3E, 0x3A, 0x1C, 0x9E, 0x45, 0x6C, 0xEB, 0xEE, 0x5C, 0x05, 0x9C,
-    0x81, 0x05, 0xDB, 0xF8, 0x73, 0x12, 0xCD, 0x51, 0x55, 0xBE, 0xFE, 0xDB, 0xF3, 0x20, 0x0C, 0xA6,
-    0xF1, 0x40, 0x0E, 0xFC, 0xF1, 0xDA, 0xA0, 0xE0, 0x7E, 0xE7, 0x8D, 0x36, 0xEF, 0x77, 0xDE, 0xC3,
-    0xE1, 0x10, 0xBE, 0xAD, 0xB1, 0x9A, 0x95, 0x92, 0x5D, 0x70, 0x16, 0x03, 0xE8, 0xFB, 0xA4, 0x6D,
-    0x8E, 0xB9, 0x8A, 0x00, 0x1D, 0x4D, 0xAC, 0x06, 0x1F, 0x31, 0xFF, 0x56, 0x15, 0x08, 0xD3, 0x36,
-    0xEA, 0xF5, 0x42, 0x06, 0x60, 0x8A, 0xF0, 0x32, 0x6E, 0x57, 0xA5, 0x2F, 0x8D, 0xCD, 0x00, 0x3E,
-    0xAC, 0x36, 0x3A, 0x03, 0x28, 0x42, 0x4B, 0x40, 0xAE, 0x15, 0x86, 0xF4, 0x1D, 0xA6, 0x6F, 0x07,
-    0xDF, 0x63, 0x1E, 0x20, 0x1A, 0x58, 0x35, 0xFD, 0xF7, 0x40, 0x42, 0x02, 0x29, 0x74, 0x28, 0x9C,
-    0xB2, 0xAF, 0xD3, 0xAD, 0xB5, 0x8E, 0x4C, 0x7E, 0x67, 0x31, 0x17, 0x77, 0x53, 0xFE, 0xDF, 0x14,
-    0x8F, 0x5A, 0x67, 0x18, 0xB4, 0x4E, 0xA5, 0x45, 0x80, 0x16, 0x45, 0x9E, 0xDF, 0x87, 0x25, 0x5F,
-    0x3C, 0xB3, 0xE0, 0x94, 0xCC, 0x2C, 0x34, 0x47, 0x66, 0x7D, 0x1C, 0xDF, 0x3D, 0x3C, 0xD5, 0x62,
-    0xCD, 0x97, 0x2C, 0x5D, 0x7D, 0x3D, 0x35, 0xC1, 0x00, 0xA6, 0x44, 0xE1, 0x8E, 0xF5, 0x99, 0xC0,
-    0x0F, 0x93, 0xC1, 0x98, 0x4F, 0xE1, 0xBC, 0xAC, 0x93, 0x2C, 0x91, 0xFF, 0x33, 0x93, 0x46, 0x7B,
-    0xAC, 0x85, 0xA3, 0xDD, 0x18, 0x50, 0x5A, 0x43, 0x9A, 0xD1, 0xE7, 0x47, 0xCF, 0x54, 0x74, 0xDE,
-    0x8E, 0xA0, 0x75, 0xAD, 0x0D, 0x7A, 0x2C, 0x4A, 0xFB, 0x0C, 0xD6, 0x50, 0xE5, 0x7E, 0x66, 0xB3,
-    0x6A, 0xD3, 0x63, 0x19, 0x04, 0x41, 0xE5, 0x15, 0x48, 0xF5, 0xD3, 0xE7, 0x20, 0xE2, 0x7F, 0x81,
-    0xDD, 0xDD, 0x81, 0xAC, 0xEB, 0x88, 0xEE, 0xBC, 0x9F, 0xC2, 0xE0, 0x26, 0xFF, 0x99, 0x5F, 0xC1,
-    0xE2, 0x26, 0xA6, 0x9C, 0x0F, 0xF1, 0x27, 0x94, 0xF8, 0xB6, 0xAC, 0xA3, 0x1D, 0x93, 0x84, 0x9F,
-    0x6B, 0xA5, 0xCB, 0xD5, 0x2D, 0x1D, 0x25, 0x70, 0x9D, 0xB1, 0xF3, 0xF3, 0x93, 0xA2, 0xBE, 0x9B,
-    0x4B, 0xFF, 0xBF, 0x99, 0xA8, 0xC6, 0xF9, 0xDF, 0x23, 0x7C, 0x44, 0x8C, 0xFA, 0x6F, 0x0A, 0x3A,
-    0x56, 0x6F, 0xD3, 0xCD, 0x34, 0x47, 0x0F, 0x71, 0x00, 0x9F, 0xCF, 0x98, 0xAD, 0x05, 0x6E, 0x69,
-    0x31, 0xFD, 0xD8, 0x07, 0x82, 0x7A, 0x31, 0xAE, 0x14, 0x98, 0x20, 0x68, 0x09, 0xA7, 0xCF, 0xA6,
-    0xAA, 0x32, 0x7F, 0x68, 0x17, 0x4B, 0x62, 0xE6, 0xCF, 0x2E, 0xFC, 0xD8, 0xEC, 0x2E, 0xB0, 0x0B,
-    0xA7, 0x30, 0x13, 0x08, 0xE5, 0x4C, 0x9C, 0x6E, 0x7B, 0xC1, 0x5C, 0x34, 0x1F, 0x8B, 0x8B, 0xB3,
-    0x63, 0xA9, 0x19, 0x3C, 0x96, 0xD8, 0x85, 0x16, 0x7E, 0xFF, 0x76, 0x98, 0xF6, 0x98, 0x3A, 0xCB,
-    0x99, 0x2B, 0x73, 0x7E, 0x11, 0x73, 0x69, 0x9D, 0x77, 0x52, 0xE9, 0xC1, 0x56, 0x59, 0x1F, 0xF3,
-    0xB2, 0x63, 0x9B, 0x21, 0xEE, 0x9C, 0x92, 0x96, 0x1D, 0xE5, 0xB2, 0xB2, 0x06, 0x9D, 0x38, 0x5B,
-    0xEB, 0x58, 0xD8, 0xC2, 0x8F, 0xFA, 0x02, 0xCD, 0x3C, 0x2D, 0x4F, 0x58, 0xF4, 0xA9, 0xB2, 0x44,
-    0x93, 0xF2, 0xCF, 0xB2, 0xFE, 0xA0, 0x8D, 0x41, 0x11, 0x88, 0x97, 0x98, 0x73, 0xF5, 0x5F, 0x60,
-    0x4E, 0x03, 0xAC, 0x14, 0x6B, 0xC9, 0x51, 0x2E, 0x51, 0x05, 0xFD, 0x08, 0x56, 0xEF, 0x63, 0x99,
-    0x31, 0x12, 0xB3, 0xCE, 0x5D, 0xFD, 0x44, 0xE9, 0xD2, 0x3F, 0xAB, 0x2B, 0x3F, 0x2B, 0xD6, 0x94,
-    0x2C, 0x9C, 0xF6, 0xA2, 0xA7, 0xBD, 0x4B, 0x18, 0xE9, 0xA7, 0xB8, 0x23, 0xA1, 0xB5, 0x13, 0xA9,
-    0x2E, 0x65, 0x62, 0x03, 0x4C, 0x64, 0x0D, 0xAC, 0x73, 0x0C, 0x77, 0x9F, 0x94, 0xF4, 0xBA, 0x12,
-    0x0D, 0xCD, 0x86, 0x1C, 0xB2, 0x02, 0x2C, 0xF5, 0xCB, 0xB1, 0xA9, 0xBC, 0x3D, 0xF0, 0xC0, 0x2A,
-    0x5D, 0x7B, 0xF8, 0xCC, 0x5B, 0x4C, 0xD5, 0x0E, 0xB4, 0xE9, 0x36, 0xDB, 0x33, 0xA6, 0x3D, 0xD9,
-    0x2D, 0x6D, 0x98, 0xC3, 0xC2, 0x9E, 0x69, 0x3F, 0x7A, 0x32, 0x6A, 0x9B, 0x39, 0x22, 0xC8, 0x4C,
-    0x1E, 0x2F, 0xB0, 0x7B, 0x79, 0x6E, 0xD7, 0x81, 0x72, 0x10, 0x6D, 0x01, 0x59, 0xBF, 0x37, 0x95,
-    0xB9, 0x66, 0xD5, 0x94, 0x0C, 0x7B, 0x46, 0x20, 0x42, 0xD1, 0xC0, 0xE6, 0xD6, 0x1D, 0x13, 0x25,
-    0x12, 0x8D, 0x39, 0x0A, 0x31, 0x15, 0x47, 0xD9, 0x7F, 0x39, 0xED, 0x02, 0xC2, 0xC1, 0x3D, 0x97,
-    0x39, 0xA0, 0x4D, 0xA7, 0xAD, 0x3C, 0x52, 0xE8, 0x2A, 0xC9, 0x03, 0x0D, 0x44, 0x85, 0xE5, 0x40,
-    0xB8, 0xA7, 0x29, 0xE5, 0xF3, 0x14, 0xD7, 0xC8, 0x6D, 0x06, 0x60, 0x04, 0x37, 0x6C, 0x92, 0x92,
-    0xC3, 0x42, 0x92, 0xD8, 0xE4, 0xD1, 0x86, 0x66, 0x7B, 0x51, 0x68, 0x4A, 0x15, 0x70, 0x02, 0xAB,
-    0x06, 0xCC, 0x0D, 0xF4, 0xA7, 0x9D, 0x13, 0x68, 0x3D, 0x3E, 0x81, 0x74, 0xF7, 0x0B, 0xC0, 0x0C,
-    0xBF, 0xD0, 0x53, 0xF3, 0x45, 0x90, 0xF2, 0x0B, 0xAB, 0x32, 0x4F, 0x84, 0xE6, 0x09, 0xBA, 0x69,
-    0x38, 0x8B, 0xC2, 0x3C, 0x31, 0x02, 0x08, 0x34, 0x40, 0x79, 0x4D, 0x7B, 0x48, 0xF7, 0x32, 0x16,
-    0x66, 0x63, 0x99, 0xD8, 0x26, 0xAC, 0xB9, 0x68, 0x8E, 0x41, 0xBE, 0x1B, 0x79, 0x92, 0x6B, 0x24,
-    0x8C, 0xBC, 0x4C, 0x36, 0x4E, 0x4C, 0x5E, 0x4E, 0x4C, 0x86, 0x8E, 0xB9, 0xBA, 0x5F, 0x4D, 0x79,
-    0x19, 0x73, 0x55, 0x81, 0xB2, 0xD7, 0xBC, 0x6C, 0x55, 0x6D, 0x0A, 0xCF, 0x24, 0xF3, 0x6E, 0xC1,
-    0x9F, 0x45, 0x81, 0x49, 0xDF, 0x19, 0x16, 0x61, 0x6A, 0x87, 0xED, 0xC6, 0x92, 0x76, 0xF5, 0x8D,
-    0x18, 0x4F, 0x1A, 0xEE, 0x0B, 0x83, 0x13, 0xEB, 0x6D, 0x6E, 0xF3, 0xE3, 0x76, 0xBF, 0x78, 0x1C,
-    0xDB, 0x25, 0x60, 0x0D, 0x7E, 0x42, 0x45, 0x35, 0x02, 0x09, 0x26, 0xC0, 0x47, 0x01, 0x0B, 0x89,
-    0x13, 0xD8, 0xE4, 0x06, 0xBD, 0x0F, 0xBD, 0x07, 0x2E, 0x8D, 0x68, 0xB5, 0x05, 0xEF, 0xCA, 0x7B,
-    0x76, 0xE9, 0x6E, 0x64, 0x4E, 0xE9, 0xFD, 0x9D, 0x38, 0xCD, 0xCB, 0xE5, 0x11, 0x4B, 0xEF, 0xC0,
-    0x74, 0x0E, 0x49, 0x1B, 0x95, 0x32, 0x99, 0xB5, 0xE6, 0x67, 0xDE, 0xEB, 0x1F, 0x65, 0x3D, 0xE5,
-    0xDE, 0xCA, 0xD7, 0x94, 0x7A, 0x21, 0xEB, 0xF7, 0x55, 0x54, 0x96, 0xA7, 0x9C, 0x0D, 0x7C, 0xF4,
-    0x6E, 0x16, 0xD7, 0xD5, 0xEB, 0x1F, 0xA5, 0xFE, 0xBF, 0xAF, 0x31, 0x28, 0x26, 0x00, 0x2F, 0x7C,
-    0xE9, 0x2A, 0x2B, 0xA7, 0x18, 0x5E, 0xE0, 0xEC, 0x01, 0x2F, 0xF0, 0x30, 0xF9, 0x47, 0xA6, 0x02,
-    0xF6, 0xBC, 0xC0, 0xE3, 0xA9, 0xD5, 0x36, 0xA6, 0xAE, 0xB0, 0x3F, 0x11, 0x78, 0xAF, 0x13, 0x78,
-    0x94, 0x84, 0x67, 0xDD, 0xF2, 0xE2, 0x51, 0x5B, 0x96, 0x7C, 0xDE, 0xA0, 0xED, 0x05, 0x6B, 0xB8,
-    0xA8, 0x5F, 0xD3, 0xEF, 0x23, 0xC6, 0xCE, 0x18, 0x47, 0xDA, 0x25, 0x9E, 0x08, 0xD1, 0x9B, 0x9B,
-    0xAD, 0x61, 0xA6, 0x00, 0x96, 0xEA, 0x4F, 0xC9, 0xE5, 0xA4, 0x0D, 0xFE, 0x38, 0x6F, 0x46, 0xFD,
-    0x26, 0x9D, 0x17, 0xE6, 0x85, 0x63, 0x08, 0xAA, 0x98, 0xBC, 0x7D, 0xB4, 0x74, 0x2A, 0x57, 0x82,
-    0x51, 0xDF, 0x5A, 0x0B, 0x02, 0x1E, 0x97, 0x21, 0x37, 0xF9, 0xCD, 0x7B, 0x85, 0x32, 0x41, 0xB8,
-    0x11, 0x8A, 0xC4, 0xFD, 0xD5, 0x4E, 0xA8, 0x3F, 0x6A, 0x85, 0x7A, 0xB2, 0xAD, 0x2F, 0xC7, 0x8F,
-    0x2C, 0x94, 0xC2, 0x62, 0xF5, 0x3B, 0xA1, 0x3E, 0x81, 0x50, 0x7F, 0x87, 0xB9, 0x29, 0x21, 0x41,
-    0x23, 0xD6, 0xE2, 0xF9, 0x7B, 0x85, 0xCA, 0x5A, 0xA1, 0x86, 0x32, 0x8C, 0xB8, 0xF7, 0x2E, 0x1A,
-    0x47, 0x2E, 0x9A, 0xE5, 0x12, 0xB1, 0x04, 0x2D, 0x35, 0x67, 0xB9, 0x2E, 0x4D, 0x36, 0xAB, 0xAB,
-    0x41, 0x7B, 0x14, 0x66, 0xCC, 0x8A, 0x34, 0x77, 0x2B, 0xB0, 0x08, 0x6D, 0xE7, 0x2C, 0x84, 0xC1,
-    0x4C, 0xB8, 0xD9, 0x2E, 0x62, 0x15, 0xFA, 0xC7, 0x9A, 0x3B, 0x28, 0x67, 0x5C, 0x86, 0x92, 0x33,
-    0xB1, 0xDC, 0x42, 0xE0, 0x53, 0xED, 0xD2, 0x3E, 0x62, 0x9A, 0xB7, 0x6A, 0xF1, 0x81, 0x5E, 0xE8,
-    0x64, 0xA7, 0x1F, 0x70, 0x5A, 0x43, 0x0B, 0x62, 0xEB, 0x46, 0xE9, 0x4B, 0x1F, 0xFD, 0xB6, 0x74,
-    0x73, 0x92, 0x3D, 0x15, 0x2D, 0x04, 0x2E, 0x94, 0xE9, 0xF2, 0xE4, 0x19, 0x29, 0x0D, 0x30, 0x66,
-    0x06, 0x2F, 0x23, 0xCA, 0xD2, 0x37, 0xC2, 0x3C, 0xD4, 0x65, 0xC0, 0x8C, 0xBE, 0xA2, 0x66, 0x85,
-    0xEF, 0x8E, 0xF8, 0x19, 0x98, 0x30, 0x43, 0xE9, 0xC2, 0xAE, 0xA7, 0x66, 0xC8, 0x54, 0x63, 0x38,
-    0xBA, 0xD0, 0x97, 0xDE, 0xD8, 0x48, 0xCB, 0xA7, 0x7C, 0xCF, 0xC9, 0xBE, 0x31, 0x3A, 0xA2, 0x22,
-    0xAC, 0x6C, 0x5F, 0xCC, 0xE6, 0x16, 0xBF, 0xDD, 0x47, 0xBB, 0xFF, 0xD2, 0x78, 0x6B, 0x75, 0x9B,
-    0x09, 0xBE, 0x7A, 0x86, 0x7A, 0x86, 0x56, 0x3E, 0xBD, 0xEB, 0x78, 0x22, 0x16, 0xA5, 0xCF, 0x21,
-    0x66, 0xAA, 0x8E, 0xE5, 0xF3, 0xA6, 0xC2, 0x1F, 0x99, 0xEA, 0xE1, 0xEE, 0x09, 0x31, 0xDB, 0x94,
-    0xD5, 0xFD, 0x9D, 0x84, 0x35, 0x52, 0x2C, 0xD3, 0xD0, 0xEC, 0x5D, 0x28, 0x67, 0x9B, 0x18, 0x66,
-    0x27, 0x2E, 0x60, 0xCC, 0x98, 0x48, 0x8B, 0x71, 0x93, 0x59, 0x67, 0x0B, 0xBB, 0x03, 0x79, 0x94,
-    0xC4, 0xF7, 0x76, 0x4B, 0xEF, 0x68, 0xCF, 0x5C, 0x8F, 0xE7, 0xBA, 0xA4, 0x46, 0xF4, 0x39, 0x9B,
-    0x00, 0x0E, 0xC1, 0x73, 0x5E, 0xBA, 0x04, 0x30, 0xCC, 0x31, 0xEE, 0xA6, 0xDB, 0x04, 0xF0, 0x75,
-    0x78, 0x7A, 0xC1, 0x05, 0x59, 0x78, 0xC0, 0x26, 0x80, 0x83, 0x02, 0xBD, 0x06, 0x81, 0x4E, 0x42,
-    0xA0, 0xBF, 0x6A, 0x05, 0xF2, 0x20, 0xD0, 0xC9, 0x7B, 0x32, 0xF1, 0xF0, 0xAC, 0xAC, 0xEE, 0x8A,
-    0x35, 0xDD, 0x67, 0x28, 0x7B, 0x96, 0xB3, 0x58, 0xD1, 0x9B, 0x12, 0x02, 0x98, 0xDD, 0xE3, 0x3E,
-    0x18, 0xEE, 0xDC, 0xB2, 0x18, 0x92, 0x33, 0x36, 0xF7, 0x23, 0x5E, 0x08, 0x6E, 0xBB, 0x4D, 0xA8,
-    0x41, 0x8A, 0x66, 0xE9, 0x34, 0x77, 0xFA, 0x80, 0x9A, 0x87, 0x28, 0x1F, 0x2C, 0xEF, 0x0E, 0xEE,
-    0x6A, 0xCC, 0xCE, 0x8B, 0xF0, 0x9E, 0xEC, 0xD9, 0xE7, 0xA5, 0xD3, 0x98, 0x50, 0x81, 0x66, 0xA5,
-    0xCC, 0xA8, 0x30, 0xE0, 0xB0, 0xAB, 0xDF, 0x03, 0x85, 0xAA, 0x7B, 0xDC, 0x41, 0xCA, 0x49, 0x98,
-    0x2C, 0x01, 0xB7, 0x27, 0xF4, 0x73, 0xF5, 0x93, 0xCD, 0xCA, 0xCA, 0x4F, 0x5A, 0x85, 0x5B, 0xE2,
-    0x61, 0x59, 0x66, 0x45, 0xFF, 0x80, 0x2B, 0x07, 0xE1, 0xBE, 0xDB, 0x26, 0x21, 0xC5, 0x6C, 0x2A,
-    0x99, 0xD5, 0x36, 0x15, 0x6C, 0xBC, 0x49, 0xE6, 0x54, 0xB4, 0xB4, 0xB0, 0x26, 0xDB, 0x1F, 0x64,
-    0xF6, 0x07, 0x68, 0xEC, 0x0D, 0x6E, 0xCB, 0x2A, 0xDA, 0x41, 0x98, 0xCA, 0x79, 0xCC, 0xA9, 0x2A,
-    0x0D, 0xCB, 0x34, 0x29, 0x99, 0xAF, 0x4E, 0x2E, 0x03, 0xFA, 0xE6, 0xC0, 0xF4, 0x4C, 0x0B, 0xEE,
-    0xED, 0x16, 0x42, 0xF9, 0x82, 0x02, 0x73, 0x59, 0x8F, 0x77, 0xBA, 0x8B, 0x76, 0xED, 0xE8, 0xA1,
-    0xB6, 0x69, 0x8B, 0x1C, 0xB6, 0xDA, 0xDA, 0x88, 0xD9, 0x4D, 0x9A, 0x9A, 0x01, 0xB4, 0x79, 0xAE,
-    0x59, 0xD2, 0x06, 0xFF, 0xFE, 0x58, 0x86, 0xE7, 0xED, 0x08, 0x51, 0x65, 0x8D, 0xF0, 0x12, 0xD0,
-    0xE3, 0x20, 0xD0, 0x35, 0xDB, 0x85, 0x18, 0x66, 0xE3, 0xC1, 0x1E, 0x77, 0x00, 0x8B, 0xF7, 0x02,
-    0x53, 0x43, 0x52, 0x4C, 0x4E, 0x99, 0x1D, 0x41, 0x89, 0xE1, 0xB5, 0x84, 0x09, 0xF7, 0x56, 0xC1,
-    0x04, 0x62, 0x3E, 0x61, 0x89, 0xA3, 0x08, 0x6C, 0x66, 0xC1, 0xBC, 0x34, 0xE4, 0x0E, 0x8C, 0xC2,
-    0xCB, 0x65, 0x6A, 0xD2, 0xCC, 0x20, 0x59, 0xB9, 0x7A, 0xAF, 0x11, 0x30, 0xCF, 0xA6, 0xDD, 0xE3,
-    0xC6, 0x4D, 0x34, 0x57, 0xE8, 0xC9, 0xE8, 0x38, 0x10, 0x42, 0x43, 0x9B, 0xD3, 0xC7, 0x12, 0x54,
-    0xEE, 0x2F, 0x57, 0xC3, 0x3C, 0x4E, 0xB0, 0x4B, 0x3F, 0x73, 0x1B, 0xEE, 0x4C, 0x65, 0x35, 0xC0,
-    0x4B, 0xD7, 0x04, 0x34, 0x03, 0x91, 0x62, 0x66, 0x82, 0x7A, 0x18, 0x08, 0xA6, 0xCB, 0x07, 0x9D,
-    0x71, 0xB8, 0x67, 0x9B, 0xDC, 0xAD, 0x9E, 0xFD, 0x82, 0x5C, 0x56, 0xE8, 0xA9, 0x6C, 0x6D, 0x8A,
-    0x49, 0x78, 0xB0, 0xF2, 0xDF, 0x87, 0xBB, 0xF3, 0x37, 0xF7, 0x65, 0x9A, 0x96, 0x82, 0xD2, 0xCF,
-    0xFA, 0x0E, 0x74, 0xFF, 0x1A, 0x18, 0xA7, 0x38, 0x1F, 0x91, 0x6C, 0x66, 0xCE, 0x87, 0x09, 0xC2,
-    0x09, 0x10, 0x27, 0xD6, 0x54, 0x06, 0x5E, 0xE9, 0x7C, 0xA0, 0xD1, 0xFB, 0x2C, 0xB0, 0x57, 0xC6,
-    0xC1, 0x79, 0x2D, 0x21, 0x79, 0x8C, 0xBB, 0x08, 0xFF, 0xA2, 0x14, 0xCD, 0x19, 0x66, 0x1A, 0x80,
-    0x3E, 0x6F, 0x6F, 0x0F, 0xF1, 0xB3, 0x9D, 0xB8, 0x0F, 0x5F, 0xD4, 0xDE, 0x5E, 0x17, 0x5D, 0x45,
-    0xBB, 0x85, 0x92, 0xEB, 0x2D, 0xCB, 0x38, 0x24, 0x8F, 0x79, 0xDF, 0xA0, 0x3A, 0xAB, 0x0B, 0x83,
-    0x30, 0x66, 0xF3, 0xB3, 0x8A, 0xBB, 0xF7, 0x1A, 0xC8, 0xBF, 0x67, 0xAF, 0x58, 0xCC, 0xA2, 0x91,
-    0xF8, 0x61, 0xA3, 0x11, 0x27, 0x0D, 0xA7, 0xA6, 0xB9, 0x51, 0x87, 0x8B, 0x84, 0x33, 0x1A, 0x55,
-    0xD2, 0xEE, 0xA1, 0xF9, 0x4A, 0xB6, 0x3E, 0xEE, 0x8A, 0x4F, 0x43, 0x31, 0x61, 0x90, 0xFA, 0x32,
-    0x01, 0x95, 0xA9, 0xEE, 0xC7, 0xED, 0x52, 0x1A, 0xF7, 0x7B, 0xAD, 0x03, 0x80, 0x43, 0x8F, 0x77,
-    0xE7, 0xD9, 0x1E, 0xCC, 0xF7, 0xBA, 0xB4, 0x67, 0x5B, 0x3B, 0x7D, 0x14, 0xF7, 0xE8, 0x57, 0x26,
-    0x19, 0xC3, 0x1D, 0x5D, 0x64, 0x80, 0xAF, 0xB4, 0x89, 0x22, 0xEB, 0x77, 0xB7, 0x97, 0x75, 0x8F,
-    0xAE, 0x98, 0xF0, 0xC9, 0x64, 0x8B, 0xDB, 0x42, 0xF0, 0x6C, 0x03, 0xFD, 0x17, 0xDF, 0x99, 0x91,
-    0x77, 0x53, 0x63, 0xD8, 0xC3, 0xB5, 0x19, 0x5D, 0xE1, 0x16, 0xC5, 0xE6, 0x5B, 0x9B, 0x9C, 0xFB,
-    0xCF, 0xFE, 0x7F, 0x6C, 0x3B, 0x69, 0x10, 0xFB, 0x44, 0xA4, 0x8B, 0x11, 0x7C, 0xAD, 0x79, 0x47,
-    0x24, 0xDF, 0x0F, 0xBF, 0xDC, 0xA5, 0x65, 0x5C, 0x89, 0x71, 0xE1, 0x46, 0xE1, 0xFB, 0x44, 0xC3,
-    0x9F, 0xD1, 0x0B, 0x50, 0x63, 0x5F, 0x65, 0xBA, 0x8B, 0x99, 0x06, 0x9F, 0x2A, 0xF7, 0xD7, 0xDF,
-    0xEE, 0x2A, 0x70, 0xC1, 0xCA, 0xAA, 0xA1, 0x58, 0xDC, 0xC4, 0x1E, 0x9A, 0x98, 0xD8, 0x66, 0x55,
-    0x2D, 0x9C, 0x02, 0xE0, 0x9F, 0xB5, 0xC0, 0x08, 0xD7, 0xEC, 0x72, 0x69, 0x5F, 0x4D, 0x08, 0x54,
-    0x60, 0x7D, 0x35, 0xEE, 0x3B, 0x85, 0x01, 0x12, 0x9F, 0x4C, 0x61, 0x1E, 0x41, 0xE8, 0xCE, 0xC4,
-    0x6C, 0x9D, 0x72, 0xD3, 0x89, 0x53, 0xF8, 0x1F, 0xEB, 0x5F, 0xEB, 0x37, 0x0B, 0xA6, 0x7A, 0x4E,
-    0x61, 0xAC, 0x56, 0x8D, 0xF8, 0xC0, 0xD9, 0x7D, 0x3D, 0x6B, 0xF7, 0x55, 0x27, 0x63, 0x47, 0x26,
-    0x19, 0x4E, 0xE2, 0x6F, 0x2A, 0x49, 0x72, 0x9D, 0xB5, 0x95, 0x0D, 0xC8, 0x7D, 0x9C, 0x33, 0x5F,
-    0xC2, 0x0A, 0x5C, 0x84, 0x86, 0x72, 0x7A, 0x78, 0x83, 0x09, 0x48, 0xB0, 0x90, 0xAD, 0xAB, 0x86,
-    0x02, 0x66, 0xAC, 0x30, 0xA5, 0x26, 0x8E, 0x4F, 0x62, 0xEE, 0x9A, 0x8B, 0x42, 0x1D, 0x3D, 0x61,
-    0xC5, 0xEA, 0x26, 0x6C, 0x69, 0x59, 0x0E, 0xCF, 0x7D, 0x31, 0x71, 0x19, 0x9A, 0x9D, 0x37, 0xA1,
-    0x53, 0x45, 0xB5, 0x5E, 0xA9, 0x8C, 0x58, 0xB0, 0x95, 0xE3, 0xE6, 0xD8, 0x33, 0xD9, 0x8D, 0xEB,
-    0xED, 0x1E, 0xCE, 0x91, 0x71, 0xCB, 0xCB, 0x98, 0x3D, 0x37, 0xA5, 0x1A, 0x2B, 0xCA, 0x28, 0xBE,
-    0x21, 0x8A, 0xFD, 0xE1, 0xC4, 0xC0, 0xE6, 0x48, 0xBE, 0x66, 0xDE, 0x0C, 0x38, 0xE5, 0x70, 0x03,
-    0x4B, 0xCF, 0x03, 0xBB, 0x07, 0xD9, 0x9D, 0x7A, 0x2D, 0x6F, 0x05, 0xF9, 0x9A, 0x7A, 0x53, 0x7B,
-    0xE7, 0xC6, 0xCE, 0x54, 0x45, 0x3A, 0xAA, 0x7B, 0x56, 0x65, 0x4A, 0x10, 0x6E, 0x26, 0x8B, 0x5A,
-    0xE3, 0xD6, 0xAD, 0x0B, 0xC1, 0x0F, 0x99, 0xC1, 0x22, 0x6C, 0xCF, 0x06, 0x7B, 0x68, 0xBC, 0x9A,
-    0xE8, 0x22, 0x29, 0x03, 0x1D, 0x1D, 0x61, 0x29, 0xDB, 0x92, 0x23, 0xAC, 0x6B, 0x7A, 0x50, 0x89,
-    0xA0, 0xDD, 0x65, 0xFF, 0xE5, 0xDF, 0x30, 0x80, 0x47, 0x1D, 0x39, 0x69, 0x15, 0x58, 0x5D, 0xBE,
-    0xFF, 0x61, 0xCB, 0xEA, 0xDF, 0xBB, 0x0C, 0x19, 0x4A, 0x67, 0xFB, 0x62, 0x75, 0x1A, 0x81, 0xDC,
-    0x77, 0x4C, 0x75, 0x92, 0x59, 0x2D, 0x26, 0x04, 0xA8, 0x9A, 0x53, 0x3E, 0xA8, 0x4D, 0x42, 0x66,
-    0x80, 0xA9, 0xFD, 0x07, 0x18, 0xFA, 0x3B, 0x19, 0x22, 0xC0, 0x14, 0x8B, 0xB0, 0x95, 0x98, 0xA0,
-    0xAC, 0x53, 0xE8, 0x60, 0xEA, 0xEE, 0x4C, 0x4F, 0xEC, 0xE6, 0x67, 0xBC, 0xAD, 0x15, 0x86, 0x14,
-    0x39, 0x90, 0x5B, 0xAD, 0xCA, 0x28, 0xBC, 0x98, 0x41, 0x3F, 0xE7, 0x58, 0x13, 0x3C, 0x21, 0xEA,
-    0x16, 0x02, 0x27, 0x6F, 0xB7, 0x28, 0x65, 0xAD, 0x44, 0x26, 0xD7, 0xFB, 0xE1, 0x62, 0xBE, 0x26,
-    0xEA, 0xBD, 0x78, 0x77, 0xB7, 0xE3, 0x72, 0x9B, 0x87, 0x76, 0x3E, 0xD5, 0x66, 0x90, 0x5C, 0xE1,
-    0xBB, 0xC0, 0xAC, 0x5F, 0xA6, 0x12, 0x80, 0xAE, 0x55, 0xE0, 0xA1, 0xE9, 0x78, 0xA5, 0x36, 0x3B,
-    0x1E, 0x41, 0xEB, 0x9E, 0xB1, 0xA3, 0x3A, 0x38, 0x5B, 0x4C, 0x2C, 0xE9, 0x2A, 0x44, 0x49, 0xE9,
-    0x7F, 0x5C, 0x5E, 0xD9, 0x4D, 0x21, 0x05, 0x2B, 0x2B, 0xDA, 0x64, 0xC9, 0x1A, 0x19, 0x80, 0xE3,
-    0x4C, 0x17, 0x23, 0x30, 0x2C, 0x72, 0x85, 0x13, 0x64, 0xF5, 0x82, 0x47, 0xCD, 0x2B, 0x7E, 0xD5,
-    0x3D, 0x4A, 0x2F, 0xD6, 0x65, 0xC4, 0x5C, 0x4F, 0xC8, 0x14, 0x18, 0xA7, 0xB2, 0x30, 0xF5, 0x33,
-    0x30, 0xBE, 0x89, 0x59, 0x5F, 0x2F, 0x9A, 0x98, 0xE2, 0x4D, 0x40, 0xA6, 0x77, 0xCA, 0x4B, 0xC9,
-    0xDF, 0x6E, 0x15, 0xD7, 0x69, 0x20, 0x4D, 0xDD, 0x46, 0xF3, 0xD4, 0x2E, 0xEF, 0x56, 0x61, 0x68,
-    0x4E, 0xDF, 0xD0, 0x30, 0xC8, 0x01, 0xDA, 0xCD, 0x17, 0x0E, 0xC1, 0x3A, 0x82, 0x98, 0x25, 0x32,
-    0xA7, 0x74, 0x2A, 0x6E, 0x9E, 0x38, 0x57, 0x31, 0x97, 0x55, 0x9D, 0x6F, 0x37, 0x52, 0xCE, 0xCB,
-    0x65, 0x3C, 0x40, 0xBB, 0x52, 0x6C, 0x60, 0x77, 0x50, 0x8F, 0x91, 0x22, 0x71, 0x29, 0xB0, 0x0C,
-    0x4E, 0x71, 0x63, 0xD6, 0x2E, 0x78, 0x31, 0x79, 0xD1, 0xD4, 0x85, 0xED, 0xA9, 0x38, 0x97, 0xEA,
-    0x29, 0xAA, 0x0C, 0x51, 0x7E, 0x40, 0xB6, 0x63, 0xE2, 0x0D, 0xA6, 0x5E, 0x4D, 0x7D, 0xFC, 0x90,
-    0xB8, 0x40, 0xAA, 0x49, 0x28, 0xFE, 0xAD, 0xE6, 0xFB, 0x85, 0xD9, 0xD4, 0x7E, 0x41, 0xE6, 0xAD,
-    0x78, 0x59, 0xDD, 0x2C, 0x43, 0x6B, 0x77, 0x7B, 0xC7, 0xD4, 0xFD, 0xB8, 0x3E, 0x61, 0x95, 0x74,
-    0x35, 0x4A, 0x7E, 0xBF, 0xE0, 0xEE, 0x34, 0xB0, 0x29, 0xEF, 0xBF, 0x4B, 0xD0, 0x93, 0xAA, 0x59,
-    0x4C, 0xF1, 0xDC, 0x51, 0xBE, 0x35, 0xC9, 0x6A, 0x85, 0xBF, 0xB2, 0x7A, 0x33, 0xB7, 0x8B, 0xE7,
-    0xA0, 0x45, 0xF4, 0xB4, 0x98, 0x64, 0xBE, 0xE3, 0xC8, 0x1C, 0xFD, 0x62, 0xD1, 0xB2, 0xE2, 0x2E,
-    0xDD, 0x33, 0xF9, 0x06, 0xE6, 0x06, 0xC1, 0x4D, 0x68, 0x2C, 0x03, 0x4E, 0xDD, 0x0C, 0x3A, 0xD4,
-    0x53, 0xB4, 0xF9, 0xBC, 0x93, 0xB3, 0x98, 0x7C, 0xDA, 0xBC, 0x99, 0xB9, 0x6D, 0x4A, 0x57, 0xC7,
-    0x4A, 0xF3, 0xE4, 0x0D, 0xE3, 0x04, 0xF1, 0x33, 0x7A, 0x5E, 0xEA, 0x65, 0x97, 0x31, 0x3B, 0x23,
-    0x81, 0xB9, 0xA1, 0xB4, 0x7B, 0x51, 0xBB, 0xD4, 0x68, 0xB7, 0xF0, 0xC3, 0xF3, 0x66, 0xCF, 0xB0,
-    0xAF, 0xDF, 0x28, 0xE5, 0x18, 0x8D, 0x8F, 0x31, 0x93, 0x21, 0xB5, 0x8A, 0x51, 0xD4, 0x5D, 0x16,
-    0x4E, 0x5E, 0xC2, 0xA5, 0xB2, 0x2F, 0x20, 0xC0, 0xB8, 0x54, 0xC2, 0xA6, 0xDF, 0x85, 0x4F, 0x0E,
-    0xE8, 0xC9, 0x11, 0xDC, 0x97, 0x36, 0x33, 0x50, 0x26, 0xBC, 0x4E, 0xAE, 0x58, 0xC9, 0x8F, 0xB4,
-    0xD9, 0x5C, 0xCA, 0xBD, 0x22, 0xBE, 0xCE, 0xEE, 0x51, 0x32, 0xA5, 0x6D, 0xFD, 0x37, 0x3A, 0x02,
-    0x51, 0x8E, 0xC8, 0x25, 0x1D, 0x26, 0xD2, 0x6B, 0xE9, 0xBB, 0xEF, 0x8A, 0x3A, 0xB7, 0x91, 0x3A,
-    0xBF, 0x88, 0x31, 0x6D, 0x71, 0x8F, 0x5B, 0x6E, 0x99, 0xBD, 0x4C, 0xBD, 0x4D, 0xBB, 0x51, 0xDA,
-    0x41, 0x23, 0xC7, 0x6D, 0xCE, 0x09, 0x8C, 0xD5, 0x29, 0x96, 0xBE, 0x7A, 0xD1, 0x8F, 0xCC, 0xB7,
-    0x66, 0xE2, 0x66, 0x98, 0xA7, 0xF3, 0x87, 0xBE, 0x7C, 0xC9, 0xF5, 0x84, 0x1B, 0x89, 0x47, 0x37,
-    0xD3, 0xBD, 0x50, 0xDA, 0xFD, 0x03, 0x28, 0x11, 0xA1, 0x24, 0xFC, 0x61, 0x92, 0xAA, 0x4C, 0x12,
-    0x1B, 0xDA, 0x53, 0x02, 0x8D, 0xFC, 0x77, 0xB2, 0xF6, 0x0D, 0x92, 0xB6, 0x16, 0x5F, 0xCF, 0x5E,
-    0x25, 0x61, 0x09, 0xFE, 0x1D, 0xE0, 0x1E, 0x10, 0x01, 0xF2, 0x31, 0x95, 0xA7, 0x72, 0x84, 0xBD,
-    0xE3, 0x2D, 0x93, 0x3E, 0xE5, 0x9B, 0x62, 0x8C, 0x9B, 0xBE, 0x63, 0x97, 0xCB, 0x32, 0xF1, 0xE3,
-    0x43, 0xD6, 0xCC, 0x94, 0xFC, 0x46, 0xC2, 0x3B, 0x65, 0x20, 0x63, 0x5F, 0x3C, 0x80, 0xCA, 0xDD,
-    0xBC, 0x63, 0x2B, 0xDC, 0x15, 0xBC, 0x03, 0x1A, 0x02, 0xE7, 0xEA, 0x6D, 0x27, 0x7C, 0xBD, 0x90,
-    0x18, 0xF7, 0xFF, 0xC7, 0xEE, 0x80, 0x87, 0x9A, 0xB3, 0xB4, 0x9B, 0x33, 0x52, 0x87, 0x37, 0xB2,
-    0xD9, 0x5B, 0x37, 0x5B, 0x2B, 0x2B, 0x35, 0x5B, 0x36, 0x73, 0x36, 0xE9, 0x5E, 0xBF, 0xE1, 0x9C,
-    0xF9, 0x67, 0xCB, 0x2F, 0x32, 0x67, 0xEE, 0x2F, 0x63, 0xB9, 0xFB, 0xE1, 0x90, 0x7B, 0xBD, 0x9A,
-    0xE1, 0xB7, 0x39, 0x67, 0xC5, 0x81, 0x39, 0x73, 0xE3, 0x2B, 0x40, 0x98, 0x1C, 0x1A, 0xBA, 0x8B,
-    0x5E, 0xD6, 0x5F, 0xC2, 0xCC, 0xE0, 0x13, 0x3E, 0x4C, 0xB2, 0x1E, 0x66, 0xA3, 0x10, 0xFF, 0xF5,
-    0xD4, 0x78, 0x9A, 0x1B, 0x2C, 0xA8, 0x70, 0xE3, 0xB8, 0x32, 0xFB, 0xF0, 0x96, 0xDA, 0x5A, 0x99,
-    0x77, 0x13, 0xD8, 0xC3, 0x82, 0x1B, 0x22, 0xD3, 0xD7, 0xF4, 0xD5, 0x8A, 0x49, 0x3D, 0xBA, 0x11,
-    0xC0, 0xA3, 0x7F, 0xA9, 0xC0, 0xCF, 0xDC, 0x0C, 0x18, 0xB9, 0x7F, 0xEE, 0xCE, 0xC3, 0xED, 0x9F,
-    0xA3, 0xC1, 0x5B, 0x0C, 0x86, 0x83, 0x7D, 0x81, 0xA7, 0xC5, 0x3D, 0x0C, 0x09, 0x68, 0xFA, 0xFB,
-    0x58, 0xE2, 0xD2, 0xC9, 0x4D, 0x5E, 0xC3, 0xE5, 0x06, 0x94, 0x52, 0xBC, 0xF6, 0xCD, 0xD2, 0x0C,
-    0x72, 0x30, 0x80, 0x7B, 0x93, 0xBB, 0x01, 0x08, 0xF7, 0xD3, 0xEE, 0x1D, 0x15, 0xC3, 0x3C, 0x49,
-    0x0D, 0x37, 0xE8, 0xB9, 0x18, 0x33, 0x4E, 0xBB, 0xC2, 0x19, 0x21, 0x45, 0x75, 0x2F, 0x40, 0x74,
-    0xFD, 0xC0, 0xF5, 0x7E, 0xD0, 0x9C, 0x49, 0xA0, 0x39, 0x25, 0x5F, 0x25, 0x50, 0x51, 0xDF, 0xBC,
-    0x6C, 0x3B, 0x02, 0x83, 0xAE, 0x7A, 0x62, 0xFD, 0x7D, 0x6E, 0x5E, 0xEE, 0x24, 0x1D, 0x54, 0x7B,
-    0x45, 0x65, 0x12, 0xD0, 0x91, 0x51, 0x07, 0x66, 0xB2, 0xE9, 0x9D, 0x8D, 0xED, 0x3B, 0x05, 0x62,
-    0x48, 0xEE, 0x00, 0xFA, 0x6A, 0x47, 0x21, 0x97, 0x8F, 0xEC, 0x3A, 0xED, 0x3D, 0xA2, 0xF6, 0xB8,
-    0xF6, 0x1A, 0x75, 0x20, 0x12, 0x5D, 0x83, 0x29, 0xC1, 0xA6, 0xC6, 0x50, 0x18, 0xFF, 0x52, 0x29,
-    0x76, 0xFC, 0xFC, 0x57, 0x39, 0x24, 0x53, 0xF5, 0x3A, 0x09, 0x59, 0x4A, 0x51, 0x2F, 0xA6, 0xB2,
-    0xD6, 0x13, 0xE7, 0x66, 0xBA, 0xB7, 0x49, 0xE6, 0x31, 0x6D, 0x26, 0x26, 0xB7, 0x20, 0x64, 0xEE,
-    0xE7, 0x15, 0x73, 0x43, 0x0B, 0x11, 0x68, 0xA6, 0xAB, 0xC5, 0xF8, 0x58, 0x7E, 0x6F, 0xF8, 0x16,
-    0x75, 0xC1, 0xE1, 0x94, 0xEF, 0x4B, 0xEC, 0x24, 0x91, 0xD9, 0xE4, 0x38, 0x77, 0xFE, 0x60, 0xF8,
-    0x26, 0xE6, 0x75, 0xAA, 0xCB, 0xE8, 0xA7, 0xB2, 0xE2, 0x6F, 0x76, 0x4B, 0x93, 0xCA, 0xE1, 0x43,
-    0x7B, 0x75, 0x6E, 0x4F, 0x07, 0x55, 0x50, 0x32, 0x70, 0x1B, 0x40, 0x71, 0x2A, 0xB3, 0x2F, 0x3B,
-    0x75, 0x7F, 0xBB, 0xC8, 0x7A, 0x8A, 0xC8, 0xBF, 0xDE, 0xDB, 0x97, 0x6D, 0x25, 0xAC, 0xB8, 0x7D,
-    0xF1, 0x17, 0x71, 0x53, 0xC3, 0x19, 0xD7, 0x4C, 0xF4, 0xC7, 0x4D, 0x5F, 0xE9, 0xC3, 0x6D, 0x9A,
-    0x6C, 0xCC, 0x3B, 0xBC, 0x7C, 0x3D, 0x23, 0x62, 0xE0, 0xE9, 0xB6, 0x3B, 0x4B, 0x2E, 0xB3, 0x7A,
-    0x38, 0x26, 0xB0, 0xB9, 0xF7, 0x46, 0x1F, 0x73, 0x43, 0x96, 0x12, 0x8C, 0x31, 0xBD, 0x37, 0xE5,
-    0x56, 0xAF, 0xCF, 0x78, 0x79, 0xC7, 0x9C, 0x02, 0xBF, 0x70, 0xBA, 0xA5, 0x23, 0x5E, 0xAD, 0xCD,
-    0x1B, 0x3B, 0x19, 0x4F, 0x07, 0xE6, 0x3D, 0x1E, 0x73, 0x3A, 0xE2, 0xA9, 0x9F, 0x8E, 0xEC, 0x26,
-    0x29, 0xB0, 0xD4, 0x7A, 0x53, 0xCD, 0x5C, 0xF2, 0x7C, 0x44, 0xE2, 0x75, 0xAB, 0xEC, 0x0E, 0xF7,
-    0x12, 0xAF, 0xC7, 0xB3, 0x37, 0xF8, 0x4B, 0x6D, 0x6A, 0x69, 0xBA, 0x2D, 0x8A, 0x22, 0x87, 0x0B,
-    0xA3, 0xE8, 0x61, 0xF4, 0xE0, 0x19, 0x3F, 0xB8, 0xD3, 0xA5, 0x7D, 0x6B, 0x1A, 0x94, 0x15, 0x3F,
-    0xE7, 0x62, 0xEE, 0x0E, 0xFB, 0xEE, 0xE3, 0x7A, 0x15, 0x0F, 0xF1, 0x38, 0x56, 0x4D, 0xA7, 0xF6,
-    0xEC, 0x1D, 0x76, 0x6B, 0xB6, 0xDB, 0x71, 0x91, 0x7B, 0x52, 0xF2, 0x47, 0x2D, 0x81, 0x38, 0x88,
-    0x96, 0x4C, 0xBA, 0xBD, 0x55, 0xD1, 0xB6, 0xEA, 0x29, 0x76, 0x62, 0x62, 0x93, 0x03, 0x32, 0xC7,
-    0xFB, 0x65, 0x56, 0x3F, 0x88, 0x4C, 0xB1, 0xC6, 0xBA, 0xDA, 0xEE, 0x26, 0x4D, 0x1F, 0x24, 0xB3,
-    0x75, 0xE0, 0xF5, 0xC1, 0xFD, 0x82, 0x8D, 0xF6, 0x04, 0x4B, 0x40, 0x50, 0x2E, 0x4E, 0x23, 0xE9,
-    0x95, 0x07, 0xB7, 0xE0, 0xFF, 0x5F, 0x95, 0x54, 0x3D, 0x6C, 0x1C, 0x45, 0x14, 0xFE, 0x76, 0xE7,
-    0xCC, 0x0A, 0x8F, 0xED, 0xB9, 0xC2, 0x29, 0x22, 0xD9, 0xB7, 0x0D, 0x48, 0x8E, 0xE4, 0xF3, 0xA5,
-    0x70, 0x71, 0x42, 0xBB, 0x7B, 0x1B, 0x5F, 0x41, 0x41, 0x61, 0x17, 0xBE, 0xD6, 0x81, 0x06, 0xD1,
-    0x20, 0x22, 0x71, 0x85, 0x8B, 0xB3, 0xBC, 0xE4, 0x24, 0x2C, 0x44, 0x13, 0x21, 0xBA, 0x34, 0x16,
-    0x34, 0xC1, 0x29, 0xB8, 0xE2, 0x22, 0x19, 0xE9, 0x1C, 0xCF, 0xD9, 0x45, 0x24, 0x28, 0x98, 0xC8,
-    0x25, 0x05, 0x43, 0x10, 0x14, 0xAE, 0xA6, 0x58, 0xA4, 0x4D, 0xB8, 0xF3, 0xF2, 0x76, 0xEF, 0x8E,
-    0x80, 0x64, 0xE5, 0x67, 0x66, 0x76, 0xDE, 0xCC, 0xFB, 0x9B, 0x79, 0xEF, 0x7D, 0x3B, 0x6F, 0x7C,
-    0x38, 0x69, 0x00, 0x9B, 0xA9, 0x44, 0xA6, 0xD6, 0xFF, 0xFA, 0x4D, 0xDC, 0xB9, 0x74, 0x20, 0x6B,
-    0x0A, 0xD5, 0xC6, 0xD6, 0xF9, 0xF7, 0x72, 0x41, 0xEE, 0xF7, 0x23, 0x89, 0x17, 0xF5, 0x90, 0xD4,
-    0x1D, 0x2C, 0xE0, 0x41, 0xE3, 0xD9, 0xFD, 0x55, 0x36, 0xCD, 0xEC, 0x3A, 0xD8, 0x0B, 0xBB, 0xD5,
-    0xD8, 0x4C, 0x87, 0x07, 0xF7, 0xC6, 0x33, 0x91, 0xF4, 0x82, 0xE6, 0x46, 0xA3, 0x51, 0x4B, 0xD3,
-    0x3F, 0x1A, 0x8D, 0x8D, 0x46, 0xDE, 0x76, 0xD3, 0xAC, 0xFD, 0x95, 0xAF, 0x37, 0x2F, 0x61, 0xCD,
-    0x4F, 0xB5, 0xDC, 0xD7, 0xEB, 0x1F, 0x4D, 0x93, 0x35, 0xF9, 0x50, 0x80, 0x7D, 0x70, 0xF0, 0x1D,
-    0x6D, 0x22, 0xBA, 0xBA, 0xC5, 0x4E, 0xA5, 0x39, 0xAC, 0x71, 0x15, 0x4F, 0x71, 0x95, 0x04, 0xA2,
-    0x7E, 0xA2, 0x34, 0x9C, 0x3E, 0xAD, 0xDA, 0x7D, 0x6D, 0x8A, 0x98, 0x77, 0xD7, 0x4F, 0x74, 0x4B,
-    0x58, 0x6A, 0xD9, 0x42, 0x68, 0x3C, 0x4F, 0x30, 0x52, 0x5F, 0x11, 0xA7, 0xE6, 0xA8, 0x52, 0x27,
-    0x1B, 0x6B, 0x2D, 0x3E, 0x12, 0x6D, 0x9D, 0x19, 0x2A, 0xE3, 0x95, 0x79, 0x3D, 0xD2, 0xE4, 0xD3,
-    0xB4, 0xDC, 0xBD, 0x8C, 0xD7, 0xD6, 0xC6, 0x2B, 0x39, 0x6D, 0x69, 0x8A, 0x05, 0xCC, 0x4F, 0x39,
-    0x8F, 0xE3, 0x41, 0x8D, 0xDF, 0xD6, 0x2D, 0x97, 0x7C, 0x2C, 0x3A, 0x61, 0x67, 0x19, 0xD7, 0x80,
-    0x00, 0xF0, 0xF3, 0xE1, 0xA1, 0xF6, 0xF0, 0xA2, 0x96, 0x5E, 0x14, 0x97, 0x81, 0xD1, 0xF0, 0x26,
-    0xA2, 0xD1, 0x08, 0xF2, 0xD2, 0x5C, 0x6A, 0xE2, 0x15, 0xC6, 0x0A, 0x39, 0xFF, 0x6D, 0xFF, 0x2A,
-    0x31, 0x83, 0x9D, 0x8F, 0x9F, 0x1B, 0xE6, 0xB6, 0x2B, 0xEF, 0x0D, 0xD2, 0x5F, 0x06, 0xB5, 0x10,
-    0x6F, 0xC1, 0x55, 0x4E, 0x7A, 0x23, 0x1D, 0xEE, 0xA6, 0xBF, 0xA6, 0x7B, 0x17, 0x56, 0x82, 0x22,
-    0x49, 0xDD, 0x53, 0x8A, 0x17, 0x88, 0xF9, 0x97, 0x66, 0xD7, 0x8D, 0x06, 0xC8, 0x4B, 0x0B, 0x88,
-    0x88, 0x4B, 0xE7, 0x27, 0xC3, 0x0C, 0x7B, 0x9A, 0x60, 0x80, 0xA3, 0x02, 0xB2, 0x7E, 0x55, 0x3C,
-    0x32, 0xDD, 0x11, 0x52, 0xC2, 0x2D, 0xF5, 0x7A, 0x48, 0xB1, 0x9E, 0x39, 0xAF, 0x86, 0x14, 0xAA,
-    0x54, 0xC4, 0xF5, 0xB5, 0x7B, 0x1F, 0x7C, 0x61, 0x45, 0x2F, 0xEF, 0x94, 0xF8, 0x02, 0xA6, 0x57,
-    0x31, 0x5D, 0xBD, 0xB2, 0xB5, 0x74, 0xDE, 0xFB, 0xD4, 0x7A, 0x34, 0xB3, 0x70, 0xEB, 0xFA, 0xE7,
-    0x74, 0x32, 0x03, 0x66, 0x80, 0xEB, 0x78, 0xC9, 0x32, 0x8B, 0xBE, 0x80, 0x85, 0x7D, 0xFB, 0x47,
-    0x2C, 0x3F, 0xD8, 0x3C, 0x3B, 0xEF, 0x9C, 0x85, 0xF2, 0xDB, 0x3A, 0xBE, 0x7A, 0x15, 0xDB, 0xC9,
-    0xB2, 0x80, 0x49, 0xDB, 0xA0, 0xCB, 0x67, 0x11, 0x0F, 0xC1, 0x24, 0x51, 0xF7, 0x66, 0xC8, 0x33,
-    0xB6, 0xE7, 0xC8, 0x52, 0x46, 0x5B, 0x4C, 0x7A, 0x19, 0xDD, 0x66, 0xB2, 0x39, 0xA6, 0x66, 0x44,
-    0x4F, 0x64, 0x76, 0x11, 0x8F, 0xB7, 0x6F, 0xA7, 0xA8, 0xC4, 0x95, 0x9B, 0x5C, 0xDC, 0x95, 0x3F,
-    0xF4, 0xC4, 0x60, 0xB1, 0xC4, 0x94, 0x59, 0x41, 0xE8, 0x95, 0xAD, 0xDF, 0xB4, 0x0B, 0x74, 0x7C,
-    0xEB, 0x89, 0x12, 0x80, 0xF6, 0x72, 0x6A, 0x4B, 0xDF, 0x7E, 0xA2, 0x4B, 0x70, 0xA2, 0x15, 0xD6,
-    0x37, 0x65, 0x08, 0x88, 0xBB, 0xD1, 0xD3, 0x1E, 0xCA, 0x70, 0x2E, 0x50, 0x33, 0x19, 0xA0, 0x36,
-    0x30, 0xF5, 0xEF, 0xF5, 0x60, 0xAB, 0xA4, 0x15, 0xB8, 0x84, 0xD8, 0x7C, 0xD7, 0x2D, 0x8B, 0xF6,
-    0x63, 0xD3, 0x0B, 0xC4, 0x5E, 0xDF, 0x74, 0xFD, 0x39, 0x16, 0x8D, 0xB5, 0x08, 0xD2, 0x32, 0xF1,
-    0xDD, 0x77, 0x4F, 0x32, 0x19, 0x69, 0xB4, 0x2A, 0x9C, 0x90, 0x5E, 0x9D, 0x63, 0x23, 0x70, 0x30,
-    0x19, 0xD8, 0x46, 0x84, 0x3D, 0xA6, 0x66, 0xF3, 0xBD, 0x29, 0x31, 0xDD, 0xE3, 0x32, 0x16, 0x6B,
-    0xA6, 0xC2, 0x94, 0xEF, 0xC8, 0x55, 0x3E, 0x76, 0x24, 0x2C, 0xED, 0x91, 0x8C, 0x74, 0x45, 0xDD,
-    0x90, 0xD8, 0xB7, 0x8D, 0xCF, 0x25, 0x69, 0x18, 0x16, 0x76, 0x46, 0xC6, 0x78, 0x1F, 0x8E, 0xC6,
-    0x8E, 0x76, 0xFA, 0xBA, 0x65, 0xE9, 0x8C, 0xB1, 0xEA, 0xC8, 0x16, 0x57, 0x01, 0xC1, 0xAE, 0x87,
-    0x43, 0x6C, 0x03, 0xB7, 0x10, 0x23, 0xB6, 0x12, 0x3A, 0x53, 0x26, 0x22, 0x6A, 0x8E, 0x7D, 0xEF,
-    0x53, 0x09, 0xAA, 0x76, 0x58, 0x9D, 0x73, 0xA4, 0x66, 0x6B, 0xF5, 0xC8, 0xCA, 0xD2, 0xD2, 0xA4,
-    0x80, 0x17, 0x3B, 0x70, 0xE9, 0x04, 0x97, 0x53, 0x6E, 0x17, 0x3A, 0x39, 0xCF, 0x52, 0x1C, 0xAC,
-    0xDE, 0x96, 0xB3, 0xA4, 0x9B, 0xD9, 0xEC, 0xE7, 0xE5, 0x03, 0x96, 0xF0, 0x8D, 0x11, 0x3F, 0xCB,
-    0x20, 0x40, 0x92, 0xB0, 0x33, 0x2D, 0xD6, 0x43, 0xDF, 0x87, 0x89, 0xD9, 0xA9, 0x12, 0x9C, 0x52,
-    0x0E, 0xD3, 0xB4, 0xFB, 0x6A, 0x1C, 0xCC, 0xB6, 0xF5, 0x7B, 0x4C, 0xBA, 0xB5, 0x02, 0x8A, 0xFF,
-    0x79, 0xB7, 0xD6, 0x87, 0x07, 0xA3, 0xAC, 0x65, 0x75, 0xA7, 0x5A, 0xD2, 0xEF, 0x51, 0xCD, 0xFF,
-    0xE3, 0x39, 0x8A, 0x9E, 0x80, 0x10, 0x66, 0x40, 0xB0, 0x08, 0x0B, 0x14, 0x5A, 0x67, 0x22, 0x5B,
-    0xCC, 0x65, 0x3C, 0x97, 0xD9, 0x6A, 0x84, 0xC1, 0xBC, 0xB9, 0x1A, 0x69, 0x58, 0x1B, 0xDA, 0xA9,
-    0x7E, 0xE7, 0xF8, 0xC6, 0x9F, 0x09, 0xB8, 0xA4, 0x5F, 0x99, 0x94, 0x4A, 0x14, 0x01, 0x99, 0xD8,
-    0xD9, 0xE4, 0x4A, 0xEB, 0xA1, 0x93, 0x46, 0x95, 0x81, 0x18, 0x62, 0x57, 0x8B, 0x3B, 0xD8, 0x01,
-    0xCF, 0x1C, 0x3B, 0xB9, 0xF7, 0xE7, 0x95, 0xCE, 0xAC, 0xB8, 0x46, 0x0D, 0x8E, 0xA2, 0xC9, 0x0A,
-    0x47, 0x28, 0x9D, 0x76, 0x12, 0x88, 0xD3, 0x54, 0x31, 0x7D, 0x3E, 0x44, 0x76, 0x00, 0x3D, 0x15,
-    0x54, 0x4B, 0x2C, 0x32, 0x45, 0x17, 0x8A, 0xC9, 0xBB, 0x6F, 0xA5, 0x5A, 0x84, 0xA4, 0xA1, 0x82,
-    0x10, 0x5D, 0x72, 0x5D, 0xA6, 0xEB, 0xF3, 0xFF, 0xF9, 0xB5, 0xC9, 0x87, 0xDA, 0x01, 0x33, 0x84,
-    0xAC, 0xE2, 0x12, 0x31, 0x7B, 0xF6, 0x05, 0x06, 0x2C, 0x95, 0x09, 0xBB, 0x6F, 0x12, 0xE0, 0x90,
-    0x3E, 0x2F, 0xA6, 0x50, 0xE3, 0x9C, 0x5A, 0x83, 0x18, 0xC7, 0x71, 0x17, 0xA9, 0xEA, 0xD2, 0x91,
-    0x4D, 0x4A, 0x53, 0x93, 0x6A, 0x3A, 0x69, 0xDB, 0x74, 0xED, 0x21, 0x8E, 0xB2, 0x57, 0x86, 0x12,
-    0x51, 0x1C, 0xE7, 0xC1, 0xFA, 0xEC, 0xEF, 0xE1, 0x27, 0x73, 0xD6, 0x31, 0xBD, 0x4E, 0x57, 0x46,
-    0x7A, 0x7C, 0x8D, 0x1E, 0x5B, 0x42, 0x63, 0xDC, 0x72, 0xF9, 0x89, 0x19, 0x04, 0x93, 0xA5, 0xEE,
-    0xFA, 0xF4, 0x3E, 0xEB, 0xEA, 0xAC, 0x33, 0x42, 0xE7, 0x3F, 0x4D, 0x90, 0x31, 0x6F, 0x13, 0x31,
-    0x18, 0x86, 0x5F, 0x9F, 0x51, 0x2C, 0x38, 0x09, 0x2F, 0x64, 0x80, 0xA1, 0xFE, 0x05, 0x97, 0x5B,
-    0x19, 0x2E, 0xC4, 0x81, 0x81, 0xB1, 0x19, 0x2A, 0x7E, 0x03, 0x05, 0x89, 0xAE, 0x19, 0xD2, 0xF4,
-    0x68, 0x06, 0xD6, 0x08, 0x21, 0x46, 0x18, 0xD8, 0xCA, 0x7A, 0x03, 0x43, 0xCA, 0x19, 0x75, 0x60,
-    0xE4, 0x0A, 0x6C, 0x2C, 0x06, 0x24, 0x06, 0x3A, 0xF4, 0x43, 0xBA, 0x88, 0x43, 0x84, 0x7C, 0x38,
-    0x09, 0x03, 0xFE, 0x46, 0xFB, 0x7D, 0xFC, 0x7E, 0x0F, 0x76, 0x61, 0x18, 0xCD, 0x38, 0xCE, 0x47,
-    0x5D, 0x10, 0xC9, 0x0F, 0x4E, 0x6F, 0x23, 0xEB, 0x0A, 0x9A, 0xE9, 0x7C, 0xB9, 0x40, 0x99, 0x23,
-    0x1C, 0x01, 0x74, 0x21, 0x6B, 0xA4, 0x95, 0x38, 0xB3, 0x3A, 0x01, 0x15, 0xF1, 0xD3, 0x8F, 0x3D,
-    0xA6, 0xF6, 0xD8, 0xA2, 0x40, 0x54, 0xAD, 0x9E, 0xEC, 0x48, 0x76, 0xF3, 0xC1, 0x75, 0xE8, 0xA9,
-    0x62, 0x28, 0x42, 0x06, 0x8D, 0xF8, 0xB0, 0x74, 0x6C, 0x57, 0x84, 0xAB, 0xE8, 0x55, 0xE3, 0x00,
-    0xE9, 0x0D, 0x34, 0x3F, 0x7A, 0x33, 0xF7, 0x66, 0xA4, 0xDE, 0xDD, 0xFC, 0xC2, 0x94, 0xFA, 0x70,
-    0xD9, 0xDE, 0x29, 0x79, 0xBE, 0xE7, 0x33, 0x14, 0x82, 0xA4, 0x53, 0x2E, 0xB6, 0x3A, 0x84, 0x2F,
-    0xAF, 0xA8, 0x4F, 0x24, 0x1F, 0x56, 0x44, 0x49, 0xC7, 0x44, 0x0C, 0xAE, 0xEA, 0xFD, 0xA1, 0x7A,
-    0x16, 0x7D, 0xFD, 0xB6, 0xC9, 0x89, 0xA9, 0xE4, 0x5B, 0xA7, 0x3F, 0xA8, 0x13, 0x60, 0xFD, 0xCF,
-    0xDC, 0x98, 0x3F, 0x30, 0x30, 0xFD, 0xD2, 0x2E, 0x57, 0x5F, 0x5E, 0xB8, 0x22, 0x7F, 0x2F, 0x5A,
-    0xF5, 0x2B, 0x95, 0xD3, 0x96, 0x74, 0x43, 0x2D, 0x7C, 0x16, 0x3F, 0xAC, 0xCB, 0x6D, 0x12, 0x4B,
-    0xA4, 0xDC, 0xA7, 0x34, 0xB6, 0x59, 0xF6, 0x6F, 0x65, 0xBD, 0x5E, 0x79, 0xDF, 0xD8, 0xB2, 0xC6,
-    0x6E, 0xC8, 0x46, 0xAE, 0x74, 0xF7, 0x9D, 0xFC, 0x6F, 0x54, 0x75, 0xB0, 0x68, 0x0F, 0x5A, 0x4D,
-    0x7C, 0x7E, 0xE2, 0x6A, 0xDF, 0x0D, 0xFD, 0xB4, 0xD5, 0x79, 0x18, 0xAB, 0xBF, 0xBF, 0xE0, 0x70,
-    0x15, 0x37, 0xFA, 0x7C, 0x62, 0x09, 0x43, 0xCC, 0x42, 0xD5, 0x3B, 0x1B, 0x01, 0x66, 0xC2, 0x79,
-    0xE0, 0xC5, 0x16, 0xC7, 0x50, 0x75, 0x70, 0x20, 0x3F, 0xD9, 0x24, 0x11, 0xBE, 0xD0, 0x2F, 0x9B,
-    0x94, 0x09, 0x09, 0x82, 0x3F, 0x91, 0x5F, 0x3A, 0x0A, 0xF2, 0x08, 0x41, 0x5E, 0x1D, 0x95, 0x56,
-    0xAC, 0xB2, 0x06, 0xE9, 0x6D, 0xB6, 0x21, 0xBB, 0x67, 0x5F, 0xDB, 0x19, 0x66, 0xE8, 0x35, 0x86,
-    0xDF, 0xE6, 0xBF, 0xD6, 0xE6, 0x26, 0xA7, 0xEC, 0x5B, 0xD3, 0x7B, 0x47, 0xCC, 0x3E, 0x99, 0x8E,
-    0x40, 0xC2, 0x87, 0x82, 0xF9, 0x46, 0xDA, 0x45, 0xA8, 0x46, 0x9D, 0x9D, 0xB8, 0x82, 0x32, 0xF3,
-    0x20, 0x62, 0xF1, 0x93, 0xE8, 0xC6, 0x50, 0x3D, 0x97, 0xEF, 0xD9, 0x5F, 0xB3, 0x6A, 0xDD, 0x7F,
-    0x4E, 0x5B, 0x01, 0xF2, 0xD8, 0x73, 0xD3, 0x9A, 0xA1, 0x83, 0x83, 0x68, 0x89, 0xBB, 0xF8, 0x0B,
-    0x2D, 0x8F, 0x31, 0x4B, 0xC4, 0x40, 0x14, 0x84, 0xBF, 0x64, 0x3D, 0x0E, 0x0C, 0xB8, 0x36, 0xC7,
-    0x81, 0x82, 0x69, 0xEC, 0xD3, 0x58, 0x26, 0x97, 0xC5, 0x5F, 0x70, 0x8D, 0x95, 0xA5, 0xE5, 0xFD,
-    0x05, 0xE1, 0xF6, 0x1F, 0xDC, 0xDF, 0x10, 0x9B, 0xB4, 0x16, 0x8A, 0xC1, 0xD6, 0x26, 0x8D, 0x7D,
-    0x10, 0xAC, 0x6F, 0x8B, 0x14, 0x41, 0xBC, 0x3C, 0x77, 0x57, 0x5F, 0x33, 0x0C, 0xF3, 0xE6, 0xCD,
-    0x1B, 0x20, 0x17, 0xF9, 0x14, 0x19, 0xB5, 0x39, 0x51, 0x9D, 0xB2, 0x03, 0xA6, 0x02, 0x6D, 0x50,
-    0x72, 0x40, 0xE4, 0x9F, 0x6C, 0xBE, 0xFD, 0x5A, 0xC7, 0x1F, 0x39, 0x0F, 0xA4, 0x05, 0x4E, 0x61,
-    0x3B, 0x90, 0x37, 0xAD, 0xEA, 0x2A, 0xEE, 0xD3, 0x2E, 0xB3, 0x30, 0xF8, 0x15, 0x28, 0xE4, 0x27,
-    0x69, 0x6E, 0x4C, 0xE2, 0x98, 0x8B, 0xB0, 0xFC, 0x5A, 0x53, 0x82, 0xF2, 0x9E, 0x27, 0x78, 0x15,
-    0x79, 0xDF, 0xCB, 0x78, 0xC9, 0x02, 0x16, 0x86, 0x30, 0x22, 0x43, 0x80, 0x54, 0x6E, 0xC7, 0xC8,
-    0xC7, 0xD4, 0x05, 0x50, 0xBD, 0xEA, 0x02, 0x6A, 0xAB, 0x6D, 0xC8, 0x5B, 0x51, 0x65, 0x51, 0x4E,
-    0x5C, 0xC5, 0x6C, 0xAD, 0xFA, 0x7C, 0x27, 0x4E, 0x9C, 0xDE, 0x8F, 0xCB, 0x8F, 0xEC, 0xBA, 0xAD,
-    0x27, 0xA3, 0x29, 0x67, 0xF8, 0x1B, 0x25, 0x2F, 0xDE, 0x0D, 0x0E, 0xF1, 0xDE, 0x90, 0xBC, 0x6D,
-    0x57, 0xF1, 0x33, 0x1D, 0xE4, 0x8A, 0xBE, 0xF4, 0x2D, 0x38, 0xDC, 0xBD, 0x39, 0x5F, 0x33, 0x91,
-    0xDD, 0x14, 0x73, 0x49, 0xC2, 0x3F, 0x47, 0x90, 0x49, 0x8F, 0x34, 0xAD, 0x6E, 0x2F, 0x78, 0xE6,
-    0x6A, 0xDE, 0x61, 0x0A, 0x38, 0x9E, 0x1E, 0xA9, 0x65, 0x24, 0x27, 0xB6, 0x3A, 0x9B, 0x1E, 0x62,
-    0x86, 0xF6, 0xAF, 0xE5, 0xBE, 0x79, 0x6D, 0x93, 0x28, 0x17, 0x62, 0xC3, 0x9D, 0x5F, 0x6D, 0x51,
-    0x3B, 0x4B, 0x03, 0x41, 0x10, 0xFE, 0xEE, 0x56, 0x39, 0xF4, 0xD0, 0xB5, 0x30, 0x90, 0x26, 0x6A,
-    0x61, 0x61, 0x71, 0x31, 0x96, 0x16, 0xA7, 0xD9, 0x90, 0x1F, 0x60, 0x9A, 0xAB, 0x6C, 0xAC, 0xD3,
-    0xA8, 0x90, 0x42, 0x7C, 0xE0, 0x59, 0xA7, 0xB1, 0xC9, 0x5F, 0x10, 0xBC, 0xCA, 0x22, 0xA2, 0x9D,
-    0x07, 0x16, 0x76, 0xF1, 0xFC, 0x01, 0xC1, 0x33, 0x22, 0x82, 0x85, 0x2C, 0xE6, 0x40, 0xC1, 0xC7,
-    0x3A, 0x9B, 0x33, 0xA2, 0xE8, 0x72, 0xB3, 0x3B, 0xAF, 0xFB, 0xE6, 0x9B, 0x19, 0x00, 0xB0, 0x7C,
-    0x60, 0x1B, 0x60, 0x21, 0xB0, 0xE0, 0x05, 0x07, 0x4A, 0xA9, 0xDB, 0x08, 0x83, 0x2C, 0x22, 0x97,
-    0x16, 0x81, 0xF4, 0x8C, 0x81, 0x49, 0x14, 0x25, 0x6B, 0x4B, 0x77, 0x4D, 0xEE, 0x5D, 0xF9, 0x96,
-    0x40, 0x0E, 0xA8, 0xC1, 0x88, 0xF0, 0x47, 0xED, 0x9F, 0x26, 0x49, 0x42, 0x22, 0xAB, 0x87, 0xDE,
-    0x13, 0x01, 0xDF, 0x08, 0x4C, 0x02, 0x86, 0x84, 0x7E, 0xB0, 0x96, 0x26, 0x4D, 0xFD, 0x0B, 0xF1,
-    0xA5, 0x8E, 0xE4, 0x9C, 0xFC, 0x7A, 0x3C, 0xFB, 0x88, 0x42, 0x8C, 0xD9, 0x3E, 0xAC, 0x2D, 0x6A,
-    0xD8, 0x40, 0x93, 0x88, 0x37, 0x77, 0x3C, 0xEF, 0x99, 0x80, 0xBB, 0x21, 0x38, 0x35, 0x20, 0x59,
-    0xC8, 0x61, 0x61, 0xAE, 0x0F, 0x4C, 0x8C, 0x77, 0x13, 0xAB, 0x9D, 0xB8, 0x35, 0x59, 0x8A, 0xC4,
-    0x2F, 0xE0, 0xA1, 0x5C, 0x96, 0xBC, 0x0B, 0xD7, 0xD4, 0x12, 0x8A, 0xBA, 0xBB, 0x34, 0x3D, 0x6D,
-    0xF0, 0x57, 0x7A, 0x29, 0x2A, 0x5F, 0x2C, 0x91, 0x97, 0x29, 0x4A, 0x30, 0x96, 0x1B, 0x05, 0xF5,
-    0x91, 0xF1, 0x2A, 0x40, 0x05, 0x66, 0x44, 0x54, 0x90, 0xD7, 0x7D, 0x9A, 0x21, 0x6C, 0xB8, 0x0E,
-    0x0B, 0x8F, 0x5C, 0xF3, 0xFC, 0x6E, 0x79, 0x52, 0xBD, 0x11, 0xDB, 0x7C, 0xEF, 0x9B, 0xD1, 0x5C,
-    0xC6, 0x61, 0xC4, 0x7A, 0xD2, 0x13, 0x20, 0xE6, 0xA4, 0x32, 0x1F, 0xA3, 0x1C, 0xF3, 0x1C, 0x31,
-    0x67, 0x8D, 0x55, 0xAE, 0xDE, 0x61, 0xC6, 0x14, 0xA4, 0x6B, 0x38, 0x25, 0x6F, 0xE8, 0xB1, 0x0D,
-    0xC0, 0xE5, 0xE0, 0x5C, 0xB0, 0x4B, 0x81, 0xD7, 0x87, 0xE0, 0x4C, 0xA9, 0x0F, 0x37, 0xDD, 0x14,
-    0x3D, 0x26, 0x65, 0xAC, 0xD0, 0xFA, 0x7A, 0x56, 0x86, 0x51, 0x6C, 0x31, 0x08, 0x0E, 0xF4, 0xCA,
-    0x68, 0x20, 0x65, 0x32, 0x75, 0x9E, 0x16, 0xE3, 0x7B, 0x18, 0xAE, 0xB4, 0x3A, 0xC9, 0x56, 0xFD,
-    0xB8, 0xE5, 0x44, 0xF3, 0x47, 0xE8, 0x84, 0xAC, 0x8E, 0x51, 0x07, 0x3F, 0xD4, 0x71, 0xEA, 0x0B,
-    0xD3, 0xBA, 0xB4, 0x51, 0x81, 0x2C, 0x28, 0x25, 0xAB, 0x41, 0x40, 0xEB, 0x32, 0xEE, 0x09, 0x53,
-    0x9B, 0x00, 0xD7, 0xD1, 0x1E, 0xE8, 0x9F, 0xBF, 0xBF, 0x54, 0xB3, 0xE5, 0xDC, 0xBE, 0x9C, 0xB1,
-    0x8E, 0x64, 0xD7, 0xBA, 0xA8, 0x2E, 0xBF, 0x9F, 0x85, 0xED, 0x9F, 0xD2, 0x9C, 0x4E, 0x6D, 0xA5,
-    0x5E, 0x36, 0x83, 0xE0, 0x84, 0x78, 0x75, 0x09, 0xD3, 0x52, 0x2A, 0xB1, 0x7C, 0x5B, 0x58, 0x7E,
-    0x13, 0x03, 0x10, 0xF8, 0x04, 0xA5, 0x57, 0xBF, 0x6F, 0x1C, 0x45, 0x14, 0x7E, 0xBB, 0x6B, 0x67,
-    0x80, 0x15, 0x5E, 0x17, 0x36, 0x02, 0x92, 0xCB, 0x51, 0xA4, 0x88, 0x80, 0xBB, 0x6D, 0x50, 0x64,
-    0xA4, 0xFB, 0xB1, 0x84, 0x22, 0x05, 0x05, 0x46, 0xF1, 0x86, 0x2A, 0x82, 0x1A, 0x24, 0x42, 0x61,
-    0x90, 0x05, 0x67, 0xDF, 0x86, 0x14, 0xB4, 0xF9, 0x0F, 0x70, 0x91, 0x02, 0x36, 0x85, 0x2D, 0x94,
-    0xE2, 0x22, 0xD9, 0xB9, 0x05, 0x17, 0x29, 0x22, 0x91, 0x75, 0xA2, 0x88, 0x22, 0x05, 0x2B, 0x22,
-    0x0B, 0xE1, 0x6A, 0x90, 0x16, 0x58, 0xD9, 0x77, 0x3B, 0x7C, 0x6F, 0x76, 0xCF, 0x76, 0xA2, 0x28,
-    0x21, 0xC9, 0xFA, 0xD6, 0xBE, 0xF9, 0xF5, 0xE6, 0x7B, 0x6F, 0xBE, 0xF9, 0xDE, 0xF3, 0x14, 0xD1,
-    0x78, 0x35, 0x20, 0xEB, 0xB6, 0x24, 0x53, 0xAE, 0x13, 0xA5, 0x4E, 0x40, 0x1D, 0x53, 0x52, 0x9D,
-    0xBA, 0x4A, 0x91, 0xA3, 0x54, 0x64, 0x4A, 0x2B, 0xA6, 0x16, 0x49, 0x72, 0xA2, 0x1E, 0x19, 0xB2,
-    0x41, 0xD4, 0x3A, 0x4A, 0x64, 0xDF, 0xF0, 0x88, 0xFE, 0x8D, 0x88, 0xDA, 0x31, 0x91, 0x90, 0x84,
-    0x95, 0x54, 0x3C, 0x06, 0x91, 0x3B, 0xA4, 0xFA, 0x47, 0xF1, 0x18, 0x0D, 0x88, 0xAA, 0x44, 0x58,
-    0x4E, 0x19, 0x7D, 0xB6, 0x44, 0x7D, 0x15, 0x64, 0x22, 0xE9, 0x51, 0xD6, 0xA0, 0x66, 0x9D, 0x1C,
-    0xC7, 0x13, 0x1B, 0xB1, 0x99, 0xA4, 0x24, 0x9B, 0xD4, 0x73, 0xA2, 0x8E, 0x91, 0x0F, 0xA8, 0x9A,
-    0x69, 0x1B, 0xD3, 0xFE, 0x69, 0xA5, 0x76, 0xC3, 0x95, 0x88, 0x5C, 0xA2, 0x35, 0x20, 0x23, 0x1B,
-    0x5F, 0xBF, 0x0A, 0x87, 0x4A, 0x15, 0x5F, 0x0F, 0xF4, 0x2A, 0x7E, 0x92, 0x62, 0xEF, 0x43, 0x97,
-    0x8C, 0xC8, 0x54, 0xEA, 0x7D, 0x6A, 0x6F, 0xF5, 0xA5, 0x95, 0x92, 0x1B, 0x60, 0xA6, 0x02, 0x34,
-    0x67, 0x11, 0x53, 0xD3, 0x5E, 0x8B, 0x9C, 0x77, 0x64, 0x4A, 0x29, 0x36, 0x76, 0x82, 0xAA, 0xE3,
-    0xF5, 0xA8, 0xD3, 0xB2, 0x03, 0x53, 0xAE, 0xF5, 0xC8, 0x39, 0xBF, 0x0B, 0xCF, 0xAD, 0x01, 0x89,
-    0xC4, 0x96, 0xD4, 0xA5, 0x6E, 0xDE, 0x4F, 0xC4, 0xCF, 0x6A, 0x48, 0xCF, 0xD1, 0x34, 0x9B, 0x9E,
-    0x85, 0x23, 0x70, 0x53, 0xC0, 0x4D, 0x1B, 0x7E, 0x39, 0x1D, 0xA2, 0x5A, 0x93, 0xA8, 0x81, 0x0D,
-    0x16, 0xE0, 0xE4, 0x15, 0xC4, 0x4D, 0xDA, 0x91, 0x99, 0x88, 0xD8, 0x8A, 0xAC, 0x44, 0x20, 0x6C,
-    0x8E, 0x67, 0xA4, 0x0E, 0x5C, 0xAF, 0x03, 0x6C, 0x5B, 0xA9, 0x21, 0xDE, 0x7C, 0xDC, 0xF7, 0xE7,
-    0x10, 0x54, 0xB5, 0xB1, 0xE3, 0x7F, 0xBA, 0x17, 0x6E, 0x8B, 0xC3, 0xBD, 0x48, 0x0E, 0x22, 0x2C,
-    0x1E, 0x08, 0x77, 0xFA, 0xD8, 0x70, 0x23, 0x56, 0x24, 0x94, 0x8A, 0xAB, 0x3B, 0xE1, 0x72, 0x15,
-    0x13, 0x60, 0x90, 0xC3, 0x42, 0x16, 0x87, 0x84, 0x27, 0xB6, 0xC2, 0x30, 0xAC, 0xF2, 0x96, 0xB1,
-    0xEF, 0xCF, 0xF2, 0xAA, 0x16, 0x5E, 0x81, 0x19, 0x7C, 0x3C, 0xE4, 0xF0, 0xB4, 0xBE, 0x52, 0x1E,
-    0xC2, 0x16, 0x17, 0x2B, 0xC6, 0x17, 0x3D, 0x43, 0xA9, 0x54, 0xE4, 0x2B, 0xDF, 0x0B, 0xC9, 0xCE,
-    0x18, 0x09, 0x42, 0x9D, 0xE2, 0x0C, 0x1B, 0xF8, 0x39, 0x4A, 0x4E, 0xB8, 0xB2, 0xFD, 0x2D, 0x0C,
-    0xCA, 0xF4, 0xA5, 0xAD, 0xB9, 0x26, 0x5D, 0xC1, 0x96, 0x0D, 0x10, 0x03, 0x28, 0xDB, 0xB6, 0x47,
-    0xD6, 0x2E, 0x4C, 0xBB, 0x6C, 0x0C, 0x36, 0x30, 0x9F, 0xB0, 0xA2, 0x7C, 0xE0, 0xBC, 0x1E, 0xE9,
-    0x6E, 0x87, 0xCB, 0x4B, 0x68, 0xB7, 0x79, 0x7F, 0xF8, 0x65, 0x6D, 0x87, 0x2B, 0x9B, 0x30, 0x98,
-    0x35, 0xA9, 0xC0, 0x6F, 0x32, 0xCC, 0xF6, 0x45, 0x7C, 0x41, 0xAF, 0x67, 0x63, 0x09, 0x9C, 0xA4,
-    0x2A, 0xA3, 0x0C, 0x2F, 0x0F, 0x79, 0x12, 0x43, 0x5D, 0x1B, 0xCD, 0x66, 0x2F, 0x1B, 0xAF, 0x87,
-    0xE1, 0x0A, 0x47, 0x76, 0xD3, 0xF7, 0xDF, 0xE1, 0x0E, 0x9C, 0x0F, 0xD3, 0x44, 0x6F, 0xE0, 0x30,
-    0xA4, 0x08, 0x84, 0x0E, 0xAA, 0x2A, 0xC7, 0x7E, 0x68, 0x8E, 0xFF, 0xED, 0xE9, 0xB0, 0xD1, 0xE5,
-    0x6D, 0xE5, 0x11, 0x73, 0xA5, 0x86, 0xE9, 0x02, 0xDE, 0x22, 0x04, 0x6B, 0x68, 0x38, 0x2F, 0xAC,
-    0x6C, 0x5F, 0xDE, 0x80, 0xC1, 0xD4, 0xFF, 0x6C, 0xB6, 0x43, 0x22, 0xC0, 0x21, 0xE3, 0x80, 0xA9,
-    0x86, 0xE3, 0x11, 0x17, 0xB0, 0xC3, 0xAE, 0x04, 0xA0, 0x04, 0x36, 0xA2, 0x32, 0xD0, 0xB5, 0xD1,
-    0x79, 0xCC, 0x31, 0xD4, 0xC4, 0x0C, 0x43, 0x58, 0x2E, 0xD0, 0xB1, 0xA7, 0xE2, 0xA7, 0x3C, 0x0C,
-    0x25, 0x42, 0xCD, 0x0E, 0xC0, 0x98, 0x3E, 0x25, 0x81, 0xF0, 0x1F, 0x96, 0x40, 0x96, 0x60, 0x49,
-    0x40, 0x3E, 0x9E, 0xD3, 0xCC, 0x67, 0xCC, 0xBD, 0x9C, 0x6A, 0x82, 0x6B, 0xB6, 0x6B, 0xBE, 0x33,
-    0xE3, 0x9F, 0xAD, 0xEB, 0x5C, 0x66, 0xF4, 0xEF, 0x29, 0xE9, 0xA8, 0x08, 0x47, 0x31, 0x0B, 0x28,
-    0xB7, 0xF2, 0x70, 0xE5, 0xDD, 0x94, 0xEA, 0x60, 0xD4, 0x8C, 0x9D, 0x50, 0x60, 0xC7, 0x45, 0xB0,
-    0x98, 0x48, 0x6E, 0x50, 0xE0, 0xCE, 0x0A, 0xA4, 0x9D, 0xE2, 0x22, 0xB7, 0xB4, 0x47, 0x53, 0x1C,
-    0x8C, 0x94, 0xC4, 0xCD, 0x3B, 0xFE, 0x35, 0x80, 0x4F, 0x55, 0x11, 0x05, 0xF8, 0xEE, 0x2B, 0xF5,
-    0x97, 0xEF, 0xC3, 0x6F, 0x9C, 0xFC, 0x02, 0xB3, 0xD4, 0x80, 0xB0, 0xC4, 0x1C, 0x72, 0x3B, 0x00,
-    0xC3, 0x99, 0x0C, 0x0D, 0x6D, 0x2C, 0xE5, 0xA0, 0x3D, 0x30, 0xD2, 0xD4, 0x01, 0xC4, 0x38, 0xAE,
-    0x0C, 0x7A, 0x98, 0x4D, 0x11, 0xEF, 0x0A, 0x1B, 0x1C, 0xE1, 0x85, 0xFB, 0xC7, 0xC0, 0x61, 0x0C,
-    0x1B, 0x89, 0x1E, 0xEB, 0xE9, 0x31, 0xFD, 0xCC, 0xF0, 0xE7, 0xD8, 0xCC, 0xB1, 0xA5, 0xB7, 0x07,
-    0x36, 0x0E, 0x38, 0xC7, 0x39, 0xC7, 0xED, 0xB7, 0xB3, 0xB7, 0x66, 0x8E, 0x17, 0x43, 0xFC, 0x80,
-    0xEE, 0x27, 0xB7, 0x52, 0x79, 0x74, 0xC1, 0xFA, 0x85, 0xEE, 0xC5, 0x57, 0xBA, 0x99, 0xB1, 0x4C,
-    0x53, 0xC3, 0xE1, 0x42, 0x69, 0xA2, 0x51, 0x12, 0xA8, 0x57, 0x5C, 0x34, 0xDE, 0xDF, 0x4C, 0x8A,
-    0x00, 0x30, 0x79, 0x44, 0x10, 0x06, 0xB6, 0xA7, 0x22, 0x87, 0x3E, 0x8C, 0xAB, 0xB8, 0x69, 0xB5,
-    0x42, 0x17, 0xF9, 0xB2, 0x66, 0x58, 0xB2, 0x86, 0xE9, 0x0D, 0xBC, 0x6D, 0x2C, 0x71, 0xE3, 0x22,
-    0x9A, 0xFA, 0x5A, 0x7A, 0x5A, 0x1F, 0x87, 0xE6, 0xA6, 0xFA, 0x3D, 0x91, 0xF5, 0x78, 0xC6, 0x4A,
-    0x26, 0xA8, 0x67, 0x45, 0x5F, 0x7B, 0xD7, 0xB2, 0xCC, 0x4E, 0xF5, 0xB0, 0x9D, 0xD8, 0x89, 0x3B,
-    0x68, 0x67, 0x33, 0x8E, 0x6C, 0xCC, 0x8B, 0xE8, 0x4D, 0x7E, 0x17, 0x26, 0x64, 0xA3, 0xB5, 0xB6,
-    0x94, 0x3A, 0x49, 0x55, 0xEB, 0xDC, 0x54, 0x89, 0xF0, 0x69, 0xDE, 0x26, 0x04, 0x08, 0x42, 0xA4,
-    0xF8, 0x2D, 0x9D, 0xB5, 0x82, 0xF2, 0x32, 0x55, 0xBD, 0x82, 0x90, 0x5A, 0x18, 0xF8, 0xE8, 0x99,
-    0x0E, 0x46, 0x36, 0xBA, 0xA9, 0x51, 0x49, 0xE6, 0xC5, 0xF2, 0xDE, 0xB1, 0x1C, 0xD2, 0x3A, 0xEC,
-    0xB1, 0x04, 0x5F, 0xC7, 0x3B, 0x38, 0xFD, 0xDB, 0xE2, 0xBF, 0xF7, 0x7F, 0xFE, 0x09, 0xA6, 0xC6,
-    0x1A, 0xF5, 0x27, 0xFB, 0x39, 0xFE, 0x8A, 0x56, 0xDB, 0x02, 0x05, 0x20, 0xB9, 0xD8, 0xC7, 0x01,
-    0x76, 0x71, 0x23, 0x20, 0x73, 0x93, 0xA9, 0x00, 0x9E, 0x2C, 0x80, 0x34, 0x4D, 0x56, 0x49, 0xFC,
-    0xB6, 0x03, 0xDC, 0xDB, 0x88, 0xA4, 0xC1, 0x3A, 0x9A, 0x81, 0x17, 0x7C, 0x16, 0x60, 0xBE, 0xEB,
-    0x30, 0x81, 0x10, 0xAD, 0x71, 0xC0, 0x15, 0x3F, 0x81, 0x6E, 0x09, 0x56, 0xA6, 0x58, 0xD9, 0xC1,
-    0xD4, 0x26, 0x7E, 0x1C, 0x1C, 0x25, 0x9A, 0x2C, 0xB9, 0x35, 0x74, 0x09, 0x48, 0x2E, 0xF1, 0x49,
-    0xD6, 0x39, 0x6D, 0xDD, 0x2C, 0x25, 0x97, 0x83, 0x6E, 0xA5, 0x65, 0x8C, 0x3E, 0xB9, 0x84, 0xA4,
-    0x38, 0xA0, 0xFC, 0xCC, 0x00, 0x97, 0x02, 0x82, 0x65, 0xFC, 0x25, 0xC9, 0xFA, 0x35, 0x22, 0xE7,
-    0x23, 0xC4, 0x16, 0x94, 0xF9, 0xFB, 0xB1, 0xCD, 0x18, 0x80, 0x3E, 0x78, 0x92, 0x45, 0x29, 0x9A,
-    0x1B, 0x09, 0xB9, 0x76, 0x6C, 0x64, 0xF6, 0x4E, 0x3F, 0x10, 0xD0, 0x55, 0x9A, 0x2B, 0x89, 0xE0,
-    0xC2, 0xDF, 0xBB, 0x48, 0x6D, 0xC7, 0x58, 0x52, 0x98, 0xA7, 0x4F, 0xF3, 0x07, 0xC7, 0x3A, 0x59,
-    0x27, 0x71, 0x3D, 0xA2, 0x2E, 0x2E, 0xEC, 0x0F, 0x25, 0x2F, 0xF8, 0xC0, 0x9D, 0x52, 0x10, 0x1E,
-    0xF1, 0x00, 0x61, 0x96, 0x93, 0x31, 0x18, 0xE2, 0x9D, 0x24, 0x9A, 0xE4, 0x3E, 0x64, 0xB6, 0x01,
-    0xF7, 0xAD, 0x69, 0xF9, 0x78, 0xC4, 0x63, 0x1F, 0xD8, 0x03, 0x85, 0x43, 0x27, 0x1F, 0x4E, 0xE9,
-    0xFE, 0xA9, 0x6B, 0x79, 0xE7, 0x49, 0x0C, 0x3D, 0x0C, 0x44, 0x35, 0x31, 0xCE, 0xEF, 0x0E, 0xCF,
-    0x4D, 0x18, 0x7D, 0x39, 0xC9, 0x39, 0x1C, 0x9C, 0x6A, 0x67, 0xE6, 0xC6, 0x96, 0x5A, 0x7F, 0x91,
-    0xCE, 0xC5, 0xA3, 0x6A, 0x05, 0x8A, 0x8B, 0xB4, 0x31, 0x80, 0x72, 0xCD, 0x8E, 0xFC, 0x46, 0x13,
-    0xD7, 0x43, 0x1E, 0xF2, 0xC6, 0xDA, 0x69, 0xED, 0x6A, 0x7F, 0xB0, 0x5A, 0xE5, 0xD3, 0x77, 0x93,
-    0x4A, 0x3F, 0x5F, 0x94, 0x6E, 0x36, 0x69, 0x5E, 0x3C, 0x46, 0xF4, 0x31, 0x6B, 0xDE, 0xA7, 0xEA,
-    0xD2, 0x08, 0xC1, 0xAB, 0xEA, 0x4F, 0x0B, 0x5D, 0xCF, 0x13, 0xBD, 0x0C, 0x79, 0x21, 0x71, 0x32,
-    0xBC, 0xF6, 0x1D, 0xAE, 0x18, 0x92, 0x42, 0x42, 0x36, 0x27, 0x84, 0x37, 0xB6, 0xBF, 0x7F, 0x53,
-    0x83, 0x40, 0xA6, 0x5A, 0x1E, 0x09, 0x66, 0xA1, 0x99, 0xB3, 0xAC, 0xF8, 0x00, 0x32, 0xB2, 0xC5,
-    0xD9, 0xBA, 0xB8, 0x9F, 0xAF, 0x91, 0x99, 0x61, 0x67, 0x33, 0x67, 0x21, 0x59, 0xD2, 0x72, 0x62,
-    0x22, 0x7F, 0x74, 0x91, 0x83, 0x32, 0x2D, 0x88, 0xFC, 0x74, 0x55, 0xD6, 0x55, 0x83, 0xD7, 0xB4,
-    0x38, 0xBB, 0x09, 0x61, 0xB2, 0x9E, 0x37, 0xE0, 0x8F, 0x1B, 0x1F, 0x1A, 0x72, 0xD1, 0xD0, 0x1C,
-    0xD9, 0x2E, 0x26, 0x97, 0x8D, 0xE7, 0xC9, 0x0C, 0x90, 0x19, 0x51, 0xF0, 0xF4, 0x3D, 0x37, 0x86,
-    0xE5, 0xBE, 0x67, 0xA7, 0xF8, 0x83, 0x7C, 0x80, 0x29, 0xDD, 0x00, 0xD4, 0x37, 0x72, 0xFC, 0xC5,
-    0x6E, 0x06, 0x5B, 0x8D, 0xB8, 0xF4, 0x58, 0xA6, 0xE3, 0x07, 0x22, 0xFF, 0x02, 0x19, 0x28, 0x1F,
-    0x33, 0xC8, 0x2C, 0x02, 0xCE, 0xA0, 0x0E, 0xAC, 0x72, 0x22, 0xAE, 0xC1, 0x62, 0x3B, 0xDD, 0x37,
-    0x8F, 0x8E, 0xFC, 0x3E, 0x13, 0xD3, 0x88, 0xFB, 0x81, 0x74, 0xA9, 0x45, 0x65, 0xAF, 0x42, 0xE1,
-    0x86, 0x2E, 0x0A, 0x68, 0xBF, 0xA8, 0x11, 0x9C, 0x2E, 0x39, 0xF7, 0x5E, 0x7C, 0x80, 0x00, 0x3A,
-    0x01, 0x63, 0xA6, 0xF1, 0xE1, 0x9D, 0xB2, 0xCC, 0xD8, 0x59, 0x6E, 0x43, 0xF4, 0x5C, 0xA8, 0x82,
-    0xE3, 0x39, 0x90, 0x02, 0x2B, 0x32, 0x24, 0xF2, 0x45, 0x83, 0x0B, 0x42, 0xD4, 0x2C, 0xA6, 0xAE,
-    0x59, 0xDE, 0x87, 0x48, 0x70, 0x99, 0x71, 0x98, 0xAB, 0x81, 0x2B, 0xA5, 0x4C, 0x72, 0xCD, 0x52,
-    0xC8, 0xF5, 0x1E, 0x53, 0xBD, 0x42, 0xFB, 0x81, 0x69, 0xDA, 0xEF, 0x95, 0x90, 0xFB, 0x80, 0xCC,
-    0xC5, 0x80, 0x15, 0x01, 0xB2, 0x04, 0xE4, 0x05, 0x1A, 0x09, 0x8B, 0x96, 0x96, 0xC8, 0x8C, 0xB9,
-    0xA0, 0x38, 0x00, 0x99, 0x3D, 0x11, 0x5C, 0xB4, 0x94, 0xC5, 0xD6, 0x1E, 0x0B, 0xF7, 0x2A, 0xA3,
-    0xF6, 0x81, 0xC2, 0x85, 0x37, 0x34, 0x64, 0x89, 0x69, 0xAF, 0xD6, 0x61, 0x51, 0xDC, 0x87, 0x5C,
-    0x3E, 0x2C, 0xC2, 0xEF, 0x29, 0x5D, 0x2A, 0x3D, 0x7B, 0x40, 0xD1, 0x91, 0x73, 0xCD, 0x18, 0x14,
-    0x6A, 0xC0, 0x64, 0xAD, 0x9E, 0x3A, 0x15, 0x1B, 0x49, 0xC5, 0x8C, 0x27, 0x68, 0xDE, 0x8C, 0x56,
-    0x8D, 0xD8, 0xBA, 0x10, 0x08, 0xCF, 0x3E, 0x42, 0x15, 0xAA, 0x7C, 0xE1, 0x5F, 0xF5, 0xBF, 0xE4,
-    0xB2, 0xE5, 0x0F, 0x4F, 0x78, 0xE2, 0x2C, 0x77, 0xCD, 0xD0, 0x3C, 0xAD, 0xF2, 0xAC, 0x20, 0x11,
-    0x5E, 0x03, 0x0B, 0x2D, 0xA8, 0xD7, 0xFC, 0x3A, 0xD7, 0x9A, 0x70, 0x63, 0x9C, 0x43, 0xBB, 0x6F,
-    0xDA, 0x13, 0x30, 0x4D, 0x6C, 0x9A, 0x60, 0x1A, 0xA8, 0x2E, 0x70, 0xB6, 0x3C, 0x82, 0x61, 0x98,
-    0xF6, 0x47, 0xA6, 0x81, 0xF4, 0x2C, 0x77, 0x71, 0x06, 0x5F, 0xE5, 0x59, 0x01, 0xE7, 0x59, 0x2C,
-    0x64, 0xD3, 0xF4, 0x08, 0xD3, 0x2C, 0xBA, 0xA8, 0x73, 0xDD, 0xE8, 0xC7, 0xC4, 0xBC, 0x7D, 0xE1,
-    0x9B, 0xA4, 0x66, 0x1F, 0x31, 0x7F, 0x8F, 0x2B, 0x9F, 0x83, 0x90, 0x27, 0x22, 0xC4, 0xE7, 0x0F,
-    0xAA, 0x27, 0xD6, 0x59, 0xF3, 0x56, 0x52, 0x99, 0xA9, 0x99, 0xC9, 0xEA, 0x8F, 0xB1, 0x79, 0x2F,
-    0x18, 0xE2, 0xF2, 0xE8, 0x85, 0x8F, 0x36, 0xCD, 0x9B, 0x4F, 0xF0, 0xC5, 0x58, 0x25, 0x98, 0x0E,
-    0xA8, 0x66, 0x57, 0xE0, 0x47, 0xE5, 0x73, 0x70, 0xF1, 0x04, 0x0E, 0x1F, 0xA6, 0x6B, 0x04, 0xD3,
-    0x31, 0x50, 0x83, 0x9D, 0x30, 0x0D, 0xD4, 0x43, 0x46, 0xFD, 0x50, 0xD3, 0xA4, 0xAB, 0x1B, 0xAE,
-    0x3A, 0xB8, 0xDA, 0x40, 0x62, 0xFA, 0x5F, 0xCD, 0xF1, 0x33, 0x5B, 0x73, 0xA8, 0xE5, 0x76, 0xF8,
-    0xDF, 0xA0, 0xC9, 0xF5, 0x7C, 0x6D, 0x8C, 0xC6, 0xF0, 0x3F, 0x5D, 0xE4, 0x44, 0xF6, 0x5D, 0x69,
-    0x49, 0x2B, 0xE3, 0xCA, 0xBD, 0xF3, 0x1F, 0x1D, 0xCD, 0xB1, 0x0D, 0xC2, 0x40, 0x0C, 0x05, 0xD0,
-    0x9F, 0x13, 0x1D, 0x43, 0x64, 0x02, 0xF0, 0x06, 0x80, 0x32, 0x53, 0x0A, 0x1A, 0x74, 0xEE, 0x18,
-    0xEB, 0x76, 0x60, 0x82, 0x24, 0x13, 0x50, 0xBA, 0x48, 0xCE, 0xF1, 0xB7, 0x25, 0x3F, 0xF9, 0xDB,
-    0x85, 0x01, 0xBC, 0xC0, 0x7A, 0xA7, 0x55, 0x53, 0xA3, 0xF3, 0xC8, 0x30, 0xE7, 0xE5, 0x73, 0xB9,
-    0x46, 0xA8, 0xBE, 0x18, 0x3D, 0x44, 0x43, 0xFF, 0x1A, 0x5D, 0x5D, 0x43, 0x6D, 0x26, 0x6E, 0x78,
-    0xF6, 0xE2, 0x3B, 0x5A, 0x87, 0xF8, 0xE4, 0x1D, 0xC5, 0xB7, 0x10, 0xB2, 0xC7, 0x26, 0x02, 0x67,
-    0xC8, 0x8F, 0x96, 0xFF, 0x83, 0x3F, 0x6E, 0x77, 0x5A, 0x7A, 0x3E, 0xCF, 0x19, 0x43, 0xF4, 0x09,
+static const uint8_t bookerly_12_regularBitmaps[23481] = {
+    0xBD, 0x9A, 0x4F, 0x8C, 0x1D, 0xC7, 0x9D, 0xDF, 0x3F, 0x55, 0xC5, 0x61, 0xAF, 0x55, 0x58, 0x15,
+    0x0F, 0x62, 0xA0, 0x98, 0x32, 0xDB, 0x87, 0x3D, 0x30, 0x0E, 0x67, 0x3A, 0x07, 0x1F, 0x18, 0xE0,
+    0xBD, 0xD7, 0x65, 0xF1, 0xE0, 0x83, 0x0F, 0x1E, 0x04, 0x7C, 0x36, 0x10, 0x1F, 0xE4, 0xE3, 0xDA,
+    0x80, 0x43, 0x1D, 0x18, 0x80, 0x08, 0xDE, 0xCC, 0x6B, 0x9B, 0x40, 0x72, 0xF0, 0xC1, 0x5C, 0x60,
+    0x93, 0xCB, 0x1E, 0xD6, 0x08, 0x10, 0x20, 0xA2, 0xB0, 0xA0, 0x0E, 0x03, 0x63, 0x0C, 0xF4, 0x4C,
+    0x17, 0xC9, 0x03, 0x0F, 0x04, 0xE2, 0x56, 0x14, 0x23, 0x07, 0x21, 0x50, 0xEB, 0xCF, 0xAE, 0x03,
+    0x09, 0xC9, 0x94, 0x17, 0xED, 0x4D, 0x73, 0xD8, 0xAF, 0x7F, 0x39, 0xF4, 0x1B, 0x92, 0x5A, 0x49,
+    0x5C, 0xED, 0xC6, 0x4A, 0x77, 0xBD, 0xFE, 0xF3, 0xAB, 0xAA, 0xDF, 0xAF, 0xBA, 0xEA, 0x57, 0xBF,
+    0xFA, 0x7D, 0x7F, 0xF5, 0x2E, 0x94, 0x7D, 0xD7, 0x75, 0x6D, 0xDB, 0xB6, 0x7B, 0x7B, 0xD7, 0xAE,
+    0xC1, 0xF5, 0x55, 0x7F, 0xE6, 0xC2, 0xD6, 0xBB, 0x8F, 0xBE, 0xF9, 0xBF, 0xCE, 0xEF, 0xFD, 0x9B,
+    0x37, 0x3F, 0x32, 0x7F, 0x7A, 0x8A, 0xE7, 0x75, 0xE0, 0x0F, 0x4D, 0xC1, 0x57, 0x8C, 0xE7, 0xA2,
+    0xC5, 0x89, 0xF4, 0x1B, 0xBF, 0x7C, 0xE5, 0x0A, 0xD7, 0xFE, 0x10, 0xDE, 0x78, 0x09, 0xE2, 0x45,
+    0xCE, 0xFE, 0x6E, 0x67, 0x7B, 0x29, 0xD2, 0xE8, 0x70, 0x0D, 0x13, 0xDE, 0xC0, 0x14, 0x91, 0xC4,
+    0x37, 0xF0, 0x25, 0xF8, 0x0A, 0xBC, 0x04, 0x9B, 0x68, 0x69, 0xDD, 0x5F, 0xF4, 0x5B, 0x2F, 0x4D,
+    0xA7, 0x2F, 0x5D, 0x9C, 0xBE, 0x44, 0xF6, 0x12, 0xAE, 0xC7, 0x88, 0x67, 0x19, 0xF9, 0x27, 0xFD,
+    0x99, 0x4B, 0xD3, 0x6B, 0x97, 0xA6, 0xFB, 0x97, 0x26, 0x07, 0x97, 0xCA, 0x5C, 0xA2, 0x95, 0x82,
+    0xAF, 0xB3, 0x4E, 0xD7, 0xE0, 0xFB, 0x8C, 0xC7, 0x06, 0x5C, 0x20, 0x59, 0x61, 0x82, 0xFA, 0x5D,
+    0xCB, 0x1B, 0x4C, 0x92, 0x70, 0x9E, 0x24, 0x4C, 0x4C, 0xE0, 0xBA, 0x09, 0xD7, 0x48, 0x8A, 0x89,
+    0x83, 0xEB, 0xE6, 0x6E, 0x38, 0x63, 0xC2, 0xFE, 0xA5, 0x2C, 0x66, 0xAF, 0x58, 0xF7, 0x67, 0x41,
+    0xEE, 0xBC, 0xD9, 0x4C, 0xF1, 0x93, 0x4D, 0xD5, 0x60, 0x4D, 0x7D, 0x1E, 0x9A, 0x89, 0x6A, 0xB8,
+    0x68, 0xEA, 0x2D, 0x92, 0x62, 0xCB, 0x04, 0x22, 0x0F, 0xF7, 0xD9, 0x24, 0x19, 0xD0, 0x81, 0x0D,
+    0x9E, 0x3E, 0x96, 0x35, 0xD8, 0x8F, 0x6A, 0x58, 0xD8, 0x02, 0xDD, 0x9C, 0x07, 0xE7, 0xF7, 0x60,
+    0x66, 0x02, 0x94, 0x13, 0x50, 0xD1, 0x43, 0xDA, 0xA4, 0x83, 0x7A, 0x54, 0x2F, 0x5B, 0xF7, 0xAD,
+    0xB0, 0xC9, 0xC2, 0x85, 0x6B, 0x3A, 0xBA, 0xBB, 0xB5, 0x0D, 0xEE, 0x6D, 0x52, 0x5C, 0x4F, 0x8E,
+    0xEB, 0x58, 0xFE, 0x07, 0x19, 0xFC, 0x52, 0xDE, 0x14, 0xBF, 0xB1, 0xCD, 0x99, 0xAF, 0x7D, 0xF4,
+    0xA3, 0x5F, 0xBC, 0xFD, 0x02, 0x2F, 0xB2, 0x20, 0x9A, 0xDA, 0x16, 0x8E, 0x2D, 0xA6, 0x4C, 0x58,
+    0xB0, 0x4F, 0x47, 0x47, 0xC7, 0x3E, 0x25, 0x0B, 0x66, 0x64, 0xB8, 0x22, 0x09, 0x26, 0xD2, 0x33,
+    0x81, 0x3F, 0x62, 0x86, 0x2B, 0x92, 0x5A, 0x47, 0x5A, 0x4A, 0xA6, 0xCC, 0xC8, 0xC8, 0x48, 0x49,
+    0x49, 0x1F, 0xB3, 0x68, 0x55, 0x34, 0xB5, 0x2D, 0xB6, 0xB8, 0x34, 0x7E, 0xC5, 0x79, 0xF3, 0xC0,
+    0x1F, 0x87, 0x44, 0x5E, 0x3E, 0x7E, 0xFF, 0x23, 0xFE, 0x63, 0xCD, 0x1E, 0x5C, 0x82, 0x88, 0x09,
+    0x38, 0xCE, 0xEE, 0xCC, 0x45, 0x7E, 0xFB, 0xDD, 0x5F, 0x7B, 0x07, 0x13, 0x88, 0x98, 0x02, 0x58,
+    0x24, 0xF5, 0x8E, 0x0D, 0x5D, 0x6A, 0xC2, 0x19, 0xE6, 0x57, 0x64, 0x75, 0xEB, 0x3F, 0x6F, 0xA5,
+    0xF7, 0xE2, 0x19, 0x98, 0xC0, 0x75, 0x68, 0x51, 0x11, 0x5D, 0x63, 0x02, 0xB6, 0xC0, 0xC1, 0x79,
+    0x98, 0xC0, 0x02, 0x5A, 0xF8, 0x44, 0xCE, 0xF4, 0xF1, 0x00, 0x3A, 0xF1, 0xC9, 0xF1, 0x40, 0x67,
+    0xDA, 0x1C, 0x77, 0xA3, 0xA6, 0x5C, 0x90, 0x3C, 0x08, 0xEC, 0xF4, 0x24, 0xEF, 0x3C, 0xB9, 0x95,
+    0xD8, 0xFB, 0x35, 0xFD, 0x8C, 0xF4, 0xE5, 0xD6, 0x44, 0x77, 0xDC, 0x93, 0x0D, 0x70, 0x16, 0x00,
+    0x5B, 0x5C, 0xED, 0xAC, 0x14, 0xAA, 0xC3, 0x15, 0x7C, 0xD6, 0xE5, 0x9C, 0xDC, 0x97, 0x15, 0x1B,
+    0x50, 0xF5, 0x0C, 0x55, 0x28, 0x75, 0x37, 0x25, 0x77, 0xB8, 0xE0, 0x4D, 0x83, 0x6A, 0xA1, 0x87,
+    0x12, 0x0E, 0x9E, 0x4A, 0x25, 0x1C, 0xCC, 0xAF, 0xE4, 0x22, 0x3F, 0x15, 0xA9, 0x79, 0x81, 0x4C,
+    0xCC, 0xB1, 0x64, 0x94, 0xAF, 0xAA, 0x96, 0x24, 0x90, 0x93, 0x44, 0x25, 0x3E, 0x95, 0xE2, 0x4C,
+    0xEE, 0xC9, 0xA1, 0xC7, 0x34, 0x64, 0xDE, 0x74, 0xFF, 0x52, 0x7E, 0x22, 0x2D, 0x57, 0xD6, 0x0A,
+    0xA3, 0x5B, 0x48, 0x6B, 0x10, 0x8F, 0x5B, 0x41, 0xD9, 0x62, 0xDE, 0xAA, 0x99, 0x39, 0xAF, 0xE3,
+    0x94, 0x94, 0x96, 0xD6, 0xD4, 0xB6, 0x70, 0x3E, 0x17, 0x69, 0x97, 0x22, 0x35, 0xA6, 0x06, 0xE7,
+    0xC7, 0x3E, 0x6A, 0x41, 0x79, 0x00, 0x23, 0x62, 0x44, 0x4C, 0x8D, 0x09, 0x98, 0x80, 0xF9, 0x6F,
+    0x24, 0x52, 0x24, 0xD2, 0x92, 0xF4, 0x70, 0x08, 0xB3, 0x93, 0xD4, 0x93, 0x74, 0xFF, 0xA8, 0x6A,
+    0xB2, 0x81, 0x0D, 0x0F, 0x9C, 0x42, 0x55, 0xB5, 0x1E, 0xB6, 0x4D, 0x87, 0x69, 0x51, 0x2D, 0x74,
+    0xB0, 0x7B, 0x8B, 0x4C, 0x3A, 0x57, 0x2F, 0x6F, 0x34, 0x26, 0x76, 0xEC, 0xCC, 0x70, 0x3F, 0x0B,
+    0xE6, 0xBD, 0x56, 0xB5, 0x39, 0xBD, 0x3D, 0x5E, 0xB1, 0xEC, 0x61, 0x1B, 0xC0, 0x89, 0xDC, 0x17,
+    0xF9, 0x6D, 0x54, 0xDD, 0x35, 0xCA, 0x97, 0x98, 0xC2, 0x0C, 0x52, 0x70, 0x05, 0x49, 0xC0, 0x34,
+    0xA8, 0x08, 0x1D, 0xEC, 0x40, 0x06, 0x2E, 0x60, 0x1A, 0x68, 0xE1, 0xD4, 0x38, 0xB8, 0xD9, 0x8A,
+    0xFC, 0x76, 0x3D, 0xA3, 0x77, 0x3E, 0x35, 0x75, 0x12, 0x7A, 0xD3, 0xA4, 0x6F, 0x35, 0x4A, 0x6A,
+    0xF2, 0x9E, 0x9D, 0xAC, 0xDE, 0xA1, 0xCF, 0x49, 0x7F, 0x56, 0x98, 0xF7, 0x1B, 0xDA, 0x03, 0x4A,
+    0x77, 0xBC, 0x42, 0x56, 0xA8, 0x6D, 0x38, 0x05, 0x55, 0x87, 0x54, 0xA1, 0xD4, 0xDD, 0x8C, 0xDC,
+    0x79, 0x7B, 0xBF, 0x56, 0x6D, 0xC7, 0x34, 0x27, 0xFD, 0x66, 0x6B, 0xC3, 0x52, 0xA2, 0xBA, 0x35,
+    0x4A, 0xCE, 0x21, 0x87, 0xA5, 0x3F, 0x2D, 0xB8, 0x15, 0x6C, 0xC3, 0x29, 0x77, 0x3F, 0xEE, 0x9F,
+    0xF4, 0xFF, 0xBB, 0x7D, 0xAE, 0x50, 0x7E, 0xE5, 0xEA, 0xFD, 0xC7, 0xB3, 0x38, 0x09, 0x3B, 0x49,
+    0x5D, 0xBA, 0x1F, 0xC7, 0x89, 0x1A, 0x09, 0xD7, 0x48, 0x3A, 0x96, 0x75, 0xB2, 0x22, 0x2F, 0xD8,
+    0x85, 0xB4, 0x41, 0x0D, 0x90, 0x35, 0xE8, 0x1E, 0xFE, 0x08, 0xF8, 0xDA, 0xAD, 0xD7, 0x44, 0xE2,
+    0xBA, 0xBE, 0x12, 0xF9, 0xEB, 0x5B, 0xB7, 0x0A, 0xE0, 0xEB, 0xB0, 0xF4, 0xA4, 0x2D, 0x4A, 0x3C,
+    0x69, 0x83, 0xEA, 0x49, 0x3A, 0x96, 0x85, 0xED, 0xC8, 0x0B, 0x2E, 0x9C, 0x94, 0x1F, 0xC8, 0x57,
+    0xE6, 0xF5, 0x16, 0x1B, 0x98, 0xA0, 0x6A, 0x36, 0x49, 0xC3, 0xB2, 0x73, 0x2B, 0x1E, 0x62, 0xE1,
+    0xD5, 0x75, 0x53, 0x03, 0x87, 0x24, 0x35, 0x2F, 0x9C, 0x34, 0xD3, 0x4A, 0x03, 0xA9, 0x48, 0xC4,
+    0xB6, 0xA4, 0xB5, 0x6E, 0x21, 0xA3, 0x04, 0x3A, 0xE7, 0xCF, 0xD5, 0xE6, 0x5E, 0x93, 0x56, 0x7E,
+    0x3A, 0x31, 0x61, 0x5F, 0xFF, 0x26, 0x5C, 0x48, 0x8A, 0xAD, 0x7D, 0xD8, 0xD7, 0x1F, 0x15, 0xA7,
+    0xA5, 0xD8, 0xEC, 0xF4, 0xEF, 0xF6, 0xCD, 0x83, 0x62, 0x92, 0x14, 0x8B, 0xFD, 0x24, 0x94, 0xE9,
+    0x37, 0x43, 0x5E, 0x49, 0x3D, 0x55, 0x43, 0xDA, 0xE8, 0x08, 0xE0, 0x0A, 0x80, 0xA5, 0x47, 0x83,
+    0xFC, 0xE9, 0xF7, 0x22, 0x4A, 0xA4, 0x03, 0x7E, 0x78, 0x13, 0xE0, 0x05, 0xC0, 0x44, 0x46, 0xD5,
+    0xA5, 0x2A, 0xC0, 0xBC, 0x03, 0x6C, 0x4E, 0x81, 0xD8, 0x43, 0xF2, 0xE3, 0x08, 0x53, 0xD3, 0xA0,
+    0xA2, 0x0D, 0xD8, 0x7F, 0x7F, 0xD5, 0x93, 0xCB, 0x80, 0x3E, 0xBE, 0xD5, 0xE3, 0xBC, 0x6A, 0x59,
+    0x60, 0xA2, 0x69, 0xB0, 0x21, 0x6B, 0xA8, 0xDE, 0x97, 0xDA, 0x49, 0xBD, 0x71, 0x6B, 0xDB, 0x89,
+    0x84, 0xF4, 0x4E, 0x45, 0xA9, 0x5B, 0x1B, 0x9C, 0x2F, 0x69, 0x6D, 0x70, 0x94, 0xBA, 0xB1, 0xD2,
+    0x53, 0x49, 0x6B, 0x43, 0x1A, 0x4A, 0xA6, 0x36, 0x98, 0xA6, 0x64, 0x66, 0x43, 0x52, 0x97, 0xAA,
+    0xCF, 0x1E, 0x89, 0x13, 0xF1, 0xA3, 0xC5, 0xF8, 0x4F, 0x24, 0xD2, 0x9B, 0x87, 0xAF, 0x84, 0x9E,
+    0x49, 0x8A, 0xB9, 0xD7, 0x70, 0x71, 0x07, 0x6C, 0x80, 0x12, 0x5C, 0x80, 0x7E, 0x7C, 0x3B, 0x80,
+    0x24, 0x42, 0x5E, 0xA0, 0xC4, 0x9F, 0x4E, 0x44, 0x1A, 0x2B, 0x1D, 0x6A, 0x9B, 0x8D, 0x5B, 0x37,
+    0xC9, 0x45, 0x6A, 0xD5, 0x7F, 0x47, 0xC8, 0xB0, 0xD1, 0x06, 0x0E, 0x75, 0xC4, 0x85, 0x12, 0xDD,
+    0x66, 0xB0, 0x63, 0x03, 0xE9, 0x4F, 0x22, 0xA6, 0x2E, 0x51, 0x6D, 0x06, 0x0B, 0x1B, 0xC8, 0x75,
+    0xC4, 0xF9, 0x12, 0x17, 0x32, 0xD2, 0x90, 0x89, 0x14, 0xB9, 0x0C, 0xE3, 0x20, 0xCD, 0xE7, 0xF3,
+    0x6F, 0x8B, 0xF4, 0xE9, 0x87, 0xAF, 0x87, 0x92, 0x8B, 0x36, 0xA8, 0x50, 0x3E, 0x6E, 0x90, 0xFD,
+    0x70, 0xA0, 0x92, 0xE6, 0xE4, 0x2D, 0x40, 0xC9, 0x73, 0x36, 0x10, 0x4B, 0xCE, 0x67, 0x22, 0x47,
+    0x22, 0xAB, 0xF9, 0x7C, 0x9E, 0x8B, 0xBC, 0x39, 0xDC, 0x6A, 0x33, 0xBE, 0x62, 0x83, 0xD1, 0x11,
+    0x4A, 0xC8, 0xC0, 0xFE, 0xFA, 0x8F, 0xB5, 0x08, 0x07, 0x73, 0x9F, 0x81, 0x0D, 0x3C, 0xC9, 0xC9,
+    0x1E, 0x92, 0x4B, 0x01, 0xEA, 0x35, 0xCF, 0x52, 0x3A, 0x3D, 0x7C, 0xA7, 0xB3, 0x35, 0xFB, 0xA9,
+    0xE7, 0xFA, 0x0C, 0xFE, 0xD9, 0x0E, 0x50, 0xAE, 0x7F, 0x3D, 0xD0, 0x93, 0x4B, 0xC9, 0x97, 0x57,
+    0x07, 0xB0, 0x58, 0xC2, 0x22, 0x2F, 0x58, 0xA4, 0x0D, 0x8B, 0x44, 0xC6, 0x5E, 0x47, 0x5D, 0x61,
+    0x7E, 0x85, 0xF9, 0x77, 0x25, 0x26, 0xF2, 0xEE, 0x8A, 0x8D, 0x4E, 0x47, 0x4C, 0x63, 0x03, 0xAE,
+    0xC8, 0x60, 0x46, 0x09, 0x6B, 0x92, 0x88, 0x14, 0x99, 0xC8, 0xF0, 0x14, 0xE9, 0x93, 0xA5, 0xB2,
+    0x8E, 0xAB, 0xBF, 0x91, 0x98, 0x48, 0x33, 0xBF, 0x22, 0xAB, 0xB4, 0xB6, 0xE1, 0xB3, 0xCE, 0xAC,
+    0x93, 0xD5, 0xC6, 0xDC, 0xCB, 0x4A, 0xAD, 0xB0, 0x81, 0xF2, 0xEF, 0xB8, 0xB8, 0x40, 0x47, 0x4A,
+    0xD2, 0xE8, 0x9E, 0x43, 0x80, 0xF9, 0x95, 0x8D, 0xB9, 0x93, 0x20, 0x6D, 0x5A, 0xEB, 0x8E, 0x92,
+    0x1D, 0x6C, 0xC8, 0x3C, 0xA5, 0xAD, 0xB1, 0x77, 0x23, 0x94, 0x3D, 0x58, 0x01, 0xAA, 0x08, 0xF6,
+    0x9D, 0x00, 0xE5, 0x12, 0xEC, 0xDD, 0x1E, 0x4A, 0x1B, 0xB1, 0x21, 0x0B, 0x94, 0x54, 0x3E, 0xEB,
+    0xF4, 0xE0, 0x24, 0x24, 0x3D, 0xB0, 0xC1, 0xFC, 0x0A, 0x4E, 0x6A, 0xD2, 0xFA, 0xA9, 0x51, 0x7B,
+    0xD6, 0xED, 0xF9, 0x71, 0x44, 0xB7, 0x32, 0x91, 0x77, 0x44, 0xFA, 0x8D, 0x2B, 0x30, 0x27, 0xEF,
+    0x70, 0x03, 0x59, 0x24, 0xAF, 0x59, 0x06, 0x3D, 0xA0, 0x8E, 0xBC, 0x5B, 0x90, 0x5C, 0xE5, 0x9F,
+    0x47, 0x36, 0x17, 0xFA, 0xBF, 0x07, 0xDE, 0x68, 0x9D, 0xC3, 0xDC, 0x6D, 0x2E, 0x4D, 0x70, 0xC9,
+    0xDD, 0xD0, 0x32, 0x71, 0xDF, 0x36, 0x35, 0x71, 0xEB, 0xBA, 0xF3, 0x26, 0xCC, 0xC2, 0x8C, 0x14,
+    0x61, 0x9F, 0xEB, 0xBA, 0xD5, 0x51, 0x35, 0x26, 0xD8, 0x90, 0x7D, 0xB0, 0x41, 0xF5, 0xBE, 0x44,
+    0x9C, 0x84, 0xB9, 0x67, 0xFE, 0x5D, 0xF1, 0x46, 0xDE, 0x15, 0x54, 0xA7, 0x07, 0x74, 0x6D, 0x57,
+    0x58, 0xBF, 0x59, 0xB2, 0xC9, 0x5E, 0xCF, 0x9E, 0x7E, 0xB3, 0xD3, 0xB5, 0x7D, 0x39, 0x5A, 0xBF,
+    0x69, 0xE2, 0x26, 0x7B, 0x49, 0xB3, 0xA7, 0x6B, 0xFB, 0x5F, 0x6B, 0xEB, 0xDD, 0x03, 0xBF, 0x89,
+    0xFB, 0x0B, 0xF6, 0x48, 0x5B, 0x5D, 0x93, 0xD7, 0xD9, 0x07, 0xE4, 0x97, 0x25, 0xB2, 0x03, 0xE0,
+    0xE1, 0xF4, 0x6B, 0x60, 0x65, 0xC0, 0x3C, 0x3C, 0xD7, 0xB3, 0xC2, 0xC6, 0xCC, 0x93, 0x5F, 0x8E,
+    0xA8, 0x7E, 0x07, 0xDC, 0x83, 0x00, 0x7D, 0x09, 0xF6, 0x57, 0x61, 0xDD, 0xC7, 0x0F, 0x6A, 0xE8,
+    0x77, 0xC1, 0xDD, 0x88, 0xE8, 0x36, 0x2F, 0xC8, 0x19, 0x48, 0x43, 0x32, 0xDC, 0x8E, 0x58, 0xE9,
+    0x60, 0x63, 0x1B, 0x46, 0x03, 0x50, 0xA7, 0x77, 0x2A, 0x5F, 0xD2, 0xDB, 0x60, 0x43, 0xC9, 0x62,
+    0xBC, 0xF5, 0x36, 0x64, 0x1C, 0x56, 0xB5, 0x95, 0xE6, 0x93, 0xBD, 0x9C, 0x3D, 0xC4, 0x49, 0x03,
+    0x1B, 0xAF, 0x81, 0x12, 0x29, 0xC8, 0x7F, 0x5D, 0x05, 0xD3, 0x92, 0x17, 0x99, 0x27, 0xF7, 0x3D,
+    0xEC, 0x26, 0x35, 0xF4, 0x19, 0x98, 0x58, 0x82, 0xBD, 0x17, 0x21, 0x73, 0x01, 0xCA, 0xCC, 0x63,
+    0xE2, 0x21, 0xB8, 0xA2, 0x87, 0x03, 0xDD, 0x61, 0x1A, 0xD3, 0xB1, 0xC4, 0x0C, 0xB7, 0x1B, 0x94,
+    0xAC, 0x80, 0xDC, 0x03, 0xD9, 0x4D, 0x20, 0x7D, 0xE8, 0xD7, 0x36, 0x57, 0x1D, 0xB2, 0x71, 0x6B,
+    0x9B, 0x5C, 0xC4, 0xAB, 0xFE, 0x5C, 0x4B, 0x46, 0x8E, 0x0D, 0x36, 0xE8, 0xA8, 0x23, 0x25, 0x25,
+    0x19, 0x53, 0x6C, 0x38, 0x44, 0xCB, 0x0A, 0xAA, 0x7E, 0x14, 0x67, 0xEF, 0x74, 0xE8, 0x98, 0x15,
+    0x94, 0xA6, 0x25, 0x23, 0x2F, 0xB2, 0xFF, 0x99, 0x74, 0xB9, 0xF8, 0x3C, 0x80, 0xF2, 0xFC, 0xC0,
+    0x27, 0xD2, 0xA7, 0xBF, 0x2E, 0x67, 0x4C, 0xA6, 0x4C, 0xA6, 0x7C, 0x3D, 0xF7, 0x64, 0x0D, 0x76,
+    0x40, 0x49, 0x4D, 0xDA, 0xA2, 0xFB, 0xAF, 0xB2, 0x13, 0x99, 0xB6, 0xEC, 0xF4, 0xF4, 0xD5, 0xEB,
+    0x31, 0x93, 0xA0, 0xAE, 0x70, 0x76, 0x3E, 0x9F, 0x3B, 0x11, 0xB9, 0xF7, 0x61, 0x75, 0x2B, 0x46,
+    0x57, 0x4C, 0x26, 0xA6, 0x71, 0x5F, 0xA2, 0xD3, 0x9E, 0xD9, 0xDA, 0x90, 0x9B, 0x06, 0xE8, 0xE0,
+    0xB3, 0x09, 0xE7, 0x8E, 0x21, 0x97, 0x9A, 0xB3, 0x57, 0x38, 0x3B, 0x97, 0xD6, 0xC8, 0xBB, 0x87,
+    0xA8, 0x9E, 0x16, 0xDD, 0x98, 0x1A, 0x5B, 0x38, 0xCF, 0x16, 0x53, 0xD8, 0x7F, 0x36, 0xA9, 0x60,
+    0x4A, 0x8E, 0x8A, 0x2C, 0x49, 0x0B, 0xE4, 0xA8, 0x87, 0x4A, 0x0A, 0xD8, 0xF0, 0x70, 0x76, 0xCE,
+    0xFC, 0x5F, 0x48, 0x67, 0xE5, 0xCE, 0x80, 0x6E, 0x55, 0x87, 0x2B, 0x4C, 0x64, 0x8A, 0x0D, 0x2A,
+    0x92, 0x7A, 0x57, 0x90, 0x33, 0x81, 0x52, 0x45, 0x68, 0x9D, 0xC7, 0xC4, 0x09, 0x24, 0x77, 0x1A,
+    0x70, 0xDF, 0xF6, 0xB0, 0x35, 0x01, 0x76, 0x1B, 0x40, 0x00, 0xDD, 0x03, 0xA6, 0x5E, 0x2F, 0x84,
+    0x67, 0xE7, 0xC0, 0xD9, 0x2B, 0x4B, 0xE1, 0x02, 0x55, 0x7F, 0xAE, 0x65, 0x8A, 0xAD, 0x4D, 0x64,
+    0x17, 0x1B, 0x74, 0x44, 0x70, 0x85, 0x6A, 0x11, 0x1C, 0x74, 0xEA, 0xA8, 0x48, 0xA1, 0xD7, 0x6F,
+    0x87, 0x2D, 0x58, 0x98, 0xFB, 0x61, 0x0A, 0xD3, 0xE4, 0x46, 0x3D, 0x81, 0x99, 0x7D, 0x39, 0xEE,
+    0x43, 0xE6, 0x54, 0x6C, 0xC1, 0x3D, 0x4F, 0x1B, 0xC1, 0xFD, 0x88, 0x5F, 0x36, 0x60, 0x4B, 0x76,
+    0x6B, 0x30, 0x3D, 0x79, 0x00, 0xD3, 0x92, 0x15, 0xA0, 0x23, 0xA9, 0xE7, 0x49, 0x23, 0xE6, 0x97,
+    0x25, 0x66, 0xAB, 0xA4, 0x65, 0x97, 0x34, 0xB8, 0x82, 0x03, 0x1D, 0x31, 0x71, 0x01, 0xE9, 0xAF,
+    0x3C, 0x54, 0x0D, 0x98, 0x1E, 0xC8, 0x02, 0x24, 0x03, 0xF0, 0xD7, 0x2D, 0x4C, 0x5D, 0xC0, 0x16,
+    0x39, 0x2A, 0xEA, 0x8E, 0x29, 0xAE, 0xCE, 0x3E, 0x50, 0xF2, 0xE7, 0x12, 0x2A, 0x39, 0x7B, 0x45,
+    0xCD, 0xAF, 0xCA, 0x8F, 0xE5, 0xDD, 0x01, 0x5B, 0xBB, 0x60, 0x6A, 0xDD, 0xAA, 0x48, 0x4E, 0x4B,
+    0x52, 0xEF, 0x43, 0x3F, 0x01, 0xF7, 0xAF, 0x40, 0xCB, 0x5A, 0x4B, 0x6D, 0x00, 0x1D, 0xD7, 0x86,
+    0x3D, 0x63, 0x24, 0x9C, 0x1B, 0x3C, 0xA9, 0x34, 0x6C, 0xCC, 0xE7, 0x7E, 0x29, 0xF2, 0x8D, 0xE3,
+    0x5B, 0x2B, 0x5B, 0x98, 0xE6, 0x22, 0x39, 0x5F, 0xD5, 0x2D, 0xA4, 0xC5, 0xB8, 0x26, 0xD6, 0xB0,
+    0x3B, 0xAE, 0xE9, 0x19, 0xA8, 0x16, 0x5C, 0xA1, 0x43, 0x8F, 0xB3, 0x35, 0x8B, 0x5C, 0xA4, 0x91,
+    0xF5, 0x12, 0xFB, 0xB5, 0x1B, 0xAB, 0x89, 0x09, 0xCF, 0x48, 0xB3, 0x1B, 0xAB, 0x09, 0x9C, 0x07,
+    0x07, 0xB6, 0xC0, 0x04, 0x74, 0x8D, 0x8A, 0xD0, 0xC2, 0x75, 0x98, 0xC0, 0xD6, 0x98, 0xE7, 0x31,
+    0x01, 0x33, 0xE6, 0xC5, 0x93, 0x3C, 0x7E, 0x78, 0x3B, 0x2E, 0xD2, 0xE4, 0xCE, 0xA7, 0x5D, 0xFE,
+    0xE6, 0x50, 0x58, 0xC0, 0x0A, 0x04, 0xFD, 0x0E, 0xE6, 0x7E, 0x91, 0xDC, 0x08, 0x4E, 0xD7, 0x29,
+    0x71, 0x93, 0x76, 0xC2, 0xF5, 0x7D, 0x26, 0x67, 0x38, 0x25, 0x22, 0xA3, 0xA3, 0x1C, 0x72, 0xD5,
+    0x25, 0xF5, 0x73, 0xA3, 0x87, 0x55, 0x35, 0xFA, 0xF8, 0x90, 0xD6, 0x85, 0x89, 0x8A, 0xB0, 0x80,
+    0x8C, 0x73, 0x12, 0xB2, 0x0F, 0x63, 0xC6, 0xC2, 0x86, 0x54, 0x47, 0x17, 0x96, 0xB7, 0xE5, 0xA7,
+    0x43, 0x16, 0xD6, 0xEE, 0x55, 0x55, 0xA0, 0x87, 0x71, 0x96, 0x98, 0x66, 0x9C, 0x24, 0x33, 0xA0,
+    0xAB, 0x6A, 0x23, 0xD2, 0xB8, 0x36, 0x0D, 0x39, 0x69, 0xD1, 0x91, 0x9B, 0x86, 0xDE, 0x15, 0x3A,
+    0xCE, 0x70, 0xA1, 0x63, 0x66, 0x1A, 0x15, 0x5D, 0xE1, 0x8A, 0xFC, 0xC3, 0x9E, 0x4A, 0x8A, 0xD1,
+    0xCF, 0x26, 0x11, 0x7F, 0x58, 0x7D, 0x2B, 0xCC, 0x26, 0xFC, 0x22, 0xE2, 0x0A, 0x66, 0xD0, 0x61,
+    0x22, 0xB6, 0x26, 0xAD, 0xC9, 0xA4, 0x4F, 0x25, 0xA8, 0xED, 0xB5, 0x5B, 0xD7, 0x43, 0x16, 0xC7,
+    0xE1, 0xCB, 0xC6, 0xE1, 0xD4, 0x91, 0xA5, 0x04, 0xF7, 0x48, 0x28, 0xE9, 0x4D, 0xAD, 0x63, 0x86,
+    0x0D, 0x1D, 0x99, 0x69, 0x28, 0x5D, 0xA1, 0x63, 0x8E, 0x0D, 0x25, 0x99, 0xEA, 0x55, 0xAF, 0x87,
+    0xEA, 0x58, 0xCB, 0x5B, 0x2B, 0xB6, 0x4F, 0x01, 0xD8, 0x81, 0xA1, 0x72, 0xC5, 0x6C, 0xC1, 0x61,
+    0xA3, 0x44, 0x44, 0x64, 0x68, 0x31, 0x0D, 0x36, 0x90, 0x06, 0x32, 0xE9, 0x32, 0x29, 0xD4, 0x36,
+    0xA8, 0x6D, 0xB2, 0x81, 0x83, 0x25, 0xF1, 0x4B, 0x3A, 0x62, 0x1A, 0x4C, 0xC3, 0x39, 0x69, 0x96,
+    0xD2, 0x8C, 0xCF, 0x9F, 0x9A, 0xEC, 0x31, 0xB9, 0x9C, 0x00, 0x90, 0x90, 0xDF, 0x3E, 0x32, 0x8D,
+    0x2B, 0x9C, 0x4F, 0x99, 0xB2, 0xA0, 0xD5, 0x51, 0xB7, 0x69, 0x61, 0xA4, 0x63, 0xEB, 0x07, 0x10,
+    0xC7, 0xF9, 0xEA, 0x44, 0x7C, 0x26, 0xF2, 0x8D, 0xC8, 0xAE, 0x83, 0xFD, 0x05, 0x26, 0xAC, 0x38,
+    0x54, 0x22, 0x35, 0xD5, 0x07, 0xE0, 0xC1, 0xB5, 0x90, 0xAC, 0x18, 0x51, 0x8E, 0xA9, 0x47, 0x98,
+    0xC3, 0x14, 0x70, 0xE9, 0x0A, 0x73, 0x24, 0x81, 0x41, 0x77, 0x4C, 0xC9, 0x71, 0xDE, 0x06, 0xF3,
+    0x04, 0xDA, 0x66, 0x1F, 0x23, 0xA8, 0xAA, 0x58, 0xFE, 0x89, 0xC4, 0x65, 0x0F, 0x49, 0x63, 0x63,
+    0xD2, 0x8C, 0xBD, 0x7B, 0xAE, 0x59, 0x36, 0xE6, 0x13, 0xA7, 0x7D, 0xB8, 0x1C, 0x80, 0x92, 0x15,
+    0xFD, 0xDA, 0xDB, 0xEE, 0x6D, 0x4F, 0xC9, 0xE2, 0x53, 0xCF, 0x92, 0x2E, 0x89, 0x59, 0xD8, 0x02,
+    0x0F, 0x02, 0x49, 0xCF, 0xF8, 0x85, 0x01, 0x1C, 0xA3, 0x26, 0xC7, 0x7C, 0x65, 0x42, 0xD5, 0x38,
+    0x3A, 0x26, 0x69, 0xC1, 0x6F, 0x5B, 0xCC, 0x11, 0xB8, 0x5D, 0x98, 0xEC, 0x40, 0x3C, 0xC0, 0x84,
+    0x15, 0x8E, 0x41, 0x1D, 0xFA, 0x21, 0x15, 0x04, 0xD8, 0xC6, 0x67, 0xF5, 0xD5, 0xDA, 0x3C, 0xF3,
+    0x3C, 0xF7, 0xB0, 0x5A, 0xBB, 0x96, 0xA7, 0x63, 0x55, 0x2F, 0x9B, 0x64, 0x90, 0x95, 0x0C, 0xA4,
+    0x4D, 0xD6, 0xA6, 0xC1, 0x34, 0x26, 0xAA, 0x48, 0xF7, 0x24, 0x16, 0xE0, 0x5D, 0x61, 0x83, 0xA9,
+    0x4D, 0xA3, 0x23, 0x2D, 0xDD, 0xE3, 0x18, 0xC0, 0x49, 0x86, 0xED, 0x92, 0x87, 0x7A, 0x70, 0x72,
+    0x59, 0x6E, 0x48, 0xBD, 0xE6, 0xDA, 0x24, 0x83, 0xAC, 0x48, 0x9B, 0x34, 0x98, 0x46, 0x47, 0x3A,
+    0x16, 0xCC, 0x48, 0xC7, 0xB8, 0x42, 0xA3, 0x3E, 0x4E, 0xB0, 0x9D, 0x39, 0x76, 0x72, 0x59, 0x02,
+    0xC0, 0xB2, 0x43, 0xAA, 0xBA, 0x54, 0xFD, 0x82, 0xEC, 0x2A, 0xE6, 0xA8, 0x40, 0x1A, 0xF2, 0x0E,
+    0x57, 0x61, 0x3E, 0xAA, 0x89, 0x3D, 0x5D, 0xF6, 0x57, 0xBD, 0x92, 0x8E, 0x8D, 0x51, 0xD9, 0x0F,
+    0xD3, 0xCE, 0x0D, 0xD2, 0xEB, 0x95, 0xEE, 0x92, 0xDA, 0xC4, 0x14, 0x1B, 0x16, 0xA4, 0xDF, 0x88,
+    0xEC, 0x24, 0x41, 0xAD, 0x5F, 0x67, 0x2A, 0xEA, 0x98, 0x0C, 0x95, 0x4F, 0xA5, 0x61, 0x01, 0x2A,
+    0x42, 0x12, 0x20, 0x05, 0x2D, 0x35, 0x5F, 0xBE, 0x35, 0x9A, 0xE0, 0x54, 0x6E, 0xBA, 0x47, 0xA2,
+    0xA3, 0x89, 0x3B, 0x64, 0x36, 0xE8, 0xD8, 0x91, 0xB9, 0x62, 0xBC, 0x05, 0x1D, 0x4B, 0xF2, 0x24,
+    0xBA, 0x98, 0x89, 0xB0, 0x7C, 0x6F, 0x34, 0x73, 0xFA, 0xF1, 0x4D, 0x4B, 0xC3, 0x0F, 0x5F, 0x03,
+    0xCE, 0xDD, 0xED, 0x97, 0x0F, 0xFA, 0x64, 0xF8, 0x63, 0xD3, 0x7E, 0xBA, 0xCA, 0x9F, 0x3B, 0xF6,
+    0x4B, 0x29, 0x80, 0x65, 0x97, 0x7E, 0xEF, 0xAD, 0xB0, 0x39, 0xE1, 0x5E, 0x4B, 0xD6, 0x52, 0xB5,
+    0x54, 0x77, 0x38, 0x7C, 0x55, 0xFF, 0xA6, 0xD8, 0xDA, 0xFD, 0xDE, 0x3D, 0x89, 0xE3, 0x6C, 0x9E,
+    0x90, 0x04, 0x16, 0x64, 0xF2, 0x2B, 0xE9, 0x3F, 0xCD, 0x65, 0x4D, 0x02, 0xCB, 0xDB, 0x5A, 0xEA,
+    0x11, 0xC6, 0xDB, 0xF8, 0x5C, 0x67, 0x7B, 0xB3, 0xFA, 0x5B, 0x9A, 0xFC, 0x09, 0xD5, 0x66, 0x4A,
+    0xEA, 0x73, 0x6F, 0x06, 0x79, 0x48, 0xDE, 0x55, 0x41, 0x6D, 0xC3, 0xB2, 0xCB, 0x3A, 0xB9, 0x79,
+    0xB5, 0xEE, 0x98, 0xEA, 0xA8, 0xA2, 0xA9, 0x9D, 0xB7, 0x61, 0x42, 0xAA, 0x1B, 0x66, 0x0E, 0x16,
+    0xD7, 0xE1, 0xFF, 0x04, 0xB4, 0x80, 0x69, 0x47, 0x28, 0x04, 0x2C, 0xBB, 0x84, 0xEA, 0xFD, 0xC1,
+    0xEF, 0x9D, 0x5E, 0xB9, 0xC2, 0x05, 0xE7, 0x4B, 0xD5, 0xAB, 0x68, 0xEA, 0xAC, 0xDE, 0x62, 0x66,
+    0x8E, 0x4C, 0xD0, 0xF1, 0x5F, 0xC7, 0x09, 0xCE, 0xBA, 0x6F, 0x7A, 0xBA, 0x58, 0x46, 0x92, 0xFF,
+    0x61, 0xFE, 0x0B, 0xE4, 0x21, 0xAF, 0xD1, 0x9D, 0xEA, 0x19, 0x57, 0x6E, 0x00, 0xF2, 0x2E, 0x6F,
+    0xA5, 0xAE, 0x8A, 0x5D, 0x5A, 0x76, 0x9C, 0xA7, 0xDC, 0x1B, 0xA1, 0x61, 0x0F, 0x49, 0x07, 0x93,
+    0x0E, 0x73, 0xA7, 0x65, 0xAA, 0x63, 0xD2, 0x26, 0x5D, 0xD5, 0x56, 0xED, 0xE7, 0x6C, 0xF2, 0x30,
+    0x36, 0xD9, 0x06, 0x98, 0xAE, 0x07, 0xCD, 0xF3, 0xBD, 0x0E, 0x2D, 0x81, 0xE4, 0x03, 0x20, 0x95,
+    0x3E, 0x93, 0xD5, 0x45, 0xBA, 0x8B, 0x26, 0x62, 0x03, 0xA9, 0x3F, 0xB1, 0xAF, 0x1B, 0x36, 0xB8,
+    0xD4, 0x9F, 0xCF, 0x6F, 0x0D, 0xB9, 0xF4, 0x00, 0x3B, 0x66, 0x65, 0x83, 0x2B, 0x9C, 0xB7, 0x85,
+    0x0D, 0x49, 0x30, 0xC1, 0x04, 0x1B, 0x72, 0x9F, 0xE3, 0x82, 0x09, 0x26, 0x24, 0xC1, 0x06, 0x5B,
+    0xAC, 0xA7, 0xC6, 0x43, 0x04, 0xF4, 0xDB, 0x3F, 0xFA, 0xC5, 0xC7, 0x92, 0x9F, 0xF9, 0x65, 0xAD,
+    0x22, 0x2D, 0x2D, 0x2D, 0x51, 0x45, 0x1D, 0x75, 0x54, 0x91, 0x03, 0x76, 0x69, 0xD7, 0xCF, 0x27,
+    0xB9, 0xED, 0xB9, 0x26, 0x2F, 0x60, 0x83, 0x53, 0x79, 0xFC, 0xCA, 0xE1, 0x50, 0xC6, 0xAC, 0x45,
+    0x79, 0xBE, 0xAE, 0x8B, 0x94, 0x36, 0x09, 0x3B, 0xBA, 0x4D, 0x8B, 0x99, 0x89, 0x26, 0x66, 0xDE,
+    0x86, 0x05, 0x5B, 0x2A, 0x72, 0xDD, 0x04, 0xE0, 0x55, 0xE3, 0x9D, 0xDF, 0xA7, 0x75, 0x45, 0x5A,
+    0xF4, 0x3A, 0xA6, 0xBE, 0x77, 0xA1, 0xB3, 0xA1, 0xB3, 0xE1, 0x9A, 0x19, 0x7B, 0xFB, 0x0F, 0x00,
+    0x0E, 0xC6, 0xD8, 0x01, 0xA8, 0x0A, 0xE0, 0xC5, 0x13, 0x57, 0x44, 0x79, 0x20, 0x07, 0xD4, 0x0A,
+    0xB0, 0x1D, 0x30, 0x8D, 0xA0, 0xDF, 0xAA, 0xC1, 0xB9, 0x00, 0xD7, 0x53, 0x30, 0xF5, 0x0C, 0x52,
+    0x4A, 0xF8, 0xE5, 0x77, 0x5A, 0x8C, 0x48, 0x43, 0x76, 0xEB, 0x76, 0xA0, 0x25, 0xF5, 0x49, 0x20,
+    0x67, 0x06, 0xA5, 0x1E, 0xB0, 0x43, 0xBE, 0x42, 0x56, 0xA0, 0x01, 0x76, 0x01, 0xDB, 0x02, 0x03,
+    0xA0, 0xFD, 0x17, 0x2B, 0xF1, 0xFB, 0x80, 0x8D, 0xC0, 0x6E, 0x84, 0xE4, 0x6E, 0x84, 0x89, 0x0A,
+    0x5F, 0xA4, 0xC4, 0xCD, 0xA4, 0x40, 0xF5, 0xB9, 0xC7, 0x34, 0xFD, 0xC7, 0xE2, 0xBA, 0xDB, 0xAC,
+    0xE7, 0xCC, 0xD2, 0x33, 0xFA, 0x05, 0x6E, 0x01, 0xEC, 0xB5, 0x60, 0xEE, 0x45, 0x38, 0x9F, 0x04,
+    0x68, 0x5D, 0x41, 0x12, 0x32, 0xD8, 0x9A, 0x1F, 0x80, 0x48, 0x87, 0xFD, 0xF0, 0xF5, 0xC8, 0x94,
+    0xA4, 0x56, 0x11, 0x17, 0x5C, 0x41, 0x46, 0x55, 0x68, 0xF9, 0x99, 0xF8, 0x5C, 0xFC, 0xEF, 0x21,
+    0x5A, 0xC1, 0x0F, 0xC6, 0x0E, 0x72, 0x1E, 0x35, 0xC2, 0xFF, 0x0D, 0xA0, 0x18, 0x9D, 0xB8, 0x01,
+    0x4E, 0xF7, 0xA0, 0x8A, 0xDF, 0x43, 0x18, 0x02, 0xBE, 0x0A, 0xA9, 0xC7, 0xB6, 0x98, 0x6E, 0x8C,
+    0x78, 0xFD, 0xBF, 0xF3, 0x3C, 0x3D, 0xFA, 0xF1, 0xBB, 0x91, 0xD4, 0x06, 0x13, 0x2E, 0xFE, 0x1E,
+    0x78, 0xEA, 0x9B, 0xD7, 0x59, 0xBA, 0x90, 0x3C, 0x1E, 0xBE, 0x8D, 0xF9, 0xFC, 0x8A, 0x88, 0xDC,
+    0x19, 0x6E, 0x95, 0x36, 0xE8, 0x50, 0xF2, 0xD2, 0x53, 0xD5, 0x0F, 0x6F, 0x37, 0x76, 0x0C, 0x56,
+    0x3C, 0x21, 0xFE, 0xBC, 0xC4, 0xD9, 0xA0, 0xDE, 0x13, 0x19, 0x44, 0xA4, 0xDE, 0xA6, 0xA7, 0xF2,
+    0x69, 0xC3, 0xF7, 0xE1, 0xF3, 0x84, 0x2B, 0xF8, 0x03, 0x76, 0x4C, 0xEF, 0x9A, 0x7F, 0xCC, 0xE7,
+    0x2C, 0xFF, 0x73, 0x84, 0x2A, 0x96, 0xB3, 0x4B, 0xBA, 0x40, 0xCD, 0xB7, 0x65, 0x95, 0xB4, 0x94,
+    0x64, 0x23, 0x72, 0xF9, 0xB4, 0x87, 0xAA, 0x91, 0xD5, 0x05, 0xFB, 0xAD, 0xA6, 0xDF, 0x19, 0x8D,
+    0xB8, 0x9A, 0x6F, 0xE7, 0xE2, 0x97, 0x5E, 0x47, 0x32, 0x9E, 0x75, 0xA9, 0x9A, 0x5C, 0x3C, 0x1B,
+    0x0A, 0xA8, 0x9E, 0x07, 0x73, 0xD4, 0xC3, 0xF3, 0x69, 0xFD, 0x44, 0xC9, 0x37, 0xAE, 0xB0, 0x31,
+    0x5F, 0xB6, 0xE4, 0x43, 0x1A, 0x49, 0x8B, 0xAC, 0x61, 0x93, 0xAA, 0x66, 0x4F, 0xBF, 0x1D, 0x74,
+    0x6D, 0xBF, 0x1D, 0xAC, 0xDF, 0x4C, 0x8B, 0x4D, 0xF6, 0x32, 0xF6, 0x74, 0x9D, 0xEB, 0xDA, 0xFA,
+    0x5D, 0xEB, 0x37, 0x39, 0xD8, 0x64, 0x8F, 0x7E, 0x4F, 0xD7, 0x1C, 0xD7, 0xD6, 0x2B, 0xF1, 0x9B,
+    0x98, 0x95, 0x1E, 0xBC, 0x69, 0x73, 0x21, 0xA9, 0x81, 0x53, 0x4F, 0x45, 0x0C, 0xB3, 0x1A, 0x58,
+    0x16, 0x4F, 0x99, 0xAB, 0x2F, 0x24, 0x98, 0x30, 0x9A, 0x2B, 0xD5, 0xAE, 0xF1, 0x62, 0x5E, 0x3C,
+    0x65, 0xAD, 0xBE, 0x20, 0x81, 0x3F, 0x07, 0xF2, 0x30, 0x46, 0x94, 0x74, 0xDC, 0x87, 0x4B, 0xBA,
+    0xF8, 0x22, 0x05, 0x5E, 0x48, 0x3C, 0xB6, 0xE9, 0x61, 0xAD, 0x08, 0xEB, 0xE3, 0x87, 0x37, 0xA1,
+    0x92, 0x86, 0xFC, 0x4F, 0xAA, 0xE0, 0x6A, 0x2A, 0xDD, 0x62, 0xDA, 0x1C, 0xD2, 0xFB, 0xF5, 0x28,
+    0xC7, 0x3D, 0x38, 0x91, 0xF3, 0xAB, 0x00, 0xE5, 0x01, 0xB8, 0xFB, 0x0D, 0x74, 0x39, 0x64, 0x97,
+    0x3B, 0x4C, 0x74, 0x8D, 0xEA, 0x59, 0x7E, 0x28, 0x6B, 0xF0, 0x3E, 0x07, 0x4E, 0xB3, 0xC6, 0x94,
+    0x54, 0x05, 0xB0, 0x0C, 0x27, 0x34, 0x50, 0x73, 0xAF, 0xE6, 0xAF, 0x88, 0xCF, 0x87, 0x73, 0x0D,
+    0x69, 0xF8, 0x9C, 0x91, 0x82, 0xC7, 0xA4, 0x0E, 0x53, 0x9B, 0x48, 0x4A, 0x12, 0x55, 0x87, 0x1B,
+    0x24, 0x8C, 0x9F, 0xB8, 0xDE, 0x21, 0x29, 0x80, 0xD4, 0xAF, 0x01, 0x7F, 0x5E, 0x00, 0x37, 0xFF,
+    0x3F, 0x88, 0xBD, 0x70, 0x12, 0x62, 0xC8, 0x7A, 0x50, 0xB1, 0x04, 0xC7, 0x1B, 0x5F, 0xB8, 0xD8,
+    0xE7, 0x54, 0x03, 0xBB, 0x2E, 0xA0, 0xBA, 0xFC, 0xA9, 0x01, 0x9D, 0x6F, 0x33, 0xFF, 0xAE, 0xD4,
+    0x4E, 0xFE, 0x6D, 0x47, 0x12, 0xFF, 0x3E, 0xE1, 0x18, 0xCF, 0x16, 0x33, 0x68, 0xE9, 0x49, 0x82,
+    0xEA, 0xD9, 0xC5, 0x48, 0x15, 0xD1, 0x32, 0x00, 0x67, 0x41, 0x8D, 0x88, 0xA5, 0x87, 0xB4, 0x40,
+    0x75, 0xF0, 0xDC, 0x89, 0xCC, 0xD3, 0x52, 0xD8, 0x0F, 0x3B, 0x53, 0xE7, 0xC4, 0x24, 0xAC, 0xD7,
+    0x96, 0xAB, 0x42, 0xF5, 0x7A, 0x28, 0xD5, 0x08, 0x99, 0x73, 0x35, 0x54, 0x43, 0xD6, 0x55, 0xAC,
+    0x51, 0xAB, 0xAA, 0xA1, 0x83, 0x1E, 0x16, 0x70, 0xF1, 0x1F, 0xC8, 0x67, 0x1F, 0x96, 0x05, 0xB3,
+    0x96, 0xAD, 0x94, 0xF3, 0xFA, 0xC4, 0x34, 0x9D, 0x1B, 0xC8, 0x5E, 0x6F, 0x9C, 0xEF, 0x4D, 0x48,
+    0x21, 0x09, 0xE8, 0xA8, 0xAA, 0x5E, 0x0F, 0xB7, 0x75, 0x4C, 0x46, 0x3E, 0x7D, 0x72, 0x2C, 0x5D,
+    0xF5, 0x5E, 0xAF, 0x3C, 0x7C, 0x49, 0x15, 0xEE, 0x4E, 0xA7, 0xE3, 0x2E, 0x67, 0x1E, 0xEF, 0xCD,
+    0x5E, 0xED, 0x38, 0xBC, 0x5D, 0x4C, 0x4D, 0x74, 0x2C, 0x20, 0x05, 0x1B, 0x4E, 0x4B, 0xB4, 0xC7,
+    0xA5, 0x0D, 0xA9, 0x8E, 0x49, 0x28, 0x4D, 0x4C, 0x3F, 0x92, 0xF7, 0xE4, 0xA7, 0x71, 0xAC, 0xF2,
+    0x39, 0xE1, 0xFA, 0x97, 0x3D, 0x15, 0x4C, 0x51, 0x91, 0x14, 0xB6, 0x51, 0x70, 0x1E, 0x0E, 0x60,
+    0x05, 0xE5, 0x93, 0x7D, 0x1B, 0x29, 0xF2, 0xDB, 0xF7, 0x1A, 0xF7, 0xE7, 0x64, 0xFB, 0x2C, 0x45,
+    0x44, 0xE4, 0x00, 0x3A, 0x74, 0x24, 0x89, 0x58, 0x19, 0xAC, 0x34, 0x6B, 0x6D, 0x77, 0x50, 0x92,
+    0xD4, 0x4C, 0xA1, 0xFE, 0xFB, 0x55, 0x9E, 0x62, 0x7A, 0xD2, 0x92, 0xD8, 0x3A, 0xBF, 0xDE, 0x86,
+    0xAA, 0x1A, 0xF7, 0x51, 0xEC, 0xCC, 0x6F, 0x82, 0xFD, 0xDF, 0xA4, 0x22, 0x22, 0x72, 0xE4, 0x99,
+    0x41, 0x89, 0xEA, 0xD1, 0x22, 0x3F, 0x91, 0x8E, 0xB3, 0x9C, 0xE6, 0xE6, 0xAE, 0x0B, 0x5D, 0x8E,
+    0x3F, 0x33, 0x56, 0xCB, 0x3A, 0x73, 0xDC, 0xCF, 0x78, 0x18, 0xF5, 0xA3, 0x22, 0x11, 0x11, 0x91,
+    0x47, 0x35, 0xAE, 0x20, 0x83, 0x25, 0x54, 0xD2, 0x54, 0x03, 0x1B, 0xFE, 0x0C, 0x13, 0x76, 0xC9,
+    0xBC, 0x0D, 0x63, 0x4B, 0x9F, 0x09, 0xAB, 0x27, 0x1C, 0xD0, 0x99, 0xC6, 0xF8, 0x67, 0x97, 0x34,
+    0xB5, 0x6D, 0xD3, 0x72, 0xBA, 0xB5, 0xE7, 0x9E, 0x5D, 0xEE, 0x45, 0x7D, 0x39, 0xF6, 0xB9, 0x0D,
+    0xEB, 0x16, 0x9F, 0xEE, 0x94, 0x7C, 0xD6, 0xD6, 0x6E, 0xF6, 0x41, 0x2A, 0xA3, 0x11, 0xB6, 0x75,
+    0x20, 0x19, 0xF6, 0x50, 0x6F, 0xF5, 0x70, 0xE6, 0xC5, 0x27, 0xD3, 0xEB, 0xAA, 0x1D, 0x58, 0x1E,
+    0x49, 0xAD, 0x06, 0xD5, 0x3F, 0xD9, 0x3E, 0xFF, 0xDB, 0x30, 0xF7, 0x31, 0xA1, 0x2A, 0xF2, 0x9F,
+    0x4B, 0x9B, 0xF7, 0x78, 0x88, 0x90, 0x43, 0xD2, 0xC0, 0x2E, 0x9C, 0x18, 0x7B, 0x94, 0x34, 0x66,
+    0x90, 0x97, 0x63, 0xF2, 0xDB, 0xC8, 0x41, 0x89, 0x3B, 0xC4, 0x48, 0x81, 0x34, 0xCC, 0x7A, 0xDC,
+    0x6D, 0x6F, 0xEE, 0x45, 0xD3, 0x54, 0x7F, 0x16, 0x13, 0x69, 0x38, 0xEB, 0x4F, 0xF6, 0x17, 0x99,
+    0x41, 0x3E, 0xAA, 0x26, 0xFF, 0x30, 0x3E, 0x5B, 0x90, 0x36, 0xB8, 0x03, 0xEC, 0xBF, 0x0B, 0x49,
+    0xD8, 0x3B, 0xD9, 0xCA, 0x94, 0xC2, 0x3D, 0x5A, 0xD9, 0x90, 0xDE, 0x0F, 0xFA, 0x6F, 0x22, 0xB3,
+    0x0E, 0x37, 0x60, 0xA4, 0xE0, 0x51, 0x64, 0x76, 0x80, 0x73, 0xC1, 0xFD, 0x64, 0xB8, 0x1A, 0x52,
+    0x29, 0x98, 0x83, 0xF6, 0xDF, 0xD7, 0xED, 0x2E, 0x65, 0x5A, 0x9C, 0x52, 0x27, 0xAB, 0x65, 0x3A,
+    0x90, 0x1F, 0xB5, 0x19, 0xCB, 0x14, 0xFB, 0x76, 0xE0, 0x51, 0xB3, 0xDE, 0xBB, 0x30, 0x47, 0x81,
+    0xE3, 0x96, 0x49, 0xCE, 0xCC, 0x3E, 0xAC, 0x58, 0x0E, 0xA8, 0x2B, 0x70, 0x06, 0xD8, 0x3C, 0x71,
+    0x96, 0xFB, 0x93, 0x87, 0x57, 0x9F, 0x74, 0x77, 0x16, 0xFE, 0x69, 0x93, 0x45, 0xF7, 0x19, 0xB0,
+    0xF6, 0x63, 0x84, 0x1D, 0x56, 0xB8, 0x47, 0xF2, 0x01, 0xF2, 0x9E, 0xAC, 0xE3, 0x68, 0xEB, 0x49,
+    0x82, 0x0B, 0x63, 0xCC, 0xD2, 0xD4, 0xA0, 0xC2, 0xEF, 0x89, 0x7B, 0x12, 0xC6, 0x00, 0xAD, 0x3E,
+    0x2A, 0x50, 0x31, 0x42, 0x7C, 0xFE, 0x09, 0xE7, 0x8A, 0xDB, 0x45, 0x15, 0xF2, 0x67, 0x40, 0xF2,
+    0x13, 0x82, 0x6A, 0x4D, 0x4B, 0x7E, 0x24, 0x37, 0x8D, 0xFC, 0xB4, 0x1F, 0xFF, 0x85, 0xB0, 0xFD,
+    0xE2, 0x68, 0xD8, 0xD3, 0xCB, 0x11, 0x75, 0x32, 0xD1, 0x00, 0xDD, 0xEB, 0x43, 0x2D, 0xC8, 0xDF,
+    0x01, 0xF6, 0x33, 0x9C, 0x4F, 0x6A, 0x57, 0x23, 0xD5, 0xE0, 0xDD, 0x90, 0xC5, 0xD1, 0x5C, 0xCC,
+    0xE7, 0x73, 0x4F, 0x25, 0x22, 0x45, 0xF6, 0x97, 0xCB, 0x5B, 0x87, 0xBA, 0xA3, 0xE3, 0x52, 0xEA,
+    0x4D, 0x43, 0xDD, 0xE3, 0x0A, 0x92, 0x9A, 0x19, 0x64, 0xD0, 0x41, 0x89, 0x39, 0x16, 0x13, 0x71,
+    0xD2, 0xBB, 0xF0, 0x84, 0xBC, 0x83, 0x69, 0xA0, 0xC7, 0x15, 0xDC, 0xED, 0x98, 0x61, 0xCD, 0x8A,
+    0x8E, 0x89, 0x96, 0xD7, 0x45, 0xE2, 0xC8, 0x9B, 0xC7, 0x9A, 0x00, 0x55, 0xEB, 0x06, 0x86, 0xEA,
+    0x95, 0xA3, 0xA6, 0xD3, 0xE2, 0x17, 0x0B, 0xF2, 0xE0, 0x6E, 0x93, 0x34, 0xE6, 0xA8, 0x40, 0xE4,
+    0x51, 0x43, 0x2E, 0xAB, 0x0E, 0xE7, 0xC9, 0x49, 0x6A, 0x6C, 0xD0, 0x3D, 0xAA, 0x57, 0x12, 0xC8,
+    0xFE, 0xEA, 0x91, 0xC8, 0xCB, 0xD2, 0x66, 0x52, 0x6C, 0x78, 0x5E, 0x60, 0xDC, 0xD6, 0xFC, 0xCB,
+    0xF9, 0x7C, 0x7B, 0x3E, 0x9F, 0xCF, 0xE7, 0xF3, 0xD1, 0xB2, 0xFD, 0x6E, 0x3E, 0x9F, 0xCF, 0xE7,
+    0x57, 0x94, 0xB9, 0x17, 0xE2, 0x7E, 0x6E, 0xEB, 0x76, 0xC3, 0xD6, 0xDD, 0xCC, 0x5D, 0xBE, 0x5B,
+    0x37, 0x0A, 0x1F, 0x27, 0x13, 0x67, 0x42, 0xDC, 0xDF, 0x72, 0xF7, 0xE2, 0x41, 0x76, 0xB9, 0x6E,
+    0x37, 0xD4, 0xCB, 0xED, 0x81, 0xBB, 0xD1, 0x74, 0x33, 0x77, 0xB9, 0x8E, 0x93, 0x4D, 0x7B, 0xB9,
+    0x18, 0x83, 0x7C, 0xAE, 0xB0, 0x21, 0x79, 0x10, 0x4D, 0x34, 0x0F, 0x3B, 0x7A, 0x0E, 0x4E, 0x71,
+    0x8A, 0x53, 0xFC, 0x5F, 0xBD, 0x97, 0x3D, 0xAC, 0x1D, 0xC7, 0x75, 0xC7, 0x7F, 0xBB, 0xA3, 0xC7,
+    0x45, 0x34, 0x81, 0x47, 0x05, 0x89, 0x00, 0xA1, 0xED, 0x6D, 0x52, 0x18, 0x08, 0xC9, 0x49, 0x91,
+    0x82, 0x81, 0xEF, 0xDE, 0x1D, 0x9A, 0x85, 0x0B, 0x15, 0x22, 0xA0, 0x77, 0xED, 0xC2, 0x40, 0x94,
+    0xDA, 0xCD, 0x6B, 0x5C, 0xA8, 0xB8, 0xEF, 0xDD, 0x95, 0x55, 0xA4, 0x50, 0x61, 0x36, 0x76, 0x8A,
+    0x14, 0x09, 0xE0, 0xA4, 0x08, 0x55, 0x50, 0x05, 0x11, 0x38, 0xC0, 0xF2, 0xED, 0xA1, 0x58, 0xBA,
+    0xD0, 0x28, 0x06, 0x92, 0x22, 0x85, 0x57, 0x16, 0xE3, 0x30, 0x4F, 0x05, 0x27, 0xD2, 0x3A, 0xDA,
+    0xF7, 0xB8, 0x77, 0x4F, 0x8A, 0xFB, 0x28, 0x4B, 0xB2, 0x8D, 0xC4, 0x09, 0x90, 0xC1, 0xCE, 0xD7,
+    0xD9, 0x99, 0x33, 0x1F, 0x67, 0xCE, 0xFF, 0x9C, 0x93, 0xDF, 0x7E, 0x95, 0x8D, 0x93, 0xA2, 0x9F,
+    0xD8, 0xA5, 0xBD, 0xD5, 0x6A, 0x5F, 0x55, 0x1F, 0xCC, 0x77, 0x5A, 0x2B, 0xB9, 0xB4, 0x7C, 0xD1,
+    0x0A, 0xB4, 0x60, 0x05, 0x8E, 0xEF, 0xF6, 0x56, 0xE7, 0x67, 0xBD, 0x5D, 0xF5, 0xD7, 0x2D, 0xCE,
+    0x4A, 0xF6, 0x33, 0xD5, 0x59, 0x55, 0x23, 0x5C, 0x04, 0x4C, 0x02, 0xCA, 0x08, 0x74, 0x0D, 0x98,
+    0x9F, 0x02, 0x57, 0x2B, 0x20, 0x4D, 0x50, 0xBC, 0x96, 0xA0, 0x32, 0x3D, 0x59, 0xB2, 0x82, 0xFD,
+    0xFE, 0x41, 0xA0, 0xD6, 0x99, 0xFC, 0xEC, 0xCE, 0x84, 0x0B, 0xD9, 0xC0, 0x1A, 0x93, 0x4C, 0x8F,
+    0x15, 0xDF, 0xD3, 0xBD, 0xAF, 0xD1, 0x69, 0x5C, 0xAD, 0x56, 0x4E, 0x75, 0x2C, 0x4F, 0xEE, 0x86,
+    0x96, 0x7B, 0x56, 0x0A, 0x5A, 0x5E, 0x78, 0xB6, 0x07, 0x3D, 0xE5, 0xB8, 0x1B, 0xAD, 0xD8, 0xD8,
+    0x52, 0x5B, 0xC9, 0x53, 0x8B, 0xB7, 0x62, 0xFA, 0x96, 0xC9, 0x3F, 0xD5, 0x97, 0x54, 0x1B, 0x80,
+    0xBD, 0x3B, 0xB7, 0x9C, 0xAA, 0x94, 0x0F, 0x3A, 0xDA, 0x7C, 0xB0, 0xE2, 0x42, 0xCB, 0x60, 0xC5,
+    0xD1, 0xE6, 0xBD, 0xD5, 0x89, 0x4E, 0x07, 0x2B, 0xA5, 0xB4, 0x54, 0xBB, 0xB9, 0x4B, 0x2B, 0x45,
+    0x6C, 0xB3, 0xC9, 0x3F, 0x55, 0xA7, 0x1A, 0x00, 0x56, 0xAB, 0x55, 0xAD, 0xFA, 0xDE, 0x7C, 0x67,
+    0xF0, 0x54, 0x56, 0xEC, 0xD7, 0x52, 0x2E, 0x2D, 0x2F, 0x78, 0xB0, 0x42, 0x9E, 0xA0, 0x85, 0xCF,
+    0x77, 0xFC, 0x29, 0xB5, 0x36, 0xB0, 0x5A, 0xAD, 0x82, 0x53, 0xDD, 0x72, 0xF9, 0x64, 0x86, 0x7B,
+    0x85, 0x60, 0xC3, 0x1A, 0xDE, 0x2A, 0x04, 0xC7, 0x1A, 0xD2, 0x79, 0x23, 0xEB, 0x0B, 0xE1, 0x2A,
+    0x6B, 0x8C, 0x14, 0xC2, 0x82, 0x35, 0x36, 0x14, 0x42, 0x62, 0xCD, 0x35, 0x0A, 0xF1, 0xAA, 0xFA,
+    0x17, 0xAA, 0xAA, 0x87, 0x60, 0x3E, 0x12, 0x58, 0x2E, 0x20, 0xFF, 0x89, 0xC0, 0x97, 0xBE, 0x02,
+    0xC8, 0xF9, 0x36, 0x5F, 0x52, 0x9D, 0xCA, 0x93, 0x37, 0xA5, 0xE5, 0x8A, 0x95, 0x4C, 0x3E, 0x25,
+    0xB0, 0x93, 0x99, 0x4E, 0xFB, 0x4F, 0xC9, 0xB4, 0xE5, 0x79, 0x2B, 0xA4, 0x96, 0x2F, 0x7B, 0xD5,
+    0x27, 0xAA, 0xDB, 0x0B, 0x61, 0x6F, 0xC5, 0x1F, 0x98, 0xC1, 0xA9, 0xD4, 0x41, 0xD9, 0x84, 0x3A,
+    0xE6, 0xC9, 0x4A, 0x09, 0x57, 0xF3, 0xE4, 0xC0, 0x48, 0x6B, 0x03, 0xDC, 0xF3, 0x46, 0xC0, 0xD9,
+    0xB7, 0x23, 0x64, 0xFA, 0x34, 0x01, 0xAA, 0x13, 0xB0, 0xF6, 0x56, 0x60, 0x69, 0x65, 0x80, 0x3A,
+    0x4F, 0x1E, 0xCA, 0xD0, 0x9A, 0x84, 0x13, 0xCF, 0x31, 0x2E, 0x5A, 0x71, 0xD1, 0xF5, 0x76, 0x66,
+    0x5B, 0xF6, 0x4E, 0xA5, 0x7C, 0x2F, 0x00, 0xDC, 0xE2, 0xDB, 0xB7, 0xE9, 0x34, 0xBA, 0xB8, 0x21,
+    0x31, 0x7E, 0x01, 0xD7, 0x44, 0x46, 0x28, 0xC1, 0xF4, 0xD4, 0x13, 0x46, 0x13, 0x6C, 0x04, 0x26,
+    0x28, 0x62, 0xE0, 0xB0, 0xC2, 0x3E, 0x4C, 0xD9, 0xE4, 0x7F, 0xDE, 0xD1, 0x69, 0xC3, 0xA5, 0xC0,
+    0x6A, 0x9F, 0xD5, 0xCB, 0x9A, 0x0A, 0x7D, 0x6F, 0xCB, 0x85, 0x31, 0x4F, 0x14, 0xD1, 0x0A, 0x75,
+    0xF0, 0x98, 0x2D, 0x2D, 0xCB, 0x21, 0x4F, 0xE6, 0x27, 0xD1, 0x4A, 0xE5, 0x82, 0x37, 0xB1, 0xA2,
+    0xAD, 0x18, 0xF2, 0x8F, 0x7A, 0x13, 0xED, 0x8C, 0x0B, 0xBE, 0xA7, 0xE2, 0x18, 0x86, 0x3C, 0x61,
+    0xA2, 0x7F, 0xCC, 0xC1, 0xBF, 0x69, 0x2A, 0xB4, 0xE7, 0x39, 0xC2, 0x4E, 0x3E, 0xA6, 0xAF, 0xA1,
+    0xD0, 0x04, 0xD9, 0xFE, 0x33, 0x6D, 0x09, 0x7B, 0xAB, 0x5A, 0xD9, 0xCC, 0x65, 0xE4, 0xA0, 0xF1,
+    0x70, 0x48, 0x8B, 0x19, 0xF2, 0x44, 0x1D, 0xAD, 0x98, 0x27, 0xC1, 0x53, 0x55, 0xB4, 0x26, 0x0E,
+    0x79, 0xAA, 0x4C, 0xB4, 0x0F, 0xA3, 0x0B, 0x7E, 0x49, 0x45, 0xD7, 0x33, 0xE4, 0x33, 0x26, 0xDA,
+    0x1E, 0x17, 0x3C, 0x54, 0xF9, 0xDC, 0x5C, 0x98, 0x37, 0xCA, 0x66, 0x5E, 0xED, 0xF3, 0x67, 0xB5,
+    0xD2, 0x65, 0x5B, 0x36, 0xE2, 0xA9, 0xB0, 0x72, 0x8D, 0x3C, 0x39, 0x68, 0x6D, 0xC0, 0x9B, 0x06,
+    0xFB, 0x44, 0xC8, 0x75, 0x84, 0xB6, 0x0C, 0x78, 0x93, 0xB0, 0x72, 0x44, 0x9E, 0x6C, 0xA4, 0x65,
+    0xC2, 0x53, 0x8A, 0x1F, 0xF3, 0xA9, 0x56, 0xBC, 0x40, 0x76, 0xEB, 0x97, 0xAF, 0xAF, 0xFC, 0xCC,
+    0xEB, 0xBB, 0xF7, 0xF9, 0xD7, 0x47, 0x2A, 0x84, 0x2F, 0xB3, 0x26, 0x8F, 0xE7, 0xAF, 0xAF, 0x90,
+    0x42, 0x18, 0x58, 0x17, 0x07, 0x14, 0xD2, 0x49, 0xA6, 0x6F, 0x0C, 0xE8, 0xF6, 0x22, 0xC0, 0xDE,
+    0x3E, 0xAC, 0xA8, 0x47, 0xDC, 0x8C, 0x4F, 0xD4, 0x91, 0x8D, 0xE4, 0x33, 0xD9, 0x93, 0xE0, 0xD6,
+    0x14, 0x07, 0xFC, 0x49, 0xE2, 0xEA, 0x3A, 0xFF, 0x67, 0xE1, 0xAD, 0xC1, 0x39, 0xCC, 0xDB, 0xFD,
+    0xF5, 0x05, 0xAE, 0x78, 0x5B, 0x06, 0x16, 0xEE, 0x25, 0x13, 0x49, 0xD7, 0x5E, 0x75, 0xC1, 0xC8,
+    0x52, 0x96, 0x94, 0x28, 0x3F, 0xE2, 0xD5, 0x7C, 0xC8, 0x53, 0xD6, 0x1B, 0xB1, 0xE2, 0x1F, 0xED,
+    0xD1, 0xBD, 0xAF, 0x09, 0xA7, 0xB2, 0xDA, 0x67, 0xF5, 0xCD, 0x73, 0xB1, 0xEE, 0x8D, 0x79, 0xC2,
+    0xF4, 0x56, 0x70, 0x8D, 0x87, 0x25, 0x2D, 0x9C, 0x93, 0x54, 0xB5, 0xF1, 0xBA, 0x83, 0xA7, 0xDF,
+    0x38, 0xCA, 0x8F, 0x9F, 0x88, 0xF5, 0xC2, 0xDF, 0x81, 0xD5, 0x19, 0x73, 0x7A, 0x79, 0x62, 0x8B,
+    0x4D, 0x3E, 0x50, 0xDF, 0x4C, 0x64, 0xD3, 0x21, 0xB8, 0x1F, 0x0B, 0x4C, 0x2D, 0xD8, 0x77, 0x04,
+    0xDA, 0x09, 0xEC, 0x8F, 0x23, 0x4C, 0x47, 0xE0, 0x5E, 0x4F, 0xE4, 0x43, 0xDD, 0x50, 0x33, 0x53,
+    0x4A, 0x31, 0xDF, 0x4D, 0x58, 0x1D, 0x61, 0xEF, 0x16, 0xAC, 0x56, 0xAB, 0xD5, 0xCB, 0xBA, 0x03,
+    0xD0, 0x37, 0x87, 0x3C, 0x61, 0xC5, 0x0A, 0x1E, 0x0F, 0x2D, 0x2D, 0x79, 0xFA, 0x2D, 0x48, 0x7E,
+    0xA4, 0xFB, 0xA1, 0x26, 0xA7, 0xB2, 0xC3, 0xAE, 0x58, 0x3E, 0xE8, 0x42, 0xCB, 0x64, 0xC5, 0x4A,
+    0xCB, 0x7A, 0x57, 0x4D, 0x56, 0x3C, 0xC7, 0x5D, 0xB4, 0xDA, 0x7F, 0x16, 0x97, 0x69, 0xC1, 0x9F,
+    0xE2, 0xB4, 0x87, 0xBD, 0xBF, 0xA5, 0xD0, 0xC9, 0x9C, 0xBE, 0x22, 0x13, 0x8B, 0x12, 0xF3, 0xB0,
+    0xE7, 0xCA, 0xE1, 0x27, 0xA3, 0xDC, 0x4E, 0xA9, 0xAC, 0xC0, 0x7D, 0x28, 0x12, 0xD4, 0x0D, 0x99,
+    0x86, 0x0B, 0x85, 0x6A, 0x6F, 0x75, 0x24, 0xBB, 0xC5, 0xA5, 0x1D, 0x02, 0xEB, 0xC3, 0x93, 0xEE,
+    0x4E, 0x4A, 0xAE, 0x59, 0x2C, 0x4C, 0xEF, 0x7E, 0x87, 0x31, 0x0F, 0x2C, 0x01, 0xD7, 0x80, 0xE9,
+    0x81, 0x11, 0x7E, 0x33, 0xE1, 0xF2, 0x19, 0xD4, 0x1A, 0xB9, 0xB4, 0xCF, 0xEA, 0x5B, 0xDA, 0xFB,
+    0xB9, 0xEC, 0xA9, 0xC3, 0x12, 0x13, 0xF3, 0xC4, 0x1A, 0xD7, 0xB8, 0x40, 0x9B, 0x25, 0x4C, 0x5F,
+    0x81, 0x2F, 0x04, 0xC6, 0x7B, 0x60, 0xDF, 0x01, 0xEA, 0x08, 0xF9, 0x04, 0xB8, 0x00, 0xF4, 0xF0,
+    0xBB, 0x0B, 0xC8, 0x35, 0x80, 0x8F, 0xC0, 0x2D, 0x80, 0x52, 0x03, 0x74, 0xB7, 0x21, 0x4B, 0x70,
+    0xA1, 0xFB, 0x77, 0x0A, 0xD5, 0x6D, 0x3E, 0x96, 0xC5, 0x78, 0x94, 0x25, 0xFB, 0x2F, 0x52, 0xB2,
+    0x9C, 0xB2, 0x64, 0xB4, 0x29, 0xA9, 0xA7, 0x2C, 0x99, 0x0F, 0x62, 0x49, 0x5B, 0xDF, 0x48, 0xBE,
+    0xD1, 0xBB, 0x77, 0x63, 0xD6, 0x69, 0x84, 0x12, 0xC8, 0x06, 0xC8, 0x74, 0x80, 0x4B, 0x2B, 0xB8,
+    0xB4, 0x62, 0x75, 0x53, 0x93, 0xDF, 0x16, 0x03, 0x47, 0x94, 0xE2, 0x1A, 0xEE, 0xE7, 0x09, 0x93,
+    0xD6, 0x50, 0xBE, 0x13, 0xA0, 0xEB, 0xC1, 0x4C, 0x80, 0x17, 0x28, 0x66, 0xE0, 0xC3, 0x01, 0x2A,
+    0x27, 0xD8, 0xA6, 0x26, 0x4B, 0xF9, 0x48, 0x85, 0x8B, 0xFE, 0x51, 0xA6, 0x7F, 0xA5, 0xD2, 0xE9,
+    0x6A, 0x3F, 0x5B, 0xBD, 0xAC, 0xA9, 0xD4, 0x07, 0x5B, 0x7E, 0x2F, 0xE5, 0x09, 0xD7, 0x58, 0x61,
+    0x89, 0x87, 0x91, 0x16, 0xD3, 0xFF, 0x16, 0x24, 0xAF, 0xAA, 0x3F, 0x54, 0x55, 0x15, 0xC0, 0x03,
+    0xAC, 0x01, 0x12, 0x60, 0x1A, 0xE0, 0x79, 0x00, 0x2E, 0xED, 0xEF, 0xAD, 0x5E, 0xD1, 0x9B, 0xFA,
+    0xDE, 0x31, 0x07, 0x8D, 0x0B, 0x26, 0x9A, 0xC8, 0xC0, 0x40, 0x45, 0x85, 0x0B, 0xAE, 0x31, 0xD1,
+    0x0C, 0x0C, 0x6C, 0x4E, 0xB6, 0x14, 0xAA, 0x81, 0x4B, 0x37, 0x23, 0x30, 0x00, 0xD5, 0xF9, 0x85,
+    0x9B, 0x08, 0xC5, 0x1C, 0x70, 0xDA, 0xAF, 0xF6, 0x2F, 0xED, 0xEF, 0xAD, 0x6A, 0x75, 0xFA, 0xE7,
+    0xFA, 0xEE, 0xC4, 0x11, 0x07, 0x8D, 0xC7, 0x35, 0x26, 0x5A, 0x31, 0x3D, 0x43, 0x9E, 0x18, 0xA9,
+    0x68, 0x59, 0xE2, 0xC2, 0xFF, 0xF6, 0x87, 0x57, 0x55, 0x9D, 0x6B, 0x55, 0x55, 0x8D, 0xFF, 0x7F,
+    0x0B, 0x6E, 0x54, 0x55, 0x35, 0x01, 0xB0, 0x73, 0x87, 0xAE, 0x01, 0x60, 0x1B, 0x80, 0x2C, 0x02,
+    0xF0, 0x47, 0x3B, 0xE0, 0xBF, 0xB4, 0x5A, 0xED, 0xEC, 0x9D, 0x39, 0xE9, 0x02, 0x8E, 0x09, 0x16,
+    0x26, 0xC1, 0x6D, 0x27, 0x40, 0xFD, 0x8C, 0x85, 0xD1, 0x19, 0xDC, 0x89, 0x42, 0xCD, 0x06, 0x26,
+    0x5A, 0x4C, 0xCA, 0x06, 0x9C, 0x14, 0x91, 0x1A, 0x0F, 0x53, 0x3E, 0x72, 0xF9, 0x4C, 0x1B, 0x54,
+    0x1F, 0xED, 0x58, 0xAF, 0xF6, 0xC9, 0x56, 0x2F, 0xA9, 0xA0, 0xDB, 0x32, 0x92, 0xDD, 0xA7, 0x85,
+    0x42, 0xAC, 0xC0, 0xFA, 0x57, 0x9B, 0x3A, 0xB2, 0xE6, 0xF8, 0xEE, 0x50, 0x88, 0x15, 0x27, 0x6B,
+    0x5A, 0x0E, 0x0B, 0xB1, 0x62, 0xFA, 0x35, 0x2D, 0x55, 0x21, 0x56, 0x0A, 0x59, 0xD3, 0x66, 0x53,
+    0x21, 0xFE, 0x03, 0xCD, 0xF5, 0x7B, 0x3A, 0x07, 0xDD, 0x7E, 0xB2, 0x90, 0x53, 0xA1, 0x8C, 0xFC,
+    0x2A, 0x72, 0x58, 0xDD, 0x72, 0xFC, 0xE6, 0x7F, 0xEB, 0x54, 0xF1, 0xED, 0xC0, 0x46, 0x7B, 0x73,
+    0x7A, 0x30, 0x38, 0x8A, 0xB4, 0xA0, 0xE8, 0xDF, 0xC2, 0x09, 0xF8, 0x00, 0x87, 0x74, 0x3A, 0x1A,
+    0xD5, 0x1E, 0xCA, 0x00, 0x87, 0x90, 0xA7, 0x80, 0x7B, 0xA3, 0xA1, 0xAD, 0x83, 0xED, 0x37, 0x27,
+    0x33, 0x1B, 0x6D, 0xC8, 0x02, 0xAC, 0xF6, 0xB9, 0xF0, 0x37, 0xD4, 0x4A, 0xA9, 0x7D, 0xB6, 0xC5,
+    0xFF, 0x40, 0xF1, 0xF8, 0x60, 0x93, 0x95, 0x32, 0xB0, 0xCD, 0x93, 0x13, 0xCA, 0xA6, 0x35, 0x3D,
+    0x26, 0xF9, 0x6C, 0x80, 0xD6, 0x9E, 0x4C, 0xE0, 0x73, 0x55, 0xB0, 0xD2, 0x5A, 0x21, 0x4F, 0x3E,
+    0x1F, 0x60, 0xB2, 0x72, 0x04, 0xCB, 0xDD, 0x8C, 0xD0, 0xE6, 0x23, 0x4E, 0x3C, 0x75, 0xE3, 0xC4,
+    0x3F, 0x36, 0x73, 0x27, 0xB5, 0xE2, 0x77, 0x7B, 0xBF, 0xB8, 0x93, 0x23, 0xB9, 0x6A, 0x6F, 0x4E,
+    0x0F, 0x1A, 0x93, 0xCE, 0xF5, 0x62, 0x4D, 0x45, 0xC9, 0xB9, 0xA2, 0xDC, 0x67, 0xC0, 0xEA, 0x16,
+    0x36, 0x1A, 0xA8, 0x4D, 0xA4, 0x0C, 0x03, 0x4E, 0x2A, 0x9C, 0xB8, 0x60, 0x7B, 0x13, 0x6D, 0xBA,
+    0x30, 0xBF, 0xD8, 0x5B, 0xDD, 0xB9, 0x31, 0x90, 0x75, 0x7D, 0x7E, 0x76, 0xCC, 0xE0, 0x64, 0x91,
+    0x25, 0x58, 0x83, 0xE7, 0xB2, 0x8A, 0x3F, 0x49, 0x9E, 0xB5, 0x95, 0x32, 0x4F, 0x4E, 0x36, 0x77,
+    0xF5, 0x8D, 0xD9, 0xCB, 0xC5, 0x73, 0x9F, 0xFB, 0x1B, 0x62, 0x35, 0xB9, 0x0F, 0x06, 0x17, 0xB0,
+    0x82, 0x89, 0x64, 0x09, 0xFE, 0x41, 0x7B, 0x3F, 0xAB, 0xEB, 0x8B, 0x8F, 0x7A, 0xDA, 0x11, 0x77,
+    0x84, 0x79, 0x22, 0xFC, 0x67, 0xA2, 0x3A, 0xA4, 0x74, 0xE2, 0x5E, 0x9B, 0x0F, 0xA4, 0xD4, 0x86,
+    0x4B, 0x50, 0x6B, 0x6F, 0xE7, 0x2E, 0x54, 0x79, 0x72, 0x61, 0x6D, 0x62, 0xC9, 0xE9, 0x2B, 0xD4,
+    0x1A, 0xDD, 0x8D, 0xFB, 0x26, 0xBA, 0x66, 0x30, 0x7D, 0xC5, 0xE0, 0x7F, 0x30, 0xD5, 0x3A, 0x00,
+    0xD4, 0xBA, 0xF5, 0xBA, 0x35, 0xFD, 0x55, 0xD3, 0x7F, 0xC9, 0xF4, 0x5F, 0x34, 0x3D, 0x9F, 0xFB,
+    0xEC, 0x19, 0xB5, 0x06, 0xA3, 0xE7, 0xC2, 0x5B, 0xD8, 0x86, 0x85, 0x6D, 0xB8, 0x7E, 0x9E, 0xBF,
+    0x63, 0x1B, 0xDE, 0xB2, 0x0D, 0xC9, 0x36, 0x59, 0x6F, 0x1B, 0x23, 0xB6, 0x29, 0xCF, 0xBA, 0xC7,
+    0x1B, 0xD5, 0xED, 0x1A, 0x16, 0x8B, 0xF3, 0x7C, 0x1D, 0xAE, 0xBC, 0x00, 0xCF, 0x01, 0x76, 0x66,
+    0xEE, 0x5C, 0xB3, 0x5C, 0x73, 0xDC, 0x67, 0xAA, 0xAA, 0x3A, 0x0F, 0x98, 0x1E, 0x2B, 0x94, 0x82,
+    0xD7, 0xD1, 0x6B, 0x93, 0xDD, 0xDA, 0xDD, 0x85, 0xCF, 0x54, 0x26, 0xFF, 0xE0, 0xF8, 0xE6, 0x94,
+    0xF5, 0x8B, 0xA2, 0xE1, 0xAD, 0x85, 0x83, 0xEB, 0x8B, 0xAB, 0x70, 0xF5, 0xF0, 0x55, 0xF0, 0x3A,
+    0xC1, 0x7A, 0x51, 0xC1, 0xB8, 0x28, 0xC9, 0xD2, 0xC2, 0x35, 0xA6, 0x5F, 0x14, 0xD1, 0xC9, 0x51,
+    0x9E, 0x36, 0x46, 0x65, 0x7B, 0x91, 0xF3, 0x45, 0xF5, 0xC6, 0x99, 0x3E, 0xCF, 0x21, 0x0C, 0x18,
+    0xD9, 0x6B, 0xA9, 0x47, 0xB2, 0x91, 0xFC, 0x3F, 0x82, 0x7D, 0x87, 0x65, 0xFD, 0x97, 0xA9, 0x9E,
+    0xD9, 0x0B, 0xD4, 0x93, 0xD5, 0x17, 0xB7, 0xB9, 0x36, 0x15, 0x0E, 0x17, 0x9C, 0x98, 0xE8, 0x12,
+    0x43, 0xB9, 0xA0, 0x2A, 0x1D, 0xEE, 0x4F, 0x8D, 0x98, 0x99, 0xC4, 0xCC, 0x82, 0x25, 0x0E, 0x7F,
+    0xDB, 0x8E, 0xF5, 0xE4, 0x34, 0xF0, 0x1D, 0xD3, 0x70, 0x2D, 0x4B, 0x14, 0x71, 0x84, 0xCD, 0xC8,
+    0xB3, 0x64, 0x54, 0xBA, 0xA1, 0x8B, 0x7E, 0x34, 0x91, 0xC4, 0xC0, 0x44, 0x85, 0xE2, 0x6E, 0x7C,
+    0x24, 0xE6, 0xDD, 0x94, 0xF8, 0x45, 0xBF, 0xA0, 0xEE, 0x1D, 0xAE, 0x37, 0x62, 0x7A, 0x52, 0x7E,
+    0x4A, 0xF7, 0xBA, 0xCA, 0x4E, 0x34, 0x9A, 0xCA, 0xAF, 0x69, 0xD8, 0x32, 0x38, 0x4C, 0xBC, 0x87,
+    0xBB, 0xD9, 0xB0, 0x5C, 0x83, 0x26, 0xCC, 0x3F, 0x26, 0xDC, 0xCD, 0x48, 0x55, 0x08, 0x83, 0x13,
+    0x3B, 0xB8, 0x46, 0x53, 0x29, 0xB0, 0x87, 0x51, 0x1D, 0x9C, 0x6A, 0x63, 0x64, 0xE0, 0x0B, 0x26,
+    0x72, 0xDD, 0x05, 0xFA, 0x8A, 0x22, 0x0C, 0x5C, 0x31, 0x91, 0xE4, 0x42, 0xD1, 0x54, 0xF9, 0x9A,
+    0xC1, 0xF7, 0x76, 0x3C, 0x46, 0x87, 0x00, 0x6C, 0x84, 0xEE, 0xBB, 0x33, 0x6E, 0x70, 0x29, 0xDF,
+    0xF2, 0xB4, 0xF9, 0x6A, 0x74, 0x0B, 0x5B, 0xF1, 0x61, 0x7C, 0x3F, 0xBA, 0xF2, 0x4A, 0x45, 0xFA,
+    0xF8, 0xF5, 0xE8, 0x8A, 0x54, 0x91, 0x96, 0x26, 0xBA, 0x4C, 0xAA, 0xFC, 0x94, 0x62, 0xD4, 0x64,
+    0x54, 0xEA, 0xC9, 0xE9, 0x8B, 0x73, 0xAE, 0x61, 0xF9, 0xCC, 0x7A, 0xF4, 0x0C, 0x9C, 0xAE, 0x0E,
+    0xA9, 0x55, 0x83, 0xFB, 0xFE, 0x37, 0x77, 0x84, 0x91, 0x6A, 0x87, 0xB0, 0xBD, 0x1D, 0xEB, 0xAD,
+    0xDB, 0x45, 0x50, 0x9B, 0x11, 0xED, 0x62, 0x9B, 0x4D, 0x6B, 0xFC, 0x01, 0xE6, 0x49, 0x83, 0xF6,
+    0xD4, 0x23, 0xAE, 0xC3, 0x7C, 0x10, 0x49, 0x13, 0xA3, 0xFF, 0xF9, 0x94, 0xE9, 0xC8, 0xDE, 0x2D,
+    0x6A, 0x55, 0xB5, 0xAA, 0x1A, 0x96, 0x94, 0xB8, 0xA6, 0x10, 0xD3, 0x67, 0x89, 0x91, 0x35, 0xBF,
+    0x96, 0xE0, 0xFB, 0xF2, 0x71, 0xBD, 0x75, 0x0A, 0xC0, 0x71, 0x39, 0xBA, 0x59, 0xA7, 0x7C, 0x9B,
+    0x8F, 0x45, 0x34, 0xA9, 0xC4, 0xCA, 0x9A, 0xF2, 0x46, 0xE2, 0xB0, 0x90, 0xEC, 0xBC, 0xBB, 0xCC,
+    0x52, 0x9E, 0x8A, 0xB9, 0x0B, 0xA5, 0xF6, 0xAC, 0x77, 0x6E, 0x43, 0x21, 0x50, 0x42, 0xAE, 0x91,
+    0xDF, 0xBF, 0x13, 0x00, 0x0A, 0x0D, 0xC7, 0xDD, 0x8B, 0xB2, 0x5C, 0xF0, 0xF7, 0x09, 0xD7, 0xB0,
+    0x84, 0x11, 0x93, 0xB0, 0x91, 0x32, 0xE2, 0x75, 0x2A, 0x55, 0xB2, 0x5B, 0xD4, 0xAA, 0x0F, 0x55,
+    0xA7, 0x45, 0x69, 0x1E, 0xBE, 0x96, 0x16, 0xD7, 0xCB, 0xBC, 0xC9, 0x12, 0x94, 0x3B, 0xAE, 0xBF,
+    0xAC, 0x8A, 0x39, 0x18, 0x1D, 0xD9, 0x8C, 0x7E, 0xD4, 0xDB, 0x07, 0x71, 0xA4, 0xCA, 0x53, 0x96,
+    0x4C, 0x74, 0xC1, 0xCA, 0x82, 0x32, 0xEF, 0x59, 0x3A, 0x58, 0xBF, 0x0A, 0x1F, 0x0B, 0xF9, 0x0C,
+    0x66, 0xD8, 0x61, 0x72, 0x05, 0x59, 0x0F, 0x25, 0x9C, 0x25, 0x8C, 0x42, 0xD1, 0x03, 0x10, 0xC0,
+    0x0E, 0x90, 0xDF, 0xFF, 0x94, 0xA9, 0x7E, 0x66, 0xBB, 0x73, 0xDD, 0x62, 0x55, 0x07, 0x1B, 0x87,
+    0xCD, 0xCD, 0x58, 0x99, 0x0F, 0x93, 0x0B, 0xEB, 0xD1, 0x44, 0x77, 0xC4, 0x60, 0x7E, 0xDA, 0x54,
+    0x7C, 0x9C, 0x5C, 0x58, 0x1F, 0x9A, 0xE8, 0x5D, 0x1C, 0x3C, 0xDA, 0x69, 0x28, 0x74, 0xFE, 0x2C,
+    0x0F, 0x5C, 0x00, 0x3F, 0xC3, 0xF3, 0x77, 0x02, 0xF5, 0x58, 0x0F, 0x1A, 0xBB, 0xE6, 0x88, 0x81,
+    0x43, 0x17, 0x68, 0xEF, 0xED, 0x02, 0xFC, 0x09, 0x8A, 0x11, 0x16, 0x23, 0xE6, 0xC1, 0x40, 0x95,
+    0xA7, 0x62, 0x28, 0xC6, 0x6E, 0xE8, 0x86, 0x7A, 0x2A, 0xD5, 0xCE, 0x46, 0xC3, 0x12, 0x8F, 0x6B,
+    0xAC, 0x98, 0x3E, 0x4F, 0x8C, 0xB4, 0xFC, 0x5A, 0x82, 0x3F, 0xE9, 0xC6, 0x5A, 0x55, 0x9F, 0x9D,
+    0x23, 0x01, 0x57, 0x80, 0x02, 0x20, 0x74, 0xA9, 0xFB, 0x50, 0xBF, 0xAB, 0x61, 0xCC, 0x92, 0xE9,
+    0x0B, 0x71, 0x4D, 0x89, 0x67, 0xCD, 0xE6, 0x1B, 0x89, 0x8D, 0x0A, 0x7B, 0xE5, 0xCE, 0xFF, 0xC9,
+    0x12, 0x5C, 0x1E, 0xC9, 0x35, 0xF9, 0x71, 0xF3, 0x33, 0x7D, 0x5B, 0xBF, 0x3E, 0x95, 0x83, 0x89,
+    0x8E, 0x35, 0x15, 0xA9, 0x90, 0xFF, 0x61, 0xB3, 0xBB, 0x73, 0x76, 0xF7, 0x71, 0xAD, 0xAA, 0x2A,
+    0xFF, 0x67, 0x3E, 0x63, 0xAD, 0xAA, 0xDA, 0x73, 0x7E, 0xA5, 0xBB, 0xC3, 0x71, 0x05, 0x20, 0x13,
+    0x80, 0xE7, 0x6A, 0x1D, 0xA8, 0xB5, 0x67, 0xE1, 0xE0, 0xBA, 0x83, 0x3F, 0x76, 0x80, 0xD3, 0xDB,
+    0xB8, 0x27, 0x03, 0x8E, 0x16, 0xC7, 0xE2, 0x3C, 0xB7, 0xF8, 0x37, 0x07, 0xCE, 0x0D, 0x70, 0xBD,
+    0x65, 0xB3, 0xF5, 0x23, 0xF5, 0x60, 0x22, 0x85, 0x7C, 0xAA, 0x78, 0xFA, 0xA8, 0x10, 0xA3, 0x73,
+    0x21, 0x26, 0xFA, 0x42, 0x4C, 0x74, 0x5F, 0x7F, 0x56, 0x94, 0x85, 0xD8, 0xB3, 0xAD, 0x1D, 0x6B,
+    0x7D, 0x54, 0xEF, 0x5C, 0x81, 0x7A, 0x8B, 0x9D, 0xA1, 0x02, 0x17, 0x30, 0x11, 0x74, 0x4B, 0xFD,
+    0x24, 0xB9, 0x70, 0x68, 0xA2, 0x0B, 0x83, 0x89, 0x15, 0xC9, 0x9F, 0x8C, 0xE7, 0x06, 0x04, 0xC8,
+    0x35, 0x96, 0x77, 0x87, 0xAF, 0x30, 0xC1, 0x21, 0x2C, 0x59, 0x6D, 0x50, 0xE5, 0xE2, 0x35, 0x58,
+    0x5E, 0xA4, 0x5A, 0xD0, 0xD6, 0x6F, 0x26, 0xA7, 0x0D, 0xE7, 0x61, 0xB2, 0x53, 0x36, 0x43, 0xAE,
+    0xCD, 0x71, 0xD7, 0xB8, 0xA6, 0xCD, 0x07, 0xD3, 0x57, 0x2C, 0x19, 0x4B, 0xAC, 0x2C, 0xBF, 0x25,
+    0x59, 0x72, 0x9A, 0x58, 0x9B, 0x7F, 0x6D, 0x29, 0xCF, 0x89, 0x45, 0x34, 0xBD, 0x6B, 0xA6, 0x2C,
+    0xD9, 0xB1, 0xFC, 0xA7, 0xC1, 0xE9, 0x0D, 0x1D, 0xD8, 0x05, 0x58, 0x7F, 0xA8, 0xD1, 0xEB, 0x58,
+    0xC4, 0x8A, 0xD6, 0x44, 0x2B, 0x15, 0x47, 0x26, 0xE6, 0x7A, 0x9F, 0x42, 0x23, 0x3F, 0xAA, 0x28,
+    0x4D, 0x34, 0x7D, 0xC5, 0x64, 0xC7, 0xDA, 0xE8, 0xBB, 0x01, 0x2E, 0x70, 0xFB, 0xC8, 0xC9, 0x58,
+    0x13, 0x5E, 0x38, 0x37, 0x30, 0xA3, 0x39, 0x9B, 0x96, 0x9C, 0xA6, 0xFC, 0x69, 0x53, 0xA8, 0xAA,
+    0xEA, 0xD3, 0x88, 0x6B, 0xF0, 0xB0, 0x81, 0x4E, 0xFB, 0x6E, 0x66, 0x2F, 0xFC, 0x17, 0xBD, 0x9C,
+    0x4F, 0x8C, 0x1D, 0xC7, 0x9D, 0xDF, 0x3F, 0x5D, 0xA5, 0x99, 0xB6, 0x59, 0x36, 0x8B, 0x07, 0x72,
+    0xFD, 0x87, 0x12, 0x7B, 0x0F, 0x02, 0xA2, 0xC4, 0x9C, 0x69, 0x1D, 0x74, 0x98, 0x0D, 0xDE, 0x7B,
+    0x5D, 0x12, 0x83, 0x28, 0x80, 0x91, 0x78, 0x90, 0xF0, 0xAD, 0x91, 0x15, 0x10, 0xED, 0xC1, 0x08,
+    0x76, 0xBD, 0xB0, 0xE9, 0x03, 0x11, 0xE8, 0xF0, 0x86, 0xAF, 0x57, 0x02, 0xE2, 0xC3, 0x22, 0x6B,
+    0xFA, 0xE0, 0x5C, 0x16, 0x1B, 0x13, 0x59, 0x2D, 0x60, 0x93, 0x48, 0xC8, 0x00, 0xDC, 0x05, 0x8D,
+    0xF4, 0x4C, 0x17, 0x49, 0x6C, 0x74, 0xD0, 0xC1, 0x2D, 0x1B, 0x0B, 0x04, 0x10, 0x10, 0xB7, 0xD7,
+    0xF4, 0x6A, 0x43, 0x01, 0xCB, 0xD2, 0xBA, 0x65, 0x37, 0x87, 0xFD, 0xFA, 0x97, 0x43, 0xBF, 0x19,
+    0x0E, 0xF5, 0xC7, 0x96, 0x2C, 0x29, 0xAF, 0xDF, 0xAB, 0xD7, 0x5D, 0x3D, 0xAF, 0xEB, 0x57, 0xBF,
+    0xAA, 0xFA, 0xFD, 0xFD, 0xD6, 0x70, 0x6E, 0x67, 0x0B, 0x1E, 0x5E, 0x5B, 0x5B, 0x5B, 0x5F, 0x5F,
+    0x5F, 0x4F, 0xB3, 0x2C, 0x9B, 0x6C, 0x00, 0x44, 0x1E, 0xAE, 0xC0, 0x49, 0x30, 0xA0, 0x2A, 0x12,
+    0xA9, 0x92, 0xED, 0xCE, 0x7E, 0x3E, 0x31, 0xCF, 0xBF, 0x70, 0xAA, 0xBA, 0x40, 0x78, 0x8C, 0xD9,
+    0x61, 0x12, 0x9D, 0xEB, 0xAA, 0xA6, 0x7B, 0x82, 0xF4, 0x3F, 0x29, 0x2D, 0xE2, 0x53, 0xC9, 0x79,
+    0x0E, 0x3E, 0x09, 0xDA, 0x41, 0x05, 0x67, 0xE1, 0x63, 0x00, 0x47, 0x60, 0xDE, 0x90, 0x5C, 0xF6,
+    0xBA, 0x1A, 0x33, 0x53, 0x95, 0xCD, 0xA1, 0x01, 0x0B, 0x51, 0x78, 0x48, 0x8B, 0xF8, 0x4F, 0xBD,
+    0x79, 0x9A, 0x75, 0xD0, 0x15, 0x8C, 0x20, 0xF6, 0x70, 0x0D, 0x4A, 0x91, 0x97, 0xEF, 0x48, 0xFB,
+    0x28, 0xC7, 0x00, 0x62, 0x38, 0x39, 0x2E, 0x5F, 0xCF, 0xFB, 0xCB, 0x95, 0xC9, 0x47, 0x04, 0x55,
+    0x59, 0x4E, 0x10, 0x54, 0x65, 0xF2, 0x11, 0xFD, 0x99, 0x6A, 0x2C, 0xAF, 0x7E, 0x1D, 0x4E, 0xB2,
+    0x7C, 0x25, 0x42, 0xF9, 0x83, 0x1E, 0x53, 0x25, 0xB9, 0xAA, 0x75, 0x20, 0x30, 0xE1, 0x1A, 0xC6,
+    0x8F, 0xA0, 0x5D, 0x43, 0x89, 0x6D, 0xF8, 0x83, 0xD7, 0xBF, 0x03, 0x59, 0x4E, 0x2C, 0x92, 0x73,
+    0x69, 0xF7, 0x3C, 0xCC, 0x80, 0x84, 0x81, 0x80, 0xE3, 0xBB, 0x90, 0x48, 0x8D, 0x7A, 0xF5, 0x2B,
+    0x7F, 0xF9, 0xEA, 0x57, 0xFE, 0xE2, 0x3C, 0xC4, 0x5F, 0xF9, 0xCB, 0x57, 0xBF, 0xF2, 0x97, 0xAF,
+    0x3A, 0x20, 0xEE, 0xF9, 0xDE, 0xB6, 0xC9, 0x9F, 0x1B, 0xF3, 0x7C, 0x8B, 0x6D, 0x19, 0x2D, 0x08,
+    0xA5, 0xAA, 0xE6, 0xBA, 0x4A, 0x4D, 0xBD, 0x16, 0x37, 0x1B, 0xBA, 0xAD, 0xA3, 0x7B, 0x39, 0x8B,
+    0xB3, 0xEA, 0x1F, 0x82, 0x7D, 0xFA, 0xCD, 0xD6, 0x88, 0xC3, 0xF1, 0xE8, 0x6A, 0x16, 0xDF, 0xB9,
+    0xDE, 0xB8, 0xA3, 0x44, 0xDF, 0x05, 0x4A, 0xA9, 0x48, 0x9C, 0xAA, 0x09, 0x44, 0xB5, 0xE5, 0xCB,
+    0x51, 0x75, 0xD6, 0xF6, 0xEA, 0xA6, 0x0F, 0x1B, 0xF1, 0xBF, 0x8A, 0xDD, 0xE6, 0xE1, 0x27, 0x4E,
+    0xC2, 0x46, 0x75, 0x05, 0x7E, 0xF6, 0x94, 0x47, 0xFF, 0x71, 0x9C, 0x73, 0xF8, 0xA4, 0xFD, 0x56,
+    0x7E, 0xF6, 0xAC, 0xED, 0xB5, 0x0F, 0x91, 0x5B, 0x23, 0xA0, 0x6A, 0xEE, 0xB2, 0x05, 0x73, 0xC9,
+    0x61, 0x65, 0x13, 0xA2, 0xF3, 0xE6, 0xEF, 0xF5, 0x4D, 0xBF, 0x19, 0x4C, 0x67, 0x9F, 0x8D, 0x5F,
+    0xF0, 0xBB, 0x7D, 0xF2, 0xC7, 0xA0, 0x2E, 0xFE, 0x0F, 0x69, 0x8F, 0x4D, 0xA7, 0x22, 0x6F, 0x4C,
+    0xBF, 0xE8, 0xB1, 0x30, 0x82, 0x00, 0x4C, 0x4F, 0xCB, 0xE2, 0xE2, 0x77, 0x58, 0x01, 0x23, 0x79,
+    0x9C, 0x27, 0xBC, 0xB2, 0xB9, 0xF1, 0xD8, 0xB9, 0xEA, 0xE6, 0xA9, 0x3F, 0x3E, 0xFC, 0xF8, 0x6F,
+    0x55, 0x7F, 0xA6, 0x5B, 0xF3, 0xF8, 0x6F, 0x55, 0x7F, 0xF6, 0xC2, 0xCB, 0xFF, 0xF2, 0xE1, 0xD3,
+    0xBF, 0xE1, 0xAF, 0x70, 0x56, 0xFD, 0x74, 0x9B, 0xE8, 0xBB, 0x64, 0x72, 0x46, 0x3C, 0xB0, 0xA9,
+    0xE4, 0xD4, 0x4F, 0xDF, 0xA8, 0x4F, 0x9C, 0xD5, 0xFF, 0x25, 0xFA, 0x49, 0x15, 0xE6, 0x4D, 0x74,
+    0x1E, 0x1E, 0x85, 0x80, 0x1E, 0x5A, 0x89, 0x44, 0xFE, 0xE1, 0xD2, 0xED, 0x7C, 0xAF, 0x41, 0xED,
+    0x01, 0x88, 0x44, 0x5E, 0x13, 0xF1, 0xD1, 0x97, 0xB4, 0xBC, 0xF0, 0x4A, 0x08, 0xE3, 0xA3, 0x16,
+    0x93, 0xC7, 0x3E, 0xF6, 0xC6, 0x1B, 0xAF, 0xA5, 0xBB, 0xF8, 0xDD, 0xE8, 0xBC, 0x91, 0x53, 0xD7,
+    0x83, 0x1B, 0x31, 0x8E, 0x76, 0x28, 0x6B, 0x46, 0x58, 0xCC, 0x8D, 0xD2, 0x4B, 0x0E, 0x10, 0x55,
+    0x6D, 0x37, 0x5B, 0x0E, 0x76, 0x8A, 0x25, 0x23, 0x61, 0xF2, 0x8E, 0x9F, 0x94, 0x8C, 0x94, 0x8C,
+    0xCC, 0x65, 0x79, 0x99, 0x67, 0xF7, 0x7E, 0xB6, 0x3B, 0x96, 0x1B, 0x8B, 0xD1, 0x51, 0x36, 0xC7,
+    0xC0, 0x18, 0x98, 0x2C, 0x3F, 0x8F, 0x01, 0xAC, 0x4C, 0x29, 0xA5, 0x92, 0x7B, 0x79, 0x79, 0xB7,
+    0xCA, 0xFA, 0xB3, 0x89, 0xFC, 0x69, 0x2C, 0xAF, 0x3D, 0x29, 0x77, 0xAB, 0xAC, 0x3F, 0x6B, 0xE4,
+    0x4F, 0x91, 0xD7, 0x5C, 0xFC, 0xBD, 0x8A, 0xC3, 0x67, 0xD1, 0x7F, 0x0A, 0xAF, 0x39, 0x7E, 0xEB,
+    0xFE, 0x05, 0x6C, 0x38, 0x3E, 0x09, 0x0A, 0x3E, 0x63, 0x5F, 0x0A, 0x57, 0xFF, 0x71, 0x52, 0xB5,
+    0xA3, 0xAD, 0x87, 0xC0, 0x25, 0xBE, 0xF4, 0xFA, 0x81, 0x23, 0x6D, 0xBF, 0xFC, 0x9D, 0xE8, 0x45,
+    0x2D, 0x37, 0xFD, 0x9B, 0x75, 0xF2, 0x9C, 0xFE, 0x3F, 0xFC, 0xCC, 0x5F, 0xDD, 0x29, 0x4C, 0x0B,
+    0x5C, 0xBC, 0x52, 0xB6, 0xEC, 0xBF, 0x2A, 0x8C, 0x27, 0xAA, 0x29, 0x3D, 0xDA, 0xF3, 0x29, 0x8F,
+    0x71, 0x4B, 0xDE, 0x6A, 0xCF, 0x49, 0xD0, 0x9E, 0x0D, 0xD0, 0x9E, 0x2B, 0x51, 0xD0, 0x9E, 0x2A,
+    0x0E, 0xDA, 0x2B, 0x6F, 0xC3, 0xF1, 0x5B, 0xB1, 0x5B, 0x0B, 0x65, 0x67, 0xB9, 0x16, 0xE0, 0x64,
+    0x54, 0x07, 0xD8, 0xD0, 0x3E, 0xC0, 0x95, 0x58, 0x7A, 0xA2, 0x5A, 0x5D, 0xBA, 0x8B, 0xF6, 0x10,
+    0x88, 0x73, 0x08, 0x58, 0x60, 0x93, 0x88, 0x83, 0xAF, 0xC8, 0x63, 0x3C, 0xDA, 0x53, 0x7A, 0x62,
+    0xC7, 0xA7, 0xF6, 0xDA, 0x5D, 0x03, 0xED, 0x19, 0x0D, 0xED, 0x82, 0xF6, 0xD4, 0x69, 0xD0, 0x5E,
+    0xF9, 0xBB, 0x9D, 0xF6, 0xFA, 0xC9, 0x7A, 0x74, 0xFC, 0x96, 0xA5, 0x1A, 0x95, 0xDD, 0x23, 0x70,
+    0x0D, 0x46, 0x44, 0x01, 0xAE, 0x10, 0x7B, 0xA8, 0x49, 0x40, 0x79, 0xAE, 0x41, 0x9C, 0x2B, 0xE9,
+    0xB1, 0x44, 0xB2, 0xE0, 0x04, 0x00, 0x0F, 0x1D, 0x68, 0xFB, 0x08, 0x7C, 0x92, 0x48, 0x3C, 0x71,
+    0xCE, 0x9B, 0x05, 0xDA, 0xF3, 0x9B, 0x16, 0x55, 0x81, 0xC9, 0x09, 0x90, 0xE4, 0x5C, 0x81, 0xB4,
+    0x61, 0x03, 0x48, 0x38, 0xC9, 0x08, 0xED, 0x3F, 0x49, 0x46, 0x14, 0x0C, 0xA9, 0x7F, 0xA6, 0x89,
+    0xDD, 0x7A, 0xC8, 0x82, 0xF6, 0xC9, 0x28, 0x42, 0x79, 0x6B, 0x81, 0xDA, 0x9C, 0xF2, 0x70, 0x45,
+    0x8B, 0xC0, 0x73, 0x5C, 0xDC, 0xC9, 0x19, 0x81, 0x85, 0x13, 0x2C, 0x59, 0xCA, 0x26, 0xB8, 0x65,
+    0xFB, 0xA9, 0xB3, 0x55, 0x14, 0xF6, 0xD8, 0x70, 0x96, 0xF5, 0x48, 0x6E, 0xC8, 0x2B, 0xBD, 0xBB,
+    0xC6, 0x1A, 0x71, 0x4E, 0x43, 0xF2, 0x9F, 0x9F, 0x97, 0x90, 0x34, 0x1C, 0x61, 0x05, 0xA0, 0xFC,
+    0x02, 0xE8, 0x3B, 0x1D, 0x1C, 0x4E, 0xAA, 0x07, 0x78, 0xE8, 0x80, 0x0C, 0x88, 0x16, 0x80, 0x69,
+    0x81, 0x71, 0x00, 0xF5, 0xC3, 0x0A, 0xAC, 0xF5, 0xF0, 0x5C, 0x02, 0xBA, 0x9A, 0x40, 0x42, 0x01,
+    0xDF, 0xFB, 0xED, 0x06, 0x2D, 0x52, 0x93, 0x5E, 0xBC, 0xEC, 0x69, 0x48, 0x5C, 0xEC, 0xC9, 0x98,
+    0x40, 0xA1, 0x7A, 0x4C, 0x9F, 0x2D, 0x90, 0x05, 0x7C, 0x09, 0x48, 0x1A, 0x20, 0x04, 0xD0, 0xCF,
+    0x7B, 0xB0, 0x16, 0x48, 0x02, 0x0C, 0xE4, 0xAC, 0x00, 0x74, 0x40, 0xDC, 0x00, 0x69, 0x0D, 0xFC,
+    0xC2, 0x83, 0xF9, 0x82, 0x83, 0x51, 0x06, 0x51, 0x3D, 0x03, 0xEB, 0x5A, 0x98, 0xA9, 0x80, 0xFA,
+    0xE9, 0x33, 0x15, 0x56, 0x24, 0x67, 0xE7, 0x62, 0x89, 0xAE, 0xD8, 0x22, 0x81, 0x8E, 0x16, 0x15,
+    0x4C, 0x4B, 0xDA, 0x4A, 0xA3, 0xA5, 0x81, 0x63, 0xD3, 0xE9, 0x26, 0x64, 0x22, 0x2D, 0xC4, 0xFD,
+    0xC5, 0x16, 0xEC, 0x8C, 0x0D, 0x38, 0x31, 0x63, 0x03, 0x46, 0x33, 0x80, 0xAB, 0x33, 0x80, 0x30,
+    0x03, 0x54, 0x75, 0xEE, 0xB2, 0x27, 0xF6, 0x73, 0xF1, 0xD8, 0xE9, 0x36, 0x90, 0x48, 0x07, 0x8C,
+    0xA7, 0x05, 0x70, 0x8D, 0x19, 0x9F, 0x20, 0x30, 0x63, 0x4D, 0xD7, 0xCC, 0x18, 0x99, 0x5B, 0x91,
+    0x48, 0x97, 0x2D, 0x8C, 0x48, 0x17, 0x7D, 0xF9, 0x45, 0xB4, 0xC8, 0x82, 0xF8, 0x8D, 0x67, 0x3A,
+    0x52, 0x4C, 0x50, 0x81, 0x34, 0x4F, 0xA1, 0x53, 0x01, 0x53, 0xA5, 0xB0, 0xF5, 0xA9, 0x37, 0x37,
+    0xE3, 0xD7, 0x44, 0x18, 0xAB, 0x40, 0x5C, 0xA5, 0x43, 0x57, 0xAC, 0x4F, 0xA1, 0x51, 0x81, 0x8C,
+    0x94, 0xC4, 0x1B, 0x91, 0x5A, 0x8B, 0xD4, 0xCB, 0xD1, 0x58, 0x89, 0x40, 0x77, 0x1B, 0x30, 0x91,
+    0x1C, 0xFD, 0x74, 0x38, 0x30, 0xE9, 0x56, 0xBF, 0x0B, 0x46, 0x7A, 0xF4, 0xDD, 0xE3, 0x1D, 0x0B,
+    0x4C, 0x48, 0x1D, 0xD9, 0xA9, 0x40, 0xD4, 0x6D, 0x81, 0x7D, 0xD9, 0x43, 0x57, 0x80, 0xF9, 0xBE,
+    0x87, 0xA2, 0x03, 0xF3, 0x72, 0x05, 0xDD, 0x39, 0xB0, 0x2F, 0x04, 0x54, 0x93, 0xE5, 0x64, 0xF4,
+    0x24, 0x3E, 0xEE, 0x2F, 0x07, 0x8C, 0xB4, 0x83, 0x38, 0x06, 0xC3, 0xC3, 0xB3, 0xF8, 0xFA, 0x1B,
+    0x21, 0xEE, 0x48, 0x89, 0xBB, 0xE8, 0x8D, 0x30, 0x8B, 0x5F, 0x66, 0x0D, 0x20, 0xBA, 0xE8, 0x8E,
+    0x50, 0xCA, 0x8F, 0x6B, 0x7B, 0xEB, 0x4C, 0xCF, 0x02, 0x1B, 0x4C, 0x45, 0x5A, 0x65, 0x28, 0xB9,
+    0xDE, 0xB0, 0x9E, 0x19, 0xAF, 0xEA, 0x2E, 0x65, 0x5D, 0x35, 0x9D, 0xAA, 0xCD, 0xCD, 0xB0, 0x4E,
+    0x6A, 0x7E, 0x50, 0xD3, 0xA5, 0xFF, 0x1D, 0x5D, 0x67, 0x35, 0xA9, 0x13, 0xE8, 0x54, 0x4F, 0xE2,
+    0xD7, 0xE5, 0x52, 0x47, 0x5D, 0x4A, 0x0E, 0xC7, 0xDC, 0xDE, 0xF8, 0x1B, 0x0F, 0x49, 0x0D, 0x69,
+    0xB5, 0x9C, 0x0F, 0x10, 0x4D, 0xDD, 0xB1, 0xDF, 0x96, 0x36, 0xE9, 0x93, 0x9A, 0x6D, 0x3A, 0xC6,
+    0xA4, 0x2E, 0x41, 0x07, 0xEB, 0xD8, 0x32, 0x39, 0xF6, 0xA6, 0x87, 0x9F, 0xD7, 0x90, 0x06, 0xD0,
+    0x0D, 0x50, 0x00, 0xE9, 0xF2, 0x59, 0x2A, 0x0C, 0x15, 0x51, 0x79, 0x8B, 0x48, 0x7A, 0xA6, 0xA7,
+    0xB1, 0xE2, 0x49, 0x3C, 0x14, 0x60, 0xE4, 0x16, 0x3B, 0x97, 0x83, 0xF1, 0x89, 0x2F, 0x28, 0x8C,
+    0x8F, 0xAB, 0x82, 0xB1, 0xF1, 0xB1, 0x2F, 0x68, 0x8D, 0x9F, 0x53, 0x4A, 0x6E, 0xFE, 0xAF, 0xA3,
+    0x80, 0xE4, 0x16, 0x56, 0x3C, 0x70, 0x1A, 0x12, 0x71, 0x9C, 0x7B, 0xB6, 0xA2, 0xD1, 0xB5, 0x0A,
+    0x2A, 0xE8, 0x5A, 0xD5, 0xBA, 0x8A, 0xBD, 0xAE, 0x12, 0x74, 0x35, 0x42, 0x57, 0x57, 0xD1, 0x55,
+    0x81, 0xAE, 0xE6, 0xE8, 0x2A, 0xAD, 0x74, 0x65, 0x1A, 0x5D, 0x45, 0x9D, 0xAE, 0x98, 0xE9, 0x57,
+    0x18, 0xE9, 0x1F, 0xE6, 0x33, 0xF3, 0xC3, 0x9F, 0x36, 0xD9, 0x0F, 0xA4, 0x82, 0xA3, 0x00, 0xBA,
+    0x79, 0x3C, 0x92, 0x6D, 0xBE, 0x26, 0x3C, 0xB4, 0xBA, 0xB7, 0x08, 0x8F, 0xF7, 0xA4, 0x97, 0x6A,
+    0xEB, 0x3A, 0xED, 0x13, 0x88, 0x3D, 0x2A, 0x44, 0x65, 0xA7, 0xFA, 0xCB, 0x2A, 0xC4, 0xBE, 0x88,
+    0x42, 0x4A, 0x17, 0xEF, 0x4A, 0x5B, 0xFE, 0x4D, 0x17, 0x39, 0xE0, 0x4B, 0x20, 0x9E, 0xB3, 0x57,
+    0x39, 0xF9, 0x08, 0xE6, 0x69, 0x87, 0x78, 0x0E, 0x39, 0x80, 0x55, 0xC9, 0xCD, 0xED, 0x56, 0x57,
+    0x19, 0x21, 0xF6, 0x44, 0x01, 0x0A, 0xCE, 0x08, 0xE5, 0xA5, 0xE1, 0x21, 0x33, 0xE3, 0xB3, 0xA8,
+    0x2F, 0xFB, 0xB4, 0x2D, 0xD9, 0xDC, 0x6B, 0x7A, 0x61, 0x16, 0x6A, 0x77, 0x7B, 0x77, 0x61, 0x9D,
+    0xB8, 0x6E, 0x14, 0xB5, 0x51, 0x20, 0xAE, 0xE2, 0x8A, 0x33, 0x22, 0x91, 0xC8, 0xED, 0xD3, 0xE9,
+    0x37, 0x03, 0x2A, 0xC4, 0x1E, 0xEB, 0x6D, 0x4E, 0x4A, 0x99, 0x3F, 0x34, 0xBF, 0x5C, 0x4A, 0x28,
+    0x9B, 0x54, 0xDC, 0x51, 0x56, 0x06, 0x81, 0xF4, 0xBB, 0x0F, 0x93, 0x7E, 0x95, 0x68, 0x01, 0x65,
+    0x4E, 0xD3, 0x70, 0xC4, 0x42, 0x14, 0x22, 0xD9, 0xD2, 0x22, 0x37, 0x9A, 0x38, 0x34, 0x6C, 0x17,
+    0xD8, 0x1D, 0xF4, 0x9D, 0x9C, 0xFF, 0x59, 0xB3, 0xDE, 0x61, 0xCF, 0x38, 0x7D, 0x33, 0xE8, 0xBA,
+    0xFC, 0x93, 0x10, 0x4B, 0xBD, 0x9C, 0x16, 0x2C, 0x3E, 0xC1, 0xFC, 0x8E, 0x7B, 0x38, 0xF3, 0x51,
+    0x94, 0x2F, 0x29, 0x8C, 0x25, 0xB7, 0xF7, 0x16, 0xC6, 0x27, 0x2F, 0x79, 0xF5, 0xF3, 0xC0, 0xA4,
+    0xC5, 0xF6, 0x68, 0xC9, 0xB9, 0x17, 0x98, 0x6C, 0x63, 0xAD, 0xB7, 0xCF, 0xF7, 0x67, 0x7C, 0x22,
+    0x39, 0xD3, 0x61, 0x12, 0x05, 0x4C, 0x35, 0x88, 0xEC, 0xE9, 0xF4, 0x8B, 0x22, 0x7F, 0x35, 0x9D,
+    0x02, 0xD4, 0x98, 0x8A, 0x64, 0x5F, 0xEE, 0xC9, 0x8F, 0x7D, 0x76, 0xB9, 0x57, 0x21, 0x0E, 0x09,
+    0x69, 0x55, 0xA8, 0x3B, 0x2F, 0xD4, 0xEB, 0x99, 0x7D, 0xBE, 0x2E, 0x26, 0xEB, 0xAA, 0xEE, 0x6B,
+    0xFB, 0x7C, 0xCF, 0x48, 0x07, 0x55, 0xA7, 0x77, 0x4B, 0x5E, 0x93, 0x9A, 0xE8, 0xF4, 0xF2, 0x97,
+    0xAA, 0x82, 0xC4, 0x41, 0x07, 0x26, 0x87, 0x8D, 0x7D, 0x51, 0x3A, 0x6F, 0xD3, 0x56, 0xCE, 0x9F,
+    0xA9, 0x5A, 0xC6, 0x2A, 0x44, 0x41, 0x57, 0xD6, 0x19, 0x3F, 0x22, 0x51, 0x35, 0x13, 0x0B, 0xB3,
+    0xE7, 0xE0, 0x17, 0x1E, 0xD5, 0x0F, 0x53, 0xD7, 0x78, 0x18, 0x0F, 0x93, 0x36, 0x75, 0x3C, 0xD3,
+    0xA2, 0xC4, 0x13, 0xDF, 0x02, 0x70, 0x50, 0x3A, 0x56, 0x17, 0x40, 0x33, 0x98, 0x9D, 0xD6, 0x0D,
+    0xC6, 0xC0, 0x9B, 0xE2, 0xF5, 0x1D, 0xF1, 0xB6, 0x4E, 0xFD, 0x98, 0x8C, 0x86, 0x2D, 0x5D, 0xD1,
+    0x58, 0xA7, 0xAB, 0x31, 0xD6, 0x35, 0xCC, 0x74, 0xA5, 0x82, 0x75, 0xA9, 0xCB, 0x5E, 0x6F, 0x90,
+    0xFE, 0x81, 0xDF, 0x36, 0x90, 0xF6, 0x44, 0x17, 0x5F, 0x04, 0xCE, 0x1F, 0xC5, 0xDE, 0x68, 0xC8,
+    0x4C, 0xC5, 0x91, 0x15, 0xF6, 0x19, 0xFD, 0xBC, 0x7C, 0xE3, 0xEE, 0xEA, 0xC2, 0xE6, 0xBA, 0x4A,
+    0x49, 0x18, 0xD3, 0x50, 0x68, 0x1F, 0x85, 0x75, 0x74, 0x1D, 0x88, 0x5F, 0xCA, 0xB1, 0xB3, 0x41,
+    0x58, 0x67, 0x0E, 0x8A, 0x81, 0xB4, 0x14, 0x54, 0xC3, 0x4A, 0x99, 0x93, 0x76, 0x70, 0xCE, 0x0D,
+    0x56, 0x0A, 0x88, 0x80, 0x96, 0xF6, 0x01, 0x85, 0xBD, 0x09, 0x58, 0x0F, 0xCC, 0x1D, 0xA8, 0x1E,
+    0xB0, 0x33, 0xE0, 0x6A, 0x03, 0xFA, 0x66, 0x80, 0x13, 0xB1, 0x87, 0xC6, 0xE6, 0xC4, 0x3E, 0x85,
+    0xF5, 0xE9, 0x36, 0x88, 0xB4, 0x98, 0xDB, 0x97, 0x02, 0x63, 0xE2, 0x2A, 0x0A, 0xF7, 0x67, 0xA1,
+    0x92, 0x6F, 0x88, 0xCB, 0xC4, 0x59, 0xA9, 0x8C, 0x84, 0x03, 0x0A, 0xAD, 0xAC, 0xD5, 0xEE, 0x0E,
+    0x8D, 0xF5, 0xA3, 0x28, 0xC0, 0x0C, 0x52, 0x8E, 0x8B, 0x4F, 0x6F, 0x0F, 0x0B, 0x20, 0x51, 0xC1,
+    0xFA, 0xF9, 0x65, 0xF9, 0xA3, 0x3E, 0xF5, 0x47, 0xF7, 0x7E, 0x13, 0x62, 0xD0, 0x77, 0xAF, 0x81,
+    0x96, 0x1C, 0xA2, 0xCD, 0x8F, 0x56, 0x39, 0x12, 0xF3, 0x78, 0xD4, 0x9C, 0x24, 0xEB, 0x89, 0xBE,
+    0xF7, 0x6B, 0x8A, 0x00, 0x8E, 0x02, 0x3A, 0x00, 0x49, 0x05, 0x94, 0x39, 0xE8, 0x1F, 0x01, 0x6B,
+    0x63, 0x20, 0x74, 0x10, 0xFF, 0x61, 0x80, 0xB1, 0xAE, 0x89, 0x82, 0xF1, 0x98, 0x6F, 0x9D, 0x71,
+    0x64, 0xD2, 0xA3, 0x76, 0x2F, 0x76, 0x58, 0x17, 0x35, 0xCC, 0xD0, 0x41, 0xD7, 0x18, 0x9F, 0xD6,
+    0x94, 0x3F, 0x91, 0xCA, 0x4A, 0x05, 0xAA, 0x06, 0xD6, 0x19, 0x66, 0x0B, 0x7A, 0x17, 0x88, 0xBB,
+    0x5F, 0x87, 0xB3, 0x71, 0x8E, 0x1E, 0x24, 0xD0, 0xB9, 0x4D, 0x4C, 0xC3, 0x52, 0xE6, 0xEB, 0x40,
+    0xD4, 0x43, 0xE9, 0xF8, 0xF8, 0x52, 0xE1, 0xFD, 0x39, 0xB1, 0x74, 0xFA, 0xEE, 0xB3, 0xBE, 0x63,
+    0x94, 0xA0, 0x6F, 0xD6, 0x9C, 0xDC, 0x1A, 0x16, 0x47, 0x31, 0xCC, 0x95, 0x6E, 0xB8, 0xDA, 0x86,
+    0x38, 0x40, 0x96, 0x13, 0x89, 0x5B, 0x8D, 0x45, 0x6A, 0x23, 0xED, 0xDE, 0x50, 0x59, 0xD8, 0x46,
+    0xD7, 0x4C, 0xA0, 0xDA, 0x5B, 0xDE, 0x55, 0x7A, 0xF9, 0x07, 0xC1, 0x7E, 0x83, 0xB5, 0x02, 0x5D,
+    0x63, 0x73, 0x26, 0xD0, 0xA1, 0x1A, 0xE2, 0x06, 0x23, 0x12, 0x4B, 0xE0, 0x34, 0x44, 0xE7, 0x61,
+    0xEE, 0xB0, 0xDB, 0xE8, 0x57, 0x02, 0x57, 0xB5, 0xFB, 0x90, 0x88, 0x1A, 0xA3, 0x3A, 0x92, 0x82,
+    0x70, 0xCD, 0xB8, 0xE5, 0xE4, 0x9C, 0x37, 0xE6, 0xF5, 0xA6, 0xD0, 0x3F, 0xF1, 0xE6, 0x0C, 0xB4,
+    0x4B, 0xA2, 0x32, 0xD8, 0x26, 0x5A, 0xA0, 0x44, 0xAE, 0x4B, 0xC7, 0xB1, 0x61, 0xF5, 0x67, 0xC3,
+    0x73, 0x27, 0xFB, 0x93, 0xFA, 0x43, 0xA0, 0x68, 0x84, 0x6A, 0x31, 0xD5, 0x9E, 0xA6, 0x25, 0x59,
+    0xA8, 0xDD, 0x45, 0x4A, 0x1B, 0xD4, 0xAB, 0x9E, 0xC9, 0x1E, 0x45, 0x9E, 0xD4, 0x31, 0x77, 0x94,
+    0x12, 0xE6, 0xC2, 0x8A, 0xE3, 0x7C, 0xEC, 0xEC, 0x93, 0x81, 0x73, 0x33, 0x22, 0x19, 0x16, 0xFC,
+    0x87, 0x35, 0x6A, 0x1B, 0xDA, 0x5F, 0x1B, 0xF1, 0xF3, 0x8A, 0x9E, 0xA5, 0x21, 0xFB, 0x5E, 0x47,
+    0x4D, 0xB9, 0x13, 0xD0, 0x26, 0x0E, 0xFB, 0x6D, 0x07, 0xE2, 0x06, 0x19, 0x07, 0xF0, 0x3B, 0xDF,
+    0x1D, 0xAC, 0xB2, 0xE4, 0xAF, 0xCE, 0x04, 0x15, 0x28, 0x29, 0x30, 0x75, 0x0A, 0x9D, 0xF1, 0xA4,
+    0x4F, 0x05, 0xE2, 0xAA, 0x20, 0x6A, 0x53, 0x18, 0x1B, 0x4F, 0xF2, 0x54, 0x20, 0xF6, 0x05, 0x3A,
+    0xA4, 0xD0, 0x18, 0x4F, 0xA7, 0x42, 0xD4, 0x29, 0x91, 0xF6, 0x80, 0x45, 0x06, 0x40, 0x79, 0xC3,
+    0x93, 0x86, 0x06, 0x8A, 0x11, 0xA4, 0x87, 0xC1, 0xDC, 0x74, 0xA8, 0x90, 0xC7, 0xD2, 0x61, 0xEF,
+    0x09, 0xC6, 0x5B, 0xAF, 0x2B, 0x15, 0x54, 0xA0, 0xA0, 0x25, 0x65, 0x82, 0xF1, 0x36, 0x57, 0x41,
+    0x07, 0x0A, 0x0A, 0x52, 0x12, 0x9F, 0x78, 0xD5, 0x97, 0xBB, 0xA4, 0x8B, 0xAC, 0x62, 0xF3, 0x21,
+    0xF8, 0x88, 0x2C, 0x48, 0x00, 0xD3, 0xC1, 0xE7, 0x02, 0x18, 0xCF, 0xA1, 0xF2, 0x02, 0xA9, 0xE4,
+    0xA8, 0xC0, 0x67, 0x2F, 0xFB, 0x58, 0x84, 0x73, 0xFF, 0xBC, 0xD3, 0xB5, 0x0A, 0x29, 0xC6, 0xB7,
+    0xA4, 0xBA, 0xA6, 0xB0, 0xB9, 0x0A, 0x19, 0xC6, 0x17, 0xA4, 0x51, 0x17, 0x75, 0xBA, 0x2F, 0x77,
+    0x95, 0xFC, 0x70, 0xC1, 0xE6, 0x43, 0x30, 0xDD, 0x24, 0x13, 0xAF, 0xA5, 0xD9, 0x9B, 0x88, 0xD3,
+    0xE9, 0x69, 0x11, 0xB9, 0xDE, 0x5F, 0x2C, 0x8C, 0x57, 0xBE, 0xE0, 0xE1, 0xE5, 0xA0, 0x1B, 0x0F,
+    0x3B, 0x97, 0x6B, 0x23, 0xFD, 0xDE, 0xD5, 0xF0, 0x75, 0xA1, 0xC0, 0x1A, 0x1F, 0xFD, 0x8D, 0x48,
+    0x2F, 0x22, 0x95, 0x91, 0x3A, 0x93, 0x7C, 0x9F, 0xD0, 0x9E, 0xBE, 0xB4, 0xF9, 0x64, 0xC6, 0x4E,
+    0x1D, 0x89, 0x88, 0x48, 0xDF, 0xA0, 0x6B, 0x8C, 0x27, 0xF1, 0xA4, 0xD2, 0xA6, 0x92, 0x2F, 0x97,
+    0xF8, 0x28, 0xF2, 0xFA, 0xEE, 0x35, 0x6C, 0xCF, 0x10, 0x70, 0x61, 0x3A, 0x9D, 0x7E, 0x41, 0xA4,
+    0x4B, 0x6E, 0x5F, 0xF2, 0x05, 0x27, 0x8D, 0x8F, 0xFC, 0x81, 0x76, 0x6F, 0xF7, 0x94, 0x52, 0x1F,
+    0x20, 0xAD, 0xE0, 0x90, 0xF1, 0x84, 0x82, 0x13, 0xA9, 0xC8, 0x1D, 0x91, 0x05, 0xB0, 0x11, 0xE5,
+    0xED, 0x89, 0x48, 0x02, 0x7B, 0x42, 0xB8, 0xAC, 0xED, 0xEB, 0xA1, 0xD5, 0xAF, 0x79, 0xF3, 0xF7,
+    0x24, 0x22, 0x22, 0x72, 0xC7, 0x31, 0x81, 0x82, 0xA8, 0x43, 0x89, 0x3C, 0x2F, 0xED, 0xB2, 0x71,
+    0xD5, 0x0C, 0x93, 0x7A, 0x8F, 0x2D, 0x1F, 0x98, 0x9A, 0xB7, 0xAE, 0xCE, 0xB4, 0xD5, 0xBB, 0xDD,
+    0x84, 0xBB, 0x41, 0xDD, 0xCB, 0x63, 0x11, 0x11, 0xB9, 0x57, 0x61, 0x73, 0x52, 0x98, 0x43, 0x29,
+    0x75, 0xD9, 0xB3, 0xE2, 0x3E, 0x30, 0x0F, 0xC6, 0xCB, 0x30, 0x17, 0x24, 0x7F, 0x37, 0x68, 0x91,
+    0xF7, 0x38, 0x2C, 0x3E, 0xBA, 0x86, 0xF6, 0x24, 0x70, 0x6E, 0x93, 0xD2, 0xC1, 0x2A, 0x27, 0x99,
+    0xD9, 0x5C, 0xFD, 0xA2, 0xC6, 0x74, 0x2C, 0xED, 0xAC, 0x0F, 0x61, 0x8C, 0x62, 0xDF, 0x8C, 0xF8,
+    0x45, 0x15, 0xDD, 0x17, 0x12, 0x4A, 0xF2, 0xEC, 0xF2, 0xCD, 0xDA, 0x7E, 0x9B, 0xF4, 0x1A, 0x73,
+    0x11, 0x11, 0xD9, 0x86, 0x16, 0x15, 0x88, 0x03, 0x46, 0x7A, 0x23, 0x35, 0xA7, 0x81, 0x0B, 0xA0,
+    0x3A, 0x30, 0x02, 0x89, 0xF1, 0x8C, 0xD4, 0x32, 0xBA, 0xF3, 0x5D, 0xC7, 0x5C, 0x5A, 0xD5, 0xFF,
+    0x76, 0x6B, 0x2A, 0xAE, 0x25, 0x8E, 0xE7, 0x26, 0xF0, 0xF8, 0xD6, 0xD2, 0x9B, 0x28, 0x96, 0x8E,
+    0x69, 0x47, 0x26, 0x05, 0x9F, 0x5D, 0x6C, 0xC3, 0x6C, 0x0E, 0xB3, 0x2C, 0x67, 0x96, 0xD4, 0xCC,
+    0x62, 0x91, 0x8E, 0x52, 0x1A, 0xA2, 0xD3, 0x83, 0xDC, 0x11, 0x88, 0xEF, 0xC0, 0x68, 0x82, 0xAA,
+    0x46, 0xFB, 0x6B, 0x30, 0x93, 0x4E, 0xEF, 0xF6, 0x61, 0x42, 0x4B, 0x13, 0x05, 0x5D, 0xC5, 0xDE,
+    0xBA, 0x94, 0xF4, 0xC9, 0x96, 0x4C, 0x72, 0xF5, 0xB7, 0xE7, 0xB1, 0xCB, 0xF8, 0x8E, 0x48, 0xA3,
+    0x44, 0x9A, 0x84, 0xB8, 0x0E, 0x98, 0xAF, 0x7B, 0x46, 0xB6, 0x32, 0x75, 0x22, 0x0B, 0x4C, 0xBF,
+    0x94, 0x6A, 0xA3, 0xC8, 0x93, 0xFD, 0x49, 0x8E, 0xED, 0xEF, 0x1B, 0x27, 0x1F, 0x66, 0x2F, 0x80,
+    0x43, 0x3C, 0xCE, 0x24, 0xF6, 0xCC, 0x3B, 0x58, 0xCF, 0x3F, 0xFC, 0x5E, 0xB8, 0x61, 0xCD, 0xE8,
+    0x96, 0xFD, 0x71, 0xFC, 0xD0, 0xC7, 0x02, 0xD8, 0x19, 0x9A, 0x89, 0xDC, 0x7E, 0x0B, 0x56, 0x84,
+    0xBE, 0x2C, 0x6C, 0x3E, 0x61, 0xCC, 0x6C, 0xE8, 0x85, 0xF1, 0xA6, 0x3A, 0x87, 0x95, 0x9A, 0xEF,
+    0xBD, 0x88, 0xF6, 0xC3, 0x30, 0x66, 0xB2, 0xA0, 0x94, 0x45, 0xEC, 0xA3, 0x76, 0x84, 0xFA, 0x71,
+    0xC0, 0xEA, 0x46, 0xB5, 0xB1, 0x88, 0x53, 0x72, 0xFE, 0x43, 0xE6, 0xF7, 0x97, 0x96, 0x7F, 0x3D,
+    0x84, 0x19, 0x86, 0x50, 0xE7, 0x92, 0xE4, 0xC3, 0xC3, 0xA5, 0xC9, 0x07, 0xBE, 0xB6, 0x0F, 0x74,
+    0x48, 0x8B, 0xF8, 0xEC, 0xF2, 0x1D, 0x5D, 0xDB, 0xDC, 0xBA, 0x64, 0xE8, 0x90, 0x0A, 0xAA, 0x49,
+    0x72, 0x2D, 0x2D, 0xEB, 0xBF, 0x0F, 0x61, 0xE9, 0x2F, 0x88, 0xB8, 0x54, 0xE4, 0xC9, 0xC0, 0x39,
+    0x0B, 0xD7, 0x66, 0x68, 0xBF, 0x60, 0x27, 0x12, 0xA9, 0x28, 0x6F, 0x2D, 0x09, 0xD0, 0x2D, 0x30,
+    0x69, 0x41, 0xD7, 0x0D, 0x3C, 0xB2, 0xB4, 0x9C, 0x56, 0xA6, 0x6E, 0x65, 0x3A, 0x17, 0xE6, 0x7D,
+    0x52, 0xF1, 0x6C, 0x9E, 0xC2, 0x84, 0x02, 0x5A, 0x15, 0xD0, 0xB5, 0xF1, 0xD8, 0xA1, 0xAA, 0x14,
+    0x69, 0x95, 0x88, 0x1C, 0xA8, 0x7A, 0xFB, 0x5F, 0x29, 0xC9, 0x57, 0xFB, 0xB9, 0x30, 0xEF, 0xD9,
+    0x04, 0xD2, 0x1C, 0xE2, 0x1E, 0x08, 0x0D, 0x8C, 0x74, 0x7E, 0x3F, 0x92, 0x86, 0xB8, 0x65, 0xBC,
+    0xC8, 0xBA, 0xA5, 0xED, 0x79, 0xFF, 0x24, 0x59, 0xC0, 0x3D, 0x09, 0xD8, 0x3A, 0xCD, 0x69, 0xE8,
+    0xB0, 0xCE, 0x78, 0x1A, 0x8A, 0x77, 0x39, 0x59, 0xED, 0xA3, 0xFE, 0x49, 0x09, 0xF3, 0xEE, 0xD8,
+    0x94, 0x63, 0x53, 0x2B, 0x3E, 0x91, 0x7C, 0xEE, 0xA2, 0x73, 0x18, 0x8F, 0xCD, 0x3F, 0xB7, 0x7B,
+    0xF1, 0xD2, 0x6E, 0x22, 0x22, 0xE2, 0x53, 0x98, 0x0C, 0x95, 0x4A, 0x44, 0x6A, 0x4A, 0x91, 0x96,
+    0x03, 0x95, 0x01, 0x5D, 0x53, 0xC0, 0xC1, 0x4A, 0xD3, 0x73, 0xFC, 0xEE, 0xF0, 0x4C, 0x1C, 0xD8,
+    0x86, 0xC1, 0x4F, 0xB3, 0x0E, 0xFE, 0x60, 0xD7, 0x91, 0x48, 0x35, 0x0C, 0x9C, 0x5D, 0x7D, 0x11,
+    0xFD, 0x23, 0xF1, 0xC8, 0x9F, 0x34, 0x64, 0x4C, 0xB0, 0xCE, 0x78, 0x5D, 0xA9, 0x40, 0x43, 0xC1,
+    0x98, 0xF4, 0x81, 0x8A, 0xA8, 0xCC, 0xE7, 0xDF, 0x94, 0x30, 0xEF, 0x56, 0x22, 0x1B, 0x5E, 0xBB,
+    0xD3, 0xBE, 0xD2, 0xF1, 0x10, 0x44, 0xD3, 0x4D, 0x59, 0xC4, 0x0D, 0x05, 0x29, 0xC6, 0xAB, 0xF0,
+    0x8E, 0x27, 0x65, 0x2D, 0x0B, 0x48, 0x6E, 0x7C, 0xA3, 0xFF, 0xD9, 0x4B, 0xED, 0x91, 0x47, 0x01,
+    0x38, 0x93, 0xCF, 0x6B, 0x5A, 0x26, 0xD8, 0x5C, 0x3F, 0x70, 0x52, 0x7E, 0x53, 0xDA, 0x95, 0xA9,
+    0x95, 0x9F, 0x0C, 0x0A, 0x7D, 0x65, 0x7A, 0x4A, 0x9A, 0xA4, 0x7A, 0x97, 0x27, 0x0F, 0x27, 0x4A,
+    0x5E, 0x90, 0xA6, 0x94, 0x4C, 0xFC, 0x32, 0x0E, 0xD5, 0xC6, 0xFD, 0xDB, 0x9E, 0x3B, 0xC1, 0xE6,
+    0xE6, 0x6E, 0x22, 0xF9, 0x11, 0x4E, 0xF0, 0x67, 0x6F, 0x36, 0xF3, 0x36, 0xDA, 0x7C, 0x5F, 0xF4,
+    0x5F, 0xD1, 0x8B, 0x64, 0xDE, 0x99, 0x0B, 0x00, 0xC7, 0xEB, 0x79, 0xAD, 0xDF, 0x76, 0x98, 0xBB,
+    0xF3, 0x7E, 0x7A, 0x5A, 0x16, 0x49, 0x65, 0xFC, 0xBB, 0x1D, 0x69, 0x2B, 0x8B, 0x38, 0x3F, 0xC1,
+    0x84, 0xF4, 0x45, 0xDB, 0x00, 0xC4, 0xB5, 0x09, 0xF1, 0xD2, 0x36, 0x7A, 0xF7, 0xE7, 0xD2, 0x68,
+    0x1F, 0x7B, 0xFD, 0xD3, 0xA8, 0x87, 0x08, 0x5B, 0xD9, 0xCA, 0x78, 0x96, 0xE9, 0x87, 0x5F, 0xD5,
+    0xDE, 0x2F, 0xA7, 0xF7, 0xD8, 0x34, 0x93, 0x2F, 0xC8, 0x2B, 0x8B, 0x68, 0xEE, 0x52, 0x8C, 0x37,
+    0x7E, 0x69, 0x24, 0x16, 0xA4, 0xBC, 0xB7, 0x8A, 0xB4, 0xD5, 0x21, 0x13, 0xD7, 0x2E, 0x05, 0x6D,
+    0x0A, 0x24, 0x39, 0x9C, 0xF1, 0xC3, 0x82, 0x5A, 0xBE, 0xCE, 0x51, 0x98, 0x60, 0xAB, 0x73, 0x74,
+    0x07, 0x84, 0xEB, 0x8E, 0xEA, 0xE6, 0x75, 0xE9, 0x27, 0xCC, 0x74, 0x1D, 0xBF, 0xEB, 0x97, 0xB9,
+    0x1B, 0xBF, 0x24, 0xF5, 0x6C, 0xC8, 0x2B, 0x15, 0x60, 0x73, 0xE2, 0x80, 0xEA, 0x60, 0x1D, 0x1E,
+    0xC3, 0xD6, 0x4A, 0xFC, 0xB5, 0xC9, 0x61, 0x2E, 0xC0, 0xCA, 0xD4, 0xC9, 0x22, 0x5A, 0x60, 0x3C,
+    0xC5, 0xAF, 0x28, 0xAC, 0xA7, 0x25, 0x21, 0xAE, 0x55, 0xC7, 0x0E, 0x00, 0x33, 0x6C, 0x50, 0x77,
+    0xF2, 0xD9, 0xC8, 0x46, 0xC3, 0x80, 0xA4, 0xDE, 0x74, 0x18, 0xCF, 0x8C, 0xF8, 0xDD, 0x0A, 0xE3,
+    0x69, 0x99, 0x93, 0x7A, 0x55, 0x33, 0x3D, 0xBD, 0x32, 0xB5, 0xE2, 0xA5, 0x49, 0x2A, 0xD5, 0x52,
+    0xB0, 0x85, 0xF1, 0xA9, 0xA3, 0x30, 0x15, 0xE6, 0x46, 0x58, 0x46, 0x3D, 0x05, 0x28, 0x03, 0x98,
+    0x1F, 0x79, 0x28, 0xE6, 0x60, 0x6E, 0x74, 0x50, 0x98, 0x80, 0xF1, 0xA9, 0xA7, 0xA0, 0x74, 0x69,
+    0xAB, 0x7A, 0x2B, 0x3E, 0xEE, 0x06, 0x97, 0xF4, 0x10, 0x0C, 0x76, 0x9C, 0x75, 0x4B, 0x49, 0xBC,
+    0xBE, 0xE7, 0xF9, 0x2F, 0x95, 0x7B, 0x37, 0xD4, 0x6B, 0x3F, 0xE8, 0x98, 0x11, 0x10, 0xB2, 0x85,
+    0xF6, 0x65, 0x6D, 0x69, 0x19, 0x25, 0x39, 0x6F, 0x34, 0xE8, 0x3B, 0x60, 0xCF, 0xC1, 0x68, 0x0B,
+    0xC2, 0x36, 0xDA, 0x2F, 0xB0, 0xF4, 0xD1, 0x8E, 0xEB, 0x13, 0x41, 0x80, 0x4D, 0x56, 0x97, 0xC1,
+    0x84, 0xD9, 0xE0, 0x67, 0xDB, 0xA5, 0xEC, 0x03, 0x8E, 0x57, 0x65, 0x3B, 0xAF, 0xCE, 0x34, 0xBA,
+    0x4A, 0x87, 0x70, 0xE2, 0x0F, 0x02, 0xFA, 0x8E, 0x47, 0x4B, 0x8E, 0x7E, 0xB5, 0x46, 0xFF, 0xB0,
+    0x41, 0x57, 0x3D, 0xBA, 0xCA, 0x72, 0xD3, 0xD8, 0x90, 0x75, 0xAA, 0x03, 0x8E, 0xF0, 0x31, 0x30,
+    0x1E, 0xDD, 0x11, 0xF5, 0xF0, 0xE9, 0xA5, 0x29, 0x7A, 0x1A, 0x2B, 0x15, 0x49, 0xC5, 0x83, 0x96,
+    0xF8, 0xBB, 0x7D, 0x1D, 0x1E, 0x8C, 0xAE, 0xF5, 0x54, 0xE4, 0x47, 0x22, 0x1D, 0x70, 0x52, 0x75,
+    0x69, 0xF3, 0x4F, 0x1D, 0xE0, 0xD2, 0xEA, 0x4C, 0xA5, 0x7F, 0xE9, 0x71, 0xFC, 0x6E, 0xD9, 0x7F,
+    0xF0, 0x26, 0x89, 0xCE, 0x43, 0xB6, 0x34, 0x45, 0x07, 0x5E, 0x1F, 0x79, 0xEF, 0xED, 0x83, 0xCA,
+    0x97, 0xA1, 0xD9, 0x7C, 0x2F, 0x92, 0x5C, 0x4F, 0x4F, 0x27, 0x56, 0x7E, 0x50, 0x27, 0xD5, 0x49,
+    0x0A, 0x95, 0x1B, 0x7F, 0xE4, 0x7D, 0x12, 0xE5, 0x9E, 0x5A, 0xD8, 0x33, 0x55, 0x18, 0x9F, 0xD0,
+    0xAF, 0x54, 0xE3, 0x93, 0xBA, 0x72, 0x63, 0x74, 0xC5, 0x3B, 0x17, 0xC7, 0xEF, 0x1A, 0xA9, 0xDF,
+    0x85, 0x0B, 0x87, 0x28, 0x54, 0x6B, 0x7C, 0x9A, 0x17, 0x5C, 0xF8, 0xE5, 0x0D, 0x92, 0x56, 0x9C,
+    0xA9, 0xD0, 0xEF, 0xF0, 0xDE, 0xD0, 0xD5, 0x8E, 0xAE, 0xB6, 0x75, 0x75, 0xF4, 0x2D, 0xB7, 0x8E,
+    0xDF, 0xA5, 0xEC, 0x59, 0x99, 0x3A, 0xAC, 0x54, 0x43, 0x9C, 0xAA, 0x38, 0xF8, 0x39, 0x0A, 0xDB,
+    0x2D, 0x94, 0xC3, 0xBD, 0xB4, 0x83, 0xC7, 0xEE, 0xDF, 0x3F, 0x4C, 0x81, 0xA5, 0x60, 0x5D, 0x89,
+    0x2C, 0xAC, 0x48, 0xC7, 0x11, 0x4A, 0x77, 0xBC, 0xC1, 0x3A, 0xF6, 0x8A, 0x7F, 0xC1, 0x3D, 0x6F,
+    0xEB, 0xA8, 0x65, 0xEE, 0xD2, 0x46, 0x7F, 0xE1, 0xFE, 0x0D, 0xB7, 0xDA, 0x3F, 0x25, 0x2D, 0x28,
+    0x80, 0x2D, 0xC0, 0x04, 0xA0, 0x07, 0xD4, 0xD2, 0x96, 0x59, 0x39, 0xCD, 0xCA, 0x74, 0xDE, 0x90,
+    0xF5, 0x49, 0x20, 0xC9, 0xD3, 0x9A, 0x35, 0xCA, 0x8A, 0xAB, 0xEA, 0x55, 0xAF, 0x2A, 0xF3, 0x05,
+    0x6F, 0xDC, 0x5A, 0x92, 0xAF, 0x71, 0x35, 0xE5, 0xAA, 0xAA, 0x32, 0x55, 0x19, 0x77, 0xCE, 0xB8,
+    0x35, 0xB6, 0xD7, 0xB8, 0x4A, 0x77, 0x55, 0x55, 0xEC, 0x56, 0xC6, 0x45, 0xE2, 0xD6, 0xD0, 0x0B,
+    0xD5, 0x3B, 0xDD, 0x64, 0x42, 0x5C, 0x1D, 0xC8, 0x89, 0xC4, 0xF9, 0x10, 0x04, 0x53, 0x61, 0x69,
+    0x56, 0x7E, 0xED, 0xBE, 0xF4, 0x3B, 0x7E, 0x43, 0xF2, 0xE4, 0x9E, 0x34, 0xCC, 0xF3, 0x39, 0x36,
+    0x37, 0x5E, 0xD7, 0x51, 0xA0, 0x65, 0xC6, 0x84, 0x04, 0x9B, 0xC7, 0x0F, 0x56, 0xA4, 0xB5, 0xFD,
+    0xBB, 0x6C, 0x61, 0x85, 0xA9, 0x63, 0xFA, 0x45, 0x71, 0x5A, 0x7E, 0x2C, 0x44, 0xAD, 0xEA, 0x51,
+    0x95, 0x59, 0x60, 0xDC, 0x5A, 0xC1, 0x1A, 0x57, 0x3B, 0xAE, 0xAA, 0x57, 0x5A, 0x55, 0x99, 0xA7,
+    0x82, 0x71, 0x6B, 0x3A, 0xAC, 0x71, 0x35, 0xAE, 0xAF, 0xAA, 0xCA, 0xFC, 0xA0, 0x32, 0xCE, 0xBE,
+    0xEC, 0xD6, 0xB0, 0xFF, 0x8D, 0xAB, 0x24, 0x8D, 0xAA, 0xC8, 0xAA, 0xF4, 0x16, 0xD9, 0x29, 0x09,
+    0x6C, 0x2D, 0xA3, 0xBA, 0x9F, 0xD9, 0xCB, 0x7A, 0x45, 0x81, 0xC1, 0xC6, 0x63, 0xC4, 0x7D, 0xDB,
+    0x6F, 0x35, 0x94, 0x75, 0xDC, 0xCB, 0x82, 0xA4, 0x4E, 0xBC, 0xAE, 0xD5, 0x2F, 0x21, 0xD7, 0xE6,
+    0xB1, 0x37, 0xAD, 0xDE, 0xB5, 0x72, 0x6A, 0xA9, 0x98, 0x57, 0xDD, 0x32, 0x03, 0xB2, 0x07, 0x13,
+    0xB0, 0x30, 0xE4, 0x4B, 0x7F, 0x57, 0x79, 0xA2, 0x30, 0x01, 0xF5, 0x8B, 0x7A, 0x19, 0x76, 0x55,
+    0xE1, 0xFF, 0xCF, 0x08, 0x3D, 0xA2, 0x2A, 0xF4, 0xF5, 0x1A, 0xB6, 0x03, 0x43, 0x18, 0xF0, 0xDA,
+    0x07, 0x1F, 0xA1, 0x61, 0x85, 0x6F, 0xC3, 0x60, 0x1F, 0x83, 0xAE, 0xD9, 0x93, 0xDF, 0x03, 0x3F,
+    0x55, 0x75, 0xFC, 0x25, 0x71, 0x87, 0x95, 0xCC, 0xC5, 0xC1, 0x3C, 0x3F, 0x07, 0xB4, 0x74, 0xA0,
+    0x2B, 0x15, 0x18, 0xCC, 0x45, 0xC6, 0xA4, 0x40, 0x33, 0xC4, 0xB1, 0xDF, 0x52, 0xAD, 0xFA, 0xA8,
+    0x77, 0x64, 0xDD, 0xAF, 0x9C, 0x0F, 0x2D, 0x57, 0xD5, 0x2B, 0xCD, 0xFE, 0x7C, 0xA8, 0xD7, 0xB8,
+    0x1A, 0x57, 0x57, 0x55, 0x65, 0x6E, 0x54, 0xC6, 0xD9, 0x3F, 0x72, 0x6B, 0xD8, 0xAF, 0xBC, 0xCB,
+    0x7C, 0x08, 0xB0, 0x1A, 0x7B, 0x98, 0x9C, 0x03, 0x24, 0x0C, 0xDE, 0x0B, 0xC0, 0x19, 0xD3, 0xC7,
+    0xBD, 0x2C, 0xA2, 0x3E, 0xEA, 0x74, 0xAD, 0x82, 0xCD, 0x63, 0x3F, 0x21, 0xA1, 0x65, 0xA6, 0xEB,
+    0xE8, 0xE0, 0xA5, 0x69, 0xA3, 0x20, 0x4D, 0xEC, 0x87, 0xF1, 0x2E, 0x06, 0x46, 0xCC, 0x87, 0x85,
+    0xB8, 0x3E, 0x84, 0xE1, 0xB5, 0xB4, 0x90, 0x89, 0x3B, 0x10, 0x1D, 0xFA, 0xF2, 0x79, 0x28, 0xA5,
+    0x26, 0xFB, 0x66, 0xE9, 0x6D, 0x45, 0xA9, 0x1A, 0x74, 0x93, 0x41, 0xF2, 0x52, 0x35, 0xE4, 0x10,
+    0xED, 0xCB, 0x7B, 0x39, 0xC4, 0xEF, 0x7B, 0x28, 0xB6, 0xC1, 0xBE, 0x54, 0x43, 0x9B, 0x41, 0x7A,
+    0xAA, 0x45, 0x07, 0x5B, 0x47, 0x1D, 0xF3, 0xDB, 0x02, 0xA5, 0xE4, 0x30, 0x05, 0x2D, 0x8D, 0x92,
+    0x03, 0xA6, 0x07, 0xF3, 0x16, 0x29, 0xAB, 0x22, 0xEA, 0x66, 0xA4, 0x67, 0xD0, 0x77, 0x72, 0xA4,
+    0x26, 0x6B, 0xB1, 0x25, 0xFA, 0xF5, 0x8A, 0xD0, 0xD1, 0xA6, 0x7F, 0xDB, 0x45, 0xD2, 0xB2, 0xB2,
+    0x39, 0x88, 0xFA, 0x38, 0x7F, 0x0C, 0xB2, 0x67, 0x1D, 0x91, 0xD4, 0x07, 0x62, 0xF0, 0x1F, 0x51,
+    0xDA, 0x93, 0xC8, 0x7F, 0x9C, 0x2D, 0x83, 0x95, 0x9C, 0xAF, 0xBA, 0x5F, 0x37, 0xD3, 0x04, 0x1C,
+    0x8A, 0x2A, 0x74, 0x38, 0x07, 0x8B, 0xC4, 0x93, 0xC5, 0x35, 0xDA, 0x5D, 0xF8, 0x08, 0x19, 0x0D,
+    0x60, 0x62, 0xA7, 0x6F, 0xD6, 0xFA, 0xC7, 0x21, 0x0A, 0x0D, 0x57, 0x9E, 0xD8, 0x4F, 0x68, 0xD5,
+    0xBA, 0x97, 0xA7, 0x42, 0xFC, 0x46, 0xD8, 0xCB, 0xB5, 0x49, 0x8E, 0xD4, 0x4C, 0x3A, 0xEC, 0xE5,
+    0xB7, 0xE7, 0xDA, 0x36, 0x97, 0xC9, 0x52, 0x59, 0x66, 0x37, 0xF6, 0x18, 0xFE, 0x3B, 0x7F, 0x8E,
+    0x16, 0x69, 0x48, 0xAE, 0x97, 0xEE, 0x40, 0x00, 0x73, 0xCF, 0x36, 0xD5, 0x15, 0x85, 0xA9, 0x49,
+    0xA5, 0xC2, 0x88, 0x47, 0x85, 0x0E, 0x8A, 0x24, 0x27, 0x55, 0x2D, 0xC6, 0x67, 0x4E, 0x05, 0xDD,
+    0xAA, 0x3E, 0x9F, 0xBF, 0x20, 0x8D, 0xEE, 0x96, 0x79, 0x8A, 0x01, 0xBF, 0xE0, 0x49, 0x1D, 0xE3,
+    0xFB, 0x32, 0xFA, 0xF8, 0x8D, 0x6E, 0xFE, 0x72, 0x17, 0xF7, 0xBF, 0xA7, 0x1B, 0x74, 0xFD, 0x0E,
+    0xEF, 0xE3, 0xBB, 0x6E, 0x2E, 0xF9, 0xCA, 0xC5, 0x4D, 0x32, 0x11, 0x17, 0x75, 0xC7, 0x1B, 0x52,
+    0xB2, 0xB7, 0xDA, 0xC8, 0x63, 0x8C, 0xDF, 0x41, 0xC9, 0x02, 0xCA, 0x0E, 0x52, 0xEB, 0x31, 0xD7,
+    0x5B, 0x54, 0x48, 0x73, 0x0A, 0xDD, 0x90, 0x92, 0xE5, 0xE9, 0xDF, 0xC5, 0x6D, 0x26, 0x2E, 0xF3,
+    0x10, 0x39, 0x0E, 0xED, 0xA5, 0x4E, 0x8A, 0xA5, 0xB1, 0xB7, 0x2F, 0x29, 0xDF, 0x33, 0x51, 0x80,
+    0xCA, 0xD1, 0x01, 0x15, 0x50, 0x35, 0xB1, 0x1F, 0x2C, 0xC9, 0x0D, 0x74, 0xBD, 0x05, 0x93, 0x2D,
+    0xD0, 0x8B, 0xA5, 0xC1, 0xFE, 0x51, 0xF1, 0xF4, 0x91, 0xA8, 0xB6, 0x4F, 0xFB, 0xF8, 0x47, 0x44,
+    0x8B, 0xA1, 0x27, 0xEF, 0x8B, 0xFC, 0x1C, 0x5D, 0x93, 0x56, 0xF4, 0x8E, 0xF3, 0x00, 0xFC, 0xBE,
+    0x8B, 0xA5, 0x4B, 0xFE, 0xBA, 0x98, 0x30, 0x1A, 0x33, 0x1A, 0xF3, 0x44, 0xE6, 0x48, 0x6B, 0x4C,
+    0x4F, 0x24, 0x15, 0x49, 0x83, 0xEA, 0x7E, 0x93, 0xAD, 0xC0, 0xB8, 0x61, 0xAB, 0xA3, 0x2B, 0x2F,
+    0x85, 0x54, 0xFC, 0x32, 0x78, 0x14, 0x48, 0x9C, 0xAE, 0x69, 0x39, 0xBC, 0xB7, 0x8E, 0xFE, 0xF0,
+    0xCD, 0xED, 0x91, 0xFA, 0xA1, 0xFF, 0x44, 0xE6, 0x94, 0x38, 0x23, 0xCE, 0x74, 0x47, 0xCC, 0x6B,
+    0xAC, 0x3F, 0xA7, 0x5E, 0xFB, 0x69, 0x91, 0x09, 0xC7, 0xE0, 0xD3, 0x30, 0x77, 0xD1, 0xBD, 0x2A,
+    0xBE, 0x1E, 0xCC, 0x30, 0x25, 0x7E, 0x6D, 0x0A, 0x1A, 0xD2, 0x2A, 0xBE, 0x43, 0x73, 0x6D, 0x6D,
+    0x89, 0xDF, 0x9A, 0xB7, 0xC9, 0x33, 0x3F, 0xF4, 0x6B, 0x23, 0x6E, 0x36, 0xA4, 0x0D, 0x65, 0x43,
+    0x79, 0x9D, 0x9D, 0xAF, 0xA9, 0xD7, 0xF2, 0xF5, 0x73, 0xCF, 0xDC, 0x94, 0x10, 0x6D, 0x7E, 0x80,
+    0xD6, 0x7E, 0x1F, 0x4A, 0xB0, 0x8E, 0x14, 0x8A, 0xE5, 0xB2, 0x79, 0x0F, 0x0D, 0x7E, 0x16, 0xD5,
+    0xA1, 0x3D, 0x33, 0x12, 0x22, 0xC7, 0xC7, 0x38, 0x6B, 0x9F, 0x0A, 0xF1, 0xAB, 0x3E, 0x92, 0x41,
+    0x63, 0x7F, 0x90, 0x11, 0xD0, 0x7E, 0xB4, 0x6E, 0xDD, 0xCF, 0x6B, 0xDD, 0xED, 0xE5, 0xB7, 0xDF,
+    0xC3, 0x08, 0x1C, 0x9B, 0x4E, 0xA7, 0x56, 0x44, 0x6E, 0xDE, 0x2E, 0x2F, 0x86, 0x60, 0xF3, 0xD1,
+    0x48, 0xD7, 0xF6, 0xE3, 0xB4, 0xCA, 0x31, 0x01, 0x6C, 0xBE, 0xD4, 0xAB, 0xED, 0x12, 0x7F, 0xF6,
+    0x8E, 0x15, 0xC7, 0x77, 0x21, 0x93, 0x65, 0xCE, 0xED, 0x90, 0x5B, 0xC2, 0x79, 0x26, 0x4B, 0x6D,
+    0x9C, 0xB8, 0xFD, 0x75, 0x35, 0x1A, 0xFC, 0xB9, 0x54, 0xBE, 0x2F, 0xDD, 0x3B, 0xB9, 0x8B, 0xB1,
+    0x67, 0x7E, 0x59, 0x49, 0x15, 0x39, 0x7E, 0x0F, 0x13, 0xB0, 0x44, 0x81, 0x82, 0x15, 0xB8, 0xA0,
+    0x73, 0x26, 0x71, 0x85, 0x7E, 0xAD, 0x82, 0xAC, 0xDA, 0xCF, 0x41, 0x45, 0xD3, 0xE9, 0x74, 0x53,
+    0x44, 0xBA, 0xC9, 0xA5, 0xDD, 0xCB, 0x96, 0x56, 0xDF, 0xF4, 0x13, 0xC2, 0x79, 0x9B, 0x3F, 0xFA,
+    0x1E, 0xE8, 0xDE, 0xAB, 0x88, 0xCA, 0x0B, 0x68, 0x59, 0x80, 0x76, 0x8C, 0x88, 0x73, 0xCE, 0xEA,
+    0x97, 0x98, 0x1D, 0x89, 0xBD, 0x92, 0x4E, 0xC4, 0xBF, 0x93, 0x6B, 0x3B, 0x23, 0xDE, 0x0D, 0xE9,
+    0x82, 0xA3, 0xEF, 0x85, 0x83, 0x9F, 0x7A, 0x13, 0x52, 0xA9, 0xDE, 0x1B, 0x07, 0xDF, 0x99, 0x47,
+    0x22, 0xF9, 0xDB, 0x79, 0x14, 0x39, 0x07, 0xE9, 0xCD, 0x1C, 0xEE, 0x09, 0xE8, 0xAF, 0x37, 0x07,
+    0xBC, 0xFE, 0xA9, 0x8B, 0xA6, 0xCF, 0x8A, 0xCB, 0xFA, 0xE3, 0x35, 0x89, 0xB7, 0x8E, 0x75, 0xC6,
+    0x70, 0x8D, 0x06, 0x55, 0xEB, 0x0A, 0x93, 0xFF, 0xD2, 0xAA, 0x16, 0x5D, 0xE9, 0x40, 0x42, 0x1C,
+    0xA2, 0x16, 0xDB, 0x8B, 0x1F, 0xD4, 0x26, 0x7B, 0xF0, 0x87, 0xF4, 0x05, 0x87, 0xDD, 0xAD, 0xD1,
+    0x9F, 0x6F, 0xC0, 0x7D, 0xE9, 0x40, 0x92, 0x8C, 0xCB, 0x79, 0xE9, 0xB3, 0x77, 0x0B, 0x71, 0x1D,
+    0xA8, 0x88, 0x1A, 0xDD, 0x90, 0xDD, 0x91, 0xF3, 0x5A, 0xFE, 0x68, 0xC8, 0x79, 0x12, 0x4D, 0x1D,
+    0x64, 0xE2, 0x19, 0x32, 0xE4, 0xFB, 0x69, 0x95, 0x4D, 0xA6, 0x5F, 0x94, 0xCA, 0xCA, 0x7F, 0x6C,
+    0x89, 0xC3, 0xAF, 0xA6, 0xFE, 0xC1, 0xAA, 0x09, 0x34, 0x74, 0xC4, 0x3E, 0xEA, 0x38, 0x87, 0x96,
+    0x32, 0xA0, 0xA4, 0x67, 0xC8, 0x20, 0x49, 0x0F, 0xF3, 0x07, 0x0C, 0x23, 0x30, 0xE1, 0x50, 0x6B,
+    0x3A, 0xBD, 0x78, 0x77, 0xD2, 0xF7, 0x2B, 0x12, 0x97, 0x39, 0xDD, 0xCB, 0x5D, 0xB2, 0xB6, 0xF4,
+    0xF7, 0x11, 0x03, 0x1B, 0x91, 0x87, 0xFE, 0xAB, 0x0C, 0x56, 0xCC, 0x1E, 0xD3, 0x3E, 0xEA, 0x31,
+    0x79, 0x22, 0xCA, 0xB1, 0xCF, 0x57, 0x28, 0x09, 0x70, 0xFC, 0xFC, 0x87, 0x34, 0x26, 0x3C, 0x06,
+    0xC4, 0x0B, 0x60, 0x63, 0x04, 0xD4, 0x01, 0xF4, 0xCD, 0x7C, 0x48, 0x2F, 0x12, 0x39, 0x56, 0xA6,
+    0xAC, 0x4C, 0xE7, 0x0B, 0xA4, 0x3D, 0x93, 0x33, 0x7F, 0x3F, 0x1D, 0x6A, 0x50, 0xB5, 0xAE, 0xB1,
+    0xCE, 0x7A, 0x66, 0x24, 0x3E, 0xAE, 0xC9, 0xEE, 0x09, 0xA4, 0xFB, 0xA6, 0xDF, 0xAA, 0x1B, 0xDA,
+    0xD1, 0x5F, 0xCF, 0x89, 0xAA, 0x00, 0xCF, 0x6D, 0x80, 0xED, 0x80, 0xEF, 0x2C, 0xA7, 0xA1, 0xFF,
+    0x5C, 0x9D, 0x06, 0xFB, 0x2B, 0x7A, 0xA5, 0x02, 0x0D, 0x5B, 0x2C, 0xB0, 0xF7, 0xE4, 0x16, 0xF2,
+    0x37, 0xB2, 0x87, 0x57, 0x02, 0xB8, 0xF2, 0x49, 0x30, 0xBE, 0x1B, 0x4C, 0x37, 0x7B, 0xBD, 0x85,
+    0x27, 0x56, 0xF7, 0xB2, 0x9C, 0x1F, 0x5D, 0xCF, 0x06, 0x7C, 0x70, 0x05, 0x6D, 0x01, 0xB3, 0x31,
+    0x8C, 0xD6, 0xE1, 0x91, 0xC3, 0xF7, 0xC7, 0xEC, 0x83, 0xF4, 0xEC, 0xD8, 0x69, 0x8E, 0x4D, 0xA5,
+    0xD1, 0xF2, 0xE3, 0x1D, 0xA2, 0xEE, 0xFD, 0xD0, 0x5C, 0x61, 0x72, 0x9B, 0x33, 0x26, 0x23, 0x0A,
+    0xCC, 0x49, 0x72, 0xE4, 0x4E, 0xB7, 0x34, 0x3C, 0x57, 0xC3, 0xD2, 0x4A, 0x62, 0x06, 0x44, 0xFD,
+    0x1E, 0x7A, 0xE7, 0x03, 0x2D, 0x9B, 0xB9, 0x8F, 0x36, 0xAD, 0x03, 0xE3, 0x86, 0x78, 0x0F, 0x0B,
+    0xB7, 0x44, 0x88, 0xEE, 0xCD, 0xBD, 0x65, 0x38, 0x01, 0xD4, 0xE0, 0xE3, 0x9A, 0x17, 0xEA, 0x21,
+    0x45, 0x72, 0x61, 0xBF, 0xE9, 0x63, 0x53, 0xE0, 0xD8, 0xE9, 0xB9, 0xF0, 0x18, 0x65, 0x77, 0xBC,
+    0x61, 0x8C, 0xA9, 0x74, 0xE0, 0xDC, 0x10, 0x5E, 0x16, 0x6C, 0x1E, 0x35, 0x08, 0x16, 0xDA, 0xE8,
+    0x4E, 0x9E, 0x40, 0xA7, 0x5E, 0xF5, 0xEB, 0x30, 0xD3, 0x2F, 0xF9, 0x31, 0x8C, 0xE3, 0x17, 0xAA,
+    0x11, 0x4C, 0xCC, 0x53, 0xE1, 0x1A, 0xA4, 0x36, 0x0A, 0x0D, 0xD8, 0xC3, 0x34, 0x01, 0xEC, 0x57,
+    0xF8, 0x5E, 0x0D, 0xA6, 0xE0, 0x5C, 0x05, 0xBA, 0x23, 0xF3, 0xA0, 0x1B, 0xD2, 0x1C, 0x54, 0x20,
+    0x39, 0x20, 0x3B, 0x2C, 0x80, 0xEE, 0x58, 0x46, 0x1F, 0xB1, 0xD6, 0x81, 0xAE, 0x36, 0x0E, 0x0A,
+    0x97, 0x58, 0xF2, 0xAF, 0x99, 0x3E, 0xBB, 0x65, 0xDC, 0x99, 0xAA, 0xA5, 0xA3, 0x31, 0x3E, 0xF1,
+    0x09, 0x63, 0xB5, 0x50, 0xB5, 0xAE, 0x27, 0x61, 0x44, 0x1A, 0x3F, 0xAB, 0x3D, 0xE1, 0x4A, 0x73,
+    0x16, 0xFB, 0x0D, 0xF3, 0x7D, 0xD8, 0xAA, 0x46, 0x35, 0xBA, 0xD3, 0x0B, 0x48, 0xF3, 0xC4, 0x13,
+    0x35, 0xEC, 0x03, 0xAA, 0xA2, 0xF3, 0x4B, 0xF6, 0xDC, 0xAB, 0xA1, 0x1D, 0xC3, 0xD9, 0x01, 0xBC,
+    0xF2, 0xA1, 0x42, 0x28, 0x31, 0x39, 0x94, 0x0E, 0x7D, 0x07, 0xC6, 0xEB, 0x44, 0xF5, 0xFD, 0x1D,
+    0x0C, 0xBD, 0xE9, 0xB3, 0x5B, 0xC7, 0x9B, 0x09, 0xD6, 0x15, 0xCC, 0x68, 0x74, 0xA5, 0x82, 0x25,
+    0xF6, 0xD7, 0xB0, 0x2F, 0x78, 0x92, 0x13, 0x03, 0x54, 0xAA, 0xCC, 0x61, 0x31, 0x3C, 0xD7, 0x0E,
+    0x98, 0x31, 0x53, 0xF1, 0x1B, 0x3D, 0x94, 0x81, 0xE8, 0x2E, 0xC0, 0x73, 0x87, 0x20, 0x8B, 0x6B,
+    0xEC, 0xF5, 0xFB, 0x4A, 0x6C, 0x65, 0xCA, 0xF4, 0x19, 0xA9, 0xE7, 0xED, 0x3C, 0x57, 0x8D, 0x0E,
+    0x34, 0x6C, 0x33, 0xC3, 0xFA, 0x31, 0x51, 0xB3, 0x0E, 0x99, 0x05, 0xFD, 0x6A, 0x0E, 0xA5, 0x07,
+    0x5B, 0xDD, 0x27, 0xFB, 0x81, 0x7E, 0xAC, 0xCA, 0x79, 0x62, 0x69, 0x07, 0x7B, 0x59, 0x05, 0x98,
+    0x7B, 0x4C, 0xB3, 0xE7, 0x91, 0x30, 0x9D, 0x9E, 0x8E, 0x45, 0x9A, 0xE4, 0xE2, 0xE5, 0xEA, 0x1A,
+    0x13, 0xE5, 0x75, 0x50, 0xA4, 0x8E, 0xA8, 0x1D, 0x00, 0x2C, 0xDB, 0x10, 0xD7, 0x90, 0x0D, 0x3F,
+    0x4D, 0x1C, 0xB4, 0x9C, 0xB4, 0x9E, 0xB0, 0x4D, 0x7C, 0x53, 0xA4, 0xB7, 0xB2, 0x8F, 0x89, 0x20,
+    0xAA, 0x96, 0xD8, 0x99, 0xE4, 0xFE, 0x16, 0x8F, 0x44, 0xBA, 0x54, 0x16, 0x27, 0x69, 0x4F, 0xEA,
+    0x80, 0xF1, 0x24, 0x6E, 0x09, 0xB2, 0x09, 0x2B, 0xC6, 0xDB, 0xC4, 0x9D, 0xC8, 0x2E, 0xF6, 0xD9,
+    0x32, 0xF4, 0x39, 0xC4, 0x85, 0xA3, 0x6E, 0x2F, 0x92, 0xF1, 0xA1, 0xD2, 0xB7, 0x0E, 0x19, 0x64,
+    0xF7, 0x83, 0x66, 0xEF, 0x9D, 0x32, 0x95, 0x1F, 0xC6, 0xFE, 0x61, 0x83, 0xFD, 0xB6, 0xC3, 0x36,
+    0xFB, 0x28, 0x9B, 0x0F, 0x8F, 0x73, 0x86, 0xAB, 0xF1, 0x8D, 0x5A, 0xFD, 0xC2, 0x23, 0xF7, 0x9D,
+    0xA5, 0xF7, 0xC3, 0xB9, 0x4D, 0xD2, 0x9E, 0xED, 0x39, 0xE1, 0xE3, 0x43, 0xB6, 0xEE, 0xBD, 0xBC,
+    0xCD, 0x2E, 0x99, 0xB8, 0x23, 0x71, 0x7E, 0x4E, 0x35, 0xC6, 0x3F, 0x02, 0x30, 0x32, 0x55, 0x3B,
+    0xD1, 0x0E, 0x74, 0x65, 0x42, 0x52, 0x8C, 0xD6, 0xAF, 0x5A, 0x80, 0xF9, 0x21, 0xB9, 0xF3, 0x46,
+    0x7F, 0xE4, 0xD1, 0x54, 0x6E, 0x2E, 0x83, 0x1B, 0x17, 0x74, 0x9B, 0xCC, 0x3B, 0x73, 0x61, 0xB4,
+    0xB3, 0x7D, 0xF4, 0xD3, 0xEA, 0x54, 0xE8, 0x26, 0xD6, 0xBB, 0x23, 0xAB, 0xE7, 0xD3, 0x6E, 0x34,
+    0x7A, 0x62, 0xC4, 0xB5, 0xB8, 0xD2, 0x0E, 0xA2, 0xF3, 0x49, 0x33, 0x1A, 0x6D, 0x9C, 0x1C, 0x8D,
+    0xD2, 0x66, 0xF5, 0x3C, 0xF0, 0xC4, 0x86, 0x79, 0xC9, 0x37, 0xED, 0x7A, 0xA2, 0x9F, 0x1F, 0x3C,
+    0x14, 0x9D, 0x8F, 0xD6, 0x2D, 0x3F, 0xAF, 0x74, 0x4B, 0x02, 0xA8, 0xEB, 0x7E, 0x3C, 0x51, 0x6F,
+    0x04, 0xFB, 0xF9, 0x7C, 0x63, 0x98, 0x40, 0x49, 0x3B, 0xEF, 0xEB, 0x24, 0x5F, 0xE1, 0xF0, 0xE8,
+    0x5A, 0xD3, 0x6E, 0x1F, 0xFD, 0x8C, 0xBD, 0xDE, 0x8C, 0xAD, 0x39, 0xE5, 0x3E, 0x63, 0x5F, 0x7A,
+    0x25, 0x8C, 0xE2, 0xFC, 0x6B, 0xAC, 0x8D, 0x47, 0x1B, 0x8F, 0x1F, 0x79, 0x6C, 0x32, 0x99, 0x5D,
+    0xE1, 0x41, 0x7A, 0x0E, 0x3D, 0xBD, 0x7D, 0xE5, 0xF5, 0xC3, 0x73, 0xBF, 0x79, 0x28, 0xAE, 0xDB,
+    0xF1, 0x89, 0x15, 0x3E, 0xAB, 0x3B, 0xED, 0x67, 0x69, 0xE4, 0x88, 0xEA, 0x91, 0xC9, 0xCF, 0xFD,
+    0xEB, 0x05, 0xFC, 0xFB, 0x57, 0xBF, 0xF2, 0x17, 0x39, 0xE8, 0xDA, 0xB6, 0xEB, 0xE3, 0x6B, 0xF6,
+    0x08, 0x10, 0xE2, 0x45, 0x92, 0x75, 0xAB, 0xE7, 0x61, 0x72, 0x48, 0x7E, 0xF4, 0x0F, 0xFD, 0xE6,
+    0xEF, 0xAD, 0x4C, 0x4F, 0x49, 0xF7, 0x4F, 0x2E, 0xBA, 0x03, 0x04, 0x7D, 0x1C, 0x02, 0x29, 0xDA,
+    0x73, 0x95, 0x88, 0x4F, 0xAB, 0xA7, 0xC3, 0x62, 0x62, 0xBD, 0x3B, 0x72, 0xC4, 0x6A, 0xBF, 0x9B,
+    0x3A, 0x72, 0x48, 0x21, 0xEA, 0x61, 0xB5, 0x83, 0x01, 0xC5, 0xFB, 0x01, 0x71, 0x20, 0xC7, 0xA6,
+    0xD3, 0x29, 0x99, 0x88, 0x30, 0xB9, 0xB4, 0x5B, 0x32, 0xD2, 0xD5, 0x09, 0x46, 0xBA, 0xFA, 0x24,
+    0x8F, 0xEA, 0xEA, 0xA1, 0xA5, 0x43, 0x30, 0x14, 0xD2, 0x83, 0x16, 0xA9, 0xD0, 0x95, 0x09, 0xE8,
+    0x2A, 0x6A, 0xD1, 0x15, 0x1D, 0xBA, 0xA2, 0x40, 0x57, 0xCC, 0x86, 0x22, 0xB9, 0x4B, 0x81, 0xF4,
+    0x43, 0xB2, 0xAC, 0xD9, 0x8B, 0x87, 0x9A, 0x0A, 0x56, 0x4A, 0xB7, 0x04, 0x7A, 0xEE, 0x01, 0x56,
+    0x0B, 0x22, 0x41, 0x2D, 0x96, 0x9E, 0xDE, 0xCA, 0x74, 0xFA, 0x6F, 0x44, 0xFA, 0xE4, 0xF6, 0xE5,
+    0xA7, 0x82, 0xAE, 0x0A, 0xAE, 0xA6, 0x9C, 0x34, 0x3E, 0x52, 0x01, 0x0A, 0x48, 0xC1, 0x78, 0xDE,
+    0x7A, 0xA1, 0xE4, 0xBC, 0x96, 0x16, 0x56, 0x5F, 0x44, 0x89, 0xB8, 0xEC, 0x5B, 0xBD, 0x0E, 0x5C,
+    0x4B, 0x89, 0xEA, 0x16, 0xFD, 0xF4, 0x00, 0xA1, 0x65, 0xE7, 0xE2, 0x05, 0x2D, 0xE2, 0xED, 0x5F,
+    0x9F, 0x26, 0x5D, 0xCA, 0xE0, 0x16, 0x4E, 0x05, 0xCC, 0xD3, 0x0D, 0xDB, 0xA6, 0xBF, 0x1C, 0x56,
+    0x65, 0x89, 0x7D, 0xFA, 0x75, 0x1D, 0xC5, 0xF7, 0x92, 0xCD, 0x7C, 0xCC, 0x7C, 0xBE, 0xEE, 0xB6,
+    0xAC, 0x1F, 0x34, 0xC9, 0x66, 0x26, 0x6E, 0xEE, 0x54, 0x20, 0xE5, 0x97, 0x15, 0x65, 0x9D, 0x89,
+    0xFB, 0x40, 0xB9, 0xC1, 0xE9, 0x74, 0xEA, 0x40, 0x44, 0x3C, 0x24, 0xB7, 0x17, 0x80, 0x71, 0xC5,
+    0x5B, 0x4A, 0xCB, 0xC1, 0xB2, 0x94, 0x1C, 0xCB, 0xCE, 0xE5, 0x86, 0x13, 0x14, 0x51, 0xC7, 0x1A,
+    0x05, 0x5B, 0x8C, 0x28, 0x18, 0x33, 0xA3, 0x18, 0xC0, 0xCB, 0x14, 0xFF, 0x21, 0x50, 0x44, 0x6D,
+    0xE9, 0x57, 0xFB, 0x32, 0x94, 0xCE, 0x4A, 0xEF, 0x8E, 0x2E, 0x93, 0x64, 0xD1, 0xD4, 0x21, 0x9D,
+    0x91, 0x8A, 0xA4, 0x8A, 0x76, 0xC0, 0x78, 0xB6, 0x7E, 0x49, 0x29, 0x22, 0xBB, 0xCE, 0x88, 0x88,
+    0x34, 0xC6, 0xB3, 0x15, 0x75, 0xC6, 0xB3, 0xC5, 0xE4, 0x6D, 0xE5, 0x78, 0xB8, 0x9B, 0xB6, 0x91,
+    0x94, 0x41, 0x3A, 0x23, 0x7B, 0x2E, 0xC6, 0xB1, 0xE9, 0x74, 0x8A, 0x15, 0x11, 0xAF, 0x6F, 0x97,
+    0x97, 0x02, 0xC1, 0xBA, 0xE7, 0x86, 0x59, 0xFC, 0x71, 0x9A, 0x68, 0x2F, 0x58, 0x64, 0x1D, 0xA0,
+    0x5F, 0x97, 0x1C, 0x44, 0x3A, 0x98, 0x90, 0x3A, 0xAC, 0xD3, 0x35, 0xBA, 0xA2, 0x85, 0x86, 0x0C,
+    0xC6, 0x58, 0x8F, 0x75, 0x3A, 0x90, 0xB4, 0xAA, 0x77, 0x99, 0x9C, 0x92, 0x1A, 0x56, 0x97, 0xBA,
+    0xCF, 0x86, 0x61, 0x5B, 0xC5, 0xBE, 0x2D, 0xEB, 0x56, 0xB5, 0x04, 0x13, 0x92, 0x2A, 0xEE, 0x86,
+    0x58, 0x93, 0xAA, 0x49, 0x09, 0x18, 0x7F, 0x15, 0x15, 0x36, 0x60, 0xA7, 0x83, 0x54, 0x72, 0xCC,
+    0xF5, 0x06, 0x15, 0x32, 0x28, 0xE2, 0x9A, 0x94, 0x6D, 0x8C, 0xB7, 0x7E, 0xC0, 0x44, 0xE6, 0xE9,
+    0x4D, 0x09, 0xAA, 0x1B, 0x7C, 0xA7, 0x8F, 0xB1, 0x74, 0x60, 0x11, 0x80, 0xD2, 0xC1, 0x3E, 0x9E,
+    0x77, 0xEA, 0x56, 0xA6, 0xD9, 0x12, 0x3E, 0x72, 0x26, 0x4F, 0x61, 0x8B, 0x02, 0xDD, 0xA8, 0x40,
+    0x56, 0x19, 0xAF, 0xEF, 0xB8, 0x94, 0xF1, 0x98, 0x42, 0x57, 0x8D, 0x0A, 0x63, 0x5D, 0x99, 0x9B,
+    0x95, 0x75, 0xE9, 0x84, 0x31, 0x65, 0x4D, 0xA3, 0x7A, 0x74, 0x65, 0x6A, 0xAC, 0x4B, 0x61, 0xAC,
+    0xFA, 0x7D, 0xF8, 0xC8, 0x43, 0x38, 0xB4, 0x4F, 0x60, 0xA2, 0x03, 0x91, 0x74, 0xEC, 0xC3, 0xF1,
+    0x8F, 0x9D, 0x66, 0xFA, 0x8C, 0xD4, 0x69, 0x9F, 0xD4, 0x64, 0x6E, 0x32, 0x84, 0xF2, 0x67, 0xD8,
+    0xDC, 0x3A, 0x8A, 0x28, 0xA0, 0xEB, 0x31, 0xA4, 0xB1, 0x87, 0xF6, 0x2A, 0x98, 0xEF, 0x33, 0x04,
+    0x11, 0x54, 0xB7, 0xC7, 0xEC, 0x1A, 0x3E, 0x31, 0x02, 0x25, 0x6E, 0xD8, 0x89, 0xC2, 0xE6, 0x72,
+    0x7A, 0x3C, 0x2B, 0x7E, 0x2E, 0x49, 0x15, 0xCD, 0x29, 0x06, 0x50, 0xCB, 0xE4, 0xFD, 0x9F, 0xA4,
+    0x22, 0xF2, 0x6D, 0x11, 0x91, 0x21, 0xE3, 0x93, 0x2C, 0xE3, 0xFE, 0x83, 0xBD, 0xB8, 0xD4, 0xF5,
+    0x11, 0x9C, 0x80, 0x6D, 0x18, 0xE2, 0x78, 0x5F, 0x7B, 0x7F, 0x28, 0xB7, 0x01, 0x00, 0xBB, 0xB7,
+    0x57, 0xE0, 0x0F, 0x76, 0x2F, 0x44, 0x22, 0xD5, 0x1E, 0xDE, 0x5F, 0xFF, 0xAF, 0x05, 0x56, 0x7A,
+    0xB2, 0x6F, 0x2E, 0x68, 0xA2, 0x56, 0x57, 0x3A, 0x58, 0x67, 0xFC, 0x98, 0x94, 0x86, 0x99, 0xAE,
+    0xA2, 0x60, 0x9D, 0xB9, 0x5E, 0xE6, 0x69, 0x22, 0x5C, 0x1B, 0x64, 0x68, 0x32, 0xC4, 0x27, 0x8C,
+    0x67, 0x75, 0x31, 0x44, 0x28, 0x86, 0x2D, 0x0F, 0x71, 0x85, 0xF5, 0xAC, 0xDF, 0xDF, 0xEF, 0x90,
+    0xC9, 0x22, 0x95, 0x85, 0xAE, 0xD7, 0x74, 0xFD, 0x88, 0xAE, 0x1F, 0x7E, 0x37, 0x3D, 0x3B, 0x44,
+    0xA6, 0xED, 0xED, 0x6E, 0x9D, 0xD9, 0x8C, 0x8D, 0x6B, 0xD0, 0x1E, 0x43, 0x84, 0xBB, 0x53, 0x5A,
+    0x28, 0x20, 0x73, 0xA4, 0xD2, 0xC5, 0x12, 0x06, 0xA7, 0xF3, 0xBD, 0xC4, 0xEE, 0xDE, 0x23, 0xAA,
+    0xE3, 0xD3, 0xEA, 0x54, 0xE8, 0x32, 0xE3, 0xDD, 0x91, 0x25, 0x70, 0x25, 0x92, 0x9C, 0x16, 0xFB,
+    0x0E, 0x45, 0x7A, 0x2B, 0x91, 0x1C, 0x28, 0x58, 0xEC, 0x21, 0x28, 0x54, 0x67, 0x3A, 0x0A, 0x66,
+    0xEF, 0x78, 0x14, 0xB4, 0x71, 0x48, 0xFD, 0xFA, 0x10, 0xD6, 0x1D, 0xE0, 0xB7, 0x23, 0xEB, 0x60,
+    0xE3, 0x40, 0x21, 0xE7, 0x39, 0x6B, 0xEF, 0x34, 0x5C, 0xB1, 0xAE, 0x20, 0x58, 0x37, 0x8A, 0x6A,
+    0xEB, 0x46, 0xFF, 0xC8, 0x5B, 0x57, 0x94, 0x79, 0x7A, 0x29, 0xEC, 0x20, 0x92, 0x1F, 0x01, 0xC8,
+    0xBA, 0xA4, 0xC7, 0xF4, 0x71, 0x0F, 0x13, 0xD6, 0xC1, 0xE6, 0x26, 0x47, 0xD7, 0xAA, 0x86, 0xBB,
+    0xD3, 0xFE, 0x3B, 0x64, 0x22, 0x52, 0xDB, 0x6F, 0x3D, 0x9B, 0x17, 0xBA, 0x56, 0xB5, 0x75, 0x2D,
+    0xD7, 0x74, 0x35, 0x61, 0x3D, 0x0A, 0x69, 0x9D, 0xDC, 0x6E, 0xB3, 0x45, 0xB2, 0x6F, 0x52, 0xBD,
+    0x1D, 0x94, 0x74, 0x81, 0x64, 0x09, 0xF5, 0xC4, 0x3A, 0xD0, 0x37, 0xFA, 0x01, 0x4F, 0x95, 0xBD,
+    0xD2, 0x63, 0x73, 0x9B, 0xFF, 0x6A, 0x50, 0xD2, 0x72, 0x93, 0xC4, 0x60, 0xDE, 0x6D, 0x0D, 0xF3,
+    0xE4, 0x13, 0xF7, 0x31, 0x82, 0x5D, 0x5C, 0x95, 0x55, 0xE6, 0xC6, 0xDA, 0xD3, 0xAC, 0xA1, 0xAB,
+    0x1A, 0xFB, 0x6D, 0xC8, 0x3A, 0x68, 0x0A, 0x74, 0xD5, 0x60, 0x9F, 0x0C, 0x8C, 0x75, 0x50, 0x0B,
+    0x5D, 0x67, 0x5D, 0x1C, 0x20, 0x72, 0x3C, 0xC4, 0xD2, 0xF3, 0x0B, 0x4B, 0x54, 0x84, 0x0E, 0xC0,
+    0xC3, 0x1C, 0x78, 0xAC, 0x91, 0xCF, 0x2F, 0x94, 0xE4, 0x63, 0x2C, 0xD6, 0x59, 0xAF, 0x2B, 0x1B,
+    0x68, 0x92, 0x11, 0xE3, 0xC4, 0x62, 0xFF, 0x9D, 0xF6, 0xBA, 0x27, 0xD0, 0x33, 0x62, 0x82, 0x25,
+    0x3D, 0x6F, 0xDA, 0xAC, 0xB3, 0xE2, 0x94, 0xFF, 0x34, 0x96, 0x96, 0x2C, 0xAE, 0x48, 0x17, 0x1F,
+    0x6C, 0x6F, 0xCB, 0x09, 0x88, 0x02, 0xF6, 0x32, 0x64, 0x01, 0xCE, 0x0D, 0x23, 0x25, 0xA6, 0xD7,
+    0xE2, 0x26, 0xA4, 0xCB, 0x9C, 0xA5, 0x0A, 0xB4, 0x14, 0xBC, 0x63, 0x45, 0x7A, 0xBB, 0xBC, 0x95,
+    0x89, 0xC8, 0x10, 0xF3, 0x5B, 0x07, 0x62, 0x07, 0x51, 0x05, 0x3C, 0x0E, 0x5C, 0xFC, 0x0E, 0x58,
+    0x71, 0xCB, 0x75, 0xD6, 0xC2, 0x5C, 0xA4, 0x8B, 0x77, 0xFB, 0xD2, 0x9F, 0xB5, 0xF9, 0x46, 0x4C,
+    0xAB, 0xDD, 0x91, 0xBD, 0x5B, 0x58, 0x79, 0x11, 0x44, 0x02, 0x36, 0x4F, 0x3D, 0x2D, 0x05, 0x36,
+    0xD7, 0x15, 0x2D, 0x5B, 0xD8, 0xDC, 0x78, 0xDA, 0xA8, 0xE5, 0xCC, 0xEB, 0x82, 0x95, 0x3D, 0xDC,
+    0xE8, 0xBF, 0x1D, 0xE6, 0xC2, 0xF1, 0xFB, 0x9B, 0x80, 0x44, 0x3A, 0x7D, 0xEF, 0x5E, 0x38, 0x6C,
+    0x9F, 0xF2, 0x8F, 0x8E, 0x57, 0x06, 0x19, 0x71, 0xFB, 0x45, 0xAC, 0xB4, 0x8C, 0xA3, 0x86, 0x46,
+    0xD7, 0xBA, 0xB2, 0xCE, 0xBA, 0x11, 0x3B, 0x97, 0x6A, 0xBB, 0x17, 0x8A, 0x7B, 0x20, 0x07, 0xD7,
+    0xED, 0xE5, 0xE0, 0x6A, 0xA2, 0x76, 0x2F, 0x07, 0x57, 0xF4, 0x17, 0x2F, 0x5E, 0xFE, 0xBE, 0x88,
+    0x74, 0x1D, 0x98, 0x97, 0xF7, 0xB2, 0x59, 0x2F, 0x04, 0xA2, 0x26, 0x73, 0xEF, 0x96, 0x83, 0x3B,
+    0x98, 0x25, 0x4C, 0xBE, 0x8A, 0xBE, 0xF3, 0xAD, 0xA9, 0x88, 0xC8, 0xDD, 0xE9, 0x33, 0x25, 0xFA,
+    0x75, 0xFF, 0x96, 0x2C, 0xE1, 0xB1, 0x29, 0xD1, 0x7F, 0x95, 0x96, 0xEC, 0x95, 0x1E, 0x25, 0x4F,
+    0xB6, 0xD8, 0x7F, 0xA6, 0x03, 0x33, 0x8C, 0xD7, 0x35, 0x89, 0xB3, 0x90, 0x31, 0x83, 0x42, 0x55,
+    0xD0, 0x58, 0xD0, 0xF5, 0x0C, 0xE2, 0x1B, 0x15, 0xD8, 0x2F, 0x00, 0xEB, 0x23, 0xE0, 0x5C, 0xB5,
+    0x54, 0x5A, 0xAA, 0x63, 0x3F, 0x92, 0xBC, 0x4F, 0x4B, 0x97, 0xDD, 0xD2, 0x9D, 0xCD, 0xE3, 0xFF,
+    0x6D, 0xBC, 0x45, 0x57, 0x16, 0x5D, 0xAF, 0x11, 0x85, 0x11, 0x34, 0xCF, 0xC1, 0xB5, 0x2B, 0x30,
+    0x0A, 0x83, 0xFA, 0x48, 0xFC, 0xBE, 0x6C, 0xE4, 0x21, 0x1C, 0x84, 0xD8, 0xA3, 0xEB, 0x0C, 0x62,
+    0x09, 0xF7, 0x95, 0xD3, 0x47, 0xA2, 0x0D, 0x65, 0xCF, 0x68, 0x8D, 0x3D, 0x0C, 0x3B, 0x35, 0x03,
+    0xC3, 0x3F, 0x35, 0x00, 0x38, 0xAB, 0x73, 0xD6, 0xA3, 0x40, 0x5C, 0xB5, 0x30, 0xBF, 0xBF, 0xFF,
+    0x4A, 0x8B, 0x2F, 0x9B, 0xB2, 0x4A, 0x5B, 0x5D, 0x11, 0x68, 0xE8, 0x18, 0x23, 0xD8, 0x27, 0x7F,
+    0xE6, 0xF5, 0x2B, 0x21, 0xF0, 0x66, 0x3D, 0x22, 0xAB, 0x2D, 0xB6, 0xD6, 0x5E, 0xD7, 0x04, 0x75,
+    0x97, 0xF2, 0x05, 0xF1, 0xD2, 0x2C, 0x73, 0xEA, 0x27, 0x00, 0xB3, 0xD7, 0x8C, 0x3B, 0x36, 0x05,
+    0xE9, 0x86, 0x7D, 0x5C, 0x05, 0x7C, 0x6E, 0x37, 0x8F, 0x44, 0xD8, 0xB3, 0x5C, 0x95, 0x88, 0x33,
+    0xB7, 0xCB, 0x3C, 0x25, 0x75, 0x05, 0x99, 0x0A, 0x14, 0xC6, 0xAB, 0x90, 0x62, 0xF3, 0x82, 0xCE,
+    0xF4, 0x52, 0xC9, 0x72, 0x63, 0xD8, 0x4A, 0x4E, 0x12, 0x88, 0x0A, 0x96, 0x3B, 0xB7, 0x13, 0xA9,
+    0x56, 0x77, 0x5E, 0x5C, 0x5E, 0x10, 0x20, 0xEB, 0x9D, 0x7D, 0xBD, 0xD1, 0x3E, 0x25, 0x68, 0x3F,
+    0x22, 0x58, 0x8A, 0xE3, 0xB7, 0x17, 0xC9, 0xF0, 0xF3, 0x95, 0x8B, 0x9B, 0x56, 0xA4, 0x4A, 0xAE,
+    0x97, 0xAE, 0xA0, 0x33, 0xDE, 0xF8, 0x82, 0x99, 0xB9, 0x61, 0x7C, 0xF1, 0x5C, 0x6B, 0x6E, 0x08,
+    0x3B, 0x97, 0x2B, 0x23, 0x1D, 0x45, 0x54, 0x19, 0x6F, 0x0E, 0x60, 0x72, 0xD2, 0xBB, 0xD8, 0xE5,
+    0x86, 0x89, 0x9D, 0xA4, 0xB5, 0xBD, 0x74, 0x6A, 0xA1, 0xDA, 0xB8, 0xD2, 0x21, 0xC1, 0xF8, 0x19,
+    0xC9, 0x93, 0x81, 0x59, 0xEC, 0x9F, 0x0C, 0x49, 0xFC, 0x79, 0x3F, 0xB3, 0x93, 0x28, 0xD8, 0x10,
+    0xF7, 0xE2, 0x12, 0xE9, 0x98, 0xB1, 0x11, 0x05, 0x36, 0x97, 0x49, 0x77, 0x25, 0x15, 0x9F, 0xBD,
+    0xE8, 0x06, 0x2D, 0xAE, 0x3C, 0xFC, 0xC5, 0x74, 0xBA, 0x25, 0x22, 0x4F, 0xEF, 0x5E, 0xCC, 0xDF,
+    0xD5, 0x1F, 0x78, 0xDB, 0x45, 0x79, 0x0B, 0xE9, 0x01, 0x1E, 0x47, 0x79, 0x4C, 0x2A, 0x5D, 0x29,
+    0x61, 0x72, 0x7F, 0x93, 0xD0, 0x03, 0xA7, 0xAA, 0xCF, 0x33, 0xC9, 0x8F, 0x4D, 0xA7, 0xA7, 0x44,
+    0xFA, 0x78, 0xF7, 0x52, 0x95, 0x32, 0x56, 0x41, 0x55, 0x29, 0x27, 0x55, 0xC0, 0xA5, 0xF0, 0xA9,
+    0x37, 0x37, 0x63, 0x91, 0x61, 0x67, 0x21, 0x6F, 0xF9, 0x32, 0xBD, 0xD3, 0xD2, 0xBE, 0x83, 0xF2,
+    0xCE, 0x24, 0x7F, 0xBB, 0xF2, 0x9E, 0x4E, 0xA7, 0x5A, 0xA4, 0x8F, 0xFA, 0x8B, 0x8D, 0x0A, 0xAA,
+    0x32, 0xDE, 0x90, 0xF2, 0x10, 0xC5, 0xF0, 0x38, 0x23, 0x0B, 0x52, 0x11, 0x8A, 0xA8, 0x57, 0x81,
+    0xCE, 0xF8, 0xA8, 0x4D, 0xD1, 0x75, 0x81, 0x7D, 0x3E, 0x30, 0x49, 0x5B, 0xEE, 0x49, 0x88, 0x97,
+    0xEE, 0x4D, 0x03, 0x89, 0xE7, 0x78, 0x47, 0x34, 0xD8, 0xC3, 0x99, 0x88, 0x12, 0x09, 0xBA, 0xB6,
+    0x4C, 0xF8, 0x5D, 0x5D, 0xC3, 0xE4, 0xCB, 0x4E, 0x8B, 0xB8, 0x49, 0xD4, 0xE9, 0x5A, 0xD7, 0x13,
+    0x32, 0x5D, 0xAB, 0x50, 0xE6, 0x69, 0xB6, 0x50, 0x03, 0x9C, 0x41, 0x57, 0x30, 0x83, 0xC4, 0x71,
+    0xA6, 0x26, 0xBE, 0xC5, 0xAA, 0x5B, 0x99, 0xF2, 0xA8, 0x6E, 0xAC, 0xF8, 0xCC, 0x09, 0x73, 0x97,
+    0x55, 0x2A, 0x18, 0x9F, 0xC0, 0x9A, 0x0A, 0x16, 0xB4, 0x2F, 0x8C, 0x83, 0xAB, 0xA9, 0xF6, 0x60,
+    0xCD, 0x8D, 0x0A, 0x22, 0xB9, 0x17, 0x58, 0x5A, 0xD6, 0xCC, 0x52, 0xE3, 0x61, 0x62, 0x7C, 0x03,
+    0x99, 0x0A, 0x29, 0x24, 0xAE, 0xD0, 0xC3, 0xFE, 0x9A, 0x1D, 0x6C, 0x65, 0xBC, 0xAD, 0x6C, 0x6D,
+    0x7A, 0x16, 0x49, 0x6D, 0xC5, 0x27, 0x3F, 0x76, 0x7B, 0xE8, 0x9D, 0xA1, 0x4B, 0x03, 0xFC, 0x88,
+    0xBD, 0x2D, 0x67, 0x4F, 0x1C, 0x90, 0x25, 0x69, 0x24, 0xBE, 0x4B, 0xAF, 0xEF, 0x9C, 0xEA, 0xA2,
+    0x7A, 0x14, 0xE7, 0x5C, 0x19, 0x59, 0xD8, 0x18, 0xAD, 0xC1, 0xDA, 0xD6, 0x73, 0x90, 0x4A, 0x07,
+    0xB3, 0xD1, 0x18, 0xDA, 0x51, 0x42, 0x14, 0x46, 0x36, 0xD7, 0xF5, 0x28, 0xAE, 0xAC, 0x3F, 0xA7,
+    0x9B, 0xB9, 0x16, 0xDF, 0x1F, 0xDD, 0x6B, 0xE3, 0xC4, 0x7E, 0xF1, 0x49, 0x80, 0x87, 0xFE, 0x1F,
+    0xB5, 0x9B, 0x5D, 0x8C, 0x1D, 0xC7, 0x75, 0xE7, 0x7F, 0xDD, 0xC5, 0x61, 0x47, 0x2C, 0x9B, 0xC5,
+    0x07, 0x32, 0x96, 0x43, 0x91, 0xED, 0x07, 0x2D, 0xA0, 0x24, 0x9C, 0x69, 0x3F, 0x08, 0xC1, 0x64,
+    0xF7, 0xDE, 0xDB, 0x2D, 0xCD, 0x83, 0x1E, 0xFC, 0xA0, 0xC9, 0x7A, 0xDA, 0x7E, 0x10, 0x6C, 0x79,
+    0xB1, 0x8B, 0x85, 0x3F, 0xB0, 0x1E, 0x2F, 0x96, 0x59, 0x10, 0xC9, 0x1D, 0xDE, 0x96, 0x06, 0x58,
+    0x61, 0xE1, 0x07, 0xD3, 0x49, 0xBC, 0x2F, 0x06, 0xD6, 0xC4, 0xC6, 0x1B, 0xD8, 0xA3, 0x07, 0x12,
+    0xDE, 0x49, 0x76, 0x8C, 0xBD, 0x64, 0x17, 0x39, 0x58, 0x08, 0x58, 0x01, 0x61, 0xD1, 0x5A, 0xC3,
+    0xC0, 0x0A, 0x81, 0x5B, 0x12, 0x65, 0x39, 0x34, 0x10, 0x96, 0x9D, 0x56, 0xD4, 0x24, 0xFB, 0xF6,
+    0xD9, 0x87, 0xBE, 0x43, 0x0D, 0x65, 0xF9, 0x43, 0x89, 0xDD, 0x7D, 0x6F, 0xDF, 0xEA, 0xEA, 0xEE,
+    0xBA, 0xA7, 0x4E, 0x9D, 0x3A, 0x75, 0xFE, 0xE7, 0x9C, 0xE6, 0xB3, 0xE7, 0x28, 0xC5, 0x19, 0x37,
+    0xC1, 0xD3, 0x1C, 0xC6, 0x14, 0x8E, 0x06, 0x62, 0x50, 0x15, 0x69, 0x8B, 0x12, 0x0F, 0x13, 0x0B,
+    0x2D, 0x44, 0x2E, 0x63, 0x63, 0x88, 0xDE, 0xF5, 0x41, 0x9B, 0xFC, 0xA0, 0xA4, 0x94, 0x82, 0x0F,
+    0x58, 0x38, 0x05, 0xCA, 0x62, 0x5A, 0xB8, 0xCC, 0x7C, 0xD3, 0xF2, 0xD8, 0x1D, 0x39, 0xC4, 0x06,
+    0xD4, 0x28, 0xBB, 0x30, 0x25, 0x6D, 0x08, 0x1A, 0xC2, 0x1F, 0x67, 0xFA, 0x1A, 0xA3, 0xF4, 0xAB,
+    0x3E, 0xED, 0x38, 0x68, 0x89, 0xB2, 0xE0, 0x14, 0x71, 0xC5, 0x6F, 0x43, 0xBE, 0xC6, 0xA7, 0x52,
+    0xA1, 0x0C, 0x66, 0x4C, 0x6C, 0xC2, 0x10, 0x6D, 0x97, 0x08, 0xBD, 0x81, 0xA9, 0xCE, 0x48, 0x54,
+    0x81, 0xBE, 0x65, 0x09, 0xA5, 0x81, 0x69, 0x9C, 0x91, 0x28, 0x8F, 0xB6, 0x67, 0x09, 0xBD, 0x76,
+    0x4C, 0x69, 0x49, 0x88, 0x6D, 0xD2, 0x84, 0x6D, 0x2A, 0x24, 0x16, 0x82, 0x1A, 0x18, 0x02, 0x06,
+    0x08, 0x2D, 0xF0, 0x85, 0x3D, 0xDA, 0xC4, 0xC7, 0x8F, 0x4B, 0x36, 0xA3, 0x36, 0x28, 0xB7, 0x8D,
+    0x59, 0x29, 0x18, 0x8D, 0x41, 0x3C, 0xEA, 0x3B, 0x1E, 0xB3, 0xE2, 0x18, 0x46, 0x96, 0xDA, 0x58,
+    0x5D, 0x9B, 0x42, 0x7C, 0xEC, 0xC0, 0x64, 0x30, 0x00, 0x2E, 0x42, 0x60, 0x21, 0x20, 0x5F, 0xE3,
+    0x41, 0x23, 0xD6, 0x54, 0xB1, 0x0B, 0x3B, 0xA6, 0x0C, 0xD0, 0x56, 0x67, 0x4C, 0xCF, 0x7B, 0xF4,
+    0x8B, 0x27, 0x60, 0xFA, 0x3F, 0x2C, 0xFA, 0x56, 0x03, 0x97, 0xC5, 0xA2, 0x5F, 0x1C, 0xC1, 0xF4,
+    0x5B, 0x1E, 0xFD, 0xA2, 0x29, 0x98, 0x72, 0x09, 0x6D, 0x95, 0x67, 0x4A, 0x6C, 0x93, 0x1F, 0x72,
+    0xD9, 0x88, 0x55, 0x2D, 0xB0, 0xD0, 0x53, 0x57, 0x99, 0xAB, 0x92, 0x95, 0xD4, 0xAA, 0x50, 0xDF,
+    0x3D, 0x85, 0xF9, 0x74, 0xC5, 0xF0, 0x7F, 0x81, 0xCC, 0x50, 0xFF, 0x6F, 0x8C, 0xF9, 0x74, 0xCD,
+    0xF0, 0x5F, 0x7A, 0x6A, 0x55, 0xE9, 0x1B, 0x91, 0x13, 0xAF, 0x1D, 0x04, 0x1C, 0xCB, 0x79, 0x50,
+    0x89, 0xD7, 0x3E, 0xAA, 0x03, 0x21, 0x61, 0xC8, 0xEF, 0xDE, 0xD1, 0x85, 0x12, 0xEF, 0x09, 0xFD,
+    0x22, 0x24, 0xAA, 0x20, 0xBC, 0xEB, 0x21, 0x91, 0x82, 0xD0, 0x6F, 0x40, 0xA2, 0x3C, 0xA1, 0x8F,
+    0x0B, 0x12, 0x2E, 0x11, 0x7A, 0xE5, 0x49, 0x88, 0xAD, 0xEE, 0x28, 0x95, 0xF8, 0xB0, 0x05, 0x16,
+    0xB2, 0x83, 0x05, 0x51, 0x0B, 0xC7, 0x2D, 0x0C, 0x40, 0x59, 0x22, 0xB1, 0xED, 0xE7, 0x7E, 0x98,
+    0xDA, 0x81, 0x2E, 0x94, 0xAD, 0x18, 0x0C, 0x50, 0xDF, 0x2B, 0x48, 0x1B, 0xD4, 0x0B, 0x96, 0x41,
+    0x82, 0xB2, 0x35, 0x03, 0xED, 0x8E, 0xDF, 0x48, 0x23, 0xB1, 0x33, 0x08, 0xB2, 0x63, 0xF9, 0x1A,
+    0x9F, 0x32, 0x22, 0x59, 0xA9, 0x6E, 0x5E, 0x66, 0x62, 0x7D, 0x9C, 0x0D, 0x19, 0x44, 0x6E, 0x89,
+    0x07, 0x82, 0xDA, 0x00, 0x1B, 0x3A, 0x83, 0x78, 0xC5, 0x42, 0x24, 0x0E, 0x02, 0x69, 0x80, 0x8D,
+    0x38, 0x83, 0xF8, 0x71, 0x0F, 0x91, 0x1B, 0x41, 0x50, 0x6B, 0x07, 0x1B, 0xB4, 0x10, 0x67, 0xB1,
+    0x25, 0x6E, 0xC2, 0x96, 0xA4, 0x1F, 0x67, 0x58, 0x05, 0x30, 0x52, 0xC7, 0x2B, 0xD2, 0xC4, 0xCE,
+    0xEF, 0x18, 0x96, 0x97, 0x74, 0x76, 0x58, 0x6F, 0x16, 0x84, 0x6F, 0x59, 0x28, 0x3D, 0x2C, 0x25,
+    0xA0, 0x37, 0x1D, 0x61, 0x35, 0x85, 0x1D, 0x63, 0x99, 0x3C, 0xD6, 0x50, 0xD6, 0xB1, 0x05, 0xB2,
+    0x7C, 0x8D, 0x7C, 0x4D, 0xDA, 0x40, 0x9A, 0xD8, 0xF1, 0x74, 0xA1, 0x2D, 0xE6, 0xDD, 0x0F, 0x22,
+    0x32, 0x3F, 0xFC, 0xCC, 0x5B, 0x2C, 0xA6, 0x48, 0x1A, 0xD6, 0x7F, 0x28, 0x6D, 0x20, 0x2D, 0xC0,
+    0x14, 0x60, 0x7C, 0xEF, 0xB0, 0x0C, 0xF0, 0x28, 0x00, 0x69, 0x6B, 0xE4, 0x23, 0x5D, 0x28, 0xD9,
+    0x08, 0x93, 0x99, 0x42, 0x39, 0x55, 0x51, 0x73, 0x3B, 0xDF, 0x20, 0x15, 0xC9, 0xCC, 0x57, 0x3E,
+    0xDE, 0x57, 0x34, 0x0C, 0x19, 0x61, 0xB2, 0xA4, 0xD2, 0xB7, 0xD3, 0x99, 0x11, 0x0B, 0x61, 0x05,
+    0x9C, 0x01, 0x4E, 0x00, 0x2A, 0xDB, 0xEB, 0x44, 0xFE, 0x51, 0xF1, 0x91, 0xC8, 0xF5, 0x19, 0x0B,
+    0xDD, 0x85, 0xD0, 0xA3, 0xAA, 0x81, 0xB6, 0x98, 0xC2, 0x27, 0x30, 0x0A, 0xB3, 0x29, 0x34, 0x84,
+    0x1E, 0x55, 0xA1, 0x45, 0xA4, 0x20, 0x11, 0xE9, 0x60, 0x7F, 0xB5, 0xC5, 0x14, 0x24, 0x30, 0xBA,
+    0xAF, 0x3A, 0x69, 0x58, 0xBF, 0xA1, 0xC4, 0x47, 0x52, 0x91, 0xB6, 0x46, 0x9A, 0xB2, 0x4A, 0xA4,
+    0x1A, 0x61, 0x56, 0x8A, 0x86, 0xE1, 0x61, 0x55, 0x51, 0x3F, 0x6A, 0xBE, 0xF2, 0x71, 0x47, 0x2A,
+    0x92, 0x71, 0x3B, 0xDF, 0x40, 0x55, 0xD4, 0x98, 0x42, 0x39, 0x46, 0x98, 0x2C, 0xEC, 0x28, 0x8B,
+    0x74, 0x66, 0x24, 0xCB, 0xF3, 0x3C, 0xCF, 0x48, 0x45, 0xC4, 0x13, 0x74, 0x5B, 0x17, 0x1C, 0x24,
+    0x84, 0x1E, 0xB4, 0x65, 0x0A, 0xA1, 0x27, 0x01, 0xA6, 0x68, 0xBB, 0xEF, 0x42, 0x29, 0x45, 0xE8,
+    0x49, 0x64, 0xC6, 0x14, 0x6D, 0x13, 0x9B, 0x10, 0xFA, 0xA0, 0xD1, 0x96, 0x29, 0x69, 0xE8, 0x49,
+    0xD0, 0x76, 0x8A, 0xB6, 0x81, 0x4F, 0x08, 0x3D, 0xE3, 0xA4, 0x09, 0xBB, 0x22, 0x49, 0x45, 0x89,
+    0xD7, 0x16, 0x40, 0x39, 0x80, 0xD0, 0x03, 0x84, 0x35, 0xC0, 0x53, 0x35, 0x40, 0x52, 0xCD, 0x15,
+    0x42, 0x2A, 0x22, 0x50, 0x8A, 0xD4, 0x30, 0x22, 0x06, 0x1A, 0xC6, 0xA0, 0xAA, 0xC0, 0x83, 0x29,
+    0xA2, 0xEF, 0xCF, 0x18, 0x11, 0x4B, 0x47, 0xC3, 0x59, 0x5A, 0x55, 0x05, 0x3E, 0x68, 0x4C, 0x11,
+    0x59, 0x55, 0x8D, 0x88, 0x31, 0x57, 0xBB, 0xA0, 0xCB, 0x92, 0x74, 0x66, 0x84, 0x06, 0x40, 0x55,
+    0xCC, 0xF5, 0xCE, 0x7C, 0xF4, 0xB5, 0x05, 0x0E, 0xCD, 0x00, 0xE2, 0x02, 0x82, 0xAF, 0x43, 0xD0,
+    0x15, 0x90, 0x14, 0x93, 0x22, 0xAC, 0xF5, 0x2D, 0x1B, 0x67, 0x53, 0x93, 0xB5, 0xCA, 0x25, 0xCA,
+    0xC5, 0x8C, 0x13, 0xA6, 0x81, 0x9F, 0x86, 0x5E, 0xED, 0x7A, 0x6D, 0x63, 0x63, 0x13, 0xC6, 0x09,
+    0xE3, 0xD0, 0x6F, 0xE0, 0x4D, 0xD6, 0xAA, 0x6A, 0x10, 0xD6, 0xD1, 0xAE, 0x53, 0xB5, 0xFE, 0x3B,
+    0x54, 0xF7, 0x74, 0x7D, 0x34, 0x90, 0x3B, 0xE2, 0x38, 0xC0, 0x11, 0x00, 0xA2, 0x06, 0x76, 0x62,
+    0xA7, 0x9F, 0x7D, 0xC3, 0x0D, 0x4C, 0x74, 0xB5, 0xDA, 0x31, 0xE6, 0x71, 0x37, 0x1C, 0x9A, 0xAC,
+    0xAE, 0x17, 0xD5, 0x6E, 0xB5, 0x63, 0xF4, 0x15, 0xBF, 0x6D, 0x9E, 0x7D, 0xC3, 0xC6, 0x7F, 0xDA,
+    0x12, 0x8B, 0xD8, 0x60, 0x75, 0x0D, 0x16, 0xFE, 0x3B, 0x91, 0xB4, 0xEA, 0xF6, 0xD3, 0xB6, 0x65,
+    0x10, 0xA3, 0x76, 0x2B, 0x4E, 0x6D, 0xF4, 0x94, 0x4F, 0xC1, 0xF4, 0xFA, 0x5F, 0x5B, 0xB8, 0x04,
+    0x91, 0x87, 0xB4, 0x20, 0x90, 0xEC, 0x60, 0x24, 0x52, 0x69, 0x69, 0x50, 0x0E, 0x4E, 0xC1, 0xCA,
+    0x3B, 0x56, 0x81, 0x48, 0xB2, 0xCB, 0xE5, 0x47, 0xEC, 0x68, 0xC0, 0x5F, 0x79, 0x4C, 0xC1, 0x08,
+    0x1A, 0x94, 0x47, 0x3B, 0x62, 0x47, 0x22, 0x6D, 0x2C, 0x36, 0x74, 0xFB, 0x57, 0x81, 0x63, 0x79,
+    0x9E, 0x1B, 0x11, 0xD9, 0xBD, 0x59, 0x6E, 0x79, 0x6F, 0x8A, 0xC1, 0x40, 0x55, 0xE6, 0x01, 0x9A,
+    0x30, 0x63, 0x04, 0x98, 0x62, 0xCE, 0xDE, 0x06, 0x7E, 0x76, 0xC5, 0xF1, 0x0E, 0x52, 0xA9, 0x80,
+    0x9F, 0xB1, 0x08, 0xA4, 0x22, 0xBB, 0x22, 0xED, 0x20, 0x56, 0xBB, 0xCF, 0xF8, 0xC1, 0x72, 0x1C,
+    0x16, 0x81, 0x87, 0x18, 0xEE, 0xFF, 0x89, 0xBA, 0x4C, 0x49, 0x0B, 0x91, 0x85, 0x31, 0xA8, 0x02,
+    0x1E, 0x85, 0x80, 0x63, 0x6B, 0x41, 0xBE, 0x2E, 0xCF, 0xC8, 0x2B, 0x1D, 0xDA, 0x19, 0xAB, 0x5C,
+    0x58, 0x07, 0x9E, 0x94, 0x9A, 0xC8, 0xED, 0x40, 0x3B, 0x00, 0xF3, 0x79, 0x08, 0x05, 0x48, 0xB3,
+    0x9E, 0x6F, 0xA1, 0x9F, 0x4B, 0x43, 0x32, 0x17, 0x88, 0xE3, 0x5D, 0x46, 0x2C, 0x15, 0x93, 0x26,
+    0x69, 0xE4, 0xDC, 0xBA, 0x6B, 0x18, 0x86, 0x3E, 0xF0, 0xCA, 0x99, 0x4C, 0xDB, 0x01, 0x71, 0x58,
+    0x31, 0x32, 0x30, 0x3E, 0x03, 0x6F, 0x59, 0xC2, 0x0E, 0x54, 0xDD, 0x8F, 0xC4, 0x12, 0xB0, 0xD3,
+    0x2B, 0x01, 0x5D, 0x10, 0x48, 0xC5, 0xA1, 0xAD, 0xEC, 0x1D, 0x44, 0x15, 0xCA, 0x85, 0x3E, 0xF0,
+    0xA4, 0x78, 0x22, 0x77, 0x66, 0x4E, 0xD4, 0x27, 0x7B, 0xA2, 0x0E, 0x95, 0x7F, 0x4B, 0x24, 0x52,
+    0xBC, 0x67, 0xA2, 0x4C, 0xE8, 0x18, 0xCE, 0x89, 0xFA, 0x89, 0x25, 0xFC, 0x3B, 0x88, 0x6A, 0x02,
+    0xE9, 0x08, 0xD6, 0x57, 0xEF, 0x27, 0xCA, 0xF5, 0x44, 0xE5, 0xE4, 0x99, 0xB4, 0x5A, 0xB2, 0x49,
+    0x16, 0x55, 0x4C, 0x18, 0xC1, 0xA5, 0xD0, 0x43, 0x1B, 0x43, 0xD0, 0xD6, 0x10, 0x4A, 0x01, 0xAA,
+    0x05, 0xB4, 0x07, 0x26, 0x15, 0xA8, 0x17, 0x1D, 0x0C, 0x8D, 0x25, 0xAC, 0x8C, 0x25, 0x26, 0x29,
+    0xA8, 0x49, 0xB3, 0xE4, 0x46, 0x20, 0x7F, 0x2E, 0x3E, 0x11, 0x3B, 0x27, 0x98, 0x29, 0x10, 0x54,
+    0x7B, 0x2A, 0xF0, 0xFD, 0xFD, 0xD0, 0x36, 0x69, 0x2D, 0xAE, 0x2C, 0xCE, 0x52, 0xB3, 0x61, 0x32,
+    0xA6, 0xDB, 0x50, 0x16, 0xBD, 0xF9, 0xD2, 0xC0, 0xA0, 0x41, 0x5D, 0xA9, 0x19, 0x86, 0x3E, 0xAA,
+    0xA3, 0xA6, 0xAC, 0xCB, 0xA6, 0xD7, 0x0F, 0x3A, 0x83, 0x53, 0x73, 0xF9, 0xC8, 0x8E, 0xE5, 0x79,
+    0x90, 0x67, 0x22, 0x9D, 0x91, 0xCD, 0x37, 0xDE, 0xAC, 0xA3, 0xCA, 0xE8, 0xAB, 0xCE, 0x64, 0xCB,
+    0x49, 0xC4, 0x90, 0x73, 0xD3, 0x07, 0xA9, 0x09, 0x3D, 0xCA, 0xA1, 0x2D, 0x26, 0x23, 0x81, 0x21,
+    0x4C, 0xF9, 0xE5, 0xAA, 0x4B, 0x11, 0x39, 0x6F, 0x44, 0x44, 0x2C, 0x7B, 0x1D, 0xE9, 0xD5, 0x44,
+    0x50, 0xB1, 0xD7, 0x97, 0x79, 0x67, 0x48, 0xA5, 0x4D, 0x6B, 0x11, 0x2F, 0x9B, 0xCF, 0xED, 0xDA,
+    0xFA, 0xFD, 0xB1, 0x56, 0xEE, 0x43, 0xE3, 0xA3, 0x26, 0x0B, 0x3C, 0x43, 0x22, 0x4B, 0x4D, 0x8C,
+    0x72, 0x8C, 0xD9, 0x5F, 0x35, 0xB9, 0x79, 0xE1, 0x76, 0x24, 0x22, 0xED, 0x9E, 0xD6, 0x8B, 0x0A,
+    0xE0, 0xF0, 0xBD, 0x85, 0x27, 0x3B, 0xB6, 0xB6, 0x90, 0x3F, 0x21, 0x4E, 0x9A, 0xE3, 0xD5, 0xC1,
+    0x86, 0x21, 0x26, 0x53, 0x8E, 0xFA, 0xED, 0xC2, 0x08, 0x93, 0xA9, 0x9A, 0x9A, 0xF8, 0x4E, 0x99,
+    0x31, 0x91, 0x1A, 0x72, 0x93, 0xCD, 0xA7, 0xD3, 0x7D, 0x85, 0xA8, 0x2B, 0x50, 0xD2, 0xEE, 0xE9,
+    0xB8, 0xE9, 0xDE, 0x9F, 0x2D, 0xDF, 0xEB, 0x48, 0xE9, 0xCB, 0x9F, 0xC8, 0xB3, 0x92, 0x35, 0x81,
+    0x57, 0x55, 0x64, 0x4D, 0x11, 0x93, 0x30, 0x66, 0xF2, 0x31, 0xCF, 0x44, 0x2C, 0x0B, 0x71, 0xBF,
+    0x30, 0x06, 0x1E, 0x8E, 0xDF, 0xEE, 0xCD, 0x3B, 0x55, 0xF5, 0xE3, 0x71, 0x02, 0xF8, 0xF0, 0x1E,
+    0xBD, 0x4F, 0xCB, 0x8A, 0xBC, 0x72, 0x99, 0xF5, 0xC2, 0x64, 0xCA, 0x29, 0x47, 0x4D, 0xCD, 0x90,
+    0xE1, 0x01, 0x93, 0x99, 0xCD, 0x4D, 0xA7, 0xEA, 0xAA, 0x66, 0xD2, 0xCD, 0x88, 0x44, 0x32, 0x3E,
+    0xB0, 0xE9, 0xA0, 0xAA, 0x61, 0x79, 0x38, 0xA7, 0x53, 0x39, 0x88, 0xBA, 0x0C, 0x23, 0xD5, 0x3B,
+    0x09, 0x7A, 0x26, 0x26, 0x39, 0x35, 0x66, 0xF2, 0x57, 0x3D, 0x41, 0x3A, 0x86, 0x53, 0x7B, 0x04,
+    0x35, 0x84, 0xE2, 0xF3, 0x35, 0x48, 0x05, 0x82, 0xD9, 0xBE, 0x89, 0xF2, 0xF6, 0xCC, 0x59, 0x6F,
+    0xD0, 0x22, 0x2E, 0xAC, 0x83, 0x96, 0x29, 0x09, 0x09, 0x91, 0xD3, 0x36, 0xA8, 0x43, 0xCF, 0x06,
+    0x53, 0xE2, 0x2C, 0x21, 0x72, 0xC9, 0x0F, 0xA3, 0x2E, 0x95, 0x48, 0x2C, 0x19, 0x98, 0x1A, 0xA2,
+    0xD9, 0x3E, 0xCA, 0xDE, 0x56, 0x53, 0xF1, 0x0C, 0x75, 0x4B, 0x2C, 0x5D, 0xD8, 0x30, 0x24, 0xC5,
+    0x64, 0xDA, 0x2A, 0x17, 0x7A, 0x6A, 0xA6, 0x0C, 0x49, 0xEE, 0xAB, 0x08, 0xCA, 0x62, 0xF2, 0x65,
+    0xF1, 0x93, 0x16, 0x0E, 0x7E, 0x13, 0x28, 0xC5, 0xA2, 0x6E, 0x1F, 0xF7, 0x18, 0x1B, 0x36, 0xBF,
+    0x11, 0x67, 0xB4, 0x83, 0x14, 0xA6, 0xCB, 0x43, 0x98, 0x6E, 0x5C, 0x82, 0x69, 0x2A, 0x22, 0xED,
+    0xA1, 0x6E, 0x6B, 0xEB, 0x1B, 0xBD, 0xC0, 0x6D, 0x00, 0x9C, 0x05, 0x48, 0x01, 0x92, 0x02, 0x30,
+    0x35, 0x9F, 0x46, 0x89, 0xD4, 0x50, 0x8A, 0x83, 0x60, 0xB5, 0x97, 0x44, 0xD3, 0x11, 0x74, 0xE5,
+    0x82, 0xC9, 0x36, 0x96, 0x77, 0xB8, 0xFD, 0x9A, 0x0B, 0x5F, 0x13, 0x91, 0xE7, 0x44, 0x66, 0xF8,
+    0xBE, 0x13, 0xC6, 0xF6, 0x2D, 0xA4, 0x52, 0x93, 0x48, 0xC1, 0xC2, 0x2A, 0xBF, 0x4E, 0xBA, 0x54,
+    0xB5, 0xB7, 0xD2, 0x86, 0x6E, 0x4F, 0xB9, 0x63, 0x79, 0x7B, 0x7B, 0xCF, 0x04, 0x6B, 0x0B, 0x27,
+    0xE7, 0xB2, 0x5B, 0x41, 0x98, 0x91, 0xAF, 0xC9, 0x2C, 0x76, 0xDA, 0xFE, 0xAC, 0x3D, 0x69, 0x64,
+    0x06, 0x47, 0x02, 0x80, 0x21, 0x1E, 0x30, 0x76, 0x0A, 0x20, 0x33, 0x80, 0x60, 0xED, 0x1E, 0x31,
+    0xFF, 0x86, 0x7C, 0x35, 0xCC, 0xD2, 0x4C, 0x5A, 0x55, 0x1B, 0x1F, 0xD5, 0x6A, 0x46, 0xC2, 0x34,
+    0xF0, 0x84, 0x2E, 0xC1, 0xC3, 0x40, 0xDB, 0x6D, 0xD0, 0x8F, 0xFB, 0x01, 0xE0, 0xA7, 0x8B, 0x40,
+    0x2C, 0x25, 0x60, 0x44, 0x2C, 0x44, 0x57, 0xFD, 0x14, 0x54, 0x35, 0x35, 0x19, 0xCA, 0x27, 0xA1,
+    0x27, 0xA8, 0xB5, 0x4D, 0xA1, 0x0D, 0xBD, 0xAE, 0x98, 0x31, 0x65, 0x46, 0x47, 0x59, 0x99, 0xEB,
+    0x1D, 0xD2, 0x06, 0xDD, 0x51, 0x7A, 0x3C, 0x71, 0x88, 0xF3, 0x10, 0x53, 0x83, 0x79, 0xD6, 0x43,
+    0x28, 0xFB, 0x39, 0x94, 0x04, 0x62, 0xDB, 0xE4, 0xCA, 0xE5, 0x95, 0x36, 0xA8, 0x06, 0x51, 0xC1,
+    0xC5, 0x81, 0x81, 0xE5, 0xC1, 0x22, 0x2C, 0x6E, 0x9C, 0x81, 0x44, 0x5A, 0x18, 0x0F, 0x86, 0xD0,
+    0x0C, 0x62, 0x02, 0x3F, 0x30, 0x85, 0xAA, 0x06, 0x91, 0x33, 0xF6, 0x6C, 0xE8, 0x27, 0x4A, 0xEC,
+    0xEC, 0x28, 0x70, 0x20, 0x5F, 0xE3, 0x11, 0x69, 0x83, 0x2E, 0x76, 0x51, 0xA7, 0xAD, 0xC9, 0xB4,
+    0x1D, 0xA2, 0xED, 0x0E, 0xFA, 0x8A, 0x47, 0xEF, 0x3A, 0xB4, 0xCC, 0xD0, 0x22, 0x56, 0xDB, 0xD8,
+    0x6B, 0xAB, 0x6A, 0x6D, 0x69, 0xB4, 0xA5, 0xDD, 0xFB, 0x26, 0x0D, 0x8D, 0xB4, 0xD4, 0xFD, 0x9C,
+    0x8A, 0x2A, 0x88, 0x2D, 0xBF, 0xD9, 0x41, 0x7C, 0x63, 0x8F, 0x50, 0x25, 0x76, 0x23, 0xA9, 0x63,
+    0x37, 0x54, 0x56, 0xB9, 0x8B, 0x0C, 0x0F, 0xA3, 0xDE, 0x70, 0xA4, 0xE2, 0xD4, 0xEB, 0x65, 0x36,
+    0xA4, 0x55, 0x2E, 0x72, 0x43, 0x46, 0xBA, 0x56, 0xAF, 0x89, 0x1D, 0xF6, 0xA3, 0x3B, 0x06, 0x53,
+    0x10, 0x7A, 0x74, 0x6F, 0x90, 0xE4, 0x79, 0x9E, 0x19, 0x91, 0x19, 0xF1, 0xCD, 0x0E, 0xB6, 0x23,
+    0x8B, 0xCE, 0xC6, 0x7D, 0xC1, 0x30, 0x06, 0xBF, 0xBF, 0x70, 0x92, 0x31, 0xA1, 0x8B, 0x2C, 0x03,
+    0xC6, 0x44, 0x36, 0xB2, 0xD4, 0x8C, 0xA3, 0x75, 0x22, 0x5B, 0xDA, 0x40, 0xBE, 0x5A, 0x23, 0xDD,
+    0x51, 0x50, 0xB6, 0x5F, 0x88, 0x7B, 0x53, 0xAF, 0x02, 0x1E, 0x9A, 0x93, 0x2B, 0xB5, 0x11, 0x29,
+    0x94, 0xAD, 0x39, 0xAC, 0x1C, 0xCB, 0x26, 0xA3, 0x1A, 0x12, 0x65, 0x35, 0xA7, 0x94, 0xC3, 0x9B,
+    0x2C, 0x2A, 0x86, 0xE1, 0x98, 0x3A, 0xA9, 0xF4, 0xED, 0xCB, 0x48, 0x93, 0xA1, 0x1C, 0xC4, 0xC0,
+    0x76, 0x6F, 0x65, 0x1C, 0x20, 0x5F, 0x23, 0xFF, 0xB8, 0xF8, 0x48, 0x5E, 0x99, 0xB1, 0xD0, 0x84,
+    0x1E, 0x55, 0xF5, 0xD8, 0x02, 0x46, 0x4C, 0x61, 0x5E, 0x25, 0x22, 0x45, 0x22, 0xD2, 0xED, 0xAB,
+    0xFA, 0xE9, 0xBB, 0x92, 0x06, 0xB3, 0x22, 0x9E, 0x21, 0xBD, 0x5A, 0xC3, 0x14, 0xBD, 0xF2, 0x0A,
+    0x2E, 0x38, 0xD0, 0x0D, 0xF7, 0xA1, 0x91, 0xE2, 0x97, 0x45, 0x23, 0xCA, 0xA6, 0xB3, 0xC0, 0xCF,
+    0x71, 0x4D, 0x32, 0x57, 0x67, 0xC6, 0x42, 0x69, 0x21, 0xC9, 0x7E, 0xD5, 0x5D, 0x58, 0x7F, 0x43,
+    0x7C, 0x24, 0xF7, 0xC8, 0x1F, 0x30, 0x87, 0x41, 0xE6, 0x9F, 0x02, 0xA8, 0x9A, 0x74, 0x66, 0xA4,
+    0xE8, 0x87, 0x32, 0xA8, 0x7A, 0x80, 0xCF, 0x32, 0x70, 0x80, 0x9F, 0xB3, 0xE8, 0xEC, 0xB5, 0x5E,
+    0x53, 0x33, 0xB9, 0x39, 0x5F, 0x74, 0x8E, 0xAD, 0xDC, 0xA7, 0xC9, 0xEF, 0x5F, 0x74, 0xDE, 0x56,
+    0xF3, 0x03, 0x40, 0xD3, 0xBB, 0x11, 0xDE, 0xDB, 0xF2, 0x18, 0x37, 0x28, 0xF1, 0xE8, 0xA2, 0xB7,
+    0x00, 0x4F, 0x03, 0x0E, 0x02, 0x58, 0x58, 0x83, 0x9C, 0xB4, 0xC1, 0x74, 0x24, 0x9E, 0xD4, 0x31,
+    0xB1, 0x61, 0x47, 0x70, 0x2B, 0x33, 0x63, 0xA2, 0x75, 0x7E, 0xDF, 0xB3, 0x38, 0x0E, 0xBF, 0x67,
+    0xB9, 0x58, 0x1B, 0x83, 0xBA, 0x5A, 0x2D, 0x0F, 0x30, 0xD1, 0x55, 0x5B, 0x33, 0x30, 0x4F, 0x2A,
+    0x87, 0x5F, 0x3A, 0x63, 0x32, 0x65, 0x47, 0x76, 0x44, 0x8C, 0xB0, 0xC3, 0x99, 0xB0, 0x0E, 0x7D,
+    0x50, 0x29, 0xAB, 0x6D, 0x72, 0x63, 0x81, 0xF2, 0x35, 0xF1, 0x98, 0xFD, 0xE6, 0x4A, 0x0D, 0xBD,
+    0x55, 0xDC, 0x1B, 0x4D, 0xBD, 0xF0, 0x03, 0x13, 0x4B, 0xF9, 0x6C, 0x87, 0xA9, 0x8D, 0x0F, 0x67,
+    0xDC, 0x2D, 0xFE, 0x85, 0x33, 0x03, 0x3D, 0xE4, 0x27, 0xEE, 0x35, 0x67, 0xE2, 0x53, 0x43, 0xFC,
+    0x5B, 0x9B, 0xCE, 0x44, 0x7E, 0x88, 0x1F, 0x29, 0x67, 0x02, 0x3B, 0x0C, 0x6F, 0x13, 0x35, 0xE2,
+    0x95, 0x54, 0x73, 0xD6, 0x44, 0xC5, 0x7C, 0x10, 0x0E, 0x03, 0x64, 0x50, 0x76, 0xBF, 0x7B, 0x43,
+    0xB9, 0x9F, 0xB7, 0x1F, 0xBF, 0x5D, 0x76, 0x1C, 0x21, 0x23, 0xAC, 0x4C, 0x46, 0xE4, 0x36, 0x40,
+    0x4B, 0xB5, 0x5F, 0xFD, 0x06, 0xD9, 0x7C, 0x29, 0x09, 0x66, 0xCC, 0x05, 0x7E, 0xE8, 0x21, 0x7C,
+    0xC9, 0x81, 0x31, 0x16, 0xCE, 0xC4, 0xA0, 0xDC, 0x08, 0x62, 0xA6, 0xF0, 0xED, 0x8F, 0xD5, 0x28,
+    0x91, 0x8A, 0x64, 0xEB, 0x82, 0xA5, 0x26, 0xCE, 0x22, 0x4B, 0xCA, 0x08, 0xA6, 0x61, 0x87, 0xEE,
+    0xD2, 0x19, 0x32, 0x7B, 0x28, 0x70, 0x26, 0xDB, 0x09, 0xEB, 0x0D, 0x92, 0xD9, 0xDE, 0xFF, 0xAC,
+    0x37, 0x5C, 0xBE, 0x50, 0x0C, 0x95, 0x37, 0x8C, 0x21, 0x06, 0x6D, 0x0F, 0x8A, 0xD7, 0x77, 0xA6,
+    0xDA, 0xC6, 0xA1, 0x8F, 0xEC, 0x54, 0xF9, 0xF8, 0x47, 0xF2, 0xAA, 0x7C, 0xD1, 0x2F, 0x00, 0x8B,
+    0x51, 0x41, 0xD0, 0xA6, 0x19, 0xAA, 0x6A, 0xD9, 0xBF, 0xAD, 0xD2, 0xCF, 0x23, 0x26, 0x19, 0x84,
+    0x1D, 0x60, 0xC6, 0xC0, 0x76, 0x0D, 0x6A, 0xD7, 0xC3, 0xC9, 0xC8, 0x42, 0x6D, 0x0A, 0x22, 0x9B,
+    0xC0, 0x52, 0x7E, 0x09, 0x44, 0x1A, 0xF4, 0xCD, 0xE7, 0x3D, 0x43, 0x22, 0x17, 0x78, 0x8C, 0x35,
+    0x05, 0x09, 0x65, 0x11, 0xCA, 0x97, 0x24, 0x4B, 0x25, 0x7B, 0x20, 0x28, 0xCC, 0x95, 0x26, 0xF4,
+    0x67, 0x39, 0xB2, 0xF0, 0x8F, 0x23, 0x97, 0x63, 0x79, 0xBE, 0x0A, 0xA9, 0x48, 0x03, 0x51, 0xB7,
+    0xD5, 0x80, 0x19, 0xB3, 0x0C, 0x27, 0xC7, 0x2C, 0xC3, 0x60, 0x0C, 0xB0, 0x3D, 0x06, 0xF0, 0x63,
+    0x20, 0x74, 0x67, 0x2F, 0x58, 0x22, 0x3B, 0x11, 0x8B, 0xC9, 0x2F, 0x01, 0xB1, 0xB4, 0xC0, 0x30,
+    0x9F, 0x02, 0x3B, 0x8C, 0x79, 0x1F, 0x9E, 0x31, 0x8B, 0xAA, 0x62, 0xCC, 0x40, 0xDF, 0x08, 0x44,
+    0xDA, 0x74, 0xA6, 0x7B, 0xBB, 0x15, 0x8E, 0xCF, 0xF4, 0x2C, 0xBC, 0x73, 0xE9, 0xCE, 0xCC, 0x64,
+    0x92, 0xB5, 0x83, 0xA0, 0x09, 0x3C, 0x91, 0x8B, 0x1C, 0xEB, 0x22, 0x81, 0xC8, 0xCD, 0xB5, 0xE4,
+    0xCB, 0x9E, 0xD0, 0x47, 0xF6, 0xED, 0xCE, 0x1E, 0x98, 0x5C, 0x28, 0xC5, 0x97, 0x75, 0x22, 0xD9,
+    0x51, 0x16, 0x32, 0x02, 0x8E, 0xB2, 0xA3, 0x9C, 0x76, 0x1B, 0x24, 0x52, 0x70, 0x2C, 0x03, 0xC8,
+    0xF3, 0xFC, 0x49, 0x91, 0x36, 0xBE, 0xF9, 0xBC, 0x9D, 0x72, 0x4A, 0xDB, 0xC0, 0x4E, 0xEF, 0xE1,
+    0x5C, 0x7D, 0xB3, 0xA3, 0x94, 0x6A, 0xEF, 0xCC, 0xC2, 0x94, 0x43, 0xDA, 0xE2, 0xA7, 0x9C, 0x4C,
+    0x44, 0x6E, 0x89, 0xCC, 0x0E, 0x71, 0x7E, 0xAC, 0x6C, 0x93, 0x04, 0x32, 0x97, 0xF9, 0xA4, 0x51,
+    0x77, 0xDA, 0x11, 0xB7, 0x7D, 0x78, 0xB7, 0x88, 0x44, 0x44, 0xE4, 0xAE, 0x9B, 0x7B, 0x51, 0x26,
+    0x50, 0x4A, 0x55, 0x76, 0x2C, 0x64, 0x7C, 0xF6, 0x1C, 0x89, 0xD4, 0xEA, 0xF6, 0x53, 0xCD, 0x12,
+    0xAA, 0xFE, 0x14, 0xCA, 0x83, 0x76, 0xBD, 0x43, 0x20, 0x05, 0x66, 0x22, 0x72, 0x57, 0x44, 0x3A,
+    0x18, 0x35, 0xF0, 0x0F, 0x1E, 0xFD, 0x82, 0x63, 0x64, 0xAC, 0xF2, 0xF1, 0xCD, 0x92, 0x58, 0xAA,
+    0x3D, 0x81, 0x4E, 0x66, 0xD1, 0x9D, 0xD9, 0x23, 0xF7, 0xFC, 0x33, 0xFA, 0xE6, 0x56, 0x29, 0x22,
+    0x55, 0x28, 0x85, 0xB9, 0xC0, 0x38, 0x7D, 0xCA, 0xA5, 0x33, 0x16, 0x20, 0x70, 0x8F, 0x60, 0xAE,
+    0xD6, 0xA4, 0xDA, 0xDD, 0x9B, 0x07, 0x5B, 0x19, 0xA5, 0x38, 0xF3, 0xFA, 0x7A, 0xB5, 0x83, 0xB9,
+    0x5E, 0xF4, 0x26, 0x50, 0xD6, 0xDB, 0x5A, 0x2D, 0xA8, 0xB7, 0x44, 0xE4, 0x96, 0x88, 0x34, 0x70,
+    0xB7, 0x42, 0xBD, 0x6C, 0x49, 0xE2, 0x8C, 0x26, 0xC5, 0xD8, 0xC9, 0x56, 0xCB, 0xA4, 0x37, 0xEB,
+    0x1E, 0x0C, 0xB3, 0x36, 0x59, 0xF1, 0xD3, 0x80, 0xAC, 0x6F, 0xB7, 0xAC, 0xE3, 0x1F, 0xD5, 0xE7,
+    0xEF, 0xB9, 0x90, 0x92, 0xAD, 0x2D, 0x11, 0x91, 0x42, 0x77, 0x8C, 0xA6, 0x81, 0x9F, 0xAD, 0x67,
+    0x52, 0x73, 0x14, 0x78, 0x44, 0x67, 0x40, 0xB2, 0xE2, 0x01, 0xED, 0x9A, 0xFB, 0x84, 0x9E, 0xE0,
+    0x5C, 0x90, 0x67, 0x0F, 0x30, 0x53, 0xE2, 0x8D, 0x4B, 0x6D, 0xEC, 0x4C, 0xCD, 0x34, 0xF4, 0x91,
+    0x45, 0x67, 0x53, 0x65, 0xC1, 0x27, 0xA1, 0x83, 0x45, 0x6D, 0x3D, 0xA8, 0xAB, 0x7E, 0x1B, 0x98,
+    0x74, 0x6D, 0x8F, 0xE6, 0x81, 0x58, 0x5F, 0xF5, 0x60, 0x9E, 0xF5, 0x43, 0x30, 0x76, 0xAA, 0x2D,
+    0x91, 0x4B, 0x68, 0x51, 0x5E, 0xDB, 0xA4, 0x50, 0x75, 0xE8, 0x55, 0xAD, 0x9A, 0x50, 0x8A, 0xF4,
+    0x89, 0x46, 0x89, 0x8F, 0x9A, 0x55, 0x80, 0xA3, 0x1C, 0xE4, 0x1C, 0x98, 0x5D, 0x0F, 0xE6, 0xAA,
+    0x87, 0x7B, 0x9D, 0xFA, 0x15, 0x9A, 0x48, 0x81, 0x7B, 0x84, 0x54, 0x3B, 0xE5, 0x2F, 0xED, 0xB5,
+    0x7B, 0xF0, 0x9B, 0x68, 0x99, 0x31, 0x8B, 0xBC, 0xC1, 0x14, 0x15, 0xCD, 0xFB, 0x31, 0x05, 0x81,
+    0x87, 0x11, 0x4A, 0x2C, 0xA9, 0x40, 0xD4, 0xF6, 0x6A, 0x60, 0xE3, 0x00, 0xD1, 0x4B, 0x8E, 0x69,
+    0x4A, 0x7C, 0xB5, 0xFB, 0x9C, 0xD7, 0xD2, 0x10, 0xAC, 0x71, 0x30, 0x28, 0xCE, 0x9A, 0x2B, 0x75,
+    0x1A, 0x64, 0x47, 0xD8, 0x13, 0x8B, 0x1F, 0xB5, 0x8F, 0x04, 0x35, 0xCA, 0x61, 0xF8, 0x4D, 0x8F,
+    0x54, 0x44, 0x15, 0xFA, 0x7F, 0x93, 0x0C, 0x68, 0xBA, 0x75, 0x2B, 0x0D, 0xC7, 0x58, 0xC8, 0x73,
+    0x44, 0xDA, 0x78, 0xEB, 0xC2, 0x95, 0x2A, 0xF4, 0x27, 0x98, 0x52, 0x24, 0x10, 0x59, 0x82, 0x06,
+    0xD2, 0x86, 0x60, 0xDD, 0xF7, 0x56, 0xF1, 0xDC, 0xDD, 0x33, 0xFD, 0x10, 0x66, 0xD7, 0x85, 0x75,
+    0x7A, 0xB3, 0xA3, 0x94, 0x8C, 0x1C, 0x12, 0x69, 0x53, 0x99, 0x0D, 0x68, 0x1E, 0x55, 0xD5, 0x11,
+    0x53, 0xB0, 0x04, 0x53, 0x82, 0xDB, 0x84, 0xE2, 0x38, 0x5E, 0x43, 0x0B, 0x97, 0x60, 0x08, 0x43,
+    0x18, 0x3F, 0x4A, 0x7B, 0x36, 0xF2, 0x89, 0xD8, 0x83, 0xDF, 0x84, 0x85, 0x1C, 0x98, 0x48, 0xC6,
+    0xDC, 0x35, 0x3A, 0x1F, 0xF8, 0x7C, 0x35, 0xC8, 0x9F, 0x14, 0x1B, 0xCB, 0x73, 0x35, 0xC7, 0x2B,
+    0x6D, 0x89, 0xB3, 0x04, 0x66, 0x4C, 0x31, 0x75, 0xE8, 0xB9, 0xEB, 0xB4, 0x35, 0x4F, 0x66, 0x09,
+    0xF5, 0x90, 0xA9, 0xC9, 0xEA, 0xD0, 0xD7, 0xCA, 0xE9, 0x6B, 0x85, 0xC9, 0x92, 0x86, 0x21, 0x65,
+    0x41, 0x1D, 0x36, 0x28, 0xA7, 0x2D, 0x26, 0x2B, 0xCF, 0x07, 0xE5, 0xD7, 0xC4, 0xC6, 0x52, 0x90,
+    0x4A, 0x46, 0x2C, 0xEE, 0x3E, 0x21, 0x33, 0x12, 0xCA, 0x77, 0x24, 0x2B, 0x2B, 0x93, 0x29, 0xAB,
+    0x9C, 0xF2, 0xD4, 0xAA, 0x65, 0x18, 0x5D, 0xC3, 0x3C, 0xB1, 0x6B, 0xD5, 0xF7, 0x0A, 0x8F, 0x14,
+    0x03, 0xD2, 0xC2, 0x60, 0x0A, 0x65, 0xF5, 0x8D, 0xB0, 0x33, 0xA2, 0xC4, 0x71, 0x32, 0x2C, 0xA0,
+    0x8D, 0x0B, 0x94, 0xDF, 0xF8, 0xF5, 0x93, 0x7E, 0xF4, 0x60, 0x3F, 0x4D, 0x22, 0xD7, 0xC2, 0xEA,
+    0x01, 0xF6, 0x19, 0xC2, 0x65, 0x5D, 0xBA, 0xA4, 0x51, 0x0E, 0x4F, 0x4D, 0xCB, 0x10, 0xC1, 0x3C,
+    0xF6, 0xF7, 0x56, 0x5D, 0xF7, 0x9E, 0x37, 0xAB, 0x01, 0x69, 0x65, 0x30, 0x95, 0xB2, 0xAA, 0xC2,
+    0x87, 0xB7, 0x29, 0x37, 0xC5, 0x4A, 0xCD, 0x23, 0x51, 0x86, 0xAE, 0x5A, 0xD8, 0x30, 0xFB, 0x11,
+    0xC0, 0x67, 0xCF, 0x41, 0x29, 0x15, 0xE9, 0x97, 0x4B, 0x6B, 0x1C, 0x65, 0x58, 0xA3, 0xEA, 0x14,
+    0xE2, 0x17, 0x1C, 0xB4, 0x53, 0x30, 0x2F, 0x5A, 0x98, 0xB6, 0xA0, 0xAF, 0x59, 0x98, 0x5E, 0x02,
+    0xF3, 0x42, 0x05, 0x4D, 0x0A, 0xC9, 0x4A, 0x83, 0xF2, 0xA6, 0x0A, 0x5A, 0x26, 0x37, 0x05, 0x4A,
+    0x29, 0x20, 0x87, 0x30, 0xFB, 0x54, 0x58, 0x9F, 0x65, 0x1A, 0x17, 0x07, 0x82, 0xBD, 0xA9, 0x14,
+    0x77, 0xA4, 0xB7, 0xEA, 0x84, 0x49, 0x8C, 0x7E, 0xD9, 0x72, 0xB7, 0x9A, 0x5B, 0x2B, 0xEA, 0x96,
+    0xE5, 0x4E, 0xCD, 0x20, 0x65, 0xA4, 0x6F, 0x97, 0x4C, 0x3A, 0x82, 0xB5, 0x1E, 0x34, 0x6A, 0xE9,
+    0x50, 0xB7, 0x8F, 0xB7, 0xB4, 0x68, 0x9F, 0x64, 0xA4, 0x2B, 0x15, 0x41, 0xB3, 0xB1, 0x47, 0x51,
+    0xB7, 0xB5, 0x75, 0xE1, 0x9A, 0x88, 0xB4, 0x2D, 0xE8, 0x17, 0xF7, 0x48, 0xDB, 0xF4, 0x04, 0x75,
+    0x9A, 0x91, 0xD2, 0x11, 0xDB, 0xA8, 0xBB, 0xE0, 0xD1, 0xD2, 0xD0, 0x43, 0x51, 0x60, 0xD2, 0x20,
+    0xA5, 0x9B, 0x06, 0xED, 0x98, 0xF8, 0xF3, 0xA8, 0x5B, 0x5F, 0xC9, 0x45, 0x44, 0x6E, 0xE7, 0x4F,
+    0x95, 0xA8, 0x1F, 0x59, 0x7C, 0x4B, 0x93, 0xFC, 0xA0, 0x0D, 0xA4, 0x61, 0x61, 0x95, 0x5F, 0x8A,
+    0x67, 0x76, 0xCE, 0xB3, 0x11, 0xC4, 0xCF, 0xCD, 0x79, 0xA6, 0xAF, 0xDD, 0xDC, 0xDA, 0x6A, 0x45,
+    0x44, 0xAE, 0x59, 0x98, 0x4E, 0x41, 0xBF, 0xE8, 0x7A, 0x9E, 0xC5, 0x2B, 0xF5, 0x3F, 0x86, 0x67,
+    0xD1, 0xCB, 0x05, 0x77, 0x5F, 0xCF, 0x27, 0x22, 0xD2, 0xE5, 0x1F, 0xBB, 0x65, 0xB9, 0xE3, 0xDF,
+    0xC1, 0xB3, 0xA8, 0x38, 0x4F, 0xAA, 0x2B, 0xDA, 0xF8, 0x9E, 0xF6, 0x0A, 0xBE, 0x49, 0x20, 0x52,
+    0x98, 0xD7, 0x4B, 0x37, 0x20, 0xB6, 0x9E, 0xF8, 0x59, 0x4B, 0x0A, 0x5C, 0x82, 0xA0, 0x0E, 0x45,
+    0x2A, 0x23, 0x52, 0xC0, 0x46, 0x1F, 0x2B, 0xD3, 0x57, 0x60, 0xB4, 0x44, 0xE8, 0x67, 0x24, 0xCF,
+    0xC8, 0xF3, 0x4D, 0x20, 0x1D, 0x2C, 0xC0, 0x41, 0xCE, 0xC5, 0x9B, 0x3E, 0xDE, 0xF4, 0x0B, 0x7B,
+    0x8A, 0x31, 0x14, 0x17, 0xDF, 0xAA, 0x1F, 0xA1, 0x85, 0x0D, 0x18, 0x91, 0x4F, 0x10, 0xE1, 0xE8,
+    0x12, 0x8C, 0x8E, 0x32, 0x1C, 0x30, 0x4D, 0x9F, 0xF7, 0x46, 0x0A, 0xD6, 0xFA, 0x09, 0x1F, 0xC8,
+    0x0C, 0x92, 0x7D, 0xC0, 0x33, 0xC8, 0xB3, 0x85, 0xBC, 0xEC, 0x42, 0x79, 0xA5, 0x43, 0xD5, 0xAA,
+    0x62, 0x48, 0x42, 0x64, 0x69, 0xA8, 0xD1, 0x36, 0x86, 0x91, 0x72, 0x84, 0x7E, 0x0C, 0xE6, 0x8B,
+    0x19, 0x4C, 0x3D, 0xA8, 0x19, 0xF4, 0xD1, 0x9E, 0x7A, 0x6E, 0x1A, 0xEE, 0x5A, 0x48, 0x6A, 0x08,
+    0x67, 0xF3, 0xC0, 0x59, 0x20, 0x2D, 0x46, 0xFC, 0xFE, 0x05, 0x45, 0xAA, 0xF2, 0xB5, 0xEE, 0xB1,
+    0x72, 0xA5, 0xA2, 0xD6, 0x36, 0xB2, 0x26, 0x1B, 0x92, 0xE0, 0x19, 0xEB, 0x82, 0x66, 0x40, 0xF0,
+    0xE3, 0x0A, 0xF5, 0xFD, 0xDE, 0x1C, 0x34, 0xAE, 0xB7, 0x6C, 0xEB, 0xDE, 0x00, 0x1D, 0xA3, 0x7E,
+    0xD4, 0x7B, 0xB2, 0xE3, 0x02, 0x38, 0x19, 0x16, 0x28, 0x7F, 0x19, 0xD2, 0xC8, 0xFD, 0x9A, 0x7B,
+    0xC1, 0xB9, 0xA3, 0xF7, 0x16, 0xED, 0xB7, 0x0D, 0xB5, 0x48, 0x9E, 0x95, 0x2F, 0xDD, 0x3E, 0x38,
+    0x33, 0x85, 0x72, 0x09, 0x31, 0x43, 0x6A, 0xA6, 0xCA, 0x06, 0x7E, 0x09, 0x55, 0x79, 0xA2, 0x17,
+    0x0A, 0xCC, 0xB8, 0x8F, 0x67, 0xA4, 0x19, 0x4C, 0x7B, 0xE8, 0x71, 0x12, 0x02, 0x8F, 0xB9, 0x00,
+    0xA9, 0x9F, 0xBB, 0x53, 0x7A, 0x25, 0x92, 0x5D, 0x24, 0x68, 0x92, 0x8C, 0x89, 0xAE, 0x88, 0x37,
+    0x6B, 0xC2, 0xE2, 0xD1, 0x5F, 0x67, 0x97, 0x00, 0x96, 0x4F, 0x11, 0xF8, 0x1A, 0xF3, 0x11, 0xCB,
+    0xCE, 0x00, 0x75, 0xE5, 0x9E, 0x34, 0xBC, 0x37, 0xEF, 0xB7, 0xB6, 0x30, 0xEC, 0x91, 0x5A, 0x0C,
+    0x77, 0x3C, 0x4A, 0x7A, 0x97, 0x41, 0x6F, 0x5B, 0x24, 0x2B, 0xFE, 0x3E, 0xBB, 0x62, 0x21, 0x0F,
+    0xF2, 0x8F, 0x8B, 0x93, 0x66, 0xBD, 0x38, 0x5E, 0xDD, 0x0F, 0xDF, 0xB2, 0x39, 0x38, 0x9C, 0x31,
+    0x24, 0xBE, 0x53, 0x66, 0x81, 0x88, 0x63, 0x61, 0xF5, 0x9D, 0xF0, 0x8D, 0x1A, 0x02, 0x39, 0x87,
+    0x92, 0x26, 0x28, 0x1E, 0x9E, 0x0F, 0x8D, 0xE5, 0xC8, 0x81, 0xB7, 0xE3, 0xDC, 0x5A, 0x92, 0x26,
+    0xA9, 0x4D, 0x11, 0x33, 0x62, 0x4C, 0x13, 0xF8, 0xD0, 0x47, 0x36, 0x7A, 0x73, 0x9D, 0x48, 0x5A,
+    0xF8, 0x03, 0xDF, 0x03, 0xA5, 0x18, 0x82, 0xB2, 0x20, 0x11, 0xF2, 0x3C, 0x4F, 0x45, 0x5E, 0xE9,
+    0xB6, 0xEA, 0x84, 0xA1, 0xB6, 0xFA, 0x71, 0x1F, 0xDA, 0x29, 0x47, 0x12, 0xD0, 0x96, 0xD0, 0xC3,
+    0x14, 0xDE, 0x79, 0x92, 0xDC, 0x26, 0x15, 0x8B, 0xF2, 0xB0, 0x03, 0x4B, 0x10, 0x65, 0x73, 0x67,
+    0x57, 0x2A, 0xB3, 0x44, 0x66, 0xAA, 0x5A, 0x54, 0xD5, 0x09, 0x55, 0x3D, 0xA4, 0x2A, 0xDE, 0xF1,
+    0xD1, 0x1D, 0xA9, 0x14, 0x98, 0x0C, 0x9D, 0xA1, 0x21, 0x82, 0x00, 0xC2, 0x73, 0x67, 0x80, 0x89,
+    0xB1, 0x10, 0xDD, 0x8F, 0x3E, 0x16, 0xF2, 0x8C, 0x63, 0x6B, 0xD2, 0x62, 0xE4, 0xFA, 0x0C, 0x8E,
+    0x3B, 0x6D, 0x61, 0xCC, 0x14, 0x22, 0xFB, 0x53, 0xC5, 0x52, 0x8A, 0xC8, 0xEA, 0x9B, 0x92, 0x8D,
+    0x99, 0xD2, 0x46, 0x56, 0xDB, 0xC8, 0x8D, 0x99, 0x32, 0x8A, 0xAC, 0xB6, 0xCA, 0x8D, 0x99, 0x32,
+    0x8E, 0xAC, 0xB6, 0xB1, 0x1D, 0x87, 0x5D, 0xE9, 0x93, 0x46, 0xE4, 0x86, 0xD9, 0x5B, 0x92, 0x0F,
+    0x66, 0xE7, 0xC0, 0x5C, 0xAD, 0xE7, 0x87, 0xFB, 0x0D, 0xAF, 0x74, 0xC6, 0x64, 0x96, 0x34, 0xA4,
+    0xB5, 0x72, 0x44, 0x76, 0xDF, 0xE1, 0xEE, 0x8D, 0xC8, 0x2A, 0xE9, 0x22, 0xAB, 0x5C, 0x12, 0x59,
+    0xE5, 0xCC, 0x13, 0x7B, 0x87, 0x38, 0xB2, 0xFA, 0xCE, 0x4C, 0x37, 0xA9, 0xDC, 0x48, 0x7B, 0x4C,
+    0x76, 0x2C, 0xCF, 0x57, 0x44, 0xBA, 0xE8, 0xCE, 0xF3, 0x2E, 0x61, 0x18, 0xFA, 0xD0, 0x25, 0x9C,
+    0x0A, 0x3D, 0x59, 0x02, 0x1F, 0x78, 0x73, 0x35, 0x12, 0x21, 0xF4, 0x90, 0xF0, 0x8E, 0x1F, 0xDD,
+    0x65, 0x4A, 0x3A, 0xC0, 0x83, 0x81, 0x23, 0x1E, 0x35, 0xEB, 0xE7, 0xD6, 0xBB, 0x71, 0x3C, 0x95,
+    0xE2, 0x3E, 0x8E, 0xDF, 0x26, 0x95, 0x02, 0x65, 0x51, 0x96, 0x27, 0x0A, 0x04, 0x3E, 0xCD, 0xB1,
+    0x9C, 0x7C, 0x45, 0x7C, 0x32, 0x8B, 0x6A, 0xCE, 0x12, 0x5B, 0x53, 0x70, 0x29, 0xF4, 0x28, 0x3F,
+    0x86, 0xF8, 0x5A, 0x06, 0x65, 0x35, 0x0F, 0x83, 0x24, 0x16, 0xA2, 0x0E, 0xF8, 0x49, 0xDD, 0x47,
+    0x41, 0x74, 0x91, 0x12, 0xF8, 0xB0, 0x61, 0x88, 0xB1, 0xC9, 0x0D, 0x26, 0x46, 0x6C, 0xE8, 0xE9,
+    0x1D, 0x46, 0x81, 0x9F, 0x43, 0xDB, 0x75, 0x0B, 0xA6, 0x7A, 0xAF, 0x21, 0x10, 0xE5, 0xCB, 0x5A,
+    0x55, 0xFD, 0xC4, 0x9A, 0xBB, 0x1A, 0x54, 0x45, 0x58, 0x82, 0x76, 0xEF, 0xA4, 0xB9, 0xD8, 0x4F,
+    0xB3, 0xF9, 0x52, 0x06, 0x93, 0x8A, 0xE0, 0xF9, 0xEE, 0x1B, 0xA4, 0x22, 0xF6, 0xDD, 0x68, 0x0E,
+    0x1A, 0x86, 0x18, 0x97, 0xDC, 0x08, 0xE4, 0x6B, 0x62, 0x4B, 0xD9, 0x4F, 0xD8, 0xF8, 0x6D, 0xC2,
+    0x4A, 0xA9, 0x79, 0x6A, 0x96, 0x31, 0xA8, 0xDF, 0x11, 0x9B, 0xA9, 0x0F, 0xFE, 0xDB, 0xBD, 0x0D,
+    0xD4, 0xFB, 0x92, 0xC2, 0xA7, 0x57, 0xFE, 0xEC, 0x01, 0xCE, 0xBD, 0xEB, 0x07, 0x00, 0xC7, 0x72,
+    0xFE, 0xC9, 0x9B, 0x17, 0xEC, 0x43, 0xF6, 0xFC, 0x95, 0xC2, 0xF2, 0xF3, 0xF6, 0x0C, 0x88, 0x78,
+    0x88, 0xBF, 0xCC, 0xEF, 0x3C, 0xFF, 0xA8, 0x3A, 0xA4, 0xC2, 0x15, 0xD4, 0xCF, 0xDD, 0x83, 0x7C,
+    0x4D, 0x66, 0x5B, 0xDF, 0x98, 0x1F, 0xF3, 0x35, 0x91, 0x2E, 0xCF, 0xD7, 0xF2, 0x3C, 0xCF, 0xF3,
+    0x7C, 0x22, 0x22, 0x22, 0x6F, 0xE6, 0x79, 0x9E, 0xE7, 0x6B, 0x47, 0x17, 0xC6, 0xF1, 0x7B, 0xDB,
+    0x3F, 0x7D, 0x48, 0x44, 0x26, 0x22, 0x0E, 0xC2, 0xAD, 0xAD, 0x6F, 0x8A, 0x48, 0x01, 0x10, 0x5D,
+    0x69, 0x46, 0x66, 0xF3, 0x4A, 0xE5, 0x8F, 0x70, 0x34, 0x7E, 0xF2, 0x6A, 0x35, 0x36, 0x81, 0x3B,
+    0x05, 0x81, 0x1F, 0xC7, 0xCF, 0x55, 0xCD, 0xC8, 0x6C, 0x56, 0x7E, 0x70, 0x32, 0xDA, 0xB4, 0xFE,
+    0xC8, 0x01, 0x8E, 0x2E, 0x44, 0xD7, 0xEB, 0x36, 0xD5, 0xCF, 0x56, 0xE3, 0x58, 0x59, 0x7F, 0x22,
+    0xCA, 0x2E, 0x9E, 0xE2, 0xB7, 0x61, 0xB4, 0x67, 0x8A, 0x0F, 0x48, 0x2F, 0x77, 0xA9, 0x74, 0x47,
+    0x4E, 0x41, 0xFF, 0x19, 0xEC, 0x5D, 0xEA, 0x3F, 0x23, 0x80, 0x77, 0x7F, 0x64, 0x70, 0x60, 0x7E,
+    0xC3, 0x10, 0x86, 0xFC, 0xB3, 0xE1, 0x07, 0x53, 0xE9, 0x46, 0x1B, 0xFF, 0xEE, 0xED, 0x07, 0x47,
+    0x00, 0x4B, 0x1F, 0x69, 0xE5, 0xE5, 0x36, 0xCD, 0x78, 0x98, 0xD8, 0x45, 0xF2, 0x98, 0xCC, 0x26,
+    0xF2, 0x7D, 0x79, 0xAE, 0x0B, 0x1A, 0x8E, 0xC0, 0x52, 0xBC, 0xEB, 0x8F, 0x00, 0xB5, 0xFE, 0xA2,
+    0x9F, 0xC4, 0x45, 0x0B, 0xD9, 0x07, 0xCD, 0x0B, 0x7E, 0xBB, 0x1F, 0xB5, 0xEC, 0x93, 0xEE, 0xBD,
+    0x8D, 0x5A, 0x70, 0x27, 0xFA, 0xE5, 0x46, 0x0D, 0xC2, 0x42, 0x57, 0xBF, 0xFD, 0x8D, 0x7F, 0xF5,
+    0x9F, 0x83, 0xE2, 0x17, 0xEF, 0x10, 0x1C, 0xE0, 0xD0, 0xA3, 0x1C, 0x5A, 0x3E, 0xF6, 0xC9, 0x47,
+    0x6E, 0x4E, 0xFF, 0x43, 0xF0, 0xC2, 0xFB, 0x1E, 0xFA, 0xC2, 0x87, 0xFF, 0x13, 0x16, 0x05, 0xEF,
+    0x83, 0x0F, 0xF3, 0x0B, 0x8A, 0x47, 0x80, 0x03, 0x3C, 0x74, 0x3E, 0xFC, 0x3F, 0x9C, 0xFA, 0xCB,
+    0xB5, 0x97, 0x6E, 0x5E, 0x7C, 0x29, 0xB3, 0x7F, 0xBE, 0xC2, 0x9F, 0xFC, 0x32, 0xCF, 0xEE, 0x15,
+    0x0F, 0xEC, 0x73, 0x05, 0x85, 0x05, 0x10, 0xCD, 0x7A, 0x67, 0x73, 0xFC, 0x74, 0xA6, 0x01, 0x06,
+    0x91, 0x3D, 0x09, 0x30, 0x56, 0x76, 0x00, 0x70, 0x46, 0xD9, 0xD3, 0xF3, 0x5F, 0xDF, 0xFF, 0x5E,
+    0xB5, 0x47, 0x80, 0x81, 0xDE, 0x7C, 0x56, 0x48, 0xEA, 0xE4, 0x69, 0x6D, 0xBE, 0x6A, 0xBF, 0x3D,
+    0x35, 0xED, 0x89, 0x93, 0xCA, 0xF9, 0x25, 0xB2, 0xC1, 0x62, 0xF0, 0x4A, 0x15, 0xC3, 0xC5, 0x61,
+    0xF0, 0xAA, 0x33, 0x50, 0x0D, 0x82, 0x57, 0x9D, 0x21, 0xB4, 0xC3, 0xF0, 0xD5, 0xEA, 0x24, 0x51,
+    0xB1, 0xA4, 0xAE, 0xF8, 0x45, 0x0C, 0xE6, 0xAB, 0xC5, 0xED, 0x29, 0x8B, 0x44, 0x1D, 0xA9, 0xE7,
+    0x14, 0xAC, 0xBE, 0xBD, 0xAA, 0x43, 0xE8, 0x9A, 0xF1, 0x28, 0xD6, 0x2B, 0x05, 0x00, 0xDB, 0x8B,
+    0x66, 0xF3, 0xBA, 0x9F, 0x8E, 0xCC, 0x73, 0x57, 0xFC, 0xF6, 0xF0, 0xB0, 0x2A, 0xE6, 0x77, 0x2D,
+    0xEA, 0x15, 0xDB, 0x0C, 0xE3, 0x27, 0xAE, 0xFA, 0xE9, 0xC8, 0x6C, 0x5E, 0xF7, 0xE3, 0x44, 0xAF,
+    0x38, 0xBF, 0x7C, 0xB8, 0x8F, 0x10, 0xA2, 0xEC, 0x28, 0xF4, 0x26, 0x9B, 0x2A, 0xD7, 0x47, 0x3D,
+    0xFD, 0x49, 0x55, 0x4D, 0xB5, 0xAD, 0xCD, 0xE3, 0x3E, 0x51, 0x6E, 0x18, 0xD9, 0x47, 0xF5, 0x1E,
+    0x7C, 0x0B, 0xAA, 0x81, 0xAA, 0xA6, 0x26, 0x9B, 0x9A, 0x15, 0x6F, 0x1E, 0xF7, 0xC3, 0xD0, 0x0F,
+    0xB5, 0x1D, 0x46, 0xD6, 0xAB, 0xEC, 0xE2, 0x3C, 0x64, 0xFA, 0x29, 0xA2, 0x8A, 0x8D, 0x2A, 0xBA,
+    0x52, 0x8D, 0xFB, 0x80, 0xEA, 0xA3, 0x91, 0x1D, 0x6B, 0x37, 0xA2, 0x65, 0xCA, 0x0E, 0x67, 0xE0,
+    0x0B, 0xD4, 0xD4, 0x41, 0x13, 0x7A, 0x63, 0x1B, 0x53, 0x9C, 0x9E, 0xB7, 0x7D, 0x1E, 0xDE, 0xB7,
+    0x1C, 0x66, 0xCB, 0x87, 0x23, 0x5B, 0xA9, 0xC7, 0x57, 0x8A, 0xC0, 0x19, 0x38, 0x7D, 0x0A, 0x4E,
+    0x5C, 0x24, 0x8E, 0xAC, 0x8F, 0xB5, 0xF5, 0x3C, 0x74, 0x11, 0x4E, 0x9F, 0x22, 0x70, 0x1A, 0xB5,
+    0xB2, 0x69, 0xDF, 0x1F, 0xD9, 0x6A, 0x39, 0xCC, 0x96, 0xCF, 0xC3, 0xFB, 0x00, 0x1E, 0xE1, 0xBF,
+    0x79, 0x73, 0xCD, 0x8E, 0x46, 0x34, 0x8D, 0x7A, 0xA9, 0x32, 0x4F, 0x66, 0xC3, 0x21, 0xBE, 0x56,
+    0xBB, 0xCE, 0xE8, 0x6C, 0xB0, 0x88, 0x3F, 0x1D, 0x5E, 0x71, 0xF3, 0xCE, 0x9C, 0x09, 0x5E, 0xAB,
+    0xCD, 0x35, 0x9B, 0x1E, 0xE0, 0x48, 0x6F, 0x12, 0xBC, 0x9E, 0xE7, 0xAB, 0xF9, 0x93, 0xB3, 0xAD,
+    0x9E, 0x6B, 0x61, 0x01, 0x1E, 0xB6, 0x61, 0x19, 0x4E, 0xC1, 0x61, 0x30, 0x10, 0x65, 0x28, 0x4B,
+    0x60, 0xA1, 0x82, 0x8B, 0x7B, 0xD7, 0x4E, 0x80, 0x01, 0x9D, 0xA1, 0x2C, 0xA1, 0x63, 0x9E, 0x08,
+    0x02, 0xC4, 0x15, 0x92, 0xA5, 0xB3, 0x50, 0xAA, 0x7F, 0x5E, 0x3E, 0xF6, 0x83, 0x06, 0x6D, 0x19,
+    0xA2, 0x2C, 0x27, 0x09, 0x1C, 0x86, 0xD0, 0x61, 0x88, 0x6D, 0x70, 0x39, 0x92, 0x22, 0x69, 0xCD,
+    0x8C, 0x49, 0x65, 0xCE, 0xB1, 0x81, 0x86, 0x65, 0xA2, 0x79, 0xAE, 0xD2, 0xDE, 0x48, 0x5B, 0x4E,
+    0xA2, 0x2B, 0x52, 0x22, 0x47, 0x4A, 0x90, 0xF5, 0x52, 0x7A, 0x28, 0x6A, 0x30, 0xBB, 0xE2, 0x54,
+    0x75, 0x73, 0x46, 0x83, 0xB6, 0x43, 0xF0, 0x26, 0xE3, 0x84, 0x72, 0xE8, 0xAC, 0x26, 0xB6, 0xC3,
+    0x40, 0x2A, 0x93, 0x89, 0x53, 0x6E, 0x94, 0xB1, 0xAD, 0x61, 0x31, 0xB0, 0xE8, 0xFB, 0xDA, 0x0D,
+    0x1B, 0x8C, 0xDB, 0x40, 0xF9, 0x05, 0x38, 0xF2, 0x08, 0xBD, 0x9F, 0xB5, 0x55, 0x62, 0x1B, 0xF5,
+    0xBC, 0x6F, 0x60, 0xA7, 0x81, 0x41, 0x0D, 0xA7, 0x6A, 0x18, 0xD4, 0x04, 0x6D, 0x4D, 0x59, 0x6F,
+    0x23, 0x6E, 0x9B, 0x86, 0xD3, 0x78, 0x4E, 0xBF, 0x9D, 0xDC, 0xC7, 0x19, 0x96, 0x99, 0x71, 0x89,
+    0x96, 0x4B, 0x1C, 0x99, 0xB3, 0x22, 0xAE, 0x82, 0x67, 0xEE, 0xCE, 0xD6, 0x0F, 0x07, 0xA5, 0x3F,
+    0xC2, 0xB1, 0xB9, 0xE5, 0xF6, 0xB8, 0xF3, 0x03, 0xB3, 0x79, 0xBD, 0x1E, 0xC7, 0xFA, 0xAA, 0x6F,
+    0x47, 0x7B, 0xC5, 0x6A, 0x7B, 0x68, 0x94, 0xAD, 0x96, 0xDF, 0x1F, 0xCD, 0xED, 0x91, 0xCF, 0x10,
+    0x0B, 0xCD, 0x59, 0x5D, 0x8C, 0x87, 0x78, 0xAF, 0x5E, 0xB2, 0xE6, 0x49, 0x06, 0xC3, 0xC0, 0x4F,
+    0x4D, 0xD1, 0xB5, 0x94, 0x05, 0x40, 0x00, 0x43, 0x54, 0x4D, 0xE2, 0x82, 0x1F, 0x65, 0x66, 0x11,
+    0xBF, 0xAD, 0xFF, 0xCB, 0xFF, 0x4D, 0xC5, 0x1F, 0x3B, 0x9B, 0xB1, 0xDD, 0x47, 0x28, 0x83, 0x35,
+    0x25, 0xF6, 0xCD, 0xD5, 0x65, 0xCC, 0xB9, 0x48, 0x88, 0x3C, 0x03, 0x0C, 0xFA, 0xD9, 0xD2, 0x4A,
+    0x06, 0xF0, 0x41, 0x52, 0x77, 0x96, 0x21, 0xE9, 0xAA, 0x91, 0xE7, 0xAE, 0xBC, 0x59, 0xC5, 0xE3,
+    0xE8, 0xDA, 0xE3, 0xAF, 0x8A, 0x4F, 0x2A, 0xE0, 0xD8, 0x5A, 0x29, 0x6F, 0xAE, 0x57, 0x03, 0xB6,
+    0x03, 0xAF, 0x6C, 0x64, 0x75, 0x66, 0x30, 0x1C, 0x06, 0x82, 0x3F, 0x53, 0xF2, 0xAC, 0xF3, 0x7E,
+    0x71, 0x29, 0x0E, 0x05, 0x71, 0xF5, 0xC6, 0x99, 0xE8, 0xBF, 0x86, 0xAF, 0xFD, 0xA0, 0x7F, 0x2E,
+    0x38, 0xA7, 0x64, 0xE5, 0xFA, 0x8F, 0xFD, 0xD2, 0x38, 0xBA, 0xF6, 0xD8, 0x2B, 0xD2, 0xC4, 0x33,
+    0x62, 0xE2, 0xC7, 0xCA, 0xAC, 0x03, 0x38, 0x70, 0x54, 0xDD, 0x6D, 0x0F, 0xD6, 0x3B, 0x51, 0xE1,
+    0x4F, 0x2A, 0x7B, 0xC6, 0x04, 0xD5, 0x40, 0x3F, 0x53, 0x97, 0x4F, 0xFA, 0xA0, 0x23, 0x91, 0xC7,
+    0x7C, 0xA2, 0xB3, 0xC1, 0x60, 0xDE, 0x65, 0xC3, 0x60, 0x18, 0xF8, 0x8D, 0x38, 0x2B, 0x6B, 0x3E,
+    0x03, 0x84, 0xB6, 0xB4, 0x9F, 0xB3, 0x6A, 0xDF, 0x1E, 0xB9, 0x49, 0x7B, 0x6C, 0xF5, 0x60, 0xA3,
+    0x6F, 0xED, 0xDA, 0xBA, 0x1A, 0x62, 0x30, 0x99, 0x29, 0x4C, 0x61, 0x32, 0x73, 0xF3, 0xCF, 0xA5,
+    0x3D, 0xB6, 0xAA, 0x1B, 0x73, 0x6B, 0x33, 0xF3, 0x9C, 0x61, 0x1A, 0x0A, 0x1F, 0xEB, 0x19, 0x10,
+    0x6F, 0x4A, 0xF1, 0x19, 0xD0, 0x19, 0x97, 0x88, 0x6A, 0x52, 0xA7, 0x5E, 0xCE, 0x16, 0x17, 0x83,
+    0x6A, 0xDB, 0x3C, 0xDF, 0x24, 0xE2, 0x59, 0x84, 0x6D, 0x82, 0xE2, 0xD0, 0x96, 0x12, 0xEB, 0x59,
+    0xC6, 0xD4, 0x61, 0x99, 0x05, 0x9E, 0x01, 0x31, 0xC9, 0x13, 0x92, 0x7D, 0x06, 0xD6, 0xB3, 0xCB,
+    0xD9, 0x94, 0x29, 0x69, 0x13, 0xCB, 0x0B, 0xC5, 0xED, 0x2A, 0x1E, 0x47, 0xD7, 0x36, 0xAF, 0x4B,
+    0x75, 0xF0, 0xDC, 0x67, 0xB7, 0x44, 0xAA, 0xC5, 0x73, 0x63, 0x7C, 0x50, 0x29, 0x1B, 0x15, 0x3D,
+    0xD3, 0x1E, 0x20, 0x6A, 0xA2, 0x1F, 0xED, 0xDA, 0x6D, 0x3F, 0x88, 0x3F, 0x1F, 0x4A, 0xF0, 0x96,
+    0xF7, 0xA3, 0x33, 0xD1, 0xD7, 0xD4, 0x77, 0xA4, 0xFA, 0xAD, 0x2C, 0x6A, 0xF4, 0xAD, 0x5D, 0xFB,
+    0xA6, 0x3F, 0x39, 0x8E, 0xAE, 0xFD, 0x49, 0x25, 0xCD, 0xC1, 0x29, 0x4B, 0x4C, 0xC2, 0x8E, 0x4F,
+    0x03, 0xC4, 0x22, 0xAF, 0x8A, 0x34, 0x26, 0x3B, 0xAC, 0x9C, 0x2A, 0x6A, 0xB2, 0x21, 0x98, 0x0C,
+    0x25, 0x33, 0x44, 0xE6, 0x27, 0x9F, 0xBB, 0x43, 0x2C, 0x8E, 0xFE, 0xE4, 0xF8, 0x1D, 0x62, 0xB1,
+    0xC0, 0x11, 0x98, 0xD4, 0xC4, 0x17, 0xAC, 0x72, 0x43, 0xC6, 0xA1, 0xD3, 0x05, 0xD4, 0x60, 0x20,
+    0x91, 0x36, 0xB8, 0x90, 0x67, 0x81, 0x27, 0x12, 0xE1, 0x03, 0xAF, 0xAF, 0xCE, 0x73, 0x2D, 0xD9,
+    0x81, 0x52, 0xE4, 0xC5, 0x5B, 0xD2, 0x3C, 0xCC, 0x31, 0xE6, 0xDE, 0x6B, 0x44, 0xEA, 0x1E, 0x84,
+    0x3F, 0xD5, 0xE3, 0x9C, 0xA6, 0xCF, 0x6B, 0x53, 0x55, 0x9F, 0xE5, 0x66, 0x0A, 0x53, 0x58, 0x60,
+    0xC4, 0x50, 0x03, 0x34, 0x81, 0x1F, 0xB2, 0xB0, 0xAA, 0xAA, 0xF8, 0x4B, 0xE2, 0xC5, 0x9B, 0x5B,
+    0xCD, 0x07, 0xBE, 0xAB, 0x1F, 0xB7, 0x69, 0x97, 0x19, 0x06, 0x0B, 0x34, 0x30, 0xE0, 0x12, 0xAA,
+    0x02, 0x8F, 0x14, 0xA6, 0x40, 0x59, 0x26, 0x76, 0x04, 0x06, 0x0C, 0x0D, 0x0C, 0xA9, 0x06, 0xC7,
+    0xEF, 0xC0, 0xEC, 0x5F, 0x5F, 0xF5, 0x32, 0x23, 0x90, 0x2F, 0x75, 0xFB, 0x82, 0x2A, 0x07, 0xFA,
+    0x58, 0x8B, 0x5C, 0xB0, 0xC6, 0x9E, 0x64, 0xCA, 0xA3, 0x91, 0x23, 0x4B, 0xE0, 0x50, 0xB7, 0x45,
+    0x2A, 0x0D, 0x31, 0x44, 0x22, 0xFC, 0x56, 0xF7, 0x0D, 0x54, 0xD5, 0xBB, 0x33, 0xE3, 0x02, 0xD2,
+    0x22, 0x20, 0x95, 0x86, 0x44, 0x0A, 0xE6, 0x0E, 0x8F, 0x1E, 0x77, 0xA3, 0x2C, 0x0C, 0xF3, 0xAD,
+    0xBF, 0x10, 0x91, 0xD7, 0x1C, 0x0B, 0xCA, 0xF5, 0x38, 0x4C, 0xED, 0x61, 0x83, 0x23, 0x28, 0x4F,
+    0xEA, 0xD5, 0xDF, 0xF8, 0xC1, 0x17, 0xFC, 0x33, 0xD7, 0x8B, 0x28, 0xE3, 0x04, 0x9C, 0x26, 0x70,
+    0xFC, 0x54, 0x71, 0x6F, 0xDB, 0x9E, 0xC3, 0x53, 0xFF, 0xD9, 0x6F, 0xE6, 0x3F, 0x11, 0x91, 0x57,
+    0xB2, 0x7D, 0x39, 0x5E, 0x7B, 0x9A, 0xE3, 0x43, 0xEF, 0xDA, 0xC4, 0xBC, 0xF8, 0xFE, 0x13, 0xA7,
+    0x16, 0xFF, 0x7D, 0xB5, 0xF4, 0x77, 0x24, 0x15, 0x4B, 0xF7, 0xA0, 0x5F, 0x76, 0x9A, 0x33, 0x6C,
+    0x47, 0x05, 0xDB, 0x1B, 0x79, 0xFE, 0x96, 0x88, 0xFC, 0xBD, 0xC5, 0x28, 0x8B, 0x57, 0xD6, 0x10,
+    0xF1, 0xE1, 0xBD, 0x86, 0x95, 0x67, 0x52, 0x47, 0x7F, 0x53, 0x0F, 0x4E, 0xFB, 0xC7, 0x5C, 0x76,
+    0x5F, 0xC3, 0x0F, 0x9C, 0x78, 0x70, 0x70, 0xDA, 0x0F, 0xBF, 0x4F, 0xEA, 0x49, 0xE1, 0xC8, 0xFC,
+    0xF6, 0xBE, 0x83, 0xF7, 0xDD, 0xFE, 0x98, 0x5B, 0x79, 0xE1, 0x49, 0xF5, 0x37, 0x5E, 0x09, 0xCA,
+    0x07, 0x4F, 0x7D, 0x25, 0x91, 0xEE, 0x58, 0xBE, 0x0A, 0xAB, 0x84, 0x0E, 0x9D, 0xF5, 0x13, 0x25,
+    0xB4, 0x68, 0x06, 0xA7, 0x94, 0xBD, 0x38, 0x08, 0x77, 0x5F, 0x7F, 0x2A, 0x96, 0x76, 0x09, 0x16,
+    0x61, 0x11, 0x1E, 0xE9, 0xBD, 0xDD, 0x41, 0x45, 0x54, 0x70, 0x12, 0xCE, 0x10, 0x54, 0xA8, 0x82,
+    0xC3, 0x86, 0x65, 0x43, 0x65, 0xD4, 0x57, 0xD6, 0x8D, 0xCC, 0x08, 0x2B, 0x4E, 0x12, 0x56, 0x1C,
+    0x9A, 0x0F, 0x32, 0xE0, 0x0F, 0x30, 0x30, 0x18, 0x93, 0xA9, 0x6B, 0x19, 0x77, 0x6F, 0x6E, 0x95,
+    0x22, 0xDD, 0x5C, 0x44, 0x07, 0x10, 0x02, 0x9F, 0xEA, 0x31, 0xEE, 0x80, 0x63, 0x4A, 0xA4, 0x1B,
+    0x6D, 0x6D, 0xFD, 0x85, 0x03, 0x25, 0x22, 0x2B, 0x22, 0x9D, 0xB2, 0xF3, 0xF0, 0xEA, 0x3D, 0x66,
+    0x0C, 0x7C, 0xF4, 0x6A, 0xFD, 0xC7, 0x5F, 0xFC, 0xCB, 0xBF, 0x3E, 0xE5, 0x96, 0x2F, 0xF2, 0xAA,
+    0x55, 0x5F, 0xE4, 0xF0, 0x29, 0xF6, 0x15, 0x8F, 0xAE, 0x02, 0x0F, 0x03, 0x3E, 0x58, 0xC5, 0x27,
+    0x22, 0xFE, 0xB3, 0x5B, 0x5B, 0x1E, 0x82, 0x37, 0x44, 0x24, 0x11, 0xE9, 0x51, 0x19, 0x1E, 0x02,
+    0xF8, 0xA9, 0xA7, 0xE7, 0xC5, 0xF0, 0xAF, 0x4F, 0xBD, 0xD6, 0x94, 0xEA, 0x55, 0xAF, 0xBE, 0x8F,
+    0xF2, 0x04, 0xC0, 0xB9, 0x07, 0xD1, 0xC5, 0x0E, 0xDB, 0xEC, 0x68, 0x91, 0xE6, 0x8F, 0xB6, 0xB6,
+    0xFE, 0xA7, 0x85, 0xBF, 0x17, 0x91, 0x48, 0xA4, 0x8E, 0x0A, 0x9D, 0x45, 0xC5, 0x36, 0x07, 0xC8,
+    0x38, 0x0A, 0x0B, 0x71, 0x81, 0x7A, 0xC9, 0x13, 0xFA, 0x4B, 0x7D, 0xB0, 0x6D, 0x1C, 0x7A, 0x96,
+    0x98, 0x88, 0x60, 0x44, 0x6C, 0xE8, 0x95, 0x63, 0x84, 0xC7, 0xD8, 0x1D, 0x02, 0x3F, 0x80, 0xD1,
+    0x49, 0xD0, 0x2F, 0x66, 0xF0, 0x96, 0x85, 0xD4, 0xF5, 0x69, 0x92, 0x7D, 0xA4, 0xB4, 0x67, 0x64,
+    0x32, 0x63, 0xE9, 0x69, 0x77, 0x80, 0xB6, 0xCF, 0xAE, 0x77, 0xD0, 0xF0, 0xF9, 0xB3, 0x94, 0x52,
+    0x34, 0x51, 0xB5, 0x43, 0x33, 0x60, 0xB8, 0x84, 0x31, 0x59, 0xB4, 0xEB, 0xC2, 0xAA, 0xC6, 0x0F,
+    0xD9, 0x31, 0x76, 0x1C, 0x74, 0x2D, 0x71, 0x33, 0x47, 0xB3, 0x1F, 0x15, 0xB9, 0xBB, 0x75, 0xC1,
+    0x92, 0xC0, 0x94, 0xD0, 0xA3, 0x2D, 0xC9, 0x1F, 0x6D, 0xCD, 0x44, 0xFA, 0xE2, 0xBE, 0x5A, 0x11,
+    0x91, 0xBD, 0x08, 0xD5, 0xC1, 0xAF, 0x07, 0x36, 0x14, 0x79, 0x92, 0xF4, 0xF5, 0xD2, 0xAB, 0x9A,
+    0xA4, 0x48, 0x40, 0xA8, 0x31, 0x1B, 0xDA, 0x52, 0xEF, 0x8C, 0x30, 0x8F, 0xF9, 0x9A, 0x3A, 0xDA,
+    0x75, 0xA6, 0x88, 0x4D, 0xB6, 0xC3, 0x78, 0xA4, 0x8B, 0xD0, 0x4F, 0x77, 0x30, 0xCF, 0xDC, 0x2D,
+    0x18, 0xAB, 0x96, 0xA8, 0xD2, 0x9E, 0x09, 0x93, 0xAE, 0xAC, 0xA2, 0xAB, 0x32, 0xE3, 0x37, 0xFA,
+    0x65, 0x74, 0x15, 0x94, 0x87, 0xA8, 0x06, 0xDD, 0xF6, 0x71, 0xCA, 0xC5, 0x21, 0x0C, 0x92, 0x3E,
+    0xA6, 0xBA, 0x6D, 0x0A, 0xBC, 0xB6, 0x61, 0x15, 0x39, 0x65, 0x55, 0x15, 0xD9, 0xD0, 0x9B, 0x2C,
+    0xA8, 0x0D, 0x34, 0x4B, 0x7D, 0xDE, 0xCF, 0x2C, 0x15, 0xE9, 0x16, 0xF2, 0x7C, 0xCD, 0x88, 0xC8,
+    0xEE, 0x9D, 0xFC, 0x73, 0xF7, 0xD8, 0xAD, 0x3C, 0x4B, 0x6C, 0x60, 0x30, 0x36, 0x7A, 0x07, 0xBB,
+    0xEB, 0x5F, 0xC8, 0x6E, 0x8E, 0xE5, 0x44, 0x22, 0x2E, 0xBE, 0xB3, 0x75, 0x3E, 0xB6, 0x7D, 0xCA,
+    0x80, 0xB6, 0xF3, 0x84, 0x21, 0x0F, 0x8C, 0xB6, 0xB6, 0xB6, 0x62, 0x11, 0xD9, 0x75, 0x79, 0xBE,
+    0x5A, 0xCF, 0x73, 0x47, 0x23, 0xDB, 0xC7, 0xC1, 0x7A, 0x20, 0x5D, 0x8A, 0x64, 0xA1, 0x88, 0xEB,
+    0x9F, 0x58, 0xD8, 0xC8, 0x02, 0x91, 0x3A, 0xEA, 0x2E, 0x7C, 0x23, 0xF2, 0xCA, 0xAA, 0x2A, 0xA8,
+    0x42, 0x4F, 0x4D, 0xC3, 0x80, 0x01, 0x27, 0x31, 0x5B, 0x17, 0x6E, 0x3E, 0x27, 0x22, 0xBE, 0xFE,
+    0xCD, 0xD7, 0xD7, 0x86, 0x6C, 0x63, 0x8A, 0x01, 0x81, 0x3F, 0x09, 0xA9, 0xCE, 0x50, 0x77, 0x2D,
+    0x24, 0x22, 0x0E, 0x91, 0x9A, 0x01, 0x7D, 0xA6, 0xD1, 0xDC, 0xE1, 0x92, 0x93, 0x88, 0xB8, 0xC9,
+    0xCD, 0xAD, 0xF3, 0x67, 0xE7, 0x60, 0xDE, 0x64, 0xA0, 0x6E, 0x6E, 0x5D, 0xB8, 0x2E, 0x22, 0xCD,
+    0x70, 0x9E, 0xF2, 0x10, 0xD6, 0x40, 0x7A, 0x0E, 0x42, 0x11, 0xC9, 0xB4, 0x88, 0x3B, 0x96, 0x43,
+    0x2C, 0x92, 0x85, 0x5B, 0xCF, 0xCF, 0xE8, 0xBD, 0x98, 0x4C, 0xF7, 0xEE, 0xF6, 0xC0, 0xE0, 0x77,
+    0xB6, 0xB6, 0x2E, 0x18, 0x11, 0xB9, 0x9E, 0xE7, 0x8F, 0xBD, 0x5B, 0xAA, 0x46, 0x62, 0x27, 0x22,
+    0x45, 0x2C, 0x5D, 0x3F, 0x47, 0x17, 0xDE, 0xCC, 0x88, 0x44, 0x1C, 0xCF, 0xDF, 0x94, 0x0C, 0xAF,
+    0x6A, 0x16, 0x49, 0x88, 0xAC, 0xAA, 0xF0, 0x4C, 0x59, 0xC4, 0x1C, 0xBA, 0x70, 0xF3, 0xF9, 0x5D,
+    0x11, 0xA9, 0xF3, 0xCF, 0xAF, 0x8E, 0x89, 0x8A, 0x18, 0xBC, 0xB6, 0x2C, 0x2A, 0x47, 0xB4, 0xE9,
+    0xE1, 0xAE, 0x8F, 0x45, 0xAA, 0xA8, 0x4F, 0x6E, 0xF4, 0xC0, 0xE2, 0xDE, 0x78, 0xAC, 0x11, 0x8B,
+    0x54, 0xE1, 0xD6, 0x96, 0x64, 0x73, 0xEA, 0x52, 0x20, 0xBA, 0xD2, 0x6D, 0x6D, 0xF9, 0x52, 0x64,
+    0x36, 0x77, 0x68, 0x68, 0xDB, 0x7B, 0xF4, 0x8E, 0xFB, 0x89, 0x48, 0x15, 0x8B, 0x14, 0xE4, 0x79,
+    0x9E, 0x7F, 0x54, 0x44, 0xE4, 0x4A, 0xB7, 0xF5, 0x7C, 0x1D, 0x7A, 0xB4, 0xD5, 0x96, 0xA4, 0x97,
+    0xF7, 0x29, 0xA1, 0xFF, 0xA7, 0x55, 0xAD, 0x37, 0x41, 0xF9, 0x9A, 0x78, 0x23, 0x76, 0x21, 0xCF,
+    0x57, 0x4B, 0x91, 0xEF, 0x74, 0x5B, 0x17, 0x56, 0x6A, 0x96, 0x22, 0xCF, 0xB2, 0xAE, 0x28, 0xF4,
+    0x3C, 0x59, 0x2C, 0xDE, 0x4B, 0x18, 0xEB, 0xD3, 0x8D, 0xF5, 0x3C, 0x2B, 0xD8, 0xC1, 0x08, 0x42,
+    0xCF, 0xD1, 0x18, 0x7C, 0x4D, 0x74, 0xED, 0xBB, 0xF9, 0xE5, 0x89, 0x48, 0xBD, 0x97, 0xE2, 0x79,
+    0x2C, 0xCF, 0x45, 0x7E, 0x9C, 0xE7, 0xFD, 0x3B, 0x24, 0x67, 0xA0, 0x26, 0xF0, 0x84, 0x0E, 0x65,
+    0xD1, 0x05, 0x06, 0x4E, 0xC2, 0x00, 0xC6, 0x50, 0xC3, 0x4F, 0x5D, 0x19, 0x42, 0x9F, 0x1C, 0xB1,
+    0xB4, 0xCF, 0xCC, 0x57, 0x8E, 0xC0, 0x83, 0x87, 0x33, 0xF7, 0x5F, 0x8B, 0x2C, 0xCA, 0x12, 0x54,
+    0xD0, 0x3B, 0x0B, 0x07, 0x7B, 0x1E, 0x58, 0x58, 0xE6, 0xE1, 0xE5, 0x87, 0xCF, 0xFE, 0x7E, 0xAB,
+    0xC5, 0xD1, 0x11, 0x89, 0x4B, 0x7F, 0xBF, 0x79, 0x74, 0xF9, 0x91, 0xFE, 0x12, 0x40, 0x16, 0xCA,
+    0xE3, 0xAF, 0xD7, 0xFE, 0xE4, 0x19, 0xF5, 0xD7, 0xBC, 0xE6, 0xB6, 0x27, 0x4D, 0x70, 0x9E, 0xA3,
+    0xB3, 0xD9, 0x99, 0x79, 0x13, 0x83, 0xB9, 0x00, 0xED, 0xCC, 0xFD, 0xA2, 0xBE, 0xCF, 0xC0, 0x51,
+    0xAE, 0x17, 0x9E, 0xA8, 0xD8, 0x2A, 0x74, 0x26, 0xD6, 0xF0, 0x71, 0x17, 0xA3, 0xAA, 0xC5, 0x5E,
+    0x2F, 0xD6, 0x03, 0x68, 0x76, 0x7A, 0x77, 0xF1, 0xC0, 0x43, 0x5A, 0x41, 0xE2, 0x7A, 0x6E, 0x9A,
+    0xA2, 0xCF, 0xF4, 0x84, 0x60, 0x16, 0x5E, 0x97, 0x57, 0x2B, 0xBF, 0xE4, 0x96, 0x55, 0x75, 0x98,
+    0x1D, 0x65, 0xFF, 0x38, 0xBB, 0xDC, 0x34, 0xBA, 0xD6, 0x19, 0xA0, 0x2B, 0x5D, 0x25, 0x6D, 0xDA,
+    0x2C, 0x1B, 0x3F, 0x38, 0x1D, 0xD9, 0x53, 0xA7, 0x23, 0x7B, 0xEA, 0xCC, 0x61, 0x3F, 0x18, 0x4D,
+    0xCF, 0xD6, 0xA6, 0x8A, 0xAB, 0x7E, 0x6D, 0xEB, 0x29, 0xFC, 0xC7, 0x7C, 0x87, 0x79, 0xBE, 0x96,
+    0x8A, 0x48, 0xFF, 0x22, 0x40, 0x0F, 0x4A, 0xE7, 0x39, 0x52, 0xC4, 0xD9, 0xDC, 0xC5, 0xDC, 0xCE,
+    0x45, 0x56, 0x3B, 0x08, 0x9A, 0xBD, 0x99, 0xBA, 0x97, 0x0B, 0xBA, 0xB1, 0x97, 0x8C, 0xEE, 0x81,
+    0x4B, 0x79, 0xBE, 0x96, 0x88, 0xC8, 0x0B, 0x22, 0xD2, 0x7E, 0xF4, 0xFB, 0x1B, 0x6F, 0xDD, 0xFF,
+    0xF9, 0x87, 0xE2, 0xE8, 0x81, 0xC1, 0xD2, 0x7B, 0xDB, 0x1F, 0xF9, 0x60, 0x9F, 0x18, 0xD2, 0xCE,
+    0x73, 0xCA, 0x13, 0x0F, 0x66, 0x00, 0xD1, 0x8B, 0x05, 0xE1, 0x75, 0x0F, 0x7E, 0x08, 0x67, 0x74,
+    0xC1, 0x10, 0x8F, 0x61, 0x88, 0x2E, 0x22, 0xAB, 0x2C, 0x3E, 0xF0, 0x2C, 0xD1, 0x10, 0xD9, 0x01,
+    0xD4, 0x09, 0x24, 0x26, 0x43, 0xD9, 0xA3, 0xB0, 0x60, 0x0A, 0xA2, 0x2B, 0x9E, 0xB0, 0x1A, 0x42,
+    0xAD, 0x0B, 0xC6, 0x81, 0xEF, 0xDD, 0xE3, 0x44, 0x85, 0x2E, 0xF0, 0xCA, 0xB1, 0x18, 0x78, 0x22,
+    0xBB, 0x03, 0x7E, 0x00, 0x4B, 0x31, 0xA8, 0x6B, 0x73, 0x95, 0x1B, 0x57, 0xBD, 0x4B, 0x9E, 0x29,
+    0xF0, 0xD9, 0xAF, 0x63, 0xA4, 0xA5, 0xFB, 0x58, 0xAB, 0x2D, 0xCD, 0x90, 0xE0, 0xC7, 0x1E, 0xF5,
+    0x3D, 0x8B, 0x79, 0x1A, 0x86, 0x63, 0x78, 0xF3, 0x17, 0x9E, 0xBA, 0xA3, 0xF0, 0x07, 0xEF, 0xE5,
+    0xA1, 0xDA, 0xA3, 0x76, 0x2B, 0x12, 0xED, 0x82, 0x46, 0xDF, 0x29, 0x8B, 0x48, 0x6A, 0x58, 0x9B,
+    0x0B, 0x42, 0xD2, 0x10, 0xBD, 0x6C, 0xA9, 0x1F, 0xFE, 0xE9, 0x9C, 0xFE, 0x5F, 0xFE, 0x27, 0xF4,
+    0x1C, 0x59, 0x22, 0x7A, 0xC1, 0x32, 0xA9, 0x09, 0xBE, 0xB9, 0xE7, 0x82, 0xB0, 0xBD, 0xA2, 0xBD,
+    0x2F, 0x26, 0xF8, 0xD3, 0xDB, 0x18, 0x9A, 0x8E, 0xA0, 0x9D, 0x11, 0xB4, 0x47, 0xE6, 0x88, 0xFC,
+    0x12, 0xB4, 0x1D, 0x41, 0x3B, 0xED, 0xDF, 0x56, 0xF8, 0xD9, 0x9B, 0xDE, 0xF7, 0x1F, 0x01, 0x8C,
+    0xBB, 0xD9, 0x51, 0x00, 0x8E, 0x5E, 0xEE, 0xC6, 0xEF, 0xA5, 0xA1, 0x77, 0x23, 0xE2, 0x9D, 0x50,
+    0x78, 0x15, 0xD2, 0x26, 0xDC, 0x7D, 0x5D, 0x2E, 0xBD, 0x9F, 0x75, 0x77, 0x2F, 0xB8, 0x95, 0xE7,
+    0x46, 0xA4, 0xED, 0x53, 0x7E, 0xE6, 0x91, 0x73, 0x69, 0x53, 0x11, 0x7F, 0x30, 0x3B, 0x90, 0xD6,
+    0x8B, 0xDF, 0x2E, 0xDB, 0x8B, 0x71, 0x0D, 0x24, 0xD5, 0x89, 0xB2, 0xDB, 0xF0, 0x49, 0x73, 0x24,
+    0x3C, 0xF7, 0x30, 0x7C, 0x4A, 0x44, 0xEC, 0xE7, 0xE4, 0xEB, 0x7B, 0x14, 0xFC, 0x96, 0xFC, 0xAD,
+    0x12, 0x91, 0x07, 0xE0, 0x41, 0xC8, 0x88, 0x1E, 0xDF, 0xBA, 0xFC, 0x35, 0x11, 0x16, 0xA1, 0x42,
+    0x13, 0x8B, 0xFC, 0xEE, 0xCD, 0x6F, 0x9C, 0x82, 0x55, 0xF8, 0x9D, 0xAD, 0xAD, 0xF3, 0x7B, 0x0A,
+    0x73, 0x9E, 0x6C, 0x24, 0x22, 0x57, 0xF2, 0x3C, 0xBF, 0xF7, 0xDA, 0x9E, 0xC8, 0x6E, 0x3F, 0x3F,
+    0x3F, 0x44, 0xD8, 0x90, 0x54, 0x61, 0x47, 0xE2, 0x38, 0x0B, 0x89, 0x23, 0x9C, 0xC1, 0xC4, 0x11,
+    0x35, 0xFD, 0x7B, 0x51, 0xC0, 0x44, 0x9A, 0x89, 0xB4, 0x1F, 0x82, 0x11, 0x24, 0x15, 0x61, 0xD7,
+    0xDF, 0xD7, 0x12, 0xB6, 0x24, 0xEE, 0xE0, 0x8C, 0xD4, 0xCD, 0x55, 0xEB, 0xBD, 0x9B, 0xE7, 0x27,
+    0x0F, 0x10, 0x16, 0x24, 0x56, 0x7B, 0xCA, 0x2C, 0x71, 0xE1, 0x8C, 0x32, 0xD3, 0x75, 0x38, 0x23,
+    0xF2, 0xB4, 0x30, 0x29, 0xE2, 0x8A, 0xA0, 0x63, 0x52, 0x10, 0x35, 0x41, 0x07, 0x89, 0x8D, 0x3C,
+    0x9C, 0xEF, 0x2D, 0xEC, 0xF9, 0x76, 0x88, 0xA0, 0x40, 0x35, 0x74, 0x10, 0x57, 0x51, 0x73, 0xDF,
+    0x53, 0xC6, 0xAA, 0x9A, 0xC4, 0xE9, 0xFA, 0xED, 0xE6, 0x55, 0x4D, 0x77, 0x5F, 0x13, 0xC7, 0xF2,
+    0xD5, 0xFD, 0xCB, 0xA5, 0xF2, 0xFB, 0x2D, 0x14, 0xBF, 0xEF, 0xA5, 0x96, 0x3D, 0xA3, 0x26, 0xF2,
+    0x13, 0x11, 0x1F, 0x8B, 0x9C, 0x7B, 0x87, 0x00, 0xB0, 0xD8, 0xDF, 0x19, 0x7C, 0xFC, 0xBB, 0x73,
+    0x33, 0xE3, 0xCE, 0xF9, 0x94, 0x01, 0x09, 0x4B, 0x98, 0xCC, 0xA0, 0xAC, 0xB2, 0x81, 0x0F, 0x2A,
+    0x06, 0xD4, 0x98, 0x62, 0x40, 0xE8, 0x4F, 0x42, 0xFA, 0x64, 0x86, 0x12, 0x91, 0xEC, 0xB8, 0x88,
+    0x63, 0x7B, 0xAE, 0x26, 0x4F, 0xB2, 0xA7, 0xAE, 0xDF, 0xC6, 0x40, 0xF3, 0x34, 0x58, 0xCF, 0xB1,
+    0x7C, 0x67, 0x4E, 0x72, 0x29, 0x19, 0xD1, 0xA6, 0x47, 0xD9, 0x51, 0x9F, 0x4E, 0x7B, 0x86, 0x3D,
+    0xC5, 0x62, 0x88, 0x0A, 0x6D, 0x43, 0xA7, 0x2A, 0xFC, 0x3E, 0x92, 0xCD, 0x1C, 0x00, 0x86, 0x73,
+    0x63, 0xEB, 0x9E, 0x14, 0xDE, 0xB3, 0x8C, 0xD2, 0x7D, 0x86, 0x8B, 0xB2, 0xF3, 0xB8, 0xC7, 0x60,
+    0xBF, 0xAD, 0x93, 0x66, 0xEC, 0x23, 0x79, 0x2F, 0x7F, 0x47, 0x44, 0x3E, 0x22, 0x22, 0xEE, 0x57,
+    0xC1, 0xD0, 0x89, 0x48, 0x17, 0x8B, 0x48, 0xD1, 0x6B, 0x03, 0x11, 0x4B, 0xFC, 0xC4, 0x13, 0x2E,
+    0xA8, 0x4E, 0x84, 0xEE, 0x30, 0xA7, 0x43, 0x7B, 0x31, 0x70, 0x6A, 0xB3, 0x88, 0x32, 0xFD, 0x10,
+    0x27, 0x38, 0xF1, 0x87, 0xF9, 0xB7, 0xF3, 0xFF, 0x28, 0x22, 0xF2, 0x46, 0x16, 0x65, 0xD1, 0x27,
+    0x38, 0xC1, 0x89, 0x65, 0x4E, 0x73, 0xF1, 0x62, 0xE0, 0x54, 0x51, 0x45, 0xD9, 0x20, 0xA8, 0x4E,
+    0x28, 0x17, 0x34, 0xA7, 0x2F, 0xCD, 0x13, 0x01, 0x16, 0xB2, 0x3E, 0x6C, 0x3F, 0x6F, 0x3A, 0x8B,
+    0x5C, 0x50, 0x11, 0xBA, 0xC3, 0x10, 0xDA, 0x8B, 0xA0, 0x36, 0x0B, 0xD0, 0x0F, 0x01, 0x27, 0xFE,
+    0x30, 0xCF, 0xF7, 0x9A, 0x86, 0xE8, 0x13, 0xC0, 0x89, 0x65, 0xE0, 0xE2, 0x45, 0x50, 0x85, 0x87,
+    0x41, 0x50, 0xA1, 0x5C, 0xD0, 0xF0, 0x73, 0x9A, 0xF6, 0x28, 0x67, 0x2A, 0x12, 0xFB, 0xAD, 0x2A,
+    0x7C, 0x69, 0xF3, 0xD9, 0x6A, 0x51, 0x3F, 0x14, 0xBE, 0xEA, 0x4E, 0x7C, 0x21, 0x9C, 0xF1, 0x7B,
+    0x56, 0x79, 0xDE, 0x60, 0xA9, 0x52, 0x9F, 0x08, 0xBF, 0x53, 0x9D, 0x58, 0x5E, 0x0C, 0xAB, 0x8B,
+    0xDF, 0x72, 0xE1, 0x6B, 0xC5, 0x8C, 0xB0, 0x0D, 0xFC, 0x2F, 0x6C, 0xBA, 0x42, 0xB9, 0xC3, 0x90,
+    0xD8, 0x8B, 0x84, 0x2F, 0x6D, 0x16, 0x2C, 0xEA, 0x13, 0x84, 0xEE, 0xC4, 0x17, 0x58, 0xE4, 0xF7,
+    0x6C, 0xE8, 0x78, 0x83, 0x45, 0xD4, 0x27, 0x42, 0xC7, 0x89, 0xE5, 0x45, 0xB8, 0xF8, 0x2D, 0x87,
+    0x2A, 0x66, 0x30, 0x78, 0xF7, 0xA6, 0x79, 0xE7, 0x1B, 0x4F, 0xBF, 0xD4, 0xE9, 0xC2, 0xC7, 0x5E,
+    0x5F, 0x2B, 0x45, 0xEE, 0x88, 0x48, 0x75, 0xE4, 0x52, 0x37, 0x3D, 0xC0, 0x01, 0x16, 0x62, 0x6B,
+    0xAC, 0x7E, 0xD9, 0x2B, 0xAF, 0x9A, 0xBA, 0x7F, 0xC7, 0x0F, 0xD6, 0x08, 0xCA, 0x3F, 0x15, 0x1B,
+    0x8A, 0xFC, 0xA0, 0x0E, 0xBD, 0xAE, 0x1E, 0x0C, 0x7C, 0x6F, 0x3A, 0x8D, 0x61, 0x44, 0x02, 0xEB,
+    0x22, 0x62, 0x27, 0x22, 0xE2, 0x69, 0x98, 0xCE, 0x2B, 0x4D, 0xA1, 0x2D, 0xAA, 0x0A, 0x3D, 0x3F,
+    0xA7, 0xB2, 0x2C, 0x26, 0x5F, 0x47, 0x9A, 0x52, 0x80, 0x1C, 0x22, 0xF1, 0x44, 0xAF, 0x97, 0x28,
+    0x17, 0xD9, 0xD0, 0x53, 0xDC, 0x7B, 0x67, 0x6D, 0xBD, 0xFF, 0x83, 0xBE, 0xFD, 0x11, 0x09, 0xA6,
+    0xD0, 0x56, 0x55, 0xE1, 0xCF, 0xA8, 0x28, 0x8B, 0xC9, 0x79, 0x69, 0xCA, 0x16, 0xF2, 0x23, 0x84,
+    0xD2, 0xA2, 0xDE, 0x2C, 0x51, 0x5E, 0xDB, 0xC0, 0x87, 0x9E, 0xE9, 0xFC, 0x91, 0x75, 0xD1, 0x76,
+    0x22, 0x57, 0xDF, 0x63, 0xA3, 0x33, 0x7A, 0x5A, 0x83, 0xF2, 0x4F, 0xA4, 0x21, 0x14, 0x79, 0xB3,
+    0x24, 0xF4, 0xDA, 0x2B, 0x1B, 0x78, 0x6A, 0x56, 0x7B, 0xBE, 0xF4, 0xDD, 0x65, 0x5D, 0x44, 0xC4,
+    0x4D, 0x44, 0x44, 0x6A, 0x1A, 0xA6, 0x0C, 0xFB, 0x76, 0x33, 0x53, 0x68, 0xAB, 0x9C, 0xDA, 0x43,
+    0x48, 0x3F, 0xF7, 0x42, 0x59, 0x4C, 0xCE, 0x25, 0x37, 0xA4, 0x29, 0xDB, 0xB4, 0x03, 0xC8, 0x8F,
+    0x10, 0x94, 0x5F, 0x96, 0x19, 0xA1, 0xC8, 0xED, 0xF5, 0x2C, 0xF4, 0xBA, 0x56, 0x2E, 0xF0, 0x34,
+    0xD4, 0xEC, 0x30, 0x66, 0xC8, 0x88, 0x18, 0x93, 0xAD, 0x8B, 0xC8, 0x8A, 0x9B, 0x88, 0x88, 0xFB,
+    0x15, 0xFD, 0x79, 0x90, 0xD1, 0xC7, 0x61, 0xF5, 0xCB, 0x16, 0x06, 0x0F, 0x40, 0x58, 0xE1, 0x31,
+    0x45, 0x64, 0x19, 0x11, 0x73, 0x50, 0x44, 0xDA, 0x89, 0x88, 0x78, 0x53, 0x68, 0xDB, 0xF3, 0xA0,
+    0x61, 0xDA, 0x8F, 0xF8, 0xBB, 0x56, 0x45, 0x96, 0xB2, 0x88, 0x6F, 0x5D, 0x93, 0x22, 0xD9, 0x4B,
+    0x87, 0x38, 0x06, 0x50, 0xB6, 0xC0, 0xE5, 0x75, 0x0B, 0x83, 0xA0, 0x86, 0x93, 0xA4, 0x10, 0x15,
+    0xDA, 0x12, 0xF8, 0xD0, 0x13, 0x4B, 0x28, 0x6D, 0xFC, 0xD4, 0x4B, 0x22, 0x86, 0x6D, 0x6D, 0x95,
+    0x7D, 0x5F, 0xE8, 0x99, 0xC1, 0x94, 0xA4, 0x26, 0x21, 0x14, 0xA7, 0x2D, 0xBA, 0x0D, 0x3D, 0x59,
+    0x52, 0x4C, 0xF9, 0x42, 0x58, 0x25, 0x9C, 0x64, 0x27, 0xB2, 0xD1, 0xEB, 0xD3, 0xA0, 0x6B, 0xA5,
+    0x25, 0x99, 0x05, 0xAB, 0xF3, 0x17, 0xA3, 0xB3, 0xB9, 0x53, 0x1C, 0x60, 0x52, 0xCC, 0xB3, 0xA0,
+    0x80, 0xD3, 0x71, 0x01, 0x9C, 0xE6, 0x0C, 0xB0, 0x71, 0x40, 0x17, 0x30, 0x91, 0xAA, 0x81, 0x89,
+    0xCC, 0x92, 0x82, 0x89, 0xC8, 0x73, 0x0D, 0x13, 0x91, 0x57, 0xA4, 0x98, 0x88, 0x14, 0x65, 0x93,
+    0x48, 0x43, 0xDA, 0x85, 0xD2, 0x52, 0x76, 0x24, 0xF2, 0xB8, 0x74, 0x84, 0xF2, 0xAA, 0x74, 0x90,
+    0xB4, 0x65, 0x07, 0xA1, 0x48, 0x07, 0x24, 0xDF, 0xE9, 0x80, 0xD0, 0x8F, 0x00, 0x16, 0x97, 0x60,
+    0x9E, 0xC1, 0xCC, 0xDC, 0x6F, 0x16, 0x00, 0xFF, 0x1F,
 };
 
 static const EpdGlyph bookerly_12_regularGlyphs[] = {
@@ -1551,7 +1580,7 @@ static const EpdGlyph bookerly_12_regularGlyphs[] = {
     { 3, 23, 7, 2, 20, 18, 5364 }, // |
     { 8, 25, 10, 0, 20, 50, 5382 }, // }
     { 12, 5, 16, 2, 11, 15, 5432 }, // ~
-    { 0, 0, 5, 0, 0, 0, 0 }, //  
+    { 0, 0, 5, 0, 0, 0, 5447 }, //  
     { 4, 20, 7, 1, 14, 20, 0 }, // ¡
     { 13, 25, 16, 1, 20, 82, 20 }, // ¢
     { 14, 19, 16, 1, 18, 67, 102 }, // £
@@ -1562,642 +1591,649 @@ static const EpdGlyph bookerly_12_regularGlyphs[] = {
     { 9, 4, 17, 4, 19, 9, 368 }, // ¨
     { 19, 19, 20, 0, 18, 91, 377 }, // ©
     { 9, 12, 11, 1, 18, 27, 468 }, // ª
-    { 14, 10, 13, 0, 11, 35, 495 }, // «
-    { 11, 7, 16, 2, 12, 20, 530 }, // ¬
-    { 8, 3, 9, 1, 8, 6, 550 }, // ­
-    { 14, 14, 15, 0, 20, 49, 556 }, // ®
-    { 9, 3, 17, 4, 18, 7, 605 }, // ¯
-    { 9, 9, 13, 2, 18, 21, 612 }, // °
-    { 11, 15, 16, 2, 15, 42, 633 }, // ±
-    { 9, 12, 11, 1, 21, 27, 675 }, // ²
-    { 9, 13, 11, 1, 21, 30, 702 }, // ³
-    { 5, 7, 17, 6, 21, 9, 732 }, // ´
-    { 16, 20, 17, 1, 14, 80, 741 }, // µ
-    { 13, 22, 14, 0, 18, 72, 821 }, // ¶
-    { 5, 4, 7, 1, 9, 5, 893 }, // ·
-    { 5, 6, 17, 6, -1, 8, 898 }, // ¸
-    { 8, 12, 11, 2, 21, 24, 906 }, // ¹
-    { 9, 12, 11, 1, 18, 27, 930 }, // º
-    { 13, 10, 13, 1, 11, 33, 957 }, // »
-    { 24, 21, 27, 2, 19, 126, 990 }, // ¼
-    { 24, 21, 27, 2, 19, 126, 1116 }, // ½
-    { 25, 21, 27, 1, 19, 132, 1242 }, // ¾
-    { 9, 20, 12, 1, 14, 45, 1374 }, // ¿
-    { 19, 24, 19, 0, 24, 114, 1419 }, // À
-    { 19, 24, 19, 0, 24, 114, 1533 }, // Á
-    { 19, 24, 19, 0, 24, 114, 1647 }, // Â
-    { 19, 24, 19, 0, 24, 114, 1761 }, // Ã
-    { 19, 23, 19, 0, 23, 110, 1875 }, // Ä
-    { 19, 25, 19, 0, 25, 119, 1985 }, // Å
-    { 24, 18, 23, -1, 18, 108, 2104 }, // Æ
-    { 14, 25, 16, 1, 18, 88, 2212 }, // Ç
-    { 14, 24, 16, 1, 24, 84, 2300 }, // È
-    { 14, 24, 16, 1, 24, 84, 2384 }, // É
-    { 14, 24, 16, 1, 24, 84, 2468 }, // Ê
-    { 14, 23, 16, 1, 23, 81, 2552 }, // Ë
-    { 8, 24, 9, 1, 24, 48, 2633 }, // Ì
-    { 8, 24, 9, 1, 24, 48, 2681 }, // Í
-    { 9, 24, 9, 0, 24, 54, 2729 }, // Î
-    { 10, 23, 9, 0, 23, 58, 2783 }, // Ï
-    { 18, 19, 19, 0, 18, 86, 2841 }, // Ð
-    { 19, 25, 20, 1, 24, 119, 2927 }, // Ñ
-    { 18, 25, 19, 1, 24, 113, 3046 }, // Ò
-    { 18, 25, 19, 1, 24, 113, 3159 }, // Ó
-    { 18, 25, 19, 1, 24, 113, 3272 }, // Ô
-    { 18, 25, 19, 1, 24, 113, 3385 }, // Õ
-    { 18, 24, 19, 1, 23, 108, 3498 }, // Ö
-    { 10, 11, 16, 3, 14, 28, 3606 }, // ×
-    { 19, 19, 19, 0, 18, 91, 3634 }, // Ø
-    { 19, 25, 19, 0, 24, 119, 3725 }, // Ù
-    { 19, 25, 19, 0, 24, 119, 3844 }, // Ú
-    { 19, 25, 19, 0, 24, 119, 3963 }, // Û
-    { 19, 24, 19, 0, 23, 114, 4082 }, // Ü
-    { 17, 24, 17, 0, 24, 102, 4196 }, // Ý
-    { 14, 18, 16, 1, 18, 63, 4298 }, // Þ
-    { 16, 21, 16, 0, 20, 84, 4361 }, // ß
-    { 13, 22, 14, 1, 21, 72, 4445 }, // à
-    { 13, 22, 14, 1, 21, 72, 4517 }, // á
-    { 13, 21, 14, 1, 20, 69, 4589 }, // â
-    { 13, 21, 14, 1, 20, 69, 4658 }, // ã
-    { 13, 20, 14, 1, 19, 65, 4727 }, // ä
-    { 13, 22, 14, 1, 21, 72, 4792 }, // å
-    { 19, 15, 20, 1, 14, 72, 4864 }, // æ
-    { 11, 21, 13, 1, 14, 58, 4936 }, // ç
-    { 11, 22, 13, 1, 21, 61, 4994 }, // è
-    { 11, 22, 13, 1, 21, 61, 5055 }, // é
-    { 11, 21, 13, 1, 20, 58, 5116 }, // ê
-    { 11, 20, 13, 1, 19, 55, 5174 }, // ë
-    { 8, 21, 8, 0, 21, 42, 5229 }, // ì
-    { 8, 21, 8, 0, 21, 42, 5271 }, // í
-    { 8, 20, 8, 0, 20, 40, 5313 }, // î
-    { 10, 19, 8, -1, 19, 48, 5353 }, // ï
-    { 13, 22, 15, 1, 21, 72, 5401 }, // ð
-    { 17, 20, 17, 0, 20, 85, 5473 }, // ñ
-    { 13, 22, 15, 1, 21, 72, 5558 }, // ò
-    { 13, 22, 15, 1, 21, 72, 5630 }, // ó
-    { 13, 21, 15, 1, 20, 69, 5702 }, // ô
-    { 13, 21, 15, 1, 20, 69, 5771 }, // õ
-    { 13, 20, 15, 1, 19, 65, 5840 }, // ö
-    { 11, 13, 16, 2, 15, 36, 5905 }, // ÷
-    { 15, 15, 15, 0, 14, 57, 5941 }, // ø
-    { 17, 22, 16, 0, 21, 94, 5998 }, // ù
-    { 17, 22, 16, 0, 21, 94, 6092 }, // ú
-    { 17, 21, 16, 0, 20, 90, 6186 }, // û
-    { 17, 20, 16, 0, 19, 85, 6276 }, // ü
-    { 15, 27, 15, 0, 21, 102, 6361 }, // ý
-    { 15, 26, 16, 0, 20, 98, 6463 }, // þ
-    { 15, 25, 15, 0, 19, 94, 6561 }, // ÿ
-    { 19, 23, 19, 0, 23, 110, 0 }, // Ā
-    { 13, 19, 14, 1, 18, 62, 110 }, // ā
-    { 19, 24, 19, 0, 24, 114, 172 }, // Ă
-    { 13, 21, 14, 1, 20, 69, 286 }, // ă
-    { 19, 24, 19, 0, 18, 114, 355 }, // Ą
-    { 13, 20, 14, 1, 14, 65, 469 }, // ą
-    { 14, 25, 16, 1, 24, 88, 534 }, // Ć
-    { 11, 22, 13, 1, 21, 61, 622 }, // ć
-    { 14, 25, 16, 1, 24, 88, 683 }, // Ĉ
-    { 11, 21, 13, 1, 20, 58, 771 }, // ĉ
-    { 14, 25, 16, 1, 24, 88, 829 }, // Ċ
-    { 11, 20, 13, 1, 19, 55, 917 }, // ċ
-    { 14, 25, 16, 1, 24, 88, 972 }, // Č
-    { 11, 22, 13, 1, 21, 61, 1060 }, // č
-    { 17, 25, 19, 1, 24, 107, 1121 }, // Ď
-    { 17, 21, 16, 1, 20, 90, 1228 }, // ď
-    { 18, 19, 19, 0, 18, 86, 1318 }, // Đ
-    { 15, 21, 16, 1, 20, 79, 1404 }, // đ
-    { 14, 23, 16, 1, 23, 81, 1483 }, // Ē
-    { 11, 19, 13, 1, 18, 53, 1564 }, // ē
-    { 14, 24, 16, 1, 24, 84, 1617 }, // Ĕ
-    { 11, 21, 13, 1, 20, 58, 1701 }, // ĕ
-    { 14, 24, 16, 1, 24, 84, 1759 }, // Ė
-    { 11, 20, 13, 1, 19, 55, 1843 }, // ė
-    { 14, 24, 16, 1, 18, 84, 1898 }, // Ę
-    { 11, 20, 13, 1, 14, 55, 1982 }, // ę
-    { 14, 24, 16, 1, 24, 84, 2037 }, // Ě
-    { 11, 22, 13, 1, 21, 61, 2121 }, // ě
-    { 16, 25, 18, 1, 24, 100, 2182 }, // Ĝ
-    { 15, 26, 15, 0, 20, 98, 2282 }, // ĝ
-    { 16, 25, 18, 1, 24, 100, 2380 }, // Ğ
-    { 15, 26, 15, 0, 20, 98, 2480 }, // ğ
-    { 16, 25, 18, 1, 24, 100, 2578 }, // Ġ
-    { 15, 25, 15, 0, 19, 94, 2678 }, // ġ
-    { 16, 25, 18, 1, 18, 100, 2772 }, // Ģ
-    { 15, 28, 15, 0, 22, 105, 2872 }, // ģ
-    { 19, 24, 21, 1, 24, 114, 2977 }, // Ĥ
-    { 18, 26, 17, -1, 26, 117, 3091 }, // ĥ
-    { 21, 18, 21, 0, 18, 95, 3208 }, // Ħ
-    { 17, 20, 17, 0, 20, 85, 3303 }, // ħ
-    { 9, 24, 9, 0, 24, 54, 3388 }, // Ĩ
-    { 9, 20, 8, 0, 20, 45, 3442 }, // ĩ
-    { 9, 23, 9, 0, 23, 52, 3487 }, // Ī
-    { 9, 18, 8, 0, 18, 41, 3539 }, // ī
-    { 9, 24, 9, 0, 24, 54, 3580 }, // Ĭ
-    { 8, 20, 8, 0, 20, 40, 3634 }, // ĭ
-    { 8, 24, 9, 1, 18, 48, 3674 }, // Į
-    { 8, 26, 8, 0, 20, 52, 3722 }, // į
-    { 8, 24, 9, 1, 24, 48, 3774 }, // İ
-    { 8, 14, 8, 0, 14, 28, 3822 }, // ı
-    { 17, 24, 18, 1, 18, 102, 3850 }, // Ĳ
-    { 14, 26, 15, 0, 20, 91, 3952 }, // ĳ
-    { 10, 30, 9, -1, 24, 75, 4043 }, // Ĵ
-    { 10, 26, 7, -2, 20, 65, 4118 }, // ĵ
-    { 18, 25, 18, 1, 18, 113, 4183 }, // Ķ
-    { 15, 27, 15, 0, 20, 102, 4296 }, // ķ
-    { 16, 15, 15, 0, 14, 60, 4398 }, // ĸ
-    { 14, 24, 15, 1, 24, 84, 4458 }, // Ĺ
-    { 8, 26, 8, 0, 26, 52, 4542 }, // ĺ
-    { 14, 25, 15, 1, 18, 88, 4594 }, // Ļ
-    { 8, 27, 8, 0, 20, 54, 4682 }, // ļ
-    { 14, 20, 15, 1, 20, 70, 4736 }, // Ľ
-    { 10, 20, 9, 0, 20, 50, 4806 }, // ľ
-    { 14, 18, 15, 1, 18, 63, 4856 }, // Ŀ
-    { 12, 20, 12, 0, 20, 60, 4919 }, // ŀ
-    { 16, 18, 15, -1, 18, 72, 4979 }, // Ł
-    { 10, 20, 8, -1, 20, 50, 5051 }, // ł
-    { 19, 25, 20, 1, 24, 119, 5101 }, // Ń
-    { 17, 21, 17, 0, 21, 90, 5220 }, // ń
-    { 19, 25, 20, 1, 18, 119, 5310 }, // Ņ
-    { 17, 21, 17, 0, 14, 90, 5429 }, // ņ
-    { 19, 25, 20, 1, 24, 119, 5519 }, // Ň
-    { 17, 21, 17, 0, 21, 90, 5638 }, // ň
-    { 23, 19, 23, 0, 19, 110, 5728 }, // ŉ
-    { 19, 23, 20, 1, 18, 110, 5838 }, // Ŋ
-    { 15, 20, 16, 0, 14, 75, 5948 }, // ŋ
-    { 18, 24, 19, 1, 23, 108, 6023 }, // Ō
-    { 13, 19, 15, 1, 18, 62, 6131 }, // ō
-    { 18, 25, 19, 1, 24, 113, 6193 }, // Ŏ
-    { 13, 21, 15, 1, 20, 69, 6306 }, // ŏ
-    { 18, 26, 19, 1, 25, 117, 6375 }, // Ő
-    { 13, 22, 15, 1, 21, 72, 6492 }, // ő
-    { 23, 19, 24, 1, 18, 110, 6564 }, // Œ
-    { 21, 15, 23, 1, 14, 79, 6674 }, // œ
-    { 17, 25, 17, 1, 24, 107, 6753 }, // Ŕ
-    { 12, 21, 12, 0, 21, 63, 6860 }, // ŕ
-    { 17, 25, 17, 1, 18, 107, 6923 }, // Ŗ
-    { 12, 21, 12, 0, 14, 63, 7030 }, // ŗ
-    { 17, 25, 17, 1, 24, 107, 7093 }, // Ř
-    { 12, 21, 12, 0, 21, 63, 7200 }, // ř
-    { 12, 25, 14, 1, 24, 75, 7263 }, // Ś
-    { 10, 22, 12, 1, 21, 55, 7338 }, // ś
-    { 12, 25, 14, 1, 24, 75, 7393 }, // Ŝ
-    { 10, 21, 12, 1, 20, 53, 7468 }, // ŝ
-    { 12, 25, 14, 1, 18, 75, 7521 }, // Ş
-    { 10, 21, 12, 1, 14, 53, 7596 }, // ş
-    { 12, 25, 14, 1, 24, 75, 7649 }, // Š
-    { 10, 22, 12, 1, 21, 55, 7724 }, // š
-    { 17, 25, 17, 0, 18, 107, 7779 }, // Ţ
-    { 10, 24, 10, 0, 17, 60, 7886 }, // ţ
-    { 17, 24, 17, 0, 24, 102, 7946 }, // Ť
-    { 10, 21, 10, 0, 20, 53, 8048 }, // ť
-    { 17, 18, 17, 0, 18, 77, 8101 }, // Ŧ
-    { 10, 18, 10, 0, 17, 45, 8178 }, // ŧ
-    { 19, 25, 19, 0, 24, 119, 8223 }, // Ũ
-    { 17, 21, 16, 0, 20, 90, 8342 }, // ũ
-    { 19, 24, 19, 0, 23, 114, 8432 }, // Ū
-    { 17, 19, 16, 0, 18, 81, 8546 }, // ū
-    { 19, 25, 19, 0, 24, 119, 8627 }, // Ŭ
-    { 17, 21, 16, 0, 20, 90, 8746 }, // ŭ
-    { 19, 26, 19, 0, 25, 124, 8836 }, // Ů
-    { 17, 22, 16, 0, 21, 94, 8960 }, // ů
-    { 19, 26, 19, 0, 25, 124, 9054 }, // Ű
-    { 17, 22, 16, 0, 21, 94, 9178 }, // ű
-    { 19, 24, 19, 0, 18, 114, 9272 }, // Ų
-    { 17, 20, 16, 0, 14, 85, 9386 }, // ų
-    { 28, 25, 28, 0, 24, 175, 9471 }, // Ŵ
-    { 22, 21, 22, 0, 20, 116, 9646 }, // ŵ
-    { 17, 24, 17, 0, 24, 102, 9762 }, // Ŷ
-    { 15, 26, 15, 0, 20, 98, 9864 }, // ŷ
-    { 17, 23, 17, 0, 23, 98, 9962 }, // Ÿ
-    { 15, 25, 15, 0, 24, 94, 10060 }, // Ź
-    { 12, 22, 13, 0, 21, 66, 10154 }, // ź
-    { 15, 25, 15, 0, 24, 94, 10220 }, // Ż
-    { 12, 20, 13, 0, 19, 60, 10314 }, // ż
-    { 15, 25, 15, 0, 24, 94, 10374 }, // Ž
-    { 12, 22, 13, 0, 21, 66, 10468 }, // ž
-    { 12, 20, 10, 0, 20, 60, 10534 }, // ſ
-    { 6, 7, 0, -4, 21, 11, 0 }, // ̀
-    { 6, 7, 0, -2, 21, 11, 11 }, // ́
-    { 8, 6, 0, -4, 20, 12, 22 }, // ̂
-    { 8, 5, 0, -4, 20, 10, 34 }, // ̃
-    { 10, 3, 0, -5, 18, 8, 44 }, // ̄
-    { 8, 5, 0, -4, 20, 10, 52 }, // ̆
-    { 4, 4, 0, -2, 19, 4, 62 }, // ̇
-    { 10, 4, 0, -5, 19, 10, 66 }, // ̈
-    { 8, 8, 0, -4, 22, 16, 76 }, // ̉
-    { 8, 7, 0, -4, 21, 14, 92 }, // ̊
-    { 10, 7, 0, -4, 21, 18, 106 }, // ̋
-    { 10, 6, 0, -5, 21, 15, 124 }, // ̌
-    { 10, 7, 0, -6, 21, 18, 139 }, // ̏
-    { 8, 5, 0, -4, 20, 10, 157 }, // ̑
-    { 4, 8, 0, -2, 22, 8, 167 }, // ̒
-    { 5, 7, 0, -2, 22, 9, 175 }, // ̓
-    { 5, 7, 0, -3, 22, 9, 184 }, // ̔
-    { 4, 7, 0, -2, 22, 7, 193 }, // ̕
-    { 4, 6, 0, -2, 16, 6, 200 }, // ̛
-    { 4, 4, 0, -2, -2, 4, 206 }, // ̣
-    { 10, 4, 0, -5, -2, 10, 210 }, // ̤
-    { 6, 6, 0, -3, -1, 9, 220 }, // ̥
-    { 5, 6, 0, -3, -1, 8, 229 }, // ̦
-    { 6, 6, 0, -3, -1, 9, 237 }, // ̧
-    { 6, 7, 0, -3, 1, 11, 246 }, // ̨
-    { 3, 6, 7, 2, -1, 5, 257 }, // ̩
-    { 8, 6, 0, -4, -1, 12, 262 }, // ̭
-    { 8, 5, 0, -4, -1, 10, 274 }, // ̮
-    { 8, 5, 0, -4, -1, 10, 284 }, // ̰
-    { 10, 3, 0, -5, -2, 8, 294 }, // ̱
-    { 8, 5, 0, -4, 20, 10, 302 }, // ͂
-    { 10, 10, 0, -5, 25, 25, 312 }, // ̈́
-    { 5, 5, 0, -2, -1, 7, 337 }, // ͅ
-    { 14, 24, 16, 1, 24, 84, 0 }, // Ѐ
-    { 14, 23, 16, 1, 23, 81, 84 }, // Ё
-    { 20, 24, 20, 0, 18, 120, 165 }, // Ђ
-    { 13, 24, 15, 1, 24, 78, 285 }, // Ѓ
-    { 15, 19, 17, 1, 18, 72, 363 }, // Є
-    { 12, 19, 14, 1, 18, 57, 435 }, // Ѕ
-    { 8, 18, 9, 1, 18, 36, 492 }, // І
-    { 10, 23, 9, 0, 23, 58, 528 }, // Ї
-    { 10, 24, 9, -1, 18, 60, 586 }, // Ј
-    { 24, 19, 24, 0, 18, 114, 646 }, // Љ
-    { 24, 19, 26, 1, 18, 114, 760 }, // Њ
-    { 21, 18, 21, 0, 18, 95, 874 }, // Ћ
-    { 17, 25, 18, 1, 24, 107, 969 }, // Ќ
-    { 19, 24, 21, 1, 24, 114, 1076 }, // Ѝ
-    { 18, 25, 18, 0, 24, 113, 1190 }, // Ў
-    { 18, 24, 20, 1, 18, 108, 1303 }, // Џ
-    { 19, 18, 19, 0, 18, 86, 1411 }, // А
-    { 14, 19, 16, 1, 18, 67, 1497 }, // Б
-    { 14, 19, 15, 1, 18, 67, 1564 }, // В
-    { 13, 18, 15, 1, 18, 59, 1631 }, // Г
-    { 18, 24, 19, 0, 18, 108, 1690 }, // Д
-    { 14, 18, 16, 1, 18, 63, 1798 }, // Е
-    { 25, 19, 25, 0, 18, 119, 1861 }, // Ж
-    { 14, 19, 15, 0, 18, 67, 1980 }, // З
-    { 19, 18, 21, 1, 18, 86, 2047 }, // И
-    { 19, 24, 21, 1, 24, 114, 2133 }, // Й
-    { 17, 19, 18, 1, 18, 81, 2247 }, // К
-    { 18, 19, 19, 0, 18, 86, 2328 }, // Л
-    { 23, 18, 22, 0, 18, 104, 2414 }, // М
-    { 19, 18, 21, 1, 18, 86, 2518 }, // Н
-    { 18, 19, 19, 1, 18, 86, 2604 }, // О
-    { 19, 18, 20, 1, 18, 86, 2690 }, // П
-    { 14, 18, 15, 1, 18, 63, 2776 }, // Р
-    { 14, 19, 16, 1, 18, 67, 2839 }, // С
-    { 17, 18, 17, 0, 18, 77, 2906 }, // Т
-    { 18, 19, 18, 0, 18, 86, 2983 }, // У
-    { 18, 19, 20, 1, 18, 86, 3069 }, // Ф
-    { 18, 18, 18, 0, 18, 81, 3155 }, // Х
-    { 19, 24, 20, 1, 18, 114, 3236 }, // Ц
-    { 17, 18, 18, 0, 18, 77, 3350 }, // Ч
-    { 25, 18, 27, 1, 18, 113, 3427 }, // Ш
-    { 25, 24, 27, 1, 18, 150, 3540 }, // Щ
-    { 19, 19, 19, 0, 18, 91, 3690 }, // Ъ
-    { 22, 19, 24, 1, 18, 105, 3781 }, // Ы
-    { 14, 19, 16, 1, 18, 67, 3886 }, // Ь
-    { 15, 19, 17, 1, 18, 72, 3953 }, // Э
-    { 25, 19, 26, 1, 18, 119, 4025 }, // Ю
-    { 17, 19, 17, -1, 18, 81, 4144 }, // Я
-    { 13, 15, 14, 1, 14, 49, 4225 }, // а
-    { 13, 21, 15, 1, 20, 69, 4274 }, // б
-    { 13, 14, 14, 0, 13, 46, 4343 }, // в
-    { 12, 13, 12, 0, 13, 39, 4389 }, // г
-    { 16, 18, 16, 0, 13, 72, 4428 }, // д
-    { 11, 15, 13, 1, 14, 42, 4500 }, // е
-    { 20, 15, 20, 0, 14, 75, 4542 }, // ж
-    { 11, 15, 12, 0, 14, 42, 4617 }, // з
-    { 17, 13, 17, 0, 13, 56, 4659 }, // и
-    { 17, 19, 17, 0, 19, 81, 4715 }, // й
-    { 15, 15, 15, 0, 14, 57, 4796 }, // к
-    { 15, 14, 16, 0, 13, 53, 4853 }, // л
-    { 18, 13, 19, 1, 13, 59, 4906 }, // м
-    { 17, 13, 17, 0, 13, 56, 4965 }, // н
-    { 13, 15, 15, 1, 14, 49, 5021 }, // о
-    { 17, 13, 17, 0, 13, 56, 5070 }, // п
-    { 15, 20, 15, 0, 14, 75, 5126 }, // р
-    { 11, 15, 13, 1, 14, 42, 5201 }, // с
-    { 14, 13, 14, 0, 13, 46, 5243 }, // т
-    { 15, 19, 15, 0, 13, 72, 5289 }, // у
-    { 17, 26, 18, 1, 20, 111, 5361 }, // ф
-    { 15, 13, 15, 0, 13, 49, 5472 }, // х
-    { 17, 18, 17, 0, 13, 77, 5521 }, // ц
-    { 15, 13, 15, 0, 13, 49, 5598 }, // ч
-    { 22, 13, 22, 0, 13, 72, 5647 }, // ш
-    { 22, 18, 22, 0, 13, 99, 5719 }, // щ
-    { 16, 14, 16, 0, 13, 56, 5818 }, // ъ
-    { 20, 14, 20, 0, 13, 70, 5874 }, // ы
-    { 13, 14, 13, 0, 13, 46, 5944 }, // ь
-    { 12, 15, 13, 0, 14, 45, 5990 }, // э
-    { 21, 15, 21, 0, 14, 79, 6035 }, // ю
-    { 14, 14, 14, 0, 13, 49, 6114 }, // я
-    { 11, 22, 13, 1, 21, 61, 6163 }, // ѐ
-    { 11, 20, 13, 1, 19, 55, 6224 }, // ё
-    { 15, 26, 16, 0, 20, 98, 6279 }, // ђ
-    { 12, 21, 12, 0, 21, 63, 6377 }, // ѓ
-    { 12, 15, 13, 1, 14, 45, 6440 }, // є
-    { 10, 15, 12, 1, 14, 38, 6485 }, // ѕ
-    { 8, 20, 8, 0, 20, 40, 6523 }, // і
-    { 10, 19, 8, -1, 19, 48, 6563 }, // ї
-    { 8, 26, 7, -2, 20, 52, 6611 }, // ј
-    { 20, 14, 20, 0, 13, 70, 6663 }, // љ
-    { 21, 14, 21, 0, 13, 74, 6733 }, // њ
-    { 17, 20, 17, 0, 20, 85, 6807 }, // ћ
-    { 15, 22, 15, 0, 21, 83, 6892 }, // ќ
-    { 17, 21, 17, 0, 21, 90, 6975 }, // ѝ
-    { 15, 25, 15, 0, 19, 94, 7065 }, // ў
-    { 17, 18, 17, 0, 13, 77, 7159 }, // џ
-    { 18, 21, 18, 0, 20, 95, 7236 }, // Ѣ
-    { 15, 19, 15, 0, 18, 72, 7331 }, // ѣ
-    { 18, 19, 19, 1, 18, 86, 7403 }, // Ѳ
-    { 13, 15, 15, 1, 14, 49, 7489 }, // ѳ
-    { 19, 19, 19, 0, 18, 91, 7538 }, // Ѵ
-    { 16, 15, 15, 0, 14, 60, 7629 }, // ѵ
-    { 19, 30, 21, 1, 24, 143, 7689 }, // Ҋ
-    { 17, 24, 17, 0, 19, 102, 7832 }, // ҋ
-    { 15, 19, 16, 0, 18, 72, 7934 }, // Ҍ
-    { 13, 19, 13, 0, 18, 62, 8006 }, // ҍ
-    { 14, 18, 15, 1, 18, 63, 8068 }, // Ҏ
-    { 15, 20, 15, 0, 14, 75, 8131 }, // ҏ
-    { 13, 21, 14, 1, 21, 69, 8206 }, // Ґ
-    { 11, 16, 12, 1, 16, 44, 8275 }, // ґ
-    { 14, 18, 15, 0, 18, 63, 8319 }, // Ғ
-    { 12, 13, 12, 0, 13, 39, 8382 }, // ғ
-    { 15, 24, 17, 1, 18, 90, 8421 }, // Ҕ
-    { 14, 19, 15, 0, 13, 67, 8511 }, // ҕ
-    { 25, 24, 25, 0, 18, 150, 8578 }, // Җ
-    { 20, 19, 20, 0, 14, 95, 8728 }, // җ
-    { 14, 24, 15, 0, 18, 84, 8823 }, // Ҙ
-    { 11, 19, 12, 0, 14, 53, 8907 }, // ҙ
-    { 17, 24, 18, 1, 18, 102, 8960 }, // Қ
-    { 15, 19, 15, 0, 14, 72, 9062 }, // қ
-    { 18, 19, 19, 1, 18, 86, 9134 }, // Ҝ
-    { 15, 15, 15, 0, 14, 57, 9220 }, // ҝ
-    { 18, 19, 18, 0, 18, 86, 9277 }, // Ҟ
-    { 14, 19, 14, 0, 18, 67, 9363 }, // ҟ
-    { 21, 19, 21, 0, 18, 100, 9430 }, // Ҡ
-    { 17, 15, 17, 0, 14, 64, 9530 }, // ҡ
-    { 20, 24, 21, 1, 18, 120, 9594 }, // Ң
-    { 17, 18, 18, 0, 13, 77, 9714 }, // ң
-    { 23, 18, 24, 1, 18, 104, 9791 }, // Ҥ
-    { 19, 13, 20, 0, 13, 62, 9895 }, // ҥ
-    { 25, 24, 26, 1, 18, 150, 9957 }, // Ҧ
-    { 23, 19, 24, 0, 13, 110, 10107 }, // ҧ
-    { 19, 19, 21, 1, 18, 91, 10217 }, // Ҩ
-    { 15, 15, 16, 1, 14, 57, 10308 }, // ҩ
-    { 14, 24, 16, 1, 18, 84, 10365 }, // Ҫ
-    { 11, 19, 13, 1, 14, 53, 10449 }, // ҫ
-    { 17, 24, 17, 0, 18, 102, 10502 }, // Ҭ
-    { 14, 18, 14, 0, 13, 63, 10604 }, // ҭ
-    { 17, 18, 17, 0, 18, 77, 10667 }, // Ү
-    { 15, 19, 15, 0, 13, 72, 10744 }, // ү
-    { 17, 18, 17, 0, 18, 77, 10816 }, // Ұ
-    { 15, 19, 15, 0, 13, 72, 10893 }, // ұ
-    { 19, 24, 18, 0, 18, 114, 10965 }, // Ҳ
-    { 15, 18, 15, 0, 13, 68, 11079 }, // ҳ
-    { 23, 24, 23, 0, 18, 138, 11147 }, // Ҵ
-    { 19, 18, 20, 0, 13, 86, 11285 }, // ҵ
-    { 18, 24, 18, 0, 18, 108, 11371 }, // Ҷ
-    { 15, 18, 16, 0, 13, 68, 11479 }, // ҷ
-    { 17, 18, 18, 0, 18, 77, 11547 }, // Ҹ
-    { 15, 13, 15, 0, 13, 49, 11624 }, // ҹ
-    { 17, 18, 18, 1, 18, 77, 11673 }, // Һ
-    { 17, 20, 17, 0, 20, 85, 11750 }, // һ
-    { 20, 19, 20, 0, 18, 95, 11835 }, // Ҽ
-    { 15, 15, 16, 0, 14, 57, 11930 }, // ҽ
-    { 20, 24, 20, 0, 18, 120, 11987 }, // Ҿ
-    { 15, 19, 16, 0, 14, 72, 12107 }, // ҿ
-    { 8, 18, 9, 1, 18, 36, 12179 }, // Ӏ
-    { 25, 25, 25, 0, 24, 157, 12215 }, // Ӂ
-    { 20, 20, 20, 0, 19, 100, 12372 }, // ӂ
-    { 16, 24, 17, 1, 18, 96, 12472 }, // Ӄ
-    { 14, 20, 15, 0, 14, 70, 12568 }, // ӄ
-    { 18, 24, 19, 0, 18, 108, 12638 }, // Ӆ
-    { 15, 18, 16, 0, 13, 68, 12746 }, // ӆ
-    { 19, 24, 20, 1, 18, 114, 12814 }, // Ӈ
-    { 17, 19, 17, 0, 13, 81, 12928 }, // ӈ
-    { 19, 24, 21, 1, 18, 114, 13009 }, // Ӊ
-    { 17, 18, 17, 0, 13, 77, 13123 }, // ӊ
-    { 17, 24, 18, 0, 18, 102, 13200 }, // Ӌ
-    { 15, 18, 15, 0, 13, 68, 13302 }, // ӌ
-    { 23, 24, 22, 0, 18, 138, 13370 }, // Ӎ
-    { 18, 18, 19, 1, 13, 81, 13508 }, // ӎ
-    { 8, 20, 8, 0, 20, 40, 13589 }, // ӏ
-    { 19, 24, 19, 0, 24, 114, 13629 }, // Ӑ
-    { 13, 20, 14, 1, 19, 65, 13743 }, // ӑ
-    { 19, 23, 19, 0, 23, 110, 13808 }, // Ӓ
-    { 13, 20, 14, 1, 19, 65, 13918 }, // ӓ
-    { 24, 18, 23, -1, 18, 108, 13983 }, // Ӕ
-    { 19, 15, 20, 1, 14, 72, 14091 }, // ӕ
-    { 14, 24, 16, 1, 24, 84, 14163 }, // Ӗ
-    { 11, 20, 13, 1, 19, 55, 14247 }, // ӗ
-    { 15, 19, 17, 1, 18, 72, 14302 }, // Ә
-    { 11, 15, 13, 1, 14, 42, 14374 }, // ә
-    { 15, 24, 17, 1, 23, 90, 14416 }, // Ӛ
-    { 11, 20, 13, 1, 19, 55, 14506 }, // ӛ
-    { 25, 24, 25, 0, 23, 150, 14561 }, // Ӝ
-    { 20, 20, 20, 0, 19, 100, 14711 }, // ӝ
-    { 14, 24, 15, 0, 23, 84, 14811 }, // Ӟ
-    { 11, 20, 12, 0, 19, 55, 14895 }, // ӟ
-    { 14, 19, 14, 0, 18, 67, 14950 }, // Ӡ
-    { 12, 19, 13, 0, 13, 57, 15017 }, // ӡ
-    { 19, 23, 21, 1, 23, 110, 15074 }, // Ӣ
-    { 17, 18, 17, 0, 18, 77, 15184 }, // ӣ
-    { 19, 23, 21, 1, 23, 110, 15261 }, // Ӥ
-    { 17, 19, 17, 0, 19, 81, 15371 }, // ӥ
-    { 18, 24, 19, 1, 23, 108, 15452 }, // Ӧ
-    { 13, 20, 15, 1, 19, 65, 15560 }, // ӧ
-    { 18, 19, 19, 1, 18, 86, 15625 }, // Ө
-    { 13, 15, 15, 1, 14, 49, 15711 }, // ө
-    { 18, 24, 21, 1, 23, 108, 15760 }, // Ӫ
-    { 13, 20, 15, 1, 19, 65, 15868 }, // ӫ
-    { 15, 24, 17, 1, 23, 90, 15933 }, // Ӭ
-    { 12, 20, 13, 0, 19, 60, 16023 }, // ӭ
-    { 18, 24, 18, 0, 23, 108, 16083 }, // Ӯ
-    { 15, 24, 15, 0, 18, 90, 16191 }, // ӯ
-    { 18, 24, 18, 0, 23, 108, 16281 }, // Ӱ
-    { 15, 25, 15, 0, 19, 94, 16389 }, // ӱ
-    { 18, 26, 18, 0, 25, 117, 16483 }, // Ӳ
-    { 15, 27, 15, 0, 21, 102, 16600 }, // ӳ
-    { 17, 23, 18, 0, 23, 98, 16702 }, // Ӵ
-    { 15, 19, 16, 0, 19, 72, 16800 }, // ӵ
-    { 13, 24, 15, 1, 18, 78, 16872 }, // Ӷ
-    { 12, 18, 12, 0, 13, 54, 16950 }, // ӷ
-    { 22, 24, 24, 1, 23, 132, 17004 }, // Ӹ
-    { 20, 20, 20, 0, 19, 100, 17136 }, // ӹ
-    { 14, 24, 15, 0, 18, 84, 17236 }, // Ӻ
-    { 12, 18, 12, 0, 13, 54, 17320 }, // ӻ
-    { 18, 24, 18, 0, 18, 108, 17374 }, // Ӽ
-    { 15, 19, 15, 0, 13, 72, 17482 }, // ӽ
-    { 18, 18, 18, 0, 18, 81, 17554 }, // Ӿ
-    { 15, 13, 15, 0, 13, 49, 17635 }, // ӿ
-    { 0, 0, 13, 0, 0, 0, 0 }, //  
-    { 0, 0, 25, 0, 0, 0, 0 }, //  
-    { 0, 0, 13, 0, 0, 0, 0 }, //  
-    { 0, 0, 25, 0, 0, 0, 0 }, //  
-    { 0, 0, 8, 0, 0, 0, 0 }, //  
-    { 0, 0, 6, 0, 0, 0, 0 }, //  
-    { 0, 0, 4, 0, 0, 0, 0 }, //  
-    { 0, 0, 16, 0, 0, 0, 0 }, //  
-    { 0, 0, 7, 0, 0, 0, 0 }, //  
-    { 0, 0, 5, 0, 0, 0, 0 }, //  
-    { 0, 0, 1, 0, 0, 0, 0 }, //  
-    { 0, 0, 0, 0, 0, 0, 0 }, // ​
-    { 2, 21, 0, -1, 15, 11, 0 }, // ‌
-    { 6, 23, 0, -3, 17, 35, 11 }, // ‍
-    { 8, 24, 0, -4, 18, 48, 46 }, // ‎
-    { 8, 24, 0, -4, 18, 48, 94 }, // ‏
-    { 8, 3, 9, 1, 8, 6, 142 }, // ‐
-    { 8, 3, 9, 1, 8, 6, 148 }, // ‑
-    { 12, 3, 16, 2, 10, 9, 154 }, // ‒
-    { 13, 3, 13, 0, 8, 10, 163 }, // –
-    { 25, 3, 25, 0, 8, 19, 173 }, // —
-    { 25, 3, 25, 0, 8, 19, 192 }, // ―
-    { 8, 26, 13, 2, 20, 52, 211 }, // ‖
-    { 13, 6, 13, 0, -1, 20, 263 }, // ‗
-    { 5, 8, 6, 1, 19, 10, 283 }, // ‘
-    { 5, 8, 6, 0, 19, 10, 293 }, // ’
-    { 5, 9, 6, 0, 4, 12, 303 }, // ‚
-    { 5, 8, 6, 1, 19, 10, 315 }, // ‛
-    { 10, 8, 11, 1, 19, 20, 325 }, // “
-    { 10, 8, 11, 0, 19, 20, 345 }, // ”
-    { 10, 9, 11, 0, 4, 23, 365 }, // „
-    { 10, 8, 11, 1, 19, 20, 388 }, // ‟
-    { 12, 17, 13, 0, 18, 51, 408 }, // †
-    { 12, 20, 13, 0, 18, 60, 459 }, // ‡
-    { 6, 6, 8, 1, 9, 9, 519 }, // •
-    { 9, 9, 16, 3, 13, 21, 528 }, // ‣
-    { 5, 4, 7, 1, 3, 5, 549 }, // ․
-    { 11, 5, 13, 1, 4, 14, 554 }, // ‥
-    { 21, 5, 25, 2, 4, 27, 568 }, // …
-    { 5, 4, 7, 1, 9, 5, 595 }, // ‧
-    { 0, 0, 0, 0, 0, 0, 600 }, //  
-    { 0, 0, 0, 0, 0, 0, 600 }, //  
-    { 8, 24, 0, -4, 18, 48, 600 }, // ‪
-    { 8, 24, 0, -4, 18, 48, 648 }, // ‫
-    { 8, 24, 0, -4, 18, 48, 696 }, // ‬
-    { 11, 24, 0, -5, 18, 66, 744 }, // ‭
-    { 11, 24, 0, -5, 18, 66, 810 }, // ‮
-    { 0, 0, 3, 0, 0, 0, 876 }, //  
-    { 32, 21, 34, 1, 19, 168, 876 }, // ‰
-    { 5, 9, 7, 1, 18, 12, 1044 }, // ′
-    { 10, 9, 11, 1, 18, 23, 1056 }, // ″
-    { 15, 9, 16, 1, 18, 34, 1079 }, // ‴
-    { 6, 9, 7, 0, 18, 14, 1113 }, // ‵
-    { 11, 9, 12, 0, 18, 25, 1127 }, // ‶
-    { 17, 9, 17, 0, 18, 39, 1152 }, // ‷
-    { 11, 6, 12, 1, 0, 17, 1191 }, // ‸
-    { 7, 10, 8, 0, 11, 18, 1208 }, // ‹
-    { 7, 10, 8, 1, 11, 18, 1226 }, // ›
-    { 16, 18, 16, 0, 17, 72, 1244 }, // ※
-    { 11, 20, 14, 2, 19, 55, 1316 }, // ‼
-    { 13, 3, 13, 0, 21, 10, 1371 }, // ‾
-    { 6, 3, 8, 1, 8, 5, 1381 }, // ⁃
-    { 13, 21, 5, -4, 19, 69, 1386 }, // ⁄
-    { 20, 20, 22, 1, 19, 100, 1455 }, // ⁇
-    { 17, 20, 19, 1, 19, 85, 1555 }, // ⁈
-    { 16, 20, 19, 2, 19, 80, 1640 }, // ⁉
-    { 15, 5, 25, 5, 10, 19, 1720 }, // ⁓
-    { 20, 9, 21, 1, 18, 45, 1739 }, // ⁗
-    { 0, 0, 6, 0, 0, 0, 1784 }, //  
-    { 0, 0, 0, 0, 0, 0, 1784 }, // ⁠
-    { 0, 0, 0, 0, 0, 0, 1784 }, // ⁡
-    { 0, 0, 0, 0, 0, 0, 1784 }, // ⁢
-    { 0, 0, 0, 0, 0, 0, 1784 }, // ⁣
-    { 0, 0, 0, 0, 0, 0, 1784 }, // ⁤
-    { 11, 13, 11, 0, 21, 36, 0 }, // ⁰
-    { 11, 13, 11, 0, 21, 36, 36 }, // ⁴
-    { 9, 13, 11, 1, 21, 30, 72 }, // ⁵
-    { 9, 13, 11, 1, 21, 30, 102 }, // ⁶
-    { 8, 13, 11, 2, 21, 26, 132 }, // ⁷
-    { 9, 13, 11, 1, 21, 30, 158 }, // ⁸
-    { 9, 13, 11, 1, 21, 30, 188 }, // ⁹
-    { 11, 9, 14, 2, 18, 25, 218 }, // ⁿ
-    { 11, 12, 11, 0, 8, 33, 243 }, // ₀
-    { 8, 13, 11, 2, 9, 26, 276 }, // ₁
-    { 9, 12, 11, 1, 8, 27, 302 }, // ₂
-    { 9, 12, 11, 1, 8, 27, 329 }, // ₃
-    { 11, 12, 11, 0, 8, 33, 356 }, // ₄
-    { 9, 12, 11, 1, 8, 27, 389 }, // ₅
-    { 9, 12, 11, 1, 8, 27, 416 }, // ₆
-    { 8, 12, 11, 2, 8, 24, 443 }, // ₇
-    { 9, 12, 11, 1, 8, 27, 467 }, // ₈
-    { 9, 12, 11, 1, 8, 27, 494 }, // ₉
-    { 13, 18, 16, 1, 18, 59, 0 }, // ₣
-    { 14, 19, 16, 1, 18, 67, 59 }, // ₤
-    { 31, 19, 31, 0, 18, 148, 126 }, // ₧
-    { 15, 19, 16, 0, 18, 72, 274 }, // €
-    { 15, 11, 25, 5, 14, 42, 0 }, // ←
-    { 11, 17, 25, 7, 17, 47, 42 }, // ↑
-    { 15, 11, 25, 5, 14, 42, 89 }, // →
-    { 11, 17, 25, 7, 17, 47, 131 }, // ↓
-    { 15, 11, 25, 5, 14, 42, 178 }, // ↔
-    { 11, 17, 25, 7, 17, 47, 220 }, // ↕
-    { 11, 17, 25, 7, 17, 47, 267 }, // ↨
-    { 11, 17, 25, 7, 17, 47, 314 }, // ↲
-    { 11, 17, 25, 7, 17, 47, 361 }, // ↳
-    { 13, 12, 25, 6, 15, 39, 408 }, // ↵
-    { 15, 11, 25, 5, 14, 42, 447 }, // ⇐
-    { 11, 15, 25, 7, 16, 42, 489 }, // ⇑
-    { 15, 11, 25, 5, 14, 42, 531 }, // ⇒
-    { 11, 15, 25, 7, 16, 42, 573 }, // ⇓
-    { 15, 11, 25, 5, 14, 42, 615 }, // ⇔
-    { 17, 19, 25, 4, 18, 81, 0 }, // ∀
-    { 13, 21, 16, 1, 20, 69, 81 }, // ∂
-    { 11, 18, 25, 7, 18, 50, 150 }, // ∃
-    { 19, 20, 25, 3, 19, 95, 200 }, // ∅
-    { 16, 18, 16, 0, 18, 72, 295 }, // ∆
-    { 17, 19, 25, 4, 18, 81, 367 }, // ∇
-    { 17, 18, 25, 4, 18, 77, 448 }, // ∈
-    { 17, 22, 25, 4, 19, 94, 525 }, // ∉
-    { 17, 14, 25, 4, 16, 60, 619 }, // ∊
-    { 17, 18, 25, 4, 18, 77, 679 }, // ∋
-    { 17, 22, 25, 4, 19, 94, 756 }, // ∌
-    { 17, 14, 25, 4, 16, 60, 850 }, // ∍
-    { 19, 22, 20, 1, 18, 105, 910 }, // ∏
-    { 15, 23, 15, 0, 18, 87, 1015 }, // ∑
-    { 11, 3, 16, 2, 10, 9, 1102 }, // −
-    { 12, 20, 12, 0, 18, 60, 1111 }, // ∕
-    { 12, 20, 13, 1, 18, 60, 1171 }, // ∖
-    { 12, 13, 16, 2, 15, 39, 1231 }, // ∗
-    { 9, 9, 16, 3, 13, 21, 1270 }, // ∘
-    { 4, 4, 16, 6, 9, 4, 1291 }, // ∙
-    { 16, 24, 16, 0, 21, 96, 1295 }, // √
-    { 13, 10, 16, 1, 13, 33, 1391 }, // ∝
-    { 16, 9, 16, 0, 12, 36, 1424 }, // ∞
-    { 16, 18, 25, 4, 18, 72, 1460 }, // ∟
-    { 18, 18, 25, 3, 18, 81, 1532 }, // ∠
-    { 3, 26, 13, 5, 20, 20, 1613 }, // ∣
-    { 8, 26, 13, 2, 20, 52, 1633 }, // ∥
-    { 17, 18, 25, 4, 18, 77, 1685 }, // ∧
-    { 17, 18, 25, 4, 18, 77, 1762 }, // ∨
-    { 15, 18, 25, 5, 18, 68, 1839 }, // ∩
-    { 15, 19, 25, 5, 18, 72, 1907 }, // ∪
-    { 14, 26, 16, 1, 20, 91, 1979 }, // ∫
-    { 16, 15, 25, 5, 14, 60, 2070 }, // ∴
-    { 16, 15, 25, 5, 14, 60, 2130 }, // ∵
-    { 4, 13, 8, 2, 15, 13, 2190 }, // ∶
-    { 16, 15, 25, 5, 14, 60, 2203 }, // ∷
-    { 15, 5, 25, 5, 10, 19, 2263 }, // ∼
-    { 15, 13, 25, 5, 15, 49, 2282 }, // ≅
-    { 12, 9, 16, 2, 13, 27, 2331 }, // ≈
-    { 15, 8, 25, 5, 11, 30, 2358 }, // ≍
-    { 11, 11, 16, 2, 14, 31, 2388 }, // ≠
-    { 15, 11, 25, 5, 13, 42, 2419 }, // ≡
-    { 12, 15, 16, 2, 15, 45, 2461 }, // ≤
-    { 12, 15, 16, 2, 15, 45, 2506 }, // ≥
-    { 21, 13, 25, 2, 15, 69, 2551 }, // ≪
-    { 21, 13, 25, 2, 15, 69, 2620 }, // ≫
-    { 17, 15, 25, 4, 16, 64, 2689 }, // ⊃
-    { 17, 23, 25, 4, 20, 98, 2753 }, // ⊄
-    { 17, 23, 25, 4, 20, 98, 2851 }, // ⊅
-    { 17, 18, 25, 4, 18, 77, 2949 }, // ⊆
-    { 17, 18, 25, 4, 18, 77, 3026 }, // ⊇
-    { 19, 19, 25, 3, 18, 91, 3103 }, // ⊕
-    { 19, 19, 25, 3, 18, 91, 3194 }, // ⊖
-    { 19, 19, 25, 3, 18, 91, 3285 }, // ⊗
-    { 19, 19, 25, 3, 18, 91, 3376 }, // ⊘
-    { 15, 18, 25, 5, 18, 68, 3467 }, // ⊥
-    { 4, 4, 16, 6, 9, 4, 3535 }, // ⋅
-    { 21, 4, 25, 2, 9, 21, 3539 }, // ⋯
-    { 25, 24, 25, 0, 21, 150, 0 }, // �
+    { 14, 10, 13, 0, 11, 35, 5447 }, // «
+    { 11, 7, 16, 2, 12, 20, 495 }, // ¬
+    { 8, 3, 9, 1, 8, 6, 515 }, // ­
+    { 14, 14, 15, 0, 20, 49, 521 }, // ®
+    { 9, 3, 17, 4, 18, 7, 570 }, // ¯
+    { 9, 9, 13, 2, 18, 21, 577 }, // °
+    { 11, 15, 16, 2, 15, 42, 598 }, // ±
+    { 9, 12, 11, 1, 21, 27, 640 }, // ²
+    { 9, 13, 11, 1, 21, 30, 667 }, // ³
+    { 5, 7, 17, 6, 21, 9, 697 }, // ´
+    { 16, 20, 17, 1, 14, 80, 706 }, // µ
+    { 13, 22, 14, 0, 18, 72, 786 }, // ¶
+    { 5, 4, 7, 1, 9, 5, 858 }, // ·
+    { 5, 6, 17, 6, -1, 8, 863 }, // ¸
+    { 8, 12, 11, 2, 21, 24, 871 }, // ¹
+    { 9, 12, 11, 1, 18, 27, 895 }, // º
+    { 13, 10, 13, 1, 11, 33, 5482 }, // »
+    { 24, 21, 27, 2, 19, 126, 922 }, // ¼
+    { 24, 21, 27, 2, 19, 126, 1048 }, // ½
+    { 25, 21, 27, 1, 19, 132, 1174 }, // ¾
+    { 9, 20, 12, 1, 14, 45, 1306 }, // ¿
+    { 19, 24, 19, 0, 24, 114, 5515 }, // À
+    { 19, 24, 19, 0, 24, 114, 5629 }, // Á
+    { 19, 24, 19, 0, 24, 114, 5743 }, // Â
+    { 19, 24, 19, 0, 24, 114, 1351 }, // Ã
+    { 19, 23, 19, 0, 23, 110, 5857 }, // Ä
+    { 19, 25, 19, 0, 25, 119, 1465 }, // Å
+    { 24, 18, 23, -1, 18, 108, 1584 }, // Æ
+    { 14, 25, 16, 1, 18, 88, 5967 }, // Ç
+    { 14, 24, 16, 1, 24, 84, 6055 }, // È
+    { 14, 24, 16, 1, 24, 84, 6139 }, // É
+    { 14, 24, 16, 1, 24, 84, 6223 }, // Ê
+    { 14, 23, 16, 1, 23, 81, 6307 }, // Ë
+    { 8, 24, 9, 1, 24, 48, 6388 }, // Ì
+    { 8, 24, 9, 1, 24, 48, 6436 }, // Í
+    { 9, 24, 9, 0, 24, 54, 6484 }, // Î
+    { 10, 23, 9, 0, 23, 58, 6538 }, // Ï
+    { 18, 19, 19, 0, 18, 86, 1692 }, // Ð
+    { 19, 25, 20, 1, 24, 119, 6596 }, // Ñ
+    { 18, 25, 19, 1, 24, 113, 6715 }, // Ò
+    { 18, 25, 19, 1, 24, 113, 6828 }, // Ó
+    { 18, 25, 19, 1, 24, 113, 6941 }, // Ô
+    { 18, 25, 19, 1, 24, 113, 1778 }, // Õ
+    { 18, 24, 19, 1, 23, 108, 7054 }, // Ö
+    { 10, 11, 16, 3, 14, 28, 1891 }, // ×
+    { 19, 19, 19, 0, 18, 91, 1919 }, // Ø
+    { 19, 25, 19, 0, 24, 119, 7162 }, // Ù
+    { 19, 25, 19, 0, 24, 119, 7281 }, // Ú
+    { 19, 25, 19, 0, 24, 119, 7400 }, // Û
+    { 19, 24, 19, 0, 23, 114, 7519 }, // Ü
+    { 17, 24, 17, 0, 24, 102, 2010 }, // Ý
+    { 14, 18, 16, 1, 18, 63, 2112 }, // Þ
+    { 16, 21, 16, 0, 20, 84, 2175 }, // ß
+    { 13, 22, 14, 1, 21, 72, 7633 }, // à
+    { 13, 22, 14, 1, 21, 72, 7705 }, // á
+    { 13, 21, 14, 1, 20, 69, 7777 }, // â
+    { 13, 21, 14, 1, 20, 69, 2259 }, // ã
+    { 13, 20, 14, 1, 19, 65, 7846 }, // ä
+    { 13, 22, 14, 1, 21, 72, 2328 }, // å
+    { 19, 15, 20, 1, 14, 72, 2400 }, // æ
+    { 11, 21, 13, 1, 14, 58, 7911 }, // ç
+    { 11, 22, 13, 1, 21, 61, 7969 }, // è
+    { 11, 22, 13, 1, 21, 61, 8030 }, // é
+    { 11, 21, 13, 1, 20, 58, 8091 }, // ê
+    { 11, 20, 13, 1, 19, 55, 8149 }, // ë
+    { 8, 21, 8, 0, 21, 42, 8204 }, // ì
+    { 8, 21, 8, 0, 21, 42, 8246 }, // í
+    { 8, 20, 8, 0, 20, 40, 8288 }, // î
+    { 10, 19, 8, -1, 19, 48, 8328 }, // ï
+    { 13, 22, 15, 1, 21, 72, 2472 }, // ð
+    { 17, 20, 17, 0, 20, 85, 8376 }, // ñ
+    { 13, 22, 15, 1, 21, 72, 8461 }, // ò
+    { 13, 22, 15, 1, 21, 72, 8533 }, // ó
+    { 13, 21, 15, 1, 20, 69, 8605 }, // ô
+    { 13, 21, 15, 1, 20, 69, 2544 }, // õ
+    { 13, 20, 15, 1, 19, 65, 8674 }, // ö
+    { 11, 13, 16, 2, 15, 36, 2613 }, // ÷
+    { 15, 15, 15, 0, 14, 57, 2649 }, // ø
+    { 17, 22, 16, 0, 21, 94, 8739 }, // ù
+    { 17, 22, 16, 0, 21, 94, 8833 }, // ú
+    { 17, 21, 16, 0, 20, 90, 8927 }, // û
+    { 17, 20, 16, 0, 19, 85, 9017 }, // ü
+    { 15, 27, 15, 0, 21, 102, 2706 }, // ý
+    { 15, 26, 16, 0, 20, 98, 2808 }, // þ
+    { 15, 25, 15, 0, 19, 94, 2906 }, // ÿ
+    { 19, 23, 19, 0, 23, 110, 3000 }, // Ā
+    { 13, 19, 14, 1, 18, 62, 3110 }, // ā
+    { 19, 24, 19, 0, 24, 114, 3172 }, // Ă
+    { 13, 21, 14, 1, 20, 69, 3286 }, // ă
+    { 19, 24, 19, 0, 18, 114, 3355 }, // Ą
+    { 13, 20, 14, 1, 14, 65, 3469 }, // ą
+    { 14, 25, 16, 1, 24, 88, 3534 }, // Ć
+    { 11, 22, 13, 1, 21, 61, 3622 }, // ć
+    { 14, 25, 16, 1, 24, 88, 3683 }, // Ĉ
+    { 11, 21, 13, 1, 20, 58, 3771 }, // ĉ
+    { 14, 25, 16, 1, 24, 88, 3829 }, // Ċ
+    { 11, 20, 13, 1, 19, 55, 3917 }, // ċ
+    { 14, 25, 16, 1, 24, 88, 3972 }, // Č
+    { 11, 22, 13, 1, 21, 61, 4060 }, // č
+    { 17, 25, 19, 1, 24, 107, 4121 }, // Ď
+    { 17, 21, 16, 1, 20, 90, 4228 }, // ď
+    { 18, 19, 19, 0, 18, 86, 4318 }, // Đ
+    { 15, 21, 16, 1, 20, 79, 4404 }, // đ
+    { 14, 23, 16, 1, 23, 81, 4483 }, // Ē
+    { 11, 19, 13, 1, 18, 53, 4564 }, // ē
+    { 14, 24, 16, 1, 24, 84, 4617 }, // Ĕ
+    { 11, 21, 13, 1, 20, 58, 4701 }, // ĕ
+    { 14, 24, 16, 1, 24, 84, 4759 }, // Ė
+    { 11, 20, 13, 1, 19, 55, 4843 }, // ė
+    { 14, 24, 16, 1, 18, 84, 4898 }, // Ę
+    { 11, 20, 13, 1, 14, 55, 4982 }, // ę
+    { 14, 24, 16, 1, 24, 84, 5037 }, // Ě
+    { 11, 22, 13, 1, 21, 61, 5121 }, // ě
+    { 16, 25, 18, 1, 24, 100, 5182 }, // Ĝ
+    { 15, 26, 15, 0, 20, 98, 5282 }, // ĝ
+    { 16, 25, 18, 1, 24, 100, 5380 }, // Ğ
+    { 15, 26, 15, 0, 20, 98, 5480 }, // ğ
+    { 16, 25, 18, 1, 24, 100, 5578 }, // Ġ
+    { 15, 25, 15, 0, 19, 94, 5678 }, // ġ
+    { 16, 25, 18, 1, 18, 100, 5772 }, // Ģ
+    { 15, 28, 15, 0, 22, 105, 5872 }, // ģ
+    { 19, 24, 21, 1, 24, 114, 5977 }, // Ĥ
+    { 18, 26, 17, -1, 26, 117, 6091 }, // ĥ
+    { 21, 18, 21, 0, 18, 95, 6208 }, // Ħ
+    { 17, 20, 17, 0, 20, 85, 6303 }, // ħ
+    { 9, 24, 9, 0, 24, 54, 6388 }, // Ĩ
+    { 9, 20, 8, 0, 20, 45, 6442 }, // ĩ
+    { 9, 23, 9, 0, 23, 52, 6487 }, // Ī
+    { 9, 18, 8, 0, 18, 41, 6539 }, // ī
+    { 9, 24, 9, 0, 24, 54, 6580 }, // Ĭ
+    { 8, 20, 8, 0, 20, 40, 6634 }, // ĭ
+    { 8, 24, 9, 1, 18, 48, 6674 }, // Į
+    { 8, 26, 8, 0, 20, 52, 6722 }, // į
+    { 8, 24, 9, 1, 24, 48, 6774 }, // İ
+    { 8, 14, 8, 0, 14, 28, 6822 }, // ı
+    { 17, 24, 18, 1, 18, 102, 6850 }, // Ĳ
+    { 14, 26, 15, 0, 20, 91, 6952 }, // ĳ
+    { 10, 30, 9, -1, 24, 75, 7043 }, // Ĵ
+    { 10, 26, 7, -2, 20, 65, 7118 }, // ĵ
+    { 18, 25, 18, 1, 18, 113, 7183 }, // Ķ
+    { 15, 27, 15, 0, 20, 102, 7296 }, // ķ
+    { 16, 15, 15, 0, 14, 60, 7398 }, // ĸ
+    { 14, 24, 15, 1, 24, 84, 7458 }, // Ĺ
+    { 8, 26, 8, 0, 26, 52, 7542 }, // ĺ
+    { 14, 25, 15, 1, 18, 88, 7594 }, // Ļ
+    { 8, 27, 8, 0, 20, 54, 7682 }, // ļ
+    { 14, 20, 15, 1, 20, 70, 7736 }, // Ľ
+    { 10, 20, 9, 0, 20, 50, 7806 }, // ľ
+    { 14, 18, 15, 1, 18, 63, 7856 }, // Ŀ
+    { 12, 20, 12, 0, 20, 60, 7919 }, // ŀ
+    { 16, 18, 15, -1, 18, 72, 7979 }, // Ł
+    { 10, 20, 8, -1, 20, 50, 8051 }, // ł
+    { 19, 25, 20, 1, 24, 119, 8101 }, // Ń
+    { 17, 21, 17, 0, 21, 90, 8220 }, // ń
+    { 19, 25, 20, 1, 18, 119, 8310 }, // Ņ
+    { 17, 21, 17, 0, 14, 90, 8429 }, // ņ
+    { 19, 25, 20, 1, 24, 119, 8519 }, // Ň
+    { 17, 21, 17, 0, 21, 90, 8638 }, // ň
+    { 23, 19, 23, 0, 19, 110, 8728 }, // ŉ
+    { 19, 23, 20, 1, 18, 110, 8838 }, // Ŋ
+    { 15, 20, 16, 0, 14, 75, 8948 }, // ŋ
+    { 18, 24, 19, 1, 23, 108, 9023 }, // Ō
+    { 13, 19, 15, 1, 18, 62, 9131 }, // ō
+    { 18, 25, 19, 1, 24, 113, 9193 }, // Ŏ
+    { 13, 21, 15, 1, 20, 69, 9306 }, // ŏ
+    { 18, 26, 19, 1, 25, 117, 9375 }, // Ő
+    { 13, 22, 15, 1, 21, 72, 9492 }, // ő
+    { 23, 19, 24, 1, 18, 110, 9102 }, // Œ
+    { 21, 15, 23, 1, 14, 79, 9212 }, // œ
+    { 17, 25, 17, 1, 24, 107, 9564 }, // Ŕ
+    { 12, 21, 12, 0, 21, 63, 9671 }, // ŕ
+    { 17, 25, 17, 1, 18, 107, 9734 }, // Ŗ
+    { 12, 21, 12, 0, 14, 63, 9841 }, // ŗ
+    { 17, 25, 17, 1, 24, 107, 9904 }, // Ř
+    { 12, 21, 12, 0, 21, 63, 10011 }, // ř
+    { 12, 25, 14, 1, 24, 75, 10074 }, // Ś
+    { 10, 22, 12, 1, 21, 55, 10149 }, // ś
+    { 12, 25, 14, 1, 24, 75, 10204 }, // Ŝ
+    { 10, 21, 12, 1, 20, 53, 10279 }, // ŝ
+    { 12, 25, 14, 1, 18, 75, 10332 }, // Ş
+    { 10, 21, 12, 1, 14, 53, 10407 }, // ş
+    { 12, 25, 14, 1, 24, 75, 10460 }, // Š
+    { 10, 22, 12, 1, 21, 55, 10535 }, // š
+    { 17, 25, 17, 0, 18, 107, 10590 }, // Ţ
+    { 10, 24, 10, 0, 17, 60, 10697 }, // ţ
+    { 17, 24, 17, 0, 24, 102, 10757 }, // Ť
+    { 10, 21, 10, 0, 20, 53, 10859 }, // ť
+    { 17, 18, 17, 0, 18, 77, 10912 }, // Ŧ
+    { 10, 18, 10, 0, 17, 45, 10989 }, // ŧ
+    { 19, 25, 19, 0, 24, 119, 11034 }, // Ũ
+    { 17, 21, 16, 0, 20, 90, 11153 }, // ũ
+    { 19, 24, 19, 0, 23, 114, 11243 }, // Ū
+    { 17, 19, 16, 0, 18, 81, 11357 }, // ū
+    { 19, 25, 19, 0, 24, 119, 11438 }, // Ŭ
+    { 17, 21, 16, 0, 20, 90, 11557 }, // ŭ
+    { 19, 26, 19, 0, 25, 124, 11647 }, // Ů
+    { 17, 22, 16, 0, 21, 94, 11771 }, // ů
+    { 19, 26, 19, 0, 25, 124, 11865 }, // Ű
+    { 17, 22, 16, 0, 21, 94, 11989 }, // ű
+    { 19, 24, 19, 0, 18, 114, 12083 }, // Ų
+    { 17, 20, 16, 0, 14, 85, 12197 }, // ų
+    { 28, 25, 28, 0, 24, 175, 12282 }, // Ŵ
+    { 22, 21, 22, 0, 20, 116, 12457 }, // ŵ
+    { 17, 24, 17, 0, 24, 102, 12573 }, // Ŷ
+    { 15, 26, 15, 0, 20, 98, 12675 }, // ŷ
+    { 17, 23, 17, 0, 23, 98, 12773 }, // Ÿ
+    { 15, 25, 15, 0, 24, 94, 12871 }, // Ź
+    { 12, 22, 13, 0, 21, 66, 12965 }, // ź
+    { 15, 25, 15, 0, 24, 94, 13031 }, // Ż
+    { 12, 20, 13, 0, 19, 60, 13125 }, // ż
+    { 15, 25, 15, 0, 24, 94, 13185 }, // Ž
+    { 12, 22, 13, 0, 21, 66, 13279 }, // ž
+    { 12, 20, 10, 0, 20, 60, 13345 }, // ſ
+    { 6, 7, 0, -4, 21, 11, 13405 }, // ̀
+    { 6, 7, 0, -2, 21, 11, 13416 }, // ́
+    { 8, 6, 0, -4, 20, 12, 13427 }, // ̂
+    { 8, 5, 0, -4, 20, 10, 13439 }, // ̃
+    { 10, 3, 0, -5, 18, 8, 13449 }, // ̄
+    { 8, 5, 0, -4, 20, 10, 13457 }, // ̆
+    { 4, 4, 0, -2, 19, 4, 13467 }, // ̇
+    { 10, 4, 0, -5, 19, 10, 13471 }, // ̈
+    { 8, 8, 0, -4, 22, 16, 13481 }, // ̉
+    { 8, 7, 0, -4, 21, 14, 13497 }, // ̊
+    { 10, 7, 0, -4, 21, 18, 13511 }, // ̋
+    { 10, 6, 0, -5, 21, 15, 13529 }, // ̌
+    { 10, 7, 0, -6, 21, 18, 13544 }, // ̏
+    { 8, 5, 0, -4, 20, 10, 13562 }, // ̑
+    { 4, 8, 0, -2, 22, 8, 13572 }, // ̒
+    { 5, 7, 0, -2, 22, 9, 13580 }, // ̓
+    { 5, 7, 0, -3, 22, 9, 13589 }, // ̔
+    { 4, 7, 0, -2, 22, 7, 13598 }, // ̕
+    { 4, 6, 0, -2, 16, 6, 13605 }, // ̛
+    { 4, 4, 0, -2, -2, 4, 13611 }, // ̣
+    { 10, 4, 0, -5, -2, 10, 13615 }, // ̤
+    { 6, 6, 0, -3, -1, 9, 13625 }, // ̥
+    { 5, 6, 0, -3, -1, 8, 13634 }, // ̦
+    { 6, 6, 0, -3, -1, 9, 13642 }, // ̧
+    { 6, 7, 0, -3, 1, 11, 13651 }, // ̨
+    { 3, 6, 7, 2, -1, 5, 13662 }, // ̩
+    { 8, 6, 0, -4, -1, 12, 13667 }, // ̭
+    { 8, 5, 0, -4, -1, 10, 13679 }, // ̮
+    { 8, 5, 0, -4, -1, 10, 13689 }, // ̰
+    { 10, 3, 0, -5, -2, 8, 13699 }, // ̱
+    { 8, 5, 0, -4, 20, 10, 13707 }, // ͂
+    { 10, 10, 0, -5, 25, 25, 13717 }, // ̈́
+    { 5, 5, 0, -2, -1, 7, 13742 }, // ͅ
+    { 14, 24, 16, 1, 24, 84, 13749 }, // Ѐ
+    { 14, 23, 16, 1, 23, 81, 0 }, // Ё
+    { 20, 24, 20, 0, 18, 120, 13833 }, // Ђ
+    { 13, 24, 15, 1, 24, 78, 13953 }, // Ѓ
+    { 15, 19, 17, 1, 18, 72, 14031 }, // Є
+    { 12, 19, 14, 1, 18, 57, 14103 }, // Ѕ
+    { 8, 18, 9, 1, 18, 36, 14160 }, // І
+    { 10, 23, 9, 0, 23, 58, 14196 }, // Ї
+    { 10, 24, 9, -1, 18, 60, 14254 }, // Ј
+    { 24, 19, 24, 0, 18, 114, 14314 }, // Љ
+    { 24, 19, 26, 1, 18, 114, 14428 }, // Њ
+    { 21, 18, 21, 0, 18, 95, 14542 }, // Ћ
+    { 17, 25, 18, 1, 24, 107, 14637 }, // Ќ
+    { 19, 24, 21, 1, 24, 114, 14744 }, // Ѝ
+    { 18, 25, 18, 0, 24, 113, 14858 }, // Ў
+    { 18, 24, 20, 1, 18, 108, 14971 }, // Џ
+    { 19, 18, 19, 0, 18, 86, 81 }, // А
+    { 14, 19, 16, 1, 18, 67, 167 }, // Б
+    { 14, 19, 15, 1, 18, 67, 234 }, // В
+    { 13, 18, 15, 1, 18, 59, 301 }, // Г
+    { 18, 24, 19, 0, 18, 108, 360 }, // Д
+    { 14, 18, 16, 1, 18, 63, 468 }, // Е
+    { 25, 19, 25, 0, 18, 119, 531 }, // Ж
+    { 14, 19, 15, 0, 18, 67, 650 }, // З
+    { 19, 18, 21, 1, 18, 86, 717 }, // И
+    { 19, 24, 21, 1, 24, 114, 803 }, // Й
+    { 17, 19, 18, 1, 18, 81, 917 }, // К
+    { 18, 19, 19, 0, 18, 86, 998 }, // Л
+    { 23, 18, 22, 0, 18, 104, 1084 }, // М
+    { 19, 18, 21, 1, 18, 86, 1188 }, // Н
+    { 18, 19, 19, 1, 18, 86, 1274 }, // О
+    { 19, 18, 20, 1, 18, 86, 1360 }, // П
+    { 14, 18, 15, 1, 18, 63, 1446 }, // Р
+    { 14, 19, 16, 1, 18, 67, 1509 }, // С
+    { 17, 18, 17, 0, 18, 77, 1576 }, // Т
+    { 18, 19, 18, 0, 18, 86, 1653 }, // У
+    { 18, 19, 20, 1, 18, 86, 1739 }, // Ф
+    { 18, 18, 18, 0, 18, 81, 1825 }, // Х
+    { 19, 24, 20, 1, 18, 114, 1906 }, // Ц
+    { 17, 18, 18, 0, 18, 77, 2020 }, // Ч
+    { 25, 18, 27, 1, 18, 113, 2097 }, // Ш
+    { 25, 24, 27, 1, 18, 150, 2210 }, // Щ
+    { 19, 19, 19, 0, 18, 91, 2360 }, // Ъ
+    { 22, 19, 24, 1, 18, 105, 2451 }, // Ы
+    { 14, 19, 16, 1, 18, 67, 2556 }, // Ь
+    { 15, 19, 17, 1, 18, 72, 2623 }, // Э
+    { 25, 19, 26, 1, 18, 119, 2695 }, // Ю
+    { 17, 19, 17, -1, 18, 81, 2814 }, // Я
+    { 13, 15, 14, 1, 14, 49, 2895 }, // а
+    { 13, 21, 15, 1, 20, 69, 2944 }, // б
+    { 13, 14, 14, 0, 13, 46, 3013 }, // в
+    { 12, 13, 12, 0, 13, 39, 3059 }, // г
+    { 16, 18, 16, 0, 13, 72, 3098 }, // д
+    { 11, 15, 13, 1, 14, 42, 3170 }, // е
+    { 20, 15, 20, 0, 14, 75, 3212 }, // ж
+    { 11, 15, 12, 0, 14, 42, 3287 }, // з
+    { 17, 13, 17, 0, 13, 56, 3329 }, // и
+    { 17, 19, 17, 0, 19, 81, 3385 }, // й
+    { 15, 15, 15, 0, 14, 57, 3466 }, // к
+    { 15, 14, 16, 0, 13, 53, 3523 }, // л
+    { 18, 13, 19, 1, 13, 59, 3576 }, // м
+    { 17, 13, 17, 0, 13, 56, 3635 }, // н
+    { 13, 15, 15, 1, 14, 49, 3691 }, // о
+    { 17, 13, 17, 0, 13, 56, 3740 }, // п
+    { 15, 20, 15, 0, 14, 75, 3796 }, // р
+    { 11, 15, 13, 1, 14, 42, 3871 }, // с
+    { 14, 13, 14, 0, 13, 46, 3913 }, // т
+    { 15, 19, 15, 0, 13, 72, 3959 }, // у
+    { 17, 26, 18, 1, 20, 111, 4031 }, // ф
+    { 15, 13, 15, 0, 13, 49, 4142 }, // х
+    { 17, 18, 17, 0, 13, 77, 4191 }, // ц
+    { 15, 13, 15, 0, 13, 49, 4268 }, // ч
+    { 22, 13, 22, 0, 13, 72, 4317 }, // ш
+    { 22, 18, 22, 0, 13, 99, 4389 }, // щ
+    { 16, 14, 16, 0, 13, 56, 4488 }, // ъ
+    { 20, 14, 20, 0, 13, 70, 4544 }, // ы
+    { 13, 14, 13, 0, 13, 46, 4614 }, // ь
+    { 12, 15, 13, 0, 14, 45, 4660 }, // э
+    { 21, 15, 21, 0, 14, 79, 4705 }, // ю
+    { 14, 14, 14, 0, 13, 49, 4784 }, // я
+    { 11, 22, 13, 1, 21, 61, 15079 }, // ѐ
+    { 11, 20, 13, 1, 19, 55, 4833 }, // ё
+    { 15, 26, 16, 0, 20, 98, 15140 }, // ђ
+    { 12, 21, 12, 0, 21, 63, 15238 }, // ѓ
+    { 12, 15, 13, 1, 14, 45, 15301 }, // є
+    { 10, 15, 12, 1, 14, 38, 15346 }, // ѕ
+    { 8, 20, 8, 0, 20, 40, 15384 }, // і
+    { 10, 19, 8, -1, 19, 48, 15424 }, // ї
+    { 8, 26, 7, -2, 20, 52, 15472 }, // ј
+    { 20, 14, 20, 0, 13, 70, 15524 }, // љ
+    { 21, 14, 21, 0, 13, 74, 15594 }, // њ
+    { 17, 20, 17, 0, 20, 85, 15668 }, // ћ
+    { 15, 22, 15, 0, 21, 83, 15753 }, // ќ
+    { 17, 21, 17, 0, 21, 90, 15836 }, // ѝ
+    { 15, 25, 15, 0, 19, 94, 15926 }, // ў
+    { 17, 18, 17, 0, 13, 77, 16020 }, // џ
+    { 18, 21, 18, 0, 20, 95, 16097 }, // Ѣ
+    { 15, 19, 15, 0, 18, 72, 16192 }, // ѣ
+    { 18, 19, 19, 1, 18, 86, 16264 }, // Ѳ
+    { 13, 15, 15, 1, 14, 49, 16350 }, // ѳ
+    { 19, 19, 19, 0, 18, 91, 16399 }, // Ѵ
+    { 16, 15, 15, 0, 14, 60, 16490 }, // ѵ
+    { 19, 30, 21, 1, 24, 143, 16550 }, // Ҋ
+    { 17, 24, 17, 0, 19, 102, 16693 }, // ҋ
+    { 15, 19, 16, 0, 18, 72, 16795 }, // Ҍ
+    { 13, 19, 13, 0, 18, 62, 16867 }, // ҍ
+    { 14, 18, 15, 1, 18, 63, 16929 }, // Ҏ
+    { 15, 20, 15, 0, 14, 75, 16992 }, // ҏ
+    { 13, 21, 14, 1, 21, 69, 17067 }, // Ґ
+    { 11, 16, 12, 1, 16, 44, 17136 }, // ґ
+    { 14, 18, 15, 0, 18, 63, 17180 }, // Ғ
+    { 12, 13, 12, 0, 13, 39, 17243 }, // ғ
+    { 15, 24, 17, 1, 18, 90, 17282 }, // Ҕ
+    { 14, 19, 15, 0, 13, 67, 17372 }, // ҕ
+    { 25, 24, 25, 0, 18, 150, 17439 }, // Җ
+    { 20, 19, 20, 0, 14, 95, 17589 }, // җ
+    { 14, 24, 15, 0, 18, 84, 0 }, // Ҙ
+    { 11, 19, 12, 0, 14, 53, 84 }, // ҙ
+    { 17, 24, 18, 1, 18, 102, 137 }, // Қ
+    { 15, 19, 15, 0, 14, 72, 239 }, // қ
+    { 18, 19, 19, 1, 18, 86, 311 }, // Ҝ
+    { 15, 15, 15, 0, 14, 57, 397 }, // ҝ
+    { 18, 19, 18, 0, 18, 86, 454 }, // Ҟ
+    { 14, 19, 14, 0, 18, 67, 540 }, // ҟ
+    { 21, 19, 21, 0, 18, 100, 607 }, // Ҡ
+    { 17, 15, 17, 0, 14, 64, 707 }, // ҡ
+    { 20, 24, 21, 1, 18, 120, 771 }, // Ң
+    { 17, 18, 18, 0, 13, 77, 891 }, // ң
+    { 23, 18, 24, 1, 18, 104, 968 }, // Ҥ
+    { 19, 13, 20, 0, 13, 62, 1072 }, // ҥ
+    { 25, 24, 26, 1, 18, 150, 1134 }, // Ҧ
+    { 23, 19, 24, 0, 13, 110, 1284 }, // ҧ
+    { 19, 19, 21, 1, 18, 91, 1394 }, // Ҩ
+    { 15, 15, 16, 1, 14, 57, 1485 }, // ҩ
+    { 14, 24, 16, 1, 18, 84, 1542 }, // Ҫ
+    { 11, 19, 13, 1, 14, 53, 1626 }, // ҫ
+    { 17, 24, 17, 0, 18, 102, 1679 }, // Ҭ
+    { 14, 18, 14, 0, 13, 63, 1781 }, // ҭ
+    { 17, 18, 17, 0, 18, 77, 1844 }, // Ү
+    { 15, 19, 15, 0, 13, 72, 1921 }, // ү
+    { 17, 18, 17, 0, 18, 77, 1993 }, // Ұ
+    { 15, 19, 15, 0, 13, 72, 2070 }, // ұ
+    { 19, 24, 18, 0, 18, 114, 2142 }, // Ҳ
+    { 15, 18, 15, 0, 13, 68, 2256 }, // ҳ
+    { 23, 24, 23, 0, 18, 138, 2324 }, // Ҵ
+    { 19, 18, 20, 0, 13, 86, 2462 }, // ҵ
+    { 18, 24, 18, 0, 18, 108, 2548 }, // Ҷ
+    { 15, 18, 16, 0, 13, 68, 2656 }, // ҷ
+    { 17, 18, 18, 0, 18, 77, 2724 }, // Ҹ
+    { 15, 13, 15, 0, 13, 49, 2801 }, // ҹ
+    { 17, 18, 18, 1, 18, 77, 2850 }, // Һ
+    { 17, 20, 17, 0, 20, 85, 2927 }, // һ
+    { 20, 19, 20, 0, 18, 95, 3012 }, // Ҽ
+    { 15, 15, 16, 0, 14, 57, 3107 }, // ҽ
+    { 20, 24, 20, 0, 18, 120, 3164 }, // Ҿ
+    { 15, 19, 16, 0, 14, 72, 3284 }, // ҿ
+    { 8, 18, 9, 1, 18, 36, 3356 }, // Ӏ
+    { 25, 25, 25, 0, 24, 157, 3392 }, // Ӂ
+    { 20, 20, 20, 0, 19, 100, 3549 }, // ӂ
+    { 16, 24, 17, 1, 18, 96, 3649 }, // Ӄ
+    { 14, 20, 15, 0, 14, 70, 3745 }, // ӄ
+    { 18, 24, 19, 0, 18, 108, 3815 }, // Ӆ
+    { 15, 18, 16, 0, 13, 68, 3923 }, // ӆ
+    { 19, 24, 20, 1, 18, 114, 3991 }, // Ӈ
+    { 17, 19, 17, 0, 13, 81, 4105 }, // ӈ
+    { 19, 24, 21, 1, 18, 114, 4186 }, // Ӊ
+    { 17, 18, 17, 0, 13, 77, 4300 }, // ӊ
+    { 17, 24, 18, 0, 18, 102, 4377 }, // Ӌ
+    { 15, 18, 15, 0, 13, 68, 4479 }, // ӌ
+    { 23, 24, 22, 0, 18, 138, 4547 }, // Ӎ
+    { 18, 18, 19, 1, 13, 81, 4685 }, // ӎ
+    { 8, 20, 8, 0, 20, 40, 4766 }, // ӏ
+    { 19, 24, 19, 0, 24, 114, 4806 }, // Ӑ
+    { 13, 20, 14, 1, 19, 65, 4920 }, // ӑ
+    { 19, 23, 19, 0, 23, 110, 4985 }, // Ӓ
+    { 13, 20, 14, 1, 19, 65, 5095 }, // ӓ
+    { 24, 18, 23, -1, 18, 108, 5160 }, // Ӕ
+    { 19, 15, 20, 1, 14, 72, 5268 }, // ӕ
+    { 14, 24, 16, 1, 24, 84, 5340 }, // Ӗ
+    { 11, 20, 13, 1, 19, 55, 5424 }, // ӗ
+    { 15, 19, 17, 1, 18, 72, 5479 }, // Ә
+    { 11, 15, 13, 1, 14, 42, 5551 }, // ә
+    { 15, 24, 17, 1, 23, 90, 5593 }, // Ӛ
+    { 11, 20, 13, 1, 19, 55, 5683 }, // ӛ
+    { 25, 24, 25, 0, 23, 150, 5738 }, // Ӝ
+    { 20, 20, 20, 0, 19, 100, 5888 }, // ӝ
+    { 14, 24, 15, 0, 23, 84, 5988 }, // Ӟ
+    { 11, 20, 12, 0, 19, 55, 6072 }, // ӟ
+    { 14, 19, 14, 0, 18, 67, 6127 }, // Ӡ
+    { 12, 19, 13, 0, 13, 57, 6194 }, // ӡ
+    { 19, 23, 21, 1, 23, 110, 6251 }, // Ӣ
+    { 17, 18, 17, 0, 18, 77, 6361 }, // ӣ
+    { 19, 23, 21, 1, 23, 110, 6438 }, // Ӥ
+    { 17, 19, 17, 0, 19, 81, 6548 }, // ӥ
+    { 18, 24, 19, 1, 23, 108, 6629 }, // Ӧ
+    { 13, 20, 15, 1, 19, 65, 6737 }, // ӧ
+    { 18, 19, 19, 1, 18, 86, 6802 }, // Ө
+    { 13, 15, 15, 1, 14, 49, 6888 }, // ө
+    { 18, 24, 21, 1, 23, 108, 6937 }, // Ӫ
+    { 13, 20, 15, 1, 19, 65, 7045 }, // ӫ
+    { 15, 24, 17, 1, 23, 90, 7110 }, // Ӭ
+    { 12, 20, 13, 0, 19, 60, 7200 }, // ӭ
+    { 18, 24, 18, 0, 23, 108, 7260 }, // Ӯ
+    { 15, 24, 15, 0, 18, 90, 7368 }, // ӯ
+    { 18, 24, 18, 0, 23, 108, 7458 }, // Ӱ
+    { 15, 25, 15, 0, 19, 94, 7566 }, // ӱ
+    { 18, 26, 18, 0, 25, 117, 7660 }, // Ӳ
+    { 15, 27, 15, 0, 21, 102, 7777 }, // ӳ
+    { 17, 23, 18, 0, 23, 98, 7879 }, // Ӵ
+    { 15, 19, 16, 0, 19, 72, 7977 }, // ӵ
+    { 13, 24, 15, 1, 18, 78, 8049 }, // Ӷ
+    { 12, 18, 12, 0, 13, 54, 8127 }, // ӷ
+    { 22, 24, 24, 1, 23, 132, 8181 }, // Ӹ
+    { 20, 20, 20, 0, 19, 100, 8313 }, // ӹ
+    { 14, 24, 15, 0, 18, 84, 8413 }, // Ӻ
+    { 12, 18, 12, 0, 13, 54, 8497 }, // ӻ
+    { 18, 24, 18, 0, 18, 108, 8551 }, // Ӽ
+    { 15, 19, 15, 0, 13, 72, 8659 }, // ӽ
+    { 18, 18, 18, 0, 18, 81, 8731 }, // Ӿ
+    { 15, 13, 15, 0, 13, 49, 8812 }, // ӿ
+    { 0, 0, 13, 0, 0, 0, 8861 }, //  
+    { 0, 0, 25, 0, 0, 0, 8861 }, //  
+    { 0, 0, 13, 0, 0, 0, 8861 }, //  
+    { 0, 0, 25, 0, 0, 0, 8861 }, //  
+    { 0, 0, 8, 0, 0, 0, 8861 }, //  
+    { 0, 0, 6, 0, 0, 0, 8861 }, //  
+    { 0, 0, 4, 0, 0, 0, 8861 }, //  
+    { 0, 0, 16, 0, 0, 0, 8861 }, //  
+    { 0, 0, 7, 0, 0, 0, 8861 }, //  
+    { 0, 0, 5, 0, 0, 0, 8861 }, //  
+    { 0, 0, 1, 0, 0, 0, 8861 }, //  
+    { 0, 0, 0, 0, 0, 0, 8861 }, // ​
+    { 2, 21, 0, -1, 15, 11, 8861 }, // ‌
+    { 6, 23, 0, -3, 17, 35, 8872 }, // ‍
+    { 8, 24, 0, -4, 18, 48, 8907 }, // ‎
+    { 8, 24, 0, -4, 18, 48, 8955 }, // ‏
+    { 8, 3, 9, 1, 8, 6, 9003 }, // ‐
+    { 8, 3, 9, 1, 8, 6, 9009 }, // ‑
+    { 12, 3, 16, 2, 10, 9, 9015 }, // ‒
+    { 13, 3, 13, 0, 8, 10, 9291 }, // –
+    { 25, 3, 25, 0, 8, 19, 9301 }, // —
+    { 25, 3, 25, 0, 8, 19, 9024 }, // ―
+    { 8, 26, 13, 2, 20, 52, 9043 }, // ‖
+    { 13, 6, 13, 0, -1, 20, 9095 }, // ‗
+    { 5, 8, 6, 1, 19, 10, 9320 }, // ‘
+    { 5, 8, 6, 0, 19, 10, 9330 }, // ’
+    { 5, 9, 6, 0, 4, 12, 9115 }, // ‚
+    { 5, 8, 6, 1, 19, 10, 9127 }, // ‛
+    { 10, 8, 11, 1, 19, 20, 9340 }, // “
+    { 10, 8, 11, 0, 19, 20, 9360 }, // ”
+    { 10, 9, 11, 0, 4, 23, 9137 }, // „
+    { 10, 8, 11, 1, 19, 20, 9160 }, // ‟
+    { 12, 17, 13, 0, 18, 51, 9180 }, // †
+    { 12, 20, 13, 0, 18, 60, 9231 }, // ‡
+    { 6, 6, 8, 1, 9, 9, 9291 }, // •
+    { 9, 9, 16, 3, 13, 21, 9300 }, // ‣
+    { 5, 4, 7, 1, 3, 5, 9321 }, // ․
+    { 11, 5, 13, 1, 4, 14, 9326 }, // ‥
+    { 21, 5, 25, 2, 4, 27, 9380 }, // …
+    { 5, 4, 7, 1, 9, 5, 9340 }, // ‧
+    { 0, 0, 0, 0, 0, 0, 9345 }, //  
+    { 0, 0, 0, 0, 0, 0, 9345 }, //  
+    { 8, 24, 0, -4, 18, 48, 9345 }, // ‪
+    { 8, 24, 0, -4, 18, 48, 9393 }, // ‫
+    { 8, 24, 0, -4, 18, 48, 9441 }, // ‬
+    { 11, 24, 0, -5, 18, 66, 9489 }, // ‭
+    { 11, 24, 0, -5, 18, 66, 9555 }, // ‮
+    { 0, 0, 3, 0, 0, 0, 9621 }, //  
+    { 32, 21, 34, 1, 19, 168, 9621 }, // ‰
+    { 5, 9, 7, 1, 18, 12, 9789 }, // ′
+    { 10, 9, 11, 1, 18, 23, 9801 }, // ″
+    { 15, 9, 16, 1, 18, 34, 9824 }, // ‴
+    { 6, 9, 7, 0, 18, 14, 9858 }, // ‵
+    { 11, 9, 12, 0, 18, 25, 9872 }, // ‶
+    { 17, 9, 17, 0, 18, 39, 9897 }, // ‷
+    { 11, 6, 12, 1, 0, 17, 9936 }, // ‸
+    { 7, 10, 8, 0, 11, 18, 9953 }, // ‹
+    { 7, 10, 8, 1, 11, 18, 9971 }, // ›
+    { 16, 18, 16, 0, 17, 72, 9989 }, // ※
+    { 11, 20, 14, 2, 19, 55, 10061 }, // ‼
+    { 13, 3, 13, 0, 21, 10, 10116 }, // ‾
+    { 6, 3, 8, 1, 8, 5, 10126 }, // ⁃
+    { 13, 21, 5, -4, 19, 69, 10131 }, // ⁄
+    { 20, 20, 22, 1, 19, 100, 10200 }, // ⁇
+    { 17, 20, 19, 1, 19, 85, 10300 }, // ⁈
+    { 16, 20, 19, 2, 19, 80, 10385 }, // ⁉
+    { 15, 5, 25, 5, 10, 19, 10465 }, // ⁓
+    { 20, 9, 21, 1, 18, 45, 10484 }, // ⁗
+    { 0, 0, 6, 0, 0, 0, 10529 }, //  
+    { 0, 0, 0, 0, 0, 0, 10529 }, // ⁠
+    { 0, 0, 0, 0, 0, 0, 10529 }, // ⁡
+    { 0, 0, 0, 0, 0, 0, 10529 }, // ⁢
+    { 0, 0, 0, 0, 0, 0, 10529 }, // ⁣
+    { 0, 0, 0, 0, 0, 0, 10529 }, // ⁤
+    { 11, 13, 11, 0, 21, 36, 10529 }, // ⁰
+    { 11, 13, 11, 0, 21, 36, 10565 }, // ⁴
+    { 9, 13, 11, 1, 21, 30, 10601 }, // ⁵
+    { 9, 13, 11, 1, 21, 30, 10631 }, // ⁶
+    { 8, 13, 11, 2, 21, 26, 10661 }, // ⁷
+    { 9, 13, 11, 1, 21, 30, 10687 }, // ⁸
+    { 9, 13, 11, 1, 21, 30, 10717 }, // ⁹
+    { 11, 9, 14, 2, 18, 25, 10747 }, // ⁿ
+    { 11, 12, 11, 0, 8, 33, 10772 }, // ₀
+    { 8, 13, 11, 2, 9, 26, 10805 }, // ₁
+    { 9, 12, 11, 1, 8, 27, 10831 }, // ₂
+    { 9, 12, 11, 1, 8, 27, 10858 }, // ₃
+    { 11, 12, 11, 0, 8, 33, 10885 }, // ₄
+    { 9, 12, 11, 1, 8, 27, 10918 }, // ₅
+    { 9, 12, 11, 1, 8, 27, 10945 }, // ₆
+    { 8, 12, 11, 2, 8, 24, 10972 }, // ₇
+    { 9, 12, 11, 1, 8, 27, 10996 }, // ₈
+    { 9, 12, 11, 1, 8, 27, 11023 }, // ₉
+    { 13, 18, 16, 1, 18, 59, 11050 }, // ₣
+    { 14, 19, 16, 1, 18, 67, 11109 }, // ₤
+    { 31, 19, 31, 0, 18, 148, 11176 }, // ₧
+    { 15, 19, 16, 0, 18, 72, 11324 }, // €
+    { 15, 11, 25, 5, 14, 42, 11396 }, // ←
+    { 11, 17, 25, 7, 17, 47, 11438 }, // ↑
+    { 15, 11, 25, 5, 14, 42, 11485 }, // →
+    { 11, 17, 25, 7, 17, 47, 11527 }, // ↓
+    { 15, 11, 25, 5, 14, 42, 11574 }, // ↔
+    { 11, 17, 25, 7, 17, 47, 11616 }, // ↕
+    { 11, 17, 25, 7, 17, 47, 11663 }, // ↨
+    { 11, 17, 25, 7, 17, 47, 11710 }, // ↲
+    { 11, 17, 25, 7, 17, 47, 11757 }, // ↳
+    { 13, 12, 25, 6, 15, 39, 11804 }, // ↵
+    { 15, 11, 25, 5, 14, 42, 11843 }, // ⇐
+    { 11, 15, 25, 7, 16, 42, 11885 }, // ⇑
+    { 15, 11, 25, 5, 14, 42, 11927 }, // ⇒
+    { 11, 15, 25, 7, 16, 42, 11969 }, // ⇓
+    { 15, 11, 25, 5, 14, 42, 12011 }, // ⇔
+    { 17, 19, 25, 4, 18, 81, 12053 }, // ∀
+    { 13, 21, 16, 1, 20, 69, 12134 }, // ∂
+    { 11, 18, 25, 7, 18, 50, 12203 }, // ∃
+    { 19, 20, 25, 3, 19, 95, 12253 }, // ∅
+    { 16, 18, 16, 0, 18, 72, 12348 }, // ∆
+    { 17, 19, 25, 4, 18, 81, 12420 }, // ∇
+    { 17, 18, 25, 4, 18, 77, 12501 }, // ∈
+    { 17, 22, 25, 4, 19, 94, 12578 }, // ∉
+    { 17, 14, 25, 4, 16, 60, 12672 }, // ∊
+    { 17, 18, 25, 4, 18, 77, 12732 }, // ∋
+    { 17, 22, 25, 4, 19, 94, 12809 }, // ∌
+    { 17, 14, 25, 4, 16, 60, 12903 }, // ∍
+    { 19, 22, 20, 1, 18, 105, 12963 }, // ∏
+    { 15, 23, 15, 0, 18, 87, 13068 }, // ∑
+    { 11, 3, 16, 2, 10, 9, 13155 }, // −
+    { 12, 20, 12, 0, 18, 60, 13164 }, // ∕
+    { 12, 20, 13, 1, 18, 60, 13224 }, // ∖
+    { 12, 13, 16, 2, 15, 39, 13284 }, // ∗
+    { 9, 9, 16, 3, 13, 21, 13323 }, // ∘
+    { 4, 4, 16, 6, 9, 4, 13344 }, // ∙
+    { 16, 24, 16, 0, 21, 96, 13348 }, // √
+    { 13, 10, 16, 1, 13, 33, 13444 }, // ∝
+    { 16, 9, 16, 0, 12, 36, 13477 }, // ∞
+    { 16, 18, 25, 4, 18, 72, 13513 }, // ∟
+    { 18, 18, 25, 3, 18, 81, 13585 }, // ∠
+    { 3, 26, 13, 5, 20, 20, 13666 }, // ∣
+    { 8, 26, 13, 2, 20, 52, 13686 }, // ∥
+    { 17, 18, 25, 4, 18, 77, 13738 }, // ∧
+    { 17, 18, 25, 4, 18, 77, 13815 }, // ∨
+    { 15, 18, 25, 5, 18, 68, 13892 }, // ∩
+    { 15, 19, 25, 5, 18, 72, 13960 }, // ∪
+    { 14, 26, 16, 1, 20, 91, 14032 }, // ∫
+    { 16, 15, 25, 5, 14, 60, 14123 }, // ∴
+    { 16, 15, 25, 5, 14, 60, 14183 }, // ∵
+    { 4, 13, 8, 2, 15, 13, 14243 }, // ∶
+    { 16, 15, 25, 5, 14, 60, 14256 }, // ∷
+    { 15, 5, 25, 5, 10, 19, 14316 }, // ∼
+    { 15, 13, 25, 5, 15, 49, 14335 }, // ≅
+    { 12, 9, 16, 2, 13, 27, 14384 }, // ≈
+    { 15, 8, 25, 5, 11, 30, 14411 }, // ≍
+    { 11, 11, 16, 2, 14, 31, 14441 }, // ≠
+    { 15, 11, 25, 5, 13, 42, 14472 }, // ≡
+    { 12, 15, 16, 2, 15, 45, 14514 }, // ≤
+    { 12, 15, 16, 2, 15, 45, 14559 }, // ≥
+    { 21, 13, 25, 2, 15, 69, 14604 }, // ≪
+    { 21, 13, 25, 2, 15, 69, 14673 }, // ≫
+    { 17, 15, 25, 4, 16, 64, 14742 }, // ⊃
+    { 17, 23, 25, 4, 20, 98, 14806 }, // ⊄
+    { 17, 23, 25, 4, 20, 98, 14904 }, // ⊅
+    { 17, 18, 25, 4, 18, 77, 15002 }, // ⊆
+    { 17, 18, 25, 4, 18, 77, 15079 }, // ⊇
+    { 19, 19, 25, 3, 18, 91, 15156 }, // ⊕
+    { 19, 19, 25, 3, 18, 91, 15247 }, // ⊖
+    { 19, 19, 25, 3, 18, 91, 15338 }, // ⊗
+    { 19, 19, 25, 3, 18, 91, 15429 }, // ⊘
+    { 15, 18, 25, 5, 18, 68, 15520 }, // ⊥
+    { 4, 4, 16, 6, 9, 4, 15588 }, // ⋅
+    { 21, 4, 25, 2, 9, 21, 15592 }, // ⋯
+    { 21, 20, 19, 0, 20, 105, 15613 }, // ﬀ
+    { 17, 20, 17, 0, 20, 85, 15718 }, // ﬁ
+    { 17, 20, 17, 0, 20, 85, 15803 }, // ﬂ
+    { 25, 20, 25, 0, 20, 125, 15888 }, // ﬃ
+    { 25, 20, 25, 0, 20, 125, 16013 }, // ﬄ
+    { 19, 21, 19, 0, 20, 100, 16138 }, // ﬅ
+    { 21, 21, 22, 1, 20, 111, 16238 }, // ﬆ
+    { 25, 24, 25, 0, 21, 150, 16349 }, // �
 };
 
 static const EpdUnicodeInterval bookerly_12_regularIntervals[] = {
@@ -2264,32 +2300,317 @@ static const EpdUnicodeInterval bookerly_12_regularIntervals[] = {
     { 0x22A5, 0x22A5, 0x2E7 },
     { 0x22C5, 0x22C5, 0x2E8 },
     { 0x22EF, 0x22EF, 0x2E9 },
-    { 0xFFFD, 0xFFFD, 0x2EA },
+    { 0xFB00, 0xFB06, 0x2EA },
+    { 0xFFFD, 0xFFFD, 0x2F1 },
 };
 
 static const EpdFontGroup bookerly_12_regularGroups[] = {
-    { 0, 3215, 5447, 100, 0 },
-    { 3215, 3264, 6655, 96, 100 },
-    { 6479, 4443, 10594, 128, 196 },
-    { 10922, 302, 344, 33, 324 },
-    { 11224, 7774, 17684, 220, 357 },
-    { 18998, 1012, 1784, 74, 577 },
-    { 20010, 422, 521, 18, 651 },
-    { 20432, 254, 346, 4, 669 },
-    { 20686, 423, 657, 15, 673 },
-    { 21109, 1810, 3560, 58, 688 },
-    { 22919, 105, 150, 1, 746 },
+    { 0, 4580, 9407, 151, 5 },
+    { 4580, 2698, 4888, 66, 358 },
+    { 7278, 7842, 17684, 263, 0 },
+    { 15120, 8361, 16499, 274, 473 },
+};
+
+static const uint8_t bookerly_12_regularGlyphGroups[754] = {
+    2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0,
+    2, 2, 2, 2, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0,
+    0, 2, 2, 2, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0,
+    0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 3, 3, 3, 0, 0, 3, 3, 0, 0, 3,
+    3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+};
+
+static const uint8_t bookerly_12_regularKernLeftClasses[754] = {
+    0, 0, 0, 0, 0, 0, 0, 88, 0, 0, 0, 0, 88, 89, 0, 70,
+    0, 2, 27, 2, 25, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 3, 103, 76, 12, 0, 60, 0, 54, 54, 38,
+    47, 34, 110, 20, 12, 65, 62, 24, 84, 10, 11, 8, 8, 80, 4, 112,
+    92, 52, 0, 0, 0, 0, 26, 31, 72, 54, 46, 23, 51, 29, 68, 0,
+    0, 104, 29, 29, 31, 31, 95, 32, 69, 79, 50, 13, 13, 113, 13, 79,
+    81, 0, 0, 0, 0, 96, 0, 0, 0, 0, 0, 0, 0, 0, 0, 93,
+    0, 27, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 56,
+    0, 0, 0, 43, 3, 3, 3, 3, 3, 3, 0, 76, 0, 0, 0, 0,
+    54, 54, 54, 54, 12, 20, 12, 12, 12, 12, 12, 0, 85, 11, 11, 11,
+    11, 4, 55, 100, 26, 26, 26, 26, 26, 26, 46, 72, 46, 46, 46, 46,
+    68, 68, 58, 58, 105, 29, 31, 31, 31, 31, 31, 0, 31, 50, 50, 50,
+    50, 13, 31, 13, 3, 26, 3, 26, 48, 77, 76, 72, 76, 72, 76, 72,
+    76, 72, 12, 21, 12, 54, 0, 46, 0, 46, 0, 46, 121, 108, 0, 46,
+    0, 51, 0, 51, 0, 51, 0, 51, 54, 29, 54, 29, 54, 58, 54, 58,
+    54, 58, 115, 94, 54, 68, 38, 0, 38, 106, 47, 0, 0, 34, 104, 34,
+    104, 0, 21, 0, 0, 34, 75, 20, 29, 20, 29, 20, 29, 29, 20, 29,
+    12, 31, 12, 31, 12, 31, 0, 46, 24, 32, 24, 32, 24, 32, 84, 69,
+    84, 69, 84, 69, 84, 69, 10, 79, 10, 0, 10, 79, 11, 50, 11, 50,
+    11, 50, 11, 50, 11, 50, 11, 97, 8, 13, 4, 13, 4, 112, 79, 112,
+    79, 112, 79, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 102, 102, 71, 0, 119, 116, 14, 14, 49, 18, 18,
+    53, 5, 14, 1, 14, 16, 114, 59, 7, 22, 102, 5, 59, 14, 14, 5,
+    14, 101, 14, 6, 14, 36, 118, 7, 1, 61, 44, 22, 14, 14, 22, 18,
+    14, 18, 6, 6, 14, 45, 28, 0, 33, 42, 74, 39, 79, 66, 66, 39,
+    66, 66, 66, 28, 66, 28, 72, 33, 15, 28, 87, 42, 66, 66, 42, 30,
+    66, 30, 28, 28, 66, 74, 74, 83, 33, 0, 69, 98, 120, 0, 30, 30,
+    67, 39, 66, 15, 66, 90, 109, 6, 28, 41, 73, 22, 42, 18, 30, 36,
+    28, 35, 86, 37, 33, 0, 0, 40, 78, 59, 79, 40, 78, 5, 39, 5,
+    39, 5, 39, 22, 42, 0, 0, 0, 0, 91, 99, 118, 72, 7, 33, 17,
+    15, 17, 15, 57, 107, 22, 42, 22, 42, 14, 66, 64, 67, 111, 74, 111,
+    74, 14, 5, 39, 102, 66, 22, 42, 49, 82, 22, 42, 14, 66, 22, 42,
+    117, 16, 45, 16, 45, 102, 74, 102, 74, 6, 28, 6, 28, 5, 39, 59,
+    79, 0, 0, 14, 66, 14, 66, 6, 28, 6, 28, 6, 28, 6, 28, 1,
+    15, 1, 15, 1, 15, 14, 66, 7, 33, 14, 66, 37, 33, 63, 87, 44,
+    87, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 27, 27, 0, 27, 27, 27, 0, 0, 9, 19, 2, 9, 9, 19, 2,
+    9, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 93, 56, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 23, 68, 104, 68, 104, 79,
+    79, 0,
+};
+
+static const uint8_t bookerly_12_regularKernRightClasses[754] = {
+    0, 0, 0, 0, 0, 0, 89, 62, 0, 0, 0, 0, 62, 0, 74, 48,
+    0, 37, 20, 3, 36, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 88,
+    87, 0, 0, 0, 34, 0, 1, 60, 5, 60, 60, 60, 5, 60, 60, 80,
+    60, 60, 99, 60, 5, 60, 5, 60, 66, 31, 12, 28, 28, 86, 15, 0,
+    0, 19, 97, 0, 0, 0, 27, 29, 2, 2, 2, 54, 16, 29, 90, 69,
+    29, 29, 45, 45, 2, 104, 2, 45, 18, 39, 24, 22, 22, 96, 11, 83,
+    0, 0, 98, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 44,
+    0, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 81,
+    0, 0, 0, 95, 1, 1, 1, 1, 1, 1, 40, 5, 60, 60, 60, 60,
+    60, 60, 60, 60, 60, 60, 5, 5, 5, 5, 5, 0, 78, 12, 12, 12,
+    12, 15, 60, 85, 27, 27, 27, 72, 73, 27, 27, 2, 2, 2, 2, 71,
+    103, 90, 59, 32, 2, 45, 2, 2, 2, 2, 2, 0, 2, 24, 24, 24,
+    24, 11, 29, 11, 1, 77, 1, 75, 1, 27, 5, 2, 5, 2, 5, 2,
+    5, 2, 60, 2, 60, 2, 60, 2, 60, 2, 60, 2, 60, 2, 60, 2,
+    5, 16, 5, 16, 5, 16, 5, 16, 60, 29, 60, 84, 60, 32, 60, 32,
+    60, 32, 60, 90, 60, 90, 60, 90, 80, 58, 60, 29, 45, 60, 29, 60,
+    29, 60, 29, 60, 29, 60, 61, 60, 45, 60, 45, 60, 45, 45, 60, 45,
+    5, 2, 5, 2, 5, 2, 5, 2, 60, 45, 60, 45, 60, 93, 66, 18,
+    66, 18, 66, 18, 66, 57, 31, 39, 31, 39, 31, 39, 12, 24, 12, 24,
+    12, 24, 12, 24, 12, 24, 12, 24, 28, 22, 15, 11, 15, 0, 83, 0,
+    83, 0, 92, 85, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 64, 64, 10, 64, 13, 100, 64, 64, 79, 42, 64,
+    10, 64, 64, 26, 64, 21, 64, 64, 64, 56, 64, 46, 0, 64, 64, 64,
+    42, 91, 64, 13, 64, 64, 13, 10, 26, 50, 55, 64, 25, 64, 64, 10,
+    64, 64, 0, 64, 63, 41, 101, 9, 9, 52, 4, 49, 51, 9, 9, 9,
+    30, 9, 9, 4, 9, 70, 4, 7, 23, 4, 67, 9, 8, 9, 9, 7,
+    9, 9, 51, 9, 47, 4, 4, 94, 9, 4, 68, 0, 76, 65, 30, 9,
+    94, 9, 9, 17, 9, 10, 7, 13, 4, 53, 23, 64, 9, 0, 0, 64,
+    70, 64, 9, 64, 9, 64, 9, 46, 49, 0, 51, 64, 9, 64, 9, 0,
+    0, 10, 7, 64, 9, 64, 9, 64, 9, 13, 4, 13, 4, 10, 7, 38,
+    23, 38, 23, 55, 67, 0, 7, 25, 8, 25, 8, 64, 94, 35, 14, 35,
+    14, 64, 46, 49, 64, 9, 42, 30, 64, 9, 64, 9, 25, 8, 0, 9,
+    94, 21, 41, 21, 41, 43, 41, 64, 4, 0, 82, 0, 82, 46, 49, 0,
+    51, 0, 102, 64, 9, 64, 9, 13, 4, 13, 4, 13, 4, 0, 51, 26,
+    17, 26, 17, 26, 17, 0, 8, 64, 9, 64, 9, 64, 9, 55, 67, 55,
+    67, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 20, 20, 0, 20, 20, 20, 0, 0, 6, 33, 3, 6, 6, 33, 3,
+    6, 0, 0, 0, 0, 0, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 44, 81, 0, 89, 0, 0, 0,
+    34, 34, 89, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 54, 54, 54, 54, 54,
+    18, 0,
+};
+
+static const int8_t bookerly_12_regularKernMatrix[12810] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -3, -3, 0, 0, -1, -1, -2, 0, 0, 0, -2, -3, 0, 0, -1, 0, 0, -1, -4, 0, -1, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, -3, -3, 1, 0, 0, -2, -2, -4, -2, 0, 0, -4, 0, -2, -2, -2, -3, 1, 0, 0, -3, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -1, -2, 0, -1, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0,
+    0, 1, 0, 0, 0, -1, -2, -1, -2, 0, -2, -2, -1, -1, -1, -2, 0, -1, 0, 0, 0, 1, -2, -1, -1, -2, -2, 0, -2, 0, 0, -2, 0, -1, 0, -2, 0, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, -2, 0, 0, 0, 0, -2, -2, 0, 0, -3, 0, 0, 0, -2, -1, 0, -2, 0, 0, 0, 0, 0, -3, 0, 0, -2, 0, -2, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -3, -2, -2, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 1, -2, 0, -2, 0, -1, 0, -1, 0, -1, 0, 0, -2, 1, 0, 0, 0, 2, 0, 0, 0, -3, -2, 0, 0, -3, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 1, 1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -2, -2, -1, 0, -1, 0, -1, -1, 0, 0, -1, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, -1, -2, -2, 0, -1, 0, 0, -1, -2, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, -2, 0, 0, -1, -1, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, -1, -3, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -3, -2, 0, 0, 0, -1, -2, -2, -1, 0, 0, -3, 0, 0, -1, 0, -2, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -3, -2, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, -2, 1, 1, 0, 0, 2, 0, 0, 0, -3, -2, 0, 0, -4, 0, 0, 0, -1, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -2, 2, 2, 0, 1, 0, 0, 0, 0, -1, 0, 0, 0, 0, -2, -1, -1, 0, -2, 0, -1, -1, 0, 0, -1, 0, -1, 1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, -1, -2, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 1, 1, 0, 0, 0, 0, -2, 0, 0, -3, 0, -1, -3, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -2, -1, 1, 1, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -3, -2, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 1, 0, 0, 0, -3, -2, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0,
+    0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, -1, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, -1, 0, 0, 0, 1, 0, 0, -1, -2, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, -1, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, -2, 0, 0, 1, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -2, -2, -2, 0, -2, 0, 0, 0, -1, 0, 0, -1, 0, -2, -1, 1, 0, -1, 0, -3, -2, 0, 0, 0, 1, 0, 0, -2, -1, -2, 0, 0, -2, 0, 0, 0, 0, 1, -1, 0, 0, 0, -2, 0, -1, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, -1, 0, 0, -1, -1, -1, 0, 0, 0, -1, -2, 0, 0, -1, 0, 0, -1, -2, 0, -1, 0, 0, 1, 0, 0, 0, -2, 0, 0, 0, 0, -1, -3, -2, 1, 0, 0, -2, -2, -2, -1, 0, -1, -2, 0, -1, -1, -1, -2, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, -1, 0, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, -1, -2, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -2, 0, -2, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, -2, 0, 0, -4, -1, -2, -4, 0, 0, 0, -2, 0, 0, 0, 0, -2, 0, 0, 0, -2, -2, 1, 0, 0, 0, 0, -1, 0, 0, 0, 0, -2, 0, 0, -1, -1, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 1, 0, 1, 0, 0, 0, 0, 3, 0, 0, 0, 2, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 1, 0, 0, 1, 2, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 1, 1, 0, 1, 1, 0, 0, 0, 2, 2, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 2, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 2, 0, 0, 3, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 1, 2, 0, 0, 1, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 0, 1, 1, 0, 0, 0, 2, 2, 0, 0, 0, 0, 2, 0,
+    0, 1, 0, 0, 0, -1, -2, 0, 0, 0, 0, -1, -1, 0, 0, -2, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -2, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, -2, -2, 0, -2, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, -2, 0, 0, -2, 0, 0, -1, 0, 0, -2, 0, 0, -2, 0, 1, 0, 0, 0, 0, 0, 0, 0, -4, -2, -2, -4, 0, -1, 0, -2, 0, -1, -1, -1, -3, 0, -1, 0, -2, -2, 0, 1, 0, 0, 0, 0, 0, 0, -1, -1, -2, 0, -1, -2, -2, -2, 0, -2, 1, -2, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, -1, 0, -1, 0, -1,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -3, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 1, 0, 0, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, 0, 0, -2, 0, 0, 0, -3, 0, 0, -1, 0, 0, 0, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, -2, 0, 0, -1, -2, -2, 0, 0, 0, -1, -3, 0, 0, -1, 0, 0, -1, -3, 0, -1, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -2, -3, -2, 0, 0, 0, -2, -2, -3, 0, 0, 0, -2, 0, -1, -1, -2, -2, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0,
+    0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, -2, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, -2, -2, 0, 0, 0, 0, -2, -3, 0, 0, -1, -1, 1, 0, 0, 0, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -2, -2, 0, 0, 0, -1, -2, -3, 0, 0, 0, -2, 1, 0, 0, 0, -2, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 1, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, -2, -2, 0, -1, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, 1, -1, 0, 0, 0, 0, 0, -2, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, -2, 0, 0, -1, 0, -1, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1, -3, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, -2, 1, 0, 0, -1, -2, -4, -1, 0, 0, -3, 0, -1, -1, -2, -2, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, -1, -1, 0, 0, 0, 0, -1, -1, -1, -1, 0, -1, 0, -1, -1, 0, 0, 0, -1, -1, 0, 0, 0, -1, -2, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -1, -1, 0, -1, 0, -1, -1, 1, 1, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -2, -2, 0, 0, 0, 0, -1, -2, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, -1, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, -1, 0, 0, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, -2, 0, 0, 0, 0, -2, -2, 0, 0, -3, 0, 0, 0, -2, -1, 0, -2, 0, 0, 0, 0, 0, -3, 0, 0, -2, 0, -2, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, -1, -1, 0, -2, -1, -1, -1, 0, -2, 0, -1, 0, 0, 0, 0, -1, -1, -1, -2, -1, 0, -2, 0, 0, -2, 0, 0, 0, -2, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, -1, -2, 0, -2, 0, 0, 0, -1, 0, 0, -2, 0, -3, 0, 0, 0, -2, 0, -3, -2, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, -2, -2, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -2, -2, 0, 0, 0, 0, -1, -2, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 1, -1, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 1, 0, 0, 0, -2, -2, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -2, -1, -1, 0, 0, 0, -1, -2, 0, 0, -2, -1, 0, 0, 0, 0, -1, -1, 0, -1, -2, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 1, 0, 1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -2, -2, 0, 0, 0, 0, -1, -2, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 1, 0, -2, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -2, 0, 0, 0, -1, 0, 0, -1, 0, -3, 0, 0, 0, -1, 0, -3, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, -2, -2, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, -2, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, -1, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t bookerly_12_regularGlyphLookup[368] = {
+    0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0001, 0x0002, 0xFFFF, 0xFFFF, 0xFFFF, 0x0003, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0004, 0xFFFF, 0xFFFF,
+    0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, 0x0010, 0x0011, 0x0012, 0x0013, 0x0014,
+    0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, 0x0020, 0x0021, 0x0022, 0x0023, 0x0024,
+    0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, 0x0030, 0x0031, 0x0032, 0x0033, 0x0034,
+    0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, 0x0040, 0x0041, 0x0042, 0x0043, 0x0044,
+    0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051, 0x0052, 0x0053, 0x0054,
+    0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, 0x0060, 0x0061, 0x0062, 0x0063, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x0072, 0x0073,
+    0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, 0x0080, 0x0081, 0x0082, 0x0083,
+    0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F, 0x0090, 0x0091, 0x0092, 0x0093,
+    0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F, 0x00A0, 0x00A1, 0x00A2, 0x00A3,
+    0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF, 0x00B0, 0x00B1, 0x00B2, 0x00B3,
+    0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF, 0x00C0, 0x00C1, 0x00C2, 0x00C3,
+    0x0241, 0x0242, 0x0243, 0x0244, 0x0245, 0x0246, 0x0247, 0x0248, 0x0249, 0x024A, 0x024B, 0x024C, 0x024D, 0x024E, 0x024F, 0x0250,
+    0x0251, 0x0252, 0x0253, 0x0254, 0x0255, 0x0256, 0x0257, 0x0258, 0x0259, 0x025A, 0x025B, 0x025C, 0x025D, 0x025E, 0x025F, 0x0260,
+    0x0261, 0x0262, 0x0263, 0x0264, 0x0265, 0x0266, 0x0267, 0x0268, 0x0269, 0x026A, 0x026B, 0x026C, 0x026D, 0x026E, 0x026F, 0x0270,
+    0x0271, 0xFFFF, 0x0272, 0x0273, 0x0274, 0x0275, 0x0276, 0x0277, 0x0278, 0x0279, 0x027A, 0x027B, 0x027C, 0xFFFF, 0x027D, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x027E, 0x027F, 0xFFFF, 0xFFFF, 0x0280, 0x0281, 0x0282, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x0283, 0xFFFF, 0xFFFF, 0xFFFF, 0x0284, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0285,
+    0x0286, 0x0287, 0x0288, 0x0289, 0x028A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
 };
 
 static const EpdFontData bookerly_12_regular = {
     bookerly_12_regularBitmaps,
     bookerly_12_regularGlyphs,
     bookerly_12_regularIntervals,
-    64,
+    65,
     33,
     27,
     -7,
     true,
     bookerly_12_regularGroups,
-    11,
+    4,
+    bookerly_12_regularKernLeftClasses,
+    bookerly_12_regularKernRightClasses,
+    bookerly_12_regularKernMatrix,
+    105,
+    nullptr,
+    0,
+    0,
+    bookerly_12_regularGlyphLookup,
+    bookerly_12_regularGlyphGroups,
+    false,
+    nullptr,
 };
@@ -3,1854 +3,1892 @@
  * name: bookerly_14_bold
  * size: 14
  * mode: 2-bit  compressed: true
- * Command used: fontconvert.py bookerly_14_bold 14 ../builtinFonts/source/Bookerly/Bookerly-Bold.ttf --2bit --compress
+ * Command used: fontconvert.py bookerly_14_bold 14 ../builtinFonts/source/Bookerly/Bookerly-Bold.ttf --2bit --compress --frequency-corpus ../../../test/hyphenation_eval/resources/english_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/french_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/german_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/italian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/russian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/spanish_hyphenation_tests.txt
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t bookerly_14_boldBitmaps[29460] = {
-    0x95, 0x59, 0xBF, 0x93, 0xDD, 0xD6, 0x75, 0xBE, 0x00, 0xBC, 0x8B, 0x89, 0x50, 0x80, 0x05, 0x69,
-    0xCF, 0x90, 0x93, 0x41, 0xCA, 0x8C, 0x32, 0x11, 0xFE, 0x02, 0xF9, 0x42, 0x5C, 0x4F, 0x54, 0xB0,
-    0xE0, 0x16, 0xBB, 0xF6, 0x38, 0x2E, 0x92, 0x42, 0x69, 0x9C, 0x62, 0x53, 0xA6, 0xF0, 0xF0, 0x42,
-    0xD6, 0x4C, 0x54, 0xB8, 0x10, 0x0B, 0xDB, 0xAD, 0x34, 0x1E, 0x6A, 0x42, 0x3D, 0x16, 0x74, 0xA9,
-    0xC2, 0xCB, 0x0B, 0x72, 0x0B, 0x16, 0x2A, 0x0C, 0x49, 0x33, 0xD1, 0x4C, 0x5C, 0x08, 0xB2, 0x99,
-    0x51, 0x4C, 0x15, 0x84, 0x22, 0x48, 0xC4, 0x2E, 0x2F, 0x70, 0xF2, 0x7D, 0x07, 0x6F, 0x77, 0x49,
-    0x5B, 0xB2, 0xA8, 0x25, 0x81, 0x87, 0x77, 0x01, 0xDC, 0x7B, 0x7E, 0x7E, 0xE7, 0x3B, 0xF7, 0x9D,
-    0xBF, 0x34, 0xCA, 0x6B, 0x83, 0x5C, 0xEE, 0x25, 0xE7, 0x7F, 0x9F, 0xF5, 0x2E, 0xED, 0x6D, 0xD2,
-    0x9F, 0x31, 0xA6, 0xBC, 0x14, 0xFC, 0xDD, 0x70, 0xCE, 0x94, 0x17, 0x3F, 0x1E, 0xC4, 0xE7, 0x9F,
-    0xF4, 0xF3, 0xFA, 0xF4, 0x41, 0x3F, 0x5D, 0xC9, 0xDF, 0x35, 0xDB, 0x66, 0xA3, 0x3A, 0x67, 0xCC,
-    0x94, 0x76, 0x26, 0x6F, 0xF6, 0x4D, 0x14, 0xF2, 0xC6, 0x94, 0x75, 0x30, 0x82, 0xBF, 0x02, 0x47,
-    0xF7, 0xA3, 0xCF, 0xDD, 0x8E, 0xB9, 0x95, 0xF4, 0x26, 0x6F, 0xAF, 0x18, 0x13, 0xB2, 0x36, 0xBE,
-    0x79, 0x7F, 0xBE, 0xE6, 0x71, 0x2B, 0xE3, 0xED, 0xA4, 0x2F, 0x2B, 0xE3, 0x70, 0x3B, 0xEB, 0xAC,
-    0x31, 0xFB, 0x98, 0xE6, 0xF4, 0xAF, 0xC0, 0xF1, 0x1B, 0x63, 0xE2, 0xDE, 0x98, 0xAC, 0x31, 0xB1,
-    0x8C, 0xC6, 0x49, 0x48, 0x1F, 0x3D, 0x0A, 0xF6, 0x67, 0x3F, 0xEB, 0xA7, 0xE7, 0xF2, 0x57, 0x86,
-    0xB7, 0xCF, 0xE6, 0x0F, 0x3B, 0x53, 0x4A, 0x65, 0xAC, 0xB4, 0xF8, 0xC4, 0x34, 0x38, 0x72, 0xE9,
-    0xFE, 0xF9, 0x79, 0x77, 0xB7, 0xE9, 0xBD, 0xDD, 0xBA, 0x13, 0x24, 0xCF, 0x7F, 0x2F, 0xB7, 0x24,
-    0x11, 0xE9, 0x23, 0x99, 0xA1, 0x11, 0x66, 0xFD, 0xC9, 0xC9, 0xAC, 0xFA, 0x75, 0xE7, 0x64, 0xC9,
-    0x8D, 0xCA, 0xC4, 0xAD, 0x49, 0xA5, 0x36, 0xCE, 0xF0, 0xE9, 0xBC, 0x35, 0xF6, 0xC5, 0x21, 0x0A,
-    0x06, 0xF6, 0xA8, 0x6D, 0x65, 0x6E, 0xC5, 0x23, 0x44, 0xCC, 0xBA, 0xB2, 0x09, 0xC6, 0xCC, 0xF1,
-    0x58, 0xD6, 0xFC, 0xF2, 0x0A, 0xE6, 0x82, 0x0E, 0xFB, 0xE9, 0x61, 0x72, 0xE8, 0xF3, 0x03, 0x19,
-    0x0A, 0xB9, 0xD3, 0xFB, 0xBD, 0xA6, 0x6C, 0xAF, 0xE4, 0x0D, 0x96, 0xCC, 0x6F, 0x87, 0xAC, 0x33,
-    0x11, 0x9E, 0x76, 0xC6, 0x58, 0x4C, 0x41, 0x75, 0xCB, 0xFA, 0x16, 0xEC, 0x11, 0xC3, 0x22, 0xC6,
-    0x56, 0x79, 0xCB, 0x25, 0x8C, 0x87, 0x26, 0x13, 0x34, 0x85, 0x08, 0x8D, 0x89, 0xB6, 0xCD, 0x13,
-    0x7F, 0x19, 0x6E, 0x1A, 0x18, 0x16, 0xE7, 0xFC, 0x50, 0x70, 0xE9, 0x2A, 0x08, 0x11, 0x87, 0x84,
-    0x9A, 0xF4, 0x05, 0x75, 0x69, 0x26, 0x0C, 0xFB, 0x4B, 0x2D, 0x9F, 0xFB, 0x6B, 0xBE, 0x12, 0xCC,
-    0xEA, 0x9A, 0x91, 0x00, 0xAB, 0xE4, 0x32, 0x16, 0xD2, 0xB8, 0xD7, 0x86, 0xAC, 0x4B, 0x42, 0x31,
-    0x14, 0x75, 0xDE, 0x97, 0xC3, 0x2D, 0x63, 0x9B, 0xF2, 0x68, 0x30, 0x02, 0xDB, 0x35, 0x31, 0xCF,
-    0x55, 0x22, 0xBF, 0xF0, 0x72, 0x2F, 0xA5, 0xFF, 0xC6, 0x58, 0xE4, 0x97, 0xD2, 0x98, 0x73, 0xDB,
-    0xB0, 0x50, 0xF9, 0x4F, 0xBF, 0xFB, 0xBF, 0xE0, 0xCB, 0x77, 0x3E, 0x0D, 0x57, 0xBE, 0xA5, 0xE2,
-    0xFC, 0x1A, 0xEF, 0x66, 0x43, 0x34, 0xF3, 0xA3, 0x37, 0x33, 0x16, 0x4F, 0x02, 0x34, 0x49, 0x07,
-    0xE3, 0x21, 0x0E, 0xA6, 0xCC, 0xFB, 0xE5, 0xCA, 0x55, 0xC9, 0x88, 0x87, 0xE2, 0x49, 0x47, 0x2A,
-    0x3C, 0x55, 0xE0, 0xB3, 0x8E, 0xA1, 0x31, 0xA6, 0x89, 0x3A, 0x63, 0xEB, 0x78, 0x36, 0x19, 0x9F,
-    0xC1, 0x34, 0x78, 0xC1, 0xD6, 0x78, 0xA6, 0x6C, 0x23, 0xBC, 0xD0, 0x61, 0x24, 0xE7, 0xEC, 0x7A,
-    0x55, 0xB4, 0x78, 0xC9, 0x36, 0x09, 0x97, 0x28, 0x5A, 0x3C, 0xE4, 0xAB, 0xB2, 0x8B, 0x47, 0xF3,
-    0x8C, 0x0A, 0x74, 0x66, 0x3F, 0x7A, 0x6F, 0xC8, 0x3F, 0xAC, 0xCB, 0xE9, 0x5A, 0x2A, 0x1F, 0xF9,
-    0x07, 0x97, 0x1F, 0x7C, 0xEF, 0x39, 0x6B, 0xCE, 0x04, 0x13, 0x55, 0x7A, 0x1F, 0x0F, 0x22, 0x34,
-    0x1F, 0xFB, 0x70, 0x22, 0x1F, 0x88, 0x4C, 0xCF, 0xFA, 0xFB, 0xF5, 0x93, 0xF7, 0xA2, 0x6B, 0x78,
-    0x3C, 0x1D, 0xD2, 0x90, 0xF0, 0xDF, 0x90, 0xF5, 0x79, 0x5B, 0xD6, 0xDF, 0xD5, 0x49, 0x4A, 0x1A,
-    0x86, 0x61, 0x44, 0xCB, 0xBB, 0x8F, 0xC5, 0xB6, 0xDB, 0xB4, 0xBE, 0xA1, 0xF0, 0x10, 0x98, 0xC2,
-    0x42, 0x61, 0x03, 0xD9, 0x28, 0x32, 0xE4, 0x34, 0x09, 0xE7, 0x84, 0x47, 0x84, 0x53, 0x2E, 0xCF,
-    0xCD, 0xEB, 0x57, 0xB0, 0x60, 0x78, 0xE2, 0x95, 0x62, 0x79, 0xE5, 0x31, 0xCF, 0x7B, 0xBC, 0xED,
-    0x64, 0xE0, 0xBA, 0x4D, 0x3A, 0x67, 0x62, 0xA4, 0x2E, 0x07, 0xBC, 0x21, 0x3F, 0x85, 0x81, 0x83,
-    0xED, 0x8C, 0x3F, 0x98, 0x4D, 0xCA, 0x0B, 0x77, 0x30, 0x2D, 0x17, 0x1C, 0xC9, 0x78, 0xA1, 0xCF,
-    0x0C, 0xC5, 0x10, 0xE1, 0xAD, 0xC6, 0x75, 0xF0, 0x69, 0xE0, 0x3C, 0x9C, 0xB0, 0x36, 0xE6, 0xDC,
-    0x7A, 0x85, 0xBF, 0xC7, 0xF7, 0x1E, 0x9E, 0x46, 0x0A, 0xE9, 0x87, 0x29, 0x7B, 0x44, 0xE0, 0xD3,
-    0x7C, 0x6C, 0x0A, 0x56, 0x90, 0x40, 0xD1, 0x74, 0x26, 0x07, 0x01, 0x70, 0x8D, 0xB4, 0xEF, 0x6D,
-    0x6F, 0x07, 0xDB, 0x14, 0xA3, 0x6D, 0x72, 0x44, 0x7D, 0x3E, 0xE8, 0x2B, 0x06, 0x32, 0x41, 0x12,
-    0xBC, 0x5A, 0x99, 0x0C, 0xB6, 0x2A, 0x31, 0xEC, 0x5B, 0x9D, 0x10, 0x81, 0x6A, 0xCA, 0xA3, 0xD5,
-    0x5B, 0x70, 0xC9, 0x64, 0x71, 0x60, 0xCE, 0x51, 0x6D, 0x8C, 0x0F, 0xCF, 0xF8, 0x95, 0xD1, 0xB6,
-    0x65, 0xBF, 0x0F, 0xF3, 0xBD, 0x41, 0x4B, 0x22, 0x5A, 0x8C, 0x6F, 0xCC, 0xDE, 0x68, 0x0A, 0x3C,
-    0x61, 0xA1, 0xD8, 0x9B, 0x7B, 0xC3, 0xB2, 0x00, 0x86, 0x93, 0x59, 0x27, 0x4F, 0xE5, 0xCE, 0x0D,
-    0x09, 0xB9, 0x48, 0x9D, 0xCB, 0x3D, 0xB3, 0x71, 0x62, 0xD4, 0x08, 0x26, 0x36, 0x16, 0xF2, 0xE4,
-    0xC2, 0x15, 0x68, 0x7E, 0xE1, 0x17, 0x28, 0x35, 0xD1, 0x3A, 0x97, 0x01, 0x21, 0x9D, 0xC0, 0x21,
-    0x1A, 0xC1, 0x82, 0x50, 0xCB, 0xFB, 0x64, 0x5E, 0xC9, 0x75, 0x48, 0x26, 0xEF, 0xE3, 0x98, 0x9E,
-    0x59, 0xF9, 0xA3, 0xAB, 0xEA, 0x52, 0xF5, 0xDE, 0xE9, 0xC5, 0x2E, 0xE6, 0x93, 0x01, 0x4B, 0xB6,
-    0x78, 0xD6, 0xC8, 0xEA, 0xFA, 0xB1, 0x57, 0x5D, 0xAB, 0x78, 0x02, 0x45, 0xAA, 0x92, 0x29, 0xBC,
-    0xC7, 0x15, 0x79, 0x6F, 0xD0, 0x7B, 0xF1, 0xF2, 0x15, 0x99, 0xBF, 0x92, 0x19, 0x50, 0xD5, 0xA6,
-    0x50, 0x2B, 0x3A, 0xC1, 0x25, 0x47, 0x65, 0x10, 0xFA, 0x50, 0x03, 0xB1, 0x10, 0xC3, 0x7D, 0x29,
-    0x61, 0x05, 0x46, 0x28, 0x8E, 0xAE, 0x61, 0x58, 0x6A, 0x4B, 0xA3, 0xB7, 0x6E, 0x74, 0x4D, 0x1E,
-    0x5C, 0x93, 0x06, 0xD7, 0x26, 0x93, 0x45, 0x8A, 0xD8, 0x3E, 0x0D, 0xC5, 0x98, 0x8F, 0x10, 0xA9,
-    0xE7, 0xBC, 0xC6, 0xE3, 0x45, 0x98, 0x02, 0x86, 0xFE, 0x15, 0x34, 0xF9, 0x10, 0x87, 0xBF, 0x7F,
-    0x23, 0x4C, 0xA6, 0x7C, 0x1F, 0xF0, 0x98, 0xD6, 0xD4, 0xC2, 0x57, 0x08, 0x24, 0x58, 0x68, 0x2D,
-    0xD6, 0xB0, 0xD8, 0x14, 0x0E, 0x43, 0xDE, 0xD2, 0x7F, 0xC7, 0x97, 0x08, 0x65, 0xD5, 0xFC, 0x58,
-    0xCC, 0x72, 0xA6, 0xF6, 0x6D, 0x26, 0xBE, 0xCF, 0x87, 0x7C, 0x2C, 0x3A, 0x2C, 0xDD, 0xA5, 0x63,
-    0xC1, 0x6F, 0x53, 0xD9, 0x61, 0xF9, 0x1A, 0xF0, 0x05, 0x3B, 0x48, 0x93, 0x1D, 0xFA, 0xA1, 0xE8,
-    0x8A, 0x00, 0xEC, 0xC0, 0x91, 0x4C, 0x0E, 0xE0, 0x61, 0x3B, 0x5C, 0xCF, 0x5E, 0xAD, 0x17, 0xCB,
-    0x22, 0xA6, 0xFE, 0xED, 0x1D, 0x9A, 0x44, 0x9D, 0x28, 0x5D, 0x39, 0xB8, 0xC1, 0x76, 0x08, 0xFC,
-    0x96, 0xEF, 0xA5, 0x54, 0x71, 0xB2, 0x5D, 0x32, 0x95, 0x63, 0x32, 0xE1, 0x7E, 0x48, 0x18, 0xE3,
-    0x7B, 0x8C, 0x1D, 0x0A, 0xE8, 0x00, 0xBA, 0x90, 0x17, 0xC0, 0xB9, 0x29, 0x13, 0xE3, 0x1B, 0xD1,
-    0x52, 0x2D, 0xD9, 0x75, 0x9A, 0xBC, 0xC7, 0xC2, 0xDF, 0x9D, 0xDD, 0x67, 0xD3, 0x86, 0x26, 0x7E,
-    0x1E, 0xF0, 0x6F, 0x7C, 0x12, 0x7F, 0xD3, 0x21, 0x23, 0x18, 0x8C, 0x29, 0xE1, 0xA0, 0xB1, 0xD5,
-    0xF3, 0x27, 0x77, 0xDE, 0x56, 0xFB, 0x78, 0x80, 0xD2, 0x3D, 0xE3, 0x3B, 0x2E, 0x4A, 0xE7, 0x14,
-    0x8F, 0x1F, 0x74, 0x34, 0x52, 0xEE, 0x6F, 0xD6, 0x88, 0xE3, 0xE8, 0x88, 0x05, 0x93, 0x56, 0xAB,
-    0xEB, 0xEB, 0xC1, 0x73, 0xBB, 0xBB, 0xD5, 0x82, 0x87, 0x0C, 0xE3, 0x58, 0x8E, 0x0F, 0x7A, 0x41,
-    0x6D, 0x0E, 0xB7, 0x6F, 0x4A, 0x8D, 0xDA, 0x94, 0xC0, 0x8E, 0x40, 0x29, 0x53, 0x2F, 0x55, 0x92,
-    0x9A, 0x35, 0x50, 0xAE, 0x7C, 0x30, 0x7E, 0x0B, 0x95, 0xCA, 0xA0, 0xAC, 0x00, 0xAB, 0x9C, 0xD9,
-    0x9C, 0x23, 0x3F, 0x21, 0x8E, 0x52, 0x44, 0xD3, 0x68, 0x92, 0x8E, 0xFF, 0xD7, 0x09, 0x30, 0x9A,
-    0x74, 0xA2, 0x94, 0x8C, 0xCE, 0xC7, 0xB4, 0xBC, 0x80, 0xF8, 0xC2, 0x84, 0x10, 0xC6, 0xD0, 0xE2,
-    0x0A, 0x15, 0x87, 0x18, 0xD5, 0x84, 0x02, 0x46, 0x23, 0x22, 0x60, 0x38, 0x00, 0xF9, 0x5E, 0x9B,
-    0x8C, 0x79, 0x57, 0x48, 0x97, 0xF5, 0xDE, 0xC0, 0x79, 0xC5, 0xC1, 0x98, 0xB6, 0xD6, 0xD8, 0xCB,
-    0xED, 0x33, 0xA8, 0x5F, 0x13, 0xD0, 0xEC, 0x3B, 0x43, 0xF2, 0x05, 0x80, 0x5E, 0xDA, 0xFC, 0x1D,
-    0xE4, 0x8E, 0xAF, 0x5C, 0xD9, 0x14, 0xCD, 0x94, 0x8C, 0xDE, 0xF8, 0x64, 0x28, 0x6F, 0x4F, 0xB1,
-    0x78, 0xC1, 0xD7, 0x04, 0x11, 0xC8, 0xEC, 0x1A, 0x2F, 0xDC, 0x53, 0x8F, 0x99, 0x25, 0x87, 0xD7,
-    0xF9, 0x99, 0x61, 0xFD, 0xB9, 0xBA, 0x10, 0x16, 0xD8, 0x6D, 0x29, 0xA0, 0xC2, 0x42, 0xB4, 0x7A,
-    0x73, 0xD1, 0xE3, 0xAA, 0x26, 0x07, 0xD1, 0x27, 0x11, 0xB5, 0x85, 0x02, 0x33, 0x42, 0x80, 0x03,
-    0x03, 0xBD, 0xEA, 0x38, 0x5B, 0x80, 0x7F, 0x4C, 0xDA, 0xB1, 0x72, 0xDA, 0x2D, 0x3C, 0x18, 0x85,
-    0x4C, 0xF1, 0x99, 0xA1, 0x6D, 0x7F, 0xE1, 0x08, 0x66, 0xC4, 0x30, 0x04, 0x10, 0x0B, 0xFF, 0xEE,
-    0x0F, 0x98, 0xFB, 0x44, 0xA8, 0xA2, 0x45, 0x8E, 0x45, 0x72, 0x15, 0x56, 0x28, 0xA5, 0x2D, 0x24,
-    0x20, 0x73, 0x1D, 0xA2, 0x68, 0x77, 0x87, 0x39, 0xC7, 0x40, 0x95, 0x6A, 0xEF, 0x73, 0x8F, 0x14,
-    0x4B, 0x26, 0x80, 0xAC, 0xAF, 0x1D, 0x4A, 0x7E, 0xD1, 0x67, 0x1C, 0x08, 0x11, 0x43, 0x11, 0xBE,
-    0xAD, 0x61, 0xCF, 0x11, 0x03, 0xF2, 0x02, 0x20, 0xB6, 0x73, 0x08, 0xF8, 0xA2, 0x8F, 0x67, 0x24,
-    0x98, 0xBC, 0x0C, 0x84, 0xB8, 0x0D, 0x26, 0xF4, 0x07, 0x2A, 0x27, 0x5A, 0xD8, 0xF5, 0xEF, 0xC7,
-    0x57, 0x15, 0x47, 0x73, 0x5D, 0xE2, 0xC6, 0x04, 0x41, 0xEC, 0x8B, 0xA8, 0x85, 0xEF, 0x0B, 0x48,
-    0x0B, 0x1E, 0x3A, 0x43, 0x85, 0x09, 0xA7, 0x54, 0x42, 0xF5, 0x26, 0xFE, 0x12, 0x4C, 0x33, 0xA8,
-    0x1F, 0xD1, 0x4E, 0x16, 0x0E, 0x4C, 0xE5, 0xF0, 0x1F, 0x7B, 0xCC, 0x4E, 0xF0, 0x44, 0x7A, 0xD3,
-    0xA7, 0x28, 0xE4, 0x66, 0x77, 0xD7, 0x50, 0xF8, 0x59, 0xB5, 0x1D, 0x91, 0x5B, 0x37, 0x51, 0x58,
-    0x26, 0xD4, 0x99, 0x48, 0xAA, 0x14, 0xEA, 0x01, 0x21, 0x3A, 0x80, 0x52, 0x1E, 0x30, 0x98, 0x08,
-    0x06, 0x01, 0xD1, 0x18, 0x2C, 0x51, 0x47, 0xB0, 0x60, 0xCA, 0x30, 0xE4, 0x20, 0x0A, 0x0A, 0x78,
-    0x0B, 0x9F, 0x2C, 0x7B, 0x0C, 0x16, 0x7C, 0x7D, 0x6F, 0x8C, 0xB0, 0xDE, 0xC8, 0xC8, 0x19, 0x8C,
-    0xDA, 0xF2, 0xF4, 0xCF, 0xAE, 0xC1, 0x66, 0xD8, 0x83, 0x34, 0x78, 0xA1, 0x7C, 0x01, 0xCB, 0x71,
-    0x62, 0x4E, 0xC1, 0x68, 0x84, 0xE0, 0xAB, 0xEB, 0xB4, 0x57, 0x55, 0x68, 0xA9, 0xDB, 0xDD, 0xE6,
-    0x32, 0xC4, 0x46, 0x62, 0xE4, 0xF3, 0x5C, 0xE3, 0x65, 0xA9, 0xF2, 0x8F, 0xB0, 0xC2, 0x43, 0x42,
-    0xF0, 0x12, 0x9E, 0x4A, 0x88, 0xE8, 0x17, 0x09, 0x88, 0x0D, 0x8A, 0xC7, 0xE3, 0x37, 0x38, 0xFE,
-    0x9D, 0x73, 0xAE, 0x0F, 0x28, 0x26, 0xFD, 0xFA, 0x68, 0x1F, 0x1B, 0x3F, 0x39, 0x2E, 0xC0, 0xC7,
-    0xB8, 0xAD, 0x07, 0xEC, 0xFF, 0x26, 0xC9, 0x16, 0x92, 0x0F, 0x6B, 0xA1, 0x24, 0x1E, 0xDD, 0xEC,
-    0x33, 0xF2, 0x92, 0x02, 0x59, 0xD3, 0xC3, 0xEE, 0x49, 0x8B, 0x3C, 0x88, 0x96, 0xB0, 0xF3, 0x27,
-    0x27, 0xF0, 0xA7, 0xD5, 0x75, 0x69, 0x12, 0x09, 0x1E, 0xE8, 0x15, 0x00, 0x04, 0xF9, 0x88, 0xC8,
-    0xCA, 0x47, 0x1B, 0x70, 0x02, 0xEE, 0xE4, 0x63, 0xB6, 0xE6, 0x54, 0x4B, 0x39, 0x87, 0x72, 0xBB,
-    0x6B, 0x8F, 0xC3, 0x62, 0x8D, 0xD2, 0x0A, 0x5C, 0xFC, 0x87, 0xD4, 0x91, 0x74, 0x10, 0x0A, 0xEA,
-    0x43, 0x71, 0x5C, 0xC0, 0x04, 0xAC, 0xE1, 0xA0, 0xC9, 0xED, 0x7A, 0xF8, 0x68, 0x75, 0x73, 0xA2,
-    0xA9, 0x04, 0xC3, 0x8C, 0x1D, 0x58, 0xEB, 0xFB, 0x5F, 0xFD, 0x34, 0x87, 0x23, 0xF0, 0x08, 0x37,
-    0x5B, 0xAD, 0x86, 0xAC, 0x14, 0xA2, 0xA1, 0x23, 0xBF, 0x15, 0x21, 0xA4, 0x4C, 0x34, 0xB1, 0x6B,
-    0x19, 0x01, 0x5F, 0x7D, 0x19, 0xF9, 0x43, 0x4B, 0x4B, 0xF7, 0x8B, 0x3B, 0x03, 0x43, 0x94, 0x76,
-    0x43, 0xDA, 0x22, 0xF6, 0xBF, 0xD9, 0xC7, 0x9A, 0x43, 0x10, 0x56, 0x60, 0xBC, 0x92, 0x55, 0x1C,
-    0xE2, 0x34, 0x4C, 0xB8, 0xE3, 0x70, 0x19, 0x2D, 0xE2, 0x05, 0x98, 0xDE, 0xA3, 0xAE, 0x23, 0x1E,
-    0xC0, 0xF5, 0x1A, 0x4D, 0x31, 0xD8, 0x1D, 0xA7, 0xA2, 0xC7, 0x29, 0x0D, 0x38, 0x45, 0x6A, 0x49,
-    0x07, 0x6F, 0x61, 0x12, 0x75, 0xA7, 0xB0, 0xD4, 0x12, 0x72, 0xDD, 0x6D, 0x4E, 0xD9, 0x97, 0x20,
-    0x9A, 0x48, 0x3F, 0xBE, 0x6E, 0x61, 0x88, 0x7B, 0x09, 0x6B, 0x78, 0xE3, 0x66, 0x76, 0x1F, 0x9A,
-    0x73, 0xE7, 0xD6, 0x4B, 0xC2, 0x51, 0x2C, 0x3B, 0x20, 0x15, 0xEB, 0x80, 0x3C, 0x8D, 0xBF, 0xBF,
-    0x3C, 0xF0, 0x6B, 0x0C, 0x7C, 0x97, 0x41, 0xFD, 0xE5, 0x11, 0xAA, 0x98, 0xCA, 0x68, 0x02, 0x78,
-    0x20, 0x40, 0x98, 0x8C, 0x58, 0xA9, 0x26, 0x5F, 0xF2, 0xCC, 0xA7, 0x91, 0x58, 0x95, 0x3D, 0xE8,
-    0xF3, 0x07, 0xE0, 0xC2, 0xAE, 0xBD, 0x02, 0xAD, 0x26, 0xF7, 0xD3, 0x4F, 0x01, 0xCF, 0xE8, 0xC6,
-    0xEE, 0x42, 0xAA, 0x83, 0x70, 0x05, 0x46, 0xB3, 0xD9, 0x17, 0xE0, 0x54, 0xE8, 0xB0, 0x1E, 0x34,
-    0xC2, 0x7E, 0x64, 0x26, 0x4B, 0x6E, 0x50, 0x2F, 0x49, 0x87, 0x51, 0x01, 0x80, 0xC9, 0x30, 0x28,
-    0x24, 0xE8, 0xD2, 0x01, 0x17, 0xAE, 0xCD, 0x9B, 0x62, 0x86, 0x01, 0xCF, 0xC0, 0xD1, 0x4E, 0xE1,
-    0x2D, 0x1C, 0x1B, 0x97, 0x6C, 0x02, 0x45, 0x23, 0x23, 0x38, 0x74, 0x11, 0x03, 0x76, 0x20, 0x0B,
-    0x27, 0xC5, 0xA8, 0x59, 0x7A, 0x79, 0x96, 0x0A, 0xE7, 0x09, 0xF3, 0x82, 0xA9, 0x4B, 0xC7, 0x33,
-    0x28, 0x1D, 0xCE, 0x28, 0xDA, 0x38, 0x67, 0xC2, 0x73, 0x22, 0x0E, 0x67, 0xB8, 0x80, 0x6C, 0xDE,
-    0xEB, 0xD9, 0xEA, 0x19, 0xEA, 0xA5, 0x73, 0x95, 0x91, 0x97, 0xC0, 0xC8, 0x35, 0xBB, 0xB3, 0x05,
-    0x0E, 0x76, 0x16, 0x7C, 0x23, 0xC0, 0xD5, 0x46, 0x91, 0x09, 0x10, 0x07, 0xCE, 0x00, 0x8C, 0x5B,
-    0x10, 0xE7, 0x15, 0x16, 0x1D, 0xC2, 0x1C, 0x78, 0x0C, 0x4B, 0xDF, 0x1E, 0x09, 0xC9, 0xEF, 0x58,
-    0x02, 0x1E, 0x8A, 0x7A, 0x97, 0xFC, 0x91, 0x5C, 0xCF, 0xDF, 0x9D, 0x59, 0x25, 0xA8, 0xD8, 0x60,
-    0x47, 0x02, 0x96, 0xD4, 0x19, 0xA5, 0x80, 0x4D, 0x75, 0x62, 0x98, 0x99, 0xC5, 0x42, 0x93, 0x0C,
-    0xA8, 0x07, 0x04, 0x22, 0x0B, 0x92, 0x66, 0xEF, 0x08, 0xC1, 0x1B, 0x88, 0x6D, 0xB0, 0x11, 0xF8,
-    0xD2, 0x50, 0xF4, 0xC9, 0x94, 0x42, 0x8B, 0x85, 0x27, 0xFF, 0x97, 0x32, 0xD8, 0x96, 0x02, 0x46,
-    0xF2, 0xD6, 0x52, 0x5E, 0x58, 0x9A, 0x48, 0x89, 0x18, 0xBE, 0x91, 0xFF, 0xA3, 0x26, 0xEC, 0x1A,
-    0x2C, 0x54, 0x9B, 0x88, 0x68, 0x41, 0xB8, 0x00, 0x26, 0xCE, 0x37, 0xA5, 0x52, 0x75, 0x14, 0x26,
-    0x3B, 0xD4, 0xB1, 0x54, 0xC8, 0x98, 0x6C, 0xAF, 0xFA, 0x5C, 0xA2, 0x2A, 0x83, 0xA7, 0x16, 0x97,
-    0x95, 0xFF, 0xA9, 0x42, 0x97, 0x28, 0x6E, 0x0F, 0xD0, 0x48, 0x84, 0x88, 0x6E, 0x5B, 0xD5, 0x28,
-    0x22, 0x67, 0xA3, 0x32, 0xDA, 0xDC, 0xB2, 0xA0, 0x95, 0x5A, 0xD5, 0x18, 0x7F, 0x10, 0xEC, 0x9E,
-    0xC2, 0xDF, 0xE1, 0x36, 0x49, 0x2C, 0xD7, 0x4F, 0xA9, 0x34, 0x58, 0xF9, 0xC2, 0xC6, 0x8F, 0x91,
-    0x7E, 0x54, 0xA4, 0x07, 0x57, 0x3E, 0xF2, 0x4B, 0x22, 0x54, 0x4C, 0x04, 0xF0, 0x14, 0x50, 0x73,
-    0x43, 0xD5, 0x0D, 0x75, 0x87, 0x0A, 0xA4, 0x95, 0xEE, 0x01, 0x4E, 0x05, 0x53, 0x2A, 0xE5, 0x29,
-    0x12, 0xD6, 0x19, 0x77, 0xA0, 0x59, 0x4B, 0x4D, 0x02, 0x90, 0x90, 0x69, 0xD8, 0x23, 0x8F, 0x72,
-    0xD9, 0x82, 0x8D, 0x64, 0xC4, 0xDA, 0x64, 0xF3, 0x9A, 0x47, 0xE7, 0xDF, 0x52, 0xCF, 0xC2, 0x12,
-    0xA9, 0xFC, 0x08, 0x8C, 0x2E, 0x85, 0x27, 0x73, 0x34, 0x26, 0xCF, 0xE7, 0xB4, 0xC0, 0x0C, 0x54,
-    0x22, 0x05, 0x85, 0xE1, 0xD8, 0xD3, 0x14, 0x42, 0xDB, 0xBC, 0x07, 0x33, 0xBF, 0x5E, 0x27, 0xB3,
-    0x33, 0xF9, 0xE7, 0x88, 0xDA, 0xBB, 0x72, 0x63, 0x2E, 0xC8, 0xF4, 0xA0, 0x4C, 0xB4, 0xFB, 0x58,
-    0xF5, 0x90, 0xC7, 0x4E, 0x95, 0xD4, 0xB7, 0xAC, 0x59, 0x9F, 0xF6, 0xFF, 0x0A, 0xA7, 0x97, 0xCC,
-    0x12, 0x60, 0xDF, 0xE4, 0xB4, 0x49, 0xBA, 0x63, 0x69, 0x34, 0x3D, 0x29, 0xA3, 0x80, 0xA9, 0x1D,
-    0xD3, 0x17, 0x16, 0xFD, 0x07, 0x69, 0x23, 0xD7, 0xD1, 0x1D, 0x6C, 0xB5, 0x48, 0x09, 0x60, 0x01,
-    0xB6, 0x5E, 0x0D, 0x7B, 0xD0, 0x6F, 0x30, 0xEC, 0xD0, 0x5A, 0x57, 0xA0, 0x4F, 0x28, 0xAF, 0xA8,
-    0xD2, 0xF9, 0x31, 0xD7, 0x08, 0x5A, 0x65, 0x28, 0xCC, 0x0F, 0x8F, 0x2B, 0xFF, 0xB2, 0xFC, 0x5D,
-    0x41, 0x28, 0xC2, 0x80, 0xAD, 0x61, 0xD3, 0x46, 0x7B, 0xC3, 0x7A, 0xD9, 0x40, 0x9C, 0x04, 0xE5,
-    0xB6, 0x3D, 0xFB, 0x47, 0x0F, 0xD6, 0x84, 0x3B, 0x35, 0x06, 0x10, 0xC9, 0x90, 0x3E, 0x9B, 0x48,
-    0xDD, 0x51, 0x6E, 0x30, 0x61, 0xF9, 0x29, 0x33, 0xDD, 0xFD, 0x56, 0x5B, 0x13, 0xB0, 0x79, 0x13,
-    0xAF, 0x29, 0x51, 0xA7, 0xDB, 0x08, 0x0A, 0x48, 0xDA, 0x5E, 0xD9, 0xD6, 0xFC, 0xC9, 0x9F, 0x95,
-    0x21, 0x1D, 0x00, 0x01, 0xE0, 0x93, 0x19, 0x6A, 0xD5, 0x54, 0x80, 0x77, 0x83, 0xC6, 0x30, 0x0E,
-    0x73, 0xC2, 0x0D, 0xC2, 0x87, 0x84, 0x13, 0x60, 0x5A, 0x03, 0xC5, 0xB0, 0x18, 0xA9, 0x27, 0xDB,
-    0x57, 0x7E, 0x56, 0x9E, 0x82, 0xA1, 0xBB, 0x64, 0x66, 0x76, 0xFB, 0xBE, 0xD1, 0xB0, 0x0F, 0xF6,
-    0x76, 0x50, 0x99, 0xEC, 0xEF, 0xB1, 0x68, 0xFE, 0xC5, 0x58, 0x7E, 0x86, 0xF8, 0xCD, 0x1F, 0xF5,
-    0xF9, 0x43, 0x92, 0x18, 0x6E, 0x4D, 0x74, 0x2A, 0x5C, 0x46, 0xEA, 0x92, 0x48, 0xCB, 0x4A, 0x40,
-    0xD2, 0x9B, 0xAC, 0x3D, 0x15, 0x2F, 0x1B, 0x1F, 0x95, 0x91, 0x3F, 0x11, 0x16, 0x4E, 0x3A, 0x60,
-    0xBF, 0x88, 0x5A, 0xD1, 0xB8, 0x40, 0x24, 0x06, 0x99, 0x64, 0xAB, 0x14, 0x33, 0x9D, 0x46, 0x87,
-    0xD7, 0xFD, 0x87, 0x3D, 0xE7, 0xA4, 0xFA, 0xB9, 0xBE, 0xEE, 0x7B, 0xBD, 0x54, 0xA3, 0xD0, 0xE9,
-    0x8E, 0x03, 0xF9, 0x47, 0x58, 0x2A, 0x61, 0x70, 0x63, 0x19, 0x0B, 0x4B, 0x77, 0xE8, 0x1B, 0xB2,
-    0x19, 0x54, 0xE4, 0x55, 0x01, 0x84, 0x82, 0xAB, 0xB6, 0xEB, 0x6C, 0x47, 0xD0, 0xA2, 0xE1, 0xFD,
-    0x44, 0xD0, 0x8A, 0x0F, 0xC0, 0x6F, 0xCB, 0xF8, 0x80, 0xE1, 0xE1, 0x28, 0x78, 0x3B, 0xB0, 0xD7,
-    0x97, 0x97, 0xA9, 0x6D, 0x4F, 0x0A, 0x8D, 0x98, 0x5E, 0x7A, 0x4B, 0x85, 0xFB, 0x85, 0xA7, 0x29,
-    0xB1, 0xD5, 0xD6, 0x6F, 0xCD, 0x59, 0x4F, 0x07, 0xCB, 0x59, 0x2B, 0x99, 0xD2, 0xDD, 0x79, 0xDD,
-    0x75, 0x20, 0x58, 0x6E, 0xB3, 0xD0, 0x7B, 0x36, 0xC5, 0x75, 0x36, 0x67, 0x00, 0xA6, 0x88, 0xDE,
-    0xD0, 0x2E, 0x9A, 0xDD, 0x8D, 0x4E, 0x40, 0xCB, 0xF9, 0x6E, 0x99, 0xC7, 0x12, 0x27, 0x46, 0xF3,
-    0x12, 0x4A, 0xA0, 0xC5, 0x3A, 0xC5, 0x3B, 0xE0, 0x7A, 0x9F, 0x91, 0x7A, 0xB0, 0x28, 0x15, 0xC7,
-    0x45, 0xC9, 0x4E, 0x76, 0xC6, 0x51, 0x7D, 0x83, 0x7F, 0x78, 0xE3, 0xD9, 0xEB, 0x6C, 0xFA, 0xE0,
-    0x6E, 0xFA, 0x82, 0x9B, 0x17, 0xD4, 0x98, 0x7B, 0x19, 0xEC, 0x71, 0x9F, 0xF2, 0xD6, 0x74, 0x7A,
-    0x2B, 0x5F, 0xDF, 0x3A, 0x67, 0xDC, 0x11, 0xB2, 0xAE, 0xF1, 0x28, 0x2C, 0x7D, 0xF9, 0x35, 0x1F,
-    0xB3, 0x3C, 0x92, 0xFF, 0x5E, 0x99, 0xCD, 0xAB, 0x4B, 0xCF, 0x4D, 0x30, 0xB4, 0x61, 0x39, 0xF6,
-    0xB9, 0xC5, 0x68, 0xD1, 0xDF, 0xD8, 0x2A, 0x19, 0x8A, 0x26, 0xED, 0xF3, 0x36, 0xEB, 0xB2, 0x2E,
-    0x6F, 0x41, 0xDC, 0x9A, 0x64, 0x2C, 0xEB, 0x78, 0x5C, 0xAD, 0x56, 0xFF, 0x09, 0x1B, 0x3C, 0x38,
-    0xE1, 0xA7, 0xFF, 0x96, 0xF4, 0x45, 0x57, 0x76, 0x45, 0x93, 0xE3, 0xCB, 0xB7, 0xB7, 0x35, 0x2C,
-    0x0A, 0x6E, 0x87, 0xFC, 0x0F, 0xB2, 0xAB, 0xF6, 0x4D, 0x59, 0xB1, 0x02, 0xE0, 0x38, 0x0F, 0x1A,
-    0x82, 0xD4, 0xE5, 0x76, 0x07, 0xEB, 0x06, 0xD9, 0x3E, 0x90, 0xAE, 0xF1, 0x9F, 0xC8, 0xFF, 0x72,
-    0xDB, 0xA2, 0x98, 0xC1, 0x91, 0xB6, 0xA3, 0xCA, 0x6C, 0xB0, 0x46, 0xF4, 0x5A, 0x66, 0x4D, 0xCC,
-    0x0B, 0x56, 0x0D, 0x2D, 0x21, 0xEB, 0x8B, 0x1F, 0xE2, 0xC2, 0xCD, 0x5C, 0x64, 0x24, 0x7F, 0x6B,
-    0xD0, 0x9F, 0x4F, 0x8A, 0xC9, 0x40, 0x63, 0x16, 0x21, 0xDB, 0x1F, 0x5F, 0x70, 0x64, 0xE6, 0x05,
-    0xBB, 0x8A, 0x10, 0xA3, 0x52, 0x72, 0xF7, 0xA0, 0x5D, 0xCA, 0x0D, 0xD9, 0xFC, 0xC6, 0x55, 0xEE,
-    0x76, 0x42, 0xAC, 0x97, 0xE5, 0x75, 0x34, 0xC5, 0xF6, 0x6E, 0x48, 0x06, 0x5F, 0x9F, 0xE5, 0xCE,
-    0x00, 0xD4, 0xD3, 0x8F, 0x46, 0xDB, 0x02, 0x37, 0x9A, 0x57, 0x44, 0xE9, 0x1F, 0x14, 0xE8, 0xF4,
-    0x5D, 0x6D, 0xFD, 0xB8, 0xA9, 0xC8, 0xEA, 0x0F, 0x0A, 0x5C, 0x2D, 0xBD, 0xBE, 0x39, 0xBE, 0xF8,
-    0x17, 0x56, 0x0A, 0xDC, 0xF2, 0xE4, 0xE4, 0x87, 0x7B, 0x83, 0x92, 0x0B, 0xD6, 0x4B, 0x54, 0x59,
-    0x01, 0x02, 0xB3, 0xC7, 0x3F, 0xBE, 0xD0, 0x11, 0xDE, 0x02, 0x70, 0x56, 0xC0, 0xE8, 0x43, 0xA4,
-    0xA6, 0x07, 0x49, 0x38, 0x90, 0x66, 0xA3, 0x3A, 0x0B, 0xA8, 0xDD, 0x26, 0x05, 0xCA, 0x28, 0x27,
-    0xCA, 0x42, 0x63, 0x3F, 0x1E, 0xE3, 0xD9, 0xD7, 0x25, 0xBC, 0x30, 0xD3, 0x19, 0x87, 0xBB, 0x3B,
-    0xDC, 0x13, 0x0A, 0xDA, 0xB2, 0x6F, 0x2D, 0x61, 0xDA, 0xB0, 0xD6, 0xE9, 0x16, 0xC0, 0x8F, 0x71,
-    0x8B, 0x04, 0x05, 0x99, 0xE1, 0x3F, 0xC0, 0x4A, 0x86, 0x3B, 0x5A, 0x67, 0xE2, 0xA5, 0x27, 0xD5,
-    0x1D, 0x2D, 0x88, 0x68, 0xFE, 0x15, 0xC5, 0x9A, 0x84, 0xF2, 0x6B, 0x0F, 0xAC, 0x54, 0xEA, 0xA6,
-    0x11, 0xAC, 0xB3, 0xF1, 0xF3, 0x6F, 0x83, 0xA5, 0x48, 0xD0, 0x06, 0xD0, 0xBD, 0x2B, 0x7F, 0x9B,
-    0xF7, 0x19, 0xB7, 0x43, 0x5D, 0x9D, 0xF7, 0xA9, 0x6A, 0x87, 0xDE, 0x01, 0x3E, 0x2C, 0x25, 0x2C,
-    0x78, 0xC1, 0x8C, 0x66, 0xD4, 0xA2, 0xFA, 0xDF, 0xE7, 0x9B, 0x33, 0x79, 0x78, 0x5F, 0xDC, 0xBF,
-    0x21, 0x5B, 0x60, 0x3D, 0x83, 0x03, 0x30, 0xA6, 0xF3, 0x0B, 0xBE, 0xD3, 0xC2, 0x4B, 0x16, 0x12,
-    0xDD, 0xE4, 0x66, 0xE2, 0x59, 0x22, 0x0F, 0x51, 0x6F, 0xE9, 0x62, 0xAB, 0x85, 0x3F, 0x2E, 0x85,
-    0x9C, 0xE1, 0x05, 0xF2, 0xF1, 0x12, 0xF9, 0x2C, 0x5B, 0xE6, 0xA5, 0x6D, 0x84, 0x8E, 0xAD, 0x63,
-    0x1F, 0x80, 0x06, 0x72, 0x4D, 0xE7, 0xD8, 0x63, 0xD9, 0xAF, 0x1A, 0x02, 0x40, 0xE5, 0xF2, 0xB1,
-    0x8C, 0xDC, 0xDB, 0xDB, 0x46, 0xE4, 0xA0, 0x70, 0xB8, 0x3E, 0x3E, 0x2E, 0x6B, 0x55, 0x39, 0xA7,
-    0xD2, 0x5D, 0x98, 0x09, 0x58, 0x5F, 0x72, 0x4A, 0x51, 0xCA, 0x01, 0xF9, 0x1D, 0x62, 0x97, 0xBB,
-    0xAA, 0xAC, 0xE7, 0x76, 0xCD, 0x22, 0x76, 0x52, 0xA4, 0x25, 0xEC, 0x43, 0x0A, 0xEE, 0xFE, 0xE2,
-    0xC9, 0x43, 0xAA, 0x14, 0x65, 0xAB, 0x71, 0x43, 0x7C, 0x6F, 0xAD, 0xB2, 0x6E, 0xB2, 0x35, 0x54,
-    0xD9, 0x2C, 0x0C, 0x6A, 0xE9, 0xF2, 0x17, 0x95, 0x75, 0xA8, 0x44, 0xFC, 0xF7, 0xC0, 0x48, 0xD7,
-    0xB0, 0xD5, 0x48, 0x48, 0x51, 0xB0, 0x74, 0xF1, 0x90, 0xB1, 0x20, 0x2C, 0x71, 0x40, 0xF5, 0x94,
-    0x0D, 0x7C, 0x41, 0xAA, 0x07, 0x4A, 0x5F, 0x2B, 0x53, 0x49, 0x27, 0x54, 0x07, 0x16, 0xC9, 0x57,
-    0x41, 0xE6, 0x66, 0x55, 0xD1, 0x9C, 0x8D, 0xA5, 0xF5, 0xD3, 0x26, 0x0A, 0x08, 0xC4, 0x7F, 0x9A,
-    0x53, 0x0A, 0xA3, 0x4C, 0xC0, 0x76, 0xB3, 0x83, 0x3C, 0x7A, 0x09, 0x41, 0x56, 0xC8, 0x45, 0xCD,
-    0x26, 0x60, 0xD1, 0x64, 0x6E, 0xEA, 0x56, 0x2F, 0x2B, 0x9E, 0xB2, 0x38, 0x14, 0x3C, 0xF4, 0xF5,
-    0x86, 0xBB, 0x54, 0xAC, 0xC8, 0x28, 0x8E, 0x90, 0x19, 0xD6, 0xF3, 0x90, 0xFF, 0x29, 0x6E, 0xCE,
-    0x31, 0x29, 0x37, 0xAA, 0x1D, 0xFD, 0x74, 0x00, 0x1F, 0x73, 0xCD, 0x32, 0xA0, 0x86, 0xB0, 0x13,
-    0xA9, 0xFE, 0x8E, 0x78, 0xC4, 0xA5, 0x96, 0xB7, 0xE8, 0xDD, 0xAF, 0x3F, 0xF9, 0xB6, 0xE4, 0x54,
-    0x56, 0xE7, 0xDB, 0xF8, 0x39, 0xE9, 0x43, 0x0D, 0xE9, 0xBB, 0xE2, 0xD0, 0xEB, 0x2E, 0x19, 0x37,
-    0x1B, 0x7C, 0x43, 0xCE, 0x8C, 0xA3, 0x4E, 0x96, 0xCF, 0x86, 0xD6, 0xCC, 0x82, 0xEB, 0x41, 0x9B,
-    0x67, 0xDF, 0x13, 0x11, 0x34, 0xB2, 0xCF, 0x21, 0x28, 0x77, 0x36, 0xAB, 0x44, 0x5E, 0x83, 0xC3,
-    0x85, 0x8D, 0x21, 0x82, 0x90, 0x62, 0xD7, 0xDC, 0x53, 0xD4, 0x06, 0x8C, 0xF3, 0x3D, 0x71, 0xC1,
-    0x5B, 0x43, 0x1A, 0xA8, 0xED, 0x91, 0x52, 0x66, 0x6E, 0xAA, 0x83, 0x50, 0x4E, 0x3B, 0x8B, 0x8F,
-    0xD5, 0xE3, 0x4A, 0xA0, 0xB9, 0x65, 0xC9, 0xA2, 0xF6, 0xEC, 0x8A, 0x7B, 0x36, 0x9B, 0xBC, 0x8F,
-    0x07, 0x09, 0x2D, 0xEE, 0x0B, 0xDF, 0x42, 0x58, 0x65, 0xE1, 0x44, 0x96, 0x2D, 0xEE, 0x33, 0x11,
-    0x54, 0xB8, 0xAF, 0x47, 0x60, 0xB9, 0x48, 0xFC, 0x73, 0xBD, 0xE3, 0x7E, 0xCB, 0x44, 0xC0, 0xAC,
-    0x8A, 0x19, 0xC4, 0xE5, 0x0C, 0x31, 0x8A, 0xC4, 0x5A, 0x01, 0x8B, 0x4C, 0xC6, 0x91, 0x17, 0x21,
-    0x48, 0xCE, 0xAF, 0xDE, 0x80, 0x26, 0x17, 0xE5, 0xD5, 0xE0, 0x82, 0xDC, 0xF1, 0xDC, 0x15, 0xBC,
-    0x5F, 0xDB, 0xA5, 0xDD, 0x04, 0xF1, 0xFD, 0xF3, 0x0F, 0x47, 0x70, 0x19, 0x12, 0x32, 0xDE, 0xF3,
-    0xDB, 0x86, 0xA4, 0x16, 0x6E, 0x8A, 0x10, 0x87, 0x65, 0x3E, 0x6C, 0x6E, 0x69, 0xEB, 0x56, 0x67,
-    0xC2, 0x96, 0xBB, 0x31, 0xFE, 0x73, 0xC8, 0x79, 0xCB, 0xF8, 0xBD, 0x0E, 0x54, 0x15, 0xF1, 0x06,
-    0xC5, 0xC8, 0x52, 0x9D, 0x16, 0xB2, 0x82, 0x14, 0x99, 0xBB, 0x54, 0x97, 0x45, 0xDE, 0xF3, 0x47,
-    0x6F, 0x64, 0x41, 0x5B, 0x5D, 0xF6, 0xB8, 0xBD, 0x79, 0xF2, 0xCB, 0x14, 0x71, 0x1F, 0xD4, 0x32,
-    0xDC, 0x3A, 0xB5, 0x3D, 0x09, 0x00, 0x10, 0xB3, 0xF2, 0xA1, 0x90, 0x6A, 0x2F, 0x6C, 0x02, 0x79,
-    0x88, 0xAA, 0x4F, 0x73, 0x82, 0x93, 0x2A, 0xEE, 0xBA, 0x5C, 0x25, 0x8C, 0xC1, 0x2D, 0x01, 0x68,
-    0xAF, 0xB0, 0xBB, 0x50, 0xCA, 0x2D, 0xF9, 0x03, 0x91, 0x7F, 0x0B, 0x46, 0xED, 0x99, 0xEE, 0x60,
-    0x74, 0x11, 0x80, 0x86, 0x3F, 0x23, 0xD8, 0xCE, 0x56, 0xC6, 0xDF, 0x81, 0x9B, 0x24, 0x47, 0x77,
-    0x42, 0xC2, 0x92, 0xCC, 0xE3, 0x3A, 0x69, 0x75, 0x37, 0x4D, 0x99, 0x89, 0xAB, 0x9F, 0xD8, 0x0A,
-    0x45, 0xDB, 0xD8, 0x5A, 0x50, 0xF1, 0x7A, 0x06, 0x5B, 0x03, 0xEC, 0xF7, 0xA9, 0x06, 0x01, 0xE8,
-    0x1F, 0x1B, 0x97, 0xBC, 0x8B, 0x31, 0xDE, 0xF0, 0x67, 0x9E, 0x2B, 0xA1, 0x40, 0x9F, 0x94, 0xBF,
-    0xFE, 0x1E, 0xFA, 0xDB, 0x61, 0x98, 0x2D, 0xA6, 0x7B, 0x3D, 0xFB, 0x8C, 0x46, 0xEF, 0xDD, 0x3E,
-    0x17, 0x48, 0x16, 0x02, 0x63, 0xB9, 0x64, 0x50, 0x44, 0x70, 0xBA, 0x05, 0x7D, 0xFA, 0x97, 0x00,
-    0xD2, 0x40, 0xF1, 0x2E, 0x22, 0x0C, 0xBB, 0x12, 0x08, 0xB1, 0x05, 0x7E, 0x17, 0xB4, 0xB9, 0xAB,
-    0x17, 0x7C, 0x59, 0x42, 0x80, 0x24, 0x80, 0xA5, 0xEE, 0x53, 0x01, 0xC1, 0xC8, 0x19, 0x9A, 0x16,
-    0x1D, 0x72, 0x0E, 0xA6, 0xF6, 0xD1, 0xC2, 0xA5, 0x60, 0x87, 0x17, 0x81, 0x8F, 0xC7, 0x76, 0x48,
-    0xBF, 0xC4, 0x0E, 0xEE, 0x49, 0x3B, 0xB0, 0x3E, 0x64, 0x7F, 0x6E, 0x07, 0x92, 0x6D, 0x25, 0x1E,
-    0x14, 0xF7, 0x3C, 0x41, 0x9D, 0x31, 0x10, 0x51, 0x82, 0xF8, 0xF0, 0x64, 0xC3, 0x9E, 0x95, 0x4E,
-    0x24, 0x3B, 0xF2, 0x63, 0x09, 0xFD, 0xDE, 0x86, 0x44, 0x95, 0x6F, 0x15, 0xF4, 0x5D, 0xA7, 0xC4,
-    0xCF, 0xF6, 0xCF, 0xC0, 0x62, 0x3F, 0x29, 0x46, 0x34, 0xF9, 0xF7, 0xFD, 0xC1, 0xF2, 0x7B, 0xE8,
-    0x78, 0x4C, 0x6C, 0x51, 0x6A, 0x7B, 0xFB, 0x47, 0x54, 0x20, 0xC7, 0x9F, 0x05, 0x1D, 0xD8, 0x0C,
-    0x7F, 0x15, 0x23, 0xFF, 0x4F, 0xE8, 0x71, 0xE0, 0xD7, 0xFA, 0x17, 0x33, 0xF6, 0x19, 0x7A, 0xA3,
-    0xE2, 0x73, 0xFA, 0x30, 0x60, 0xA4, 0x03, 0xD7, 0xBD, 0xD0, 0x9A, 0xFC, 0xFD, 0x61, 0xB2, 0x97,
-    0xBF, 0xF2, 0xF4, 0xEE, 0xB6, 0x56, 0x44, 0x17, 0x62, 0x50, 0x47, 0x21, 0x21, 0x3B, 0xFE, 0xE5,
-    0xAE, 0x33, 0x13, 0x7F, 0xFA, 0x9C, 0xC9, 0x20, 0xB4, 0x44, 0x70, 0x57, 0xC1, 0x9C, 0xFE, 0x1E,
-    0xE7, 0x97, 0x87, 0xF3, 0xDE, 0x4E, 0xE8, 0xBA, 0xF9, 0x8B, 0x19, 0xB9, 0x68, 0xFD, 0x9C, 0x85,
-    0x8D, 0x1F, 0xC9, 0x8C, 0x30, 0xBE, 0x53, 0x5F, 0xD0, 0x7D, 0xDC, 0xFF, 0x07, 0xCD, 0x5A, 0x3F,
-    0x90, 0xDF, 0xC6, 0x75, 0x7E, 0x00, 0x74, 0x07, 0x87, 0x18, 0x13, 0x2E, 0x28, 0x45, 0x26, 0x33,
-    0x82, 0x0B, 0x17, 0x0E, 0x43, 0x1D, 0x1A, 0x17, 0x2C, 0x48, 0x2E, 0x64, 0xCE, 0xC4, 0x05, 0x0B,
-    0x5E, 0xC1, 0x1B, 0x4F, 0xA2, 0x82, 0x29, 0xE8, 0x42, 0x9A, 0x64, 0xCE, 0x85, 0x0B, 0x79, 0x86,
-    0x22, 0x40, 0x73, 0x12, 0x15, 0x29, 0x78, 0xE3, 0x44, 0x93, 0x52, 0x2A, 0x58, 0x48, 0x74, 0x71,
-    0x2A, 0x54, 0xA8, 0xD0, 0x11, 0x20, 0xAF, 0x60, 0xE1, 0xC2, 0x20, 0x39, 0x1A, 0x17, 0x2C, 0x08,
-    0x5B, 0xD4, 0xD8, 0x09, 0x67, 0x72, 0xB0, 0x09, 0x51, 0x38, 0x1E, 0x80, 0xE7, 0xEF, 0x5B, 0xE0,
-    0xFE, 0x90, 0x94, 0x12, 0x2B, 0x3E, 0x9B, 0x01, 0x89, 0xFD, 0xE1, 0xB7, 0xBF, 0xDD, 0xB7, 0x6F,
-    0xDF, 0x9F, 0xEF, 0xBD, 0xB7, 0xB8, 0xFD, 0x41, 0xA7, 0x3F, 0xEB, 0x0E, 0x8A, 0x38, 0x6E, 0x1B,
-    0xFF, 0xB8, 0x8B, 0xAF, 0xD9, 0xFF, 0x37, 0xFB, 0xF8, 0x56, 0x6F, 0xF0, 0xFF, 0x7A, 0xF7, 0xD7,
-    0x32, 0x5E, 0x2D, 0xEE, 0x66, 0xC7, 0x5D, 0x8B, 0x04, 0x43, 0x22, 0xB9, 0xD6, 0x9E, 0x6A, 0x17,
-    0x7C, 0xFA, 0xBB, 0x2E, 0xBA, 0x51, 0x77, 0xF1, 0xD5, 0xFA, 0x6D, 0x73, 0xB5, 0x16, 0x73, 0xBE,
-    0xDA, 0xBE, 0xAF, 0xE1, 0xBE, 0x59, 0x49, 0xFC, 0xA0, 0x7A, 0x3E, 0xD4, 0x8D, 0xCE, 0x57, 0x6D,
-    0x31, 0xAF, 0x14, 0xAF, 0x12, 0xF1, 0xCA, 0x27, 0x6F, 0x27, 0x99, 0xD6, 0x74, 0x35, 0x13, 0x47,
-    0x35, 0x11, 0x73, 0xAF, 0x93, 0xB0, 0x8E, 0x0B, 0x19, 0x9C, 0x4E, 0xE2, 0x32, 0x4C, 0xBC, 0x0E,
-    0x3F, 0x9B, 0x02, 0xE3, 0xF1, 0x10, 0xAA, 0xD6, 0x18, 0xA6, 0x32, 0x93, 0x7F, 0x34, 0x2F, 0x01,
-    0xB9, 0xCB, 0x41, 0x22, 0x04, 0x8B, 0x32, 0xE0, 0x8E, 0x4A, 0xD9, 0x67, 0xF0, 0xFB, 0x2A, 0xEE,
-    0x36, 0x5E, 0x03, 0xC1, 0x33, 0x32, 0x63, 0xD7, 0x38, 0xEA, 0xCC, 0x1F, 0x49, 0xF3, 0xA1, 0x8F,
-    0x54, 0x1B, 0xAF, 0x4F, 0x4B, 0xBF, 0x0E, 0xAB, 0xC0, 0xFE, 0xF3, 0xAB, 0xA0, 0x46, 0xDB, 0x44,
-    0x45, 0x00, 0xEA, 0x98, 0xDD, 0x1F, 0x3B, 0x50, 0xAD, 0x3C, 0x2F, 0xA4, 0x54, 0xE6, 0x7D, 0xAA,
-    0x85, 0xF6, 0xD1, 0x20, 0x8B, 0x8D, 0x37, 0x48, 0x54, 0xB8, 0x2A, 0x26, 0x13, 0xCD, 0x52, 0x91,
-    0xB4, 0xE8, 0xC1, 0xD9, 0x8D, 0x4E, 0x9C, 0xC5, 0xFB, 0xEB, 0x89, 0xA7, 0x1B, 0x5A, 0x92, 0x37,
-    0x6E, 0xC4, 0x6E, 0x46, 0x0B, 0xB1, 0x5F, 0x17, 0xF4, 0x4D, 0x30, 0xA0, 0xC9, 0xD4, 0xCC, 0xEA,
-    0x5D, 0x4C, 0x53, 0xCE, 0x55, 0x6E, 0xE9, 0x56, 0xD3, 0x9B, 0x93, 0x53, 0x33, 0x0A, 0xE3, 0xE0,
-    0x8E, 0xBE, 0x1B, 0xF3, 0x12, 0x57, 0x90, 0x61, 0x72, 0x65, 0xB1, 0x5E, 0x71, 0x3A, 0x23, 0x47,
-    0xA3, 0x0A, 0xEA, 0x10, 0xEF, 0x4E, 0x2B, 0x8D, 0x96, 0x73, 0xC1, 0xE0, 0x97, 0xA6, 0x1A, 0x9C,
-    0x3E, 0x6A, 0xC2, 0xF3, 0x7A, 0xAD, 0x0E, 0xFB, 0xB3, 0x92, 0xAE, 0x41, 0x9E, 0x17, 0x25, 0xBE,
-    0x5D, 0xFA, 0xF7, 0x7B, 0xAF, 0xCE, 0xB5, 0x09, 0xB4, 0x96, 0xFD, 0x19, 0x69, 0x9B, 0xEF, 0xB4,
-    0xE9, 0xF5, 0x2E, 0x5D, 0xED, 0xE6, 0x5C, 0xE8, 0xE4, 0x59, 0x32, 0x95, 0x2A, 0x9E, 0xCC, 0xD2,
-    0xCB, 0x95, 0x84, 0x99, 0x04, 0x19, 0xF5, 0x32, 0x27, 0xEF, 0xBB, 0x9A, 0xBC, 0x1F, 0x3A, 0xDA,
-    0x79, 0xD7, 0x4A, 0xE3, 0x17, 0x87, 0x8E, 0x04, 0xC5, 0x61, 0xE7, 0xE3, 0x02, 0x0C, 0xEF, 0x3D,
-    0x1C, 0x42, 0x1B, 0xF7, 0x33, 0xF2, 0x7E, 0x84, 0x8F, 0x1F, 0x17, 0x10, 0xFD, 0x0B, 0x2F, 0xFA,
-    0xC3, 0x3F, 0xBA, 0x45, 0x15, 0x6B, 0x71, 0x24, 0x48, 0x16, 0xAB, 0x20, 0x39, 0x0A, 0xAD, 0x56,
-    0x34, 0xA0, 0x0F, 0xC5, 0x5B, 0x77, 0xAE, 0x88, 0xF8, 0x4A, 0x15, 0x39, 0x0B, 0xB8, 0x2F, 0x49,
-    0xDA, 0x79, 0x0F, 0x9A, 0xE0, 0x78, 0x25, 0x51, 0x96, 0x0E, 0xDE, 0x27, 0x6D, 0xE4, 0x55, 0xE7,
-    0xD2, 0x46, 0xD7, 0x8A, 0x33, 0xFB, 0xC8, 0xA5, 0xFE, 0x56, 0xF5, 0xA5, 0x05, 0x70, 0xB7, 0x57,
-    0x0E, 0x49, 0x2A, 0xBD, 0xDB, 0xFB, 0x6D, 0xD0, 0x44, 0xB5, 0xA9, 0xF2, 0xC2, 0x14, 0x9A, 0xF0,
-    0x33, 0x6C, 0xE2, 0xCA, 0xEB, 0x03, 0x58, 0x98, 0xD3, 0x4B, 0x24, 0x47, 0xB9, 0xBD, 0x67, 0x17,
-    0x16, 0xBE, 0x0B, 0x0D, 0xA6, 0xAA, 0x37, 0x16, 0x16, 0x20, 0xE2, 0x00, 0x9B, 0x59, 0x19, 0x3F,
-    0x5E, 0x11, 0x89, 0x95, 0x17, 0xB9, 0x10, 0x67, 0x1E, 0xD6, 0x02, 0xCB, 0x9C, 0xC3, 0xBF, 0x17,
-    0xC5, 0x29, 0xBF, 0x6A, 0x9A, 0x43, 0x81, 0x7F, 0xD1, 0xBB, 0x90, 0xFD, 0xAA, 0x7C, 0xAF, 0x3C,
-    0x5A, 0x1F, 0xFA, 0x76, 0x58, 0x07, 0x7B, 0xBD, 0xFF, 0x76, 0x57, 0xAF, 0xDE, 0xAF, 0xAA, 0x1F,
-    0x0C, 0x47, 0x7F, 0x18, 0x8A, 0x1C, 0xC6, 0x76, 0xCE, 0x4A, 0xF0, 0x5F, 0xF0, 0x90, 0xFD, 0x4B,
-    0xA0, 0xD6, 0xA8, 0x7E, 0xAC, 0x56, 0xB1, 0x41, 0x2F, 0x3A, 0x84, 0x1B, 0x7D, 0xEA, 0xAE, 0x37,
-    0xDE, 0x46, 0x19, 0xDE, 0x29, 0xAE, 0x98, 0xB5, 0x3A, 0xD5, 0x64, 0xF1, 0x2E, 0x57, 0x8B, 0x33,
-    0x71, 0xDB, 0x1D, 0x1F, 0xFE, 0xC8, 0xE3, 0xCD, 0x9F, 0x0E, 0xEF, 0x3E, 0xF6, 0x5B, 0x64, 0xAD,
-    0xF5, 0xE0, 0xE5, 0xCB, 0xFF, 0x31, 0x0E, 0x29, 0xE9, 0x1C, 0x03, 0x74, 0x74, 0x7C, 0xD0, 0xE8,
-    0x6A, 0x7F, 0xCC, 0xAF, 0x25, 0x2E, 0xB8, 0xDF, 0xD2, 0xED, 0xF1, 0xE4, 0x0D, 0x97, 0x4F, 0xAB,
-    0x1A, 0x6D, 0xC7, 0x61, 0xB9, 0x1E, 0xFF, 0x54, 0x43, 0x78, 0x4E, 0x58, 0x39, 0x98, 0xD4, 0x0A,
-    0xBC, 0x09, 0x33, 0xA2, 0xC2, 0xD1, 0x08, 0xB6, 0x3D, 0xC8, 0xAB, 0x24, 0xFF, 0x5A, 0x78, 0xAD,
-    0x33, 0xFF, 0x5A, 0xBD, 0xE6, 0x50, 0x0A, 0xFB, 0x24, 0x2F, 0xA2, 0x1A, 0xB6, 0x0D, 0x81, 0xB6,
-    0xB4, 0xEE, 0x2A, 0xE8, 0x60, 0xDF, 0xF1, 0x17, 0x74, 0x69, 0x11, 0x76, 0x1E, 0xBA, 0x9A, 0x18,
-    0x5D, 0xBA, 0x31, 0xFC, 0x9B, 0xEA, 0xCF, 0xF5, 0xA4, 0x76, 0x51, 0x6B, 0xFE, 0x39, 0x99, 0x11,
-    0x95, 0xD1, 0x51, 0x25, 0xA4, 0x2D, 0xA7, 0x74, 0x71, 0x76, 0xB9, 0x4B, 0xB2, 0x79, 0xC1, 0xC9,
-    0xCA, 0xD8, 0x3A, 0xDA, 0x1A, 0x3E, 0x3F, 0xAE, 0x43, 0x6D, 0x81, 0x13, 0x83, 0x81, 0xC3, 0x5C,
-    0x2C, 0x72, 0x74, 0x44, 0xE8, 0xF0, 0xD0, 0x81, 0xCD, 0x5C, 0x2C, 0x42, 0x74, 0xC8, 0xD0, 0x82,
-    0xE2, 0x31, 0x03, 0xA2, 0x17, 0x0B, 0xF1, 0xD0, 0x21, 0x4F, 0x76, 0x40, 0x00, 0xC7, 0x8E, 0xA0,
-    0x03, 0xFB, 0xF3, 0x8A, 0x71, 0x25, 0x07, 0x7E, 0xFE, 0xEB, 0xC1, 0x94, 0xB2, 0x3F, 0xE8, 0xE2,
-    0x6A, 0x25, 0xBC, 0x5E, 0x9F, 0x11, 0xF9, 0x2B, 0x59, 0xAC, 0xCC, 0xE0, 0xC0, 0xE4, 0x07, 0x08,
-    0x69, 0x67, 0x03, 0x06, 0x62, 0xB8, 0x89, 0x38, 0xEF, 0xC2, 0xFC, 0xBC, 0x75, 0x8D, 0x92, 0xFE,
-    0x43, 0xF7, 0x41, 0xED, 0xDF, 0x2E, 0xE3, 0xD3, 0x59, 0x67, 0xD6, 0x4A, 0x88, 0xEF, 0x39, 0x8A,
-    0x2F, 0xD2, 0x0A, 0x4A, 0x87, 0x71, 0x1E, 0x96, 0xF7, 0x01, 0x3F, 0x03, 0x60, 0x2A, 0xCD, 0xC2,
-    0x96, 0xE2, 0x09, 0x3A, 0x47, 0xBD, 0x8E, 0x9F, 0x41, 0x1B, 0xD5, 0x71, 0x69, 0xB2, 0x14, 0xBF,
-    0x9F, 0x95, 0x46, 0x1E, 0xBF, 0xF6, 0xE2, 0x7E, 0x11, 0xBC, 0xB6, 0xE2, 0xE4, 0x70, 0x3F, 0xC0,
-    0x09, 0xC8, 0x4B, 0x58, 0x8A, 0xB3, 0x5C, 0x89, 0xD3, 0x8D, 0x78, 0x66, 0x88, 0x6D, 0x95, 0xF8,
-    0xD5, 0xF8, 0xD5, 0xCA, 0x95, 0x1E, 0xB3, 0xA7, 0xC4, 0x57, 0xAF, 0x86, 0x05, 0xE0, 0xEB, 0xEB,
-    0x14, 0x33, 0xB6, 0x50, 0x84, 0x3D, 0xB6, 0xE0, 0xD2, 0xFC, 0xB0, 0x0F, 0x23, 0x1F, 0xAE, 0x50,
-    0xDA, 0x65, 0x74, 0x82, 0x4A, 0xE8, 0xBC, 0x8A, 0x5F, 0x8D, 0x0C, 0xCB, 0xFF, 0x09, 0x4F, 0xAC,
-    0x00, 0xA4, 0x15, 0x09, 0x1E, 0xE4, 0x57, 0x98, 0x1E, 0x9D, 0xC4, 0xAF, 0x47, 0x47, 0x81, 0xAB,
-    0xCA, 0x29, 0xCC, 0x29, 0xE4, 0x0B, 0xAE, 0xC3, 0x23, 0xEF, 0x41, 0x35, 0xF2, 0xDE, 0x8D, 0xBC,
-    0x83, 0x0A, 0x79, 0xF7, 0x26, 0x2C, 0x5E, 0x19, 0x99, 0x25, 0x40, 0xE0, 0xAB, 0xDB, 0x8C, 0x5F,
-    0x8F, 0x01, 0x56, 0xC8, 0xEC, 0x55, 0x60, 0x38, 0x6C, 0xB4, 0x35, 0x6B, 0x0D, 0xBE, 0x1A, 0xAF,
-    0x36, 0xE7, 0x55, 0xFD, 0x2A, 0xF6, 0x1A, 0xF0, 0x0E, 0x82, 0x39, 0x9D, 0x26, 0x21, 0x9E, 0x93,
-    0xA0, 0xCF, 0xD9, 0xBD, 0x60, 0xBF, 0x90, 0x7E, 0x61, 0x7F, 0xF4, 0x1A, 0x31, 0x0F, 0xDF, 0xE1,
-    0x40, 0x8F, 0x40, 0x8B, 0x65, 0xE8, 0x04, 0x4E, 0x3B, 0x72, 0xE8, 0x7D, 0x11, 0xEB, 0xE4, 0xDB,
-    0x07, 0x0B, 0x98, 0xEE, 0x11, 0x08, 0x40, 0xEA, 0xDC, 0xC9, 0x9A, 0xD3, 0xBD, 0x22, 0xB7, 0x0E,
-    0x48, 0x1D, 0xC0, 0xB2, 0xE4, 0x40, 0x63, 0x85, 0xE1, 0x83, 0x38, 0xE5, 0x7E, 0x50, 0xC1, 0x0F,
-    0xE4, 0xEE, 0xD7, 0x56, 0xEE, 0x98, 0xF8, 0x21, 0xE5, 0xBE, 0x58, 0x45, 0x59, 0xD8, 0xFB, 0x80,
-    0xC9, 0x1A, 0x72, 0x87, 0x18, 0xCE, 0x51, 0xEE, 0xA7, 0x40, 0xD0, 0xCA, 0x1D, 0xDA, 0xD8, 0x29,
-    0xF7, 0xB0, 0xB4, 0x72, 0x77, 0x26, 0xB9, 0x53, 0xBD, 0x04, 0xA7, 0x49, 0xEE, 0xFD, 0x24, 0xF7,
-    0xEC, 0x11, 0x86, 0xF7, 0x20, 0x26, 0x56, 0x92, 0x22, 0xB0, 0xC2, 0x90, 0xC7, 0x70, 0x99, 0x88,
-    0x5F, 0x88, 0xCF, 0xC5, 0x7D, 0xAD, 0x60, 0x8D, 0x66, 0x48, 0xD2, 0x8C, 0x94, 0x5E, 0x1F, 0x0D,
-    0xA9, 0xD8, 0x17, 0x21, 0x4E, 0x2B, 0xCC, 0x01, 0x21, 0xB4, 0x79, 0xD4, 0xE6, 0xEC, 0x08, 0xC6,
-    0x5B, 0x92, 0xF2, 0x94, 0xDA, 0x71, 0xEC, 0xB3, 0x3C, 0xBF, 0x3D, 0xD0, 0xB1, 0xEE, 0x9A, 0x16,
-    0x76, 0x08, 0x1F, 0x23, 0x8B, 0x99, 0x0C, 0x57, 0xE8, 0x20, 0xC5, 0x38, 0xA5, 0x4D, 0x76, 0x79,
-    0x41, 0x63, 0xE2, 0x7C, 0x73, 0x5C, 0x69, 0x66, 0x01, 0xA3, 0x42, 0x45, 0xE7, 0x37, 0x6F, 0xA6,
-    0x35, 0x96, 0xB1, 0xCA, 0xB1, 0x61, 0x30, 0x5D, 0xF8, 0x9E, 0x12, 0x1B, 0x02, 0x82, 0x97, 0x84,
-    0xAD, 0xA3, 0x4B, 0x92, 0xAE, 0xC7, 0x5A, 0x82, 0x59, 0xF8, 0x53, 0x4A, 0xDF, 0x9B, 0xAE, 0x52,
-    0x46, 0x45, 0x6F, 0x2E, 0x9F, 0x52, 0x2F, 0xDE, 0x40, 0x36, 0x67, 0xE4, 0xFF, 0x01, 0x9B, 0x51,
-    0x66, 0xC5, 0xC6, 0x36, 0xB4, 0x22, 0xEC, 0x90, 0x13, 0x40, 0xBB, 0xB4, 0x9B, 0x6F, 0xC9, 0x37,
-    0xB6, 0x39, 0x3C, 0x63, 0xB9, 0xB2, 0x1B, 0xB3, 0xE3, 0x7C, 0x3B, 0xC7, 0x58, 0x66, 0x99, 0x01,
-    0x48, 0x70, 0x87, 0x5B, 0x33, 0x31, 0x71, 0xA7, 0x85, 0x86, 0x41, 0x84, 0x03, 0x53, 0xA0, 0x2E,
-    0xB0, 0xC1, 0xC3, 0x90, 0xF0, 0x93, 0xD3, 0xF4, 0x07, 0x20, 0x26, 0x2D, 0x1D, 0xD6, 0x13, 0x7D,
-    0xB4, 0xC0, 0xCC, 0x82, 0x2A, 0x84, 0x5F, 0x00, 0x92, 0xD3, 0xBB, 0xD8, 0xF8, 0x09, 0x6D, 0x7C,
-    0x06, 0x02, 0xB2, 0x39, 0x2D, 0x1E, 0xD5, 0xEF, 0x71, 0x99, 0x0D, 0xE6, 0x5E, 0x1B, 0xDC, 0x7C,
-    0xE0, 0x5B, 0xF7, 0x70, 0xE4, 0xA9, 0x33, 0x38, 0x9B, 0xBD, 0x42, 0xCD, 0x5D, 0xE8, 0x68, 0x89,
-    0x5C, 0xDE, 0x6F, 0x99, 0xE2, 0x39, 0xB2, 0x6F, 0x9B, 0xB5, 0xAF, 0xB3, 0xF1, 0xED, 0x66, 0x4C,
-    0x6D, 0xE5, 0x5D, 0x6D, 0xC9, 0xDB, 0x70, 0x3B, 0xEE, 0x67, 0x54, 0x77, 0xF8, 0x33, 0x0E, 0x39,
-    0x47, 0x5D, 0x7A, 0x0D, 0x07, 0x46, 0x05, 0xD5, 0x3D, 0x30, 0xD7, 0xF2, 0xD6, 0xA1, 0x4B, 0x46,
-    0x7D, 0x0C, 0x61, 0x46, 0x28, 0xFE, 0xA7, 0x0B, 0x50, 0x37, 0x96, 0xCA, 0x4B, 0xC4, 0x50, 0xC4,
-    0xB4, 0x68, 0x1D, 0x5B, 0xFE, 0x09, 0x5D, 0x05, 0x61, 0x8C, 0x0C, 0x32, 0x87, 0xD8, 0x4C, 0x48,
-    0x31, 0x75, 0x91, 0x36, 0xD7, 0x1C, 0xA3, 0x41, 0x95, 0x16, 0x1C, 0x6E, 0x73, 0xF9, 0x90, 0x92,
-    0x99, 0x12, 0xCB, 0xA7, 0xED, 0x2B, 0x9C, 0xC0, 0xAD, 0xAA, 0x95, 0x3D, 0xC3, 0x2B, 0x93, 0x01,
-    0x6F, 0xA3, 0x27, 0x8E, 0xBB, 0x9D, 0x26, 0xCC, 0x28, 0x7A, 0x53, 0xBA, 0xF8, 0xC8, 0x6D, 0x54,
-    0x96, 0xD4, 0xB3, 0xFC, 0x9B, 0x4C, 0x2F, 0x5F, 0xA2, 0xBC, 0x0C, 0xB7, 0x1D, 0x32, 0x26, 0x20,
-    0xFF, 0x5B, 0x7F, 0x79, 0x58, 0x18, 0xC9, 0x51, 0xC4, 0xCA, 0x0C, 0x24, 0x61, 0xBE, 0xC1, 0xCC,
-    0x07, 0x3C, 0xF5, 0xC0, 0xB2, 0x34, 0x81, 0x70, 0xA3, 0x22, 0x2D, 0x1D, 0x6A, 0x1D, 0x31, 0x07,
-    0xA3, 0x3A, 0x83, 0x3C, 0x79, 0xCC, 0xAD, 0x5E, 0x5D, 0x82, 0x4C, 0x91, 0x27, 0x20, 0xD3, 0x0E,
-    0xF5, 0xA7, 0x3D, 0xF6, 0x60, 0xBE, 0x8B, 0x48, 0x75, 0x0B, 0x16, 0x51, 0x83, 0xE8, 0xD7, 0x28,
-    0x2B, 0xDA, 0x13, 0xF7, 0x6F, 0x45, 0x46, 0x95, 0x12, 0xA7, 0x90, 0xD6, 0x42, 0xCB, 0xB0, 0x31,
-    0xD3, 0xD3, 0x12, 0xD7, 0xFF, 0x1E, 0xA9, 0x2B, 0x81, 0x0C, 0x86, 0x18, 0xD3, 0x18, 0x9F, 0x45,
-    0xCE, 0x36, 0x9B, 0x8D, 0x13, 0x25, 0xCF, 0x46, 0xD4, 0xB4, 0x51, 0xAB, 0xDE, 0xD4, 0x03, 0xAE,
-    0xAF, 0x8E, 0x91, 0x66, 0x24, 0x9D, 0x37, 0xDC, 0x84, 0xEC, 0xA8, 0x34, 0x68, 0x3C, 0xAA, 0x77,
-    0x70, 0x37, 0x8B, 0xA0, 0xEC, 0x83, 0xF6, 0x4B, 0x30, 0xD4, 0x12, 0x60, 0x5E, 0x61, 0x93, 0x82,
-    0x0E, 0x30, 0x71, 0xF9, 0x1D, 0xA4, 0x5C, 0xD8, 0x24, 0xF6, 0xE1, 0x0F, 0x0B, 0xF3, 0x16, 0x22,
-    0x99, 0xCD, 0x60, 0xC4, 0x51, 0x8C, 0x88, 0xCE, 0x6B, 0x12, 0xFE, 0x12, 0xDC, 0x7D, 0x06, 0x3A,
-    0x3D, 0x45, 0xBF, 0x09, 0x49, 0xD8, 0x0A, 0xA3, 0x88, 0xAF, 0x54, 0x45, 0x42, 0xEB, 0x17, 0xD9,
-    0x4E, 0x7E, 0xFE, 0x54, 0x6B, 0xBB, 0xCD, 0x08, 0xE9, 0x2E, 0x0C, 0xCE, 0xE9, 0xD2, 0xC4, 0xED,
-    0x90, 0x33, 0x7C, 0x4B, 0xFE, 0x61, 0x6B, 0x5D, 0x0E, 0x03, 0x51, 0xBD, 0x81, 0x79, 0x0D, 0x08,
-    0xAD, 0x90, 0x10, 0xD6, 0xF6, 0xB2, 0x89, 0xB2, 0xF8, 0xC3, 0xE5, 0xB7, 0x1D, 0x8A, 0x1A, 0xC3,
-    0x24, 0x5A, 0x5F, 0x48, 0x46, 0x66, 0xC6, 0xB5, 0x39, 0xE5, 0x1C, 0x3A, 0xCC, 0xBF, 0x4C, 0xFC,
-    0x73, 0xED, 0x4E, 0x2E, 0x41, 0x1B, 0x7A, 0xA2, 0x45, 0xCD, 0xA7, 0xD0, 0x01, 0xCC, 0x62, 0x7E,
-    0x1B, 0x5B, 0xBC, 0x4D, 0xEE, 0xFE, 0x96, 0x36, 0x94, 0x96, 0x2E, 0x69, 0xBC, 0x0E, 0x1A, 0x7B,
-    0xB7, 0x37, 0xF4, 0xF0, 0x32, 0x33, 0xE1, 0xC6, 0x21, 0xAD, 0xF4, 0x93, 0x05, 0xD9, 0x96, 0x41,
-    0xE2, 0x61, 0x8A, 0xD3, 0xA2, 0x63, 0x38, 0x30, 0xB1, 0xCE, 0x65, 0x69, 0xF6, 0x6F, 0x33, 0x78,
-    0x47, 0x58, 0xB4, 0x93, 0x03, 0xED, 0xA6, 0xDA, 0x3D, 0xFA, 0xAF, 0xCE, 0x6A, 0xE6, 0x5B, 0x53,
-    0xC5, 0x5C, 0x4D, 0xFE, 0x87, 0x47, 0x27, 0x5F, 0x37, 0xF4, 0x24, 0xEB, 0x46, 0x7B, 0x04, 0xF6,
-    0x1D, 0x37, 0x08, 0x86, 0x30, 0xC2, 0x6F, 0xCA, 0x1F, 0x47, 0x2F, 0xA5, 0x39, 0x7B, 0x5A, 0x87,
-    0x37, 0x11, 0x13, 0x56, 0xBE, 0xBE, 0x49, 0xCF, 0xD0, 0x41, 0x3A, 0xD0, 0xC3, 0x8C, 0x3F, 0xF0,
-    0x3F, 0xEA, 0xC4, 0x71, 0xD6, 0xFE, 0xE4, 0x92, 0x59, 0xED, 0xD3, 0xD5, 0xDE, 0x5C, 0xEB, 0x9E,
-    0x91, 0xF9, 0x3F, 0x9E, 0x20, 0xAA, 0xA4, 0x64, 0xC2, 0x6A, 0x63, 0xDB, 0xC5, 0xF5, 0x65, 0x45,
-    0x89, 0x90, 0xC4, 0x83, 0xDD, 0x16, 0x14, 0x92, 0x00, 0xFF, 0xF0, 0x18, 0x76, 0x54, 0x96, 0x16,
-    0x78, 0x0C, 0x58, 0x8D, 0x24, 0xF9, 0x2F, 0xA0, 0xAF, 0xC0, 0xF6, 0xE6, 0xC5, 0xF6, 0x00, 0x8E,
-    0x8D, 0x6B, 0x4A, 0x83, 0x14, 0xC0, 0xD5, 0x2C, 0xE9, 0x72, 0x89, 0x86, 0x4B, 0x54, 0x5B, 0x56,
-    0xF1, 0x35, 0x8B, 0xAD, 0x43, 0x68, 0x43, 0xCD, 0x32, 0xDB, 0x35, 0x5B, 0x32, 0x5C, 0xE8, 0x3F,
-    0x2F, 0x59, 0x43, 0x1C, 0xF2, 0x2D, 0xB2, 0x04, 0x84, 0x81, 0xCA, 0xC9, 0x4B, 0x1A, 0xB8, 0xC9,
-    0x5C, 0xEC, 0x81, 0xED, 0x60, 0x5B, 0x54, 0x83, 0x99, 0xDB, 0x6B, 0x81, 0xB6, 0x43, 0x32, 0x84,
-    0xD6, 0x34, 0x6C, 0xA3, 0x8E, 0x6D, 0xA0, 0x6C, 0x3D, 0x4D, 0xD1, 0xC2, 0xD0, 0xD0, 0x22, 0x56,
-    0xB1, 0x35, 0xB6, 0x0D, 0xA1, 0xE2, 0x21, 0x09, 0x34, 0x33, 0xE4, 0x17, 0x6D, 0x29, 0x16, 0xF9,
-    0x99, 0x89, 0x6D, 0x79, 0xF4, 0x78, 0xB8, 0x30, 0x86, 0xA1, 0xC0, 0x66, 0x4B, 0x8B, 0xD6, 0x72,
-    0xB6, 0xA3, 0x15, 0x30, 0x8F, 0xA0, 0x97, 0x89, 0x45, 0x2B, 0xC0, 0x9E, 0x96, 0xC4, 0xBD, 0x0E,
-    0xD6, 0xE1, 0xE9, 0x05, 0x6C, 0x31, 0x25, 0xF4, 0x85, 0x1D, 0xCC, 0xDE, 0x55, 0x4E, 0xCE, 0x6F,
-    0x03, 0xC4, 0xE2, 0xCF, 0x94, 0x06, 0x0F, 0xFC, 0x43, 0x27, 0x6C, 0x3F, 0xBF, 0xCE, 0xA4, 0xBF,
-    0x66, 0x18, 0x68, 0x4C, 0x8B, 0xE1, 0x08, 0xC7, 0x01, 0xF9, 0xCD, 0xFB, 0x91, 0x30, 0x70, 0x90,
-    0x51, 0x68, 0x61, 0x1B, 0xCC, 0x50, 0xD0, 0x58, 0x28, 0x27, 0xAC, 0x57, 0x13, 0xE0, 0x8D, 0x4F,
-    0x7F, 0x21, 0x4F, 0x95, 0x3B, 0x63, 0x1B, 0x1B, 0xFF, 0x28, 0xB1, 0xF8, 0x8D, 0x9A, 0x25, 0xC2,
-    0x39, 0x68, 0x3F, 0xDB, 0xCA, 0xE1, 0x9C, 0xCB, 0x09, 0xCB, 0xA9, 0xC1, 0xC6, 0x68, 0x28, 0x76,
-    0x58, 0x86, 0x0D, 0x36, 0xA2, 0x35, 0x2D, 0x6B, 0x08, 0x3B, 0x00, 0xC1, 0x2A, 0xCF, 0x49, 0x7E,
-    0x0B, 0x0A, 0x41, 0x9F, 0x17, 0x9B, 0xDC, 0xDD, 0x01, 0x77, 0x11, 0xB9, 0x43, 0x27, 0x59, 0x06,
-    0x1A, 0x88, 0xAE, 0xE2, 0xBB, 0x29, 0x69, 0xD3, 0x35, 0x42, 0x70, 0x5C, 0xC3, 0x3C, 0x40, 0xD3,
-    0x12, 0x06, 0x8F, 0xD5, 0x78, 0xF2, 0x60, 0xB3, 0x67, 0x5A, 0xE0, 0x5E, 0xA2, 0xCC, 0x1A, 0x74,
-    0x7B, 0x85, 0x20, 0xB0, 0x37, 0x7C, 0xB4, 0x42, 0x7B, 0x1A, 0x8C, 0xED, 0x49, 0xDE, 0x61, 0xD9,
-    0x8C, 0xB8, 0xE6, 0xF5, 0xC8, 0xF8, 0x45, 0x59, 0xF5, 0xCC, 0x8C, 0x1E, 0xC3, 0x6B, 0xF6, 0x5D,
-    0x7B, 0x56, 0xD3, 0xDA, 0x5C, 0x0B, 0x56, 0xFA, 0x10, 0x62, 0xCF, 0x4B, 0xA0, 0x16, 0xB4, 0x66,
-    0x5A, 0xD8, 0xA6, 0xAF, 0xDC, 0x85, 0x5E, 0xA7, 0x22, 0x1E, 0x8C, 0x3C, 0x90, 0x31, 0xA4, 0x16,
-    0x92, 0x92, 0x31, 0x74, 0x82, 0xDB, 0x0E, 0xC6, 0xE1, 0x69, 0xC8, 0x8C, 0xE8, 0x38, 0x2C, 0x02,
-    0xD3, 0x5B, 0xB8, 0x72, 0xC0, 0xD3, 0xAB, 0x91, 0xB0, 0x4B, 0x43, 0x91, 0x19, 0xD8, 0xFF, 0x57,
-    0xE4, 0x9B, 0x51, 0x16, 0x9F, 0x68, 0xE3, 0x2A, 0x5F, 0xAE, 0x78, 0x84, 0x94, 0xD7, 0x04, 0xDE,
-    0x88, 0xB1, 0xA9, 0x89, 0x6A, 0x3D, 0x51, 0x87, 0xD5, 0x7B, 0x32, 0x39, 0xF7, 0xFE, 0x4B, 0x90,
-    0x2C, 0x44, 0x16, 0x14, 0x4C, 0x07, 0x7A, 0x2B, 0x33, 0xB8, 0x6B, 0x12, 0xAA, 0x58, 0xA1, 0x31,
-    0xCA, 0xE7, 0x9D, 0x47, 0x53, 0xA1, 0x14, 0x57, 0xB4, 0xC4, 0xAA, 0x37, 0xF5, 0x3B, 0x2A, 0x2B,
-    0x41, 0x1F, 0x76, 0x28, 0x54, 0x91, 0xBD, 0xAD, 0x60, 0x47, 0xF9, 0x6D, 0x4C, 0x73, 0x69, 0xA7,
-    0xF0, 0x5A, 0x6C, 0xAD, 0xC4, 0x5C, 0xC4, 0x72, 0x8A, 0xAE, 0x01, 0x87, 0x6B, 0x9A, 0x04, 0x6B,
-    0x94, 0xDD, 0x91, 0x03, 0xE3, 0x79, 0xD2, 0xF7, 0xB7, 0xD5, 0xE6, 0x25, 0xD3, 0x61, 0x0B, 0x1D,
-    0xA1, 0xDC, 0xCA, 0x19, 0xC7, 0x67, 0x99, 0x7D, 0x54, 0xC5, 0x8C, 0x4A, 0x8C, 0x63, 0x2E, 0x43,
-    0x54, 0xE9, 0xA4, 0x15, 0x13, 0x06, 0x54, 0xA5, 0x1D, 0x13, 0x2F, 0x88, 0x33, 0xAC, 0xC9, 0xB2,
-    0x29, 0xBE, 0x4C, 0x77, 0x8A, 0xCD, 0x27, 0xEE, 0xC0, 0x12, 0x13, 0xCC, 0x86, 0x9B, 0x19, 0x5D,
-    0x67, 0xF3, 0x32, 0xB2, 0xF5, 0x77, 0x3B, 0x3C, 0x57, 0xBE, 0x6D, 0xCF, 0x43, 0xB6, 0x93, 0xEF,
-    0x29, 0x73, 0x5C, 0x7A, 0x34, 0x5D, 0x79, 0xDA, 0xCC, 0x06, 0x56, 0x84, 0x16, 0x52, 0x7C, 0x2B,
-    0xCE, 0x94, 0xD9, 0x95, 0x5F, 0xB3, 0xB2, 0xDF, 0x03, 0x1B, 0xD9, 0x79, 0xA5, 0xB0, 0x0B, 0x46,
-    0xFD, 0x22, 0x47, 0xA6, 0xD1, 0xC8, 0xE9, 0xF6, 0xCB, 0x73, 0xF5, 0x44, 0x37, 0xCA, 0x03, 0xE8,
-    0x2F, 0x47, 0xA0, 0x23, 0x68, 0x79, 0xBA, 0x59, 0x68, 0xD8, 0xEC, 0x94, 0xFC, 0x3C, 0xC7, 0x90,
-    0xE8, 0xBE, 0xBD, 0x9F, 0xAA, 0xFF, 0xA5, 0xCD, 0x27, 0xDF, 0xC0, 0x1E, 0x9C, 0x9E, 0x6C, 0x4A,
-    0xF2, 0xCC, 0x23, 0x0C, 0x82, 0x3B, 0x9F, 0xE9, 0x44, 0x1D, 0x23, 0x05, 0xEB, 0xE5, 0x2F, 0x87,
-    0xFF, 0xAB, 0xF0, 0x76, 0x74, 0xFB, 0xB6, 0xCA, 0x8E, 0x51, 0xA4, 0x37, 0xCC, 0xC1, 0x74, 0xB3,
-    0xDC, 0x28, 0xE8, 0xA9, 0x04, 0xC4, 0x99, 0x7F, 0xFF, 0x62, 0xB8, 0xAE, 0x3F, 0x07, 0xAE, 0x2D,
-    0x9F, 0x5D, 0xAC, 0xF7, 0xE0, 0x4D, 0xDA, 0xA4, 0xF0, 0x25, 0xAA, 0x1B, 0xEB, 0xA6, 0x15, 0xB2,
-    0x5D, 0xB8, 0x05, 0x51, 0xE5, 0x3C, 0x3D, 0xBA, 0xEE, 0x59, 0x17, 0xA7, 0x56, 0xF2, 0xB6, 0x16,
-    0xC8, 0x36, 0x6D, 0xC9, 0xC6, 0xAA, 0xB0, 0xDB, 0xAA, 0x4A, 0xB6, 0x3B, 0x63, 0xD6, 0xD1, 0x29,
-    0x79, 0x8C, 0xC7, 0xA3, 0xD0, 0xF1, 0x20, 0x3A, 0xB4, 0x00, 0xCE, 0x52, 0xAC, 0x9F, 0xA7, 0xBD,
-    0xB5, 0x4C, 0x04, 0xE1, 0x94, 0x8B, 0x9D, 0x8F, 0xB8, 0x79, 0x9E, 0xA7, 0x80, 0x69, 0x11, 0x76,
-    0x3C, 0x2A, 0xC4, 0x86, 0xF5, 0x25, 0x05, 0x6A, 0xA4, 0x1F, 0xB1, 0x22, 0xD1, 0xD2, 0xD7, 0x21,
-    0xB1, 0xE7, 0x7C, 0x16, 0xF4, 0xEC, 0xB9, 0x77, 0xBD, 0x19, 0x77, 0x20, 0x68, 0xAA, 0xAB, 0x86,
-    0x8C, 0xD2, 0x0A, 0x83, 0x40, 0xC4, 0x1E, 0xF9, 0x14, 0xD8, 0x05, 0x88, 0x16, 0x7E, 0x87, 0xAA,
-    0x34, 0xAA, 0x4D, 0x22, 0xE9, 0x35, 0xE2, 0x2A, 0xB6, 0xE9, 0x23, 0x80, 0xA3, 0x2B, 0x07, 0x0B,
-    0x85, 0xA2, 0xF6, 0x91, 0xBC, 0xC5, 0x92, 0x79, 0x0D, 0x4B, 0x48, 0xCB, 0xF4, 0x5A, 0x82, 0xC5,
-    0xE7, 0x3C, 0x94, 0x4F, 0x03, 0xD4, 0x7D, 0x5F, 0x35, 0x00, 0xC2, 0x12, 0x45, 0xC7, 0x88, 0xED,
-    0x8C, 0x47, 0x46, 0xF6, 0x14, 0xD2, 0xE1, 0xFE, 0x52, 0x56, 0xBE, 0xC9, 0x76, 0xD9, 0x0B, 0x73,
-    0x21, 0xBA, 0x80, 0x6F, 0x31, 0x9F, 0x20, 0xE2, 0x67, 0x79, 0x11, 0x27, 0xAC, 0x49, 0x70, 0xEF,
-    0x47, 0xCA, 0x0D, 0xFE, 0x81, 0xCD, 0x40, 0xD5, 0xB4, 0xC8, 0x33, 0x30, 0x80, 0xDF, 0xF3, 0x7B,
-    0xFA, 0x1B, 0x48, 0xA3, 0x8F, 0x06, 0xA4, 0x7A, 0xF3, 0x93, 0x6F, 0x3A, 0xD5, 0xB8, 0x10, 0x1D,
-    0x98, 0xA6, 0x46, 0xD8, 0x79, 0x01, 0xFD, 0xCF, 0xEC, 0xE2, 0x3A, 0x33, 0xD3, 0xBB, 0x0F, 0x62,
-    0xF8, 0xD0, 0x62, 0xB9, 0x5E, 0xFC, 0xF2, 0x98, 0xB8, 0xC9, 0xBE, 0x5D, 0x5B, 0xC3, 0xB9, 0xF4,
-    0x3C, 0x54, 0x3E, 0x07, 0xFD, 0x0F, 0x12, 0x9E, 0xE8, 0xC4, 0x75, 0xEF, 0x6E, 0x9B, 0xE1, 0x2E,
-    0xC9, 0x2A, 0xA8, 0xAE, 0x40, 0x9F, 0x6A, 0xEF, 0x20, 0xFB, 0xD1, 0xAE, 0xD3, 0xB7, 0xD5, 0xC4,
-    0x06, 0x60, 0xA1, 0x82, 0x8C, 0xCA, 0x0F, 0xEC, 0xA7, 0x43, 0x13, 0x4C, 0xB3, 0xDD, 0x5B, 0xE7,
-    0xB9, 0x64, 0x86, 0x67, 0xFE, 0x6F, 0x68, 0x65, 0x4B, 0xEE, 0xD5, 0xE1, 0xB4, 0x7E, 0xAF, 0xB7,
-    0x94, 0xEE, 0x37, 0x01, 0xAD, 0x54, 0xD2, 0x37, 0x97, 0x6B, 0x67, 0x19, 0xBF, 0x81, 0x9E, 0x3E,
-    0xFC, 0x89, 0xDE, 0x6B, 0xC9, 0x19, 0x78, 0x08, 0x5A, 0x5A, 0x23, 0xD6, 0x6D, 0xE4, 0x65, 0x45,
-    0x90, 0x1D, 0x52, 0x84, 0x5B, 0xBD, 0xA1, 0x6D, 0x88, 0xE2, 0xE7, 0x94, 0xCC, 0x00, 0xC0, 0x40,
-    0x3B, 0xD4, 0x0A, 0x13, 0xCF, 0xEB, 0x5B, 0x9D, 0x29, 0xCD, 0xF5, 0xCE, 0x43, 0x2A, 0xB0, 0x2F,
-    0xA4, 0xAB, 0x67, 0x62, 0x3F, 0x0A, 0x5B, 0x20, 0x23, 0x5C, 0x5F, 0x00, 0xC2, 0x84, 0x96, 0xE5,
-    0xCA, 0xD6, 0xC4, 0x97, 0xAC, 0x67, 0x3B, 0xF9, 0x68, 0x8F, 0x57, 0xC6, 0xA3, 0xD8, 0xB1, 0x2E,
-    0x0A, 0xC6, 0x72, 0x34, 0x2E, 0x89, 0x55, 0x82, 0x7C, 0x97, 0x47, 0x87, 0x9B, 0xD7, 0xF7, 0x21,
-    0x24, 0xBE, 0x33, 0x68, 0xA3, 0x4F, 0xF3, 0xD5, 0x0E, 0x38, 0x92, 0xC5, 0xF7, 0x5A, 0x77, 0x00,
-    0xF3, 0x08, 0xB0, 0x83, 0xBE, 0xB9, 0x70, 0x92, 0x19, 0x4A, 0x81, 0xD2, 0x50, 0x9E, 0x31, 0xE4,
-    0x57, 0x3B, 0x66, 0xDB, 0xB2, 0x30, 0x9D, 0x3C, 0x8C, 0xB4, 0x01, 0x66, 0x74, 0x81, 0xCE, 0x76,
-    0xEC, 0x02, 0x69, 0x88, 0x9A, 0x7E, 0x0B, 0x59, 0x05, 0x6B, 0x85, 0xD3, 0x9E, 0x13, 0xE3, 0xD6,
-    0x4E, 0x36, 0xC6, 0x99, 0xD9, 0x79, 0x9E, 0xBE, 0x07, 0x94, 0xD2, 0xCB, 0x9D, 0x29, 0xCC, 0xAF,
-    0x41, 0x33, 0xCF, 0x62, 0x4B, 0x13, 0xA4, 0xD7, 0x17, 0x4E, 0xD9, 0x14, 0xC7, 0x42, 0xEA, 0x71,
-    0x2A, 0xCF, 0x4A, 0xA9, 0xB1, 0x12, 0xA6, 0x99, 0x20, 0x6A, 0x35, 0x9A, 0xE9, 0x89, 0xC6, 0x2D,
-    0xE7, 0x76, 0x47, 0x0C, 0x15, 0x84, 0xCD, 0x73, 0x78, 0xBE, 0x96, 0x91, 0xB3, 0x53, 0xB4, 0x46,
-    0x21, 0x85, 0x50, 0x79, 0x60, 0x20, 0x70, 0x7F, 0x4E, 0xE3, 0x23, 0xF3, 0x1A, 0xCC, 0x98, 0x9A,
-    0x60, 0x5E, 0x06, 0x24, 0xCC, 0x79, 0x04, 0x5D, 0x7F, 0xC9, 0xE9, 0xFB, 0x78, 0x30, 0x6E, 0x1A,
-    0x77, 0xA3, 0x8E, 0xDE, 0xA8, 0xBA, 0xE0, 0xEA, 0x28, 0xA4, 0x7D, 0x84, 0x4B, 0xAD, 0x50, 0x84,
-    0x61, 0x34, 0x0C, 0x07, 0xB9, 0xE4, 0xE3, 0x8F, 0x51, 0xEF, 0xE9, 0x10, 0x32, 0x36, 0x39, 0x5D,
-    0xF4, 0xF3, 0x46, 0xD3, 0x5B, 0xFD, 0x3F, 0xB9, 0x53, 0x1E, 0x37, 0x83, 0x00, 0xE1, 0x00, 0x75,
-    0xF3, 0x27, 0xA7, 0x6D, 0x3E, 0x22, 0x61, 0x50, 0x94, 0x0D, 0x53, 0xF0, 0x38, 0x04, 0xB5, 0xE7,
-    0x57, 0xC6, 0xCA, 0x23, 0xA6, 0x9D, 0xA2, 0x7F, 0x3C, 0xE6, 0x2A, 0x64, 0x26, 0x02, 0xE4, 0x6B,
-    0x1D, 0xF0, 0xD0, 0x61, 0x3D, 0xEF, 0x4C, 0x15, 0x75, 0x69, 0x11, 0x74, 0x79, 0xC1, 0xB2, 0x82,
-    0xB7, 0x37, 0x7D, 0xFA, 0x5D, 0x5E, 0x22, 0x35, 0x85, 0x7A, 0xCC, 0x90, 0xDB, 0x93, 0x28, 0xD7,
-    0x9E, 0xF8, 0xF0, 0x7D, 0x69, 0xF9, 0x0D, 0xC4, 0xC3, 0xF6, 0x03, 0x86, 0x12, 0x68, 0x76, 0x8E,
-    0x27, 0x45, 0x5F, 0x99, 0x5D, 0xDA, 0x19, 0x2D, 0x4F, 0xD1, 0x33, 0x3B, 0x04, 0xCA, 0x14, 0x5A,
-    0x4B, 0xFE, 0x86, 0x47, 0x68, 0x1E, 0x78, 0x2C, 0xEC, 0x2B, 0x2C, 0x1E, 0x40, 0xFE, 0xEF, 0x4D,
-    0x5E, 0xC6, 0x08, 0x23, 0xA8, 0x35, 0x57, 0xA7, 0xF3, 0xD3, 0x1F, 0xC8, 0xF8, 0xC2, 0x45, 0xA7,
-    0xB3, 0xA6, 0x68, 0x7A, 0x65, 0xBD, 0x79, 0x21, 0xA8, 0xB3, 0x9C, 0x84, 0xC7, 0x56, 0xD8, 0x5A,
-    0x63, 0xAA, 0xF0, 0xD1, 0xAD, 0x65, 0x3B, 0xB6, 0x56, 0x6C, 0x6D, 0xAD, 0xA6, 0xDF, 0x6E, 0x6D,
-    0xCD, 0x5E, 0x3F, 0x1C, 0x17, 0xA2, 0x6F, 0x7A, 0xCD, 0x98, 0x6E, 0x05, 0xD9, 0xEE, 0xAE, 0xC3,
-    0x57, 0x0A, 0x7C, 0x47, 0x1E, 0x4F, 0xAF, 0x6A, 0x3A, 0x23, 0x6E, 0x13, 0x66, 0xB2, 0x34, 0xB3,
-    0x7B, 0x6B, 0xBC, 0x32, 0x03, 0x88, 0x3D, 0x99, 0x20, 0xD4, 0x27, 0xDE, 0x2D, 0x08, 0x2D, 0xFB,
-    0x60, 0xD7, 0x65, 0xE5, 0x35, 0x71, 0xE6, 0x63, 0x26, 0x6F, 0xB7, 0x9A, 0xDB, 0x65, 0x19, 0x8D,
-    0x2A, 0x80, 0xD1, 0x12, 0xAB, 0xF7, 0x4C, 0xE9, 0xAC, 0xFE, 0x02, 0x28, 0xF2, 0xEC, 0xC2, 0x58,
-    0xD2, 0x46, 0x99, 0xFD, 0x0D, 0x43, 0x9C, 0x66, 0x2C, 0x3C, 0x22, 0x5D, 0x67, 0x02, 0xD4, 0x44,
-    0x4D, 0xDA, 0x86, 0x8D, 0xA7, 0x3E, 0x90, 0xE1, 0xDA, 0xE0, 0x6A, 0xA3, 0x3F, 0xFE, 0xAC, 0x37,
-    0xBF, 0x6A, 0xF4, 0xE4, 0xC3, 0xC6, 0xDC, 0xD2, 0x26, 0xAC, 0xF3, 0xC6, 0xEF, 0x22, 0x94, 0x3F,
-    0x1E, 0x28, 0xB2, 0x40, 0x92, 0x07, 0x5C, 0x78, 0xC2, 0xA5, 0x11, 0xA8, 0xA7, 0xCA, 0x85, 0x58,
-    0x3D, 0xFE, 0x45, 0x83, 0x6B, 0x2D, 0xF1, 0xEC, 0x13, 0xC7, 0x22, 0x71, 0x17, 0x68, 0x92, 0x77,
-    0xA8, 0xC3, 0x16, 0xBB, 0x59, 0x4D, 0x98, 0x8E, 0xFD, 0x41, 0x0D, 0x18, 0xA3, 0x7E, 0x74, 0xC9,
-    0x1E, 0xD8, 0xA2, 0x1A, 0x43, 0x2C, 0x99, 0x49, 0xB6, 0x0E, 0x31, 0xC2, 0x69, 0x8F, 0x53, 0x7E,
-    0xCA, 0xB7, 0x6C, 0xD6, 0x03, 0xA4, 0xFE, 0x33, 0x70, 0xC0, 0xDB, 0xA6, 0x6B, 0x9E, 0x7D, 0x53,
-    0xC1, 0xCA, 0x3C, 0xE2, 0x91, 0x01, 0xC0, 0x9F, 0xAF, 0xA6, 0x96, 0xFE, 0xE4, 0xDB, 0x4F, 0x19,
-    0x3B, 0x79, 0x98, 0x39, 0x36, 0x73, 0x6E, 0xF5, 0x67, 0x12, 0xFB, 0x6B, 0xE3, 0xDB, 0xCC, 0x11,
-    0x61, 0xEC, 0x41, 0x93, 0xAD, 0xB8, 0x5E, 0x78, 0x7C, 0x79, 0x9F, 0xE1, 0xEC, 0x2D, 0xAD, 0x4D,
-    0x1F, 0x32, 0x7D, 0x46, 0x21, 0xCE, 0xE2, 0xC5, 0x67, 0x4E, 0x0C, 0x8B, 0xD4, 0xAC, 0x87, 0x0F,
-    0x20, 0x10, 0x7B, 0x1D, 0x52, 0xE9, 0x60, 0xDD, 0xFE, 0xB1, 0x0C, 0xB3, 0x52, 0xDD, 0x7C, 0x7F,
-    0xC6, 0x0A, 0xC0, 0x4A, 0xD8, 0xBE, 0x4D, 0x65, 0x56, 0xC9, 0x97, 0x2B, 0xAF, 0xDA, 0x8A, 0x7F,
-    0x20, 0x79, 0x2C, 0x1F, 0xDC, 0x9D, 0x8E, 0xB5, 0x5C, 0x8E, 0x26, 0x12, 0xCE, 0xEA, 0x34, 0xD0,
-    0xBE, 0xE2, 0x98, 0x1E, 0xCE, 0xF0, 0x58, 0xA8, 0xA3, 0x7B, 0xD4, 0x4C, 0x75, 0x92, 0xB4, 0x8A,
-    0x99, 0xA1, 0x23, 0x81, 0x82, 0x77, 0x31, 0x55, 0x7F, 0xE4, 0xC1, 0xFE, 0x84, 0x6C, 0x2B, 0xC6,
-    0xE0, 0x65, 0x7B, 0xBE, 0x4C, 0x4F, 0x2D, 0x25, 0xFD, 0x28, 0x79, 0x94, 0xB2, 0xC3, 0x88, 0xC4,
-    0xBF, 0x46, 0x71, 0x2F, 0xBF, 0xBB, 0xF9, 0x77, 0x41, 0x2D, 0x7C, 0x22, 0xAC, 0x79, 0x82, 0xB2,
-    0x8A, 0x11, 0x3F, 0xF2, 0x97, 0x1E, 0x93, 0x4A, 0x8A, 0x78, 0xBC, 0xAE, 0xEA, 0x69, 0xA9, 0x95,
-    0x87, 0x42, 0x25, 0x0B, 0x59, 0x2B, 0xA5, 0x60, 0x10, 0xAE, 0x1A, 0xB6, 0x61, 0xC9, 0x42, 0x82,
-    0xB3, 0x19, 0xC3, 0xDF, 0x2A, 0xC6, 0xF0, 0xE4, 0x32, 0x37, 0xB4, 0xAF, 0xBA, 0x6C, 0x85, 0x14,
-    0x55, 0x53, 0x99, 0xE0, 0x4D, 0xDC, 0xCC, 0x2E, 0xDB, 0xC3, 0x2C, 0xBE, 0x97, 0xE7, 0xB9, 0xE4,
-    0x15, 0x7A, 0xFF, 0xEF, 0x01, 0xCD, 0x5B, 0x3D, 0x90, 0xDD, 0xD4, 0x7E, 0x3F, 0x92, 0xBC, 0x2B,
-    0xB0, 0x26, 0xC8, 0x85, 0x61, 0x1E, 0xDE, 0xF7, 0xA2, 0x26, 0x05, 0x33, 0x2F, 0x83, 0x9A, 0x14,
-    0x14, 0x60, 0x09, 0x3C, 0x13, 0x0A, 0x17, 0x6C, 0xE1, 0x0D, 0x43, 0x28, 0x78, 0x85, 0xDF, 0x4C,
-    0x92, 0x37, 0xF3, 0x36, 0x45, 0x8A, 0x57, 0x18, 0x4B, 0x0C, 0x33, 0xA1, 0x78, 0xC5, 0xDB, 0x02,
-    0xD2, 0xA4, 0xC0, 0x05, 0x99, 0x71, 0x4C, 0x61, 0x8A, 0x14, 0x64, 0xC6, 0xB6, 0x84, 0xB7, 0x70,
-    0x41, 0x81, 0x8C, 0x27, 0x49, 0x41, 0x81, 0x00, 0xF3, 0xFC, 0xC6, 0x14, 0x96, 0x1F, 0x02, 0x6B,
-    0x17, 0x49, 0xFF, 0xFC, 0x7E, 0xFF, 0x73, 0x75, 0x77, 0xD7, 0x18, 0xF0, 0x37, 0xDC, 0xD9, 0x3D,
-    0x57, 0xF7, 0x5C, 0xE9, 0x9C, 0xFF, 0xF7, 0xE7, 0xB9, 0x26, 0x90, 0xC1, 0x18, 0x93, 0x48, 0x8B,
-    0x51, 0xA4, 0x34, 0x3B, 0x5F, 0x8B, 0x29, 0x06, 0x47, 0x78, 0x19, 0xF6, 0x1C, 0xB3, 0x0E, 0x83,
-    0x27, 0x0D, 0x27, 0xA4, 0xC2, 0x78, 0x5A, 0x72, 0x4C, 0xFC, 0x99, 0xB7, 0x44, 0xAF, 0x72, 0xA9,
-    0x81, 0x37, 0xFA, 0x4D, 0x8C, 0x5B, 0x92, 0x3C, 0xC1, 0x2D, 0xE3, 0x0A, 0x96, 0x0D, 0x44, 0x84,
-    0xDB, 0xC8, 0x68, 0x9C, 0x61, 0xE5, 0xA5, 0xDE, 0x84, 0x8D, 0x89, 0x5B, 0x93, 0xA5, 0x26, 0xA9,
-    0xFD, 0x31, 0x75, 0xE4, 0x62, 0x21, 0x69, 0x26, 0x5F, 0xCA, 0xE0, 0x00, 0x8A, 0x00, 0xB7, 0x85,
-    0x78, 0x20, 0x54, 0xE0, 0x66, 0xAF, 0x47, 0x96, 0x8D, 0x8B, 0xCF, 0x11, 0xE6, 0x93, 0xCF, 0x25,
-    0x4F, 0xF2, 0xA2, 0x8C, 0xD3, 0x0C, 0x10, 0xE3, 0x7F, 0x9F, 0x94, 0x3E, 0x9E, 0x8B, 0xF1, 0x9F,
-    0x55, 0x59, 0x59, 0xE4, 0x59, 0x29, 0xF8, 0xBE, 0xF8, 0x42, 0xFE, 0x94, 0x89, 0x0C, 0xD1, 0x18,
-    0xB5, 0xCE, 0xB2, 0x93, 0x1A, 0x47, 0x57, 0x7A, 0xCA, 0x3C, 0x81, 0x71, 0x7C, 0xBE, 0x36, 0x58,
-    0x91, 0x90, 0xBB, 0x8A, 0x90, 0x39, 0xBC, 0x0D, 0x73, 0xBD, 0x8E, 0x74, 0x5A, 0xA9, 0xE2, 0x13,
-    0x4F, 0x20, 0xA0, 0x13, 0x84, 0x2A, 0xF8, 0x98, 0xA4, 0x48, 0x88, 0xA7, 0xD3, 0x11, 0xCF, 0xB0,
-    0xE2, 0x8D, 0x99, 0x8B, 0x5B, 0xBC, 0xCE, 0xC3, 0x2D, 0xE1, 0xE7, 0xC0, 0xD3, 0x14, 0x82, 0xC5,
-    0x3D, 0xA0, 0x5F, 0x9B, 0xE8, 0x7F, 0x48, 0x0A, 0xC1, 0x76, 0xA9, 0xDF, 0x1A, 0x6F, 0x34, 0xD9,
-    0x45, 0x13, 0x8D, 0x07, 0xA5, 0x05, 0xEC, 0x89, 0x54, 0x91, 0xF4, 0x84, 0x2F, 0xC8, 0x1F, 0x32,
-    0xE1, 0xC5, 0xA3, 0x20, 0x59, 0x8F, 0x3B, 0x01, 0xE3, 0xC3, 0x77, 0x91, 0x00, 0xC6, 0x59, 0x53,
-    0x36, 0x96, 0xCA, 0x46, 0xC5, 0x71, 0x54, 0x94, 0x7A, 0x9D, 0xA0, 0x14, 0xC4, 0x19, 0xF6, 0x34,
-    0x7D, 0x81, 0x5B, 0xFC, 0x5A, 0xF0, 0x48, 0x72, 0x00, 0x37, 0x3A, 0x7D, 0x80, 0x5B, 0xC2, 0x3A,
-    0xC4, 0x2D, 0xC9, 0x1B, 0x59, 0x43, 0xCA, 0x01, 0x19, 0x70, 0x09, 0x84, 0xC9, 0x56, 0x9E, 0x17,
-    0xE3, 0xF5, 0x26, 0x00, 0x74, 0x95, 0x09, 0x3B, 0x47, 0xD6, 0x4C, 0xB6, 0x11, 0x2B, 0x4A, 0x42,
-    0xBE, 0x92, 0x8E, 0xBE, 0x12, 0xF3, 0x0C, 0x07, 0xAF, 0x55, 0x89, 0xE2, 0x3E, 0x26, 0x51, 0x16,
-    0x67, 0xFA, 0xE5, 0xAE, 0x3B, 0x41, 0xB2, 0xB7, 0x48, 0x86, 0xB8, 0x37, 0x26, 0xD4, 0x5C, 0x3B,
-    0xB7, 0xEB, 0x07, 0xFD, 0x36, 0xCE, 0x3E, 0xC6, 0xED, 0xF0, 0x5F, 0x80, 0x67, 0x04, 0xAC, 0x00,
-    0x45, 0x1E, 0x9C, 0xBE, 0xFC, 0xA7, 0x35, 0xC3, 0x2D, 0x80, 0x56, 0x1B, 0xCA, 0xDB, 0x03, 0x10,
-    0x4A, 0x9E, 0x1D, 0x4C, 0x78, 0x01, 0x4C, 0x6B, 0x40, 0x8B, 0x3D, 0x84, 0x84, 0x2C, 0xE7, 0x8A,
-    0x4A, 0x3F, 0xF2, 0x1C, 0x82, 0x6C, 0x82, 0x91, 0x8A, 0x52, 0xD9, 0xFD, 0x7C, 0xD9, 0xF8, 0xFB,
-    0x06, 0x8C, 0xEF, 0x21, 0xF6, 0x83, 0x89, 0x29, 0x2F, 0x0F, 0x2F, 0xDB, 0x0D, 0x1E, 0x82, 0xB4,
-    0x75, 0x0A, 0x19, 0x34, 0xC0, 0x21, 0x49, 0xB7, 0x20, 0x7B, 0x01, 0xCB, 0x41, 0x28, 0xA4, 0x8B,
-    0x36, 0x64, 0x7D, 0xF0, 0xFA, 0xAC, 0x4C, 0x0E, 0x76, 0x4E, 0x0A, 0x02, 0x87, 0x78, 0x84, 0x6F,
-    0x94, 0xA7, 0x9A, 0xB2, 0xF8, 0x00, 0x54, 0xA9, 0xC4, 0x06, 0x2E, 0x15, 0x6A, 0x65, 0x86, 0x51,
-    0xD2, 0x58, 0x09, 0x4D, 0x0E, 0x36, 0x26, 0x49, 0x4F, 0x41, 0x7B, 0x67, 0x78, 0x39, 0x27, 0x52,
-    0x4B, 0x51, 0x91, 0x2A, 0x19, 0x4F, 0xB6, 0x00, 0x78, 0x88, 0x5A, 0x93, 0x3C, 0x07, 0x96, 0xAD,
-    0x03, 0xB8, 0xA7, 0x89, 0x49, 0x31, 0x43, 0x2D, 0x9C, 0x50, 0x23, 0x81, 0xE2, 0x8E, 0xD8, 0x80,
-    0x9C, 0x14, 0x8D, 0x48, 0x3E, 0xFF, 0xCD, 0x59, 0x30, 0xBC, 0x01, 0x07, 0x5A, 0x08, 0x36, 0xA6,
-    0x56, 0x28, 0x52, 0xD0, 0x2B, 0x2C, 0x92, 0xB4, 0x26, 0xB8, 0x52, 0x3A, 0xDD, 0x51, 0x93, 0xB8,
-    0x8D, 0x93, 0x3F, 0xA0, 0x3B, 0x2F, 0xAC, 0x41, 0x44, 0x6A, 0x90, 0xF4, 0x15, 0x79, 0xB3, 0x4F,
-    0xAA, 0xE4, 0x5C, 0xEF, 0xB5, 0x45, 0xBE, 0x77, 0xC2, 0xA7, 0x53, 0x02, 0x92, 0x76, 0x30, 0x2C,
-    0xAF, 0x02, 0x9F, 0x50, 0xF9, 0x5B, 0x5B, 0x72, 0xED, 0x22, 0x4E, 0x80, 0x0A, 0xA0, 0x1A, 0x9F,
-    0x62, 0x22, 0xDB, 0xD8, 0x78, 0x6F, 0x71, 0xDA, 0x9D, 0x1A, 0xAA, 0x70, 0x52, 0xEB, 0xDB, 0x52,
-    0x7A, 0x37, 0x78, 0xF4, 0x98, 0xF9, 0x9D, 0x09, 0xF3, 0x0C, 0x8A, 0x92, 0x59, 0x3E, 0x29, 0x44,
-    0x71, 0x7A, 0x1F, 0xF0, 0x71, 0xD3, 0x5F, 0x98, 0xD3, 0x7E, 0xED, 0x37, 0x3D, 0xA4, 0x51, 0xE1,
-    0x73, 0xB1, 0xC2, 0x82, 0xB9, 0x63, 0x1E, 0xBD, 0xE3, 0x50, 0xE6, 0x28, 0xC7, 0xC1, 0xD5, 0x7E,
-    0xB2, 0x23, 0xA1, 0xAA, 0xF4, 0xE9, 0x39, 0xA7, 0x56, 0x0E, 0xD1, 0xB7, 0x48, 0x47, 0xDC, 0xA4,
-    0x76, 0x8A, 0x3F, 0x16, 0x02, 0x9E, 0xC2, 0xB6, 0x81, 0xA9, 0x11, 0x0C, 0x7E, 0xEA, 0x4A, 0x9E,
-    0x55, 0x10, 0x5F, 0xE0, 0x1B, 0xF6, 0x98, 0x74, 0xE5, 0x69, 0xE0, 0x53, 0x54, 0x98, 0x8C, 0x39,
-    0x19, 0x70, 0xD2, 0x13, 0xDC, 0x69, 0xF4, 0xCE, 0xA2, 0xC4, 0x64, 0x86, 0xC7, 0x9D, 0xA2, 0x5E,
-    0xE4, 0x9A, 0x34, 0x43, 0x95, 0x47, 0xEF, 0xB2, 0xF5, 0x5A, 0xDE, 0x0B, 0x44, 0xDB, 0xFD, 0x58,
-    0x0C, 0x83, 0x53, 0xB4, 0x2F, 0x03, 0xB0, 0xF6, 0x08, 0x87, 0x77, 0x39, 0xFC, 0x97, 0x59, 0x7C,
-    0xA9, 0xDD, 0xE3, 0x90, 0x4A, 0x01, 0x87, 0x68, 0x63, 0x15, 0xD4, 0xA6, 0x7D, 0xCB, 0x4A, 0x0C,
-    0x05, 0x07, 0xC9, 0x77, 0x0E, 0xE5, 0x34, 0x14, 0x0D, 0xD8, 0x03, 0x6C, 0x36, 0x40, 0xCE, 0x6F,
-    0xE8, 0xAF, 0xD6, 0x41, 0xA2, 0x43, 0xB4, 0xAF, 0x0F, 0x83, 0xDA, 0xD6, 0xDA, 0x2B, 0xB2, 0x66,
-    0x75, 0xE3, 0xA4, 0x94, 0x00, 0x3C, 0x1E, 0x29, 0xC6, 0x59, 0x6B, 0xB1, 0x55, 0x44, 0x15, 0x1D,
-    0x62, 0x12, 0x0C, 0x30, 0x5F, 0x69, 0xF1, 0x7F, 0x00, 0x23, 0xD0, 0x59, 0xC5, 0x6F, 0x76, 0x03,
-    0xEF, 0x8D, 0x1B, 0x5C, 0xFA, 0x5C, 0x61, 0x51, 0x72, 0x45, 0x98, 0x5B, 0x28, 0x04, 0xF5, 0x36,
-    0x84, 0xC1, 0x04, 0x3C, 0xE1, 0x92, 0xE7, 0xBB, 0x29, 0x0F, 0xB4, 0xD5, 0xE0, 0x17, 0xF1, 0x83,
-    0xDC, 0x60, 0xE6, 0x37, 0x57, 0xF4, 0x99, 0x94, 0xE6, 0xCD, 0x23, 0x8D, 0xB3, 0x2A, 0xC4, 0x96,
-    0xF8, 0x8A, 0xF8, 0x81, 0xD3, 0xB3, 0x0B, 0x9D, 0x01, 0x9E, 0x81, 0xC0, 0x55, 0x11, 0x4D, 0x18,
-    0xFB, 0xA2, 0x57, 0x2C, 0x17, 0xD2, 0xBD, 0x36, 0x50, 0xA0, 0x51, 0x0F, 0xA5, 0xDF, 0x11, 0x2E,
-    0x90, 0x0D, 0xD7, 0xF0, 0x3F, 0x2C, 0x61, 0xC0, 0xF2, 0x01, 0x38, 0xE8, 0xB4, 0x40, 0xE0, 0x09,
-    0xAA, 0x2F, 0xD1, 0x31, 0xD9, 0xE5, 0x13, 0x14, 0xF3, 0x0A, 0xE2, 0x06, 0xA4, 0xDE, 0x38, 0x64,
-    0xC0, 0xCE, 0x49, 0xC1, 0x43, 0x3C, 0xE2, 0xD7, 0x59, 0xE5, 0x75, 0xAB, 0x58, 0x03, 0x4B, 0x48,
-    0x46, 0x27, 0x03, 0x5C, 0xB9, 0x9B, 0x2F, 0x5B, 0xEA, 0xFF, 0x6B, 0x2C, 0x36, 0x42, 0xBA, 0xBB,
-    0xE8, 0xAB, 0x62, 0xBD, 0xF7, 0xC6, 0x2C, 0x8F, 0xBF, 0xE8, 0xDC, 0x11, 0x77, 0x5F, 0x81, 0x10,
-    0xC8, 0x1B, 0x2B, 0xCF, 0xB5, 0xAA, 0x2C, 0xA0, 0xD9, 0x2E, 0xC0, 0x7F, 0x5E, 0xB5, 0x10, 0xDB,
-    0xAF, 0xD8, 0xC7, 0x9F, 0x34, 0xFF, 0x6C, 0xA2, 0xF3, 0xA7, 0xC0, 0x28, 0x08, 0x4C, 0x42, 0xCB,
-    0x7D, 0x68, 0x0B, 0x89, 0x69, 0xDF, 0xF3, 0x30, 0xE0, 0x84, 0xFD, 0x34, 0xA5, 0x14, 0x90, 0x79,
-    0xF9, 0x1C, 0xD4, 0xF1, 0xC4, 0x31, 0x87, 0x96, 0x1D, 0xB7, 0x41, 0x6E, 0x56, 0xD2, 0x2D, 0xEC,
-    0x2A, 0xC3, 0x47, 0x8E, 0x62, 0x22, 0xF9, 0x57, 0xAC, 0xF1, 0xF1, 0x8C, 0x20, 0xBD, 0x49, 0x75,
-    0x57, 0xBF, 0x8D, 0xC1, 0x80, 0x4A, 0x35, 0x75, 0xF9, 0xCE, 0x51, 0xA1, 0xF1, 0x1D, 0x66, 0x4E,
-    0x88, 0xC6, 0x3F, 0xA0, 0x5F, 0xDD, 0x73, 0xAF, 0x51, 0x59, 0xDC, 0xB2, 0x8D, 0x23, 0xC3, 0x95,
-    0xBB, 0xC4, 0x95, 0x64, 0xB6, 0x49, 0x4B, 0xE6, 0x63, 0xD7, 0x98, 0xD2, 0x40, 0x13, 0x50, 0x4F,
-    0xF6, 0xDF, 0x91, 0x13, 0xC7, 0x09, 0x68, 0x0A, 0x01, 0x2A, 0xFD, 0x71, 0x65, 0x79, 0x02, 0x94,
-    0xA8, 0x3C, 0x45, 0xDC, 0x5E, 0x81, 0x6C, 0x7F, 0x52, 0xCC, 0x84, 0x50, 0x34, 0xE6, 0x74, 0x3A,
-    0xFB, 0x6F, 0x86, 0x99, 0x37, 0x09, 0x61, 0xD4, 0x1C, 0x52, 0x0C, 0xC1, 0xD6, 0xE2, 0x32, 0x84,
-    0xB1, 0x0E, 0x68, 0xFA, 0x5E, 0xEC, 0x93, 0x32, 0xB9, 0x04, 0x70, 0x8B, 0x3C, 0x56, 0x70, 0x01,
-    0xF5, 0xC6, 0xCA, 0x21, 0xEC, 0x40, 0x5F, 0x8F, 0x98, 0xE8, 0x00, 0xE3, 0x28, 0x35, 0x7D, 0x8D,
-    0x59, 0xC0, 0x54, 0x04, 0x32, 0x68, 0x90, 0x0B, 0x31, 0xAA, 0x66, 0x21, 0x86, 0x53, 0x79, 0x95,
-    0x81, 0xF9, 0x34, 0xD1, 0x85, 0xD6, 0x2A, 0x62, 0x3C, 0x6D, 0x7F, 0x2F, 0x59, 0xE2, 0xE4, 0xBF,
-    0x30, 0x2F, 0xFB, 0xB5, 0x07, 0xF3, 0x1E, 0x5D, 0x49, 0x27, 0xF3, 0xEE, 0xCC, 0x62, 0xF8, 0xDB,
-    0xC2, 0xB1, 0x35, 0x0B, 0x14, 0xD0, 0x98, 0xDC, 0x65, 0x40, 0xE8, 0xC0, 0x7C, 0x03, 0xDF, 0x91,
-    0x71, 0x2E, 0x42, 0xAB, 0xDD, 0xE6, 0x81, 0x79, 0xC8, 0xF4, 0x1F, 0xB4, 0x3B, 0x30, 0x44, 0x8C,
-    0x74, 0x5D, 0xD9, 0x3C, 0xD9, 0xC0, 0x57, 0x04, 0x4D, 0xD4, 0xD9, 0x2C, 0xC0, 0xAB, 0x10, 0x1C,
-    0x3B, 0x36, 0xE2, 0x2C, 0xE6, 0x83, 0x94, 0xEE, 0x89, 0xE3, 0x54, 0xED, 0xBE, 0xA8, 0x5C, 0x0C,
-    0x35, 0xFC, 0x0C, 0x62, 0xC0, 0xB0, 0x4B, 0x90, 0x1A, 0x74, 0x11, 0xD8, 0xD8, 0x31, 0x65, 0xE8,
-    0x5C, 0xB5, 0x73, 0x31, 0xA5, 0x44, 0xFD, 0xB2, 0x6A, 0x4D, 0x96, 0x5A, 0x1F, 0xE3, 0x7E, 0x03,
-    0xFA, 0x1F, 0x8D, 0xE0, 0xA3, 0xCA, 0x53, 0xC6, 0xFC, 0xCA, 0x9D, 0x01, 0xB4, 0xF0, 0xFA, 0x23,
-    0x69, 0x60, 0x65, 0x0B, 0x81, 0xE2, 0x79, 0x79, 0x2C, 0x6C, 0xA0, 0x18, 0xB0, 0x21, 0x79, 0xD8,
-    0xF8, 0x6A, 0xE3, 0x52, 0x5F, 0x0A, 0xE4, 0x1F, 0x1A, 0x60, 0x0F, 0x36, 0x76, 0xD2, 0x60, 0x54,
-    0xE4, 0x32, 0x9F, 0xA4, 0x7F, 0x97, 0x26, 0xBA, 0xFC, 0xB6, 0x1C, 0x00, 0x34, 0x6D, 0x06, 0xFB,
-    0xED, 0x8F, 0x4F, 0x17, 0x75, 0x42, 0x1F, 0x46, 0xCE, 0x38, 0x27, 0xDF, 0x32, 0x33, 0xFA, 0x86,
-    0xE9, 0x43, 0x8C, 0xF4, 0xCF, 0x18, 0x8D, 0xD7, 0x67, 0x99, 0xC4, 0xA3, 0xE6, 0xC7, 0x21, 0x0E,
-    0xC3, 0x79, 0xF3, 0x73, 0xE3, 0x0E, 0x01, 0x23, 0x73, 0xC8, 0x52, 0x46, 0xA1, 0xDF, 0x3B, 0x8F,
-    0x5D, 0x9E, 0x3E, 0x4C, 0x38, 0x18, 0x40, 0xC3, 0xA1, 0x46, 0x7F, 0xCE, 0xC5, 0x14, 0xA9, 0xA5,
-    0x09, 0x89, 0xD3, 0xD2, 0xF7, 0x7D, 0xC3, 0xF4, 0x04, 0xDA, 0x81, 0xE0, 0xDD, 0x46, 0xEC, 0xA3,
-    0xDA, 0xF5, 0xF1, 0x2D, 0x3E, 0xC9, 0x20, 0x41, 0x9C, 0xF1, 0x44, 0xD1, 0x42, 0x91, 0xE4, 0x59,
-    0x48, 0x5B, 0x93, 0x5D, 0x5C, 0x1A, 0xE9, 0x8C, 0x72, 0xD8, 0xFE, 0xCA, 0xEC, 0xDB, 0x4C, 0x67,
-    0x71, 0x9B, 0xC6, 0xDE, 0xDB, 0x70, 0xCA, 0xF2, 0xE9, 0x8B, 0xFB, 0x4F, 0x17, 0x97, 0x39, 0x8F,
-    0x3A, 0xC4, 0x6E, 0x76, 0xB1, 0x58, 0x6D, 0x77, 0x5B, 0xF7, 0x8B, 0x2E, 0xF7, 0x57, 0x18, 0x34,
-    0x77, 0x67, 0x62, 0x6A, 0x65, 0x5B, 0x87, 0x88, 0x2B, 0x26, 0xE9, 0x24, 0x14, 0xEF, 0x18, 0x9B,
-    0x27, 0xF9, 0xF5, 0xCC, 0x3E, 0x32, 0x79, 0xB2, 0x17, 0x44, 0xF1, 0xE8, 0xFD, 0x26, 0x50, 0xA0,
-    0x6C, 0x61, 0x4C, 0x0B, 0x3A, 0x71, 0xCC, 0x90, 0x4E, 0x62, 0x35, 0xA8, 0x38, 0x2C, 0xCE, 0xCF,
-    0x76, 0xC4, 0x1A, 0x20, 0x21, 0x3D, 0x86, 0xE4, 0x22, 0x9F, 0x80, 0x28, 0x59, 0x47, 0x13, 0x99,
-    0x55, 0xB0, 0x8D, 0xB8, 0x80, 0x95, 0xC4, 0x05, 0xEC, 0x65, 0xD4, 0xCE, 0xA6, 0xC7, 0x13, 0x6F,
-    0xAB, 0xDF, 0xB0, 0x76, 0x55, 0x30, 0xFD, 0xC6, 0x4A, 0xF1, 0x9D, 0x77, 0xEB, 0xF4, 0x2A, 0x02,
-    0x2E, 0xF9, 0x83, 0x08, 0xA1, 0xD4, 0xA8, 0xD7, 0xCA, 0xAF, 0x2D, 0x18, 0x30, 0x3B, 0xA6, 0xF9,
-    0x09, 0xCF, 0xF6, 0xA4, 0xE1, 0x29, 0x0A, 0x37, 0x3D, 0xEF, 0x82, 0xB1, 0x51, 0x18, 0xDC, 0x19,
-    0x86, 0x25, 0x0E, 0xCE, 0xB6, 0x41, 0xCB, 0x29, 0xCE, 0x61, 0x0C, 0x88, 0xC3, 0x1D, 0x1A, 0x28,
-    0x0E, 0x15, 0x32, 0xC7, 0xAC, 0xC6, 0x2D, 0xC9, 0xCD, 0x0E, 0xC8, 0x4E, 0x1B, 0x19, 0x23, 0xF9,
-    0x64, 0x0A, 0x79, 0x43, 0x85, 0x73, 0x5D, 0xE9, 0x51, 0x2F, 0x8D, 0x06, 0x81, 0xA2, 0xC5, 0x65,
-    0x77, 0x71, 0xF9, 0x44, 0xB1, 0xF9, 0x1A, 0x71, 0x90, 0xF6, 0xC5, 0x71, 0xE5, 0xEF, 0xE4, 0x90,
-    0xFD, 0x82, 0xA1, 0xD8, 0xC9, 0xD6, 0x58, 0x9A, 0x90, 0x3F, 0x92, 0x5A, 0xA2, 0x58, 0x4A, 0x18,
-    0x4B, 0x15, 0x4B, 0x8A, 0xE9, 0x09, 0xFD, 0x42, 0xE9, 0x92, 0x2B, 0xFD, 0xFB, 0xC4, 0x12, 0x46,
-    0xC5, 0xA9, 0x68, 0x67, 0x45, 0xA1, 0x7D, 0xC4, 0x95, 0x5E, 0xCB, 0x65, 0xED, 0x23, 0x10, 0x75,
-    0xB8, 0x14, 0xB3, 0x7E, 0xA9, 0x36, 0xD1, 0x35, 0x88, 0x69, 0xA6, 0xD1, 0xDF, 0x26, 0xC2, 0xC0,
-    0x51, 0x23, 0x5C, 0xD6, 0x42, 0x2A, 0xD6, 0x0D, 0x80, 0x1E, 0x1E, 0xBC, 0xD1, 0x54, 0x25, 0x12,
-    0xCA, 0x25, 0xE9, 0x32, 0x20, 0x06, 0x26, 0x3C, 0x7B, 0x50, 0x8A, 0xA4, 0xE8, 0xFE, 0x25, 0x29,
-    0xB7, 0x04, 0xE2, 0x4B, 0x91, 0xF7, 0x0A, 0x92, 0x87, 0x3E, 0x15, 0x9B, 0x54, 0xDF, 0x77, 0xB9,
-    0x3A, 0x3E, 0xC7, 0xAA, 0x4B, 0x1F, 0xE4, 0xB9, 0x9C, 0x3B, 0x27, 0x12, 0x45, 0xDD, 0xDE, 0x29,
-    0xCF, 0x5B, 0x30, 0xF1, 0x08, 0x87, 0x87, 0xEC, 0x02, 0xA0, 0x00, 0x10, 0xD8, 0x8D, 0xE4, 0xBA,
-    0x4B, 0x24, 0x5C, 0x22, 0xAF, 0xAA, 0xAB, 0xF8, 0x54, 0xE4, 0xFD, 0xAD, 0x42, 0x55, 0xA8, 0xAB,
-    0x2E, 0x8D, 0x3F, 0x0C, 0x81, 0x5E, 0x2E, 0xCA, 0x45, 0x05, 0xBC, 0x4C, 0xB8, 0xCE, 0xB9, 0x79,
-    0x8C, 0xBB, 0x8C, 0xF4, 0x08, 0x54, 0x5E, 0xBA, 0xE1, 0xE6, 0xF6, 0x32, 0x83, 0x10, 0x74, 0x89,
-    0xD4, 0x7B, 0x8C, 0x53, 0x7B, 0xEF, 0xB7, 0x59, 0x84, 0x80, 0x42, 0xD2, 0xC5, 0xE5, 0x3B, 0x22,
-    0x07, 0xE4, 0xB3, 0x71, 0xDE, 0x6F, 0xE3, 0x90, 0x05, 0x90, 0xD4, 0x49, 0x6F, 0x95, 0x1C, 0xCC,
-    0x4B, 0xE5, 0x03, 0x11, 0xC8, 0xDF, 0xCD, 0x6C, 0x0B, 0x8D, 0x2B, 0x36, 0x12, 0x56, 0x89, 0xA0,
-    0xE4, 0x48, 0x23, 0x61, 0xA5, 0x60, 0xB2, 0xE8, 0x66, 0x2B, 0xCA, 0xD4, 0xB2, 0xE2, 0x09, 0x51,
-    0x29, 0xDD, 0x89, 0xC0, 0xB7, 0x02, 0x8C, 0x87, 0xD5, 0x8C, 0xDB, 0x72, 0x55, 0xE4, 0x5F, 0xB1,
-    0xD6, 0x98, 0xF6, 0xD0, 0xB6, 0xE9, 0xF6, 0x5E, 0x6F, 0xEE, 0x50, 0x76, 0xCC, 0x5E, 0x70, 0x29,
-    0x1B, 0x01, 0x0B, 0x76, 0x4F, 0x6E, 0x30, 0x64, 0x6D, 0x22, 0x9F, 0xCD, 0x54, 0xD4, 0xAA, 0xE7,
-    0x07, 0x14, 0x63, 0xA5, 0x8E, 0xAC, 0x59, 0xF5, 0xB2, 0xAA, 0xA6, 0xDA, 0x65, 0x35, 0xED, 0xB6,
-    0xA7, 0x41, 0x4A, 0x78, 0x0F, 0xC0, 0x05, 0x6D, 0x03, 0x41, 0x6D, 0x48, 0x9A, 0xD4, 0x6A, 0xAF,
-    0xC8, 0xC8, 0xB8, 0xD7, 0x42, 0xA6, 0xFA, 0x80, 0x7E, 0xEE, 0xA3, 0x97, 0x41, 0x52, 0x00, 0x3B,
-    0xF8, 0xB0, 0xE5, 0x4D, 0xD6, 0xF8, 0x23, 0x48, 0xBD, 0xA5, 0x55, 0xAC, 0xEE, 0xEC, 0x8D, 0x47,
-    0x17, 0xAA, 0x07, 0x4C, 0x97, 0x88, 0x2B, 0x31, 0x53, 0x04, 0x7F, 0xE0, 0x02, 0x6C, 0x48, 0x2E,
-    0xC8, 0xE8, 0x0D, 0x90, 0x51, 0xFA, 0x21, 0xA5, 0x37, 0xBD, 0x1B, 0xDD, 0x30, 0xAB, 0x17, 0xAE,
-    0xD6, 0xCB, 0x60, 0x35, 0x9C, 0x3F, 0xA9, 0x0F, 0x62, 0x54, 0x9E, 0x88, 0x09, 0x2F, 0x74, 0x5E,
-    0x1B, 0x96, 0x8F, 0x9A, 0xBF, 0x9A, 0x81, 0xE0, 0x31, 0x8E, 0x03, 0x56, 0x40, 0x8F, 0x76, 0x24,
-    0x6A, 0x6E, 0xF1, 0x2D, 0x66, 0xB5, 0x52, 0x29, 0x11, 0x30, 0xE2, 0x83, 0x61, 0x6C, 0x48, 0x00,
-    0x4D, 0x9D, 0x16, 0x34, 0x29, 0x80, 0x43, 0x1D, 0x3B, 0xB7, 0x19, 0xFC, 0x6A, 0xBF, 0x9B, 0xAA,
-    0x6B, 0x5C, 0x40, 0x8C, 0x88, 0xBC, 0xBE, 0xA4, 0xA5, 0xCF, 0x6E, 0xEE, 0xAF, 0xA0, 0xC5, 0x25,
-    0x15, 0x7B, 0xF0, 0xDD, 0x3C, 0x3E, 0xB3, 0x25, 0x09, 0x75, 0xF4, 0x63, 0x19, 0x60, 0xB0, 0x57,
-    0x59, 0x3D, 0xF0, 0x7B, 0xF8, 0x75, 0x40, 0x55, 0xE4, 0x86, 0x25, 0x4C, 0xC0, 0x88, 0xC1, 0xEF,
-    0x0B, 0xDA, 0x48, 0x0D, 0xF2, 0x99, 0xD2, 0x47, 0xB4, 0x27, 0xFE, 0x00, 0xFA, 0x38, 0x12, 0x31,
-    0x34, 0x7F, 0x0F, 0x60, 0x44, 0x0D, 0x18, 0xE8, 0xF7, 0x1E, 0x7D, 0x86, 0x49, 0x06, 0xA7, 0xB8,
-    0xE8, 0xC9, 0x05, 0x92, 0x66, 0xD4, 0x82, 0x00, 0xF7, 0x63, 0xA9, 0xF8, 0xD8, 0xE4, 0xA4, 0x4C,
-    0x5C, 0x4D, 0x65, 0x57, 0x96, 0x1C, 0xB5, 0xDA, 0x68, 0x2C, 0x51, 0xD5, 0x5C, 0xD3, 0x7B, 0x51,
-    0x18, 0x96, 0xAC, 0x6D, 0x9E, 0xEA, 0xDD, 0xE4, 0xD0, 0xCC, 0x5C, 0xC7, 0x52, 0xC2, 0x51, 0x03,
-    0xA3, 0x92, 0xD2, 0xE6, 0x71, 0x77, 0x10, 0x2B, 0xBA, 0x46, 0x88, 0x84, 0xB4, 0x85, 0x1C, 0xFA,
-    0xAC, 0x14, 0x47, 0x0D, 0xC9, 0xF4, 0x1E, 0x49, 0xEB, 0x52, 0xF1, 0x3D, 0xFA, 0x07, 0x5F, 0x5E,
-    0x43, 0xB8, 0x30, 0x5A, 0x19, 0xD2, 0x2D, 0x55, 0x02, 0x82, 0x66, 0x0A, 0x44, 0xCE, 0x4C, 0xE0,
-    0x3D, 0x38, 0x87, 0x09, 0xB4, 0x7A, 0x56, 0x6A, 0x19, 0xA0, 0x20, 0x54, 0x69, 0xC4, 0xED, 0x88,
-    0x76, 0x52, 0x93, 0x5C, 0x6A, 0x6D, 0xD5, 0xC1, 0xA3, 0x33, 0x09, 0x37, 0x80, 0x6C, 0xF2, 0x19,
-    0x60, 0x84, 0x96, 0x1B, 0x0A, 0x1A, 0xEE, 0x0A, 0xB1, 0x33, 0x88, 0x4C, 0xBB, 0xD5, 0xCF, 0xB6,
-    0x34, 0x96, 0x1A, 0x4E, 0x6F, 0x15, 0x00, 0x84, 0x33, 0xEE, 0x98, 0x9A, 0xB9, 0x5C, 0x59, 0xF6,
-    0xF4, 0x8C, 0x52, 0x8C, 0x59, 0xED, 0xA6, 0x24, 0x73, 0x2B, 0xA7, 0xFC, 0xFE, 0x89, 0x77, 0x30,
-    0xB1, 0x9F, 0x89, 0xEA, 0x8D, 0xB2, 0xCE, 0x14, 0xBB, 0x4A, 0x59, 0x74, 0xD1, 0x86, 0x59, 0xB3,
-    0x6A, 0x14, 0x0F, 0x88, 0x69, 0x56, 0xA1, 0x5B, 0x95, 0x77, 0x53, 0x43, 0x56, 0x67, 0xF2, 0x91,
-    0xF5, 0x2B, 0xF7, 0x08, 0xC8, 0x79, 0x35, 0xBC, 0xB4, 0x5C, 0x51, 0x01, 0x19, 0x67, 0x8C, 0xB1,
-    0x3C, 0x81, 0x8A, 0x16, 0x60, 0xC6, 0x4D, 0x82, 0x9C, 0xC0, 0x9F, 0xFB, 0x32, 0x14, 0x1A, 0xBB,
-    0x2D, 0x43, 0xB1, 0x60, 0x4A, 0xC2, 0x0A, 0xCB, 0xC2, 0x0A, 0xA7, 0xB3, 0x12, 0x95, 0x06, 0x9C,
-    0x21, 0x2C, 0xE1, 0x7A, 0x03, 0xB1, 0x65, 0x41, 0xEB, 0x49, 0xC0, 0xF9, 0x10, 0xCD, 0xD7, 0xCD,
-    0xA1, 0x16, 0xD0, 0x74, 0xD7, 0x59, 0xE5, 0x76, 0x98, 0x18, 0x97, 0x66, 0xF9, 0x34, 0x73, 0xE1,
-    0xC6, 0xEC, 0x5D, 0x08, 0xE4, 0xC0, 0x17, 0x72, 0x7E, 0xA3, 0x68, 0x5F, 0xF6, 0x86, 0xD8, 0xC8,
-    0xC1, 0x3C, 0xF9, 0xB0, 0x0C, 0xDB, 0x3D, 0x2C, 0x58, 0x50, 0x68, 0x2A, 0x16, 0xC5, 0xBE, 0xFB,
-    0x03, 0x6B, 0x6C, 0xD2, 0x06, 0x33, 0x6F, 0xFE, 0x7D, 0x64, 0x77, 0x3A, 0x7F, 0x70, 0x6C, 0x09,
-    0x0D, 0x61, 0x4A, 0x83, 0x89, 0x63, 0x37, 0x4B, 0x76, 0x08, 0x7A, 0x8C, 0x5B, 0x0B, 0xFC, 0x43,
-    0x1C, 0x14, 0x80, 0x1B, 0xFF, 0xBB, 0x2D, 0xAC, 0x72, 0xEF, 0x0D, 0x41, 0x6F, 0xDF, 0xCD, 0xF2,
-    0x8D, 0xEE, 0xA3, 0x86, 0x65, 0xA0, 0xB8, 0xA5, 0xFA, 0x0C, 0x6C, 0xA3, 0x95, 0x41, 0xC2, 0xAD,
-    0xF0, 0x3A, 0x53, 0x44, 0x06, 0xC8, 0xFF, 0x01, 0x53, 0x57, 0x1A, 0x2D, 0xD5, 0x68, 0xD9, 0xD8,
-    0x61, 0xDC, 0xC6, 0xA2, 0x94, 0xF9, 0xEF, 0xD9, 0x5D, 0x01, 0x49, 0xBD, 0xDF, 0x90, 0xC4, 0x78,
-    0x30, 0xAC, 0x49, 0xE3, 0x03, 0x84, 0x3F, 0x54, 0x22, 0x2F, 0x30, 0xC0, 0x8D, 0x25, 0x65, 0x70,
-    0xBB, 0xE3, 0xEF, 0x30, 0xCB, 0xBF, 0xB8, 0x41, 0x72, 0x97, 0x35, 0xC6, 0x14, 0x21, 0xF0, 0x03,
-    0x3B, 0xEF, 0x71, 0x10, 0xD9, 0x49, 0x1B, 0x6B, 0x9F, 0xC9, 0xBE, 0x7E, 0x6E, 0xE6, 0x5D, 0x21,
-    0x35, 0x15, 0x4A, 0x1A, 0x5B, 0x72, 0xD8, 0xA9, 0xA8, 0x16, 0x33, 0x40, 0x8C, 0x98, 0x13, 0x86,
-    0xB9, 0x0F, 0x58, 0x49, 0xAE, 0x58, 0x63, 0x49, 0xB0, 0x5D, 0xAF, 0xE3, 0xA8, 0x23, 0x36, 0xCE,
-    0xDD, 0x01, 0x11, 0x55, 0xEE, 0xF6, 0xF0, 0x3C, 0x18, 0x93, 0x96, 0x63, 0xD4, 0x73, 0x0C, 0x84,
-    0xA3, 0x27, 0x19, 0x46, 0x58, 0x5C, 0x8C, 0xA0, 0x1C, 0xC7, 0x44, 0xC7, 0x10, 0xE6, 0x6B, 0x4C,
-    0x03, 0xC9, 0x13, 0xDA, 0xD4, 0x5C, 0x8B, 0x75, 0x5A, 0xE1, 0x9A, 0x57, 0x08, 0x3D, 0x7E, 0x0C,
-    0x49, 0x6B, 0x26, 0x27, 0xD6, 0x55, 0xB2, 0x82, 0x60, 0x8E, 0xEC, 0x80, 0xF5, 0xD0, 0xC2, 0x1A,
-    0x1C, 0x2E, 0x12, 0x70, 0x9A, 0xE7, 0xF4, 0x97, 0xCC, 0x54, 0x3C, 0x56, 0x55, 0xE1, 0x1E, 0x0B,
-    0x0E, 0xD9, 0x0F, 0x0F, 0x45, 0x15, 0x23, 0x64, 0x00, 0xBE, 0xEB, 0x53, 0x9D, 0xF5, 0xC7, 0x26,
-    0x80, 0xAB, 0x57, 0x9A, 0x1C, 0xDA, 0x62, 0xE3, 0xAC, 0xAB, 0xA7, 0x36, 0xDD, 0x1A, 0x75, 0x6B,
-    0x38, 0xEE, 0x09, 0xF6, 0x36, 0x69, 0x55, 0xC3, 0x95, 0xA5, 0x53, 0x22, 0xAB, 0xA4, 0xD7, 0x1B,
-    0x68, 0x67, 0x7D, 0x13, 0x32, 0xCF, 0x2F, 0xF9, 0x95, 0xDF, 0x0E, 0x1A, 0xFA, 0x28, 0x9C, 0x85,
-    0x0A, 0x54, 0x94, 0xFF, 0xA4, 0x04, 0xEA, 0x41, 0xF3, 0x16, 0x04, 0xDE, 0x65, 0xDB, 0xE6, 0x5C,
-    0xCD, 0xBC, 0xB1, 0x64, 0xB0, 0x93, 0xCE, 0xAC, 0xF0, 0x56, 0xE1, 0xE6, 0x2E, 0x53, 0xD3, 0xD7,
-    0xFD, 0x5D, 0x1B, 0x96, 0x5A, 0x66, 0x9A, 0xC2, 0x6C, 0xF1, 0xD1, 0x9C, 0x36, 0x0F, 0x23, 0x47,
-    0x0D, 0xCB, 0xE2, 0x53, 0x69, 0x5D, 0xA8, 0x2B, 0x3C, 0xEF, 0x7E, 0xA6, 0xF1, 0xB6, 0xD6, 0x4C,
-    0xDD, 0x0C, 0x5B, 0xDB, 0xFD, 0x4C, 0xB5, 0x1B, 0xD5, 0xBA, 0x37, 0xF3, 0x21, 0xEA, 0x88, 0x1B,
-    0x13, 0x57, 0x7A, 0x6E, 0x78, 0xEA, 0xFA, 0x46, 0x4C, 0xA8, 0x94, 0x09, 0xCD, 0x36, 0x26, 0x0C,
-    0x96, 0x09, 0x46, 0x99, 0x90, 0x93, 0xD8, 0x45, 0xA5, 0x4C, 0x68, 0x94, 0x09, 0x9D, 0x32, 0x61,
-    0xB0, 0x4C, 0x48, 0x94, 0x09, 0xC5, 0x8D, 0x99, 0xE0, 0xEF, 0x60, 0x42, 0x3A, 0xA1, 0xED, 0x54,
-    0x1C, 0xBD, 0x4D, 0x9B, 0xBC, 0xF4, 0xF3, 0x03, 0x0E, 0xE6, 0xB7, 0xA9, 0x92, 0xDE, 0x45, 0x5A,
-    0x56, 0x91, 0xF2, 0xCF, 0x80, 0x04, 0x9D, 0x12, 0x3E, 0xA9, 0x61, 0x93, 0x49, 0x59, 0xE4, 0xA6,
-    0xDF, 0x77, 0x81, 0x00, 0x2A, 0x03, 0xC1, 0x35, 0x12, 0x47, 0x84, 0xA7, 0x91, 0xAF, 0xC6, 0x56,
-    0xA4, 0x61, 0xC6, 0xAE, 0x19, 0x3F, 0x30, 0x54, 0xD4, 0x56, 0x8A, 0xB6, 0x38, 0x28, 0x43, 0x3B,
-    0x84, 0x74, 0xDF, 0x5B, 0x3A, 0x59, 0x6B, 0xCB, 0x3D, 0xF5, 0xE4, 0x32, 0x98, 0x42, 0xFB, 0xAA,
-    0xED, 0xA1, 0x9A, 0x81, 0x61, 0x0F, 0xEF, 0xE5, 0x09, 0xFD, 0x63, 0xF1, 0x11, 0x96, 0x89, 0xBF,
-    0xC6, 0x32, 0x01, 0x04, 0x96, 0x11, 0x1A, 0x3B, 0xDC, 0x1F, 0x81, 0x71, 0xF1, 0x55, 0x6D, 0x4E,
-    0x26, 0x0D, 0x9C, 0x46, 0x38, 0x6A, 0x37, 0xAD, 0x06, 0x73, 0x62, 0xB9, 0xC2, 0x8E, 0x14, 0x43,
-    0xCF, 0x40, 0x13, 0x15, 0x76, 0xF5, 0x5C, 0xDD, 0x87, 0x42, 0x26, 0x5B, 0x9D, 0xCF, 0x85, 0xD7,
-    0x15, 0x34, 0xC0, 0x58, 0x47, 0xF0, 0xAF, 0x49, 0x1D, 0xF6, 0x59, 0x19, 0x20, 0xFA, 0x43, 0x9C,
-    0xCA, 0xFF, 0xDC, 0xB3, 0xEF, 0x25, 0x23, 0xC2, 0xA0, 0xCF, 0x9A, 0xB0, 0x4D, 0xC6, 0xA2, 0x61,
-    0xB7, 0x50, 0xAB, 0xAC, 0x0F, 0x4F, 0x4B, 0xF9, 0x65, 0xC0, 0xBE, 0xC5, 0x12, 0x9B, 0x16, 0x94,
-    0x01, 0x5F, 0x05, 0x61, 0xFE, 0xB5, 0x76, 0x42, 0xE1, 0x86, 0x01, 0x8C, 0xF6, 0x30, 0x93, 0xF1,
-    0x24, 0xE4, 0x07, 0xA1, 0xB3, 0xB6, 0x07, 0x47, 0x44, 0x77, 0x8E, 0xB0, 0x21, 0x9A, 0x5C, 0x25,
-    0xCC, 0x03, 0xA2, 0x4F, 0x57, 0x56, 0x89, 0xE5, 0xC7, 0x2C, 0xCA, 0x5F, 0x53, 0xD4, 0x8B, 0x0A,
-    0x93, 0x11, 0x3B, 0x97, 0xEB, 0x0C, 0xFC, 0x2B, 0xB6, 0xE3, 0x9A, 0x88, 0x29, 0x20, 0x74, 0xDA,
-    0x96, 0xC9, 0x48, 0x2C, 0x6E, 0xAC, 0xDD, 0x73, 0x76, 0x52, 0xBC, 0xDA, 0xCB, 0xBD, 0x2E, 0x4A,
-    0xF5, 0x48, 0x48, 0xD1, 0x31, 0x05, 0xB8, 0x8B, 0x88, 0x3F, 0xC0, 0x2D, 0x82, 0xFC, 0x08, 0x75,
-    0x2C, 0xCB, 0x4D, 0xD0, 0xC1, 0x6F, 0xF8, 0x1C, 0xBC, 0x86, 0x1D, 0xE0, 0x35, 0xD7, 0x6C, 0x3B,
-    0x82, 0x40, 0x41, 0xC8, 0x8D, 0x1E, 0x1E, 0x08, 0xE5, 0x6D, 0xA9, 0x78, 0x0C, 0xC1, 0xB6, 0x40,
-    0x11, 0xEF, 0x22, 0x59, 0xA1, 0x1A, 0xF5, 0x59, 0x35, 0x21, 0xAE, 0x3C, 0x27, 0xE2, 0x04, 0x82,
-    0x93, 0xC4, 0xED, 0x1C, 0x5B, 0x5B, 0x0C, 0xCB, 0x01, 0x4D, 0xC7, 0xB6, 0xAA, 0xE4, 0x01, 0x95,
-    0x02, 0x61, 0x87, 0x2E, 0x0C, 0x1A, 0x30, 0x3A, 0x98, 0xEA, 0xC6, 0x26, 0x3C, 0x50, 0xAA, 0x15,
-    0x4A, 0xFE, 0x50, 0x99, 0x04, 0x96, 0xFC, 0x74, 0x6C, 0xCC, 0xBB, 0x8F, 0x23, 0x5F, 0xDE, 0x75,
-    0x97, 0xD9, 0x6F, 0xCC, 0xA2, 0xD6, 0xA2, 0xB4, 0x0E, 0x47, 0x51, 0xDE, 0x64, 0x2B, 0x24, 0x80,
-    0xA9, 0x6D, 0x5C, 0xF6, 0x20, 0x93, 0xC6, 0x69, 0x20, 0xA5, 0xF8, 0x5B, 0x4B, 0x2A, 0x6D, 0x6B,
-    0x21, 0x3E, 0xE5, 0x1B, 0x38, 0x9D, 0x6C, 0x9E, 0x48, 0xF9, 0xC6, 0x32, 0x97, 0xBE, 0xE9, 0xA7,
-    0xAF, 0x56, 0xF4, 0xBB, 0x46, 0x63, 0x1D, 0xBC, 0xED, 0xB1, 0x8F, 0x9F, 0x8A, 0xB9, 0x98, 0xE9,
-    0x43, 0x5D, 0x1A, 0xC6, 0x81, 0x1B, 0xF5, 0xDA, 0x81, 0x01, 0xEA, 0x4B, 0x16, 0x08, 0xDB, 0xE6,
-    0x60, 0x0F, 0xFC, 0x85, 0x14, 0x10, 0xBD, 0xA2, 0xF5, 0xC1, 0x91, 0x59, 0xD5, 0x1F, 0x65, 0x7C,
-    0xA9, 0x07, 0x9A, 0xA3, 0x91, 0x08, 0x62, 0x63, 0x12, 0x90, 0x39, 0x2B, 0x43, 0xD0, 0x39, 0x62,
-    0x28, 0x47, 0xE5, 0x10, 0xC0, 0x2A, 0x2B, 0x2B, 0xCF, 0xF1, 0x0B, 0xA6, 0x98, 0x3C, 0x08, 0x02,
-    0xC4, 0x11, 0xE7, 0x84, 0x72, 0x52, 0xB4, 0xFB, 0x7F, 0x8D, 0x89, 0x38, 0xBB, 0xF1, 0x35, 0x29,
-    0xB0, 0x32, 0xA7, 0x81, 0x7A, 0x52, 0x3D, 0x07, 0x13, 0x68, 0xBD, 0x55, 0x13, 0xAE, 0x61, 0x72,
-    0x63, 0xF6, 0xB5, 0xB2, 0xA2, 0x5D, 0xB1, 0x4E, 0xFB, 0xAA, 0xA5, 0x59, 0xDD, 0x2C, 0x6C, 0xFE,
-    0x97, 0x32, 0xFF, 0xAB, 0x09, 0x4C, 0x87, 0xCC, 0x0B, 0x31, 0xA0, 0xCF, 0x8C, 0x5F, 0x53, 0x2F,
-    0x84, 0x76, 0x18, 0x22, 0xEA, 0xAD, 0xCF, 0xC1, 0x11, 0x5A, 0xDE, 0x6C, 0x5D, 0x93, 0x61, 0x10,
-    0xC3, 0xEF, 0x41, 0x68, 0x66, 0x9F, 0x0D, 0xD2, 0xC7, 0x90, 0x51, 0x5D, 0x2E, 0x1D, 0x58, 0xAA,
-    0x40, 0x4C, 0x27, 0x8D, 0xFC, 0x54, 0x3D, 0x6A, 0x0C, 0xE1, 0xEC, 0x34, 0x36, 0x63, 0x8F, 0xCF,
-    0xB6, 0x15, 0x17, 0xD2, 0xC3, 0x71, 0x97, 0x9D, 0x93, 0x0F, 0xFA, 0x5F, 0xB2, 0x66, 0x35, 0x1E,
-    0xF7, 0x64, 0xDE, 0x09, 0xFC, 0xD6, 0x9B, 0xAF, 0x56, 0x24, 0xD5, 0xC3, 0x65, 0x3F, 0x06, 0x2E,
-    0x7A, 0xD6, 0xC9, 0xB3, 0xF1, 0xE4, 0x3C, 0x68, 0xD3, 0x80, 0xC5, 0x1E, 0x40, 0x52, 0xCE, 0x1F,
-    0x5A, 0x7C, 0x46, 0x5E, 0xEB, 0xB3, 0x5E, 0xCE, 0x16, 0x02, 0x78, 0x2E, 0xE7, 0xB4, 0x90, 0xE3,
-    0x77, 0x20, 0x95, 0xB1, 0x7F, 0xDE, 0x4E, 0x66, 0x71, 0x11, 0x6C, 0x1C, 0x6C, 0x65, 0x7D, 0xD4,
-    0xDA, 0x39, 0x97, 0x85, 0xD3, 0x76, 0x4B, 0x1F, 0xB6, 0xAD, 0xE7, 0x4E, 0xF1, 0xB9, 0x66, 0x72,
-    0x27, 0x2C, 0x74, 0xB0, 0x18, 0x75, 0xDD, 0xA9, 0x08, 0x7B, 0x50, 0x00, 0x51, 0xF8, 0x65, 0xDC,
-    0x15, 0x35, 0x21, 0x29, 0x60, 0x98, 0x48, 0xCF, 0xC8, 0xD2, 0x62, 0xD2, 0xEF, 0x27, 0x64, 0x0B,
-    0x0D, 0xF6, 0x87, 0xA9, 0x42, 0xC0, 0xDC, 0xDB, 0x11, 0x26, 0xBC, 0x59, 0x69, 0x2B, 0x04, 0x1D,
-    0x26, 0x5D, 0x29, 0x17, 0x65, 0x2D, 0x41, 0xB8, 0x3E, 0x7A, 0xF2, 0x19, 0xC8, 0x12, 0xB7, 0x36,
-    0xE0, 0x70, 0xF2, 0xDD, 0x26, 0xF1, 0x1A, 0xB7, 0x3B, 0x6D, 0xC2, 0x2B, 0xB9, 0x6A, 0xCC, 0x30,
-    0xEF, 0x13, 0xDE, 0x01, 0x21, 0x8C, 0xF9, 0x1B, 0x4B, 0x58, 0xC2, 0x80, 0x6F, 0x65, 0x6D, 0x9E,
-    0x7F, 0xEF, 0xFB, 0x4F, 0x35, 0x66, 0x05, 0xCB, 0x01, 0x2F, 0x42, 0x9D, 0x7C, 0x18, 0xAF, 0x10,
-    0xE6, 0xFB, 0x29, 0x36, 0xF0, 0x92, 0x31, 0x9D, 0xA5, 0x2E, 0x0D, 0xDE, 0x59, 0x8B, 0x06, 0x57,
-    0xE5, 0x43, 0x20, 0xFF, 0x26, 0x92, 0xFF, 0xCC, 0x84, 0x5F, 0xC1, 0x91, 0x9E, 0x93, 0xB7, 0x47,
-    0x08, 0x41, 0xCD, 0x63, 0x54, 0xCE, 0xA4, 0x40, 0x8D, 0x06, 0x7E, 0x30, 0x9F, 0x10, 0x52, 0xB0,
-    0xD5, 0x9B, 0xD7, 0xAB, 0x16, 0x5F, 0xA7, 0x53, 0x61, 0x65, 0xBA, 0xCC, 0xC2, 0x26, 0x58, 0x1F,
-    0x9C, 0x35, 0x08, 0x5D, 0x4C, 0x5F, 0xC7, 0xFA, 0x7F, 0x83, 0xFC, 0xE2, 0x88, 0x91, 0xD5, 0x3C,
-    0xFE, 0xA8, 0x8B, 0xAE, 0x0A, 0x73, 0x11, 0x55, 0x4C, 0x13, 0xD4, 0xEA, 0x94, 0xE9, 0x8B, 0x92,
-    0x10, 0x50, 0x86, 0xE5, 0xD4, 0xE2, 0x5C, 0x3C, 0x91, 0x3A, 0xBA, 0xBD, 0xBC, 0x27, 0xFF, 0x2B,
-    0x61, 0xE7, 0xC0, 0xDB, 0x7A, 0xC4, 0xE2, 0x80, 0x46, 0x33, 0x6B, 0xCC, 0x18, 0xB5, 0x97, 0x18,
-    0x69, 0x1D, 0x9D, 0xEE, 0xA9, 0x3D, 0x66, 0xB2, 0x4B, 0xB5, 0x91, 0x37, 0x4B, 0x6F, 0xC8, 0x72,
-    0xEC, 0x73, 0x59, 0x5E, 0x83, 0xEC, 0x07, 0xDA, 0xEC, 0x4E, 0xB5, 0xE8, 0x04, 0xA1, 0x01, 0x05,
-    0x82, 0x2B, 0x95, 0xF7, 0x49, 0xEF, 0x35, 0x91, 0xF9, 0x95, 0x25, 0xD8, 0xBE, 0x65, 0xA3, 0x25,
-    0xFC, 0x46, 0xB0, 0x4D, 0x19, 0x87, 0xED, 0xE2, 0x01, 0xED, 0x17, 0xE5, 0x81, 0x1A, 0xA6, 0xD2,
-    0x14, 0x5F, 0x41, 0x49, 0xCE, 0x98, 0x62, 0xB5, 0x06, 0x61, 0x90, 0x9C, 0x43, 0x43, 0x56, 0xEE,
-    0x0D, 0x99, 0x8F, 0xDB, 0x53, 0x6E, 0x4B, 0xAD, 0x55, 0x9C, 0xCC, 0x46, 0x87, 0x8F, 0xDE, 0x3E,
-    0x90, 0xBB, 0x53, 0xC6, 0x3F, 0x4E, 0xA1, 0xAA, 0x02, 0x7A, 0xE3, 0xCF, 0x5D, 0x43, 0x3A, 0x15,
-    0xE4, 0x71, 0x7A, 0xC6, 0x24, 0xBF, 0x87, 0xB8, 0x8F, 0xF6, 0x24, 0x60, 0x62, 0xEE, 0x11, 0xE5,
-    0x17, 0xCD, 0x13, 0x7E, 0x95, 0x98, 0x21, 0x61, 0x9F, 0x9C, 0x26, 0x06, 0xE2, 0x63, 0xAC, 0xA4,
-    0xDE, 0x2E, 0xE5, 0xA7, 0xA3, 0x0B, 0xB2, 0x6D, 0x48, 0x25, 0x3F, 0x93, 0x98, 0xD9, 0x70, 0xFA,
-    0x41, 0x0C, 0x87, 0x8D, 0x8D, 0xFA, 0x6F, 0x65, 0x58, 0x94, 0x8B, 0x5C, 0x7A, 0x98, 0x0D, 0xF6,
-    0xF5, 0x8F, 0x66, 0xBA, 0x45, 0xFB, 0x84, 0xDA, 0xB0, 0xD3, 0x26, 0xBD, 0x46, 0xF3, 0x6F, 0x99,
-    0x49, 0x2F, 0x22, 0xDA, 0x47, 0x3A, 0xB9, 0xE7, 0x44, 0x3E, 0x2C, 0x36, 0x8F, 0x69, 0xE5, 0x53,
-    0x7D, 0x28, 0x8C, 0xE8, 0xCE, 0x0F, 0x83, 0xE3, 0x68, 0xFF, 0xA1, 0xF6, 0xAD, 0x2E, 0x2C, 0xAE,
-    0xA9, 0x8A, 0xAF, 0x32, 0x36, 0xA1, 0xC1, 0xA2, 0x55, 0x3B, 0xC6, 0x4C, 0xFD, 0x29, 0x72, 0x86,
-    0xB6, 0xE7, 0x42, 0x3B, 0x6B, 0xD0, 0xB9, 0x0A, 0xC9, 0xD1, 0x9D, 0x29, 0xD5, 0x7D, 0xA2, 0x85,
-    0x57, 0xA9, 0x97, 0x3A, 0xCA, 0x93, 0x18, 0xD1, 0xB9, 0x32, 0xBC, 0x5A, 0xF9, 0xFD, 0x1E, 0x98,
-    0x4D, 0x44, 0x17, 0x17, 0xA0, 0xD8, 0x27, 0xC7, 0xE3, 0xDF, 0x85, 0x30, 0x3F, 0xA4, 0x3C, 0x95,
-    0x1A, 0x4A, 0xC7, 0x73, 0x0D, 0x0B, 0xCB, 0xB7, 0x03, 0x7A, 0x26, 0xE3, 0x6C, 0xB8, 0x25, 0xD0,
-    0x7F, 0x80, 0x3D, 0x6E, 0xB1, 0xB9, 0x06, 0x81, 0x7D, 0x44, 0x0E, 0x7D, 0x17, 0x7B, 0xAC, 0x27,
-    0xF6, 0xFB, 0xBF, 0x26, 0xC4, 0x23, 0x2D, 0xFB, 0x26, 0x59, 0xE1, 0x9D, 0xB5, 0xF9, 0x5C, 0xBA,
-    0x23, 0x77, 0xC8, 0xD8, 0x13, 0x1A, 0xF0, 0x7C, 0x21, 0xE7, 0x8B, 0xD6, 0xBC, 0xD4, 0xD1, 0x44,
-    0x27, 0x25, 0xBD, 0xB6, 0xF0, 0x14, 0xA1, 0xD7, 0xD3, 0x0B, 0x20, 0x07, 0xBC, 0x85, 0x69, 0xC0,
-    0x8E, 0xF8, 0x9A, 0xD5, 0x6E, 0x06, 0xA6, 0x9E, 0x4C, 0x07, 0x9C, 0x35, 0x6F, 0xA8, 0xED, 0x41,
-    0x65, 0xC6, 0x0C, 0x3C, 0x7C, 0xDB, 0x34, 0xB6, 0x54, 0x6C, 0x8E, 0x30, 0xE3, 0xD9, 0x1B, 0x5C,
-    0x97, 0x7F, 0xB3, 0x27, 0x11, 0x20, 0x88, 0xEB, 0x23, 0x49, 0x57, 0xFB, 0x45, 0x49, 0xE9, 0xFB,
-    0x6E, 0x6A, 0x18, 0x5D, 0x0D, 0x2E, 0x64, 0xCD, 0xD5, 0x33, 0x49, 0x45, 0x9F, 0x81, 0x8F, 0x2C,
-    0xDD, 0x5B, 0x9F, 0x14, 0xCE, 0x8E, 0xB5, 0x37, 0xE6, 0x5B, 0x2F, 0x9F, 0x47, 0xD3, 0xE4, 0x63,
-    0xE6, 0x9A, 0xC3, 0x92, 0xA4, 0x0B, 0x92, 0xDF, 0x26, 0x1D, 0xB6, 0x4D, 0x43, 0xEC, 0x40, 0x8A,
-    0x00, 0x21, 0xCC, 0x40, 0xDA, 0x24, 0xD3, 0x69, 0x77, 0x46, 0x00, 0x2A, 0x21, 0xCE, 0xAF, 0xCD,
-    0x04, 0x4F, 0xA6, 0x07, 0x33, 0xBE, 0x0D, 0xD9, 0x5D, 0xA7, 0x84, 0x15, 0x85, 0x30, 0xFD, 0x0B,
-    0xEE, 0xFC, 0x6F, 0x5B, 0x07, 0xFC, 0x0B, 0x3D, 0x8E, 0xF4, 0xA8, 0xF9, 0x89, 0x08, 0xCA, 0xAE,
-    0xE9, 0x44, 0x9E, 0xC9, 0x9E, 0x69, 0x66, 0x95, 0xC8, 0x50, 0xA6, 0xB3, 0x3E, 0xF7, 0x90, 0x3C,
-    0x36, 0xBF, 0x53, 0x40, 0x82, 0x7F, 0x27, 0x61, 0x9E, 0x64, 0xED, 0xC8, 0xB4, 0x4F, 0xD1, 0xB8,
-    0x7C, 0xDD, 0xCC, 0x4F, 0xC8, 0x3B, 0x13, 0x1C, 0xD0, 0xC3, 0x2A, 0x63, 0x44, 0x8F, 0xA5, 0xFE,
-    0x56, 0x2A, 0x27, 0xAB, 0xEF, 0x88, 0x3C, 0x76, 0x3A, 0x43, 0x7A, 0x94, 0xBA, 0x23, 0x83, 0x65,
-    0x84, 0x69, 0xE1, 0x74, 0xAA, 0x5E, 0x6B, 0x03, 0x6A, 0x43, 0x5E, 0x98, 0x6B, 0xB4, 0x56, 0x6C,
-    0x02, 0x04, 0x6E, 0x26, 0x62, 0x80, 0x19, 0x31, 0xEA, 0xD1, 0xAB, 0xF0, 0x4A, 0x6A, 0x43, 0xD1,
-    0x7B, 0x49, 0x2E, 0x47, 0xE3, 0xA1, 0xC8, 0xB0, 0x5F, 0x37, 0xB0, 0x6A, 0x14, 0x36, 0x7A, 0xE8,
-    0x98, 0x75, 0xC0, 0xA0, 0xDA, 0x8F, 0xEF, 0x7E, 0xB6, 0x2D, 0x77, 0xF9, 0x09, 0x90, 0xCB, 0xA9,
-    0x7F, 0xC7, 0x80, 0x9B, 0x65, 0xF2, 0x86, 0xDF, 0x7F, 0xDA, 0xB1, 0xF1, 0x40, 0xC0, 0x49, 0x38,
-    0xC7, 0x49, 0xEF, 0x29, 0xB9, 0xEE, 0x09, 0x01, 0x8A, 0x2D, 0x02, 0x78, 0x4A, 0x80, 0x40, 0x7F,
-    0x7F, 0x11, 0x32, 0xB1, 0xB2, 0x49, 0x92, 0x31, 0xCF, 0xAB, 0x65, 0xD1, 0x10, 0xCA, 0x76, 0xFC,
-    0x6C, 0xA1, 0x36, 0xB2, 0x2D, 0xC1, 0xCE, 0x98, 0xF9, 0xC1, 0xEF, 0xBB, 0x87, 0x75, 0x42, 0xAC,
-    0x6D, 0x2C, 0x32, 0xDF, 0xDC, 0x96, 0x68, 0xB5, 0xAD, 0x38, 0x3F, 0xFF, 0xE8, 0xCF, 0x4A, 0x7E,
-    0xD1, 0x56, 0x3D, 0x5B, 0x5F, 0x83, 0x76, 0xA2, 0x0D, 0xDB, 0xBE, 0x0A, 0x77, 0xEE, 0xA6, 0xDF,
-    0x36, 0xDC, 0x48, 0x38, 0xFC, 0xD6, 0x95, 0x11, 0x56, 0x34, 0xE8, 0x5C, 0x1E, 0x54, 0xA4, 0xE5,
-    0xCE, 0x1A, 0x4F, 0x69, 0x14, 0x83, 0x5C, 0x69, 0xC4, 0xD6, 0xB5, 0x83, 0x84, 0x87, 0xD5, 0x42,
-    0x43, 0xAF, 0x49, 0x30, 0xF8, 0x9E, 0x16, 0x3C, 0x58, 0x94, 0x49, 0xAE, 0x39, 0xCC, 0xE9, 0xA2,
-    0xA4, 0x3F, 0x6E, 0xFA, 0xE4, 0x3D, 0x26, 0xBA, 0x57, 0xFB, 0x44, 0x85, 0xE3, 0xEB, 0x2E, 0xFE,
-    0x92, 0xE1, 0xEE, 0x37, 0x4D, 0x78, 0x8D, 0xC7, 0x69, 0x19, 0x21, 0xD4, 0x34, 0x03, 0xB5, 0x46,
-    0x3B, 0x1E, 0xCF, 0x98, 0x97, 0x7A, 0xFA, 0xC7, 0x9B, 0xB9, 0x77, 0xDB, 0x58, 0x67, 0x21, 0x6E,
-    0x67, 0xF1, 0xDF, 0x92, 0xB7, 0xB4, 0xFE, 0x46, 0x3F, 0x8C, 0x8A, 0x72, 0x7C, 0x50, 0x73, 0xD0,
-    0x7A, 0xBF, 0x6D, 0x6F, 0xA4, 0xD7, 0xBB, 0xA6, 0x3E, 0xA8, 0x12, 0x44, 0x1F, 0x39, 0x12, 0xB7,
-    0x4A, 0xCA, 0xB0, 0xF1, 0x5B, 0xA6, 0x73, 0x00, 0x3E, 0xA9, 0x92, 0x2E, 0xAC, 0x5D, 0xCC, 0x97,
-    0x3C, 0x3D, 0x75, 0xB4, 0x8F, 0x4A, 0x23, 0xE1, 0x9B, 0x1F, 0x42, 0x04, 0xDA, 0x76, 0x04, 0xC1,
-    0x93, 0x37, 0x83, 0x2F, 0x99, 0x9B, 0x35, 0xD9, 0x69, 0xFE, 0xA8, 0x47, 0x01, 0x05, 0xE2, 0x44,
-    0xAB, 0xB7, 0x25, 0xC7, 0x3C, 0xDC, 0xE6, 0x73, 0x94, 0x45, 0x9A, 0x92, 0xC6, 0x44, 0x21, 0xFE,
-    0x3D, 0x5D, 0x55, 0xFE, 0x32, 0x90, 0x4B, 0x17, 0x76, 0xFA, 0x85, 0xA6, 0x90, 0x93, 0xD2, 0xC5,
-    0x72, 0x5E, 0xF4, 0x18, 0x7C, 0x6F, 0x29, 0x1C, 0xB1, 0xE0, 0x12, 0x72, 0x43, 0xE6, 0x7D, 0xC5,
-    0x3A, 0xC9, 0xB6, 0xC1, 0xD3, 0x23, 0x5A, 0x40, 0x4D, 0xC6, 0xB9, 0xF5, 0xB4, 0xC7, 0x0D, 0x9A,
-    0xE9, 0x17, 0x64, 0xDB, 0x26, 0x8B, 0x0D, 0x55, 0x11, 0x3E, 0xAE, 0xA5, 0xA8, 0x43, 0x53, 0x01,
-    0x9A, 0x29, 0x80, 0xC7, 0xC3, 0x55, 0xA4, 0x96, 0xD3, 0x85, 0x39, 0x80, 0xDA, 0xB5, 0xC3, 0xAE,
-    0x3C, 0x2B, 0x97, 0x78, 0xF0, 0xE8, 0x80, 0xF0, 0x48, 0x27, 0x8B, 0xF4, 0xC0, 0x11, 0x64, 0x69,
-    0x81, 0x61, 0x52, 0x27, 0xC8, 0x76, 0x78, 0x2A, 0x4B, 0x90, 0xB6, 0xB8, 0x48, 0x6F, 0xB0, 0x67,
-    0x37, 0x2B, 0xAE, 0xEB, 0x8F, 0x9D, 0x14, 0x18, 0x16, 0x04, 0x9C, 0xE9, 0xA4, 0x1B, 0xE9, 0xB3,
-    0xAF, 0xD0, 0x8A, 0x20, 0xDB, 0xF0, 0xB8, 0x70, 0x37, 0x74, 0xAB, 0xDD, 0xE9, 0x71, 0xDE, 0x51,
-    0xE4, 0xC6, 0x1B, 0x78, 0x90, 0x42, 0x8D, 0xDD, 0xC2, 0xF6, 0x23, 0xD6, 0x84, 0xE6, 0xAC, 0x8C,
-    0x85, 0xD4, 0x05, 0xA0, 0xAA, 0x78, 0xF8, 0x01, 0xDA, 0xCB, 0x5E, 0x56, 0xA6, 0xF4, 0xE7, 0x0F,
-    0x28, 0x22, 0x16, 0x87, 0x98, 0x43, 0x25, 0x97, 0x1A, 0x32, 0x99, 0xFB, 0x2B, 0xC6, 0xD7, 0x53,
-    0xE4, 0x3A, 0x32, 0xB9, 0x8C, 0x1C, 0xF9, 0x73, 0xA4, 0xC9, 0x5F, 0xEA, 0xAB, 0xB2, 0x7A, 0xCD,
-    0x3B, 0xF8, 0xA3, 0x34, 0x8F, 0x1D, 0xED, 0xE5, 0x1D, 0xE1, 0x0D, 0xD2, 0x25, 0x04, 0xC0, 0xAC,
-    0xD7, 0xC7, 0x79, 0x30, 0x06, 0x95, 0x2F, 0x4E, 0x63, 0xCF, 0x5B, 0xA4, 0xF6, 0xE4, 0xB3, 0xFE,
-    0x57, 0xB6, 0x29, 0xA2, 0x3F, 0x1A, 0xB2, 0x07, 0x95, 0x0F, 0x43, 0x2D, 0x13, 0x6C, 0x1F, 0xBD,
-    0x3F, 0x9A, 0xF0, 0x4B, 0x56, 0xC9, 0xC4, 0x9E, 0x07, 0xDE, 0x26, 0xDC, 0xEA, 0x73, 0x72, 0x4D,
-    0x37, 0x82, 0x59, 0xA6, 0xD6, 0x5C, 0x67, 0xF4, 0x47, 0x80, 0xD0, 0xC7, 0x97, 0xA5, 0x3E, 0xE5,
-    0x89, 0x5B, 0x27, 0x8D, 0xC3, 0x7D, 0xA3, 0x16, 0x5F, 0xD9, 0x5F, 0xC7, 0x48, 0xF9, 0x18, 0x82,
-    0xDA, 0x26, 0xAB, 0xC3, 0x75, 0x39, 0xC1, 0xD3, 0x30, 0x7D, 0x3C, 0x47, 0x2F, 0x9D, 0x35, 0x78,
-    0xA6, 0x1F, 0xBA, 0xF8, 0xDD, 0xCE, 0x13, 0xED, 0x04, 0x86, 0x18, 0x7E, 0x48, 0x0C, 0xCF, 0x00,
-    0xE8, 0x38, 0x8D, 0x7A, 0xBF, 0xE4, 0xB2, 0xC1, 0x60, 0x75, 0xCD, 0x13, 0xDB, 0x44, 0xD1, 0xDC,
-    0x64, 0x0B, 0x53, 0x67, 0x0D, 0x62, 0xC5, 0xF2, 0x77, 0xC6, 0xB2, 0xE0, 0x07, 0x78, 0xFE, 0x33,
-    0xAE, 0x91, 0xC9, 0xD4, 0x5D, 0xE2, 0x79, 0x49, 0x32, 0x7A, 0xB4, 0x65, 0xFA, 0x9D, 0xA1, 0x2A,
-    0x33, 0x63, 0xDC, 0x7A, 0x76, 0x3C, 0x39, 0x06, 0x65, 0xD2, 0x3C, 0x8E, 0x4D, 0xF6, 0xC4, 0xAD,
-    0xF6, 0x55, 0x23, 0xFB, 0x03, 0x99, 0xB0, 0x77, 0xF3, 0xA2, 0x8A, 0xC0, 0xF8, 0x3E, 0xD9, 0x3C,
-    0xD9, 0x08, 0xC5, 0x62, 0x76, 0xF2, 0xE7, 0x98, 0x5B, 0x9B, 0xA3, 0x6E, 0x67, 0x42, 0x18, 0x19,
-    0x3D, 0x47, 0xAD, 0xE6, 0xAF, 0xBF, 0x1F, 0x58, 0x39, 0xF9, 0x5F, 0x22, 0x3D, 0x22, 0x5B, 0xE1,
-    0x39, 0x4E, 0x5B, 0x8E, 0x17, 0x3B, 0x48, 0x9A, 0xF1, 0x60, 0xB8, 0x48, 0xB0, 0x59, 0x74, 0x31,
-    0x16, 0x7E, 0x17, 0x9B, 0xA6, 0x88, 0xDA, 0x58, 0x8B, 0x44, 0xC8, 0xAE, 0xE5, 0xBD, 0x66, 0x37,
-    0x38, 0x78, 0x24, 0xEA, 0x90, 0x7B, 0x5F, 0x2E, 0xD6, 0x79, 0xB3, 0xFA, 0x1B, 0x2D, 0xD5, 0x73,
-    0x81, 0x9C, 0xE9, 0x75, 0xF6, 0xC7, 0xC1, 0x1B, 0x9D, 0x26, 0x6C, 0xF5, 0x04, 0x2B, 0x35, 0x8A,
-    0x47, 0x4A, 0x22, 0x5B, 0xBE, 0xFD, 0xE1, 0x8F, 0x01, 0x7F, 0x04, 0xCA, 0x16, 0x10, 0xAE, 0xFF,
-    0x1F, 0x5D, 0x51, 0xB1, 0x6E, 0xD4, 0x40, 0x10, 0x7D, 0xB6, 0x63, 0x2C, 0x65, 0x8B, 0xBD, 0x02,
-    0x8A, 0x18, 0xE5, 0x4C, 0xE1, 0x82, 0x02, 0xB2, 0x0D, 0x05, 0xC5, 0xC5, 0xBB, 0xE4, 0x0A, 0x8A,
-    0x34, 0x29, 0xF8, 0x00, 0x0A, 0x3E, 0x80, 0x82, 0x22, 0xC5, 0x05, 0x5B, 0xA1, 0xA0, 0x48, 0x93,
-    0x3F, 0x20, 0x3D, 0x3F, 0x40, 0x71, 0xC1, 0xBE, 0x5C, 0x41, 0x6B, 0xA0, 0x48, 0x19, 0x4B, 0x41,
-    0x4A, 0x91, 0x22, 0xAB, 0xC8, 0xC5, 0x46, 0x99, 0xBD, 0x65, 0x0F, 0x22, 0x21, 0xF1, 0x34, 0xC5,
-    0x68, 0xDE, 0x8C, 0xF4, 0xDE, 0x3C, 0xE0, 0x59, 0xD4, 0x73, 0x9D, 0x69, 0xDE, 0xB1, 0x0A, 0xC0,
-    0x73, 0xFE, 0xDD, 0xCA, 0x83, 0x6E, 0xD7, 0xB7, 0xAF, 0x20, 0x9A, 0xC4, 0x61, 0x41, 0x62, 0xFB,
-    0xB4, 0x2B, 0x72, 0xA8, 0x54, 0x7D, 0x5C, 0x6C, 0xD4, 0xEE, 0xF2, 0xC0, 0x3E, 0x4A, 0x55, 0xE9,
-    0xAE, 0x9C, 0xAB, 0x5D, 0x37, 0x00, 0xAB, 0x56, 0xDD, 0xCB, 0x0B, 0x47, 0xD9, 0x02, 0x31, 0x56,
-    0xC7, 0x54, 0xFE, 0xA4, 0xA1, 0xF2, 0xF7, 0x62, 0xDF, 0xC8, 0x39, 0xF9, 0x1A, 0xBE, 0xF8, 0x15,
-    0xEC, 0x48, 0x5A, 0xD4, 0x46, 0xBE, 0x29, 0x02, 0xE2, 0x5D, 0x52, 0x85, 0x9E, 0xE7, 0x7D, 0x61,
-    0xBF, 0x14, 0x46, 0x4C, 0x37, 0x4A, 0xCA, 0x34, 0x96, 0x78, 0xCA, 0x15, 0x49, 0x76, 0x6D, 0x24,
-    0x9F, 0x99, 0xBD, 0x64, 0xD6, 0xAD, 0x04, 0xC8, 0xC3, 0x4F, 0xCD, 0x71, 0x9D, 0x7D, 0xB8, 0xD5,
-    0xDC, 0x42, 0x56, 0xD8, 0x59, 0xEE, 0x4D, 0x86, 0x91, 0x26, 0x76, 0x6E, 0xF8, 0x5C, 0x67, 0xDB,
-    0xAD, 0xBF, 0x1A, 0xAC, 0x84, 0x37, 0xA1, 0xA3, 0xB2, 0xBE, 0x52, 0xE5, 0x61, 0xD0, 0x00, 0x61,
-    0x45, 0x62, 0xAC, 0xCB, 0x44, 0x97, 0xFB, 0x7D, 0x9C, 0x90, 0x9C, 0x51, 0x76, 0xD2, 0x4B, 0xE6,
-    0x99, 0x38, 0xB2, 0x72, 0xDE, 0xCB, 0x2D, 0xC3, 0x9B, 0x02, 0xD8, 0x94, 0xC5, 0xDE, 0x64, 0xF7,
-    0x2D, 0xE2, 0x90, 0xB2, 0x19, 0xC9, 0xA4, 0x7D, 0x8D, 0x3B, 0x0F, 0xA9, 0x8A, 0x31, 0x90, 0x27,
-    0xF4, 0xD7, 0xC3, 0x1A, 0x8E, 0x82, 0xC3, 0xCC, 0x8C, 0x26, 0x93, 0xCD, 0xD1, 0x48, 0xF4, 0xF7,
-    0xAA, 0x38, 0x22, 0xD1, 0x52, 0x36, 0xD7, 0x39, 0xD2, 0xC4, 0x8A, 0xEE, 0x3D, 0xFF, 0xD6, 0x3F,
-    0xF6, 0xD2, 0x92, 0x56, 0x28, 0x09, 0xA9, 0x24, 0x71, 0x03, 0xDC, 0xFF, 0xFA, 0x07, 0x0F, 0x96,
-    0xA2, 0x6B, 0x04, 0xAE, 0x89, 0x9C, 0xE6, 0x3F, 0x8C, 0x50, 0xD3, 0x35, 0xE4, 0x39, 0x1E, 0x36,
-    0xBC, 0xFE, 0x7C, 0xEE, 0x0C, 0xBB, 0xF1, 0x7C, 0x8C, 0xB1, 0x5D, 0xAF, 0x6F, 0x2F, 0xCF, 0xEC,
-    0x3B, 0xE1, 0xA3, 0xB8, 0x7B, 0x70, 0xFB, 0x9F, 0xB1, 0x25, 0xA2, 0x16, 0x4C, 0x83, 0x77, 0x3E,
-    0x20, 0x48, 0xE0, 0x89, 0x1F, 0xFD, 0x53, 0x9A, 0xE2, 0x68, 0xCA, 0x9A, 0x63, 0x66, 0xFD, 0xB3,
-    0x7E, 0x03, 0xD5, 0x7C, 0x4D, 0x8C, 0xDD, 0xD6, 0x95, 0xE6, 0xE5, 0xA3, 0xAB, 0x98, 0x98, 0xE8,
-    0xA6, 0x16, 0x56, 0xA6, 0xA3, 0x42, 0x9B, 0x9B, 0x6C, 0x26, 0x33, 0x1D, 0x6E, 0x1B, 0x8D, 0x38,
-    0xA4, 0x2C, 0x60, 0xBC, 0xD0, 0xC2, 0x05, 0x8C, 0x2A, 0x46, 0x5A, 0x0B, 0x35, 0x06, 0x1E, 0x60,
-    0x3A, 0x83, 0x46, 0x61, 0x06, 0xC1, 0x60, 0x02, 0x78, 0x4C, 0xDA, 0x06, 0xDA, 0x0B, 0x2F, 0x5C,
-    0xE8, 0xB1, 0x7B, 0x80, 0xE9, 0x45, 0xBC, 0xD0, 0x60, 0xE2, 0x52, 0x80, 0xCA, 0xD2, 0x0B, 0x59,
-    0xA4, 0x24, 0x60, 0xB4, 0xF0, 0x42, 0xB4, 0x15, 0xB7, 0x17, 0x59, 0x88, 0x8E, 0xA5, 0x76, 0x22,
-    0x03, 0x23, 0xBA, 0x4D, 0xC5, 0xAC, 0x12, 0xC9, 0x33, 0xDF, 0x77, 0x2E, 0xF9, 0xDE, 0x2B, 0x59,
-    0x92, 0xFF, 0x64, 0x79, 0x52, 0x52, 0xF1, 0xB1, 0xF8, 0xF8, 0x73, 0x7F, 0xCE, 0xCF, 0xF7, 0x9D,
-    0x73, 0x2E, 0x8D, 0xC1, 0xCF, 0x1F, 0xE1, 0x37, 0xA8, 0x8C, 0x71, 0x05, 0x3B, 0x79, 0x63, 0xCC,
-    0x8C, 0x3B, 0x4E, 0x62, 0xA6, 0x9F, 0x58, 0x44, 0x2E, 0xE3, 0xB7, 0xD9, 0x14, 0xE9, 0xBD, 0xDE,
-    0x44, 0x87, 0x25, 0xF1, 0xCA, 0xB4, 0x34, 0x55, 0x88, 0xB3, 0x71, 0xC0, 0x38, 0xB2, 0xFD, 0x73,
-    0x93, 0x8A, 0x24, 0xA1, 0x48, 0xE1, 0x0D, 0x1B, 0xEB, 0x8E, 0xE0, 0x72, 0x9C, 0x61, 0x70, 0xC6,
-    0x23, 0x38, 0x23, 0x7C, 0x46, 0x92, 0xE0, 0xDD, 0x5C, 0xE4, 0x63, 0xDC, 0xA7, 0xC7, 0x2F, 0x1E,
-    0x71, 0x72, 0x35, 0x33, 0x72, 0xB4, 0x35, 0xF1, 0x5B, 0x62, 0xFC, 0x3A, 0x4D, 0xCC, 0xBA, 0x33,
-    0x7F, 0xA4, 0x3B, 0x9D, 0xF6, 0x6F, 0xF0, 0x8B, 0x47, 0xCD, 0x1A, 0xDC, 0xE8, 0xBF, 0xE1, 0x46,
-    0x7F, 0xBC, 0xB8, 0xF3, 0xDE, 0x76, 0xE6, 0xA1, 0x51, 0x8E, 0x48, 0x67, 0xD2, 0xAB, 0x1B, 0x66,
-    0xD1, 0x98, 0xC4, 0xC5, 0x25, 0x4E, 0x8B, 0x03, 0xC3, 0x1A, 0xAE, 0x4F, 0xC7, 0xF6, 0xD7, 0x8B,
-    0xEE, 0x0C, 0x4B, 0xDB, 0xDE, 0xC4, 0xB8, 0xC4, 0x6E, 0xBB, 0x71, 0x6B, 0xF4, 0x31, 0xF3, 0xED,
-    0xA9, 0x2B, 0xDC, 0x8A, 0x64, 0xBA, 0xAD, 0xB1, 0x7D, 0x39, 0x6F, 0xF9, 0x6D, 0xD8, 0x71, 0xEB,
-    0xF7, 0xDC, 0x7A, 0x83, 0x3E, 0x7A, 0xDA, 0x7A, 0x52, 0xBA, 0x7C, 0x40, 0xEB, 0xF6, 0x18, 0x9A,
-    0xC6, 0xEB, 0xF8, 0x6C, 0xBF, 0xE5, 0x36, 0xD4, 0x96, 0xA4, 0x18, 0x73, 0xF3, 0x1F, 0x71, 0x4F,
-    0x63, 0xD0, 0x06, 0x1E, 0xD8, 0x1A, 0x7B, 0x3F, 0xC3, 0x31, 0x17, 0xBD, 0xF1, 0x07, 0xCC, 0x8C,
-    0xD8, 0x5E, 0x99, 0x2D, 0xB3, 0x6F, 0x42, 0x2E, 0xB2, 0x21, 0x98, 0x90, 0x0E, 0x5F, 0xE6, 0x78,
-    0x62, 0x94, 0xA5, 0xA5, 0x87, 0x09, 0x71, 0xEA, 0x71, 0x0C, 0xE6, 0xE3, 0x6F, 0xEE, 0x78, 0xC0,
-    0xC9, 0x77, 0x39, 0xD2, 0x85, 0x19, 0xC7, 0xE6, 0xC7, 0x5B, 0xEC, 0x5F, 0x63, 0x30, 0x4F, 0x45,
-    0x3C, 0x6C, 0x76, 0xE8, 0x57, 0x74, 0x56, 0x12, 0xA7, 0x8B, 0x2A, 0x13, 0x9C, 0xC7, 0x45, 0x27,
-    0xD3, 0x02, 0xAD, 0xEA, 0x37, 0xD6, 0x79, 0x4A, 0x12, 0xF0, 0x32, 0x79, 0x7B, 0xC3, 0xF8, 0xEC,
-    0x5B, 0x8E, 0x9B, 0x7B, 0x68, 0xEC, 0xF7, 0xE3, 0xC6, 0xF8, 0xBF, 0x91, 0x6A, 0x36, 0x04, 0x72,
-    0x4D, 0x4A, 0xB4, 0xB5, 0x45, 0xFF, 0x71, 0xF1, 0xC1, 0x63, 0xC6, 0x1C, 0x7A, 0x15, 0xE7, 0x48,
-    0x86, 0xAB, 0x3D, 0x39, 0xDE, 0xC5, 0x95, 0x57, 0xE3, 0x36, 0xB8, 0xF3, 0x23, 0x01, 0x4E, 0x88,
-    0x87, 0x04, 0x67, 0x96, 0xB8, 0x77, 0xCD, 0x11, 0x33, 0x21, 0x3E, 0x3D, 0x79, 0x2B, 0x73, 0xE4,
-    0x67, 0x99, 0x3B, 0xA4, 0x26, 0xB8, 0x31, 0x98, 0xF4, 0x82, 0x9C, 0x1A, 0x20, 0x65, 0x55, 0x84,
-    0x5B, 0x3A, 0x1B, 0xA3, 0xAC, 0x60, 0x30, 0x56, 0x25, 0xA3, 0x9C, 0x35, 0xE8, 0x24, 0xE7, 0xE2,
-    0xCE, 0xBB, 0xE8, 0x74, 0x2C, 0x1D, 0x9A, 0x7E, 0x28, 0x39, 0x19, 0x9F, 0xEF, 0xD3, 0xF3, 0x7D,
-    0x7C, 0xAE, 0x7B, 0xC0, 0xAC, 0x4F, 0x43, 0xDB, 0xE1, 0x3F, 0x6E, 0x86, 0xD3, 0x3F, 0xE3, 0xFF,
-    0x55, 0xB9, 0x62, 0xAF, 0x1A, 0xAF, 0x47, 0x07, 0x8B, 0x35, 0xD9, 0xE2, 0x2C, 0x3B, 0x62, 0x3E,
-    0xDF, 0x07, 0x55, 0x2F, 0xAA, 0x0D, 0x04, 0xC7, 0xE4, 0x85, 0x89, 0x5A, 0x8C, 0x01, 0xFA, 0x57,
-    0x98, 0xB0, 0x5C, 0xCC, 0x3E, 0xD5, 0xA2, 0x98, 0x7F, 0xAC, 0x89, 0x0A, 0x8F, 0xDB, 0x04, 0x14,
-    0x2D, 0xB7, 0xBE, 0xF3, 0x87, 0x57, 0x07, 0x90, 0x78, 0xFD, 0x90, 0xCA, 0xF8, 0x55, 0x40, 0xC5,
-    0x09, 0xCA, 0xA0, 0xC5, 0x34, 0x07, 0x45, 0xD0, 0xE2, 0xA1, 0x21, 0x3E, 0xD0, 0x84, 0x38, 0xE3,
-    0xC7, 0x81, 0x34, 0xE1, 0xC1, 0x47, 0xC4, 0x04, 0x6D, 0xD0, 0xA5, 0xBD, 0x81, 0xB4, 0xB5, 0x79,
-    0x4B, 0xD5, 0x2C, 0xE3, 0xCA, 0xE5, 0x73, 0x57, 0xCC, 0xF2, 0x0F, 0xFA, 0x1E, 0xF1, 0x96, 0x32,
-    0xF8, 0xD4, 0xEF, 0xCD, 0xD6, 0x6C, 0xF6, 0x2A, 0x6C, 0xEC, 0x0E, 0xE5, 0x8D, 0xB2, 0x0E, 0x19,
-    0x8C, 0x2B, 0x15, 0x43, 0x36, 0x6A, 0xFE, 0x25, 0xB5, 0x71, 0x8B, 0x26, 0x84, 0x5A, 0x16, 0xEA,
-    0x47, 0x0B, 0x43, 0xF2, 0xC4, 0x70, 0x5C, 0x0E, 0xEB, 0x95, 0x69, 0xA5, 0x57, 0x06, 0x9D, 0x5E,
-    0x39, 0x13, 0x7B, 0xA5, 0x3C, 0xA3, 0x5F, 0xE6, 0x67, 0xA1, 0x8E, 0x10, 0xAA, 0xF7, 0x44, 0xCE,
-    0xE1, 0xCA, 0x0A, 0xB3, 0x9B, 0x8B, 0x6A, 0xD6, 0xF2, 0x8F, 0xDE, 0x54, 0x4D, 0x0B, 0xFA, 0x1F,
-    0xF0, 0x23, 0x19, 0x55, 0xDF, 0x40, 0x8B, 0x5C, 0x0C, 0x7B, 0x1D, 0x36, 0x41, 0x61, 0xAC, 0xA2,
-    0x4C, 0xDA, 0x8F, 0x36, 0xFE, 0xF8, 0x0A, 0x95, 0xD6, 0x0E, 0x74, 0xAA, 0x1F, 0x8E, 0x5C, 0x4D,
-    0x3B, 0x6D, 0x7E, 0x5C, 0x6B, 0x67, 0x28, 0xFD, 0x2A, 0x63, 0xC6, 0xCA, 0x99, 0xB1, 0x62, 0x67,
-    0x30, 0x6C, 0x50, 0x32, 0x0C, 0x49, 0x48, 0x2B, 0x25, 0x4D, 0x3E, 0x59, 0x21, 0x63, 0x1E, 0x54,
-    0x53, 0xC0, 0xC7, 0x45, 0x0D, 0x47, 0x8F, 0xF2, 0x13, 0xF1, 0x49, 0xAB, 0x0B, 0xD3, 0x6B, 0x9C,
-    0x2D, 0x8C, 0xAA, 0x0B, 0x55, 0xEA, 0x67, 0x52, 0x6C, 0xB6, 0x8E, 0xD4, 0x30, 0x24, 0xF2, 0x1A,
-    0xC4, 0x05, 0x06, 0x33, 0x2D, 0xE2, 0x0C, 0x52, 0x83, 0x7B, 0x78, 0x5D, 0x50, 0xE2, 0xC9, 0x3B,
-    0x15, 0x1B, 0xD8, 0x69, 0x63, 0x33, 0x1C, 0x54, 0xC1, 0xA2, 0x5D, 0x4F, 0x0B, 0x58, 0x9B, 0xB0,
-    0x0E, 0x3A, 0x1C, 0x74, 0xA4, 0xC0, 0xE5, 0x71, 0xE7, 0x70, 0x2E, 0x9F, 0xC3, 0x89, 0x69, 0x8B,
-    0x01, 0xF1, 0x75, 0xB8, 0x0E, 0x4E, 0xCF, 0xF5, 0xEC, 0x8C, 0xEA, 0x10, 0x52, 0xCC, 0x20, 0x99,
-    0x1C, 0x13, 0x27, 0xE7, 0xFE, 0x2D, 0xF3, 0x4E, 0x13, 0x22, 0x72, 0x5D, 0x06, 0x97, 0xF6, 0x1A,
-    0x9A, 0x53, 0xA2, 0x8D, 0x10, 0x23, 0x3C, 0x1D, 0x0F, 0x84, 0xC9, 0x90, 0x1A, 0x0F, 0x0C, 0xE0,
-    0x19, 0xD0, 0x74, 0x1E, 0x0E, 0x6E, 0xF2, 0xF0, 0x10, 0xE1, 0x70, 0x50, 0xE5, 0x85, 0xD7, 0x0F,
-    0x3C, 0x1B, 0x6D, 0xC0, 0xE1, 0xC1, 0xF0, 0x70, 0x05, 0xF1, 0x87, 0x3D, 0xB5, 0x37, 0xF1, 0xD1,
-    0xD4, 0x2B, 0x26, 0xA5, 0xDA, 0x62, 0x20, 0xD1, 0x56, 0x18, 0x55, 0x8C, 0xDE, 0x9F, 0xC0, 0x14,
-    0x55, 0x61, 0x66, 0x66, 0x9D, 0x8F, 0x6E, 0xC7, 0xD7, 0x69, 0xD8, 0x84, 0x23, 0xB9, 0x92, 0x2C,
-    0xB7, 0x0E, 0x23, 0x9E, 0xA2, 0x71, 0x6D, 0x28, 0xEF, 0xEA, 0x6D, 0xC3, 0xD6, 0x44, 0x05, 0xC6,
-    0x04, 0x2E, 0x2F, 0xAE, 0x7C, 0xDE, 0x9D, 0xA6, 0x56, 0x0E, 0x63, 0xD4, 0xA2, 0x0A, 0x13, 0xE7,
-    0x76, 0x29, 0xAF, 0xCA, 0x13, 0xDA, 0xDE, 0x82, 0x1D, 0x67, 0x97, 0x29, 0xB3, 0xF0, 0x52, 0x18,
-    0x01, 0x17, 0x62, 0xEB, 0xBE, 0xA5, 0x2E, 0x42, 0xE5, 0x81, 0x9B, 0x40, 0xED, 0xF7, 0xB1, 0xF9,
-    0x33, 0x21, 0x5C, 0x2A, 0x5F, 0x10, 0xC4, 0x77, 0xF3, 0x0A, 0xDD, 0x81, 0x34, 0xA0, 0xF3, 0x10,
-    0xAB, 0xB4, 0xF8, 0xF2, 0xBB, 0xF4, 0x69, 0xF2, 0xA2, 0xCC, 0x7F, 0x2A, 0x63, 0x9D, 0x4B, 0xCC,
-    0x86, 0xBA, 0xEA, 0x61, 0x22, 0x0E, 0xC1, 0x4C, 0x45, 0x2D, 0x58, 0x16, 0x26, 0x75, 0x33, 0x7A,
-    0x9A, 0xA8, 0xF4, 0x0D, 0x3A, 0xBF, 0x9D, 0x1E, 0xE0, 0xD0, 0x45, 0xEA, 0x94, 0x3A, 0xCE, 0xB2,
-    0x57, 0x51, 0xFC, 0xE3, 0x23, 0x38, 0xD1, 0xE9, 0x68, 0xE1, 0x83, 0x2A, 0xC0, 0x29, 0xF1, 0xCB,
-    0x29, 0xCD, 0x14, 0x6D, 0x4F, 0xA0, 0x1E, 0x31, 0xDD, 0x78, 0x02, 0x36, 0xAA, 0x83, 0x5B, 0xA0,
-    0x95, 0x0A, 0x20, 0xA2, 0xD0, 0xE3, 0xDD, 0x48, 0xCA, 0x90, 0x56, 0x36, 0x49, 0xAD, 0xC0, 0xDF,
-    0xCE, 0x65, 0x85, 0x70, 0x59, 0x6E, 0x09, 0x2D, 0x59, 0xB7, 0x0E, 0x49, 0xD4, 0x00, 0x50, 0xFB,
-    0x71, 0xC6, 0x8C, 0x7A, 0x1F, 0xD7, 0x69, 0xE9, 0x43, 0xE3, 0x55, 0xDD, 0xA9, 0xEB, 0xF9, 0x9B,
-    0x56, 0xCB, 0x39, 0xB2, 0x93, 0x7E, 0x6F, 0x1C, 0xE3, 0xDD, 0x1B, 0xB6, 0x26, 0xD9, 0xBC, 0x91,
-    0x43, 0x41, 0xDC, 0x1E, 0xF2, 0x96, 0x67, 0x69, 0x11, 0x95, 0x61, 0xED, 0xF3, 0x40, 0x67, 0x51,
-    0x82, 0xBD, 0x7B, 0x8B, 0x03, 0xB8, 0x3B, 0xE6, 0x34, 0x2D, 0x70, 0xF7, 0x7A, 0x36, 0x50, 0x30,
-    0x9F, 0x11, 0x23, 0x67, 0xC7, 0xBB, 0x97, 0x6A, 0x1B, 0xBE, 0x6A, 0x77, 0xAB, 0xAE, 0x5E, 0x0D,
-    0x9E, 0xAF, 0x30, 0x64, 0x55, 0x4E, 0xE1, 0x2C, 0xB7, 0xD1, 0xC1, 0x2E, 0xE1, 0x06, 0x4C, 0x9C,
-    0x70, 0x26, 0x7A, 0x7A, 0x05, 0xB7, 0xE6, 0xE1, 0xB0, 0xE0, 0xE1, 0x94, 0xCE, 0x61, 0x46, 0x4B,
-    0x8D, 0xF3, 0x78, 0x38, 0xA6, 0xD3, 0x70, 0x3A, 0x1E, 0x0E, 0x2A, 0x1E, 0x4E, 0xE9, 0x93, 0x31,
-    0x29, 0xD0, 0xA5, 0x7C, 0x38, 0x25, 0xBF, 0x8B, 0xF8, 0x98, 0x3E, 0xE7, 0xF6, 0x06, 0x67, 0x3E,
-    0x3E, 0x4F, 0x31, 0x11, 0x18, 0x0D, 0xA8, 0x4F, 0x4C, 0x7D, 0xAF, 0x4E, 0x53, 0x56, 0x0E, 0x53,
-    0xC9, 0xFF, 0xEC, 0x2B, 0x44, 0x7D, 0x56, 0x04, 0x57, 0x13, 0x9A, 0x21, 0x80, 0x0C, 0x38, 0xA1,
-    0x19, 0xF1, 0x00, 0x7C, 0x52, 0xA2, 0xD6, 0xCD, 0xCF, 0x8B, 0xA0, 0x76, 0x87, 0x8A, 0xD2, 0x56,
-    0x7B, 0x8D, 0xBA, 0xAB, 0x5A, 0xD1, 0x69, 0x1B, 0xD4, 0x6A, 0x2C, 0xBB, 0xA0, 0x8E, 0x39, 0x37,
-    0xF9, 0xCE, 0xDE, 0x30, 0x59, 0x75, 0x33, 0xBA, 0x10, 0xE2, 0xA6, 0x21, 0xA8, 0x29, 0xE1, 0x01,
-    0xCF, 0xA3, 0x6D, 0xE6, 0x75, 0xE8, 0x6C, 0xCC, 0xFB, 0xA0, 0xD1, 0xC2, 0xFB, 0x0A, 0xB5, 0x1A,
-    0xCF, 0x91, 0xC2, 0xC7, 0x54, 0xC2, 0x8D, 0x54, 0xD1, 0x30, 0x53, 0x4B, 0x98, 0xD2, 0xBF, 0x65,
-    0xE1, 0x60, 0x6D, 0x88, 0xB3, 0x6E, 0x0E, 0x9D, 0xC4, 0xBC, 0x49, 0xCD, 0x79, 0x32, 0xF9, 0xCB,
-    0x79, 0x05, 0xDF, 0x08, 0x5B, 0xEB, 0x08, 0x94, 0x2B, 0x2D, 0x1E, 0x82, 0xC9, 0xC0, 0xA3, 0x6A,
-    0x73, 0x68, 0xA7, 0x81, 0xF1, 0xE1, 0xED, 0xA1, 0x8D, 0x2B, 0x9B, 0x3A, 0x38, 0x05, 0x1F, 0xFA,
-    0x5F, 0xD1, 0x90, 0x14, 0xB3, 0x1E, 0xE3, 0x0E, 0x47, 0xE5, 0x7F, 0xD0, 0x50, 0xF2, 0xA1, 0x18,
-    0xA8, 0x83, 0x2F, 0x7D, 0x9D, 0xE6, 0x73, 0x96, 0x7C, 0x93, 0x73, 0x9C, 0xBC, 0x8E, 0xED, 0x40,
-    0x03, 0xE8, 0x48, 0xAE, 0xC6, 0x4E, 0x2D, 0xD9, 0xC1, 0x5B, 0x1D, 0x67, 0x1D, 0xCB, 0x4D, 0x8C,
-    0x8B, 0xC8, 0x9B, 0x79, 0x65, 0xD2, 0x86, 0x68, 0x25, 0x67, 0x7B, 0x5C, 0x7D, 0x42, 0xCC, 0xF6,
-    0xB8, 0xDA, 0xCC, 0x98, 0xCD, 0x74, 0x07, 0x1E, 0x8E, 0x5F, 0xC0, 0xE1, 0xF3, 0x2D, 0xDB, 0x93,
-    0x66, 0x38, 0x5B, 0x5A, 0x6D, 0x66, 0xC6, 0x66, 0xB6, 0xDA, 0xCC, 0xCC, 0xDE, 0x04, 0x87, 0x37,
-    0x77, 0x61, 0x8B, 0x1E, 0x17, 0xF8, 0x2A, 0xC9, 0xA5, 0x55, 0x9C, 0xF2, 0x75, 0xB9, 0xBE, 0x40,
-    0x75, 0x51, 0xD1, 0x15, 0x26, 0x1E, 0x5E, 0x0F, 0xD0, 0x4A, 0x55, 0x0C, 0x13, 0xEA, 0xD6, 0xB7,
-    0xEC, 0xA6, 0xDC, 0xF5, 0x74, 0xF7, 0x0C, 0x77, 0x01, 0xA7, 0xB0, 0xDB, 0x71, 0x17, 0x58, 0xAA,
-    0xA3, 0x35, 0x96, 0x82, 0x40, 0xAA, 0x73, 0x2F, 0x03, 0x2B, 0x17, 0xF0, 0x16, 0xD1, 0x70, 0x54,
-    0x32, 0xA0, 0x57, 0x85, 0x50, 0xE5, 0xFA, 0xD2, 0x30, 0x87, 0x9C, 0x37, 0x5A, 0x4C, 0x8C, 0x25,
-    0xCE, 0xE3, 0x9C, 0x67, 0x0A, 0x20, 0x7A, 0x0C, 0x51, 0x4B, 0x03, 0xED, 0x5F, 0xAF, 0x83, 0xEB,
-    0xF0, 0x5B, 0x69, 0xF9, 0x74, 0x9E, 0x99, 0x3E, 0x7D, 0xF6, 0xC3, 0x01, 0x0D, 0x91, 0xE0, 0x02,
-    0x50, 0xD7, 0xF9, 0xEE, 0x69, 0x4E, 0x85, 0xFF, 0xFB, 0x26, 0x2E, 0x9C, 0x2E, 0xB8, 0x5E, 0x08,
-    0x1A, 0x16, 0x0F, 0x34, 0x02, 0x45, 0xDE, 0xC0, 0x74, 0xE7, 0x78, 0x7E, 0x5C, 0xBA, 0xC4, 0x79,
-    0x50, 0xCB, 0xCA, 0x6B, 0xB0, 0x93, 0x96, 0x41, 0x11, 0x62, 0x88, 0xEB, 0x03, 0x2E, 0x79, 0x12,
-    0x6D, 0x7A, 0xB7, 0x24, 0x94, 0xA2, 0x42, 0xF9, 0xB7, 0x14, 0x4A, 0xBA, 0x30, 0xDA, 0xEC, 0x86,
-    0xAA, 0x0F, 0x1D, 0x87, 0xE9, 0x83, 0x10, 0xC3, 0x08, 0xDA, 0xC3, 0x7B, 0xDB, 0x3B, 0xBD, 0xC2,
-    0xB7, 0x46, 0x15, 0xB1, 0x84, 0x39, 0xF8, 0xE1, 0x9D, 0xCF, 0xE6, 0x61, 0xCC, 0x01, 0xC4, 0x55,
-    0x85, 0x52, 0x54, 0xC0, 0x3A, 0x25, 0x20, 0xCA, 0x0F, 0x8C, 0xCF, 0x39, 0x08, 0x60, 0x0F, 0x4B,
-    0xB8, 0x95, 0x98, 0x46, 0x97, 0xF3, 0x85, 0xF1, 0x06, 0x5F, 0xA0, 0x46, 0x95, 0x18, 0x91, 0x4D,
-    0x68, 0x77, 0xFE, 0x6B, 0xBA, 0xED, 0x8F, 0x95, 0x23, 0xA1, 0xF5, 0x38, 0x08, 0x51, 0xCE, 0x2F,
-    0x0C, 0x54, 0x3D, 0xF6, 0xA6, 0x89, 0x5B, 0x9C, 0xEE, 0xA9, 0xD0, 0xE5, 0x82, 0x81, 0xD4, 0x1B,
-    0x63, 0x6C, 0x69, 0xFE, 0x36, 0x92, 0x25, 0xB6, 0x69, 0x4D, 0x3C, 0x79, 0xC4, 0xDE, 0x8E, 0x94,
-    0x16, 0x5D, 0x5A, 0x90, 0xAA, 0xB8, 0xD3, 0xC2, 0xD7, 0x2F, 0x7C, 0x98, 0x9D, 0x55, 0xDE, 0xA1,
-    0x4E, 0xB1, 0x26, 0x0A, 0xDC, 0xD8, 0xA0, 0x89, 0x6D, 0xD9, 0xFB, 0x62, 0x73, 0x0F, 0x8E, 0x05,
-    0x4E, 0x89, 0xB2, 0x5D, 0xA6, 0x45, 0xD0, 0x84, 0xB5, 0xDB, 0x53, 0x5C, 0x71, 0x00, 0x42, 0xF3,
-    0x8F, 0x52, 0x84, 0x1C, 0x53, 0xE1, 0x44, 0xBC, 0x6A, 0x3D, 0x38, 0x39, 0xA4, 0xA7, 0x28, 0x84,
-    0xA8, 0xEC, 0x77, 0xB7, 0xF2, 0x38, 0x92, 0x90, 0x40, 0xBD, 0xE2, 0xA9, 0x9E, 0x43, 0xF8, 0x18,
-    0x86, 0xF3, 0x12, 0xCC, 0x1E, 0xC7, 0xEF, 0x00, 0xAF, 0xA7, 0x1F, 0xA1, 0xEB, 0x50, 0x20, 0x40,
-    0x5B, 0x15, 0x8D, 0x84, 0xD3, 0x21, 0xD0, 0x8B, 0x89, 0x60, 0x65, 0xF7, 0x2F, 0x09, 0xA3, 0x3B,
-    0x1D, 0xB3, 0x48, 0x29, 0xDC, 0xFA, 0xC2, 0x23, 0xCA, 0xD2, 0x26, 0x91, 0xEC, 0x0C, 0xB4, 0xC2,
-    0x6E, 0x5E, 0xFF, 0x26, 0x36, 0x4F, 0x1A, 0x63, 0x99, 0xED, 0xE7, 0xD8, 0x80, 0x48, 0xF1, 0xD6,
-    0xFD, 0xB8, 0x51, 0x1C, 0xC3, 0x11, 0xBB, 0x29, 0x03, 0x8C, 0x87, 0xDA, 0x0C, 0x18, 0x35, 0x9F,
-    0x7A, 0x04, 0xBD, 0x02, 0x09, 0x50, 0xD3, 0xC1, 0xD3, 0xCB, 0x94, 0xD4, 0x9A, 0x6E, 0x41, 0xE8,
-    0x23, 0xA2, 0xEB, 0x25, 0x3B, 0xC6, 0xB1, 0xC8, 0xB9, 0x51, 0xFA, 0x33, 0xA3, 0x60, 0x27, 0x34,
-    0x2C, 0x4D, 0xAE, 0x38, 0x3E, 0xA1, 0xC6, 0x25, 0x3C, 0x31, 0x99, 0xAB, 0x7F, 0xA0, 0x0F, 0xA6,
-    0xD6, 0xA3, 0x35, 0x84, 0x42, 0x8A, 0xAC, 0x22, 0x8A, 0x64, 0xA4, 0xCC, 0x64, 0xC8, 0x2F, 0x8B,
-    0x0B, 0xBC, 0x10, 0xB6, 0x79, 0x91, 0x16, 0xF9, 0x45, 0x62, 0x89, 0x1E, 0x3A, 0x5B, 0xC4, 0x97,
-    0x75, 0x97, 0x47, 0xD3, 0x0B, 0x98, 0xBB, 0xA0, 0x8D, 0x5B, 0x90, 0x55, 0xB2, 0x12, 0x1A, 0x1D,
-    0x82, 0x1B, 0xB3, 0xD6, 0xCF, 0xF1, 0xD7, 0x26, 0x1F, 0x61, 0xED, 0xDC, 0xF6, 0x76, 0x36, 0xC7,
-    0x02, 0xE7, 0x61, 0x17, 0xA4, 0x85, 0x11, 0x4D, 0x15, 0xEB, 0x49, 0x19, 0xD0, 0xAF, 0xCC, 0x28,
-    0xB2, 0x6D, 0x8A, 0xD3, 0x72, 0x58, 0x11, 0x34, 0xB8, 0x33, 0x36, 0x30, 0x30, 0xF5, 0x8F, 0x3D,
-    0xB0, 0xA6, 0x3B, 0xE5, 0x81, 0xE0, 0x5D, 0xB4, 0xD7, 0xED, 0x38, 0x9B, 0xC0, 0x50, 0x0D, 0x9C,
-    0x14, 0x0C, 0x9F, 0x3F, 0xC0, 0x4F, 0x3F, 0x2F, 0x50, 0x76, 0x98, 0xD8, 0x72, 0x82, 0x20, 0x2E,
-    0x9F, 0x09, 0xD1, 0xC7, 0xE1, 0x81, 0x14, 0x5A, 0xA5, 0x16, 0x9D, 0x86, 0xD4, 0x42, 0xC2, 0x14,
-    0x6E, 0x2A, 0xCB, 0x35, 0x5F, 0xF8, 0x30, 0x8D, 0xA8, 0xEC, 0xAA, 0x9C, 0x0C, 0x96, 0xD7, 0xA9,
-    0x04, 0x29, 0xC3, 0xCA, 0xD5, 0xC9, 0xAA, 0xC5, 0x71, 0x2D, 0x58, 0xD5, 0xA1, 0xF8, 0xD3, 0x91,
-    0x83, 0x10, 0x45, 0xF7, 0x00, 0x90, 0x02, 0x60, 0x06, 0x0C, 0x58, 0x12, 0xB5, 0x77, 0x64, 0x5C,
-    0x52, 0x7C, 0x62, 0x37, 0xA2, 0xA5, 0x75, 0x64, 0x77, 0xA7, 0x53, 0x0B, 0x5E, 0x70, 0xBE, 0x70,
-    0xE3, 0xEF, 0x9E, 0x54, 0xF8, 0x1E, 0x74, 0x73, 0x22, 0xB3, 0xB4, 0x1B, 0x0D, 0x2A, 0x03, 0x16,
-    0x7C, 0x96, 0x0B, 0x63, 0x70, 0x42, 0x5A, 0x8E, 0x49, 0x97, 0xCA, 0x25, 0x0D, 0x2C, 0x6C, 0xC2,
-    0x73, 0xD1, 0x29, 0xC7, 0x8C, 0xE8, 0xA0, 0xA3, 0x30, 0x9F, 0x2D, 0x3D, 0x5E, 0xAF, 0xAA, 0x0E,
-    0x2B, 0x43, 0x65, 0xBF, 0x97, 0x5F, 0x63, 0xCC, 0x4E, 0xC9, 0xCE, 0x38, 0x6A, 0x42, 0x93, 0xA1,
-    0x3F, 0xF5, 0xC2, 0x21, 0xBF, 0x23, 0x30, 0x9D, 0x18, 0x98, 0x0B, 0x14, 0x98, 0x7A, 0x6D, 0x70,
-    0x72, 0xB8, 0xB1, 0x64, 0xBA, 0xCD, 0xFD, 0xFA, 0x5C, 0x93, 0xBD, 0x7C, 0x4F, 0xE4, 0x15, 0xD9,
-    0xDF, 0xCE, 0x6E, 0x9C, 0xBF, 0xF1, 0xD3, 0x52, 0x12, 0x1B, 0xD2, 0x5A, 0xFE, 0x9C, 0x4D, 0xFD,
-    0x99, 0x8B, 0x22, 0x66, 0x25, 0xE6, 0xE5, 0x1A, 0x5C, 0x30, 0x34, 0x2B, 0x63, 0xF0, 0x22, 0x56,
-    0x03, 0xB1, 0xA5, 0x8A, 0x6C, 0x0D, 0x86, 0xD5, 0x1D, 0xC6, 0xF0, 0x8C, 0x06, 0x32, 0x18, 0x05,
-    0x20, 0xFD, 0x60, 0x38, 0x01, 0xFE, 0xB5, 0xD6, 0x20, 0x01, 0x77, 0xC1, 0xDC, 0x18, 0xBF, 0x50,
-    0xA4, 0x9D, 0xCD, 0x94, 0x2E, 0x45, 0x8B, 0xD9, 0x9E, 0x03, 0x1C, 0xCA, 0x01, 0xBF, 0xC3, 0xC7,
-    0xDA, 0x40, 0xED, 0x2F, 0x35, 0xEA, 0x26, 0xC5, 0x5D, 0x3F, 0x04, 0x12, 0xC4, 0x0F, 0xF8, 0x66,
-    0xFD, 0x18, 0xF4, 0x3B, 0x57, 0xEC, 0x29, 0x92, 0xD8, 0x8F, 0x6C, 0xDF, 0x87, 0x1E, 0xF4, 0x78,
-    0x0A, 0x63, 0x37, 0x8E, 0x5C, 0xA1, 0xD7, 0x0C, 0xA9, 0x1C, 0xD4, 0xD0, 0x7E, 0x7F, 0x40, 0xC5,
-    0xF6, 0x73, 0xB3, 0xBD, 0x23, 0xAD, 0x40, 0x93, 0x97, 0x49, 0xD3, 0x33, 0x9F, 0x91, 0x34, 0xFD,
-    0xE5, 0x49, 0x32, 0xE3, 0x5E, 0x5D, 0x90, 0x2B, 0xFF, 0x00, 0x50, 0x08, 0xDD, 0x87, 0x0E, 0x86,
-    0x2D, 0xD8, 0x80, 0x9C, 0x7D, 0xC5, 0xC6, 0x1C, 0x21, 0xA0, 0xDB, 0xA7, 0x06, 0x42, 0xAA, 0x4A,
-    0x87, 0xDA, 0xD9, 0x20, 0x3F, 0xD4, 0xAF, 0xF2, 0x73, 0xA5, 0x42, 0xDB, 0x99, 0x3C, 0x0E, 0xD7,
-    0x56, 0xE5, 0x7B, 0x39, 0xFC, 0x17, 0x4E, 0x51, 0x6C, 0xBB, 0xB2, 0x61, 0x9F, 0xB2, 0xFA, 0x2A,
-    0x27, 0x07, 0xD7, 0x0F, 0x46, 0x71, 0x96, 0x00, 0x79, 0x81, 0x9F, 0x7C, 0xA0, 0x50, 0x2E, 0x05,
-    0x00, 0x02, 0x47, 0xC3, 0x9C, 0x86, 0x1D, 0x7D, 0x1D, 0x46, 0x12, 0xBE, 0x0F, 0x33, 0xE7, 0x0D,
-    0xF4, 0x85, 0x74, 0xE1, 0xE9, 0x35, 0xC0, 0x4D, 0x57, 0x74, 0x60, 0xF9, 0x27, 0xDB, 0x81, 0x3F,
-    0xFB, 0x27, 0xF8, 0x2D, 0xD8, 0x5B, 0xCC, 0x50, 0x99, 0x3D, 0x99, 0x7E, 0x13, 0x36, 0xC0, 0xD7,
-    0x5B, 0xC1, 0x13, 0xC2, 0x24, 0xC3, 0x42, 0xC6, 0xF5, 0x1A, 0x24, 0x40, 0x72, 0x82, 0x0C, 0x1A,
-    0x61, 0x36, 0x63, 0x36, 0x72, 0x3B, 0x67, 0x63, 0x1A, 0xE7, 0xD5, 0x31, 0x14, 0x8C, 0xE1, 0xDA,
-    0xE3, 0xF7, 0xB8, 0x96, 0xD8, 0x88, 0x2A, 0x3A, 0x6D, 0xF8, 0xA7, 0x7E, 0x81, 0x53, 0x72, 0x35,
-    0x2E, 0x85, 0xFA, 0x58, 0xA8, 0x2F, 0x8E, 0x45, 0xA4, 0x1C, 0x6C, 0x01, 0xBD, 0x35, 0x0C, 0x12,
-    0xCE, 0xF3, 0x07, 0xCC, 0x6C, 0x4C, 0xC4, 0x9D, 0x82, 0xE4, 0x0C, 0x36, 0x62, 0xF2, 0xAD, 0x75,
-    0x35, 0xD3, 0x18, 0x4F, 0x13, 0x5F, 0x45, 0xC3, 0x00, 0x8B, 0x23, 0xDE, 0x93, 0x3E, 0xE1, 0x90,
-    0x0A, 0x50, 0xC1, 0x3B, 0xF3, 0x4E, 0xA4, 0xAF, 0x10, 0xE9, 0x22, 0xFF, 0x40, 0x7E, 0xCB, 0x98,
-    0x53, 0x38, 0x00, 0x43, 0xAD, 0x6B, 0x54, 0xFE, 0x01, 0x78, 0xAB, 0xD3, 0x74, 0x8D, 0x46, 0x27,
-    0x0F, 0xA4, 0xA9, 0x59, 0x49, 0x42, 0x4C, 0x4C, 0x44, 0xCF, 0x7D, 0x76, 0xDD, 0xA4, 0xD7, 0x31,
-    0xE9, 0x64, 0xB1, 0x7B, 0x39, 0x50, 0x50, 0xD8, 0x0A, 0x38, 0x0B, 0x21, 0x10, 0xED, 0x0C, 0xF1,
-    0x79, 0x0E, 0xDA, 0x0B, 0xE4, 0xD7, 0xC5, 0x75, 0xD8, 0xC0, 0xA3, 0x71, 0x62, 0x0A, 0x8D, 0x66,
-    0x80, 0xF5, 0x38, 0x1B, 0xEB, 0xD4, 0xBE, 0x80, 0xA4, 0x0F, 0xB4, 0x1F, 0xA4, 0xA9, 0x8E, 0x8B,
-    0x18, 0x60, 0x92, 0x48, 0x90, 0x31, 0xC3, 0x32, 0x7E, 0x3B, 0x2F, 0xE1, 0xD7, 0x9E, 0xC3, 0x38,
-    0x07, 0x35, 0xBC, 0xEE, 0xDB, 0xF9, 0xAF, 0x85, 0xD6, 0x68, 0x1E, 0x6F, 0x0B, 0xAC, 0xA5, 0x7F,
-    0x53, 0xAE, 0xF5, 0xD0, 0xBC, 0x52, 0xB2, 0xD3, 0x41, 0xEB, 0xA3, 0x33, 0x07, 0xA8, 0xBE, 0x38,
-    0x6B, 0xF9, 0x83, 0xD1, 0xDE, 0x32, 0x98, 0xA4, 0x9E, 0xEA, 0xA9, 0x54, 0xAB, 0x36, 0xD1, 0xDB,
-    0x98, 0xA5, 0x30, 0x63, 0x58, 0x54, 0x37, 0x09, 0x23, 0xA3, 0xDC, 0xC0, 0x14, 0x8C, 0x9B, 0xA7,
-    0xB9, 0x79, 0x1D, 0x1B, 0x78, 0x10, 0x31, 0x7E, 0xFF, 0x43, 0xD9, 0x22, 0x02, 0xED, 0x74, 0x13,
-    0xD3, 0x03, 0x02, 0x11, 0xB8, 0x84, 0x05, 0xB3, 0x36, 0xC2, 0x7C, 0x37, 0x21, 0x6D, 0x0D, 0x46,
-    0xCF, 0x1C, 0x30, 0xAB, 0xEB, 0xCA, 0x98, 0x04, 0xFA, 0x71, 0xBC, 0x43, 0x07, 0xDF, 0x6F, 0x67,
-    0x43, 0x9E, 0x45, 0xD7, 0x6D, 0xD3, 0xAF, 0xEF, 0x6E, 0x1C, 0xC3, 0xE3, 0x89, 0x8F, 0x20, 0xF0,
-    0x47, 0x38, 0xFC, 0x3A, 0x35, 0x8D, 0x59, 0xC1, 0x0C, 0x72, 0x0E, 0xBE, 0x6D, 0x20, 0x4F, 0x6D,
-    0xD0, 0x44, 0x6D, 0x28, 0x8F, 0xE2, 0x26, 0x65, 0x5C, 0xA4, 0x80, 0xD8, 0x6E, 0x07, 0xAE, 0x3A,
-    0x6B, 0xE2, 0xB3, 0xA4, 0xF0, 0xE7, 0x95, 0x59, 0xE7, 0xF9, 0xF5, 0xCA, 0xB2, 0x0A, 0x34, 0x66,
-    0x48, 0xDF, 0xC1, 0x37, 0x39, 0xBE, 0xA9, 0x08, 0x4E, 0xCF, 0x32, 0xBA, 0x8B, 0x6B, 0x00, 0x4E,
-    0x79, 0x83, 0x8A, 0x77, 0x7B, 0x16, 0x4E, 0x7A, 0x26, 0x8D, 0xDF, 0x2B, 0x05, 0x85, 0xDC, 0x7C,
-    0x6B, 0x0B, 0x73, 0xCD, 0xA0, 0xED, 0xB9, 0xFE, 0x68, 0xFF, 0x30, 0x3D, 0xA7, 0xCB, 0x76, 0x41,
-    0x5F, 0x19, 0x26, 0xCF, 0x9C, 0xE3, 0xD0, 0x8D, 0xE8, 0x43, 0xB8, 0x92, 0x38, 0x89, 0x3E, 0x1A,
-    0x8E, 0xC3, 0x1F, 0x70, 0xF6, 0xB7, 0xCC, 0xC1, 0x64, 0x34, 0xAB, 0x5D, 0x04, 0x67, 0x56, 0xA5,
-    0x34, 0x07, 0x31, 0xB0, 0x25, 0x19, 0x50, 0x19, 0x62, 0xC8, 0x0E, 0x0B, 0x50, 0x66, 0x04, 0x9C,
-    0xF8, 0xFB, 0x96, 0xC4, 0xED, 0x39, 0x1C, 0x6A, 0x49, 0x8A, 0xB3, 0x98, 0x4A, 0xC9, 0xB3, 0xBC,
-    0xDE, 0xE7, 0x85, 0x31, 0x1A, 0xD5, 0x61, 0xD0, 0x12, 0x5A, 0x63, 0x92, 0x1C, 0xF4, 0x2B, 0xBE,
-    0x44, 0x26, 0x44, 0x3B, 0xBA, 0xF6, 0xDB, 0x7D, 0x96, 0xD4, 0x97, 0x8F, 0x18, 0x6C, 0x3B, 0x0B,
-    0x3F, 0x56, 0xAB, 0xEE, 0x04, 0x8D, 0xC7, 0x7B, 0x01, 0xD1, 0x80, 0x01, 0xE3, 0xD0, 0x19, 0xDC,
-    0x1E, 0xA6, 0xC8, 0x28, 0x37, 0x21, 0x1D, 0x67, 0x9A, 0x44, 0xDB, 0xF5, 0x28, 0x2F, 0x44, 0x53,
-    0x73, 0x85, 0x36, 0x0F, 0x81, 0x96, 0x84, 0x35, 0x19, 0x08, 0x6C, 0x03, 0x06, 0xA0, 0x09, 0x01,
-    0x88, 0x8E, 0x00, 0x4D, 0x37, 0x4F, 0xE3, 0x39, 0xD7, 0x35, 0xFE, 0x84, 0x9D, 0x13, 0x8D, 0xD5,
-    0x41, 0x39, 0x32, 0x60, 0x07, 0x86, 0x91, 0x06, 0x36, 0x07, 0xF5, 0xC3, 0x43, 0x48, 0xFC, 0xCD,
-    0x43, 0x73, 0xCC, 0x3A, 0x68, 0xEC, 0xDA, 0xDB, 0xC5, 0x9C, 0x46, 0x33, 0xD0, 0xE3, 0x1A, 0xEC,
-    0x3D, 0x9E, 0x91, 0x42, 0x8D, 0x3B, 0x5E, 0x85, 0x9D, 0xD7, 0xB1, 0x13, 0x14, 0x51, 0xF5, 0x17,
-    0xDD, 0x6C, 0xF0, 0x89, 0x9F, 0x72, 0x90, 0x93, 0xF7, 0x41, 0x22, 0x86, 0x45, 0xD8, 0x33, 0xE2,
-    0xC4, 0x7D, 0x40, 0x5B, 0xD1, 0x80, 0xFC, 0x72, 0x76, 0x12, 0x52, 0x4A, 0xF0, 0x2D, 0xD3, 0x77,
-    0x51, 0x9A, 0xC5, 0xE9, 0x8B, 0x2F, 0x56, 0xC1, 0x3B, 0x37, 0xCF, 0xB7, 0x6E, 0x23, 0x35, 0x0E,
-    0x46, 0x4D, 0x9C, 0xC5, 0x47, 0x20, 0x1D, 0x41, 0xF9, 0x3A, 0x28, 0x58, 0xF3, 0x4D, 0x07, 0x03,
-    0x05, 0x4B, 0x71, 0x93, 0xAC, 0x79, 0x58, 0x9E, 0xA7, 0x5C, 0xE7, 0x89, 0xC0, 0x8F, 0xA3, 0xC6,
-    0x21, 0xE2, 0x40, 0x8A, 0xC5, 0xF3, 0x38, 0x74, 0xED, 0xD4, 0x78, 0xC8, 0xCE, 0x26, 0xCF, 0xAA,
-    0x5C, 0x34, 0xB4, 0xE6, 0x3C, 0x9D, 0xC3, 0x3C, 0xAD, 0xBC, 0x44, 0xB7, 0xC0, 0xDC, 0x58, 0x15,
-    0xEE, 0xE6, 0x0D, 0x63, 0xE6, 0x8C, 0x73, 0x31, 0x50, 0x40, 0xCF, 0x23, 0x99, 0x6B, 0x3F, 0x27,
-    0x43, 0x80, 0x91, 0x8D, 0x07, 0x46, 0x60, 0xA4, 0x50, 0x0C, 0x39, 0x97, 0x9B, 0x89, 0x13, 0x79,
-    0xF2, 0xF7, 0x79, 0xC1, 0xC0, 0x1E, 0x9E, 0x44, 0x0A, 0x9E, 0x85, 0xB5, 0xDA, 0xC3, 0xBB, 0x1C,
-    0x82, 0xDC, 0x80, 0x3A, 0xC4, 0xC0, 0x96, 0x9D, 0x39, 0xB6, 0x9A, 0xB8, 0xF2, 0x22, 0xE7, 0x84,
-    0x60, 0x0A, 0xBE, 0xCE, 0x1B, 0x66, 0x6A, 0xF8, 0x61, 0xAA, 0x0D, 0xF1, 0xB2, 0xBF, 0x7F, 0x27,
-    0x53, 0x91, 0xE9, 0xE0, 0xBD, 0xD3, 0x3D, 0x25, 0x3D, 0x36, 0x7F, 0xE4, 0xF5, 0xC7, 0x2C, 0x76,
-    0x56, 0x58, 0xA1, 0x14, 0x88, 0x44, 0x9F, 0x83, 0xF7, 0xDD, 0x6D, 0x46, 0x95, 0x56, 0xB6, 0x20,
-    0x11, 0x95, 0x47, 0x95, 0xFE, 0x59, 0x17, 0x97, 0xF1, 0x85, 0xCE, 0x6D, 0xF2, 0xEC, 0xA1, 0x65,
-    0x6B, 0x53, 0x28, 0xC3, 0x01, 0x93, 0x00, 0xF7, 0xA7, 0x4B, 0x80, 0x4A, 0x57, 0x13, 0xA9, 0xE1,
-    0xE8, 0x7E, 0x44, 0xCB, 0x31, 0xEC, 0xEC, 0xE5, 0x31, 0x10, 0xFE, 0xC5, 0xB3, 0xE2, 0xBE, 0x07,
-    0xC3, 0xDE, 0xEC, 0xE3, 0x5A, 0xFB, 0xC8, 0x17, 0x3C, 0x82, 0xB6, 0x60, 0xEE, 0x52, 0x44, 0x1E,
-    0x93, 0xF7, 0x79, 0xEB, 0x23, 0xB0, 0xB9, 0x64, 0x2B, 0x0C, 0x17, 0x39, 0x44, 0xC2, 0x01, 0xB8,
-    0x79, 0x05, 0x53, 0x94, 0x9E, 0xEB, 0x6C, 0xE0, 0x6D, 0x36, 0xA4, 0x1C, 0x64, 0x34, 0xCB, 0x27,
-    0x18, 0xD5, 0x50, 0x2C, 0x03, 0x56, 0x86, 0x38, 0x5F, 0x31, 0x31, 0x4C, 0x89, 0xAB, 0x66, 0x8F,
-    0xC0, 0x8F, 0x4F, 0x98, 0x71, 0x67, 0xB6, 0x6B, 0x45, 0x70, 0x65, 0x0A, 0xCA, 0x3B, 0x1A, 0xB9,
-    0xB5, 0xDC, 0x82, 0x51, 0x6B, 0x75, 0x03, 0xC6, 0xE7, 0x41, 0x82, 0x21, 0x50, 0x0D, 0x82, 0x14,
-    0x62, 0x24, 0xB9, 0xBE, 0x07, 0x56, 0xFF, 0x6C, 0x1F, 0x42, 0x20, 0xF2, 0xC3, 0x12, 0x55, 0x51,
-    0x19, 0x5F, 0x6E, 0xFC, 0x26, 0xB8, 0xD9, 0xCF, 0x7A, 0x77, 0x80, 0xBB, 0x49, 0x24, 0xE7, 0xC1,
-    0x77, 0x3A, 0x1F, 0x14, 0x14, 0x06, 0x87, 0xFE, 0x41, 0xF2, 0x96, 0xAE, 0xB3, 0xA1, 0x9B, 0x64,
-    0xBC, 0xF0, 0x76, 0x0F, 0x5A, 0xE3, 0x37, 0x4C, 0x71, 0x98, 0xD9, 0xF6, 0xAB, 0x13, 0x8E, 0x6E,
-    0x53, 0xD8, 0xA2, 0x47, 0x99, 0xBA, 0x89, 0x4A, 0x87, 0x9A, 0xEB, 0x75, 0xCA, 0xBD, 0x33, 0x4B,
-    0x5B, 0x5C, 0xC5, 0x50, 0x0C, 0x29, 0x73, 0x5E, 0x3E, 0x04, 0x39, 0xED, 0x69, 0x08, 0xB3, 0x18,
-    0x5A, 0x14, 0x40, 0xB9, 0xDE, 0x9D, 0xEB, 0x45, 0x0C, 0x39, 0x84, 0x21, 0xC0, 0x70, 0xE6, 0x63,
-    0x82, 0x8A, 0xB1, 0x2E, 0xA2, 0x3C, 0xF7, 0xAE, 0x87, 0xF6, 0x76, 0xFA, 0xA3, 0xF3, 0x28, 0x39,
-    0x01, 0x29, 0xCD, 0x01, 0x63, 0x9E, 0x46, 0x23, 0x88, 0x8C, 0x78, 0x3A, 0x73, 0x4C, 0x8D, 0x69,
-    0xF8, 0x50, 0x86, 0x5C, 0x42, 0xF8, 0x4D, 0x80, 0x46, 0x9F, 0x79, 0x5B, 0x34, 0x06, 0x50, 0x8A,
-    0x56, 0xAC, 0x84, 0x2A, 0x8A, 0x75, 0xDD, 0xA5, 0x39, 0xF4, 0xBF, 0xFB, 0x91, 0xC2, 0xB8, 0xFD,
-    0x98, 0x1B, 0x80, 0x17, 0x33, 0x73, 0x37, 0x16, 0x43, 0xDC, 0x5F, 0x94, 0xEB, 0x60, 0x0F, 0x97,
-    0xA4, 0xE1, 0xA5, 0x11, 0xAC, 0x5C, 0x80, 0x81, 0x76, 0x71, 0x2F, 0x8C, 0x1F, 0x60, 0x48, 0x92,
-    0x27, 0xF0, 0x3A, 0x65, 0x54, 0x7E, 0xDA, 0x17, 0xC3, 0x29, 0xFC, 0xF3, 0xB5, 0x07, 0x1F, 0xEB,
-    0xB6, 0x9F, 0x9C, 0xEC, 0x7B, 0xF8, 0xD7, 0x02, 0xFE, 0x63, 0x90, 0x0F, 0xC3, 0xE6, 0x25, 0x79,
-    0x66, 0x2F, 0x19, 0xEF, 0xF2, 0x39, 0xFF, 0xD8, 0xC6, 0xBF, 0x52, 0x03, 0xC4, 0x1A, 0xF5, 0x9D,
-    0x9E, 0x13, 0x15, 0x0B, 0x8A, 0x66, 0x34, 0x37, 0x66, 0x8C, 0x85, 0xF3, 0xBE, 0x35, 0x13, 0x07,
-    0xA6, 0xD4, 0x1A, 0x0D, 0x06, 0xE0, 0xEA, 0x35, 0x7A, 0x67, 0xEA, 0x46, 0xCB, 0x74, 0x66, 0x95,
-    0x5E, 0xD3, 0x9C, 0x32, 0x13, 0xB9, 0xC4, 0xD8, 0x75, 0x4C, 0x8E, 0x98, 0x83, 0x22, 0xCE, 0xC8,
-    0x10, 0x61, 0xBE, 0xA2, 0x1B, 0x79, 0xA1, 0x01, 0x86, 0x78, 0x7F, 0xC2, 0x0E, 0x7F, 0xB9, 0x44,
-    0xE4, 0xB0, 0x1D, 0x1D, 0xCD, 0x78, 0x5A, 0x6A, 0xF6, 0x61, 0xDA, 0xEE, 0x9D, 0xE4, 0x16, 0x27,
-    0xE9, 0xB6, 0xE4, 0xF1, 0xA8, 0xE6, 0x36, 0x58, 0xDA, 0xF2, 0x71, 0xC1, 0x6E, 0x5E, 0xA6, 0x30,
-    0xAA, 0xF2, 0x1C, 0xEF, 0xB6, 0xEB, 0x2E, 0x01, 0x6C, 0x17, 0x02, 0x16, 0x40, 0x00, 0x3D, 0x72,
-    0x88, 0xC6, 0x4E, 0xA8, 0x6C, 0x6F, 0x8D, 0x38, 0xA7, 0x82, 0xCB, 0x2A, 0x30, 0xAE, 0x6E, 0x0F,
-    0x07, 0xCD, 0x1B, 0xFE, 0x93, 0xBC, 0x20, 0xE4, 0xE6, 0x43, 0x32, 0x61, 0x39, 0x1F, 0xDA, 0xCB,
-    0xF8, 0xC8, 0xEE, 0x66, 0xF7, 0xB0, 0xDA, 0x04, 0x4A, 0x02, 0xB1, 0x38, 0x4C, 0x21, 0xBE, 0x52,
-    0xB0, 0x2C, 0x47, 0x32, 0xE2, 0x90, 0xA8, 0x96, 0xBF, 0x67, 0x74, 0x13, 0xA8, 0x7C, 0x98, 0x4C,
-    0xAC, 0x73, 0x92, 0xF1, 0x5C, 0xB8, 0x70, 0x19, 0x38, 0x44, 0x21, 0x0C, 0x63, 0x0A, 0x48, 0x81,
-    0x7F, 0x1D, 0xDB, 0xEE, 0xF5, 0xE8, 0x53, 0xC5, 0x00, 0xA8, 0x2C, 0xB6, 0x7B, 0x39, 0xB7, 0x4D,
-    0x0C, 0xF3, 0xCF, 0x1E, 0xB3, 0x69, 0x61, 0xEB, 0xB7, 0xC0, 0x59, 0xB2, 0x53, 0xD3, 0xEB, 0x31,
-    0x6C, 0x67, 0x72, 0xD5, 0x9C, 0x95, 0xF5, 0x49, 0xB0, 0xE1, 0x09, 0x18, 0x0B, 0xDA, 0x8D, 0x20,
-    0xD6, 0x3E, 0x90, 0xCE, 0x8C, 0x3A, 0x02, 0x79, 0xE9, 0x19, 0x19, 0x40, 0x4B, 0x49, 0x32, 0xBC,
-    0x36, 0x47, 0x4B, 0xA3, 0x0A, 0x4E, 0x0F, 0xCA, 0x33, 0x83, 0xE2, 0x1E, 0x91, 0x5D, 0xB6, 0x6D,
-    0xEE, 0xF5, 0x7C, 0x68, 0x77, 0x6B, 0xB5, 0x5E, 0x6C, 0x3C, 0xC5, 0x2B, 0xE6, 0x83, 0xF9, 0xEF,
-    0x0D, 0xFD, 0x58, 0x0E, 0x0F, 0x7E, 0x03, 0xF0, 0x06, 0x40, 0x27, 0x8B, 0x3E, 0xC0, 0x93, 0x08,
-    0xA6, 0x88, 0xA9, 0x5E, 0xDE, 0x78, 0xBC, 0xD1, 0x9C, 0x36, 0x06, 0xFB, 0x81, 0x98, 0xE0, 0x50,
-    0x3A, 0xB5, 0x9A, 0x16, 0x84, 0xA7, 0x1E, 0xC4, 0x10, 0x0F, 0x3B, 0xDA, 0xCC, 0xCA, 0xEF, 0xDD,
-    0x8B, 0x7B, 0x3E, 0x34, 0x1A, 0x47, 0x4E, 0xF7, 0xAA, 0x96, 0x26, 0xF4, 0x3A, 0x10, 0x35, 0x6E,
-    0x37, 0x58, 0x0E, 0x65, 0xFD, 0xC8, 0x39, 0x16, 0x6E, 0xE8, 0x84, 0x81, 0x94, 0x80, 0x56, 0x27,
-    0x80, 0xEB, 0x2D, 0x89, 0x53, 0x41, 0x84, 0xCC, 0x6C, 0x4F, 0x41, 0x3A, 0xB5, 0x6F, 0x07, 0x5E,
-    0x2D, 0x68, 0x39, 0x6F, 0x89, 0x06, 0xFF, 0xAD, 0x5F, 0xA0, 0xF4, 0x84, 0x04, 0x66, 0x0C, 0x46,
-    0x6A, 0x66, 0x7E, 0xAC, 0xD8, 0x78, 0xD8, 0x06, 0x37, 0x72, 0x35, 0xE8, 0x1C, 0xC0, 0x87, 0x19,
-    0x88, 0x5A, 0x4A, 0x4A, 0x5F, 0x57, 0x78, 0xBF, 0x03, 0xB3, 0xD3, 0x5B, 0xA0, 0x0C, 0xBC, 0xEC,
-    0xDC, 0x0A, 0x94, 0x33, 0x26, 0x19, 0x7D, 0x8D, 0x4C, 0x33, 0x38, 0xF5, 0x12, 0x2C, 0x51, 0x8B,
-    0xFE, 0xBC, 0x2B, 0x8F, 0x0E, 0x71, 0xE1, 0xBF, 0xD3, 0x9A, 0xEF, 0xC0, 0x24, 0x07, 0xCA, 0x70,
-    0xEA, 0x60, 0xD8, 0xE6, 0x05, 0x0A, 0x5F, 0x6B, 0xF3, 0x6F, 0x85, 0xD9, 0x67, 0x29, 0x09, 0x5F,
-    0xE9, 0xEB, 0x0E, 0xAD, 0x1B, 0x0D, 0xE5, 0xD7, 0xE2, 0x00, 0xF9, 0x46, 0x41, 0xB3, 0x7A, 0x44,
-    0x03, 0xCF, 0x19, 0xEF, 0xCE, 0x18, 0x70, 0x7E, 0x83, 0x28, 0xCD, 0xE4, 0x9B, 0x55, 0x7A, 0x41,
-    0x68, 0x14, 0x32, 0x9D, 0xA5, 0x75, 0x3A, 0x76, 0xC8, 0x6B, 0x3D, 0x1B, 0x55, 0xC8, 0x49, 0xA2,
-    0xC1, 0x93, 0x0A, 0x74, 0x99, 0x08, 0xE4, 0x93, 0x1B, 0x0F, 0x12, 0x04, 0x5E, 0x50, 0xD1, 0x7E,
-    0x84, 0x17, 0x1B, 0x49, 0x2F, 0xF5, 0x7F, 0x33, 0xAB, 0x26, 0xEF, 0x15, 0x41, 0xE8, 0x5B, 0xD0,
-    0x41, 0xB4, 0x14, 0x67, 0xA3, 0x8F, 0xF1, 0x2D, 0xBB, 0x1E, 0x94, 0x0F, 0x5A, 0x3B, 0xF0, 0x64,
-    0xC0, 0x20, 0xD0, 0x94, 0xDE, 0xA6, 0x38, 0x99, 0x6A, 0xC5, 0x08, 0xE7, 0x98, 0x6C, 0xA6, 0x0F,
-    0xD2, 0xBB, 0x6E, 0xF2, 0x0C, 0x7A, 0x05, 0x08, 0x03, 0x78, 0x3E, 0xBB, 0xB2, 0x14, 0xE2, 0x57,
-    0x40, 0x88, 0x81, 0x0D, 0xAF, 0x72, 0xF2, 0x22, 0x42, 0x6A, 0x73, 0x9A, 0x93, 0xE9, 0xD6, 0x31,
-    0x6C, 0x56, 0x50, 0xD0, 0xE3, 0xC5, 0x2E, 0x80, 0x91, 0xD3, 0xD2, 0x9A, 0xF8, 0x00, 0xE8, 0x30,
-    0xCD, 0x06, 0x86, 0xEB, 0x2F, 0x3A, 0xA8, 0xDD, 0xEF, 0xA5, 0x84, 0x54, 0xBE, 0xC1, 0xF4, 0x55,
-    0x1F, 0x12, 0x3C, 0x65, 0x2B, 0xFB, 0xAC, 0x57, 0xC0, 0xDA, 0x18, 0x68, 0x6D, 0x05, 0x4A, 0x4D,
-    0xF9, 0x50, 0xDC, 0xBD, 0xB4, 0xDD, 0x4E, 0x6C, 0xDC, 0x9B, 0xDB, 0x9D, 0x2E, 0xD8, 0xDB, 0x16,
-    0x6A, 0x34, 0xED, 0xE2, 0x62, 0x8B, 0x23, 0x50, 0xC5, 0xE3, 0x5D, 0xCE, 0x6C, 0x72, 0xA3, 0x39,
-    0xE5, 0xC9, 0x44, 0x3E, 0x34, 0xD6, 0x6A, 0x05, 0x94, 0x86, 0x43, 0x14, 0x44, 0x0A, 0xF8, 0x8C,
-    0x26, 0x98, 0xEA, 0x6E, 0x23, 0x05, 0x2A, 0xE1, 0x61, 0x0D, 0xF1, 0x07, 0x23, 0xA4, 0xA6, 0x93,
-    0x62, 0xBE, 0x03, 0x03, 0xD5, 0xDA, 0xD0, 0x3F, 0x1A, 0x96, 0x10, 0xAC, 0xD1, 0x66, 0x35, 0xB7,
-    0x1E, 0x2A, 0xF9, 0xBC, 0xF7, 0x85, 0x72, 0x3E, 0x4E, 0xB7, 0x3A, 0xCE, 0x31, 0x0D, 0x6E, 0x68,
-    0x61, 0x22, 0x22, 0x95, 0xCA, 0x32, 0xD2, 0x29, 0xC5, 0x9C, 0x90, 0x68, 0xA3, 0xDB, 0xE4, 0x96,
-    0x20, 0xE0, 0x72, 0xB8, 0x27, 0xD1, 0x01, 0x00, 0x79, 0x0C, 0x8C, 0x67, 0xE8, 0x6C, 0xAC, 0x25,
-    0xB8, 0x41, 0xB6, 0xFF, 0x58, 0xC7, 0xAF, 0x2A, 0x12, 0x91, 0x84, 0x46, 0x0F, 0x98, 0x31, 0xAE,
-    0x69, 0x0B, 0xB3, 0x45, 0xF9, 0xD9, 0x9F, 0x4F, 0xF1, 0x22, 0x4E, 0x8D, 0x2D, 0x9C, 0x0A, 0x34,
-    0x15, 0x7F, 0x6B, 0x71, 0x47, 0x60, 0x01, 0xE7, 0x33, 0xC2, 0x02, 0x11, 0xE5, 0x2E, 0x84, 0xC9,
-    0x29, 0xE3, 0xE8, 0x40, 0xCE, 0x0D, 0x28, 0x45, 0xFC, 0xEB, 0xF7, 0x3A, 0x4E, 0x09, 0xC0, 0x74,
-    0x05, 0xE4, 0x3C, 0x58, 0xE4, 0xCC, 0xB3, 0xC2, 0x26, 0xE2, 0x85, 0xAC, 0x5B, 0xA9, 0x97, 0x69,
-    0x4E, 0xCA, 0x44, 0x69, 0x67, 0x01, 0x8A, 0xF9, 0x57, 0xCB, 0x34, 0x27, 0x85, 0xB1, 0xD9, 0x65,
-    0xBA, 0xAA, 0x84, 0x55, 0x06, 0x11, 0xCE, 0x82, 0xCA, 0x85, 0x6A, 0x60, 0x12, 0x70, 0x43, 0x92,
-    0x5E, 0x0E, 0x3B, 0xAF, 0xA6, 0x81, 0xFA, 0x19, 0xAB, 0x75, 0x06, 0x63, 0xE1, 0x9B, 0xC7, 0xDE,
-    0x69, 0x0C, 0x92, 0x8C, 0xDD, 0xA4, 0x63, 0x7C, 0x0C, 0xD2, 0x85, 0x89, 0x9B, 0x28, 0x55, 0xCE,
-    0xEF, 0xCF, 0x24, 0x8B, 0xAE, 0x51, 0x54, 0x02, 0x28, 0x3B, 0xF0, 0x8D, 0x42, 0x9B, 0xCF, 0xB4,
-    0x73, 0x2D, 0x6F, 0xF2, 0x39, 0xFA, 0x51, 0x01, 0x67, 0x3D, 0x07, 0x2D, 0x10, 0xE8, 0xF4, 0x18,
-    0x76, 0x5B, 0xD5, 0x00, 0xF4, 0xD6, 0x18, 0xF3, 0xDE, 0x1C, 0x46, 0xA9, 0xF9, 0xF1, 0xA9, 0x61,
-    0x5B, 0xA3, 0x7A, 0xFA, 0xE4, 0x9A, 0xC9, 0x09, 0xBB, 0x61, 0x90, 0xBB, 0x3A, 0xE0, 0x75, 0x98,
-    0x1F, 0xAF, 0x5F, 0xD7, 0x18, 0xAD, 0x26, 0x1B, 0x5A, 0xFC, 0xB9, 0x49, 0x97, 0x8E, 0x61, 0x50,
-    0xEC, 0xCE, 0x30, 0xCC, 0xB4, 0xE7, 0x29, 0x6E, 0x62, 0xB8, 0x62, 0x8C, 0x23, 0x8D, 0xB2, 0xF2,
-    0x57, 0xA3, 0x91, 0xD6, 0x30, 0xFC, 0xBF, 0xE8, 0x27, 0x30, 0x09, 0x07, 0x43, 0xF2, 0xA1, 0x19,
-    0xFD, 0x22, 0x3E, 0xB1, 0x9B, 0x9A, 0x26, 0x2A, 0x9F, 0x9A, 0x95, 0xF9, 0xE1, 0xCA, 0xA2, 0x4F,
-    0x7F, 0xF8, 0x39, 0x71, 0x24, 0x8B, 0xA4, 0x4E, 0x01, 0x7C, 0xF7, 0x68, 0xB1, 0x4F, 0x80, 0x1D,
-    0x69, 0x04, 0xE6, 0x31, 0xC5, 0x12, 0x7C, 0xD0, 0xEE, 0x34, 0x5D, 0x77, 0xCF, 0x2B, 0x0D, 0x8B,
-    0xBC, 0x92, 0xA6, 0x90, 0xF6, 0xB6, 0xB7, 0x19, 0xD2, 0x18, 0x01, 0x17, 0xF3, 0x4A, 0xCE, 0xED,
-    0xF2, 0x4A, 0xBE, 0xE6, 0x95, 0xFA, 0xE5, 0xBC, 0x52, 0xAA, 0xC1, 0xED, 0x1F, 0x29, 0x71, 0x5F,
-    0x62, 0x61, 0x0D, 0xD8, 0x1F, 0x99, 0x16, 0xFC, 0x6B, 0x9E, 0x80, 0x7D, 0x6D, 0x9F, 0xEA, 0xF5,
-    0xC6, 0x2F, 0x3F, 0xD1, 0x03, 0xDF, 0x74, 0xF4, 0xBB, 0x70, 0x2D, 0xB8, 0x67, 0xF4, 0x09, 0x16,
-    0xB6, 0xFA, 0x0C, 0x27, 0x46, 0x60, 0x87, 0xD1, 0xEC, 0xC7, 0x18, 0x2E, 0x61, 0xE8, 0xD0, 0x1D,
-    0x7E, 0x09, 0x6F, 0x00, 0x01, 0x8A, 0x5A, 0x22, 0x71, 0xA0, 0x01, 0x46, 0x15, 0xCA, 0x80, 0x7A,
-    0x9F, 0xE5, 0x46, 0x83, 0x0A, 0x2C, 0xD4, 0xA3, 0xAA, 0xC0, 0x53, 0x71, 0x4C, 0xFF, 0x59, 0xBD,
-    0xDD, 0x45, 0xEA, 0xB0, 0xE4, 0x4A, 0x1D, 0x6C, 0xD5, 0x87, 0x42, 0x78, 0x5B, 0x0C, 0xB2, 0x14,
-    0x98, 0x9F, 0x66, 0x68, 0x3D, 0xC5, 0x48, 0x01, 0x7F, 0x17, 0x61, 0x0F, 0x85, 0x89, 0x3B, 0x1A,
-    0x89, 0xD7, 0x30, 0xC5, 0xB9, 0xB1, 0x75, 0x53, 0xF2, 0x0C, 0x1F, 0x7C, 0x8E, 0x11, 0xDA, 0xF3,
-    0x10, 0xA7, 0xE8, 0xFD, 0x7A, 0x34, 0x49, 0x5A, 0x3A, 0xA3, 0xB2, 0xAE, 0x09, 0x26, 0x67, 0x98,
-    0xC7, 0xDA, 0x92, 0x6F, 0x2B, 0x92, 0x8C, 0x15, 0x8A, 0xB3, 0x69, 0xC1, 0x9E, 0x68, 0x7B, 0xF4,
-    0xF1, 0x07, 0x93, 0xDB, 0xA4, 0x9E, 0x5B, 0x4D, 0x5A, 0x37, 0x6B, 0x2C, 0xAA, 0x4C, 0x6C, 0xC2,
-    0xD8, 0xE6, 0x9E, 0x3D, 0xC6, 0x47, 0x35, 0x1A, 0xAD, 0x5B, 0xE1, 0x96, 0xC9, 0x67, 0x20, 0xCB,
-    0xDF, 0x70, 0x1B, 0x3F, 0xCB, 0x54, 0x04, 0xD3, 0xE3, 0x36, 0xFB, 0xEC, 0x91, 0xB1, 0xB3, 0x59,
-    0xDC, 0x0E, 0xE3, 0x7D, 0xB0, 0x5D, 0x1B, 0x12, 0x8F, 0x51, 0xEC, 0x5A, 0x2B, 0x03, 0xAB, 0xB1,
-    0x96, 0x2F, 0xD0, 0x38, 0xB5, 0x1A, 0x9E, 0xB1, 0x00, 0x2F, 0x52, 0xAB, 0x13, 0x6B, 0xCB, 0xFE,
-    0x8C, 0x66, 0xEF, 0x00, 0xFF, 0xA2, 0xD6, 0x12, 0x21, 0xC7, 0x17, 0xE8, 0x4F, 0x94, 0xA3, 0x0D,
-    0xC9, 0xBE, 0x30, 0xEE, 0xB3, 0xE4, 0x30, 0x8F, 0x0A, 0x71, 0x45, 0x5A, 0xD0, 0x97, 0x61, 0x03,
-    0xE7, 0xE5, 0x76, 0x8C, 0x01, 0x80, 0xF6, 0x63, 0x73, 0x26, 0x2E, 0x5C, 0x69, 0xB8, 0x29, 0xB9,
-    0x01, 0x09, 0x50, 0x82, 0xCF, 0x2B, 0x7E, 0xC5, 0x1B, 0x00, 0xE5, 0x3F, 0x67, 0x2B, 0xFD, 0xBA,
-    0xC9, 0x24, 0x7A, 0x6C, 0x99, 0xC7, 0x86, 0x2D, 0xE1, 0x30, 0xD7, 0x06, 0xD1, 0x5B, 0x1B, 0x34,
-    0xA6, 0x1B, 0x20, 0x9E, 0xA5, 0x46, 0xD8, 0xA8, 0xB1, 0x63, 0xF3, 0x5E, 0xAC, 0x52, 0x15, 0x8D,
-    0xEC, 0x32, 0xF2, 0x9A, 0x43, 0x46, 0x35, 0xCC, 0x12, 0xD5, 0x8C, 0x1B, 0xAB, 0x0F, 0x08, 0x1B,
-    0xBF, 0x27, 0x5D, 0x7F, 0x4E, 0x74, 0x44, 0xC4, 0x3A, 0x6E, 0xE7, 0x18, 0x2E, 0xAC, 0x75, 0x7A,
-    0x57, 0xC5, 0x36, 0x06, 0x03, 0xE4, 0x8B, 0x45, 0xBD, 0xE3, 0x9F, 0xEA, 0xA6, 0xE1, 0xE1, 0x14,
-    0x49, 0x0F, 0xEC, 0x50, 0x5E, 0xE0, 0xA6, 0x2E, 0x2C, 0x48, 0x50, 0x47, 0x75, 0xFA, 0x8F, 0x72,
-    0x82, 0xA5, 0x84, 0x93, 0x21, 0xF8, 0x0C, 0x99, 0xD0, 0xFF, 0x84, 0x03, 0x21, 0x7C, 0xF8, 0xA5,
-    0x79, 0x26, 0xB4, 0x70, 0xE4, 0x7F, 0x9D, 0xC6, 0x68, 0xFE, 0xF1, 0xDD, 0x32, 0xA1, 0x9F, 0x2F,
-    0xF4, 0xF0, 0x9D, 0x3C, 0x4B, 0xCF, 0x5F, 0x6C, 0x3C, 0x4C, 0x88, 0x49, 0xAF, 0xE9, 0x53, 0x1A,
-    0xA8, 0xF4, 0xC0, 0xD0, 0x43, 0x43, 0x34, 0x91, 0xDD, 0x29, 0xF4, 0x60, 0x0C, 0x46, 0xD6, 0xAD,
-    0x6C, 0x39, 0xDF, 0x64, 0x73, 0x59, 0xF8, 0xC2, 0xDA, 0x45, 0x3A, 0x66, 0x2D, 0x05, 0x2C, 0x75,
-    0xF0, 0x3F, 0xFD, 0x4F, 0x58, 0x61, 0x02, 0x39, 0x2B, 0x85, 0x7E, 0xA2, 0xE8, 0x51, 0x81, 0xA5,
-    0xBD, 0xAD, 0x5C, 0x3B, 0xA9, 0x39, 0x0D, 0x63, 0x53, 0x1D, 0xE6, 0x13, 0x7F, 0x30, 0x59, 0xDB,
-    0x4C, 0x64, 0xD4, 0xD5, 0x60, 0xA8, 0x0E, 0xAD, 0x9D, 0xEB, 0xA8, 0xC0, 0x14, 0xB7, 0x5A, 0x7E,
-    0xC5, 0xF2, 0x25, 0x2B, 0x0F, 0xCA, 0xC2, 0x95, 0xC2, 0xD5, 0x66, 0x7E, 0xE4, 0x93, 0x3B, 0xCC,
-    0xD0, 0x8E, 0x02, 0xD6, 0xCD, 0xE1, 0x2B, 0x33, 0x0B, 0xCF, 0xC8, 0xB5, 0xC1, 0x1D, 0x66, 0x0D,
-    0xA0, 0x73, 0x09, 0xD1, 0x61, 0x4B, 0x58, 0xC1, 0xBB, 0x33, 0x6C, 0x8D, 0x9C, 0x48, 0xDB, 0x17,
-    0xF4, 0x09, 0xAB, 0x6C, 0x96, 0x9B, 0xA6, 0xB3, 0x5E, 0x72, 0x6E, 0x58, 0x35, 0xC9, 0x9A, 0x49,
-    0x16, 0xD6, 0x94, 0x7E, 0xE1, 0x4C, 0x98, 0xC6, 0x84, 0x7B, 0x67, 0x58, 0x17, 0x6C, 0x01, 0x4C,
-    0xED, 0x0D, 0x3F, 0xA4, 0x45, 0x75, 0x88, 0xCF, 0xB5, 0x46, 0xCC, 0x1D, 0x70, 0x56, 0xC0, 0x62,
-    0xEF, 0xF8, 0x5D, 0x20, 0x22, 0xD6, 0x8F, 0xB8, 0xCC, 0xE4, 0x28, 0x56, 0xD0, 0x42, 0xB6, 0xDE,
-    0x16, 0x5B, 0x3B, 0x3B, 0xC3, 0x68, 0x9C, 0xD6, 0xAE, 0xCC, 0x1B, 0xCF, 0x94, 0x08, 0x80, 0xDC,
-    0x71, 0xD0, 0x6D, 0x97, 0x15, 0x41, 0x19, 0xC5, 0x37, 0xD8, 0xD3, 0xBC, 0x05, 0x99, 0x25, 0xB0,
-    0x1F, 0x2B, 0x89, 0x58, 0x55, 0x34, 0x93, 0x00, 0xBA, 0x91, 0x33, 0x8F, 0x30, 0x50, 0xD6, 0x40,
-    0xA2, 0x94, 0xFF, 0xAB, 0xD0, 0x37, 0x86, 0x50, 0x96, 0x95, 0x24, 0xB3, 0xDF, 0xFE, 0x81, 0x14,
-    0x39, 0x45, 0x62, 0x8B, 0x9C, 0xB4, 0xDC, 0xDF, 0x8C, 0x90, 0x8E, 0x3F, 0x13, 0x43, 0x3E, 0x3D,
-    0x7E, 0x3E, 0x35, 0x7E, 0x7E, 0xFF, 0x3E, 0x45, 0xBE, 0x6D, 0xF1, 0x55, 0x58, 0x2D, 0x35, 0x66,
-    0x8C, 0x3C, 0xD8, 0x16, 0xCD, 0xAD, 0xDD, 0x57, 0x57, 0x9B, 0x75, 0x86, 0x0D, 0xC8, 0xAC, 0x4E,
-    0xD3, 0x96, 0xB2, 0x38, 0xD7, 0x1F, 0x45, 0xFE, 0x0B, 0x06, 0xE4, 0x33, 0x35, 0x0E, 0x4F, 0x19,
-    0xC7, 0x87, 0xFA, 0xB4, 0xEA, 0x16, 0x0F, 0x65, 0xF7, 0xB9, 0xC4, 0x57, 0x93, 0xDE, 0xF5, 0x3C,
-    0x25, 0xAB, 0x63, 0x1B, 0x2D, 0x86, 0xB4, 0xBE, 0x47, 0x51, 0xF7, 0x6E, 0x2C, 0x46, 0xD5, 0x92,
-    0x0B, 0x0E, 0xA3, 0x51, 0x04, 0x9F, 0x4C, 0xE1, 0xA2, 0x27, 0x69, 0x43, 0xFC, 0x96, 0x76, 0x20,
-    0xAF, 0x57, 0x19, 0xE8, 0x21, 0x53, 0x0B, 0x3F, 0xA0, 0x29, 0x27, 0x8A, 0xBA, 0xF0, 0x18, 0x3B,
-    0xF5, 0xA7, 0xD0, 0x00, 0xAF, 0xFB, 0x09, 0xBB, 0x7A, 0x53, 0xB4, 0xD7, 0x8A, 0xC4, 0x38, 0x3F,
-    0x5E, 0xF7, 0x5F, 0xE8, 0xCE, 0x3E, 0xBC, 0x44, 0xE8, 0x76, 0xE1, 0x28, 0x17, 0x61, 0x7C, 0x43,
-    0x3B, 0xAE, 0x25, 0xF3, 0xB5, 0x89, 0x1B, 0x2D, 0xB8, 0x21, 0x74, 0x30, 0x84, 0xB0, 0x00, 0x83,
-    0xD5, 0xBC, 0x42, 0xF7, 0xDB, 0xB0, 0x01, 0x7E, 0x23, 0xB6, 0xE4, 0x33, 0x62, 0xC6, 0x03, 0x4C,
-    0xED, 0xCF, 0x4F, 0x9B, 0xE0, 0xA3, 0x17, 0x33, 0x98, 0x0F, 0x3A, 0x37, 0x8C, 0xAC, 0x3C, 0xD2,
-    0xF3, 0x08, 0xBF, 0x4A, 0x61, 0x14, 0xC8, 0x13, 0x30, 0x74, 0x40, 0x7A, 0x72, 0x51, 0x4A, 0x0D,
-    0xFB, 0x59, 0xBE, 0xA7, 0x7D, 0x89, 0x09, 0x4F, 0x80, 0xA2, 0x74, 0xF6, 0x38, 0xF2, 0xFF, 0x17,
-    0x47, 0x9F, 0x6F, 0xE8, 0x87, 0x07, 0x63, 0xA7, 0x0F, 0x93, 0xD4, 0xD0, 0x96, 0xD9, 0x6A, 0xF7,
-    0x7A, 0x9C, 0x3F, 0x47, 0xE8, 0x52, 0x42, 0x2A, 0x31, 0x8B, 0x7D, 0x32, 0x3B, 0x81, 0x9C, 0x7A,
-    0x06, 0xCB, 0x30, 0x2E, 0xAB, 0xF4, 0xA0, 0xAE, 0xCE, 0x60, 0x4C, 0x08, 0x53, 0x29, 0x2A, 0x83,
-    0x17, 0x56, 0x37, 0x6C, 0x61, 0x16, 0x1D, 0xB1, 0x85, 0x05, 0x90, 0xF6, 0x27, 0xC1, 0xE2, 0x7D,
-    0x28, 0x53, 0x0D, 0xEA, 0x03, 0x3F, 0x8A, 0xA6, 0x47, 0x90, 0xB7, 0x82, 0xC4, 0xCB, 0x87, 0xA0,
-    0x0E, 0x32, 0xA6, 0xCE, 0xE3, 0x77, 0xF4, 0x10, 0xAB, 0x44, 0x61, 0xBC, 0xE8, 0x96, 0x29, 0x6B,
-    0x75, 0x28, 0x65, 0x0A, 0x22, 0x05, 0x44, 0x30, 0xCF, 0x9C, 0x38, 0x4C, 0x08, 0xE2, 0x48, 0x11,
-    0x33, 0x48, 0xC5, 0x2C, 0x2F, 0xB0, 0x42, 0x11, 0x63, 0xE2, 0xF3, 0x5F, 0x80, 0x2C, 0x57, 0x10,
-    0x4B, 0xF0, 0x64, 0xD2, 0x8A, 0xAD, 0xB8, 0x52, 0x3E, 0x33, 0x28, 0x45, 0x8B, 0x6F, 0x76, 0x13,
-    0x1E, 0xB1, 0xDE, 0x45, 0xBF, 0xD1, 0x52, 0xF7, 0x8A, 0x76, 0xD9, 0x1D, 0x14, 0x1A, 0xC6, 0x15,
-    0x2B, 0x8F, 0x58, 0x94, 0x46, 0xA5, 0xAC, 0x7C, 0x0D, 0x9F, 0x6C, 0x41, 0xE1, 0x3C, 0x32, 0x49,
-    0x6A, 0x54, 0xED, 0x59, 0x0A, 0x6A, 0xCD, 0xD5, 0xB7, 0xD9, 0x00, 0x58, 0x10, 0x81, 0xAD, 0x78,
-    0x6E, 0x0F, 0xBE, 0xBB, 0x89, 0xA1, 0x1A, 0x95, 0x5B, 0xA5, 0x30, 0x3D, 0xDF, 0xF3, 0xD4, 0xF2,
-    0xA4, 0x34, 0x3C, 0x9E, 0x06, 0xE5, 0x53, 0x56, 0x88, 0x79, 0xB4, 0x3A, 0x26, 0x3D, 0xCB, 0x7B,
-    0xD3, 0xE6, 0xD0, 0xE5, 0x33, 0xE4, 0xF1, 0x28, 0x9D, 0x11, 0x70, 0xCE, 0x72, 0xCD, 0xE3, 0x12,
-    0x0A, 0x6C, 0x15, 0x71, 0x66, 0xB6, 0x68, 0xED, 0x8E, 0xDB, 0x61, 0xFB, 0x14, 0xB6, 0xBA, 0x9C,
-    0x60, 0xDC, 0x6A, 0xED, 0xDB, 0xDD, 0xAF, 0x5A, 0x23, 0x35, 0xB8, 0xA2, 0xCF, 0x1A, 0xEC, 0x56,
-    0x4D, 0x71, 0xBF, 0xD8, 0x8E, 0x31, 0xD7, 0x6E, 0x29, 0xE4, 0xFA, 0x93, 0x79, 0x8A, 0xAD, 0x56,
-    0xAE, 0xAA, 0x6A, 0xA7, 0x29, 0xA0, 0xA5, 0x8D, 0xC8, 0xB4, 0xD9, 0xDB, 0xDE, 0xF7, 0x85, 0x6E,
-    0xA0, 0x0F, 0x5B, 0xB9, 0x78, 0xEC, 0xA0, 0x6F, 0x19, 0x40, 0x37, 0xD5, 0x46, 0x29, 0x31, 0x74,
-    0x9A, 0x79, 0x41, 0xC6, 0x01, 0xB3, 0xAF, 0x12, 0xD0, 0x66, 0xCF, 0xFE, 0x0F, 0x4B, 0xD0, 0x64,
-    0xD0, 0x4E, 0x3C, 0xDA, 0x6A, 0x21, 0x9F, 0x5F, 0x6A, 0x81, 0x1F, 0xEB, 0x83, 0xE1, 0xB9, 0x9F,
-    0xB4, 0xFD, 0x33, 0xB6, 0x22, 0xD0, 0x96, 0x04, 0x5A, 0xBF, 0x55, 0x1A, 0x3B, 0x30, 0xC6, 0x56,
-    0x05, 0xDA, 0xB2, 0x40, 0x63, 0xEB, 0x02, 0xCD, 0x74, 0x95, 0x7E, 0x65, 0x4B, 0x03, 0x8D, 0xAD,
-    0x0D, 0x34, 0x53, 0x71, 0xE0, 0x9C, 0xE5, 0x8B, 0x2E, 0x30, 0xF9, 0x10, 0x5D, 0xDF, 0xCB, 0xD9,
-    0x2B, 0x5D, 0x44, 0x54, 0xFF, 0x80, 0xBB, 0x6E, 0xA9, 0xC9, 0x63, 0x1B, 0xE0, 0x91, 0xED, 0x9D,
-    0xDA, 0x76, 0x5B, 0x13, 0x66, 0xD3, 0x6E, 0x16, 0x70, 0xAD, 0x88, 0x47, 0x0B, 0x5E, 0xE7, 0x62,
-    0xF6, 0xD5, 0x00, 0x26, 0x76, 0x5D, 0x48, 0x47, 0xA5, 0xDA, 0xDB, 0x19, 0x21, 0x88, 0x65, 0xEB,
-    0xCD, 0x98, 0x9D, 0x29, 0x55, 0x50, 0xB9, 0xC6, 0x4B, 0x53, 0x0A, 0x4B, 0x5F, 0xDF, 0x24, 0xEA,
-    0x29, 0xE9, 0xAB, 0x4B, 0xFD, 0x5A, 0xB4, 0x86, 0x84, 0xE5, 0x87, 0x85, 0x5E, 0x4D, 0xE8, 0x59,
-    0x6A, 0xC1, 0x92, 0xBD, 0x5A, 0xC3, 0x8B, 0x2C, 0x5D, 0xAA, 0xED, 0xCD, 0xF3, 0xB3, 0x39, 0x70,
-    0xCD, 0x95, 0x99, 0x68, 0x09, 0x58, 0xED, 0xB7, 0x0A, 0x4F, 0x8A, 0x91, 0x91, 0x39, 0x63, 0x53,
-    0x83, 0xB1, 0x9A, 0x46, 0xD5, 0xCA, 0xAC, 0xE6, 0xDD, 0x98, 0x90, 0xB4, 0x01, 0x91, 0xA8, 0x32,
-    0xFB, 0xEA, 0x58, 0x8D, 0x1D, 0x79, 0x80, 0x65, 0x6A, 0x34, 0x00, 0x8C, 0x26, 0x5D, 0x12, 0xC6,
-    0x70, 0xF9, 0xC7, 0x8A, 0xFE, 0x71, 0x9D, 0x52, 0x34, 0xD3, 0xFA, 0x87, 0x24, 0xDA, 0x65, 0x42,
-    0x70, 0xA6, 0xE5, 0x2A, 0x38, 0x8D, 0x31, 0xFA, 0x19, 0x59, 0x0B, 0x29, 0x81, 0xAB, 0x91, 0xA8,
-    0x22, 0xBE, 0x88, 0x76, 0x75, 0xAE, 0x7D, 0xB0, 0x56, 0xB3, 0xD9, 0xCC, 0x8A, 0x86, 0x85, 0xE7,
-    0x6D, 0x38, 0xD1, 0x2D, 0x56, 0x18, 0xD8, 0x58, 0xC6, 0x8F, 0x13, 0xE5, 0x9A, 0xEC, 0x4E, 0xBA,
-    0xAB, 0x3D, 0xCA, 0x36, 0xAF, 0x18, 0x42, 0x72, 0x06, 0xFD, 0xFC, 0x3D, 0xA5, 0x1F, 0x75, 0x4E,
-    0x6B, 0x5A, 0xC6, 0x10, 0xAA, 0xB8, 0xA0, 0xA1, 0x48, 0xE7, 0x5B, 0x59, 0xEC, 0x97, 0x44, 0x0D,
-    0xC4, 0x0D, 0x0C, 0xD2, 0xC7, 0x30, 0x5E, 0xB8, 0xB6, 0xE5, 0xFA, 0xB0, 0x60, 0xF0, 0xB4, 0x7E,
-    0xE8, 0x2D, 0xA9, 0xBF, 0xA1, 0x48, 0x9C, 0xF1, 0xB0, 0x9B, 0x74, 0xE1, 0x07, 0x69, 0xB0, 0x57,
-    0xB6, 0xC6, 0x05, 0x1D, 0x71, 0x75, 0x90, 0x15, 0x72, 0xCC, 0x1F, 0x00, 0xBD, 0x0E, 0x7E, 0x2D,
-    0xE0, 0xDF, 0xE7, 0xFA, 0xB8, 0x1C, 0xBC, 0x56, 0xBC, 0x36, 0x7C, 0xAF, 0x0F, 0xAB, 0xF4, 0x71,
-    0x1C, 0xEA, 0x70, 0x6F, 0xC6, 0xFF, 0x86, 0xDC, 0xE4, 0x6F, 0x6A, 0xF8, 0x58, 0x3E, 0xC8, 0x08,
-    0xA5, 0xCD, 0xCA, 0xFA, 0xC1, 0xAF, 0xAC, 0xD6, 0x72, 0xD7, 0x52, 0x09, 0x2D, 0x8A, 0xEB, 0x34,
-    0xDD, 0xAC, 0x45, 0x7E, 0xCE, 0xB4, 0x2A, 0xE1, 0x8B, 0xE6, 0x3A, 0xE1, 0x02, 0x26, 0x08, 0xD2,
-    0x69, 0xE1, 0xE3, 0xA1, 0xEC, 0xAB, 0xAD, 0xE8, 0xFC, 0xED, 0x68, 0xFA, 0xE3, 0x11, 0xBF, 0xCE,
-    0x71, 0x66, 0x3F, 0x37, 0x6E, 0x0A, 0xEA, 0xBE, 0xFF, 0x25, 0x72, 0xB0, 0x3A, 0x03, 0x8C, 0x7D,
-    0x16, 0xE3, 0x42, 0xD6, 0x76, 0xBC, 0x7F, 0xB4, 0x9F, 0x1A, 0x33, 0x41, 0x19, 0xC9, 0x07, 0xB4,
-    0x1E, 0x4D, 0xCA, 0xEA, 0x3B, 0xEA, 0x20, 0x1C, 0x4C, 0xE5, 0xB1, 0xD2, 0x9E, 0x57, 0x69, 0x38,
-    0x23, 0xAA, 0x09, 0xEA, 0x99, 0x9D, 0xD5, 0x58, 0xBE, 0x56, 0x61, 0x8F, 0xEA, 0xA6, 0x16, 0x20,
-    0xE8, 0xE6, 0xEB, 0x67, 0x16, 0x07, 0xB5, 0x94, 0x50, 0x71, 0x59, 0x34, 0xD1, 0x5A, 0x18, 0xBD,
-    0x23, 0x20, 0x47, 0x53, 0x32, 0xD8, 0xBD, 0x4D, 0x32, 0x38, 0xDF, 0x9F, 0x0C, 0x1E, 0xDA, 0xD1,
-    0xA3, 0x2F, 0x92, 0xC1, 0x74, 0x94, 0x1A, 0x3C, 0x51, 0x0D, 0xB3, 0x21, 0xC3, 0x4C, 0x3D, 0x24,
-    0x1F, 0x07, 0x00, 0x31, 0xA5, 0x5B, 0x3F, 0x43, 0xE7, 0x0E, 0xCF, 0x3B, 0xD7, 0xEF, 0xEF, 0x5C,
-    0x3E, 0x16, 0xDE, 0x01, 0x84, 0x9C, 0x60, 0x96, 0xFD, 0x4B, 0x76, 0xAE, 0x1A, 0x33, 0xDD, 0x67,
-    0xA7, 0xCE, 0xF5, 0xF0, 0xC9, 0xEE, 0x5E, 0x33, 0x66, 0xBA, 0x03, 0x96, 0xD7, 0xE5, 0x83, 0x56,
-    0xD4, 0x8E, 0xEC, 0xE3, 0x53, 0x3B, 0xC7, 0x55, 0x5C, 0x7C, 0x22, 0xC0, 0x6C, 0xA7, 0x10, 0x2B,
-    0xB1, 0xB5, 0xB1, 0x00, 0xBA, 0x39, 0xF3, 0xE2, 0xCF, 0xB7, 0xBC, 0x13, 0xC5, 0xC2, 0x1D, 0xE3,
-    0x5A, 0xC5, 0x3C, 0xAE, 0x45, 0xFD, 0x1A, 0xAB, 0x63, 0xC3, 0xEB, 0xFC, 0x72, 0x20, 0x55, 0x02,
-    0xE2, 0x69, 0xC7, 0xF2, 0x58, 0xBF, 0x25, 0xDC, 0xCA, 0xAF, 0x38, 0xB2, 0x1B, 0xD2, 0xF2, 0x76,
-    0x8B, 0xFA, 0x58, 0x9B, 0x6F, 0xD0, 0xDB, 0xA8, 0x7B, 0x34, 0xBE, 0xDA, 0x36, 0x0D, 0x9F, 0x9A,
-    0x7F, 0xFD, 0x25, 0xF3, 0xDC, 0x0D, 0xF3, 0xDC, 0x37, 0x41, 0xE8, 0x65, 0x8A, 0x6A, 0x0F, 0x53,
-    0x7E, 0xFA, 0xF4, 0x2D, 0x92, 0x4B, 0x33, 0xDE, 0xE8, 0xF2, 0x08, 0xB9, 0x80, 0x41, 0x7F, 0x67,
-    0x48, 0x3D, 0x49, 0xE0, 0xF1, 0x4E, 0xE3, 0x4E, 0x4D, 0xFC, 0x16, 0xF0, 0xE3, 0xAC, 0x90, 0xA3,
-    0x09, 0xD7, 0x25, 0xF4, 0x3A, 0x7D, 0xC4, 0x74, 0x9D, 0x46, 0xF3, 0x38, 0x83, 0x1C, 0xAE, 0xCF,
-    0xFD, 0x15, 0x49, 0xB9, 0xFC, 0xCE, 0xD8, 0x8A, 0x4E, 0x77, 0xA9, 0x00, 0x75, 0x4C, 0xC2, 0xC8,
-    0x72, 0x71, 0xA7, 0x6F, 0x9D, 0x94, 0x1D, 0x98, 0x71, 0x64, 0xB4, 0xD5, 0x21, 0xEB, 0x8B, 0xBB,
-    0x74, 0x08, 0x5E, 0xB8, 0x01, 0x3D, 0xFE, 0x41, 0x74, 0xA9, 0x10, 0xD3, 0xE4, 0x8F, 0xC3, 0x7B,
-    0x3C, 0xDA, 0x1F, 0x60, 0xE8, 0xA8, 0xE1, 0xFD, 0xE0, 0x8F, 0xB8, 0xA4, 0x24, 0xC1, 0x61, 0x78,
-    0x9B, 0x5B, 0x0E, 0x33, 0x5E, 0x9A, 0xE8, 0x9A, 0x50, 0x0D, 0xE4, 0xC8, 0xE2, 0xB1, 0x3A, 0x56,
-    0x36, 0x99, 0x6F, 0xCD, 0xC8, 0x52, 0x3A, 0x5F, 0x65, 0xF4, 0x3C, 0x0B, 0x32, 0xE0, 0xB3, 0xBA,
-    0x55, 0x60, 0xFE, 0xD1, 0xE9, 0x8E, 0x85, 0xC3, 0x5A, 0x3B, 0x6C, 0xCB, 0x87, 0xED, 0x61, 0x98,
-    0xCB, 0x98, 0x65, 0xA0, 0xFF, 0xD3, 0x2A, 0x83, 0x16, 0x5E, 0x50, 0x98, 0x1E, 0x7C, 0x55, 0x95,
-    0xC0, 0xEA, 0x83, 0x55, 0x0D, 0x5B, 0x43, 0xAC, 0x87, 0x67, 0x18, 0xA2, 0x51, 0x39, 0x9C, 0x4F,
-    0x0A, 0x8D, 0x6D, 0xA6, 0x1D, 0x9C, 0x65, 0xA1, 0x99, 0xB1, 0x4A, 0xED, 0x05, 0x60, 0x98, 0x9E,
-    0xC0, 0x37, 0xD3, 0x62, 0x83, 0x88, 0xEB, 0xEB, 0xE0, 0xFD, 0x08, 0x1E, 0x14, 0x3E, 0xF4, 0x46,
-    0x23, 0x50, 0xCE, 0xB6, 0x2E, 0x47, 0xD5, 0x52, 0xF5, 0x69, 0xB1, 0xA1, 0xB2, 0x54, 0x5B, 0x25,
-    0xAF, 0xD9, 0x18, 0x0D, 0x1A, 0xA4, 0x13, 0x52, 0x9C, 0xE9, 0x52, 0xCD, 0xCF, 0x5E, 0x44, 0x7D,
-    0x80, 0xBB, 0x81, 0x16, 0x51, 0xD7, 0x5A, 0xAC, 0x7E, 0x6B, 0x11, 0x75, 0xA3, 0x7A, 0xAB, 0xBD,
-    0xAE, 0x3F, 0xBD, 0x88, 0x9A, 0xF0, 0x54, 0x88, 0x14, 0x2A, 0xE6, 0x22, 0x98, 0x4D, 0x86, 0xB4,
-    0x63, 0xA7, 0xFB, 0xCF, 0xE0, 0x35, 0x6F, 0x44, 0x5A, 0xCC, 0x44, 0xFA, 0x03, 0x6A, 0xCE, 0xD0,
-    0xAF, 0x4F, 0xF7, 0xF8, 0xEF, 0x64, 0x5C, 0x07, 0x0B, 0xE0, 0x43, 0x2C, 0x36, 0xB9, 0x03, 0x63,
-    0x69, 0xBB, 0x46, 0x57, 0xC6, 0x50, 0x8E, 0x5D, 0x9D, 0xBB, 0x6F, 0x97, 0xA1, 0xCE, 0x54, 0x93,
-    0x10, 0x8A, 0x76, 0xD2, 0x1B, 0xA1, 0x8C, 0x6B, 0x73, 0xF7, 0x2D, 0x01, 0x37, 0xBA, 0x1B, 0x8C,
-    0xBB, 0x6B, 0x8C, 0x8A, 0x3C, 0xAE, 0x2B, 0x73, 0x45, 0x7E, 0xC3, 0xDE, 0xEE, 0x4B, 0xAA, 0xAD,
-    0x2D, 0x02, 0x50, 0xCD, 0xE8, 0x72, 0x40, 0xD1, 0x9E, 0x84, 0x72, 0x03, 0x72, 0x85, 0xE3, 0x72,
-    0x42, 0xE0, 0xB5, 0x32, 0xBD, 0x53, 0x06, 0xED, 0x53, 0x93, 0x6A, 0x87, 0x4E, 0x9A, 0x89, 0xA6,
-    0xD8, 0x92, 0x64, 0xB9, 0x9A, 0xEB, 0x1A, 0xF0, 0xA0, 0x0D, 0x5C, 0x26, 0x53, 0x62, 0xF2, 0xB3,
-    0x3E, 0x65, 0x78, 0xAF, 0x4F, 0x41, 0xB9, 0xB1, 0xD5, 0x94, 0x84, 0xFA, 0xE8, 0x6E, 0xD5, 0x42,
-    0x55, 0x6D, 0xDE, 0x18, 0xBD, 0xB7, 0xF3, 0x62, 0x97, 0xA3, 0xFA, 0x0A, 0x16, 0x5C, 0xB4, 0xF1,
-    0x17, 0x0A, 0xC0, 0x6D, 0x08, 0x51, 0xAD, 0xB0, 0x5D, 0xF0, 0xB4, 0x6E, 0x26, 0x40, 0xA4, 0x79,
-    0xA7, 0xCE, 0x39, 0x32, 0x9C, 0xE8, 0x1E, 0x09, 0xAB, 0xE0, 0xC3, 0x06, 0x14, 0xF6, 0x9D, 0xF7,
-    0x41, 0x79, 0x1F, 0xE7, 0x75, 0x91, 0xAD, 0xCA, 0xDC, 0xD8, 0x48, 0x34, 0xFE, 0x69, 0x29, 0x5C,
-    0x03, 0x7E, 0xA0, 0x8C, 0xDC, 0xE6, 0xD3, 0x39, 0x47, 0xB6, 0xDE, 0xE0, 0xEB, 0xED, 0x94, 0x05,
-    0xCB, 0xB6, 0x6A, 0xC5, 0x6E, 0x35, 0xFE, 0x30, 0x2E, 0x2C, 0xD0, 0x9A, 0x95, 0x7B, 0xD1, 0x65,
-    0x19, 0xBB, 0xAC, 0xC9, 0x01, 0x7D, 0xCE, 0xD3, 0x54, 0x39, 0x5D, 0x6D, 0x5F, 0x8E, 0x69, 0xB5,
-    0x2F, 0xFC, 0x62, 0x02, 0x86, 0x84, 0xEC, 0x1A, 0x70, 0xCD, 0x43, 0x6A, 0xB8, 0x3F, 0xB4, 0x9F,
-    0x62, 0xD7, 0x5F, 0x8F, 0x05, 0x1E, 0x8B, 0x12, 0x8F, 0xA5, 0xE5, 0xBD, 0x7F, 0x40, 0x6B, 0x2B,
-    0x35, 0xD7, 0x3A, 0x25, 0x83, 0x4C, 0xAF, 0xF9, 0x8C, 0xA0, 0xB6, 0x4E, 0xDB, 0xD2, 0x9B, 0x9D,
-    0x57, 0xE6, 0xBD, 0xFB, 0x8E, 0xF6, 0x10, 0x0F, 0x04, 0x31, 0x61, 0xDC, 0x91, 0x01, 0xC8, 0xDE,
-    0x05, 0xB9, 0x4A, 0xFC, 0x3A, 0x2E, 0x18, 0x72, 0x3B, 0xD2, 0xB1, 0x13, 0x9D, 0x66, 0xA2, 0xFC,
-    0x9B, 0xC3, 0x30, 0xBA, 0x4D, 0xDC, 0xEC, 0xFD, 0x1E, 0xCD, 0xF6, 0xF1, 0x0D, 0x83, 0xE4, 0x47,
-    0x18, 0x33, 0x8B, 0x71, 0x0D, 0x5A, 0xC8, 0x1B, 0x0C, 0xAC, 0x9A, 0x6F, 0xA3, 0x36, 0xAD, 0x23,
-    0x49, 0xF2, 0x52, 0x63, 0x44, 0x3A, 0xAC, 0xEB, 0x2C, 0xAD, 0xEE, 0x58, 0x39, 0xD1, 0xAD, 0x41,
-    0x8F, 0x99, 0x2A, 0x90, 0x5F, 0x70, 0x31, 0x31, 0x53, 0x9A, 0xB5, 0x0D, 0xC8, 0x79, 0x7C, 0xA6,
-    0x37, 0x99, 0x1E, 0x0D, 0x00, 0x94, 0x1C, 0x7F, 0xC6, 0xF0, 0x62, 0xBE, 0xF4, 0x23, 0x68, 0xB9,
-    0xE1, 0xB5, 0xBE, 0xDD, 0xAC, 0x69, 0x25, 0x36, 0x86, 0x8A, 0xF4, 0x4E, 0x05, 0x4B, 0x23, 0xD5,
-    0x71, 0x69, 0xE3, 0x92, 0xCE, 0x8E, 0x8C, 0x65, 0x81, 0x63, 0x02, 0xF8, 0x21, 0xAE, 0x06, 0x62,
-    0xFD, 0x6E, 0x0D, 0x46, 0xC4, 0x72, 0x9F, 0xD2, 0xED, 0xF1, 0x60, 0x39, 0x5A, 0xA9, 0x03, 0xE0,
-    0x4B, 0x38, 0xDC, 0x61, 0x53, 0x8B, 0xB9, 0x58, 0x06, 0xD5, 0x92, 0xC9, 0xB1, 0x62, 0xED, 0x0D,
-    0xA9, 0xC3, 0x8F, 0xB8, 0xD6, 0x79, 0x04, 0x90, 0xAC, 0xD8, 0xA3, 0x67, 0xC2, 0x83, 0x68, 0x4C,
-    0x35, 0x94, 0xF4, 0xBD, 0xEC, 0xFE, 0x2E, 0x7A, 0x14, 0x5D, 0xF4, 0x58, 0xAD, 0x8F, 0x61, 0x07,
-    0x45, 0x7B, 0xD6, 0x81, 0x59, 0x3E, 0x60, 0xB5, 0xB4, 0x5E, 0xB4, 0x29, 0xD3, 0xAA, 0xFC, 0xF0,
-    0x2A, 0xD7, 0x5F, 0x31, 0xDE, 0x7E, 0x1A, 0x58, 0x4D, 0xAB, 0x75, 0x83, 0x22, 0xCF, 0xB4, 0x64,
-    0xD7, 0x69, 0x71, 0xC8, 0x2F, 0x59, 0xC0, 0x0B, 0x2F, 0xC3, 0x9A, 0x5D, 0xF8, 0xB8, 0xA0, 0xF7,
-    0x89, 0x95, 0x42, 0x08, 0x4B, 0xB7, 0xB2, 0x94, 0x69, 0x57, 0x0C, 0xA7, 0x2A, 0xF5, 0xC8, 0x6D,
-    0x22, 0x1C, 0x5F, 0xD9, 0x5A, 0x47, 0xC6, 0x61, 0x19, 0xE4, 0xA3, 0xCF, 0x28, 0xD4, 0xB0, 0xA8,
-    0x31, 0xEA, 0xE6, 0xF9, 0x56, 0x45, 0x15, 0xAB, 0x79, 0x33, 0xAD, 0x4B, 0x33, 0xF9, 0xD6, 0xD4,
-    0x34, 0x5B, 0xFC, 0x98, 0x8B, 0x37, 0x79, 0x92, 0xA5, 0x8A, 0xDB, 0x45, 0x51, 0xF0, 0xDE, 0xA9,
-    0xDB, 0xD5, 0xE5, 0x32, 0x44, 0x54, 0x53, 0x7C, 0x8A, 0x91, 0x37, 0xA9, 0x31, 0x63, 0x28, 0x4C,
-    0x73, 0x65, 0x69, 0x33, 0xA6, 0xDE, 0xD7, 0xB6, 0xCC, 0xD7, 0x15, 0xFC, 0xEA, 0x16, 0xD1, 0x1D,
-    0xFB, 0x6E, 0x1C, 0x9B, 0x6E, 0x0D, 0xAA, 0xF9, 0xCB, 0x31, 0x6C, 0x80, 0x5A, 0x8B, 0xA6, 0xBE,
-    0x6C, 0x91, 0xF4, 0x51, 0x16, 0x49, 0xF3, 0x15, 0x21, 0xC3, 0x24, 0x76, 0xFA, 0x82, 0x0B, 0x25,
-    0x0C, 0xD5, 0xFE, 0x57, 0x25, 0xDC, 0xA7, 0xC5, 0x67, 0xBA, 0xAA, 0xD2, 0x55, 0x37, 0x69, 0xDF,
-    0xDE, 0xD0, 0xCD, 0x5F, 0xBB, 0x61, 0xF9, 0x86, 0x05, 0x8D, 0xBF, 0xFC, 0x92, 0x15, 0xAA, 0xE9,
-    0x72, 0x85, 0x6A, 0x3E, 0x75, 0xFE, 0x69, 0x5D, 0xF7, 0x3F, 0x29, 0x43, 0xB2, 0xE8, 0x79, 0x8B,
-    0x76, 0x95, 0x8C, 0xA3, 0xB0, 0x18, 0x05, 0x68, 0x27, 0x1E, 0xCC, 0xB8, 0x0E, 0x99, 0x8E, 0x87,
-    0xF7, 0x38, 0x23, 0x86, 0xF6, 0xB5, 0x97, 0xC3, 0x74, 0x14, 0x76, 0x21, 0x32, 0x2D, 0x2F, 0xD8,
-    0x0D, 0x3E, 0x2E, 0xBC, 0xCB, 0x8F, 0xE8, 0xD7, 0x25, 0x97, 0x66, 0xE8, 0x4A, 0x64, 0x7C, 0xC0,
-    0x6C, 0xF3, 0x55, 0x1D, 0xC4, 0xB6, 0x33, 0x56, 0x89, 0x00, 0xE2, 0xDA, 0xA5, 0xC8, 0x6E, 0xEB,
-    0xF4, 0x76, 0xB5, 0x6C, 0xC7, 0x25, 0x33, 0x52, 0x24, 0x3A, 0xF0, 0x8B, 0xB5, 0xC8, 0x56, 0x30,
-    0x46, 0xC9, 0x18, 0x45, 0x63, 0x94, 0x0D, 0xFB, 0xA2, 0x8B, 0x49, 0x3A, 0x94, 0x5F, 0x4A, 0x8B,
-    0x36, 0x46, 0xCC, 0x5D, 0xB8, 0x94, 0x86, 0x04, 0xAA, 0x47, 0x9A, 0x9A, 0x05, 0x97, 0xCF, 0x7D,
-    0xDC, 0x9A, 0x7E, 0xF8, 0x01, 0x88, 0x2A, 0x0B, 0xF3, 0x4D, 0x1F, 0x77, 0xD8, 0x7D, 0x4B, 0x8E,
-    0x60, 0x17, 0xFE, 0x2C, 0xD3, 0xCA, 0x7C, 0xD3, 0xCF, 0x92, 0xB4, 0x64, 0x9F, 0x21, 0x66, 0x85,
-    0x27, 0x8B, 0xF9, 0x50, 0xEF, 0x64, 0xCE, 0xE8, 0x63, 0xF4, 0xD9, 0xAF, 0x99, 0x11, 0x65, 0x7B,
-    0x32, 0xA4, 0x84, 0x81, 0x14, 0xB6, 0xF2, 0x33, 0x6C, 0xBC, 0xC1, 0xE3, 0x34, 0x96, 0x40, 0x09,
-    0x7F, 0xA2, 0xD3, 0xD0, 0xE9, 0x2B, 0x36, 0x48, 0x15, 0x07, 0x5B, 0x31, 0xD1, 0xEE, 0x7F, 0x9D,
-    0x88, 0x31, 0x4F, 0x2E, 0x5E, 0x1B, 0xA5, 0xC2, 0x63, 0x23, 0xE2, 0xB1, 0xE5, 0xE9, 0xCA, 0x02,
-    0x2E, 0xF3, 0x9A, 0x98, 0x50, 0xDA, 0x69, 0x39, 0xEF, 0x41, 0xC9, 0x13, 0x53, 0x7D, 0x75, 0x04,
-    0x05, 0xC5, 0x04, 0x57, 0x19, 0x91, 0xCB, 0xC5, 0xE2, 0x6B, 0xD6, 0xA5, 0xBD, 0xBD, 0xC1, 0xE1,
-    0x62, 0x11, 0x3B, 0xC0, 0x00, 0x2D, 0xC7, 0x15, 0x13, 0x42, 0x47, 0x1A, 0x8F, 0x41, 0x20, 0xBE,
-    0xBE, 0xC3, 0x31, 0x0F, 0xC0, 0x5A, 0xFE, 0x00, 0xBF, 0xA9, 0x09, 0x3E, 0xA4, 0x39, 0xE8, 0x16,
-    0xA6, 0xE9, 0x5E, 0xAC, 0x65, 0x5A, 0xCD, 0xFE, 0x9A, 0xD2, 0xF9, 0x9C, 0x86, 0x71, 0x34, 0xA0,
-    0xD3, 0x52, 0x0D, 0x9C, 0x69, 0xCD, 0x86, 0xC6, 0xFB, 0x17, 0x4B, 0x09, 0x95, 0x70, 0x39, 0x9A,
-    0x03, 0x09, 0xC6, 0xAC, 0x02, 0x17, 0xBE, 0x7E, 0xAC, 0xB4, 0xF9, 0x0D, 0x9E, 0xF2, 0x34, 0x1D,
-    0xAA, 0xDB, 0x28, 0x38, 0x29, 0x88, 0x95, 0x28, 0x60, 0xC6, 0xDD, 0x7D, 0x62, 0xCE, 0xE6, 0x74,
-    0x01, 0xAA, 0x77, 0x63, 0x03, 0x8C, 0x1F, 0x8F, 0xCA, 0x4B, 0xA7, 0xD7, 0x92, 0xDD, 0x5D, 0x74,
-    0xEE, 0xEF, 0xB8, 0x1A, 0x0F, 0xD3, 0xCE, 0x01, 0xB0, 0xE2, 0x54, 0x9D, 0xC1, 0xA0, 0x8B, 0xFE,
-    0xFA, 0xD9, 0x4F, 0x17, 0x6D, 0xBA, 0x37, 0xEB, 0xB8, 0x16, 0x6E, 0xCE, 0x56, 0x69, 0x28, 0xD1,
-    0xF1, 0xED, 0x0A, 0x59, 0xF7, 0x66, 0x4F, 0x59, 0x9B, 0x75, 0xF0, 0x20, 0x38, 0xB7, 0x8F, 0x4B,
-    0x26, 0x5F, 0x73, 0x5B, 0x92, 0x92, 0xAA, 0x52, 0x43, 0x2C, 0x65, 0xFB, 0x24, 0x3B, 0xAA, 0xC1,
-    0xB5, 0xA0, 0xD2, 0xBC, 0x95, 0xBF, 0x7B, 0x7C, 0xD8, 0xB0, 0xB7, 0x4B, 0xEC, 0x82, 0xAA, 0xD2,
-    0x24, 0x8E, 0x42, 0xCD, 0xA7, 0x30, 0xD9, 0x14, 0x40, 0xE6, 0x15, 0x71, 0x5B, 0x34, 0x8F, 0xBE,
-    0xBE, 0x66, 0x22, 0x45, 0x6B, 0x04, 0x0A, 0x7D, 0x25, 0x9A, 0xF9, 0x56, 0xB2, 0xC2, 0x04, 0xE7,
-    0xF3, 0x5A, 0x05, 0x0D, 0x0A, 0x3D, 0x9C, 0x90, 0x27, 0x7A, 0xED, 0xE2, 0x47, 0x8D, 0xAF, 0xB5,
-    0x8C, 0xE9, 0xCB, 0x3B, 0x35, 0x70, 0x0A, 0x57, 0x86, 0x88, 0xEC, 0xFD, 0x9D, 0x7C, 0xA0, 0xF5,
-    0xD9, 0x70, 0xE6, 0x30, 0x49, 0xBA, 0x12, 0x13, 0x50, 0xF9, 0x38, 0x18, 0x20, 0xF5, 0xE2, 0x26,
-    0xEB, 0x72, 0xDB, 0x00, 0xBE, 0xF2, 0x98, 0xA2, 0xD5, 0xAD, 0x59, 0x66, 0x5E, 0x87, 0x6D, 0x8B,
-    0x32, 0xC8, 0xD3, 0x20, 0xA3, 0xC3, 0x3B, 0xB6, 0xFF, 0x2D, 0x4D, 0xB4, 0xD2, 0x5C, 0xB4, 0xC8,
-    0xC4, 0xE2, 0xEB, 0x04, 0xC7, 0xCC, 0xF3, 0x67, 0xF3, 0x85, 0x8F, 0xC3, 0xF6, 0x2B, 0x8E, 0x68,
-    0xB1, 0x2A, 0xE6, 0x66, 0x77, 0x23, 0x59, 0x5E, 0x1A, 0xC9, 0x4B, 0x9E, 0xA6, 0x73, 0xF8, 0xDB,
-    0xB1, 0x92, 0x9D, 0x45, 0x5C, 0x2A, 0xC9, 0xAF, 0xCF, 0x6A, 0xBF, 0x8A, 0x93, 0xF4, 0x68, 0xCD,
-    0x22, 0xF0, 0xD5, 0xE1, 0x4B, 0xD7, 0x18, 0x1F, 0x7A, 0xD5, 0x12, 0x71, 0x2D, 0xAC, 0x0C, 0x86,
-    0x1D, 0x4C, 0x38, 0x9C, 0x60, 0x56, 0xEB, 0x6B, 0xD0, 0x8C, 0x66, 0x95, 0x34, 0x58, 0xAF, 0x62,
-    0xCB, 0x12, 0x2E, 0x11, 0xF2, 0x8A, 0x8E, 0x41, 0x8C, 0x8F, 0x88, 0x44, 0x2F, 0x92, 0x02, 0x01,
-    0xB9, 0xE8, 0xF2, 0x41, 0x2E, 0x0F, 0x0D, 0x3A, 0x9D, 0x30, 0x2D, 0xE3, 0x74, 0x74, 0x02, 0xB5,
-    0x1E, 0xEA, 0x47, 0x09, 0xCB, 0x73, 0xF1, 0x74, 0x7F, 0x37, 0xEF, 0x7E, 0xC2, 0xD6, 0xB0, 0x9A,
-    0x22, 0xBA, 0xBA, 0xF1, 0xC4, 0xBC, 0x9D, 0x49, 0x74, 0xB9, 0x61, 0x25, 0x59, 0xFA, 0xFC, 0xB0,
-    0x59, 0xD3, 0xAB, 0x90, 0x21, 0xB0, 0x6A, 0xF7, 0xE7, 0xAB, 0x9C, 0x16, 0xDC, 0x3F, 0xA6, 0x51,
-    0x4E, 0x61, 0xEC, 0xCC, 0x81, 0xE9, 0x3D, 0x7B, 0x0E, 0x8B, 0x57, 0x72, 0x7D, 0xD3, 0x1A, 0xD3,
-    0xA1, 0xD7, 0xA4, 0x83, 0x21, 0x48, 0xDB, 0x40, 0xCB, 0x86, 0xED, 0x1B, 0xDD, 0xCC, 0xBC, 0x84,
-    0x2B, 0xD0, 0x75, 0x75, 0xFF, 0xCC, 0x5E, 0xBC, 0xA1, 0x21, 0x62, 0x80, 0xB0, 0x8E, 0x15, 0x27,
-    0x6F, 0xB1, 0x90, 0x4A, 0x91, 0x6E, 0x40, 0x0C, 0x18, 0xD9, 0x08, 0x36, 0xC1, 0x20, 0xB1, 0xB7,
-    0x63, 0xA7, 0x16, 0x0E, 0xA0, 0xC0, 0x99, 0xEC, 0xAE, 0x9F, 0xBD, 0x36, 0xCD, 0xF5, 0xCA, 0x4B,
-    0xAC, 0xA1, 0x67, 0xD5, 0x49, 0xFE, 0x0F, 0x72, 0x21, 0xD1, 0x57, 0xD9, 0x00, 0x9A, 0x0E, 0x1B,
-    0x1B, 0xE9, 0xB4, 0x12, 0xAF, 0x99, 0xF5, 0x20, 0xCF, 0x6F, 0xB4, 0x5E, 0x9B, 0xFE, 0x13, 0x05,
-    0xB5, 0xF4, 0x99, 0xC5, 0x5F, 0xD7, 0xF2, 0xF9, 0x07, 0x2D, 0x49, 0xEA, 0x2C, 0xE9, 0xF3, 0xC6,
-    0x4F, 0xB7, 0xB3, 0xC4, 0xCF, 0x24, 0x2B, 0x7F, 0xD0, 0xE4, 0xC8, 0xCC, 0x6D, 0x90, 0xBE, 0xAA,
-    0x67, 0x89, 0x1C, 0xFD, 0xD4, 0xDB, 0xBA, 0xA5, 0xFA, 0xF5, 0xFE, 0x92, 0xA3, 0xD9, 0xD6, 0x21,
-    0x08, 0x2E, 0x50, 0xB5, 0xBC, 0x00, 0xEC, 0x73, 0x16, 0x98, 0x2E, 0x79, 0x60, 0x92, 0xA8, 0x84,
-    0x6F, 0xA4, 0xE3, 0xFC, 0xD7, 0xB4, 0x44, 0x4A, 0x05, 0xA0, 0xBF, 0x75, 0x44, 0x14, 0x9C, 0xCC,
-    0xF4, 0xB1, 0x38, 0x4B, 0xEC, 0x9B, 0xFE, 0x34, 0x13, 0xFD, 0x43, 0x19, 0x2B, 0xE7, 0x5D, 0xF1,
-    0x32, 0xE8, 0x09, 0x9E, 0xFF, 0x11, 0xEE, 0xD0, 0xE4, 0xBB, 0x69, 0xA7, 0x4B, 0xBB, 0x29, 0xA1,
-    0xCE, 0x8F, 0xAC, 0xC5, 0x4C, 0x41, 0x41, 0x9A, 0x3C, 0x93, 0xA3, 0xED, 0xAC, 0x9A, 0x2F, 0x14,
-    0x70, 0xFE, 0x9A, 0x86, 0x8E, 0x4B, 0x31, 0xA2, 0x5F, 0xE5, 0x6F, 0xD2, 0x0F, 0xD3, 0xB6, 0x7B,
-    0x5C, 0x37, 0xA6, 0x68, 0xE6, 0xA0, 0xF2, 0x9D, 0x87, 0x4D, 0xF8, 0x11, 0x80, 0x5C, 0x7C, 0x35,
-    0xBF, 0x24, 0xCC, 0xD6, 0xEF, 0x4E, 0xB2, 0x49, 0xE9, 0xC7, 0xEF, 0x40, 0xC9, 0x8D, 0x32, 0xBF,
-    0x8D, 0x92, 0xB0, 0x0A, 0x94, 0x9B, 0x0C, 0x63, 0x75, 0x8F, 0x16, 0x0E, 0xF1, 0x9D, 0x71, 0x2C,
-    0xF0, 0xEB, 0xED, 0xBA, 0x2A, 0x77, 0x78, 0x00, 0xBF, 0x0F, 0xE3, 0x37, 0x06, 0xA1, 0x8B, 0xF7,
-    0xF2, 0x16, 0xD7, 0x57, 0x1A, 0xF8, 0x18, 0x57, 0x94, 0xE5, 0xF6, 0x6D, 0x74, 0x2F, 0xD2, 0xB8,
-    0xA2, 0x41, 0xAF, 0xE1, 0x56, 0x59, 0x54, 0x6A, 0x7A, 0x37, 0xB4, 0xD5, 0x5E, 0xBE, 0xAE, 0x3B,
-    0x6F, 0x6C, 0x2E, 0x9F, 0xEA, 0x36, 0x15, 0x4A, 0x35, 0xBF, 0x34, 0xF1, 0x05, 0xF0, 0x84, 0x70,
-    0x77, 0x93, 0x99, 0xEE, 0x84, 0x4B, 0xC0, 0x56, 0x4F, 0x5A, 0xAE, 0x62, 0xC6, 0x95, 0x56, 0x36,
-    0x02, 0x61, 0x3E, 0x51, 0x07, 0x3D, 0x7F, 0x89, 0x4E, 0x6F, 0x0B, 0x26, 0xF5, 0x15, 0x40, 0xF4,
-    0x4C, 0x31, 0x4B, 0x13, 0x6C, 0xAD, 0x45, 0x2C, 0x5A, 0x5E, 0xC0, 0xC3, 0xF1, 0x75, 0x1C, 0x76,
-    0x5B, 0xBE, 0x89, 0x87, 0xE5, 0x92, 0xE1, 0xC7, 0x2D, 0xCF, 0x66, 0xE4, 0xCE, 0x41, 0x77, 0xF9,
-    0xDE, 0x1E, 0x56, 0x4B, 0x86, 0xED, 0x78, 0x93, 0xA8, 0x5E, 0x95, 0x2D, 0x67, 0x44, 0xEF, 0xF6,
-    0x9D, 0x40, 0x95, 0xB6, 0x44, 0xF3, 0x2F, 0xFE, 0xBC, 0xB8, 0xF7, 0x9E, 0xD7, 0x65, 0xCF, 0xB6,
-    0xBE, 0x4B, 0x5B, 0xFA, 0x96, 0x8A, 0xD0, 0xE3, 0x74, 0x91, 0x1D, 0x8B, 0x32, 0xE7, 0xA2, 0xB7,
-    0x58, 0x33, 0x3F, 0xBD, 0xE5, 0xA8, 0xD9, 0x6C, 0x39, 0x5B, 0xDA, 0x68, 0xBA, 0x2D, 0xED, 0x79,
-    0xA0, 0x6F, 0x2C, 0xD2, 0x9E, 0x07, 0x5A, 0xAB, 0x21, 0xEC, 0x39, 0xCB, 0x45, 0xC3, 0x7A, 0x60,
-    0x17, 0x2F, 0x57, 0x91, 0x2E, 0xC9, 0x64, 0xCF, 0x59, 0x2D, 0x1A, 0x0E, 0xDA, 0xF3, 0x6A, 0xBC,
-    0x49, 0x5E, 0x68, 0xB1, 0xE8, 0x7F, 0x5F, 0x7A, 0x69, 0x93, 0x25, 0xD1, 0xB3, 0x16, 0x0A, 0x16,
-    0x30, 0xE7, 0xA7, 0x35, 0xE3, 0x3F, 0x5D, 0x2D, 0x3F, 0xF1, 0xFA, 0xC1, 0x7B, 0xB4, 0x34, 0xF6,
-    0xC1, 0xE4, 0xE7, 0x14, 0x11, 0x10, 0x60, 0xB7, 0xD7, 0xEA, 0x3A, 0x9A, 0xAB, 0x95, 0x89, 0xCD,
-    0xEA, 0xAA, 0xFB, 0xB1, 0x14, 0x59, 0xA9, 0xBC, 0xEC, 0x01, 0xB8, 0xE7, 0x20, 0x07, 0x05, 0xDF,
-    0x4D, 0xD3, 0xC6, 0xF4, 0x4F, 0xC4, 0x11, 0x72, 0x81, 0x59, 0x8A, 0xDF, 0x33, 0x02, 0xDB, 0xF3,
-    0x7D, 0x62, 0x42, 0xA3, 0x9F, 0x5E, 0xEE, 0xF4, 0x20, 0x17, 0x3F, 0xA7, 0x5C, 0x6C, 0x4F, 0xC6,
-    0xC2, 0x1C, 0x0F, 0x79, 0x3C, 0xC5, 0x81, 0xD9, 0xD4, 0xD2, 0xDE, 0x78, 0xA6, 0x5D, 0x5F, 0x39,
-    0x36, 0xBD, 0xD5, 0x21, 0xCA, 0xBC, 0x8E, 0x6B, 0x2E, 0xD2, 0x62, 0x49, 0x37, 0xCD, 0xBD, 0x59,
-    0x8F, 0xFA, 0x07, 0x5A, 0xC1, 0xFD, 0x25, 0xA7, 0xAA, 0x9A, 0x4F, 0x95, 0x9D, 0x95, 0x6D, 0x3C,
-    0x37, 0x9F, 0x00, 0x92, 0x70, 0xAA, 0xC2, 0xDB, 0x4D, 0x55, 0xAE, 0x53, 0x55, 0x2E, 0x4D, 0x95,
-    0x67, 0xA7, 0xEA, 0xA5, 0xCF, 0x31, 0x55, 0x5F, 0xB0, 0xCB, 0xF4, 0x0D, 0x46, 0x1E, 0xE3, 0xFB,
-    0x79, 0x20, 0x54, 0x39, 0xFA, 0xBB, 0xD0, 0xD0, 0xFB, 0xF3, 0xD2, 0x89, 0xF0, 0x19, 0xE8, 0x4E,
-    0xD0, 0x10, 0x16, 0x78, 0x5B, 0x7F, 0xB3, 0xDC, 0xB7, 0x99, 0x7D, 0xCD, 0xC3, 0x6C, 0x38, 0x2E,
-    0xB6, 0x96, 0x57, 0x5F, 0x2D, 0x42, 0x9B, 0xAD, 0xD5, 0xCB, 0x07, 0x4F, 0xF0, 0xCF, 0xB2, 0x62,
-    0xD2, 0x12, 0x16, 0xFD, 0x6A, 0x5E, 0x50, 0x24, 0x58, 0xB9, 0x47, 0xBC, 0x11, 0x8C, 0x54, 0x9D,
-    0x2F, 0x19, 0x92, 0xE2, 0x56, 0xB3, 0xEB, 0x13, 0x0C, 0x0F, 0xCC, 0xC7, 0x0F, 0x6A, 0x30, 0x1C,
-    0x58, 0x4D, 0x0D, 0x11, 0x0C, 0x34, 0xE8, 0x39, 0xED, 0x06, 0xC0, 0x43, 0xC0, 0x38, 0xEE, 0x6C,
-    0x60, 0xDA, 0x0A, 0xE6, 0x9D, 0x8E, 0xB8, 0x99, 0xDE, 0xBF, 0x18, 0x75, 0xD3, 0x7A, 0x5D, 0x25,
-    0xE8, 0x07, 0xC8, 0x39, 0x1F, 0x89, 0xB4, 0xD4, 0x58, 0x5F, 0xAC, 0xAB, 0x58, 0xAC, 0x9C, 0x57,
-    0x41, 0xA5, 0xFA, 0x26, 0x8C, 0xDB, 0x5A, 0x5C, 0x8F, 0x6F, 0x2B, 0xF8, 0x19, 0xCC, 0xB3, 0x96,
-    0xEC, 0xF3, 0x7D, 0x97, 0x4C, 0x6C, 0x79, 0xCC, 0x85, 0xC4, 0x84, 0x99, 0x0C, 0xC1, 0x80, 0x6C,
-    0xEA, 0xDB, 0x11, 0xFC, 0xDD, 0xCE, 0xBA, 0x36, 0x2D, 0x31, 0x60, 0xB5, 0x80, 0x25, 0x98, 0x36,
-    0xE5, 0x3C, 0x46, 0x48, 0xFE, 0x48, 0x57, 0x17, 0x30, 0xFC, 0x27, 0xFD, 0x98, 0xC3, 0xF5, 0xB5,
-    0x82, 0xF6, 0xC1, 0xEC, 0x3F, 0x18, 0x0B, 0x2E, 0xDD, 0x81, 0xCC, 0x33, 0x27, 0xBA, 0x74, 0x16,
-    0xD2, 0x6D, 0xDF, 0xE8, 0x70, 0x96, 0xEE, 0xA8, 0x4A, 0x41, 0x28, 0xE8, 0x48, 0x58, 0x77, 0xA5,
-    0xD1, 0x93, 0x8C, 0x2B, 0x55, 0x68, 0x9A, 0x31, 0x1A, 0xAE, 0xC6, 0x7E, 0xF3, 0xE7, 0x98, 0x7B,
-    0xF9, 0x90, 0x64, 0x70, 0xE8, 0x27, 0x7A, 0x6B, 0x73, 0xB8, 0x6A, 0x63, 0x39, 0x1A, 0x0F, 0xE8,
-    0x92, 0x86, 0xA3, 0xF5, 0xF8, 0xAE, 0x4F, 0xBB, 0xF6, 0x39, 0x6E, 0xF6, 0x41, 0xA6, 0x59, 0x1B,
-    0x65, 0x16, 0x2A, 0x59, 0x4B, 0xFC, 0x09, 0xB4, 0x74, 0x1F, 0x57, 0xEF, 0x7C, 0x83, 0xA3, 0xE1,
-    0x15, 0x8F, 0x60, 0xD3, 0x10, 0x93, 0x10, 0xA3, 0xBA, 0x2D, 0x51, 0x40, 0xC3, 0xC4, 0xC4, 0x5F,
-    0xB9, 0xCB, 0x0B, 0x05, 0xEE, 0xF7, 0xDB, 0xAE, 0xAC, 0xE4, 0x1E, 0xA1, 0x34, 0x06, 0x90, 0xCB,
-    0xEE, 0x0C, 0x4B, 0x77, 0x71, 0x8B, 0xA7, 0x41, 0x39, 0x9D, 0xFA, 0x35, 0xCE, 0x65, 0xF2, 0x75,
-    0xC8, 0xD5, 0x6A, 0xF6, 0x2F, 0x39, 0xB5, 0xB4, 0x7C, 0x21, 0xCD, 0xBA, 0x19, 0x74, 0x95, 0xE5,
-    0x72, 0x54, 0xE0, 0xEB, 0x79, 0x3B, 0x14, 0xC1, 0x38, 0xDF, 0x7A, 0xA2, 0x11, 0x01, 0xF3, 0xDA,
-    0xAD, 0x82, 0xC5, 0xD0, 0xDC, 0x07, 0x4C, 0xEA, 0xEA, 0x6B, 0x88, 0x34, 0x34, 0xA7, 0x31, 0xBA,
-    0x82, 0x6F, 0xD2, 0x70, 0xD5, 0xEE, 0x95, 0x4A, 0x5C, 0x6D, 0x4A, 0xD7, 0x9D, 0xC7, 0xE8, 0x06,
-    0xA3, 0x4B, 0x3B, 0xCD, 0xF8, 0x9C, 0x7B, 0xFC, 0xC2, 0x51, 0x9A, 0xD1, 0xD6, 0xD6, 0xAB, 0x93,
-    0xFA, 0xEF, 0xAB, 0x2C, 0x1A, 0x23, 0x67, 0x9F, 0xE7, 0x95, 0x2D, 0xBF, 0x9A, 0xBF, 0xB2, 0x05,
-    0x62, 0xCC, 0x2A, 0x45, 0x06, 0xD4, 0x3B, 0xBB, 0x24, 0x8F, 0xAA, 0x7F, 0xC8, 0x39, 0x69, 0xA6,
-    0xA8, 0x0E, 0x5D, 0xAE, 0x8D, 0xF4, 0x1F, 0xD1, 0x8F, 0xF9, 0x7B, 0xB6, 0xFF, 0xBF, 0x7F, 0xF7,
-    0x92, 0x75, 0x93, 0xBA, 0x1C, 0x4E, 0x5F, 0x3A, 0x41, 0x2B, 0x67, 0xF6, 0x39, 0xCB, 0xFB, 0xBA,
-    0x56, 0xFD, 0x2B, 0x59, 0xC7, 0x51, 0xF3, 0xE4, 0x64, 0x2C, 0x1A, 0x60, 0xEE, 0xE5, 0x70, 0x3B,
-    0xBE, 0x57, 0x8E, 0x9A, 0xEB, 0x5D, 0xF9, 0x42, 0x4B, 0x3C, 0x94, 0x08, 0xD8, 0xCC, 0xFD, 0x53,
-    0x5A, 0x4F, 0x3A, 0x3B, 0x51, 0x28, 0x83, 0xE2, 0x59, 0x0F, 0x99, 0xFB, 0xF4, 0xAA, 0x3B, 0x9F,
-    0x31, 0x56, 0x58, 0x80, 0x5C, 0x6B, 0x31, 0xE7, 0x8B, 0xB9, 0x74, 0x57, 0x83, 0xA4, 0x3B, 0x5A,
-    0x20, 0x66, 0x93, 0x2D, 0xD9, 0xE7, 0x29, 0xE4, 0xA9, 0x97, 0x0B, 0x79, 0xFC, 0x56, 0xD5, 0x3C,
-    0x1E, 0xF8, 0x3A, 0x97, 0x4A, 0x03, 0xD5, 0x0C, 0x60, 0x6A, 0x18, 0x3F, 0x1A, 0x77, 0x56, 0x35,
-    0xBA, 0xC7, 0xD0, 0xDE, 0x2B, 0x77, 0xED, 0xBC, 0xAB, 0x9D, 0x0F, 0x6F, 0xE9, 0xFC, 0xCA, 0xA6,
-    0xBC, 0xAC, 0x73, 0x50, 0x9B, 0x07, 0x77, 0xE4, 0xDA, 0xB4, 0x70, 0x2F, 0x4D, 0x97, 0x3A, 0xDF,
-    0x6B, 0xE7, 0xEB, 0xBB, 0xBC, 0xE7, 0xEF, 0x4E, 0x7D, 0xA3, 0x4B, 0xF8, 0xAE, 0xEC, 0x65, 0x9A,
-    0x39, 0x38, 0x28, 0x37, 0x12, 0xF4, 0xF6, 0x4E, 0x2F, 0xE3, 0xF8, 0x7F, 0xAD, 0x56, 0x41, 0x6C,
-    0x16, 0x45, 0x14, 0x7E, 0xBB, 0x43, 0xBB, 0x09, 0x1B, 0x3B, 0x3D, 0xD0, 0xC4, 0xA0, 0x75, 0xBC,
-    0x2B, 0x19, 0x0F, 0x3D, 0x70, 0xC0, 0xCE, 0x60, 0x63, 0x48, 0x24, 0x4A, 0xA3, 0x10, 0x13, 0x13,
-    0x23, 0x57, 0x89, 0x49, 0x39, 0xF4, 0xC0, 0x81, 0x74, 0x17, 0x7A, 0xE0, 0xD0, 0x03, 0xF5, 0x44,
-    0xA2, 0x07, 0x7B, 0x31, 0x4A, 0x89, 0x12, 0x13, 0xAE, 0x65, 0xB7, 0x25, 0xC6, 0x44, 0x0E, 0x2C,
-    0x70, 0xE4, 0xE0, 0x26, 0x26, 0x62, 0xB8, 0x30, 0xE0, 0x18, 0x96, 0x3A, 0xBB, 0xE3, 0x37, 0xFB,
-    0xFF, 0x6D, 0x4A, 0x82, 0x09, 0xA2, 0x2F, 0xB3, 0xFF, 0xCE, 0xCE, 0xBC, 0xF9, 0xDE, 0x37, 0x6F,
-    0xDE, 0x7B, 0xF3, 0x7F, 0xB4, 0xBA, 0x2D, 0x2B, 0xB3, 0x1F, 0x7E, 0x2C, 0xB4, 0x51, 0x3F, 0x7E,
-    0xBD, 0x9B, 0x56, 0xFE, 0xB9, 0x05, 0x49, 0x34, 0x4D, 0x12, 0x4D, 0x9D, 0xB8, 0x74, 0x67, 0x75,
-    0x6D, 0x25, 0x79, 0x27, 0xAA, 0x56, 0xE6, 0x31, 0xB1, 0x42, 0xCF, 0xFA, 0x33, 0x90, 0x49, 0xE0,
-    0x44, 0x25, 0x2D, 0xAC, 0x5E, 0xB8, 0xF7, 0xFD, 0x24, 0x1D, 0x9F, 0x1F, 0xA5, 0xEA, 0x38, 0x8D,
-    0x12, 0x3D, 0xFB, 0x0F, 0x44, 0xFA, 0x20, 0x1D, 0x3D, 0xD9, 0xF7, 0xDB, 0x62, 0xF0, 0x3C, 0xC2,
-    0x73, 0x1F, 0x8F, 0xF6, 0x4F, 0x13, 0xF7, 0xF4, 0xD1, 0x89, 0xE8, 0x7D, 0x27, 0xAE, 0x9B, 0x4C,
-    0xAE, 0xBB, 0x22, 0x79, 0xF8, 0x9F, 0xBB, 0x0F, 0xBE, 0xDD, 0x9D, 0xC3, 0xC9, 0xDF, 0x0C, 0xA9,
-    0xE4, 0x03, 0x17, 0xB0, 0xE1, 0x67, 0xE1, 0x7D, 0x1B, 0x91, 0x93, 0x8B, 0x26, 0xE3, 0xB5, 0xE7,
-    0x36, 0x3B, 0xA3, 0x23, 0x9D, 0x1D, 0xF4, 0xCC, 0xA5, 0x46, 0xE6, 0x2E, 0xA9, 0x15, 0x8D, 0xD3,
-    0x68, 0x5E, 0xE4, 0x3E, 0x0E, 0x23, 0xDA, 0xA5, 0xD5, 0x34, 0x96, 0xEF, 0x4A, 0xAC, 0x3F, 0x6F,
-    0x7C, 0x62, 0x54, 0xDC, 0xF0, 0x72, 0x4F, 0x44, 0xE3, 0xBC, 0x74, 0xF2, 0xAC, 0x55, 0xCC, 0x64,
-    0x69, 0xDD, 0x05, 0x28, 0xE3, 0x8F, 0xD8, 0x6C, 0xC9, 0xEE, 0x89, 0x00, 0x38, 0x2E, 0x6E, 0xB5,
-    0xE2, 0x61, 0x87, 0xB1, 0xD4, 0x74, 0x69, 0xDD, 0x42, 0x59, 0x04, 0xE5, 0x7A, 0x57, 0xA4, 0x47,
-    0xF3, 0x53, 0xF2, 0xD7, 0x96, 0x3F, 0xC0, 0x54, 0x3F, 0x5B, 0xB5, 0x7C, 0xDD, 0xC9, 0xB7, 0xEC,
-    0x34, 0xAB, 0x82, 0x21, 0xB0, 0x39, 0x0C, 0x5B, 0x36, 0x00, 0xF2, 0x1A, 0xE0, 0x2A, 0x31, 0x72,
-    0xD1, 0x02, 0x01, 0xB0, 0x34, 0xA2, 0x89, 0xB5, 0x44, 0xAA, 0xA4, 0xD8, 0x11, 0x89, 0x32, 0xFE,
-    0xBC, 0xF9, 0x4C, 0x79, 0x7F, 0x1B, 0xBB, 0x52, 0x5F, 0x7D, 0x59, 0x51, 0x43, 0xC4, 0x73, 0x8A,
-    0xF0, 0x12, 0xC3, 0xD7, 0x40, 0x53, 0x6E, 0xBF, 0xB6, 0x20, 0xE4, 0x36, 0xC4, 0xF2, 0x16, 0x44,
-    0x37, 0xFD, 0xC9, 0x00, 0x42, 0x6C, 0xCD, 0x11, 0xBE, 0xA6, 0x8F, 0x7C, 0x11, 0xE6, 0xA0, 0x72,
-    0x0B, 0x9A, 0x61, 0x30, 0x1A, 0x20, 0x05, 0x14, 0x80, 0xED, 0xCE, 0xFD, 0x75, 0x9F, 0x75, 0x85,
-    0xF5, 0xF9, 0x51, 0x9A, 0x27, 0x6E, 0xC9, 0x5B, 0xEE, 0x6D, 0x70, 0x77, 0xE7, 0x3B, 0xDE, 0x51,
-    0x17, 0x42, 0x88, 0xE2, 0x36, 0xBB, 0xEB, 0x55, 0x35, 0x8B, 0x2E, 0xAF, 0xD5, 0x0D, 0x27, 0x1F,
-    0xF9, 0xB4, 0x2D, 0xD6, 0xFD, 0x88, 0x9E, 0x18, 0x46, 0x29, 0xAF, 0xA3, 0x96, 0xE4, 0xF5, 0x96,
-    0x7C, 0x29, 0x36, 0xBD, 0x56, 0x26, 0xE9, 0xB2, 0x92, 0x37, 0xE4, 0xDF, 0xD6, 0x74, 0x94, 0x46,
-    0x28, 0x62, 0x6D, 0xF6, 0x08, 0x10, 0x3B, 0xF2, 0xE2, 0xF8, 0x6B, 0x77, 0xE2, 0xFF, 0x21, 0x2F,
-    0xF2, 0x0B, 0xBF, 0x8F, 0x3D, 0x6F, 0x5E, 0x2C, 0x93, 0xD4, 0xC9, 0x77, 0xD1, 0xCF, 0x53, 0x6F,
-    0xAC, 0x94, 0xFF, 0x8A, 0xC2, 0xD6, 0x4F, 0x2F, 0xD1, 0x6D, 0x4D, 0xF3, 0x35, 0x4D, 0xEE, 0x3F,
-    0x71, 0xF9, 0xBD, 0x7B, 0x97, 0xDF, 0xAD, 0x26, 0xA7, 0xAA, 0x93, 0xD5, 0xCD, 0x6B, 0x1A, 0x9B,
-    0x7D, 0x8E, 0x36, 0xC4, 0xFC, 0x49, 0xA7, 0x93, 0xF4, 0xFA, 0x3C, 0xFD, 0xB0, 0x79, 0xF1, 0xE4,
-    0xE6, 0xA5, 0x97, 0xA7, 0x92, 0xE4, 0x85, 0x24, 0xBA, 0x76, 0x08, 0xDE, 0x7B, 0xAE, 0xB6, 0x43,
-    0x22, 0x1C, 0xE3, 0x95, 0xBE, 0x97, 0x35, 0x94, 0x98, 0xFE, 0x44, 0x7C, 0x43, 0x4A, 0x87, 0x9E,
-    0x3A, 0x64, 0x43, 0x84, 0x40, 0xCB, 0xF1, 0x9A, 0xF7, 0x74, 0xD2, 0x5A, 0xE6, 0x0B, 0x83, 0xCA,
-    0x91, 0x17, 0xAC, 0xD7, 0xA7, 0x2E, 0x6E, 0x64, 0x9F, 0x9C, 0x71, 0x93, 0xD6, 0x6E, 0x50, 0xED,
-    0x8C, 0x4A, 0xAB, 0x6C, 0x99, 0xE6, 0x96, 0xF9, 0x6F, 0x4E, 0x71, 0x5F, 0xA5, 0xBE, 0x16, 0x7E,
-    0xC3, 0x14, 0x73, 0x65, 0x36, 0x57, 0xA5, 0x56, 0x2C, 0x1A, 0xB5, 0x68, 0xC2, 0x2A, 0x27, 0xCA,
-    0xAB, 0xA2, 0xCC, 0xB0, 0xA4, 0xBE, 0x1A, 0xB9, 0x2C, 0xD8, 0x43, 0x66, 0x26, 0x0F, 0x1C, 0xC8,
-    0x04, 0x3C, 0x79, 0xCE, 0x20, 0x50, 0x79, 0x29, 0xCB, 0x35, 0x68, 0x12, 0xB5, 0xA4, 0x66, 0x8C,
-    0x9A, 0xB1, 0x81, 0x6C, 0xE1, 0x75, 0x81, 0xB2, 0x00, 0xB2, 0x85, 0xA5, 0x02, 0xE1, 0x7E, 0x9A,
-    0x68, 0xA2, 0x6F, 0x3B, 0xA5, 0x8E, 0x1D, 0x73, 0x49, 0xC3, 0x8D, 0xA8, 0x55, 0xA9, 0x68, 0xDF,
-    0x70, 0x78, 0x8C, 0x6C, 0xEC, 0x78, 0xA5, 0x36, 0xDA, 0xA4, 0x51, 0xA5, 0x4F, 0x1B, 0x51, 0xA3,
-    0x76, 0x88, 0x52, 0xC5, 0x36, 0xAE, 0x5E, 0xD9, 0xB9, 0x9E, 0xEB, 0x53, 0x41, 0xB3, 0x63, 0x4E,
-    0xDE, 0xEC, 0xA0, 0x7C, 0xAD, 0xE5, 0xA6, 0x38, 0xE7, 0xA0, 0x9F, 0x1A, 0xB5, 0x0E, 0xD7, 0x60,
-    0x89, 0x28, 0xF7, 0x45, 0x35, 0xDF, 0x5A, 0x92, 0x82, 0x13, 0x6C, 0x55, 0xC2, 0xA4, 0x96, 0x35,
-    0xE4, 0x90, 0x4D, 0xFD, 0xB0, 0x3E, 0x85, 0x95, 0x80, 0xA9, 0x8B, 0x45, 0x87, 0xDE, 0x41, 0xD4,
-    0x15, 0xB9, 0xDE, 0x32, 0x2B, 0xF3, 0xFD, 0xAC, 0xDC, 0x5A, 0x7C, 0x25, 0xC9, 0x4F, 0x07, 0x35,
-    0xAB, 0x36, 0x30, 0x0F, 0x4D, 0x55, 0xF9, 0xD4, 0x66, 0xEB, 0xE1, 0x23, 0x76, 0x02, 0x3C, 0xAC,
-    0x3C, 0xE3, 0x58, 0x7E, 0x20, 0x1A, 0x06, 0xC8, 0x8B, 0x7D, 0x8D, 0x10, 0x0D, 0x89, 0xFB, 0xB9,
-    0xD8, 0x40, 0x55, 0x83, 0x5F, 0xC7, 0x90, 0xDE, 0xB2, 0x92, 0x95, 0xAA, 0xB9, 0x61, 0x1D, 0xA9,
-    0x0A, 0x39, 0x2E, 0xCB, 0x08, 0x07, 0xB6, 0x9F, 0x0A, 0x2D, 0x2B, 0xDE, 0xB0, 0x2E, 0xF2, 0xAC,
-    0x4B, 0x1B, 0x59, 0x65, 0x1A, 0x7E, 0xA3, 0x57, 0xF1, 0x2C, 0x21, 0xF0, 0xA7, 0xFB, 0xC2, 0xD8,
-    0xC8, 0xB3, 0x86, 0xD5, 0x66, 0x0D, 0xC8, 0x52, 0xD3, 0x42, 0x52, 0x51, 0xF4, 0xA7, 0x25, 0x91,
-    0x76, 0x7C, 0x06, 0x53, 0x4E, 0xCE, 0xC0, 0x53, 0xB3, 0x9B, 0x66, 0x96, 0x14, 0x0F, 0xA7, 0xA3,
-    0x88, 0x99, 0x59, 0xD7, 0x57, 0x63, 0x09, 0x5F, 0x2D, 0x55, 0x42, 0x4F, 0x4F, 0x21, 0x6E, 0xFA,
-    0x4D, 0xED, 0xD5, 0x7B, 0x97, 0x1A, 0xE6, 0x7C, 0x9E, 0xDD, 0xB0, 0xA9, 0xC3, 0x99, 0x9D, 0x37,
-    0x69, 0xE3, 0x29, 0xBC, 0xAC, 0xA7, 0xEC, 0x88, 0x49, 0x6C, 0x41, 0xD9, 0x61, 0xC3, 0x6C, 0x86,
-    0x90, 0xC3, 0x4B, 0x85, 0x33, 0x8E, 0xED, 0xF8, 0x60, 0x7B, 0x52, 0x8B, 0x25, 0xC7, 0xBA, 0xA2,
-    0xCC, 0xEE, 0x3A, 0xD6, 0x4E, 0xA0, 0x7E, 0x1C, 0x3B, 0x76, 0xEC, 0x83, 0xE1, 0x2D, 0x80, 0xFB,
-    0xE1, 0x22, 0xC5, 0xE8, 0x16, 0xED, 0x96, 0xFF, 0x58, 0x1E, 0x82, 0x13, 0x91, 0x15, 0xA2, 0x15,
-    0xD1, 0x84, 0xB8, 0xB4, 0xA8, 0x49, 0xA0, 0xB2, 0x86, 0x49, 0x78, 0x40, 0x52, 0x5F, 0x50, 0xC3,
-    0xC8, 0xC2, 0x70, 0x44, 0x0F, 0xD4, 0xE1, 0x50, 0x44, 0x22, 0xB3, 0x83, 0x8A, 0xD9, 0x86, 0xA0,
-    0xC4, 0xE7, 0x13, 0xD1, 0x94, 0x78, 0x1D, 0xF9, 0x8A, 0x79, 0x87, 0x0B, 0x13, 0xAD, 0x54, 0xDE,
-    0xC8, 0xFB, 0x0D, 0xFF, 0xAB, 0x8B, 0xC2, 0x52, 0x14, 0x53, 0xD8, 0x0C, 0xF6, 0x60, 0x60, 0xBA,
-    0x47, 0x13, 0x79, 0x54, 0xE4, 0x34, 0x57, 0xBF, 0xE4, 0xAB, 0x51, 0x6F, 0x84, 0xAF, 0x13, 0x6F,
-    0x13, 0x5F, 0xC5, 0xBE, 0x8E, 0x70, 0xED, 0x66, 0x79, 0x50, 0x43, 0xA5, 0x47, 0x63, 0xF5, 0x93,
-    0x81, 0x8B, 0x43, 0x85, 0x7D, 0x81, 0x50, 0x6F, 0x29, 0xE9, 0xB0, 0x4B, 0x4D, 0x1E, 0x2B, 0x4A,
-    0x78, 0x80, 0xA2, 0x3E, 0x41, 0xE9, 0x53, 0xD0, 0xA1, 0x62, 0x11, 0x6C, 0x54, 0x0D, 0x32, 0xDC,
-    0x82, 0x0B, 0x6B, 0x03, 0x15, 0x1F, 0x76, 0xAF, 0x42, 0xDD, 0xE7, 0xD8, 0x60, 0xC6, 0x1C, 0x81,
-    0x86, 0x27, 0xB0, 0x50, 0x25, 0x48, 0xA4, 0x26, 0x70, 0x70, 0x3D, 0x85, 0xC0, 0x40, 0x94, 0x81,
-    0x40, 0x9F, 0xCF, 0x7A, 0xDB, 0x7A, 0x5A, 0xC1, 0x78, 0xEA, 0x60, 0x9B, 0xF9, 0x00, 0x58, 0x94,
-    0x23, 0xE1, 0xA2, 0xD8, 0x0B, 0x8D, 0xB8, 0x23, 0x8F, 0x20, 0xE2, 0xDE, 0xA8, 0x0A, 0x2E, 0xC0,
-    0xA1, 0x16, 0x7F, 0x38, 0xD2, 0xE2, 0x17, 0x40, 0x88, 0x02, 0x66, 0x95, 0x0F, 0xFF, 0x29, 0xE0,
-    0xD4, 0xB9, 0xBF, 0x0C, 0xCD, 0xF9, 0xB9, 0x12, 0x65, 0x25, 0x23, 0xE1, 0x0F, 0x82, 0x6A, 0x0E,
-    0x43, 0x0E, 0xFE, 0x8F, 0x0D, 0x8D, 0x6F, 0x6D, 0x16, 0x3E, 0x5B, 0x20, 0x19, 0x62, 0xB5, 0x28,
-    0x45, 0x13, 0x79, 0x84, 0x2C, 0x6A, 0xD3, 0x9E, 0xE1, 0xEC, 0xAA, 0x8E, 0xCE, 0xE0, 0xBA, 0x7F,
-    0x8C, 0x13, 0x6F, 0xD7, 0x62, 0xDF, 0x8D, 0x51, 0xFA, 0x78, 0xA7, 0xAB, 0x58, 0xFE, 0x66, 0x54,
-    0x8F, 0xC1, 0xFD, 0x2D, 0xAF, 0x0B, 0x0A, 0xE9, 0xB2, 0xE8, 0xFA, 0x4C, 0x45, 0xCE, 0x6F, 0x74,
-    0xC2, 0xF8, 0x28, 0x64, 0x4F, 0x28, 0x02, 0x19, 0x43, 0xB6, 0xF7, 0x09, 0xEB, 0x42, 0xA6, 0x1D,
-    0x88, 0xB7, 0xAB, 0xEC, 0xDF, 0x4D, 0x52, 0x3D, 0x6F, 0xD5, 0x30, 0x14, 0xBD, 0x89, 0xD5, 0x17,
-    0x89, 0x0C, 0x66, 0xE9, 0xD2, 0xC5, 0x2B, 0x20, 0xA4, 0xFC, 0x01, 0x54, 0xA7, 0x62, 0x60, 0x84,
-    0x01, 0xA9, 0x63, 0x7F, 0x42, 0x7F, 0x41, 0x71, 0xD4, 0x85, 0x81, 0xA1, 0x6F, 0x60, 0x63, 0x60,
-    0x79, 0x03, 0x74, 0x29, 0x3F, 0x00, 0xB0, 0xAB, 0x27, 0xC4, 0x1A, 0x10, 0x12, 0x43, 0x97, 0x48,
-    0xAD, 0xCA, 0xD0, 0x01, 0x03, 0x79, 0x25, 0x7D, 0xD8, 0x39, 0x5C, 0x97, 0xCF, 0xAB, 0x28, 0xD1,
-    0x55, 0x8E, 0xEF, 0x39, 0xF7, 0x1C, 0xD3, 0xF6, 0x94, 0x30, 0x12, 0x6C, 0x6B, 0x45, 0xD0, 0x8D,
-    0x91, 0xAD, 0xFA, 0xE8, 0xC5, 0x22, 0x64, 0xD1, 0xD4, 0xDC, 0x54, 0xF3, 0xA0, 0x5A, 0x03, 0x5F,
-    0xA0, 0xA3, 0xB5, 0x9A, 0x28, 0x7B, 0x41, 0x79, 0xA0, 0x0C, 0xFC, 0x38, 0xFA, 0xE1, 0x29, 0x04,
-    0x7A, 0xA9, 0x69, 0x47, 0x3A, 0xBD, 0xB9, 0x90, 0xC0, 0x3B, 0xC0, 0x93, 0x74, 0x24, 0x3C, 0xD1,
-    0x33, 0x9A, 0xEC, 0x4F, 0x2B, 0x38, 0x80, 0x3B, 0xD9, 0x92, 0x1E, 0x08, 0x91, 0x8A, 0x40, 0x85,
-    0x27, 0xE5, 0xB2, 0x51, 0xC2, 0xEB, 0x91, 0x6E, 0xF0, 0xD0, 0xB2, 0xCB, 0xD1, 0xEA, 0x85, 0x88,
-    0x54, 0xB5, 0x2C, 0xA6, 0x00, 0xD4, 0xE1, 0x68, 0xF3, 0x8B, 0x50, 0x7E, 0xEB, 0xF5, 0x23, 0x84,
-    0x12, 0x6E, 0x32, 0xA3, 0xB5, 0xFD, 0x29, 0x70, 0x0C, 0xEC, 0x35, 0xE1, 0x56, 0xD9, 0xD2, 0x83,
-    0x44, 0x52, 0x35, 0x14, 0xF8, 0x38, 0xE9, 0x9A, 0xBF, 0xDC, 0x4F, 0x6A, 0xCA, 0x5E, 0xD7, 0x1A,
-    0xBB, 0x83, 0x91, 0x2E, 0xE8, 0xDB, 0xDE, 0xD8, 0xDA, 0xF4, 0x05, 0x06, 0x5D, 0x9E, 0x0F, 0xE5,
-    0x59, 0xA7, 0xB7, 0x4E, 0x03, 0x4B, 0x9A, 0x3C, 0xA6, 0x3C, 0x92, 0x81, 0x18, 0xA1, 0x5C, 0xB4,
-    0x82, 0x99, 0x8E, 0x2F, 0xCC, 0x43, 0xC4, 0x9C, 0xE5, 0xEB, 0xA6, 0x0C, 0x57, 0xE0, 0x58, 0xEE,
-    0x75, 0x4A, 0xA5, 0x8E, 0x06, 0xDE, 0xAC, 0xD6, 0x77, 0x3A, 0xD9, 0x04, 0xD1, 0x69, 0x1A, 0xA4,
-    0x5B, 0x17, 0x9E, 0x0F, 0x56, 0x03, 0xDE, 0xDC, 0x5F, 0xBD, 0x97, 0x40, 0x66, 0x20, 0x0B, 0x67,
-    0x9E, 0x0C, 0xDA, 0x59, 0xB6, 0xF0, 0xAD, 0x2F, 0x16, 0x81, 0xA2, 0xA1, 0xE4, 0xE7, 0x7C, 0x90,
-    0x9D, 0x7D, 0xEA, 0x25, 0x7A, 0xB2, 0x3D, 0xFD, 0xAA, 0xA2, 0xAD, 0x46, 0x81, 0x6E, 0x65, 0x24,
-    0xD9, 0xD1, 0xFF, 0x2F, 0xD5, 0x57, 0xF8, 0xCA, 0x81, 0x5C, 0x25, 0x35, 0xE6, 0x6C, 0xC4, 0x69,
-    0x30, 0x45, 0x3F, 0x53, 0x2E, 0xFD, 0xF7, 0x04, 0x06, 0x65, 0x0C, 0x02, 0x0C, 0x82, 0x45, 0xC3,
-    0xB0, 0x34, 0x67, 0x54, 0xBB, 0xE1, 0x5A, 0xE9, 0xC9, 0xD4, 0x55, 0x4F, 0xE8, 0xF3, 0xAD, 0xE4,
-    0x30, 0xD9, 0x95, 0xED, 0xC1, 0xA0, 0xC1, 0xC9, 0x6F, 0x4E, 0xCA, 0x02, 0xF1, 0x04, 0xE2, 0xE4,
-    0xAC, 0xA7, 0x9D, 0x40, 0xEB, 0x9A, 0xB4, 0x74, 0x95, 0x60, 0x69, 0x98, 0x03, 0xFD, 0xEA, 0xD6,
-    0x87, 0xCB, 0xE4, 0x42, 0x02, 0x97, 0xF0, 0xEC, 0xD4, 0xF8, 0x3C, 0x85, 0x77, 0x42, 0x9C, 0xD4,
-    0xC1, 0x48, 0xE2, 0x32, 0xBC, 0xEA, 0x70, 0x33, 0x4A, 0x74, 0x55, 0xFC, 0x33, 0xD7, 0x3A, 0x85,
-    0x0D, 0xD4, 0xAA, 0x23, 0xCC, 0x04, 0xA2, 0x3A, 0x63, 0x4B, 0x97, 0xA1, 0xFC, 0xEE, 0xAB, 0xBD,
-    0x45, 0x54, 0xE8, 0xD4, 0x98, 0x50, 0x1A, 0x3D, 0xE7, 0xB7, 0xB4, 0x77, 0x37, 0x86, 0x9B, 0x7C,
-    0x45, 0x5E, 0xA5, 0x51, 0xBA, 0x66, 0x4D, 0xF2, 0x5F, 0x7E, 0xA9, 0xD2, 0xE6, 0xD9, 0x88, 0x94,
-    0x9F, 0xF0, 0x50, 0x0D, 0x86, 0x8C, 0xC9, 0x3E, 0x7F, 0x09, 0xF2, 0xA8, 0xAB, 0x0E, 0x5C, 0xD4,
-    0x7F, 0xA9, 0x79, 0x79, 0x4E, 0x2C, 0xCA, 0xF7, 0xC1, 0x88, 0xF3, 0x20, 0x3F, 0x31, 0xDF, 0x92,
-    0x95, 0xF5, 0x99, 0x71, 0x29, 0xDE, 0xCE, 0xF0, 0xBD, 0x9E, 0x26, 0xE0, 0x4F, 0x3D, 0x51, 0x41,
-    0x4E, 0xC3, 0x30, 0x10, 0x9C, 0xA4, 0xAA, 0x2A, 0xE1, 0x43, 0x2E, 0xA0, 0x1E, 0xF3, 0x00, 0x24,
-    0xFC, 0x04, 0xFB, 0x07, 0xF4, 0x50, 0x7E, 0xD0, 0x13, 0x7C, 0x01, 0xC9, 0x79, 0x42, 0x9F, 0x80,
-    0xC4, 0xAD, 0xBC, 0x01, 0x39, 0x12, 0x0F, 0x20, 0xEA, 0x81, 0x73, 0x0E, 0x9C, 0xE8, 0x25, 0x87,
-    0x20, 0x05, 0x70, 0xBC, 0x8C, 0xD3, 0x82, 0xA5, 0x91, 0xD6, 0xBB, 0xEB, 0xD9, 0x9D, 0xB1, 0x13,
-    0x89, 0x5E, 0x44, 0x34, 0x31, 0x8B, 0x70, 0x84, 0x21, 0xAE, 0x08, 0x4C, 0x90, 0xA7, 0x6E, 0x26,
-    0xD2, 0x13, 0xDD, 0x5F, 0xCE, 0xC9, 0x40, 0x04, 0x2C, 0xE3, 0x6A, 0xBA, 0x2F, 0x64, 0x7B, 0xCA,
-    0x0D, 0x38, 0x9E, 0x9C, 0x99, 0x4C, 0xC4, 0xC2, 0x1C, 0x02, 0x54, 0xAF, 0x1B, 0x08, 0x02, 0xCA,
-    0xA6, 0xB0, 0xF9, 0xC8, 0xB2, 0xA9, 0x13, 0x89, 0x58, 0x45, 0x52, 0x2C, 0x02, 0x30, 0xF7, 0x6F,
-    0x0F, 0xE0, 0x26, 0x38, 0x93, 0x8F, 0x2D, 0x8A, 0x8E, 0x3D, 0x42, 0x94, 0x0D, 0xCE, 0x0D, 0x17,
-    0x7B, 0x21, 0x42, 0xF9, 0xC3, 0x17, 0x1B, 0x5C, 0x58, 0xFC, 0x9F, 0x3B, 0x89, 0xC7, 0x1B, 0xB7,
-    0x93, 0x6A, 0x8A, 0x94, 0x1C, 0x4E, 0x51, 0x2E, 0xB9, 0x1C, 0xDB, 0x54, 0x98, 0x8D, 0xD8, 0xA4,
-    0x48, 0x77, 0x6A, 0x50, 0x6D, 0x8A, 0x7C, 0xAD, 0x5B, 0x53, 0x4D, 0x6D, 0x10, 0x1B, 0xD7, 0xB8,
-    0xB5, 0x2A, 0xA8, 0xE0, 0x65, 0xD0, 0x52, 0xEB, 0x4F, 0xD9, 0x8B, 0xEC, 0xA3, 0x83, 0x97, 0x11,
-    0xAE, 0x2A, 0x9A, 0xFB, 0x9C, 0x03, 0x32, 0x7A, 0x53, 0x6F, 0x15, 0x15, 0x2C, 0x06, 0xF8, 0x9E,
-    0x6C, 0x5C, 0xB1, 0x05, 0x9D, 0xF0, 0x49, 0x50, 0x05, 0x1F, 0xD2, 0x48, 0xB6, 0xA1, 0xEC, 0x15,
-    0x65, 0x51, 0xDA, 0x50, 0x34, 0xEE, 0xDB, 0xA2, 0xFC, 0x7A, 0x6C, 0xCD, 0xB5, 0xB0, 0x6A, 0xE4,
-    0x55, 0x82, 0xE1, 0x1B, 0xB8, 0x51, 0x9F, 0x56, 0x9D, 0x23, 0x5B, 0xFD, 0x3B, 0xF7, 0x4E, 0x48,
-    0x3B, 0xB9, 0xA1, 0x7B, 0xD5, 0x92, 0xE3, 0x99, 0x66, 0xA8, 0x9A, 0x93, 0xE8, 0xF8, 0xAE, 0xA2,
-    0xD6, 0x80, 0xCB, 0xB8, 0xB3, 0x70, 0x47, 0x1B, 0x31, 0xD9, 0xB8, 0x1C, 0xD7, 0x24, 0x6F, 0x13,
-    0x03, 0x3D, 0x29, 0x22, 0x49, 0x59, 0x6B, 0xB2, 0xD4, 0x9D, 0xA7, 0xAF, 0xC0, 0x0D, 0x7E, 0x01,
-    0x85, 0x53, 0xBF, 0x6F, 0xD3, 0x40, 0x14, 0x7E, 0xB5, 0x23, 0xB9, 0x92, 0x91, 0xDC, 0x05, 0x09,
-    0x75, 0x71, 0x66, 0x84, 0x74, 0x19, 0x18, 0x4B, 0xCF, 0x1B, 0x03, 0x03, 0x5D, 0xBC, 0xC0, 0x90,
-    0xBD, 0x0B, 0xFC, 0x03, 0x25, 0x66, 0xEA, 0x90, 0x01, 0x16, 0x76, 0x06, 0x18, 0xE2, 0x89, 0x31,
-    0x43, 0x92, 0xB3, 0x9A, 0xB1, 0x43, 0xA3, 0xA2, 0xCE, 0xB1, 0x92, 0x81, 0x31, 0x56, 0x63, 0xD4,
-    0x93, 0xE2, 0xF8, 0xF8, 0x9E, 0x93, 0x94, 0x44, 0xE2, 0xC7, 0x49, 0xEF, 0xD3, 0xFD, 0x7C, 0xEF,
-    0x7B, 0xDF, 0x7B, 0x47, 0xC4, 0xE3, 0x1B, 0xCC, 0xCD, 0x00, 0x2A, 0xD8, 0x4C, 0xE2, 0x38, 0x3E,
-    0x37, 0x18, 0x2F, 0x61, 0x4B, 0xFF, 0xE6, 0x34, 0xFE, 0x2C, 0x12, 0xEC, 0x8B, 0x11, 0x03, 0xCF,
-    0x9E, 0xD0, 0xD6, 0xF0, 0x12, 0xF2, 0x0A, 0xF2, 0x4C, 0xE2, 0x99, 0xC2, 0x1B, 0xCF, 0x2E, 0xA7,
-    0x73, 0x9D, 0x15, 0x47, 0x24, 0xAB, 0x13, 0x1B, 0x0E, 0x0B, 0xFA, 0xDB, 0xE2, 0x7E, 0x38, 0x11,
-    0x40, 0x32, 0xB4, 0x56, 0x33, 0x50, 0x50, 0x15, 0x07, 0x1F, 0x56, 0x3C, 0x8E, 0xBF, 0x36, 0x39,
-    0xF8, 0x12, 0xE6, 0xA7, 0x80, 0x92, 0x1F, 0xA5, 0x3B, 0x1C, 0xFE, 0x1D, 0xA9, 0x38, 0x38, 0x92,
-    0x9E, 0xB8, 0xBA, 0x9A, 0x2E, 0x16, 0x99, 0x34, 0x99, 0x6D, 0x32, 0x92, 0x29, 0x59, 0x5B, 0x2E,
-    0x46, 0x7B, 0xC8, 0x63, 0xE4, 0x27, 0x64, 0x48, 0x26, 0x5E, 0x4A, 0x22, 0x82, 0x0E, 0xAA, 0xCD,
-    0x1C, 0x9A, 0xAC, 0x83, 0xB8, 0x09, 0x9B, 0xA9, 0x88, 0x68, 0x80, 0x63, 0x70, 0x90, 0xEC, 0xBC,
-    0x41, 0xF5, 0xF5, 0xEB, 0xDA, 0x46, 0x07, 0xDF, 0x24, 0x3E, 0x44, 0x1B, 0x8F, 0x87, 0xD3, 0xDB,
-    0xB4, 0x5E, 0xD4, 0x77, 0x08, 0xED, 0xCB, 0x7D, 0xEF, 0xC3, 0xE5, 0xF0, 0xEE, 0xEE, 0x9E, 0x43,
-    0x56, 0x9D, 0x1C, 0x40, 0x79, 0xE4, 0xAD, 0x22, 0x72, 0x4D, 0x44, 0x06, 0x52, 0xCE, 0x66, 0x89,
-    0x94, 0x92, 0x1A, 0x45, 0xA3, 0xBA, 0x00, 0x0F, 0xEC, 0xE8, 0x6D, 0xF1, 0xD4, 0x99, 0xCF, 0x33,
-    0xD7, 0x98, 0xC8, 0x35, 0xBA, 0xBA, 0xEC, 0xE4, 0xF4, 0xF0, 0xF5, 0xA7, 0x13, 0x30, 0x1C, 0xC2,
-    0x3C, 0x88, 0x85, 0x1A, 0xC1, 0x0F, 0x92, 0xD3, 0x04, 0xB2, 0xBF, 0x17, 0x1F, 0x07, 0xD4, 0x47,
-    0x52, 0x2F, 0x52, 0x65, 0xE5, 0x8A, 0xFA, 0x2D, 0x63, 0xDE, 0x18, 0xF3, 0xDD, 0x98, 0x5C, 0x06,
-    0xE4, 0xE8, 0x4A, 0x79, 0x07, 0x61, 0x82, 0x9D, 0x47, 0xDB, 0x8B, 0x47, 0x34, 0xF0, 0x23, 0x71,
-    0xAE, 0xDD, 0x54, 0xBE, 0xD7, 0xB6, 0x6E, 0x55, 0xC2, 0xFC, 0x30, 0x48, 0xC3, 0xC9, 0xB8, 0x73,
-    0xDC, 0x9C, 0x28, 0xAF, 0xA4, 0x20, 0x3A, 0xE4, 0xA2, 0xA0, 0x64, 0x76, 0x4E, 0x19, 0xCA, 0xA6,
-    0x48, 0x06, 0x2A, 0xF0, 0x46, 0x03, 0x6C, 0xA8, 0x30, 0x5C, 0xB6, 0xD6, 0xAA, 0x5E, 0x2C, 0xC3,
-    0xF0, 0x04, 0xFE, 0xC9, 0x2A, 0xB8, 0xEC, 0x08, 0x6F, 0x27, 0x6B, 0x45, 0x2D, 0x06, 0xE4, 0x4C,
-    0xB6, 0x5E, 0xF7, 0x86, 0xB5, 0x0C, 0xE3, 0x2F, 0x02, 0xAF, 0xAE, 0xAB, 0xA2, 0x70, 0xA3, 0xBC,
-    0xE3, 0x4B, 0x0A, 0xAB, 0x11, 0x43, 0xA0, 0xC2, 0x57, 0x1D, 0x66, 0x4C, 0x2B, 0xE0, 0x87, 0xC4,
-    0xD7, 0xB8, 0xCE, 0x16, 0x7A, 0xC6, 0x32, 0x9C, 0x07, 0x48, 0x94, 0x02, 0xF2, 0xB7, 0x8D, 0xBD,
-    0x98, 0x2C, 0xB2, 0xAE, 0xEE, 0x75, 0x6B, 0xC7, 0xA2, 0x46, 0x5E, 0x1B, 0x75, 0x9A, 0x40, 0x6D,
-    0xDD, 0x23, 0x3A, 0x16, 0xF4, 0x87, 0x8D, 0xE7, 0xC9, 0x36, 0x33, 0xA4, 0x55, 0xC1, 0x69, 0x27,
-    0x2C, 0xF7, 0x10, 0xBF, 0x74, 0x18, 0x78, 0xAF, 0xCF, 0xD7, 0x7E, 0x32, 0x4D, 0x6E, 0x62, 0x7D,
-    0xD8, 0x09, 0xB9, 0xAF, 0x59, 0x4F, 0x56, 0x93, 0xA8, 0xB7, 0x66, 0xF6, 0xCC, 0xA7, 0xFF, 0x87,
-    0xB5, 0xBC, 0xF6, 0x85, 0x3D, 0x9D, 0xDC, 0x66, 0xA5, 0x1E, 0x14, 0x6E, 0x29, 0x34, 0xA9, 0x36,
-    0x8A, 0x3F, 0x81, 0x37, 0x05, 0x73, 0xD9, 0x6B, 0x77, 0xD3, 0xC6, 0x0D, 0x1B, 0x8A, 0x65, 0x60,
-    0x07, 0xC1, 0x59, 0x3A, 0x28, 0x0F, 0x06, 0x16, 0x13, 0x13, 0xF8, 0xE0, 0x67, 0x67, 0xA0, 0x91,
-    0xB3, 0x58, 0x11, 0x40, 0xE3, 0x23, 0x81, 0x4F, 0xC9, 0xEA, 0x17, 0xDC, 0x63, 0xC9, 0x83, 0x95,
-    0x97, 0x5F, 0xB5, 0x58, 0x3F, 0x8C, 0xD6, 0xE6, 0x19, 0x7F, 0x6C, 0x73, 0x58, 0xC2, 0x52, 0xCD,
-    0x90, 0xEB, 0x40, 0x2A, 0xB9, 0x63, 0x55, 0xA9, 0x78, 0xED, 0x92, 0xD8, 0x27, 0x06, 0x86, 0x0C,
-    0x41, 0xD5, 0x7D, 0x4B, 0x33, 0xB0, 0x74, 0x62, 0x61, 0xED, 0x12, 0xD9, 0x49, 0x86, 0x8E, 0x30,
-    0x90, 0xA9, 0x43, 0x18, 0x32, 0x04, 0x67, 0xB8, 0x8E, 0x0C, 0xDC, 0xBD, 0xEE, 0xDD, 0xD0, 0x81,
-    0x01, 0x27, 0xA8, 0x62, 0x60, 0xA8, 0xDB, 0xA6, 0x42, 0x02, 0x29, 0x35, 0x91, 0xD3, 0x9A, 0x0F,
-    0xDB, 0x6F, 0x7F, 0xBF, 0xC7, 0x9F, 0xBF, 0xEF, 0x08, 0x21, 0x81, 0xA6, 0x35, 0x67, 0x73, 0xEF,
-    0xBF, 0xE7, 0xF7, 0xFC, 0x7F, 0x9E, 0xF7, 0x44, 0xF0, 0x84, 0xBD, 0x48, 0x72, 0x64, 0xF1, 0x4B,
-    0x9D, 0xD5, 0x12, 0xB4, 0x18, 0x7B, 0xBD, 0x8B, 0xF1, 0x20, 0xD9, 0xC3, 0xC2, 0x48, 0x68, 0xAD,
-    0xCD, 0x5D, 0x7C, 0x4A, 0x49, 0xBE, 0xBE, 0x58, 0x63, 0xBF, 0xD7, 0x8A, 0x63, 0x1D, 0x1E, 0xAB,
-    0x07, 0x91, 0xA0, 0x4F, 0x04, 0xE3, 0x38, 0xC7, 0xF8, 0x9F, 0x25, 0xC6, 0xB6, 0xE1, 0xB8, 0x05,
-    0xE9, 0x04, 0x7B, 0x24, 0x18, 0x89, 0xA2, 0x9F, 0xD7, 0xF8, 0x39, 0xF9, 0xB1, 0x48, 0x66, 0x73,
-    0xC7, 0xDA, 0xDA, 0xAD, 0x63, 0xEC, 0x0D, 0x3B, 0x11, 0x1F, 0x3B, 0xBD, 0xE9, 0x0D, 0x9E, 0xF6,
-    0x58, 0x07, 0x07, 0x7B, 0xBD, 0xDF, 0x79, 0x7D, 0xD8, 0x78, 0x7D, 0x54, 0x79, 0x5D, 0x52, 0xFA,
-    0x6D, 0x52, 0x06, 0x4D, 0x52, 0x86, 0x78, 0xA3, 0x2A, 0x29, 0xF9, 0xCF, 0xA4, 0xC9, 0xD3, 0x11,
-    0x2C, 0xB6, 0xE2, 0x59, 0x30, 0x70, 0x5A, 0xF4, 0x01, 0xB3, 0x47, 0x78, 0xDF, 0xB6, 0x16, 0xFC,
-    0x85, 0xE0, 0x24, 0xA9, 0x30, 0x99, 0x8A, 0xA7, 0xC3, 0xA2, 0x30, 0x77, 0x57, 0xAB, 0xDB, 0x8B,
-    0x8B, 0xDF, 0x5C, 0xBD, 0x20, 0xC9, 0x3D, 0xAC, 0x5E, 0xC4, 0x6A, 0x66, 0x29, 0xCA, 0xF4, 0x5C,
-    0xBA, 0xEA, 0xE5, 0x60, 0xAB, 0x4B, 0x20, 0x1F, 0xA7, 0xCD, 0x72, 0xCF, 0x4A, 0x30, 0x40, 0x7A,
-    0x1E, 0x4F, 0x3A, 0x77, 0x14, 0xD7, 0x36, 0x61, 0x23, 0x71, 0x56, 0x65, 0xA5, 0xDB, 0x9A, 0xF7,
-    0x46, 0x89, 0x77, 0xC6, 0xA0, 0x75, 0x5B, 0xBF, 0x8B, 0xAB, 0x38, 0x8F, 0x6A, 0xB3, 0xD3, 0x89,
-    0xD9, 0x19, 0xA3, 0xDC, 0xEB, 0xFD, 0xA1, 0x93, 0xB0, 0x09, 0xC1, 0xB2, 0xC9, 0xE3, 0x8E, 0xD2,
-    0x27, 0x20, 0x59, 0x89, 0x1D, 0xCD, 0xA8, 0x0A, 0xAF, 0xA4, 0x8F, 0x6D, 0x27, 0x6E, 0xB9, 0xF5,
-    0xA1, 0xAC, 0x9F, 0x53, 0xFC, 0x98, 0x9C, 0xDA, 0x85, 0x9E, 0x3D, 0x6C, 0x12, 0xDF, 0xD6, 0x2B,
-    0x8D, 0x87, 0x77, 0x20, 0x49, 0x7C, 0x85, 0x56, 0xA1, 0x32, 0x33, 0x0F, 0x1A, 0x1F, 0x3C, 0x98,
-    0xB1, 0x77, 0x6C, 0xEA, 0x76, 0x62, 0x73, 0x98, 0xCD, 0x96, 0x7E, 0x23, 0x59, 0x15, 0xD6, 0x30,
-    0x5D, 0x04, 0xB6, 0x9B, 0xB8, 0x94, 0xA8, 0x4D, 0x1E, 0x16, 0x7B, 0x3D, 0x84, 0xB5, 0xD3, 0x87,
-    0x28, 0xB0, 0x8E, 0xB5, 0xF7, 0xF9, 0xF9, 0xC8, 0x16, 0x7B, 0x03, 0xB8, 0x0B, 0x1B, 0x03, 0x07,
-    0xD8, 0x81, 0x2B, 0xF4, 0xA0, 0x1A, 0xD6, 0x10, 0x3C, 0x83, 0xE9, 0x5C, 0xB2, 0x1E, 0x56, 0x92,
-    0x95, 0x19, 0x94, 0xF8, 0x01, 0x58, 0xB6, 0x61, 0x09, 0x81, 0x0E, 0xC0, 0xD1, 0x53, 0xB0, 0x15,
-    0x93, 0xD5, 0x64, 0xA0, 0x51, 0xD4, 0x2D, 0xF2, 0xC9, 0xCE, 0xB2, 0xB5, 0x11, 0xCB, 0xC0, 0xB5,
-    0xE8, 0x5F, 0x8D, 0x47, 0x74, 0xCF, 0x5E, 0x13, 0xA1, 0xFB, 0xE1, 0xC4, 0x2C, 0xAF, 0x24, 0x25,
-    0x1D, 0x75, 0x59, 0x14, 0xC5, 0x07, 0xE4, 0xA9, 0xE1, 0xA7, 0x07, 0xDB, 0x45, 0x11, 0xD2, 0x42,
-    0xAE, 0x7A, 0x97, 0x6E, 0x0A, 0x94, 0x7D, 0xFB, 0x8F, 0xC5, 0x22, 0x0D, 0x27, 0x43, 0x51, 0x22,
-    0x07, 0x5F, 0x15, 0xEB, 0x02, 0x3F, 0xFD, 0x8A, 0x78, 0xC0, 0xA5, 0x18, 0xBB, 0x24, 0xA1, 0x7B,
-    0x27, 0x4F, 0xCE, 0xB7, 0x12, 0x37, 0x90, 0x08, 0x44, 0x47, 0x09, 0x3A, 0x08, 0x08, 0x5E, 0xA1,
-    0x22, 0xA8, 0x60, 0xF9, 0x09, 0xF7, 0x58, 0xD2, 0xB4, 0x47, 0x63, 0x31, 0x16, 0xD7, 0x6D, 0x0A,
-    0x89, 0xE3, 0x3A, 0xC9, 0xB1, 0x09, 0x0A, 0x10, 0x73, 0x9F, 0x56, 0xB0, 0xC3, 0x62, 0x97, 0xFE,
-    0x67, 0xD5, 0x4F, 0x4A, 0x52, 0x6E, 0x24, 0x52, 0xF6, 0x9B, 0x99, 0x01, 0x91, 0xED, 0xC5, 0x02,
-    0xA6, 0xC3, 0xBA, 0xF2, 0xC8, 0x4F, 0x1F, 0x52, 0x06, 0x5A, 0x4E, 0xFD, 0x10, 0xFC, 0x41, 0xB8,
-    0x67, 0x31, 0x8B, 0xE2, 0xBA, 0x2A, 0x23, 0x22, 0x21, 0xCF, 0x5E, 0xA5, 0xC8, 0x6B, 0xB5, 0xC9,
-    0xEB, 0xC4, 0x14, 0x07, 0x72, 0x2B, 0x02, 0x0E, 0x75, 0xC2, 0x95, 0x7A, 0xE2, 0x06, 0x1A, 0x37,
-    0x7A, 0xEE, 0x98, 0xAA, 0x3A, 0xC5, 0x39, 0x05, 0xC2, 0xE6, 0x68, 0xA3, 0xD6, 0x9F, 0x63, 0x6C,
-    0xD7, 0x9B, 0xE2, 0x7A, 0x66, 0x3D, 0xEC, 0xB6, 0x16, 0x8B, 0xCB, 0xFD, 0x84, 0x66, 0x49, 0x1E,
-    0xE8, 0x57, 0x67, 0x91, 0x86, 0xF5, 0x09, 0xA6, 0x0B, 0x2E, 0x4D, 0x8E, 0xDC, 0x88, 0xDF, 0xBE,
-    0x63, 0x19, 0xFF, 0x49, 0x0D, 0x55, 0x42, 0x9F, 0x70, 0x43, 0x88, 0x81, 0xD5, 0xA6, 0x30, 0x0F,
-    0x3F, 0xED, 0x37, 0x22, 0x1E, 0x16, 0x7B, 0x0F, 0xF7, 0x1A, 0xAC, 0x53, 0x0B, 0x86, 0x36, 0x8D,
-    0x4A, 0x9C, 0xF4, 0x9E, 0xD8, 0x7C, 0xB1, 0xA0, 0x7D, 0x66, 0x85, 0xE5, 0xDE, 0x24, 0x91, 0x50,
-    0xED, 0x93, 0x3B, 0xC9, 0xF6, 0xA4, 0x54, 0xC5, 0x4C, 0xD7, 0x3C, 0x5A, 0x15, 0x61, 0xB2, 0x77,
-    0xAA, 0xAA, 0x83, 0x70, 0xCF, 0x62, 0x16, 0xC5, 0x5E, 0x33, 0x2B, 0xC3, 0xA7, 0x14, 0xAF, 0x5B,
-    0x4F, 0x35, 0x66, 0x57, 0x8E, 0xF1, 0x44, 0xB6, 0x48, 0x78, 0x7A, 0x74, 0xC9, 0xDE, 0xD1, 0xEF,
-    0x49, 0x8B, 0x1C, 0x50, 0xE1, 0x0C, 0x74, 0x1A, 0xB5, 0x4C, 0x63, 0x19, 0x42, 0xAA, 0x46, 0xB8,
-    0x21, 0xD8, 0xFE, 0x3F, 0xD3, 0x91, 0xED, 0x02, 0xDB, 0x43, 0xAB, 0xC6, 0x3E, 0x2E, 0x8A, 0x9D,
-    0xA2, 0xC8, 0x95, 0x2B, 0xCA, 0xB3, 0x83, 0x77, 0xF4, 0x6D, 0x61, 0xBA, 0x70, 0x10, 0xBF, 0x41,
-    0x16, 0x0F, 0x99, 0x5A, 0x7E, 0xC1, 0xCC, 0x22, 0xD3, 0x27, 0xA3, 0xBA, 0x54, 0x25, 0x56, 0x93,
-    0xC8, 0xAC, 0x3C, 0xE6, 0x3F, 0x0D, 0x21, 0xF5, 0x2C, 0x4E, 0x23, 0x67, 0x9E, 0xA2, 0x95, 0xDE,
-    0xF5, 0x69, 0x2F, 0x98, 0x35, 0xBA, 0x3B, 0xAB, 0xAC, 0x67, 0xC0, 0xD4, 0x3F, 0x86, 0xDE, 0xA8,
-    0x50, 0x7F, 0x4A, 0x93, 0x9F, 0xC3, 0x57, 0xA1, 0xC3, 0x46, 0x5D, 0xC0, 0x19, 0x26, 0x8F, 0xC9,
-    0x52, 0x25, 0x8F, 0x64, 0x23, 0x06, 0x48, 0x50, 0x70, 0x5C, 0x29, 0x79, 0xBF, 0x9D, 0xF6, 0x8D,
-    0xAB, 0x23, 0xB9, 0xB8, 0xFD, 0x33, 0x47, 0xA2, 0xE9, 0x88, 0x7A, 0x16, 0x7D, 0x0A, 0xD3, 0x3C,
-    0xC7, 0x5D, 0x24, 0xC3, 0x43, 0xDC, 0xF2, 0x92, 0x4B, 0xC3, 0x66, 0x29, 0x5C, 0x2D, 0xC1, 0x5B,
-    0x4E, 0xA5, 0xE2, 0x80, 0x8F, 0x28, 0x75, 0x3F, 0x6B, 0x7F, 0x9B, 0xFC, 0x25, 0x3B, 0x84, 0x47,
-    0xBB, 0x70, 0xEA, 0xC8, 0xA6, 0x91, 0xB5, 0xE7, 0xC7, 0xA7, 0x43, 0x12, 0xBD, 0x5D, 0xEE, 0xB4,
-    0xA7, 0xB1, 0x45, 0x77, 0x5E, 0x4A, 0x91, 0x6C, 0x61, 0x80, 0xE4, 0x7D, 0x14, 0xBC, 0xF9, 0xE7,
-    0x5E, 0x17, 0xD9, 0xC6, 0x87, 0x4E, 0x77, 0xC5, 0xF1, 0x7A, 0xF3, 0x68, 0xD4, 0x10, 0x10, 0x0C,
-    0x01, 0xC8, 0xD0, 0x49, 0xA8, 0x25, 0x2A, 0xD9, 0xA7, 0x6E, 0xE3, 0x67, 0x47, 0xF9, 0x6A, 0xE4,
-    0x35, 0x5B, 0xBB, 0x18, 0x65, 0x9D, 0x0C, 0x0E, 0xE2, 0xB9, 0x71, 0x4D, 0x19, 0xA1, 0xDA, 0xA4,
-    0xFB, 0x88, 0x1B, 0x0F, 0x11, 0xD1, 0x63, 0x14, 0x34, 0x18, 0x85, 0x77, 0xA9, 0xAF, 0x2B, 0xC0,
-    0x30, 0xEF, 0xD2, 0x82, 0x0D, 0x3D, 0xB2, 0x5C, 0xD5, 0x58, 0xB5, 0x9E, 0xE2, 0xB3, 0xCE, 0x5E,
-    0x90, 0xD3, 0xA6, 0x8A, 0x12, 0xFB, 0xD6, 0xBF, 0x97, 0xE3, 0xB0, 0xEF, 0x8F, 0x61, 0x19, 0x97,
-    0xBD, 0x37, 0x04, 0xB5, 0x69, 0x33, 0x7B, 0xF1, 0xEF, 0xB6, 0x32, 0xC1, 0x17, 0x8E, 0x96, 0xB7,
-    0x14, 0xFB, 0x01, 0xD8, 0xC6, 0x36, 0xB0, 0x47, 0xCB, 0x91, 0xBB, 0x07, 0xFF, 0x11, 0xB6, 0xBF,
-    0xB9, 0xEF, 0xF5, 0xDE, 0xA3, 0xDA, 0x36, 0x07, 0x38, 0x61, 0x0F, 0x71, 0xA4, 0x0B, 0x5A, 0x67,
-    0x98, 0x22, 0x81, 0xFF, 0x79, 0xED, 0x1C, 0x84, 0x2A, 0xE6, 0x7F, 0x3D, 0x35, 0xCE, 0x89, 0x5D,
-    0x1D, 0x4C, 0x93, 0xDA, 0xBA, 0x3A, 0xB8, 0xEA, 0xE2, 0x9A, 0x41, 0xA7, 0x18, 0x0E, 0xA7, 0xB4,
-    0x95, 0xAF, 0x93, 0x7D, 0x56, 0xAE, 0x93, 0x66, 0x52, 0xAF, 0x53, 0x5C, 0xAC, 0xE9, 0x76, 0x4A,
-    0x13, 0xED, 0x37, 0x0E, 0x1B, 0x9E, 0xF0, 0x89, 0x9A, 0x6B, 0x2A, 0xF0, 0xEC, 0x8C, 0x6B, 0x9B,
-    0xED, 0xF8, 0xF6, 0x57, 0xBD, 0xF9, 0xEE, 0xCF, 0x99, 0x7C, 0xDB, 0xF9, 0x55, 0x1F, 0xDF, 0x6E,
-    0x4C, 0x7C, 0xD8, 0x9B, 0xE0, 0xAB, 0x1F, 0xFC, 0xEB, 0xE3, 0x4F, 0xCE, 0xE4, 0x2B, 0x79, 0x55,
-    0x2B, 0x2A, 0x98, 0x47, 0x8E, 0x1D, 0x16, 0x78, 0xD1, 0xA2, 0x9C, 0x30, 0xFB, 0xC7, 0x77, 0xE8,
-    0xC6, 0x7F, 0x1D, 0x18, 0x45, 0x5A, 0x7A, 0xE0, 0xD6, 0xCE, 0xC8, 0x50, 0x32, 0xB4, 0x3D, 0xBB,
-    0x24, 0x86, 0x99, 0x65, 0x38, 0xC5, 0xA5, 0x8F, 0xDE, 0x82, 0x25, 0x1A, 0x63, 0xCB, 0xF0, 0x33,
-    0x8C, 0x2F, 0xBA, 0x88, 0x5D, 0x81, 0xD1, 0x9D, 0x0E, 0x35, 0x5E, 0x31, 0x1B, 0xB4, 0x01, 0x9D,
-    0x0D, 0xC4, 0xF0, 0x83, 0xB1, 0x65, 0xA4, 0x02, 0xC4, 0x92, 0x62, 0x8C, 0xBE, 0x0B, 0x71, 0x04,
-    0x8A, 0x62, 0x49, 0x31, 0xAA, 0x46, 0xA6, 0x0F, 0x06, 0x99, 0x21, 0xC5, 0x90, 0xED, 0x88, 0xA7,
-    0x86, 0xCB, 0xBA, 0x55, 0x5B, 0xB9, 0xAA, 0xE3, 0x6A, 0xE3, 0x33, 0x37, 0xD8, 0xF6, 0xB5, 0xAC,
-    0xC7, 0x79, 0xB6, 0x34, 0x6D, 0x52, 0xA1, 0x53, 0x40, 0x49, 0xF8, 0x13, 0xA8, 0x7E, 0x8D, 0xBD,
-    0x03, 0x02, 0x3E, 0xD9, 0x2B, 0x25, 0x7C, 0x84, 0x89, 0x25, 0x26, 0xC6, 0x97, 0x9B, 0x50, 0xBD,
-    0xC5, 0xAF, 0x7E, 0x8E, 0x13, 0x0F, 0x88, 0x3D, 0x20, 0x61, 0x81, 0x8A, 0x81, 0x6B, 0x98, 0x3F,
-    0xB2, 0x64, 0x44, 0x6C, 0xBF, 0x0C, 0x1C, 0xCC, 0xD1, 0xB4, 0x7F, 0x0A, 0x35, 0xCE, 0x0C, 0xCC,
-    0xFC, 0xA8, 0x0F, 0x07, 0x70, 0xA6, 0x5F, 0xAA, 0x43, 0xFD, 0x4F, 0xDE, 0x46, 0xA3, 0xF6, 0x27,
-    0x78, 0x0F, 0x62, 0x16, 0xEA, 0x12, 0x2A, 0x02, 0xE2, 0x17, 0xB3, 0xF3, 0xFB, 0xED, 0x9C, 0xBB,
-    0xA7, 0x8E, 0x8F, 0x2E, 0x7D, 0x55, 0xBE, 0xFF, 0xA1, 0xB1, 0x6F, 0x43, 0x30, 0xBB, 0xD7, 0xC2,
-    0xCF, 0x11, 0x20, 0x61, 0xFB, 0xDA, 0xBA, 0xE7, 0x3A, 0x78, 0x7E, 0xF1, 0x37, 0x9A, 0x0F, 0xBF,
-    0xF7, 0xA1, 0xF1, 0x37, 0xEC, 0x68, 0xC9, 0x60, 0x8E, 0x3E, 0x99, 0xA3, 0xDD, 0x0E, 0xD1, 0xA5,
-    0x6F, 0x76, 0x3A, 0xD7, 0x93, 0x06, 0x93, 0x7E, 0xF3, 0xC3, 0x10, 0xBF, 0x53, 0x8E, 0x22, 0x75,
-    0xDE, 0xB3, 0x83, 0xF3, 0x04, 0x36, 0x1B, 0xF6, 0x5D, 0x3B, 0xFE, 0x48, 0x82, 0x27, 0x9B, 0xB4,
-    0x61, 0x2B, 0x0F, 0x4D, 0xCD, 0xF9, 0xE5, 0x68, 0x6C, 0x7F, 0x4B, 0x4C, 0x7F, 0x42, 0x9C, 0x6B,
-    0xC7, 0x5B, 0x4E, 0x7B, 0x19, 0x2F, 0x3B, 0xFD, 0x76, 0x9E, 0x3C, 0x83, 0x7C, 0xF0, 0x7B, 0x4C,
-    0xFC, 0xCB, 0xEA, 0xBD, 0x81, 0x52, 0xA4, 0x6C, 0xB5, 0xCF, 0x66, 0xF6, 0x77, 0xF6, 0xA9, 0x1D,
-    0xFB, 0xC0, 0x1E, 0xA6, 0x41, 0x05, 0x89, 0x77, 0x9E, 0x9B, 0xD4, 0x60, 0xBA, 0x26, 0xEF, 0xB0,
-    0x8F, 0x42, 0x71, 0x46, 0x1D, 0xF9, 0xF5, 0x8D, 0x8D, 0x78, 0x27, 0xF7, 0x1E, 0xA6, 0xC9, 0x2A,
-    0xBD, 0x1D, 0x5D, 0x15, 0xE7, 0x0F, 0xEB, 0x15, 0x0F, 0x27, 0xF7, 0x57, 0x45, 0xF4, 0x1E, 0x61,
-    0xD1, 0x3C, 0xBB, 0xAD, 0x6C, 0x67, 0x8B, 0xF3, 0xD3, 0xE4, 0x67, 0xD9, 0x62, 0xD7, 0xC7, 0xA6,
-    0x9F, 0xC9, 0xDC, 0x38, 0x2E, 0xE2, 0x55, 0x6B, 0xDE, 0xE2, 0xF7, 0xDD, 0x99, 0x50, 0x30, 0x33,
-    0xCE, 0x16, 0x7E, 0x46, 0x76, 0x20, 0xD1, 0x8D, 0x59, 0xD6, 0x63, 0xD6, 0xB9, 0xA9, 0x29, 0xD0,
-    0xB4, 0xFA, 0x53, 0x0B, 0xAE, 0x7D, 0x3E, 0xBB, 0xAD, 0xE3, 0x6F, 0xAF, 0x41, 0x25, 0x3F, 0xDD,
-    0xD4, 0x78, 0xB2, 0x77, 0x42, 0xC8, 0x9D, 0x24, 0xB8, 0x00, 0xE2, 0xA8, 0xAC, 0xDF, 0x8A, 0xAD,
-    0x53, 0x60, 0xD3, 0xE9, 0x87, 0x89, 0xEB, 0xEC, 0x5A, 0xFA, 0xE3, 0xD2, 0xCD, 0xC6, 0xC1, 0x3D,
-    0x33, 0x65, 0x92, 0xCB, 0x90, 0xA4, 0x06, 0xA6, 0x38, 0xD3, 0xFA, 0xBC, 0x64, 0xE6, 0xC0, 0x46,
-    0xFA, 0x8E, 0x79, 0xC1, 0xCC, 0x71, 0xBB, 0x22, 0x2F, 0xCC, 0x26, 0x59, 0xC7, 0x4D, 0x78, 0x03,
-    0x84, 0xA5, 0x6F, 0xB5, 0xA5, 0x43, 0x49, 0xD8, 0xD7, 0x3A, 0xE7, 0xCE, 0x40, 0xB9, 0x9C, 0x65,
-    0xF6, 0x4F, 0x99, 0xE4, 0x27, 0xB2, 0x13, 0x5D, 0x3A, 0x03, 0x2B, 0x24, 0x84, 0x44, 0x55, 0x20,
-    0xE5, 0x9E, 0xCC, 0xC6, 0x03, 0x76, 0xA9, 0x0A, 0x50, 0xF8, 0x91, 0x32, 0x6B, 0x1F, 0x7C, 0xA3,
-    0x26, 0x03, 0xD6, 0x9D, 0x6A, 0xE8, 0x8B, 0x3A, 0xCA, 0xE8, 0x78, 0x47, 0xB9, 0x6E, 0x41, 0x37,
-    0x4D, 0xB3, 0xF6, 0xCB, 0x1A, 0x2C, 0x5A, 0x96, 0x82, 0x17, 0x77, 0x94, 0xC7, 0x2E, 0x24, 0x66,
-    0x4E, 0x95, 0x5B, 0x97, 0xFF, 0x2C, 0x27, 0x9F, 0xBB, 0x1C, 0x8C, 0xBC, 0x1C, 0x64, 0x24, 0xC8,
-    0x0B, 0x09, 0x3B, 0x99, 0x84, 0x97, 0x39, 0x5E, 0x8F, 0x89, 0x3F, 0x90, 0x9F, 0x8C, 0xFC, 0xB0,
-    0x2A, 0xD8, 0x8F, 0xAA, 0x6F, 0xB9, 0x1C, 0x18, 0x5E, 0x0E, 0x34, 0x61, 0x6A, 0x39, 0x0D, 0xB4,
-    0x42, 0x7E, 0x2C, 0xEB, 0x86, 0x45, 0x36, 0xD9, 0x1A, 0x18, 0xB8, 0x1B, 0xD7, 0x14, 0x7E, 0x7C,
-    0x56, 0xF8, 0xEC, 0xB2, 0xBA, 0x06, 0x84, 0x0F, 0x79, 0x7B, 0xF7, 0x57, 0xF8, 0xFA, 0xF7, 0x02,
-    0x08, 0x6F, 0x28, 0x7C, 0x92, 0x83, 0xD7, 0xB0, 0x02, 0xAF, 0x01, 0x9A, 0xA3, 0xE7, 0x84, 0xCF,
-    0x3E, 0x4C, 0x57, 0x2C, 0x84, 0xF5, 0xDC, 0x0C, 0xC8, 0xEE, 0xC6, 0x3D, 0xE1, 0xAD, 0x35, 0x9D,
-    0x9C, 0x2D, 0xC1, 0x18, 0x0F, 0xE9, 0xA4, 0x6A, 0xD5, 0x27, 0x3B, 0x48, 0x41, 0x15, 0x9B, 0x92,
-    0x8F, 0x5E, 0x97, 0xB4, 0xA4, 0x47, 0x28, 0xE6, 0x1F, 0x47, 0xEC, 0x4C, 0xF5, 0x82, 0xE0, 0xEC,
-    0x59, 0x6D, 0x02, 0x04, 0x21, 0xB2, 0x38, 0x47, 0xE8, 0x2B, 0xA4, 0x95, 0xE8, 0xB5, 0x45, 0xB3,
-    0x03, 0xC4, 0x62, 0xC8, 0x28, 0x0E, 0xF4, 0xB0, 0xA5, 0x65, 0x56, 0x3B, 0x09, 0x52, 0x77, 0xC6,
-    0xD9, 0x80, 0x7A, 0xFF, 0x21, 0x7C, 0xD0, 0x5F, 0xC2, 0xBD, 0xE8, 0x73, 0x86, 0x98, 0xDE, 0xEC,
-    0x62, 0x3B, 0xAE, 0x32, 0x31, 0x31, 0xDE, 0x22, 0x06, 0x69, 0xF5, 0x66, 0x22, 0xB8, 0xAD, 0x28,
-    0xA3, 0x06, 0x26, 0xEE, 0xFA, 0xF5, 0x4D, 0xD4, 0xCF, 0xEA, 0xAC, 0xD3, 0xFB, 0x55, 0x90, 0x47,
-    0xE7, 0x6A, 0xB7, 0x76, 0x1F, 0x37, 0x88, 0xC3, 0x37, 0x6E, 0xC2, 0x67, 0xC3, 0x03, 0x09, 0xF4,
-    0x2F, 0x2C, 0xF3, 0xD3, 0x61, 0x32, 0xF8, 0x92, 0x93, 0x0F, 0x4A, 0xC4, 0x4A, 0xDB, 0x61, 0xE7,
-    0xAD, 0x18, 0x93, 0x6F, 0x7A, 0x4D, 0x90, 0x27, 0x92, 0xBC, 0x5F, 0x1B, 0x95, 0x01, 0x82, 0x6B,
-    0x54, 0x6D, 0x5F, 0x58, 0xDD, 0x81, 0x56, 0x98, 0xE3, 0x1E, 0x31, 0x59, 0xB3, 0x2B, 0x21, 0x26,
-    0xF6, 0x9D, 0x83, 0x20, 0xC4, 0x14, 0x62, 0x62, 0xCB, 0xC1, 0xA4, 0x86, 0x63, 0x98, 0x42, 0x4C,
-    0x4C, 0x3E, 0xA0, 0x16, 0x5A, 0x8E, 0x81, 0x29, 0xC4, 0x84, 0x53, 0xD0, 0x6F, 0x88, 0xF9, 0xE9,
-    0x4B, 0x60, 0xD6, 0x68, 0xC7, 0x7D, 0xFE, 0x3D, 0xE4, 0xDC, 0xA3, 0xDA, 0x5D, 0x3E, 0x6E, 0x0E,
-    0xDC, 0xEE, 0x8D, 0x9B, 0xC1, 0xDF, 0x3A, 0xC8, 0xC9, 0x50, 0x4B, 0x79, 0xB3, 0xAE, 0xD0, 0x96,
-    0x47, 0x8C, 0xBB, 0xE0, 0x4B, 0xB7, 0xDB, 0x77, 0x1F, 0x1C, 0x76, 0x41, 0xDD, 0x2E, 0x3B, 0x39,
-    0xB8, 0x85, 0x4B, 0x4B, 0x30, 0xB2, 0x61, 0xB7, 0xAF, 0x82, 0x59, 0x11, 0xB3, 0x22, 0x26, 0xD0,
-    0x81, 0x29, 0xC0, 0xBC, 0x85, 0x0F, 0x30, 0x5D, 0x62, 0xBA, 0x8A, 0xD9, 0x11, 0x13, 0xF4, 0x81,
-    0x29, 0x1E, 0x30, 0x21, 0x27, 0x30, 0x85, 0x98, 0x90, 0x93, 0x89, 0xE6, 0x45, 0x98, 0x0C, 0x15,
-    0x8E, 0xD8, 0xEF, 0xB0, 0xD0, 0xB1, 0x32, 0xBF, 0xFA, 0xC4, 0x99, 0x62, 0xD4, 0x12, 0xB3, 0xA4,
-    0x37, 0x1A, 0xF5, 0xD4, 0xF9, 0xD6, 0xB0, 0xC5, 0x46, 0xFC, 0x44, 0xD8, 0xC0, 0xB1, 0x93, 0xFB,
-    0x03, 0x0A, 0x6C, 0xB4, 0xB4, 0x69, 0xD2, 0xB0, 0xEA, 0x05, 0xED, 0xDC, 0xAF, 0xC9, 0x7F, 0x00,
-    0x3D, 0xCE, 0xD1, 0x0D, 0x83, 0x30, 0x0C, 0x04, 0x50, 0x13, 0x7F, 0xF2, 0x91, 0x15, 0x3A, 0x01,
-    0x19, 0x01, 0xC4, 0x1A, 0x9D, 0xA0, 0x53, 0x96, 0x15, 0xCA, 0x04, 0x16, 0x0C, 0x80, 0x07, 0x88,
-    0xB8, 0x9E, 0x5D, 0xA9, 0xFE, 0x79, 0x39, 0xE5, 0x22, 0x47, 0x44, 0x1E, 0x12, 0x53, 0x2C, 0x69,
-    0x49, 0x41, 0x32, 0x3D, 0x83, 0xB2, 0xE5, 0xDD, 0x24, 0x03, 0x29, 0xFD, 0x15, 0xA9, 0x01, 0x6A,
-    0xAC, 0x01, 0xD5, 0x22, 0xF4, 0x66, 0x11, 0xFC, 0x6D, 0x0C, 0x58, 0x71, 0x00, 0xF7, 0x52, 0x71,
-    0x02, 0x9B, 0xB0, 0x0A, 0xB0, 0xE4, 0x8A, 0x3E, 0xF2, 0xA4, 0xAC, 0xC1, 0xC9, 0x87, 0x81, 0xF0,
-    0x59, 0x70, 0x31, 0x88, 0xF6, 0xEA, 0x81, 0xCF, 0xB1, 0x5F, 0x77, 0x4F, 0x90, 0x5F, 0x53, 0xFF,
-    0x21, 0xFF, 0xF9, 0x02,
+static const uint8_t bookerly_14_boldBitmaps[30074] = {
+    0xCD, 0x9B, 0x3F, 0xD0, 0x27, 0x47, 0x99, 0xDF, 0x3F, 0x33, 0xAD, 0xF7, 0xED, 0x3B, 0x4D, 0x99,
+    0xDE, 0x40, 0xE2, 0xEE, 0xB4, 0xB6, 0x87, 0xC0, 0x01, 0x85, 0x6D, 0x4D, 0xE2, 0xC0, 0x09, 0xF4,
+    0xC0, 0xDA, 0x47, 0xA0, 0x40, 0x1B, 0xEC, 0xEB, 0x2B, 0x4C, 0xC0, 0x05, 0x5C, 0x60, 0x5C, 0xAE,
+    0xBD, 0xC0, 0x81, 0x5D, 0x85, 0xB7, 0x47, 0xA8, 0xEA, 0x14, 0x10, 0xB0, 0xE5, 0x02, 0xA7, 0xA8,
+    0x5C, 0xA2, 0x2C, 0x56, 0x81, 0x2E, 0x70, 0x40, 0x80, 0xD4, 0x2D, 0x6D, 0xA0, 0x80, 0x80, 0x91,
+    0x54, 0x36, 0x55, 0x26, 0xD0, 0x70, 0xB7, 0x18, 0x9F, 0x08, 0xB6, 0x39, 0x46, 0xDA, 0xD9, 0x55,
+    0xCF, 0x7C, 0x1D, 0xCC, 0xEF, 0x7D, 0x77, 0x17, 0x04, 0x27, 0x19, 0x09, 0x3C, 0xEF, 0x3B, 0x3D,
+    0xFD, 0xF6, 0x4C, 0x77, 0x3F, 0xFD, 0x74, 0x3F, 0xFF, 0xBE, 0xDD, 0xEF, 0x23, 0x8F, 0x2D, 0xFA,
+    0xDA, 0xAC, 0xC7, 0xB3, 0x5C, 0x96, 0xCB, 0xB1, 0xC9, 0xC1, 0x66, 0x6F, 0xF2, 0x39, 0xE8, 0x1E,
+    0x2B, 0xF1, 0x95, 0xF2, 0x30, 0xDD, 0x67, 0x7E, 0x32, 0x2B, 0xBA, 0x9F, 0xE6, 0xED, 0x90, 0xFC,
+    0x20, 0xAF, 0x57, 0xDC, 0xAB, 0x5C, 0xE4, 0xA8, 0x7F, 0x18, 0x56, 0x3B, 0xE1, 0xD2, 0x0B, 0x54,
+    0xC5, 0x25, 0xBA, 0xA1, 0x20, 0x49, 0xAD, 0xA4, 0xE9, 0xF3, 0x6F, 0x85, 0x4B, 0xBC, 0x68, 0x32,
+    0x6E, 0xBC, 0x02, 0xA5, 0x19, 0xEB, 0xE7, 0xDF, 0xDC, 0x9E, 0x89, 0x92, 0x1A, 0x49, 0x93, 0xC9,
+    0x5D, 0x4F, 0x30, 0x99, 0x66, 0xF2, 0xF0, 0x82, 0x9D, 0xB8, 0x7B, 0xB5, 0xC0, 0x77, 0xA1, 0xCE,
+    0xD0, 0x24, 0x6A, 0x2D, 0x04, 0x15, 0xFB, 0xCE, 0x3B, 0xC5, 0x7F, 0xF5, 0xAB, 0x79, 0x7D, 0xD4,
+    0x3D, 0x39, 0x7F, 0xE7, 0x21, 0x77, 0x6B, 0xA2, 0x53, 0x8F, 0xD7, 0x48, 0xA7, 0x4C, 0xA3, 0x8C,
+    0xD3, 0xF4, 0xA7, 0x9F, 0x0C, 0xAF, 0xA4, 0x1C, 0xFD, 0x85, 0x97, 0x8B, 0x9C, 0xFB, 0x2B, 0xBD,
+    0x28, 0x23, 0xE5, 0x4A, 0x1B, 0x74, 0xC0, 0x97, 0xCF, 0x5A, 0xA5, 0x03, 0x2E, 0x9D, 0x75, 0x79,
+    0xD4, 0x53, 0x8F, 0x58, 0x0D, 0x04, 0x2A, 0x6D, 0xB8, 0x11, 0xFF, 0xD9, 0xB9, 0x2A, 0xD8, 0xEC,
+    0x07, 0xDF, 0xF3, 0x62, 0xBD, 0xD8, 0x89, 0x66, 0xEA, 0x52, 0x81, 0xAD, 0x5E, 0xBA, 0x81, 0x66,
+    0xEA, 0x9E, 0xCC, 0x10, 0x4C, 0x7E, 0xC1, 0xDE, 0x36, 0xB7, 0xA3, 0xBB, 0xAE, 0xB9, 0xD5, 0xCB,
+    0x39, 0x5E, 0x4E, 0xDD, 0x78, 0xC5, 0xA5, 0x0D, 0xDC, 0x4B, 0xA5, 0x99, 0xA8, 0x96, 0x6E, 0x08,
+    0xE0, 0xEB, 0xC5, 0x66, 0x9A, 0xA9, 0x1B, 0x5E, 0x84, 0x52, 0x97, 0x66, 0xC4, 0xF7, 0x6E, 0x2C,
+    0xD8, 0x4C, 0x54, 0xCF, 0x4A, 0xAD, 0x11, 0x9B, 0xA8, 0x2E, 0x72, 0xDF, 0xD5, 0xA8, 0x07, 0xA4,
+    0x1E, 0xDC, 0x6D, 0x01, 0xA1, 0x2F, 0x50, 0x17, 0x93, 0xA1, 0xC9, 0x6D, 0x82, 0x2E, 0xAD, 0x40,
+    0x7C, 0x6C, 0x04, 0xF4, 0x0F, 0x80, 0xA6, 0x70, 0xED, 0x19, 0x54, 0x1A, 0x65, 0xA7, 0xA5, 0x55,
+    0x0A, 0x5F, 0x9B, 0x9B, 0xC9, 0x94, 0x76, 0x6E, 0x07, 0x97, 0xBB, 0xF9, 0x45, 0x7C, 0xEA, 0xEE,
+    0xCC, 0x88, 0x4E, 0xA9, 0x16, 0x9D, 0x7A, 0xA3, 0x6F, 0x44, 0xDD, 0xB0, 0x92, 0xB4, 0xD4, 0xD2,
+    0x7F, 0x51, 0xE2, 0xE1, 0x8B, 0x5C, 0xA2, 0xFB, 0xC2, 0x0F, 0xFF, 0xB6, 0xC4, 0xEE, 0x7B, 0x3F,
+    0x2B, 0x57, 0x1E, 0x00, 0xE0, 0x2F, 0xF1, 0xA9, 0x99, 0xAB, 0x0D, 0x9F, 0x9A, 0xCC, 0x46, 0x97,
+    0x4C, 0xC1, 0xF7, 0x76, 0x26, 0xD2, 0x64, 0x84, 0xCB, 0x7B, 0x2E, 0xF4, 0x66, 0xC1, 0xA7, 0x7A,
+    0xC5, 0x65, 0x62, 0x6F, 0x0A, 0x6D, 0x26, 0x0E, 0x75, 0xC1, 0x02, 0xD5, 0x84, 0x1F, 0xEA, 0x8D,
+    0x66, 0xC1, 0x27, 0x36, 0x9A, 0x8C, 0x1F, 0x4C, 0xA1, 0x1B, 0xAB, 0x15, 0x37, 0xB1, 0xE1, 0x32,
+    0xDB, 0x9E, 0x6B, 0xC7, 0xBA, 0xE0, 0x93, 0x99, 0x89, 0xB4, 0xA3, 0x29, 0xC4, 0xBE, 0x9B, 0xEA,
+    0x85, 0x07, 0x01, 0x38, 0xF7, 0x42, 0xF5, 0xDA, 0xEC, 0xDE, 0x18, 0xBA, 0xF5, 0x19, 0xAB, 0x1F,
+    0xC5, 0x9B, 0x8F, 0xDF, 0xFC, 0x17, 0x8F, 0x7A, 0xCE, 0x15, 0xAA, 0x1E, 0x80, 0x7A, 0x81, 0x6E,
+    0xB8, 0xE7, 0x11, 0xA4, 0x1F, 0x48, 0xEB, 0x27, 0xE2, 0x9B, 0xC3, 0xFD, 0xEF, 0xAA, 0x67, 0x00,
+    0x3B, 0xDB, 0x62, 0x8A, 0x29, 0x66, 0x6E, 0xB2, 0x1B, 0xBB, 0xE1, 0x53, 0x00, 0x74, 0x92, 0xA4,
+    0x0D, 0xA0, 0x2E, 0xE1, 0x27, 0xF2, 0xE3, 0x45, 0x68, 0x32, 0xF8, 0x44, 0xB5, 0x82, 0xCB, 0x10,
+    0x7A, 0x4C, 0x01, 0x37, 0x41, 0x04, 0xB3, 0x40, 0x37, 0x82, 0xC0, 0xCE, 0xFB, 0x77, 0xDB, 0xA1,
+    0xCA, 0x40, 0x5D, 0xEE, 0xAB, 0xD2, 0xEE, 0x55, 0xEE, 0x99, 0xF9, 0xB8, 0x40, 0xD0, 0x4C, 0x27,
+    0x25, 0xBB, 0x35, 0x42, 0x43, 0x37, 0xBB, 0x8C, 0xBE, 0x22, 0x5C, 0xF1, 0x13, 0xF1, 0xFA, 0x86,
+    0x2D, 0x7E, 0x22, 0x5C, 0x5F, 0xF7, 0x4C, 0xBC, 0xBE, 0xD1, 0x14, 0x3F, 0xED, 0xDF, 0xCC, 0xED,
+    0x5C, 0x09, 0xA5, 0x30, 0x59, 0xA9, 0xD0, 0x49, 0x10, 0x34, 0xC0, 0xC3, 0x87, 0x1E, 0xFE, 0x29,
+    0x84, 0x5C, 0x4B, 0x78, 0xE5, 0x5A, 0x82, 0x2E, 0x53, 0xBF, 0xA7, 0xC7, 0xB1, 0xF4, 0x15, 0xA9,
+    0x74, 0x52, 0x02, 0x20, 0xAC, 0x58, 0x29, 0xB5, 0x52, 0xF6, 0xD9, 0xCF, 0x3E, 0xB5, 0x8B, 0x4F,
+    0x6E, 0xE9, 0x06, 0x37, 0x43, 0x97, 0xC1, 0x4F, 0xA0, 0x44, 0xAD, 0x9E, 0x66, 0x85, 0x6E, 0x86,
+    0x38, 0x52, 0x0B, 0x9A, 0x02, 0xDD, 0x9D, 0x6B, 0xDF, 0x0E, 0xD2, 0xEA, 0xA5, 0xB5, 0x93, 0x16,
+    0x80, 0x5A, 0x0B, 0x51, 0xA5, 0x91, 0x16, 0x3F, 0x76, 0xF9, 0x05, 0x7C, 0x7A, 0x1A, 0x41, 0xB3,
+    0x40, 0x4C, 0x5C, 0x5E, 0x68, 0xB5, 0xE0, 0x55, 0xF8, 0xD6, 0xE5, 0x79, 0xEF, 0x20, 0x26, 0xCC,
+    0x06, 0xDD, 0x8C, 0xD5, 0xCB, 0xCF, 0xA9, 0x38, 0x69, 0x70, 0xBA, 0xC1, 0xD1, 0x19, 0x53, 0xAB,
+    0x08, 0xF8, 0x0C, 0x4E, 0x50, 0x2B, 0x43, 0x10, 0x38, 0x65, 0xEA, 0x55, 0x10, 0x1E, 0xCF, 0xB8,
+    0x49, 0x98, 0xE2, 0x32, 0x11, 0xD1, 0x8E, 0x2E, 0x9B, 0xED, 0x9A, 0x9E, 0xF5, 0x92, 0x5E, 0x97,
+    0xB4, 0x3E, 0x78, 0x2D, 0xDE, 0xB9, 0x0A, 0x62, 0x9F, 0xBD, 0xBB, 0x99, 0x13, 0x6A, 0x69, 0x76,
+    0xD2, 0xE8, 0x25, 0x74, 0xED, 0xD9, 0xD3, 0x59, 0x0D, 0x23, 0x95, 0x36, 0x1A, 0xA9, 0xEF, 0xA4,
+    0x9E, 0xCB, 0x02, 0x57, 0xA0, 0x9D, 0x21, 0xEC, 0x3C, 0x70, 0x85, 0x5A, 0xE3, 0x35, 0x6D, 0x46,
+    0x1A, 0xAD, 0x16, 0xAA, 0x33, 0xBD, 0x14, 0x66, 0xAC, 0x0A, 0x5E, 0x37, 0xD0, 0x4C, 0xAD, 0x01,
+    0xBB, 0x81, 0x5B, 0xA0, 0xBD, 0xF3, 0x0C, 0x5E, 0x1A, 0xBC, 0x94, 0xFD, 0x18, 0x96, 0x90, 0x5C,
+    0x09, 0xC9, 0x96, 0x30, 0x9A, 0xD5, 0x8F, 0xA6, 0xF8, 0x6C, 0x4B, 0xBB, 0xB8, 0xC5, 0x49, 0xD9,
+    0x48, 0x23, 0x71, 0x83, 0xA3, 0x8B, 0x04, 0xE9, 0xBF, 0x4A, 0x7A, 0x43, 0x52, 0x7C, 0xF3, 0xB9,
+    0xB2, 0xD2, 0xBD, 0x9E, 0x2B, 0xD9, 0xC1, 0x65, 0x88, 0x3D, 0xB6, 0x80, 0x3F, 0x90, 0x35, 0xEF,
+    0x3C, 0x5D, 0xA1, 0xCD, 0xA0, 0xBB, 0x59, 0x9F, 0xF6, 0x91, 0x9F, 0x92, 0xD9, 0x6D, 0xD4, 0xD2,
+    0xD8, 0x28, 0x66, 0x37, 0xBB, 0xA5, 0x9D, 0x6C, 0x69, 0x27, 0xBB, 0xB4, 0xD9, 0xCD, 0x6E, 0xED,
+    0x26, 0x23, 0x0D, 0x48, 0x54, 0x52, 0x6A, 0x6E, 0xC7, 0xB9, 0x9D, 0xDA, 0xE2, 0x53, 0x53, 0x7C,
+    0x32, 0x6B, 0x48, 0xA6, 0xF8, 0xA9, 0x29, 0x7E, 0x8B, 0xB3, 0x93, 0xC6, 0x5A, 0x3B, 0x99, 0x00,
+    0x5C, 0xBE, 0x8D, 0x91, 0x06, 0x27, 0x4D, 0xDD, 0x1C, 0x66, 0x3F, 0xB9, 0xE2, 0xC7, 0xA6, 0xF8,
+    0x64, 0x57, 0x3F, 0x9A, 0xD5, 0x4F, 0x66, 0xED, 0x16, 0xB3, 0x3A, 0xA9, 0x18, 0xA9, 0x70, 0x59,
+    0xCB, 0x4E, 0x60, 0x98, 0xA8, 0x94, 0x68, 0xD4, 0x1F, 0x6B, 0xC5, 0x2B, 0xD3, 0xAA, 0xDF, 0xA5,
+    0xEB, 0xAE, 0xF0, 0x9E, 0x12, 0xFF, 0xCA, 0x16, 0x7E, 0xBE, 0x1E, 0x01, 0x76, 0x76, 0xC5, 0x15,
+    0xB7, 0xDC, 0xAF, 0x7F, 0xED, 0xDC, 0x14, 0x53, 0xCC, 0x62, 0xE7, 0x26, 0xBB, 0xE4, 0xFB, 0x4F,
+    0x9E, 0xBD, 0xF9, 0x0E, 0xC4, 0x44, 0x9C, 0x89, 0x37, 0x88, 0x13, 0x61, 0xC2, 0x6E, 0xD0, 0xDE,
+    0x7B, 0x17, 0x68, 0x07, 0xF8, 0xD8, 0x41, 0xE3, 0x04, 0x69, 0xDC, 0xEB, 0xD6, 0xD7, 0xAE, 0x3D,
+    0x7B, 0x28, 0x7C, 0xF8, 0xE4, 0xA4, 0xDF, 0xF5, 0x21, 0x7E, 0xA2, 0xD6, 0xE9, 0x3D, 0x52, 0xEF,
+    0x3C, 0xAF, 0x35, 0x1C, 0x6B, 0xB0, 0x1A, 0x8C, 0x06, 0xBA, 0x01, 0x86, 0xDD, 0x4A, 0xAE, 0x78,
+    0x25, 0xAF, 0xDC, 0xDD, 0x5C, 0x1E, 0xA8, 0x0A, 0xBC, 0x08, 0x9F, 0x82, 0xC0, 0xF1, 0x56, 0xC5,
+    0xD5, 0x6A, 0xB1, 0x1A, 0xED, 0x82, 0x99, 0x30, 0xA7, 0xC6, 0xB5, 0x5A, 0xB0, 0x2B, 0x76, 0xC3,
+    0x14, 0xB8, 0x67, 0x94, 0xE7, 0x75, 0x03, 0x68, 0xA5, 0x15, 0x8C, 0x24, 0x41, 0xB8, 0xCD, 0x79,
+    0x61, 0x36, 0xA8, 0x37, 0xFC, 0x08, 0x75, 0xA9, 0x57, 0x2E, 0x8F, 0x66, 0x71, 0x53, 0xAB, 0xA9,
+    0xC9, 0x91, 0x35, 0xA4, 0xF6, 0xFA, 0x62, 0x47, 0x8F, 0x7F, 0x7C, 0x7C, 0x90, 0x95, 0x35, 0xF4,
+    0xFC, 0xC1, 0x6C, 0xDE, 0x2E, 0xB4, 0x1A, 0xDD, 0xF7, 0xB2, 0xD9, 0x62, 0x1F, 0xBA, 0xD4, 0xA6,
+    0xD5, 0x2C, 0x91, 0x68, 0xE6, 0xEE, 0xA5, 0xB5, 0x56, 0xD4, 0x6A, 0x16, 0xA3, 0x37, 0x34, 0xBA,
+    0x6C, 0x96, 0xF3, 0x37, 0x68, 0x33, 0xB0, 0xCB, 0xF0, 0x41, 0x3E, 0x1B, 0x08, 0x5B, 0x7F, 0xBE,
+    0xEC, 0x6A, 0x77, 0x84, 0xF3, 0xBB, 0x5A, 0xA8, 0xAE, 0x7D, 0x6B, 0x1F, 0xC7, 0x55, 0x80, 0x90,
+    0x00, 0x23, 0xD8, 0x99, 0x0D, 0x2A, 0x80, 0xD1, 0x0C, 0x74, 0x61, 0x02, 0x4A, 0x4C, 0x60, 0x27,
+    0xF5, 0xE0, 0x2F, 0x08, 0xAA, 0xD2, 0x14, 0x70, 0x93, 0x9B, 0xC1, 0x7F, 0x23, 0x64, 0x6A, 0x49,
+    0x09, 0x27, 0x69, 0x20, 0x9C, 0xFC, 0x89, 0x30, 0x85, 0x66, 0xA5, 0x1D, 0x71, 0x4B, 0xA5, 0xAB,
+    0x84, 0xDB, 0x9D, 0xC6, 0x56, 0x45, 0xEA, 0x83, 0x32, 0x27, 0x97, 0xF0, 0xBB, 0x98, 0xAB, 0xBF,
+    0xFC, 0x56, 0xCC, 0xB6, 0x98, 0xB5, 0x12, 0x71, 0x08, 0xA9, 0x1B, 0xDB, 0xDC, 0x64, 0x5B, 0x4C,
+    0xA9, 0xA4, 0x42, 0x90, 0x86, 0x56, 0x5A, 0x6C, 0x31, 0xFA, 0xB4, 0xF0, 0x53, 0x48, 0x4D, 0x69,
+    0x73, 0xBD, 0xD9, 0x82, 0x9E, 0x10, 0x7A, 0x29, 0x4A, 0x7F, 0x2D, 0x69, 0x94, 0xD4, 0x1F, 0xA6,
+    0xE1, 0x4B, 0x57, 0xB1, 0x52, 0x72, 0xD2, 0xEC, 0xF4, 0xDC, 0xDA, 0xAC, 0xF8, 0xCF, 0xAE, 0xB8,
+    0xD7, 0x45, 0x9D, 0xD5, 0x73, 0x2E, 0xA4, 0x5D, 0x9D, 0x36, 0xE5, 0x30, 0x6E, 0xA5, 0x5D, 0x99,
+    0x36, 0x1B, 0x54, 0x1A, 0xC1, 0xAF, 0x60, 0x75, 0xFB, 0x5F, 0xE7, 0x28, 0x95, 0x46, 0x5A, 0xE9,
+    0xB4, 0xC2, 0xC3, 0x17, 0xE1, 0xE4, 0x04, 0xBC, 0xB4, 0xE1, 0x24, 0x2D, 0x5C, 0xBE, 0xFD, 0xBC,
+    0x92, 0x5D, 0x89, 0x4B, 0xA5, 0xDE, 0xAA, 0x0F, 0x23, 0x71, 0x6A, 0x67, 0x5C, 0xB1, 0x2B, 0x46,
+    0x95, 0x7A, 0xE2, 0x18, 0x46, 0xBA, 0xB9, 0x9D, 0x69, 0x8A, 0x5D, 0xA9, 0x55, 0xA9, 0x47, 0x29,
+    0x8C, 0xF8, 0xA9, 0x9D, 0xE9, 0xB2, 0x5D, 0x69, 0x97, 0x4A, 0xFD, 0xE5, 0xA5, 0x8A, 0xD2, 0x62,
+    0x24, 0xCD, 0x48, 0x1A, 0xEE, 0x11, 0x1F, 0x7F, 0x50, 0x36, 0xF3, 0x65, 0x69, 0xB5, 0x2B, 0xDD,
+    0xA7, 0xD5, 0xDB, 0x31, 0x8C, 0x4C, 0xED, 0x0C, 0x76, 0x85, 0x4A, 0xD7, 0x9E, 0x25, 0x48, 0x7D,
+    0x2B, 0x25, 0xBB, 0x9D, 0x5C, 0xAC, 0xD4, 0x43, 0x18, 0xA1, 0x9D, 0xF9, 0xA4, 0x5D, 0x69, 0x9F,
+    0x50, 0xEF, 0x7E, 0x14, 0xA5, 0x5B, 0x92, 0xD6, 0x7D, 0x79, 0x02, 0x92, 0x8A, 0xA4, 0x72, 0x5E,
+    0x2A, 0x76, 0xA5, 0xD8, 0x95, 0xEF, 0xDA, 0x95, 0xFF, 0x60, 0xD7, 0xBD, 0x5D, 0xBB, 0xD2, 0x5B,
+    0x29, 0x1F, 0xEE, 0xF1, 0x9E, 0xF2, 0xB3, 0xFB, 0xBC, 0xAE, 0x22, 0x65, 0xA4, 0x0C, 0x7C, 0xE9,
+    0x5B, 0xD0, 0x48, 0x13, 0x51, 0xCA, 0xB5, 0xEE, 0x3C, 0x9F, 0x9B, 0x8D, 0x26, 0xB7, 0x0B, 0x36,
+    0x77, 0x19, 0x33, 0xFA, 0x91, 0x6A, 0x5F, 0x76, 0xF1, 0x2C, 0x51, 0xAA, 0xAF, 0x3D, 0xAB, 0x64,
+    0x54, 0xE2, 0x58, 0xAB, 0xC4, 0x09, 0xB7, 0x84, 0x8C, 0x5B, 0x7C, 0xC1, 0x2D, 0xAD, 0x7A, 0xB7,
+    0x34, 0x07, 0x9F, 0x6A, 0x37, 0xE7, 0x3D, 0x9C, 0x1C, 0x66, 0xDC, 0x48, 0x49, 0x92, 0x36, 0x23,
+    0xFD, 0x85, 0x86, 0x4A, 0x93, 0x5D, 0xA9, 0xD4, 0xB7, 0x33, 0x76, 0x25, 0x8C, 0xB4, 0x73, 0xA5,
+    0x9E, 0x30, 0x1E, 0x8A, 0xEF, 0x5C, 0x7B, 0x7E, 0x25, 0x48, 0x9A, 0x2B, 0x49, 0x1A, 0xED, 0x76,
+    0xF2, 0xAF, 0x7E, 0xF5, 0xD7, 0x33, 0x76, 0xAD, 0xE2, 0x42, 0xD8, 0xBC, 0x8A, 0x93, 0xA4, 0xEC,
+    0x55, 0xC0, 0x48, 0xDF, 0x97, 0x8E, 0x35, 0xD8, 0x95, 0x76, 0x26, 0x8C, 0x95, 0xFA, 0x5F, 0x93,
+    0xAD, 0xE2, 0x6D, 0xAF, 0xB2, 0x73, 0x08, 0xAF, 0x62, 0xA5, 0x74, 0x5E, 0x57, 0x69, 0x33, 0x95,
+    0x78, 0x7F, 0x8F, 0x83, 0x0F, 0x61, 0x36, 0x88, 0x89, 0x6E, 0xA1, 0x15, 0x46, 0x89, 0x76, 0x3C,
+    0x5B, 0x2E, 0x8B, 0xD7, 0x1B, 0x5A, 0x9D, 0xF2, 0xE5, 0x19, 0x25, 0x5B, 0x88, 0xA9, 0x12, 0x71,
+    0x20, 0xA4, 0x38, 0xD0, 0xE6, 0x38, 0x60, 0x4B, 0x1C, 0xA8, 0xA4, 0x1E, 0x82, 0x26, 0x68, 0xB5,
+    0x82, 0x5D, 0x35, 0x52, 0xA9, 0x2D, 0x10, 0x5E, 0x52, 0xA2, 0xCD, 0x5D, 0xC1, 0x16, 0xA3, 0x54,
+    0x09, 0xBF, 0x56, 0xF1, 0x86, 0xD1, 0xEB, 0x52, 0x0A, 0x9B, 0x34, 0x19, 0xF5, 0x9C, 0x7A, 0x42,
+    0x5E, 0x05, 0xA7, 0x0D, 0x2E, 0x2F, 0xA7, 0x0B, 0xF2, 0xEE, 0xFA, 0xFB, 0xF5, 0x05, 0x7F, 0xD9,
+    0xCE, 0x7C, 0xCA, 0xAE, 0x74, 0xEF, 0xBE, 0x42, 0x81, 0x56, 0x13, 0x51, 0x7D, 0x50, 0x32, 0x5A,
+    0xE9, 0x84, 0xD3, 0x40, 0x58, 0x89, 0x2B, 0xB5, 0x16, 0xA3, 0x99, 0xE6, 0x66, 0x76, 0x37, 0x27,
+    0x7C, 0x18, 0xAF, 0xC4, 0x81, 0x35, 0x7C, 0xE5, 0x67, 0x1B, 0x26, 0xCB, 0xBD, 0x52, 0x70, 0xD7,
+    0xCB, 0x95, 0x36, 0xE3, 0x9B, 0xB7, 0x67, 0x9F, 0xAA, 0xE2, 0x6E, 0x26, 0x61, 0xB3, 0xDF, 0x4C,
+    0xA1, 0x4B, 0x71, 0x76, 0x33, 0x11, 0x25, 0x3F, 0x9A, 0xC5, 0x6C, 0xA8, 0x77, 0x93, 0x9D, 0xCD,
+    0x46, 0x18, 0x5D, 0x6A, 0x37, 0xA7, 0x7C, 0xCE, 0x48, 0x41, 0x09, 0xA7, 0x72, 0xCA, 0x5C, 0xAC,
+    0x8A, 0x57, 0x6A, 0x54, 0x1A, 0x4D, 0x55, 0x1C, 0x6B, 0xCD, 0xF8, 0xA1, 0x56, 0xC1, 0x0F, 0xB5,
+    0x36, 0xFC, 0x50, 0x4B, 0xBD, 0x1F, 0xEA, 0x55, 0xC9, 0x0F, 0x75, 0xD1, 0xE4, 0x87, 0xBA, 0xF8,
+    0xD9, 0x0F, 0x75, 0x69, 0x8B, 0x1F, 0xEA, 0xD2, 0xC8, 0x0F, 0x75, 0x31, 0x0A, 0x43, 0x5D, 0x2A,
+    0x69, 0xA8, 0x0B, 0x51, 0x43, 0x5D, 0xF0, 0x1A, 0xEA, 0x82, 0xD3, 0x60, 0xB7, 0xBE, 0xD1, 0xE0,
+    0x35, 0x19, 0x0D, 0x5E, 0x23, 0xBB, 0x3A, 0xB8, 0xB4, 0xEB, 0x37, 0xAC, 0x34, 0xD0, 0x48, 0x2B,
+    0x4E, 0xCF, 0x69, 0x6C, 0x56, 0xFC, 0xAE, 0x71, 0x9E, 0x14, 0x84, 0xAC, 0x1E, 0x57, 0xC2, 0x48,
+    0xAD, 0xCB, 0x19, 0xE2, 0x0F, 0x0B, 0x74, 0xB7, 0x04, 0x76, 0x55, 0xA2, 0xD6, 0xE5, 0x19, 0xE2,
+    0x2B, 0x1B, 0xF8, 0xAC, 0x84, 0x9B, 0xFD, 0x82, 0x2B, 0x56, 0x43, 0x53, 0x88, 0x8A, 0xEB, 0xDE,
+    0x30, 0x9D, 0x16, 0x0E, 0x42, 0x76, 0x72, 0x82, 0x97, 0x16, 0x27, 0x29, 0x5D, 0xBE, 0xA3, 0x62,
+    0x8B, 0x51, 0x25, 0xC2, 0x18, 0x92, 0x9B, 0xDB, 0x6C, 0x56, 0x5B, 0x2A, 0xED, 0x7E, 0xF2, 0xFF,
+    0x54, 0x6A, 0xA5, 0xD1, 0x4A, 0x43, 0xA5, 0x6F, 0xEF, 0xE6, 0xA5, 0xCD, 0x60, 0x0B, 0x54, 0x82,
+    0x2A, 0xFE, 0x0D, 0x46, 0x4A, 0x07, 0x65, 0xC1, 0x97, 0xAE, 0x42, 0x25, 0x4D, 0x10, 0xA5, 0x11,
+    0xBF, 0x3D, 0xAF, 0xBE, 0x59, 0xF1, 0xA5, 0x52, 0x8F, 0x26, 0x9F, 0xB1, 0x32, 0x2B, 0xF8, 0x1C,
+    0x46, 0x6A, 0x3D, 0x56, 0xA0, 0x9B, 0x63, 0xA2, 0xD6, 0xE3, 0x05, 0xDA, 0x59, 0x89, 0x5A, 0x8F,
+    0xAD, 0xD0, 0xE5, 0x38, 0x61, 0x64, 0x04, 0x7E, 0xF4, 0x0B, 0xAE, 0x54, 0xCA, 0x46, 0x34, 0x92,
+    0x46, 0x3A, 0x69, 0x86, 0x4E, 0x33, 0xFB, 0xFA, 0x83, 0x70, 0x03, 0x40, 0xB7, 0x2F, 0x42, 0x2D,
+    0x4D, 0x60, 0xB5, 0x02, 0xC7, 0x07, 0x6F, 0xFC, 0x54, 0xD3, 0x2F, 0x38, 0x49, 0x89, 0xCB, 0x77,
+    0xE2, 0x2E, 0x08, 0x7D, 0x25, 0xFC, 0x44, 0x48, 0x6E, 0xA1, 0xCD, 0x66, 0xC5, 0x96, 0x4A, 0x54,
+    0xAA, 0x35, 0x10, 0x6E, 0x6A, 0xA0, 0x95, 0x7A, 0xAC, 0xD4, 0x53, 0xA9, 0xCB, 0x10, 0xAE, 0x0B,
+    0xDA, 0xEC, 0x33, 0xB6, 0x34, 0x1B, 0x95, 0x88, 0xB9, 0x8A, 0x37, 0x9C, 0x2E, 0x48, 0x83, 0x16,
+    0x69, 0x6A, 0x56, 0x76, 0x39, 0x7A, 0xE4, 0xDB, 0x58, 0x69, 0x88, 0x92, 0xD5, 0xE7, 0x8B, 0x9F,
+    0x6C, 0x56, 0xEF, 0xAE, 0xAF, 0x7C, 0xD2, 0xAD, 0xE0, 0xB7, 0x9E, 0xA0, 0x91, 0xA8, 0x4C, 0xD0,
+    0x4C, 0xAB, 0x8C, 0xD5, 0x6B, 0x43, 0xA5, 0x6F, 0x0E, 0x66, 0x0B, 0xB8, 0xB7, 0x36, 0xC2, 0x2B,
+    0x7A, 0x6E, 0x6B, 0xA5, 0xA9, 0xD3, 0x4A, 0x75, 0x72, 0x8F, 0xF5, 0xD0, 0x3D, 0x49, 0xAF, 0xE1,
+    0x45, 0xCF, 0x21, 0x79, 0xE1, 0xF7, 0xD1, 0xF0, 0x45, 0xF6, 0x05, 0xF6, 0x7E, 0x92, 0x63, 0xDD,
+    0x00, 0xAF, 0xF5, 0x90, 0x00, 0x54, 0xD2, 0x18, 0x74, 0x4B, 0xAA, 0xA5, 0x3F, 0xD6, 0x58, 0x85,
+    0xC9, 0x08, 0x84, 0x2B, 0x98, 0x82, 0xCF, 0xB8, 0x8C, 0x12, 0x3E, 0xBD, 0x9F, 0xE2, 0x90, 0x6A,
+    0xF5, 0xF5, 0x86, 0x55, 0xDF, 0xCD, 0x87, 0xD9, 0x70, 0x52, 0x81, 0x66, 0x37, 0x92, 0x9F, 0x3B,
+    0xB5, 0xFC, 0x7B, 0xF7, 0xAF, 0x48, 0x95, 0x64, 0x35, 0x12, 0x26, 0x2B, 0x2A, 0xE1, 0x56, 0x9A,
+    0x99, 0x6E, 0xC1, 0x27, 0x7C, 0xAE, 0x36, 0x88, 0xA3, 0xCB, 0x54, 0x1A, 0x7C, 0xC2, 0xA8, 0x5A,
+    0xA1, 0x59, 0x5D, 0x06, 0xB7, 0xF8, 0x01, 0xBA, 0x9F, 0x15, 0x20, 0x7C, 0x3F, 0x03, 0x8A, 0x3D,
+    0xD4, 0x07, 0x97, 0x68, 0x02, 0x9A, 0xDD, 0x53, 0x5A, 0x00, 0xFC, 0xC8, 0x2F, 0x5C, 0x5E, 0xB3,
+    0x9D, 0x6B, 0x6D, 0x5E, 0xB9, 0x59, 0x6A, 0xAD, 0xAD, 0x06, 0x57, 0x08, 0xD9, 0x08, 0x57, 0xE8,
+    0x92, 0x51, 0xDF, 0xAE, 0xF8, 0x54, 0x69, 0xE8, 0x84, 0x1F, 0x50, 0xF2, 0x22, 0xF4, 0x28, 0x79,
+    0xF5, 0x11, 0xE2, 0x18, 0x34, 0x6C, 0xE0, 0xA7, 0x17, 0x62, 0x5A, 0xC1, 0xE7, 0xE2, 0x5F, 0x2A,
+    0xD0, 0xFD, 0xAC, 0xF8, 0xBF, 0x5A, 0xC0, 0xBD, 0xBD, 0x74, 0x3F, 0x9F, 0xC1, 0xBD, 0x93, 0xDD,
+    0xAD, 0x0C, 0x8D, 0xB2, 0xD3, 0x04, 0x46, 0x53, 0xA3, 0x11, 0x8C, 0x46, 0xA3, 0x04, 0xB5, 0x92,
+    0x39, 0xCC, 0x54, 0xBD, 0x03, 0x1F, 0x3D, 0xFA, 0x05, 0x62, 0x6B, 0xE9, 0xBA, 0x56, 0xAF, 0xC5,
+    0x2B, 0x85, 0x42, 0x18, 0xD1, 0xE8, 0x66, 0xAC, 0xEA, 0x15, 0xBA, 0x25, 0x0C, 0x10, 0xDF, 0xC8,
+    0x60, 0x54, 0xD8, 0xA3, 0x3D, 0x88, 0x19, 0x70, 0xEA, 0xA1, 0xD6, 0x0A, 0x84, 0x98, 0xC1, 0xFD,
+    0x48, 0x03, 0xA6, 0x34, 0x1B, 0xA8, 0xF7, 0x33, 0xDD, 0x54, 0x29, 0x35, 0x5B, 0xDF, 0xEA, 0x29,
+    0x6D, 0x4E, 0x8A, 0x1A, 0x0F, 0xD2, 0x4E, 0xAB, 0xD2, 0xE9, 0xA7, 0xDA, 0x1A, 0xCD, 0x61, 0xC5,
+    0x4F, 0x46, 0xB8, 0x4C, 0x98, 0x6C, 0xC6, 0x15, 0xB3, 0x80, 0x9E, 0x28, 0xD0, 0xE5, 0x15, 0xCC,
+    0x16, 0xD8, 0x63, 0x4B, 0xDC, 0x3E, 0x94, 0x74, 0x70, 0x6C, 0x71, 0xE5, 0xCC, 0x67, 0xBD, 0x5B,
+    0xD8, 0x6D, 0x3D, 0x04, 0x15, 0xE8, 0x76, 0x84, 0x01, 0xAC, 0xA4, 0x97, 0x24, 0xCD, 0x51, 0x5A,
+    0xBB, 0xA1, 0xD9, 0x9A, 0xD1, 0xAA, 0xCA, 0x46, 0x50, 0xAB, 0xA7, 0x52, 0xDA, 0x1B, 0xD0, 0x08,
+    0x71, 0xDA, 0xDB, 0xF1, 0x33, 0x74, 0x0B, 0x5F, 0x6C, 0x0B, 0xDE, 0x15, 0xDA, 0xEF, 0x6D, 0xB8,
+    0x9F, 0x4B, 0x5A, 0x24, 0xAD, 0xED, 0xA9, 0x51, 0xF2, 0xAB, 0xDF, 0xFC, 0xEA, 0xFB, 0xF7, 0xF1,
+    0xB3, 0xFA, 0xED, 0x13, 0xCF, 0xFA, 0x04, 0xA1, 0x07, 0x41, 0x5D, 0x76, 0x74, 0xA3, 0xC9, 0x7B,
+    0x8C, 0xFB, 0x1E, 0x5F, 0xAD, 0x77, 0x5F, 0xB9, 0xC3, 0xAB, 0x87, 0x09, 0x77, 0x74, 0x4B, 0x29,
+    0xD6, 0xA5, 0xC9, 0xDD, 0xDF, 0xF1, 0xD8, 0xF4, 0x8E, 0xFE, 0xD7, 0x35, 0x8E, 0xAF, 0xEE, 0x31,
+    0x77, 0x3B, 0x83, 0x2F, 0xFB, 0xFD, 0xC2, 0x15, 0x28, 0x9E, 0x6A, 0xF1, 0xBD, 0x99, 0xDB, 0x64,
+    0xB3, 0x1B, 0x9B, 0xA9, 0x99, 0xDC, 0x68, 0x73, 0x97, 0xCC, 0xD2, 0x0D, 0xF5, 0x72, 0xED, 0xDA,
+    0xB5, 0xFF, 0x26, 0xE9, 0xE6, 0x99, 0x7F, 0xFA, 0xE7, 0x26, 0xB7, 0x53, 0x37, 0xB5, 0xC9, 0x01,
+    0x1F, 0xBD, 0x48, 0xAD, 0x95, 0x56, 0xC2, 0xFF, 0x58, 0x83, 0x1F, 0x62, 0xEA, 0xFA, 0x90, 0x20,
+    0x24, 0x1E, 0x51, 0xB2, 0x52, 0xEA, 0xA4, 0x14, 0xC6, 0x90, 0xE2, 0x10, 0x92, 0x86, 0x98, 0xE2,
+    0x4F, 0xF5, 0x7F, 0x82, 0xB4, 0xB6, 0x5B, 0x3B, 0x57, 0x17, 0xAB, 0x9E, 0x23, 0xA8, 0x62, 0x06,
+    0x2F, 0xA8, 0x63, 0xDE, 0xAD, 0x06, 0xED, 0xDD, 0xCC, 0xE7, 0xA8, 0x14, 0x36, 0x5A, 0x69, 0xA9,
+    0x24, 0xA5, 0x76, 0x71, 0x6B, 0x25, 0xFC, 0xD4, 0x66, 0xA3, 0x4A, 0xF8, 0x7C, 0x9A, 0x99, 0xDA,
+    0x6C, 0xB6, 0x4A, 0xF8, 0xB1, 0xCD, 0x4D, 0xA9, 0xF5, 0x9C, 0xFA, 0x4E, 0x1A, 0x77, 0x73, 0xF3,
+    0xF0, 0x45, 0x38, 0xBA, 0x8A, 0xD3, 0x64, 0xA5, 0x27, 0xF4, 0xCD, 0xE2, 0x47, 0xFF, 0x4A, 0x31,
+    0x73, 0x1C, 0x1E, 0x72, 0x0B, 0x68, 0xC0, 0x2D, 0xA0, 0x44, 0xB3, 0x41, 0x58, 0x78, 0x52, 0x2A,
+    0x4E, 0x4A, 0x9D, 0x26, 0x1E, 0xBE, 0x08, 0x70, 0x71, 0x07, 0x15, 0x6B, 0xCD, 0x70, 0x5E, 0xFD,
+    0x1E, 0xEB, 0x73, 0x9A, 0xF9, 0x33, 0xF5, 0x95, 0x34, 0x13, 0xA5, 0xBE, 0xBD, 0x7D, 0x79, 0x36,
+    0x1B, 0xEA, 0x43, 0x72, 0x73, 0x53, 0x50, 0xAF, 0xC1, 0xCD, 0x6E, 0x39, 0xCD, 0x14, 0xD4, 0x2B,
+    0xB9, 0xB9, 0x51, 0xAD, 0xDE, 0x4B, 0xB7, 0x6B, 0x29, 0x96, 0x46, 0xD7, 0x95, 0x8E, 0xFA, 0x87,
+    0xE0, 0xF8, 0x22, 0xAD, 0xA6, 0x46, 0x7A, 0x42, 0x9F, 0x2F, 0x3E, 0xF9, 0x9F, 0x2C, 0xF5, 0x16,
+    0x87, 0xEE, 0xA6, 0xB4, 0x49, 0xBA, 0x79, 0xFB, 0xE4, 0x92, 0x7A, 0x9A, 0x02, 0x61, 0xE2, 0xC2,
+    0xBE, 0x4C, 0x53, 0xA7, 0x79, 0x87, 0x00, 0xBE, 0xD4, 0xD3, 0x68, 0xC6, 0xAB, 0x10, 0x7F, 0x50,
+    0x10, 0x73, 0x25, 0xCE, 0xD5, 0x7B, 0x4C, 0x4A, 0x27, 0x11, 0x25, 0xFE, 0xAD, 0xBE, 0x8D, 0xD9,
+    0xF8, 0xBB, 0x6F, 0xF5, 0x74, 0x5A, 0xF0, 0x5A, 0xE0, 0xE8, 0xEB, 0x1F, 0xED, 0x1B, 0xA9, 0xD4,
+    0x92, 0x52, 0x78, 0x55, 0x1F, 0x77, 0xB9, 0x99, 0x11, 0x61, 0x70, 0xD9, 0x2E, 0xA8, 0x57, 0x6F,
+    0x15, 0x33, 0x9D, 0xCA, 0xAE, 0x2F, 0x02, 0xFB, 0xAA, 0x45, 0x7A, 0xB3, 0x6F, 0xA4, 0x8D, 0x20,
+    0xE5, 0xF6, 0xCD, 0xE7, 0x74, 0xA1, 0xE0, 0xE6, 0x90, 0x2A, 0xD9, 0xED, 0xD3, 0x71, 0xF2, 0xD2,
+    0x82, 0xB4, 0x52, 0x3D, 0xFF, 0x0C, 0xF0, 0x10, 0x10, 0x67, 0x70, 0x7B, 0x14, 0xDB, 0xEF, 0xFE,
+    0xE3, 0x6E, 0xC8, 0x43, 0x82, 0x4A, 0xD5, 0x17, 0xB1, 0x25, 0x16, 0xDA, 0x43, 0xD8, 0x38, 0x57,
+    0x1A, 0xC3, 0x64, 0x57, 0x34, 0xB4, 0x07, 0x77, 0x6E, 0xA9, 0xD4, 0xFB, 0x5F, 0x55, 0x34, 0x4A,
+    0x4E, 0x3F, 0xD1, 0x12, 0x34, 0x70, 0x11, 0x3F, 0x59, 0x11, 0x72, 0x7D, 0x6A, 0xD6, 0xFA, 0x6E,
+    0xB3, 0x9A, 0xCE, 0x6F, 0xF8, 0xC9, 0xBC, 0x4B, 0x62, 0x75, 0x41, 0x9B, 0xD7, 0xC4, 0x11, 0xA6,
+    0x10, 0xA7, 0x66, 0xC5, 0x1F, 0xBC, 0x88, 0x4B, 0x56, 0x29, 0x96, 0x5A, 0xC9, 0x16, 0xC2, 0xAF,
+    0x4D, 0xE2, 0xD0, 0xCE, 0x56, 0x56, 0x29, 0xCC, 0xF5, 0x8D, 0xC3, 0x90, 0x33, 0x38, 0x25, 0x38,
+    0x2F, 0x76, 0x0F, 0x6A, 0x8F, 0xF2, 0xF7, 0x21, 0x03, 0xB6, 0x74, 0x4A, 0x6D, 0x0E, 0x22, 0xA4,
+    0x30, 0x56, 0x32, 0x05, 0x5B, 0x7C, 0xA2, 0xBD, 0x55, 0x20, 0x28, 0x53, 0x29, 0x8C, 0xD8, 0x12,
+    0x13, 0x6D, 0x56, 0x22, 0xBC, 0xA4, 0xA1, 0x52, 0xAD, 0xC1, 0xAE, 0x46, 0x83, 0x64, 0xF5, 0x94,
+    0x8A, 0xDD, 0x80, 0xAA, 0xE7, 0xA1, 0x5A, 0x63, 0x5C, 0x8F, 0x35, 0x9A, 0x15, 0xFF, 0x5E, 0x12,
+    0xBB, 0x59, 0xAD, 0x51, 0x23, 0x97, 0x8E, 0xAE, 0xF2, 0x45, 0x1A, 0xB5, 0xFA, 0x8C, 0x26, 0x2B,
+    0xE9, 0x96, 0x56, 0x9E, 0x97, 0x24, 0x25, 0xA3, 0x5E, 0x93, 0xCF, 0x68, 0xE8, 0xB2, 0x2D, 0xF8,
+    0xA9, 0x29, 0x95, 0x70, 0x4B, 0x2D, 0x42, 0x32, 0x1B, 0x31, 0xB5, 0xEF, 0xE5, 0xE5, 0x56, 0xAB,
+    0x78, 0x35, 0xCA, 0x92, 0xD3, 0x75, 0x15, 0x2E, 0x1D, 0x5D, 0xA5, 0x2B, 0x61, 0x25, 0x6C, 0x52,
+    0xFF, 0x8F, 0x25, 0x0D, 0x46, 0xBD, 0xF6, 0x5A, 0x66, 0xDB, 0xEB, 0xFF, 0xFA, 0x24, 0x8E, 0x9D,
+    0xAE, 0xAB, 0x78, 0x5D, 0x57, 0xE1, 0xE8, 0xEB, 0x54, 0xD2, 0x60, 0xA5, 0xA9, 0xBD, 0x1D, 0x67,
+    0x3F, 0xB9, 0x12, 0x52, 0x53, 0x62, 0xB2, 0xAB, 0x92, 0x5D, 0x35, 0x98, 0xFD, 0x99, 0x6C, 0x89,
+    0xA9, 0x29, 0x21, 0xBB, 0xD9, 0x6F, 0x31, 0x3B, 0x29, 0xD5, 0x5A, 0xE1, 0xE1, 0x1E, 0x2E, 0x1D,
+    0xF7, 0x46, 0x5F, 0x53, 0x8A, 0x92, 0x8E, 0x25, 0xCD, 0x76, 0xAB, 0x35, 0x84, 0xE4, 0x8A, 0x2D,
+    0xC4, 0x14, 0x52, 0x73, 0x7F, 0x66, 0x08, 0xC9, 0xCD, 0xB6, 0xD4, 0x22, 0xDC, 0xD1, 0x68, 0xA5,
+    0x85, 0xA0, 0x15, 0xBB, 0x5E, 0xDA, 0xE7, 0xD8, 0x96, 0xC3, 0x64, 0xB7, 0x1A, 0xB0, 0xDA, 0xE0,
+    0x13, 0xD7, 0xAE, 0x02, 0xC7, 0x97, 0x20, 0x68, 0x25, 0x4A, 0x7D, 0x78, 0x3B, 0x8E, 0x7E, 0xDA,
+    0xBD, 0xF0, 0xA6, 0xA0, 0x0B, 0x1B, 0x7E, 0xD4, 0xE0, 0x66, 0x3F, 0x99, 0xD5, 0x15, 0xF4, 0x19,
+    0xE1, 0xC7, 0x90, 0xC3, 0xEC, 0xA4, 0xB5, 0x92, 0xD4, 0xB7, 0x9B, 0x1F, 0x39, 0xE7, 0x66, 0x30,
+    0xEB, 0x41, 0x61, 0xF9, 0x11, 0xC2, 0x06, 0x51, 0x89, 0x47, 0xAE, 0x3D, 0xCD, 0xA5, 0xE3, 0xCF,
+    0xE8, 0xA9, 0x12, 0x8A, 0x5E, 0x8E, 0x2A, 0x46, 0x6F, 0x0E, 0x7E, 0x0F, 0x37, 0xFD, 0xF4, 0x2E,
+    0x8F, 0x30, 0xE3, 0x35, 0x1B, 0xA9, 0xE7, 0x91, 0x8B, 0x48, 0x83, 0x94, 0x55, 0x15, 0x9F, 0x3A,
+    0x37, 0x1F, 0x5F, 0xD0, 0x44, 0xD4, 0xD0, 0x68, 0x25, 0x28, 0x11, 0xDF, 0xCA, 0x66, 0x7D, 0x91,
+    0x78, 0x79, 0x0A, 0xAF, 0x48, 0x63, 0xD4, 0xC0, 0x09, 0x10, 0xC0, 0x27, 0xDA, 0x8C, 0x2D, 0x9C,
+    0x97, 0x1E, 0x97, 0x5E, 0x8B, 0x77, 0x9E, 0x6E, 0x0A, 0xB5, 0xF6, 0x18, 0x37, 0x73, 0xFF, 0x1F,
+    0x6B, 0x55, 0x49, 0xC9, 0x6B, 0xB2, 0x9A, 0x78, 0x78, 0x77, 0x00, 0xBB, 0xD2, 0xA8, 0x8F, 0xA5,
+    0x55, 0x7F, 0xB9, 0x1C, 0xAB, 0xB7, 0x85, 0xF7, 0x96, 0x6C, 0xB5, 0x7A, 0x23, 0xE9, 0x6A, 0x2D,
+    0xA9, 0x10, 0x4B, 0x58, 0x38, 0xEA, 0x1F, 0x3A, 0x75, 0x29, 0x2F, 0xE8, 0xAF, 0x55, 0x9C, 0x2E,
+    0x68, 0x70, 0xD9, 0x6C, 0xF8, 0xC1, 0x95, 0xAA, 0xD0, 0xCE, 0x2E, 0xE3, 0x27, 0xDF, 0x13, 0x5F,
+    0x2E, 0x20, 0x37, 0x52, 0x6F, 0x01, 0xCC, 0xB6, 0x1C, 0x84, 0xB6, 0xDD, 0x4E, 0x3D, 0x93, 0x30,
+    0xDC, 0x07, 0x85, 0xAA, 0x34, 0xA3, 0x97, 0xD7, 0xB0, 0x19, 0x8D, 0x4A, 0x2E, 0xDB, 0xD9, 0x96,
+    0x5A, 0x7D, 0xC4, 0x8F, 0x7E, 0x71, 0x53, 0xBD, 0x19, 0xA5, 0x42, 0x9B, 0xAF, 0x94, 0x36, 0x21,
+    0xF7, 0xCD, 0xD7, 0x66, 0x9A, 0x79, 0xDE, 0x3C, 0xF8, 0x6F, 0x36, 0x3F, 0x9F, 0x30, 0x5B, 0x0E,
+    0x2F, 0x40, 0xBB, 0x99, 0xDD, 0x81, 0xF1, 0x0B, 0xB8, 0x52, 0x09, 0x08, 0x83, 0xCB, 0xF7, 0x76,
+    0x66, 0xB4, 0x84, 0xD5, 0xEB, 0x33, 0x1A, 0xC2, 0xD4, 0x8D, 0x95, 0x2E, 0xCC, 0xD8, 0xB2, 0x42,
+    0xA7, 0x61, 0xD7, 0x2F, 0xFB, 0x12, 0x98, 0xC1, 0x2B, 0xD1, 0xFC, 0x4C, 0xD4, 0xAB, 0x2B, 0xC4,
+    0xC1, 0x67, 0xBF, 0x39, 0xFD, 0x54, 0x3F, 0xDA, 0x7D, 0xA9, 0x4A, 0xFA, 0xAC, 0x7E, 0x72, 0xC6,
+    0x07, 0xFB, 0x2E, 0x7C, 0x08, 0xF7, 0xF3, 0x41, 0x0B, 0x34, 0xBF, 0xCC, 0x87, 0x6A, 0x3D, 0x80,
+    0xFD, 0x95, 0xE0, 0x91, 0x38, 0x43, 0xD4, 0x40, 0xA5, 0x19, 0xEA, 0xDB, 0x67, 0x80, 0xBD, 0xF4,
+    0x84, 0xA4, 0xE6, 0x4E, 0x5C, 0x3A, 0x94, 0xBE, 0xE3, 0x0A, 0x7D, 0x1C, 0xB1, 0x2B, 0x84, 0x09,
+    0x23, 0xF0, 0xF9, 0xC1, 0x5A, 0xFD, 0x97, 0xDB, 0xC5, 0x64, 0xBD, 0x19, 0xAF, 0xEF, 0xFB, 0xA1,
+    0xCB, 0xA9, 0x63, 0xBB, 0xA1, 0xEC, 0xFF, 0xC6, 0x2E, 0x04, 0x6C, 0x26, 0xF4, 0x66, 0xC6, 0x0F,
+    0x66, 0xC1, 0x27, 0x53, 0x50, 0xEF, 0x47, 0x73, 0xD8, 0x31, 0x33, 0xE5, 0xF0, 0xA2, 0xB7, 0xF9,
+    0xF0, 0xF1, 0x60, 0x34, 0x39, 0x71, 0x7E, 0xC4, 0xBD, 0x3E, 0xAF, 0xFE, 0xF1, 0x5F, 0x99, 0xBC,
+    0x7A, 0x11, 0xCC, 0x46, 0x28, 0x75, 0x9C, 0x10, 0x4D, 0x3E, 0xDB, 0xB9, 0x9B, 0x58, 0x71, 0x23,
+    0x1B, 0x6E, 0xD9, 0x4D, 0x84, 0xFA, 0xBD, 0xEC, 0xB0, 0x1F, 0x17, 0xF7, 0x8F, 0x5D, 0xF6, 0xAB,
+    0xD5, 0xD0, 0x0D, 0x54, 0x3D, 0x95, 0x86, 0x47, 0xBD, 0x3E, 0xAB, 0x77, 0xB4, 0x95, 0x46, 0x2F,
+    0x0F, 0xE7, 0x77, 0x1C, 0xF7, 0x23, 0xFC, 0x13, 0x02, 0x6B, 0xBD, 0xDA, 0xA5, 0x99, 0xDB, 0xEC,
+    0xA7, 0x98, 0x7C, 0x52, 0xEF, 0xA7, 0x98, 0xDC, 0xDC, 0x4D, 0x66, 0x6D, 0x16, 0x62, 0xB5, 0xD2,
+    0xF2, 0x49, 0x80, 0x7F, 0xCE, 0x7F, 0x27, 0xF6, 0x1B, 0xDD, 0x18, 0x06, 0xB7, 0x74, 0xD9, 0x6C,
+    0x4D, 0xA9, 0x64, 0x8A, 0xD9, 0x9A, 0xD2, 0x2C, 0x6D, 0xEE, 0x46, 0x3F, 0x84, 0x7E, 0xE3, 0xCB,
+    0xCC, 0xF7, 0xAE, 0x92, 0x8F, 0xEC, 0x5C, 0xDF, 0x83, 0x82, 0x1E, 0x30, 0x4A, 0x1C, 0x00, 0x1A,
+    0xF8, 0xC3, 0xBB, 0x1F, 0xFE, 0xAE, 0x20, 0xE3, 0xD3, 0x6B, 0x04, 0x68, 0xEF, 0x76, 0x1F, 0x16,
+    0xC0, 0x6C, 0x3D, 0x70, 0xC4, 0xFF, 0x07, 0x64, 0xB6, 0x03, 0x50, 0x69, 0xE0, 0xA0, 0x03, 0x28,
+    0x7E, 0x00, 0x37, 0x7A, 0xE0, 0xE3, 0x7C, 0xEC, 0x2E, 0x85, 0x5F, 0xE4, 0xD4, 0x98, 0xEF, 0x11,
+    0x8C, 0xD5, 0xB0, 0x43, 0x4B, 0x80, 0x56, 0xA0, 0x79, 0x63, 0x01, 0x7C, 0x97, 0xA1, 0x5A, 0xFC,
+    0x08, 0x6E, 0x54, 0x82, 0x50, 0x0B, 0xCC, 0x62, 0x56, 0x70, 0x3F, 0xFE, 0x42, 0x81, 0x28, 0x65,
+    0x8C, 0xA4, 0x89, 0xF6, 0x7F, 0x9C, 0x28, 0x21, 0x6A, 0xF5, 0x76, 0xC6, 0x6C, 0x84, 0x1B, 0xB4,
+    0xDB, 0x63, 0x9A, 0xAD, 0xE4, 0x35, 0xB6, 0x2A, 0x1C, 0x0F, 0xFF, 0x06, 0x08, 0x4F, 0x16, 0xA8,
+    0xD5, 0x66, 0xB0, 0x8B, 0x4F, 0x50, 0xF1, 0xD0, 0x5D, 0xD2, 0xFE, 0x88, 0x53, 0x67, 0x63, 0x97,
+    0xDA, 0x4A, 0xD3, 0xD9, 0x70, 0xBC, 0x7A, 0xA8, 0x6F, 0x6D, 0x80, 0xFB, 0x5E, 0x01, 0xAE, 0xB8,
+    0x19, 0xCC, 0xEC, 0x33, 0xB4, 0x29, 0x26, 0xD8, 0x50, 0x8F, 0xB9, 0xFD, 0x27, 0x82, 0x4E, 0x2A,
+    0x20, 0x69, 0xC1, 0xBE, 0x75, 0x12, 0x32, 0x3E, 0x11, 0xC7, 0x6A, 0x05, 0x0D, 0xED, 0x6D, 0xAC,
+    0xFE, 0xB3, 0xD6, 0x4A, 0xFA, 0xBE, 0x66, 0x2B, 0x7D, 0xD8, 0xC0, 0xFD, 0xF1, 0xB0, 0x57, 0x24,
+    0x0E, 0xD0, 0x8C, 0x60, 0xF3, 0x1E, 0x44, 0xED, 0x6B, 0x05, 0xF8, 0x7B, 0x07, 0xDF, 0xD4, 0xE8,
+    0xE0, 0x6D, 0xD6, 0xDA, 0x1D, 0xA3, 0x0F, 0x1F, 0x84, 0x87, 0x2A, 0xED, 0x3B, 0xEC, 0x56, 0x7B,
+    0x50, 0x61, 0x36, 0xE0, 0xEA, 0x87, 0xBE, 0x01, 0x50, 0xCF, 0xBB, 0xC4, 0xD7, 0x9A, 0xA9, 0x4A,
+    0xE8, 0xEB, 0x62, 0x27, 0x3E, 0xCE, 0x9F, 0x9E, 0xF5, 0x2B, 0x49, 0x41, 0xD2, 0xAB, 0x51, 0x9A,
+    0xDB, 0x99, 0x17, 0xEC, 0x4A, 0xFB, 0x69, 0xF5, 0x66, 0x38, 0x43, 0x72, 0xB7, 0x6B, 0x4F, 0x57,
+    0xD2, 0x4A, 0x90, 0x68, 0x6F, 0x9F, 0xF4, 0xF7, 0x42, 0xBB, 0x73, 0x3B, 0x73, 0xC5, 0xAE, 0xF8,
+    0xBF, 0x38, 0xD0, 0x7F, 0x4B, 0x52, 0xE1, 0x99, 0xE3, 0x01, 0x3D, 0xB6, 0xE0, 0x5F, 0x13, 0x4D,
+    0x0E, 0x3D, 0x17, 0xAB, 0x7B, 0x2C, 0xD6, 0x81, 0xBA, 0x3F, 0x96, 0x34, 0x86, 0xB1, 0x9E, 0xDB,
+    0x99, 0xFF, 0x64, 0x57, 0x3E, 0x72, 0x77, 0x40, 0x77, 0xAE, 0x0D, 0x76, 0x87, 0xEF, 0x0B, 0xE1,
+    0xC7, 0x27, 0xF7, 0x22, 0xCA, 0x66, 0x0C, 0x63, 0xB5, 0xB4, 0x33, 0xDB, 0xF9, 0x03, 0xE9, 0x6F,
+    0x68, 0x07, 0x1F, 0x9E, 0xC6, 0xCC, 0xB4, 0x0B, 0xBE, 0x70, 0x7E, 0x39, 0x9D, 0xF6, 0xDF, 0x04,
+    0xC5, 0x7F, 0x90, 0x6A, 0xA5, 0x9B, 0x8D, 0x52, 0x37, 0xF3, 0x8F, 0xF8, 0xCD, 0xDA, 0x0B, 0xA0,
+    0x64, 0x94, 0xDD, 0x6B, 0xC5, 0x0F, 0x2F, 0xFC, 0xD1, 0x69, 0x7B, 0x5E, 0xC5, 0xAB, 0x1C, 0x6B,
+    0xA8, 0xD4, 0xBF, 0xC7, 0xDF, 0x63, 0xDD, 0xD8, 0x6B, 0x3D, 0xD2, 0x3F, 0xE3, 0xAF, 0xAF, 0xE1,
+    0xFA, 0xEA, 0x5F, 0x2E, 0x0F, 0x9C, 0x6E, 0x54, 0xFE, 0x26, 0x0D, 0xC2, 0xB9, 0xDD, 0xBC, 0x3A,
+    0xC0, 0xEA, 0x79, 0xC0, 0xDE, 0x14, 0x60, 0x9E, 0x5C, 0x79, 0x97, 0xEB, 0x77, 0x8D, 0x94, 0x9F,
+    0x0A, 0x16, 0x6C, 0x67, 0xDA, 0x6C, 0x3F, 0x06, 0x74, 0x39, 0x73, 0x08, 0x2B, 0xCF, 0xF6, 0x0C,
+    0x7F, 0xDB, 0x98, 0xFA, 0xE1, 0xFA, 0xFB, 0x00, 0x7E, 0x00, 0xC2, 0x74, 0xD0, 0x3B, 0x7B, 0xEE,
+    0xF7, 0xF9, 0x9D, 0x52, 0xE7, 0x61, 0xC7, 0xC2, 0xE8, 0xD4, 0x43, 0xF7, 0x54, 0x86, 0x6E, 0xB8,
+    0x02, 0xF5, 0x70, 0x66, 0x69, 0xAB, 0x6B, 0x3D, 0xB4, 0xDA, 0x51, 0x84, 0x79, 0xC7, 0xEE, 0xBB,
+    0x19, 0xE5, 0x76, 0xC6, 0x6D, 0xAE, 0x50, 0xE9, 0xFA, 0x0A, 0xFE, 0x67, 0xEA, 0x69, 0xD6, 0x98,
+    0x4E, 0xA9, 0x7B, 0xA3, 0x40, 0x7B, 0x4B, 0xD0, 0xAC, 0x71, 0xA4, 0x56, 0xBB, 0x80, 0xAE, 0x0B,
+    0xFC, 0xA8, 0x09, 0x9F, 0xDB, 0x8D, 0x2E, 0xD7, 0xDA, 0xF6, 0x9D, 0xBE, 0x19, 0xA2, 0x26, 0x0E,
+    0x70, 0xF6, 0x83, 0xFD, 0xB3, 0xE0, 0xE6, 0x38, 0x60, 0x56, 0x3F, 0x81, 0xEC, 0x0C, 0x47, 0xFB,
+    0xC2, 0x04, 0x38, 0xFE, 0x36, 0x10, 0xB4, 0x1C, 0xF6, 0x13, 0x74, 0x27, 0xAE, 0xC4, 0xD1, 0xEC,
+    0x1B, 0xAE, 0x8B, 0xCF, 0x58, 0xB9, 0x19, 0xF4, 0xCA, 0x0A, 0xDD, 0xDB, 0x3B, 0x0D, 0x89, 0x5A,
+    0x21, 0x43, 0x78, 0xA3, 0x40, 0xF7, 0xB6, 0x7A, 0x9A, 0x12, 0x26, 0x8C, 0x5C, 0x01, 0x5D, 0xD0,
+    0x80, 0x52, 0x58, 0x88, 0xA9, 0xD1, 0x3B, 0x1A, 0xF7, 0x86, 0x6B, 0x69, 0x80, 0xA3, 0xBB, 0x67,
+    0xDF, 0x4C, 0x0F, 0xD0, 0x0D, 0x00, 0x71, 0x3C, 0xB3, 0x9B, 0x7B, 0x9E, 0xE3, 0xFB, 0x04, 0xE3,
+    0x77, 0x8C, 0x93, 0x03, 0xFC, 0x33, 0xD8, 0xED, 0xDF, 0xC1, 0x01, 0x39, 0x78, 0x48, 0x57, 0xEF,
+    0x37, 0x79, 0xBF, 0x6B, 0x62, 0x9B, 0x89, 0x53, 0x79, 0xB0, 0x9A, 0x80, 0xE0, 0x26, 0xB0, 0xD9,
+    0x25, 0x78, 0x90, 0xDF, 0xBB, 0x8F, 0xCE, 0xA0, 0xB9, 0xD5, 0x2A, 0xA5, 0xA8, 0x57, 0xE3, 0xCC,
+    0x17, 0x96, 0xF7, 0x4F, 0xD5, 0x2F, 0x15, 0xB7, 0x99, 0x38, 0x12, 0x87, 0x4A, 0x63, 0xB3, 0x62,
+    0x74, 0xEA, 0x6C, 0x9D, 0xEE, 0x19, 0xF1, 0xD1, 0x8B, 0x40, 0xFD, 0xF4, 0x23, 0x40, 0xF7, 0x23,
+    0x01, 0x7A, 0xAA, 0x40, 0xB5, 0xBA, 0x09, 0xE8, 0x1F, 0xB8, 0x8F, 0xC0, 0x56, 0xAB, 0x95, 0x82,
+    0x72, 0xA7, 0xF9, 0xF2, 0xCA, 0x1F, 0x6C, 0xFF, 0xAF, 0xCC, 0xBB, 0xA7, 0xD8, 0x16, 0xBA, 0x99,
+    0x6E, 0x22, 0xCC, 0xB5, 0x7A, 0x74, 0xEA, 0x72, 0x25, 0x88, 0x5A, 0x80, 0xA3, 0xAF, 0x1F, 0x66,
+    0x71, 0x04, 0x93, 0xC1, 0x14, 0xA8, 0x36, 0x76, 0x3C, 0xB9, 0xE9, 0xE1, 0xD4, 0xF2, 0x7E, 0x10,
+    0xD8, 0x2D, 0x87, 0x13, 0x38, 0x26, 0xDF, 0x05, 0xA8, 0xBB, 0x01, 0xFE, 0x21, 0xF0, 0xC0, 0x07,
+    0xD8, 0xCF, 0x11, 0x07, 0x4C, 0x3C, 0xC3, 0xB6, 0x60, 0xF2, 0x8A, 0x1D, 0x3F, 0x45, 0x7D, 0x08,
+    0xDA, 0x3F, 0xA8, 0xB1, 0x34, 0xD3, 0x8B, 0xB4, 0x59, 0xB4, 0x59, 0x34, 0xC3, 0x7F, 0xBC, 0x3B,
+    0x93, 0x1F, 0xC8, 0x18, 0x7E, 0x03, 0xEC, 0xF9, 0x19, 0xF0, 0x99, 0x2A, 0xEE, 0x9C, 0x7E, 0x71,
+    0x3F, 0x75, 0xB9, 0x3B, 0x34, 0xCD, 0xE1, 0xA4, 0xE6, 0x78, 0xB6, 0x91, 0x60, 0xD3, 0x19, 0xDD,
+    0x7F, 0x46, 0xA5, 0x8D, 0xA8, 0xA5, 0x7D, 0x2B, 0x5E, 0x2F, 0x66, 0x0B, 0x43, 0xF7, 0xD3, 0xA5,
+    0xDE, 0x76, 0x40, 0x7F, 0xD3, 0x37, 0x4E, 0x1E, 0xDF, 0x4F, 0xAB, 0xD9, 0x8D, 0x07, 0xBC, 0xF4,
+    0xEA, 0x0E, 0xED, 0xF6, 0x1C, 0x36, 0x12, 0xDD, 0xDE, 0xB6, 0x1F, 0x68, 0x32, 0x14, 0x70, 0x7C,
+    0x10, 0x4D, 0x57, 0x3D, 0xD5, 0x06, 0x7E, 0xA6, 0xB9, 0x99, 0xAA, 0xE5, 0x0A, 0xBE, 0xCE, 0xD5,
+    0xB0, 0x0B, 0xF7, 0x6F, 0x84, 0x7C, 0x43, 0xB0, 0xD9, 0xCD, 0x1A, 0xF4, 0xD8, 0x5C, 0x8F, 0x8F,
+    0x7E, 0x30, 0x6C, 0x98, 0xE8, 0x86, 0xFD, 0x30, 0x6E, 0x97, 0xF8, 0xF2, 0xFB, 0x04, 0x88, 0x81,
+    0x4C, 0x37, 0x98, 0x85, 0x88, 0x4B, 0xE4, 0xF7, 0x59, 0xFD, 0x21, 0xEC, 0x8C, 0x9F, 0xEB, 0x77,
+    0x72, 0xFB, 0xD4, 0x54, 0x9A, 0x97, 0x76, 0x26, 0x3D, 0x44, 0x5C, 0xAC, 0xA6, 0x63, 0x0D, 0xE6,
+    0x00, 0x39, 0xF0, 0x8B, 0xD9, 0x76, 0x35, 0xDA, 0x9C, 0x16, 0xA8, 0x4A, 0xFB, 0xFD, 0x59, 0xE1,
+    0xF5, 0xF5, 0xDF, 0xD5, 0x87, 0xF3, 0x6C, 0x47, 0x74, 0x5B, 0xA5, 0xA5, 0x8A, 0xBF, 0x5C, 0xED,
+    0x34, 0x6B, 0xD5, 0x4B, 0x4F, 0x6A, 0x83, 0xE3, 0xF1, 0x63, 0xD0, 0x2E, 0xDF, 0x81, 0x4E, 0x05,
+    0x1E, 0xED, 0x66, 0xF8, 0xBD, 0xE3, 0xAB, 0xF7, 0xAA, 0xB9, 0x0F, 0x1A, 0x99, 0x05, 0xF8, 0x73,
+    0xA0, 0x1C, 0x4E, 0x8A, 0xC6, 0x01, 0xDA, 0x11, 0xCC, 0x3D, 0xBB, 0xAF, 0x1F, 0x04, 0x7A, 0x0B,
+    0xC0, 0xBF, 0xDF, 0x3B, 0xAA, 0x0B, 0x98, 0x79, 0xB7, 0x3F, 0xCD, 0xF0, 0xC1, 0xF6, 0x53, 0x0D,
+    0x3B, 0x00, 0xD6, 0x15, 0xF0, 0x1B, 0x14, 0x4F, 0x3D, 0xBB, 0x81, 0xAB, 0x47, 0x1F, 0xE8, 0x58,
+    0xCC, 0xDC, 0x0D, 0x76, 0x3F, 0xCC, 0x9A, 0xEA, 0xE9, 0xD1, 0x0F, 0x81, 0x57, 0xCD, 0x99, 0xC3,
+    0xD3, 0x8D, 0xA7, 0x27, 0x78, 0xEB, 0xC2, 0xFE, 0x0F, 0x02, 0xBF, 0x70, 0x7D, 0x18, 0xD8, 0x2C,
+    0x07, 0x05, 0xD4, 0x0E, 0xA7, 0x2E, 0x74, 0xE4, 0xB0, 0x4E, 0xC8, 0xBF, 0x05, 0x0A, 0x1E, 0xE2,
+    0x60, 0x4A, 0x8D, 0x7A, 0x68, 0x6E, 0x26, 0x68, 0x9F, 0xCA, 0xE0, 0xEB, 0x0C, 0x7F, 0x78, 0x6F,
+    0xF4, 0xFE, 0x21, 0x0D, 0x3F, 0x98, 0x0C, 0x7A, 0x6C, 0x39, 0x24, 0x8F, 0xD6, 0xD3, 0x6F, 0x89,
+    0xED, 0x1C, 0x4B, 0xD2, 0x4C, 0x90, 0xA4, 0xB9, 0xD6, 0x9D, 0x28, 0xCD, 0xCD, 0x86, 0xCF, 0xF5,
+    0xEC, 0x16, 0x7C, 0xAE, 0xB2, 0xCF, 0xF8, 0xCC, 0x55, 0x3F, 0xE2, 0x33, 0x84, 0x84, 0xCF, 0x10,
+    0x13, 0xFE, 0xCE, 0xB5, 0x3E, 0x26, 0xBC, 0x34, 0x28, 0xE1, 0xA5, 0x3E, 0x26, 0xFC, 0x5B, 0x27,
+    0xC4, 0xFD, 0x93, 0x30, 0xE2, 0x33, 0xE7, 0xF6, 0xEA, 0xDF, 0xED, 0x16, 0x7C, 0xA6, 0xB8, 0x0D,
+    0x9F, 0xEB, 0x62, 0x74, 0x27, 0x4A, 0xFB, 0x7F, 0xC7, 0x68, 0xE1, 0xFC, 0x4E, 0xC4, 0x41, 0xD7,
+    0x1F, 0x5D, 0xE5, 0x73, 0x3D, 0x41, 0x4F, 0x68, 0x25, 0x68, 0x93, 0x52, 0xF8, 0xDF, 0xDA, 0xBE,
+    0x50, 0xFC, 0xE4, 0x36, 0xD4, 0xE6, 0x5A, 0xF8, 0x1F, 0x16, 0x42, 0x72, 0xB7, 0x44, 0x2B, 0xAD,
+    0x1A, 0x8C, 0x24, 0x9F, 0x2B, 0x9D, 0x9C, 0x3C, 0x5E, 0x08, 0x89, 0x5A, 0x74, 0x33, 0x84, 0xEC,
+    0xD4, 0x57, 0x4E, 0xCF, 0x4B, 0x4A, 0xD2, 0x2D, 0x29, 0x37, 0xCA, 0xDD, 0xBE, 0xD1, 0x70, 0x02,
+    0x07, 0x18, 0xE3, 0xA6, 0xA4, 0x5E, 0xEF, 0x76, 0x95, 0x8A, 0xD2, 0x3D, 0x99, 0x83, 0x9B, 0xE4,
+    0xE6, 0xF0, 0x44, 0x5F, 0xF5, 0xE1, 0xD3, 0x32, 0xA5, 0xC9, 0xDD, 0x50, 0xEC, 0xE4, 0x39, 0x47,
+    0xC5, 0x39, 0x97, 0x4A, 0xF7, 0x95, 0xD9, 0x9B, 0x1C, 0x9A, 0x69, 0x73, 0x93, 0x5C, 0xD6, 0xE3,
+    0x73, 0xF8, 0xEA, 0xFC, 0x50, 0xD5, 0x57, 0xFD, 0xB9, 0xF6, 0xB5, 0xB5, 0xFD, 0xDB, 0xCD, 0x65,
+    0x35, 0x79, 0x6B, 0xA6, 0xD5, 0xA5, 0xD2, 0x7E, 0x65, 0xF6, 0x66, 0x7A, 0xE0, 0xD4, 0x39, 0x77,
+    0x53, 0xB5, 0xD2, 0x7D, 0x6F, 0x45, 0xA9, 0xBD, 0xA3, 0xDE, 0x67, 0xBB, 0x85, 0xE4, 0x16, 0xF4,
+    0x2F, 0x7B, 0x2E, 0x71, 0xC4, 0xFF, 0x05, 0xBD, 0x98, 0x3F, 0x8C, 0x27, 0xB7, 0x75, 0xC7, 0xBF,
+    0x33, 0xF4, 0x2D, 0x61, 0x0C, 0x10, 0xAA, 0x90, 0x0C, 0x44, 0x87, 0x78, 0x7A, 0x03, 0xC9, 0xF4,
+    0x01, 0x02, 0x8E, 0x74, 0x80, 0x5D, 0x5C, 0xE1, 0x2B, 0xB4, 0x36, 0x60, 0x17, 0x6E, 0x92, 0xC6,
+    0xCD, 0xB6, 0x69, 0x22, 0x8E, 0x24, 0x20, 0x2E, 0x5C, 0x68, 0x0B, 0xDB, 0x29, 0x52, 0xC4, 0x85,
+    0x80, 0xC4, 0x77, 0xC5, 0xB5, 0x29, 0x24, 0x93, 0xA7, 0x2B, 0x54, 0xDE, 0x28, 0x82, 0xA3, 0xC2,
+    0x85, 0xC6, 0x90, 0x1C, 0xDB, 0x52, 0x71, 0x14, 0x3C, 0xB2, 0x67, 0x57, 0x1C, 0x7E, 0x52, 0xFC,
+    0x76, 0xF7, 0xEE, 0xFC, 0x2F, 0xB1, 0x11, 0x64, 0x8A, 0xF7, 0xF8, 0xE3, 0xCC, 0xEF, 0x91, 0x7C,
+    0x7C, 0xFC, 0xBE, 0xEF, 0xA3, 0x5E, 0x3B, 0x9A, 0xC4, 0xCD, 0x4D, 0xFE, 0x3F, 0x50, 0x97, 0xC3,
+    0xA8, 0x5B, 0x8D, 0x2E, 0x1F, 0x03, 0xEC, 0x00, 0x5F, 0x04, 0xE6, 0x30, 0xB7, 0x6B, 0xBF, 0xEA,
+    0x1F, 0xEC, 0xAE, 0x3F, 0x6B, 0x18, 0xA5, 0x30, 0x4B, 0xFD, 0xF9, 0xED, 0xC9, 0xC2, 0xDA, 0x40,
+    0x51, 0xF8, 0xE9, 0xB1, 0xFA, 0x55, 0xB2, 0xBB, 0xD4, 0x30, 0x9A, 0x39, 0xCC, 0xCD, 0xD6, 0xAF,
+    0xAA, 0xD7, 0x81, 0x00, 0xBC, 0x07, 0x64, 0xA9, 0x39, 0x95, 0xA4, 0x90, 0x24, 0x19, 0x24, 0xA9,
+    0xAF, 0x92, 0x44, 0x91, 0x64, 0x58, 0x25, 0x0D, 0x61, 0x91, 0x54, 0x62, 0x92, 0xEC, 0xC2, 0x28,
+    0xF9, 0x1B, 0x48, 0x4D, 0xE9, 0x8A, 0xE4, 0x16, 0xB7, 0x4A, 0xFE, 0xBB, 0x21, 0xAB, 0x05, 0x92,
+    0x1C, 0x30, 0x29, 0x1C, 0x7F, 0x15, 0x99, 0xA2, 0x6E, 0x57, 0x3F, 0xCB, 0x6D, 0x0D, 0xA7, 0x0A,
+    0x67, 0x03, 0x73, 0x4F, 0x81, 0x31, 0x90, 0x25, 0xC9, 0x03, 0x0F, 0x80, 0x7C, 0x02, 0xC5, 0xEE,
+    0x8A, 0x0D, 0x63, 0x3F, 0x85, 0xD9, 0xCC, 0xFD, 0xAA, 0x5B, 0x87, 0x89, 0x73, 0xAA, 0x00, 0x53,
+    0x0F, 0xC5, 0xEE, 0x2D, 0xCF, 0x31, 0xFA, 0x1C, 0xE6, 0xAE, 0xF4, 0x6B, 0x8B, 0xDD, 0xC5, 0x4B,
+    0x8C, 0xF1, 0xED, 0x08, 0xEF, 0x03, 0x0B, 0x30, 0x1D, 0xBC, 0x75, 0xFC, 0x82, 0x3C, 0xAC, 0x0E,
+    0x18, 0x4F, 0x3E, 0x89, 0xD9, 0x16, 0xB3, 0x37, 0x28, 0x4E, 0x21, 0x0D, 0x73, 0x9F, 0xBB, 0x6C,
+    0x8B, 0x29, 0x07, 0x3F, 0x1D, 0xAC, 0x6F, 0xB6, 0x18, 0x9E, 0x43, 0x7E, 0x09, 0xA9, 0x2B, 0x7D,
+    0x6E, 0xAB, 0x2D, 0xE2, 0x25, 0xC4, 0xBD, 0x0B, 0xEB, 0x33, 0x30, 0x5E, 0x6D, 0xC7, 0xEF, 0x9A,
+    0xFB, 0x30, 0x85, 0xD9, 0x2E, 0xFD, 0xDA, 0xE4, 0x0B, 0xA7, 0x5F, 0x6C, 0xCB, 0xA3, 0x5D, 0xF8,
+    0xED, 0x8E, 0x26, 0x9E, 0xC9, 0x40, 0x12, 0x07, 0x9F, 0x48, 0x52, 0x0B, 0x30, 0x75, 0xC0, 0xAE,
+    0x23, 0xEE, 0x30, 0xCA, 0xAC, 0x5D, 0x91, 0xDC, 0x3C, 0x64, 0xC9, 0x8F, 0x31, 0x49, 0x7B, 0x8B,
+    0x64, 0x72, 0x57, 0xA4, 0x3E, 0x0D, 0x59, 0x0A, 0x8A, 0x49, 0xED, 0xD6, 0x22, 0xB9, 0xB9, 0x2B,
+    0x92, 0xD7, 0x90, 0xD5, 0x14, 0xC5, 0x24, 0xB7, 0xB4, 0x48, 0x41, 0x5D, 0x91, 0x29, 0x1A, 0x72,
+    0x13, 0xEB, 0x1D, 0x7E, 0x31, 0x00, 0xEC, 0x11, 0xE0, 0x13, 0x24, 0xF9, 0xFB, 0x9B, 0x24, 0xDC,
+    0x2C, 0xB5, 0xC5, 0x4B, 0xB2, 0xCB, 0xEB, 0x92, 0xDC, 0x73, 0xB3, 0xA4, 0xBF, 0xBC, 0x5A, 0xF5,
+    0x7B, 0xC0, 0x7A, 0x02, 0xBB, 0xDD, 0x35, 0x3C, 0xC7, 0x68, 0xE7, 0x30, 0x6B, 0x79, 0xB4, 0xA6,
+    0xDB, 0xFF, 0xA6, 0x00, 0x63, 0x0F, 0xC9, 0xD6, 0xE3, 0x5B, 0x8F, 0xAF, 0xFA, 0x6F, 0xEC, 0xAE,
+    0xFE, 0x25, 0x46, 0xF7, 0x93, 0x08, 0xBF, 0xBE, 0x0C, 0xE8, 0x8B, 0x10, 0x3C, 0x1A, 0x6D, 0x69,
+    0x20, 0xF9, 0xC5, 0xD1, 0xC2, 0x14, 0xB3, 0x63, 0x3C, 0xD9, 0x1A, 0x72, 0x17, 0x93, 0xCB, 0xA6,
+    0x2E, 0x72, 0x8B, 0xCB, 0x76, 0x95, 0x6C, 0x76, 0xD9, 0x2D, 0x92, 0xD9, 0x5C, 0xEE, 0x93, 0xA4,
+    0xE2, 0xB2, 0x1F, 0x25, 0xC5, 0xBB, 0xE7, 0x87, 0xE8, 0x05, 0x24, 0x35, 0x1C, 0x22, 0xC2, 0x54,
+    0x97, 0x43, 0x92, 0x5C, 0x71, 0xD9, 0x67, 0xA9, 0xDF, 0x5C, 0xEE, 0x37, 0xC9, 0x67, 0x97, 0xDD,
+    0x2E, 0xB1, 0xB8, 0x6C, 0x51, 0x4B, 0x72, 0xD9, 0x90, 0x3A, 0xC6, 0xA1, 0x8A, 0x65, 0xA8, 0x2D,
+    0x4C, 0x61, 0x0B, 0x9B, 0x81, 0xA9, 0xAF, 0xD7, 0x46, 0x49, 0x6A, 0x6E, 0xE9, 0xD9, 0xD7, 0xD4,
+    0x44, 0x72, 0x0B, 0x28, 0x7E, 0x37, 0x2E, 0x7E, 0x72, 0xC5, 0xCD, 0x0D, 0x6D, 0x56, 0x48, 0x4F,
+    0x6B, 0x58, 0x24, 0x97, 0xF5, 0xEC, 0xDD, 0x55, 0x96, 0x5D, 0x82, 0x45, 0xD7, 0x4E, 0x76, 0xA9,
+    0x21, 0x49, 0x3E, 0xFF, 0xBD, 0x5C, 0x09, 0x32, 0xF8, 0xDC, 0x72, 0x93, 0x7F, 0x22, 0x01, 0xA9,
+    0x83, 0x51, 0xCF, 0x7C, 0xE7, 0xD1, 0x69, 0x4F, 0xF0, 0x90, 0x6A, 0xE0, 0x8B, 0x4C, 0x0D, 0xB3,
+    0x2D, 0x6A, 0x51, 0x9F, 0xE5, 0x8A, 0x42, 0x12, 0xB9, 0x41, 0x8E, 0x64, 0x8B, 0x40, 0x7D, 0x76,
+    0x9F, 0x16, 0x85, 0x54, 0x87, 0xDC, 0xE0, 0x96, 0x98, 0xEC, 0x5E, 0x5B, 0xD4, 0xB3, 0x74, 0x45,
+    0xA1, 0x6A, 0xC8, 0x0D, 0x8B, 0x62, 0xB2, 0xF5, 0xC2, 0x48, 0x57, 0x9A, 0xF8, 0x81, 0xC2, 0x99,
+    0xA7, 0x38, 0x2A, 0x2C, 0x9E, 0x4D, 0xED, 0xF8, 0x59, 0x49, 0x7E, 0x7C, 0x43, 0x52, 0x35, 0xAB,
+    0xD4, 0x10, 0x93, 0xD4, 0xB2, 0x4B, 0xD2, 0x33, 0x7A, 0xE2, 0x81, 0xEC, 0xF9, 0x14, 0x26, 0x78,
+    0x3B, 0x2E, 0x0A, 0x6B, 0x83, 0x14, 0x93, 0x2D, 0x32, 0xA8, 0xCF, 0xF2, 0x45, 0x21, 0x19, 0x72,
+    0x83, 0x3C, 0xC9, 0x16, 0x53, 0x51, 0x9F, 0xFD, 0xB7, 0x8B, 0xC2, 0xFD, 0x6D, 0xC8, 0x0D, 0x61,
+    0x8A, 0xC9, 0xB2, 0xB5, 0xA8, 0x67, 0xEA, 0x8A, 0xC2, 0xA6, 0x21, 0x37, 0x4C, 0x07, 0x23, 0x2D,
+    0x3A, 0x39, 0x53, 0x5F, 0xBF, 0x0C, 0x06, 0x22, 0x9B, 0xA3, 0x4A, 0x6A, 0x4E, 0x3D, 0xC5, 0x54,
+    0xC7, 0xDE, 0x92, 0x4E, 0xB6, 0x86, 0x6C, 0x8B, 0xF8, 0xF7, 0x06, 0x85, 0x51, 0x21, 0xF9, 0x49,
+    0x7D, 0xEE, 0x93, 0x6C, 0x71, 0xB3, 0x1A, 0xEE, 0x2E, 0x52, 0xA0, 0x48, 0x3D, 0x4C, 0xB2, 0xA5,
+    0xCF, 0x6A, 0x30, 0x48, 0x21, 0x85, 0x45, 0x7D, 0x76, 0x45, 0xB6, 0x34, 0xA4, 0x06, 0xF9, 0xD2,
+    0xC4, 0xCD, 0xF0, 0x0A, 0x4C, 0x61, 0x83, 0xA5, 0x63, 0x7A, 0x6C, 0xCD, 0x0E, 0xD8, 0x05, 0x90,
+    0x9A, 0x08, 0xB3, 0xCC, 0xEA, 0x8A, 0xE4, 0x45, 0x92, 0xC9, 0xBF, 0xD1, 0x0C, 0x22, 0xC9, 0x66,
+    0x57, 0xA4, 0x1F, 0x8A, 0x24, 0x37, 0xBB, 0x22, 0x15, 0x91, 0xD4, 0x27, 0x57, 0x64, 0x36, 0x91,
+    0x9E, 0x0A, 0xA3, 0x2B, 0xE6, 0xBD, 0x2C, 0x52, 0xD8, 0x35, 0xD4, 0x9B, 0x4C, 0x03, 0xBB, 0x5F,
+    0x0C, 0xCC, 0xB7, 0x1E, 0x73, 0x73, 0xCF, 0xA2, 0xC8, 0x18, 0x48, 0x86, 0x5D, 0x03, 0x72, 0x4C,
+    0x0A, 0xBB, 0xE2, 0xAE, 0x96, 0xCD, 0xB0, 0xAA, 0x7B, 0x98, 0xDD, 0xC3, 0x45, 0x3E, 0xCC, 0x2F,
+    0xC6, 0x49, 0x7B, 0x78, 0xF9, 0xE3, 0x2A, 0x93, 0x71, 0x6F, 0x15, 0xB9, 0xFB, 0xE5, 0xC5, 0x3E,
+    0xCB, 0x77, 0xBF, 0x5A, 0x7D, 0x6A, 0x8A, 0x7B, 0x98, 0x90, 0xCD, 0xBE, 0x9A, 0xA2, 0x21, 0xC5,
+    0xD5, 0xAD, 0x8A, 0x22, 0xF9, 0xD9, 0x6C, 0xA6, 0x8A, 0xD1, 0x2D, 0x76, 0x35, 0x55, 0x61, 0x76,
+    0xA9, 0xAF, 0x8E, 0xFC, 0x94, 0x81, 0x40, 0x92, 0xA3, 0x3C, 0x16, 0x94, 0x50, 0x0D, 0xFC, 0x23,
+    0x53, 0xC3, 0x62, 0x77, 0x35, 0x8C, 0xFD, 0x2A, 0xBB, 0x2B, 0xCC, 0xEA, 0xD7, 0x86, 0x51, 0x61,
+    0xBE, 0xE8, 0x3E, 0xBF, 0x7D, 0x77, 0x57, 0xE0, 0x90, 0x91, 0x60, 0xB6, 0xF5, 0xF8, 0x2B, 0xBF,
+    0xFF, 0xEB, 0x55, 0x76, 0x6F, 0xE2, 0xA6, 0x50, 0x3D, 0xC5, 0x01, 0x64, 0x4F, 0x91, 0xBE, 0x79,
+    0x2A, 0x59, 0x98, 0xD4, 0xC1, 0x2E, 0xC7, 0x1D, 0xE6, 0x6E, 0x97, 0x2F, 0x76, 0x97, 0xE1, 0x15,
+    0xA4, 0x90, 0x19, 0xE5, 0x4A, 0x98, 0xD5, 0x72, 0x92, 0xA5, 0xF8, 0xE3, 0x22, 0x0D, 0xBF, 0x46,
+    0xB2, 0x3B, 0x49, 0x2D, 0x27, 0xAB, 0x14, 0xDF, 0xAA, 0x92, 0xCF, 0x24, 0xB9, 0xD5, 0x6F, 0x72,
+    0xC5, 0x32, 0x75, 0x45, 0x91, 0xB8, 0x1F, 0x0C, 0x6B, 0x60, 0x93, 0x74, 0x3C, 0x3E, 0x96, 0x6F,
+    0x0F, 0x10, 0x0F, 0x47, 0x9C, 0xDF, 0x65, 0xB6, 0xBB, 0x4C, 0x55, 0xBF, 0xCA, 0x6D, 0x0A, 0xB3,
+    0xFC, 0xD2, 0x30, 0x8A, 0xE9, 0x4F, 0xEE, 0x6E, 0xE2, 0xA6, 0x78, 0xE6, 0x29, 0x3D, 0x05, 0x72,
+    0x24, 0xEB, 0xF8, 0x58, 0x1E, 0x36, 0x07, 0xA4, 0x93, 0x73, 0x8A, 0x2D, 0x86, 0x06, 0x85, 0x39,
+    0x24, 0xB7, 0xF6, 0xD9, 0xEC, 0xB6, 0x34, 0x34, 0x88, 0x14, 0xFE, 0x93, 0xD4, 0xC3, 0x6C, 0x61,
+    0x6A, 0xF8, 0xC1, 0x21, 0x83, 0xF7, 0x59, 0xB2, 0x45, 0x6A, 0x90, 0x9A, 0xF8, 0x8B, 0x27, 0x12,
+    0xCB, 0x37, 0x4F, 0x65, 0x21, 0x39, 0x58, 0x1D, 0x77, 0xF6, 0x6E, 0x97, 0xFF, 0xD2, 0x2E, 0xF7,
+    0x0E, 0x6A, 0x33, 0xA3, 0x9E, 0x0A, 0x49, 0x1A, 0xB2, 0xD4, 0x95, 0x0B, 0x22, 0x40, 0x92, 0x86,
+    0x55, 0xEA, 0xAA, 0xD4, 0x30, 0x4B, 0x7E, 0x97, 0x2C, 0x67, 0x5F, 0xCB, 0x11, 0x4A, 0x07, 0xBB,
+    0x06, 0x76, 0xE9, 0x99, 0x5B, 0x8F, 0x32, 0x22, 0x8F, 0x89, 0x91, 0xE9, 0x87, 0x5E, 0x17, 0xE2,
+    0x8D, 0xCF, 0x8A, 0xE9, 0x6F, 0x25, 0x26, 0xFD, 0x71, 0xE2, 0x88, 0x0F, 0x24, 0xCF, 0x7E, 0x21,
+    0x24, 0x69, 0xA0, 0xF4, 0x7C, 0x4A, 0xB5, 0x6C, 0x61, 0xD3, 0x90, 0x6D, 0x55, 0x97, 0x45, 0x32,
+    0x9B, 0xDC, 0xD6, 0x16, 0xB5, 0x68, 0x97, 0xFC, 0x1C, 0xA4, 0x6E, 0xF3, 0xA3, 0x44, 0x9F, 0xA4,
+    0xE1, 0xE1, 0x2C, 0x19, 0xB2, 0xA4, 0x98, 0x25, 0xB9, 0x4D, 0x52, 0x5B, 0x24, 0x8D, 0x55, 0xD2,
+    0x1A, 0x25, 0x05, 0x46, 0xA9, 0x67, 0x94, 0x0C, 0xE3, 0xD5, 0xF1, 0x77, 0xEC, 0x92, 0x60, 0x96,
+    0x8E, 0x58, 0x74, 0x70, 0xB1, 0x06, 0x98, 0x34, 0x00, 0x53, 0x5F, 0xE3, 0x7B, 0x98, 0x6A, 0x4B,
+    0xBF, 0xC5, 0x14, 0x52, 0x7C, 0xB0, 0xD9, 0x62, 0x76, 0xC6, 0x90, 0xFC, 0x7B, 0x9B, 0x2D, 0x66,
+    0x8F, 0x29, 0xA4, 0xF0, 0xD6, 0x6E, 0x8B, 0xDB, 0xFC, 0x16, 0xDE, 0x42, 0x11, 0x48, 0x0D, 0x70,
+    0x2A, 0x5D, 0xDF, 0xAF, 0xF8, 0xD7, 0x09, 0xB3, 0x74, 0xC0, 0xB9, 0xDB, 0xB7, 0xA7, 0x2B, 0x2E,
+    0x70, 0x9F, 0xDD, 0xB3, 0x79, 0x52, 0x28, 0x0A, 0xB3, 0x98, 0xDD, 0x2A, 0x4B, 0xBB, 0x4B, 0xC3,
+    0x16, 0x26, 0x29, 0xBE, 0x97, 0x25, 0x43, 0x91, 0xE4, 0xD0, 0xD5, 0xFA, 0x18, 0x2F, 0xA1, 0x3B,
+    0xC4, 0x2C, 0xB9, 0x9F, 0x30, 0xC9, 0x94, 0xAE, 0x4A, 0x8C, 0x7E, 0xD5, 0xB0, 0x34, 0xA4, 0xAE,
+    0x8E, 0x3D, 0xDF, 0xA2, 0x3A, 0x88, 0xCC, 0x97, 0x14, 0xC4, 0xC0, 0x7D, 0x78, 0x40, 0x75, 0xD4,
+    0x23, 0x26, 0xCB, 0x64, 0x77, 0xD9, 0xA2, 0x7E, 0x55, 0x9F, 0x15, 0x66, 0x85, 0xD4, 0x30, 0x36,
+    0xE8, 0x4F, 0xEE, 0x6E, 0x22, 0x70, 0xE6, 0x01, 0x2A, 0x00, 0x9B, 0x24, 0xF9, 0x59, 0x92, 0xA2,
+    0x24, 0x35, 0x45, 0x92, 0x4C, 0x96, 0x24, 0x37, 0x49, 0xD2, 0x5F, 0x1C, 0xFC, 0x61, 0xC1, 0xB1,
+    0x07, 0x32, 0xDC, 0x8B, 0x6B, 0xCB, 0x6C, 0x90, 0x2B, 0xF2, 0x59, 0xA4, 0xDF, 0x6A, 0x0E, 0x9B,
+    0x48, 0x0D, 0x67, 0x77, 0x8B, 0x1C, 0x90, 0x34, 0x40, 0x91, 0xBE, 0xF0, 0x1A, 0x49, 0x92, 0x2B,
+    0xBA, 0x08, 0xF3, 0xC7, 0x9B, 0x43, 0x1D, 0xA5, 0x9E, 0x03, 0xF9, 0x9C, 0x1F, 0x81, 0xC1, 0x37,
+    0xD8, 0xE0, 0x01, 0x25, 0xF0, 0x0E, 0x1C, 0x31, 0x9D, 0x6C, 0x2D, 0xB3, 0x2D, 0xF2, 0xB3, 0xA9,
+    0xEA, 0xB3, 0x18, 0xDD, 0xA6, 0x90, 0xCC, 0x2E, 0xBF, 0x34, 0xC8, 0xAD, 0x62, 0xFA, 0x3F, 0x7D,
+    0xDD, 0x44, 0xEE, 0x70, 0xF7, 0xC2, 0x6B, 0x50, 0x0E, 0xEA, 0x11, 0x6B, 0x84, 0x77, 0xA9, 0x9E,
+    0x0C, 0x6F, 0xB1, 0x7B, 0xF2, 0xF5, 0xDA, 0xC4, 0xA5, 0x63, 0xBC, 0x34, 0xF3, 0xFF, 0xA5, 0xAF,
+    0x73, 0x1E, 0xCF, 0xE1, 0xFB, 0x3C, 0x39, 0xCF, 0x72, 0xB1, 0x7F, 0x17, 0xDA, 0x6C, 0x17, 0x7A,
+    0x7D, 0x52, 0xB7, 0x97, 0xEB, 0xB9, 0x0A, 0x45, 0x92, 0x3C, 0x14, 0x19, 0xD8, 0x25, 0x3F, 0x32,
+    0xC9, 0x64, 0xB7, 0x49, 0x5E, 0x4C, 0xD2, 0xA9, 0xDB, 0x74, 0x09, 0x18, 0x87, 0xB3, 0x03, 0x55,
+    0x72, 0x50, 0x24, 0xA6, 0x38, 0xCB, 0x6D, 0xA6, 0x4A, 0x4C, 0x43, 0x96, 0xDB, 0x5A, 0x24, 0x26,
+    0xBF, 0xC8, 0x6D, 0xAE, 0xA8, 0x05, 0xA6, 0x16, 0x58, 0x34, 0x3C, 0xDA, 0xED, 0x2B, 0x82, 0xA3,
+    0x9E, 0x1D, 0x16, 0xF5, 0xEC, 0xD7, 0xAB, 0x74, 0xC4, 0x6C, 0x77, 0x49, 0xA4, 0x3F, 0xA8, 0xA8,
+    0xA3, 0x48, 0x16, 0xD6, 0x83, 0xAA, 0x22, 0xD9, 0xDD, 0x70, 0xF8, 0x84, 0xF1, 0xA0, 0xA6, 0x27,
+    0xD4, 0x48, 0xB2, 0xBB, 0x45, 0xA4, 0xEB, 0xB0, 0x37, 0x7C, 0x00, 0xAC, 0x3D, 0x15, 0xEA, 0xD8,
+    0x5F, 0x02, 0xDF, 0x05, 0xCC, 0x96, 0xC3, 0x3A, 0x4F, 0xB6, 0xDF, 0x5B, 0x56, 0xB0, 0x3C, 0x51,
+    0x34, 0xBD, 0xF4, 0xBF, 0x2C, 0x9A, 0xBE, 0xF6, 0x9A, 0x14, 0xD9, 0xE5, 0x61, 0x33, 0xFC, 0x33,
+    0x8B, 0x9F, 0x2C, 0x26, 0xAB, 0xDF, 0xBC, 0xC4, 0xBD, 0xEF, 0xCB, 0xEE, 0x92, 0xFC, 0xD2, 0xDC,
+    0xBE, 0x53, 0xD5, 0xC3, 0x22, 0xA8, 0x6A, 0x8E, 0xC3, 0x72, 0x18, 0x58, 0xF1, 0xCD, 0x59, 0xAE,
+    0x04, 0xB5, 0x7C, 0x79, 0x53, 0x5C, 0xE2, 0x79, 0x2C, 0x06, 0xAA, 0x3A, 0x18, 0x75, 0xED, 0xF8,
+    0x30, 0xCA, 0xD1, 0x0F, 0xE4, 0x40, 0x3D, 0x55, 0xB0, 0x74, 0x50, 0x9A, 0xB8, 0xB4, 0x7C, 0x44,
+    0xB6, 0x45, 0x61, 0x31, 0x4C, 0x21, 0xB9, 0x4D, 0x7D, 0xB1, 0xA5, 0x61, 0x14, 0x73, 0x48, 0x43,
+    0x96, 0xAD, 0xB6, 0x18, 0x24, 0x9F, 0xC3, 0x87, 0x71, 0x91, 0xC1, 0x42, 0x95, 0x7C, 0x0E, 0xB0,
+    0xC8, 0x60, 0xF7, 0xAF, 0x22, 0xF9, 0x25, 0x24, 0x9F, 0x65, 0x2E, 0x3E, 0x0E, 0x73, 0x48, 0xC3,
+    0xA6, 0xAE, 0xD8, 0xD2, 0x90, 0xC4, 0x18, 0x92, 0x43, 0x3E, 0x5F, 0x67, 0xF2, 0xC4, 0xE2, 0xA0,
+    0x01, 0x04, 0x4B, 0x7B, 0x51, 0xDB, 0x35, 0xC7, 0x97, 0x7E, 0x3E, 0x82, 0x2A, 0x0F, 0xBB, 0x38,
+    0x67, 0x69, 0x19, 0x43, 0x32, 0xF5, 0x70, 0x44, 0x2F, 0x45, 0x55, 0x48, 0x2D, 0x63, 0x48, 0xE2,
+    0x3C, 0x26, 0x0D, 0x90, 0x64, 0x21, 0xC9, 0xAD, 0x21, 0x69, 0xC8, 0x21, 0x29, 0xCC, 0x21, 0x89,
+    0x14, 0x92, 0x61, 0x0C, 0xA9, 0xAB, 0x0D, 0x1F, 0xF8, 0xE2, 0xA8, 0x61, 0x71, 0xD4, 0x6B, 0x92,
+    0xA4, 0xCF, 0xDD, 0x52, 0xCB, 0xAE, 0x1E, 0xE4, 0x7F, 0xCA, 0xE4, 0xA7, 0x98, 0x86, 0x31, 0x24,
+    0x29, 0x24, 0x3D, 0x4B, 0xB2, 0x90, 0x06, 0x48, 0x61, 0x0E, 0x29, 0x4E, 0x21, 0x31, 0xC5, 0x14,
+    0x3F, 0xE2, 0xE7, 0x01, 0xF6, 0xBE, 0xF6, 0x6B, 0x73, 0xAB, 0x19, 0x25, 0x7D, 0x46, 0x7A, 0xE6,
+    0x75, 0x0D, 0x14, 0xC1, 0x66, 0x20, 0x77, 0xEB, 0xB5, 0xB1, 0x5F, 0xA4, 0x61, 0x96, 0xFC, 0xBD,
+    0x5B, 0x0A, 0x0F, 0x19, 0x23, 0xCC, 0x9C, 0xC7, 0x4C, 0xEA, 0x37, 0x26, 0x57, 0x98, 0xBA, 0xC2,
+    0x64, 0x0B, 0xC9, 0x96, 0x98, 0xBA, 0x12, 0x66, 0x57, 0x7C, 0xEE, 0xD7, 0xBE, 0xC6, 0xA5, 0x83,
+    0xD4, 0xB0, 0x4B, 0xD7, 0x46, 0x35, 0xC7, 0xB7, 0x0C, 0xEC, 0x0E, 0x76, 0x5B, 0xBA, 0xE2, 0xB2,
+    0xCB, 0x3E, 0xF9, 0x84, 0xAA, 0x81, 0xC5, 0xC1, 0xEC, 0x7F, 0x14, 0x67, 0x14, 0x5F, 0x29, 0x0D,
+    0x2E, 0x77, 0x9B, 0xFF, 0x51, 0xFC, 0x31, 0x54, 0x7F, 0x15, 0x5A, 0x72, 0x07, 0xA4, 0x7F, 0x9B,
+    0x0F, 0x77, 0xB7, 0xB9, 0x99, 0xE9, 0x75, 0xB7, 0x75, 0x89, 0xE9, 0x29, 0xB7, 0x49, 0x4C, 0x7A,
+    0x5C, 0xCD, 0x8A, 0xCC, 0xEE, 0x32, 0xEA, 0x5B, 0x38, 0x94, 0x5A, 0x59, 0xC3, 0x8F, 0x18, 0xD5,
+    0x4F, 0xE8, 0x42, 0x8C, 0x48, 0xC3, 0x88, 0xE4, 0x75, 0x29, 0x5E, 0x14, 0xD2, 0x1B, 0x42, 0x4D,
+    0x11, 0xEA, 0xF6, 0xAF, 0x70, 0x1A, 0x80, 0x12, 0x80, 0xE2, 0x27, 0x99, 0xE2, 0x47, 0x99, 0xCD,
+    0x8F, 0x6A, 0xB7, 0x41, 0x6A, 0xD6, 0x5E, 0x52, 0xFE, 0x8C, 0xA4, 0xA7, 0x74, 0x74, 0x4B, 0x3D,
+    0x4B, 0x07, 0x2F, 0xF1, 0xF5, 0xE2, 0x93, 0xFF, 0xD9, 0xD6, 0xD6, 0x38, 0x0D, 0x0F, 0x0F, 0x53,
+    0x7F, 0x78, 0x76, 0xFC, 0x02, 0xA3, 0xBA, 0x22, 0x85, 0x45, 0x37, 0x60, 0xEF, 0x21, 0x0D, 0xAC,
+    0xBA, 0x76, 0x4B, 0xED, 0x28, 0xE9, 0xCF, 0x45, 0xC3, 0xE6, 0xD6, 0x61, 0xEB, 0x79, 0x9E, 0x97,
+    0x98, 0x7D, 0x0A, 0xAB, 0xA2, 0x29, 0x6E, 0x51, 0xBB, 0xFA, 0x7B, 0x45, 0x72, 0xF7, 0x8B, 0x97,
+    0x14, 0xE3, 0xC3, 0xE5, 0x50, 0x55, 0x8C, 0x32, 0x35, 0xBC, 0x5B, 0xA4, 0x78, 0xBF, 0xF8, 0x45,
+    0x6E, 0xF5, 0xF7, 0x90, 0xC1, 0x14, 0x57, 0x14, 0x67, 0x9F, 0xC2, 0x32, 0x6C, 0x3D, 0x2F, 0xF3,
+    0x2D, 0x5A, 0xD6, 0x6E, 0xBF, 0x36, 0x4A, 0xBA, 0x26, 0x7D, 0xEE, 0x54, 0x03, 0xD9, 0xC1, 0x9B,
+    0xFB, 0xCD, 0xFD, 0xF3, 0xF2, 0xB3, 0x4C, 0x91, 0xC2, 0x64, 0xC9, 0x0A, 0x4C, 0xCD, 0xD7, 0xAB,
+    0x34, 0x7C, 0xBC, 0x34, 0xF8, 0x71, 0xF8, 0x65, 0xFD, 0xFA, 0xEE, 0x61, 0x8C, 0x9C, 0xEA, 0x99,
+    0xF1, 0x02, 0x56, 0xCB, 0xC0, 0x03, 0x96, 0x80, 0xDD, 0xE5, 0x93, 0x5B, 0x1B, 0xE4, 0xE7, 0xBE,
+    0x88, 0xE7, 0xC8, 0x66, 0x1F, 0x48, 0xEE, 0x57, 0x1B, 0xF2, 0xBC, 0x52, 0xC4, 0xE6, 0xB2, 0x61,
+    0xF2, 0xC9, 0x6D, 0x42, 0x7E, 0xB6, 0x7B, 0xC7, 0x12, 0xF0, 0xBC, 0x4C, 0xD1, 0x53, 0x1A, 0x65,
+    0xB2, 0x4B, 0x72, 0xB3, 0x97, 0xFC, 0x3B, 0x45, 0xF2, 0xCC, 0xD2, 0xF5, 0x9F, 0x3F, 0x81, 0xA4,
+    0x1D, 0xBF, 0x64, 0xEB, 0xB9, 0xC7, 0xE8, 0xB2, 0xD9, 0x15, 0x92, 0x5B, 0x2D, 0xF2, 0x73, 0x28,
+    0xE2, 0x26, 0xD9, 0xEC, 0x3F, 0xF4, 0xC9, 0xB1, 0x20, 0x5F, 0x4D, 0x11, 0x8B, 0xCB, 0xA6, 0x5E,
+    0xCC, 0xEB, 0x79, 0xB6, 0x9E, 0x07, 0x2C, 0x11, 0x49, 0x7A, 0xDA, 0x91, 0xFB, 0x4C, 0x35, 0x34,
+    0x8C, 0x64, 0xB7, 0xF6, 0xB3, 0xB8, 0xB1, 0xCA, 0xAD, 0x2F, 0x4A, 0x3C, 0x4C, 0x72, 0x20, 0xF1,
+    0x8D, 0xF5, 0x70, 0x06, 0xB9, 0x51, 0xE5, 0xD6, 0x7E, 0x15, 0x23, 0x29, 0x62, 0x70, 0x2C, 0xFD,
+    0x26, 0xE9, 0xE9, 0x2B, 0xCE, 0x5A, 0x0D, 0x30, 0xDB, 0xB3, 0xB0, 0x68, 0x68, 0xAB, 0xDA, 0x3C,
+    0x2C, 0xF2, 0x6D, 0x95, 0xB9, 0x6C, 0xD8, 0x65, 0x58, 0xF4, 0x46, 0x5B, 0xE5, 0xD2, 0xB0, 0xFC,
+    0x75, 0x69, 0x6B, 0xC7, 0xE8, 0xD7, 0x98, 0x3D, 0x3F, 0x2B, 0xF6, 0xF2, 0x10, 0x1F, 0x78, 0xA9,
+    0x0C, 0x1F, 0xB1, 0xB4, 0xAC, 0xBE, 0x88, 0xEC, 0x18, 0xE3, 0x66, 0xC8, 0xBE, 0x6A, 0x2F, 0x43,
+    0x98, 0x7C, 0x78, 0xF5, 0xD5, 0xC5, 0xBD, 0xFB, 0xE9, 0xFD, 0xCD, 0xAC, 0xE4, 0xAA, 0x7D, 0x58,
+    0xFD, 0xE4, 0x6F, 0x14, 0xB7, 0xB8, 0xF9, 0x0D, 0xB3, 0x99, 0xF5, 0xB3, 0x0D, 0x1D, 0xC9, 0xF0,
+    0x29, 0xB9, 0xA1, 0x3E, 0xBE, 0x4F, 0x11, 0xBB, 0xCB, 0xCF, 0x6E, 0x15, 0xF2, 0xB3, 0x29, 0x62,
+    0x74, 0xD9, 0x70, 0xE0, 0xF3, 0xC8, 0x7F, 0x78, 0xE7, 0xA2, 0xEB, 0xB0, 0x9B, 0x42, 0x7E, 0x31,
+    0xB5, 0x23, 0x07, 0x3C, 0x6F, 0x52, 0x74, 0xED, 0x3B, 0x6A, 0x60, 0xB2, 0xB0, 0xF4, 0x67, 0x71,
+    0xF5, 0x8B, 0x2B, 0x21, 0x75, 0x25, 0x26, 0xBB, 0x93, 0xEC, 0xCE, 0x64, 0x0E, 0xFA, 0x12, 0x08,
+    0xB2, 0x5B, 0x7D, 0x8D, 0xD9, 0x41, 0x6A, 0xD9, 0xF5, 0x28, 0x6E, 0x2E, 0x6B, 0x22, 0xCB, 0xF7,
+    0x62, 0x72, 0x5B, 0x83, 0xFC, 0x62, 0x8B, 0x98, 0xFA, 0x6C, 0xAA, 0xC2, 0x1F, 0xEA, 0xDA, 0x3B,
+    0x72, 0xC4, 0x73, 0x9F, 0xA2, 0x17, 0x8E, 0x46, 0xC3, 0xAB, 0xA4, 0x08, 0x1C, 0x01, 0xAB, 0xAD,
+    0x2D, 0x53, 0x48, 0xAE, 0xD8, 0xA2, 0x98, 0x42, 0xEA, 0x9E, 0x6C, 0x4C, 0x21, 0xB9, 0xD5, 0x96,
+    0x16, 0x85, 0x73, 0x66, 0x0B, 0x9B, 0x02, 0xBB, 0xEC, 0xFE, 0xC2, 0x81, 0x3B, 0xDB, 0x72, 0x41,
+    0xA2, 0x7B, 0x26, 0x59, 0xAA, 0xF4, 0x85, 0xDB, 0xA7, 0x92, 0xAE, 0x9D, 0xCA, 0xB1, 0x58, 0x78,
+    0x89, 0x7F, 0x29, 0x7E, 0xF6, 0x6F, 0x15, 0xB3, 0xC6, 0xE9, 0xE9, 0xC7, 0xD1, 0x26, 0xA9, 0xAB,
+    0x52, 0xD8, 0xF4, 0x0A, 0x14, 0x07, 0x69, 0x60, 0xB9, 0x2C, 0x6A, 0x1C, 0xF0, 0x4B, 0xA0, 0xD4,
+    0xBB, 0xE7, 0xD1, 0xDB, 0xD2, 0x3F, 0xB8, 0x87, 0x79, 0x3F, 0x87, 0xB4, 0x3E, 0x51, 0x6B, 0x3D,
+    0x51, 0x7C, 0xB5, 0x8C, 0xB2, 0x54, 0x5D, 0xA5, 0x14, 0xF8, 0x12, 0x3F, 0xA3, 0x38, 0x6E, 0x30,
+    0xB9, 0x6C, 0xAB, 0xFC, 0xE4, 0x4A, 0x53, 0xD4, 0xAF, 0x2E, 0xCB, 0x2F, 0x7E, 0x54, 0x78, 0xB3,
+    0x1C, 0x2E, 0xDE, 0xDA, 0x1A, 0x24, 0xC3, 0x26, 0x75, 0xA4, 0x8B, 0xAB, 0x58, 0x9F, 0x25, 0x85,
+    0xE9, 0x82, 0x13, 0xBB, 0x45, 0x66, 0x44, 0x1A, 0xC8, 0x12, 0x8C, 0x6A, 0xC9, 0x52, 0x7B, 0x76,
+    0x08, 0xC1, 0x6B, 0x92, 0x5A, 0x66, 0xA9, 0x61, 0xD5, 0x65, 0x6D, 0x11, 0x47, 0x1D, 0xD2, 0x80,
+    0xBA, 0x55, 0x92, 0xA9, 0x92, 0x4E, 0xA8, 0xA3, 0x80, 0x22, 0x1E, 0x9E, 0x93, 0x78, 0x79, 0xEF,
+    0x4B, 0x48, 0xF1, 0x39, 0x86, 0x65, 0x98, 0xFD, 0x7B, 0x6B, 0xB7, 0xBA, 0x4F, 0xF7, 0x76, 0x37,
+    0x95, 0x29, 0x8E, 0xC4, 0x65, 0x98, 0xFD, 0xBB, 0xA5, 0x5B, 0xFB, 0xCC, 0x9B, 0x7B, 0xBF, 0xF6,
+    0x95, 0xB8, 0x35, 0xC0, 0xAA, 0x23, 0x98, 0xA5, 0xF6, 0x77, 0x0D, 0x74, 0x9D, 0x59, 0xEA, 0x29,
+    0x52, 0x7B, 0xFB, 0x07, 0x97, 0x3C, 0x7A, 0x0B, 0xBB, 0xE7, 0x79, 0xA6, 0xB0, 0x0C, 0x73, 0xC3,
+    0x8D, 0x55, 0xB6, 0xEC, 0xD2, 0xC0, 0x74, 0x28, 0x5B, 0xCC, 0x2E, 0x89, 0x55, 0xF2, 0x24, 0x75,
+    0x1F, 0xA3, 0x76, 0x77, 0x45, 0x71, 0xF2, 0xD9, 0x57, 0xC7, 0x47, 0xFC, 0xE4, 0xEA, 0x5C, 0x78,
+    0x1E, 0x90, 0xA9, 0xB6, 0x2A, 0x26, 0xB7, 0xB5, 0xC8, 0x2F, 0x5D, 0x11, 0xD3, 0x90, 0xCD, 0x1F,
+    0xEC, 0x3A, 0xBF, 0xBB, 0xDF, 0xE4, 0xF2, 0x91, 0x64, 0x37, 0x49, 0x6E, 0x96, 0xE4, 0x47, 0x49,
+    0xAF, 0x4B, 0x6A, 0xAE, 0x38, 0xB5, 0x3A, 0x3E, 0xA6, 0x46, 0x7A, 0x66, 0x26, 0xBF, 0x74, 0x9B,
+    0xD9, 0x15, 0x27, 0x3F, 0x77, 0xC5, 0xEC, 0x0A, 0xB3, 0x9F, 0x0D, 0x87, 0xD4, 0x3D, 0xEB, 0xD9,
+    0x7F, 0xDD, 0x2F, 0x4A, 0x18, 0x73, 0x60, 0x49, 0x52, 0x64, 0xD6, 0x55, 0x1A, 0xF3, 0xBC, 0xCA,
+    0xAB, 0x3C, 0xE4, 0x1D, 0xDE, 0x61, 0x0D, 0xB3, 0x9F, 0x87, 0xC5, 0x65, 0xB7, 0x76, 0xAB, 0x29,
+    0x66, 0x6F, 0x77, 0x21, 0xC6, 0x38, 0xFA, 0xE4, 0xE7, 0x61, 0xFE, 0x9F, 0x5E, 0xD4, 0x3B, 0xF5,
+    0x4E, 0xED, 0x80, 0xC3, 0x2D, 0x2A, 0x97, 0x63, 0x38, 0xDE, 0xE7, 0x7D, 0x36, 0x76, 0xBF, 0x7B,
+    0x9E, 0x63, 0x64, 0x8C, 0xD3, 0xE1, 0x2F, 0x17, 0x56, 0xFE, 0xC8, 0x1F, 0xB7, 0xB9, 0xCD, 0x1C,
+    0xE1, 0xE2, 0xD6, 0xF7, 0x72, 0x9C, 0x21, 0x3D, 0x2A, 0xD1, 0xE4, 0x92, 0x24, 0xE9, 0x40, 0xE7,
+    0xBB, 0x03, 0x4C, 0x3C, 0x75, 0x01, 0xFB, 0xC8, 0x40, 0x91, 0xFB, 0x10, 0xC9, 0xDB, 0x22, 0x6D,
+    0x7D, 0x56, 0xBB, 0x84, 0x0F, 0x4F, 0xD5, 0x40, 0x96, 0x85, 0xAC, 0x3E, 0xFB, 0x59, 0x21, 0xC5,
+    0xB1, 0xA1, 0xDD, 0x65, 0x8B, 0x5B, 0x35, 0x7C, 0x12, 0x53, 0xC7, 0x81, 0x89, 0x4E, 0x4F, 0x24,
+    0x92, 0xC9, 0xB0, 0xC3, 0x68, 0x28, 0xFD, 0x26, 0x85, 0xD9, 0xAD, 0x3A, 0xE0, 0xA2, 0xFC, 0xEC,
+    0xCE, 0x5F, 0x93, 0x9F, 0x1D, 0x4C, 0x7E, 0x76, 0x30, 0xFB, 0xD9, 0xAD, 0x43, 0xF6, 0xB3, 0x5B,
+    0xDD, 0x63, 0xB2, 0xCF, 0x7E, 0x76, 0x67, 0x71, 0x0E, 0x4B, 0x84, 0x57, 0xD8, 0xE1, 0xCC, 0x3C,
+    0x46, 0xB0, 0x0D, 0x55, 0x8E, 0x55, 0xB6, 0x4A, 0x07, 0xB3, 0x12, 0xB7, 0x4F, 0x2F, 0x78, 0xCE,
+    0xE2, 0xE7, 0x90, 0x18, 0x31, 0xBB, 0x29, 0x6E, 0x75, 0xD9, 0xFF, 0x17, 0xDF, 0x86, 0xCD, 0x53,
+    0xC7, 0x4B, 0x2E, 0xD7, 0xB1, 0x09, 0x4A, 0x77, 0x76, 0x52, 0x3E, 0xAF, 0x3E, 0x1F, 0x22, 0x81,
+    0xA9, 0xA7, 0x2A, 0xB0, 0xE9, 0x38, 0x2C, 0x12, 0x37, 0x26, 0x53, 0xFC, 0x38, 0x64, 0xBE, 0x87,
+    0x81, 0xB5, 0xA5, 0x5E, 0x42, 0x6C, 0xF3, 0x9A, 0x40, 0x81, 0x89, 0xDA, 0x40, 0xEE, 0x57, 0x5B,
+    0xC3, 0xE6, 0x56, 0xB7, 0xBA, 0xE2, 0xD6, 0x3E, 0xDB, 0xDD, 0xAD, 0xC3, 0x62, 0xAA, 0x83, 0x47,
+    0xF2, 0x3C, 0x2E, 0xA6, 0xBA, 0xD5, 0x67, 0xB3, 0xBB, 0x75, 0xC8, 0xA6, 0xB8, 0xB5, 0xDF, 0xBA,
+    0xCD, 0x6D, 0x8E, 0xBB, 0x39, 0x72, 0xB8, 0xB6, 0x53, 0xAC, 0x92, 0x74, 0xED, 0xD6, 0x65, 0x60,
+    0xB3, 0xF4, 0xB0, 0xBA, 0xB3, 0x61, 0xE9, 0xB6, 0x6E, 0x6B, 0x6B, 0x5B, 0x15, 0x53, 0x9C, 0xDC,
+    0x3E, 0x2C, 0x0D, 0x6C, 0x72, 0x54, 0xD9, 0x2D, 0x4E, 0xA6, 0x0C, 0x4B, 0x5B, 0xBB, 0xAD, 0xA5,
+    0xE5, 0x79, 0x6E, 0x70, 0xC6, 0xF4, 0x58, 0xD6, 0x0B, 0x36, 0xBB, 0x95, 0x89, 0x9B, 0x6B, 0x3B,
+    0xFF, 0xD5, 0x95, 0x17, 0xFF, 0x4E, 0x0D, 0x55, 0x91, 0xAD, 0xFF, 0x24, 0xDE, 0x2F, 0xA6, 0x86,
+    0x69, 0xF8, 0x68, 0x6B, 0x2B, 0xF0, 0x10, 0x2A, 0xDF, 0x3D, 0xFE, 0xF2, 0x2A, 0xC5, 0x24, 0x5B,
+    0xF5, 0x19, 0x0F, 0x6F, 0x43, 0x69, 0x61, 0xD4, 0xB1, 0xFE, 0x1B, 0xCD, 0xBC, 0x3F, 0xAC, 0x25,
+    0xC7, 0x95, 0xE6, 0xF9, 0xCB, 0x4C, 0xD6, 0x4B, 0x89, 0x89, 0x66, 0xD0, 0x28, 0x6A, 0xA5, 0xAA,
+    0x6E, 0xE5, 0x1A, 0x34, 0xB4, 0x6A, 0x89, 0xE9, 0xB4, 0x41, 0x2C, 0xC8, 0x8A, 0x28, 0x11, 0x18,
+    0x1A, 0x34, 0x54, 0xC0, 0x56, 0x8D, 0x30, 0x4B, 0x43, 0x6D, 0x70, 0x80, 0x6D, 0xF5, 0xEE, 0xBC,
+    0x1E, 0xA0, 0x0D, 0x2D, 0x40, 0x31, 0x93, 0x22, 0x66, 0x64, 0xC8, 0xD0, 0xC3, 0x6C, 0x6B, 0xD7,
+    0x58, 0x43, 0x34, 0x38, 0x80, 0x54, 0x34, 0x4A, 0x46, 0x1B, 0x5A, 0x80, 0x55, 0x19, 0x55, 0xCF,
+    0x28, 0x43, 0x06, 0x93, 0xE4, 0x6A, 0x64, 0xD0, 0x50, 0x92, 0x2C, 0x0D, 0xBB, 0x29, 0x60, 0x2B,
+    0x24, 0xA6, 0xA4, 0xAC, 0xAA, 0xC8, 0xFC, 0xD6, 0x88, 0x7B, 0xDF, 0x1F, 0xFE, 0x51, 0x93, 0x12,
+    0x29, 0xCD, 0xC5, 0x7B, 0x71, 0xF3, 0xE6, 0xCD, 0x9B, 0x19, 0x71, 0x22, 0xE2, 0xC4, 0x77, 0xCE,
+    0xF9, 0x4E, 0x9C, 0xAA, 0xA2, 0x7E, 0x1C, 0x3F, 0x0F, 0x59, 0x3E, 0x37, 0xDF, 0x8C, 0xCD, 0xB5,
+    0xD8, 0x5C, 0x8B, 0xCD, 0xCB, 0x4B, 0xF3, 0xCA, 0x62, 0x5F, 0x59, 0xEC, 0xF5, 0xF8, 0x3F, 0x90,
+    0x5E, 0x33, 0x30, 0x1D, 0xF9, 0x0F, 0x50, 0xAD, 0x8E, 0x5E, 0xA1, 0x90, 0x62, 0xF5, 0xEB, 0x5F,
+    0xC5, 0xFA, 0xA5, 0x10, 0x9B, 0xAB, 0xE1, 0x59, 0x7B, 0x35, 0x60, 0x9F, 0x1E, 0x0F, 0xFF, 0xAF,
+    0x8D, 0xD8, 0x97, 0x47, 0x9A, 0xDF, 0x8C, 0x9F, 0x36, 0xBA, 0x13, 0x4B, 0x69, 0xA6, 0xD7, 0x40,
+    0x31, 0x42, 0x31, 0xBC, 0xFB, 0x3F, 0x73, 0x9B, 0x67, 0xE6, 0xEA, 0xC8, 0x24, 0x87, 0xFD, 0x45,
+    0xC4, 0x84, 0xC6, 0xB3, 0x66, 0x91, 0x66, 0x30, 0xAE, 0x88, 0x80, 0xF5, 0x50, 0x44, 0x30, 0x52,
+    0xC8, 0x24, 0x71, 0xA2, 0xFF, 0xC9, 0x39, 0xAA, 0x09, 0xE8, 0x1D, 0x98, 0x00, 0xAC, 0x40, 0x3D,
+    0x70, 0xD2, 0x4A, 0xDA, 0x97, 0x34, 0x37, 0x37, 0x25, 0xF7, 0x04, 0x27, 0x1C, 0xC0, 0xC3, 0xD9,
+    0xB9, 0x87, 0xDA, 0x7E, 0x5D, 0x6A, 0x69, 0x2A, 0x96, 0x76, 0x28, 0x83, 0x19, 0xAB, 0xB1, 0x1A,
+    0xAB, 0xB1, 0x1C, 0xAB, 0x50, 0x8D, 0xE5, 0x54, 0xFB, 0x4A, 0x0A, 0x56, 0x5A, 0xCE, 0x9C, 0x1E,
+    0x2F, 0x7F, 0x1A, 0x4E, 0x5A, 0x0D, 0xFD, 0xD2, 0xCA, 0x6B, 0xA9, 0x57, 0x76, 0xA7, 0x62, 0xA5,
+    0xF6, 0xB9, 0xB0, 0x1D, 0xEA, 0x5A, 0x68, 0xFD, 0x02, 0xF6, 0xA5, 0x48, 0xB6, 0xFB, 0xF6, 0x2D,
+    0x57, 0xE8, 0x8E, 0x86, 0x4C, 0x52, 0x47, 0x96, 0x1A, 0x23, 0x8F, 0xA4, 0x8E, 0x0B, 0xFA, 0x2E,
+    0x20, 0xB7, 0x29, 0x76, 0x74, 0x03, 0xAC, 0x16, 0xB0, 0x8A, 0x60, 0x5E, 0x99, 0x16, 0xFB, 0xE5,
+    0x4D, 0x91, 0x84, 0xF1, 0xF9, 0x23, 0xE7, 0x5E, 0x3A, 0x47, 0x33, 0xD2, 0xCB, 0x5D, 0xD9, 0x0D,
+    0x97, 0xB3, 0x68, 0x79, 0xB8, 0x1E, 0xA9, 0x56, 0x8A, 0x9F, 0xCD, 0x4C, 0x1A, 0x1E, 0xA8, 0xD6,
+    0x72, 0xB0, 0xE3, 0x9A, 0x2D, 0xF5, 0x64, 0x9E, 0xD6, 0xB5, 0x60, 0x96, 0x27, 0x69, 0x6F, 0x92,
+    0xEB, 0x3B, 0x34, 0xAF, 0x0E, 0xE5, 0xDB, 0x4B, 0x11, 0x7A, 0x4D, 0x95, 0x02, 0xA7, 0x3A, 0x00,
+    0xFB, 0xA5, 0xB9, 0xBD, 0x1E, 0xDB, 0xFD, 0xF8, 0x40, 0x3E, 0xC2, 0x7D, 0x0E, 0x68, 0x35, 0x82,
+    0xDD, 0x7B, 0x7C, 0xC4, 0x74, 0x54, 0x5D, 0x31, 0xC0, 0x03, 0xFC, 0x63, 0x2E, 0xF7, 0x8F, 0x26,
+    0x53, 0x2C, 0xAE, 0x0D, 0xB6, 0xF4, 0x5F, 0x78, 0xA8, 0xF2, 0x0F, 0x66, 0x6F, 0xF8, 0x08, 0xF7,
+    0x3C, 0x68, 0x3C, 0xBC, 0xDD, 0x45, 0x30, 0x0F, 0x19, 0x0F, 0x6F, 0xF8, 0x15, 0x3E, 0xFB, 0xC5,
+    0x72, 0xFD, 0x5F, 0x73, 0x3F, 0x36, 0xF2, 0x0F, 0x55, 0x6E, 0x77, 0xAC, 0xDC, 0xC3, 0x90, 0x8F,
+    0x4C, 0xF0, 0x02, 0xC5, 0xAD, 0xEC, 0x0A, 0x94, 0x5A, 0x81, 0xEC, 0x02, 0x64, 0xCF, 0xD1, 0xC6,
+    0xE2, 0x37, 0x53, 0xF5, 0xC8, 0x48, 0xDD, 0xB5, 0x6B, 0xF1, 0xF3, 0xB9, 0x2E, 0xC6, 0xA7, 0xDA,
+    0x49, 0x37, 0xFD, 0x13, 0x27, 0x01, 0xAB, 0x5F, 0x4A, 0x67, 0x2F, 0x38, 0xEE, 0xBB, 0x70, 0xE1,
+    0x51, 0x69, 0x69, 0xA5, 0x97, 0x2E, 0x5C, 0x58, 0xA0, 0x1A, 0xE0, 0x72, 0x7A, 0xFB, 0x1B, 0x68,
+    0x24, 0x49, 0x2B, 0x40, 0x76, 0x0E, 0x6A, 0x0D, 0x3C, 0xC0, 0x03, 0x7C, 0x91, 0x6C, 0xF8, 0x33,
+    0x3B, 0x7D, 0xA1, 0x2A, 0xBF, 0x53, 0x3C, 0xD3, 0xBD, 0x3E, 0xFC, 0x70, 0x78, 0x38, 0x7C, 0xE1,
+    0xAF, 0x4C, 0xA8, 0xEE, 0x29, 0xFE, 0xBF, 0x7C, 0xFF, 0xEA, 0xDB, 0xE3, 0xF8, 0x77, 0xEB, 0xC3,
+    0x7F, 0x6F, 0xE0, 0x41, 0x26, 0x9E, 0xA4, 0x7A, 0x6B, 0x86, 0x53, 0x7B, 0x34, 0x9A, 0xA4, 0x37,
+    0x24, 0x07, 0x54, 0x0B, 0x5A, 0xCD, 0x9D, 0xA5, 0xCD, 0x6F, 0x4D, 0xC5, 0x9D, 0xC1, 0xFC, 0xCC,
+    0x5F, 0xB1, 0x37, 0x43, 0x2B, 0xB7, 0x7B, 0x03, 0xA0, 0xE9, 0xC8, 0xE7, 0x23, 0x6F, 0x65, 0xAA,
+    0xE3, 0xCB, 0xCF, 0xAF, 0x3F, 0x78, 0xC7, 0x77, 0xB5, 0x03, 0xF8, 0xFC, 0xC5, 0x8B, 0xFF, 0x57,
+    0xBA, 0x64, 0x00, 0xF2, 0x95, 0x56, 0x8F, 0xAC, 0xAA, 0xAF, 0x2E, 0x67, 0xCA, 0x40, 0xE3, 0xB3,
+    0x85, 0x7A, 0xC8, 0x17, 0x1A, 0x5F, 0xAC, 0x17, 0xBF, 0x2A, 0x59, 0xCD, 0xE9, 0xB2, 0x5E, 0x8F,
+    0xFC, 0x5A, 0x26, 0x8B, 0x98, 0x31, 0x5B, 0x69, 0x67, 0x7E, 0x11, 0x29, 0x03, 0xB5, 0xCF, 0x54,
+    0x2B, 0xD8, 0x95, 0xAF, 0x39, 0xE0, 0xEB, 0xE6, 0x5A, 0xB4, 0xDF, 0x1E, 0xBF, 0x9E, 0x91, 0x9D,
+    0xE3, 0x24, 0xBD, 0xAF, 0x43, 0xB1, 0xD2, 0x7B, 0x33, 0xE7, 0xC2, 0x8E, 0x55, 0x44, 0x5D, 0xF3,
+    0x3E, 0xA7, 0xE4, 0x4D, 0x2C, 0x84, 0x9D, 0x9A, 0x88, 0x74, 0x67, 0xFD, 0x3F, 0xA4, 0x17, 0xF5,
+    0x65, 0xC5, 0x7A, 0xB6, 0xFF, 0xC1, 0x9D, 0x40, 0xA4, 0x89, 0x87, 0x99, 0x80, 0x76, 0x80, 0x4C,
+    0x40, 0xBE, 0xC7, 0xF6, 0x55, 0x49, 0x43, 0x23, 0x05, 0xAB, 0x9B, 0x43, 0xA3, 0x37, 0x82, 0xD1,
+    0x1C, 0x4B, 0xAD, 0x36, 0x93, 0xBE, 0xE3, 0x7B, 0xBD, 0x11, 0x6A, 0xCD, 0xB1, 0xD0, 0x6A, 0xE9,
+    0xF5, 0x1D, 0x6F, 0xF4, 0x46, 0x60, 0x9D, 0x23, 0x9C, 0xB1, 0x60, 0xBE, 0xE3, 0x29, 0xDE, 0x08,
+    0xF0, 0xEE, 0x13, 0x33, 0x9C, 0x79, 0x08, 0x8C, 0x83, 0xC2, 0xA7, 0x27, 0x65, 0xC5, 0xD2, 0xBE,
+    0xB9, 0xDA, 0x81, 0x53, 0x55, 0x6C, 0xC6, 0xCB, 0xE6, 0x7A, 0x78, 0x02, 0xFE, 0x9C, 0xDD, 0xD1,
+    0xAE, 0x99, 0x46, 0x56, 0xCC, 0xB1, 0x22, 0x93, 0x1A, 0x05, 0xC8, 0x7E, 0x80, 0x55, 0x71, 0x4B,
+    0xB5, 0x5B, 0x5E, 0xC8, 0x7F, 0x13, 0xCA, 0x57, 0x87, 0xE6, 0xAB, 0x5D, 0xB4, 0x37, 0x07, 0xBB,
+    0xF2, 0x29, 0x07, 0xD4, 0x1A, 0x25, 0x77, 0xC1, 0x71, 0xF4, 0x75, 0x0F, 0xF0, 0x45, 0x28, 0x66,
+    0xB2, 0x7E, 0x84, 0x16, 0xEC, 0x0A, 0x66, 0x20, 0xBB, 0x34, 0x92, 0xC5, 0xA4, 0x6F, 0xAC, 0x03,
+    0x33, 0x52, 0x8E, 0xE9, 0x63, 0x04, 0xCC, 0x48, 0xDD, 0xDD, 0x3D, 0xB0, 0x52, 0x84, 0x7C, 0xC1,
+    0x8C, 0x7C, 0x83, 0x76, 0x60, 0xC5, 0x78, 0xB3, 0x64, 0x52, 0x3E, 0x15, 0x77, 0x86, 0x46, 0xC1,
+    0xF2, 0xC2, 0x65, 0xA0, 0x1A, 0xEA, 0xC7, 0x06, 0xC8, 0x62, 0x31, 0x5E, 0x06, 0x2C, 0xEB, 0xA5,
+    0x7F, 0x86, 0x72, 0x34, 0xD2, 0x08, 0x91, 0xCF, 0x5F, 0xFA, 0x67, 0x68, 0x3A, 0xB8, 0x0C, 0x65,
+    0x48, 0x03, 0xFF, 0x0A, 0x70, 0x1E, 0x32, 0xCF, 0xFB, 0xBC, 0x1E, 0x4C, 0x75, 0xAF, 0xC6, 0x54,
+    0xF7, 0x98, 0xEA, 0xDE, 0x74, 0x64, 0x97, 0x46, 0x8A, 0x8D, 0xAE, 0xBC, 0x9C, 0x2A, 0x6B, 0x3C,
+    0xB0, 0x92, 0x4F, 0xE9, 0xE3, 0x99, 0x5C, 0x8E, 0x15, 0x73, 0x55, 0xC2, 0x8C, 0xD9, 0x6C, 0x6F,
+    0x4E, 0xAC, 0xD8, 0x22, 0xD8, 0xA7, 0xA5, 0x72, 0x6C, 0x8A, 0xA9, 0x51, 0x88, 0xD0, 0x03, 0x8D,
+    0xA3, 0x1E, 0xA0, 0x08, 0x94, 0x13, 0xB0, 0x90, 0x2F, 0x40, 0xED, 0xE9, 0x81, 0x62, 0xC2, 0xDE,
+    0xFE, 0x3E, 0xF4, 0x14, 0x92, 0xC7, 0x78, 0xAC, 0x66, 0xB2, 0x39, 0xD5, 0xB0, 0x78, 0xBF, 0xAA,
+    0xF3, 0x45, 0x28, 0xE5, 0x28, 0x26, 0x0A, 0xAD, 0xD0, 0xC3, 0x53, 0x5F, 0x0E, 0x18, 0x4F, 0xE1,
+    0x7B, 0xF2, 0x19, 0x30, 0x03, 0x16, 0x38, 0x3D, 0x51, 0x0D, 0x50, 0xCA, 0x13, 0x81, 0xCF, 0x8B,
+    0xC6, 0xDD, 0x3D, 0x50, 0x86, 0x22, 0xE4, 0x0B, 0xF4, 0xBC, 0x40, 0x3B, 0xB0, 0x3B, 0xD6, 0x9D,
+    0x59, 0x4A, 0xC5, 0x22, 0x14, 0x77, 0x06, 0xBB, 0xF2, 0x14, 0x2F, 0x5C, 0xE6, 0x3C, 0xC6, 0xD7,
+    0x8F, 0x0D, 0x90, 0x4F, 0xC7, 0xE4, 0x6E, 0x06, 0x23, 0x8D, 0x64, 0x1B, 0xB9, 0x5B, 0x97, 0x94,
+    0xCD, 0x46, 0xEE, 0xCB, 0x46, 0xEE, 0xDD, 0xB1, 0x0A, 0xDF, 0xED, 0xB0, 0x23, 0xED, 0x88, 0x1D,
+    0x38, 0x95, 0xC6, 0x90, 0xA3, 0xF4, 0x94, 0x03, 0xBB, 0x63, 0xA9, 0xB1, 0xD6, 0x68, 0x57, 0xD7,
+    0x76, 0x5C, 0x86, 0x6F, 0xA4, 0x81, 0xE4, 0x4F, 0xD6, 0x8A, 0x95, 0x96, 0x4C, 0x91, 0x66, 0x3A,
+    0xBC, 0x55, 0x1D, 0x7E, 0x08, 0xE8, 0xCE, 0x08, 0xC5, 0x1D, 0x39, 0xA8, 0xCA, 0x19, 0x20, 0x3B,
+    0xF2, 0xB8, 0x27, 0xD2, 0x85, 0x00, 0xF2, 0x40, 0xA9, 0x0E, 0xB0, 0x02, 0xD0, 0x02, 0x54, 0x3F,
+    0x9B, 0x01, 0xDB, 0x04, 0xC8, 0x66, 0x3B, 0x80, 0x19, 0xE4, 0xA1, 0xCD, 0x05, 0xC5, 0x5C, 0x2C,
+    0x60, 0x7E, 0xFE, 0xD5, 0x08, 0xBD, 0x14, 0x28, 0x24, 0x8D, 0xD4, 0x3F, 0xB9, 0x20, 0x8F, 0xC8,
+    0xE5, 0xCA, 0x89, 0x62, 0xA5, 0xBD, 0x41, 0xBD, 0x3E, 0xA6, 0xA9, 0x94, 0xAC, 0x86, 0x5A, 0x11,
+    0xEE, 0xDB, 0xAE, 0xD2, 0xD0, 0xEC, 0x3A, 0x60, 0x3A, 0x03, 0x14, 0xC3, 0x0C, 0x98, 0x57, 0x3D,
+    0x60, 0x16, 0x60, 0xB3, 0xDA, 0x66, 0x7B, 0x00, 0xAD, 0x07, 0x0A, 0x01, 0xD4, 0x2B, 0x80, 0x22,
+    0x50, 0x68, 0x02, 0x9A, 0x76, 0x04, 0x62, 0xEF, 0xA1, 0x1C, 0xE5, 0xC0, 0x3E, 0x22, 0xC8, 0x62,
+    0x15, 0xC1, 0x8C, 0x66, 0x02, 0xFB, 0xDD, 0x36, 0x90, 0x4B, 0xF2, 0x18, 0x49, 0x1D, 0xED, 0x85,
+    0xAF, 0x88, 0x22, 0x52, 0x2D, 0xD4, 0x03, 0x66, 0xCE, 0xB4, 0x47, 0x7B, 0xAB, 0xD1, 0x50, 0x2B,
+    0x4A, 0xAE, 0x55, 0x38, 0x90, 0x92, 0x91, 0x24, 0x47, 0x21, 0x49, 0x23, 0x54, 0x92, 0x66, 0x28,
+    0xEE, 0x2C, 0x5C, 0x81, 0x3C, 0xCA, 0xD5, 0x0E, 0x16, 0x3B, 0xE4, 0x0E, 0x7A, 0x33, 0x01, 0xB4,
+    0xC5, 0x02, 0x60, 0x3B, 0x5D, 0x7C, 0x0E, 0x6A, 0x6F, 0x25, 0x30, 0xA3, 0x91, 0x3A, 0xAA, 0x5B,
+    0x8F, 0xAF, 0x17, 0xD2, 0xED, 0x1C, 0xE4, 0x92, 0x06, 0x5C, 0xB6, 0x50, 0x4F, 0x3C, 0x89, 0x28,
+    0x16, 0x2C, 0xAD, 0x43, 0xAE, 0xF6, 0xED, 0x90, 0xF5, 0x52, 0x90, 0x72, 0x49, 0xD1, 0xCA, 0xA7,
+    0x05, 0xEA, 0xBE, 0xCD, 0xCF, 0x47, 0xAC, 0xA4, 0x91, 0xDD, 0x5B, 0x97, 0xE4, 0x33, 0xB9, 0x66,
+    0xA5, 0x9E, 0x68, 0xA7, 0x4C, 0x2E, 0x57, 0x57, 0x4F, 0x98, 0x98, 0xC9, 0x21, 0x5F, 0x4F, 0x54,
+    0x4B, 0x2B, 0xB9, 0xFE, 0xA7, 0xD2, 0x54, 0xC5, 0x4C, 0x8E, 0xDE, 0x1F, 0x5E, 0xD0, 0xD5, 0x13,
+    0x4D, 0xC8, 0xE4, 0xCA, 0x95, 0x7A, 0xDA, 0x51, 0xB7, 0x23, 0x69, 0x2C, 0x24, 0x4D, 0x58, 0x69,
+    0x3C, 0x10, 0x85, 0x03, 0xF2, 0xF5, 0x1E, 0xC8, 0x74, 0xD3, 0xC3, 0x15, 0x05, 0xB8, 0xC7, 0x4C,
+    0xC7, 0xC6, 0x70, 0x76, 0xD1, 0x41, 0xAD, 0x15, 0x1A, 0x69, 0xC2, 0xAE, 0x97, 0xE4, 0x9A, 0x09,
+    0x85, 0x7A, 0xC2, 0xAC, 0x26, 0x92, 0x69, 0x7F, 0x01, 0xFB, 0x4B, 0x39, 0xAA, 0xA5, 0xF7, 0xE4,
+    0xDA, 0x0D, 0xD0, 0xFF, 0x2C, 0x42, 0xFD, 0x5B, 0x41, 0xB5, 0xF4, 0x03, 0xB9, 0xEA, 0x19, 0xB4,
+    0x2F, 0xB0, 0x83, 0x46, 0x6C, 0xA8, 0x57, 0x9A, 0x90, 0x6B, 0xD5, 0x94, 0x6E, 0x4C, 0xAF, 0x31,
+    0x21, 0x00, 0x3E, 0xC1, 0xFD, 0x75, 0xD7, 0x3C, 0x36, 0x37, 0x63, 0x7F, 0x69, 0xAC, 0x14, 0xE8,
+    0x03, 0xF5, 0x4C, 0x2D, 0x57, 0x6B, 0xAA, 0x83, 0x1E, 0x0B, 0x66, 0xFC, 0x21, 0x9B, 0x66, 0x9C,
+    0x7A, 0x0E, 0x47, 0xAD, 0xB5, 0xF2, 0xB9, 0xA4, 0x05, 0xBB, 0x5E, 0xD2, 0x90, 0xCB, 0x19, 0x51,
+    0x4F, 0x98, 0x15, 0x79, 0xFA, 0x58, 0x2C, 0x54, 0x0A, 0xF5, 0xC4, 0x65, 0x0D, 0xBD, 0xAF, 0x5E,
+    0xD6, 0x97, 0xC4, 0xE5, 0x6A, 0x31, 0xB1, 0x1A, 0xEA, 0xC9, 0x86, 0xCB, 0xF4, 0x43, 0xFF, 0xEA,
+    0x90, 0x2B, 0xD7, 0x82, 0x89, 0x85, 0x06, 0xEC, 0x60, 0x56, 0x0A, 0x51, 0xAF, 0x34, 0x13, 0xBD,
+    0x6E, 0xCA, 0x55, 0x37, 0xA5, 0x89, 0x87, 0x4E, 0x27, 0xAC, 0xF2, 0x6F, 0x8F, 0x08, 0xE9, 0xCF,
+    0xD3, 0xF0, 0x00, 0xDA, 0x11, 0xE8, 0xC3, 0xF6, 0xE8, 0x93, 0xC7, 0x64, 0x59, 0x2B, 0x36, 0xFA,
+    0x85, 0xD6, 0x4A, 0x53, 0xBB, 0x60, 0xC7, 0x42, 0x98, 0x40, 0x3B, 0x96, 0x01, 0x13, 0x8B, 0x19,
+    0xF4, 0x74, 0x84, 0x26, 0x2C, 0x50, 0xAC, 0x2D, 0xD0, 0x0A, 0x30, 0xEA, 0xB6, 0x33, 0xDA, 0x06,
+    0xC0, 0xC4, 0x83, 0xA9, 0x73, 0x78, 0xB2, 0x59, 0x1D, 0xB4, 0x8A, 0xD0, 0x24, 0xD0, 0x93, 0x20,
+    0xA4, 0xD1, 0x02, 0x4D, 0x80, 0x72, 0x39, 0x47, 0x26, 0xCD, 0xB4, 0xD2, 0x50, 0x4F, 0xBB, 0xB1,
+    0x8C, 0x99, 0x9E, 0x16, 0x76, 0x6C, 0xBD, 0x89, 0x75, 0x28, 0xD6, 0x32, 0xA2, 0xB3, 0xA2, 0xF7,
+    0xED, 0x4F, 0x34, 0xD4, 0xD2, 0x50, 0x6A, 0x75, 0x99, 0x80, 0x7E, 0x20, 0x4F, 0x88, 0x35, 0x00,
+    0x7C, 0x6D, 0x0F, 0x1A, 0x4D, 0x14, 0x52, 0xA0, 0x99, 0xDA, 0x31, 0x13, 0xAD, 0x37, 0x13, 0x2B,
+    0xD6, 0x17, 0x33, 0xC2, 0xFA, 0x32, 0x96, 0x33, 0x75, 0xB0, 0x8E, 0xF6, 0x5A, 0x24, 0x93, 0x09,
+    0x94, 0xD1, 0x4E, 0xD4, 0xA1, 0x9F, 0x69, 0xBD, 0xE6, 0x4C, 0xF4, 0x73, 0x19, 0xE9, 0x43, 0x1D,
+    0x68, 0x87, 0xF6, 0x9A, 0xD3, 0x59, 0x3D, 0x50, 0xC4, 0x2A, 0xAE, 0xCD, 0x6B, 0x7A, 0x5B, 0xAA,
+    0xB4, 0xAF, 0x11, 0xB2, 0xF3, 0x64, 0xCF, 0x7D, 0x9A, 0x72, 0x79, 0x00, 0xA3, 0x15, 0xF3, 0x58,
+    0x24, 0xCF, 0x6F, 0x1C, 0x8A, 0xF4, 0x53, 0xE7, 0xC8, 0xB5, 0x50, 0x4B, 0xD8, 0x9F, 0xAB, 0xB3,
+    0x5D, 0xEF, 0x1B, 0xD7, 0x7A, 0x68, 0x3D, 0xA7, 0xE4, 0x4B, 0xC9, 0x37, 0x92, 0x6F, 0x87, 0xD6,
+    0xF7, 0x5D, 0xEB, 0xD5, 0xF5, 0xBE, 0xFF, 0x85, 0xFE, 0xA9, 0x95, 0x96, 0x7A, 0xAD, 0xA7, 0xEC,
+    0xDC, 0xC6, 0xCC, 0x68, 0x07, 0xB8, 0x13, 0x28, 0xC6, 0x99, 0x62, 0xF8, 0x11, 0xC5, 0x38, 0x93,
+    0x29, 0x40, 0xDB, 0x7D, 0x74, 0xCF, 0xF9, 0x94, 0x3B, 0xB1, 0x47, 0xA3, 0x6F, 0x69, 0x34, 0x92,
+    0xB4, 0xBF, 0x7E, 0x55, 0x5F, 0x59, 0x6C, 0xD7, 0xFB, 0xE6, 0xED, 0xA9, 0x9A, 0x33, 0x41, 0xFB,
+    0xDD, 0x4B, 0x21, 0xBB, 0x24, 0xA9, 0x94, 0x74, 0xFB, 0x3F, 0xE9, 0x17, 0x33, 0xB4, 0x43, 0xDB,
+    0x51, 0xCD, 0x45, 0x04, 0x75, 0x76, 0xE2, 0x71, 0xF5, 0xD2, 0xDA, 0xEA, 0x8E, 0xF4, 0x92, 0x66,
+    0xA3, 0x29, 0x3B, 0xCF, 0x89, 0x73, 0xA9, 0x96, 0x5F, 0x30, 0xD0, 0x5F, 0x81, 0x7E, 0x82, 0x66,
+    0x06, 0xAD, 0x90, 0x34, 0xA8, 0xE7, 0x44, 0x3D, 0x66, 0x52, 0xA8, 0xA4, 0xA9, 0xBE, 0xD5, 0x47,
+    0x3B, 0xD6, 0xB1, 0xF5, 0x55, 0xEC, 0x7D, 0xB9, 0xC8, 0x97, 0x8B, 0x7C, 0xB1, 0x79, 0x2F, 0x63,
+    0x3F, 0x54, 0xB1, 0x0D, 0x66, 0xB2, 0x6B, 0x3F, 0x1A, 0xA9, 0xCB, 0xB5, 0x24, 0x7B, 0xE0, 0x6F,
+    0x4E, 0x90, 0xEB, 0xCB, 0xAE, 0x90, 0x5C, 0xF1, 0x8A, 0xA0, 0xFB, 0xD1, 0x61, 0x4F, 0x9C, 0xF8,
+    0x07, 0x32, 0xA9, 0x2B, 0xA5, 0xB1, 0xBE, 0xD5, 0x4F, 0x76, 0x34, 0xC7, 0xEF, 0xDF, 0x1D, 0xB9,
+    0xBF, 0x3F, 0xB8, 0x7F, 0x30, 0x92, 0x3F, 0xB8, 0x7F, 0x06, 0x79, 0x04, 0xEB, 0x29, 0x22, 0xDC,
+    0x9D, 0x7A, 0x46, 0xFA, 0xA9, 0xB4, 0xDC, 0x77, 0x21, 0xA1, 0xB0, 0xBA, 0xA3, 0x48, 0x97, 0x64,
+    0x53, 0x9A, 0x85, 0xB5, 0x6E, 0x0D, 0xB5, 0x34, 0xD5, 0x53, 0x3B, 0x9B, 0xA9, 0x50, 0x19, 0x73,
+    0x5D, 0x5B, 0x73, 0x4D, 0xFA, 0xE6, 0x6F, 0x17, 0xFB, 0xFA, 0xA4, 0x2F, 0xDF, 0x9E, 0xEC, 0x2B,
+    0x9A, 0x4C, 0xE8, 0xA7, 0x32, 0xD6, 0xB1, 0x58, 0x0A, 0xFD, 0x54, 0xB9, 0x24, 0x7E, 0xA3, 0x85,
+    0x03, 0xE1, 0x01, 0x5F, 0x4F, 0xE8, 0x04, 0xEA, 0x61, 0x63, 0x35, 0x56, 0x23, 0xF0, 0xD9, 0x77,
+    0x22, 0x91, 0x52, 0x4B, 0xAD, 0xEF, 0x29, 0xD8, 0xC5, 0xAC, 0x58, 0x5F, 0xCF, 0xAC, 0xD8, 0x50,
+    0x06, 0xDA, 0xC1, 0x7A, 0xD4, 0x2D, 0x64, 0xAA, 0x02, 0x45, 0xB4, 0x8E, 0xEA, 0x56, 0x04, 0xA3,
+    0x11, 0x1A, 0x01, 0xED, 0xBC, 0x99, 0xB7, 0xD9, 0x0A, 0x09, 0x1D, 0x59, 0x0F, 0x65, 0x84, 0xAF,
+    0x69, 0x20, 0xD7, 0x0A, 0xA5, 0x06, 0xA8, 0x6E, 0x00, 0x9C, 0x84, 0x5C, 0x3E, 0x2D, 0x8F, 0x3B,
+    0xDA, 0x5C, 0x48, 0x7B, 0x78, 0xF0, 0x04, 0xE5, 0xA2, 0x48, 0x2B, 0x85, 0x52, 0x92, 0x6B, 0xC7,
+    0x66, 0x2E, 0x23, 0xF2, 0xAD, 0xAF, 0x62, 0x19, 0xE9, 0x8F, 0x1D, 0xCC, 0x65, 0x44, 0xAE, 0xF5,
+    0x4D, 0x28, 0x75, 0x69, 0xA1, 0x4D, 0x1D, 0x36, 0xD0, 0xFE, 0xC4, 0x1D, 0xBF, 0x73, 0xA6, 0x39,
+    0x59, 0x7F, 0xF9, 0xC5, 0x1F, 0x6C, 0xED, 0xF0, 0xB9, 0xE9, 0x30, 0x41, 0x60, 0xF7, 0x23, 0xFC,
+    0xEF, 0xE5, 0xDE, 0x3B, 0xA4, 0xD2, 0xEA, 0x25, 0xDD, 0x92, 0x0A, 0x0D, 0x1A, 0x8B, 0x98, 0xA9,
+    0x33, 0x63, 0x21, 0x5A, 0xCA, 0xA5, 0x88, 0x98, 0xD9, 0x0C, 0xD4, 0xA1, 0x07, 0xBB, 0x3F, 0x41,
+    0xFF, 0x3D, 0x9F, 0x86, 0x67, 0xAE, 0xB0, 0x41, 0x2A, 0x26, 0x02, 0xF5, 0x08, 0xB4, 0x6E, 0x63,
+    0x59, 0xB4, 0x9E, 0x9D, 0x4B, 0x0B, 0x34, 0x1A, 0xA1, 0x5D, 0x80, 0x2B, 0x2E, 0x19, 0x16, 0x0B,
+    0x60, 0x35, 0x01, 0xD2, 0x3B, 0xC1, 0xEE, 0x8E, 0x63, 0x63, 0x8B, 0xA4, 0x7B, 0x26, 0x99, 0x17,
+    0x0A, 0x80, 0xD1, 0x00, 0x5C, 0x56, 0x07, 0xC5, 0xAF, 0x04, 0xD4, 0xCF, 0x2C, 0xC0, 0x62, 0x22,
+    0x94, 0xA1, 0x09, 0x60, 0x3B, 0x3B, 0xC0, 0x7A, 0x41, 0x9E, 0x4A, 0x12, 0x58, 0x69, 0x25, 0x5B,
+    0x2E, 0x7C, 0x35, 0x62, 0x02, 0xCD, 0x44, 0xEB, 0xB0, 0x63, 0xB9, 0xBA, 0x4C, 0x37, 0x7A, 0xB9,
+    0x56, 0x6F, 0x6B, 0xC9, 0x24, 0x5F, 0x69, 0xC5, 0x48, 0x49, 0xE7, 0x7E, 0x94, 0xFA, 0x29, 0x61,
+    0xBC, 0x87, 0x79, 0x10, 0x58, 0xBF, 0x32, 0x42, 0x2E, 0xB1, 0x91, 0xDC, 0x06, 0xF5, 0xFD, 0x49,
+    0x11, 0x60, 0x06, 0x54, 0xDD, 0x3D, 0x98, 0x1B, 0x4F, 0x51, 0x29, 0x92, 0x6B, 0xDC, 0x80, 0xC2,
+    0x8F, 0x4A, 0x41, 0xFF, 0xE9, 0x30, 0x63, 0x19, 0x20, 0x99, 0x55, 0x49, 0x31, 0x60, 0x46, 0x00,
+    0xBB, 0x00, 0xB4, 0x01, 0xE0, 0xAE, 0x3F, 0xA4, 0x91, 0x31, 0x35, 0xD2, 0x78, 0x68, 0x1C, 0xD8,
+    0x0D, 0x8E, 0xB0, 0x0B, 0x54, 0xF1, 0x48, 0xCF, 0x7E, 0x0E, 0x68, 0xD3, 0x5A, 0x8C, 0x02, 0xF4,
+    0x7B, 0x47, 0xC0, 0xC5, 0xD7, 0xF6, 0x28, 0x25, 0x6F, 0xA4, 0xC9, 0xE8, 0xF9, 0xA5, 0x5A, 0xB0,
+    0x8F, 0x2E, 0x98, 0x57, 0x44, 0x1E, 0xE4, 0xB8, 0xB7, 0xF5, 0x09, 0x04, 0x54, 0x71, 0x23, 0x3F,
+    0x79, 0x68, 0x26, 0xA8, 0x56, 0xC8, 0x34, 0xA4, 0xE7, 0x95, 0xBA, 0xF5, 0x3F, 0x87, 0x5E, 0x8A,
+    0x95, 0xB4, 0xD0, 0x68, 0x81, 0xFB, 0xCE, 0x1D, 0x58, 0xBC, 0xF9, 0x0C, 0xB6, 0xC3, 0x04, 0xB2,
+    0x08, 0xE6, 0xB0, 0x66, 0xFF, 0x06, 0xB4, 0xD2, 0x6A, 0xAE, 0x6F, 0x69, 0x7F, 0x29, 0x62, 0xEB,
+    0xED, 0x63, 0x73, 0xE6, 0xD4, 0x61, 0x66, 0x50, 0x87, 0x89, 0xD0, 0x8F, 0x94, 0xEA, 0x3E, 0x61,
+    0x25, 0x2F, 0xC5, 0x5C, 0x6B, 0x42, 0x7A, 0xED, 0x06, 0xBE, 0x58, 0x81, 0x7D, 0x2C, 0x60, 0xDD,
+    0x0B, 0xEC, 0xB8, 0x4F, 0x1E, 0x22, 0xCF, 0x5A, 0xC2, 0x4A, 0x83, 0x5D, 0x2F, 0x4D, 0xCD, 0xC4,
+    0x52, 0x4F, 0xD8, 0x2F, 0x47, 0xAA, 0xFD, 0x05, 0xCE, 0x0A, 0xE8, 0x37, 0x4D, 0x33, 0xDB, 0xA6,
+    0xF5, 0x43, 0x5A, 0xFA, 0x4A, 0x39, 0xD0, 0x04, 0xB5, 0x7E, 0xFE, 0xB7, 0xD7, 0x24, 0x85, 0x46,
+    0x9A, 0xE8, 0x35, 0xC1, 0x05, 0x07, 0x99, 0x23, 0x5B, 0xC0, 0x4E, 0x54, 0x37, 0x7D, 0x36, 0x3F,
+    0x85, 0xCD, 0x43, 0xD6, 0x7D, 0x22, 0x2D, 0x65, 0x7B, 0x18, 0x8D, 0xA5, 0xF4, 0xB4, 0xBE, 0x17,
+    0xED, 0x60, 0xAF, 0xC7, 0x62, 0xEA, 0xBB, 0x93, 0xDB, 0xF6, 0xCC, 0x20, 0x4F, 0xB5, 0x42, 0x3B,
+    0xF3, 0x8C, 0x14, 0x8D, 0xE4, 0x1B, 0x8D, 0x49, 0x5C, 0x77, 0x6D, 0x34, 0x7A, 0x3D, 0x41, 0xB9,
+    0x00, 0x7A, 0x07, 0x9A, 0xFE, 0xF8, 0xDA, 0x74, 0xB7, 0xA3, 0x58, 0xC0, 0x8E, 0x14, 0x0B, 0x9C,
+    0x76, 0x1F, 0x45, 0x1F, 0x7D, 0x8E, 0xAF, 0x63, 0xBA, 0x96, 0x22, 0xB6, 0xA9, 0x9F, 0x0A, 0x25,
+    0xFB, 0xFE, 0xE3, 0x6F, 0x4F, 0xEE, 0xFE, 0x82, 0xCB, 0xE5, 0x58, 0x86, 0x48, 0x23, 0xE8, 0x47,
+    0xF2, 0x08, 0x27, 0xF8, 0x83, 0xFB, 0xE8, 0x87, 0x59, 0x00, 0x9B, 0x45, 0xA8, 0x7E, 0x19, 0xB7,
+    0x7A, 0x24, 0xD9, 0xA8, 0x97, 0x0F, 0x7A, 0xEA, 0xC2, 0x79, 0x90, 0x34, 0x27, 0xAB, 0x2C, 0xEB,
+    0xFF, 0x6B, 0x2F, 0xEA, 0x29, 0xD7, 0x58, 0x2E, 0xD4, 0x4B, 0x32, 0xCA, 0xDA, 0x01, 0x1B, 0xEA,
+    0x09, 0x13, 0xCB, 0x85, 0x5C, 0x67, 0xE5, 0xE8, 0x87, 0x76, 0xA0, 0x09, 0xF5, 0x44, 0x15, 0xCB,
+    0x85, 0x42, 0xC9, 0x24, 0x6B, 0x87, 0x64, 0xA2, 0xB5, 0x63, 0xB9, 0x64, 0xFD, 0xB8, 0x23, 0x25,
+    0x14, 0x38, 0x14, 0xDA, 0xE2, 0x75, 0x00, 0xCE, 0x9D, 0x84, 0x7E, 0x3A, 0x43, 0xAE, 0xE9, 0x0C,
+    0x59, 0x3F, 0x7D, 0x03, 0xCC, 0xF4, 0x24, 0x98, 0xE9, 0x47, 0x60, 0xA6, 0x7F, 0x64, 0xE7, 0xAB,
+    0xD3, 0xBD, 0x99, 0x34, 0x51, 0x49, 0x13, 0xF5, 0xAD, 0xDD, 0x09, 0x3B, 0x9A, 0x29, 0x21, 0xF0,
+    0xDE, 0x9B, 0x09, 0x75, 0xC7, 0x0B, 0xBF, 0x2D, 0xFA, 0xD0, 0x4C, 0x58, 0xE9, 0x16, 0x8D, 0xEE,
+    0xC8, 0x57, 0xDA, 0x97, 0xE7, 0x7C, 0xE6, 0xFE, 0x94, 0x26, 0x28, 0xE7, 0xA0, 0x92, 0x23, 0xD7,
+    0x04, 0x77, 0xCB, 0x25, 0x6F, 0xA2, 0x14, 0xA9, 0x24, 0x0F, 0x72, 0xFC, 0xED, 0xCD, 0x09, 0x2B,
+    0x39, 0x23, 0x4D, 0x85, 0xCE, 0xCA, 0xB5, 0x83, 0x99, 0xAA, 0x88, 0x9C, 0x3A, 0x33, 0x99, 0x79,
+    0x7B, 0x10, 0x91, 0x93, 0x37, 0x53, 0xA5, 0x5C, 0xCE, 0x4A, 0xB7, 0x72, 0xA9, 0x8F, 0x95, 0xF6,
+    0xE5, 0x4F, 0xB8, 0x93, 0x09, 0x28, 0xB4, 0x0A, 0x18, 0xC5, 0x63, 0x70, 0xC1, 0x48, 0xFA, 0xAD,
+    0xA4, 0xE5, 0xB4, 0xA4, 0xB3, 0x72, 0xD5, 0xD0, 0x0E, 0xD9, 0x54, 0x4F, 0x3C, 0x58, 0x2E, 0x90,
+    0xC9, 0x41, 0xFB, 0xD6, 0x45, 0x92, 0x49, 0xA4, 0x90, 0xE9, 0xBB, 0xE7, 0x69, 0x87, 0x83, 0x09,
+    0x6E, 0xCE, 0xCA, 0x95, 0x63, 0x3B, 0x14, 0xF3, 0xAE, 0xB4, 0x48, 0x52, 0x2B, 0xC9, 0x17, 0x12,
+    0xAD, 0x42, 0xA9, 0xC3, 0xE9, 0xFF, 0x6F, 0xC9, 0xB4, 0xD2, 0x6B, 0xAE, 0x7F, 0xDD, 0xEF, 0xC7,
+    0x62, 0x6D, 0xBB, 0xE6, 0x17, 0x73, 0xBE, 0x4A, 0xBA, 0x29, 0xAD, 0xFA, 0xEE, 0x85, 0x2F, 0x4F,
+    0xD0, 0x7B, 0xCA, 0x95, 0xBB, 0xAC, 0xF4, 0x92, 0x14, 0x73, 0xC9, 0x71, 0x21, 0xFD, 0xFC, 0x21,
+    0xFE, 0x8E, 0xFA, 0xA5, 0x17, 0x92, 0xF3, 0xCB, 0xAE, 0x90, 0x9D, 0x3F, 0x6C, 0xC4, 0xF6, 0xB9,
+    0x2F, 0xF5, 0xD2, 0x54, 0x4F, 0x5C, 0x2E, 0x17, 0xEA, 0xB3, 0x72, 0x45, 0x77, 0x50, 0xD5, 0xF5,
+    0xE2, 0xB3, 0x99, 0xB4, 0xD0, 0x4A, 0xD4, 0xB7, 0x2E, 0xB8, 0xC3, 0xD6, 0x0D, 0x4C, 0xF5, 0xC4,
+    0x53, 0xE5, 0x82, 0xFD, 0x8F, 0x92, 0x7E, 0xB6, 0x11, 0x48, 0xC4, 0xC1, 0x43, 0xFC, 0x5D, 0x39,
+    0x35, 0x58, 0x0D, 0x68, 0x82, 0x73, 0x7F, 0x78, 0x53, 0x1C, 0x64, 0xCB, 0x66, 0x11, 0xB2, 0x81,
+    0x14, 0xAA, 0xB9, 0xF7, 0xE3, 0x6E, 0xCA, 0xCE, 0xA1, 0x6E, 0x5C, 0xA1, 0xEA, 0x3E, 0xA2, 0x5E,
+    0xB1, 0x9B, 0x87, 0x4C, 0xBB, 0xD2, 0x52, 0x2E, 0x34, 0x67, 0xE5, 0xCA, 0xA1, 0x1D, 0x18, 0xB7,
+    0xFA, 0x3F, 0xD3, 0xC5, 0xEF, 0xD3, 0x4A, 0xAE, 0x96, 0x7C, 0xB9, 0x5E, 0x38, 0xB7, 0xAD, 0x28,
+    0xF5, 0xC4, 0xC3, 0xE5, 0x42, 0xFD, 0xB4, 0x9C, 0x79, 0xAD, 0xDF, 0x0C, 0x42, 0x49, 0x82, 0x6C,
+    0x4E, 0xFF, 0x2C, 0x9B, 0xD5, 0xC4, 0xA8, 0x23, 0x93, 0x87, 0x0C, 0x76, 0xCE, 0x51, 0x6B, 0xAC,
+    0xA4, 0xA7, 0xF5, 0x78, 0xB4, 0xDE, 0xBE, 0x39, 0xE7, 0x6B, 0xDF, 0x35, 0x37, 0xA5, 0x55, 0xD2,
+    0xCD, 0x5B, 0x17, 0xCE, 0xCB, 0x51, 0x45, 0x68, 0x47, 0x1E, 0x91, 0x96, 0x5A, 0xF2, 0x8D, 0x02,
+    0x27, 0x22, 0xD4, 0x8E, 0x22, 0x80, 0xED, 0x28, 0x34, 0x6C, 0x20, 0x46, 0x36, 0x14, 0x03, 0xB1,
+    0x98, 0xA8, 0x5F, 0x99, 0xD2, 0x44, 0x6C, 0xB6, 0x8F, 0xFF, 0x38, 0xBB, 0x24, 0xEB, 0xFE, 0x82,
+    0x6F, 0x94, 0x63, 0x11, 0x22, 0xF5, 0x4D, 0xB7, 0x55, 0xEF, 0x1B, 0x87, 0xE6, 0xEF, 0xD7, 0xC6,
+    0x29, 0x19, 0x73, 0xCD, 0xD6, 0x13, 0x93, 0x69, 0x86, 0x22, 0xAC, 0x60, 0x06, 0x0B, 0x77, 0xF3,
+    0x89, 0x03, 0xC8, 0xF4, 0x9F, 0xA1, 0x92, 0x46, 0x7A, 0x29, 0xE4, 0xBA, 0x7D, 0x29, 0x54, 0x2B,
+    0x55, 0xA8, 0xE7, 0x64, 0x05, 0x14, 0x83, 0x1D, 0xC8, 0x12, 0xE2, 0xEC, 0x0F, 0x0A, 0xF9, 0xFC,
+    0xE2, 0xF7, 0xE5, 0x0B, 0xC5, 0x7E, 0xC8, 0x15, 0xFB, 0x11, 0x33, 0xB7, 0x01, 0x33, 0xDB, 0x88,
+    0x99, 0x6B, 0x39, 0x33, 0x57, 0x92, 0xE6, 0x5C, 0x4A, 0x6E, 0x2D, 0x97, 0xD6, 0x65, 0xCE, 0x6D,
+    0x8C, 0x1A, 0xB3, 0x40, 0x7E, 0x27, 0xC0, 0x53, 0x75, 0x87, 0xF1, 0x2F, 0xC0, 0x5F, 0xE7, 0x07,
+    0xE6, 0xF3, 0xA7, 0x5C, 0x95, 0xC6, 0x96, 0x7C, 0xFB, 0x92, 0x3E, 0x67, 0x42, 0x35, 0x21, 0xDA,
+    0xCE, 0x84, 0x72, 0x46, 0x4E, 0xAE, 0x54, 0x1F, 0x68, 0x14, 0xC9, 0xB5, 0x24, 0xEC, 0x64, 0x46,
+    0x40, 0x7A, 0xCB, 0x55, 0xD2, 0x4A, 0x2B, 0x85, 0xFA, 0xAD, 0xE7, 0xF5, 0x48, 0xC4, 0x4C, 0xAD,
+    0xCF, 0x54, 0xAE, 0x67, 0xFB, 0xD1, 0x4A, 0x33, 0xD2, 0x42, 0x76, 0xE9, 0xB9, 0xAD, 0xC3, 0xD8,
+    0xB8, 0x7B, 0xC0, 0xFC, 0xFC, 0x0A, 0x54, 0x8A, 0x5B, 0x4B, 0xE2, 0x33, 0xFC, 0x69, 0x84, 0x03,
+    0xD4, 0xFC, 0x39, 0xF9, 0x52, 0x79, 0x8C, 0xA6, 0x8D, 0xA1, 0x77, 0xF2, 0x00, 0xBB, 0x9C, 0x7D,
+    0x82, 0x3E, 0x01, 0xE8, 0x58, 0x2E, 0xF5, 0xAF, 0x3A, 0xD1, 0xBB, 0x24, 0x13, 0xDA, 0xCE, 0x4C,
+    0x66, 0xA2, 0xBD, 0xA3, 0xE4, 0xA1, 0x6A, 0x34, 0x24, 0xC4, 0xBE, 0x02, 0x46, 0xEB, 0x73, 0xF4,
+    0xD2, 0x58, 0x4A, 0xCA, 0xD6, 0x8B, 0xFD, 0x64, 0x3D, 0x7A, 0x34, 0x52, 0x87, 0xF6, 0xC6, 0xE9,
+    0xB5, 0x90, 0xD4, 0x19, 0x69, 0xE0, 0xD4, 0x6D, 0xB7, 0xC1, 0x6D, 0xC9, 0x87, 0x77, 0xD8, 0xA6,
+    0xB6, 0xDB, 0x7E, 0xF1, 0xC7, 0x97, 0x4B, 0xBE, 0xB7, 0x09, 0x0A, 0x9B, 0x79, 0x1B, 0x1D, 0x1E,
+    0x8E, 0x2E, 0x5B, 0x7F, 0x2C, 0xB9, 0xFC, 0x71, 0x07, 0xC3, 0x8E, 0x03, 0xEC, 0xB0, 0x1D, 0xDB,
+    0x66, 0x4C, 0x61, 0xA3, 0x14, 0x70, 0x49, 0x83, 0xE2, 0x87, 0x24, 0x3B, 0xA9, 0x1C, 0x37, 0xFA,
+    0xD1, 0xF8, 0xED, 0x41, 0x00, 0x9E, 0xFA, 0x63, 0x0B, 0xA8, 0x1A, 0xD8, 0x60, 0x5A, 0x2A, 0x0D,
+    0x40, 0x5B, 0x0F, 0x50, 0x86, 0xBA, 0x83, 0xBB, 0xF9, 0xF4, 0x31, 0xAC, 0x91, 0x58, 0x04, 0x52,
+    0x27, 0xBD, 0xD6, 0x8F, 0xB4, 0x73, 0x26, 0x47, 0x3B, 0x94, 0x0B, 0x99, 0x5C, 0x3D, 0x51, 0x2E,
+    0xB4, 0x03, 0xF5, 0xB4, 0x39, 0xBD, 0x5E, 0x7C, 0x5E, 0xAE, 0xD6, 0x46, 0xAF, 0x6A, 0xCA, 0xF4,
+    0xDD, 0x0B, 0xFD, 0xFB, 0x5E, 0xBD, 0x90, 0xC9, 0xED, 0xAE, 0xD4, 0xFA, 0x8E, 0x54, 0x48, 0x09,
+    0xF5, 0xA6, 0xF1, 0x9B, 0x1C, 0x06, 0x1E, 0xCA, 0x3B, 0x01, 0xCC, 0xB5, 0x08, 0x96, 0x17, 0xE0,
+    0x2E, 0xEE, 0x25, 0x61, 0xEA, 0x4A, 0x0E, 0xAC, 0x1C, 0x9C, 0x96, 0xDB, 0xE8, 0xEE, 0x4D, 0x01,
+    0x64, 0xCA, 0x9E, 0x20, 0x53, 0xA3, 0xC4, 0x5E, 0xC8, 0x24, 0x0D, 0x99, 0x86, 0x76, 0xCC, 0xE4,
+    0xEC, 0x07, 0x2D, 0x26, 0xA3, 0xA0, 0xB5, 0xD6, 0x6B, 0x5B, 0xC8, 0x6B, 0xA4, 0x42, 0xDA, 0x97,
+    0x3A, 0x69, 0x3C, 0xBD, 0xB2, 0xA3, 0x2E, 0xB5, 0xE5, 0xEE, 0xFE, 0xAD, 0x8B, 0xFD, 0xED, 0x6F,
+    0x49, 0x92, 0xA6, 0xC7, 0xD7, 0x0B, 0xFF, 0x5A, 0xE7, 0xD3, 0x17, 0xB4, 0x6F, 0x5D, 0xBC, 0x34,
+    0x91, 0x64, 0x52, 0x4A, 0x92, 0x4B, 0x42, 0x49, 0x92, 0x20, 0x49, 0x25, 0x89, 0x62, 0xFB, 0x8B,
+    0x81, 0x7A, 0x62, 0x77, 0xA5, 0x56, 0x27, 0x05, 0xAB, 0x68, 0x93, 0x60, 0x38, 0x49, 0x72, 0x95,
+    0x1A, 0x0D, 0x70, 0x4A, 0x2E, 0x2D, 0xD8, 0xB9, 0x14, 0xA8, 0x12, 0x59, 0x03, 0x28, 0xE3, 0xE9,
+    0x91, 0xFA, 0xB7, 0x9A, 0x68, 0xA5, 0x90, 0xE9, 0xB6, 0x86, 0x72, 0x45, 0x5D, 0x3D, 0x15, 0x2B,
+    0xED, 0x60, 0xE6, 0x4C, 0xCE, 0x8E, 0xE5, 0xF2, 0x9E, 0xA7, 0x06, 0xC9, 0xE8, 0x4D, 0xCD, 0xAD,
+    0xBA, 0x0C, 0xF4, 0xE8, 0x63, 0xEA, 0x6D, 0x3F, 0xFF, 0xBD, 0xF5, 0x87, 0x03, 0xE2, 0x6D, 0xE9,
+    0x6A, 0x3F, 0x66, 0x72, 0xE5, 0x42, 0x3D, 0xD1, 0x0E, 0xBF, 0xEB, 0x70, 0x77, 0xFD, 0xB2, 0x64,
+    0x15, 0xAB, 0xAE, 0xD3, 0xF5, 0xEB, 0x52, 0x5D, 0xCF, 0x27, 0xB7, 0x76, 0xDE, 0x09, 0x9A, 0x35,
+    0xD3, 0x9C, 0xF5, 0x23, 0xEA, 0x8A, 0x15, 0x33, 0x63, 0xDF, 0x71, 0x58, 0xCA, 0x49, 0xCF, 0x68,
+    0xA5, 0xD5, 0xEB, 0xD2, 0x8F, 0x0F, 0x1D, 0x55, 0x46, 0xB2, 0x8A, 0xA7, 0xD7, 0x7F, 0xB9, 0x06,
+    0xF5, 0x44, 0x3B, 0xEC, 0xE8, 0x86, 0xF4, 0xB6, 0xE4, 0xAD, 0x5E, 0x97, 0xAE, 0x1F, 0x60, 0xDC,
+    0x73, 0xB9, 0xC6, 0x5A, 0xDD, 0xE9, 0xF7, 0x7C, 0x78, 0x3A, 0x6C, 0x27, 0xA3, 0xD9, 0x6A, 0xBC,
+    0x97, 0x6C, 0x2C, 0x7E, 0x3C, 0xB5, 0xB5, 0xA6, 0x5A, 0x6E, 0xE7, 0xDC, 0x1F, 0x24, 0x0E, 0xC8,
+    0x42, 0xF6, 0xE3, 0xA9, 0x31, 0x9A, 0x8C, 0x5C, 0x72, 0xE9, 0x7F, 0x18, 0x71, 0x40, 0x21, 0xBD,
+    0x28, 0xED, 0xA8, 0xFB, 0x20, 0x8F, 0xAD, 0xA7, 0xAC, 0xBF, 0x65, 0x15, 0xA5, 0x50, 0x77, 0x59,
+    0xC4, 0x8C, 0xD8, 0x01, 0xCD, 0x68, 0xE0, 0x24, 0x9C, 0xC3, 0xCC, 0xB4, 0x21, 0x93, 0xCF, 0xB7,
+    0x02, 0xFE, 0x30, 0x95, 0x29, 0x46, 0x2C, 0xF9, 0x84, 0x19, 0x69, 0x56, 0x9A, 0x00, 0x70, 0x2F,
+    0x26, 0xA4, 0xC7, 0x17, 0x91, 0x3F, 0x70, 0xEC, 0x70, 0x32, 0xD7, 0xD8, 0xAE, 0x59, 0x3F, 0x16,
+    0x2B, 0xF6, 0x3D, 0x8A, 0x76, 0xB2, 0x7A, 0x63, 0x33, 0x45, 0xD3, 0xF4, 0x7C, 0x51, 0x32, 0x49,
+    0x3A, 0xDA, 0x4B, 0xD3, 0x2B, 0x4D, 0xB5, 0x76, 0x48, 0x77, 0x4F, 0x0F, 0xF8, 0xFD, 0x4E, 0x67,
+    0xFD, 0x2D, 0x5A, 0x6F, 0x15, 0x33, 0x21, 0x85, 0x04, 0x49, 0xED, 0x08, 0xE4, 0x72, 0x40, 0x13,
+    0x49, 0xA1, 0x7C, 0xB0, 0xF1, 0x60, 0x8D, 0x3E, 0xC7, 0x09, 0xEC, 0x58, 0x2C, 0xA5, 0x68, 0x43,
+    0x1B, 0xCA, 0x35, 0x5F, 0x38, 0x9C, 0x55, 0x64, 0x8E, 0x93, 0xCD, 0x9A, 0xEB, 0x4D, 0x8D, 0xED,
+    0x7A, 0x7A, 0xCD, 0xFA, 0xD1, 0x8E, 0xC5, 0x5A, 0xAC, 0xD8, 0x7F, 0xE9, 0xA0, 0x94, 0xB3, 0xAF,
+    0x68, 0x2D, 0x16, 0xAB, 0xD1, 0x0E, 0x87, 0x7E, 0x68, 0xCC, 0x9C, 0xBC, 0x17, 0xB9, 0x06, 0xB0,
+    0x13, 0x64, 0xFF, 0x04, 0xE5, 0x48, 0x26, 0x8F, 0x15, 0xE6, 0x95, 0xB9, 0x98, 0x8C, 0xFF, 0x0C,
+    0xF7, 0x6F, 0xAA, 0x50, 0x48, 0xBE, 0x55, 0xCC, 0xFA, 0x5B, 0x64, 0x82, 0x3A, 0x7C, 0xC8, 0xB7,
+    0x26, 0x90, 0x0B, 0xEC, 0x48, 0x15, 0xC9, 0xD5, 0x65, 0x0A, 0xD8, 0x98, 0x4C, 0xA7, 0x13, 0x60,
+    0x3D, 0x6D, 0x60, 0x9D, 0xF3, 0xB0, 0x94, 0xC3, 0x99, 0xDC, 0x9D, 0x4C, 0x11, 0xF6, 0x52, 0xBE,
+    0x92, 0xCF, 0xE5, 0x69, 0x3F, 0xD8, 0x5F, 0xDF, 0x65, 0x72, 0xA5, 0x68, 0x23, 0xED, 0xC4, 0x03,
+    0x6E, 0x1B, 0x3B, 0x9C, 0xAD, 0x7E, 0xA6, 0xC5, 0x28, 0xEC, 0x4E, 0xC8, 0x97, 0x91, 0xDE, 0x67,
+    0xA2, 0xEF, 0x68, 0x7D, 0xDF, 0x51, 0x87, 0xBE, 0xA3, 0x8C, 0xFD, 0x86, 0x99, 0x97, 0x78, 0x62,
+    0xB5, 0x16, 0x28, 0x17, 0x0D, 0x64, 0xAA, 0x23, 0xB4, 0x57, 0xE5, 0xA9, 0x43, 0x13, 0x29, 0x63,
+    0x21, 0x9F, 0x09, 0xBB, 0x64, 0xFD, 0x8D, 0x42, 0xAF, 0x48, 0xBE, 0x5D, 0xA5, 0xB1, 0x90, 0x23,
+    0xB9, 0x8A, 0x9F, 0xDD, 0x2E, 0x52, 0x34, 0xC3, 0xD6, 0xED, 0x9A, 0xCF, 0x90, 0xF8, 0x34, 0x49,
+    0xA8, 0x27, 0x37, 0xA1, 0x55, 0x23, 0x0F, 0xA7, 0x93, 0x6E, 0xDE, 0xFA, 0xBB, 0x5B, 0xCF, 0x56,
+    0x5D, 0x37, 0xF2, 0x75, 0x68, 0x45, 0xEB, 0xDB, 0x21, 0x53, 0x11, 0x29, 0xA3, 0xF5, 0xD4, 0xBF,
+    0x8D, 0xD0, 0x2A, 0x90, 0xA9, 0x1D, 0x28, 0x63, 0xEF, 0xA9, 0x83, 0x3C, 0xED, 0x55, 0x75, 0x99,
+    0x72, 0x75, 0xE5, 0x52, 0xA8, 0x93, 0x4A, 0x7D, 0x4B, 0xB1, 0x5C, 0xD3, 0x18, 0xE2, 0xE4, 0x96,
+    0xE3, 0x54, 0x85, 0x2D, 0x10, 0xB9, 0xB2, 0xAD, 0xDE, 0x27, 0x0F, 0xEA, 0x34, 0x5B, 0x3D, 0xAA,
+    0x51, 0xCB, 0x8E, 0x3A, 0x75, 0xC5, 0x5A, 0x4D, 0x98, 0xB9, 0x75, 0xD8, 0x37, 0xA7, 0xE4, 0x75,
+    0x28, 0xA4, 0x0E, 0x73, 0x4B, 0x0E, 0xFB, 0x86, 0x40, 0xCF, 0x88, 0x62, 0x2D, 0x85, 0x99, 0x8D,
+    0x72, 0x2D, 0x46, 0x46, 0x93, 0x89, 0x1C, 0x72, 0x1E, 0x9F, 0x4D, 0xED, 0xCE, 0xE5, 0x28, 0xE4,
+    0xC9, 0x57, 0xC7, 0xC1, 0xB8, 0x3A, 0x0C, 0xED, 0xAE, 0xB0, 0x3B, 0x6F, 0x8D, 0xCC, 0x43, 0x9B,
+    0xF2, 0x77, 0x9F, 0xF8, 0x61, 0x3D, 0x71, 0xA6, 0x5C, 0x68, 0xDE, 0xCB, 0xEA, 0x74, 0x59, 0x44,
+    0xBE, 0x9F, 0xEB, 0x5B, 0xEC, 0xA5, 0x69, 0xD4, 0x2C, 0x95, 0x86, 0xDD, 0x05, 0x3B, 0x14, 0x1F,
+    0xA8, 0x68, 0xC7, 0x56, 0xAF, 0xA6, 0x75, 0xE5, 0x63, 0xAA, 0xE4, 0x81, 0x37, 0xDC, 0xA7, 0x5E,
+    0xD9, 0x12, 0xAE, 0xB8, 0x72, 0xD0, 0x27, 0xB9, 0x86, 0x7E, 0xD9, 0xD1, 0x07, 0xAC, 0xB2, 0x1D,
+    0xCA, 0xB5, 0xD4, 0xD2, 0x6B, 0x00, 0xCE, 0x61, 0x7D, 0xBE, 0x60, 0x86, 0x2C, 0x62, 0xC9, 0xDD,
+    0xC6, 0x45, 0x85, 0x05, 0xCC, 0xBE, 0xB4, 0x1F, 0xA4, 0x71, 0xDA, 0x51, 0xF7, 0x10, 0xED, 0x70,
+    0x0F, 0xF5, 0x94, 0x7D, 0xB0, 0xA6, 0x55, 0x99, 0x5C, 0x31, 0xB6, 0x43, 0x3E, 0xD7, 0x13, 0xEB,
+    0xE9, 0x8D, 0x3D, 0xFD, 0x33, 0x49, 0x81, 0x93, 0x27, 0x2A, 0x3D, 0xF2, 0x0B, 0xBD, 0x74, 0xAB,
+    0x9F, 0xBE, 0x51, 0x2C, 0x0D, 0x7A, 0xAC, 0xB3, 0x2F, 0x7B, 0x33, 0xDD, 0x5B, 0x2C, 0x20, 0x87,
+    0x1D, 0x30, 0x13, 0xEF, 0xFF, 0xA1, 0x5C, 0xA9, 0x35, 0x55, 0x9B, 0xD5, 0xFC, 0x77, 0x89, 0x3D,
+    0x9B, 0xCB, 0x25, 0x4B, 0x2E, 0xB4, 0x76, 0x30, 0xA1, 0x9E, 0xB2, 0x67, 0x3F, 0xA8, 0xD8, 0x4F,
+    0x42, 0xB3, 0x40, 0xBF, 0xC0, 0xEE, 0x02, 0xC5, 0xFB, 0xFE, 0xE7, 0x53, 0xB1, 0x94, 0xB1, 0x58,
+    0xAA, 0x98, 0xDE, 0x39, 0xF7, 0x5E, 0xD7, 0x95, 0x2B, 0xB4, 0x1A, 0x48, 0x52, 0xDF, 0x54, 0x1B,
+    0x69, 0x4C, 0xF5, 0xDE, 0xD0, 0x09, 0x37, 0x88, 0x8C, 0x7A, 0xFA, 0x5F, 0xA0, 0xBD, 0x19, 0xC8,
+    0x52, 0x78, 0xD4, 0x91, 0xF5, 0x13, 0x58, 0x0D, 0xF0, 0xFF, 0x6C, 0xAE, 0xAA, 0xA8, 0x27, 0xCE,
+    0xD0, 0x0E, 0xF9, 0x9C, 0xC9, 0x99, 0xF1, 0xB4, 0xA4, 0x47, 0x24, 0x2D, 0x46, 0x52, 0xE0, 0x04,
+    0x95, 0x5C, 0x23, 0x77, 0x5A, 0x8E, 0x63, 0x7F, 0x4F, 0xA0, 0x88, 0x02, 0xEA, 0x72, 0x39, 0x23,
+    0x67, 0xE5, 0x3E, 0x71, 0xFC, 0x9A, 0x4C, 0x5D, 0xAD, 0xA9, 0xD1, 0x74, 0x9C, 0xEF, 0x91, 0xA2,
+    0x42, 0xE5, 0x0A, 0x49, 0x34, 0x1B, 0xCA, 0xC7, 0xB1, 0x89, 0x9A, 0x5A, 0x46, 0xA9, 0x68, 0xE5,
+    0x2B, 0xC5, 0x4A, 0x63, 0xD6, 0x0F, 0xB9, 0x26, 0x6C, 0x97, 0x2B, 0x62, 0xBB, 0x5C, 0x2B, 0xB6,
+    0xCB, 0x25, 0x67, 0xBB, 0x7C, 0x91, 0xB7, 0x5D, 0x1E, 0x35, 0xDA, 0x2E, 0x8F, 0x76, 0xB2, 0x5D,
+    0x1E, 0xEB, 0x68, 0xBB, 0x3C, 0x56, 0xB2, 0x5D, 0x1E, 0x0B, 0xB5, 0x5D, 0x1E, 0x33, 0xA9, 0xCB,
+    0x23, 0xBD, 0xBA, 0x3C, 0x62, 0xD5, 0xE5, 0x11, 0xA3, 0xAE, 0x5C, 0x5D, 0xA5, 0xCE, 0x6A, 0x2C,
+    0xD4, 0x59, 0x0D, 0xA8, 0x23, 0x71, 0xD2, 0x36, 0xAB, 0x51, 0x97, 0xE8, 0x71, 0x9B, 0xD0, 0xB6,
+    0xF5, 0x9B, 0xE8, 0x0B, 0x4F, 0x1E, 0xAB, 0xEB, 0xF9, 0x13, 0x7B, 0x34, 0xB1, 0x5D, 0x68, 0x57,
+    0xC9, 0xFD, 0xA5, 0xA4, 0xAE, 0x90, 0x93, 0x2F, 0x56, 0x7A, 0x5F, 0xAC, 0xB4, 0xFF, 0x72, 0xD1,
+    0x0F, 0x8D, 0xF6, 0x15, 0xAD, 0xF6, 0xB7, 0x7E, 0xD6, 0x3F, 0xB5, 0x00, 0xF2, 0x8E, 0xAD, 0x71,
+    0x98, 0x9C, 0x8D, 0x9B, 0xA8, 0x5E, 0x15, 0xD8, 0x2A, 0xF5, 0xA4, 0x38, 0x3E, 0x96, 0xD6, 0x27,
+    0xA3, 0x55, 0x6C, 0x5C, 0x40, 0xC9, 0x90, 0x6D, 0x21, 0x71, 0x42, 0xD9, 0x03, 0x4A, 0x8C, 0x03,
+    0xE3, 0xAD, 0x83, 0x72, 0x5A, 0x20, 0x79, 0xE1, 0xA0, 0x1F, 0x37, 0x94, 0x87, 0xFF, 0x96, 0x06,
+    0xD4, 0x27, 0x79, 0x0E, 0x9A, 0x7C, 0x82, 0xFA, 0xFA, 0x08, 0x95, 0x3C, 0xA4, 0x85, 0x7C, 0xE5,
+    0xA8, 0xE3, 0xE6, 0x23, 0x96, 0x66, 0xD9, 0x91, 0x88, 0xCF, 0x87, 0x9D, 0x49, 0xCF, 0x61, 0x3F,
+    0x72, 0x99, 0xFB, 0xB2, 0x27, 0x30, 0xBE, 0x7F, 0x5D, 0x53, 0x3E, 0x35, 0x92, 0xFC, 0x19, 0x7A,
+    0x29, 0xF9, 0x9A, 0xDB, 0x11, 0xCC, 0x94, 0xA2, 0x9F, 0xAE, 0x09, 0x60, 0xA6, 0xFC, 0x83, 0x7C,
+    0xA8, 0xE7, 0x42, 0x0E, 0xA3, 0x20, 0x81, 0x64, 0xB6, 0xB1, 0x8B, 0xE3, 0x9D, 0x30, 0x64, 0xFD,
+    0x90, 0x2B, 0x1C, 0xE9, 0x84, 0x25, 0x75, 0x02, 0xB6, 0xCB, 0x17, 0x75, 0xB6, 0xCB, 0x63, 0x3F,
+    0xD8, 0x2E, 0x8F, 0x36, 0xD8, 0x2E, 0x8F, 0xF5, 0x6C, 0xBB, 0x3C, 0x56, 0x4B, 0xEA, 0x04, 0xDB,
+    0xE5, 0x31, 0x53, 0xFF, 0xDE, 0x9D, 0x50, 0x1E, 0xEB, 0x04, 0xB7, 0x6D, 0x76, 0x36, 0xF4, 0x40,
+    0x71, 0x3B, 0x19, 0x2F, 0xF1, 0x80, 0xE0, 0xC0, 0xBF, 0x73, 0x70, 0xFE, 0xC4, 0x5E, 0xAE, 0xEB,
+    0x1A, 0xDA, 0x55, 0xFA, 0x52, 0x2F, 0xCD, 0x85, 0x9C, 0xBC, 0x1D, 0xAB, 0x58, 0xAC, 0xB4, 0xDE,
+    0x8E, 0xE5, 0xEF, 0x3A, 0x68, 0xE4, 0xDB, 0x7D, 0xC5, 0x2A, 0x02, 0x7D, 0x97, 0x90, 0x6F, 0xA6,
+    0x8D, 0x7E, 0x6B, 0x23, 0x54, 0x02, 0x1E, 0x70, 0xA4, 0x50, 0x4A, 0x29, 0x41, 0x26, 0x1D, 0x1F,
+    0xA5, 0xA7, 0x9E, 0x83, 0x4C, 0x1A, 0xC9, 0x25, 0xB9, 0x42, 0x6F, 0x69, 0xCA, 0xE5, 0x4C, 0x0A,
+    0x87, 0x8D, 0xF2, 0xD4, 0xD1, 0x0E, 0x14, 0xAA, 0x27, 0xE8, 0x5F, 0x8D, 0xD0, 0xFC, 0x46, 0x50,
+    0x2D, 0xF2, 0x64, 0x6A, 0x03, 0xF4, 0xAF, 0x2E, 0xD0, 0xFC, 0x52, 0x1D, 0x26, 0xDA, 0x40, 0xB1,
+    0x98, 0x95, 0x42, 0x99, 0xC6, 0x5C, 0x34, 0xBA, 0x29, 0x97, 0x4B, 0x72, 0x54, 0x5A, 0x49, 0x81,
+    0xEA, 0x5C, 0x72, 0x85, 0xD4, 0x15, 0x89, 0xA6, 0xFF, 0xD1, 0xB1, 0x92, 0x12, 0xE5, 0xC7, 0x57,
+    0x90, 0x2D, 0xA7, 0x3D, 0x58, 0x8D, 0x50, 0x6A, 0xE4, 0xC8, 0xD7, 0x7F, 0x0A, 0x9E, 0x24, 0x0E,
+    0x8A, 0xB1, 0xE8, 0x8A, 0xB9, 0x76, 0xB9, 0x04, 0xFD, 0xBC, 0x25, 0xD9, 0x7E, 0x44, 0x0D, 0xFF,
+    0x04, 0x0E, 0xAA, 0xEE, 0x49, 0xA8, 0x42, 0xDB, 0x51, 0xCD, 0xD6, 0x53, 0xCE, 0xD6, 0x53, 0x84,
+    0xC6, 0xC1, 0x5E, 0xCE, 0x11, 0x0A, 0x02, 0xA5, 0xD4, 0x51, 0x49, 0x0B, 0x46, 0xCF, 0x6B, 0xA8,
+    0x16, 0x6C, 0x0A, 0x81, 0x3E, 0x23, 0x68, 0x83, 0x1C, 0x26, 0xB6, 0xC3, 0xB6, 0xE1, 0xAF, 0x46,
+    0x68, 0x7E, 0x2B, 0x28, 0x17, 0x79, 0x72, 0xED, 0x4E, 0xD0, 0x5F, 0x5F, 0xC1, 0x06, 0x79, 0xCC,
+    0x64, 0x67, 0x4C, 0x2C, 0xD5, 0x55, 0x91, 0x5E, 0xFD, 0x92, 0x6E, 0x4C, 0xA3, 0x99, 0x43, 0xBF,
+    0x31, 0xE6, 0x11, 0x4F, 0x7D, 0x7D, 0xC4, 0x7E, 0x67, 0xC0, 0xD6, 0x9E, 0xCB, 0x0D, 0xFC, 0xE8,
+    0x01, 0xB8, 0xF7, 0xAE, 0x8F, 0xB8, 0xFB, 0xD3, 0x22, 0x52, 0x4C, 0x29, 0xFF, 0x03, 0x8C, 0xD8,
+    0x60, 0x13, 0x0E, 0x69, 0x50, 0x17, 0x2E, 0x80, 0x95, 0x66, 0x8C, 0x24, 0xCF, 0xEE, 0xED, 0x3E,
+    0x99, 0x3E, 0x2E, 0x13, 0x76, 0xA4, 0xF5, 0x66, 0xA6, 0x0E, 0xC5, 0x42, 0x19, 0x33, 0x91, 0x29,
+    0x57, 0x47, 0x7B, 0x53, 0x1D, 0xB5, 0xE4, 0x28, 0x25, 0x47, 0xA6, 0x26, 0x40, 0xBB, 0x2F, 0xA8,
+    0x83, 0x0D, 0x94, 0xB1, 0x5A, 0xC9, 0x44, 0x1F, 0xB2, 0xFE, 0x86, 0xD1, 0x23, 0x52, 0xA7, 0x59,
+    0x1A, 0xAB, 0x05, 0x0E, 0x48, 0x36, 0xA5, 0x83, 0x08, 0x8D, 0xA7, 0x98, 0xE1, 0x4A, 0x0A, 0x6F,
+    0xA5, 0x88, 0xDA, 0x09, 0xF7, 0x44, 0x33, 0xB7, 0xD7, 0xF5, 0x62, 0xFC, 0x4B, 0xC9, 0xDB, 0xF5,
+    0xFB, 0x85, 0x0E, 0x82, 0x60, 0xEF, 0x7A, 0x2B, 0xE5, 0x0A, 0xC9, 0x59, 0x4D, 0x7F, 0x9A, 0xB6,
+    0x64, 0x7B, 0x24, 0x74, 0xB8, 0xF1, 0xBC, 0x9B, 0x03, 0x53, 0x30, 0x71, 0x6F, 0xCE, 0x01, 0x9C,
+    0xDF, 0xF9, 0x92, 0xBE, 0x15, 0xDB, 0xA8, 0x6B, 0xBD, 0x62, 0xA1, 0xB7, 0x3A, 0x1B, 0xDE, 0xBB,
+    0x35, 0xC5, 0x0A, 0xED, 0x84, 0xD5, 0xB4, 0xD5, 0x08, 0x3B, 0x90, 0x2F, 0xC9, 0xA9, 0xBC, 0x82,
+    0xF1, 0x14, 0x53, 0x62, 0xD8, 0xF9, 0xD2, 0x43, 0x2C, 0x03, 0x34, 0xD7, 0xC3, 0x56, 0x93, 0xDA,
+    0x09, 0x52, 0xF2, 0xC3, 0x31, 0x42, 0x40, 0x8A, 0x91, 0x93, 0xF5, 0x6F, 0x29, 0x50, 0x07, 0xB3,
+    0x50, 0x46, 0xD4, 0x1D, 0x88, 0x65, 0xA2, 0x0E, 0x65, 0xDC, 0x36, 0xB6, 0x5F, 0xA1, 0xD5, 0xB2,
+    0x35, 0x8E, 0x63, 0xEF, 0xC9, 0x64, 0x22, 0xB4, 0x3E, 0x19, 0xC7, 0x33, 0x65, 0xCC, 0xE5, 0x77,
+    0xB4, 0x67, 0x17, 0xA3, 0xB5, 0xD0, 0x1B, 0x52, 0x97, 0x98, 0xFF, 0xE7, 0xC9, 0xBA, 0xBB, 0xB1,
+    0x45, 0xC8, 0xE7, 0xCB, 0x98, 0x9B, 0x1D, 0x36, 0xC0, 0x72, 0x10, 0x22, 0xFB, 0x03, 0x04, 0x01,
+    0x7F, 0x95, 0x04, 0x2B, 0x4F, 0xBD, 0x82, 0xF6, 0x0E, 0x4C, 0xCF, 0x53, 0x3F, 0xA0, 0x94, 0xBA,
+    0x5E, 0x2A, 0xF5, 0x78, 0xB4, 0x63, 0x19, 0xE4, 0xCC, 0xFE, 0xC2, 0xC3, 0x66, 0x01, 0xBB, 0xBA,
+    0x0D, 0x6A, 0x0F, 0xB4, 0x9A, 0xA8, 0x15, 0x28, 0xF5, 0x72, 0x97, 0xE9, 0x7B, 0x5D, 0xB1, 0xB6,
+    0x98, 0x5F, 0xAF, 0xB4, 0xD7, 0xF5, 0xFC, 0x5A, 0x4B, 0x63, 0xA3, 0x65, 0xA3, 0xA7, 0x52, 0xA2,
+    0x60, 0x0B, 0xD6, 0xD3, 0x78, 0xCC, 0x70, 0x90, 0xB7, 0x03, 0x3B, 0xFF, 0x80, 0xD5, 0x68, 0x15,
+    0xAD, 0x6F, 0x4D, 0xA8, 0xF6, 0x97, 0x6C, 0x4F, 0x33, 0x8D, 0xC6, 0x5C, 0x72, 0xB5, 0x02, 0xCD,
+    0xF2, 0x24, 0xDA, 0xED, 0x9A, 0x57, 0xE7, 0xFA, 0x97, 0xD2, 0xD4, 0x68, 0xE4, 0x3E, 0x97, 0x88,
+    0x99, 0xED, 0x48, 0xA9, 0x11, 0x6B, 0xC6, 0x32, 0x18, 0xBF, 0x8D, 0xEE, 0xED, 0x5C, 0x74, 0x99,
+    0x34, 0x36, 0xD2, 0x55, 0xFD, 0x17, 0x99, 0x39, 0x8B, 0x76, 0x28, 0x82, 0x9C, 0x79, 0x44, 0x0E,
+    0xA3, 0x3D, 0x6A, 0x4D, 0x34, 0x8A, 0xD4, 0x5A, 0x28, 0x15, 0xC9, 0x34, 0x3D, 0x4B, 0xFB, 0xE6,
+    0x88, 0xBE, 0xE7, 0x8B, 0xA5, 0xED, 0xEA, 0x5F, 0xEA, 0x2D, 0x7D, 0x4B, 0x9A, 0x2B, 0xC9, 0x71,
+    0xC1, 0xC1, 0x89, 0x94, 0x0F, 0xB3, 0x50, 0xDD, 0x1C, 0x8A, 0xD7, 0x62, 0x11, 0x6A, 0xFE, 0x3A,
+    0x09, 0xEC, 0xD4, 0x39, 0xA4, 0x4E, 0x0A, 0xCA, 0xA2, 0xF5, 0x8D, 0x99, 0x76, 0x1E, 0xD1, 0x48,
+    0xAF, 0xAE, 0xD2, 0x42, 0x2B, 0x4F, 0xFF, 0xEB, 0x50, 0x2C, 0x57, 0xE8, 0x77, 0xC7, 0xF6, 0xBA,
+    0x34, 0xF4, 0xEA, 0xB8, 0xF0, 0xF1, 0x88, 0xF9, 0xFB, 0x89, 0xE0, 0x75, 0x7A, 0x4A, 0x13, 0xA7,
+    0x4D, 0xC0, 0xE8, 0x33, 0xBF, 0x7F, 0x25, 0xEF, 0x76, 0x98, 0x99, 0xAC, 0x07, 0xE3, 0xA9, 0x46,
+    0xAA, 0x91, 0x7C, 0x8F, 0xA2, 0xAB, 0xBA, 0xC6, 0x5D, 0xC1, 0x7E, 0x7B, 0xA4, 0x5D, 0x13, 0x09,
+    0xCE, 0xF2, 0x31, 0x49, 0x7E, 0x87, 0x07, 0xCB, 0xC1, 0xB2, 0x58, 0xEA, 0x9B, 0x2E, 0x57, 0x47,
+    0xE3, 0x53, 0xDA, 0xC2, 0xEF, 0x2F, 0xF9, 0x6D, 0xD4, 0x5E, 0x47, 0x0A, 0xA7, 0xEE, 0x8A, 0x65,
+    0x53, 0x5C, 0xFE, 0x24, 0xEA, 0x9E, 0x20, 0x01, 0xDE, 0x0F, 0x53, 0x1C, 0xCD, 0xDE, 0x3C, 0xF0,
+    0xAC, 0xFF, 0x0D, 0xDB, 0x4B, 0x5A, 0xBF, 0x8D, 0x55, 0x35, 0xDD, 0x16, 0x2C, 0x3F, 0xC7, 0x76,
+    0x5E, 0xD4, 0x81, 0x32, 0x72, 0x5A, 0xFA, 0xB2, 0xF4, 0x72, 0x7F, 0xFB, 0xD9, 0x2A, 0x92, 0x0B,
+    0x7A, 0x4F, 0x13, 0x38, 0xFE, 0x61, 0xC9, 0x32, 0xC9, 0x5B, 0x8D, 0x65, 0x9A, 0x0B, 0x3B, 0x7B,
+    0x14, 0x2B, 0xEC, 0x7A, 0x8A, 0x40, 0x3E, 0x51, 0x4C, 0xF0, 0x2C, 0xFC, 0x39, 0x0F, 0x83, 0x65,
+    0x81, 0xFA, 0x95, 0x69, 0x13, 0x9B, 0x4A, 0x59, 0x3A, 0x4F, 0x1D, 0xB7, 0x26, 0xFE, 0x48, 0xB2,
+    0x28, 0x06, 0x88, 0xF0, 0x14, 0xD4, 0xAE, 0xBE, 0xEE, 0xCD, 0x2F, 0x87, 0x32, 0xDE, 0x9B, 0x89,
+    0x1D, 0xE9, 0x15, 0x69, 0xBA, 0xB4, 0x7E, 0xFF, 0xFD, 0x1A, 0x1C, 0xC9, 0xE5, 0x5C, 0xAB, 0x60,
+    0x34, 0x67, 0x9A, 0x0F, 0x18, 0xDB, 0x1F, 0xAE, 0xEA, 0xAD, 0xD6, 0x4D, 0xF1, 0xA1, 0xAA, 0xFE,
+    0x2F, 0x74, 0x4F, 0xDE, 0xDF, 0xDE, 0x93, 0xE6, 0x4F, 0xE9, 0xFC, 0xFB, 0x75, 0x4F, 0x5A, 0x89,
+    0xCB, 0xF8, 0x05, 0xC0, 0xAE, 0x13, 0x70, 0x5B, 0x03, 0x14, 0xD7, 0xD6, 0x83, 0x24, 0x9C, 0xA3,
+    0x1C, 0xEA, 0xA9, 0xD6, 0x22, 0xF9, 0x5E, 0x2F, 0xF5, 0x13, 0x5F, 0x9D, 0x91, 0xC7, 0xFA, 0x42,
+    0x20, 0x4C, 0xA4, 0x88, 0xD8, 0x80, 0x09, 0x1F, 0xE6, 0x74, 0x1D, 0xE8, 0x07, 0xFA, 0x2E, 0xD3,
+    0x50, 0x2D, 0x14, 0xDA, 0x72, 0x7B, 0x21, 0x4F, 0x54, 0xAC, 0x4F, 0x9D, 0x03, 0xAA, 0xAE, 0x03,
+    0x1B, 0x42, 0xF2, 0x92, 0xF2, 0x64, 0x3B, 0xC2, 0xC9, 0xAA, 0x7B, 0x27, 0xF5, 0xBD, 0x89, 0x95,
+    0x5C, 0x1F, 0x6B, 0xB9, 0xDD, 0xB8, 0x23, 0x57, 0x46, 0x3E, 0x58, 0xB1, 0xE6, 0x72, 0x85, 0xA4,
+    0xBD, 0x5C, 0x52, 0xA4, 0x8F, 0xED, 0xCC, 0x09, 0x77, 0x12, 0xD2, 0x9A, 0x64, 0x36, 0x8C, 0xEE,
+    0xF0, 0xEE, 0xB4, 0xBF, 0x52, 0x3A, 0x2B, 0xFD, 0x4C, 0xB1, 0xD2, 0x72, 0x5A, 0xEE, 0x84, 0xBA,
+    0xDF, 0x53, 0x0E, 0x47, 0x4E, 0x67, 0xA2, 0x5A, 0xA8, 0x66, 0xEA, 0x85, 0x7E, 0x48, 0x2B, 0x3A,
+    0x56, 0x0A, 0xDB, 0xFC, 0x99, 0x94, 0xDE, 0x63, 0x15, 0xA0, 0xD5, 0xB4, 0x91, 0xC9, 0xC7, 0x2C,
+    0x89, 0x34, 0x14, 0x8C, 0xFB, 0x33, 0xC0, 0xFE, 0x9F, 0x87, 0xDC, 0xF6, 0x7E, 0xE6, 0x18, 0x3D,
+    0xE3, 0x4F, 0x3C, 0x50, 0xEE, 0xDA, 0x92, 0xD1, 0x68, 0xBF, 0x14, 0x36, 0x4E, 0x38, 0xA3, 0x2D,
+    0xCD, 0xE5, 0x63, 0x14, 0x4F, 0x32, 0x6D, 0x34, 0x02, 0xD5, 0xFF, 0xED, 0x81, 0x87, 0x8C, 0x03,
+    0xA6, 0x87, 0x81, 0xE2, 0x37, 0xE1, 0x80, 0x1C, 0x9E, 0x6D, 0xEB, 0x91, 0x49, 0x43, 0xAB, 0xDF,
+    0x4A, 0xB9, 0xF4, 0xAF, 0x34, 0x64, 0xED, 0xF8, 0x07, 0x89, 0x27, 0x9D, 0x6E, 0x7D, 0x2E, 0x97,
+    0xAF, 0x94, 0x72, 0xCD, 0xB4, 0x41, 0xC7, 0x46, 0x8A, 0xA4, 0x98, 0x31, 0xFC, 0x9B, 0x43, 0x9B,
+    0x61, 0x05, 0xAA, 0x9B, 0x1D, 0xD4, 0xA5, 0x87, 0xBA, 0xF0, 0x9B, 0x23, 0x73, 0xD3, 0x25, 0x28,
+    0xFA, 0x71, 0x8A, 0x2B, 0xE3, 0x13, 0x40, 0xCD, 0x04, 0xD9, 0x62, 0x02, 0x98, 0x20, 0x07, 0xAA,
+    0x26, 0xA8, 0x86, 0x33, 0xC0, 0xA7, 0x39, 0x96, 0xC2, 0xF1, 0xA7, 0x16, 0x57, 0x36, 0x7E, 0x1D,
+    0xF2, 0x69, 0x81, 0x22, 0x44, 0xA8, 0x5E, 0x9F, 0xC1, 0xEC, 0x07, 0x30, 0x85, 0x87, 0x2C, 0x73,
+    0x1F, 0xAB, 0xB8, 0x3E, 0x16, 0x01, 0xF4, 0x87, 0x02, 0x28, 0xE4, 0x9A, 0x89, 0x4A, 0x52, 0x87,
+    0x91, 0x66, 0x92, 0x91, 0x04, 0x5F, 0x09, 0x6C, 0x02, 0x0C, 0x9B, 0x60, 0x57, 0xF2, 0x51, 0xD6,
+    0x29, 0x1A, 0x36, 0xC3, 0x01, 0xE7, 0xF9, 0xA3, 0x6B, 0xB5, 0x9D, 0x39, 0xE1, 0x12, 0x16, 0x39,
+    0x78, 0x78, 0xF2, 0x4E, 0x46, 0xA0, 0x3E, 0xA0, 0xFE, 0x95, 0x1B, 0x6F, 0x57, 0x7D, 0xE8, 0xCA,
+    0x05, 0x60, 0xB1, 0x5D, 0x4A, 0x89, 0x30, 0x1E, 0x20, 0xEB, 0x72, 0xF7, 0x6E, 0xC5, 0x6D, 0x35,
+    0x95, 0x53, 0xAE, 0xD5, 0x2A, 0x54, 0x73, 0xAE, 0xA5, 0x56, 0x67, 0x22, 0x6D, 0x28, 0x84, 0x89,
+    0x34, 0xBE, 0x90, 0xAB, 0x17, 0xAC, 0xCF, 0xD4, 0x35, 0x69, 0xEB, 0x0C, 0x6F, 0x45, 0xEB, 0x90,
+    0xB7, 0x72, 0x3D, 0xF4, 0x43, 0xAB, 0x6E, 0x05, 0x3B, 0x5E, 0xEE, 0xFD, 0x02, 0x36, 0x44, 0x7B,
+    0x35, 0x42, 0xF3, 0xCB, 0x68, 0x5F, 0x9F, 0xC1, 0xFC, 0x66, 0x6E, 0xDE, 0x9E, 0xC0, 0xDC, 0x09,
+    0xE6, 0xB7, 0x01, 0x2A, 0x05, 0xA3, 0x11, 0x0A, 0x8D, 0x95, 0x06, 0x28, 0x34, 0x14, 0xF2, 0x90,
+    0xCB, 0x17, 0x9B, 0xE5, 0x3D, 0xDF, 0xEE, 0xB5, 0xA1, 0xE3, 0x7E, 0xEF, 0x24, 0x5E, 0x9F, 0xD6,
+    0x1B, 0x00, 0xD6, 0x08, 0xD0, 0x3C, 0x36, 0x00, 0xE5, 0x78, 0x26, 0x79, 0xF6, 0xDD, 0x3B, 0x97,
+    0xA6, 0x58, 0x0D, 0x56, 0x56, 0xDD, 0x5A, 0x68, 0x90, 0x37, 0xA1, 0x9C, 0xCA, 0x98, 0xCB, 0xF5,
+    0xD8, 0xC1, 0xCE, 0x66, 0xCC, 0xD7, 0x42, 0x3E, 0x52, 0x87, 0xA7, 0x62, 0xED, 0x91, 0xF9, 0xDE,
+    0xCB, 0x13, 0xD5, 0x34, 0xAD, 0x16, 0xEC, 0xF7, 0xAA, 0xB7, 0x47, 0x8A, 0x35, 0xB4, 0x97, 0xA1,
+    0x5E, 0x0B, 0x79, 0x90, 0xB7, 0x33, 0x98, 0x98, 0xBC, 0x6D, 0x9D, 0x39, 0xB2, 0xE6, 0x58, 0xB6,
+    0x26, 0x69, 0x23, 0x07, 0xCD, 0xB7, 0x03, 0x34, 0xDD, 0x37, 0x20, 0x77, 0x27, 0x8E, 0xAF, 0x0B,
+    0xA1, 0xD7, 0x25, 0xCD, 0x8D, 0x5E, 0xD2, 0x84, 0x3A, 0x13, 0x93, 0x84, 0x6B, 0x8F, 0x0D, 0x66,
+    0xA4, 0x58, 0xCB, 0x00, 0xFD, 0xFE, 0x04, 0xE6, 0x56, 0x84, 0x4C, 0x91, 0x44, 0x27, 0x7E, 0x57,
+    0x4E, 0xE9, 0x3B, 0x13, 0x4D, 0xFB, 0x5B, 0x90, 0x49, 0x01, 0x7A, 0xCD, 0x1B, 0xA1, 0x55, 0x61,
+    0x93, 0x07, 0x53, 0xDC, 0x09, 0x49, 0x5A, 0xD9, 0x6C, 0x3A, 0x72, 0x77, 0xD7, 0x31, 0xBD, 0xF2,
+    0xA8, 0xDE, 0x54, 0x34, 0x7A, 0x44, 0x9D, 0x09, 0xE5, 0x8A, 0xED, 0x4C, 0xCC, 0x22, 0xF5, 0x64,
+    0x02, 0x76, 0xDC, 0x64, 0x89, 0x22, 0x33, 0x90, 0xAF, 0x2D, 0x14, 0x9A, 0x37, 0x7E, 0xE5, 0x7A,
+    0xDD, 0x56, 0xA6, 0xED, 0x36, 0xB4, 0x61, 0x13, 0x92, 0x37, 0xF2, 0x54, 0x3F, 0x41, 0xAF, 0x8E,
+    0x4C, 0x13, 0xE4, 0xB7, 0x36, 0x19, 0xF7, 0xDF, 0x07, 0x13, 0xFA, 0x8E, 0x62, 0xB1, 0xE3, 0x46,
+    0xD9, 0x9D, 0x38, 0xCA, 0x2E, 0x26, 0x93, 0xAE, 0x69, 0xED, 0x35, 0xF6, 0x7A, 0x54, 0x43, 0xB1,
+    0x62, 0x03, 0xA2, 0x5C, 0x69, 0x41, 0xDE, 0x76, 0x98, 0xB9, 0xF6, 0xE4, 0x32, 0x03, 0xD8, 0x37,
+    0x03, 0x94, 0x0A, 0x80, 0xE6, 0xF7, 0x4B, 0xBD, 0x3D, 0x3C, 0x99, 0xEB, 0x06, 0x94, 0x92, 0xDF,
+    0xAE, 0x97, 0x00, 0x0C, 0x69, 0x5E, 0x17, 0x4A, 0xF9, 0x58, 0xC5, 0xEA, 0x8E, 0xAD, 0x94, 0xA5,
+    0xA4, 0xAB, 0x92, 0xA6, 0x5E, 0x5A, 0x9A, 0xAE, 0x5A, 0xAB, 0xA1, 0x54, 0x16, 0x12, 0xD5, 0xC0,
+    0x25, 0xD2, 0xAF, 0x3C, 0x68, 0x48, 0xF1, 0x00, 0x1B, 0xD2, 0x38, 0x68, 0x66, 0x9E, 0xA8, 0x23,
+    0xD6, 0x44, 0xEA, 0x1F, 0xAF, 0x98, 0xB7, 0x25, 0xCD, 0x4A, 0x54, 0xD8, 0x23, 0x83, 0xBB, 0xF0,
+    0x29, 0x80, 0xB0, 0xA6, 0xBE, 0xB2, 0xC9, 0x16, 0x3F, 0x26, 0x8E, 0xB5, 0x94, 0x62, 0xF3, 0x96,
+    0xC6, 0x17, 0x0A, 0xE5, 0xA3, 0x0D, 0x59, 0x2E, 0x47, 0x3D, 0x91, 0x6D, 0x12, 0x43, 0xE4, 0x3F,
+    0x57, 0x2D, 0x59, 0x68, 0x47, 0xB3, 0xAF, 0x8B, 0x32, 0x52, 0x6C, 0x0E, 0x9A, 0xE7, 0x36, 0xB1,
+    0x8D, 0x6D, 0x8E, 0x47, 0x39, 0x1F, 0x27, 0x73, 0xD7, 0x9B, 0x64, 0xD6, 0x97, 0x25, 0x4D, 0x57,
+    0x68, 0xE6, 0xC6, 0xD5, 0xB1, 0xF4, 0x26, 0x26, 0x3F, 0x5A, 0xB9, 0x49, 0x28, 0x29, 0xE4, 0x92,
+    0x6D, 0x72, 0xD8, 0xD2, 0x6C, 0xAF, 0x0D, 0x44, 0x1B, 0x68, 0x9B, 0x19, 0xFB, 0xA2, 0xA4, 0x37,
+    0x24, 0x4D, 0xAD, 0xB6, 0x81, 0x95, 0x1D, 0x07, 0x7D, 0x47, 0xB1, 0x26, 0x0F, 0xF5, 0x71, 0xA8,
+    0x5A, 0x4B, 0x63, 0x2B, 0x5D, 0x5B, 0x2F, 0xAD, 0x95, 0xB7, 0xE1, 0x81, 0x42, 0xDC, 0xDB, 0x4C,
+    0x64, 0x72, 0xD4, 0x29, 0x37, 0xC4, 0xC4, 0xBC, 0xEB, 0x87, 0xBA, 0x5C, 0x89, 0xF6, 0xF6, 0xA5,
+    0x20, 0xE9, 0xDA, 0x36, 0x15, 0xE3, 0xD9, 0x7C, 0xE4, 0xA9, 0x7C, 0xC6, 0xBC, 0x3E, 0x27, 0x0A,
+    0x71, 0x1D, 0xB7, 0xE1, 0x9A, 0x8F, 0xBB, 0x55, 0x59, 0xF7, 0x59, 0x6A, 0x17, 0xB1, 0xC6, 0xD3,
+    0x5E, 0x4E, 0x3D, 0xDE, 0x1F, 0x13, 0x69, 0x2B, 0x3D, 0x2D, 0xA9, 0xBA, 0xDD, 0xCF, 0x0D, 0xF2,
+    0x3F, 0x32, 0x11, 0xD7, 0x0F, 0x94, 0x0B, 0xB4, 0x23, 0x85, 0xC0, 0x86, 0xBB, 0x73, 0xB9, 0x27,
+    0xEB, 0xB9, 0x08, 0x7A, 0xAB, 0xDF, 0x97, 0x54, 0x49, 0xF3, 0xC6, 0x4B, 0x0D, 0xAD, 0xBA, 0x4A,
+    0x72, 0xED, 0x7F, 0x5D, 0x8A, 0x35, 0x0B, 0x66, 0xCA, 0x68, 0x3D, 0x99, 0x12, 0x9B, 0xA2, 0x0E,
+    0x7C, 0xB0, 0x8F, 0xD5, 0xEA, 0x52, 0xD2, 0xA3, 0x00, 0xFE, 0xAA, 0x98, 0x4C, 0xA8, 0x83, 0x19,
+    0xAB, 0x0E, 0x78, 0xD0, 0xBC, 0xB4, 0xD8, 0x6F, 0x8F, 0x5F, 0x07, 0xCE, 0xD3, 0xF8, 0x52, 0xAC,
+    0xB1, 0x79, 0xEC, 0xA7, 0xE3, 0x99, 0xFB, 0x71, 0xA7, 0xDC, 0xB7, 0xD6, 0x07, 0x7A, 0xFD, 0xE2,
+    0xDB, 0xCB, 0x7F, 0x7F, 0xCA, 0xB5, 0xBA, 0x29, 0xF5, 0x1A, 0xEF, 0xA5, 0xEA, 0xEE, 0xD6, 0xA3,
+    0x6F, 0x2A, 0xD6, 0x2B, 0x27, 0xB8, 0xFB, 0x91, 0xD8, 0xBE, 0x12, 0x3F, 0xEB, 0x80, 0xE6, 0x9B,
+    0xB3, 0xDD, 0x8F, 0x76, 0x3F, 0x7E, 0xF6, 0xEC, 0x8D, 0xEC, 0x9C, 0x8D, 0x6B, 0x3F, 0xDB, 0x27,
+    0xCE, 0x64, 0xD1, 0x8C, 0x65, 0x97, 0x03, 0x66, 0x3A, 0xB3, 0xFC, 0xE8, 0xCC, 0xDC, 0xBC, 0xF0,
+    0x40, 0x1B, 0x53, 0xE2, 0x23, 0x5F, 0x34, 0x2E, 0xDA, 0xEA, 0x57, 0xB3, 0x35, 0x57, 0xE7, 0x6F,
+    0x94, 0x57, 0xC7, 0xBB, 0x32, 0xEE, 0xCF, 0xBF, 0xE7, 0x2F, 0xF7, 0xF5, 0x33, 0x77, 0x82, 0x59,
+    0xB0, 0x5D, 0x9A, 0x7E, 0x4F, 0x7E, 0xB6, 0x08, 0xB1, 0x7A, 0x63, 0x36, 0xFB, 0xA1, 0x7E, 0x6C,
+    0xF8, 0xA2, 0x71, 0xF7, 0xDE, 0x95, 0xDF, 0xCA, 0x15, 0xDB, 0xFE, 0xA6, 0x6B, 0xF7, 0x32, 0x0F,
+    0x79, 0x17, 0x9B, 0x47, 0x42, 0x5B, 0x86, 0xF6, 0x9B, 0xD3, 0x89, 0x32, 0xDA, 0xAB, 0xB1, 0xBE,
+    0x36, 0xD9, 0xCA, 0xC3, 0x89, 0x62, 0xB1, 0xFB, 0x93, 0xFD, 0xD2, 0x6C, 0xFC, 0x19, 0x78, 0xD8,
+    0x9E, 0xF9, 0xC6, 0x93, 0x5F, 0xFF, 0x3B, 0x4E, 0xE4, 0xB1, 0xBE, 0x1A, 0x6D, 0x39, 0xFC, 0x35,
+    0x9B, 0x36, 0x9C, 0x72, 0x27, 0xB8, 0xD7, 0x5E, 0x8B, 0xA9, 0x0D, 0x9F, 0xE1, 0xD9, 0x6C, 0xAF,
+    0x9E, 0x1F, 0x7A, 0xF2, 0xC9, 0x87, 0x1F, 0x7A, 0xA8, 0x99, 0x76, 0xBA, 0x13, 0x45, 0x6C, 0x86,
+    0x58, 0xEF, 0x87, 0xFB, 0x39, 0x55, 0x2E, 0xCD, 0xF8, 0x94, 0xB9, 0x3E, 0x7D, 0x0E, 0x28, 0x87,
+    0xC6, 0x59, 0xAC, 0xB3, 0xD1, 0xCC, 0x70, 0xF2, 0xCA, 0x95, 0x2B, 0x57, 0xAE, 0x5C, 0xB9, 0x2F,
+    0x85, 0x7E, 0x32, 0xF9, 0x42, 0xC1, 0xBC, 0x3C, 0x37, 0xEE, 0x85, 0xCF, 0x70, 0xFF, 0xFD, 0x9C,
+    0xF6, 0xA6, 0x7F, 0xFE, 0x0D, 0xCD, 0xD5, 0x2D, 0xE0, 0x04, 0x8F, 0x2C, 0x7F, 0xD1, 0xDF, 0xF9,
+    0xC5, 0xCF, 0x96, 0xBF, 0x6F, 0x3A, 0xD8, 0x08, 0x78, 0x78, 0x47, 0xC3, 0x36, 0xE6, 0x78, 0x15,
+    0x30, 0x23, 0x8D, 0xC7, 0xC2, 0x17, 0xE0, 0x48, 0x4D, 0x4F, 0xF1, 0xEC, 0x0B, 0x95, 0xBF, 0x5C,
+    0x6D, 0xD6, 0x79, 0xF8, 0xB3, 0x0D, 0x19, 0x37, 0xE5, 0x6F, 0x4D, 0x90, 0xEB, 0x08, 0x5F, 0xE5,
+    0xE3, 0x4B, 0x84, 0x38, 0xB8, 0xF7, 0x7A, 0xA4, 0x5C, 0xB0, 0x99, 0x5C, 0x2A, 0xE3, 0xA6, 0x4C,
+    0x6C, 0x81, 0x83, 0xF2, 0xF9, 0x1B, 0xB0, 0xDD, 0x71, 0x4B, 0x0A, 0x64, 0xFA, 0x6E, 0x3F, 0x93,
+    0xC9, 0xD5, 0x91, 0x4C, 0xAE, 0x5A, 0x48, 0xC9, 0x49, 0x99, 0x5C, 0xB1, 0x2D, 0xCB, 0xB4, 0x1C,
+    0x68, 0x2E, 0x16, 0x5A, 0x4D, 0x65, 0x02, 0x63, 0xF3, 0x61, 0x4E, 0x6D, 0x3B, 0x02, 0x7F, 0x9B,
+    0x90, 0x44, 0xF2, 0x52, 0xEF, 0x1D, 0x89, 0x0E, 0x14, 0x9B, 0x84, 0x4A, 0xA3, 0x4D, 0x64, 0x60,
+    0xEF, 0xB8, 0x93, 0xE5, 0x45, 0x49, 0x61, 0x57, 0x8A, 0xE5, 0x42, 0x9F, 0xC9, 0x35, 0x5D, 0x3B,
+    0x94, 0x63, 0x3D, 0x65, 0xE1, 0x83, 0x93, 0x63, 0xB2, 0xFE, 0x56, 0xDA, 0x34, 0xE7, 0x70, 0x2F,
+    0x86, 0x2C, 0xA5, 0xCC, 0xC9, 0xDB, 0x75, 0x37, 0x56, 0x0B, 0xCD, 0x55, 0xB9, 0x2C, 0x36, 0x23,
+    0x66, 0x7F, 0x81, 0xE7, 0x5A, 0x0F, 0xD5, 0x72, 0xE1, 0x1C, 0x7D, 0x4A, 0xA1, 0x0A, 0xE8, 0x27,
+    0x17, 0x52, 0xE2, 0x47, 0x3F, 0x24, 0x55, 0xF5, 0x90, 0x9D, 0xA8, 0x5E, 0xD7, 0x98, 0xAF, 0x46,
+    0x6F, 0x69, 0xB0, 0x69, 0x9B, 0x88, 0x05, 0xEE, 0x3B, 0xFF, 0xF1, 0xF8, 0x83, 0x7F, 0x5F, 0xB2,
+    0xE5, 0x29, 0xF7, 0x9C, 0xDD, 0x5F, 0xDA, 0xFD, 0xC5, 0x5E, 0x8B, 0x77, 0x71, 0xE0, 0x04, 0x8A,
+    0x56, 0x31, 0x31, 0x87, 0x3F, 0xE0, 0xDF, 0x8E, 0x6E, 0xA4, 0x5F, 0x6D, 0x7E, 0x5F, 0x4A, 0xFE,
+    0xB4, 0xF6, 0x3E, 0x3C, 0x47, 0xAF, 0x4E, 0x1C, 0xBD, 0x26, 0x39, 0xDE, 0x7B, 0x4F, 0x33, 0x53,
+    0x8B, 0x42, 0x3E, 0xD1, 0x2C, 0x8E, 0xA4, 0xCF, 0xF8, 0x83, 0xB7, 0xD3, 0x29, 0x24, 0x5D, 0x4C,
+    0x66, 0x06, 0x8A, 0xF0, 0xFE, 0x6F, 0x65, 0x30, 0x5A, 0xD3, 0x9B, 0x46, 0xAA, 0xD1, 0x48, 0x11,
+    0x33, 0x98, 0xB9, 0x5A, 0x30, 0xDE, 0xCC, 0xC5, 0x4A, 0xBD, 0xD9, 0xB6, 0xAB, 0x33, 0x73, 0xAE,
+    0x7B, 0x5B, 0x67, 0xE6, 0x62, 0x7D, 0x58, 0x98, 0xD9, 0xC4, 0x76, 0x61, 0x57, 0x9A, 0xFB, 0xB9,
+    0x90, 0x34, 0xD8, 0xB1, 0x90, 0x16, 0x4E, 0xBC, 0x03, 0xA1, 0xC7, 0x26, 0xD1, 0x85, 0x2A, 0x09,
+    0x76, 0x67, 0x76, 0x17, 0x28, 0x17, 0x8A, 0x35, 0x8D, 0x37, 0x75, 0xD0, 0x0E, 0xD8, 0x11, 0xEA,
+    0x09, 0x33, 0x1F, 0xF9, 0x52, 0xD2, 0xBA, 0x47, 0x2B, 0x49, 0xEA, 0x6A, 0x49, 0xD2, 0x5C, 0xAE,
+    0x17, 0xBE, 0xB2, 0x3E, 0xAE, 0xB3, 0x29, 0xE5, 0x71, 0x6C, 0x07, 0xEC, 0x68, 0x62, 0x3D, 0x61,
+    0xE6, 0x5C, 0xE9, 0x97, 0x7A, 0x5A, 0x0E, 0x75, 0xFD, 0xD5, 0x7E, 0xA6, 0x97, 0xDE, 0x90, 0xAE,
+    0x49, 0x1A, 0xA5, 0xD0, 0xBF, 0x33, 0x84, 0x9C, 0x24, 0x36, 0x6F, 0xB7, 0xEA, 0xD9, 0x6C, 0xDC,
+    0x93, 0xA6, 0x3E, 0xB1, 0x5C, 0x8A, 0x40, 0x11, 0xEA, 0x64, 0x82, 0xB4, 0x03, 0x07, 0xB3, 0x9F,
+    0x72, 0xF9, 0xDA, 0x8D, 0xB4, 0x4A, 0x2F, 0x69, 0xC1, 0x5C, 0x20, 0xD3, 0xCF, 0xDB, 0x08, 0xE5,
+    0x82, 0x0D, 0x50, 0x4F, 0xF4, 0x03, 0x69, 0x8C, 0x91, 0xC6, 0xD9, 0x86, 0x90, 0x4A, 0xBB, 0xD0,
+    0xDF, 0xC2, 0x68, 0xAD, 0x15, 0x69, 0x35, 0xF5, 0x87, 0x9E, 0x9F, 0xBB, 0x0F, 0xF8, 0x22, 0xCD,
+    0xB4, 0xB5, 0x95, 0x9A, 0x1B, 0xDB, 0xAC, 0x85, 0x2D, 0xA0, 0xDA, 0xB3, 0x8A, 0xC5, 0x6A, 0xB4,
+    0xE4, 0xF2, 0xBB, 0x73, 0xA6, 0x50, 0x46, 0xF4, 0xA3, 0x4C, 0xB4, 0x8E, 0xD6, 0xDB, 0x8E, 0x3A,
+    0xD4, 0x9E, 0x32, 0x9A, 0x81, 0x4C, 0x97, 0xC6, 0xCD, 0xB6, 0x2D, 0xB5, 0xD4, 0x51, 0xC6, 0x3A,
+    0x90, 0xA9, 0x10, 0xB4, 0xBE, 0x1D, 0xA9, 0x83, 0x89, 0x94, 0x31, 0x4B, 0xE4, 0xC9, 0x98, 0xF5,
+    0x73, 0xA1, 0x67, 0xA4, 0xAE, 0x9D, 0xA5, 0xB1, 0x52, 0x77, 0x18, 0x02, 0x84, 0x92, 0x03, 0x72,
+    0x6C, 0x02, 0xA7, 0xB9, 0x06, 0x20, 0xEB, 0xFD, 0x51, 0x0B, 0xF2, 0x90, 0x9B, 0x2A, 0xDD, 0xD4,
+    0x5A, 0x48, 0xFF, 0x4A, 0x5D, 0xA6, 0xA1, 0x8C, 0xE4, 0xA2, 0x0E, 0x98, 0x48, 0xEB, 0x51, 0xC8,
+    0x84, 0x91, 0x2F, 0x23, 0x12, 0x75, 0x30, 0x77, 0x22, 0xAD, 0x5F, 0x9B, 0x90, 0xC9, 0x8C, 0xBD,
+    0x2F, 0x97, 0x35, 0x17, 0xB5, 0xC6, 0x2A, 0xD2, 0xAE, 0x34, 0x21, 0xD3, 0x48, 0xEF, 0xCB, 0x75,
+    0x73, 0x93, 0x2A, 0x66, 0xFD, 0x0D, 0xDA, 0x5B, 0x56, 0xD1, 0x68, 0x95, 0x46, 0xAB, 0x39, 0xE5,
+    0x42, 0x54, 0x63, 0xDD, 0x91, 0xC7, 0x6A, 0x04, 0x7B, 0x73, 0x82, 0x52, 0x13, 0x87, 0x41, 0xEB,
+    0xF4, 0xEA, 0x15, 0x5A, 0xDD, 0xD4, 0x5C, 0xEB, 0x35, 0x8D, 0xF4, 0xBE, 0x9E, 0x69, 0x7C, 0x21,
+    0xCC, 0x88, 0x1D, 0xAB, 0x40, 0x15, 0x8B, 0x09, 0x74, 0x36, 0x42, 0x33, 0x2E, 0xA4, 0xD4, 0x64,
+    0xFA, 0xDE, 0x6D, 0xA8, 0xA1, 0x79, 0xC2, 0xE6, 0xE3, 0xC6, 0x3C, 0xC9, 0x8A, 0x19, 0x8A, 0x97,
+    0x23, 0x64, 0x69, 0x3C, 0x2C, 0x07, 0xD9, 0xBE, 0xE7, 0x8F, 0x26, 0x81, 0x1A, 0xA5, 0x81, 0xF8,
+    0x5A, 0x3F, 0x66, 0x1A, 0xCB, 0x85, 0x32, 0xD2, 0x0E, 0xB4, 0xFE, 0x0F, 0x3F, 0x3C, 0x2D, 0x49,
+    0xDF, 0xD1, 0xC1, 0x6B, 0x4C, 0xCC, 0xD5, 0x44, 0xC3, 0x2A, 0x66, 0xB6, 0x19, 0xD5, 0x79, 0x80,
+    0x63, 0xC9, 0xF5, 0x50, 0x25, 0x1E, 0x6C, 0x33, 0x80, 0xD2, 0xEE, 0x28, 0xA5, 0xFF, 0x28, 0x72,
+    0x17, 0x4F, 0x6E, 0x06, 0x88, 0x16, 0xD8, 0xE9, 0x87, 0xB4, 0xC4, 0x54, 0x52, 0xA0, 0xD7, 0x9A,
+    0xE6, 0x53, 0xDA, 0x10, 0xE4, 0x9A, 0x5C, 0xB9, 0x6E, 0xB2, 0xCB, 0x4A, 0xFD, 0x54, 0xAE, 0x1D,
+    0xCD, 0x5C, 0x2E, 0xC8, 0xB7, 0x83, 0x89, 0xE5, 0x42, 0xEF, 0xDB, 0xA1, 0x3A, 0x7E, 0xB0, 0xAF,
+    0x68, 0xE6, 0x56, 0x9D, 0xDC, 0xA1, 0xBD, 0x86, 0x1D, 0x12, 0x90, 0x6E, 0xB5, 0xE1, 0x73, 0x9F,
+    0xDE, 0x2C, 0x90, 0x9F, 0x85, 0x22, 0x40, 0x0F, 0x66, 0x24, 0x9F, 0xD3, 0x7E, 0x2B, 0xEE, 0x88,
+    0x0E, 0xB8, 0x29, 0x2D, 0xF5, 0x7A, 0x69, 0x50, 0xB7, 0x98, 0xB9, 0xF2, 0xEA, 0x5E, 0x30, 0x73,
+    0xC6, 0x91, 0xEC, 0xF5, 0xCD, 0xDB, 0x42, 0xA5, 0x05, 0x69, 0x80, 0x9D, 0x7F, 0xA0, 0xD6, 0x5C,
+    0x49, 0xAF, 0xE9, 0x4B, 0xAB, 0xF5, 0xD5, 0x4F, 0x67, 0xEE, 0xEF, 0x1D, 0x46, 0x42, 0x0A, 0x66,
+    0xBD, 0x88, 0xBA, 0x94, 0x3F, 0x18, 0xF8, 0x9F, 0xA4, 0xB5, 0x96, 0x86, 0x46, 0x13, 0xF7, 0x9D,
+    0xFB, 0xFD, 0x23, 0x4B, 0xE7, 0xB0, 0x63, 0x29, 0xDA, 0xB0, 0xF5, 0xEC, 0x65, 0xAE, 0x59, 0x4B,
+    0x8D, 0xA7, 0xDF, 0x9B, 0x66, 0x6F, 0xC7, 0x52, 0x8F, 0x68, 0xB5, 0x1A, 0x21, 0x8B, 0xF5, 0x8B,
+    0x93, 0xDA, 0x57, 0x96, 0xFF, 0x2D, 0x1F, 0x3F, 0x7C, 0xC6, 0x00, 0x27, 0x28, 0x22, 0xFD, 0x58,
+    0x1D, 0x72, 0xE0, 0xCF, 0x97, 0xF2, 0x7D, 0xCC, 0xE5, 0xCB, 0x48, 0xFB, 0x3B, 0x8B, 0xBE, 0xAB,
+    0xA7, 0x52, 0xA5, 0x7C, 0x3B, 0x1D, 0x6C, 0xAC, 0x64, 0xB6, 0xFE, 0xF0, 0x19, 0xEA, 0x9F, 0x0B,
+    0x68, 0x8A, 0x08, 0xBC, 0x60, 0x02, 0x14, 0xC1, 0xBE, 0xB5, 0x87, 0xF1, 0xD2, 0x84, 0x2D, 0xD6,
+    0x3E, 0x64, 0xB3, 0x09, 0x76, 0xA8, 0x06, 0xEB, 0x7B, 0x67, 0x51, 0xBE, 0xFC, 0x8F, 0xB1, 0x88,
+    0xE6, 0x37, 0x1A, 0xEA, 0x5F, 0xF7, 0x3F, 0x56, 0x2E, 0x2D, 0x75, 0x30, 0x52, 0x77, 0xE2, 0x98,
+    0x66, 0x37, 0x0A, 0x68, 0x35, 0x1A, 0xA9, 0xE7, 0x4C, 0x60, 0xA6, 0xE3, 0xE5, 0x45, 0x67, 0x24,
+    0x29, 0x18, 0x49, 0x97, 0xA2, 0xB9, 0x7D, 0x51, 0xC5, 0x62, 0xA6, 0x4C, 0xF9, 0x91, 0xB2, 0x58,
+    0xCC, 0x9C, 0xEB, 0xF1, 0xD8, 0xCB, 0x48, 0x93, 0x64, 0x0E, 0x97, 0x90, 0xF7, 0xCD, 0xED, 0x89,
+    0x29, 0x9B, 0x2D, 0x91, 0x4B, 0x13, 0x7F, 0xBC, 0x1F, 0x68, 0x6F, 0x6A, 0xCC, 0x24, 0xF9, 0x52,
+    0x3F, 0x55, 0x57, 0xCF, 0x1F, 0x2E, 0xB7, 0x67, 0xD3, 0xDD, 0xC3, 0xC6, 0x4F, 0x53, 0x6D, 0x33,
+    0xC9, 0x9A, 0x0E, 0xB2, 0xF1, 0x58, 0x0E, 0x61, 0xE6, 0xA4, 0x4C, 0x46, 0xA3, 0x0D, 0xF5, 0x64,
+    0x84, 0xCE, 0x2E, 0x98, 0xC9, 0x3A, 0xF4, 0xE8, 0x88, 0x59, 0x23, 0x48, 0x01, 0xF3, 0x6B, 0x39,
+    0xF4, 0x68, 0xC4, 0x4C, 0x76, 0x44, 0x67, 0xE5, 0xCC, 0x64, 0x62, 0xA5, 0x60, 0x83, 0xD6, 0x4C,
+    0xDD, 0x21, 0xF4, 0x7E, 0x70, 0xCB, 0x8E, 0x30, 0x61, 0x8B, 0x53, 0xCD, 0xC8, 0x3B, 0xCD, 0x61,
+    0xC0, 0x28, 0xF4, 0xB2, 0x7A, 0x5A, 0xB1, 0x9E, 0x10, 0x76, 0x48, 0x5B, 0x01, 0x85, 0x62, 0x29,
+    0xE5, 0xCD, 0xD4, 0x0B, 0xFB, 0xEA, 0x1B, 0x11, 0xAD, 0x26, 0x14, 0x1A, 0xAD, 0x37, 0x2B, 0xC2,
+    0x8E, 0x45, 0x44, 0xAE, 0x9E, 0x1A, 0x3D, 0xAD, 0xA8, 0xB5, 0x52, 0xE0, 0x5E, 0x1C, 0x45, 0x30,
+    0x1E, 0x33, 0xB4, 0x9B, 0xBD, 0x80, 0xAC, 0x3C, 0xFC, 0xE5, 0x3F, 0x7D, 0x2C, 0x7B, 0x01, 0x6D,
+    0x34, 0xE4, 0x60, 0x7D, 0x4A, 0x56, 0xB5, 0x1A, 0xA0, 0x8F, 0x07, 0x7B, 0x01, 0xA5, 0xA6, 0x49,
+    0x92, 0xD1, 0x6B, 0xEA, 0x9A, 0x60, 0xE6, 0x5C, 0x7C, 0xA0, 0x83, 0xB7, 0xFA, 0xA9, 0xDF, 0xAA,
+    0xE4, 0x44, 0xF3, 0xB7, 0xDD, 0x26, 0xED, 0xA0, 0x76, 0x1B, 0x47, 0xC9, 0x0E, 0x70, 0xF1, 0xE2,
+    0x1E, 0x49, 0xAD, 0xEC, 0xAE, 0x9B, 0x51, 0xF3, 0xB5, 0xE7, 0xD7, 0x8B, 0xCF, 0x4A, 0x4A, 0x4F,
+    0x0E, 0xB1, 0x8C, 0x45, 0x2A, 0xE6, 0x32, 0x16, 0xE3, 0xBD, 0x65, 0xCC, 0x1C, 0xE5, 0x72, 0x0E,
+    0x4A, 0x69, 0x8F, 0x52, 0x9A, 0x29, 0x97, 0xDD, 0x85, 0x32, 0x16, 0xA2, 0x8C, 0xB9, 0x12, 0x6F,
+    0x66, 0x73, 0x54, 0x2E, 0xD4, 0x52, 0x4C, 0xF4, 0x92, 0xC3, 0x0D, 0x21, 0xB2, 0xBF, 0xDE, 0x28,
+    0xE9, 0x5A, 0x0E, 0xFE, 0xBB, 0x65, 0xEB, 0x1B, 0x6E, 0x06, 0x0A, 0x49, 0x93, 0x91, 0xE4, 0xED,
+    0x57, 0x6F, 0xB5, 0x4C, 0xCD, 0xF0, 0x64, 0x3E, 0xF4, 0x67, 0xC7, 0x14, 0x55, 0xA8, 0xD6, 0xEF,
+    0x6F, 0x02, 0x59, 0xFD, 0xF3, 0x2B, 0xF9, 0x52, 0x46, 0xAA, 0xC9, 0x04, 0x9A, 0xA1, 0xF5, 0xE8,
+    0xD1, 0x25, 0xED, 0xC1, 0x20, 0xDD, 0xFA, 0x60, 0xF4, 0xAD, 0xF5, 0x90, 0xBE, 0xE5, 0xC9, 0xB5,
+    0x7B, 0xFB, 0xE2, 0xC5, 0xFE, 0x55, 0x6D, 0xF2, 0xB8, 0x95, 0x28, 0x7B, 0xEF, 0x41, 0xDF, 0xAA,
+    0x62, 0xA9, 0xAE, 0x5A, 0x8E, 0xD2, 0xB7, 0x5A, 0xCD, 0x5B, 0x97, 0xFF, 0x51, 0x6A, 0xD6, 0xD4,
+    0x4C, 0xD6, 0x57, 0xB1, 0xED, 0x8A, 0xD8, 0xBB, 0x62, 0xD1, 0xC5, 0xE7, 0x17, 0x49, 0x8B, 0xBE,
+    0xFB, 0x95, 0x45, 0xAE, 0x88, 0x7D, 0x57, 0xC4, 0x76, 0xA8, 0x26, 0x3B, 0x37, 0xEF, 0xA2, 0x66,
+    0xED, 0x3C, 0x2D, 0x0D, 0xE8, 0xBA, 0x84, 0xD1, 0xA3, 0x1A, 0xE8, 0x97, 0x52, 0x14, 0xEB, 0x0F,
+    0xCD, 0x42, 0x3D, 0xD2, 0xCC, 0xF4, 0x0E, 0x1B, 0x8A, 0x08, 0xFD, 0x60, 0x46, 0x32, 0x75, 0x3D,
+    0x14, 0x2A, 0x22, 0x54, 0x8B, 0x19, 0xC1, 0xCC, 0x2D, 0xD0, 0xFC, 0x2A, 0x02, 0xED, 0x8B, 0x03,
+    0xA0, 0x1E, 0xC8, 0x37, 0xA4, 0xCA, 0x94, 0xD7, 0xC9, 0x81, 0x5B, 0xDC, 0x1E, 0xCD, 0xC2, 0xCD,
+    0xCE, 0xB5, 0x1A, 0xAA, 0x68, 0xE5, 0xEB, 0xC5, 0xAC, 0xD8, 0x58, 0xAC, 0xB4, 0x3F, 0x2A, 0x44,
+    0x4F, 0x82, 0xA9, 0x7A, 0x3A, 0x42, 0x7F, 0x6D, 0x06, 0xBB, 0x1F, 0xA0, 0x79, 0x33, 0x6C, 0x54,
+    0x92, 0x91, 0xDF, 0x8C, 0xF5, 0x42, 0x6C, 0x76, 0x03, 0xDB, 0xB8, 0xB5, 0x3E, 0x03, 0x18, 0x6F,
+    0x21, 0xCD, 0x30, 0xCC, 0xED, 0xE4, 0x5C, 0x9C, 0x39, 0xC6, 0x38, 0x3C, 0x92, 0x51, 0x3A, 0x4B,
+    0xA3, 0xD5, 0x74, 0x7A, 0xA5, 0x94, 0x4B, 0x50, 0xAE, 0x8C, 0x14, 0xA2, 0x8C, 0x18, 0x51, 0x46,
+    0xAC, 0x48, 0x58, 0xAE, 0x8C, 0xC5, 0x2A, 0xCA, 0x68, 0x5E, 0x17, 0x65, 0xB4, 0xDF, 0x14, 0x09,
+    0xCC, 0x95, 0x9A, 0x73, 0x51, 0x6A, 0xCC, 0x45, 0xA9, 0x2E, 0x17, 0x09, 0xCD, 0xA5, 0xBB, 0x9D,
+    0x5E, 0x5D, 0xA9, 0x67, 0x53, 0xF6, 0xA4, 0x34, 0x6E, 0x4C, 0xA7, 0xB4, 0x55, 0x64, 0xF2, 0x52,
+    0x27, 0x7B, 0xA7, 0xE9, 0x0E, 0x7C, 0xD5, 0x7C, 0x71, 0x93, 0x5D, 0x6A, 0x89, 0x9B, 0xDD, 0x56,
+    0xEC, 0xF5, 0x19, 0x6A, 0x05, 0x52, 0x46, 0xCB, 0x11, 0x33, 0xE4, 0x9B, 0x8A, 0x56, 0x5F, 0xD2,
+    0x5C, 0x2E, 0xB4, 0xBE, 0x88, 0xF4, 0xBE, 0x88, 0xB9, 0x7C, 0x11, 0x2B, 0xF9, 0x22, 0x36, 0xF2,
+    0x45, 0xBC, 0x62, 0x7D, 0xA1, 0xC9, 0xFA, 0x42, 0x83, 0xF5, 0x85, 0x9C, 0xF5, 0xC5, 0x82, 0xF5,
+    0xE5, 0x42, 0xFB, 0xFF, 0x5A, 0x7D, 0x53, 0x8B, 0xD5, 0x33, 0xC9, 0xB0, 0x8A, 0x5B, 0x95, 0x58,
+    0x06, 0xA0, 0x1C, 0x38, 0x86, 0x99, 0x0A, 0x29, 0x6D, 0x38, 0xCB, 0xEE, 0x9C, 0x2C, 0x86, 0x62,
+    0x43, 0xEA, 0x4A, 0xA6, 0x76, 0xA6, 0x0D, 0x91, 0x33, 0x93, 0x56, 0x6A, 0x29, 0x66, 0x72, 0xFD,
+    0x58, 0x4F, 0x85, 0x32, 0xB9, 0x26, 0xD4, 0x53, 0xAE, 0x4C, 0xCE, 0x8E, 0xF5, 0x54, 0x2D, 0x3B,
+    0x92, 0x9E, 0x91, 0x34, 0x1E, 0x6C, 0x6A, 0x92, 0x9D, 0x27, 0x53, 0xC0, 0xC8, 0xB3, 0xA3, 0xCD,
+    0xCE, 0xE4, 0x29, 0x9D, 0xB4, 0xD6, 0xBA, 0xFD, 0x88, 0xF5, 0xA0, 0x8B, 0xAE, 0x90, 0x46, 0xB3,
+    0x6A, 0xB0, 0xBE, 0xF7, 0xCA, 0x54, 0xC4, 0x32, 0x9A, 0xD0, 0x84, 0xF6, 0xBF, 0xE8, 0xAB, 0xD2,
+    0xDC, 0x6F, 0x15, 0xC1, 0x85, 0x0B, 0x58, 0x69, 0x36, 0x92, 0xFC, 0xEE, 0x6D, 0xC5, 0x32, 0x16,
+    0xCA, 0x44, 0x3B, 0xB4, 0xDE, 0x4C, 0x75, 0x28, 0x96, 0x32, 0xFE, 0x7B, 0x65, 0xAA, 0xE5, 0xDB,
+    0x57, 0xE4, 0x37, 0x1B, 0x95, 0xF8, 0x4C, 0xFF, 0xF9, 0x05, 0x5A, 0x7F, 0x0F, 0x75, 0xD8, 0xEE,
+    0xE9, 0x06, 0x59, 0xFF, 0xCF, 0x47, 0x1D, 0x08, 0xE7, 0x77, 0x5C, 0xA1, 0xEF, 0xC8, 0xF7, 0x92,
+    0x76, 0x24, 0x4D, 0xE5, 0x9A, 0xAB, 0x6B, 0xBD, 0x79, 0xF7, 0xD6, 0x71, 0xB1, 0x8C, 0xF7, 0xF7,
+    0x5D, 0xBB, 0xFF, 0xE2, 0x54, 0xC6, 0x46, 0xB4, 0x6F, 0x69, 0x28, 0xA5, 0x89, 0x56, 0x2B, 0xE5,
+    0x72, 0x7E, 0xA2, 0xF5, 0x65, 0x77, 0xB0, 0x87, 0x5C, 0xAD, 0x2E, 0x6D, 0xEA, 0xFD, 0xF9, 0x8B,
+    0x09, 0xE5, 0x4D, 0x50, 0x8C, 0xC9, 0x7A, 0xDA, 0xEA, 0xDC, 0xD7, 0x7A, 0xE9, 0xAC, 0x1C, 0xE5,
+    0x92, 0x24, 0xDF, 0x0E, 0x64, 0x1F, 0xE8, 0xE3, 0xEE, 0xEA, 0x8C, 0x94, 0x52, 0x46, 0xA8, 0xD2,
+    0x8E, 0x16, 0x91, 0x8D, 0x2D, 0xAA, 0xD7, 0xF4, 0xD6, 0x73, 0x76, 0xC4, 0xCC, 0x14, 0x2B, 0xA8,
+    0xE3, 0x5D, 0x1F, 0x16, 0x1A, 0x4D, 0xDB, 0x6D, 0xDA, 0x8A, 0xB4, 0x19, 0xAB, 0xE4, 0x77, 0x53,
+    0x5F, 0x37, 0xBE, 0x9E, 0xF2, 0x39, 0x93, 0xAB, 0xBB, 0x7A, 0xCA, 0x42, 0x1A, 0x0F, 0x13, 0x58,
+    0x29, 0xED, 0x79, 0x79, 0x70, 0xE6, 0xDD, 0x07, 0x3B, 0xBA, 0xB1, 0x1D, 0x60, 0xF1, 0x00, 0xBE,
+    0xBE, 0x21, 0xE9, 0x69, 0xBD, 0xB5, 0x16, 0x6B, 0x3E, 0x99, 0xB9, 0x1C, 0xEC, 0x58, 0xA3, 0x8E,
+    0x56, 0x13, 0x97, 0xD6, 0x3D, 0xEC, 0x08, 0xDA, 0xF8, 0xB1, 0x17, 0x97, 0x4B, 0xDD, 0xD1, 0xAA,
+    0xCD, 0x46, 0xD2, 0xB0, 0x23, 0xC9, 0x95, 0x0B, 0x0B, 0xF5, 0x94, 0x07, 0xDA, 0xA1, 0xF2, 0x47,
+    0xB2, 0x63, 0x6E, 0x5F, 0x71, 0xB4, 0x4A, 0x00, 0x26, 0x94, 0xEB, 0xBF, 0xD6, 0x58, 0x4F, 0x99,
+    0x7C, 0x3B, 0xE4, 0x3A, 0x2B, 0x57, 0xAC, 0xE5, 0x82, 0x99, 0xEB, 0x09, 0xFB, 0x5A, 0x3F, 0xA1,
+    0x5E, 0x73, 0xB1, 0x48, 0x63, 0x1D, 0x36, 0x7E, 0xFB, 0x72, 0x49, 0xBE, 0xAD, 0xEC, 0xD2, 0xBA,
+    0x51, 0x4E, 0xA7, 0x6F, 0x1C, 0x54, 0x7E, 0x94, 0x34, 0xD4, 0xBF, 0x7E, 0x7C, 0x30, 0xA1, 0xF0,
+    0x26, 0x14, 0x9D, 0x09, 0x60, 0x6E, 0xFF, 0x00, 0x23, 0x0D, 0x46, 0x9A, 0x4D, 0x30, 0xD1, 0x84,
+    0x62, 0x35, 0x21, 0x97, 0x99, 0x72, 0xF5, 0xCA, 0xA4, 0x35, 0x53, 0x0A, 0x7F, 0x17, 0xCB, 0x66,
+    0x0E, 0x4C, 0x64, 0xFD, 0x48, 0xA5, 0x8E, 0xFC, 0x9F, 0x36, 0xFB, 0xB9, 0xED, 0xB8, 0x32, 0x66,
+    0x92, 0xB7, 0xA3, 0x51, 0x2E, 0x75, 0x7D, 0x30, 0x72, 0xBB, 0x73, 0xA6, 0x50, 0xF5, 0xDE, 0x84,
+    0x62, 0x1D, 0x31, 0xA3, 0x09, 0xE5, 0x04, 0x65, 0x30, 0xC1, 0x8C, 0x50, 0xCC, 0x26, 0xD4, 0x1E,
+    0x88, 0x26, 0x58, 0x07, 0xF4, 0x97, 0x6E, 0xAF, 0x5B, 0x4F, 0x01, 0x1B, 0xB7, 0x44, 0x07, 0xC5,
+    0x6A, 0x42, 0xEB, 0xC1, 0x44, 0x13, 0x6C, 0x80, 0x7A, 0x36, 0xA1, 0x9E, 0xC1, 0x06, 0x13, 0xCC,
+    0x02, 0x1A, 0x4D, 0x28, 0x45, 0x2E, 0x6F, 0x42, 0x21, 0x5F, 0xC9, 0x35, 0x2B, 0x1A, 0x9B, 0x35,
+    0x97, 0xBA, 0x76, 0x6E, 0xE7, 0x42, 0xEA, 0x1A, 0x25, 0xBB, 0x34, 0xDF, 0xFA, 0x21, 0xB7, 0x3A,
+    0x7A, 0x1B, 0xB8, 0x7F, 0x61, 0xF3, 0xBE, 0xCD, 0xA1, 0x79, 0x28, 0x77, 0xC0, 0x67, 0x50, 0xA6,
+    0xD9, 0x4C, 0xCD, 0x5C, 0xEB, 0x4B, 0x7A, 0x5A, 0x83, 0xF5, 0xED, 0x44, 0x5F, 0x44, 0x33, 0x92,
+    0x4F, 0xF6, 0x6A, 0x04, 0xB3, 0x1F, 0x2D, 0xD0, 0xF7, 0x37, 0xC7, 0x04, 0xB6, 0x1D, 0xC5, 0xDA,
+    0xFE, 0x34, 0x42, 0xBF, 0x1F, 0xED, 0x88, 0x99, 0xEC, 0x55, 0x51, 0xA8, 0x88, 0x26, 0xD2, 0x0F,
+    0xD6, 0xB7, 0x63, 0x33, 0xD7, 0xFA, 0xA6, 0xBE, 0xA5, 0x5C, 0x53, 0xB5, 0x9E, 0x70, 0x5B, 0x78,
+    0xB4, 0xAD, 0x4C, 0x8A, 0xC3, 0x6E, 0x6A, 0xB4, 0xD5, 0x76, 0xFF, 0x3F, 0xD5, 0xBC, 0x4B, 0xAC,
+    0x26, 0xC7, 0x75, 0xE7, 0xF9, 0xCB, 0x0C, 0x56, 0xA5, 0x87, 0x39, 0xED, 0xE0, 0x82, 0xE5, 0x47,
+    0xB1, 0xE5, 0xD4, 0x62, 0x16, 0xDD, 0x6A, 0x9B, 0xE9, 0x85, 0x16, 0xC2, 0x40, 0x64, 0x24, 0x55,
+    0x0B, 0x02, 0x43, 0xCC, 0xB0, 0xD0, 0xC3, 0xDB, 0x82, 0x2D, 0x0C, 0xCA, 0x18, 0x68, 0x80, 0x31,
+    0xDD, 0x83, 0x32, 0x06, 0xC2, 0xC0, 0x06, 0x24, 0x66, 0x52, 0x04, 0x9A, 0x0B, 0x2E, 0x78, 0xA7,
+    0x47, 0x82, 0x81, 0xD6, 0x42, 0x04, 0x86, 0x46, 0x8B, 0x1F, 0x3D, 0x53, 0x1E, 0xC0, 0x0B, 0x2E,
+    0x58, 0x95, 0xC1, 0x2A, 0x74, 0x13, 0x68, 0x2E, 0x98, 0x24, 0xED, 0xE1, 0x82, 0x0B, 0xA6, 0x44,
+    0xCA, 0x74, 0x93, 0x80, 0x19, 0x14, 0x93, 0x52, 0xD6, 0xAD, 0xC8, 0xFC, 0xCF, 0x22, 0xF2, 0xBB,
+    0x75, 0x8B, 0x7A, 0x58, 0x0F, 0x77, 0x1B, 0x93, 0xB8, 0x37, 0x32, 0xBF, 0xC8, 0x47, 0xBC, 0x4E,
+    0x9C, 0x38, 0xE7, 0x7F, 0xCE, 0x09, 0xCE, 0x3E, 0x4D, 0xD6, 0x2B, 0xE4, 0x92, 0xE8, 0xBF, 0xDE,
+    0x8F, 0xAE, 0xB3, 0xD1, 0x0E, 0x99, 0xF2, 0x40, 0xEB, 0xEF, 0xA4, 0x1E, 0xC1, 0x06, 0xCE, 0x5E,
+    0x9A, 0x28, 0xB4, 0x80, 0x34, 0x72, 0xEA, 0xE2, 0x02, 0x99, 0x3C, 0xB8, 0xF0, 0x47, 0xD8, 0xD8,
+    0x62, 0xE4, 0x42, 0xAE, 0x07, 0xF4, 0x27, 0xF2, 0x92, 0x7C, 0x29, 0x35, 0x9C, 0xB9, 0x02, 0x54,
+    0x1D, 0x98, 0x11, 0x34, 0x83, 0x8B, 0x50, 0x46, 0xD2, 0xF1, 0x2B, 0x87, 0xD4, 0x0A, 0x56, 0xBA,
+    0xBA, 0x3C, 0xB0, 0xFC, 0x06, 0x6E, 0xC0, 0x44, 0x68, 0xBB, 0x42, 0x81, 0x56, 0x5D, 0xF6, 0x85,
+    0x15, 0xEA, 0x0F, 0xC6, 0x4C, 0xAE, 0xA9, 0x3F, 0x5C, 0xBF, 0xB0, 0x38, 0xA9, 0xE9, 0xD5, 0x51,
+    0x79, 0xF8, 0x32, 0x59, 0xE9, 0x71, 0x33, 0x46, 0x70, 0xB6, 0x03, 0xC8, 0x0E, 0x9D, 0xA2, 0x59,
+    0xAD, 0x96, 0x5C, 0xFE, 0xE2, 0x9C, 0x29, 0x14, 0x11, 0x3D, 0x97, 0x89, 0xB6, 0xA1, 0xF5, 0xAE,
+    0xA3, 0x0A, 0x95, 0xA7, 0x88, 0x76, 0x20, 0xD3, 0xA5, 0x11, 0x5A, 0x45, 0xA8, 0xA4, 0x8E, 0x22,
+    0x56, 0x81, 0x4C, 0x46, 0xD0, 0xFA, 0x76, 0xA4, 0x0A, 0x36, 0x52, 0xC4, 0x4C, 0x3E, 0x13, 0x2E,
+    0x66, 0xFD, 0x6C, 0xF4, 0x98, 0xD4, 0xB5, 0xB3, 0x34, 0x96, 0xF2, 0x40, 0x1D, 0x00, 0x33, 0x03,
+    0x2C, 0x00, 0x35, 0x40, 0xE1, 0x01, 0x02, 0x70, 0xA7, 0x55, 0xA8, 0x82, 0x56, 0xA3, 0x4C, 0x8D,
+    0x82, 0x9D, 0xAA, 0x01, 0x9D, 0x9B, 0xB0, 0xD3, 0x23, 0xA0, 0xF7, 0x3D, 0x56, 0x02, 0x5D, 0x98,
+    0xB0, 0x53, 0xEB, 0xD1, 0xB9, 0x15, 0x3B, 0x55, 0x13, 0x6A, 0xE4, 0x7B, 0x19, 0x59, 0x8D, 0x55,
+    0x04, 0x9C, 0x87, 0x3C, 0x6E, 0xDD, 0xC8, 0x04, 0xD8, 0x06, 0xB8, 0x03, 0xE0, 0x8B, 0x46, 0xF2,
+    0xE5, 0x6C, 0xB5, 0xD0, 0x87, 0xD3, 0xEA, 0x8C, 0x7C, 0x11, 0xA9, 0xDE, 0xA3, 0x0A, 0x2C, 0xD0,
+    0xBE, 0x78, 0x7F, 0x20, 0xD3, 0x27, 0x5C, 0x43, 0x11, 0xBF, 0x14, 0xA1, 0xBA, 0xA1, 0x11, 0x5A,
+    0xC9, 0x93, 0x49, 0x6A, 0x28, 0xE2, 0xFF, 0x26, 0xA8, 0x3E, 0x78, 0x6D, 0x85, 0xF6, 0xC5, 0x07,
+    0x22, 0x99, 0x7E, 0xC9, 0x46, 0x8A, 0x48, 0x3D, 0x53, 0x05, 0xDC, 0x94, 0xF5, 0x33, 0x7D, 0x70,
+    0x9A, 0x51, 0x90, 0x46, 0x34, 0x02, 0x3C, 0x04, 0xF0, 0xEB, 0x56, 0x43, 0x39, 0x29, 0xA2, 0x47,
+    0x45, 0x3D, 0xDB, 0x60, 0x02, 0xFA, 0xCC, 0xF3, 0xD8, 0x0F, 0x9F, 0xEC, 0x50, 0x1F, 0xB0, 0x52,
+    0x87, 0xEE, 0x59, 0xB0, 0x1F, 0x3E, 0x19, 0xD0, 0x67, 0xDA, 0xCE, 0x06, 0x13, 0x11, 0x75, 0xE8,
+    0x17, 0xF4, 0xB2, 0x06, 0xB3, 0x00, 0xA7, 0x38, 0x6E, 0x8B, 0x1B, 0x9D, 0xA6, 0x52, 0x5C, 0x9C,
+    0x33, 0x85, 0x4C, 0xB8, 0xBF, 0x35, 0xD2, 0xE3, 0x13, 0x4E, 0xF3, 0x4A, 0x1A, 0xBE, 0x4C, 0x66,
+    0x82, 0xEA, 0x68, 0x85, 0x4C, 0x0A, 0xDB, 0xF8, 0x65, 0x2A, 0x22, 0x54, 0xC1, 0x05, 0x32, 0x65,
+    0xEA, 0xD2, 0x00, 0x66, 0xA2, 0x0D, 0x54, 0xC1, 0xC8, 0x9F, 0xD6, 0x68, 0x57, 0x23, 0x75, 0xED,
+    0xEC, 0x34, 0xE7, 0x1A, 0x81, 0xEC, 0x7C, 0xF6, 0x10, 0x64, 0x0A, 0x60, 0xE5, 0xE1, 0xB4, 0x00,
+    0x13, 0x01, 0x1B, 0xF8, 0x62, 0xA9, 0xA5, 0x9C, 0x2B, 0x85, 0x36, 0x98, 0x68, 0xD4, 0xD9, 0x50,
+    0x7B, 0x9C, 0x8F, 0xA0, 0x72, 0xC0, 0xAC, 0x02, 0xAB, 0x15, 0xDC, 0xEB, 0x11, 0x54, 0x46, 0x4C,
+    0xB4, 0x13, 0x36, 0xD4, 0x81, 0xD6, 0xBB, 0x50, 0x69, 0x68, 0x43, 0xAF, 0xA6, 0x1F, 0x81, 0x3B,
+    0x01, 0xC8, 0xCE, 0x1B, 0x49, 0x4D, 0xEF, 0x9D, 0x14, 0xAA, 0x68, 0xA4, 0xC9, 0xC8, 0xBB, 0x73,
+    0x2B, 0xFD, 0x9F, 0x99, 0xE0, 0x46, 0x3B, 0xE0, 0xCC, 0x9A, 0xCF, 0x70, 0xE8, 0xC6, 0x16, 0x30,
+    0xAB, 0x1D, 0x01, 0x77, 0x23, 0x02, 0x46, 0xF2, 0x80, 0x93, 0xD2, 0x9D, 0x09, 0x70, 0x63, 0xEF,
+    0xC1, 0xAC, 0x46, 0x80, 0x1B, 0xEB, 0x09, 0xCC, 0x8A, 0x3C, 0xB8, 0xB1, 0x14, 0x14, 0x3A, 0x74,
+    0x91, 0x42, 0xCA, 0x14, 0x68, 0x15, 0x0A, 0x75, 0x00, 0xA7, 0x1A, 0x80, 0x5F, 0x37, 0xD2, 0x64,
+    0x27, 0x27, 0xE5, 0x7A, 0xEC, 0xA8, 0xF7, 0xED, 0xE4, 0x8A, 0x68, 0x47, 0x33, 0xB6, 0x2F, 0x44,
+    0xEE, 0x2E, 0xA2, 0x03, 0xDA, 0xF7, 0x47, 0x28, 0xA4, 0x06, 0xDA, 0x37, 0x22, 0x14, 0xD1, 0x8D,
+    0xD0, 0xBE, 0x20, 0x28, 0xA2, 0x8D, 0xD0, 0xFB, 0x76, 0xA4, 0xD7, 0xE7, 0xD4, 0x59, 0x4D, 0xE5,
+    0x02, 0x70, 0x66, 0x9B, 0xDD, 0x52, 0x70, 0x8A, 0xD2, 0xE8, 0x34, 0xDF, 0xB5, 0x52, 0xA8, 0x2B,
+    0x16, 0x32, 0x35, 0x3F, 0x36, 0x5D, 0x77, 0xCF, 0xAA, 0x29, 0x24, 0x1D, 0xA7, 0xEB, 0xC1, 0xBF,
+    0xF8, 0x09, 0xCF, 0x2F, 0x64, 0x6A, 0xEE, 0x52, 0x57, 0xE8, 0x6D, 0x29, 0x38, 0xAD, 0x29, 0x05,
+    0xC8, 0x97, 0x9B, 0x69, 0x96, 0xD8, 0x4D, 0x4A, 0x67, 0x00, 0xBE, 0xB4, 0x55, 0xB0, 0x54, 0xD0,
+    0x5A, 0x2A, 0x54, 0x13, 0x6A, 0xEC, 0x84, 0x38, 0x91, 0x48, 0xFB, 0xE4, 0x68, 0x77, 0xCB, 0x8D,
+    0x09, 0x61, 0x67, 0x74, 0xD8, 0xAB, 0x50, 0x94, 0x4A, 0xC5, 0x3D, 0xDD, 0xE4, 0x11, 0xC8, 0x67,
+    0x20, 0x9B, 0xF6, 0x8C, 0x20, 0x4D, 0xD5, 0x34, 0x80, 0x92, 0xA4, 0xD5, 0x48, 0xFA, 0xF7, 0xEA,
+    0x32, 0x69, 0x2D, 0x16, 0x32, 0x7D, 0x6E, 0xAE, 0x26, 0x8A, 0xA5, 0x1C, 0xDA, 0x81, 0x6A, 0xAA,
+    0xEF, 0x53, 0x43, 0x3B, 0x7C, 0x31, 0xB5, 0x8F, 0xEA, 0x68, 0x77, 0x69, 0x81, 0x56, 0xD2, 0x44,
+    0x26, 0x49, 0x03, 0xA9, 0x63, 0xA8, 0x26, 0x8A, 0x05, 0xDA, 0x81, 0x6A, 0x22, 0x53, 0x43, 0x3B,
+    0xB0, 0x7F, 0x6B, 0xA2, 0x58, 0xC8, 0xFA, 0x99, 0x76, 0xC5, 0x29, 0x5A, 0x69, 0x1B, 0x90, 0x54,
+    0x19, 0xAB, 0xD0, 0x4B, 0x5A, 0x4B, 0xE9, 0x03, 0x35, 0xF6, 0xA8, 0xB7, 0x13, 0x2A, 0x82, 0x1A,
+    0x1B, 0xEE, 0xB5, 0x13, 0x32, 0x83, 0xA4, 0x90, 0xDA, 0x8F, 0x76, 0x97, 0x42, 0x6A, 0x36, 0x6A,
+    0xEC, 0xF1, 0x65, 0x67, 0x67, 0x7A, 0x15, 0x0A, 0x56, 0xA1, 0xD7, 0x36, 0xEA, 0x18, 0x49, 0x52,
+    0x83, 0x95, 0xA4, 0x08, 0xA7, 0x75, 0x74, 0x49, 0x0D, 0x14, 0x0B, 0x36, 0x02, 0xD5, 0x84, 0x0B,
+    0x40, 0x3B, 0x20, 0x0F, 0x99, 0x1A, 0x23, 0x6E, 0xBD, 0x7D, 0x43, 0x1D, 0xED, 0x80, 0xA4, 0x21,
+    0x53, 0x63, 0x24, 0x0D, 0xC5, 0x82, 0x8D, 0x85, 0x7C, 0x35, 0xE1, 0x42, 0xAE, 0xAE, 0x1D, 0x90,
+    0x37, 0x4A, 0x6F, 0xDB, 0x98, 0xDE, 0xAE, 0x43, 0xFA, 0x78, 0xFF, 0x42, 0x3F, 0x65, 0x7A, 0x3B,
+    0x97, 0xD3, 0xEC, 0x14, 0xCA, 0x59, 0x1A, 0x25, 0xEF, 0x86, 0x34, 0x0D, 0xB7, 0xAA, 0xDA, 0x79,
+    0xA3, 0x53, 0x0F, 0x70, 0xBA, 0x4F, 0x3D, 0x53, 0xA7, 0x29, 0x42, 0x3D, 0xEE, 0x1B, 0x64, 0xA5,
+    0xB4, 0xE8, 0x49, 0x03, 0x99, 0xFE, 0xB4, 0x1F, 0xC1, 0x4E, 0xF9, 0x02, 0xA8, 0xA9, 0x87, 0xF4,
+    0xE3, 0x14, 0xA8, 0xA9, 0xDF, 0x57, 0x63, 0xA7, 0x5C, 0x5A, 0x50, 0x53, 0x5F, 0x6F, 0x83, 0x9D,
+    0xF2, 0x05, 0x75, 0x6A, 0xEA, 0xA1, 0x88, 0x76, 0xCA, 0x17, 0x5A, 0xAF, 0xC6, 0x8D, 0x26, 0xF6,
+    0xB2, 0xF2, 0xEE, 0x65, 0x8D, 0x8A, 0x26, 0x15, 0xDC, 0x7A, 0x80, 0x22, 0x55, 0x4A, 0x27, 0xEA,
+    0x70, 0x21, 0x02, 0x54, 0x2B, 0x00, 0x57, 0x1A, 0xE0, 0xE1, 0x06, 0x28, 0x35, 0x00, 0xED, 0x75,
+    0x20, 0x53, 0x77, 0xF1, 0x6D, 0x8A, 0x35, 0xD7, 0x8A, 0x9D, 0xCB, 0x23, 0x35, 0x75, 0xA8, 0x42,
+    0xEF, 0xDD, 0xE8, 0x06, 0x37, 0xB4, 0x83, 0xF3, 0x6E, 0xEC, 0x7D, 0x7B, 0x9C, 0xEA, 0xE6, 0xF5,
+    0xD0, 0x0F, 0xCE, 0x3B, 0xDF, 0x8E, 0x6E, 0x68, 0xBD, 0x0B, 0x75, 0x50, 0x53, 0xCF, 0xF6, 0xA3,
+    0x15, 0xBB, 0x16, 0x8A, 0x18, 0xBD, 0xAA, 0xF0, 0x4B, 0xF4, 0x92, 0x22, 0xA5, 0x6E, 0x68, 0x86,
+    0x33, 0x9C, 0x82, 0x53, 0x87, 0x90, 0x27, 0x46, 0x73, 0x06, 0x13, 0x4B, 0x75, 0x6E, 0x90, 0x1E,
+    0x5D, 0xCB, 0xA0, 0x72, 0x72, 0x57, 0x17, 0x37, 0xAC, 0xC5, 0xAC, 0x62, 0xAE, 0xDE, 0x5A, 0xAA,
+    0xB1, 0x7D, 0x70, 0x72, 0x57, 0x63, 0x1D, 0x64, 0x83, 0x1B, 0xD6, 0x9E, 0xFE, 0x15, 0x05, 0x7A,
+    0xE9, 0xBD, 0xEE, 0xA2, 0x14, 0x39, 0x75, 0xFE, 0x0C, 0xF0, 0xF0, 0x21, 0x85, 0xE4, 0xAD, 0x34,
+    0x59, 0x3D, 0xBB, 0x94, 0x0B, 0xEE, 0xFE, 0x05, 0xFB, 0x9A, 0xC8, 0x83, 0x1A, 0xEE, 0x68, 0x7D,
+    0x5A, 0x72, 0xCB, 0x08, 0x46, 0xDB, 0xB8, 0xD5, 0x13, 0x94, 0x2B, 0x64, 0x1A, 0xC0, 0x2D, 0x50,
+    0xE8, 0xFA, 0xEF, 0x86, 0x5E, 0x8A, 0xA5, 0xB4, 0x50, 0xEB, 0x3A, 0x54, 0x1E, 0x4C, 0x48, 0x1C,
+    0xA0, 0x16, 0x58, 0x35, 0x64, 0x6A, 0xD2, 0xE0, 0x9E, 0x3A, 0xC4, 0x6A, 0x2C, 0xA4, 0x47, 0xF5,
+    0xCD, 0xE8, 0x06, 0xF7, 0x62, 0x34, 0x53, 0xDF, 0xDD, 0x69, 0x67, 0x50, 0x87, 0x9D, 0x41, 0x9E,
+    0x72, 0x85, 0x76, 0xE6, 0x31, 0x29, 0x5A, 0xC9, 0xD7, 0x1A, 0x29, 0x87, 0x63, 0x11, 0x24, 0x62,
+    0xD4, 0x6C, 0x22, 0x08, 0x38, 0x49, 0x3A, 0x91, 0x34, 0xEA, 0xAE, 0x38, 0xB6, 0xE4, 0xF2, 0x7F,
+    0x81, 0xBA, 0x2F, 0x82, 0x3A, 0x7E, 0xB6, 0xE4, 0xB4, 0xFE, 0x66, 0x63, 0xFD, 0x89, 0xFF, 0x27,
+    0x1A, 0x5E, 0x8F, 0x65, 0x8F, 0x08, 0xF0, 0x3C, 0xC0, 0x67, 0x8F, 0x69, 0xF6, 0x43, 0x49, 0x71,
+    0xBD, 0x74, 0xD4, 0xBB, 0x22, 0x56, 0x2F, 0xBF, 0x20, 0xF3, 0x56, 0x68, 0xFD, 0x44, 0x15, 0xA0,
+    0x88, 0xDB, 0x27, 0x5A, 0xCF, 0x71, 0x46, 0xAE, 0x43, 0x0A, 0x89, 0x5C, 0xF2, 0x60, 0xC7, 0x4D,
+    0xB8, 0x59, 0x36, 0xD1, 0x26, 0x49, 0x36, 0xE9, 0xA8, 0x14, 0x6B, 0xBD, 0xA7, 0xB5, 0xD4, 0xD4,
+    0x2E, 0xB8, 0xD1, 0x08, 0x1B, 0x68, 0xC7, 0x22, 0x60, 0xA3, 0x99, 0x41, 0x8F, 0x46, 0xA8, 0xC3,
+    0x02, 0x66, 0x6D, 0x81, 0x56, 0x80, 0x4D, 0xCD, 0xF1, 0x90, 0x38, 0x80, 0x4D, 0xCB, 0x1A, 0xB7,
+    0x64, 0xD6, 0x6B, 0xB3, 0xC9, 0x65, 0x75, 0x62, 0xE5, 0x90, 0x49, 0xE7, 0xF4, 0x96, 0xA2, 0xD5,
+    0x39, 0x75, 0x36, 0x98, 0x15, 0xD7, 0xD9, 0x98, 0x45, 0xAA, 0xC9, 0x06, 0xDC, 0xE8, 0x1A, 0xFA,
+    0xAB, 0x11, 0x64, 0x07, 0xF2, 0xB5, 0x05, 0xB3, 0xCE, 0xDB, 0x8A, 0x5E, 0xAD, 0xFB, 0xEF, 0xF6,
+    0x1E, 0xB2, 0x75, 0x3F, 0xC3, 0xAA, 0x11, 0x68, 0x3B, 0x28, 0x74, 0x08, 0xAD, 0x3A, 0xB2, 0xDD,
+    0x33, 0x3F, 0x75, 0xE3, 0xEE, 0x3B, 0x6E, 0xDC, 0x72, 0x6B, 0xE3, 0x7A, 0xC9, 0xE3, 0xA4, 0x40,
+    0x76, 0x61, 0x79, 0xE8, 0x17, 0x6E, 0xDC, 0x98, 0x1A, 0xD7, 0xBE, 0xB0, 0x6F, 0xDC, 0xE2, 0xC0,
+    0x1C, 0x4D, 0x50, 0xCA, 0x83, 0x5D, 0xE1, 0x74, 0xBF, 0x76, 0xD4, 0x12, 0xE4, 0xFA, 0x69, 0x1A,
+    0x47, 0xAF, 0x20, 0x9D, 0x93, 0x1E, 0x53, 0xCC, 0x14, 0x32, 0x35, 0x68, 0xB0, 0x13, 0x99, 0x7C,
+    0xDF, 0x90, 0xEB, 0xF1, 0x19, 0x72, 0xB5, 0x1E, 0x4C, 0x5A, 0xD5, 0xE4, 0x81, 0x52, 0x90, 0xE6,
+    0x17, 0xB9, 0x16, 0xA0, 0x7A, 0x3F, 0x02, 0x6B, 0x35, 0x83, 0x0D, 0xF5, 0x0C, 0x6A, 0xDC, 0x44,
+    0x39, 0xD3, 0x06, 0xFA, 0xB7, 0x33, 0x5D, 0xAF, 0x34, 0x3B, 0xC5, 0x5E, 0x83, 0x14, 0xD8, 0xA4,
+    0xD8, 0x8D, 0xAD, 0xE5, 0x33, 0x40, 0x39, 0x02, 0x54, 0x0D, 0xC0, 0x6F, 0x6E, 0x0B, 0xC7, 0xDC,
+    0x2E, 0x4E, 0x9F, 0x53, 0xD7, 0x8E, 0xF5, 0x90, 0xE9, 0xDC, 0x44, 0x11, 0x97, 0x8D, 0x23, 0xF7,
+    0x01, 0xCC, 0x02, 0x68, 0x02, 0x27, 0x4F, 0xF9, 0x81, 0xC8, 0x17, 0x1B, 0xE9, 0x3B, 0x37, 0xB9,
+    0xD5, 0xEA, 0x86, 0xBE, 0x2D, 0x91, 0x08, 0x97, 0x15, 0xB0, 0xC3, 0x36, 0x27, 0x4E, 0x52, 0x2E,
+    0x92, 0x26, 0xC9, 0x48, 0x7A, 0x51, 0xD1, 0xBE, 0xBE, 0xB6, 0x85, 0x9A, 0x7B, 0xED, 0xF4, 0xBC,
+    0x8D, 0x4C, 0xEE, 0xD5, 0xE0, 0x42, 0xEE, 0xF5, 0x40, 0x23, 0x8F, 0x59, 0x30, 0x02, 0x3B, 0x61,
+    0x23, 0xB8, 0x01, 0x17, 0x40, 0x0D, 0x3F, 0xFB, 0xAD, 0xD3, 0x92, 0xF4, 0x1F, 0x91, 0x24, 0xC5,
+    0xB4, 0x3C, 0x06, 0x6E, 0x76, 0xCA, 0xC6, 0xEC, 0x93, 0x26, 0x41, 0x99, 0x16, 0xA9, 0xD4, 0x31,
+    0x5B, 0xCF, 0x80, 0xA4, 0x4A, 0xD7, 0xA4, 0xD8, 0xAE, 0xF6, 0x89, 0x8F, 0x42, 0xEB, 0xEF, 0xAD,
+    0x5F, 0xF3, 0x62, 0xEA, 0x1F, 0x34, 0x91, 0xCF, 0x2D, 0x77, 0xD8, 0x40, 0x39, 0xE1, 0x3C, 0xF5,
+    0x80, 0xA0, 0x6F, 0x4C, 0x24, 0x5F, 0xF8, 0x58, 0xB6, 0x76, 0xCF, 0x2E, 0x4D, 0x25, 0x49, 0xBE,
+    0x97, 0xA4, 0x9B, 0xC5, 0xDA, 0x01, 0xC0, 0x35, 0xC7, 0x6C, 0x24, 0x0B, 0x27, 0xFA, 0x2C, 0x93,
+    0xAE, 0x49, 0xF7, 0x4B, 0x56, 0xF1, 0xB4, 0x86, 0x72, 0x5B, 0x74, 0xB1, 0x11, 0x17, 0x70, 0x01,
+    0x79, 0xE4, 0x8D, 0x48, 0xD9, 0xE5, 0x8A, 0x0B, 0x54, 0xFA, 0x37, 0x69, 0x32, 0x08, 0x6A, 0x29,
+    0xC2, 0xED, 0xCF, 0xB8, 0x70, 0x3C, 0x1F, 0xD2, 0xD4, 0xB0, 0x91, 0xFD, 0xDC, 0xC8, 0xF5, 0x1F,
+    0xD9, 0x26, 0x47, 0xF6, 0xC3, 0x44, 0x93, 0xAA, 0x99, 0x3A, 0xE7, 0x24, 0xD1, 0xE4, 0x8A, 0xAD,
+    0x9E, 0xD0, 0x07, 0x5A, 0xCC, 0x8A, 0xBA, 0x72, 0x36, 0x0B, 0xF5, 0x68, 0x27, 0x7A, 0xEF, 0x86,
+    0x4C, 0x8D, 0x1A, 0x23, 0x2D, 0x14, 0xD2, 0x44, 0xB6, 0x6B, 0x07, 0x40, 0xCD, 0x46, 0x4A, 0x76,
+    0x81, 0x52, 0x6A, 0x70, 0x5A, 0x80, 0x32, 0x90, 0x16, 0x0B, 0xDA, 0xBD, 0xA4, 0x98, 0x0F, 0x40,
+    0x96, 0x3A, 0xA1, 0x90, 0xAC, 0x96, 0x56, 0x41, 0x7A, 0xA1, 0x9F, 0x72, 0x0D, 0xA9, 0xB1, 0x2E,
+    0xA4, 0xA6, 0xDB, 0x88, 0x0B, 0x77, 0xC8, 0x1B, 0x59, 0x1B, 0xA9, 0xE7, 0x20, 0x9F, 0x49, 0x97,
+    0x22, 0x56, 0x92, 0xDF, 0x7A, 0xE0, 0x53, 0x93, 0x3C, 0x58, 0x1B, 0x81, 0x20, 0x7F, 0xDC, 0x01,
+    0x49, 0x9F, 0x5C, 0x1B, 0xA8, 0xB4, 0x40, 0x26, 0x0D, 0x00, 0xA5, 0x82, 0xD4, 0xCB, 0x6A, 0x54,
+    0x57, 0x87, 0x72, 0xCE, 0x45, 0xDF, 0xD5, 0xA1, 0x8C, 0xFF, 0xAB, 0x68, 0x5F, 0xAA, 0x83, 0x91,
+    0x44, 0x25, 0x05, 0xCE, 0x1E, 0x09, 0xCA, 0x3A, 0xC0, 0xFF, 0x28, 0xD2, 0xB2, 0xE8, 0x14, 0x30,
+    0x69, 0x8C, 0x93, 0xAA, 0x89, 0x34, 0x42, 0xD6, 0x8F, 0x49, 0xDA, 0x4A, 0x22, 0xD8, 0xC7, 0x2E,
+    0x2F, 0xCE, 0xD0, 0x4A, 0x33, 0x85, 0xA4, 0x81, 0xF6, 0xA3, 0x4A, 0x14, 0x0B, 0x2E, 0xD0, 0x0E,
+    0x49, 0xE4, 0xAE, 0x26, 0xDA, 0x01, 0x35, 0xC5, 0x82, 0xDD, 0x2E, 0xEF, 0x52, 0x53, 0xAF, 0x0F,
+    0x6A, 0xAD, 0x14, 0xA5, 0xEF, 0x48, 0x9E, 0x3B, 0x81, 0x7E, 0x02, 0xAB, 0x01, 0xEE, 0xDA, 0xA4,
+    0x3F, 0xA8, 0xA6, 0x6D, 0xC9, 0xC9, 0x94, 0x7D, 0x91, 0x22, 0xF6, 0x91, 0x4A, 0x8A, 0xB4, 0xD2,
+    0x94, 0x69, 0x68, 0xC7, 0x62, 0x41, 0x5D, 0x35, 0x99, 0x95, 0x76, 0xB0, 0x73, 0xA6, 0xC6, 0xFD,
+    0xB8, 0xAC, 0x41, 0xB2, 0x7A, 0x47, 0x73, 0xAB, 0x0E, 0x38, 0xFB, 0x34, 0x7B, 0x35, 0xA5, 0x96,
+    0x06, 0xD0, 0x77, 0xFB, 0x40, 0x2E, 0xEC, 0x6C, 0xCD, 0x42, 0x11, 0x5D, 0x19, 0x31, 0x4B, 0x6B,
+    0x67, 0xCC, 0xD2, 0x5E, 0x98, 0x30, 0x4B, 0x2B, 0x49, 0x8B, 0x93, 0xA4, 0x78, 0x3A, 0x89, 0xAA,
+    0xD5, 0x04, 0x50, 0xCD, 0x37, 0x09, 0xD3, 0x2E, 0x69, 0x18, 0x1A, 0xC0, 0x68, 0xCA, 0xFE, 0x8C,
+    0x2C, 0x09, 0xB5, 0xAD, 0x34, 0x41, 0x29, 0x75, 0xC0, 0x99, 0xF3, 0xEC, 0x05, 0xA2, 0x08, 0x4E,
+    0x31, 0x3B, 0xB7, 0x5E, 0x88, 0xF7, 0x54, 0xA3, 0xFD, 0x60, 0x12, 0xEE, 0xF5, 0x77, 0x22, 0x7A,
+    0x50, 0x52, 0xAC, 0x25, 0x85, 0x5C, 0x07, 0x07, 0x4D, 0x11, 0x81, 0xA4, 0xC2, 0x4D, 0xDC, 0x91,
+    0x34, 0xF2, 0x5E, 0x2B, 0xB4, 0x1A, 0xE1, 0xD4, 0x79, 0xFE, 0xC1, 0x1B, 0x95, 0x84, 0xE5, 0xDA,
+    0xDF, 0x4C, 0xAB, 0x0E, 0xC0, 0x76, 0x00, 0x65, 0xF3, 0xF7, 0xD4, 0x64, 0x6D, 0x4D, 0xB6, 0x61,
+    0x5F, 0xCE, 0x23, 0x40, 0x36, 0x03, 0x66, 0x00, 0x4E, 0x6F, 0x2A, 0xC5, 0xCB, 0xD2, 0x69, 0x75,
+    0x7B, 0xFA, 0x3B, 0x41, 0x8A, 0x3F, 0xE2, 0x32, 0xEB, 0xAF, 0x3B, 0x45, 0x29, 0x40, 0x76, 0x78,
+    0xBA, 0x01, 0x30, 0xC1, 0x7A, 0x00, 0x33, 0x55, 0xE9, 0xAC, 0x3E, 0xF1, 0xDE, 0x7E, 0x5B, 0x86,
+    0x53, 0x97, 0xEF, 0xF9, 0xDD, 0x21, 0xC0, 0xE9, 0xA6, 0x88, 0x99, 0xE4, 0xDD, 0x68, 0x95, 0x4B,
+    0x5D, 0x1F, 0xAC, 0x9A, 0x8B, 0x73, 0xA6, 0x50, 0xF6, 0xDE, 0x06, 0xB3, 0x8E, 0xD8, 0xD1, 0x86,
+    0x62, 0x82, 0x22, 0xD8, 0x90, 0x04, 0x26, 0x1B, 0x2A, 0x0F, 0x44, 0x1B, 0x5C, 0x03, 0xF4, 0x97,
+    0x8E, 0xD6, 0x8D, 0x7F, 0x27, 0xB1, 0x4D, 0x52, 0x07, 0x66, 0xB5, 0xA1, 0xF5, 0x60, 0xA3, 0x0D,
+    0x2E, 0x40, 0x35, 0xDB, 0x50, 0xCD, 0xE0, 0x82, 0x0D, 0x76, 0x01, 0x8D, 0x36, 0x14, 0x22, 0x97,
+    0xB7, 0xC1, 0xC8, 0x97, 0x6A, 0xEA, 0x15, 0x8D, 0xF5, 0x9A, 0x4B, 0x5D, 0x3B, 0xB7, 0xB3, 0x91,
+    0xBA, 0x6A, 0x4D, 0x7A, 0x7C, 0x76, 0x1E, 0xEE, 0xA0, 0x01, 0xAC, 0x77, 0x00, 0x4B, 0x11, 0x00,
+    0x1B, 0xD2, 0xA2, 0x9D, 0xD4, 0x9B, 0x4B, 0x4F, 0x1D, 0xB7, 0xEE, 0xBF, 0x02, 0xB2, 0x43, 0x1B,
+    0x2A, 0x75, 0xFA, 0x9C, 0x1E, 0xD5, 0x54, 0xCF, 0xD5, 0x62, 0x62, 0xA1, 0xA6, 0x0C, 0xCE, 0xAF,
+    0x50, 0x9F, 0x8B, 0x95, 0x87, 0xE8, 0xAE, 0x05, 0x28, 0x6F, 0xAC, 0xEB, 0xB6, 0x6C, 0x82, 0x7B,
+    0x67, 0x69, 0x3D, 0x65, 0x74, 0xD7, 0x56, 0xD0, 0xB9, 0x58, 0x05, 0x5C, 0x70, 0x5E, 0xBE, 0x5C,
+    0x4C, 0x2C, 0xD6, 0x5C, 0x8F, 0x6A, 0xAE, 0xE7, 0x36, 0xD4, 0x6A, 0xFA, 0xE1, 0x21, 0x80, 0xF3,
+    0x00, 0xE7, 0xA5, 0x50, 0x46, 0x69, 0xA8, 0xE3, 0x5D, 0x2B, 0x6D, 0x2C, 0x22, 0xFA, 0xB3, 0x22,
+    0x9A, 0x48, 0x11, 0x8B, 0x90, 0x00, 0xB9, 0x22, 0x56, 0x9E, 0x62, 0xCF, 0x7A, 0x9A, 0x42, 0xD2,
+    0x50, 0xC4, 0x84, 0xE1, 0xB9, 0xA9, 0x88, 0xD8, 0xB9, 0x88, 0xD8, 0x58, 0x44, 0xCA, 0x94, 0xDC,
+    0xA5, 0xAE, 0x8C, 0xD2, 0x68, 0x67, 0x69, 0xB4, 0x13, 0x49, 0x92, 0xC5, 0x0D, 0x09, 0x97, 0xCC,
+    0x2E, 0x09, 0x8C, 0xE6, 0xBD, 0xD2, 0xC4, 0x9D, 0x4E, 0xBE, 0x7D, 0x59, 0x63, 0x1B, 0xDA, 0xC1,
+    0x45, 0x3B, 0x55, 0x83, 0x59, 0xEC, 0x80, 0x1E, 0x18, 0x71, 0x5A, 0xB0, 0x52, 0x30, 0xEB, 0x45,
+    0xA1, 0xA6, 0x1F, 0xDC, 0x60, 0x67, 0x3B, 0xE5, 0x32, 0x0B, 0xED, 0x4B, 0x0A, 0xD5, 0x87, 0x9A,
+    0x8B, 0xB8, 0x09, 0x90, 0x7D, 0x93, 0x56, 0x26, 0x37, 0x90, 0xF5, 0x23, 0xB9, 0x46, 0xB8, 0xBB,
+    0xBB, 0x45, 0x59, 0x94, 0x24, 0x9F, 0xF5, 0xD2, 0x80, 0x99, 0x6C, 0x04, 0x87, 0x3C, 0x26, 0x7C,
+    0xEC, 0xB2, 0x45, 0x9E, 0x22, 0xD8, 0x08, 0x57, 0x90, 0xC7, 0x0E, 0x36, 0x42, 0x44, 0x9E, 0xCA,
+    0xDB, 0x88, 0x99, 0x91, 0xBF, 0xA3, 0x6D, 0x6C, 0x34, 0x6F, 0x06, 0xE4, 0xDB, 0x85, 0x7A, 0x7D,
+    0x40, 0x5D, 0x2D, 0xB9, 0xD1, 0x48, 0xE3, 0xF9, 0x0D, 0x76, 0xA0, 0xED, 0xF6, 0x0B, 0x58, 0xD2,
+    0x07, 0xD2, 0x2C, 0x0D, 0x37, 0xEB, 0xD4, 0x39, 0x69, 0xA1, 0xFA, 0xAE, 0x3A, 0xEA, 0x7C, 0x85,
+    0xE7, 0xCB, 0x19, 0x13, 0xEA, 0x11, 0xEB, 0xFB, 0x0E, 0x97, 0xAF, 0x64, 0x73, 0x39, 0x53, 0x0E,
+    0xF5, 0x88, 0xA3, 0xEF, 0xFE, 0xEB, 0x98, 0xAF, 0xB9, 0x06, 0xBB, 0x94, 0x32, 0x52, 0x15, 0x2A,
+    0xC5, 0x53, 0x7B, 0xC9, 0x72, 0x2F, 0xC3, 0x59, 0x0F, 0xDC, 0xF3, 0x23, 0x10, 0x8E, 0xD5, 0x48,
+    0xFF, 0x4A, 0x5D, 0xA6, 0x31, 0xA1, 0x11, 0x09, 0x8C, 0x68, 0x07, 0xAA, 0x29, 0xA1, 0x14, 0x5B,
+    0xF6, 0xD1, 0xEE, 0xD2, 0x92, 0x80, 0x8D, 0x84, 0x6B, 0x24, 0x58, 0xE3, 0xC7, 0x3D, 0x3D, 0x51,
+    0xC4, 0xAC, 0x9F, 0xA9, 0x82, 0x53, 0xA4, 0xF5, 0x52, 0xC8, 0x05, 0x7B, 0x3C, 0xD9, 0x0D, 0x7B,
+    0xA9, 0xE2, 0x74, 0x3F, 0x01, 0xAD, 0x1A, 0xA0, 0x3F, 0xDC, 0x57, 0x2D, 0x3A, 0xBD, 0xAC, 0xD0,
+    0xAB, 0xD8, 0xAF, 0x24, 0xB8, 0xB1, 0x88, 0xA8, 0xAB, 0x82, 0x51, 0x52, 0x3C, 0x85, 0x3B, 0x7A,
+    0x76, 0xCB, 0x5A, 0x69, 0xFD, 0xF1, 0x53, 0xA5, 0x42, 0x15, 0x9C, 0x7C, 0x5A, 0xBB, 0x48, 0xFA,
+    0x12, 0x6E, 0x4C, 0xBF, 0xB2, 0x76, 0x82, 0x4A, 0x0D, 0xDC, 0x75, 0xC8, 0x3F, 0x14, 0xF8, 0x15,
+    0x6F, 0xA2, 0x3B, 0x65, 0x62, 0xF6, 0x81, 0xBD, 0x34, 0x9C, 0xA4, 0x9A, 0x04, 0x50, 0xF3, 0x1B,
+    0xFB, 0xFE, 0xA8, 0xF5, 0xB2, 0xC6, 0x5E, 0xC5, 0x82, 0x1B, 0xEC, 0x84, 0x70, 0x83, 0x89, 0xA8,
+    0xB1, 0x27, 0xFB, 0xE3, 0xDD, 0x67, 0xB7, 0xAC, 0x05, 0xE7, 0xD3, 0x53, 0xA3, 0x59, 0x1F, 0x50,
+    0x68, 0x25, 0x5D, 0xD5, 0xBA, 0x27, 0x3B, 0xD7, 0x6D, 0x5A, 0xA8, 0x19, 0x01, 0x7B, 0x82, 0x99,
+    0xFE, 0x34, 0x72, 0xD3, 0xF1, 0x65, 0x3D, 0x23, 0x9F, 0xE9, 0xFA, 0xC7, 0xE5, 0xA6, 0xA7, 0x3F,
+    0x2E, 0x2C, 0x7D, 0x5C, 0x6E, 0xAA, 0xB5, 0x80, 0x91, 0x86, 0x4D, 0x6A, 0x4C, 0xD3, 0xC2, 0x75,
+    0xC7, 0xFA, 0x46, 0x12, 0x1A, 0xFF, 0x3C, 0xD5, 0xA9, 0xD4, 0x07, 0x5A, 0x7B, 0x55, 0x1A, 0xD4,
+    0xB9, 0xB1, 0x9C, 0xCD, 0x42, 0xDF, 0xB9, 0xA1, 0x8C, 0x66, 0xA1, 0x1D, 0xDC, 0x60, 0xA4, 0x85,
+    0x4A, 0x1A, 0x38, 0xFB, 0x6F, 0x97, 0x8D, 0xB6, 0xCC, 0x02, 0xB4, 0x23, 0xF4, 0x1A, 0xB0, 0x5A,
+    0xA0, 0xDF, 0x37, 0xFE, 0x11, 0xA0, 0x18, 0xF7, 0x93, 0xA1, 0xB9, 0xD9, 0xF2, 0x99, 0x5A, 0x43,
+    0xA1, 0x88, 0xD3, 0x40, 0x1F, 0x71, 0x2B, 0xB4, 0x0B, 0xFD, 0x02, 0xFD, 0x8A, 0x16, 0xB8, 0x22,
+    0xD6, 0x15, 0x16, 0xDD, 0x77, 0xB4, 0xC2, 0xD2, 0x7E, 0xF5, 0x83, 0x15, 0xA2, 0xBB, 0xF6, 0x81,
+    0x20, 0xBA, 0x17, 0xBF, 0x2D, 0x88, 0xF5, 0x1B, 0x83, 0xC8, 0xA2, 0x7D, 0xDF, 0x8B, 0x2C, 0x5A,
+    0x75, 0x22, 0x8F, 0xA5, 0x1A, 0x35, 0x79, 0x34, 0x42, 0x8D, 0x99, 0xCD, 0x8A, 0x1A, 0x33, 0x67,
+    0x0B, 0xEA, 0x8A, 0x85, 0x98, 0xE9, 0x6D, 0x27, 0xDF, 0x58, 0x2D, 0xAD, 0x3C, 0x76, 0x43, 0xFD,
+    0x12, 0x61, 0x6C, 0x94, 0xB1, 0x91, 0xC6, 0x46, 0x1B, 0xD4, 0xCD, 0x09, 0xEA, 0xA0, 0x94, 0x47,
+    0x73, 0xBF, 0x52, 0xAB, 0x51, 0x30, 0xF2, 0x56, 0x4D, 0x3F, 0xA3, 0x68, 0xD5, 0xD9, 0x37, 0xAF,
+    0xFE, 0x60, 0x66, 0x59, 0xEF, 0x75, 0x9D, 0x7D, 0xFD, 0xC6, 0xB5, 0x99, 0xC5, 0x45, 0xD7, 0xD9,
+    0x57, 0x75, 0x6E, 0x66, 0xB1, 0xC1, 0x75, 0x76, 0xB8, 0x6C, 0x66, 0x96, 0xBC, 0x69, 0x87, 0x3E,
+    0xE2, 0xF4, 0xB2, 0x7C, 0xA1, 0x9B, 0xE3, 0x51, 0x04, 0x80, 0x2B, 0x00, 0xA5, 0x07, 0x78, 0x8E,
+    0x4D, 0xCA, 0x2E, 0xB4, 0xB6, 0x1A, 0xDA, 0xD1, 0x2C, 0xB8, 0xE1, 0xA7, 0x48, 0x8A, 0xB5, 0xD0,
+    0xDA, 0x6B, 0xE0, 0x34, 0xBF, 0x06, 0x3C, 0x42, 0x84, 0x2C, 0x96, 0x01, 0xCC, 0xAA, 0x6E, 0xCF,
+    0xFD, 0x93, 0xB1, 0x62, 0x3B, 0xBE, 0xC8, 0x7E, 0x9D, 0x48, 0xC4, 0x93, 0x10, 0x71, 0x97, 0xF4,
+    0xF4, 0x05, 0x28, 0xDF, 0x9C, 0x01, 0x57, 0x07, 0xC8, 0x66, 0x37, 0x80, 0x1D, 0xE4, 0xA1, 0xCD,
+    0x05, 0x66, 0x36, 0x0B, 0xD8, 0xEF, 0x5E, 0x88, 0xD0, 0x2B, 0xC9, 0xD7, 0x1A, 0xA9, 0xFE, 0xEA,
+    0x40, 0x1E, 0x91, 0xAB, 0x29, 0x26, 0xCC, 0x4A, 0xFB, 0x36, 0xD5, 0xFA, 0x80, 0xA6, 0x42, 0x72,
+    0x1A, 0x2A, 0xC5, 0x8C, 0xDB, 0xB0, 0xFE, 0x5E, 0xAC, 0x6F, 0xB1, 0x1F, 0xAC, 0x14, 0x8A, 0x37,
+    0x59, 0xD3, 0xAF, 0x9C, 0x27, 0x4F, 0xE4, 0x86, 0xFB, 0xAE, 0x3A, 0xD7, 0xF5, 0xBE, 0x6E, 0x5A,
+    0x0F, 0xAD, 0xE7, 0xAC, 0x7C, 0x21, 0xF9, 0x5A, 0xF2, 0xED, 0xD0, 0xFA, 0xBE, 0x6B, 0xBD, 0xBA,
+    0xDE, 0xF7, 0xEF, 0xE9, 0x6F, 0x5A, 0x69, 0xA9, 0xD6, 0x6A, 0xCA, 0xCE, 0x67, 0x0D, 0xA7, 0xBB,
+    0xDF, 0x07, 0xDA, 0xC7, 0x22, 0xE4, 0xAA, 0x02, 0x14, 0xB3, 0xF3, 0x90, 0x6D, 0x96, 0x07, 0x00,
+    0x7E, 0x9D, 0x3D, 0xE3, 0x4A, 0x0A, 0x57, 0xA6, 0x91, 0x0D, 0x26, 0xC1, 0xA9, 0x81, 0xFC, 0x07,
+    0x2B, 0x60, 0x5F, 0x8A, 0xC0, 0x23, 0x76, 0x02, 0x33, 0xB9, 0x00, 0x95, 0xEF, 0x3D, 0xAC, 0xA8,
+    0xC1, 0x5C, 0xFF, 0xFC, 0xB1, 0x36, 0x27, 0x69, 0xA6, 0xF8, 0xE8, 0xA0, 0x0D, 0x38, 0x4F, 0x3F,
+    0x64, 0x0B, 0xA8, 0xAB, 0xAE, 0x53, 0xE8, 0x5F, 0x6B, 0xC9, 0xA4, 0x97, 0x35, 0x15, 0x9B, 0xFE,
+    0x51, 0x8E, 0x57, 0xA8, 0x82, 0xA8, 0x82, 0x28, 0xBB, 0x3F, 0xBE, 0x59, 0xA7, 0xBF, 0x8F, 0xB6,
+    0x9F, 0xC4, 0x69, 0xD5, 0x24, 0xFC, 0x79, 0x84, 0x52, 0xD2, 0x0C, 0xE6, 0xC6, 0xC2, 0x15, 0xC8,
+    0xA3, 0x9A, 0xAA, 0x81, 0xC5, 0x0D, 0x79, 0x03, 0xBD, 0x9D, 0x00, 0x5A, 0xB3, 0x24, 0xB2, 0xD4,
+    0xEE, 0x69, 0xA8, 0xBC, 0x93, 0xC0, 0x8E, 0x56, 0xEA, 0x28, 0xAF, 0x7F, 0x61, 0x3D, 0x48, 0x9F,
+    0x6B, 0x20, 0x97, 0x34, 0xD0, 0x64, 0x0B, 0xD5, 0xC4, 0x97, 0x11, 0x66, 0xC1, 0xD1, 0x36, 0xA8,
+    0xA9, 0x7C, 0x3B, 0x64, 0xBD, 0x14, 0xA4, 0x5C, 0x52, 0x74, 0xF2, 0x92, 0x56, 0xF8, 0x95, 0xE6,
+    0xD4, 0x21, 0xB5, 0x1E, 0xD7, 0x68, 0x25, 0xE9, 0xDA, 0x7A, 0x41, 0x9F, 0x5F, 0x5C, 0xD7, 0xFB,
+    0xFA, 0xC3, 0xA9, 0x9C, 0x33, 0x41, 0xFB, 0xF5, 0x4B, 0x21, 0xBB, 0x24, 0xA9, 0x90, 0x74, 0xF4,
+    0xAF, 0xF5, 0xDE, 0x0C, 0xED, 0xD0, 0x76, 0x94, 0xB3, 0x89, 0xA0, 0xCE, 0x4D, 0x7C, 0x41, 0xBD,
+    0xB4, 0xB6, 0xBA, 0x21, 0xBD, 0xA2, 0xD9, 0x6A, 0xCA, 0x1E, 0xE2, 0xD4, 0x79, 0x38, 0xCC, 0x3B,
+    0x2E, 0xE7, 0x33, 0x75, 0xB7, 0x52, 0xAC, 0xDA, 0x16, 0xBC, 0x87, 0x6E, 0x41, 0x3A, 0xD4, 0x4A,
+    0x7A, 0xA5, 0x97, 0xA6, 0x6A, 0xE2, 0x72, 0xB1, 0x50, 0xDD, 0xA7, 0xC6, 0x74, 0xED, 0x90, 0x74,
+    0xB1, 0x62, 0xDD, 0x3D, 0x95, 0x49, 0x0B, 0xAD, 0x44, 0x75, 0xFD, 0xA0, 0x29, 0x16, 0x12, 0x34,
+    0xDA, 0x0E, 0x4C, 0xD5, 0xC4, 0x23, 0xC5, 0x82, 0xFB, 0x57, 0x92, 0xDE, 0x94, 0xF4, 0x03, 0x29,
+    0x51, 0xF2, 0xE5, 0x3C, 0x94, 0xA3, 0x6B, 0xDA, 0x07, 0x82, 0xD1, 0xC2, 0xE9, 0x4D, 0x82, 0xFE,
+    0x9F, 0xC8, 0xB4, 0xD2, 0x6B, 0xAE, 0x3E, 0xEA, 0xAF, 0x45, 0xB3, 0xB6, 0x5D, 0xFD, 0xDE, 0x9C,
+    0xAF, 0x92, 0xDE, 0x97, 0x56, 0x7D, 0xFD, 0xE0, 0xC1, 0x09, 0x7A, 0x4F, 0xB1, 0x72, 0x9B, 0x93,
+    0x5E, 0x91, 0x62, 0x2E, 0x35, 0x1C, 0xC0, 0xD9, 0x67, 0x92, 0x22, 0x9E, 0x49, 0xF2, 0x76, 0xBD,
+    0x24, 0xDF, 0x36, 0x85, 0xBA, 0x40, 0x21, 0xA0, 0x5C, 0xF6, 0x60, 0xBD, 0x0B, 0x80, 0x5E, 0x94,
+    0xA4, 0x5A, 0x52, 0xEC, 0x25, 0x7D, 0xB8, 0x82, 0x5E, 0x9E, 0x31, 0x4B, 0x3D, 0x52, 0x87, 0xD6,
+    0xA3, 0x4E, 0xDE, 0xC6, 0x5C, 0xD2, 0x90, 0x4B, 0x91, 0x4C, 0x6A, 0xE0, 0x4C, 0x03, 0xFC, 0x4E,
+    0x43, 0xAF, 0xCE, 0x49, 0xE5, 0xF5, 0x3E, 0x7E, 0x89, 0xDE, 0x63, 0x56, 0xA8, 0xBF, 0x7B, 0xF0,
+    0xF9, 0xE3, 0x7A, 0x36, 0xF5, 0x9B, 0x93, 0x89, 0x7D, 0xD7, 0x3E, 0xBE, 0x5E, 0x0C, 0xB5, 0x16,
+    0xFA, 0x15, 0x0E, 0x80, 0x6F, 0x9D, 0xEE, 0x28, 0xE7, 0xD6, 0xE3, 0xBE, 0x2D, 0x68, 0xCF, 0xCD,
+    0x70, 0x47, 0xB6, 0x57, 0x18, 0x76, 0x87, 0xD0, 0x6B, 0x4A, 0xEA, 0xAC, 0xDE, 0x55, 0x2C, 0x26,
+    0xDA, 0xD9, 0x42, 0x1B, 0x80, 0x7E, 0xD8, 0x60, 0x5C, 0x23, 0xC0, 0xC6, 0x56, 0xD2, 0xF7, 0x24,
+    0xE9, 0x25, 0x49, 0x72, 0x23, 0x36, 0xAA, 0xC3, 0xBD, 0xBA, 0x92, 0xAB, 0x88, 0xD8, 0xD9, 0x46,
+    0xE4, 0xEB, 0x84, 0x60, 0xCB, 0x53, 0x69, 0x82, 0x2C, 0x0D, 0x6D, 0x16, 0xAD, 0x77, 0xAF, 0xAE,
+    0x66, 0xA9, 0xC7, 0xB2, 0x7B, 0x6E, 0x3F, 0xD6, 0xA7, 0xBE, 0x46, 0xA9, 0xD9, 0x48, 0xA1, 0xFF,
+    0x86, 0x5E, 0x6C, 0xCA, 0x08, 0x6E, 0x24, 0x5F, 0x0F, 0x0E, 0xDA, 0xF7, 0xA5, 0x55, 0xD2, 0xFB,
+    0x53, 0xBE, 0xA8, 0x71, 0x2F, 0xCD, 0xC5, 0xDC, 0xFE, 0xB5, 0x72, 0x69, 0x28, 0x35, 0x26, 0xB5,
+    0x27, 0x7B, 0xFA, 0xF6, 0xA4, 0x24, 0xC5, 0xA4, 0xF4, 0x15, 0xDB, 0xD9, 0xC4, 0xA4, 0xF8, 0xD1,
+    0x9C, 0xFA, 0xFF, 0xB5, 0x72, 0xC4, 0x31, 0x0F, 0x02, 0x64, 0x4F, 0x28, 0x47, 0x7F, 0x5C, 0x1C,
+    0x72, 0xEB, 0xF1, 0x9F, 0x57, 0x39, 0xCA, 0x0F, 0xCF, 0x62, 0x96, 0x6A, 0x44, 0x4F, 0x44, 0xEA,
+    0x17, 0x16, 0xB2, 0xE6, 0xB6, 0x3D, 0x45, 0x35, 0xDC, 0x25, 0x51, 0x4B, 0xA1, 0xBC, 0xFE, 0x85,
+    0xD5, 0xCC, 0xC8, 0x2F, 0x54, 0xA1, 0xA6, 0x88, 0x59, 0x93, 0xAF, 0x80, 0xC8, 0x76, 0x6A, 0x68,
+    0x35, 0x24, 0x4B, 0xF4, 0xBF, 0xD0, 0x00, 0x55, 0x04, 0xA3, 0xA2, 0x43, 0x2F, 0x06, 0xDC, 0x87,
+    0xA2, 0x9E, 0xFA, 0xEB, 0x6D, 0xB4, 0x52, 0xA4, 0xD7, 0x44, 0xF6, 0x3B, 0x89, 0x63, 0xB6, 0x26,
+    0xD8, 0xA9, 0xEF, 0xF4, 0xC0, 0x9C, 0x8F, 0x77, 0x1F, 0x8F, 0xED, 0xEF, 0x93, 0x4B, 0x48, 0xB1,
+    0xFE, 0xCB, 0xFE, 0x95, 0xD1, 0x2C, 0xE0, 0x3C, 0xC5, 0x4C, 0x2B, 0x0A, 0xCD, 0x9C, 0xE9, 0x47,
+    0x72, 0xFD, 0x06, 0xD5, 0x87, 0x53, 0x2E, 0xF7, 0xDD, 0xFE, 0x35, 0x69, 0x2A, 0x75, 0x7D, 0x4F,
+    0x9B, 0x95, 0x14, 0x2B, 0x69, 0xAD, 0xA5, 0xA5, 0xEE, 0xCA, 0xB9, 0x6E, 0xAA, 0xD1, 0xD2, 0x76,
+    0xB0, 0x26, 0x89, 0xCC, 0xAE, 0x60, 0x35, 0x62, 0x35, 0x43, 0xB5, 0x80, 0x59, 0xC1, 0xAC, 0xB7,
+    0x61, 0xD6, 0xDF, 0xC0, 0xAC, 0xAE, 0x2B, 0xA3, 0x3B, 0xEA, 0xE7, 0x5A, 0x1A, 0x0B, 0xA9, 0x49,
+    0xC8, 0x0A, 0xF4, 0xD2, 0x55, 0x49, 0x4F, 0x4A, 0xD1, 0xE1, 0xFC, 0x73, 0x26, 0xD2, 0xD5, 0x03,
+    0xF9, 0x02, 0xD5, 0x40, 0xA6, 0x86, 0x52, 0x81, 0x4A, 0x53, 0xB2, 0xE5, 0xF7, 0x03, 0xA8, 0xC3,
+    0xAC, 0x60, 0xA7, 0x3F, 0xC7, 0xBD, 0x18, 0x72, 0x55, 0xD7, 0x2F, 0x4E, 0x4E, 0x6A, 0x6A, 0x05,
+    0x4E, 0x3F, 0x9D, 0x74, 0x95, 0x84, 0xF5, 0xB3, 0x21, 0x10, 0x1F, 0x3F, 0xAC, 0x64, 0xA4, 0x5E,
+    0xB3, 0xD5, 0x72, 0xD7, 0x4A, 0xA1, 0xA6, 0x0A, 0x94, 0x91, 0xD6, 0xE3, 0x42, 0x26, 0x92, 0xAF,
+    0x85, 0x13, 0x55, 0x30, 0x8A, 0xB4, 0xDE, 0xBD, 0x1F, 0x32, 0x99, 0xB9, 0xF7, 0x45, 0x74, 0x5F,
+    0x15, 0xD5, 0x0F, 0xE6, 0x32, 0xD2, 0xAA, 0xAB, 0x43, 0xA6, 0x99, 0xDE, 0x17, 0xEA, 0x72, 0x51,
+    0xCD, 0xDB, 0x47, 0xEA, 0x70, 0x5A, 0x87, 0xD9, 0x26, 0xBD, 0xDF, 0x90, 0x3A, 0x69, 0xA4, 0xD5,
+    0x98, 0xEC, 0x2F, 0xE5, 0xDE, 0x3E, 0x70, 0xA2, 0x3E, 0xA1, 0x97, 0xD3, 0xA3, 0x8A, 0x55, 0x12,
+    0xD6, 0x8B, 0x88, 0x9A, 0x36, 0x98, 0xA5, 0x90, 0xB7, 0x53, 0x2F, 0xDC, 0x1B, 0x6F, 0x45, 0xB4,
+    0xDA, 0x60, 0x34, 0x3A, 0x6F, 0xD7, 0x24, 0xAC, 0x47, 0xD4, 0x54, 0x53, 0xAD, 0x47, 0x15, 0xB5,
+    0x96, 0x0A, 0xE4, 0x87, 0x9F, 0x02, 0xDC, 0xAB, 0x2B, 0xA0, 0x07, 0x67, 0x30, 0xB1, 0x1A, 0xB8,
+    0x49, 0x7A, 0xEC, 0x0D, 0x59, 0xD1, 0x6A, 0x95, 0x46, 0xA7, 0xE9, 0xE2, 0x4C, 0xB5, 0xA4, 0x4A,
+    0x67, 0x02, 0xF9, 0x22, 0x62, 0x45, 0x15, 0x50, 0xA4, 0xF5, 0x56, 0x21, 0x13, 0xEA, 0x7D, 0x11,
+    0xED, 0x77, 0x44, 0x15, 0xD6, 0x32, 0xD2, 0xBE, 0x39, 0xD6, 0x21, 0xD3, 0x4A, 0xEF, 0x0B, 0x8D,
+    0xB9, 0xA8, 0x56, 0xCA, 0x48, 0x3B, 0x6E, 0x1F, 0xE9, 0xFD, 0x5D, 0x6B, 0x53, 0xE8, 0xFF, 0x90,
+    0xBC, 0xF4, 0xBE, 0x56, 0xA3, 0xCD, 0xF2, 0x9A, 0xCF, 0x95, 0xC7, 0x06, 0x35, 0xB8, 0x6B, 0x11,
+    0xFE, 0xF8, 0xF4, 0xF0, 0xB1, 0x9E, 0x90, 0x4A, 0x7D, 0xA8, 0xB9, 0xD2, 0x0B, 0x9B, 0x66, 0xD2,
+    0x7A, 0x3B, 0x15, 0xC2, 0x0D, 0x6D, 0x44, 0x0F, 0x28, 0x98, 0xE5, 0x8A, 0xF3, 0x56, 0xA3, 0x70,
+    0xAB, 0x89, 0x68, 0x4C, 0x76, 0x15, 0x6F, 0xA7, 0x4C, 0x9F, 0xD3, 0x5C, 0x25, 0xC5, 0x07, 0x6E,
+    0x6F, 0xBE, 0x05, 0x76, 0xEA, 0x3B, 0xCC, 0xE2, 0x46, 0x50, 0x31, 0xC1, 0xA9, 0xBD, 0x36, 0x0B,
+    0xA7, 0x9F, 0x01, 0x5A, 0xCD, 0xD0, 0x4B, 0x03, 0x3A, 0xEA, 0x17, 0xFA, 0xC1, 0xC8, 0xB7, 0x03,
+    0x6E, 0x76, 0x81, 0x42, 0x76, 0x02, 0xBD, 0xB8, 0x40, 0xFD, 0x7D, 0x41, 0xB9, 0xF4, 0x9E, 0x5C,
+    0x6D, 0x80, 0xF6, 0xCD, 0x08, 0xF5, 0xF7, 0xD5, 0x50, 0xC6, 0x76, 0xC4, 0xC8, 0x46, 0xD0, 0x39,
+    0x75, 0xC8, 0xB7, 0x33, 0xBD, 0x2F, 0x75, 0x43, 0x43, 0xFA, 0x70, 0x2E, 0x75, 0x70, 0x6A, 0x5B,
+    0xBB, 0xCD, 0x54, 0x77, 0x45, 0x6C, 0x7D, 0x11, 0x5B, 0x7F, 0x62, 0x6E, 0xC2, 0xA9, 0xAF, 0x91,
+    0x49, 0x5D, 0x21, 0x8D, 0xD5, 0xF5, 0x7E, 0x72, 0xA3, 0x8D, 0xAD, 0x2F, 0x63, 0xEF, 0x8B, 0x45,
+    0xBE, 0x58, 0xD4, 0x99, 0x74, 0xF6, 0x45, 0xEC, 0x7D, 0x19, 0xDB, 0x60, 0x27, 0xB7, 0xF6, 0xC1,
+    0x4A, 0x3E, 0xD7, 0xB2, 0x2D, 0x81, 0x0F, 0x1F, 0x42, 0x21, 0x75, 0x94, 0xD2, 0x82, 0xD5, 0xB3,
+    0x1A, 0xCA, 0x05, 0x17, 0x8B, 0x05, 0xA3, 0xC7, 0x56, 0x68, 0x83, 0x1A, 0x6C, 0x6C, 0x3D, 0xB9,
+    0x2E, 0x1E, 0xED, 0x76, 0xFD, 0x1B, 0xDA, 0x16, 0x7F, 0x2D, 0xF2, 0x64, 0xBA, 0x38, 0x41, 0xFF,
+    0xE2, 0x0A, 0x2E, 0xC8, 0x63, 0x27, 0x37, 0x53, 0xC6, 0x42, 0x5D, 0xB9, 0xD0, 0xAB, 0x5F, 0xD2,
+    0x87, 0x53, 0xB7, 0xF1, 0x3B, 0xCD, 0xC7, 0xEA, 0x3D, 0xD5, 0x93, 0xF3, 0x65, 0x6C, 0x3B, 0x13,
+    0xFB, 0xC6, 0x2C, 0xDA, 0x3D, 0xBB, 0x48, 0x5A, 0xF4, 0xF5, 0xCF, 0x2F, 0x6A, 0x4C, 0xEC, 0x3B,
+    0x13, 0xDB, 0xA1, 0x9C, 0xDC, 0x5C, 0xDF, 0x5A, 0xEF, 0x5F, 0x70, 0xA8, 0xC6, 0xE3, 0xA1, 0x4A,
+    0xA3, 0xB2, 0xDB, 0x3D, 0xBB, 0xF4, 0x7B, 0x01, 0x49, 0x6F, 0x46, 0xA8, 0x7E, 0xD4, 0x50, 0xF5,
+    0xBE, 0x9D, 0xE9, 0x87, 0x13, 0x43, 0x55, 0xA4, 0xA1, 0xFA, 0xDA, 0xCF, 0x30, 0x54, 0x3F, 0x67,
+    0x93, 0xF3, 0xC3, 0xB3, 0xA0, 0xFB, 0x67, 0xEC, 0xDC, 0x7B, 0xFA, 0x62, 0x3A, 0x31, 0x43, 0x7F,
+    0xF7, 0x69, 0xE8, 0xB5, 0xE0, 0xA4, 0xD9, 0xE8, 0x1B, 0x1A, 0x5D, 0x57, 0xC8, 0x04, 0xAA, 0xD9,
+    0x81, 0x5E, 0x78, 0x2A, 0xC1, 0xED, 0x6E, 0xCC, 0x76, 0xCF, 0xAE, 0x54, 0xD2, 0x88, 0xB4, 0x92,
+    0x1D, 0xB4, 0xE3, 0x86, 0xC4, 0xF7, 0x57, 0x07, 0x6C, 0x6C, 0xC9, 0xF5, 0xE0, 0x4C, 0x3F, 0xF6,
+    0x47, 0x7D, 0x34, 0xD2, 0x9A, 0xCC, 0x21, 0xA7, 0x0E, 0x36, 0x43, 0xE8, 0xA3, 0x11, 0xD9, 0xC9,
+    0x44, 0x37, 0x14, 0x87, 0xFF, 0xCB, 0xC9, 0xB6, 0xE5, 0x5A, 0x71, 0x52, 0xBE, 0x7E, 0x41, 0x45,
+    0x57, 0xC4, 0x24, 0x9E, 0xB9, 0xB1, 0x90, 0xBA, 0x4A, 0x2B, 0x67, 0x2E, 0xCC, 0xE0, 0x86, 0x11,
+    0xD9, 0xA1, 0x8C, 0xEE, 0xBB, 0xBD, 0x97, 0x16, 0x7A, 0x75, 0x9C, 0x3A, 0x4F, 0xD2, 0x9D, 0x8D,
+    0xD4, 0x40, 0x72, 0x69, 0xBA, 0xE5, 0x28, 0xA5, 0x42, 0xAB, 0xF4, 0xA8, 0xD6, 0x6A, 0xA5, 0x8C,
+    0x99, 0xBA, 0x3C, 0xE2, 0x02, 0x2B, 0x66, 0xA5, 0x87, 0xDE, 0xBB, 0x06, 0x3B, 0x55, 0x9E, 0x7C,
+    0xB5, 0x03, 0xB8, 0x17, 0x03, 0x94, 0x37, 0x26, 0x40, 0x11, 0xA8, 0x23, 0x69, 0x5D, 0x49, 0x0A,
+    0xFA, 0x1D, 0xAE, 0x83, 0x7B, 0x6A, 0x0F, 0x95, 0x06, 0x28, 0x34, 0x00, 0x1A, 0x8E, 0xBD, 0xA0,
+    0x5A, 0x8D, 0xC9, 0xB5, 0xEA, 0x87, 0x39, 0x6E, 0xA1, 0xA5, 0xD2, 0x37, 0x15, 0xDC, 0x62, 0x57,
+    0x9C, 0xAF, 0x66, 0x56, 0x5C, 0x28, 0x02, 0xED, 0xE0, 0x3C, 0xEA, 0x16, 0x32, 0x95, 0x01, 0x13,
+    0x5D, 0x43, 0x79, 0x3D, 0xA6, 0xA5, 0x8D, 0x5A, 0x40, 0x3B, 0x6F, 0x0A, 0x66, 0x32, 0x39, 0x6F,
+    0x08, 0xC9, 0x3F, 0x32, 0x11, 0x7A, 0x79, 0x8C, 0x96, 0xCD, 0x86, 0x5B, 0xBE, 0x0D, 0x70, 0x7B,
+    0xF7, 0x3F, 0x93, 0x84, 0x4B, 0xB3, 0xD6, 0x01, 0xFA, 0x73, 0x33, 0x64, 0x37, 0xA9, 0x1B, 0xC8,
+    0xA5, 0x17, 0xA4, 0x5E, 0x63, 0xAB, 0xC7, 0xD5, 0xE5, 0xA2, 0x1D, 0xE9, 0xB1, 0x11, 0xD7, 0xA1,
+    0xAE, 0xF6, 0xD4, 0xC1, 0x0E, 0x98, 0xA5, 0x08, 0xD0, 0x3F, 0x36, 0x81, 0xFD, 0x20, 0x42, 0xBE,
+    0x2E, 0x7B, 0xF5, 0x36, 0xD9, 0x70, 0xD5, 0x6D, 0x38, 0xFB, 0x6D, 0x76, 0x04, 0xFB, 0x40, 0x80,
+    0x42, 0x13, 0x64, 0xDA, 0x90, 0xF9, 0x93, 0x22, 0x53, 0x3E, 0xD7, 0x5D, 0x12, 0x95, 0x12, 0x27,
+    0xFE, 0x21, 0x69, 0xA9, 0xD5, 0x2B, 0xBA, 0x2E, 0x19, 0x0D, 0x1A, 0x4D, 0xCC, 0xD4, 0xD9, 0xD1,
+    0x88, 0x96, 0x62, 0x31, 0x11, 0x3B, 0xDB, 0x81, 0x2A, 0xF4, 0xE0, 0xAE, 0x4D, 0xD0, 0x7F, 0xD3,
+    0x83, 0x56, 0xC8, 0x15, 0x36, 0xBD, 0x3B, 0x39, 0xFC, 0xEC, 0x31, 0x45, 0x33, 0xC3, 0xE0, 0x3C,
+    0x65, 0x32, 0x29, 0x0C, 0xD0, 0xC7, 0x63, 0xF0, 0x96, 0x5F, 0xE2, 0x0E, 0x28, 0xFC, 0x3D, 0x50,
+    0x4C, 0xCE, 0x27, 0x19, 0xD5, 0xCC, 0xF5, 0x40, 0x3E, 0x55, 0x1D, 0xFC, 0x9E, 0x69, 0x4E, 0xD4,
+    0xAB, 0x56, 0xAC, 0x74, 0x43, 0x6B, 0xA1, 0xB9, 0x9D, 0xA9, 0x43, 0xB1, 0x52, 0x06, 0xE4, 0xCD,
+    0x8C, 0x9D, 0xF3, 0x48, 0x2E, 0x16, 0x70, 0x43, 0x0B, 0xE5, 0xEC, 0x1A, 0x50, 0xE5, 0xA1, 0x7E,
+    0x7F, 0x00, 0xA3, 0x40, 0x32, 0x37, 0x27, 0x9D, 0x23, 0x8F, 0x40, 0xB3, 0x02, 0x53, 0xBF, 0x47,
+    0x15, 0x2B, 0x35, 0x60, 0xD4, 0x9C, 0x70, 0x76, 0x03, 0xCA, 0x73, 0x03, 0x38, 0xEB, 0xC9, 0xE3,
+    0x15, 0xB0, 0xD7, 0x02, 0x3C, 0x52, 0x35, 0x64, 0xE1, 0x39, 0xC8, 0x68, 0xFE, 0x21, 0xE8, 0xEA,
+    0x74, 0xF7, 0x4F, 0x21, 0x93, 0x9D, 0xA0, 0x0A, 0x6A, 0x60, 0xB5, 0xE1, 0x63, 0xA8, 0xC0, 0x7F,
+    0x2E, 0x80, 0xEE, 0x16, 0xC3, 0x26, 0xE5, 0x78, 0x85, 0x4C, 0x36, 0x50, 0x05, 0xC1, 0x73, 0x1F,
+    0x27, 0xAC, 0x5E, 0x95, 0xDE, 0xD3, 0x07, 0x5A, 0xEC, 0x6C, 0xD6, 0x04, 0xCD, 0xCD, 0x66, 0xA1,
+    0xF7, 0x6E, 0x28, 0x16, 0xB3, 0xE0, 0xA4, 0x21, 0x93, 0x96, 0xCD, 0xA4, 0x6B, 0x8E, 0x31, 0xBA,
+    0x15, 0xCA, 0xE4, 0xAC, 0x35, 0xEC, 0x9D, 0x71, 0x5E, 0x96, 0x14, 0x2E, 0x4A, 0xB1, 0x58, 0xE8,
+    0x33, 0x35, 0x75, 0xD7, 0x0E, 0xC5, 0x58, 0x4D, 0x59, 0x38, 0xA9, 0xED, 0x26, 0x7D, 0xF8, 0xC7,
+    0x65, 0x64, 0xFD, 0x75, 0x4C, 0x62, 0xA3, 0x33, 0xE4, 0x2B, 0xD0, 0x36, 0xB7, 0x7A, 0x16, 0x6D,
+    0xC8, 0x99, 0x4D, 0xDA, 0xD6, 0x2B, 0x7A, 0x77, 0xB1, 0xB3, 0x1D, 0xD4, 0x3D, 0x6F, 0xE7, 0xD2,
+    0xAB, 0xBB, 0xE3, 0xA4, 0x47, 0xD1, 0x76, 0xFA, 0x4B, 0x7A, 0x0D, 0x56, 0x0B, 0xD4, 0x03, 0x59,
+    0x4C, 0x80, 0x7A, 0x84, 0xB2, 0x4B, 0x88, 0xFA, 0xD9, 0xEC, 0x69, 0xF6, 0xA8, 0x0E, 0xF4, 0x2F,
+    0x26, 0xA4, 0xFF, 0x5C, 0x04, 0xB8, 0x8D, 0xF3, 0xFC, 0x90, 0x58, 0x14, 0xA8, 0xB4, 0x48, 0x23,
+    0x95, 0x96, 0xBB, 0x56, 0x38, 0xAD, 0xA1, 0x58, 0x00, 0xF9, 0x9F, 0x78, 0xD2, 0xDA, 0x20, 0x5F,
+    0x48, 0x53, 0x3A, 0xAD, 0xC8, 0x17, 0x8B, 0x51, 0x7A, 0x44, 0x4D, 0x3A, 0x75, 0xB7, 0x9C, 0x1A,
+    0xF9, 0x62, 0x29, 0x84, 0xFC, 0x5D, 0xD2, 0x92, 0xE9, 0x6D, 0x49, 0x53, 0xA5, 0x55, 0x5A, 0x9B,
+    0x4A, 0xCB, 0xAD, 0x35, 0x33, 0x53, 0xDD, 0x40, 0x11, 0x5B, 0x0F, 0xC5, 0xDC, 0x7A, 0xB8, 0x65,
+    0xB1, 0x3C, 0xD9, 0x84, 0xCE, 0x68, 0x91, 0x1A, 0xA3, 0x58, 0xCD, 0xD0, 0x0E, 0x76, 0x22, 0xC1,
+    0xD3, 0xB8, 0xC1, 0x1E, 0x3D, 0x8D, 0x1B, 0xAC, 0xD4, 0xB9, 0xC1, 0x4A, 0x83, 0x1B, 0xEC, 0x54,
+    0x07, 0x37, 0xD8, 0xC9, 0x9E, 0x48, 0xAB, 0xE0, 0x06, 0x7B, 0xBD, 0x1F, 0xDA, 0xB1, 0x97, 0x1E,
+    0xD3, 0x22, 0x5D, 0x37, 0x27, 0x2B, 0x64, 0x12, 0x46, 0x23, 0xF9, 0x8B, 0x52, 0xCC, 0xD4, 0xD4,
+    0xBE, 0x9A, 0xF2, 0x39, 0x53, 0x53, 0x75, 0xD5, 0x94, 0x85, 0x4C, 0x4D, 0x1A, 0x7C, 0x27, 0x61,
+    0xA4, 0xC0, 0x71, 0xCE, 0x0F, 0x5F, 0x9C, 0xD6, 0xDB, 0xE9, 0x19, 0x27, 0x35, 0x9B, 0xD3, 0x80,
+    0xED, 0xE0, 0xBE, 0x19, 0xAC, 0x00, 0x8D, 0x50, 0xBC, 0x7D, 0x0C, 0xC8, 0xBC, 0x25, 0xE9, 0x51,
+    0xBD, 0xBB, 0x9A, 0x35, 0x9F, 0xEC, 0x5C, 0x0C, 0x6E, 0xAC, 0x50, 0x47, 0xAB, 0x89, 0x4B, 0xEB,
+    0x21, 0x6E, 0xBC, 0xA9, 0xB9, 0x2C, 0xE4, 0x09, 0x85, 0x07, 0xBE, 0x0C, 0xD9, 0x44, 0x7E, 0xC1,
+    0x63, 0xD7, 0x64, 0x77, 0xB8, 0xF3, 0xE6, 0xB2, 0x70, 0x4D, 0x8B, 0xD3, 0xEC, 0xE4, 0xDB, 0x48,
+    0x3B, 0x24, 0x77, 0x9E, 0x42, 0xF9, 0x02, 0xF5, 0xDC, 0x76, 0xD0, 0xBF, 0x19, 0xF6, 0xDE, 0x3C,
+    0x56, 0x1C, 0x33, 0xB7, 0x84, 0x6A, 0x2D, 0x40, 0xDB, 0x07, 0xB0, 0xDF, 0x56, 0x87, 0x89, 0xE5,
+    0xBA, 0xF9, 0xF2, 0xD4, 0x63, 0x26, 0x5F, 0xAE, 0x4D, 0xB9, 0x16, 0x5A, 0x71, 0xA1, 0xD7, 0x90,
+    0x9C, 0xE6, 0x12, 0x72, 0xA6, 0x66, 0xF3, 0x80, 0xCF, 0x2E, 0x2D, 0x40, 0x9D, 0x8C, 0x2D, 0xDD,
+    0xCF, 0xE2, 0xC8, 0x13, 0x4E, 0x3A, 0xF2, 0x94, 0x33, 0x7D, 0xE7, 0x06, 0xB7, 0x66, 0x2A, 0x35,
+    0x96, 0xF3, 0xE6, 0xFD, 0x61, 0xE2, 0xB6, 0x5C, 0x99, 0x08, 0xA7, 0xD5, 0x60, 0x34, 0x42, 0xF9,
+    0xD4, 0x4F, 0x6C, 0xBC, 0x51, 0xBE, 0x40, 0xF5, 0xB1, 0xC6, 0x9F, 0xBA, 0xA8, 0xAF, 0x83, 0xA4,
+    0xC0, 0xED, 0x97, 0xF4, 0xEE, 0x66, 0xBA, 0xA6, 0x6D, 0x4F, 0x34, 0x7E, 0x01, 0x35, 0x2E, 0x1C,
+    0x37, 0xBE, 0xD2, 0xE3, 0x5A, 0xAD, 0x74, 0xD3, 0x8F, 0xE9, 0xC7, 0xB5, 0xAD, 0x52, 0xC3, 0xA7,
+    0x74, 0xD4, 0x19, 0x69, 0xE1, 0x8C, 0x3E, 0x6A, 0xA8, 0x3F, 0xE6, 0xA4, 0x14, 0xDC, 0x6A, 0xF5,
+    0x9E, 0xBE, 0xAD, 0xF5, 0x77, 0x77, 0xC7, 0xC7, 0x53, 0xE7, 0x3F, 0xFF, 0x3F, 0x54, 0x4D, 0x70,
+    0xFF, 0xEE, 0x4F, 0x6F, 0xE7, 0xA9, 0x1F, 0xFF, 0x07, 0x50, 0x34, 0x7C, 0x02, 0x3E, 0xFD, 0xF0,
+    0xB3, 0x6F, 0xEC, 0x2E, 0x3F, 0x55, 0xFC, 0x37, 0xD9, 0xF0, 0xD4, 0x97, 0x6E, 0x87, 0xA7, 0xF8,
+    0x69, 0x93, 0x74, 0x7C, 0x82, 0xA2, 0xC9, 0x3C, 0x8F, 0xEC, 0xFE, 0xE4, 0xDD, 0xFF, 0xFB, 0x13,
+    0xFC, 0xDE, 0x97, 0x4E, 0x33, 0xFC, 0x1E, 0xA7, 0xE1, 0xA7, 0x4F, 0x80, 0x3A, 0xB9, 0x31, 0x73,
+    0xEB, 0xB5, 0x8E, 0x8F, 0xA0, 0x1F, 0x75, 0xC4, 0x33, 0xD9, 0x3F, 0x8F, 0xD5, 0x4B, 0xA1, 0xAD,
+    0x5F, 0x88, 0x7D, 0xF1, 0xBD, 0x5F, 0xF8, 0xF2, 0x83, 0x6F, 0xDD, 0xDE, 0xED, 0x76, 0xBB, 0x7F,
+    0x9B, 0x90, 0xBB, 0x4D, 0x79, 0xC4, 0x6C, 0x3F, 0x7B, 0x69, 0x39, 0xDD, 0xF5, 0x9D, 0xF2, 0x58,
+    0x86, 0xBA, 0x89, 0xE5, 0x70, 0x2F, 0x70, 0x5B, 0x31, 0xE9, 0xC9, 0xA0, 0x22, 0xB8, 0x7C, 0xB6,
+    0xFE, 0xCE, 0xD3, 0xDD, 0x1F, 0xD5, 0x6F, 0x2D, 0xF6, 0x03, 0x95, 0x41, 0x65, 0x58, 0xCB, 0x61,
+    0xB1, 0x2F, 0xC4, 0xFA, 0x73, 0xD3, 0xBD, 0x66, 0x00, 0x6E, 0xCB, 0x9A, 0xF6, 0x81, 0x49, 0x4F,
+    0x4E, 0xB2, 0x41, 0x76, 0x6C, 0xCB, 0xD1, 0x15, 0xA1, 0x7E, 0x6C, 0xB2, 0x3E, 0x66, 0xCD, 0x1D,
+    0x9C, 0x6A, 0xD8, 0x00, 0x92, 0x3C, 0x42, 0xE5, 0xF3, 0xFF, 0x7D, 0xFE, 0x97, 0x4E, 0x7A, 0x4D,
+    0x5A, 0xDC, 0x37, 0xBF, 0x31, 0x30, 0x83, 0xED, 0xC8, 0x66, 0xA8, 0xB6, 0x53, 0x7A, 0xB2, 0x3E,
+    0x3E, 0xED, 0x3F, 0x51, 0x1F, 0x7F, 0xE2, 0x70, 0xFF, 0x89, 0xF5, 0xDE, 0x0B, 0xE9, 0x13, 0xD5,
+    0xFE, 0x1E, 0xCC, 0xDC, 0xFB, 0xE0, 0xBF, 0x79, 0x4D, 0x5A, 0x9D, 0xF4, 0xEA, 0xE1, 0xFC, 0x2F,
+    0xA9, 0x3C, 0x59, 0xFA, 0x92, 0x59, 0xE0, 0x54, 0xC3, 0xED, 0x9D, 0x5E, 0x52, 0xBB, 0xF6, 0x93,
+    0xBA, 0x87, 0xF8, 0x12, 0x76, 0x42, 0x93, 0xD5, 0x24, 0xBD, 0xAF, 0x55, 0xAB, 0x5D, 0x59, 0x39,
+    0x0D, 0xE4, 0x4B, 0xFB, 0x8E, 0xDC, 0x70, 0x1E, 0xB0, 0xA3, 0x7B, 0x39, 0xD6, 0x3F, 0x50, 0xB9,
+    0xF4, 0x2F, 0xE8, 0x54, 0x73, 0x86, 0xCC, 0x2C, 0xED, 0x0F, 0xB4, 0x01, 0x81, 0x89, 0xE4, 0x7E,
+    0xEF, 0x9F, 0xBD, 0x91, 0xFF, 0x3D, 0x90, 0x5C, 0xF7, 0x27, 0x7F, 0xF3, 0xCB, 0x3F, 0x2F, 0xC9,
+    0x1D, 0x52, 0x37, 0xC5, 0xFF, 0x95, 0xFD, 0x87, 0x4F, 0xFF, 0xF6, 0x53, 0xFE, 0x67, 0xAA, 0xC2,
+    0x3E, 0x49, 0xF0, 0xD6, 0x6B, 0x0D, 0x5F, 0x1A, 0xF9, 0xC4, 0x67, 0x1E, 0xBE, 0xF4, 0xDF, 0xBD,
+    0x7B, 0xE9, 0xBF, 0x1D, 0x3E, 0xF1, 0xE9, 0xE1, 0x0F, 0x87, 0x57, 0xAE, 0x35, 0x03, 0xFC, 0x1C,
+    0x7F, 0xDB, 0x37, 0x5F, 0x6C, 0xCA, 0x4F, 0xF0, 0x9B, 0x5F, 0xE2, 0xFF, 0x39, 0x7A, 0xE6, 0x0F,
+    0x8F, 0x9E, 0xFD, 0xC7, 0x9F, 0x2E, 0x8A, 0x7F, 0x54, 0x64, 0xD7, 0xEE, 0x87, 0xE2, 0xE7, 0xFA,
+    0x3B, 0x89, 0xB4, 0x9E, 0x87, 0xBF, 0x48, 0x72, 0xF6, 0xBC, 0x59, 0xCD, 0x0A, 0xCD, 0x9B, 0x97,
+    0x9E, 0xBB, 0x7F, 0x4A, 0x81, 0x0D, 0x59, 0xB4, 0x63, 0x72, 0xDF, 0x2B, 0xC7, 0xBA, 0x7B, 0x24,
+    0x4D, 0xCA, 0xAE, 0x37, 0xC9, 0xC8, 0xB7, 0xE6, 0x73, 0xDD, 0x25, 0x59, 0xBE, 0x1C, 0x93, 0x15,
+    0xB0, 0x08, 0xAE, 0x1C, 0xDA, 0x43, 0x2E, 0x1E, 0xDA, 0xBF, 0x8E, 0xCE, 0x6A, 0x28, 0x35, 0x56,
+    0xBA, 0x1A, 0xFA, 0x8B, 0xBE, 0xBD, 0x38, 0x94, 0x53, 0xF5, 0x58, 0x70, 0x8F, 0x85, 0xBA, 0x83,
+    0x58, 0xF9, 0x2B, 0x95, 0x6F, 0xA1, 0x18, 0xAF, 0x64, 0xB1, 0xCD, 0x22, 0xB8, 0x7C, 0x2E, 0x3E,
+    0x88, 0x45, 0x20, 0x9F, 0xCB, 0xB1, 0x7E, 0x3C, 0x54, 0x1E, 0xEB, 0x6B, 0x7F, 0xB9, 0xF2, 0x57,
+    0x60, 0xC1, 0x9D, 0x0B, 0xEE, 0xDC, 0x44, 0x11, 0xE8, 0x53, 0xA8, 0x96, 0x6B, 0xE8, 0x27, 0xFA,
+    0x19, 0xBE, 0x0C, 0x67, 0x6E, 0x91, 0x97, 0x01, 0xC6, 0x3C, 0x9A, 0x58, 0xCC, 0x36, 0x54, 0xA3,
+    0xF3, 0x8E, 0xDF, 0xDA, 0xB2, 0x7F, 0x99, 0x29, 0x8F, 0x76, 0x70, 0x57, 0x97, 0x62, 0x76, 0x5E,
+    0xE5, 0x5C, 0x8D, 0x32, 0xB1, 0xF2, 0x2E, 0x9F, 0xF2, 0xE1, 0x37, 0x4E, 0xBE, 0x6F, 0x9B, 0x3F,
+    0xCA, 0xA3, 0x1D, 0x56, 0x13, 0xEB, 0x57, 0xD6, 0x62, 0x76, 0xD7, 0x16, 0x1B, 0xFA, 0xC7, 0x63,
+    0x35, 0xAA, 0x0C, 0xEE, 0x85, 0x68, 0x47, 0x97, 0x4F, 0x95, 0xFF, 0xAD, 0x6C, 0x3C, 0x36, 0x49,
+    0x97, 0xB8, 0xC6, 0x79, 0x37, 0x54, 0xA1, 0x9C, 0xCC, 0x4C, 0xDC, 0x82, 0x41, 0xCA, 0xE6, 0x8F,
+    0x6C, 0xE8, 0x4D, 0xAC, 0xC7, 0xFE, 0xB1, 0x68, 0x43, 0x7F, 0xDF, 0x6A, 0x43, 0xFD, 0xC2, 0x62,
+    0xA6, 0xBA, 0xFB, 0x8C, 0x39, 0xD6, 0x52, 0xFF, 0xA2, 0xE8, 0xBE, 0x6C, 0x43, 0x6F, 0x26, 0x77,
+    0x75, 0xB5, 0xA1, 0x7F, 0x2C, 0xBA, 0x41, 0xE5, 0xD4, 0xBE, 0xB0, 0xDA, 0xD0, 0xE7, 0xB1, 0x1A,
+    0x56, 0x33, 0xD5, 0x8F, 0x46, 0xD3, 0x7D, 0x36, 0xDB, 0x08, 0xE4, 0xD7, 0xA0, 0xEA, 0xA8, 0x66,
+    0xAA, 0xF7, 0xBB, 0xEA, 0xEA, 0x6C, 0x7D, 0xDD, 0xF1, 0xCB, 0x54, 0xBE, 0x1E, 0xEA, 0xC1, 0x6D,
+    0xB8, 0xD4, 0x60, 0x16, 0x6A, 0x9F, 0x05, 0xF8, 0x0C, 0x7D, 0x53, 0x0F, 0x76, 0x36, 0x6B, 0x26,
+    0xB3, 0x96, 0x73, 0x3D, 0xB4, 0xCD, 0x97, 0x81, 0x4F, 0x02, 0x4F, 0xF8, 0xDB, 0xB9, 0xD7, 0xE5,
+    0xB3, 0xF5, 0x73, 0xFD, 0xD5, 0x60, 0xC6, 0x70, 0x99, 0xAA, 0xAB, 0x1B, 0x1E, 0x29, 0x06, 0xB2,
+    0x8F, 0x26, 0xAA, 0x72, 0xB5, 0xE7, 0xE6, 0xFA, 0xAB, 0xB1, 0x3E, 0x17, 0x2B, 0x7F, 0xFE, 0x28,
+    0x9C, 0xC7, 0x59, 0x8F, 0xF5, 0x0E, 0x13, 0xCE, 0x47, 0x62, 0xFD, 0x58, 0xA8, 0xF3, 0x68, 0x9F,
+    0x18, 0xAA, 0xE6, 0xDE, 0x4F, 0x43, 0xE6, 0x01, 0xCE, 0x36, 0x67, 0x9F, 0x98, 0x4D, 0x54, 0xD7,
+    0xBE, 0x3C, 0x95, 0x51, 0x4D, 0xFF, 0x64, 0x28, 0x67, 0xD1, 0x3F, 0x19, 0xCA, 0x49, 0xB4, 0x0F,
+    0x86, 0x62, 0xEA, 0x69, 0x1F, 0x08, 0x66, 0x6A, 0x71, 0xF7, 0x07, 0x33, 0x39, 0xDC, 0xB9, 0x90,
+    0x4F, 0x9B, 0x6A, 0x5A, 0x37, 0xD5, 0x13, 0xD1, 0xAC, 0xBD, 0x6F, 0xDF, 0x89, 0x66, 0x39, 0xC3,
+    0x29, 0x0E, 0x0E, 0x0E, 0xFE, 0xFB, 0x8D, 0x05, 0xEF, 0x76, 0xBB, 0x67, 0xC8, 0xF5, 0xBE, 0xFA,
+    0x63, 0xF1, 0xCB, 0x74, 0x50, 0x77, 0x49, 0xCA, 0x1D, 0xC1, 0x41, 0x3E, 0x25, 0xB9, 0xF7, 0x72,
+    0x12, 0xA5, 0xEB, 0xE4, 0xFC, 0x65, 0x3D, 0x3C, 0xB2, 0xE5, 0x34, 0xE9, 0xF1, 0x01, 0x5A, 0x30,
+    0x53, 0xE2, 0x85, 0x4B, 0xB2, 0xB8, 0x9B, 0x8F, 0x29, 0xEC, 0x4D, 0xA6, 0xC1, 0x28, 0x22, 0x21,
+    0x79, 0xA7, 0x50, 0xBF, 0x3F, 0xDB, 0x1B, 0x6B, 0x46, 0x0B, 0xB5, 0xA7, 0x1C, 0xC9, 0x27, 0x98,
+    0xE1, 0x5E, 0x68, 0xA1, 0xEA, 0xB2, 0xBE, 0xE3, 0xE2, 0x78, 0x97, 0x86, 0xD3, 0x0A, 0x95, 0xC6,
+    0x42, 0x53, 0xA1, 0x21, 0xD7, 0x98, 0xAD, 0xD0, 0x76, 0xDC, 0x0B, 0xB6, 0xC3, 0x76, 0xC9, 0xAD,
+    0xE1, 0xC4, 0x51, 0x75, 0x14, 0xE3, 0x16, 0x65, 0x53, 0xAC, 0xE4, 0x6A, 0x10, 0xB4, 0x9E, 0x53,
+    0xB0, 0xD9, 0x24, 0x7F, 0xBF, 0x50, 0x43, 0xFF, 0x98, 0x22, 0x6E, 0x94, 0xBC, 0x9D, 0xEA, 0xF7,
+    0x67, 0xB3, 0x64, 0xB4, 0x08, 0xCA, 0xD1, 0x79, 0x98, 0x6D, 0x80, 0xD6, 0x44, 0xB2, 0xBE, 0x13,
+    0x77, 0x69, 0x70, 0xBE, 0xD2, 0x58, 0x86, 0x42, 0x43, 0x1E, 0xB3, 0x15, 0x5A, 0xEE, 0x85, 0xCA,
+    0xDB, 0x2E, 0xE9, 0x19, 0x7B, 0x2D, 0xB2, 0xEA, 0x28, 0x87, 0x6A, 0xA2, 0x8C, 0xC5, 0x8A, 0x11,
+    0x82, 0xDE, 0x9F, 0x82, 0x53, 0xCD, 0xD9, 0x06, 0xF2, 0x15, 0x0D, 0x76, 0xB6, 0x0A, 0x6E, 0x70,
+    0x0A, 0x6A, 0xFA, 0xFE, 0xC3, 0x48, 0x53, 0xBD, 0x19, 0xA0, 0xEA, 0xFD, 0x86, 0x07, 0x28, 0xC2,
+    0xC5, 0x1B, 0x81, 0x8B, 0xBA, 0xE8, 0x0B, 0xCD, 0x2D, 0x95, 0xEE, 0x8B, 0xB8, 0xCE, 0x04, 0x22,
+    0xD6, 0xE7, 0xE1, 0x26, 0xFC, 0x90, 0x4F, 0x3C, 0x42, 0x1D, 0xCC, 0x4A, 0xEF, 0xAB, 0x39, 0x13,
+    0x6E, 0xC8, 0xCE, 0x1F, 0x8B, 0xA0, 0xBB, 0x26, 0x7B, 0x54, 0x4B, 0x76, 0x5D, 0xD2, 0x72, 0x39,
+    0xD7, 0xFA, 0xCB, 0x94, 0xD7, 0x6F, 0x91, 0xFE, 0xBB, 0x7B, 0xB2, 0xF1, 0x97, 0xA9, 0xFD, 0x62,
+    0xC7, 0x1E, 0x95, 0x53, 0xFB, 0x58, 0x2C, 0x66, 0x77, 0x6D, 0xA9, 0x46, 0x77, 0x75, 0xAD, 0x82,
+    0xB2, 0xD5, 0x86, 0xBE, 0x98, 0x6D, 0x68, 0xCD, 0xEC, 0xBC, 0xCB, 0xA7, 0xCA, 0x47, 0xFE, 0xA2,
+    0xE8, 0x3E, 0x9B, 0xDF, 0x44, 0x7E, 0x2F, 0x1E, 0xA2, 0x15, 0xF5, 0x43, 0x6F, 0xA2, 0xEB, 0x5A,
+    0x3B, 0x54, 0xAF, 0x07, 0xF3, 0x51, 0xCC, 0x96, 0xB6, 0x69, 0xED, 0x50, 0x5F, 0x8B, 0xD5, 0xD0,
+    0x2A, 0x14, 0x1A, 0x39, 0xDB, 0x40, 0xF6, 0xE7, 0xE4, 0x91, 0x4C, 0x64, 0xF2, 0xDC, 0x08, 0xC4,
+    0xC8, 0xF3, 0x8E, 0xAF, 0x58, 0xEF, 0x3E, 0xFF, 0x91, 0x95, 0x5E, 0x91, 0x02, 0xD6, 0x63, 0x02,
+    0x7C, 0x8B, 0xD3, 0xBB, 0xC3, 0x5A, 0x5E, 0x32, 0x01, 0x3B, 0xE0, 0x66, 0xB4, 0x50, 0x44, 0x8A,
+    0x40, 0xE5, 0xB3, 0xD5, 0x2A, 0xB8, 0x95, 0x4F, 0x35, 0x50, 0x8E, 0xB9, 0x06, 0xF7, 0x91, 0x59,
+    0xA8, 0x07, 0xB4, 0x16, 0x52, 0xF5, 0xC2, 0xDA, 0xE7, 0xD7, 0x63, 0xF9, 0xE1, 0xE4, 0x9E, 0x50,
+    0x2C, 0xE5, 0x4F, 0x3F, 0xCD, 0xD9, 0xDD, 0xA1, 0xF4, 0x96, 0xF4, 0x64, 0x17, 0x3F, 0x5B, 0x0E,
+    0x3C, 0x82, 0x09, 0xD4, 0x1D, 0x91, 0x72, 0xC4, 0x35, 0x44, 0x4C, 0xE0, 0x74, 0x43, 0x76, 0xA5,
+    0x71, 0xFA, 0xEA, 0xDC, 0x5A, 0x1F, 0xDD, 0xB9, 0xD0, 0xF6, 0x4D, 0x3B, 0x15, 0x9A, 0x5D, 0xF9,
+    0xFD, 0xB9, 0x7C, 0x6F, 0x74, 0x17, 0xFE, 0x3A, 0xD6, 0xF2, 0xA7, 0xBF, 0x46, 0xBE, 0xD0, 0xCA,
+    0xAC, 0xAA, 0xFC, 0xD2, 0x9B, 0xEB, 0xB1, 0x7C, 0xEB, 0x7A, 0xFB, 0xB8, 0x96, 0x5C, 0x01, 0xD7,
+    0x95, 0xF1, 0x76, 0x79, 0x37, 0xF3, 0x4F, 0x13, 0x49, 0xBC, 0x31, 0x5B, 0xA9, 0x71, 0xF7, 0x8F,
+    0xB6, 0x8B, 0x66, 0x74, 0xCC, 0xD6, 0xDF, 0x6B, 0x42, 0xE5, 0x97, 0x7A, 0xD6, 0xBF, 0x7B, 0x28,
+    0x59, 0x52, 0xDA, 0x99, 0x5E, 0xBE, 0xFD, 0xC6, 0xEC, 0x7C, 0x6F, 0x87, 0xEA, 0xC5, 0x50, 0x7C,
+    0x14, 0x59, 0x5A, 0x5A, 0x3B, 0x54, 0xD7, 0x66, 0x3B, 0xF6, 0xDF, 0x0C, 0x56, 0x13, 0xFD, 0xB4,
+    0x9F, 0x50, 0x43, 0xBD, 0x1A, 0x8D, 0xA7, 0x56, 0xEC, 0xC8, 0xC9, 0xA4, 0x9A, 0x6A, 0x7D, 0x4F,
+    0x2B, 0x77, 0x50, 0xAD, 0xB9, 0x54, 0xFD, 0x75, 0x6C, 0x8B, 0xE9, 0xE9, 0xCA, 0xB3, 0x62, 0x03,
+    0xC2, 0x8E, 0xD9, 0x4A, 0x25, 0xB5, 0x8A, 0xBD, 0x3A, 0xEE, 0xA0, 0x5E, 0x8D, 0xD6, 0xEA, 0xAB,
+    0xF1, 0x9F, 0x94, 0x81, 0xB6, 0xA9, 0x27, 0x34, 0xE5, 0x17, 0x02, 0x95, 0xA7, 0x3F, 0x75, 0x71,
+    0x6E, 0xD5, 0xE9, 0xED, 0xE3, 0x65, 0x2F, 0x82, 0x40, 0x9E, 0x3E, 0xF0, 0x95, 0xC8, 0xBD, 0x0E,
+    0x67, 0x7D, 0x6D, 0x82, 0x95, 0xAE, 0x49, 0xD3, 0x99, 0x0B, 0x7F, 0x89, 0x09, 0x5B, 0xCC, 0x4B,
+    0xA9, 0x50, 0xCB, 0xAF, 0xCF, 0x98, 0x80, 0x7D, 0x1B, 0xB7, 0x72, 0x69, 0xC5, 0x44, 0x8A, 0x40,
+    0xFD, 0xC2, 0xE7, 0x17, 0xAB, 0xB1, 0x3E, 0xE6, 0x3D, 0xBD, 0xAF, 0x74, 0x9F, 0x9A, 0x6A, 0x44,
+    0x4F, 0x1B, 0x2D, 0xD5, 0x7B, 0x4B, 0x6F, 0x8E, 0x62, 0xF9, 0x83, 0x50, 0x3F, 0xF9, 0xD1, 0x52,
+    0x69, 0x4C, 0x11, 0x56, 0x4E, 0x93, 0xF4, 0xD6, 0x51, 0xFF, 0xE0, 0x7D, 0xF3, 0x6F, 0x5A, 0xCF,
+    0x65, 0x8A, 0x80, 0x6B, 0xB2, 0x88, 0xBD, 0x39, 0x7E, 0xC9, 0xE5, 0xAD, 0x5A, 0xB3, 0x55, 0xD6,
+    0x47, 0x67, 0x82, 0xAA, 0x4E, 0x73, 0xA6, 0xB1, 0x7E, 0xFF, 0x83, 0x68, 0xDF, 0x18, 0xEB, 0x4B,
+    0x7E, 0x71, 0xC7, 0x45, 0xDF, 0x41, 0xBD, 0xE4, 0x5A, 0xEC, 0xAB, 0xB1, 0x35, 0xDF, 0x8F, 0xF6,
+    0x9D, 0x50, 0x3F, 0x79, 0xB4, 0x58, 0x4D, 0x59, 0xEB, 0xF3, 0x85, 0x76, 0x6C, 0x57, 0x74, 0x98,
+    0xD0, 0x34, 0xAD, 0xFD, 0x66, 0xDB, 0x36, 0x2B, 0xAD, 0x59, 0x71, 0x66, 0xE5, 0xEE, 0x64, 0x24,
+    0x03, 0xA3, 0x67, 0x43, 0x0A, 0x1A, 0x55, 0xD8, 0xE7, 0xB5, 0x9A, 0x69, 0x15, 0xF9, 0xD5, 0xF5,
+    0x3C, 0x66, 0x4D, 0x21, 0x1F, 0x29, 0x6F, 0x3E, 0xD6, 0x10, 0x0F, 0x93, 0x09, 0xDC, 0xBD, 0x17,
+    0x29, 0xA7, 0x7A, 0x40, 0x44, 0xAA, 0xC1, 0x36, 0xF9, 0xB2, 0x69, 0x59, 0xAD, 0xD4, 0x94, 0x52,
+    0xA0, 0x88, 0x70, 0xAA, 0xFF, 0x7F, 0x9F, 0x42, 0x5A, 0xB9, 0x5D, 0xEF, 0x1E, 0x26, 0x5F, 0x21,
+    0x01, 0xD5, 0xC0, 0x9D, 0x4E, 0xD2, 0x35, 0x49, 0xB1, 0xBA, 0x21, 0x35, 0x5F, 0x4C, 0x06, 0x85,
+    0xED, 0xF8, 0x03, 0xAD, 0xCD, 0xB1, 0x00, 0xDE, 0x6D, 0x50, 0xEE, 0x7B, 0x7B, 0x93, 0x8E, 0xF2,
+    0x2D, 0xE8, 0xAE, 0x8C, 0x66, 0x49, 0x4E, 0x38, 0x75, 0x28, 0xE7, 0x14, 0x04, 0xD2, 0xFB, 0x7A,
+    0x4C, 0x9E, 0x5A, 0x42, 0xCD, 0xFA, 0x10, 0x0F, 0x37, 0x65, 0x2C, 0x63, 0xAF, 0xB9, 0x96, 0xAF,
+    0x3F, 0xD2, 0xAB, 0xD2, 0xAB, 0x6B, 0x4B, 0xAF, 0x85, 0xB6, 0xB3, 0xC3, 0x97, 0x73, 0xA9, 0xCB,
+    0x56, 0x9C, 0x3F, 0x2C, 0x17, 0x28, 0x66, 0xFA, 0x89, 0x3A, 0x40, 0x35, 0xA2, 0x48, 0xEF, 0xA1,
+    0xED, 0xE8, 0x63, 0xAE, 0x04, 0x93, 0x55, 0x53, 0x19, 0xA1, 0x88, 0xCC, 0x76, 0x68, 0x8F, 0x1A,
+    0xAA, 0xEB, 0xFF, 0xE7, 0xE8, 0x1E, 0x4C, 0xB1, 0x54, 0x2F, 0x2B, 0x3A, 0x45, 0x68, 0x97, 0x7D,
+    0xDC, 0xDF, 0xA9, 0x9B, 0xF8, 0x67, 0xAE, 0xB7, 0xC9, 0xF7, 0xE0, 0x79, 0x3D, 0x95, 0x63, 0x11,
+    0xB9, 0x8C, 0x28, 0x7D, 0x35, 0xC2, 0xAF, 0xAE, 0xBB, 0xCE, 0x48, 0x91, 0x7F, 0xB6, 0xEE, 0x1A,
+    0xDA, 0xD4, 0x8D, 0x94, 0x52, 0xE0, 0x57, 0x97, 0x87, 0x92, 0x96, 0x9E, 0xAB, 0x01, 0xBB, 0x72,
+    0x8A, 0x36, 0x21, 0x56, 0x91, 0x5C, 0x6A, 0x92, 0x43, 0xC1, 0xDE, 0x1F, 0xAD, 0x0C, 0x9B, 0x53,
+    0x69, 0xBA, 0xD8, 0xED, 0x76, 0x8F, 0x4B, 0xD2, 0x83, 0x92, 0x96, 0xEA, 0xAF, 0x1E, 0xDE, 0x3D,
+    0x55, 0x7B, 0xA0, 0x1E, 0xF6, 0x0E, 0xD2, 0xBF, 0x79, 0x8B, 0x55, 0xD0, 0x63, 0x23, 0x56, 0xDE,
+    0x2A, 0xDA, 0x37, 0xDF, 0x7F, 0xE9, 0xAD, 0x0F, 0xE7, 0x10, 0x3F, 0x8B, 0x63, 0xCF, 0xDF, 0x22,
+    0x3F, 0xEE, 0xC7, 0xCD, 0x65, 0xB3, 0xDB, 0xBB, 0x66, 0xB5, 0xE9, 0x6A, 0xB7, 0xDB, 0xF5, 0x8F,
+    0x4B, 0x52, 0x25, 0x29, 0x7E, 0x6A, 0xF7, 0xA7, 0x17, 0x86, 0xCD, 0xB1, 0xB4, 0xDA, 0x07, 0xD7,
+    0x30, 0xDE, 0x52, 0x87, 0x9F, 0x5C, 0x52, 0xBC, 0xE3, 0xB3, 0xCE, 0xD6, 0x2F, 0xBF, 0xFC, 0xD6,
+    0x8D, 0x1B, 0xC1, 0x29, 0x18, 0x05, 0xDC, 0x48, 0x7E, 0xE2, 0x13, 0x43, 0xE6, 0xB1, 0x43, 0xE5,
+    0x11, 0xCE, 0xDB, 0x91, 0xBA, 0xEB, 0x77, 0xBB, 0xFE, 0x09, 0x49, 0xBA, 0x20, 0x69, 0xA9, 0xFF,
+    0xEA, 0xE0, 0xC2, 0x58, 0x77, 0x5C, 0xC1, 0xF9, 0x6A, 0xC4, 0xE1, 0xE0, 0xB7, 0xF9, 0xE4, 0xF6,
+    0xF6, 0x6D, 0xFB, 0x7E, 0xA8, 0xE4, 0x2B, 0x2D, 0xD5, 0x9B, 0x6F, 0x5E, 0x7B, 0xEB, 0x7B, 0xE3,
+    0x27, 0xE3, 0x27, 0x6F, 0xA9, 0xD0, 0x2F, 0xB9, 0x5F, 0xB2, 0x4F, 0xBE, 0x74, 0xED, 0x07, 0x3F,
+    0x38, 0xAE, 0x43, 0xC0, 0x04, 0xB8, 0x23, 0x21, 0x6E, 0x7D, 0x47, 0xA9, 0x0E, 0xC9, 0xDB, 0xF7,
+    0xDF, 0xF7, 0xCE, 0x39, 0x7E, 0x3B, 0xFE, 0x36, 0x26, 0x24, 0x61, 0xC4, 0xC1, 0x1F, 0xC6, 0x4F,
+    0x17, 0x1F, 0x7E, 0x18, 0x4A, 0xA9, 0x2B, 0x35, 0x53, 0xAA, 0xA3, 0x98, 0x38, 0xF3, 0x85, 0xAF,
+    0x9F, 0xDF, 0xA6, 0x85, 0x95, 0x22, 0xD4, 0x1D, 0xE5, 0x48, 0x3E, 0xC3, 0x95, 0x13, 0x3F, 0x0E,
+    0xAF, 0x70, 0xB9, 0xEE, 0xFA, 0x07, 0xC6, 0x3E, 0x9F, 0x7A, 0x2E, 0xB7, 0xD2, 0x45, 0xE9, 0x35,
+    0x69, 0x72, 0x0D, 0xC5, 0x0C, 0x6D, 0x47, 0xE1, 0xA1, 0xB9, 0xE5, 0xA5, 0x93, 0x3F, 0x7E, 0x8D,
+    0x2B, 0x55, 0x57, 0x3F, 0x3E, 0x97, 0xA3, 0x7B, 0x74, 0x36, 0x73, 0x2B, 0x5D, 0x90, 0xDE, 0x91,
+    0x02, 0x45, 0xA0, 0x0C, 0x94, 0x13, 0x4C, 0x70, 0x1B, 0xC0, 0xD9, 0x2D, 0xA2, 0xC7, 0x4C, 0x04,
+    0x16, 0x7A, 0x5C, 0xD3, 0x37, 0x76, 0xB8, 0x82, 0x99, 0xFA, 0x83, 0x83, 0xA5, 0xDD, 0x7A, 0xF5,
+    0xEA, 0x72, 0x70, 0x70, 0xBE, 0xEE, 0x36, 0x8C, 0xDB, 0x79, 0x38, 0x16, 0x74, 0x73, 0x00, 0xB7,
+    0x8F, 0xBB, 0x71, 0x1D, 0xE4, 0xCB, 0xC1, 0xEE, 0xE9, 0x5A, 0xD2, 0xAB, 0x92, 0x74, 0xA1, 0xDB,
+    0xDC, 0x1E, 0xE9, 0x25, 0x0D, 0xBD, 0xA4, 0xA6, 0x3F, 0xF8, 0xDD, 0x67, 0x92, 0x5B, 0xDF, 0x95,
+    0xE3, 0x48, 0xEB, 0x0E, 0xC8, 0xC7, 0x04, 0x99, 0xE6, 0x1A, 0xC9, 0xE7, 0x2B, 0x98, 0xB5, 0x0E,
+    0x46, 0x4F, 0xC8, 0xDC, 0xF8, 0xCE, 0x8D, 0xF0, 0xDC, 0xFC, 0xFC, 0x73, 0xB7, 0xDD, 0x5B, 0xDF,
+    0x86, 0x7D, 0xC2, 0x63, 0xBE, 0x13, 0x60, 0x7E, 0x1E, 0xEE, 0xAD, 0xF9, 0x11, 0x19, 0xF7, 0xFB,
+    0x93, 0x35, 0xA3, 0x4F, 0xC9, 0xC3, 0xCF, 0x1C, 0xAC, 0x99, 0xA4, 0xB5, 0xD8, 0x63, 0x12, 0x97,
+    0x81, 0xFC, 0x23, 0x49, 0x7A, 0x5C, 0xD2, 0x7C, 0xF6, 0x99, 0x83, 0xB6, 0xDB, 0xDC, 0x40, 0xEB,
+    0x6E, 0x1F, 0xE0, 0xD4, 0xC1, 0x3D, 0x15, 0x7F, 0x77, 0xB1, 0xB9, 0x7D, 0xE2, 0xAA, 0x79, 0xEB,
+    0x3B, 0xDF, 0x0B, 0xEB, 0x7C, 0x25, 0x96, 0x6B, 0x3D, 0xD3, 0x3F, 0x31, 0x53, 0x7E, 0x67, 0x86,
+    0x7E, 0xDE, 0x5C, 0x2A, 0x8F, 0xDD, 0x70, 0x7E, 0xDB, 0x80, 0x09, 0x0E, 0x5C, 0xD3, 0x63, 0x66,
+    0x7A, 0x9C, 0x92, 0x57, 0xD8, 0x5A, 0x37, 0xF0, 0x95, 0xAF, 0x40, 0x3E, 0xF5, 0x92, 0xBA, 0x5E,
+    0x9A, 0x59, 0xA9, 0x3B, 0xD6, 0x3C, 0x42, 0xB4, 0x1E, 0xFC, 0x7F, 0x79, 0x72, 0x62, 0x47, 0x70,
+    0xD7, 0x04, 0x76, 0x6C, 0x47, 0xCA, 0xC9, 0x46, 0x4C, 0xCC, 0x05, 0x0B, 0xED, 0xBB, 0xBB, 0x3E,
+    0x39, 0x75, 0xE7, 0x92, 0x3C, 0xEE, 0xA3, 0x0B, 0x23, 0x36, 0x9A, 0x89, 0x4C, 0x59, 0x04, 0x37,
+    0x2E, 0x50, 0x46, 0x07, 0x99, 0xEA, 0x0E, 0xDC, 0xFB, 0x1E, 0x4A, 0x85, 0x63, 0x2B, 0x4F, 0x24,
+    0x45, 0xCD, 0x6E, 0x53, 0xF9, 0x4E, 0x80, 0xD3, 0x4F, 0x43, 0xAB, 0x2E, 0x93, 0xC6, 0x7C, 0xAC,
+    0x43, 0xB2, 0x7E, 0x14, 0x31, 0x21, 0x6F, 0x26, 0x52, 0xDE, 0x88, 0xB4, 0x8A, 0xB9, 0x2E, 0xC5,
+    0x62, 0x36, 0xD1, 0x06, 0x13, 0xAB, 0xC1, 0xCC, 0xCE, 0x17, 0x93, 0xF3, 0x65, 0x70, 0xDE, 0x06,
+    0xE7, 0xAB, 0xC1, 0x79, 0xE7, 0x9D, 0xEF, 0x1B, 0x77, 0x63, 0xC5, 0x6A, 0xC2, 0xA8, 0x3B, 0x76,
+    0x0F, 0xDF, 0xA6, 0xC9, 0x83, 0xD2, 0x92, 0x60, 0x44, 0x37, 0x80, 0x12, 0x04, 0x62, 0xA7, 0xDD,
+    0xAE, 0x7F, 0x6D, 0xBB, 0x7B, 0xE6, 0xE0, 0xC2, 0xC7, 0xEF, 0x9E, 0xC7, 0xBD, 0x9E, 0xC8, 0x76,
+    0x69, 0xF7, 0xE1, 0x73, 0xC0, 0xC3, 0x87, 0xA6, 0xA3, 0xD5, 0xEC, 0x28, 0x25, 0x05, 0xFA, 0xA3,
+    0x4B, 0xA2, 0x5C, 0x28, 0x23, 0x6E, 0xC0, 0xCD, 0xF9, 0x4A, 0xAE, 0x60, 0x03, 0x75, 0x3B, 0xB4,
+    0x3E, 0x9F, 0xFA, 0x47, 0x57, 0xEA, 0xFB, 0xD6, 0x72, 0xCA, 0xA7, 0x62, 0xAE, 0x87, 0xBA, 0xAB,
+    0xC6, 0xFE, 0xBE, 0x99, 0xFE, 0xBE, 0xB5, 0xEA, 0x4C, 0x2C, 0x96, 0x19, 0x1B, 0xAC, 0x3A, 0xFA,
+    0xAE, 0x9E, 0x29, 0x22, 0x2E, 0xD0, 0x0F, 0x68, 0xED, 0x57, 0xAC, 0xA4, 0x81, 0x58, 0x6B, 0x26,
+    0xF7, 0xA7, 0xBE, 0x7E, 0x73, 0xA4, 0x6E, 0x67, 0x83, 0x3E, 0x33, 0x79, 0x30, 0xC9, 0xCA, 0x38,
+    0x6E, 0x3D, 0x6E, 0x5F, 0x9E, 0xA0, 0x7E, 0x32, 0x82, 0x2B, 0x22, 0xB4, 0x66, 0x85, 0xC5, 0x08,
+    0x62, 0xA6, 0x26, 0x9F, 0x51, 0x67, 0x26, 0xE4, 0x8B, 0x40, 0x3B, 0xD8, 0x11, 0x37, 0x56, 0x03,
+    0x2E, 0xD4, 0x9E, 0x6A, 0x72, 0xEF, 0xEE, 0x2E, 0xC5, 0x56, 0x52, 0x4A, 0xD8, 0xBB, 0x48, 0xBD,
+    0x21, 0x49, 0xDF, 0xD4, 0xEE, 0xD2, 0xE2, 0x02, 0x36, 0xF4, 0x1E, 0x77, 0x9F, 0xBA, 0x3C, 0x1A,
+    0x61, 0xC7, 0x32, 0xD2, 0x26, 0x1B, 0x97, 0x0B, 0x76, 0xA0, 0xF5, 0x2D, 0xE8, 0xB1, 0x99, 0x5C,
+    0xD6, 0x53, 0xC4, 0x2B, 0x60, 0x6F, 0x04, 0xA8, 0xE5, 0xB7, 0x78, 0xCE, 0x44, 0x16, 0xDD, 0x06,
+    0xB5, 0x9E, 0x3A, 0x69, 0x83, 0x91, 0xCF, 0x25, 0x05, 0x93, 0xC2, 0x16, 0xBF, 0xB6, 0x85, 0x98,
+    0xA6, 0x78, 0xBC, 0xBE, 0xDB, 0xC7, 0xE7, 0xD9, 0xA3, 0xDD, 0x6E, 0xF7, 0xD8, 0x31, 0xEC, 0x17,
+    0xDD, 0xBB, 0xBB, 0xDD, 0xCE, 0x06, 0x36, 0x3B, 0x49, 0x7A, 0x28, 0xB9, 0xE8, 0xEB, 0xBB, 0x07,
+    0x07, 0x8D, 0x4D, 0x03, 0x25, 0x45, 0xB2, 0x3E, 0xF9, 0x87, 0x66, 0xE7, 0x8F, 0xB7, 0x69, 0x10,
+    0x94, 0x52, 0xA4, 0x96, 0x84, 0x93, 0xE4, 0xDD, 0xF5, 0xFB, 0x27, 0xEA, 0x90, 0x47, 0x6C, 0x60,
+    0xA5, 0x9C, 0x69, 0x31, 0x91, 0xDA, 0xA3, 0xDD, 0xA5, 0xA3, 0x6F, 0x39, 0x25, 0xCE, 0x2B, 0x5D,
+    0x5B, 0x77, 0xEB, 0xEE, 0x29, 0x35, 0x2D, 0xD4, 0xA3, 0xEB, 0x30, 0xD1, 0x0E, 0xD0, 0xBF, 0x11,
+    0xC0, 0x6A, 0x39, 0x78, 0x28, 0xF9, 0x99, 0x95, 0x3A, 0x8E, 0xD1, 0xAD, 0xFC, 0xDE, 0x19, 0x7A,
+    0x5B, 0xF2, 0xCF, 0x1C, 0x1C, 0x50, 0xEC, 0x7D, 0xDF, 0x83, 0x95, 0x14, 0xED, 0xBA, 0x77, 0x9A,
+    0x4D, 0xAE, 0xA2, 0xDA, 0xED, 0x76, 0xB7, 0x96, 0xB9, 0xDB, 0x3D, 0xD5, 0x77, 0x7B, 0xA7, 0x62,
+    0xA3, 0xC3, 0xCD, 0xEC, 0x94, 0xBA, 0x8D, 0xBB, 0x24, 0x41, 0x76, 0x70, 0xD0, 0xEC, 0xCD, 0x43,
+    0xF3, 0xE6, 0x35, 0xBC, 0x79, 0xBD, 0x9D, 0xEA, 0xC3, 0xB1, 0xBD, 0x3A, 0x75, 0xD5, 0x0C, 0xA0,
+    0xDB, 0x77, 0xBB, 0x5D, 0x7F, 0xED, 0x66, 0xB7, 0x7E, 0x6A, 0xB7, 0xDB, 0xE9, 0xF8, 0xA1, 0x7A,
+    0xDC, 0x57, 0xDD, 0xCE, 0xA7, 0x0E, 0x0E, 0x2E, 0xC6, 0x54, 0x9A, 0xA4, 0x19, 0x27, 0x1D, 0xEE,
+    0x9B, 0xB4, 0x1C, 0xBF, 0x21, 0xA9, 0xC3, 0x49, 0x89, 0x90, 0x03, 0xC5, 0xF4, 0x05, 0xC1, 0x8A,
+    0x1B, 0xA9, 0xBD, 0x89, 0x98, 0x89, 0xBE, 0x63, 0xC5, 0x86, 0x5D, 0xFF, 0xEE, 0xB3, 0xF1, 0x66,
+    0x13, 0xAF, 0xEE, 0x2E, 0xBD, 0x7B, 0x29, 0x60, 0xA6, 0x22, 0x42, 0x9F, 0xAF, 0x50, 0x79, 0x81,
+    0xB9, 0xAE, 0xEE, 0xE0, 0x40, 0xF2, 0x6E, 0xDF, 0x61, 0x9D, 0xD9, 0x42, 0x4A, 0xED, 0x70, 0xEC,
+    0x80, 0x7F, 0x26, 0x75, 0x2A, 0x56, 0x4A, 0x1B, 0x39, 0xC4, 0x14, 0x1B, 0xB3, 0xB7, 0xD3, 0x27,
+    0x3B, 0x42, 0x15, 0x76, 0xBB, 0xDD, 0xAD, 0x65, 0xEE, 0x76, 0x97, 0xC2, 0xBE, 0x33, 0x8A, 0x05,
+    0xB8, 0x4B, 0x46, 0x92, 0x52, 0xB7, 0x39, 0xE9, 0x3A, 0xA7, 0x0E, 0x0E, 0x6E, 0xDD, 0x73, 0xE2,
+    0x65, 0x49, 0xD2, 0x69, 0x1D, 0x5D, 0xD2, 0x50, 0x2C, 0x98, 0x95, 0x6A, 0xC2, 0xCE, 0xB4, 0x03,
+    0x6E, 0xCC, 0xD4, 0x24, 0xDF, 0xF8, 0xFF, 0x04, 0xD9, 0x95, 0xE6, 0x52, 0x51, 0x0A, 0xBD, 0x3E,
+    0xD8, 0xED, 0xEE, 0xDB, 0xED, 0xBA, 0xE3, 0xAD, 0x00, 0xEE, 0x4B, 0x2B, 0xD3, 0xAE, 0x9F, 0xED,
+    0x92, 0x42, 0x7D, 0x6C, 0x57, 0xCF, 0xFC, 0x56, 0xF2, 0x65, 0xDD, 0x6F, 0x84, 0xB1, 0x19, 0x4A,
+    0xD5, 0x6D, 0xE1, 0x25, 0x26, 0x6E, 0x06, 0xCD, 0x7C, 0xDD, 0x53, 0x96, 0x92, 0xE9, 0xE5, 0x76,
+    0xFA, 0x8E, 0xAF, 0x14, 0x11, 0x33, 0x39, 0x4F, 0xF5, 0xDA, 0xBE, 0xCB, 0x62, 0x2D, 0x69, 0xFC,
+    0x95, 0xDD, 0x6E, 0xD7, 0x24, 0x93, 0xEE, 0xD2, 0x4A, 0xAF, 0xEE, 0x76, 0xDF, 0x4A, 0x62, 0xA5,
+    0xF3, 0x64, 0x4B, 0xA2, 0x98, 0xB6, 0x49, 0xAE, 0x78, 0x23, 0xF4, 0x69, 0x7D, 0xAF, 0x07, 0x10,
+    0x14, 0x53, 0x7A, 0x6E, 0xDD, 0x5E, 0xE9, 0xC8, 0xE3, 0x2D, 0xAF, 0x54, 0xE9, 0x95, 0xEC, 0xFC,
+    0x5E, 0x6D, 0x68, 0x40, 0x49, 0x7A, 0x30, 0x73, 0x7A, 0xA9, 0x1A, 0x7F, 0xEA, 0x5B, 0xCB, 0xCD,
+    0x5B, 0x76, 0xBB, 0x75, 0x06, 0x6E, 0x6F, 0xC8, 0x26, 0xA8, 0x9A, 0xFC, 0x95, 0xE9, 0x8F, 0xDC,
+    0x9B, 0xED, 0x55, 0x69, 0xCE, 0x35, 0x53, 0xA9, 0xA9, 0xA4, 0xFB, 0xD7, 0x1B, 0x8B, 0xAB, 0x1E,
+    0xF4, 0xF7, 0x4D, 0x77, 0x50, 0xA5, 0x27, 0x1F, 0x6E, 0x0A, 0x8D, 0x95, 0x66, 0xF7, 0xD5, 0xE8,
+    0xD8, 0xFF, 0xBD, 0x3E, 0x57, 0x0A, 0x85, 0x3C, 0x0F, 0x91, 0x99, 0xD8, 0xBF, 0xB7, 0x6E, 0x91,
+    0xD6, 0x0F, 0xED, 0x03, 0xCF, 0x5D, 0xB3, 0x59, 0x6D, 0x8B, 0xB0, 0x8F, 0x7D, 0xB8, 0xF9, 0xEB,
+    0x38, 0x94, 0x25, 0x9C, 0x7A, 0x88, 0xBA, 0x6B, 0x67, 0x96, 0x4C, 0xC1, 0x84, 0xBC, 0xF7, 0x55,
+    0x47, 0xDB, 0x5C, 0x86, 0xD5, 0x04, 0x4C, 0xAC, 0x3A, 0xCA, 0x70, 0x19, 0xEC, 0x6B, 0x01, 0xDC,
+    0x93, 0x1E, 0xFA, 0xAF, 0x6C, 0xFB, 0x09, 0x19, 0xF9, 0x6D, 0x8D, 0x4D, 0x41, 0x69, 0x7E, 0x5B,
+    0x67, 0xCF, 0x73, 0x47, 0x3F, 0x54, 0x4E, 0x0F, 0xFC, 0xE0, 0x68, 0x5D, 0x2E, 0x17, 0xAB, 0xF5,
+    0xB5, 0x8F, 0x66, 0x29, 0xC7, 0x7E, 0x6A, 0x75, 0xE1, 0x2D, 0x0D, 0x7D, 0xF9, 0x76, 0xB6, 0x41,
+    0x3D, 0x77, 0xD2, 0xFB, 0x6A, 0xAA, 0x55, 0xEA, 0xDA, 0xD1, 0xBA, 0x2E, 0x97, 0x8B, 0xA5, 0x78,
+    0xCF, 0xD7, 0xFE, 0xDE, 0xCB, 0x26, 0x9A, 0xF7, 0x46, 0x85, 0x2B, 0xAD, 0x2E, 0xE8, 0xAA, 0x86,
+    0x7E, 0x2E, 0xA7, 0x6C, 0x53, 0x73, 0x17, 0x12, 0x46, 0x96, 0x26, 0xA1, 0x6B, 0x7E, 0x91, 0xAC,
+    0x75, 0xCF, 0xD8, 0xED, 0xDE, 0x64, 0x7A, 0x53, 0x6B, 0xC8, 0xBB, 0x9B, 0xB1, 0x23, 0xC9, 0x2C,
+    0x38, 0x1F, 0xBB, 0x97, 0x24, 0x66, 0xDF, 0xFA, 0x63, 0xA6, 0xE9, 0xC6, 0x63, 0x16, 0x57, 0x87,
+    0xE3, 0xDD, 0x2B, 0x4E, 0x18, 0x12, 0xD3, 0xCB, 0xBD, 0x07, 0x8A, 0x75, 0xB7, 0xDB, 0x75, 0x4E,
+    0x4A, 0x41, 0xFA, 0xA9, 0x5C, 0x85, 0x33, 0xF5, 0x4B, 0xDF, 0x8B, 0xFD, 0x4F, 0x4E, 0xCE, 0x76,
+    0x67, 0xB2, 0x7F, 0x1E, 0xEB, 0x97, 0x42, 0x5F, 0x5F, 0x8D, 0x7D, 0xF9, 0xBD, 0x5F, 0xF8, 0xF2,
+    0x83, 0x6F, 0x9D, 0x3D, 0x8E, 0xEB, 0x1B, 0xF6, 0x0D, 0x33, 0x6A, 0xF6, 0xB1, 0x13, 0x8A, 0x80,
+    0xEB, 0x3B, 0xA8, 0x5F, 0x0E, 0x60, 0xBF, 0xBD, 0x40, 0x31, 0xB9, 0x0E, 0x13, 0xCB, 0x40, 0xB6,
+    0x66, 0x2B, 0xF4, 0x38, 0x8F, 0xF3, 0xC5, 0x94, 0x62, 0xF0, 0x6D, 0xA0, 0xF6, 0xC5, 0x4C, 0x31,
+    0xE7, 0x11, 0x84, 0xA0, 0x1E, 0xFA, 0x06, 0x13, 0x9D, 0xDF, 0xEF, 0x04, 0x80, 0x0D, 0xE0, 0xAE,
+    0x2E, 0x60, 0x83, 0xF3, 0x94, 0x53, 0x19, 0x30, 0x31, 0x5B, 0xC9, 0x56, 0x9C, 0x47, 0x14, 0x13,
+    0xAE, 0x43, 0xD4, 0x03, 0xB5, 0xB7, 0x01, 0x33, 0x17, 0x33, 0x28, 0x8F, 0x50, 0x0D, 0x2B, 0x98,
+    0xD8, 0x36, 0xD0, 0x3B, 0xBF, 0x45, 0x60, 0x27, 0x9F, 0x96, 0x76, 0xDE, 0xBB, 0x65, 0xA4, 0x75,
+    0xDC, 0x35, 0x24, 0xD7, 0xFB, 0x56, 0x13, 0xBD, 0xD4, 0xB5, 0x47, 0xFD, 0xE4, 0x86, 0x5C, 0x76,
+    0xA4, 0x7E, 0x31, 0x60, 0x3E, 0x8A, 0xB0, 0xF4, 0xE0, 0x2E, 0x79, 0xEC, 0x7B, 0x01, 0x73, 0x14,
+    0x61, 0xFD, 0xE9, 0x32, 0xBA, 0x2D, 0x6E, 0xF8, 0x67, 0x7D, 0xEF, 0x92, 0xC7, 0xBE, 0x13, 0x30,
+    0x1F, 0x2D, 0x64, 0x8B, 0xEB, 0xE8, 0xED, 0x4C, 0xFF, 0x82, 0x24, 0x5F, 0x49, 0x03, 0xBD, 0x3A,
+    0xB2, 0x03, 0x80, 0xDB, 0x0F, 0xA1, 0x5F, 0x30, 0x12, 0xC5, 0x72, 0x05, 0x3B, 0x7D, 0x06, 0x3B,
+    0xF1, 0xF7, 0xF3, 0x1F, 0xA0, 0x0A, 0xFC, 0xE3, 0x2A, 0x70, 0xA5, 0x1E, 0x91, 0x3C, 0xAD, 0xE0,
+    0xF6, 0x63, 0x84, 0xAA, 0x98, 0x8E, 0x83, 0x11, 0xFC, 0xE6, 0xD4, 0x9F, 0x1D, 0xF2, 0x77, 0x1F,
+    0x82, 0xFA, 0xA5, 0x85, 0x4C, 0x97, 0x26, 0x8A, 0xB5, 0xF5, 0xD8, 0xE9, 0xCE, 0x63, 0x99, 0xEB,
+    0xCA, 0x0F, 0xDF, 0xFC, 0x22, 0xDC, 0xDE, 0xFC, 0xDD, 0x9F, 0x2D, 0xE6, 0x93, 0xD5, 0xC9, 0xD7,
+    0x4D, 0xA0, 0x39, 0xDD, 0xE9, 0x9A, 0x6C, 0xAC, 0x4E, 0xB8, 0xCF, 0x66, 0x4F, 0xB9, 0xA0, 0x6B,
+    0x4A, 0xB6, 0xA4, 0x9F, 0xBF, 0xC4, 0x9F, 0xD8, 0x8E, 0x9F, 0x08, 0x07, 0xE7, 0x1A, 0xCC, 0x35,
+    0xE9, 0xFE, 0xA3, 0xB5, 0x57, 0x7C, 0x9E, 0x3E, 0xDE, 0x46, 0xF6, 0xB5, 0x93, 0x22, 0xA7, 0x2E,
+    0x4A, 0x7A, 0x3D, 0x39, 0xD4, 0xA7, 0xE3, 0xEC, 0x6E, 0xB7, 0xFB, 0x86, 0xA4, 0xEF, 0xA7, 0x6D,
+    0x98, 0x80, 0xAC, 0x21, 0x93, 0xBF, 0xBB, 0xD5, 0xE3, 0xBA, 0xA1, 0x35, 0x96, 0xBA, 0xDA, 0x94,
+    0x43, 0x76, 0x9E, 0xFB, 0x7E, 0x28, 0x13, 0xC0, 0x7E, 0x8D, 0x2F, 0x5C, 0x93, 0x14, 0x7A, 0x69,
+    0xE6, 0x77, 0x9F, 0xB9, 0xD9, 0xBC, 0xD3, 0x97, 0xDE, 0x6D, 0xDC, 0xC6, 0xDE, 0xAE, 0x1D, 0x92,
+    0xFD, 0xF9, 0x4D, 0xC8, 0x7A, 0x80, 0xCB, 0xDB, 0x22, 0xFA, 0xBA, 0xB4, 0x60, 0x3D, 0xF9, 0xC4,
+    0x99, 0xF6, 0xE0, 0xFE, 0x94, 0xF9, 0x4A, 0x7B, 0xF0, 0x50, 0x31, 0xC0, 0x3F, 0x61, 0x2F, 0x38,
+    0x1E, 0xD4, 0x9B, 0x68, 0x3E, 0x1D, 0x1C, 0x1C, 0x3C, 0x74, 0xC2, 0x9B, 0x31, 0x55, 0xBC, 0x4D,
+    0x61, 0x44, 0x9B, 0x6F, 0xFF, 0x6E, 0xF7, 0xCC, 0xBE, 0xAD, 0x27, 0x46, 0xE7, 0x39, 0xE8, 0x3D,
+    0xFD, 0x44, 0x3F, 0xD1, 0x8F, 0xB4, 0x23, 0xC5, 0x9A, 0xB6, 0xB0, 0x39, 0xFE, 0xDF, 0xEC, 0xC6,
+    0x9F, 0xBC, 0xB9, 0xC6, 0xBF, 0x2E, 0x2D, 0xB7, 0x25, 0x33, 0x8A, 0x9B, 0xC8, 0xFA, 0x29, 0xED,
+    0xBC, 0xD0, 0x4F, 0xD0, 0x0F, 0x14, 0x0B, 0xA5, 0x9A, 0xF4, 0x67, 0xD4, 0x70, 0xF7, 0x89, 0xE0,
+    0xC4, 0x9B, 0xAD, 0xDB, 0x0F, 0xCE, 0x48, 0xD9, 0x50, 0x46, 0xDA, 0x40, 0xBD, 0x64, 0x1A, 0xE9,
+    0xA7, 0x42, 0x5D, 0xAE, 0xAE, 0x5A, 0x31, 0x2B, 0xF5, 0x44, 0xA6, 0xAE, 0x5C, 0xA0, 0x5A, 0x69,
+    0x67, 0x68, 0xE7, 0x4C, 0x23, 0x99, 0xC6, 0x52, 0x1D, 0x85, 0xA8, 0x93, 0xA1, 0xFA, 0x32, 0x70,
+    0x3E, 0x29, 0xEA, 0x09, 0x5D, 0xBA, 0x1B, 0xCC, 0xDA, 0xD8, 0x99, 0xED, 0xB3, 0xE9, 0xBB, 0xE4,
+    0x1A, 0xCA, 0x15, 0x8A, 0x95, 0x3A, 0x90, 0xA9, 0x2B, 0x23, 0xA5, 0x9A, 0x7A, 0xA1, 0x5E, 0x92,
+    0xD1, 0x30, 0xD7, 0x80, 0xC6, 0x42, 0x0D, 0x75, 0xC7, 0x02, 0x79, 0x5A, 0x43, 0x7F, 0x9C, 0x44,
+    0x59, 0x9D, 0x94, 0x28, 0x8F, 0x45, 0xD0, 0x9B, 0x42, 0xB3, 0x0D, 0xFB, 0xC9, 0x62, 0x16, 0xA0,
+    0xFC, 0xF1, 0x12, 0xE5, 0x09, 0x85, 0xA4, 0xDF, 0xB3, 0xCA, 0x53, 0x17, 0xFF, 0x8A, 0xD3, 0x3F,
+    0xA4, 0x1C, 0xAC, 0x14, 0x91, 0x16, 0xB3, 0x50, 0x7B, 0x84, 0x1D, 0x71, 0xBE, 0x08, 0xD8, 0x60,
+    0x22, 0x26, 0xB2, 0x80, 0x9A, 0x16, 0xAA, 0xE0, 0x3A, 0x8C, 0xBE, 0x39, 0xFC, 0x08, 0xE5, 0xA0,
+    0x3F, 0x38, 0x68, 0x12, 0xC3, 0xAC, 0xFC, 0x1E, 0x0E, 0x4C, 0x9E, 0x5F, 0x5B, 0x38, 0xD7, 0x4D,
+    0x6E, 0x5D, 0x7B, 0xCE, 0x1C, 0x5C, 0x18, 0xB1, 0xD2, 0x7A, 0x6B, 0xE3, 0xDB, 0x8B, 0x11, 0x6A,
+    0xAF, 0x06, 0x3B, 0xD6, 0x81, 0x62, 0x2B, 0x5F, 0xB0, 0xE0, 0x3C, 0x3D, 0x36, 0xE0, 0xBA, 0x22,
+    0x62, 0x07, 0xB3, 0x50, 0x86, 0xE2, 0x87, 0x1B, 0xDF, 0x7E, 0x7D, 0x73, 0x69, 0x4B, 0x91, 0xA1,
+    0x66, 0xFA, 0x58, 0xEC, 0xE4, 0x45, 0x69, 0xAC, 0x25, 0x3D, 0x26, 0x69, 0xAD, 0x97, 0x26, 0x75,
+    0x75, 0x31, 0xEF, 0xC1, 0xC9, 0xBE, 0xD9, 0x98, 0x4F, 0xDA, 0xE9, 0x61, 0x06, 0xAA, 0x75, 0xB7,
+    0x7B, 0xBA, 0x92, 0x52, 0x04, 0x5C, 0x97, 0x5D, 0xDA, 0x9C, 0x46, 0x0E, 0x0E, 0x0E, 0x0E, 0xCE,
+    0x29, 0x85, 0x74, 0x68, 0x75, 0x29, 0x52, 0x0F, 0x72, 0x69, 0x6D, 0x4A, 0x6D, 0xE5, 0x04, 0x38,
+    0xA5, 0x71, 0x2F, 0x49, 0xF4, 0xCD, 0xC9, 0xFD, 0x9B, 0xEA, 0x71, 0x1B, 0xE9, 0x32, 0x3E, 0xBC,
+    0xDB, 0xE9, 0x55, 0x49, 0x4B, 0x29, 0xC9, 0xD7, 0x5A, 0x37, 0x4E, 0x7C, 0x70, 0x70, 0x70, 0xF0,
+    0xC0, 0x2D, 0xA1, 0x62, 0x21, 0x99, 0x9F, 0x73, 0xAD, 0x50, 0x4A, 0x33, 0x76, 0x7C, 0xAE, 0xF6,
+    0x76, 0xB8, 0x3B, 0x8B, 0xC5, 0x50, 0x76, 0xD5, 0xB9, 0x31, 0x1F, 0xF3, 0x0F, 0x02, 0xCF, 0x71,
+    0xCF, 0x73, 0xDC, 0x8D, 0xBD, 0x42, 0xD9, 0xE5, 0x27, 0x1C, 0x58, 0x66, 0xEE, 0xA6, 0xFC, 0x5B,
+    0xCA, 0x2E, 0x7F, 0xC7, 0xE7, 0x23, 0xD3, 0xCC, 0x73, 0x3C, 0x5F, 0x73, 0x37, 0xF7, 0x9A, 0x50,
+    0x76, 0x0E, 0xF7, 0xD5, 0xB1, 0x27, 0x97, 0xD6, 0xCD, 0xDB, 0x71, 0x0B, 0x5F, 0xB9, 0x59, 0xE6,
+    0x7A, 0x69, 0xC6, 0x8E, 0xD4, 0xDE, 0x0E, 0x64, 0xB1, 0x18, 0xA0, 0x3A, 0x37, 0x42, 0xFE, 0x41,
+    0x00, 0xEE, 0x79, 0x0E, 0x28, 0xAF, 0xA4, 0x6E, 0x38, 0x51, 0x26, 0x94, 0x7F, 0x0B, 0xE4, 0xEF,
+    0x78, 0x60, 0x9A, 0x81, 0xE7, 0x6B, 0xE0, 0x5E, 0x13, 0xC0, 0xE1, 0x3A, 0x7A, 0x72, 0x3D, 0xFB,
+    0x53, 0x94, 0x39, 0x92, 0xC7, 0x62, 0x25, 0xD7, 0xB9, 0xF7, 0xC6, 0xFC, 0xE8, 0x83, 0x70, 0x25,
+    0x9F, 0xEF, 0x79, 0xAE, 0xFC, 0xCE, 0x6C, 0xAF, 0xD0, 0xCF, 0xB9, 0x9A, 0x72, 0xA6, 0x1D, 0xF2,
+    0x85, 0x6A, 0xCE, 0x35, 0x94, 0x7F, 0x9B, 0xCF, 0x97, 0xF3, 0x77, 0xAE, 0xCE, 0xE5, 0x38, 0x1D,
+    0xCD, 0x5C, 0x79, 0xBE, 0x9E, 0x29, 0x57, 0x33, 0x83, 0x7E, 0x96, 0x32, 0x07, 0xF2, 0x58, 0x0C,
+    0xE4, 0x3A, 0x37, 0x92, 0x1F, 0x7D, 0x10, 0xC8, 0xE7, 0x7B, 0x9E, 0x27, 0x9F, 0xED, 0x15, 0xF2,
+    0x39, 0x57, 0x93, 0xCF, 0xB4, 0x43, 0x3E, 0x53, 0xCD, 0xF9, 0x4C, 0xF9, 0xB7, 0xF9, 0x8C, 0x79,
+    0xE7, 0xEA, 0x0C, 0xD3, 0xD1, 0x0C, 0xCF, 0xD7, 0x33, 0xDC, 0x6B, 0x66, 0x68, 0x7F, 0x5C, 0x99,
+    0x40, 0xB6, 0xEC, 0xBD, 0x31, 0x87, 0xB4, 0x32, 0xFF, 0xEC, 0x19, 0x67, 0x77, 0xEB, 0xEE, 0x1B,
+    0x92, 0x8E, 0xB4, 0x59, 0x60, 0xBA, 0x63, 0xAD, 0xE1, 0x14, 0x34, 0xDC, 0x66, 0x43, 0xBE, 0xE2,
+    0xDE, 0x58, 0x90, 0xAF, 0x8E, 0xD4, 0xB8, 0x50, 0xAC, 0xAD, 0x2F, 0x27, 0x74, 0x62, 0x51, 0xBC,
+    0xFD, 0x69, 0x68, 0xD7, 0x56, 0x9E, 0xB4, 0xF1, 0x8A, 0xDE, 0xD3, 0xF7, 0xD3, 0x7E, 0x3D, 0xB6,
+    0x71, 0xBE, 0x98, 0xA1, 0x0A, 0xF9, 0x0A, 0xE5, 0x8C, 0xBA, 0xE4, 0x36, 0x15, 0xEA, 0xB4, 0x53,
+    0x4B, 0x7F, 0xF4, 0xAC, 0x9E, 0xC1, 0xCE, 0x9B, 0xEF, 0x5F, 0xF2, 0x02, 0x4C, 0x2E, 0xF5, 0x66,
+    0xE5, 0xEF, 0xBC, 0x21, 0xDC, 0x44, 0xA9, 0xA9, 0xD5, 0x68, 0xB4, 0xD4, 0x9A, 0xB6, 0xCD, 0x63,
+    0x72, 0xA9, 0xC3, 0x4A, 0x23, 0xEE, 0xBB, 0x7D, 0xA0, 0xEF, 0xAA, 0x11, 0x51, 0x76, 0xB9, 0x12,
+    0x38, 0x93, 0x35, 0xB5, 0xA4, 0xB1, 0x97, 0x34, 0xFE, 0x81, 0x76, 0xFD, 0x68, 0xD6, 0xF4, 0xE1,
+    0x9F, 0x2E, 0x11, 0x6E, 0xAA, 0xF5, 0x8A, 0x56, 0xA7, 0x57, 0xB5, 0xC2, 0xD9, 0x3F, 0x6D, 0x92,
+    0xB9, 0x24, 0x15, 0xF9, 0x51, 0x3F, 0xD2, 0x77, 0x6E, 0x44, 0xB8, 0x31, 0x13, 0x6E, 0xCC, 0x85,
+    0x1B, 0x6B, 0xCD, 0x6E, 0xEC, 0x35, 0xBB, 0xF1, 0x0F, 0xF4, 0x94, 0xFB, 0x05, 0x8B, 0x4C, 0x71,
+    0x72, 0x54, 0xFA, 0xEA, 0xD6, 0x54, 0x69, 0xC5, 0xE8, 0x92, 0xBE, 0xDB, 0x8F, 0xF4, 0x5D, 0x35,
+    0x67, 0x0B, 0x36, 0x64, 0xA2, 0x6C, 0x32, 0x25, 0xA6, 0x51, 0x8F, 0x66, 0xDF, 0xF2, 0x8D, 0x67,
+    0x48, 0x1A, 0xFE, 0x40, 0xBB, 0xFE, 0xE8, 0xD9, 0x65, 0x2B, 0x68, 0x48, 0xA5, 0xFD, 0x9C, 0x3F,
+    0x45, 0x3B, 0x9A, 0xF5, 0x73, 0x5A, 0x9C, 0x5E, 0xD0, 0xEA, 0xF4, 0x9A, 0x62, 0x9D, 0x02, 0xCC,
+    0xB2, 0xDD, 0x43, 0x50, 0xE9, 0x31, 0x69, 0x48, 0x95, 0x5D, 0xB6, 0xCA, 0x0E, 0xF4, 0x5D, 0x35,
+    0x9B, 0x25, 0x19, 0x4F, 0xDD, 0x90, 0x89, 0x3A, 0x98, 0x25, 0x55, 0xD6, 0x0D, 0xB5, 0x24, 0x3D,
+    0x96, 0x2A, 0x3B, 0xBB, 0x54, 0x59, 0xF3, 0x9F, 0xB4, 0xB2, 0xD9, 0x8E, 0xBD, 0x57, 0x67, 0x0A,
+    0x94, 0xAB, 0xBF, 0x3D, 0x03, 0xCA, 0x1F, 0x18, 0x29, 0x66, 0xDA, 0x8E, 0x7A, 0xCC, 0x57, 0xE8,
+    0xBB, 0x72, 0x4E, 0xB4, 0xFC, 0x3D, 0x49, 0xD2, 0xBF, 0x4F, 0xA4, 0xAC, 0xCE, 0xCE, 0x1B, 0xC1,
+    0x26, 0x1A, 0x4D, 0xF4, 0xFA, 0xE3, 0xB3, 0x23, 0x46, 0x4D, 0xAD, 0xB9, 0xD7, 0xD8, 0xEA, 0x35,
+    0xA9, 0x4B, 0xFB, 0xF2, 0x9C, 0x69, 0xB6, 0x11, 0xDE, 0xCC, 0x66, 0xF4, 0x5A, 0x00, 0x3B, 0xF6,
+    0x01, 0xB2, 0x39, 0x13, 0x50, 0x25, 0x45, 0x32, 0xA0, 0x86, 0xEC, 0x9B, 0x9D, 0x9D, 0x30, 0x52,
+    0x21, 0x79, 0x29, 0x48, 0xD1, 0x79, 0x77, 0xBB, 0xDE, 0x3D, 0x17, 0xF3, 0x60, 0x27, 0xDC, 0xF8,
+    0xEB, 0xA8, 0x31, 0x1A, 0xB1, 0x13, 0xB5, 0x02, 0x6A, 0xE8, 0x35, 0xD8, 0x09, 0x7A, 0xA1, 0x06,
+    0xFA, 0xC9, 0x4E, 0x7C, 0x19, 0x35, 0x6A, 0xCA, 0xB1, 0x9C, 0x6C, 0xA4, 0x7F, 0x54, 0x48, 0xAF,
+    0x4B, 0x43, 0xA9, 0xA5, 0xD6, 0x48, 0xAD, 0xE6, 0xD4, 0xF9, 0xCD, 0x93, 0xE9, 0x93, 0x7B, 0xC1,
+    0xE9, 0xE6, 0x76, 0x9D, 0x69, 0x6B, 0x61, 0xEE, 0xFE, 0xC2, 0x08, 0xE4, 0x3E, 0x1F, 0x81, 0xBB,
+    0xC9, 0x46, 0xC8, 0xE3, 0xEF, 0xE7, 0x23, 0xD4, 0x92, 0x19, 0xC9, 0x25, 0xD9, 0x91, 0x5A, 0x8A,
+    0xF5, 0x98, 0x4B, 0x0A, 0xFD, 0x58, 0x4B, 0xFA, 0x9C, 0xBE, 0x23, 0xAD, 0x8D, 0xD5, 0x5B, 0x92,
+    0x47, 0x32, 0x12, 0xB5, 0x82, 0x51, 0x2C, 0x25, 0x8C, 0x42, 0xAF, 0x80, 0xD1, 0x2B, 0x52, 0x82,
+    0xBD, 0x02, 0x18, 0xBD, 0x9F, 0x40, 0x23, 0x1B, 0xD8, 0xEC, 0x0F, 0x60, 0x5E, 0xDD, 0xFC, 0x55,
+    0x93, 0x40, 0x9B, 0x24, 0xFE, 0x13, 0xEE, 0x32, 0xFF, 0x1F,
 };
 
 static const EpdGlyph bookerly_14_boldGlyphs[] = {
@@ -1954,7 +1992,7 @@ static const EpdGlyph bookerly_14_boldGlyphs[] = {
     { 5, 27, 9, 2, 23, 34, 7639 }, // |
     { 10, 29, 12, 0, 24, 73, 7673 }, // }
     { 14, 7, 18, 2, 13, 25, 7746 }, // ~
-    { 0, 0, 6, 0, 0, 0, 0 }, //  
+    { 0, 0, 6, 0, 0, 0, 7771 }, //  
     { 6, 23, 8, 1, 16, 35, 0 }, // ¡
     { 16, 29, 18, 1, 23, 116, 35 }, // ¢
     { 18, 22, 18, 0, 21, 99, 151 }, // £
@@ -1965,642 +2003,649 @@ static const EpdGlyph bookerly_14_boldGlyphs[] = {
     { 12, 5, 20, 4, 23, 15, 515 }, // ¨
     { 22, 22, 23, 0, 21, 121, 530 }, // ©
     { 11, 15, 13, 1, 21, 42, 651 }, // ª
-    { 16, 12, 17, 0, 13, 48, 693 }, // «
-    { 14, 8, 18, 2, 14, 28, 741 }, // ¬
-    { 9, 5, 11, 1, 10, 12, 769 }, // ­
-    { 17, 16, 17, 0, 23, 68, 781 }, // ®
-    { 11, 3, 20, 4, 21, 9, 849 }, // ¯
-    { 11, 12, 15, 2, 21, 33, 858 }, // °
-    { 14, 18, 18, 2, 17, 63, 891 }, // ±
-    { 11, 14, 13, 1, 24, 39, 954 }, // ²
-    { 11, 14, 13, 1, 24, 39, 993 }, // ³
-    { 6, 8, 20, 7, 25, 12, 1032 }, // ´
-    { 19, 23, 19, 1, 16, 110, 1044 }, // µ
-    { 17, 26, 17, 0, 21, 111, 1154 }, // ¶
-    { 6, 6, 8, 1, 11, 9, 1265 }, // ·
-    { 6, 7, 20, 7, -1, 11, 1274 }, // ¸
-    { 10, 14, 13, 1, 24, 35, 1285 }, // ¹
-    { 11, 15, 13, 1, 21, 42, 1320 }, // º
-    { 16, 12, 17, 1, 13, 48, 1362 }, // »
-    { 30, 25, 31, 1, 22, 188, 1410 }, // ¼
-    { 30, 25, 31, 1, 22, 188, 1598 }, // ½
-    { 30, 25, 31, 1, 22, 188, 1786 }, // ¾
-    { 12, 23, 14, 1, 16, 69, 1974 }, // ¿
-    { 23, 29, 22, 0, 29, 167, 2043 }, // À
-    { 23, 29, 22, 0, 29, 167, 2210 }, // Á
-    { 23, 28, 22, 0, 28, 161, 2377 }, // Â
-    { 23, 28, 22, 0, 28, 161, 2538 }, // Ã
-    { 23, 27, 22, 0, 27, 156, 2699 }, // Ä
-    { 23, 29, 22, 0, 29, 167, 2855 }, // Å
-    { 29, 21, 28, -1, 21, 153, 3022 }, // Æ
-    { 17, 29, 19, 1, 21, 124, 3175 }, // Ç
-    { 17, 29, 19, 1, 29, 124, 3299 }, // È
-    { 17, 29, 19, 1, 29, 124, 3423 }, // É
-    { 17, 28, 19, 1, 28, 119, 3547 }, // Ê
-    { 17, 27, 19, 1, 27, 115, 3666 }, // Ë
-    { 11, 29, 12, 1, 29, 80, 3781 }, // Ì
-    { 11, 29, 12, 1, 29, 80, 3861 }, // Í
-    { 12, 28, 12, 0, 28, 84, 3941 }, // Î
-    { 12, 27, 12, 0, 27, 81, 4025 }, // Ï
-    { 22, 22, 23, 0, 21, 121, 4106 }, // Ð
-    { 24, 29, 23, 0, 28, 174, 4227 }, // Ñ
-    { 21, 30, 23, 1, 29, 158, 4401 }, // Ò
-    { 21, 30, 23, 1, 29, 158, 4559 }, // Ó
-    { 21, 29, 23, 1, 28, 153, 4717 }, // Ô
-    { 21, 29, 23, 1, 28, 153, 4870 }, // Õ
-    { 21, 28, 23, 1, 27, 147, 5023 }, // Ö
-    { 13, 13, 18, 3, 16, 43, 5170 }, // ×
-    { 23, 22, 23, 0, 21, 127, 5213 }, // Ø
-    { 23, 30, 23, 0, 29, 173, 5340 }, // Ù
-    { 23, 30, 23, 0, 29, 173, 5513 }, // Ú
-    { 23, 29, 23, 0, 28, 167, 5686 }, // Û
-    { 23, 28, 23, 0, 27, 161, 5853 }, // Ü
-    { 21, 29, 21, 0, 29, 153, 6014 }, // Ý
-    { 17, 21, 19, 1, 21, 90, 6167 }, // Þ
-    { 19, 24, 19, 0, 23, 114, 6257 }, // ß
-    { 16, 26, 16, 1, 25, 104, 6371 }, // à
-    { 16, 26, 16, 1, 25, 104, 6475 }, // á
-    { 16, 25, 16, 1, 24, 100, 6579 }, // â
-    { 16, 24, 16, 1, 23, 96, 6679 }, // ã
-    { 16, 24, 16, 1, 23, 96, 6775 }, // ä
-    { 16, 26, 16, 1, 25, 104, 6871 }, // å
-    { 22, 17, 24, 1, 16, 94, 6975 }, // æ
-    { 14, 24, 15, 1, 16, 84, 7069 }, // ç
-    { 14, 26, 16, 1, 25, 91, 7153 }, // è
-    { 14, 26, 16, 1, 25, 91, 7244 }, // é
-    { 14, 25, 16, 1, 24, 88, 7335 }, // ê
-    { 14, 24, 16, 1, 23, 84, 7423 }, // ë
-    { 10, 25, 10, 0, 25, 63, 7507 }, // ì
-    { 10, 25, 10, 0, 25, 63, 7570 }, // í
-    { 11, 24, 10, 0, 24, 66, 7633 }, // î
-    { 11, 23, 10, 0, 23, 64, 7699 }, // ï
-    { 16, 25, 18, 1, 24, 100, 7763 }, // ð
-    { 20, 23, 20, 0, 23, 115, 7863 }, // ñ
-    { 16, 26, 18, 1, 25, 104, 7978 }, // ò
-    { 16, 26, 18, 1, 25, 104, 8082 }, // ó
-    { 16, 25, 18, 1, 24, 100, 8186 }, // ô
-    { 16, 24, 18, 1, 23, 96, 8286 }, // õ
-    { 16, 24, 18, 1, 23, 96, 8382 }, // ö
-    { 14, 14, 18, 2, 17, 49, 8478 }, // ÷
-    { 17, 17, 18, 0, 16, 73, 8527 }, // ø
-    { 20, 26, 19, 0, 25, 130, 8600 }, // ù
-    { 20, 26, 19, 0, 25, 130, 8730 }, // ú
-    { 20, 25, 19, 0, 24, 125, 8860 }, // û
-    { 20, 24, 19, 0, 23, 120, 8985 }, // ü
-    { 19, 32, 19, 0, 25, 152, 9105 }, // ý
-    { 18, 30, 18, 0, 23, 135, 9257 }, // þ
-    { 19, 30, 19, 0, 23, 143, 9392 }, // ÿ
-    { 23, 26, 22, 0, 26, 150, 0 }, // Ā
-    { 16, 22, 16, 1, 21, 88, 150 }, // ā
-    { 23, 28, 22, 0, 28, 161, 238 }, // Ă
-    { 16, 24, 16, 1, 23, 96, 399 }, // ă
-    { 23, 28, 22, 0, 21, 161, 495 }, // Ą
-    { 16, 23, 16, 1, 16, 92, 656 }, // ą
-    { 17, 30, 19, 1, 29, 128, 748 }, // Ć
-    { 14, 26, 15, 1, 25, 91, 876 }, // ć
-    { 17, 29, 19, 1, 28, 124, 967 }, // Ĉ
-    { 14, 25, 15, 1, 24, 88, 1091 }, // ĉ
-    { 17, 29, 19, 1, 28, 124, 1179 }, // Ċ
-    { 14, 24, 15, 1, 23, 84, 1303 }, // ċ
-    { 17, 29, 19, 1, 28, 124, 1387 }, // Č
-    { 14, 25, 15, 1, 24, 88, 1511 }, // č
-    { 21, 29, 23, 1, 28, 153, 1599 }, // Ď
-    { 20, 24, 19, 1, 23, 120, 1752 }, // ď
-    { 22, 22, 23, 0, 21, 121, 1872 }, // Đ
-    { 18, 24, 18, 1, 23, 108, 1993 }, // đ
-    { 17, 26, 19, 1, 26, 111, 2101 }, // Ē
-    { 14, 22, 16, 1, 21, 77, 2212 }, // ē
-    { 17, 28, 19, 1, 28, 119, 2289 }, // Ĕ
-    { 14, 24, 16, 1, 23, 84, 2408 }, // ĕ
-    { 17, 28, 19, 1, 28, 119, 2492 }, // Ė
-    { 14, 24, 16, 1, 23, 84, 2611 }, // ė
-    { 17, 28, 19, 1, 21, 119, 2695 }, // Ę
-    { 14, 23, 16, 1, 16, 81, 2814 }, // ę
-    { 17, 28, 19, 1, 28, 119, 2895 }, // Ě
-    { 14, 25, 16, 1, 24, 88, 3014 }, // ě
-    { 20, 29, 21, 1, 28, 145, 3102 }, // Ĝ
-    { 18, 31, 18, 0, 24, 140, 3247 }, // ĝ
-    { 20, 29, 21, 1, 28, 145, 3387 }, // Ğ
-    { 18, 30, 18, 0, 23, 135, 3532 }, // ğ
-    { 20, 29, 21, 1, 28, 145, 3667 }, // Ġ
-    { 18, 30, 18, 0, 23, 135, 3812 }, // ġ
-    { 20, 29, 21, 1, 21, 145, 3947 }, // Ģ
-    { 18, 32, 18, 0, 25, 144, 4092 }, // ģ
-    { 23, 28, 25, 1, 28, 161, 4236 }, // Ĥ
-    { 20, 30, 19, -1, 30, 150, 4397 }, // ĥ
-    { 25, 21, 25, 0, 21, 132, 4547 }, // Ħ
-    { 19, 23, 19, 0, 23, 110, 4679 }, // ħ
-    { 11, 28, 12, 1, 28, 77, 4789 }, // Ĩ
-    { 11, 23, 10, 0, 23, 64, 4866 }, // ĩ
-    { 11, 26, 12, 1, 26, 72, 4930 }, // Ī
-    { 11, 21, 10, 0, 21, 58, 5002 }, // ī
-    { 11, 28, 12, 1, 28, 77, 5060 }, // Ĭ
-    { 11, 23, 10, 0, 23, 64, 5137 }, // ĭ
-    { 11, 28, 12, 1, 21, 77, 5201 }, // Į
-    { 11, 30, 10, 0, 23, 83, 5278 }, // į
-    { 11, 28, 12, 1, 28, 77, 5361 }, // İ
-    { 10, 16, 10, 0, 16, 40, 5438 }, // ı
-    { 23, 27, 24, 1, 21, 156, 5478 }, // Ĳ
-    { 18, 30, 19, 0, 23, 135, 5634 }, // ĳ
-    { 14, 34, 11, -2, 28, 119, 5769 }, // Ĵ
-    { 12, 31, 9, -2, 24, 93, 5888 }, // ĵ
-    { 21, 29, 22, 1, 21, 153, 5981 }, // Ķ
-    { 19, 31, 18, 0, 23, 148, 6134 }, // ķ
-    { 19, 17, 19, 0, 16, 81, 6282 }, // ĸ
-    { 17, 29, 18, 1, 29, 124, 6363 }, // Ĺ
-    { 10, 30, 10, 0, 30, 75, 6487 }, // ĺ
-    { 17, 29, 18, 1, 21, 124, 6562 }, // Ļ
-    { 10, 31, 10, 0, 23, 78, 6686 }, // ļ
-    { 17, 23, 18, 1, 23, 98, 6764 }, // Ľ
-    { 13, 23, 11, 0, 23, 75, 6862 }, // ľ
-    { 17, 21, 18, 1, 21, 90, 6937 }, // Ŀ
-    { 16, 23, 16, 0, 23, 92, 7027 }, // ŀ
-    { 19, 21, 18, -1, 21, 100, 7119 }, // Ł
-    { 12, 23, 10, -1, 23, 69, 7219 }, // ł
-    { 24, 30, 23, 0, 29, 180, 7288 }, // Ń
-    { 20, 25, 20, 0, 25, 125, 7468 }, // ń
-    { 24, 29, 23, 0, 21, 174, 7593 }, // Ņ
-    { 20, 24, 20, 0, 16, 120, 7767 }, // ņ
-    { 24, 29, 23, 0, 28, 174, 7887 }, // Ň
-    { 20, 24, 20, 0, 24, 120, 8061 }, // ň
-    { 26, 21, 26, 0, 21, 137, 8181 }, // ŉ
-    { 24, 27, 23, 0, 21, 162, 8318 }, // Ŋ
-    { 18, 23, 19, 0, 16, 104, 8480 }, // ŋ
-    { 21, 27, 23, 1, 26, 142, 8584 }, // Ō
-    { 16, 22, 18, 1, 21, 88, 8726 }, // ō
-    { 21, 29, 23, 1, 28, 153, 8814 }, // Ŏ
-    { 16, 24, 18, 1, 23, 96, 8967 }, // ŏ
-    { 21, 30, 23, 1, 29, 158, 9063 }, // Ő
-    { 16, 26, 18, 1, 25, 104, 9221 }, // ő
-    { 28, 22, 29, 1, 21, 154, 9325 }, // Œ
-    { 25, 17, 26, 1, 16, 107, 9479 }, // œ
-    { 21, 30, 21, 1, 29, 158, 9586 }, // Ŕ
-    { 14, 25, 14, 0, 25, 88, 9744 }, // ŕ
-    { 21, 29, 21, 1, 21, 153, 9832 }, // Ŗ
-    { 14, 24, 14, 0, 16, 84, 9985 }, // ŗ
-    { 21, 29, 21, 1, 28, 153, 10069 }, // Ř
-    { 14, 24, 14, 0, 24, 84, 10222 }, // ř
-    { 15, 30, 17, 1, 29, 113, 10306 }, // Ś
-    { 13, 26, 15, 1, 25, 85, 10419 }, // ś
-    { 15, 29, 17, 1, 28, 109, 10504 }, // Ŝ
-    { 13, 25, 15, 1, 24, 82, 10613 }, // ŝ
-    { 15, 29, 17, 1, 21, 109, 10695 }, // Ş
-    { 13, 24, 15, 1, 16, 78, 10804 }, // ş
-    { 15, 29, 17, 1, 28, 109, 10882 }, // Š
-    { 13, 25, 15, 1, 24, 82, 10991 }, // š
-    { 20, 29, 21, 0, 21, 145, 11073 }, // Ţ
-    { 13, 27, 12, -1, 19, 88, 11218 }, // ţ
-    { 20, 28, 21, 0, 28, 140, 11306 }, // Ť
-    { 13, 25, 12, -1, 24, 82, 11446 }, // ť
-    { 20, 21, 21, 0, 21, 105, 11528 }, // Ŧ
-    { 13, 20, 12, -1, 19, 65, 11633 }, // ŧ
-    { 23, 29, 23, 0, 28, 167, 11698 }, // Ũ
-    { 20, 24, 19, 0, 23, 120, 11865 }, // ũ
-    { 23, 27, 23, 0, 26, 156, 11985 }, // Ū
-    { 20, 22, 19, 0, 21, 110, 12141 }, // ū
-    { 23, 29, 23, 0, 28, 167, 12251 }, // Ŭ
-    { 20, 24, 19, 0, 23, 120, 12418 }, // ŭ
-    { 23, 30, 23, 0, 29, 173, 12538 }, // Ů
-    { 20, 26, 19, 0, 25, 130, 12711 }, // ů
-    { 23, 30, 23, 0, 29, 173, 12841 }, // Ű
-    { 20, 26, 19, 0, 25, 130, 13014 }, // ű
-    { 23, 28, 23, 0, 21, 161, 13144 }, // Ų
-    { 20, 23, 19, 0, 16, 115, 13305 }, // ų
-    { 32, 29, 32, 0, 28, 232, 13420 }, // Ŵ
-    { 26, 25, 26, 0, 24, 163, 13652 }, // ŵ
-    { 21, 28, 21, 0, 28, 147, 13815 }, // Ŷ
-    { 19, 31, 19, 0, 24, 148, 13962 }, // ŷ
-    { 21, 27, 21, 0, 27, 142, 14110 }, // Ÿ
-    { 17, 30, 18, 0, 29, 128, 14252 }, // Ź
-    { 15, 26, 15, 0, 25, 98, 14380 }, // ź
-    { 17, 29, 18, 0, 28, 124, 14478 }, // Ż
-    { 15, 24, 15, 0, 23, 90, 14602 }, // ż
-    { 17, 29, 18, 0, 28, 124, 14692 }, // Ž
-    { 15, 25, 15, 0, 24, 94, 14816 }, // ž
-    { 15, 23, 12, 0, 23, 87, 14910 }, // ſ
-    { 7, 8, 0, -5, 25, 14, 0 }, // ̀
-    { 6, 8, 0, -2, 25, 12, 14 }, // ́
-    { 10, 7, 0, -5, 24, 18, 26 }, // ̂
-    { 10, 5, 0, -5, 23, 13, 44 }, // ̃
-    { 10, 3, 0, -5, 21, 8, 57 }, // ̄
-    { 10, 6, 0, -5, 23, 15, 65 }, // ̆
-    { 6, 5, 0, -3, 23, 8, 80 }, // ̇
-    { 12, 5, 0, -6, 23, 15, 88 }, // ̈
-    { 8, 9, 0, -4, 26, 18, 103 }, // ̉
-    { 8, 9, 0, -4, 25, 18, 121 }, // ̊
-    { 11, 8, 0, -4, 25, 22, 139 }, // ̋
-    { 10, 7, 0, -5, 24, 18, 161 }, // ̌
-    { 11, 8, 0, -7, 25, 22, 179 }, // ̏
-    { 10, 6, 0, -5, 23, 15, 201 }, // ̑
-    { 6, 8, 0, -3, 25, 12, 216 }, // ̒
-    { 6, 9, 0, -2, 26, 14, 228 }, // ̓
-    { 6, 9, 0, -4, 26, 14, 242 }, // ̔
-    { 4, 8, 0, -2, 25, 8, 256 }, // ̕
-    { 6, 8, 0, -3, 19, 12, 264 }, // ̛
-    { 6, 5, 0, -3, -2, 8, 276 }, // ̣
-    { 12, 5, 0, -6, -2, 15, 284 }, // ̤
-    { 8, 7, 0, -4, -1, 14, 299 }, // ̥
-    { 6, 7, 0, -3, -1, 11, 313 }, // ̦
-    { 6, 7, 0, -3, -1, 11, 324 }, // ̧
-    { 8, 8, 0, -4, 1, 16, 335 }, // ̨
-    { 4, 8, 8, 2, -1, 8, 351 }, // ̩
-    { 12, 7, 0, -6, -1, 21, 359 }, // ̭
-    { 10, 6, 0, -5, -2, 15, 380 }, // ̮
-    { 10, 6, 0, -5, -2, 15, 395 }, // ̰
-    { 10, 3, 0, -5, -3, 8, 410 }, // ̱
-    { 10, 6, 0, -5, 23, 15, 418 }, // ͂
-    { 12, 12, 0, -6, 30, 36, 433 }, // ̈́
-    { 6, 6, 0, -2, -2, 9, 469 }, // ͅ
-    { 17, 29, 19, 1, 29, 124, 0 }, // Ѐ
-    { 17, 27, 19, 1, 27, 115, 124 }, // Ё
-    { 24, 27, 25, 0, 21, 162, 239 }, // Ђ
-    { 17, 29, 18, 1, 29, 124, 401 }, // Ѓ
-    { 18, 22, 20, 1, 21, 99, 525 }, // Є
-    { 15, 22, 17, 1, 21, 83, 624 }, // Ѕ
-    { 11, 21, 12, 1, 21, 58, 707 }, // І
-    { 12, 27, 12, 0, 27, 81, 765 }, // Ї
-    { 14, 27, 11, -2, 21, 95, 846 }, // Ј
-    { 28, 22, 29, 0, 21, 154, 941 }, // Љ
-    { 29, 22, 31, 1, 21, 160, 1095 }, // Њ
-    { 27, 21, 27, 0, 21, 142, 1255 }, // Ћ
-    { 21, 30, 22, 1, 29, 158, 1397 }, // Ќ
-    { 23, 29, 25, 1, 29, 167, 1555 }, // Ѝ
-    { 21, 29, 21, 0, 28, 153, 1722 }, // Ў
-    { 22, 28, 24, 1, 21, 154, 1875 }, // Џ
-    { 23, 21, 22, 0, 21, 121, 2029 }, // А
-    { 17, 22, 19, 1, 21, 94, 2150 }, // Б
-    { 17, 22, 19, 1, 21, 94, 2244 }, // В
-    { 17, 21, 18, 1, 21, 90, 2338 }, // Г
-    { 23, 27, 23, 0, 21, 156, 2428 }, // Д
-    { 17, 21, 19, 1, 21, 90, 2584 }, // Е
-    { 32, 22, 32, 0, 21, 176, 2674 }, // Ж
-    { 17, 22, 18, 1, 21, 94, 2850 }, // З
-    { 23, 21, 25, 1, 21, 121, 2944 }, // И
-    { 23, 28, 25, 1, 28, 161, 3065 }, // Й
-    { 21, 22, 22, 1, 21, 116, 3226 }, // К
-    { 22, 22, 22, 0, 21, 121, 3342 }, // Л
-    { 27, 21, 28, 0, 21, 142, 3463 }, // М
-    { 23, 21, 25, 1, 21, 121, 3605 }, // Н
-    { 21, 22, 23, 1, 21, 116, 3726 }, // О
-    { 23, 21, 24, 1, 21, 121, 3842 }, // П
-    { 17, 21, 18, 1, 21, 90, 3963 }, // Р
-    { 17, 22, 19, 1, 21, 94, 4053 }, // С
-    { 20, 21, 21, 0, 21, 105, 4147 }, // Т
-    { 21, 22, 21, 0, 21, 116, 4252 }, // У
-    { 22, 22, 23, 1, 21, 121, 4368 }, // Ф
-    { 22, 21, 22, 0, 21, 116, 4489 }, // Х
-    { 23, 27, 24, 1, 21, 156, 4605 }, // Ц
-    { 22, 21, 22, 0, 21, 116, 4761 }, // Ч
-    { 31, 21, 32, 1, 21, 163, 4877 }, // Ш
-    { 32, 27, 33, 1, 21, 216, 5040 }, // Щ
-    { 22, 22, 23, 0, 21, 121, 5256 }, // Ъ
-    { 28, 22, 30, 1, 21, 154, 5377 }, // Ы
-    { 17, 22, 19, 1, 21, 94, 5531 }, // Ь
-    { 18, 22, 20, 1, 21, 99, 5625 }, // Э
-    { 30, 22, 32, 1, 21, 165, 5724 }, // Ю
-    { 20, 22, 21, 0, 21, 110, 5889 }, // Я
-    { 16, 17, 16, 1, 16, 68, 5999 }, // а
-    { 16, 24, 17, 1, 23, 96, 6067 }, // б
-    { 15, 17, 17, 1, 16, 64, 6163 }, // в
-    { 14, 16, 15, 1, 16, 56, 6227 }, // г
-    { 20, 22, 20, 0, 16, 110, 6283 }, // д
-    { 14, 17, 16, 1, 16, 60, 6393 }, // е
-    { 26, 17, 26, 0, 16, 111, 6453 }, // ж
-    { 14, 17, 15, 0, 16, 60, 6564 }, // з
-    { 19, 16, 20, 1, 16, 76, 6624 }, // и
-    { 19, 23, 20, 1, 23, 110, 6700 }, // й
-    { 18, 17, 19, 1, 16, 77, 6810 }, // к
-    { 18, 17, 19, 0, 16, 77, 6887 }, // л
-    { 21, 16, 23, 1, 16, 84, 6964 }, // м
-    { 19, 16, 20, 1, 16, 76, 7048 }, // н
-    { 16, 17, 18, 1, 16, 68, 7124 }, // о
-    { 19, 16, 20, 1, 16, 76, 7192 }, // п
-    { 18, 23, 18, 0, 16, 104, 7268 }, // р
-    { 14, 17, 15, 1, 16, 60, 7372 }, // с
-    { 17, 16, 18, 0, 16, 68, 7432 }, // т
-    { 19, 23, 19, 0, 16, 110, 7500 }, // у
-    { 21, 30, 23, 1, 23, 158, 7610 }, // ф
-    { 18, 16, 18, 0, 16, 72, 7768 }, // х
-    { 19, 22, 20, 1, 16, 105, 7840 }, // ц
-    { 18, 16, 19, 0, 16, 72, 7945 }, // ч
-    { 25, 16, 27, 1, 16, 100, 8017 }, // ш
-    { 26, 22, 27, 1, 16, 143, 8117 }, // щ
-    { 19, 17, 19, 0, 16, 81, 8260 }, // ъ
-    { 24, 17, 25, 1, 16, 102, 8341 }, // ы
-    { 15, 17, 16, 1, 16, 64, 8443 }, // ь
-    { 15, 17, 16, 0, 16, 64, 8507 }, // э
-    { 24, 17, 26, 1, 16, 102, 8571 }, // ю
-    { 17, 17, 18, 0, 16, 73, 8673 }, // я
-    { 14, 26, 16, 1, 25, 91, 8746 }, // ѐ
-    { 14, 24, 16, 1, 23, 84, 8837 }, // ё
-    { 18, 30, 19, 0, 23, 135, 8921 }, // ђ
-    { 14, 25, 15, 1, 25, 88, 9056 }, // ѓ
-    { 14, 17, 16, 1, 16, 60, 9144 }, // є
-    { 13, 17, 15, 1, 16, 56, 9204 }, // ѕ
-    { 10, 23, 10, 0, 23, 58, 9260 }, // і
-    { 11, 23, 10, 0, 23, 64, 9318 }, // ї
-    { 10, 30, 9, -2, 23, 75, 9382 }, // ј
-    { 23, 17, 23, 0, 16, 98, 9457 }, // љ
-    { 24, 17, 25, 1, 16, 102, 9555 }, // њ
-    { 19, 23, 19, 0, 23, 110, 9657 }, // ћ
-    { 18, 26, 19, 1, 25, 117, 9767 }, // ќ
-    { 19, 25, 20, 1, 25, 119, 9884 }, // ѝ
-    { 19, 30, 19, 0, 23, 143, 10003 }, // ў
-    { 18, 22, 20, 1, 16, 99, 10146 }, // џ
-    { 20, 24, 22, 1, 23, 120, 10245 }, // Ѣ
-    { 19, 22, 19, 0, 21, 105, 10365 }, // ѣ
-    { 21, 22, 23, 1, 21, 116, 10470 }, // Ѳ
-    { 16, 17, 18, 1, 16, 68, 10586 }, // ѳ
-    { 23, 22, 23, 0, 21, 127, 10654 }, // Ѵ
-    { 20, 17, 19, 0, 16, 85, 10781 }, // ѵ
-    { 24, 34, 25, 1, 28, 204, 10866 }, // Ҋ
-    { 20, 29, 20, 0, 23, 145, 11070 }, // ҋ
-    { 18, 22, 19, 0, 21, 99, 11215 }, // Ҍ
-    { 15, 22, 16, 0, 21, 83, 11314 }, // ҍ
-    { 17, 21, 18, 1, 21, 90, 11397 }, // Ҏ
-    { 18, 23, 18, 0, 16, 104, 11487 }, // ҏ
-    { 15, 24, 17, 1, 24, 90, 11591 }, // Ґ
-    { 13, 19, 15, 1, 19, 62, 11681 }, // ґ
-    { 18, 21, 18, 0, 21, 95, 11743 }, // Ғ
-    { 15, 16, 16, 0, 16, 60, 11838 }, // ғ
-    { 19, 27, 21, 1, 21, 129, 11898 }, // Ҕ
-    { 16, 23, 18, 1, 16, 92, 12027 }, // ҕ
-    { 32, 27, 32, 0, 21, 216, 12119 }, // Җ
-    { 26, 22, 26, 0, 16, 143, 12335 }, // җ
-    { 17, 28, 18, 1, 21, 119, 12478 }, // Ҙ
-    { 14, 22, 15, 0, 16, 77, 12597 }, // ҙ
-    { 21, 27, 22, 1, 21, 142, 12674 }, // Қ
-    { 18, 22, 19, 1, 16, 99, 12816 }, // қ
-    { 23, 22, 23, 1, 21, 127, 12915 }, // Ҝ
-    { 18, 17, 19, 1, 16, 77, 13042 }, // ҝ
-    { 22, 22, 22, 0, 21, 121, 13119 }, // Ҟ
-    { 19, 22, 18, 0, 21, 105, 13240 }, // ҟ
-    { 26, 22, 25, 0, 21, 143, 13345 }, // Ҡ
-    { 22, 17, 22, 0, 16, 94, 13488 }, // ҡ
-    { 24, 27, 25, 1, 21, 162, 13582 }, // Ң
-    { 20, 22, 21, 1, 16, 110, 13744 }, // ң
-    { 27, 21, 29, 1, 21, 142, 13854 }, // Ҥ
-    { 22, 16, 24, 1, 16, 88, 13996 }, // ҥ
-    { 31, 27, 32, 1, 21, 210, 14084 }, // Ҧ
-    { 26, 23, 27, 1, 16, 150, 14294 }, // ҧ
-    { 24, 22, 25, 1, 21, 132, 14444 }, // Ҩ
-    { 19, 17, 20, 1, 16, 81, 14576 }, // ҩ
-    { 17, 28, 19, 1, 21, 119, 14657 }, // Ҫ
-    { 14, 22, 15, 1, 16, 77, 14776 }, // ҫ
-    { 20, 27, 21, 0, 21, 135, 14853 }, // Ҭ
-    { 17, 22, 18, 0, 16, 94, 14988 }, // ҭ
-    { 21, 21, 21, 0, 21, 111, 15082 }, // Ү
-    { 19, 23, 19, 0, 16, 110, 15193 }, // ү
-    { 21, 21, 21, 0, 21, 111, 15303 }, // Ұ
-    { 19, 23, 19, 0, 16, 110, 15414 }, // ұ
-    { 23, 27, 23, 0, 21, 156, 15524 }, // Ҳ
-    { 18, 22, 18, 0, 16, 99, 15680 }, // ҳ
-    { 27, 27, 27, 0, 21, 183, 15779 }, // Ҵ
-    { 23, 22, 23, 0, 16, 127, 15962 }, // ҵ
-    { 23, 27, 23, 0, 21, 156, 16089 }, // Ҷ
-    { 19, 22, 19, 0, 16, 105, 16245 }, // ҷ
-    { 22, 21, 22, 0, 21, 116, 16350 }, // Ҹ
-    { 18, 16, 19, 0, 16, 72, 16466 }, // ҹ
-    { 22, 21, 23, 1, 21, 116, 16538 }, // Һ
-    { 19, 23, 19, 0, 23, 110, 16654 }, // һ
-    { 24, 22, 25, 0, 21, 132, 16764 }, // Ҽ
-    { 19, 17, 19, 0, 16, 81, 16896 }, // ҽ
-    { 24, 27, 25, 0, 21, 162, 16977 }, // Ҿ
-    { 19, 22, 19, 0, 16, 105, 17139 }, // ҿ
-    { 11, 21, 12, 1, 21, 58, 17244 }, // Ӏ
-    { 32, 29, 32, 0, 28, 232, 17302 }, // Ӂ
-    { 26, 24, 26, 0, 23, 156, 17534 }, // ӂ
-    { 20, 27, 21, 1, 21, 135, 17690 }, // Ӄ
-    { 17, 23, 18, 1, 16, 98, 17825 }, // ӄ
-    { 22, 27, 22, 0, 21, 149, 17923 }, // Ӆ
-    { 19, 22, 19, 0, 16, 105, 18072 }, // ӆ
-    { 23, 27, 24, 1, 21, 156, 18177 }, // Ӈ
-    { 19, 23, 20, 1, 16, 110, 18333 }, // ӈ
-    { 24, 27, 25, 1, 21, 162, 18443 }, // Ӊ
-    { 19, 22, 20, 1, 16, 105, 18605 }, // ӊ
-    { 22, 27, 22, 0, 21, 149, 18710 }, // Ӌ
-    { 18, 22, 19, 0, 16, 99, 18859 }, // ӌ
-    { 28, 27, 28, 0, 21, 189, 18958 }, // Ӎ
-    { 22, 22, 23, 1, 16, 121, 19147 }, // ӎ
-    { 10, 23, 12, 1, 23, 58, 19268 }, // ӏ
-    { 23, 28, 22, 0, 28, 161, 19326 }, // Ӑ
-    { 16, 24, 16, 1, 23, 96, 19487 }, // ӑ
-    { 23, 27, 22, 0, 27, 156, 19583 }, // Ӓ
-    { 16, 24, 16, 1, 23, 96, 19739 }, // ӓ
-    { 29, 21, 28, -1, 21, 153, 19835 }, // Ӕ
-    { 22, 17, 24, 1, 16, 94, 19988 }, // ӕ
-    { 17, 28, 19, 1, 28, 119, 20082 }, // Ӗ
-    { 14, 24, 16, 1, 23, 84, 20201 }, // ӗ
-    { 19, 22, 20, 1, 21, 105, 20285 }, // Ә
-    { 14, 17, 16, 1, 16, 60, 20390 }, // ә
-    { 19, 28, 20, 1, 27, 133, 20450 }, // Ӛ
-    { 14, 24, 16, 1, 23, 84, 20583 }, // ӛ
-    { 32, 28, 32, 0, 27, 224, 20667 }, // Ӝ
-    { 26, 24, 26, 0, 23, 156, 20891 }, // ӝ
-    { 17, 28, 18, 1, 27, 119, 21047 }, // Ӟ
-    { 14, 24, 15, 0, 23, 84, 21166 }, // ӟ
-    { 16, 22, 17, 0, 21, 88, 21250 }, // Ӡ
-    { 15, 23, 16, 0, 16, 87, 21338 }, // ӡ
-    { 23, 26, 25, 1, 26, 150, 21425 }, // Ӣ
-    { 19, 21, 20, 1, 21, 100, 21575 }, // ӣ
-    { 23, 27, 25, 1, 27, 156, 21675 }, // Ӥ
-    { 19, 23, 20, 1, 23, 110, 21831 }, // ӥ
-    { 21, 28, 23, 1, 27, 147, 21941 }, // Ӧ
-    { 16, 24, 18, 1, 23, 96, 22088 }, // ӧ
-    { 21, 22, 23, 1, 21, 116, 22184 }, // Ө
-    { 16, 17, 18, 1, 16, 68, 22300 }, // ө
-    { 21, 28, 23, 1, 27, 147, 22368 }, // Ӫ
-    { 16, 24, 18, 1, 23, 96, 22515 }, // ӫ
-    { 18, 28, 20, 1, 27, 126, 22611 }, // Ӭ
-    { 15, 24, 16, 0, 23, 90, 22737 }, // ӭ
-    { 21, 27, 21, 0, 26, 142, 22827 }, // Ӯ
-    { 19, 28, 19, 0, 21, 133, 22969 }, // ӯ
-    { 21, 28, 21, 0, 27, 147, 23102 }, // Ӱ
-    { 19, 30, 19, 0, 23, 143, 23249 }, // ӱ
-    { 21, 30, 21, 0, 29, 158, 23392 }, // Ӳ
-    { 19, 32, 19, 0, 25, 152, 23550 }, // ӳ
-    { 22, 27, 22, 0, 27, 149, 23702 }, // Ӵ
-    { 18, 23, 19, 0, 23, 104, 23851 }, // ӵ
-    { 17, 27, 18, 1, 21, 115, 23955 }, // Ӷ
-    { 14, 22, 15, 1, 16, 77, 24070 }, // ӷ
-    { 28, 28, 30, 1, 27, 196, 24147 }, // Ӹ
-    { 24, 24, 25, 1, 23, 144, 24343 }, // ӹ
-    { 18, 27, 18, 0, 21, 122, 24487 }, // Ӻ
-    { 15, 22, 15, 0, 16, 83, 24609 }, // ӻ
-    { 22, 27, 22, 0, 21, 149, 24692 }, // Ӽ
-    { 18, 23, 18, 0, 16, 104, 24841 }, // ӽ
-    { 22, 21, 22, 0, 21, 116, 24945 }, // Ӿ
-    { 18, 16, 18, 0, 16, 72, 25061 }, // ӿ
-    { 0, 0, 15, 0, 0, 0, 0 }, //  
-    { 0, 0, 29, 0, 0, 0, 0 }, //  
-    { 0, 0, 15, 0, 0, 0, 0 }, //  
-    { 0, 0, 29, 0, 0, 0, 0 }, //  
-    { 0, 0, 10, 0, 0, 0, 0 }, //  
-    { 0, 0, 7, 0, 0, 0, 0 }, //  
-    { 0, 0, 5, 0, 0, 0, 0 }, //  
-    { 0, 0, 18, 0, 0, 0, 0 }, //  
-    { 0, 0, 8, 0, 0, 0, 0 }, //  
-    { 0, 0, 6, 0, 0, 0, 0 }, //  
-    { 0, 0, 1, 0, 0, 0, 0 }, //  
-    { 0, 0, 0, 0, 0, 0, 0 }, // ​
-    { 2, 24, 0, -1, 17, 12, 0 }, // ‌
-    { 6, 26, 0, -3, 19, 39, 12 }, // ‍
-    { 10, 28, 0, -5, 21, 70, 51 }, // ‎
-    { 10, 28, 0, -5, 21, 70, 121 }, // ‏
-    { 9, 5, 11, 1, 10, 12, 191 }, // ‐
-    { 9, 5, 11, 1, 10, 12, 203 }, // ‑
-    { 14, 3, 18, 2, 11, 11, 215 }, // ‒
-    { 15, 3, 15, 0, 9, 12, 226 }, // –
-    { 29, 3, 29, 0, 9, 22, 238 }, // —
-    { 29, 3, 29, 0, 9, 22, 260 }, // ―
-    { 11, 30, 15, 2, 23, 83, 282 }, // ‖
-    { 15, 8, 15, 0, -1, 30, 365 }, // ‗
-    { 6, 10, 7, 1, 22, 15, 395 }, // ‘
-    { 7, 10, 7, 0, 22, 18, 410 }, // ’
-    { 7, 10, 7, 0, 4, 18, 428 }, // ‚
-    { 6, 10, 7, 1, 22, 15, 446 }, // ‛
-    { 12, 10, 13, 1, 22, 30, 461 }, // “
-    { 12, 10, 13, 0, 22, 30, 491 }, // ”
-    { 12, 10, 13, 0, 4, 30, 521 }, // „
-    { 12, 10, 13, 1, 22, 30, 551 }, // ‟
-    { 14, 19, 14, 0, 21, 67, 581 }, // †
-    { 14, 23, 14, 0, 21, 81, 648 }, // ‡
-    { 7, 7, 9, 1, 11, 13, 729 }, // •
-    { 10, 10, 18, 4, 15, 25, 742 }, // ‣
-    { 6, 6, 8, 1, 5, 9, 767 }, // ․
-    { 13, 6, 15, 1, 5, 20, 776 }, // ‥
-    { 25, 6, 29, 2, 5, 38, 796 }, // …
-    { 6, 6, 8, 1, 11, 9, 834 }, // ‧
-    { 0, 0, 0, 0, 0, 0, 843 }, //  
-    { 0, 0, 0, 0, 0, 0, 843 }, //  
-    { 10, 28, 0, -5, 21, 70, 843 }, // ‪
-    { 10, 28, 0, -5, 21, 70, 913 }, // ‫
-    { 10, 27, 0, -5, 20, 68, 983 }, // ‬
-    { 12, 28, 0, -6, 21, 84, 1051 }, // ‭
-    { 12, 28, 0, -6, 21, 84, 1135 }, // ‮
-    { 0, 0, 3, 0, 0, 0, 1219 }, //  
-    { 39, 24, 40, 1, 22, 234, 1219 }, // ‰
-    { 8, 11, 8, 0, 21, 22, 1453 }, // ′
-    { 14, 11, 14, 0, 21, 39, 1475 }, // ″
-    { 20, 11, 21, 0, 21, 55, 1514 }, // ‴
-    { 8, 11, 8, 0, 21, 22, 1569 }, // ‵
-    { 13, 11, 15, 1, 21, 36, 1591 }, // ‶
-    { 19, 11, 21, 1, 21, 53, 1627 }, // ‷
-    { 13, 6, 14, 1, 0, 20, 1680 }, // ‸
-    { 9, 12, 10, 0, 13, 27, 1700 }, // ‹
-    { 8, 12, 10, 1, 13, 24, 1727 }, // ›
-    { 18, 20, 18, 0, 19, 90, 1751 }, // ※
-    { 14, 23, 17, 2, 22, 81, 1841 }, // ‼
-    { 15, 4, 15, 0, 25, 15, 1922 }, // ‾
-    { 7, 5, 9, 1, 10, 9, 1937 }, // ⁃
-    { 15, 25, 5, -5, 22, 94, 1946 }, // ⁄
-    { 25, 23, 27, 1, 22, 144, 2040 }, // ⁇
-    { 21, 23, 22, 1, 22, 121, 2184 }, // ⁈
-    { 19, 23, 22, 2, 22, 110, 2305 }, // ⁉
-    { 17, 7, 29, 6, 12, 30, 2415 }, // ⁓
-    { 27, 11, 27, 0, 21, 75, 2445 }, // ⁗
-    { 0, 0, 6, 0, 0, 0, 2520 }, //  
-    { 0, 0, 0, 0, 0, 0, 2520 }, // ⁠
-    { 0, 0, 0, 0, 0, 0, 2520 }, // ⁡
-    { 0, 0, 0, 0, 0, 0, 2520 }, // ⁢
-    { 0, 0, 0, 0, 0, 0, 2520 }, // ⁣
-    { 0, 0, 0, 0, 0, 0, 2520 }, // ⁤
-    { 13, 14, 13, 0, 24, 46, 0 }, // ⁰
-    { 13, 14, 13, 0, 24, 46, 46 }, // ⁴
-    { 11, 14, 13, 1, 24, 39, 92 }, // ⁵
-    { 11, 14, 13, 1, 24, 39, 131 }, // ⁶
-    { 11, 14, 13, 1, 24, 39, 170 }, // ⁷
-    { 11, 14, 13, 1, 24, 39, 209 }, // ⁸
-    { 11, 14, 13, 1, 24, 39, 248 }, // ⁹
-    { 13, 11, 16, 2, 21, 36, 287 }, // ⁿ
-    { 13, 15, 13, 0, 10, 49, 323 }, // ₀
-    { 10, 14, 13, 1, 10, 35, 372 }, // ₁
-    { 11, 14, 13, 1, 10, 39, 407 }, // ₂
-    { 11, 15, 13, 1, 10, 42, 446 }, // ₃
-    { 13, 15, 13, 0, 10, 49, 488 }, // ₄
-    { 11, 14, 13, 1, 9, 39, 537 }, // ₅
-    { 11, 15, 13, 1, 10, 42, 576 }, // ₆
-    { 11, 14, 13, 1, 9, 39, 618 }, // ₇
-    { 11, 15, 13, 1, 10, 42, 657 }, // ₈
-    { 11, 15, 13, 1, 10, 42, 699 }, // ₉
-    { 16, 20, 18, 1, 20, 80, 0 }, // ₣
-    { 18, 22, 18, 0, 21, 99, 80 }, // ₤
-    { 39, 22, 39, 0, 21, 215, 179 }, // ₧
-    { 18, 22, 18, 0, 21, 99, 394 }, // €
-    { 19, 14, 29, 5, 17, 67, 0 }, // ←
-    { 13, 20, 29, 8, 20, 65, 67 }, // ↑
-    { 19, 14, 29, 5, 17, 67, 132 }, // →
-    { 13, 20, 29, 8, 20, 65, 199 }, // ↓
-    { 19, 14, 29, 5, 17, 67, 264 }, // ↔
-    { 13, 20, 29, 8, 20, 65, 331 }, // ↕
-    { 15, 20, 29, 7, 20, 75, 396 }, // ↨
-    { 13, 20, 29, 8, 20, 65, 471 }, // ↲
-    { 13, 20, 29, 8, 20, 65, 536 }, // ↳
-    { 17, 16, 29, 6, 18, 68, 601 }, // ↵
-    { 19, 16, 29, 5, 18, 76, 669 }, // ⇐
-    { 17, 18, 29, 6, 19, 77, 745 }, // ⇑
-    { 19, 16, 29, 5, 18, 76, 822 }, // ⇒
-    { 17, 18, 29, 6, 19, 77, 898 }, // ⇓
-    { 19, 16, 29, 5, 18, 76, 975 }, // ⇔
-    { 21, 22, 29, 4, 21, 116, 0 }, // ∀
-    { 16, 24, 18, 1, 23, 96, 116 }, // ∂
-    { 15, 21, 29, 7, 21, 79, 212 }, // ∃
-    { 23, 24, 29, 3, 22, 138, 291 }, // ∅
-    { 20, 21, 20, 0, 21, 105, 429 }, // ∆
-    { 19, 22, 29, 5, 21, 105, 534 }, // ∇
-    { 21, 21, 29, 4, 21, 111, 639 }, // ∈
-    { 21, 26, 29, 4, 23, 137, 750 }, // ∉
-    { 21, 18, 29, 4, 19, 95, 887 }, // ∊
-    { 21, 21, 29, 4, 21, 111, 982 }, // ∋
-    { 21, 26, 29, 4, 23, 137, 1093 }, // ∌
-    { 21, 18, 29, 4, 19, 95, 1230 }, // ∍
-    { 23, 26, 24, 1, 21, 150, 1325 }, // ∏
-    { 19, 26, 19, 0, 21, 124, 1475 }, // ∑
-    { 14, 4, 18, 2, 12, 14, 1599 }, // −
-    { 15, 23, 15, 0, 21, 87, 1613 }, // ∕
-    { 15, 23, 15, 0, 21, 87, 1700 }, // ∖
-    { 14, 14, 18, 2, 17, 49, 1787 }, // ∗
-    { 12, 11, 18, 3, 15, 33, 1836 }, // ∘
-    { 6, 6, 18, 6, 11, 9, 1869 }, // ∙
-    { 19, 28, 18, -1, 24, 133, 1878 }, // √
-    { 14, 12, 18, 2, 15, 42, 2011 }, // ∝
-    { 18, 11, 18, 0, 15, 50, 2053 }, // ∞
-    { 19, 21, 29, 5, 21, 100, 2103 }, // ∟
-    { 23, 21, 29, 3, 21, 121, 2203 }, // ∠
-    { 5, 30, 15, 5, 23, 38, 2324 }, // ∣
-    { 11, 30, 15, 2, 23, 83, 2362 }, // ∥
-    { 21, 21, 29, 4, 21, 111, 2445 }, // ∧
-    { 21, 21, 29, 4, 21, 111, 2556 }, // ∨
-    { 17, 21, 29, 6, 21, 90, 2667 }, // ∩
-    { 17, 22, 29, 6, 21, 94, 2757 }, // ∪
-    { 16, 30, 18, 1, 23, 120, 2851 }, // ∫
-    { 19, 18, 29, 5, 17, 86, 2971 }, // ∴
-    { 19, 18, 29, 5, 17, 86, 3057 }, // ∵
-    { 7, 16, 9, 1, 18, 28, 3143 }, // ∶
-    { 19, 18, 29, 5, 17, 86, 3171 }, // ∷
-    { 17, 7, 29, 6, 12, 30, 3257 }, // ∼
-    { 17, 17, 29, 6, 18, 73, 3287 }, // ≅
-    { 14, 12, 18, 2, 16, 42, 3360 }, // ≈
-    { 17, 12, 29, 6, 14, 51, 3402 }, // ≍
-    { 14, 15, 18, 2, 17, 53, 3453 }, // ≠
-    { 17, 15, 29, 6, 16, 64, 3506 }, // ≡
-    { 14, 18, 18, 2, 18, 63, 3570 }, // ≤
-    { 14, 18, 18, 2, 18, 63, 3633 }, // ≥
-    { 25, 14, 29, 2, 17, 88, 3696 }, // ≪
-    { 25, 14, 29, 2, 17, 88, 3784 }, // ≫
-    { 21, 18, 29, 4, 19, 95, 3872 }, // ⊃
-    { 21, 26, 29, 4, 23, 137, 3967 }, // ⊄
-    { 21, 26, 29, 4, 23, 137, 4104 }, // ⊅
-    { 19, 21, 29, 5, 21, 100, 4241 }, // ⊆
-    { 19, 21, 29, 5, 21, 100, 4341 }, // ⊇
-    { 21, 22, 29, 4, 21, 116, 4441 }, // ⊕
-    { 21, 22, 29, 4, 21, 116, 4557 }, // ⊖
-    { 21, 22, 29, 4, 21, 116, 4673 }, // ⊗
-    { 21, 22, 29, 4, 21, 116, 4789 }, // ⊘
-    { 17, 21, 29, 6, 21, 90, 4905 }, // ⊥
-    { 6, 6, 18, 6, 11, 9, 4995 }, // ⋅
-    { 25, 6, 29, 2, 11, 38, 5004 }, // ⋯
-    { 27, 28, 29, 1, 24, 189, 0 }, // �
+    { 16, 12, 17, 0, 13, 48, 7771 }, // «
+    { 14, 8, 18, 2, 14, 28, 693 }, // ¬
+    { 9, 5, 11, 1, 10, 12, 721 }, // ­
+    { 17, 16, 17, 0, 23, 68, 733 }, // ®
+    { 11, 3, 20, 4, 21, 9, 801 }, // ¯
+    { 11, 12, 15, 2, 21, 33, 810 }, // °
+    { 14, 18, 18, 2, 17, 63, 843 }, // ±
+    { 11, 14, 13, 1, 24, 39, 906 }, // ²
+    { 11, 14, 13, 1, 24, 39, 945 }, // ³
+    { 6, 8, 20, 7, 25, 12, 984 }, // ´
+    { 19, 23, 19, 1, 16, 110, 996 }, // µ
+    { 17, 26, 17, 0, 21, 111, 1106 }, // ¶
+    { 6, 6, 8, 1, 11, 9, 1217 }, // ·
+    { 6, 7, 20, 7, -1, 11, 1226 }, // ¸
+    { 10, 14, 13, 1, 24, 35, 1237 }, // ¹
+    { 11, 15, 13, 1, 21, 42, 1272 }, // º
+    { 16, 12, 17, 1, 13, 48, 7819 }, // »
+    { 30, 25, 31, 1, 22, 188, 1314 }, // ¼
+    { 30, 25, 31, 1, 22, 188, 1502 }, // ½
+    { 30, 25, 31, 1, 22, 188, 1690 }, // ¾
+    { 12, 23, 14, 1, 16, 69, 1878 }, // ¿
+    { 23, 29, 22, 0, 29, 167, 7867 }, // À
+    { 23, 29, 22, 0, 29, 167, 8034 }, // Á
+    { 23, 28, 22, 0, 28, 161, 8201 }, // Â
+    { 23, 28, 22, 0, 28, 161, 1947 }, // Ã
+    { 23, 27, 22, 0, 27, 156, 8362 }, // Ä
+    { 23, 29, 22, 0, 29, 167, 2108 }, // Å
+    { 29, 21, 28, -1, 21, 153, 2275 }, // Æ
+    { 17, 29, 19, 1, 21, 124, 8518 }, // Ç
+    { 17, 29, 19, 1, 29, 124, 8642 }, // È
+    { 17, 29, 19, 1, 29, 124, 8766 }, // É
+    { 17, 28, 19, 1, 28, 119, 8890 }, // Ê
+    { 17, 27, 19, 1, 27, 115, 9009 }, // Ë
+    { 11, 29, 12, 1, 29, 80, 9124 }, // Ì
+    { 11, 29, 12, 1, 29, 80, 9204 }, // Í
+    { 12, 28, 12, 0, 28, 84, 9284 }, // Î
+    { 12, 27, 12, 0, 27, 81, 9368 }, // Ï
+    { 22, 22, 23, 0, 21, 121, 2428 }, // Ð
+    { 24, 29, 23, 0, 28, 174, 9449 }, // Ñ
+    { 21, 30, 23, 1, 29, 158, 9623 }, // Ò
+    { 21, 30, 23, 1, 29, 158, 9781 }, // Ó
+    { 21, 29, 23, 1, 28, 153, 9939 }, // Ô
+    { 21, 29, 23, 1, 28, 153, 2549 }, // Õ
+    { 21, 28, 23, 1, 27, 147, 10092 }, // Ö
+    { 13, 13, 18, 3, 16, 43, 2702 }, // ×
+    { 23, 22, 23, 0, 21, 127, 2745 }, // Ø
+    { 23, 30, 23, 0, 29, 173, 10239 }, // Ù
+    { 23, 30, 23, 0, 29, 173, 10412 }, // Ú
+    { 23, 29, 23, 0, 28, 167, 10585 }, // Û
+    { 23, 28, 23, 0, 27, 161, 10752 }, // Ü
+    { 21, 29, 21, 0, 29, 153, 2872 }, // Ý
+    { 17, 21, 19, 1, 21, 90, 3025 }, // Þ
+    { 19, 24, 19, 0, 23, 114, 3115 }, // ß
+    { 16, 26, 16, 1, 25, 104, 10913 }, // à
+    { 16, 26, 16, 1, 25, 104, 11017 }, // á
+    { 16, 25, 16, 1, 24, 100, 11121 }, // â
+    { 16, 24, 16, 1, 23, 96, 3229 }, // ã
+    { 16, 24, 16, 1, 23, 96, 11221 }, // ä
+    { 16, 26, 16, 1, 25, 104, 3325 }, // å
+    { 22, 17, 24, 1, 16, 94, 3429 }, // æ
+    { 14, 24, 15, 1, 16, 84, 11317 }, // ç
+    { 14, 26, 16, 1, 25, 91, 11401 }, // è
+    { 14, 26, 16, 1, 25, 91, 11492 }, // é
+    { 14, 25, 16, 1, 24, 88, 11583 }, // ê
+    { 14, 24, 16, 1, 23, 84, 11671 }, // ë
+    { 10, 25, 10, 0, 25, 63, 11755 }, // ì
+    { 10, 25, 10, 0, 25, 63, 11818 }, // í
+    { 11, 24, 10, 0, 24, 66, 11881 }, // î
+    { 11, 23, 10, 0, 23, 64, 11947 }, // ï
+    { 16, 25, 18, 1, 24, 100, 3523 }, // ð
+    { 20, 23, 20, 0, 23, 115, 12011 }, // ñ
+    { 16, 26, 18, 1, 25, 104, 12126 }, // ò
+    { 16, 26, 18, 1, 25, 104, 12230 }, // ó
+    { 16, 25, 18, 1, 24, 100, 12334 }, // ô
+    { 16, 24, 18, 1, 23, 96, 3623 }, // õ
+    { 16, 24, 18, 1, 23, 96, 12434 }, // ö
+    { 14, 14, 18, 2, 17, 49, 3719 }, // ÷
+    { 17, 17, 18, 0, 16, 73, 3768 }, // ø
+    { 20, 26, 19, 0, 25, 130, 12530 }, // ù
+    { 20, 26, 19, 0, 25, 130, 12660 }, // ú
+    { 20, 25, 19, 0, 24, 125, 12790 }, // û
+    { 20, 24, 19, 0, 23, 120, 12915 }, // ü
+    { 19, 32, 19, 0, 25, 152, 3841 }, // ý
+    { 18, 30, 18, 0, 23, 135, 3993 }, // þ
+    { 19, 30, 19, 0, 23, 143, 4128 }, // ÿ
+    { 23, 26, 22, 0, 26, 150, 4271 }, // Ā
+    { 16, 22, 16, 1, 21, 88, 4421 }, // ā
+    { 23, 28, 22, 0, 28, 161, 4509 }, // Ă
+    { 16, 24, 16, 1, 23, 96, 4670 }, // ă
+    { 23, 28, 22, 0, 21, 161, 4766 }, // Ą
+    { 16, 23, 16, 1, 16, 92, 4927 }, // ą
+    { 17, 30, 19, 1, 29, 128, 5019 }, // Ć
+    { 14, 26, 15, 1, 25, 91, 5147 }, // ć
+    { 17, 29, 19, 1, 28, 124, 5238 }, // Ĉ
+    { 14, 25, 15, 1, 24, 88, 5362 }, // ĉ
+    { 17, 29, 19, 1, 28, 124, 5450 }, // Ċ
+    { 14, 24, 15, 1, 23, 84, 5574 }, // ċ
+    { 17, 29, 19, 1, 28, 124, 5658 }, // Č
+    { 14, 25, 15, 1, 24, 88, 5782 }, // č
+    { 21, 29, 23, 1, 28, 153, 5870 }, // Ď
+    { 20, 24, 19, 1, 23, 120, 6023 }, // ď
+    { 22, 22, 23, 0, 21, 121, 6143 }, // Đ
+    { 18, 24, 18, 1, 23, 108, 6264 }, // đ
+    { 17, 26, 19, 1, 26, 111, 6372 }, // Ē
+    { 14, 22, 16, 1, 21, 77, 6483 }, // ē
+    { 17, 28, 19, 1, 28, 119, 6560 }, // Ĕ
+    { 14, 24, 16, 1, 23, 84, 6679 }, // ĕ
+    { 17, 28, 19, 1, 28, 119, 6763 }, // Ė
+    { 14, 24, 16, 1, 23, 84, 6882 }, // ė
+    { 17, 28, 19, 1, 21, 119, 6966 }, // Ę
+    { 14, 23, 16, 1, 16, 81, 7085 }, // ę
+    { 17, 28, 19, 1, 28, 119, 7166 }, // Ě
+    { 14, 25, 16, 1, 24, 88, 7285 }, // ě
+    { 20, 29, 21, 1, 28, 145, 7373 }, // Ĝ
+    { 18, 31, 18, 0, 24, 140, 7518 }, // ĝ
+    { 20, 29, 21, 1, 28, 145, 7658 }, // Ğ
+    { 18, 30, 18, 0, 23, 135, 7803 }, // ğ
+    { 20, 29, 21, 1, 28, 145, 7938 }, // Ġ
+    { 18, 30, 18, 0, 23, 135, 8083 }, // ġ
+    { 20, 29, 21, 1, 21, 145, 8218 }, // Ģ
+    { 18, 32, 18, 0, 25, 144, 8363 }, // ģ
+    { 23, 28, 25, 1, 28, 161, 8507 }, // Ĥ
+    { 20, 30, 19, -1, 30, 150, 8668 }, // ĥ
+    { 25, 21, 25, 0, 21, 132, 8818 }, // Ħ
+    { 19, 23, 19, 0, 23, 110, 8950 }, // ħ
+    { 11, 28, 12, 1, 28, 77, 9060 }, // Ĩ
+    { 11, 23, 10, 0, 23, 64, 9137 }, // ĩ
+    { 11, 26, 12, 1, 26, 72, 9201 }, // Ī
+    { 11, 21, 10, 0, 21, 58, 9273 }, // ī
+    { 11, 28, 12, 1, 28, 77, 9331 }, // Ĭ
+    { 11, 23, 10, 0, 23, 64, 9408 }, // ĭ
+    { 11, 28, 12, 1, 21, 77, 9472 }, // Į
+    { 11, 30, 10, 0, 23, 83, 9549 }, // į
+    { 11, 28, 12, 1, 28, 77, 9632 }, // İ
+    { 10, 16, 10, 0, 16, 40, 9709 }, // ı
+    { 23, 27, 24, 1, 21, 156, 9749 }, // Ĳ
+    { 18, 30, 19, 0, 23, 135, 9905 }, // ĳ
+    { 14, 34, 11, -2, 28, 119, 10040 }, // Ĵ
+    { 12, 31, 9, -2, 24, 93, 10159 }, // ĵ
+    { 21, 29, 22, 1, 21, 153, 10252 }, // Ķ
+    { 19, 31, 18, 0, 23, 148, 10405 }, // ķ
+    { 19, 17, 19, 0, 16, 81, 10553 }, // ĸ
+    { 17, 29, 18, 1, 29, 124, 10634 }, // Ĺ
+    { 10, 30, 10, 0, 30, 75, 10758 }, // ĺ
+    { 17, 29, 18, 1, 21, 124, 10833 }, // Ļ
+    { 10, 31, 10, 0, 23, 78, 10957 }, // ļ
+    { 17, 23, 18, 1, 23, 98, 11035 }, // Ľ
+    { 13, 23, 11, 0, 23, 75, 11133 }, // ľ
+    { 17, 21, 18, 1, 21, 90, 11208 }, // Ŀ
+    { 16, 23, 16, 0, 23, 92, 11298 }, // ŀ
+    { 19, 21, 18, -1, 21, 100, 11390 }, // Ł
+    { 12, 23, 10, -1, 23, 69, 11490 }, // ł
+    { 24, 30, 23, 0, 29, 180, 11559 }, // Ń
+    { 20, 25, 20, 0, 25, 125, 11739 }, // ń
+    { 24, 29, 23, 0, 21, 174, 11864 }, // Ņ
+    { 20, 24, 20, 0, 16, 120, 12038 }, // ņ
+    { 24, 29, 23, 0, 28, 174, 12158 }, // Ň
+    { 20, 24, 20, 0, 24, 120, 12332 }, // ň
+    { 26, 21, 26, 0, 21, 137, 12452 }, // ŉ
+    { 24, 27, 23, 0, 21, 162, 12589 }, // Ŋ
+    { 18, 23, 19, 0, 16, 104, 12751 }, // ŋ
+    { 21, 27, 23, 1, 26, 142, 12855 }, // Ō
+    { 16, 22, 18, 1, 21, 88, 12997 }, // ō
+    { 21, 29, 23, 1, 28, 153, 13085 }, // Ŏ
+    { 16, 24, 18, 1, 23, 96, 13238 }, // ŏ
+    { 21, 30, 23, 1, 29, 158, 13334 }, // Ő
+    { 16, 26, 18, 1, 25, 104, 13492 }, // ő
+    { 28, 22, 29, 1, 21, 154, 13035 }, // Œ
+    { 25, 17, 26, 1, 16, 107, 13189 }, // œ
+    { 21, 30, 21, 1, 29, 158, 13596 }, // Ŕ
+    { 14, 25, 14, 0, 25, 88, 13754 }, // ŕ
+    { 21, 29, 21, 1, 21, 153, 13842 }, // Ŗ
+    { 14, 24, 14, 0, 16, 84, 13995 }, // ŗ
+    { 21, 29, 21, 1, 28, 153, 14079 }, // Ř
+    { 14, 24, 14, 0, 24, 84, 14232 }, // ř
+    { 15, 30, 17, 1, 29, 113, 14316 }, // Ś
+    { 13, 26, 15, 1, 25, 85, 14429 }, // ś
+    { 15, 29, 17, 1, 28, 109, 14514 }, // Ŝ
+    { 13, 25, 15, 1, 24, 82, 14623 }, // ŝ
+    { 15, 29, 17, 1, 21, 109, 14705 }, // Ş
+    { 13, 24, 15, 1, 16, 78, 14814 }, // ş
+    { 15, 29, 17, 1, 28, 109, 14892 }, // Š
+    { 13, 25, 15, 1, 24, 82, 15001 }, // š
+    { 20, 29, 21, 0, 21, 145, 15083 }, // Ţ
+    { 13, 27, 12, -1, 19, 88, 15228 }, // ţ
+    { 20, 28, 21, 0, 28, 140, 15316 }, // Ť
+    { 13, 25, 12, -1, 24, 82, 15456 }, // ť
+    { 20, 21, 21, 0, 21, 105, 15538 }, // Ŧ
+    { 13, 20, 12, -1, 19, 65, 15643 }, // ŧ
+    { 23, 29, 23, 0, 28, 167, 15708 }, // Ũ
+    { 20, 24, 19, 0, 23, 120, 15875 }, // ũ
+    { 23, 27, 23, 0, 26, 156, 15995 }, // Ū
+    { 20, 22, 19, 0, 21, 110, 16151 }, // ū
+    { 23, 29, 23, 0, 28, 167, 16261 }, // Ŭ
+    { 20, 24, 19, 0, 23, 120, 16428 }, // ŭ
+    { 23, 30, 23, 0, 29, 173, 16548 }, // Ů
+    { 20, 26, 19, 0, 25, 130, 16721 }, // ů
+    { 23, 30, 23, 0, 29, 173, 16851 }, // Ű
+    { 20, 26, 19, 0, 25, 130, 17024 }, // ű
+    { 23, 28, 23, 0, 21, 161, 17154 }, // Ų
+    { 20, 23, 19, 0, 16, 115, 17315 }, // ų
+    { 32, 29, 32, 0, 28, 232, 17430 }, // Ŵ
+    { 26, 25, 26, 0, 24, 163, 17662 }, // ŵ
+    { 21, 28, 21, 0, 28, 147, 17825 }, // Ŷ
+    { 19, 31, 19, 0, 24, 148, 17972 }, // ŷ
+    { 21, 27, 21, 0, 27, 142, 18120 }, // Ÿ
+    { 17, 30, 18, 0, 29, 128, 18262 }, // Ź
+    { 15, 26, 15, 0, 25, 98, 18390 }, // ź
+    { 17, 29, 18, 0, 28, 124, 18488 }, // Ż
+    { 15, 24, 15, 0, 23, 90, 18612 }, // ż
+    { 17, 29, 18, 0, 28, 124, 18702 }, // Ž
+    { 15, 25, 15, 0, 24, 94, 18826 }, // ž
+    { 15, 23, 12, 0, 23, 87, 18920 }, // ſ
+    { 7, 8, 0, -5, 25, 14, 19007 }, // ̀
+    { 6, 8, 0, -2, 25, 12, 19021 }, // ́
+    { 10, 7, 0, -5, 24, 18, 19033 }, // ̂
+    { 10, 5, 0, -5, 23, 13, 19051 }, // ̃
+    { 10, 3, 0, -5, 21, 8, 19064 }, // ̄
+    { 10, 6, 0, -5, 23, 15, 19072 }, // ̆
+    { 6, 5, 0, -3, 23, 8, 19087 }, // ̇
+    { 12, 5, 0, -6, 23, 15, 19095 }, // ̈
+    { 8, 9, 0, -4, 26, 18, 19110 }, // ̉
+    { 8, 9, 0, -4, 25, 18, 19128 }, // ̊
+    { 11, 8, 0, -4, 25, 22, 19146 }, // ̋
+    { 10, 7, 0, -5, 24, 18, 19168 }, // ̌
+    { 11, 8, 0, -7, 25, 22, 19186 }, // ̏
+    { 10, 6, 0, -5, 23, 15, 19208 }, // ̑
+    { 6, 8, 0, -3, 25, 12, 19223 }, // ̒
+    { 6, 9, 0, -2, 26, 14, 19235 }, // ̓
+    { 6, 9, 0, -4, 26, 14, 19249 }, // ̔
+    { 4, 8, 0, -2, 25, 8, 19263 }, // ̕
+    { 6, 8, 0, -3, 19, 12, 19271 }, // ̛
+    { 6, 5, 0, -3, -2, 8, 19283 }, // ̣
+    { 12, 5, 0, -6, -2, 15, 19291 }, // ̤
+    { 8, 7, 0, -4, -1, 14, 19306 }, // ̥
+    { 6, 7, 0, -3, -1, 11, 19320 }, // ̦
+    { 6, 7, 0, -3, -1, 11, 19331 }, // ̧
+    { 8, 8, 0, -4, 1, 16, 19342 }, // ̨
+    { 4, 8, 8, 2, -1, 8, 19358 }, // ̩
+    { 12, 7, 0, -6, -1, 21, 19366 }, // ̭
+    { 10, 6, 0, -5, -2, 15, 19387 }, // ̮
+    { 10, 6, 0, -5, -2, 15, 19402 }, // ̰
+    { 10, 3, 0, -5, -3, 8, 19417 }, // ̱
+    { 10, 6, 0, -5, 23, 15, 19425 }, // ͂
+    { 12, 12, 0, -6, 30, 36, 19440 }, // ̈́
+    { 6, 6, 0, -2, -2, 9, 19476 }, // ͅ
+    { 17, 29, 19, 1, 29, 124, 19485 }, // Ѐ
+    { 17, 27, 19, 1, 27, 115, 0 }, // Ё
+    { 24, 27, 25, 0, 21, 162, 19609 }, // Ђ
+    { 17, 29, 18, 1, 29, 124, 19771 }, // Ѓ
+    { 18, 22, 20, 1, 21, 99, 19895 }, // Є
+    { 15, 22, 17, 1, 21, 83, 19994 }, // Ѕ
+    { 11, 21, 12, 1, 21, 58, 20077 }, // І
+    { 12, 27, 12, 0, 27, 81, 20135 }, // Ї
+    { 14, 27, 11, -2, 21, 95, 20216 }, // Ј
+    { 28, 22, 29, 0, 21, 154, 20311 }, // Љ
+    { 29, 22, 31, 1, 21, 160, 20465 }, // Њ
+    { 27, 21, 27, 0, 21, 142, 20625 }, // Ћ
+    { 21, 30, 22, 1, 29, 158, 20767 }, // Ќ
+    { 23, 29, 25, 1, 29, 167, 20925 }, // Ѝ
+    { 21, 29, 21, 0, 28, 153, 21092 }, // Ў
+    { 22, 28, 24, 1, 21, 154, 21245 }, // Џ
+    { 23, 21, 22, 0, 21, 121, 115 }, // А
+    { 17, 22, 19, 1, 21, 94, 236 }, // Б
+    { 17, 22, 19, 1, 21, 94, 330 }, // В
+    { 17, 21, 18, 1, 21, 90, 424 }, // Г
+    { 23, 27, 23, 0, 21, 156, 514 }, // Д
+    { 17, 21, 19, 1, 21, 90, 670 }, // Е
+    { 32, 22, 32, 0, 21, 176, 760 }, // Ж
+    { 17, 22, 18, 1, 21, 94, 936 }, // З
+    { 23, 21, 25, 1, 21, 121, 1030 }, // И
+    { 23, 28, 25, 1, 28, 161, 1151 }, // Й
+    { 21, 22, 22, 1, 21, 116, 1312 }, // К
+    { 22, 22, 22, 0, 21, 121, 1428 }, // Л
+    { 27, 21, 28, 0, 21, 142, 1549 }, // М
+    { 23, 21, 25, 1, 21, 121, 1691 }, // Н
+    { 21, 22, 23, 1, 21, 116, 1812 }, // О
+    { 23, 21, 24, 1, 21, 121, 1928 }, // П
+    { 17, 21, 18, 1, 21, 90, 2049 }, // Р
+    { 17, 22, 19, 1, 21, 94, 2139 }, // С
+    { 20, 21, 21, 0, 21, 105, 2233 }, // Т
+    { 21, 22, 21, 0, 21, 116, 2338 }, // У
+    { 22, 22, 23, 1, 21, 121, 2454 }, // Ф
+    { 22, 21, 22, 0, 21, 116, 2575 }, // Х
+    { 23, 27, 24, 1, 21, 156, 2691 }, // Ц
+    { 22, 21, 22, 0, 21, 116, 2847 }, // Ч
+    { 31, 21, 32, 1, 21, 163, 2963 }, // Ш
+    { 32, 27, 33, 1, 21, 216, 3126 }, // Щ
+    { 22, 22, 23, 0, 21, 121, 3342 }, // Ъ
+    { 28, 22, 30, 1, 21, 154, 3463 }, // Ы
+    { 17, 22, 19, 1, 21, 94, 3617 }, // Ь
+    { 18, 22, 20, 1, 21, 99, 3711 }, // Э
+    { 30, 22, 32, 1, 21, 165, 3810 }, // Ю
+    { 20, 22, 21, 0, 21, 110, 3975 }, // Я
+    { 16, 17, 16, 1, 16, 68, 4085 }, // а
+    { 16, 24, 17, 1, 23, 96, 4153 }, // б
+    { 15, 17, 17, 1, 16, 64, 4249 }, // в
+    { 14, 16, 15, 1, 16, 56, 4313 }, // г
+    { 20, 22, 20, 0, 16, 110, 4369 }, // д
+    { 14, 17, 16, 1, 16, 60, 4479 }, // е
+    { 26, 17, 26, 0, 16, 111, 4539 }, // ж
+    { 14, 17, 15, 0, 16, 60, 4650 }, // з
+    { 19, 16, 20, 1, 16, 76, 4710 }, // и
+    { 19, 23, 20, 1, 23, 110, 4786 }, // й
+    { 18, 17, 19, 1, 16, 77, 4896 }, // к
+    { 18, 17, 19, 0, 16, 77, 4973 }, // л
+    { 21, 16, 23, 1, 16, 84, 5050 }, // м
+    { 19, 16, 20, 1, 16, 76, 5134 }, // н
+    { 16, 17, 18, 1, 16, 68, 5210 }, // о
+    { 19, 16, 20, 1, 16, 76, 5278 }, // п
+    { 18, 23, 18, 0, 16, 104, 5354 }, // р
+    { 14, 17, 15, 1, 16, 60, 5458 }, // с
+    { 17, 16, 18, 0, 16, 68, 5518 }, // т
+    { 19, 23, 19, 0, 16, 110, 5586 }, // у
+    { 21, 30, 23, 1, 23, 158, 5696 }, // ф
+    { 18, 16, 18, 0, 16, 72, 5854 }, // х
+    { 19, 22, 20, 1, 16, 105, 5926 }, // ц
+    { 18, 16, 19, 0, 16, 72, 6031 }, // ч
+    { 25, 16, 27, 1, 16, 100, 6103 }, // ш
+    { 26, 22, 27, 1, 16, 143, 6203 }, // щ
+    { 19, 17, 19, 0, 16, 81, 6346 }, // ъ
+    { 24, 17, 25, 1, 16, 102, 6427 }, // ы
+    { 15, 17, 16, 1, 16, 64, 6529 }, // ь
+    { 15, 17, 16, 0, 16, 64, 6593 }, // э
+    { 24, 17, 26, 1, 16, 102, 6657 }, // ю
+    { 17, 17, 18, 0, 16, 73, 6759 }, // я
+    { 14, 26, 16, 1, 25, 91, 21399 }, // ѐ
+    { 14, 24, 16, 1, 23, 84, 6832 }, // ё
+    { 18, 30, 19, 0, 23, 135, 21490 }, // ђ
+    { 14, 25, 15, 1, 25, 88, 21625 }, // ѓ
+    { 14, 17, 16, 1, 16, 60, 21713 }, // є
+    { 13, 17, 15, 1, 16, 56, 21773 }, // ѕ
+    { 10, 23, 10, 0, 23, 58, 21829 }, // і
+    { 11, 23, 10, 0, 23, 64, 21887 }, // ї
+    { 10, 30, 9, -2, 23, 75, 21951 }, // ј
+    { 23, 17, 23, 0, 16, 98, 22026 }, // љ
+    { 24, 17, 25, 1, 16, 102, 22124 }, // њ
+    { 19, 23, 19, 0, 23, 110, 22226 }, // ћ
+    { 18, 26, 19, 1, 25, 117, 22336 }, // ќ
+    { 19, 25, 20, 1, 25, 119, 22453 }, // ѝ
+    { 19, 30, 19, 0, 23, 143, 22572 }, // ў
+    { 18, 22, 20, 1, 16, 99, 22715 }, // џ
+    { 20, 24, 22, 1, 23, 120, 22814 }, // Ѣ
+    { 19, 22, 19, 0, 21, 105, 22934 }, // ѣ
+    { 21, 22, 23, 1, 21, 116, 23039 }, // Ѳ
+    { 16, 17, 18, 1, 16, 68, 23155 }, // ѳ
+    { 23, 22, 23, 0, 21, 127, 23223 }, // Ѵ
+    { 20, 17, 19, 0, 16, 85, 23350 }, // ѵ
+    { 24, 34, 25, 1, 28, 204, 23435 }, // Ҋ
+    { 20, 29, 20, 0, 23, 145, 23639 }, // ҋ
+    { 18, 22, 19, 0, 21, 99, 23784 }, // Ҍ
+    { 15, 22, 16, 0, 21, 83, 23883 }, // ҍ
+    { 17, 21, 18, 1, 21, 90, 23966 }, // Ҏ
+    { 18, 23, 18, 0, 16, 104, 24056 }, // ҏ
+    { 15, 24, 17, 1, 24, 90, 24160 }, // Ґ
+    { 13, 19, 15, 1, 19, 62, 24250 }, // ґ
+    { 18, 21, 18, 0, 21, 95, 24312 }, // Ғ
+    { 15, 16, 16, 0, 16, 60, 24407 }, // ғ
+    { 19, 27, 21, 1, 21, 129, 24467 }, // Ҕ
+    { 16, 23, 18, 1, 16, 92, 24596 }, // ҕ
+    { 32, 27, 32, 0, 21, 216, 24688 }, // Җ
+    { 26, 22, 26, 0, 16, 143, 24904 }, // җ
+    { 17, 28, 18, 1, 21, 119, 0 }, // Ҙ
+    { 14, 22, 15, 0, 16, 77, 119 }, // ҙ
+    { 21, 27, 22, 1, 21, 142, 196 }, // Қ
+    { 18, 22, 19, 1, 16, 99, 338 }, // қ
+    { 23, 22, 23, 1, 21, 127, 437 }, // Ҝ
+    { 18, 17, 19, 1, 16, 77, 564 }, // ҝ
+    { 22, 22, 22, 0, 21, 121, 641 }, // Ҟ
+    { 19, 22, 18, 0, 21, 105, 762 }, // ҟ
+    { 26, 22, 25, 0, 21, 143, 867 }, // Ҡ
+    { 22, 17, 22, 0, 16, 94, 1010 }, // ҡ
+    { 24, 27, 25, 1, 21, 162, 1104 }, // Ң
+    { 20, 22, 21, 1, 16, 110, 1266 }, // ң
+    { 27, 21, 29, 1, 21, 142, 1376 }, // Ҥ
+    { 22, 16, 24, 1, 16, 88, 1518 }, // ҥ
+    { 31, 27, 32, 1, 21, 210, 1606 }, // Ҧ
+    { 26, 23, 27, 1, 16, 150, 1816 }, // ҧ
+    { 24, 22, 25, 1, 21, 132, 1966 }, // Ҩ
+    { 19, 17, 20, 1, 16, 81, 2098 }, // ҩ
+    { 17, 28, 19, 1, 21, 119, 2179 }, // Ҫ
+    { 14, 22, 15, 1, 16, 77, 2298 }, // ҫ
+    { 20, 27, 21, 0, 21, 135, 2375 }, // Ҭ
+    { 17, 22, 18, 0, 16, 94, 2510 }, // ҭ
+    { 21, 21, 21, 0, 21, 111, 2604 }, // Ү
+    { 19, 23, 19, 0, 16, 110, 2715 }, // ү
+    { 21, 21, 21, 0, 21, 111, 2825 }, // Ұ
+    { 19, 23, 19, 0, 16, 110, 2936 }, // ұ
+    { 23, 27, 23, 0, 21, 156, 3046 }, // Ҳ
+    { 18, 22, 18, 0, 16, 99, 3202 }, // ҳ
+    { 27, 27, 27, 0, 21, 183, 3301 }, // Ҵ
+    { 23, 22, 23, 0, 16, 127, 3484 }, // ҵ
+    { 23, 27, 23, 0, 21, 156, 3611 }, // Ҷ
+    { 19, 22, 19, 0, 16, 105, 3767 }, // ҷ
+    { 22, 21, 22, 0, 21, 116, 3872 }, // Ҹ
+    { 18, 16, 19, 0, 16, 72, 3988 }, // ҹ
+    { 22, 21, 23, 1, 21, 116, 4060 }, // Һ
+    { 19, 23, 19, 0, 23, 110, 4176 }, // һ
+    { 24, 22, 25, 0, 21, 132, 4286 }, // Ҽ
+    { 19, 17, 19, 0, 16, 81, 4418 }, // ҽ
+    { 24, 27, 25, 0, 21, 162, 4499 }, // Ҿ
+    { 19, 22, 19, 0, 16, 105, 4661 }, // ҿ
+    { 11, 21, 12, 1, 21, 58, 4766 }, // Ӏ
+    { 32, 29, 32, 0, 28, 232, 4824 }, // Ӂ
+    { 26, 24, 26, 0, 23, 156, 5056 }, // ӂ
+    { 20, 27, 21, 1, 21, 135, 5212 }, // Ӄ
+    { 17, 23, 18, 1, 16, 98, 5347 }, // ӄ
+    { 22, 27, 22, 0, 21, 149, 5445 }, // Ӆ
+    { 19, 22, 19, 0, 16, 105, 5594 }, // ӆ
+    { 23, 27, 24, 1, 21, 156, 5699 }, // Ӈ
+    { 19, 23, 20, 1, 16, 110, 5855 }, // ӈ
+    { 24, 27, 25, 1, 21, 162, 5965 }, // Ӊ
+    { 19, 22, 20, 1, 16, 105, 6127 }, // ӊ
+    { 22, 27, 22, 0, 21, 149, 6232 }, // Ӌ
+    { 18, 22, 19, 0, 16, 99, 6381 }, // ӌ
+    { 28, 27, 28, 0, 21, 189, 6480 }, // Ӎ
+    { 22, 22, 23, 1, 16, 121, 6669 }, // ӎ
+    { 10, 23, 12, 1, 23, 58, 6790 }, // ӏ
+    { 23, 28, 22, 0, 28, 161, 6848 }, // Ӑ
+    { 16, 24, 16, 1, 23, 96, 7009 }, // ӑ
+    { 23, 27, 22, 0, 27, 156, 7105 }, // Ӓ
+    { 16, 24, 16, 1, 23, 96, 7261 }, // ӓ
+    { 29, 21, 28, -1, 21, 153, 7357 }, // Ӕ
+    { 22, 17, 24, 1, 16, 94, 7510 }, // ӕ
+    { 17, 28, 19, 1, 28, 119, 7604 }, // Ӗ
+    { 14, 24, 16, 1, 23, 84, 7723 }, // ӗ
+    { 19, 22, 20, 1, 21, 105, 7807 }, // Ә
+    { 14, 17, 16, 1, 16, 60, 7912 }, // ә
+    { 19, 28, 20, 1, 27, 133, 7972 }, // Ӛ
+    { 14, 24, 16, 1, 23, 84, 8105 }, // ӛ
+    { 32, 28, 32, 0, 27, 224, 8189 }, // Ӝ
+    { 26, 24, 26, 0, 23, 156, 8413 }, // ӝ
+    { 17, 28, 18, 1, 27, 119, 8569 }, // Ӟ
+    { 14, 24, 15, 0, 23, 84, 8688 }, // ӟ
+    { 16, 22, 17, 0, 21, 88, 8772 }, // Ӡ
+    { 15, 23, 16, 0, 16, 87, 8860 }, // ӡ
+    { 23, 26, 25, 1, 26, 150, 8947 }, // Ӣ
+    { 19, 21, 20, 1, 21, 100, 9097 }, // ӣ
+    { 23, 27, 25, 1, 27, 156, 9197 }, // Ӥ
+    { 19, 23, 20, 1, 23, 110, 9353 }, // ӥ
+    { 21, 28, 23, 1, 27, 147, 9463 }, // Ӧ
+    { 16, 24, 18, 1, 23, 96, 9610 }, // ӧ
+    { 21, 22, 23, 1, 21, 116, 9706 }, // Ө
+    { 16, 17, 18, 1, 16, 68, 9822 }, // ө
+    { 21, 28, 23, 1, 27, 147, 9890 }, // Ӫ
+    { 16, 24, 18, 1, 23, 96, 10037 }, // ӫ
+    { 18, 28, 20, 1, 27, 126, 10133 }, // Ӭ
+    { 15, 24, 16, 0, 23, 90, 10259 }, // ӭ
+    { 21, 27, 21, 0, 26, 142, 10349 }, // Ӯ
+    { 19, 28, 19, 0, 21, 133, 10491 }, // ӯ
+    { 21, 28, 21, 0, 27, 147, 10624 }, // Ӱ
+    { 19, 30, 19, 0, 23, 143, 10771 }, // ӱ
+    { 21, 30, 21, 0, 29, 158, 10914 }, // Ӳ
+    { 19, 32, 19, 0, 25, 152, 11072 }, // ӳ
+    { 22, 27, 22, 0, 27, 149, 11224 }, // Ӵ
+    { 18, 23, 19, 0, 23, 104, 11373 }, // ӵ
+    { 17, 27, 18, 1, 21, 115, 11477 }, // Ӷ
+    { 14, 22, 15, 1, 16, 77, 11592 }, // ӷ
+    { 28, 28, 30, 1, 27, 196, 11669 }, // Ӹ
+    { 24, 24, 25, 1, 23, 144, 11865 }, // ӹ
+    { 18, 27, 18, 0, 21, 122, 12009 }, // Ӻ
+    { 15, 22, 15, 0, 16, 83, 12131 }, // ӻ
+    { 22, 27, 22, 0, 21, 149, 12214 }, // Ӽ
+    { 18, 23, 18, 0, 16, 104, 12363 }, // ӽ
+    { 22, 21, 22, 0, 21, 116, 12467 }, // Ӿ
+    { 18, 16, 18, 0, 16, 72, 12583 }, // ӿ
+    { 0, 0, 15, 0, 0, 0, 12655 }, //  
+    { 0, 0, 29, 0, 0, 0, 12655 }, //  
+    { 0, 0, 15, 0, 0, 0, 12655 }, //  
+    { 0, 0, 29, 0, 0, 0, 12655 }, //  
+    { 0, 0, 10, 0, 0, 0, 12655 }, //  
+    { 0, 0, 7, 0, 0, 0, 12655 }, //  
+    { 0, 0, 5, 0, 0, 0, 12655 }, //  
+    { 0, 0, 18, 0, 0, 0, 12655 }, //  
+    { 0, 0, 8, 0, 0, 0, 12655 }, //  
+    { 0, 0, 6, 0, 0, 0, 12655 }, //  
+    { 0, 0, 1, 0, 0, 0, 12655 }, //  
+    { 0, 0, 0, 0, 0, 0, 12655 }, // ​
+    { 2, 24, 0, -1, 17, 12, 12655 }, // ‌
+    { 6, 26, 0, -3, 19, 39, 12667 }, // ‍
+    { 10, 28, 0, -5, 21, 70, 12706 }, // ‎
+    { 10, 28, 0, -5, 21, 70, 12776 }, // ‏
+    { 9, 5, 11, 1, 10, 12, 12846 }, // ‐
+    { 9, 5, 11, 1, 10, 12, 12858 }, // ‑
+    { 14, 3, 18, 2, 11, 11, 12870 }, // ‒
+    { 15, 3, 15, 0, 9, 12, 13296 }, // –
+    { 29, 3, 29, 0, 9, 22, 13308 }, // —
+    { 29, 3, 29, 0, 9, 22, 12881 }, // ―
+    { 11, 30, 15, 2, 23, 83, 12903 }, // ‖
+    { 15, 8, 15, 0, -1, 30, 12986 }, // ‗
+    { 6, 10, 7, 1, 22, 15, 13330 }, // ‘
+    { 7, 10, 7, 0, 22, 18, 13345 }, // ’
+    { 7, 10, 7, 0, 4, 18, 13016 }, // ‚
+    { 6, 10, 7, 1, 22, 15, 13034 }, // ‛
+    { 12, 10, 13, 1, 22, 30, 13363 }, // “
+    { 12, 10, 13, 0, 22, 30, 13393 }, // ”
+    { 12, 10, 13, 0, 4, 30, 13049 }, // „
+    { 12, 10, 13, 1, 22, 30, 13079 }, // ‟
+    { 14, 19, 14, 0, 21, 67, 13109 }, // †
+    { 14, 23, 14, 0, 21, 81, 13176 }, // ‡
+    { 7, 7, 9, 1, 11, 13, 13257 }, // •
+    { 10, 10, 18, 4, 15, 25, 13270 }, // ‣
+    { 6, 6, 8, 1, 5, 9, 13295 }, // ․
+    { 13, 6, 15, 1, 5, 20, 13304 }, // ‥
+    { 25, 6, 29, 2, 5, 38, 13423 }, // …
+    { 6, 6, 8, 1, 11, 9, 13324 }, // ‧
+    { 0, 0, 0, 0, 0, 0, 13333 }, //  
+    { 0, 0, 0, 0, 0, 0, 13333 }, //  
+    { 10, 28, 0, -5, 21, 70, 13333 }, // ‪
+    { 10, 28, 0, -5, 21, 70, 13403 }, // ‫
+    { 10, 27, 0, -5, 20, 68, 13473 }, // ‬
+    { 12, 28, 0, -6, 21, 84, 13541 }, // ‭
+    { 12, 28, 0, -6, 21, 84, 13625 }, // ‮
+    { 0, 0, 3, 0, 0, 0, 13709 }, //  
+    { 39, 24, 40, 1, 22, 234, 13709 }, // ‰
+    { 8, 11, 8, 0, 21, 22, 13943 }, // ′
+    { 14, 11, 14, 0, 21, 39, 13965 }, // ″
+    { 20, 11, 21, 0, 21, 55, 14004 }, // ‴
+    { 8, 11, 8, 0, 21, 22, 14059 }, // ‵
+    { 13, 11, 15, 1, 21, 36, 14081 }, // ‶
+    { 19, 11, 21, 1, 21, 53, 14117 }, // ‷
+    { 13, 6, 14, 1, 0, 20, 14170 }, // ‸
+    { 9, 12, 10, 0, 13, 27, 14190 }, // ‹
+    { 8, 12, 10, 1, 13, 24, 14217 }, // ›
+    { 18, 20, 18, 0, 19, 90, 14241 }, // ※
+    { 14, 23, 17, 2, 22, 81, 14331 }, // ‼
+    { 15, 4, 15, 0, 25, 15, 14412 }, // ‾
+    { 7, 5, 9, 1, 10, 9, 14427 }, // ⁃
+    { 15, 25, 5, -5, 22, 94, 14436 }, // ⁄
+    { 25, 23, 27, 1, 22, 144, 14530 }, // ⁇
+    { 21, 23, 22, 1, 22, 121, 14674 }, // ⁈
+    { 19, 23, 22, 2, 22, 110, 14795 }, // ⁉
+    { 17, 7, 29, 6, 12, 30, 14905 }, // ⁓
+    { 27, 11, 27, 0, 21, 75, 14935 }, // ⁗
+    { 0, 0, 6, 0, 0, 0, 15010 }, //  
+    { 0, 0, 0, 0, 0, 0, 15010 }, // ⁠
+    { 0, 0, 0, 0, 0, 0, 15010 }, // ⁡
+    { 0, 0, 0, 0, 0, 0, 15010 }, // ⁢
+    { 0, 0, 0, 0, 0, 0, 15010 }, // ⁣
+    { 0, 0, 0, 0, 0, 0, 15010 }, // ⁤
+    { 13, 14, 13, 0, 24, 46, 15010 }, // ⁰
+    { 13, 14, 13, 0, 24, 46, 15056 }, // ⁴
+    { 11, 14, 13, 1, 24, 39, 15102 }, // ⁵
+    { 11, 14, 13, 1, 24, 39, 15141 }, // ⁶
+    { 11, 14, 13, 1, 24, 39, 15180 }, // ⁷
+    { 11, 14, 13, 1, 24, 39, 15219 }, // ⁸
+    { 11, 14, 13, 1, 24, 39, 15258 }, // ⁹
+    { 13, 11, 16, 2, 21, 36, 15297 }, // ⁿ
+    { 13, 15, 13, 0, 10, 49, 15333 }, // ₀
+    { 10, 14, 13, 1, 10, 35, 15382 }, // ₁
+    { 11, 14, 13, 1, 10, 39, 15417 }, // ₂
+    { 11, 15, 13, 1, 10, 42, 15456 }, // ₃
+    { 13, 15, 13, 0, 10, 49, 15498 }, // ₄
+    { 11, 14, 13, 1, 9, 39, 15547 }, // ₅
+    { 11, 15, 13, 1, 10, 42, 15586 }, // ₆
+    { 11, 14, 13, 1, 9, 39, 15628 }, // ₇
+    { 11, 15, 13, 1, 10, 42, 15667 }, // ₈
+    { 11, 15, 13, 1, 10, 42, 15709 }, // ₉
+    { 16, 20, 18, 1, 20, 80, 15751 }, // ₣
+    { 18, 22, 18, 0, 21, 99, 15831 }, // ₤
+    { 39, 22, 39, 0, 21, 215, 15930 }, // ₧
+    { 18, 22, 18, 0, 21, 99, 16145 }, // €
+    { 19, 14, 29, 5, 17, 67, 16244 }, // ←
+    { 13, 20, 29, 8, 20, 65, 16311 }, // ↑
+    { 19, 14, 29, 5, 17, 67, 16376 }, // →
+    { 13, 20, 29, 8, 20, 65, 16443 }, // ↓
+    { 19, 14, 29, 5, 17, 67, 16508 }, // ↔
+    { 13, 20, 29, 8, 20, 65, 16575 }, // ↕
+    { 15, 20, 29, 7, 20, 75, 16640 }, // ↨
+    { 13, 20, 29, 8, 20, 65, 16715 }, // ↲
+    { 13, 20, 29, 8, 20, 65, 16780 }, // ↳
+    { 17, 16, 29, 6, 18, 68, 16845 }, // ↵
+    { 19, 16, 29, 5, 18, 76, 16913 }, // ⇐
+    { 17, 18, 29, 6, 19, 77, 16989 }, // ⇑
+    { 19, 16, 29, 5, 18, 76, 17066 }, // ⇒
+    { 17, 18, 29, 6, 19, 77, 17142 }, // ⇓
+    { 19, 16, 29, 5, 18, 76, 17219 }, // ⇔
+    { 21, 22, 29, 4, 21, 116, 17295 }, // ∀
+    { 16, 24, 18, 1, 23, 96, 17411 }, // ∂
+    { 15, 21, 29, 7, 21, 79, 17507 }, // ∃
+    { 23, 24, 29, 3, 22, 138, 17586 }, // ∅
+    { 20, 21, 20, 0, 21, 105, 17724 }, // ∆
+    { 19, 22, 29, 5, 21, 105, 17829 }, // ∇
+    { 21, 21, 29, 4, 21, 111, 17934 }, // ∈
+    { 21, 26, 29, 4, 23, 137, 18045 }, // ∉
+    { 21, 18, 29, 4, 19, 95, 18182 }, // ∊
+    { 21, 21, 29, 4, 21, 111, 18277 }, // ∋
+    { 21, 26, 29, 4, 23, 137, 18388 }, // ∌
+    { 21, 18, 29, 4, 19, 95, 18525 }, // ∍
+    { 23, 26, 24, 1, 21, 150, 18620 }, // ∏
+    { 19, 26, 19, 0, 21, 124, 18770 }, // ∑
+    { 14, 4, 18, 2, 12, 14, 18894 }, // −
+    { 15, 23, 15, 0, 21, 87, 18908 }, // ∕
+    { 15, 23, 15, 0, 21, 87, 18995 }, // ∖
+    { 14, 14, 18, 2, 17, 49, 19082 }, // ∗
+    { 12, 11, 18, 3, 15, 33, 19131 }, // ∘
+    { 6, 6, 18, 6, 11, 9, 19164 }, // ∙
+    { 19, 28, 18, -1, 24, 133, 19173 }, // √
+    { 14, 12, 18, 2, 15, 42, 19306 }, // ∝
+    { 18, 11, 18, 0, 15, 50, 19348 }, // ∞
+    { 19, 21, 29, 5, 21, 100, 19398 }, // ∟
+    { 23, 21, 29, 3, 21, 121, 19498 }, // ∠
+    { 5, 30, 15, 5, 23, 38, 19619 }, // ∣
+    { 11, 30, 15, 2, 23, 83, 19657 }, // ∥
+    { 21, 21, 29, 4, 21, 111, 19740 }, // ∧
+    { 21, 21, 29, 4, 21, 111, 19851 }, // ∨
+    { 17, 21, 29, 6, 21, 90, 19962 }, // ∩
+    { 17, 22, 29, 6, 21, 94, 20052 }, // ∪
+    { 16, 30, 18, 1, 23, 120, 20146 }, // ∫
+    { 19, 18, 29, 5, 17, 86, 20266 }, // ∴
+    { 19, 18, 29, 5, 17, 86, 20352 }, // ∵
+    { 7, 16, 9, 1, 18, 28, 20438 }, // ∶
+    { 19, 18, 29, 5, 17, 86, 20466 }, // ∷
+    { 17, 7, 29, 6, 12, 30, 20552 }, // ∼
+    { 17, 17, 29, 6, 18, 73, 20582 }, // ≅
+    { 14, 12, 18, 2, 16, 42, 20655 }, // ≈
+    { 17, 12, 29, 6, 14, 51, 20697 }, // ≍
+    { 14, 15, 18, 2, 17, 53, 20748 }, // ≠
+    { 17, 15, 29, 6, 16, 64, 20801 }, // ≡
+    { 14, 18, 18, 2, 18, 63, 20865 }, // ≤
+    { 14, 18, 18, 2, 18, 63, 20928 }, // ≥
+    { 25, 14, 29, 2, 17, 88, 20991 }, // ≪
+    { 25, 14, 29, 2, 17, 88, 21079 }, // ≫
+    { 21, 18, 29, 4, 19, 95, 21167 }, // ⊃
+    { 21, 26, 29, 4, 23, 137, 21262 }, // ⊄
+    { 21, 26, 29, 4, 23, 137, 21399 }, // ⊅
+    { 19, 21, 29, 5, 21, 100, 21536 }, // ⊆
+    { 19, 21, 29, 5, 21, 100, 21636 }, // ⊇
+    { 21, 22, 29, 4, 21, 116, 21736 }, // ⊕
+    { 21, 22, 29, 4, 21, 116, 21852 }, // ⊖
+    { 21, 22, 29, 4, 21, 116, 21968 }, // ⊗
+    { 21, 22, 29, 4, 21, 116, 22084 }, // ⊘
+    { 17, 21, 29, 6, 21, 90, 22200 }, // ⊥
+    { 6, 6, 18, 6, 11, 9, 22290 }, // ⋅
+    { 25, 6, 29, 2, 11, 38, 22299 }, // ⋯
+    { 25, 23, 22, 0, 23, 144, 22337 }, // ﬀ
+    { 20, 23, 20, 0, 23, 115, 22481 }, // ﬁ
+    { 20, 23, 20, 0, 23, 115, 22596 }, // ﬂ
+    { 30, 23, 30, 0, 23, 173, 22711 }, // ﬃ
+    { 30, 23, 30, 0, 23, 173, 22884 }, // ﬄ
+    { 23, 24, 23, 0, 23, 138, 23057 }, // ﬅ
+    { 26, 24, 27, 1, 23, 156, 23195 }, // ﬆ
+    { 27, 28, 29, 1, 24, 189, 23351 }, // �
 };
 
 static const EpdUnicodeInterval bookerly_14_boldIntervals[] = {
@@ -2667,32 +2712,331 @@ static const EpdUnicodeInterval bookerly_14_boldIntervals[] = {
     { 0x22A5, 0x22A5, 0x2E7 },
     { 0x22C5, 0x22C5, 0x2E8 },
     { 0x22EF, 0x22EF, 0x2E9 },
-    { 0xFFFD, 0xFFFD, 0x2EA },
+    { 0xFB00, 0xFB06, 0x2EA },
+    { 0xFFFD, 0xFFFD, 0x2F1 },
 };
 
 static const EpdFontGroup bookerly_14_boldGroups[] = {
-    { 0, 4077, 7771, 100, 0 },
-    { 4077, 4072, 9535, 96, 100 },
-    { 8149, 5596, 14997, 128, 196 },
-    { 13745, 401, 478, 33, 324 },
-    { 14146, 10106, 25133, 220, 357 },
-    { 24252, 1337, 2520, 74, 577 },
-    { 25589, 536, 741, 18, 651 },
-    { 26125, 323, 493, 4, 669 },
-    { 26448, 594, 1051, 15, 673 },
-    { 27042, 2302, 5042, 58, 688 },
-    { 29344, 116, 189, 1, 746 },
+    { 0, 5543, 13461, 151, 5 },
+    { 5543, 3476, 6916, 66, 358 },
+    { 9019, 10049, 25047, 263, 0 },
+    { 19068, 11006, 23540, 274, 473 },
+};
+
+static const uint8_t bookerly_14_boldGlyphGroups[754] = {
+    2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0,
+    2, 2, 2, 2, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0,
+    0, 2, 2, 2, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0,
+    0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 3, 3, 3, 0, 0, 3, 3, 0, 0, 3,
+    3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+};
+
+static const uint8_t bookerly_14_boldKernLeftClasses[754] = {
+    0, 0, 0, 0, 0, 0, 0, 101, 0, 0, 0, 0, 101, 69, 0, 71,
+    0, 5, 23, 5, 27, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 130, 2, 117, 79, 14, 98, 62, 77, 57, 57, 40,
+    63, 37, 111, 17, 14, 64, 70, 29, 52, 10, 3, 8, 8, 82, 4, 99,
+    97, 54, 0, 0, 0, 0, 33, 15, 81, 75, 39, 25, 34, 26, 75, 112,
+    55, 72, 26, 26, 15, 15, 118, 24, 87, 88, 48, 9, 9, 116, 9, 126,
+    74, 0, 0, 0, 0, 114, 0, 0, 0, 0, 0, 0, 0, 0, 0, 80,
+    0, 23, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 60,
+    0, 0, 0, 45, 2, 2, 2, 2, 2, 2, 98, 79, 98, 98, 98, 98,
+    57, 57, 57, 57, 14, 17, 14, 14, 14, 14, 14, 0, 91, 3, 3, 3,
+    3, 4, 59, 95, 33, 33, 33, 33, 33, 33, 39, 81, 39, 39, 39, 39,
+    75, 75, 30, 30, 15, 26, 15, 15, 15, 15, 15, 0, 15, 48, 48, 48,
+    48, 9, 15, 9, 2, 33, 2, 33, 56, 85, 79, 81, 79, 81, 79, 81,
+    79, 81, 14, 31, 14, 128, 98, 39, 98, 39, 98, 39, 131, 110, 98, 39,
+    77, 34, 77, 34, 77, 34, 77, 34, 57, 26, 57, 26, 57, 30, 57, 30,
+    57, 30, 57, 108, 57, 75, 40, 112, 40, 122, 63, 55, 55, 37, 72, 37,
+    72, 0, 31, 0, 0, 37, 86, 17, 26, 17, 26, 17, 26, 26, 17, 26,
+    14, 15, 14, 15, 14, 15, 98, 39, 29, 24, 29, 24, 29, 24, 52, 87,
+    52, 87, 52, 87, 52, 87, 10, 88, 10, 135, 10, 88, 3, 48, 3, 48,
+    3, 48, 3, 48, 3, 48, 3, 107, 8, 9, 4, 9, 4, 99, 126, 99,
+    126, 99, 126, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 105, 105, 76, 0, 133, 92, 20, 20, 50, 16, 16,
+    58, 11, 20, 1, 20, 21, 109, 46, 13, 32, 105, 11, 46, 20, 20, 11,
+    20, 96, 20, 12, 20, 35, 113, 13, 1, 67, 51, 32, 20, 20, 32, 16,
+    20, 16, 12, 12, 20, 53, 7, 124, 44, 49, 61, 36, 84, 78, 78, 36,
+    78, 78, 78, 7, 78, 7, 115, 44, 18, 7, 94, 49, 78, 78, 49, 28,
+    78, 28, 7, 7, 78, 61, 61, 93, 44, 98, 125, 119, 103, 0, 28, 28,
+    73, 36, 78, 18, 78, 104, 106, 12, 7, 43, 89, 32, 49, 16, 28, 35,
+    7, 41, 100, 38, 44, 0, 0, 42, 83, 46, 84, 42, 83, 11, 36, 11,
+    36, 11, 36, 32, 49, 0, 0, 0, 0, 121, 120, 113, 115, 13, 44, 22,
+    18, 22, 18, 65, 90, 32, 49, 32, 49, 20, 78, 66, 73, 123, 61, 123,
+    61, 20, 11, 36, 132, 129, 32, 49, 50, 102, 32, 49, 20, 78, 32, 49,
+    127, 21, 53, 21, 53, 105, 61, 105, 61, 12, 7, 12, 7, 11, 36, 46,
+    84, 134, 78, 20, 78, 20, 78, 12, 7, 12, 7, 12, 7, 12, 7, 1,
+    18, 1, 18, 1, 18, 20, 78, 13, 44, 20, 78, 38, 44, 68, 90, 51,
+    94, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 23, 23, 0, 23, 23, 23, 0, 0, 6, 19, 47, 6, 6, 19, 5,
+    6, 0, 0, 0, 0, 0, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 80, 60, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 25, 75, 72, 75, 72, 88,
+    88, 0,
+};
+
+static const uint8_t bookerly_14_boldKernRightClasses[754] = {
+    0, 0, 0, 0, 0, 0, 0, 85, 0, 0, 0, 0, 85, 0, 68, 47,
+    0, 33, 11, 3, 36, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 102,
+    101, 0, 0, 0, 37, 0, 2, 44, 6, 44, 44, 44, 6, 44, 44, 66,
+    44, 44, 107, 44, 6, 44, 6, 44, 84, 30, 20, 25, 25, 95, 15, 116,
+    0, 26, 104, 0, 0, 0, 13, 87, 1, 1, 1, 82, 28, 17, 99, 92,
+    17, 17, 52, 52, 1, 103, 1, 52, 35, 46, 22, 12, 12, 70, 7, 64,
+    0, 0, 98, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 42,
+    0, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 72,
+    0, 0, 0, 109, 2, 2, 2, 2, 2, 2, 49, 6, 44, 44, 44, 44,
+    44, 44, 44, 44, 44, 44, 6, 6, 6, 6, 6, 0, 94, 20, 20, 20,
+    20, 15, 44, 86, 13, 13, 13, 69, 74, 13, 13, 1, 1, 1, 1, 76,
+    111, 99, 61, 27, 1, 52, 1, 1, 1, 1, 1, 0, 78, 22, 22, 22,
+    22, 7, 89, 7, 2, 77, 2, 73, 2, 13, 6, 1, 6, 1, 6, 1,
+    6, 1, 44, 1, 44, 1, 44, 1, 44, 1, 44, 1, 44, 1, 44, 1,
+    6, 28, 6, 62, 6, 28, 6, 28, 44, 17, 44, 83, 44, 27, 44, 27,
+    44, 27, 44, 99, 44, 99, 44, 99, 66, 59, 44, 17, 52, 44, 17, 44,
+    17, 44, 17, 44, 17, 44, 67, 44, 52, 44, 52, 44, 52, 52, 44, 52,
+    6, 1, 6, 1, 6, 1, 6, 1, 44, 52, 44, 52, 44, 106, 84, 35,
+    84, 75, 84, 35, 84, 71, 30, 46, 30, 46, 30, 46, 20, 22, 20, 22,
+    20, 22, 20, 22, 20, 22, 20, 22, 25, 12, 15, 7, 15, 116, 64, 116,
+    64, 116, 96, 86, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 48, 48, 14, 48, 19, 110, 48, 48, 91, 43, 48,
+    14, 48, 48, 32, 48, 24, 48, 48, 48, 60, 48, 41, 65, 48, 48, 48,
+    43, 105, 48, 19, 48, 48, 19, 14, 32, 58, 56, 48, 23, 48, 48, 14,
+    48, 48, 114, 48, 81, 34, 100, 8, 8, 53, 4, 45, 55, 8, 8, 8,
+    31, 8, 8, 4, 8, 88, 4, 9, 21, 4, 39, 8, 10, 8, 8, 9,
+    8, 8, 97, 8, 51, 4, 4, 63, 8, 4, 90, 112, 79, 93, 31, 8,
+    63, 8, 8, 29, 8, 14, 9, 19, 4, 57, 21, 48, 8, 117, 115, 48,
+    88, 48, 8, 48, 8, 48, 8, 41, 45, 65, 55, 48, 8, 48, 8, 0,
+    0, 14, 9, 48, 8, 48, 8, 48, 8, 19, 4, 19, 4, 14, 9, 40,
+    21, 40, 21, 56, 39, 0, 9, 23, 10, 23, 10, 48, 63, 38, 18, 38,
+    18, 48, 41, 45, 48, 8, 43, 31, 48, 8, 48, 8, 23, 10, 0, 8,
+    63, 24, 34, 24, 34, 50, 34, 48, 4, 108, 80, 0, 80, 41, 45, 65,
+    55, 0, 113, 48, 8, 48, 8, 19, 4, 19, 4, 19, 4, 0, 55, 32,
+    29, 32, 54, 32, 29, 0, 10, 48, 8, 48, 8, 48, 8, 56, 39, 56,
+    39, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 11, 11, 0, 11, 11, 11, 0, 0, 5, 16, 3, 5, 5, 16, 3,
+    5, 0, 0, 0, 0, 0, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 42, 72, 0, 0, 0, 0, 0,
+    37, 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 82, 82, 82, 82, 82, 82,
+    35, 0,
+};
+
+static const int8_t bookerly_14_boldKernMatrix[16048] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -4, -3, 0, 0, 0, -2, -1, -1, -1, 0, 0, 0, 0, 1, 0, -3, -2, 0, -1, 0, 0, -5, 0, 0, 0, 0, -1, 0, -3, 1, -4, -3, 0, -3, 0, -1, -2, 1, -1, -2, -3, 0, -2, 0, 0, 0, 0, -5, -4, 0, -4, -1, -3, 0, 0, -2, 0, -3, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 2, -2, -2, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, -1, 1, 0, 0,
+    0, 0, 1, 0, 0, -3, 0, -2, 0, 0, 0, -1, -2, 0, 0, -3, -2, 0, 0, 0, -2, 0, -1, 0, 0, -3, -3, 0, 0, 0, -3, 0, 0, 0, 0, 0, 1, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, -3, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, 0, 0, 0, 0, -1, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, -1, 0, -1, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, -3, -3, 0, 0, -2, -1, 0, 0, 0, -1, -1, -2, 0, 1, 1, 1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 2, -3, 0, 0, 0, 0, -3, 0, -2, -3, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 1, 0, -3, 0, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, 2, -3, 0, -1, 0, 0, 1, 0, -2, -1, -2, -1, -1, -1, -2, -2, -1, -2, 0, 0, 0, 0, 1, -1, 0, 0, 1, 0, 1, 0, 0, 0, 0, -2, 0, -1, 0, 1, 0, 0, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, -2, -1, -3, 0, -1, -2, 0, -3, 0, -2, -3, -1, 0, -1, -1, -1, -2, -1, -3, 1, -4, 0, 0, 0, -2, -2, 0, -1, 0, 0, 0, 0, 0, -2, 1, -3, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -4, -1, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -2, -2, -1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 1, 0, 0, 0, 1, 0, 0, -2, 1, 0, 1, -1, 1, 1, -1, 1, -2, 0, -1, 0, 0, 0, 1, 1, 0, 0, -2, 0, 0, 0, 0, 0, -4, -4, -1, 0, -1, 1, 0, 0, 1, 0, 1, -2, 1, -1, 1, 0, 0, 0, 1, 0, 0, 1, -1, 0, 0, 0, -1, -1, 0, -1, 1, 0, -1, 0, 1, 0, 0, 0, 1, 0, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, -2, 0, 0, -1, 0, -1, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, -4, -4, 0, 0, -1, -1, 0, 0, 0, -1, -1, -2, 0, 1, 1, 1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 2, -2, 0, 0, 0, 0, -4, 0, -2, -4, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 1, 0, -4, 0, 0, -1, 0, 0, 0, 0, 0, 0, 2, 0, 2, -2, 0, -1, 0, 0, 1, 0, -2, -1, -2, -1, -2, -1, -2, -2, -1, -2, 0, 0, 0, -1, 1, -1, 0, 0, 1, 0, 1, 0, 0, 0, 0, -1, 0, -1, 0, 1, 0, 0, -1, -1, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, -3, 0, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -3, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, -4, -3, 0, 1, -1, 0, 0, 0, 0, -1, 0, -2, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -2, 0, 0, 0, 0, -3, 0, -2, -4, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -2, 0, -1, 0, 0, 0, 0, -2, 0, -2, -1, -2, -2, -2, -2, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, -1, 0, 0, 0, -2, -2, -1, 0, 0, -1, 0, 0, 0, -3, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, -2, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, -1, -1, -1, 0, 0, -1, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, -2, -1, 0, -1, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -3, -2, 1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 1, 0, -3, -1, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, -2, 0, -3, -2, 0, -4, 0, -1, 0, 0, -1, -1, -2, 0, 0, 0, 0, 0, 0, -3, -2, 0, -3, 0, -1, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, -1, 0, 0, 0, -1, -1, 1, 0, 0, -2, 0, -1, 0, 0, 0, 0, -1, 0, -3, 0, 0, -2, 0, 0, -1, 0, 0, -2, 0, 1, 0, 0, 0, -1, -1, -3, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, -1, -1, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 2, -1, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, -1, 0, 0, 0, 0, 1, 0, -1, 0, -1, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -3, -1, 1, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -3, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, -2, -4, -2, -2, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 1, -1, -1, 0, 0, 0, 0, -4, 1, 0, 1, -2, 0, 0, -2, 0, -2, -1, -2, 0, 0, 0, 0, 1, -1, 0, -2, 0, 0, 0, 0, 0, -5, -5, -2, 0, -2, 0, 0, 0, 1, 0, 1, -2, 1, -2, 1, -1, 0, 0, 1, 0, -1, 0, -2, 0, -1, -1, -2, -2, -1, -2, 1, 0, -1, 0, 1, -1, 0, 0, 1, 0, 1, -2, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -3, 0, 0, 0, -1, -2, -1, 0, 0, -3, 0, -2, 0, -1, 0, 0, -1, 0, -4, 1, 0, -3, 0, 0, -1, 0, 1, -1, 0, 0, 0, 1, -2, -3, 1, -3, 0, -1, 0, 0, 0, 0, -3, 0, 0, 1, 0, 0, 0, -1, 0, 0, -3, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -3, -2, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 1, 0, -2, -1, 0, -1, 0, 0, -2, 0, 0, 0, 0, -1, 0, -2, 1, -3, -2, 0, -3, 0, -1, -1, 1, -1, -1, -2, 0, -2, 0, 1, 0, 0, -3, -3, 0, -2, -1, -1, 0, 1, -1, 0, -2, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 2, -1, -2, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, -1, 1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, -2, 0, 1, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -2, 0, -1, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 4, -1, 0, 0, 0, 0, -1, 0, 0, -1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 3, 0, 0, 0, 0, 0, 0, 3, 1, 0, 1, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 3, 0, 3, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 3, 1, 0, 0, 0, 0, 2, 0, 1, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -3, -3, 0, -3, 0, -1, -1, -1, -1, 0, 0, -1, -3, 0, 0, 0, 0, -1, -1, 0, -1, -1, 0, -3, 0, 0, 1, -3, -1, 0, -2, 0, 0, -3, -3, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, -4, -4, -3, -1, -3, -1, -1, 0, 0, -1, 0, -1, 1, -3, 0, -1, 0, 0, 0, 0, -3, -1, -3, 0, -3, -3, -3, -3, -3, -3, 1, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, -3, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -2, 0, 0, 0, 0, -4, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, -2, -1, -1, 0, 0, 0, -1, -1, 0, 0, -2, -1, 0, 0, 0, -1, 0, -1, 0, 0, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 2, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 2, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 3, 3, 0, 1, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 3, 0, 0, 0, 3, 0, 3, 0, 0, 1, 0, 0, 0, 1, 0, 2, 1, 0, 0, 0, 0, 2, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -3, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, -3, 0, 0, 0, 0, 1, 0, -1, 0, -3, 0, 0, -3, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 2, 0, 0, -4, -1, 0, -2, 1, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 1, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, -2, -1, 0, 0, 0, -1, 0, 0, 0, 0, -2, -3, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, -1, 0, -2, -1, 0, -2, 0, -1, 0, 0, 0, 0, -2, 0, 0, 0, 1, 0, 0, -3, -2, 0, -2, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, -2, 1, 0, 0, -2, -1, -2, 0, 0, 0, 0, 0, 0, 0, -3, -1, 0, -1, 0, 0, -3, 0, 0, 0, 0, -1, 0, -2, 0, -1, -2, 0, -2, 0, -3, -1, 0, -1, 0, -2, 0, -1, 0, 1, 0, 0, -3, -3, 0, -3, -1, -2, 0, 0, -1, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, -1, 0, 0, 0, -2, -2, 0, 0, 0, -1, 0, 0, 0, -3, -1, 0, 1, 0, -1, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, -2, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -3, -2, 1, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 1, 0, -3, -1, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, -2, 1, -3, -2, 0, 0, 0, -1, -1, 1, -1, -1, -2, 0, -1, 0, 0, 0, 0, -5, -3, 0, -2, 0, -2, 0, 0, -1, 0, -3, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, -1, -1, -2, 0, -1, 0, -1, -1, -1, -1, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, -1, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, -1, -1, 0, 1, -1, 0, -1, -1, -1, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, 0, 0, -1, -1, 0, -1, -1, 1, 1, 1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, -2, -1, -1, 0, -1, -2, 0, -3, 0, -2, -3, -1, 0, -1, -1, -1, -1, -1, -3, 1, -4, 0, 0, 0, -1, -2, 0, -1, 0, 0, 0, 0, 0, -2, 1, -3, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -4, -1, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, -1, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, -1, 0, 0, 0, 0, 0, 0, -2, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, -2, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 1, -1, 0, 1, 0, -2, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, -3, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, -1, 0, -1, -1, 0, -1, -1, 0, -1, 0, -2, -2, 0, 0, 0, -1, -1, -1, -1, -3, 0, -3, 0, 0, 1, -1, -2, 0, -1, 0, 0, 0, 0, 0, -2, 0, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -3, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, -3, 0, -2, 0, 0, 0, -1, -2, 0, 0, -3, -2, 0, 0, 0, -2, 0, -1, 0, 0, -3, -3, 0, 0, 0, -3, 0, 0, 0, 0, 0, 1, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, -3, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -2, 0, 0, 0, -2, 0, -1, 0, -1, -1, 0, -2, 0, -4, 0, 0, -4, 0, 0, -2, 0, 0, -2, 0, 0, 0, 0, 0, -2, 0, -3, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, -2, 0, 0, -3, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, 0, 0, -1, 0, 0, 0, 0, -2, -2, 0, -1, 0, -1, 0, 0, -2, 0, 0, -3, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -1, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -3, -2, 0, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, 0, 0, 0, 0, -2, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, -1, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 1, 0, 0, 0, -1, -2, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -3, -3, 0, 1, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, -1, 0, 0, 0, 0, -3, 0, -1, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, -1, 0, 0, 0, 0, 0, 0, -2, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, -2, 1, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 1, 1, 0, 1, 1, 0, 1, 0, -2, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, 0, 0, -3, 0, 0, 0, -1, -1, 0, -2, 0, -4, 0, 0, -4, 0, 0, -2, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -3, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, -2, 0, 0, 0, -1, -2, 0, -1, 0, 0, 0, 0, -1, 0, -2, -1, 0, -1, 0, 0, -2, -1, 0, 0, -3, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, -2, -2, -1, 0, 0, 0, 0, 0, 0, -3, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, -1, 0, 0, 0, -2, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, -1, 0, 1, 0, -2, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, -1, 0, -1, 1, 0, 0, 0, 0, 1, -1, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 2, 0, 0, -1, 0, 0, 0, -1, -1, 0, -1, -1, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 3, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 3, 0, 0, -1, 0, 0, 2, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -2, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -2, 0, 0, 0, 0, 0, -4, -4, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, -3, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 2, 0, 1, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, -2, 0, 0, -3, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, -3, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t bookerly_14_boldGlyphLookup[368] = {
+    0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0001, 0x0002, 0xFFFF, 0xFFFF, 0xFFFF, 0x0003, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0004, 0xFFFF, 0xFFFF,
+    0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, 0x0010, 0x0011, 0x0012, 0x0013, 0x0014,
+    0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, 0x0020, 0x0021, 0x0022, 0x0023, 0x0024,
+    0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, 0x0030, 0x0031, 0x0032, 0x0033, 0x0034,
+    0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, 0x0040, 0x0041, 0x0042, 0x0043, 0x0044,
+    0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051, 0x0052, 0x0053, 0x0054,
+    0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, 0x0060, 0x0061, 0x0062, 0x0063, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x0072, 0x0073,
+    0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, 0x0080, 0x0081, 0x0082, 0x0083,
+    0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F, 0x0090, 0x0091, 0x0092, 0x0093,
+    0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F, 0x00A0, 0x00A1, 0x00A2, 0x00A3,
+    0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF, 0x00B0, 0x00B1, 0x00B2, 0x00B3,
+    0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF, 0x00C0, 0x00C1, 0x00C2, 0x00C3,
+    0x0241, 0x0242, 0x0243, 0x0244, 0x0245, 0x0246, 0x0247, 0x0248, 0x0249, 0x024A, 0x024B, 0x024C, 0x024D, 0x024E, 0x024F, 0x0250,
+    0x0251, 0x0252, 0x0253, 0x0254, 0x0255, 0x0256, 0x0257, 0x0258, 0x0259, 0x025A, 0x025B, 0x025C, 0x025D, 0x025E, 0x025F, 0x0260,
+    0x0261, 0x0262, 0x0263, 0x0264, 0x0265, 0x0266, 0x0267, 0x0268, 0x0269, 0x026A, 0x026B, 0x026C, 0x026D, 0x026E, 0x026F, 0x0270,
+    0x0271, 0xFFFF, 0x0272, 0x0273, 0x0274, 0x0275, 0x0276, 0x0277, 0x0278, 0x0279, 0x027A, 0x027B, 0x027C, 0xFFFF, 0x027D, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x027E, 0x027F, 0xFFFF, 0xFFFF, 0x0280, 0x0281, 0x0282, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x0283, 0xFFFF, 0xFFFF, 0xFFFF, 0x0284, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0285,
+    0x0286, 0x0287, 0x0288, 0x0289, 0x028A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
 };
 
 static const EpdFontData bookerly_14_bold = {
     bookerly_14_boldBitmaps,
     bookerly_14_boldGlyphs,
     bookerly_14_boldIntervals,
-    64,
+    65,
     38,
     31,
     -8,
     true,
     bookerly_14_boldGroups,
-    11,
+    4,
+    bookerly_14_boldKernLeftClasses,
+    bookerly_14_boldKernRightClasses,
+    bookerly_14_boldKernMatrix,
+    118,
+    nullptr,
+    0,
+    0,
+    bookerly_14_boldGlyphLookup,
+    bookerly_14_boldGlyphGroups,
+    false,
+    nullptr,
 };
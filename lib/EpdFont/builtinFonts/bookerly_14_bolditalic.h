@@ -3,1973 +3,2000 @@
  * name: bookerly_14_bolditalic
  * size: 14
  * mode: 2-bit  compressed: true
- * Command used: fontconvert.py bookerly_14_bolditalic 14 ../builtinFonts/source/Bookerly/Bookerly-BoldItalic.ttf --2bit --compress
+ * Command used: fontconvert.py bookerly_14_bolditalic 14 ../builtinFonts/source/Bookerly/Bookerly-BoldItalic.ttf --2bit --compress --frequency-corpus ../../../test/hyphenation_eval/resources/english_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/french_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/german_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/italian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/russian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/spanish_hyphenation_tests.txt
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t bookerly_14_bolditalicBitmaps[31369] = {
-    0x9D, 0x59, 0x3D, 0xAC, 0xDE, 0xE6, 0x75, 0x3E, 0x24, 0x7D, 0xC5, 0x00, 0x2C, 0x40, 0x0D, 0x96,
-    0xD1, 0x24, 0x03, 0x3B, 0xB4, 0x40, 0xD1, 0xA2, 0xE6, 0x1A, 0x14, 0x89, 0x5E, 0xAA, 0x1A, 0x34,
-    0x78, 0xF0, 0x1D, 0xAC, 0x14, 0x48, 0xD0, 0xA6, 0x43, 0xA7, 0xA0, 0xC0, 0x5D, 0x3A, 0x64, 0xD1,
-    0x25, 0x6B, 0x01, 0xF5, 0xE0, 0x41, 0x77, 0xC8, 0x94, 0x2C, 0x19, 0x0C, 0xD4, 0xBA, 0x06, 0x7A,
-    0x33, 0x64, 0xC8, 0x50, 0x5D, 0x52, 0xD2, 0xA0, 0x21, 0x83, 0x59, 0xB9, 0xAE, 0x06, 0x0F, 0xA2,
-    0x63, 0x17, 0x2E, 0xEC, 0xE1, 0xB2, 0x36, 0x0D, 0x51, 0xD2, 0x4B, 0x9E, 0x3E, 0xCF, 0x79, 0xBF,
-    0x4F, 0xF7, 0x4A, 0x5E, 0x8A, 0x5E, 0x89, 0xDF, 0x0F, 0x7F, 0xDE, 0xF7, 0xFC, 0x3E, 0xE7, 0x39,
-    0xE7, 0x93, 0xEF, 0x54, 0x65, 0x9F, 0x8F, 0xD9, 0x9C, 0x2C, 0xA2, 0xE2, 0x9A, 0xA2, 0x4F, 0xC7,
-    0xD8, 0xCB, 0xB1, 0xB8, 0x2A, 0xEF, 0x92, 0x51, 0x66, 0xF9, 0x81, 0xBC, 0x24, 0x22, 0xD1, 0x14,
-    0xA9, 0xB4, 0x4D, 0xD1, 0x45, 0x95, 0xC4, 0xFD, 0x6F, 0xDD, 0xEB, 0xF7, 0x7D, 0x9D, 0x7D, 0xE9,
-    0xDD, 0xDB, 0xC3, 0xE2, 0x2E, 0x8F, 0x3E, 0xBF, 0x3E, 0x5E, 0xCB, 0x9B, 0xEA, 0xBC, 0xC8, 0xCE,
-    0xEE, 0x05, 0x91, 0x25, 0x1D, 0x24, 0xEF, 0x6E, 0x49, 0xE4, 0xF3, 0x4E, 0xCA, 0xC6, 0x8B, 0xE2,
-    0x2F, 0xC7, 0x31, 0xFC, 0xF8, 0xEB, 0xFA, 0x0D, 0x39, 0xC6, 0xC2, 0x59, 0xBF, 0x2F, 0xE2, 0xB3,
-    0x3E, 0x3E, 0xFA, 0x7C, 0x7D, 0xA7, 0xC5, 0xA5, 0x0C, 0xC7, 0x98, 0x8C, 0x65, 0x25, 0x2E, 0x99,
-    0x24, 0x1D, 0x9C, 0xC8, 0xAD, 0x74, 0x94, 0x33, 0x7F, 0x69, 0x27, 0x92, 0x35, 0x22, 0x79, 0x25,
-    0x52, 0xE0, 0xA3, 0x0E, 0xE2, 0xD4, 0xCB, 0x7A, 0x71, 0x89, 0xE7, 0xEF, 0x1F, 0x27, 0xD3, 0xCF,
-    0x7E, 0x90, 0xF8, 0xDF, 0x7C, 0x2F, 0xD6, 0x51, 0x22, 0x1C, 0xD2, 0x7A, 0x91, 0x52, 0x2B, 0x49,
-    0xB5, 0xC3, 0x31, 0xFE, 0x45, 0x76, 0x63, 0x3C, 0xCE, 0xB3, 0x51, 0x71, 0xB4, 0x7F, 0x5B, 0xF4,
-    0x6E, 0x6D, 0xBB, 0x42, 0x57, 0x89, 0xF5, 0x53, 0x91, 0x9F, 0x61, 0xF9, 0x09, 0x07, 0x1E, 0x8B,
-    0x70, 0xC4, 0x03, 0xDE, 0xAB, 0xB3, 0x7B, 0xCB, 0xF7, 0x44, 0xEA, 0x41, 0x20, 0x50, 0xA9, 0x8D,
-    0x2C, 0x92, 0x7D, 0xED, 0x61, 0x2D, 0xE8, 0xD7, 0x67, 0x23, 0x3E, 0x2C, 0xE2, 0x25, 0x19, 0xF3,
-    0xDE, 0x55, 0x52, 0x43, 0x2B, 0xDE, 0x58, 0x74, 0xD8, 0xBF, 0x4E, 0x26, 0x27, 0x37, 0xD3, 0xA9,
-    0xCD, 0xFA, 0xD6, 0x3B, 0xBD, 0x3D, 0xBB, 0x93, 0xA1, 0x1D, 0x1C, 0x24, 0x80, 0x1A, 0x9D, 0xC7,
-    0x72, 0xF1, 0x54, 0x76, 0xB5, 0xC8, 0x7E, 0x32, 0x63, 0xA1, 0xBC, 0x73, 0xD5, 0x2A, 0xC9, 0x94,
-    0x4C, 0xB0, 0x1B, 0x7C, 0x70, 0x7D, 0x96, 0xA2, 0x8B, 0x57, 0xC5, 0x29, 0xC9, 0xB1, 0xEF, 0x45,
-    0x91, 0xEF, 0x40, 0xAC, 0xE6, 0xAC, 0x60, 0x85, 0xE7, 0xAB, 0x2A, 0x5E, 0x92, 0xA5, 0xC6, 0xD5,
-    0x8C, 0x36, 0x14, 0xC8, 0xC2, 0x8B, 0xDD, 0x3E, 0x5F, 0xEF, 0x78, 0xF9, 0x03, 0x29, 0x1E, 0x0E,
-    0x72, 0x4B, 0x8A, 0x55, 0xF6, 0xBC, 0xD4, 0x63, 0xA6, 0x53, 0xAC, 0x83, 0x5B, 0x25, 0x7B, 0x3A,
-    0x5E, 0xF4, 0x52, 0xDE, 0x9D, 0xA1, 0x82, 0x7B, 0xD3, 0xC7, 0x93, 0xD4, 0x95, 0xC2, 0x41, 0xAD,
-    0xB4, 0xEF, 0xF7, 0xF8, 0xEC, 0x60, 0xBE, 0xBA, 0xCB, 0xB1, 0xBE, 0x7B, 0xBC, 0x07, 0x19, 0xE8,
-    0xC6, 0xB5, 0x8A, 0x75, 0x29, 0x74, 0x92, 0x1D, 0xA1, 0xB9, 0xF1, 0xB7, 0x53, 0xC5, 0xFD, 0x52,
-    0xDE, 0xF1, 0xEE, 0xFA, 0xE4, 0x92, 0xE1, 0x5A, 0xF4, 0xCC, 0x63, 0xD4, 0xEA, 0xCC, 0x7F, 0x7C,
-    0x4D, 0x27, 0x49, 0xBC, 0x44, 0x0B, 0x3C, 0x84, 0x35, 0x1B, 0xC8, 0xC8, 0xB3, 0x08, 0x3A, 0x59,
-    0xED, 0x7B, 0x3E, 0xF0, 0x3A, 0x2F, 0x16, 0xBD, 0x24, 0x33, 0x74, 0x0B, 0x9F, 0xBC, 0x5D, 0x4D,
-    0x71, 0xE2, 0x1A, 0xF6, 0xDB, 0x68, 0xFF, 0x6B, 0xEA, 0x68, 0xB7, 0xF0, 0x42, 0xD9, 0xD9, 0x22,
-    0x58, 0x0E, 0x82, 0xDB, 0xB3, 0xAE, 0xB3, 0x95, 0xCB, 0xE7, 0xDE, 0xB0, 0x0C, 0x0C, 0xCA, 0x1D,
-    0xB0, 0x57, 0x14, 0x4E, 0xE0, 0x19, 0x8A, 0xC4, 0xFD, 0x47, 0x93, 0x8F, 0xC2, 0x54, 0x12, 0x05,
-    0x5B, 0x9F, 0xBF, 0x15, 0xFD, 0x7E, 0xCA, 0x3F, 0x6A, 0xCA, 0xE5, 0x9D, 0x54, 0x3F, 0x6E, 0x4F,
-    0x6E, 0x9C, 0x54, 0xAF, 0x96, 0x72, 0xFE, 0xDF, 0xB6, 0x51, 0x12, 0x73, 0xF3, 0xE6, 0xCC, 0x5B,
-    0xAD, 0xFA, 0x40, 0x75, 0xF9, 0xB3, 0xF6, 0xF3, 0xE6, 0xF9, 0x6B, 0xD1, 0x3B, 0xBC, 0xBF, 0x6C,
-    0x8A, 0x11, 0x9B, 0x20, 0xE3, 0x2A, 0xD7, 0x95, 0x9D, 0xEB, 0xCE, 0x71, 0x9D, 0x4C, 0xBD, 0xEA,
-    0xFB, 0x6A, 0x0E, 0x8D, 0xBC, 0xBB, 0xE7, 0xEB, 0x4B, 0x3C, 0x0D, 0x99, 0x4C, 0xC9, 0xBC, 0x0F,
-    0xAA, 0xC1, 0x80, 0xA6, 0x1B, 0x25, 0x47, 0x28, 0x9A, 0x22, 0xD4, 0xF7, 0xFF, 0x76, 0xA3, 0x3B,
-    0x73, 0xE3, 0x99, 0x18, 0xCF, 0x2C, 0x53, 0x10, 0x69, 0xAA, 0xB3, 0xE8, 0xBF, 0x6B, 0x57, 0x0E,
-    0xC9, 0x92, 0x22, 0x24, 0x06, 0xAD, 0x92, 0xB5, 0x40, 0x90, 0xDF, 0x47, 0x64, 0x2E, 0xAE, 0x17,
-    0xF7, 0x01, 0x62, 0xDD, 0xD7, 0x88, 0x8A, 0x7B, 0x5E, 0xF2, 0xA9, 0xED, 0x44, 0x79, 0x5F, 0x5F,
-    0x77, 0x99, 0x4F, 0x34, 0x56, 0x64, 0x08, 0x42, 0x06, 0xB9, 0x8E, 0xD8, 0x60, 0x4E, 0x6D, 0xF7,
-    0x28, 0x11, 0x34, 0x63, 0xAE, 0x73, 0xA2, 0x0B, 0x12, 0xB4, 0x12, 0x3C, 0x58, 0x22, 0x26, 0x66,
-    0xAC, 0x8A, 0xEF, 0xC2, 0xEF, 0xCE, 0xBE, 0xA7, 0x67, 0xBF, 0xEF, 0xAD, 0x97, 0x54, 0x27, 0x0D,
-    0x46, 0xA1, 0x0A, 0x33, 0x96, 0xD5, 0x1E, 0x87, 0x8F, 0xF5, 0x92, 0x36, 0x30, 0x21, 0xA0, 0x22,
-    0x9F, 0xA3, 0x0A, 0xCB, 0xE0, 0x12, 0x8F, 0x6A, 0x73, 0x34, 0x9B, 0x03, 0xA1, 0x80, 0xF3, 0x09,
-    0x3C, 0x8A, 0xA5, 0x25, 0x5B, 0xAE, 0x5E, 0x25, 0xD8, 0xDC, 0x25, 0x1E, 0xD5, 0x94, 0xF3, 0xEC,
-    0xCA, 0x1D, 0x57, 0x8E, 0xB0, 0x32, 0x12, 0xD9, 0x75, 0x39, 0xA3, 0x41, 0xB2, 0x39, 0x1C, 0x25,
-    0xEF, 0xF0, 0x4C, 0xB6, 0x4E, 0x5E, 0x3D, 0xC2, 0x07, 0x8A, 0xC9, 0x10, 0xA3, 0x22, 0x52, 0x32,
-    0xA4, 0xE6, 0x73, 0x47, 0x3A, 0x63, 0x89, 0x09, 0xD0, 0x74, 0x70, 0xAA, 0xBB, 0x04, 0x7B, 0xC3,
-    0x8C, 0x52, 0x60, 0xA1, 0x02, 0x62, 0x14, 0x0C, 0x6B, 0x2C, 0x54, 0x7C, 0x34, 0x4A, 0xF1, 0x01,
-    0x12, 0xBD, 0x5F, 0x70, 0xD4, 0x38, 0xCA, 0xAE, 0xE8, 0xF3, 0xA1, 0x80, 0x78, 0x27, 0x38, 0x9E,
-    0xE0, 0x58, 0x2E, 0x5C, 0xAD, 0x3F, 0xB4, 0x68, 0x35, 0x9F, 0x32, 0x86, 0x19, 0xF2, 0xB4, 0x34,
-    0xF3, 0xB1, 0x83, 0xE3, 0xC6, 0x78, 0xB9, 0xBA, 0x6B, 0x27, 0xCD, 0xB9, 0xB8, 0x2B, 0x87, 0x66,
-    0xF0, 0x66, 0x25, 0xAF, 0x30, 0x45, 0xB3, 0x95, 0xCF, 0xE0, 0x52, 0x39, 0x04, 0x65, 0x68, 0x8A,
-    0xD4, 0x64, 0x80, 0xA8, 0x5C, 0x66, 0x03, 0x85, 0x67, 0xFF, 0xF6, 0xB0, 0x4C, 0x0D, 0x19, 0xA9,
-    0x4B, 0xB1, 0x56, 0x08, 0x12, 0xEA, 0xDC, 0x18, 0x14, 0x4A, 0xBE, 0xBE, 0x8B, 0x2F, 0x88, 0x16,
-    0x3C, 0x3E, 0xA4, 0x4B, 0xCA, 0xFA, 0x90, 0x4F, 0xD9, 0x24, 0x5A, 0x69, 0x95, 0x4F, 0x39, 0x3E,
-    0xB0, 0x62, 0x8C, 0xE9, 0x02, 0xCF, 0xE0, 0x9E, 0xE6, 0xF9, 0x98, 0x80, 0xDC, 0x33, 0xE4, 0x5F,
-    0x71, 0x65, 0x71, 0x87, 0x47, 0x1E, 0x9A, 0x8F, 0xB7, 0x80, 0x34, 0xDF, 0xA7, 0x12, 0xF4, 0x65,
-    0x3E, 0x07, 0xBB, 0xD6, 0xCC, 0xEF, 0xE0, 0xC2, 0xCC, 0x9F, 0x9E, 0x46, 0x24, 0xDA, 0xA5, 0x96,
-    0xE2, 0xC8, 0x29, 0x22, 0xE0, 0xCC, 0x64, 0x8E, 0x4C, 0xF4, 0x68, 0x8E, 0x57, 0xAC, 0x06, 0x05,
-    0x3B, 0xD7, 0xE4, 0x23, 0xCA, 0x1C, 0x30, 0xEF, 0x75, 0xBA, 0x06, 0x10, 0x04, 0xA3, 0xA4, 0xD0,
-    0x39, 0x5B, 0xB4, 0xCF, 0xE7, 0xCC, 0x03, 0x3E, 0xF4, 0x32, 0x70, 0xB0, 0x57, 0xC9, 0x26, 0x37,
-    0x64, 0x3E, 0xD3, 0x23, 0xD6, 0x2D, 0x8F, 0xBB, 0xA6, 0xB3, 0xAB, 0x33, 0x51, 0x10, 0x3E, 0xDC,
-    0xC2, 0xA2, 0xBE, 0xCF, 0xC2, 0x2E, 0x05, 0xD6, 0xB7, 0xCD, 0xF0, 0x61, 0x02, 0x7A, 0x68, 0xE7,
-    0xFA, 0x94, 0xF7, 0x94, 0x54, 0xBD, 0xA4, 0x0F, 0x68, 0x72, 0x33, 0x5F, 0x0B, 0xF3, 0xD5, 0xB3,
-    0x44, 0xED, 0x02, 0x39, 0xE0, 0x98, 0x92, 0xCE, 0x39, 0x1F, 0xD6, 0xBF, 0x15, 0xAF, 0xC9, 0x0A,
-    0x6C, 0xD8, 0x7D, 0x0E, 0xE4, 0x01, 0x11, 0x75, 0x57, 0x57, 0x2F, 0x07, 0x11, 0x7A, 0x68, 0x8D,
-    0x70, 0x46, 0x8E, 0xEF, 0xC8, 0x37, 0xFE, 0x8E, 0x05, 0xE9, 0x08, 0x59, 0x10, 0x97, 0x0B, 0xDF,
-    0x5B, 0xBE, 0x7C, 0x7B, 0x7B, 0xF5, 0xB7, 0x96, 0x58, 0x30, 0x51, 0xFB, 0x29, 0xC5, 0x60, 0x4D,
-    0xC3, 0xE6, 0xC5, 0xD9, 0x03, 0x46, 0x2E, 0x20, 0xE4, 0x1F, 0x6D, 0x30, 0x0C, 0x6F, 0x7D, 0x78,
-    0x36, 0x3E, 0x3C, 0x7C, 0x77, 0x73, 0xF2, 0xC2, 0xD5, 0xAB, 0x8C, 0xED, 0x08, 0x8A, 0x38, 0x3A,
-    0x75, 0x7B, 0xF4, 0x38, 0x3A, 0xBA, 0x0F, 0x99, 0x77, 0x4E, 0x9B, 0x54, 0x9B, 0x84, 0xDA, 0x37,
-    0xDB, 0xA2, 0xD5, 0xF6, 0xA5, 0x5E, 0x56, 0xEF, 0xDA, 0xFB, 0xD5, 0x42, 0x9C, 0xF2, 0x24, 0x1A,
-    0x3D, 0xD0, 0x18, 0x21, 0x22, 0xE9, 0xD7, 0x52, 0x4F, 0xD0, 0x6B, 0x27, 0xC0, 0x05, 0x5C, 0xD2,
-    0x36, 0xD0, 0xF1, 0xE5, 0x33, 0xCA, 0x9D, 0x43, 0xED, 0xA1, 0x11, 0x4D, 0xA6, 0x1A, 0x09, 0x32,
-    0x20, 0xB2, 0x51, 0x74, 0x7B, 0x8B, 0x03, 0xD7, 0x65, 0x93, 0x41, 0x5C, 0x5D, 0x15, 0xFF, 0xDC,
-    0xAC, 0x09, 0xB0, 0x46, 0xE3, 0x19, 0xF8, 0x7A, 0x32, 0xA7, 0xC3, 0x12, 0x83, 0x8D, 0x94, 0x6F,
-    0x8D, 0x28, 0xB2, 0x72, 0x5C, 0x36, 0xAD, 0xCC, 0xC9, 0xB4, 0x24, 0x53, 0xD6, 0xE7, 0x77, 0xC3,
-    0x39, 0xBC, 0xC4, 0x28, 0xC9, 0x4E, 0x96, 0x72, 0xAC, 0x2B, 0x60, 0xD9, 0xA3, 0x13, 0xDC, 0x92,
-    0x69, 0x81, 0x70, 0x1E, 0xB2, 0xA1, 0xEC, 0xAD, 0xBE, 0x10, 0x6B, 0x83, 0x2E, 0xF4, 0x24, 0x72,
-    0x5C, 0xFF, 0x6B, 0x87, 0x7B, 0x6B, 0xC0, 0xA8, 0x9A, 0x19, 0x87, 0x78, 0xB9, 0xB9, 0x49, 0x7D,
-    0x03, 0x76, 0xCB, 0x4B, 0x8B, 0x5E, 0xDC, 0x40, 0x09, 0x13, 0x33, 0x69, 0xC9, 0xE7, 0xC4, 0xF3,
-    0x62, 0xF6, 0x89, 0x3D, 0x4C, 0xD4, 0x4E, 0x26, 0xEC, 0x04, 0x8F, 0x73, 0x17, 0x92, 0x32, 0x70,
-    0x8D, 0xBF, 0x66, 0x8D, 0x42, 0x8E, 0x33, 0x9F, 0xF1, 0x64, 0xF1, 0xE1, 0x55, 0x3C, 0xC9, 0x7C,
-    0xB5, 0x7A, 0xEA, 0x99, 0x07, 0xE5, 0xE3, 0x42, 0xFB, 0x4C, 0x97, 0x56, 0x51, 0xB1, 0xB1, 0xCA,
-    0x8F, 0x50, 0x67, 0x5A, 0xC4, 0x16, 0xCB, 0xB5, 0xFC, 0xA5, 0xBE, 0x06, 0xF0, 0xF6, 0xB8, 0xD3,
-    0xA2, 0xB4, 0x6E, 0x5C, 0x13, 0x2F, 0x28, 0x77, 0xC8, 0x52, 0xC4, 0xC9, 0x13, 0x0D, 0x79, 0x9C,
-    0x59, 0x32, 0xF7, 0x8E, 0x89, 0xEB, 0x06, 0x84, 0x20, 0xB3, 0x17, 0xB1, 0x8D, 0xB4, 0x1E, 0xE1,
-    0x51, 0x7C, 0x7B, 0x72, 0xE4, 0x11, 0xD2, 0xDA, 0xB8, 0x53, 0xD4, 0x94, 0x73, 0x37, 0xC5, 0x10,
-    0x19, 0xBB, 0x69, 0x93, 0xE9, 0x21, 0x22, 0x7F, 0x88, 0x27, 0xE8, 0x0A, 0x73, 0xF6, 0x72, 0x11,
-    0xCF, 0xCB, 0x6E, 0x4E, 0x9D, 0x99, 0xAC, 0xC4, 0x67, 0xC9, 0xA9, 0xAA, 0xE3, 0x02, 0x08, 0x15,
-    0xCB, 0x6B, 0xC9, 0x91, 0x19, 0x7F, 0x57, 0x7A, 0xC9, 0x3A, 0xB7, 0xFE, 0x70, 0xE5, 0x52, 0x23,
-    0x5F, 0x68, 0xCE, 0x7E, 0x53, 0xA6, 0xA2, 0x9F, 0xFE, 0x5C, 0x82, 0x88, 0x34, 0xC2, 0x2C, 0x17,
-    0xF5, 0x97, 0x10, 0x22, 0x1F, 0x53, 0x4A, 0x4F, 0x54, 0x05, 0xB8, 0x02, 0xBD, 0x57, 0xB1, 0x62,
-    0x84, 0x88, 0x80, 0x02, 0x90, 0x9A, 0x75, 0x0A, 0x85, 0x89, 0x67, 0x61, 0xB3, 0xB6, 0x83, 0x28,
-    0x40, 0x90, 0xF0, 0x0C, 0x74, 0x1F, 0xF0, 0x40, 0xCE, 0x2A, 0x07, 0x68, 0xA3, 0x6A, 0x84, 0x52,
-    0x6C, 0x89, 0x97, 0x83, 0xE7, 0x92, 0x8A, 0x66, 0xEC, 0xB8, 0x31, 0xC0, 0xFA, 0xC9, 0x7B, 0x33,
-    0x19, 0xC2, 0xBE, 0xAD, 0x81, 0xD8, 0xEB, 0xD2, 0xC6, 0x50, 0x55, 0x4C, 0xCD, 0x64, 0xFD, 0xD1,
-    0x41, 0xB0, 0x27, 0x34, 0xF0, 0x1B, 0x45, 0xC3, 0x15, 0x0F, 0x2A, 0x8D, 0x67, 0xC0, 0x61, 0x91,
-    0xBE, 0x20, 0xAF, 0x8C, 0xFB, 0x62, 0x05, 0x4F, 0xAD, 0xE9, 0x24, 0x18, 0x55, 0xB7, 0xF5, 0x82,
-    0xA0, 0xC8, 0x17, 0xA2, 0xCF, 0xA1, 0xE9, 0x61, 0x1A, 0xCC, 0x7C, 0x19, 0x0D, 0xBE, 0xC3, 0x92,
-    0xF6, 0x52, 0xF0, 0x39, 0x96, 0x02, 0xB8, 0xF2, 0x66, 0x00, 0x46, 0x2B, 0x4A, 0x66, 0x71, 0x66,
-    0x7B, 0x08, 0xD5, 0x48, 0xFF, 0x83, 0xF7, 0x5A, 0x28, 0x59, 0x24, 0x5A, 0x8C, 0xB6, 0xC1, 0xF1,
-    0x2B, 0x30, 0xE8, 0x3D, 0x44, 0x1B, 0x32, 0x92, 0x3E, 0xF2, 0x04, 0x60, 0x3A, 0x51, 0xAA, 0xB0,
-    0x05, 0x49, 0x9E, 0x0B, 0x2F, 0xD1, 0xE1, 0x21, 0xCC, 0x06, 0xE0, 0x1E, 0x23, 0x70, 0x5A, 0x54,
-    0xEC, 0x09, 0x11, 0x93, 0x8F, 0x05, 0x41, 0x27, 0xD7, 0xAA, 0x18, 0xCC, 0x84, 0x4C, 0x51, 0x44,
-    0xA5, 0x3E, 0xC6, 0x33, 0x67, 0x12, 0x18, 0x27, 0x83, 0x21, 0x89, 0x7B, 0xC0, 0x42, 0xC2, 0x21,
-    0xF6, 0x22, 0xB9, 0xC3, 0x1E, 0x45, 0x80, 0x7B, 0x38, 0x0A, 0x6E, 0x61, 0xBD, 0xA6, 0xB7, 0xB0,
-    0xBF, 0xFB, 0xFC, 0x10, 0x6A, 0x70, 0x49, 0xB5, 0x18, 0xA0, 0x71, 0xDD, 0x60, 0x9A, 0x42, 0x75,
-    0x16, 0x07, 0x33, 0x0F, 0x9F, 0x67, 0x69, 0x68, 0x6D, 0x89, 0x64, 0xB5, 0x32, 0x52, 0x3C, 0x46,
-    0x6E, 0x10, 0xEA, 0x33, 0x33, 0xE9, 0xE4, 0x74, 0xDC, 0x8A, 0xD2, 0x43, 0x0E, 0xAC, 0xDA, 0x85,
-    0x72, 0x13, 0xF6, 0xA6, 0xF6, 0x2C, 0x31, 0xB6, 0xB6, 0xD8, 0xAA, 0xF4, 0x2D, 0xF7, 0x58, 0x82,
-    0x1D, 0xB0, 0x3A, 0x83, 0x1A, 0x35, 0x9C, 0xF5, 0xC3, 0x59, 0x3D, 0x0B, 0xD8, 0x16, 0x0A, 0x2E,
-    0x2D, 0xDD, 0x07, 0xBA, 0x11, 0xFC, 0x43, 0x5F, 0x18, 0x53, 0x30, 0xBF, 0x99, 0x7B, 0xE8, 0x68,
-    0x2E, 0x1D, 0x0C, 0x4B, 0x18, 0xE0, 0xEA, 0x26, 0xC3, 0x99, 0x3C, 0xD9, 0xDE, 0x1E, 0x6D, 0xBF,
-    0x81, 0x63, 0x21, 0x12, 0x49, 0x53, 0x99, 0x7F, 0xFC, 0x20, 0x87, 0x67, 0x28, 0x06, 0x54, 0x33,
-    0x89, 0x06, 0xC6, 0xCD, 0xCA, 0x47, 0x8D, 0x63, 0x62, 0x27, 0xEE, 0x95, 0xFA, 0xC2, 0xB8, 0x0C,
-    0x71, 0x25, 0xFF, 0xDA, 0xA4, 0x7B, 0x3A, 0x5B, 0xF8, 0x0C, 0x46, 0x25, 0xCC, 0xBB, 0x27, 0xB6,
-    0xE7, 0x03, 0xCB, 0xD0, 0xBB, 0x6A, 0xD2, 0x58, 0xC1, 0x6A, 0x5A, 0x33, 0x82, 0x43, 0xD1, 0xD2,
-    0x03, 0x54, 0x09, 0x90, 0x7F, 0xF4, 0x55, 0xD8, 0xD0, 0xEA, 0x99, 0x58, 0x8F, 0x68, 0xB8, 0xA6,
-    0x26, 0x46, 0x60, 0x08, 0xA6, 0x13, 0xD5, 0x31, 0x55, 0xA9, 0xA5, 0xD9, 0x43, 0x37, 0x7A, 0x9B,
-    0x92, 0x6E, 0x7B, 0x9F, 0xEB, 0xA2, 0x03, 0xDC, 0x77, 0x11, 0xF6, 0x4D, 0x07, 0x28, 0xBB, 0x44,
-    0xFA, 0x85, 0xDE, 0xA6, 0xAF, 0x9D, 0xB9, 0xFD, 0x59, 0x22, 0x22, 0xB7, 0x57, 0x23, 0x37, 0xD0,
-    0x12, 0x45, 0x27, 0xD4, 0x9C, 0x21, 0xA1, 0x1B, 0x15, 0x6D, 0x8D, 0x35, 0x7B, 0xF9, 0x09, 0x9A,
-    0x8A, 0x8F, 0xC6, 0x92, 0xF6, 0xFA, 0xDD, 0x78, 0x11, 0x1E, 0xC8, 0xEF, 0x4D, 0x1E, 0x6F, 0xE5,
-    0xF5, 0xC7, 0x33, 0xDE, 0xDC, 0xE5, 0xA7, 0x23, 0x78, 0x92, 0x4B, 0xC0, 0x00, 0x1B, 0xD9, 0x47,
-    0xCD, 0xC2, 0xDB, 0x02, 0xA6, 0x88, 0x37, 0x6F, 0x9D, 0x2E, 0x38, 0x33, 0x20, 0xAF, 0x8A, 0xD9,
-    0x16, 0xB5, 0x2C, 0x45, 0xBB, 0xF0, 0xAA, 0x83, 0xDF, 0xA0, 0x79, 0xAB, 0x5B, 0x7B, 0x99, 0xD5,
-    0x69, 0x8D, 0x21, 0x27, 0x74, 0x4C, 0xAC, 0xEA, 0x40, 0x6F, 0x74, 0x4B, 0x29, 0xC1, 0x7A, 0x88,
-    0x69, 0x2F, 0xAE, 0x24, 0xC4, 0x65, 0xDC, 0xDB, 0xA2, 0x2F, 0x94, 0xFC, 0xC1, 0x42, 0xDC, 0x1E,
-    0xF5, 0x4D, 0x10, 0x4A, 0x78, 0x05, 0x97, 0x8F, 0x93, 0x95, 0x97, 0xAB, 0xF6, 0x21, 0x2E, 0xA3,
-    0xDB, 0xE2, 0xE5, 0x58, 0x79, 0x59, 0xDC, 0xC2, 0xA6, 0x86, 0xD4, 0xAB, 0x3E, 0x40, 0xB0, 0x46,
-    0x74, 0xF1, 0xC0, 0xF5, 0xD2, 0x10, 0x79, 0x16, 0x00, 0xE7, 0xDE, 0xB1, 0xDA, 0x33, 0x59, 0x1D,
-    0xAA, 0x22, 0xB0, 0x46, 0xA0, 0x61, 0x9F, 0x91, 0x86, 0xE0, 0x7F, 0x8B, 0xD2, 0x35, 0x21, 0x55,
-    0xD3, 0x05, 0xC4, 0x30, 0xD2, 0xB7, 0xD9, 0x99, 0x7E, 0x40, 0xEE, 0x37, 0xE1, 0x72, 0xB6, 0x38,
-    0xCA, 0x4A, 0x54, 0xD6, 0xEB, 0xE4, 0xDD, 0x3D, 0x19, 0xDF, 0x08, 0xB2, 0xEB, 0x46, 0x14, 0x6F,
-    0xD4, 0xAB, 0x96, 0x7C, 0x36, 0x23, 0xF6, 0xC9, 0x9E, 0xE1, 0x62, 0xA0, 0x2A, 0x2C, 0x31, 0xE5,
-    0x06, 0x2D, 0x27, 0x79, 0xBA, 0xEE, 0xB1, 0x2F, 0xC8, 0x90, 0x16, 0x3E, 0x59, 0xC3, 0x8B, 0x8D,
-    0x15, 0xF2, 0xC9, 0xF8, 0x48, 0x4E, 0x84, 0xAE, 0xC7, 0x40, 0x87, 0x9C, 0x05, 0xF1, 0xE7, 0xD5,
-    0x73, 0x40, 0xD5, 0x3C, 0x03, 0xAA, 0xFE, 0x79, 0xA0, 0x32, 0xE5, 0xA0, 0xDD, 0x28, 0x41, 0x3D,
-    0x09, 0xFA, 0x05, 0x05, 0x83, 0x86, 0x62, 0x2A, 0x8A, 0xE9, 0x28, 0xA6, 0x64, 0x43, 0xF4, 0x42,
-    0x15, 0x30, 0x35, 0xC5, 0xF4, 0x14, 0x53, 0xD4, 0xEA, 0x0F, 0x79, 0x09, 0x55, 0x15, 0xD3, 0x55,
-    0x4C, 0x59, 0x5C, 0xAB, 0x6A, 0x63, 0xBC, 0x46, 0x98, 0x43, 0x8D, 0x6B, 0xC9, 0x37, 0x90, 0x4D,
-    0x66, 0xE5, 0xD2, 0xDE, 0x80, 0x43, 0x3F, 0x97, 0x80, 0x43, 0x01, 0x7D, 0x29, 0xFD, 0x9E, 0xBD,
-    0x1A, 0x75, 0xA1, 0x5D, 0x32, 0x9A, 0x84, 0x45, 0xA3, 0x4A, 0x8E, 0xA6, 0x9A, 0x1D, 0x65, 0xE8,
-    0x6A, 0x20, 0x3C, 0xAA, 0x2F, 0x64, 0x1D, 0xD8, 0x0F, 0x13, 0x61, 0xAD, 0x2C, 0x47, 0x24, 0x9B,
-    0x86, 0xC5, 0x21, 0x7B, 0x2C, 0x3F, 0x13, 0x8F, 0x1B, 0x23, 0x36, 0x57, 0xB0, 0x0D, 0xE5, 0xEC,
-    0x81, 0xB1, 0xC5, 0x63, 0x06, 0x2B, 0x42, 0x71, 0xC1, 0x8D, 0x96, 0x41, 0x96, 0x7B, 0x3F, 0xDD,
-    0xA5, 0x58, 0x0D, 0x3B, 0x8F, 0x58, 0x7F, 0x68, 0xB3, 0x1C, 0x76, 0xED, 0x1D, 0xDA, 0xCC, 0x3E,
-    0x35, 0xEA, 0xCF, 0x0E, 0xC5, 0xBA, 0x21, 0x1B, 0x8B, 0x90, 0x53, 0xB3, 0xAB, 0x51, 0x81, 0x7B,
-    0xBB, 0x6B, 0x70, 0x4D, 0xD9, 0xA4, 0x3E, 0x07, 0xFB, 0x4A, 0x40, 0xAA, 0xAC, 0xF6, 0xC6, 0x86,
-    0x2F, 0xD5, 0x99, 0x02, 0xB8, 0xB0, 0x27, 0xF1, 0xE5, 0x13, 0x7D, 0xCF, 0xBB, 0x48, 0xD1, 0xA1,
-    0xC6, 0x1A, 0x4D, 0xA8, 0xF0, 0xF1, 0xF8, 0x87, 0xC9, 0x82, 0x4E, 0x99, 0x28, 0x1E, 0x72, 0xDD,
-    0xA8, 0x4E, 0x7E, 0x5A, 0xA6, 0xC6, 0x2D, 0xD4, 0x59, 0x9D, 0xB4, 0x92, 0x68, 0x38, 0x08, 0x12,
-    0x1A, 0x00, 0x2D, 0x7F, 0xD6, 0xE0, 0x59, 0x6D, 0x50, 0x80, 0x98, 0xD3, 0x1E, 0x20, 0x52, 0xF7,
-    0x29, 0x6D, 0x44, 0xD4, 0xAD, 0x1B, 0x00, 0xA8, 0xF5, 0x17, 0x81, 0xD3, 0xE6, 0x23, 0x81, 0x71,
-    0x25, 0xE4, 0x17, 0x3D, 0xA2, 0x2D, 0x5E, 0xB8, 0x68, 0xD9, 0x25, 0xF6, 0x00, 0x62, 0xCA, 0x41,
-    0x25, 0x32, 0xA4, 0x1A, 0xD5, 0x08, 0xA8, 0x70, 0x09, 0xEE, 0x76, 0x56, 0x3B, 0x58, 0x5D, 0xA1,
-    0x1F, 0xED, 0x72, 0x86, 0x67, 0x2B, 0x01, 0xED, 0x2E, 0xCE, 0xEA, 0x42, 0x54, 0x6B, 0xBB, 0x50,
-    0x98, 0x18, 0xB8, 0x74, 0x18, 0x71, 0x0B, 0xB5, 0x9E, 0x29, 0x66, 0x13, 0x04, 0xCF, 0xB6, 0x1A,
-    0x71, 0x0D, 0x65, 0xCA, 0xDE, 0x5A, 0xF0, 0xCB, 0xB8, 0x16, 0xAD, 0x24, 0x89, 0xC9, 0x6C, 0x06,
-    0x78, 0x6A, 0x8A, 0xEA, 0xA6, 0x29, 0x11, 0xAB, 0x35, 0x1B, 0xB8, 0xB3, 0x66, 0xEE, 0xF9, 0xBF,
-    0x12, 0x98, 0xDA, 0x15, 0xFA, 0x10, 0x2D, 0x32, 0x58, 0xCD, 0x58, 0x0F, 0x60, 0x68, 0x25, 0xA1,
-    0x10, 0xFC, 0x73, 0x84, 0x7E, 0x30, 0x05, 0x58, 0x51, 0xE3, 0x26, 0xF4, 0xF4, 0xE5, 0x50, 0x2C,
-    0xD8, 0x3F, 0x9B, 0x73, 0x6D, 0x50, 0x48, 0xD7, 0xF4, 0x64, 0x40, 0x13, 0x54, 0x5F, 0xFF, 0x6A,
-    0xE6, 0x04, 0xE3, 0xE3, 0xF9, 0x18, 0x30, 0x93, 0x78, 0x5F, 0xDE, 0x20, 0x6C, 0xEF, 0x67, 0x8F,
-    0xD8, 0x30, 0x9D, 0x5C, 0xA2, 0xEE, 0x00, 0xAA, 0xDA, 0x53, 0xFB, 0x9E, 0x64, 0x5F, 0x5A, 0x12,
-    0x28, 0x6B, 0x5E, 0x37, 0x35, 0xC9, 0xAA, 0x95, 0x71, 0xF3, 0x17, 0xFF, 0xE0, 0x10, 0xA3, 0x29,
-    0x1D, 0xAC, 0x97, 0x85, 0xF2, 0x82, 0x48, 0x61, 0x36, 0x72, 0x72, 0x22, 0xFA, 0x96, 0xB1, 0xBC,
-    0x87, 0x41, 0x67, 0x26, 0xB3, 0x6D, 0x10, 0xE8, 0xDE, 0x66, 0x4C, 0xE5, 0xEC, 0xCC, 0x6A, 0xC3,
-    0xAA, 0x99, 0xF7, 0xE4, 0x23, 0x73, 0x1F, 0xFD, 0xD9, 0xC0, 0xE9, 0x04, 0x42, 0x04, 0xA5, 0x95,
-    0x15, 0x9B, 0x5B, 0x81, 0x66, 0xDE, 0xDE, 0x52, 0xA2, 0x9C, 0x85, 0xFB, 0xAE, 0x7A, 0xC0, 0xBF,
-    0xA3, 0x11, 0x28, 0x68, 0xC3, 0x82, 0xD4, 0xD1, 0x14, 0xD4, 0x95, 0x02, 0xEB, 0xEB, 0x74, 0xC6,
-    0x17, 0x24, 0xD1, 0x01, 0x2C, 0x8C, 0xBB, 0xCC, 0x81, 0x7B, 0x6D, 0xEA, 0x68, 0xC0, 0x99, 0x53,
-    0x56, 0xC6, 0xF6, 0x21, 0x54, 0xF1, 0xD3, 0x18, 0x34, 0x8A, 0xD9, 0x59, 0xFA, 0xD6, 0x87, 0x47,
-    0x0B, 0x50, 0xBC, 0x1D, 0xB2, 0x0E, 0x79, 0x54, 0x48, 0x3D, 0x6E, 0x28, 0xAB, 0xB3, 0x0F, 0x95,
-    0x4D, 0x05, 0x42, 0x57, 0x67, 0x2A, 0xD2, 0xC3, 0xD0, 0xF8, 0xEF, 0x81, 0x2D, 0xC9, 0x08, 0x2B,
-    0x81, 0xC7, 0x23, 0x72, 0x12, 0x3D, 0xD4, 0xC9, 0x38, 0x24, 0x5B, 0xDE, 0x67, 0x9B, 0x20, 0xA6,
-    0xE1, 0x43, 0x25, 0x97, 0xA7, 0xC1, 0x69, 0xC6, 0xE7, 0x47, 0x54, 0x75, 0x18, 0xE4, 0x6C, 0x2E,
-    0x87, 0x09, 0x96, 0x8D, 0xB5, 0x2A, 0x16, 0x18, 0x9B, 0x60, 0x7D, 0xE3, 0x32, 0xD0, 0x13, 0x25,
-    0x23, 0x3E, 0x04, 0xCA, 0x9E, 0x0E, 0xB8, 0xD0, 0xB3, 0x9E, 0x7E, 0xC2, 0x23, 0x9B, 0x61, 0xDA,
-    0x68, 0x73, 0xA1, 0xF2, 0xF4, 0x53, 0x67, 0x9F, 0xD6, 0xB0, 0xD2, 0x64, 0x9F, 0x60, 0xDD, 0x68,
-    0xD7, 0x84, 0x6D, 0x83, 0xB0, 0xDF, 0x14, 0xEC, 0xFF, 0x2D, 0x37, 0x85, 0x85, 0x09, 0x62, 0xB2,
-    0x98, 0x73, 0x07, 0xE1, 0x2C, 0x67, 0x17, 0xCE, 0x87, 0xE3, 0x16, 0x87, 0xC4, 0x4E, 0xA2, 0xD9,
-    0x55, 0xC9, 0x54, 0x74, 0xE9, 0x98, 0xF7, 0x19, 0x5A, 0xB1, 0x1C, 0x99, 0x80, 0x3C, 0x9F, 0xCB,
-    0x26, 0x9E, 0x0F, 0x0F, 0x0F, 0xFF, 0x65, 0x33, 0x2A, 0x31, 0x26, 0x92, 0x34, 0xB7, 0x10, 0x54,
-    0xB7, 0x97, 0x64, 0xFC, 0x16, 0xE4, 0xDE, 0x41, 0xDE, 0xEF, 0x91, 0xD4, 0x0F, 0xE9, 0x5A, 0x8F,
-    0x89, 0x4F, 0x3C, 0x50, 0x82, 0xED, 0x7A, 0x8D, 0x52, 0xCF, 0xD1, 0x1B, 0x1B, 0xA2, 0x7C, 0x36,
-    0x78, 0x86, 0x97, 0x2A, 0x77, 0xF7, 0xE4, 0x8B, 0x1B, 0xFA, 0x95, 0xFE, 0x1E, 0x54, 0x6A, 0x70,
-    0x03, 0x12, 0xBF, 0xDA, 0xC0, 0x3A, 0xC7, 0xC8, 0xC8, 0x1D, 0xB1, 0x66, 0x8F, 0xD3, 0xB6, 0x76,
-    0x43, 0x65, 0xD6, 0xA8, 0x8A, 0x7C, 0x39, 0x45, 0x5E, 0x7D, 0xFC, 0x44, 0x7D, 0xF2, 0xF4, 0xEE,
-    0x92, 0x68, 0xBC, 0xA4, 0x0B, 0x8A, 0x21, 0xF6, 0x03, 0xA6, 0x7A, 0x74, 0x29, 0x73, 0x0E, 0xC4,
-    0x2F, 0xFB, 0x62, 0x40, 0x83, 0xD5, 0xA1, 0xE5, 0xAA, 0x6A, 0x64, 0xD1, 0x3E, 0x59, 0x95, 0xCD,
-    0x4A, 0xDF, 0x60, 0x42, 0xA6, 0x8A, 0xF6, 0x0A, 0xBD, 0x7F, 0xBA, 0x19, 0x86, 0x22, 0xB7, 0xC8,
-    0x5C, 0x6C, 0x1E, 0x89, 0xAD, 0xFE, 0xD4, 0x8D, 0x35, 0x62, 0xE8, 0x12, 0xA2, 0x92, 0x99, 0x15,
-    0x8A, 0xF0, 0x0E, 0x83, 0x8F, 0x49, 0x8E, 0x5B, 0x5E, 0x59, 0x37, 0x83, 0x40, 0x42, 0x10, 0x1E,
-    0xDB, 0xB9, 0x0C, 0xE8, 0x5A, 0x17, 0x96, 0x28, 0x24, 0x15, 0x02, 0x1A, 0x60, 0x95, 0x4D, 0xC9,
-    0x44, 0xE8, 0xE2, 0x84, 0x02, 0x2A, 0xD4, 0x1D, 0x73, 0x0F, 0xEC, 0x9D, 0x52, 0xC2, 0x04, 0x79,
-    0xFB, 0xAF, 0x4E, 0xDF, 0xD7, 0xB7, 0x91, 0x6B, 0x0D, 0x6A, 0x7F, 0x15, 0x06, 0xB9, 0x6F, 0x18,
-    0x7E, 0xD5, 0xDA, 0x15, 0xF7, 0x7D, 0x02, 0x06, 0x83, 0xCE, 0x3A, 0xEF, 0xDA, 0xD8, 0xB3, 0xB3,
-    0x06, 0x47, 0x40, 0xDD, 0xFD, 0x94, 0xEE, 0xFD, 0xB5, 0xEB, 0x6A, 0x54, 0x20, 0x70, 0x21, 0x23,
-    0x42, 0xDB, 0x89, 0xC6, 0x4D, 0xCB, 0x3A, 0xA3, 0x94, 0x94, 0x34, 0x1B, 0x6F, 0xD1, 0x6A, 0x31,
-    0xE5, 0xEC, 0xB7, 0xA9, 0x19, 0x78, 0xC0, 0x5E, 0x28, 0x80, 0x1C, 0xDE, 0x1D, 0x3D, 0x39, 0xD8,
-    0xF6, 0xCD, 0x05, 0x73, 0x35, 0xB2, 0xAC, 0x79, 0xF1, 0x01, 0x0E, 0x7D, 0xCD, 0x4E, 0x22, 0xD6,
-    0xF9, 0x87, 0x07, 0xAC, 0xDC, 0xBC, 0xF8, 0x40, 0xC3, 0xB9, 0x58, 0xF9, 0x9A, 0x65, 0xED, 0xFA,
-    0x0C, 0xA2, 0xDA, 0xD0, 0xCA, 0x5F, 0xA8, 0x24, 0x0C, 0x74, 0xF2, 0x30, 0xD5, 0x59, 0x77, 0x61,
-    0xC7, 0x96, 0x3E, 0xB6, 0x17, 0x52, 0x85, 0x98, 0x8C, 0xE5, 0x97, 0x1C, 0xDE, 0x91, 0x9E, 0x70,
-    0x94, 0x13, 0xC6, 0x01, 0x36, 0x0C, 0x70, 0xC4, 0x80, 0x96, 0xD3, 0xF1, 0x27, 0xD4, 0xBD, 0x29,
-    0xC9, 0xBB, 0xED, 0x27, 0x15, 0x3C, 0xA6, 0x44, 0x2B, 0x23, 0x15, 0x05, 0x63, 0x34, 0x62, 0xD1,
-    0x0B, 0x7E, 0x1B, 0x37, 0x7E, 0xD3, 0xCD, 0x3A, 0x94, 0x96, 0xC2, 0x27, 0xF3, 0x4E, 0x15, 0x2D,
-    0x00, 0xAE, 0xB6, 0x54, 0x29, 0x4F, 0xB4, 0xCF, 0xF5, 0x35, 0xD8, 0xF9, 0x32, 0xA8, 0x29, 0xD0,
-    0xBE, 0xED, 0xEA, 0xCA, 0xF5, 0x25, 0xDD, 0x89, 0xB8, 0x4A, 0x66, 0x6B, 0xE5, 0xB5, 0x6A, 0xFF,
-    0x06, 0xAE, 0xD4, 0xD7, 0xD1, 0x83, 0xBD, 0x35, 0x71, 0xBE, 0x1A, 0x38, 0x39, 0xC8, 0xE4, 0xC4,
-    0xD8, 0xB6, 0x09, 0x50, 0x54, 0x95, 0x60, 0xD3, 0x88, 0xE0, 0xA2, 0xCF, 0x38, 0x7F, 0xC6, 0x5A,
-    0x40, 0xD0, 0x7C, 0x48, 0xA7, 0x78, 0xF9, 0xC7, 0x76, 0x29, 0x57, 0xDC, 0x79, 0xFE, 0x74, 0x8E,
-    0x64, 0x0C, 0x9D, 0x60, 0x47, 0xDD, 0xE5, 0x57, 0xE1, 0x34, 0xB0, 0x00, 0x45, 0x23, 0x08, 0xFF,
-    0x93, 0x31, 0xC8, 0x6B, 0x69, 0x3B, 0x04, 0xF9, 0xCB, 0x2E, 0xF8, 0x86, 0xE6, 0xA6, 0x4E, 0x74,
-    0x8E, 0x06, 0xCF, 0x10, 0x27, 0x18, 0xDA, 0xD8, 0xF9, 0x8F, 0xE1, 0xAE, 0xFD, 0x3D, 0xD2, 0x58,
-    0x60, 0x20, 0x2E, 0x7D, 0x77, 0x63, 0x13, 0x4E, 0x45, 0x61, 0x92, 0x68, 0x6F, 0xB4, 0xA7, 0x63,
-    0x1F, 0x16, 0x77, 0xCD, 0x2E, 0x72, 0x6C, 0x4C, 0xBF, 0xD2, 0xA1, 0x3C, 0x46, 0x4B, 0xD2, 0x1F,
-    0x27, 0x0B, 0x00, 0x61, 0x28, 0x19, 0x85, 0xC9, 0xAA, 0x8D, 0xB5, 0x05, 0xA0, 0xEB, 0x9E, 0xCC,
-    0x00, 0x69, 0x7C, 0x5B, 0x3F, 0x5D, 0x63, 0xFD, 0x6C, 0x32, 0xC8, 0xAF, 0x64, 0x27, 0x62, 0x53,
-    0x84, 0xFC, 0xA8, 0x2B, 0xDA, 0x2D, 0x61, 0xF8, 0x9B, 0xEA, 0x63, 0x32, 0x43, 0xAA, 0x56, 0xCC,
-    0x0A, 0x33, 0x9D, 0xF5, 0x0F, 0x4E, 0x73, 0x7D, 0x53, 0xAB, 0x97, 0x18, 0xF6, 0xBB, 0xB2, 0x9B,
-    0xEA, 0x5F, 0x81, 0x13, 0x25, 0xFA, 0x89, 0xDE, 0xD3, 0xEE, 0xC7, 0x8F, 0xF4, 0x91, 0x62, 0xD1,
-    0x8F, 0xF5, 0x3E, 0x7F, 0x44, 0x69, 0x07, 0xB8, 0x67, 0x74, 0x23, 0x9E, 0x9E, 0x90, 0x43, 0x03,
-    0xB9, 0x5C, 0x36, 0x45, 0x6B, 0xBC, 0x90, 0xB1, 0x54, 0x0A, 0x03, 0x3B, 0x4E, 0xEE, 0x2A, 0x5E,
-    0x2C, 0x1F, 0x5C, 0x99, 0xB3, 0x29, 0xD3, 0xFB, 0x4B, 0x8C, 0x1E, 0x7B, 0xE4, 0xC5, 0xDA, 0x8A,
-    0x6C, 0x64, 0x19, 0x86, 0xFE, 0x62, 0x68, 0x7B, 0xB7, 0x3A, 0x8D, 0xF6, 0x4E, 0xD8, 0x57, 0xE1,
-    0x8E, 0xC2, 0xE7, 0xE8, 0x6F, 0x20, 0xA0, 0x1B, 0x48, 0x6B, 0xC8, 0x6A, 0x1A, 0xB0, 0x20, 0x1B,
-    0xB2, 0xE2, 0x1F, 0x02, 0xE0, 0xCB, 0xDB, 0xC8, 0x63, 0x5F, 0x22, 0x40, 0x2E, 0xFB, 0x10, 0xCC,
-    0x55, 0xC8, 0x57, 0x18, 0x95, 0x53, 0xCA, 0xF6, 0xA3, 0x25, 0x9D, 0x33, 0x74, 0x3E, 0xC5, 0xFF,
-    0x40, 0x96, 0xDF, 0xE1, 0x39, 0xD7, 0xA5, 0x33, 0xA4, 0xFE, 0x00, 0x11, 0xCA, 0xF0, 0xE1, 0xDC,
-    0xBE, 0xFD, 0xC2, 0xDB, 0x4C, 0xBB, 0x9D, 0x43, 0xAF, 0x0E, 0xD8, 0xAC, 0x62, 0xD4, 0x5E, 0x58,
-    0xF5, 0x27, 0x5A, 0xBD, 0xB2, 0x22, 0x5F, 0x52, 0xBD, 0x02, 0xD2, 0x01, 0x8B, 0x0B, 0x5B, 0x25,
-    0xB3, 0x5F, 0x01, 0x2C, 0xE1, 0xEF, 0x43, 0x5D, 0xCC, 0x6F, 0x0C, 0x46, 0xB8, 0x09, 0x8D, 0x93,
-    0x9E, 0xD8, 0x44, 0x01, 0xE5, 0xE7, 0x84, 0x05, 0xE4, 0xA5, 0x4D, 0x96, 0x5A, 0x26, 0x5A, 0x17,
-    0xAC, 0xBF, 0x0A, 0x23, 0xF4, 0xF8, 0xF0, 0x66, 0x08, 0xA8, 0x67, 0x20, 0xDD, 0xBF, 0x00, 0xD2,
-    0x6D, 0x45, 0x27, 0xB9, 0x17, 0x40, 0x1A, 0x9D, 0xE9, 0x09, 0x8A, 0xF3, 0x67, 0xA0, 0xBF, 0x5F,
-    0x82, 0xB7, 0x0F, 0xC8, 0xE6, 0x8A, 0xBF, 0x6A, 0x70, 0xC2, 0x6E, 0x03, 0x34, 0xCF, 0x4D, 0xD8,
-    0x85, 0xA1, 0x7F, 0x3A, 0x7C, 0x17, 0x3A, 0x45, 0x55, 0x3D, 0xA3, 0x9D, 0xFD, 0x44, 0x77, 0x6A,
-    0x34, 0x29, 0xCB, 0x0A, 0xA4, 0xAD, 0xAC, 0x6E, 0x83, 0x55, 0xDA, 0x98, 0x61, 0x13, 0x6D, 0x9B,
-    0x31, 0x00, 0xC2, 0x97, 0xE8, 0x11, 0x10, 0xE5, 0x0D, 0x84, 0xFA, 0x6C, 0xD8, 0xF7, 0xA1, 0x87,
-    0xE3, 0x90, 0x79, 0xF6, 0xAB, 0x82, 0xFD, 0x20, 0xE6, 0x6D, 0x94, 0x0B, 0x0F, 0x41, 0x3E, 0xD7,
-    0x41, 0xB4, 0xA3, 0xBE, 0xE4, 0xCD, 0x4B, 0x48, 0xBE, 0xAC, 0x63, 0xFD, 0x85, 0xF6, 0x58, 0xF8,
-    0x9C, 0xFD, 0x00, 0x7A, 0x07, 0xB0, 0x86, 0x65, 0xC9, 0x00, 0xD5, 0xF6, 0x81, 0x41, 0xB3, 0x29,
-    0xE0, 0x7B, 0xD4, 0xB9, 0xFF, 0x04, 0x47, 0xF0, 0x09, 0xE2, 0x9F, 0x6D, 0x48, 0x45, 0x6E, 0x8A,
-    0xC0, 0xED, 0xB1, 0x36, 0x8C, 0x11, 0xED, 0xA1, 0x78, 0x44, 0xB4, 0x0C, 0x7F, 0x2F, 0x0A, 0xC1,
-    0x80, 0x1A, 0x96, 0x8D, 0x1C, 0xB4, 0x23, 0xCC, 0xF3, 0xC1, 0x8D, 0xD1, 0x92, 0xE9, 0x4B, 0xE5,
-    0x9D, 0x47, 0x8F, 0xEE, 0xA8, 0x6F, 0x7D, 0xA9, 0xA0, 0x76, 0x4A, 0xDC, 0xB3, 0xAE, 0xA5, 0x8A,
-    0x2A, 0xC4, 0xD7, 0x03, 0xD0, 0xB7, 0x5F, 0xE0, 0x7E, 0xE4, 0xCF, 0x9C, 0x4E, 0x05, 0xD6, 0xAC,
-    0xC5, 0xA1, 0x0F, 0x5D, 0x73, 0xAC, 0x79, 0x2C, 0xD9, 0x57, 0xEC, 0xD0, 0x0C, 0xEE, 0xC9, 0x69,
-    0xE8, 0xB9, 0x22, 0x40, 0x24, 0x9F, 0xDF, 0x61, 0x30, 0x26, 0xBE, 0x9D, 0x51, 0xCA, 0x3E, 0x6C,
-    0xBB, 0x36, 0x62, 0xB1, 0x9A, 0xF2, 0xBE, 0xE8, 0xEB, 0x06, 0x76, 0xCD, 0xE6, 0x02, 0x69, 0xA4,
-    0x77, 0x26, 0x59, 0x0B, 0x54, 0xED, 0x0C, 0x29, 0x83, 0x0C, 0xBF, 0xE6, 0x39, 0xC5, 0xBA, 0x71,
-    0x82, 0xCE, 0x07, 0x35, 0x15, 0xC8, 0x49, 0x42, 0x58, 0x57, 0x84, 0x16, 0x90, 0xAA, 0x2D, 0xDA,
-    0xEC, 0xC8, 0x4E, 0x85, 0x22, 0xB4, 0xA2, 0xCC, 0xA2, 0x27, 0x5F, 0x4A, 0x54, 0xAD, 0xCF, 0x86,
-    0xD0, 0xA4, 0x18, 0x41, 0x65, 0xBB, 0x60, 0x30, 0x44, 0xDE, 0x45, 0xE3, 0xC7, 0x4F, 0x67, 0xF9,
-    0x93, 0x63, 0x58, 0x42, 0xEF, 0xE8, 0x5C, 0x8F, 0x85, 0x25, 0x40, 0xBF, 0x99, 0x43, 0x20, 0x6F,
-    0xD1, 0xEF, 0x25, 0x2C, 0x7D, 0x20, 0x94, 0xAF, 0xA8, 0xFD, 0x9E, 0x54, 0xC1, 0xA7, 0xF5, 0x25,
-    0xC2, 0xF8, 0x3F, 0x91, 0x5E, 0xBC, 0xC9, 0x5A, 0x73, 0x1D, 0x86, 0x2E, 0xEF, 0xB1, 0x37, 0x7A,
-    0x9F, 0x4D, 0xE7, 0xC3, 0x26, 0x40, 0x90, 0xFD, 0x42, 0x13, 0x98, 0x63, 0x18, 0x7D, 0x19, 0xD2,
-    0x8B, 0x7C, 0xCB, 0xA8, 0xCE, 0x11, 0x19, 0x0A, 0x89, 0x9E, 0xD1, 0xD9, 0xCC, 0x88, 0xFC, 0xCB,
-    0x44, 0x8A, 0x2B, 0x23, 0x8A, 0x17, 0x38, 0xEB, 0x92, 0xF6, 0x75, 0x5F, 0x80, 0x50, 0xBD, 0x4C,
-    0x56, 0xBA, 0x04, 0xB2, 0xBF, 0x6E, 0xDF, 0x7E, 0x93, 0x3F, 0xBE, 0x32, 0x82, 0xAE, 0xDC, 0x7B,
-    0xAA, 0x4B, 0x7E, 0x9B, 0x25, 0x71, 0x23, 0x35, 0xA8, 0x30, 0xE7, 0x9E, 0xFF, 0x4D, 0x9A, 0xC4,
-    0x5F, 0x45, 0x07, 0xE3, 0x52, 0x8B, 0xD1, 0xA6, 0xDC, 0x98, 0x19, 0x8A, 0xAC, 0xB5, 0x8C, 0x16,
-    0xAE, 0xFC, 0xC9, 0xD2, 0x1B, 0x4E, 0x3B, 0x0B, 0xFE, 0x0C, 0x84, 0x3C, 0x9C, 0xDA, 0x0F, 0x4C,
-    0x4E, 0x6D, 0xBD, 0x6C, 0xF3, 0xA3, 0x0E, 0x38, 0x7D, 0x87, 0x8B, 0xE4, 0x4C, 0x58, 0x10, 0x77,
-    0xD6, 0xDC, 0x61, 0x33, 0x85, 0x2F, 0xBA, 0xED, 0x59, 0xC7, 0x7D, 0x8E, 0xB7, 0x67, 0xED, 0x01,
-    0x48, 0x71, 0x61, 0x03, 0xFE, 0x1C, 0xB7, 0x8D, 0xF2, 0xE7, 0xAB, 0x91, 0x46, 0x6E, 0x38, 0x19,
-    0x97, 0xDC, 0xDF, 0xCA, 0x88, 0x15, 0xE3, 0xC9, 0x64, 0x2A, 0x8C, 0xB6, 0x6C, 0x66, 0x7B, 0xCB,
-    0x56, 0xC6, 0xF4, 0x54, 0x66, 0xEA, 0xC8, 0x1F, 0x0D, 0xF0, 0xBF, 0x3C, 0xB0, 0x21, 0x2F, 0x22,
-    0xEE, 0x55, 0xA7, 0x57, 0xF4, 0xA9, 0xAE, 0x3E, 0xD3, 0x3B, 0xCD, 0x77, 0xCD, 0xB2, 0xFF, 0x0B,
-    0xCD, 0x5A, 0x3D, 0x8C, 0xDD, 0xD6, 0x95, 0xBE, 0x24, 0x35, 0x43, 0x47, 0x44, 0x7C, 0x55, 0x48,
-    0x42, 0x6C, 0x07, 0xA6, 0x0B, 0x17, 0x89, 0x21, 0x8B, 0x4D, 0x0A, 0x23, 0x90, 0xE6, 0x52, 0x72,
-    0xE1, 0x42, 0x85, 0x07, 0x88, 0x67, 0x17, 0x58, 0x23, 0xB0, 0x8B, 0x14, 0x89, 0xB1, 0xC0, 0xA8,
-    0x48, 0xE1, 0x42, 0x12, 0x19, 0xAB, 0x48, 0xE1, 0xC2, 0xB3, 0x40, 0x82, 0x14, 0x5B, 0x24, 0x85,
-    0x1A, 0xCB, 0xC0, 0x4A, 0x85, 0x0A, 0x15, 0x92, 0x48, 0x8D, 0x0A, 0x61, 0xE1, 0x42, 0xB4, 0xB5,
-    0x8B, 0x14, 0x2E, 0x4C, 0x5B, 0xDA, 0x60, 0xE1, 0x01, 0x56, 0x94, 0x45, 0xC3, 0x94, 0x86, 0xE4,
-    0xD9, 0xEF, 0x3B, 0x7C, 0x6F, 0x7E, 0xEC, 0x56, 0x81, 0xF2, 0x20, 0xF2, 0xBD, 0x21, 0x79, 0xEF,
-    0x3D, 0xF7, 0xFC, 0x7C, 0xE7, 0x3B, 0x87, 0x32, 0x9E, 0xF1, 0x7A, 0xE3, 0xAA, 0xA0, 0x37, 0x49,
-    0x6A, 0x8C, 0xF1, 0x8C, 0xDF, 0x18, 0x67, 0x82, 0xDA, 0x9C, 0x31, 0x51, 0x6D, 0x06, 0x63, 0x2B,
-    0xDC, 0x4F, 0x4A, 0xDC, 0xCF, 0xF2, 0xA8, 0x35, 0x62, 0xE2, 0xC6, 0x1F, 0xCC, 0x4B, 0x7C, 0x96,
-    0x9F, 0xA8, 0x34, 0xC6, 0xE6, 0x38, 0x70, 0x21, 0xC6, 0xDF, 0x09, 0xA6, 0xC8, 0xD6, 0x4C, 0x2C,
-    0x9D, 0x29, 0xA4, 0x0F, 0xE4, 0x6A, 0x1F, 0x75, 0x97, 0xF7, 0xDB, 0xBA, 0xC5, 0x1C, 0x98, 0xF8,
-    0x3A, 0x8E, 0xF7, 0x6A, 0xE3, 0xCE, 0x56, 0x38, 0x4A, 0xE3, 0x6E, 0x96, 0x17, 0x93, 0xCD, 0xDF,
-    0x37, 0x56, 0xA4, 0x0A, 0x45, 0x8C, 0x29, 0xEE, 0xEA, 0x14, 0xE6, 0x30, 0x8E, 0x25, 0x1C, 0x47,
-    0x71, 0x9C, 0xC2, 0x71, 0x05, 0xC7, 0xB2, 0x99, 0x7F, 0x16, 0x05, 0xAB, 0x09, 0x4E, 0x76, 0x93,
-    0x63, 0xFC, 0xDE, 0x04, 0x6D, 0x58, 0x63, 0x85, 0xE7, 0x8D, 0x19, 0x71, 0x3F, 0x6C, 0x71, 0x72,
-    0x90, 0x2C, 0x11, 0x29, 0xF1, 0xA0, 0x18, 0xBF, 0xF8, 0xEA, 0x1C, 0x86, 0xE0, 0x72, 0xD0, 0xE1,
-    0x14, 0x57, 0x38, 0x15, 0x38, 0x7E, 0xD1, 0x99, 0x83, 0x01, 0x1E, 0xE8, 0x63, 0x9C, 0x9A, 0xEC,
-    0x93, 0x42, 0xCC, 0xAF, 0x8C, 0xAA, 0xC1, 0x98, 0xF4, 0xF2, 0xC2, 0xF2, 0xA9, 0x68, 0x43, 0xEE,
-    0x55, 0x98, 0xA6, 0x31, 0xF2, 0x5A, 0x6F, 0x6C, 0x19, 0x97, 0x7E, 0x6B, 0xA0, 0x30, 0x13, 0xE7,
-    0x41, 0x13, 0xB4, 0xC6, 0xA5, 0x85, 0x89, 0xA4, 0x68, 0x20, 0xBD, 0x94, 0x57, 0xE3, 0xBB, 0x67,
-    0x7C, 0x0C, 0xCE, 0x33, 0xB9, 0x2E, 0x7D, 0x21, 0x37, 0xA4, 0x5F, 0x1D, 0x4C, 0x51, 0x5B, 0x28,
-    0xC3, 0x84, 0xBD, 0x37, 0x98, 0xA0, 0xC7, 0xFA, 0xFE, 0x10, 0x35, 0x10, 0x26, 0x2E, 0xCD, 0xB3,
-    0xE2, 0xFE, 0x97, 0x42, 0xF6, 0x66, 0x21, 0x7B, 0xF8, 0x06, 0xE4, 0x6D, 0x54, 0xE6, 0x06, 0xFA,
-    0x93, 0x7A, 0xDA, 0x82, 0x71, 0xD0, 0x2E, 0x74, 0x8F, 0x69, 0x65, 0x0D, 0x92, 0xE3, 0x59, 0x3C,
-    0xD2, 0x4D, 0x8A, 0x80, 0x79, 0x4A, 0x9A, 0x27, 0xF7, 0x3B, 0x48, 0x12, 0x34, 0x26, 0x9B, 0x8C,
-    0xB6, 0xF3, 0xE3, 0xFF, 0x05, 0xD2, 0x86, 0x8D, 0xB9, 0x06, 0x53, 0x42, 0xF2, 0x78, 0x1A, 0x00,
-    0xD1, 0x0F, 0xF0, 0x6E, 0x91, 0x63, 0xB6, 0x32, 0x7C, 0x24, 0x78, 0xA8, 0x0F, 0x7A, 0xBF, 0x8E,
-    0xA1, 0xBB, 0x07, 0xAD, 0x09, 0x6E, 0xB6, 0xC6, 0x86, 0x9D, 0x59, 0x82, 0xE1, 0xAF, 0xE2, 0x18,
-    0x82, 0xD6, 0x1B, 0x83, 0xDA, 0x13, 0x18, 0x5C, 0x60, 0xE8, 0xF1, 0x5D, 0x1C, 0xD5, 0x11, 0x4F,
-    0x82, 0x26, 0xEC, 0x6C, 0x9D, 0x94, 0x0E, 0x82, 0x39, 0x98, 0xE4, 0xA0, 0x9A, 0xC9, 0x6F, 0x4E,
-    0x17, 0x56, 0xEE, 0x0F, 0xEF, 0x46, 0xB0, 0xD4, 0x01, 0x3A, 0x4B, 0xA6, 0x1B, 0x5A, 0x7B, 0xB3,
-    0xA6, 0xBB, 0x44, 0x79, 0x50, 0xD1, 0xC8, 0x97, 0x7C, 0x49, 0x2F, 0x59, 0x0F, 0x8E, 0xB2, 0x5E,
-    0xB9, 0xB0, 0x3C, 0x74, 0x24, 0x2A, 0x5F, 0xF1, 0xEE, 0x94, 0xD8, 0xE2, 0xD3, 0xAF, 0x58, 0x6C,
-    0xFE, 0x41, 0x8E, 0x9F, 0xF6, 0x08, 0x7F, 0xDE, 0x29, 0x61, 0xD9, 0xE7, 0x5F, 0x0E, 0xC7, 0x7F,
-    0xF5, 0xCB, 0x1A, 0x22, 0x1F, 0x89, 0xD2, 0xD5, 0x3A, 0x4A, 0xE1, 0x20, 0x7E, 0x6D, 0x5A, 0x7A,
-    0x48, 0xF0, 0xD0, 0xBB, 0x06, 0xDB, 0x0B, 0x3D, 0xC0, 0x5B, 0xC1, 0xE9, 0x99, 0xFD, 0x98, 0x39,
-    0xDC, 0xEC, 0xEC, 0xF5, 0x26, 0x3E, 0xDE, 0x24, 0x41, 0xBD, 0x14, 0x55, 0x2E, 0xFE, 0x4F, 0x27,
-    0x43, 0xFC, 0xA0, 0x5B, 0x48, 0x21, 0xE8, 0xBE, 0x44, 0x5A, 0x08, 0x76, 0x00, 0xAA, 0x7F, 0xDE,
-    0xBC, 0x62, 0x0A, 0x6F, 0x08, 0xFA, 0xA8, 0x8D, 0x1B, 0x57, 0x65, 0xA5, 0xA4, 0xC5, 0xB1, 0xD1,
-    0xC8, 0x7B, 0xD0, 0x0C, 0x7E, 0xDB, 0xDA, 0x95, 0x61, 0x6B, 0xB1, 0x14, 0x96, 0xC3, 0xE7, 0xC0,
-    0xCA, 0xCA, 0x6B, 0x22, 0x43, 0x26, 0xF2, 0xC9, 0xCA, 0x0A, 0x14, 0x1E, 0x61, 0x3F, 0x57, 0xA7,
-    0xAF, 0xDF, 0xE0, 0x4B, 0x7A, 0x91, 0x5B, 0x34, 0x15, 0x44, 0x59, 0xA6, 0xD5, 0x2A, 0xEC, 0xF6,
-    0xB0, 0x79, 0xD9, 0x78, 0xD5, 0x0F, 0x5D, 0x7B, 0x28, 0x0A, 0x3F, 0x08, 0xCE, 0xE6, 0x5F, 0x56,
-    0x17, 0xAB, 0xA3, 0xCD, 0xA1, 0x9F, 0xD9, 0x26, 0x7A, 0x3A, 0xF8, 0x3F, 0xFF, 0xC6, 0xF5, 0x07,
-    0x75, 0x7D, 0x72, 0x3C, 0xFA, 0x5B, 0x6B, 0x20, 0x4B, 0x0B, 0xBF, 0x8F, 0xBE, 0x82, 0x9D, 0x9F,
-    0x5D, 0x83, 0x5E, 0x3F, 0x93, 0xA1, 0x10, 0x7A, 0x43, 0x34, 0x18, 0x19, 0xED, 0xE6, 0x90, 0xF9,
-    0x0F, 0xDB, 0x60, 0xB3, 0xB2, 0x9F, 0x97, 0xD7, 0xDC, 0xBD, 0x26, 0x93, 0x74, 0xF5, 0x2E, 0x17,
-    0x4B, 0x72, 0x03, 0x57, 0xD8, 0xFE, 0x0A, 0x27, 0x19, 0x3F, 0xFD, 0x68, 0xFC, 0xF0, 0x3B, 0xF7,
-    0x62, 0x8D, 0xE0, 0x97, 0xCE, 0x9F, 0xFF, 0xD3, 0xF4, 0x08, 0x23, 0xC2, 0x3C, 0x57, 0xD3, 0x16,
-    0x8F, 0xC6, 0xB0, 0x3A, 0xE3, 0xA7, 0xD7, 0x88, 0x0C, 0x70, 0x1C, 0xF8, 0x69, 0xC1, 0xB0, 0x41,
-    0xD0, 0xC0, 0xC8, 0x4E, 0x18, 0x5C, 0x66, 0x35, 0xB7, 0x52, 0x5E, 0xCB, 0x8E, 0x97, 0xA7, 0x8D,
-    0xBA, 0x9D, 0xEB, 0xCC, 0x66, 0x6B, 0x18, 0x84, 0xA9, 0xD7, 0xBF, 0x24, 0x15, 0x3C, 0xF4, 0x37,
-    0x0C, 0xA3, 0xA3, 0xF6, 0x8B, 0xC1, 0xBD, 0x5F, 0x5F, 0x9A, 0x14, 0xB1, 0x8C, 0x49, 0xA0, 0x43,
-    0x57, 0x26, 0x98, 0xAB, 0x84, 0x7B, 0x67, 0x39, 0x4F, 0x29, 0x7C, 0xBC, 0xC0, 0x17, 0x02, 0xB4,
-    0x30, 0xD3, 0x09, 0x9A, 0x37, 0xDE, 0xE8, 0x8D, 0x38, 0x05, 0xA3, 0xF1, 0xE5, 0x2D, 0xF9, 0x21,
-    0xE2, 0x34, 0x1B, 0x02, 0x19, 0x92, 0x2E, 0xBC, 0x07, 0x4B, 0x44, 0x75, 0xEA, 0x19, 0x4B, 0x63,
-    0xD8, 0x6A, 0x1E, 0xD2, 0x49, 0x39, 0x0B, 0x7C, 0xF3, 0xF3, 0x1D, 0x11, 0xB0, 0x0A, 0x43, 0x60,
-    0x30, 0x76, 0x20, 0x7F, 0x4E, 0xE1, 0x88, 0xAF, 0x13, 0x3C, 0xDE, 0x42, 0x3C, 0xC9, 0x61, 0xCC,
-    0x2C, 0x4B, 0x38, 0x8D, 0x47, 0x71, 0x1A, 0x8E, 0xE0, 0xD4, 0x9F, 0xC2, 0x8D, 0xFE, 0x32, 0x1E,
-    0xE9, 0xA1, 0xA5, 0xC3, 0x1D, 0x77, 0xDB, 0x22, 0x2C, 0xCD, 0x7D, 0x9C, 0xBC, 0xAF, 0x71, 0xF2,
-    0xEF, 0x60, 0xD1, 0xE0, 0x36, 0xD6, 0x0B, 0x6E, 0x62, 0xA9, 0xE8, 0x16, 0x34, 0x69, 0x21, 0xF2,
-    0x49, 0x07, 0x7B, 0x17, 0x23, 0x82, 0xD4, 0xD5, 0xF3, 0xA5, 0x17, 0xEC, 0x86, 0x0C, 0x67, 0x80,
-    0x58, 0x79, 0x56, 0x66, 0xA6, 0x8B, 0xAE, 0xF7, 0x8B, 0x78, 0xFA, 0xB9, 0x63, 0x45, 0x5D, 0xB4,
-    0x0B, 0x80, 0x54, 0xC0, 0x48, 0x54, 0x41, 0x81, 0xD3, 0xCF, 0x6C, 0x60, 0x04, 0xE1, 0xE9, 0xD4,
-    0x14, 0xAD, 0xFF, 0xB0, 0x0F, 0xEB, 0x2B, 0xB6, 0xBC, 0x12, 0xE7, 0x7D, 0x7C, 0xAC, 0x8B, 0x5F,
-    0x6D, 0xED, 0xE7, 0x75, 0x88, 0xFB, 0x70, 0x56, 0x3A, 0x2E, 0x8C, 0x5E, 0x1D, 0x58, 0x36, 0x7E,
-    0x15, 0xE6, 0x88, 0xCE, 0xCE, 0x24, 0x95, 0xCB, 0x83, 0x21, 0xEA, 0x0C, 0x5D, 0xD7, 0x36, 0x49,
-    0x15, 0x75, 0x71, 0xA3, 0x47, 0x1B, 0xD7, 0x3C, 0xBC, 0x3A, 0xA8, 0xCC, 0x77, 0x3F, 0x5E, 0x35,
-    0xB9, 0x82, 0xC3, 0x92, 0xD8, 0x2F, 0x80, 0x29, 0x02, 0x4A, 0xC2, 0xF0, 0x34, 0x2B, 0xAF, 0x42,
-    0x30, 0x62, 0x0A, 0x0F, 0x5E, 0xA5, 0x93, 0x3B, 0xEA, 0xBC, 0xA4, 0xAF, 0x77, 0x10, 0xDC, 0x03,
-    0xF4, 0xE4, 0x71, 0x8E, 0xAB, 0xB6, 0x85, 0x63, 0xD9, 0x32, 0x90, 0xE3, 0xD2, 0x02, 0x25, 0x1F,
-    0x35, 0x4E, 0x90, 0x45, 0x96, 0xA6, 0xC7, 0xED, 0x0D, 0x6A, 0xAD, 0x0D, 0x9A, 0xD3, 0xF8, 0xF3,
-    0x9A, 0x21, 0xE6, 0xC1, 0xB3, 0x2C, 0x01, 0x1A, 0x2B, 0x1D, 0x78, 0xEB, 0xBF, 0x26, 0xE8, 0xEE,
-    0x26, 0x23, 0x42, 0x24, 0xBF, 0x99, 0xA9, 0xF0, 0x7B, 0x32, 0x47, 0x66, 0x92, 0x99, 0xEA, 0xEE,
-    0x14, 0x20, 0x29, 0x33, 0x31, 0x15, 0x33, 0xA9, 0x90, 0xD9, 0x24, 0x3A, 0x64, 0xA6, 0xE8, 0x90,
-    0x59, 0xAF, 0x42, 0x66, 0x67, 0x0A, 0x82, 0x20, 0x70, 0x40, 0xD2, 0x38, 0xF7, 0x3A, 0xFB, 0xB7,
-    0x9E, 0xD0, 0x69, 0x5A, 0xBB, 0x2E, 0xAD, 0x2D, 0x17, 0xBC, 0xCE, 0x09, 0x44, 0xE7, 0x04, 0x10,
-    0x5D, 0x9D, 0x0A, 0xA3, 0x42, 0x4E, 0xDD, 0x1A, 0xBF, 0x57, 0xD1, 0x15, 0x5F, 0x11, 0x14, 0xD9,
-    0x1F, 0x97, 0x79, 0xD5, 0x32, 0x6F, 0x41, 0xF4, 0x02, 0x00, 0xC7, 0x6C, 0xC8, 0xCF, 0xBE, 0xEF,
-    0xC9, 0xEC, 0xE3, 0x4E, 0x51, 0x4E, 0x92, 0xE1, 0x79, 0xF8, 0xAD, 0xBD, 0x3D, 0xCD, 0x78, 0x32,
-    0x99, 0x96, 0x83, 0xEC, 0x74, 0xE4, 0xC5, 0x5E, 0xC3, 0x33, 0x90, 0x5C, 0xAF, 0xFE, 0x9C, 0x10,
-    0x0F, 0xAD, 0x84, 0x35, 0xC4, 0xC2, 0x4E, 0xAF, 0x9A, 0xD3, 0xD0, 0xB3, 0x59, 0x2D, 0x6D, 0x1E,
-    0xC8, 0x09, 0x69, 0x30, 0xEA, 0x51, 0x03, 0x2D, 0x5C, 0x85, 0x9E, 0x11, 0x60, 0x71, 0x3E, 0xE9,
-    0xB9, 0x99, 0xF4, 0x3C, 0x4C, 0x7A, 0x4E, 0x72, 0xD5, 0x73, 0x38, 0xE9, 0x59, 0x75, 0x31, 0xE9,
-    0x8D, 0x6A, 0x0C, 0x66, 0x7A, 0xDE, 0x33, 0x73, 0x08, 0x8E, 0x52, 0x3E, 0xA0, 0x08, 0xB1, 0xC7,
-    0xD8, 0xCE, 0x97, 0xF2, 0x00, 0xFE, 0xCC, 0xC3, 0x06, 0xF2, 0x16, 0x24, 0x03, 0xCC, 0x26, 0x51,
-    0xBD, 0xBF, 0xB8, 0x80, 0x0C, 0x97, 0x48, 0x9E, 0xED, 0xF4, 0xAB, 0xA7, 0xF5, 0x9C, 0xE9, 0xA6,
-    0xD5, 0x9B, 0x03, 0x3D, 0x7B, 0x85, 0x5E, 0xFF, 0xD1, 0xF6, 0x83, 0x8B, 0x8A, 0x40, 0xA2, 0x16,
-    0x55, 0xA4, 0xCC, 0x5A, 0x7D, 0x5A, 0x03, 0xB9, 0x60, 0xD6, 0xEB, 0x79, 0x33, 0xBA, 0xA3, 0x16,
-    0x55, 0xF3, 0xB6, 0x09, 0xDD, 0xB5, 0x64, 0x36, 0x1C, 0x38, 0x32, 0xFA, 0xE6, 0x9F, 0x7B, 0x2A,
-    0x14, 0x19, 0x93, 0x59, 0xBC, 0x32, 0xF1, 0x7F, 0xAF, 0x60, 0x24, 0x01, 0x83, 0xFE, 0x10, 0x22,
-    0xAC, 0x4A, 0x93, 0x3C, 0x04, 0xFC, 0x46, 0x04, 0xD0, 0xD4, 0x49, 0xB3, 0xBD, 0xFE, 0x45, 0x33,
-    0xF9, 0xC4, 0x5C, 0x4E, 0xC7, 0xA4, 0x1A, 0xD0, 0x09, 0xCD, 0x5E, 0xF3, 0x0F, 0x23, 0x66, 0x32,
-    0x29, 0x52, 0x7F, 0x4E, 0xFC, 0x65, 0x50, 0x52, 0xC0, 0xD5, 0xCE, 0x99, 0xFC, 0xC9, 0x8B, 0xA9,
-    0xBE, 0x1E, 0xB5, 0xEF, 0x92, 0x4C, 0x6C, 0xD2, 0xF7, 0xBE, 0xA5, 0x36, 0x23, 0xE5, 0x60, 0xBB,
-    0x90, 0x66, 0xCD, 0xCC, 0xC1, 0x79, 0xDA, 0x4E, 0xAC, 0x3C, 0x45, 0xD3, 0x49, 0x74, 0x8F, 0x61,
-    0xEA, 0x78, 0xD3, 0xEF, 0x78, 0x33, 0x5E, 0xA7, 0x98, 0x03, 0x08, 0x27, 0xBC, 0x36, 0x26, 0x73,
-    0x48, 0x71, 0xD3, 0x1F, 0x56, 0x18, 0x3B, 0xEA, 0xD3, 0x10, 0x10, 0xF9, 0xE6, 0x9B, 0x95, 0xD5,
-    0x9A, 0x8E, 0x5C, 0x94, 0x70, 0x4D, 0x8F, 0xE4, 0xD4, 0x44, 0xE3, 0x6B, 0x80, 0x1F, 0x91, 0x55,
-    0xA9, 0x2C, 0x1F, 0xF4, 0xD6, 0x7E, 0x4A, 0x15, 0xDC, 0xE0, 0x84, 0x12, 0xEB, 0xBE, 0x9D, 0xFA,
-    0xF9, 0x8E, 0x20, 0x55, 0xCE, 0x67, 0x55, 0xE9, 0x0C, 0x52, 0x13, 0x4E, 0x0E, 0x41, 0x01, 0xFD,
-    0x4D, 0xBA, 0x85, 0xBD, 0xC5, 0x9B, 0xD7, 0x28, 0x60, 0xD8, 0xD0, 0x93, 0xDD, 0xF1, 0x81, 0x30,
-    0x09, 0x86, 0x84, 0xA8, 0xE5, 0xC8, 0x62, 0x05, 0xCA, 0xA1, 0xDA, 0x54, 0x83, 0x83, 0xF1, 0x86,
-    0x95, 0x37, 0x3B, 0xC6, 0x39, 0x38, 0x1D, 0x06, 0x64, 0x25, 0xD4, 0xE7, 0xCB, 0xBF, 0xE1, 0x4E,
-    0x81, 0x6C, 0xDE, 0x06, 0xA2, 0x3A, 0x58, 0xD0, 0xD0, 0xD0, 0xCC, 0x1E, 0x5F, 0xE0, 0xEF, 0x4B,
-    0x64, 0xBE, 0x7E, 0x75, 0x99, 0x4A, 0xD9, 0xE0, 0x65, 0x3B, 0x6C, 0x3D, 0xF7, 0xC4, 0x23, 0x06,
-    0xA2, 0x13, 0x47, 0x98, 0x39, 0x27, 0xF1, 0xB3, 0xF1, 0xA3, 0x5E, 0x25, 0xA8, 0x03, 0x35, 0x60,
-    0x96, 0xB2, 0x0E, 0xF0, 0xBF, 0xE9, 0xCD, 0x8B, 0x14, 0xE9, 0x7D, 0x1D, 0xEB, 0xF5, 0x4A, 0x61,
-    0x11, 0x6A, 0xE3, 0xBF, 0xAC, 0xA9, 0x55, 0x45, 0x58, 0x31, 0xD4, 0x4E, 0x09, 0x52, 0x31, 0x6D,
-    0x28, 0x94, 0x89, 0xD4, 0x2A, 0x15, 0x49, 0xC9, 0x37, 0x20, 0x10, 0xB2, 0x0A, 0x2B, 0x8F, 0x25,
-    0x02, 0xA5, 0x6D, 0x7C, 0x26, 0x39, 0xAF, 0xF8, 0x8A, 0xB5, 0x02, 0x06, 0x43, 0x04, 0x27, 0xB9,
-    0x4C, 0xE3, 0x16, 0x3F, 0xA4, 0x5B, 0x61, 0x28, 0x44, 0xCC, 0x23, 0x39, 0x0F, 0xFE, 0x00, 0xC4,
-    0x8C, 0x48, 0xD9, 0x5D, 0x65, 0x96, 0x7C, 0x84, 0xF5, 0xB2, 0xA5, 0xB6, 0xB2, 0x72, 0xE6, 0x7F,
-    0x96, 0x8B, 0x6B, 0xA6, 0xE6, 0x96, 0x02, 0x99, 0xE9, 0xFA, 0xED, 0x04, 0xE9, 0xA1, 0x74, 0xE3,
-    0x3F, 0x8D, 0x9C, 0xAA, 0xE1, 0x89, 0x42, 0x41, 0x8B, 0x1E, 0xB5, 0xFF, 0xEC, 0xDC, 0x02, 0xDE,
-    0x55, 0xA5, 0xB9, 0xDC, 0x66, 0x3A, 0xAB, 0x38, 0xF6, 0xEE, 0x86, 0xFB, 0x29, 0x51, 0x18, 0x05,
-    0xC7, 0x48, 0x61, 0x25, 0x51, 0x9C, 0x7C, 0x7B, 0x67, 0x54, 0x58, 0x6A, 0x94, 0x96, 0x00, 0xCF,
-    0x7A, 0xF4, 0x51, 0x87, 0x02, 0x01, 0x79, 0x87, 0x8E, 0x9C, 0xD2, 0x65, 0x40, 0xCE, 0x95, 0xE0,
-    0xA8, 0x99, 0xA9, 0x3D, 0x4F, 0x77, 0x5B, 0x50, 0x71, 0x6E, 0xFB, 0x4E, 0x0F, 0x98, 0xF6, 0x54,
-    0x5D, 0x45, 0x0E, 0x43, 0x00, 0xBD, 0x5B, 0x13, 0x8F, 0x45, 0x4F, 0x65, 0x52, 0x49, 0x22, 0xE9,
-    0xF6, 0x8A, 0x3F, 0x36, 0x33, 0x99, 0x4D, 0xA6, 0x9B, 0xE7, 0x16, 0x0A, 0xDA, 0xE5, 0x19, 0xF3,
-    0x44, 0x05, 0x0B, 0xA9, 0x9C, 0x90, 0x46, 0x89, 0x68, 0x90, 0xE8, 0x6B, 0x86, 0x56, 0x93, 0x30,
-    0x1A, 0xFC, 0xF4, 0xC9, 0x08, 0xB6, 0x98, 0xFF, 0x8A, 0xA6, 0x45, 0xF8, 0x06, 0x03, 0x43, 0xFF,
-    0x1A, 0x13, 0xF4, 0x1E, 0xB3, 0x53, 0x1A, 0xE2, 0x50, 0xAF, 0x03, 0x30, 0xDF, 0xF9, 0x82, 0x0E,
-    0x0B, 0x12, 0x1C, 0x37, 0x5E, 0xCB, 0xBD, 0xBC, 0x6B, 0x7C, 0x35, 0xFC, 0x04, 0x27, 0xFF, 0xF3,
-    0x21, 0x2B, 0x01, 0x21, 0x5D, 0x21, 0xEB, 0xD9, 0x71, 0xA7, 0xC4, 0x9C, 0x80, 0xA6, 0xCB, 0x06,
-    0xF4, 0x6D, 0x09, 0x8B, 0x01, 0xEE, 0x3C, 0xD9, 0x40, 0x5D, 0xC6, 0x6D, 0x06, 0x0A, 0x75, 0x5B,
-    0xB6, 0x1B, 0xA6, 0x24, 0x15, 0xC2, 0x09, 0x75, 0xF2, 0xB7, 0x77, 0x88, 0x52, 0x05, 0x2A, 0x47,
-    0xC9, 0x29, 0x14, 0xCF, 0xE0, 0xED, 0x74, 0x76, 0xCB, 0x74, 0x5F, 0xA9, 0xE3, 0x52, 0xC3, 0x54,
-    0x11, 0x16, 0xE6, 0x43, 0x04, 0x44, 0x40, 0x1E, 0x67, 0x02, 0x1E, 0xB3, 0x78, 0x72, 0xB2, 0x85,
-    0xDC, 0x95, 0x56, 0x0B, 0x5C, 0xA9, 0x00, 0x34, 0x0C, 0xBB, 0x5C, 0xE4, 0x71, 0x2F, 0x46, 0xB6,
-    0x81, 0x50, 0xF1, 0x88, 0xEA, 0xF7, 0xD9, 0x71, 0x38, 0x8D, 0x92, 0xEC, 0x27, 0x5B, 0xCB, 0xF1,
-    0x41, 0x62, 0x11, 0x85, 0xE1, 0x54, 0xB0, 0xA0, 0xCE, 0x4E, 0x1C, 0xE4, 0x82, 0x34, 0x2B, 0x65,
-    0xE0, 0x12, 0x5C, 0x91, 0x02, 0xF0, 0xC8, 0x66, 0xBC, 0x0B, 0x96, 0xF1, 0x88, 0x76, 0x70, 0x06,
-    0x5D, 0xD3, 0xCF, 0x7F, 0x6D, 0x50, 0x9A, 0x98, 0xE4, 0xCE, 0x80, 0x64, 0xD3, 0x21, 0x1D, 0xA4,
-    0x7F, 0xB7, 0xB5, 0xBC, 0x77, 0xFE, 0x40, 0xA7, 0xC6, 0x9F, 0x81, 0xA2, 0xD5, 0x92, 0xFC, 0x3B,
-    0xB8, 0xA2, 0x6D, 0x42, 0x51, 0xBF, 0xED, 0x38, 0x91, 0x94, 0xD0, 0x4A, 0xC8, 0x4E, 0x0C, 0xB4,
-    0x80, 0x45, 0x83, 0x81, 0xBD, 0x8B, 0x6C, 0x1D, 0xCF, 0xE3, 0xAA, 0x30, 0xC3, 0x61, 0x59, 0x4B,
-    0x54, 0x9C, 0xD2, 0x9C, 0xAB, 0x31, 0x00, 0x18, 0xE6, 0x6A, 0x90, 0x5F, 0xED, 0x3E, 0x84, 0x8A,
-    0xE7, 0x38, 0xAD, 0x6D, 0x5B, 0x69, 0xEA, 0x99, 0x48, 0x98, 0xCE, 0xB3, 0xB3, 0x59, 0x2A, 0x18,
-    0xF0, 0xDF, 0x4F, 0xCF, 0x33, 0xAB, 0xA2, 0x7C, 0x90, 0x1C, 0x0C, 0x15, 0x09, 0xC0, 0x83, 0x90,
-    0x45, 0x6A, 0x1C, 0x7B, 0x06, 0x88, 0xBA, 0x1C, 0x54, 0x3A, 0x14, 0xF6, 0x3C, 0x50, 0x29, 0x91,
-    0x7B, 0x8F, 0x90, 0x0F, 0x1B, 0x7F, 0xAB, 0x05, 0x61, 0x8F, 0x6F, 0x8C, 0x24, 0xDB, 0x4D, 0x76,
-    0x03, 0xB7, 0x3B, 0xDB, 0xE1, 0xF6, 0xE0, 0x0B, 0x6F, 0x43, 0x05, 0xB8, 0x5D, 0x46, 0x64, 0xC7,
-    0x0D, 0xB3, 0x3D, 0x4B, 0x15, 0xE4, 0xEA, 0x31, 0x0D, 0x29, 0x37, 0x36, 0x94, 0x73, 0x3E, 0x2D,
-    0xDF, 0xB4, 0xED, 0x32, 0xFB, 0x28, 0x98, 0x92, 0x78, 0x63, 0xBF, 0x94, 0x3E, 0xD1, 0xEC, 0x50,
-    0x68, 0xBE, 0xDC, 0x62, 0x3D, 0x8B, 0xE7, 0x34, 0x63, 0xB4, 0x1A, 0x86, 0x08, 0x99, 0x47, 0xEC,
-    0xD3, 0x54, 0x00, 0x5B, 0xB6, 0x7D, 0x4A, 0x50, 0xFD, 0xA4, 0x75, 0xF4, 0xDC, 0xB8, 0xC5, 0x2C,
-    0xEF, 0x43, 0xA8, 0xEC, 0x36, 0x6C, 0x1A, 0xB7, 0xB8, 0x1D, 0x0D, 0x8E, 0x29, 0x90, 0x59, 0x40,
-    0xCE, 0xD2, 0xC3, 0x2B, 0x5C, 0x74, 0x0D, 0x96, 0x71, 0x88, 0xB8, 0x1C, 0x99, 0xB5, 0x60, 0xD8,
-    0x45, 0xC4, 0x19, 0x54, 0x90, 0x6B, 0xDF, 0x65, 0xF5, 0x27, 0xE7, 0x00, 0xAF, 0xE2, 0x91, 0xAE,
-    0x23, 0x2C, 0x53, 0x25, 0x65, 0x4F, 0x5E, 0x3A, 0x25, 0x8D, 0x49, 0x33, 0xE7, 0x8C, 0xC9, 0xAD,
-    0x7A, 0x46, 0x19, 0xA3, 0xF4, 0x07, 0x4F, 0x52, 0x3A, 0x6F, 0xE2, 0x8A, 0x47, 0x08, 0x5F, 0xC5,
-    0x9C, 0x2A, 0x9E, 0x74, 0xBB, 0x00, 0x95, 0x0D, 0x0F, 0xA2, 0x76, 0xC5, 0x68, 0x21, 0x4A, 0x6C,
-    0x10, 0xEE, 0xD3, 0xA4, 0x43, 0x8A, 0x0E, 0x84, 0x54, 0x5D, 0x97, 0x8B, 0x5B, 0xA0, 0x45, 0x38,
-    0x62, 0x93, 0x9E, 0xBC, 0x3E, 0x97, 0x2E, 0xA1, 0x74, 0xB6, 0xA7, 0x74, 0xA3, 0x25, 0xDF, 0x7A,
-    0x55, 0x98, 0xDE, 0x8B, 0x1A, 0x27, 0x3B, 0x22, 0x28, 0x7D, 0x8D, 0x11, 0x6D, 0x0B, 0x7A, 0x85,
-    0x9A, 0x6B, 0x5A, 0xFB, 0x59, 0x9F, 0xBD, 0xB5, 0xDB, 0x0C, 0xF0, 0x86, 0x51, 0xDF, 0x51, 0xA6,
-    0x7D, 0xDB, 0xEE, 0xF8, 0x4E, 0xAA, 0x0C, 0x25, 0x65, 0xF6, 0x41, 0xA6, 0x90, 0x0B, 0x42, 0xB2,
-    0x50, 0xD4, 0x58, 0xC4, 0xF6, 0xD1, 0x30, 0x5B, 0x29, 0xFB, 0x04, 0x4F, 0xC4, 0x1D, 0x30, 0x20,
-    0xA4, 0x86, 0x26, 0xC1, 0x0A, 0x0A, 0xE6, 0x1A, 0x0A, 0xD6, 0xE1, 0x62, 0x34, 0xD8, 0x5E, 0xF7,
-    0x81, 0xFA, 0x0D, 0x25, 0x07, 0x98, 0x66, 0xA4, 0xD9, 0x46, 0x79, 0xC6, 0xA2, 0x3C, 0x9C, 0x69,
-    0xE9, 0x29, 0xF3, 0x62, 0x9C, 0x27, 0x27, 0xBA, 0xA4, 0x2E, 0x2E, 0x20, 0xC2, 0x1B, 0x22, 0x30,
-    0x91, 0x02, 0x65, 0xAB, 0xB4, 0x71, 0x23, 0x27, 0x1A, 0x5B, 0x5F, 0x34, 0xF5, 0x2E, 0x82, 0xFD,
-    0xA1, 0xF9, 0x19, 0x2D, 0xDA, 0x68, 0xB7, 0x43, 0x9B, 0x88, 0x17, 0x68, 0x17, 0x90, 0xE1, 0x7C,
-    0x32, 0xAA, 0x4F, 0x0D, 0x56, 0xC8, 0x1E, 0x88, 0x6E, 0xA0, 0xCA, 0x19, 0x60, 0x47, 0x8F, 0x8A,
-    0xB7, 0xB2, 0x5D, 0x58, 0xF3, 0x1C, 0xA3, 0x92, 0xB3, 0xDD, 0x69, 0x62, 0xCD, 0xA3, 0x16, 0x81,
-    0x69, 0x09, 0x02, 0xA9, 0x95, 0x14, 0xA2, 0x46, 0x8A, 0x36, 0x30, 0x44, 0xA6, 0x86, 0x85, 0x16,
-    0x9D, 0x8A, 0x7C, 0xE5, 0x39, 0xB9, 0x6B, 0xCC, 0x0B, 0x3B, 0xDD, 0x2F, 0x34, 0x5B, 0xE4, 0xC7,
-    0x4E, 0x51, 0x5B, 0x6F, 0xC5, 0xEE, 0x6E, 0xF6, 0x03, 0x39, 0xF1, 0xCF, 0x91, 0xCD, 0x55, 0x60,
-    0x23, 0x19, 0xA5, 0x02, 0xDA, 0x16, 0x6C, 0x0C, 0x21, 0x15, 0xB2, 0xDF, 0x0C, 0xCD, 0x10, 0x6C,
-    0x6D, 0xE3, 0x69, 0x99, 0x0D, 0x7B, 0xC7, 0xDC, 0x81, 0xCF, 0x22, 0x75, 0xEA, 0x4B, 0x07, 0xCA,
-    0x59, 0x5D, 0x8E, 0xB1, 0x40, 0x98, 0x0C, 0x22, 0xC3, 0x54, 0xC7, 0x0A, 0x76, 0xAB, 0x98, 0xFA,
-    0xE9, 0x44, 0xEC, 0xF0, 0x98, 0x5D, 0x2D, 0xE4, 0x79, 0x04, 0x27, 0xC4, 0x92, 0xB8, 0x53, 0xD6,
-    0xB1, 0x55, 0x09, 0xEE, 0x66, 0x42, 0x4F, 0x52, 0x48, 0xAD, 0xC1, 0xC3, 0x09, 0x66, 0x94, 0xA8,
-    0xB1, 0x39, 0x92, 0x94, 0x57, 0xD8, 0xF5, 0xDC, 0xC5, 0x8A, 0x9E, 0x8C, 0x90, 0xBF, 0x5E, 0x64,
-    0x0F, 0xE1, 0x4B, 0x5E, 0x56, 0x82, 0x94, 0xDC, 0xA0, 0x26, 0xD3, 0x3D, 0xFF, 0x28, 0xEA, 0x0B,
-    0xA8, 0x22, 0xD6, 0x41, 0x13, 0xDB, 0x4F, 0xB4, 0x73, 0xC3, 0xCC, 0xB7, 0x4B, 0x77, 0x08, 0xEA,
-    0xD6, 0xB1, 0x59, 0x0F, 0x7F, 0x47, 0x84, 0x16, 0x5C, 0x05, 0x25, 0x8B, 0xB0, 0xE4, 0x4C, 0x6A,
-    0x24, 0xBF, 0xA0, 0x27, 0xF1, 0x93, 0xD7, 0xE1, 0xC6, 0xC9, 0x06, 0xAB, 0x2A, 0xB5, 0x85, 0x52,
-    0x17, 0x75, 0x1D, 0x12, 0x04, 0xA6, 0xE5, 0xA9, 0x9F, 0xBE, 0x93, 0x68, 0x46, 0xC4, 0x18, 0x25,
-    0x01, 0x76, 0xEA, 0x06, 0xCF, 0xB9, 0x13, 0xE6, 0x18, 0x39, 0x66, 0x9E, 0x36, 0x62, 0xEE, 0x20,
-    0xC3, 0x35, 0x7F, 0x7C, 0x6E, 0xC0, 0x58, 0x66, 0xF6, 0x32, 0xA6, 0x42, 0xB2, 0x32, 0xEA, 0x91,
-    0xEA, 0x5D, 0x6D, 0xA9, 0x29, 0xC0, 0xC6, 0xB0, 0x4A, 0x1C, 0x50, 0xC8, 0x58, 0x9B, 0x58, 0x24,
-    0x85, 0xD0, 0xBE, 0xF7, 0x16, 0x9D, 0x7A, 0x47, 0xFD, 0x46, 0x2B, 0xA3, 0x84, 0x33, 0x9B, 0xE2,
-    0x77, 0x7C, 0x70, 0x64, 0xA3, 0x0A, 0xB5, 0x14, 0x49, 0x4D, 0xC7, 0x3E, 0x50, 0xD8, 0x22, 0x9F,
-    0x43, 0x43, 0x6C, 0x93, 0xD9, 0x26, 0x66, 0x59, 0xD6, 0x68, 0xBF, 0xAE, 0xD6, 0x79, 0x2B, 0xCD,
-    0x1E, 0x25, 0x49, 0x8D, 0x2B, 0x1D, 0x1B, 0x82, 0x39, 0x23, 0x3A, 0x4B, 0xE9, 0x92, 0x45, 0x4A,
-    0x22, 0x57, 0xEC, 0xF1, 0x46, 0x16, 0xD6, 0x9C, 0x6D, 0x74, 0x28, 0x96, 0xBD, 0x01, 0xB6, 0xC6,
-    0x22, 0x96, 0xA4, 0xAF, 0x27, 0xBE, 0xEA, 0x2B, 0x97, 0x3D, 0xCA, 0x38, 0x0E, 0x6B, 0x91, 0xED,
-    0xB4, 0xE0, 0x9D, 0x7A, 0x9D, 0xD1, 0xDD, 0xDD, 0x11, 0xC9, 0xD5, 0x59, 0xF0, 0x93, 0x78, 0x69,
-    0x2B, 0xD0, 0x6B, 0x14, 0x0E, 0xA7, 0xCF, 0x1B, 0x1E, 0x32, 0xD5, 0x67, 0x0D, 0x49, 0xBD, 0x27,
-    0x7F, 0x06, 0x31, 0x62, 0xB7, 0x38, 0x75, 0x39, 0x74, 0x55, 0xC5, 0xB5, 0x6D, 0xA2, 0x26, 0xEC,
-    0x83, 0x1E, 0x4A, 0x11, 0x8F, 0xE6, 0x13, 0x94, 0xE6, 0x9B, 0x8F, 0xEE, 0x48, 0x2F, 0x5D, 0xD1,
-    0x3B, 0xF0, 0x12, 0x08, 0x31, 0x03, 0xAA, 0x17, 0x66, 0x69, 0x92, 0x96, 0xA5, 0x50, 0xE1, 0xD4,
-    0x3E, 0x34, 0x66, 0x67, 0xBD, 0xFB, 0xD8, 0x96, 0xDB, 0x9B, 0x4F, 0x0E, 0x41, 0x90, 0x09, 0x37,
-    0x90, 0xB8, 0xEA, 0x8E, 0x8D, 0x0D, 0x63, 0xFE, 0xE2, 0xCF, 0xC0, 0x7B, 0x79, 0x01, 0xF6, 0x5A,
-    0x25, 0x89, 0xAB, 0xC3, 0x31, 0x6B, 0x02, 0xBE, 0x8C, 0x19, 0xB4, 0x0D, 0x9E, 0xA5, 0xEC, 0x92,
-    0x27, 0xF0, 0x06, 0xDB, 0xD8, 0x2E, 0xE8, 0xA1, 0x7B, 0x44, 0x54, 0xEA, 0x6E, 0xDC, 0xDB, 0xF8,
-    0x40, 0x1E, 0xC8, 0x97, 0xD2, 0x20, 0xB6, 0xEA, 0xB8, 0x9A, 0xA5, 0xB2, 0x73, 0x4F, 0xC1, 0xAD,
-    0x4E, 0xE4, 0xEA, 0x64, 0x47, 0x60, 0xB3, 0x45, 0x7F, 0x47, 0x96, 0x58, 0x48, 0xF7, 0x83, 0x7A,
-    0x17, 0x5A, 0x86, 0xC4, 0x0F, 0x91, 0x14, 0x31, 0x67, 0xD4, 0x06, 0x98, 0xD5, 0x1B, 0xBC, 0x51,
-    0x5B, 0xEF, 0x59, 0x09, 0x53, 0x63, 0x6F, 0x71, 0x0B, 0xB7, 0xC7, 0x52, 0xB6, 0xF8, 0x0F, 0x27,
-    0xB7, 0xE4, 0x7D, 0x04, 0x48, 0x8E, 0xDC, 0x9E, 0x6E, 0x27, 0xC5, 0x0E, 0x55, 0xA4, 0xC0, 0x56,
-    0x0E, 0x75, 0x7E, 0x98, 0x9F, 0xFB, 0x3B, 0xAD, 0x12, 0x6B, 0xF0, 0x40, 0x75, 0xAF, 0x22, 0x68,
-    0xCA, 0x4B, 0xC6, 0x90, 0x3E, 0x24, 0xF4, 0xE3, 0xE1, 0x71, 0x5B, 0xE9, 0x0D, 0xBE, 0x13, 0x73,
-    0x63, 0x24, 0x69, 0xA8, 0x1D, 0x8E, 0xEC, 0x6F, 0x72, 0x1B, 0x23, 0xBD, 0x3E, 0x6A, 0x92, 0xCA,
-    0x56, 0x2E, 0xC7, 0x25, 0xBF, 0x0F, 0xB1, 0x8F, 0x84, 0xF6, 0xD8, 0x24, 0x1B, 0x47, 0x20, 0xC2,
-    0x24, 0x88, 0x44, 0x04, 0x4E, 0x67, 0x2E, 0xC2, 0x2A, 0x4D, 0x5C, 0x8A, 0x24, 0x32, 0xFA, 0xD2,
-    0x38, 0xCD, 0xB6, 0x59, 0x47, 0x9A, 0xB1, 0x67, 0x5A, 0xC1, 0x67, 0xF7, 0x02, 0x03, 0x46, 0x8C,
-    0x62, 0xFB, 0x77, 0xD4, 0xC4, 0x08, 0xA4, 0x81, 0x13, 0x12, 0x47, 0xC4, 0xFC, 0xC4, 0x35, 0x19,
-    0x68, 0xC6, 0x31, 0xCC, 0x1C, 0x8F, 0xCA, 0x9C, 0x9E, 0xD1, 0x3A, 0x83, 0x11, 0xB6, 0xA4, 0x01,
-    0x52, 0x6C, 0xA7, 0xA8, 0x8B, 0x50, 0x10, 0xCA, 0x8D, 0x59, 0x05, 0x46, 0x0C, 0xBE, 0x32, 0xEB,
-    0x54, 0x68, 0xD3, 0x48, 0xB7, 0x02, 0xAD, 0x27, 0xA5, 0xF3, 0x7A, 0x5B, 0x83, 0x03, 0x62, 0x2B,
-    0xEB, 0xD0, 0x05, 0x8B, 0xDC, 0x94, 0xC8, 0xE3, 0xF2, 0x08, 0x92, 0x34, 0x90, 0x97, 0x5B, 0x09,
-    0x01, 0x48, 0x93, 0xEA, 0xD3, 0xE9, 0xDD, 0x6E, 0x36, 0xA1, 0x1B, 0x03, 0x91, 0xEF, 0x04, 0xCA,
-    0xED, 0x3E, 0x31, 0x70, 0xB6, 0x20, 0x15, 0x6A, 0x38, 0xBB, 0x45, 0x29, 0x30, 0xC2, 0xC0, 0x0D,
-    0x14, 0xB3, 0x0E, 0x0B, 0x14, 0xA0, 0x6C, 0x28, 0x57, 0x1E, 0x12, 0x31, 0x22, 0xE8, 0xBD, 0x07,
-    0xF1, 0xAA, 0x03, 0xA5, 0x73, 0xF9, 0x8C, 0x73, 0xFD, 0x54, 0x45, 0x26, 0x71, 0xBE, 0x8A, 0x0A,
-    0xE3, 0x6C, 0x1D, 0xD6, 0x87, 0xCD, 0x8B, 0x33, 0x1F, 0x7E, 0x43, 0xE7, 0xCE, 0xA4, 0x8C, 0x3F,
-    0xED, 0x03, 0xE8, 0x13, 0x53, 0xDB, 0xB2, 0xF0, 0xA1, 0x76, 0x77, 0xAF, 0xE1, 0xCC, 0xEE, 0x2E,
-    0x51, 0xE5, 0xA2, 0x2B, 0x33, 0x4E, 0x0C, 0xFC, 0x56, 0x25, 0xCF, 0x39, 0xC8, 0x99, 0x08, 0x39,
-    0xA3, 0x48, 0xED, 0x97, 0xBD, 0x79, 0x39, 0xD8, 0x6E, 0x91, 0x1E, 0x60, 0xFC, 0xC1, 0x55, 0x50,
-    0xDD, 0x7C, 0xDA, 0x1B, 0x6C, 0x9A, 0x0A, 0x71, 0x7E, 0xCF, 0x79, 0xED, 0xE6, 0xF4, 0xFA, 0x92,
-    0x90, 0x8A, 0x89, 0xE1, 0x98, 0x65, 0xA2, 0xF5, 0x69, 0xA5, 0x33, 0xEB, 0xA6, 0x83, 0x9C, 0xAD,
-    0xBE, 0xB0, 0x83, 0xB6, 0x97, 0x14, 0x91, 0x96, 0x93, 0x4E, 0xFA, 0x37, 0xE1, 0x3F, 0x11, 0x43,
-    0xB3, 0x4E, 0x2A, 0xF8, 0x34, 0x7C, 0xB7, 0xF8, 0x65, 0x31, 0x14, 0x5D, 0x56, 0xED, 0x51, 0x35,
-    0x06, 0x48, 0x61, 0x39, 0x86, 0xD8, 0xDA, 0x5C, 0x33, 0xFE, 0xAC, 0x53, 0xEE, 0xA5, 0xBE, 0x96,
-    0x59, 0x6F, 0xEA, 0x6B, 0xB5, 0x82, 0x3A, 0xB6, 0xAC, 0xB6, 0xA6, 0xEF, 0x2C, 0xF5, 0x87, 0xDF,
-    0x46, 0x52, 0xC1, 0xCB, 0x41, 0x72, 0xF7, 0x69, 0xDB, 0x09, 0x71, 0x13, 0x03, 0xB8, 0x3B, 0xBB,
-    0xDE, 0x0C, 0xC1, 0x27, 0xF9, 0xC2, 0x94, 0xEA, 0xC0, 0x40, 0xA5, 0x3C, 0x38, 0xB2, 0xFF, 0x04,
-    0x13, 0x89, 0x16, 0x57, 0xD5, 0xF4, 0xCD, 0x79, 0x7F, 0xE9, 0x4B, 0x1B, 0x21, 0x06, 0xDB, 0x99,
-    0xD5, 0x92, 0xE0, 0x8B, 0xC1, 0x7D, 0xDC, 0x8C, 0x7B, 0xE7, 0x98, 0xB0, 0xDF, 0x90, 0x57, 0x37,
-    0x0B, 0x05, 0x25, 0x44, 0xA2, 0x84, 0x03, 0x8D, 0x4C, 0xC9, 0xFA, 0xCD, 0x49, 0xFF, 0x9A, 0x16,
-    0x28, 0xE4, 0x6A, 0x60, 0xCE, 0x3C, 0x22, 0xBD, 0xE6, 0x24, 0xAC, 0xC8, 0x2A, 0x90, 0x39, 0x91,
-    0xED, 0x01, 0x14, 0x04, 0x1F, 0xC0, 0x3D, 0x67, 0x6F, 0x49, 0x22, 0xAD, 0x21, 0x7B, 0xA8, 0xB9,
-    0x0F, 0x86, 0xB0, 0xB7, 0x08, 0xF0, 0xB8, 0x46, 0xC4, 0x54, 0x41, 0xEF, 0x4A, 0x10, 0xEB, 0x32,
-    0x6C, 0x1D, 0x10, 0x81, 0xC1, 0xE9, 0xEA, 0x0C, 0x5A, 0x26, 0xC3, 0x24, 0x83, 0xAE, 0x67, 0x6A,
-    0x06, 0x80, 0x99, 0xEC, 0x53, 0x14, 0xC8, 0x4C, 0x5C, 0xE4, 0xCD, 0x0B, 0xBB, 0x11, 0x6C, 0xC1,
-    0xC4, 0x63, 0x34, 0x04, 0x72, 0x47, 0x9A, 0x83, 0x23, 0x8D, 0x29, 0x24, 0x0E, 0x25, 0x79, 0x03,
-    0x69, 0x83, 0xDF, 0xEB, 0xAB, 0xC5, 0xB0, 0x0B, 0x3B, 0x28, 0x14, 0x5E, 0x00, 0xDB, 0x30, 0x4E,
-    0x0F, 0x01, 0x0A, 0x64, 0x1D, 0x50, 0x83, 0xE5, 0xA3, 0x6E, 0xFB, 0x85, 0x47, 0x38, 0x4B, 0x3A,
-    0x33, 0x44, 0x61, 0x4C, 0x7A, 0x4C, 0x55, 0xF9, 0xDC, 0xCD, 0x3D, 0x64, 0xEE, 0x44, 0xE0, 0xC1,
-    0xAB, 0x6D, 0x5C, 0x27, 0x28, 0x0F, 0xB2, 0x9B, 0x08, 0x7C, 0xEE, 0x07, 0x6B, 0xDF, 0x01, 0x93,
-    0x79, 0xBD, 0xE1, 0xD6, 0xE2, 0x1A, 0x21, 0xEB, 0xCB, 0x05, 0xF6, 0x6B, 0xA6, 0xDD, 0x2C, 0x6F,
-    0x25, 0x9A, 0x53, 0x13, 0x1F, 0xF6, 0xFB, 0xA9, 0x53, 0xA8, 0x39, 0x67, 0x67, 0x9A, 0x61, 0xFE,
-    0x2F, 0x91, 0xCF, 0x1B, 0x2E, 0x12, 0x76, 0x51, 0x0F, 0x37, 0xDB, 0xA1, 0xB5, 0x10, 0x5A, 0x8B,
-    0xE6, 0x5A, 0xAB, 0xF9, 0x72, 0x3A, 0x79, 0x24, 0xCA, 0x28, 0x74, 0x9D, 0xFD, 0xF3, 0x0C, 0x23,
-    0xA9, 0x26, 0x98, 0x33, 0x57, 0x91, 0x5B, 0xA0, 0x05, 0x64, 0xCE, 0xB7, 0xFD, 0xAD, 0x15, 0x32,
-    0x21, 0x6F, 0x37, 0xC5, 0x67, 0x03, 0x17, 0xC0, 0x44, 0xF7, 0xE1, 0xDE, 0x1F, 0x83, 0x53, 0x70,
-    0x7E, 0x31, 0x09, 0x8A, 0x1F, 0xA1, 0x77, 0x73, 0xFA, 0x62, 0x03, 0x7F, 0x50, 0xA2, 0x6E, 0x36,
-    0x3B, 0x6C, 0x12, 0x0C, 0x87, 0xB1, 0x24, 0xAA, 0x00, 0x14, 0x35, 0xBB, 0x72, 0xCA, 0xE3, 0x90,
-    0x5E, 0xDF, 0x7F, 0x9D, 0x36, 0x16, 0x32, 0xD9, 0xFB, 0xC3, 0xEE, 0x6C, 0xF2, 0x18, 0xE6, 0xF7,
-    0x26, 0xDD, 0xBB, 0x52, 0xC1, 0x6C, 0xEA, 0xD3, 0x66, 0x22, 0x7F, 0x05, 0x6F, 0x3C, 0xB0, 0xB2,
-    0xA2, 0x98, 0x03, 0x14, 0x0D, 0xA6, 0x47, 0xD4, 0xFA, 0x0B, 0xE9, 0x3E, 0x78, 0xF6, 0xD7, 0x53,
-    0xFF, 0x37, 0x1A, 0x32, 0x90, 0xCE, 0x3C, 0x03, 0xAA, 0xA0, 0x12, 0x82, 0xDF, 0xC2, 0xE8, 0xE1,
-    0xE7, 0xB0, 0xFA, 0x29, 0xF0, 0xA1, 0xCD, 0xEB, 0xA0, 0xA9, 0x3D, 0x7D, 0x2C, 0xCF, 0x72, 0x40,
-    0x29, 0x22, 0x78, 0x2C, 0x4A, 0x7D, 0xF1, 0x66, 0x4F, 0x20, 0x3E, 0x5E, 0xD8, 0xEE, 0x2C, 0x1D,
-    0xA2, 0xBB, 0xD5, 0xB3, 0x52, 0x48, 0x49, 0xA3, 0xBE, 0xBF, 0x4E, 0x76, 0xD0, 0x56, 0xC4, 0xF5,
-    0x72, 0xAC, 0x09, 0x1E, 0x89, 0xEB, 0x20, 0xB3, 0x25, 0x80, 0xA8, 0xF2, 0x91, 0x85, 0x26, 0xAF,
-    0x6E, 0xE9, 0xD5, 0x86, 0x2F, 0x78, 0xE3, 0x06, 0x88, 0x4B, 0x69, 0x8A, 0xE6, 0x78, 0x9F, 0x64,
-    0xA7, 0x12, 0xF9, 0x58, 0xD6, 0xA5, 0xC9, 0xC8, 0x11, 0xBA, 0xB9, 0x73, 0x13, 0x3B, 0xA2, 0x7C,
-    0x7A, 0xA1, 0xAB, 0xD9, 0x41, 0xC9, 0xB0, 0xAE, 0x6C, 0xB6, 0x8A, 0xDF, 0xC7, 0xBC, 0xE8, 0xDE,
-    0xF9, 0xE6, 0xA8, 0xFD, 0x84, 0xAF, 0x8F, 0xBF, 0x00, 0x2B, 0xEC, 0x20, 0xC6, 0x0F, 0xE6, 0x08,
-    0xBD, 0x6C, 0x16, 0x3C, 0xA6, 0x61, 0xC7, 0x9C, 0xBC, 0x8A, 0x24, 0xED, 0x91, 0xEC, 0x00, 0xDD,
-    0xA9, 0xE1, 0x5E, 0x19, 0x0F, 0x20, 0xB5, 0x65, 0xC2, 0xE6, 0x7B, 0x02, 0xA4, 0x98, 0x48, 0xF6,
-    0x24, 0xEB, 0xDF, 0x7E, 0xBB, 0x2E, 0x7D, 0xD1, 0x27, 0x12, 0x22, 0x9E, 0x73, 0x50, 0xF4, 0x6D,
-    0x16, 0x7F, 0x1A, 0xC9, 0xCA, 0x7E, 0xCD, 0xD7, 0x2E, 0xC0, 0xC1, 0xE8, 0xD8, 0x4E, 0xC0, 0x78,
-    0xBC, 0x1A, 0x55, 0x5C, 0xD0, 0xBE, 0x3F, 0x99, 0xF3, 0xF4, 0xD2, 0x48, 0x9B, 0x57, 0xC4, 0x10,
-    0x73, 0x64, 0x57, 0xE5, 0xC8, 0xFF, 0xF0, 0x00, 0xA4, 0x1A, 0xE0, 0xBF, 0xA0, 0xCA, 0x07, 0xB9,
-    0x1B, 0x98, 0x1E, 0x40, 0x93, 0x1D, 0x03, 0x1A, 0xB8, 0xDF, 0xD1, 0xDF, 0xDE, 0x63, 0xB7, 0xF4,
-    0x2C, 0xA6, 0x4A, 0x6E, 0xB2, 0x9D, 0x78, 0x8B, 0xAF, 0x6B, 0x3E, 0x67, 0x55, 0x25, 0xF3, 0x57,
-    0x64, 0x5A, 0x62, 0xC4, 0xCD, 0xFC, 0xE5, 0x19, 0x14, 0xFA, 0x14, 0xF3, 0x7D, 0x72, 0xA1, 0x9D,
-    0x31, 0x69, 0x47, 0xAE, 0x1E, 0xD5, 0xF3, 0x60, 0xD1, 0x84, 0xA5, 0x25, 0xCA, 0x02, 0xAB, 0x11,
-    0xA5, 0x49, 0xD1, 0xD6, 0xF0, 0x01, 0xE4, 0x20, 0x6C, 0xD8, 0xDE, 0xB9, 0x85, 0xB1, 0xC4, 0xCF,
-    0x60, 0xF3, 0x06, 0x12, 0x30, 0x3D, 0x38, 0x43, 0x02, 0xF3, 0xC9, 0xCF, 0x6C, 0xA3, 0xDA, 0x89,
-    0x2B, 0x65, 0x6B, 0x11, 0x55, 0x84, 0x54, 0x0B, 0xA7, 0xDE, 0xD0, 0xDE, 0x42, 0x65, 0xE2, 0x7B,
-    0xDD, 0xF4, 0x1F, 0xA8, 0x26, 0x2F, 0x6E, 0x66, 0xFF, 0x45, 0x89, 0x5D, 0x3E, 0x7D, 0x59, 0xE2,
-    0x9D, 0x3F, 0xBF, 0xA3, 0xBC, 0x7A, 0x8F, 0x92, 0xDE, 0xE4, 0x46, 0x7F, 0x8F, 0x5F, 0xCF, 0xFB,
-    0x6B, 0x4F, 0x54, 0x49, 0xFF, 0x0F, 0xCD, 0x5B, 0x4D, 0xB0, 0xDE, 0xD4, 0x79, 0x3E, 0x92, 0x7C,
-    0x2D, 0x40, 0xC3, 0xC8, 0x0B, 0x9B, 0x42, 0xA0, 0xA8, 0x0B, 0x16, 0x24, 0x43, 0xD0, 0xA6, 0x8B,
-    0x2E, 0x8C, 0x8F, 0x88, 0x67, 0xCA, 0xA2, 0x0B, 0x6E, 0x67, 0xF8, 0xE9, 0x84, 0xA1, 0x64, 0xC1,
-    0xA6, 0xB4, 0x33, 0x37, 0x8B, 0x2E, 0xB2, 0x00, 0xA4, 0xC2, 0x4C, 0xB3, 0xC8, 0xC2, 0x9E, 0x4E,
-    0xDB, 0x4D, 0x16, 0x75, 0x67, 0x58, 0x04, 0x33, 0x13, 0xB3, 0xC8, 0x82, 0xCE, 0x60, 0x4B, 0xD8,
-    0x0B, 0x16, 0x2C, 0xA2, 0x84, 0xA1, 0x2C, 0xB2, 0x40, 0x09, 0x4E, 0x3B, 0x63, 0x2F, 0xAE, 0x12,
-    0x0B, 0x90, 0x6D, 0x49, 0x6F, 0x9F, 0xE7, 0x3D, 0xD2, 0xF7, 0x7D, 0xD7, 0x40, 0x0A, 0x09, 0xB6,
-    0xF3, 0x71, 0xD1, 0xBD, 0xFE, 0xF4, 0x73, 0xCE, 0xFB, 0xFF, 0xBC, 0x3F, 0x32, 0x26, 0x94, 0xD1,
-    0x18, 0x93, 0x4A, 0x8F, 0x63, 0x29, 0x95, 0xD9, 0xFB, 0xB9, 0x8B, 0x87, 0x60, 0xE0, 0x31, 0x6D,
-    0x71, 0xF0, 0xA4, 0xC6, 0x31, 0x96, 0x0C, 0xC7, 0x33, 0x13, 0xCF, 0x5D, 0xE2, 0xC9, 0xF4, 0x18,
-    0x4E, 0x7A, 0x43, 0x8A, 0xDB, 0xE3, 0xBA, 0xC4, 0xC9, 0xDC, 0xC3, 0xC9, 0xA0, 0xE3, 0x9D, 0xE9,
-    0x7B, 0xCF, 0xE0, 0xA4, 0x08, 0x9E, 0x1D, 0xE3, 0x98, 0x99, 0xFC, 0xF1, 0x27, 0x26, 0x13, 0xF4,
-    0x26, 0x1A, 0x0C, 0x6E, 0x48, 0x5A, 0x4F, 0xB0, 0xF2, 0xF9, 0x5C, 0xB2, 0x54, 0x3E, 0xC6, 0x66,
-    0x78, 0x61, 0x28, 0x83, 0x09, 0x44, 0x8C, 0xFE, 0x63, 0xF5, 0x79, 0xCC, 0xCB, 0x3C, 0xF9, 0x05,
-    0xAE, 0x97, 0xDE, 0x93, 0xFF, 0x18, 0x8C, 0xE0, 0xBF, 0x32, 0xB3, 0x85, 0xAD, 0x92, 0x3A, 0x69,
-    0xE2, 0x36, 0x6A, 0xC3, 0x21, 0x18, 0x82, 0xC9, 0x88, 0x27, 0x99, 0xAD, 0xA4, 0x8E, 0xDB, 0xAB,
-    0x57, 0x3E, 0x94, 0x41, 0xFA, 0x72, 0xB0, 0x7D, 0xDC, 0x87, 0x9D, 0x39, 0xE0, 0x9E, 0xC4, 0xED,
-    0x9B, 0xC4, 0xDC, 0x8F, 0x63, 0xFE, 0x48, 0x4D, 0xB2, 0x26, 0x25, 0xAE, 0xD1, 0x65, 0xD6, 0x2B,
-    0x7A, 0xC7, 0x79, 0xB4, 0xDC, 0x83, 0x2F, 0x7A, 0x0F, 0x99, 0x65, 0xA4, 0xC3, 0x21, 0xDA, 0xE5,
-    0xD5, 0x96, 0x27, 0xFD, 0x9E, 0x27, 0x93, 0xB3, 0x64, 0xC5, 0x18, 0xE1, 0x64, 0xD8, 0x26, 0x38,
-    0x69, 0xB1, 0x09, 0xE3, 0x8F, 0x8F, 0x0B, 0x39, 0x06, 0x8A, 0xC8, 0x84, 0xCE, 0x84, 0x1F, 0x3D,
-    0xBE, 0xD3, 0x18, 0x5B, 0x98, 0xB2, 0xF2, 0x07, 0xAC, 0x09, 0x0E, 0x98, 0x68, 0x7A, 0x44, 0x3A,
-    0x5F, 0x64, 0x07, 0x7B, 0xC6, 0x85, 0x1E, 0xD7, 0x6B, 0x83, 0xCC, 0x4C, 0x51, 0x05, 0xD1, 0xD4,
-    0x58, 0x1C, 0x9B, 0xDC, 0x9A, 0x37, 0xB5, 0x95, 0x1D, 0xC4, 0x3E, 0x4A, 0x93, 0x88, 0x14, 0xC9,
-    0x65, 0xA9, 0xE2, 0x16, 0xA4, 0x77, 0x41, 0x1F, 0x0C, 0xDE, 0x08, 0xB6, 0x83, 0x27, 0x26, 0xAF,
-    0x6C, 0x65, 0xC1, 0x91, 0x04, 0x12, 0x88, 0xC1, 0xD2, 0xB8, 0xFC, 0xB1, 0x95, 0x9F, 0xCA, 0x0F,
-    0xE4, 0x9C, 0x14, 0x52, 0xE4, 0x99, 0xE7, 0x9E, 0xB4, 0x5F, 0xF9, 0xA0, 0x84, 0x45, 0x2A, 0xE3,
-    0x9C, 0x84, 0x05, 0x2A, 0xE3, 0xB4, 0x2C, 0x70, 0x1C, 0x78, 0x32, 0xFA, 0x90, 0x27, 0xF3, 0xA8,
-    0xA5, 0x48, 0x53, 0x9C, 0x4C, 0xAA, 0x1C, 0x27, 0x47, 0xDE, 0x19, 0x7D, 0xF4, 0x24, 0x4E, 0x5A,
-    0x91, 0x96, 0x02, 0xC3, 0x9D, 0xC9, 0x7B, 0x8F, 0xE3, 0xCE, 0x89, 0xFC, 0xC2, 0x0D, 0xE1, 0x80,
-    0xBD, 0x98, 0xF4, 0x72, 0x22, 0x75, 0x24, 0x63, 0x09, 0xB1, 0x08, 0xD5, 0xC8, 0x57, 0x46, 0x1F,
-    0x31, 0x4A, 0x27, 0x8F, 0x71, 0xAD, 0x8C, 0xD6, 0x4D, 0xD8, 0x7A, 0xE1, 0xFE, 0xF6, 0x16, 0x34,
-    0x61, 0xA7, 0x0A, 0x45, 0x9A, 0x70, 0xCA, 0x5B, 0xC8, 0x76, 0xF0, 0x47, 0x43, 0x12, 0xF3, 0x2C,
-    0x87, 0xD8, 0xD3, 0x2A, 0x01, 0xED, 0x31, 0x28, 0x0F, 0xB1, 0x99, 0x00, 0x4F, 0x3F, 0xB7, 0x7B,
-    0xF1, 0x98, 0x5C, 0x92, 0x5F, 0x49, 0x2B, 0x8D, 0x6D, 0x20, 0x84, 0xCC, 0xE3, 0x52, 0x5C, 0xA3,
-    0x9F, 0x57, 0x04, 0x3F, 0x0C, 0xB5, 0x73, 0xE3, 0x13, 0xF2, 0x70, 0x86, 0x22, 0xEC, 0x29, 0x68,
-    0x48, 0x34, 0x3D, 0x8F, 0x7F, 0x3D, 0xBB, 0x9C, 0xDF, 0xFF, 0x2A, 0xBF, 0x06, 0x71, 0x25, 0x58,
-    0x1E, 0xC9, 0x49, 0xEC, 0xA0, 0xF1, 0x3B, 0xB0, 0x2C, 0xAE, 0xB0, 0xD9, 0x23, 0x3E, 0x9E, 0xB6,
-    0x1D, 0x93, 0x75, 0x79, 0x35, 0x2B, 0x4A, 0x4C, 0x4A, 0x2C, 0x97, 0xE6, 0xD3, 0x02, 0x99, 0xD7,
-    0xFD, 0x4E, 0x3A, 0x98, 0xA8, 0xB2, 0x13, 0x0C, 0xA0, 0x24, 0xCB, 0x4A, 0xEA, 0x78, 0x4E, 0x7E,
-    0x7B, 0xD9, 0xA2, 0x98, 0x10, 0xB9, 0xC9, 0x9D, 0xD1, 0xD1, 0x9E, 0xF0, 0x2B, 0xC0, 0xAF, 0x7D,
-    0x0B, 0x4B, 0x60, 0x2B, 0x1D, 0x44, 0x4F, 0x2B, 0x28, 0xE2, 0xF6, 0x1E, 0x08, 0x9B, 0xB6, 0x64,
-    0x28, 0x16, 0x71, 0x77, 0xC5, 0x2D, 0x55, 0xF6, 0x36, 0x23, 0x6F, 0x0D, 0x10, 0x49, 0x4D, 0x03,
-    0x0F, 0xA5, 0x98, 0x95, 0xDE, 0x3D, 0x85, 0x7B, 0x4D, 0x3A, 0x6A, 0x3C, 0xAE, 0x4D, 0xDF, 0x69,
-    0x8D, 0x3F, 0x60, 0xD9, 0x28, 0xBB, 0xF5, 0x46, 0x13, 0xFC, 0x75, 0xDD, 0x6E, 0x80, 0xED, 0x9D,
-    0x1E, 0x4C, 0xF2, 0x72, 0x13, 0x36, 0x0F, 0x9A, 0xFB, 0xE6, 0x9D, 0x3E, 0xA6, 0xA4, 0xE6, 0x52,
-    0x25, 0x42, 0x09, 0x93, 0xD2, 0xB8, 0x81, 0x3D, 0xA9, 0x41, 0x92, 0x50, 0xF7, 0xEB, 0x84, 0x6D,
-    0x73, 0xD2, 0x99, 0xC0, 0xB6, 0x72, 0x70, 0xE2, 0xC0, 0x8A, 0xCC, 0x80, 0x62, 0x27, 0x63, 0x54,
-    0xC5, 0x7D, 0xEE, 0xD7, 0x5B, 0xB1, 0xE0, 0x64, 0x46, 0x7F, 0xD7, 0xC1, 0xBC, 0x40, 0x9A, 0x5C,
-    0x28, 0x0B, 0xDB, 0x9B, 0xD3, 0x20, 0x25, 0x68, 0x41, 0x58, 0x5C, 0x40, 0x87, 0x0F, 0x06, 0x34,
-    0xF6, 0x84, 0x0F, 0x29, 0x57, 0x34, 0x51, 0x8B, 0x6C, 0xBB, 0x22, 0x33, 0x33, 0x77, 0x46, 0x02,
-    0x1D, 0x8E, 0xE5, 0xDF, 0xCA, 0x22, 0xA5, 0x91, 0xA7, 0x74, 0x59, 0x89, 0x7A, 0x88, 0x6D, 0x2E,
-    0x04, 0x1F, 0x03, 0x5B, 0x4F, 0x1B, 0x43, 0xBF, 0xF0, 0xCA, 0x6A, 0xF9, 0x6D, 0x13, 0x49, 0x06,
-    0x31, 0x82, 0x36, 0x48, 0x11, 0x96, 0x02, 0x21, 0x92, 0x34, 0x51, 0xB2, 0xC8, 0x13, 0x50, 0x06,
-    0x09, 0x5A, 0x19, 0x29, 0x40, 0x12, 0xB6, 0x92, 0xDF, 0xF7, 0xCC, 0x1B, 0xC6, 0x9C, 0x0E, 0xF0,
-    0x3C, 0x9B, 0xD4, 0xF4, 0xDD, 0x8B, 0xFD, 0x3A, 0x5B, 0x5A, 0x04, 0xA8, 0xE4, 0x45, 0x70, 0x96,
-    0x26, 0x9D, 0x5E, 0xEB, 0x55, 0x82, 0x4A, 0x1F, 0xC8, 0x0A, 0x9A, 0xA8, 0x87, 0x04, 0x54, 0x84,
-    0x4A, 0xA0, 0x3A, 0x77, 0xA5, 0x4B, 0x65, 0x68, 0xD7, 0xFF, 0xEC, 0x8C, 0x57, 0xA8, 0x10, 0x95,
-    0x44, 0x3C, 0x4E, 0xA8, 0x19, 0xC3, 0x2C, 0x45, 0x47, 0x23, 0xF7, 0x14, 0x34, 0x7E, 0x6B, 0x4D,
-    0xF8, 0x61, 0x0B, 0x5F, 0xE7, 0x94, 0x2B, 0xCD, 0x56, 0xC2, 0xF8, 0x6A, 0xD4, 0xD6, 0xAF, 0x42,
-    0x5C, 0x6E, 0xE1, 0x35, 0xE1, 0x71, 0xCF, 0x68, 0x1C, 0x2A, 0x96, 0x1D, 0xAB, 0x79, 0xBB, 0xB5,
-    0x9E, 0xFB, 0x57, 0xE3, 0xC8, 0xA6, 0x43, 0xEA, 0xCD, 0x11, 0xF9, 0x21, 0xFC, 0x7A, 0xDC, 0x86,
-    0xA2, 0xCE, 0xB6, 0x27, 0xC1, 0x52, 0x41, 0x85, 0xE1, 0x9B, 0xA0, 0xCC, 0x79, 0x8D, 0xC5, 0xC1,
-    0x12, 0x68, 0x72, 0x5E, 0x81, 0x8B, 0xF8, 0xB6, 0xA4, 0x6F, 0xA6, 0x16, 0x80, 0x69, 0xB3, 0x83,
-    0xB6, 0x0D, 0x6E, 0x80, 0x8E, 0xDB, 0x06, 0xE2, 0x0E, 0x19, 0xCC, 0x42, 0xF5, 0x76, 0x38, 0x1C,
-    0x5F, 0xFB, 0x91, 0x2D, 0x2A, 0x75, 0xDE, 0x1F, 0xE1, 0xCE, 0xDE, 0xC6, 0xAE, 0x9E, 0xEA, 0x4F,
-    0xD3, 0x46, 0x1E, 0x85, 0xAA, 0x44, 0x2D, 0x79, 0x2D, 0xB1, 0x31, 0x87, 0xE2, 0x26, 0x33, 0xC9,
-    0x04, 0x59, 0x87, 0x54, 0x15, 0x8D, 0x64, 0x20, 0x1C, 0x4A, 0x02, 0x27, 0xDE, 0x91, 0x1D, 0xB0,
-    0x7E, 0x86, 0x33, 0x18, 0xA5, 0xA7, 0xEA, 0x00, 0x02, 0xD5, 0xC3, 0x19, 0xC6, 0x34, 0xFC, 0x79,
-    0x64, 0x7A, 0xC3, 0xD0, 0x9D, 0x17, 0x3E, 0xDD, 0x9C, 0xD1, 0xC0, 0x36, 0x3B, 0x88, 0x2F, 0x4F,
-    0x3C, 0x94, 0x61, 0xA4, 0xCE, 0xE6, 0x67, 0x71, 0x3D, 0xBE, 0x95, 0xDF, 0x9B, 0x78, 0xEA, 0x12,
-    0xFD, 0x2A, 0x95, 0xC3, 0xDB, 0xA1, 0x50, 0xF2, 0x0C, 0x4F, 0xC0, 0xFA, 0x21, 0xAD, 0x9E, 0x66,
-    0x10, 0x5E, 0xA6, 0x8A, 0xC3, 0x0F, 0xC4, 0x13, 0x48, 0x97, 0x0C, 0xFB, 0xE8, 0x41, 0x33, 0x02,
-    0x78, 0xA5, 0x91, 0x2B, 0xEA, 0xB8, 0x2F, 0x12, 0xCC, 0x10, 0xAE, 0xB1, 0x8B, 0x31, 0xBC, 0x51,
-    0x6A, 0x19, 0xC4, 0x0D, 0xA3, 0xD7, 0xAC, 0x55, 0x31, 0x31, 0x8B, 0x3E, 0xDA, 0x13, 0xC9, 0xAE,
-    0x01, 0x2E, 0x4A, 0x7F, 0xCB, 0x2D, 0x42, 0xA4, 0x13, 0x1C, 0x18, 0x9E, 0x9E, 0x14, 0x10, 0x31,
-    0x54, 0x08, 0x90, 0x03, 0xE6, 0x48, 0x85, 0x09, 0x5C, 0x38, 0xFF, 0xF7, 0x57, 0xA8, 0xCE, 0x13,
-    0x4D, 0x49, 0x66, 0x1B, 0x9F, 0xCF, 0xD0, 0x61, 0xE4, 0x15, 0xC2, 0x15, 0x0C, 0xB8, 0x37, 0x60,
-    0x0B, 0x95, 0xF2, 0x94, 0x30, 0xF6, 0x22, 0xF0, 0x2A, 0x17, 0x70, 0x53, 0x43, 0x9C, 0x12, 0xC8,
-    0x3A, 0xA8, 0x6C, 0xE8, 0xFB, 0x98, 0x56, 0x71, 0x95, 0x9B, 0x09, 0xF1, 0xB9, 0x4D, 0xAB, 0x14,
-    0x18, 0x41, 0x4A, 0x5C, 0x0B, 0x06, 0x5F, 0x26, 0x4B, 0x22, 0x50, 0x3A, 0xC0, 0xA0, 0x9A, 0x60,
-    0x8F, 0xBE, 0x7B, 0x94, 0x67, 0x50, 0x47, 0x04, 0x14, 0xD8, 0x36, 0xC4, 0xAD, 0xEE, 0xA6, 0x30,
-    0x6B, 0x18, 0xE0, 0x3E, 0x96, 0x06, 0x19, 0x2B, 0xBA, 0xCA, 0x2F, 0x9C, 0xA2, 0xA8, 0xBD, 0x9E,
-    0xC2, 0x7D, 0x81, 0xB2, 0xBB, 0xD7, 0x18, 0x8D, 0xE2, 0x1A, 0x51, 0xE3, 0xCB, 0xCF, 0x65, 0x64,
-    0x57, 0x43, 0xFB, 0x25, 0x22, 0x5B, 0x9F, 0x69, 0xC1, 0x51, 0xDC, 0xF3, 0xA0, 0xA1, 0x9C, 0x0B,
-    0xC8, 0x05, 0xE1, 0x38, 0xBF, 0xA2, 0xC6, 0x0A, 0xF6, 0xE1, 0x30, 0x52, 0xBF, 0x0E, 0x98, 0x37,
-    0xBC, 0x2A, 0xE8, 0x77, 0xA0, 0x5F, 0x40, 0x2C, 0xB2, 0x8A, 0x59, 0xE6, 0x10, 0x55, 0x0E, 0xD0,
-    0x0C, 0x6C, 0xF9, 0xF9, 0x60, 0x86, 0xB0, 0x8D, 0x1B, 0x80, 0x32, 0x7F, 0xF0, 0x01, 0x08, 0xE3,
-    0xAB, 0x10, 0x28, 0xA4, 0x03, 0x4D, 0x81, 0xBD, 0xBF, 0x0E, 0x48, 0x52, 0xA5, 0x60, 0x94, 0x05,
-    0xE3, 0xE8, 0xD3, 0xF6, 0xAD, 0x29, 0x89, 0x89, 0xB2, 0xA2, 0x6E, 0x85, 0x37, 0x55, 0x00, 0xFB,
-    0x6E, 0x0E, 0xB1, 0xF4, 0xDA, 0x8C, 0x35, 0x93, 0xF3, 0x50, 0xAF, 0xAC, 0x95, 0x3C, 0x23, 0xA9,
-    0x80, 0xA7, 0x94, 0xAB, 0xF5, 0x06, 0x52, 0x3A, 0x44, 0x2D, 0xC4, 0x1A, 0x4C, 0x42, 0x42, 0x83,
-    0x29, 0xA3, 0x54, 0x61, 0xAF, 0x2D, 0xE9, 0x14, 0x5E, 0x5C, 0xAC, 0xC3, 0x8E, 0x6E, 0xDE, 0xA9,
-    0x66, 0x72, 0x05, 0x4E, 0x19, 0xA4, 0xBE, 0xA8, 0x56, 0x96, 0x51, 0x35, 0x35, 0x4E, 0x18, 0xA3,
-    0x6E, 0x39, 0x98, 0xBE, 0x7D, 0x9C, 0x8A, 0xDD, 0xD3, 0x8F, 0x0F, 0xB3, 0x97, 0x8B, 0x67, 0xF6,
-    0xEC, 0xE3, 0x3D, 0x11, 0x2C, 0xB5, 0x08, 0x00, 0x25, 0x6B, 0x98, 0x50, 0x32, 0x95, 0x80, 0x5A,
-    0xE4, 0x8F, 0x15, 0x67, 0x0D, 0x89, 0x1E, 0x74, 0x51, 0x12, 0x1F, 0x6A, 0x6C, 0x50, 0xF4, 0x95,
-    0xAC, 0xC2, 0xC4, 0x3A, 0xC4, 0xFE, 0x7C, 0x08, 0x20, 0x1A, 0x68, 0x69, 0x5C, 0x95, 0x94, 0x9B,
-    0xDD, 0x6D, 0xA9, 0xA4, 0xF6, 0xBC, 0x8A, 0xCD, 0x56, 0x39, 0x75, 0x94, 0x16, 0x97, 0x8F, 0xFA,
-    0x68, 0x22, 0xB8, 0xC3, 0x78, 0x2A, 0xB8, 0x93, 0xB7, 0x1A, 0xB9, 0x36, 0xE0, 0x54, 0x86, 0xAD,
-    0xF9, 0x1D, 0x63, 0x53, 0x9E, 0xD0, 0xF7, 0x29, 0x88, 0x2F, 0x55, 0xBE, 0x7B, 0x12, 0x8C, 0x1B,
-    0xC8, 0x8D, 0x2F, 0x13, 0xA2, 0x7E, 0x3F, 0x93, 0x75, 0x9F, 0x07, 0x95, 0xCB, 0x05, 0x8D, 0x15,
-    0x5B, 0x8C, 0xDF, 0x6D, 0xE9, 0x05, 0x7B, 0xC6, 0xEC, 0xEF, 0x2C, 0x2A, 0xF4, 0xAA, 0x22, 0x8F,
-    0x9E, 0x6E, 0x7A, 0x62, 0x68, 0x06, 0x74, 0xAD, 0xCD, 0x40, 0x14, 0x35, 0xD0, 0xEB, 0x10, 0x66,
-    0x99, 0x8D, 0xD0, 0x3C, 0xC7, 0x62, 0xEF, 0xE4, 0x49, 0xF8, 0x61, 0x99, 0xF0, 0x17, 0x1C, 0x21,
-    0x48, 0xE8, 0x10, 0x9A, 0x61, 0x4E, 0xC0, 0x64, 0x40, 0x1F, 0x59, 0xD2, 0xA8, 0x4F, 0xF6, 0xD4,
-    0x38, 0x52, 0xC1, 0x46, 0xCD, 0x41, 0x5D, 0xEE, 0xEF, 0x16, 0x88, 0x4F, 0xB0, 0x62, 0xE2, 0x0F,
-    0x08, 0x6E, 0x99, 0xF2, 0x9C, 0x0E, 0x70, 0xB8, 0x6F, 0x31, 0x61, 0x73, 0x28, 0x33, 0x2E, 0xAE,
-    0x6B, 0xA6, 0x62, 0xEB, 0x69, 0x1B, 0xFB, 0x46, 0x90, 0x2E, 0x8D, 0x1E, 0x98, 0xA2, 0x29, 0xF2,
-    0xFA, 0x21, 0x68, 0x49, 0xE8, 0xF5, 0x42, 0x4D, 0x1B, 0x29, 0xCE, 0x5C, 0x6D, 0x0B, 0xDF, 0x7B,
-    0x25, 0x08, 0x8F, 0xAF, 0x10, 0x87, 0x11, 0x32, 0x08, 0x9D, 0xA8, 0x50, 0x37, 0xA4, 0x08, 0x55,
-    0x1C, 0xAD, 0xE6, 0x2C, 0xB8, 0xEE, 0xFC, 0x12, 0x30, 0xA0, 0xA0, 0x7F, 0x8E, 0xC7, 0xFC, 0x4B,
-    0x3B, 0x3F, 0x35, 0x52, 0x61, 0xAD, 0x32, 0xB0, 0x1B, 0xCB, 0xAB, 0x5B, 0xA8, 0x0B, 0x0F, 0x99,
-    0xEF, 0xE2, 0x11, 0x7F, 0xD9, 0xCC, 0x3E, 0x37, 0x56, 0xA7, 0xBE, 0xA0, 0x9C, 0x9B, 0xC1, 0x26,
-    0xE7, 0x03, 0x5F, 0x5C, 0xC4, 0xA8, 0xA9, 0x8B, 0x37, 0xEC, 0xF1, 0x8B, 0x37, 0x58, 0xA5, 0xEE,
-    0x5F, 0xDC, 0xB3, 0x9A, 0xBD, 0x7A, 0x6B, 0xCD, 0xB2, 0xD6, 0x9F, 0x9B, 0xA1, 0x4D, 0x37, 0x94,
-    0x07, 0xCA, 0x82, 0x69, 0x75, 0x50, 0xF7, 0x37, 0x2C, 0x5E, 0xD6, 0xA5, 0xD5, 0x66, 0x3F, 0x0F,
-    0x0F, 0x2D, 0xD8, 0xD4, 0x6B, 0x97, 0x8C, 0xC4, 0x1D, 0xBA, 0x3D, 0x78, 0xFD, 0x66, 0xE8, 0xD5,
-    0x02, 0x94, 0x9C, 0xE8, 0x1C, 0x8A, 0x76, 0xB9, 0xBF, 0xC9, 0x9F, 0xE1, 0x93, 0xC3, 0x4E, 0x63,
-    0xC8, 0xBD, 0xE6, 0xCE, 0x6B, 0xC1, 0x15, 0xB8, 0xE1, 0x3C, 0x37, 0x41, 0x8F, 0x27, 0x05, 0x7E,
-    0xB8, 0x1A, 0x55, 0x01, 0xCC, 0x25, 0x7F, 0x01, 0xA7, 0x11, 0x8D, 0x11, 0x40, 0x83, 0x49, 0x1D,
-    0x35, 0x19, 0x6F, 0x2F, 0x9C, 0x2C, 0x09, 0x78, 0xE9, 0x97, 0x29, 0x26, 0x7A, 0x73, 0xDB, 0x68,
-    0x58, 0x26, 0x42, 0xC8, 0x78, 0x7F, 0xE8, 0x1E, 0xC1, 0x7C, 0xA4, 0xD4, 0x47, 0xE0, 0x7E, 0x8A,
-    0x2F, 0xB9, 0x6C, 0xD2, 0xCB, 0xF0, 0xB6, 0x53, 0x04, 0xA7, 0x6B, 0xA5, 0xD3, 0x3A, 0x82, 0x77,
-    0xC2, 0x68, 0x8C, 0x66, 0x79, 0xC4, 0x1F, 0x07, 0x64, 0x05, 0xD8, 0x70, 0xE7, 0xCF, 0x31, 0xE6,
-    0x20, 0xD1, 0x21, 0x52, 0x44, 0x5E, 0xF9, 0xD4, 0x30, 0x5B, 0x0E, 0x8B, 0x53, 0x2C, 0xD9, 0xC4,
-    0xCD, 0x21, 0xD0, 0x97, 0x37, 0xFE, 0x80, 0x48, 0x51, 0xB2, 0x30, 0x41, 0xAF, 0x3F, 0x02, 0x29,
-    0xC3, 0xED, 0xFB, 0xE2, 0x81, 0x6B, 0xE0, 0x3F, 0xA0, 0x68, 0x05, 0x28, 0xDE, 0x00, 0x97, 0x76,
-    0xC1, 0xE8, 0x8F, 0xFF, 0x28, 0x46, 0x46, 0x7C, 0x39, 0x25, 0xB5, 0x0A, 0xE0, 0xC0, 0x17, 0xE0,
-    0x88, 0x7F, 0xEA, 0xCA, 0xC9, 0x53, 0x57, 0x32, 0x22, 0x46, 0x9C, 0xFA, 0x13, 0x79, 0xFC, 0x49,
-    0x08, 0xF7, 0x7A, 0x71, 0x64, 0x6B, 0xCE, 0xE9, 0x19, 0x23, 0xEF, 0x10, 0xA7, 0x1D, 0x78, 0x6E,
-    0xE6, 0x53, 0x7F, 0x99, 0x70, 0x79, 0xAC, 0x4F, 0x95, 0x09, 0x02, 0xE3, 0x07, 0x52, 0xC7, 0xBB,
-    0xC7, 0x10, 0xE5, 0x8F, 0x22, 0xCD, 0x28, 0x04, 0x0F, 0xCF, 0x0B, 0xDB, 0xA4, 0x5A, 0x4E, 0x0A,
-    0x07, 0x30, 0x61, 0x24, 0x13, 0x4C, 0xF9, 0x34, 0xE8, 0x95, 0x47, 0x61, 0x0C, 0xDF, 0xEF, 0x3C,
-    0x7A, 0xE7, 0x7D, 0xCE, 0x1F, 0x86, 0xFD, 0x03, 0x86, 0xB5, 0xAA, 0x64, 0x67, 0x30, 0xB7, 0x47,
-    0xCD, 0x35, 0x38, 0x0D, 0xC8, 0x01, 0xDB, 0x08, 0xC5, 0x01, 0x69, 0xEA, 0x05, 0xC9, 0xA0, 0x09,
-    0x12, 0x5D, 0x93, 0x74, 0xA6, 0x7B, 0x54, 0x14, 0xC6, 0x78, 0xD2, 0xCB, 0xFF, 0x59, 0x4D, 0x20,
-    0x4C, 0x00, 0x91, 0x2C, 0x34, 0x22, 0x37, 0xD6, 0x47, 0x79, 0x27, 0x0E, 0xC6, 0xC3, 0xE1, 0x44,
-    0x86, 0x07, 0xD3, 0xEE, 0x96, 0xA8, 0x98, 0x17, 0xD9, 0x36, 0x69, 0x4F, 0x3A, 0x9F, 0x02, 0x04,
-    0xEC, 0x58, 0x6B, 0xC2, 0x13, 0x81, 0xD9, 0x80, 0xD7, 0x20, 0x5F, 0xE4, 0x1A, 0xC8, 0x13, 0xCA,
-    0xA7, 0x4D, 0x39, 0x9A, 0x12, 0xA0, 0xA5, 0xD6, 0x6D, 0x47, 0x6A, 0x60, 0x83, 0xCB, 0x1C, 0xAE,
-    0xDF, 0x7E, 0x63, 0xE9, 0x72, 0xF9, 0xA5, 0xE6, 0x3C, 0x34, 0x7C, 0x30, 0xBF, 0xB0, 0xC2, 0x7D,
-    0x02, 0x11, 0x95, 0x7C, 0x38, 0xB6, 0x59, 0x66, 0xEE, 0x77, 0x9E, 0x41, 0xAB, 0x22, 0xA9, 0xD3,
-    0x89, 0x9B, 0x3C, 0x30, 0x43, 0xFF, 0xB8, 0xB8, 0xC7, 0xC4, 0x3F, 0x7B, 0x13, 0x4F, 0x6A, 0x5D,
-    0x3D, 0xEA, 0xE0, 0xF5, 0x63, 0xAE, 0xD9, 0x77, 0xD8, 0xFC, 0xE7, 0x98, 0x1C, 0x95, 0x81, 0x58,
-    0x66, 0xDB, 0x59, 0x4E, 0xDA, 0xC3, 0x6C, 0xB6, 0xCA, 0x02, 0x2A, 0x00, 0xCE, 0x82, 0xA1, 0x13,
-    0xA1, 0xB9, 0xFE, 0x06, 0xB3, 0xD3, 0xF7, 0xB3, 0x72, 0xF4, 0xA5, 0x81, 0x0D, 0x78, 0x2B, 0xFD,
-    0xAF, 0x59, 0xB0, 0xF5, 0xA8, 0x66, 0xA3, 0xDB, 0x00, 0x16, 0xF4, 0xE7, 0x74, 0xCA, 0xBA, 0x34,
-    0x9F, 0xDB, 0xE4, 0x96, 0xA8, 0xD8, 0xA3, 0xDB, 0x21, 0x76, 0x44, 0x0B, 0x4E, 0x88, 0xA4, 0x26,
-    0xDD, 0x10, 0xD1, 0x1F, 0x9D, 0x25, 0x51, 0x6B, 0xEE, 0x20, 0xAB, 0x27, 0xEB, 0x24, 0x21, 0xEE,
-    0x58, 0xEB, 0xD3, 0xC2, 0xB4, 0x97, 0xA5, 0xBD, 0x15, 0xEC, 0x32, 0xA9, 0xA3, 0x16, 0x6C, 0x98,
-    0x58, 0x0D, 0xAE, 0xE2, 0x26, 0xEC, 0xC0, 0xD3, 0x72, 0x4C, 0x27, 0x5C, 0xF9, 0x3C, 0x50, 0xEA,
-    0x83, 0xB8, 0x0D, 0xB9, 0x93, 0x5D, 0x63, 0xCF, 0xD3, 0xD4, 0x5F, 0x87, 0xED, 0xCF, 0x7C, 0x4A,
-    0x13, 0x34, 0xBD, 0x68, 0xCD, 0x6C, 0x7E, 0xCB, 0x2E, 0x67, 0x3F, 0x46, 0x1E, 0x70, 0x3B, 0xD1,
-    0x42, 0x55, 0xE6, 0xA8, 0x6A, 0x95, 0xB1, 0xA1, 0xA6, 0x41, 0x45, 0xCC, 0x1C, 0x62, 0x3B, 0xED,
-    0x65, 0x78, 0x0A, 0xB9, 0x79, 0xC4, 0x1A, 0x65, 0x93, 0xD6, 0xCC, 0xF1, 0xE1, 0xD4, 0x9F, 0x2E,
-    0xC7, 0xB2, 0xCF, 0xEB, 0x7D, 0x1B, 0xAE, 0xA3, 0x76, 0xAE, 0x23, 0x54, 0xD7, 0x51, 0x6D, 0x38,
-    0xD3, 0x78, 0x8F, 0x33, 0x15, 0xC7, 0xDA, 0xDE, 0xED, 0xA3, 0x56, 0x89, 0x8A, 0xF2, 0x18, 0x5B,
-    0xE0, 0x86, 0xD2, 0xB5, 0xEB, 0x50, 0xDD, 0xD8, 0xEB, 0x3A, 0xC4, 0xF9, 0xE3, 0x51, 0xB9, 0x1D,
-    0xB7, 0xCA, 0x70, 0x7C, 0x0D, 0x92, 0x5D, 0xB2, 0xAB, 0x42, 0x33, 0x7E, 0xA5, 0xB9, 0x52, 0xB2,
-    0xAB, 0x10, 0xC3, 0x75, 0x04, 0x3C, 0x67, 0x2F, 0xDE, 0xAB, 0x6B, 0x46, 0xC1, 0xF0, 0x59, 0x25,
-    0x90, 0x2C, 0xAF, 0x59, 0x34, 0x30, 0x49, 0xE3, 0x1D, 0x77, 0xDD, 0x02, 0xAA, 0xCF, 0x16, 0x24,
-    0x13, 0xCA, 0xCB, 0xD2, 0xDA, 0x09, 0xE2, 0x79, 0xAA, 0x83, 0x1A, 0xA5, 0x90, 0x91, 0xA1, 0x47,
-    0x55, 0x41, 0xB1, 0x62, 0x6D, 0x58, 0xC2, 0xD5, 0x7A, 0x2E, 0x1C, 0x0E, 0x95, 0x2B, 0x7D, 0xFF,
-    0x61, 0xEC, 0x08, 0x0E, 0x0A, 0xAA, 0x65, 0x2B, 0x15, 0xB3, 0xA7, 0x72, 0x62, 0xA0, 0xF3, 0xE9,
-    0xBE, 0xED, 0xA9, 0xD6, 0x25, 0xFB, 0x44, 0xE3, 0xC6, 0xFF, 0xAF, 0x0D, 0xC9, 0x69, 0x66, 0xA1,
-    0x65, 0xAC, 0x92, 0x25, 0xD3, 0x9E, 0x9C, 0x6A, 0x2C, 0xBE, 0xCF, 0x6E, 0xD9, 0x14, 0xB0, 0x36,
-    0x3A, 0xD4, 0x55, 0x86, 0x74, 0x66, 0xC1, 0xB4, 0xE4, 0xFA, 0x0A, 0x63, 0xC8, 0x30, 0x57, 0x19,
-    0x50, 0xA0, 0xB0, 0x46, 0x0B, 0xAE, 0x48, 0xD6, 0x2C, 0x49, 0xA4, 0xAA, 0x52, 0xBE, 0xCA, 0x6A,
-    0x94, 0x63, 0x7C, 0x9C, 0x2A, 0x2A, 0x9F, 0x79, 0x7B, 0x38, 0x38, 0x65, 0xC2, 0x41, 0xA1, 0x24,
-    0x4E, 0xDE, 0x36, 0xA7, 0x91, 0x5F, 0x9F, 0x59, 0xED, 0xF3, 0xB6, 0x33, 0x14, 0xD1, 0xCB, 0x8D,
-    0x61, 0xE1, 0xD3, 0xDC, 0x67, 0x8A, 0x75, 0x32, 0xA2, 0x19, 0xB6, 0xFA, 0x74, 0x59, 0x64, 0xA3,
-    0x5D, 0x86, 0x66, 0xC6, 0x5D, 0x0C, 0xFE, 0xBA, 0x69, 0xF8, 0x3A, 0xC7, 0x25, 0xC6, 0xB6, 0xF5,
-    0x75, 0xD8, 0xA7, 0x3F, 0xB8, 0xBD, 0xDE, 0x07, 0x66, 0x87, 0xFF, 0x33, 0x39, 0x71, 0x86, 0x7C,
-    0xE6, 0xDD, 0xE7, 0x37, 0x75, 0xBE, 0x55, 0xD3, 0x6B, 0xB4, 0x54, 0x42, 0x02, 0x83, 0xC1, 0x59,
-    0x6B, 0xA8, 0xAE, 0x85, 0xB4, 0x47, 0x3D, 0x61, 0x46, 0xFC, 0x11, 0xD9, 0x15, 0x5F, 0xE5, 0x62,
-    0x89, 0x36, 0x4B, 0x52, 0x4D, 0x28, 0xED, 0xAE, 0x96, 0x45, 0xDF, 0xD7, 0xE5, 0xCE, 0x69, 0xD8,
-    0x51, 0x2D, 0x2A, 0x8B, 0x52, 0xAD, 0x1D, 0xE8, 0xC4, 0x93, 0xE3, 0xC9, 0xC4, 0xBA, 0x28, 0x42,
-    0xB2, 0x65, 0xB2, 0x5D, 0x2C, 0xD0, 0xD6, 0xA1, 0x25, 0x85, 0x32, 0xAE, 0x06, 0x30, 0x1F, 0xD3,
-    0x6C, 0xB6, 0x54, 0x7C, 0x4E, 0xCC, 0xF9, 0x42, 0x22, 0x1A, 0xDA, 0xBC, 0x9D, 0x56, 0x23, 0x9B,
-    0xBF, 0x94, 0x0D, 0x8B, 0x6D, 0x6F, 0x48, 0xDB, 0xF0, 0x92, 0x34, 0xE9, 0x19, 0x2C, 0x5D, 0x9F,
-    0x09, 0xC6, 0xA0, 0x4B, 0x10, 0xCC, 0x90, 0xCB, 0x22, 0x31, 0x87, 0x41, 0xC2, 0x5A, 0xCA, 0x0C,
-    0xC1, 0x1E, 0xD7, 0x63, 0x3F, 0x6F, 0xC9, 0xF9, 0xC9, 0x97, 0xFF, 0xED, 0x54, 0x5E, 0x99, 0x66,
-    0x22, 0xA3, 0xC3, 0x64, 0x54, 0xA3, 0x87, 0x1C, 0x28, 0xBA, 0xC5, 0x65, 0xC8, 0x07, 0x93, 0xD1,
-    0x9B, 0x2C, 0xA2, 0xEC, 0x1D, 0x63, 0x32, 0x79, 0x43, 0xFE, 0x37, 0xDE, 0xD0, 0x43, 0x76, 0x0D,
-    0x74, 0xB0, 0xD2, 0x2C, 0x2F, 0xBC, 0xDA, 0x9A, 0xE8, 0x12, 0xDC, 0xFE, 0x6F, 0x86, 0x7D, 0x71,
-    0x23, 0x7F, 0x9B, 0xD4, 0xF0, 0x3D, 0xB5, 0xED, 0x09, 0x1D, 0x36, 0x71, 0x16, 0x21, 0x1E, 0x23,
-    0x30, 0x4D, 0xAA, 0x6C, 0xE7, 0x02, 0xFC, 0xF1, 0xBD, 0x25, 0xAB, 0x59, 0x37, 0xF3, 0x66, 0xD6,
-    0x4A, 0xEA, 0x98, 0x2A, 0x25, 0x4B, 0x1B, 0xAA, 0x8E, 0x32, 0x6B, 0xA3, 0x56, 0xDD, 0xED, 0x72,
-    0x9D, 0xAD, 0xBC, 0xE3, 0xB8, 0xEE, 0x08, 0xF4, 0x31, 0x6C, 0xE0, 0x21, 0x46, 0x4F, 0x2E, 0xCA,
-    0x5B, 0x04, 0x14, 0x5A, 0x33, 0xD1, 0xCF, 0xF3, 0xDA, 0x8D, 0x41, 0xB0, 0x6F, 0xBC, 0xF3, 0x73,
-    0xC5, 0x2E, 0x24, 0x6B, 0x2A, 0x98, 0xA8, 0x46, 0x4B, 0x7D, 0xB8, 0x10, 0x27, 0xF9, 0xEA, 0x7E,
-    0xF8, 0xB3, 0x37, 0xB8, 0x26, 0x2E, 0xBE, 0xFE, 0x02, 0xBB, 0x34, 0x16, 0x28, 0xBB, 0x5B, 0xF9,
-    0xFF, 0xEB, 0xBC, 0x77, 0xED, 0xC5, 0x50, 0x47, 0x34, 0xF3, 0x61, 0x51, 0x41, 0xB1, 0x33, 0xB5,
-    0xE3, 0x36, 0x17, 0x64, 0x93, 0x09, 0x11, 0xEB, 0x0E, 0xA8, 0x58, 0xED, 0x0F, 0xCE, 0xCB, 0xE4,
-    0x05, 0xD4, 0x5E, 0xB8, 0xF3, 0xF5, 0xB7, 0xFD, 0xFC, 0xED, 0x3F, 0x80, 0x6C, 0xE9, 0xA3, 0x91,
-    0xB5, 0x83, 0x0C, 0xCE, 0x2C, 0xAE, 0x79, 0xC8, 0x90, 0x13, 0x6F, 0x2F, 0xE8, 0x62, 0x06, 0xEA,
-    0x88, 0x38, 0x32, 0xBC, 0x08, 0xD2, 0x7E, 0x0B, 0x5F, 0xDC, 0x23, 0x28, 0xD9, 0xFA, 0x30, 0xED,
-    0x7C, 0xDB, 0xD1, 0xA6, 0x3E, 0x41, 0x3D, 0xC9, 0xB0, 0xA7, 0x59, 0x30, 0x2D, 0xEE, 0x83, 0xD4,
-    0xE1, 0xF2, 0xB8, 0x88, 0x58, 0xDC, 0xB0, 0x4D, 0xD0, 0x91, 0xBC, 0x0A, 0x70, 0x7C, 0x72, 0x95,
-    0x0F, 0x56, 0x8D, 0xF3, 0xFE, 0x08, 0x2B, 0xC6, 0xAC, 0x17, 0xE7, 0x8F, 0x56, 0xAC, 0x15, 0x4B,
-    0x8C, 0x8D, 0x67, 0x9E, 0x2B, 0x40, 0x2D, 0xCD, 0x8E, 0x5E, 0x4B, 0xAA, 0xEC, 0xC3, 0x89, 0xD6,
-    0xA7, 0x96, 0xD3, 0xE3, 0xEB, 0x14, 0x08, 0x75, 0x11, 0x12, 0x59, 0x83, 0x52, 0xC5, 0x7C, 0xAE,
-    0x3E, 0x5A, 0xCC, 0xBC, 0xD6, 0x0D, 0x6A, 0xD3, 0x66, 0x82, 0x3E, 0x20, 0x96, 0xF6, 0xC4, 0xB8,
-    0xC8, 0x6F, 0x58, 0x7C, 0x1D, 0x60, 0x67, 0x76, 0x83, 0x9E, 0xBB, 0x78, 0x79, 0xAF, 0x62, 0x01,
-    0x3D, 0x36, 0x63, 0x55, 0x85, 0xE9, 0x50, 0xE3, 0xE4, 0xB2, 0xC5, 0x5A, 0x37, 0x20, 0x4A, 0x45,
-    0x68, 0xB3, 0xB9, 0xB1, 0x76, 0xB5, 0xB1, 0x21, 0x2E, 0xEC, 0x39, 0x60, 0xC9, 0xBC, 0xCA, 0x8F,
-    0x22, 0x0E, 0x1E, 0xFC, 0x42, 0xFB, 0xFE, 0x9D, 0xAA, 0xF4, 0xCF, 0x46, 0x41, 0x91, 0x61, 0x2A,
-    0xC6, 0x6E, 0x5D, 0xA4, 0xC0, 0x19, 0xD7, 0x5D, 0xFD, 0x22, 0xAA, 0xC4, 0x06, 0x72, 0x03, 0x3D,
-    0x61, 0x79, 0x1A, 0x0E, 0x12, 0x0A, 0x65, 0xF5, 0x07, 0xBE, 0xA4, 0x7C, 0xD3, 0x08, 0xCB, 0xCB,
-    0xA0, 0x34, 0x1D, 0xD9, 0x89, 0x9C, 0xB5, 0xBF, 0x27, 0xF0, 0x89, 0x3F, 0x86, 0x16, 0xE0, 0xA7,
-    0x80, 0xC6, 0x6C, 0x56, 0x7B, 0x9C, 0xF2, 0xA9, 0x3E, 0xCE, 0xC1, 0x47, 0xAB, 0x9A, 0x4B, 0x36,
-    0x75, 0xEB, 0xB5, 0x79, 0x93, 0xA5, 0x0B, 0x6C, 0x62, 0x16, 0xD0, 0xB5, 0x59, 0x05, 0x26, 0xC4,
-    0xC2, 0xA4, 0x11, 0x3C, 0xF0, 0xE9, 0x24, 0x07, 0xFA, 0x21, 0x66, 0x23, 0xB8, 0xB6, 0x6C, 0xF1,
-    0xDC, 0xF8, 0xFD, 0x91, 0x6D, 0xD4, 0x56, 0x5E, 0x82, 0xD3, 0x81, 0x2B, 0xC6, 0xE9, 0x33, 0xC1,
-    0xC4, 0xD3, 0x59, 0xF9, 0x41, 0xA5, 0xDA, 0xC9, 0xD3, 0xBE, 0xF0, 0xB4, 0xB1, 0x23, 0x13, 0x52,
-    0xF2, 0x24, 0x3F, 0xAE, 0x48, 0x62, 0xE2, 0x4E, 0xF0, 0x3C, 0x76, 0x08, 0x96, 0xBE, 0xB7, 0xF9,
-    0xB3, 0x25, 0x5C, 0x8E, 0x73, 0x28, 0xD3, 0xAC, 0x95, 0xEC, 0x8D, 0x37, 0x8B, 0x0A, 0xD9, 0x96,
-    0x49, 0xA6, 0x68, 0x0C, 0xE4, 0x43, 0x1A, 0x16, 0xAB, 0xBB, 0x12, 0xC3, 0x71, 0x57, 0x60, 0x50,
-    0x9B, 0xD4, 0xC1, 0xA4, 0x16, 0x85, 0x38, 0xDD, 0x83, 0x47, 0x65, 0x56, 0x66, 0x4C, 0x1C, 0xD8,
-    0x93, 0x7F, 0x00, 0x19, 0x93, 0x9C, 0x45, 0xF4, 0xEE, 0x6C, 0xA5, 0xB1, 0x74, 0xDF, 0x1F, 0x13,
-    0xF9, 0xCE, 0xE3, 0x7A, 0x0E, 0xF1, 0xD8, 0x62, 0xDD, 0x7C, 0x0E, 0x9B, 0xF5, 0x71, 0x76, 0xCB,
-    0x8F, 0x99, 0x6D, 0xE8, 0x4B, 0x59, 0xDB, 0xC9, 0x8A, 0xB7, 0xB3, 0xCB, 0xB0, 0xD5, 0x82, 0x0D,
-    0x43, 0xDC, 0x68, 0x86, 0xC8, 0x6C, 0x89, 0x3D, 0x69, 0xA8, 0x0F, 0xBD, 0x8A, 0x7A, 0x1B, 0xFA,
-    0x9B, 0xF8, 0xB7, 0x6F, 0x4D, 0x08, 0x53, 0x69, 0x1D, 0x23, 0xB7, 0x72, 0x45, 0xE9, 0xCC, 0x41,
-    0x78, 0x5D, 0x69, 0x5C, 0xD8, 0xDF, 0xCD, 0x1D, 0x69, 0x7F, 0x83, 0xEB, 0xAE, 0xC7, 0x65, 0x86,
-    0x48, 0x01, 0xC7, 0x0F, 0x1A, 0x33, 0x57, 0x12, 0x17, 0x95, 0x0A, 0xEB, 0x3F, 0x4A, 0x95, 0xD2,
-    0xF2, 0x2A, 0xEE, 0xAA, 0xE8, 0xA9, 0xAC, 0xCB, 0xC8, 0x9D, 0xFF, 0x3B, 0x63, 0xD6, 0x8D, 0x82,
-    0xAF, 0x54, 0xA5, 0x4E, 0xAC, 0x20, 0xAB, 0x83, 0x63, 0x8C, 0x5F, 0xAE, 0xA9, 0xB8, 0x20, 0x88,
-    0x09, 0xE2, 0xDB, 0x0E, 0xDB, 0x12, 0x12, 0x84, 0x7B, 0x3D, 0x06, 0x47, 0x75, 0x68, 0x2A, 0x89,
-    0x8C, 0xE5, 0x1C, 0x51, 0x17, 0xC4, 0x88, 0x9B, 0x6A, 0x38, 0x2E, 0x5D, 0xD8, 0xE8, 0x62, 0x1C,
-    0x9D, 0x00, 0xB0, 0x60, 0xEE, 0x4B, 0x90, 0xAA, 0x3D, 0x49, 0xFB, 0x0E, 0xFD, 0x1A, 0xD1, 0x51,
-    0xCF, 0xFA, 0x48, 0x5A, 0x45, 0xA3, 0xD9, 0xEC, 0x25, 0xDF, 0x6C, 0x19, 0x68, 0x4C, 0xF4, 0x33,
-    0x2D, 0x0C, 0x8E, 0xA5, 0x83, 0xED, 0x5A, 0xFC, 0xD7, 0xA3, 0x43, 0xED, 0x50, 0x65, 0x72, 0x9E,
-    0x9A, 0x4C, 0xC6, 0x53, 0x91, 0xC9, 0x77, 0xEA, 0x31, 0xA8, 0x1F, 0xA9, 0xC6, 0xA0, 0x6E, 0x88,
-    0x10, 0x11, 0x88, 0xCD, 0xC9, 0x0B, 0xF6, 0x20, 0xD3, 0x3A, 0xA9, 0x39, 0x67, 0xE1, 0x78, 0x0C,
-    0x56, 0x15, 0x48, 0x38, 0x3E, 0x06, 0x3A, 0xD0, 0x0E, 0x23, 0xF8, 0xF7, 0xE3, 0xCC, 0xCC, 0x18,
-    0x37, 0x75, 0xED, 0xB8, 0x3D, 0x9D, 0x00, 0xB7, 0x78, 0xC2, 0x2F, 0x2D, 0x7B, 0x65, 0x39, 0xEB,
-    0xF2, 0xB6, 0x63, 0x42, 0x8C, 0xAC, 0xB2, 0x85, 0xD7, 0x8F, 0xC6, 0x98, 0x43, 0x30, 0x8F, 0xE0,
-    0x8A, 0xFC, 0x57, 0x5A, 0x95, 0x27, 0x44, 0x1D, 0x2D, 0xF3, 0xDE, 0x47, 0x39, 0x32, 0x43, 0x38,
-    0x69, 0x1B, 0x56, 0xDF, 0x3A, 0x96, 0xE7, 0x86, 0x48, 0x5B, 0x91, 0xD2, 0x20, 0x87, 0x49, 0xD9,
-    0xAB, 0x71, 0xCD, 0xE8, 0xBB, 0xE5, 0xFC, 0xE2, 0x68, 0x42, 0x4D, 0xF0, 0x47, 0x4D, 0xF6, 0xCD,
-    0x46, 0xA3, 0x23, 0xC1, 0x33, 0x4A, 0x01, 0x4B, 0x77, 0x40, 0x63, 0x34, 0xB0, 0xC8, 0x91, 0x34,
-    0x01, 0xAC, 0x34, 0x18, 0xA8, 0x71, 0x50, 0x2C, 0x28, 0x57, 0xDC, 0x12, 0xB5, 0xD9, 0x3A, 0xAF,
-    0xD2, 0x2B, 0xA2, 0xB5, 0x02, 0x22, 0x3D, 0x97, 0x7E, 0xB3, 0x03, 0x06, 0x0F, 0x79, 0x3F, 0x0B,
-    0x63, 0x2F, 0x68, 0x78, 0x5D, 0x3A, 0x9E, 0x1B, 0x23, 0x43, 0x5F, 0x3B, 0xAE, 0xED, 0xC8, 0x9A,
-    0x51, 0x8C, 0x39, 0xED, 0x45, 0x66, 0x76, 0x19, 0xD3, 0x69, 0x7C, 0xE3, 0x43, 0x20, 0x65, 0xCD,
-    0xF9, 0x80, 0x0E, 0xC9, 0x7E, 0x38, 0xA5, 0xCC, 0x66, 0x48, 0x65, 0xFE, 0x2E, 0x9E, 0x95, 0x92,
-    0xF4, 0x98, 0x45, 0xC8, 0x60, 0x8A, 0xB9, 0xF0, 0x51, 0xC2, 0xB1, 0x0A, 0x10, 0x1A, 0xA1, 0x67,
-    0x42, 0xCE, 0xEE, 0x6B, 0xBF, 0x51, 0x07, 0x0C, 0xBC, 0x72, 0xCA, 0x16, 0xE3, 0xA3, 0x75, 0x85,
-    0xD5, 0xED, 0x26, 0x6A, 0xDE, 0x34, 0x54, 0x40, 0xB5, 0xBD, 0x83, 0x5F, 0x21, 0xE1, 0x4B, 0x57,
-    0xE7, 0x01, 0x66, 0x14, 0x34, 0x1A, 0x79, 0xDB, 0x89, 0x2B, 0x43, 0x30, 0x87, 0x4E, 0x98, 0xDA,
-    0x5F, 0x79, 0x81, 0xFD, 0xAF, 0x2C, 0x02, 0x8F, 0x75, 0xD8, 0x89, 0x0C, 0x30, 0x52, 0x43, 0x6A,
-    0x2A, 0xF1, 0x88, 0x02, 0xCB, 0x94, 0x03, 0x80, 0xBF, 0x9E, 0xBC, 0xA4, 0x22, 0xB7, 0xE4, 0xC3,
-    0x51, 0x65, 0x01, 0xA9, 0x97, 0x40, 0x65, 0x8E, 0x3F, 0xE9, 0x2A, 0xC8, 0x83, 0xB4, 0xE7, 0xED,
-    0x2A, 0xF4, 0x48, 0x1B, 0x3A, 0xCA, 0x04, 0xB3, 0xA3, 0xFD, 0xE7, 0x75, 0x26, 0x7D, 0x9B, 0x87,
-    0xCC, 0xB9, 0x61, 0xDC, 0x06, 0x84, 0xED, 0x4B, 0xE3, 0xF5, 0xB9, 0x31, 0x3D, 0x12, 0xAB, 0x7D,
-    0x8B, 0xAD, 0x1E, 0x32, 0x6A, 0x8D, 0x2C, 0x87, 0x91, 0x1F, 0x1E, 0x0C, 0x80, 0x0D, 0xF7, 0x2A,
-    0x2F, 0xA8, 0xEB, 0xC0, 0x2B, 0xAD, 0x37, 0xC1, 0xA1, 0x97, 0x99, 0x2C, 0xB5, 0xBF, 0x2E, 0x01,
-    0xE7, 0x90, 0x76, 0x5A, 0x2D, 0xC5, 0x34, 0x4B, 0xFF, 0xD5, 0x7B, 0x6C, 0x4E, 0x27, 0x89, 0x87,
-    0x38, 0xD6, 0xC2, 0xDA, 0x5D, 0x39, 0xFD, 0xFD, 0x74, 0x12, 0x5E, 0xAA, 0x01, 0x9E, 0x4A, 0x21,
-    0x69, 0xF8, 0xFE, 0xA8, 0x82, 0xA4, 0x6D, 0xED, 0xD7, 0xB6, 0x75, 0x55, 0x99, 0x4E, 0xD1, 0x5C,
-    0x44, 0xA5, 0x7F, 0xE2, 0x44, 0x30, 0xB9, 0x7E, 0x16, 0x28, 0xB2, 0xA2, 0xA9, 0x97, 0x56, 0x6F,
-    0x3A, 0x05, 0x3B, 0x38, 0xA9, 0x25, 0x4B, 0x8A, 0x0F, 0xC8, 0x94, 0x3C, 0xA8, 0xFC, 0x2E, 0x90,
-    0x02, 0xA8, 0x6C, 0xE0, 0x92, 0xD3, 0x29, 0x51, 0x76, 0xB0, 0xA8, 0xAB, 0x1B, 0xA9, 0x94, 0xC0,
-    0x59, 0xEE, 0x5B, 0x19, 0x1D, 0x40, 0xD9, 0xE1, 0xCA, 0xF7, 0x65, 0x00, 0xB5, 0xF2, 0x2E, 0x4C,
-    0x3C, 0x12, 0x9F, 0x1A, 0x30, 0x06, 0x3D, 0x75, 0x20, 0x22, 0xD1, 0xBD, 0xBA, 0xDC, 0x2B, 0x58,
-    0xBE, 0x8A, 0x58, 0x5B, 0xAA, 0xD8, 0xF3, 0x00, 0xED, 0x9D, 0x79, 0x1D, 0xFA, 0xC0, 0x46, 0xE6,
-    0x15, 0xD1, 0xE6, 0xDF, 0x65, 0x70, 0x1E, 0x0E, 0xD0, 0x0D, 0xD9, 0x78, 0x1B, 0x56, 0xFE, 0xDD,
-    0x25, 0x53, 0xD3, 0x02, 0x61, 0xA0, 0xBD, 0x6A, 0xD5, 0xCF, 0xD5, 0x04, 0x95, 0xF9, 0xF6, 0x2B,
-    0x5A, 0xE0, 0xEC, 0xDC, 0x0C, 0x60, 0x70, 0xAA, 0xCB, 0x5B, 0x37, 0xD4, 0x40, 0xE8, 0x99, 0xB1,
-    0x14, 0x00, 0xCD, 0xE6, 0xD0, 0x43, 0xCC, 0x42, 0x7D, 0xC0, 0xD4, 0xD3, 0x93, 0x53, 0x83, 0x2B,
-    0xE9, 0x3B, 0x34, 0xA8, 0xD9, 0x27, 0x74, 0xB6, 0xC6, 0x19, 0xF2, 0xA7, 0x2C, 0xB0, 0x90, 0xAD,
-    0x93, 0xC1, 0x24, 0x97, 0x7D, 0x22, 0xEA, 0xDA, 0x8E, 0x96, 0x7A, 0xBE, 0x6A, 0x9A, 0x70, 0x9A,
-    0xAA, 0xF8, 0x1D, 0xD3, 0x54, 0xDB, 0x5B, 0x08, 0xEF, 0x82, 0xD0, 0x30, 0x1C, 0x1A, 0xCB, 0x36,
-    0xF8, 0xE4, 0x6A, 0xC6, 0xF9, 0xBE, 0xB2, 0x59, 0xD7, 0xAD, 0x2A, 0x15, 0x41, 0xE4, 0xEA, 0x3E,
-    0x9A, 0x14, 0xCF, 0x65, 0xA3, 0x9B, 0x43, 0xD1, 0x89, 0x55, 0xC7, 0x41, 0x91, 0x8B, 0xC2, 0x09,
-    0xAD, 0xDF, 0x2B, 0x82, 0x73, 0xA8, 0x65, 0xCB, 0x6C, 0x87, 0xF2, 0xF2, 0x40, 0xAA, 0xB6, 0xF2,
-    0x1D, 0xB8, 0xDB, 0xFC, 0x27, 0x3A, 0xD7, 0xC7, 0x54, 0x9C, 0xA9, 0x09, 0x73, 0x01, 0x71, 0xD5,
-    0x70, 0x7F, 0x2E, 0x1F, 0x6A, 0x09, 0xB1, 0x9F, 0xBB, 0xEF, 0xB3, 0x47, 0xE1, 0xB3, 0xA3, 0xDA,
-    0x21, 0x15, 0x96, 0xE2, 0x8E, 0xCC, 0xC0, 0x71, 0xFE, 0xFC, 0x29, 0xBF, 0x80, 0x72, 0x67, 0x88,
-    0x3E, 0xB9, 0x99, 0x87, 0x90, 0x74, 0x44, 0xCA, 0x8D, 0xF5, 0xDD, 0x3C, 0xA1, 0x7F, 0x66, 0xA3,
-    0xD7, 0xAE, 0x1B, 0xBD, 0x7F, 0x90, 0xD0, 0x57, 0x99, 0x3C, 0x91, 0x01, 0x67, 0xDE, 0xD2, 0xD1,
-    0x2D, 0xB0, 0xF2, 0x80, 0xCF, 0x6D, 0xD3, 0xFF, 0x17, 0xF0, 0x30, 0x08, 0x73, 0x4F, 0xB0, 0x86,
-    0x65, 0xE1, 0x5F, 0xE2, 0x2A, 0x69, 0x83, 0x3A, 0x9C, 0xE6, 0x16, 0x7C, 0xCA, 0x5A, 0x1C, 0xE3,
-    0x53, 0x4A, 0x5B, 0x11, 0x97, 0xC7, 0xC0, 0x52, 0xAB, 0x17, 0x90, 0x72, 0xA5, 0x45, 0x38, 0xC4,
-    0x5D, 0x80, 0xF4, 0x70, 0x57, 0x74, 0x60, 0xCE, 0xD7, 0xA0, 0xEA, 0x16, 0x60, 0xAD, 0xA7, 0x52,
-    0x7A, 0x08, 0x59, 0x58, 0xE4, 0x19, 0x9D, 0x4A, 0xAF, 0x27, 0x4F, 0x58, 0xAD, 0xD3, 0x36, 0xF6,
-    0x33, 0xC8, 0x24, 0x6F, 0xD5, 0x82, 0x95, 0x96, 0x61, 0x5A, 0xF7, 0xBF, 0xD3, 0x83, 0x84, 0x88,
-    0x06, 0x51, 0x5F, 0x4E, 0xD5, 0x11, 0x3C, 0x4F, 0xC8, 0x98, 0xB1, 0x4A, 0x1C, 0xBD, 0xDE, 0x15,
-    0xB5, 0x3C, 0xD6, 0x87, 0xC7, 0x1C, 0x7A, 0x02, 0xD8, 0xF9, 0x3D, 0xA7, 0x7D, 0xD7, 0x9B, 0xC2,
-    0x6F, 0x38, 0xB5, 0x4C, 0xA1, 0x0A, 0x57, 0xA0, 0x38, 0xE7, 0xE0, 0xEB, 0xC2, 0xCA, 0x2B, 0x6E,
-    0x59, 0x85, 0xB3, 0x7C, 0xD2, 0x10, 0x9F, 0x3F, 0xD9, 0xFA, 0x83, 0xAF, 0x0D, 0xBD, 0xB4, 0x77,
-    0xA3, 0xA3, 0xFC, 0x9F, 0x7F, 0xA7, 0x6D, 0xC8, 0xF9, 0xD7, 0x0A, 0x14, 0x5E, 0xE4, 0x54, 0x6D,
-    0x41, 0x3A, 0x9C, 0x72, 0x5C, 0xD7, 0xBD, 0xFF, 0x68, 0x4E, 0xFE, 0xC3, 0x65, 0xDC, 0x74, 0x98,
-    0x4B, 0x70, 0xCF, 0xCE, 0x7B, 0xA7, 0x64, 0x38, 0x6C, 0xF1, 0xDE, 0xC0, 0xAD, 0xDB, 0x5A, 0x4B,
-    0x80, 0x54, 0x51, 0xEE, 0x5C, 0x35, 0xD0, 0x6B, 0x19, 0x88, 0x85, 0x62, 0x49, 0xE7, 0x61, 0x0B,
-    0xEC, 0x7B, 0xBF, 0x33, 0xD9, 0xFD, 0xDC, 0x9B, 0x5A, 0x25, 0x71, 0xDF, 0x7D, 0x8B, 0xB4, 0xFE,
-    0xC2, 0x20, 0xEE, 0x37, 0x70, 0x08, 0xF6, 0xD1, 0x5A, 0x45, 0x36, 0x37, 0x07, 0xCD, 0x5A, 0x23,
-    0xB1, 0x6A, 0xC3, 0x10, 0x91, 0x45, 0xE3, 0x53, 0x9D, 0x12, 0x0D, 0x82, 0x39, 0x78, 0xFD, 0x90,
-    0x26, 0xD1, 0x4A, 0x75, 0xE4, 0x40, 0x1C, 0x8B, 0x53, 0x34, 0x26, 0x71, 0xA3, 0xB0, 0x71, 0x16,
-    0x0D, 0x1E, 0x40, 0x6D, 0x45, 0xBA, 0xD9, 0x50, 0x2C, 0xEC, 0x44, 0x73, 0xD3, 0x20, 0xBA, 0xD9,
-    0x02, 0x8B, 0xB1, 0x8B, 0xE4, 0x28, 0x2C, 0xEE, 0x9D, 0x5A, 0xBB, 0xF8, 0x0C, 0x6D, 0x0A, 0x4C,
-    0x0F, 0x6C, 0x22, 0x91, 0x82, 0xF4, 0x53, 0x33, 0xC9, 0x00, 0xA6, 0xF6, 0x5A, 0x04, 0xE5, 0xF2,
-    0x64, 0x41, 0xA4, 0xBD, 0x3C, 0x43, 0xDD, 0xA4, 0xF4, 0xEC, 0x95, 0x51, 0x51, 0xA5, 0x2A, 0xE7,
-    0xBE, 0x8D, 0x99, 0x91, 0x91, 0xCD, 0xB4, 0x01, 0x61, 0xE9, 0xB5, 0xC1, 0x7A, 0xE2, 0x0D, 0x16,
-    0x8C, 0xEB, 0x8E, 0xF8, 0x93, 0xDF, 0xDE, 0x19, 0x8C, 0xC4, 0x00, 0xEB, 0x5A, 0xEE, 0xB0, 0x0C,
-    0x6D, 0xBA, 0x82, 0xEE, 0x35, 0xB5, 0xDC, 0x55, 0x41, 0x97, 0x2D, 0xD1, 0xD8, 0xA1, 0x96, 0x15,
-    0x6A, 0xFC, 0x91, 0x99, 0x0B, 0xBA, 0xDA, 0x86, 0x70, 0x6E, 0x6D, 0x58, 0x66, 0x94, 0x5C, 0xD5,
-    0x12, 0xCE, 0x11, 0x78, 0x28, 0xD4, 0xD1, 0xCD, 0xFD, 0x02, 0xA7, 0x22, 0x67, 0x4F, 0x5D, 0x39,
-    0x8E, 0x0B, 0x82, 0xD5, 0x28, 0x67, 0xA2, 0x93, 0x9F, 0xDC, 0x91, 0x78, 0x95, 0xFD, 0xEF, 0x0E,
-    0x0B, 0x04, 0x54, 0xDF, 0x8E, 0x3A, 0x03, 0x8F, 0x4D, 0x57, 0x83, 0x84, 0x00, 0x5E, 0x9C, 0xF9,
-    0x53, 0xBB, 0x51, 0x11, 0x0C, 0x0A, 0x04, 0xAF, 0xB0, 0x86, 0x60, 0x83, 0x8E, 0x33, 0xCB, 0x3A,
-    0x53, 0xAA, 0xF5, 0xE6, 0xF4, 0xDA, 0x21, 0x9A, 0x1B, 0xC3, 0x10, 0xC6, 0x52, 0xEB, 0x54, 0x1B,
-    0x3E, 0x28, 0x7D, 0x10, 0x38, 0xAB, 0xD5, 0x7A, 0x74, 0x99, 0x01, 0x80, 0x73, 0x6A, 0xB3, 0xBD,
-    0xAD, 0xBC, 0x90, 0xD1, 0x7C, 0xE3, 0x4F, 0x3B, 0x4F, 0x1D, 0xF3, 0x0C, 0xE1, 0xD0, 0x4F, 0xAB,
-    0x67, 0xD7, 0x66, 0xD1, 0x86, 0xD3, 0xF9, 0x52, 0x64, 0xF8, 0xF3, 0xBC, 0x79, 0xFB, 0x25, 0xC9,
-    0xF8, 0x7F, 0xE4, 0x85, 0x58, 0xF5, 0x2D, 0xA0, 0xA8, 0xCF, 0x97, 0xD7, 0x92, 0x62, 0xF4, 0x87,
-    0x69, 0x21, 0xBB, 0x9C, 0xA5, 0x21, 0x1A, 0xF2, 0xEA, 0xC9, 0x7C, 0xEA, 0x03, 0x22, 0xAD, 0x5C,
-    0x62, 0x95, 0x6F, 0x84, 0x67, 0x09, 0x75, 0xC2, 0xD4, 0xEA, 0x84, 0x69, 0xAF, 0x13, 0xA6, 0x74,
-    0x5D, 0x51, 0xEB, 0x4A, 0xAE, 0x09, 0xAB, 0xAB, 0xD0, 0x7C, 0x2D, 0x2A, 0x80, 0x5B, 0xD8, 0x8E,
-    0xA6, 0xC2, 0xF8, 0x09, 0xB5, 0x0C, 0xC5, 0x0E, 0x10, 0x9F, 0x81, 0x0B, 0xF3, 0xEE, 0xEE, 0x51,
-    0xA7, 0x1B, 0xE9, 0x3A, 0x96, 0xF9, 0xC3, 0x15, 0x2C, 0x7D, 0x05, 0x1B, 0xCC, 0xCF, 0xD5, 0x8E,
-    0xE8, 0x16, 0xD7, 0x6C, 0xED, 0xAF, 0xF7, 0xCC, 0x68, 0x6E, 0x27, 0x3A, 0x2A, 0x8F, 0xA8, 0x7B,
-    0x07, 0xDF, 0x16, 0x48, 0xAA, 0xB4, 0xF6, 0x59, 0xC3, 0x50, 0x10, 0xC8, 0x7A, 0x60, 0xC9, 0x91,
-    0xB8, 0x16, 0x0B, 0x61, 0xE7, 0x08, 0x30, 0x65, 0xFB, 0xAD, 0x21, 0xCD, 0x9F, 0x4F, 0xE5, 0x1D,
-    0x39, 0x2B, 0x6D, 0xCE, 0x69, 0xFB, 0x7E, 0x36, 0x46, 0x05, 0x9C, 0x89, 0x8E, 0x7B, 0x7E, 0xC6,
-    0x00, 0xE6, 0xCD, 0x61, 0x40, 0x44, 0xBF, 0xE5, 0xDE, 0x35, 0xE9, 0xAF, 0x17, 0xDD, 0x07, 0xA8,
-    0x09, 0x71, 0x76, 0xCF, 0x32, 0x9C, 0x19, 0xBB, 0x26, 0x48, 0x6F, 0xCC, 0x9E, 0x84, 0xE9, 0xA6,
-    0xE9, 0x00, 0xB7, 0xD9, 0x7B, 0x95, 0x76, 0x90, 0xD5, 0x99, 0x6B, 0x0B, 0x79, 0x55, 0x84, 0xF9,
-    0x4A, 0x79, 0xE1, 0x69, 0xBD, 0x5C, 0xBB, 0x84, 0x47, 0xE8, 0x26, 0xC3, 0x8A, 0xBC, 0x78, 0x9E,
-    0x73, 0x87, 0xC1, 0x45, 0xED, 0x10, 0xED, 0x61, 0x8B, 0x0E, 0x48, 0x88, 0x65, 0x09, 0xB9, 0xCE,
-    0x1B, 0xA3, 0xCD, 0x43, 0xE6, 0x5B, 0x2C, 0xC1, 0x46, 0x5A, 0x6A, 0x65, 0x8A, 0xAC, 0xDD, 0x06,
-    0x7D, 0x2F, 0x88, 0x85, 0x21, 0xC3, 0xCA, 0x10, 0x2D, 0x96, 0x68, 0xB1, 0x72, 0x7D, 0x09, 0xF2,
-    0x91, 0x53, 0x2D, 0x60, 0x5E, 0xCE, 0xEA, 0x75, 0x28, 0x0F, 0x23, 0xDD, 0xB2, 0xE2, 0xA4, 0xAF,
-    0x71, 0x65, 0xEF, 0xE0, 0x96, 0xBA, 0x0D, 0xEF, 0x2A, 0x36, 0xF7, 0x50, 0x4C, 0xC0, 0x84, 0x3F,
-    0x0E, 0x27, 0xF3, 0xBC, 0xCB, 0x02, 0x7B, 0xBF, 0x5A, 0xCE, 0xB8, 0xCF, 0xBD, 0xE6, 0x27, 0x04,
-    0x04, 0x6C, 0x60, 0x0A, 0xDD, 0xAE, 0x7C, 0x9F, 0xB5, 0x90, 0x82, 0x81, 0xAE, 0xB8, 0xFD, 0x9A,
-    0x79, 0xE5, 0x9B, 0xC4, 0x99, 0x20, 0x03, 0xB0, 0x3B, 0x9D, 0x20, 0x99, 0x7F, 0x17, 0x8E, 0xAF,
-    0xC3, 0xD9, 0xD3, 0x29, 0xF4, 0xEA, 0x28, 0x38, 0x93, 0x1D, 0xBC, 0x4E, 0x9C, 0xB9, 0x9E, 0xD4,
-    0xB2, 0xA5, 0x4D, 0xE0, 0xBA, 0x49, 0xED, 0x8B, 0xAB, 0x39, 0x58, 0x37, 0x73, 0xC5, 0x7C, 0xC0,
-    0x25, 0xAA, 0xAE, 0xDD, 0xBB, 0x34, 0x7D, 0x90, 0x1B, 0xD4, 0x40, 0x60, 0x7C, 0x85, 0x6C, 0xA7,
-    0x4E, 0x1A, 0x8F, 0xEF, 0x1B, 0xA5, 0x95, 0x9D, 0xCB, 0xBC, 0x19, 0x36, 0xC7, 0xD7, 0x43, 0x84,
-    0x0D, 0x9D, 0xC6, 0x02, 0x62, 0x47, 0xB2, 0x2F, 0x3D, 0xFB, 0xC9, 0x27, 0x67, 0x65, 0x28, 0x87,
-    0x54, 0x42, 0x31, 0x3A, 0x66, 0x90, 0xE9, 0x0B, 0x47, 0xDF, 0x34, 0x0E, 0xAB, 0x03, 0x18, 0x19,
-    0x9D, 0xD6, 0xD8, 0xCC, 0x21, 0xE6, 0xCF, 0x9B, 0xEE, 0x57, 0xE9, 0x00, 0x7C, 0xE9, 0x42, 0x6D,
-    0xE9, 0xCA, 0xD2, 0x93, 0xF6, 0x9F, 0xF0, 0x98, 0xFB, 0xAE, 0xBD, 0x2B, 0x95, 0x2E, 0xAC, 0x12,
-    0xF9, 0x40, 0xFA, 0xA0, 0x0D, 0xC1, 0xDC, 0x86, 0xFD, 0x75, 0xF6, 0x3B, 0x28, 0x81, 0x80, 0x93,
-    0x24, 0x00, 0x12, 0x65, 0x61, 0x3B, 0xB0, 0x3C, 0x6D, 0x92, 0xD1, 0xE3, 0x78, 0x40, 0x2C, 0x05,
-    0x0B, 0x0A, 0xE1, 0x6E, 0x03, 0x3B, 0xCD, 0x5F, 0xBE, 0xD4, 0x63, 0x95, 0xF8, 0x97, 0xFD, 0x19,
-    0x82, 0x8F, 0x61, 0x48, 0x8F, 0x31, 0x45, 0x78, 0x31, 0xFA, 0x84, 0x50, 0x6C, 0xF7, 0x61, 0x6A,
-    0x4B, 0x8C, 0xF4, 0x4A, 0x63, 0x6D, 0xAD, 0x45, 0xAE, 0xB2, 0x75, 0x34, 0xA8, 0x68, 0xF4, 0xFD,
-    0x81, 0x4A, 0xEB, 0xE8, 0xF1, 0x1E, 0xA2, 0x3C, 0x4D, 0x12, 0x74, 0x26, 0x2D, 0xD6, 0xB6, 0xFA,
-    0x27, 0xDA, 0x5B, 0x48, 0x95, 0xE7, 0x6C, 0x78, 0x16, 0xCB, 0xFC, 0xBA, 0x97, 0x79, 0xD9, 0x96,
-    0xD6, 0x1F, 0x87, 0xB2, 0x8F, 0xDB, 0xF4, 0xBD, 0xB2, 0x2A, 0x59, 0x7C, 0x09, 0xBB, 0xB8, 0x4E,
-    0xEA, 0xBC, 0x18, 0xCC, 0x18, 0xF5, 0x49, 0x15, 0x37, 0x72, 0xB6, 0x33, 0x53, 0x32, 0x58, 0x13,
-    0x7D, 0xC8, 0xB7, 0x2A, 0xCA, 0x17, 0x06, 0xF8, 0x4F, 0x39, 0xB6, 0x8B, 0x04, 0x92, 0xAF, 0x3F,
-    0x84, 0xAC, 0x20, 0x42, 0x36, 0xC4, 0x17, 0x4D, 0x74, 0xCD, 0x0B, 0x8C, 0x9A, 0xC9, 0xCC, 0xAD,
-    0x79, 0xAE, 0x8E, 0x64, 0xC6, 0x65, 0x33, 0xEB, 0x74, 0x66, 0x46, 0x1F, 0x9D, 0x95, 0x73, 0x82,
-    0xAC, 0x99, 0x85, 0x9A, 0x92, 0x2A, 0x65, 0x39, 0x1B, 0x0E, 0x1A, 0xC1, 0x40, 0x72, 0x88, 0x64,
-    0xCA, 0xA3, 0x84, 0xC8, 0x17, 0xF9, 0x1E, 0x9C, 0xBA, 0x7C, 0x45, 0x64, 0x0A, 0xA0, 0xDD, 0x10,
-    0xA4, 0x82, 0xC5, 0x72, 0xF5, 0x4E, 0x8A, 0x42, 0x93, 0x88, 0x85, 0x10, 0x9D, 0x04, 0x58, 0x21,
-    0xA9, 0x6F, 0x2C, 0x7B, 0x52, 0xBF, 0x1C, 0x5E, 0xE4, 0x1B, 0x75, 0xE7, 0x38, 0x25, 0xC0, 0xB1,
-    0x97, 0x3B, 0xCD, 0x7A, 0xC0, 0x69, 0x9B, 0x05, 0x30, 0x38, 0x7C, 0xF1, 0x27, 0x73, 0x87, 0xE8,
-    0x7B, 0x92, 0xAC, 0xF2, 0xE6, 0x0F, 0xD3, 0x87, 0xFC, 0x13, 0x33, 0x9E, 0x97, 0x98, 0xFA, 0xBC,
-    0xCC, 0x1C, 0xE8, 0x6D, 0x26, 0x07, 0x3F, 0xE5, 0xA3, 0x3E, 0x28, 0x5C, 0xA3, 0xDC, 0xBD, 0xAC,
-    0xA8, 0xDB, 0x73, 0x13, 0x8F, 0x95, 0x83, 0xB2, 0xB7, 0xB0, 0xB6, 0x9D, 0x9E, 0xEA, 0xE6, 0x09,
-    0x57, 0x4B, 0xE1, 0xCE, 0x03, 0x5C, 0x27, 0xBE, 0x46, 0xBD, 0xD3, 0xC1, 0xED, 0x63, 0x9C, 0xC4,
-    0x39, 0xCB, 0x9B, 0xB3, 0x03, 0x7B, 0x47, 0xFF, 0x8E, 0xCA, 0x80, 0x1B, 0x85, 0xA5, 0xB9, 0x88,
-    0x51, 0x29, 0xE0, 0x40, 0x0A, 0x07, 0xDD, 0x26, 0x4F, 0xFB, 0x94, 0x0A, 0xFF, 0xE8, 0xE0, 0xA6,
-    0x52, 0x43, 0xE0, 0xF2, 0xC2, 0xA8, 0xEB, 0xF9, 0xEB, 0x2E, 0x74, 0x3F, 0xEE, 0x0D, 0x8C, 0x69,
-    0x61, 0x86, 0x62, 0xB5, 0x40, 0x81, 0xC4, 0x9E, 0xB7, 0x3E, 0xEF, 0x5F, 0xCA, 0x1B, 0x34, 0x12,
-    0x25, 0x89, 0xCF, 0xF1, 0xB3, 0x6B, 0xDE, 0xF5, 0xD0, 0xB7, 0x31, 0xB2, 0xFC, 0xE4, 0xA9, 0xD1,
-    0x87, 0x2F, 0x82, 0x22, 0x20, 0xE0, 0x26, 0x3A, 0xC7, 0xA3, 0x55, 0x09, 0xDB, 0xCE, 0x13, 0xD0,
-    0x69, 0x3F, 0xEF, 0x24, 0x19, 0xE6, 0xC0, 0x05, 0xF5, 0x79, 0xD6, 0x94, 0x75, 0xD0, 0x46, 0x74,
-    0x6B, 0xF0, 0x46, 0x70, 0x4D, 0x27, 0xA5, 0xD3, 0xE1, 0xF4, 0x54, 0x36, 0xDE, 0xEA, 0xF8, 0xDC,
-    0x97, 0xF3, 0x16, 0x81, 0x79, 0x59, 0x32, 0x26, 0x95, 0x70, 0x92, 0x47, 0xBA, 0xE4, 0x61, 0xC9,
-    0x9E, 0x0F, 0x3A, 0xB3, 0x0D, 0x5F, 0xA3, 0xEF, 0x6A, 0x15, 0xDA, 0x9C, 0xD0, 0x5F, 0x7E, 0x6D,
-    0x7F, 0x9D, 0x9C, 0xC3, 0x85, 0xC9, 0x2E, 0x14, 0x4F, 0x67, 0xC8, 0x0F, 0x2C, 0xCD, 0x14, 0xF8,
-    0x5E, 0xA7, 0x49, 0xCA, 0x9F, 0xA4, 0xFA, 0xF4, 0xEC, 0xA5, 0xB4, 0xFA, 0xAA, 0x65, 0x72, 0xE1,
-    0x35, 0xC9, 0xCE, 0x80, 0x20, 0x9F, 0xE3, 0x14, 0x70, 0x08, 0x1B, 0x04, 0x19, 0xA3, 0x81, 0x8D,
-    0x7B, 0x67, 0x13, 0x35, 0x5C, 0xB3, 0xC0, 0xDC, 0x45, 0x13, 0x1E, 0x90, 0x77, 0x85, 0x6D, 0xC2,
-    0x92, 0xA2, 0x5C, 0x28, 0x47, 0xED, 0x44, 0x47, 0x8A, 0x27, 0x56, 0x4C, 0xE7, 0x66, 0x67, 0x70,
-    0xBF, 0xF9, 0x02, 0x84, 0x39, 0xE8, 0xC9, 0xCF, 0x60, 0x27, 0x70, 0x3B, 0x22, 0x0F, 0x77, 0x09,
-    0x3C, 0x91, 0xCD, 0xB6, 0x02, 0x57, 0x63, 0x59, 0x11, 0xC8, 0x5F, 0xDF, 0x0C, 0xA6, 0xBF, 0x86,
-    0xA6, 0xC8, 0x6F, 0x26, 0xE8, 0x4C, 0xAB, 0x38, 0x79, 0x49, 0x24, 0xF8, 0x5E, 0xC2, 0x11, 0x0E,
-    0x43, 0x4C, 0x74, 0x75, 0x6A, 0x99, 0xAA, 0x21, 0xDD, 0x8D, 0x17, 0xEA, 0x67, 0xBF, 0x17, 0x50,
-    0xAC, 0xCB, 0x45, 0x7F, 0xB0, 0x50, 0xCD, 0xAB, 0x2B, 0xDF, 0xAE, 0x8D, 0x92, 0xA8, 0x65, 0xA9,
-    0x74, 0xA2, 0x06, 0x6B, 0x40, 0x70, 0xAF, 0xBB, 0xA8, 0x5D, 0xE8, 0x18, 0x8F, 0x72, 0x7C, 0xEE,
-    0x6C, 0xC9, 0xAA, 0xC9, 0xE5, 0x5E, 0x59, 0xFD, 0xEC, 0x1B, 0x58, 0x83, 0x9F, 0x51, 0xCC, 0xE7,
-    0xDF, 0x50, 0x90, 0xD5, 0xE9, 0x5F, 0x29, 0xCB, 0x26, 0xDD, 0x4B, 0xB1, 0x78, 0xAB, 0xFF, 0x03,
-    0x2D, 0x90, 0xB1, 0x72, 0x13, 0x31, 0x14, 0x45, 0xAF, 0xAC, 0x78, 0xD7, 0xC3, 0xCE, 0xA0, 0x14,
-    0x50, 0x84, 0x02, 0xB9, 0xA0, 0x64, 0xBC, 0x14, 0x94, 0x6B, 0x4B, 0xC9, 0x16, 0x2E, 0xD2, 0xB8,
-    0xE0, 0x03, 0x28, 0xF8, 0x00, 0xCA, 0x14, 0xE0, 0xDD, 0x99, 0x14, 0x29, 0x28, 0xF0, 0x27, 0xF0,
-    0x11, 0x29, 0x28, 0x9C, 0xAC, 0x18, 0x17, 0x29, 0xDC, 0x08, 0x28, 0x52, 0xA4, 0x59, 0xE7, 0x0B,
-    0xE4, 0x19, 0x17, 0x1A, 0x22, 0xAD, 0x90, 0x09, 0xAF, 0xBC, 0xEF, 0xCD, 0xBD, 0xEF, 0x5C, 0xE0,
-    0x2D, 0x35, 0xCC, 0xE4, 0x2D, 0x57, 0x5C, 0x0E, 0x88, 0x1C, 0x67, 0x1B, 0x2F, 0xBE, 0xB4, 0x97,
-    0x00, 0x5E, 0xA0, 0xD7, 0x81, 0x3B, 0x74, 0x96, 0xAD, 0x8C, 0xA3, 0x3F, 0xEA, 0x3E, 0x9E, 0xD4,
-    0xE7, 0x1D, 0x6F, 0x42, 0x38, 0x75, 0xC3, 0x11, 0x44, 0xB8, 0x0B, 0xBE, 0x09, 0xEA, 0x00, 0xA9,
-    0x7A, 0xDA, 0x4C, 0x6F, 0x83, 0xE5, 0x1D, 0x9E, 0x23, 0x39, 0x71, 0x62, 0x65, 0x47, 0xD1, 0xA0,
-    0x67, 0xE6, 0x0D, 0x0B, 0xC6, 0x9F, 0x65, 0x12, 0xB3, 0x34, 0x94, 0x0F, 0x5B, 0xE3, 0x9E, 0x4D,
-    0x30, 0x87, 0xC7, 0x18, 0x49, 0x3C, 0x00, 0xB3, 0xC2, 0x9F, 0x8D, 0x2E, 0x5F, 0x7E, 0x1F, 0x57,
-    0x8E, 0xB7, 0x7B, 0x05, 0x44, 0xBD, 0xA1, 0xC6, 0x65, 0xF7, 0x8E, 0xDF, 0x18, 0xC1, 0xD4, 0x92,
-    0xE3, 0x70, 0xB0, 0xD7, 0x4D, 0xB6, 0xD2, 0x57, 0x6C, 0xAD, 0x63, 0x86, 0x68, 0x51, 0x01, 0x87,
-    0x18, 0x0C, 0x18, 0xBB, 0xF8, 0x6D, 0xDC, 0x92, 0xB3, 0xF3, 0x9F, 0xED, 0x70, 0x88, 0x0F, 0x68,
-    0xAC, 0x08, 0x6B, 0xED, 0xBF, 0x51, 0x15, 0xF7, 0x8B, 0x4F, 0xAC, 0x34, 0xF3, 0xAC, 0x6D, 0x68,
-    0x4B, 0xA4, 0x50, 0x95, 0x74, 0xA9, 0xC9, 0x89, 0x65, 0x75, 0x4C, 0x39, 0xF6, 0xE2, 0xC2, 0xCC,
-    0x69, 0x2B, 0xB0, 0x03, 0xB2, 0x72, 0x6B, 0x97, 0x13, 0x46, 0x6B, 0x10, 0xE9, 0x99, 0x76, 0x62,
-    0xAA, 0xDF, 0xFF, 0xE7, 0x38, 0xC2, 0x01, 0x4A, 0x73, 0xFD, 0x8F, 0xE3, 0x55, 0x02, 0xB2, 0x60,
-    0x76, 0x5C, 0x14, 0xAF, 0x8B, 0x22, 0xDF, 0x25, 0xB2, 0x77, 0xEC, 0x98, 0x72, 0x3C, 0xD5, 0xB3,
-    0xB8, 0xE0, 0xB1, 0xC2, 0x09, 0x35, 0x15, 0x59, 0x44, 0x97, 0xB6, 0xC8, 0x6A, 0xCB, 0xBA, 0x4A,
-    0xA1, 0x3F, 0xBD, 0xB7, 0x5E, 0xF0, 0xF5, 0x66, 0xB6, 0xA7, 0xF0, 0x60, 0x0E, 0xC1, 0xB1, 0x5F,
-    0x3B, 0x4F, 0x37, 0x92, 0xEC, 0x4B, 0xAA, 0xC9, 0x67, 0x72, 0xF7, 0xC7, 0x89, 0x20, 0x9B, 0xF8,
-    0x18, 0xFA, 0xF2, 0xC4, 0xB3, 0xEA, 0x21, 0x7C, 0xF5, 0x1F, 0x85, 0xC4, 0x63, 0xC9, 0x55, 0x50,
-    0x78, 0x17, 0xD9, 0xF2, 0x70, 0xAB, 0xAF, 0x1F, 0xD9, 0xE2, 0x50, 0x8D, 0xBC, 0x26, 0x0E, 0x4C,
-    0xC3, 0xA1, 0xA7, 0xA2, 0x92, 0x97, 0xDB, 0x4E, 0xDC, 0x98, 0x2E, 0xC1, 0x62, 0x92, 0xEA, 0xAB,
-    0xCC, 0x55, 0x12, 0x7F, 0x01, 0xD5, 0x7D, 0x4D, 0x8C, 0xDD, 0xD6, 0x95, 0xE6, 0x25, 0x59, 0x25,
-    0x26, 0x26, 0x3A, 0xD4, 0x42, 0x76, 0x67, 0x9C, 0xEE, 0x30, 0x0B, 0x37, 0xD0, 0x0E, 0x3A, 0xC3,
-    0x2C, 0x7A, 0x11, 0x0C, 0x6C, 0x5D, 0xDA, 0x0A, 0xDA, 0x0D, 0x18, 0x03, 0x6B, 0x21, 0xA5, 0x81,
-    0x08, 0x0D, 0x05, 0x83, 0x2C, 0x9C, 0x00, 0xD3, 0x85, 0x06, 0xBC, 0xC8, 0xC2, 0x16, 0x29, 0x6B,
-    0xE1, 0x85, 0x17, 0xAE, 0xC6, 0x74, 0x67, 0x80, 0x18, 0x83, 0x78, 0xA1, 0x1E, 0xB4, 0x4B, 0x40,
-    0x57, 0x16, 0x5E, 0x34, 0x30, 0x4A, 0x91, 0x52, 0x2D, 0xB4, 0x30, 0x06, 0xA6, 0xAD, 0x4E, 0x1B,
-    0x68, 0x03, 0x63, 0xFA, 0x27, 0x09, 0x20, 0x2F, 0x8A, 0xB6, 0xE9, 0x98, 0x55, 0x22, 0x79, 0xE7,
-    0xFB, 0xCE, 0xBD, 0xAC, 0xF7, 0x4A, 0xFE, 0xE9, 0xD8, 0x96, 0xED, 0x44, 0xB6, 0xF9, 0x54, 0xF5,
-    0xDE, 0x23, 0xEF, 0x3D, 0xF7, 0x9C, 0xEF, 0x7C, 0xE7, 0xE7, 0x5E, 0x2B, 0x25, 0x7F, 0xFC, 0x8A,
-    0xD7, 0x91, 0x97, 0xBC, 0xC6, 0x25, 0x9A, 0xF8, 0xD7, 0x94, 0x7F, 0x55, 0xDF, 0x53, 0x4B, 0x7F,
-    0x62, 0x63, 0x4C, 0x15, 0xE0, 0xD2, 0xAA, 0x64, 0xEF, 0x42, 0xAF, 0x82, 0x41, 0x9D, 0x51, 0x9E,
-    0x51, 0x49, 0xA6, 0xF2, 0x2A, 0x2C, 0x54, 0xDA, 0xF0, 0x43, 0x1D, 0x2E, 0xC1, 0xF4, 0xDD, 0x75,
-    0xBC, 0x63, 0x7A, 0xA5, 0x4A, 0x33, 0x28, 0xA5, 0x17, 0xEF, 0x0C, 0x6A, 0x85, 0xDF, 0x89, 0x0A,
-    0x55, 0x16, 0x41, 0xA3, 0x74, 0x1D, 0x74, 0x2A, 0x99, 0xCA, 0x41, 0xE5, 0xB8, 0xB1, 0xD2, 0xB8,
-    0x64, 0xF8, 0xD8, 0xA1, 0xE2, 0xFB, 0x4A, 0x85, 0x5D, 0x89, 0x2F, 0x8C, 0x1A, 0xE3, 0xDB, 0x8A,
-    0x31, 0x9C, 0x15, 0x95, 0x2D, 0x0F, 0x07, 0x1F, 0x1D, 0xE4, 0x0B, 0xB8, 0xDF, 0x46, 0x59, 0x28,
-    0x5D, 0x85, 0x8D, 0x4A, 0x5A, 0xAF, 0x53, 0xE1, 0xA0, 0x7E, 0xA4, 0x7C, 0x99, 0x86, 0xDC, 0x4D,
-    0xFF, 0xF2, 0x69, 0xA5, 0x12, 0x63, 0x0A, 0x15, 0x61, 0x06, 0x18, 0xDD, 0xE2, 0x9D, 0x0A, 0xF7,
-    0x4C, 0x5A, 0xF5, 0x2F, 0x2A, 0xEA, 0xD5, 0x51, 0x3C, 0x4C, 0xE9, 0xCC, 0x33, 0x6F, 0x98, 0x2A,
-    0xE4, 0x34, 0x39, 0xD7, 0xCE, 0x3E, 0x2C, 0xE1, 0xD3, 0x52, 0x5E, 0xF4, 0x9E, 0xB9, 0x30, 0x68,
-    0xCF, 0xF8, 0xBD, 0xF6, 0x27, 0xBF, 0x3B, 0x1A, 0x8C, 0x7E, 0xC3, 0x69, 0x29, 0x7B, 0x09, 0xA7,
-    0x29, 0xE3, 0x63, 0x5A, 0x8A, 0x6B, 0x50, 0x71, 0x1B, 0x0D, 0x78, 0x00, 0x6E, 0x8C, 0xCB, 0x04,
-    0x11, 0x61, 0x58, 0xBA, 0xE6, 0xA5, 0x0A, 0x46, 0xAF, 0xAC, 0x83, 0x21, 0x36, 0x43, 0x30, 0x24,
-    0x66, 0xC0, 0x00, 0x20, 0xA3, 0xD6, 0x8A, 0xDE, 0xAB, 0x31, 0x21, 0x3C, 0x1E, 0x37, 0xA5, 0x10,
-    0x21, 0xAB, 0xC5, 0xBC, 0x9F, 0xE2, 0x53, 0xE4, 0x73, 0xB8, 0x78, 0xA6, 0x56, 0x76, 0x42, 0xFE,
-    0x01, 0xE1, 0x40, 0x2E, 0x93, 0xBD, 0x84, 0xE6, 0xC2, 0xC8, 0x89, 0x0D, 0x14, 0x8B, 0x5C, 0x7A,
-    0x4E, 0xB6, 0xB5, 0xEB, 0x21, 0x0F, 0x4C, 0xE6, 0xBB, 0xD9, 0x85, 0xD2, 0xB5, 0x95, 0x0C, 0xF4,
-    0x81, 0x97, 0x92, 0x17, 0xC8, 0x0E, 0xCF, 0xFA, 0x57, 0x0A, 0x82, 0xEB, 0xC9, 0x8B, 0x52, 0xAB,
-    0xFF, 0x88, 0x91, 0x50, 0xAC, 0x90, 0x4B, 0x91, 0x98, 0x8D, 0x51, 0x41, 0x3F, 0xDA, 0xB8, 0x57,
-    0x71, 0x85, 0x2F, 0xDD, 0x8D, 0x87, 0xAA, 0x4C, 0xEE, 0x5D, 0xFE, 0xDB, 0xD3, 0x9C, 0x4D, 0x4F,
-    0x99, 0x54, 0x58, 0x8E, 0x93, 0x56, 0xFC, 0x1C, 0xF7, 0xE1, 0x78, 0x50, 0x5E, 0x9B, 0x40, 0x52,
-    0xB5, 0x1E, 0x0F, 0x19, 0xAA, 0x41, 0xCF, 0x0B, 0xD4, 0xC9, 0x70, 0x30, 0x32, 0xAB, 0x1F, 0x1E,
-    0xA7, 0x36, 0x15, 0x3E, 0x96, 0xC3, 0x37, 0xDF, 0xC1, 0x63, 0x94, 0xC6, 0xD8, 0xE2, 0x0A, 0x32,
-    0xAD, 0x43, 0x4E, 0x1E, 0xE2, 0xC6, 0xE7, 0x0B, 0xE5, 0x73, 0x60, 0x29, 0x9E, 0xA1, 0x28, 0xB6,
-    0xC8, 0xA8, 0x0E, 0xC3, 0x7F, 0x04, 0x13, 0x4C, 0x8B, 0x70, 0x88, 0xBB, 0x60, 0x0A, 0xCC, 0x8E,
-    0x81, 0x4E, 0x1A, 0x7C, 0x72, 0x9C, 0xEF, 0x2E, 0xBA, 0x54, 0x07, 0xA2, 0x48, 0x15, 0x45, 0x25,
-    0x52, 0xC1, 0xDC, 0x7D, 0xC8, 0x1F, 0xB3, 0x11, 0x81, 0xE0, 0xAF, 0x21, 0xEF, 0xDD, 0xC8, 0xD0,
-    0xF9, 0x21, 0xCE, 0x0C, 0xD3, 0xA4, 0x9E, 0x25, 0x23, 0xE4, 0x40, 0x79, 0x43, 0xA4, 0x7E, 0xF1,
-    0xA0, 0x8A, 0x5F, 0x19, 0x55, 0xFA, 0x1A, 0xD6, 0xFC, 0x72, 0xAF, 0xBC, 0x25, 0xAD, 0xE5, 0x07,
-    0x34, 0xC6, 0x1A, 0x72, 0x61, 0x47, 0xAB, 0x31, 0xBC, 0x2B, 0x74, 0x44, 0x1E, 0xC4, 0x25, 0xE1,
-    0xB3, 0x79, 0x6B, 0x3E, 0x89, 0x0F, 0xE6, 0x7F, 0x5C, 0x07, 0x2E, 0x03, 0xD4, 0x80, 0x0B, 0x9E,
-    0x60, 0x72, 0x7A, 0xD6, 0x4C, 0x9A, 0x58, 0x63, 0x75, 0x65, 0xA1, 0x0C, 0xB2, 0xB6, 0x5C, 0x42,
-    0x98, 0x9A, 0x52, 0xA2, 0x5A, 0xB2, 0xAA, 0x94, 0x3A, 0x1F, 0x68, 0x97, 0x9C, 0x5A, 0xC5, 0x61,
-    0x58, 0x2D, 0xE0, 0x43, 0x38, 0x63, 0x19, 0x89, 0x7C, 0xDC, 0x9B, 0x7F, 0xAA, 0xF1, 0x5E, 0x4C,
-    0x81, 0x69, 0xAE, 0x89, 0x48, 0x6E, 0xE3, 0x46, 0x5B, 0x94, 0xE7, 0x1B, 0x79, 0x2F, 0xB9, 0x56,
-    0xF2, 0x61, 0xD0, 0x02, 0xAA, 0x6D, 0x52, 0x89, 0xA9, 0xA5, 0x85, 0xB5, 0x38, 0x4A, 0x12, 0x2F,
-    0x72, 0x6F, 0x75, 0xC6, 0x37, 0x4F, 0x13, 0x7C, 0x30, 0x7C, 0xDC, 0x78, 0x10, 0x1D, 0xF1, 0xFB,
-    0x70, 0x88, 0xA0, 0xB2, 0x6D, 0x38, 0x60, 0x2E, 0x51, 0x13, 0xF5, 0x10, 0x71, 0x5C, 0xC5, 0x1D,
-    0xAD, 0xA6, 0x88, 0x61, 0x4B, 0x77, 0x03, 0x73, 0x60, 0x57, 0xF9, 0xA8, 0xF2, 0xBD, 0xB2, 0xCD,
-    0x3B, 0x1A, 0x6B, 0xA5, 0x6B, 0x58, 0xDD, 0x2E, 0x40, 0x42, 0x1D, 0xC4, 0xAC, 0x81, 0x02, 0x0F,
-    0xCC, 0x18, 0x53, 0x60, 0x49, 0xAF, 0x38, 0x34, 0xC8, 0x9D, 0xE2, 0x25, 0x0E, 0x51, 0x50, 0x79,
-    0x21, 0xA6, 0x0B, 0xBB, 0x33, 0x56, 0x18, 0x14, 0x45, 0x30, 0x6D, 0x94, 0x7B, 0x82, 0x62, 0x82,
-    0x49, 0x25, 0x5F, 0x20, 0xF6, 0x06, 0x96, 0x6F, 0xEC, 0x67, 0x74, 0x23, 0xF7, 0x89, 0x7A, 0xDC,
-    0x47, 0x46, 0x57, 0xF2, 0x3E, 0xD0, 0xCD, 0x1A, 0xBF, 0x28, 0x2B, 0x3E, 0xEB, 0x9A, 0xA9, 0x72,
-    0x73, 0x49, 0x86, 0x67, 0x5A, 0x58, 0xE3, 0x01, 0xA1, 0xD9, 0x7B, 0x57, 0x82, 0x2A, 0x81, 0xD9,
-    0xDC, 0x2B, 0x2B, 0x81, 0x95, 0xA0, 0x4D, 0x9B, 0x34, 0x23, 0xAE, 0xB4, 0xCE, 0x0C, 0x65, 0x74,
-    0x2A, 0x7F, 0x69, 0xA2, 0x4A, 0x53, 0xC3, 0x05, 0x83, 0xF1, 0x48, 0x23, 0xF0, 0xDB, 0xF2, 0x5F,
-    0x43, 0x45, 0xC4, 0xAB, 0x80, 0x0B, 0xBE, 0x80, 0x41, 0x94, 0xB0, 0x8D, 0xCC, 0x98, 0x2B, 0x06,
-    0xF0, 0xD2, 0x97, 0xA6, 0x5A, 0x3C, 0x38, 0xB2, 0xDA, 0x28, 0xE8, 0x2F, 0xAB, 0x92, 0x08, 0x24,
-    0x8A, 0xF5, 0xAB, 0x3B, 0x0E, 0x8C, 0xF1, 0x3C, 0x15, 0x16, 0xCB, 0x81, 0x95, 0x4F, 0x01, 0x26,
-    0x98, 0xE4, 0x80, 0xDB, 0x7B, 0xE3, 0x97, 0xA1, 0x47, 0x80, 0x6E, 0x5C, 0x09, 0xCD, 0x51, 0x9F,
-    0x14, 0xD4, 0x3A, 0xDE, 0x32, 0xDE, 0x13, 0x05, 0x13, 0x88, 0x48, 0xAF, 0x8F, 0x72, 0xDF, 0x49,
-    0x34, 0xCA, 0x88, 0x52, 0xE6, 0x05, 0x75, 0x4D, 0x8B, 0x3A, 0x5B, 0x73, 0xC2, 0xB0, 0x3D, 0xB3,
-    0x0E, 0x20, 0x48, 0x0C, 0xD6, 0x92, 0x0F, 0xF4, 0x64, 0x54, 0xEA, 0xF0, 0x62, 0x1C, 0xBE, 0x45,
-    0xC0, 0xC4, 0xCE, 0x42, 0x1C, 0x15, 0x6E, 0x20, 0x03, 0x76, 0xBE, 0x4A, 0x1D, 0x52, 0x37, 0xFE,
-    0x81, 0x74, 0xAD, 0xCB, 0x0A, 0x60, 0x9D, 0x9E, 0x29, 0xF0, 0x2F, 0x15, 0xDE, 0x59, 0x6F, 0x2A,
-    0x56, 0x1E, 0x18, 0xB1, 0x61, 0x3D, 0x71, 0xFC, 0x21, 0x95, 0x44, 0x57, 0x25, 0x8C, 0xCD, 0x33,
-    0xD1, 0x9B, 0x86, 0xA6, 0x69, 0x22, 0x41, 0xBC, 0x96, 0xD2, 0xC1, 0x6D, 0x68, 0xFD, 0x40, 0x8B,
-    0x41, 0xAC, 0xDE, 0x61, 0x00, 0xC1, 0x7A, 0x12, 0xCB, 0x4B, 0x76, 0x55, 0xBA, 0x4B, 0x30, 0x88,
-    0x0C, 0x65, 0xD6, 0x51, 0xF9, 0x94, 0x05, 0x9A, 0x23, 0xEA, 0x9B, 0x78, 0x3F, 0xBB, 0x8B, 0x1A,
-    0x96, 0x53, 0xF0, 0x14, 0x47, 0x2A, 0x82, 0x3F, 0xB1, 0x3C, 0xE8, 0xC8, 0xC0, 0x27, 0x5C, 0x35,
-    0xB0, 0x89, 0x16, 0x2A, 0x94, 0xD6, 0xB8, 0x2D, 0x44, 0x5C, 0x16, 0x11, 0xD7, 0x19, 0xC0, 0x1F,
-    0x88, 0xDC, 0xCB, 0x7B, 0x39, 0x82, 0x66, 0xA0, 0x76, 0x50, 0xC6, 0x65, 0x2E, 0x42, 0xA7, 0xB6,
-    0x88, 0xEC, 0x64, 0xB9, 0xD3, 0x8A, 0x00, 0x0B, 0xE9, 0x7C, 0x35, 0x69, 0x78, 0xE3, 0x86, 0xEF,
-    0x36, 0xB3, 0xFC, 0xBC, 0xE5, 0xA7, 0x42, 0x48, 0xB1, 0xF8, 0xD3, 0x86, 0xD8, 0x9B, 0x37, 0x4E,
-    0x54, 0x16, 0x09, 0x3D, 0x8B, 0x7E, 0x5C, 0x2D, 0xE8, 0xB8, 0x48, 0xCA, 0x81, 0x22, 0xC1, 0x04,
-    0x42, 0x28, 0x05, 0x2C, 0x89, 0x33, 0x90, 0x92, 0xC5, 0xC7, 0x58, 0xB4, 0x77, 0xFE, 0x66, 0x7B,
-    0xF0, 0x9B, 0x9E, 0xB9, 0xB6, 0x39, 0x65, 0xA2, 0xFF, 0xA3, 0xF8, 0x70, 0x0E, 0x37, 0xE8, 0xAD,
-    0x5A, 0xCA, 0xD2, 0x07, 0x56, 0x6E, 0x47, 0xE5, 0x1A, 0xDA, 0x05, 0x7E, 0xD8, 0x5A, 0x8D, 0x1B,
-    0xF1, 0x21, 0xF9, 0x9C, 0xC0, 0x48, 0x64, 0x0D, 0x44, 0x08, 0x06, 0x31, 0x50, 0xA5, 0x82, 0x3C,
-    0x83, 0x80, 0xDF, 0x6B, 0x7C, 0x33, 0x87, 0xF4, 0x54, 0xD0, 0x51, 0x53, 0x12, 0xD1, 0x40, 0x3A,
-    0x11, 0x15, 0xBD, 0xF3, 0x57, 0xB2, 0xB6, 0x82, 0x10, 0x86, 0xC8, 0xFA, 0x8B, 0x93, 0xF8, 0xE6,
-    0x24, 0x93, 0x69, 0x39, 0x70, 0x20, 0x41, 0xBA, 0x9B, 0x18, 0x60, 0xCB, 0x58, 0x9A, 0x6C, 0x5E,
-    0x4D, 0x7E, 0x45, 0xC6, 0x0D, 0x7F, 0x3A, 0x5D, 0xA0, 0x41, 0xCC, 0x9E, 0x35, 0xEC, 0xBD, 0xC6,
-    0x82, 0x8A, 0x60, 0x6A, 0x3C, 0x9D, 0x17, 0xEE, 0x90, 0xC1, 0x29, 0x19, 0xB2, 0x9D, 0x14, 0xD3,
-    0xAF, 0x00, 0xA9, 0xBA, 0x82, 0xB0, 0x72, 0x5E, 0x4A, 0x40, 0x1A, 0x44, 0x96, 0x42, 0xE7, 0x37,
-    0x4C, 0x95, 0x38, 0xBF, 0xDD, 0xCC, 0xEB, 0xF2, 0xDD, 0xF3, 0x04, 0xF8, 0x49, 0xC8, 0x97, 0xFA,
-    0x2F, 0xE6, 0x7E, 0x1A, 0x77, 0x48, 0x4A, 0x41, 0x08, 0x2A, 0x74, 0xE1, 0x8F, 0x1E, 0x64, 0xDD,
-    0xE1, 0x27, 0x10, 0x13, 0xCB, 0xB9, 0x22, 0x01, 0xAA, 0x5A, 0x77, 0xC4, 0x22, 0x62, 0x54, 0x59,
-    0x24, 0xAD, 0xC0, 0x13, 0xC1, 0x93, 0x3F, 0xED, 0x6D, 0x0E, 0xC4, 0xCC, 0x62, 0xF9, 0x41, 0x9F,
-    0x19, 0x6B, 0xD8, 0x7F, 0x94, 0x78, 0x32, 0xCA, 0x5E, 0xE5, 0xFF, 0x9B, 0x9F, 0x8C, 0x2B, 0xDE,
-    0x23, 0xE4, 0xCC, 0xC4, 0x09, 0xD0, 0x31, 0x08, 0x8B, 0xD3, 0xAA, 0xCC, 0xE8, 0x40, 0xF8, 0x36,
-    0x1C, 0x41, 0xCB, 0x0F, 0xF1, 0xED, 0x80, 0xA0, 0xAB, 0xBC, 0x41, 0xDC, 0xDA, 0x28, 0x0F, 0x2F,
-    0xAD, 0xDE, 0x65, 0x7C, 0x1B, 0xC2, 0x81, 0xD5, 0x97, 0xD7, 0x36, 0x30, 0x02, 0x41, 0x71, 0xE1,
-    0x98, 0x00, 0x5C, 0x7C, 0x2E, 0x6E, 0xAC, 0x42, 0xF8, 0x9D, 0xDC, 0xE0, 0x22, 0x9E, 0xF2, 0x88,
-    0x4A, 0x39, 0x2B, 0x15, 0xD1, 0x47, 0x16, 0x9F, 0x39, 0xE7, 0x3D, 0x24, 0x8F, 0xFC, 0x81, 0x0A,
-    0x47, 0x41, 0x99, 0xCA, 0xA7, 0xEB, 0xC8, 0x80, 0x47, 0x79, 0xEF, 0xE3, 0x57, 0xB8, 0x47, 0x8E,
-    0xD9, 0x95, 0x5F, 0x84, 0xD6, 0xD6, 0x00, 0x51, 0x7E, 0xB8, 0x8F, 0x1B, 0xC1, 0x70, 0x1D, 0x76,
-    0x29, 0x8D, 0x21, 0xBA, 0x3C, 0x10, 0x86, 0x95, 0xB7, 0x6B, 0x4E, 0x57, 0xCE, 0x2D, 0xCB, 0xFA,
-    0x82, 0xF4, 0x88, 0xE8, 0xCB, 0xC7, 0xBA, 0x9C, 0x1F, 0x2C, 0x2F, 0x0F, 0xCE, 0xE5, 0x1B, 0xF1,
-    0x2D, 0x79, 0xA3, 0x0B, 0x81, 0xE5, 0x36, 0x6E, 0x38, 0xE4, 0xBC, 0x0D, 0xE9, 0x5C, 0x54, 0xD9,
-    0xE2, 0xD1, 0xB4, 0xE8, 0x2E, 0x82, 0x13, 0x00, 0x7D, 0x6D, 0x49, 0x47, 0x61, 0x21, 0xD9, 0xBE,
-    0x21, 0xFE, 0x90, 0x6C, 0x57, 0xD4, 0xB3, 0x09, 0x76, 0x4F, 0x43, 0x57, 0x30, 0xD1, 0x47, 0xB0,
-    0x14, 0x5F, 0x92, 0x85, 0x20, 0x22, 0x60, 0x29, 0xFC, 0xCD, 0x5E, 0xB0, 0x53, 0xC8, 0x0F, 0x71,
-    0xD3, 0xAA, 0x86, 0x6E, 0xFE, 0x0C, 0xF4, 0x22, 0x85, 0x80, 0xE2, 0x36, 0x9C, 0x02, 0xBB, 0x42,
-    0x34, 0xBE, 0x5D, 0xDC, 0x3C, 0xFB, 0x5D, 0x84, 0x71, 0x99, 0xB8, 0x97, 0x85, 0xE2, 0x75, 0xD4,
-    0x5D, 0x7C, 0x99, 0xC2, 0x46, 0xCD, 0x68, 0x8E, 0x17, 0x8B, 0x54, 0x27, 0x7E, 0x87, 0x5D, 0xD1,
-    0xEF, 0x8A, 0x4B, 0xD7, 0x82, 0xFA, 0x89, 0xD5, 0xD1, 0x19, 0x01, 0x88, 0x1D, 0x61, 0x9B, 0x08,
-    0x02, 0x08, 0x6D, 0x1D, 0x84, 0xA0, 0x5A, 0xD6, 0x98, 0x14, 0x7C, 0x3B, 0xAE, 0x29, 0x2D, 0x89,
-    0x33, 0xF0, 0x21, 0x79, 0x7B, 0x90, 0xB7, 0xB7, 0x04, 0x79, 0xB4, 0x08, 0x13, 0x44, 0x11, 0xD1,
-    0x06, 0x44, 0x4A, 0x66, 0x5E, 0x1F, 0x32, 0xEB, 0xE0, 0xC6, 0x64, 0xB0, 0xBA, 0x0E, 0xC9, 0xF3,
-    0x6F, 0x24, 0x89, 0xB5, 0xCA, 0xA9, 0xC3, 0x0D, 0xED, 0xCC, 0x37, 0x0D, 0x97, 0x11, 0x2F, 0x5C,
-    0x0F, 0x78, 0xE1, 0x08, 0x2F, 0xA1, 0x69, 0xE3, 0x9D, 0x4A, 0x45, 0x2F, 0xB5, 0x29, 0xB9, 0xF0,
-    0xB3, 0xED, 0x51, 0xCC, 0x36, 0xBE, 0xD2, 0x0D, 0x78, 0x49, 0xCF, 0xED, 0xF6, 0x78, 0xD1, 0xC7,
-    0xAE, 0xB7, 0x1A, 0x61, 0x28, 0x3C, 0x2C, 0xE4, 0x71, 0x86, 0xF6, 0x5B, 0x00, 0xC0, 0x4C, 0x86,
-    0x17, 0x5A, 0x45, 0x59, 0x00, 0x68, 0x00, 0xBF, 0x99, 0xDF, 0x63, 0xC0, 0x65, 0x16, 0xF6, 0xEA,
-    0x38, 0x46, 0xA5, 0x21, 0x17, 0x08, 0xA9, 0x34, 0x0C, 0x5C, 0xDA, 0xFF, 0x48, 0x5D, 0xAC, 0xBB,
-    0x4D, 0x6C, 0x7C, 0x82, 0xB5, 0xF6, 0xED, 0x5A, 0xC3, 0x68, 0x69, 0xB7, 0xFA, 0xDA, 0x86, 0xA8,
-    0x8B, 0xB0, 0xF1, 0x48, 0x08, 0x2B, 0xCD, 0x57, 0x5C, 0x75, 0x26, 0xEA, 0x32, 0xCC, 0x1E, 0x3B,
-    0x3D, 0xA0, 0x2E, 0xE3, 0x07, 0xA9, 0xCB, 0xA1, 0xF3, 0x84, 0x07, 0xAA, 0x22, 0x51, 0xCA, 0x33,
-    0x7B, 0xF8, 0x2D, 0xBC, 0x21, 0x01, 0x0A, 0xFF, 0x82, 0x4B, 0xA7, 0x9D, 0x86, 0xA3, 0x1C, 0x93,
-    0x0E, 0x8F, 0x7D, 0x1C, 0xB7, 0xCE, 0xAF, 0xE2, 0xD1, 0x49, 0x87, 0xB7, 0xA3, 0x51, 0xD3, 0xAD,
-    0xC6, 0xE4, 0xAB, 0xE7, 0x08, 0x26, 0x35, 0x63, 0xBF, 0x36, 0x85, 0x6F, 0x02, 0x8C, 0x14, 0xF0,
-    0xD6, 0x25, 0xC3, 0x6B, 0x89, 0x95, 0xD5, 0x9A, 0x59, 0x3F, 0xC8, 0xF7, 0x82, 0x03, 0xDC, 0x20,
-    0x9F, 0x2E, 0xD8, 0xD0, 0x4C, 0xD0, 0xA9, 0x72, 0xD1, 0x98, 0xA8, 0x7C, 0x21, 0x51, 0x5A, 0x27,
-    0x78, 0x6B, 0x32, 0x67, 0x4F, 0x5A, 0xF8, 0x48, 0x68, 0x61, 0xB8, 0xB4, 0x4C, 0xA6, 0x17, 0xF7,
-    0x04, 0x21, 0xCC, 0xDF, 0x14, 0x72, 0x82, 0x5F, 0x43, 0x63, 0xA1, 0xAB, 0x21, 0xA7, 0x67, 0x1E,
-    0xB3, 0x61, 0x5C, 0x29, 0x76, 0x4C, 0xDF, 0x9B, 0xD2, 0x4D, 0x49, 0x1E, 0xE0, 0xFA, 0xB4, 0x46,
-    0x3B, 0x81, 0xE1, 0x48, 0x60, 0x62, 0xA3, 0x93, 0x5E, 0xC6, 0x14, 0x32, 0xD0, 0xC7, 0x9D, 0x92,
-    0x36, 0x6F, 0xF9, 0x0D, 0x68, 0x81, 0x44, 0x4B, 0xD7, 0xB2, 0x03, 0x2E, 0xB1, 0xD8, 0x77, 0x89,
-    0xF5, 0x41, 0x97, 0x78, 0xE8, 0x69, 0x41, 0x90, 0x9A, 0x12, 0x29, 0x22, 0xB3, 0x01, 0xF1, 0x36,
-    0x7E, 0x07, 0x63, 0x17, 0x97, 0x78, 0x94, 0x5E, 0xEE, 0xB8, 0xB8, 0x92, 0x45, 0x8C, 0x36, 0xCC,
-    0x7E, 0x57, 0x98, 0x93, 0xFC, 0x0A, 0x4F, 0xFC, 0x5E, 0x3A, 0xA8, 0xA8, 0xD2, 0xD3, 0x77, 0x26,
-    0xDE, 0xAA, 0x95, 0x48, 0x17, 0xCB, 0x57, 0x2F, 0xE1, 0x29, 0x3D, 0xDA, 0x68, 0xD3, 0x19, 0x2E,
-    0x93, 0xE1, 0x0D, 0xDA, 0x37, 0x5E, 0x87, 0xC7, 0xF8, 0xED, 0x97, 0x83, 0xD1, 0x2B, 0x5C, 0x26,
-    0x63, 0x98, 0x99, 0x95, 0x04, 0x84, 0x37, 0x3A, 0xFE, 0xE6, 0x80, 0xE3, 0x2F, 0x5F, 0x57, 0x36,
-    0x42, 0x8C, 0xF7, 0x9D, 0xFC, 0x67, 0xCE, 0x63, 0x35, 0xE7, 0x19, 0xC9, 0xF3, 0xBF, 0x22, 0xE9,
-    0x2C, 0xB2, 0x06, 0xAF, 0x84, 0x66, 0x49, 0x80, 0xE8, 0x9B, 0xCD, 0xEB, 0xB0, 0xC2, 0x4B, 0x53,
-    0xDC, 0x27, 0x6D, 0x5A, 0xE7, 0xDB, 0x23, 0x46, 0x00, 0xFB, 0xC5, 0x3F, 0xDB, 0x43, 0x08, 0xBE,
-    0x01, 0x1C, 0xCB, 0xCC, 0xB1, 0x31, 0x6A, 0xD3, 0x36, 0xED, 0x4C, 0x32, 0x70, 0xD9, 0x69, 0x7C,
-    0x74, 0x5C, 0x6A, 0xAD, 0x99, 0x03, 0x31, 0xC9, 0x31, 0x28, 0xD1, 0x90, 0xD5, 0x93, 0x27, 0x96,
-    0xE0, 0xAC, 0x16, 0x67, 0x5E, 0x41, 0x0A, 0x11, 0x93, 0x3C, 0x5C, 0x15, 0x8C, 0x00, 0xF2, 0x15,
-    0x7F, 0xF7, 0x98, 0xAC, 0xDF, 0xCB, 0x22, 0x31, 0x53, 0xEC, 0xC7, 0x5C, 0xB2, 0x90, 0x2A, 0x91,
-    0xAB, 0x96, 0xDF, 0x4C, 0x32, 0xF9, 0x5E, 0xF0, 0xB0, 0x15, 0x44, 0xAB, 0x28, 0xE7, 0x92, 0x72,
-    0x67, 0x8C, 0x07, 0x3B, 0xE5, 0xA3, 0x40, 0xDE, 0x2E, 0xD9, 0x64, 0xD9, 0xE7, 0x4A, 0xDF, 0x2D,
-    0x7F, 0x71, 0xC0, 0x35, 0x2E, 0xC5, 0x68, 0x9E, 0x65, 0xF3, 0x42, 0x4C, 0x94, 0x6F, 0xDF, 0xFF,
-    0xE3, 0x45, 0x54, 0x9E, 0x9B, 0xD7, 0xCC, 0x98, 0x52, 0x35, 0x3C, 0x71, 0x61, 0x69, 0x23, 0x51,
-    0xB4, 0x8D, 0xA1, 0xED, 0x0F, 0x60, 0x1A, 0x58, 0x34, 0xB1, 0xE0, 0xDD, 0xB5, 0xCE, 0xE6, 0xD3,
-    0x94, 0x4D, 0x34, 0xFC, 0xA3, 0xD8, 0xD2, 0x82, 0x62, 0x89, 0xAE, 0x4A, 0x4A, 0x41, 0x6C, 0x2B,
-    0xB4, 0x99, 0x33, 0x53, 0x2C, 0x63, 0x7C, 0x67, 0x26, 0x4D, 0x48, 0xC5, 0xA3, 0x13, 0x28, 0x4F,
-    0xD2, 0x61, 0x3E, 0x46, 0x74, 0xDD, 0xD0, 0x48, 0x3D, 0x5E, 0x45, 0x5E, 0x60, 0xCB, 0x92, 0xEA,
-    0xA9, 0x25, 0xF3, 0xA0, 0x84, 0x34, 0x5B, 0xEC, 0x9C, 0x3F, 0x98, 0x57, 0x16, 0x7A, 0x92, 0x46,
-    0x64, 0x56, 0x47, 0x9D, 0x3F, 0x7E, 0xE8, 0x07, 0x53, 0xF7, 0xC1, 0xB8, 0x13, 0x80, 0xDA, 0xBB,
-    0x30, 0x6D, 0x40, 0x2D, 0x85, 0x8E, 0xCE, 0x20, 0x67, 0x09, 0xC4, 0x07, 0x8E, 0xB6, 0xFF, 0xE0,
-    0xD1, 0x36, 0x07, 0x46, 0xDB, 0x7D, 0xC8, 0x20, 0xC2, 0x79, 0xB4, 0xD3, 0x47, 0x1E, 0xED, 0xDF,
-    0xBB, 0xD1, 0x9A, 0x79, 0xB4, 0x2E, 0x9D, 0x10, 0xBB, 0x00, 0x22, 0x74, 0xAE, 0xCB, 0x9B, 0xCD,
-    0xFF, 0x11, 0xF7, 0x9A, 0xBA, 0xD7, 0x99, 0x52, 0x33, 0xDA, 0xA2, 0xE6, 0x64, 0xD1, 0x1E, 0x96,
-    0x4A, 0x73, 0x28, 0x03, 0xD6, 0x30, 0x68, 0x30, 0x86, 0x43, 0xE2, 0xC7, 0x39, 0x4A, 0x95, 0xEE,
-    0xAD, 0x73, 0xB1, 0x7B, 0x2E, 0x23, 0xF1, 0x1A, 0x81, 0x53, 0x5E, 0xA4, 0xE4, 0xA3, 0xB9, 0x4B,
-    0x05, 0xE1, 0xC5, 0xE6, 0x59, 0xA6, 0xCD, 0x51, 0xA2, 0x37, 0x80, 0xDA, 0xEB, 0xEF, 0x61, 0x5D,
-    0xF5, 0x9C, 0xDB, 0xB3, 0xF9, 0xBD, 0xC2, 0xE6, 0xF8, 0x06, 0xB5, 0x9F, 0xC2, 0xB3, 0x42, 0xB4,
-    0xF9, 0x3E, 0xFC, 0xCA, 0x8A, 0xC6, 0xE5, 0xFD, 0x80, 0xDF, 0xA2, 0xED, 0x1C, 0x31, 0x13, 0xE3,
-    0x46, 0x14, 0x03, 0xA1, 0x55, 0x23, 0x2C, 0x87, 0xFC, 0x99, 0x02, 0xF4, 0x8C, 0xBD, 0x59, 0x38,
-    0xCC, 0xF2, 0x2B, 0xE9, 0xAC, 0xF0, 0x6B, 0xD2, 0xB0, 0xBD, 0xB2, 0x97, 0xFC, 0xA0, 0x31, 0xC7,
-    0x6C, 0x74, 0xB5, 0x9E, 0x2E, 0x72, 0x77, 0x4B, 0xE3, 0x74, 0x29, 0xBC, 0xC2, 0xC1, 0x8C, 0xA0,
-    0x2C, 0x07, 0xE6, 0x8F, 0xFB, 0x09, 0x3D, 0x9B, 0x8F, 0xEA, 0xE6, 0x08, 0x2F, 0xFD, 0xA0, 0x08,
-    0xAF, 0x7A, 0xBF, 0x08, 0xCF, 0xFB, 0x61, 0x26, 0x53, 0xA1, 0x21, 0xC1, 0x8A, 0xFF, 0xA1, 0x6C,
-    0x49, 0x43, 0x1A, 0xC4, 0xD6, 0xA6, 0x8A, 0xAD, 0xF1, 0x84, 0xEE, 0x51, 0xAB, 0x27, 0x01, 0xAC,
-    0xB9, 0x38, 0x7C, 0xA8, 0xA7, 0x77, 0x72, 0xAD, 0x75, 0x48, 0x1C, 0x8E, 0x9E, 0xF8, 0x70, 0x38,
-    0xDD, 0x0C, 0x31, 0x6B, 0x4F, 0xB9, 0x17, 0x21, 0xEF, 0x67, 0xF3, 0xA9, 0x47, 0xE6, 0x09, 0xDD,
-    0xBE, 0x2E, 0x44, 0x35, 0xB4, 0xA4, 0xBF, 0xD1, 0xD4, 0x17, 0x30, 0x4D, 0xE1, 0x0F, 0x80, 0x5D,
-    0x84, 0xD2, 0x1D, 0x7D, 0xE9, 0x40, 0x39, 0x33, 0x33, 0x4B, 0x1C, 0x8C, 0x7A, 0xE0, 0x0C, 0x7F,
-    0xD5, 0xC1, 0xB0, 0xF9, 0xBA, 0x0B, 0x7E, 0xC1, 0x57, 0x7E, 0x99, 0x69, 0x74, 0xBE, 0xC6, 0x44,
-    0x07, 0x88, 0x97, 0x31, 0x74, 0x8D, 0xD7, 0x84, 0x01, 0x35, 0x5E, 0x53, 0x66, 0xE4, 0x38, 0x6A,
-    0xBA, 0x18, 0x10, 0x0F, 0x7C, 0xB4, 0xCC, 0x74, 0x1F, 0x1A, 0xE1, 0xA1, 0xA2, 0x43, 0x64, 0xA2,
-    0x0C, 0xC2, 0xE9, 0x17, 0x5D, 0x26, 0x6E, 0x39, 0xCA, 0x58, 0x73, 0x74, 0x94, 0x90, 0xFF, 0x4B,
-    0x2C, 0x43, 0xDC, 0x73, 0x1D, 0x4A, 0x5A, 0x19, 0x44, 0x4B, 0xD6, 0x27, 0x06, 0x96, 0xB6, 0x36,
-    0x42, 0x12, 0xB6, 0x2B, 0x46, 0x9B, 0x4B, 0x8A, 0x7E, 0x62, 0x32, 0x2A, 0x6A, 0x89, 0xC8, 0x5A,
-    0xF4, 0xAB, 0xB7, 0x10, 0x8A, 0x25, 0x7C, 0x72, 0xF4, 0xA9, 0x00, 0x0D, 0xA0, 0x3B, 0x99, 0x42,
-    0x61, 0xA1, 0xA4, 0x7A, 0x8E, 0xED, 0x78, 0xC7, 0x57, 0xF1, 0xE6, 0x1A, 0x4B, 0x0E, 0x4D, 0x38,
-    0xE5, 0x2D, 0xBD, 0x12, 0x3E, 0x3F, 0x51, 0xBF, 0xC0, 0x1D, 0x35, 0xE2, 0x55, 0x46, 0xFB, 0x1C,
-    0x0E, 0x63, 0x43, 0xCA, 0x6E, 0x7B, 0xE7, 0x8D, 0x27, 0xCC, 0xDB, 0xE6, 0x55, 0xD3, 0x42, 0xB4,
-    0x4D, 0x52, 0x1F, 0x28, 0x8C, 0xFC, 0x99, 0x8D, 0xBE, 0xE9, 0xA6, 0x3C, 0xC9, 0x5C, 0x62, 0xAE,
-    0xE9, 0xEB, 0xCE, 0x42, 0x85, 0xC1, 0x9F, 0x3D, 0xAE, 0x82, 0xB7, 0xA0, 0x71, 0x5B, 0x18, 0x7E,
-    0x6C, 0xD6, 0x80, 0xC0, 0x20, 0xD6, 0x29, 0x1F, 0xCC, 0x20, 0x5A, 0x57, 0x01, 0x67, 0x9E, 0x67,
-    0x04, 0x18, 0x28, 0x37, 0x7D, 0x99, 0xA6, 0xF7, 0xEC, 0xAC, 0x87, 0x97, 0x94, 0x95, 0x4D, 0xB3,
-    0x9E, 0x24, 0x3F, 0xCA, 0x88, 0xB6, 0xF9, 0xBD, 0x43, 0x00, 0xA7, 0xAE, 0x33, 0x7D, 0x76, 0x08,
-    0x87, 0xE8, 0x3A, 0x79, 0xAD, 0xA9, 0xA7, 0x2C, 0xDF, 0x86, 0x8E, 0xC6, 0x4D, 0xD0, 0xF3, 0xBE,
-    0xE5, 0x8B, 0x23, 0x35, 0xDD, 0xA3, 0xBC, 0xA8, 0x29, 0xAB, 0xC7, 0x21, 0xF4, 0x2C, 0x47, 0x3C,
-    0xF3, 0xE3, 0x31, 0xC6, 0x03, 0x69, 0x6C, 0x20, 0x50, 0x25, 0xF9, 0x37, 0xA6, 0x09, 0xEB, 0xC1,
-    0xC3, 0xFF, 0x3C, 0x2F, 0xF2, 0x64, 0x0F, 0xB6, 0x03, 0x7D, 0x9B, 0x2C, 0x45, 0x24, 0x29, 0xCD,
-    0xC9, 0x89, 0xC1, 0x92, 0x1A, 0x18, 0x41, 0xE6, 0xC2, 0x4C, 0x6B, 0xD7, 0x83, 0x70, 0x80, 0xDC,
-    0xC0, 0x2C, 0x37, 0x07, 0x0A, 0x93, 0xB3, 0x48, 0x60, 0x25, 0x69, 0x15, 0x62, 0x18, 0x51, 0xC7,
-    0x79, 0xE1, 0xBF, 0x86, 0x92, 0x85, 0x0E, 0x65, 0xE9, 0x75, 0x72, 0xFF, 0xDE, 0xA6, 0x8E, 0x8E,
-    0xB8, 0xF0, 0xAD, 0x04, 0xDE, 0x98, 0x2A, 0x79, 0x01, 0xD3, 0x4A, 0xAA, 0x09, 0x8B, 0x59, 0x95,
-    0x3E, 0xEE, 0xA0, 0x77, 0xC0, 0x5D, 0xA1, 0x72, 0xAF, 0x33, 0x5B, 0xF5, 0x33, 0xAC, 0x2E, 0x68,
-    0x5B, 0x13, 0x4B, 0x94, 0x6E, 0xC7, 0xB6, 0x0A, 0x3A, 0xB2, 0x9A, 0x45, 0xA3, 0xDF, 0x31, 0xA2,
-    0x6D, 0xC1, 0xAC, 0xDA, 0xD2, 0x1C, 0x6B, 0xF3, 0x29, 0x3E, 0xD6, 0x6F, 0xC5, 0x55, 0x76, 0x3C,
-    0xFD, 0xE9, 0x55, 0x46, 0x37, 0xD7, 0x87, 0x2D, 0x2E, 0x85, 0x79, 0x59, 0xE8, 0x9B, 0x50, 0x0A,
-    0xBD, 0x26, 0x26, 0xF6, 0xDA, 0xC8, 0x1F, 0x06, 0x7D, 0xBA, 0xFA, 0xDA, 0x37, 0x75, 0xF8, 0xCA,
-    0x94, 0xDC, 0x6F, 0xEA, 0x9F, 0xC7, 0x58, 0x6A, 0x8C, 0xC1, 0x50, 0x05, 0xE8, 0x0A, 0xE6, 0x34,
-    0xB7, 0x77, 0x02, 0xDF, 0x06, 0x0E, 0x9A, 0x0A, 0x32, 0x0C, 0x0A, 0x70, 0x24, 0x02, 0x70, 0x9E,
-    0xD1, 0x0D, 0x82, 0x4E, 0x78, 0xA7, 0x84, 0xF5, 0xAE, 0x63, 0xF2, 0x2A, 0x3F, 0x37, 0xAE, 0xB5,
-    0x24, 0x9C, 0xE5, 0x68, 0x87, 0x7A, 0x5C, 0xAD, 0x32, 0x2A, 0x6A, 0xF1, 0x39, 0xE3, 0xAD, 0xD5,
-    0x49, 0xE3, 0x51, 0xEF, 0x52, 0x2A, 0xC0, 0x20, 0x0A, 0x90, 0x83, 0xAB, 0x41, 0xD9, 0x0D, 0x9D,
-    0x71, 0xA3, 0x5B, 0x6F, 0x8C, 0xCC, 0x4A, 0x7A, 0xF9, 0xDD, 0x77, 0x2F, 0x9B, 0xA1, 0x1C, 0x52,
-    0x03, 0xDB, 0x02, 0xC0, 0x14, 0x07, 0x94, 0xAF, 0x50, 0x51, 0xF1, 0xC7, 0x8C, 0xDA, 0x60, 0x2E,
-    0xBF, 0x72, 0x41, 0xBF, 0xB7, 0xE5, 0xDE, 0xBC, 0xA9, 0x0F, 0x3C, 0xA1, 0x8E, 0x84, 0xD0, 0xDB,
-    0x6D, 0xD3, 0x94, 0xED, 0xA9, 0xAE, 0xEC, 0xBD, 0x01, 0x0A, 0x94, 0x23, 0x5A, 0x4D, 0x37, 0x81,
-    0x61, 0x3B, 0x12, 0xB9, 0xC1, 0x00, 0x30, 0xD7, 0x12, 0xF4, 0x51, 0x5F, 0xE9, 0x0E, 0xC7, 0xAD,
-    0xF9, 0xCF, 0x61, 0x9F, 0x98, 0x7B, 0xE1, 0x2E, 0x2A, 0x23, 0xD8, 0x6A, 0xA9, 0xE3, 0xC9, 0xE3,
-    0xB6, 0x68, 0x14, 0x88, 0x7A, 0xFF, 0x14, 0x5F, 0x63, 0x3C, 0x17, 0x55, 0x18, 0xFB, 0xD1, 0x10,
-    0x81, 0x4D, 0x87, 0x1B, 0xC4, 0xF3, 0x4F, 0xBE, 0xFD, 0xC9, 0xA8, 0x3B, 0xB7, 0x82, 0xE1, 0x67,
-    0x08, 0x0B, 0xCD, 0x36, 0x2C, 0x72, 0xE4, 0xB0, 0x0B, 0x1B, 0xC2, 0x78, 0x98, 0x67, 0xC6, 0xA0,
-    0x9A, 0x19, 0x38, 0xA3, 0x04, 0x71, 0x11, 0x4D, 0xAA, 0xB8, 0x3C, 0xB6, 0x53, 0xAB, 0x78, 0xED,
-    0xF1, 0xE7, 0x80, 0x33, 0xA7, 0x9F, 0x38, 0x8D, 0x6B, 0xB2, 0x83, 0x9B, 0xA5, 0xC9, 0x98, 0x16,
-    0xEA, 0x68, 0x3C, 0xE8, 0x4C, 0xDD, 0x0D, 0xF0, 0xCB, 0xD4, 0x45, 0xC8, 0xE8, 0x0B, 0x77, 0x0C,
-    0x71, 0x93, 0x3F, 0xAC, 0x3B, 0x04, 0xC5, 0x83, 0x6E, 0x71, 0x85, 0xD2, 0x7E, 0x11, 0x81, 0xED,
-    0x8A, 0x35, 0xBF, 0x13, 0x74, 0x16, 0x0D, 0xB4, 0x19, 0x3E, 0xF0, 0x9E, 0xB5, 0x26, 0x6E, 0x3D,
-    0x22, 0x46, 0x02, 0xA9, 0xFA, 0x94, 0xAA, 0xB6, 0xE1, 0x23, 0xA4, 0xBA, 0x01, 0xCA, 0xDD, 0x85,
-    0x74, 0x15, 0x4C, 0x8E, 0xC5, 0x6F, 0x5D, 0xC2, 0xE7, 0x86, 0x14, 0xD1, 0xF0, 0x31, 0xA8, 0xC2,
-    0xBA, 0xCB, 0x69, 0x9C, 0xA0, 0x45, 0xD1, 0xAF, 0xA8, 0xF2, 0xA5, 0x31, 0xEC, 0x23, 0x90, 0xE1,
-    0xE4, 0x4D, 0x58, 0xFE, 0xB3, 0xF8, 0x9E, 0x86, 0xDD, 0x18, 0x95, 0x5E, 0x05, 0x51, 0x88, 0x5B,
-    0x98, 0x50, 0x9D, 0x57, 0xE5, 0x1B, 0x64, 0xC7, 0x80, 0x58, 0x67, 0xC9, 0x27, 0x18, 0xCA, 0x36,
-    0x65, 0xAD, 0x41, 0x5A, 0xBC, 0xB5, 0x1D, 0xFA, 0xCB, 0x16, 0x83, 0xC1, 0x0C, 0x7C, 0xD2, 0x5F,
-    0xF8, 0x4B, 0xB7, 0xC4, 0x05, 0x96, 0xB8, 0x8B, 0x38, 0x18, 0xF3, 0xDE, 0xC1, 0x14, 0x76, 0x30,
-    0x00, 0xC4, 0xCC, 0x07, 0xB9, 0x2D, 0x62, 0x73, 0xDA, 0x64, 0xB7, 0x4D, 0x92, 0x8E, 0xBC, 0x0F,
-    0x21, 0x44, 0x07, 0xF6, 0xCF, 0xA8, 0x5A, 0x40, 0x09, 0xDC, 0xAB, 0x13, 0x90, 0xF2, 0xF9, 0x53,
-    0xCC, 0xAC, 0xA1, 0x2E, 0x10, 0x63, 0x9B, 0x1D, 0xC9, 0x80, 0x22, 0x04, 0xDB, 0x01, 0x4E, 0x4F,
-    0x2B, 0x33, 0x9F, 0xA8, 0x5D, 0xB2, 0x38, 0x32, 0x4F, 0x49, 0x78, 0xAD, 0xFC, 0x8D, 0xA7, 0x5D,
-    0xAE, 0x06, 0x70, 0x13, 0xC2, 0xB2, 0xCC, 0x04, 0x84, 0xF5, 0x61, 0x3E, 0x93, 0x84, 0x0E, 0x0C,
-    0xF0, 0x5B, 0x81, 0x14, 0xA3, 0xFE, 0x54, 0xB7, 0x39, 0x9C, 0xC8, 0x3D, 0x00, 0xA1, 0xC4, 0x81,
-    0x10, 0xA6, 0xAC, 0x8E, 0x87, 0xE6, 0x5E, 0x58, 0x79, 0x00, 0x2E, 0x7B, 0xC5, 0x54, 0xA7, 0xDE,
-    0x35, 0xEF, 0xD2, 0x16, 0x5F, 0x31, 0x2F, 0x60, 0xA6, 0x6D, 0xD9, 0x40, 0x68, 0xAD, 0x26, 0xD4,
-    0x74, 0x71, 0x4B, 0x00, 0x02, 0x30, 0x76, 0xDE, 0xE4, 0x8F, 0x74, 0xD8, 0x99, 0x51, 0x93, 0x80,
-    0x6D, 0x9E, 0xF1, 0xCD, 0xF4, 0xC5, 0xFB, 0x7A, 0x08, 0xC6, 0xBC, 0x30, 0x62, 0xF5, 0x28, 0xBB,
-    0xC9, 0xD5, 0x38, 0x3C, 0x6B, 0x38, 0xC7, 0x11, 0x4E, 0xB3, 0x88, 0x6C, 0xE0, 0x82, 0x6E, 0xA3,
-    0x7D, 0xE0, 0x0E, 0x18, 0x48, 0x7E, 0x0F, 0xC3, 0xCC, 0xB3, 0x24, 0x25, 0x8F, 0xD2, 0xD2, 0xCF,
-    0x61, 0xCA, 0xE9, 0x15, 0x56, 0x0F, 0x9F, 0x63, 0x88, 0xF9, 0x72, 0xE1, 0x62, 0x29, 0x49, 0xB9,
-    0x25, 0xFD, 0x4C, 0x2B, 0x6C, 0x4C, 0xAA, 0xD4, 0x17, 0x18, 0x9A, 0xA4, 0x9B, 0xCC, 0x1C, 0x10,
-    0x7A, 0x24, 0xFE, 0x88, 0x9A, 0xD9, 0x2D, 0x51, 0x6A, 0x84, 0x22, 0xDA, 0xB0, 0x3F, 0x6E, 0x31,
-    0xE7, 0xF2, 0x65, 0xF7, 0x7E, 0x5C, 0xBB, 0x4B, 0xC8, 0x9A, 0x56, 0x4E, 0x20, 0x36, 0xE5, 0x0E,
-    0xD4, 0x26, 0x3D, 0x37, 0x42, 0x77, 0xEF, 0x99, 0xD2, 0x5A, 0x67, 0x50, 0x1C, 0x4D, 0xED, 0xC9,
-    0xD5, 0x84, 0x8B, 0x37, 0xEA, 0x0A, 0x16, 0xA3, 0xEB, 0x31, 0x42, 0xFC, 0x35, 0xA6, 0x6D, 0x64,
-    0x83, 0x32, 0xDE, 0xFD, 0x2B, 0x8C, 0xFE, 0x7D, 0x0E, 0x2F, 0xE8, 0x5C, 0xEE, 0xFF, 0x4B, 0x7C,
-    0x8E, 0x54, 0x72, 0x65, 0x02, 0xA1, 0x30, 0xBB, 0x55, 0x18, 0x16, 0x79, 0x7B, 0x08, 0xFB, 0x6D,
-    0xF2, 0x31, 0x85, 0x40, 0x7E, 0xDD, 0xD8, 0x5A, 0x6F, 0x68, 0x5C, 0x28, 0x2A, 0x74, 0x49, 0x93,
-    0xC1, 0x19, 0xC2, 0x6C, 0xAF, 0xFE, 0x64, 0x0B, 0xF8, 0x62, 0x2E, 0x9B, 0x3E, 0x6F, 0x13, 0x51,
-    0xB3, 0x7A, 0xE5, 0x13, 0xA1, 0xD1, 0xDB, 0x2F, 0xCC, 0x68, 0x54, 0x98, 0xE2, 0xE8, 0xBF, 0x40,
-    0x63, 0xE3, 0xC2, 0x79, 0xD6, 0x98, 0xE1, 0x79, 0xE7, 0x22, 0x91, 0x5B, 0x32, 0x9A, 0xC6, 0x21,
-    0xBA, 0x6B, 0x70, 0xD3, 0xE6, 0x54, 0x1B, 0xB5, 0x3E, 0x6F, 0x3C, 0x71, 0xE1, 0xA1, 0xA9, 0xB0,
-    0x6E, 0xC4, 0xC4, 0x12, 0xA4, 0x0F, 0xEA, 0xD0, 0xEB, 0x94, 0x3D, 0x93, 0xB3, 0xE9, 0x8B, 0x99,
-    0x24, 0xA4, 0x24, 0xC0, 0xA5, 0x0E, 0x78, 0x32, 0xD6, 0x15, 0x75, 0x24, 0x19, 0xBC, 0x11, 0x8E,
-    0x14, 0xEA, 0x13, 0xB5, 0xB7, 0x8D, 0xE4, 0x17, 0x1E, 0x42, 0x68, 0x98, 0xD8, 0x10, 0xB6, 0x71,
-    0x1D, 0xF4, 0x11, 0x3C, 0x55, 0xD8, 0xD1, 0xAF, 0xE1, 0x6F, 0x35, 0x4B, 0xA5, 0x70, 0xB9, 0x70,
-    0x09, 0xE5, 0x25, 0x68, 0xED, 0x25, 0x78, 0xD0, 0x6F, 0xA7, 0x57, 0xCC, 0x03, 0xF9, 0x3F, 0xA7,
-    0x26, 0x9F, 0xF4, 0x98, 0x4E, 0xBA, 0xD7, 0x7D, 0x0C, 0x9B, 0x4A, 0xEA, 0x7D, 0x35, 0xBB, 0x19,
-    0x4F, 0xF9, 0x4B, 0x79, 0xCA, 0xDF, 0x2C, 0x3D, 0x65, 0xE0, 0x53, 0xD2, 0x87, 0xE5, 0x29, 0x17,
-    0x45, 0xF6, 0xC3, 0xE2, 0x6A, 0x03, 0x06, 0x49, 0x2C, 0xA8, 0x43, 0x05, 0xFC, 0x59, 0x06, 0xC5,
-    0x68, 0x58, 0x2E, 0xD1, 0x27, 0xF3, 0xEC, 0x28, 0x3E, 0xA4, 0xC1, 0x5C, 0xBE, 0x98, 0xFC, 0x7B,
-    0x26, 0xCC, 0x0D, 0xE6, 0xED, 0x91, 0x20, 0x0D, 0x58, 0x2D, 0xF9, 0x27, 0xE8, 0xBD, 0x09, 0xFC,
-    0x94, 0x16, 0x2D, 0xCC, 0x24, 0xB3, 0xD9, 0x57, 0xC0, 0x91, 0xF2, 0x07, 0x6A, 0xB4, 0xBE, 0xB4,
-    0x06, 0x69, 0x0E, 0x34, 0x6C, 0xB2, 0x29, 0x15, 0x75, 0xC1, 0xEE, 0x3F, 0x91, 0x5C, 0x19, 0x98,
-    0x25, 0x38, 0x3D, 0x20, 0x68, 0xF2, 0xC6, 0xA4, 0x8E, 0x9B, 0xF8, 0x05, 0x26, 0xE8, 0xA0, 0xA7,
-    0x71, 0x9D, 0x6E, 0x0F, 0xAD, 0x39, 0xD5, 0xE5, 0x26, 0x32, 0x23, 0xB4, 0x0D, 0x46, 0x0F, 0x4E,
-    0xBA, 0xE2, 0xF0, 0x82, 0xF7, 0xA6, 0x73, 0xC5, 0x7D, 0x79, 0x57, 0xDC, 0x33, 0xD8, 0x7D, 0x9A,
-    0x34, 0x10, 0x77, 0xAB, 0x71, 0xB7, 0xB8, 0x89, 0x1A, 0x10, 0xB8, 0xB8, 0x4E, 0x6A, 0xF3, 0x64,
-    0xCF, 0xF4, 0x78, 0x02, 0x1E, 0xB6, 0xE2, 0x8C, 0x4A, 0xA8, 0x28, 0xD4, 0xE0, 0x74, 0x1F, 0x80,
-    0x88, 0xAC, 0x88, 0x31, 0x1A, 0xE1, 0x2C, 0x9C, 0x9F, 0x24, 0xF0, 0x46, 0x3F, 0x8B, 0x5A, 0x78,
-    0xEC, 0xC2, 0x9C, 0x62, 0x4D, 0x1C, 0x6C, 0xBB, 0x9B, 0x41, 0x07, 0xFF, 0x82, 0x6A, 0xE4, 0x93,
-    0xE4, 0x25, 0xC7, 0xD5, 0xB2, 0x28, 0x77, 0x80, 0x7F, 0x21, 0x96, 0x29, 0xEC, 0x48, 0x68, 0xD2,
-    0x4B, 0xE0, 0xFF, 0x90, 0x06, 0x75, 0x0D, 0x32, 0x01, 0xB6, 0xEC, 0x89, 0xBA, 0x1D, 0xEB, 0xB1,
-    0xAC, 0x03, 0x61, 0x12, 0x0B, 0x56, 0x33, 0x29, 0x59, 0x1A, 0x46, 0xAD, 0x40, 0x34, 0xAC, 0xB0,
-    0x0D, 0x12, 0x84, 0x90, 0xDE, 0x7A, 0x92, 0xB4, 0x91, 0x86, 0xD9, 0x78, 0xD3, 0x7D, 0x50, 0x7F,
-    0x4C, 0x11, 0xB6, 0xCC, 0xFE, 0x8C, 0x2C, 0x18, 0x11, 0xDB, 0x97, 0x18, 0x25, 0x47, 0x1B, 0x74,
-    0x13, 0x6C, 0x56, 0x7F, 0xFB, 0xBF, 0x0D, 0xC9, 0x4B, 0x6B, 0xB0, 0x8D, 0xE7, 0x26, 0x1F, 0xF0,
-    0x85, 0x41, 0xAF, 0xEC, 0x67, 0x64, 0x7E, 0xC6, 0x9C, 0xAD, 0xF2, 0x5C, 0x47, 0x05, 0x27, 0x7A,
-    0x71, 0x9F, 0x73, 0xAF, 0xB2, 0x70, 0x00, 0xEE, 0x08, 0x75, 0x83, 0xCD, 0x79, 0x70, 0x15, 0xBA,
-    0x80, 0xCA, 0xA5, 0x97, 0x07, 0x18, 0x05, 0x44, 0x01, 0xFA, 0x87, 0x15, 0x2F, 0x22, 0xC0, 0x66,
-    0x9B, 0x32, 0xD9, 0xCD, 0x0F, 0x17, 0xFB, 0xB7, 0x3E, 0x13, 0xC1, 0x4C, 0xCB, 0x2C, 0x7E, 0x75,
-    0x50, 0xDF, 0x08, 0x16, 0x71, 0xFE, 0xAD, 0x04, 0x78, 0x86, 0x2D, 0x0A, 0xD4, 0x4D, 0x51, 0x65,
-    0x71, 0x5B, 0x4D, 0x3D, 0x49, 0xAB, 0xF8, 0x3A, 0x45, 0x9C, 0x29, 0x80, 0x0D, 0xC9, 0x1B, 0x44,
-    0x53, 0xA5, 0x12, 0x91, 0xD5, 0xC2, 0xDE, 0x56, 0x04, 0x60, 0x00, 0x24, 0xEC, 0x75, 0xA8, 0xD4,
-    0x2A, 0x2B, 0x58, 0xF9, 0xD9, 0x2C, 0xB1, 0x91, 0x65, 0x45, 0xAF, 0xE0, 0x8D, 0x5E, 0x86, 0x3B,
-    0x81, 0x4F, 0x9A, 0x3E, 0xB8, 0xCE, 0xAA, 0xFD, 0x36, 0xDC, 0x06, 0x73, 0x82, 0x10, 0x2D, 0x48,
-    0x33, 0x02, 0x66, 0x84, 0x80, 0x20, 0x5B, 0x24, 0xBC, 0x35, 0x17, 0x24, 0x22, 0xFC, 0xB7, 0x79,
-    0xC6, 0xBC, 0x15, 0xB3, 0x58, 0xBA, 0xF0, 0x98, 0x76, 0x79, 0x81, 0x51, 0x4D, 0x27, 0xCF, 0xF1,
-    0x77, 0x67, 0x98, 0xBF, 0x28, 0xA9, 0x13, 0x09, 0x3A, 0x2C, 0x94, 0xEC, 0x67, 0x83, 0x41, 0xB4,
-    0x3D, 0xB0, 0x36, 0x30, 0xE5, 0xF8, 0x97, 0x65, 0x86, 0x95, 0x96, 0x7C, 0x2E, 0x73, 0x8D, 0xF0,
-    0x8A, 0x23, 0x33, 0x7F, 0x8C, 0x34, 0xF3, 0xE2, 0x0F, 0xC2, 0x3E, 0x6C, 0xF3, 0x37, 0x18, 0x0E,
-    0xC3, 0x8A, 0x9C, 0xB0, 0x4E, 0x8A, 0xCA, 0x95, 0xB0, 0xA9, 0x3D, 0x78, 0x76, 0xBF, 0x60, 0x4C,
-    0x5A, 0x4B, 0xC1, 0x02, 0xFA, 0x16, 0x8C, 0x27, 0x31, 0x26, 0x3E, 0xF4, 0x9B, 0x08, 0x4A, 0x1E,
-    0x35, 0xE4, 0x33, 0x90, 0x92, 0x63, 0x88, 0xA2, 0xEB, 0xBD, 0x10, 0xE1, 0x5F, 0xD0, 0xD8, 0x32,
-    0xCD, 0x2F, 0x16, 0x02, 0xAD, 0x7A, 0x90, 0xFA, 0x3B, 0xFC, 0x3B, 0x35, 0xAA, 0x82, 0x13, 0xDC,
-    0x44, 0x54, 0x83, 0x0F, 0x8F, 0x73, 0x74, 0xC0, 0x9E, 0x0D, 0x46, 0x2C, 0xEA, 0x3F, 0x49, 0xA4,
-    0x95, 0xF6, 0xDA, 0x40, 0x5F, 0x93, 0x3A, 0x6A, 0x05, 0x05, 0x4B, 0x06, 0x18, 0x4D, 0x08, 0x25,
-    0x7C, 0xA8, 0x04, 0x4E, 0xE0, 0x93, 0xF2, 0xC8, 0x34, 0x78, 0x65, 0xD4, 0xCF, 0xB6, 0xD3, 0x2D,
-    0xBE, 0x73, 0x44, 0x47, 0x14, 0xE3, 0xCC, 0x16, 0x5F, 0x85, 0x22, 0x45, 0x92, 0xDB, 0x9D, 0x58,
-    0x62, 0x95, 0x57, 0x88, 0x02, 0x80, 0x59, 0x8E, 0xE0, 0x57, 0xB8, 0xC1, 0x22, 0xAF, 0xBF, 0x65,
-    0xF3, 0xA4, 0x4C, 0x8C, 0x8A, 0x43, 0x78, 0x6A, 0xE1, 0xD4, 0x4A, 0xD2, 0x42, 0x88, 0xF6, 0xB4,
-    0x0B, 0xFE, 0xA5, 0xE1, 0xA6, 0xB1, 0x0C, 0x41, 0x96, 0x48, 0x96, 0xC9, 0xC6, 0xDE, 0xCC, 0x20,
-    0x1A, 0x4B, 0x1C, 0xA8, 0xC5, 0xBE, 0x8D, 0x2F, 0xEE, 0xC0, 0xD3, 0xCF, 0xAC, 0x35, 0x8A, 0x3D,
-    0x15, 0x60, 0x4D, 0xEA, 0x2B, 0x36, 0xED, 0x70, 0x52, 0x6A, 0x70, 0x92, 0x39, 0x16, 0x77, 0xAA,
-    0xB6, 0x84, 0x62, 0xF6, 0x2C, 0x68, 0xFB, 0x2C, 0xF9, 0xAB, 0xA0, 0x29, 0xBF, 0x9E, 0xA9, 0xB0,
-    0x96, 0x28, 0xBC, 0x22, 0x53, 0x89, 0xCF, 0xD2, 0x25, 0xA4, 0xF7, 0x02, 0xCE, 0x94, 0xA8, 0xE9,
-    0x9D, 0x5B, 0x30, 0xDC, 0x4E, 0x0F, 0x3E, 0x40, 0x4D, 0xF8, 0x23, 0x33, 0xC0, 0xE9, 0x38, 0x07,
-    0xAB, 0x0E, 0xDA, 0x12, 0x86, 0xB1, 0x98, 0x98, 0xB7, 0xC6, 0xB4, 0x89, 0x37, 0x49, 0x5D, 0x00,
-    0x60, 0x8C, 0x11, 0x86, 0xEF, 0xFC, 0x93, 0xA4, 0x68, 0x3A, 0x28, 0xC1, 0x04, 0xB6, 0xB4, 0x01,
-    0x70, 0x8B, 0xBA, 0xB8, 0x8E, 0x6B, 0x43, 0x70, 0x83, 0xFD, 0xD7, 0x29, 0x59, 0xD7, 0xA9, 0x2E,
-    0x05, 0xEB, 0x21, 0x17, 0xB1, 0x89, 0x48, 0xA7, 0xFE, 0x22, 0x1A, 0x86, 0x23, 0xB7, 0x49, 0x68,
-    0x7B, 0x96, 0xD1, 0x1D, 0xE3, 0x8B, 0x41, 0xCA, 0xF3, 0x10, 0x02, 0x98, 0x2D, 0x24, 0xAD, 0x9F,
-    0x05, 0xB6, 0xBC, 0xC1, 0x16, 0xB9, 0x6D, 0xC4, 0x59, 0xE0, 0xC6, 0x65, 0x0D, 0x2E, 0x06, 0x9A,
-    0x47, 0xAE, 0x13, 0x02, 0x94, 0x7D, 0x3C, 0x16, 0x4A, 0x5A, 0xFE, 0x35, 0x48, 0x80, 0x79, 0x00,
-    0x5A, 0xF5, 0x58, 0x27, 0x15, 0xA0, 0x15, 0xEB, 0x68, 0x6C, 0x65, 0xDF, 0x56, 0x62, 0xED, 0x12,
-    0xB0, 0x8C, 0xE6, 0x35, 0x8B, 0x22, 0xC0, 0xAD, 0x74, 0xCF, 0x4D, 0x82, 0xB0, 0x27, 0x1D, 0x6E,
-    0x83, 0x7E, 0xA8, 0x1C, 0x5A, 0x9B, 0x80, 0x3A, 0x47, 0x6F, 0xC0, 0x48, 0xAE, 0xBB, 0x51, 0xE6,
-    0x2C, 0xAD, 0x3F, 0x0B, 0x69, 0xBE, 0x39, 0xAE, 0x80, 0x5C, 0x3C, 0x7B, 0x16, 0xDC, 0x00, 0x21,
-    0x1D, 0x02, 0xAF, 0x2A, 0x69, 0x96, 0x1A, 0xBC, 0x18, 0x14, 0x4B, 0xA1, 0x8E, 0x2B, 0x2A, 0xF9,
-    0x15, 0x49, 0x5C, 0xA5, 0xF3, 0x68, 0xEC, 0xE4, 0x8F, 0x27, 0x12, 0x60, 0x83, 0x4C, 0xDF, 0x36,
-    0x92, 0x62, 0x56, 0x69, 0x2D, 0x2E, 0x9B, 0x3C, 0x2D, 0xEC, 0xC0, 0x23, 0x81, 0xAC, 0xA4, 0x6B,
-    0xAD, 0x02, 0xFE, 0x42, 0xE0, 0x65, 0x7B, 0xEF, 0x90, 0xE6, 0x0F, 0xA7, 0xE6, 0x59, 0xF0, 0x8B,
-    0x36, 0x67, 0x8C, 0xDE, 0x1F, 0xEC, 0x40, 0xBA, 0x83, 0x15, 0xE5, 0x6F, 0xB1, 0x2A, 0x45, 0x92,
-    0xF5, 0x52, 0xEB, 0x38, 0xCD, 0xA1, 0x5D, 0xB5, 0x1F, 0x13, 0x7D, 0xD6, 0xD4, 0xEE, 0x66, 0x44,
-    0x61, 0x8F, 0x43, 0xD5, 0xEE, 0x69, 0x9D, 0x00, 0x03, 0xDE, 0xF6, 0xE7, 0xCA, 0x5A, 0x8D, 0x48,
-    0xF3, 0xF6, 0x8D, 0xF3, 0x2E, 0x43, 0x5E, 0xF6, 0x56, 0xE6, 0x2C, 0x38, 0xD4, 0xEC, 0xA1, 0x0A,
-    0xF6, 0xCA, 0x6B, 0x43, 0x7C, 0x79, 0x0A, 0x9A, 0xBB, 0xA1, 0x95, 0x19, 0x42, 0xE8, 0x6F, 0x59,
-    0x13, 0x0B, 0xA7, 0xBF, 0xA7, 0x70, 0x26, 0x5B, 0x69, 0x02, 0xEA, 0x1B, 0x9B, 0xA2, 0x9C, 0xD3,
-    0x7D, 0x75, 0x2C, 0xD9, 0xAE, 0x2A, 0xEE, 0x7D, 0xB3, 0x61, 0xE0, 0xBD, 0x0C, 0xB3, 0x4F, 0xB3,
-    0x1C, 0x8F, 0x28, 0xB6, 0x08, 0x32, 0x31, 0x84, 0x10, 0x84, 0x76, 0xB1, 0x63, 0x58, 0xD5, 0x79,
-    0x93, 0x79, 0xB9, 0x21, 0x61, 0x36, 0xC4, 0x1F, 0x7E, 0x00, 0x1F, 0xAE, 0xD9, 0x6D, 0x19, 0x18,
-    0x68, 0x6B, 0x91, 0x2B, 0x03, 0xC6, 0x0D, 0x56, 0xC6, 0xC0, 0x68, 0x02, 0x15, 0x68, 0x93, 0xE7,
-    0xA1, 0xC7, 0x4F, 0xF6, 0x69, 0x1D, 0x30, 0x14, 0x00, 0xCA, 0x65, 0x56, 0x2D, 0x3E, 0xA0, 0x0C,
-    0x56, 0xED, 0x97, 0xC1, 0x98, 0x86, 0x02, 0x3F, 0x08, 0x58, 0x06, 0x83, 0x70, 0xA6, 0x8D, 0x8D,
-    0xF2, 0x2A, 0x73, 0xA4, 0x9D, 0xE4, 0x77, 0x35, 0x51, 0x92, 0xF9, 0x44, 0x73, 0x8E, 0xEB, 0xEA,
-    0xCA, 0x60, 0x9D, 0x94, 0xC1, 0xB2, 0x0F, 0x2E, 0x83, 0x2D, 0x85, 0x64, 0x2F, 0x02, 0xB8, 0x59,
-    0xAA, 0x80, 0x96, 0xC3, 0xF2, 0xA6, 0x0D, 0x03, 0x03, 0xEF, 0x0D, 0x1E, 0xD2, 0x33, 0xB9, 0x12,
-    0xDA, 0xE4, 0xCA, 0x0D, 0x21, 0x99, 0xD0, 0x29, 0xFC, 0xC2, 0x43, 0x7C, 0x4A, 0x02, 0xC2, 0xCC,
-    0xA2, 0x61, 0x86, 0x27, 0xDA, 0xAD, 0x31, 0x18, 0x50, 0xCD, 0x94, 0x99, 0x43, 0xE9, 0xA3, 0xE4,
-    0x0A, 0x90, 0xDF, 0x0F, 0x81, 0xE0, 0x21, 0xA2, 0x51, 0xA0, 0xA1, 0x34, 0x06, 0xDC, 0x47, 0xAB,
-    0x9C, 0x58, 0x03, 0x0E, 0x76, 0xA5, 0x0A, 0x74, 0xBD, 0xDA, 0x2F, 0x54, 0x94, 0xAD, 0x72, 0x09,
-    0x4B, 0xD7, 0xA1, 0x16, 0x2F, 0x35, 0x93, 0xC0, 0x73, 0x70, 0x6E, 0x8C, 0xCF, 0x03, 0xC0, 0x7E,
-    0xA5, 0x01, 0x13, 0x3E, 0xEB, 0x67, 0x31, 0xC3, 0x2A, 0xAA, 0xF6, 0x15, 0x32, 0x77, 0xDC, 0x39,
-    0xD8, 0x13, 0xB2, 0x5E, 0x58, 0x97, 0xA2, 0xA4, 0x87, 0x51, 0x02, 0x35, 0xA9, 0x35, 0x15, 0xCB,
-    0xD6, 0xF4, 0x7B, 0x56, 0x7D, 0x1F, 0x33, 0x29, 0xA7, 0x1A, 0x5B, 0x4E, 0x1D, 0x96, 0xF3, 0xE5,
-    0x7A, 0x39, 0x59, 0xEE, 0xDA, 0x9B, 0x5C, 0xA6, 0xFC, 0x47, 0x9F, 0x5E, 0x36, 0x65, 0xFA, 0x32,
-    0xEC, 0xF8, 0xD7, 0xFB, 0x76, 0x5C, 0x99, 0x02, 0x2E, 0x26, 0xB3, 0x46, 0x5C, 0x5B, 0x06, 0x02,
-    0xB8, 0x82, 0x20, 0xEB, 0x0F, 0xCD, 0x4D, 0xFB, 0x9B, 0x7B, 0xEB, 0xCC, 0xCA, 0x66, 0xEA, 0x0F,
-    0xA7, 0x13, 0x37, 0x25, 0x37, 0xFD, 0x03, 0x3C, 0x01, 0x94, 0xB3, 0x55, 0x7F, 0x68, 0xC3, 0xEF,
-    0x9C, 0x6E, 0x87, 0x2D, 0xBF, 0x4C, 0xB8, 0x48, 0x04, 0xAE, 0xF4, 0x4F, 0xD6, 0x13, 0x48, 0x73,
-    0x32, 0x57, 0x01, 0xB2, 0x93, 0xDA, 0xD2, 0x99, 0x7E, 0xA2, 0x4E, 0xAE, 0x4E, 0x6B, 0x0D, 0xA8,
-    0x0D, 0x40, 0xDF, 0xE2, 0xEE, 0xFB, 0x96, 0x6C, 0x43, 0x96, 0x6C, 0x7D, 0x96, 0x6C, 0x3D, 0x96,
-    0x6C, 0xD9, 0x4E, 0xFA, 0xCE, 0x6B, 0x2C, 0xD9, 0xBE, 0xCB, 0x92, 0x2D, 0xD4, 0x38, 0xBD, 0x2E,
-    0x25, 0x5B, 0x06, 0x0B, 0x7B, 0x6B, 0x5C, 0xF7, 0x98, 0x0A, 0xB1, 0xF2, 0x21, 0x25, 0xDB, 0x0F,
-    0xC9, 0x51, 0xB4, 0x37, 0xE6, 0x28, 0xBE, 0x9D, 0x56, 0xFE, 0xF0, 0x0C, 0x1E, 0xFA, 0xE6, 0xBB,
-    0x60, 0x2F, 0xE7, 0x88, 0x1F, 0x3F, 0x1D, 0x6C, 0x2B, 0xBA, 0xDE, 0x99, 0x98, 0xA3, 0xB8, 0x8B,
-    0x39, 0x8A, 0x67, 0x60, 0x73, 0x5E, 0xF1, 0xFE, 0x39, 0x0A, 0xE7, 0x37, 0x93, 0x7D, 0xD5, 0x39,
-    0x63, 0xCB, 0x6D, 0xDA, 0xF5, 0xC0, 0x0F, 0x78, 0x3A, 0x30, 0x57, 0x9A, 0x21, 0xC2, 0x45, 0xF1,
-    0xF6, 0xFD, 0xEA, 0xB6, 0x1F, 0xAF, 0x61, 0x2B, 0xAA, 0xD8, 0x80, 0x25, 0x0F, 0xF7, 0x7A, 0x26,
-    0xE4, 0x11, 0xB4, 0x7A, 0x9B, 0xBB, 0xCA, 0x45, 0x2F, 0xA2, 0x16, 0x54, 0x6D, 0xC0, 0x8A, 0xBF,
-    0xA0, 0xFB, 0x7F, 0xCB, 0x66, 0x9E, 0x56, 0x80, 0x14, 0xFA, 0xB0, 0xE4, 0x19, 0xFF, 0xC3, 0x46,
-    0xB3, 0x66, 0x31, 0xEE, 0xC0, 0x48, 0xC7, 0x34, 0x75, 0xE5, 0x23, 0x8D, 0x7B, 0xF5, 0x38, 0xD9,
-    0x01, 0xBE, 0x9C, 0xFF, 0x78, 0xFC, 0x03, 0x0C, 0xEC, 0x70, 0x5A, 0x7D, 0x15, 0x0A, 0xC9, 0x54,
-    0x45, 0x45, 0xC3, 0x1D, 0x1F, 0xF6, 0xA6, 0xD5, 0x23, 0x79, 0x91, 0x26, 0x7B, 0xE5, 0x36, 0xDB,
-    0xC2, 0x10, 0x6F, 0x1C, 0x5E, 0x1A, 0xE0, 0xDC, 0xE0, 0x67, 0xA4, 0xC1, 0xCF, 0xE3, 0xD8, 0x3C,
-    0x16, 0x2B, 0xBC, 0x76, 0x59, 0xB0, 0xD7, 0x27, 0x69, 0xF0, 0xAB, 0xA9, 0x75, 0x58, 0xDD, 0x26,
-    0xA1, 0xF2, 0x47, 0xA4, 0x0C, 0xD2, 0x3D, 0x18, 0x52, 0xFF, 0x43, 0x76, 0xA8, 0xE1, 0x8B, 0x66,
-    0x3D, 0xEA, 0x13, 0x46, 0x9D, 0x00, 0x91, 0xB9, 0xD3, 0x5F, 0x66, 0x11, 0x9C, 0x35, 0xAE, 0x72,
-    0x1E, 0xD1, 0x0B, 0xF8, 0xAE, 0x3A, 0x81, 0xE7, 0x5F, 0x92, 0xA6, 0xA8, 0x02, 0x41, 0x92, 0x0F,
-    0x07, 0x15, 0x65, 0x9C, 0xF7, 0x74, 0x44, 0xBA, 0xCD, 0x53, 0xE6, 0x16, 0xC3, 0x89, 0xC6, 0x0E,
-    0x3D, 0x43, 0x8C, 0x81, 0xD0, 0x49, 0x95, 0x0C, 0xD4, 0xDD, 0x52, 0x48, 0x47, 0x65, 0x97, 0x56,
-    0xAC, 0x38, 0x30, 0xD2, 0x88, 0x5E, 0x57, 0xBF, 0x57, 0x6D, 0x66, 0x8D, 0x65, 0x6F, 0x61, 0x77,
-    0x43, 0x65, 0xF1, 0xCC, 0x0D, 0x95, 0xC5, 0xA8, 0x58, 0x6C, 0x64, 0xF9, 0x94, 0xD3, 0xEF, 0x46,
-    0xD2, 0xEF, 0xBB, 0xED, 0xCA, 0xE2, 0xF9, 0xAE, 0x51, 0x55, 0x2F, 0x55, 0x41, 0xAD, 0x37, 0x54,
-    0xB7, 0xDF, 0xAC, 0xF6, 0xB8, 0xF1, 0x7D, 0xDA, 0xE3, 0x7A, 0x47, 0xA1, 0xE3, 0xC2, 0xD6, 0x2D,
-    0xB8, 0x02, 0xC9, 0xFA, 0x27, 0xA8, 0x08, 0x10, 0x5B, 0x5A, 0x75, 0x28, 0x95, 0xCD, 0x14, 0xF4,
-    0x74, 0xAB, 0x4E, 0xEC, 0x4F, 0x71, 0x58, 0xB1, 0xF4, 0x16, 0xE8, 0x41, 0x8A, 0x78, 0x83, 0xA4,
-    0x53, 0xEE, 0xC0, 0xD0, 0x39, 0xDF, 0x90, 0x2E, 0x9D, 0xC5, 0xBB, 0x8C, 0x36, 0x21, 0x63, 0x7A,
-    0x67, 0xA9, 0x5D, 0xCC, 0xBC, 0xB7, 0x5D, 0xAC, 0x7C, 0x6F, 0xBB, 0x58, 0xF7, 0xDE, 0x76, 0x31,
-    0x51, 0x2D, 0xA1, 0x94, 0x4E, 0xB8, 0x7A, 0xA9, 0xAE, 0x6C, 0x5B, 0x81, 0x1F, 0xFA, 0x24, 0x65,
-    0x80, 0x47, 0x11, 0x26, 0x63, 0x40, 0xD2, 0x35, 0xEC, 0x24, 0x29, 0x21, 0x02, 0x13, 0x78, 0x92,
-    0x32, 0x3E, 0x6F, 0x05, 0x70, 0xA7, 0x58, 0x66, 0x59, 0xB3, 0x3A, 0x00, 0x72, 0x85, 0xA1, 0x4A,
-    0xBF, 0x9C, 0xCA, 0xFF, 0x42, 0xAA, 0xF0, 0xD4, 0xEB, 0xFF, 0xC5, 0xB9, 0xA7, 0x2F, 0x49, 0xC3,
-    0xDC, 0x5B, 0xCF, 0x51, 0xA5, 0xC6, 0xEB, 0xB2, 0x7F, 0x42, 0xFA, 0x22, 0xCA, 0x4D, 0x99, 0xFC,
-    0x8B, 0x6B, 0x8C, 0x76, 0xDE, 0xBA, 0xD2, 0x53, 0x41, 0x5A, 0xFA, 0xD3, 0xE9, 0x08, 0x01, 0xA0,
-    0xB4, 0xCD, 0xAA, 0x35, 0xD7, 0x9C, 0xAC, 0x41, 0x0A, 0x4F, 0x81, 0x6D, 0x36, 0xB6, 0x1D, 0xF9,
-    0xDE, 0xCC, 0xA7, 0x80, 0x2D, 0x8E, 0x4F, 0x15, 0xBA, 0x07, 0x24, 0x74, 0x2A, 0x7C, 0xFB, 0x09,
-    0x60, 0xEB, 0xFF, 0x25, 0xED, 0xFC, 0x3F, 0x9C, 0x2B, 0x9B, 0xC9, 0xFE, 0x1F, 0x0C, 0xA4, 0x7C,
-    0x08, 0x63, 0x1C, 0xAF, 0x72, 0xB6, 0xD1, 0x5B, 0x4D, 0x0E, 0x37, 0x75, 0x2F, 0x4C, 0x6C, 0x90,
-    0x24, 0xF9, 0x22, 0xC6, 0xFA, 0xE0, 0x4E, 0xC0, 0x0B, 0xD3, 0x39, 0x21, 0xBB, 0x8F, 0x63, 0x80,
-    0xA7, 0x77, 0xE3, 0x45, 0x27, 0xE0, 0xEE, 0xC5, 0x9B, 0xDB, 0x09, 0x28, 0x3D, 0x58, 0xEE, 0x3F,
-    0x42, 0x16, 0x79, 0x28, 0x18, 0xC0, 0x91, 0xD4, 0x5C, 0x1A, 0x53, 0x50, 0x69, 0x7F, 0x48, 0x47,
-    0xBF, 0xCF, 0x55, 0xD0, 0xF5, 0x2A, 0x78, 0xBB, 0x51, 0x21, 0x04, 0xCB, 0x06, 0xA0, 0x18, 0x11,
-    0x60, 0xFC, 0x36, 0x96, 0xE3, 0xD5, 0x61, 0x25, 0x7D, 0x7E, 0xBA, 0x3B, 0xAD, 0x0D, 0x1B, 0x78,
-    0x3A, 0x5D, 0xA4, 0x0B, 0xF2, 0xF2, 0x20, 0x63, 0x60, 0x4F, 0x40, 0x14, 0x71, 0x6D, 0xB9, 0x09,
-    0x80, 0xE3, 0xAE, 0x2D, 0x35, 0x7D, 0x01, 0xB6, 0x9C, 0x6D, 0x49, 0xD3, 0x01, 0x9E, 0xF9, 0xBD,
-    0xA4, 0xD5, 0xE2, 0x33, 0xB9, 0x8C, 0xBE, 0x59, 0x2B, 0x1C, 0xEB, 0xC1, 0x84, 0x76, 0x6C, 0x60,
-    0x65, 0x77, 0xD1, 0x30, 0xA2, 0x0C, 0x24, 0xD6, 0x66, 0x64, 0x2B, 0xBD, 0x5D, 0x89, 0xEC, 0xD6,
-    0x09, 0xEC, 0x1E, 0xA0, 0xBC, 0x16, 0x53, 0x19, 0x65, 0x83, 0x8E, 0x6D, 0x3E, 0xC1, 0xD2, 0x79,
-    0x27, 0x99, 0xFC, 0x30, 0xB5, 0xBE, 0x4C, 0xFA, 0xF9, 0xC0, 0xA3, 0x83, 0x1E, 0x8E, 0xC6, 0xAF,
-    0xF5, 0x80, 0x98, 0xB5, 0x4C, 0xFD, 0xDD, 0xD8, 0x11, 0xF4, 0x19, 0xA1, 0x51, 0x2A, 0xA4, 0x59,
-    0x61, 0x4F, 0x6B, 0xBC, 0xDA, 0xAF, 0xA8, 0x32, 0x7A, 0xA7, 0xE5, 0x06, 0xB1, 0x0A, 0x94, 0xDC,
-    0x16, 0x64, 0x7F, 0x2B, 0x52, 0xFB, 0x99, 0xF4, 0x08, 0x1E, 0x24, 0xB5, 0x56, 0xE4, 0xB9, 0x5A,
-    0x6A, 0xFC, 0x89, 0x0E, 0x90, 0xDA, 0x87, 0xD4, 0xC7, 0xAB, 0x58, 0x7D, 0x81, 0x45, 0xA2, 0x57,
-    0xE6, 0x22, 0xD1, 0x36, 0xEC, 0xF0, 0x61, 0xC7, 0x46, 0xF6, 0x13, 0xEE, 0xE2, 0x17, 0xCC, 0xBE,
-    0x6B, 0x5B, 0x88, 0xC6, 0xC9, 0xC6, 0xF6, 0x7D, 0x78, 0xE2, 0xC6, 0x29, 0x9D, 0xA8, 0xB1, 0xE2,
-    0x49, 0x33, 0x2B, 0x9F, 0x8B, 0x56, 0x40, 0xA0, 0x5E, 0x4E, 0x42, 0x4E, 0x44, 0xB3, 0x8C, 0x66,
-    0x21, 0xCD, 0x52, 0x72, 0x62, 0x9A, 0xE5, 0x34, 0x0B, 0xCA, 0x49, 0x6A, 0x16, 0x95, 0x93, 0xD5,
-    0xDC, 0x50, 0xB9, 0xE8, 0xA8, 0x94, 0xE0, 0x04, 0xCE, 0x96, 0xED, 0x20, 0xAC, 0x81, 0xD0, 0x96,
-    0x7F, 0x41, 0xB2, 0x68, 0x82, 0x86, 0x39, 0x86, 0x1C, 0x14, 0x3E, 0x7D, 0xBE, 0xB3, 0x8D, 0x4E,
-    0xD6, 0x35, 0x25, 0xD7, 0x36, 0xD9, 0xBA, 0x95, 0xE5, 0x99, 0xCB, 0x63, 0x53, 0x28, 0x15, 0xB3,
-    0xD9, 0x86, 0x6C, 0x8B, 0x89, 0xC4, 0xD6, 0x71, 0x86, 0xEC, 0x86, 0x4D, 0x59, 0xC6, 0x75, 0x52,
-    0x4A, 0x51, 0x62, 0x6F, 0x73, 0xB4, 0xDE, 0x29, 0x71, 0x74, 0x50, 0xE8, 0xAD, 0x34, 0xC9, 0x4A,
-    0xE3, 0x8B, 0xDD, 0xB2, 0xD0, 0x59, 0x5E, 0xC5, 0x92, 0x7F, 0x49, 0x4E, 0x4F, 0xE7, 0x25, 0x1E,
-    0x41, 0x5B, 0x86, 0xC3, 0x65, 0xA9, 0x85, 0xD0, 0x70, 0xBB, 0x1F, 0xDB, 0x31, 0x7C, 0xD9, 0x84,
-    0x64, 0x0A, 0x21, 0x3B, 0xF3, 0x56, 0xC7, 0x84, 0x0D, 0x19, 0xB2, 0xDF, 0xCA, 0x9F, 0x42, 0x6E,
-    0x41, 0x42, 0x2C, 0x02, 0x9C, 0x29, 0x4D, 0xE5, 0xD4, 0xD8, 0x6E, 0xD0, 0x74, 0xB4, 0x54, 0x85,
-    0xF7, 0x18, 0xC7, 0x79, 0xAC, 0x3F, 0x35, 0xEE, 0x5D, 0x19, 0x22, 0x6B, 0x6D, 0x2A, 0x99, 0x22,
-    0xCA, 0x71, 0xC2, 0xA4, 0x15, 0x08, 0xB7, 0x04, 0x24, 0x6F, 0xCA, 0xF5, 0x12, 0x0B, 0x54, 0xC6,
-    0x9F, 0x7E, 0x40, 0xEB, 0xE4, 0xB2, 0x33, 0xF5, 0xDD, 0x32, 0x64, 0x8E, 0x7A, 0x28, 0x12, 0x13,
-    0xB3, 0x6D, 0xD4, 0xF9, 0x92, 0xFD, 0xF6, 0x41, 0x96, 0x78, 0x4D, 0x45, 0xED, 0x60, 0xC0, 0xB5,
-    0xDD, 0x76, 0x22, 0x85, 0x27, 0x1B, 0x73, 0x8A, 0x3A, 0x7B, 0x0D, 0x81, 0x52, 0xE2, 0x1E, 0xDC,
-    0x5B, 0x3E, 0xF2, 0x37, 0x1C, 0xCA, 0xEA, 0x53, 0x02, 0x5A, 0x42, 0x00, 0x25, 0x58, 0xE7, 0xF6,
-    0xB3, 0x8C, 0x75, 0x69, 0x00, 0x33, 0x16, 0xF1, 0xA7, 0x6D, 0x84, 0x25, 0x0A, 0xFB, 0xB8, 0x0B,
-    0xBA, 0xA0, 0x4F, 0x40, 0xDA, 0x82, 0x3E, 0xC5, 0x13, 0x99, 0x10, 0x66, 0xB6, 0x93, 0xD7, 0xA8,
-    0xD5, 0x35, 0x47, 0xC1, 0xBF, 0x27, 0xB5, 0xE6, 0xDF, 0xAA, 0x14, 0x63, 0x2B, 0xE1, 0x07, 0xC3,
-    0x5D, 0xE6, 0x73, 0x03, 0x69, 0x47, 0xB8, 0x6E, 0xDE, 0xF9, 0xEF, 0xA2, 0x84, 0x04, 0xCF, 0x37,
-    0xE8, 0xE1, 0x0F, 0x93, 0x43, 0x7B, 0xE7, 0xDD, 0xD6, 0xA7, 0xB8, 0x5B, 0xCD, 0x18, 0xDE, 0xD5,
-    0x51, 0x9B, 0x42, 0xAC, 0xF7, 0x0C, 0xFA, 0x2C, 0x7C, 0xF1, 0x16, 0xE8, 0x9A, 0xDF, 0xE3, 0xA7,
-    0xB8, 0x1E, 0xC3, 0x46, 0x63, 0x10, 0x97, 0x7B, 0x3C, 0x21, 0xAE, 0xD2, 0x6A, 0x82, 0x71, 0x3D,
-    0x6F, 0xAA, 0xAC, 0x34, 0x66, 0x53, 0xE5, 0x13, 0xB4, 0x62, 0x55, 0x72, 0x05, 0x9F, 0x6E, 0xFF,
-    0xA9, 0x24, 0x35, 0x24, 0x49, 0x24, 0x85, 0x32, 0xFA, 0x5A, 0xEA, 0x63, 0x40, 0x84, 0xB4, 0x75,
-    0xBD, 0x8F, 0x53, 0x83, 0x05, 0x0E, 0xC4, 0xCA, 0x7B, 0xBC, 0x22, 0x5D, 0xA1, 0xFD, 0x1D, 0xFF,
-    0x0C, 0xFA, 0x5B, 0xC5, 0x4F, 0x51, 0x31, 0xA5, 0xA5, 0x53, 0x80, 0x47, 0xAA, 0x96, 0xD2, 0xDE,
-    0x68, 0x2F, 0xF5, 0x5C, 0x1A, 0xC6, 0xB2, 0x94, 0x05, 0x56, 0x65, 0xD2, 0x43, 0x3E, 0x78, 0x6B,
-    0x2F, 0x9B, 0x97, 0xD9, 0xF9, 0x22, 0xB5, 0xE1, 0x64, 0x48, 0x7B, 0x9A, 0x57, 0x60, 0x64, 0xA3,
-    0x9E, 0x96, 0x70, 0x91, 0xC5, 0x61, 0x98, 0x34, 0x0B, 0xC3, 0x11, 0x42, 0x84, 0x98, 0x76, 0x66,
-    0xBC, 0xF1, 0x88, 0x54, 0x87, 0x7F, 0x7D, 0x69, 0xF2, 0x47, 0xA8, 0x61, 0x5A, 0x03, 0x1C, 0xCC,
-    0x31, 0x16, 0xBD, 0x46, 0x51, 0x55, 0x2F, 0xB1, 0xFD, 0x95, 0xDD, 0x52, 0xB3, 0xA5, 0x65, 0xA4,
-    0xBE, 0x6D, 0xC6, 0xBC, 0x65, 0xBF, 0xA1, 0x50, 0x9B, 0x6D, 0x76, 0xE4, 0xD6, 0xBA, 0xB5, 0x21,
-    0x09, 0xF4, 0xDB, 0xD0, 0xA5, 0xA4, 0x8D, 0x54, 0x1D, 0xA8, 0xF4, 0xE6, 0x01, 0xE6, 0xC1, 0xDF,
-    0x90, 0xA0, 0xAB, 0x75, 0xCB, 0x64, 0x73, 0x8B, 0xC1, 0x7E, 0x83, 0xA5, 0xBA, 0xA1, 0xF5, 0x32,
-    0x22, 0xF0, 0xC8, 0x6E, 0x54, 0xDB, 0xFA, 0xEB, 0x65, 0x5E, 0x56, 0xD6, 0xFA, 0x45, 0x20, 0xF0,
-    0x4F, 0x8C, 0x54, 0xBB, 0xFB, 0xB0, 0x23, 0xC8, 0xE7, 0x92, 0xC8, 0x9C, 0x62, 0x04, 0xC3, 0x3F,
-    0x57, 0x11, 0x5C, 0x39, 0xD3, 0x97, 0x39, 0xD9, 0x41, 0x26, 0x1C, 0x3F, 0x91, 0xED, 0x3B, 0x92,
-    0x66, 0xE6, 0x58, 0x72, 0xA6, 0x04, 0x33, 0x7A, 0x44, 0x7F, 0xE3, 0xBC, 0xFA, 0xA4, 0xB3, 0xF0,
-    0xCB, 0x69, 0x9D, 0x2A, 0xDE, 0x33, 0xB1, 0x7D, 0xE2, 0xA6, 0xCF, 0x82, 0xF4, 0x35, 0xF3, 0x36,
-    0xA7, 0x75, 0xC9, 0x8A, 0x98, 0x0F, 0x9F, 0xC5, 0x67, 0xDF, 0x2B, 0x5C, 0x49, 0xAF, 0xB0, 0xC0,
-    0x6E, 0x5A, 0x2C, 0x14, 0x45, 0x2F, 0x6D, 0xB1, 0xBB, 0x5B, 0xAE, 0x77, 0x7D, 0xBC, 0x1A, 0xFB,
-    0xD7, 0xFE, 0x64, 0x4B, 0xBF, 0x7C, 0xCE, 0x5C, 0x36, 0x1D, 0x42, 0x3B, 0x2A, 0xF5, 0x16, 0x23,
-    0xA4, 0x64, 0x56, 0x4C, 0x3E, 0x8D, 0x4A, 0x29, 0x5F, 0xBB, 0x7D, 0xE9, 0x38, 0x81, 0x01, 0x82,
-    0xC8, 0x0D, 0x77, 0xC6, 0xFA, 0xBB, 0xA0, 0x5D, 0x20, 0x3A, 0xDB, 0x03, 0xB7, 0x8D, 0x1F, 0x4D,
-    0x5E, 0x61, 0x80, 0xFC, 0x4C, 0x7E, 0x1F, 0x0B, 0xB6, 0xFE, 0x60, 0x59, 0xA2, 0x8D, 0xBB, 0xB9,
-    0xD3, 0xA2, 0x66, 0x63, 0x98, 0x6C, 0xE0, 0xEB, 0x6C, 0x93, 0x7F, 0x25, 0x15, 0x1C, 0x23, 0xCB,
-    0x0A, 0xD1, 0x0B, 0x57, 0x69, 0xC4, 0x9A, 0x4B, 0xF1, 0xF2, 0x18, 0x92, 0xEC, 0xD3, 0x36, 0x1B,
-    0x9B, 0x13, 0x53, 0x4B, 0xFB, 0x7D, 0xAC, 0x07, 0x93, 0x72, 0xD9, 0x52, 0x71, 0x3A, 0xB4, 0xBF,
-    0x4B, 0x16, 0x49, 0xB9, 0x88, 0x32, 0x90, 0x1E, 0x44, 0xEB, 0x0F, 0x3E, 0x61, 0xD9, 0xE0, 0xEE,
-    0xB9, 0x6C, 0xD0, 0xC7, 0x7D, 0xF0, 0x06, 0xDB, 0x7A, 0x7A, 0xC7, 0x68, 0x6C, 0x97, 0x5E, 0xE6,
-    0x90, 0xE8, 0xFC, 0x67, 0xD0, 0x33, 0xFD, 0xBA, 0xF4, 0x4C, 0x33, 0xA1, 0x29, 0xB4, 0x57, 0xDC,
-    0xA0, 0xF5, 0x8B, 0xC3, 0xBE, 0xA2, 0xC4, 0x94, 0x4E, 0x50, 0xA9, 0x8F, 0xDE, 0xD5, 0xF0, 0x97,
-    0x0C, 0x8E, 0x2A, 0xD7, 0xD5, 0x40, 0x5A, 0xFA, 0xB0, 0x23, 0x86, 0x9C, 0x2C, 0x15, 0xC3, 0x73,
-    0xBD, 0x7B, 0xEA, 0xC1, 0xE5, 0x6E, 0x76, 0x6D, 0x9E, 0xC7, 0x98, 0x72, 0xD0, 0x8B, 0xCC, 0x72,
-    0x96, 0xBC, 0xC2, 0x22, 0x92, 0x88, 0xC0, 0x51, 0x9D, 0x3B, 0xC7, 0x2D, 0x1D, 0x3F, 0x22, 0x83,
-    0x7B, 0xF6, 0x7E, 0x38, 0x9D, 0x69, 0x57, 0x52, 0x78, 0x2E, 0x45, 0xCF, 0x76, 0x4E, 0xD6, 0xF7,
-    0xFC, 0x17, 0xF8, 0xD7, 0x6F, 0x70, 0xD2, 0xFE, 0x39, 0x01, 0x44, 0x21, 0x1F, 0xB2, 0x3D, 0x40,
-    0x0C, 0xDD, 0x17, 0xB3, 0xD8, 0x9F, 0x11, 0x98, 0xF6, 0x29, 0x26, 0x25, 0xE6, 0x06, 0x4C, 0xFD,
-    0x5F, 0x75, 0x15, 0xBF, 0x78, 0x1A, 0x9E, 0x7D, 0xA7, 0xB3, 0x33, 0xE2, 0x9E, 0xD2, 0x2F, 0xB1,
-    0x62, 0x7A, 0xFA, 0xD7, 0x05, 0x7B, 0x3A, 0x6D, 0xC1, 0x8C, 0x0F, 0xF0, 0x16, 0x8A, 0x3D, 0xCE,
-    0xCC, 0xC1, 0x62, 0xE7, 0xB8, 0xBF, 0x51, 0x55, 0x98, 0x95, 0xDD, 0x33, 0xB8, 0x0B, 0x72, 0x15,
-    0x18, 0x57, 0xEF, 0x60, 0xDF, 0x2A, 0x37, 0x49, 0xF0, 0x78, 0x88, 0x79, 0x41, 0x65, 0x1B, 0xF9,
-    0x81, 0xD5, 0x4D, 0x76, 0x3D, 0xDA, 0xCB, 0x55, 0xB6, 0x86, 0xBF, 0xC9, 0xE5, 0x7A, 0x6F, 0xBD,
-    0xAE, 0xB0, 0x49, 0x25, 0xC9, 0x9B, 0xF5, 0xAB, 0x99, 0x37, 0x92, 0x81, 0xA5, 0x46, 0xA5, 0x3B,
-    0xDC, 0xFF, 0x74, 0x7F, 0x1B, 0xC0, 0x79, 0x80, 0x0D, 0xC3, 0x3D, 0x57, 0x88, 0x27, 0xE0, 0x4D,
-    0xC8, 0x89, 0xC0, 0x90, 0x7A, 0xD9, 0x47, 0xFA, 0x41, 0xF5, 0xBA, 0xDB, 0xD6, 0x25, 0x92, 0x6F,
-    0x94, 0xED, 0xC1, 0x8D, 0xA6, 0xCD, 0x31, 0xB9, 0x17, 0xD2, 0x79, 0xB7, 0xE1, 0xE6, 0x02, 0xF6,
-    0xBE, 0x25, 0x58, 0x2B, 0x98, 0xD8, 0xC4, 0x62, 0xE5, 0x8B, 0x66, 0x3E, 0x2C, 0xC3, 0x6E, 0x6E,
-    0xEF, 0x6C, 0x8E, 0xCE, 0xA2, 0x97, 0xFC, 0x95, 0x5E, 0xF7, 0x29, 0x95, 0x37, 0x50, 0x02, 0xB0,
-    0x00, 0x78, 0xEF, 0x44, 0xF4, 0xB4, 0xB4, 0xA4, 0x4E, 0x98, 0xEC, 0x61, 0xD7, 0xDD, 0xA8, 0x42,
-    0xA9, 0x37, 0x43, 0x95, 0x5F, 0xE1, 0x61, 0x00, 0xFA, 0xFE, 0xC7, 0xDA, 0xE4, 0xCA, 0x76, 0x1F,
-    0xBF, 0xDA, 0x8E, 0x49, 0x73, 0x26, 0x2F, 0x31, 0x2B, 0x7C, 0xA0, 0xB4, 0xC5, 0xD9, 0x87, 0x20,
-    0xAC, 0x2D, 0xDE, 0xCC, 0x8A, 0x5F, 0xCA, 0xA6, 0x96, 0x17, 0x7C, 0xEA, 0x33, 0x48, 0xDD, 0x0C,
-    0xA6, 0x79, 0x06, 0xBE, 0x7C, 0x98, 0x15, 0x4E, 0xE7, 0x9D, 0xD3, 0xC5, 0x46, 0x88, 0x6F, 0xEC,
-    0x57, 0x33, 0x3E, 0xE6, 0x14, 0x63, 0x39, 0xC1, 0x62, 0x9E, 0xE2, 0x30, 0x67, 0x30, 0x32, 0x6B,
-    0xA0, 0xD2, 0x38, 0x70, 0xC7, 0xCD, 0x3F, 0xDA, 0x62, 0x69, 0xF7, 0xF5, 0x61, 0x55, 0xBB, 0x6C,
-    0x8C, 0xA5, 0xEB, 0x69, 0xE5, 0x50, 0x73, 0x4E, 0x19, 0x97, 0xFD, 0x52, 0x1B, 0xD9, 0xFE, 0x1F,
-    0x1B, 0xA2, 0x3D, 0xC8, 0xE7, 0x2D, 0xB2, 0x8F, 0x64, 0x70, 0x65, 0xF7, 0x5B, 0x64, 0x1F, 0xF5,
-    0x9C, 0x7D, 0xCC, 0xDE, 0x37, 0xFB, 0xE8, 0xD0, 0x1C, 0x9A, 0x5B, 0xCE, 0xD9, 0xC7, 0x66, 0x39,
-    0xFB, 0x58, 0xBB, 0xEC, 0x63, 0x13, 0xD7, 0xE2, 0x19, 0xF6, 0xB3, 0x8F, 0x81, 0xCD, 0x3E, 0xB6,
-    0x1F, 0xB8, 0xC9, 0x75, 0xFF, 0x8F, 0x14, 0xD6, 0x5A, 0xE9, 0x37, 0xD1, 0xEA, 0x19, 0xB1, 0xED,
-    0xDC, 0x1E, 0x0F, 0x63, 0x9D, 0xEB, 0xFA, 0x92, 0x5B, 0xF8, 0x4C, 0xFB, 0x80, 0x3F, 0xCA, 0xBE,
-    0xCE, 0x74, 0x91, 0xCD, 0x61, 0xF6, 0xDA, 0xA6, 0xAF, 0x6D, 0xFE, 0x9A, 0x09, 0x6C, 0x49, 0x46,
-    0x49, 0xA8, 0x55, 0x49, 0x57, 0x89, 0x5C, 0x4B, 0xEE, 0xA5, 0xB6, 0xFB, 0xEB, 0x3C, 0xB3, 0x2E,
-    0xE5, 0xEA, 0x2E, 0x90, 0x8E, 0x25, 0x49, 0x95, 0x59, 0x8F, 0x22, 0x2A, 0xE4, 0xB3, 0x2B, 0xDF,
-    0xC1, 0x9F, 0x3D, 0xBC, 0xC6, 0x96, 0x08, 0x6D, 0xA2, 0x8E, 0xF9, 0x2B, 0xDD, 0x9E, 0xEA, 0x53,
-    0x10, 0xD8, 0xA4, 0x50, 0x39, 0x3C, 0x40, 0x7A, 0xA5, 0x56, 0xF1, 0x5B, 0xDC, 0x2A, 0x38, 0xD9,
-    0x8C, 0x59, 0xF9, 0x17, 0xB6, 0x33, 0x32, 0x96, 0x78, 0xD8, 0x63, 0xF3, 0x7C, 0x0E, 0x56, 0x4C,
-    0x7E, 0x28, 0x9B, 0xB6, 0x7B, 0x71, 0x18, 0xE1, 0xD9, 0x51, 0xBE, 0x22, 0x86, 0x71, 0xE8, 0x75,
-    0xF5, 0x79, 0xEE, 0x2B, 0x35, 0x76, 0x5F, 0x69, 0xE1, 0xED, 0xEF, 0x7E, 0xB2, 0x8C, 0xC2, 0xA5,
-    0x83, 0x97, 0xAE, 0xAA, 0xF9, 0xF8, 0x1D, 0xC7, 0x5F, 0x60, 0xC7, 0x71, 0xCF, 0x0E, 0x9D, 0xAB,
-    0xCC, 0x0E, 0xB2, 0xB4, 0x37, 0xCC, 0xD5, 0x43, 0xAE, 0xA6, 0xD7, 0xCD, 0x21, 0xD6, 0x8F, 0x0E,
-    0xA6, 0x02, 0x3E, 0x97, 0x44, 0x51, 0xDC, 0x0A, 0x70, 0xE0, 0xCE, 0xC0, 0x0E, 0x17, 0xEB, 0x5B,
-    0x2D, 0xB1, 0x5E, 0x30, 0xB6, 0x6E, 0x31, 0x17, 0xE3, 0xF5, 0x6C, 0xB8, 0x6F, 0x35, 0x45, 0x59,
-    0x48, 0x4C, 0xAF, 0x42, 0x9B, 0xBB, 0x53, 0xBD, 0x54, 0xD2, 0xEC, 0x5E, 0x08, 0x04, 0x3F, 0x94,
-    0x36, 0x0F, 0x66, 0xC2, 0x2F, 0x37, 0xC8, 0x99, 0x65, 0x83, 0x44, 0xED, 0xBC, 0xD8, 0x62, 0xDF,
-    0x84, 0xEB, 0x2D, 0x69, 0xA5, 0x7C, 0x10, 0x9E, 0x83, 0x21, 0x08, 0x11, 0x1A, 0x0E, 0xAA, 0xCA,
-    0xEF, 0x42, 0x06, 0xAD, 0x5F, 0xCE, 0xA0, 0x6D, 0x2D, 0xEF, 0xA5, 0xB2, 0xF4, 0xDC, 0x85, 0x76,
-    0xB7, 0xA8, 0x4F, 0x90, 0x41, 0x7B, 0x9B, 0x19, 0xB4, 0x71, 0xCE, 0xA0, 0x49, 0xD2, 0xCA, 0x51,
-    0x72, 0x49, 0xA7, 0x53, 0x67, 0xA4, 0xF5, 0x66, 0xE5, 0xB3, 0xD9, 0x9E, 0x17, 0x2D, 0xB6, 0xE7,
-    0x4D, 0x0B, 0x7A, 0x59, 0xCD, 0x55, 0x68, 0xEB, 0x52, 0xBE, 0xE5, 0xF0, 0xF6, 0xFD, 0xA8, 0xA6,
-    0xF9, 0xD0, 0x06, 0x5A, 0xC7, 0x7F, 0x52, 0x39, 0x0A, 0xCA, 0x9A, 0xA2, 0x4C, 0xB5, 0x77, 0x61,
-    0x4E, 0x72, 0xC3, 0x69, 0x59, 0x9F, 0xE7, 0xF6, 0xEF, 0x7F, 0xB5, 0xDB, 0xBF, 0x07, 0xBB, 0xFD,
-    0xDB, 0xFA, 0x4E, 0x9B, 0x8A, 0x72, 0xB9, 0x28, 0x2B, 0x97, 0xFD, 0xD8, 0xE4, 0x91, 0xFD, 0x33,
-    0xC0, 0x6E, 0xE6, 0x2E, 0x83, 0x33, 0xB2, 0xCB, 0x60, 0x94, 0x5D, 0x06, 0x83, 0xEC, 0x32, 0x18,
-    0x56, 0x66, 0x40, 0x71, 0xC0, 0x65, 0x7B, 0x14, 0x04, 0x5D, 0xD4, 0x57, 0xE7, 0x8A, 0xF4, 0xAD,
-    0x27, 0x33, 0xBB, 0xD7, 0x86, 0x27, 0x5B, 0xC8, 0xB1, 0x27, 0x36, 0x4E, 0xF3, 0x5C, 0x8F, 0xE1,
-    0x68, 0x9B, 0x63, 0xA5, 0xF3, 0x56, 0x62, 0xFC, 0xD2, 0x2E, 0x8D, 0x91, 0xF0, 0x4C, 0x3A, 0x94,
-    0xB8, 0x2D, 0x2C, 0x63, 0x85, 0x72, 0xDE, 0x51, 0xE8, 0x89, 0xF3, 0xFC, 0x23, 0xE9, 0x46, 0x10,
-    0xB4, 0x97, 0xAA, 0x8A, 0x4B, 0xB8, 0x65, 0x37, 0xEC, 0xD9, 0xFA, 0x3C, 0xCF, 0x80, 0xA1, 0x0E,
-    0x3D, 0x0C, 0x3C, 0x67, 0x6B, 0x57, 0xFC, 0x9B, 0xC1, 0xEE, 0x0B, 0x76, 0xAD, 0x80, 0x37, 0x71,
-    0x53, 0x97, 0xB7, 0x7E, 0x27, 0x27, 0xB3, 0x2D, 0x59, 0xEE, 0x44, 0x66, 0x20, 0x60, 0xBF, 0xBC,
-    0x59, 0xFE, 0xFB, 0x8B, 0x16, 0x6A, 0x61, 0xA7, 0xA1, 0x3D, 0x6A, 0x4B, 0xD2, 0xBA, 0xD7, 0x45,
-    0x72, 0xCF, 0xF1, 0xCD, 0x2D, 0x2D, 0x5E, 0xB0, 0xE4, 0x7B, 0xF7, 0x8E, 0xF4, 0xA2, 0xA1, 0xA4,
-    0x29, 0x84, 0x0D, 0x9D, 0xCC, 0xA5, 0x7E, 0x64, 0x5C, 0xED, 0xDB, 0x1B, 0x4F, 0x9E, 0xEA, 0x69,
-    0x3B, 0x80, 0xB0, 0x52, 0xD9, 0x4A, 0xB6, 0x6F, 0xFE, 0x8E, 0x35, 0x30, 0xF3, 0x92, 0x34, 0x17,
-    0xBA, 0x67, 0xB3, 0xEE, 0x67, 0xD8, 0x8F, 0xF8, 0x38, 0x84, 0x55, 0x9C, 0x5F, 0x0A, 0x8C, 0xB3,
-    0x23, 0x60, 0x8F, 0xA5, 0x1C, 0xBC, 0x97, 0xEC, 0x1A, 0x89, 0x34, 0xA2, 0x8E, 0x7B, 0xCB, 0xBC,
-    0x51, 0x70, 0xAB, 0x94, 0x4A, 0x11, 0xD3, 0x9F, 0x09, 0xB8, 0x44, 0x0C, 0x31, 0xC4, 0xE5, 0x3F,
-    0x6B, 0xF3, 0x9C, 0x79, 0xDC, 0x6C, 0xB3, 0xB7, 0x3E, 0xCF, 0x6E, 0x38, 0xA7, 0xA1, 0xB4, 0xDB,
-    0x4E, 0xE7, 0xBC, 0x3C, 0x4F, 0x05, 0x90, 0x73, 0xF7, 0x60, 0xAA, 0x92, 0x2A, 0xC9, 0x33, 0x32,
-    0x60, 0xFF, 0x9D, 0x41, 0xC8, 0x6F, 0xFA, 0xB8, 0xCD, 0x90, 0x0D, 0xB6, 0x86, 0x08, 0x77, 0xFA,
-    0x5D, 0xD2, 0xB3, 0x51, 0x36, 0x87, 0xB0, 0x23, 0xC6, 0xEE, 0xE3, 0xB6, 0xDA, 0x13, 0xDA, 0x14,
-    0x3F, 0xB7, 0x32, 0x50, 0xF0, 0xE0, 0x18, 0x72, 0x5E, 0x0B, 0x7B, 0x69, 0x40, 0xAD, 0x7D, 0x36,
-    0x8B, 0xF8, 0xDC, 0xC4, 0xEE, 0x95, 0xD7, 0x98, 0xA8, 0x6C, 0xB4, 0xCD, 0x20, 0x14, 0xAE, 0x34,
-    0x70, 0x82, 0x8D, 0xC7, 0x7A, 0x92, 0x86, 0x66, 0xA9, 0xD3, 0xFE, 0xCA, 0x5C, 0x1D, 0xD8, 0x34,
-    0x10, 0xB5, 0x40, 0x5D, 0x10, 0x4F, 0xFC, 0x8A, 0x59, 0x61, 0x6E, 0x42, 0xC3, 0xCA, 0x5F, 0xE7,
-    0xED, 0x5D, 0x97, 0xDB, 0x3A, 0x6E, 0xAD, 0xB9, 0x97, 0x6C, 0x7B, 0xA7, 0x4D, 0xE0, 0x8E, 0x52,
-    0x33, 0x81, 0x2B, 0x6A, 0xC3, 0xFD, 0xF2, 0x6C, 0x4B, 0xCE, 0x66, 0x54, 0x5E, 0x71, 0xBD, 0x4F,
-    0x5E, 0x47, 0x8E, 0x3F, 0x85, 0xAD, 0x3B, 0x30, 0xC2, 0x17, 0x0F, 0xBA, 0x9A, 0x7D, 0x4E, 0x47,
-    0x35, 0xDA, 0x46, 0x25, 0xAF, 0x09, 0xB3, 0xB8, 0xBA, 0x4B, 0xE9, 0x27, 0xE1, 0x0E, 0x60, 0xFD,
-    0x6B, 0xC5, 0xDC, 0x06, 0xC6, 0x10, 0x85, 0x51, 0x41, 0x8E, 0xE0, 0x13, 0x13, 0xD4, 0x88, 0x3D,
-    0x07, 0x76, 0xDD, 0x95, 0x4A, 0xEF, 0xB4, 0x3C, 0x4B, 0x8E, 0x7D, 0xDE, 0x71, 0xE3, 0x73, 0x2B,
-    0x0C, 0x86, 0xD0, 0x2B, 0x69, 0xB0, 0x6B, 0x5C, 0x04, 0xF8, 0xC3, 0xCC, 0x52, 0x04, 0x69, 0x8F,
-    0x2B, 0x7F, 0x05, 0xD7, 0xDF, 0x81, 0xC0, 0x47, 0x36, 0xED, 0x2C, 0x1E, 0x25, 0x58, 0x6C, 0x8F,
-    0xAD, 0x29, 0xFB, 0xFB, 0xE5, 0x90, 0x46, 0x5C, 0x58, 0x1B, 0x30, 0x8F, 0xD1, 0x15, 0x63, 0xB6,
-    0xBA, 0xA1, 0xB3, 0x42, 0x44, 0x9B, 0xCB, 0xA9, 0x8E, 0xB6, 0x9F, 0xC4, 0xE6, 0xF5, 0xE5, 0x39,
-    0xAB, 0xC7, 0xC9, 0xE7, 0x58, 0x3F, 0x35, 0xA7, 0x86, 0x38, 0x4B, 0xAB, 0x75, 0x9F, 0xFA, 0x8E,
-    0xEF, 0x0C, 0x3E, 0xCC, 0xB8, 0x3C, 0xD6, 0xA7, 0x55, 0x7E, 0xAC, 0x8B, 0xDB, 0xDC, 0x1F, 0xC3,
-    0xDD, 0xB2, 0x60, 0xD3, 0x38, 0x07, 0x29, 0x12, 0x78, 0xEA, 0x76, 0x25, 0x47, 0xFE, 0xA9, 0xF2,
-    0x09, 0x60, 0xDF, 0x40, 0x7E, 0x9D, 0xCD, 0xD6, 0xC9, 0xCE, 0x41, 0xD9, 0x05, 0xCB, 0xE0, 0x36,
-    0x9A, 0xD6, 0x0C, 0x0F, 0x27, 0x9A, 0xD4, 0xCF, 0x6C, 0x30, 0x69, 0x5B, 0x36, 0xE7, 0x93, 0xF9,
-    0x82, 0x91, 0xEB, 0xD6, 0x51, 0xCD, 0xB7, 0x39, 0x15, 0xBC, 0x1B, 0xF7, 0x30, 0xCB, 0xFC, 0x32,
-    0xF9, 0x47, 0xC4, 0x7D, 0xF8, 0x89, 0xAD, 0xA1, 0x42, 0x18, 0x6C, 0x05, 0x90, 0x33, 0x0F, 0xF7,
-    0x43, 0x94, 0xB0, 0xB9, 0xA8, 0x0C, 0xD4, 0xED, 0xD5, 0x41, 0x3D, 0xF3, 0xA5, 0xA5, 0xD6, 0x71,
-    0xB6, 0x64, 0x83, 0x6A, 0xC4, 0xEF, 0x94, 0x55, 0xE7, 0x0F, 0x5F, 0x24, 0xE6, 0xC2, 0x37, 0x82,
-    0x7E, 0xA6, 0xBF, 0x19, 0xC0, 0x25, 0x1E, 0x1D, 0x18, 0x59, 0x99, 0x90, 0x67, 0x22, 0x3C, 0xD9,
-    0x93, 0x91, 0xC6, 0xD3, 0x3E, 0x15, 0x78, 0xCA, 0xA5, 0xEB, 0xA6, 0xC4, 0x9D, 0xB8, 0xF6, 0x84,
-    0x45, 0x3F, 0x9E, 0x6C, 0x68, 0x83, 0xD8, 0xC3, 0xCB, 0x7A, 0x27, 0xF9, 0x9B, 0x43, 0xEB, 0x88,
-    0xB5, 0xE0, 0x4D, 0xB9, 0x55, 0x17, 0x0A, 0xDE, 0xC5, 0xD2, 0xB9, 0x4F, 0xF6, 0x51, 0xA9, 0xFB,
-    0xD8, 0xC5, 0xD2, 0xC2, 0x0E, 0x7F, 0x1E, 0x48, 0xF3, 0x00, 0x3C, 0xCA, 0x24, 0x0E, 0x26, 0x68,
-    0xF3, 0x7B, 0xC5, 0xDD, 0x5C, 0x4C, 0x2F, 0xC9, 0xAD, 0x93, 0x9F, 0xBE, 0x33, 0x38, 0x55, 0xB6,
-    0xC9, 0xCF, 0xC9, 0x7A, 0x88, 0xA8, 0xCF, 0xEF, 0x93, 0x8C, 0x2D, 0x4C, 0x49, 0xFA, 0x46, 0x87,
-    0x58, 0xF6, 0xE2, 0x22, 0xCC, 0xEA, 0x43, 0x9B, 0xA4, 0x94, 0xDE, 0xBC, 0x90, 0x48, 0xCB, 0x0D,
-    0xC5, 0xC6, 0x9D, 0x3D, 0x61, 0x32, 0x38, 0x59, 0xEE, 0x2D, 0xA5, 0xDD, 0x46, 0x73, 0x9F, 0xEE,
-    0xD2, 0xF0, 0xE3, 0x4B, 0xBC, 0xAF, 0x6F, 0xF1, 0x42, 0x5F, 0xE1, 0x0F, 0x5E, 0x73, 0xE7, 0x8D,
-    0xAD, 0x84, 0xC7, 0xF1, 0x95, 0x13, 0xAA, 0xAC, 0xD3, 0x2C, 0x07, 0x0A, 0x04, 0x6D, 0x6A, 0x22,
-    0xD0, 0x38, 0x40, 0x42, 0xA7, 0x1F, 0x6F, 0x86, 0x95, 0x55, 0x7F, 0x77, 0xD4, 0xE2, 0x7D, 0x9E,
-    0x65, 0x30, 0x64, 0x24, 0x88, 0xD3, 0xF6, 0x7C, 0xB3, 0xDF, 0x08, 0xE2, 0x9C, 0xD1, 0x8C, 0xF5,
-    0xE2, 0xED, 0x77, 0x06, 0x3F, 0x08, 0xDA, 0x33, 0xC9, 0x2B, 0x5D, 0x39, 0x46, 0x35, 0x33, 0x5E,
-    0x05, 0x6B, 0xBD, 0x10, 0x5D, 0xA1, 0x9B, 0x99, 0xBD, 0x13, 0xFD, 0x59, 0xA6, 0x12, 0xE8, 0xD7,
-    0xC7, 0xBA, 0x05, 0xEE, 0x1F, 0x3A, 0x6F, 0x4F, 0x7E, 0x94, 0x4E, 0xAA, 0x7F, 0x30, 0x72, 0x1A,
-    0x66, 0x48, 0xAA, 0xD6, 0x08, 0xA2, 0xD9, 0x1E, 0x0B, 0xF5, 0x75, 0x49, 0x2D, 0x2C, 0x9F, 0x0F,
-    0xC9, 0xF0, 0x26, 0x98, 0x7C, 0xDC, 0xF1, 0x51, 0xF6, 0xD2, 0x1B, 0x76, 0xE5, 0xB0, 0x5A, 0x46,
-    0x83, 0x48, 0x59, 0xA9, 0x39, 0xF2, 0x3E, 0x3B, 0x2C, 0xFC, 0x62, 0x59, 0x9F, 0xB4, 0xDD, 0xF3,
-    0xAB, 0x7F, 0x3C, 0xAA, 0x26, 0xB0, 0x99, 0x7B, 0x6F, 0x94, 0xBB, 0xB3, 0x8D, 0xF3, 0x56, 0x3E,
-    0xDA, 0xA8, 0xF5, 0x60, 0x88, 0xAA, 0xA4, 0xD1, 0xFF, 0x46, 0xA4, 0x6B, 0x25, 0x4A, 0x9B, 0x83,
-    0xD5, 0x90, 0x63, 0x2E, 0x65, 0xAF, 0xC1, 0x85, 0x89, 0x64, 0xA8, 0x88, 0xD9, 0x2C, 0xD0, 0x32,
-    0x30, 0x93, 0x48, 0x81, 0xCE, 0x39, 0xE9, 0x5C, 0xFE, 0x5E, 0xFA, 0x97, 0xA3, 0xD1, 0x19, 0x0A,
-    0xCC, 0xFD, 0x19, 0x46, 0x87, 0x05, 0x62, 0xDA, 0xD1, 0xA3, 0x3B, 0x36, 0x8D, 0x67, 0x37, 0xA0,
-    0xF7, 0x4B, 0x41, 0x4F, 0x68, 0x64, 0xCF, 0x03, 0xC4, 0x42, 0x68, 0xEB, 0x99, 0x95, 0x65, 0xA9,
-    0x20, 0x13, 0x32, 0xD8, 0x3B, 0xCE, 0x40, 0xB5, 0xE1, 0x36, 0x09, 0x55, 0x4A, 0xC2, 0xB0, 0x77,
-    0xEE, 0x53, 0xB2, 0x05, 0x5A, 0xFE, 0xE2, 0xC1, 0xF8, 0xB2, 0x33, 0x3C, 0xC5, 0xB5, 0x0F, 0x85,
-    0x5F, 0x73, 0x6B, 0x09, 0x66, 0xBB, 0x55, 0xB8, 0xF8, 0xA1, 0x90, 0xBC, 0xF0, 0x64, 0x73, 0x00,
-    0x9D, 0x7A, 0xDF, 0x3F, 0xB6, 0x0A, 0x4D, 0x56, 0x4D, 0x1A, 0x13, 0x4A, 0x68, 0x3E, 0xC7, 0x12,
-    0x8C, 0x2F, 0x2A, 0x5B, 0x64, 0x95, 0x76, 0x20, 0x89, 0x25, 0xEA, 0x44, 0x3A, 0x7A, 0xFC, 0x49,
-    0x32, 0x33, 0xE9, 0x15, 0x12, 0xD9, 0xB7, 0x07, 0xC6, 0x12, 0x0C, 0x58, 0xD8, 0xF0, 0x23, 0xE1,
-    0x69, 0xCC, 0xA4, 0xB2, 0x50, 0x1E, 0x9B, 0xD0, 0x91, 0xA3, 0x0B, 0x7A, 0x59, 0xE0, 0xFC, 0x75,
-    0x56, 0xAC, 0x12, 0xD3, 0xF3, 0xA8, 0x01, 0x23, 0x25, 0x80, 0x9B, 0x9E, 0xBF, 0x7E, 0xFF, 0xB6,
-    0xF7, 0x07, 0x6F, 0x91, 0x24, 0x4D, 0x67, 0x4F, 0xF9, 0x14, 0xD6, 0xC2, 0x9D, 0x50, 0x02, 0x15,
-    0x2B, 0x37, 0x4A, 0x46, 0x44, 0x22, 0x59, 0x04, 0x2D, 0x67, 0x5C, 0x48, 0xBE, 0x14, 0xAB, 0x2C,
-    0x87, 0x2E, 0x48, 0x8E, 0x8A, 0x15, 0x1E, 0xC9, 0x4D, 0xC9, 0x76, 0x38, 0x6E, 0x16, 0x67, 0x78,
-    0x15, 0x5D, 0x97, 0xF0, 0xAA, 0x94, 0x3C, 0xD5, 0x73, 0x6D, 0x29, 0xCC, 0x45, 0x22, 0x34, 0x23,
-    0x8D, 0x65, 0x7A, 0xB4, 0x27, 0x5A, 0xD4, 0x72, 0x6C, 0xC3, 0x30, 0x9F, 0x6C, 0xA2, 0xE5, 0xA0,
-    0x1F, 0x5F, 0x4E, 0xDE, 0x68, 0x4A, 0x81, 0xFB, 0x63, 0x8B, 0x63, 0x37, 0x1E, 0x89, 0x20, 0x99,
-    0xB7, 0xC8, 0x7C, 0x00, 0x90, 0xD1, 0x3D, 0xCD, 0xA7, 0x25, 0xA2, 0xDB, 0xFD, 0x75, 0xF6, 0x77,
-    0x48, 0x19, 0x5F, 0x2A, 0x45, 0xA4, 0xF6, 0x87, 0x17, 0x54, 0x87, 0x2E, 0x4F, 0x92, 0xF1, 0x72,
-    0x4E, 0x43, 0x62, 0x36, 0x0D, 0x4B, 0xAB, 0x25, 0xE1, 0x34, 0xE6, 0xE9, 0x43, 0x3E, 0x06, 0xAD,
-    0x58, 0xC7, 0x45, 0xE0, 0xD0, 0x63, 0xEA, 0x21, 0xCF, 0x59, 0xF2, 0xCC, 0x03, 0x4C, 0x3F, 0xF2,
-    0xF0, 0x25, 0xDD, 0x72, 0x89, 0x7B, 0xFC, 0x32, 0x1A, 0x63, 0x06, 0xBE, 0xBE, 0x29, 0x30, 0x26,
-    0x9E, 0x85, 0xC0, 0xAD, 0x75, 0xF6, 0x2C, 0x53, 0xC6, 0x55, 0xBB, 0xCB, 0xE9, 0xAD, 0xA0, 0x7D,
-    0x44, 0xC5, 0x6F, 0xB2, 0x49, 0x75, 0x3C, 0x48, 0xE3, 0x4E, 0xD8, 0xEC, 0x56, 0x69, 0x5A, 0x38,
-    0xC2, 0x8E, 0x5B, 0x83, 0xB9, 0xC1, 0x43, 0xF6, 0xD3, 0xD7, 0xEC, 0x49, 0x5F, 0xDE, 0x53, 0x0F,
-    0x73, 0xAF, 0xF3, 0x2A, 0xDD, 0x13, 0x65, 0xB7, 0xC4, 0xE4, 0xC8, 0xEF, 0x6B, 0xFB, 0xFC, 0xC7,
-    0x59, 0xA6, 0x61, 0x7F, 0x99, 0x58, 0xB2, 0x3A, 0xC6, 0x8E, 0x3E, 0x2E, 0x53, 0xDC, 0x97, 0xD7,
-    0x36, 0x2E, 0x8C, 0x52, 0x70, 0x7A, 0x80, 0x97, 0xAB, 0x72, 0x8E, 0x84, 0x9C, 0x31, 0x81, 0xD9,
-    0x85, 0xF3, 0x32, 0x65, 0x5C, 0xA6, 0xEE, 0x93, 0x2F, 0xD3, 0x69, 0xD7, 0xF3, 0x10, 0x0C, 0x09,
-    0x96, 0x28, 0xDD, 0xBB, 0x40, 0x3E, 0xD4, 0xEB, 0x6B, 0x9B, 0x9D, 0x6C, 0xD7, 0x2C, 0xB0, 0x4C,
-    0x98, 0xF1, 0x7B, 0x97, 0xE9, 0xFC, 0x2D, 0x9C, 0x2C, 0x47, 0xCD, 0x26, 0x35, 0xEE, 0xF5, 0x5B,
-    0xD8, 0xEC, 0x6D, 0xF6, 0x20, 0x4B, 0xB7, 0x3B, 0x63, 0xF7, 0x14, 0xBE, 0xCB, 0x05, 0x7C, 0x84,
-    0x93, 0x6E, 0xDD, 0x61, 0x25, 0x8E, 0xC7, 0x9C, 0xFC, 0x2B, 0x39, 0xEE, 0xA4, 0xB3, 0x89, 0xC5,
-    0x5B, 0xBF, 0xB3, 0xDF, 0x2F, 0x90, 0xD7, 0x7F, 0xC4, 0x79, 0xB2, 0x4B, 0x9A, 0x87, 0xD7, 0xB2,
-    0x01, 0x5C, 0xCE, 0x7A, 0xE6, 0xE9, 0x98, 0xCB, 0x47, 0x54, 0x5D, 0x8C, 0x8B, 0x10, 0x00, 0x92,
-    0x6E, 0xF7, 0xEA, 0xCE, 0xB0, 0x58, 0x9E, 0xA2, 0x16, 0xE6, 0xA6, 0xF4, 0xFF, 0x9C, 0x14, 0x8F,
-    0xA6, 0x70, 0x7D, 0xC6, 0xBE, 0x45, 0x57, 0xF5, 0xF5, 0x4D, 0xC2, 0x61, 0x06, 0xEA, 0xB6, 0xF0,
-    0x3C, 0xCD, 0xC2, 0xF3, 0x08, 0x5A, 0xE7, 0xD2, 0x62, 0xF9, 0x5E, 0xA8, 0xF6, 0x09, 0xD2, 0x1D,
-    0xF9, 0xDF, 0x10, 0xCA, 0xF6, 0x32, 0x18, 0x4D, 0xC7, 0x82, 0x8C, 0xF4, 0xFD, 0x4A, 0x03, 0x02,
-    0xC3, 0xD5, 0xBA, 0x64, 0x83, 0x16, 0x1D, 0xBC, 0xA1, 0x3E, 0xA4, 0x74, 0xE5, 0xA1, 0xF0, 0x12,
-    0xDB, 0x2F, 0xD6, 0xBA, 0xC0, 0x7D, 0x45, 0x12, 0xAE, 0x8F, 0xF5, 0x73, 0xF3, 0x88, 0x5C, 0x92,
-    0x6E, 0x29, 0x2F, 0x97, 0x58, 0xDF, 0xD6, 0x1E, 0x38, 0xF6, 0xED, 0x73, 0xDA, 0xEC, 0xFD, 0x20,
-    0xE3, 0x68, 0x10, 0x74, 0x25, 0xBB, 0xFC, 0x15, 0x77, 0xAF, 0xDE, 0x08, 0xD7, 0x25, 0x8B, 0xD5,
-    0x9A, 0xC7, 0x7A, 0x78, 0xA6, 0xB0, 0xED, 0xBA, 0x23, 0x71, 0xB5, 0x94, 0x83, 0x83, 0xA4, 0xF0,
-    0x9C, 0x41, 0x6C, 0x29, 0x77, 0xA3, 0x31, 0x65, 0xA1, 0x39, 0xA6, 0xE8, 0xDD, 0xD6, 0x55, 0xA8,
-    0x98, 0xA5, 0x70, 0x5A, 0xC0, 0xC2, 0x88, 0x47, 0x61, 0x7A, 0xAF, 0x70, 0x08, 0xE5, 0x34, 0x57,
-    0xB3, 0xE5, 0xF4, 0x99, 0x65, 0x42, 0xA6, 0xE2, 0x47, 0x3B, 0xA7, 0x8C, 0x9A, 0x25, 0xF1, 0xAF,
-    0xFA, 0xEB, 0x9F, 0xB3, 0xA0, 0x5C, 0x31, 0x98, 0x5D, 0x1E, 0xA5, 0x74, 0xA5, 0x5C, 0x61, 0x56,
-    0xFC, 0xB1, 0x91, 0xF1, 0x18, 0x3E, 0xFF, 0xA7, 0xAA, 0xFE, 0xDC, 0x0F, 0xF2, 0x55, 0x4F, 0x7D,
-    0x99, 0x3D, 0x78, 0x47, 0x09, 0x59, 0x3C, 0x30, 0xFA, 0x55, 0xDE, 0xFE, 0x31, 0xCC, 0xEF, 0x28,
-    0xFB, 0xA4, 0x8F, 0x78, 0x9F, 0xA3, 0xF4, 0xBE, 0x4F, 0x6E, 0x50, 0x8A, 0xCD, 0x92, 0xD3, 0xC4,
-    0xB2, 0xC5, 0xE8, 0xA0, 0x9A, 0xF1, 0xB8, 0xEA, 0x49, 0x9B, 0x17, 0xD8, 0xB0, 0x59, 0x24, 0x74,
-    0xE3, 0xF6, 0x58, 0x6B, 0xC3, 0x33, 0x5E, 0xF6, 0x7F, 0x28, 0x24, 0x16, 0xE2, 0xF9, 0x7B, 0xE6,
-    0xC7, 0x4C, 0xB9, 0x5A, 0x52, 0x43, 0x3D, 0xBB, 0xFD, 0x94, 0x54, 0x5C, 0x17, 0x27, 0xFC, 0x4B,
-    0xAE, 0xD9, 0xF6, 0xBB, 0x8D, 0xCA, 0x99, 0xFF, 0x9C, 0x74, 0x45, 0x28, 0xAD, 0xA1, 0xAE, 0x10,
-    0x6E, 0xFE, 0x40, 0xAB, 0x6E, 0x59, 0x76, 0xF9, 0xC7, 0xA5, 0x48, 0x0C, 0x4E, 0x9E, 0xE5, 0x67,
-    0xD7, 0x10, 0xB2, 0x47, 0x2D, 0x5B, 0xB8, 0xE0, 0xC3, 0x27, 0x6E, 0x11, 0x3A, 0x0B, 0x5F, 0x7F,
-    0x5D, 0xF6, 0x48, 0xB7, 0xEA, 0x2B, 0xFF, 0xA3, 0x77, 0xFD, 0x40, 0xE5, 0x5F, 0xDB, 0x2E, 0xCE,
-    0x58, 0x4E, 0x99, 0xCA, 0x16, 0x7C, 0xF7, 0xD3, 0x39, 0x56, 0xF7, 0xF5, 0x03, 0xBB, 0x1D, 0x82,
-    0x03, 0xA7, 0x27, 0xD8, 0x74, 0x5D, 0x58, 0xCD, 0xE7, 0x6E, 0xFD, 0x56, 0x27, 0xED, 0x7C, 0x2D,
-    0x2F, 0x8E, 0x26, 0x7B, 0xE5, 0x31, 0x16, 0x3D, 0x77, 0x5B, 0x75, 0xF8, 0x11, 0x69, 0x42, 0x88,
-    0x6A, 0xDE, 0x91, 0xB9, 0xBD, 0xA7, 0xEC, 0x39, 0xDC, 0xB6, 0x46, 0x2F, 0x06, 0x49, 0xBA, 0x2E,
-    0x03, 0x54, 0x61, 0xBB, 0xE5, 0xB2, 0x77, 0xD9, 0x7B, 0x09, 0x70, 0x2C, 0x1B, 0x10, 0x46, 0x41,
-    0x3B, 0xFE, 0x47, 0xA5, 0x49, 0x06, 0xB7, 0xD3, 0xB6, 0xB6, 0x61, 0xBC, 0xB1, 0x4D, 0xD7, 0xF6,
-    0x28, 0x33, 0x57, 0x8C, 0xB4, 0x53, 0x0D, 0x26, 0xBB, 0xB1, 0x85, 0xDE, 0x47, 0x08, 0xDF, 0x8E,
-    0x91, 0x96, 0x8E, 0x31, 0x98, 0xEC, 0x61, 0x5D, 0x72, 0x7E, 0x94, 0xF4, 0xE2, 0xDA, 0x9B, 0xE5,
-    0x97, 0x84, 0x4B, 0xFB, 0x93, 0xEC, 0xD7, 0xAA, 0x93, 0x56, 0x78, 0xDF, 0x05, 0x73, 0xD6, 0xC8,
-    0xA1, 0x56, 0xEC, 0x42, 0xE4, 0xCE, 0x41, 0x7F, 0x29, 0x7F, 0x31, 0x3B, 0x81, 0x96, 0x65, 0x54,
-    0x2A, 0x03, 0x40, 0x9C, 0x3A, 0xB4, 0xEC, 0x7E, 0xE6, 0x24, 0x0B, 0x7B, 0x71, 0xD2, 0x6D, 0xC6,
-    0x54, 0xC3, 0x6D, 0x92, 0xE0, 0x64, 0x0E, 0xD3, 0x9E, 0x15, 0x95, 0xE9, 0x9F, 0xC0, 0xC1, 0x92,
-    0x15, 0x80, 0x75, 0xEC, 0xB0, 0xD3, 0xB0, 0x49, 0x9E, 0x67, 0xD6, 0x0F, 0x94, 0x32, 0xAE, 0x63,
-    0x60, 0xEB, 0x88, 0x60, 0xEE, 0x39, 0x44, 0xE2, 0xF7, 0xB1, 0x1C, 0x58, 0xE7, 0x83, 0x27, 0x5D,
-    0x83, 0x07, 0xFE, 0x17, 0x01, 0x9F, 0xDA, 0xCE, 0x18, 0xD9, 0x60, 0x60, 0xF6, 0x9B, 0x5A, 0x78,
-    0x59, 0x91, 0x50, 0x55, 0x62, 0x2B, 0x31, 0xE4, 0xF5, 0x8F, 0xBE, 0x6F, 0xA6, 0x4B, 0xA7, 0x8B,
-    0xEA, 0x70, 0xC2, 0xA6, 0x5C, 0xFF, 0x3E, 0x56, 0x51, 0xE9, 0x04, 0x17, 0x39, 0xDA, 0x4F, 0xBF,
-    0xD5, 0xC9, 0x9E, 0xCF, 0x05, 0x05, 0x05, 0x89, 0x08, 0xF9, 0x3F, 0x46, 0xA8, 0xEC, 0xFE, 0x0B,
-    0x5B, 0x80, 0x17, 0xBB, 0xF8, 0x92, 0xEC, 0x21, 0x91, 0xFF, 0x79, 0x81, 0x4D, 0x99, 0xA8, 0x68,
-    0xF7, 0x13, 0x1E, 0x27, 0x32, 0x72, 0x17, 0x4B, 0x2B, 0x87, 0xE7, 0xAD, 0xD8, 0x2D, 0x2A, 0xE4,
-    0x03, 0x30, 0x40, 0xAF, 0xC9, 0xED, 0x51, 0x94, 0x72, 0x68, 0xC3, 0x52, 0xB5, 0xE9, 0xA3, 0x4A,
-    0x62, 0x75, 0xCD, 0x9C, 0xB4, 0xFF, 0xE3, 0x11, 0xFE, 0x7D, 0x3A, 0xF9, 0x71, 0x0F, 0x88, 0x7C,
-    0xEF, 0x2C, 0x63, 0xCE, 0x92, 0x44, 0x97, 0x7D, 0x9B, 0xB7, 0x94, 0xD7, 0xD6, 0xE5, 0x98, 0xB7,
-    0xD5, 0xFC, 0x97, 0x99, 0x9B, 0x65, 0xF7, 0x41, 0x87, 0xA6, 0xFC, 0x7F, 0xAD, 0x56, 0x3F, 0x6C,
-    0xDD, 0x44, 0x1C, 0xFE, 0xF9, 0xAE, 0xAF, 0x46, 0xB1, 0xC8, 0x75, 0x08, 0x12, 0x44, 0xA4, 0x66,
-    0x60, 0x23, 0xC2, 0x0C, 0x19, 0x3A, 0xD0, 0xDE, 0xA5, 0x19, 0x2A, 0x90, 0x40, 0x4F, 0xB4, 0x55,
-    0x11, 0x12, 0x52, 0x47, 0xD4, 0xA9, 0x43, 0x06, 0x96, 0xC6, 0x6E, 0x32, 0x76, 0xC9, 0xD6, 0xF5,
-    0x0D, 0x54, 0xD0, 0x54, 0xD0, 0x22, 0x31, 0x74, 0x20, 0xB1, 0x93, 0x0A, 0x55, 0x82, 0x01, 0x17,
-    0xD8, 0x3A, 0x60, 0x26, 0x50, 0x19, 0x72, 0xAD, 0x5C, 0xEA, 0x46, 0x77, 0x3E, 0xBE, 0xB3, 0x5F,
-    0x42, 0x55, 0x8A, 0x54, 0x0A, 0xF7, 0x6C, 0xEB, 0x3D, 0xDF, 0xFD, 0xFE, 0xDC, 0xEF, 0xF7, 0x7D,
-    0xDF, 0xBD, 0x0F, 0xD6, 0xF6, 0xC6, 0x68, 0x78, 0xEA, 0xC3, 0x58, 0x69, 0xF9, 0xCD, 0xA5, 0x09,
-    0x1A, 0xFD, 0xF3, 0xE5, 0x47, 0xA8, 0x68, 0x86, 0x68, 0xEE, 0xCC, 0x95, 0xDB, 0x6B, 0xEB, 0xA3,
-    0xF0, 0xED, 0xA0, 0x1C, 0x2D, 0x62, 0x62, 0x44, 0x4F, 0xFB, 0xE8, 0xC7, 0x0C, 0xFC, 0x04, 0x05,
-    0x2D, 0xAD, 0x5D, 0xBC, 0xF3, 0xC5, 0x0C, 0x9D, 0x5E, 0xDC, 0x4F, 0xE5, 0x69, 0xDA, 0x4F, 0xF4,
-    0xF4, 0x0F, 0x8C, 0xC8, 0x19, 0xE7, 0xBE, 0x77, 0x86, 0x1E, 0xFB, 0xE1, 0xF6, 0x86, 0xC6, 0xFD,
-    0x00, 0xF7, 0x36, 0x6E, 0xE5, 0x9E, 0x34, 0xCC, 0x93, 0xDF, 0xBE, 0x10, 0xBC, 0x67, 0x92, 0xEF,
-    0x74, 0x9E, 0x6C, 0x99, 0x3C, 0xBA, 0xF7, 0x9F, 0xBF, 0xDE, 0xFD, 0x6C, 0x3A, 0x43, 0x99, 0x3F,
-    0x1D, 0xA7, 0x92, 0xF5, 0x45, 0xE0, 0xE3, 0x9F, 0xB9, 0x73, 0x96, 0x0E, 0x84, 0x65, 0xCA, 0x75,
-    0x92, 0xD9, 0x50, 0xC7, 0x65, 0x9A, 0x0D, 0x89, 0x86, 0xDC, 0x70, 0xC3, 0x0C, 0x6F, 0xB8, 0x8E,
-    0x2A, 0x51, 0x48, 0xDA, 0x47, 0xAC, 0x94, 0x45, 0xCE, 0x4C, 0x54, 0x49, 0xD6, 0xC4, 0xC5, 0x75,
-    0xF8, 0x18, 0x90, 0x3B, 0x66, 0xE2, 0x52, 0xAA, 0x36, 0x30, 0xAC, 0xE6, 0x9A, 0x15, 0x74, 0x20,
-    0xA0, 0x73, 0x61, 0x95, 0x86, 0x5A, 0xF2, 0x3A, 0x39, 0x6F, 0x44, 0x09, 0x97, 0xE9, 0xBC, 0x85,
-    0xD7, 0x95, 0x66, 0x40, 0x27, 0xBA, 0xD0, 0xC9, 0x72, 0xC3, 0x8D, 0x2C, 0x90, 0x1C, 0x33, 0x49,
-    0x21, 0x17, 0x6A, 0x2C, 0x21, 0x2C, 0x4D, 0x8E, 0xD6, 0x41, 0xF6, 0x12, 0xE2, 0x7C, 0xE4, 0xA7,
-    0x73, 0xA1, 0xB1, 0x22, 0xAA, 0x2C, 0xD7, 0x29, 0x6B, 0xE4, 0xBC, 0x49, 0xB2, 0xEB, 0xA2, 0x4B,
-    0x7E, 0x40, 0x43, 0x51, 0xBB, 0xD0, 0xA4, 0xE7, 0x2D, 0xCC, 0x8F, 0x69, 0x51, 0xD9, 0x00, 0xB3,
-    0xC9, 0x82, 0xE6, 0x5A, 0xD2, 0x2C, 0xCF, 0x28, 0x50, 0xC4, 0x6B, 0x0A, 0xD0, 0x8F, 0x94, 0x28,
-    0x56, 0x83, 0xB0, 0x38, 0xE5, 0xDC, 0x0E, 0x76, 0x7A, 0xE9, 0xF0, 0x34, 0x09, 0xE0, 0xA8, 0x20,
-    0xA6, 0x89, 0x30, 0xBF, 0x84, 0x74, 0x14, 0x89, 0x92, 0xB8, 0xEE, 0xD6, 0x2F, 0xF9, 0x00, 0x53,
-    0xE4, 0xCD, 0x29, 0x2E, 0x3A, 0xFB, 0xA0, 0x26, 0x38, 0x18, 0xA6, 0xCE, 0x2D, 0xC3, 0xC3, 0xC4,
-    0xF1, 0x5B, 0x23, 0xB8, 0x24, 0x5A, 0xEF, 0x17, 0x09, 0x2C, 0x3A, 0x42, 0x6C, 0x55, 0xBF, 0x2F,
-    0xD0, 0x72, 0x2C, 0x2A, 0x86, 0xCD, 0x14, 0xF1, 0x0A, 0xE6, 0x48, 0xB6, 0xC5, 0xA2, 0x06, 0x19,
-    0x63, 0xFD, 0xC4, 0xAA, 0xBB, 0xED, 0x72, 0xEB, 0xEE, 0x3A, 0x35, 0xA4, 0x45, 0x12, 0x35, 0xB9,
-    0x5A, 0xB8, 0xDA, 0x77, 0xA1, 0x75, 0xAD, 0x68, 0xB1, 0x16, 0xD8, 0x22, 0x66, 0xD3, 0x5F, 0x9D,
-    0x2C, 0x87, 0x1E, 0x55, 0x55, 0x7C, 0xD3, 0x88, 0x7B, 0xD8, 0x69, 0x3E, 0x6F, 0x07, 0x3E, 0xAB,
-    0x9E, 0x04, 0x15, 0x62, 0x8B, 0x9B, 0x86, 0xF2, 0x4C, 0xFC, 0xE1, 0x48, 0x56, 0xDC, 0xA6, 0x4A,
-    0x68, 0x6A, 0x07, 0x68, 0x1B, 0x8A, 0x13, 0xE0, 0xF7, 0x03, 0xB8, 0x78, 0x84, 0x30, 0xA7, 0x5F,
-    0xBB, 0xCD, 0xFE, 0x07, 0xC2, 0x64, 0x17, 0x7F, 0x9B, 0x7C, 0x56, 0xC2, 0xAC, 0xA2, 0xCE, 0xE1,
-    0xE7, 0xC1, 0xB7, 0x73, 0x6F, 0x8C, 0x8A, 0x7F, 0x95, 0xC2, 0xEE, 0xA3, 0x1B, 0xC1, 0x8F, 0x8A,
-    0x16, 0x2B, 0x9A, 0x39, 0x74, 0xE6, 0xEA, 0xBB, 0x77, 0xAE, 0xBE, 0x53, 0xCE, 0xCC, 0x95, 0x67,
-    0xCB, 0x5B, 0x37, 0x14, 0x36, 0xFB, 0x0C, 0xD7, 0xD8, 0xE7, 0x4D, 0x15, 0xCD, 0xD0, 0xEC, 0x22,
-    0x7D, 0xB9, 0x73, 0xF9, 0xEC, 0xCE, 0x95, 0x97, 0xE7, 0xC2, 0xF0, 0xF9, 0x30, 0xB8, 0x71, 0x0C,
-    0xD5, 0x7B, 0xA6, 0xEB, 0xB1, 0x31, 0xD9, 0x37, 0xAD, 0xED, 0xB0, 0x84, 0x91, 0xB7, 0x1D, 0x6E,
-    0xD0, 0xDE, 0xFB, 0x86, 0x64, 0x07, 0xE8, 0x94, 0xD7, 0xAC, 0x13, 0x12, 0xDE, 0x88, 0xD2, 0x03,
-    0xCA, 0xC3, 0x4A, 0x2A, 0xDB, 0xAD, 0x07, 0x35, 0xA2, 0xAA, 0xCB, 0xD3, 0x80, 0x55, 0xBD, 0x33,
-    0x2D, 0x17, 0xF4, 0xC4, 0x2A, 0xED, 0x1F, 0xC5, 0x3F, 0x98, 0xE4, 0xA8, 0xD3, 0x81, 0xAB, 0xA5,
-    0xDB, 0x6C, 0xE4, 0x76, 0x95, 0x6C, 0xEB, 0xA4, 0x11, 0x5B, 0x26, 0xD9, 0x34, 0xDE, 0x11, 0x1E,
-    0xA9, 0xA8, 0xA4, 0xA2, 0xA8, 0xCC, 0x03, 0x23, 0x09, 0x2E, 0x97, 0x78, 0x13, 0xDD, 0x35, 0x80,
-    0x3B, 0xD7, 0xA2, 0x94, 0x17, 0x34, 0x50, 0x2E, 0x95, 0x54, 0x20, 0x90, 0x25, 0xD6, 0x50, 0x2B,
-    0xAA, 0x3C, 0xD2, 0xC0, 0x3E, 0x6B, 0x1D, 0xC4, 0x8C, 0x60, 0xC2, 0x5D, 0xC5, 0x9C, 0xF6, 0x98,
-    0x0E, 0x3E, 0x21, 0xBA, 0x0C, 0x8C, 0xFE, 0xB5, 0xBB, 0x50, 0x25, 0x59, 0x1B, 0xD5, 0x72, 0xD3,
-    0x22, 0x0C, 0x5D, 0x1B, 0xBF, 0x5D, 0x8C, 0x54, 0xB2, 0x52, 0x8B, 0x5F, 0x6C, 0x54, 0x3B, 0xDE,
-    0xF3, 0xB4, 0x45, 0xB0, 0xB0, 0x8A, 0x48, 0xEF, 0x99, 0x06, 0xE5, 0x24, 0x7D, 0xE5, 0xA5, 0xC4,
-    0xF2, 0x06, 0xF6, 0x70, 0xB2, 0x62, 0x84, 0xCE, 0xC3, 0x3A, 0x2E, 0xDB, 0x48, 0x4B, 0x2F, 0x1E,
-    0x92, 0xD5, 0x71, 0x36, 0x1B, 0x54, 0x62, 0xD7, 0xE6, 0x63, 0x2F, 0x50, 0xB2, 0x48, 0xC7, 0x8A,
-    0x53, 0xF4, 0x39, 0x64, 0xB3, 0xA8, 0xC8, 0xBC, 0x15, 0x5A, 0x6E, 0x99, 0xB0, 0x96, 0x48, 0x08,
-    0xBB, 0xB2, 0xB0, 0x2D, 0xDE, 0x64, 0x7B, 0x6D, 0x3E, 0x48, 0xD7, 0x42, 0x85, 0x4A, 0x27, 0x59,
-    0xBA, 0xE0, 0x65, 0x67, 0xCB, 0xC4, 0x15, 0x22, 0x09, 0xC8, 0x07, 0x62, 0xC2, 0xC1, 0x51, 0xE3,
-    0x2D, 0x0C, 0xE9, 0x48, 0x1D, 0xEA, 0x4D, 0x5E, 0xEC, 0x48, 0x1C, 0x37, 0x14, 0x6F, 0x67, 0xF1,
-    0x56, 0x23, 0x8A, 0x24, 0x83, 0x1B, 0xD8, 0x16, 0x29, 0x3E, 0x49, 0x29, 0x1A, 0x72, 0x24, 0xAA,
-    0xC0, 0x92, 0x00, 0xC1, 0x11, 0x4A, 0x2A, 0x66, 0x3D, 0xB3, 0xD3, 0x82, 0x7B, 0x7A, 0x26, 0x55,
-    0x54, 0xE3, 0xC5, 0x41, 0xEF, 0xEB, 0x15, 0xDC, 0x17, 0x80, 0xFC, 0x23, 0x50, 0x4F, 0x51, 0x34,
-    0xC9, 0xB2, 0xE6, 0x95, 0x5E, 0x87, 0x7F, 0xC8, 0xCF, 0x52, 0x58, 0x52, 0x70, 0xBF, 0xA6, 0x38,
-    0x6A, 0xC5, 0x02, 0xA6, 0x4C, 0xB2, 0x60, 0xE2, 0x62, 0xB8, 0xA3, 0x87, 0x24, 0xD1, 0x45, 0x2F,
-    0xBF, 0x5C, 0x0F, 0x0D, 0x99, 0x64, 0x45, 0x27, 0xCC, 0x88, 0x0B, 0x65, 0xAC, 0x8E, 0xCC, 0xA1,
-    0x82, 0xFD, 0xFE, 0xA7, 0xD5, 0xB4, 0x4A, 0x4A, 0xA4, 0xA3, 0x85, 0x8E, 0x9A, 0xA8, 0xE1, 0x96,
-    0x5B, 0x24, 0x06, 0x69, 0xC8, 0x64, 0x16, 0x97, 0x71, 0x19, 0xEA, 0x48, 0x33, 0x88, 0x2D, 0x6D,
-    0x40, 0x64, 0xD0, 0x6C, 0x78, 0x14, 0x05, 0x47, 0x02, 0xD4, 0xE0, 0x73, 0x98, 0xCE, 0x41, 0xDD,
-    0xF7, 0xF5, 0x3D, 0xA9, 0x59, 0x1D, 0xB8, 0xA0, 0x45, 0xF2, 0x79, 0x16, 0x17, 0x49, 0x11, 0x28,
-    0x68, 0xE9, 0xC9, 0x93, 0x27, 0x8F, 0x8F, 0x8F, 0x0B, 0x1C, 0x24, 0x97, 0x89, 0xB9, 0x9F, 0x5D,
-    0x6A, 0x1F, 0x83, 0x78, 0x4E, 0xBD, 0x20, 0x76, 0x98, 0x06, 0x90, 0x7A, 0xFD, 0xF4, 0x88, 0x03,
-    0xF8, 0xA8, 0x57, 0x56, 0xEE, 0xBB, 0x9F, 0x74, 0x71, 0x3C, 0xC6, 0x3D, 0xF8, 0xCD, 0xEE, 0xFC,
-    0x46, 0x07, 0x6C, 0x6F, 0xAF, 0x7A, 0xD1, 0x44, 0xA1, 0xB1, 0xD0, 0xF6, 0x8A, 0xF7, 0x28, 0xE8,
-    0x98, 0x53, 0x91, 0x65, 0xAE, 0x8E, 0x5C, 0xE9, 0x1C, 0x77, 0x46, 0xE6, 0x65, 0xEB, 0xDE, 0xE2,
-    0xF5, 0xAB, 0x90, 0x71, 0xEB, 0x73, 0x90, 0xDE, 0x2D, 0xDC, 0xD8, 0xBF, 0x3D, 0xFC, 0x44, 0xFC,
-    0x13, 0xA5, 0xC3, 0xD0, 0xA9, 0x18, 0x45, 0xCA, 0x78, 0x0B, 0xC5, 0xDC, 0x95, 0x56, 0x56, 0x23,
-    0x15, 0x6C, 0x3E, 0x6C, 0xB0, 0x7F, 0xD6, 0xFA, 0x04, 0x72, 0x7F, 0x96, 0x0C, 0xFA, 0xD9, 0x51,
-    0x02, 0xD7, 0x5B, 0xAE, 0x66, 0xAD, 0x70, 0x28, 0x35, 0xC2, 0xA6, 0xC5, 0xAA, 0x9C, 0x07, 0xB3,
-    0x6D, 0xE4, 0xE9, 0x24, 0x3D, 0x93, 0x3C, 0xBB, 0x7D, 0x0A, 0x0A, 0x15, 0x06, 0x10, 0x10, 0x32,
-    0x68, 0x02, 0xAB, 0xA2, 0x12, 0x11, 0x13, 0x02, 0x62, 0xBE, 0xF6, 0x12, 0xBD, 0x17, 0xEF, 0x75,
-    0x8A, 0xA1, 0xDF, 0x5E, 0xCA, 0xD1, 0x21, 0x94, 0x0E, 0xD1, 0xA6, 0xBA, 0x96, 0xFA, 0x93, 0x00,
-    0xA2, 0x21, 0x70, 0xA4, 0x50, 0xBE, 0xEC, 0xD0, 0xD2, 0xE8, 0x77, 0xD0, 0xE3, 0x39, 0x00, 0x15,
-    0x90, 0xDC, 0x44, 0x59, 0xD6, 0x51, 0xAD, 0x48, 0x77, 0x39, 0x6E, 0xE0, 0x0B, 0xA2, 0x6D, 0xA0,
-    0xB1, 0xA8, 0x95, 0x24, 0x79, 0x02, 0x7D, 0x75, 0x9A, 0x97, 0xCC, 0xF9, 0xC6, 0x0E, 0xC7, 0xBD,
-    0xC5, 0x41, 0x15, 0xEB, 0x0E, 0x99, 0x42, 0x07, 0xBE, 0x42, 0x88, 0x76, 0x60, 0x5C, 0xD4, 0x35,
-    0x15, 0x9C, 0x77, 0x36, 0x78, 0x88, 0x1E, 0xDB, 0x75, 0xE6, 0xDA, 0x49, 0x8A, 0x1E, 0x3E, 0x2A,
-    0x63, 0x33, 0x54, 0x45, 0x6A, 0xB1, 0xA3, 0x2B, 0xFE, 0x01, 0xAC, 0x18, 0x4F, 0x52, 0xCF, 0xD8,
-    0xA4, 0x74, 0x91, 0x06, 0xA3, 0x3A, 0xD2, 0xA6, 0xDC, 0xCF, 0x43, 0x09, 0x3C, 0x6F, 0x0D, 0x2B,
-    0x0E, 0x82, 0x4C, 0xBB, 0x0E, 0xFE, 0x04, 0x3D, 0x91, 0x31, 0x6F, 0xD5, 0x30, 0x14, 0x85, 0x8F,
-    0x13, 0xD1, 0x0C, 0x19, 0xCC, 0x02, 0x48, 0x74, 0xF0, 0x0E, 0x42, 0xFE, 0x07, 0xCF, 0x56, 0x3B,
-    0x30, 0x96, 0x7F, 0xD0, 0x05, 0x66, 0x16, 0x46, 0xFA, 0x1C, 0xE0, 0x0F, 0xBC, 0xA1, 0x3B, 0x8C,
-    0xA8, 0x1D, 0xBA, 0x32, 0xD0, 0xC4, 0xED, 0x13, 0x0B, 0x0B, 0x51, 0xA5, 0xCE, 0x44, 0xEA, 0x80,
-    0x44, 0x07, 0x2C, 0x64, 0x44, 0x5A, 0x39, 0xB9, 0xDC, 0x04, 0xCA, 0x95, 0x07, 0x3B, 0xF1, 0xFD,
-    0x7C, 0xEE, 0x39, 0xD8, 0xEC, 0x60, 0xC8, 0x9A, 0xAF, 0x41, 0xBF, 0x4A, 0xD2, 0x9B, 0x32, 0xC8,
-    0x75, 0x2C, 0x42, 0xCA, 0x92, 0xC1, 0x20, 0xBD, 0xCB, 0xA3, 0xB1, 0x0D, 0x55, 0x92, 0x2C, 0x9E,
-    0x81, 0xEB, 0x11, 0x60, 0x2A, 0x98, 0x16, 0x26, 0x60, 0xF1, 0x11, 0x8B, 0x05, 0x16, 0xCA, 0x9A,
-    0xD2, 0x9B, 0xC3, 0x6B, 0x45, 0x74, 0x72, 0xD0, 0xAC, 0xA0, 0x2C, 0x4A, 0x0F, 0xF1, 0x04, 0x78,
-    0x70, 0x00, 0x45, 0x5E, 0x52, 0x97, 0x77, 0x10, 0x57, 0x40, 0x13, 0x71, 0x97, 0x00, 0xD9, 0x22,
-    0x8B, 0x40, 0x82, 0x18, 0x71, 0x48, 0x30, 0x03, 0xB2, 0x7D, 0x46, 0x67, 0x1F, 0x60, 0x46, 0x41,
-    0xAB, 0x22, 0x42, 0xFA, 0x59, 0x14, 0x75, 0x7B, 0x45, 0x38, 0xCE, 0xA7, 0x55, 0x17, 0xC1, 0x1C,
-    0xB5, 0x8A, 0xAC, 0xD8, 0xC7, 0xFD, 0x83, 0x77, 0x44, 0x17, 0xD7, 0xCD, 0x6E, 0xD6, 0xBF, 0x50,
-    0x9E, 0x39, 0x0C, 0xAC, 0x51, 0x04, 0x18, 0x9B, 0xCD, 0x07, 0x03, 0x3C, 0x65, 0xE0, 0x73, 0x96,
-    0xDD, 0x0E, 0x6A, 0x1D, 0x8C, 0x3C, 0x8D, 0xFA, 0x47, 0x65, 0x62, 0x71, 0x19, 0x96, 0xE5, 0x45,
-    0x50, 0x5F, 0x7C, 0xAD, 0x2F, 0x83, 0x21, 0xDC, 0xB2, 0x80, 0x5E, 0x09, 0x4A, 0xF9, 0xAF, 0xA1,
-    0x6C, 0x97, 0x6C, 0x80, 0xF4, 0x8B, 0xB2, 0xAB, 0x73, 0x4A, 0x38, 0xEA, 0x27, 0xA6, 0x6E, 0x1F,
-    0x12, 0x5C, 0xC4, 0x9D, 0x69, 0xFA, 0xAD, 0xD1, 0x7C, 0xFE, 0x4D, 0x79, 0x4A, 0x6A, 0xDD, 0x1D,
-    0xCB, 0xED, 0xF0, 0x52, 0xBE, 0xFE, 0xB9, 0x27, 0xC7, 0x60, 0x3E, 0xD9, 0xE9, 0x41, 0xA0, 0x1C,
-    0x79, 0xE2, 0x4E, 0x9D, 0x25, 0xD9, 0xBA, 0x22, 0xC8, 0xD3, 0xBE, 0x08, 0x83, 0x60, 0x2B, 0x6B,
-    0x26, 0x6F, 0x47, 0xED, 0x47, 0xED, 0x35, 0x79, 0x41, 0x15, 0xFE, 0xD6, 0x66, 0xD7, 0x44, 0x95,
-    0x58, 0xB0, 0xF2, 0x65, 0xC7, 0xA6, 0xCC, 0xDB, 0xAA, 0xEC, 0x0C, 0xED, 0x90, 0x9F, 0x2E, 0xB8,
-    0x98, 0xD1, 0x50, 0xC4, 0xBA, 0xF0, 0x4B, 0x01, 0x36, 0xAA, 0x47, 0xC9, 0x81, 0x55, 0x62, 0x98,
-    0xB5, 0x7D, 0x7F, 0x6F, 0x28, 0x69, 0xEA, 0xF8, 0x62, 0x41, 0xD6, 0x51, 0xDE, 0x1D, 0x6F, 0x64,
-    0x81, 0x09, 0x45, 0x0F, 0x0A, 0xD9, 0x6E, 0xCB, 0x5B, 0xEE, 0x52, 0x81, 0x28, 0xA3, 0x15, 0x6E,
-    0x4A, 0x57, 0x3C, 0x16, 0x34, 0x03, 0x12, 0x94, 0x83, 0xDA, 0xA9, 0xD4, 0xE3, 0x56, 0x6D, 0x05,
-    0x49, 0xB4, 0x26, 0x9A, 0xFA, 0xA7, 0x04, 0x19, 0x04, 0x47, 0x60, 0xBD, 0xF2, 0xDC, 0xE6, 0x9C,
-    0xD9, 0x68, 0x41, 0x3D, 0xA7, 0x68, 0x27, 0x8F, 0xF3, 0x08, 0x91, 0xB0, 0x31, 0x80, 0x06, 0xE8,
-    0xFE, 0x3F, 0xBA, 0x1C, 0xD0, 0x5C, 0xE5, 0xC3, 0xA4, 0x52, 0x9D, 0x73, 0x88, 0xDE, 0xBD, 0xFD,
-    0x97, 0x20, 0x2F, 0x37, 0x0D, 0xE6, 0xD9, 0xA3, 0x49, 0x03, 0x45, 0xA2, 0x6F, 0xE7, 0x4E, 0xE5,
-    0xF1, 0xB6, 0xB6, 0xA2, 0x9F, 0x32, 0x9F, 0xDB, 0x0C, 0xF2, 0xF9, 0xB0, 0xB8, 0x41, 0x66, 0x54,
-    0xB9, 0xE6, 0x0D, 0x87, 0x78, 0xD2, 0x9B, 0x1D, 0xEF, 0x92, 0xA0, 0x56, 0xEF, 0x9E, 0x45, 0x0E,
-    0xD1, 0x99, 0xED, 0xDE, 0xF1, 0xDF, 0x38, 0xDF, 0x13, 0x2C, 0x2D, 0x64, 0x94, 0x8A, 0xAE, 0x9E,
-    0x73, 0x34, 0xB2, 0x5D, 0x96, 0xD7, 0x03, 0x7F, 0xC1, 0xBD, 0xC8, 0x64, 0xD1, 0x78, 0x37, 0xC2,
-    0x4C, 0x66, 0xE1, 0x0F, 0x5D, 0x51, 0x31, 0x4E, 0xC4, 0x30, 0x10, 0x1C, 0x27, 0x40, 0x8A, 0x2B,
-    0x4C, 0x03, 0x0D, 0x88, 0x3C, 0x21, 0x4F, 0x70, 0x44, 0x43, 0x07, 0x48, 0x7C, 0x81, 0x27, 0xD0,
-    0xA2, 0x43, 0xE2, 0x0B, 0x5C, 0x4F, 0x0B, 0x7C, 0x01, 0xC9, 0xFE, 0x01, 0xE1, 0x07, 0x29, 0xA8,
-    0xA0, 0x71, 0x11, 0x24, 0x03, 0xBE, 0x2C, 0xB3, 0xC9, 0x35, 0xB0, 0x92, 0x47, 0xEB, 0xF5, 0x68,
-    0xBC, 0x3B, 0x8B, 0x46, 0x24, 0xC3, 0x29, 0x1C, 0x28, 0x94, 0x19, 0x19, 0x55, 0x46, 0x52, 0x88,
-    0x58, 0x24, 0x00, 0x76, 0x50, 0xF8, 0x7A, 0x04, 0x6A, 0x11, 0xA0, 0x91, 0x11, 0x70, 0x3D, 0x6B,
-    0x2E, 0x00, 0x85, 0x7F, 0x07, 0x2A, 0xAD, 0x1B, 0x59, 0xB1, 0x26, 0xAD, 0x66, 0x77, 0x4A, 0xCB,
-    0x64, 0x28, 0x6C, 0x62, 0x47, 0x9F, 0x3C, 0xC1, 0xFE, 0x90, 0xED, 0x8F, 0xF9, 0x59, 0xAA, 0x7A,
-    0x34, 0xE1, 0x08, 0xA0, 0x22, 0x16, 0xC3, 0x96, 0x0A, 0x45, 0xED, 0x26, 0xA0, 0x4A, 0x93, 0xF6,
-    0x3D, 0x75, 0x78, 0x7B, 0x1A, 0x1F, 0xF8, 0x7B, 0x47, 0x96, 0xE7, 0xB9, 0x48, 0xD8, 0x2F, 0x85,
-    0xED, 0xB2, 0x1F, 0x89, 0xCB, 0x57, 0x2F, 0xB8, 0xC4, 0x9F, 0x30, 0x5E, 0x6E, 0xE6, 0x84, 0x8C,
-    0x39, 0xA3, 0xEA, 0x7A, 0x2E, 0x9D, 0x45, 0x17, 0x67, 0x9A, 0x18, 0x99, 0x93, 0x3A, 0xDA, 0x68,
-    0x39, 0x0D, 0x8A, 0x11, 0x52, 0xA6, 0x89, 0xDF, 0xD5, 0xD1, 0xB5, 0xD8, 0xA3, 0x25, 0xE5, 0xBA,
-    0x96, 0xAE, 0xA1, 0x4D, 0x41, 0x5E, 0x24, 0x5B, 0x09, 0xD5, 0x28, 0xB1, 0xFE, 0x2C, 0x86, 0x43,
-    0xCE, 0x33, 0xB0, 0xF9, 0x26, 0xC0, 0xCA, 0x1B, 0x1B, 0x54, 0x3D, 0xB5, 0x22, 0xC3, 0xAE, 0x29,
-    0x0A, 0x7D, 0x69, 0xA2, 0xE1, 0x78, 0x34, 0x16, 0xFE, 0xA6, 0xE1, 0x08, 0xEE, 0xF6, 0x94, 0x83,
-    0x8F, 0x2D, 0x4A, 0xF9, 0x4E, 0xEE, 0x44, 0xAD, 0x73, 0x52, 0x4B, 0xEF, 0xA5, 0x47, 0x21, 0xED,
-    0x72, 0xC0, 0xFF, 0x30, 0x3E, 0x6D, 0xBC, 0xF7, 0xF4, 0xBE, 0x94, 0xF6, 0x5A, 0x17, 0xF3, 0x8C,
-    0xBA, 0xC7, 0xD5, 0x66, 0x09, 0x1F, 0x19, 0x0B, 0xDD, 0xDF, 0xB6, 0xAC, 0xCE, 0xA7, 0x16, 0xD4,
-    0xB7, 0xC9, 0xCA, 0x6E, 0xBE, 0x4E, 0x8B, 0x81, 0x0F, 0xD8, 0xC5, 0x72, 0x30, 0x71, 0x7E, 0xB6,
-    0xEA, 0xAD, 0x99, 0x7C, 0x31, 0xC0, 0x2F, 0x85, 0x53, 0xBF, 0x6F, 0xD3, 0x40, 0x14, 0x7E, 0xB5,
-    0x23, 0xB9, 0x92, 0x91, 0xDC, 0x05, 0x09, 0x75, 0x71, 0x66, 0x84, 0x74, 0x19, 0x18, 0x4B, 0xCF,
-    0x1B, 0x03, 0x03, 0x5D, 0xBC, 0xC0, 0x90, 0xBD, 0x0B, 0xFC, 0x03, 0x25, 0x66, 0xEA, 0x90, 0x01,
-    0x16, 0x76, 0x06, 0x18, 0xE2, 0x89, 0x31, 0x43, 0x92, 0xB3, 0x9A, 0xB1, 0x43, 0xA3, 0xA2, 0xCE,
-    0xB1, 0x92, 0x81, 0x31, 0x56, 0x63, 0xD4, 0x93, 0xE2, 0xF8, 0xF8, 0x9E, 0x93, 0x94, 0x44, 0xE2,
-    0xC7, 0x49, 0xEF, 0xD3, 0xFD, 0x7C, 0xEF, 0x7B, 0xDF, 0x7B, 0x47, 0xC4, 0xE3, 0x1B, 0xCC, 0xCD,
-    0x00, 0x2A, 0xD8, 0x4C, 0xE2, 0x38, 0x3E, 0x37, 0x18, 0x2F, 0x61, 0x4B, 0xFF, 0xE6, 0x34, 0xFE,
-    0x2C, 0x12, 0xEC, 0x8B, 0x11, 0x03, 0xCF, 0x9E, 0xD0, 0xD6, 0xF0, 0x12, 0xF2, 0x0A, 0xF2, 0x4C,
-    0xE2, 0x99, 0xC2, 0x1B, 0xCF, 0x2E, 0xA7, 0x73, 0x9D, 0x15, 0x47, 0x24, 0xAB, 0x13, 0x1B, 0x0E,
-    0x0B, 0xFA, 0xDB, 0xE2, 0x7E, 0x38, 0x11, 0x40, 0x32, 0xB4, 0x56, 0x33, 0x50, 0x50, 0x15, 0x07,
-    0x1F, 0x56, 0x3C, 0x8E, 0xBF, 0x36, 0x39, 0xF8, 0x12, 0xE6, 0xA7, 0x80, 0x92, 0x1F, 0xA5, 0x3B,
-    0x1C, 0xFE, 0x1D, 0xA9, 0x38, 0x38, 0x92, 0x9E, 0xB8, 0xBA, 0x9A, 0x2E, 0x16, 0x99, 0x34, 0x99,
-    0x6D, 0x32, 0x92, 0x29, 0x59, 0x5B, 0x2E, 0x46, 0x7B, 0xC8, 0x63, 0xE4, 0x27, 0x64, 0x48, 0x26,
-    0x5E, 0x4A, 0x22, 0x82, 0x0E, 0xAA, 0xCD, 0x1C, 0x9A, 0xAC, 0x83, 0xB8, 0x09, 0x9B, 0xA9, 0x88,
-    0x68, 0x80, 0x63, 0x70, 0x90, 0xEC, 0xBC, 0x41, 0xF5, 0xF5, 0xEB, 0xDA, 0x46, 0x07, 0xDF, 0x24,
-    0x3E, 0x44, 0x1B, 0x8F, 0x87, 0xD3, 0xDB, 0xB4, 0x5E, 0xD4, 0x77, 0x08, 0xED, 0xCB, 0x7D, 0xEF,
-    0xC3, 0xE5, 0xF0, 0xEE, 0xEE, 0x9E, 0x43, 0x56, 0x9D, 0x1C, 0x40, 0x79, 0xE4, 0xAD, 0x22, 0x72,
-    0x4D, 0x44, 0x06, 0x52, 0xCE, 0x66, 0x89, 0x94, 0x92, 0x1A, 0x45, 0xA3, 0xBA, 0x00, 0x0F, 0xEC,
-    0xE8, 0x6D, 0xF1, 0xD4, 0x99, 0xCF, 0x33, 0xD7, 0x98, 0xC8, 0x35, 0xBA, 0xBA, 0xEC, 0xE4, 0xF4,
-    0xF0, 0xF5, 0xA7, 0x13, 0x30, 0x1C, 0xC2, 0x3C, 0x88, 0x85, 0x1A, 0xC1, 0x0F, 0x92, 0xD3, 0x04,
-    0xB2, 0xBF, 0x17, 0x1F, 0x07, 0xD4, 0x47, 0x52, 0x2F, 0x52, 0x65, 0xE5, 0x8A, 0xFA, 0x2D, 0x63,
-    0xDE, 0x18, 0xF3, 0xDD, 0x98, 0x5C, 0x06, 0xE4, 0xE8, 0x4A, 0x79, 0x07, 0x61, 0x82, 0x9D, 0x47,
-    0xDB, 0x8B, 0x47, 0x34, 0xF0, 0x23, 0x71, 0xAE, 0xDD, 0x54, 0xBE, 0xD7, 0xB6, 0x6E, 0x55, 0xC2,
-    0xFC, 0x30, 0x48, 0xC3, 0xC9, 0xB8, 0x73, 0xDC, 0x9C, 0x28, 0xAF, 0xA4, 0x20, 0x3A, 0xE4, 0xA2,
-    0xA0, 0x64, 0x76, 0x4E, 0x19, 0xCA, 0xA6, 0x48, 0x06, 0x2A, 0xF0, 0x46, 0x03, 0x6C, 0xA8, 0x30,
-    0x5C, 0xB6, 0xD6, 0xAA, 0x5E, 0x2C, 0xC3, 0xF0, 0x04, 0xFE, 0xC9, 0x2A, 0xB8, 0xEC, 0x08, 0x6F,
-    0x27, 0x6B, 0x45, 0x2D, 0x06, 0xE4, 0x4C, 0xB6, 0x5E, 0xF7, 0x86, 0xB5, 0x0C, 0xE3, 0x2F, 0x02,
-    0xAF, 0xAE, 0xAB, 0xA2, 0x70, 0xA3, 0xBC, 0xE3, 0x4B, 0x0A, 0xAB, 0x11, 0x43, 0xA0, 0xC2, 0x57,
-    0x1D, 0x66, 0x4C, 0x2B, 0xE0, 0x87, 0xC4, 0xD7, 0xB8, 0xCE, 0x16, 0x7A, 0xC6, 0x32, 0x9C, 0x07,
-    0x48, 0x94, 0x02, 0xF2, 0xB7, 0x8D, 0xBD, 0x98, 0x2C, 0xB2, 0xAE, 0xEE, 0x75, 0x6B, 0xC7, 0xA2,
-    0x46, 0x5E, 0x1B, 0x75, 0x9A, 0x40, 0x6D, 0xDD, 0x23, 0x3A, 0x16, 0xF4, 0x87, 0x8D, 0xE7, 0xC9,
-    0x36, 0x33, 0xA4, 0x55, 0xC1, 0x69, 0x27, 0x2C, 0xF7, 0x10, 0xBF, 0x74, 0x18, 0x78, 0xAF, 0xCF,
-    0xD7, 0x7E, 0x32, 0x4D, 0x6E, 0x62, 0x7D, 0xD8, 0x09, 0xB9, 0xAF, 0x59, 0x4F, 0x56, 0x93, 0xA8,
-    0xB7, 0x66, 0xF6, 0xCC, 0xA7, 0xFF, 0x87, 0xB5, 0xBC, 0xF6, 0x85, 0x3D, 0x9D, 0xDC, 0x66, 0xA5,
-    0x1E, 0x14, 0x6E, 0x29, 0x34, 0xA9, 0x36, 0x8A, 0x3F, 0x81, 0x37, 0x05, 0x73, 0xD9, 0x6B, 0x77,
-    0xD3, 0xC6, 0x0D, 0x1B, 0x8A, 0x65, 0x60, 0x07, 0xC1, 0x59, 0x3A, 0x28, 0x0F, 0x06, 0x16, 0x13,
-    0x13, 0xF8, 0xE0, 0x67, 0x67, 0xA0, 0x91, 0xB3, 0x58, 0x11, 0x40, 0xE3, 0x23, 0x81, 0x4F, 0xC9,
-    0xEA, 0x17, 0xDC, 0x63, 0xC9, 0x83, 0x95, 0x97, 0x5F, 0xB5, 0x58, 0x3F, 0x8C, 0xD6, 0xE6, 0x19,
-    0x7F, 0x6C, 0x73, 0x58, 0xC2, 0x52, 0xCD, 0x90, 0xEB, 0x40, 0x2A, 0xB9, 0x63, 0x55, 0xA9, 0x78,
-    0xED, 0x92, 0xD8, 0x27, 0x06, 0x86, 0x0C, 0x41, 0xD5, 0x7D, 0x4B, 0x33, 0xB0, 0x74, 0x62, 0x61,
-    0xED, 0x12, 0xD9, 0x09, 0x43, 0x47, 0x18, 0xC8, 0xD4, 0x21, 0x19, 0x32, 0x04, 0x67, 0xF8, 0x3A,
-    0x32, 0x70, 0xF7, 0xBA, 0x77, 0x43, 0x07, 0x06, 0x9C, 0xA0, 0x8A, 0x81, 0xA1, 0x6E, 0x9B, 0x0A,
-    0x09, 0xA4, 0xD4, 0x44, 0x4E, 0x6B, 0x3E, 0x6C, 0xBF, 0xFD, 0xFD, 0x1E, 0x7F, 0xFE, 0xEE, 0x08,
-    0x21, 0x81, 0xB4, 0x35, 0x67, 0x73, 0xEF, 0xBF, 0xE7, 0xF7, 0xFC, 0x7F, 0x9E, 0xF7, 0x44, 0xF0,
-    0x84, 0xBD, 0x48, 0x72, 0x68, 0xF1, 0x4B, 0x9D, 0xD5, 0x12, 0xB4, 0x18, 0x7B, 0xBD, 0x8B, 0xF1,
-    0x20, 0xD9, 0xC3, 0xC2, 0x48, 0x68, 0xAD, 0xCD, 0x5D, 0x7C, 0x4A, 0x49, 0xBE, 0xBE, 0x58, 0x63,
-    0xBF, 0xD7, 0x8A, 0x63, 0x1D, 0x1E, 0xAB, 0x07, 0x91, 0xA0, 0x4F, 0x04, 0xE3, 0x38, 0xC7, 0xF8,
-    0x9F, 0x25, 0xC6, 0xB6, 0xE1, 0xB8, 0x05, 0xE9, 0x04, 0x7B, 0x24, 0x18, 0x89, 0xA2, 0x9F, 0xD7,
-    0xF8, 0x39, 0xF9, 0xB1, 0x48, 0x66, 0x73, 0xC7, 0xDA, 0xDA, 0xAD, 0x63, 0xEC, 0x0D, 0x3B, 0x11,
-    0x1F, 0x3B, 0xBD, 0xE9, 0x0D, 0x9E, 0xF6, 0x58, 0x07, 0x07, 0xCB, 0xDE, 0xEF, 0xBC, 0x3E, 0x6C,
-    0xBC, 0x3E, 0xAA, 0xBC, 0x2E, 0x29, 0xFD, 0x36, 0x29, 0x83, 0x26, 0x29, 0x43, 0xBC, 0x51, 0x95,
-    0x94, 0xFC, 0x67, 0xD2, 0xE4, 0xE9, 0x08, 0x16, 0x5B, 0xF1, 0x2C, 0x18, 0x38, 0x2D, 0xFA, 0x80,
-    0xD9, 0x43, 0xBC, 0x6F, 0x5B, 0x0B, 0xFE, 0x42, 0x70, 0x92, 0x54, 0x98, 0x4C, 0xC5, 0xD3, 0x61,
-    0x51, 0x98, 0xBB, 0xEB, 0xD5, 0xED, 0xC5, 0xC5, 0x6F, 0xAE, 0x5E, 0x90, 0xE4, 0x1E, 0x56, 0x2F,
-    0x62, 0x35, 0xB3, 0x14, 0x65, 0x7A, 0x2E, 0x5D, 0xF3, 0x72, 0xB0, 0xD5, 0x25, 0x90, 0x8F, 0xD3,
-    0x66, 0xB5, 0xB4, 0x12, 0x0C, 0x90, 0x9E, 0xC7, 0x93, 0xCE, 0x1D, 0xC5, 0xB5, 0x4D, 0xD8, 0x48,
-    0x9C, 0x55, 0x59, 0xE9, 0xB6, 0xE6, 0xBD, 0x51, 0xE2, 0x9D, 0x31, 0x68, 0xDD, 0xD6, 0xEF, 0xE2,
-    0x2A, 0xCE, 0xA3, 0xDA, 0xEC, 0x74, 0x62, 0x76, 0xC6, 0x28, 0xF7, 0x7A, 0x7F, 0xE8, 0x24, 0x6C,
-    0x42, 0xB0, 0x6C, 0xF2, 0xB8, 0xA3, 0xF4, 0x09, 0x48, 0x56, 0x62, 0x47, 0x33, 0xAA, 0xC2, 0x2B,
-    0xE9, 0x63, 0xDB, 0x89, 0x5B, 0x6E, 0x7D, 0x20, 0x9B, 0xE7, 0x14, 0x3F, 0x26, 0xA7, 0x76, 0xA1,
-    0x67, 0x0F, 0x9B, 0xC4, 0xB7, 0xF5, 0x5A, 0xE3, 0xE1, 0x1D, 0x48, 0x12, 0x5F, 0xA5, 0x55, 0xA8,
-    0xCC, 0xCC, 0x83, 0xC6, 0x07, 0x0F, 0x66, 0xEC, 0x1D, 0x9B, 0xBA, 0x9D, 0xD8, 0x1C, 0x66, 0xB3,
-    0xA5, 0xDF, 0x48, 0x56, 0x85, 0x35, 0x4C, 0x17, 0x81, 0xED, 0x26, 0x2E, 0x25, 0x6A, 0x93, 0x87,
-    0xC5, 0xB2, 0x87, 0xB0, 0x76, 0xFA, 0x10, 0x05, 0xD6, 0xB1, 0xF6, 0x3E, 0x3F, 0x1F, 0xDA, 0x62,
-    0x39, 0x80, 0xBB, 0xB0, 0x31, 0x70, 0x80, 0x1D, 0xB8, 0x42, 0x0F, 0xAA, 0x61, 0x0D, 0xC1, 0x33,
-    0x98, 0xCE, 0x25, 0xEB, 0x61, 0x25, 0x59, 0x99, 0x41, 0x89, 0x57, 0xC0, 0xB2, 0x0D, 0x4B, 0x08,
-    0xB4, 0x0F, 0x8E, 0x9E, 0x82, 0xAD, 0x98, 0xAC, 0x26, 0x03, 0x8D, 0xA2, 0x6E, 0x91, 0x4F, 0x76,
-    0x96, 0xAD, 0x23, 0xB1, 0x0C, 0x5C, 0x8B, 0xFE, 0xD5, 0x78, 0x44, 0xF7, 0xEC, 0x75, 0x11, 0xBA,
-    0x1F, 0x4E, 0xCC, 0xF2, 0x4A, 0x52, 0xD2, 0x51, 0x57, 0x45, 0x51, 0x5C, 0x21, 0x4F, 0x0D, 0x3F,
-    0x3D, 0xD8, 0x2E, 0x8A, 0x90, 0x16, 0x72, 0xD5, 0xBB, 0x74, 0x53, 0xA0, 0xEC, 0xDB, 0x7F, 0x2C,
-    0x16, 0x69, 0x38, 0x19, 0x8A, 0x12, 0x39, 0xF8, 0xAA, 0x58, 0x17, 0xF8, 0xE9, 0xD7, 0xC4, 0x03,
-    0x2E, 0xC5, 0xD8, 0x25, 0x09, 0xDD, 0x3B, 0x79, 0x72, 0xBE, 0x95, 0xB8, 0x81, 0x44, 0x20, 0x3A,
-    0x4A, 0xD0, 0x41, 0x40, 0xF0, 0x0A, 0x15, 0x41, 0x05, 0xAB, 0x4F, 0xB8, 0xC7, 0x92, 0xA6, 0x3D,
-    0x1C, 0x8B, 0xB1, 0xF8, 0xC8, 0xA6, 0x90, 0x38, 0xAE, 0x93, 0x1C, 0x9B, 0xA0, 0x00, 0x31, 0xF7,
-    0x69, 0x05, 0x3B, 0x2C, 0x76, 0xE9, 0x7F, 0x56, 0xFD, 0xA4, 0x24, 0xE5, 0x46, 0x22, 0x65, 0xBF,
-    0x99, 0x19, 0x10, 0xD9, 0x5E, 0x2C, 0x60, 0x3A, 0xAC, 0x2B, 0x8F, 0xFC, 0xF4, 0x21, 0x65, 0xA0,
-    0xE5, 0xD4, 0x0F, 0xC1, 0x1F, 0x84, 0x7B, 0x16, 0xB3, 0x28, 0x3E, 0x52, 0x65, 0x44, 0x24, 0xE4,
-    0xD9, 0x6B, 0x14, 0x79, 0xA3, 0x36, 0x79, 0x9D, 0x98, 0xE2, 0x40, 0x6E, 0x45, 0xC0, 0xA1, 0x4E,
-    0xB8, 0x52, 0x4F, 0xDC, 0x40, 0xE3, 0x46, 0xCF, 0x1D, 0x53, 0x55, 0xA7, 0x38, 0xA7, 0x40, 0xD8,
-    0x1C, 0x1E, 0xA9, 0xF5, 0xE7, 0x18, 0xDB, 0xCD, 0xA6, 0xB8, 0x9E, 0x59, 0x0F, 0xBB, 0xAD, 0xC5,
-    0xE2, 0x72, 0x3F, 0xA1, 0x59, 0x92, 0x07, 0xFA, 0xB5, 0x59, 0xA4, 0x61, 0x73, 0x82, 0xE9, 0x82,
-    0x4B, 0x93, 0x23, 0x37, 0xE2, 0xB7, 0xEF, 0x58, 0xC6, 0x7F, 0x52, 0x43, 0x95, 0xD0, 0x27, 0xDC,
-    0x10, 0x62, 0x60, 0xB5, 0x29, 0xCC, 0xC3, 0x4F, 0xFB, 0x23, 0x11, 0x0F, 0x8A, 0xE5, 0xC3, 0x65,
-    0x83, 0x75, 0x6A, 0xC1, 0xD0, 0xA6, 0x51, 0x89, 0x93, 0xDE, 0x13, 0x9B, 0x2F, 0x16, 0xB4, 0xCF,
-    0xAC, 0xB0, 0xDC, 0x9B, 0x24, 0x12, 0xAA, 0x7D, 0x72, 0x27, 0xD9, 0x9E, 0x94, 0xAA, 0x98, 0xE9,
-    0x86, 0x47, 0xAB, 0x22, 0x4C, 0xF6, 0x4E, 0x55, 0x75, 0x10, 0xEE, 0x59, 0xCC, 0xA2, 0x58, 0x36,
-    0xB3, 0x32, 0x7C, 0x4A, 0xF1, 0xBA, 0xF5, 0x54, 0x63, 0x76, 0xED, 0x18, 0x4F, 0x64, 0x8B, 0x84,
-    0xA7, 0x47, 0x97, 0xEC, 0x1D, 0xFD, 0x9E, 0xB4, 0xC8, 0x01, 0x15, 0xCE, 0x40, 0xA7, 0x51, 0xCB,
-    0x34, 0x96, 0x21, 0xA4, 0x6A, 0x84, 0x1B, 0x82, 0xED, 0xFF, 0x33, 0x1D, 0xD9, 0x2E, 0xB0, 0x3D,
-    0xB4, 0x6A, 0xEC, 0xE3, 0xA2, 0xD8, 0x29, 0x8A, 0x5C, 0xB9, 0xA2, 0x3C, 0x3B, 0x78, 0x47, 0xDF,
-    0x16, 0xA6, 0x0B, 0x07, 0xF1, 0x1B, 0x64, 0xF1, 0x90, 0xA9, 0xE5, 0x17, 0xCC, 0x2C, 0x32, 0x7D,
-    0x32, 0xAA, 0x4B, 0x55, 0x62, 0x35, 0x89, 0xCC, 0xCA, 0x63, 0xFE, 0xD3, 0x10, 0x52, 0xCF, 0xE2,
-    0x34, 0x72, 0xE6, 0x29, 0x5A, 0xE9, 0x5D, 0x9F, 0xF6, 0x82, 0x59, 0xA3, 0xBB, 0xB3, 0xCA, 0x7A,
-    0x06, 0x4C, 0xFD, 0x63, 0xE8, 0x8D, 0x0A, 0xF5, 0xA7, 0x34, 0xF9, 0x39, 0x7C, 0x95, 0x84, 0x72,
-    0x51, 0x5F, 0xA7, 0x5D, 0x02, 0xD0, 0xF2, 0x91, 0x92, 0xBC, 0x6E, 0x1D, 0x71, 0xD4, 0xAD, 0x21,
-    0x17, 0xE9, 0x4B, 0x6E, 0x4C, 0x8E, 0x6D, 0x74, 0xD2, 0xB5, 0x7B, 0xF1, 0x34, 0x38, 0x74, 0xFB,
-    0xE9, 0x00, 0x0F, 0x47, 0xF5, 0x4B, 0x2F, 0x0D, 0x47, 0x4B, 0xE1, 0x7A, 0x09, 0x8E, 0x73, 0x2A,
-    0x15, 0x07, 0x0C, 0x44, 0xA9, 0xFB, 0x59, 0xFB, 0xDB, 0xE4, 0x2F, 0xD9, 0x01, 0x9C, 0xDB, 0x85,
-    0x7F, 0x47, 0x36, 0x8D, 0xAC, 0x3D, 0x3F, 0x3E, 0x1D, 0x92, 0xE8, 0xED, 0x72, 0xA7, 0x3D, 0x8D,
-    0x2D, 0xBA, 0xF3, 0x52, 0x8A, 0xBC, 0x0B, 0x5B, 0x24, 0xEF, 0xA3, 0xF6, 0xCD, 0x3F, 0xF7, 0xBA,
-    0xC8, 0x36, 0x3E, 0xD4, 0xBB, 0x2B, 0x8E, 0xD7, 0x9B, 0x47, 0xA3, 0x46, 0x83, 0x60, 0x08, 0xC0,
-    0x7A, 0x2D, 0x8F, 0x50, 0x40, 0x9F, 0x6A, 0x8E, 0x9F, 0x1D, 0xE5, 0xEB, 0x91, 0xD7, 0x6C, 0xED,
-    0x62, 0x94, 0x75, 0x32, 0x38, 0x08, 0xED, 0xC6, 0x35, 0x65, 0x84, 0xC2, 0x93, 0xEE, 0x21, 0x84,
-    0x3C, 0x04, 0x47, 0x8F, 0x51, 0xD0, 0x60, 0x14, 0xDE, 0xC5, 0xB9, 0xE4, 0x2A, 0x30, 0xCC, 0xBB,
-    0x34, 0x66, 0x43, 0xE7, 0x2C, 0xD7, 0xE5, 0x56, 0x0D, 0xA9, 0xF8, 0x2C, 0xB9, 0x17, 0xE4, 0xB4,
-    0xA9, 0xA2, 0xC4, 0xBE, 0xF5, 0xEF, 0xD5, 0x38, 0xEC, 0xF9, 0x63, 0x58, 0xC6, 0x65, 0xEF, 0x0D,
-    0x41, 0x6D, 0xDA, 0xCC, 0x5E, 0xFC, 0xBB, 0xAD, 0x4C, 0xF0, 0x85, 0xA3, 0x95, 0x2E, 0xC5, 0x7E,
-    0x00, 0xB6, 0xB1, 0x0D, 0xEC, 0xE1, 0x6A, 0xE4, 0xEE, 0xC1, 0x7F, 0x84, 0xED, 0x6F, 0xEE, 0x79,
-    0xBD, 0xF7, 0xA8, 0xB6, 0xCD, 0x3E, 0x4E, 0xD8, 0x03, 0x1C, 0xE9, 0x82, 0xD6, 0x19, 0xA6, 0xA0,
-    0xE0, 0x7F, 0x5E, 0x3B, 0xC7, 0xA3, 0x8A, 0xF9, 0x83, 0xA7, 0xC6, 0x39, 0xC7, 0xAB, 0xAF, 0x69,
-    0x7E, 0xDB, 0x14, 0x0A, 0x57, 0xBD, 0x5D, 0x93, 0xE9, 0x14, 0xCE, 0xE1, 0x94, 0xC1, 0xF2, 0x4D,
-    0xDE, 0xCF, 0xCA, 0x4D, 0xFE, 0x4C, 0xEA, 0x4D, 0xB6, 0x8B, 0x35, 0xF3, 0x4E, 0x19, 0xA3, 0xFD,
-    0xC6, 0x61, 0xC3, 0x13, 0x3E, 0x51, 0x73, 0xCD, 0x0A, 0x9E, 0x9D, 0x71, 0x6D, 0xB3, 0x1D, 0xDF,
-    0xFE, 0xAA, 0x37, 0xDF, 0xFD, 0x39, 0x93, 0x6F, 0x3B, 0xBF, 0xEA, 0xE3, 0xDB, 0x8D, 0x89, 0x0F,
-    0x7A, 0x13, 0x7C, 0xF5, 0x5F, 0xFF, 0xFA, 0xF8, 0x93, 0x33, 0xF9, 0x5A, 0x5E, 0xD5, 0x8A, 0x0A,
-    0xE6, 0x91, 0x63, 0x87, 0xB5, 0x5E, 0xB4, 0x3E, 0x27, 0x2C, 0x04, 0xF1, 0x1D, 0xBA, 0xF1, 0x5F,
-    0x07, 0x86, 0x8F, 0x56, 0x21, 0xB8, 0xB5, 0x33, 0x3A, 0x23, 0xA3, 0x07, 0xB6, 0x67, 0xC3, 0x24,
-    0x31, 0x7A, 0x0A, 0xA6, 0xEF, 0xB8, 0xF4, 0xD1, 0x66, 0xB0, 0x5A, 0x63, 0x0C, 0x4D, 0xC4, 0x95,
-    0x41, 0xC3, 0xD3, 0xD3, 0x45, 0xEC, 0x1A, 0x8C, 0xEE, 0x74, 0xC0, 0x16, 0x08, 0xED, 0x15, 0xDA,
-    0xC0, 0x80, 0xCE, 0x06, 0x62, 0xF8, 0xC1, 0xD8, 0x32, 0x44, 0x01, 0x62, 0x49, 0x31, 0x46, 0x0B,
-    0x86, 0x38, 0x02, 0x45, 0xB1, 0xA4, 0x18, 0x55, 0x23, 0x33, 0x09, 0x83, 0xCC, 0x90, 0x62, 0xC8,
-    0xCE, 0xC4, 0x53, 0xC3, 0x65, 0xDD, 0xBA, 0xC3, 0x5C, 0x97, 0x74, 0xB5, 0xF1, 0x99, 0x1B, 0xEC,
-    0x00, 0x5B, 0x96, 0xE6, 0x3C, 0x5B, 0x99, 0x36, 0xA9, 0xD0, 0x34, 0xA0, 0x3A, 0xFC, 0x09, 0x54,
-    0xBF, 0xC6, 0xDE, 0x01, 0xD1, 0x9F, 0x2C, 0x4B, 0x09, 0x1F, 0x61, 0x62, 0x85, 0x89, 0xF1, 0xE5,
-    0x26, 0x54, 0x6F, 0xF1, 0xAB, 0x9F, 0xE3, 0xC4, 0x03, 0x62, 0x0F, 0xE2, 0x0C, 0xA0, 0x62, 0xE0,
-    0x1A, 0xE6, 0x8F, 0xAC, 0x1E, 0x11, 0x3B, 0x31, 0x03, 0x07, 0x73, 0xB4, 0x02, 0x9C, 0x42, 0xB9,
-    0x33, 0x03, 0x8B, 0x00, 0x4A, 0xC5, 0x3E, 0x9C, 0xE9, 0x97, 0xEA, 0x50, 0xFF, 0x93, 0xB7, 0xD1,
-    0xA8, 0xFD, 0x09, 0xDE, 0xFD, 0x98, 0x35, 0xBB, 0x84, 0x8A, 0x80, 0xF8, 0xC5, 0xEC, 0xFC, 0x7E,
-    0x3B, 0xA7, 0xF1, 0xA9, 0xF9, 0xA3, 0x4B, 0x5F, 0x93, 0xEF, 0x7F, 0x68, 0xEC, 0xDB, 0x10, 0xCC,
-    0x2E, 0x5B, 0xF8, 0x39, 0x02, 0x24, 0x6C, 0x5F, 0xDB, 0xB4, 0x5F, 0xFB, 0xCF, 0x2F, 0xFE, 0x46,
-    0xF3, 0xE1, 0xF7, 0x3E, 0x34, 0xFE, 0x11, 0x3B, 0x5A, 0x3D, 0xB4, 0x11, 0xB8, 0x10, 0xD6, 0xF6,
-    0xCA, 0xA0, 0xF9, 0x6E, 0xFD, 0x38, 0x69, 0x72, 0x60, 0x83, 0x2E, 0x9A, 0xBD, 0xFA, 0x07, 0x63,
-    0x7E, 0xA7, 0x24, 0x45, 0xEA, 0xBC, 0x67, 0x07, 0xE7, 0x09, 0xAC, 0x36, 0xEC, 0xB9, 0x76, 0xFC,
-    0x91, 0x04, 0x4F, 0x8E, 0x12, 0x87, 0xAD, 0x3C, 0x74, 0x38, 0xE7, 0x57, 0xA3, 0xB1, 0xFD, 0x2D,
-    0x31, 0xFD, 0x09, 0x71, 0xAE, 0x1F, 0xEF, 0x3F, 0xED, 0x65, 0xBC, 0x6C, 0xFB, 0xDB, 0x79, 0xF2,
-    0x0C, 0x32, 0xC2, 0xEF, 0x31, 0xF1, 0x2F, 0xAB, 0x97, 0x08, 0x95, 0x83, 0x7D, 0xF7, 0xD9, 0xCC,
-    0xFE, 0xCE, 0x3E, 0xB5, 0x63, 0x1F, 0xD8, 0x83, 0x34, 0xA8, 0x20, 0xF3, 0xCE, 0x73, 0x93, 0x1A,
-    0x4E, 0xD7, 0xE5, 0x1D, 0x36, 0x55, 0xA8, 0xD4, 0xA8, 0x24, 0xBF, 0xBE, 0x71, 0x24, 0xDE, 0xC9,
-    0xE5, 0xC3, 0x34, 0x59, 0x27, 0xB8, 0xC3, 0x6B, 0xE2, 0xFC, 0x61, 0xB3, 0xE2, 0xE1, 0xE4, 0xDE,
-    0xBA, 0xA2, 0xDE, 0x23, 0x2C, 0x3A, 0x69, 0xB7, 0x95, 0xED, 0x6C, 0x71, 0x7E, 0x9A, 0xFC, 0x2C,
-    0x5B, 0xEC, 0xFA, 0xD8, 0xF4, 0x33, 0x99, 0xBB, 0xC8, 0x45, 0xBC, 0xEE, 0xD3, 0x5B, 0xFC, 0xBE,
-    0x3B, 0x13, 0x0A, 0x66, 0xC6, 0xD9, 0xCF, 0xCF, 0xC8, 0x0E, 0x24, 0xBA, 0x31, 0xCB, 0x5A, 0x1D,
-    0xA9, 0xF5, 0xA6, 0x26, 0x41, 0xD3, 0xEA, 0x4F, 0x2D, 0xB8, 0x03, 0xFA, 0x6C, 0xBD, 0x8E, 0xBF,
-    0xBD, 0x86, 0x95, 0xFC, 0xF4, 0xA8, 0xE0, 0x93, 0xBD, 0x13, 0x42, 0xEE, 0x24, 0xC1, 0x6D, 0x10,
-    0x47, 0x65, 0xF3, 0x56, 0xEC, 0xA3, 0x02, 0x9B, 0x4E, 0x3F, 0x4C, 0x5D, 0x67, 0x37, 0xD2, 0x1F,
-    0x97, 0x6E, 0x36, 0x0E, 0x2E, 0x9D, 0x29, 0xD3, 0x5C, 0x86, 0x34, 0x35, 0x30, 0xC9, 0x99, 0xD6,
-    0xE7, 0x8D, 0x33, 0x07, 0x36, 0x12, 0x78, 0xCC, 0xDB, 0x66, 0x8E, 0xAB, 0x16, 0x79, 0x61, 0x3E,
-    0xC9, 0x3A, 0x6E, 0xC2, 0x1B, 0x20, 0x30, 0x7D, 0xAB, 0xFD, 0x1D, 0x8A, 0xC2, 0x9E, 0x56, 0x3A,
-    0x77, 0x06, 0xCA, 0xE5, 0x2C, 0xF3, 0x7F, 0xCA, 0x34, 0x3F, 0x91, 0x9D, 0xE8, 0xD2, 0x19, 0x58,
-    0x23, 0x21, 0x24, 0xEA, 0x02, 0x29, 0xF7, 0x64, 0x36, 0x1E, 0xB0, 0x4B, 0x55, 0x80, 0xD2, 0x8F,
-    0xA4, 0x59, 0xFB, 0xE0, 0x1B, 0x55, 0x19, 0xB0, 0xEE, 0x54, 0x45, 0x5F, 0xD4, 0x5E, 0x46, 0xC7,
-    0xDB, 0xCB, 0x4D, 0x3F, 0x7A, 0xD4, 0x41, 0x6B, 0xF3, 0xAC, 0xE1, 0xA2, 0x85, 0x29, 0x78, 0x71,
-    0x7B, 0x79, 0xEC, 0x76, 0x62, 0xE6, 0x64, 0xB9, 0x75, 0xF9, 0xCF, 0x72, 0xF2, 0xB9, 0x9B, 0xC2,
-    0xC8, 0x9B, 0x42, 0x46, 0x82, 0xBC, 0x9D, 0xB0, 0x97, 0x49, 0x78, 0xB3, 0xE3, 0x5D, 0x99, 0xF8,
-    0x03, 0xF9, 0xC9, 0xC8, 0x0F, 0xEB, 0x82, 0xFD, 0xB0, 0xFA, 0x96, 0x9B, 0x82, 0xE1, 0x4D, 0x41,
-    0x53, 0xA6, 0x16, 0xD4, 0x40, 0x6B, 0xE4, 0xC7, 0xB2, 0x69, 0x59, 0xE4, 0x28, 0x5F, 0x03, 0x03,
-    0x17, 0xE5, 0x9A, 0xC2, 0x8F, 0xCF, 0x0A, 0x9F, 0x5D, 0x56, 0xD7, 0x80, 0xF0, 0x21, 0xAF, 0xF2,
-    0xFE, 0x1A, 0x5F, 0xFF, 0x78, 0x00, 0xE1, 0x0D, 0x85, 0x4F, 0x72, 0xF0, 0x1A, 0x56, 0xE0, 0x35,
-    0x40, 0x7B, 0xF4, 0x9C, 0xF0, 0xD9, 0x07, 0xE9, 0x9A, 0x85, 0xB0, 0x9E, 0xDB, 0x01, 0xD9, 0x3D,
-    0x72, 0x4F, 0x78, 0x6B, 0x4D, 0x27, 0x67, 0x53, 0x30, 0xC6, 0x43, 0x3A, 0xA9, 0x5A, 0xF5, 0x19,
-    0xD3, 0x8B, 0x51, 0xC7, 0xA6, 0xF4, 0xA3, 0x77, 0x27, 0x2D, 0xEA, 0x11, 0xCA, 0xF9, 0xC7, 0x11,
-    0xDB, 0x54, 0xBD, 0x2D, 0x38, 0x4B, 0xAB, 0x6D, 0x80, 0x20, 0x44, 0x16, 0xE7, 0x08, 0x7D, 0x95,
-    0xB4, 0x12, 0xBD, 0xC3, 0x68, 0x76, 0x80, 0x58, 0x0C, 0x19, 0xC5, 0x81, 0x1E, 0xB6, 0xB4, 0xD0,
-    0x6A, 0x2F, 0x41, 0xEA, 0xCE, 0x38, 0x1B, 0x50, 0x2F, 0x43, 0x84, 0x0F, 0xFA, 0x4B, 0xB8, 0x24,
-    0x7D, 0xCE, 0x10, 0xD3, 0x6B, 0x5E, 0x6C, 0xC7, 0x75, 0x2E, 0x26, 0xC6, 0x5B, 0xC4, 0x20, 0xAD,
-    0xDE, 0x4C, 0x04, 0xB7, 0x15, 0x65, 0xD4, 0xC0, 0xC4, 0xC5, 0xBF, 0xBE, 0x89, 0x0A, 0x5A, 0x9D,
-    0x75, 0x7A, 0xBF, 0x0A, 0xF2, 0xE8, 0x5C, 0xED, 0xD6, 0xEE, 0xE3, 0x06, 0x71, 0xF8, 0xC6, 0x4D,
-    0xF8, 0x6C, 0xB8, 0x2F, 0x81, 0xFE, 0xB9, 0x65, 0x7E, 0x3A, 0x4C, 0x06, 0x5F, 0x72, 0xF2, 0x41,
-    0x89, 0x58, 0x69, 0x3B, 0xEC, 0xBC, 0x15, 0x63, 0xF2, 0x4D, 0xAF, 0x09, 0xF2, 0x44, 0x92, 0xF7,
-    0x6B, 0xA3, 0x32, 0x40, 0x70, 0x8D, 0xAA, 0xED, 0x0B, 0xEB, 0x0B, 0xD1, 0x1A, 0x73, 0x5C, 0x12,
-    0x93, 0x55, 0xBB, 0x12, 0x62, 0x62, 0xDF, 0x39, 0x08, 0x42, 0x4C, 0x21, 0x26, 0xB6, 0xEC, 0x4F,
-    0x6A, 0x38, 0x86, 0x29, 0xC4, 0xC4, 0xE4, 0x03, 0x6A, 0xA1, 0xE5, 0x18, 0x98, 0x42, 0x4C, 0x38,
-    0x05, 0xFD, 0x86, 0x98, 0x9F, 0xBE, 0x04, 0x66, 0x8D, 0x86, 0xDC, 0xE7, 0x1F, 0x47, 0xCE, 0x3D,
-    0xAA, 0xDD, 0xD5, 0xE3, 0x66, 0xDF, 0xED, 0xDE, 0xB8, 0x19, 0xFC, 0xAD, 0x83, 0x9C, 0x0C, 0xB5,
-    0x94, 0xD7, 0xEC, 0x0A, 0x8D, 0x79, 0xC4, 0xB8, 0x0B, 0xBE, 0x74, 0xBB, 0x3D, 0xF7, 0xC1, 0x41,
-    0x17, 0xD4, 0xED, 0xAA, 0x93, 0xFD, 0x5B, 0xB8, 0xC1, 0x04, 0x23, 0x5B, 0x76, 0xFB, 0x2A, 0x98,
-    0x15, 0x31, 0x2B, 0x62, 0x02, 0x1D, 0x98, 0x02, 0xCC, 0x5B, 0xF8, 0x00, 0xD3, 0x25, 0xA6, 0xAB,
-    0x98, 0x1D, 0x31, 0x41, 0x1F, 0x98, 0xE2, 0x01, 0x13, 0x72, 0x02, 0x53, 0x88, 0x09, 0x39, 0x99,
-    0x68, 0x5E, 0x84, 0xC9, 0x50, 0x19, 0xD6, 0x57, 0x99, 0xA8, 0x9A, 0x6A, 0xF3, 0xAB, 0x4F, 0x9C,
-    0x29, 0x46, 0x2D, 0x31, 0x2B, 0x7A, 0xA3, 0x51, 0x4F, 0x9D, 0xEF, 0x0D, 0x5B, 0x6C, 0xC5, 0x4F,
-    0x84, 0x0D, 0x1C, 0x3B, 0xB9, 0x3F, 0xA0, 0xC4, 0x46, 0x2B, 0x9B, 0x26, 0x0D, 0xAB, 0x5E, 0xD0,
-    0xCE, 0x1D, 0x9B, 0xFC, 0x07, 0x3D, 0xCE, 0xD1, 0x0D, 0x83, 0x30, 0x0C, 0x04, 0x50, 0x13, 0x7F,
-    0xF2, 0x91, 0x15, 0x3A, 0x01, 0x19, 0x01, 0xC4, 0x1A, 0x9D, 0xA0, 0x53, 0x96, 0x15, 0xCA, 0x04,
-    0x16, 0x0C, 0x80, 0x07, 0x88, 0xB8, 0x9E, 0x5D, 0xA9, 0xFE, 0x79, 0x39, 0xE5, 0x22, 0x47, 0x44,
-    0x1E, 0x12, 0x53, 0x2C, 0x69, 0x49, 0x41, 0x32, 0x3D, 0x83, 0xB2, 0xE5, 0xDD, 0x24, 0x03, 0x29,
-    0xFD, 0x15, 0xA9, 0x01, 0x6A, 0xAC, 0x01, 0xD5, 0x22, 0xF4, 0x66, 0x11, 0xFC, 0x6D, 0x0C, 0x58,
-    0x71, 0x00, 0xF7, 0x52, 0x71, 0x02, 0x9B, 0xB0, 0x0A, 0xB0, 0xE4, 0x8A, 0x3E, 0xF2, 0xA4, 0xAC,
-    0xC1, 0xC9, 0x87, 0x81, 0xF0, 0x59, 0x70, 0x31, 0x88, 0xF6, 0xEA, 0x81, 0xCF, 0xB1, 0x5F, 0x77,
-    0x4F, 0x90, 0x5F, 0x53, 0xFF, 0x21, 0xFF, 0xF9, 0x02,
+static const uint8_t bookerly_14_bolditalicBitmaps[31808] = {
+    0xCD, 0x9B, 0x31, 0xCC, 0x26, 0xC7, 0x79, 0xDF, 0x7F, 0xB3, 0xC3, 0xEF, 0x56, 0xD6, 0x06, 0x19,
+    0x16, 0x14, 0x61, 0xCB, 0x86, 0xD7, 0x85, 0x03, 0xD8, 0x89, 0xAD, 0x6D, 0x8D, 0xC0, 0xE6, 0x0C,
+    0xC5, 0x42, 0x85, 0x0B, 0x7D, 0x05, 0xE9, 0x00, 0x12, 0x1C, 0xBB, 0x70, 0x61, 0x38, 0x01, 0xCE,
+    0x85, 0x0B, 0x17, 0x26, 0x77, 0x4D, 0x02, 0x71, 0xA1, 0x42, 0x17, 0xC0, 0x55, 0x5C, 0x44, 0x05,
+    0x81, 0x98, 0x67, 0x20, 0xA7, 0xC2, 0x85, 0x0B, 0xDF, 0xCD, 0xF0, 0xAE, 0x60, 0xA1, 0x42, 0x6B,
+    0x32, 0x0A, 0x0B, 0x15, 0x5A, 0x89, 0x32, 0x6C, 0x48, 0xC5, 0x8D, 0xA4, 0x55, 0xB8, 0x77, 0x9C,
+    0xDD, 0x7F, 0x8A, 0x79, 0xDF, 0xBB, 0xEF, 0x24, 0x17, 0x89, 0xCD, 0x84, 0x5E, 0x7C, 0xFB, 0xED,
+    0xFB, 0xED, 0xEE, 0x3B, 0xF3, 0x3C, 0x33, 0xCF, 0xFC, 0x9F, 0xE7, 0xF9, 0x3F, 0xF3, 0xF1, 0xC9,
+    0x30, 0xCC, 0x2E, 0x77, 0x9B, 0xDD, 0x11, 0x7E, 0xEA, 0xE7, 0x36, 0x37, 0x85, 0x3B, 0xF8, 0xE0,
+    0x92, 0xCD, 0x6C, 0xFC, 0x1A, 0x4F, 0x01, 0x66, 0x35, 0x22, 0x4E, 0x7D, 0x32, 0x81, 0x66, 0xFE,
+    0x2B, 0xFF, 0xD9, 0xB7, 0xCB, 0xD8, 0x7D, 0xBF, 0xF8, 0x2F, 0x2C, 0xBB, 0x7F, 0x21, 0x17, 0xF7,
+    0x5A, 0x7E, 0xD9, 0x4D, 0xE1, 0x69, 0xB8, 0xB8, 0xFC, 0x04, 0xEC, 0xED, 0x82, 0x4B, 0xB7, 0x31,
+    0xC5, 0x25, 0x86, 0xA9, 0x20, 0x49, 0x4E, 0xD2, 0xF2, 0xF9, 0x1F, 0x8E, 0x2F, 0x72, 0xC7, 0x66,
+    0xBA, 0xF9, 0x15, 0x28, 0xDD, 0xDC, 0xDC, 0xFA, 0xCE, 0xF1, 0x7A, 0x94, 0xD4, 0x49, 0xCA, 0x36,
+    0x0F, 0x01, 0x6F, 0x57, 0xDA, 0xC5, 0xC3, 0xED, 0x36, 0x73, 0xE5, 0x68, 0x13, 0x74, 0x13, 0xB8,
+    0x00, 0x3D, 0x74, 0x5A, 0xF0, 0x2A, 0x1C, 0xCF, 0xED, 0xCD, 0xF6, 0xAB, 0x77, 0xEC, 0xFA, 0x87,
+    0xBF, 0x66, 0xCB, 0x5F, 0xFE, 0x4A, 0xA3, 0x8C, 0x51, 0x86, 0x58, 0x60, 0x50, 0xA0, 0x55, 0xA2,
+    0x55, 0xFE, 0xE5, 0xEE, 0x8B, 0xF9, 0x8E, 0xEB, 0xB2, 0x5C, 0x97, 0xE3, 0xBF, 0xEF, 0x67, 0x7F,
+    0xC4, 0xD4, 0xEB, 0xA0, 0xD1, 0xB7, 0xE1, 0x0F, 0x81, 0x15, 0xC8, 0x60, 0x32, 0x34, 0x0B, 0x98,
+    0x70, 0xB5, 0x6F, 0x7E, 0x05, 0xC6, 0x85, 0x36, 0x33, 0x68, 0x62, 0xA7, 0xFB, 0x61, 0xC1, 0x4F,
+    0xA6, 0xB8, 0xB9, 0xCB, 0xF8, 0x69, 0xA7, 0x60, 0xB3, 0x9B, 0x7D, 0x60, 0xA4, 0x74, 0x0B, 0x6D,
+    0xEE, 0x53, 0x81, 0xD1, 0xAE, 0x9E, 0x37, 0xDA, 0x35, 0x76, 0x73, 0x2C, 0x5E, 0x6F, 0x6E, 0xFE,
+    0xFE, 0x12, 0x17, 0xDF, 0xE5, 0x08, 0x2E, 0x95, 0x36, 0xD3, 0xAC, 0x43, 0x1A, 0xE1, 0x15, 0xBB,
+    0x75, 0x19, 0x97, 0x7C, 0x38, 0xB0, 0xAB, 0x5D, 0x5D, 0xE2, 0x0E, 0xFE, 0xB5, 0x8D, 0x3E, 0x35,
+    0x87, 0xB0, 0x2B, 0x4E, 0x13, 0xCF, 0xC1, 0x27, 0x03, 0x4C, 0x57, 0x05, 0xEB, 0x0B, 0x80, 0x04,
+    0xD8, 0x7D, 0x0C, 0xD0, 0xE5, 0x21, 0x80, 0x9B, 0x3D, 0xD0, 0xA7, 0x57, 0x80, 0xFE, 0x6E, 0xE1,
+    0x5F, 0xD0, 0x7F, 0x63, 0xE1, 0x36, 0xFD, 0xC1, 0xF5, 0xC2, 0x98, 0x3B, 0xAD, 0x8D, 0x16, 0x7F,
+    0xD0, 0x7D, 0x90, 0x9F, 0x2B, 0x0C, 0xF7, 0x36, 0x0A, 0xFE, 0xD5, 0xD2, 0xAC, 0x8C, 0x41, 0x36,
+    0x13, 0x89, 0x5F, 0x9D, 0x19, 0x83, 0x57, 0x62, 0x4C, 0x4E, 0xE0, 0x1F, 0x5C, 0xD7, 0x84, 0x93,
+    0x74, 0x84, 0x46, 0x7B, 0xAF, 0x95, 0x0B, 0x1A, 0x65, 0x80, 0x8B, 0xD0, 0xCC, 0xFB, 0x70, 0xB7,
+    0xF8, 0xD7, 0x56, 0x6F, 0x97, 0x97, 0xCD, 0xA3, 0x19, 0xEB, 0x32, 0xEE, 0xCA, 0x4F, 0x97, 0x69,
+    0x57, 0x6C, 0xC1, 0xEC, 0x10, 0xC1, 0x4F, 0xF4, 0x89, 0x2E, 0xD3, 0x14, 0x38, 0xC0, 0x4F, 0xB8,
+    0x05, 0x5B, 0x20, 0x42, 0x3F, 0x63, 0x37, 0x50, 0xFD, 0x54, 0xC0, 0x4F, 0xB4, 0x1B, 0xBC, 0x0C,
+    0x17, 0x27, 0xED, 0xBF, 0x0C, 0x7D, 0x02, 0x41, 0xBB, 0xC1, 0x90, 0xE0, 0x80, 0x2E, 0xC3, 0x18,
+    0xB0, 0x1B, 0xF8, 0x44, 0x53, 0x60, 0x78, 0xE2, 0xE2, 0x27, 0xEC, 0x0A, 0x11, 0xDC, 0x82, 0xA9,
+    0x37, 0xBA, 0x8C, 0xD9, 0x6B, 0xFF, 0x19, 0x5B, 0x30, 0x07, 0xF8, 0x80, 0xA9, 0x63, 0xFD, 0xF4,
+    0x6D, 0xF3, 0xAD, 0xD5, 0x7D, 0x7D, 0x1A, 0xF6, 0xD7, 0x5B, 0x7D, 0x33, 0xDE, 0xFF, 0xE2, 0xFD,
+    0xF0, 0xA9, 0x81, 0xA7, 0xFF, 0xFA, 0x6C, 0x25, 0xCD, 0x06, 0xC3, 0x74, 0xE5, 0x32, 0x4A, 0xEF,
+    0x4A, 0xFB, 0xBF, 0x8E, 0xDF, 0x99, 0x9E, 0x7C, 0x66, 0x5E, 0x07, 0x18, 0xA6, 0x3E, 0xDB, 0x82,
+    0xF0, 0xC1, 0xA7, 0x21, 0xF9, 0x74, 0x2D, 0x00, 0x9D, 0x8A, 0xF4, 0x55, 0x15, 0x00, 0x53, 0xFC,
+    0x5B, 0x65, 0x7C, 0x3E, 0x00, 0x7E, 0xAA, 0x4A, 0xBA, 0xB9, 0xAA, 0xD6, 0xAE, 0x60, 0x37, 0x30,
+    0x05, 0xD8, 0x81, 0x08, 0x8C, 0xE1, 0xFF, 0xF0, 0x45, 0x7F, 0xE5, 0xC5, 0x2B, 0x36, 0xDE, 0x29,
+    0xD0, 0x4A, 0x58, 0x69, 0x43, 0x7F, 0xA3, 0x34, 0x2C, 0x76, 0x6F, 0x0B, 0x7E, 0x51, 0xB0, 0x47,
+    0x9F, 0xF1, 0x6F, 0x1F, 0xD8, 0xDD, 0xCF, 0xF8, 0x77, 0x0A, 0xB6, 0x8C, 0x89, 0xF1, 0xAD, 0x82,
+    0x5B, 0x63, 0x42, 0x6D, 0xC1, 0xCF, 0x63, 0xEA, 0x8A, 0x55, 0x23, 0x06, 0x29, 0x21, 0x2D, 0x34,
+    0x5A, 0x81, 0x73, 0x1F, 0x43, 0x68, 0x94, 0x9D, 0x36, 0xAB, 0x1D, 0xA3, 0x40, 0x4C, 0x0C, 0x19,
+    0xB7, 0x61, 0x77, 0x8C, 0x20, 0x26, 0x7C, 0xC6, 0x6D, 0xB4, 0x57, 0xFF, 0xBE, 0x7E, 0x3C, 0x2F,
+    0xAD, 0xAA, 0x83, 0x02, 0xC4, 0x8D, 0x46, 0x9A, 0x1B, 0xA9, 0x34, 0x7A, 0x5E, 0x93, 0xF0, 0x8B,
+    0xC7, 0x6D, 0x26, 0xD8, 0x1D, 0x1A, 0x41, 0xA3, 0x70, 0x3A, 0xA7, 0xD3, 0x19, 0xB0, 0x02, 0x7B,
+    0x40, 0xBB, 0x43, 0xB7, 0xBF, 0xF4, 0x52, 0x27, 0xE9, 0x9E, 0xA4, 0x65, 0x94, 0x96, 0x27, 0x5A,
+    0x4E, 0x8D, 0x54, 0x8C, 0x9E, 0x17, 0x23, 0x3E, 0x39, 0x5C, 0x86, 0x6E, 0xAB, 0xE7, 0xB0, 0xD1,
+    0xA8, 0x80, 0x94, 0xF8, 0xD4, 0xAD, 0x02, 0x46, 0x80, 0x4F, 0x30, 0x64, 0x18, 0x56, 0x88, 0xDB,
+    0xB5, 0x5B, 0xDA, 0x1A, 0x69, 0xC5, 0xEB, 0xC6, 0x63, 0xDD, 0xA9, 0xE3, 0xDD, 0x67, 0xE8, 0x37,
+    0xE8, 0x77, 0xE8, 0x05, 0xBD, 0x12, 0xFD, 0xD7, 0x33, 0xFD, 0x3B, 0x1B, 0xFD, 0xBC, 0xD3, 0xCF,
+    0x23, 0xFD, 0x3C, 0xA4, 0x7E, 0x76, 0x4B, 0x2F, 0xE9, 0xBE, 0xA4, 0x87, 0x92, 0xF6, 0x4F, 0xBC,
+    0x34, 0x7E, 0x0D, 0xDC, 0x52, 0xE7, 0xB4, 0x29, 0x80, 0x80, 0x41, 0xC2, 0x49, 0xA9, 0x95, 0x72,
+    0xB3, 0xBF, 0x74, 0x89, 0xCE, 0xE6, 0xB2, 0x82, 0xD3, 0x82, 0x95, 0x02, 0xCF, 0x2A, 0x43, 0x77,
+    0x00, 0x9A, 0x60, 0x58, 0xAA, 0x32, 0xED, 0x0E, 0xAD, 0xA0, 0x17, 0x5E, 0xC2, 0x9D, 0xA1, 0xF0,
+    0xEA, 0x71, 0x7D, 0x85, 0x51, 0x09, 0xAF, 0x1B, 0xF4, 0x47, 0xA0, 0x13, 0x18, 0x4D, 0x30, 0x2E,
+    0xE0, 0x8E, 0x3F, 0xC7, 0x48, 0x1B, 0x5E, 0x5A, 0xDA, 0xBD, 0x15, 0x71, 0x72, 0x6B, 0xB7, 0xA2,
+    0xA0, 0xE0, 0x56, 0xB7, 0x22, 0xE2, 0xD4, 0xE7, 0x76, 0xB7, 0x3B, 0x5E, 0x9A, 0x9E, 0xB4, 0x09,
+    0x27, 0x6D, 0x83, 0x74, 0x78, 0x69, 0xF7, 0x37, 0x6F, 0x95, 0x91, 0x3E, 0xDF, 0x66, 0x4C, 0xBF,
+    0x8A, 0xC0, 0xEE, 0xE0, 0xB6, 0x3A, 0xAE, 0x63, 0x82, 0xD3, 0x14, 0x76, 0xE5, 0xF1, 0x6D, 0x3F,
+    0xD7, 0x47, 0x71, 0x82, 0x91, 0xC7, 0x88, 0x00, 0x71, 0xA5, 0x91, 0x92, 0xD5, 0xAD, 0xAD, 0x39,
+    0x10, 0xC2, 0x27, 0x3F, 0xB9, 0xEC, 0x72, 0xB7, 0x36, 0xFA, 0xEC, 0x8A, 0xD7, 0x8A, 0x55, 0xA6,
+    0xD5, 0x41, 0xB7, 0x6B, 0x76, 0x5B, 0x57, 0xDA, 0x0D, 0xBD, 0x50, 0x18, 0x66, 0xD1, 0xAD, 0x7E,
+    0xE9, 0x4A, 0xA7, 0x5B, 0x05, 0xA9, 0xD0, 0x6A, 0xBD, 0xDA, 0x7A, 0xA7, 0x40, 0x27, 0xD1, 0x48,
+    0x05, 0x3F, 0x8F, 0x73, 0x57, 0x7B, 0xE9, 0xB3, 0xCB, 0xA8, 0x7E, 0x58, 0xCD, 0x81, 0x92, 0x9F,
+    0x5B, 0xA9, 0x30, 0x48, 0x13, 0x83, 0x72, 0x1D, 0x72, 0xA3, 0x09, 0xE2, 0x02, 0xE3, 0x86, 0x89,
+    0x3B, 0x56, 0x07, 0x0C, 0x07, 0xF0, 0x74, 0x6D, 0xFF, 0x76, 0x73, 0xD8, 0xC3, 0x16, 0x2E, 0x9F,
+    0x00, 0xF9, 0xE4, 0xD3, 0x98, 0xC6, 0xF0, 0x4C, 0x15, 0x61, 0x26, 0x4E, 0xF6, 0xA0, 0xCB, 0x57,
+    0xE4, 0x7A, 0x74, 0xDC, 0xA1, 0x2D, 0xB8, 0x8C, 0x4F, 0xEC, 0xB8, 0x4C, 0xC4, 0x65, 0x7E, 0xEA,
+    0xFC, 0xF4, 0xAF, 0x20, 0x26, 0xE2, 0x4A, 0xFC, 0x36, 0x71, 0x61, 0x5C, 0x68, 0x0F, 0xE8, 0xAF,
+    0x9E, 0x05, 0xFA, 0x09, 0x7E, 0xEE, 0x84, 0x61, 0xA3, 0x34, 0xD7, 0xEF, 0x36, 0x37, 0x6F, 0xFE,
+    0xF9, 0xE9, 0xE6, 0x27, 0x5E, 0x7A, 0x29, 0x00, 0x66, 0x01, 0xBF, 0xD0, 0xE8, 0x7C, 0xCE, 0x34,
+    0x4A, 0xD8, 0x9D, 0x46, 0xD3, 0x35, 0x4D, 0xAD, 0x26, 0xAB, 0x89, 0x61, 0x3A, 0x3B, 0xAD, 0x38,
+    0x0F, 0x7A, 0x41, 0xC5, 0xC7, 0xB7, 0xC3, 0x8E, 0x9B, 0x29, 0xF8, 0xE0, 0x66, 0xBB, 0xB2, 0xE3,
+    0x69, 0x7F, 0xC8, 0xB8, 0xDA, 0xA3, 0x2A, 0x35, 0x84, 0x76, 0x23, 0x4E, 0x5D, 0xE6, 0x99, 0x2B,
+    0xCA, 0x5D, 0xD3, 0x11, 0xC0, 0x48, 0x9A, 0x61, 0xD4, 0x7D, 0x2D, 0x74, 0x47, 0x60, 0x9C, 0x89,
+    0x13, 0xF8, 0xD4, 0xAD, 0x80, 0x0F, 0x63, 0xE8, 0xFF, 0xD3, 0x74, 0xD8, 0xCD, 0x4A, 0xCD, 0x36,
+    0x24, 0x7F, 0x7F, 0x6B, 0x97, 0xBD, 0x29, 0x2E, 0x0D, 0x7F, 0x92, 0x5D, 0xF2, 0xDC, 0x19, 0xA6,
+    0xC8, 0x66, 0xD7, 0xDD, 0xAE, 0xDD, 0xEC, 0xEE, 0xD5, 0x7B, 0x2E, 0xF9, 0xA6, 0xB4, 0xD9, 0xB3,
+    0x0F, 0x79, 0x0C, 0xC5, 0xEA, 0xFD, 0xFB, 0x9B, 0x5D, 0x3B, 0xF5, 0x0A, 0x6E, 0xE9, 0x96, 0x61,
+    0x66, 0x48, 0x00, 0x8C, 0x55, 0x17, 0x4D, 0x70, 0x03, 0xF4, 0xB7, 0x17, 0x71, 0x02, 0x55, 0x8C,
+    0x1A, 0xA5, 0x00, 0x5C, 0xBC, 0x71, 0x5A, 0xFA, 0xD7, 0x02, 0xA7, 0xC5, 0x4A, 0x57, 0x00, 0xC6,
+    0x15, 0xB0, 0x9A, 0x81, 0x21, 0x4E, 0x40, 0x11, 0xD0, 0xBD, 0x57, 0x80, 0xB1, 0xCB, 0x60, 0xD7,
+    0x61, 0x86, 0x3E, 0x8D, 0x13, 0xEC, 0x08, 0xBA, 0x1F, 0xFE, 0xBB, 0x02, 0x5E, 0xCA, 0x58, 0x49,
+    0x33, 0xFD, 0xD7, 0x5E, 0x8A, 0x13, 0x07, 0x8D, 0xE8, 0x32, 0x6D, 0x61, 0x4C, 0x0C, 0x0F, 0x7A,
+    0xCD, 0x9D, 0xF6, 0xA8, 0xE0, 0x95, 0xE1, 0x73, 0xAF, 0x43, 0xD4, 0x81, 0x93, 0xC4, 0xBF, 0xD5,
+    0xAF, 0x1F, 0xD8, 0xD2, 0x96, 0x6A, 0xA5, 0xE3, 0xE4, 0xA7, 0x66, 0x37, 0x3B, 0x6E, 0x75, 0x19,
+    0xFF, 0x50, 0x75, 0x1D, 0x77, 0xD2, 0x86, 0x9F, 0xFD, 0x8A, 0xF0, 0x8B, 0x2D, 0xC4, 0xA9, 0xCF,
+    0xCD, 0x41, 0x9C, 0x5C, 0xB6, 0x3B, 0x71, 0xEA, 0x1F, 0xDE, 0x2A, 0xAD, 0xA4, 0xC9, 0x3F, 0x46,
+    0x4D, 0xAE, 0xBD, 0x01, 0x8D, 0x34, 0x13, 0xA5, 0xA9, 0xD3, 0xCD, 0x03, 0x2D, 0xCD, 0xDA, 0x15,
+    0x5C, 0xF2, 0x33, 0xCF, 0x35, 0x07, 0x5C, 0xBA, 0x95, 0xBA, 0x58, 0x1B, 0x01, 0xAE, 0x00, 0x7E,
+    0x01, 0x94, 0xC0, 0x0A, 0x70, 0x3B, 0xFC, 0xF6, 0x50, 0xE8, 0x92, 0x3F, 0x7E, 0xE3, 0x20, 0x4A,
+    0x99, 0x28, 0xC1, 0xA8, 0xF9, 0xE4, 0xA6, 0xCC, 0xEF, 0xFD, 0x29, 0x55, 0x44, 0x2B, 0x69, 0xE3,
+    0x39, 0xFD, 0x99, 0x16, 0x5C, 0x6E, 0x85, 0x11, 0xFD, 0x46, 0x9F, 0x51, 0x6A, 0x0E, 0xDA, 0x82,
+    0x9F, 0x19, 0x67, 0x5B, 0xB0, 0x3B, 0x63, 0x62, 0x4C, 0x5D, 0xA1, 0x2D, 0xC4, 0x89, 0x98, 0xDC,
+    0x8A, 0xDB, 0xA8, 0xDF, 0xC9, 0xF8, 0xA5, 0x39, 0x70, 0x05, 0xBF, 0x74, 0xA2, 0x55, 0x85, 0x52,
+    0xCD, 0x48, 0xBA, 0xF1, 0xC4, 0xA2, 0x72, 0x92, 0x92, 0x95, 0x94, 0xE9, 0x1F, 0xFE, 0xC5, 0x86,
+    0x2D, 0xBC, 0x82, 0x11, 0x7D, 0x60, 0x4C, 0xED, 0xC4, 0xB0, 0x00, 0x6E, 0x05, 0xEC, 0xF1, 0xB9,
+    0x1B, 0x75, 0x3C, 0x89, 0x2A, 0x27, 0x45, 0xEB, 0x93, 0xC2, 0x53, 0x18, 0xD1, 0x4D, 0xC4, 0xC9,
+    0x2E, 0xF8, 0xD9, 0xAE, 0xF4, 0x47, 0x2C, 0x8C, 0x92, 0xF0, 0xAA, 0xA6, 0x03, 0xE0, 0xA5, 0x1D,
+    0x5F, 0xD1, 0xE7, 0x66, 0xC1, 0xEE, 0x14, 0xDA, 0xC2, 0x46, 0x5B, 0xC8, 0x74, 0xDB, 0xB9, 0x49,
+    0xB7, 0x02, 0xBD, 0x14, 0x18, 0x24, 0xF0, 0x0F, 0xDF, 0xA8, 0xC0, 0x88, 0x4F, 0xA7, 0x11, 0x27,
+    0xA6, 0x93, 0xA9, 0x1A, 0xFD, 0x0F, 0xE8, 0x55, 0xC0, 0x57, 0x6F, 0x7A, 0xF1, 0x46, 0x80, 0x58,
+    0x27, 0xFE, 0x60, 0x38, 0xFE, 0x62, 0x47, 0x33, 0xA5, 0x11, 0x14, 0xBB, 0xC3, 0xDA, 0x15, 0x08,
+    0xB5, 0x8B, 0x0C, 0xF8, 0xFA, 0xCB, 0xDC, 0xBC, 0xE9, 0x97, 0x46, 0x87, 0xCF, 0x26, 0x16, 0x9F,
+    0x71, 0xAB, 0x5F, 0x71, 0xB9, 0x2F, 0xB8, 0xEC, 0x14, 0xFA, 0xA5, 0x95, 0x34, 0x1B, 0x49, 0x89,
+    0x41, 0x0F, 0xE0, 0xEA, 0x02, 0x96, 0x52, 0x1D, 0x48, 0xAB, 0x03, 0xA3, 0xC9, 0x68, 0xC2, 0xEE,
+    0xD8, 0x02, 0x7D, 0xA6, 0xAF, 0x70, 0x1F, 0x27, 0x9A, 0x03, 0x7B, 0x80, 0x5B, 0x71, 0x2B, 0xF8,
+    0xEF, 0xDC, 0x8C, 0x09, 0x23, 0x49, 0xD0, 0x49, 0xDA, 0xC0, 0x2F, 0xF8, 0x19, 0x14, 0x50, 0xC0,
+    0x16, 0xDA, 0xDA, 0xC4, 0x90, 0x2B, 0xC0, 0x4D, 0xD8, 0x03, 0xBB, 0x43, 0xFF, 0x80, 0xE1, 0x01,
+    0xAD, 0x8E, 0x4E, 0x3B, 0x5E, 0xAB, 0x57, 0x3E, 0x8B, 0x32, 0x5B, 0x09, 0x53, 0xF1, 0x0A, 0x57,
+    0xFB, 0x6E, 0x54, 0x5D, 0x8C, 0x9F, 0x6B, 0x54, 0x59, 0xAA, 0xC7, 0x54, 0xA8, 0x8D, 0xD5, 0xD6,
+    0x9B, 0x03, 0xFA, 0x9D, 0x56, 0x07, 0x5E, 0xEB, 0x23, 0xBF, 0x53, 0x1D, 0x2E, 0x18, 0xCD, 0x35,
+    0xDC, 0xA8, 0xF3, 0xE3, 0xD3, 0x29, 0x52, 0xE8, 0x36, 0x4E, 0xD3, 0xA3, 0x50, 0x9B, 0xAE, 0x03,
+    0x1B, 0xA7, 0xEA, 0xF1, 0x70, 0xF9, 0x89, 0x75, 0x72, 0x7E, 0xDD, 0x9C, 0xFF, 0x9A, 0xC7, 0x84,
+    0xD3, 0x0E, 0x5E, 0x0B, 0x68, 0x07, 0x6E, 0x5E, 0x09, 0x31, 0xBC, 0xB2, 0x0E, 0xBC, 0x16, 0x15,
+    0xDA, 0x03, 0x3F, 0x63, 0x4B, 0x55, 0xA2, 0x2D, 0xD0, 0x96, 0x3E, 0x43, 0xB7, 0x8D, 0x13, 0xB8,
+    0x1F, 0x1E, 0x80, 0xFB, 0x60, 0x03, 0x7A, 0x2D, 0x50, 0x1D, 0x14, 0xFE, 0xFE, 0x06, 0xF8, 0x77,
+    0x0B, 0xE0, 0xEF, 0x09, 0x18, 0x93, 0x26, 0x88, 0x53, 0x5C, 0x40, 0xC1, 0x6F, 0x18, 0xDD, 0xE8,
+    0x0F, 0x7A, 0xAD, 0xAD, 0x92, 0x57, 0x36, 0x9A, 0x00, 0x9E, 0xAA, 0x12, 0x58, 0x09, 0xBC, 0x72,
+    0x8D, 0x10, 0xEC, 0x7E, 0x52, 0xA7, 0x2D, 0x27, 0x2D, 0xDD, 0x7A, 0x02, 0xC3, 0x3E, 0x9F, 0x94,
+    0xF4, 0xE7, 0xF7, 0x7C, 0x32, 0x37, 0xDA, 0xC2, 0x73, 0xC4, 0xD4, 0x2E, 0x6E, 0x63, 0x37, 0xFA,
+    0xAE, 0xDE, 0x94, 0xB4, 0x79, 0x49, 0x57, 0x16, 0xE2, 0xCC, 0x78, 0xE0, 0xB4, 0xA0, 0x42, 0xA3,
+    0xA5, 0xFA, 0x9C, 0xC5, 0x2A, 0x61, 0x95, 0xBB, 0x9A, 0xEC, 0xB9, 0xFB, 0x89, 0xEE, 0xEB, 0x79,
+    0x18, 0x13, 0xEE, 0x2B, 0xF9, 0x39, 0x9F, 0x70, 0x6F, 0xAD, 0xC5, 0x27, 0x86, 0xD7, 0x1E, 0x6C,
+    0x3E, 0xE1, 0x5F, 0xF8, 0x20, 0xFB, 0x09, 0x6F, 0xB5, 0x8C, 0x13, 0xAF, 0x34, 0x4A, 0xE3, 0xC4,
+    0xDE, 0x28, 0x8C, 0x13, 0xC5, 0x88, 0x38, 0x99, 0xC2, 0x4E, 0x0C, 0xCD, 0x46, 0x21, 0x86, 0x76,
+    0xE3, 0xD2, 0x68, 0xF6, 0x0A, 0xF4, 0x5A, 0xA3, 0xCE, 0xE3, 0x05, 0xE0, 0x0F, 0x7A, 0x2D, 0x4E,
+    0xA9, 0xD5, 0xCA, 0xB8, 0x31, 0xCC, 0x38, 0xD1, 0x66, 0xAC, 0x96, 0x66, 0xC3, 0xA8, 0xB0, 0x43,
+    0x54, 0xF0, 0xE0, 0x63, 0xEE, 0x13, 0xEE, 0xDD, 0xBD, 0xCB, 0xB4, 0x59, 0xAF, 0x6E, 0x34, 0xA5,
+    0xCF, 0x3B, 0xDC, 0xB1, 0x87, 0x07, 0x1F, 0xE2, 0x37, 0x12, 0x2E, 0x39, 0x65, 0xDA, 0xDC, 0x68,
+    0xA3, 0x29, 0xF8, 0x1D, 0x0E, 0x3A, 0xC1, 0x78, 0xC3, 0x28, 0x19, 0x1D, 0xF8, 0x85, 0xA8, 0xD0,
+    0x56, 0xCB, 0x0B, 0x00, 0xD7, 0x5E, 0x07, 0x46, 0xAD, 0x20, 0x29, 0x18, 0x3D, 0x54, 0x46, 0x73,
+    0x77, 0xA0, 0x84, 0x52, 0x9C, 0x19, 0x56, 0x9F, 0x69, 0xF7, 0x7E, 0xC5, 0xE8, 0x0B, 0x05, 0xC6,
+    0x77, 0x04, 0xFD, 0xAA, 0x44, 0xB7, 0xFB, 0x8C, 0x95, 0x2B, 0xA0, 0xD7, 0x04, 0x71, 0x56, 0xC2,
+    0xE7, 0x61, 0xC3, 0x67, 0xAB, 0x69, 0x5C, 0x89, 0xD2, 0x4A, 0x27, 0x65, 0xB8, 0xAE, 0x1B, 0x8F,
+    0x42, 0x95, 0xCF, 0xBD, 0x0E, 0xC3, 0x09, 0x2D, 0x57, 0x3E, 0x38, 0xAE, 0x17, 0x6C, 0xE9, 0x76,
+    0xDA, 0x62, 0x8F, 0xFA, 0xAB, 0xDB, 0xEC, 0x8E, 0x5B, 0xDB, 0x82, 0xCB, 0x6E, 0xA3, 0xCF, 0x63,
+    0xAE, 0xE1, 0x90, 0xD7, 0x0E, 0xFE, 0x3B, 0xE1, 0x09, 0xA0, 0x9A, 0x1E, 0x01, 0xD5, 0xFC, 0x24,
+    0x50, 0x5D, 0x7B, 0x1D, 0x60, 0x54, 0xA6, 0xAA, 0x47, 0xD5, 0xAF, 0x2A, 0x58, 0x35, 0x24, 0xCE,
+    0x0C, 0x2B, 0x3E, 0xD3, 0xEE, 0xF4, 0x2B, 0x46, 0x53, 0x57, 0x60, 0x9C, 0xAD, 0xA0, 0x5F, 0x51,
+    0xA2, 0xDB, 0xF1, 0x19, 0x2B, 0x5C, 0x01, 0x4D, 0x56, 0x10, 0x67, 0x94, 0xF0, 0x99, 0x61, 0xAB,
+    0xCF, 0xC2, 0xB8, 0xC2, 0x28, 0x65, 0xE8, 0xAA, 0x8F, 0x8B, 0x47, 0x00, 0xDA, 0x23, 0x00, 0x0C,
+    0x47, 0x00, 0x8C, 0xF4, 0xA7, 0x54, 0x1C, 0xAA, 0xE8, 0x9B, 0x80, 0xEB, 0x4A, 0x9C, 0xA2, 0xD0,
+    0xCF, 0xBD, 0x0E, 0x9D, 0xB4, 0xE2, 0x24, 0x05, 0x7B, 0x6B, 0x1D, 0x33, 0xB6, 0xD4, 0xAC, 0x46,
+    0x81, 0x71, 0xF2, 0x33, 0xC3, 0xE2, 0x32, 0x6E, 0xED, 0x4A, 0x75, 0xCB, 0x46, 0xB7, 0x4A, 0xC5,
+    0xE2, 0xBA, 0x7A, 0xDC, 0x0F, 0x0F, 0xB0, 0xC5, 0xCF, 0x18, 0xB5, 0x05, 0xE2, 0xA4, 0x84, 0x9F,
+    0xFB, 0x42, 0xFF, 0xA0, 0x51, 0x1A, 0x35, 0xFB, 0xDD, 0x2B, 0x37, 0x3A, 0xAF, 0xBD, 0xDF, 0xBB,
+    0xC4, 0x48, 0x53, 0x23, 0xAD, 0x8D, 0x7E, 0x63, 0x47, 0x78, 0xC6, 0xE4, 0x52, 0x9F, 0xED, 0xDC,
+    0x1E, 0x80, 0x32, 0x0C, 0x9A, 0x6A, 0x02, 0x33, 0x28, 0x81, 0x36, 0xE8, 0xC4, 0x4A, 0x4C, 0x2F,
+    0xD3, 0xE7, 0x61, 0x6A, 0x8B, 0x5B, 0xED, 0x61, 0x75, 0x5F, 0x44, 0x89, 0x46, 0xFB, 0x95, 0xEC,
+    0xCD, 0x49, 0xDA, 0x7B, 0x49, 0x65, 0x78, 0xA8, 0xBF, 0x28, 0xDE, 0xC8, 0x14, 0xDF, 0xC8, 0xAC,
+    0xCF, 0x35, 0x47, 0x93, 0x7F, 0xD2, 0xEE, 0x66, 0xC2, 0x16, 0x4E, 0x6B, 0xBD, 0x2B, 0x67, 0xFC,
+    0xAA, 0x6E, 0x2A, 0x9F, 0xA1, 0x6E, 0x58, 0xCE, 0xBE, 0xDF, 0xCF, 0x40, 0xFC, 0x36, 0x15, 0xD0,
+    0xDC, 0xA3, 0x04, 0xCF, 0x4A, 0x56, 0xF2, 0x5A, 0xBC, 0xE6, 0x71, 0x61, 0x9C, 0xDB, 0x82, 0x2D,
+    0xC4, 0xC4, 0x38, 0x75, 0x1B, 0xDD, 0x8A, 0x42, 0x8D, 0x69, 0x5D, 0x36, 0x82, 0x83, 0x21, 0xD3,
+    0xCF, 0xF6, 0xA0, 0xD9, 0xF1, 0x33, 0x43, 0xB2, 0x05, 0x5B, 0x18, 0x13, 0x7E, 0x6A, 0x0B, 0x5D,
+    0x66, 0x9C, 0x8D, 0x68, 0xF5, 0x7C, 0x9C, 0xF1, 0xD2, 0x06, 0xD2, 0x0E, 0x8D, 0x0E, 0xE0, 0x4A,
+    0x9C, 0x2D, 0x25, 0xAF, 0x7B, 0x3A, 0xD0, 0x6E, 0x34, 0x11, 0x53, 0x75, 0x4C, 0x6E, 0xA3, 0x9F,
+    0x19, 0x16, 0x04, 0x63, 0x6A, 0x57, 0x10, 0x7E, 0xC2, 0x16, 0x53, 0xC0, 0x65, 0xB7, 0xC0, 0x30,
+    0x47, 0x60, 0x7C, 0x61, 0x05, 0x73, 0x0C, 0x09, 0xEC, 0x56, 0x00, 0xF7, 0xC1, 0x02, 0x78, 0x9D,
+    0x92, 0x12, 0x30, 0x4A, 0x9C, 0xE0, 0x0E, 0xB7, 0xFC, 0x68, 0xE0, 0x3E, 0x68, 0x6D, 0x53, 0xAF,
+    0x6F, 0x68, 0xB3, 0xB9, 0x55, 0x1E, 0x17, 0xB3, 0x33, 0x2C, 0x6E, 0x43, 0xC1, 0x65, 0x7B, 0x30,
+    0xCE, 0x6D, 0x26, 0x4E, 0x7E, 0xB5, 0x1B, 0xC3, 0xD2, 0xEF, 0xA6, 0xD0, 0x6D, 0x4E, 0xD3, 0x81,
+    0x39, 0xDA, 0xFB, 0xCB, 0x08, 0xE3, 0x6B, 0x3F, 0xD8, 0xFC, 0x84, 0xFB, 0xE6, 0x76, 0xA7, 0x4F,
+    0xD8, 0x52, 0x86, 0x2F, 0x2E, 0xA0, 0x57, 0xBA, 0xF7, 0x33, 0xF8, 0xFB, 0xCF, 0x6B, 0x03, 0xA7,
+    0x34, 0x16, 0x68, 0x34, 0xF7, 0x07, 0x10, 0x73, 0x2B, 0x60, 0x58, 0xCF, 0x3E, 0xC9, 0x27, 0x30,
+    0x3B, 0x6E, 0xFE, 0xB1, 0xC4, 0xC2, 0x6B, 0x96, 0xF0, 0x4A, 0xDA, 0xE9, 0xAA, 0x7B, 0x11, 0x31,
+    0x60, 0x64, 0x76, 0x40, 0x7F, 0xB2, 0x02, 0xE3, 0x37, 0xAA, 0xCE, 0x13, 0x35, 0x9B, 0x38, 0x85,
+    0x7B, 0x27, 0x9A, 0xCA, 0x1F, 0x00, 0x87, 0x00, 0xBB, 0x69, 0x02, 0x97, 0xC7, 0x04, 0x3E, 0xF9,
+    0x05, 0x22, 0x7D, 0xA6, 0x39, 0xE8, 0x1F, 0x30, 0x68, 0x96, 0x26, 0xAF, 0x37, 0xCF, 0x21, 0x91,
+    0xD3, 0xEA, 0x75, 0x4F, 0xC5, 0x69, 0xF6, 0x99, 0x38, 0xB5, 0x05, 0x3F, 0xA1, 0xE0, 0x13, 0xC3,
+    0xD2, 0x27, 0x6C, 0x71, 0x33, 0xE8, 0xB3, 0x0B, 0x0C, 0xDF, 0xCD, 0x60, 0x2B, 0x58, 0xAC, 0xD4,
+    0x84, 0xBB, 0x9A, 0xA6, 0xA9, 0x33, 0x31, 0x71, 0x35, 0x2A, 0xEB, 0x8E, 0x40, 0xF5, 0xE2, 0x8F,
+    0x6D, 0x10, 0x2B, 0x29, 0x39, 0x49, 0x61, 0xBC, 0x79, 0x6B, 0x6F, 0x36, 0xE2, 0xD2, 0xA5, 0xF6,
+    0xA0, 0x67, 0xCC, 0xA7, 0x90, 0xD5, 0x67, 0xB0, 0x0A, 0x30, 0x6C, 0xA7, 0xAC, 0xAE, 0x2F, 0xA7,
+    0x90, 0xD6, 0x15, 0x7E, 0x87, 0x38, 0xDB, 0xDC, 0x1D, 0xF4, 0x69, 0x5C, 0x90, 0xD5, 0x4D, 0xAD,
+    0x4E, 0x52, 0x1A, 0x54, 0xCD, 0x0E, 0xB0, 0x4A, 0x8C, 0x85, 0x4E, 0x13, 0x07, 0xB8, 0x19, 0xB3,
+    0xFF, 0x28, 0x45, 0x35, 0x56, 0x22, 0xE7, 0xF4, 0xB8, 0x32, 0x58, 0x76, 0x03, 0x1F, 0x68, 0x73,
+    0x65, 0xB0, 0x7E, 0xEC, 0xB1, 0x66, 0xFC, 0x4E, 0x73, 0x73, 0xC2, 0x3F, 0x26, 0xB8, 0x02, 0xDD,
+    0xE3, 0x4F, 0x19, 0x4E, 0x64, 0x5A, 0x86, 0x1D, 0x86, 0xC7, 0x9F, 0x12, 0x6D, 0x6D, 0x70, 0x48,
+    0xD8, 0x15, 0x0E, 0xE8, 0x13, 0xE6, 0x12, 0xAB, 0x44, 0xAC, 0xC2, 0xFE, 0xB8, 0x60, 0xFF, 0x68,
+    0xB9, 0xAD, 0x66, 0xC6, 0x42, 0x73, 0x33, 0xC0, 0xB5, 0x1B, 0xF5, 0x6E, 0xBF, 0x82, 0x2F, 0xF5,
+    0xBC, 0xFD, 0x0A, 0x14, 0x8F, 0xD9, 0x7C, 0xB0, 0x6B, 0x9F, 0xDA, 0xEC, 0xE6, 0x6E, 0xE9, 0x16,
+    0x37, 0xB7, 0x79, 0x48, 0x76, 0x1B, 0xA6, 0x66, 0xBB, 0x79, 0xF3, 0xE6, 0x7F, 0x3B, 0x51, 0x25,
+    0x13, 0x80, 0x9D, 0x6E, 0xBB, 0x3C, 0xBE, 0xB9, 0xDB, 0xFC, 0x31, 0xCC, 0xE5, 0x05, 0xAD, 0xAE,
+    0xA7, 0x56, 0x5A, 0xDA, 0x63, 0xCC, 0xB6, 0xD8, 0xD2, 0xEC, 0x1C, 0x88, 0x31, 0x8C, 0x93, 0x4F,
+    0x43, 0xEA, 0xB3, 0xCB, 0x6E, 0xB3, 0xA5, 0xDD, 0x91, 0x55, 0xF0, 0xF7, 0xEE, 0x7F, 0xF7, 0x8B,
+    0xFA, 0x81, 0xBE, 0xA5, 0xAC, 0xC5, 0x2F, 0xFD, 0x5C, 0x01, 0xF0, 0x02, 0x5A, 0x25, 0x9C, 0x12,
+    0x17, 0x71, 0xAA, 0x6C, 0x5B, 0x3C, 0x85, 0x32, 0x87, 0x09, 0xA6, 0x0C, 0xAB, 0x29, 0x2A, 0xCD,
+    0x43, 0x15, 0xFB, 0xC1, 0xBD, 0xDD, 0xAA, 0xD9, 0xDB, 0xDD, 0x96, 0xAE, 0xD8, 0xE2, 0x56, 0x5B,
+    0x5C, 0x6E, 0x37, 0xB7, 0xB8, 0x3C, 0xCC, 0xFD, 0xE2, 0x67, 0x9F, 0xFC, 0x43, 0x85, 0x51, 0x3B,
+    0xAF, 0xC4, 0x05, 0x0C, 0xC0, 0x8B, 0x34, 0x9A, 0x5B, 0x95, 0x56, 0x87, 0x2D, 0xED, 0x89, 0x0C,
+    0x8D, 0x01, 0x9F, 0x4E, 0x7C, 0x24, 0xE2, 0x17, 0x7C, 0x1E, 0x9D, 0xF4, 0xBC, 0x14, 0xFA, 0xE3,
+    0xEC, 0x84, 0x2F, 0xC0, 0x68, 0x01, 0x15, 0x78, 0xF6, 0x38, 0x11, 0x81, 0x43, 0x02, 0x97, 0xB9,
+    0x78, 0x61, 0xA3, 0x3F, 0x76, 0x7A, 0x89, 0xFE, 0x81, 0x92, 0xCB, 0x6E, 0xE9, 0x56, 0xBB, 0xDA,
+    0x62, 0x8A, 0x39, 0x10, 0x91, 0x31, 0xF9, 0xE4, 0x17, 0x97, 0xFB, 0xD5, 0x16, 0xB7, 0x23, 0x17,
+    0xFF, 0xBB, 0xD7, 0x57, 0xF5, 0x05, 0xDD, 0xD3, 0xA4, 0x69, 0x0C, 0x95, 0xC8, 0x7D, 0x11, 0xE2,
+    0xCA, 0xA8, 0xD4, 0xBF, 0x5D, 0x6C, 0xEE, 0xD3, 0x61, 0x37, 0x97, 0x62, 0x53, 0x86, 0xE4, 0xEF,
+    0x67, 0xAB, 0x15, 0xFF, 0x6D, 0xEC, 0xC6, 0x97, 0x7D, 0x1A, 0x1B, 0x69, 0x71, 0x35, 0x10, 0x3A,
+    0x33, 0x1A, 0x6F, 0x40, 0x65, 0xE3, 0x6B, 0xD8, 0xDA, 0xE5, 0xDB, 0xC0, 0xD1, 0x04, 0x18, 0xE6,
+    0xF3, 0xD2, 0xAC, 0x71, 0xC0, 0xF5, 0xEA, 0x00, 0x15, 0x68, 0x6E, 0x3D, 0xBC, 0x71, 0xCE, 0x9B,
+    0xFB, 0x05, 0x30, 0x07, 0xFC, 0xF8, 0x17, 0xDA, 0x0D, 0x20, 0x06, 0xA0, 0x5B, 0x1F, 0x25, 0xDA,
+    0x2E, 0xFF, 0x03, 0x5F, 0x98, 0xFC, 0x04, 0xC3, 0xAF, 0x67, 0x2A, 0xE5, 0x72, 0x82, 0xA8, 0x58,
+    0x53, 0xF9, 0x4F, 0x04, 0x2A, 0xA1, 0xE3, 0x2A, 0xAB, 0x73, 0x5C, 0x32, 0x86, 0x08, 0x91, 0x08,
+    0x11, 0x41, 0x6C, 0x76, 0xF0, 0x7F, 0xB6, 0x41, 0xAF, 0xB9, 0x52, 0x39, 0x95, 0x0E, 0x18, 0x27,
+    0xC0, 0x6F, 0x60, 0xA2, 0x26, 0xDC, 0x43, 0xAD, 0x8C, 0xD3, 0x50, 0x10, 0x76, 0x47, 0x34, 0x3B,
+    0x9A, 0xDA, 0x52, 0x83, 0x8A, 0x5E, 0x9A, 0x30, 0xF1, 0xDB, 0xE7, 0x79, 0xCB, 0xA7, 0x79, 0xD3,
+    0xA9, 0x9D, 0x61, 0xAE, 0xC2, 0xDB, 0xED, 0x22, 0x98, 0xBD, 0xDF, 0x88, 0x83, 0x18, 0xEE, 0x6B,
+    0x76, 0xFA, 0xF5, 0x6C, 0xF5, 0x42, 0x31, 0x9A, 0x0E, 0x62, 0x1A, 0x83, 0x9F, 0x87, 0xE4, 0xB2,
+    0xCB, 0xED, 0x66, 0xB7, 0x66, 0x37, 0x3B, 0x0A, 0xF1, 0x37, 0x7D, 0xF2, 0xFA, 0x6C, 0x76, 0xFA,
+    0x93, 0xD5, 0x28, 0x9C, 0x62, 0x72, 0x97, 0xDC, 0xDA, 0xEE, 0x88, 0x9F, 0x02, 0x4C, 0x18, 0x36,
+    0xAF, 0x8B, 0x38, 0xF5, 0x73, 0x97, 0x6D, 0xE1, 0x20, 0x06, 0x9F, 0xDC, 0xD2, 0xAE, 0xCD, 0xFE,
+    0x07, 0x71, 0x1F, 0x8E, 0x76, 0x3F, 0x4F, 0x1A, 0xDC, 0xA9, 0x11, 0xBA, 0x15, 0x34, 0x3B, 0xF0,
+    0xA5, 0x7A, 0xDB, 0x5C, 0x42, 0x3C, 0x95, 0x58, 0x7E, 0x2B, 0x57, 0x79, 0x5D, 0xAE, 0xB3, 0x34,
+    0xCC, 0x75, 0x50, 0x7C, 0xAA, 0x34, 0xE4, 0x38, 0xD5, 0xC9, 0x51, 0x9D, 0x19, 0xB3, 0x57, 0xEE,
+    0xD2, 0x16, 0x7E, 0xBE, 0x5B, 0x79, 0xE5, 0xFA, 0x42, 0x54, 0x62, 0x14, 0xFC, 0xF4, 0x69, 0x4C,
+    0x7A, 0x81, 0x0A, 0xE6, 0x7A, 0x86, 0x71, 0xA2, 0x29, 0xB5, 0x71, 0x3F, 0x5D, 0x9A, 0x32, 0xE4,
+    0xF6, 0x07, 0x5A, 0x86, 0x3B, 0x63, 0xD2, 0x7C, 0xC7, 0xEE, 0x76, 0xED, 0x97, 0x21, 0xC5, 0xA6,
+    0xD8, 0x43, 0x93, 0xD3, 0xCC, 0x18, 0x43, 0x53, 0x22, 0x2E, 0x2B, 0xF8, 0x37, 0xF5, 0xED, 0xA3,
+    0xD1, 0xDF, 0xAD, 0x46, 0x40, 0xE0, 0xC2, 0x68, 0x51, 0x79, 0xF6, 0x60, 0x0C, 0x43, 0x72, 0xD9,
+    0x16, 0x73, 0x52, 0x3D, 0xDB, 0xCD, 0xEC, 0x44, 0x7C, 0x72, 0x4B, 0xBB, 0x35, 0x3B, 0xFA, 0x8F,
+    0x5E, 0x4E, 0xAF, 0x2A, 0x3C, 0x05, 0x2F, 0x72, 0xC9, 0x65, 0xAB, 0x4F, 0x1F, 0x56, 0x56, 0xEF,
+    0xE9, 0x2D, 0xA5, 0xCF, 0xBF, 0xAF, 0xF7, 0xB5, 0x1A, 0x7D, 0x53, 0x6F, 0x17, 0xC6, 0x1C, 0x17,
+    0x31, 0x64, 0x9F, 0x7D, 0x72, 0xAB, 0xCB, 0xFD, 0x62, 0x4B, 0x5B, 0xBA, 0xD5, 0x1C, 0xCD, 0x6E,
+    0x0B, 0x31, 0x88, 0x03, 0x9F, 0x7C, 0x1A, 0x83, 0xCB, 0xFD, 0x32, 0xBC, 0xFB, 0x99, 0xAD, 0x5B,
+    0x3B, 0xBD, 0xBD, 0x37, 0xA5, 0x51, 0x16, 0x07, 0xE3, 0x0C, 0x15, 0x00, 0x5E, 0xE4, 0xD2, 0x68,
+    0x89, 0xB3, 0x3F, 0xBC, 0xCC, 0xF5, 0xFB, 0xCA, 0x46, 0x59, 0xF4, 0xC5, 0x2D, 0x8D, 0xCC, 0x8E,
+    0x5F, 0x86, 0x64, 0x8B, 0x2D, 0x8C, 0xD3, 0x38, 0x75, 0x6B, 0xB7, 0x22, 0x84, 0xCB, 0xEE, 0xFB,
+    0x6F, 0x1E, 0xA8, 0x0C, 0xB3, 0xD3, 0x0B, 0xA5, 0x1A, 0x73, 0xA8, 0xEB, 0x75, 0x14, 0x9D, 0x44,
+    0xFC, 0xFA, 0xDE, 0x6E, 0x5D, 0xF1, 0xA9, 0xFF, 0xDE, 0x81, 0xFF, 0xCA, 0x8A, 0x7C, 0x6A, 0x37,
+    0x31, 0xBC, 0x53, 0x90, 0xCB, 0xED, 0xE6, 0xE7, 0x31, 0xC5, 0xEF, 0x16, 0xA4, 0x44, 0xDC, 0x6A,
+    0xAE, 0x6E, 0x2E, 0x2F, 0x42, 0xA3, 0x37, 0x35, 0x39, 0xFD, 0x96, 0xC2, 0xB3, 0x87, 0x0E, 0x5A,
+    0x7D, 0x66, 0x63, 0x58, 0xFB, 0x05, 0xA5, 0x71, 0xB2, 0xC5, 0x1C, 0xF4, 0x4B, 0xB7, 0x32, 0x06,
+    0x9F, 0x9A, 0x62, 0x0E, 0x5C, 0x76, 0x19, 0x3F, 0xC5, 0xC9, 0xE8, 0xFE, 0x46, 0x27, 0x4D, 0xF8,
+    0xFB, 0x2B, 0x1C, 0x4F, 0x9D, 0x56, 0xE9, 0x30, 0x9F, 0x96, 0x67, 0xA7, 0x2F, 0x55, 0x0A, 0xBD,
+    0xB9, 0xF9, 0x46, 0x35, 0xA8, 0x47, 0x20, 0x3D, 0xFF, 0x08, 0x48, 0xC7, 0x10, 0x83, 0x4F, 0xFE,
+    0x47, 0x40, 0x1A, 0x7F, 0xEF, 0x7E, 0x72, 0xFA, 0xBB, 0xDC, 0xE8, 0xFB, 0x1B, 0x7E, 0x39, 0x20,
+    0xF8, 0x50, 0x19, 0xF6, 0x2E, 0xD7, 0xE5, 0xDE, 0x69, 0xC6, 0x69, 0xA3, 0xB9, 0xF9, 0xE7, 0xF0,
+    0x8C, 0x09, 0xE3, 0xE6, 0xEF, 0xE9, 0x3D, 0x5D, 0x8C, 0xD7, 0x0B, 0xFB, 0x31, 0xB7, 0x0A, 0x0C,
+    0x1B, 0xC4, 0x54, 0x69, 0x86, 0x93, 0xB5, 0x9D, 0x68, 0x00, 0x9F, 0x30, 0xC7, 0x19, 0x51, 0x5E,
+    0xC4, 0x68, 0x63, 0x54, 0xEA, 0xBF, 0x56, 0x9A, 0xD2, 0x04, 0x3F, 0xD3, 0x68, 0xC2, 0xA9, 0x7A,
+    0xA8, 0xB8, 0xD0, 0xC8, 0x64, 0x97, 0x7D, 0x92, 0xD5, 0xAD, 0x79, 0xD0, 0xC6, 0xB8, 0xD7, 0xC5,
+    0xD7, 0x25, 0xDC, 0x42, 0xBB, 0xD1, 0xEC, 0x5C, 0x93, 0x9C, 0x74, 0xF7, 0xD6, 0xC3, 0x1B, 0xDD,
+    0x8A, 0xDD, 0x41, 0xE0, 0x13, 0xFD, 0x42, 0xB7, 0x56, 0x7C, 0x37, 0xC9, 0xFF, 0xCF, 0xD5, 0xA9,
+    0x58, 0x15, 0xC6, 0x15, 0x02, 0x5C, 0x72, 0x61, 0x34, 0xBB, 0xEC, 0x0F, 0x64, 0xAE, 0xCF, 0xFD,
+    0x62, 0x4A, 0xB3, 0x33, 0x24, 0x7F, 0x32, 0x86, 0x30, 0x4E, 0x5D, 0x76, 0x2B, 0x32, 0xC2, 0x2D,
+    0x3E, 0x9B, 0xBD, 0xD3, 0x53, 0xC3, 0xDD, 0xF7, 0xDF, 0xBF, 0xAB, 0x12, 0xCB, 0xA0, 0x56, 0x68,
+    0xF2, 0x13, 0x01, 0x30, 0xC1, 0x84, 0x38, 0xFB, 0x77, 0x95, 0xF4, 0x5F, 0x64, 0x64, 0x77, 0xBB,
+    0xB5, 0x6B, 0x3F, 0xF7, 0xCB, 0x88, 0x7F, 0x75, 0xE3, 0x70, 0xC9, 0x96, 0x3B, 0x74, 0x3F, 0xC8,
+    0x0C, 0x82, 0xB8, 0x62, 0x54, 0xAB, 0x6D, 0x7D, 0x85, 0x48, 0x13, 0x4C, 0xB8, 0x68, 0x64, 0x76,
+    0x5B, 0xE2, 0xE6, 0xF2, 0xF0, 0xB5, 0x98, 0xA2, 0x39, 0x6C, 0x69, 0x57, 0x37, 0xF7, 0xF3, 0x38,
+    0x15, 0xF6, 0x6E, 0xEB, 0x93, 0x5B, 0x74, 0x77, 0xE5, 0xE8, 0x8B, 0xA7, 0x7B, 0x4F, 0x6F, 0x2D,
+    0xC4, 0x97, 0x4B, 0xA1, 0xD5, 0x17, 0xEF, 0x07, 0xC6, 0xAC, 0x85, 0x76, 0x77, 0x05, 0xC6, 0x20,
+    0xB0, 0x4B, 0x97, 0xCE, 0x68, 0x73, 0xC1, 0x45, 0xE8, 0x57, 0x7B, 0xB4, 0x4A, 0x5A, 0xC6, 0x7D,
+    0xD8, 0xE9, 0xFF, 0x6E, 0xA9, 0x49, 0x4A, 0xAB, 0x53, 0xBA, 0xD0, 0xEC, 0xA7, 0xB8, 0xCB, 0x09,
+    0x9A, 0x0F, 0x36, 0xFE, 0xD5, 0x1D, 0x9F, 0xAC, 0xEE, 0x6A, 0x1B, 0x73, 0xAF, 0x17, 0x0A, 0x71,
+    0x3E, 0xF1, 0x10, 0x97, 0x5C, 0xD2, 0xED, 0x76, 0xA7, 0x57, 0x73, 0xF0, 0xAC, 0x8C, 0x20, 0x86,
+    0x03, 0xC6, 0xE7, 0x77, 0xF0, 0x7F, 0x5C, 0xC0, 0xBF, 0xBA, 0x81, 0x7F, 0x6D, 0x85, 0xE1, 0xAD,
+    0x0C, 0xC3, 0x57, 0x67, 0xE8, 0xBF, 0x31, 0x55, 0x08, 0xA2, 0xDF, 0xCF, 0x91, 0x63, 0xA5, 0xBE,
+    0x12, 0x30, 0xC2, 0xC7, 0xCC, 0x0E, 0xC3, 0xAD, 0x15, 0xBC, 0xD2, 0x29, 0x9C, 0xED, 0x16, 0x80,
+    0x67, 0xB8, 0x6C, 0xF5, 0x99, 0xEC, 0xA5, 0x37, 0xA5, 0xBD, 0x9D, 0xC7, 0xB9, 0x67, 0xE7, 0x19,
+    0x37, 0xC3, 0x5E, 0x83, 0xFD, 0xE3, 0x7C, 0xF9, 0x4B, 0xF7, 0xE0, 0x33, 0x59, 0xD2, 0x5B, 0x1F,
+    0x68, 0x77, 0x6F, 0x6A, 0x79, 0xC4, 0x9E, 0x8C, 0x09, 0x65, 0xE2, 0xDF, 0xE3, 0x03, 0x7D, 0xA2,
+    0x5B, 0xB0, 0x2B, 0xEC, 0xE0, 0x03, 0x2E, 0xD1, 0x66, 0xEC, 0x46, 0x57, 0xB0, 0x05, 0xC6, 0x5A,
+    0xB2, 0x2C, 0x70, 0x07, 0x3C, 0xF4, 0x89, 0x6E, 0xC6, 0xD6, 0x5B, 0xAF, 0xD4, 0x48, 0x4E, 0x09,
+    0x65, 0xBA, 0x53, 0x51, 0x67, 0xC7, 0x25, 0x53, 0x18, 0xA6, 0x66, 0xC3, 0x07, 0x9B, 0x19, 0xE9,
+    0x16, 0x4E, 0x2C, 0x7C, 0x9F, 0xCE, 0x77, 0x3D, 0x6D, 0xE6, 0xCE, 0xF9, 0xAE, 0x29, 0x0C, 0x93,
+    0x5D, 0xF9, 0xC4, 0x09, 0xFC, 0x15, 0x50, 0xE6, 0xDF, 0x1C, 0x30, 0x4C, 0x74, 0x33, 0x76, 0x85,
+    0xDA, 0x61, 0x95, 0xB1, 0x5B, 0x68, 0x56, 0xB8, 0x03, 0x7D, 0xA6, 0x32, 0xB0, 0xB6, 0x54, 0x1D,
+    0xA0, 0x4F, 0xB4, 0x8F, 0x65, 0x0E, 0xF4, 0xA9, 0xD1, 0x82, 0x16, 0x86, 0x1B, 0x60, 0x02, 0x46,
+    0xD3, 0xA7, 0xBC, 0x3E, 0xA3, 0x0F, 0x74, 0x94, 0x4E, 0x77, 0xA7, 0x9F, 0xAE, 0x29, 0xD2, 0xCF,
+    0xF2, 0x2B, 0x44, 0xB3, 0xDB, 0xD2, 0xAD, 0x7D, 0xF6, 0xF3, 0x98, 0x14, 0xE2, 0xF3, 0x07, 0x7A,
+    0x55, 0xF8, 0xA4, 0xE0, 0x16, 0x9F, 0xDA, 0xD5, 0x2D, 0xAC, 0xCD, 0x02, 0xD0, 0xCC, 0xED, 0xC4,
+    0x6E, 0x37, 0x86, 0xD9, 0x4F, 0x76, 0xEF, 0x36, 0xC6, 0xA4, 0xE0, 0xF2, 0x30, 0x77, 0x5B, 0x9F,
+    0xBB, 0xAD, 0xCF, 0xDD, 0xDA, 0x2F, 0xDD, 0xDA, 0x2F, 0x66, 0xB1, 0x4F, 0x66, 0x39, 0xFF, 0xB2,
+    0x4E, 0x03, 0xD4, 0x2A, 0xE2, 0x29, 0xC0, 0xC7, 0x44, 0x00, 0x7E, 0xF2, 0x4A, 0x19, 0xE2, 0x23,
+    0x62, 0xF5, 0x79, 0x5C, 0xF6, 0x06, 0x97, 0x1E, 0xC9, 0xE9, 0x37, 0x4E, 0x8C, 0x23, 0x1F, 0xE7,
+    0x9F, 0x8D, 0x98, 0x43, 0x1D, 0xC8, 0x9A, 0xDB, 0x02, 0x76, 0xDB, 0x01, 0x3F, 0x15, 0xE0, 0xF5,
+    0x2B, 0xBB, 0x18, 0x3E, 0x2A, 0x31, 0xCD, 0x8D, 0x5F, 0x04, 0x86, 0x7B, 0x05, 0x50, 0x9F, 0xC1,
+    0xAE, 0x1E, 0x30, 0x8F, 0x63, 0x20, 0xF8, 0x9D, 0x47, 0x01, 0x65, 0x65, 0xD2, 0xDB, 0x3A, 0xDE,
+    0x3B, 0x15, 0x81, 0xC0, 0x7D, 0x35, 0x03, 0x77, 0x7C, 0x82, 0x36, 0x47, 0xC0, 0x7F, 0x7A, 0x07,
+    0x53, 0xDA, 0x0D, 0xDC, 0xEC, 0x32, 0xC4, 0x97, 0xC6, 0x84, 0x55, 0xA5, 0x46, 0xB5, 0x63, 0xF6,
+    0x97, 0x3E, 0xBF, 0xE1, 0x16, 0x86, 0x4C, 0x84, 0x31, 0xB5, 0x85, 0x46, 0xFF, 0x59, 0x3B, 0x51,
+    0x5F, 0xD7, 0x6A, 0xA5, 0xFF, 0x8F, 0x65, 0x95, 0x4F, 0x9E, 0x87, 0xDE, 0xDC, 0x06, 0x9A, 0x0C,
+    0x0C, 0xA1, 0x96, 0x99, 0xAF, 0x9A, 0x52, 0x93, 0x38, 0xED, 0x21, 0xA8, 0x41, 0x4B, 0xF7, 0x38,
+    0xBA, 0xE6, 0xB7, 0x3F, 0xC2, 0x42, 0x09, 0xF0, 0x33, 0x9C, 0x64, 0x66, 0x5C, 0x4E, 0x44, 0x17,
+    0xF1, 0x06, 0x3C, 0xAE, 0x79, 0x7E, 0x34, 0x82, 0xB5, 0xF3, 0x23, 0x36, 0x4C, 0x09, 0xBA, 0xEF,
+    0x6F, 0xE0, 0xF2, 0x00, 0xCD, 0xDC, 0x84, 0x8F, 0x46, 0xB0, 0x6B, 0xD3, 0xEF, 0x40, 0xBB, 0x46,
+    0xB0, 0xBB, 0x4F, 0x70, 0xC7, 0xCD, 0xF0, 0x14, 0x4F, 0xEC, 0x74, 0x92, 0x54, 0xF0, 0x92, 0x30,
+    0xBA, 0x19, 0x27, 0x7C, 0x6A, 0x17, 0xFA, 0x6C, 0x56, 0xDA, 0xC2, 0x1F, 0xD2, 0x1C, 0x9C, 0xEA,
+    0x17, 0xF8, 0xBF, 0x7D, 0x83, 0x9A, 0xD2, 0x74, 0x52, 0x3A, 0xC1, 0x4F, 0x7D, 0x92, 0x08, 0xF4,
+    0x99, 0xBF, 0xA2, 0xDB, 0x78, 0x0E, 0xBB, 0xE3, 0x83, 0xD1, 0x77, 0x6B, 0x75, 0x2D, 0x5B, 0xE9,
+    0x5C, 0x34, 0xF9, 0x99, 0x6A, 0x54, 0xF6, 0xA8, 0x5E, 0xBE, 0x39, 0x9E, 0x30, 0xA7, 0x0F, 0xBD,
+    0x42, 0x33, 0x57, 0xAE, 0x43, 0x10, 0x33, 0xED, 0xFE, 0x84, 0x89, 0x7C, 0xD8, 0x9D, 0xF5, 0x01,
+    0xC6, 0x19, 0xA3, 0x95, 0xF6, 0x7B, 0x85, 0x21, 0xBD, 0xCC, 0xCF, 0xF2, 0x0B, 0x57, 0xC8, 0xB4,
+    0x15, 0xAF, 0x4C, 0x7B, 0xDA, 0xED, 0x60, 0x4B, 0x6D, 0xFD, 0xBC, 0xC5, 0xC1, 0xAD, 0xA7, 0xB4,
+    0x2A, 0xD7, 0x1E, 0xFD, 0x7C, 0x65, 0xCB, 0x43, 0xDD, 0xF6, 0x60, 0x34, 0xD3, 0x6B, 0xAB, 0x7D,
+    0x36, 0xD3, 0xEF, 0xE2, 0xBE, 0xB9, 0x33, 0xBC, 0xB7, 0xD3, 0xDF, 0xDD, 0x30, 0x57, 0x66, 0xF5,
+    0xC3, 0xEE, 0xEB, 0x4C, 0x9A, 0xAA, 0x0D, 0x40, 0xFC, 0x60, 0x01, 0x9E, 0x8B, 0x19, 0xE8, 0xDA,
+    0x95, 0x7F, 0xE8, 0xD0, 0xC6, 0xA8, 0xC9, 0x8B, 0x5E, 0xB3, 0xD1, 0x42, 0x0C, 0xF8, 0x42, 0x9F,
+    0x70, 0x9A, 0xBA, 0x85, 0x56, 0xD9, 0xAE, 0x34, 0xDA, 0x29, 0x70, 0x28, 0x8D, 0xE0, 0x7F, 0x6B,
+    0x1D, 0x12, 0xFD, 0xBD, 0xA3, 0x5B, 0xE8, 0xF2, 0x78, 0x6F, 0xA5, 0xD9, 0xDC, 0x56, 0x60, 0x6F,
+    0x34, 0x82, 0xC7, 0x2B, 0xD1, 0xA7, 0x4E, 0x0B, 0x5D, 0x46, 0x2B, 0x76, 0x63, 0x28, 0x98, 0x23,
+    0xB4, 0xA2, 0xD5, 0x86, 0xA6, 0x46, 0x3B, 0xFD, 0xA3, 0x0C, 0xEB, 0x74, 0x7C, 0x1C, 0xA0, 0xCD,
+    0xA7, 0x58, 0xA6, 0xB2, 0x77, 0x27, 0x06, 0xC1, 0x3C, 0xF2, 0x48, 0x1F, 0x45, 0x35, 0xE5, 0x74,
+    0xFC, 0xFE, 0x19, 0x67, 0x8D, 0x02, 0x58, 0x4D, 0x60, 0x8F, 0x00, 0xBC, 0xCE, 0x47, 0x2F, 0xDD,
+    0x00, 0x75, 0xF3, 0x4D, 0xF5, 0xE7, 0xC3, 0x57, 0x97, 0x93, 0x3B, 0xEF, 0xC2, 0x4F, 0x7C, 0x94,
+    0xD2, 0x7D, 0xB2, 0xB9, 0x01, 0xFD, 0x3B, 0x05, 0x5C, 0x16, 0xD8, 0xCD, 0x07, 0x78, 0xFA, 0xF1,
+    0xAC, 0xFF, 0x5E, 0x80, 0x56, 0x0A, 0x38, 0x69, 0xA5, 0xD7, 0x2D, 0xE1, 0x76, 0xE2, 0xE2, 0x0A,
+    0xAE, 0x74, 0x3B, 0x8D, 0x5E, 0x10, 0x8C, 0x7F, 0xA3, 0x40, 0xBF, 0xC5, 0x44, 0xBB, 0xFB, 0x8C,
+    0xD1, 0x67, 0x0B, 0xC4, 0x77, 0x04, 0x3E, 0x2B, 0xE1, 0x36, 0x9F, 0xE9, 0x76, 0x57, 0xB0, 0x6A,
+    0x34, 0x59, 0xE1, 0xB7, 0x56, 0xA1, 0x93, 0x14, 0xAA, 0x57, 0xBD, 0xA6, 0x07, 0x4F, 0x1A, 0x5B,
+    0xCB, 0x23, 0xAF, 0xE9, 0xAA, 0x9D, 0x2D, 0x8F, 0xAC, 0xED, 0x49, 0xB7, 0xF9, 0xD1, 0x55, 0x3D,
+    0xCE, 0x36, 0x37, 0x4C, 0xE7, 0x8C, 0xA7, 0xD3, 0xA3, 0xB8, 0xF2, 0x49, 0x17, 0xFA, 0x51, 0x0A,
+    0xD9, 0x07, 0x4E, 0xAC, 0x9B, 0xA9, 0x1E, 0x7E, 0x48, 0x30, 0xA4, 0xBF, 0x86, 0x66, 0x79, 0xC2,
+    0x9D, 0x7E, 0x34, 0x42, 0xFE, 0xEE, 0xB5, 0x09, 0xFA, 0x6F, 0xED, 0xD0, 0xEC, 0x3E, 0xC1, 0x70,
+    0x6F, 0x03, 0xC2, 0x53, 0xFF, 0x3C, 0x86, 0xEF, 0xF7, 0x01, 0x7F, 0x62, 0x52, 0xED, 0x99, 0xB9,
+    0x34, 0x19, 0xF8, 0xD8, 0xE9, 0x8D, 0x17, 0x4D, 0x30, 0xFA, 0x7A, 0x36, 0xD2, 0x66, 0xF4, 0x5F,
+    0x0B, 0x42, 0xC4, 0xE0, 0x27, 0x9F, 0xFA, 0xB9, 0x5F, 0x5C, 0xEE, 0x72, 0x5B, 0x6C, 0xB1, 0x07,
+    0x32, 0x0A, 0x3E, 0x69, 0x76, 0xF9, 0x83, 0x87, 0xEF, 0xA9, 0x68, 0x8B, 0xC5, 0x6F, 0x6E, 0x6B,
+    0xD7, 0x33, 0x50, 0xFC, 0xDC, 0x09, 0x27, 0xDC, 0x89, 0xCB, 0x6C, 0x33, 0xD8, 0x5C, 0xF7, 0x56,
+    0x3F, 0x3A, 0x3E, 0xB4, 0xEE, 0x3E, 0x7E, 0xDA, 0x54, 0xD0, 0x09, 0xDA, 0xEF, 0xCE, 0xB4, 0xCB,
+    0x46, 0x9B, 0x7B, 0xF8, 0x52, 0x73, 0xA6, 0x2B, 0x3F, 0xA4, 0x12, 0x00, 0x00, 0xDB, 0x10, 0x50,
+    0xBF, 0xE0, 0xBF, 0x90, 0x69, 0xA7, 0xC7, 0x90, 0xCC, 0x45, 0x78, 0x86, 0x7E, 0x8F, 0xF4, 0xD2,
+    0x74, 0xA2, 0xDA, 0x73, 0xB7, 0xDA, 0xCD, 0x16, 0xB3, 0xFF, 0x5F, 0x52, 0xED, 0xFF, 0x98, 0x42,
+    0xC0, 0x4F, 0xC1, 0x50, 0xEB, 0x3B, 0xCF, 0x81, 0x87, 0xF8, 0x78, 0xE9, 0x7E, 0x19, 0xFA, 0x09,
+    0xF3, 0x98, 0xDA, 0xE2, 0xAF, 0x1F, 0x6D, 0xFC, 0xBD, 0x08, 0x74, 0x0A, 0xAD, 0x8A, 0xD9, 0x87,
+    0xE4, 0x4D, 0x71, 0x8B, 0x9F, 0x4A, 0x97, 0x87, 0xBB, 0xC5, 0x1E, 0xC2, 0x2B, 0xD8, 0x23, 0xE0,
+    0xA7, 0xCE, 0x96, 0x36, 0x0F, 0x3A, 0x90, 0x42, 0xAB, 0xE9, 0x84, 0x70, 0x01, 0xBA, 0x04, 0x63,
+    0x8D, 0x27, 0x86, 0x04, 0x05, 0x6C, 0x7A, 0xC4, 0x66, 0x98, 0x4B, 0x88, 0x2B, 0xBD, 0xB2, 0xD9,
+    0x87, 0xE4, 0xD2, 0xC8, 0x61, 0x37, 0x9B, 0x87, 0x34, 0xDC, 0x2D, 0x28, 0x26, 0xAB, 0x15, 0xF7,
+    0x00, 0xFC, 0xD4, 0x21, 0x53, 0x1A, 0x69, 0xB1, 0xDA, 0x69, 0x35, 0x9D, 0xAA, 0xCE, 0xBF, 0x08,
+    0x2E, 0x63, 0x35, 0x71, 0xBB, 0xD0, 0xBF, 0xB6, 0xB4, 0xCB, 0xA7, 0xF8, 0xF9, 0xD3, 0x64, 0xFC,
+    0xD3, 0x2A, 0x12, 0xBC, 0xD2, 0x25, 0x5B, 0x62, 0x70, 0xDF, 0x2A, 0xFC, 0xB2, 0x7D, 0x9C, 0x88,
+    0x7E, 0x02, 0x3A, 0x05, 0x23, 0xD1, 0xBF, 0x5D, 0x28, 0x6D, 0x76, 0x8B, 0x9F, 0x7C, 0x53, 0x9A,
+    0x32, 0x24, 0xF7, 0x41, 0xC1, 0x2B, 0xA0, 0x1B, 0xD8, 0x8D, 0x2F, 0xBB, 0xDC, 0xA7, 0x41, 0x07,
+    0x5E, 0x33, 0xE3, 0x76, 0x52, 0xDA, 0x4E, 0x6E, 0x76, 0xB9, 0xDD, 0xCC, 0xCE, 0x73, 0x7C, 0x0C,
+    0xB8, 0x1C, 0x36, 0x95, 0xCF, 0x6F, 0xED, 0xDA, 0x65, 0x97, 0xDD, 0x32, 0xCC, 0x3E, 0xF9, 0x69,
+    0x0C, 0xF1, 0x37, 0xE3, 0x1E, 0xB7, 0x71, 0x7E, 0x0A, 0x08, 0xD8, 0x99, 0x61, 0x32, 0x3B, 0x6E,
+    0xE1, 0x0E, 0xCD, 0x89, 0x91, 0x30, 0xA1, 0xD1, 0xE4, 0xC5, 0xE7, 0x37, 0xFA, 0x99, 0x88, 0x2D,
+    0xB8, 0x85, 0x18, 0xEA, 0x75, 0x0C, 0xCD, 0xFE, 0x07, 0x9D, 0xE6, 0xE1, 0x60, 0x9C, 0x79, 0x1A,
+    0xF8, 0x24, 0xE6, 0xA0, 0x2F, 0xEC, 0x9B, 0xBB, 0x9B, 0x77, 0xFB, 0x37, 0xD3, 0x45, 0x85, 0x80,
+    0xB8, 0x38, 0xA5, 0x67, 0x0F, 0xDA, 0x95, 0x21, 0x21, 0xEC, 0xC6, 0x30, 0xD7, 0x6B, 0x3F, 0x13,
+    0x7F, 0xB3, 0xD1, 0xDA, 0x69, 0xEA, 0xD7, 0xD3, 0xAC, 0x0D, 0xF6, 0x9B, 0xBB, 0xFF, 0x4A, 0x3E,
+    0x3E, 0xDE, 0x9C, 0xCA, 0xD3, 0xCF, 0x30, 0x6C, 0x56, 0xF9, 0x22, 0x4E, 0x66, 0xA7, 0xCB, 0xF8,
+    0xC4, 0x41, 0xB7, 0xD6, 0x6B, 0xBB, 0x32, 0xBC, 0x1B, 0xE2, 0xDE, 0x68, 0x69, 0xF7, 0x6A, 0x16,
+    0xAF, 0x7F, 0x0C, 0xC6, 0xB7, 0x97, 0x5A, 0xD5, 0xCF, 0x4A, 0x5C, 0x34, 0xCB, 0xD5, 0x65, 0x72,
+    0x41, 0x7F, 0x74, 0xBB, 0xD5, 0x7B, 0xCA, 0xCF, 0x1E, 0x12, 0xBD, 0x5C, 0x36, 0x4A, 0x07, 0x43,
+    0xEE, 0x67, 0x7B, 0x34, 0x05, 0x9F, 0x7C, 0x6A, 0xB7, 0x76, 0x23, 0x86, 0x18, 0xDC, 0x69, 0x57,
+    0xED, 0x2F, 0xF5, 0x8B, 0xD3, 0xDD, 0x1D, 0xAD, 0x3E, 0x75, 0xDB, 0xE3, 0x0D, 0x47, 0xED, 0x09,
+    0xD9, 0x8E, 0xCA, 0x0E, 0x36, 0x05, 0xCC, 0xCA, 0x79, 0xB7, 0xA9, 0xB9, 0xC4, 0xA8, 0x30, 0xA8,
+    0x34, 0xBA, 0xBE, 0xF6, 0xCB, 0x90, 0xC5, 0xF8, 0xD6, 0x86, 0x86, 0xD9, 0x16, 0xD1, 0xBF, 0x57,
+    0x88, 0x9F, 0xCD, 0xB6, 0xF8, 0xD4, 0x2F, 0x7A, 0x5E, 0x8D, 0x6E, 0x65, 0x2B, 0xD1, 0x68, 0x39,
+    0xA3, 0xE7, 0xCF, 0x01, 0x7F, 0x54, 0x7D, 0x78, 0x53, 0x6A, 0x5A, 0xEC, 0x66, 0x70, 0x57, 0xB1,
+    0xAC, 0xEE, 0xE3, 0x8E, 0xCA, 0x8D, 0xAE, 0xAF, 0xED, 0xD6, 0x15, 0x97, 0xDB, 0xD2, 0x2F, 0xB6,
+    0x0C, 0xB3, 0x2D, 0x3E, 0xB5, 0x9B, 0x4F, 0xDD, 0xEA, 0x93, 0xCB, 0x3E, 0xF5, 0x8B, 0x9F, 0xC7,
+    0x34, 0x3C, 0x14, 0xAE, 0xEE, 0x5E, 0x3A, 0x6D, 0x8E, 0xFB, 0xF8, 0x04, 0xAA, 0xFB, 0xAB, 0x5F,
+    0xB9, 0x4D, 0x9B, 0x0B, 0xDE, 0x64, 0x7E, 0xBB, 0x79, 0xD4, 0xC3, 0x3F, 0x85, 0xCE, 0x07, 0xB0,
+    0xF9, 0x65, 0xDC, 0xF7, 0x0E, 0xDC, 0xF7, 0xF6, 0x27, 0x81, 0xEB, 0xC3, 0x90, 0x1E, 0xE0, 0x97,
+    0x80, 0x76, 0x39, 0x05, 0x37, 0xB6, 0x9C, 0x37, 0x38, 0x0C, 0x57, 0x1C, 0xD1, 0x05, 0x5C, 0xF6,
+    0x3B, 0xB2, 0x5A, 0x5C, 0x7E, 0x76, 0x37, 0x07, 0x7D, 0x1A, 0xE6, 0xA6, 0xD8, 0xD3, 0x9C, 0xAF,
+    0xED, 0x46, 0x44, 0xC1, 0xE5, 0x3E, 0x73, 0x58, 0xD1, 0xCF, 0x31, 0x7F, 0xBA, 0x0C, 0xE3, 0x1F,
+    0x0D, 0xFA, 0x8A, 0xEE, 0x2A, 0x8F, 0xD9, 0x6D, 0x76, 0x3B, 0x4F, 0xFD, 0xD3, 0xD4, 0x7F, 0x07,
+    0x32, 0xE5, 0x44, 0xD0, 0x76, 0x19, 0x28, 0x9C, 0x66, 0x27, 0xFC, 0xBF, 0xE8, 0xF4, 0xE3, 0x67,
+    0xE5, 0xB4, 0xC0, 0x30, 0x42, 0xF7, 0xCD, 0x0D, 0xB3, 0x75, 0x13, 0x3F, 0x71, 0xC6, 0x96, 0x0F,
+    0x93, 0xB3, 0xAF, 0xC7, 0xCB, 0x5D, 0xC2, 0x7D, 0x7F, 0xC7, 0xEC, 0x43, 0xA2, 0x7B, 0xFE, 0xEA,
+    0x72, 0xFA, 0x50, 0x95, 0x33, 0x2F, 0x9E, 0xB6, 0xA1, 0x48, 0x5A, 0x88, 0x92, 0xB4, 0x11, 0x8F,
+    0xFF, 0x70, 0xDC, 0xDC, 0xD1, 0x62, 0xC4, 0x40, 0x9C, 0x89, 0x53, 0x97, 0xC6, 0x19, 0x3F, 0x37,
+    0xB3, 0xCF, 0xE7, 0x82, 0xBD, 0xAD, 0xD9, 0xA4, 0xD1, 0x6F, 0x7C, 0xC9, 0x1E, 0x95, 0x9D, 0x50,
+    0xC0, 0xEB, 0xC0, 0xCF, 0x35, 0xBD, 0x5C, 0x69, 0x0B, 0xD8, 0xA3, 0xD6, 0x65, 0x95, 0x88, 0xC1,
+    0xCE, 0xC3, 0x86, 0x4F, 0xCD, 0x6A, 0x35, 0xF5, 0x99, 0x42, 0x94, 0x8E, 0x5B, 0xA2, 0x93, 0x54,
+    0xF7, 0xCC, 0x4B, 0x4A, 0x9C, 0xB9, 0x67, 0x5E, 0xE4, 0x22, 0xD0, 0x2B, 0xC4, 0x95, 0xA8, 0x77,
+    0x55, 0x1A, 0x5D, 0xD7, 0x3B, 0xA5, 0xDD, 0x3A, 0x35, 0xC5, 0xE5, 0x76, 0xB7, 0x5B, 0xBF, 0xD8,
+    0xD2, 0xE5, 0x61, 0xB6, 0x9B, 0x4F, 0x3E, 0xB5, 0x0F, 0x0F, 0x7C, 0xEA, 0xB4, 0xE2, 0x93, 0x3B,
+    0xC0, 0xA7, 0x7E, 0xE5, 0xCB, 0x7E, 0x1E, 0x4B, 0x9B, 0x87, 0x87, 0x92, 0x16, 0xA7, 0x07, 0x52,
+    0xB0, 0x9A, 0xAB, 0x6F, 0x30, 0x20, 0xE9, 0xFD, 0xD3, 0x6E, 0x82, 0xA0, 0x7F, 0xE8, 0x28, 0x3C,
+    0xDD, 0xCE, 0xA3, 0xCD, 0xC3, 0xB4, 0xB7, 0xB9, 0x9F, 0xC7, 0xE9, 0x12, 0x2E, 0x6D, 0xB1, 0xA5,
+    0x29, 0x76, 0xB3, 0xB9, 0x5B, 0x5C, 0xF2, 0x3C, 0x05, 0x4F, 0x1B, 0x5E, 0x6E, 0x97, 0xB1, 0xCD,
+    0xDE, 0xAE, 0xC3, 0x1F, 0x17, 0x37, 0xEF, 0x6D, 0x1E, 0x9F, 0xDF, 0xFB, 0x79, 0x7C, 0x6D, 0xBB,
+    0xE0, 0x34, 0xD2, 0xAF, 0x6E, 0xB6, 0xF8, 0x34, 0xDC, 0x2D, 0x4D, 0x19, 0x92, 0x7F, 0x61, 0x6D,
+    0xF3, 0x48, 0x71, 0xF3, 0xF0, 0xE9, 0xD5, 0x4C, 0x67, 0xFF, 0xDD, 0x2E, 0xDC, 0xC6, 0xBD, 0x55,
+    0x88, 0x93, 0xFB, 0x5F, 0xC2, 0x2F, 0x76, 0x1F, 0x83, 0xCB, 0x1C, 0x17, 0x70, 0xC9, 0x05, 0xFF,
+    0x1B, 0xCD, 0x98, 0x31, 0xCC, 0x27, 0x47, 0x79, 0xC6, 0x7F, 0xB3, 0x73, 0x77, 0x0B, 0x59, 0x89,
+    0xA1, 0x30, 0x08, 0x05, 0x91, 0x4D, 0x91, 0x48, 0x89, 0x44, 0xB2, 0x29, 0x52, 0x45, 0xC9, 0xCD,
+    0xDA, 0x87, 0x44, 0x24, 0x0A, 0xBE, 0xE2, 0x2E, 0x91, 0x70, 0xE1, 0x28, 0x4A, 0x13, 0x8A, 0x7C,
+    0x6D, 0x0A, 0x60, 0x96, 0xB8, 0xA0, 0xA0, 0xE0, 0x8A, 0x84, 0x86, 0x82, 0x14, 0x4E, 0x14, 0x9F,
+    0xA5, 0x1C, 0x25, 0x05, 0xB9, 0x9D, 0xB3, 0x0B, 0x17, 0x14, 0xAC, 0x6C, 0x22, 0xA4, 0x50, 0xB0,
+    0x60, 0x93, 0x48, 0xA6, 0xB8, 0x01, 0x36, 0xF2, 0xDE, 0xDD, 0xCC, 0x3C, 0x29, 0xF6, 0xFF, 0x9D,
+    0xEF, 0x00, 0x23, 0x45, 0xA1, 0xC8, 0x16, 0xFB, 0xD7, 0x6A, 0x76, 0xFF, 0xF3, 0xBE, 0x33, 0xCF,
+    0xFB, 0x3C, 0xEF, 0x33, 0x70, 0x65, 0xFA, 0x2B, 0x68, 0xB7, 0x19, 0x6C, 0xF1, 0x11, 0xEE, 0xB8,
+    0x05, 0x2E, 0x31, 0xF2, 0xD8, 0x25, 0x29, 0xE3, 0x25, 0x61, 0x74, 0x6B, 0x9E, 0xF0, 0xB1, 0x5D,
+    0xE9, 0x93, 0xD9, 0x68, 0x33, 0x7F, 0x4B, 0x53, 0x01, 0x34, 0x02, 0xFE, 0x87, 0x2F, 0x42, 0x2F,
+    0x4D, 0x74, 0x52, 0xC4, 0x3E, 0x36, 0x12, 0x19, 0xE9, 0x13, 0x5F, 0xA7, 0xDB, 0xB9, 0x8A, 0x2D,
+    0xF8, 0xD1, 0xE8, 0x47, 0x8A, 0xAD, 0xA4, 0x64, 0x25, 0x6D, 0x00, 0x57, 0x46, 0x00, 0x01, 0x74,
+    0x19, 0x20, 0x6C, 0x80, 0xD5, 0x02, 0x0C, 0xF3, 0x04, 0x64, 0x01, 0xDD, 0x1B, 0x19, 0x08, 0x5D,
+    0x02, 0xBB, 0x0D, 0x0B, 0xF4, 0x31, 0x4C, 0x50, 0x10, 0x74, 0xFF, 0xFD, 0xE7, 0x19, 0xBC, 0x94,
+    0xB0, 0x92, 0x16, 0xFA, 0x7F, 0xBF, 0x31, 0x4F, 0x54, 0x1A, 0xD1, 0x25, 0xDA, 0x4C, 0x88, 0x0C,
+    0xF7, 0x7B, 0x2D, 0x9D, 0xCA, 0xAC, 0xD1, 0x2B, 0x1D, 0x69, 0x7A, 0xA9, 0xE0, 0xA5, 0x4C, 0x5B,
+    0x5F, 0xCA, 0xD8, 0x4C, 0xA6, 0xCD, 0xEC, 0xB4, 0xBB, 0x59, 0xE9, 0x36, 0xC0, 0x25, 0xC0, 0xD5,
+    0x17, 0xA0, 0x97, 0x46, 0x06, 0x69, 0xC5, 0x2F, 0xC3, 0x86, 0x8F, 0x6E, 0xC7, 0xC7, 0x6E, 0x27,
+    0xC4, 0x6E, 0x67, 0x9E, 0x5C, 0x42, 0xE3, 0x90, 0x8C, 0x6E, 0x29, 0xF6, 0x52, 0xC5, 0x4B, 0xEB,
+    0xC5, 0x82, 0x7E, 0xEA, 0x05, 0x98, 0x55, 0x71, 0x92, 0xF8, 0x23, 0x7D, 0xA2, 0x62, 0x73, 0x9B,
+    0xE9, 0x93, 0x4B, 0x84, 0xC9, 0x4F, 0x4D, 0x31, 0x05, 0xB7, 0xB9, 0x84, 0x7F, 0x20, 0x8C, 0xB4,
+    0xD3, 0x49, 0x3B, 0x7E, 0xF1, 0x1B, 0xC2, 0xAF, 0x36, 0x33, 0x4F, 0x7D, 0x6A, 0x2A, 0xF3, 0xE4,
+    0x92, 0x2D, 0xCC, 0x53, 0xFF, 0xE0, 0x76, 0x6E, 0x25, 0x4D, 0x8F, 0x4F, 0x74, 0x4A, 0xAB, 0x1E,
+    0xB7, 0x56, 0x2F, 0x15, 0x6C, 0x39, 0xD2, 0x3A, 0xE5, 0xD6, 0xED, 0x24, 0xDC, 0xA3, 0xDC, 0xFA,
+    0x04, 0x0C, 0x09, 0xF0, 0x2B, 0xE0, 0x97, 0x63, 0xEB, 0x20, 0x44, 0x60, 0x8E, 0x80, 0x26, 0x30,
+    0xFA, 0x36, 0xF4, 0xCA, 0xE0, 0x95, 0x9F, 0x98, 0x4A, 0x0B, 0xBD, 0xA4, 0x04, 0xE1, 0x9F, 0x35,
+    0x81, 0x8B, 0x7E, 0x81, 0x36, 0xB9, 0x04, 0xCD, 0xDE, 0x66, 0xA0, 0x34, 0x15, 0xF0, 0xCC, 0x23,
+    0x0C, 0x93, 0x5F, 0xC0, 0x45, 0x97, 0xA0, 0x4D, 0x6D, 0x06, 0xBB, 0x35, 0x15, 0x4C, 0x46, 0x23,
+    0x14, 0x7C, 0x84, 0x19, 0x97, 0xC0, 0x8F, 0x6D, 0x06, 0x3F, 0x35, 0x15, 0x33, 0xBF, 0x75, 0x4B,
+    0xDF, 0x46, 0x92, 0x44, 0x90, 0xA4, 0x38, 0x44, 0x70, 0xEB, 0x01, 0x88, 0x66, 0x03, 0x93, 0xF9,
+    0x06, 0xF0, 0x59, 0x06, 0xA0, 0xA7, 0x1B, 0xA1, 0x9D, 0x4E, 0x61, 0x3A, 0x49, 0xD1, 0x4A, 0x4A,
+    0xF4, 0x0F, 0x5E, 0xDA, 0xB1, 0x99, 0xCF, 0x61, 0x44, 0x3F, 0x12, 0x62, 0x3B, 0x31, 0xAC, 0x70,
+    0xAC, 0x89, 0xAD, 0x9F, 0xBA, 0x79, 0xAC, 0x3F, 0xB3, 0xF2, 0x69, 0x51, 0x8E, 0x91, 0xCC, 0x25,
+    0x8C, 0xE8, 0x26, 0xE6, 0xC9, 0xAE, 0xF8, 0xC5, 0x6E, 0xF4, 0x75, 0xCE, 0x04, 0x49, 0x78, 0x49,
+    0x23, 0x5C, 0x99, 0x00, 0xFE, 0x9A, 0xB6, 0xA0, 0x8A, 0x62, 0xA3, 0x18, 0x34, 0x6A, 0x23, 0xEC,
+    0x4D, 0x41, 0x99, 0x4B, 0x81, 0x99, 0xF9, 0xBD, 0xD0, 0x2D, 0x3E, 0x06, 0x80, 0xDD, 0xAD, 0x1E,
+    0xC0, 0xB7, 0xDB, 0x30, 0x02, 0xDD, 0xCB, 0xB9, 0x9F, 0x00, 0x73, 0x5F, 0xCF, 0xC5, 0x53, 0x35,
+    0xAE, 0x00, 0xBA, 0x77, 0x2C, 0xFD, 0xFC, 0x85, 0x2D, 0x8C, 0xC0, 0xFC, 0x72, 0x76, 0x09, 0x08,
+    0x51, 0x36, 0x03, 0x61, 0xF5, 0x53, 0x98, 0x20, 0x24, 0xB7, 0xBA, 0x0D, 0x42, 0x6A, 0xB7, 0x46,
+    0x30, 0xA7, 0xA6, 0xE0, 0x57, 0xB4, 0x75, 0x4A, 0x5D, 0x65, 0x48, 0x56, 0x3B, 0xF3, 0x74, 0xD4,
+    0xBC, 0x01, 0xF8, 0xF4, 0x48, 0x77, 0xC0, 0x73, 0xB5, 0xF7, 0x9F, 0xCB, 0x64, 0x23, 0x3E, 0x8B,
+    0x8F, 0xEF, 0xC3, 0x25, 0xE8, 0x76, 0x68, 0x33, 0xCD, 0xED, 0x1D, 0x54, 0xC1, 0x2B, 0x41, 0x5F,
+    0x4E, 0xD0, 0xF0, 0xEB, 0x47, 0x71, 0xFB, 0x80, 0xCD, 0x2E, 0xB5, 0xD5, 0x1E, 0x3B, 0x54, 0x69,
+    0x74, 0x1F, 0xCC, 0xF8, 0x38, 0xA9, 0xC4, 0x63, 0x17, 0xAC, 0x2A, 0x46, 0x93, 0xD1, 0x84, 0x2D,
+    0xD8, 0x02, 0x7D, 0x62, 0x48, 0x10, 0xA2, 0x55, 0xA4, 0xA9, 0xF8, 0x0A, 0x6E, 0x6B, 0xB5, 0x81,
+    0x8F, 0xF3, 0x1C, 0x31, 0xEA, 0x7E, 0x2C, 0xE8, 0xB2, 0xBA, 0x0C, 0x5E, 0xC9, 0xAF, 0xA0, 0x8A,
+    0x46, 0xAC, 0x16, 0x9B, 0xA1, 0x2F, 0xF4, 0x09, 0xE6, 0xC8, 0x3C, 0x61, 0x2B, 0xB6, 0x42, 0x7F,
+    0x9F, 0xE1, 0x3E, 0xAD, 0x6A, 0xA7, 0x82, 0xD7, 0xF6, 0xA8, 0xF0, 0x47, 0xC0, 0x8C, 0x2D, 0xC0,
+    0xC0, 0x1F, 0x03, 0xD4, 0x76, 0x05, 0x1A, 0x09, 0xA0, 0xD1, 0x02, 0xC0, 0x75, 0x7E, 0xF6, 0xFA,
+    0x7F, 0x94, 0xC3, 0x0B, 0x78, 0xA5, 0xAE, 0xE0, 0xB5, 0x0E, 0x95, 0xB6, 0x32, 0x67, 0x6C, 0x36,
+    0xE5, 0x43, 0xB4, 0xD9, 0x6E, 0xD0, 0x66, 0xB7, 0x40, 0xB7, 0xF7, 0x13, 0xB8, 0xCD, 0x03, 0xEE,
+    0x41, 0xE6, 0x54, 0xC4, 0x0C, 0x0F, 0x0B, 0xE0, 0xD7, 0x0A, 0xF8, 0x45, 0x80, 0x8F, 0x61, 0x82,
+    0x10, 0x7D, 0x84, 0x79, 0x1A, 0x56, 0xD0, 0xD8, 0x27, 0x8C, 0x6E, 0xBA, 0x4C, 0xAF, 0xAD, 0x15,
+    0x5E, 0xC9, 0x68, 0x04, 0x78, 0xFF, 0x13, 0x0C, 0x10, 0xE9, 0x0F, 0x8C, 0x5E, 0x30, 0x40, 0x88,
+    0xD0, 0xA6, 0x3E, 0x41, 0xB3, 0x77, 0x3B, 0x90, 0x6D, 0x01, 0x3C, 0x02, 0xFA, 0x29, 0x44, 0x70,
+    0xCB, 0x90, 0xC0, 0x26, 0xB7, 0x43, 0xB3, 0xDB, 0x02, 0x64, 0x04, 0xDC, 0x21, 0x44, 0xF0, 0x0C,
+    0x09, 0xFC, 0xE4, 0x76, 0x5C, 0x88, 0xB6, 0xD0, 0x6A, 0xB9, 0xA2, 0x9B, 0x46, 0x8B, 0x53, 0xC1,
+    0x2F, 0xAD, 0x74, 0x20, 0xF7, 0x9D, 0xCB, 0x69, 0x21, 0x54, 0x9C, 0x56, 0x94, 0x69, 0xB4, 0x36,
+    0x5A, 0x68, 0xB4, 0x5A, 0x45, 0xAC, 0x52, 0xA7, 0x48, 0xAB, 0xE4, 0xEE, 0x45, 0xBA, 0xEF, 0xA6,
+    0x21, 0x44, 0xDC, 0x37, 0xD3, 0x55, 0x1F, 0x71, 0xAF, 0x6E, 0xD9, 0x47, 0x86, 0xE7, 0xEF, 0xEF,
+    0x3E, 0xE2, 0xAF, 0x3D, 0x4C, 0x7E, 0xC2, 0x5B, 0xAD, 0x61, 0xE2, 0x73, 0x8D, 0x62, 0x98, 0x28,
+    0x8D, 0xC6, 0x30, 0x91, 0x8D, 0x98, 0x27, 0x93, 0x29, 0xCC, 0x63, 0xB3, 0x93, 0x99, 0xC7, 0x76,
+    0xE7, 0xCC, 0x68, 0xF1, 0x1A, 0xE9, 0xB5, 0xCD, 0x82, 0xE1, 0x62, 0x87, 0xDE, 0x1D, 0x2E, 0x19,
+    0xFA, 0x44, 0x9F, 0x20, 0x44, 0xE6, 0x89, 0xE6, 0xD8, 0x6B, 0xB7, 0xE1, 0x36, 0xF0, 0x6F, 0xDD,
+    0x9A, 0x23, 0x46, 0x92, 0xA0, 0x93, 0xB4, 0x83, 0x5F, 0xF1, 0x0B, 0x68, 0x44, 0x23, 0x36, 0xD3,
+    0xE6, 0x47, 0x88, 0x7B, 0x07, 0x2E, 0xE5, 0xDD, 0xE0, 0x72, 0xE5, 0x05, 0x20, 0x68, 0x03, 0x49,
+    0xA3, 0xD1, 0x03, 0x25, 0xB4, 0x74, 0x15, 0x45, 0x14, 0xE7, 0x85, 0x61, 0xF3, 0x89, 0xB6, 0xF4,
+    0x1B, 0x46, 0x5F, 0xCC, 0x10, 0x5E, 0x17, 0xF4, 0x9B, 0x22, 0x5D, 0xF1, 0x09, 0x2B, 0x97, 0x41,
+    0xCF, 0x0B, 0xE6, 0x45, 0x11, 0x9F, 0x86, 0x1D, 0x9F, 0xAC, 0xA6, 0xB0, 0x31, 0x4B, 0x1B, 0x9D,
+    0x94, 0xE0, 0x5C, 0x37, 0x9F, 0x00, 0x07, 0x56, 0x3A, 0x69, 0xAC, 0x14, 0x09, 0xF5, 0x25, 0x45,
+    0x6C, 0xC1, 0x6D, 0x10, 0x22, 0x82, 0x36, 0x1F, 0x90, 0x9F, 0x1A, 0x81, 0xDB, 0xF0, 0x2B, 0x68,
+    0x3C, 0xD5, 0x93, 0x8F, 0x34, 0xA2, 0x3D, 0x68, 0x78, 0x9E, 0xB0, 0x05, 0xB7, 0x83, 0x8F, 0x68,
+    0x7C, 0xF4, 0x65, 0x34, 0x02, 0xB7, 0x33, 0xAC, 0x18, 0xDD, 0x6C, 0x35, 0x1A, 0xE9, 0x0B, 0xAA,
+    0x78, 0x6D, 0xB3, 0x96, 0x93, 0xF6, 0x0E, 0xD2, 0x82, 0xA4, 0x8D, 0x87, 0xF5, 0x3C, 0x63, 0x73,
+    0x57, 0x68, 0xB3, 0xAD, 0xC7, 0xAD, 0xDB, 0x6D, 0xC1, 0x6D, 0x6D, 0xC6, 0x25, 0xB7, 0xD3, 0xA7,
+    0x90, 0x18, 0xA4, 0x09, 0xAF, 0x02, 0xFE, 0xAD, 0xF1, 0x09, 0x49, 0x9C, 0x1E, 0x49, 0xE2, 0xF2,
+    0xA4, 0x24, 0x5E, 0x79, 0x11, 0x1A, 0x69, 0x61, 0x96, 0xA6, 0x4E, 0xB7, 0x2A, 0x5A, 0x9B, 0xAD,
+    0xCB, 0x87, 0x24, 0x5E, 0x6D, 0x2A, 0x9C, 0xB9, 0xED, 0xF4, 0x3F, 0x8D, 0x00, 0x97, 0x2F, 0x74,
+    0x57, 0x11, 0xAC, 0x00, 0x57, 0xE0, 0x2F, 0x86, 0x4C, 0x17, 0x7D, 0xFD, 0xB3, 0xCA, 0x2C, 0x25,
+    0x66, 0x09, 0x82, 0x96, 0xC7, 0xF8, 0xD4, 0x49, 0x2A, 0xBD, 0xA4, 0x3C, 0x3C, 0xD0, 0x4B, 0xD9,
+    0x1B, 0x99, 0xEC, 0x1B, 0x99, 0xED, 0x6A, 0x53, 0x9B, 0xF4, 0x21, 0x5B, 0xCC, 0x84, 0xCD, 0x40,
+    0x9B, 0x2F, 0x3A, 0x2B, 0xB7, 0x5F, 0x48, 0xD9, 0x63, 0xC2, 0xBF, 0x3E, 0x21, 0xFC, 0xF3, 0x9B,
+    0xE0, 0x54, 0xC0, 0x3D, 0x12, 0xF9, 0x4E, 0xD9, 0xE9, 0x75, 0x15, 0xAB, 0xD4, 0xEF, 0x0C, 0x8B,
+    0xAD, 0xB8, 0x85, 0x79, 0xEA, 0x12, 0x7D, 0x6A, 0x13, 0x36, 0xDB, 0x0D, 0xE6, 0x67, 0x32, 0xF4,
+    0x6B, 0x06, 0x9B, 0x0B, 0x30, 0x07, 0xA0, 0x17, 0x60, 0x35, 0x9E, 0xD2, 0x63, 0x88, 0xF0, 0x7E,
+    0xB7, 0xC0, 0x6F, 0xF4, 0x2B, 0x74, 0x5A, 0xC1, 0x6A, 0x05, 0xC2, 0x72, 0xA1, 0x43, 0x80, 0xD7,
+    0x02, 0x9D, 0x32, 0xF0, 0xE1, 0x02, 0x30, 0x8F, 0x60, 0x66, 0xDD, 0xA4, 0x95, 0x14, 0x1B, 0xDD,
+    0x7E, 0x28, 0xE6, 0xBB, 0xD5, 0xED, 0x7D, 0x1A, 0x96, 0xF0, 0x4A, 0xB1, 0xD9, 0x66, 0x1F, 0x7D,
+    0xF4, 0xAF, 0xE4, 0x76, 0x6F, 0xB3, 0x8F, 0x61, 0xD4, 0xB5, 0xD2, 0xA5, 0x21, 0x0D, 0x9B, 0xFA,
+    0x8C, 0xA4, 0x8A, 0x91, 0x2A, 0x70, 0xBE, 0x1E, 0x4A, 0x0E, 0x8D, 0x32, 0x30, 0x6B, 0x81, 0xCB,
+    0x37, 0xAE, 0x3F, 0x46, 0x67, 0x8B, 0x84, 0x57, 0x54, 0xA1, 0xAB, 0xF8, 0x05, 0x2B, 0xE6, 0x11,
+    0x23, 0x53, 0x00, 0x7D, 0x61, 0x03, 0xC2, 0xF7, 0x56, 0xC0, 0x6B, 0x02, 0xFA, 0xCA, 0xC5, 0x46,
+    0xD2, 0x67, 0x00, 0x5F, 0x01, 0xAA, 0x00, 0xBB, 0x6B, 0x02, 0x97, 0x42, 0x04, 0x1F, 0xFD, 0x0A,
+    0x33, 0x7D, 0xA2, 0xA9, 0xF4, 0xF7, 0x19, 0xB4, 0x48, 0x93, 0xD7, 0x5D, 0x69, 0x7C, 0xA7, 0x5C,
+    0x9C, 0x32, 0x5E, 0xAB, 0x34, 0x11, 0xD6, 0x13, 0x5F, 0xB8, 0x04, 0x21, 0x9A, 0xA3, 0x5C, 0x86,
+    0x15, 0xE6, 0xE9, 0x44, 0x17, 0x7E, 0x01, 0x5D, 0x90, 0xC1, 0x1C, 0x69, 0x44, 0x77, 0xB0, 0x85,
+    0xC6, 0x8B, 0x2F, 0xFD, 0xA3, 0x2F, 0xD3, 0x93, 0x5F, 0x1A, 0xBD, 0x75, 0xBB, 0x8E, 0xE6, 0x68,
+    0xAA, 0xBC, 0x8E, 0x26, 0x0E, 0x28, 0x00, 0xF4, 0x11, 0xC0, 0xEC, 0x00, 0x0C, 0x23, 0x40, 0x73,
+    0x8C, 0x7F, 0xE4, 0x11, 0x06, 0x73, 0xD0, 0x1B, 0x2A, 0x83, 0x52, 0xBF, 0x1B, 0x2D, 0x36, 0x33,
+    0xAC, 0x46, 0xB8, 0x8D, 0x79, 0x7A, 0xF4, 0xB0, 0x33, 0xC7, 0x46, 0xF8, 0x95, 0xF9, 0xFE, 0xF9,
+    0x86, 0x93, 0x32, 0x48, 0x02, 0xF3, 0x4F, 0xF3, 0xC4, 0xE3, 0x2D, 0x56, 0x9B, 0x01, 0x23, 0x4E,
+    0xB5, 0xD5, 0x4A, 0x60, 0xA5, 0xE9, 0x71, 0x8E, 0xDF, 0x54, 0xBD, 0xA2, 0x55, 0x0E, 0xEA, 0xB5,
+    0xD2, 0x6F, 0xB6, 0xA2, 0x09, 0x9B, 0x11, 0x3E, 0x62, 0x84, 0x8F, 0x2E, 0x41, 0x98, 0xFA, 0xD4,
+    0x66, 0x18, 0x96, 0x6E, 0x6F, 0x2A, 0xB8, 0x64, 0xCB, 0x89, 0x3B, 0x2F, 0x5E, 0x0C, 0xF1, 0xA0,
+    0x9E, 0x7E, 0xED, 0x76, 0xF0, 0x4B, 0xB7, 0x35, 0xE5, 0x97, 0xBE, 0x38, 0x9C, 0x5E, 0x74, 0x9B,
+    0x2D, 0xD0, 0x3F, 0x78, 0xA9, 0xDE, 0xD2, 0xCD, 0xA3, 0x1D, 0xBD, 0x20, 0xB9, 0xA3, 0x81, 0x78,
+    0xD7, 0x68, 0xF7, 0x77, 0x8F, 0x76, 0x7D, 0x22, 0xDA, 0xED, 0x97, 0x04, 0xD1, 0x5E, 0x44, 0x5B,
+    0xFF, 0xD7, 0xD1, 0xFE, 0xFD, 0x29, 0x5A, 0x5D, 0x44, 0x1B, 0x4F, 0x91, 0x9E, 0x0C, 0x44, 0x7B,
+    0x92, 0x2E, 0x73, 0x51, 0xFE, 0x9F, 0x3D, 0xFD, 0x0E, 0xA7, 0xDF, 0x8B, 0x96, 0xDA, 0x4B, 0xC9,
+    0x48, 0x1A, 0xBB, 0x07, 0x5A, 0xF0, 0x4D, 0x85, 0xEC, 0x36, 0xEC, 0xEA, 0x23, 0x57, 0x10, 0xD0,
+    0xEE, 0xC0, 0xF0, 0xE0, 0x26, 0x48, 0x3B, 0x56, 0xCA, 0xF4, 0x69, 0xD8, 0x08, 0xD3, 0x90, 0x9A,
+    0x42, 0x88, 0x6E, 0x6B, 0x2A, 0x3E, 0xBA, 0xCD, 0x88, 0x39, 0xF6, 0xF5, 0x76, 0xB1, 0x92, 0x96,
+    0x5E, 0x7A, 0xF3, 0xE7, 0xBA, 0xAE, 0x05, 0x69, 0xB1, 0x12, 0x56, 0xC2, 0x68, 0xC2, 0x28, 0x62,
+    0x33, 0x17, 0x9D, 0xD7, 0x51, 0x22, 0x13, 0x84, 0x48, 0x53, 0xE0, 0x58, 0x9A, 0x83, 0xF3, 0xFC,
+    0x5B, 0xE3, 0x81, 0x76, 0x25, 0x23, 0xE8, 0xAA, 0x52, 0x9B, 0xC1, 0x2F, 0x7E, 0x1D, 0x56, 0x10,
+    0x21, 0x6A, 0xC4, 0x66, 0xA3, 0xE3, 0xCF, 0xDA, 0x7C, 0xB1, 0x7E, 0x73, 0xC4, 0x16, 0x23, 0x5B,
+    0xA1, 0x7F, 0x30, 0xEF, 0x7D, 0xA1, 0x95, 0x74, 0xED, 0x70, 0x57, 0x37, 0x87, 0xC3, 0xC0, 0xFE,
+    0x4C, 0x9C, 0x56, 0x02, 0xA3, 0xE9, 0x44, 0x33, 0x7D, 0xE2, 0x08, 0xAC, 0x29, 0x17, 0x28, 0xF7,
+    0x0F, 0x6E, 0x62, 0x4E, 0x9A, 0xB9, 0x1F, 0x66, 0xF2, 0x17, 0x3B, 0xBC, 0xF8, 0x8B, 0x1C, 0x9E,
+    0xF9, 0xF4, 0x88, 0x91, 0x12, 0x4E, 0xDA, 0xF0, 0xFF, 0x30, 0x27, 0x32, 0xF3, 0xDA, 0x2E, 0x28,
+    0xBA, 0xA3, 0x78, 0xDA, 0xD3, 0x54, 0x97, 0x6F, 0x84, 0x85, 0x20, 0x8D, 0x46, 0x2A, 0x98, 0x1B,
+    0xE7, 0xE9, 0xC4, 0xC4, 0x6D, 0x31, 0x11, 0x9F, 0x86, 0xA9, 0xD1, 0xA8, 0x71, 0xD8, 0xAD, 0xA4,
+    0xA9, 0x95, 0x36, 0x1A, 0x15, 0xE0, 0xA9, 0x8B, 0x84, 0x7E, 0xFD, 0x26, 0x78, 0xA5, 0xF6, 0x68,
+    0xFA, 0x57, 0x2F, 0x45, 0xDA, 0x8A, 0x1E, 0x28, 0x61, 0xB3, 0xD5, 0xE8, 0x37, 0x6C, 0xEE, 0x32,
+    0x6E, 0xA7, 0xCD, 0x6E, 0xC3, 0x65, 0xBA, 0x7D, 0x48, 0x74, 0x19, 0xB7, 0xF9, 0x95, 0x2E, 0xE3,
+    0xEE, 0xCF, 0x0B, 0x5D, 0xC6, 0x49, 0x91, 0x2E, 0xD3, 0x4B, 0x11, 0x97, 0x19, 0xD6, 0x39, 0xE2,
+    0x76, 0xFC, 0x32, 0x47, 0xFA, 0x0D, 0x1F, 0xE7, 0xC8, 0x90, 0x08, 0x31, 0x2C, 0x84, 0x85, 0x79,
+    0xF2, 0x09, 0x45, 0xE6, 0xD1, 0xEF, 0xAD, 0x30, 0xBA, 0xE9, 0xA4, 0x53, 0x27, 0xAA, 0x15, 0xAF,
+    0xC4, 0x5C, 0x0F, 0xE2, 0x7C, 0xDC, 0x65, 0x9C, 0x9F, 0xDA, 0xD1, 0x8A, 0xD1, 0x0F, 0x35, 0xE1,
+    0x76, 0x9B, 0x61, 0x8E, 0x2E, 0xD1, 0x54, 0x42, 0xC4, 0xED, 0x4D, 0x85, 0x21, 0x1D, 0x0E, 0xC9,
+    0x47, 0x0E, 0x79, 0x25, 0x68, 0x07, 0xEA, 0xBC, 0x42, 0x97, 0x34, 0x82, 0xB7, 0x19, 0xEC, 0x7E,
+    0x50, 0x68, 0x98, 0xF8, 0x4A, 0x69, 0x0A, 0xAD, 0xD6, 0xFE, 0x3E, 0x7D, 0x6D, 0x55, 0xF0, 0xCB,
+    0xA0, 0x74, 0xD1, 0xED, 0x98, 0xB3, 0xCB, 0xB4, 0x3A, 0x8F, 0xAD, 0xB4, 0xB6, 0x35, 0x24, 0x9B,
+    0x6D, 0x6E, 0x0A, 0x15, 0x11, 0xC6, 0x30, 0xF9, 0x38, 0xC4, 0x3E, 0xB9, 0xE4, 0x76, 0x9B, 0xDB,
+    0x82, 0xAC, 0x46, 0xFF, 0xCA, 0xBD, 0x1F, 0x7D, 0x49, 0x3F, 0xD5, 0x0F, 0x94, 0xB4, 0xFA, 0xB5,
+    0x5F, 0x9E, 0x38, 0x83, 0xF9, 0xE8, 0xE1, 0xBE, 0x1B, 0x65, 0x8C, 0x34, 0x32, 0xD7, 0x91, 0xE1,
+    0xCD, 0x53, 0x85, 0x66, 0x60, 0xF8, 0xFC, 0x19, 0xF6, 0x27, 0x5A, 0xB8, 0x23, 0xE1, 0x74, 0xBE,
+    0x1B, 0x4D, 0x21, 0x0E, 0xC9, 0x66, 0x5B, 0xF0, 0xD1, 0x47, 0xBB, 0xDB, 0x4C, 0x18, 0x7D, 0x74,
+    0xC9, 0x66, 0x53, 0xF1, 0x8B, 0x8F, 0x8D, 0x6E, 0x6F, 0x87, 0xC2, 0x0F, 0x15, 0xB8, 0x04, 0xC0,
+    0x0D, 0x18, 0x34, 0xB6, 0x12, 0xE1, 0x99, 0x6C, 0x53, 0x9B, 0xFC, 0xE8, 0x3F, 0x9F, 0xDB, 0xDC,
+    0x3D, 0xD4, 0xE2, 0xA5, 0xA5, 0x8E, 0xE1, 0x95, 0x0D, 0xB9, 0xD5, 0xEE, 0x3E, 0xFA, 0x38, 0x7F,
+    0xA7, 0x20, 0x2D, 0x46, 0xFB, 0x81, 0x94, 0xCB, 0x67, 0x9C, 0x6B, 0x0C, 0x4A, 0xFE, 0xCB, 0xC5,
+    0x11, 0x46, 0xFC, 0x42, 0x48, 0xCC, 0x6B, 0xA3, 0xC5, 0x6A, 0xB4, 0x15, 0x53, 0xF9, 0xC3, 0x30,
+    0x85, 0xFE, 0x81, 0xAE, 0x49, 0xE3, 0x50, 0x8F, 0x16, 0xF1, 0xCA, 0x0B, 0x10, 0x34, 0x19, 0x69,
+    0x6D, 0xD6, 0x61, 0x63, 0x3C, 0xD9, 0xCC, 0xA3, 0xAE, 0x33, 0x9D, 0x32, 0x41, 0xD9, 0xE8, 0x76,
+    0xB6, 0xD9, 0x66, 0x97, 0x6C, 0xEE, 0x57, 0x9B, 0x87, 0xD8, 0xEE, 0x3E, 0x76, 0x9B, 0x8F, 0x2E,
+    0xF9, 0xE8, 0x56, 0x1F, 0x87, 0xE8, 0x97, 0x79, 0x1C, 0x1E, 0x56, 0x9C, 0xF6, 0xE3, 0xE8, 0xE8,
+    0xA9, 0x93, 0x7D, 0x9B, 0x37, 0x82, 0x62, 0xFF, 0x5A, 0xB6, 0xA9, 0x8F, 0xD5, 0xEE, 0x2E, 0xCE,
+    0x4D, 0x1E, 0xA2, 0xBF, 0x97, 0xAC, 0x36, 0xFC, 0x9B, 0xD8, 0x9D, 0xAF, 0xF9, 0x18, 0x1A, 0x69,
+    0x75, 0xDA, 0x08, 0xFB, 0x11, 0xDB, 0x65, 0x0C, 0x97, 0xC7, 0xAE, 0x34, 0x5B, 0x5B, 0xAD, 0x92,
+    0x6F, 0x94, 0x66, 0x5D, 0x4B, 0xA1, 0xBA, 0x6B, 0xFB, 0x1D, 0x17, 0xC7, 0xB3, 0xE1, 0xAB, 0xAF,
+    0x27, 0x68, 0x1E, 0xE6, 0x3B, 0xC0, 0xA0, 0xEF, 0x45, 0x0E, 0x8A, 0x03, 0x7F, 0xAE, 0x08, 0xED,
+    0x1B, 0x25, 0x03, 0xD9, 0x3F, 0x17, 0x7F, 0xF3, 0x0F, 0x7C, 0xFB, 0xFD, 0xDA, 0x7F, 0x42, 0xCB,
+    0xBF, 0x39, 0x25, 0xED, 0x2E, 0x2A, 0xB7, 0x85, 0xDD, 0xD6, 0xD3, 0xFA, 0x83, 0xB9, 0x8E, 0xD5,
+    0x66, 0xA4, 0xE8, 0xBF, 0x5C, 0xEC, 0xE4, 0x16, 0x4C, 0x86, 0x30, 0x1A, 0x2D, 0xF8, 0x8A, 0x79,
+    0x76, 0x07, 0x1F, 0x6F, 0xDA, 0x3C, 0x10, 0x9E, 0x2F, 0xE7, 0xC9, 0x2B, 0x33, 0x97, 0x23, 0xD4,
+    0x33, 0x2E, 0x1B, 0x2D, 0x2E, 0xF9, 0x8A, 0xCC, 0xF9, 0xD2, 0xAF, 0x26, 0x37, 0x85, 0x21, 0xFA,
+    0x68, 0xB3, 0xCD, 0x84, 0x31, 0x4C, 0x5D, 0x72, 0x1B, 0x32, 0xC2, 0xAD, 0x3E, 0x99, 0xD2, 0xE9,
+    0xD2, 0xF0, 0xF2, 0xDB, 0x6F, 0xBF, 0xAC, 0x3C, 0xE7, 0x41, 0xAD, 0xD0, 0xE4, 0xA7, 0x27, 0xC0,
+    0x37, 0xD1, 0x4D, 0x1F, 0x81, 0x6C, 0x23, 0xEE, 0x3F, 0x4F, 0xA6, 0xDF, 0xDC, 0x39, 0x0D, 0xFE,
+    0x4A, 0x27, 0xBC, 0xCE, 0x53, 0xAD, 0xA6, 0xF0, 0x8A, 0xD6, 0x39, 0x3D, 0xBB, 0xCD, 0xBB, 0xC9,
+    0x61, 0x24, 0x78, 0x18, 0x6E, 0x83, 0xBB, 0x17, 0xB1, 0x4A, 0x18, 0x15, 0x98, 0x87, 0x88, 0x7F,
+    0x75, 0x7B, 0xBF, 0x4B, 0xFA, 0xFD, 0x76, 0xEF, 0xF5, 0x4C, 0xB1, 0x8A, 0x22, 0x4C, 0x17, 0xAD,
+    0xE3, 0x8D, 0x33, 0x18, 0x14, 0xB1, 0x2A, 0x30, 0x7C, 0x35, 0x61, 0x76, 0x1F, 0xE9, 0x62, 0x85,
+    0xAB, 0xED, 0x86, 0xD9, 0x86, 0x88, 0xBB, 0x78, 0x6A, 0x8E, 0x27, 0xF1, 0xBB, 0x77, 0x6C, 0xFE,
+    0x9A, 0x92, 0xD3, 0x2B, 0x1A, 0x7D, 0x71, 0x1B, 0x9A, 0x0E, 0x0B, 0x63, 0xCE, 0xB8, 0x3C, 0x32,
+    0x67, 0xFC, 0x86, 0x84, 0x12, 0x4E, 0x8D, 0x56, 0xDC, 0x7C, 0xED, 0xDE, 0x82, 0x3B, 0xFF, 0xE2,
+    0xB7, 0x22, 0xFD, 0x73, 0x5F, 0x7A, 0x2E, 0xD2, 0xF7, 0xF7, 0x86, 0xC8, 0xD0, 0x97, 0x61, 0xE2,
+    0xAA, 0xCB, 0x7E, 0xE4, 0x4F, 0xDC, 0xE6, 0x47, 0xBE, 0xE1, 0x92, 0x7F, 0xCF, 0x6F, 0x65, 0xB7,
+    0x86, 0xCF, 0xF8, 0xCD, 0xC5, 0x90, 0x7D, 0x72, 0x31, 0x24, 0x1F, 0xDF, 0x8B, 0x9F, 0x2E, 0x1D,
+    0xE5, 0x77, 0x1D, 0x8C, 0xD6, 0x6E, 0xF3, 0x62, 0x7E, 0xFA, 0x7C, 0x75, 0xC9, 0x54, 0x44, 0xBF,
+    0xF4, 0x6B, 0x93, 0x9B, 0x82, 0x3F, 0xEC, 0x63, 0x26, 0xDC, 0x9A, 0xA7, 0x6E, 0x6B, 0x37, 0xC4,
+    0x8C, 0x4B, 0xEE, 0x27, 0x77, 0x2B, 0xCA, 0xC3, 0xE2, 0x74, 0x2D, 0x33, 0xDF, 0x3C, 0x9D, 0x69,
+    0x5C, 0x87, 0x20, 0x3A, 0x89, 0xF9, 0xBB, 0xA5, 0xDD, 0xBB, 0xEC, 0x63, 0xFF, 0xE3, 0x8A, 0xFF,
+    0xE6, 0x86, 0x7C, 0x6C, 0x77, 0x31, 0xBC, 0x9E, 0x91, 0x4B, 0xED, 0xEE, 0x97, 0x10, 0xE7, 0x1F,
+    0x65, 0xA4, 0xC8, 0x7C, 0xAA, 0xE4, 0xEB, 0x9C, 0x19, 0xAD, 0xF3, 0xE2, 0xAB, 0x97, 0x39, 0xBF,
+    0xA7, 0x64, 0x94, 0x44, 0x9F, 0xDD, 0xDA, 0xC8, 0x14, 0xFC, 0x3A, 0x9C, 0xB6, 0x78, 0x0A, 0x53,
+    0xB7, 0x75, 0x1B, 0x42, 0x3F, 0x1F, 0xCC, 0x74, 0x04, 0x63, 0xCE, 0x2E, 0x8F, 0x8D, 0xEE, 0x6A,
+    0x72, 0x7A, 0x4E, 0xE3, 0x07, 0xAB, 0x2A, 0xAD, 0x3E, 0xBE, 0x33, 0x6C, 0xFD, 0x8A, 0x62, 0x98,
+    0x6C, 0x36, 0x95, 0x7E, 0xED, 0x36, 0xC2, 0xE8, 0x63, 0x93, 0x4D, 0xC5, 0x25, 0x97, 0xF0, 0xD3,
+    0x3C, 0x19, 0xDD, 0xDB, 0xE9, 0xA4, 0x09, 0x7F, 0x6F, 0x83, 0x7A, 0xE9, 0xA2, 0x9F, 0x58, 0x4E,
+    0x87, 0xC5, 0x9D, 0xFE, 0x11, 0xA4, 0x48, 0x73, 0xEB, 0xC5, 0xD3, 0x59, 0x4D, 0xA3, 0xA5, 0x55,
+    0x6E, 0x55, 0x6D, 0x6E, 0x9B, 0x0C, 0x15, 0xE6, 0x11, 0x1F, 0x71, 0x09, 0x9B, 0x41, 0xFC, 0x8E,
+    0x4F, 0xC1, 0x49, 0x4F, 0x4B, 0x63, 0x7F, 0x22, 0xA1, 0xEB, 0x9C, 0x71, 0xD6, 0xEA, 0x99, 0x6A,
+    0x65, 0xF5, 0x86, 0x5E, 0x55, 0x7C, 0xF6, 0x6D, 0xBD, 0xAD, 0xCD, 0xE8, 0xFB, 0x7A, 0x2D, 0x13,
+    0xD2, 0xBC, 0x8A, 0x21, 0xF9, 0xE4, 0xA3, 0xDB, 0x5C, 0xEA, 0x57, 0x9B, 0xDB, 0xDC, 0x6D, 0xA6,
+    0x36, 0xC5, 0x66, 0xE6, 0x51, 0x54, 0x7C, 0xF4, 0x31, 0x8C, 0x2E, 0xF5, 0xEB, 0xF0, 0x9D, 0x8F,
+    0xEF, 0xDD, 0xD6, 0xE9, 0xB5, 0xD2, 0xE4, 0x46, 0x49, 0xD4, 0xC3, 0xDB, 0x1C, 0x08, 0x3D, 0xE3,
+    0x8C, 0xAE, 0xD8, 0x42, 0xAF, 0xA6, 0xF2, 0x41, 0x19, 0xC1, 0x3C, 0x56, 0x08, 0x4F, 0x17, 0xF0,
+    0x9F, 0xCF, 0xE0, 0xFF, 0x6E, 0x07, 0xFF, 0xFC, 0x06, 0xC3, 0xAB, 0x09, 0x86, 0x6F, 0x2D, 0xD0,
+    0x7F, 0x6F, 0x3A, 0x79, 0xA9, 0xBE, 0x00, 0xFD, 0x7E, 0xD1, 0x56, 0x1C, 0x9E, 0x14, 0xDE, 0x63,
+    0x0A, 0x0C, 0xB7, 0x37, 0xF0, 0x8A, 0x27, 0xFF, 0xD1, 0xAD, 0x17, 0xB2, 0x04, 0x0C, 0x99, 0xA3,
+    0x86, 0x9B, 0x72, 0x07, 0x6C, 0xFA, 0xD0, 0x69, 0xDC, 0x2D, 0xA7, 0x5B, 0xAB, 0x3A, 0x12, 0xA4,
+    0xB5, 0xD1, 0x7C, 0x6F, 0xEF, 0xF2, 0xF0, 0x7C, 0x71, 0xC9, 0x3F, 0x5D, 0x87, 0xC5, 0x8F, 0xF2,
+    0xD1, 0x23, 0x1F, 0x03, 0xD5, 0xC7, 0x60, 0x8A, 0x8F, 0x77, 0x6C, 0xF6, 0x4B, 0xE9, 0xF6, 0x3E,
+    0x95, 0x21, 0x75, 0x87, 0x29, 0x53, 0x85, 0x0F, 0xEB, 0x26, 0x34, 0x3B, 0x60, 0x37, 0xC0, 0x26,
+    0x78, 0x5F, 0xB7, 0x1E, 0x45, 0x79, 0x24, 0xD0, 0xBE, 0x09, 0x70, 0x99, 0xCB, 0x63, 0xBF, 0xD9,
+    0xDA, 0x2A, 0x6A, 0x0D, 0x65, 0x28, 0xF4, 0xFF, 0xB5, 0x82, 0x76, 0x68, 0x75, 0xB2, 0xA2, 0x4D,
+    0x01, 0x7C, 0x02, 0x27, 0x68, 0x1E, 0xEE, 0xFC, 0xF6, 0x1D, 0x1F, 0xAD, 0x5E, 0xD6, 0x1E, 0x52,
+    0xAF, 0x6B, 0x99, 0x79, 0xB9, 0xF4, 0x7F, 0x62, 0xA3, 0x9F, 0xBE, 0x76, 0xC1, 0x46, 0x93, 0xA6,
+    0xAB, 0x5F, 0x67, 0xC4, 0x4D, 0x27, 0x65, 0x75, 0x11, 0x9A, 0xED, 0xE4, 0x44, 0x7E, 0x6D, 0xE4,
+    0x29, 0xB8, 0xA2, 0xD1, 0xBF, 0xA2, 0xA5, 0x5F, 0x9F, 0x4D, 0x5D, 0x6A, 0xB2, 0xCD, 0x54, 0x2A,
+    0x7E, 0x9A, 0x27, 0xB7, 0x86, 0xC5, 0x56, 0x25, 0x66, 0x65, 0xAE, 0xBC, 0x59, 0x81, 0x30, 0xC2,
+    0xF0, 0x9D, 0x11, 0xA7, 0xE5, 0x30, 0xB8, 0x61, 0x39, 0x10, 0x70, 0xC6, 0x25, 0x9E, 0xEA, 0xB3,
+    0x29, 0x76, 0xF7, 0xC5, 0xE6, 0x2E, 0x7D, 0xB0, 0xD8, 0xDD, 0x25, 0x93, 0xED, 0xE6, 0xD6, 0x26,
+    0xB7, 0xC9, 0x2D, 0x76, 0xEF, 0x52, 0x1F, 0xDB, 0xCD, 0xAD, 0x3E, 0x76, 0xA9, 0x5F, 0xFC, 0xE4,
+    0x92, 0x8F, 0xF3, 0xE4, 0x96, 0xF9, 0xAE, 0xC6, 0xFE, 0xAE, 0xAE, 0xE9, 0x63, 0xC3, 0xAB, 0xFA,
+    0x64, 0xF8, 0xD7, 0x41, 0xA1, 0xFA, 0x32, 0x54, 0xBF, 0xFB, 0xDD, 0x6D, 0xFD, 0xDA, 0x2F, 0x8F,
+    0x60, 0xF6, 0xAB, 0x98, 0xE5, 0x4F, 0x87, 0x57, 0xF5, 0xC9, 0xF0, 0x37, 0x8F, 0xCD, 0x92, 0xDD,
+    0xD6, 0xAF, 0xC3, 0x67, 0xC0, 0xC0, 0x37, 0xE0, 0xB4, 0x58, 0xA7, 0xFB, 0x61, 0x18, 0x5C, 0x02,
+    0xB8, 0x32, 0x99, 0xEB, 0x8C, 0x9D, 0xB4, 0x0E, 0xD2, 0xEA, 0x6F, 0x84, 0xF1, 0x2A, 0x19, 0xDF,
+    0x26, 0xDE, 0xDB, 0xFF, 0xC7, 0x88, 0x57, 0x42, 0xF7, 0x76, 0x93, 0x6D, 0x6E, 0xB2, 0xC9, 0x4D,
+    0x6E, 0x72, 0x93, 0xED, 0x6E, 0xEA, 0x79, 0x42, 0x8A, 0x47, 0x67, 0x32, 0x1E, 0xA7, 0xAF, 0x46,
+    0x2B, 0x4D, 0xF6, 0x15, 0xFC, 0xDD, 0xF3, 0x05, 0x9B, 0x9B, 0x0C, 0x61, 0xF2, 0x91, 0x6E, 0xB3,
+    0xF7, 0xFF, 0x05, 0x11, 0xB4, 0xB9, 0xD4, 0x55, 0xDD, 0xAD, 0x54, 0x53, 0xFA, 0xC5, 0xAD, 0xEE,
+    0xB5, 0x4C, 0xA1, 0xF8, 0xE8, 0x96, 0xE1, 0x95, 0x9C, 0xF4, 0xEC, 0x16, 0xD4, 0xA9, 0xB4, 0x8A,
+    0x7D, 0xC5, 0xAF, 0x27, 0xD1, 0xBD, 0x8E, 0xD1, 0x8A, 0xAF, 0x98, 0xF3, 0x85, 0x26, 0x83, 0x8F,
+    0xD8, 0xFB, 0x2F, 0x12, 0xB4, 0x77, 0x55, 0x4B, 0xA5, 0xBA, 0xB5, 0x5B, 0x0B, 0xD5, 0x2D, 0xFD,
+    0xA2, 0xAF, 0xEC, 0x9D, 0x2A, 0xBD, 0x46, 0x2E, 0x9D, 0x8A, 0x4A, 0x99, 0x5E, 0x99, 0xFA, 0xDC,
+    0x6E, 0xA3, 0x4B, 0x97, 0xF0, 0x11, 0x44, 0xA7, 0x8C, 0x57, 0xE2, 0xD6, 0x1C, 0x31, 0xA5, 0x19,
+    0xBB, 0x34, 0x10, 0x26, 0x3D, 0x9B, 0xAD, 0x34, 0x35, 0xDA, 0x2E, 0x48, 0x87, 0xEB, 0x84, 0x9D,
+    0x50, 0xAD, 0x52, 0xA7, 0x72, 0x79, 0x9E, 0xE6, 0x7B, 0xD9, 0xD4, 0x76, 0x77, 0xA9, 0xDD, 0x7C,
+    0x1C, 0xE2, 0x70, 0xB7, 0x30, 0x23, 0xA5, 0x26, 0x5B, 0x29, 0xBA, 0xD4, 0x3F, 0xA8, 0xF8, 0x69,
+    0xBE, 0xB6, 0x9B, 0x62, 0xB3, 0x4B, 0x2E, 0xB9, 0xE4, 0x17, 0x8D, 0x61, 0x9A, 0xB5, 0x35, 0x05,
+    0x69, 0x74, 0xC9, 0x1C, 0x26, 0xE1, 0xFD, 0x00, 0x1F, 0xB8, 0x81, 0x39, 0x0A, 0x73, 0x35, 0xF5,
+    0xE3, 0x1B, 0x6A, 0x32, 0x7E, 0x14, 0x6E, 0xF1, 0xA3, 0x2D, 0x7D, 0x64, 0x56, 0xA2, 0x53, 0xC6,
+    0x6E, 0x95, 0x66, 0xF7, 0x1F, 0xFB, 0xCB, 0xDC, 0x7F, 0xF7, 0xBC, 0x74, 0xFA, 0x56, 0x6D, 0xF4,
+    0x5A, 0x21, 0x4C, 0x97, 0x1E, 0x9D, 0xC8, 0x7C, 0xAE, 0x8B, 0x36, 0xCF, 0xA3, 0xFB, 0x41, 0xE6,
+    0xF7, 0xEC, 0x3B, 0x66, 0xFC, 0x03, 0xD0, 0x69, 0x34, 0x12, 0xFD, 0x6B, 0x99, 0xDC, 0x26, 0xB7,
+    0xFA, 0xC9, 0x37, 0xB9, 0xC9, 0x43, 0x74, 0x0F, 0x33, 0x5E, 0x23, 0xBA, 0x89, 0xDD, 0xF9, 0x9A,
+    0x4B, 0x7D, 0x1C, 0x54, 0xF1, 0x5A, 0x08, 0x3B, 0x5C, 0x82, 0xFF, 0x01, 0xCD, 0xBC, 0x4D, 0xAC,
+    0x25, 0xC7, 0x75, 0xE7, 0xF9, 0x8B, 0x8C, 0x7A, 0x95, 0xB4, 0x12, 0x72, 0xD4, 0x82, 0xA4, 0xF5,
+    0xE1, 0x56, 0x6A, 0xA1, 0x85, 0x2C, 0x48, 0x4C, 0x2F, 0xBC, 0x10, 0x1A, 0xC5, 0x8A, 0xA4, 0x38,
+    0x18, 0x2E, 0xB4, 0x50, 0x0D, 0x86, 0xB4, 0x07, 0x26, 0xDC, 0xF2, 0x42, 0x8B, 0x91, 0xD1, 0x40,
+    0xA9, 0x01, 0x2F, 0xB4, 0x20, 0x99, 0x29, 0x11, 0x18, 0x2D, 0xB4, 0x60, 0x61, 0xD0, 0xEE, 0x01,
+    0xC6, 0x0B, 0x73, 0x00, 0x0E, 0x60, 0x95, 0x80, 0x2E, 0x2D, 0xB4, 0xD0, 0x00, 0xAC, 0xCA, 0x20,
+    0x6B, 0x41, 0x0C, 0xB8, 0x50, 0x4A, 0x6C, 0xB7, 0x16, 0x5A, 0x28, 0x25, 0xD2, 0xEE, 0x01, 0x09,
+    0x74, 0x05, 0xAD, 0x94, 0x95, 0xAC, 0x8A, 0xCC, 0xFF, 0x2C, 0x22, 0xEF, 0xFB, 0xA0, 0x64, 0xB7,
+    0x2D, 0x51, 0x64, 0x5F, 0x80, 0xF7, 0x3E, 0xD6, 0xBB, 0xF7, 0xBE, 0x88, 0x13, 0x27, 0xCE, 0xC7,
+    0xFF, 0xFC, 0xCF, 0xC1, 0x60, 0x12, 0x7E, 0xB4, 0x89, 0xA6, 0x05, 0x0C, 0x45, 0xC4, 0x63, 0x27,
+    0x9E, 0xA2, 0x9A, 0x58, 0x71, 0xA3, 0x49, 0x34, 0xC1, 0x26, 0xBA, 0xBE, 0x9A, 0x11, 0x75, 0x2C,
+    0x56, 0x3E, 0xD1, 0x92, 0x1F, 0x55, 0x00, 0xD7, 0x83, 0x6B, 0xA1, 0x06, 0x1A, 0x30, 0xDD, 0x55,
+    0x6A, 0x2D, 0x0C, 0x4A, 0x56, 0x37, 0x52, 0xB5, 0x7C, 0xE7, 0x5E, 0x37, 0xCD, 0x34, 0x21, 0xE2,
+    0x5F, 0x88, 0xF8, 0xAF, 0x4E, 0xF8, 0xA7, 0x47, 0xFC, 0xD3, 0x01, 0xFF, 0x52, 0xF8, 0x56, 0x73,
+    0xF7, 0x6B, 0xD1, 0x49, 0x63, 0x29, 0xC1, 0xF0, 0x1A, 0x34, 0xC0, 0x03, 0xC0, 0x25, 0xE0, 0x41,
+    0xE0, 0x09, 0xE0, 0x79, 0xE0, 0x32, 0x87, 0xC7, 0x79, 0xB5, 0x20, 0xB5, 0xB8, 0xBB, 0x82, 0xA1,
+    0x48, 0xD8, 0xB9, 0x9C, 0x68, 0xC2, 0x47, 0x60, 0x03, 0xCA, 0x19, 0xF0, 0x01, 0x1A, 0x29, 0x20,
+    0x89, 0x62, 0x78, 0xFD, 0x39, 0x10, 0x60, 0x17, 0xA0, 0x1E, 0x81, 0x01, 0xF8, 0x9F, 0x17, 0xEE,
+    0xB7, 0x92, 0x52, 0x2D, 0x29, 0x76, 0xDF, 0x1B, 0xC4, 0x17, 0x00, 0x0C, 0xD0, 0x7E, 0xE7, 0xE8,
+    0xF2, 0x13, 0xD5, 0x1B, 0xBA, 0x3D, 0x36, 0x52, 0x44, 0x8F, 0x24, 0x5C, 0xA8, 0x43, 0x31, 0x93,
+    0xF0, 0xD4, 0xBD, 0x8D, 0x76, 0xC6, 0xB7, 0x03, 0x95, 0x86, 0x58, 0x4A, 0x0A, 0x37, 0xEA, 0xD7,
+    0x9E, 0x2A, 0xC0, 0xF4, 0x9D, 0x5E, 0x50, 0x1A, 0x74, 0x4B, 0xE9, 0xCA, 0xCA, 0x30, 0xB9, 0x85,
+    0x81, 0x32, 0x99, 0x15, 0x9B, 0xEC, 0x42, 0xB1, 0x56, 0x11, 0x54, 0x07, 0x3E, 0x24, 0xFF, 0xFF,
+    0xD1, 0x48, 0x89, 0xA3, 0xEE, 0xAD, 0x47, 0xA1, 0x89, 0xD0, 0x48, 0x91, 0x5A, 0x9A, 0xF2, 0x16,
+    0xF0, 0x3D, 0xD0, 0xF5, 0x60, 0x74, 0x15, 0x6A, 0x25, 0x68, 0xB4, 0x64, 0x41, 0xAC, 0xB8, 0x60,
+    0x12, 0x4D, 0x5F, 0x2C, 0xF8, 0xD6, 0x46, 0xBA, 0x7C, 0x68, 0xA7, 0x1F, 0xC5, 0xB3, 0x78, 0xCA,
+    0xC8, 0x4D, 0xDC, 0x48, 0xA2, 0xCE, 0x1F, 0xB0, 0x33, 0xF7, 0x01, 0x0C, 0x3D, 0x8D, 0x42, 0x79,
+    0x47, 0x78, 0x92, 0x4D, 0xC5, 0x54, 0xCF, 0xF0, 0xD3, 0x19, 0xFB, 0xD2, 0x8C, 0x2B, 0x17, 0x2E,
+    0xD9, 0xC4, 0x0D, 0x9B, 0x58, 0xED, 0x6C, 0x36, 0x3B, 0x19, 0x55, 0x01, 0xD5, 0xB0, 0x7D, 0x19,
+    0xB6, 0xF1, 0xA2, 0x91, 0x8D, 0xE5, 0xE2, 0xA6, 0x26, 0x78, 0x25, 0xBC, 0x5A, 0xEE, 0xBF, 0x0C,
+    0x50, 0xC4, 0x27, 0x07, 0xA7, 0x37, 0xD7, 0x2F, 0x57, 0x2D, 0xDC, 0xD7, 0x02, 0x9D, 0x26, 0xF0,
+    0x57, 0x1F, 0x9F, 0x70, 0x3D, 0x55, 0x6F, 0x47, 0x78, 0x80, 0x6F, 0x17, 0x6A, 0xBF, 0xED, 0x8C,
+    0x92, 0x7D, 0x71, 0xF4, 0x65, 0xF8, 0xE4, 0xC5, 0x2A, 0x7C, 0xDA, 0xBC, 0x1A, 0x12, 0xFC, 0xF6,
+    0xA7, 0x5D, 0x80, 0x9F, 0xF6, 0x09, 0xDC, 0x45, 0x17, 0xE0, 0xD5, 0xB0, 0xC1, 0x47, 0x3E, 0x55,
+    0x6E, 0xFF, 0xB6, 0x08, 0x53, 0xA3, 0x70, 0xB1, 0x6A, 0xAF, 0x4C, 0x55, 0xFB, 0x20, 0x14, 0x13,
+    0x33, 0x3C, 0x8F, 0x7D, 0xCB, 0xDC, 0x84, 0x52, 0x1B, 0x60, 0x1E, 0x03, 0x3E, 0x78, 0xAF, 0x51,
+    0x2A, 0xEF, 0x2E, 0xEE, 0x85, 0x58, 0x7F, 0x26, 0x36, 0x76, 0xBA, 0x54, 0x8D, 0xBE, 0xFE, 0x7F,
+    0xBD, 0xD6, 0xFA, 0xA7, 0xCB, 0x51, 0x7B, 0x19, 0x2E, 0x34, 0x9A, 0x3B, 0x4D, 0xF7, 0x3D, 0xCA,
+    0x7D, 0x8F, 0x3D, 0xF6, 0x88, 0xB4, 0x76, 0xD2, 0xF7, 0x1E, 0x7B, 0x6C, 0x85, 0x6A, 0x84, 0x1B,
+    0xF9, 0xE5, 0x8B, 0x50, 0x29, 0x49, 0xDF, 0x55, 0x02, 0x30, 0x97, 0xA1, 0xD6, 0xC8, 0x03, 0x3C,
+    0xC0, 0xA7, 0x30, 0xE3, 0xFB, 0xFD, 0xFC, 0xC9, 0xAA, 0x7C, 0xC6, 0x3E, 0xDD, 0xFF, 0x64, 0xFC,
+    0xD6, 0xF8, 0x60, 0xFC, 0xE4, 0x1F, 0xB8, 0x58, 0xFD, 0xB6, 0xFD, 0xAF, 0xC5, 0xAD, 0x17, 0x7E,
+    0x3A, 0x4D, 0x5F, 0xDA, 0x1E, 0xFC, 0x73, 0x07, 0x9F, 0x66, 0xE6, 0x09, 0xAA, 0xD7, 0x17, 0xF8,
+    0xD0, 0x55, 0xBC, 0x7E, 0xA8, 0x75, 0x50, 0x00, 0xAA, 0x15, 0x6D, 0xEE, 0xEE, 0xDA, 0x15, 0x6F,
+    0xCD, 0xF6, 0xEE, 0xE8, 0x7E, 0x14, 0x6E, 0xFA, 0xDB, 0xB1, 0x53, 0x7B, 0xE5, 0x35, 0x80, 0xA6,
+    0xA7, 0x58, 0x4E, 0xBD, 0x94, 0x79, 0x8D, 0xDF, 0xFF, 0xE6, 0xF6, 0x8D, 0xB7, 0xFD, 0xAE, 0x6E,
+    0x01, 0x3E, 0x71, 0xED, 0xDA, 0xFF, 0x91, 0xDF, 0x32, 0x02, 0x7C, 0x78, 0x32, 0x4A, 0xF6, 0xCE,
+    0x56, 0x8E, 0x4F, 0x15, 0xED, 0x4D, 0x4C, 0xA2, 0x8C, 0xD4, 0x81, 0x01, 0xBB, 0x50, 0x8F, 0x78,
+    0x25, 0xAF, 0x19, 0xE0, 0x4A, 0xEF, 0x14, 0x6E, 0x76, 0x9F, 0x09, 0x4F, 0x62, 0x23, 0x1D, 0x7E,
+    0xE1, 0xEE, 0x4C, 0x39, 0xD1, 0xB4, 0x26, 0x7D, 0x42, 0xA3, 0x16, 0xBE, 0x08, 0x86, 0x07, 0xDD,
+    0x8F, 0x57, 0xFF, 0xF5, 0xE9, 0xDB, 0x59, 0x10, 0x97, 0xA9, 0x47, 0x37, 0xE1, 0x43, 0x33, 0xE2,
+    0x83, 0x0F, 0x74, 0xBD, 0x0F, 0x74, 0xAD, 0xEF, 0x19, 0xE8, 0x5A, 0xC4, 0x40, 0x7E, 0xDA, 0x10,
+    0x66, 0x33, 0x1B, 0x66, 0xB3, 0x1B, 0x85, 0x3E, 0xAF, 0xF7, 0x5B, 0xA9, 0x5B, 0xAD, 0xD6, 0x66,
+    0x29, 0x6F, 0xCF, 0x6E, 0xAA, 0xA6, 0xD6, 0xE0, 0x26, 0xC0, 0x8D, 0x87, 0x2B, 0xDA, 0x84, 0xFD,
+    0x22, 0xF3, 0xAF, 0x4F, 0x69, 0xF4, 0x15, 0x25, 0xAC, 0xB4, 0x50, 0xEB, 0xAF, 0x5A, 0x3A, 0x7D,
+    0x0E, 0xA4, 0xCF, 0x63, 0xA4, 0x07, 0x28, 0xA4, 0x4B, 0x14, 0xDA, 0x1E, 0xA4, 0xD0, 0x7A, 0x91,
+    0x42, 0xE9, 0x09, 0x8C, 0xD2, 0x77, 0x40, 0x69, 0x81, 0x07, 0x96, 0x19, 0x98, 0x23, 0xF0, 0x66,
+    0x04, 0xF3, 0xF7, 0x11, 0x8A, 0x57, 0x27, 0xB0, 0xAF, 0x8C, 0x60, 0x5F, 0x0A, 0x50, 0x7D, 0xB7,
+    0x05, 0x37, 0xC0, 0x97, 0x7C, 0x82, 0x61, 0xBB, 0x0A, 0x7E, 0x3A, 0xFC, 0xE9, 0x23, 0xF7, 0x86,
+    0xD6, 0xA7, 0xE0, 0x7C, 0xDF, 0x85, 0x8E, 0xA5, 0x7A, 0x21, 0x9D, 0x6F, 0xE1, 0xC3, 0x0F, 0x0D,
+    0xD3, 0x30, 0x1F, 0x25, 0x3A, 0xEA, 0xBE, 0x1A, 0x6D, 0x24, 0xFF, 0xD8, 0xAD, 0x5E, 0x2D, 0x70,
+    0xBE, 0x65, 0x98, 0x8B, 0xB7, 0x52, 0x39, 0x3D, 0xEF, 0xC2, 0xF3, 0x75, 0x9F, 0xEA, 0x87, 0x96,
+    0xFA, 0xE1, 0xD9, 0xFD, 0x68, 0x2A, 0xD5, 0xF2, 0x28, 0x70, 0xA1, 0x51, 0xEC, 0x34, 0xDE, 0x77,
+    0xF9, 0xCC, 0xD5, 0x35, 0x63, 0x3E, 0x57, 0xDF, 0x32, 0x2C, 0x50, 0x45, 0x2A, 0x81, 0x49, 0x60,
+    0x23, 0xF8, 0x16, 0x3A, 0xA8, 0x26, 0xA8, 0x26, 0x4C, 0x02, 0x6E, 0x80, 0x07, 0x5C, 0xA0, 0x1A,
+    0x59, 0x48, 0x98, 0x05, 0xDF, 0xD7, 0x3D, 0x1E, 0x37, 0x17, 0x0B, 0x2E, 0x58, 0x7D, 0x46, 0x73,
+    0x31, 0x73, 0x27, 0x7A, 0xF1, 0x14, 0x97, 0xF2, 0xDB, 0xDD, 0xAD, 0x09, 0xEC, 0x6C, 0xE3, 0x93,
+    0xC0, 0x4D, 0xA4, 0x04, 0x75, 0x70, 0x52, 0xC0, 0x46, 0xEE, 0xFB, 0xFC, 0x7F, 0xCA, 0x76, 0x75,
+    0xC9, 0x27, 0x52, 0xB7, 0x14, 0x71, 0x97, 0x07, 0x6F, 0x7F, 0x54, 0xE4, 0x35, 0x27, 0x18, 0x16,
+    0xF0, 0x3D, 0x95, 0xA0, 0x8A, 0x60, 0x63, 0x5E, 0x64, 0x97, 0x97, 0x5E, 0x4D, 0x54, 0x13, 0x70,
+    0x23, 0xFF, 0xAB, 0x0B, 0x78, 0x86, 0x91, 0x44, 0x35, 0x7A, 0xB5, 0x75, 0x6F, 0x16, 0xF7, 0x77,
+    0xA9, 0x58, 0xF0, 0xCC, 0xEE, 0x45, 0xCD, 0x2E, 0x1C, 0x99, 0xC5, 0xAB, 0x98, 0xA1, 0x03, 0x9E,
+    0xCA, 0x1A, 0xE2, 0x02, 0x65, 0x04, 0x3B, 0x53, 0x24, 0xE0, 0x26, 0xAC, 0x40, 0x1D, 0xE8, 0xFE,
+    0xE2, 0x32, 0x76, 0xC6, 0x49, 0xB0, 0xC1, 0xA0, 0x89, 0x2A, 0xE4, 0x15, 0x5E, 0xF8, 0x85, 0x35,
+    0x17, 0x01, 0x86, 0x90, 0x57, 0x26, 0x70, 0x13, 0xEE, 0x95, 0xFC, 0x8D, 0x5F, 0x6A, 0xF2, 0x9F,
+    0xB3, 0x11, 0x37, 0xC2, 0xF9, 0x44, 0xB1, 0x80, 0x55, 0x4F, 0x07, 0xFC, 0xEB, 0x15, 0x17, 0x58,
+    0x28, 0xA7, 0x62, 0xC6, 0xF7, 0xDC, 0xE0, 0x49, 0xDC, 0xCC, 0x95, 0xE0, 0x7A, 0xAB, 0xCF, 0x2A,
+    0xDA, 0xC8, 0x9D, 0x38, 0x2C, 0xDC, 0xE0, 0x92, 0x37, 0x97, 0xA9, 0xFB, 0x2C, 0xE7, 0x98, 0xE5,
+    0xBC, 0x66, 0x39, 0x37, 0xBD, 0x93, 0x02, 0x65, 0x96, 0xB3, 0x49, 0x59, 0xCE, 0xBE, 0x87, 0xBA,
+    0xC5, 0xEE, 0x72, 0x3E, 0xB7, 0x2B, 0x04, 0xAC, 0xD9, 0x59, 0xD7, 0x2D, 0x70, 0x0E, 0xB7, 0x14,
+    0x0A, 0xF7, 0x25, 0xEA, 0xBE, 0x8C, 0x45, 0x62, 0xA0, 0x09, 0x36, 0x72, 0x93, 0x6A, 0xBA, 0x77,
+    0xB8, 0x7E, 0x4B, 0xA9, 0x51, 0xDF, 0x8D, 0xA7, 0xB6, 0x5D, 0xCD, 0x5F, 0x06, 0x86, 0xBB, 0x13,
+    0xD8, 0x9F, 0xAB, 0x85, 0xAA, 0x9C, 0xDF, 0x26, 0x0C, 0x73, 0x95, 0xC3, 0xA5, 0x2B, 0x04, 0x50,
+    0xAF, 0x00, 0x9A, 0x81, 0xEA, 0xF6, 0x04, 0x78, 0x1F, 0xA0, 0x58, 0x04, 0xD4, 0x2F, 0x26, 0x60,
+    0xAD, 0x66, 0x28, 0x63, 0x3D, 0x81, 0x6F, 0x7D, 0xA0, 0x58, 0x1F, 0x13, 0x38, 0x29, 0x81, 0xA4,
+    0x99, 0xF2, 0x67, 0x8F, 0x5D, 0x99, 0xF0, 0x3D, 0x43, 0x28, 0x12, 0x46, 0xD4, 0x91, 0x6A, 0x7B,
+    0x44, 0x73, 0x21, 0x5D, 0xD1, 0xE8, 0x94, 0x80, 0xA3, 0x16, 0x30, 0x0A, 0x40, 0x7D, 0xBD, 0x05,
+    0xBE, 0xFD, 0x00, 0x50, 0x8C, 0xDF, 0x01, 0xAA, 0x37, 0x02, 0xE0, 0x56, 0x0E, 0xEF, 0xE3, 0x7C,
+    0x0B, 0xD9, 0xA3, 0x53, 0x25, 0x80, 0x6E, 0x06, 0xAC, 0x46, 0xA0, 0x19, 0x7A, 0x20, 0x09, 0xA8,
+    0x5E, 0x4D, 0x40, 0x57, 0x45, 0xB0, 0x73, 0x33, 0x42, 0x1D, 0xBA, 0x1E, 0x56, 0x04, 0xD5, 0xCF,
+    0xFE, 0x28, 0x81, 0x97, 0x22, 0x56, 0xD2, 0x48, 0xFD, 0x37, 0x8F, 0x0D, 0x3D, 0x1B, 0x85, 0xA8,
+    0x22, 0x65, 0xA2, 0x0B, 0x34, 0x6F, 0xD5, 0x1A, 0x2B, 0xAD, 0x83, 0x5A, 0xAF, 0x78, 0x4A, 0x4E,
+    0x83, 0xA4, 0x00, 0x46, 0x92, 0x00, 0xBA, 0xED, 0x9B, 0x09, 0xB0, 0x9A, 0xEC, 0x04, 0xF8, 0xAE,
+    0x75, 0x2D, 0x14, 0x3F, 0x4B, 0x7C, 0x0C, 0x68, 0xBE, 0x1E, 0x01, 0x4C, 0xF2, 0x3D, 0x80, 0x0B,
+    0xDB, 0x1F, 0x5F, 0x05, 0xD6, 0x4A, 0xEA, 0xC1, 0x4D, 0x5E, 0x09, 0x18, 0xF2, 0x86, 0x4A, 0x65,
+    0x07, 0xDF, 0x49, 0x23, 0x2D, 0x76, 0x41, 0x54, 0x3D, 0x3E, 0xD8, 0xC4, 0x25, 0x8A, 0x84, 0x8B,
+    0xC5, 0x42, 0x33, 0x9A, 0xE1, 0x75, 0x8D, 0xA5, 0x26, 0x2F, 0x09, 0xAF, 0x5E, 0xD2, 0x02, 0xE6,
+    0xCF, 0xFE, 0x3D, 0x54, 0xD2, 0x82, 0x95, 0xB4, 0x70, 0x49, 0x7F, 0xA9, 0x09, 0x17, 0x4B, 0x61,
+    0x44, 0xBD, 0x50, 0x47, 0x14, 0x8A, 0x8D, 0x32, 0xE1, 0x47, 0xBA, 0xD1, 0xAE, 0xD8, 0xB5, 0x91,
+    0x42, 0xF7, 0xA2, 0xB4, 0x94, 0x09, 0xF5, 0x0C, 0xC1, 0xCD, 0xB8, 0x05, 0xED, 0xA7, 0xE5, 0xA7,
+    0x62, 0xC3, 0x25, 0xFC, 0x54, 0x89, 0x52, 0x52, 0x28, 0x25, 0x8D, 0x48, 0xBA, 0x7A, 0xA2, 0x3A,
+    0x59, 0xC5, 0x2E, 0x42, 0xA9, 0xE1, 0xA0, 0x61, 0x5F, 0xF2, 0xED, 0x19, 0xFD, 0xFA, 0xD0, 0x55,
+    0x30, 0xD2, 0x88, 0x95, 0x56, 0x4A, 0xBD, 0xA1, 0x60, 0xD5, 0x36, 0x8B, 0x15, 0x56, 0x85, 0x5A,
+    0x86, 0x51, 0x81, 0x7A, 0xEE, 0x46, 0xCA, 0xAD, 0x89, 0x18, 0x7D, 0x2E, 0x41, 0xF7, 0x8A, 0xA0,
+    0x99, 0x15, 0x70, 0xC9, 0x47, 0xEC, 0xE6, 0x12, 0x85, 0x1E, 0x16, 0x28, 0x0C, 0x13, 0x0A, 0x6E,
+    0x33, 0x1A, 0x0B, 0x49, 0x63, 0x8E, 0xFA, 0xCC, 0xB0, 0xB5, 0x40, 0x0B, 0xDC, 0xC3, 0xC7, 0xEA,
+    0xBE, 0xF9, 0xEC, 0xD2, 0x4C, 0xC3, 0xF5, 0xA9, 0x52, 0x64, 0x88, 0xD4, 0x0B, 0xB5, 0xDA, 0x5A,
+    0x73, 0x1D, 0xF5, 0xD9, 0xE8, 0xA6, 0x6F, 0x31, 0x9D, 0xB9, 0x04, 0xDF, 0xE0, 0x0F, 0xA0, 0x53,
+    0x4C, 0x58, 0xE5, 0x80, 0xEC, 0xBA, 0x02, 0x7E, 0x2E, 0xD4, 0xA3, 0x80, 0x42, 0x21, 0xAC, 0x46,
+    0xBB, 0x51, 0x6B, 0x2C, 0x13, 0x4F, 0xF9, 0xA9, 0x4A, 0x66, 0xF1, 0xA3, 0x5B, 0xCA, 0xC9, 0x8F,
+    0x6E, 0xA9, 0xFB, 0x6E, 0x74, 0xCB, 0x93, 0x0C, 0xC1, 0xDD, 0x99, 0x51, 0xEF, 0x34, 0x1A, 0xB5,
+    0x4E, 0xAD, 0x15, 0xD5, 0x86, 0x4B, 0x58, 0xB5, 0xDD, 0x4C, 0x25, 0x69, 0xC4, 0x0F, 0x12, 0x3C,
+    0xFF, 0x61, 0xBD, 0x06, 0x1F, 0x3D, 0x63, 0xA1, 0x6C, 0x4B, 0x36, 0x9F, 0xB8, 0x04, 0x34, 0x2B,
+    0x50, 0xCF, 0x40, 0x71, 0x46, 0xAC, 0x4E, 0xB3, 0xD7, 0x2D, 0x25, 0xA7, 0xD1, 0x47, 0x86, 0xBE,
+    0x4C, 0xF8, 0x1E, 0xB5, 0x3E, 0xD0, 0x4C, 0x75, 0xC0, 0x26, 0x37, 0x82, 0x3E, 0x37, 0x41, 0xF3,
+    0x46, 0x04, 0xAB, 0x78, 0xB8, 0xD4, 0xF5, 0x02, 0xD8, 0x04, 0x18, 0xED, 0x21, 0xE1, 0xEE, 0xF2,
+    0xDC, 0x0C, 0x54, 0x5B, 0x0B, 0x5E, 0x33, 0xE4, 0x6B, 0x9A, 0x1F, 0xF9, 0x00, 0x37, 0x30, 0xEA,
+    0xC1, 0x6E, 0x2D, 0xD4, 0x5A, 0xA1, 0xD3, 0x46, 0xB1, 0x7D, 0x78, 0xC5, 0xCD, 0x2E, 0xE1, 0x43,
+    0x1D, 0x8D, 0xE8, 0x42, 0x95, 0x8A, 0x0D, 0x3F, 0xB9, 0x19, 0xB5, 0xEA, 0xED, 0x7A, 0x65, 0xA1,
+    0x96, 0x5A, 0x06, 0x5D, 0xC5, 0x6E, 0xFB, 0x22, 0x4A, 0x6D, 0xFB, 0x5F, 0x02, 0xF8, 0xB3, 0x16,
+    0x28, 0xB5, 0x00, 0x8D, 0x56, 0x60, 0xF8, 0xCA, 0x06, 0x6C, 0x6C, 0x50, 0x24, 0x56, 0xB0, 0x8B,
+    0x49, 0x50, 0xCE, 0x76, 0x86, 0x2A, 0x56, 0x13, 0xB8, 0x58, 0xF7, 0xE0, 0xA2, 0x07, 0xDC, 0xB4,
+    0x01, 0xF5, 0x28, 0xA0, 0x09, 0x43, 0x00, 0x1F, 0x7C, 0x04, 0xDF, 0xBB, 0x05, 0xBA, 0xB6, 0x5C,
+    0x61, 0x68, 0x8B, 0x0D, 0x86, 0x73, 0x66, 0x03, 0xD5, 0x26, 0xC1, 0xE6, 0xEF, 0x2E, 0x98, 0xD5,
+    0x6B, 0xA2, 0x48, 0x4E, 0x2D, 0x36, 0xD1, 0xEE, 0x59, 0xC3, 0xB9, 0x72, 0x06, 0x1E, 0x70, 0x11,
+    0xF0, 0x0A, 0x40, 0x76, 0xEF, 0xD5, 0x6B, 0x79, 0xC5, 0xCF, 0xDD, 0x83, 0xD1, 0x67, 0x7B, 0xA4,
+    0x91, 0x8B, 0x3E, 0x72, 0xBE, 0x38, 0xA5, 0x53, 0x47, 0xED, 0xBD, 0xD4, 0xEB, 0x40, 0x2D, 0xF5,
+    0xF5, 0x5B, 0x0A, 0x2E, 0xBA, 0x58, 0xCD, 0x76, 0xB1, 0xC9, 0xAC, 0x66, 0x43, 0x0C, 0x74, 0xC1,
+    0x07, 0x3F, 0xB9, 0x58, 0xCF, 0x36, 0xB9, 0x15, 0xB9, 0xE1, 0x3F, 0x7A, 0x7D, 0x57, 0x5F, 0xD7,
+    0x2D, 0xF5, 0xEA, 0xBB, 0xD6, 0x1C, 0x7F, 0x59, 0x3D, 0x83, 0x13, 0x54, 0x0F, 0x8F, 0xD8, 0xF0,
+    0x6D, 0x98, 0x2F, 0x42, 0xB3, 0x41, 0x71, 0x88, 0xFD, 0x1F, 0x35, 0xAD, 0xD1, 0x0F, 0xA3, 0x91,
+    0x16, 0xA3, 0xBF, 0x4A, 0x08, 0x31, 0xB4, 0xBE, 0xF7, 0xA1, 0x1E, 0xEB, 0xC9, 0xC5, 0x2A, 0x96,
+    0xC9, 0x26, 0xBB, 0x21, 0xA3, 0xD6, 0x07, 0x8D, 0x2E, 0xDE, 0xBD, 0xF3, 0xAA, 0x92, 0x96, 0x21,
+    0xF9, 0xC5, 0x2D, 0xE5, 0xBC, 0x6B, 0xE1, 0xA3, 0xDC, 0x07, 0x7E, 0xAB, 0xD4, 0x96, 0x92, 0x44,
+    0xF7, 0x77, 0x7A, 0x25, 0xD9, 0x64, 0x52, 0x15, 0x9B, 0xD1, 0x8D, 0xBE, 0x17, 0x5D, 0x91, 0xCA,
+    0xC5, 0xA6, 0x26, 0x34, 0xA1, 0xBE, 0xBB, 0x20, 0xA4, 0xD6, 0xA6, 0x52, 0x57, 0x71, 0xD1, 0x2F,
+    0x7C, 0xCB, 0xDF, 0xBA, 0x1D, 0xEB, 0x20, 0x35, 0xDA, 0x0A, 0x45, 0xAF, 0xD1, 0x6E, 0x74, 0x0B,
+    0xB4, 0x07, 0xB7, 0x86, 0x89, 0x5F, 0xA2, 0xD4, 0x4C, 0xA1, 0x11, 0xD4, 0x53, 0x2A, 0x50, 0x3D,
+    0x33, 0x61, 0x76, 0xE7, 0x5E, 0x69, 0xA1, 0x53, 0x32, 0x52, 0xB2, 0x6B, 0x99, 0xDC, 0x6C, 0x53,
+    0x3D, 0xD9, 0xD4, 0x8C, 0x36, 0xF9, 0x60, 0x17, 0x1F, 0xCA, 0xD9, 0x07, 0x17, 0x7D, 0xA8, 0x47,
+    0x3F, 0x75, 0xA1, 0x91, 0x5A, 0xA7, 0x95, 0x42, 0xD3, 0xEE, 0x3A, 0x9F, 0xBB, 0x07, 0xBB, 0x3E,
+    0x80, 0xD3, 0x86, 0xFB, 0x5C, 0x3A, 0x7B, 0x32, 0x8F, 0x42, 0xAD, 0xC0, 0xA0, 0x58, 0xE8, 0xCA,
+    0x5C, 0x2E, 0x55, 0x72, 0xB1, 0x3C, 0xF5, 0xFD, 0xE5, 0xE2, 0x43, 0x75, 0xF8, 0xFE, 0xC9, 0x8F,
+    0x5D, 0x68, 0xEE, 0x08, 0xA7, 0x94, 0xBF, 0xFF, 0xDE, 0x6C, 0xF8, 0x8A, 0x04, 0x3E, 0x60, 0x13,
+    0xBC, 0x8F, 0xDD, 0x78, 0xFF, 0x40, 0x5A, 0xEF, 0x7B, 0xEC, 0xB1, 0x16, 0xA0, 0xEE, 0xB1, 0xF9,
+    0x2D, 0x66, 0x06, 0x8E, 0xDA, 0x0B, 0x94, 0xFA, 0xFB, 0xC8, 0x20, 0x51, 0xAD, 0x5D, 0xA4, 0xEB,
+    0xBB, 0x60, 0x93, 0x15, 0xF5, 0xE8, 0x13, 0x43, 0xF9, 0xA3, 0x68, 0xD3, 0x13, 0xBE, 0x77, 0x77,
+    0x5F, 0x58, 0xF1, 0xC9, 0x45, 0xD4, 0x77, 0xBD, 0x4D, 0x65, 0xC2, 0x6D, 0x43, 0x40, 0x4A, 0xB8,
+    0xCF, 0xAA, 0xE7, 0xA3, 0xEC, 0x86, 0xA0, 0x87, 0x1C, 0x97, 0xD9, 0x19, 0x70, 0xF1, 0x10, 0x44,
+    0x7B, 0x80, 0x8B, 0x67, 0x6C, 0xF0, 0x65, 0x2E, 0x53, 0xAD, 0x76, 0xA5, 0x56, 0xB1, 0x71, 0xBF,
+    0x8C, 0x60, 0x68, 0x37, 0xE8, 0x1E, 0x5A, 0xC1, 0x7F, 0x25, 0x81, 0xFF, 0xEA, 0x02, 0xFE, 0xE9,
+    0x19, 0x9A, 0x97, 0x22, 0x34, 0xDF, 0x1D, 0xA1, 0xFE, 0x51, 0x0F, 0xB5, 0x0E, 0x31, 0x41, 0xBD,
+    0x00, 0x75, 0x3C, 0x44, 0x0B, 0x1D, 0xDC, 0x63, 0x56, 0x68, 0xAE, 0xCF, 0xFB, 0xFD, 0xF0, 0x1B,
+    0x39, 0x3E, 0xCD, 0x52, 0xA6, 0x5B, 0x76, 0xC3, 0x73, 0x34, 0xF4, 0xBB, 0xAE, 0x56, 0xC7, 0x1F,
+    0x5F, 0x4D, 0x4B, 0x19, 0x87, 0x91, 0xE6, 0xBB, 0x0A, 0x6C, 0x12, 0xF6, 0xEE, 0xAD, 0x44, 0x9D,
+    0x5C, 0xA4, 0x1B, 0x7D, 0x28, 0x36, 0x84, 0x8B, 0x36, 0xE1, 0x43, 0x3D, 0x9A, 0x0D, 0x51, 0xCD,
+    0xE5, 0x82, 0x0F, 0x5D, 0x40, 0x6F, 0x24, 0xAC, 0x34, 0x52, 0xDF, 0x5E, 0x72, 0x66, 0x6F, 0xD3,
+    0x41, 0x08, 0x5D, 0x0F, 0x95, 0x26, 0xE8, 0x34, 0x62, 0xAE, 0x5D, 0x3B, 0x65, 0x34, 0xBF, 0x3A,
+    0x83, 0x7F, 0x69, 0x01, 0xFF, 0xB5, 0x19, 0x3E, 0x52, 0x5C, 0x7D, 0x8F, 0x85, 0x54, 0x6A, 0xE5,
+    0x90, 0xDE, 0xE7, 0xFC, 0xF0, 0xF4, 0xE3, 0x83, 0x1C, 0xF6, 0x45, 0x13, 0x01, 0xA3, 0x11, 0x70,
+    0x6A, 0x81, 0x9B, 0x1B, 0x60, 0x7F, 0x9A, 0x80, 0xE6, 0x99, 0x08, 0x26, 0x35, 0x01, 0xDC, 0x38,
+    0xB4, 0xD0, 0x99, 0x0D, 0xEC, 0x6C, 0x13, 0x34, 0x7F, 0xF3, 0xF9, 0x08, 0x92, 0x02, 0x4E, 0x52,
+    0x4B, 0xF7, 0xD8, 0x1F, 0x6E, 0xD8, 0x85, 0x2A, 0xD1, 0x04, 0xEA, 0x68, 0x04, 0xC3, 0x6B, 0x9D,
+    0xDA, 0x46, 0xFF, 0xA0, 0x15, 0x29, 0x50, 0xE6, 0x74, 0x0B, 0x74, 0x7A, 0x45, 0xEF, 0x98, 0x81,
+    0xC9, 0xEA, 0x5B, 0xF3, 0x71, 0xA0, 0x7B, 0x64, 0x04, 0x93, 0x33, 0x78, 0x4D, 0x07, 0xB5, 0x79,
+    0x6F, 0x03, 0x53, 0x03, 0x14, 0xD1, 0xB6, 0x6C, 0x55, 0xA0, 0xD1, 0x98, 0x8D, 0xD4, 0xD1, 0x3B,
+    0x6E, 0xD6, 0xDF, 0xB3, 0x80, 0x36, 0xDB, 0xC2, 0x4B, 0x1C, 0xCC, 0x47, 0xCE, 0xBF, 0xF1, 0x09,
+    0xC0, 0x8F, 0x07, 0xE9, 0x5F, 0x3E, 0xA2, 0xD4, 0x95, 0x50, 0x4A, 0x53, 0xB9, 0x75, 0xD1, 0x26,
+    0x9B, 0x8A, 0x95, 0x0D, 0xD1, 0xB5, 0x5D, 0xEF, 0x43, 0x13, 0xEA, 0xE8, 0xA2, 0x5B, 0x6C, 0x2A,
+    0x57, 0x64, 0xD5, 0xFA, 0x5B, 0xB7, 0xDF, 0x78, 0x46, 0x3F, 0xD5, 0x4F, 0x14, 0x35, 0xF9, 0xA9,
+    0x9E, 0x68, 0xCD, 0x04, 0xC4, 0x9C, 0xE1, 0x70, 0x69, 0x8F, 0xE8, 0xCD, 0x76, 0x46, 0xCB, 0x4B,
+    0x72, 0x22, 0x47, 0xBD, 0x40, 0xA1, 0x00, 0xCD, 0x6B, 0x90, 0x61, 0x39, 0x80, 0xF3, 0xDF, 0x80,
+    0x42, 0x1A, 0x19, 0xA4, 0xBE, 0xD2, 0xB5, 0x0D, 0x4D, 0xC5, 0x5C, 0x25, 0x5C, 0xF0, 0x23, 0x97,
+    0x8A, 0x0D, 0x2E, 0xBB, 0x19, 0xE8, 0xC2, 0xAE, 0x28, 0x2E, 0x1D, 0x02, 0x1A, 0x05, 0xB0, 0xDA,
+    0xFF, 0xEE, 0x9F, 0x36, 0x89, 0x2A, 0xF8, 0xED, 0x0F, 0x37, 0x06, 0x29, 0x5B, 0x62, 0x3A, 0x8D,
+    0x60, 0xDA, 0x83, 0x62, 0x56, 0x39, 0x2B, 0xB4, 0x29, 0x67, 0xBE, 0x09, 0x6C, 0x38, 0xC9, 0xC6,
+    0x2E, 0xC3, 0x30, 0x53, 0x2B, 0x1A, 0xA9, 0x77, 0xF1, 0x77, 0x19, 0x72, 0xA4, 0xD0, 0x8C, 0xA0,
+    0xFC, 0x29, 0x17, 0xC1, 0x87, 0xF7, 0xA1, 0x17, 0x92, 0x95, 0xC6, 0x52, 0x2B, 0xA5, 0x7A, 0x38,
+    0x09, 0xDE, 0xCC, 0xBC, 0x3B, 0x74, 0xA3, 0x08, 0xCD, 0xCB, 0x91, 0x22, 0x55, 0x81, 0xAA, 0xFD,
+    0xAD, 0x77, 0x7B, 0xC3, 0xBF, 0x07, 0x2E, 0x62, 0xD5, 0x73, 0x23, 0x51, 0x3F, 0x3D, 0x95, 0xD3,
+    0x03, 0x7C, 0x6C, 0x5F, 0xE9, 0xA3, 0x30, 0xCC, 0x74, 0x0A, 0xB5, 0x16, 0x9B, 0x4A, 0x06, 0x70,
+    0x13, 0xC5, 0x7A, 0xEC, 0xF4, 0xF2, 0xCB, 0xB3, 0x3E, 0x76, 0x56, 0x1A, 0x6B, 0xCD, 0x74, 0xCB,
+    0xE9, 0x5C, 0xDB, 0x46, 0xB2, 0x60, 0x10, 0x50, 0xCC, 0x87, 0x74, 0x01, 0xC0, 0x5C, 0x6B, 0x61,
+    0xD0, 0x4C, 0x23, 0x4D, 0x85, 0x5E, 0x1F, 0x7A, 0xBF, 0x70, 0xA3, 0x10, 0x36, 0xBA, 0x19, 0xD7,
+    0x0F, 0x3D, 0xF7, 0xDA, 0xF5, 0x60, 0x47, 0x87, 0xE3, 0x3D, 0x2D, 0x80, 0x8F, 0xC7, 0xDB, 0x6C,
+    0xF9, 0x40, 0x25, 0x8A, 0xE8, 0xF4, 0x17, 0x43, 0xDF, 0x48, 0x29, 0x67, 0x02, 0xB5, 0xE6, 0x03,
+    0x7A, 0xFC, 0x71, 0xF0, 0x3D, 0xCD, 0x44, 0x35, 0xC3, 0x73, 0xC7, 0x7F, 0xFE, 0x32, 0x95, 0xDA,
+    0x5A, 0xB1, 0xD6, 0xE2, 0xE2, 0xEF, 0x56, 0x11, 0xBB, 0x50, 0xAC, 0x20, 0xF0, 0x01, 0x17, 0xB1,
+    0x89, 0x67, 0xF5, 0x42, 0xF2, 0x5A, 0x4B, 0xAD, 0x7B, 0xEC, 0xB2, 0x3F, 0xBE, 0xCC, 0x77, 0xE0,
+    0x86, 0x9D, 0xC1, 0xD7, 0x23, 0x34, 0x3A, 0xDC, 0xDF, 0x22, 0x9E, 0xD6, 0x58, 0x06, 0xCD, 0x39,
+    0x29, 0x6B, 0xB6, 0x6F, 0x2E, 0x68, 0x2A, 0xE6, 0x42, 0xD8, 0x68, 0x57, 0xEC, 0x54, 0x2D, 0x98,
+    0xD6, 0xCD, 0x87, 0x0D, 0x36, 0xF1, 0xB0, 0x2F, 0x3F, 0x1D, 0xFF, 0x14, 0x01, 0x3F, 0x63, 0xFA,
+    0x26, 0x51, 0x05, 0xA7, 0xBF, 0x18, 0xFA, 0x4A, 0x12, 0x85, 0x94, 0xF6, 0x53, 0x3C, 0x46, 0xC8,
+    0xBF, 0x6C, 0xA7, 0x22, 0x7A, 0xCA, 0x57, 0x23, 0x4E, 0x59, 0xB9, 0x9A, 0xF6, 0xF8, 0x30, 0xDE,
+    0x19, 0xB5, 0x2D, 0x42, 0x39, 0x82, 0x2F, 0x12, 0x14, 0xCB, 0x4D, 0xC0, 0xE9, 0x38, 0x6F, 0x60,
+    0x39, 0x16, 0xED, 0xBF, 0x38, 0x17, 0x4D, 0xD8, 0x95, 0x2E, 0xD0, 0x85, 0x2A, 0x51, 0x26, 0x86,
+    0x5F, 0x31, 0x17, 0xE5, 0xC8, 0xB4, 0xD0, 0x2D, 0x97, 0xC0, 0xE9, 0xA5, 0x09, 0x1E, 0x5F, 0x6E,
+    0x00, 0xDD, 0xE7, 0x02, 0x54, 0x71, 0x06, 0xE4, 0xE0, 0x3E, 0x37, 0xB5, 0xD4, 0xDB, 0x0A, 0xA5,
+    0x14, 0x30, 0xFA, 0xAB, 0x04, 0x3E, 0xF8, 0x9E, 0x6A, 0xB6, 0x33, 0x88, 0x0E, 0xEA, 0xC9, 0x45,
+    0x8A, 0x64, 0x04, 0x3E, 0xF8, 0x09, 0x9B, 0xCA, 0x15, 0x7C, 0xD0, 0x88, 0x4D, 0x97, 0xB6, 0xEF,
+    0xE0, 0xF5, 0x5D, 0xF5, 0x85, 0xA2, 0x26, 0xDC, 0x52, 0xCE, 0x07, 0x03, 0xF1, 0xDE, 0x25, 0xE2,
+    0x1C, 0x01, 0xF5, 0x06, 0x28, 0x81, 0xB9, 0x32, 0x01, 0x5D, 0x8B, 0x91, 0x26, 0x4A, 0x29, 0x57,
+    0x15, 0xCA, 0xB7, 0x56, 0x90, 0x22, 0x6E, 0x53, 0x40, 0xED, 0x46, 0xB9, 0xD8, 0x19, 0x1F, 0xEA,
+    0x70, 0x88, 0xAE, 0x52, 0xDE, 0xB0, 0x8C, 0x5A, 0x9B, 0xDC, 0x8A, 0x8B, 0x77, 0xEF, 0x4C, 0x5E,
+    0xDF, 0x55, 0x3F, 0x24, 0xBF, 0xA0, 0xBE, 0x6B, 0x77, 0xAD, 0x72, 0x5A, 0xC8, 0x5F, 0x6D, 0xA4,
+    0xF6, 0xED, 0x00, 0x5B, 0xCE, 0xA1, 0x25, 0x25, 0xCA, 0xED, 0xDA, 0x06, 0xA2, 0xEE, 0xE9, 0x42,
+    0x39, 0x52, 0x47, 0x33, 0x51, 0x2D, 0x80, 0xCD, 0xEE, 0xFC, 0x3F, 0x3C, 0x97, 0xB3, 0x48, 0x1A,
+    0x69, 0xBF, 0xE3, 0xFB, 0x6F, 0x30, 0xD0, 0x85, 0x62, 0xA2, 0x99, 0x58, 0x70, 0x33, 0x2B, 0xA5,
+    0xAE, 0x8B, 0x5A, 0x52, 0x70, 0x92, 0x46, 0x68, 0x34, 0x21, 0x05, 0xAB, 0x13, 0xA7, 0x72, 0x4A,
+    0xDF, 0xD7, 0x26, 0xB8, 0xD0, 0xB1, 0xD9, 0xC5, 0xC6, 0x26, 0x34, 0x2F, 0x26, 0x34, 0x04, 0xAB,
+    0x19, 0xF7, 0x16, 0xF8, 0xBE, 0x42, 0x26, 0x15, 0xD2, 0x64, 0xCF, 0xE8, 0xBB, 0xE1, 0x1C, 0xD8,
+    0xB1, 0x02, 0xD6, 0xBA, 0xDF, 0xC3, 0x36, 0xAB, 0xFE, 0x17, 0xF0, 0x4F, 0x2F, 0x09, 0x27, 0x29,
+    0xD0, 0xBD, 0x7E, 0x7D, 0xC2, 0x45, 0xB3, 0x50, 0x26, 0x9E, 0xC4, 0x88, 0x8F, 0x1C, 0x32, 0xEB,
+    0x11, 0x70, 0x6F, 0xFD, 0x59, 0x4B, 0x29, 0x4D, 0x14, 0x52, 0x04, 0x9D, 0xFC, 0x26, 0x72, 0x81,
+    0x32, 0xF1, 0x00, 0xC5, 0x86, 0xEB, 0x51, 0xEB, 0x46, 0xBA, 0x3B, 0x8A, 0x46, 0x52, 0x42, 0xD2,
+    0x0A, 0xE7, 0xB8, 0xC0, 0x77, 0x4C, 0xB0, 0xCB, 0x15, 0x2A, 0xED, 0xA8, 0xF0, 0x2E, 0xF4, 0xFB,
+    0xA0, 0x52, 0x6B, 0x24, 0xEA, 0xEF, 0x27, 0x52, 0x19, 0xDD, 0xE4, 0x7B, 0x5F, 0xA4, 0x22, 0x35,
+    0xC1, 0xDD, 0xCD, 0x35, 0x1A, 0x5D, 0xC5, 0x2E, 0x7C, 0xCB, 0xC5, 0x3A, 0x34, 0xDA, 0xF0, 0x1A,
+    0xE9, 0x96, 0x63, 0xB7, 0x96, 0xF1, 0x29, 0xA0, 0x9A, 0x8F, 0xE3, 0xCD, 0xF5, 0x14, 0x08, 0xF9,
+    0x6E, 0x6F, 0x96, 0x8F, 0x67, 0x5F, 0xB3, 0x65, 0x0B, 0xF5, 0xDC, 0xA9, 0x94, 0x9A, 0x4A, 0x6D,
+    0xA9, 0x64, 0xD6, 0x26, 0x78, 0x93, 0xDC, 0xE4, 0xFB, 0x54, 0xC5, 0xE6, 0xC5, 0x64, 0x37, 0xE1,
+    0xD5, 0xDA, 0xAD, 0xC5, 0xF7, 0x95, 0x4D, 0x65, 0x6C, 0xB4, 0x21, 0xB5, 0xA5, 0xFA, 0x13, 0xB7,
+    0xE3, 0x24, 0x85, 0x1D, 0xDE, 0xB9, 0xF3, 0xCD, 0x05, 0x9B, 0x78, 0x0A, 0x23, 0xEA, 0x96, 0x2E,
+    0x94, 0x3D, 0xCD, 0x31, 0x06, 0x62, 0xB7, 0x3F, 0xBE, 0x8A, 0x91, 0x16, 0x18, 0x94, 0x4E, 0xA3,
+    0x23, 0x36, 0x71, 0x0E, 0x23, 0xAA, 0x9E, 0xA1, 0xB7, 0x13, 0x7E, 0xB4, 0x33, 0xF5, 0x36, 0x24,
+    0xBA, 0x0C, 0xCA, 0xE5, 0xDB, 0x50, 0xB7, 0xE4, 0xFA, 0x28, 0xAE, 0x07, 0xCA, 0x08, 0xA0, 0x78,
+    0xB0, 0xF8, 0x6F, 0x73, 0xB1, 0xDF, 0x4F, 0x36, 0xD6, 0x61, 0xB3, 0x8B, 0x0B, 0x43, 0x91, 0x9A,
+    0xE0, 0x6F, 0x47, 0xAB, 0x19, 0xFF, 0x1A, 0x76, 0xE1, 0x5B, 0x3E, 0x74, 0x85, 0x34, 0x39, 0x2D,
+    0x74, 0x6B, 0x46, 0xE3, 0x27, 0xB8, 0x08, 0xE5, 0x08, 0x5D, 0x3C, 0xC1, 0x00, 0x72, 0x38, 0xD5,
+    0x56, 0x3D, 0xC5, 0x5C, 0x8F, 0xD0, 0xD5, 0x01, 0x2A, 0x85, 0xDD, 0x87, 0x1E, 0x03, 0xE2, 0xEF,
+    0xBA, 0x34, 0xFE, 0x25, 0x2E, 0xEA, 0x57, 0xBB, 0xB2, 0xF9, 0xF1, 0x00, 0x64, 0x6D, 0xB3, 0x9A,
+    0xC0, 0xBD, 0x12, 0xA1, 0x6B, 0x17, 0xF8, 0x32, 0x7F, 0x7A, 0x50, 0xA1, 0x6F, 0xB4, 0x30, 0x68,
+    0xA1, 0x92, 0x36, 0x9A, 0xED, 0x9B, 0x2B, 0x1A, 0x49, 0x85, 0x20, 0xD9, 0x15, 0xE6, 0x2A, 0xC1,
+    0x29, 0xD7, 0xBC, 0xFB, 0x62, 0x73, 0xED, 0x9A, 0x9F, 0x0A, 0x6D, 0x3E, 0x9A, 0x21, 0xF9, 0x88,
+    0x9B, 0xFD, 0x8C, 0x8B, 0x75, 0xC2, 0x45, 0xA7, 0xB6, 0x9E, 0x4A, 0x49, 0xA3, 0x91, 0x14, 0x68,
+    0xF4, 0x16, 0x19, 0x25, 0x80, 0x2F, 0x1E, 0x42, 0x7C, 0xAB, 0x16, 0xDC, 0x8F, 0x02, 0x34, 0x8F,
+    0x8C, 0x70, 0xC3, 0x8E, 0xF0, 0xB1, 0xC3, 0x15, 0xE6, 0xBE, 0x96, 0xEC, 0xD7, 0x9D, 0x94, 0xF0,
+    0xE3, 0x76, 0x99, 0xAE, 0x1D, 0x60, 0x60, 0xD8, 0x31, 0xE2, 0xA1, 0x58, 0xC1, 0xFF, 0xE5, 0x92,
+    0x4B, 0x91, 0x94, 0xEB, 0xA1, 0x58, 0xD6, 0xF5, 0x80, 0x5F, 0xC0, 0x0C, 0xEA, 0x71, 0x77, 0x34,
+    0xD3, 0xF5, 0x4D, 0x42, 0xD8, 0x15, 0x51, 0xAC, 0xA8, 0x2F, 0x13, 0xDD, 0x5E, 0x64, 0xEE, 0x31,
+    0xC3, 0x6B, 0xC7, 0x85, 0x9C, 0x9A, 0x3F, 0x80, 0xE6, 0x7F, 0x8F, 0xFB, 0xB7, 0x56, 0x6A, 0x4F,
+    0x67, 0x60, 0xEF, 0xAE, 0xAC, 0xEE, 0xE1, 0x02, 0x3C, 0xC8, 0x97, 0xC0, 0xFF, 0x8F, 0xD3, 0x6E,
+    0x73, 0xDD, 0xC6, 0x69, 0x1E, 0xC0, 0x7B, 0x20, 0xA6, 0x6C, 0x03, 0x9F, 0x3A, 0x1C, 0xA3, 0xD9,
+    0xC8, 0xF5, 0xB8, 0x53, 0x8F, 0x77, 0x59, 0xA5, 0x3E, 0x7E, 0x30, 0xCF, 0xC5, 0x7A, 0x0C, 0xE3,
+    0x9E, 0x81, 0xB2, 0xDF, 0x13, 0x6D, 0x7A, 0x57, 0x65, 0xF0, 0x71, 0xC8, 0xF5, 0xC9, 0xFC, 0xB4,
+    0x02, 0xA4, 0x83, 0x95, 0xCD, 0x69, 0x35, 0xE7, 0xD9, 0xD9, 0x24, 0x2C, 0x80, 0x89, 0x87, 0x8C,
+    0xC4, 0x1E, 0x03, 0x66, 0x27, 0xF1, 0xFA, 0x7B, 0xA1, 0x57, 0x87, 0x40, 0x29, 0x1F, 0x5D, 0x8E,
+    0xA2, 0x73, 0xEE, 0x4F, 0xF7, 0xF9, 0x00, 0x94, 0x73, 0xDD, 0x02, 0x1F, 0xE1, 0x03, 0x6F, 0x0F,
+    0xAE, 0xA4, 0x90, 0x2D, 0xB7, 0xD5, 0x86, 0x51, 0x6F, 0xD4, 0x63, 0x57, 0x6C, 0x82, 0x3A, 0x52,
+    0x47, 0xE8, 0x02, 0x43, 0x4F, 0xB1, 0x61, 0x37, 0x70, 0x33, 0x6E, 0x06, 0xFF, 0xFA, 0xB5, 0x21,
+    0x1C, 0xAA, 0x57, 0x55, 0xAE, 0x1C, 0xF9, 0x09, 0x3F, 0x82, 0x5A, 0x32, 0xF0, 0x5D, 0xE6, 0xAF,
+    0x68, 0x22, 0x0C, 0x81, 0xA1, 0xC7, 0x6E, 0xD8, 0x15, 0xEA, 0xB7, 0x68, 0xDE, 0xA2, 0xD4, 0x56,
+    0x69, 0xC5, 0x6B, 0xF6, 0x8A, 0x60, 0x9E, 0x85, 0x62, 0x83, 0x42, 0x23, 0xC5, 0x9A, 0x28, 0x96,
+    0xBA, 0x65, 0x2E, 0x76, 0x1F, 0x73, 0x2F, 0x94, 0x0A, 0x19, 0xFD, 0x7B, 0x3C, 0xED, 0x37, 0x67,
+    0x68, 0x33, 0x9E, 0xE3, 0xA6, 0xFB, 0x28, 0xE7, 0x6E, 0x2A, 0xD2, 0x90, 0x18, 0x06, 0xB5, 0x7E,
+    0x6D, 0x82, 0x5B, 0x5D, 0x2C, 0x37, 0xBB, 0x14, 0x32, 0x2B, 0x6A, 0x07, 0x7C, 0xF0, 0xA1, 0x9E,
+    0xDC, 0x54, 0xCD, 0xE5, 0x6C, 0xD7, 0x62, 0xFD, 0x73, 0xA1, 0xD5, 0x07, 0xBF, 0xD5, 0x63, 0xB9,
+    0x9E, 0xA9, 0xEB, 0xFE, 0xE3, 0x12, 0x29, 0xAE, 0xDF, 0xB9, 0x76, 0xFD, 0x4E, 0x5B, 0x4B, 0xD2,
+    0xC6, 0xEF, 0xE8, 0xB1, 0x3F, 0xDA, 0x2E, 0xFF, 0xC6, 0x24, 0x72, 0xB4, 0xE7, 0xF4, 0x4A, 0x70,
+    0xBF, 0xB2, 0x76, 0x54, 0x52, 0x5B, 0x48, 0x01, 0xBB, 0x80, 0x59, 0xAB, 0x99, 0xA1, 0x16, 0xFE,
+    0x47, 0x1A, 0xDD, 0xED, 0x67, 0xA2, 0xD5, 0xC3, 0xC9, 0xA8, 0x17, 0x43, 0xE8, 0x7A, 0x3F, 0x35,
+    0xC1, 0x45, 0x17, 0xCB, 0x64, 0x97, 0x62, 0x35, 0x2B, 0x62, 0xF8, 0x13, 0x1F, 0xBC, 0x3E, 0x17,
+    0x9D, 0xBE, 0x36, 0x1B, 0xB5, 0xD9, 0x1C, 0x5D, 0x86, 0x72, 0xF9, 0x24, 0x4E, 0x89, 0xFA, 0x4A,
+    0xE2, 0xFD, 0xD5, 0xF4, 0xB6, 0x38, 0x6D, 0xC6, 0x2B, 0x52, 0x2A, 0x07, 0xD2, 0x36, 0x41, 0x99,
+    0x72, 0x92, 0xEA, 0x96, 0xEC, 0xB8, 0x5D, 0xCC, 0x17, 0xB1, 0x99, 0x72, 0x60, 0xE6, 0xC7, 0x8C,
+    0x26, 0x0C, 0x01, 0x86, 0x1E, 0xA3, 0x91, 0x5A, 0x0B, 0x5E, 0x33, 0xE6, 0xD9, 0x7B, 0x5D, 0xBA,
+    0x58, 0x2B, 0x3D, 0xD0, 0xCC, 0xF7, 0x54, 0xFD, 0x31, 0x56, 0xDA, 0x2C, 0x28, 0xF1, 0xF8, 0x42,
+    0x39, 0x53, 0x45, 0x5C, 0xC4, 0x4D, 0x34, 0x23, 0x3E, 0xE0, 0x7B, 0xBA, 0x96, 0xE1, 0x4F, 0x18,
+    0x56, 0x86, 0x85, 0x6E, 0xE4, 0x1C, 0x50, 0x29, 0xE1, 0x94, 0x72, 0xE6, 0xF0, 0x9B, 0x5B, 0xAF,
+    0xD3, 0xDC, 0xE9, 0xC7, 0xB9, 0x44, 0x0B, 0xA6, 0x2D, 0xD4, 0x7B, 0xF1, 0xF8, 0x42, 0x3D, 0x32,
+    0x60, 0x13, 0x6E, 0x62, 0x68, 0xF3, 0x6B, 0xD7, 0x16, 0xEB, 0x9F, 0x57, 0x1A, 0x9B, 0x8D, 0x6E,
+    0xE4, 0xC2, 0x1E, 0xFA, 0xBB, 0xFE, 0x77, 0x71, 0xDF, 0x7B, 0x1E, 0xA7, 0x98, 0xF1, 0xA8, 0x7B,
+    0x7F, 0x73, 0xC2, 0xE5, 0xDC, 0x45, 0xFE, 0xAF, 0xB5, 0x7E, 0x58, 0xA9, 0x54, 0x9F, 0x3D, 0xDD,
+    0xBD, 0x34, 0x8B, 0x55, 0x3C, 0x1A, 0x7A, 0xB3, 0x52, 0x45, 0x7C, 0x60, 0xA3, 0x9A, 0xF3, 0x6B,
+    0x39, 0xD3, 0xFC, 0xA0, 0x1D, 0xD6, 0x42, 0x53, 0xB9, 0x1E, 0x47, 0xB6, 0xD2, 0x68, 0x25, 0x8C,
+    0x02, 0x76, 0xCD, 0x0B, 0xE8, 0x02, 0xC5, 0x9E, 0x4E, 0xF9, 0x9C, 0xE6, 0x97, 0x29, 0x2F, 0x49,
+    0x6D, 0xD6, 0xE0, 0xAC, 0xD2, 0xC5, 0x06, 0xF5, 0x4A, 0xA9, 0x2D, 0x57, 0xE2, 0xEA, 0x16, 0x13,
+    0x73, 0xD4, 0xDA, 0xE5, 0x90, 0xD5, 0xE8, 0x24, 0x49, 0x70, 0x73, 0xB9, 0x22, 0x3E, 0x08, 0x98,
+    0xB6, 0x59, 0xBC, 0x8E, 0x86, 0xBE, 0x1E, 0xAB, 0x68, 0x13, 0x1B, 0x43, 0xEB, 0x83, 0x9B, 0xCA,
+    0xB9, 0x58, 0xFF, 0x7C, 0x58, 0x9B, 0xAD, 0x5C, 0x79, 0x82, 0x8B, 0x3C, 0x80, 0x0B, 0x56, 0xBD,
+    0x3F, 0x89, 0x3D, 0x6F, 0x40, 0xB9, 0xA3, 0x0F, 0x37, 0x7F, 0x41, 0x13, 0xA4, 0x40, 0x17, 0xD9,
+    0xAF, 0xDF, 0x61, 0x95, 0xBB, 0x1D, 0xC3, 0x07, 0x8C, 0xA0, 0x3A, 0xEC, 0xAA, 0xCD, 0xBB, 0x8A,
+    0x30, 0xF4, 0x94, 0x6A, 0x8D, 0xD4, 0x3B, 0xAD, 0x70, 0xB9, 0x59, 0x94, 0x1E, 0x5F, 0xCA, 0xB9,
+    0x8A, 0x2E, 0xBA, 0xA9, 0x19, 0x7D, 0xF0, 0x7D, 0xD7, 0x0E, 0x7F, 0x32, 0xAC, 0xC3, 0xD2, 0x8D,
+    0xE7, 0x4E, 0xD7, 0x35, 0xB3, 0xE9, 0x28, 0xB5, 0x61, 0x14, 0x4E, 0x19, 0x53, 0x77, 0xC6, 0x98,
+    0x2A, 0x8B, 0x76, 0xC9, 0xEB, 0x18, 0xE9, 0x02, 0x88, 0x22, 0x0B, 0xB6, 0x5A, 0xA0, 0x39, 0x31,
+    0x1D, 0x60, 0xD7, 0xB7, 0x99, 0x0E, 0x65, 0x7B, 0xBC, 0x42, 0xBD, 0xE2, 0x22, 0xA5, 0x36, 0x86,
+    0x80, 0xD7, 0x9C, 0x93, 0xDD, 0x5C, 0xBA, 0x28, 0x82, 0x7A, 0xA0, 0xBE, 0x9D, 0x38, 0xAE, 0x08,
+    0x98, 0x7C, 0x5F, 0xCC, 0x37, 0x4E, 0x04, 0x95, 0xA8, 0x83, 0x9B, 0x51, 0xDB, 0x8D, 0x65, 0x42,
+    0xD4, 0x93, 0xB9, 0x9A, 0xAB, 0x05, 0x70, 0x2F, 0x47, 0x6D, 0xB3, 0x94, 0x7A, 0x5A, 0xD1, 0x6F,
+    0x47, 0x43, 0xFF, 0xF8, 0x6C, 0x56, 0x9A, 0xB1, 0x8A, 0x0C, 0x99, 0x50, 0xB0, 0xE1, 0x62, 0x35,
+    0xD3, 0xF5, 0x3E, 0x14, 0x2B, 0x1B, 0x2E, 0x96, 0x33, 0x3E, 0x34, 0x3F, 0x78, 0x68, 0x63, 0x58,
+    0xAB, 0xB9, 0xD0, 0xE4, 0x43, 0xB9, 0x22, 0x0C, 0xE5, 0x92, 0x1D, 0x5D, 0x61, 0x36, 0xF0, 0xD7,
+    0x63, 0x4E, 0xF6, 0xAD, 0x66, 0x28, 0xFE, 0x9F, 0xD3, 0x24, 0xA0, 0x70, 0x80, 0xB1, 0x86, 0x04,
+    0x76, 0x59, 0xC1, 0x4D, 0x1E, 0xAA, 0xF6, 0x9E, 0xD3, 0x07, 0xDC, 0x68, 0x01, 0xAF, 0x08, 0xA5,
+    0x5A, 0x72, 0x21, 0xD8, 0x1E, 0x87, 0x31, 0x65, 0x22, 0x1F, 0x6D, 0xCE, 0x2D, 0x4E, 0xA2, 0x85,
+    0x0C, 0x92, 0x4D, 0x87, 0x24, 0x32, 0xD7, 0x55, 0x8E, 0xB3, 0x1A, 0xF5, 0x80, 0xDA, 0xBD, 0x9A,
+    0x6D, 0x37, 0x78, 0x7F, 0x99, 0xF6, 0xBA, 0xB2, 0xD7, 0xB4, 0x17, 0x6D, 0xDF, 0xB7, 0xA7, 0x91,
+    0xBF, 0xB7, 0x8B, 0xBA, 0x50, 0x0F, 0x37, 0x13, 0xD4, 0x4F, 0x4F, 0x94, 0xD3, 0x03, 0xF0, 0x31,
+    0xFA, 0x93, 0x64, 0xA4, 0xD2, 0x6E, 0xCB, 0x8F, 0x74, 0x38, 0x1B, 0x01, 0xF5, 0xB4, 0xC7, 0x5D,
+    0x4D, 0xD8, 0x17, 0xED, 0xFB, 0xAC, 0xCD, 0x0C, 0xED, 0xE9, 0xF7, 0x8D, 0xB9, 0x40, 0x88, 0x0F,
+    0x7C, 0xAC, 0x9A, 0x29, 0xFF, 0x6E, 0xCB, 0xC7, 0x59, 0x2A, 0xC2, 0x87, 0x5F, 0x3B, 0xAD, 0xF3,
+    0x51, 0x1B, 0x5E, 0x93, 0x12, 0xE5, 0x86, 0x1F, 0xB1, 0x29, 0xDF, 0xD6, 0x32, 0x41, 0x99, 0xEA,
+    0x08, 0xD5, 0xD2, 0xF5, 0xE0, 0x7E, 0xB6, 0x01, 0xEE, 0xEE, 0x02, 0xD4, 0x9A, 0x80, 0x46, 0x11,
+    0xF0, 0xB7, 0x17, 0xC0, 0xFF, 0x20, 0x01, 0xFE, 0x96, 0x80, 0x2E, 0xA8, 0x87, 0xA1, 0x1F, 0x26,
+    0x50, 0xEB, 0x17, 0x8C, 0xAE, 0xD6, 0x1B, 0xB5, 0xE6, 0x52, 0xC1, 0x2B, 0x1A, 0xF5, 0x87, 0xD0,
+    0x36, 0x47, 0x4B, 0x4D, 0x38, 0xC6, 0x00, 0xF6, 0xE7, 0xA6, 0xDD, 0x6F, 0x2A, 0xF0, 0xEC, 0x9E,
+    0x2F, 0xD4, 0x02, 0x25, 0xCC, 0x95, 0x08, 0x5D, 0x4F, 0x71, 0x80, 0x0D, 0xFB, 0xCB, 0x26, 0x35,
+    0xB1, 0xFC, 0xA9, 0xA6, 0xE6, 0x66, 0x17, 0x34, 0xDE, 0xB4, 0xAB, 0x9D, 0xEB, 0xA9, 0x09, 0x43,
+    0x91, 0xEC, 0xA6, 0xDE, 0x69, 0xA4, 0x1B, 0xDA, 0x22, 0x0D, 0xB8, 0xA8, 0xD6, 0xBF, 0xA0, 0xD7,
+    0xB6, 0x42, 0xFF, 0x65, 0x36, 0x02, 0x5A, 0x8E, 0x72, 0x08, 0x67, 0xE7, 0xAC, 0x46, 0x0F, 0xE6,
+    0xA0, 0xE8, 0x9E, 0x9C, 0x21, 0xDF, 0x5B, 0xAF, 0x66, 0xF3, 0x5B, 0xA5, 0xFB, 0xD7, 0x7A, 0x33,
+    0xA9, 0xFB, 0x5F, 0x4C, 0x5A, 0x28, 0x34, 0x61, 0x15, 0xB0, 0x9A, 0x28, 0xEF, 0x46, 0xAA, 0x9F,
+    0xCE, 0xB8, 0x37, 0xD3, 0x39, 0x37, 0xE9, 0xDF, 0xD4, 0xE3, 0xB0, 0x36, 0xA3, 0x5F, 0x7C, 0xA8,
+    0xA7, 0xB7, 0xB1, 0x2A, 0x8A, 0x65, 0xA7, 0x1B, 0x0D, 0x71, 0x07, 0xE0, 0xAF, 0x9E, 0x85, 0xAC,
+    0x76, 0xDD, 0xEC, 0xA6, 0x5D, 0x2B, 0xBB, 0xB0, 0x2B, 0xE5, 0xD0, 0xEF, 0xEA, 0xA8, 0x5D, 0x1B,
+    0x0B, 0xED, 0x41, 0x9B, 0x5D, 0x01, 0x1F, 0xCC, 0xD5, 0x32, 0x71, 0x89, 0x21, 0x94, 0x93, 0x5B,
+    0x58, 0x8D, 0xDE, 0xD0, 0x0B, 0x92, 0x16, 0xAF, 0x83, 0x23, 0x7A, 0x82, 0x32, 0xD1, 0x25, 0xA3,
+    0xC9, 0xBC, 0xB6, 0x23, 0x76, 0xA5, 0x7A, 0xA7, 0x70, 0x34, 0x64, 0x6F, 0x09, 0x02, 0x61, 0x36,
+    0x8A, 0x15, 0x9B, 0xB0, 0x09, 0x7B, 0xD6, 0xB9, 0xD6, 0xD9, 0xBF, 0xFE, 0x10, 0x2F, 0xFC, 0x46,
+    0x33, 0x1F, 0xDB, 0xFF, 0xDF, 0xF0, 0xDA, 0xF9, 0xC2, 0xAE, 0x23, 0x26, 0x65, 0xB2, 0x5D, 0x8E,
+    0x9D, 0x6F, 0xB0, 0x97, 0xBE, 0x4D, 0x5B, 0x6F, 0x56, 0xF1, 0xFE, 0x8D, 0x7A, 0x2C, 0x52, 0xB6,
+    0x32, 0x3B, 0x79, 0xDC, 0x45, 0x4E, 0xFE, 0x75, 0xD9, 0xFF, 0xF5, 0xDF, 0x3A, 0x05, 0x2D, 0xD5,
+    0xCA, 0x39, 0x4C, 0x4B, 0xCA, 0x3C, 0x65, 0xD7, 0xDA, 0xF1, 0x90, 0xEA, 0x5D, 0x3E, 0x04, 0xEA,
+    0x2E, 0x38, 0xA5, 0xA7, 0xF0, 0xFA, 0xFB, 0x48, 0xBD, 0xB8, 0x1E, 0x3F, 0x5E, 0xC4, 0x88, 0xCB,
+    0x79, 0x6F, 0xCD, 0xB4, 0x5F, 0x7D, 0x9B, 0xCE, 0x14, 0x0B, 0xB6, 0x83, 0xF9, 0xF0, 0xC1, 0x5C,
+    0x35, 0xC2, 0xF5, 0x55, 0xE2, 0x29, 0xFC, 0x64, 0x67, 0xA3, 0x37, 0x14, 0x3A, 0x69, 0xCB, 0xC8,
+    0x07, 0x47, 0xA6, 0xED, 0x96, 0x4B, 0x4E, 0x2F, 0x4D, 0x8F, 0x2F, 0x37, 0xE8, 0x3E, 0x17, 0xAA,
+    0x38, 0x23, 0x87, 0x8B, 0xAD, 0xC9, 0x00, 0xD4, 0xA1, 0xD8, 0xB1, 0x40, 0xD7, 0x52, 0x45, 0xC8,
+    0x94, 0xC1, 0xC3, 0xAF, 0xD7, 0x6F, 0xE1, 0x85, 0xD5, 0x44, 0x33, 0x9F, 0x0A, 0x4A, 0xA5, 0x90,
+    0xCF, 0x25, 0x13, 0x66, 0x8E, 0xAB, 0x19, 0x5D, 0x80, 0x62, 0xE3, 0x09, 0x5C, 0x2E, 0x66, 0xFB,
+    0xD1, 0x08, 0x51, 0x25, 0x9E, 0xDD, 0x4B, 0x38, 0x79, 0x3F, 0x1F, 0xA4, 0x8E, 0x2C, 0x0C, 0xA1,
+    0x9C, 0xEC, 0x86, 0x6F, 0xEB, 0x6D, 0x48, 0xA5, 0xB4, 0x93, 0xBF, 0x38, 0x82, 0x6E, 0xC1, 0x29,
+    0xF0, 0xF8, 0xD9, 0x85, 0xC5, 0xE3, 0x85, 0x25, 0xD7, 0xFB, 0x5B, 0xC9, 0x2E, 0x5D, 0xE8, 0x1E,
+    0x9E, 0xAB, 0x78, 0xEF, 0x3F, 0x6B, 0xDD, 0xFF, 0xA4, 0x2A, 0xFD, 0x6F, 0xE0, 0x14, 0x41, 0x6F,
+    0xE5, 0x6A, 0x5D, 0xA5, 0xBD, 0xD2, 0x7E, 0xF7, 0x9F, 0xA3, 0x4A, 0xA6, 0x35, 0x9A, 0xAC, 0xA2,
+    0xB9, 0x32, 0x51, 0x8F, 0x34, 0x01, 0x1F, 0xF0, 0x81, 0xAE, 0x67, 0x78, 0x1E, 0x2D, 0xA8, 0xB7,
+    0x1B, 0xCD, 0x8A, 0x3F, 0xD6, 0xFE, 0x85, 0x6A, 0xC6, 0xFD, 0x43, 0x70, 0x0A, 0x4E, 0x7D, 0xB5,
+    0x9E, 0x41, 0x7B, 0x76, 0xDE, 0x45, 0x1D, 0x8E, 0x0B, 0xE4, 0x74, 0xCB, 0x49, 0x36, 0xF5, 0x5B,
+    0x6F, 0xCF, 0x9B, 0xFC, 0x46, 0xAD, 0xC9, 0x29, 0x94, 0xB9, 0x58, 0xD5, 0x8C, 0x38, 0x51, 0x46,
+    0xAC, 0xA6, 0x62, 0xC1, 0x28, 0xB1, 0xC2, 0xA0, 0xD6, 0x83, 0x1F, 0x62, 0x1D, 0x70, 0x3F, 0x58,
+    0xAB, 0x48, 0x19, 0xF5, 0xD5, 0x85, 0x22, 0xD5, 0x71, 0x85, 0x9B, 0x76, 0xF3, 0xE0, 0xDB, 0xE1,
+    0x47, 0x01, 0x17, 0x9C, 0x22, 0x65, 0x2C, 0xB4, 0x50, 0x24, 0xFC, 0x0A, 0x1B, 0x95, 0xA0, 0xBB,
+    0x6A, 0x14, 0x8C, 0x36, 0xFC, 0xC4, 0xA0, 0x76, 0xA7, 0x5C, 0xE6, 0xA5, 0x7F, 0xF4, 0xE0, 0x2E,
+    0xD7, 0xDD, 0x95, 0x95, 0x71, 0x4F, 0x5F, 0xDD, 0x69, 0x50, 0xA1, 0x3D, 0xA2, 0xDE, 0xAA, 0xD5,
+    0xEA, 0x55, 0xC5, 0xFB, 0x37, 0x89, 0x5A, 0x2E, 0x1A, 0x85, 0x8D, 0x26, 0xD6, 0xA3, 0xDD, 0x8A,
+    0x84, 0x0F, 0x3E, 0x94, 0x4B, 0xB9, 0x30, 0xB4, 0x43, 0xEB, 0xA2, 0x8B, 0x08, 0x7D, 0xB2, 0x9E,
+    0x9C, 0x5E, 0x5C, 0xD1, 0xEC, 0x43, 0xB5, 0x9C, 0x06, 0x71, 0xFF, 0x7B, 0xD8, 0x7E, 0xB6, 0xB8,
+    0x26, 0x47, 0x3C, 0x3B, 0x33, 0x72, 0x04, 0x28, 0xA7, 0x93, 0xE7, 0xDD, 0x2C, 0x3F, 0xCA, 0x65,
+    0xA3, 0x69, 0x18, 0xFD, 0xE6, 0x65, 0xAE, 0xDC, 0x56, 0x34, 0x8A, 0xA2, 0x4E, 0x6E, 0x2A, 0x64,
+    0x56, 0xFC, 0xD4, 0x04, 0x9B, 0x6C, 0xA2, 0xEB, 0xBB, 0xBE, 0x9A, 0xAB, 0x19, 0x21, 0x5C, 0x74,
+    0x7F, 0xFF, 0xC2, 0x86, 0x52, 0x33, 0x3A, 0x3D, 0x9C, 0x32, 0x28, 0xDD, 0xE6, 0x10, 0xDE, 0x8D,
+    0xBB, 0xD4, 0xAB, 0x00, 0xCC, 0x7B, 0x45, 0xBA, 0x38, 0xC3, 0x0B, 0x2E, 0x47, 0x20, 0x55, 0x11,
+    0x68, 0xBE, 0x3E, 0xB1, 0x23, 0x89, 0x07, 0x95, 0x2A, 0xC7, 0xFF, 0x2E, 0x55, 0x0A, 0xF8, 0xB2,
+    0x8D, 0x94, 0x21, 0x81, 0xF7, 0x39, 0x23, 0xCF, 0xF6, 0xEF, 0x26, 0x27, 0x85, 0x82, 0x77, 0x54,
+    0xA5, 0x9E, 0x3D, 0x0E, 0x59, 0x73, 0x38, 0xC6, 0xC0, 0xA1, 0xD7, 0x66, 0x8F, 0x20, 0x36, 0x2E,
+    0x9B, 0xCB, 0x65, 0x1C, 0xA6, 0x61, 0xBC, 0xE4, 0xF4, 0x8C, 0x02, 0xF7, 0x6D, 0x83, 0xC0, 0xEA,
+    0x56, 0x82, 0x3A, 0xB9, 0x09, 0x86, 0xB1, 0x6B, 0xB1, 0x5B, 0x8E, 0x24, 0x72, 0xD6, 0xE2, 0x7B,
+    0x8A, 0xD5, 0xAC, 0xE0, 0x62, 0x15, 0xC1, 0x07, 0xFF, 0x32, 0x08, 0x25, 0xCA, 0xC5, 0x6A, 0xA4,
+    0x09, 0xD5, 0xCA, 0xE9, 0x5A, 0xF2, 0x7B, 0x7D, 0x06, 0x26, 0x01, 0x45, 0xBB, 0x01, 0x66, 0x1D,
+    0x72, 0xD8, 0xDE, 0x02, 0xB5, 0xDA, 0xE3, 0xA8, 0xFD, 0x51, 0x2E, 0xD7, 0x5B, 0xB5, 0xFA, 0xCD,
+    0xEB, 0xFE, 0x4D, 0x32, 0x8A, 0x32, 0x0A, 0x5B, 0x21, 0xB3, 0xDA, 0xAD, 0x58, 0x6D, 0xB2, 0xA9,
+    0x5C, 0x6C, 0xAA, 0xE6, 0x72, 0x71, 0xB1, 0x9A, 0x5D, 0x74, 0xB1, 0x9E, 0x5C, 0x6C, 0xC6, 0x7A,
+    0xF4, 0xA1, 0x09, 0x59, 0xC6, 0x5D, 0x4B, 0x2F, 0x8A, 0x7F, 0x58, 0xB1, 0x5A, 0xB2, 0x5E, 0xFE,
+    0xC7, 0x96, 0x3D, 0xC6, 0x6D, 0x72, 0x39, 0xEE, 0x6C, 0x27, 0x90, 0xF9, 0x06, 0x3B, 0x4B, 0xD3,
+    0x4B, 0x23, 0xDD, 0x36, 0xA4, 0xCC, 0x68, 0xF5, 0x11, 0x1F, 0x9B, 0x99, 0x6A, 0x75, 0x09, 0xA3,
+    0x47, 0x56, 0xE8, 0x7E, 0x22, 0xA8, 0x67, 0x05, 0xCA, 0xD5, 0x47, 0x0A, 0x7D, 0x2E, 0x81, 0x6E,
+    0x09, 0xFC, 0xA4, 0x40, 0x33, 0xFB, 0x88, 0x4B, 0x99, 0xC8, 0xAA, 0xA9, 0x5E, 0x69, 0xA4, 0x75,
+    0x2F, 0x46, 0x7F, 0x58, 0xAF, 0x1D, 0x0C, 0x4D, 0xA9, 0x84, 0xD3, 0x4A, 0x75, 0x8A, 0x3A, 0xFA,
+    0x4E, 0x10, 0xEE, 0x38, 0xC7, 0x05, 0x70, 0x7C, 0x1C, 0xCA, 0xF9, 0x49, 0x40, 0x3A, 0x54, 0x3C,
+    0x4F, 0x51, 0x86, 0xDE, 0x7D, 0xAA, 0x31, 0xA6, 0x85, 0x32, 0xBC, 0x9F, 0x6A, 0x7A, 0xFE, 0x84,
+    0xD1, 0x78, 0xEF, 0x3B, 0xB8, 0xF1, 0x43, 0x55, 0xE7, 0x93, 0x50, 0x24, 0x37, 0x81, 0x5E, 0xCA,
+    0xC7, 0xD5, 0xE2, 0xA6, 0xAE, 0x85, 0xF1, 0x84, 0x18, 0x7C, 0xFE, 0xB9, 0xC3, 0x81, 0x3B, 0x69,
+    0xCE, 0x02, 0x40, 0x63, 0xB5, 0xE1, 0x23, 0x3E, 0x56, 0x2B, 0x85, 0x5A, 0x05, 0xEA, 0xB9, 0x9E,
+    0x31, 0xFA, 0xAA, 0xA0, 0x9E, 0x7D, 0xC4, 0xE8, 0x61, 0x91, 0xCF, 0xD8, 0xCA, 0x0A, 0xFC, 0xE4,
+    0x23, 0xD5, 0x6A, 0x05, 0x0A, 0xCD, 0x82, 0x8F, 0xF9, 0xD0, 0x2B, 0x49, 0x6D, 0x16, 0x02, 0x57,
+    0x74, 0xF5, 0x4C, 0x8D, 0xF0, 0x7D, 0xA6, 0xC7, 0x4E, 0x09, 0xBB, 0x6C, 0x14, 0xCB, 0x80, 0x59,
+    0x3A, 0x58, 0x1E, 0x80, 0x73, 0x87, 0xBB, 0x7A, 0x1F, 0x18, 0x25, 0x0A, 0x29, 0x14, 0xBA, 0x32,
+    0x9B, 0xAD, 0x10, 0xA2, 0x0B, 0x5D, 0xEF, 0x62, 0x33, 0xDA, 0xE4, 0xA2, 0xD9, 0x6C, 0x62, 0x68,
+    0x75, 0xC0, 0xFE, 0xE6, 0x3A, 0x16, 0xBA, 0x1E, 0xF1, 0x8A, 0x59, 0x24, 0x67, 0xEA, 0xAF, 0x5F,
+    0x3A, 0xE4, 0x28, 0x46, 0x2D, 0x58, 0x85, 0x9D, 0x98, 0x7C, 0xC2, 0x1D, 0xE2, 0x8F, 0x9F, 0x83,
+    0x4A, 0x9A, 0x33, 0xFB, 0xCD, 0x5E, 0x9F, 0xBB, 0x98, 0xCB, 0xF9, 0x46, 0xA8, 0xA5, 0xEB, 0xFD,
+    0x48, 0x33, 0xB9, 0x88, 0x9B, 0xAB, 0x84, 0x4D, 0x65, 0xC2, 0xE8, 0x7A, 0xCA, 0x60, 0x76, 0x8E,
+    0x83, 0xDC, 0xCF, 0x36, 0xB0, 0xC9, 0x8F, 0x18, 0x95, 0x09, 0x86, 0x5E, 0x01, 0x3F, 0xD6, 0x89,
+    0xFA, 0xAD, 0x42, 0xA1, 0xD3, 0xE8, 0x57, 0xAF, 0x98, 0x29, 0x6A, 0xE7, 0x0E, 0x3C, 0xA2, 0xFE,
+    0x9F, 0xE0, 0x11, 0x5D, 0x3E, 0x32, 0x9A, 0xE4, 0xF4, 0x4C, 0xBA, 0x6F, 0x1D, 0xA2, 0xFD, 0xF9,
+    0xDD, 0xB6, 0x5E, 0x61, 0x98, 0x4E, 0x10, 0x9B, 0x80, 0xD9, 0x72, 0x3D, 0xD6, 0x87, 0x0C, 0xDE,
+    0xEC, 0x80, 0xC9, 0x7B, 0xB3, 0xA3, 0x67, 0x8F, 0xB1, 0x76, 0xDF, 0x1F, 0x1C, 0xA9, 0x9D, 0x0E,
+    0x88, 0x7B, 0xF6, 0xD7, 0x47, 0x5C, 0x2E, 0xF5, 0x74, 0x72, 0x7A, 0x26, 0x1D, 0x75, 0x57, 0x12,
+    0xBE, 0xFB, 0x36, 0xDD, 0x0C, 0xC3, 0x94, 0x83, 0x72, 0xF5, 0xA0, 0x8C, 0x03, 0x17, 0x3B, 0x70,
+    0x66, 0x53, 0xDE, 0x58, 0x35, 0x1F, 0xC0, 0xBA, 0xFC, 0xDD, 0xD5, 0x78, 0xD2, 0x67, 0x7A, 0x69,
+    0x0F, 0x99, 0xF6, 0xC7, 0xBF, 0xE2, 0x12, 0x54, 0xA1, 0x6B, 0x31, 0xA9, 0x63, 0xA7, 0xDF, 0x58,
+    0x1D, 0x13, 0xDA, 0xDE, 0xBB, 0x43, 0xFF, 0xA5, 0x25, 0x4E, 0x7F, 0x52, 0xE2, 0xFC, 0xB5, 0x0E,
+    0xFD, 0x38, 0x87, 0xAD, 0x62, 0x66, 0x7B, 0x35, 0x6B, 0xFE, 0x03, 0xC7, 0x77, 0xFF, 0xCF, 0x2E,
+    0x63, 0xA4, 0xBE, 0x90, 0xE6, 0x42, 0x7F, 0xB8, 0x22, 0x3C, 0x5D, 0x70, 0xA1, 0x8E, 0x76, 0x2C,
+    0xB7, 0xBD, 0xF8, 0xDC, 0xA8, 0xA7, 0xC8, 0x0D, 0xA5, 0x01, 0x94, 0x23, 0xF8, 0x99, 0x21, 0x3C,
+    0x49, 0x1D, 0x9B, 0xBE, 0x4C, 0x6E, 0xB6, 0x9B, 0xD5, 0x6D, 0x31, 0x48, 0x14, 0x5A, 0x8F, 0x43,
+    0x8C, 0x1E, 0xCA, 0x00, 0xBE, 0xA5, 0x48, 0x19, 0xDE, 0x58, 0xB3, 0x4A, 0x9F, 0x70, 0x2E, 0x8C,
+    0x96, 0x5C, 0xC0, 0xFD, 0x7C, 0xA8, 0xE2, 0x6F, 0xE1, 0xC7, 0x7C, 0xF6, 0x8A, 0xF9, 0xBF, 0xAC,
+    0x07, 0x35, 0x42, 0x36, 0x59, 0x5D, 0x1F, 0x2B, 0x6D, 0x94, 0x1A, 0x4F, 0xA5, 0x4C, 0x66, 0xC9,
+    0x70, 0x8E, 0xD1, 0x8C, 0x59, 0x3B, 0x8A, 0xB5, 0x1C, 0xF9, 0x72, 0xD6, 0xBE, 0xDF, 0xF4, 0x0E,
+    0x3F, 0x91, 0xD5, 0xB2, 0x49, 0x98, 0x3B, 0x33, 0xEE, 0x56, 0x24, 0x95, 0xC1, 0xF4, 0xF7, 0x1C,
+    0x1B, 0xF2, 0x6E, 0xA3, 0x54, 0xA2, 0xFB, 0xA3, 0x58, 0xA4, 0xA2, 0x75, 0x33, 0x34, 0x4B, 0x26,
+    0x4D, 0xFA, 0x94, 0x7F, 0x6E, 0x62, 0x19, 0x7C, 0xF0, 0x41, 0xE8, 0x8D, 0xB9, 0x90, 0x7A, 0xA3,
+    0x03, 0x35, 0xE8, 0x37, 0xBA, 0xF6, 0xBF, 0xDE, 0xD3, 0xDE, 0xF2, 0x40, 0xB4, 0x4C, 0x3B, 0xF8,
+    0xF4, 0x85, 0x7D, 0xED, 0x46, 0x0B, 0x9D, 0x42, 0xFD, 0x37, 0xA9, 0x48, 0x45, 0xEB, 0x47, 0x0A,
+    0xF5, 0x38, 0xE5, 0x95, 0x0F, 0x13, 0x85, 0x4C, 0x74, 0xD1, 0x07, 0x59, 0x5D, 0x1F, 0x9B, 0x9D,
+    0x66, 0x70, 0x0E, 0xCE, 0xE7, 0x2B, 0x7B, 0x3E, 0x42, 0x03, 0xD5, 0x48, 0x39, 0xC3, 0xC7, 0x0E,
+    0xA7, 0xF5, 0x69, 0x9E, 0xA7, 0x9C, 0x7C, 0x8F, 0xFF, 0xDC, 0x88, 0xD1, 0x7C, 0x28, 0x8B, 0x71,
+    0xA2, 0x91, 0x74, 0x9A, 0x68, 0xA4, 0xB6, 0x5A, 0x1F, 0x9F, 0x11, 0x9E, 0x3A, 0xDA, 0x68, 0xC4,
+    0x83, 0x99, 0x26, 0xAD, 0xB8, 0xE7, 0x8F, 0x8D, 0x02, 0x0C, 0x22, 0x6F, 0xBB, 0x50, 0x70, 0x6D,
+    0x95, 0xCC, 0x4C, 0x17, 0x9A, 0xBE, 0x4C, 0x76, 0x45, 0xBD, 0xDF, 0x14, 0x0B, 0x29, 0xED, 0x1B,
+    0x3F, 0x28, 0x8D, 0xE3, 0x79, 0xEA, 0x87, 0x23, 0xEE, 0xE5, 0x91, 0x4A, 0x2D, 0x76, 0xDB, 0x43,
+    0xB2, 0x0B, 0xA7, 0x7D, 0x70, 0x4F, 0xA7, 0x60, 0xD6, 0xCF, 0x87, 0x22, 0x15, 0xAD, 0x5D, 0x77,
+    0xF8, 0x4F, 0x31, 0x8B, 0xA0, 0xDA, 0xA0, 0x10, 0x35, 0xC2, 0x07, 0xE1, 0xEF, 0xAC, 0x34, 0x5A,
+    0xB2, 0x72, 0x9E, 0x3B, 0xC5, 0x96, 0x58, 0x6B, 0x49, 0xA9, 0xB9, 0xA3, 0x6F, 0x26, 0x6F, 0x64,
+    0x92, 0x2F, 0x64, 0xE6, 0x4B, 0xC5, 0x56, 0xC4, 0x0F, 0xD8, 0xD5, 0xF4, 0xA7, 0x51, 0xCC, 0x74,
+    0xA0, 0x2B, 0xBA, 0x13, 0x6E, 0xFE, 0x09, 0x8A, 0x79, 0x0C, 0x65, 0x0E, 0xAF, 0x81, 0xCB, 0xFE,
+    0xFA, 0x38, 0x5E, 0xFA, 0xEB, 0xE3, 0xC6, 0x9C, 0xEE, 0xD8, 0xAC, 0xA5, 0x03, 0x3B, 0x27, 0xE3,
+    0x75, 0x55, 0xC0, 0x4D, 0x94, 0x0B, 0xC5, 0xCA, 0x79, 0xC9, 0x49, 0x2F, 0x5E, 0xBF, 0x73, 0xB5,
+    0x9A, 0xB1, 0xC7, 0x24, 0xC6, 0x7A, 0xA2, 0x9A, 0xB1, 0x09, 0x64, 0x82, 0xFF, 0xCF, 0xB3, 0x53,
+    0xB2, 0x4A, 0x74, 0x33, 0xB4, 0x98, 0xAB, 0x98, 0x0D, 0xEA, 0x80, 0x9D, 0xB0, 0x91, 0x32, 0x9E,
+    0xC2, 0xC2, 0x6C, 0x5F, 0xF5, 0x94, 0xA3, 0xEF, 0xB1, 0xF3, 0x4A, 0x3E, 0xD9, 0x8C, 0xB4, 0x36,
+    0x6F, 0xA7, 0x8F, 0xBC, 0x3B, 0x02, 0xA9, 0xFA, 0xDC, 0xD3, 0xB0, 0x40, 0x19, 0x68, 0x1E, 0xC0,
+    0x2E, 0x91, 0x7A, 0x82, 0xA1, 0xE5, 0xC3, 0x4A, 0x56, 0x8A, 0xEF, 0x1B, 0x5E, 0x6F, 0x8B, 0xF5,
+    0xB8, 0x46, 0x70, 0xDA, 0x78, 0x0A, 0x6C, 0x2A, 0x71, 0x3F, 0xBB, 0x81, 0x57, 0x44, 0xCA, 0x34,
+    0xFA, 0x0B, 0xBF, 0xCA, 0x36, 0x8A, 0x9D, 0x69, 0x1D, 0xFF, 0x85, 0xDB, 0xF8, 0x6F, 0x9C, 0x57,
+    0x25, 0x7D, 0x46, 0x0A, 0xFF, 0xF8, 0x79, 0x1D, 0x82, 0xEB, 0xE5, 0x22, 0xA0, 0xDB, 0x01, 0x9A,
+    0x6E, 0x01, 0x33, 0x6E, 0xBF, 0xD0, 0xDA, 0x8A, 0x57, 0xF4, 0xFA, 0xA9, 0x36, 0xAB, 0xB5, 0xDC,
+    0x28, 0x57, 0xBA, 0x80, 0x0F, 0x55, 0xA2, 0x5C, 0x18, 0x7A, 0x86, 0xD6, 0xCD, 0x54, 0x31, 0x83,
+    0x8D, 0x75, 0xC4, 0x4D, 0x85, 0x30, 0x2B, 0x7E, 0xA2, 0x19, 0xED, 0x4A, 0x91, 0x32, 0x2A, 0x53,
+    0x26, 0xEC, 0x42, 0x17, 0x18, 0x28, 0x57, 0xEA, 0x48, 0x37, 0x7F, 0x78, 0xC5, 0x4A, 0xEA, 0x71,
+    0xC7, 0xCC, 0xBB, 0x43, 0x40, 0x66, 0x9E, 0x3B, 0x07, 0xDD, 0xAD, 0x31, 0x6F, 0x3A, 0xAA, 0xE7,
+    0xE8, 0xFC, 0x78, 0x86, 0x9D, 0x78, 0xB9, 0x5E, 0x91, 0xD5, 0xE4, 0xE2, 0xFD, 0xAB, 0xD9, 0xA8,
+    0x43, 0x33, 0x16, 0xC9, 0xEE, 0x19, 0xE7, 0x5C, 0x2E, 0x0C, 0xA8, 0x75, 0xB1, 0x8E, 0x6C, 0x56,
+    0xD4, 0xE3, 0x10, 0x3F, 0x93, 0x9A, 0xEE, 0x89, 0x46, 0x2F, 0xEB, 0x45, 0xC5, 0x2E, 0xBA, 0xC5,
+    0x2E, 0xFB, 0x65, 0x94, 0xC2, 0x3E, 0x17, 0xE1, 0x97, 0x51, 0x0F, 0xDF, 0x1B, 0x01, 0x54, 0x5A,
+    0xF2, 0xC2, 0xCE, 0x54, 0x37, 0xDF, 0xD9, 0x7D, 0x5F, 0xA0, 0x05, 0xD7, 0xFE, 0xEE, 0x81, 0x96,
+    0xE8, 0x32, 0xFC, 0xBF, 0xC0, 0x99, 0x54, 0xE1, 0x3D, 0xD3, 0x01, 0xCE, 0xC1, 0x62, 0x02, 0xEE,
+    0x7B, 0xCF, 0x67, 0x63, 0x5E, 0x28, 0x9C, 0x82, 0x1F, 0xDE, 0x51, 0x59, 0x98, 0xCB, 0xEC, 0x34,
+    0x70, 0x2E, 0x75, 0x40, 0x19, 0x22, 0xF0, 0x44, 0x0D, 0xD8, 0x37, 0x26, 0xB2, 0x43, 0x3E, 0x11,
+    0x8B, 0x95, 0xAC, 0xE4, 0x35, 0x79, 0x8D, 0xDD, 0x44, 0x37, 0x96, 0x09, 0x9B, 0x18, 0x02, 0x5D,
+    0x5F, 0x2D, 0x54, 0x33, 0x6A, 0x19, 0x70, 0x11, 0x17, 0x8D, 0x60, 0xA3, 0x89, 0xD4, 0xA3, 0xDD,
+    0x28, 0x56, 0xFC, 0x98, 0xE7, 0xA1, 0xD8, 0x44, 0x17, 0xF0, 0x7D, 0x99, 0xA8, 0x22, 0xDD, 0x68,
+    0x44, 0xA9, 0x87, 0x86, 0x11, 0xAF, 0x7C, 0xFA, 0x2B, 0x14, 0x3A, 0x4B, 0x59, 0xA2, 0x4C, 0x60,
+    0xEE, 0x46, 0x78, 0xD0, 0x81, 0x0D, 0x11, 0x2E, 0xD6, 0x3B, 0xD3, 0xE3, 0x10, 0xF6, 0xBE, 0xB3,
+    0x92, 0xC9, 0x8F, 0x8F, 0xF0, 0x6D, 0x28, 0x63, 0x13, 0x28, 0xE4, 0x16, 0xD0, 0xD7, 0x56, 0xF0,
+    0xFD, 0x06, 0x45, 0xFF, 0xFE, 0xB7, 0x31, 0x75, 0xDF, 0x23, 0xC9, 0xD8, 0xF6, 0x59, 0xB8, 0x51,
+    0xB7, 0xB8, 0x57, 0x66, 0xEC, 0xBC, 0xC1, 0x8D, 0xA6, 0xC7, 0x3D, 0x3C, 0x42, 0x7B, 0xEF, 0x6F,
+    0x48, 0x32, 0xBF, 0xC9, 0xDD, 0x06, 0xBC, 0x34, 0x63, 0x4E, 0xEF, 0xF6, 0xA9, 0x63, 0x06, 0x68,
+    0x66, 0x1B, 0xF9, 0x96, 0x3D, 0x51, 0xCD, 0x85, 0xCE, 0x43, 0xB9, 0xE3, 0xC8, 0x68, 0x74, 0xD1,
+    0x6F, 0xC8, 0x5C, 0x19, 0xEB, 0xC9, 0xA4, 0x62, 0xA5, 0x09, 0x7E, 0x07, 0x38, 0xDB, 0xAE, 0xAF,
+    0xA2, 0x9B, 0x91, 0x11, 0x6E, 0xF2, 0xD1, 0xAC, 0x95, 0xCE, 0x35, 0x2F, 0xFE, 0xFC, 0xE7, 0x2F,
+    0x2A, 0x0D, 0xA9, 0x51, 0x29, 0xD4, 0xFB, 0x40, 0x4B, 0x04, 0x3E, 0x45, 0x8E, 0xD5, 0x79, 0x1E,
+    0x28, 0xC5, 0x99, 0x1C, 0x62, 0x7F, 0x3C, 0xBF, 0xB7, 0xB4, 0xE7, 0x00, 0x7E, 0xC8, 0xAE, 0x76,
+    0xC8, 0x80, 0xEC, 0x96, 0x67, 0x10, 0x7C, 0xEA, 0x24, 0xD2, 0x3B, 0x29, 0xDF, 0xCE, 0x65, 0xA8,
+    0xF5, 0x23, 0x2D, 0x36, 0x96, 0x8A, 0xDD, 0x64, 0x56, 0x9A, 0xC9, 0x2D, 0xA8, 0x75, 0xD1, 0x6E,
+    0x74, 0x63, 0x19, 0x19, 0x7A, 0x3F, 0xDB, 0x85, 0x66, 0xAA, 0x57, 0x93, 0xA8, 0x16, 0xA7, 0x7E,
+    0xC3, 0x6C, 0xE5, 0xED, 0xA9, 0x83, 0xEE, 0xE9, 0x9F, 0x2E, 0xBE, 0xC7, 0xFD, 0x78, 0xB9, 0x59,
+    0x07, 0x6C, 0x4A, 0xCD, 0x33, 0x13, 0xE8, 0xA9, 0xEA, 0xE7, 0x11, 0xFC, 0xED, 0x87, 0xB4, 0x80,
+    0x53, 0xE8, 0x12, 0x14, 0x1A, 0xEB, 0x0D, 0x18, 0x62, 0xDE, 0xC3, 0x8C, 0x5A, 0x28, 0x13, 0x3E,
+    0x80, 0x59, 0x77, 0xDC, 0xF8, 0x38, 0x75, 0x78, 0x96, 0x03, 0x1B, 0xCB, 0xAD, 0x80, 0xFD, 0x79,
+    0x04, 0x52, 0x03, 0xF8, 0x76, 0x06, 0xD3, 0x1F, 0x90, 0x03, 0xD3, 0x9A, 0xF6, 0xA8, 0x90, 0x59,
+    0x6D, 0x1A, 0x16, 0x17, 0x9B, 0xBF, 0x19, 0xC2, 0x60, 0x36, 0x9B, 0xCA, 0xD9, 0x8D, 0xF5, 0xD8,
+    0xF5, 0x89, 0xB5, 0x5A, 0xEA, 0xE0, 0x26, 0xBD, 0x38, 0xB3, 0xD5, 0xC9, 0x53, 0xBD, 0xAA, 0x97,
+    0x26, 0x86, 0x27, 0x53, 0xA2, 0xD4, 0x33, 0xB7, 0x5B, 0xBA, 0xA8, 0x89, 0x72, 0x75, 0x09, 0xBA,
+    0x56, 0x60, 0xA7, 0xEA, 0x6D, 0xAD, 0x7B, 0x66, 0xE1, 0xB8, 0x28, 0x3D, 0x83, 0x59, 0x3B, 0x72,
+    0x36, 0x73, 0x92, 0xCE, 0xBC, 0xFB, 0x5D, 0xDC, 0x9F, 0x38, 0xAC, 0xA9, 0x50, 0x80, 0xF2, 0x8D,
+    0x11, 0xEA, 0x5B, 0x13, 0x78, 0x13, 0xE1, 0x03, 0xF4, 0xEF, 0x5D, 0x1B, 0xE4, 0xB3, 0x1F, 0x02,
+    0xB6, 0x7A, 0x84, 0xEE, 0x99, 0x19, 0xEA, 0x17, 0x17, 0xA0, 0xBD, 0x70, 0x96, 0xF4, 0xF6, 0xB0,
+    0x92, 0x57, 0xD0, 0x6A, 0x45, 0xB5, 0xD0, 0x05, 0xBB, 0xE0, 0x66, 0x9B, 0x28, 0x36, 0x93, 0xC0,
+    0x87, 0x15, 0xDC, 0xBC, 0x41, 0xB1, 0x0D, 0xE4, 0xB9, 0x1E, 0xB9, 0x55, 0x32, 0x57, 0xBB, 0x7D,
+    0x38, 0xAC, 0x27, 0xF7, 0x1E, 0x6C, 0x07, 0x61, 0x30, 0xBC, 0x06, 0x56, 0x79, 0xC2, 0xD4, 0xA9,
+    0x63, 0xFC, 0xF8, 0x01, 0xDE, 0x18, 0xC2, 0xBE, 0x25, 0xF5, 0x6F, 0x6B, 0xC2, 0xB7, 0x87, 0x3E,
+    0x84, 0xB6, 0xBB, 0x76, 0x7D, 0x2D, 0x16, 0x86, 0xA9, 0x0A, 0xE5, 0x46, 0x4D, 0x17, 0x77, 0x54,
+    0xC2, 0xC7, 0x9D, 0xFB, 0xDB, 0x2C, 0xFB, 0x4A, 0xEA, 0xB4, 0x3B, 0x2E, 0x97, 0xF8, 0x02, 0xC3,
+    0x68, 0x63, 0xB5, 0x51, 0x87, 0x6E, 0x42, 0x56, 0xD7, 0x34, 0x3B, 0x49, 0xA1, 0xD1, 0xA9, 0x7E,
+    0x86, 0x7F, 0xB4, 0x2D, 0xED, 0x70, 0x60, 0xA6, 0xAD, 0xD7, 0x3A, 0x48, 0x2A, 0xA5, 0xB9, 0x7E,
+    0x48, 0xED, 0x13, 0x76, 0xE6, 0xB2, 0x6F, 0xB1, 0x33, 0xF8, 0x1E, 0xBB, 0xEC, 0x2F, 0xC5, 0xE8,
+    0xFF, 0xB6, 0xBE, 0x25, 0xA9, 0xBE, 0xAD, 0xD9, 0x97, 0xEA, 0xF7, 0x38, 0xB8, 0xCD, 0x93, 0x87,
+    0xB2, 0x26, 0x55, 0xCB, 0x71, 0x51, 0xED, 0xEC, 0x01, 0x28, 0x5A, 0x49, 0x63, 0xFD, 0xFA, 0x37,
+    0xD5, 0xDE, 0xA4, 0x59, 0x8A, 0x68, 0xD4, 0x97, 0xE1, 0xF4, 0x86, 0x40, 0x63, 0xCE, 0xA7, 0xE8,
+    0xA6, 0xDD, 0xFA, 0x64, 0x11, 0xF0, 0x41, 0x9A, 0x99, 0x54, 0xA8, 0x2F, 0x63, 0xBD, 0xE0, 0x83,
+    0x5E, 0x1F, 0x56, 0x2B, 0x29, 0x56, 0x92, 0xFA, 0x13, 0xA1, 0xDB, 0x85, 0x43, 0x70, 0x7F, 0x9A,
+    0xFA, 0xCF, 0xBD, 0x46, 0xDF, 0x4B, 0x4E, 0x8A, 0x9D, 0xF4, 0xD0, 0x5C, 0xCF, 0x65, 0xF0, 0xED,
+    0x91, 0xCD, 0x18, 0xCB, 0xF1, 0x06, 0xC1, 0xF7, 0x9F, 0xB2, 0xDB, 0xFF, 0x94, 0xBC, 0xF4, 0xE6,
+    0x26, 0x3D, 0x1C, 0xBB, 0xE5, 0xA4, 0x56, 0x50, 0x51, 0xC3, 0xA5, 0x62, 0x81, 0xCD, 0xF7, 0xF9,
+    0x1A, 0x19, 0xB5, 0x7B, 0x47, 0xDE, 0xBB, 0x7C, 0xA8, 0xBF, 0x9C, 0x11, 0xDF, 0x9F, 0xC0, 0x45,
+    0xBF, 0xF6, 0xA1, 0xF2, 0x8D, 0x63, 0xDB, 0xEE, 0x35, 0x41, 0x15, 0x6F, 0x00, 0x5B, 0xD1, 0xEE,
+    0x0E, 0x21, 0x37, 0x7A, 0xF8, 0xC0, 0x4E, 0x60, 0x61, 0x68, 0x8F, 0x6B, 0x3A, 0x3A, 0x2E, 0xEF,
+    0xE4, 0x66, 0xCD, 0x5F, 0xFE, 0x81, 0xAE, 0x3D, 0xA4, 0xA5, 0xFF, 0xC4, 0x07, 0x7A, 0xDF, 0x43,
+    0xF3, 0xD9, 0x48, 0x1E, 0x1F, 0x81, 0x57, 0x7F, 0xB0, 0x56, 0xF0, 0x07, 0x36, 0xBA, 0xD8, 0x4C,
+    0x75, 0xA8, 0xDB, 0x7B, 0x4C, 0xFB, 0x60, 0x75, 0x3C, 0x6B, 0xEA, 0x43, 0x14, 0x1B, 0x75, 0x62,
+    0x5B, 0xDC, 0xAD, 0x98, 0xEC, 0x0B, 0xFD, 0x11, 0xEF, 0xEB, 0x9F, 0xDE, 0xEA, 0x41, 0xFA, 0x6C,
+    0xFA, 0xE8, 0x03, 0xC7, 0x13, 0xB5, 0xCE, 0x51, 0x86, 0xDF, 0x1E, 0x1E, 0xF9, 0x81, 0x96, 0x7A,
+    0xE3, 0x3E, 0xCE, 0x7F, 0x26, 0xF9, 0x5B, 0xCB, 0x03, 0x40, 0x11, 0x9F, 0x1A, 0x9C, 0xE2, 0xFA,
+    0xE5, 0xAA, 0xE5, 0x72, 0xA9, 0x87, 0xEF, 0xBE, 0x19, 0xD3, 0xBD, 0x97, 0x78, 0x8A, 0x95, 0x07,
+    0x33, 0x39, 0xD8, 0x2D, 0x7E, 0xFD, 0xF2, 0x03, 0xDF, 0xFE, 0xC8, 0x77, 0x1E, 0xEC, 0xD2, 0xCE,
+    0x15, 0x31, 0xE1, 0xF7, 0x6D, 0x4C, 0xD5, 0x4F, 0x52, 0xFD, 0x52, 0xF4, 0x2E, 0x3C, 0x5F, 0x73,
+    0xE1, 0x1E, 0x80, 0x58, 0xDD, 0x1A, 0x6F, 0xB8, 0x97, 0xC7, 0x7A, 0xC3, 0x4F, 0x74, 0x70, 0x81,
+    0x7B, 0xEE, 0x71, 0xEE, 0x6B, 0xAF, 0xC4, 0xF4, 0x7C, 0xED, 0x9E, 0xFE, 0xDE, 0xF4, 0xD1, 0x8F,
+    0xF2, 0x05, 0x86, 0xC5, 0xEB, 0xE5, 0x71, 0x7D, 0xD6, 0x06, 0x2E, 0x70, 0xF5, 0x09, 0xF7, 0x70,
+    0x7C, 0xAA, 0x9A, 0x06, 0x3B, 0x99, 0xD6, 0x87, 0xAE, 0x4D, 0x65, 0x6C, 0xCC, 0xE2, 0x7A, 0x30,
+    0x0F, 0xAD, 0xFE, 0x6B, 0xF1, 0x29, 0x3B, 0x79, 0x66, 0xA8, 0x1E, 0x7E, 0x73, 0x79, 0xFE, 0x92,
+    0xB3, 0x3D, 0xA6, 0x5D, 0xDD, 0x98, 0xFC, 0x23, 0xE3, 0x9F, 0xEE, 0xFB, 0xF8, 0x20, 0xE7, 0x78,
+    0x38, 0xDE, 0x1C, 0x9C, 0xE2, 0xFA, 0xB1, 0xF3, 0x98, 0xAB, 0x6E, 0x79, 0xF0, 0xE2, 0xC5, 0x4F,
+    0x5E, 0xBC, 0xD8, 0xCC, 0xE7, 0xDB, 0xE2, 0xA1, 0xE4, 0x42, 0xAA, 0xCB, 0xF1, 0x32, 0xE6, 0x6A,
+    0x3D, 0xD5, 0xE1, 0x92, 0x8D, 0x9D, 0xB9, 0x8A, 0x69, 0xA7, 0x8B, 0x55, 0xBF, 0xB8, 0xAD, 0x0B,
+    0x1C, 0x3D, 0xF2, 0x93, 0x65, 0xF5, 0xF5, 0xCB, 0x3F, 0xBE, 0xBC, 0x0F, 0x8F, 0x4B, 0x28, 0xB9,
+    0xEF, 0xCF, 0xAB, 0xFD, 0x71, 0x6B, 0x80, 0xA2, 0x37, 0x4F, 0x9A, 0x1F, 0xDE, 0x49, 0x5E, 0xED,
+    0xD0, 0x03, 0x47, 0xED, 0x67, 0x56, 0xD7, 0xDD, 0xD5, 0x33, 0xEB, 0x97, 0x7C, 0x4B, 0x16, 0x72,
+    0xA7, 0xC0, 0xA3, 0x0C, 0x4B, 0xA3, 0x1F, 0x8C, 0x37, 0xF3, 0xDE, 0x00, 0x3B, 0xD2, 0xF4, 0x66,
+    0xA7, 0x6E, 0x14, 0x01, 0x68, 0x1E, 0x7E, 0x73, 0xF3, 0x2F, 0xC5, 0xED, 0x3C, 0x57, 0x2F, 0x95,
+    0xE3, 0x8D, 0x2A, 0x75, 0xED, 0xE9, 0x71, 0x4B, 0x3B, 0x4D, 0xBB, 0x1B, 0xD9, 0xED, 0xC3, 0x1E,
+    0x95, 0xFC, 0xE9, 0x7B, 0xD7, 0x92, 0x92, 0xB3, 0x7E, 0x49, 0xC9, 0xEF, 0xA9, 0x7F, 0xB1, 0xF8,
+    0x62, 0x2B, 0xE6, 0x4B, 0x76, 0x2D, 0xA6, 0xAC, 0xBD, 0x39, 0xF5, 0xDF, 0xB6, 0x96, 0x4A, 0x8A,
+    0x99, 0x20, 0xEE, 0x62, 0x95, 0xA8, 0xA3, 0x5D, 0xA9, 0xA3, 0xDD, 0x68, 0xA6, 0x62, 0xC3, 0x8F,
+    0xC5, 0x86, 0x0F, 0x76, 0x35, 0xC3, 0x68, 0x93, 0x53, 0xB2, 0xA9, 0x56, 0xCA, 0x64, 0xB6, 0xBD,
+    0x11, 0xD6, 0x8C, 0x43, 0x9F, 0xE9, 0x15, 0x36, 0xF7, 0xFB, 0xF7, 0x27, 0x1B, 0x7F, 0xF6, 0xE0,
+    0x6C, 0x9A, 0xB8, 0xB7, 0xF9, 0xDB, 0xED, 0x17, 0x46, 0xBE, 0x78, 0x69, 0xCB, 0x4F, 0xA5, 0xBE,
+    0xB9, 0x62, 0x57, 0x12, 0x65, 0xCA, 0x4F, 0x0B, 0xD5, 0x42, 0xFC, 0x05, 0x54, 0x22, 0x9E, 0x41,
+    0x25, 0x7E, 0x09, 0x71, 0xCE, 0xE8, 0x3F, 0xED, 0xB9, 0x74, 0x1E, 0x48, 0xC4, 0xD1, 0xFF, 0x0D,
+    0xA5, 0xD4, 0x23, 0xA9, 0xAF, 0x75, 0x6D, 0x45, 0xC1, 0x46, 0xB7, 0xE0, 0xC2, 0x10, 0x78, 0xD0,
+    0xAE, 0xD0, 0x66, 0xA2, 0xCD, 0x7F, 0xFE, 0x46, 0x1E, 0xCA, 0xE6, 0xA4, 0x80, 0xFF, 0xDB, 0xC7,
+    0x76, 0xE6, 0xCA, 0x06, 0x17, 0x5C, 0xC2, 0xC4, 0x3A, 0xE1, 0x46, 0xBF, 0x9E, 0x17, 0x9D, 0xB4,
+    0xD0, 0x49, 0xFD, 0x9E, 0x2F, 0xB6, 0xEF, 0x02, 0x60, 0xFD, 0x8E, 0x92, 0x62, 0x8B, 0xFE, 0x7F,
+    0xC5, 0xFD, 0x78, 0xA5, 0x79, 0x75, 0xA5, 0x7E, 0x71, 0xC1, 0x9C, 0xA2, 0xA1, 0xBC, 0xC3, 0x8C,
+    0xE0, 0xE3, 0x61, 0x53, 0xD3, 0x81, 0x3D, 0x34, 0x9E, 0x25, 0x34, 0x9D, 0xF6, 0xD2, 0x7E, 0xDC,
+    0x83, 0x98, 0xF2, 0x84, 0xFF, 0x74, 0x20, 0x1B, 0xB9, 0x78, 0xA6, 0x43, 0xFC, 0xF0, 0x76, 0x73,
+    0xF8, 0xBF, 0xB1, 0x0B, 0x19, 0xAD, 0xF1, 0x9A, 0x40, 0x2B, 0x70, 0xAD, 0x7D, 0x9B, 0xC3, 0xCF,
+    0xDD, 0x9D, 0x5A, 0x81, 0xFA, 0xF5, 0x61, 0x04, 0x5C, 0x18, 0x7A, 0xA0, 0x0E, 0xCA, 0x31, 0x83,
+    0x5A, 0xC0, 0x67, 0xF3, 0xEF, 0x73, 0x20, 0xFA, 0x54, 0xA1, 0x6F, 0x00, 0xAB, 0x95, 0x26, 0x48,
+    0x56, 0x5A, 0x28, 0x96, 0x32, 0x55, 0x2B, 0x36, 0x96, 0xC9, 0x6E, 0x54, 0x53, 0xB5, 0x14, 0x1B,
+    0x2E, 0xB8, 0xB9, 0xD8, 0xF0, 0xBD, 0x8B, 0x76, 0x7D, 0x50, 0xD4, 0xB1, 0x4A, 0xDD, 0x4A, 0x77,
+    0x67, 0x88, 0xDD, 0x5C, 0x4A, 0x0A, 0x7E, 0xAC, 0xA4, 0xB7, 0xDE, 0xD6, 0x87, 0x88, 0x53, 0xF2,
+    0x8A, 0x58, 0xAD, 0x4E, 0x33, 0xD4, 0x0B, 0xC3, 0x08, 0x36, 0xD1, 0x4C, 0x60, 0x94, 0x3D, 0x52,
+    0xD7, 0xDB, 0x94, 0xEF, 0xDD, 0x4E, 0xE0, 0xEC, 0x02, 0xD8, 0xED, 0xDA, 0x70, 0xE7, 0x6A, 0xA6,
+    0xFC, 0xAB, 0x65, 0x90, 0xA4, 0x05, 0x3F, 0x19, 0x15, 0xCA, 0xEF, 0xF1, 0x93, 0x4D, 0x34, 0x53,
+    0xB5, 0x18, 0xE1, 0xE6, 0x62, 0x63, 0xE8, 0x6D, 0x42, 0xF8, 0xD1, 0x88, 0x21, 0xD4, 0x0B, 0xC3,
+    0xEB, 0x0A, 0x9D, 0x5E, 0x90, 0x14, 0xBC, 0xA2, 0xB4, 0x9D, 0x45, 0xA0, 0x8C, 0x76, 0x57, 0xAF,
+    0x64, 0x75, 0xFD, 0xCE, 0x10, 0xBC, 0x51, 0xB1, 0xD8, 0xD8, 0x4C, 0x4D, 0x7B, 0xC9, 0xAE, 0x45,
+    0xDC, 0xAF, 0x61, 0x76, 0xA6, 0xDD, 0x0F, 0x37, 0xA8, 0x0E, 0xE3, 0x29, 0x22, 0x6E, 0x2E, 0x0E,
+    0x7D, 0xBF, 0x75, 0x44, 0x14, 0x1B, 0x75, 0xCC, 0xC6, 0xC5, 0x26, 0xFC, 0x68, 0x86, 0xB1, 0xDC,
+    0x5A, 0xE9, 0x25, 0xA5, 0x5A, 0xCB, 0x99, 0x89, 0x21, 0x55, 0xD6, 0x46, 0x80, 0x22, 0x13, 0x10,
+    0xB6, 0x13, 0xE2, 0xCA, 0xD9, 0x54, 0xEE, 0x39, 0xBC, 0x62, 0xB5, 0xE2, 0x35, 0x35, 0x1B, 0xE5,
+    0xC6, 0x90, 0xB0, 0xC9, 0xAC, 0x1F, 0xA0, 0x4C, 0x76, 0x86, 0x32, 0xB9, 0x11, 0xAA, 0xA5, 0xEE,
+    0xC1, 0xCD, 0x1E, 0x70, 0x77, 0x12, 0xBB, 0x9D, 0xA0, 0xC9, 0x64, 0xAF, 0x69, 0x03, 0xFC, 0x28,
+    0xC0, 0x87, 0xAE, 0x87, 0x2E, 0xF8, 0x00, 0x43, 0x9F, 0xAF, 0x53, 0x1D, 0x31, 0xBA, 0xEA, 0x52,
+    0x66, 0x9D, 0xE2, 0x15, 0x4D, 0xB6, 0xBB, 0xA7, 0xA2, 0xFA, 0xA2, 0x3F, 0x45, 0xE0, 0x62, 0x9F,
+    0x5B, 0x37, 0x64, 0x57, 0xBC, 0xE7, 0xAC, 0xE7, 0xF9, 0xE7, 0x76, 0xBF, 0xAC, 0xC7, 0x6C, 0xEB,
+    0x2E, 0x58, 0x05, 0x8A, 0x0D, 0xBF, 0x81, 0x9B, 0x4B, 0xCD, 0xE0, 0xC3, 0x30, 0x04, 0x8C, 0xAA,
+    0x37, 0x05, 0x55, 0x52, 0x95, 0x32, 0x4A, 0x36, 0x81, 0x36, 0xD4, 0x62, 0x35, 0xDA, 0x04, 0xF5,
+    0x7A, 0xB0, 0x01, 0x7B, 0xAF, 0xC7, 0xF6, 0x8F, 0xF4, 0x7A, 0x1C, 0x68, 0x45, 0xBF, 0x0F, 0x75,
+    0x7B, 0x11, 0x5C, 0xEC, 0xA0, 0x90, 0xC8, 0x73, 0x99, 0xCE, 0x0C, 0x32, 0x81, 0x4A, 0xC9, 0xE9,
+    0x15, 0xAD, 0x56, 0xB1, 0x5E, 0x68, 0x46, 0xBB, 0xE1, 0x46, 0x86, 0xBE, 0x8A, 0xD4, 0xB1, 0x8C,
+    0xD8, 0x64, 0x67, 0x18, 0x3E, 0x93, 0xA0, 0x9E, 0x12, 0xD8, 0xB4, 0x02, 0x43, 0xC7, 0x9E, 0x52,
+    0x59, 0xB5, 0x07, 0xB8, 0xAB, 0x09, 0x70, 0xC1, 0x8D, 0xF0, 0x91, 0x7A, 0xDA, 0xAB, 0x27, 0x99,
+    0xA3, 0xD4, 0x8D, 0x67, 0x68, 0x31, 0x39, 0x94, 0x75, 0x4A, 0x78, 0x4D, 0x52, 0x4F, 0x37, 0xED,
+    0xA2, 0xCA, 0x96, 0xD0, 0x64, 0xEB, 0xD7, 0x4C, 0x30, 0xF4, 0x3B, 0xBF, 0x3E, 0x1B, 0xC5, 0x9D,
+    0xB8, 0x3E, 0x04, 0x0A, 0x65, 0xAA, 0xFD, 0xB4, 0xDB, 0xC7, 0x3C, 0x25, 0xE0, 0xF0, 0xC9, 0x78,
+    0xF6, 0x93, 0x46, 0xAF, 0x5F, 0xDF, 0x5A, 0x23, 0x49, 0x2B, 0x5E, 0x79, 0x5A, 0x5E, 0x66, 0x04,
+    0x65, 0xDC, 0xE3, 0x30, 0xDC, 0x30, 0x17, 0x6A, 0x77, 0x2E, 0xD5, 0x13, 0x9C, 0x65, 0xF3, 0x7C,
+    0x0B, 0xEA, 0x1E, 0xB3, 0x1E, 0x46, 0x12, 0xC0, 0xF3, 0xC7, 0x18, 0xE2, 0xAF, 0xD1, 0xFF, 0x7B,
+    0x94, 0xDB, 0x91, 0x9C, 0x02, 0x47, 0x43, 0x80, 0xEE, 0x2B, 0x6D, 0x2D, 0x8D, 0xB5, 0x14, 0xD8,
+    0xC0, 0xAC, 0xA6, 0x2D, 0x52, 0x13, 0x6D, 0xD2, 0x62, 0xEF, 0x2A, 0x59, 0xDD, 0x4A, 0xA5, 0x6C,
+    0xAA, 0x56, 0x9B, 0xDC, 0x62, 0xF3, 0x00, 0xAA, 0x68, 0x53, 0x33, 0xD9, 0xC5, 0x8F, 0xE5, 0xEC,
+    0x43, 0x15, 0x7D, 0x70, 0xB1, 0x6B, 0xEB, 0x29, 0x1F, 0x89, 0xEF, 0x0D, 0xA2, 0xFC, 0x7E, 0xC2,
+    0x69, 0xC6, 0x29, 0x50, 0xBC, 0x75, 0xD8, 0xD9, 0xF3, 0xB9, 0xD4, 0x92, 0x60, 0xC8, 0xEC, 0xA8,
+    0x93, 0xB1, 0x82, 0x8F, 0x61, 0x86, 0x95, 0x4E, 0xD1, 0xFD, 0xED, 0xD0, 0xC6, 0x72, 0x06, 0xB5,
+    0x74, 0x91, 0x66, 0xA1, 0x59, 0x71, 0x2B, 0x76, 0x83, 0xAE, 0x7F, 0x7F, 0xB9, 0x94, 0xB1, 0x7B,
+    0x63, 0xB5, 0x52, 0x5B, 0x1D, 0x5A, 0x9A, 0x1F, 0x03, 0x25, 0x06, 0x4D, 0xCD, 0x9D, 0xB5, 0x5C,
+    0x8A, 0x7E, 0x83, 0x7A, 0xA4, 0x90, 0xF0, 0x8A, 0x76, 0x7D, 0x0C, 0xDF, 0x63, 0x13, 0xBF, 0xEF,
+    0xC7, 0xE6, 0xAB, 0x52, 0x74, 0xCA, 0x5C, 0xA6, 0x0B, 0xBF, 0x5E, 0x51, 0xF0, 0x57, 0xE9, 0x03,
+    0xB9, 0x00, 0xD0, 0xD8, 0x1F, 0xAF, 0xFE, 0xE5, 0xB8, 0xBD, 0xEF, 0x30, 0x8B, 0xEB, 0x57, 0x68,
+    0x74, 0x81, 0x9B, 0xD9, 0xA1, 0x59, 0xED, 0x44, 0xFC, 0x67, 0x4F, 0x35, 0x10, 0xC7, 0x4C, 0xD9,
+    0xFF, 0x7C, 0xCC, 0xCA, 0xE3, 0x62, 0xCE, 0x24, 0x9B, 0x71, 0x3F, 0xA2, 0x90, 0xF9, 0x0B, 0x5D,
+    0x9F, 0x73, 0x1D, 0xE5, 0xBC, 0xC5, 0xAC, 0xB9, 0x5C, 0x6A, 0x13, 0x1F, 0xAB, 0x66, 0x9E, 0xBA,
+    0x32, 0x31, 0x28, 0xD0, 0xE9, 0x98, 0xA8, 0xFF, 0x58, 0x0B, 0x54, 0x1A, 0x8F, 0xC7, 0xC0, 0xDD,
+    0xEC, 0x7A, 0x30, 0x8B, 0x6F, 0xA1, 0x88, 0x1D, 0x60, 0xA7, 0xE1, 0x13, 0x2D, 0xE5, 0x28, 0x45,
+    0x5C, 0xD0, 0xED, 0x05, 0xF7, 0x95, 0x64, 0x13, 0xCD, 0x67, 0x92, 0x49, 0xF8, 0x22, 0x15, 0xE9,
+    0xF7, 0x6E, 0x16, 0xC9, 0xCE, 0x3E, 0x15, 0xDB, 0x95, 0xE8, 0x67, 0xA4, 0xE0, 0xC7, 0x3C, 0xDD,
+    0x0F, 0xD3, 0x66, 0x73, 0x61, 0x34, 0xD5, 0x13, 0x5E, 0xC5, 0x8A, 0xB9, 0x32, 0xF9, 0x80, 0xD9,
+    0x6C, 0x82, 0x7A, 0xF4, 0x3D, 0x45, 0x2A, 0x7F, 0xF6, 0xD7, 0x78, 0x49, 0xB3, 0x95, 0x36, 0x85,
+    0xEE, 0xDA, 0x66, 0xD6, 0x6A, 0x76, 0xA3, 0x1B, 0xC5, 0xCA, 0xEA, 0xA2, 0x1B, 0x9B, 0x17, 0x36,
+    0xF4, 0xF8, 0xDC, 0x8C, 0xA5, 0x56, 0x9B, 0x76, 0x0F, 0x70, 0x8E, 0x5F, 0xD6, 0x99, 0xF6, 0x95,
+    0xB6, 0x94, 0x66, 0x23, 0xA5, 0xBD, 0x33, 0x8D, 0x96, 0xA1, 0x5C, 0xF1, 0x2F, 0x2B, 0xB8, 0x37,
+    0x14, 0xAD, 0x6E, 0x25, 0xA3, 0xB0, 0x31, 0x8C, 0x5D, 0xEB, 0xA7, 0x26, 0xB8, 0x79, 0xEF, 0x4C,
+    0xDB, 0x72, 0x7B, 0xDE, 0x2F, 0xEB, 0x4C, 0xE3, 0xF2, 0x7E, 0xBD, 0x9B, 0x00, 0x6E, 0xCA, 0x47,
+    0x50, 0x4E, 0x7B, 0x87, 0xEA, 0x85, 0x03, 0x0B, 0xE8, 0xC8, 0x68, 0xAA, 0xA3, 0x96, 0x26, 0xDD,
+    0xBF, 0x36, 0x1B, 0x5D, 0x3D, 0x52, 0x7F, 0x37, 0x50, 0xBD, 0x11, 0xB0, 0x77, 0xF7, 0x55, 0x76,
+    0x6A, 0x69, 0x5E, 0x8E, 0xB8, 0x37, 0xD7, 0x73, 0x36, 0xF9, 0x97, 0xBF, 0xB2, 0x95, 0x1A, 0x87,
+    0x56, 0x71, 0x27, 0xF6, 0x1F, 0xBC, 0xEE, 0x27, 0x0F, 0xB4, 0xD1, 0xE1, 0x40, 0x03, 0x77, 0xD3,
+    0xA1, 0x54, 0x79, 0xF9, 0x37, 0x87, 0xAF, 0xF3, 0x31, 0xA8, 0xF9, 0x34, 0x78, 0x66, 0xF0, 0x3F,
+    0x8C, 0x7B, 0x88, 0x7A, 0xFE, 0xAD, 0xF7, 0x6E, 0x9A, 0xD8, 0x3B, 0x01, 0x23, 0x7F, 0xDD, 0xF7,
+    0x3C, 0x14, 0x77, 0x01, 0xDA, 0x69, 0xE7, 0x57, 0xF9, 0x7E, 0x97, 0xE6, 0x87, 0xAE, 0x3D, 0x07,
+    0x83, 0xC6, 0x3C, 0xEB, 0x97, 0xA1, 0xA5, 0x96, 0x34, 0x0E, 0x92, 0xEC, 0x9D, 0xE1, 0xF5, 0xE4,
+    0x5E, 0xDC, 0xEC, 0xF4, 0x60, 0x35, 0xBB, 0xF6, 0x5B, 0x3E, 0x7C, 0x3A, 0x5F, 0xB1, 0x72, 0xFB,
+    0xF7, 0xD0, 0x68, 0x03, 0xED, 0x73, 0x02, 0x71, 0xD1, 0xAE, 0x74, 0x7B, 0xF8, 0x37, 0xBA, 0x19,
+    0xE1, 0x83, 0x5B, 0x0A, 0x5D, 0x53, 0x3F, 0x48, 0x8B, 0x95, 0x0E, 0x72, 0xBC, 0x97, 0xCB, 0x18,
+    0x4D, 0x43, 0xC0, 0x6F, 0x7E, 0xC5, 0x5C, 0xB9, 0xAD, 0x09, 0xA3, 0x37, 0x57, 0xA8, 0x53, 0x1D,
+    0x28, 0x54, 0xA4, 0x2F, 0xE2, 0x27, 0xAF, 0x64, 0x93, 0xD5, 0x30, 0x76, 0x7D, 0x87, 0xAA, 0xB9,
+    0x8A, 0x55, 0x14, 0x03, 0x9B, 0x8B, 0x55, 0xAC, 0xBF, 0xB7, 0x31, 0xFC, 0xE5, 0xD2, 0x8C, 0x56,
+    0x9B, 0x4D, 0xFB, 0x04, 0xB5, 0xA3, 0x63, 0xC6, 0x5C, 0xA7, 0x39, 0x2F, 0xCE, 0xE8, 0x8E, 0x22,
+    0x0A, 0xD5, 0x96, 0x67, 0x7E, 0x0E, 0x81, 0x7A, 0xF6, 0x13, 0x76, 0xAD, 0x67, 0xD0, 0xD7, 0xB7,
+    0x6B, 0xD7, 0x86, 0x57, 0x24, 0x69, 0x96, 0xA4, 0xD5, 0x4F, 0x87, 0xEA, 0xCA, 0xD3, 0x1B, 0x74,
+    0xA3, 0x42, 0xA6, 0x55, 0xFA, 0x98, 0x47, 0x7D, 0x0E, 0xCA, 0x33, 0x80, 0xE2, 0x81, 0x2C, 0x77,
+    0xE1, 0x98, 0x4C, 0x22, 0x2A, 0x89, 0xE1, 0x07, 0x6B, 0xB9, 0xD8, 0xE4, 0x83, 0x7B, 0x73, 0xC5,
+    0xBF, 0xBC, 0x5D, 0x93, 0x97, 0x16, 0x5D, 0x1B, 0x5E, 0x59, 0x90, 0x9B, 0xCA, 0xC5, 0x07, 0x1F,
+    0x86, 0x37, 0x12, 0x52, 0x60, 0x58, 0x8E, 0xEB, 0x59, 0xE7, 0x7B, 0x29, 0x18, 0xDD, 0xD2, 0x46,
+    0x2D, 0xA3, 0x1E, 0x25, 0xBB, 0x52, 0xBD, 0x35, 0xBA, 0x85, 0xAE, 0xA5, 0x99, 0x6C, 0x82, 0x2E,
+    0xB8, 0x00, 0xE2, 0x26, 0xD8, 0x64, 0x23, 0xB8, 0xD8, 0xF4, 0xD0, 0x8C, 0x09, 0xE8, 0x1E, 0x99,
+    0xC0, 0x6C, 0x1E, 0xB0, 0x6F, 0x2D, 0x80, 0xBB, 0x1B, 0xD8, 0xB5, 0x89, 0x21, 0x0F, 0x9B, 0xEB,
+    0x8F, 0xC3, 0x54, 0x77, 0x66, 0x7A, 0xA2, 0x69, 0xBB, 0x99, 0xEE, 0x96, 0x26, 0xAB, 0xA3, 0x21,
+    0xF8, 0x64, 0x54, 0x24, 0x6C, 0x72, 0x01, 0x17, 0x57, 0xF0, 0x2F, 0x4D, 0x20, 0x0F, 0xF6, 0x4E,
+    0xDC, 0xA7, 0x04, 0xF9, 0x03, 0x32, 0x68, 0x75, 0x18, 0x01, 0x58, 0xF7, 0xA7, 0x6F, 0x53, 0x0B,
+    0x98, 0xB6, 0x04, 0x68, 0xF2, 0xE8, 0xC2, 0xAD, 0x9C, 0x38, 0x04, 0x54, 0x99, 0x54, 0xF9, 0xF6,
+    0x98, 0xEA, 0x3D, 0x8C, 0x06, 0xD7, 0xB6, 0xD4, 0x56, 0x49, 0x39, 0x1A, 0xCC, 0xF0, 0xFA, 0x2E,
+    0x23, 0x0F, 0x27, 0x23, 0x02, 0xF6, 0x18, 0xA7, 0x39, 0x4C, 0x8E, 0x3A, 0x7E, 0xF4, 0x54, 0xFD,
+    0xBF, 0x82, 0x64, 0x03, 0xEE, 0xEF, 0x16, 0xD0, 0x06, 0xE6, 0xE6, 0xAF, 0x5E, 0x0E, 0xDA, 0x3E,
+    0xD0, 0xBC, 0xF8, 0xF3, 0xFF, 0x72, 0x7C, 0x8F, 0x83, 0x7A, 0x3F, 0xD3, 0xE6, 0x4B, 0x3C, 0xEE,
+    0xF5, 0x9E, 0x1A, 0x28, 0xC6, 0x33, 0xB2, 0x1B, 0x4F, 0x77, 0xA8, 0x24, 0x28, 0xAE, 0xDF, 0xB9,
+    0x8A, 0x93, 0x5A, 0x7E, 0x67, 0x7B, 0xF4, 0x90, 0x71, 0xE6, 0x84, 0x69, 0x1F, 0x66, 0xE5, 0xC7,
+    0x66, 0x46, 0xF8, 0xC9, 0x26, 0x86, 0xBE, 0x8E, 0xC5, 0xC6, 0xD0, 0xBB, 0x68, 0x57, 0x86, 0x50,
+    0xDF, 0xB9, 0x9E, 0x4A, 0x49, 0xBD, 0x97, 0x0E, 0x0A, 0xF3, 0x45, 0xAC, 0x42, 0xA1, 0xC8, 0xEF,
+    0x24, 0xD8, 0xA0, 0x6B, 0x4B, 0xC9, 0x48, 0x7D, 0x99, 0xE7, 0x6D, 0x0B, 0xFC, 0xFF, 0x79, 0xB5,
+    0xD6, 0x56, 0x6D, 0x7A, 0x65, 0xB1, 0xCB, 0xC6, 0x4D, 0xDF, 0xFA, 0x67, 0xC6, 0xFA, 0x95, 0xED,
+    0xCA, 0x34, 0x68, 0x2A, 0x95, 0x9B, 0x87, 0xF9, 0xE3, 0xE7, 0xA0, 0xD9, 0xE7, 0x1E, 0xCD, 0xDC,
+    0xDD, 0xAE, 0xA4, 0x4C, 0xE9, 0x2B, 0x53, 0xB1, 0x51, 0x26, 0xB3, 0x91, 0x73, 0xCA, 0x9F, 0xBD,
+    0x9A, 0x70, 0xF1, 0xE7, 0x0B, 0x75, 0x1C, 0x22, 0xCD, 0x5D, 0xF5, 0x78, 0x6D, 0xE0, 0xEF, 0x5C,
+    0x01, 0x1F, 0x1C, 0x74, 0xE1, 0xDC, 0x0E, 0xBE, 0x64, 0x00, 0x64, 0x3C, 0x03, 0x80, 0x98, 0xCB,
+    0x47, 0x6D, 0xA1, 0x17, 0xD4, 0x3B, 0x7D, 0x5E, 0xED, 0xFD, 0x9B, 0x36, 0x4A, 0x3D, 0xB2, 0xD0,
+    0xCC, 0x75, 0x44, 0xA1, 0xEB, 0x6D, 0x32, 0x1B, 0xF5, 0x54, 0xCD, 0x74, 0xFF, 0x43, 0x13, 0x8A,
+    0xF4, 0xED, 0x0D, 0xF7, 0xE6, 0xCF, 0x23, 0xFE, 0x69, 0xB5, 0x46, 0x7F, 0x95, 0xA8, 0xA4, 0x80,
+    0xBF, 0xBD, 0xC1, 0x76, 0xEE, 0x22, 0xE5, 0xC2, 0xB7, 0x69, 0x46, 0xD3, 0x23, 0xA0, 0xD2, 0xB3,
+    0xB9, 0xCC, 0x50, 0x5C, 0x3B, 0xB4, 0x73, 0x9E, 0xE3, 0x30, 0x29, 0xC6, 0x1F, 0x57, 0x0C, 0x57,
+    0xBC, 0x94, 0xF2, 0x53, 0xA9, 0x6B, 0xCF, 0xE5, 0x8C, 0xBE, 0xFC, 0x65, 0x4D, 0x92, 0xBF, 0x0E,
+    0xD6, 0x73, 0xE8, 0xDC, 0x6C, 0x32, 0xC1, 0xC6, 0x2C, 0x4E, 0x0A, 0x83, 0x92, 0xB9, 0xFE, 0xD6,
+    0x31, 0x8D, 0xC6, 0xA6, 0xAC, 0xDA, 0x5D, 0x4B, 0x71, 0x12, 0x94, 0xFF, 0xBB, 0x8D, 0x42, 0x11,
+    0xA7, 0x96, 0x66, 0x3E, 0x4D, 0x02, 0xFE, 0x6F, 0x62, 0x54, 0xD3, 0xC9, 0xBA, 0xAD, 0x14, 0xF3,
+    0x98, 0xA0, 0x7F, 0xD9, 0xBA, 0x8F, 0x2E, 0xD3, 0xA9, 0x95, 0x62, 0xF7, 0x1F, 0xD6, 0xF7, 0xD3,
+    0xB5, 0x17, 0x9A, 0xF0, 0x11, 0x3F, 0x59, 0x4D, 0x85, 0x82, 0xD5, 0x68, 0xD7, 0x27, 0xCC, 0x76,
+    0x74, 0x6F, 0xD7, 0x37, 0xF5, 0x9D, 0xE1, 0x96, 0x14, 0x9A, 0xAD, 0x3D, 0xC9, 0x3A, 0xFD, 0x9E,
+    0x9D, 0x24, 0x4A, 0x7D, 0x33, 0x61, 0x93, 0x49, 0x94, 0xC9, 0x2C, 0x94, 0xC9, 0xC4, 0xD3, 0x82,
+    0xBD, 0xBB, 0x41, 0xBD, 0x53, 0xBE, 0x23, 0x7E, 0xAA, 0x17, 0xFC, 0x58, 0xA5, 0x4C, 0x8B, 0xE8,
+    0x42, 0x99, 0x72, 0xB9, 0x4E, 0x6D, 0x99, 0x8C, 0xAE, 0x56, 0x4B, 0xAD, 0xD9, 0x45, 0xAF, 0xE8,
+    0x8E, 0xE7, 0xDE, 0x75, 0x01, 0xFB, 0x15, 0xED, 0x05, 0xB8, 0x4A, 0x11, 0x8A, 0x1D, 0x2C, 0xF0,
+    0xD2, 0x0B, 0x92, 0xE8, 0xFA, 0x64, 0xD6, 0x22, 0x56, 0xB1, 0x6A, 0x7D, 0x80, 0xED, 0x5E, 0x4A,
+    0x6D, 0x34, 0x12, 0x2A, 0x37, 0x9B, 0x6C, 0xAA, 0xA7, 0x2A, 0x76, 0x6D, 0xF3, 0x62, 0x62, 0x70,
+    0x53, 0x71, 0x38, 0x0A, 0xB0, 0x0B, 0x73, 0x13, 0x4A, 0xAD, 0x38, 0x05, 0xAA, 0xD7, 0xE0, 0xFF,
+    0x07, 0xCD, 0xBC, 0x4F, 0xAC, 0x27, 0xD7, 0x75, 0xE7, 0xF7, 0xA9, 0xBA, 0xDD, 0x5D, 0x32, 0x2B,
+    0xA3, 0xCB, 0x05, 0xC9, 0x31, 0x28, 0x4B, 0xA5, 0x85, 0x07, 0xB0, 0x34, 0x32, 0x4B, 0x0B, 0x2D,
+    0xBC, 0x10, 0xFB, 0x16, 0xD5, 0x80, 0x99, 0x84, 0x98, 0x61, 0x23, 0xC3, 0x67, 0x0F, 0x4C, 0x18,
+    0xAD, 0x85, 0x03, 0xC8, 0x02, 0x92, 0xF6, 0x82, 0x0B, 0x2D, 0x44, 0x56, 0x91, 0x04, 0xC2, 0x05,
+    0x17, 0x7A, 0x83, 0x48, 0x36, 0x30, 0x46, 0x20, 0x2E, 0xE8, 0xC4, 0xFC, 0x11, 0x99, 0x56, 0x00,
+    0x2F, 0x08, 0x84, 0xDD, 0x75, 0xD9, 0x8D, 0x01, 0x81, 0x11, 0x02, 0x16, 0x45, 0x2B, 0x5A, 0x08,
+    0x08, 0x8B, 0xA4, 0x66, 0x18, 0x90, 0x80, 0xFB, 0x92, 0x2A, 0x5A, 0xD5, 0xCD, 0x5B, 0xF5, 0xCD,
+    0xE2, 0xD6, 0xEF, 0xBD, 0x47, 0x52, 0xB2, 0x64, 0xD9, 0x82, 0x53, 0x78, 0xEF, 0xF7, 0xDE, 0xEF,
+    0x5F, 0x55, 0xDD, 0x73, 0xCF, 0x3D, 0xE7, 0x7B, 0xBE, 0xE7, 0x9C, 0xCB, 0x99, 0x0E, 0xE0, 0x8F,
+    0x29, 0x16, 0xB4, 0x22, 0x9F, 0xCB, 0xB7, 0x6A, 0x34, 0xD1, 0xCE, 0xF9, 0x82, 0x22, 0xA7, 0x5A,
+    0x7A, 0xFA, 0x5F, 0x83, 0x72, 0x70, 0xBE, 0x05, 0x98, 0xED, 0xE8, 0x00, 0x5C, 0x31, 0xD5, 0x0D,
+    0x50, 0x5E, 0x8D, 0x55, 0x07, 0x64, 0x37, 0x74, 0xC1, 0x03, 0x48, 0x1A, 0x01, 0x74, 0x5D, 0x11,
+    0xA0, 0x7F, 0x62, 0x6A, 0x1B, 0xA0, 0xBF, 0x1A, 0x6D, 0x00, 0x5A, 0x2F, 0x13, 0x81, 0x76, 0x74,
+    0x5D, 0xDB, 0x41, 0x1B, 0xEC, 0x68, 0x27, 0x68, 0x43, 0x31, 0xE5, 0x82, 0x3E, 0xE4, 0x0B, 0x6E,
+    0x44, 0x53, 0xA9, 0x50, 0xAE, 0xD4, 0xC1, 0x68, 0xA6, 0x1F, 0x69, 0x00, 0x8A, 0x09, 0x00, 0xB2,
+    0x98, 0xFE, 0xF2, 0xC8, 0xF6, 0xB7, 0xDE, 0xFE, 0x96, 0x5D, 0xFA, 0x9B, 0x7B, 0x38, 0x4D, 0xC6,
+    0xE9, 0xA6, 0x5C, 0xF2, 0xA9, 0x58, 0x8D, 0x82, 0xCB, 0x15, 0x7A, 0x9D, 0x0B, 0xED, 0x6A, 0xCF,
+    0xCD, 0x57, 0xAC, 0x6F, 0xCE, 0xD7, 0xDF, 0x7E, 0x25, 0x40, 0xFE, 0x7E, 0xBC, 0x02, 0xD4, 0x7A,
+    0xD5, 0x83, 0x91, 0x22, 0xE0, 0x2E, 0xCA, 0x43, 0xF1, 0xC6, 0x12, 0x81, 0xE8, 0x2E, 0xF8, 0x4F,
+    0x7F, 0xDE, 0x15, 0xAF, 0xAD, 0xD5, 0x7D, 0x1A, 0x2E, 0x5B, 0x05, 0xCD, 0xD6, 0x4B, 0xC5, 0xC2,
+    0x6C, 0x6E, 0x84, 0x53, 0xC7, 0xD7, 0x37, 0x01, 0x00, 0x07, 0x40, 0x11, 0x00, 0x4C, 0xBA, 0xD3,
+    0x3B, 0x81, 0xAF, 0x36, 0x94, 0x5A, 0xB1, 0xD2, 0x68, 0x6E, 0x5C, 0x88, 0xC4, 0x4C, 0x3C, 0x8C,
+    0xF3, 0x1F, 0xC7, 0x06, 0x28, 0x67, 0x28, 0x22, 0xF9, 0xA5, 0x19, 0xB4, 0x82, 0x53, 0x80, 0x6A,
+    0x01, 0xD4, 0x81, 0x1B, 0x3F, 0x87, 0x9D, 0x6B, 0xCC, 0x62, 0x43, 0xB1, 0x1A, 0x49, 0xB4, 0x5A,
+    0xC9, 0x75, 0x03, 0xB2, 0x19, 0x38, 0x0B, 0xD8, 0x0E, 0xA3, 0x01, 0x34, 0x42, 0x75, 0x08, 0x64,
+    0x0F, 0x60, 0x34, 0x65, 0x92, 0x77, 0x7F, 0xBA, 0x98, 0xCE, 0x0E, 0x64, 0x11, 0xDA, 0x26, 0xD3,
+    0x80, 0x5B, 0xC9, 0x1E, 0x9C, 0xC1, 0xF9, 0x43, 0x13, 0x6B, 0xDA, 0xC7, 0x97, 0x8B, 0xC1, 0x29,
+    0xD2, 0x2F, 0x50, 0x01, 0x81, 0x33, 0x35, 0x28, 0x50, 0x46, 0x38, 0xBD, 0x89, 0xFD, 0x29, 0x9C,
+    0x82, 0x8D, 0x38, 0x8D, 0x2E, 0x52, 0xAC, 0x28, 0x62, 0x62, 0x1E, 0x7F, 0x93, 0x22, 0x16, 0x01,
+    0x8A, 0x68, 0x3D, 0x94, 0x73, 0xDD, 0x80, 0x9D, 0xCE, 0x02, 0xF6, 0xBD, 0x08, 0x54, 0x8A, 0x40,
+    0xAD, 0x05, 0x70, 0xE3, 0x0A, 0xB8, 0x41, 0x80, 0xF3, 0x7D, 0x07, 0xAD, 0x77, 0x1E, 0xFA, 0xAE,
+    0x1E, 0x41, 0x4D, 0x35, 0x91, 0xE9, 0xD0, 0x46, 0x2A, 0x4D, 0x85, 0x70, 0x0A, 0x99, 0x3C, 0x80,
+    0xEB, 0x8E, 0x85, 0x9B, 0x1E, 0x1F, 0x06, 0xE0, 0xEB, 0x00, 0x3C, 0x04, 0x0F, 0x70, 0x5B, 0xA1,
+    0xAE, 0xBD, 0xA6, 0xB1, 0x0F, 0x0F, 0x4E, 0xFD, 0x9C, 0xC5, 0xB6, 0xA1, 0x75, 0x50, 0x5F, 0x02,
+    0x7B, 0xDD, 0x63, 0x14, 0xC8, 0xB4, 0x40, 0x5F, 0x7B, 0xDC, 0x8B, 0xD3, 0xAD, 0x36, 0xE8, 0xAE,
+    0x62, 0xAE, 0xF4, 0xD8, 0x62, 0x34, 0x88, 0x76, 0x3A, 0x96, 0x24, 0xC5, 0x08, 0xF9, 0x04, 0xC5,
+    0x0C, 0x3C, 0x9D, 0x04, 0xF0, 0x19, 0xAC, 0x22, 0xFD, 0x60, 0xB4, 0xD0, 0xCF, 0x54, 0x13, 0x7D,
+    0xC4, 0x44, 0xDA, 0xDF, 0x25, 0x13, 0x0E, 0x68, 0xFF, 0x97, 0xBA, 0x81, 0xFA, 0x87, 0x55, 0x07,
+    0xF6, 0xDD, 0x97, 0x3C, 0x98, 0xE5, 0xFD, 0x01, 0x32, 0x29, 0x00, 0xFD, 0xA5, 0x15, 0x70, 0x3F,
+    0xB8, 0xE8, 0xC1, 0xBE, 0xFB, 0xE2, 0x0C, 0x26, 0x06, 0x41, 0xB6, 0xDE, 0x56, 0x0F, 0xD0, 0x37,
+    0x45, 0x04, 0x37, 0xA0, 0x8E, 0xEA, 0x06, 0xF5, 0x44, 0x2B, 0x6F, 0xD4, 0x38, 0x05, 0xDC, 0x08,
+    0x90, 0x01, 0x0F, 0x90, 0x35, 0xED, 0x8C, 0xBB, 0xA6, 0xD1, 0xE8, 0x74, 0xDF, 0xB9, 0x39, 0x5B,
+    0xF2, 0x89, 0xE2, 0xC7, 0xDF, 0x68, 0xA8, 0xFF, 0xAF, 0x09, 0xF4, 0x7F, 0x7A, 0x8C, 0xD4, 0x50,
+    0xFD, 0x3F, 0x8F, 0x40, 0xFF, 0x50, 0xC4, 0x2C, 0xAF, 0x4C, 0xB7, 0xDA, 0x50, 0xBE, 0x3B, 0xB6,
+    0x9D, 0xD5, 0x97, 0x16, 0x5C, 0xB4, 0x21, 0x49, 0xF4, 0xD6, 0x34, 0xB4, 0xA7, 0x71, 0x0A, 0xE5,
+    0x82, 0xD3, 0x58, 0xAF, 0x14, 0x6B, 0x1A, 0x59, 0xB6, 0xFC, 0x3A, 0xCF, 0xAE, 0x8F, 0x4F, 0x20,
+    0x3D, 0x39, 0xC0, 0x85, 0x1B, 0xB6, 0x03, 0x3B, 0x39, 0xC0, 0xDE, 0x78, 0xFE, 0x78, 0x6A, 0xDF,
+    0xFF, 0xE8, 0xD4, 0xB6, 0x1F, 0x9D, 0xDA, 0xF0, 0xD1, 0xA9, 0x6D, 0x38, 0xBA, 0x87, 0x4C, 0x60,
+    0xB7, 0x5F, 0x5A, 0xE0, 0x0A, 0xB0, 0x72, 0x5B, 0xAD, 0x17, 0x96, 0x5A, 0x4F, 0xAE, 0x79, 0xAC,
+    0x97, 0x7C, 0x6E, 0x31, 0xD3, 0x8C, 0xF9, 0xF1, 0x48, 0xF1, 0xFE, 0x40, 0xA9, 0x11, 0xFB, 0x7E,
+    0xC0, 0xFE, 0x78, 0xA6, 0x7A, 0x3D, 0x9E, 0xAA, 0x5F, 0x5E, 0xEF, 0xAE, 0x07, 0x45, 0xE7, 0xDB,
+    0xC9, 0x75, 0xF5, 0xC0, 0xFE, 0xF8, 0x8A, 0x91, 0xD6, 0x4C, 0x2F, 0x48, 0xCA, 0x14, 0xFA, 0x4B,
+    0x0B, 0x9A, 0x5D, 0xBE, 0xB2, 0x7E, 0xCC, 0x7A, 0x35, 0x57, 0x30, 0xA3, 0xF3, 0x2D, 0x7C, 0xB9,
+    0x0A, 0x0E, 0x28, 0x62, 0xDD, 0x40, 0xAE, 0x8B, 0x1D, 0x20, 0x0D, 0x80, 0xBB, 0x3E, 0x03, 0x55,
+    0x10, 0x50, 0xCE, 0xD5, 0x08, 0x66, 0x35, 0x11, 0x50, 0xD3, 0x37, 0xE0, 0x7C, 0x15, 0xA0, 0x0A,
+    0x66, 0x85, 0x6A, 0xA1, 0x1D, 0x70, 0x0A, 0x76, 0xA1, 0xD2, 0x8C, 0xBA, 0x6D, 0xEA, 0xB2, 0x03,
+    0xB2, 0xA6, 0xD6, 0xE0, 0xAE, 0x4A, 0x46, 0xF7, 0x3F, 0x16, 0x5D, 0x3C, 0x6B, 0xDF, 0x98, 0x89,
+    0xEE, 0x62, 0xC3, 0xBF, 0x5B, 0x26, 0x28, 0xE5, 0xC1, 0xA9, 0x01, 0x09, 0x8A, 0x79, 0x81, 0xEA,
+    0x95, 0xF9, 0x14, 0x7D, 0xF9, 0x5E, 0x30, 0xD1, 0xCA, 0xDB, 0x50, 0x47, 0xDA, 0xC6, 0x79, 0x4E,
+    0x1E, 0x92, 0x97, 0xBC, 0x91, 0x8C, 0x56, 0x32, 0x75, 0x99, 0x3A, 0xCC, 0x82, 0x89, 0x50, 0x05,
+    0xAA, 0x00, 0xAD, 0xA7, 0xEF, 0xC8, 0x57, 0xCC, 0x0A, 0x76, 0xC2, 0x4E, 0xE0, 0xDE, 0xDA, 0xF5,
+    0x9E, 0x4C, 0x92, 0xA0, 0x94, 0x34, 0x83, 0x1B, 0x71, 0x03, 0xA8, 0x41, 0x0D, 0x26, 0x52, 0xA4,
+    0x53, 0xD4, 0x01, 0x7A, 0x4F, 0xDF, 0x61, 0x56, 0xCC, 0x02, 0xD5, 0x0D, 0xEA, 0x1B, 0x14, 0x5A,
+    0x4B, 0x09, 0xA7, 0xC9, 0x25, 0x7B, 0x8F, 0x4D, 0x22, 0x6F, 0xD3, 0x8C, 0xCE, 0xC9, 0x2A, 0x0F,
+    0x27, 0x8D, 0xF4, 0x43, 0xC0, 0x03, 0x90, 0x69, 0x2C, 0x27, 0x27, 0xFA, 0x7B, 0x2E, 0x8E, 0x36,
+    0x64, 0x2B, 0xA2, 0x1A, 0xAA, 0x31, 0x8F, 0xF9, 0x82, 0x4B, 0x83, 0x89, 0xB4, 0xBB, 0xBE, 0x2B,
+    0xA7, 0x62, 0x42, 0xF4, 0x1F, 0xB3, 0xC1, 0xBE, 0xFB, 0xDA, 0x8A, 0x62, 0x3D, 0x58, 0x5D, 0x8B,
+    0xF4, 0x5F, 0x07, 0x4A, 0x0F, 0x44, 0xC0, 0xFA, 0xCD, 0x2F, 0x08, 0x38, 0xD3, 0x7D, 0x50, 0x34,
+    0x9B, 0x6C, 0xA4, 0x24, 0x9C, 0x67, 0x63, 0x92, 0x4E, 0x39, 0x26, 0xF1, 0xD4, 0x4D, 0x92, 0xCF,
+    0xF3, 0x49, 0x40, 0x59, 0xB7, 0x97, 0xD0, 0x26, 0xA2, 0xBD, 0x8C, 0xF6, 0x42, 0xDA, 0x4B, 0x69,
+    0x13, 0xD3, 0x5E, 0x4E, 0x7B, 0x41, 0x6D, 0x92, 0xDA, 0x8B, 0x6A, 0x93, 0x55, 0x12, 0xD6, 0x42,
+    0x92, 0x56, 0x48, 0x52, 0x80, 0x76, 0xCE, 0xA5, 0x73, 0x0A, 0xA5, 0x74, 0xBA, 0xEF, 0xDC, 0xF7,
+    0x63, 0xB6, 0x22, 0x33, 0x16, 0x53, 0x31, 0xB7, 0xD4, 0xBE, 0x7E, 0x79, 0x42, 0xD2, 0xDE, 0x35,
+    0x55, 0x6F, 0x5D, 0x1A, 0xA1, 0x6F, 0xDA, 0x06, 0x13, 0xF3, 0x08, 0x36, 0xD8, 0x77, 0x3D, 0x6D,
+    0xE7, 0x44, 0xBE, 0xA0, 0x09, 0x1B, 0xF2, 0xB5, 0x01, 0x92, 0xC7, 0x3C, 0x12, 0xC2, 0xFE, 0x1C,
+    0xD2, 0x04, 0x99, 0x6E, 0x5E, 0x5A, 0x92, 0x77, 0xAA, 0x42, 0xBA, 0xEF, 0xBE, 0x03, 0x5A, 0x6F,
+    0x16, 0x20, 0x5F, 0xB1, 0x01, 0xB0, 0x13, 0xAD, 0x07, 0x9C, 0xCF, 0xD5, 0x1F, 0x92, 0x09, 0xAB,
+    0xE4, 0x11, 0x9C, 0x92, 0x45, 0x12, 0xFD, 0x80, 0x9A, 0x22, 0x22, 0x6F, 0x22, 0xF5, 0x98, 0x8B,
+    0x2A, 0xA0, 0xAE, 0x88, 0xF4, 0x9D, 0x59, 0xD2, 0x82, 0xA8, 0x02, 0xAD, 0xAF, 0x66, 0xFA, 0x21,
+    0x5F, 0x0B, 0xC5, 0x4A, 0xC1, 0x4E, 0x4E, 0x63, 0x2F, 0xBF, 0xA9, 0x71, 0xBE, 0xA6, 0xDB, 0xAC,
+    0x02, 0x40, 0x71, 0x8F, 0x92, 0x91, 0x57, 0xF2, 0xA7, 0xDA, 0xDE, 0xED, 0x3B, 0xE0, 0x01, 0xCE,
+    0x43, 0xB5, 0x96, 0x0B, 0xB8, 0xD5, 0x09, 0xEE, 0x58, 0x25, 0xC8, 0xF4, 0x8E, 0x20, 0xD3, 0x0B,
+    0x2B, 0xE4, 0xCA, 0xD7, 0x3F, 0xC6, 0xAC, 0x46, 0xF2, 0x26, 0x1A, 0x29, 0x14, 0xB3, 0x89, 0xE5,
+    0x5C, 0x4E, 0xC5, 0x6C, 0xA2, 0x0D, 0xE5, 0x94, 0x47, 0x1B, 0x6C, 0xC8, 0x63, 0x35, 0xDA, 0x90,
+    0xC7, 0x7A, 0xA8, 0xC6, 0x3C, 0x3A, 0x5F, 0x0D, 0x66, 0x06, 0x30, 0x13, 0x40, 0x19, 0xF6, 0xEA,
+    0x9C, 0x8D, 0xAE, 0x03, 0x23, 0x01, 0xB9, 0x66, 0x80, 0xFF, 0xB1, 0x03, 0x4E, 0x3F, 0x05, 0x64,
+    0x9A, 0x01, 0xAB, 0x43, 0xA0, 0x9D, 0x0A, 0x35, 0xA8, 0x73, 0x1A, 0xCD, 0x8A, 0xBE, 0x1D, 0xCA,
+    0x98, 0xC7, 0x62, 0xB6, 0x93, 0x99, 0xCC, 0x5C, 0x85, 0x32, 0x98, 0xB9, 0x1E, 0x6D, 0x30, 0xB3,
+    0x1B, 0xEC, 0x58, 0x4C, 0x6E, 0xB0, 0x63, 0x19, 0xDC, 0x50, 0x8D, 0x36, 0xB8, 0xC1, 0x8E, 0xD5,
+    0xE0, 0x46, 0x1B, 0x9C, 0xAF, 0x83, 0x0D, 0x7D, 0x53, 0x4D, 0xC5, 0x8D, 0x05, 0xBB, 0x18, 0xCD,
+    0x18, 0xBD, 0xAF, 0xF7, 0xFE, 0x87, 0x4C, 0x92, 0x22, 0x95, 0xDE, 0xD6, 0x08, 0xB7, 0x72, 0x0A,
+    0xB2, 0xA7, 0x81, 0x7E, 0x04, 0x3B, 0x9D, 0x6E, 0x50, 0xA6, 0xA1, 0x0C, 0xB5, 0xBC, 0xBB, 0x27,
+    0xBA, 0x47, 0xA3, 0xF5, 0x57, 0xEC, 0xE8, 0xF2, 0xD9, 0xDD, 0x13, 0xED, 0xB0, 0x14, 0xA3, 0x33,
+    0x73, 0x75, 0x75, 0xB6, 0xC1, 0x59, 0x5F, 0xFB, 0x35, 0xD2, 0xBE, 0x2C, 0xDF, 0xF4, 0xD2, 0x25,
+    0xDA, 0x55, 0x13, 0xA7, 0xB9, 0x0D, 0x38, 0xF3, 0x0C, 0xE4, 0xD2, 0x40, 0x2F, 0x75, 0xA5, 0x76,
+    0x2B, 0x1A, 0xF3, 0xA9, 0x8C, 0x58, 0xEF, 0x06, 0xCE, 0xE6, 0x2B, 0x9C, 0xB7, 0x13, 0xD0, 0x7A,
+    0xC8, 0x05, 0xD8, 0x98, 0x16, 0x04, 0xC8, 0x83, 0x11, 0x60, 0x17, 0xF8, 0x72, 0x1D, 0x29, 0xBD,
+    0x5B, 0x7F, 0x6F, 0xA5, 0x97, 0x02, 0xBD, 0x04, 0x17, 0x75, 0x08, 0x66, 0xDC, 0x5C, 0x2C, 0x67,
+    0x01, 0x4D, 0x60, 0xD4, 0x41, 0xF1, 0x23, 0x00, 0x1E, 0x20, 0xD7, 0x50, 0x28, 0x16, 0x5A, 0x4D,
+    0x2C, 0xF2, 0x08, 0x2B, 0xF4, 0x0D, 0xCE, 0x63, 0x03, 0x26, 0x82, 0xF8, 0x2D, 0x17, 0x5A, 0x2B,
+    0xDD, 0x23, 0x35, 0xD5, 0x0A, 0x5F, 0x07, 0x4B, 0xF6, 0xA4, 0x47, 0x69, 0xFD, 0x9D, 0xDF, 0xB4,
+    0xDE, 0x4A, 0x5A, 0x2A, 0x49, 0xB1, 0xBE, 0xA9, 0x67, 0xA3, 0xCB, 0x94, 0x45, 0x97, 0x2B, 0x9B,
+    0xCE, 0xE6, 0x6B, 0x1E, 0x7E, 0xDD, 0x2C, 0x59, 0x97, 0x00, 0x5A, 0x11, 0x81, 0x32, 0x02, 0x76,
+    0x4E, 0x7A, 0x4F, 0x5A, 0x01, 0x55, 0x00, 0xEA, 0x71, 0x3F, 0x40, 0x37, 0x00, 0xFD, 0x8F, 0xC0,
+    0x4A, 0x60, 0xB5, 0x02, 0xD9, 0xB2, 0x07, 0xA4, 0xF9, 0x0C, 0xE4, 0xE1, 0xE8, 0x61, 0xD8, 0xD4,
+    0xF5, 0x7C, 0xA6, 0xA1, 0xEF, 0xE4, 0xDD, 0xEA, 0x62, 0x1B, 0xB3, 0x8B, 0xAF, 0xEA, 0x55, 0x0D,
+    0x99, 0x5E, 0xD3, 0xF7, 0x22, 0x55, 0xAC, 0x67, 0xE7, 0x73, 0x19, 0x99, 0x88, 0x1B, 0x9C, 0x6F,
+    0x3B, 0x13, 0x8B, 0x58, 0x4E, 0xB4, 0x5D, 0xDF, 0x88, 0x72, 0xB2, 0xC1, 0x8E, 0x08, 0x65, 0xCB,
+    0x6D, 0x36, 0x54, 0x63, 0xFD, 0xE6, 0x0B, 0x6B, 0xBE, 0xE4, 0x9A, 0xEB, 0xA1, 0xF6, 0xB5, 0xCE,
+    0x45, 0x33, 0x67, 0x4B, 0x00, 0xC8, 0xAA, 0x06, 0x12, 0x66, 0x01, 0xEA, 0xE6, 0x18, 0x91, 0xE6,
+    0x0B, 0x00, 0xB7, 0xEC, 0xA5, 0x32, 0x39, 0x5D, 0x53, 0xB4, 0x1A, 0x5C, 0xA0, 0xEF, 0x8A, 0x88,
+    0xEB, 0x50, 0xE3, 0x3C, 0xF5, 0x58, 0x79, 0x4C, 0xB4, 0x03, 0xE8, 0xFE, 0x11, 0xEA, 0xB7, 0x03,
+    0x18, 0x85, 0x6D, 0x9A, 0xA8, 0xE6, 0x3D, 0xA4, 0xCD, 0x74, 0xB4, 0x22, 0xDD, 0xB8, 0x17, 0x59,
+    0xB9, 0x36, 0xE0, 0x34, 0x81, 0x55, 0x04, 0xB2, 0x26, 0x6B, 0xFA, 0xC1, 0xFD, 0x40, 0x5E, 0xFF,
+    0x5E, 0xD9, 0x9A, 0x2F, 0x66, 0x2E, 0xA6, 0x6A, 0xA8, 0xC6, 0x16, 0xF7, 0xD8, 0xCC, 0x6A, 0x7D,
+    0x1E, 0x2F, 0x53, 0xFE, 0x78, 0xA4, 0x12, 0xB4, 0x81, 0x4C, 0x0D, 0xC5, 0x04, 0x95, 0x87, 0x1E,
+    0xCC, 0x9C, 0x16, 0x60, 0x0B, 0xC5, 0xDA, 0x20, 0x91, 0xEF, 0x9E, 0xE6, 0x1F, 0x3A, 0x8A, 0xBC,
+    0x5F, 0x0F, 0xC9, 0xA5, 0x19, 0xEE, 0xD0, 0x03, 0xFF, 0xE8, 0xA3, 0x98, 0xC8, 0xD4, 0x64, 0x97,
+    0xD6, 0x43, 0x2B, 0x35, 0xE8, 0xEF, 0x1E, 0x05, 0x38, 0x0D, 0x12, 0x4E, 0x5E, 0x0B, 0xE5, 0x8A,
+    0x1B, 0x30, 0xA2, 0x6F, 0xC8, 0x94, 0x2D, 0x80, 0x9E, 0x98, 0x80, 0xF6, 0xD5, 0x11, 0x70, 0xEA,
+    0x80, 0x6A, 0x65, 0xBF, 0xE8, 0xA8, 0x22, 0x80, 0x5B, 0x01, 0x56, 0x01, 0x66, 0x56, 0x07, 0x36,
+    0xB4, 0x1E, 0x9C, 0x77, 0x23, 0xF4, 0x54, 0x81, 0x7C, 0xA5, 0xBA, 0x41, 0xAD, 0x41, 0xF2, 0x4E,
+    0x2F, 0x28, 0x01, 0xEA, 0xBA, 0x3B, 0x56, 0x94, 0x04, 0xA8, 0xCF, 0x02, 0x70, 0x37, 0x00, 0x5F,
+    0x84, 0xD3, 0x9C, 0x6E, 0xAA, 0xC9, 0xAC, 0x85, 0xBC, 0xC6, 0x76, 0xA9, 0x17, 0xAA, 0x37, 0x47,
+    0xD0, 0x0C, 0x85, 0xB6, 0xE5, 0x90, 0x2F, 0x80, 0x0B, 0x09, 0xB5, 0xE5, 0xEF, 0xCF, 0x9F, 0xFE,
+    0x17, 0x57, 0xDC, 0xAB, 0x8F, 0xEB, 0xAA, 0xA6, 0x36, 0x58, 0x99, 0xC8, 0x95, 0x70, 0x2A, 0x45,
+    0x14, 0xF9, 0xB4, 0x5D, 0xCD, 0x84, 0xED, 0x6B, 0x77, 0x72, 0xBC, 0x50, 0xA3, 0xD3, 0xD0, 0x4A,
+    0x41, 0xCA, 0x6F, 0xE8, 0x62, 0x27, 0x6F, 0xAF, 0xC5, 0xBB, 0xCD, 0xC2, 0xD9, 0xEA, 0xB5, 0x60,
+    0x03, 0x7F, 0xD5, 0xDE, 0xDB, 0x39, 0x4F, 0x1E, 0x13, 0x4A, 0x0C, 0x94, 0x33, 0x38, 0x8F, 0x1B,
+    0xC8, 0x56, 0x10, 0x94, 0x13, 0x45, 0x04, 0xE7, 0xA9, 0x46, 0x10, 0xF4, 0x1D, 0x66, 0x4E, 0x58,
+    0x65, 0xC4, 0x06, 0xE8, 0x1B, 0x5A, 0x8F, 0x89, 0xE4, 0x2B, 0x54, 0xDA, 0x5D, 0x5A, 0x9B, 0x22,
+    0x39, 0x46, 0x97, 0x2C, 0x2B, 0x80, 0x1D, 0xD3, 0xB4, 0x24, 0xEF, 0x99, 0x5E, 0x2B, 0xD2, 0x6B,
+    0x55, 0xBA, 0xD9, 0xAF, 0x01, 0xA5, 0x66, 0x90, 0x3C, 0x36, 0xF9, 0x83, 0x74, 0x9C, 0x86, 0xF3,
+    0xD5, 0x82, 0x8C, 0x46, 0x1B, 0xEE, 0x58, 0xB2, 0x95, 0xCA, 0xD7, 0x43, 0x1E, 0x4D, 0xC4, 0x79,
+    0xE7, 0x8B, 0xA9, 0x98, 0xE9, 0x51, 0x63, 0x43, 0x15, 0x58, 0x8D, 0xA8, 0x86, 0x3E, 0x7C, 0x29,
+    0xD6, 0xED, 0xDD, 0xB5, 0xBE, 0xAB, 0xAB, 0x0A, 0xED, 0x6C, 0x67, 0xF3, 0x76, 0x77, 0x0A, 0xE6,
+    0x0D, 0xD1, 0x10, 0x37, 0xA1, 0x55, 0xE1, 0x38, 0x0C, 0xB1, 0x8A, 0xAD, 0xDE, 0xD0, 0x52, 0x2B,
+    0x54, 0x73, 0xA6, 0xC1, 0x44, 0xEA, 0x31, 0x13, 0x76, 0xA2, 0xEF, 0x8E, 0x9E, 0xCC, 0xF4, 0x3E,
+    0x17, 0x6E, 0xA4, 0xBF, 0x71, 0x71, 0xC2, 0x4A, 0x91, 0x04, 0x25, 0xB2, 0xBF, 0xF8, 0x90, 0xCA,
+    0x17, 0x47, 0x4B, 0x3A, 0xD3, 0x8F, 0xA0, 0x90, 0x1A, 0x4C, 0x82, 0xBD, 0x65, 0x20, 0xA9, 0xF0,
+    0x26, 0x0C, 0x07, 0x60, 0x1B, 0xC0, 0x78, 0xB8, 0x0D, 0xCE, 0xA8, 0x71, 0xD7, 0x34, 0x54, 0xE3,
+    0x83, 0xA1, 0x0C, 0x79, 0x34, 0x91, 0x95, 0x15, 0xD7, 0xF5, 0x9D, 0x1D, 0xDB, 0xC1, 0xAC, 0x0A,
+    0xF4, 0x8A, 0x9C, 0xF9, 0xD1, 0x0A, 0xB4, 0xFF, 0x35, 0xD4, 0x3F, 0xF4, 0x58, 0x0D, 0x69, 0x45,
+    0xB6, 0x5F, 0xDF, 0x80, 0xA1, 0xF5, 0x49, 0x31, 0xB2, 0xB8, 0x59, 0x98, 0xAF, 0xA4, 0xB1, 0x1A,
+    0xC9, 0x2A, 0x3A, 0xBD, 0x2C, 0x35, 0xED, 0x98, 0xAB, 0x49, 0x98, 0xA5, 0xF5, 0xF9, 0x4A, 0x19,
+    0x71, 0x03, 0xFD, 0xE3, 0x8F, 0x2F, 0xD8, 0xF9, 0x6B, 0xAD, 0xA7, 0xFF, 0xEE, 0x7D, 0x91, 0x72,
+    0xBD, 0xA1, 0x0E, 0x27, 0x4D, 0xDB, 0x70, 0xB9, 0x78, 0x21, 0x40, 0xFE, 0x3D, 0x01, 0xBF, 0xED,
+    0x46, 0xC8, 0x1F, 0x5F, 0x00, 0x9C, 0x07, 0x3E, 0xB1, 0xB0, 0x2D, 0xF4, 0x5C, 0x3A, 0x39, 0x22,
+    0x6F, 0xC3, 0x83, 0xA1, 0x98, 0xF2, 0x98, 0x2F, 0xAC, 0x08, 0xF7, 0xAF, 0x9C, 0xB7, 0x3F, 0xB8,
+    0x30, 0x9A, 0xF5, 0xFA, 0x94, 0x46, 0x14, 0x05, 0x1F, 0x77, 0x1D, 0xE6, 0xC2, 0x9B, 0x1D, 0x85,
+    0x46, 0x32, 0x85, 0x24, 0xD5, 0xEC, 0x58, 0xB1, 0x97, 0x3D, 0x72, 0x48, 0xB6, 0x73, 0x61, 0x43,
+    0xA8, 0x09, 0x59, 0xD5, 0x23, 0x60, 0x6F, 0xF4, 0x87, 0x18, 0x69, 0x05, 0x49, 0x03, 0xED, 0x50,
+    0xCD, 0xD4, 0x63, 0xBE, 0x1E, 0x4D, 0xA8, 0x1B, 0x3E, 0x3C, 0xBB, 0xD5, 0x8D, 0x4C, 0x43, 0xAB,
+    0x57, 0xB4, 0x3A, 0xBD, 0x23, 0x35, 0x9C, 0x26, 0x5D, 0x5E, 0x11, 0xEE, 0x10, 0xD0, 0x76, 0x50,
+    0x0F, 0xC9, 0x8F, 0x99, 0xF9, 0x74, 0x93, 0x2D, 0xD5, 0x4C, 0x5F, 0x8B, 0xFA, 0xBA, 0x06, 0xAB,
+    0xFB, 0x82, 0xD1, 0xB9, 0x98, 0xA9, 0x5B, 0xE9, 0x7D, 0xDB, 0xB8, 0xA1, 0xF6, 0x36, 0xD8, 0x50,
+    0xCC, 0x66, 0xCE, 0x97, 0x6C, 0x41, 0x4D, 0xFF, 0x87, 0xCE, 0x3B, 0xDD, 0x1F, 0xAC, 0x9E, 0x98,
+    0x32, 0x35, 0x70, 0x0A, 0xE0, 0x8E, 0x43, 0xA0, 0xD6, 0x08, 0x95, 0xE4, 0x29, 0xD7, 0x4B, 0x4B,
+    0xF5, 0x25, 0xE1, 0x7E, 0x32, 0xB6, 0x3E, 0xD3, 0x62, 0x27, 0x2A, 0xBD, 0x2C, 0xF2, 0x75, 0x75,
+    0x03, 0xF5, 0x0F, 0x24, 0x29, 0xD6, 0x92, 0xE4, 0x6B, 0x49, 0x13, 0xBD, 0x3F, 0xB2, 0x5E, 0xBD,
+    0xDF, 0xBC, 0xEE, 0x53, 0xB4, 0x23, 0x35, 0x46, 0x5D, 0x1D, 0xA8, 0xA4, 0x48, 0x42, 0x0B, 0x99,
+    0xD6, 0x66, 0x1F, 0x1D, 0x66, 0x0F, 0x40, 0xA1, 0x0E, 0xAB, 0x09, 0xFB, 0xDA, 0x4A, 0x39, 0xBA,
+    0xFB, 0x9E, 0x08, 0xD5, 0x8B, 0xD7, 0x66, 0xFB, 0x7A, 0x58, 0xAA, 0xF1, 0x91, 0xB6, 0x1F, 0xAC,
+    0xD4, 0xD1, 0x2F, 0x90, 0x47, 0x1E, 0xA2, 0xEF, 0xAE, 0x50, 0x49, 0x49, 0xFC, 0xF5, 0xC2, 0x1E,
+    0x17, 0xFC, 0xCA, 0x47, 0x50, 0x6F, 0x23, 0x58, 0xF7, 0x23, 0xC8, 0x23, 0x40, 0xED, 0x8F, 0xBC,
+    0x73, 0xCD, 0x1E, 0x24, 0xF0, 0xDB, 0x1C, 0x61, 0xF5, 0x5F, 0x6E, 0x88, 0x56, 0x22, 0x3F, 0x1A,
+    0x62, 0xDC, 0x33, 0x18, 0x4D, 0x5A, 0xA0, 0x04, 0xE0, 0x37, 0x8F, 0xA2, 0x80, 0xC1, 0x48, 0x64,
+    0xF2, 0x98, 0x25, 0x69, 0x46, 0xEB, 0xC9, 0x95, 0x60, 0x8F, 0x1B, 0x40, 0xC9, 0x16, 0xA4, 0x70,
+    0x3D, 0xD9, 0xCE, 0x14, 0xF8, 0xE5, 0x29, 0xAC, 0x2D, 0xB4, 0x26, 0xD7, 0xB8, 0xE7, 0x22, 0x80,
+    0x5B, 0x19, 0x36, 0x36, 0x26, 0xC1, 0xF5, 0xDA, 0x6F, 0x56, 0x73, 0xB3, 0xA8, 0xF4, 0x9B, 0x89,
+    0xCC, 0xCE, 0x9F, 0x0C, 0x59, 0x53, 0x88, 0xF6, 0x15, 0x8A, 0x78, 0x82, 0x7D, 0x44, 0x81, 0x7E,
+    0xFA, 0x05, 0xD8, 0x47, 0xB7, 0x67, 0x1F, 0x9B, 0x9F, 0xCA, 0x3E, 0x6E, 0xD6, 0x5C, 0x4F, 0x4C,
+    0xFD, 0x9E, 0x7D, 0x1C, 0x4F, 0xB2, 0x8F, 0xC3, 0xC6, 0x3E, 0x8E, 0x76, 0xB0, 0x01, 0xFA, 0x23,
+    0xF6, 0xD1, 0x24, 0xF6, 0x31, 0x7C, 0x80, 0x7D, 0xEC, 0xB6, 0xF9, 0xF9, 0x40, 0xC8, 0x7D, 0x1B,
+    0x40, 0x30, 0x1D, 0xE0, 0xF8, 0x2B, 0xC0, 0x2C, 0x2D, 0x40, 0xB5, 0x39, 0xD7, 0xC3, 0x13, 0x6E,
+    0xE1, 0x57, 0x4A, 0x44, 0xC6, 0x62, 0x61, 0x36, 0x6B, 0x5A, 0x9E, 0xFC, 0x3C, 0x36, 0xA7, 0x88,
+    0x66, 0x82, 0x22, 0xDA, 0x01, 0xCA, 0xB9, 0x3E, 0x66, 0x73, 0xDE, 0x5F, 0x81, 0x4A, 0x1A, 0xA0,
+    0x56, 0x32, 0x64, 0x55, 0x04, 0x37, 0x94, 0x0B, 0x38, 0x6F, 0x56, 0x68, 0xBD, 0x59, 0xA1, 0xEF,
+    0xF2, 0x15, 0xD4, 0x98, 0x85, 0x4C, 0x87, 0x66, 0xA1, 0xD2, 0x64, 0x22, 0x4E, 0xA1, 0x98, 0xD9,
+    0x7B, 0x14, 0xEA, 0x11, 0xF2, 0xA1, 0xF7, 0x7B, 0xF3, 0x67, 0x34, 0x03, 0x99, 0x52, 0x0C, 0x77,
+    0x5B, 0xA1, 0xCE, 0x5D, 0xD3, 0xE8, 0xC2, 0x83, 0x73, 0x3D, 0x67, 0x4B, 0xD5, 0xD1, 0x5A, 0x4F,
+    0xFD, 0xE2, 0x80, 0x7D, 0x37, 0x90, 0x58, 0x0C, 0x05, 0xFA, 0xDF, 0x5D, 0x71, 0xDE, 0x79, 0x3B,
+    0x16, 0x53, 0x31, 0x67, 0x4B, 0xBE, 0xD0, 0x36, 0xA2, 0xF2, 0xC9, 0x31, 0x99, 0x19, 0xB2, 0x48,
+    0xF1, 0xE8, 0x82, 0xD1, 0x0A, 0xFD, 0x02, 0x67, 0x7E, 0xC4, 0x09, 0x70, 0x25, 0x79, 0xAA, 0xA4,
+    0x16, 0xED, 0xFF, 0xAA, 0x0E, 0xAC, 0x6F, 0x3D, 0x14, 0xA1, 0x0A, 0x90, 0xCF, 0xE5, 0x0C, 0x44,
+    0xB3, 0x00, 0x0E, 0x01, 0x55, 0xD7, 0x7A, 0xB0, 0x43, 0x1D, 0xC0, 0x04, 0x3B, 0x43, 0x3E, 0x9B,
+    0xB4, 0xB0, 0x04, 0x5C, 0xA1, 0xF5, 0xE0, 0xA8, 0x03, 0xB8, 0xCE, 0xCE, 0xD8, 0xD6, 0x9B, 0x85,
+    0x42, 0xC3, 0x19, 0x1D, 0x66, 0x1A, 0xAC, 0x84, 0x1B, 0x0A, 0xA9, 0xCB, 0x48, 0x30, 0x76, 0x8F,
+    0x28, 0x36, 0x3A, 0xF8, 0xC4, 0x23, 0x09, 0x55, 0x1C, 0x9C, 0x87, 0x5A, 0x1E, 0xA3, 0x05, 0xEA,
+    0x6F, 0x07, 0xB2, 0xD9, 0x79, 0x4A, 0xBF, 0xC2, 0xD9, 0x62, 0x22, 0x9B, 0x6A, 0x8F, 0xDD, 0x3F,
+    0xCB, 0xD3, 0x33, 0x7D, 0xEC, 0x33, 0x57, 0x4C, 0x9C, 0x15, 0xAC, 0x5E, 0x51, 0xE3, 0x64, 0x27,
+    0x14, 0x81, 0x62, 0xD8, 0x3C, 0x74, 0x36, 0xED, 0x43, 0xAC, 0xAF, 0x7D, 0x90, 0x0A, 0xF8, 0x27,
+    0x21, 0x8A, 0x6C, 0xA0, 0xD0, 0x4A, 0xEB, 0x71, 0x9A, 0xB6, 0x58, 0x3F, 0x69, 0x49, 0xF2, 0x82,
+    0x36, 0xB9, 0xC5, 0x56, 0x23, 0x90, 0xA5, 0x70, 0x3F, 0x69, 0x0A, 0xC9, 0x24, 0xD6, 0xAF, 0x28,
+    0x94, 0xD3, 0x83, 0xB3, 0x89, 0xD9, 0x8A, 0x68, 0x9B, 0xB6, 0xAB, 0x7D, 0x3D, 0x58, 0x29, 0x18,
+    0x29, 0x66, 0xEB, 0x4E, 0xF4, 0x4D, 0xDB, 0x39, 0x5F, 0x0F, 0x9B, 0x17, 0xDB, 0xBB, 0xED, 0xB6,
+    0x49, 0x96, 0xD7, 0x06, 0x28, 0x26, 0x8A, 0xC7, 0x23, 0x46, 0x31, 0xF9, 0xC9, 0x93, 0xAA, 0xF2,
+    0xFF, 0x07, 0x06, 0x6D, 0x3E, 0xC9, 0xA0, 0x5D, 0x39, 0x91, 0x45, 0xD8, 0xE0, 0xF9, 0x16, 0xDA,
+    0xDD, 0xC2, 0x3F, 0x80, 0x41, 0xFB, 0xF1, 0x6B, 0x2B, 0x5A, 0xF6, 0x0C, 0x5A, 0x04, 0xAA, 0x0D,
+    0x92, 0xF3, 0xF0, 0xA6, 0x33, 0xD9, 0x08, 0x7B, 0x6B, 0xF2, 0x2B, 0x85, 0x9A, 0x03, 0x94, 0x1B,
+    0x2D, 0xD5, 0xC1, 0x7A, 0x0C, 0x2F, 0x3D, 0x60, 0x06, 0x36, 0xF7, 0xC5, 0xEF, 0x6C, 0xF6, 0xF6,
+    0xA7, 0x41, 0x4D, 0xFD, 0x4C, 0xA8, 0xD9, 0x1C, 0xE3, 0x9F, 0x3A, 0x42, 0xAD, 0xB4, 0x14, 0x4D,
+    0x20, 0xC1, 0xEB, 0xBB, 0x37, 0x48, 0x9F, 0x9F, 0x20, 0xCA, 0xAC, 0x06, 0xDA, 0x15, 0xAB, 0x11,
+    0x45, 0x72, 0x8D, 0xB9, 0x06, 0x72, 0x8D, 0x46, 0x1E, 0xA3, 0x50, 0xCA, 0x53, 0x28, 0xD8, 0xEB,
+    0x9E, 0xF2, 0x87, 0xA1, 0x6E, 0x3D, 0xF6, 0xBB, 0xE1, 0xAC, 0xF3, 0xD8, 0x17, 0xA7, 0xE8, 0x3C,
+    0xF5, 0xE3, 0x37, 0x66, 0xE7, 0x71, 0xE7, 0xDE, 0x0F, 0xAE, 0xC3, 0x19, 0x8D, 0x6D, 0xC7, 0x23,
+    0xB9, 0x7C, 0xDB, 0xB1, 0xE4, 0x6A, 0xDA, 0x8E, 0x98, 0x89, 0xBE, 0xCB, 0x22, 0x0B, 0x7D, 0x93,
+    0xCF, 0x44, 0xFA, 0xA6, 0x98, 0x39, 0x9F, 0xE9, 0xAF, 0x9D, 0x1A, 0x2A, 0xC5, 0x5E, 0x50, 0x6F,
+    0xBE, 0x33, 0x51, 0x51, 0x1B, 0x17, 0x95, 0xE4, 0x72, 0x14, 0x9B, 0xA4, 0xEC, 0x07, 0x4F, 0x41,
+    0x76, 0x9E, 0xD3, 0x0D, 0x7D, 0xC4, 0x4D, 0x48, 0x28, 0x60, 0x95, 0x6B, 0xC4, 0xF6, 0xE7, 0xAE,
+    0x0F, 0xD8, 0x8B, 0x4F, 0xBE, 0xE4, 0xA9, 0x2E, 0x7C, 0xE3, 0x82, 0xA7, 0xAA, 0xAE, 0xD7, 0x9E,
+    0xBA, 0x5A, 0xEA, 0x8E, 0xB3, 0x36, 0xBA, 0x86, 0xBB, 0xED, 0xE4, 0x1A, 0x9E, 0xB7, 0xC1, 0x7D,
+    0xEC, 0x37, 0xA3, 0x1D, 0xDB, 0x47, 0xDC, 0x64, 0x7D, 0xBB, 0xB8, 0x60, 0x7D, 0x1B, 0x9D, 0xFF,
+    0x35, 0x5C, 0x3C, 0xB5, 0x37, 0x28, 0x9B, 0xE1, 0x2A, 0x06, 0xF6, 0xD6, 0x85, 0x4F, 0x41, 0x52,
+    0x96, 0xDB, 0x0F, 0x9A, 0x52, 0x91, 0x56, 0x1D, 0x7D, 0x47, 0x39, 0x41, 0x8A, 0xD3, 0xB2, 0x15,
+    0xAA, 0x81, 0x7C, 0x01, 0xE7, 0x31, 0x11, 0xDA, 0x8E, 0x62, 0x82, 0x3E, 0x4D, 0x8D, 0xA0, 0x1A,
+    0xC9, 0x16, 0xA8, 0x3D, 0xC5, 0xDA, 0x14, 0x5A, 0xD8, 0xE2, 0x53, 0x32, 0xE0, 0x34, 0xBF, 0x01,
+    0x3C, 0x4F, 0x00, 0x33, 0x57, 0x1D, 0x5B, 0xC4, 0x65, 0xD5, 0x00, 0xD9, 0x89, 0xA9, 0x3B, 0xD3,
+    0x1C, 0x41, 0xEB, 0x32, 0x02, 0x29, 0x9B, 0x63, 0x34, 0x00, 0x75, 0xDF, 0x01, 0x51, 0x40, 0xF9,
+    0x46, 0x04, 0xDA, 0x32, 0x80, 0x99, 0xEA, 0x01, 0x2A, 0xDF, 0x76, 0xB0, 0x20, 0x28, 0xDF, 0xFB,
+    0xFD, 0x48, 0xE2, 0x36, 0x8D, 0xA4, 0x81, 0xEA, 0xFB, 0x07, 0x7D, 0xC7, 0x4A, 0x2E, 0xCA, 0x40,
+    0x11, 0x69, 0x3D, 0xF5, 0x8D, 0x4A, 0x43, 0xA9, 0xA5, 0x4F, 0x69, 0x99, 0x2D, 0xDF, 0xD8, 0xF0,
+    0x75, 0x46, 0x1C, 0x13, 0xF6, 0x6F, 0x23, 0xB9, 0x22, 0x7C, 0xE2, 0x47, 0x7B, 0xD8, 0x73, 0x9A,
+    0x42, 0x17, 0x7D, 0x21, 0x8D, 0xC5, 0xDA, 0x06, 0x13, 0x4F, 0x18, 0xA7, 0xB6, 0x73, 0xBE, 0xF6,
+    0x55, 0xB0, 0xC1, 0xCE, 0x26, 0x16, 0x0B, 0x32, 0x6A, 0xDC, 0xB5, 0xEB, 0x6F, 0x7F, 0x43, 0x3F,
+    0xD6, 0xEB, 0x0A, 0x1A, 0xDD, 0x58, 0x0D, 0x9B, 0x01, 0xCF, 0x0E, 0x3F, 0x03, 0xD4, 0xD7, 0x22,
+    0xA0, 0x2A, 0x80, 0x99, 0x1C, 0x90, 0xED, 0x73, 0x38, 0x00, 0x7F, 0xC4, 0x9E, 0xBB, 0x4A, 0xE8,
+    0xB4, 0x50, 0x03, 0xB8, 0x05, 0xC8, 0xDF, 0x9F, 0x01, 0xFB, 0x52, 0x00, 0xAE, 0x38, 0x0F, 0x45,
+    0xE8, 0x01, 0xF7, 0xA5, 0x05, 0xB2, 0x58, 0xCC, 0xB0, 0xA1, 0xA1, 0x83, 0xD6, 0x63, 0x24, 0x81,
+    0x93, 0x16, 0xB2, 0xE5, 0xE0, 0xC1, 0x19, 0x3B, 0x52, 0x07, 0x7A, 0x68, 0x7D, 0x11, 0xC9, 0xF5,
+    0xEF, 0xB4, 0xD0, 0xEB, 0x87, 0x9A, 0x92, 0x7F, 0x07, 0x98, 0xEB, 0x06, 0x55, 0x23, 0xEE, 0xC9,
+    0x40, 0xD1, 0x3D, 0x7D, 0x22, 0x30, 0x6E, 0x6E, 0xA3, 0x5A, 0x7A, 0x2A, 0xA9, 0xAB, 0x6E, 0xC8,
+    0xDB, 0x60, 0x43, 0x39, 0x99, 0xD9, 0xC4, 0x6C, 0xC9, 0x56, 0x44, 0x4F, 0xEB, 0x9D, 0x77, 0xA3,
+    0x0D, 0xD5, 0x64, 0xA2, 0x5D, 0x90, 0xED, 0xFF, 0x83, 0xD3, 0x4B, 0x7A, 0x52, 0xD7, 0xD4, 0xA9,
+    0x6B, 0x9B, 0x0F, 0x82, 0x2F, 0x7A, 0x49, 0x27, 0x78, 0x79, 0xDA, 0xF5, 0xD9, 0x08, 0x18, 0x8D,
+    0x66, 0x04, 0x5C, 0xDB, 0xD8, 0x06, 0xF2, 0xF7, 0x22, 0xBF, 0x09, 0xD4, 0x4F, 0x26, 0x86, 0x2C,
+    0xA6, 0x1C, 0xA2, 0xF5, 0xEB, 0x1F, 0x1C, 0x02, 0x4B, 0x29, 0x75, 0x60, 0xC7, 0x94, 0xBC, 0xE8,
+    0x93, 0xF6, 0x14, 0x89, 0xE2, 0xA7, 0x95, 0x06, 0x1A, 0xCC, 0x8C, 0x28, 0x3B, 0x9C, 0x37, 0x91,
+    0xB3, 0xE4, 0x11, 0x1B, 0xF2, 0x99, 0x7A, 0xC8, 0xFA, 0xB7, 0x34, 0x14, 0x1A, 0x5D, 0x62, 0x10,
+    0xBA, 0x2D, 0x35, 0xF0, 0x00, 0xB7, 0x83, 0x5B, 0x4B, 0x25, 0x72, 0x81, 0xF6, 0xBF, 0xE8, 0x95,
+    0x68, 0x62, 0x16, 0xCB, 0x50, 0x0F, 0x76, 0x70, 0x9D, 0x68, 0xF3, 0x58, 0xCC, 0x26, 0xD6, 0xBE,
+    0xF6, 0xD5, 0xFB, 0x33, 0x42, 0x6A, 0x4C, 0x2C, 0x74, 0x88, 0x0D, 0x6E, 0xE6, 0x3B, 0xEE, 0xDA,
+    0xF5, 0x50, 0x79, 0xA9, 0xD6, 0x9A, 0x2B, 0x38, 0x0D, 0x66, 0xA5, 0x9D, 0xA1, 0xD9, 0x5B, 0xE5,
+    0x53, 0x90, 0x35, 0x05, 0x64, 0x93, 0xF1, 0xB0, 0x16, 0x01, 0x6A, 0x05, 0xC8, 0x35, 0x02, 0xA7,
+    0x4F, 0x32, 0xFF, 0xD8, 0x2D, 0xFB, 0xA1, 0x40, 0x75, 0xF3, 0xD9, 0x19, 0x13, 0x79, 0x84, 0x4C,
+    0x54, 0x0D, 0xAD, 0x2F, 0xBA, 0x2D, 0x04, 0x9D, 0x00, 0xB3, 0xFE, 0xC1, 0x21, 0x99, 0x34, 0x43,
+    0xAF, 0x78, 0xD2, 0x68, 0x9B, 0xC8, 0x29, 0x32, 0x51, 0x76, 0xF4, 0x9D, 0x19, 0x71, 0x83, 0x99,
+    0xA8, 0xD6, 0x3E, 0xD2, 0xEE, 0xE9, 0x93, 0xA3, 0x6B, 0x76, 0xD9, 0x58, 0x34, 0xD6, 0x7F, 0x11,
+    0xF7, 0xE7, 0x23, 0xFD, 0x0A, 0x17, 0xB7, 0x5C, 0xCC, 0x03, 0x50, 0x2F, 0x14, 0x8A, 0xB4, 0xF7,
+    0x05, 0x13, 0x2A, 0xEF, 0xBA, 0x95, 0x58, 0x86, 0x32, 0xF4, 0xB8, 0xEB, 0x01, 0x2D, 0x98, 0xB5,
+    0xC1, 0x8E, 0xB9, 0x77, 0xBE, 0xA5, 0xD7, 0x8C, 0xD4, 0x64, 0x89, 0xEB, 0x4E, 0xF9, 0x73, 0x5A,
+    0x8D, 0x94, 0x52, 0xA0, 0xFF, 0x2F, 0x0A, 0x66, 0xA2, 0x1D, 0xCB, 0x44, 0x3B, 0x67, 0xDA, 0x47,
+    0xD7, 0x29, 0x6D, 0x33, 0x48, 0xD2, 0x7D, 0x92, 0xA2, 0x93, 0xF4, 0x8E, 0x40, 0x4F, 0x44, 0x8A,
+    0x58, 0x8F, 0xB8, 0xB1, 0xF7, 0xB9, 0x32, 0x35, 0x6D, 0x30, 0x92, 0x28, 0xA4, 0x71, 0xE3, 0xF5,
+    0x6F, 0x05, 0x38, 0x7D, 0x9E, 0x42, 0x83, 0x91, 0x1A, 0x3D, 0x18, 0x6D, 0x53, 0xFB, 0xC3, 0x3C,
+    0x92, 0xCB, 0xE7, 0x8A, 0xB9, 0x2E, 0xFA, 0xFE, 0xDC, 0x5C, 0xFB, 0xF6, 0xDC, 0x64, 0x43, 0x9B,
+    0x2F, 0xC5, 0x8D, 0xBE, 0x73, 0x1A, 0xD0, 0xB8, 0x81, 0xAC, 0xA7, 0xEE, 0x04, 0xFB, 0xDA, 0x02,
+    0xFD, 0x37, 0x02, 0x59, 0xAC, 0x3B, 0x68, 0xF6, 0xAB, 0xF3, 0xCC, 0xD3, 0x50, 0x68, 0x4D, 0xC1,
+    0x6D, 0xB9, 0x5E, 0x14, 0xAE, 0x29, 0x56, 0xBE, 0x93, 0x82, 0xC9, 0x2A, 0xEC, 0x09, 0x66, 0x35,
+    0x60, 0x16, 0x2B, 0x69, 0xEA, 0x25, 0x5D, 0x93, 0xA4, 0x2A, 0x60, 0xE7, 0xD6, 0xD3, 0x5E, 0x5D,
+    0x31, 0x6B, 0x19, 0xA9, 0x43, 0x95, 0x72, 0xA8, 0x0A, 0xB4, 0x5A, 0xA1, 0x56, 0x77, 0x1C, 0xA2,
+    0x14, 0xE3, 0xF3, 0xA8, 0x1E, 0xEC, 0xEB, 0x91, 0xBF, 0xFA, 0xF8, 0x91, 0x2A, 0x1C, 0x40, 0xBB,
+    0xE0, 0x34, 0xD9, 0xF7, 0x7A, 0x3F, 0xE5, 0xF1, 0xD7, 0xA8, 0x3D, 0x75, 0xA4, 0x96, 0xAF, 0xFF,
+    0x36, 0x96, 0x93, 0x7B, 0x2C, 0x16, 0x93, 0x6B, 0x54, 0x84, 0x7A, 0x68, 0xFF, 0x7C, 0x36, 0x5A,
+    0xB0, 0xEB, 0x11, 0x14, 0x78, 0x6A, 0xA3, 0xEB, 0xD6, 0x2A, 0x01, 0x94, 0xFE, 0x1B, 0xC9, 0xFA,
+    0x55, 0x57, 0xB7, 0xF8, 0xAE, 0xB9, 0xF5, 0xA4, 0xDE, 0x7D, 0x05, 0xE0, 0xCC, 0x21, 0xED, 0x60,
+    0x35, 0xDA, 0x48, 0x1D, 0x0B, 0x4D, 0x56, 0x4D, 0xA1, 0xAE, 0x1E, 0xAC, 0x3C, 0xF7, 0x86, 0x32,
+    0x94, 0xE1, 0x10, 0x2E, 0x9B, 0x58, 0x04, 0xC0, 0x76, 0xAB, 0x09, 0x80, 0x09, 0xED, 0x97, 0x26,
+    0x80, 0xE7, 0xEB, 0x17, 0x66, 0x80, 0xEA, 0xDB, 0xEF, 0xC5, 0x4D, 0x95, 0x13, 0xF9, 0xB9, 0x26,
+    0x0F, 0x51, 0xCE, 0xED, 0xBD, 0x13, 0x50, 0xC6, 0xDA, 0x0B, 0x28, 0xA2, 0x0D, 0xCE, 0x43, 0xB1,
+    0x9A, 0xB9, 0x48, 0x24, 0xE5, 0x8A, 0x1A, 0x0A, 0xD1, 0x36, 0x75, 0xA0, 0x14, 0xF5, 0x60, 0x56,
+    0xAC, 0x9A, 0x5E, 0xF4, 0x63, 0x2E, 0x9C, 0xBA, 0x72, 0xDE, 0x46, 0x78, 0xE2, 0xF6, 0xED, 0x0B,
+    0x13, 0x90, 0x27, 0x7B, 0xE1, 0x5E, 0x9C, 0x80, 0x6C, 0xFC, 0x0C, 0x1F, 0x3A, 0xCE, 0x73, 0x2B,
+    0x0F, 0xD0, 0x0F, 0x75, 0xD3, 0x8E, 0x4E, 0x26, 0xD4, 0x2A, 0x35, 0xB9, 0x42, 0xE3, 0xE4, 0x9E,
+    0x1C, 0xE3, 0xA9, 0xD3, 0xF9, 0x8D, 0xC5, 0x01, 0x75, 0xFF, 0xDD, 0x11, 0x72, 0x2D, 0x31, 0x85,
+    0x24, 0x1E, 0xCC, 0xDF, 0x2A, 0x02, 0x8F, 0xB8, 0x57, 0x3D, 0xD8, 0x6B, 0xEF, 0xC5, 0xDC, 0x98,
+    0xF0, 0x48, 0xF5, 0xDA, 0xD4, 0x2F, 0xE5, 0x20, 0x59, 0x75, 0xD1, 0xCA, 0xB7, 0x83, 0xED, 0xDC,
+    0xB8, 0x47, 0xEF, 0xD9, 0xE1, 0x67, 0xC8, 0xA3, 0xF3, 0xA8, 0x0A, 0xB8, 0x73, 0xD3, 0xB1, 0xDD,
+    0x3F, 0xF3, 0x34, 0xF4, 0x1A, 0x91, 0x56, 0xDC, 0xB7, 0xE4, 0xAD, 0xAF, 0x42, 0x31, 0x98, 0xC8,
+    0x88, 0x36, 0x7E, 0xBB, 0xF5, 0x7C, 0x56, 0x1D, 0x56, 0x63, 0x8A, 0xC7, 0x32, 0x0D, 0x29, 0xEA,
+    0x37, 0x6B, 0xEE, 0xD1, 0x63, 0x01, 0xE7, 0x45, 0x3B, 0x3A, 0x29, 0x14, 0xD2, 0x48, 0xAD, 0xC3,
+    0x2D, 0xC6, 0x05, 0x1E, 0x29, 0xBD, 0x89, 0x7D, 0x63, 0x5F, 0x8F, 0xFC, 0x76, 0xDE, 0x9D, 0xD4,
+    0x27, 0xA7, 0xA6, 0x90, 0x70, 0x7F, 0xBA, 0x30, 0x9A, 0xC4, 0xDC, 0x67, 0x0B, 0x99, 0x06, 0xAC,
+    0x3A, 0x6E, 0xEF, 0x3B, 0x10, 0x87, 0x26, 0x96, 0xBE, 0x1A, 0xDD, 0xFF, 0x2D, 0xA4, 0x40, 0xBF,
+    0x1C, 0xE9, 0x14, 0x85, 0x94, 0xF2, 0x43, 0x56, 0xCF, 0xAE, 0x44, 0xFA, 0xCE, 0x76, 0xF5, 0x48,
+    0x28, 0xE7, 0x2D, 0x2B, 0xD8, 0x76, 0x50, 0x4D, 0x1B, 0x7F, 0xEF, 0xE4, 0xA1, 0x5C, 0xB6, 0x85,
+    0x62, 0x16, 0xFE, 0x0A, 0xE7, 0x5D, 0x57, 0x44, 0xB3, 0x64, 0x6A, 0x9C, 0x34, 0x66, 0xD2, 0xB4,
+    0x2D, 0xE6, 0xE6, 0xF8, 0x12, 0x91, 0x5E, 0xF2, 0x56, 0x9A, 0x99, 0xB3, 0x95, 0x0A, 0xD7, 0xD1,
+    0xD8, 0x71, 0x23, 0x36, 0xB5, 0x71, 0x81, 0xA5, 0x3A, 0xE8, 0x05, 0x5C, 0x9C, 0x37, 0xF7, 0x69,
+    0xE2, 0xF6, 0x9E, 0x89, 0x99, 0xA7, 0x6D, 0x1E, 0xC1, 0x86, 0x72, 0x2E, 0x16, 0x9C, 0xD4, 0x64,
+    0x92, 0x27, 0xBB, 0xD2, 0x6D, 0xF1, 0x43, 0x07, 0x94, 0x49, 0x41, 0xAB, 0x3D, 0x45, 0xF2, 0xE1,
+    0x23, 0x65, 0xA1, 0xB1, 0x8A, 0x56, 0x33, 0xC5, 0x4A, 0x71, 0x1C, 0x4B, 0xB4, 0x9E, 0xDE, 0xA7,
+    0x24, 0x2B, 0x94, 0x33, 0x9A, 0xC1, 0x0D, 0x95, 0x06, 0x50, 0xBE, 0x0A, 0x8A, 0x58, 0xBF, 0x18,
+    0xA1, 0xFE, 0x71, 0xAC, 0x43, 0x0A, 0x58, 0x3A, 0x8C, 0x66, 0xB3, 0x80, 0x55, 0x63, 0x03, 0xB4,
+    0xD3, 0x46, 0xE8, 0xE4, 0x2B, 0xD8, 0x19, 0x3B, 0x43, 0xFB, 0x23, 0xFA, 0x1F, 0x51, 0x69, 0xAE,
+    0x35, 0x21, 0x0D, 0x92, 0xFF, 0x47, 0xE7, 0xAF, 0xBF, 0xBE, 0xE7, 0xAF, 0x83, 0x9D, 0xCD, 0x7E,
+    0x39, 0xF1, 0x95, 0x5B, 0x1A, 0xA0, 0x9C, 0x04, 0xE0, 0xAE, 0x45, 0x80, 0x35, 0x45, 0x37, 0xCD,
+    0xA9, 0x0F, 0x4B, 0xC6, 0x2A, 0x5A, 0x45, 0x9C, 0x82, 0xD3, 0x48, 0x35, 0x53, 0x25, 0x4A, 0xCA,
+    0x0D, 0x64, 0x22, 0x4F, 0xC4, 0x94, 0x8B, 0x50, 0x8F, 0x46, 0x23, 0xA8, 0x69, 0xD5, 0x60, 0x62,
+    0xF9, 0x7E, 0x84, 0x2A, 0xF4, 0x55, 0x80, 0xFE, 0xA5, 0xD0, 0x7B, 0x8C, 0x64, 0x56, 0xB0, 0x1A,
+    0xED, 0x04, 0x6E, 0xC1, 0x79, 0x32, 0x0D, 0x99, 0xA0, 0x8C, 0x29, 0x6F, 0x30, 0xE2, 0x46, 0x32,
+    0x1D, 0xE6, 0x3A, 0xA4, 0xD5, 0xD8, 0x6B, 0x30, 0xD2, 0xB9, 0x23, 0x1C, 0xC3, 0xC3, 0xA5, 0xC7,
+    0xBE, 0xBB, 0x90, 0x2D, 0xB5, 0xA7, 0xBC, 0x67, 0xFC, 0x55, 0x89, 0xE8, 0xCE, 0xFC, 0x10, 0xAA,
+    0x57, 0x22, 0xD8, 0x20, 0x30, 0xB3, 0x6B, 0xE0, 0xD6, 0x63, 0xA8, 0xF3, 0xD5, 0x66, 0x23, 0xE3,
+    0xAD, 0x34, 0x51, 0xE9, 0x92, 0xB0, 0x0B, 0xFD, 0x68, 0x23, 0x36, 0x96, 0x0B, 0xB9, 0xCE, 0x09,
+    0xDA, 0x97, 0xD5, 0x50, 0xCD, 0xBD, 0xA7, 0x58, 0x5C, 0x20, 0xD3, 0xFD, 0x11, 0xFA, 0x57, 0x04,
+    0x2E, 0xC8, 0x63, 0x67, 0x17, 0x28, 0x17, 0x1B, 0x31, 0xCA, 0xD5, 0x19, 0xE1, 0xE6, 0x42, 0x4D,
+    0x29, 0xA9, 0x49, 0x3C, 0xEB, 0x19, 0xDD, 0x38, 0x49, 0x6F, 0x99, 0xF0, 0x30, 0xF6, 0x9D, 0x15,
+    0xFB, 0xCE, 0xF2, 0x41, 0x18, 0xF7, 0x40, 0x62, 0xB7, 0x7A, 0x85, 0x5C, 0x17, 0xA7, 0x62, 0x2E,
+    0xA3, 0x0D, 0x45, 0xAC, 0x46, 0x13, 0xEB, 0xC1, 0x44, 0xE7, 0x8B, 0xD9, 0xF9, 0x72, 0x72, 0xDE,
+    0x06, 0xE7, 0xAB, 0xD1, 0x0D, 0xAD, 0xAF, 0x6F, 0x0A, 0x9B, 0x22, 0xA9, 0xCD, 0x9A, 0x9C, 0x79,
+    0x1A, 0x68, 0x37, 0x6E, 0xBE, 0xC9, 0x74, 0x53, 0x01, 0xF9, 0x72, 0x45, 0x1E, 0xF9, 0xDE, 0x53,
+    0x4D, 0x6E, 0xC4, 0x2C, 0xD5, 0x04, 0x7A, 0x72, 0xDD, 0xED, 0xFA, 0x57, 0x24, 0x69, 0x92, 0xA4,
+    0xC5, 0x8D, 0xE4, 0xB2, 0x33, 0xE8, 0xF1, 0x15, 0xDA, 0x41, 0x1E, 0x17, 0xEA, 0x09, 0x17, 0x8C,
+    0x9A, 0x76, 0xA2, 0x97, 0xA6, 0x84, 0x0F, 0x52, 0xA6, 0x79, 0x33, 0x90, 0x0F, 0x40, 0x2B, 0x4A,
+    0x89, 0xFE, 0x07, 0x4B, 0x31, 0x9B, 0xE8, 0xBC, 0x7D, 0x67, 0xC1, 0x7D, 0x77, 0xDD, 0xC9, 0x49,
+    0xB3, 0x76, 0xFD, 0x2B, 0x33, 0xB2, 0x63, 0x31, 0x3B, 0xEF, 0x7C, 0xFF, 0x76, 0x44, 0xF2, 0xF4,
+    0xF3, 0x76, 0xCF, 0xBF, 0xCC, 0x34, 0xC5, 0xA3, 0x69, 0x8A, 0x64, 0x3A, 0xB7, 0x82, 0x7B, 0x59,
+    0x0D, 0x76, 0xEE, 0xDF, 0xDA, 0x3D, 0xBB, 0x38, 0x49, 0xBA, 0x5F, 0x92, 0x5E, 0x59, 0xA1, 0x0E,
+    0xEA, 0xB0, 0xB3, 0x1B, 0x29, 0xF6, 0xD3, 0xD4, 0x18, 0xE1, 0xA6, 0x7F, 0xF8, 0x34, 0x5D, 0xD8,
+    0x6A, 0x1E, 0x4C, 0xAC, 0x06, 0x13, 0xEB, 0x9B, 0xCF, 0x46, 0x27, 0xCD, 0xEE, 0xAD, 0x4B, 0x93,
+    0xEB, 0x6C, 0x70, 0x5D, 0x35, 0x3A, 0xEF, 0x7E, 0xCA, 0x34, 0x3D, 0x7D, 0x0B, 0xD8, 0xB0, 0x82,
+    0x7B, 0x71, 0x86, 0xA5, 0xF2, 0x27, 0xD6, 0xEC, 0x1D, 0x4F, 0x43, 0x25, 0xA5, 0x19, 0x34, 0x37,
+    0x1E, 0x14, 0xD6, 0x97, 0x2B, 0x0F, 0x63, 0x23, 0x89, 0x2A, 0xA1, 0xDD, 0x70, 0xCC, 0xC1, 0xEF,
+    0x2F, 0x14, 0x49, 0x28, 0x1A, 0xB8, 0xFD, 0xF7, 0x8E, 0xEA, 0x05, 0xDA, 0xE1, 0x37, 0x30, 0xCA,
+    0x67, 0xEA, 0xC9, 0x4E, 0xB9, 0x3A, 0x27, 0xCD, 0xB4, 0x52, 0x43, 0xAD, 0xE1, 0x44, 0x60, 0xF7,
+    0xBC, 0xED, 0x8A, 0x49, 0xD4, 0xD7, 0x66, 0x3E, 0x53, 0x74, 0x27, 0x87, 0xE8, 0x44, 0x21, 0xE1,
+    0xFE, 0x6C, 0x25, 0x98, 0x98, 0x61, 0x43, 0x2A, 0x54, 0x49, 0x23, 0xF9, 0xEC, 0xA5, 0x00, 0x6D,
+    0x73, 0x98, 0x9F, 0xF0, 0x3C, 0xE3, 0xB1, 0xE7, 0x91, 0x3A, 0x68, 0x15, 0x7E, 0xAA, 0xA9, 0xCE,
+    0x25, 0xA3, 0x49, 0x6A, 0x14, 0x8B, 0x95, 0x72, 0x42, 0x9D, 0x99, 0xA8, 0xC7, 0x3C, 0x52, 0xC4,
+    0x2C, 0x82, 0x58, 0xA0, 0x1E, 0x7A, 0x28, 0x66, 0x07, 0xC8, 0x35, 0x50, 0xBF, 0xEA, 0xA1, 0x90,
+    0x07, 0x52, 0xBD, 0x58, 0xD8, 0x02, 0xF7, 0x53, 0x66, 0x82, 0xE2, 0x89, 0x79, 0x5F, 0x3C, 0xA2,
+    0x99, 0xE4, 0xD2, 0x8E, 0x5C, 0x54, 0x95, 0x7C, 0xDB, 0x1E, 0xC5, 0x9F, 0x04, 0x18, 0xE7, 0x29,
+    0x17, 0xB3, 0x50, 0x29, 0x5F, 0xB9, 0x43, 0x99, 0xA0, 0x6F, 0x56, 0x68, 0xEF, 0x59, 0xC0, 0x3D,
+    0x1A, 0xC1, 0x3D, 0x36, 0x83, 0x7B, 0x7C, 0x82, 0xFA, 0xC5, 0x00, 0xF5, 0x4B, 0x03, 0x54, 0xAF,
+    0x76, 0x50, 0x89, 0xAD, 0x80, 0xB4, 0x9A, 0x8F, 0xE0, 0xA5, 0x4F, 0xA5, 0x59, 0x1F, 0xCB, 0x16,
+    0xA8, 0x2F, 0x4D, 0x9B, 0x47, 0x75, 0x2B, 0x50, 0x26, 0x2B, 0xF7, 0x95, 0x33, 0x0D, 0xB4, 0xF7,
+    0x05, 0xA8, 0x5F, 0x89, 0x50, 0x8E, 0xCB, 0x47, 0xCC, 0x75, 0x2F, 0xAF, 0xC5, 0x69, 0x70, 0xCA,
+    0xD4, 0xA5, 0x72, 0xDD, 0x85, 0x72, 0xA6, 0x27, 0x13, 0x2D, 0x38, 0xEF, 0x1A, 0xCA, 0xA9, 0xF6,
+    0x64, 0xAB, 0xF5, 0xE0, 0x5E, 0x1A, 0xA0, 0xFC, 0x49, 0xD8, 0x32, 0x54, 0xB8, 0x69, 0xAF, 0x05,
+    0x79, 0x84, 0x8C, 0x05, 0xB2, 0xD7, 0x56, 0xA0, 0x5F, 0xF7, 0xD9, 0xEC, 0x62, 0xF9, 0x10, 0x20,
+    0xC3, 0x3E, 0x36, 0x6D, 0xCA, 0xE8, 0x9E, 0x98, 0xE0, 0x53, 0xF9, 0xE1, 0x3F, 0xB1, 0xA0, 0xB6,
+    0x64, 0x70, 0x3E, 0x40, 0x6F, 0x22, 0xE8, 0xC5, 0x15, 0xF4, 0xC4, 0x02, 0x6B, 0x31, 0xC1, 0x6F,
+    0x31, 0x9C, 0xF8, 0x58, 0xA9, 0x68, 0xF5, 0x8A, 0x16, 0xA3, 0x50, 0xCD, 0x1B, 0x08, 0x1D, 0xE8,
+    0xBB, 0x32, 0x50, 0x85, 0x22, 0x60, 0xA2, 0x99, 0xA0, 0xFF, 0x52, 0x84, 0x6A, 0x8C, 0x60, 0xE2,
+    0x02, 0xF4, 0x2D, 0xDB, 0xED, 0x19, 0x35, 0x5B, 0x7D, 0x0D, 0xB5, 0x87, 0x5B, 0xED, 0x00, 0x9F,
+    0xAA, 0x46, 0x28, 0x35, 0x82, 0xD1, 0xB8, 0x5F, 0x73, 0x1F, 0x0C, 0x93, 0x9F, 0xFA, 0x75, 0xC8,
+    0xE6, 0xB3, 0x60, 0xE6, 0x15, 0xCA, 0xD7, 0x23, 0x54, 0x4F, 0x04, 0x38, 0x5B, 0x76, 0x70, 0x5B,
+    0xF6, 0x4F, 0x28, 0xBD, 0x3F, 0xBA, 0xA5, 0x81, 0xDE, 0x06, 0x70, 0x2F, 0x46, 0xB0, 0x43, 0xFC,
+    0x88, 0x9A, 0x49, 0x2F, 0x6A, 0x75, 0xFA, 0x9E, 0x94, 0xA9, 0xAB, 0x16, 0x9C, 0xCF, 0x57, 0xAA,
+    0x80, 0x9A, 0x72, 0x3E, 0x7E, 0xD2, 0x95, 0x91, 0x3A, 0x98, 0x95, 0x52, 0x7F, 0xAA, 0x06, 0x25,
+    0x50, 0xA3, 0x00, 0x77, 0x3E, 0x38, 0x03, 0x66, 0x65, 0x0B, 0xA9, 0x12, 0xD7, 0x9C, 0xEA, 0xDD,
+    0x16, 0xB6, 0xE5, 0xBF, 0x27, 0x5D, 0xC9, 0x26, 0x47, 0xB6, 0xD6, 0x9E, 0xF6, 0xFE, 0xC0, 0x2D,
+    0x27, 0x5D, 0xFE, 0x79, 0xF8, 0xC4, 0x82, 0xAC, 0x9A, 0xF6, 0xD1, 0x8B, 0xBE, 0xF6, 0x65, 0xB0,
+    0xC1, 0xCC, 0x66, 0x66, 0xCD, 0x57, 0xDC, 0xA3, 0x6A, 0xEC, 0xFB, 0xF2, 0xB9, 0x14, 0xF8, 0xC4,
+    0xFF, 0x3C, 0x6F, 0xF5, 0x40, 0xFD, 0x1F, 0xA6, 0x2A, 0x4E, 0xAB, 0x8E, 0xE3, 0xDC, 0x69, 0x82,
+    0xFF, 0x6B, 0x7A, 0x28, 0xF4, 0xEC, 0x82, 0x59, 0x88, 0x14, 0x31, 0x3D, 0xCC, 0x94, 0x33, 0xE1,
+    0x23, 0xD5, 0x47, 0xE1, 0x03, 0xD5, 0x47, 0x49, 0xB6, 0x7E, 0x4F, 0xEF, 0xA8, 0xDB, 0x72, 0xF6,
+    0x95, 0x22, 0x24, 0x1E, 0xC3, 0xCC, 0x7B, 0xE6, 0xD0, 0x84, 0x3D, 0x5D, 0x57, 0x78, 0xA0, 0xE8,
+    0x52, 0x78, 0x7B, 0x51, 0x4D, 0xAB, 0xE0, 0xFE, 0x74, 0xB1, 0xB4, 0x0D, 0x6E, 0xA0, 0x0D, 0xF4,
+    0x63, 0xAE, 0xC1, 0xA8, 0x31, 0x2B, 0xD9, 0xCA, 0xA7, 0xDB, 0xEE, 0x6C, 0x75, 0xB3, 0x3F, 0x27,
+    0xF9, 0xFA, 0x46, 0xE0, 0xD6, 0x87, 0xA1, 0x6E, 0x28, 0x07, 0x4C, 0xA0, 0x9C, 0xE0, 0x29, 0x80,
+    0xBC, 0x4B, 0x39, 0x7A, 0xF7, 0xC4, 0x94, 0x8A, 0xF8, 0xDC, 0x90, 0x28, 0xEB, 0x2B, 0x1B, 0x7B,
+    0xD7, 0x7C, 0x14, 0x00, 0x5B, 0x2D, 0x58, 0x2D, 0x38, 0x05, 0x9C, 0x02, 0xD5, 0x9C, 0xAA, 0x58,
+    0x9C, 0x67, 0x83, 0x7A, 0x29, 0x09, 0x39, 0x6F, 0x89, 0xC8, 0x61, 0x4B, 0x46, 0xA6, 0xA1, 0x9A,
+    0xF5, 0xE9, 0x44, 0x9D, 0x4B, 0x29, 0x31, 0x79, 0x5D, 0xB4, 0x1E, 0xB3, 0x98, 0x35, 0x5F, 0xC1,
+    0x86, 0x22, 0xDA, 0x29, 0xD5, 0xE2, 0xA6, 0x93, 0xB5, 0x2F, 0x08, 0xCA, 0x39, 0x5F, 0xCB, 0x08,
+    0x6E, 0xA8, 0x82, 0x1B, 0xC9, 0xF4, 0xAC, 0x1E, 0xD5, 0x40, 0x2B, 0x4D, 0x4E, 0xA3, 0x91, 0x6E,
+    0xE4, 0x27, 0xF8, 0x8B, 0xBD, 0x13, 0x08, 0x67, 0x81, 0xF6, 0xFE, 0x00, 0x65, 0x58, 0xE1, 0x03,
+    0xEE, 0x67, 0x4F, 0xB2, 0x54, 0x2B, 0xD4, 0xD7, 0x34, 0x62, 0xE2, 0x1D, 0x0B, 0x38, 0x5F, 0x7B,
+    0x8A, 0xD9, 0x44, 0xE8, 0x1B, 0xF7, 0xEF, 0x3B, 0x1B, 0x0A, 0xA9, 0x11, 0xFD, 0xF5, 0x58, 0x8D,
+    0x76, 0xAC, 0x5E, 0x5E, 0x58, 0x59, 0x6A, 0x6F, 0x07, 0xFB, 0x4A, 0x64, 0xC9, 0xA3, 0x7B, 0xC9,
+    0xBE, 0xD7, 0xDF, 0xAB, 0xD0, 0x6B, 0x68, 0x63, 0xA6, 0xD1, 0xAC, 0x27, 0x73, 0x35, 0x3F, 0x57,
+    0x57, 0xC6, 0x63, 0x5D, 0x31, 0x52, 0x48, 0x4C, 0xC6, 0xCF, 0xD3, 0x95, 0xBF, 0x86, 0x2A, 0x35,
+    0x18, 0xE8, 0xA8, 0xA8, 0xA5, 0x02, 0x4E, 0x39, 0xB6, 0x1C, 0xB2, 0x9B, 0xD9, 0x1A, 0x08, 0x4E,
+    0x9F, 0xA7, 0x55, 0x23, 0x85, 0xF6, 0x4F, 0x97, 0x7F, 0x46, 0xDB, 0xDC, 0x5A, 0xFB, 0x4F, 0xB9,
+    0xD1, 0x68, 0xCC, 0xE5, 0x8D, 0x06, 0xB3, 0x7C, 0x3D, 0x5B, 0x4F, 0xDF, 0xD6, 0x76, 0x75, 0x75,
+    0xB3, 0xBF, 0x26, 0x4D, 0xF5, 0xFA, 0x3C, 0xB7, 0x56, 0x50, 0xFA, 0xFC, 0xDE, 0x11, 0x05, 0x5C,
+    0x38, 0xC1, 0xD1, 0xFE, 0xEA, 0x4B, 0x9D, 0x6C, 0x20, 0x5F, 0x29, 0x27, 0x6A, 0x0D, 0xC5, 0x8C,
+    0x93, 0x4F, 0xFD, 0x17, 0x29, 0x01, 0x6F, 0x66, 0xE0, 0xE3, 0xC5, 0x04, 0x38, 0x8D, 0x6C, 0x94,
+    0x09, 0xE5, 0x0D, 0x7E, 0xB9, 0x52, 0x27, 0xFE, 0xC5, 0x15, 0xE7, 0x8D, 0xAE, 0x2E, 0xB4, 0xC1,
+    0x06, 0x13, 0x11, 0xA7, 0x52, 0x8B, 0x8A, 0x6B, 0xC0, 0x4C, 0x64, 0x63, 0x0B, 0x4E, 0x03, 0xB9,
+    0xA6, 0x0F, 0x64, 0x9B, 0xFE, 0xBE, 0x92, 0x38, 0x7D, 0x51, 0x07, 0x50, 0x49, 0x82, 0xD3, 0x17,
+    0xD7, 0x83, 0xBF, 0x6F, 0xD1, 0x57, 0xE7, 0xF4, 0x42, 0x2A, 0x12, 0xF9, 0xF0, 0x28, 0xED, 0x9B,
+    0x63, 0x4A, 0xD0, 0x1B, 0xC1, 0x2D, 0xFD, 0x5B, 0x87, 0x99, 0xB4, 0x70, 0xBA, 0xFD, 0xCF, 0xCD,
+    0x36, 0xCA, 0x69, 0x3F, 0x4A, 0xCD, 0x6D, 0xA8, 0x74, 0x2E, 0xD2, 0x0F, 0xA7, 0x00, 0xFE, 0x60,
+    0x77, 0x74, 0x3C, 0x75, 0xFE, 0xF7, 0xFF, 0xB0, 0x6A, 0x82, 0xFB, 0x8F, 0x7F, 0x71, 0x0B, 0x4F,
+    0xFD, 0xEC, 0x1F, 0x80, 0xA2, 0xE1, 0x93, 0xF0, 0x85, 0xAF, 0x3E, 0xFB, 0xC3, 0xDD, 0xE5, 0xA7,
+    0x8A, 0xFF, 0x36, 0x1B, 0x9E, 0x7A, 0xE8, 0x16, 0x78, 0x8A, 0x5F, 0xF4, 0x21, 0x1D, 0x9F, 0xA4,
+    0x68, 0x32, 0xCF, 0x23, 0xBB, 0x3F, 0x7B, 0xEB, 0x3F, 0x7C, 0x92, 0x2F, 0x3F, 0x74, 0x86, 0xE1,
+    0xCB, 0x9C, 0x81, 0x5F, 0xFC, 0x21, 0xF9, 0x64, 0xE9, 0xA5, 0x2D, 0xD1, 0x72, 0xE2, 0x89, 0x8E,
+    0x8E, 0xA0, 0x9F, 0x76, 0xC4, 0xDB, 0xB3, 0xFF, 0x2E, 0xD6, 0xDF, 0x0D, 0x7D, 0x7D, 0x35, 0xF6,
+    0xE5, 0xBB, 0xFF, 0xE0, 0x7F, 0xDF, 0xF9, 0xCB, 0x3B, 0xBB, 0xDD, 0x6E, 0xF7, 0xBF, 0x49, 0xBA,
+    0xAE, 0x44, 0x23, 0x24, 0xA6, 0x40, 0xD7, 0x25, 0xF5, 0xD2, 0x92, 0x0F, 0xCE, 0xF7, 0x79, 0x2C,
+    0x47, 0x97, 0xCF, 0x95, 0x7F, 0x0E, 0x38, 0x8D, 0xEE, 0x8D, 0xD5, 0xE0, 0x9A, 0x35, 0x8B, 0xF9,
+    0x64, 0x42, 0xEE, 0xF3, 0xE1, 0x2B, 0x26, 0x3A, 0xDF, 0xDB, 0x50, 0x5F, 0x8D, 0xE5, 0xB8, 0x98,
+    0xD0, 0xE6, 0xB3, 0xBB, 0x27, 0xD6, 0xDD, 0x73, 0x29, 0x53, 0x73, 0x9A, 0xF3, 0x76, 0x52, 0x11,
+    0xDB, 0x47, 0x97, 0xDA, 0xBB, 0x7B, 0x83, 0x1D, 0x97, 0x2C, 0xD6, 0x5D, 0x7D, 0x2E, 0x98, 0xE0,
+    0xF8, 0x9C, 0xE9, 0xC8, 0x1A, 0xCC, 0x94, 0x5A, 0x84, 0xA0, 0x6A, 0x4E, 0x17, 0xFE, 0xF7, 0xA5,
+    0x9B, 0xD2, 0xF2, 0x17, 0x77, 0xDF, 0x89, 0x85, 0xC2, 0x93, 0x07, 0x88, 0xF0, 0x08, 0xD4, 0x0D,
+    0x76, 0xC0, 0x04, 0xB2, 0xB8, 0xB5, 0x61, 0xDD, 0x96, 0x9C, 0x4E, 0xE5, 0xA1, 0x85, 0x6C, 0xE2,
+    0x74, 0xE1, 0xCF, 0xB7, 0xD2, 0x63, 0xD2, 0x72, 0xCB, 0xBF, 0x79, 0xF9, 0x29, 0xAA, 0x06, 0x2E,
+    0xA7, 0x0F, 0x59, 0x0F, 0x67, 0xC9, 0x0F, 0xC3, 0xBF, 0xB5, 0x52, 0x68, 0x25, 0x7F, 0x7E, 0xBE,
+    0x0D, 0x33, 0x42, 0x95, 0x32, 0x81, 0x66, 0x4E, 0x26, 0xF6, 0x96, 0x43, 0xFD, 0x50, 0xFD, 0xA2,
+    0x77, 0xD4, 0x9C, 0xE7, 0x21, 0xEC, 0x84, 0x26, 0xAB, 0x49, 0xBA, 0xAE, 0x55, 0xAB, 0x5D, 0x59,
+    0x39, 0x03, 0xE4, 0x4B, 0xFB, 0xA6, 0xDC, 0x70, 0x1E, 0x28, 0xC7, 0xEA, 0xC5, 0x68, 0xDF, 0x55,
+    0x11, 0xFB, 0x7B, 0x96, 0xD3, 0xDC, 0x46, 0x66, 0x96, 0xF6, 0x27, 0xDA, 0x7C, 0x53, 0x52, 0xBF,
+    0x2F, 0xFF, 0xCB, 0x1F, 0xE6, 0xFF, 0x08, 0xEA, 0xD7, 0xFD, 0xD9, 0xFF, 0xFB, 0xF1, 0x5F, 0x56,
+    0xFD, 0x0E, 0xA9, 0x9B, 0xE2, 0x7F, 0xCF, 0xFE, 0xD3, 0x17, 0x3E, 0xFF, 0x94, 0xFF, 0x7B, 0xDD,
+    0xC2, 0xFE, 0x21, 0xF9, 0xD8, 0x57, 0x1A, 0x1E, 0x1A, 0xF9, 0xE4, 0xEF, 0x7C, 0xF5, 0xD2, 0xBF,
+    0x7E, 0xEB, 0xD2, 0xBF, 0x1A, 0x3E, 0xF9, 0x85, 0xE1, 0x4F, 0x86, 0x97, 0xAF, 0x35, 0x03, 0xFC,
+    0x12, 0x3F, 0xDB, 0x39, 0x5F, 0x6C, 0xCA, 0x4F, 0xF2, 0xB9, 0x87, 0xF8, 0x3F, 0x6E, 0x3E, 0xF3,
+    0x27, 0x37, 0x9F, 0xFD, 0x8D, 0x2F, 0x14, 0xC5, 0x3F, 0x2B, 0xB2, 0x6B, 0xF7, 0x42, 0xF1, 0x4B,
+    0xFD, 0x7C, 0xE8, 0x48, 0x74, 0x74, 0xB1, 0xEE, 0x7B, 0x44, 0xFA, 0x75, 0x5F, 0x70, 0xFF, 0x5E,
+    0xDC, 0x7A, 0xBC, 0x5A, 0x33, 0xED, 0x2D, 0xB6, 0x1D, 0x52, 0xD2, 0xD3, 0x7A, 0xD7, 0x2C, 0x5B,
+    0x67, 0x49, 0x4C, 0x18, 0x32, 0x8B, 0x45, 0xD8, 0xB7, 0xDA, 0xB9, 0x73, 0xE1, 0x96, 0x43, 0xCE,
+    0x3C, 0x55, 0x7D, 0x2F, 0xD6, 0x5F, 0x52, 0xC8, 0x34, 0x39, 0xBD, 0x30, 0xBB, 0xEB, 0x63, 0x7D,
+    0x3D, 0xD4, 0xB3, 0xBD, 0x1A, 0xEB, 0x17, 0xA2, 0xF5, 0x10, 0xAD, 0x6F, 0xED, 0xE8, 0x1A, 0xCA,
+    0xA1, 0xCF, 0xA2, 0x63, 0x81, 0x47, 0xCC, 0x5C, 0xBE, 0x13, 0x4D, 0xC0, 0x04, 0x3B, 0xB8, 0x27,
+    0x43, 0xE5, 0x71, 0x8D, 0x6B, 0x62, 0xDD, 0x2D, 0xE4, 0x33, 0xAB, 0x1D, 0xFB, 0x32, 0x50, 0xF9,
+    0x7C, 0x15, 0x12, 0x2C, 0x18, 0x8D, 0xB9, 0x02, 0x66, 0x24, 0x7B, 0x1A, 0x9E, 0x81, 0xFC, 0x78,
+    0x74, 0x45, 0x53, 0x77, 0x6B, 0x39, 0xB9, 0x17, 0x16, 0x3B, 0x3A, 0xBE, 0xB3, 0xBD, 0xFA, 0x50,
+    0xD9, 0xD4, 0x8F, 0x4F, 0xF6, 0xB5, 0xA5, 0x9C, 0x64, 0xD2, 0x0A, 0x5C, 0xED, 0xE0, 0x8A, 0xB1,
+    0xE4, 0x38, 0xDE, 0xCB, 0x86, 0x8F, 0xF3, 0x57, 0xF9, 0x5C, 0xF9, 0xC5, 0xCC, 0xEE, 0x85, 0xA5,
+    0x9C, 0xDC, 0xE3, 0xD1, 0x86, 0xBE, 0x98, 0xAA, 0x61, 0x2D, 0x83, 0x7B, 0x34, 0xDA, 0xC1, 0xE5,
+    0x53, 0xD5, 0x7D, 0x2E, 0x1B, 0xED, 0x51, 0xF8, 0x51, 0x84, 0x6A, 0x70, 0xBE, 0xDD, 0xEC, 0x40,
+    0x4A, 0x9B, 0x16, 0xDD, 0xE7, 0x8A, 0xE0, 0xEE, 0x59, 0x6C, 0x70, 0x57, 0x63, 0x31, 0xB9, 0x6E,
+    0x2D, 0x43, 0xE5, 0x97, 0x7C, 0xAA, 0xFC, 0x17, 0xF3, 0xA3, 0x69, 0xFE, 0x14, 0xDF, 0x29, 0x9A,
+    0xD6, 0x4C, 0x75, 0xD7, 0x9E, 0x8B, 0xB5, 0x77, 0x57, 0x63, 0x35, 0x56, 0xC3, 0x6A, 0x83, 0x1D,
+    0xFB, 0x62, 0x2A, 0x82, 0xFB, 0x52, 0xCC, 0xA7, 0xCA, 0x47, 0x42, 0xD9, 0xFC, 0x4E, 0xFA, 0xCA,
+    0xAF, 0x43, 0xD5, 0x51, 0xCD, 0x54, 0xD7, 0xBB, 0xEA, 0xEA, 0x6C, 0x7D, 0xDD, 0xF1, 0x29, 0x6A,
+    0xEF, 0x7C, 0xEB, 0x5B, 0x5F, 0x0F, 0x76, 0x46, 0xD8, 0x31, 0x5B, 0xB0, 0x0D, 0xE4, 0x03, 0xAE,
+    0xC9, 0x97, 0xD4, 0x45, 0x62, 0x22, 0x7D, 0x57, 0x8F, 0xE5, 0x94, 0x2F, 0x29, 0x67, 0xFC, 0x69,
+    0xE0, 0x49, 0x7F, 0x0B, 0x67, 0x5D, 0x3E, 0x5B, 0x3F, 0xD7, 0x8F, 0x05, 0x33, 0x86, 0xCB, 0x54,
+    0x5D, 0xDD, 0xF0, 0x48, 0x31, 0x90, 0xBD, 0x37, 0x51, 0x95, 0xAB, 0x3D, 0x37, 0xD7, 0x8F, 0xC5,
+    0xFA, 0x5C, 0xAC, 0xFC, 0xF9, 0x9B, 0xE1, 0x3C, 0xCE, 0x7A, 0xAC, 0x77, 0x98, 0x70, 0x3E, 0x12,
+    0xEB, 0xC7, 0x43, 0x9D, 0x47, 0xFB, 0xE4, 0x50, 0x35, 0x67, 0xBF, 0x00, 0x59, 0x1A, 0xFF, 0x9D,
+    0xCD, 0x9D, 0x4D, 0x3D, 0xA4, 0x4A, 0x90, 0x72, 0x2E, 0x67, 0xB3, 0x98, 0x05, 0x21, 0x5C, 0xE7,
+    0xBA, 0x6A, 0xA8, 0x86, 0x22, 0x94, 0x21, 0x8F, 0x79, 0xE4, 0x0A, 0x2B, 0xAE, 0x71, 0x58, 0x6F,
+    0xBD, 0x09, 0x66, 0x64, 0x66, 0xE6, 0x6E, 0x1E, 0xE6, 0xD4, 0x06, 0xD8, 0xB3, 0x29, 0x9F, 0x32,
+    0x65, 0x2B, 0x7D, 0xD7, 0x77, 0x95, 0xAF, 0x7D, 0xD6, 0x64, 0x0D, 0x07, 0x07, 0x07, 0xFF, 0x66,
+    0x33, 0xCF, 0xBB, 0xDD, 0xEE, 0x19, 0x72, 0xBD, 0xAA, 0x76, 0xF9, 0x90, 0x8A, 0xF7, 0x7B, 0x10,
+    0xEE, 0xBA, 0xAD, 0x35, 0xA0, 0xF2, 0xC0, 0xB2, 0xEF, 0x87, 0x7A, 0x64, 0x8F, 0xCF, 0xEB, 0x0F,
+    0xD4, 0xEB, 0xC4, 0xFD, 0xFB, 0x57, 0xF6, 0xD5, 0x1F, 0xAE, 0xD9, 0xA0, 0x4B, 0xED, 0xB7, 0xE8,
+    0xA2, 0x18, 0x39, 0xA9, 0x74, 0xB9, 0x9A, 0x72, 0xC9, 0x35, 0x95, 0x1A, 0x24, 0xA3, 0xE8, 0xFA,
+    0x61, 0xD5, 0x7F, 0x63, 0xA6, 0xDF, 0xB4, 0x03, 0x0B, 0x66, 0xC2, 0x41, 0xC4, 0x35, 0x2C, 0x1F,
+    0x79, 0x80, 0x48, 0xF5, 0xD7, 0xB4, 0xE7, 0x0B, 0x35, 0xD5, 0x82, 0x3A, 0xB3, 0x72, 0xFA, 0x88,
+    0xF7, 0xCF, 0x27, 0xCA, 0x21, 0x5B, 0x29, 0xE6, 0x54, 0xF4, 0x55, 0x7B, 0x7A, 0xB2, 0x66, 0x6B,
+    0x07, 0xCD, 0x9F, 0xAA, 0x27, 0xDC, 0x55, 0x4D, 0xF9, 0x6A, 0x15, 0x6C, 0x70, 0xFD, 0xD0, 0xFA,
+    0x43, 0x77, 0xCF, 0x0A, 0x4B, 0x19, 0x30, 0xC1, 0x79, 0x5C, 0xB3, 0x62, 0x26, 0x33, 0xE1, 0x1A,
+    0xEB, 0xCD, 0x44, 0x8B, 0x23, 0x9B, 0xB3, 0xA5, 0x29, 0x87, 0x42, 0x4D, 0x8D, 0x9D, 0x79, 0x9E,
+    0xD3, 0xFB, 0xA8, 0x35, 0x9F, 0xB8, 0x8B, 0x6A, 0x34, 0x0B, 0x7D, 0x67, 0x43, 0x1E, 0x71, 0x5D,
+    0xD6, 0x70, 0x1B, 0x70, 0x67, 0x03, 0xF9, 0x52, 0xAC, 0xD8, 0xD0, 0x8A, 0xFE, 0x31, 0x2D, 0x66,
+    0x29, 0xDF, 0x8E, 0x36, 0x7C, 0xAC, 0x08, 0xAE, 0xA3, 0x7A, 0x61, 0x81, 0xCB, 0x45, 0xA0, 0x0C,
+    0xB5, 0xA7, 0xE7, 0x0A, 0x65, 0x30, 0x13, 0x57, 0xB0, 0xBE, 0x18, 0x71, 0xB8, 0x07, 0x98, 0x51,
+    0x30, 0x43, 0x2E, 0x4E, 0xED, 0xEB, 0x40, 0xB3, 0x89, 0xB3, 0x54, 0xC1, 0x44, 0xFA, 0xCE, 0x86,
+    0x2C, 0xE2, 0x9A, 0xAC, 0x39, 0xE2, 0x1C, 0x76, 0x4D, 0xF6, 0xA8, 0x96, 0xEC, 0x86, 0xA4, 0xE5,
+    0x72, 0xAE, 0xF5, 0xE3, 0x09, 0x27, 0x1E, 0x1D, 0x9F, 0x64, 0x2C, 0x9B, 0x87, 0xF2, 0xB9, 0xF2,
+    0x4B, 0x39, 0xBA, 0xC7, 0x63, 0x35, 0xAC, 0xE5, 0xE4, 0x1E, 0x8F, 0xF5, 0xA0, 0x32, 0xB4, 0xE7,
+    0x62, 0x35, 0xAC, 0x65, 0x68, 0xCD, 0x5C, 0xF9, 0xC5, 0x8E, 0x2E, 0x9F, 0xAA, 0x2E, 0xE6, 0xFE,
+    0x53, 0x84, 0xF2, 0xE8, 0x0C, 0x9F, 0x18, 0x71, 0x6A, 0xDC, 0xAB, 0xA1, 0x7E, 0x34, 0x5A, 0xEF,
+    0xCA, 0x60, 0xAF, 0x4D, 0x45, 0x88, 0x79, 0x74, 0x2C, 0xD6, 0xB7, 0x66, 0x72, 0x4D, 0xAF, 0xCE,
+    0xAA, 0xE1, 0xBF, 0xDF, 0x0A, 0x45, 0x5D, 0x87, 0x1B, 0x70, 0x81, 0xB3, 0xCF, 0x73, 0xF6, 0x2C,
+    0x67, 0xAB, 0xC6, 0x95, 0xDE, 0x3D, 0x7B, 0xB3, 0x92, 0x5E, 0xD8, 0xF5, 0x87, 0x54, 0x0D, 0xA5,
+    0x27, 0x3B, 0x0F, 0x9F, 0xDD, 0x51, 0xC9, 0x5B, 0x8D, 0x66, 0x24, 0xBB, 0x01, 0xFD, 0xC4, 0x1D,
+    0x02, 0x3B, 0x90, 0x4F, 0x10, 0xC9, 0x56, 0x9E, 0x15, 0x6E, 0x21, 0xFF, 0x26, 0x90, 0x3F, 0x87,
+    0x5B, 0x33, 0x1D, 0x16, 0x13, 0xD6, 0xE3, 0xD4, 0x38, 0x8D, 0x0F, 0x17, 0xE1, 0xB2, 0x09, 0x97,
+    0x4D, 0xB8, 0x52, 0x04, 0x77, 0x69, 0xA8, 0xD4, 0x64, 0xDF, 0xE4, 0xCE, 0xDD, 0x53, 0xD2, 0x1B,
+    0x37, 0xFB, 0x0B, 0xF9, 0xFC, 0x50, 0xE5, 0x89, 0xD8, 0x81, 0x2B, 0x14, 0x01, 0xD7, 0xE4, 0x11,
+    0x3B, 0xE0, 0x52, 0x01, 0xC2, 0xC5, 0xCE, 0x6A, 0x58, 0xAA, 0x6B, 0xC1, 0xD9, 0xAB, 0x53, 0x7D,
+    0xBD, 0x73, 0x53, 0xF1, 0x76, 0x78, 0xA4, 0x7C, 0x23, 0x54, 0x2F, 0xF9, 0x2B, 0xF5, 0xDB, 0xC1,
+    0x89, 0xD3, 0x0D, 0xD4, 0x87, 0x99, 0xA2, 0x79, 0x6F, 0x29, 0x87, 0x47, 0xAC, 0x77, 0xD6, 0x9F,
+    0x2D, 0xC7, 0x2B, 0x46, 0x91, 0x4B, 0x33, 0x45, 0xA0, 0x1E, 0xFE, 0xA5, 0x68, 0x27, 0x6E, 0x07,
+    0xF8, 0xD2, 0xEA, 0xFE, 0xD3, 0x4F, 0x64, 0x62, 0xAC, 0xAE, 0x8D, 0x97, 0xED, 0xB9, 0xF0, 0x75,
+    0xFB, 0xD8, 0xBB, 0x0F, 0xDB, 0x35, 0xB8, 0xFF, 0xD8, 0xFC, 0x51, 0x02, 0x70, 0x2B, 0x95, 0xC6,
+    0xEA, 0x7B, 0xD1, 0x0E, 0x6D, 0x11, 0xEC, 0xD5, 0xB9, 0x08, 0x4B, 0x16, 0x1D, 0x57, 0xAC, 0x77,
+    0xE7, 0xA6, 0xDA, 0xAF, 0xB5, 0xAF, 0xE5, 0xB3, 0x3D, 0xBC, 0xE2, 0x13, 0x63, 0x3F, 0x55, 0x11,
+    0x47, 0xE5, 0xCB, 0x31, 0x9F, 0x88, 0x38, 0xAA, 0xAE, 0x1C, 0x9D, 0xEE, 0x4F, 0xD5, 0x27, 0xED,
+    0x94, 0x6B, 0x29, 0xA6, 0x2B, 0x85, 0x7F, 0x24, 0x63, 0x21, 0x9F, 0x29, 0x47, 0x5C, 0x97, 0x2D,
+    0x14, 0x81, 0xFA, 0xAD, 0xBF, 0x74, 0x8A, 0xB5, 0xC6, 0x54, 0x61, 0xD1, 0xCA, 0x8C, 0x97, 0xCF,
+    0xE4, 0x81, 0xAA, 0x2B, 0x66, 0x14, 0xF2, 0x0B, 0x03, 0x55, 0xC7, 0x42, 0x15, 0xA4, 0x5C, 0xC7,
+    0x54, 0x55, 0xDD, 0x51, 0x0F, 0xD4, 0x81, 0x3A, 0x52, 0xB5, 0x54, 0xF7, 0x77, 0xD5, 0xBD, 0x43,
+    0xF5, 0xA5, 0x60, 0xA5, 0x6B, 0x52, 0xA0, 0xEA, 0x28, 0x13, 0xCA, 0x6A, 0x45, 0x2D, 0x6F, 0xBF,
+    0xDF, 0x98, 0x81, 0x7C, 0x6D, 0xD0, 0x0C, 0x7D, 0xC2, 0x5C, 0x13, 0x59, 0xE4, 0xCC, 0x82, 0x16,
+    0xEA, 0xE3, 0xEC, 0x4D, 0xB9, 0xD0, 0xDF, 0x30, 0x0B, 0xE5, 0x48, 0xF5, 0x7D, 0x9C, 0x7C, 0xFB,
+    0xED, 0x6D, 0x06, 0x2F, 0x9B, 0xD0, 0x96, 0xA3, 0x93, 0x2F, 0x57, 0x80, 0x5A, 0x93, 0xF4, 0xE6,
+    0xF7, 0xDB, 0xCA, 0x4C, 0xB7, 0xD6, 0x4D, 0x36, 0x63, 0x3D, 0x0B, 0xE5, 0x88, 0xC3, 0xCC, 0x58,
+    0xBF, 0x75, 0x81, 0x00, 0xB9, 0xBA, 0xB6, 0x7F, 0x3C, 0x38, 0xFB, 0xC2, 0xEC, 0xEE, 0xF7, 0x6D,
+    0xCC, 0x34, 0xD4, 0x17, 0xBE, 0x37, 0x55, 0x2F, 0xF9, 0xD6, 0x9D, 0x9B, 0x5B, 0x75, 0xED, 0xB4,
+    0xAF, 0xD3, 0xE9, 0x43, 0xAE, 0x58, 0x8C, 0x57, 0xAC, 0x77, 0xD6, 0x3B, 0x3B, 0x3C, 0x52, 0xDE,
+    0x5C, 0x72, 0x45, 0xFE, 0xF9, 0x44, 0x39, 0x66, 0xBD, 0x6F, 0xD7, 0xAD, 0x81, 0x39, 0x55, 0x47,
+    0x3B, 0x29, 0xF2, 0x09, 0x29, 0x62, 0x8E, 0x02, 0xDA, 0x22, 0x92, 0xDA, 0x3A, 0xB6, 0xA8, 0xF6,
+    0xC6, 0x6E, 0xA3, 0x99, 0x6B, 0xAD, 0xFB, 0xA8, 0xD6, 0x43, 0xDE, 0xBF, 0x05, 0x45, 0xCA, 0x61,
+    0x7E, 0x6B, 0xA3, 0x76, 0x32, 0x7D, 0x73, 0xAB, 0x99, 0xDA, 0xB7, 0xA1, 0x02, 0x9C, 0x51, 0x03,
+    0xBD, 0x1A, 0xEC, 0xFB, 0x4A, 0xE4, 0x9A, 0x99, 0x8B, 0x91, 0xDA, 0x7F, 0x2A, 0x15, 0x9B, 0x95,
+    0xD3, 0x29, 0x0A, 0x29, 0xA4, 0x9C, 0x6C, 0x31, 0x43, 0xDE, 0xBF, 0xF5, 0x14, 0xB5, 0xE4, 0x79,
+    0x76, 0x7D, 0x06, 0xAA, 0x61, 0xB3, 0xE3, 0xFF, 0x66, 0xE6, 0x0E, 0x23, 0x29, 0x56, 0x92, 0x42,
+    0xFB, 0x72, 0xAF, 0x54, 0x67, 0x73, 0x7C, 0x64, 0xFD, 0xA6, 0x59, 0xD9, 0x11, 0x84, 0x77, 0x52,
+    0xF2, 0x09, 0xD9, 0xFD, 0xC1, 0x6D, 0x6E, 0x5E, 0x99, 0xF6, 0x9D, 0x8E, 0x36, 0x58, 0x9F, 0x5A,
+    0x1F, 0x95, 0xDA, 0x2B, 0xDC, 0x50, 0x05, 0xD7, 0x70, 0x3B, 0x26, 0x9A, 0xA5, 0xD2, 0x50, 0x47,
+    0x9C, 0xD7, 0x4B, 0x8A, 0x56, 0xBE, 0x58, 0x15, 0xAA, 0xF7, 0xF2, 0xE9, 0x37, 0xE8, 0x35, 0xB1,
+    0x52, 0x7B, 0xAC, 0x7E, 0x44, 0x35, 0x64, 0x02, 0x41, 0x16, 0xB1, 0x0B, 0x55, 0x80, 0xDA, 0x53,
+    0x87, 0x6C, 0x4D, 0xA9, 0xCB, 0xBE, 0xAB, 0x07, 0x70, 0x8F, 0xFF, 0x6B, 0x33, 0x17, 0x6B, 0x83,
+    0xD1, 0xCD, 0xD9, 0xDD, 0x9B, 0xEA, 0x7A, 0x2A, 0x8D, 0xBD, 0x46, 0x72, 0x35, 0xED, 0x47, 0x73,
+    0x95, 0x59, 0x3F, 0x6F, 0xB2, 0xEF, 0xB5, 0x62, 0xD4, 0x3C, 0x4C, 0x39, 0xF3, 0x3C, 0xD5, 0xC8,
+    0x43, 0xDB, 0x24, 0xBC, 0x1D, 0x29, 0xA5, 0xC8, 0x69, 0x7D, 0xEB, 0x7C, 0xE2, 0x67, 0xEA, 0x4D,
+    0x94, 0xC3, 0x56, 0x85, 0xA5, 0x26, 0x11, 0x0F, 0xB7, 0xD2, 0x4E, 0x59, 0x48, 0x6F, 0x5B, 0xC9,
+    0xA7, 0x16, 0xFC, 0x63, 0xA6, 0xF2, 0x3B, 0xFB, 0x02, 0xB7, 0xBE, 0xD9, 0xFF, 0xB3, 0xDB, 0xED,
+    0x9E, 0xD8, 0x67, 0x48, 0x96, 0xEA, 0xFB, 0x5F, 0xDD, 0x3D, 0x55, 0x7B, 0x12, 0x1B, 0x94, 0xCA,
+    0xE8, 0x3F, 0xF7, 0x01, 0x4E, 0xC9, 0x63, 0x23, 0x56, 0xDE, 0x2A, 0xDA, 0x57, 0xAF, 0x7F, 0xF7,
+    0x8D, 0x1F, 0xCF, 0x21, 0x7E, 0x11, 0x07, 0xD6, 0x63, 0x52, 0xC4, 0xF2, 0x33, 0x9E, 0x1C, 0xE3,
+    0xB6, 0x6E, 0xBF, 0xC3, 0x40, 0x9B, 0xFE, 0xDB, 0xED, 0x76, 0xFD, 0x13, 0x92, 0x54, 0x49, 0x8A,
+    0x9F, 0xDD, 0xFD, 0xC5, 0x85, 0x61, 0xF3, 0xDE, 0xD5, 0xC8, 0x56, 0xAC, 0x38, 0x7E, 0xE0, 0x1E,
+    0xFE, 0xEE, 0x2B, 0xC5, 0x5B, 0xBF, 0xE8, 0x6C, 0xFD, 0xD2, 0x4B, 0x6F, 0xBC, 0xFF, 0x7E, 0x70,
+    0x0A, 0x26, 0xF5, 0xCF, 0xE6, 0x27, 0x4E, 0x31, 0x64, 0x1E, 0x3B, 0x54, 0x1E, 0xE1, 0xBC, 0x1D,
+    0xA9, 0xBB, 0x7E, 0xB7, 0xEB, 0x9F, 0x94, 0xA4, 0x0B, 0x92, 0x96, 0xFA, 0xFB, 0x07, 0x17, 0xC6,
+    0xBA, 0xE3, 0x0A, 0xCE, 0x57, 0x23, 0x0E, 0x07, 0x9F, 0xE7, 0xD3, 0x1C, 0x95, 0x04, 0x25, 0x39,
+    0x54, 0xF2, 0x95, 0x96, 0xEA, 0xD5, 0x57, 0xAF, 0xBD, 0xF1, 0xEE, 0xF8, 0xE9, 0xF8, 0xE9, 0x0F,
+    0xDC, 0xD0, 0xC7, 0xDC, 0xC7, 0xEC, 0x37, 0xBE, 0x7B, 0xED, 0x27, 0x3F, 0x39, 0xBA, 0x87, 0x80,
+    0x09, 0x70, 0x6B, 0xDA, 0x3A, 0xA3, 0xEF, 0x28, 0xD5, 0x21, 0x79, 0x7B, 0xFD, 0xBA, 0x77, 0xCE,
+    0xF1, 0xF9, 0xF8, 0x79, 0x4C, 0x48, 0x01, 0x9B, 0x83, 0x3F, 0x89, 0x5F, 0x28, 0x7E, 0xFC, 0xE3,
+    0x50, 0x4A, 0x5D, 0xA9, 0x99, 0x52, 0x1D, 0xC5, 0xC4, 0xED, 0x0F, 0x7E, 0xEB, 0xFC, 0x56, 0xA8,
+    0x92, 0x4A, 0x3F, 0xEB, 0x8E, 0x72, 0x24, 0x9F, 0xE1, 0xCA, 0x89, 0x27, 0x87, 0x57, 0xB8, 0x5C,
+    0x77, 0xFD, 0x7D, 0x63, 0x9F, 0x4F, 0x3D, 0x97, 0x5B, 0xE9, 0xA2, 0xF4, 0x8A, 0x34, 0xB9, 0x86,
+    0x62, 0x4E, 0x85, 0x81, 0x1E, 0x9A, 0x0F, 0x7C, 0xE9, 0xE4, 0x93, 0x5F, 0xE7, 0x4A, 0xD5, 0xD5,
+    0x4F, 0xCC, 0xE5, 0xE8, 0x1E, 0x9D, 0xCD, 0xDC, 0x4A, 0x17, 0xA4, 0x37, 0xA5, 0x40, 0x11, 0x28,
+    0x13, 0x33, 0x39, 0x6D, 0x5C, 0xEB, 0x9D, 0x5B, 0x25, 0xAD, 0x99, 0x08, 0x2C, 0xF4, 0xB8, 0xA6,
+    0x6F, 0xEC, 0x70, 0x05, 0x33, 0xF5, 0x07, 0x07, 0x4B, 0xBB, 0x49, 0xF5, 0xEA, 0x72, 0x70, 0x70,
+    0xBE, 0xEE, 0x36, 0x8A, 0xC8, 0xF9, 0xAD, 0x6B, 0x82, 0x3D, 0xC0, 0x72, 0x7B, 0xDE, 0xC8, 0x75,
+    0x90, 0x2F, 0x07, 0xBB, 0xA7, 0x6B, 0x49, 0xDF, 0x93, 0xA4, 0x0B, 0xDD, 0x7E, 0x03, 0x92, 0x5E,
+    0xD2, 0xD0, 0x4B, 0x6A, 0xFA, 0x83, 0x3F, 0x78, 0x26, 0x55, 0xEE, 0x5E, 0x61, 0x2B, 0x33, 0xA5,
+    0x03, 0xF2, 0x31, 0x95, 0x33, 0xE4, 0x1A, 0xC9, 0xE7, 0x2B, 0x98, 0xB5, 0x0E, 0x46, 0x4F, 0xCA,
+    0xBC, 0xFF, 0xFA, 0xFB, 0xE1, 0xB9, 0xF9, 0xF9, 0xE7, 0x4E, 0x9D, 0xAD, 0x4F, 0x61, 0x9F, 0xF4,
+    0x98, 0xD7, 0x03, 0xCC, 0xCF, 0xC3, 0xD9, 0x9A, 0x9F, 0xF2, 0xC2, 0xBD, 0xFE, 0xE4, 0x9D, 0xD1,
+    0xA7, 0x87, 0xAF, 0x3E, 0x73, 0xB0, 0x66, 0x92, 0xD6, 0x42, 0x5B, 0x89, 0xCC, 0x65, 0x20, 0x7F,
+    0x4F, 0x92, 0x9E, 0x90, 0x34, 0xDF, 0xF9, 0xCC, 0x41, 0xBB, 0x87, 0xA1, 0x75, 0x07, 0x3C, 0xBF,
+    0xDD, 0xD9, 0xDD, 0x15, 0x3F, 0xFF, 0xB2, 0xB9, 0x7D, 0xF2, 0xAA, 0x79, 0xE3, 0xF5, 0x77, 0xC3,
+    0x3A, 0x5F, 0x89, 0xE5, 0x5A, 0xCF, 0xF4, 0x4F, 0xCE, 0x94, 0xAF, 0xCF, 0x89, 0x3A, 0x2A, 0x67,
+    0xE0, 0xB9, 0xBD, 0x1A, 0x7F, 0xDE, 0x80, 0x09, 0x0E, 0x5C, 0xD3, 0x63, 0x66, 0x7A, 0x9C, 0xA4,
+    0x5C, 0xD2, 0x5A, 0x37, 0xF0, 0xF0, 0xC3, 0x90, 0x4F, 0xBD, 0xA4, 0xAE, 0x97, 0x66, 0x56, 0xEA,
+    0x8E, 0x35, 0x8F, 0x10, 0xAD, 0x07, 0xFF, 0x5F, 0x9D, 0x5C, 0xD8, 0x11, 0xDC, 0x35, 0x81, 0x1D,
+    0xDB, 0x91, 0x72, 0xB2, 0x11, 0x13, 0x73, 0xC1, 0x42, 0xFB, 0xD6, 0xAE, 0xC7, 0x4A, 0xEA, 0x72,
+    0x49, 0x1E, 0xF7, 0xDE, 0x85, 0x11, 0x1B, 0xCD, 0x44, 0xA6, 0x2C, 0x82, 0x1B, 0x17, 0x28, 0xA3,
+    0x83, 0x4C, 0x75, 0x07, 0xEE, 0xBA, 0x87, 0x52, 0x01, 0x32, 0x4D, 0x80, 0x8B, 0x09, 0x33, 0xEC,
+    0x97, 0xF2, 0x51, 0x6E, 0xBA, 0x55, 0x97, 0x49, 0x63, 0x3E, 0xD6, 0x21, 0x15, 0xC8, 0x14, 0x5B,
+    0x43, 0x9A, 0x89, 0x94, 0xEF, 0x47, 0x5A, 0xC5, 0x5C, 0x97, 0xE2, 0x89, 0xAC, 0xEA, 0xEC, 0x7C,
+    0x31, 0x39, 0x5F, 0x86, 0x2D, 0xF1, 0x3D, 0x38, 0xEF, 0xBC, 0xF3, 0x7D, 0xE3, 0xDE, 0x5F, 0xB1,
+    0x9A, 0x52, 0x77, 0xF3, 0xAD, 0x47, 0x8D, 0xF8, 0xD7, 0x92, 0x61, 0x5B, 0x92, 0x9F, 0xDB, 0x4A,
+    0xC5, 0xCD, 0x02, 0x76, 0xDA, 0xB2, 0xDD, 0xF7, 0x4B, 0xCB, 0xED, 0x07, 0x17, 0x3E, 0xFC, 0xEE,
+    0x79, 0xDC, 0x0F, 0x92, 0xDA, 0x2E, 0xAD, 0x8E, 0x13, 0x85, 0x5F, 0x3D, 0x34, 0x1D, 0xAD, 0x66,
+    0x47, 0x29, 0x29, 0xD0, 0xDF, 0xBC, 0x24, 0xCA, 0x65, 0xEB, 0x8E, 0x73, 0x73, 0xBE, 0x92, 0x2B,
+    0xD8, 0x40, 0xDD, 0x0E, 0xAD, 0xCF, 0xA7, 0xFE, 0xD1, 0x95, 0xFA, 0x9E, 0xB5, 0x9C, 0xF2, 0xA9,
+    0x98, 0xEB, 0xA1, 0xEE, 0xAA, 0xB1, 0xBF, 0x67, 0xA6, 0xBF, 0x67, 0xAD, 0x3A, 0x13, 0x8B, 0x65,
+    0xC6, 0x06, 0xAB, 0x8E, 0xBE, 0xAB, 0x67, 0x8A, 0x88, 0x0B, 0xF4, 0x03, 0x5A, 0xFB, 0x15, 0x2B,
+    0x69, 0x20, 0xD6, 0x9A, 0xC9, 0xFD, 0xE9, 0x6F, 0x1D, 0xCF, 0xD4, 0x2D, 0xFB, 0x6E, 0xE0, 0x2C,
+    0xF5, 0x80, 0x0F, 0x50, 0x68, 0xDC, 0x24, 0x6E, 0x5F, 0x9A, 0xA0, 0xFE, 0x46, 0x04, 0x57, 0x44,
+    0x68, 0xCD, 0x0A, 0x8B, 0x11, 0xC4, 0x4C, 0x4D, 0x3E, 0xA7, 0xF4, 0xAA, 0x7C, 0x11, 0x68, 0x07,
+    0x3B, 0xE2, 0xC6, 0x6A, 0xC0, 0x85, 0xDA, 0x53, 0x4D, 0xEE, 0xAD, 0xDD, 0xA5, 0xD8, 0x4A, 0x4A,
+    0x0F, 0x7B, 0x07, 0xAB, 0x1F, 0x4A, 0xD2, 0xB7, 0xB5, 0xBB, 0xB4, 0xB8, 0x80, 0x0D, 0xBD, 0xC7,
+    0xDD, 0xA3, 0x2E, 0x8F, 0x46, 0xD8, 0xB1, 0x8C, 0xB4, 0xD8, 0x39, 0x8F, 0xB8, 0x60, 0x07, 0x5A,
+    0xDF, 0x82, 0x1E, 0x9F, 0xC9, 0x65, 0x3D, 0x45, 0xBC, 0x02, 0xF6, 0xFD, 0x90, 0x9A, 0x2E, 0x52,
+    0x61, 0x6C, 0x52, 0x8B, 0x6E, 0x2B, 0xF7, 0x39, 0xFD, 0x81, 0x2A, 0x53, 0x9F, 0x2B, 0x75, 0x19,
+    0x28, 0x1A, 0x7D, 0x73, 0x6B, 0x79, 0xE7, 0x44, 0xF7, 0xB3, 0x07, 0xEC, 0xCD, 0xDD, 0x6E, 0xF7,
+    0xF8, 0x11, 0x65, 0x18, 0xDD, 0x5B, 0xBB, 0xDD, 0xCE, 0x86, 0xA3, 0x9D, 0x0D, 0x9C, 0x3F, 0xAA,
+    0x4A, 0xD6, 0x7F, 0x3E, 0x38, 0x68, 0xAC, 0xB6, 0x8E, 0xF8, 0x48, 0xD6, 0x27, 0x1E, 0x3E, 0x3B,
+    0x7F, 0xB4, 0xAF, 0x51, 0x6A, 0x25, 0x88, 0xD4, 0xFB, 0xDA, 0x4A, 0xEF, 0x6E, 0xDC, 0x3B, 0x51,
+    0x87, 0x3C, 0x62, 0x03, 0x2B, 0xE5, 0x4C, 0x8B, 0x89, 0xD4, 0x1E, 0xED, 0x2E, 0xDD, 0xFC, 0x4B,
+    0xA7, 0x64, 0x79, 0xA5, 0x6B, 0xEB, 0x6E, 0xDD, 0x3D, 0xA5, 0xA6, 0x85, 0x7A, 0x74, 0xDD, 0xD6,
+    0x05, 0xDD, 0xFF, 0x30, 0x80, 0xD5, 0x72, 0xF0, 0x00, 0x92, 0x44, 0x99, 0x96, 0x8C, 0x14, 0x52,
+    0x4C, 0x6A, 0xC3, 0x71, 0x77, 0xD6, 0xED, 0x07, 0x07, 0x14, 0x4A, 0xD5, 0x52, 0x0A, 0x56, 0x52,
+    0xB4, 0xEB, 0xBE, 0x6E, 0x7F, 0x6B, 0x5F, 0xDC, 0xED, 0x76, 0x1F, 0xBC, 0xE6, 0x6E, 0xF7, 0x54,
+    0xDF, 0xED, 0x13, 0x56, 0x46, 0x87, 0x5B, 0xEB, 0x4D, 0x12, 0x1B, 0x9F, 0x48, 0x9D, 0x00, 0x07,
+    0x07, 0xCD, 0xBE, 0x20, 0x75, 0xC6, 0x48, 0x1A, 0xD9, 0xAA, 0x77, 0x4F, 0xF7, 0xE1, 0x28, 0x53,
+    0x97, 0x44, 0x35, 0x03, 0xE8, 0x96, 0xDD, 0x6E, 0xD7, 0x5F, 0x3B, 0x16, 0xEB, 0x67, 0x77, 0xBB,
+    0x9D, 0x8E, 0x3E, 0x94, 0x0A, 0x57, 0x03, 0x60, 0xE7, 0xD3, 0x07, 0x07, 0x17, 0x63, 0xBA, 0x9A,
+    0xA4, 0x19, 0x27, 0x1D, 0xEE, 0x87, 0x74, 0xDC, 0xEB, 0x29, 0xA5, 0xC6, 0xD0, 0xA4, 0xC8, 0x81,
+    0x62, 0x7A, 0x50, 0xB0, 0xE2, 0x46, 0x6A, 0x6F, 0x22, 0x66, 0xA2, 0xEF, 0x58, 0xB1, 0x61, 0xD7,
+    0xBF, 0xF5, 0x6C, 0x3C, 0x1E, 0xE2, 0xD5, 0xDD, 0xA5, 0xB7, 0x2E, 0x05, 0xCC, 0x54, 0x44, 0xE8,
+    0xF3, 0x15, 0x2A, 0x2F, 0x30, 0x37, 0xD4, 0x1D, 0x1C, 0x48, 0xDE, 0xED, 0x05, 0xD6, 0x99, 0xAD,
+    0x1E, 0xD9, 0x0E, 0x47, 0x9B, 0x3F, 0xDD, 0x9E, 0x84, 0x8A, 0x95, 0xD4, 0x1C, 0xDD, 0x63, 0xCA,
+    0xE5, 0xC6, 0x23, 0xA0, 0x54, 0x85, 0xDD, 0x6E, 0xF7, 0xC1, 0x6B, 0xEE, 0x76, 0x97, 0xC2, 0x5E,
+    0x18, 0xC5, 0x02, 0x7C, 0x42, 0x46, 0x92, 0xD8, 0xF7, 0x2C, 0xDF, 0xE0, 0xF4, 0xC1, 0xC1, 0x89,
+    0xD2, 0x32, 0x49, 0x2F, 0x49, 0x92, 0xCE, 0xE8, 0xE6, 0x25, 0x0D, 0xC5, 0x82, 0x59, 0xA9, 0x26,
+    0xEC, 0x4C, 0x3B, 0xE0, 0xC6, 0x4C, 0x0D, 0xEA, 0x7E, 0x35, 0x2F, 0x57, 0x9A, 0x4B, 0x45, 0x29,
+    0xF4, 0x7A, 0x67, 0xB7, 0xBB, 0x67, 0xB7, 0x3B, 0x02, 0xC1, 0xBA, 0x27, 0x79, 0xA6, 0x5D, 0x3F,
+    0xDB, 0x85, 0x22, 0xD8, 0x88, 0xED, 0xEA, 0x99, 0xDF, 0x4E, 0x25, 0x12, 0xEE, 0xB8, 0x5E, 0xE4,
+    0x38, 0x49, 0xB5, 0x17, 0x9E, 0x1B, 0xB6, 0x25, 0x54, 0x85, 0x6D, 0xD5, 0xD9, 0x89, 0x5B, 0xE8,
+    0x3B, 0x1E, 0x2E, 0x22, 0x66, 0x72, 0x9E, 0xEA, 0x95, 0xBD, 0xC8, 0x62, 0x2D, 0x69, 0xBC, 0x63,
+    0xB7, 0xDB, 0x35, 0xA9, 0xEC, 0x6F, 0x69, 0xA5, 0xEF, 0xED, 0x76, 0x7F, 0xB9, 0xB9, 0xEF, 0xCA,
+    0xA7, 0x79, 0x29, 0x53, 0x2B, 0xD0, 0xBE, 0x7B, 0x2C, 0x69, 0x48, 0xBF, 0xB5, 0x8C, 0xFC, 0x42,
+    0x1F, 0x74, 0x27, 0x3E, 0x98, 0x35, 0x9B, 0x7A, 0xB5, 0x0D, 0x28, 0x01, 0x09, 0x33, 0xA7, 0x2F,
+    0x57, 0xE3, 0x2F, 0xFC, 0xD6, 0x72, 0xFC, 0x96, 0xDD, 0xDE, 0xBA, 0x1D, 0x6E, 0x69, 0xC8, 0x26,
+    0xA8, 0x9A, 0xFC, 0xE5, 0xE9, 0x6B, 0xEE, 0xD5, 0xF6, 0xAA, 0x34, 0xE7, 0x9A, 0xA9, 0xD4, 0x54,
+    0xD2, 0xBD, 0xEB, 0xFB, 0x8B, 0xAB, 0xEE, 0xF7, 0xF7, 0x4C, 0xB7, 0x52, 0xA5, 0x4F, 0x7E, 0xB5,
+    0x29, 0x34, 0x56, 0x9A, 0xDD, 0x63, 0xD1, 0xB1, 0xFF, 0xF9, 0xC1, 0x5C, 0x29, 0x14, 0xF2, 0x3C,
+    0x40, 0x66, 0x62, 0xFF, 0xF6, 0xBA, 0x6D, 0xBB, 0xF2, 0xC0, 0x3E, 0x1F, 0xEF, 0x9A, 0x8D, 0x79,
+    0x2A, 0xC2, 0x7E, 0x47, 0x80, 0xE3, 0x67, 0x7B, 0x56, 0xCA, 0x84, 0xD3, 0x0F, 0x50, 0x77, 0xED,
+    0xCC, 0x92, 0x29, 0x98, 0x90, 0xF7, 0xBE, 0xEA, 0x68, 0x9B, 0xCB, 0xB0, 0x9A, 0x80, 0x89, 0x55,
+    0x47, 0x19, 0x2E, 0x83, 0x7D, 0x25, 0x80, 0xFB, 0x86, 0x87, 0xFE, 0xE1, 0xAD, 0xE6, 0xC3, 0xC8,
+    0x6F, 0xEE, 0xF6, 0xB8, 0x40, 0xE0, 0xB6, 0x54, 0x41, 0xDB, 0x0F, 0x95, 0xD3, 0x7D, 0x3F, 0xB9,
+    0xB9, 0x2E, 0x97, 0x8B, 0xD5, 0xFA, 0xDA, 0x47, 0xB3, 0x94, 0x63, 0x3F, 0xB5, 0xBA, 0xF0, 0x86,
+    0x86, 0xBE, 0xFC, 0x51, 0x16, 0x52, 0xA9, 0xCC, 0x6D, 0xF4, 0xBE, 0x9A, 0x6A, 0x95, 0xBA, 0x76,
+    0x73, 0x5D, 0x97, 0xCB, 0xC5, 0x52, 0xBC, 0xED, 0x6B, 0x7F, 0xF6, 0xB2, 0x89, 0xE6, 0xED, 0x51,
+    0xE1, 0x4A, 0xAB, 0x0B, 0xBA, 0xAA, 0xA1, 0x9F, 0xCB, 0x29, 0xDB, 0xD8, 0xB8, 0x65, 0x4F, 0xC2,
+    0xD9, 0x61, 0x3F, 0xCC, 0x5F, 0xFA, 0xA5, 0x75, 0x6F, 0xE3, 0xED, 0xBE, 0xAC, 0xFC, 0x38, 0x80,
+    0x48, 0x45, 0xB1, 0xA9, 0xDF, 0x4F, 0xCD, 0x7E, 0x1F, 0x91, 0xB4, 0xF1, 0xD3, 0xD6, 0x8D, 0xE2,
+    0x8F, 0xEC, 0xA7, 0x1B, 0x8F, 0xAC, 0x5D, 0x1D, 0x8E, 0xF6, 0xD2, 0x48, 0x0D, 0x71, 0x27, 0xBE,
+    0x9C, 0xDA, 0x37, 0xD6, 0xDD, 0x6E, 0xD7, 0x39, 0x29, 0x6D, 0x5F, 0x94, 0xAE, 0xAB, 0x70, 0x7B,
+    0xFD, 0xDD, 0x77, 0x63, 0xFF, 0x77, 0x3F, 0xDC, 0xD9, 0xFD, 0x0A, 0x12, 0x55, 0x7B, 0x64, 0x36,
+    0xEC, 0x07, 0x66, 0x52, 0xFC, 0x3D, 0x92, 0x5A, 0xEA, 0x70, 0x7D, 0x07, 0xF5, 0x4B, 0x61, 0x2B,
+    0x83, 0x2F, 0x26, 0xD7, 0x61, 0x62, 0x19, 0xC8, 0xD6, 0x6C, 0x85, 0x1E, 0xE7, 0x71, 0xBE, 0x98,
+    0xA8, 0x07, 0x84, 0x0D, 0xD4, 0xBE, 0x98, 0x29, 0xE6, 0x3C, 0x82, 0x10, 0xD4, 0x43, 0xDF, 0x60,
+    0xA2, 0xF3, 0x9B, 0x97, 0x4D, 0x36, 0xDE, 0x5D, 0x5D, 0xC0, 0x06, 0xE7, 0x29, 0xA7, 0x32, 0x60,
+    0x62, 0xB6, 0x92, 0xAD, 0x38, 0x8F, 0x28, 0x26, 0x5C, 0x87, 0xA8, 0x07, 0x6A, 0x6F, 0x03, 0xA9,
+    0xF8, 0x5B, 0x79, 0x84, 0x6A, 0x58, 0xC1, 0xC4, 0xB6, 0x81, 0xDE, 0xF9, 0xD4, 0xDF, 0xB5, 0x6D,
+    0x05, 0xD2, 0xCE, 0x47, 0x55, 0x48, 0x3A, 0xEA, 0xAA, 0xBA, 0xF3, 0x99, 0x54, 0x9C, 0xD8, 0x4B,
+    0x5D, 0x7B, 0xB3, 0x9F, 0xDC, 0x90, 0xCB, 0x8E, 0xD4, 0x2F, 0x06, 0xCC, 0x7B, 0x11, 0x96, 0x1E,
+    0xDC, 0x25, 0x8F, 0x7D, 0x3B, 0x60, 0x6E, 0x46, 0x58, 0x7F, 0xB1, 0x17, 0xBA, 0xAD, 0x01, 0xFC,
+    0xEF, 0xFB, 0xBD, 0x4B, 0x1E, 0xFB, 0x66, 0xC0, 0xBC, 0xB7, 0x90, 0x2D, 0xAE, 0xA3, 0xB7, 0x33,
+    0xFD, 0x0B, 0x92, 0x7C, 0x95, 0xF6, 0xE8, 0xE9, 0xC8, 0x0E, 0x00, 0x6E, 0x39, 0x84, 0x7E, 0xC1,
+    0x48, 0x14, 0xCB, 0x15, 0xEC, 0xF4, 0x3B, 0xD8, 0x89, 0x7F, 0x9C, 0xDF, 0x00, 0x55, 0xE0, 0x37,
+    0xAA, 0xC0, 0x95, 0x7A, 0x44, 0xF2, 0xB4, 0x82, 0x5B, 0x8E, 0xD2, 0xD9, 0x29, 0xE5, 0x1D, 0x4E,
+    0x6E, 0x00, 0x94, 0x1D, 0xF2, 0xF3, 0x0F, 0x41, 0xFD, 0xDD, 0x85, 0x4C, 0x97, 0x26, 0x8A, 0xB5,
+    0xF5, 0xD8, 0xE9, 0xB6, 0x23, 0xF8, 0x75, 0xE5, 0xA3, 0x6F, 0xFE, 0x11, 0xDC, 0xD2, 0xFC, 0xFC,
+    0xD3, 0x16, 0xF3, 0xC9, 0xDB, 0xC9, 0xD7, 0x3D, 0xB6, 0x39, 0x6F, 0x47, 0x3D, 0xBE, 0x9C, 0xAC,
+    0xDE, 0xCA, 0x1A, 0x77, 0x55, 0xE5, 0x5C, 0xED, 0xB5, 0xFA, 0x97, 0xBE, 0xE6, 0xDF, 0x39, 0x92,
+    0xBF, 0x93, 0x49, 0xCE, 0x35, 0x98, 0x6B, 0xD2, 0xBD, 0x37, 0xD7, 0x5E, 0xF1, 0x79, 0xFA, 0x78,
+    0x8A, 0xEC, 0x9B, 0x1F, 0xE8, 0x72, 0xBA, 0x28, 0xE9, 0x07, 0x69, 0xDB, 0xAE, 0x74, 0xDC, 0xB9,
+    0xDB, 0xED, 0xFE, 0x5C, 0xD2, 0xDF, 0xEA, 0x88, 0x60, 0x6A, 0xC8, 0xE4, 0xEF, 0x6A, 0xF5, 0x84,
+    0xDE, 0xD7, 0x1A, 0x4B, 0x5D, 0x6D, 0xCA, 0x21, 0x3B, 0xCF, 0x3D, 0x1F, 0x79, 0x11, 0xC0, 0x7E,
+    0x93, 0x07, 0xAF, 0x49, 0x0A, 0xBD, 0x34, 0xF3, 0x07, 0xCF, 0x1C, 0x0F, 0xEF, 0xCC, 0xA5, 0xB7,
+    0x1A, 0xB7, 0x19, 0xB8, 0x6B, 0x87, 0x64, 0xDF, 0x39, 0xAE, 0x5B, 0x1F, 0xE0, 0xF2, 0xE6, 0x51,
+    0x7F, 0x20, 0x2D, 0x58, 0x4F, 0x3E, 0x71, 0x7B, 0x7B, 0x70, 0x6F, 0x7A, 0xF1, 0xE5, 0xF6, 0xE0,
+    0x81, 0x62, 0x80, 0xDF, 0x62, 0x8F, 0x22, 0x0F, 0xEA, 0x0D, 0xA7, 0x4F, 0x07, 0x07, 0x07, 0x0F,
+    0x1C, 0x17, 0xC2, 0x6D, 0x37, 0xDE, 0x9E, 0xE8, 0x19, 0xCA, 0x76, 0xBB, 0xDD, 0x33, 0xFB, 0xB1,
+    0x9E, 0x28, 0x9B, 0x7B, 0x2E, 0x75, 0xCC, 0x4E, 0xF4, 0x13, 0xFD, 0x48, 0x3B, 0x52, 0xAC, 0xA9,
+    0x2A, 0xE4, 0xE8, 0x37, 0x26, 0x42, 0xE8, 0xD3, 0xC7, 0x0E, 0xFF, 0x07, 0xD2, 0x72, 0x2A, 0xF5,
+    0xCA, 0xBA, 0x89, 0xAC, 0x9F, 0xE0, 0xE8, 0x77, 0xA0, 0x58, 0x28, 0xD5, 0xA4, 0x1F, 0xA3, 0x86,
+    0xBB, 0x8E, 0x46, 0x7F, 0x72, 0x74, 0xFB, 0xC9, 0x19, 0x29, 0x1B, 0xCA, 0x48, 0x1B, 0xA8, 0x97,
+    0x4C, 0x23, 0xFD, 0x54, 0xA8, 0xCB, 0xD5, 0x55, 0x2B, 0x66, 0xA5, 0x9E, 0xC8, 0xD4, 0x95, 0x0B,
+    0x54, 0xA9, 0x41, 0xAB, 0x9D, 0x33, 0x8D, 0x64, 0x1A, 0x4B, 0x75, 0x14, 0xA2, 0x8E, 0x50, 0x79,
+    0x2E, 0x03, 0xE7, 0x8F, 0x12, 0x36, 0x45, 0xC7, 0x5D, 0x60, 0xD6, 0xC6, 0xCE, 0x6C, 0xA7, 0x4D,
+    0xE7, 0x25, 0xD7, 0x50, 0xAE, 0x50, 0xAC, 0xD4, 0x81, 0x4C, 0x5D, 0x19, 0x29, 0xD5, 0xD4, 0x0B,
+    0xF5, 0x42, 0x3F, 0xD1, 0xCF, 0xB9, 0x06, 0x34, 0x16, 0x6A, 0xA8, 0x3B, 0x16, 0xC8, 0x93, 0x17,
+    0xFD, 0x59, 0xF0, 0xB2, 0x3A, 0x09, 0x2F, 0x8F, 0xF0, 0xE8, 0x31, 0x82, 0xB6, 0x61, 0xBF, 0x5C,
+    0xCC, 0x02, 0x94, 0x3F, 0x1B, 0x5E, 0x9E, 0x88, 0x4E, 0xFA, 0xBD, 0xB1, 0x3C, 0x7D, 0xF1, 0xFB,
+    0x9C, 0xF9, 0x48, 0xA4, 0xB0, 0x52, 0x44, 0x5A, 0xCC, 0x42, 0xED, 0x11, 0x76, 0xC4, 0xF9, 0x22,
+    0x60, 0x83, 0x89, 0x98, 0xC8, 0x02, 0x6A, 0x5A, 0xA8, 0x82, 0xEB, 0x30, 0xFA, 0xF6, 0xF0, 0x53,
+    0x22, 0x85, 0xFE, 0xE0, 0xA0, 0x49, 0x26, 0xB3, 0xF2, 0x7B, 0x6E, 0x30, 0x7B, 0xFA, 0xA8, 0xF0,
+    0x77, 0x3F, 0x82, 0x26, 0x99, 0xD4, 0xDB, 0x0F, 0x2E, 0x8C, 0x58, 0x69, 0xFD, 0xE0, 0xE0, 0xDB,
+    0x8B, 0x11, 0x6A, 0xAF, 0x06, 0x3B, 0xD6, 0x81, 0x62, 0xBB, 0xBE, 0x60, 0xC1, 0xF9, 0x54, 0x2B,
+    0xE4, 0xBA, 0x22, 0x62, 0x07, 0xB3, 0x50, 0x86, 0xE2, 0xA3, 0x83, 0x6F, 0xBF, 0xD5, 0x6C, 0xB7,
+    0x60, 0xC7, 0xA3, 0x5E, 0xDC, 0x07, 0x8E, 0xD5, 0xF3, 0xA2, 0x34, 0xD6, 0x92, 0x1E, 0x97, 0xB4,
+    0xD6, 0x4B, 0x93, 0x44, 0x5D, 0xCC, 0x7B, 0xA6, 0xB2, 0x6F, 0x36, 0xF3, 0x53, 0x1C, 0xED, 0x2C,
+    0x56, 0xAD, 0xBB, 0xDD, 0xD3, 0x95, 0xA4, 0xD1, 0x4A, 0xEA, 0xB2, 0x4B, 0xDB, 0xDE, 0x76, 0x07,
+    0x07, 0x07, 0x07, 0xE7, 0x24, 0xE9, 0x1B, 0x92, 0x56, 0xB7, 0xB5, 0x12, 0x92, 0x4B, 0x6B, 0x53,
+    0x6A, 0xBB, 0x4E, 0x80, 0xD3, 0xA9, 0xD2, 0xD3, 0x6F, 0x67, 0xCF, 0xD6, 0xFD, 0x04, 0xD6, 0xE3,
+    0x36, 0xD3, 0x65, 0xFC, 0xEA, 0x6E, 0xA7, 0xEF, 0x49, 0x5A, 0xCA, 0xB4, 0x67, 0xC9, 0xBA, 0xD9,
+    0xE2, 0x83, 0x83, 0x83, 0x83, 0xFB, 0x24, 0xA9, 0x96, 0x14, 0xFB, 0x74, 0xC2, 0xDB, 0x81, 0x5C,
+    0x2B, 0x94, 0xD2, 0x8C, 0x1D, 0x9F, 0xAB, 0xBD, 0x1D, 0xEE, 0xCA, 0x62, 0x31, 0x94, 0x5D, 0x75,
+    0x6E, 0xCC, 0xC7, 0xFC, 0x9D, 0xC0, 0x73, 0xDC, 0xFD, 0x1C, 0x77, 0x61, 0xAF, 0x50, 0x76, 0xF9,
+    0x89, 0x4A, 0x98, 0x99, 0xBB, 0x28, 0xFF, 0x86, 0xB2, 0xCB, 0xDF, 0xF4, 0xF9, 0xC8, 0x34, 0xF3,
+    0x1C, 0xCF, 0xD7, 0xDC, 0xC5, 0x59, 0x13, 0xCA, 0xCE, 0xE1, 0x1E, 0x1B, 0x7B, 0x72, 0x69, 0x85,
+    0x4A, 0x0B, 0x70, 0xFB, 0xF9, 0x2D, 0x20, 0xDA, 0xAE, 0xB9, 0x5E, 0x4A, 0x7D, 0xA5, 0xDE, 0x0E,
+    0x64, 0xB1, 0x18, 0xA0, 0x3A, 0x37, 0x42, 0xFE, 0x4E, 0x00, 0xEE, 0x7E, 0x0E, 0x28, 0xAF, 0x24,
+    0x31, 0x9C, 0xB8, 0x26, 0x94, 0x7F, 0x03, 0xE4, 0x6F, 0x7A, 0x60, 0x9A, 0x81, 0xE7, 0x6B, 0xE0,
+    0xAC, 0x09, 0xE0, 0x70, 0x1D, 0x3D, 0xB9, 0x9E, 0xFD, 0x05, 0xAE, 0x39, 0x92, 0xC7, 0x62, 0x25,
+    0xD7, 0xB9, 0xB7, 0xC7, 0xFC, 0xE6, 0x3B, 0xE1, 0x4A, 0x3E, 0xDF, 0xFD, 0x5C, 0xF9, 0xFA, 0x6C,
+    0xAF, 0xD0, 0xCF, 0xB9, 0x9A, 0x72, 0xA6, 0x1D, 0xF2, 0x85, 0x6A, 0xCE, 0x35, 0x94, 0x7F, 0x93,
+    0xCF, 0x97, 0xF3, 0x37, 0xAF, 0xCE, 0xE5, 0x38, 0xDD, 0x9C, 0xB9, 0xF2, 0x7C, 0x3D, 0x53, 0xAE,
+    0x66, 0x06, 0xFD, 0x7D, 0xAE, 0x39, 0x90, 0xC7, 0x62, 0x20, 0xD7, 0xB9, 0x91, 0xFC, 0xE6, 0x3B,
+    0x81, 0x7C, 0xBE, 0xFB, 0x79, 0xF2, 0xD9, 0x5E, 0x21, 0x9F, 0x73, 0x35, 0xF9, 0x4C, 0x3B, 0xE4,
+    0x33, 0xD5, 0x9C, 0xCF, 0x94, 0x7F, 0x93, 0xCF, 0x98, 0x37, 0xAF, 0xCE, 0x30, 0xDD, 0x9C, 0xE1,
+    0xF9, 0x7A, 0x86, 0xB3, 0x66, 0x86, 0xF6, 0x67, 0x5D, 0x73, 0xBF, 0x21, 0x5D, 0xDB, 0xA4, 0xF4,
+    0x45, 0x31, 0xFD, 0x32, 0x2F, 0xDC, 0xB9, 0x5B, 0x77, 0x7F, 0x2E, 0xE9, 0xA6, 0xA4, 0xB5, 0x97,
+    0xD4, 0x1D, 0xC5, 0x0D, 0xA7, 0xA1, 0xE1, 0x94, 0x0D, 0xF9, 0x8A, 0xFB, 0xE1, 0x82, 0x7C, 0x75,
+    0x53, 0x8D, 0x0B, 0xC5, 0xDA, 0xFA, 0x72, 0x42, 0x1F, 0x70, 0x8B, 0x77, 0x36, 0x40, 0xA9, 0x27,
+    0x35, 0x6C, 0xB4, 0x8D, 0x87, 0xEA, 0xA6, 0xA6, 0x2B, 0x80, 0x68, 0xFD, 0x97, 0x61, 0x0F, 0xD5,
+    0x9D, 0x4F, 0x3D, 0xCB, 0x4A, 0x96, 0xE9, 0x62, 0x62, 0x06, 0xEC, 0x36, 0xE3, 0x9F, 0xD5, 0xAE,
+    0x7F, 0x2B, 0xF1, 0x33, 0xA9, 0x68, 0x71, 0x4C, 0xA6, 0xAC, 0xED, 0xAA, 0x31, 0xED, 0x6F, 0xD7,
+    0x37, 0x80, 0x0D, 0xF9, 0xC9, 0x93, 0x25, 0x7C, 0x08, 0xE5, 0x94, 0x25, 0xB0, 0x3D, 0x94, 0xD3,
+    0x89, 0x6B, 0x7C, 0xF8, 0x64, 0x7D, 0x53, 0x8D, 0xC7, 0x2F, 0x7F, 0xDA, 0x8E, 0xC5, 0x0C, 0xF9,
+    0xD4, 0xDF, 0xE8, 0x7D, 0xBA, 0x93, 0xD4, 0xBE, 0x77, 0x51, 0x0D, 0x50, 0x1F, 0x1E, 0x77, 0xD9,
+    0xDE, 0x71, 0x3E, 0xF9, 0xEA, 0xB4, 0x57, 0x6C, 0x00, 0xF4, 0xBB, 0x0B, 0x20, 0xEE, 0x02, 0x52,
+    0xEB, 0x72, 0x8A, 0xB8, 0x6C, 0xC8, 0x1A, 0xB8, 0xB8, 0xDF, 0x1E, 0x41, 0x69, 0x64, 0x9E, 0x44,
+    0xF8, 0x53, 0x8D, 0xC5, 0xC4, 0x86, 0x85, 0xF3, 0x25, 0x15, 0xBD, 0xD2, 0x76, 0xE0, 0x7C, 0x3D,
+    0x40, 0x35, 0xDA, 0x00, 0xE5, 0x64, 0x66, 0xC8, 0x97, 0x6C, 0xFD, 0x1A, 0x88, 0x76, 0x05, 0xE7,
+    0x2B, 0x41, 0x35, 0x9A, 0x15, 0xCA, 0x89, 0x5B, 0x37, 0x4B, 0x9F, 0xB3, 0x02, 0xF9, 0xD4, 0x1F,
+    0xF7, 0xA7, 0xA5, 0xBA, 0xCA, 0xFD, 0x76, 0x9B, 0x47, 0x9B, 0xDA, 0xD4, 0x6B, 0xDA, 0xA5, 0x59,
+    0x1E, 0x8A, 0xF5, 0x52, 0x3C, 0x12, 0x52, 0x3D, 0x14, 0x33, 0x98, 0x48, 0xDA, 0xE2, 0xD6, 0x06,
+    0xB8, 0xA8, 0x20, 0x70, 0x5A, 0xED, 0x48, 0x7E, 0xE9, 0xE6, 0xA3, 0x69, 0xA4, 0xB5, 0xDF, 0x0B,
+    0x32, 0x5B, 0x71, 0xDD, 0x4F, 0xFD, 0x66, 0x31, 0xA7, 0x76, 0xC4, 0xA6, 0x1A, 0xD3, 0xA4, 0x7C,
+    0x0D, 0x44, 0xAD, 0x0E, 0x1B, 0x72, 0x05, 0xB2, 0x95, 0x6A, 0x82, 0x7A, 0x38, 0x1A, 0x01, 0x9D,
+    0xEB, 0x80, 0xFA, 0xBE, 0xC4, 0x2B, 0x25, 0x82, 0x28, 0xA5, 0xD7, 0xFA, 0x13, 0xD5, 0xB8, 0xC9,
+    0x39, 0xD4, 0x6B, 0x91, 0x5A, 0x2B, 0x94, 0x50, 0x44, 0xB1, 0xF6, 0xFA, 0xBD, 0x65, 0x1B, 0x4A,
+    0xB1, 0x1F, 0x4C, 0x3A, 0x75, 0xCF, 0x5E, 0x4F, 0xB6, 0x09, 0xD9, 0x77, 0xBB, 0x4B, 0x0A, 0xE4,
+    0x97, 0x6E, 0x3E, 0xBB, 0xEE, 0xB4, 0x7D, 0xD5, 0x86, 0x6D, 0x68, 0x2B, 0x64, 0x2B, 0x6D, 0x57,
+    0x0F, 0x49, 0x97, 0x36, 0x56, 0xB8, 0x6F, 0x5C, 0x97, 0xCE, 0x95, 0x66, 0x0F, 0xD1, 0x6F, 0xC3,
+    0x4C, 0xF3, 0x95, 0x2F, 0xE8, 0x8B, 0xE9, 0x5C, 0x95, 0x3C, 0x36, 0x98, 0x98, 0x69, 0x4A, 0xEA,
+    0x69, 0xE7, 0xBD, 0xA8, 0x8E, 0x15, 0xB2, 0x73, 0x49, 0xAD, 0xEB, 0xFB, 0xF4, 0xE7, 0x71, 0xCF,
+    0xEC, 0x70, 0x42, 0xF9, 0xB8, 0xD2, 0xDC, 0xFE, 0xA1, 0x46, 0x54, 0x28, 0xF5, 0x98, 0xDE, 0xDE,
+    0xB7, 0xC4, 0xAB, 0x81, 0xEA, 0xA6, 0x8E, 0xA6, 0x72, 0x48, 0x77, 0xB2, 0xCD, 0x8D, 0xF3, 0x36,
+    0x64, 0x7B, 0xC9, 0x94, 0x53, 0x12, 0x40, 0x74, 0x3E, 0xAD, 0xB7, 0xB0, 0xA9, 0xE5, 0x5B, 0xDB,
+    0x04, 0x8A, 0xA4, 0x7C, 0xDB, 0xED, 0xB5, 0x5D, 0x9A, 0xE7, 0x7C, 0xA1, 0x6F, 0xEC, 0xB8, 0xAD,
+    0xBA, 0x76, 0x9B, 0xE5, 0x7C, 0xD3, 0x00, 0x7F, 0x7C, 0x41, 0x9F, 0xA4, 0xB5, 0x4D, 0xB7, 0xF3,
+    0x85, 0xC6, 0x74, 0xDA, 0x4D, 0x69, 0x23, 0x6E, 0xDC, 0xB4, 0xE2, 0xD6, 0x63, 0x21, 0x6C, 0xEB,
+    0xEF, 0x68, 0x01, 0x1E, 0xAD, 0xC0, 0x63, 0x29, 0x9C, 0x5C, 0x83, 0x3C, 0xB3, 0xC1, 0xCB, 0xB4,
+    0x55, 0x78, 0xFA, 0xD3, 0xDF, 0xD7, 0x01, 0xAC, 0xD9, 0xE9, 0x64, 0x24, 0x5C, 0x73, 0x34, 0xF9,
+    0xDB, 0x65, 0x92, 0x9D, 0x31, 0x92, 0xB4, 0xA6, 0x69, 0xFF, 0x4B, 0x12, 0x56, 0x39, 0xB2, 0x0B,
+    0xD5, 0xB8, 0x79, 0xF4, 0x72, 0x3A, 0x36, 0x2D, 0xDB, 0x9F, 0xB6, 0xB3, 0x61, 0x9B, 0xEA, 0xDF,
+    0x82, 0xBE, 0xA9, 0x5F, 0x8B, 0x49, 0xA5, 0x67, 0x10, 0x95, 0x46, 0xB2, 0x95, 0x72, 0x4D, 0xF4,
+    0x4E, 0xB3, 0x57, 0xEA, 0x8F, 0xA5, 0x7C, 0x6F, 0xD2, 0xEA, 0xAD, 0x14, 0x79, 0xAF, 0xD6, 0xE5,
+    0x71, 0x42, 0x3F, 0x3B, 0x0F, 0x7C, 0x62, 0xDB, 0x39, 0x7D, 0x05, 0xEA, 0x43, 0xD7, 0x80, 0xF5,
+    0x95, 0x87, 0x7F, 0x1E, 0xCA, 0x40, 0xA6, 0xF8, 0x09, 0xC5, 0x4C, 0xAA, 0xB4, 0x66, 0xCB, 0x85,
+    0xFF, 0x49, 0x3B, 0x7A, 0x9A, 0xB4, 0x2B, 0xA2, 0x0D, 0x94, 0x2B, 0xC5, 0x0C, 0x0A, 0xF9, 0x0A,
+    0x56, 0xF4, 0x0D, 0xF4, 0xA3, 0xF3, 0x50, 0x46, 0x1B, 0xA8, 0x50, 0x31, 0xDF, 0x62, 0x83, 0x7B,
+    0x41, 0xD5, 0x35, 0x5D, 0x1A, 0x5A, 0x8D, 0xBD, 0xC6, 0x4A, 0x63, 0xA1, 0x21, 0xD7, 0x21, 0xD9,
+    0xBE, 0x6B, 0xE1, 0xD3, 0x7B, 0x30, 0xBC, 0xDF, 0xD7, 0x69, 0xBF, 0xD1, 0x00, 0x77, 0x3D, 0x38,
+    0x02, 0xB9, 0xCF, 0x47, 0xE0, 0x2E, 0xB2, 0x11, 0xF2, 0xF8, 0xC7, 0xF9, 0x08, 0xB5, 0x64, 0x46,
+    0x72, 0x49, 0x76, 0xA4, 0x96, 0x62, 0x3D, 0xE6, 0x92, 0x42, 0x3F, 0xD6, 0x92, 0xBE, 0xA4, 0xD7,
+    0xA5, 0xB5, 0xB1, 0x7A, 0x43, 0xF2, 0xA4, 0x9E, 0xD8, 0x5A, 0xC1, 0x28, 0x96, 0x12, 0x46, 0xA1,
+    0x57, 0xC0, 0xE8, 0xE5, 0xFD, 0x9E, 0xC5, 0x01, 0x8C, 0xAE, 0x27, 0x56, 0xD0, 0xA6, 0x16, 0x71,
+    0x07, 0x60, 0xBE, 0x97, 0xF6, 0x53, 0xD2, 0xC9, 0xED, 0xF7, 0xCD, 0xF1, 0xBA, 0xF8, 0xFF, 0x00,
 };
 
 static const EpdGlyph bookerly_14_bolditalicGlyphs[] = {
@@ -2073,7 +2100,7 @@ static const EpdGlyph bookerly_14_bolditalicGlyphs[] = {
     { 10, 27, 9, -1, 23, 68, 8167 }, // |
     { 13, 29, 12, -2, 24, 95, 8235 }, // }
     { 14, 7, 18, 2, 13, 25, 8330 }, // ~
-    { 0, 0, 6, 0, 0, 0, 0 }, //  
+    { 0, 0, 6, 0, 0, 0, 8355 }, //  
     { 10, 23, 10, -1, 16, 58, 0 }, // ¡
     { 16, 29, 18, 1, 23, 116, 58 }, // ¢
     { 19, 22, 18, -1, 21, 105, 174 }, // £
@@ -2084,642 +2111,649 @@ static const EpdGlyph bookerly_14_bolditalicGlyphs[] = {
     { 10, 5, 18, 4, 23, 13, 597 }, // ¨
     { 22, 22, 23, 0, 21, 121, 610 }, // ©
     { 12, 15, 13, 1, 21, 45, 731 }, // ª
-    { 16, 12, 18, 1, 13, 48, 776 }, // «
-    { 14, 8, 18, 2, 14, 28, 824 }, // ¬
-    { 10, 5, 11, 1, 10, 13, 852 }, // ­
-    { 17, 16, 17, 0, 23, 68, 865 }, // ®
-    { 10, 3, 18, 4, 21, 8, 933 }, // ¯
-    { 11, 12, 15, 2, 21, 33, 941 }, // °
-    { 14, 18, 18, 2, 17, 63, 974 }, // ±
-    { 12, 14, 13, 0, 24, 42, 1037 }, // ²
-    { 11, 14, 13, 1, 24, 39, 1079 }, // ³
-    { 6, 8, 18, 6, 25, 12, 1118 }, // ´
-    { 20, 23, 18, -2, 16, 115, 1130 }, // µ
-    { 20, 26, 18, -1, 21, 130, 1245 }, // ¶
-    { 5, 6, 9, 2, 11, 8, 1375 }, // ·
-    { 7, 7, 18, 6, -1, 13, 1383 }, // ¸
-    { 9, 14, 13, 1, 24, 32, 1396 }, // ¹
-    { 12, 15, 13, 1, 21, 45, 1428 }, // º
-    { 17, 12, 18, 0, 13, 51, 1473 }, // »
-    { 30, 24, 31, 1, 22, 180, 1524 }, // ¼
-    { 30, 24, 31, 1, 22, 180, 1704 }, // ½
-    { 30, 24, 31, 1, 22, 180, 1884 }, // ¾
-    { 10, 23, 12, 0, 16, 58, 2064 }, // ¿
-    { 23, 29, 21, -2, 29, 167, 2122 }, // À
-    { 23, 29, 21, -2, 29, 167, 2289 }, // Á
-    { 23, 29, 21, -2, 29, 167, 2456 }, // Â
-    { 23, 28, 21, -2, 28, 161, 2623 }, // Ã
-    { 23, 27, 21, -2, 27, 156, 2784 }, // Ä
-    { 23, 29, 21, -2, 29, 167, 2940 }, // Å
-    { 31, 21, 27, -3, 21, 163, 3107 }, // Æ
-    { 19, 29, 19, 0, 21, 138, 3270 }, // Ç
-    { 21, 29, 18, -2, 29, 153, 3408 }, // È
-    { 21, 29, 18, -2, 29, 153, 3561 }, // É
-    { 21, 29, 18, -2, 29, 153, 3714 }, // Ê
-    { 21, 27, 18, -2, 27, 142, 3867 }, // Ë
-    { 15, 29, 12, -2, 29, 109, 4009 }, // Ì
-    { 15, 29, 12, -2, 29, 109, 4118 }, // Í
-    { 16, 29, 12, -2, 29, 116, 4227 }, // Î
-    { 16, 27, 12, -2, 27, 108, 4343 }, // Ï
-    { 22, 22, 21, -1, 21, 121, 4451 }, // Ð
-    { 25, 29, 22, -1, 28, 182, 4572 }, // Ñ
-    { 21, 30, 21, 0, 29, 158, 4754 }, // Ò
-    { 21, 30, 21, 0, 29, 158, 4912 }, // Ó
-    { 21, 30, 21, 0, 29, 158, 5070 }, // Ô
-    { 21, 29, 21, 0, 28, 153, 5228 }, // Õ
-    { 21, 28, 21, 0, 27, 147, 5381 }, // Ö
-    { 13, 13, 18, 3, 16, 43, 5528 }, // ×
-    { 24, 23, 21, -1, 22, 138, 5571 }, // Ø
-    { 22, 30, 23, 2, 29, 165, 5709 }, // Ù
-    { 22, 30, 23, 2, 29, 165, 5874 }, // Ú
-    { 22, 30, 23, 2, 29, 165, 6039 }, // Û
-    { 22, 28, 23, 2, 27, 154, 6204 }, // Ü
-    { 21, 29, 19, 1, 29, 153, 6358 }, // Ý
-    { 19, 21, 17, -2, 21, 100, 6511 }, // Þ
-    { 24, 30, 19, -6, 23, 180, 6611 }, // ß
-    { 17, 26, 17, 0, 25, 111, 6791 }, // à
-    { 17, 26, 17, 0, 25, 111, 6902 }, // á
-    { 17, 25, 17, 0, 24, 107, 7013 }, // â
-    { 17, 24, 17, 0, 23, 102, 7120 }, // ã
-    { 17, 24, 17, 0, 23, 102, 7222 }, // ä
-    { 17, 26, 17, 0, 25, 111, 7324 }, // å
-    { 23, 17, 23, 0, 16, 98, 7435 }, // æ
-    { 13, 24, 13, 0, 16, 78, 7533 }, // ç
-    { 14, 26, 14, 0, 25, 91, 7611 }, // è
-    { 15, 26, 14, 0, 25, 98, 7702 }, // é
-    { 14, 25, 14, 0, 24, 88, 7800 }, // ê
-    { 15, 24, 14, 0, 23, 90, 7888 }, // ë
-    { 8, 26, 9, 1, 25, 52, 7978 }, // ì
-    { 11, 26, 9, 1, 25, 72, 8030 }, // í
-    { 11, 25, 9, 1, 24, 69, 8102 }, // î
-    { 11, 24, 9, 1, 23, 66, 8171 }, // ï
-    { 16, 25, 16, 0, 24, 100, 8237 }, // ð
-    { 18, 24, 18, 0, 23, 108, 8337 }, // ñ
-    { 15, 26, 16, 0, 25, 98, 8445 }, // ò
-    { 16, 26, 16, 0, 25, 104, 8543 }, // ó
-    { 15, 25, 16, 0, 24, 94, 8647 }, // ô
-    { 16, 24, 16, 0, 23, 96, 8741 }, // õ
-    { 16, 24, 16, 0, 23, 96, 8837 }, // ö
-    { 14, 14, 18, 2, 17, 49, 8933 }, // ÷
-    { 19, 17, 16, -2, 16, 81, 8982 }, // ø
-    { 18, 26, 18, 0, 25, 117, 9063 }, // ù
-    { 18, 26, 18, 0, 25, 117, 9180 }, // ú
-    { 18, 25, 18, 0, 24, 113, 9297 }, // û
-    { 18, 24, 18, 0, 23, 108, 9410 }, // ü
-    { 20, 32, 15, -5, 25, 160, 9518 }, // ý
-    { 19, 30, 16, -3, 23, 143, 9678 }, // þ
-    { 20, 30, 15, -5, 23, 150, 9821 }, // ÿ
-    { 23, 26, 21, -2, 26, 150, 0 }, // Ā
-    { 17, 22, 17, 0, 21, 94, 150 }, // ā
-    { 23, 28, 21, -2, 28, 161, 244 }, // Ă
-    { 17, 24, 17, 0, 23, 102, 405 }, // ă
-    { 23, 28, 21, -2, 21, 161, 507 }, // Ą
-    { 17, 23, 17, 0, 16, 98, 668 }, // ą
-    { 19, 30, 19, 0, 29, 143, 766 }, // Ć
-    { 15, 26, 13, 0, 25, 98, 909 }, // ć
-    { 19, 30, 19, 0, 29, 143, 1007 }, // Ĉ
-    { 14, 25, 13, 0, 24, 88, 1150 }, // ĉ
-    { 19, 29, 19, 0, 28, 138, 1238 }, // Ċ
-    { 13, 24, 13, 0, 23, 78, 1376 }, // ċ
-    { 20, 30, 19, 0, 29, 150, 1454 }, // Č
-    { 15, 26, 13, 0, 25, 98, 1604 }, // č
-    { 22, 30, 21, -1, 29, 165, 1702 }, // Ď
-    { 22, 24, 18, 0, 23, 132, 1867 }, // ď
-    { 22, 22, 21, -1, 21, 121, 1999 }, // Đ
-    { 19, 24, 17, 0, 23, 114, 2120 }, // đ
-    { 21, 26, 18, -2, 26, 137, 2234 }, // Ē
-    { 15, 22, 14, 0, 21, 83, 2371 }, // ē
-    { 21, 28, 18, -2, 28, 147, 2454 }, // Ĕ
-    { 15, 24, 14, 0, 23, 90, 2601 }, // ĕ
-    { 21, 28, 18, -2, 28, 147, 2691 }, // Ė
-    { 14, 24, 14, 0, 23, 84, 2838 }, // ė
-    { 21, 28, 18, -2, 21, 147, 2922 }, // Ę
-    { 14, 23, 14, 0, 16, 81, 3069 }, // ę
-    { 21, 29, 18, -2, 29, 153, 3150 }, // Ě
-    { 15, 26, 14, 0, 25, 98, 3303 }, // ě
-    { 20, 30, 21, 0, 29, 150, 3401 }, // Ĝ
-    { 20, 31, 15, -2, 24, 155, 3551 }, // ĝ
-    { 20, 29, 21, 0, 28, 145, 3706 }, // Ğ
-    { 20, 30, 15, -2, 23, 150, 3851 }, // ğ
-    { 20, 29, 21, 0, 28, 145, 4001 }, // Ġ
-    { 20, 30, 15, -2, 23, 150, 4146 }, // ġ
-    { 20, 29, 21, 0, 21, 145, 4296 }, // Ģ
-    { 20, 32, 15, -2, 25, 160, 4441 }, // ģ
-    { 27, 29, 23, -2, 29, 196, 4601 }, // Ĥ
-    { 17, 31, 17, 0, 30, 132, 4797 }, // ĥ
-    { 27, 21, 23, -2, 21, 142, 4929 }, // Ħ
-    { 17, 24, 17, 0, 23, 102, 5071 }, // ħ
-    { 16, 28, 12, -2, 28, 112, 5173 }, // Ĩ
-    { 12, 24, 9, 1, 23, 72, 5285 }, // ĩ
-    { 16, 26, 12, -2, 26, 104, 5357 }, // Ī
-    { 11, 22, 9, 1, 21, 61, 5461 }, // ī
-    { 16, 28, 12, -2, 28, 112, 5522 }, // Ĭ
-    { 11, 24, 9, 1, 23, 66, 5634 }, // ĭ
-    { 15, 28, 12, -2, 21, 105, 5700 }, // Į
-    { 9, 30, 9, 1, 23, 68, 5805 }, // į
-    { 15, 28, 12, -2, 28, 105, 5873 }, // İ
-    { 8, 17, 9, 1, 16, 34, 5978 }, // ı
-    { 27, 27, 23, -2, 21, 183, 6012 }, // Ĳ
-    { 19, 30, 19, 1, 23, 143, 6195 }, // ĳ
-    { 20, 35, 11, -6, 29, 175, 6338 }, // Ĵ
-    { 18, 31, 9, -6, 24, 140, 6513 }, // ĵ
-    { 24, 29, 21, -2, 21, 174, 6653 }, // Ķ
-    { 15, 31, 15, 0, 23, 117, 6827 }, // ķ
-    { 16, 17, 17, 0, 16, 68, 6944 }, // ĸ
-    { 18, 29, 17, -2, 29, 131, 7012 }, // Ĺ
-    { 12, 31, 9, 0, 30, 93, 7143 }, // ĺ
-    { 18, 29, 17, -2, 21, 131, 7236 }, // Ļ
-    { 10, 31, 9, -1, 23, 78, 7367 }, // ļ
-    { 19, 23, 17, -2, 23, 110, 7445 }, // Ľ
-    { 14, 24, 10, 0, 23, 84, 7555 }, // ľ
-    { 19, 21, 17, -2, 21, 100, 7639 }, // Ŀ
-    { 14, 24, 12, 0, 23, 84, 7739 }, // ŀ
-    { 18, 21, 17, -2, 21, 95, 7823 }, // Ł
-    { 12, 24, 9, -1, 23, 72, 7918 }, // ł
-    { 25, 30, 22, -1, 29, 188, 7990 }, // Ń
-    { 18, 26, 18, 0, 25, 117, 8178 }, // ń
-    { 25, 29, 22, -1, 21, 182, 8295 }, // Ņ
-    { 18, 24, 18, 0, 16, 108, 8477 }, // ņ
-    { 25, 30, 22, -1, 29, 188, 8585 }, // Ň
-    { 18, 26, 18, 0, 25, 117, 8773 }, // ň
-    { 23, 23, 24, 1, 22, 133, 8890 }, // ŉ
-    { 25, 27, 22, -1, 21, 169, 9023 }, // Ŋ
-    { 16, 23, 17, 0, 16, 92, 9192 }, // ŋ
-    { 21, 27, 21, 0, 26, 142, 9284 }, // Ō
-    { 16, 22, 16, 0, 21, 88, 9426 }, // ō
-    { 21, 29, 21, 0, 28, 153, 9514 }, // Ŏ
-    { 16, 24, 16, 0, 23, 96, 9667 }, // ŏ
-    { 22, 30, 21, 0, 29, 165, 9763 }, // Ő
-    { 17, 26, 16, 0, 25, 111, 9928 }, // ő
-    { 29, 22, 29, 0, 21, 160, 10039 }, // Œ
-    { 24, 17, 24, 0, 16, 102, 10199 }, // œ
-    { 21, 30, 20, -2, 29, 158, 10301 }, // Ŕ
-    { 15, 25, 14, 0, 25, 94, 10459 }, // ŕ
-    { 21, 29, 20, -2, 21, 153, 10553 }, // Ŗ
-    { 16, 24, 14, -1, 16, 96, 10706 }, // ŗ
-    { 21, 30, 20, -2, 29, 158, 10802 }, // Ř
-    { 15, 25, 14, 0, 25, 94, 10960 }, // ř
-    { 17, 30, 16, -1, 29, 128, 11054 }, // Ś
-    { 15, 26, 13, -1, 25, 98, 11182 }, // ś
-    { 17, 30, 16, -1, 29, 128, 11280 }, // Ŝ
-    { 15, 25, 13, -1, 24, 94, 11408 }, // ŝ
-    { 17, 29, 16, -1, 21, 124, 11502 }, // Ş
-    { 14, 24, 13, -1, 16, 84, 11626 }, // ş
-    { 18, 30, 16, -1, 29, 135, 11710 }, // Š
-    { 16, 26, 13, -1, 25, 104, 11845 }, // š
-    { 20, 29, 19, 1, 21, 145, 11949 }, // Ţ
-    { 13, 27, 12, 0, 19, 88, 12094 }, // ţ
-    { 20, 29, 19, 1, 29, 145, 12182 }, // Ť
-    { 15, 25, 12, 0, 24, 94, 12327 }, // ť
-    { 20, 21, 19, 1, 21, 105, 12421 }, // Ŧ
-    { 13, 20, 12, 0, 19, 65, 12526 }, // ŧ
-    { 22, 29, 23, 2, 28, 160, 12591 }, // Ũ
-    { 18, 24, 18, 0, 23, 108, 12751 }, // ũ
-    { 22, 27, 23, 2, 26, 149, 12859 }, // Ū
-    { 18, 22, 18, 0, 21, 99, 13008 }, // ū
-    { 22, 29, 23, 2, 28, 160, 13107 }, // Ŭ
-    { 18, 24, 18, 0, 23, 108, 13267 }, // ŭ
-    { 22, 30, 23, 2, 29, 165, 13375 }, // Ů
-    { 18, 26, 18, 0, 25, 117, 13540 }, // ů
-    { 22, 30, 23, 2, 29, 165, 13657 }, // Ű
-    { 18, 26, 18, 0, 25, 117, 13822 }, // ű
-    { 22, 28, 23, 2, 21, 154, 13939 }, // Ų
-    { 18, 23, 18, 0, 16, 104, 14093 }, // ų
-    { 29, 30, 29, 2, 29, 218, 14197 }, // Ŵ
-    { 22, 25, 22, 0, 24, 138, 14415 }, // ŵ
-    { 21, 29, 19, 1, 29, 153, 14553 }, // Ŷ
-    { 20, 31, 15, -5, 24, 155, 14706 }, // ŷ
-    { 21, 27, 19, 1, 27, 142, 14861 }, // Ÿ
-    { 19, 30, 18, -1, 29, 143, 15003 }, // Ź
-    { 15, 26, 14, -1, 25, 98, 15146 }, // ź
-    { 19, 29, 18, -1, 28, 138, 15244 }, // Ż
-    { 15, 24, 14, -1, 23, 90, 15382 }, // ż
-    { 19, 30, 18, -1, 29, 143, 15472 }, // Ž
-    { 15, 26, 14, -1, 25, 98, 15615 }, // ž
-    { 22, 30, 12, -6, 23, 165, 15713 }, // ſ
-    { 7, 8, 0, -5, 25, 14, 0 }, // ̀
-    { 6, 8, 0, -2, 25, 12, 14 }, // ́
-    { 11, 7, 0, -6, 24, 20, 26 }, // ̂
-    { 10, 5, 0, -5, 23, 13, 46 }, // ̃
-    { 10, 3, 0, -5, 21, 8, 59 }, // ̄
-    { 10, 6, 0, -5, 23, 15, 67 }, // ̆
-    { 6, 5, 0, -3, 23, 8, 82 }, // ̇
-    { 10, 5, 0, -5, 23, 13, 90 }, // ̈
-    { 9, 9, 0, -4, 26, 21, 103 }, // ̉
-    { 8, 9, 0, -4, 25, 18, 124 }, // ̊
-    { 12, 8, 0, -5, 25, 24, 142 }, // ̋
-    { 11, 8, 0, -5, 25, 22, 166 }, // ̌
-    { 9, 7, 0, -6, 24, 16, 188 }, // ̏
-    { 10, 6, 0, -5, 23, 15, 204 }, // ̑
-    { 6, 8, 0, -3, 25, 12, 219 }, // ̒
-    { 7, 9, 0, -3, 26, 16, 231 }, // ̓
-    { 6, 9, 0, -4, 26, 14, 247 }, // ̔
-    { 5, 8, 0, -3, 25, 10, 261 }, // ̕
-    { 6, 7, 0, -3, 19, 11, 271 }, // ̛
-    { 6, 5, 0, -3, -2, 8, 282 }, // ̣
-    { 10, 5, 0, -5, -2, 13, 290 }, // ̤
-    { 8, 7, 0, -4, -1, 14, 303 }, // ̥
-    { 6, 7, 0, -3, -1, 11, 317 }, // ̦
-    { 7, 7, 0, -4, -1, 13, 328 }, // ̧
-    { 6, 8, 0, -3, 1, 12, 341 }, // ̨
-    { 5, 8, 8, -1, -1, 10, 353 }, // ̩
-    { 11, 7, 0, -6, -1, 20, 363 }, // ̭
-    { 10, 7, 0, -5, -1, 18, 383 }, // ̮
-    { 10, 6, 0, -5, -2, 15, 401 }, // ̰
-    { 10, 3, 0, -5, -3, 8, 416 }, // ̱
-    { 10, 6, 0, -5, 23, 15, 424 }, // ͂
-    { 11, 12, 0, -6, 30, 33, 439 }, // ̈́
-    { 6, 6, 0, -2, -2, 9, 472 }, // ͅ
-    { 21, 29, 18, -2, 29, 153, 0 }, // Ѐ
-    { 21, 27, 18, -2, 27, 142, 153 }, // Ё
-    { 20, 27, 22, 1, 21, 135, 295 }, // Ђ
-    { 20, 29, 17, -2, 29, 145, 430 }, // Ѓ
-    { 19, 22, 19, 0, 21, 105, 575 }, // Є
-    { 17, 22, 16, -1, 21, 94, 680 }, // Ѕ
-    { 15, 21, 12, -2, 21, 79, 774 }, // І
-    { 16, 27, 12, -2, 27, 108, 853 }, // Ї
-    { 19, 27, 11, -6, 21, 129, 961 }, // Ј
-    { 28, 22, 27, -2, 21, 154, 1090 }, // Љ
-    { 29, 22, 28, -2, 21, 160, 1244 }, // Њ
-    { 22, 21, 25, 1, 21, 116, 1404 }, // Ћ
-    { 24, 30, 20, -2, 29, 180, 1520 }, // Ќ
-    { 27, 29, 23, -2, 29, 196, 1700 }, // Ѝ
-    { 21, 30, 19, 1, 29, 158, 1896 }, // Ў
-    { 26, 28, 22, -2, 21, 182, 2054 }, // Џ
-    { 23, 21, 21, -2, 21, 121, 2236 }, // А
-    { 20, 22, 18, -2, 21, 110, 2357 }, // Б
-    { 19, 22, 18, -2, 21, 105, 2467 }, // В
-    { 20, 21, 17, -2, 21, 105, 2572 }, // Г
-    { 25, 27, 22, -2, 21, 169, 2677 }, // Д
-    { 21, 21, 18, -2, 21, 111, 2846 }, // Е
-    { 33, 22, 28, -3, 21, 182, 2957 }, // Ж
-    { 17, 22, 17, -1, 21, 94, 3139 }, // З
-    { 27, 21, 23, -2, 21, 142, 3233 }, // И
-    { 27, 29, 23, -2, 29, 196, 3375 }, // Й
-    { 24, 22, 20, -2, 21, 132, 3571 }, // К
-    { 25, 22, 21, -2, 21, 138, 3703 }, // Л
-    { 28, 21, 26, -2, 21, 147, 3841 }, // М
-    { 27, 21, 23, -2, 21, 142, 3988 }, // Н
-    { 21, 22, 21, 0, 21, 116, 4130 }, // О
-    { 26, 21, 23, -2, 21, 137, 4246 }, // П
-    { 20, 21, 18, -2, 21, 105, 4383 }, // Р
-    { 19, 22, 19, 0, 21, 105, 4488 }, // С
-    { 20, 21, 19, 1, 21, 105, 4593 }, // Т
-    { 21, 22, 19, 1, 21, 116, 4698 }, // У
-    { 22, 22, 22, 0, 21, 121, 4814 }, // Ф
-    { 24, 21, 19, -3, 21, 126, 4935 }, // Х
-    { 26, 27, 22, -2, 21, 176, 5061 }, // Ц
-    { 21, 21, 21, 1, 21, 111, 5237 }, // Ч
-    { 33, 21, 29, -2, 21, 174, 5348 }, // Ш
-    { 33, 27, 29, -2, 21, 223, 5522 }, // Щ
-    { 19, 22, 21, 1, 21, 105, 5745 }, // Ъ
-    { 31, 22, 27, -2, 21, 171, 5850 }, // Ы
-    { 19, 22, 18, -2, 21, 105, 6021 }, // Ь
-    { 19, 22, 18, -1, 21, 105, 6126 }, // Э
-    { 32, 22, 30, -2, 21, 176, 6231 }, // Ю
-    { 23, 22, 19, -2, 21, 127, 6407 }, // Я
-    { 17, 17, 17, 0, 16, 73, 6534 }, // а
-    { 18, 25, 16, 0, 24, 113, 6607 }, // б
-    { 15, 17, 15, 0, 16, 64, 6720 }, // в
-    { 13, 17, 13, 0, 16, 56, 6784 }, // г
-    { 16, 24, 16, 0, 23, 96, 6840 }, // д
-    { 14, 17, 14, 0, 16, 60, 6936 }, // е
-    { 26, 17, 26, 0, 16, 111, 6996 }, // ж
-    { 14, 17, 13, -1, 16, 60, 7107 }, // з
-    { 18, 17, 18, 0, 16, 77, 7167 }, // и
-    { 18, 25, 18, 0, 24, 113, 7244 }, // й
-    { 17, 17, 17, 0, 16, 73, 7357 }, // к
-    { 19, 17, 18, -1, 16, 81, 7430 }, // л
-    { 24, 17, 23, -1, 16, 102, 7511 }, // м
-    { 18, 17, 18, 0, 16, 77, 7613 }, // н
-    { 15, 17, 16, 0, 16, 64, 7690 }, // о
-    { 18, 17, 18, 0, 16, 77, 7754 }, // п
-    { 19, 23, 17, -3, 16, 110, 7831 }, // р
-    { 13, 17, 13, 0, 16, 56, 7941 }, // с
-    { 25, 17, 25, 0, 16, 107, 7997 }, // т
-    { 20, 23, 15, -5, 16, 115, 8104 }, // у
-    { 20, 30, 21, 0, 23, 150, 8219 }, // ф
-    { 18, 17, 17, -1, 16, 77, 8369 }, // х
-    { 18, 22, 18, 0, 16, 99, 8446 }, // ц
-    { 17, 17, 18, 0, 16, 73, 8545 }, // ч
-    { 24, 17, 24, 0, 16, 102, 8618 }, // ш
-    { 24, 22, 24, 0, 16, 132, 8720 }, // щ
-    { 16, 17, 16, 0, 16, 68, 8852 }, // ъ
-    { 22, 17, 23, 0, 16, 94, 8920 }, // ы
-    { 14, 17, 15, 0, 16, 60, 9014 }, // ь
-    { 15, 17, 14, -1, 16, 64, 9074 }, // э
-    { 23, 17, 23, 0, 16, 98, 9138 }, // ю
-    { 17, 17, 17, 0, 16, 73, 9236 }, // я
-    { 14, 26, 14, 0, 25, 91, 9309 }, // ѐ
-    { 15, 24, 14, 0, 23, 90, 9400 }, // ё
-    { 16, 30, 17, 0, 23, 120, 9490 }, // ђ
-    { 14, 26, 13, 0, 25, 91, 9610 }, // ѓ
-    { 14, 17, 14, 0, 16, 60, 9701 }, // є
-    { 14, 17, 13, -1, 16, 60, 9761 }, // ѕ
-    { 9, 24, 9, 1, 23, 54, 9821 }, // і
-    { 11, 24, 9, 1, 23, 66, 9875 }, // ї
-    { 16, 30, 9, -6, 23, 120, 9941 }, // ј
-    { 24, 17, 23, -1, 16, 102, 10061 }, // љ
-    { 22, 17, 22, 0, 16, 94, 10163 }, // њ
-    { 17, 24, 17, 0, 23, 102, 10257 }, // ћ
-    { 17, 26, 17, 0, 25, 111, 10359 }, // ќ
-    { 18, 26, 18, 0, 25, 117, 10470 }, // ѝ
-    { 20, 31, 15, -5, 24, 155, 10587 }, // ў
-    { 18, 22, 18, 0, 16, 99, 10742 }, // џ
-    { 19, 24, 21, 1, 23, 114, 10841 }, // Ѣ
-    { 22, 17, 23, 0, 16, 94, 10955 }, // ѣ
-    { 21, 22, 21, 0, 21, 116, 11049 }, // Ѳ
-    { 15, 17, 16, 0, 16, 64, 11165 }, // ѳ
-    { 23, 22, 22, 1, 21, 127, 11229 }, // Ѵ
-    { 19, 17, 17, -1, 16, 81, 11356 }, // ѵ
-    { 27, 35, 24, -2, 29, 237, 11437 }, // Ҋ
-    { 18, 30, 18, 0, 24, 135, 11674 }, // ҋ
-    { 19, 22, 18, -2, 21, 105, 11809 }, // Ҍ
-    { 13, 22, 15, 1, 21, 72, 11914 }, // ҍ
-    { 20, 21, 18, -2, 21, 105, 11986 }, // Ҏ
-    { 19, 23, 17, -3, 16, 110, 12091 }, // ҏ
-    { 20, 25, 17, -2, 25, 125, 12201 }, // Ґ
-    { 15, 21, 14, 0, 20, 79, 12326 }, // ґ
-    { 20, 21, 17, -2, 21, 105, 12405 }, // Ғ
-    { 13, 17, 13, 0, 16, 56, 12510 }, // ғ
-    { 20, 27, 19, -2, 21, 135, 12566 }, // Ҕ
-    { 15, 23, 16, 0, 16, 87, 12701 }, // ҕ
-    { 33, 27, 28, -3, 21, 223, 12788 }, // Җ
-    { 26, 22, 26, 0, 16, 143, 13011 }, // җ
-    { 17, 27, 17, -1, 21, 115, 13154 }, // Ҙ
-    { 14, 22, 13, -1, 16, 77, 13269 }, // ҙ
-    { 24, 27, 20, -2, 21, 162, 13346 }, // Қ
-    { 17, 22, 17, 0, 16, 94, 13508 }, // қ
-    { 25, 22, 21, -2, 21, 138, 13602 }, // Ҝ
-    { 19, 17, 19, 0, 16, 81, 13740 }, // ҝ
-    { 24, 22, 20, -2, 21, 132, 13821 }, // Ҟ
-    { 16, 23, 16, 0, 22, 92, 13953 }, // ҟ
-    { 25, 22, 24, 1, 21, 138, 14045 }, // Ҡ
-    { 19, 17, 19, 0, 16, 81, 14183 }, // ҡ
-    { 27, 27, 23, -2, 21, 183, 14264 }, // Ң
-    { 18, 22, 19, 0, 16, 99, 14447 }, // ң
-    { 31, 21, 27, -2, 21, 163, 14546 }, // Ҥ
-    { 23, 17, 22, 0, 16, 98, 14709 }, // ҥ
-    { 31, 27, 30, -2, 21, 210, 14807 }, // Ҧ
-    { 24, 23, 24, 0, 16, 138, 15017 }, // ҧ
-    { 24, 22, 24, 0, 21, 132, 15155 }, // Ҩ
-    { 19, 17, 19, 0, 16, 81, 15287 }, // ҩ
-    { 19, 27, 19, 0, 21, 129, 15368 }, // Ҫ
-    { 13, 22, 13, 0, 16, 72, 15497 }, // ҫ
-    { 20, 27, 19, 1, 21, 135, 15569 }, // Ҭ
-    { 26, 22, 26, 0, 16, 143, 15704 }, // ҭ
-    { 21, 21, 19, 1, 21, 111, 15847 }, // Ү
-    { 15, 23, 15, 0, 16, 87, 15958 }, // ү
-    { 21, 21, 19, 1, 21, 111, 16045 }, // Ұ
-    { 15, 23, 15, 0, 16, 87, 16156 }, // ұ
-    { 24, 27, 19, -3, 21, 162, 16243 }, // Ҳ
-    { 18, 22, 17, -1, 16, 99, 16405 }, // ҳ
-    { 27, 27, 27, 1, 21, 183, 16504 }, // Ҵ
-    { 18, 27, 18, 0, 21, 122, 16687 }, // ҵ
-    { 21, 27, 21, 1, 21, 142, 16809 }, // Ҷ
-    { 17, 22, 18, 0, 16, 94, 16951 }, // ҷ
-    { 22, 21, 21, 1, 21, 116, 17045 }, // Ҹ
-    { 17, 17, 18, 0, 16, 73, 17161 }, // ҹ
-    { 21, 21, 21, -2, 21, 111, 17234 }, // Һ
-    { 17, 24, 17, 0, 23, 102, 17345 }, // һ
-    { 22, 22, 24, 1, 21, 121, 17447 }, // Ҽ
-    { 17, 17, 17, 0, 16, 73, 17568 }, // ҽ
-    { 22, 28, 24, 1, 21, 154, 17641 }, // Ҿ
-    { 17, 22, 17, 0, 16, 94, 17795 }, // ҿ
-    { 15, 21, 12, -2, 21, 79, 17889 }, // Ӏ
-    { 33, 30, 28, -3, 29, 248, 17968 }, // Ӂ
-    { 26, 25, 26, 0, 24, 163, 18216 }, // ӂ
-    { 24, 27, 21, -2, 21, 162, 18379 }, // Ӄ
-    { 17, 23, 17, 0, 16, 98, 18541 }, // ӄ
-    { 25, 27, 21, -2, 21, 169, 18639 }, // Ӆ
-    { 19, 22, 18, -1, 16, 105, 18808 }, // ӆ
-    { 27, 27, 23, -2, 21, 183, 18913 }, // Ӈ
-    { 17, 23, 17, 0, 16, 98, 19096 }, // ӈ
-    { 27, 27, 23, -2, 21, 183, 19194 }, // Ӊ
-    { 18, 22, 18, 0, 16, 99, 19377 }, // ӊ
-    { 21, 27, 21, 1, 21, 142, 19476 }, // Ӌ
-    { 17, 22, 17, 0, 16, 94, 19618 }, // ӌ
-    { 28, 27, 27, -2, 21, 189, 19712 }, // Ӎ
-    { 24, 22, 23, -1, 16, 132, 19901 }, // ӎ
-    { 14, 23, 11, -1, 23, 81, 20033 }, // ӏ
-    { 23, 29, 21, -2, 29, 167, 20114 }, // Ӑ
-    { 17, 25, 17, 0, 24, 107, 20281 }, // ӑ
-    { 23, 27, 21, -2, 27, 156, 20388 }, // Ӓ
-    { 17, 24, 17, 0, 23, 102, 20544 }, // ӓ
-    { 31, 21, 27, -3, 21, 163, 20646 }, // Ӕ
-    { 23, 17, 23, 0, 16, 98, 20809 }, // ӕ
-    { 21, 29, 18, -2, 29, 153, 20907 }, // Ӗ
-    { 15, 25, 14, 0, 24, 94, 21060 }, // ӗ
-    { 19, 22, 19, 0, 21, 105, 21154 }, // Ә
-    { 14, 17, 14, 0, 16, 60, 21259 }, // ә
-    { 19, 28, 19, 0, 27, 133, 21319 }, // Ӛ
-    { 14, 24, 14, 0, 23, 84, 21452 }, // ӛ
-    { 33, 28, 28, -3, 27, 231, 21536 }, // Ӝ
-    { 26, 24, 26, 0, 23, 156, 21767 }, // ӝ
-    { 17, 28, 17, -1, 27, 119, 21923 }, // Ӟ
-    { 15, 24, 13, -1, 23, 90, 22042 }, // ӟ
-    { 18, 22, 16, -1, 21, 99, 22132 }, // Ӡ
-    { 18, 23, 15, -2, 16, 104, 22231 }, // ӡ
-    { 27, 26, 23, -2, 26, 176, 22335 }, // Ӣ
-    { 18, 22, 18, 0, 21, 99, 22511 }, // ӣ
-    { 27, 27, 23, -2, 27, 183, 22610 }, // Ӥ
-    { 18, 24, 18, 0, 23, 108, 22793 }, // ӥ
-    { 21, 28, 21, 0, 27, 147, 22901 }, // Ӧ
-    { 16, 24, 16, 0, 23, 96, 23048 }, // ӧ
-    { 21, 22, 21, 0, 21, 116, 23144 }, // Ө
-    { 15, 17, 16, 0, 16, 64, 23260 }, // ө
-    { 21, 28, 21, 0, 27, 147, 23324 }, // Ӫ
-    { 16, 24, 16, 0, 23, 96, 23471 }, // ӫ
-    { 19, 28, 18, -1, 27, 133, 23567 }, // Ӭ
-    { 15, 24, 14, -1, 23, 90, 23700 }, // ӭ
-    { 21, 27, 19, 1, 26, 142, 23790 }, // Ӯ
-    { 20, 28, 15, -5, 21, 140, 23932 }, // ӯ
-    { 21, 28, 19, 1, 27, 147, 24072 }, // Ӱ
-    { 20, 30, 15, -5, 23, 150, 24219 }, // ӱ
-    { 21, 30, 19, 1, 29, 158, 24369 }, // Ӳ
-    { 20, 32, 15, -5, 25, 160, 24527 }, // ӳ
-    { 21, 27, 21, 1, 27, 142, 24687 }, // Ӵ
-    { 17, 24, 18, 0, 23, 102, 24829 }, // ӵ
-    { 20, 27, 17, -2, 21, 135, 24931 }, // Ӷ
-    { 13, 22, 13, 0, 16, 72, 25066 }, // ӷ
-    { 31, 28, 27, -2, 27, 217, 25138 }, // Ӹ
-    { 22, 24, 23, 0, 23, 132, 25355 }, // ӹ
-    { 20, 27, 17, -2, 21, 135, 25487 }, // Ӻ
-    { 13, 22, 13, 0, 16, 72, 25622 }, // ӻ
-    { 24, 27, 19, -3, 21, 162, 25694 }, // Ӽ
-    { 18, 23, 17, -1, 16, 104, 25856 }, // ӽ
-    { 24, 21, 19, -3, 21, 126, 25960 }, // Ӿ
-    { 18, 17, 17, -1, 16, 77, 26086 }, // ӿ
-    { 0, 0, 15, 0, 0, 0, 0 }, //  
-    { 0, 0, 29, 0, 0, 0, 0 }, //  
-    { 0, 0, 15, 0, 0, 0, 0 }, //  
-    { 0, 0, 29, 0, 0, 0, 0 }, //  
-    { 0, 0, 10, 0, 0, 0, 0 }, //  
-    { 0, 0, 7, 0, 0, 0, 0 }, //  
-    { 0, 0, 5, 0, 0, 0, 0 }, //  
-    { 0, 0, 18, 0, 0, 0, 0 }, //  
-    { 0, 0, 9, 0, 0, 0, 0 }, //  
-    { 0, 0, 6, 0, 0, 0, 0 }, //  
-    { 0, 0, 1, 0, 0, 0, 0 }, //  
-    { 0, 0, 0, 0, 0, 0, 0 }, // ​
-    { 2, 24, 0, -1, 17, 12, 0 }, // ‌
-    { 6, 26, 0, -3, 19, 39, 12 }, // ‍
-    { 10, 28, 0, -5, 21, 70, 51 }, // ‎
-    { 10, 28, 0, -5, 21, 70, 121 }, // ‏
-    { 10, 5, 11, 1, 10, 13, 191 }, // ‐
-    { 10, 5, 11, 1, 10, 13, 204 }, // ‑
-    { 14, 3, 18, 2, 11, 11, 217 }, // ‒
-    { 15, 3, 15, 0, 9, 12, 228 }, // –
-    { 29, 3, 29, 0, 9, 22, 240 }, // —
-    { 29, 3, 29, 0, 9, 22, 262 }, // ―
-    { 11, 30, 15, 2, 23, 83, 284 }, // ‖
-    { 15, 8, 15, 0, -1, 30, 367 }, // ‗
-    { 7, 10, 9, 2, 22, 18, 397 }, // ‘
-    { 8, 10, 9, 1, 22, 20, 415 }, // ’
-    { 7, 10, 9, 0, 4, 18, 435 }, // ‚
-    { 7, 10, 9, 1, 22, 18, 453 }, // ‛
-    { 13, 10, 15, 2, 22, 33, 471 }, // “
-    { 14, 10, 15, 1, 22, 35, 504 }, // ”
-    { 13, 10, 15, 0, 4, 33, 539 }, // „
-    { 13, 10, 15, 1, 22, 33, 572 }, // ‟
-    { 13, 19, 14, 1, 21, 62, 605 }, // †
-    { 15, 23, 14, -1, 21, 87, 667 }, // ‡
-    { 7, 7, 9, 1, 11, 13, 754 }, // •
-    { 10, 10, 18, 4, 15, 25, 767 }, // ‣
-    { 6, 6, 8, 1, 5, 9, 792 }, // ․
-    { 13, 6, 15, 1, 5, 20, 801 }, // ‥
-    { 25, 6, 29, 2, 5, 38, 821 }, // …
-    { 6, 6, 8, 1, 11, 9, 859 }, // ‧
-    { 0, 0, 0, 0, 0, 0, 868 }, //  
-    { 0, 0, 0, 0, 0, 0, 868 }, //  
-    { 10, 28, 0, -5, 21, 70, 868 }, // ‪
-    { 10, 28, 0, -5, 21, 70, 938 }, // ‫
-    { 10, 27, 0, -5, 20, 68, 1008 }, // ‬
-    { 12, 28, 0, -6, 21, 84, 1076 }, // ‭
-    { 12, 28, 0, -6, 21, 84, 1160 }, // ‮
-    { 0, 0, 3, 0, 0, 0, 1244 }, //  
-    { 39, 24, 41, 1, 22, 234, 1244 }, // ‰
-    { 7, 11, 7, 0, 21, 20, 1478 }, // ′
-    { 13, 11, 13, 0, 21, 36, 1498 }, // ″
-    { 20, 11, 20, 0, 21, 55, 1534 }, // ‴
-    { 7, 11, 7, 0, 21, 20, 1589 }, // ‵
-    { 13, 11, 14, 0, 21, 36, 1609 }, // ‶
-    { 20, 11, 20, 0, 21, 55, 1645 }, // ‷
-    { 13, 6, 14, 1, 0, 20, 1700 }, // ‸
-    { 9, 12, 10, 1, 13, 27, 1720 }, // ‹
-    { 10, 12, 10, 0, 13, 30, 1747 }, // ›
-    { 18, 20, 18, 0, 19, 90, 1777 }, // ※
-    { 17, 23, 18, 1, 22, 98, 1867 }, // ‼
-    { 15, 4, 15, 0, 25, 15, 1965 }, // ‾
-    { 7, 5, 9, 1, 10, 9, 1980 }, // ⁃
-    { 19, 24, 8, -5, 22, 114, 1989 }, // ⁄
-    { 21, 23, 23, 2, 22, 121, 2103 }, // ⁇
-    { 19, 23, 20, 2, 22, 110, 2224 }, // ⁈
-    { 19, 23, 20, 1, 22, 110, 2334 }, // ⁉
-    { 17, 7, 29, 6, 12, 30, 2444 }, // ⁓
-    { 26, 11, 26, 0, 21, 72, 2474 }, // ⁗
-    { 0, 0, 6, 0, 0, 0, 2546 }, //  
-    { 0, 0, 0, 0, 0, 0, 2546 }, // ⁠
-    { 0, 0, 0, 0, 0, 0, 2546 }, // ⁡
-    { 0, 0, 0, 0, 0, 0, 2546 }, // ⁢
-    { 0, 0, 0, 0, 0, 0, 2546 }, // ⁣
-    { 0, 0, 0, 0, 0, 0, 2546 }, // ⁤
-    { 13, 14, 13, 0, 24, 46, 0 }, // ⁰
-    { 13, 14, 13, 0, 24, 46, 46 }, // ⁴
-    { 13, 14, 13, 0, 24, 46, 92 }, // ⁵
-    { 12, 14, 13, 1, 24, 42, 138 }, // ⁶
-    { 11, 14, 13, 2, 24, 39, 180 }, // ⁷
-    { 11, 14, 13, 1, 24, 39, 219 }, // ⁸
-    { 12, 14, 13, 0, 24, 42, 258 }, // ⁹
-    { 11, 11, 16, 3, 21, 31, 300 }, // ⁿ
-    { 13, 15, 13, 0, 10, 49, 331 }, // ₀
-    { 9, 14, 13, 1, 10, 32, 380 }, // ₁
-    { 12, 14, 13, 0, 10, 42, 412 }, // ₂
-    { 11, 15, 13, 1, 10, 42, 454 }, // ₃
-    { 13, 14, 13, 0, 10, 46, 496 }, // ₄
-    { 13, 14, 13, 0, 9, 46, 542 }, // ₅
-    { 12, 15, 13, 1, 10, 45, 588 }, // ₆
-    { 11, 14, 13, 2, 9, 39, 633 }, // ₇
-    { 11, 15, 13, 1, 10, 42, 672 }, // ₈
-    { 12, 15, 13, 0, 10, 45, 714 }, // ₉
-    { 20, 20, 18, -1, 20, 100, 0 }, // ₣
-    { 19, 22, 18, -1, 21, 105, 100 }, // ₤
-    { 38, 22, 39, 0, 21, 209, 205 }, // ₧
-    { 20, 22, 18, -1, 21, 110, 414 }, // €
-    { 19, 14, 29, 5, 17, 67, 0 }, // ←
-    { 13, 20, 29, 8, 20, 65, 67 }, // ↑
-    { 19, 14, 29, 5, 17, 67, 132 }, // →
-    { 13, 20, 29, 8, 20, 65, 199 }, // ↓
-    { 19, 14, 29, 5, 17, 67, 264 }, // ↔
-    { 13, 20, 29, 8, 20, 65, 331 }, // ↕
-    { 15, 20, 29, 7, 20, 75, 396 }, // ↨
-    { 13, 20, 29, 8, 20, 65, 471 }, // ↲
-    { 13, 20, 29, 8, 20, 65, 536 }, // ↳
-    { 17, 16, 29, 6, 18, 68, 601 }, // ↵
-    { 19, 16, 29, 5, 18, 76, 669 }, // ⇐
-    { 17, 18, 29, 6, 19, 77, 745 }, // ⇑
-    { 19, 16, 29, 5, 18, 76, 822 }, // ⇒
-    { 17, 18, 29, 6, 19, 77, 898 }, // ⇓
-    { 19, 16, 29, 5, 18, 76, 975 }, // ⇔
-    { 21, 22, 29, 4, 21, 116, 0 }, // ∀
-    { 16, 24, 18, 1, 23, 96, 116 }, // ∂
-    { 15, 21, 29, 7, 21, 79, 212 }, // ∃
-    { 23, 24, 29, 3, 22, 138, 291 }, // ∅
-    { 20, 21, 20, 0, 21, 105, 429 }, // ∆
-    { 19, 22, 29, 5, 21, 105, 534 }, // ∇
-    { 21, 21, 29, 4, 21, 111, 639 }, // ∈
-    { 21, 26, 29, 4, 23, 137, 750 }, // ∉
-    { 21, 18, 29, 4, 19, 95, 887 }, // ∊
-    { 21, 21, 29, 4, 21, 111, 982 }, // ∋
-    { 21, 26, 29, 4, 23, 137, 1093 }, // ∌
-    { 21, 18, 29, 4, 19, 95, 1230 }, // ∍
-    { 23, 26, 24, 1, 21, 150, 1325 }, // ∏
-    { 19, 26, 19, 0, 21, 124, 1475 }, // ∑
-    { 14, 4, 18, 2, 12, 14, 1599 }, // −
-    { 17, 23, 15, -1, 21, 98, 1613 }, // ∕
-    { 15, 23, 15, 0, 21, 87, 1711 }, // ∖
-    { 14, 14, 18, 2, 17, 49, 1798 }, // ∗
-    { 12, 11, 18, 3, 15, 33, 1847 }, // ∘
-    { 6, 6, 18, 6, 11, 9, 1880 }, // ∙
-    { 19, 28, 18, -1, 24, 133, 1889 }, // √
-    { 14, 12, 18, 2, 15, 42, 2022 }, // ∝
-    { 18, 11, 18, 0, 15, 50, 2064 }, // ∞
-    { 19, 21, 29, 5, 21, 100, 2114 }, // ∟
-    { 23, 21, 29, 3, 21, 121, 2214 }, // ∠
-    { 5, 30, 15, 5, 23, 38, 2335 }, // ∣
-    { 11, 30, 15, 2, 23, 83, 2373 }, // ∥
-    { 21, 21, 29, 4, 21, 111, 2456 }, // ∧
-    { 21, 21, 29, 4, 21, 111, 2567 }, // ∨
-    { 17, 21, 29, 6, 21, 90, 2678 }, // ∩
-    { 17, 22, 29, 6, 21, 94, 2768 }, // ∪
-    { 16, 30, 18, 1, 23, 120, 2862 }, // ∫
-    { 19, 18, 29, 5, 17, 86, 2982 }, // ∴
-    { 19, 18, 29, 5, 17, 86, 3068 }, // ∵
-    { 7, 17, 9, 1, 18, 30, 3154 }, // ∶
-    { 19, 18, 29, 5, 17, 86, 3184 }, // ∷
-    { 17, 7, 29, 6, 12, 30, 3270 }, // ∼
-    { 17, 17, 29, 6, 18, 73, 3300 }, // ≅
-    { 14, 12, 18, 2, 16, 42, 3373 }, // ≈
-    { 17, 12, 29, 6, 14, 51, 3415 }, // ≍
-    { 14, 15, 18, 2, 17, 53, 3466 }, // ≠
-    { 17, 15, 29, 6, 16, 64, 3519 }, // ≡
-    { 14, 18, 18, 2, 18, 63, 3583 }, // ≤
-    { 14, 18, 18, 2, 18, 63, 3646 }, // ≥
-    { 25, 14, 29, 2, 17, 88, 3709 }, // ≪
-    { 25, 14, 29, 2, 17, 88, 3797 }, // ≫
-    { 21, 18, 29, 4, 19, 95, 3885 }, // ⊃
-    { 21, 26, 29, 4, 23, 137, 3980 }, // ⊄
-    { 21, 26, 29, 4, 23, 137, 4117 }, // ⊅
-    { 19, 21, 29, 5, 21, 100, 4254 }, // ⊆
-    { 19, 21, 29, 5, 21, 100, 4354 }, // ⊇
-    { 21, 22, 29, 4, 21, 116, 4454 }, // ⊕
-    { 21, 22, 29, 4, 21, 116, 4570 }, // ⊖
-    { 21, 22, 29, 4, 21, 116, 4686 }, // ⊗
-    { 21, 22, 29, 4, 21, 116, 4802 }, // ⊘
-    { 17, 21, 29, 6, 21, 90, 4918 }, // ⊥
-    { 6, 6, 18, 6, 11, 9, 5008 }, // ⋅
-    { 25, 6, 29, 2, 11, 38, 5017 }, // ⋯
-    { 27, 28, 29, 1, 24, 189, 0 }, // �
+    { 16, 12, 18, 1, 13, 48, 8355 }, // «
+    { 14, 8, 18, 2, 14, 28, 776 }, // ¬
+    { 10, 5, 11, 1, 10, 13, 804 }, // ­
+    { 17, 16, 17, 0, 23, 68, 817 }, // ®
+    { 10, 3, 18, 4, 21, 8, 885 }, // ¯
+    { 11, 12, 15, 2, 21, 33, 893 }, // °
+    { 14, 18, 18, 2, 17, 63, 926 }, // ±
+    { 12, 14, 13, 0, 24, 42, 989 }, // ²
+    { 11, 14, 13, 1, 24, 39, 1031 }, // ³
+    { 6, 8, 18, 6, 25, 12, 1070 }, // ´
+    { 20, 23, 18, -2, 16, 115, 1082 }, // µ
+    { 20, 26, 18, -1, 21, 130, 1197 }, // ¶
+    { 5, 6, 9, 2, 11, 8, 1327 }, // ·
+    { 7, 7, 18, 6, -1, 13, 1335 }, // ¸
+    { 9, 14, 13, 1, 24, 32, 1348 }, // ¹
+    { 12, 15, 13, 1, 21, 45, 1380 }, // º
+    { 17, 12, 18, 0, 13, 51, 8403 }, // »
+    { 30, 24, 31, 1, 22, 180, 1425 }, // ¼
+    { 30, 24, 31, 1, 22, 180, 1605 }, // ½
+    { 30, 24, 31, 1, 22, 180, 1785 }, // ¾
+    { 10, 23, 12, 0, 16, 58, 1965 }, // ¿
+    { 23, 29, 21, -2, 29, 167, 8454 }, // À
+    { 23, 29, 21, -2, 29, 167, 8621 }, // Á
+    { 23, 29, 21, -2, 29, 167, 8788 }, // Â
+    { 23, 28, 21, -2, 28, 161, 2023 }, // Ã
+    { 23, 27, 21, -2, 27, 156, 8955 }, // Ä
+    { 23, 29, 21, -2, 29, 167, 2184 }, // Å
+    { 31, 21, 27, -3, 21, 163, 2351 }, // Æ
+    { 19, 29, 19, 0, 21, 138, 9111 }, // Ç
+    { 21, 29, 18, -2, 29, 153, 9249 }, // È
+    { 21, 29, 18, -2, 29, 153, 9402 }, // É
+    { 21, 29, 18, -2, 29, 153, 9555 }, // Ê
+    { 21, 27, 18, -2, 27, 142, 9708 }, // Ë
+    { 15, 29, 12, -2, 29, 109, 9850 }, // Ì
+    { 15, 29, 12, -2, 29, 109, 9959 }, // Í
+    { 16, 29, 12, -2, 29, 116, 10068 }, // Î
+    { 16, 27, 12, -2, 27, 108, 10184 }, // Ï
+    { 22, 22, 21, -1, 21, 121, 2514 }, // Ð
+    { 25, 29, 22, -1, 28, 182, 10292 }, // Ñ
+    { 21, 30, 21, 0, 29, 158, 10474 }, // Ò
+    { 21, 30, 21, 0, 29, 158, 10632 }, // Ó
+    { 21, 30, 21, 0, 29, 158, 10790 }, // Ô
+    { 21, 29, 21, 0, 28, 153, 2635 }, // Õ
+    { 21, 28, 21, 0, 27, 147, 10948 }, // Ö
+    { 13, 13, 18, 3, 16, 43, 2788 }, // ×
+    { 24, 23, 21, -1, 22, 138, 2831 }, // Ø
+    { 22, 30, 23, 2, 29, 165, 11095 }, // Ù
+    { 22, 30, 23, 2, 29, 165, 11260 }, // Ú
+    { 22, 30, 23, 2, 29, 165, 11425 }, // Û
+    { 22, 28, 23, 2, 27, 154, 11590 }, // Ü
+    { 21, 29, 19, 1, 29, 153, 2969 }, // Ý
+    { 19, 21, 17, -2, 21, 100, 3122 }, // Þ
+    { 24, 30, 19, -6, 23, 180, 3222 }, // ß
+    { 17, 26, 17, 0, 25, 111, 11744 }, // à
+    { 17, 26, 17, 0, 25, 111, 11855 }, // á
+    { 17, 25, 17, 0, 24, 107, 11966 }, // â
+    { 17, 24, 17, 0, 23, 102, 3402 }, // ã
+    { 17, 24, 17, 0, 23, 102, 12073 }, // ä
+    { 17, 26, 17, 0, 25, 111, 3504 }, // å
+    { 23, 17, 23, 0, 16, 98, 3615 }, // æ
+    { 13, 24, 13, 0, 16, 78, 12175 }, // ç
+    { 14, 26, 14, 0, 25, 91, 12253 }, // è
+    { 15, 26, 14, 0, 25, 98, 12344 }, // é
+    { 14, 25, 14, 0, 24, 88, 12442 }, // ê
+    { 15, 24, 14, 0, 23, 90, 12530 }, // ë
+    { 8, 26, 9, 1, 25, 52, 12620 }, // ì
+    { 11, 26, 9, 1, 25, 72, 12672 }, // í
+    { 11, 25, 9, 1, 24, 69, 12744 }, // î
+    { 11, 24, 9, 1, 23, 66, 12813 }, // ï
+    { 16, 25, 16, 0, 24, 100, 3713 }, // ð
+    { 18, 24, 18, 0, 23, 108, 12879 }, // ñ
+    { 15, 26, 16, 0, 25, 98, 12987 }, // ò
+    { 16, 26, 16, 0, 25, 104, 13085 }, // ó
+    { 15, 25, 16, 0, 24, 94, 13189 }, // ô
+    { 16, 24, 16, 0, 23, 96, 3813 }, // õ
+    { 16, 24, 16, 0, 23, 96, 13283 }, // ö
+    { 14, 14, 18, 2, 17, 49, 3909 }, // ÷
+    { 19, 17, 16, -2, 16, 81, 3958 }, // ø
+    { 18, 26, 18, 0, 25, 117, 13379 }, // ù
+    { 18, 26, 18, 0, 25, 117, 13496 }, // ú
+    { 18, 25, 18, 0, 24, 113, 13613 }, // û
+    { 18, 24, 18, 0, 23, 108, 13726 }, // ü
+    { 20, 32, 15, -5, 25, 160, 4039 }, // ý
+    { 19, 30, 16, -3, 23, 143, 4199 }, // þ
+    { 20, 30, 15, -5, 23, 150, 4342 }, // ÿ
+    { 23, 26, 21, -2, 26, 150, 4492 }, // Ā
+    { 17, 22, 17, 0, 21, 94, 4642 }, // ā
+    { 23, 28, 21, -2, 28, 161, 4736 }, // Ă
+    { 17, 24, 17, 0, 23, 102, 4897 }, // ă
+    { 23, 28, 21, -2, 21, 161, 4999 }, // Ą
+    { 17, 23, 17, 0, 16, 98, 5160 }, // ą
+    { 19, 30, 19, 0, 29, 143, 5258 }, // Ć
+    { 15, 26, 13, 0, 25, 98, 5401 }, // ć
+    { 19, 30, 19, 0, 29, 143, 5499 }, // Ĉ
+    { 14, 25, 13, 0, 24, 88, 5642 }, // ĉ
+    { 19, 29, 19, 0, 28, 138, 5730 }, // Ċ
+    { 13, 24, 13, 0, 23, 78, 5868 }, // ċ
+    { 20, 30, 19, 0, 29, 150, 5946 }, // Č
+    { 15, 26, 13, 0, 25, 98, 6096 }, // č
+    { 22, 30, 21, -1, 29, 165, 6194 }, // Ď
+    { 22, 24, 18, 0, 23, 132, 6359 }, // ď
+    { 22, 22, 21, -1, 21, 121, 6491 }, // Đ
+    { 19, 24, 17, 0, 23, 114, 6612 }, // đ
+    { 21, 26, 18, -2, 26, 137, 6726 }, // Ē
+    { 15, 22, 14, 0, 21, 83, 6863 }, // ē
+    { 21, 28, 18, -2, 28, 147, 6946 }, // Ĕ
+    { 15, 24, 14, 0, 23, 90, 7093 }, // ĕ
+    { 21, 28, 18, -2, 28, 147, 7183 }, // Ė
+    { 14, 24, 14, 0, 23, 84, 7330 }, // ė
+    { 21, 28, 18, -2, 21, 147, 7414 }, // Ę
+    { 14, 23, 14, 0, 16, 81, 7561 }, // ę
+    { 21, 29, 18, -2, 29, 153, 7642 }, // Ě
+    { 15, 26, 14, 0, 25, 98, 7795 }, // ě
+    { 20, 30, 21, 0, 29, 150, 7893 }, // Ĝ
+    { 20, 31, 15, -2, 24, 155, 8043 }, // ĝ
+    { 20, 29, 21, 0, 28, 145, 8198 }, // Ğ
+    { 20, 30, 15, -2, 23, 150, 8343 }, // ğ
+    { 20, 29, 21, 0, 28, 145, 8493 }, // Ġ
+    { 20, 30, 15, -2, 23, 150, 8638 }, // ġ
+    { 20, 29, 21, 0, 21, 145, 8788 }, // Ģ
+    { 20, 32, 15, -2, 25, 160, 8933 }, // ģ
+    { 27, 29, 23, -2, 29, 196, 9093 }, // Ĥ
+    { 17, 31, 17, 0, 30, 132, 9289 }, // ĥ
+    { 27, 21, 23, -2, 21, 142, 9421 }, // Ħ
+    { 17, 24, 17, 0, 23, 102, 9563 }, // ħ
+    { 16, 28, 12, -2, 28, 112, 9665 }, // Ĩ
+    { 12, 24, 9, 1, 23, 72, 9777 }, // ĩ
+    { 16, 26, 12, -2, 26, 104, 9849 }, // Ī
+    { 11, 22, 9, 1, 21, 61, 9953 }, // ī
+    { 16, 28, 12, -2, 28, 112, 10014 }, // Ĭ
+    { 11, 24, 9, 1, 23, 66, 10126 }, // ĭ
+    { 15, 28, 12, -2, 21, 105, 10192 }, // Į
+    { 9, 30, 9, 1, 23, 68, 10297 }, // į
+    { 15, 28, 12, -2, 28, 105, 10365 }, // İ
+    { 8, 17, 9, 1, 16, 34, 10470 }, // ı
+    { 27, 27, 23, -2, 21, 183, 10504 }, // Ĳ
+    { 19, 30, 19, 1, 23, 143, 10687 }, // ĳ
+    { 20, 35, 11, -6, 29, 175, 10830 }, // Ĵ
+    { 18, 31, 9, -6, 24, 140, 11005 }, // ĵ
+    { 24, 29, 21, -2, 21, 174, 11145 }, // Ķ
+    { 15, 31, 15, 0, 23, 117, 11319 }, // ķ
+    { 16, 17, 17, 0, 16, 68, 11436 }, // ĸ
+    { 18, 29, 17, -2, 29, 131, 11504 }, // Ĺ
+    { 12, 31, 9, 0, 30, 93, 11635 }, // ĺ
+    { 18, 29, 17, -2, 21, 131, 11728 }, // Ļ
+    { 10, 31, 9, -1, 23, 78, 11859 }, // ļ
+    { 19, 23, 17, -2, 23, 110, 11937 }, // Ľ
+    { 14, 24, 10, 0, 23, 84, 12047 }, // ľ
+    { 19, 21, 17, -2, 21, 100, 12131 }, // Ŀ
+    { 14, 24, 12, 0, 23, 84, 12231 }, // ŀ
+    { 18, 21, 17, -2, 21, 95, 12315 }, // Ł
+    { 12, 24, 9, -1, 23, 72, 12410 }, // ł
+    { 25, 30, 22, -1, 29, 188, 12482 }, // Ń
+    { 18, 26, 18, 0, 25, 117, 12670 }, // ń
+    { 25, 29, 22, -1, 21, 182, 12787 }, // Ņ
+    { 18, 24, 18, 0, 16, 108, 12969 }, // ņ
+    { 25, 30, 22, -1, 29, 188, 13077 }, // Ň
+    { 18, 26, 18, 0, 25, 117, 13265 }, // ň
+    { 23, 23, 24, 1, 22, 133, 13382 }, // ŉ
+    { 25, 27, 22, -1, 21, 169, 13515 }, // Ŋ
+    { 16, 23, 17, 0, 16, 92, 13684 }, // ŋ
+    { 21, 27, 21, 0, 26, 142, 13776 }, // Ō
+    { 16, 22, 16, 0, 21, 88, 13918 }, // ō
+    { 21, 29, 21, 0, 28, 153, 14006 }, // Ŏ
+    { 16, 24, 16, 0, 23, 96, 14159 }, // ŏ
+    { 22, 30, 21, 0, 29, 165, 14255 }, // Ő
+    { 17, 26, 16, 0, 25, 111, 14420 }, // ő
+    { 29, 22, 29, 0, 21, 160, 13834 }, // Œ
+    { 24, 17, 24, 0, 16, 102, 13994 }, // œ
+    { 21, 30, 20, -2, 29, 158, 14531 }, // Ŕ
+    { 15, 25, 14, 0, 25, 94, 14689 }, // ŕ
+    { 21, 29, 20, -2, 21, 153, 14783 }, // Ŗ
+    { 16, 24, 14, -1, 16, 96, 14936 }, // ŗ
+    { 21, 30, 20, -2, 29, 158, 15032 }, // Ř
+    { 15, 25, 14, 0, 25, 94, 15190 }, // ř
+    { 17, 30, 16, -1, 29, 128, 15284 }, // Ś
+    { 15, 26, 13, -1, 25, 98, 15412 }, // ś
+    { 17, 30, 16, -1, 29, 128, 15510 }, // Ŝ
+    { 15, 25, 13, -1, 24, 94, 15638 }, // ŝ
+    { 17, 29, 16, -1, 21, 124, 15732 }, // Ş
+    { 14, 24, 13, -1, 16, 84, 15856 }, // ş
+    { 18, 30, 16, -1, 29, 135, 15940 }, // Š
+    { 16, 26, 13, -1, 25, 104, 16075 }, // š
+    { 20, 29, 19, 1, 21, 145, 16179 }, // Ţ
+    { 13, 27, 12, 0, 19, 88, 16324 }, // ţ
+    { 20, 29, 19, 1, 29, 145, 16412 }, // Ť
+    { 15, 25, 12, 0, 24, 94, 16557 }, // ť
+    { 20, 21, 19, 1, 21, 105, 16651 }, // Ŧ
+    { 13, 20, 12, 0, 19, 65, 16756 }, // ŧ
+    { 22, 29, 23, 2, 28, 160, 16821 }, // Ũ
+    { 18, 24, 18, 0, 23, 108, 16981 }, // ũ
+    { 22, 27, 23, 2, 26, 149, 17089 }, // Ū
+    { 18, 22, 18, 0, 21, 99, 17238 }, // ū
+    { 22, 29, 23, 2, 28, 160, 17337 }, // Ŭ
+    { 18, 24, 18, 0, 23, 108, 17497 }, // ŭ
+    { 22, 30, 23, 2, 29, 165, 17605 }, // Ů
+    { 18, 26, 18, 0, 25, 117, 17770 }, // ů
+    { 22, 30, 23, 2, 29, 165, 17887 }, // Ű
+    { 18, 26, 18, 0, 25, 117, 18052 }, // ű
+    { 22, 28, 23, 2, 21, 154, 18169 }, // Ų
+    { 18, 23, 18, 0, 16, 104, 18323 }, // ų
+    { 29, 30, 29, 2, 29, 218, 18427 }, // Ŵ
+    { 22, 25, 22, 0, 24, 138, 18645 }, // ŵ
+    { 21, 29, 19, 1, 29, 153, 18783 }, // Ŷ
+    { 20, 31, 15, -5, 24, 155, 18936 }, // ŷ
+    { 21, 27, 19, 1, 27, 142, 19091 }, // Ÿ
+    { 19, 30, 18, -1, 29, 143, 19233 }, // Ź
+    { 15, 26, 14, -1, 25, 98, 19376 }, // ź
+    { 19, 29, 18, -1, 28, 138, 19474 }, // Ż
+    { 15, 24, 14, -1, 23, 90, 19612 }, // ż
+    { 19, 30, 18, -1, 29, 143, 19702 }, // Ž
+    { 15, 26, 14, -1, 25, 98, 19845 }, // ž
+    { 22, 30, 12, -6, 23, 165, 19943 }, // ſ
+    { 7, 8, 0, -5, 25, 14, 20108 }, // ̀
+    { 6, 8, 0, -2, 25, 12, 20122 }, // ́
+    { 11, 7, 0, -6, 24, 20, 20134 }, // ̂
+    { 10, 5, 0, -5, 23, 13, 20154 }, // ̃
+    { 10, 3, 0, -5, 21, 8, 20167 }, // ̄
+    { 10, 6, 0, -5, 23, 15, 20175 }, // ̆
+    { 6, 5, 0, -3, 23, 8, 20190 }, // ̇
+    { 10, 5, 0, -5, 23, 13, 20198 }, // ̈
+    { 9, 9, 0, -4, 26, 21, 20211 }, // ̉
+    { 8, 9, 0, -4, 25, 18, 20232 }, // ̊
+    { 12, 8, 0, -5, 25, 24, 20250 }, // ̋
+    { 11, 8, 0, -5, 25, 22, 20274 }, // ̌
+    { 9, 7, 0, -6, 24, 16, 20296 }, // ̏
+    { 10, 6, 0, -5, 23, 15, 20312 }, // ̑
+    { 6, 8, 0, -3, 25, 12, 20327 }, // ̒
+    { 7, 9, 0, -3, 26, 16, 20339 }, // ̓
+    { 6, 9, 0, -4, 26, 14, 20355 }, // ̔
+    { 5, 8, 0, -3, 25, 10, 20369 }, // ̕
+    { 6, 7, 0, -3, 19, 11, 20379 }, // ̛
+    { 6, 5, 0, -3, -2, 8, 20390 }, // ̣
+    { 10, 5, 0, -5, -2, 13, 20398 }, // ̤
+    { 8, 7, 0, -4, -1, 14, 20411 }, // ̥
+    { 6, 7, 0, -3, -1, 11, 20425 }, // ̦
+    { 7, 7, 0, -4, -1, 13, 20436 }, // ̧
+    { 6, 8, 0, -3, 1, 12, 20449 }, // ̨
+    { 5, 8, 8, -1, -1, 10, 20461 }, // ̩
+    { 11, 7, 0, -6, -1, 20, 20471 }, // ̭
+    { 10, 7, 0, -5, -1, 18, 20491 }, // ̮
+    { 10, 6, 0, -5, -2, 15, 20509 }, // ̰
+    { 10, 3, 0, -5, -3, 8, 20524 }, // ̱
+    { 10, 6, 0, -5, 23, 15, 20532 }, // ͂
+    { 11, 12, 0, -6, 30, 33, 20547 }, // ̈́
+    { 6, 6, 0, -2, -2, 9, 20580 }, // ͅ
+    { 21, 29, 18, -2, 29, 153, 20589 }, // Ѐ
+    { 21, 27, 18, -2, 27, 142, 0 }, // Ё
+    { 20, 27, 22, 1, 21, 135, 20742 }, // Ђ
+    { 20, 29, 17, -2, 29, 145, 20877 }, // Ѓ
+    { 19, 22, 19, 0, 21, 105, 21022 }, // Є
+    { 17, 22, 16, -1, 21, 94, 21127 }, // Ѕ
+    { 15, 21, 12, -2, 21, 79, 21221 }, // І
+    { 16, 27, 12, -2, 27, 108, 21300 }, // Ї
+    { 19, 27, 11, -6, 21, 129, 21408 }, // Ј
+    { 28, 22, 27, -2, 21, 154, 21537 }, // Љ
+    { 29, 22, 28, -2, 21, 160, 21691 }, // Њ
+    { 22, 21, 25, 1, 21, 116, 21851 }, // Ћ
+    { 24, 30, 20, -2, 29, 180, 21967 }, // Ќ
+    { 27, 29, 23, -2, 29, 196, 22147 }, // Ѝ
+    { 21, 30, 19, 1, 29, 158, 22343 }, // Ў
+    { 26, 28, 22, -2, 21, 182, 22501 }, // Џ
+    { 23, 21, 21, -2, 21, 121, 142 }, // А
+    { 20, 22, 18, -2, 21, 110, 263 }, // Б
+    { 19, 22, 18, -2, 21, 105, 373 }, // В
+    { 20, 21, 17, -2, 21, 105, 478 }, // Г
+    { 25, 27, 22, -2, 21, 169, 583 }, // Д
+    { 21, 21, 18, -2, 21, 111, 752 }, // Е
+    { 33, 22, 28, -3, 21, 182, 863 }, // Ж
+    { 17, 22, 17, -1, 21, 94, 1045 }, // З
+    { 27, 21, 23, -2, 21, 142, 1139 }, // И
+    { 27, 29, 23, -2, 29, 196, 1281 }, // Й
+    { 24, 22, 20, -2, 21, 132, 1477 }, // К
+    { 25, 22, 21, -2, 21, 138, 1609 }, // Л
+    { 28, 21, 26, -2, 21, 147, 1747 }, // М
+    { 27, 21, 23, -2, 21, 142, 1894 }, // Н
+    { 21, 22, 21, 0, 21, 116, 2036 }, // О
+    { 26, 21, 23, -2, 21, 137, 2152 }, // П
+    { 20, 21, 18, -2, 21, 105, 2289 }, // Р
+    { 19, 22, 19, 0, 21, 105, 2394 }, // С
+    { 20, 21, 19, 1, 21, 105, 2499 }, // Т
+    { 21, 22, 19, 1, 21, 116, 2604 }, // У
+    { 22, 22, 22, 0, 21, 121, 2720 }, // Ф
+    { 24, 21, 19, -3, 21, 126, 2841 }, // Х
+    { 26, 27, 22, -2, 21, 176, 2967 }, // Ц
+    { 21, 21, 21, 1, 21, 111, 3143 }, // Ч
+    { 33, 21, 29, -2, 21, 174, 3254 }, // Ш
+    { 33, 27, 29, -2, 21, 223, 3428 }, // Щ
+    { 19, 22, 21, 1, 21, 105, 3651 }, // Ъ
+    { 31, 22, 27, -2, 21, 171, 3756 }, // Ы
+    { 19, 22, 18, -2, 21, 105, 3927 }, // Ь
+    { 19, 22, 18, -1, 21, 105, 4032 }, // Э
+    { 32, 22, 30, -2, 21, 176, 4137 }, // Ю
+    { 23, 22, 19, -2, 21, 127, 4313 }, // Я
+    { 17, 17, 17, 0, 16, 73, 4440 }, // а
+    { 18, 25, 16, 0, 24, 113, 4513 }, // б
+    { 15, 17, 15, 0, 16, 64, 4626 }, // в
+    { 13, 17, 13, 0, 16, 56, 4690 }, // г
+    { 16, 24, 16, 0, 23, 96, 4746 }, // д
+    { 14, 17, 14, 0, 16, 60, 4842 }, // е
+    { 26, 17, 26, 0, 16, 111, 4902 }, // ж
+    { 14, 17, 13, -1, 16, 60, 5013 }, // з
+    { 18, 17, 18, 0, 16, 77, 5073 }, // и
+    { 18, 25, 18, 0, 24, 113, 5150 }, // й
+    { 17, 17, 17, 0, 16, 73, 5263 }, // к
+    { 19, 17, 18, -1, 16, 81, 5336 }, // л
+    { 24, 17, 23, -1, 16, 102, 5417 }, // м
+    { 18, 17, 18, 0, 16, 77, 5519 }, // н
+    { 15, 17, 16, 0, 16, 64, 5596 }, // о
+    { 18, 17, 18, 0, 16, 77, 5660 }, // п
+    { 19, 23, 17, -3, 16, 110, 5737 }, // р
+    { 13, 17, 13, 0, 16, 56, 5847 }, // с
+    { 25, 17, 25, 0, 16, 107, 5903 }, // т
+    { 20, 23, 15, -5, 16, 115, 6010 }, // у
+    { 20, 30, 21, 0, 23, 150, 6125 }, // ф
+    { 18, 17, 17, -1, 16, 77, 6275 }, // х
+    { 18, 22, 18, 0, 16, 99, 6352 }, // ц
+    { 17, 17, 18, 0, 16, 73, 6451 }, // ч
+    { 24, 17, 24, 0, 16, 102, 6524 }, // ш
+    { 24, 22, 24, 0, 16, 132, 6626 }, // щ
+    { 16, 17, 16, 0, 16, 68, 6758 }, // ъ
+    { 22, 17, 23, 0, 16, 94, 6826 }, // ы
+    { 14, 17, 15, 0, 16, 60, 6920 }, // ь
+    { 15, 17, 14, -1, 16, 64, 6980 }, // э
+    { 23, 17, 23, 0, 16, 98, 7044 }, // ю
+    { 17, 17, 17, 0, 16, 73, 7142 }, // я
+    { 14, 26, 14, 0, 25, 91, 22683 }, // ѐ
+    { 15, 24, 14, 0, 23, 90, 7215 }, // ё
+    { 16, 30, 17, 0, 23, 120, 22774 }, // ђ
+    { 14, 26, 13, 0, 25, 91, 22894 }, // ѓ
+    { 14, 17, 14, 0, 16, 60, 22985 }, // є
+    { 14, 17, 13, -1, 16, 60, 23045 }, // ѕ
+    { 9, 24, 9, 1, 23, 54, 23105 }, // і
+    { 11, 24, 9, 1, 23, 66, 23159 }, // ї
+    { 16, 30, 9, -6, 23, 120, 23225 }, // ј
+    { 24, 17, 23, -1, 16, 102, 23345 }, // љ
+    { 22, 17, 22, 0, 16, 94, 23447 }, // њ
+    { 17, 24, 17, 0, 23, 102, 23541 }, // ћ
+    { 17, 26, 17, 0, 25, 111, 23643 }, // ќ
+    { 18, 26, 18, 0, 25, 117, 23754 }, // ѝ
+    { 20, 31, 15, -5, 24, 155, 23871 }, // ў
+    { 18, 22, 18, 0, 16, 99, 24026 }, // џ
+    { 19, 24, 21, 1, 23, 114, 24125 }, // Ѣ
+    { 22, 17, 23, 0, 16, 94, 24239 }, // ѣ
+    { 21, 22, 21, 0, 21, 116, 24333 }, // Ѳ
+    { 15, 17, 16, 0, 16, 64, 24449 }, // ѳ
+    { 23, 22, 22, 1, 21, 127, 24513 }, // Ѵ
+    { 19, 17, 17, -1, 16, 81, 24640 }, // ѵ
+    { 27, 35, 24, -2, 29, 237, 24721 }, // Ҋ
+    { 18, 30, 18, 0, 24, 135, 24958 }, // ҋ
+    { 19, 22, 18, -2, 21, 105, 25093 }, // Ҍ
+    { 13, 22, 15, 1, 21, 72, 25198 }, // ҍ
+    { 20, 21, 18, -2, 21, 105, 25270 }, // Ҏ
+    { 19, 23, 17, -3, 16, 110, 25375 }, // ҏ
+    { 20, 25, 17, -2, 25, 125, 25485 }, // Ґ
+    { 15, 21, 14, 0, 20, 79, 25610 }, // ґ
+    { 20, 21, 17, -2, 21, 105, 25689 }, // Ғ
+    { 13, 17, 13, 0, 16, 56, 25794 }, // ғ
+    { 20, 27, 19, -2, 21, 135, 25850 }, // Ҕ
+    { 15, 23, 16, 0, 16, 87, 25985 }, // ҕ
+    { 33, 27, 28, -3, 21, 223, 0 }, // Җ
+    { 26, 22, 26, 0, 16, 143, 223 }, // җ
+    { 17, 27, 17, -1, 21, 115, 366 }, // Ҙ
+    { 14, 22, 13, -1, 16, 77, 481 }, // ҙ
+    { 24, 27, 20, -2, 21, 162, 558 }, // Қ
+    { 17, 22, 17, 0, 16, 94, 720 }, // қ
+    { 25, 22, 21, -2, 21, 138, 814 }, // Ҝ
+    { 19, 17, 19, 0, 16, 81, 952 }, // ҝ
+    { 24, 22, 20, -2, 21, 132, 1033 }, // Ҟ
+    { 16, 23, 16, 0, 22, 92, 1165 }, // ҟ
+    { 25, 22, 24, 1, 21, 138, 1257 }, // Ҡ
+    { 19, 17, 19, 0, 16, 81, 1395 }, // ҡ
+    { 27, 27, 23, -2, 21, 183, 1476 }, // Ң
+    { 18, 22, 19, 0, 16, 99, 1659 }, // ң
+    { 31, 21, 27, -2, 21, 163, 1758 }, // Ҥ
+    { 23, 17, 22, 0, 16, 98, 1921 }, // ҥ
+    { 31, 27, 30, -2, 21, 210, 2019 }, // Ҧ
+    { 24, 23, 24, 0, 16, 138, 2229 }, // ҧ
+    { 24, 22, 24, 0, 21, 132, 2367 }, // Ҩ
+    { 19, 17, 19, 0, 16, 81, 2499 }, // ҩ
+    { 19, 27, 19, 0, 21, 129, 2580 }, // Ҫ
+    { 13, 22, 13, 0, 16, 72, 2709 }, // ҫ
+    { 20, 27, 19, 1, 21, 135, 2781 }, // Ҭ
+    { 26, 22, 26, 0, 16, 143, 2916 }, // ҭ
+    { 21, 21, 19, 1, 21, 111, 3059 }, // Ү
+    { 15, 23, 15, 0, 16, 87, 3170 }, // ү
+    { 21, 21, 19, 1, 21, 111, 3257 }, // Ұ
+    { 15, 23, 15, 0, 16, 87, 3368 }, // ұ
+    { 24, 27, 19, -3, 21, 162, 3455 }, // Ҳ
+    { 18, 22, 17, -1, 16, 99, 3617 }, // ҳ
+    { 27, 27, 27, 1, 21, 183, 3716 }, // Ҵ
+    { 18, 27, 18, 0, 21, 122, 3899 }, // ҵ
+    { 21, 27, 21, 1, 21, 142, 4021 }, // Ҷ
+    { 17, 22, 18, 0, 16, 94, 4163 }, // ҷ
+    { 22, 21, 21, 1, 21, 116, 4257 }, // Ҹ
+    { 17, 17, 18, 0, 16, 73, 4373 }, // ҹ
+    { 21, 21, 21, -2, 21, 111, 4446 }, // Һ
+    { 17, 24, 17, 0, 23, 102, 4557 }, // һ
+    { 22, 22, 24, 1, 21, 121, 4659 }, // Ҽ
+    { 17, 17, 17, 0, 16, 73, 4780 }, // ҽ
+    { 22, 28, 24, 1, 21, 154, 4853 }, // Ҿ
+    { 17, 22, 17, 0, 16, 94, 5007 }, // ҿ
+    { 15, 21, 12, -2, 21, 79, 5101 }, // Ӏ
+    { 33, 30, 28, -3, 29, 248, 5180 }, // Ӂ
+    { 26, 25, 26, 0, 24, 163, 5428 }, // ӂ
+    { 24, 27, 21, -2, 21, 162, 5591 }, // Ӄ
+    { 17, 23, 17, 0, 16, 98, 5753 }, // ӄ
+    { 25, 27, 21, -2, 21, 169, 5851 }, // Ӆ
+    { 19, 22, 18, -1, 16, 105, 6020 }, // ӆ
+    { 27, 27, 23, -2, 21, 183, 6125 }, // Ӈ
+    { 17, 23, 17, 0, 16, 98, 6308 }, // ӈ
+    { 27, 27, 23, -2, 21, 183, 6406 }, // Ӊ
+    { 18, 22, 18, 0, 16, 99, 6589 }, // ӊ
+    { 21, 27, 21, 1, 21, 142, 6688 }, // Ӌ
+    { 17, 22, 17, 0, 16, 94, 6830 }, // ӌ
+    { 28, 27, 27, -2, 21, 189, 6924 }, // Ӎ
+    { 24, 22, 23, -1, 16, 132, 7113 }, // ӎ
+    { 14, 23, 11, -1, 23, 81, 7245 }, // ӏ
+    { 23, 29, 21, -2, 29, 167, 7326 }, // Ӑ
+    { 17, 25, 17, 0, 24, 107, 7493 }, // ӑ
+    { 23, 27, 21, -2, 27, 156, 7600 }, // Ӓ
+    { 17, 24, 17, 0, 23, 102, 7756 }, // ӓ
+    { 31, 21, 27, -3, 21, 163, 7858 }, // Ӕ
+    { 23, 17, 23, 0, 16, 98, 8021 }, // ӕ
+    { 21, 29, 18, -2, 29, 153, 8119 }, // Ӗ
+    { 15, 25, 14, 0, 24, 94, 8272 }, // ӗ
+    { 19, 22, 19, 0, 21, 105, 8366 }, // Ә
+    { 14, 17, 14, 0, 16, 60, 8471 }, // ә
+    { 19, 28, 19, 0, 27, 133, 8531 }, // Ӛ
+    { 14, 24, 14, 0, 23, 84, 8664 }, // ӛ
+    { 33, 28, 28, -3, 27, 231, 8748 }, // Ӝ
+    { 26, 24, 26, 0, 23, 156, 8979 }, // ӝ
+    { 17, 28, 17, -1, 27, 119, 9135 }, // Ӟ
+    { 15, 24, 13, -1, 23, 90, 9254 }, // ӟ
+    { 18, 22, 16, -1, 21, 99, 9344 }, // Ӡ
+    { 18, 23, 15, -2, 16, 104, 9443 }, // ӡ
+    { 27, 26, 23, -2, 26, 176, 9547 }, // Ӣ
+    { 18, 22, 18, 0, 21, 99, 9723 }, // ӣ
+    { 27, 27, 23, -2, 27, 183, 9822 }, // Ӥ
+    { 18, 24, 18, 0, 23, 108, 10005 }, // ӥ
+    { 21, 28, 21, 0, 27, 147, 10113 }, // Ӧ
+    { 16, 24, 16, 0, 23, 96, 10260 }, // ӧ
+    { 21, 22, 21, 0, 21, 116, 10356 }, // Ө
+    { 15, 17, 16, 0, 16, 64, 10472 }, // ө
+    { 21, 28, 21, 0, 27, 147, 10536 }, // Ӫ
+    { 16, 24, 16, 0, 23, 96, 10683 }, // ӫ
+    { 19, 28, 18, -1, 27, 133, 10779 }, // Ӭ
+    { 15, 24, 14, -1, 23, 90, 10912 }, // ӭ
+    { 21, 27, 19, 1, 26, 142, 11002 }, // Ӯ
+    { 20, 28, 15, -5, 21, 140, 11144 }, // ӯ
+    { 21, 28, 19, 1, 27, 147, 11284 }, // Ӱ
+    { 20, 30, 15, -5, 23, 150, 11431 }, // ӱ
+    { 21, 30, 19, 1, 29, 158, 11581 }, // Ӳ
+    { 20, 32, 15, -5, 25, 160, 11739 }, // ӳ
+    { 21, 27, 21, 1, 27, 142, 11899 }, // Ӵ
+    { 17, 24, 18, 0, 23, 102, 12041 }, // ӵ
+    { 20, 27, 17, -2, 21, 135, 12143 }, // Ӷ
+    { 13, 22, 13, 0, 16, 72, 12278 }, // ӷ
+    { 31, 28, 27, -2, 27, 217, 12350 }, // Ӹ
+    { 22, 24, 23, 0, 23, 132, 12567 }, // ӹ
+    { 20, 27, 17, -2, 21, 135, 12699 }, // Ӻ
+    { 13, 22, 13, 0, 16, 72, 12834 }, // ӻ
+    { 24, 27, 19, -3, 21, 162, 12906 }, // Ӽ
+    { 18, 23, 17, -1, 16, 104, 13068 }, // ӽ
+    { 24, 21, 19, -3, 21, 126, 13172 }, // Ӿ
+    { 18, 17, 17, -1, 16, 77, 13298 }, // ӿ
+    { 0, 0, 15, 0, 0, 0, 13375 }, //  
+    { 0, 0, 29, 0, 0, 0, 13375 }, //  
+    { 0, 0, 15, 0, 0, 0, 13375 }, //  
+    { 0, 0, 29, 0, 0, 0, 13375 }, //  
+    { 0, 0, 10, 0, 0, 0, 13375 }, //  
+    { 0, 0, 7, 0, 0, 0, 13375 }, //  
+    { 0, 0, 5, 0, 0, 0, 13375 }, //  
+    { 0, 0, 18, 0, 0, 0, 13375 }, //  
+    { 0, 0, 9, 0, 0, 0, 13375 }, //  
+    { 0, 0, 6, 0, 0, 0, 13375 }, //  
+    { 0, 0, 1, 0, 0, 0, 13375 }, //  
+    { 0, 0, 0, 0, 0, 0, 13375 }, // ​
+    { 2, 24, 0, -1, 17, 12, 13375 }, // ‌
+    { 6, 26, 0, -3, 19, 39, 13387 }, // ‍
+    { 10, 28, 0, -5, 21, 70, 13426 }, // ‎
+    { 10, 28, 0, -5, 21, 70, 13496 }, // ‏
+    { 10, 5, 11, 1, 10, 13, 13566 }, // ‐
+    { 10, 5, 11, 1, 10, 13, 13579 }, // ‑
+    { 14, 3, 18, 2, 11, 11, 13592 }, // ‒
+    { 15, 3, 15, 0, 9, 12, 14096 }, // –
+    { 29, 3, 29, 0, 9, 22, 14108 }, // —
+    { 29, 3, 29, 0, 9, 22, 13603 }, // ―
+    { 11, 30, 15, 2, 23, 83, 13625 }, // ‖
+    { 15, 8, 15, 0, -1, 30, 13708 }, // ‗
+    { 7, 10, 9, 2, 22, 18, 14130 }, // ‘
+    { 8, 10, 9, 1, 22, 20, 14148 }, // ’
+    { 7, 10, 9, 0, 4, 18, 13738 }, // ‚
+    { 7, 10, 9, 1, 22, 18, 13756 }, // ‛
+    { 13, 10, 15, 2, 22, 33, 14168 }, // “
+    { 14, 10, 15, 1, 22, 35, 14201 }, // ”
+    { 13, 10, 15, 0, 4, 33, 13774 }, // „
+    { 13, 10, 15, 1, 22, 33, 13807 }, // ‟
+    { 13, 19, 14, 1, 21, 62, 13840 }, // †
+    { 15, 23, 14, -1, 21, 87, 13902 }, // ‡
+    { 7, 7, 9, 1, 11, 13, 13989 }, // •
+    { 10, 10, 18, 4, 15, 25, 14002 }, // ‣
+    { 6, 6, 8, 1, 5, 9, 14027 }, // ․
+    { 13, 6, 15, 1, 5, 20, 14036 }, // ‥
+    { 25, 6, 29, 2, 5, 38, 14236 }, // …
+    { 6, 6, 8, 1, 11, 9, 14056 }, // ‧
+    { 0, 0, 0, 0, 0, 0, 14065 }, //  
+    { 0, 0, 0, 0, 0, 0, 14065 }, //  
+    { 10, 28, 0, -5, 21, 70, 14065 }, // ‪
+    { 10, 28, 0, -5, 21, 70, 14135 }, // ‫
+    { 10, 27, 0, -5, 20, 68, 14205 }, // ‬
+    { 12, 28, 0, -6, 21, 84, 14273 }, // ‭
+    { 12, 28, 0, -6, 21, 84, 14357 }, // ‮
+    { 0, 0, 3, 0, 0, 0, 14441 }, //  
+    { 39, 24, 41, 1, 22, 234, 14441 }, // ‰
+    { 7, 11, 7, 0, 21, 20, 14675 }, // ′
+    { 13, 11, 13, 0, 21, 36, 14695 }, // ″
+    { 20, 11, 20, 0, 21, 55, 14731 }, // ‴
+    { 7, 11, 7, 0, 21, 20, 14786 }, // ‵
+    { 13, 11, 14, 0, 21, 36, 14806 }, // ‶
+    { 20, 11, 20, 0, 21, 55, 14842 }, // ‷
+    { 13, 6, 14, 1, 0, 20, 14897 }, // ‸
+    { 9, 12, 10, 1, 13, 27, 14917 }, // ‹
+    { 10, 12, 10, 0, 13, 30, 14944 }, // ›
+    { 18, 20, 18, 0, 19, 90, 14974 }, // ※
+    { 17, 23, 18, 1, 22, 98, 15064 }, // ‼
+    { 15, 4, 15, 0, 25, 15, 15162 }, // ‾
+    { 7, 5, 9, 1, 10, 9, 15177 }, // ⁃
+    { 19, 24, 8, -5, 22, 114, 15186 }, // ⁄
+    { 21, 23, 23, 2, 22, 121, 15300 }, // ⁇
+    { 19, 23, 20, 2, 22, 110, 15421 }, // ⁈
+    { 19, 23, 20, 1, 22, 110, 15531 }, // ⁉
+    { 17, 7, 29, 6, 12, 30, 15641 }, // ⁓
+    { 26, 11, 26, 0, 21, 72, 15671 }, // ⁗
+    { 0, 0, 6, 0, 0, 0, 15743 }, //  
+    { 0, 0, 0, 0, 0, 0, 15743 }, // ⁠
+    { 0, 0, 0, 0, 0, 0, 15743 }, // ⁡
+    { 0, 0, 0, 0, 0, 0, 15743 }, // ⁢
+    { 0, 0, 0, 0, 0, 0, 15743 }, // ⁣
+    { 0, 0, 0, 0, 0, 0, 15743 }, // ⁤
+    { 13, 14, 13, 0, 24, 46, 15743 }, // ⁰
+    { 13, 14, 13, 0, 24, 46, 15789 }, // ⁴
+    { 13, 14, 13, 0, 24, 46, 15835 }, // ⁵
+    { 12, 14, 13, 1, 24, 42, 15881 }, // ⁶
+    { 11, 14, 13, 2, 24, 39, 15923 }, // ⁷
+    { 11, 14, 13, 1, 24, 39, 15962 }, // ⁸
+    { 12, 14, 13, 0, 24, 42, 16001 }, // ⁹
+    { 11, 11, 16, 3, 21, 31, 16043 }, // ⁿ
+    { 13, 15, 13, 0, 10, 49, 16074 }, // ₀
+    { 9, 14, 13, 1, 10, 32, 16123 }, // ₁
+    { 12, 14, 13, 0, 10, 42, 16155 }, // ₂
+    { 11, 15, 13, 1, 10, 42, 16197 }, // ₃
+    { 13, 14, 13, 0, 10, 46, 16239 }, // ₄
+    { 13, 14, 13, 0, 9, 46, 16285 }, // ₅
+    { 12, 15, 13, 1, 10, 45, 16331 }, // ₆
+    { 11, 14, 13, 2, 9, 39, 16376 }, // ₇
+    { 11, 15, 13, 1, 10, 42, 16415 }, // ₈
+    { 12, 15, 13, 0, 10, 45, 16457 }, // ₉
+    { 20, 20, 18, -1, 20, 100, 16502 }, // ₣
+    { 19, 22, 18, -1, 21, 105, 16602 }, // ₤
+    { 38, 22, 39, 0, 21, 209, 16707 }, // ₧
+    { 20, 22, 18, -1, 21, 110, 16916 }, // €
+    { 19, 14, 29, 5, 17, 67, 17026 }, // ←
+    { 13, 20, 29, 8, 20, 65, 17093 }, // ↑
+    { 19, 14, 29, 5, 17, 67, 17158 }, // →
+    { 13, 20, 29, 8, 20, 65, 17225 }, // ↓
+    { 19, 14, 29, 5, 17, 67, 17290 }, // ↔
+    { 13, 20, 29, 8, 20, 65, 17357 }, // ↕
+    { 15, 20, 29, 7, 20, 75, 17422 }, // ↨
+    { 13, 20, 29, 8, 20, 65, 17497 }, // ↲
+    { 13, 20, 29, 8, 20, 65, 17562 }, // ↳
+    { 17, 16, 29, 6, 18, 68, 17627 }, // ↵
+    { 19, 16, 29, 5, 18, 76, 17695 }, // ⇐
+    { 17, 18, 29, 6, 19, 77, 17771 }, // ⇑
+    { 19, 16, 29, 5, 18, 76, 17848 }, // ⇒
+    { 17, 18, 29, 6, 19, 77, 17924 }, // ⇓
+    { 19, 16, 29, 5, 18, 76, 18001 }, // ⇔
+    { 21, 22, 29, 4, 21, 116, 18077 }, // ∀
+    { 16, 24, 18, 1, 23, 96, 18193 }, // ∂
+    { 15, 21, 29, 7, 21, 79, 18289 }, // ∃
+    { 23, 24, 29, 3, 22, 138, 18368 }, // ∅
+    { 20, 21, 20, 0, 21, 105, 18506 }, // ∆
+    { 19, 22, 29, 5, 21, 105, 18611 }, // ∇
+    { 21, 21, 29, 4, 21, 111, 18716 }, // ∈
+    { 21, 26, 29, 4, 23, 137, 18827 }, // ∉
+    { 21, 18, 29, 4, 19, 95, 18964 }, // ∊
+    { 21, 21, 29, 4, 21, 111, 19059 }, // ∋
+    { 21, 26, 29, 4, 23, 137, 19170 }, // ∌
+    { 21, 18, 29, 4, 19, 95, 19307 }, // ∍
+    { 23, 26, 24, 1, 21, 150, 19402 }, // ∏
+    { 19, 26, 19, 0, 21, 124, 19552 }, // ∑
+    { 14, 4, 18, 2, 12, 14, 19676 }, // −
+    { 17, 23, 15, -1, 21, 98, 19690 }, // ∕
+    { 15, 23, 15, 0, 21, 87, 19788 }, // ∖
+    { 14, 14, 18, 2, 17, 49, 19875 }, // ∗
+    { 12, 11, 18, 3, 15, 33, 19924 }, // ∘
+    { 6, 6, 18, 6, 11, 9, 19957 }, // ∙
+    { 19, 28, 18, -1, 24, 133, 19966 }, // √
+    { 14, 12, 18, 2, 15, 42, 20099 }, // ∝
+    { 18, 11, 18, 0, 15, 50, 20141 }, // ∞
+    { 19, 21, 29, 5, 21, 100, 20191 }, // ∟
+    { 23, 21, 29, 3, 21, 121, 20291 }, // ∠
+    { 5, 30, 15, 5, 23, 38, 20412 }, // ∣
+    { 11, 30, 15, 2, 23, 83, 20450 }, // ∥
+    { 21, 21, 29, 4, 21, 111, 20533 }, // ∧
+    { 21, 21, 29, 4, 21, 111, 20644 }, // ∨
+    { 17, 21, 29, 6, 21, 90, 20755 }, // ∩
+    { 17, 22, 29, 6, 21, 94, 20845 }, // ∪
+    { 16, 30, 18, 1, 23, 120, 20939 }, // ∫
+    { 19, 18, 29, 5, 17, 86, 21059 }, // ∴
+    { 19, 18, 29, 5, 17, 86, 21145 }, // ∵
+    { 7, 17, 9, 1, 18, 30, 21231 }, // ∶
+    { 19, 18, 29, 5, 17, 86, 21261 }, // ∷
+    { 17, 7, 29, 6, 12, 30, 21347 }, // ∼
+    { 17, 17, 29, 6, 18, 73, 21377 }, // ≅
+    { 14, 12, 18, 2, 16, 42, 21450 }, // ≈
+    { 17, 12, 29, 6, 14, 51, 21492 }, // ≍
+    { 14, 15, 18, 2, 17, 53, 21543 }, // ≠
+    { 17, 15, 29, 6, 16, 64, 21596 }, // ≡
+    { 14, 18, 18, 2, 18, 63, 21660 }, // ≤
+    { 14, 18, 18, 2, 18, 63, 21723 }, // ≥
+    { 25, 14, 29, 2, 17, 88, 21786 }, // ≪
+    { 25, 14, 29, 2, 17, 88, 21874 }, // ≫
+    { 21, 18, 29, 4, 19, 95, 21962 }, // ⊃
+    { 21, 26, 29, 4, 23, 137, 22057 }, // ⊄
+    { 21, 26, 29, 4, 23, 137, 22194 }, // ⊅
+    { 19, 21, 29, 5, 21, 100, 22331 }, // ⊆
+    { 19, 21, 29, 5, 21, 100, 22431 }, // ⊇
+    { 21, 22, 29, 4, 21, 116, 22531 }, // ⊕
+    { 21, 22, 29, 4, 21, 116, 22647 }, // ⊖
+    { 21, 22, 29, 4, 21, 116, 22763 }, // ⊗
+    { 21, 22, 29, 4, 21, 116, 22879 }, // ⊘
+    { 17, 21, 29, 6, 21, 90, 22995 }, // ⊥
+    { 6, 6, 18, 6, 11, 9, 23085 }, // ⋅
+    { 25, 6, 29, 2, 11, 38, 23094 }, // ⋯
+    { 31, 30, 21, -6, 23, 233, 23132 }, // ﬀ
+    { 25, 30, 19, -6, 23, 188, 23365 }, // ﬁ
+    { 26, 30, 19, -6, 23, 195, 23553 }, // ﬂ
+    { 34, 30, 28, -6, 23, 255, 23748 }, // ﬃ
+    { 35, 30, 29, -6, 23, 263, 24003 }, // ﬄ
+    { 28, 30, 22, -6, 23, 210, 24266 }, // ﬅ
+    { 25, 22, 24, -1, 21, 138, 24476 }, // ﬆ
+    { 27, 28, 29, 1, 24, 189, 24614 }, // �
 };
 
 static const EpdUnicodeInterval bookerly_14_bolditalicIntervals[] = {
@@ -2786,32 +2820,338 @@ static const EpdUnicodeInterval bookerly_14_bolditalicIntervals[] = {
     { 0x22A5, 0x22A5, 0x2E7 },
     { 0x22C5, 0x22C5, 0x2E8 },
     { 0x22EF, 0x22EF, 0x2E9 },
-    { 0xFFFD, 0xFFFD, 0x2EA },
+    { 0xFB00, 0xFB06, 0x2EA },
+    { 0xFFFD, 0xFFFD, 0x2F1 },
 };
 
 static const EpdFontGroup bookerly_14_bolditalicGroups[] = {
-    { 0, 4496, 8355, 100, 0 },
-    { 4496, 4486, 9971, 96, 100 },
-    { 8982, 6250, 15878, 128, 196 },
-    { 15232, 405, 481, 33, 324 },
-    { 15637, 10503, 26163, 220, 357 },
-    { 26140, 1355, 2546, 74, 577 },
-    { 27495, 541, 759, 18, 651 },
-    { 28036, 323, 524, 4, 669 },
-    { 28359, 594, 1051, 15, 673 },
-    { 28953, 2300, 5055, 58, 688 },
-    { 31253, 116, 189, 1, 746 },
+    { 0, 6177, 14274, 151, 5 },
+    { 6177, 3691, 7305, 66, 358 },
+    { 9868, 10373, 26072, 261, 0 },
+    { 20241, 11567, 24803, 276, 471 },
+};
+
+static const uint8_t bookerly_14_bolditalicGlyphGroups[754] = {
+    2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0,
+    2, 2, 2, 2, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0,
+    0, 2, 2, 2, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0,
+    0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 3, 3, 3, 0, 0, 3, 3, 0, 0, 3,
+    3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+};
+
+static const uint8_t bookerly_14_bolditalicKernLeftClasses[754] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 55, 0, 123,
+    0, 2, 100, 2, 30, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 126,
+    126, 0, 0, 0, 0, 0, 3, 105, 112, 11, 63, 73, 52, 17, 17, 46,
+    56, 39, 119, 23, 11, 69, 53, 24, 65, 19, 5, 18, 18, 81, 12, 79,
+    86, 34, 0, 0, 0, 0, 28, 25, 92, 80, 62, 36, 21, 31, 80, 109,
+    128, 110, 31, 31, 25, 25, 102, 42, 77, 93, 28, 40, 40, 127, 40, 72,
+    64, 0, 0, 0, 0, 89, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 100, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 85,
+    0, 0, 0, 60, 3, 3, 3, 3, 3, 3, 63, 112, 63, 63, 63, 63,
+    17, 17, 17, 17, 11, 23, 11, 11, 11, 11, 11, 0, 11, 5, 5, 5,
+    5, 12, 76, 141, 28, 28, 28, 28, 28, 28, 62, 137, 62, 62, 62, 62,
+    80, 132, 29, 29, 25, 31, 25, 25, 25, 25, 25, 0, 99, 28, 28, 28,
+    28, 40, 25, 40, 3, 28, 3, 28, 48, 67, 112, 92, 112, 92, 112, 92,
+    112, 92, 11, 26, 11, 80, 63, 62, 63, 62, 63, 62, 104, 120, 63, 62,
+    52, 21, 52, 21, 52, 21, 52, 21, 17, 31, 98, 31, 17, 29, 17, 29,
+    17, 29, 82, 108, 17, 28, 46, 109, 46, 124, 56, 128, 135, 39, 110, 39,
+    138, 0, 26, 0, 0, 39, 129, 23, 31, 23, 31, 23, 31, 31, 23, 109,
+    11, 25, 11, 25, 11, 25, 63, 62, 24, 42, 24, 42, 24, 42, 65, 77,
+    65, 77, 65, 122, 65, 77, 19, 134, 19, 0, 19, 93, 5, 28, 5, 28,
+    5, 28, 5, 28, 5, 28, 5, 67, 18, 40, 12, 40, 12, 79, 72, 79,
+    72, 79, 72, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 94, 94, 87, 0, 142, 116, 1, 1, 49, 20, 20,
+    57, 6, 1, 4, 1, 14, 139, 38, 15, 27, 94, 6, 38, 1, 1, 6,
+    1, 91, 1, 10, 1, 32, 111, 51, 4, 70, 41, 27, 1, 1, 27, 20,
+    1, 20, 10, 10, 1, 13, 106, 90, 114, 84, 68, 68, 90, 13, 13, 66,
+    13, 13, 13, 16, 59, 16, 107, 59, 37, 84, 78, 9, 13, 13, 9, 101,
+    13, 33, 16, 16, 13, 68, 68, 113, 114, 107, 117, 140, 103, 115, 33, 33,
+    59, 66, 13, 37, 13, 121, 33, 10, 16, 44, 95, 27, 9, 20, 33, 32,
+    16, 45, 74, 43, 114, 0, 0, 88, 61, 38, 90, 75, 61, 6, 66, 6,
+    66, 6, 66, 27, 9, 0, 0, 0, 0, 96, 136, 111, 107, 15, 9, 22,
+    71, 22, 71, 47, 83, 27, 9, 27, 9, 1, 13, 58, 59, 130, 68, 130,
+    68, 1, 6, 68, 54, 133, 27, 9, 49, 115, 27, 9, 1, 0, 27, 9,
+    118, 14, 13, 14, 13, 94, 68, 94, 68, 10, 16, 10, 16, 6, 68, 38,
+    90, 131, 125, 1, 13, 1, 13, 10, 16, 10, 16, 10, 16, 10, 16, 4,
+    37, 4, 37, 4, 37, 1, 13, 15, 114, 1, 13, 43, 114, 50, 97, 41,
+    78, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 100, 100, 0, 100, 100, 100, 0, 0, 8, 7, 35, 8, 8, 7, 2,
+    0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 85, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 36, 80, 110, 80, 110, 93,
+    93, 0,
+};
+
+static const uint8_t bookerly_14_bolditalicKernRightClasses[754] = {
+    0, 0, 0, 0, 0, 0, 89, 96, 0, 0, 0, 0, 96, 0, 83, 37,
+    0, 29, 48, 2, 35, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 41,
+    40, 0, 0, 0, 67, 0, 4, 34, 5, 34, 6, 6, 5, 6, 6, 58,
+    6, 6, 92, 6, 5, 34, 5, 34, 89, 30, 10, 24, 24, 79, 22, 103,
+    0, 12, 94, 0, 0, 0, 1, 8, 1, 1, 1, 15, 16, 8, 61, 64,
+    8, 8, 17, 17, 1, 17, 1, 17, 25, 52, 26, 21, 21, 90, 70, 82,
+    0, 0, 91, 0, 0, 109, 0, 0, 0, 0, 0, 0, 0, 0, 0, 43,
+    0, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 59,
+    0, 0, 0, 102, 4, 4, 4, 4, 4, 4, 56, 5, 6, 6, 6, 6,
+    6, 6, 6, 6, 34, 6, 5, 5, 5, 5, 5, 0, 5, 10, 10, 10,
+    10, 22, 6, 81, 1, 1, 1, 1, 54, 1, 1, 1, 1, 1, 1, 1,
+    93, 61, 42, 42, 1, 17, 1, 1, 1, 1, 1, 0, 65, 26, 26, 26,
+    26, 21, 66, 21, 4, 1, 4, 1, 4, 1, 5, 1, 5, 1, 5, 1,
+    5, 54, 34, 1, 34, 1, 6, 1, 6, 1, 6, 1, 6, 1, 6, 1,
+    5, 16, 5, 16, 5, 16, 5, 16, 6, 8, 6, 8, 6, 42, 6, 42,
+    6, 42, 6, 61, 6, 17, 6, 61, 58, 104, 6, 8, 17, 6, 8, 6,
+    8, 6, 8, 6, 8, 6, 63, 6, 17, 6, 17, 6, 17, 17, 6, 17,
+    5, 1, 5, 1, 5, 1, 5, 1, 34, 17, 34, 17, 34, 17, 89, 25,
+    89, 25, 89, 25, 89, 74, 30, 52, 30, 52, 30, 52, 10, 26, 10, 26,
+    10, 26, 10, 26, 10, 26, 10, 26, 24, 21, 22, 21, 22, 103, 82, 103,
+    82, 103, 82, 81, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 7, 7, 20, 7, 28, 105, 7, 7, 69, 38, 7,
+    20, 7, 7, 46, 7, 23, 7, 71, 7, 68, 7, 45, 97, 7, 7, 7,
+    38, 88, 7, 28, 7, 71, 28, 20, 46, 78, 39, 7, 27, 7, 7, 20,
+    7, 7, 99, 7, 73, 3, 86, 3, 75, 76, 3, 33, 36, 19, 19, 11,
+    18, 53, 11, 3, 11, 87, 3, 11, 9, 3, 80, 19, 14, 19, 19, 77,
+    19, 19, 36, 11, 72, 3, 3, 44, 75, 3, 84, 100, 95, 51, 18, 11,
+    44, 11, 19, 9, 19, 20, 11, 28, 3, 60, 50, 7, 11, 106, 98, 71,
+    11, 7, 85, 7, 75, 7, 11, 45, 33, 97, 36, 7, 11, 7, 11, 0,
+    0, 20, 0, 7, 11, 7, 11, 7, 11, 28, 3, 28, 3, 20, 11, 47,
+    9, 47, 9, 39, 80, 0, 0, 27, 14, 27, 14, 7, 44, 49, 31, 49,
+    31, 7, 45, 33, 7, 11, 38, 18, 7, 11, 7, 11, 27, 14, 0, 53,
+    101, 23, 3, 23, 3, 57, 3, 7, 3, 107, 62, 0, 62, 45, 33, 97,
+    36, 108, 55, 7, 19, 7, 19, 28, 3, 28, 3, 28, 3, 0, 36, 46,
+    9, 46, 9, 46, 9, 0, 14, 7, 75, 7, 19, 7, 75, 39, 80, 39,
+    80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 48, 48, 0, 48, 48, 48, 0, 0, 13, 32, 2, 13, 13, 32, 2,
+    0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 43, 59, 0, 89, 0, 0, 0,
+    67, 67, 89, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 15, 15, 15, 15, 15,
+    25, 0,
+};
+
+static const int8_t bookerly_14_bolditalicKernMatrix[15730] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, -1, 1, 1, 0, -1, -1, 0, 0, -3, -2, 1, 1, 0, 0, -1, -1, -1, -2, 1, -3, 0, -1, -2, -1, 0, -1, -1, -3, 0, 1, 0, 0, 0, 1, 1, 0, 0, 0, -1, 0, 1, 0, -2, 0, -4, -1, 3, -1, 0, 0, 0, 1, 1, 3, 0, -3, -1, 0, 0, 3, 0, 0, 0, 1, 3, -1, 1, 0, 1, 0, 0, 0, -2, -1, 1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, -1, 1, 0, 0, 0, -1, 0, -5, -3, 0, 0, 1, -1, 0, 0, 0, -2, -2, 0, -4, 0, 0, 0, 0, 0, -2, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 1, 0, 0, 0, 0, -1, 0, 0, 0, 1, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -4, -2, 0, 0, 0, 0, 0, 0, 0, -1, 2, 0, -1, 0, 0, 0, -4, -1, 1, 0, 0, -4, 0, 0, 0, 1, 0, -4, 0, -2, 1, -2, 0, -3, -1, 2, -2, 1, -1, -1, 0, 0, 2, 0, 0, 1, 0, 0, 0, 0, 0, -1, 0, -1, 0, -5, 0, -1, 1, 0, -1, 0, 0, 0, 0, 0, -2, 0, 0, 1, -3, -1, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, -2, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -2, 0, -2, -1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 1, 0, -1, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, -1, 1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 1, 0, 0, 0, 0, -1, 0, 0, -2, 0, 0, 0, 0, -1, 1, 1, 1, 0, 0, 0, -1, 1, 1, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, -1, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -3, -5, -3, -4, -2, -1, -1, -1, 0, -1, -1, 0, 0, 0, -1, -3, -1, -5, -1, -1, 0, -1, -4, -1, -2, -1, 0, -2, -5, -1, -2, 0, -2, 0, 0, -2, 0, -4, -1, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, -2, -3, 0, -4, -4, -1, 0, -1, -1, 0, -1, 0, -3, -1, -1, -3, -1, 0, 0, -3, -2, -2, -1, -3, 0, -1, -1, -1, 0, -1, 0, -2, -2, -2, -1, -1, -1, -1, 0, -1, -1, 0, 0, 0, -2, 0, -1, -1, -1, 0, -1, 0, -1, 0, 0, -1, 0,
+    0, -2, -3, -2, -3, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, -1, -2, 0, -5, 0, 0, 0, 0, -3, -1, -2, 0, 0, -1, -3, 0, 0, 0, -1, 0, 0, -1, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, -3, -3, 0, 0, -1, 0, -1, 0, 0, -2, 0, 0, -2, 0, 0, 0, -2, -2, -2, 0, -2, 0, 0, 0, -1, 0, -1, 0, -2, -2, -1, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, -1, 0, 0, 0, -1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 5, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -3, 0, -3, -1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 1, 0, 1, -1, -1, 0, 0, -3, 1, 0, 0, 0, 1, -2, 0, 2, 0, 0, -2, -2, 1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, -3, 0, 0, -1, 0, 0, 0, 1, 0, -1, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, -2, 0, -1, -5, -3, -2, 0, 0, 0, 0, 0, -2, 0, 0, 1, 0, 0, 0, -4, -1, 0, 0, -2, -2, 0, 0, 0, 0, -1, 1, 2, 0, 0, 0, -1, 0, 1, -1, -2, 0, -3, -2, 0, 0, 0, 0, -1, 0, 1, 0, 0, -4, 0, 0, 0, 0, 0, 0, -1, 1, 0, 0, 0, 0, 1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -3, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, -4, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, -3, 0, -3, 1, -1, 0, -2, -1, 3, -1, 0, -1, -1, 0, -1, 1, 0, 0, 1, 0, 0, 1, 0, 0, -1, 0, -1, 0, -3, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 1, -2, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 1, 0, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, -4, 0, -3, -1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, -2, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0, 0, 0, -4, 0, 0, 0, 0, 1, -3, 0, 1, 0, 0, -2, -2, 1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -2, 0, -4, 0, 0, -1, 0, 0, 0, 1, 0, -2, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, -1, -3, 0, -2, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 1, 1, 0, 0, -1, 0, 0, 0, -3, 0, 0, 1, 0, 1, -2, 0, 3, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -3, 0, 0, 0, 0, 0, 0, 1, 0, -1, 1, 0, 0, 0, 1, 0, 0, 0, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -3, -2, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, -2, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 3, 1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 2, 0, 0, 1, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 3, 0, 1, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -3, -1, 0, 0, 0, 0, 0, 0, 0, -1, 1, 0, -1, 0, 0, 0, -3, -1, 1, 0, 0, -2, 0, 0, 0, 1, -1, -3, 0, -3, 0, -1, 0, -2, -1, 2, -2, 1, -1, -1, 0, -1, 1, 0, 1, 1, -1, 0, 0, 0, 0, -1, 0, -1, 0, -3, 0, -1, 1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 1, -2, -1, 0, -1, 0, -1, -1, 0, -1, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -1, 0, -1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 1, 0, -1, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, -1, 1, 0, 0, 0, -2, 0, -3, -2, 0, -1, 0, 0, 0, 0, 0, -1, -2, 0, -2, 0, -1, 0, 0, 0, -2, 0, -1, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 4, 2, 0, 1, 1, 2, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 4, 1, 0, 4, 3, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 3, 0, 0, 0, 0, 0, 0, 1, 2, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -3, 0, -3, -3, -1, 0, 0, 1, 0, 0, -1, 0, 0, 0, -1, -3, -1, -3, -1, 0, 0, 0, -3, 0, -3, -1, 0, -1, 0, 0, -1, 0, -2, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, -1, -2, -3, -1, -4, -4, 0, 0, 0, 0, -2, 1, 0, -3, 1, 0, -2, 0, 0, 0, -3, -1, -3, -1, -1, -1, -1, 0, -1, 0, -2, 0, -3, -2, -1, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, -1, 0, 0, 0, -1, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, -2, 0, -1, 0, 0, 0, -2, 0, 0, -2, 0, -1, -1, 0, 0, 0, -1, -1, -1, 0, 0, 1, 0, 0, -1, 0, 0, 0, -4, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -2, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -4, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 2, -1, 1, 1, 1, -1, -1, 0, 0, 0, -2, 2, 2, 0, 0, 0, -2, -1, -3, 2, -3, 0, 0, -2, -1, 0, -2, 0, 0, 0, 1, 0, 0, 0, 2, 2, 0, 0, 0, 0, 1, 1, 0, -3, 0, -2, -1, 1, 0, 0, 0, 0, 1, 1, 4, 0, -3, 0, 0, 1, 1, 0, 1, 0, 2, 4, -1, 1, 0, 2, 0, 0, 0, -1, -1, 2, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, -1, 1, 1, 0, 0, -1, 0, 0, -3, -2, 2, 1, 0, 0, -1, -1, -1, -2, 1, -3, 0, -1, -2, -1, 0, -1, -1, -3, 0, 1, 0, 0, 0, 1, 1, 0, 0, 0, -1, 0, 1, 0, -2, 0, -4, 0, 3, -1, 0, 0, 0, 1, 1, 3, 0, -3, -1, 0, 0, 3, 0, 0, 0, 1, 3, 1, 1, 0, 1, 0, 0, 0, -2, -1, 1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -2, 0, 0, 0, 0, 0, 2, 0, 0, 0, 3, 1, 0, 0, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 2, 0, 0, -1, 0, 3, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, -1, 2, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, -2, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, -2, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 1, 0, 0, 0, 1, -1, -1, 0, -2, 0, 0, 0, 0, 0, 1, 1, 1, -1, -1, 0, -1, 1, 1, 0, 1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, -1, 0, -1, 1, 0, 0, -1, 0, 0, -1, 0, -1, -1, 0, -1, 1, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -3, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0, -3, 0, 0, 0, 0, -1, -3, 0, -3, 0, -1, 0, -3, -1, 0, -2, 1, -2, -2, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -4, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0, -3, -1, 0, -1, -1, 0, -1, 0, -1, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -4, -1, 0, 0, 0, -2, 0, 0, 0, 1, 0, -2, 0, -3, 1, -2, 0, -2, -2, 1, -2, 0, -1, -1, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, -2, 0, -1, 0, -4, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0, -1, -1, 0, -1, 0, -2, -1, 0, 0, 0, 0, 0, -1, -2, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, -1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 1, -1, 0, 1, 0, 0, -1, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -1, 0, 0, 0, 1, 0, 3, 0, 0, 1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 1, 0, 0, 0, 1, -1, 0, 0, -2, 0, 0, 0, 0, 0, 1, 2, 2, 0, -1, 0, -1, 1, 2, 0, 1, 0, -1, 3, 4, 0, 0, 0, 1, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 4, 0, 1, 0, 2, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 1, -1, 1, 0, 0, 0, -1, 0, -5, -3, 0, 4, 2, -1, 0, 0, 0, -2, -2, 0, -4, 0, 0, 0, 0, 0, -2, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 1, 0, 4, 0, 0, -1, 0, 0, 4, 1, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -2, 0, -1, 0, -1, 0, -1, -1, 1, -1, 1, -1, -1, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, -1, 1, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 1, -1, -1, 0, -2, 0, 0, 0, 0, -1, 1, -1, 1, -1, -1, 0, -1, 1, 1, 0, 1, 0, -1, 0, 2, 0, -1, 0, -1, 0, 1, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 1, 3, 0, 1, -2, -1, 0, -2, -2, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, -1, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -3, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, -4, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -3, 0, -3, 1, -1, 0, -2, -1, 3, -1, 0, -1, -1, 0, -1, 1, 0, 0, 1, 0, 0, 1, 0, 0, -1, 0, -1, 0, -3, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 1, -2, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 1, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 5, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 5, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 3, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 6, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -2, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -2, 0, -1, 0, -1, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, -1, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, -2, -1, -1, 0, -1, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0,
+    0, -1, 0, -1, 0, -1, 0, 0, 2, 2, 0, 0, 0, 0, 0, 4, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 2, 4, 0, 0, -1, 0, 0, 0, 3, 0, 0, 0, 0, 2, 4, -1, 2, 0, 1, 3, 3, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, 1, -1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, -1, 1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, -1, -2, -2, -3, 0, 0, 0, 0, -1, -3, 0, 0, 0, 0, 0, 0, -3, -1, 0, 0, -1, -2, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, -1, -3, 0, -3, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -3, 0, -2, 0, 0, 0, 0, -1, -3, 0, 0, 0, 0, 0, 0, -4, -1, 0, 0, -1, -2, 0, 0, 0, 0, -3, 0, 1, 0, 0, 0, 0, 0, 0, -1, -3, 0, -3, -1, 0, 0, 0, 0, -2, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 4, 1, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 4, 0, 0, -1, 0, 0, 0, 4, 0, -1, 0, 0, -1, 4, -1, -1, 0, 0, 4, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 5, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, -1, 0, 0, 0, 0, 2, 1, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 1, 3, 0, 0, -1, 0, 0, 0, 2, 0, 0, 0, 0, 2, 3, -1, 2, 0, 0, 2, 1, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, 0, 4, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -2, 0, -3, 0, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 1, -1, 0, -1, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -2, 0, -3, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, 0, 1, 0, 0, -1, 0, 0, 0, 0, -1, -1, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -3, 0, 0, 0, 0, 0, 0, 1, 0, -1, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, 2, -1, 0, 0, -1, 1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 4, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 4, 0, 1, 0, 1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, -2, 0, -2, 0, -1, 0, 0, 0, -1, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, 0, 0, 0, 0, -2, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, -2, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -1, 0, 1, -1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, -1, -1, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, -1, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 3, -1, 0, 0, 0, 1, 4, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 1, -2, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 5, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 3, 0, 2, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 1, -1, -1, 0, -1, -1, 2, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 4, 0, 1, 0, 1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 3, 0, -1, 0, 0, -1, 2, 0, -1, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, -1, 0, 1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, -1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 1, 0, 1, -2, 0, 1, 0, 0, 0, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 3, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 1, 0, -1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 3, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 3, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 3, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t bookerly_14_bolditalicGlyphLookup[368] = {
+    0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0001, 0x0002, 0xFFFF, 0xFFFF, 0xFFFF, 0x0003, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0004, 0xFFFF, 0xFFFF,
+    0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, 0x0010, 0x0011, 0x0012, 0x0013, 0x0014,
+    0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, 0x0020, 0x0021, 0x0022, 0x0023, 0x0024,
+    0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, 0x0030, 0x0031, 0x0032, 0x0033, 0x0034,
+    0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, 0x0040, 0x0041, 0x0042, 0x0043, 0x0044,
+    0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051, 0x0052, 0x0053, 0x0054,
+    0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, 0x0060, 0x0061, 0x0062, 0x0063, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x0072, 0x0073,
+    0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, 0x0080, 0x0081, 0x0082, 0x0083,
+    0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F, 0x0090, 0x0091, 0x0092, 0x0093,
+    0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F, 0x00A0, 0x00A1, 0x00A2, 0x00A3,
+    0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF, 0x00B0, 0x00B1, 0x00B2, 0x00B3,
+    0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF, 0x00C0, 0x00C1, 0x00C2, 0x00C3,
+    0x0241, 0x0242, 0x0243, 0x0244, 0x0245, 0x0246, 0x0247, 0x0248, 0x0249, 0x024A, 0x024B, 0x024C, 0x024D, 0x024E, 0x024F, 0x0250,
+    0x0251, 0x0252, 0x0253, 0x0254, 0x0255, 0x0256, 0x0257, 0x0258, 0x0259, 0x025A, 0x025B, 0x025C, 0x025D, 0x025E, 0x025F, 0x0260,
+    0x0261, 0x0262, 0x0263, 0x0264, 0x0265, 0x0266, 0x0267, 0x0268, 0x0269, 0x026A, 0x026B, 0x026C, 0x026D, 0x026E, 0x026F, 0x0270,
+    0x0271, 0xFFFF, 0x0272, 0x0273, 0x0274, 0x0275, 0x0276, 0x0277, 0x0278, 0x0279, 0x027A, 0x027B, 0x027C, 0xFFFF, 0x027D, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x027E, 0x027F, 0xFFFF, 0xFFFF, 0x0280, 0x0281, 0x0282, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x0283, 0xFFFF, 0xFFFF, 0xFFFF, 0x0284, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0285,
+    0x0286, 0x0287, 0x0288, 0x0289, 0x028A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
 };
 
 static const EpdFontData bookerly_14_bolditalic = {
     bookerly_14_bolditalicBitmaps,
     bookerly_14_bolditalicGlyphs,
     bookerly_14_bolditalicIntervals,
-    64,
+    65,
     38,
     31,
     -8,
     true,
     bookerly_14_bolditalicGroups,
-    11,
+    4,
+    bookerly_14_bolditalicKernLeftClasses,
+    bookerly_14_bolditalicKernRightClasses,
+    bookerly_14_bolditalicKernMatrix,
+    110,
+    nullptr,
+    0,
+    0,
+    bookerly_14_bolditalicGlyphLookup,
+    bookerly_14_bolditalicGlyphGroups,
+    false,
+    nullptr,
 };
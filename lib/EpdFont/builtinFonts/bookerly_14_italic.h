@@ -3,1802 +3,1837 @@
  * name: bookerly_14_italic
  * size: 14
  * mode: 2-bit  compressed: true
- * Command used: fontconvert.py bookerly_14_italic 14 ../builtinFonts/source/Bookerly/Bookerly-Italic.ttf --2bit --compress
+ * Command used: fontconvert.py bookerly_14_italic 14 ../builtinFonts/source/Bookerly/Bookerly-Italic.ttf --2bit --compress --frequency-corpus ../../../test/hyphenation_eval/resources/english_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/french_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/german_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/italian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/russian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/spanish_hyphenation_tests.txt
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t bookerly_14_italicBitmaps[28638] = {
-    0x8D, 0x59, 0x3D, 0xAC, 0x1C, 0xD7, 0x75, 0x3E, 0x33, 0x43, 0xBE, 0x31, 0x34, 0x90, 0x2E, 0x0B,
-    0x09, 0x01, 0xF2, 0x64, 0x4D, 0x4A, 0x02, 0xB1, 0xDE, 0x34, 0x2C, 0x54, 0xBC, 0xDD, 0x19, 0x9B,
-    0x80, 0x03, 0x84, 0x85, 0x58, 0xE8, 0xC5, 0x40, 0x5C, 0xC8, 0x45, 0x52, 0x44, 0x0E, 0xF4, 0x5C,
-    0xA8, 0x60, 0xB1, 0x6F, 0x77, 0x28, 0x17, 0x2C, 0x5C, 0xE4, 0x55, 0x81, 0x3B, 0xAB, 0x70, 0x90,
-    0xF8, 0x19, 0x09, 0x59, 0x10, 0xC1, 0x0B, 0xB0, 0xEF, 0xED, 0x48, 0x2A, 0x04, 0xC4, 0x85, 0xC6,
-    0x12, 0x12, 0x17, 0x2A, 0x3C, 0x88, 0xCC, 0x08, 0xB0, 0x00, 0xF1, 0x5A, 0x1C, 0x4A, 0x23, 0x6A,
-    0x76, 0xAF, 0xBF, 0xEF, 0xDC, 0xD9, 0xC7, 0x25, 0x65, 0x03, 0x5E, 0xEC, 0xEF, 0xFC, 0x9C, 0x7B,
-    0x7E, 0xBE, 0xF3, 0x9D, 0x73, 0xEE, 0xCA, 0x79, 0x31, 0x65, 0x52, 0x47, 0x56, 0x3A, 0x39, 0x90,
-    0x0C, 0x3F, 0xA2, 0x5A, 0xAC, 0x4C, 0xE4, 0x39, 0x49, 0x8A, 0xB0, 0xC2, 0xD7, 0x5D, 0xF9, 0x9A,
-    0xE8, 0x63, 0x2E, 0x79, 0x61, 0xAA, 0xA0, 0x90, 0xB0, 0x38, 0x6C, 0x47, 0x69, 0xFC, 0x96, 0x9D,
-    0xEF, 0x24, 0x3F, 0xAC, 0xDB, 0x5D, 0x13, 0x95, 0xCD, 0xA5, 0x27, 0xFD, 0x45, 0xB2, 0x1B, 0x55,
-    0x12, 0x97, 0x2F, 0x88, 0xDC, 0x8E, 0x0B, 0x31, 0x72, 0x4B, 0x8E, 0x1E, 0xDC, 0xFC, 0x99, 0x71,
-    0xCE, 0xD5, 0x61, 0xBD, 0x23, 0xF2, 0x0D, 0xC8, 0x8C, 0xAA, 0x5D, 0x91, 0x17, 0x70, 0x5D, 0x52,
-    0x1E, 0x4B, 0x8E, 0x53, 0x5B, 0x37, 0x8F, 0x1E, 0xBC, 0x21, 0xD6, 0x88, 0x3C, 0x17, 0x34, 0x12,
-    0xD6, 0xCF, 0x7B, 0x31, 0x1B, 0x8F, 0x04, 0x2F, 0x9C, 0x96, 0xA7, 0xF0, 0x7A, 0x15, 0x3F, 0x5D,
-    0x2D, 0xB3, 0x45, 0x2F, 0xDD, 0x0B, 0x27, 0xA1, 0x7D, 0x6D, 0x1C, 0x35, 0xB7, 0x46, 0x91, 0xB5,
-    0x12, 0x76, 0x8D, 0x08, 0x4E, 0xC9, 0x0C, 0x9F, 0x66, 0x29, 0x12, 0xB9, 0x42, 0xE2, 0xFD, 0xEA,
-    0x42, 0x92, 0x34, 0xB7, 0x4D, 0xDC, 0x74, 0x4F, 0xC5, 0x4D, 0xFF, 0xF5, 0xA4, 0x5E, 0xFC, 0x63,
-    0x56, 0xE6, 0x6E, 0x25, 0xB1, 0x6B, 0x45, 0xAE, 0x41, 0xE4, 0x2D, 0xBC, 0xAC, 0x7F, 0x85, 0xB8,
-    0x15, 0x36, 0x6E, 0x3C, 0x82, 0x52, 0x52, 0x5C, 0xD7, 0x4A, 0x7A, 0xB3, 0x80, 0x97, 0x52, 0x5C,
-    0x31, 0x17, 0x53, 0x4C, 0xE0, 0xA4, 0xB8, 0x32, 0x32, 0x82, 0xC2, 0x71, 0x05, 0xD3, 0xDA, 0xA0,
-    0x49, 0xA1, 0xB8, 0xB4, 0x50, 0x14, 0xA7, 0x4D, 0xF1, 0x6A, 0xD8, 0x8C, 0x92, 0xD2, 0xD9, 0xE9,
-    0x49, 0x5C, 0x75, 0x3B, 0xF1, 0x32, 0xAA, 0x8E, 0xE3, 0x0A, 0x57, 0xEF, 0x62, 0x9D, 0xB0, 0xD9,
-    0xC1, 0xA5, 0x81, 0x35, 0x05, 0xEE, 0x69, 0xA3, 0x3A, 0x29, 0xE5, 0x18, 0x9F, 0x15, 0x44, 0xEF,
-    0x60, 0x01, 0x88, 0xFE, 0x5F, 0x2B, 0x63, 0x91, 0x45, 0x43, 0xBB, 0x1F, 0x55, 0x08, 0x8F, 0x05,
-    0x0F, 0xA4, 0x8E, 0xEF, 0xED, 0x98, 0xFE, 0x81, 0x27, 0xE9, 0x34, 0xD8, 0x1E, 0xD8, 0x94, 0x07,
-    0xDE, 0xB2, 0x72, 0x4E, 0xB2, 0xA9, 0xC8, 0x25, 0x59, 0x94, 0x12, 0xD7, 0x89, 0x95, 0xED, 0x55,
-    0xF0, 0x65, 0xBD, 0xED, 0x4A, 0x63, 0xAE, 0xBB, 0x4A, 0xDA, 0x2C, 0x7E, 0x11, 0x91, 0x1A, 0x43,
-    0x8D, 0x91, 0x9C, 0x84, 0x35, 0x0C, 0xEC, 0x8D, 0x44, 0x75, 0xB0, 0x6C, 0x05, 0x61, 0x76, 0xB0,
-    0xBA, 0x8E, 0x57, 0x22, 0x19, 0x02, 0x84, 0xEF, 0xAE, 0x5E, 0xDC, 0xA7, 0x1E, 0xFB, 0x1D, 0xD7,
-    0x3F, 0x5F, 0x84, 0x97, 0x7F, 0x89, 0xF8, 0x9B, 0xCB, 0x55, 0x73, 0xC9, 0xAB, 0x84, 0xC0, 0xC6,
-    0x0D, 0x16, 0x92, 0xA4, 0xE2, 0x13, 0x96, 0x42, 0x9B, 0xA8, 0x81, 0x3E, 0x02, 0xAF, 0xC1, 0x22,
-    0xD9, 0xA1, 0x5F, 0x10, 0x7D, 0x3D, 0x84, 0xDF, 0x99, 0xF0, 0x42, 0xFE, 0xD8, 0xD5, 0x33, 0xA1,
-    0x3F, 0x6C, 0x4A, 0x3D, 0x86, 0xB3, 0xB8, 0x1B, 0xBA, 0x49, 0xE0, 0x17, 0xB8, 0x28, 0x74, 0x08,
-    0xCE, 0x42, 0x2E, 0x2F, 0x6D, 0x09, 0x49, 0xDE, 0x3A, 0x56, 0xD1, 0xD9, 0xC6, 0x73, 0x47, 0x0F,
-    0x8E, 0x54, 0x5C, 0x47, 0x69, 0x90, 0x84, 0xA5, 0xD2, 0x82, 0xC7, 0x3A, 0xEA, 0x99, 0x15, 0xBC,
-    0xF9, 0x82, 0xD7, 0xBC, 0x7E, 0x76, 0x1C, 0xDD, 0xAB, 0xD2, 0xDB, 0x57, 0x53, 0x97, 0xDC, 0xBF,
-    0x77, 0xAF, 0xFC, 0xC6, 0x2E, 0x6F, 0xF0, 0x27, 0xE1, 0x7D, 0x42, 0x71, 0x50, 0x52, 0x80, 0xE4,
-    0x7B, 0xCE, 0xF5, 0x94, 0xF3, 0xC8, 0x99, 0xF3, 0xB8, 0xF4, 0x7B, 0xA6, 0x49, 0xCB, 0x83, 0x10,
-    0x31, 0xED, 0x4C, 0xF9, 0x77, 0xF2, 0xCA, 0xD1, 0xCC, 0x7D, 0xEC, 0xDA, 0xAD, 0xE4, 0xC3, 0xAE,
-    0x3F, 0x47, 0x51, 0x3B, 0x03, 0x88, 0x61, 0x02, 0xDD, 0x43, 0x3B, 0xD4, 0x10, 0x85, 0x1E, 0xE3,
-    0x07, 0x6D, 0x29, 0x98, 0x16, 0xE8, 0x85, 0xC9, 0xE3, 0x17, 0xB6, 0x8F, 0x5D, 0xC8, 0x48, 0xC3,
-    0x71, 0x9B, 0xF8, 0x88, 0x09, 0x79, 0x60, 0x3B, 0x5C, 0x7E, 0xB7, 0x95, 0xA9, 0x64, 0x95, 0xA9,
-    0xA4, 0x47, 0x7A, 0x9B, 0x0A, 0x58, 0xE8, 0xE1, 0x04, 0x53, 0xF5, 0xF8, 0x92, 0x96, 0x62, 0xDE,
-    0x6A, 0x25, 0xE8, 0x72, 0x2C, 0x77, 0x19, 0x0E, 0xB2, 0xF8, 0x32, 0xD5, 0xEB, 0x72, 0x09, 0xDB,
-    0xA8, 0xC3, 0xBD, 0x69, 0x9D, 0x55, 0xE2, 0x1C, 0x32, 0x12, 0x2F, 0x91, 0xF5, 0x1A, 0x13, 0x49,
-    0xFB, 0xD0, 0x75, 0xF2, 0xF3, 0x96, 0x4A, 0x45, 0xEA, 0x5C, 0x86, 0x5D, 0x23, 0x8F, 0xD5, 0x60,
-    0x1E, 0x1C, 0x0D, 0x1B, 0x72, 0x7D, 0x62, 0xD9, 0x13, 0xC0, 0xC7, 0xCE, 0x9C, 0xF5, 0xF7, 0x03,
-    0x41, 0x81, 0x73, 0x55, 0xB0, 0xFA, 0x4E, 0x2F, 0xBD, 0xCC, 0x20, 0xCF, 0x54, 0x4F, 0x51, 0x8E,
-    0x04, 0xD0, 0x4C, 0x90, 0xB6, 0x72, 0x4A, 0x88, 0x6F, 0xBC, 0x56, 0xFE, 0x15, 0xE0, 0x5C, 0x08,
-    0x2C, 0x45, 0xF0, 0x43, 0xB4, 0x3A, 0x3A, 0xFA, 0x16, 0xA0, 0x59, 0xCD, 0x1C, 0x33, 0x5E, 0x13,
-    0x15, 0x5F, 0x52, 0xC4, 0x66, 0xF6, 0xCF, 0x4B, 0x08, 0x9E, 0xC2, 0xAD, 0x58, 0x1B, 0x8B, 0xAB,
-    0xDC, 0x18, 0xF2, 0x67, 0xA5, 0x6C, 0x3B, 0x22, 0xBA, 0x96, 0x73, 0xC8, 0x07, 0x95, 0x13, 0x52,
-    0x16, 0xBE, 0x27, 0x30, 0x71, 0x56, 0xF1, 0xFC, 0x0C, 0xB6, 0xE5, 0x80, 0x7C, 0xF0, 0x30, 0xDD,
-    0x60, 0x95, 0x18, 0x72, 0x4A, 0xEB, 0x79, 0xC5, 0xFC, 0x04, 0xAF, 0x1F, 0xC1, 0xD4, 0xB7, 0x91,
-    0x9E, 0x15, 0xF3, 0x85, 0x46, 0x80, 0x3D, 0x2B, 0x53, 0x9A, 0x2A, 0x6A, 0x92, 0x3A, 0x68, 0x13,
-    0x28, 0xF7, 0x99, 0x23, 0x56, 0x7C, 0xC0, 0x6B, 0xBF, 0x16, 0x61, 0x47, 0xB7, 0x40, 0xD3, 0x25,
-    0x34, 0xE9, 0x25, 0x3F, 0xFA, 0x37, 0x30, 0xAF, 0x3F, 0x3E, 0xD8, 0x1F, 0xA8, 0xCF, 0xF5, 0x0B,
-    0x2F, 0xC6, 0xDD, 0x69, 0x35, 0x28, 0x81, 0x17, 0xA0, 0x0B, 0xAF, 0x21, 0xC0, 0x70, 0x65, 0x2B,
-    0x0B, 0xA4, 0xF2, 0x02, 0x3E, 0x39, 0xB7, 0x41, 0x0E, 0xC8, 0x3B, 0xF7, 0x1B, 0x49, 0x96, 0x83,
-    0xC2, 0x8D, 0x7F, 0xD1, 0xC2, 0xF8, 0xFE, 0x55, 0x9C, 0x83, 0xF3, 0xDD, 0xCD, 0x1E, 0x9E, 0xC9,
-    0x11, 0xEC, 0xC8, 0x2A, 0x42, 0x1A, 0x28, 0xD5, 0x69, 0xF4, 0xE3, 0xC6, 0xA0, 0x1E, 0x04, 0x3D,
-    0xBC, 0x93, 0x81, 0x20, 0x35, 0xF8, 0x81, 0x22, 0xCB, 0x75, 0x80, 0x7F, 0x6F, 0x7E, 0xFB, 0xF3,
-    0x3E, 0xC3, 0x6D, 0x23, 0xC4, 0x7B, 0x57, 0xB5, 0xA1, 0xFA, 0x9D, 0x77, 0xA3, 0x2A, 0x58, 0xAA,
-    0x82, 0xB4, 0x86, 0xD1, 0xA2, 0xE7, 0x4D, 0xED, 0x6D, 0xC8, 0x0B, 0x6F, 0x3C, 0x39, 0xEB, 0x4C,
-    0x63, 0x1F, 0xB7, 0x4E, 0x66, 0x85, 0xC6, 0x2D, 0x68, 0xE5, 0x00, 0x9E, 0x9A, 0x07, 0x5D, 0xD0,
-    0xC9, 0x0A, 0xB9, 0x3A, 0x23, 0xFF, 0x40, 0xD8, 0x62, 0x85, 0x88, 0xCD, 0x00, 0x68, 0x53, 0x43,
-    0x4B, 0x3B, 0xC5, 0x82, 0x78, 0x35, 0x33, 0x48, 0xCF, 0xCB, 0xBC, 0xCC, 0x94, 0xD1, 0xA1, 0xEC,
-    0xD3, 0x67, 0x8E, 0x68, 0x89, 0xB4, 0x52, 0x96, 0x71, 0xAB, 0x48, 0x9B, 0x6A, 0x90, 0xC2, 0x16,
-    0x4A, 0x9E, 0x40, 0xD9, 0x0C, 0x07, 0x71, 0x00, 0xF1, 0x8A, 0x56, 0xDF, 0x6F, 0xB1, 0x4C, 0x2F,
-    0xC1, 0x3F, 0x10, 0x7E, 0xB3, 0x8D, 0x17, 0x98, 0x36, 0x44, 0x14, 0xF6, 0x01, 0xBF, 0x59, 0xB7,
-    0xCE, 0xB4, 0xA7, 0xA5, 0x0F, 0x7B, 0xD8, 0x76, 0x75, 0x93, 0x93, 0xB7, 0x60, 0x38, 0xF4, 0xA0,
-    0x5D, 0xB8, 0xAA, 0x87, 0xBD, 0xB8, 0xE2, 0xFC, 0x63, 0xC4, 0x8D, 0xAB, 0x90, 0x5B, 0x69, 0x09,
-    0x23, 0x33, 0xE6, 0x75, 0x07, 0x57, 0x6C, 0xAD, 0x33, 0xEB, 0x36, 0x96, 0xAB, 0x18, 0x3E, 0xFF,
-    0x44, 0xE0, 0x23, 0xA8, 0x13, 0xE3, 0x95, 0xAC, 0x5F, 0xBD, 0x67, 0x85, 0x0B, 0x7B, 0x7B, 0x7B,
-    0xA8, 0x9C, 0xFF, 0x7D, 0x74, 0xF4, 0x86, 0xBF, 0xF5, 0x99, 0xBD, 0xBD, 0x17, 0x9D, 0xFB, 0xF4,
-    0x08, 0x60, 0xC2, 0xF2, 0xF0, 0x76, 0x5E, 0x2B, 0x10, 0x28, 0x90, 0x05, 0x80, 0xAF, 0x10, 0xF6,
-    0xB9, 0x02, 0xCF, 0x50, 0x9F, 0xCC, 0x52, 0x26, 0x75, 0xF8, 0x53, 0x71, 0x36, 0x73, 0x6F, 0x1E,
-    0x9E, 0x50, 0xA1, 0x11, 0x49, 0xAD, 0x85, 0x56, 0xA6, 0x84, 0xEB, 0x3B, 0x90, 0x56, 0xF4, 0x40,
-    0xB2, 0x46, 0x7E, 0xEA, 0xD7, 0xA1, 0xE3, 0xE1, 0x47, 0xEF, 0x86, 0xBF, 0xFD, 0x19, 0xDF, 0x33,
-    0x4D, 0xC0, 0x64, 0xB5, 0x77, 0x13, 0x64, 0xBF, 0x52, 0x9C, 0x11, 0x01, 0x49, 0x15, 0xB4, 0x4A,
-    0x76, 0x69, 0xB1, 0xD5, 0x1C, 0x66, 0x10, 0xE5, 0x5C, 0x31, 0x49, 0x2A, 0xF3, 0x7A, 0x1F, 0x00,
-    0x3B, 0xF3, 0xB0, 0x89, 0xDF, 0xB4, 0x71, 0x95, 0x14, 0x69, 0x52, 0x66, 0xA0, 0xD0, 0xE3, 0x11,
-    0x2A, 0xA8, 0x8D, 0x6A, 0x14, 0x41, 0x53, 0x66, 0x51, 0x95, 0x02, 0x9F, 0x6D, 0x2A, 0x93, 0xF8,
-    0xB6, 0x29, 0x47, 0xD2, 0xFD, 0xE7, 0xFF, 0x77, 0xA8, 0x8F, 0xEE, 0x8A, 0x2B, 0x10, 0xAE, 0xDF,
-    0x24, 0x87, 0x24, 0x1B, 0x3E, 0x40, 0x64, 0xAA, 0x44, 0xA9, 0x6C, 0x0E, 0xAB, 0xB7, 0x2B, 0x55,
-    0x89, 0xA9, 0xB4, 0xED, 0x56, 0xAA, 0xE7, 0x4B, 0x83, 0x7F, 0x35, 0x18, 0x91, 0xD2, 0xD0, 0x4C,
-    0xD3, 0x9A, 0x0A, 0x86, 0x77, 0x29, 0x61, 0x97, 0xD7, 0x9B, 0x2B, 0x15, 0xEB, 0x27, 0x33, 0x71,
-    0xC4, 0x7C, 0x4D, 0x2A, 0xE2, 0xD4, 0xB2, 0x0C, 0xED, 0x10, 0xB6, 0xD1, 0x9D, 0xEF, 0xE0, 0x66,
-    0xE4, 0x34, 0x7C, 0x77, 0x74, 0xD4, 0x91, 0xF8, 0xB0, 0xFC, 0x9C, 0x48, 0x07, 0x0B, 0x9B, 0x8A,
-    0x1C, 0xBD, 0x0C, 0x16, 0x87, 0xB2, 0xBF, 0x9C, 0x39, 0x96, 0x4C, 0x91, 0x3D, 0xB2, 0x31, 0xBE,
-    0xB8, 0xDF, 0xE2, 0xA6, 0x03, 0x10, 0x51, 0x52, 0x81, 0x28, 0x7B, 0xA4, 0x0C, 0xDA, 0x2E, 0x7A,
-    0x08, 0x38, 0x01, 0x12, 0xC2, 0x07, 0x37, 0x2B, 0x90, 0x0E, 0x44, 0xDE, 0xD9, 0xB7, 0x6C, 0xC4,
-    0x70, 0x12, 0xA7, 0xE6, 0x64, 0x14, 0x7E, 0x21, 0x64, 0xD2, 0x22, 0xB2, 0xA1, 0x0D, 0x96, 0x21,
-    0x15, 0x58, 0x0C, 0xA6, 0x69, 0x2D, 0x16, 0x4D, 0x54, 0x18, 0x5D, 0x25, 0x6D, 0x40, 0x5C, 0xC6,
-    0x24, 0xFB, 0x63, 0xDC, 0x99, 0x28, 0xE5, 0x30, 0xE3, 0x68, 0x84, 0x26, 0xAA, 0xFA, 0x6D, 0xBE,
-    0xFE, 0x72, 0x22, 0x9E, 0x18, 0xE8, 0x90, 0x73, 0x51, 0x8F, 0x5A, 0x98, 0x7E, 0xF1, 0x37, 0xC8,
-    0x15, 0xE4, 0x12, 0xF3, 0x6D, 0x28, 0x91, 0xCF, 0x5C, 0x25, 0x5F, 0xC1, 0x0C, 0xE3, 0x6E, 0x22,
-    0x19, 0xD2, 0x22, 0xB5, 0xBC, 0xDD, 0xD1, 0x99, 0x86, 0x20, 0x0E, 0x59, 0x2F, 0x20, 0x23, 0xA5,
-    0x1B, 0x70, 0x26, 0xB2, 0x38, 0x83, 0xF4, 0xED, 0xC8, 0xFF, 0x07, 0xE4, 0xAC, 0x6C, 0x38, 0x13,
-    0x37, 0x91, 0x16, 0x8D, 0x8E, 0xEC, 0x7B, 0xC0, 0xB7, 0xAC, 0xD8, 0x26, 0x8D, 0x21, 0x73, 0x37,
-    0x8C, 0xF2, 0x85, 0x99, 0x6D, 0xE3, 0x16, 0xDE, 0x04, 0x8E, 0x9A, 0x70, 0x45, 0x0B, 0x5B, 0x22,
-    0x76, 0x61, 0x83, 0x41, 0x84, 0x30, 0x8C, 0x29, 0x48, 0x6A, 0xA8, 0x68, 0xE4, 0x4C, 0x72, 0xBE,
-    0x5A, 0xAD, 0xF6, 0xE5, 0x6C, 0xDF, 0xC0, 0x6B, 0xE4, 0xDF, 0x09, 0x96, 0xFA, 0xB3, 0x86, 0xBC,
-    0xCC, 0xE5, 0xFA, 0xA1, 0xB3, 0x74, 0xB8, 0x69, 0x1F, 0xAE, 0x83, 0x32, 0x5C, 0x22, 0xA2, 0xBB,
-    0x2F, 0x29, 0x65, 0xEB, 0x32, 0x5C, 0x41, 0x6B, 0x6F, 0x0E, 0x17, 0x63, 0x95, 0xC1, 0x89, 0xF5,
-    0xE0, 0x44, 0xF2, 0xDD, 0x23, 0xD7, 0xB1, 0x32, 0x2A, 0x29, 0x33, 0x32, 0x57, 0x29, 0x7F, 0xA5,
-    0x76, 0x48, 0x56, 0x87, 0x1D, 0xDC, 0x14, 0xD5, 0x2C, 0xBD, 0xE4, 0xC6, 0x17, 0x54, 0x08, 0x63,
-    0xA3, 0x02, 0x08, 0x38, 0xB2, 0xE9, 0xDE, 0x4B, 0x73, 0x40, 0xE6, 0x53, 0x2B, 0xE7, 0x17, 0xBC,
-    0xA0, 0xCB, 0xD8, 0xBD, 0xB1, 0x4A, 0xC3, 0xDD, 0x58, 0xD2, 0x1D, 0x6E, 0xDB, 0x40, 0x21, 0xB8,
-    0x20, 0xBE, 0x36, 0x8A, 0x54, 0xE6, 0x2A, 0xE3, 0x9A, 0x2D, 0x77, 0x48, 0xC6, 0xD6, 0x40, 0xD0,
-    0x05, 0x70, 0x13, 0x43, 0xD1, 0x2A, 0x1D, 0xCF, 0x95, 0x79, 0x73, 0xD5, 0x16, 0x16, 0x26, 0xFF,
-    0xB3, 0xF7, 0xDD, 0x86, 0x46, 0xB1, 0x0F, 0x46, 0x3D, 0xED, 0xD5, 0x7B, 0xB9, 0xAA, 0xC1, 0xD3,
-    0x15, 0x95, 0xC2, 0xDD, 0x74, 0x67, 0xA7, 0x77, 0x1F, 0xF8, 0xD3, 0x5A, 0xD2, 0xD0, 0x7F, 0x83,
-    0x15, 0x17, 0x4E, 0x8B, 0xA5, 0x57, 0x00, 0xC1, 0x3A, 0xA4, 0x6C, 0x45, 0x80, 0xAE, 0x38, 0x96,
-    0x8D, 0xDF, 0x9D, 0x78, 0x2C, 0x3C, 0xF6, 0x1B, 0xFE, 0x5A, 0x42, 0x4E, 0x71, 0x66, 0x47, 0x2D,
-    0x5B, 0xB4, 0xED, 0xAC, 0x6C, 0xDA, 0xA1, 0x34, 0xE6, 0xF2, 0x07, 0x0E, 0x8E, 0x07, 0x12, 0x48,
-    0xBE, 0x72, 0xB0, 0xF0, 0x18, 0xD0, 0x84, 0xEF, 0x34, 0x5E, 0x41, 0x7D, 0xE2, 0x61, 0x9D, 0x2E,
-    0x37, 0x68, 0x81, 0x41, 0xEB, 0x53, 0x57, 0x41, 0xF9, 0xB4, 0xA3, 0xAB, 0xA6, 0xBC, 0x91, 0x59,
-    0x91, 0x6B, 0x7E, 0xF4, 0xAC, 0x5E, 0x51, 0x43, 0xB9, 0xE9, 0x8B, 0x9A, 0x34, 0x8A, 0x3F, 0x8D,
-    0xB1, 0xB9, 0x49, 0xB5, 0x0F, 0x72, 0x05, 0xDD, 0xA9, 0xA2, 0x8E, 0xA2, 0x73, 0xB6, 0x2A, 0xD2,
-    0x85, 0x6C, 0x3C, 0x6A, 0xA4, 0x15, 0xC9, 0x7E, 0x09, 0x2C, 0xA0, 0xD2, 0x10, 0x1C, 0xD1, 0x4A,
-    0x97, 0x2D, 0x36, 0x0D, 0x3E, 0x7C, 0x4C, 0xE3, 0x3F, 0x6A, 0xC6, 0x81, 0xC7, 0xC9, 0xFA, 0xE0,
-    0x93, 0x38, 0x98, 0x14, 0xC8, 0xA4, 0x0A, 0xE8, 0xB6, 0x00, 0x76, 0xFB, 0x10, 0xDC, 0x8A, 0xEF,
-    0x52, 0xB2, 0x15, 0xE4, 0x97, 0x92, 0xE3, 0x6E, 0x76, 0x0B, 0x95, 0x7E, 0x7C, 0x89, 0xD6, 0xFB,
-    0xCB, 0x2A, 0xFC, 0x18, 0x13, 0xC9, 0x47, 0x75, 0xFC, 0x0B, 0x44, 0xE4, 0xFD, 0xDA, 0xC0, 0xBC,
-    0xF8, 0xED, 0x26, 0x25, 0x74, 0xDE, 0x6E, 0x46, 0xF0, 0xB5, 0xF9, 0x96, 0xBD, 0xC6, 0x8F, 0xD0,
-    0x5A, 0x7C, 0x64, 0xC1, 0xA7, 0x0D, 0x3E, 0xC6, 0xF2, 0x79, 0x65, 0xD8, 0x4B, 0xBB, 0x02, 0xDA,
-    0x4D, 0x00, 0x4C, 0x7C, 0x1C, 0xB3, 0xCD, 0x63, 0x8B, 0x7A, 0x0D, 0xC6, 0xA2, 0xE5, 0xBE, 0x80,
-    0x8F, 0xED, 0x95, 0x36, 0x33, 0xB9, 0x63, 0xF7, 0x60, 0xD7, 0xF1, 0x45, 0xBF, 0xE4, 0xAA, 0x90,
-    0x69, 0x81, 0x36, 0xB1, 0x62, 0xA7, 0x9B, 0x74, 0x3A, 0x2F, 0x38, 0x0D, 0xE0, 0x97, 0xB5, 0xCE,
-    0x0B, 0xDA, 0x63, 0x67, 0x59, 0xC1, 0x69, 0xEA, 0x87, 0x56, 0xC7, 0x89, 0x13, 0x9E, 0x86, 0x1E,
-    0x3C, 0x1D, 0x5A, 0x9E, 0x96, 0x29, 0x4F, 0x97, 0xE6, 0x1D, 0x9E, 0x0E, 0x1E, 0x34, 0xEC, 0xA5,
-    0x73, 0x9D, 0x36, 0x58, 0x35, 0x81, 0x2C, 0xA7, 0xFD, 0x26, 0x56, 0x01, 0x21, 0x2B, 0x63, 0xAC,
-    0x49, 0xF3, 0x2A, 0xA3, 0xBE, 0x52, 0x5A, 0x83, 0x4B, 0x0A, 0x63, 0x99, 0x9B, 0x2D, 0x4A, 0x5E,
-    0xD0, 0x33, 0xA7, 0x7B, 0x7A, 0xB8, 0x67, 0x58, 0x7B, 0x12, 0x4A, 0x7F, 0x72, 0xF6, 0x06, 0xD7,
-    0x06, 0x1D, 0x5B, 0x9B, 0x96, 0x03, 0xA6, 0x3D, 0x21, 0xF2, 0x66, 0x84, 0x20, 0x7A, 0x1B, 0x10,
-    0x60, 0x13, 0xF7, 0x64, 0xFC, 0x66, 0xA0, 0x4F, 0x5F, 0x28, 0xCF, 0xAA, 0xC0, 0x03, 0x84, 0xE1,
-    0x40, 0x58, 0x05, 0xB0, 0x52, 0xAF, 0x55, 0x36, 0x6A, 0x02, 0x8E, 0xDE, 0x69, 0xC1, 0xFA, 0x81,
-    0x4C, 0x23, 0x74, 0x22, 0xE6, 0xF7, 0x0C, 0x64, 0xF8, 0x27, 0xF2, 0x4C, 0xA1, 0x18, 0x5E, 0xCA,
-    0x60, 0x0E, 0xED, 0x69, 0x44, 0x0D, 0x62, 0xB9, 0x0E, 0x3A, 0xBD, 0xBD, 0x57, 0xD4, 0xF4, 0x9A,
-    0x45, 0xBD, 0xD2, 0x64, 0xEF, 0xE1, 0x3D, 0xB4, 0x9E, 0x6A, 0x18, 0xDF, 0x01, 0x2A, 0xFF, 0x7E,
-    0xA2, 0xEB, 0xCE, 0xB4, 0xBA, 0xC2, 0xBA, 0x53, 0xF6, 0x91, 0x71, 0x27, 0xDE, 0x16, 0x04, 0xF6,
-    0x0B, 0x0D, 0xA7, 0x76, 0xDF, 0x74, 0x37, 0xAB, 0x48, 0xEB, 0x31, 0x77, 0x47, 0x7F, 0xA8, 0x46,
-    0xAA, 0xA8, 0x77, 0x04, 0xDC, 0x10, 0xD0, 0x35, 0xA8, 0x22, 0xA4, 0xA4, 0x84, 0x45, 0x04, 0x0B,
-    0xE4, 0x0C, 0x54, 0x07, 0x2D, 0x62, 0xEE, 0x43, 0xA4, 0x3A, 0x9B, 0x51, 0xF9, 0xFB, 0x0B, 0x52,
-    0x3A, 0x3C, 0x39, 0x5D, 0xD0, 0xE6, 0x03, 0x42, 0xBE, 0x67, 0x6E, 0x41, 0x60, 0x47, 0xD3, 0xEA,
-    0x98, 0x4D, 0x5C, 0x62, 0x13, 0x57, 0x27, 0x40, 0x7D, 0x19, 0x77, 0x43, 0x74, 0x5F, 0xE2, 0xE2,
-    0x65, 0x02, 0x6F, 0x9F, 0xC8, 0x08, 0x61, 0xB7, 0x69, 0x19, 0xA1, 0x24, 0x7E, 0x8D, 0x83, 0x00,
-    0x5B, 0x2A, 0xE6, 0x1F, 0xF7, 0x06, 0x42, 0x32, 0x17, 0x89, 0x67, 0x11, 0xA2, 0x63, 0x7B, 0x0E,
-    0x8B, 0xCC, 0x75, 0x72, 0x1E, 0x27, 0x4D, 0x6C, 0xE1, 0xCA, 0x22, 0xE1, 0xF2, 0x43, 0x97, 0x47,
-    0x9E, 0xEC, 0xB9, 0x5D, 0xF1, 0x0E, 0x9A, 0xC8, 0xC9, 0xB5, 0xC8, 0xC6, 0x3F, 0x2A, 0xC6, 0xF2,
-    0xDA, 0x0F, 0xE2, 0x7A, 0xCB, 0xD7, 0x51, 0x8D, 0x51, 0x3F, 0x70, 0x94, 0x36, 0x3F, 0xD9, 0xBA,
-    0xDF, 0xF8, 0x6A, 0x05, 0xA6, 0xB7, 0x41, 0x7B, 0x20, 0xCF, 0x61, 0x7A, 0x81, 0x7C, 0xB4, 0x48,
-    0x3D, 0x72, 0x35, 0x59, 0x29, 0x45, 0x0F, 0xC3, 0xF3, 0x94, 0x62, 0x62, 0x1D, 0xA5, 0xE7, 0x9C,
-    0xFA, 0x8C, 0xCE, 0xD6, 0x8A, 0x71, 0x32, 0x6B, 0xE9, 0xC9, 0x99, 0x94, 0x5C, 0x90, 0xE8, 0xAD,
-    0x27, 0x68, 0x3F, 0x96, 0xE5, 0xBC, 0x0A, 0x9E, 0x02, 0x3F, 0x66, 0xCD, 0x36, 0x37, 0x47, 0x18,
-    0x8C, 0xD0, 0x07, 0xEE, 0xEA, 0x46, 0xE1, 0x48, 0xDD, 0x3B, 0xEE, 0x10, 0x1C, 0xA1, 0xF7, 0x02,
-    0x74, 0x86, 0x0D, 0x2A, 0xF4, 0x64, 0x7F, 0x8D, 0x1F, 0x7E, 0xCE, 0x6B, 0x07, 0xAC, 0x64, 0xCC,
-    0xCC, 0x04, 0x93, 0x02, 0x8C, 0xE4, 0x04, 0x4A, 0x9E, 0x10, 0x73, 0x83, 0x74, 0xF4, 0x21, 0x6D,
-    0x3C, 0xB1, 0x3E, 0xCB, 0x81, 0x0A, 0x7A, 0x43, 0xA9, 0xD0, 0xD7, 0xB9, 0xCD, 0x47, 0x0C, 0x55,
-    0x6E, 0x89, 0x5B, 0xC2, 0xE0, 0x14, 0x88, 0x29, 0xA6, 0x54, 0x54, 0x9B, 0xCE, 0x59, 0xA1, 0x66,
-    0x1B, 0x76, 0xA1, 0xC8, 0x0E, 0xC4, 0x95, 0x18, 0x19, 0xB3, 0x9B, 0x80, 0xD3, 0xDF, 0x2D, 0x53,
-    0x4A, 0xEB, 0xFA, 0x90, 0x95, 0x2D, 0xE5, 0x0C, 0x22, 0x79, 0xD4, 0xCC, 0xD1, 0x16, 0x87, 0x76,
-    0x37, 0xAE, 0xB8, 0x75, 0x90, 0x94, 0x93, 0x1D, 0x42, 0xC6, 0xC6, 0xEF, 0x43, 0xAB, 0x74, 0x47,
-    0x46, 0x98, 0x98, 0x83, 0xCF, 0xAB, 0xE8, 0xD7, 0x88, 0x35, 0x38, 0x3E, 0xA7, 0x86, 0x4E, 0xA1,
-    0xC0, 0xFE, 0x25, 0xF7, 0x01, 0xD1, 0xAE, 0xE1, 0xD1, 0x07, 0x5C, 0x03, 0x10, 0xA7, 0xAB, 0x62,
-    0x9F, 0xB3, 0xB2, 0x26, 0x5F, 0xAF, 0xAC, 0x3C, 0xD5, 0x64, 0xCC, 0x7D, 0x13, 0x72, 0x45, 0x2B,
-    0xC1, 0x5D, 0x59, 0x5B, 0xAC, 0x83, 0xA5, 0xB2, 0x1A, 0x45, 0xE8, 0x91, 0x09, 0xF3, 0x2D, 0xE0,
-    0x90, 0x8D, 0x58, 0xB2, 0x5C, 0x71, 0x50, 0x24, 0xC1, 0xC3, 0x5E, 0x88, 0x84, 0x77, 0xB7, 0x41,
-    0xA6, 0x08, 0x00, 0x9F, 0xBE, 0xB3, 0xCD, 0xB9, 0x36, 0xBC, 0x33, 0x6B, 0xD9, 0x65, 0x95, 0x11,
-    0x23, 0x1B, 0x74, 0xDA, 0x6E, 0x12, 0x5C, 0x73, 0xAE, 0x3D, 0x26, 0x96, 0x72, 0x06, 0x21, 0x55,
-    0x04, 0x72, 0x45, 0x4E, 0xB6, 0x9E, 0x38, 0x14, 0x68, 0x8A, 0x4A, 0x6D, 0x67, 0xB4, 0x59, 0xCA,
-    0xD6, 0x29, 0x69, 0x5C, 0x27, 0x1B, 0x2D, 0x10, 0x5B, 0xAD, 0xB4, 0x08, 0xFA, 0x80, 0xA8, 0x79,
-    0x9E, 0x77, 0x95, 0x6A, 0xC5, 0xC9, 0xD0, 0x5C, 0xC7, 0x8F, 0x14, 0xE1, 0xF5, 0x30, 0xCB, 0x8A,
-    0x87, 0xB9, 0xEE, 0x16, 0x35, 0xA4, 0x07, 0x6D, 0x5E, 0xEE, 0x4D, 0x63, 0x8E, 0xE5, 0xF9, 0xC3,
-    0x0E, 0x0B, 0xDD, 0x71, 0x4F, 0x96, 0x4F, 0x75, 0x0B, 0x64, 0xA4, 0xFB, 0x25, 0x13, 0xDD, 0xC8,
-    0x68, 0xC9, 0xD7, 0x08, 0x76, 0xC8, 0x0D, 0x31, 0xDD, 0x2F, 0x52, 0x70, 0x23, 0x94, 0xEC, 0xA7,
-    0x37, 0xEE, 0xF0, 0x5B, 0x39, 0x73, 0x1D, 0x67, 0x8E, 0x74, 0x17, 0x67, 0x47, 0xB7, 0x48, 0x70,
-    0x19, 0x2B, 0x43, 0xC5, 0xDB, 0x03, 0xBF, 0x27, 0x74, 0xAC, 0xF2, 0x47, 0x7A, 0xB3, 0xD1, 0x69,
-    0xC9, 0x6F, 0x45, 0x85, 0x5A, 0x1C, 0x78, 0xC5, 0x44, 0xAF, 0x38, 0x37, 0x28, 0xF6, 0x88, 0x1E,
-    0x9B, 0x4A, 0xE8, 0x4E, 0xC6, 0x63, 0x7A, 0xFC, 0x21, 0xCD, 0x23, 0xBD, 0x09, 0x41, 0x7B, 0xA5,
-    0xD0, 0x11, 0x83, 0x33, 0x2F, 0x10, 0x45, 0x46, 0xFC, 0x02, 0x6E, 0x31, 0x45, 0xD8, 0x1C, 0x63,
-    0x9E, 0xA8, 0xE2, 0x0A, 0x63, 0x4C, 0x68, 0x0D, 0x6B, 0xAA, 0x74, 0x23, 0x89, 0xDF, 0x2A, 0xE5,
-    0xE2, 0xD1, 0xD1, 0xD1, 0xBF, 0xC2, 0x5D, 0x77, 0x30, 0xCF, 0x01, 0x36, 0xE5, 0x09, 0x68, 0xA7,
-    0x9C, 0xC8, 0xB0, 0xF7, 0x99, 0xB6, 0xB7, 0x41, 0xF1, 0xA8, 0x4C, 0x59, 0x03, 0xAE, 0xAB, 0x91,
-    0x1C, 0x60, 0x1E, 0x0E, 0x25, 0xA6, 0x64, 0xC1, 0x98, 0x23, 0x16, 0x73, 0xD0, 0x73, 0x2F, 0x2B,
-    0x0C, 0xF0, 0x9F, 0x3C, 0x7B, 0xFA, 0xF2, 0xCE, 0x64, 0xB6, 0xCC, 0x6C, 0xD6, 0xA4, 0x95, 0xF6,
-    0x85, 0xCF, 0x88, 0x1A, 0xF8, 0x7D, 0xEB, 0xA1, 0x30, 0xF6, 0x3B, 0x48, 0xDC, 0x51, 0x22, 0x62,
-    0x8E, 0xD3, 0x3A, 0x7A, 0x0F, 0x3D, 0xE3, 0xCE, 0x7E, 0x39, 0xAD, 0x73, 0xD4, 0xE3, 0xDE, 0x58,
-    0x6E, 0x03, 0x99, 0xEB, 0x9D, 0x8C, 0x30, 0x9B, 0x58, 0xEE, 0x67, 0xA0, 0x34, 0x81, 0x95, 0x9B,
-    0xAC, 0x9C, 0x01, 0x21, 0x36, 0xFA, 0xF5, 0xEA, 0xAC, 0xE5, 0x4C, 0xC9, 0x56, 0xD1, 0xFD, 0x09,
-    0xF7, 0xD5, 0x36, 0xB6, 0xDB, 0x74, 0x1A, 0xE2, 0xF3, 0x44, 0x2E, 0xCD, 0xBE, 0x6D, 0x01, 0x62,
-    0x6E, 0x98, 0x0C, 0x53, 0xB3, 0x6E, 0x9E, 0xFC, 0xF9, 0x72, 0xA8, 0x69, 0xF3, 0xA1, 0xA4, 0xB5,
-    0xCC, 0x0C, 0x49, 0x3E, 0xB3, 0x20, 0x6D, 0x14, 0xC3, 0x87, 0xC6, 0xA6, 0x83, 0xB1, 0x23, 0x18,
-    0x3B, 0x19, 0x8C, 0x9D, 0xFF, 0x31, 0x63, 0xBD, 0x4A, 0xA7, 0xCB, 0xA8, 0x19, 0x27, 0xE5, 0x38,
-    0x95, 0x83, 0x71, 0xD0, 0x8D, 0x92, 0xE6, 0x00, 0xB3, 0x52, 0xCB, 0x4D, 0x15, 0x6D, 0x7F, 0x2F,
-    0x4E, 0xB7, 0x5A, 0x30, 0x6E, 0xBA, 0x7A, 0xB8, 0x9D, 0xE5, 0x07, 0x6B, 0x61, 0x8F, 0x22, 0xDD,
-    0x73, 0xAA, 0xCA, 0xC0, 0xD5, 0xDC, 0x76, 0x53, 0x6F, 0x61, 0x3E, 0xA8, 0x74, 0xDB, 0x64, 0x48,
-    0x24, 0x53, 0x0C, 0x7B, 0x6F, 0x9A, 0x4D, 0xEA, 0x57, 0xDD, 0x8E, 0x53, 0x76, 0x57, 0xB3, 0xFC,
-    0x9B, 0x26, 0x58, 0x2B, 0x83, 0x4C, 0x6D, 0x4E, 0xB5, 0x1A, 0x9C, 0x09, 0xFE, 0x0B, 0x8A, 0x3B,
-    0xDD, 0xE7, 0x36, 0x03, 0x93, 0xE5, 0x2F, 0x0F, 0x1F, 0x6E, 0x3A, 0x2F, 0x50, 0x79, 0xB2, 0xBB,
-    0x18, 0xD4, 0x5B, 0x73, 0x15, 0x0B, 0x8E, 0x29, 0x12, 0x03, 0x48, 0x13, 0x11, 0x96, 0xA4, 0x69,
-    0x4A, 0xCA, 0xD9, 0x62, 0x64, 0x87, 0xC3, 0x02, 0x9A, 0xDF, 0xB3, 0x52, 0xFC, 0x96, 0x8D, 0xDB,
-    0x27, 0xEF, 0x27, 0x64, 0xCD, 0xD8, 0xEA, 0xB6, 0x2C, 0x68, 0x67, 0x2A, 0xF9, 0x9D, 0x97, 0x41,
-    0x24, 0xEC, 0x7C, 0x9E, 0x78, 0x50, 0x78, 0x8C, 0x10, 0xBB, 0x0A, 0x12, 0xD5, 0x7A, 0x3C, 0x18,
-    0x48, 0xFD, 0x54, 0xE5, 0x0E, 0x84, 0x32, 0x82, 0xC7, 0x4C, 0xFA, 0x93, 0x2A, 0x7E, 0x17, 0x33,
-    0xE8, 0x5D, 0xCE, 0xF2, 0xC5, 0x48, 0x72, 0x30, 0x71, 0x5A, 0x71, 0xA0, 0x8D, 0x1A, 0x2D, 0x0F,
-    0x1D, 0x00, 0x80, 0xD9, 0xF5, 0x59, 0x00, 0xE7, 0x2E, 0x26, 0x29, 0x07, 0x2F, 0xAE, 0xD6, 0x1B,
-    0x3D, 0xA6, 0x8A, 0x2D, 0xDA, 0xE1, 0x8B, 0x83, 0x7D, 0xDB, 0x16, 0x2D, 0x38, 0xE3, 0x0B, 0x82,
-    0x6F, 0xF9, 0xD7, 0x02, 0xA9, 0xBF, 0xC6, 0x7A, 0xDD, 0x0F, 0xC6, 0xF3, 0xB4, 0x8F, 0xBA, 0x33,
-    0x4F, 0xD0, 0x4E, 0xF4, 0x6F, 0xBA, 0xFF, 0xF7, 0xC6, 0x23, 0xE4, 0x8C, 0x91, 0x39, 0x76, 0x5E,
-    0x6B, 0xDD, 0x7A, 0x2A, 0xFD, 0x6E, 0xF1, 0x57, 0xD1, 0x9E, 0x79, 0xEA, 0xA2, 0xDB, 0xD3, 0x87,
-    0x5F, 0xD1, 0xA5, 0x96, 0x6C, 0x45, 0x7D, 0x63, 0xFC, 0x6A, 0xE1, 0x11, 0xBA, 0x68, 0xE4, 0x89,
-    0x53, 0x3F, 0x62, 0x4C, 0xBC, 0xA0, 0x4E, 0xFD, 0x11, 0xD8, 0x45, 0xB9, 0x93, 0x2F, 0xA3, 0xBB,
-    0x97, 0xEB, 0xBC, 0x1A, 0xC5, 0x36, 0xA9, 0xE6, 0xE8, 0x60, 0xAE, 0x83, 0x38, 0xE1, 0x99, 0x95,
-    0x04, 0x18, 0xD8, 0x32, 0x36, 0x73, 0xA7, 0x68, 0x38, 0x7A, 0xC0, 0x77, 0x35, 0xD7, 0x2D, 0x98,
-    0x0B, 0xF2, 0xB4, 0x59, 0x02, 0xF1, 0x73, 0x1D, 0xE2, 0xDB, 0x00, 0x13, 0x3C, 0x9C, 0x55, 0xC7,
-    0x15, 0x3B, 0x1F, 0xEE, 0x8D, 0x64, 0x2C, 0x6D, 0x32, 0xBA, 0x38, 0x6D, 0x17, 0xCD, 0xEC, 0x0C,
-    0x93, 0x40, 0x75, 0x9D, 0x34, 0x0B, 0xBB, 0xB0, 0x60, 0xFF, 0xFF, 0xFB, 0xFC, 0x77, 0x9F, 0xB5,
-    0xD1, 0x07, 0xAF, 0x7F, 0xF4, 0x66, 0x1B, 0x7D, 0x12, 0xDE, 0x0D, 0x6C, 0xDC, 0x47, 0x7D, 0x68,
-    0x13, 0x1B, 0xB5, 0x51, 0x83, 0x8E, 0xCC, 0x46, 0x35, 0x46, 0x6B, 0xC8, 0x4C, 0x4B, 0x8E, 0xD8,
-    0x29, 0xD4, 0x35, 0x65, 0x06, 0x53, 0xCD, 0x5F, 0x8F, 0x61, 0x65, 0x3A, 0x1D, 0x61, 0x85, 0xAC,
-    0x9B, 0xC0, 0x3B, 0x69, 0xBD, 0x51, 0xDB, 0x9A, 0x94, 0x2B, 0x40, 0x3E, 0xA5, 0x5F, 0x87, 0x6C,
-    0x4A, 0x56, 0xB9, 0x90, 0x4A, 0x99, 0x94, 0xA8, 0xF2, 0x20, 0x8D, 0xB2, 0xD2, 0x53, 0x48, 0x80,
-    0x9C, 0x87, 0x52, 0xB8, 0x75, 0x87, 0x36, 0x29, 0xFF, 0x26, 0x9A, 0xE6, 0xE4, 0x97, 0x98, 0x9C,
-    0x30, 0x9E, 0x7F, 0x54, 0xCB, 0x01, 0x7A, 0xB9, 0x0F, 0x2A, 0x99, 0x83, 0x60, 0xFF, 0xA9, 0x0A,
-    0xDB, 0x13, 0x99, 0x82, 0xD7, 0x50, 0x12, 0x2C, 0xB7, 0xE4, 0xCE, 0x32, 0x2F, 0x01, 0xB2, 0x42,
-    0x77, 0x03, 0xE8, 0xEB, 0xEE, 0xE3, 0xCA, 0x09, 0x6A, 0x96, 0x63, 0x27, 0x8C, 0xEC, 0x07, 0x52,
-    0x26, 0xEC, 0x44, 0x2A, 0xDD, 0x29, 0x60, 0xFE, 0xC7, 0xFC, 0x3A, 0xE7, 0xBE, 0x49, 0x8D, 0x72,
-    0xC4, 0x2E, 0x32, 0x5D, 0x70, 0x03, 0xFA, 0x82, 0xDF, 0x57, 0xD7, 0x94, 0x1A, 0x0D, 0x85, 0x2F,
-    0xE2, 0x3C, 0xFB, 0xCA, 0xD1, 0x5A, 0xC9, 0xD9, 0x7B, 0x35, 0x4A, 0x9C, 0x2C, 0xB1, 0x5E, 0x15,
-    0xD7, 0x10, 0x06, 0x98, 0xCD, 0x19, 0x2B, 0x58, 0x02, 0x2A, 0xEE, 0x71, 0x14, 0xB4, 0x97, 0x97,
-    0x7D, 0xB4, 0x0C, 0xBB, 0x89, 0x8D, 0xDD, 0xFB, 0x55, 0xD2, 0xA5, 0xE0, 0xB9, 0x63, 0x4F, 0x04,
-    0xCC, 0x86, 0x91, 0xE7, 0x75, 0xD4, 0xB4, 0x2D, 0xBF, 0xE5, 0x96, 0x35, 0xD3, 0xC5, 0xEF, 0x5C,
-    0xF8, 0xE1, 0x2A, 0xFA, 0xA0, 0x88, 0x3E, 0x11, 0xCC, 0x78, 0xA8, 0x90, 0x49, 0xF3, 0xC8, 0x06,
-    0xF8, 0x58, 0x9F, 0x07, 0x9B, 0x7C, 0xD9, 0x4C, 0x62, 0x3F, 0x55, 0x43, 0xF7, 0x95, 0x96, 0xB3,
-    0x54, 0x07, 0xF4, 0xD0, 0xBE, 0x16, 0xD8, 0xD3, 0xA8, 0x99, 0xA1, 0x17, 0xF3, 0x7C, 0xF9, 0xC4,
-    0xBA, 0xE6, 0x4C, 0x30, 0xBC, 0x2D, 0x73, 0x47, 0xFC, 0x00, 0xD0, 0x9B, 0x35, 0x07, 0x72, 0xB4,
-    0x50, 0x5D, 0x30, 0xE5, 0x6D, 0xF3, 0x2B, 0x8B, 0xA9, 0x2A, 0x5E, 0x73, 0xAD, 0x64, 0x56, 0x26,
-    0x0B, 0xCB, 0x82, 0x13, 0xA0, 0x7F, 0x08, 0x10, 0x53, 0x20, 0x0F, 0x89, 0x0A, 0x97, 0x12, 0x2D,
-    0x98, 0xDF, 0x0C, 0x22, 0x9B, 0x21, 0xB2, 0xB3, 0x32, 0x0B, 0x3E, 0xFE, 0xAB, 0xFC, 0xCA, 0xBB,
-    0xFF, 0x91, 0x39, 0xD3, 0x9B, 0x0E, 0x46, 0x0C, 0x11, 0xC2, 0x38, 0x73, 0x83, 0xBD, 0x28, 0xBA,
-    0x3E, 0x8C, 0x26, 0x20, 0x11, 0xDC, 0x06, 0x32, 0x1E, 0x43, 0x87, 0x63, 0x36, 0x85, 0x98, 0xB2,
-    0xDE, 0xAE, 0xD9, 0x5E, 0xC9, 0xD8, 0xEA, 0xA8, 0xA5, 0x69, 0xB8, 0xF9, 0xD7, 0x19, 0xA7, 0x8A,
-    0x7E, 0xD6, 0x24, 0x00, 0x33, 0x61, 0x3E, 0x0D, 0xA1, 0x0B, 0xD0, 0x55, 0xE4, 0x30, 0xAC, 0x8B,
-    0xDB, 0x18, 0x49, 0xB0, 0x28, 0xD0, 0xD3, 0x98, 0xCE, 0x48, 0xFC, 0xE6, 0xC7, 0xAF, 0x37, 0xB2,
-    0xBB, 0x3B, 0xD9, 0x95, 0xE8, 0x9D, 0x1B, 0xBF, 0x28, 0x65, 0x64, 0x47, 0xB0, 0xB4, 0xE7, 0xF8,
-    0x9C, 0x17, 0xDC, 0x7E, 0xAB, 0x1F, 0xFB, 0x53, 0xB0, 0x09, 0x7A, 0x10, 0xC0, 0xAC, 0xFA, 0xFB,
-    0x2E, 0xFD, 0xB1, 0x18, 0xA8, 0x22, 0x07, 0x0C, 0x19, 0x39, 0x81, 0x8C, 0x11, 0x68, 0x8B, 0x56,
-    0x79, 0x82, 0x0F, 0xEE, 0xF1, 0x8F, 0x9A, 0x4C, 0xC2, 0x97, 0xBF, 0xF9, 0xC5, 0xF7, 0xF2, 0xC6,
-    0xB8, 0x88, 0x1B, 0xCE, 0x0F, 0x77, 0xCD, 0xB7, 0x5A, 0xB4, 0x55, 0x8E, 0x53, 0xFF, 0x89, 0xB6,
-    0x9D, 0xDA, 0x3D, 0x8F, 0xE0, 0x6B, 0x78, 0xD8, 0x14, 0xAC, 0xF8, 0x6C, 0x37, 0xAE, 0x43, 0xC8,
-    0x31, 0xBB, 0xDF, 0x1B, 0x20, 0x9B, 0x6B, 0xF8, 0x11, 0xFF, 0xBB, 0xF8, 0xFD, 0xD5, 0x64, 0xDD,
-    0x1F, 0x91, 0x85, 0x11, 0x9B, 0x80, 0x3D, 0xDA, 0x8C, 0xF3, 0xFF, 0x6A, 0xF8, 0xEB, 0xC7, 0x37,
-    0x75, 0x87, 0xBB, 0xC6, 0xFD, 0xAA, 0x7E, 0xE0, 0xBA, 0xAF, 0xA3, 0x79, 0xE2, 0xF4, 0x43, 0x8E,
-    0x9D, 0x6F, 0xFE, 0x19, 0x76, 0x40, 0x19, 0x51, 0xEC, 0xFE, 0xA5, 0x45, 0x63, 0x70, 0xE5, 0xDB,
-    0xE4, 0xF2, 0x62, 0xED, 0xCD, 0x58, 0x77, 0x1A, 0x77, 0xD6, 0x8D, 0xC8, 0xD9, 0xF3, 0x58, 0x9F,
-    0x96, 0xE8, 0x1F, 0xB6, 0x5B, 0x1E, 0xED, 0xA5, 0x36, 0x1B, 0x18, 0xFF, 0x8F, 0x59, 0x66, 0x7D,
-    0x8F, 0x88, 0x53, 0x68, 0x8F, 0x71, 0x70, 0x17, 0x72, 0x8E, 0x01, 0x30, 0x60, 0x25, 0x68, 0xC2,
-    0x86, 0xCE, 0x46, 0xCF, 0x52, 0x26, 0x05, 0x90, 0xA2, 0x17, 0x3D, 0x3F, 0x5C, 0xE4, 0xB7, 0xD7,
-    0x73, 0x6E, 0x24, 0x53, 0xD0, 0x31, 0xBB, 0x26, 0xC3, 0x6D, 0x80, 0xCD, 0xCF, 0x92, 0x53, 0x9C,
-    0xF6, 0xAB, 0xBA, 0x27, 0x10, 0x69, 0x93, 0x30, 0xA1, 0x7D, 0xB1, 0x7E, 0x3D, 0xE6, 0xA1, 0x31,
-    0xB5, 0xF8, 0xAF, 0xF5, 0x3F, 0x9A, 0x4F, 0xE6, 0xEE, 0xF2, 0x47, 0xEF, 0xB9, 0xFE, 0x35, 0xEE,
-    0x0B, 0x04, 0xC5, 0xEF, 0x01, 0xCD, 0x5A, 0x3F, 0x8C, 0xDC, 0x56, 0x7A, 0xFF, 0xC8, 0xB7, 0x5A,
-    0x26, 0x26, 0xCE, 0x4F, 0x85, 0x1C, 0xE8, 0x2C, 0xAD, 0x98, 0xC2, 0xC5, 0xC1, 0x90, 0x97, 0x29,
-    0x54, 0xA8, 0x98, 0x19, 0x52, 0x16, 0x10, 0x03, 0xB9, 0xE2, 0x54, 0x9C, 0x9C, 0xE2, 0x10, 0xD8,
-    0x45, 0xAA, 0x03, 0x92, 0xBD, 0xE2, 0x0A, 0x15, 0x33, 0x3B, 0xF4, 0xA9, 0x70, 0x71, 0x40, 0xB4,
-    0x45, 0x92, 0xC6, 0x4D, 0x8A, 0x54, 0x0B, 0x24, 0x52, 0xB1, 0xC5, 0x22, 0x37, 0xB3, 0x43, 0x49,
-    0xC5, 0x15, 0x2E, 0x4C, 0xDB, 0x85, 0x0A, 0x17, 0xA6, 0xED, 0x4B, 0x0E, 0x88, 0x00, 0xEB, 0x19,
-    0xA2, 0x2F, 0x5C, 0x9B, 0x33, 0x2F, 0xBF, 0xDF, 0x23, 0x67, 0x77, 0x47, 0xC6, 0x15, 0x97, 0x13,
-    0xA4, 0x8C, 0xB4, 0xB3, 0xC3, 0x21, 0xF9, 0xBD, 0xDF, 0xFB, 0xFE, 0xFE, 0xBE, 0x8F, 0x2B, 0x6B,
-    0xA2, 0xF3, 0xC0, 0x78, 0x95, 0x9C, 0x16, 0xBC, 0x52, 0x29, 0xE5, 0xB2, 0x6C, 0x48, 0x98, 0xAA,
-    0x5C, 0x8C, 0x0C, 0x25, 0x16, 0x9D, 0xA9, 0xC2, 0x37, 0xD2, 0x48, 0x22, 0x71, 0xAA, 0x73, 0x3F,
-    0x15, 0xF7, 0xF2, 0x4B, 0x91, 0xBE, 0x08, 0x2E, 0x93, 0x9E, 0x48, 0x90, 0x89, 0xB7, 0x48, 0x7D,
-    0xBB, 0x10, 0x6B, 0x4D, 0x72, 0x61, 0x43, 0xDF, 0xC5, 0x3D, 0x17, 0x65, 0xA0, 0x72, 0x55, 0x5C,
-    0x96, 0x61, 0x90, 0x86, 0xF9, 0x1D, 0x99, 0x68, 0x09, 0x8A, 0x72, 0x2D, 0xD9, 0x08, 0xEE, 0xD9,
-    0x07, 0x55, 0x68, 0x1B, 0x89, 0x0E, 0x45, 0x6E, 0x08, 0x56, 0x13, 0x2C, 0x26, 0x5A, 0xC4, 0x83,
-    0xD4, 0xD7, 0xF0, 0xAB, 0x5B, 0x04, 0xAF, 0x75, 0x8B, 0xB7, 0x19, 0xDE, 0xC2, 0x62, 0x2A, 0x00,
-    0x54, 0x89, 0x2A, 0xB1, 0x68, 0x24, 0x6B, 0x22, 0x13, 0x9C, 0x52, 0xB8, 0x43, 0x22, 0x5C, 0xFF,
-    0xC2, 0x62, 0x37, 0xC3, 0x85, 0x0B, 0x1C, 0x65, 0xF8, 0x6A, 0xC4, 0x73, 0x10, 0x0A, 0xFC, 0xDD,
-    0x11, 0x36, 0x21, 0xFE, 0xED, 0x7F, 0x7A, 0x73, 0x4F, 0x5B, 0x6B, 0xF3, 0xE4, 0x9F, 0x67, 0x0B,
-    0xF9, 0x97, 0xA3, 0x65, 0x2E, 0x63, 0x5D, 0xF5, 0x91, 0xBD, 0x95, 0xE9, 0x85, 0x2D, 0x64, 0x04,
-    0x7D, 0xE8, 0x54, 0x67, 0x9E, 0x91, 0x7D, 0xB9, 0x80, 0x8F, 0x7E, 0x89, 0x8F, 0xB1, 0x0C, 0x44,
-    0xCD, 0xDF, 0x2A, 0xFC, 0x6F, 0xED, 0xA3, 0x74, 0xFF, 0x85, 0x9D, 0x9E, 0x07, 0xA4, 0x32, 0xB6,
-    0x9E, 0x3D, 0xB4, 0x75, 0x60, 0x8B, 0x85, 0xF8, 0x95, 0x57, 0x03, 0x0C, 0xD6, 0xAD, 0x25, 0xCC,
-    0x35, 0x60, 0x66, 0xC0, 0x98, 0xA8, 0x42, 0xBE, 0x3F, 0x4F, 0xFE, 0x56, 0xC6, 0xDF, 0x40, 0xF6,
-    0x9B, 0xF6, 0x3A, 0xF4, 0x55, 0x01, 0xA6, 0xB5, 0xA5, 0x24, 0x16, 0x5B, 0xC3, 0x6A, 0xD8, 0x1F,
-    0x34, 0x09, 0x1D, 0xE3, 0x55, 0xE3, 0x67, 0x0B, 0xFB, 0x08, 0xA0, 0x21, 0xBE, 0x22, 0xD9, 0x84,
-    0xAA, 0x7B, 0xF8, 0x77, 0x03, 0x70, 0x2A, 0x31, 0x9E, 0x91, 0x63, 0xFD, 0xA4, 0x61, 0x0A, 0xA8,
-    0x27, 0x2E, 0x1A, 0xCA, 0x19, 0x7C, 0x0D, 0x00, 0xB6, 0xD0, 0x57, 0x6A, 0x9D, 0x6E, 0xEA, 0x22,
-    0x78, 0x63, 0x22, 0xFE, 0xFB, 0x99, 0x98, 0x5A, 0x7A, 0x61, 0x1E, 0xCA, 0xD4, 0x33, 0x41, 0x91,
-    0xC8, 0x50, 0x55, 0x3A, 0x8D, 0x5F, 0x2F, 0xBC, 0xEA, 0xE7, 0x12, 0xBD, 0x26, 0xDE, 0xC3, 0x3F,
-    0x95, 0x04, 0x1A, 0xF8, 0xD8, 0x04, 0xE5, 0xEC, 0xBD, 0x12, 0xF7, 0xCB, 0x4B, 0x22, 0x67, 0xBD,
-    0x37, 0xCA, 0x83, 0x03, 0xFD, 0x20, 0xDB, 0x17, 0x79, 0x89, 0x76, 0x19, 0x03, 0xB6, 0x24, 0x3B,
-    0x3F, 0x29, 0xA9, 0xDA, 0x10, 0xDE, 0x21, 0x58, 0x7A, 0xCF, 0x3B, 0x48, 0xF7, 0xB4, 0xD8, 0x5A,
-    0xDD, 0x2B, 0xFA, 0x2A, 0xBB, 0xD8, 0x0B, 0xB2, 0x4B, 0xDE, 0x17, 0xF9, 0x9E, 0xC8, 0x8B, 0x97,
-    0x61, 0x57, 0x79, 0x9C, 0xD1, 0xC0, 0x3D, 0x0D, 0x01, 0x5F, 0xE4, 0xD0, 0xC9, 0x85, 0xD7, 0xD4,
-    0x6F, 0xCE, 0xFA, 0x79, 0x19, 0xD9, 0xBC, 0x17, 0xA6, 0x2F, 0xEF, 0x84, 0x69, 0xDF, 0xF9, 0x54,
-    0x45, 0xAB, 0xAA, 0x43, 0xEF, 0x80, 0xDB, 0x87, 0x0E, 0xC4, 0x83, 0xB6, 0xB0, 0xA1, 0xC0, 0xE6,
-    0xA3, 0x6D, 0x55, 0xEC, 0x5D, 0x50, 0xF9, 0x9E, 0x56, 0xF9, 0xBE, 0x0E, 0x3E, 0x1C, 0xFC, 0x6A,
-    0x6F, 0xF6, 0xA3, 0xFC, 0xDA, 0x19, 0xAA, 0xCD, 0x7E, 0xCE, 0x8B, 0xCF, 0x7A, 0x59, 0x98, 0x4F,
-    0x94, 0x49, 0xA4, 0x89, 0xF2, 0x71, 0x60, 0x74, 0xD1, 0xC8, 0x5C, 0xE7, 0xCA, 0x0C, 0x44, 0xBF,
-    0x53, 0x49, 0x2F, 0xC8, 0x65, 0xE7, 0xBC, 0xB8, 0xEB, 0xED, 0x07, 0x70, 0x54, 0xE7, 0xBA, 0xBA,
-    0x75, 0x62, 0xAA, 0xF4, 0xA7, 0xBB, 0x63, 0xFB, 0xD0, 0x56, 0xE2, 0x5D, 0xA3, 0x75, 0x0A, 0x6C,
-    0x6B, 0x13, 0xDE, 0xE8, 0x15, 0xDF, 0x4B, 0xAA, 0x8B, 0xA1, 0xBA, 0xA5, 0x6E, 0x66, 0x9F, 0xE7,
-    0x77, 0x8A, 0x7E, 0x79, 0xF1, 0x92, 0x36, 0xE1, 0x8B, 0xEA, 0x1F, 0xFC, 0xFB, 0xF9, 0x67, 0x65,
-    0xF9, 0xB3, 0xC5, 0xC6, 0xCF, 0x35, 0x3D, 0xA8, 0x82, 0xEA, 0xC3, 0xFF, 0x86, 0xF5, 0x5E, 0xDE,
-    0x91, 0x57, 0x77, 0xDF, 0xB0, 0xCD, 0xAB, 0xBB, 0xF4, 0xBD, 0x70, 0x2E, 0x76, 0x1E, 0x66, 0x93,
-    0x9E, 0x54, 0x46, 0x7D, 0x5C, 0x68, 0x40, 0xD4, 0x36, 0x0F, 0x6B, 0x67, 0xBE, 0x15, 0x00, 0x3D,
-    0x79, 0xF5, 0xF6, 0xEE, 0x2D, 0x00, 0xBB, 0xFE, 0xF5, 0x8F, 0x57, 0xCF, 0x9C, 0xE9, 0xAC, 0xAD,
-    0xAC, 0x6D, 0x2C, 0x5D, 0x66, 0x2B, 0x83, 0x8C, 0x69, 0x74, 0x35, 0xEF, 0xAF, 0xE1, 0x3C, 0x0C,
-    0x31, 0xE1, 0x1B, 0x9D, 0x0F, 0x6E, 0x1E, 0xDB, 0x0A, 0x1E, 0xCE, 0xEB, 0xFF, 0x3E, 0x4D, 0xE6,
-    0xE1, 0x2F, 0xCA, 0xB7, 0x2F, 0x40, 0x90, 0x57, 0xF9, 0x56, 0x5E, 0xAD, 0x05, 0x5A, 0x18, 0x42,
-    0x1F, 0x3F, 0x29, 0x67, 0x95, 0xF7, 0x8F, 0x08, 0xF9, 0x41, 0xF8, 0x61, 0x3D, 0x08, 0xD3, 0x6B,
-    0xDD, 0x12, 0xFB, 0x70, 0xA3, 0x80, 0x11, 0x1F, 0x21, 0x33, 0x40, 0xEC, 0x80, 0x21, 0xC6, 0x70,
-    0xC0, 0x7D, 0x7D, 0xC4, 0x80, 0xD7, 0x3A, 0x37, 0xCC, 0x9E, 0x30, 0xEE, 0x1A, 0xFC, 0x53, 0x26,
-    0xAC, 0x24, 0x2A, 0xFF, 0xE3, 0xBF, 0xF2, 0x99, 0xFD, 0xF5, 0xC2, 0xFF, 0xB4, 0xD6, 0x85, 0xF6,
-    0x10, 0xA0, 0x3D, 0xDA, 0xCF, 0x7C, 0xC7, 0xB7, 0x55, 0x26, 0x2B, 0x2F, 0x6F, 0x06, 0xB0, 0x63,
-    0x3B, 0x87, 0xC7, 0xBE, 0x4F, 0xF7, 0xEA, 0x61, 0x9B, 0x35, 0xD6, 0xB7, 0x1F, 0x33, 0xA0, 0x37,
-    0x70, 0xD4, 0xDC, 0x11, 0x6D, 0x1F, 0xE7, 0xD8, 0xD8, 0x2D, 0x5C, 0x30, 0x47, 0xB0, 0xDA, 0xAF,
-    0xE0, 0x76, 0xBF, 0x7A, 0x9F, 0xF1, 0xCD, 0x55, 0x2E, 0x63, 0x15, 0x0F, 0x97, 0x4B, 0xB8, 0x41,
-    0xA5, 0xDE, 0x11, 0xBA, 0x19, 0x5C, 0xE8, 0x6F, 0xF0, 0xA1, 0x6F, 0xC4, 0xC3, 0xCE, 0x25, 0x3E,
-    0xC0, 0x16, 0xC7, 0xC5, 0x72, 0xD5, 0x28, 0xFA, 0xE4, 0x2B, 0x78, 0xDB, 0xFA, 0x95, 0x85, 0x2A,
-    0xFB, 0xE1, 0xBB, 0x25, 0x4E, 0x6E, 0x04, 0xF3, 0xB0, 0x81, 0x72, 0x26, 0xCB, 0x30, 0xF3, 0x4B,
-    0x55, 0x9C, 0xAB, 0xC6, 0x0C, 0xC3, 0x53, 0xE2, 0xD9, 0x2C, 0x7E, 0x2B, 0x35, 0x9B, 0x61, 0xB6,
-    0xDF, 0x57, 0xA5, 0x81, 0x17, 0x4E, 0xF4, 0x2F, 0xF3, 0xA8, 0x91, 0x53, 0x8C, 0x8A, 0xD8, 0x7E,
-    0x06, 0x17, 0xF4, 0xE5, 0x6D, 0xBA, 0x99, 0x67, 0x90, 0x37, 0xF3, 0x5A, 0xC6, 0x61, 0xA9, 0xCC,
-    0x18, 0x3E, 0x58, 0x24, 0x57, 0x4D, 0x98, 0x37, 0x3E, 0x3C, 0xF1, 0x95, 0x20, 0x5D, 0xD9, 0xFD,
-    0x2B, 0x22, 0x7F, 0x27, 0xCC, 0x6C, 0xF0, 0x13, 0xC1, 0xB2, 0xEB, 0x93, 0x36, 0xA9, 0x0D, 0x5B,
-    0xB5, 0xED, 0x33, 0xFE, 0x9D, 0xDE, 0xFA, 0xEE, 0x34, 0xBF, 0x80, 0xC5, 0xA1, 0xD6, 0x3E, 0x7E,
-    0xE0, 0x1E, 0x0D, 0xA2, 0x46, 0xA7, 0xAA, 0x51, 0xF4, 0x57, 0x3D, 0x8C, 0x6A, 0xDC, 0xD9, 0xBF,
-    0x01, 0xCC, 0x46, 0x2A, 0x84, 0x9F, 0x2A, 0x54, 0x61, 0x28, 0x4A, 0xA7, 0x86, 0xA2, 0x12, 0x06,
-    0x4A, 0xBF, 0xFD, 0x05, 0xA1, 0x7E, 0xE1, 0xF2, 0x22, 0xE4, 0x04, 0x45, 0xFB, 0xEB, 0x09, 0xE3,
-    0x1C, 0xBD, 0x0A, 0x87, 0x13, 0x17, 0x13, 0x27, 0x2E, 0x26, 0x4E, 0x86, 0xF3, 0x90, 0xE1, 0xEF,
-    0x60, 0x0D, 0x5B, 0x9C, 0xC6, 0xE1, 0x64, 0x5A, 0xC0, 0xC7, 0x20, 0x8B, 0x2A, 0xE0, 0xD4, 0x32,
-    0x23, 0xCE, 0x9E, 0x5F, 0x0D, 0x70, 0x62, 0x4F, 0xE5, 0x9B, 0x51, 0x4D, 0xCF, 0xE8, 0x8F, 0x1B,
-    0xD5, 0x6E, 0x12, 0xA2, 0x08, 0x04, 0xA2, 0xE0, 0x75, 0x14, 0x35, 0x70, 0x62, 0x98, 0x1A, 0xA1,
-    0x0D, 0x6A, 0x22, 0xA4, 0xFD, 0x6B, 0x6A, 0x23, 0x42, 0x8C, 0x6E, 0xFC, 0x1E, 0x98, 0xA2, 0x70,
-    0x65, 0xED, 0x6E, 0xD2, 0x36, 0x73, 0x78, 0x5F, 0x2F, 0x9D, 0x17, 0xA6, 0xFB, 0x4E, 0x7F, 0xF4,
-    0x4A, 0x7C, 0xF2, 0x26, 0x6E, 0x15, 0x65, 0xDD, 0x17, 0xF2, 0xD7, 0xD0, 0x27, 0x31, 0x0F, 0x91,
-    0xEE, 0x15, 0x53, 0xBD, 0x16, 0x85, 0xFA, 0x84, 0xC4, 0xAA, 0x3E, 0xFD, 0xB3, 0x59, 0x86, 0x7A,
-    0xF8, 0xE0, 0x97, 0x0B, 0x84, 0x80, 0xFA, 0xA8, 0xB8, 0x26, 0xAC, 0x6A, 0xA6, 0x55, 0x6D, 0x8F,
-    0x59, 0x4B, 0x31, 0x93, 0x63, 0x09, 0x0B, 0x78, 0x5C, 0x02, 0x4A, 0x75, 0x8E, 0x6E, 0xDA, 0x12,
-    0x85, 0x6B, 0x2E, 0xAE, 0x62, 0x4C, 0x51, 0x90, 0x74, 0x81, 0xC8, 0xF1, 0x78, 0xF4, 0x7D, 0x09,
-    0x6A, 0xB9, 0xCD, 0xA8, 0x8C, 0x18, 0x79, 0x95, 0x4C, 0xF1, 0xC1, 0x61, 0x41, 0xC8, 0x8D, 0xFC,
-    0xAB, 0xB6, 0xD6, 0x56, 0xE2, 0xCC, 0xDD, 0x27, 0xAE, 0x3E, 0x62, 0x6D, 0x97, 0x3E, 0xE2, 0xD2,
-    0xBD, 0x3B, 0x93, 0x9D, 0x39, 0x16, 0xEF, 0x42, 0xD9, 0x85, 0x5B, 0xE0, 0x2A, 0x85, 0xE5, 0x7D,
-    0x9B, 0x2E, 0xF4, 0x3E, 0x60, 0x24, 0x56, 0x44, 0x15, 0x51, 0xA7, 0xAA, 0x60, 0x65, 0x9C, 0xD0,
-    0xDF, 0x34, 0x35, 0x8E, 0xBD, 0xE0, 0x8E, 0xC1, 0xF5, 0x31, 0x8E, 0x2D, 0x33, 0xE1, 0x37, 0xBB,
-    0xB7, 0x33, 0x9C, 0xF0, 0x18, 0xF2, 0xB4, 0x0C, 0x76, 0xD7, 0x40, 0x3B, 0x40, 0x7F, 0xEE, 0x10,
-    0xB5, 0xF9, 0x81, 0x35, 0x9E, 0xA5, 0xDF, 0xB2, 0x1C, 0x0B, 0xF1, 0x0A, 0xF5, 0x06, 0x41, 0x6E,
-    0xCD, 0x59, 0xE6, 0x22, 0xE7, 0xB9, 0x22, 0x6B, 0xB9, 0x84, 0xC3, 0x98, 0x38, 0x3E, 0x70, 0x8B,
-    0x89, 0xA1, 0x6C, 0xA3, 0x29, 0x7F, 0xAE, 0x3A, 0x73, 0x69, 0x28, 0x67, 0xDC, 0x59, 0x8A, 0xDC,
-    0x67, 0xCE, 0x0E, 0x02, 0xF3, 0x84, 0x43, 0x3F, 0x7B, 0x64, 0x5E, 0x4A, 0x67, 0xDA, 0x0E, 0x28,
-    0xA7, 0x64, 0x11, 0x9E, 0x84, 0xF9, 0x2A, 0x26, 0x67, 0x53, 0x47, 0xAF, 0x64, 0xCC, 0x37, 0xCD,
-    0xC0, 0xF2, 0x1F, 0xD1, 0xDC, 0x3D, 0x9A, 0x5F, 0xFF, 0x30, 0x67, 0xEA, 0x27, 0xB2, 0x3E, 0x13,
-    0x4B, 0x98, 0x33, 0x9C, 0x0D, 0x91, 0x6D, 0x72, 0x2F, 0xEA, 0x3F, 0x11, 0x70, 0x88, 0x17, 0xEC,
-    0x25, 0xDA, 0xDD, 0xAD, 0x19, 0xAD, 0x11, 0x6B, 0x18, 0xE0, 0x20, 0x11, 0x80, 0x65, 0xE2, 0xEC,
-    0xDC, 0x9B, 0xED, 0xC8, 0xD6, 0x7C, 0x6C, 0x5D, 0x2D, 0xEE, 0xD6, 0x0C, 0x08, 0x47, 0xBE, 0xE6,
-    0xCA, 0x1B, 0x4C, 0xA4, 0x7E, 0xB1, 0xC7, 0xDD, 0xBF, 0xC5, 0x6F, 0x67, 0xF9, 0x91, 0xBA, 0x9E,
-    0x07, 0xBE, 0xE3, 0x12, 0x4D, 0x82, 0x24, 0x5B, 0xD4, 0x38, 0x24, 0x37, 0x2E, 0x71, 0x07, 0x96,
-    0xD5, 0x1C, 0xC9, 0x24, 0x63, 0xF5, 0x53, 0x0F, 0xDC, 0x0D, 0xFE, 0xE7, 0x0E, 0xA1, 0xEF, 0x70,
-    0x00, 0x4E, 0x72, 0x8A, 0xE0, 0x2B, 0xED, 0x78, 0x1F, 0x18, 0x25, 0x9D, 0x64, 0xFA, 0x66, 0xBB,
-    0x8B, 0x96, 0x0B, 0xF6, 0xAF, 0xBB, 0xED, 0xF4, 0x59, 0xEC, 0x33, 0x40, 0x05, 0xF6, 0x3D, 0x18,
-    0x10, 0x70, 0x7A, 0x4C, 0x8C, 0x8D, 0x6C, 0x49, 0x5C, 0xFB, 0xC4, 0x9D, 0x2C, 0x08, 0x84, 0x1A,
-    0x61, 0x79, 0x02, 0x23, 0xC0, 0x0F, 0x58, 0x47, 0xE5, 0x35, 0x3E, 0x29, 0xC0, 0x36, 0xDC, 0x0D,
-    0x0E, 0x10, 0xFA, 0x55, 0xE7, 0x5C, 0x8E, 0x47, 0x8F, 0x96, 0xB5, 0x7A, 0xB2, 0xFC, 0x30, 0xE5,
-    0x87, 0xB2, 0x55, 0xE3, 0x1A, 0x22, 0xDB, 0x2F, 0xA2, 0xC3, 0x37, 0x1B, 0xC0, 0x81, 0x1D, 0x66,
-    0xB4, 0x05, 0xDB, 0x06, 0xD7, 0x13, 0x90, 0xA7, 0xAF, 0x13, 0x6B, 0xDC, 0x25, 0x02, 0xA7, 0xFE,
-    0x57, 0xE4, 0x28, 0x39, 0xDC, 0xE0, 0x95, 0xDC, 0x45, 0xD0, 0x2C, 0x3F, 0xC9, 0xB5, 0x13, 0x3E,
-    0x35, 0x83, 0xC2, 0x40, 0x05, 0x80, 0x79, 0x84, 0xBD, 0xB8, 0x2D, 0x01, 0x61, 0xE1, 0x0A, 0x81,
-    0x4B, 0xA7, 0x34, 0x14, 0xA4, 0x9F, 0xA6, 0x61, 0x4A, 0xEA, 0x39, 0x6D, 0xA9, 0xFE, 0xB4, 0x23,
-    0xF7, 0xBC, 0xFC, 0x6D, 0xF2, 0x15, 0x50, 0x1D, 0x48, 0x08, 0x8B, 0x53, 0x4E, 0x15, 0x79, 0xEC,
-    0x18, 0x53, 0x97, 0x3E, 0x59, 0xB2, 0x7C, 0x2A, 0x76, 0x8C, 0x5D, 0x05, 0xF5, 0x6A, 0xE2, 0x7C,
-    0x06, 0x20, 0xCE, 0x2C, 0x93, 0x77, 0xC2, 0xCA, 0xF6, 0x18, 0x77, 0x24, 0x28, 0x8C, 0x88, 0xD4,
-    0xF4, 0xD9, 0x81, 0x58, 0x83, 0x26, 0xBC, 0x86, 0xE6, 0x37, 0x33, 0x04, 0xCF, 0x95, 0xEA, 0x89,
-    0x8C, 0x83, 0xCB, 0xE6, 0xF4, 0x5F, 0x70, 0x30, 0xB2, 0xBE, 0x09, 0x8B, 0xA1, 0x91, 0x4B, 0x6D,
-    0x2B, 0x45, 0x10, 0x5D, 0xC3, 0xB2, 0x46, 0x26, 0x5D, 0x13, 0x44, 0x21, 0x4C, 0x16, 0x68, 0x10,
-    0x3B, 0xDF, 0xC1, 0xE5, 0x67, 0x79, 0xB9, 0xC1, 0x0E, 0x82, 0x1C, 0x6D, 0xD1, 0x36, 0x37, 0x65,
-    0xC2, 0xCE, 0x25, 0x1D, 0xD3, 0xF0, 0xE0, 0x01, 0x49, 0xE1, 0x7E, 0xF9, 0xC7, 0x3B, 0x4F, 0xCF,
-    0x2D, 0x58, 0x1D, 0x5D, 0x56, 0xCA, 0x9D, 0x0F, 0xD5, 0x72, 0xE2, 0xB8, 0x74, 0x6B, 0x4F, 0x9F,
-    0x38, 0x46, 0x77, 0x63, 0xC1, 0x6E, 0xE7, 0x9D, 0x91, 0x41, 0x22, 0x22, 0x94, 0x7F, 0x10, 0xD3,
-    0xC3, 0xA5, 0x07, 0x76, 0xC2, 0xD7, 0xED, 0x8E, 0x53, 0xDE, 0xA4, 0xA5, 0x19, 0x8D, 0x6B, 0x0F,
-    0x29, 0x21, 0x6E, 0xFD, 0x75, 0xD0, 0xEA, 0x76, 0xDA, 0x7A, 0xFF, 0xCA, 0xE9, 0xD8, 0xA6, 0xA1,
-    0x8B, 0x68, 0x58, 0x10, 0x21, 0x84, 0x38, 0x13, 0xFF, 0x77, 0x88, 0x2A, 0xDF, 0x78, 0xA5, 0x9F,
-    0x9D, 0x58, 0xC3, 0x9B, 0xFD, 0xC6, 0x21, 0xA6, 0x21, 0xB8, 0x48, 0xD2, 0x1A, 0x8D, 0x72, 0x19,
-    0x1A, 0x4D, 0x1B, 0x6B, 0x6C, 0x59, 0xA7, 0xC7, 0x17, 0x0D, 0x5A, 0xA5, 0x62, 0x55, 0xDF, 0x85,
-    0x6A, 0xC1, 0x1C, 0x76, 0x4D, 0x1A, 0x36, 0xE7, 0x63, 0xA0, 0xA8, 0x57, 0xED, 0x53, 0xC8, 0xD6,
-    0x61, 0x2B, 0x63, 0xD2, 0x02, 0x5F, 0x95, 0xB1, 0xB2, 0xE6, 0x89, 0x8B, 0xB2, 0x23, 0x60, 0x33,
-    0xB2, 0x6D, 0x67, 0xF7, 0x97, 0x5C, 0xB3, 0x03, 0x89, 0xDA, 0xDE, 0xB6, 0x94, 0x19, 0x19, 0x8A,
-    0xB0, 0xBC, 0x03, 0x1C, 0xA5, 0xE6, 0x66, 0x47, 0x8C, 0xFF, 0x88, 0x89, 0x2F, 0xA4, 0x4D, 0xC0,
-    0x73, 0xBC, 0x3A, 0x81, 0xBA, 0xB7, 0x9D, 0x65, 0xD2, 0xB8, 0x3B, 0x13, 0xB0, 0xDE, 0xB8, 0xE6,
-    0x57, 0x55, 0x38, 0x83, 0xB7, 0x38, 0x3D, 0x57, 0xD1, 0xF2, 0x25, 0x3B, 0xF3, 0xF4, 0x49, 0xAA,
-    0x76, 0x10, 0x3A, 0x95, 0xFD, 0x96, 0x2E, 0xD1, 0x67, 0x3C, 0xCA, 0x0B, 0x2E, 0xD7, 0x7C, 0xF7,
-    0x35, 0x43, 0xB7, 0x61, 0xC9, 0xEB, 0x48, 0x3E, 0x67, 0x8E, 0x52, 0x81, 0xFB, 0x20, 0xE3, 0xC1,
-    0xC8, 0x84, 0xF4, 0x28, 0xA5, 0x27, 0x20, 0x9A, 0xE8, 0x0C, 0x53, 0x9E, 0x1E, 0xE8, 0x9C, 0xA7,
-    0x5F, 0xAF, 0x78, 0x3A, 0x1F, 0xF0, 0x34, 0x18, 0x38, 0x4F, 0x7B, 0x35, 0x4F, 0x4B, 0xC2, 0xD3,
-    0x69, 0xF0, 0x30, 0xA3, 0x2F, 0xB6, 0xFC, 0x2D, 0x6A, 0xBB, 0x4F, 0xD0, 0xB2, 0x19, 0x00, 0x83,
-    0xF0, 0x37, 0xAD, 0xCB, 0x77, 0xAF, 0xD3, 0xCB, 0x2C, 0x26, 0xAE, 0x08, 0x8D, 0x09, 0x3B, 0x34,
-    0x2B, 0x69, 0x8C, 0x09, 0xDC, 0x77, 0x33, 0x08, 0x3A, 0xFA, 0x2C, 0xD5, 0xC6, 0xA7, 0x32, 0x10,
-    0x1C, 0x2E, 0xDE, 0xA4, 0xA1, 0x35, 0x1A, 0x5A, 0xA7, 0xD9, 0xE6, 0xDB, 0xF4, 0xE8, 0x0D, 0x6E,
-    0xE1, 0xD5, 0x0C, 0x85, 0x6A, 0x4E, 0x63, 0xD1, 0x03, 0x8B, 0x31, 0x67, 0x19, 0x49, 0x4A, 0xDD,
-    0x97, 0x48, 0x9A, 0x81, 0x2B, 0x2C, 0x2E, 0xEB, 0x76, 0x03, 0x12, 0xAF, 0x1D, 0x0F, 0x50, 0x41,
-    0x69, 0x57, 0x1B, 0xA3, 0x72, 0x25, 0xA5, 0x3D, 0x63, 0x40, 0x54, 0x84, 0xA2, 0x5B, 0x69, 0xC6,
-    0x62, 0xE2, 0xDC, 0x10, 0x2A, 0xF4, 0x8B, 0xA3, 0xF4, 0xF6, 0x8C, 0x01, 0x39, 0xEE, 0x74, 0x15,
-    0x9F, 0xED, 0x27, 0x88, 0xE4, 0xC7, 0xCC, 0x7E, 0xF9, 0x7C, 0x95, 0xCA, 0x3C, 0x53, 0x40, 0xA7,
-    0x39, 0x33, 0x6A, 0x22, 0x84, 0x79, 0x13, 0xE3, 0xCD, 0xC4, 0xCF, 0x11, 0x0B, 0xA7, 0x45, 0x89,
-    0x4C, 0xF4, 0x3D, 0xA3, 0x1E, 0x32, 0xE0, 0xE5, 0x00, 0x8B, 0x67, 0xE1, 0xFD, 0x32, 0x96, 0x1A,
-    0x3D, 0xE4, 0x69, 0x57, 0xB6, 0xAF, 0xD3, 0xED, 0xC7, 0xF6, 0x17, 0x05, 0x31, 0x7D, 0xC9, 0xD2,
-    0x89, 0x40, 0x45, 0xC7, 0x91, 0xA4, 0x60, 0x91, 0xE8, 0x9E, 0x00, 0x6B, 0xD0, 0x20, 0x93, 0xA9,
-    0x2F, 0x0C, 0x22, 0xBF, 0x8F, 0xA8, 0xCB, 0x54, 0x91, 0xE0, 0x8B, 0x3E, 0x3A, 0xD3, 0x0A, 0x2D,
-    0x92, 0xD1, 0xF9, 0x88, 0x38, 0x90, 0x8B, 0xA6, 0x32, 0x1F, 0x02, 0x9C, 0x8F, 0xBD, 0xC5, 0x29,
-    0x10, 0x41, 0x82, 0x86, 0x30, 0xEC, 0x94, 0xF8, 0xC2, 0x47, 0x16, 0x0D, 0x5B, 0xEF, 0x9C, 0x63,
-    0x4F, 0x6D, 0xAB, 0xD3, 0x86, 0x5C, 0xDB, 0x92, 0x1E, 0xC8, 0x92, 0x3A, 0x74, 0x41, 0x77, 0x6A,
-    0x45, 0x75, 0x89, 0xCD, 0xB4, 0xBD, 0xC7, 0x44, 0xC3, 0x24, 0x84, 0x60, 0x1E, 0x30, 0x32, 0xA0,
-    0x39, 0x9F, 0x35, 0x08, 0x47, 0xCC, 0x03, 0x6C, 0xB9, 0x38, 0xFC, 0xC8, 0x50, 0x94, 0x3C, 0xD7,
-    0x4B, 0x33, 0x75, 0x65, 0x4C, 0x88, 0x15, 0x73, 0x66, 0xC4, 0xEC, 0x85, 0xA3, 0x84, 0x37, 0xE0,
-    0x23, 0x8A, 0x9F, 0xDB, 0xA7, 0xBF, 0xE0, 0x40, 0x4A, 0x13, 0x1F, 0x92, 0xEF, 0xCE, 0x89, 0xC5,
-    0x3D, 0x59, 0xCE, 0x38, 0x5C, 0x08, 0x3A, 0x56, 0xD1, 0xC6, 0xA0, 0x97, 0xFE, 0x7F, 0xC0, 0xD7,
-    0x36, 0x0F, 0xE9, 0x32, 0x22, 0x1D, 0xE1, 0x40, 0x55, 0xC9, 0x58, 0x24, 0x2F, 0x3D, 0x7F, 0x7C,
-    0x0C, 0x07, 0x89, 0xEE, 0xD2, 0x71, 0x19, 0x0F, 0xAC, 0xA6, 0xDF, 0x6D, 0xE8, 0x41, 0x31, 0x6C,
-    0x13, 0x2F, 0x24, 0x5C, 0x74, 0x6B, 0xB8, 0x64, 0xBD, 0xCD, 0x72, 0x0A, 0xA7, 0xC2, 0xD1, 0xC4,
-    0x31, 0xE2, 0x9C, 0xCB, 0xD5, 0xC4, 0x87, 0x4A, 0x15, 0x66, 0x64, 0xB6, 0xB5, 0xA3, 0x09, 0x69,
-    0xBB, 0xA1, 0x84, 0x37, 0xB0, 0x40, 0x95, 0xFC, 0x38, 0x64, 0x9E, 0x02, 0x69, 0x8A, 0xCB, 0x73,
-    0xA5, 0xB4, 0x9D, 0xBB, 0x6F, 0x0F, 0x4F, 0x24, 0x73, 0xC7, 0x59, 0x39, 0xD9, 0xF0, 0x18, 0x31,
-    0x9A, 0x8E, 0x97, 0xEC, 0xC8, 0x49, 0x3E, 0xE1, 0xB4, 0x96, 0xDB, 0x39, 0xA0, 0x8D, 0x2B, 0x56,
-    0xCB, 0x4C, 0x71, 0x15, 0xEC, 0x97, 0x8D, 0x82, 0xE3, 0x25, 0xAC, 0xF4, 0x03, 0x57, 0x90, 0x99,
-    0xA5, 0x23, 0x86, 0xAA, 0xAE, 0x97, 0x1E, 0x1C, 0x16, 0x4B, 0x96, 0xAD, 0xF3, 0xE5, 0xA0, 0x3A,
-    0x4A, 0x3B, 0x06, 0xED, 0x13, 0x91, 0xB6, 0xCB, 0xBA, 0x1F, 0x72, 0x5A, 0xB9, 0x55, 0x4B, 0x3B,
-    0x65, 0x71, 0x77, 0x52, 0x9B, 0xFA, 0x21, 0xC2, 0xB6, 0xF2, 0x6B, 0x37, 0xAC, 0x83, 0xEE, 0x26,
-    0x58, 0x3F, 0xCC, 0xB1, 0x6A, 0x43, 0xEA, 0x98, 0x86, 0x60, 0x0F, 0x32, 0x59, 0x47, 0x19, 0x23,
-    0x37, 0xB2, 0x1D, 0x65, 0x70, 0x83, 0x70, 0x97, 0x0B, 0x6C, 0x27, 0xFD, 0xA7, 0x2D, 0xAB, 0xC0,
-    0x39, 0x75, 0x38, 0x73, 0x00, 0x46, 0x8E, 0x4B, 0x38, 0x36, 0xA1, 0x1C, 0xB5, 0xD8, 0x74, 0x5F,
-    0xB4, 0x93, 0x24, 0xD7, 0x32, 0xEC, 0xB9, 0x1E, 0x85, 0xCD, 0x4C, 0xD1, 0x77, 0x55, 0x88, 0x1A,
-    0x9A, 0xF8, 0x6E, 0xF4, 0x42, 0x82, 0x0B, 0x6D, 0x54, 0xA4, 0x1B, 0xAD, 0xF2, 0x81, 0x18, 0x3B,
-    0xC5, 0xEA, 0x83, 0x3F, 0xE1, 0x0E, 0xAA, 0x1A, 0xBE, 0x14, 0xDC, 0x27, 0xAA, 0x98, 0xE9, 0x00,
-    0x37, 0x9F, 0x96, 0x76, 0x66, 0xE4, 0xEA, 0x99, 0xE7, 0x68, 0xAE, 0x7E, 0xCF, 0xCD, 0x0D, 0x5D,
-    0xBE, 0xDE, 0x3C, 0x2E, 0xC4, 0x61, 0xA7, 0x31, 0x5D, 0x74, 0x4D, 0x06, 0x19, 0xE7, 0xF9, 0x63,
-    0xA3, 0x44, 0xD5, 0x1E, 0xB6, 0x86, 0xD4, 0x19, 0x97, 0x41, 0x11, 0x14, 0x3A, 0x0B, 0xF2, 0xD8,
-    0x75, 0x78, 0x3A, 0xA3, 0x52, 0xA8, 0xA3, 0x09, 0x92, 0x62, 0x83, 0x32, 0xDE, 0xA8, 0x2F, 0xCF,
-    0x1F, 0xBC, 0xB5, 0x39, 0x1C, 0xCF, 0x63, 0x13, 0x97, 0x51, 0xEE, 0x2D, 0xE7, 0x33, 0x0E, 0x0B,
-    0xD5, 0x4C, 0x85, 0x75, 0x93, 0x37, 0x49, 0x9F, 0xE6, 0x1A, 0x5D, 0xDF, 0x05, 0xA5, 0xAB, 0x47,
-    0x60, 0xE2, 0xF7, 0x0B, 0x68, 0xA2, 0x44, 0x4A, 0x2E, 0x9E, 0xDE, 0x1A, 0x29, 0x1D, 0xED, 0x67,
-    0x12, 0xCD, 0x8D, 0xBC, 0x96, 0x94, 0x72, 0x36, 0x5A, 0x9D, 0xED, 0xFD, 0xB1, 0xF2, 0x49, 0x50,
-    0xE3, 0x9B, 0x08, 0xFC, 0xAB, 0x46, 0x36, 0xFD, 0xE2, 0xA9, 0xCA, 0x66, 0xBA, 0x47, 0x31, 0x92,
-    0xE0, 0x26, 0x74, 0x73, 0xB5, 0xFB, 0x41, 0x09, 0x57, 0x8B, 0xE3, 0x08, 0x7D, 0x2A, 0x36, 0xF0,
-    0xED, 0x15, 0x9B, 0xA2, 0x34, 0x7E, 0x6B, 0xC2, 0x32, 0x2E, 0xFA, 0xA0, 0xB0, 0x85, 0xBE, 0x5A,
-    0xFA, 0x26, 0xBC, 0x07, 0x32, 0x19, 0x16, 0x88, 0xE5, 0xA8, 0x18, 0x49, 0x32, 0x86, 0xE8, 0x78,
-    0x81, 0x80, 0xD2, 0x15, 0x7C, 0x8E, 0x31, 0xDC, 0x84, 0x63, 0xD9, 0x88, 0xDF, 0xBB, 0x55, 0x6E,
-    0x05, 0xF6, 0x2E, 0xDA, 0x2A, 0x9B, 0x45, 0x73, 0x96, 0x83, 0xD3, 0x1D, 0x38, 0x26, 0x2D, 0xF5,
-    0xF5, 0x90, 0x5E, 0xEF, 0xA8, 0x79, 0xDF, 0x85, 0xAE, 0x1B, 0x21, 0xF0, 0xFF, 0x54, 0x2E, 0x8D,
-    0xFF, 0xD2, 0x20, 0x7F, 0x30, 0x2F, 0xA3, 0x1D, 0xDB, 0x71, 0xCD, 0xA8, 0x9B, 0x1F, 0xFA, 0x6E,
-    0xD8, 0xD0, 0x71, 0xB8, 0x8B, 0xC2, 0x4C, 0x97, 0xA4, 0x5D, 0xB7, 0x73, 0xF4, 0xC8, 0x0A, 0xF2,
-    0x0F, 0xE6, 0xAA, 0x1C, 0x84, 0xD9, 0x20, 0x92, 0xD1, 0xC0, 0xAB, 0xFB, 0x61, 0x39, 0xB2, 0xE9,
-    0xAC, 0xE2, 0xA8, 0xAB, 0xE1, 0x42, 0x3F, 0xD8, 0x5E, 0xAF, 0x12, 0x5B, 0x44, 0x8B, 0xD6, 0x71,
-    0x4F, 0xB9, 0xA6, 0x8B, 0xF9, 0xB9, 0x9D, 0xAA, 0x22, 0x70, 0xFE, 0x7C, 0xA9, 0x04, 0x30, 0xC7,
-    0xF0, 0x11, 0x14, 0x58, 0x43, 0x5A, 0x90, 0x47, 0x57, 0xCB, 0x28, 0xAB, 0xE2, 0x0C, 0xE2, 0xE2,
-    0x39, 0xA3, 0x4C, 0xB9, 0x41, 0xE6, 0x0F, 0xA2, 0x77, 0xA6, 0x0A, 0x11, 0x3B, 0xAE, 0x8F, 0x23,
-    0x61, 0xDB, 0xB5, 0x70, 0x20, 0x00, 0x00, 0x11, 0xFB, 0xC5, 0x8B, 0xF2, 0x17, 0x7F, 0x8C, 0xC4,
-    0x33, 0x5E, 0x1A, 0xF2, 0x91, 0x4D, 0x94, 0x87, 0xE9, 0xC9, 0x9E, 0xD4, 0x83, 0x23, 0x1C, 0xCC,
-    0x05, 0x24, 0x1E, 0xD2, 0xF8, 0xE8, 0x0A, 0xDB, 0x55, 0xC5, 0x81, 0x8C, 0xD8, 0x92, 0xA5, 0xDC,
-    0x30, 0xD3, 0x01, 0xE4, 0x05, 0xE5, 0x56, 0x8A, 0x2D, 0x7B, 0x4C, 0x6E, 0x0E, 0xA2, 0xCA, 0xC2,
-    0x22, 0x30, 0x1E, 0x3B, 0x98, 0xEF, 0xF1, 0xF8, 0x9C, 0x19, 0x57, 0x9E, 0xF1, 0x8D, 0x82, 0xC7,
-    0xF0, 0x01, 0x9D, 0xCE, 0xA2, 0x34, 0x96, 0xC1, 0xF9, 0xC1, 0x64, 0x6C, 0x92, 0xAC, 0x8D, 0x19,
-    0x16, 0xAD, 0x76, 0x06, 0x8C, 0xBC, 0xB5, 0xEC, 0x4C, 0xB7, 0xF2, 0x00, 0x2B, 0x0D, 0x99, 0x3B,
-    0x91, 0xA7, 0x47, 0xEE, 0x77, 0xCE, 0x51, 0x5A, 0xC5, 0xBC, 0x36, 0x38, 0x2F, 0xDF, 0x18, 0x8E,
-    0x78, 0x8E, 0xBA, 0x97, 0x29, 0xA9, 0xCA, 0xA8, 0x52, 0x1F, 0x99, 0xBE, 0xBA, 0x5B, 0xAC, 0xFF,
-    0xE1, 0x42, 0xBC, 0xF4, 0x74, 0xA2, 0xBE, 0x6A, 0xE2, 0x9B, 0xF9, 0x8D, 0xA3, 0x47, 0x7D, 0x0D,
-    0xEA, 0x0C, 0xE1, 0xC5, 0x74, 0x14, 0x94, 0xBE, 0x98, 0x96, 0xE6, 0x68, 0x2A, 0x65, 0xDB, 0xF2,
-    0x59, 0xAE, 0x6F, 0xCB, 0xD8, 0xB4, 0xCD, 0x49, 0x67, 0x05, 0x6C, 0x27, 0xD1, 0xA9, 0x1B, 0x7C,
-    0x26, 0x6D, 0x83, 0x70, 0x03, 0x4E, 0x98, 0xD6, 0x8E, 0xB3, 0xC4, 0xFF, 0x03, 0x3C, 0x36, 0xDD,
-    0xF6, 0xE0, 0x47, 0x7E, 0x9D, 0xA0, 0xD8, 0xD7, 0x6E, 0x30, 0xD6, 0x47, 0x0D, 0x33, 0xE0, 0x63,
-    0xF7, 0x0D, 0xBB, 0x28, 0xCF, 0x24, 0x40, 0x7B, 0x00, 0x1D, 0xB2, 0xE0, 0xC0, 0xBF, 0x96, 0x4F,
-    0x8A, 0x8F, 0x72, 0x4B, 0xFF, 0xBB, 0xB9, 0x05, 0x31, 0x56, 0xCE, 0xCC, 0xAC, 0x52, 0x9F, 0xFF,
-    0xAE, 0x52, 0x9F, 0xBC, 0x53, 0xA9, 0x2F, 0x61, 0xB6, 0x06, 0x51, 0x05, 0xCD, 0x6B, 0x86, 0x58,
-    0x0E, 0xA7, 0xC8, 0x42, 0xB4, 0x68, 0x3A, 0x8B, 0x45, 0xFF, 0xD5, 0x40, 0xA2, 0x83, 0x3E, 0x7C,
-    0x1A, 0xB5, 0xFB, 0x38, 0x8F, 0xDC, 0x69, 0xED, 0x7A, 0xD0, 0x66, 0x79, 0x16, 0xCA, 0xF3, 0xC7,
-    0x1E, 0x51, 0x08, 0x87, 0x5C, 0x57, 0x40, 0x8B, 0xC3, 0x0F, 0x2B, 0xD9, 0x86, 0xC5, 0x7E, 0x5B,
-    0xC8, 0x68, 0x22, 0xC1, 0x27, 0xB9, 0x4C, 0x1A, 0x4E, 0x79, 0xFD, 0x6A, 0x2A, 0xDB, 0x81, 0x89,
-    0xF2, 0x04, 0xB5, 0x93, 0xB8, 0xD3, 0x65, 0x52, 0xEC, 0xBB, 0xD4, 0xEE, 0xB5, 0xCF, 0x54, 0x38,
-    0x10, 0xBA, 0xF6, 0x14, 0xE4, 0xB6, 0x28, 0x61, 0xDF, 0xCD, 0x09, 0xB3, 0xB9, 0x67, 0x36, 0x4F,
-    0x24, 0xF3, 0xFF, 0xBB, 0x5C, 0x0E, 0xEF, 0xEE, 0xE6, 0x9E, 0xFD, 0x54, 0xC2, 0x1F, 0xD5, 0x4F,
-    0xAA, 0x19, 0x19, 0x87, 0xF1, 0x03, 0xB1, 0x60, 0xD5, 0x55, 0x94, 0x06, 0x25, 0x24, 0xBD, 0x0B,
-    0xB9, 0xF0, 0xDD, 0x6A, 0xB2, 0xB4, 0xA0, 0x5F, 0xC5, 0x69, 0x94, 0x8D, 0xBD, 0x46, 0x5C, 0x57,
-    0xD1, 0x59, 0x70, 0x1D, 0xBB, 0x3E, 0x08, 0x0B, 0x55, 0x25, 0x69, 0x98, 0xED, 0x9D, 0x94, 0x4A,
-    0x27, 0x05, 0x58, 0x5D, 0x30, 0x77, 0x4E, 0x83, 0x02, 0xBD, 0x3E, 0xBC, 0x0B, 0x6C, 0x09, 0xBE,
-    0x31, 0xE2, 0xB0, 0x11, 0x8B, 0xDC, 0x34, 0x32, 0x45, 0x68, 0x21, 0x95, 0x8E, 0x85, 0x78, 0x11,
-    0xD6, 0x2D, 0x63, 0x5A, 0x73, 0xCF, 0xDF, 0xC1, 0x6F, 0xBC, 0x65, 0x04, 0x83, 0xF6, 0x3D, 0xB6,
-    0xDD, 0xA3, 0x6C, 0xE4, 0xDB, 0xCC, 0x4D, 0x4F, 0x60, 0xD4, 0x17, 0x8E, 0x95, 0xFE, 0x21, 0xDB,
-    0xFB, 0x47, 0x60, 0x64, 0x11, 0xB9, 0x19, 0x28, 0x63, 0x85, 0x3C, 0xAF, 0xF3, 0x01, 0xE2, 0x56,
-    0x3D, 0x28, 0x7C, 0x33, 0x04, 0x95, 0xF9, 0x75, 0x8E, 0x84, 0xBE, 0x0F, 0x1D, 0xDB, 0x2C, 0x4E,
-    0xFD, 0xDA, 0xF5, 0x0E, 0x48, 0xE4, 0x94, 0xAC, 0x43, 0x7B, 0x92, 0x6C, 0x73, 0x2E, 0x4C, 0xC7,
-    0xE1, 0x2C, 0xC1, 0xCD, 0x37, 0x57, 0xF9, 0x41, 0x6C, 0x64, 0x38, 0x33, 0x52, 0xFB, 0x06, 0xCB,
-    0x18, 0x0F, 0x1E, 0x89, 0x7C, 0x50, 0x20, 0xB7, 0xE4, 0xF4, 0x4B, 0x3E, 0x28, 0xE3, 0xE8, 0x20,
-    0x86, 0x5F, 0x8E, 0xB3, 0xD8, 0x7B, 0xF8, 0x46, 0xF2, 0xC3, 0x0F, 0xFE, 0x3D, 0xB6, 0xBA, 0xD1,
-    0x35, 0x04, 0x1E, 0xF9, 0x10, 0xFF, 0xFE, 0xC1, 0xF1, 0x83, 0xAC, 0x1D, 0x89, 0xED, 0xAF, 0x4C,
-    0x33, 0x9F, 0xC2, 0x1A, 0x1D, 0x3F, 0x98, 0x41, 0x5F, 0xDF, 0x82, 0xDA, 0xDE, 0x47, 0x98, 0x23,
-    0x66, 0x2F, 0xCA, 0xCE, 0x53, 0x5B, 0x83, 0x1E, 0x10, 0xDD, 0xAB, 0x5D, 0x0D, 0xBF, 0xE0, 0xAF,
-    0x0C, 0x5E, 0x9E, 0x02, 0xFE, 0xB5, 0xEE, 0x8F, 0x44, 0xDC, 0x50, 0x92, 0x5A, 0x72, 0x13, 0xE6,
-    0xFD, 0x27, 0x1A, 0xB7, 0xF5, 0x0A, 0x4C, 0xD9, 0xE6, 0xB8, 0x6B, 0xEA, 0x9E, 0x34, 0x3B, 0x72,
-    0xDE, 0x87, 0x8F, 0x21, 0xCD, 0x69, 0xF7, 0xC4, 0x0E, 0x6C, 0x53, 0xBF, 0x83, 0xC8, 0xDA, 0x67,
-    0xD4, 0xBE, 0x0B, 0x39, 0x37, 0x70, 0x10, 0xFC, 0x5B, 0xF7, 0x74, 0xC9, 0x11, 0xE9, 0xA6, 0x23,
-    0xCE, 0xE0, 0x6C, 0x1E, 0xDD, 0x8E, 0x0F, 0x6C, 0xDD, 0x30, 0x64, 0xB3, 0x5D, 0xE4, 0xC7, 0xE4,
-    0x59, 0x70, 0x88, 0x97, 0x9B, 0x25, 0xE1, 0xAE, 0xBB, 0x49, 0xB0, 0xB7, 0x1C, 0x58, 0xFB, 0xE5,
-    0x38, 0x95, 0x3E, 0xBC, 0x58, 0x7D, 0xF0, 0x5E, 0x29, 0xDB, 0xE8, 0x60, 0xC3, 0x9A, 0xBE, 0x06,
-    0x34, 0x1A, 0x7C, 0x1A, 0xDE, 0xC6, 0x67, 0xDF, 0xD8, 0x3E, 0xA7, 0x5B, 0x7D, 0xFE, 0x8D, 0x07,
-    0x59, 0xF6, 0x36, 0x62, 0x2A, 0xE4, 0x48, 0xF5, 0x5B, 0x38, 0xA0, 0xBE, 0x72, 0x42, 0x9E, 0xDB,
-    0xEC, 0x76, 0xDB, 0x21, 0x88, 0xBF, 0xFB, 0xAF, 0x84, 0xF1, 0x36, 0x36, 0x4E, 0x7D, 0x23, 0xD7,
-    0xA6, 0x4F, 0x2A, 0xFC, 0x99, 0x68, 0xE2, 0x7F, 0x01, 0xCD, 0x5B, 0x3F, 0x90, 0xDC, 0xE6, 0x75,
-    0x7F, 0x00, 0xC4, 0x83, 0x45, 0x98, 0x02, 0x0B, 0x2A, 0x76, 0x44, 0x49, 0x70, 0xC1, 0x82, 0x13,
-    0x9B, 0x84, 0x0B, 0x16, 0x2E, 0x6E, 0x17, 0x10, 0x35, 0x63, 0xCD, 0x58, 0x85, 0x59, 0x88, 0x51,
-    0xA1, 0x42, 0xEA, 0x53, 0x9C, 0x0A, 0x15, 0x2A, 0xF6, 0x6E, 0x21, 0xA9, 0x60, 0xA1, 0xC2, 0x97,
-    0xC2, 0x3D, 0x8B, 0x64, 0x26, 0x73, 0x99, 0x98, 0x2A, 0x58, 0x30, 0x33, 0xBB, 0xB7, 0x88, 0x58,
-    0xA8, 0x70, 0x21, 0x44, 0x89, 0x86, 0x05, 0x0B, 0x43, 0x91, 0x34, 0x99, 0x8C, 0x66, 0x4C, 0x44,
-    0x06, 0x1D, 0x90, 0xC4, 0xEE, 0x97, 0xDF, 0xEF, 0x7D, 0xC0, 0xEE, 0xDE, 0xD1, 0x96, 0x25, 0x8B,
-    0xA2, 0x7C, 0x22, 0xC1, 0xDB, 0x05, 0xF0, 0x7D, 0xEF, 0xFF, 0xFB, 0xBD, 0xF7, 0x3E, 0x89, 0xB8,
-    0x7B, 0xFF, 0x24, 0x22, 0x63, 0x93, 0x4B, 0xF7, 0xEB, 0xFA, 0xCF, 0x05, 0x5E, 0x12, 0x5E, 0xFC,
-    0x8A, 0x57, 0x93, 0xE2, 0x72, 0xB6, 0xC1, 0xC5, 0x7B, 0x1F, 0x2F, 0x48, 0x3D, 0xC1, 0x25, 0x0A,
-    0xF0, 0xAB, 0x57, 0x6C, 0xE3, 0xD7, 0x89, 0x57, 0x8A, 0x84, 0x32, 0xC4, 0x5A, 0xA5, 0x87, 0x37,
-    0x86, 0x17, 0xC7, 0xF8, 0x6C, 0x4C, 0x2D, 0xCE, 0xDD, 0xBD, 0x2B, 0x19, 0x6E, 0x38, 0x8D, 0xE0,
-    0xF1, 0x30, 0x97, 0x5A, 0xA4, 0x95, 0x18, 0x77, 0x8B, 0x93, 0x77, 0x64, 0xC3, 0xDC, 0x30, 0x95,
-    0x63, 0xE6, 0x72, 0x74, 0x6F, 0x57, 0x62, 0x53, 0xE1, 0xDF, 0xCB, 0x07, 0x08, 0x89, 0xEA, 0xAB,
-    0x32, 0x33, 0x95, 0xDB, 0xC4, 0xA5, 0x5F, 0xF8, 0x45, 0x98, 0xF9, 0x79, 0x8C, 0x85, 0x86, 0x12,
-    0x66, 0xDB, 0x12, 0xA5, 0x13, 0x10, 0x39, 0x91, 0x31, 0x56, 0x5C, 0x48, 0xEB, 0xFD, 0xF6, 0xC9,
-    0xFD, 0x97, 0xCF, 0x8E, 0xC6, 0xF3, 0xB8, 0x8A, 0xCB, 0x28, 0x77, 0xD6, 0x96, 0xD9, 0x94, 0x57,
-    0xC0, 0x4A, 0x79, 0x86, 0x5C, 0x99, 0x8C, 0x0C, 0x15, 0xB8, 0x38, 0x17, 0xBE, 0x45, 0x8E, 0xF9,
-    0xF3, 0x98, 0x9C, 0x02, 0x13, 0x15, 0xDE, 0x2B, 0xC4, 0xE7, 0x8E, 0x17, 0x1E, 0x24, 0xE7, 0x47,
-    0x78, 0xF1, 0x94, 0x9B, 0x31, 0x2F, 0x21, 0x08, 0x11, 0xF7, 0x16, 0xD9, 0xDF, 0x6C, 0xF9, 0xF9,
-    0x79, 0x70, 0xE3, 0x54, 0x64, 0x6C, 0xE0, 0x43, 0x1E, 0x5C, 0x5C, 0xA4, 0x22, 0x63, 0x67, 0x29,
-    0x0A, 0xEF, 0xD3, 0x17, 0xF1, 0xB2, 0x31, 0x20, 0x2C, 0xDA, 0xDB, 0x6B, 0x04, 0x37, 0xA2, 0x0C,
-    0x9B, 0x62, 0xCF, 0x30, 0x05, 0x63, 0x2E, 0xEE, 0xCE, 0x9D, 0xD9, 0xAE, 0x6C, 0xCD, 0xC7, 0x46,
-    0x22, 0x15, 0xA9, 0xC7, 0x8B, 0xE8, 0x9E, 0x03, 0xDD, 0xBE, 0x54, 0xB9, 0x52, 0x8E, 0x20, 0xF4,
-    0x01, 0x71, 0x17, 0x62, 0x81, 0x33, 0xAA, 0x55, 0x91, 0x11, 0xB9, 0xC3, 0x26, 0x71, 0xD1, 0xAD,
-    0xAC, 0xCC, 0x93, 0xD3, 0x59, 0x6A, 0xEF, 0x44, 0x24, 0x21, 0xED, 0x37, 0x7E, 0x01, 0x22, 0x00,
-    0x47, 0xF8, 0xDB, 0xE2, 0x89, 0x28, 0x8F, 0x33, 0x19, 0xF9, 0xA5, 0x04, 0x19, 0x24, 0xF2, 0x4E,
-    0x9C, 0x76, 0x02, 0xA3, 0x20, 0x28, 0x12, 0x72, 0x4B, 0x2D, 0x76, 0xBF, 0xF0, 0x9B, 0xFD, 0xCE,
-    0x44, 0xD2, 0x24, 0x97, 0x33, 0x8E, 0xF9, 0xE5, 0x56, 0xEE, 0x1B, 0x83, 0x05, 0xF0, 0xD7, 0xEE,
-    0x4D, 0xB9, 0x7B, 0x39, 0xD7, 0x71, 0x61, 0x0C, 0xB5, 0x4A, 0xE3, 0x07, 0xFD, 0xF6, 0xFE, 0x02,
-    0xCA, 0xCE, 0xC3, 0x0F, 0x2B, 0x2C, 0xEA, 0xE7, 0x2A, 0x9E, 0x5A, 0x99, 0xA0, 0x7D, 0xE8, 0x4B,
-    0x32, 0x95, 0x73, 0xD1, 0xBF, 0x4F, 0x3C, 0xD0, 0x97, 0xD4, 0x3D, 0xE1, 0xB4, 0x8B, 0x04, 0x8A,
-    0x0B, 0x61, 0x37, 0xDE, 0xE7, 0x34, 0xA8, 0x20, 0x83, 0x92, 0x4E, 0x3D, 0x3C, 0xA6, 0xF0, 0xB3,
-    0x03, 0x1A, 0x0A, 0x19, 0xB6, 0x32, 0x8C, 0x24, 0x76, 0x8B, 0xC7, 0xE4, 0xC7, 0x5F, 0x8F, 0x29,
-    0xFE, 0xC4, 0xBD, 0xC3, 0xCD, 0xF8, 0x4B, 0xB6, 0xEE, 0xFA, 0x0F, 0x81, 0xA9, 0x77, 0xC4, 0xAB,
-    0xF9, 0x88, 0x57, 0xAC, 0x59, 0x66, 0x23, 0xA6, 0xF5, 0x6E, 0x8F, 0xB0, 0x56, 0xA4, 0xCB, 0x0F,
-    0x94, 0x15, 0x35, 0x7B, 0xFE, 0x01, 0x27, 0xE3, 0x9F, 0x56, 0x09, 0xF8, 0x9D, 0x5B, 0x46, 0x76,
-    0xDD, 0x42, 0x2D, 0x56, 0x5A, 0xF8, 0x8C, 0xCF, 0x78, 0x1A, 0x91, 0xB0, 0x6B, 0x0F, 0x91, 0x0F,
-    0x49, 0x7D, 0xB8, 0xCD, 0x28, 0x4C, 0xBD, 0x8F, 0x0B, 0x32, 0x40, 0x57, 0x73, 0x97, 0xC2, 0x74,
-    0x10, 0xF1, 0x28, 0xF8, 0x17, 0x73, 0xAC, 0xEB, 0x54, 0xBA, 0x17, 0x39, 0x1E, 0xD9, 0x8D, 0x5A,
-    0x55, 0x12, 0xF9, 0xF2, 0xEB, 0x2D, 0x84, 0xC7, 0x5C, 0x83, 0xA3, 0xAA, 0xE8, 0x49, 0xF9, 0x09,
-    0x6F, 0x42, 0xF1, 0x4E, 0xC3, 0xA0, 0x17, 0x4F, 0xE9, 0xD2, 0xF3, 0xA5, 0x77, 0xEB, 0xCF, 0x45,
-    0xFA, 0x19, 0x83, 0x44, 0xB2, 0x98, 0x61, 0xAD, 0x6D, 0x19, 0xE7, 0x50, 0xAB, 0xD7, 0x72, 0xD5,
-    0x24, 0x85, 0x31, 0x04, 0x25, 0x42, 0xA1, 0xD3, 0xE2, 0x0E, 0xBC, 0x5A, 0x4D, 0x02, 0x77, 0xFC,
-    0x12, 0x77, 0x9C, 0x86, 0xFE, 0x31, 0xC5, 0x7F, 0xF6, 0x4E, 0x94, 0x85, 0x8C, 0x98, 0xB8, 0x13,
-    0x16, 0xB8, 0x13, 0x16, 0xB8, 0xB3, 0x55, 0x40, 0x72, 0x26, 0xC3, 0xE5, 0xCE, 0xBA, 0x75, 0x1C,
-    0x95, 0x2E, 0xDA, 0x38, 0x88, 0x9F, 0x30, 0x2A, 0x30, 0xF3, 0xC4, 0x9C, 0x41, 0x21, 0x66, 0x74,
-    0x08, 0xAE, 0xA7, 0x7D, 0xEC, 0x61, 0x28, 0xD0, 0x28, 0x31, 0xDB, 0xA2, 0x28, 0x20, 0x0B, 0x07,
-    0x41, 0x07, 0x8E, 0xC9, 0xAD, 0x1B, 0xDE, 0x19, 0x71, 0x6B, 0x46, 0x1E, 0x84, 0x35, 0xA8, 0xC0,
-    0xCF, 0xE9, 0xBA, 0x15, 0x08, 0x86, 0x0A, 0x16, 0xA4, 0xEC, 0xDE, 0x25, 0x09, 0x3E, 0xFD, 0xFC,
-    0xBF, 0x73, 0xC7, 0xD4, 0x33, 0xF0, 0x86, 0x18, 0xB4, 0x34, 0xE1, 0xC7, 0xE1, 0x99, 0x91, 0x81,
-    0xC0, 0x42, 0x73, 0xC5, 0xE0, 0xD7, 0x14, 0xBA, 0x87, 0x50, 0x0D, 0x95, 0x0A, 0xF2, 0x1B, 0x71,
-    0x1B, 0xF2, 0x3D, 0xC6, 0x1D, 0x30, 0x16, 0xD0, 0x19, 0x8C, 0x69, 0x9C, 0x26, 0x41, 0x06, 0xD8,
-    0xE1, 0x9D, 0x38, 0x8D, 0xBB, 0x3B, 0x3E, 0xF3, 0x08, 0xFE, 0x34, 0x34, 0xCA, 0x6D, 0x5E, 0xE2,
-    0xF4, 0x64, 0x8D, 0x28, 0x09, 0x3D, 0xCF, 0xCC, 0x62, 0xE5, 0x33, 0x72, 0xA2, 0x4B, 0x60, 0x4F,
-    0x50, 0x13, 0x7E, 0x67, 0x2B, 0x01, 0x54, 0x2C, 0x7F, 0x7B, 0x07, 0x8F, 0xC1, 0x6C, 0x37, 0xFE,
-    0x1E, 0x4B, 0x99, 0x85, 0x38, 0x73, 0x44, 0xC0, 0xA1, 0xCC, 0xB1, 0x83, 0x9F, 0x43, 0xF5, 0x13,
-    0xE5, 0xD3, 0xA3, 0x70, 0x47, 0x60, 0x2C, 0xC8, 0xFD, 0x4A, 0x99, 0x0C, 0xF3, 0xE1, 0x47, 0x39,
-    0x83, 0xAC, 0x6F, 0x3E, 0x30, 0x96, 0xC3, 0xE3, 0xBA, 0xD5, 0xDF, 0x20, 0x2F, 0x0B, 0x95, 0x7B,
-    0x3F, 0x46, 0x08, 0x98, 0x19, 0x4E, 0xD2, 0xAA, 0xFD, 0x02, 0x4B, 0xC7, 0x0C, 0x7A, 0xAD, 0x1C,
-    0xB3, 0x62, 0x0F, 0x69, 0x7D, 0x34, 0x19, 0x08, 0x92, 0x79, 0x91, 0x72, 0x64, 0x6E, 0x6C, 0x7A,
-    0xA3, 0xA6, 0xE3, 0xE3, 0xF1, 0x0D, 0x3E, 0xBE, 0x09, 0xE9, 0x60, 0x85, 0xA9, 0xBC, 0x9C, 0xC5,
-    0x58, 0x8F, 0xFA, 0xAE, 0xB8, 0x75, 0x0A, 0x44, 0xB0, 0xB1, 0xF7, 0x0F, 0xAB, 0x2D, 0x61, 0xC9,
-    0xEE, 0xBD, 0xDA, 0x2B, 0x87, 0x6E, 0x19, 0xBE, 0x51, 0xF9, 0x45, 0xE3, 0x97, 0x83, 0xA0, 0x8C,
-    0xC6, 0x45, 0x60, 0x52, 0x4F, 0xD3, 0x2C, 0xD6, 0x3D, 0xEA, 0x97, 0x5B, 0x29, 0x48, 0x8B, 0xB0,
-    0xE7, 0xF1, 0xE5, 0xAB, 0xEF, 0x38, 0x0C, 0x4C, 0x67, 0x49, 0x36, 0xD6, 0x0E, 0x99, 0x8B, 0x9C,
-    0x35, 0x91, 0x52, 0xCC, 0xB5, 0x83, 0x4B, 0x0E, 0xAA, 0x23, 0x50, 0x0D, 0xA2, 0x60, 0x8B, 0x85,
-    0xFA, 0xA5, 0x34, 0xBD, 0x73, 0xC6, 0x5C, 0x91, 0x0A, 0xF1, 0x34, 0x2B, 0x92, 0xC9, 0xA9, 0x32,
-    0x29, 0xEA, 0x44, 0xAF, 0xE0, 0x71, 0x2F, 0x87, 0x70, 0x23, 0x30, 0x79, 0xA4, 0x21, 0x23, 0x39,
-    0x38, 0x32, 0x36, 0x4A, 0xA6, 0xDF, 0x95, 0x89, 0x0F, 0xDF, 0x85, 0xAC, 0x5A, 0xAB, 0xC4, 0x65,
-    0xC4, 0x09, 0x6E, 0x15, 0xE0, 0x4A, 0xAE, 0x79, 0x65, 0x24, 0xDB, 0xB8, 0x64, 0x60, 0xCB, 0xFF,
-    0x0D, 0x94, 0xAF, 0x4E, 0x40, 0xBE, 0x82, 0xDC, 0xCD, 0x76, 0x36, 0x6A, 0x0F, 0x76, 0x43, 0xC6,
-    0x1E, 0x59, 0xBE, 0xAD, 0x7B, 0xC7, 0x34, 0x02, 0x6E, 0xE3, 0x94, 0x87, 0xB4, 0xF4, 0x8D, 0x33,
-    0xF6, 0x47, 0x62, 0xE8, 0xFE, 0x1C, 0x0C, 0x05, 0x19, 0x52, 0xC5, 0xF6, 0xD0, 0x69, 0xC0, 0xCE,
-    0xB6, 0x49, 0xC1, 0xCD, 0x5C, 0x99, 0x99, 0xC8, 0x69, 0xF0, 0x92, 0x98, 0x82, 0xAC, 0x74, 0x5A,
-    0xE0, 0x9A, 0xC5, 0x06, 0xD7, 0x54, 0xE3, 0x84, 0x43, 0x54, 0xB0, 0x50, 0x2F, 0x55, 0x1A, 0xD5,
-    0xA6, 0xA2, 0x54, 0x2D, 0x3D, 0x25, 0x8D, 0xF0, 0x55, 0x62, 0xA8, 0x1D, 0xBE, 0x58, 0xF7, 0x11,
-    0x33, 0x11, 0x27, 0xC3, 0xE3, 0x21, 0x59, 0x82, 0x53, 0xA7, 0xDF, 0x2B, 0x69, 0xA3, 0x94, 0x00,
-    0xE1, 0x4E, 0x40, 0xA6, 0xAE, 0x8A, 0x26, 0x67, 0x75, 0x12, 0xBC, 0x40, 0xF6, 0xC6, 0xE9, 0x9F,
-    0x41, 0x37, 0x84, 0x84, 0xC8, 0xF1, 0x9A, 0x26, 0x77, 0x82, 0xA4, 0x4C, 0xE1, 0x06, 0x7E, 0x4E,
-    0x61, 0x0B, 0xA7, 0xD2, 0xAC, 0xD7, 0x32, 0x1D, 0x60, 0xD3, 0xA0, 0xE9, 0x77, 0x7F, 0x68, 0xC6,
-    0xF6, 0x27, 0xF3, 0xC1, 0xFE, 0x5C, 0x86, 0x5E, 0x09, 0x3E, 0x1D, 0xB8, 0x11, 0x18, 0xF5, 0x8A,
-    0x7D, 0x01, 0xA7, 0xF0, 0x23, 0xB2, 0xCA, 0x7C, 0x00, 0x5E, 0xE9, 0x48, 0x60, 0xD6, 0x61, 0xA2,
-    0x59, 0xE1, 0x90, 0x40, 0xD3, 0x35, 0x2E, 0xC1, 0x0D, 0x7C, 0x3F, 0x45, 0xFC, 0xF1, 0xB3, 0xA3,
-    0x6B, 0xC9, 0x0E, 0x8C, 0x95, 0xC0, 0xF2, 0xA6, 0xF0, 0xEE, 0x08, 0xDE, 0x4F, 0x65, 0x93, 0x1A,
-    0xAA, 0x40, 0xBF, 0x9F, 0x52, 0x0F, 0x3E, 0x75, 0xC9, 0xBC, 0x47, 0x89, 0x32, 0xE0, 0x1D, 0xB9,
-    0xF8, 0xF3, 0x5C, 0x66, 0x0B, 0x64, 0xCF, 0x97, 0x4A, 0x7C, 0x15, 0x3D, 0x8B, 0xC7, 0x27, 0x01,
-    0x63, 0x61, 0x88, 0x44, 0x90, 0x45, 0xCD, 0x91, 0x29, 0xD7, 0x43, 0x60, 0xD5, 0x14, 0xB0, 0xC2,
-    0xC8, 0x1A, 0x4D, 0x14, 0xD5, 0xDE, 0xA3, 0x4F, 0x5F, 0x22, 0xD5, 0x01, 0xCC, 0x23, 0xFB, 0xEE,
-    0x9A, 0xAC, 0x2D, 0x39, 0xB7, 0x90, 0x80, 0xEB, 0xF0, 0x02, 0x22, 0xFC, 0x90, 0xAC, 0xD5, 0xB0,
-    0x28, 0x98, 0x41, 0x98, 0x61, 0xD3, 0x98, 0xF9, 0x37, 0x61, 0x40, 0x88, 0x77, 0x45, 0xF3, 0xA3,
-    0xB5, 0xB4, 0x71, 0x46, 0xA3, 0x04, 0xB1, 0x66, 0x0B, 0x32, 0xCE, 0xA0, 0xC5, 0x06, 0x76, 0x0E,
-    0xCD, 0x04, 0x39, 0x78, 0xD9, 0x91, 0xE4, 0xD3, 0x97, 0x61, 0xA1, 0x8C, 0x6C, 0x47, 0xEF, 0x2E,
-    0x4D, 0xC8, 0x29, 0x3C, 0x1A, 0xE3, 0x88, 0x59, 0x01, 0xE4, 0xD0, 0xD1, 0x2D, 0x0E, 0x7F, 0xF8,
-    0xD2, 0x79, 0x4D, 0x72, 0xD8, 0x4A, 0x44, 0x23, 0xA4, 0xB2, 0xCC, 0xE1, 0x88, 0x27, 0x5B, 0x06,
-    0x81, 0xE7, 0x1E, 0x12, 0xC9, 0xD4, 0xFB, 0x4F, 0xB8, 0x2F, 0x42, 0x76, 0xCC, 0xB4, 0xDE, 0xC0,
-    0xA0, 0xBD, 0x12, 0x26, 0x10, 0xE4, 0x84, 0x06, 0x6A, 0xC1, 0x9F, 0x74, 0x39, 0x54, 0xED, 0x52,
-    0x01, 0xF5, 0x0C, 0xB2, 0x4F, 0x6E, 0xCE, 0x41, 0xAF, 0xBB, 0x60, 0xB1, 0xD3, 0xC2, 0x10, 0xDD,
-    0xCA, 0x67, 0x89, 0x10, 0xDE, 0x79, 0xB1, 0x65, 0x29, 0x94, 0x89, 0xBB, 0xBF, 0xBB, 0xDC, 0x4D,
-    0xF3, 0x14, 0xF8, 0x25, 0x12, 0x90, 0x03, 0xD1, 0xE2, 0x61, 0x0A, 0xE6, 0x47, 0x7C, 0x97, 0x16,
-    0xC3, 0x1C, 0xBE, 0x06, 0x62, 0xFA, 0x9F, 0x93, 0xD0, 0xA7, 0xBB, 0x30, 0xCC, 0xBD, 0xB7, 0x81,
-    0x1D, 0x88, 0x5E, 0x72, 0x14, 0x3B, 0x43, 0xD6, 0x1A, 0x8D, 0xE2, 0x02, 0x16, 0x46, 0xB4, 0x0A,
-    0xF7, 0x4E, 0x17, 0x45, 0x88, 0x23, 0xC4, 0xA7, 0x29, 0xC6, 0xB0, 0x85, 0xF0, 0xF7, 0x26, 0x85,
-    0x5D, 0xCE, 0x32, 0x88, 0x73, 0xCC, 0x0C, 0x38, 0xC1, 0x27, 0xA4, 0xF6, 0xC5, 0x45, 0x43, 0x3F,
-    0xC6, 0x8B, 0x57, 0x34, 0xA1, 0xB1, 0xF6, 0xDC, 0xA0, 0x8C, 0x10, 0x06, 0xD2, 0xF0, 0x13, 0x67,
-    0x4A, 0xBF, 0xAB, 0x90, 0x1A, 0x3D, 0xC2, 0xAD, 0xA7, 0x14, 0x13, 0x2E, 0x5D, 0xDE, 0xEB, 0x5C,
-    0xFE, 0xF1, 0x8B, 0x09, 0x4C, 0xB2, 0x69, 0xC5, 0xD9, 0x7A, 0x0B, 0x5F, 0x6D, 0x23, 0x37, 0xB8,
-    0x55, 0x4C, 0xC8, 0x94, 0xB0, 0xE2, 0x1C, 0x97, 0x7F, 0xA5, 0x78, 0x01, 0x18, 0xC5, 0x7C, 0xD2,
-    0x69, 0xFB, 0x88, 0x74, 0x12, 0xD3, 0xB0, 0xA1, 0x61, 0x72, 0xB3, 0x97, 0xFF, 0x23, 0x6B, 0x15,
-    0xD3, 0xA8, 0x57, 0x11, 0x65, 0xE2, 0x74, 0xFB, 0x75, 0x15, 0xF1, 0x74, 0x5D, 0x42, 0x96, 0xE8,
-    0xD9, 0x1C, 0x41, 0x67, 0x90, 0xE2, 0x69, 0x40, 0x9C, 0x0A, 0xAB, 0x85, 0x59, 0x48, 0x10, 0xC5,
-    0x20, 0xC9, 0x17, 0x0D, 0xE5, 0xB1, 0x9F, 0x76, 0x6B, 0x12, 0x08, 0x38, 0x0B, 0xC5, 0x0C, 0x19,
-    0xF0, 0xE3, 0xAC, 0x80, 0xFB, 0xC4, 0x04, 0x80, 0x51, 0x0E, 0x57, 0x8B, 0xF1, 0x09, 0x42, 0x32,
-    0xBF, 0x04, 0x70, 0x34, 0x7C, 0xF1, 0x87, 0xFF, 0x63, 0xE9, 0x52, 0x6B, 0x55, 0x73, 0x41, 0xCC,
-    0xE2, 0x3A, 0xEE, 0xED, 0x46, 0x03, 0xBE, 0x06, 0xEF, 0xCA, 0xC9, 0x0E, 0x67, 0x3A, 0x16, 0xF7,
-    0x27, 0x17, 0x29, 0x77, 0x51, 0xB0, 0xA9, 0x68, 0x33, 0x23, 0x27, 0x30, 0x5C, 0xD5, 0x9E, 0x86,
-    0x57, 0x45, 0xA9, 0x0C, 0xB6, 0xF1, 0xC5, 0x8B, 0x5B, 0xCC, 0x24, 0x04, 0x70, 0xDE, 0xDD, 0xBD,
-    0x7F, 0xAE, 0x34, 0xA4, 0x28, 0xC8, 0xD7, 0xDB, 0x62, 0x61, 0x1B, 0x11, 0x0B, 0x88, 0xC5, 0xDB,
-    0x4E, 0xDD, 0xE5, 0x01, 0xDC, 0x76, 0x51, 0xC7, 0xCF, 0x10, 0x76, 0x5B, 0x61, 0x0C, 0xA0, 0x3E,
-    0x9D, 0xB9, 0x25, 0xD4, 0x81, 0x86, 0x10, 0x6D, 0x44, 0x2E, 0xF7, 0x24, 0xBE, 0x40, 0xA3, 0xC1,
-    0xCD, 0x2B, 0x79, 0xA7, 0x88, 0xA6, 0x93, 0x74, 0xD4, 0x29, 0xC5, 0x2B, 0xA1, 0xC6, 0x7A, 0xDC,
-    0xC8, 0xE6, 0x0E, 0xB0, 0xE2, 0x26, 0x00, 0xE1, 0x04, 0x11, 0x6A, 0x8E, 0x40, 0xB5, 0x80, 0x6A,
-    0xC6, 0x20, 0x25, 0x4E, 0x21, 0xE2, 0xDC, 0x03, 0x4E, 0x70, 0x2A, 0x90, 0x31, 0x79, 0x15, 0x35,
-    0xF2, 0x24, 0x96, 0xB0, 0x05, 0x9E, 0xE3, 0x6A, 0x4B, 0xA8, 0x13, 0xA3, 0x34, 0x31, 0xE5, 0x86,
-    0xD9, 0x65, 0xF0, 0xEA, 0xE8, 0xD7, 0xA2, 0x0C, 0x96, 0x01, 0xDB, 0x48, 0x8C, 0xC2, 0xAB, 0xA1,
-    0xCA, 0x87, 0xB7, 0x33, 0x09, 0x3E, 0xBC, 0xF8, 0x92, 0x66, 0x19, 0xD8, 0xBD, 0x2C, 0xF6, 0xF6,
-    0x5A, 0x5B, 0xEB, 0xA9, 0xBB, 0xF1, 0xF6, 0x52, 0x7C, 0x8A, 0x98, 0xC9, 0xFD, 0xBA, 0x74, 0x01,
-    0xFA, 0xB7, 0x16, 0x9D, 0xF0, 0x01, 0x88, 0x09, 0x44, 0xC0, 0xD0, 0xDF, 0x55, 0x5D, 0x09, 0xA3,
-    0xFE, 0x02, 0xDE, 0x5F, 0xFA, 0x30, 0xED, 0x58, 0xDF, 0xB8, 0x2C, 0x03, 0x00, 0xB0, 0x08, 0x35,
-    0xA3, 0xFF, 0xFE, 0xB3, 0xA5, 0x7B, 0x2B, 0x85, 0xF2, 0xD3, 0x01, 0x0A, 0xDC, 0x08, 0x06, 0x11,
-    0xE4, 0x01, 0x78, 0xC4, 0x6E, 0xB5, 0xA2, 0xF3, 0x6D, 0x89, 0x9F, 0x04, 0x97, 0xB7, 0x82, 0xDC,
-    0x33, 0xE0, 0x61, 0xB1, 0x32, 0xDB, 0xFD, 0x40, 0xE2, 0x3B, 0x95, 0x87, 0x18, 0x74, 0x2E, 0x3E,
-    0x98, 0x5C, 0x53, 0x30, 0xAF, 0xA1, 0x6A, 0x62, 0xAD, 0xB8, 0x55, 0x3A, 0xA9, 0xBB, 0xD8, 0xFA,
-    0xD2, 0xD0, 0x46, 0xB2, 0xE9, 0xAA, 0x00, 0x5A, 0xDE, 0x8E, 0x99, 0x04, 0xB5, 0x44, 0x0D, 0xCB,
-    0xD2, 0xDC, 0x7C, 0xEB, 0xD7, 0xED, 0xB1, 0x60, 0x19, 0xAB, 0x4E, 0x56, 0x0E, 0x2C, 0x25, 0xE2,
-    0xC2, 0x9E, 0xCA, 0x76, 0xA2, 0x38, 0x9F, 0xD6, 0x06, 0xD6, 0xC2, 0x4B, 0x32, 0x9C, 0x40, 0xFF,
-    0xAA, 0x0E, 0xA0, 0xF3, 0xBD, 0x5D, 0x42, 0xF0, 0x27, 0xF6, 0x76, 0x1F, 0x34, 0x71, 0x1B, 0x7B,
-    0x97, 0x13, 0x53, 0xEE, 0xED, 0xAD, 0x52, 0x9C, 0x44, 0x73, 0x3A, 0x2D, 0x5E, 0x18, 0xF2, 0x59,
-    0xFC, 0x9B, 0x50, 0x55, 0x58, 0x07, 0x6F, 0x35, 0xAF, 0x7A, 0x9F, 0xE5, 0x51, 0xAB, 0x0D, 0x84,
-    0x55, 0x6E, 0xF0, 0x90, 0x1A, 0x98, 0x19, 0x82, 0xC5, 0x81, 0xBC, 0x00, 0x02, 0x9D, 0xD9, 0x27,
-    0xAA, 0x61, 0x6A, 0x8B, 0x14, 0x26, 0xD6, 0x5E, 0x49, 0x54, 0x6C, 0x83, 0x09, 0xE1, 0x18, 0x73,
-    0xE4, 0x74, 0xF5, 0xD0, 0xD0, 0x06, 0x42, 0xEC, 0xEC, 0x32, 0x7A, 0x6A, 0x33, 0x08, 0xD1, 0xF6,
-    0xC7, 0x8D, 0xFF, 0x26, 0x11, 0x7D, 0xD6, 0x27, 0xA6, 0xAF, 0x24, 0x42, 0xB5, 0xE6, 0x82, 0x02,
-    0xC3, 0x83, 0x81, 0xED, 0x24, 0xB4, 0xBA, 0xD7, 0xEA, 0x73, 0x23, 0xB6, 0x8C, 0x3A, 0xF4, 0x19,
-    0x9C, 0xCC, 0xC9, 0x0C, 0x9B, 0x45, 0xF8, 0x43, 0x58, 0x00, 0xA2, 0x67, 0xC8, 0x0C, 0x55, 0xB7,
-    0x32, 0x4A, 0xA2, 0xCA, 0x6D, 0xE5, 0xF4, 0x52, 0xB7, 0x90, 0x21, 0xA0, 0x14, 0xAA, 0x4F, 0xBA,
-    0x17, 0xB8, 0x0E, 0x33, 0xBF, 0x00, 0x4D, 0xCD, 0xAB, 0xC3, 0x49, 0xD4, 0xA2, 0x9E, 0xDD, 0xC4,
-    0x7F, 0x4F, 0x03, 0xC8, 0xB9, 0x8B, 0x2C, 0xC9, 0x97, 0x90, 0x11, 0x7F, 0x0A, 0xC5, 0x44, 0xF5,
-    0x41, 0x35, 0x23, 0x0E, 0x75, 0x84, 0x84, 0x87, 0x08, 0x0B, 0xD5, 0x1B, 0x6D, 0xE5, 0x7B, 0xF0,
-    0xF3, 0x84, 0xC2, 0x73, 0xB5, 0x39, 0x78, 0xB2, 0x1A, 0xD7, 0x4E, 0x85, 0xD0, 0x5A, 0xFA, 0x05,
-    0x52, 0x50, 0x8E, 0x84, 0x96, 0xC6, 0x32, 0x7C, 0x72, 0x38, 0x19, 0x57, 0x6B, 0x8A, 0x9C, 0x99,
-    0xF3, 0x08, 0x40, 0x5B, 0x77, 0xA8, 0x33, 0xBF, 0xE8, 0xC4, 0x62, 0xD7, 0x4C, 0x96, 0xD7, 0xAC,
-    0x93, 0x98, 0xDD, 0x7E, 0xA2, 0x1A, 0xB5, 0x62, 0xD4, 0x48, 0xC8, 0x98, 0x37, 0xED, 0xF7, 0x57,
-    0x09, 0x5B, 0x72, 0x2D, 0x51, 0xBE, 0x06, 0x3E, 0xF8, 0x00, 0x8C, 0x0F, 0xEB, 0x81, 0x33, 0xAD,
-    0xED, 0x2C, 0x46, 0x52, 0xDB, 0x70, 0x0B, 0x12, 0xEC, 0x69, 0xC8, 0x77, 0xAD, 0xE2, 0x97, 0xC5,
-    0x8D, 0x57, 0x69, 0x1F, 0x2F, 0x2A, 0x02, 0x16, 0xD4, 0xA7, 0xE5, 0xE8, 0xA1, 0x74, 0x5B, 0x6D,
-    0xCC, 0x7D, 0x93, 0x1A, 0x16, 0x90, 0x03, 0x10, 0xE7, 0xB3, 0xF6, 0x9F, 0x80, 0x26, 0xAD, 0x88,
-    0x1B, 0xED, 0x34, 0x86, 0x99, 0x06, 0xBC, 0x98, 0x15, 0x66, 0xE9, 0x7D, 0x94, 0x0F, 0x60, 0x22,
-    0x2C, 0xA3, 0xA8, 0x23, 0x66, 0x59, 0x9B, 0x80, 0xE3, 0x2E, 0xA9, 0x65, 0x13, 0xDA, 0x0C, 0x09,
-    0x81, 0x8A, 0x02, 0xEB, 0x7A, 0x8F, 0xF4, 0x69, 0x04, 0x4E, 0x20, 0x0E, 0x73, 0x48, 0xFC, 0x4C,
-    0x75, 0x38, 0x81, 0xD0, 0x56, 0x9C, 0x59, 0xDD, 0xB5, 0x62, 0x9C, 0xB5, 0xA2, 0xA2, 0x87, 0x1C,
-    0x6B, 0x35, 0x48, 0x9F, 0x92, 0x33, 0xB9, 0xBF, 0x06, 0x39, 0x08, 0xE1, 0xD7, 0x5F, 0xC6, 0x27,
-    0xFF, 0x3C, 0x3D, 0x99, 0x81, 0x72, 0xCC, 0x57, 0x1E, 0x5F, 0x23, 0x80, 0x6F, 0xC6, 0x58, 0x35,
-    0x82, 0x55, 0x44, 0xDA, 0x8C, 0x80, 0xD8, 0xD3, 0xD3, 0xAB, 0x07, 0x7E, 0x58, 0x59, 0x0E, 0x74,
-    0xD5, 0x30, 0xEF, 0x16, 0xAD, 0xBB, 0xE4, 0x1D, 0x77, 0xF4, 0x68, 0x4F, 0x64, 0x2D, 0xF8, 0xB2,
-    0x57, 0xAB, 0x59, 0x58, 0x29, 0xAE, 0xED, 0x8D, 0x57, 0x06, 0x16, 0xF2, 0xB2, 0x0E, 0x76, 0xFE,
-    0x75, 0x55, 0x4B, 0x9A, 0x16, 0xB0, 0x15, 0xFE, 0x86, 0x9A, 0x01, 0x12, 0xD8, 0x21, 0x4F, 0x41,
-    0xC9, 0x65, 0x08, 0x01, 0x5A, 0x96, 0xA2, 0x5E, 0xA9, 0x82, 0xFC, 0x39, 0x79, 0x9D, 0x6A, 0x69,
-    0xA6, 0x99, 0x39, 0xBC, 0x42, 0xC1, 0x6C, 0xAB, 0x39, 0xD4, 0xFB, 0x2A, 0x0C, 0x1A, 0x45, 0xC2,
-    0x94, 0x28, 0x8D, 0xCB, 0x52, 0xA8, 0xF0, 0xB4, 0x3C, 0x47, 0x52, 0x0B, 0x0C, 0xF0, 0x10, 0x04,
-    0x9E, 0x7B, 0xB6, 0x25, 0x9C, 0xF6, 0x11, 0x48, 0x41, 0x99, 0x15, 0xA1, 0xCA, 0xD0, 0xA2, 0x07,
-    0x65, 0xAF, 0x7B, 0xE2, 0x84, 0xFA, 0xF0, 0xD1, 0x7D, 0x2B, 0xDF, 0xAE, 0x83, 0xD5, 0x28, 0x93,
-    0x4E, 0x35, 0xCB, 0xCE, 0x26, 0x73, 0xEF, 0xD6, 0xB3, 0x45, 0x92, 0x0F, 0xFC, 0x2A, 0xC8, 0x27,
-    0x4E, 0x1D, 0xBC, 0x31, 0x67, 0x7A, 0x06, 0x9F, 0xCE, 0xE7, 0xA8, 0xBB, 0x91, 0x2B, 0xCB, 0x7D,
-    0x19, 0x78, 0xAD, 0x5F, 0x84, 0x8B, 0x09, 0xDB, 0x99, 0xC8, 0x9B, 0x27, 0x2C, 0xB8, 0xEC, 0xBA,
-    0x62, 0xD7, 0x04, 0x4E, 0xBE, 0x8C, 0x88, 0xB3, 0x2C, 0x7E, 0x7B, 0x81, 0xD4, 0xDD, 0x24, 0xD7,
-    0xBC, 0xFF, 0x40, 0xF0, 0x38, 0x03, 0x26, 0x01, 0xBA, 0x60, 0x60, 0x21, 0x3D, 0x08, 0x62, 0xBA,
-    0x5D, 0x89, 0x7F, 0x1D, 0xC8, 0x35, 0xC8, 0x5F, 0x69, 0xC2, 0x9B, 0x6F, 0x15, 0x51, 0x1B, 0xC9,
-    0x32, 0x1F, 0xA5, 0xB6, 0x11, 0x48, 0xEC, 0xC3, 0xFC, 0xEF, 0x11, 0x33, 0x1E, 0x4A, 0x07, 0xC2,
-    0x40, 0xA1, 0x08, 0x69, 0xA9, 0xD6, 0x1E, 0x20, 0x6C, 0x1F, 0xD2, 0xB5, 0x1A, 0xE5, 0x74, 0xF5,
-    0xE5, 0x39, 0x7C, 0x79, 0x86, 0x7D, 0x32, 0xB6, 0x4E, 0xDE, 0x45, 0xFA, 0xFE, 0xC0, 0x76, 0x4E,
-    0xC8, 0x41, 0x58, 0x05, 0x0B, 0x7F, 0x91, 0x9E, 0xB0, 0xA2, 0x0B, 0xE7, 0xCE, 0x95, 0x02, 0x8A,
-    0x0F, 0xE9, 0x54, 0x61, 0x6A, 0xDB, 0x35, 0x25, 0x5C, 0x0E, 0x02, 0xEE, 0xBE, 0x8D, 0x52, 0x57,
-    0x0B, 0x6E, 0x7C, 0x7B, 0xDA, 0xBF, 0x95, 0xCE, 0x4A, 0x7F, 0x15, 0xD0, 0x18, 0xCE, 0x19, 0x85,
-    0xD5, 0xFC, 0x83, 0x9E, 0xC4, 0xB6, 0xF3, 0x95, 0x03, 0x5F, 0x2E, 0xE9, 0x5E, 0x7D, 0x79, 0x0C,
-    0x5F, 0x06, 0xE9, 0x36, 0x90, 0x2D, 0x4A, 0xF2, 0x8A, 0xB5, 0x6F, 0x57, 0x91, 0x77, 0x81, 0x82,
-    0x30, 0x77, 0xDD, 0x38, 0x55, 0xDF, 0x5F, 0x97, 0x70, 0x28, 0xB0, 0x25, 0x01, 0x78, 0x88, 0x6A,
-    0x3D, 0xBE, 0x42, 0xBA, 0x9B, 0x6A, 0x57, 0xC8, 0xA3, 0x13, 0xC4, 0xCD, 0x80, 0x51, 0x91, 0x89,
-    0xF3, 0x18, 0xF9, 0x49, 0x2D, 0xE8, 0x6D, 0x3A, 0xA6, 0x14, 0xAE, 0x24, 0xBD, 0xF7, 0x6E, 0xF7,
-    0xAD, 0xAB, 0x49, 0x27, 0x7D, 0x65, 0x0B, 0xCF, 0x55, 0x6E, 0xED, 0x8C, 0xB5, 0x7D, 0xD1, 0xF1,
-    0x75, 0x94, 0x96, 0xE4, 0xA4, 0x55, 0x52, 0x8F, 0xD8, 0x93, 0x8C, 0x43, 0x09, 0xAF, 0xA7, 0x07,
-    0xBB, 0xE2, 0x19, 0x89, 0xA2, 0x9B, 0xDA, 0x68, 0x8C, 0xCF, 0x7E, 0xD1, 0x05, 0x5F, 0xCA, 0x34,
-    0xFC, 0x99, 0x80, 0x15, 0xA6, 0xCD, 0xB5, 0xEE, 0x84, 0x28, 0x30, 0xD9, 0xBA, 0xD3, 0xD3, 0x92,
-    0x77, 0x3A, 0xE8, 0x68, 0x3E, 0x0D, 0x9A, 0x43, 0x24, 0x2C, 0x38, 0x5B, 0x02, 0x0B, 0xFC, 0x6A,
-    0x34, 0x9F, 0xE0, 0x68, 0x81, 0xFD, 0x44, 0xDB, 0xE7, 0x6E, 0x48, 0xAB, 0xA3, 0x80, 0x19, 0xEB,
-    0x78, 0xC5, 0x09, 0x3F, 0x9F, 0xC3, 0xA3, 0xC3, 0xBC, 0x01, 0xA5, 0x0A, 0xD9, 0x49, 0x35, 0x9B,
-    0xE3, 0xA7, 0x65, 0xA7, 0xA6, 0x4B, 0xAE, 0xD1, 0xF9, 0x05, 0xD6, 0x82, 0x48, 0x1C, 0xBD, 0xDC,
-    0x97, 0x01, 0xF8, 0x97, 0x11, 0x01, 0xFF, 0x1E, 0xDD, 0xFA, 0xD3, 0xD6, 0xE2, 0xA4, 0x9E, 0x49,
-    0x41, 0x21, 0x51, 0x02, 0x61, 0x0E, 0x08, 0xF4, 0x35, 0xD5, 0xDD, 0x2D, 0x10, 0x46, 0xA2, 0x02,
-    0x6C, 0x8F, 0x2B, 0xEF, 0x37, 0x3D, 0x90, 0xB0, 0x8F, 0x5C, 0x86, 0x14, 0xE3, 0x66, 0x45, 0x9C,
-    0x85, 0x8E, 0x67, 0xF5, 0x3A, 0x56, 0x27, 0xD5, 0xE8, 0x25, 0xB6, 0xBB, 0x7A, 0xEA, 0xBE, 0xDE,
-    0x59, 0x01, 0x50, 0xCB, 0xFE, 0x4D, 0x30, 0xD7, 0x09, 0x05, 0x4C, 0x27, 0x2E, 0x99, 0xF2, 0x43,
-    0xB5, 0x2D, 0xEF, 0x16, 0xB5, 0xEA, 0xFC, 0x8E, 0x58, 0x55, 0x26, 0x53, 0xDE, 0x1E, 0x86, 0x39,
-    0x6F, 0x9F, 0xAF, 0x79, 0x3B, 0x1F, 0xF2, 0x36, 0x02, 0x51, 0xAD, 0x65, 0x20, 0x6F, 0x4B, 0xC2,
-    0xDB, 0xA9, 0xFF, 0x59, 0xC6, 0x36, 0x94, 0xE1, 0x6D, 0x89, 0x34, 0xF3, 0x22, 0x3A, 0x3A, 0x90,
-    0xE3, 0x0C, 0x15, 0x44, 0x6B, 0x13, 0x8B, 0xAC, 0x82, 0x88, 0x57, 0x58, 0xF9, 0xC4, 0x5D, 0xA8,
-    0xA8, 0xE5, 0xC0, 0x10, 0xA5, 0x8C, 0xCA, 0x59, 0x35, 0xAB, 0xBD, 0xFF, 0xFA, 0x7D, 0xED, 0xDD,
-    0x7C, 0xA3, 0xF6, 0x7E, 0xEB, 0x54, 0x7E, 0xEB, 0x56, 0x01, 0xD0, 0x43, 0x58, 0xA2, 0xB2, 0xCF,
-    0xFD, 0x3C, 0xCA, 0x02, 0x50, 0x16, 0x66, 0xC0, 0xD2, 0x3F, 0x1B, 0x4A, 0xB4, 0x3F, 0x90, 0xA8,
-    0x19, 0x11, 0xBA, 0xAC, 0x7E, 0xE2, 0x9A, 0x63, 0x1C, 0x94, 0xF3, 0x2E, 0xA2, 0x12, 0xAB, 0x4A,
-    0x6D, 0x5D, 0x71, 0xA0, 0x63, 0xD4, 0x34, 0xEF, 0xB1, 0x9F, 0x2D, 0xA3, 0x96, 0x85, 0x4B, 0x8C,
-    0x72, 0x04, 0x8C, 0xBC, 0x55, 0xF1, 0x76, 0x31, 0xE5, 0xED, 0x2A, 0xCC, 0x78, 0xDB, 0xAD, 0x78,
-    0x5B, 0x76, 0x78, 0x3B, 0x0B, 0xDF, 0xE3, 0x6D, 0xE7, 0x6E, 0xC9, 0x2E, 0x19, 0xA7, 0x80, 0x23,
-    0xF1, 0xE7, 0xEA, 0x01, 0x88, 0x86, 0x5B, 0x0D, 0x77, 0x19, 0x9B, 0xAE, 0x51, 0xBF, 0x56, 0xF3,
-    0x49, 0x2B, 0xAB, 0x44, 0x60, 0x65, 0x61, 0x33, 0x81, 0xBD, 0xAE, 0xE0, 0xEA, 0xD7, 0xE6, 0xFC,
-    0x48, 0x9F, 0x78, 0xBB, 0xBF, 0x9B, 0xEB, 0xC2, 0x3D, 0xCA, 0x4C, 0xC0, 0xD2, 0x8C, 0x9F, 0xA6,
-    0x7A, 0x0D, 0x6F, 0xE9, 0x6B, 0xA6, 0xC7, 0x7E, 0x7F, 0x89, 0xF6, 0x72, 0x5C, 0x1E, 0xC3, 0x06,
-    0x21, 0x6C, 0x26, 0xF8, 0x05, 0x5E, 0x63, 0xEF, 0x8F, 0xF2, 0xBC, 0xFC, 0xC0, 0xEC, 0x45, 0xE5,
-    0xAF, 0x5D, 0x14, 0xD1, 0x59, 0x90, 0x95, 0x4C, 0xDE, 0xB7, 0x15, 0x34, 0x6C, 0x0A, 0x67, 0xB5,
-    0x55, 0x1D, 0xB7, 0xF4, 0xEF, 0xB3, 0x31, 0x1C, 0x3C, 0xFC, 0x15, 0xEE, 0x72, 0x2B, 0x50, 0xCC,
-    0x30, 0x33, 0xD6, 0x12, 0x3B, 0xD3, 0x51, 0xB2, 0x4E, 0x0D, 0x6D, 0x7D, 0xAD, 0x05, 0xE6, 0xE0,
-    0x47, 0xC2, 0x4D, 0xC9, 0xF9, 0x82, 0x4A, 0x5F, 0x1C, 0x10, 0xF3, 0x03, 0x35, 0xD4, 0xA1, 0x1A,
-    0x6A, 0xF0, 0x85, 0x86, 0xCA, 0xFE, 0x9F, 0x1A, 0xAA, 0x35, 0x1A, 0x5B, 0x41, 0xE8, 0x80, 0xAF,
-    0x54, 0x6C, 0x32, 0x56, 0x7B, 0x0D, 0xDB, 0xD5, 0x49, 0x02, 0x85, 0x0E, 0xE3, 0xB7, 0x4D, 0x60,
-    0xD2, 0x66, 0x3A, 0xA5, 0x90, 0xC3, 0x6B, 0x7E, 0x3E, 0xCE, 0x63, 0xA8, 0xA2, 0xA1, 0x8C, 0x13,
-    0x89, 0x80, 0xBB, 0x27, 0x04, 0xBC, 0x10, 0x31, 0x2A, 0xE0, 0x91, 0x57, 0xB0, 0x5B, 0x47, 0x4D,
-    0x8E, 0xBA, 0xB2, 0x2A, 0x25, 0x9A, 0x0D, 0xD8, 0xCE, 0xC1, 0xCA, 0x67, 0xD5, 0x24, 0xB5, 0xE8,
-    0x63, 0x3B, 0x58, 0x56, 0xE5, 0x9F, 0x35, 0xE4, 0x0B, 0x84, 0x6F, 0x0B, 0x9D, 0x46, 0x01, 0xA5,
-    0xA7, 0x61, 0xE5, 0x72, 0x90, 0x04, 0x60, 0xE3, 0xB4, 0x5A, 0x66, 0x52, 0x49, 0x9C, 0x50, 0x4A,
-    0x4B, 0xC0, 0xDA, 0x4E, 0x97, 0x17, 0xC6, 0xD6, 0xA6, 0x25, 0x6E, 0xE3, 0x70, 0xB9, 0x62, 0xDD,
-    0x59, 0x8C, 0x99, 0x95, 0x93, 0x94, 0xC8, 0xBD, 0xF4, 0x5B, 0xD1, 0x79, 0xA3, 0xCC, 0x96, 0x43,
-    0x13, 0x9E, 0xD6, 0xE0, 0xC9, 0x91, 0x83, 0x34, 0xB0, 0xB0, 0x4B, 0x4C, 0xE1, 0xD5, 0x51, 0x8E,
-    0x04, 0xF4, 0x0C, 0xF0, 0x23, 0xF3, 0xF3, 0xB6, 0xF8, 0x1F, 0xC0, 0x66, 0x9F, 0x47, 0x2A, 0x4E,
-    0x14, 0x3D, 0xC6, 0xE7, 0x6B, 0xA7, 0xF1, 0xAB, 0x28, 0x0F, 0x61, 0xB8, 0x6C, 0x38, 0xAF, 0x1D,
-    0xD4, 0x50, 0x48, 0xDE, 0x20, 0x29, 0x6B, 0x4F, 0xC5, 0x9E, 0x1B, 0x58, 0x79, 0xFB, 0x43, 0xE5,
-    0x91, 0x3F, 0x3F, 0x91, 0x5D, 0xA7, 0x06, 0x7E, 0x40, 0xDE, 0xE5, 0xF1, 0x8C, 0xB5, 0x32, 0x19,
-    0xB5, 0x22, 0x47, 0x31, 0xC9, 0x33, 0xAD, 0x87, 0x54, 0x1A, 0xA5, 0x3E, 0x18, 0x0B, 0x2F, 0x15,
-    0xB2, 0x1D, 0xC3, 0x86, 0xA1, 0xB4, 0xEB, 0x15, 0x5D, 0xDB, 0xAD, 0xE3, 0x34, 0xCA, 0xC6, 0xA8,
-    0x3D, 0x94, 0xE0, 0x7A, 0x7D, 0x20, 0x25, 0xE7, 0x1C, 0x90, 0x3C, 0x66, 0xE5, 0x30, 0x7B, 0x0B,
-    0x54, 0x99, 0xE7, 0x40, 0xDF, 0x82, 0x5E, 0x75, 0x4A, 0x8A, 0x75, 0x8E, 0x01, 0x12, 0x33, 0x0E,
-    0x2E, 0x5B, 0x71, 0xB1, 0x61, 0xAE, 0x2C, 0xB3, 0x64, 0x1B, 0xDB, 0xC9, 0xED, 0x94, 0x0C, 0x29,
-    0xCF, 0xC4, 0x51, 0x09, 0xB3, 0x7D, 0xF8, 0x6E, 0x2D, 0x76, 0xFE, 0xE0, 0x34, 0xBC, 0x33, 0x25,
-    0x70, 0x4F, 0xB8, 0x53, 0x9C, 0x2A, 0xD7, 0xF8, 0x1C, 0xE5, 0x00, 0xA5, 0xE3, 0x9C, 0xA2, 0xCC,
-    0x3A, 0xB6, 0xD7, 0x7A, 0xC7, 0xD5, 0x19, 0x88, 0x6A, 0x47, 0x7C, 0xAC, 0x11, 0x82, 0x95, 0x18,
-    0xCE, 0x73, 0x7A, 0x43, 0xD6, 0xB9, 0xA7, 0x11, 0x52, 0xD3, 0x28, 0xD4, 0x0A, 0xB2, 0x4F, 0xDD,
-    0x42, 0xD5, 0xC5, 0x44, 0xFF, 0xB2, 0x75, 0x1C, 0x66, 0xD0, 0x75, 0x3A, 0x45, 0x15, 0x41, 0x01,
-    0x24, 0xDA, 0x88, 0x4D, 0xD7, 0xD3, 0x16, 0x5B, 0x89, 0x14, 0x3A, 0xAF, 0x26, 0x8D, 0xE8, 0xFA,
-    0x03, 0xD4, 0x0B, 0x00, 0x42, 0x9C, 0x9F, 0x00, 0xE7, 0x65, 0x76, 0xE2, 0x0E, 0xFD, 0x6A, 0x8B,
-    0xDE, 0xA6, 0x02, 0x2D, 0xA3, 0x2F, 0x10, 0x2D, 0x71, 0xDE, 0x91, 0xEA, 0x1C, 0xC8, 0x82, 0x26,
-    0xCF, 0xB6, 0xEF, 0xC0, 0x9C, 0xB6, 0x2A, 0xD8, 0xCE, 0x96, 0x6C, 0xCC, 0x25, 0x02, 0x04, 0x10,
-    0xCE, 0x19, 0xC1, 0x72, 0x94, 0x7D, 0xAF, 0x72, 0xEC, 0x8E, 0xDA, 0x10, 0xC3, 0xAB, 0x47, 0xD2,
-    0x03, 0x36, 0x7C, 0xB2, 0x01, 0x45, 0xCF, 0xDF, 0x2A, 0x93, 0x67, 0x4C, 0x99, 0x80, 0xBD, 0xC6,
-    0xFB, 0xA8, 0x66, 0x2B, 0x97, 0x1C, 0x46, 0xEF, 0x41, 0xC5, 0x41, 0x09, 0x26, 0x6F, 0x32, 0x62,
-    0x43, 0xA3, 0x2D, 0xF7, 0x83, 0xA6, 0xB5, 0x69, 0x38, 0xCE, 0xDD, 0x4B, 0x55, 0x64, 0x38, 0x22,
-    0xFA, 0x18, 0x64, 0xCD, 0x6A, 0xD6, 0x57, 0x17, 0x3A, 0xD4, 0xA1, 0x66, 0xAE, 0xA7, 0x88, 0x2A,
-    0xD1, 0xC8, 0xA5, 0xE5, 0xC7, 0xAA, 0x1C, 0xE0, 0x28, 0x79, 0x8C, 0x22, 0xDA, 0x33, 0x9F, 0xB1,
-    0x2C, 0xC7, 0x8A, 0xA8, 0xFE, 0x2B, 0x5B, 0x09, 0x0F, 0x85, 0x76, 0x85, 0xCD, 0x00, 0x5C, 0xD9,
-    0xD3, 0x41, 0xFD, 0x33, 0xDF, 0x2A, 0x6D, 0xCD, 0x1D, 0xB1, 0xA9, 0x38, 0x89, 0x52, 0xDB, 0x9B,
-    0xD6, 0x69, 0x3D, 0x27, 0xBE, 0x4E, 0xED, 0x30, 0xE9, 0xB8, 0x2D, 0x5B, 0x0A, 0xF3, 0xD8, 0x94,
-    0xCE, 0x62, 0x05, 0x82, 0x7C, 0x6D, 0x49, 0xD8, 0x8E, 0xA8, 0xB3, 0x76, 0x3E, 0x25, 0x68, 0xA2,
-    0xB7, 0x4D, 0x54, 0x05, 0xBF, 0x68, 0xBC, 0x9B, 0xA9, 0xDC, 0xCB, 0x60, 0x6F, 0x2C, 0xCA, 0x82,
-    0xF2, 0x50, 0x07, 0x23, 0xEB, 0x3B, 0x16, 0x3A, 0xFE, 0x77, 0xA8, 0xC5, 0xD0, 0x5C, 0x61, 0xFC,
-    0x0E, 0x08, 0xA6, 0xB5, 0xEF, 0xC0, 0xCE, 0x93, 0xD0, 0x1C, 0xF0, 0x6A, 0xC4, 0x1C, 0x31, 0xA1,
-    0xE9, 0xDE, 0x9E, 0xB1, 0xE1, 0x0A, 0x4F, 0xDB, 0x99, 0x31, 0xCA, 0x6D, 0x8B, 0x1D, 0x33, 0x24,
-    0xD4, 0x5C, 0xC3, 0x49, 0x62, 0xE1, 0x13, 0xE3, 0x07, 0x55, 0x60, 0x8A, 0x00, 0xD0, 0x2F, 0xF3,
-    0x9B, 0xB5, 0xD3, 0x4C, 0xE3, 0x83, 0xC5, 0x78, 0xDF, 0xAA, 0x3E, 0xB2, 0x4C, 0x6C, 0x3B, 0x01,
-    0xC8, 0x77, 0x3F, 0x5E, 0xC8, 0xE0, 0x2A, 0x72, 0x8D, 0x90, 0x7E, 0x1E, 0x9D, 0xD8, 0xB7, 0xF9,
-    0xA9, 0x51, 0x4C, 0xEA, 0x76, 0x47, 0x20, 0x4A, 0x8B, 0xA5, 0x6C, 0xEF, 0x74, 0xAD, 0x15, 0x57,
-    0x69, 0xE2, 0xD6, 0x35, 0x9D, 0xDC, 0x03, 0xB9, 0x19, 0x44, 0x1A, 0x3D, 0x57, 0x74, 0xE7, 0x1F,
-    0x54, 0x6B, 0x83, 0x87, 0xAD, 0xB5, 0xE3, 0x4E, 0x1A, 0xA4, 0x13, 0xB9, 0x06, 0xB7, 0xB8, 0x91,
-    0x33, 0x03, 0x32, 0xF5, 0x6E, 0xF4, 0x96, 0xEB, 0x2E, 0xFC, 0x72, 0xF6, 0xBF, 0x46, 0xCE, 0x26,
-    0x25, 0x15, 0x37, 0x2C, 0x09, 0x0F, 0x28, 0x2D, 0x56, 0xEF, 0x07, 0x3B, 0x8C, 0xE5, 0xB2, 0xC3,
-    0x68, 0x19, 0x67, 0x4E, 0x9B, 0xA5, 0x9C, 0x12, 0x72, 0xAB, 0x5E, 0x92, 0x8F, 0x33, 0xC8, 0x96,
-    0xEE, 0x62, 0x06, 0xF0, 0xC3, 0xEC, 0xB4, 0x09, 0x27, 0xAC, 0xA2, 0xCC, 0x55, 0x0D, 0xD0, 0x76,
-    0x19, 0x35, 0xD8, 0xEB, 0x99, 0x95, 0x56, 0x22, 0x71, 0xBE, 0x2B, 0x89, 0x9F, 0xC9, 0x24, 0x06,
-    0x47, 0x28, 0xBA, 0xDE, 0x6C, 0x9C, 0x16, 0x21, 0xB5, 0x70, 0xC9, 0xEC, 0x89, 0x2F, 0x79, 0x2C,
-    0xEA, 0x0D, 0x66, 0x69, 0xDE, 0x43, 0x58, 0xE6, 0xD4, 0x74, 0x96, 0xEB, 0x60, 0x25, 0xA1, 0x91,
-    0xBC, 0xE6, 0x54, 0x71, 0xD6, 0xF8, 0x70, 0xD8, 0x71, 0x7F, 0x82, 0xE8, 0x88, 0x3D, 0x54, 0xC6,
-    0x83, 0x38, 0x2D, 0x8F, 0x9B, 0x5C, 0x43, 0x4E, 0x2E, 0xBE, 0x29, 0xF2, 0xBF, 0xC4, 0x01, 0xA8,
-    0xAF, 0x48, 0xFE, 0x0B, 0xB4, 0x9C, 0x2C, 0xB8, 0x6B, 0xB2, 0xA9, 0x0C, 0x3C, 0x25, 0x90, 0xC3,
-    0x9F, 0xEF, 0xB0, 0x55, 0xC5, 0xEA, 0xC8, 0xD3, 0xAE, 0x01, 0x2C, 0x44, 0x89, 0xC5, 0x2B, 0x33,
-    0x17, 0x45, 0xED, 0xD3, 0x4A, 0x60, 0xF0, 0x2E, 0x12, 0x4C, 0x50, 0x22, 0x8D, 0x1A, 0xF6, 0x84,
-    0x4B, 0x0D, 0xDE, 0x4C, 0x9E, 0x3C, 0x07, 0xC7, 0xBA, 0x6B, 0xD3, 0xAA, 0x7A, 0xBA, 0xCA, 0x66,
-    0xF6, 0x60, 0x53, 0x39, 0xF2, 0x6D, 0x3B, 0xBF, 0x86, 0xD1, 0x28, 0x89, 0x51, 0x69, 0x03, 0x01,
-    0x28, 0xDC, 0xF7, 0x4A, 0xA4, 0xF5, 0x48, 0x0F, 0x36, 0x39, 0xBB, 0x4A, 0xFC, 0x44, 0x74, 0xC2,
-    0x43, 0x00, 0xF4, 0x28, 0x16, 0x79, 0x54, 0xCE, 0xC0, 0xED, 0x6C, 0x56, 0xE0, 0x70, 0x9B, 0x6B,
-    0x2C, 0x8F, 0x3A, 0xBD, 0xA0, 0x52, 0x97, 0xD9, 0x95, 0x06, 0x2A, 0xE6, 0xEC, 0x8C, 0xF3, 0x40,
-    0xFE, 0xCD, 0xE8, 0x83, 0x7A, 0x6E, 0x88, 0xAC, 0xF0, 0x04, 0x18, 0xBB, 0xCE, 0xCA, 0x53, 0x9C,
-    0x9F, 0x82, 0xE6, 0x5E, 0x87, 0x84, 0x26, 0xFA, 0x37, 0xCC, 0xF6, 0xA1, 0xA4, 0xB1, 0x99, 0xDB,
-    0xF3, 0x4D, 0x27, 0xBE, 0xF4, 0xF1, 0xA6, 0xA1, 0x4F, 0x14, 0x49, 0x8F, 0x66, 0x0E, 0x8D, 0x4B,
-    0xE5, 0x4D, 0x1B, 0x2F, 0x15, 0x0D, 0x1F, 0xDC, 0x05, 0xE5, 0x90, 0xA8, 0xC5, 0x59, 0x1E, 0x6F,
-    0xD2, 0xC9, 0x84, 0x69, 0x39, 0x11, 0x79, 0x2F, 0x8F, 0x65, 0xF4, 0xBA, 0x57, 0xF9, 0x6F, 0xA7,
-    0x43, 0x79, 0xED, 0x55, 0xBF, 0xD8, 0xB0, 0x9D, 0x96, 0x70, 0x59, 0x64, 0x1F, 0x68, 0x34, 0xDE,
-    0xDF, 0x18, 0xE8, 0x9E, 0x73, 0x66, 0x73, 0x9E, 0x74, 0xE9, 0x12, 0xB8, 0xB3, 0xDB, 0xD5, 0x99,
-    0x4E, 0xBF, 0x04, 0x63, 0x8F, 0x8E, 0xAD, 0xFF, 0xBA, 0x3F, 0xC5, 0x74, 0xB6, 0x3B, 0x61, 0xB6,
-    0x61, 0xE6, 0x09, 0xD8, 0x38, 0x5C, 0x79, 0x8B, 0x9E, 0x48, 0xC2, 0xFA, 0xC7, 0xC3, 0xEC, 0x6A,
-    0x78, 0xA3, 0xE2, 0xD0, 0xC4, 0xEA, 0x27, 0x63, 0x2B, 0xDB, 0x3A, 0x12, 0x1E, 0x43, 0x7C, 0x3D,
-    0xA1, 0x0B, 0x3E, 0x85, 0x05, 0x10, 0x6D, 0x68, 0x20, 0x92, 0x90, 0x22, 0xB3, 0xAC, 0x9B, 0xBA,
-    0x3E, 0x23, 0xD8, 0xBD, 0x4E, 0xBE, 0x81, 0x80, 0xFD, 0xF7, 0xB2, 0x44, 0x5E, 0xBF, 0xEA, 0x95,
-    0xFE, 0x73, 0x60, 0xE3, 0x15, 0xDB, 0x2B, 0x58, 0xEB, 0x29, 0x1C, 0xEE, 0x83, 0xDC, 0x77, 0x52,
-    0x8D, 0xCF, 0x9D, 0xE4, 0xF4, 0xAC, 0x3B, 0xD1, 0x8A, 0x87, 0x73, 0xAD, 0xA0, 0x36, 0xD9, 0x84,
-    0x72, 0xDF, 0x16, 0xF7, 0xE3, 0xCC, 0xB6, 0x3D, 0x9C, 0x99, 0x79, 0x16, 0x19, 0xFB, 0x0F, 0xB5,
-    0x41, 0xFA, 0xCF, 0x29, 0x58, 0xF4, 0x6E, 0xB7, 0xD4, 0x66, 0x54, 0x7F, 0x39, 0x1D, 0x4D, 0xD6,
-    0x74, 0xE4, 0xD9, 0x53, 0x46, 0xC5, 0x57, 0xD0, 0xD1, 0x17, 0xCA, 0x7F, 0x66, 0xAA, 0x97, 0x3E,
-    0xBD, 0xF0, 0xC7, 0xE4, 0xDF, 0x37, 0xB8, 0xEB, 0x73, 0xB4, 0xE4, 0x9B, 0xD0, 0x6D, 0xA4, 0xC7,
-    0x49, 0xF2, 0xF9, 0x7D, 0x43, 0x65, 0x4E, 0xC6, 0x42, 0xF3, 0x2E, 0x5D, 0x83, 0x83, 0x2D, 0x47,
-    0xA7, 0x6F, 0x51, 0xD7, 0x59, 0xD7, 0x49, 0x24, 0xAB, 0xBF, 0x82, 0xB4, 0x8D, 0xB4, 0x15, 0xC4,
-    0x53, 0x1D, 0xF0, 0x2A, 0x1D, 0xBF, 0xB9, 0x3A, 0x5A, 0xE0, 0xAC, 0xAE, 0xCB, 0xD7, 0xDA, 0x78,
-    0xC1, 0xAF, 0x3E, 0x8F, 0xD7, 0xC1, 0x96, 0xDC, 0x85, 0xB3, 0x2F, 0x76, 0xDE, 0x2E, 0x31, 0xDB,
-    0x2E, 0x7D, 0x10, 0x67, 0xDF, 0xB7, 0x3A, 0x87, 0xF0, 0x58, 0x23, 0x2F, 0x54, 0xF2, 0xE4, 0x81,
-    0x22, 0x91, 0xAD, 0xE6, 0xD1, 0xAC, 0x92, 0xC6, 0xAD, 0x9C, 0xDA, 0xAB, 0x9C, 0x8A, 0xF5, 0x17,
-    0xA7, 0x8B, 0x41, 0xCE, 0x02, 0x90, 0x53, 0x6F, 0x96, 0xA6, 0x31, 0x0A, 0xC0, 0x71, 0x16, 0x3B,
-    0x9F, 0x3D, 0x97, 0x3C, 0xFF, 0xFE, 0xAF, 0x62, 0x13, 0xB6, 0x61, 0x83, 0x9C, 0xB2, 0xAA, 0x45,
-    0x42, 0xF6, 0xA4, 0x0E, 0x17, 0x23, 0xDF, 0x1E, 0xD3, 0xAC, 0x4C, 0xA2, 0xFB, 0xCF, 0x91, 0x7F,
-    0x7D, 0x66, 0x6D, 0x2B, 0x42, 0xBE, 0x2F, 0x5D, 0x7D, 0xA2, 0x18, 0xA6, 0x3B, 0xD8, 0x7C, 0xE2,
-    0x2F, 0x40, 0xD9, 0x1D, 0x75, 0x61, 0x7A, 0x55, 0x49, 0xD3, 0xD3, 0xE4, 0x27, 0x1E, 0x20, 0xFF,
-    0xF6, 0xAC, 0xBC, 0x9E, 0x9D, 0x1F, 0x10, 0xFC, 0xF8, 0x6F, 0x90, 0xFF, 0xD7, 0x9F, 0xA2, 0x0B,
-    0xDC, 0xD0, 0x03, 0x55, 0xF5, 0xBA, 0x28, 0x88, 0x71, 0x4C, 0x1B, 0x2F, 0x18, 0xE8, 0x2D, 0x3B,
-    0xDA, 0xBA, 0xD8, 0xA1, 0x6F, 0xFA, 0x3A, 0x4D, 0x9F, 0xD0, 0xEF, 0x42, 0x3D, 0x30, 0xAC, 0xE5,
-    0x36, 0x47, 0x57, 0x99, 0x9D, 0x30, 0x33, 0x32, 0xA4, 0x56, 0x76, 0x3A, 0x65, 0xF6, 0x34, 0x16,
-    0x26, 0x7C, 0xCA, 0xD3, 0x52, 0x3C, 0x2E, 0x4F, 0xF2, 0x5C, 0x0E, 0x73, 0xB3, 0x6B, 0x8F, 0x85,
-    0x5E, 0xE8, 0x13, 0x34, 0xE7, 0x3E, 0xDE, 0x75, 0xF8, 0xEC, 0x79, 0xC4, 0xC0, 0xF3, 0x58, 0xFE,
-    0x66, 0xAE, 0xED, 0xFA, 0x8E, 0xB2, 0x07, 0x64, 0x08, 0x72, 0x4C, 0x5E, 0xA5, 0x77, 0x41, 0x69,
-    0xEE, 0x82, 0x27, 0x90, 0xCC, 0xB3, 0x04, 0xB1, 0x19, 0x7C, 0xDF, 0x4D, 0x8F, 0xAD, 0x5B, 0xC3,
-    0xB7, 0x23, 0x08, 0xFE, 0x5C, 0x7D, 0x4A, 0xCB, 0x3F, 0xD6, 0x81, 0x2C, 0x08, 0x63, 0xEC, 0xF6,
-    0x7D, 0xEF, 0xC1, 0x7A, 0xC4, 0x03, 0x67, 0xAE, 0x58, 0x31, 0x97, 0x1E, 0x64, 0x4E, 0x7B, 0x2B,
-    0x0A, 0xD7, 0x39, 0xCF, 0xB2, 0xB0, 0xDF, 0x8E, 0xD7, 0xEC, 0xD1, 0x90, 0xA0, 0x7E, 0x40, 0xFE,
-    0x5E, 0x49, 0xCA, 0x03, 0x82, 0xA1, 0x4E, 0x51, 0x6C, 0xAF, 0x38, 0xFE, 0x44, 0x56, 0x63, 0xE3,
-    0x5E, 0xC2, 0x89, 0x15, 0x42, 0x68, 0xC3, 0xBD, 0xF7, 0x3B, 0x7B, 0xBF, 0xB1, 0x41, 0xF6, 0x8C,
-    0x9C, 0xBB, 0x2F, 0x1E, 0x12, 0xEB, 0xC1, 0x37, 0x3F, 0x00, 0xA6, 0x47, 0x6E, 0x61, 0xD7, 0x22,
-    0xE1, 0xE1, 0x46, 0x54, 0xD9, 0xB5, 0x8D, 0x0F, 0x86, 0xDD, 0xC1, 0x21, 0x01, 0x0E, 0x24, 0x50,
-    0x79, 0xB7, 0x38, 0xDC, 0x4C, 0x64, 0xD4, 0x38, 0x7A, 0xA6, 0xE9, 0x17, 0xF9, 0x59, 0x96, 0x49,
-    0xD5, 0x44, 0x41, 0xF4, 0x30, 0x00, 0xDA, 0x95, 0xD8, 0xCB, 0x47, 0x21, 0xF3, 0xF3, 0x35, 0xFF,
-    0xDD, 0x52, 0x8F, 0x3E, 0x6F, 0x23, 0xEF, 0x3A, 0x9F, 0x97, 0xEA, 0x92, 0xD1, 0x48, 0x06, 0xB5,
-    0xE2, 0x23, 0xCE, 0x9E, 0xC8, 0x81, 0x96, 0x2E, 0x73, 0xAD, 0x0D, 0xA8, 0x94, 0x38, 0xBD, 0x3F,
-    0x6A, 0xEB, 0x77, 0xBE, 0x4A, 0xFB, 0xFF, 0xB4, 0xD0, 0xB1, 0x73, 0x45, 0xC2, 0x96, 0x62, 0xE3,
-    0x40, 0xB7, 0xA7, 0x45, 0x08, 0x6B, 0xC7, 0x65, 0x50, 0x04, 0x28, 0xFE, 0x87, 0xB2, 0xE3, 0x42,
-    0xD2, 0x5E, 0x19, 0xA6, 0x09, 0x0F, 0x05, 0xF9, 0xB5, 0x8F, 0x2A, 0x70, 0x06, 0xE8, 0x3D, 0x09,
-    0x9B, 0x50, 0xFC, 0x7F, 0xFB, 0xEC, 0x4D, 0xD4, 0xDF, 0x9B, 0xA3, 0x4D, 0xF1, 0xDE, 0xBB, 0xF4,
-    0xEB, 0x4C, 0x06, 0xD5, 0x00, 0x5C, 0x71, 0xAA, 0x0E, 0x29, 0xF0, 0x88, 0x48, 0xE1, 0xE5, 0x07,
-    0x9B, 0xC0, 0x7A, 0xCC, 0x30, 0x66, 0x7C, 0x9D, 0xF2, 0x98, 0x41, 0xCD, 0xE1, 0x69, 0x76, 0xF4,
-    0x40, 0x9C, 0xCD, 0xCD, 0x1C, 0xB6, 0x37, 0xAE, 0xF5, 0x00, 0x81, 0x47, 0x33, 0x62, 0x4B, 0x0D,
-    0x39, 0x5E, 0x67, 0xD9, 0x5A, 0xE9, 0x30, 0xE7, 0xB3, 0x85, 0xAA, 0x53, 0x55, 0x09, 0x9B, 0x7E,
-    0x61, 0x05, 0x3A, 0x0A, 0x08, 0x14, 0x3D, 0xA8, 0xD6, 0x74, 0xB6, 0x1B, 0xEB, 0x18, 0x94, 0x6D,
-    0x04, 0xD3, 0x1C, 0x18, 0xCD, 0x12, 0xD0, 0xBB, 0xF7, 0xF0, 0xF0, 0x88, 0xF1, 0x9C, 0x08, 0x21,
-    0x7F, 0x74, 0xAD, 0x95, 0x81, 0x32, 0x0F, 0x86, 0x08, 0xDF, 0x98, 0x32, 0x60, 0x97, 0xEA, 0xA6,
-    0x03, 0x9E, 0x88, 0xCB, 0x61, 0xB0, 0x50, 0x15, 0x8F, 0x03, 0xA1, 0x40, 0x40, 0xA4, 0x47, 0xF4,
-    0x0C, 0x2E, 0x61, 0xBF, 0xD7, 0xF1, 0xC1, 0xFF, 0x17, 0x6D, 0x14, 0x76, 0x44, 0xB5, 0x1D, 0x11,
-    0xC4, 0x44, 0x64, 0x81, 0x6D, 0x45, 0x7F, 0xB1, 0x1C, 0x58, 0xC8, 0x05, 0x96, 0x50, 0x35, 0xAC,
-    0xC6, 0xAF, 0xC6, 0xC4, 0x35, 0xC3, 0xFB, 0x53, 0xEE, 0x43, 0x11, 0x09, 0xFB, 0x19, 0x6E, 0xD9,
-    0x1D, 0xE9, 0xA2, 0xF7, 0x25, 0xBB, 0x8C, 0x7B, 0x07, 0x0F, 0xB8, 0x16, 0x48, 0x52, 0x73, 0x9E,
-    0x4E, 0xCD, 0x9F, 0x86, 0xBD, 0xBA, 0x4C, 0x78, 0xDF, 0x51, 0xA7, 0xE1, 0x3E, 0x6E, 0xD3, 0x15,
-    0xF3, 0xCB, 0x79, 0xE7, 0xBC, 0x9F, 0x19, 0x96, 0x6A, 0x5A, 0x01, 0x65, 0xAE, 0x6D, 0x20, 0xAF,
-    0x39, 0xF2, 0x22, 0xAA, 0x12, 0x94, 0x2E, 0x3C, 0xBD, 0x24, 0xAB, 0x66, 0x80, 0x6D, 0x09, 0x05,
-    0x16, 0x3F, 0x42, 0xA8, 0xEE, 0x4A, 0x0C, 0xBB, 0x9B, 0xA1, 0xB9, 0x51, 0xDC, 0x35, 0xCD, 0x53,
-    0xA8, 0xB9, 0xD9, 0x8D, 0x70, 0xED, 0xA4, 0x2D, 0x56, 0x06, 0x19, 0x3B, 0xB6, 0xC9, 0x9B, 0xE7,
-    0x9B, 0x7F, 0xAC, 0xB1, 0xEA, 0xF3, 0x3F, 0x5D, 0x9D, 0x70, 0xED, 0x7B, 0x34, 0x45, 0xD7, 0x35,
-    0x0F, 0xD3, 0xFB, 0xCF, 0x53, 0x7F, 0xA3, 0xAC, 0xBD, 0xA3, 0xA1, 0x85, 0x05, 0xD3, 0x81, 0xD3,
-    0x89, 0x7F, 0x36, 0x4F, 0x6E, 0xE6, 0xA7, 0x32, 0x60, 0x39, 0xC1, 0xFF, 0xD3, 0x2B, 0x64, 0x24,
-    0x18, 0xE7, 0x7D, 0x00, 0x7D, 0x48, 0x3C, 0xB1, 0x80, 0x1B, 0xC8, 0xE6, 0xAA, 0x80, 0xDB, 0x5F,
-    0x2F, 0xE0, 0xBE, 0xA6, 0xBA, 0x74, 0xD8, 0xC2, 0xB9, 0x0B, 0x7C, 0xEB, 0xB1, 0x8E, 0x31, 0xAD,
-    0x58, 0xB4, 0x5B, 0xEF, 0xFF, 0x01, 0xAB, 0x56, 0x9D, 0x46, 0xCB, 0x04, 0xA2, 0x63, 0xA6, 0xE1,
-    0x32, 0xBF, 0x8C, 0x7A, 0x1B, 0xB0, 0x47, 0x10, 0xEA, 0xFE, 0x34, 0x88, 0x5D, 0xB3, 0xEA, 0x2B,
-    0x0A, 0x96, 0x54, 0x3F, 0xE0, 0x72, 0xFB, 0x5B, 0x94, 0x20, 0x6D, 0xE5, 0x24, 0xF1, 0xD8, 0xFF,
-    0x03, 0x5D, 0x50, 0xB1, 0x4E, 0xDC, 0x40, 0x14, 0x9C, 0xF5, 0xE6, 0xBC, 0x48, 0xAB, 0x68, 0x5D,
-    0x24, 0x05, 0x05, 0x72, 0x93, 0x0A, 0x1D, 0xDE, 0x14, 0x14, 0x14, 0xF6, 0x79, 0xA1, 0xA1, 0xA0,
-    0xA1, 0xC9, 0x1F, 0xF0, 0x01, 0x94, 0x14, 0x87, 0x6F, 0x45, 0x8A, 0x94, 0xB9, 0x4F, 0xA0, 0xA6,
-    0xA2, 0xBC, 0xC2, 0xB9, 0x5B, 0xE5, 0x8A, 0x2B, 0x68, 0x8C, 0x28, 0xAE, 0x35, 0x15, 0xED, 0x0A,
-    0x59, 0xC2, 0x51, 0xD6, 0x67, 0x16, 0x4A, 0xE6, 0x35, 0xEF, 0xCD, 0x1B, 0x3D, 0xCD, 0x3C, 0x30,
-    0xE5, 0xB8, 0x95, 0x6A, 0x4C, 0x0C, 0xA0, 0x12, 0x56, 0xB7, 0x23, 0xAE, 0x23, 0x78, 0x50, 0x8B,
-    0x85, 0x96, 0x25, 0x5B, 0x3E, 0x36, 0xF1, 0x10, 0x53, 0x02, 0xD2, 0x7D, 0xCE, 0x5F, 0xD6, 0xBF,
-    0xDD, 0xF7, 0xDC, 0x6F, 0x77, 0x6F, 0x8E, 0xFB, 0x6E, 0xF7, 0x46, 0x7B, 0x9D, 0x09, 0x47, 0xC1,
-    0x43, 0xDF, 0x8A, 0x0E, 0x03, 0xEC, 0x2D, 0x36, 0xB3, 0x2D, 0xF2, 0xCB, 0x16, 0x73, 0xB1, 0xD6,
-    0x17, 0x00, 0x6B, 0xE5, 0x3C, 0x4D, 0xBE, 0x65, 0x68, 0x59, 0xCD, 0x15, 0x03, 0xAB, 0x63, 0x97,
-    0xEE, 0x5D, 0xF8, 0xBA, 0x2C, 0xA5, 0x25, 0xCA, 0x5F, 0xE2, 0x87, 0x75, 0x21, 0x96, 0xB6, 0xCB,
-    0xF9, 0xBD, 0xBD, 0x0C, 0x61, 0x10, 0x11, 0x81, 0x59, 0x93, 0xB0, 0x3B, 0x93, 0x5B, 0xE2, 0x10,
-    0xBE, 0x89, 0x04, 0x3B, 0x5E, 0xD6, 0x6D, 0x29, 0x05, 0xFD, 0x5B, 0x9D, 0xEF, 0x7B, 0x22, 0xC2,
-    0xC4, 0xCA, 0x7E, 0xA5, 0xCB, 0x29, 0xF5, 0xC6, 0xA1, 0x32, 0x71, 0x64, 0x33, 0x56, 0x15, 0xDE,
-    0xB5, 0x47, 0xAC, 0x27, 0x70, 0xB4, 0x16, 0x68, 0xB9, 0xFE, 0xE2, 0xE7, 0x52, 0xFE, 0xB4, 0x19,
-    0xAD, 0x12, 0x58, 0x82, 0xE1, 0x28, 0x1B, 0xCF, 0x6E, 0xAF, 0x3D, 0xFB, 0x87, 0x57, 0x4E, 0x52,
-    0x13, 0xE1, 0xD3, 0xA4, 0xEF, 0xDE, 0x13, 0x17, 0x0B, 0xF1, 0x64, 0x4A, 0xDF, 0x12, 0x25, 0x9A,
-    0x61, 0x9A, 0x0E, 0xD3, 0x83, 0xD8, 0x86, 0x8A, 0xC0, 0x09, 0xD3, 0xC6, 0xD4, 0x9C, 0x22, 0x3C,
-    0xDC, 0x04, 0x36, 0xE3, 0xAB, 0xFA, 0x0C, 0x04, 0x75, 0xCA, 0x54, 0xC3, 0xFF, 0xE5, 0x1A, 0x03,
-    0x5A, 0xD9, 0x71, 0x22, 0xAE, 0x34, 0x24, 0x82, 0x1E, 0x72, 0x1E, 0x34, 0xA5, 0x44, 0x73, 0x0A,
-    0x6F, 0x9E, 0xAA, 0xAD, 0x92, 0xAE, 0xFA, 0x46, 0x76, 0xF8, 0x8A, 0x50, 0x5F, 0x6D, 0x76, 0x8A,
-    0xFF, 0xEB, 0x93, 0x36, 0xDA, 0x46, 0xDE, 0xAF, 0x7A, 0x37, 0xF8, 0xA1, 0x3E, 0xA6, 0xC1, 0x14,
-    0xAC, 0x42, 0x8E, 0xC0, 0x22, 0x06, 0xDE, 0x12, 0x85, 0xEA, 0x6C, 0xC2, 0x9E, 0x9D, 0x5C, 0xFA,
-    0xA7, 0x66, 0xD4, 0x8C, 0x99, 0x93, 0x78, 0x05, 0xD5, 0x7C, 0x4D, 0x8C, 0xDC, 0x66, 0x9A, 0xDE,
-    0x47, 0xB2, 0xBB, 0x39, 0x23, 0x66, 0xCC, 0x3E, 0xD8, 0xC8, 0x6C, 0xE4, 0x31, 0x7D, 0x98, 0x83,
-    0x91, 0x48, 0xCD, 0x1C, 0x26, 0x80, 0x0F, 0x5D, 0x45, 0x4A, 0x0A, 0x66, 0x80, 0xF5, 0xC1, 0x0A,
-    0xE0, 0x1E, 0x1D, 0x1C, 0x40, 0x3E, 0xEC, 0x02, 0x8B, 0xDD, 0xC1, 0xB4, 0x0F, 0x02, 0x22, 0x4C,
-    0xAA, 0xBA, 0x28, 0x0B, 0x81, 0x81, 0xF5, 0xC1, 0x3A, 0x6C, 0x90, 0x04, 0x06, 0xB2, 0x3E, 0x38,
-    0xC8, 0x6E, 0xCF, 0xEC, 0xCA, 0x07, 0x1D, 0x7A, 0xB3, 0x55, 0x4D, 0x5A, 0x0D, 0xC4, 0x07, 0x1F,
-    0x4C, 0x5B, 0x30, 0x7C, 0x10, 0x10, 0x73, 0x66, 0x64, 0x0B, 0xB0, 0x36, 0x2B, 0x7A, 0x4C, 0xD9,
-    0x6C, 0x89, 0x55, 0xCC, 0xF3, 0xBC, 0x1F, 0xEB, 0xAF, 0xF5, 0xB3, 0xB2, 0xFE, 0x9C, 0x69, 0xA8,
-    0xA9, 0xAE, 0x2A, 0xD6, 0xF7, 0x7D, 0xEF, 0xFB, 0xBD, 0x3F, 0xCF, 0xFB, 0xF3, 0x51, 0xA9, 0x05,
-    0x85, 0x9F, 0x93, 0xF8, 0x35, 0x2B, 0x5C, 0xEC, 0x6A, 0xFC, 0x97, 0x3A, 0xAA, 0xA6, 0x3F, 0x71,
-    0x5D, 0x17, 0x06, 0x2E, 0x89, 0xEA, 0x2A, 0x4F, 0x99, 0xB9, 0x5A, 0x55, 0x6E, 0xA2, 0x52, 0xD5,
-    0xE6, 0x87, 0x25, 0xBF, 0x97, 0xE2, 0xE2, 0xAB, 0x65, 0xA5, 0xEA, 0x3A, 0x53, 0x56, 0x5D, 0x87,
-    0xCA, 0x8B, 0xF0, 0xD6, 0x80, 0xC3, 0xE5, 0xB8, 0xE0, 0xF6, 0x97, 0x70, 0xBB, 0x95, 0x18, 0x05,
-    0x46, 0x70, 0xD2, 0xC5, 0xD2, 0xAC, 0x31, 0x9E, 0x8F, 0x0B, 0x3E, 0x5D, 0x50, 0xA1, 0x32, 0x2A,
-    0xDC, 0xE3, 0xE4, 0xB1, 0x52, 0xDE, 0xA1, 0x42, 0xCD, 0xFF, 0xE0, 0xB6, 0xA1, 0x5A, 0xAF, 0xEB,
-    0x5C, 0x79, 0xA1, 0x9D, 0xA8, 0xBE, 0x72, 0x95, 0x95, 0xAB, 0x1F, 0x29, 0x97, 0x73, 0x70, 0x11,
-    0x06, 0xBF, 0xE1, 0x24, 0x20, 0x26, 0xA8, 0x4B, 0x2E, 0x22, 0x55, 0x76, 0xC6, 0x2F, 0x86, 0xB8,
-    0xF4, 0xF1, 0x8B, 0xDB, 0xBF, 0xCF, 0xDB, 0x73, 0x50, 0x60, 0x27, 0x66, 0x61, 0x6C, 0x90, 0xA8,
-    0xDC, 0xE1, 0x22, 0x64, 0x0A, 0xAC, 0xB9, 0xAE, 0x02, 0x5C, 0xDE, 0x4D, 0x02, 0xD5, 0x39, 0x69,
-    0x65, 0xF6, 0x6B, 0x61, 0x57, 0x9D, 0x58, 0x76, 0x92, 0x45, 0xA5, 0xC8, 0x10, 0xCE, 0x65, 0x94,
-    0x7F, 0x0B, 0xC2, 0x40, 0x9D, 0x39, 0xFA, 0x65, 0xA5, 0x02, 0xE5, 0xA6, 0x56, 0xA6, 0x36, 0x30,
-    0xA4, 0x95, 0x3B, 0x29, 0x5E, 0xF7, 0xF1, 0x07, 0xA8, 0x68, 0x83, 0x27, 0xF6, 0x07, 0x71, 0xA1,
-    0xFA, 0x41, 0x1D, 0xE1, 0xB5, 0x5E, 0x5E, 0x00, 0x9E, 0xE2, 0x85, 0xFB, 0x4B, 0xBC, 0xA8, 0x31,
-    0xA2, 0xBD, 0xAB, 0x89, 0xE3, 0x12, 0x3D, 0xF2, 0x69, 0x88, 0x4B, 0x0F, 0xAB, 0xB6, 0xC9, 0xD1,
-    0xC7, 0xD5, 0x6D, 0xF8, 0xEF, 0x93, 0xA1, 0xE0, 0x40, 0x62, 0x66, 0x18, 0xD2, 0x21, 0xFF, 0x1F,
-    0x1F, 0xF3, 0x5F, 0xE9, 0xA5, 0x5A, 0x24, 0xDD, 0x0B, 0xF7, 0xF0, 0x7F, 0x8E, 0x53, 0x78, 0x9B,
-    0x8C, 0xF2, 0x6B, 0xDE, 0xAA, 0x16, 0x8F, 0xF2, 0xCF, 0x82, 0xA4, 0x25, 0x4E, 0x61, 0x54, 0x26,
-    0xD6, 0x9F, 0x6C, 0x28, 0xB5, 0xC5, 0x2D, 0x31, 0x9B, 0xC5, 0x63, 0xD8, 0xB5, 0x50, 0xF5, 0xB0,
-    0x13, 0xE0, 0x5A, 0x24, 0x5C, 0xE5, 0x38, 0x32, 0x87, 0x83, 0x61, 0xC2, 0x9E, 0x52, 0x07, 0xAD,
-    0x0A, 0x7F, 0x7B, 0x05, 0xE4, 0xA8, 0x47, 0x21, 0x88, 0xF1, 0xAB, 0x49, 0x79, 0x01, 0xB4, 0xD5,
-    0x91, 0x73, 0xBD, 0x8E, 0x06, 0xAA, 0x85, 0x05, 0xE6, 0x5E, 0x64, 0x61, 0x8A, 0xEF, 0x18, 0x58,
-    0xB0, 0x05, 0xCA, 0xAD, 0x11, 0xF7, 0x20, 0xC4, 0xB2, 0xC0, 0x67, 0x7E, 0x2B, 0x36, 0x43, 0x55,
-    0x3D, 0x85, 0xD5, 0xF7, 0x95, 0x73, 0x3E, 0x57, 0x6D, 0x27, 0xB3, 0x73, 0xB2, 0xDE, 0xE1, 0x92,
-    0x8F, 0x8E, 0xE5, 0x22, 0x5D, 0xAA, 0xCF, 0x90, 0x54, 0xAC, 0x04, 0x5B, 0x4C, 0xEA, 0xDB, 0x6A,
-    0xE6, 0x35, 0x48, 0xEC, 0x8A, 0x14, 0xCC, 0xBF, 0xC6, 0xE8, 0x43, 0xBD, 0xB6, 0x45, 0x0C, 0x05,
-    0xC1, 0xB3, 0xF3, 0x1E, 0x36, 0xB8, 0x9C, 0x97, 0xB9, 0x54, 0xAD, 0xEF, 0x6A, 0x3E, 0xF6, 0x45,
-    0x80, 0x84, 0x89, 0x6D, 0xCD, 0x42, 0x52, 0x1E, 0x68, 0xE1, 0x27, 0xEF, 0xFD, 0x99, 0x9B, 0x22,
-    0x99, 0x83, 0x5C, 0x8F, 0xC9, 0xAA, 0x62, 0x76, 0xC0, 0x25, 0xFC, 0xCA, 0x1D, 0xFC, 0x92, 0x6C,
-    0x4C, 0xD5, 0x30, 0xF7, 0xA6, 0x37, 0xB9, 0x59, 0xD4, 0x21, 0xE7, 0xA6, 0x37, 0x43, 0x3D, 0x3D,
-    0x27, 0x13, 0xE5, 0xEB, 0x2B, 0x23, 0xC5, 0x26, 0xC4, 0xE0, 0xA0, 0x37, 0xD4, 0xAC, 0x9E, 0xFC,
-    0x50, 0xAC, 0xC1, 0x2F, 0x87, 0x0A, 0x84, 0x71, 0x32, 0xD1, 0x18, 0x17, 0x92, 0x8D, 0x9F, 0x55,
-    0x19, 0xD6, 0xC8, 0x45, 0x36, 0x9C, 0x48, 0x94, 0xB9, 0xA5, 0x0A, 0x79, 0xCF, 0xFE, 0xFC, 0x0C,
-    0xDF, 0xF3, 0x29, 0x24, 0x2D, 0x35, 0x7C, 0xB1, 0xC2, 0x7B, 0x56, 0x66, 0x15, 0xF8, 0x2E, 0x54,
-    0x30, 0x53, 0x1D, 0xD0, 0xE8, 0x46, 0x56, 0x66, 0xE6, 0x22, 0x92, 0x90, 0xC6, 0x1C, 0x5A, 0xDB,
-    0x56, 0xEE, 0xCE, 0xD5, 0xC8, 0x28, 0xCC, 0xCA, 0x13, 0x01, 0x88, 0x82, 0xC8, 0xE6, 0xFC, 0xCB,
-    0x73, 0xDA, 0x6C, 0xD6, 0x95, 0x03, 0x55, 0x5E, 0xAA, 0x23, 0x6F, 0x24, 0xDC, 0x24, 0x35, 0x4E,
-    0x22, 0xC4, 0x05, 0x9A, 0xA4, 0x4A, 0x78, 0x01, 0x31, 0xF1, 0x35, 0xC1, 0xA4, 0x7D, 0xB0, 0x76,
-    0xEC, 0xFA, 0x51, 0x21, 0x08, 0x8B, 0x72, 0x3F, 0xDF, 0x1C, 0x61, 0x51, 0x1B, 0x60, 0x8D, 0x59,
-    0x42, 0x42, 0xDD, 0x04, 0x2A, 0xC8, 0x21, 0x5C, 0xA8, 0x2F, 0x86, 0x0C, 0xA8, 0x82, 0x89, 0x2A,
-    0x31, 0x0C, 0x57, 0x87, 0x61, 0x2A, 0x63, 0xE8, 0x88, 0xC1, 0x49, 0xE3, 0x1A, 0xB6, 0xE7, 0xD2,
-    0xDC, 0x92, 0x38, 0xA8, 0x58, 0x00, 0x0F, 0xF7, 0xE5, 0xD4, 0xFE, 0x57, 0x52, 0x2F, 0xFC, 0x81,
-    0x01, 0xDE, 0x1E, 0xD5, 0x8C, 0x16, 0xC6, 0x6D, 0xAC, 0x97, 0xCA, 0xC0, 0x5D, 0xCA, 0xD9, 0xB5,
-    0x39, 0x07, 0x18, 0x51, 0x62, 0x93, 0xF0, 0x1F, 0x98, 0x10, 0x8A, 0x5E, 0x3A, 0x58, 0x08, 0x2D,
-    0x43, 0xA4, 0x4A, 0x6C, 0xB6, 0x3F, 0x0C, 0xEA, 0xC3, 0x5A, 0x04, 0xC4, 0xD0, 0x3A, 0xD1, 0xC4,
-    0xC8, 0xD2, 0xEE, 0xA9, 0x11, 0x95, 0xF4, 0xBB, 0xB3, 0x2B, 0xF9, 0x23, 0xC8, 0xA5, 0xEA, 0x25,
-    0x10, 0x6B, 0x8F, 0x4C, 0xB0, 0x3F, 0xA3, 0xA6, 0x95, 0x94, 0x3D, 0xB2, 0xA7, 0xE2, 0x00, 0xEE,
-    0xA9, 0x9C, 0x6C, 0x5B, 0xA5, 0x4C, 0x1D, 0x0F, 0xB9, 0xC7, 0x5C, 0x60, 0xB0, 0x2E, 0x12, 0x24,
-    0x9C, 0xA2, 0xED, 0x73, 0x12, 0x8A, 0x15, 0x55, 0x19, 0x8B, 0xC1, 0x16, 0x83, 0x29, 0xDB, 0x14,
-    0x7D, 0xEC, 0xA1, 0x5F, 0x47, 0x7E, 0xEA, 0x80, 0x8C, 0x78, 0x3A, 0x6F, 0x28, 0xD7, 0x73, 0x72,
-    0x0D, 0x22, 0x59, 0xAB, 0x56, 0x07, 0x5F, 0x5E, 0xCC, 0xB9, 0x03, 0x6D, 0x92, 0x60, 0x6A, 0xA3,
-    0xFD, 0x23, 0xE8, 0x63, 0x44, 0x79, 0x0F, 0x44, 0xAD, 0x70, 0x33, 0xA6, 0xF2, 0x53, 0xF2, 0x2C,
-    0x10, 0x7D, 0x6B, 0x55, 0x54, 0x87, 0x56, 0x9B, 0x1F, 0xB7, 0x3C, 0x7E, 0xDC, 0xC2, 0x9E, 0x58,
-    0x59, 0x07, 0xDC, 0x32, 0x8A, 0x0E, 0x77, 0x76, 0xD0, 0xE1, 0xD6, 0xFB, 0x7D, 0x6E, 0xB4, 0x5B,
-    0x51, 0xE0, 0xAD, 0x92, 0x22, 0x6F, 0x94, 0x22, 0xF4, 0x7D, 0x8A, 0xBD, 0x59, 0xE7, 0x46, 0x0C,
-    0x9F, 0x51, 0xA9, 0x7A, 0xD4, 0xAC, 0xC0, 0x08, 0xF7, 0x91, 0xA1, 0x8F, 0x91, 0x3E, 0xF0, 0xC2,
-    0xFD, 0xAC, 0x24, 0x2B, 0xD2, 0xBD, 0xB6, 0x33, 0xA8, 0xC3, 0x78, 0xE4, 0xC3, 0x7D, 0x94, 0xE0,
-    0x0A, 0xC5, 0x04, 0xC6, 0x16, 0x97, 0x96, 0x82, 0xD4, 0x60, 0xE8, 0xD2, 0xA0, 0xD9, 0xB0, 0xF0,
-    0xB5, 0x3E, 0xE4, 0x45, 0x75, 0x5D, 0x6A, 0xD9, 0x41, 0x7E, 0xAF, 0x43, 0xE2, 0x65, 0xEB, 0xD3,
-    0xB1, 0x01, 0xE5, 0x87, 0xCB, 0x2D, 0x5C, 0xFE, 0x8E, 0xBC, 0x11, 0xDB, 0x19, 0x87, 0x37, 0x31,
-    0xC6, 0xA0, 0xB3, 0xDA, 0x35, 0xE2, 0x4B, 0x14, 0x62, 0x6D, 0x8B, 0x7C, 0x19, 0x20, 0x98, 0x5C,
-    0xA3, 0xC6, 0x4C, 0x69, 0x63, 0xD4, 0x17, 0xF6, 0x69, 0xDB, 0x25, 0x16, 0x8A, 0x16, 0x66, 0xC0,
-    0x05, 0xE2, 0x23, 0x53, 0xCC, 0x9A, 0x36, 0x5E, 0x50, 0x08, 0x7C, 0x84, 0x51, 0x4D, 0x51, 0x1A,
-    0x7A, 0x4F, 0xDA, 0x31, 0xAD, 0xDC, 0xE2, 0xB5, 0x9B, 0xAB, 0x36, 0x3A, 0xF9, 0xCC, 0x35, 0x9D,
-    0x5D, 0xE3, 0xA2, 0x52, 0x8D, 0xFD, 0x50, 0x3D, 0x5E, 0x5C, 0xDE, 0x6F, 0x5E, 0xE5, 0x4E, 0xAF,
-    0x8A, 0xAF, 0x7B, 0x8E, 0x4E, 0x2B, 0xA7, 0x89, 0xE7, 0x6E, 0x61, 0x2E, 0x0A, 0x5F, 0x4E, 0xBF,
-    0xB2, 0xC2, 0xA5, 0x5A, 0x9F, 0x1E, 0xCB, 0x45, 0x69, 0xE0, 0x0D, 0x37, 0x37, 0x65, 0x5D, 0x9E,
-    0x78, 0x84, 0x0A, 0xF6, 0x41, 0x8C, 0x81, 0x52, 0x43, 0x23, 0x3E, 0xA3, 0xD6, 0x87, 0xBD, 0x1A,
-    0x5E, 0x45, 0x4F, 0x0E, 0x23, 0x34, 0xA2, 0x17, 0xA7, 0xB6, 0xB4, 0xA8, 0x28, 0x09, 0xEE, 0x27,
-    0x92, 0x30, 0xB4, 0xD2, 0xD3, 0xB0, 0x99, 0xD7, 0xDF, 0xE2, 0x96, 0x81, 0xE0, 0x6B, 0xC7, 0xC5,
-    0xB4, 0x44, 0x10, 0x87, 0x4A, 0xFC, 0x9D, 0xCB, 0xDB, 0xA1, 0xF9, 0x91, 0x17, 0x5A, 0x39, 0x3C,
-    0xF8, 0x90, 0x08, 0x22, 0x8C, 0xEB, 0xD1, 0x78, 0x07, 0xE0, 0x9D, 0x6C, 0x7A, 0xFE, 0xFA, 0x73,
-    0xAC, 0xAB, 0x0B, 0xC7, 0xE2, 0x24, 0xF2, 0x65, 0x5A, 0x2A, 0x87, 0xC0, 0xA3, 0xC2, 0xD6, 0xC3,
-    0x7D, 0x5E, 0x3F, 0x9B, 0x08, 0x4C, 0xB0, 0x3E, 0x5D, 0x6F, 0xA6, 0x48, 0xE6, 0xA7, 0xF0, 0xF4,
-    0x14, 0xF9, 0xCD, 0x53, 0x88, 0xE2, 0xD6, 0xF4, 0x3A, 0xC0, 0x2D, 0x46, 0x21, 0xFA, 0x6E, 0x52,
-    0xDF, 0xA1, 0x97, 0x95, 0x3A, 0x40, 0x46, 0x1C, 0xD5, 0x9E, 0xB7, 0x3F, 0xE6, 0xB0, 0x18, 0x0E,
-    0xDA, 0x5B, 0x73, 0xEC, 0x79, 0xC5, 0xDE, 0xCF, 0xC2, 0x26, 0xB2, 0x26, 0xA3, 0xE4, 0x44, 0xD3,
-    0x69, 0x7A, 0x34, 0x33, 0xBC, 0xC2, 0x50, 0x59, 0x09, 0x87, 0xB4, 0x13, 0xB9, 0x33, 0x14, 0x6F,
-    0xA1, 0x3D, 0x81, 0xA2, 0x2C, 0x1E, 0x54, 0x94, 0xD4, 0x55, 0x99, 0xF1, 0xA4, 0xEC, 0x7F, 0xC1,
-    0xC1, 0x8D, 0x9C, 0x52, 0x64, 0xA5, 0xDC, 0x0B, 0x5B, 0x76, 0xC4, 0x0D, 0xF5, 0x06, 0x52, 0xD8,
-    0x3B, 0x9C, 0x1B, 0x0A, 0xD6, 0x48, 0xD1, 0x48, 0x11, 0xFA, 0xD4, 0xB2, 0xCE, 0x0D, 0x19, 0xAF,
-    0x2B, 0xD7, 0x8E, 0xDA, 0xC2, 0x75, 0x4B, 0xEC, 0xC2, 0xDB, 0x40, 0x70, 0x4A, 0xBD, 0x79, 0x0B,
-    0x2E, 0x74, 0x38, 0x0C, 0xB9, 0x60, 0x85, 0x42, 0xD6, 0x14, 0x7F, 0xF4, 0x61, 0x57, 0x2C, 0xA2,
-    0x05, 0x97, 0x22, 0xBA, 0xB1, 0x87, 0x0B, 0x46, 0xC4, 0xFD, 0xE4, 0x4A, 0x3A, 0x30, 0x9F, 0xFF,
-    0x3C, 0x23, 0x1A, 0xA3, 0x38, 0x83, 0x86, 0x3F, 0x10, 0x0D, 0x3F, 0x63, 0xD0, 0xCA, 0xC0, 0x1C,
-    0xDA, 0x23, 0x15, 0x67, 0x76, 0xAD, 0xBE, 0x0B, 0xF0, 0xA0, 0x36, 0xFE, 0x04, 0x4B, 0x82, 0x8B,
-    0x22, 0xF3, 0x60, 0xF4, 0x5B, 0xE2, 0xD8, 0x02, 0x99, 0xD4, 0x4A, 0x4A, 0x41, 0x41, 0xCE, 0x91,
-    0x54, 0xA4, 0x7B, 0x45, 0x0C, 0xA4, 0xB6, 0xD9, 0x64, 0xDB, 0xC7, 0x5F, 0x89, 0x66, 0x0C, 0xDD,
-    0xD3, 0xB9, 0xA0, 0x96, 0xAE, 0x0C, 0x12, 0x6B, 0x1F, 0x68, 0x63, 0x30, 0x3A, 0xF2, 0x5E, 0xD8,
-    0xE6, 0x16, 0x01, 0x86, 0x89, 0xC9, 0xEC, 0x45, 0x30, 0x0C, 0x43, 0x9A, 0xC3, 0x38, 0x07, 0x46,
-    0xEB, 0x45, 0x6E, 0x9D, 0x00, 0x22, 0x4F, 0x7C, 0x9A, 0xF1, 0x02, 0xB8, 0x31, 0x82, 0x94, 0x8F,
-    0x40, 0x2E, 0x2C, 0x89, 0x59, 0x90, 0xA4, 0xEF, 0x0B, 0xA6, 0xAB, 0xC4, 0x7F, 0x3F, 0x31, 0x04,
-    0x13, 0x32, 0xB5, 0x8F, 0x9B, 0xEC, 0xA5, 0xDA, 0xAD, 0x07, 0xD0, 0xC1, 0xF2, 0xA4, 0x72, 0x2E,
-    0xE4, 0xAA, 0xE7, 0xE4, 0x4E, 0xEE, 0x0A, 0xB4, 0x49, 0xC7, 0x86, 0x58, 0x03, 0x86, 0xC4, 0xAD,
-    0x33, 0x78, 0x02, 0x13, 0x5F, 0xA4, 0x6D, 0x4C, 0xC8, 0x38, 0x40, 0x2D, 0xC8, 0x95, 0x53, 0x88,
-    0xB2, 0x89, 0xCD, 0x70, 0x7B, 0xE4, 0xB6, 0xFB, 0x7C, 0x84, 0x8F, 0xDD, 0x9F, 0xF0, 0x63, 0x97,
-    0x08, 0xBA, 0xF4, 0x28, 0x12, 0x5D, 0x4F, 0x4C, 0xF3, 0x71, 0xCA, 0xA1, 0x73, 0x95, 0xBC, 0xB6,
-    0x6A, 0xD9, 0x84, 0x91, 0xC8, 0xE8, 0xC6, 0xD8, 0x72, 0xE3, 0xE3, 0xB8, 0x52, 0xEB, 0xA3, 0xC6,
-    0xB0, 0x4F, 0x05, 0x71, 0xD9, 0x48, 0x44, 0x10, 0xC4, 0xC7, 0x88, 0x20, 0x38, 0xD7, 0xC4, 0x33,
-    0xC4, 0x85, 0xB6, 0xC2, 0x37, 0x61, 0xF5, 0x6F, 0x79, 0xD5, 0x4B, 0xE0, 0x63, 0x0E, 0x1F, 0x0B,
-    0x13, 0x2C, 0x80, 0x19, 0xE2, 0x82, 0x19, 0x22, 0x5A, 0xF9, 0x8C, 0x06, 0x98, 0x12, 0x5D, 0x72,
-    0x73, 0xBC, 0x23, 0x84, 0xC1, 0xD7, 0x04, 0xDE, 0xD2, 0x1B, 0x5B, 0x5F, 0x91, 0xAE, 0x2E, 0x45,
-    0xC1, 0x49, 0x29, 0xAB, 0x7D, 0x0D, 0xFA, 0xE8, 0x01, 0x4B, 0x6E, 0xA5, 0x17, 0x82, 0x0C, 0xAA,
-    0x7B, 0x08, 0xF0, 0x6C, 0xD2, 0xF2, 0x26, 0x4E, 0x3E, 0x47, 0xBC, 0x86, 0x5B, 0x1A, 0x6D, 0x69,
-    0xB0, 0xA5, 0xB1, 0x96, 0x40, 0x2D, 0x2D, 0x65, 0x4E, 0x14, 0x08, 0xCE, 0x12, 0x15, 0x15, 0xE3,
-    0x1A, 0xF9, 0xF2, 0x46, 0xA5, 0x04, 0x63, 0xF1, 0x2B, 0x14, 0x10, 0x22, 0x2C, 0x25, 0x00, 0x4B,
-    0x10, 0x8C, 0x12, 0x78, 0x65, 0x11, 0x5D, 0x29, 0x82, 0xAB, 0xA1, 0x22, 0xB6, 0x2A, 0xF7, 0x40,
-    0x2B, 0x3A, 0x63, 0x7F, 0x44, 0x68, 0xA5, 0x02, 0xC6, 0x41, 0x89, 0x8A, 0x13, 0xF9, 0xEF, 0x06,
-    0x00, 0xC0, 0x8D, 0xC4, 0xBC, 0x92, 0x28, 0xF3, 0x72, 0x6A, 0xBF, 0x07, 0x34, 0x7C, 0x21, 0x75,
-    0x9F, 0x4F, 0x94, 0xBD, 0x93, 0x79, 0xDC, 0xA1, 0x9D, 0xAC, 0x85, 0xD5, 0xBA, 0x87, 0xF3, 0x93,
-    0xFC, 0xCF, 0xCC, 0x73, 0xFC, 0xE7, 0x1B, 0xBF, 0xCB, 0xC4, 0x53, 0x7D, 0x9D, 0xC0, 0xAA, 0xB7,
-    0x80, 0xCA, 0xB1, 0x9D, 0x1D, 0x55, 0x73, 0x57, 0xB7, 0xE0, 0x9F, 0x3C, 0x5A, 0x9A, 0x93, 0x58,
-    0x1D, 0x5C, 0xE8, 0x32, 0xFE, 0xDB, 0x4F, 0x34, 0x57, 0x67, 0xE4, 0xA5, 0x5D, 0xE7, 0x77, 0x14,
-    0x07, 0x4B, 0xC4, 0xC1, 0x28, 0xA6, 0x0E, 0x9E, 0x1B, 0xCA, 0x8F, 0xB1, 0xDF, 0x1F, 0xAD, 0xBD,
-    0x28, 0x31, 0x24, 0x71, 0xD3, 0x68, 0x73, 0xB3, 0x9A, 0xEC, 0xB7, 0xFE, 0x38, 0x11, 0x71, 0xC8,
-    0x45, 0x1C, 0x4A, 0xF9, 0x76, 0xF7, 0xF6, 0xE2, 0xC0, 0xC8, 0x86, 0xDA, 0x29, 0xA1, 0x0D, 0x9C,
-    0xB5, 0x0B, 0xB8, 0x08, 0x08, 0x04, 0x28, 0x20, 0xF1, 0xA6, 0xAA, 0xA8, 0xF0, 0x95, 0x20, 0x25,
-    0xEE, 0x78, 0x35, 0x98, 0x5C, 0xB8, 0x1D, 0x65, 0x45, 0x83, 0xC5, 0xE8, 0x24, 0x1F, 0x50, 0x28,
-    0x28, 0xB2, 0x51, 0x80, 0x20, 0x48, 0x79, 0x19, 0x24, 0x4C, 0xB0, 0xAD, 0xE0, 0xEE, 0x59, 0x35,
-    0xD0, 0xFE, 0x78, 0x5D, 0xD6, 0x6F, 0x8B, 0x63, 0xC4, 0x92, 0x35, 0xE5, 0xFE, 0x6D, 0x00, 0xC0,
-    0x40, 0x08, 0xD0, 0x7C, 0x10, 0xBC, 0x44, 0xC2, 0x06, 0xC2, 0x9F, 0x3D, 0x00, 0x40, 0x98, 0x66,
-    0x89, 0x14, 0x12, 0xDA, 0xD6, 0x14, 0x04, 0x8D, 0x38, 0x66, 0xFC, 0xDF, 0x75, 0x81, 0x64, 0xF4,
-    0x7F, 0x98, 0xBF, 0xA2, 0xAE, 0x01, 0xA9, 0xC3, 0xD8, 0x77, 0xA9, 0x70, 0x70, 0x05, 0xE0, 0x5C,
-    0x60, 0x0C, 0x75, 0x98, 0xDE, 0x83, 0x6F, 0x63, 0x88, 0x21, 0xEE, 0x43, 0x40, 0xCE, 0xC4, 0x15,
-    0xE7, 0x4D, 0x90, 0x18, 0xEB, 0x10, 0x79, 0x31, 0xD4, 0x41, 0xA2, 0xFF, 0x4F, 0x04, 0x89, 0x8D,
-    0xBB, 0x13, 0x1B, 0x7F, 0x53, 0x90, 0x48, 0xBC, 0xB1, 0x80, 0x20, 0xD1, 0x4C, 0xBD, 0xDD, 0x9F,
-    0x32, 0x46, 0x18, 0x35, 0x0C, 0x5C, 0x56, 0x7B, 0xC3, 0x70, 0x9F, 0x61, 0x78, 0x8E, 0x30, 0xBC,
-    0xAD, 0x4E, 0xBC, 0x6C, 0xA7, 0x4B, 0x7A, 0x10, 0x59, 0xE2, 0x24, 0x1E, 0x2F, 0x1A, 0xFF, 0x69,
-    0xE5, 0xB7, 0x9C, 0x9E, 0x7B, 0x88, 0x20, 0x0C, 0xB2, 0x90, 0x3E, 0x7A, 0x34, 0x18, 0x30, 0xBE,
-    0x74, 0x04, 0x3A, 0x48, 0x68, 0xE5, 0x9D, 0x11, 0x08, 0x84, 0x5D, 0xBB, 0x72, 0x1D, 0xE2, 0x19,
-    0x95, 0x4E, 0xE6, 0x87, 0x50, 0x7B, 0xA2, 0x0D, 0x1F, 0x5B, 0x95, 0x38, 0x3B, 0xC0, 0x1C, 0x66,
-    0x5E, 0xD2, 0xD8, 0x04, 0x58, 0x52, 0xDB, 0x4D, 0x60, 0x06, 0xCD, 0xD2, 0x4E, 0x82, 0x30, 0xF8,
-    0xF0, 0x8B, 0x38, 0xB4, 0xE8, 0xA8, 0xD5, 0x52, 0xFC, 0x17, 0x4D, 0xC6, 0xA0, 0xF1, 0xA3, 0xB4,
-    0x5D, 0x8B, 0x6B, 0x73, 0x7E, 0x03, 0xF2, 0xE0, 0x8D, 0xC2, 0xF5, 0x82, 0x2E, 0x9E, 0x7B, 0x59,
-    0xC9, 0x12, 0x36, 0x64, 0x6F, 0xB5, 0xA7, 0xF4, 0x9E, 0x13, 0x12, 0xAE, 0xAA, 0x71, 0x40, 0xC2,
-    0xC0, 0x60, 0x82, 0xFA, 0x7D, 0x79, 0xA7, 0xB3, 0x21, 0xB1, 0x60, 0x20, 0x48, 0x85, 0x36, 0x49,
-    0x02, 0x09, 0x0C, 0xC5, 0xF8, 0x42, 0x44, 0x72, 0x3F, 0x6C, 0x02, 0xA2, 0x3C, 0xFE, 0x4B, 0x1E,
-    0x35, 0xFE, 0x4D, 0x1B, 0xE4, 0x12, 0xD7, 0x3A, 0x89, 0xD4, 0xE0, 0x2A, 0xC1, 0x44, 0x4A, 0xD0,
-    0x8B, 0x4E, 0x6C, 0x8D, 0xA3, 0x9A, 0x97, 0xC7, 0xDB, 0x72, 0xAA, 0xAE, 0x7C, 0xA0, 0xD3, 0x4B,
-    0xDC, 0xFC, 0x50, 0x62, 0x4C, 0x9B, 0xC9, 0x1B, 0x9B, 0xE1, 0xA3, 0x43, 0x8F, 0x81, 0x45, 0x0E,
-    0x38, 0x7E, 0x5F, 0xD9, 0xC5, 0x52, 0x45, 0x99, 0xA4, 0x16, 0x5C, 0x2F, 0xC6, 0xC9, 0x14, 0x6B,
-    0x7A, 0xC9, 0xC6, 0x28, 0x4E, 0xB6, 0x22, 0x66, 0x32, 0x43, 0x74, 0x71, 0x8C, 0x92, 0xCA, 0x60,
-    0xE4, 0x12, 0x28, 0x45, 0x71, 0xE6, 0xEF, 0x72, 0xF1, 0x5D, 0xCD, 0x11, 0x89, 0x15, 0x19, 0x27,
-    0x26, 0x9A, 0x32, 0xEA, 0x28, 0x81, 0x59, 0xA1, 0x19, 0x63, 0xA7, 0x5A, 0xF7, 0xFD, 0x26, 0x71,
-    0x51, 0x69, 0xAE, 0x59, 0x99, 0xE6, 0x0F, 0x6F, 0xE0, 0x52, 0x3A, 0x14, 0x83, 0xDB, 0x0C, 0x26,
-    0x43, 0x48, 0xF2, 0x43, 0x6E, 0x20, 0xB6, 0x22, 0x0A, 0x12, 0x6E, 0x4D, 0x93, 0x12, 0xF7, 0xB4,
-    0xC4, 0xD6, 0xC3, 0x5C, 0x62, 0xB3, 0xA1, 0x1A, 0xB0, 0x35, 0x1C, 0x1E, 0xC3, 0xC9, 0xC9, 0xBE,
-    0xC2, 0xB9, 0x36, 0x0E, 0xAF, 0x79, 0xFB, 0xC9, 0x89, 0xF9, 0xC0, 0x3A, 0x30, 0x86, 0xCD, 0xE8,
-    0x17, 0x71, 0x3C, 0x6E, 0xC0, 0x04, 0x2F, 0x4F, 0x8C, 0x91, 0x28, 0xEE, 0xE8, 0x7F, 0xD0, 0x1F,
-    0x0C, 0xE1, 0xFB, 0x5F, 0x64, 0x14, 0xEF, 0x25, 0xB2, 0x7C, 0x6E, 0xBE, 0x3D, 0x0D, 0x36, 0x20,
-    0x62, 0x95, 0x31, 0x62, 0xD6, 0x2D, 0x0C, 0xE6, 0x02, 0x80, 0x26, 0x95, 0x03, 0x89, 0x67, 0xEE,
-    0x89, 0x1E, 0x97, 0x6B, 0x0B, 0xB4, 0x08, 0x90, 0x45, 0x04, 0xDC, 0x99, 0x36, 0x3E, 0x85, 0xD6,
-    0xFD, 0xBE, 0x9A, 0xDC, 0xF3, 0xF9, 0x19, 0xB9, 0x07, 0xA3, 0x52, 0x6C, 0x86, 0x2F, 0x96, 0x94,
-    0xA8, 0x2E, 0x3E, 0xAA, 0x84, 0x0F, 0xA9, 0x8C, 0x63, 0x14, 0x7A, 0x9C, 0x01, 0xEF, 0x29, 0x61,
-    0x03, 0xE4, 0x1E, 0x2F, 0x92, 0x7B, 0x7C, 0x92, 0x86, 0x65, 0x9D, 0x8A, 0x81, 0x48, 0x41, 0x6A,
-    0x23, 0xFC, 0x6A, 0x3E, 0xCF, 0x74, 0x66, 0x4F, 0xA2, 0x68, 0x2E, 0x7B, 0x84, 0x45, 0x58, 0xF4,
-    0x87, 0xC3, 0x63, 0x95, 0x04, 0x40, 0x7E, 0x28, 0xD9, 0x93, 0x4A, 0x52, 0x17, 0x0C, 0xB1, 0xA8,
-    0x03, 0x7E, 0xE8, 0xA5, 0xB1, 0xA4, 0x4B, 0x26, 0xD4, 0xBF, 0x30, 0x49, 0x13, 0x22, 0x66, 0xB2,
-    0x0B, 0x6C, 0x42, 0x0F, 0xB8, 0xD0, 0x4D, 0x0F, 0x28, 0xA6, 0x19, 0x04, 0xDF, 0xD3, 0x4C, 0x80,
-    0x7A, 0xAA, 0x4C, 0xEF, 0xF3, 0xE1, 0x38, 0xB9, 0x25, 0x90, 0x8A, 0x99, 0x94, 0x93, 0x30, 0x33,
-    0x88, 0x13, 0x4A, 0x40, 0xDE, 0x52, 0x51, 0x0E, 0x05, 0xF3, 0x2E, 0x8C, 0xD7, 0xBE, 0xD6, 0xE4,
-    0xF4, 0x4A, 0x52, 0xE0, 0x70, 0x89, 0xF0, 0x58, 0x99, 0x5D, 0xEA, 0x50, 0xAE, 0x87, 0x01, 0xC0,
-    0x11, 0xF8, 0x11, 0x42, 0x39, 0x98, 0xB6, 0x36, 0xCD, 0x35, 0x36, 0x30, 0xAC, 0x38, 0x87, 0xF3,
-    0xD1, 0x06, 0x89, 0x15, 0xB7, 0x06, 0x2A, 0x46, 0x67, 0xC5, 0x56, 0x75, 0xC9, 0x3C, 0x58, 0xD8,
-    0xB0, 0x4F, 0x6E, 0x08, 0xC2, 0xB7, 0x32, 0x8C, 0x23, 0x3E, 0x94, 0xB0, 0x4E, 0x1C, 0x63, 0x10,
-    0x21, 0x5E, 0x84, 0x21, 0x28, 0x81, 0xEC, 0x25, 0x37, 0x48, 0xDE, 0x86, 0xB6, 0x4E, 0x8F, 0x2A,
-    0x63, 0xCA, 0x5D, 0x83, 0x3E, 0x5F, 0x1C, 0xBF, 0x53, 0x10, 0x8A, 0xC0, 0x60, 0xEB, 0x81, 0x98,
-    0xEB, 0xE0, 0x7C, 0xE2, 0xE9, 0x61, 0x4B, 0x4C, 0xD9, 0xD9, 0xE0, 0xF3, 0x72, 0x6C, 0x12, 0xB6,
-    0xCF, 0xD2, 0x38, 0x71, 0x43, 0xDA, 0x96, 0x80, 0xBA, 0x92, 0xEB, 0x6A, 0x31, 0x69, 0xE2, 0x29,
-    0xA3, 0x87, 0xA5, 0x01, 0xAF, 0x02, 0xBC, 0x05, 0x11, 0x0C, 0xF8, 0xCC, 0x8C, 0x5E, 0x71, 0x0E,
-    0x6B, 0x01, 0x6E, 0xF1, 0x33, 0x3B, 0xB5, 0x53, 0x37, 0x62, 0x20, 0xC8, 0x88, 0x9C, 0xDB, 0xE4,
-    0x81, 0x2C, 0xE6, 0x9D, 0x7B, 0x20, 0x64, 0x04, 0xB6, 0xFC, 0xE3, 0x93, 0xDB, 0xC7, 0x57, 0x3A,
-    0xBD, 0xA1, 0x9F, 0xFB, 0x99, 0x37, 0x1E, 0x65, 0x89, 0xA6, 0x49, 0x11, 0x18, 0xD2, 0x9F, 0xBB,
-    0xBB, 0x5A, 0x12, 0x04, 0x80, 0x32, 0x64, 0x02, 0x5F, 0x5E, 0x1B, 0x29, 0x17, 0xE1, 0xA7, 0x57,
-    0x78, 0x49, 0x00, 0x4E, 0x07, 0x10, 0xCE, 0x1E, 0xD4, 0xB3, 0x8B, 0x5F, 0x06, 0x77, 0xD4, 0x08,
-    0x28, 0x72, 0x48, 0x39, 0x0D, 0xC0, 0x28, 0x0F, 0xF0, 0xCE, 0x26, 0xBE, 0x5A, 0x1E, 0x1B, 0x91,
-    0xD0, 0xB9, 0x01, 0x76, 0xB4, 0x01, 0xB4, 0x4F, 0x27, 0xF6, 0x79, 0x2C, 0xB4, 0x58, 0x4F, 0x7B,
-    0xF5, 0xD0, 0x0F, 0xDD, 0xF7, 0x13, 0xE3, 0x4B, 0x28, 0x7F, 0x5F, 0xB5, 0x01, 0x9D, 0xAC, 0x11,
-    0x3C, 0xDF, 0x70, 0x12, 0xE4, 0xF4, 0x0A, 0xAB, 0xAE, 0xDC, 0x68, 0xFB, 0x3B, 0x5C, 0x50, 0x57,
-    0x9C, 0x55, 0x86, 0x90, 0xCB, 0x2E, 0x28, 0x46, 0x81, 0x5A, 0x08, 0xD4, 0x93, 0x41, 0xD8, 0xF7,
-    0x99, 0xA7, 0x0F, 0x39, 0x17, 0x50, 0x16, 0xF4, 0xCD, 0x82, 0xFB, 0xFC, 0x91, 0xE4, 0xB5, 0x12,
-    0xA5, 0x41, 0x32, 0x09, 0x72, 0x2E, 0x33, 0x9B, 0x6F, 0x15, 0x5E, 0x06, 0x55, 0x86, 0x53, 0xFF,
-    0x6D, 0xA6, 0x5A, 0x58, 0x3F, 0xA0, 0x2E, 0xE6, 0x76, 0x5F, 0x4F, 0x8C, 0x1C, 0xEF, 0x53, 0x00,
-    0x7A, 0x66, 0xC1, 0x0D, 0x71, 0x46, 0x53, 0x0E, 0x97, 0x6A, 0x7B, 0x68, 0x65, 0x6D, 0x27, 0xC2,
-    0x17, 0xBB, 0x6D, 0xA3, 0x6C, 0x21, 0x32, 0x04, 0x50, 0x28, 0x10, 0xF6, 0x69, 0x80, 0xFA, 0xCC,
-    0xC6, 0x52, 0x01, 0x10, 0xC1, 0x7C, 0xE5, 0xC4, 0x12, 0x38, 0x85, 0x99, 0x9A, 0x95, 0x55, 0x27,
-    0xAB, 0xAA, 0x4E, 0xFF, 0x6E, 0x60, 0x27, 0xED, 0x9F, 0x3D, 0x66, 0x65, 0x25, 0xA0, 0xB2, 0x5A,
-    0x09, 0x0E, 0x43, 0xAA, 0x8D, 0xCB, 0x39, 0xAD, 0xD5, 0xCA, 0x27, 0xD4, 0x09, 0x73, 0xF7, 0x4B,
-    0xC1, 0x28, 0x2B, 0xF4, 0xB8, 0xF6, 0x4E, 0xC5, 0x17, 0x79, 0x40, 0x08, 0x71, 0xD0, 0x4A, 0x0B,
-    0x7B, 0xE9, 0xC5, 0xA8, 0xE3, 0x9E, 0xCF, 0xEB, 0xCC, 0x09, 0xE3, 0x0A, 0x61, 0x52, 0x6E, 0x0D,
-    0x67, 0x75, 0x9A, 0x8C, 0x1A, 0x22, 0x72, 0xF8, 0x2E, 0xDD, 0x65, 0x9B, 0x2B, 0xFA, 0x57, 0x19,
-    0xC2, 0x51, 0xC5, 0xEC, 0x79, 0x77, 0x59, 0x75, 0xCF, 0xA9, 0x3E, 0xF0, 0x58, 0x5C, 0x67, 0x3E,
-    0x18, 0xA5, 0x57, 0x08, 0xB0, 0xD2, 0xC1, 0x1D, 0x90, 0x42, 0xA3, 0xB0, 0x72, 0x46, 0x16, 0x66,
-    0x6E, 0xA5, 0x56, 0xE6, 0x24, 0x56, 0x0A, 0x5D, 0x01, 0xA4, 0x27, 0xBC, 0x80, 0xEE, 0x23, 0xA2,
-    0xF5, 0x8D, 0x2B, 0x3F, 0x09, 0x9E, 0x7B, 0xFF, 0x6F, 0xFD, 0xDA, 0xAD, 0x5C, 0xE0, 0x92, 0x99,
-    0x20, 0xF4, 0x3B, 0xCA, 0x51, 0x07, 0x60, 0xC3, 0x81, 0xF3, 0x0F, 0x41, 0xD5, 0xA1, 0x91, 0xE6,
-    0xEE, 0xD4, 0xD4, 0x3C, 0x80, 0x39, 0xE2, 0xC8, 0x7B, 0x6F, 0x64, 0xD4, 0x61, 0xE9, 0xFD, 0xCA,
-    0xFA, 0x00, 0x33, 0x80, 0x25, 0x1D, 0xA8, 0xD4, 0x15, 0xA8, 0x11, 0x82, 0xEF, 0xA0, 0x0F, 0x23,
-    0x0A, 0x97, 0x7F, 0x3E, 0x57, 0xBE, 0x95, 0xBD, 0x54, 0xBA, 0x17, 0x4F, 0xA7, 0x6E, 0xE5, 0xE9,
-    0xEA, 0xD2, 0x84, 0x3B, 0xA5, 0x46, 0x5B, 0xAC, 0x13, 0x28, 0xC2, 0x95, 0x83, 0x8C, 0x2F, 0x98,
-    0x18, 0x38, 0x09, 0x45, 0x74, 0xA8, 0xF9, 0x8C, 0x67, 0x9E, 0x82, 0xEB, 0xB2, 0x52, 0xB8, 0xA3,
-    0x8E, 0x99, 0x5F, 0xB8, 0x1A, 0xF9, 0x9D, 0x00, 0xB6, 0xE2, 0x08, 0xD4, 0x3E, 0x59, 0x98, 0x89,
-    0xA0, 0x18, 0x1E, 0x30, 0x56, 0x81, 0x55, 0xAD, 0x95, 0x9F, 0xA9, 0xC7, 0x0A, 0xEB, 0x6F, 0x94,
-    0x71, 0x31, 0xFA, 0x32, 0x55, 0x07, 0x3A, 0x4F, 0xAD, 0x2A, 0x73, 0x67, 0xE7, 0xDD, 0x44, 0xAD,
-    0xAE, 0x9E, 0xD8, 0x52, 0xD6, 0xE9, 0xF7, 0x9D, 0x48, 0x9D, 0x68, 0xA7, 0x85, 0x72, 0xAD, 0x0A,
-    0x0B, 0xCF, 0x82, 0x30, 0xDF, 0xEC, 0x22, 0x92, 0x1D, 0xD4, 0x98, 0xBD, 0x7E, 0x2D, 0x37, 0x42,
-    0x77, 0x26, 0xF1, 0x06, 0x76, 0x9D, 0xD3, 0xEC, 0x52, 0x05, 0x00, 0x79, 0xCE, 0xE4, 0x8C, 0x9D,
-    0x80, 0x5D, 0x1F, 0x1D, 0xCB, 0x10, 0xFF, 0xA7, 0xEE, 0x7F, 0x7E, 0x11, 0x2C, 0x73, 0xC0, 0x32,
-    0x17, 0x2C, 0x73, 0x9F, 0x83, 0x31, 0xD9, 0x6E, 0x41, 0x3A, 0x3B, 0xCA, 0xCD, 0xA6, 0xF6, 0x07,
-    0x00, 0x1F, 0x2E, 0xE9, 0x10, 0xC2, 0x17, 0xE7, 0x83, 0x42, 0x6D, 0xC0, 0x9A, 0x5E, 0x4E, 0x55,
-    0x17, 0x58, 0xE5, 0x22, 0x44, 0xBD, 0xA2, 0xA8, 0x9B, 0xC5, 0x40, 0x6D, 0xD8, 0x39, 0x74, 0x19,
-    0x7A, 0xCA, 0x30, 0xBD, 0x61, 0x35, 0x4C, 0x42, 0x16, 0xE7, 0x71, 0x61, 0xFD, 0xE6, 0xAB, 0xC2,
-    0xBA, 0x78, 0xAA, 0xB0, 0xFE, 0x11, 0x11, 0x68, 0x65, 0xE6, 0x0E, 0x36, 0xCE, 0xCD, 0xB8, 0x65,
-    0x76, 0xE2, 0x45, 0x93, 0xF9, 0xFF, 0x70, 0x3A, 0xBF, 0x97, 0xCE, 0x30, 0xC8, 0xC9, 0xCD, 0xFA,
-    0x55, 0x08, 0x42, 0x79, 0x0D, 0xB3, 0x75, 0x60, 0x97, 0x99, 0x37, 0xF2, 0x60, 0x9A, 0x60, 0x3B,
-    0x3B, 0x82, 0x07, 0xAC, 0x5C, 0xAC, 0x21, 0x8B, 0x75, 0x16, 0x1D, 0x3F, 0xDC, 0x49, 0x8A, 0x28,
-    0x9A, 0x56, 0xD3, 0xC3, 0x7A, 0xCC, 0x7C, 0x99, 0x79, 0x28, 0x25, 0x99, 0x28, 0xC1, 0x6B, 0x8C,
-    0x40, 0x2C, 0xA2, 0x92, 0x3F, 0xDD, 0x9C, 0xEA, 0x64, 0x5D, 0x59, 0xD7, 0x3A, 0x8C, 0x9D, 0x44,
-    0xE4, 0x5B, 0xE2, 0xFB, 0x25, 0xC7, 0x28, 0x49, 0x63, 0xF5, 0xA3, 0xDE, 0x8F, 0x73, 0x38, 0x61,
-    0x77, 0x6A, 0x4E, 0x48, 0x60, 0xEA, 0x90, 0xC4, 0x1C, 0x0A, 0xF3, 0x9B, 0xAF, 0xBF, 0x20, 0x99,
-    0xAF, 0x5C, 0x7E, 0x07, 0x84, 0x9A, 0x57, 0x49, 0xAA, 0xA5, 0x89, 0x2D, 0x48, 0xAE, 0x9D, 0x8B,
-    0x8C, 0xA6, 0x24, 0x99, 0xB2, 0x0A, 0xA2, 0x43, 0x92, 0xED, 0x09, 0xE1, 0xF8, 0x7F, 0x03, 0x08,
-    0x5C, 0xF9, 0x20, 0xBE, 0x35, 0x4B, 0x3E, 0xAC, 0x29, 0x81, 0x01, 0x42, 0xA0, 0x0C, 0x6B, 0x68,
-    0xD3, 0x97, 0xB0, 0x0E, 0x87, 0x00, 0x02, 0x5B, 0x89, 0x21, 0xB6, 0x10, 0x14, 0xBB, 0x4D, 0x8E,
-    0x7E, 0x0B, 0x6B, 0x76, 0x5E, 0x85, 0xA4, 0x9E, 0x24, 0x24, 0xF8, 0x1B, 0x11, 0x76, 0xBC, 0x33,
-    0x76, 0xC7, 0x74, 0xC5, 0xE0, 0x80, 0x41, 0x94, 0xD0, 0x63, 0x41, 0x90, 0x16, 0x69, 0x65, 0x36,
-    0x9A, 0x67, 0x16, 0xE1, 0x06, 0x07, 0xFA, 0x9E, 0x8E, 0x36, 0x68, 0xAF, 0x27, 0x8C, 0x5B, 0xAA,
-    0x2F, 0x89, 0x23, 0xB2, 0x76, 0x3B, 0xEB, 0x49, 0xE5, 0x24, 0x03, 0x5F, 0x6D, 0xC1, 0xEA, 0xB9,
-    0x21, 0x62, 0x95, 0xC2, 0xBA, 0x91, 0xB8, 0xAA, 0x5D, 0x41, 0xC6, 0x3E, 0x01, 0x65, 0x9D, 0xBE,
-    0x99, 0xB9, 0xAF, 0x66, 0xF0, 0x3B, 0xC1, 0xE9, 0x0F, 0x2B, 0x45, 0x90, 0x65, 0x48, 0xD4, 0xD5,
-    0x19, 0xD7, 0x24, 0xB0, 0x84, 0x65, 0xCC, 0x60, 0xBF, 0x9A, 0xD2, 0xD8, 0x28, 0xC9, 0xBD, 0x37,
-    0x8B, 0xC8, 0x8C, 0xCA, 0x66, 0x0E, 0xEE, 0x8F, 0x4B, 0xEF, 0xBF, 0x2A, 0x77, 0x07, 0x37, 0x74,
-    0xB7, 0xB8, 0x5B, 0xE4, 0x77, 0xD2, 0xDC, 0x19, 0x24, 0x7A, 0xB5, 0x34, 0xF5, 0x6A, 0xD5, 0x57,
-    0xE6, 0xF1, 0x43, 0xBB, 0x2F, 0x05, 0x10, 0x6A, 0x0B, 0x30, 0x20, 0x9C, 0xA8, 0x97, 0x03, 0xD7,
-    0xE1, 0xD4, 0x92, 0x8E, 0x85, 0xB4, 0xC0, 0x60, 0x40, 0x4C, 0xFA, 0x4A, 0xF8, 0x4C, 0xEE, 0x27,
-    0xB4, 0x1B, 0xB4, 0x23, 0x30, 0xEE, 0x7D, 0x04, 0xA8, 0x30, 0x19, 0xCF, 0xBB, 0x1F, 0x7E, 0x79,
-    0xF5, 0x70, 0x9D, 0xD7, 0x49, 0x90, 0xAD, 0xBC, 0x2D, 0x79, 0x4E, 0x26, 0x48, 0x34, 0x07, 0xC4,
-    0x7D, 0x15, 0x93, 0xE2, 0x04, 0x94, 0xF5, 0x6D, 0xB0, 0x83, 0x75, 0x2A, 0x08, 0xB3, 0x85, 0x9D,
-    0xB5, 0x69, 0x83, 0xE8, 0xF3, 0x23, 0xFB, 0xAB, 0x1A, 0xE1, 0xD3, 0x27, 0xA1, 0x7A, 0xC1, 0x6B,
-    0x42, 0xC6, 0x36, 0x20, 0x63, 0x9B, 0x98, 0x34, 0xD7, 0x05, 0x8F, 0xF1, 0x22, 0x63, 0x7E, 0xEB,
-    0x35, 0xB8, 0x29, 0x48, 0x6D, 0x9F, 0xBA, 0x4A, 0xCC, 0x01, 0x40, 0x08, 0xD1, 0x68, 0x63, 0xA9,
-    0x5B, 0xAA, 0xA0, 0x8D, 0xB3, 0xF1, 0x86, 0x27, 0xFB, 0x5E, 0x31, 0x68, 0xB4, 0x33, 0x37, 0x75,
-    0x10, 0xA6, 0xF5, 0x10, 0x5D, 0x0D, 0xED, 0xCE, 0x0F, 0xAB, 0x4E, 0x79, 0xF2, 0xEB, 0x0F, 0xEB,
-    0x0B, 0xF5, 0xCE, 0xC8, 0xAE, 0xEC, 0xD2, 0x4D, 0x8D, 0x19, 0x0C, 0xF1, 0x20, 0x66, 0x78, 0x56,
-    0x66, 0x38, 0xCF, 0x19, 0x6A, 0x99, 0xA1, 0x23, 0x33, 0x48, 0xD6, 0xC5, 0x92, 0x50, 0xCC, 0x95,
-    0xB9, 0xB6, 0xD4, 0x18, 0xF4, 0xEA, 0xAA, 0x08, 0xE0, 0x4B, 0xDE, 0xAB, 0x6B, 0x8A, 0x3A, 0xE6,
-    0x70, 0xC2, 0x5C, 0x38, 0xEA, 0xD6, 0x99, 0x71, 0x3D, 0x86, 0xC9, 0xEA, 0x5B, 0x09, 0x3D, 0x7E,
-    0x87, 0x8C, 0x6B, 0xC1, 0xA6, 0x5F, 0x1F, 0xE2, 0xB3, 0xA6, 0x5E, 0x80, 0x9F, 0x75, 0x30, 0xFD,
-    0x1C, 0x31, 0x51, 0x41, 0xB9, 0xA5, 0xC0, 0x9B, 0xB9, 0xA0, 0x7F, 0xF7, 0x3F, 0x21, 0x90, 0x72,
-    0x6B, 0xBC, 0xED, 0x7D, 0x36, 0x24, 0x3E, 0xD9, 0x70, 0x92, 0x15, 0x04, 0xB0, 0x51, 0x4B, 0xB5,
-    0x5C, 0x04, 0xF0, 0x1D, 0xEF, 0x0F, 0x03, 0xA3, 0xF4, 0xBA, 0xDE, 0x95, 0xCC, 0x2F, 0xE1, 0xCC,
-    0xA1, 0x50, 0x4D, 0x41, 0x69, 0x69, 0x28, 0x65, 0x5F, 0xAC, 0x99, 0xBB, 0x89, 0xE5, 0xB6, 0x9E,
-    0x00, 0xBC, 0x28, 0xED, 0xDD, 0xF8, 0x30, 0xB6, 0xB1, 0x50, 0x25, 0xE3, 0xE0, 0xD0, 0x3D, 0x92,
-    0xB9, 0x51, 0x7C, 0x36, 0x21, 0x0E, 0x68, 0xAA, 0x3B, 0xFB, 0x87, 0x84, 0x8A, 0xFE, 0xA1, 0xEA,
-    0x31, 0x2A, 0x12, 0x31, 0x40, 0xA9, 0xD6, 0x58, 0xD5, 0x8F, 0x16, 0x8F, 0xA5, 0x3A, 0x6A, 0x3C,
-    0xA9, 0xBA, 0x58, 0x89, 0x3D, 0x1A, 0x11, 0xD2, 0x4D, 0x8C, 0x04, 0x84, 0xD0, 0x19, 0x42, 0x0A,
-    0xF1, 0x6D, 0x80, 0xDC, 0x53, 0x80, 0x92, 0xC0, 0xD4, 0x21, 0x10, 0x37, 0x28, 0x07, 0x31, 0x85,
-    0x7F, 0x0C, 0xC8, 0xC1, 0x25, 0xCC, 0x3D, 0xF2, 0x29, 0x6E, 0x7D, 0xA7, 0xF0, 0x59, 0xAE, 0x62,
-    0x84, 0xE2, 0x1B, 0x85, 0x51, 0xBA, 0x11, 0x28, 0x01, 0xEB, 0x6A, 0xE6, 0x0A, 0x24, 0x07, 0x2A,
-    0x3B, 0x6B, 0x20, 0xF6, 0x73, 0x19, 0x7C, 0x84, 0x25, 0xB4, 0x8A, 0xC9, 0x84, 0x9C, 0xA5, 0x44,
-    0xB5, 0xCD, 0x32, 0x3D, 0x6C, 0xB6, 0x73, 0x05, 0xD6, 0xE1, 0x27, 0x88, 0x84, 0x31, 0x45, 0xC7,
-    0xFD, 0xF3, 0x7F, 0x53, 0xBA, 0xDB, 0x41, 0xEE, 0x96, 0x41, 0xE4, 0xA6, 0x63, 0xC9, 0x3B, 0xA0,
-    0x13, 0x5D, 0x92, 0x29, 0x22, 0x3D, 0x6F, 0xDE, 0x23, 0x3C, 0x79, 0xDC, 0x40, 0x1C, 0x51, 0xA9,
-    0xA1, 0x97, 0x38, 0xE1, 0x6C, 0x27, 0x85, 0x01, 0xC4, 0xB6, 0x3D, 0x04, 0xFA, 0xCC, 0x30, 0x12,
-    0x73, 0x8F, 0x6D, 0x12, 0xB2, 0xAD, 0xBA, 0xCC, 0x3C, 0x87, 0x1C, 0x8C, 0x82, 0x82, 0xD1, 0xEC,
-    0x6C, 0x1D, 0x31, 0x4F, 0x6A, 0x70, 0xA7, 0xC9, 0xB5, 0x27, 0x94, 0xE4, 0x6C, 0xFF, 0x2C, 0xD7,
-    0xF1, 0x44, 0x7B, 0x31, 0x44, 0xE4, 0xAD, 0xFE, 0xEC, 0xF3, 0xB7, 0x44, 0x91, 0x08, 0x70, 0xD3,
-    0x75, 0x51, 0xEC, 0xCE, 0x68, 0x68, 0x5E, 0x39, 0x55, 0xB8, 0x85, 0x9D, 0x81, 0xB0, 0x53, 0x08,
-    0x2E, 0x1C, 0x84, 0x78, 0x08, 0xAD, 0xD3, 0x52, 0xF9, 0x8C, 0xAD, 0xC8, 0xCA, 0x3E, 0x18, 0x9B,
-    0x49, 0xB5, 0x3C, 0xD3, 0x9A, 0x58, 0xC0, 0xF4, 0x44, 0xC6, 0xB5, 0x4A, 0x20, 0xE5, 0xD2, 0xA5,
-    0xA6, 0x58, 0x6A, 0x4B, 0x54, 0x69, 0x09, 0xBA, 0xA6, 0x5C, 0x3F, 0x3D, 0x41, 0x6B, 0x8C, 0xF0,
-    0x92, 0xB6, 0x59, 0x0A, 0x6A, 0x04, 0x9C, 0x87, 0x67, 0xE9, 0x85, 0x80, 0x8D, 0x46, 0xD5, 0x94,
-    0x0C, 0x97, 0xDB, 0xEA, 0x00, 0x1C, 0x0E, 0x02, 0x01, 0xE5, 0x0F, 0x27, 0x20, 0xD5, 0x23, 0xAC,
-    0xB7, 0xAE, 0xFD, 0x1C, 0xF6, 0xCE, 0x13, 0x77, 0xD2, 0xDE, 0x4C, 0x7A, 0x75, 0x32, 0xE3, 0x51,
-    0x0E, 0xF4, 0x0E, 0x97, 0xA0, 0xDB, 0x9D, 0xA0, 0x3C, 0xED, 0x84, 0x32, 0xA8, 0x83, 0xE4, 0x1C,
-    0xE1, 0xB9, 0x98, 0xAE, 0x4A, 0x88, 0x52, 0x65, 0x61, 0x27, 0x8C, 0x7C, 0xDB, 0xCA, 0x30, 0x88,
-    0x37, 0x96, 0x2F, 0xB6, 0x12, 0xC0, 0x0D, 0x3E, 0xD3, 0xAC, 0x75, 0x7F, 0x8E, 0x4F, 0x3C, 0x7A,
-    0xC4, 0x4C, 0xAA, 0x45, 0x2C, 0x0C, 0xD3, 0xF2, 0xA9, 0xF2, 0xE5, 0x76, 0xDF, 0xAB, 0xAC, 0x52,
-    0x52, 0x87, 0xCB, 0x81, 0xF5, 0x45, 0xE5, 0x9F, 0x4E, 0x4E, 0x4E, 0x5C, 0x4C, 0x45, 0x23, 0x6C,
-    0x4B, 0xDE, 0xA4, 0x94, 0x44, 0x9F, 0xE4, 0x40, 0x24, 0x81, 0xDA, 0x57, 0xD6, 0xAF, 0x13, 0xF7,
-    0xAC, 0xEA, 0xE5, 0x6A, 0x34, 0x9B, 0x79, 0xCE, 0xB5, 0x39, 0x66, 0x0E, 0xF6, 0xCD, 0xB9, 0x78,
-    0x10, 0x61, 0x90, 0x5D, 0xAB, 0xB9, 0xFE, 0x84, 0x96, 0xB6, 0x9D, 0x8E, 0xEE, 0x67, 0xA0, 0xF1,
-    0x67, 0xB6, 0xCB, 0xD7, 0x7E, 0x89, 0x96, 0xD5, 0x9B, 0xFE, 0xE9, 0x2B, 0x23, 0x02, 0xBE, 0x69,
-    0x32, 0xCA, 0x3F, 0x9F, 0x09, 0x84, 0xE3, 0x72, 0x92, 0xE5, 0x3A, 0x25, 0x70, 0xB6, 0x2D, 0x68,
-    0x96, 0x11, 0x67, 0x42, 0xC7, 0x72, 0xD2, 0xB9, 0xCA, 0xF8, 0x9B, 0x51, 0x5C, 0xEE, 0x86, 0x03,
-    0xE5, 0x11, 0xF1, 0x10, 0x80, 0xB5, 0x88, 0xC0, 0xEC, 0x9D, 0xAB, 0x91, 0x17, 0x96, 0x30, 0xBF,
-    0xA3, 0xD8, 0x62, 0x92, 0x25, 0x5A, 0x98, 0x06, 0x5A, 0x71, 0xE2, 0x00, 0xE9, 0x73, 0x9D, 0x7D,
-    0x2C, 0x94, 0x80, 0x52, 0xD1, 0x8C, 0x88, 0x66, 0x21, 0x6A, 0xBF, 0x4A, 0xB8, 0x54, 0xE7, 0xED,
-    0xB5, 0xD2, 0xCE, 0xE8, 0xCC, 0x5F, 0x05, 0x6C, 0x6A, 0xFB, 0x6C, 0x5E, 0x40, 0x40, 0xE7, 0xEC,
-    0xA4, 0xE6, 0x08, 0x10, 0x51, 0x3A, 0x49, 0xB8, 0xF9, 0x4F, 0x28, 0x49, 0x81, 0x8B, 0xFC, 0x4A,
-    0x12, 0x00, 0x02, 0x6C, 0xB2, 0x99, 0x88, 0x12, 0x6C, 0x8E, 0xBB, 0x28, 0x5A, 0x8C, 0x3E, 0x20,
-    0x81, 0xF6, 0xBB, 0x57, 0x32, 0xF3, 0x72, 0x52, 0xAA, 0xAF, 0x61, 0x0F, 0x03, 0x38, 0x4F, 0x40,
-    0x8A, 0x84, 0x08, 0x09, 0xCC, 0x63, 0x09, 0x91, 0x79, 0x79, 0xFF, 0x49, 0xF8, 0xAB, 0xAB, 0xD8,
-    0xD5, 0x1A, 0x7B, 0x32, 0x6A, 0x8A, 0xFB, 0x86, 0x76, 0x2C, 0x46, 0x13, 0x98, 0xD0, 0xA1, 0x47,
-    0xC4, 0xCF, 0x13, 0x76, 0xDD, 0x2F, 0xD0, 0xB5, 0xC3, 0x26, 0x92, 0xCE, 0x9A, 0x32, 0x5A, 0x7F,
-    0x9A, 0xF8, 0x78, 0x70, 0x80, 0x9F, 0x2B, 0x7E, 0xDB, 0x4C, 0x04, 0xF2, 0x9B, 0x85, 0xA7, 0x04,
-    0xF3, 0x2B, 0xFF, 0xCC, 0x23, 0x07, 0x40, 0xF7, 0x4E, 0xCF, 0x6B, 0x99, 0x3A, 0xC4, 0xD2, 0x4E,
-    0xA2, 0x7D, 0x21, 0xB7, 0x21, 0x68, 0x1C, 0xE0, 0xBF, 0xD8, 0x8C, 0x74, 0x52, 0xDB, 0x6C, 0x52,
-    0xC7, 0xFB, 0x7E, 0x79, 0x7D, 0xD3, 0xA0, 0x30, 0xF9, 0x6F, 0x7C, 0xBA, 0x6E, 0x25, 0x5D, 0x23,
-    0x5B, 0x75, 0x92, 0x03, 0x46, 0x58, 0x8D, 0xFD, 0xE6, 0xEE, 0x0B, 0x4D, 0xB2, 0xE8, 0xFA, 0xD9,
-    0x26, 0x59, 0xA4, 0xE9, 0x66, 0x2C, 0x8E, 0x3F, 0x74, 0xB2, 0xC8, 0x60, 0xD2, 0x76, 0x9B, 0xC9,
-    0xA2, 0x28, 0x90, 0xF4, 0x83, 0x9A, 0x22, 0xD2, 0x04, 0x81, 0x5A, 0x0C, 0x83, 0xF1, 0xDB, 0xCB,
-    0xB8, 0x5C, 0x3C, 0x02, 0x3B, 0xF2, 0x7F, 0xB1, 0x2A, 0xBB, 0x64, 0x68, 0x92, 0x43, 0x45, 0xDC,
-    0x14, 0x7E, 0x03, 0x83, 0x84, 0x03, 0x0F, 0x0E, 0xBF, 0xE5, 0xB1, 0xAC, 0xEB, 0x63, 0x69, 0x1D,
-    0xE6, 0x12, 0xE0, 0xFE, 0xDC, 0x2B, 0x08, 0x23, 0xAD, 0xB1, 0x30, 0x4B, 0x45, 0xC3, 0xB8, 0xAB,
-    0x8A, 0x46, 0x5F, 0x6A, 0x58, 0xCC, 0xA6, 0x55, 0xDB, 0x9B, 0x9B, 0x9B, 0xAC, 0x68, 0x28, 0x5D,
-    0xD1, 0xA8, 0xEE, 0xA6, 0xA2, 0x31, 0xF6, 0x1A, 0x71, 0x4A, 0xA7, 0x1A, 0x84, 0x03, 0x30, 0xFE,
-    0xD7, 0x60, 0x41, 0x5B, 0x99, 0x5F, 0x7E, 0xBA, 0xD6, 0xC3, 0xB8, 0x57, 0x3E, 0x5A, 0xEB, 0x96,
-    0xCA, 0x79, 0x1F, 0xA1, 0x00, 0x4C, 0x1B, 0x10, 0x8A, 0x0E, 0x38, 0xCA, 0x89, 0xC9, 0xFD, 0x03,
-    0x0F, 0xC3, 0x05, 0xE7, 0x79, 0xC9, 0x61, 0xA5, 0xFD, 0x5F, 0xD9, 0x62, 0xC2, 0x98, 0x61, 0xD2,
-    0x09, 0x57, 0x37, 0x91, 0x5A, 0x06, 0x8D, 0x51, 0x5F, 0xE7, 0x43, 0x3A, 0x14, 0x09, 0x49, 0x4F,
-    0x48, 0xEE, 0x5D, 0xFA, 0x5D, 0x76, 0xB8, 0x99, 0xBF, 0x63, 0x08, 0xD4, 0xA1, 0xE8, 0x78, 0x04,
-    0x35, 0x96, 0xE4, 0x07, 0x47, 0xD3, 0xB4, 0xEF, 0xC4, 0xCB, 0x41, 0x99, 0x2A, 0xC8, 0x4D, 0x90,
-    0xC0, 0xD8, 0xFE, 0x03, 0x13, 0xEA, 0x60, 0x68, 0x87, 0xC5, 0x37, 0x8C, 0xC4, 0xB0, 0xBC, 0x80,
-    0x99, 0x75, 0x9F, 0xC7, 0x9D, 0x5F, 0xB1, 0x17, 0x8B, 0x86, 0x8A, 0xD6, 0x51, 0x22, 0xAC, 0x6A,
-    0x26, 0xA3, 0xF8, 0x7B, 0x59, 0x01, 0x15, 0xA0, 0x27, 0xE5, 0x9C, 0xA6, 0xBD, 0xC3, 0xCC, 0x67,
-    0xFA, 0x41, 0xF4, 0xF5, 0x47, 0xD3, 0xDC, 0xAF, 0xD6, 0xF4, 0x8E, 0x91, 0x49, 0x70, 0x2F, 0x7D,
-    0x44, 0x33, 0x8A, 0xBE, 0x6F, 0x16, 0xAD, 0x5B, 0x37, 0xA1, 0xF5, 0x68, 0x0E, 0xAD, 0x8F, 0x88,
-    0xD6, 0x9F, 0x03, 0x5A, 0xBF, 0x72, 0x1E, 0x68, 0x3D, 0x0B, 0x32, 0xBF, 0x50, 0xA1, 0xC4, 0x17,
-    0x07, 0x1B, 0x30, 0xEA, 0x36, 0x26, 0xEC, 0xB6, 0x79, 0xCA, 0x1E, 0xD8, 0x25, 0x0D, 0x67, 0xF7,
-    0x99, 0xA7, 0x34, 0xFE, 0x44, 0xD4, 0xE5, 0xC5, 0x74, 0x02, 0x29, 0xF1, 0x9A, 0x51, 0x8F, 0xF8,
-    0xB3, 0x5C, 0xA2, 0x9E, 0x95, 0x27, 0x88, 0xD6, 0xAC, 0xDD, 0xF8, 0x14, 0xD0, 0x77, 0x5F, 0x75,
-    0x56, 0x94, 0xEF, 0x46, 0xEE, 0x2B, 0x18, 0xBD, 0x77, 0x36, 0x25, 0x0E, 0x59, 0x50, 0x77, 0x51,
-    0x51, 0x5B, 0x46, 0xDC, 0xFB, 0x3C, 0x2B, 0x6A, 0xBF, 0x28, 0x08, 0xCB, 0xB9, 0x58, 0x90, 0x31,
-    0xC2, 0x36, 0x03, 0x5A, 0x83, 0x57, 0x7B, 0x9B, 0x5B, 0xF6, 0x54, 0xD4, 0xEE, 0x26, 0x9A, 0x0E,
-    0xC7, 0xD1, 0xF4, 0x93, 0x88, 0xA6, 0xDF, 0xF9, 0x2D, 0xA2, 0x69, 0x17, 0x26, 0x27, 0x8D, 0xC7,
-    0xD1, 0xF4, 0x90, 0xD1, 0x74, 0x0E, 0xAB, 0xE9, 0xDC, 0x29, 0x9A, 0x7E, 0x66, 0xDC, 0x08, 0x44,
-    0x5B, 0x88, 0x7B, 0xD8, 0xFB, 0x3A, 0x6E, 0x28, 0x9D, 0xED, 0x10, 0xBD, 0xB9, 0x33, 0xE5, 0x1B,
-    0x37, 0x94, 0xE6, 0xBA, 0x73, 0x43, 0x63, 0x08, 0xBC, 0x78, 0x0A, 0xF3, 0xC0, 0x2E, 0x48, 0x2B,
-    0x1F, 0xBF, 0xB9, 0xA2, 0x87, 0x6B, 0x69, 0xDB, 0xDC, 0xD1, 0xD0, 0x63, 0x4B, 0x82, 0xBA, 0x7F,
-    0x97, 0x4B, 0x56, 0xAE, 0x17, 0x4D, 0xC1, 0xFA, 0x6D, 0xBB, 0x6D, 0x4A, 0xC0, 0x65, 0x7B, 0xAE,
-    0xDB, 0x86, 0x29, 0x67, 0xD9, 0xAD, 0x6F, 0xD8, 0x6D, 0x33, 0x9F, 0x84, 0x34, 0xDF, 0x29, 0x59,
-    0xCA, 0x8B, 0x09, 0x46, 0xDD, 0x57, 0x92, 0x5B, 0x24, 0x21, 0xEF, 0xD4, 0xCA, 0x14, 0xCD, 0xEE,
-    0xF6, 0x17, 0x9B, 0x21, 0xDB, 0x6A, 0x94, 0x35, 0x3A, 0x5B, 0x42, 0x61, 0x7D, 0xA6, 0xB0, 0x87,
-    0x24, 0x22, 0x95, 0x02, 0x13, 0x2C, 0x67, 0x8A, 0xFB, 0x06, 0xA0, 0xC8, 0x3D, 0x8F, 0xDD, 0xAA,
-    0x62, 0x29, 0xB0, 0x6B, 0xC5, 0x05, 0x09, 0x11, 0x3C, 0x87, 0x77, 0x36, 0x87, 0xB1, 0xC7, 0x88,
-    0xCE, 0x25, 0xE9, 0x82, 0x3E, 0x52, 0x23, 0xC6, 0xCA, 0x3D, 0xAC, 0x14, 0x11, 0xEE, 0x02, 0xB9,
-    0x47, 0x12, 0x87, 0x71, 0xCA, 0xF6, 0x91, 0xD1, 0x4F, 0x81, 0x17, 0xDC, 0x0F, 0x73, 0x35, 0x80,
-    0x77, 0xBA, 0x80, 0xA5, 0xAD, 0xCA, 0xA7, 0x95, 0xF0, 0x16, 0x46, 0x16, 0x83, 0x0E, 0xD6, 0xA5,
-    0xC9, 0x84, 0x4A, 0xFE, 0xFF, 0x6B, 0x87, 0xCD, 0xA8, 0xE9, 0xB0, 0xA9, 0x35, 0xAF, 0x8D, 0xBD,
-    0x75, 0x20, 0x35, 0x5F, 0x07, 0x6A, 0x32, 0x33, 0xB6, 0x7A, 0x18, 0x69, 0x59, 0x67, 0x36, 0x2D,
-    0x3B, 0xD4, 0x69, 0x59, 0x3D, 0xE1, 0xCA, 0x6C, 0x15, 0x4A, 0xBF, 0x10, 0xF5, 0xD3, 0x85, 0x10,
-    0x01, 0x84, 0x0F, 0xA4, 0x2F, 0xA8, 0x98, 0xF4, 0x05, 0x75, 0x75, 0x21, 0x13, 0x04, 0xDB, 0xEB,
-    0x90, 0x05, 0x70, 0x79, 0x23, 0xFC, 0xA6, 0xC9, 0xE1, 0x91, 0x58, 0xE4, 0x55, 0xFE, 0x7B, 0x0A,
-    0x68, 0x37, 0x97, 0x9A, 0xFE, 0x23, 0x6C, 0x99, 0x19, 0x49, 0xCB, 0x8C, 0xEC, 0xA8, 0x47, 0xD5,
-    0xD4, 0x59, 0x26, 0xD9, 0x52, 0x49, 0x6D, 0x89, 0xAF, 0x50, 0x46, 0xF2, 0x0D, 0xF1, 0xB2, 0x9D,
-    0x9E, 0x28, 0xDD, 0x8F, 0x77, 0x52, 0xAF, 0x06, 0x1E, 0xFC, 0x99, 0x36, 0x3B, 0x34, 0x2E, 0xAE,
-    0xB6, 0x0C, 0x5C, 0x5D, 0x93, 0x34, 0x78, 0x89, 0x1D, 0xA4, 0x7E, 0xBE, 0x54, 0x47, 0x66, 0xCD,
-    0x8E, 0x40, 0xFF, 0xBF, 0xB1, 0xDA, 0x26, 0x45, 0x24, 0xDE, 0x5C, 0xA6, 0x6C, 0x99, 0xFB, 0xF8,
-    0x39, 0x70, 0xC5, 0x3B, 0xC0, 0x68, 0xAC, 0xFF, 0x35, 0x31, 0xA4, 0xB4, 0x9C, 0xBA, 0xFF, 0x9D,
-    0x46, 0xA6, 0x7B, 0x82, 0xD8, 0xF1, 0x77, 0x4C, 0x34, 0x3B, 0xEF, 0x49, 0xE1, 0xE1, 0x71, 0x0E,
-    0xCF, 0x9E, 0x41, 0xA9, 0x22, 0x87, 0xDC, 0x83, 0x9E, 0x58, 0x98, 0x58, 0x4C, 0xCC, 0x6C, 0x71,
-    0x0E, 0x02, 0x0E, 0x92, 0xC0, 0x77, 0x37, 0x02, 0x4D, 0x29, 0x66, 0xFC, 0x12, 0x38, 0xA4, 0x73,
-    0x11, 0x5F, 0xFA, 0x0F, 0x6C, 0x91, 0x03, 0x04, 0xF8, 0x3F, 0x40, 0x2A, 0x5F, 0x3E, 0x8F, 0x6D,
-    0x3A, 0x4F, 0x9B, 0xDE, 0x5A, 0x82, 0x53, 0xFA, 0xF8, 0x34, 0x22, 0xF1, 0x77, 0x72, 0xCD, 0x31,
-    0x75, 0xC7, 0xFD, 0xF2, 0xEB, 0x9D, 0x8C, 0x76, 0xF8, 0xA1, 0xB4, 0x38, 0x19, 0x6F, 0xE9, 0x64,
-    0xD9, 0x8B, 0x89, 0x96, 0x78, 0x89, 0xFB, 0x09, 0x1A, 0xFC, 0x7D, 0xA3, 0xD3, 0x43, 0x33, 0x6B,
-    0xBF, 0xED, 0x1E, 0x61, 0x62, 0x1C, 0x04, 0x00, 0xED, 0x00, 0xEC, 0xB7, 0x71, 0x07, 0x7C, 0xA1,
-    0x7D, 0x21, 0x05, 0x8E, 0x48, 0xE0, 0xB8, 0x4E, 0x9D, 0xCE, 0xFC, 0x9F, 0xBB, 0x61, 0x00, 0xFD,
-    0xDB, 0x98, 0x82, 0x10, 0xD8, 0x34, 0x48, 0x06, 0x8B, 0xB6, 0xF5, 0x65, 0xD8, 0xDB, 0xE0, 0xDF,
-    0x9F, 0x24, 0xC6, 0x77, 0x42, 0x16, 0xEE, 0x5E, 0x76, 0x24, 0x92, 0xAC, 0xA8, 0xBD, 0xEE, 0x79,
-    0x6A, 0x5B, 0xC9, 0xD7, 0x1E, 0x6D, 0xB7, 0x79, 0x4D, 0x7A, 0xE7, 0x59, 0x6A, 0xB5, 0xA4, 0x47,
-    0x61, 0x83, 0xAE, 0x88, 0x99, 0x34, 0xEE, 0xFA, 0xB6, 0x9A, 0xD4, 0x9A, 0xFD, 0x84, 0x4D, 0x20,
-    0xB4, 0x73, 0xA9, 0x04, 0xDC, 0x4D, 0xAA, 0xCF, 0x06, 0x4C, 0x7B, 0xB7, 0xCE, 0xBD, 0xAF, 0x93,
-    0x93, 0xDE, 0xAF, 0xF2, 0x83, 0x5E, 0x78, 0x90, 0x22, 0x66, 0xBD, 0x0F, 0x4A, 0xAF, 0x60, 0xF8,
-    0xBF, 0xCF, 0x45, 0xC8, 0x14, 0xF1, 0x19, 0xA5, 0xCC, 0xCC, 0xDB, 0x4B, 0xAA, 0x74, 0x2E, 0x47,
-    0x2D, 0x04, 0x93, 0xDE, 0xEC, 0x6E, 0x7C, 0x4B, 0x5D, 0x4E, 0x6C, 0x4C, 0x1D, 0x77, 0xB6, 0x68,
-    0xB0, 0xD7, 0x34, 0xFF, 0x4A, 0xB7, 0x49, 0x93, 0xFF, 0xD3, 0xB9, 0xC0, 0xA6, 0xFB, 0x17, 0x9A,
-    0x77, 0xB0, 0x01, 0x74, 0x0C, 0xA4, 0x8C, 0x5C, 0xF2, 0x54, 0xEC, 0xBE, 0xF6, 0xD7, 0x8E, 0x47,
-    0xAC, 0x40, 0x58, 0x9F, 0xFE, 0x74, 0xE6, 0x4D, 0xE5, 0x3E, 0xE7, 0x46, 0xF6, 0xC5, 0x1D, 0xC8,
-    0x1F, 0x14, 0x30, 0x38, 0xD1, 0x28, 0x28, 0x31, 0xB9, 0x58, 0xBE, 0xA2, 0x71, 0xB3, 0xCB, 0xF3,
-    0x7C, 0x90, 0x43, 0x19, 0x26, 0x09, 0x13, 0x4E, 0x74, 0x34, 0x2B, 0x5C, 0xCD, 0x0B, 0x3B, 0x12,
-    0x66, 0x18, 0x51, 0xC3, 0x8D, 0x86, 0x5B, 0x0D, 0x3F, 0xC6, 0x0C, 0x69, 0x38, 0xD2, 0xB0, 0xA4,
-    0xE1, 0x49, 0xC3, 0x94, 0x31, 0x57, 0x1A, 0xB6, 0x34, 0x7C, 0x69, 0x18, 0xD3, 0x80, 0xE1, 0xF9,
-    0x2E, 0x46, 0x9F, 0x41, 0x09, 0x0C, 0x62, 0x5D, 0xB3, 0xF2, 0xE2, 0x91, 0xF2, 0x16, 0x6B, 0x2F,
-    0x15, 0x8B, 0x2F, 0xCB, 0xCE, 0x47, 0xC7, 0x52, 0xC5, 0x55, 0x2B, 0xD6, 0x5F, 0x14, 0x0B, 0x30,
-    0x2C, 0x02, 0x44, 0x42, 0x3F, 0x0B, 0xBA, 0xDB, 0xAC, 0x00, 0x30, 0xAB, 0x37, 0xAD, 0xC2, 0x4C,
-    0x50, 0x80, 0x1C, 0x1F, 0x62, 0xAF, 0xD7, 0x25, 0x59, 0x89, 0x40, 0x23, 0x27, 0xD1, 0x98, 0xA3,
-    0x9A, 0x34, 0x00, 0xB7, 0xB5, 0xAD, 0x13, 0x57, 0x28, 0x29, 0x1C, 0x81, 0x42, 0xEE, 0x3B, 0xFF,
-    0x4B, 0x96, 0x3E, 0x82, 0xE8, 0x33, 0xB7, 0x33, 0x3A, 0x5B, 0xE8, 0x22, 0xA8, 0x20, 0x05, 0x49,
-    0xF9, 0xC8, 0x10, 0xD2, 0x97, 0xDC, 0xD6, 0x11, 0x12, 0x86, 0x70, 0xD9, 0x0D, 0x3C, 0x60, 0x6B,
-    0x3F, 0x3F, 0x22, 0x76, 0x00, 0x32, 0x01, 0x7E, 0xE4, 0xB1, 0x86, 0x4A, 0x9F, 0x78, 0x9A, 0x08,
-    0x84, 0xE0, 0x35, 0x40, 0x09, 0xDD, 0xC4, 0xEF, 0x9F, 0xCD, 0x34, 0xA6, 0xD2, 0x81, 0x80, 0x73,
-    0x69, 0x9A, 0x9A, 0x00, 0xE6, 0x72, 0x6A, 0x47, 0x0A, 0xE7, 0x03, 0x7C, 0x87, 0xD5, 0x21, 0xAC,
-    0x7C, 0x8B, 0xD8, 0xAC, 0x97, 0xF8, 0x8B, 0xA1, 0x49, 0xFC, 0x9C, 0xBA, 0x99, 0x55, 0xC7, 0x29,
-    0x82, 0xE0, 0xC8, 0x7F, 0x87, 0xB1, 0x40, 0x20, 0xF5, 0x9D, 0x81, 0x4F, 0xE0, 0x53, 0xB0, 0xE2,
-    0x03, 0x5D, 0x87, 0x54, 0xF9, 0xCC, 0x78, 0x09, 0x95, 0x8D, 0xDB, 0xD6, 0xCD, 0x1B, 0xDC, 0xD0,
-    0xA7, 0x05, 0x29, 0x5E, 0x1B, 0x0A, 0xF7, 0x28, 0x9B, 0xFB, 0xDE, 0xE2, 0x47, 0x4F, 0x84, 0xE3,
-    0xA6, 0x23, 0xFF, 0x12, 0xE2, 0x29, 0xCE, 0x13, 0x59, 0x85, 0xB1, 0x1B, 0x23, 0xDC, 0xD9, 0x30,
-    0x0B, 0x0F, 0x1C, 0xF0, 0x4E, 0x17, 0xD0, 0xA4, 0x32, 0xA0, 0xA9, 0x7E, 0x35, 0x23, 0xFA, 0x1E,
-    0x40, 0x3C, 0xBC, 0xE7, 0x88, 0x94, 0xF3, 0x21, 0x4B, 0xF8, 0x6E, 0xCA, 0x98, 0x7C, 0x1B, 0xEF,
-    0x56, 0x36, 0x50, 0xBD, 0x1F, 0x06, 0x70, 0x0D, 0x19, 0x56, 0x3E, 0x42, 0xA8, 0x50, 0x30, 0xB9,
-    0x00, 0x34, 0xF6, 0xE9, 0xCF, 0x10, 0x67, 0xAC, 0xD7, 0x34, 0x02, 0x8B, 0xBA, 0x72, 0x60, 0x33,
-    0xF1, 0x99, 0xAE, 0x23, 0xA0, 0xA9, 0x0B, 0x37, 0xDA, 0xF2, 0x61, 0x72, 0xEC, 0x9D, 0xB4, 0x6D,
-    0x7C, 0x91, 0xBB, 0x61, 0xA7, 0x6F, 0xA5, 0xBE, 0x0F, 0xF0, 0xF2, 0x7A, 0xB2, 0x0A, 0x23, 0xE0,
-    0x1E, 0x49, 0x37, 0xCC, 0x2F, 0x73, 0x37, 0x0D, 0x32, 0xA3, 0x3E, 0x5B, 0xFC, 0xD0, 0xA9, 0x11,
-    0xEC, 0x2E, 0x48, 0x2A, 0xFB, 0x6E, 0x8F, 0x50, 0xDD, 0x5B, 0x77, 0x9C, 0x20, 0xB0, 0x44, 0x97,
-    0x3F, 0xCC, 0x37, 0x78, 0xF6, 0x68, 0xB6, 0x46, 0x03, 0xE1, 0x8C, 0xEF, 0x5C, 0x2B, 0x3B, 0x31,
-    0xAD, 0x95, 0x9D, 0x94, 0x41, 0x9E, 0x55, 0x2B, 0x05, 0x0B, 0x26, 0x0D, 0x00, 0x78, 0x08, 0x6D,
-    0x77, 0xC2, 0xEE, 0xC9, 0xE7, 0x69, 0x03, 0xD9, 0x28, 0x50, 0x12, 0x42, 0xCF, 0x00, 0xB6, 0xD2,
-    0x2E, 0xCC, 0x92, 0xD2, 0x67, 0xD7, 0xA1, 0xFB, 0xDA, 0x27, 0xEF, 0x5E, 0x4C, 0x75, 0xD5, 0x4E,
-    0xDD, 0x88, 0xFE, 0x1E, 0xD6, 0xA3, 0x97, 0x04, 0x58, 0x94, 0x9F, 0xB8, 0x29, 0x9C, 0xA1, 0x94,
-    0xED, 0xA4, 0xFD, 0x3F, 0x37, 0x4A, 0xE9, 0xD5, 0xE9, 0x34, 0x11, 0x29, 0x54, 0xF6, 0x79, 0x09,
-    0x55, 0x2F, 0x9E, 0xA6, 0x6D, 0xA3, 0xC5, 0x2A, 0x54, 0x5B, 0x37, 0x7D, 0x1D, 0xD4, 0x16, 0x31,
-    0x9C, 0xC2, 0x34, 0x0D, 0x37, 0x4C, 0xAD, 0x08, 0xCB, 0xE3, 0xCE, 0xB0, 0xA4, 0x1E, 0xFA, 0x23,
-    0xE2, 0xA9, 0x9C, 0x01, 0x1E, 0x23, 0x0D, 0xA3, 0x14, 0x36, 0x4A, 0xAB, 0x93, 0xB8, 0x7B, 0x39,
-    0xF8, 0x25, 0xAE, 0x55, 0xD8, 0xC2, 0x2D, 0x10, 0x07, 0xE9, 0x4C, 0x9A, 0xC0, 0x74, 0x6F, 0x60,
-    0x34, 0x16, 0x7B, 0x5F, 0x35, 0xA1, 0x91, 0x5B, 0x37, 0xFB, 0xD5, 0x53, 0xDE, 0xAB, 0x23, 0xE9,
-    0xF8, 0xE9, 0x33, 0x3D, 0x61, 0xA7, 0xF4, 0xDD, 0x2D, 0x69, 0x66, 0x41, 0x1C, 0x62, 0xC2, 0x3B,
-    0x42, 0xFE, 0x94, 0x07, 0x1F, 0xBB, 0x91, 0x4B, 0x72, 0x42, 0x7C, 0x74, 0x28, 0x0C, 0x34, 0x67,
-    0x32, 0xB8, 0x3A, 0x6B, 0x66, 0x6C, 0xBE, 0xA9, 0xEE, 0x6A, 0xFD, 0x03, 0x59, 0x3F, 0xBF, 0x1C,
-    0xC8, 0xA9, 0xAA, 0x7E, 0x73, 0xF0, 0xC3, 0x3C, 0x7B, 0x3D, 0xD2, 0x61, 0x76, 0xB3, 0xF4, 0xFB,
-    0x58, 0x7F, 0x7F, 0x7E, 0xFD, 0x6D, 0xBD, 0xFE, 0x63, 0xBB, 0x21, 0x31, 0xD4, 0xE2, 0xE0, 0xE8,
-    0x1D, 0xD7, 0xFF, 0xAD, 0x76, 0x2E, 0xEA, 0x1A, 0x99, 0x16, 0x11, 0x1D, 0x63, 0x3C, 0x35, 0x23,
-    0x3A, 0x4F, 0xDE, 0x53, 0x2D, 0x34, 0x7B, 0x5A, 0xAD, 0xFA, 0xCE, 0xE1, 0xE3, 0x87, 0x6E, 0xE4,
-    0x4D, 0x2D, 0xB4, 0x9B, 0x2F, 0x34, 0x9E, 0x39, 0x6F, 0x5C, 0xB4, 0x39, 0xCE, 0x3B, 0x2D, 0x4E,
-    0x5B, 0xC8, 0x47, 0x1E, 0xF8, 0x50, 0xD7, 0x87, 0xEB, 0x33, 0x1D, 0xCF, 0x82, 0xEC, 0x3F, 0xE5,
-    0x24, 0x08, 0x9C, 0x9C, 0x23, 0xF9, 0x2A, 0x04, 0x3B, 0x29, 0xFF, 0x59, 0x73, 0x8C, 0x51, 0x37,
-    0x4F, 0xFA, 0x22, 0x76, 0xBA, 0x64, 0x44, 0xFE, 0x14, 0xF2, 0xAF, 0x2B, 0xD2, 0xA2, 0x3F, 0x76,
-    0xE7, 0x3F, 0x26, 0xDF, 0x3B, 0x33, 0x1F, 0xC7, 0xD3, 0xA6, 0x3B, 0xE1, 0x81, 0x9D, 0xCE, 0x24,
-    0x8E, 0xFA, 0xB3, 0xFA, 0xA3, 0xF1, 0x1A, 0xB8, 0xB9, 0x6F, 0xF3, 0x0C, 0xE0, 0x13, 0x56, 0xBD,
-    0xB9, 0xB9, 0xE7, 0x64, 0x1F, 0xA0, 0x52, 0x9D, 0x30, 0x53, 0x6B, 0xCC, 0xA0, 0x88, 0x49, 0xAE,
-    0xC8, 0x1C, 0xA7, 0xD0, 0xB7, 0xF1, 0x76, 0x0F, 0x8E, 0xF6, 0x17, 0x17, 0x76, 0x8A, 0xFE, 0x8D,
-    0x34, 0xAE, 0x58, 0x0B, 0x73, 0x7E, 0xD5, 0x4C, 0x22, 0x2A, 0x5A, 0x34, 0x16, 0x63, 0x38, 0x3D,
-    0xD0, 0xF5, 0x50, 0x5B, 0x37, 0xE5, 0xFC, 0xA9, 0xA0, 0x75, 0xC1, 0xA6, 0xDD, 0x49, 0x90, 0xB9,
-    0x35, 0x69, 0x21, 0x7D, 0xF9, 0x5E, 0xCA, 0xCC, 0x3F, 0xC0, 0x2F, 0xC6, 0x61, 0xF1, 0x24, 0x38,
-    0xD9, 0xB4, 0xA4, 0x76, 0x9A, 0xDF, 0x42, 0x77, 0x0A, 0x1A, 0x77, 0x47, 0x5E, 0x0A, 0xF2, 0xDE,
-    0x49, 0x41, 0xDE, 0x87, 0x09, 0xC8, 0xFB, 0xFA, 0x7F, 0xCF, 0x91, 0x67, 0x1F, 0x66, 0x48, 0x22,
-    0x96, 0x82, 0x97, 0xC5, 0x3B, 0x74, 0xA6, 0xDE, 0x92, 0x80, 0x77, 0x41, 0xC0, 0x7B, 0x3E, 0x8F,
-    0x6B, 0x02, 0xF9, 0x83, 0x80, 0x83, 0x20, 0xE0, 0x49, 0x10, 0x70, 0xE0, 0x36, 0x75, 0x72, 0x93,
-    0x83, 0x49, 0xFA, 0xCE, 0xB8, 0x39, 0xD3, 0xA2, 0xF5, 0xF4, 0xC7, 0x7F, 0x45, 0xE1, 0x62, 0x8C,
-    0xFB, 0xCB, 0x8A, 0x47, 0xA5, 0x79, 0xD8, 0xCA, 0x41, 0x18, 0xAC, 0x5B, 0x46, 0xD9, 0x2F, 0x2A,
-    0xCD, 0xA2, 0xAC, 0x88, 0x35, 0xE7, 0x9A, 0x9D, 0x3A, 0xEA, 0x01, 0xC7, 0x30, 0x11, 0x79, 0x73,
-    0xD1, 0xA6, 0x51, 0x4F, 0x7A, 0x10, 0x5D, 0xB4, 0x81, 0xDD, 0x6D, 0x79, 0x23, 0xE5, 0x7A, 0x7F,
-    0x99, 0xD8, 0xEF, 0x43, 0xB8, 0xAE, 0x62, 0xB0, 0x3A, 0x6C, 0x61, 0x95, 0x84, 0xE7, 0xEC, 0x18,
-    0x6C, 0x8A, 0x36, 0xE5, 0xED, 0x8B, 0x36, 0xDA, 0x01, 0xF6, 0x46, 0xBA, 0x32, 0xAE, 0x8C, 0xA1,
-    0x1A, 0x3E, 0x46, 0xCB, 0xF3, 0x3A, 0xAD, 0xC4, 0x0D, 0x16, 0x07, 0x47, 0x2C, 0x6B, 0xB5, 0xBB,
-    0x60, 0x85, 0xF7, 0xBC, 0xE8, 0x08, 0x35, 0x25, 0x37, 0x77, 0xD7, 0xD6, 0x8E, 0x6A, 0x74, 0x25,
-    0x88, 0x4B, 0xCC, 0xBF, 0x76, 0x27, 0x3D, 0x9A, 0x0B, 0x97, 0x00, 0xCE, 0x1C, 0xAD, 0xC5, 0x4A,
-    0xDA, 0x51, 0xB5, 0x05, 0x9D, 0xE9, 0x01, 0xD8, 0x8F, 0x97, 0xDB, 0x84, 0x7D, 0x4C, 0x66, 0x05,
-    0x60, 0x76, 0xB7, 0xD3, 0x36, 0xAA, 0x4E, 0xCB, 0xC9, 0xDA, 0xDB, 0x71, 0x48, 0x20, 0x61, 0x0C,
-    0x1B, 0xC2, 0xFB, 0xEA, 0x80, 0xEA, 0xFD, 0xB8, 0x14, 0xA8, 0xCF, 0xD2, 0xA4, 0xCE, 0x8D, 0x3D,
-    0xD2, 0x75, 0xCB, 0x59, 0x7A, 0xD9, 0x67, 0x6D, 0x10, 0x24, 0xE1, 0xE1, 0xA8, 0x31, 0x28, 0x51,
-    0x0F, 0x84, 0xAC, 0xA2, 0xB1, 0x8A, 0xFC, 0xCD, 0x9A, 0x98, 0x25, 0x7A, 0x40, 0xC7, 0xBC, 0xA7,
-    0x3F, 0x0B, 0xEA, 0x87, 0x3A, 0x17, 0x6E, 0xE8, 0xC0, 0x29, 0xD3, 0x56, 0xCD, 0xFD, 0x4C, 0x43,
-    0x01, 0xAF, 0x1E, 0x1F, 0x2E, 0x9D, 0xF9, 0xCE, 0xEF, 0xD1, 0x61, 0xB4, 0xE9, 0xCF, 0xD3, 0x92,
-    0x49, 0xB1, 0xD5, 0xA4, 0x74, 0x61, 0x67, 0xAB, 0x93, 0x63, 0x09, 0x88, 0x59, 0xA2, 0x3D, 0xF7,
-    0x3F, 0xCA, 0x76, 0xC6, 0xBD, 0xF9, 0x8B, 0x1E, 0xF3, 0x17, 0xDE, 0x34, 0xDF, 0xD4, 0x9F, 0xCF,
-    0x5F, 0x5C, 0x97, 0x3E, 0x62, 0x72, 0xCD, 0xBA, 0xB6, 0xAE, 0xDB, 0xA5, 0x13, 0x25, 0xC9, 0x54,
-    0x66, 0x53, 0x79, 0x8E, 0x83, 0xC2, 0x2B, 0xA7, 0x63, 0x20, 0x13, 0x1B, 0x72, 0x38, 0x26, 0xA3,
-    0xE4, 0x0E, 0x98, 0xBF, 0xD0, 0x9E, 0xBD, 0x1C, 0x57, 0x8A, 0x96, 0x29, 0xF2, 0xEE, 0x15, 0x39,
-    0xB2, 0x21, 0x67, 0xE2, 0x77, 0xA7, 0xF5, 0xD9, 0xD7, 0x46, 0xD8, 0xE3, 0xD2, 0xDD, 0xB2, 0xD8,
-    0xD1, 0x87, 0x48, 0xB5, 0xB3, 0xAA, 0xCC, 0x2F, 0x30, 0xFE, 0x55, 0x8A, 0x29, 0x40, 0x94, 0x55,
-    0x30, 0xE0, 0x59, 0xC1, 0x84, 0x08, 0xD2, 0xE0, 0xA5, 0xFA, 0xDE, 0x04, 0xD0, 0x74, 0xC4, 0xAD,
-    0x84, 0x30, 0x31, 0xFF, 0xA5, 0x90, 0x5C, 0xCB, 0xCA, 0x99, 0x47, 0x7A, 0x2A, 0xAC, 0x94, 0x53,
-    0x61, 0xA3, 0xE9, 0xA9, 0x30, 0xB1, 0xC8, 0x3A, 0x17, 0xA0, 0x83, 0x41, 0x6F, 0x5A, 0x03, 0xB2,
-    0xE7, 0x8B, 0xF8, 0x77, 0xDF, 0x3B, 0xF9, 0x6F, 0x59, 0xB9, 0xFF, 0xED, 0xD5, 0xD0, 0xDF, 0x60,
-    0xEF, 0xE4, 0x05, 0x84, 0x9B, 0xFD, 0x85, 0xA6, 0x83, 0x2C, 0x6F, 0x70, 0x82, 0x64, 0x1C, 0xDE,
-    0xBE, 0x9F, 0xE4, 0x48, 0xF2, 0x4D, 0x93, 0x23, 0xD5, 0x4D, 0xC9, 0x11, 0x9B, 0x35, 0xCB, 0x31,
-    0x86, 0xD1, 0xB0, 0x55, 0x1C, 0xBA, 0x70, 0x59, 0x6D, 0xC4, 0x53, 0x55, 0x9F, 0x6E, 0x7F, 0x62,
-    0x5E, 0x64, 0x6E, 0xA4, 0xCF, 0xC7, 0x53, 0x60, 0x53, 0x42, 0xA6, 0x9E, 0xDA, 0xE6, 0xB5, 0xB5,
-    0x92, 0xB9, 0x81, 0xF6, 0xDA, 0x3A, 0xF3, 0x22, 0x4C, 0x18, 0x10, 0xD0, 0x94, 0x6A, 0xD5, 0x42,
-    0xA4, 0xEB, 0x09, 0xE9, 0x2D, 0x4D, 0x3D, 0x56, 0xF5, 0x74, 0x8B, 0x07, 0xE0, 0xA4, 0xDD, 0xC2,
-    0x39, 0xF3, 0xAD, 0x26, 0x87, 0xEE, 0x5C, 0x0F, 0x34, 0x6E, 0x51, 0x0F, 0xFC, 0xE6, 0xC9, 0x21,
-    0x84, 0x5B, 0xD6, 0x45, 0x60, 0xE0, 0xFA, 0xD7, 0xB9, 0xC4, 0xA3, 0xD2, 0x9B, 0x77, 0xBB, 0x6A,
-    0xDF, 0x43, 0xC4, 0x6E, 0x6C, 0xBD, 0x02, 0xCF, 0x87, 0xCD, 0x5B, 0x12, 0x62, 0xCA, 0x45, 0x4A,
-    0xB9, 0xCE, 0xB8, 0x03, 0x5E, 0xEB, 0xB8, 0xF9, 0xFE, 0x48, 0x6A, 0x87, 0xA5, 0x6E, 0x45, 0x61,
-    0xAD, 0x95, 0x4D, 0xA1, 0x19, 0x91, 0x9B, 0x5B, 0x77, 0xD5, 0xE2, 0xA1, 0xF9, 0xC6, 0x98, 0xFD,
-    0xA9, 0xF4, 0xA7, 0x35, 0x2A, 0x6E, 0x64, 0x7A, 0xD4, 0x03, 0xEA, 0x56, 0xC7, 0x2E, 0xCD, 0x7B,
-    0x3D, 0x76, 0x79, 0xE4, 0xBE, 0x8F, 0x5D, 0xC6, 0x85, 0x3E, 0x76, 0x59, 0xCC, 0x66, 0x7F, 0xF4,
-    0xC6, 0xEB, 0x58, 0xAE, 0xA9, 0xE6, 0x4D, 0x0A, 0x27, 0x6F, 0xDE, 0x7F, 0xBF, 0xF3, 0x82, 0xF4,
-    0x3B, 0x5F, 0x67, 0xBF, 0xF3, 0xBA, 0xF4, 0x3B, 0x5F, 0x61, 0xBF, 0x73, 0x35, 0x4D, 0x3B, 0x9E,
-    0x9B, 0x98, 0x1D, 0xFD, 0xFA, 0xC4, 0x9C, 0x4D, 0x58, 0xD2, 0x27, 0x67, 0xA6, 0x2E, 0x7B, 0xAF,
-    0x4B, 0xBF, 0xD3, 0x6B, 0xBB, 0x8E, 0x9C, 0x3A, 0x9F, 0xF1, 0xEA, 0x2F, 0x73, 0xCF, 0x5D, 0x79,
-    0xE2, 0x05, 0xAD, 0xE7, 0xA7, 0x54, 0x7A, 0x7F, 0xA8, 0xE6, 0x9F, 0x06, 0xF1, 0xED, 0x3C, 0xF7,
-    0x80, 0xCB, 0xDB, 0xA7, 0x9E, 0xC1, 0x06, 0x9C, 0x50, 0x01, 0x36, 0xCD, 0x9B, 0x6F, 0xA2, 0xBF,
-    0xFF, 0x03, 0x1E, 0x46, 0x48, 0x1A, 0x37, 0x88, 0xD2, 0xDC, 0x8C, 0x50, 0xAA, 0xEF, 0xCC, 0xC3,
-    0xB2, 0x6F, 0x81, 0x70, 0x3E, 0x58, 0xC7, 0x3F, 0x0D, 0x57, 0x78, 0x24, 0x57, 0x2B, 0xE6, 0xDC,
-    0xD3, 0x27, 0x1E, 0xC0, 0x89, 0x96, 0xF9, 0xA7, 0xDB, 0x30, 0x01, 0x5B, 0x68, 0x13, 0xD6, 0x92,
-    0xC4, 0xBE, 0x8E, 0x22, 0x3F, 0x89, 0xAC, 0x88, 0xE5, 0x1C, 0x1D, 0xCF, 0xFE, 0xA6, 0xB1, 0x7F,
-    0x7D, 0x9D, 0xFE, 0x09, 0x98, 0xB0, 0x53, 0x85, 0x2B, 0x58, 0xAC, 0x14, 0xEB, 0xA1, 0x06, 0x3F,
-    0xD5, 0x1C, 0xD2, 0xF8, 0xAC, 0xB5, 0xD6, 0xD3, 0xC7, 0x09, 0xA1, 0x3F, 0x11, 0xD8, 0x00, 0xBE,
-    0x9C, 0xD3, 0x4F, 0x5F, 0x5A, 0xA5, 0x50, 0xC3, 0xC8, 0x2A, 0x5F, 0x9E, 0x62, 0x15, 0x06, 0x23,
-    0x6B, 0xF2, 0x1C, 0x29, 0x42, 0xE6, 0x43, 0x3C, 0x39, 0x54, 0xDF, 0x80, 0x55, 0xF1, 0xD3, 0x96,
-    0xCD, 0xC6, 0xFA, 0x23, 0xF0, 0xD8, 0xF4, 0xB0, 0x85, 0x93, 0x96, 0x40, 0x0D, 0x88, 0xE4, 0x82,
-    0x1E, 0x93, 0x5A, 0x23, 0x78, 0x19, 0xEC, 0x05, 0x34, 0x88, 0x6E, 0xCC, 0xE9, 0xA9, 0x1F, 0xF8,
-    0x6F, 0xBC, 0x9E, 0xAD, 0xDB, 0xF5, 0x3B, 0x08, 0x45, 0xEB, 0xC8, 0x1B, 0x32, 0x64, 0x98, 0x82,
-    0xBB, 0x65, 0x05, 0xE1, 0x4F, 0x1C, 0xEA, 0x32, 0xC2, 0xC8, 0x1E, 0x2B, 0x31, 0xD2, 0x84, 0xF7,
-    0x84, 0xBA, 0xCD, 0xF3, 0x29, 0x1E, 0xC2, 0x93, 0x19, 0x1A, 0x81, 0x7E, 0x46, 0x61, 0xDF, 0x0E,
-    0xF0, 0x81, 0x34, 0x3C, 0x24, 0xB5, 0xFF, 0xD2, 0x7D, 0x37, 0x99, 0xF2, 0xEC, 0x97, 0xF4, 0x35,
-    0xC9, 0x11, 0xBE, 0xD0, 0xCD, 0x2C, 0xF6, 0x08, 0x2D, 0xEB, 0x9C, 0xCA, 0x34, 0xFD, 0x28, 0x7F,
-    0x2C, 0xAE, 0xAD, 0x1D, 0x67, 0x86, 0xA4, 0xF2, 0x37, 0x37, 0xE3, 0x23, 0x2C, 0x58, 0xC1, 0xFF,
-    0xB5, 0x89, 0x57, 0xE0, 0xB3, 0x0D, 0x3E, 0xF4, 0xA7, 0x87, 0x21, 0xFC, 0xC8, 0x90, 0x07, 0x81,
-    0xD5, 0xD3, 0x10, 0x9B, 0x2D, 0x66, 0x5E, 0x0D, 0x2B, 0x3B, 0xB4, 0x29, 0xC0, 0xFA, 0x14, 0x19,
-    0x0C, 0x68, 0xEF, 0x2F, 0xC3, 0x91, 0x9D, 0xC0, 0x11, 0x00, 0xE4, 0xB5, 0x98, 0x85, 0xAB, 0xAC,
-    0x1B, 0x95, 0x38, 0xB5, 0x70, 0xAC, 0x5F, 0xDB, 0x04, 0x9A, 0xD4, 0xAE, 0xCA, 0x9D, 0x55, 0xAE,
-    0x87, 0xBF, 0xEA, 0xC7, 0x79, 0x88, 0xA4, 0x52, 0xD5, 0x2D, 0xDA, 0x79, 0x71, 0x27, 0x38, 0x5D,
-    0x08, 0x2D, 0xD2, 0x3E, 0x15, 0xA9, 0xF5, 0x92, 0xC4, 0x04, 0xA7, 0x80, 0x2A, 0x7D, 0xF6, 0x95,
-    0xB7, 0x88, 0xA9, 0x03, 0x15, 0xC0, 0x21, 0x4D, 0x9F, 0x2E, 0xA1, 0x0D, 0x06, 0x36, 0xFA, 0x88,
-    0xEE, 0x60, 0x1A, 0xBA, 0x4D, 0x30, 0xD4, 0xBE, 0x39, 0x8E, 0x30, 0xCE, 0xE8, 0x10, 0xC8, 0x03,
-    0xE0, 0x23, 0x66, 0xEF, 0x65, 0xCE, 0x88, 0xCD, 0xA7, 0x6F, 0x30, 0x73, 0xF0, 0x19, 0xC0, 0x08,
-    0xA2, 0xED, 0xAE, 0x38, 0xFC, 0xBE, 0xE4, 0x6D, 0x56, 0x2C, 0xE9, 0x03, 0x55, 0xAB, 0xEE, 0x2B,
-    0xA2, 0x4D, 0xE7, 0x5A, 0xAE, 0xD6, 0x3F, 0xA9, 0x42, 0xEA, 0xAE, 0x35, 0x46, 0x3D, 0xBD, 0xF5,
-    0x50, 0x4E, 0x53, 0x97, 0x02, 0xC9, 0xB6, 0x79, 0xD8, 0x8C, 0xA9, 0x54, 0x4F, 0x18, 0xD6, 0x53,
-    0x7D, 0x8A, 0xA3, 0x5D, 0x48, 0x04, 0xCF, 0x30, 0x87, 0x75, 0x49, 0x5B, 0x8A, 0x30, 0x80, 0x76,
-    0x11, 0xDB, 0xB7, 0x53, 0x9B, 0xDD, 0xB9, 0xAC, 0xEE, 0x4D, 0x17, 0x7B, 0xF4, 0xFB, 0x42, 0x96,
-    0x2D, 0xF1, 0x4E, 0xBE, 0xCD, 0x17, 0xCF, 0xDA, 0x91, 0xBA, 0xD5, 0xCF, 0x23, 0x8B, 0x77, 0x68,
-    0x09, 0x21, 0x3C, 0x56, 0x01, 0xF1, 0x48, 0xAA, 0xC9, 0xDB, 0x4F, 0x84, 0x7C, 0xFA, 0x1A, 0x8F,
-    0x13, 0x32, 0x79, 0xD4, 0x82, 0x9A, 0xE5, 0xAA, 0x6B, 0x44, 0x46, 0xF3, 0x9C, 0xB1, 0x81, 0x32,
-    0x8E, 0x03, 0x1E, 0x41, 0xB2, 0xCE, 0xD2, 0xBF, 0x0F, 0x75, 0x72, 0xD1, 0xCA, 0x8F, 0x2A, 0xF7,
-    0xD5, 0x48, 0x0D, 0x80, 0x9B, 0xF2, 0x58, 0xC5, 0x72, 0x84, 0x92, 0xCD, 0xED, 0x0B, 0x8D, 0xA0,
-    0x24, 0x22, 0x28, 0x6E, 0x38, 0xFB, 0x58, 0x0A, 0x9B, 0x39, 0xA9, 0xA1, 0xDA, 0xB2, 0x72, 0xE9,
-    0x10, 0xA0, 0x0D, 0xE8, 0x2B, 0x13, 0xCC, 0x89, 0x73, 0x5D, 0x87, 0xEF, 0x1A, 0xD0, 0xF4, 0x73,
-    0xAA, 0xCF, 0x3A, 0x70, 0x5C, 0x67, 0x52, 0x1F, 0x0A, 0x67, 0xD2, 0x91, 0xAC, 0x9B, 0x64, 0x36,
-    0x9B, 0x1C, 0xCF, 0xC1, 0x52, 0xB8, 0x14, 0xB3, 0xA3, 0x92, 0xB7, 0x1A, 0x1F, 0xFA, 0x74, 0x2F,
-    0xC9, 0x93, 0x1F, 0xB8, 0x71, 0x61, 0xD3, 0xB2, 0xD1, 0xC8, 0x3E, 0x9D, 0xC3, 0x41, 0xDC, 0x28,
-    0xC9, 0xE8, 0x20, 0xF2, 0xA1, 0xEF, 0x7C, 0x2C, 0x82, 0x98, 0xEB, 0x50, 0x3F, 0x78, 0x8B, 0x0F,
-    0xB9, 0x49, 0x56, 0xD8, 0x15, 0x83, 0x55, 0x58, 0x7C, 0xB8, 0x98, 0xE4, 0x1B, 0xAC, 0x99, 0x5F,
-    0x79, 0x58, 0x96, 0x74, 0xDB, 0xF5, 0xC6, 0xD9, 0x88, 0x72, 0x9C, 0x12, 0x92, 0xA7, 0x5E, 0x7D,
-    0x4F, 0x9E, 0xC0, 0x67, 0x16, 0x46, 0xFD, 0x06, 0x4B, 0x30, 0x6C, 0x7D, 0x12, 0x02, 0xCC, 0xCD,
-    0xBF, 0xD2, 0x11, 0x37, 0x5F, 0xFC, 0xCB, 0xCD, 0x5B, 0x4A, 0x02, 0x70, 0x84, 0x55, 0x97, 0x3C,
-    0xAE, 0x1E, 0x97, 0x63, 0x5C, 0x9D, 0x4B, 0x1F, 0x47, 0x25, 0xCF, 0xE4, 0x0B, 0x24, 0xBF, 0x0B,
-    0xAC, 0xFB, 0x09, 0x61, 0xB7, 0x75, 0x81, 0x8A, 0x6B, 0x7D, 0x50, 0xCA, 0x73, 0x02, 0xB4, 0x02,
-    0x33, 0xC7, 0xF2, 0x13, 0xC6, 0x99, 0xCE, 0xC7, 0xD2, 0xCF, 0x78, 0x83, 0xAD, 0x05, 0x84, 0x7F,
-    0x03, 0x49, 0x99, 0xF9, 0xA2, 0x98, 0x13, 0xD4, 0xEF, 0xD7, 0x6A, 0x7F, 0x1D, 0xE9, 0xA0, 0x40,
-    0xA7, 0x52, 0x79, 0x9C, 0x72, 0xDF, 0xE6, 0x5C, 0xD7, 0xF6, 0xFD, 0x37, 0xF3, 0x6A, 0x1D, 0x37,
-    0x2A, 0x29, 0x54, 0x8F, 0xA4, 0x74, 0xE9, 0x9B, 0xF9, 0xAD, 0x18, 0xD0, 0x3C, 0x55, 0x6B, 0x7D,
-    0x97, 0x18, 0x76, 0x1A, 0x90, 0x6C, 0x4B, 0x48, 0x11, 0x4B, 0xBC, 0x52, 0xCB, 0xCA, 0xBF, 0x96,
-    0x78, 0xA5, 0x90, 0x88, 0xA3, 0x90, 0x80, 0xA4, 0x60, 0xBC, 0x72, 0x8A, 0x3D, 0x79, 0xF6, 0x07,
-    0x39, 0x19, 0x77, 0x4D, 0x8E, 0xC2, 0x6E, 0xE7, 0x12, 0x90, 0xE4, 0x12, 0xAF, 0x64, 0x12, 0xAF,
-    0x64, 0xE3, 0x56, 0xFE, 0x92, 0x85, 0xBF, 0x25, 0x48, 0xBD, 0xB0, 0x9D, 0xD0, 0xFC, 0xA8, 0xF2,
-    0xCE, 0x97, 0x02, 0x16, 0x9E, 0x32, 0xB3, 0x07, 0xCB, 0x84, 0x65, 0xA3, 0x61, 0x81, 0x59, 0xF9,
-    0x3C, 0xAC, 0xE2, 0xCF, 0xA3, 0xA2, 0x47, 0xF9, 0x70, 0x90, 0x25, 0x31, 0x03, 0x29, 0xCD, 0x80,
-    0x13, 0x9D, 0x53, 0xF3, 0xFA, 0xC9, 0x23, 0x7D, 0x6E, 0x4A, 0xC8, 0x33, 0xB0, 0x53, 0x03, 0x26,
-    0x91, 0x9D, 0xB6, 0x2C, 0x74, 0x74, 0x09, 0x38, 0x00, 0xB2, 0x4E, 0xE7, 0x6A, 0xE0, 0xA4, 0x36,
-    0x10, 0x50, 0x4F, 0xCA, 0x6A, 0xFE, 0x70, 0x9C, 0x89, 0xFD, 0xFD, 0xE9, 0x07, 0xFE, 0xA7, 0x37,
-    0xE3, 0x91, 0xD1, 0xC1, 0xCD, 0xD8, 0x70, 0x32, 0xB3, 0x0C, 0x42, 0x3B, 0xDA, 0x9A, 0x4B, 0x4D,
-    0xC9, 0x53, 0x2B, 0x23, 0x37, 0xE5, 0x81, 0xF1, 0x36, 0xCF, 0xAC, 0x80, 0xBE, 0x7C, 0x77, 0xED,
-    0xF8, 0x7B, 0x30, 0x84, 0xFE, 0xDA, 0x1A, 0xA4, 0xDF, 0xD9, 0xE1, 0xE3, 0x28, 0x13, 0x2B, 0xC7,
-    0x0C, 0x7A, 0x33, 0x46, 0xE3, 0x43, 0x40, 0xD0, 0x39, 0x6E, 0xB0, 0x31, 0xF4, 0x52, 0x42, 0xA0,
-    0x19, 0xEA, 0xF8, 0x64, 0xCB, 0x3A, 0x34, 0x18, 0xD3, 0x02, 0xDB, 0x86, 0x80, 0x93, 0x6C, 0x48,
-    0x1E, 0x9A, 0x89, 0x3C, 0x60, 0x6F, 0xC6, 0x9A, 0x22, 0xD2, 0x8E, 0xEC, 0xD1, 0xD9, 0x74, 0xE6,
-    0xDC, 0xFE, 0x60, 0x91, 0x3E, 0x2D, 0x12, 0x2C, 0x1D, 0x44, 0x30, 0xFB, 0x0C, 0xC7, 0x43, 0xB1,
-    0xFB, 0x22, 0xE6, 0x30, 0xFC, 0x01, 0x56, 0x73, 0x1E, 0x06, 0xE9, 0xD9, 0x19, 0xC7, 0x1D, 0xA7,
-    0x66, 0x3D, 0x64, 0xF1, 0x3C, 0x6B, 0x9E, 0x43, 0xE0, 0x46, 0x8B, 0xC7, 0xA0, 0x77, 0xA5, 0x5A,
-    0xD3, 0xD9, 0x51, 0xF7, 0xDD, 0xC8, 0xFE, 0x30, 0xB7, 0xB3, 0xDE, 0xD5, 0x8C, 0x2D, 0x66, 0x0B,
-    0x63, 0x83, 0xC9, 0x47, 0x03, 0xE2, 0xAF, 0xB7, 0xF6, 0x1A, 0x8A, 0x47, 0xF8, 0xF0, 0x94, 0xCD,
-    0xBF, 0x56, 0x62, 0x16, 0xF7, 0x56, 0x98, 0x80, 0xF5, 0xA9, 0xF4, 0x15, 0xAC, 0x13, 0xD3, 0xFB,
-    0xA0, 0xAA, 0xCD, 0x23, 0xFF, 0xCC, 0x5A, 0x63, 0x92, 0x02, 0xE1, 0xA9, 0xF8, 0x3E, 0x26, 0x0F,
-    0x9D, 0xD3, 0x98, 0x6C, 0x0B, 0x38, 0xD9, 0x7E, 0x1D, 0x5F, 0xFB, 0x45, 0xDA, 0x54, 0x08, 0xE3,
-    0x66, 0x05, 0x92, 0x03, 0xC1, 0x02, 0x96, 0x3D, 0x36, 0xF9, 0x26, 0xFA, 0xD1, 0xAB, 0xDA, 0xFE,
-    0x88, 0xE9, 0x74, 0x32, 0xB6, 0x10, 0xA5, 0x04, 0xAC, 0xF3, 0x0F, 0x06, 0x7D, 0xC4, 0x9C, 0x78,
-    0x09, 0x9B, 0x4F, 0xFB, 0x48, 0x59, 0xDD, 0x6B, 0x20, 0x1F, 0xE5, 0x61, 0x54, 0x9B, 0x4D, 0xC4,
-    0x3E, 0xCF, 0x45, 0xD4, 0x54, 0xA8, 0xCA, 0x07, 0xE1, 0x6C, 0x21, 0xFB, 0x9E, 0x3C, 0x16, 0xEE,
-    0xDB, 0x7A, 0xDA, 0xE2, 0xB9, 0x1F, 0x60, 0xE9, 0xA7, 0x79, 0x4E, 0xAC, 0xD2, 0x26, 0x82, 0xC7,
-    0xCC, 0x8C, 0xE8, 0x5F, 0x3F, 0x62, 0x0E, 0xF1, 0x88, 0xAB, 0xCD, 0xEC, 0xA9, 0x3C, 0xC0, 0x58,
-    0x63, 0xD9, 0x3D, 0x02, 0xF3, 0x08, 0x9E, 0x3A, 0x43, 0xA4, 0x09, 0x43, 0xA0, 0x7A, 0xC0, 0xBF,
-    0x2D, 0x6B, 0xBE, 0x41, 0xED, 0x41, 0x9C, 0x8D, 0xBD, 0x63, 0x33, 0xF6, 0x3D, 0x3D, 0xFA, 0x90,
-    0x4D, 0xFE, 0x44, 0x6B, 0xB1, 0xA4, 0x4A, 0x82, 0x49, 0xBF, 0x79, 0x3A, 0x2E, 0x37, 0x8B, 0x3D,
-    0x4B, 0xD4, 0x5D, 0x3D, 0x2E, 0x02, 0xFF, 0x9E, 0x0D, 0x8C, 0x02, 0x16, 0xD9, 0x19, 0xE6, 0x2A,
-    0xD4, 0xC7, 0x06, 0x73, 0xEA, 0x34, 0x58, 0xBB, 0xD8, 0x84, 0x52, 0xC2, 0x8C, 0x57, 0x44, 0xA1,
-    0x75, 0xAE, 0xA4, 0x69, 0x1E, 0x54, 0xB7, 0x46, 0x46, 0x43, 0x39, 0x3A, 0xC0, 0xE7, 0x00, 0xC3,
-    0x8D, 0xC9, 0x03, 0x15, 0x73, 0x4D, 0x60, 0xA9, 0x97, 0xBB, 0xA1, 0x65, 0xB5, 0x39, 0x81, 0xEA,
-    0x24, 0x93, 0x7B, 0xB6, 0xFF, 0x5A, 0xDF, 0x53, 0xCB, 0x13, 0x6E, 0xDC, 0x8F, 0x62, 0xE6, 0xF3,
-    0x79, 0x8C, 0x02, 0xB7, 0x83, 0x1D, 0x03, 0x3D, 0x8E, 0x17, 0xCA, 0x38, 0x0E, 0x05, 0x86, 0x1D,
-    0x1B, 0x72, 0x8F, 0x51, 0xCA, 0x3D, 0x26, 0x8F, 0x39, 0x20, 0xF0, 0x2E, 0xF7, 0x33, 0xD7, 0x55,
-    0x67, 0xEE, 0x4C, 0xBE, 0x4B, 0x1D, 0x5D, 0x54, 0xDA, 0x22, 0xF0, 0x71, 0x2A, 0x20, 0xF1, 0xE0,
-    0xDE, 0xA5, 0x3F, 0x84, 0xA3, 0xBA, 0x0F, 0xB7, 0x1B, 0x3F, 0x1F, 0xA7, 0x09, 0xDD, 0xF1, 0x83,
-    0x9B, 0xFE, 0x67, 0xAA, 0x1F, 0x0B, 0xAD, 0x5B, 0xA3, 0xEE, 0xA2, 0x55, 0x1F, 0x83, 0x7F, 0x5F,
-    0x5A, 0xF5, 0x2B, 0xA7, 0xEE, 0xA8, 0x65, 0xE9, 0x73, 0x46, 0xC8, 0xF2, 0x1F, 0x73, 0x2A, 0xF2,
-    0xE3, 0xDF, 0x4E, 0x93, 0x09, 0x39, 0x54, 0x47, 0x3A, 0xE1, 0xDE, 0x5C, 0x49, 0xE9, 0x82, 0x9E,
-    0x85, 0x8F, 0xA8, 0x69, 0x0A, 0x11, 0xF6, 0xA5, 0x7B, 0x3B, 0x70, 0x9F, 0x8D, 0x0F, 0xDC, 0x03,
-    0x8A, 0x01, 0x71, 0x59, 0xC4, 0x17, 0x0B, 0x9A, 0xBB, 0xAD, 0x86, 0xA5, 0x3C, 0x54, 0xC5, 0xDA,
-    0xA3, 0xC9, 0xED, 0x70, 0xB2, 0xFB, 0x6C, 0xB7, 0xD1, 0x75, 0x2C, 0x47, 0x27, 0x83, 0xEE, 0xF9,
-    0x41, 0x61, 0x77, 0xA4, 0x32, 0x55, 0x02, 0x94, 0x16, 0x7B, 0x1F, 0xDD, 0x44, 0xE5, 0xDE, 0xC7,
-    0x0A, 0xFC, 0x3F, 0xAD, 0x55, 0x31, 0x6F, 0x1C, 0x45, 0x14, 0xFE, 0x76, 0xE7, 0xEE, 0x36, 0xF2,
-    0x12, 0xCF, 0x15, 0x2E, 0x12, 0x89, 0xF3, 0xD2, 0x06, 0x6C, 0x1F, 0x85, 0x8B, 0x14, 0xE7, 0xDB,
-    0x89, 0x5D, 0x44, 0x42, 0x02, 0x59, 0x02, 0x0B, 0x09, 0x09, 0x29, 0x05, 0x05, 0x72, 0x95, 0xC2,
-    0x45, 0x0A, 0xDB, 0xB7, 0x22, 0x7F, 0xC0, 0x5D, 0x0A, 0x9A, 0x93, 0x08, 0x02, 0x1C, 0x41, 0x40,
-    0x0A, 0x92, 0x0B, 0x5F, 0x32, 0x4E, 0x84, 0x90, 0xA0, 0xD9, 0x08, 0x89, 0xC6, 0xCD, 0x0A, 0x84,
-    0x14, 0x92, 0x82, 0x01, 0xAD, 0xC4, 0xCA, 0xDA, 0xBB, 0xE1, 0x9B, 0x3D, 0x5F, 0x62, 0xA4, 0x20,
-    0x85, 0xC0, 0xBC, 0xBB, 0xB9, 0x7D, 0xFB, 0xDE, 0xBC, 0x37, 0xEF, 0xBD, 0xEF, 0xBD, 0x7B, 0x67,
-    0xF7, 0xF1, 0xEA, 0xAF, 0xBE, 0xFD, 0x6E, 0xA4, 0x4C, 0xFC, 0xCD, 0xC7, 0x53, 0xE8, 0xFF, 0xF3,
-    0xC7, 0xAD, 0x40, 0xA1, 0x05, 0x2C, 0xAE, 0xDF, 0x38, 0xDC, 0x1D, 0xF4, 0x83, 0xD7, 0xBC, 0xB4,
-    0xBF, 0x41, 0x41, 0x1F, 0xCF, 0xBA, 0x8D, 0x57, 0x8B, 0x76, 0x3C, 0x8D, 0xED, 0xDD, 0x6B, 0x0F,
-    0xBF, 0x68, 0xE1, 0xD2, 0x46, 0x03, 0xE9, 0x25, 0x34, 0x80, 0x67, 0xDF, 0xB0, 0xBE, 0xDB, 0xB3,
-    0x8F, 0x6C, 0x7E, 0xFC, 0x73, 0xC7, 0x72, 0xB7, 0x23, 0x67, 0x7B, 0x6D, 0x6D, 0xED, 0x4D, 0x6B,
-    0xED, 0x43, 0xC6, 0xA5, 0xD6, 0xC6, 0xAB, 0x67, 0xAB, 0x75, 0x34, 0x8E, 0xF6, 0xD3, 0xA7, 0xBF,
-    0x9D, 0xF1, 0x56, 0xB2, 0x6E, 0x57, 0xFC, 0xFC, 0x5F, 0xB7, 0x9F, 0x76, 0xCE, 0xD1, 0xDC, 0x27,
-    0xB4, 0xFC, 0x0B, 0x9D, 0xB8, 0x1B, 0xF1, 0xF1, 0x4F, 0x7E, 0xB3, 0x2A, 0xF4, 0x66, 0xA0, 0x3B,
-    0x22, 0x8B, 0x50, 0x0A, 0x13, 0xE9, 0x98, 0x2F, 0x1A, 0xC9, 0x50, 0xA6, 0xFB, 0x52, 0x9B, 0x85,
-    0x40, 0xF7, 0xE1, 0x29, 0x72, 0x03, 0xA9, 0xF3, 0xB6, 0xD0, 0x06, 0xA8, 0xC9, 0xC3, 0x3F, 0xF2,
-    0x2D, 0xB9, 0x9C, 0x75, 0x82, 0x84, 0x67, 0xE1, 0x99, 0x59, 0xA1, 0x37, 0x65, 0x92, 0x47, 0xBE,
-    0x89, 0x45, 0x16, 0x07, 0x59, 0x2F, 0x34, 0x71, 0x40, 0x4D, 0x9E, 0x6C, 0xCA, 0xFB, 0xA5, 0x4C,
-    0x87, 0x61, 0x5A, 0x4A, 0x5D, 0xC8, 0x0B, 0xA6, 0x2D, 0x78, 0x4C, 0xE7, 0x12, 0x95, 0x74, 0xE6,
-    0xA9, 0x52, 0x53, 0x49, 0x6B, 0x50, 0xC3, 0xE8, 0x7B, 0x73, 0xBB, 0xBD, 0x62, 0xB6, 0x42, 0x4D,
-    0xE3, 0x59, 0x97, 0x6E, 0x82, 0xE4, 0xCA, 0xF8, 0x28, 0x04, 0x1D, 0x14, 0xC0, 0x12, 0x40, 0x75,
-    0xA1, 0x57, 0xAC, 0xFD, 0xDD, 0xDA, 0x72, 0x66, 0xAE, 0x3E, 0xE6, 0x79, 0x2D, 0x60, 0x6F, 0x2C,
-    0x57, 0x08, 0x34, 0xFC, 0xC7, 0xFA, 0xC0, 0x2A, 0xC0, 0x30, 0x45, 0x56, 0xB1, 0xD4, 0x45, 0xA7,
-    0x26, 0xAD, 0x3D, 0xE0, 0xF9, 0xBA, 0xBC, 0xA0, 0x40, 0xCD, 0x08, 0x95, 0x03, 0xA7, 0x95, 0xA2,
-    0xD9, 0xA9, 0x53, 0x9C, 0x59, 0x3B, 0xAC, 0x85, 0x4A, 0x21, 0xAF, 0x4C, 0x3A, 0xFB, 0x6D, 0xDE,
-    0x64, 0xD5, 0x19, 0xEC, 0x5D, 0xB5, 0x51, 0xD9, 0x33, 0x56, 0xAD, 0x62, 0x03, 0x32, 0x87, 0xCD,
-    0xA5, 0xCD, 0xAD, 0xFD, 0xCD, 0x8E, 0xEC, 0x48, 0x8E, 0x30, 0x72, 0x00, 0xA9, 0x8B, 0x32, 0xBE,
-    0x57, 0xD4, 0x89, 0xB9, 0x33, 0xB1, 0xBA, 0xDD, 0x53, 0xA3, 0x6D, 0x94, 0x33, 0x68, 0x52, 0xB2,
-    0x83, 0xB3, 0x71, 0x42, 0x77, 0xBD, 0x58, 0x85, 0x06, 0x36, 0x46, 0x90, 0x61, 0x58, 0x83, 0xC7,
-    0xEC, 0x46, 0x2B, 0x65, 0x7C, 0x90, 0x3F, 0x01, 0xF9, 0xA5, 0x57, 0x0E, 0xFD, 0xFF, 0x01, 0xE4,
-    0xC9, 0xB5, 0x07, 0xD3, 0xCF, 0x09, 0x72, 0xDE, 0xB6, 0xAD, 0x82, 0xCF, 0xBD, 0xEF, 0x16, 0x5F,
-    0xED, 0xEB, 0x7F, 0x75, 0x85, 0xC9, 0x56, 0x2D, 0xEF, 0x07, 0x85, 0x8D, 0x0C, 0xAD, 0xF3, 0xEB,
-    0x37, 0xDF, 0x78, 0x78, 0xF3, 0xF5, 0xB4, 0xB5, 0x98, 0x5E, 0x4E, 0xEF, 0xDF, 0x53, 0x29, 0xF0,
-    0x1C, 0x9F, 0x63, 0x9B, 0xDF, 0xAA, 0xB0, 0x85, 0xB9, 0x0D, 0x7C, 0x75, 0xF4, 0xD9, 0xE5, 0xA3,
-    0x1B, 0x2F, 0x2E, 0x06, 0xC1, 0xE9, 0xC0, 0xBB, 0x77, 0x91, 0xD9, 0x7B, 0xAE, 0xCF, 0xDF, 0x57,
-    0xA3, 0x72, 0x61, 0x95, 0x2B, 0x3E, 0xC5, 0x8F, 0x52, 0x74, 0xDD, 0x1B, 0x02, 0x13, 0xFB, 0xEE,
-    0x61, 0xC9, 0x33, 0x0E, 0x13, 0xC0, 0x26, 0x8C, 0xA8, 0xEE, 0x74, 0xCB, 0x33, 0x61, 0xE2, 0x1E,
-    0x72, 0x8F, 0xDD, 0xE5, 0x16, 0x05, 0x9D, 0xEA, 0x21, 0x67, 0x13, 0x34, 0x32, 0x4C, 0xED, 0xEC,
-    0xB1, 0x91, 0xE2, 0x12, 0x77, 0x8A, 0xED, 0x41, 0xA0, 0x8B, 0x05, 0xDF, 0x6C, 0x46, 0xB9, 0xF4,
-    0xB3, 0x48, 0x68, 0x42, 0x73, 0x5E, 0x68, 0x19, 0x26, 0x0B, 0x04, 0x72, 0x98, 0x48, 0x89, 0x79,
-    0x82, 0x4E, 0xAA, 0x28, 0x22, 0x6A, 0x45, 0x2A, 0xD5, 0x42, 0x84, 0x0E, 0x28, 0x50, 0x9D, 0x88,
-    0x48, 0x6F, 0xF3, 0x71, 0x2F, 0x22, 0x76, 0x37, 0x11, 0xFC, 0x68, 0xE4, 0x87, 0x29, 0xD1, 0xEE,
-    0xDB, 0x24, 0xB0, 0x15, 0x9E, 0x67, 0x80, 0xB7, 0x4E, 0x06, 0x73, 0x3E, 0xC8, 0x06, 0xF2, 0x6E,
-    0xDE, 0xE5, 0x35, 0x3C, 0xC7, 0x8B, 0x64, 0x31, 0xC8, 0xF6, 0x5D, 0x23, 0xDE, 0x2D, 0xD8, 0x71,
-    0xDD, 0x20, 0x75, 0x1D, 0x2D, 0xD1, 0xAC, 0x8D, 0xF5, 0xB3, 0xD3, 0xBE, 0xDE, 0x0E, 0x75, 0x49,
-    0xD9, 0x36, 0x55, 0x62, 0x6A, 0x46, 0x57, 0xB3, 0xAD, 0xF0, 0xC0, 0x74, 0x45, 0x9A, 0x4B, 0x2F,
-    0xAB, 0x79, 0x78, 0xC9, 0xA1, 0x94, 0xFD, 0xDC, 0x13, 0x46, 0x26, 0x9B, 0x7E, 0x7A, 0x8A, 0xE7,
-    0x36, 0x7C, 0x5D, 0x86, 0x7A, 0xC8, 0x99, 0x20, 0x4C, 0xEC, 0x15, 0x32, 0x29, 0x03, 0xBD, 0xE4,
-    0xA7, 0xB3, 0x48, 0x2A, 0xC3, 0x5E, 0x1A, 0xE2, 0x4B, 0xA9, 0xF7, 0x83, 0x2C, 0xBE, 0x50, 0x48,
-    0x4D, 0xA5, 0xB6, 0x2A, 0xC9, 0x80, 0xCC, 0x96, 0x0B, 0xB6, 0x70, 0xBA, 0xC6, 0x47, 0x93, 0x1D,
-    0x7F, 0x86, 0xC9, 0x4E, 0x10, 0xED, 0x21, 0x0A, 0x13, 0x46, 0x2C, 0x15, 0x93, 0x7B, 0x06, 0xFB,
-    0xF4, 0xA6, 0x7B, 0x18, 0x92, 0x62, 0xC8, 0x84, 0xDD, 0xBC, 0xE3, 0x33, 0xD1, 0xEC, 0x60, 0xD7,
-    0x51, 0x90, 0x5A, 0xA6, 0x32, 0x0D, 0x75, 0xA8, 0x7D, 0xC5, 0x61, 0x05, 0x5C, 0x64, 0xF5, 0x66,
-    0xE7, 0x61, 0x82, 0xE4, 0x56, 0xA4, 0x32, 0x5F, 0xF7, 0xCF, 0x23, 0x74, 0x23, 0xA3, 0xE3, 0xE6,
-    0x80, 0x31, 0x98, 0x12, 0xE5, 0x14, 0x2F, 0xEA, 0xE5, 0x72, 0xB9, 0xE0, 0xEB, 0xAF, 0x39, 0x24,
-    0xE6, 0x39, 0xE8, 0x02, 0xD5, 0x82, 0x97, 0xAD, 0x6E, 0xE0, 0x4A, 0xB4, 0x9C, 0x4E, 0x7B, 0x79,
-    0xB8, 0x92, 0xD4, 0x31, 0x77, 0xB9, 0xEA, 0x07, 0xB7, 0xEA, 0xA4, 0x2E, 0x69, 0x40, 0x2A, 0x49,
-    0x85, 0x57, 0x78, 0xB9, 0x6F, 0x1C, 0x89, 0x8C, 0x94, 0x92, 0xB4, 0xD0, 0x81, 0xA3, 0x24, 0x4C,
-    0x42, 0x45, 0xA2, 0xDB, 0x31, 0x4D, 0xE3, 0x14, 0x4E, 0x3D, 0xAE, 0x4D, 0x9B, 0x14, 0xAB, 0x98,
-    0xE1, 0x6C, 0xB3, 0x6E, 0x33, 0x38, 0x39, 0xBA, 0xD7, 0x3F, 0xB2, 0x87, 0x56, 0x4D, 0x34, 0x5F,
-    0xC0, 0x78, 0x8A, 0x55, 0x00, 0x74, 0x08, 0xAB, 0x70, 0xB7, 0x37, 0x61, 0xB4, 0xC3, 0x20, 0xBF,
-    0xB3, 0x13, 0xC6, 0xC1, 0x73, 0xC1, 0x81, 0x77, 0xC2, 0xB8, 0x69, 0xE8, 0x20, 0xEA, 0x4D, 0x18,
-    0x49, 0xC6, 0x4D, 0x4A, 0xCC, 0x4D, 0x7C, 0xF8, 0xD7, 0xD1, 0xE8, 0x0B, 0xAB, 0x43, 0xFB, 0x81,
-    0x2D, 0x85, 0xCD, 0xDF, 0x6B, 0xAB, 0xAC, 0xE7, 0x1C, 0xD1, 0x48, 0xEE, 0x0E, 0x76, 0x9C, 0xC7,
-    0x25, 0x07, 0xFB, 0xEE, 0xF1, 0x36, 0xE0, 0xC5, 0x79, 0xA5, 0xAE, 0xDB, 0xE8, 0xAE, 0x03, 0xF9,
-    0x00, 0xD1, 0x75, 0x7F, 0x04, 0x51, 0xE2, 0x1C, 0xF0, 0xFE, 0x09, 0x1C, 0xB2, 0x46, 0x41, 0xEA,
-    0x95, 0x10, 0x85, 0x3B, 0x53, 0x32, 0x89, 0x38, 0x46, 0xDC, 0xEA, 0xD4, 0x0E, 0x42, 0x6D, 0x0D,
-    0xE2, 0xD0, 0x1A, 0x3F, 0x3F, 0x1B, 0xA6, 0x52, 0xB3, 0xF5, 0x62, 0x77, 0x4F, 0x0E, 0x44, 0x13,
-    0x38, 0xAE, 0xED, 0x66, 0xFA, 0x9E, 0x2B, 0x7B, 0xEA, 0x15, 0x2E, 0x95, 0x09, 0xBD, 0x31, 0xFE,
-    0x4C, 0x1C, 0xB1, 0x62, 0x61, 0xC1, 0x81, 0x37, 0xA5, 0xB0, 0xFA, 0xC4, 0x1F, 0x6D, 0x74, 0x89,
-    0x0A, 0x9F, 0xE5, 0x41, 0x98, 0x12, 0x54, 0xB5, 0xAA, 0x76, 0x5C, 0x5D, 0xBC, 0xAC, 0x30, 0xF0,
-    0xE8, 0xB0, 0xF4, 0x6D, 0x81, 0xC2, 0xDF, 0xD9, 0xF7, 0xE8, 0xA7, 0xE3, 0xB2, 0xD1, 0x71, 0x49,
-    0xDE, 0x64, 0xCC, 0x5E, 0xCE, 0x3C, 0x06, 0x29, 0x7D, 0x47, 0x8A, 0xA0, 0xD8, 0x42, 0xA8, 0xA8,
-    0x14, 0xBA, 0x74, 0x48, 0x88, 0x5F, 0xDD, 0x36, 0x74, 0x95, 0xBC, 0x7E, 0x22, 0xC4, 0xB6, 0x2B,
-    0x51, 0x35, 0xD9, 0x63, 0xBA, 0x64, 0x3D, 0x5D, 0xC3, 0xB1, 0x19, 0x7D, 0x9B, 0x89, 0xBB, 0x47,
-    0xF6, 0x5A, 0x66, 0x1A, 0x36, 0x6B, 0xA2, 0x31, 0xA9, 0xEA, 0x34, 0xD2, 0x39, 0x91, 0xB8, 0x66,
-    0x8B, 0x96, 0x73, 0xFE, 0x9B, 0x0E, 0x5D, 0xBF, 0x09, 0x33, 0x90, 0x07, 0xEC, 0x4C, 0xB6, 0x9C,
-    0x2E, 0x22, 0x91, 0x2D, 0xF1, 0x2F, 0x91, 0x5D, 0xB7, 0x04, 0xD5, 0x64, 0x73, 0xE0, 0x2F, 0x45,
-    0x92, 0xB1, 0x8B, 0xD4, 0x40, 0x14, 0xC6, 0xBF, 0xC9, 0xB0, 0xA6, 0x18, 0x70, 0x6A, 0x39, 0x70,
-    0x5A, 0x11, 0xDC, 0xF9, 0x07, 0x92, 0x4D, 0x4E, 0x8B, 0x2B, 0x6C, 0xAE, 0x10, 0xAE, 0xB0, 0xB0,
-    0xB1, 0x52, 0xD0, 0xC6, 0x62, 0x8B, 0xC8, 0x66, 0x2B, 0x3B, 0xB9, 0xC2, 0xCE, 0xC2, 0xC6, 0xEA,
-    0x2C, 0xF6, 0x8A, 0x2D, 0x56, 0x38, 0xDD, 0xD1, 0xD6, 0xC2, 0xB1, 0xBA, 0x76, 0xC0, 0x42, 0xC1,
-    0xC2, 0x41, 0x02, 0x66, 0x25, 0xC9, 0xF8, 0x66, 0xF7, 0xC4, 0x97, 0xC7, 0x0C, 0xE4, 0x3D, 0xBE,
-    0xBC, 0xEF, 0xFD, 0x02, 0x5D, 0x8B, 0x60, 0xDE, 0xE9, 0x5B, 0x76, 0x32, 0xC6, 0xAA, 0xE1, 0xDF,
-    0x8C, 0x7C, 0x84, 0x6C, 0xC5, 0x7E, 0x39, 0x79, 0xDB, 0x9C, 0xA9, 0x97, 0x46, 0x77, 0xB8, 0x52,
-    0x02, 0xB8, 0x06, 0x74, 0xE0, 0x1D, 0xE4, 0x0A, 0xD9, 0x12, 0xDE, 0x73, 0xEB, 0xE5, 0xBE, 0x2F,
-    0xDE, 0x6C, 0x8A, 0xD0, 0x83, 0x9B, 0x98, 0x69, 0x4D, 0x7D, 0x78, 0xF0, 0x9A, 0x07, 0xA7, 0x4E,
-    0xB0, 0x04, 0xB7, 0x50, 0x2D, 0x2E, 0xB5, 0x60, 0x3E, 0x96, 0x15, 0x58, 0x33, 0x5A, 0xD7, 0xEB,
-    0x06, 0x77, 0xA8, 0x8D, 0xAD, 0xA0, 0x36, 0x18, 0xC0, 0x3D, 0x84, 0x81, 0x1C, 0xA0, 0x17, 0x36,
-    0x4F, 0x7C, 0xC6, 0x62, 0xE6, 0xDC, 0xEA, 0x7B, 0x46, 0x0C, 0x60, 0x87, 0xB8, 0x7E, 0x72, 0x10,
-    0xFA, 0xB7, 0x77, 0x3F, 0xC3, 0x1F, 0xE6, 0x10, 0x35, 0x69, 0x5D, 0x5C, 0x13, 0xA4, 0x06, 0x53,
-    0x30, 0x12, 0xD3, 0x75, 0xFA, 0xD3, 0x54, 0xF2, 0xA6, 0xCD, 0xC5, 0xDC, 0xCB, 0x05, 0xB4, 0xE7,
-    0xE7, 0x2E, 0x4F, 0x3F, 0x78, 0x79, 0x60, 0x32, 0xF9, 0xCC, 0xE9, 0x01, 0x23, 0x32, 0xA1, 0x8E,
-    0x11, 0x5A, 0xEE, 0xAA, 0xD4, 0xE4, 0x69, 0x7D, 0x43, 0xD0, 0x69, 0xAB, 0x24, 0x90, 0xC1, 0x06,
-    0xDC, 0x41, 0x19, 0x36, 0xA0, 0x68, 0x30, 0x8A, 0x2E, 0x58, 0xAF, 0xE7, 0xBF, 0x07, 0xFE, 0x7D,
-    0x2A, 0x3F, 0xDA, 0x4A, 0x26, 0x2E, 0x93, 0xFB, 0x2E, 0x13, 0x4B, 0x5F, 0xCC, 0x71, 0x3F, 0xD6,
-    0x93, 0x50, 0x16, 0x6B, 0xEE, 0x72, 0x85, 0xB6, 0x49, 0xBE, 0x1A, 0xF9, 0x0A, 0x79, 0x5C, 0x9A,
-    0xF8, 0x54, 0xE7, 0x8A, 0xBB, 0x62, 0xC0, 0xCC, 0x62, 0x17, 0xEF, 0x65, 0x3F, 0x3A, 0x43, 0x85,
-    0x15, 0x1A, 0x7A, 0x3C, 0xF3, 0x89, 0x23, 0x77, 0xDD, 0xAC, 0xDD, 0xA9, 0xCC, 0xA2, 0xCA, 0x65,
-    0xAA, 0x90, 0x99, 0x1C, 0xA9, 0xC5, 0xD3, 0xB8, 0x8F, 0x16, 0xB2, 0x46, 0x08, 0x5F, 0xC2, 0x10,
-    0x25, 0x64, 0x97, 0xFE, 0x70, 0xA7, 0x63, 0x24, 0x8E, 0x74, 0x66, 0x34, 0x23, 0xA3, 0x96, 0x8A,
-    0xFA, 0x92, 0xE6, 0x61, 0x9F, 0x0E, 0xF8, 0x17, 0x15, 0x92, 0x0E, 0x69, 0x8B, 0xAB, 0x2B, 0x4C,
-    0x1B, 0xE6, 0x7D, 0x6A, 0xBC, 0x62, 0x8E, 0x00, 0x69, 0x32, 0x19, 0x01, 0x51, 0x96, 0x71, 0x05,
-    0xC1, 0x8E, 0x01, 0x82, 0xD2, 0x42, 0xF4, 0x91, 0x2B, 0xB6, 0x80, 0x34, 0x12, 0xBF, 0x17, 0xFE,
-    0x4F, 0x8E, 0xB4, 0x47, 0x71, 0xCC, 0xDA, 0x08, 0x52, 0xBE, 0x80, 0x0A, 0xF5, 0xF8, 0xC8, 0xED,
-    0x00, 0x65, 0x89, 0x9B, 0x70, 0x4B, 0x6F, 0xA8, 0x85, 0xA2, 0x08, 0xE7, 0xA1, 0x3F, 0x15, 0xCF,
-    0x89, 0x4A, 0x06, 0x59, 0x6E, 0xE7, 0xA4, 0x2B, 0xA2, 0xA2, 0x6F, 0x3E, 0xB9, 0x90, 0x23, 0xB7,
-    0x93, 0xC7, 0x89, 0xCB, 0x45, 0xE9, 0x95, 0xA8, 0x75, 0x83, 0x60, 0x94, 0x34, 0xC4, 0x88, 0x76,
-    0xC6, 0x7C, 0xB1, 0x28, 0xB5, 0xDB, 0xF6, 0x11, 0xD1, 0x99, 0x67, 0x7F, 0x3A, 0x6E, 0x33, 0x22,
-    0x25, 0xEA, 0x9C, 0x4E, 0xBE, 0x39, 0xA3, 0xC1, 0xE3, 0x9F, 0x44, 0x2B, 0xD2, 0xE5, 0x5E, 0x0F,
-    0xBD, 0x1D, 0xF3, 0x2F, 0x5D, 0x50, 0xA1, 0x52, 0xC3, 0x40, 0x10, 0x7D, 0x97, 0x40, 0x4F, 0x9C,
-    0x48, 0x07, 0x83, 0x6B, 0x3D, 0x82, 0x58, 0x44, 0x87, 0xE4, 0x13, 0x22, 0x28, 0x08, 0x04, 0x86,
-    0xCF, 0x68, 0xA7, 0x31, 0x78, 0x4C, 0x31, 0x18, 0x04, 0xAA, 0x06, 0x53, 0x59, 0x26, 0x37, 0xC3,
-    0x0F, 0x64, 0xF8, 0x82, 0x08, 0xAA, 0x39, 0x11, 0x66, 0x32, 0x4C, 0x93, 0xED, 0x6E, 0x6E, 0x2A,
-    0x60, 0x67, 0x76, 0x2F, 0xB7, 0xFB, 0xF2, 0xF6, 0xDD, 0x43, 0x42, 0x54, 0x6A, 0xA2, 0x16, 0x7A,
-    0x7B, 0x53, 0x62, 0x8E, 0x09, 0x8C, 0x0D, 0x2D, 0x76, 0x18, 0x22, 0xCA, 0x01, 0x34, 0x9C, 0xE3,
-    0xE5, 0x3D, 0x02, 0xA2, 0x1C, 0xC9, 0xEA, 0x05, 0x61, 0xC5, 0x9D, 0x39, 0xE7, 0xED, 0x36, 0x45,
-    0x44, 0x35, 0x10, 0xD9, 0x03, 0x2E, 0xE5, 0x64, 0x98, 0xA6, 0x1D, 0x0E, 0x31, 0x20, 0x2E, 0x05,
-    0x17, 0x53, 0xBE, 0x03, 0x33, 0xD4, 0x4C, 0xC0, 0xFC, 0x63, 0x1C, 0x01, 0x82, 0x12, 0xBA, 0xE0,
-    0x8D, 0x79, 0x23, 0x22, 0x8B, 0xD0, 0x01, 0xEA, 0xEE, 0x21, 0xF3, 0xB7, 0xD3, 0x9F, 0x29, 0xBC,
-    0x0A, 0xD9, 0x17, 0x38, 0x41, 0x2E, 0xAF, 0xD7, 0x3C, 0x23, 0x9B, 0x3C, 0x15, 0x1D, 0x5E, 0xF1,
-    0x27, 0x0A, 0x7A, 0xEC, 0x4F, 0x06, 0xB8, 0xFE, 0xE3, 0xC4, 0x99, 0xCA, 0x77, 0x6C, 0x2F, 0x12,
-    0x48, 0x10, 0x7B, 0x6C, 0x83, 0x4D, 0x28, 0x2D, 0x5D, 0x06, 0x6E, 0x24, 0x8D, 0x98, 0x37, 0xAD,
-    0xA1, 0x32, 0x56, 0xB5, 0x89, 0xC9, 0x16, 0x55, 0x58, 0x8D, 0x3F, 0xA9, 0x35, 0xCF, 0x79, 0xF4,
-    0xBD, 0x63, 0xE1, 0x13, 0x60, 0xD1, 0xA5, 0x41, 0xA5, 0x1C, 0x02, 0x79, 0x74, 0xCA, 0x5A, 0x85,
-    0x74, 0x02, 0x5D, 0xE3, 0x92, 0x65, 0x3B, 0x84, 0xB5, 0xE2, 0x89, 0x96, 0x67, 0x18, 0x9E, 0x9C,
-    0x07, 0x43, 0x6D, 0x65, 0x5D, 0x33, 0x73, 0x23, 0x43, 0x25, 0x42, 0xFA, 0xF8, 0x75, 0x85, 0x18,
-    0xD4, 0xE8, 0x0E, 0xFF, 0x43, 0x15, 0x8D, 0xD8, 0xC7, 0x03, 0xCA, 0xE6, 0xCC, 0xC5, 0xCC, 0xCC,
-    0x7F, 0x21, 0xAE, 0x0E, 0x65, 0x01, 0xBB, 0x30, 0xBD, 0x82, 0x91, 0xB7, 0x1D, 0xB7, 0xD3, 0xCC,
-    0x5B, 0x1E, 0x8B, 0x4F, 0x67, 0xDD, 0x2A, 0xF7, 0xD7, 0xDE, 0x52, 0xB4, 0x52, 0x16, 0xE0, 0xDF,
-    0xE2, 0xAF, 0x41, 0xE5, 0xBD, 0x54, 0x42, 0x0C, 0x05, 0xEC, 0x01, 0x65, 0x53, 0x3D, 0x6F, 0xD3,
-    0x50, 0x14, 0x3D, 0xF6, 0xAB, 0xB0, 0x84, 0x25, 0x5E, 0xD9, 0x29, 0x59, 0x58, 0x63, 0x2F, 0x1D,
-    0xF3, 0x61, 0xB5, 0x48, 0x0C, 0x0C, 0xB0, 0x44, 0x4C, 0x88, 0xFE, 0x01, 0x04, 0x43, 0x05, 0x0C,
-    0x11, 0x72, 0x58, 0x3A, 0x78, 0xE1, 0x0F, 0x94, 0x1F, 0x90, 0x39, 0x43, 0x86, 0x8A, 0x3A, 0x65,
-    0x60, 0xB5, 0x60, 0x60, 0x35, 0x59, 0x3A, 0xB0, 0x18, 0xC9, 0x48, 0x19, 0x22, 0x3F, 0xCE, 0x7D,
-    0xFE, 0xA0, 0x11, 0x4F, 0x3E, 0xF6, 0x7B, 0x2F, 0xF7, 0x9E, 0x73, 0xBF, 0x82, 0x7D, 0x00, 0x43,
-    0x62, 0xD4, 0x20, 0x20, 0x42, 0x63, 0xCC, 0x2F, 0x62, 0xB3, 0xE4, 0xC1, 0x8F, 0xF9, 0x92, 0x8D,
-    0x8E, 0xF8, 0x12, 0xD4, 0x97, 0xFE, 0x06, 0xBE, 0x89, 0xFD, 0xF3, 0xA5, 0x7F, 0xF6, 0x64, 0xB6,
-    0xCA, 0x32, 0x9C, 0x02, 0x07, 0x80, 0x17, 0xC1, 0xC9, 0x80, 0x05, 0xD0, 0xB7, 0x66, 0x6E, 0x6E,
-    0xBD, 0x83, 0xEE, 0x20, 0xCB, 0x11, 0x14, 0xA2, 0x44, 0xB8, 0xB2, 0x09, 0x3A, 0xCD, 0x46, 0xAD,
-    0xC5, 0x94, 0xD8, 0x6B, 0x35, 0xFF, 0x23, 0xAB, 0x65, 0x1A, 0x4D, 0x1B, 0x80, 0xEF, 0x1D, 0x1F,
-    0xFD, 0xFE, 0x9E, 0x87, 0x6F, 0x73, 0xD7, 0xE4, 0x08, 0xF3, 0x4E, 0x93, 0x4B, 0xA5, 0x1A, 0x28,
-    0x49, 0x39, 0xA4, 0x3A, 0xD3, 0xF1, 0xBE, 0x50, 0xD0, 0x8C, 0x89, 0xA2, 0xA4, 0x92, 0xCA, 0xD0,
-    0x63, 0x96, 0x7E, 0x8A, 0x01, 0x8A, 0xDA, 0x83, 0xCA, 0x3A, 0x85, 0xDE, 0x42, 0x9B, 0x54, 0x3F,
-    0x9F, 0xEA, 0xB3, 0xC7, 0xE9, 0x2C, 0x8B, 0x77, 0x53, 0xB5, 0x87, 0x5B, 0xDE, 0xD1, 0xF1, 0xCF,
-    0x6F, 0xC5, 0xE8, 0x4D, 0xA1, 0x4C, 0x81, 0x71, 0x01, 0x45, 0x86, 0x7D, 0x4B, 0xC0, 0x50, 0x1B,
-    0x82, 0xF3, 0x0B, 0x12, 0xAC, 0x66, 0xD9, 0xC7, 0x1D, 0x82, 0x93, 0xD3, 0x07, 0xA3, 0x83, 0x50,
-    0x5D, 0xBF, 0x42, 0x58, 0xC1, 0xAD, 0x24, 0xBD, 0x9E, 0x31, 0x3F, 0x8C, 0x29, 0xDB, 0xB8, 0xBD,
-    0xD4, 0x56, 0x8B, 0xA5, 0xD0, 0x92, 0x04, 0x24, 0xBA, 0x01, 0x0E, 0x35, 0x46, 0x2A, 0x0D, 0x50,
-    0x04, 0x18, 0x84, 0x93, 0x17, 0xDA, 0x98, 0xAB, 0x3F, 0x93, 0xA7, 0x61, 0x5D, 0x50, 0xF9, 0x34,
-    0xBD, 0x92, 0xC6, 0x75, 0x4E, 0x37, 0x19, 0x7C, 0x68, 0x95, 0x5B, 0x06, 0x37, 0x1F, 0x4E, 0xDE,
-    0x93, 0x60, 0x35, 0x79, 0x96, 0x43, 0xB5, 0x0F, 0x4E, 0x1A, 0x82, 0xDB, 0x36, 0x06, 0x87, 0x41,
-    0x30, 0x8C, 0xA9, 0x53, 0xB2, 0x4C, 0x25, 0x59, 0x18, 0x5F, 0xC1, 0xDA, 0x6D, 0xC7, 0xF3, 0xF9,
-    0x5C, 0xCC, 0xED, 0xFC, 0xD8, 0xCD, 0x00, 0x37, 0xD6, 0x1D, 0x09, 0x21, 0xAE, 0xE1, 0xD3, 0x3E,
-    0x91, 0x4E, 0x73, 0x6F, 0x1B, 0x23, 0x6D, 0xFF, 0x40, 0xE4, 0x32, 0x77, 0xF6, 0xE6, 0xB0, 0xF5,
-    0xDB, 0xEB, 0xC6, 0x2C, 0x89, 0xF5, 0x7A, 0xAB, 0x37, 0x97, 0x5F, 0x3F, 0xF5, 0x17, 0x8F, 0x92,
-    0x87, 0xCE, 0x3A, 0xC3, 0xBB, 0x05, 0x82, 0x3E, 0x7F, 0x89, 0xDC, 0x75, 0x8E, 0xE5, 0x12, 0x41,
-    0x20, 0x66, 0x72, 0xE8, 0x96, 0xCB, 0x34, 0x71, 0x61, 0x07, 0xE7, 0x92, 0x73, 0x25, 0x4A, 0xED,
-    0x28, 0x07, 0xBC, 0xA8, 0x78, 0x51, 0x35, 0x03, 0x2F, 0xF0, 0x1A, 0xB7, 0x28, 0xDA, 0xE5, 0x93,
-    0x43, 0x1F, 0x5E, 0x12, 0xD5, 0xB2, 0xCE, 0xFD, 0xFE, 0xDD, 0xEB, 0xE4, 0x65, 0xB8, 0xAE, 0xDC,
-    0xCD, 0x67, 0x31, 0xAB, 0x3B, 0xF6, 0x6F, 0xBD, 0x56, 0x1C, 0xAC, 0xAC, 0x17, 0xB1, 0x5D, 0x3A,
-    0x52, 0x14, 0x85, 0x0C, 0x98, 0xD4, 0x5C, 0xCB, 0x3F, 0x68, 0xCA, 0x32, 0x73, 0x14, 0x58, 0x36,
-    0xB6, 0x82, 0x8D, 0xD5, 0x11, 0xDB, 0x7A, 0x0F, 0x59, 0xED, 0xFC, 0x17, 0xB5, 0x57, 0x3F, 0x6C,
-    0xDC, 0xD6, 0x1D, 0xFE, 0x3D, 0xD2, 0x12, 0x51, 0x73, 0x60, 0x06, 0xAB, 0x83, 0x5C, 0xE7, 0x65,
-    0x75, 0x8B, 0x88, 0x4B, 0x86, 0x0E, 0xD2, 0x91, 0x8A, 0x87, 0x0E, 0x1D, 0x22, 0xA0, 0xBA, 0x76,
-    0xE8, 0xDA, 0xC9, 0x8B, 0x16, 0x0D, 0x19, 0x4E, 0x3E, 0x36, 0x1D, 0x3B, 0x44, 0x43, 0x8B, 0x8C,
-    0xF1, 0xE0, 0x16, 0x36, 0x33, 0x5C, 0x86, 0x0C, 0x2A, 0x70, 0x36, 0x29, 0x1B, 0xAD, 0x87, 0x0E,
-    0x61, 0x1A, 0x14, 0x1E, 0x3A, 0xF4, 0x8A, 0x36, 0x11, 0x50, 0x1B, 0x0D, 0x6D, 0x50, 0xF5, 0x49,
-    0xE6, 0xDD, 0xEB, 0xF7, 0x3D, 0x92, 0x52, 0xEC, 0xB4, 0x89, 0xE3, 0xA0, 0x84, 0x48, 0xDD, 0xFB,
-    0xF1, 0xBD, 0xDF, 0xFF, 0x3F, 0x1F, 0x45, 0x44, 0x9C, 0xA9, 0x88, 0x7B, 0x50, 0x8A, 0x84, 0x6F,
-    0x14, 0x22, 0x75, 0x98, 0x88, 0x57, 0x44, 0x58, 0xC9, 0x4D, 0x91, 0xA9, 0x9A, 0xA7, 0xA3, 0xDC,
-    0x35, 0xC6, 0x88, 0x7F, 0xF8, 0xE3, 0x4A, 0x82, 0xDC, 0xCF, 0x25, 0x8A, 0x7B, 0x22, 0x57, 0x14,
-    0x4E, 0xD4, 0x41, 0x22, 0x4E, 0xB5, 0x86, 0xF3, 0x8F, 0xB0, 0x0A, 0x3E, 0x8C, 0x45, 0x74, 0x0D,
-    0x96, 0xD1, 0x04, 0x8F, 0x0C, 0xB7, 0xAA, 0xF8, 0x10, 0x3E, 0x62, 0xF1, 0x4D, 0xEE, 0x1E, 0x1B,
-    0x79, 0x4D, 0x41, 0x20, 0xD8, 0xC8, 0x0E, 0xCE, 0x61, 0x63, 0x4F, 0xFC, 0x83, 0xD2, 0x37, 0xC6,
-    0xAD, 0x74, 0x39, 0x96, 0x9E, 0x8E, 0xDD, 0xBF, 0x97, 0xB2, 0xB6, 0x26, 0xDE, 0xDD, 0x5C, 0xC6,
-    0x63, 0x09, 0x7E, 0x99, 0x2B, 0xD2, 0xFD, 0xC2, 0xCB, 0x87, 0xAA, 0x72, 0xCD, 0x4C, 0xFC, 0xB9,
-    0xB4, 0x57, 0x68, 0xCC, 0x7D, 0x63, 0xEA, 0x4D, 0x81, 0xC2, 0x41, 0x2E, 0x2E, 0x75, 0x12, 0xBB,
-    0xF8, 0xFD, 0xA6, 0xF7, 0xD8, 0x98, 0x19, 0x35, 0x7F, 0xE6, 0x0D, 0x16, 0x87, 0xFD, 0x75, 0xD3,
-    0x5C, 0x71, 0xC7, 0x69, 0x29, 0x76, 0x63, 0xB0, 0xAB, 0x22, 0xF1, 0x8C, 0x79, 0x52, 0x4A, 0xB6,
-    0xEB, 0x19, 0xF1, 0x4A, 0x71, 0xA7, 0x3C, 0x14, 0x56, 0x50, 0xDA, 0x79, 0x3C, 0xC1, 0xE1, 0x30,
-    0xC8, 0x7B, 0x30, 0x3A, 0x04, 0x41, 0xC7, 0x3B, 0x5E, 0xA1, 0x2A, 0x55, 0xE9, 0x58, 0xC7, 0x5E,
-    0xB1, 0x03, 0x6B, 0xC3, 0xF5, 0xA9, 0x8E, 0x65, 0xEC, 0x96, 0x53, 0x88, 0xF4, 0xFF, 0x9A, 0x48,
-    0x18, 0xEB, 0x29, 0x45, 0x87, 0xB9, 0xE8, 0x42, 0x4C, 0xB1, 0x38, 0x97, 0x60, 0x64, 0x4C, 0x21,
-    0xB5, 0x36, 0x53, 0x51, 0xB9, 0xDA, 0x94, 0x93, 0xEB, 0x0C, 0xFD, 0x84, 0xDD, 0x12, 0x40, 0x5B,
-    0x19, 0xC2, 0x45, 0xAE, 0x49, 0xB0, 0x82, 0x02, 0xB2, 0x87, 0x68, 0xB8, 0x1F, 0xE1, 0xA5, 0xA6,
-    0x29, 0x53, 0xBF, 0x10, 0x2F, 0xD7, 0xD0, 0x86, 0xDA, 0x55, 0x72, 0x8B, 0x0E, 0xAD, 0xE1, 0x4A,
-    0xB7, 0x44, 0x5C, 0x7C, 0xEA, 0x19, 0xE4, 0x88, 0x4B, 0xF4, 0x3A, 0x02, 0x70, 0x2B, 0x80, 0xA1,
-    0x75, 0x84, 0x47, 0x69, 0xC5, 0xD0, 0xEE, 0x3B, 0x7C, 0x04, 0x4F, 0xC7, 0x7B, 0xC6, 0x78, 0xD7,
-    0xE0, 0x0B, 0x09, 0x11, 0x98, 0xC8, 0x17, 0xE3, 0xED, 0x3F, 0x77, 0xBC, 0xED, 0x75, 0xDE, 0x98,
-    0x09, 0xDC, 0x69, 0x92, 0xEC, 0x57, 0x42, 0x67, 0xDA, 0x00, 0x88, 0xC3, 0x1F, 0xD0, 0xD0, 0x66,
-    0x40, 0x73, 0xC4, 0xA7, 0x3A, 0x5B, 0xB8, 0x67, 0x3B, 0x9D, 0x0F, 0x68, 0xA6, 0xC0, 0xCC, 0x76,
-    0xAB, 0xE6, 0x2F, 0x7D, 0xD4, 0xEF, 0x8B, 0x36, 0x66, 0x2E, 0x8B, 0xC6, 0x4C, 0x3B, 0x29, 0xAB,
-    0x0D, 0x4F, 0x95, 0x81, 0x3E, 0x04, 0xDD, 0x3F, 0x7A, 0xBD, 0x94, 0xA1, 0x04, 0x09, 0x58, 0xAC,
-    0xC2, 0x2E, 0x68, 0x5E, 0x63, 0xE5, 0x15, 0x58, 0xE9, 0x18, 0x3B, 0x33, 0x08, 0xFA, 0x37, 0x25,
-    0xDE, 0x2B, 0xF0, 0x4E, 0x27, 0xC8, 0xE2, 0x48, 0x60, 0xD5, 0xCD, 0xCE, 0x46, 0x35, 0xC3, 0x4A,
-    0x99, 0xC3, 0xFE, 0x86, 0xC2, 0xAE, 0x09, 0xB9, 0x26, 0xCA, 0xEA, 0x83, 0x70, 0xC8, 0xB9, 0xD6,
-    0xB4, 0x8A, 0xA6, 0x4D, 0xB2, 0x4F, 0xFA, 0x7D, 0xAF, 0x6A, 0x4D, 0x13, 0x2A, 0xE5, 0x4D, 0x96,
-    0xFA, 0x9B, 0xC8, 0x4C, 0x33, 0xC5, 0x39, 0xF3, 0xB7, 0xEA, 0x69, 0x63, 0xE8, 0x2A, 0x3D, 0x4F,
-    0xD3, 0x5D, 0xDA, 0x9C, 0xA8, 0xCB, 0xE9, 0x0D, 0x9E, 0x73, 0x8C, 0x39, 0xB2, 0x5E, 0x80, 0x4B,
-    0x17, 0x32, 0x4A, 0x89, 0xE2, 0x8E, 0xE7, 0x15, 0x3E, 0xEA, 0xCE, 0x55, 0xDE, 0x3D, 0x6A, 0xFE,
-    0x2E, 0x7D, 0x75, 0xE2, 0xBD, 0xA2, 0xDD, 0xDA, 0x24, 0x0F, 0xDC, 0xA5, 0x66, 0xAA, 0xDF, 0xCF,
-    0x0A, 0x28, 0x51, 0xC3, 0xDA, 0x79, 0x9B, 0xE5, 0x01, 0x1F, 0xBD, 0xA6, 0x6C, 0x76, 0xE9, 0x85,
-    0x0A, 0x05, 0xF8, 0xD3, 0x29, 0x72, 0xC7, 0x45, 0xA8, 0xA9, 0x24, 0xAA, 0x6E, 0x22, 0x63, 0xB2,
-    0x80, 0x5F, 0x62, 0x54, 0xE7, 0x0E, 0x4D, 0x38, 0x32, 0xD6, 0x0B, 0x6B, 0xC2, 0xD4, 0x46, 0x5B,
-    0x50, 0x25, 0xB6, 0xBA, 0x85, 0x4E, 0xE0, 0x0F, 0xE8, 0xA5, 0x75, 0xB1, 0xD4, 0x1F, 0xCE, 0x60,
-    0x82, 0x29, 0x7C, 0x32, 0x85, 0xBD, 0x45, 0xE7, 0xAC, 0x05, 0xA1, 0xF7, 0x76, 0xF9, 0xB2, 0x82,
-    0x4E, 0x5B, 0xD6, 0x84, 0x53, 0x97, 0xE4, 0xFD, 0xFE, 0x46, 0xF8, 0x43, 0xBC, 0x9C, 0xD3, 0x61,
-    0xF6, 0xE5, 0x53, 0xC6, 0x84, 0xFB, 0x69, 0x3A, 0xAA, 0xAD, 0xAB, 0x96, 0xD3, 0x74, 0xA3, 0xB1,
-    0xC3, 0x66, 0xCB, 0x8C, 0x9A, 0xCD, 0x63, 0x66, 0x2E, 0x03, 0xAD, 0x6C, 0x9D, 0xEA, 0xFF, 0xF3,
-    0xCF, 0x6C, 0x57, 0xB6, 0xFE, 0x91, 0x99, 0x24, 0x32, 0x7F, 0x48, 0xAF, 0x3A, 0xE9, 0x75, 0xDB,
-    0xD9, 0x18, 0x69, 0x6A, 0x9F, 0xA0, 0x2D, 0xD5, 0xB0, 0xCD, 0xCB, 0x51, 0xEC, 0xAB, 0x62, 0xC4,
-    0x89, 0x5D, 0xDA, 0xA0, 0xF3, 0xB6, 0x3A, 0xEC, 0x8A, 0x45, 0x87, 0x7A, 0x6D, 0xE2, 0xE4, 0x54,
-    0x6D, 0x7C, 0xB9, 0xB0, 0x1E, 0xB9, 0xC9, 0x03, 0x89, 0x7C, 0xC7, 0x7A, 0x18, 0xCE, 0x5D, 0x45,
-    0x7D, 0x9E, 0xBF, 0xD3, 0x15, 0x70, 0x92, 0xA6, 0xE9, 0x55, 0xFC, 0xC7, 0xEF, 0xBC, 0xF1, 0xC5,
-    0x4A, 0x1B, 0x57, 0xE4, 0x30, 0x04, 0x37, 0x9E, 0xB7, 0x05, 0xC6, 0x7B, 0x0F, 0xF7, 0x00, 0xF7,
-    0x1A, 0x3D, 0xD9, 0x6E, 0xF4, 0x9F, 0xDD, 0x58, 0x3D, 0xB3, 0x51, 0x73, 0x63, 0x6C, 0x3B, 0xB6,
-    0xC8, 0x07, 0xAC, 0x1E, 0x37, 0xE7, 0x29, 0x6D, 0x5F, 0xEF, 0x59, 0x42, 0x41, 0x42, 0x60, 0x09,
-    0x03, 0x8A, 0x72, 0x26, 0xE4, 0x89, 0x53, 0x2B, 0xB6, 0x1C, 0xAB, 0xF6, 0x94, 0xB2, 0xF1, 0xA7,
-    0x2A, 0x81, 0xA8, 0xA4, 0x3C, 0x17, 0xBD, 0x11, 0xE4, 0xB7, 0x9E, 0x4C, 0x04, 0x81, 0xF6, 0x66,
-    0x68, 0xB4, 0x33, 0x67, 0xFA, 0xA8, 0x7E, 0x35, 0xF0, 0x92, 0x66, 0x4B, 0xA3, 0xB4, 0x64, 0x93,
-    0x70, 0x74, 0x37, 0x5F, 0xDB, 0x73, 0xEE, 0xC7, 0x2F, 0xEF, 0x39, 0x07, 0xC5, 0x20, 0x34, 0xF1,
-    0x56, 0xA2, 0x2F, 0xD5, 0xD1, 0xBE, 0x6D, 0x2F, 0x1B, 0x6D, 0x16, 0xDB, 0x4C, 0x19, 0xB7, 0xB6,
-    0x5B, 0x33, 0xC2, 0x2E, 0xAF, 0x68, 0x07, 0x8D, 0x94, 0xF1, 0x42, 0x1F, 0xAF, 0x0D, 0xBA, 0x62,
-    0x60, 0xF0, 0xDA, 0xA9, 0x90, 0xD3, 0x41, 0xB2, 0xC6, 0x40, 0xC1, 0xA8, 0x1C, 0x01, 0xD9, 0x81,
-    0xD6, 0xEE, 0x43, 0x8E, 0x3F, 0xE8, 0xAE, 0x1E, 0x83, 0x67, 0xC0, 0x5A, 0xCB, 0xF2, 0x36, 0x4F,
-    0xA3, 0x8E, 0xE7, 0x99, 0xC6, 0xE1, 0xC3, 0x78, 0x25, 0x9C, 0xFB, 0xF7, 0x3E, 0x3A, 0x9A, 0x7C,
-    0xE0, 0xD6, 0x01, 0xBC, 0x52, 0xAA, 0xCA, 0x4F, 0x86, 0xF9, 0x70, 0xA4, 0xDF, 0x32, 0xF9, 0x15,
-    0x68, 0xB7, 0x8B, 0x89, 0x7A, 0x4B, 0x4C, 0x39, 0xAC, 0x7B, 0xFE, 0xDB, 0x3F, 0xB8, 0x97, 0x47,
-    0xF9, 0xCA, 0x9B, 0x52, 0xA9, 0x83, 0x44, 0x27, 0x2F, 0x0F, 0xDC, 0xB9, 0xFB, 0xF1, 0x71, 0x39,
-    0xAF, 0x83, 0xDA, 0x35, 0xB2, 0x24, 0x0B, 0xB6, 0x34, 0x6D, 0x6F, 0xB1, 0xFA, 0xD2, 0xF9, 0x36,
-    0x12, 0xDF, 0x90, 0xF4, 0x4F, 0x24, 0x8A, 0x66, 0xD6, 0x0C, 0x4F, 0xDA, 0x3E, 0xAF, 0xD7, 0xA4,
-    0x6B, 0x2A, 0x61, 0xD2, 0x65, 0xA6, 0x6D, 0xAF, 0x36, 0x2B, 0x7D, 0xF6, 0x26, 0xDB, 0xA6, 0xED,
-    0xC3, 0xAD, 0xBA, 0x9C, 0x75, 0x6C, 0xF7, 0xA9, 0xBB, 0x3E, 0xC4, 0x49, 0xD1, 0xE4, 0x30, 0xDA,
-    0x2C, 0x19, 0x42, 0xDA, 0x35, 0xA6, 0xE7, 0x2C, 0xB4, 0x33, 0xF5, 0x5C, 0xEF, 0x4B, 0xAE, 0x8B,
-    0x9B, 0x0B, 0xA1, 0xF7, 0xC7, 0xFD, 0x47, 0xE5, 0x60, 0xAC, 0x5F, 0xEC, 0xC7, 0xB2, 0x93, 0x34,
-    0xD6, 0xD8, 0xB0, 0xD8, 0x86, 0xCA, 0x68, 0xB9, 0x9F, 0x71, 0x1C, 0x31, 0x31, 0xA6, 0x63, 0xA6,
-    0x37, 0xB4, 0x0F, 0xED, 0xAC, 0x84, 0x7F, 0xBC, 0x1C, 0x39, 0x12, 0x32, 0x3F, 0xA6, 0x18, 0x3A,
-    0x20, 0xB0, 0xAA, 0x91, 0xFD, 0x68, 0x80, 0x85, 0xCF, 0x59, 0x89, 0x63, 0x7A, 0x1D, 0x27, 0x7A,
-    0xF4, 0xC6, 0xB8, 0xD7, 0x36, 0x56, 0xDB, 0xCF, 0xBD, 0x3F, 0x31, 0x39, 0x98, 0x6C, 0x53, 0x30,
-    0x41, 0x71, 0x4B, 0x33, 0x2D, 0x2A, 0xF8, 0xC2, 0x07, 0x36, 0xE1, 0xD4, 0x9D, 0x60, 0xBB, 0xCF,
-    0x59, 0xA9, 0x39, 0x2B, 0x7B, 0x8C, 0xC1, 0x80, 0x9C, 0x38, 0x2B, 0x1D, 0xCE, 0x4A, 0xEF, 0xC3,
-    0xA4, 0x4D, 0xAC, 0xB0, 0xEC, 0x9A, 0x3B, 0x57, 0x8B, 0xD7, 0xD8, 0x1F, 0x2B, 0xF6, 0xC8, 0x78,
-    0x18, 0x7B, 0x80, 0x1F, 0x12, 0x41, 0x8A, 0x7F, 0xB7, 0x10, 0x75, 0x88, 0x9D, 0x6B, 0x30, 0x25,
-    0x18, 0xC1, 0x9C, 0xFB, 0xE0, 0x76, 0x0C, 0x42, 0xEF, 0xF9, 0x08, 0xD6, 0x43, 0xE1, 0xD7, 0x3F,
-    0x47, 0xC2, 0x01, 0x08, 0x87, 0x30, 0x7F, 0x07, 0xA6, 0x84, 0x48, 0x0C, 0xBD, 0x3F, 0x07, 0x7C,
-    0xD1, 0x04, 0x2D, 0x68, 0x7D, 0xA2, 0xFA, 0xE4, 0xBD, 0xB8, 0x0B, 0xC5, 0x61, 0xC1, 0x7C, 0x06,
-    0x3F, 0xAE, 0x5A, 0x20, 0xE7, 0x75, 0x77, 0xF1, 0xCD, 0x6F, 0x8E, 0x34, 0xB8, 0x73, 0x15, 0x4E,
-    0x1C, 0x8E, 0x62, 0x89, 0x66, 0x8D, 0x44, 0x91, 0x97, 0xBA, 0xC4, 0xD4, 0x13, 0x5B, 0x8C, 0x78,
-    0xFC, 0x4C, 0xBE, 0xFA, 0x5A, 0x60, 0x3F, 0x43, 0x7F, 0x0E, 0xEF, 0x40, 0x67, 0x83, 0x9C, 0x71,
-    0x6A, 0x4B, 0x62, 0x7B, 0x22, 0x5D, 0x9F, 0xD2, 0xBF, 0xD5, 0xB6, 0xBE, 0xAF, 0xBA, 0xCE, 0x7D,
-    0x51, 0x13, 0x2A, 0x17, 0x0F, 0x83, 0x72, 0xB6, 0x78, 0xCA, 0x20, 0x8E, 0xFC, 0xF2, 0x96, 0xF3,
-    0xE2, 0x82, 0xFE, 0x97, 0xE6, 0xB2, 0x49, 0xD4, 0x30, 0x71, 0x6F, 0x1F, 0x9B, 0x77, 0x26, 0xE5,
-    0xA2, 0x99, 0xBC, 0x24, 0x90, 0xAA, 0xAE, 0xCB, 0x82, 0x6B, 0x2A, 0xF7, 0xCE, 0x61, 0x76, 0xBF,
-    0x98, 0x28, 0x84, 0xEC, 0x73, 0x70, 0x4C, 0xD0, 0x14, 0xAE, 0xB3, 0x4E, 0x17, 0xFA, 0xFD, 0xFE,
-    0x89, 0xE4, 0xEF, 0x82, 0x4A, 0x84, 0xB8, 0x0F, 0xE2, 0x86, 0xB3, 0x2B, 0xEB, 0xA6, 0x58, 0x89,
-    0xB2, 0xBF, 0xDC, 0xCB, 0xB3, 0xE9, 0x2B, 0x18, 0x47, 0x17, 0xE5, 0x8C, 0x9E, 0x39, 0x1F, 0x9B,
-    0xD9, 0xCD, 0x81, 0x6F, 0xEE, 0xC8, 0x79, 0xC8, 0x11, 0x15, 0x1C, 0xA7, 0xD9, 0x6D, 0x82, 0x02,
-    0x75, 0xF9, 0x37, 0xA7, 0xEC, 0x97, 0xB3, 0x1B, 0x04, 0x97, 0x75, 0xEF, 0xD7, 0xFD, 0x51, 0x4B,
-    0x7A, 0x05, 0xF3, 0x60, 0xA1, 0xBF, 0xF5, 0x23, 0x50, 0xD3, 0x51, 0x2A, 0x3E, 0x7A, 0x6D, 0xAE,
-    0x7E, 0xF2, 0xE7, 0x4D, 0x6C, 0xFB, 0xDE, 0x71, 0x9A, 0x20, 0xED, 0xBE, 0xFF, 0x5F, 0xB4, 0xE8,
-    0x18, 0x9E, 0x05, 0xF1, 0x17, 0x6C, 0x60, 0x20, 0x9E, 0xE0, 0x64, 0xA7, 0x9D, 0x81, 0xF5, 0x12,
-    0xA8, 0x2D, 0x6D, 0xDB, 0xC2, 0xE5, 0x21, 0x90, 0x5A, 0xC1, 0xBF, 0xA8, 0x10, 0x17, 0x19, 0xE3,
-    0xF3, 0x9E, 0x36, 0x37, 0x51, 0x38, 0xE6, 0xAA, 0x0D, 0x91, 0xED, 0x59, 0x16, 0x03, 0xDB, 0xBE,
-    0x06, 0x1F, 0xE1, 0x80, 0x10, 0x75, 0x31, 0xBD, 0xDB, 0x1B, 0x3D, 0x4F, 0x65, 0x09, 0x7E, 0x35,
-    0x7F, 0xB6, 0x61, 0x9E, 0x46, 0xEB, 0xF4, 0xB8, 0xBD, 0xDE, 0x14, 0x07, 0xB5, 0x0F, 0x64, 0x19,
-    0x7B, 0x73, 0x7E, 0x2C, 0x98, 0x18, 0x32, 0x87, 0x85, 0x03, 0xB0, 0x8F, 0xDA, 0x4E, 0xC8, 0x1F,
-    0xC8, 0x4E, 0x57, 0x6C, 0x54, 0x98, 0x7C, 0x21, 0xA2, 0x68, 0xB7, 0x60, 0xED, 0x31, 0xB6, 0x5D,
-    0xBB, 0x69, 0x05, 0x4C, 0xE8, 0x28, 0xBC, 0xC6, 0x31, 0xCB, 0x8F, 0xCA, 0xE1, 0x18, 0xCE, 0x81,
-    0xB3, 0xF8, 0xA5, 0x35, 0x36, 0x07, 0x77, 0xDD, 0x4A, 0x21, 0x67, 0xEE, 0xC0, 0x56, 0xA8, 0xBA,
-    0x63, 0xCB, 0xB1, 0xE1, 0x35, 0x34, 0xC7, 0x31, 0xC1, 0x57, 0xB9, 0x08, 0x20, 0x75, 0x02, 0xBE,
-    0xBC, 0x06, 0x7C, 0x31, 0x79, 0xE3, 0x76, 0x9A, 0x5A, 0xB8, 0x75, 0x0A, 0xBE, 0xEA, 0x16, 0x7C,
-    0xBD, 0x37, 0xEB, 0xC0, 0xD7, 0x6E, 0xF7, 0x89, 0x62, 0xD1, 0x82, 0x45, 0x78, 0xBA, 0x5D, 0x2D,
-    0xA3, 0x37, 0x30, 0x78, 0x3F, 0x37, 0xE9, 0xFC, 0x86, 0x2E, 0xF0, 0x6E, 0x86, 0x77, 0x2E, 0xA1,
-    0x24, 0x50, 0x64, 0xC1, 0x7F, 0xEC, 0xB6, 0x63, 0xF0, 0xC7, 0x2A, 0x48, 0x02, 0x76, 0x40, 0xB4,
-    0x9B, 0xE8, 0x12, 0xF4, 0x1C, 0x7E, 0x96, 0xA6, 0x71, 0x44, 0x50, 0xEF, 0x1D, 0xA7, 0xD7, 0x1A,
-    0x90, 0xCA, 0x41, 0x46, 0x1B, 0x2C, 0x10, 0x69, 0x00, 0x77, 0x53, 0x2B, 0xFA, 0x19, 0xF9, 0x8A,
-    0x30, 0x98, 0x1A, 0xE6, 0xCB, 0xE9, 0x28, 0x03, 0x6D, 0x0F, 0x1F, 0x0A, 0x80, 0xA6, 0x88, 0x06,
-    0xDB, 0xDF, 0x98, 0xBE, 0x28, 0xD0, 0xC5, 0x83, 0x06, 0xD8, 0x5A, 0x6D, 0x6A, 0xAE, 0xA8, 0x4D,
-    0xB6, 0xF8, 0xDE, 0xF1, 0xA8, 0x0A, 0x29, 0xFA, 0xF2, 0x3C, 0x8D, 0x5B, 0x89, 0x4F, 0xC9, 0x5F,
-    0x38, 0xCD, 0x6E, 0xE0, 0xE5, 0x09, 0xE7, 0xDB, 0x5B, 0x84, 0xD3, 0x76, 0x72, 0xD6, 0xD2, 0x34,
-    0xBC, 0xC6, 0x89, 0xE3, 0x13, 0x84, 0x7E, 0xF2, 0xD1, 0x62, 0x87, 0x6C, 0x54, 0x34, 0xF9, 0x62,
-    0x12, 0xFB, 0xE5, 0xA2, 0xBA, 0xFC, 0x46, 0xF6, 0xF6, 0xFD, 0x0E, 0xF9, 0x4E, 0xDB, 0x8F, 0x00,
-    0x93, 0xF8, 0x16, 0x6B, 0x8B, 0x6C, 0x4D, 0xBA, 0xB1, 0xDC, 0xB0, 0x8A, 0xDB, 0xEF, 0x25, 0x39,
-    0x89, 0x93, 0xEE, 0x86, 0x08, 0xE7, 0xB6, 0x32, 0x3C, 0x58, 0x86, 0xF4, 0xC7, 0x52, 0x57, 0x17,
-    0x8A, 0x75, 0x63, 0xD9, 0x67, 0x0D, 0xD7, 0x25, 0x2B, 0x05, 0x19, 0xE7, 0x7F, 0xFA, 0x29, 0x9C,
-    0x92, 0x6C, 0xFB, 0x79, 0x10, 0x5F, 0x90, 0x81, 0x97, 0x78, 0xB1, 0x7F, 0x29, 0x47, 0x29, 0x3C,
-    0x2C, 0x50, 0x4C, 0xAF, 0xBE, 0x2F, 0x17, 0xC4, 0x45, 0xB8, 0x62, 0x31, 0xA7, 0x57, 0x49, 0xE2,
-    0x03, 0x12, 0x0F, 0x62, 0xEC, 0xDC, 0x2E, 0xB1, 0x73, 0x75, 0x05, 0xC4, 0x15, 0xB7, 0xF0, 0x62,
-    0x8D, 0xB1, 0x57, 0x00, 0x61, 0x1D, 0xFD, 0x0E, 0xC0, 0x40, 0xDB, 0x8F, 0x93, 0x25, 0x6B, 0xE8,
-    0xA9, 0xCC, 0x4F, 0xBE, 0x4D, 0x99, 0x42, 0x99, 0x42, 0x99, 0x20, 0x5D, 0xA2, 0x6D, 0x0F, 0x69,
-    0x0D, 0x64, 0x0A, 0x65, 0xB6, 0x1F, 0xA8, 0x27, 0x32, 0x85, 0x32, 0x71, 0x1D, 0xD0, 0xDA, 0x6D,
-    0xAE, 0x57, 0x89, 0x79, 0x57, 0x98, 0x00, 0x9A, 0x99, 0x4B, 0x99, 0xEA, 0x39, 0x64, 0x02, 0x8E,
-    0xD6, 0xDE, 0x58, 0xD4, 0x93, 0x4B, 0x77, 0x73, 0x55, 0x3D, 0x2C, 0x06, 0xAA, 0xBA, 0xF0, 0xBE,
-    0xB7, 0x5F, 0x41, 0xE6, 0x4E, 0x29, 0xF6, 0x63, 0x3F, 0xCA, 0x91, 0xF7, 0x41, 0xA9, 0x9E, 0xE4,
-    0xEE, 0x03, 0x55, 0x0E, 0xE4, 0x60, 0xBD, 0xF4, 0xF2, 0x6D, 0x80, 0xC3, 0xC1, 0xEA, 0x4A, 0x29,
-    0xDE, 0xBF, 0x08, 0x27, 0x86, 0x5F, 0x47, 0x66, 0x4C, 0x99, 0x09, 0x65, 0x42, 0x3A, 0x64, 0x0A,
-    0x65, 0xE2, 0x01, 0x99, 0x48, 0x15, 0xC3, 0x07, 0x64, 0x56, 0x94, 0x09, 0x28, 0xF2, 0x80, 0xE9,
-    0x73, 0x40, 0x18, 0xB2, 0xFD, 0xB0, 0xA2, 0x9D, 0x15, 0xED, 0xAC, 0xBE, 0xC4, 0xCE, 0x0E, 0x91,
-    0x45, 0x9F, 0xFF, 0x84, 0x78, 0x21, 0xC2, 0x62, 0x9A, 0xA5, 0xBF, 0x65, 0x36, 0x32, 0x53, 0x92,
-    0xB3, 0x00, 0xDB, 0xB7, 0x91, 0x68, 0x67, 0x45, 0x5D, 0x95, 0x8B, 0xD0, 0x6E, 0x66, 0xE7, 0x4F,
-    0x96, 0x60, 0xB6, 0xE1, 0x94, 0xEA, 0xBE, 0xBD, 0xFF, 0x03, 0x3D, 0xCE, 0xD1, 0x0D, 0x83, 0x30,
-    0x0C, 0x04, 0x50, 0x13, 0x7F, 0xF2, 0x91, 0x15, 0x3A, 0x01, 0x19, 0x01, 0xC4, 0x1A, 0x9D, 0xA0,
-    0x53, 0x96, 0x15, 0xCA, 0x04, 0x16, 0x0C, 0x80, 0x07, 0x88, 0xB8, 0x9E, 0x5D, 0xA9, 0xFE, 0x79,
-    0x39, 0xE5, 0x22, 0x47, 0x44, 0x1E, 0x12, 0x53, 0x2C, 0x69, 0x49, 0x41, 0x32, 0x3D, 0x83, 0xB2,
-    0xE5, 0xDD, 0x24, 0x03, 0x29, 0xFD, 0x15, 0xA9, 0x01, 0x6A, 0xAC, 0x01, 0xD5, 0x22, 0xF4, 0x66,
-    0x11, 0xFC, 0x6D, 0x0C, 0x58, 0x71, 0x00, 0xF7, 0x52, 0x71, 0x02, 0x9B, 0xB0, 0x0A, 0xB0, 0xE4,
-    0x8A, 0x3E, 0xF2, 0xA4, 0xAC, 0xC1, 0xC9, 0x87, 0x81, 0xF0, 0x59, 0x70, 0x31, 0x88, 0xF6, 0xEA,
-    0x81, 0xCF, 0xB1, 0x5F, 0x77, 0x4F, 0x90, 0x5F, 0x53, 0xFF, 0x21, 0xFF, 0xF9, 0x02,
+static const uint8_t bookerly_14_italicBitmaps[29186] = {
+    0xC5, 0x9A, 0x3F, 0xAC, 0x24, 0xC7, 0x7D, 0xE7, 0x3F, 0xDD, 0xB5, 0xFB, 0xCA, 0x50, 0x41, 0xAA,
+    0x0D, 0x28, 0x48, 0xF6, 0xD2, 0x2C, 0x07, 0x0E, 0x08, 0x9C, 0xF4, 0xFA, 0x02, 0x06, 0x0A, 0xDE,
+    0x4C, 0x17, 0x49, 0xC0, 0x07, 0x98, 0x81, 0x16, 0x38, 0xED, 0x19, 0x38, 0x07, 0x52, 0x70, 0x17,
+    0x9C, 0x7C, 0xD0, 0x2A, 0x50, 0xC0, 0x60, 0xFE, 0x34, 0xC5, 0x80, 0x81, 0x03, 0x6F, 0x74, 0xB8,
+    0xCC, 0x0C, 0x7C, 0x38, 0xF9, 0x19, 0x77, 0xCB, 0x80, 0x38, 0xBC, 0x03, 0xE6, 0xED, 0x14, 0xC9,
+    0x80, 0xC0, 0x39, 0x50, 0x49, 0xC2, 0x9D, 0x02, 0x05, 0x2E, 0x59, 0xE2, 0x11, 0x10, 0x01, 0x6D,
+    0x49, 0x6C, 0x52, 0xCD, 0x65, 0xCF, 0xFC, 0x2E, 0xA8, 0x9E, 0xDD, 0xF7, 0x56, 0x32, 0x60, 0x5B,
+    0x3C, 0x72, 0xF0, 0x7A, 0x76, 0x67, 0xBA, 0xA7, 0xEA, 0x57, 0x55, 0xBF, 0xFA, 0xFE, 0xBE, 0xBF,
+    0xEF, 0xAF, 0xB8, 0x8A, 0xED, 0x4C, 0x54, 0x99, 0x81, 0x25, 0x0D, 0xB6, 0x53, 0x91, 0xCC, 0x82,
+    0x27, 0x30, 0xBE, 0x0E, 0x64, 0x4E, 0xF8, 0x1D, 0x00, 0xD8, 0xD0, 0x7A, 0x1B, 0x2A, 0x4F, 0xED,
+    0x6F, 0xF7, 0x33, 0xA7, 0x5F, 0xCF, 0x9B, 0x63, 0xF3, 0x62, 0xEC, 0x4F, 0xAC, 0xEA, 0xD2, 0x53,
+    0x9F, 0x2E, 0x0F, 0x71, 0xA2, 0x02, 0xBA, 0xFB, 0x12, 0xBC, 0xAA, 0x3D, 0x96, 0x57, 0x38, 0xBD,
+    0x7F, 0xE7, 0xAF, 0xAD, 0x88, 0xC4, 0x3A, 0x1E, 0xC3, 0x17, 0xEA, 0x80, 0x0A, 0x27, 0xF0, 0x25,
+    0x15, 0x30, 0xDD, 0x19, 0xAD, 0x88, 0x1C, 0xDD, 0x39, 0xBD, 0xFF, 0x32, 0xD9, 0xC2, 0x13, 0x55,
+    0xA2, 0x8E, 0x5F, 0x2C, 0xCD, 0x5C, 0x78, 0x19, 0xC0, 0x02, 0x9F, 0x01, 0xBE, 0x01, 0x46, 0x22,
+    0xEB, 0xED, 0xC8, 0xF0, 0xA5, 0xF3, 0x3A, 0x7F, 0x6B, 0xAE, 0xD2, 0x2B, 0x33, 0x95, 0x33, 0xF5,
+    0x90, 0x40, 0x22, 0xAC, 0x13, 0xD8, 0x1D, 0x28, 0xF1, 0xE8, 0x5B, 0xE1, 0x9A, 0x31, 0xE9, 0x55,
+    0xAB, 0xD3, 0xF0, 0x19, 0x9D, 0xC6, 0xDF, 0x37, 0x71, 0xFB, 0x1F, 0x9B, 0xAE, 0x95, 0x3D, 0x5A,
+    0x7A, 0x78, 0x1E, 0x78, 0x05, 0xC8, 0xE5, 0xAA, 0x13, 0x54, 0xFE, 0x62, 0xDF, 0x55, 0x87, 0xEB,
+    0xA1, 0xC7, 0xDD, 0xF1, 0x0C, 0xB8, 0x3A, 0xB1, 0xC1, 0xFA, 0x05, 0x0B, 0x74, 0xB0, 0xCC, 0xA8,
+    0xA3, 0x0E, 0xC7, 0xD0, 0x57, 0xC9, 0xC1, 0x09, 0xBD, 0x05, 0xEB, 0x17, 0xD6, 0x7F, 0xA3, 0x4E,
+    0x33, 0xD3, 0x49, 0x5E, 0x9D, 0xEB, 0x30, 0x1C, 0xEB, 0x9D, 0x0A, 0x67, 0x3A, 0x50, 0xC7, 0x13,
+    0x32, 0x75, 0x3A, 0xE6, 0x84, 0x2A, 0x5B, 0xEF, 0xA0, 0x57, 0xD1, 0x74, 0x9C, 0xD1, 0xAB, 0xC0,
+    0x86, 0xE3, 0x3A, 0xB1, 0x40, 0xFF, 0x9F, 0xCC, 0x1C, 0xB6, 0x09, 0xFB, 0xA8, 0x41, 0xC0, 0xD6,
+    0x03, 0x4E, 0x3C, 0xD0, 0xCF, 0x01, 0xD3, 0x9D, 0x01, 0x27, 0x2A, 0x42, 0x95, 0x1D, 0x60, 0x5E,
+    0xCF, 0x5C, 0xA1, 0x59, 0xC1, 0x53, 0x6C, 0x3B, 0x74, 0x34, 0x99, 0xEB, 0xFB, 0xEA, 0xC3, 0x78,
+    0x5D, 0x3A, 0x6B, 0x5F, 0x90, 0x40, 0xDF, 0xE8, 0x2F, 0xA3, 0xBB, 0x39, 0x27, 0xCC, 0x38, 0xAF,
+    0x23, 0x3D, 0xA3, 0x45, 0xC5, 0x6A, 0xD7, 0x63, 0x43, 0x25, 0x1D, 0x2E, 0xEA, 0x3D, 0x34, 0x22,
+    0xD2, 0xE1, 0x24, 0x6E, 0xDF, 0xA3, 0xF2, 0xDC, 0x1A, 0x00, 0xAE, 0xFA, 0xFA, 0xD9, 0xEF, 0xE5,
+    0xCD, 0xB1, 0x7D, 0x36, 0xA4, 0xA7, 0x8A, 0x49, 0x75, 0x40, 0x27, 0x74, 0xC4, 0x04, 0x4C, 0x40,
+    0x07, 0x54, 0x44, 0x25, 0xAA, 0x0C, 0x03, 0x2C, 0xE0, 0x18, 0xAC, 0x47, 0x05, 0xAA, 0x0C, 0x0B,
+    0x68, 0xC0, 0x94, 0x0F, 0x27, 0x60, 0x3D, 0x75, 0xF9, 0xDA, 0x76, 0x54, 0x19, 0x1A, 0x50, 0x09,
+    0x66, 0x50, 0x95, 0x0E, 0x9E, 0x84, 0x39, 0xD8, 0x0E, 0x15, 0xA9, 0x33, 0xF4, 0xB0, 0x81, 0x13,
+    0x98, 0xC3, 0x31, 0x34, 0x17, 0xFE, 0x8E, 0x61, 0x0E, 0x33, 0x58, 0xC0, 0x40, 0x95, 0x51, 0x09,
+    0x13, 0x70, 0x9E, 0x19, 0x0C, 0xE8, 0x44, 0xE3, 0xD9, 0xC0, 0xB5, 0x62, 0x79, 0x7C, 0x7C, 0xAE,
+    0xDE, 0x0D, 0xEE, 0xD5, 0x1B, 0x4E, 0xCC, 0x7B, 0xEF, 0xBE, 0xDB, 0x7D, 0xE1, 0x04, 0x95, 0xA6,
+    0x9B, 0x16, 0x54, 0x80, 0xC9, 0x48, 0xAC, 0xC8, 0xBB, 0x22, 0x23, 0xB3, 0x47, 0xEE, 0x5C, 0x05,
+    0xBE, 0x66, 0x93, 0xEB, 0x96, 0x75, 0xB6, 0x7E, 0xB0, 0xDD, 0xBF, 0xE3, 0xEB, 0xA7, 0x6B, 0x79,
+    0x47, 0xFA, 0x23, 0xF3, 0x93, 0x61, 0xBC, 0x02, 0x70, 0x3C, 0x39, 0xB1, 0xED, 0x40, 0x07, 0x50,
+    0x11, 0xEA, 0xC9, 0xED, 0x38, 0x03, 0x16, 0xC0, 0x0C, 0x68, 0xA6, 0x07, 0xCD, 0xA3, 0x0F, 0xF6,
+    0x8F, 0x3C, 0xE8, 0x00, 0xEB, 0x2F, 0xF9, 0x87, 0x16, 0x8F, 0x96, 0x3D, 0xF5, 0xEE, 0x4F, 0x7B,
+    0x56, 0x34, 0xC1, 0x06, 0x46, 0x95, 0xB1, 0x61, 0x05, 0xA3, 0x09, 0xD8, 0x30, 0xC2, 0xE8, 0x3A,
+    0xEC, 0xEB, 0x3D, 0xD5, 0xD0, 0x42, 0xF3, 0x6C, 0x46, 0xE5, 0x16, 0x56, 0x2A, 0x63, 0x43, 0x4B,
+    0xDD, 0xAB, 0x81, 0x15, 0x2E, 0x36, 0x01, 0x91, 0x44, 0x2D, 0x09, 0x38, 0xF4, 0xB1, 0xC0, 0x8D,
+    0xB5, 0x0C, 0xFC, 0x4D, 0x4F, 0x9D, 0x51, 0x19, 0x55, 0x96, 0x3D, 0x62, 0x02, 0x36, 0x60, 0x3B,
+    0x9C, 0xA7, 0x81, 0x16, 0x5A, 0x58, 0xC1, 0x39, 0x4E, 0xF2, 0x5A, 0x72, 0xF9, 0xFD, 0xAD, 0x81,
+    0x4A, 0x24, 0x54, 0xFB, 0x3F, 0x19, 0x19, 0x59, 0xB3, 0xC0, 0x86, 0xCF, 0xA0, 0x32, 0x54, 0x23,
+    0xB0, 0x03, 0xEE, 0x02, 0xDB, 0x0B, 0xD7, 0xBE, 0x5C, 0xD5, 0x0E, 0xEA, 0x01, 0x54, 0x0F, 0x6A,
+    0x7F, 0x7A, 0xFA, 0x8C, 0x88, 0x84, 0xB5, 0x48, 0x9C, 0x36, 0xAA, 0x44, 0x9C, 0x8C, 0xAC, 0xFF,
+    0xD3, 0x8E, 0x91, 0x15, 0x99, 0x15, 0x70, 0x5E, 0xDA, 0xD5, 0x19, 0xD6, 0x1D, 0xD7, 0x05, 0x1A,
+    0x89, 0x5C, 0x31, 0xB9, 0xB4, 0x53, 0xF7, 0xA0, 0x32, 0x98, 0x04, 0xEB, 0xC0, 0x75, 0x61, 0x2D,
+    0x03, 0xAD, 0x74, 0x07, 0xB7, 0x03, 0xB0, 0x01, 0x6C, 0x02, 0xDB, 0x17, 0x5C, 0xB1, 0x7F, 0x09,
+    0xF6, 0xCF, 0x03, 0xF6, 0x8D, 0x84, 0x0D, 0x3D, 0x36, 0x2C, 0xB0, 0xA1, 0xC1, 0x06, 0xDB, 0xD9,
+    0xA0, 0x92, 0x89, 0x55, 0x6F, 0x44, 0xE4, 0x7D, 0x11, 0x19, 0xA7, 0x05, 0x8F, 0xA5, 0x2F, 0x36,
+    0x40, 0x0B, 0x38, 0xD9, 0xD1, 0xC8, 0x48, 0x7B, 0xFA, 0x1D, 0x96, 0xD3, 0xF7, 0xD3, 0xF8, 0x2B,
+    0x49, 0xD4, 0xB2, 0x83, 0x4A, 0x80, 0xB6, 0x03, 0x17, 0x26, 0x23, 0x02, 0x34, 0x1E, 0xD6, 0x50,
+    0xEF, 0xE0, 0x56, 0xCF, 0x56, 0x02, 0xDB, 0x01, 0xAE, 0x5C, 0x00, 0x87, 0x88, 0x92, 0x9F, 0x62,
+    0x76, 0x93, 0xC1, 0xA9, 0x5C, 0x26, 0x81, 0x7E, 0xEF, 0x06, 0x4A, 0x24, 0x54, 0x72, 0x67, 0xE4,
+    0x9C, 0x36, 0xB4, 0xA8, 0x6C, 0x03, 0xA3, 0x4A, 0xB4, 0x0C, 0xD8, 0xD0, 0xA2, 0x93, 0x8D, 0x2A,
+    0x57, 0xA3, 0xEA, 0x69, 0xA4, 0x2F, 0x8B, 0x5F, 0x01, 0x5A, 0x64, 0xB0, 0x22, 0xA3, 0xFD, 0xD9,
+    0xDF, 0x8C, 0x0D, 0x2A, 0xCF, 0x30, 0xE1, 0x84, 0xC6, 0xC3, 0x12, 0x18, 0xCA, 0x34, 0xDA, 0x00,
+    0x4D, 0x07, 0xEB, 0x32, 0x9A, 0x7A, 0x28, 0x33, 0x6F, 0x63, 0x19, 0x43, 0xEB, 0xCB, 0xE0, 0xE7,
+    0x5C, 0xB0, 0xB8, 0xAC, 0xDB, 0xC0, 0xDA, 0xEF, 0x18, 0x59, 0x55, 0x3D, 0xCB, 0xBA, 0x67, 0x53,
+    0x0D, 0xD5, 0xC0, 0x5E, 0x27, 0xD6, 0xD2, 0xE1, 0x46, 0xD8, 0xEE, 0x51, 0xFD, 0x3A, 0xD8, 0x60,
+    0x63, 0x8B, 0xCE, 0x2B, 0x54, 0x5E, 0xA1, 0xD2, 0x1A, 0x1B, 0xDB, 0xAE, 0xED, 0x1A, 0xD9, 0xA3,
+    0x25, 0xC1, 0x63, 0x0F, 0x26, 0xA2, 0xA7, 0x12, 0xE9, 0xD8, 0xE9, 0x9E, 0x91, 0x35, 0x2B, 0x6C,
+    0x68, 0xA8, 0x7B, 0x1B, 0x38, 0x57, 0x99, 0x86, 0x11, 0x1B, 0x9A, 0xA0, 0x92, 0xDA, 0xFF, 0x59,
+    0xCF, 0x5A, 0x46, 0xAA, 0xFF, 0xB0, 0xA3, 0x18, 0x7F, 0xB8, 0xB6, 0x9E, 0x5A, 0xE0, 0xD6, 0x1E,
+    0xD6, 0xC3, 0x61, 0xA7, 0x3D, 0xC6, 0x58, 0x8F, 0xF5, 0xC0, 0x8D, 0x8B, 0x98, 0x7C, 0x44, 0xD3,
+    0xB5, 0x5D, 0xCB, 0x15, 0xA8, 0x3C, 0x23, 0x2E, 0xD4, 0x03, 0x57, 0x1F, 0x01, 0x6E, 0x8E, 0x50,
+    0x03, 0xAE, 0xAB, 0x7A, 0x1A, 0x54, 0x64, 0x60, 0xCE, 0xD1, 0x61, 0x67, 0xBD, 0x0A, 0xDB, 0xC0,
+    0x36, 0x4E, 0x7F, 0x6D, 0x87, 0xDA, 0x81, 0xDE, 0x81, 0x39, 0x5C, 0x63, 0x41, 0x85, 0x6B, 0x37,
+    0x6F, 0xDE, 0x6C, 0x45, 0xFE, 0xD7, 0xE9, 0xE9, 0xCB, 0xE5, 0xA7, 0x9F, 0xBD, 0x79, 0xF3, 0xCB,
+    0x22, 0xBF, 0x3C, 0x3D, 0xFD, 0x0E, 0x50, 0x45, 0x68, 0x23, 0x6C, 0x23, 0x6C, 0x03, 0x6C, 0x3B,
+    0xD8, 0x76, 0xD4, 0x23, 0x95, 0xF8, 0x4A, 0x7C, 0x2D, 0xBE, 0x16, 0x8F, 0xF3, 0xE0, 0xA1, 0xFE,
+    0x2B, 0x24, 0x37, 0xF2, 0xDA, 0xED, 0x73, 0x54, 0x64, 0x86, 0x0A, 0xF4, 0xCC, 0xB1, 0x9D, 0x4E,
+    0x0C, 0x1C, 0xA3, 0xEE, 0xD3, 0x24, 0xFE, 0xAA, 0xF4, 0xD3, 0xA2, 0x33, 0xAB, 0x69, 0x1A, 0xFE,
+    0xED, 0x5F, 0x03, 0x34, 0x22, 0x11, 0xCC, 0xFE, 0xE6, 0x9D, 0x44, 0xB5, 0x07, 0x93, 0x68, 0x3A,
+    0x30, 0xA1, 0xEA, 0x01, 0xDB, 0x39, 0x7F, 0x94, 0x6E, 0x37, 0x0C, 0x88, 0xF8, 0x85, 0x09, 0xF6,
+    0xDB, 0x63, 0x95, 0x67, 0x6C, 0xEA, 0xA4, 0x5F, 0xCB, 0x3A, 0x18, 0xEF, 0x4C, 0xD7, 0x70, 0xC2,
+    0xD9, 0x8C, 0xBE, 0xCA, 0x2A, 0xF6, 0x2A, 0xD8, 0xAE, 0x51, 0xC1, 0x71, 0x4E, 0xEF, 0x58, 0xE8,
+    0x57, 0x6D, 0x37, 0x63, 0xF8, 0x1F, 0xFF, 0x77, 0xA0, 0x57, 0xF2, 0x9C, 0x78, 0x95, 0xD4, 0x4F,
+    0xCD, 0x6D, 0x4C, 0x21, 0x08, 0xAE, 0x03, 0x8A, 0xCF, 0x5D, 0x83, 0x36, 0x72, 0x3D, 0x40, 0x23,
+    0x32, 0x02, 0xD7, 0x65, 0xEF, 0x01, 0xBE, 0x32, 0xCD, 0xEF, 0x55, 0x28, 0x5E, 0x5A, 0x96, 0x16,
+    0xDB, 0x03, 0xF5, 0xBD, 0x0E, 0x38, 0x19, 0x01, 0xFB, 0x5C, 0x80, 0x2A, 0x6F, 0x80, 0x99, 0x8E,
+    0x60, 0xC2, 0x1C, 0xC8, 0x2A, 0xC1, 0x31, 0x2D, 0xA8, 0xB7, 0xFE, 0x24, 0x83, 0x88, 0x78, 0xDC,
+    0xE9, 0xE9, 0x80, 0x4A, 0xB8, 0x8E, 0x0D, 0x8C, 0x58, 0x8F, 0x0D, 0x75, 0x86, 0x5D, 0xB5, 0xBD,
+    0xCD, 0xAD, 0xDD, 0x5A, 0x70, 0x12, 0xE1, 0xA6, 0x47, 0x8B, 0x44, 0xE4, 0x67, 0xE2, 0x59, 0x56,
+    0x23, 0x26, 0x98, 0xC8, 0xC8, 0x12, 0xDB, 0x99, 0x50, 0xF5, 0x8C, 0x38, 0x1A, 0xEA, 0xFB, 0x77,
+    0x02, 0xAD, 0x0C, 0xA8, 0xB7, 0x6E, 0x65, 0x96, 0x34, 0x9D, 0x09, 0x8C, 0x6C, 0xB0, 0xC1, 0x06,
+    0x46, 0x06, 0x5C, 0xE7, 0xBC, 0xCA, 0x75, 0xAE, 0x76, 0xB5, 0x88, 0xF8, 0xED, 0x34, 0x34, 0xE0,
+    0xAA, 0x87, 0x46, 0x7A, 0x1A, 0x91, 0x60, 0xFA, 0x6A, 0xAC, 0x07, 0x74, 0x58, 0xC1, 0x99, 0x0D,
+    0x98, 0xBA, 0x9F, 0xE0, 0x46, 0x25, 0xCA, 0x46, 0x35, 0x61, 0x02, 0x1B, 0x13, 0x0A, 0x3A, 0x62,
+    0x52, 0x99, 0x90, 0x2B, 0x6A, 0xA4, 0x8E, 0xEE, 0x83, 0x7F, 0x33, 0xB2, 0x96, 0x3D, 0x6C, 0xF7,
+    0x4C, 0x21, 0xF2, 0xB3, 0x37, 0xC0, 0x89, 0x44, 0xAC, 0xDC, 0x11, 0x70, 0xDE, 0x65, 0x4C, 0x40,
+    0x50, 0x19, 0x1B, 0x19, 0xA8, 0x07, 0x56, 0xB0, 0xC6, 0x79, 0x6C, 0x30, 0x01, 0x95, 0x55, 0xA6,
+    0x1A, 0x18, 0x60, 0xC5, 0x12, 0x1A, 0xDF, 0x4C, 0x77, 0x74, 0x52, 0x19, 0x95, 0x19, 0x50, 0x3D,
+    0x4B, 0x54, 0x4F, 0xE3, 0xAF, 0xF7, 0x6C, 0x45, 0x12, 0x17, 0x06, 0x55, 0x02, 0xB3, 0x88, 0xC4,
+    0x23, 0x11, 0xA1, 0xEA, 0x59, 0x60, 0x02, 0x99, 0x16, 0xE5, 0x19, 0x0E, 0x03, 0x72, 0x1E, 0xD8,
+    0xE0, 0x51, 0x22, 0x1D, 0x56, 0x76, 0xB0, 0x62, 0x02, 0x5A, 0x13, 0x80, 0x96, 0xAA, 0x63, 0xC0,
+    0xA2, 0x23, 0x0B, 0x1A, 0xFF, 0xB9, 0x64, 0x44, 0x84, 0x6D, 0x71, 0x10, 0xC0, 0x88, 0xEC, 0xB8,
+    0x25, 0x12, 0x58, 0xB2, 0xC0, 0x04, 0x15, 0x18, 0x79, 0x0A, 0xDB, 0x15, 0x4C, 0xC3, 0xF9, 0x29,
+    0xF6, 0xB6, 0xD2, 0xA3, 0x44, 0xA6, 0x49, 0x8C, 0xD3, 0x24, 0xDA, 0xF0, 0xC8, 0x73, 0xB5, 0x0C,
+    0xB0, 0x95, 0x00, 0x70, 0xF5, 0x06, 0x18, 0xD9, 0x53, 0x8B, 0x08, 0x4D, 0xAC, 0x87, 0x7A, 0x40,
+    0x45, 0xD7, 0x61, 0x19, 0xE1, 0x4B, 0x26, 0x4E, 0x6B, 0xC3, 0x40, 0x09, 0x10, 0x34, 0x9E, 0x9B,
+    0x5F, 0xD9, 0xA0, 0xE5, 0x97, 0x99, 0xAB, 0x5B, 0x13, 0x61, 0x68, 0x3A, 0x74, 0x6C, 0xA1, 0x41,
+    0x60, 0x83, 0xDC, 0xBE, 0x9E, 0x2B, 0x11, 0xF1, 0x6C, 0x25, 0x72, 0x31, 0x48, 0x35, 0x12, 0xAC,
+    0xA4, 0x23, 0xB9, 0x5D, 0x4B, 0x2A, 0x0B, 0x81, 0x09, 0xA8, 0x84, 0xCA, 0x54, 0x3D, 0x8C, 0xB0,
+    0x81, 0x39, 0xB4, 0xE0, 0x3C, 0xB6, 0xC3, 0xFC, 0xEF, 0x9B, 0x7F, 0x9A, 0x50, 0x22, 0xD2, 0xC3,
+    0xFE, 0xF4, 0x74, 0x84, 0x15, 0xB4, 0xD0, 0x94, 0xDB, 0x01, 0x1D, 0x51, 0x99, 0xBA, 0x87, 0x01,
+    0x36, 0xB0, 0x2C, 0xB7, 0xC1, 0x76, 0x6C, 0x47, 0x6E, 0xED, 0xD9, 0x0A, 0xAD, 0x4C, 0x7B, 0x50,
+    0xE2, 0x91, 0xDC, 0xC6, 0x79, 0x4C, 0x40, 0x65, 0x18, 0x61, 0xCE, 0x85, 0xCF, 0x03, 0xC5, 0x17,
+    0x1E, 0xF9, 0x0C, 0xDB, 0x1D, 0x5B, 0xF1, 0x0F, 0xC6, 0x11, 0x39, 0x92, 0x78, 0x21, 0x6C, 0xE6,
+    0x29, 0x34, 0xB6, 0xFC, 0x86, 0x2F, 0xE7, 0x13, 0x08, 0x98, 0x5F, 0xFB, 0xD2, 0x17, 0x1F, 0x50,
+    0x79, 0x9A, 0xE1, 0x0D, 0x55, 0x3C, 0x2F, 0x6E, 0xED, 0x76, 0x17, 0x60, 0x01, 0x6A, 0x19, 0x9D,
+    0x84, 0x23, 0xB9, 0xED, 0x06, 0xAA, 0x9E, 0x15, 0x98, 0x60, 0x12, 0xB4, 0x9C, 0x03, 0xA3, 0x8D,
+    0xA0, 0xD2, 0x08, 0xB8, 0x2F, 0x07, 0xE0, 0x7C, 0x00, 0x94, 0x04, 0xC0, 0xDE, 0xF1, 0xC0, 0xB2,
+    0x05, 0xEA, 0xFE, 0x2E, 0x60, 0xC2, 0x0E, 0x68, 0xAB, 0x1D, 0x30, 0xD4, 0x23, 0xE8, 0xA8, 0x46,
+    0x68, 0x50, 0x3B, 0x8C, 0x24, 0xB5, 0x67, 0x2B, 0x41, 0xED, 0xE1, 0x21, 0xA3, 0x2A, 0x03, 0xBE,
+    0xFD, 0x88, 0xC5, 0xFF, 0xE0, 0x30, 0x96, 0xC5, 0x4F, 0x0E, 0x5F, 0x7E, 0x9A, 0x01, 0xE3, 0x97,
+    0xA8, 0xD0, 0xF8, 0xCF, 0xE5, 0xAD, 0x48, 0xFF, 0xD0, 0xB9, 0x01, 0x23, 0x1D, 0xCD, 0x9E, 0x23,
+    0xE9, 0x68, 0x07, 0x90, 0xC0, 0x36, 0x80, 0x04, 0x3E, 0x0C, 0x54, 0x1F, 0x86, 0xFA, 0x9D, 0x40,
+    0xFD, 0x76, 0xD4, 0x7F, 0x1B, 0x50, 0x3F, 0x88, 0xF6, 0xCB, 0x01, 0xFD, 0x46, 0x72, 0x36, 0x60,
+    0xDE, 0x48, 0x33, 0xDB, 0x61, 0x9F, 0xC9, 0xCF, 0xDB, 0x0E, 0x5B, 0xE7, 0x6C, 0x3B, 0x9A, 0xEA,
+    0x97, 0xC9, 0x76, 0xCC, 0xF9, 0x55, 0xB0, 0x9E, 0x19, 0xE2, 0x9D, 0x67, 0x81, 0xE0, 0x3C, 0x67,
+    0x9C, 0xE3, 0xA0, 0xE7, 0x79, 0x1A, 0xAA, 0xCC, 0x35, 0x1A, 0xAE, 0xEF, 0xA1, 0x92, 0xD4, 0x0A,
+    0xE8, 0x03, 0xFD, 0xA3, 0xE9, 0xB1, 0x12, 0xEA, 0x3D, 0xB5, 0x78, 0x9A, 0x80, 0x05, 0x33, 0xA0,
+    0x03, 0x4A, 0xA8, 0x33, 0x7C, 0x18, 0x19, 0x60, 0x31, 0x32, 0x83, 0xA6, 0xF1, 0x16, 0xEC, 0x8B,
+    0x59, 0x07, 0x54, 0x3C, 0xAF, 0x33, 0x64, 0xDB, 0x0D, 0xB0, 0xA8, 0xF3, 0x0C, 0x1A, 0x56, 0x16,
+    0x6C, 0x67, 0xDF, 0x0C, 0xA8, 0x58, 0xDD, 0x4F, 0x90, 0x69, 0x07, 0x58, 0xA0, 0x77, 0xD0, 0x80,
+    0xC0, 0xAD, 0x81, 0x26, 0xB0, 0x96, 0x82, 0x18, 0x07, 0xD0, 0xBC, 0x01, 0xB5, 0xEC, 0xC1, 0x89,
+    0x04, 0xB6, 0xDE, 0xE6, 0x7A, 0x40, 0xF5, 0x3A, 0x51, 0x8D, 0x36, 0xC0, 0xD8, 0x78, 0x18, 0x5B,
+    0x60, 0x5C, 0x01, 0xE3, 0xF9, 0x83, 0xB7, 0x11, 0xAA, 0x61, 0x84, 0xBA, 0xDF, 0x81, 0xCA, 0xE7,
+    0x60, 0xE2, 0x1A, 0x5C, 0xD7, 0x7A, 0xD6, 0xB8, 0xA4, 0x47, 0xB4, 0x48, 0x9A, 0xE0, 0xB3, 0x04,
+    0xCA, 0x07, 0x51, 0xE0, 0xBE, 0x74, 0x2C, 0x19, 0x31, 0x41, 0x27, 0x46, 0xE6, 0xD8, 0x4E, 0xA5,
+    0x6A, 0x60, 0x89, 0xF3, 0x36, 0xD4, 0xB9, 0xEE, 0x69, 0xAB, 0x1D, 0x4A, 0xC4, 0xB3, 0xDE, 0xFB,
+    0x7F, 0x2C, 0xCE, 0x78, 0x28, 0x84, 0xB1, 0x0C, 0x87, 0xAD, 0xB7, 0x89, 0x7A, 0x40, 0xF5, 0xE8,
+    0x4C, 0x35, 0x60, 0x03, 0x8C, 0x34, 0x1E, 0x46, 0x5A, 0x60, 0x64, 0x05, 0x8C, 0xC5, 0xBD, 0x27,
+    0xEA, 0x39, 0x42, 0x35, 0x30, 0x82, 0xCA, 0xD3, 0xFB, 0x39, 0xD8, 0xC0, 0x1A, 0x9A, 0x8E, 0xD6,
+    0x73, 0x17, 0x6C, 0xD2, 0x03, 0x65, 0x2C, 0x54, 0xF2, 0x01, 0x40, 0x13, 0xA1, 0x90, 0x14, 0x60,
+    0xDD, 0x17, 0x9F, 0x7B, 0x0B, 0x60, 0x2D, 0x3B, 0x26, 0x43, 0xCB, 0x44, 0xDC, 0xF4, 0x54, 0x22,
+    0x09, 0x2B, 0x77, 0x32, 0x55, 0x6F, 0x32, 0x26, 0xD8, 0x40, 0x4B, 0x03, 0x03, 0x1B, 0x74, 0x54,
+    0x19, 0x47, 0xE3, 0xD9, 0xD4, 0x03, 0xEA, 0xBD, 0x6D, 0x87, 0x95, 0x04, 0xAB, 0x2D, 0xD4, 0x79,
+    0x09, 0x26, 0x8C, 0xD0, 0x56, 0x03, 0x0C, 0xAA, 0x47, 0x47, 0x9D, 0x69, 0x30, 0xD9, 0x48, 0x34,
+    0xFD, 0x56, 0x3A, 0x3D, 0x4C, 0xAB, 0xFB, 0x15, 0x58, 0x4B, 0x67, 0xEE, 0x4B, 0x77, 0xCE, 0x4C,
+    0x25, 0xB2, 0xEB, 0x54, 0x58, 0xF1, 0x3B, 0xD5, 0x08, 0x6A, 0x07, 0x6A, 0x5F, 0xB4, 0x81, 0x5A,
+    0x3A, 0x10, 0x0F, 0xDB, 0xDA, 0x33, 0x3E, 0x41, 0x9D, 0x37, 0x98, 0xD7, 0x33, 0x73, 0x93, 0x74,
+    0x76, 0x22, 0xDE, 0x48, 0xE2, 0xC0, 0xF2, 0x94, 0x88, 0x8C, 0xAD, 0x88, 0xBC, 0x19, 0x1A, 0x16,
+    0xCF, 0xAB, 0xAC, 0xFF, 0xDC, 0xCF, 0xF9, 0xD6, 0x37, 0x75, 0x3C, 0x2A, 0x71, 0xD4, 0x86, 0x69,
+    0xDB, 0xDA, 0x0E, 0xAA, 0x7E, 0x4A, 0xE4, 0x54, 0xFE, 0x8D, 0x11, 0x78, 0x84, 0x6A, 0xBB, 0x83,
+    0xF6, 0x90, 0xBD, 0xA0, 0x64, 0x40, 0xC6, 0x66, 0x8F, 0xD9, 0xD3, 0x82, 0x9B, 0x92, 0xE7, 0x15,
+    0x34, 0xE8, 0x88, 0x4A, 0x6C, 0x60, 0x86, 0x0D, 0xE8, 0x50, 0x32, 0x6A, 0xE7, 0x31, 0x5D, 0x01,
+    0xE7, 0x06, 0xAC, 0x57, 0x99, 0x2A, 0x17, 0x80, 0x2E, 0x69, 0x59, 0x0B, 0x0B, 0x54, 0x8F, 0xEB,
+    0x68, 0xD2, 0xF5, 0x04, 0x22, 0x03, 0xD4, 0x65, 0xE1, 0x6E, 0x5C, 0x08, 0x1C, 0x4E, 0xDE, 0x94,
+    0xDB, 0x47, 0xD2, 0xB5, 0xD0, 0x60, 0x22, 0xB6, 0xAB, 0x7A, 0x4C, 0x60, 0x85, 0x4A, 0xD8, 0xAE,
+    0xE4, 0x79, 0xFD, 0xE4, 0x2B, 0x0D, 0x33, 0x30, 0xA1, 0x85, 0xAA, 0x77, 0xC0, 0xCC, 0x76, 0x60,
+    0x5F, 0x0A, 0xA0, 0x7E, 0x92, 0x80, 0xF3, 0x5C, 0x76, 0x39, 0xE8, 0x91, 0x92, 0xB5, 0x4D, 0x71,
+    0xEE, 0xE2, 0x4B, 0xCB, 0xC0, 0x2B, 0xC8, 0xAE, 0xD9, 0xE3, 0x30, 0xE2, 0x57, 0xA8, 0xBE, 0x90,
+    0xCE, 0xB5, 0xAF, 0x32, 0x2B, 0x6C, 0xCF, 0x1C, 0x95, 0x2A, 0xE9, 0x74, 0xA0, 0x65, 0x3E, 0x30,
+    0xA0, 0xB2, 0xFE, 0x6E, 0xE7, 0xA0, 0x65, 0x18, 0xEB, 0x84, 0xCA, 0xCE, 0x84, 0x13, 0x68, 0x55,
+    0xDA, 0x98, 0x8E, 0x3A, 0x9F, 0xE8, 0x90, 0xA1, 0x31, 0xDD, 0xE2, 0x18, 0xEA, 0x9C, 0xF5, 0x0F,
+    0x02, 0xB8, 0x63, 0x66, 0x0B, 0xA8, 0x7E, 0x15, 0xD4, 0xDF, 0x79, 0x70, 0x03, 0x6D, 0x06, 0x04,
+    0xB5, 0x03, 0x6C, 0xA4, 0x2D, 0x0B, 0x52, 0xF7, 0x8F, 0xDA, 0x48, 0x23, 0x41, 0x76, 0xB8, 0xBD,
+    0xBF, 0xD5, 0x53, 0x0D, 0x38, 0x0F, 0x23, 0x73, 0x60, 0xC5, 0x00, 0xB4, 0x85, 0x84, 0x3C, 0x17,
+    0x00, 0x7B, 0x8F, 0xC3, 0x88, 0x51, 0x65, 0x1B, 0x0C, 0x00, 0xCD, 0x08, 0xB0, 0x58, 0x01, 0x55,
+    0x6E, 0x01, 0x1D, 0x5D, 0x07, 0xB6, 0xB3, 0x01, 0xE6, 0xE8, 0x04, 0x23, 0x2A, 0x73, 0x5D, 0xBC,
+    0x93, 0xAE, 0x95, 0xAE, 0x2D, 0x9B, 0x9A, 0x56, 0x82, 0xEC, 0x9A, 0x3D, 0xEB, 0x5E, 0x65, 0x6C,
+    0xA7, 0x32, 0x2D, 0xD5, 0xC0, 0x06, 0xC6, 0xAA, 0x87, 0x8D, 0x4A, 0x30, 0x37, 0x01, 0x5A, 0x07,
+    0xB8, 0x73, 0xC0, 0x0E, 0x80, 0xC9, 0x07, 0x82, 0x62, 0xC2, 0xC1, 0x2B, 0x6D, 0x77, 0x20, 0x4B,
+    0xCD, 0x61, 0x4B, 0x5A, 0x19, 0xB8, 0x40, 0x81, 0x44, 0x24, 0x3A, 0x5F, 0x8D, 0x55, 0xA2, 0xE5,
+    0x8B, 0xD8, 0x40, 0xA7, 0xFA, 0x89, 0x20, 0x36, 0x5D, 0xC9, 0xE2, 0x1E, 0x06, 0xE1, 0x43, 0x32,
+    0x7B, 0x17, 0x70, 0x81, 0x57, 0x54, 0xC6, 0x32, 0x52, 0xE7, 0xB6, 0xBB, 0xB9, 0xD2, 0x22, 0x12,
+    0xDA, 0x87, 0x0C, 0x6B, 0xC4, 0x8E, 0x58, 0x70, 0x70, 0x0C, 0x33, 0x38, 0x81, 0x05, 0x9C, 0x41,
+    0x0F, 0x99, 0x2A, 0x53, 0x67, 0xEA, 0x84, 0x8A, 0xA8, 0x80, 0x0E, 0x98, 0x0E, 0xEB, 0x2F, 0xFD,
+    0xA2, 0x48, 0x39, 0x1B, 0xD8, 0x06, 0x4E, 0x3D, 0xB3, 0x22, 0x26, 0x81, 0xF5, 0xE8, 0x80, 0x0A,
+    0xD4, 0x45, 0x68, 0xEA, 0xE1, 0x0C, 0x4E, 0x60, 0x06, 0x0E, 0x2C, 0x98, 0x6E, 0x92, 0xA2, 0xEA,
+    0x04, 0xE5, 0x89, 0x05, 0x9C, 0xC0, 0x95, 0xC9, 0xB0, 0x4B, 0x76, 0x5C, 0x34, 0x22, 0x60, 0x7F,
+    0xCD, 0x8E, 0xDF, 0x64, 0xB9, 0x4A, 0xA8, 0x88, 0x04, 0xBE, 0xEE, 0xE1, 0x6A, 0xC9, 0x79, 0xDB,
+    0x80, 0xDE, 0xC1, 0x07, 0x19, 0x6B, 0x7D, 0x9D, 0xCE, 0x98, 0xE9, 0xA0, 0xC3, 0x8C, 0xA1, 0xCE,
+    0x16, 0xFB, 0x4C, 0x66, 0x98, 0xA1, 0x5F, 0xEF, 0x78, 0xF2, 0xF4, 0xF4, 0xF4, 0xBF, 0x8A, 0xC8,
+    0x5B, 0x37, 0x6F, 0xDE, 0x04, 0xD5, 0x9D, 0xEB, 0xEC, 0xBA, 0x05, 0x93, 0xF6, 0xE9, 0xFA, 0x57,
+    0xD9, 0x4A, 0xAE, 0x87, 0x26, 0xE9, 0xA8, 0xA3, 0xED, 0x74, 0x68, 0x30, 0x61, 0x8E, 0xED, 0x96,
+    0x38, 0xBF, 0xA1, 0x65, 0xC3, 0x9A, 0x91, 0x3D, 0xA3, 0xFA, 0xF9, 0xE3, 0x77, 0xBF, 0x7A, 0xBC,
+    0x58, 0xEF, 0x9A, 0xDC, 0x24, 0x17, 0x2A, 0x80, 0xCF, 0x82, 0x1D, 0xE1, 0xCF, 0x72, 0x71, 0x85,
+    0x79, 0x51, 0x90, 0x74, 0x28, 0xC2, 0xD1, 0x99, 0x8B, 0xEA, 0xFB, 0x12, 0xEC, 0xF1, 0xAD, 0x6E,
+    0x15, 0xDB, 0x7A, 0xCF, 0x68, 0xB3, 0xCA, 0x2D, 0xF6, 0x85, 0x81, 0x99, 0x09, 0x55, 0x6E, 0xB0,
+    0x61, 0x60, 0xA9, 0xA3, 0x4A, 0x4D, 0xB7, 0x46, 0x24, 0xAB, 0xBF, 0xDB, 0x3F, 0xA0, 0x9C, 0x6E,
+    0x40, 0x46, 0xF5, 0xDE, 0xC2, 0x04, 0xDC, 0x05, 0xB9, 0x6D, 0x03, 0x23, 0x8C, 0x70, 0xCE, 0x53,
+    0xEB, 0x3F, 0xCA, 0xAD, 0x04, 0xBB, 0x9B, 0x98, 0xCE, 0x63, 0x45, 0x3C, 0xF9, 0xBD, 0xDD, 0x14,
+    0xD3, 0x36, 0x53, 0x48, 0xEB, 0xA1, 0xCA, 0x98, 0xF7, 0x33, 0x6B, 0x49, 0xD5, 0x85, 0xC1, 0xBA,
+    0x69, 0xB0, 0x33, 0x9C, 0x5F, 0x4C, 0x83, 0xDD, 0xFC, 0x43, 0x83, 0x2D, 0x26, 0xDD, 0xDD, 0xA9,
+    0x34, 0x37, 0xDD, 0xDC, 0xB1, 0x9C, 0x57, 0xC3, 0xCC, 0xA4, 0xA5, 0xF8, 0x6D, 0xCF, 0x6E, 0xA2,
+    0xBF, 0x4F, 0xAE, 0x8E, 0xFA, 0x56, 0xA2, 0xDB, 0x3F, 0x94, 0xB3, 0x4A, 0x62, 0x4D, 0x2B, 0xC0,
+    0xF0, 0x04, 0x54, 0xF9, 0x80, 0xD5, 0x2A, 0x52, 0x66, 0x8B, 0x5B, 0x12, 0x50, 0x22, 0x61, 0xDA,
+    0x48, 0xD6, 0x4F, 0xDA, 0x1B, 0x0D, 0x13, 0x4B, 0x63, 0xC6, 0x84, 0xEE, 0x6C, 0x1E, 0xBC, 0x0D,
+    0x4C, 0x9A, 0x5D, 0x95, 0x99, 0xC8, 0xA9, 0xCA, 0x17, 0x1B, 0xFE, 0x03, 0xDB, 0xC1, 0xDD, 0x5B,
+    0xC0, 0x76, 0x04, 0xFE, 0xC5, 0xED, 0x87, 0xA2, 0xF3, 0x56, 0x12, 0xCD, 0x3D, 0xF1, 0x75, 0x6F,
+    0x6F, 0x60, 0xFD, 0x1C, 0x36, 0xF4, 0xA8, 0xA4, 0x02, 0xB6, 0x6B, 0xA1, 0x51, 0x19, 0xDA, 0x3D,
+    0xD0, 0xDC, 0x9E, 0x3A, 0x70, 0x1E, 0x58, 0x77, 0x14, 0xC9, 0x46, 0x6E, 0xF5, 0xB8, 0xCE, 0x0C,
+    0x0C, 0xE8, 0xAC, 0x23, 0x26, 0xB8, 0x8E, 0x15, 0xED, 0x5B, 0x5F, 0xCD, 0xB4, 0xB2, 0x87, 0x4F,
+    0xDD, 0xF7, 0xC5, 0x47, 0x90, 0x50, 0x9C, 0x84, 0xCD, 0x34, 0x1A, 0xEB, 0x8B, 0x7D, 0x75, 0x06,
+    0x06, 0x93, 0x99, 0xB9, 0x3D, 0xD6, 0xFD, 0x65, 0xD0, 0xDF, 0x55, 0xB9, 0xBE, 0xC7, 0x80, 0xF8,
+    0x19, 0x6D, 0xE7, 0x70, 0xC1, 0x04, 0x13, 0x55, 0x52, 0x99, 0x9E, 0x81, 0x05, 0x4B, 0x9A, 0xC7,
+    0x1B, 0xEC, 0x3D, 0x13, 0x94, 0xA8, 0xC4, 0xFE, 0x20, 0xF4, 0xD8, 0xA0, 0x73, 0x3D, 0xF2, 0xE4,
+    0x34, 0xBE, 0xEB, 0xD9, 0xED, 0x70, 0x98, 0xA0, 0x52, 0xD5, 0xB3, 0xA1, 0xC5, 0x76, 0x3A, 0xD6,
+    0x99, 0xE1, 0x9B, 0xF3, 0x8D, 0x1B, 0xD5, 0xF0, 0x60, 0x26, 0x54, 0x86, 0x26, 0x14, 0xFD, 0xEF,
+    0xE5, 0x4B, 0xE0, 0x7C, 0x27, 0xA0, 0xA5, 0x58, 0xAD, 0x72, 0x59, 0x9A, 0x59, 0x99, 0x8A, 0x47,
+    0xBC, 0xBD, 0x29, 0xD0, 0xA5, 0x62, 0x59, 0xB5, 0xE9, 0xBF, 0x0D, 0x55, 0xD7, 0x63, 0x27, 0x62,
+    0xFC, 0x0D, 0x5F, 0x3C, 0x74, 0x9B, 0xF8, 0xD4, 0xDD, 0x92, 0x62, 0x2C, 0x4A, 0x43, 0x03, 0x58,
+    0x4F, 0x95, 0xB7, 0xDD, 0x71, 0xBB, 0x53, 0xF7, 0x9E, 0x8D, 0x6D, 0x98, 0xE9, 0x6C, 0xC2, 0xA6,
+    0xEA, 0xCD, 0x0B, 0x3B, 0x64, 0x8F, 0xDD, 0x53, 0xFD, 0x32, 0xD3, 0xD8, 0x4E, 0xA5, 0xBB, 0xCC,
+    0xD4, 0xA8, 0xA3, 0xDD, 0x6F, 0x68, 0x23, 0x5C, 0xE3, 0x31, 0xBB, 0xFB, 0xBD, 0x1D, 0x1B, 0x46,
+    0x06, 0xFA, 0x2A, 0xD7, 0x59, 0x25, 0x15, 0x75, 0x30, 0xC1, 0x06, 0xDB, 0x39, 0xDF, 0xD0, 0x32,
+    0x67, 0xF6, 0xE4, 0xAA, 0xDF, 0xA6, 0xF5, 0x03, 0x9F, 0x6C, 0x92, 0x8B, 0x26, 0x6D, 0xF3, 0x36,
+    0xAF, 0x7B, 0xF5, 0xF7, 0xBF, 0xFA, 0xC5, 0xFB, 0xBD, 0xFA, 0xD1, 0xB7, 0xDF, 0x7E, 0xAD, 0x57,
+    0x3F, 0xAF, 0xEF, 0x55, 0x59, 0x8F, 0x6A, 0xAC, 0xB3, 0xC9, 0xAA, 0x57, 0xC9, 0x26, 0x9D, 0x55,
+    0xB4, 0xC1, 0x44, 0x1D, 0x5C, 0x67, 0x83, 0x09, 0x0E, 0xEB, 0x6D, 0xD7, 0xE0, 0xB0, 0x7F, 0x3C,
+    0xA7, 0xC1, 0xAD, 0x66, 0xCC, 0x69, 0x86, 0x05, 0x33, 0x5C, 0xBC, 0x10, 0xDB, 0x92, 0x4B, 0xDB,
+    0xBC, 0xED, 0xD5, 0xDF, 0xBF, 0xDF, 0xAB, 0x1F, 0xBD, 0xD0, 0xAB, 0x9F, 0x57, 0x59, 0x97, 0x76,
+    0x93, 0x4D, 0x2A, 0xDA, 0xA0, 0x83, 0xEB, 0x4C, 0x70, 0xD8, 0xAE, 0xC1, 0xFE, 0xF1, 0x1C, 0x77,
+    0x77, 0x86, 0x1B, 0x16, 0x17, 0x5A, 0xA9, 0x24, 0x22, 0xE2, 0xDB, 0xA7, 0x47, 0x1B, 0xCC, 0xF7,
+    0x7A, 0x56, 0x2D, 0xEA, 0xED, 0xC8, 0x72, 0x83, 0xFE, 0x51, 0x60, 0x33, 0x62, 0xFF, 0x22, 0xD4,
+    0xFD, 0x39, 0x2B, 0x9D, 0x5D, 0x68, 0x25, 0xB3, 0xED, 0x1F, 0xEE, 0x3C, 0x33, 0x98, 0x5C, 0xCB,
+    0x4B, 0x12, 0x18, 0xDE, 0x1B, 0xB1, 0x0B, 0x13, 0x11, 0x96, 0xB8, 0xA8, 0x63, 0x3D, 0xB2, 0xA0,
+    0xC1, 0x04, 0x95, 0x19, 0x98, 0xE1, 0xBC, 0x0E, 0x2A, 0xB3, 0x61, 0x89, 0x8D, 0x4D, 0x87, 0x48,
+    0xC2, 0x6D, 0x7B, 0xEA, 0x7C, 0xAD, 0xE8, 0xEA, 0x2A, 0x4E, 0x7B, 0xD0, 0x44, 0x50, 0xD2, 0xC3,
+    0xD7, 0x4F, 0x0F, 0x46, 0xAE, 0xBF, 0x1F, 0x8D, 0x08, 0x3B, 0x33, 0x98, 0xA0, 0xE3, 0x0C, 0x57,
+    0x67, 0x36, 0xB6, 0x53, 0x69, 0x81, 0x7B, 0x26, 0x33, 0x9A, 0xA0, 0x73, 0x4B, 0xDB, 0x8D, 0x6A,
+    0x57, 0x0F, 0x8B, 0xAC, 0xE5, 0x07, 0xC1, 0x0C, 0x8E, 0x8A, 0xB3, 0x02, 0x04, 0xD6, 0xC3, 0xAC,
+    0xE0, 0xBA, 0x8C, 0x1C, 0x15, 0xC9, 0xAD, 0x49, 0xAB, 0xED, 0x2F, 0xA4, 0xFE, 0xC9, 0x5E, 0xFD,
+    0xC8, 0xAB, 0x9F, 0xA3, 0x46, 0x74, 0xC6, 0xA4, 0x4B, 0x02, 0xF8, 0x1C, 0xE6, 0x13, 0x28, 0x1C,
+    0xF0, 0x32, 0x2D, 0x74, 0xC9, 0xAA, 0x7B, 0xEA, 0x3D, 0x6C, 0x03, 0x2E, 0xA1, 0x32, 0x75, 0xFE,
+    0x56, 0x95, 0xEF, 0xAA, 0xB4, 0x96, 0xE0, 0x0A, 0x5E, 0x7E, 0xEA, 0x10, 0x73, 0x16, 0x1C, 0xC9,
+    0xAE, 0x95, 0x91, 0x01, 0xFA, 0x4B, 0x31, 0x47, 0xC7, 0x12, 0xA8, 0xAE, 0xD9, 0xEE, 0x55, 0xFB,
+    0xC3, 0x6C, 0x25, 0xE8, 0x03, 0xD6, 0xD2, 0x64, 0x16, 0xDB, 0xCC, 0x50, 0xE7, 0xAA, 0x57, 0xB9,
+    0xCA, 0x2A, 0xD5, 0x59, 0x45, 0x95, 0x4C, 0x50, 0xD1, 0x06, 0x13, 0xAC, 0xB7, 0xC1, 0xD1, 0x74,
+    0x0D, 0xEB, 0xAE, 0xA9, 0xDE, 0xF9, 0x57, 0xED, 0x73, 0xDF, 0xFD, 0xEF, 0x8D, 0xD8, 0xD1, 0x0E,
+    0x26, 0x1D, 0x56, 0x68, 0x8D, 0x7B, 0x69, 0x4F, 0xCB, 0xC8, 0xA6, 0xCE, 0x75, 0xD6, 0xD1, 0x04,
+    0xDB, 0xCD, 0x98, 0x57, 0x99, 0x33, 0xDB, 0xD5, 0x79, 0x81, 0x7E, 0x23, 0xE2, 0x8E, 0x61, 0x9E,
+    0x41, 0xA6, 0x6D, 0x78, 0xB1, 0x74, 0x36, 0x32, 0x32, 0xAE, 0x93, 0x89, 0x26, 0xB5, 0xCC, 0x59,
+    0xD5, 0xBD, 0xCA, 0x2A, 0x59, 0xDF, 0x32, 0x63, 0xD0, 0xBD, 0x0E, 0x36, 0x6C, 0xFD, 0xC0, 0xC6,
+    0x0E, 0x16, 0xFD, 0xDA, 0x3B, 0xDF, 0x4E, 0x9C, 0x9C, 0x2C, 0x4E, 0x50, 0x6F, 0xBE, 0xF4, 0xB7,
+    0x1D, 0xB3, 0x3C, 0xCB, 0xA8, 0x51, 0x8D, 0xD0, 0xFA, 0x16, 0x54, 0x7C, 0xA4, 0x28, 0x98, 0xAA,
+    0x51, 0x0B, 0xEB, 0xF0, 0xEF, 0x07, 0xF7, 0x9F, 0xB1, 0x6F, 0x44, 0x58, 0x9E, 0x81, 0x12, 0x0A,
+    0x62, 0x54, 0x03, 0xD0, 0x86, 0x02, 0xF0, 0xD5, 0xBB, 0x19, 0x4E, 0x1A, 0xEA, 0xAF, 0x3E, 0xFD,
+    0xC1, 0xD7, 0xDA, 0x64, 0x45, 0x0D, 0xAC, 0xFD, 0x43, 0xD5, 0xFC, 0xA8, 0x67, 0xAC, 0x24, 0x98,
+    0xC4, 0x39, 0x73, 0x54, 0x52, 0x89, 0x96, 0x19, 0x75, 0xD6, 0x01, 0xEB, 0xCF, 0x28, 0x65, 0xBD,
+    0x17, 0x32, 0x9C, 0xCD, 0xC0, 0xBC, 0xD4, 0xC1, 0xF3, 0x19, 0xF4, 0x7F, 0xA3, 0xE8, 0xAB, 0xE6,
+    0xC0, 0x8F, 0x9C, 0x07, 0x15, 0xA9, 0xAA, 0x1E, 0xD6, 0x23, 0xE8, 0xFD, 0x54, 0xFA, 0x29, 0xA4,
+    0xEE, 0xF6, 0x89, 0x95, 0x1F, 0xC6, 0xFB, 0x32, 0xFC, 0x3E, 0x77, 0x09, 0x36, 0x50, 0x67, 0x0A,
+    0xA9, 0x3E, 0x14, 0xC3, 0x96, 0xE0, 0xBC, 0xD2, 0xF2, 0x5F, 0x7A, 0x11, 0x79, 0xEE, 0x8F, 0x24,
+    0x1D, 0x96, 0xB4, 0x1A, 0xD1, 0x23, 0xD6, 0x73, 0x7C, 0x20, 0x22, 0x0F, 0xFE, 0xCE, 0xE0, 0x0C,
+    0x32, 0x26, 0x1E, 0xE4, 0x96, 0xCB, 0x5C, 0xEA, 0x22, 0x81, 0x29, 0x15, 0xB3, 0x26, 0x17, 0x8E,
+    0x88, 0xE3, 0x98, 0x19, 0x27, 0x9C, 0xB0, 0xE0, 0x8C, 0x9E, 0x5C, 0xE5, 0x2A, 0xD5, 0x49, 0x45,
+    0x15, 0x74, 0xD0, 0x9D, 0xF1, 0xD6, 0x5B, 0x1C, 0xC7, 0x7C, 0x71, 0x7A, 0xA8, 0xC8, 0xEB, 0xAD,
+    0xAF, 0xC4, 0x33, 0x87, 0x33, 0xEA, 0x84, 0xF5, 0x2C, 0x2E, 0xFD, 0xDB, 0xD1, 0xF8, 0xC2, 0x57,
+    0x1D, 0xF4, 0xA8, 0x80, 0x83, 0x05, 0x55, 0x46, 0x07, 0x1C, 0x9C, 0xA1, 0x02, 0x73, 0x9A, 0xCC,
+    0xFF, 0x3C, 0x54, 0x34, 0x3F, 0xDD, 0xCA, 0xB3, 0x6F, 0x7F, 0x5F, 0xC6, 0x6F, 0xD5, 0xE2, 0xA9,
+    0x3C, 0x9F, 0xAF, 0x3A, 0x13, 0x36, 0x2A, 0xB7, 0x8C, 0x2E, 0xAC, 0x75, 0xB6, 0x71, 0x64, 0x67,
+    0x83, 0xCA, 0x73, 0xEC, 0x0B, 0x3D, 0x27, 0x3A, 0x70, 0xFB, 0x71, 0x6A, 0xBE, 0xC6, 0x89, 0x7E,
+    0xC0, 0x56, 0xD6, 0x26, 0xA9, 0xBC, 0x66, 0x67, 0x63, 0xFB, 0x6C, 0x36, 0x61, 0xAC, 0xF3, 0x9C,
+    0x3F, 0xD4, 0xFE, 0x81, 0xDA, 0xF2, 0x45, 0x80, 0x12, 0x5D, 0x9A, 0x74, 0x10, 0x8E, 0x2F, 0x94,
+    0x0C, 0xA6, 0xB4, 0xA8, 0x85, 0x89, 0xF2, 0x22, 0x1E, 0x38, 0x1E, 0x00, 0xF5, 0xDD, 0x00, 0xF4,
+    0x1B, 0xC0, 0x99, 0x00, 0x2A, 0x2E, 0x99, 0x78, 0xB8, 0x65, 0x0E, 0x75, 0x52, 0x19, 0xE6, 0x37,
+    0xD7, 0x60, 0x45, 0x7A, 0xAA, 0xFB, 0xA7, 0x77, 0x3A, 0xE6, 0x54, 0xC3, 0x54, 0x19, 0xEB, 0x61,
+    0xA4, 0x01, 0x1B, 0xAF, 0x7F, 0xC0, 0x91, 0xFC, 0x50, 0x72, 0x25, 0x3B, 0x0E, 0x11, 0x52, 0x07,
+    0x40, 0x8D, 0x40, 0x2D, 0x7E, 0xF2, 0xAA, 0x4B, 0xF5, 0x83, 0x4F, 0xC0, 0xB2, 0x22, 0x5F, 0x94,
+    0x04, 0x2E, 0x03, 0xF6, 0x2F, 0x02, 0xE8, 0x34, 0x03, 0x7A, 0xC2, 0x27, 0x68, 0x59, 0xE5, 0x1F,
+    0x03, 0x56, 0x3A, 0x81, 0x4D, 0x7B, 0x60, 0x63, 0xC2, 0xE5, 0xD4, 0xED, 0x13, 0x10, 0xFB, 0xFF,
+    0xFF, 0x2B, 0xF1, 0xB5, 0x07, 0x04, 0x38, 0xCA, 0x13, 0xFB, 0xD4, 0x07, 0x69, 0xF0, 0x0F, 0x79,
+    0xE0, 0x49, 0xCF, 0x03, 0xF5, 0x78, 0xC8, 0x46, 0xEB, 0xF1, 0x52, 0xB6, 0x0F, 0x6C, 0x45, 0xFA,
+    0x6A, 0x5B, 0x34, 0x6F, 0x47, 0x9D, 0x39, 0xC1, 0x06, 0x62, 0x21, 0xB2, 0x0F, 0xB5, 0x68, 0xAE,
+    0x81, 0x48, 0x2A, 0x6A, 0x94, 0xEB, 0x26, 0x1B, 0xEB, 0x5C, 0x92, 0xCA, 0xAF, 0x31, 0x47, 0x85,
+    0xAA, 0xC7, 0x61, 0xE2, 0xD5, 0xA1, 0x16, 0x91, 0xD0, 0x88, 0xC8, 0x03, 0x65, 0xD3, 0xFA, 0x52,
+    0xA4, 0x64, 0x9D, 0x40, 0x0F, 0x97, 0x77, 0xD9, 0xC7, 0x60, 0xC4, 0x63, 0x87, 0x9D, 0xDE, 0xF6,
+    0xA0, 0xDE, 0xCD, 0xD0, 0xD6, 0x89, 0x3A, 0x29, 0xFF, 0xF1, 0x19, 0x71, 0x05, 0x5F, 0x04, 0x45,
+    0x93, 0xB7, 0xE0, 0x9E, 0xEE, 0x7F, 0x4D, 0x5F, 0x28, 0xD5, 0x87, 0x8C, 0xF3, 0x3A, 0xB0, 0xC1,
+    0xA2, 0xF2, 0xA1, 0xFC, 0x30, 0x67, 0x92, 0x91, 0x4C, 0xB8, 0x02, 0xAD, 0x0C, 0x20, 0x12, 0xD1,
+    0x69, 0x12, 0x80, 0xD9, 0x14, 0x0F, 0xFF, 0x3C, 0xB6, 0x23, 0xB3, 0x44, 0x87, 0xBA, 0xAF, 0x56,
+    0x6C, 0x45, 0xB2, 0x11, 0x99, 0x64, 0x04, 0x15, 0xA8, 0x46, 0x68, 0x23, 0xD5, 0x08, 0xF5, 0xC3,
+    0x91, 0xFB, 0xEB, 0x7B, 0x3F, 0xE9, 0xEF, 0xF6, 0x11, 0x3D, 0xDE, 0x06, 0x54, 0xA2, 0xEA, 0xE1,
+    0xFC, 0x91, 0xCF, 0x1B, 0x6A, 0xE9, 0x8B, 0xD4, 0x88, 0x87, 0x63, 0x70, 0x09, 0x3B, 0xA2, 0x3E,
+    0x38, 0x78, 0xE0, 0xD4, 0xF8, 0x91, 0xDC, 0x46, 0x47, 0xD8, 0x30, 0x89, 0x8F, 0xD8, 0x8E, 0xAA,
+    0x2F, 0xE7, 0x3A, 0x32, 0xCC, 0xCB, 0xDC, 0x9E, 0x17, 0xEF, 0xBF, 0x74, 0xBB, 0x11, 0x6F, 0xA4,
+    0x2F, 0x2B, 0x58, 0x0F, 0xD0, 0x0C, 0xD4, 0xEF, 0xF7, 0x34, 0x75, 0xAE, 0x52, 0xDD, 0x5D, 0xE8,
+    0xA3, 0xDA, 0xFE, 0x14, 0x96, 0x65, 0x21, 0x6C, 0x28, 0xBB, 0x6B, 0x28, 0xED, 0x1E, 0x28, 0x7F,
+    0x2A, 0x01, 0xF9, 0xFC, 0xE1, 0x43, 0xF3, 0x32, 0xA9, 0x26, 0x50, 0x4B, 0x4F, 0x23, 0x11, 0xAE,
+    0x72, 0x83, 0xD1, 0x06, 0x9D, 0xD7, 0xD8, 0x6E, 0xB8, 0xBC, 0x3E, 0x91, 0x5B, 0x1F, 0x94, 0x36,
+    0x36, 0x0F, 0x2B, 0xDC, 0x0F, 0xDB, 0xB8, 0xD4, 0xA7, 0xBF, 0x94, 0x8B, 0x4C, 0x86, 0x6D, 0x77,
+    0x94, 0xD1, 0x1C, 0x5E, 0x77, 0x0D, 0xC0, 0xF6, 0xED, 0x00, 0xCC, 0xD6, 0x09, 0xF8, 0x94, 0x49,
+    0xFC, 0xA6, 0xD7, 0x36, 0xD2, 0x0A, 0x66, 0xC0, 0xEC, 0x60, 0x0B, 0x27, 0xD0, 0x24, 0x1C, 0xD8,
+    0x11, 0x13, 0x50, 0xF7, 0xBC, 0x4A, 0x54, 0xEF, 0x66, 0x7A, 0xD8, 0x9C, 0x73, 0x02, 0x73, 0x1B,
+    0x1C, 0xD8, 0x67, 0x7A, 0x13, 0x50, 0x61, 0xAE, 0x12, 0x55, 0x36, 0xA1, 0x87, 0x4D, 0x35, 0x9C,
+    0xC0, 0x9C, 0xD6, 0x81, 0xF5, 0xFA, 0x9D, 0x0E, 0x15, 0x90, 0x44, 0x95, 0x71, 0x3D, 0x6C, 0x50,
+    0x23, 0xD5, 0x36, 0xB1, 0xA5, 0x92, 0xB1, 0xB8, 0xDF, 0xF4, 0xBA, 0x76, 0x40, 0x14, 0xF6, 0x00,
+    0xEB, 0x70, 0x90, 0x98, 0x1E, 0x42, 0xCA, 0xC7, 0x2B, 0xA6, 0x17, 0x01, 0xC2, 0x1D, 0x8E, 0x41,
+    0xE9, 0x3D, 0xE0, 0xD2, 0x25, 0x78, 0xF9, 0x98, 0x0D, 0xBA, 0x71, 0x90, 0xFC, 0xEC, 0x0E, 0x68,
+    0x5B, 0x60, 0xB0, 0x1D, 0x75, 0x7C, 0x00, 0x35, 0x1F, 0xAF, 0x41, 0xD7, 0x2A, 0xA8, 0x46, 0x17,
+    0xA8, 0xC7, 0x26, 0x50, 0xE7, 0xE6, 0x72, 0x60, 0xFC, 0x78, 0x6D, 0x01, 0xD0, 0x1D, 0x93, 0x58,
+    0x38, 0x09, 0xA4, 0xC5, 0x81, 0x2E, 0x1F, 0x8E, 0x68, 0xA5, 0xB3, 0xF2, 0xBA, 0x24, 0xB6, 0xA9,
+    0x08, 0xD9, 0x73, 0x70, 0xE8, 0x44, 0x9D, 0x59, 0xC2, 0x7C, 0xA2, 0xB5, 0x23, 0x2C, 0xB0, 0x1D,
+    0x3A, 0x54, 0x3D, 0x9C, 0x95, 0x5A, 0x65, 0x39, 0x0F, 0x56, 0x54, 0xF3, 0x4C, 0x9D, 0x69, 0x61,
+    0x8E, 0xCA, 0xE8, 0x40, 0xEB, 0xAB, 0x81, 0x7A, 0x5F, 0xDD, 0x05, 0x2B, 0xD2, 0x41, 0x23, 0xB7,
+    0x2F, 0x74, 0x5E, 0x71, 0x10, 0x68, 0xCA, 0xA9, 0xBA, 0x75, 0x3A, 0xF8, 0xD3, 0x23, 0xA7, 0xEE,
+    0x3E, 0x21, 0xFB, 0x0A, 0xB7, 0xF2, 0x07, 0xEF, 0x52, 0xEF, 0x66, 0x60, 0xB4, 0x1D, 0x1C, 0xF3,
+    0xD4, 0x27, 0x6F, 0xDF, 0xB5, 0x0A, 0x70, 0xAF, 0x8D, 0x14, 0x67, 0xA3, 0xA9, 0xF3, 0xAF, 0xE1,
+    0xD8, 0x27, 0x56, 0xD9, 0x30, 0x87, 0xB3, 0x5B, 0x71, 0x22, 0x49, 0x1B, 0xE0, 0xF1, 0x87, 0x86,
+    0xFD, 0xB6, 0x02, 0x2B, 0x94, 0x64, 0x0F, 0x13, 0x4B, 0x8C, 0x98, 0x4D, 0x82, 0x9F, 0xFF, 0x28,
+    0xFB, 0x98, 0x78, 0xA3, 0x78, 0xD4, 0xBD, 0x80, 0x79, 0x23, 0xD2, 0xD4, 0x89, 0x13, 0xE2, 0x47,
+    0xD6, 0xC7, 0x55, 0x6E, 0xD0, 0xBC, 0xD8, 0xD3, 0x3E, 0x9B, 0x39, 0xAE, 0xE3, 0xA5, 0xC5, 0xFB,
+    0x08, 0xEC, 0xFF, 0x27, 0x4A, 0xC5, 0xD5, 0x6D, 0xF4, 0x40, 0x91, 0x3B, 0xEA, 0x84, 0xEB, 0x0E,
+    0xC8, 0xFE, 0x85, 0x72, 0x3E, 0xC1, 0x4F, 0x7C, 0x84, 0x97, 0xFF, 0xB9, 0xBA, 0xEF, 0x55, 0x50,
+    0x61, 0x3A, 0xD9, 0x50, 0xF5, 0x90, 0xE1, 0x0F, 0x1E, 0xD4, 0xA5, 0xF6, 0x98, 0x7B, 0xD1, 0x76,
+    0x83, 0xE9, 0xE6, 0x3A, 0xB8, 0x67, 0x93, 0xEB, 0xFA, 0xA6, 0x5B, 0x8A, 0x6F, 0x76, 0xD8, 0x88,
+    0xCA, 0xB0, 0xE1, 0x49, 0xF7, 0xC2, 0xB9, 0x92, 0x1D, 0xEB, 0xE1, 0xE1, 0x5A, 0xAF, 0xA0, 0x8D,
+    0xCC, 0x47, 0xE6, 0x8E, 0xA6, 0x8E, 0x9F, 0xE1, 0x5F, 0xFE, 0x36, 0x2D, 0x3E, 0x56, 0x79, 0x13,
+    0x47, 0x76, 0x2E, 0x18, 0x7F, 0x91, 0x3D, 0x54, 0xD2, 0x71, 0x77, 0xC7, 0x5C, 0x25, 0xD3, 0xCD,
+    0xAB, 0xAC, 0xE3, 0xBC, 0x1A, 0x54, 0xBC, 0xCB, 0x52, 0xBC, 0x11, 0xCF, 0xAE, 0x38, 0xFC, 0x86,
+    0x27, 0x75, 0xBA, 0xE5, 0x5B, 0x89, 0xD5, 0x03, 0xFD, 0x40, 0x75, 0x26, 0xEA, 0x5C, 0x0D, 0x2C,
+    0xF9, 0x74, 0x91, 0x60, 0xD7, 0x93, 0x1E, 0xA9, 0xE3, 0x43, 0x35, 0x72, 0xFE, 0xF8, 0x7C, 0xB3,
+    0xCE, 0x6D, 0x57, 0x9C, 0x5B, 0x07, 0x5A, 0x54, 0x2E, 0x15, 0xFD, 0x03, 0x77, 0xBC, 0x15, 0xB4,
+    0x78, 0x16, 0xD4, 0x19, 0xDB, 0xB1, 0xA4, 0xCE, 0xD8, 0xC0, 0x9C, 0x52, 0x32, 0x9C, 0x3F, 0xCE,
+    0xFD, 0xAC, 0x05, 0xFB, 0x80, 0xD3, 0x9C, 0xA3, 0x47, 0x96, 0xBD, 0xFA, 0x7E, 0x9E, 0xA9, 0xD7,
+    0xE2, 0xD1, 0x3F, 0xBD, 0x91, 0xCA, 0x5F, 0x6B, 0xD5, 0x2F, 0xC6, 0xE6, 0xC5, 0xF0, 0xFC, 0x03,
+    0xB9, 0x66, 0x64, 0xDD, 0xA3, 0x43, 0x29, 0x1D, 0xEB, 0x48, 0x03, 0x23, 0x2A, 0xE1, 0x3C, 0x1B,
+    0xD4, 0x8F, 0x83, 0xBD, 0xC3, 0x3A, 0x17, 0xCA, 0x52, 0xF6, 0xA3, 0xC9, 0xDF, 0xC4, 0xED, 0x32,
+    0xB3, 0x36, 0xF1, 0x79, 0xD7, 0x5D, 0x62, 0x79, 0x1F, 0x81, 0x12, 0xCA, 0x2B, 0x65, 0xE6, 0xEF,
+    0x4E, 0xC7, 0x49, 0xC3, 0x05, 0xA0, 0xF9, 0x2D, 0x54, 0xD2, 0x82, 0x29, 0x26, 0x52, 0x0D, 0x30,
+    0x2B, 0x49, 0xD5, 0x8D, 0x8F, 0x44, 0x7D, 0x55, 0x19, 0xC4, 0x73, 0xBC, 0xC1, 0xBC, 0x11, 0xAB,
+    0x7C, 0x7C, 0x01, 0x50, 0xFE, 0xD9, 0xED, 0x1E, 0x71, 0x83, 0xBB, 0x26, 0xAA, 0xBE, 0xF5, 0xA6,
+    0x7B, 0xF5, 0x72, 0xB5, 0xD7, 0x23, 0xE2, 0x6D, 0x5C, 0x33, 0x72, 0xAE, 0x63, 0x35, 0xB4, 0xA8,
+    0x1F, 0xF7, 0xB8, 0xE7, 0x02, 0xCB, 0x86, 0x3A, 0x8F, 0xD8, 0x17, 0x33, 0xE7, 0x26, 0xEA, 0xE4,
+    0xC2, 0x9A, 0x56, 0x32, 0xCD, 0xEE, 0xC2, 0x21, 0x51, 0xED, 0xCB, 0xFC, 0x9A, 0x74, 0xE1, 0x1C,
+    0xED, 0x43, 0x28, 0xFF, 0x08, 0xE4, 0x4E, 0x5F, 0x0E, 0xFF, 0x9B, 0x58, 0xCE, 0x13, 0xCD, 0xA7,
+    0xB3, 0xD6, 0x37, 0x3E, 0xCA, 0x3E, 0x26, 0x28, 0xDF, 0x76, 0xD4, 0x1F, 0x06, 0xF4, 0x1B, 0x09,
+    0x57, 0x65, 0xBE, 0xC0, 0xED, 0x8F, 0xAC, 0x8F, 0x23, 0x6E, 0xE0, 0x5E, 0x1F, 0x68, 0x5E, 0xEC,
+    0x79, 0xA2, 0xBE, 0x94, 0x57, 0x7C, 0x34, 0xF6, 0xC3, 0x91, 0x88, 0x48, 0x42, 0x44, 0x44, 0xBC,
+    0xEB, 0x19, 0x98, 0x55, 0x3B, 0x74, 0x24, 0xDB, 0x40, 0x83, 0xEA, 0x0A, 0xAA, 0xEB, 0x84, 0xCA,
+    0xD0, 0x96, 0x6C, 0x68, 0x80, 0x25, 0x37, 0x74, 0xA4, 0x16, 0x09, 0x8D, 0xC7, 0xCA, 0x6E, 0x3A,
+    0x1F, 0x56, 0x4E, 0x0A, 0x62, 0x63, 0x49, 0xA2, 0x3A, 0x1A, 0xE8, 0xD6, 0x30, 0x62, 0xD8, 0xA3,
+    0x12, 0x27, 0xD5, 0x1E, 0xD7, 0x7D, 0x2E, 0x57, 0xA5, 0x47, 0xB6, 0xE5, 0x54, 0xF5, 0x55, 0x7F,
+    0x11, 0x15, 0xE3, 0xF5, 0x01, 0x91, 0xE7, 0xEE, 0xA5, 0xF6, 0x69, 0x49, 0xAD, 0x0D, 0x66, 0x50,
+    0x3F, 0xEE, 0x59, 0xB3, 0x6C, 0x51, 0xC9, 0xBD, 0x19, 0x59, 0x9A, 0xB4, 0x41, 0xFF, 0xA8, 0x37,
+    0x81, 0x6D, 0xCF, 0x88, 0x8D, 0xD8, 0x50, 0x8F, 0x70, 0xCE, 0x3A, 0xD4, 0x2F, 0x65, 0x27, 0x47,
+    0x7D, 0x2B, 0x3F, 0x91, 0x1D, 0xDB, 0xDE, 0xEE, 0xE1, 0x06, 0x57, 0xE0, 0xE6, 0xCD, 0x9B, 0xFF,
+    0x5A, 0x44, 0x7E, 0x76, 0x7A, 0x7A, 0xEA, 0x6F, 0x96, 0xD7, 0x5A, 0x44, 0x44, 0xE4, 0xFE, 0xE9,
+    0xE9, 0xE9, 0xE9, 0xE9, 0xE9, 0x77, 0xB8, 0xA6, 0xC3, 0x89, 0x4A, 0x8E, 0x51, 0x65, 0x17, 0x5A,
+    0xE0, 0xA8, 0xDB, 0xD9, 0xB8, 0xB1, 0x21, 0x1F, 0xEB, 0xF0, 0x32, 0x5C, 0xA3, 0xCA, 0x4F, 0xA8,
+    0xB0, 0xB0, 0x5D, 0xEF, 0xEA, 0xDC, 0xAA, 0xD4, 0xEA, 0xB4, 0x36, 0xB9, 0xD5, 0xB9, 0x20, 0x9B,
+    0xFD, 0xDE, 0x68, 0xE3, 0xCE, 0xC4, 0xD1, 0x86, 0xC1, 0x3E, 0x9D, 0x1B, 0x95, 0x4E, 0x74, 0xE8,
+    0x6D, 0x39, 0x2B, 0xCC, 0x6D, 0x7E, 0xB7, 0xED, 0x54, 0x66, 0xDD, 0x7A, 0x93, 0x91, 0x16, 0x9D,
+    0xD8, 0x5D, 0xA1, 0x82, 0x6B, 0xFF, 0x0F, 0xC5, 0x99, 0x31, 0xAC, 0x5C, 0xC7, 0x75, 0x86, 0xBF,
+    0xB9, 0x43, 0xBD, 0xB1, 0x33, 0x88, 0x87, 0x85, 0x8D, 0x38, 0xB0, 0xE0, 0x69, 0x52, 0x18, 0x88,
+    0xC4, 0xDB, 0xD8, 0x40, 0x0A, 0xEE, 0xDE, 0xA1, 0x04, 0xC4, 0x80, 0x55, 0x58, 0x85, 0x15, 0x15,
+    0x2A, 0xE4, 0x26, 0x80, 0x11, 0x04, 0xA0, 0x0B, 0x17, 0xAF, 0xD8, 0x7D, 0x7B, 0x15, 0x21, 0x10,
+    0x10, 0x15, 0x66, 0x91, 0x00, 0x29, 0x53, 0x24, 0x8D, 0x10, 0x47, 0x2E, 0x58, 0x3C, 0x03, 0xFB,
+    0x78, 0xC7, 0x62, 0xE1, 0xC2, 0x85, 0xC7, 0x12, 0x8C, 0x14, 0x2A, 0x3C, 0xB0, 0xE5, 0x08, 0x10,
+    0x01, 0x73, 0x1C, 0x5D, 0x49, 0x97, 0xD4, 0xEC, 0x9E, 0x14, 0x77, 0xF9, 0xF8, 0x18, 0xD9, 0x69,
+    0xE2, 0x20, 0x5B, 0x6C, 0xB1, 0x7B, 0x31, 0xE7, 0xCC, 0x7F, 0xFE, 0x73, 0xFE, 0xFF, 0xEC, 0xC2,
+    0x25, 0x02, 0xAA, 0xBA, 0x88, 0x2D, 0x03, 0xF8, 0x6B, 0x23, 0x8F, 0xBE, 0x5A, 0x91, 0x1D, 0xD7,
+    0x45, 0x0A, 0x3E, 0x98, 0xC8, 0x16, 0x87, 0x2E, 0x7C, 0x19, 0xD7, 0x03, 0x4B, 0x40, 0x8D, 0x80,
+    0x8D, 0x97, 0xA0, 0x93, 0x09, 0x44, 0x12, 0x26, 0x03, 0x6D, 0x00, 0xB6, 0x80, 0x2E, 0x7C, 0x1E,
+    0xD7, 0x53, 0x58, 0x63, 0x62, 0x33, 0xAA, 0x13, 0x06, 0x91, 0x62, 0x45, 0x24, 0x02, 0x3C, 0xC6,
+    0xFC, 0x10, 0xB0, 0x01, 0x70, 0x23, 0xD0, 0xDC, 0xED, 0x81, 0xAB, 0x15, 0x70, 0xCF, 0x44, 0x50,
+    0x65, 0x0B, 0x2C, 0x4C, 0x02, 0x1B, 0x97, 0x40, 0xD1, 0x19, 0xAE, 0xD0, 0x81, 0xFE, 0xD5, 0xF3,
+    0x05, 0x44, 0x24, 0xE0, 0x5F, 0x7B, 0x6D, 0x42, 0x67, 0x7C, 0xCF, 0x16, 0x2A, 0x2E, 0xE0, 0x62,
+    0x53, 0x60, 0xA7, 0x86, 0x1B, 0x5C, 0xDF, 0x6D, 0x04, 0x2F, 0x09, 0x00, 0x2B, 0xB2, 0xE7, 0xBA,
+    0x48, 0x66, 0xCD, 0x02, 0x1B, 0x75, 0xA4, 0x72, 0x15, 0x17, 0x15, 0x4C, 0x80, 0x0F, 0xD0, 0xDC,
+    0xFF, 0x67, 0xE8, 0xA4, 0xA2, 0x3F, 0x78, 0xB1, 0xB0, 0xA6, 0xED, 0x6D, 0xA2, 0xB2, 0xC5, 0x45,
+    0x17, 0xA9, 0x4C, 0xB8, 0xDE, 0x07, 0x5D, 0x9A, 0x51, 0xED, 0x1A, 0x11, 0x09, 0x83, 0xEC, 0xC3,
+    0x01, 0xB7, 0xE7, 0x02, 0x46, 0x24, 0x21, 0xEF, 0x49, 0x60, 0xAD, 0x2A, 0x36, 0xDA, 0x44, 0x65,
+    0x8D, 0xEB, 0x6D, 0x54, 0x23, 0x15, 0x4F, 0x4B, 0x73, 0xFF, 0xF5, 0x48, 0x27, 0x13, 0xFA, 0x57,
+    0xD7, 0x0F, 0x21, 0xE2, 0xA3, 0x21, 0xFC, 0x1C, 0xA2, 0x7C, 0x32, 0x04, 0xD0, 0x88, 0x48, 0x3A,
+    0x12, 0x11, 0xD4, 0xC8, 0x16, 0x1B, 0x9B, 0x42, 0x87, 0xED, 0xA9, 0x3C, 0x81, 0xCE, 0x3C, 0x8B,
+    0xBF, 0x50, 0x06, 0xE6, 0xAA, 0xAD, 0x81, 0x66, 0xAE, 0x1A, 0xD0, 0xC1, 0x7C, 0x63, 0x93, 0x80,
+    0x16, 0xB0, 0x92, 0x61, 0x90, 0xFE, 0x61, 0x98, 0x8D, 0x48, 0x85, 0x8D, 0xC8, 0x3B, 0xA0, 0xA3,
+    0x0F, 0x60, 0x62, 0x0B, 0xD8, 0xD0, 0x01, 0x8E, 0x25, 0xE0, 0x59, 0x00, 0x4F, 0xB2, 0x02, 0xAE,
+    0xB2, 0x05, 0x8E, 0xA9, 0xC0, 0xC8, 0x04, 0xAA, 0xA8, 0x11, 0x74, 0x6A, 0x0A, 0x98, 0xD8, 0x14,
+    0x70, 0x61, 0x2E, 0xA0, 0x4E, 0xB0, 0xC2, 0x24, 0xD4, 0x84, 0x8D, 0xB4, 0x22, 0xB2, 0xA7, 0x13,
+    0x11, 0x61, 0x0D, 0x9C, 0xB0, 0x02, 0xD6, 0xAC, 0x80, 0x15, 0xA7, 0xC0, 0x29, 0x37, 0x81, 0xEF,
+    0xF3, 0x4D, 0xE0, 0x9F, 0x7E, 0x0B, 0x0A, 0x2B, 0x6C, 0xA4, 0xD0, 0xA1, 0x03, 0x13, 0xA0, 0xF3,
+    0xA1, 0x9A, 0x6C, 0x09, 0x68, 0x91, 0x1E, 0x27, 0x3B, 0x38, 0xF9, 0x6F, 0x28, 0xA8, 0x9E, 0x09,
+    0x87, 0x49, 0xAC, 0x68, 0xC3, 0x1F, 0x65, 0x2B, 0x22, 0x0C, 0x22, 0x15, 0xFE, 0x18, 0x40, 0xDD,
+    0x50, 0x42, 0x27, 0x6C, 0xA2, 0xD9, 0x33, 0x64, 0x23, 0x7C, 0xFA, 0x8C, 0x05, 0x27, 0xDF, 0x82,
+    0x53, 0x55, 0x4C, 0x02, 0x8A, 0x8D, 0x0B, 0xA0, 0xC9, 0x9D, 0xCE, 0x80, 0x8E, 0x53, 0x0B, 0x60,
+    0x9F, 0x4E, 0x05, 0xE0, 0x4A, 0xFB, 0x62, 0x00, 0x94, 0x48, 0x05, 0x70, 0xFF, 0xFE, 0xE1, 0x08,
+    0xB0, 0x73, 0x2F, 0x17, 0xC0, 0xE6, 0xB5, 0x49, 0xC0, 0xA0, 0x8A, 0x8B, 0x60, 0x8A, 0x8D, 0x6D,
+    0x80, 0x4D, 0x58, 0xD2, 0x81, 0x99, 0x18, 0xB9, 0x05, 0x9B, 0xDE, 0x44, 0x76, 0xD8, 0x89, 0xA1,
+    0x34, 0x3B, 0x36, 0xBD, 0x93, 0xD8, 0x54, 0x2E, 0x3F, 0xA8, 0x94, 0xFA, 0x06, 0x8D, 0xEC, 0xF1,
+    0xB2, 0x67, 0x4B, 0xD5, 0xA9, 0x19, 0x1D, 0x26, 0x7D, 0x1E, 0x0F, 0x54, 0xB0, 0x89, 0xCF, 0xED,
+    0xD0, 0x92, 0xF9, 0x03, 0xC9, 0xE0, 0x13, 0xF8, 0x1E, 0xBA, 0xC7, 0x60, 0x3A, 0xC6, 0xBE, 0x55,
+    0xD8, 0xD8, 0x62, 0x8B, 0x13, 0x09, 0x56, 0x12, 0x84, 0x0B, 0x73, 0x20, 0x3A, 0xC9, 0x47, 0x72,
+    0xA3, 0x91, 0x8C, 0x0F, 0xB8, 0x88, 0x8D, 0xD8, 0x8C, 0x2E, 0xD8, 0x11, 0x2A, 0xAE, 0xC2, 0x12,
+    0xB7, 0x01, 0x1F, 0xDC, 0xD7, 0x7B, 0x6C, 0x74, 0x5F, 0xCD, 0xE8, 0xE2, 0xAE, 0x8D, 0x30, 0x79,
+    0xB6, 0xB0, 0xF6, 0x74, 0xD0, 0xBE, 0x88, 0xEB, 0xB1, 0x77, 0x31, 0x09, 0x2D, 0x34, 0x23, 0xEC,
+    0x61, 0x0B, 0x27, 0xD0, 0x41, 0x0B, 0xAE, 0x67, 0xA8, 0x5C, 0xDF, 0x33, 0x08, 0xDD, 0x45, 0x22,
+    0x5E, 0x56, 0x11, 0x58, 0x51, 0x80, 0x8E, 0x9B, 0x80, 0xFD, 0x60, 0x02, 0x18, 0x46, 0x00, 0x15,
+    0x3E, 0x31, 0xBD, 0xFE, 0x9F, 0xB3, 0x3E, 0x0A, 0x56, 0x8A, 0xA9, 0x5C, 0xBF, 0xA7, 0x24, 0xB2,
+    0xE6, 0xE4, 0x5B, 0xD8, 0xE8, 0x7A, 0xA8, 0x3A, 0x83, 0x8B, 0xA7, 0xC0, 0xE4, 0x01, 0xFF, 0x74,
+    0x84, 0xE6, 0x83, 0x11, 0xE8, 0x04, 0xD0, 0x1F, 0x4E, 0xC0, 0xDA, 0x45, 0xB0, 0xE9, 0x04, 0xD8,
+    0xEA, 0x02, 0x2E, 0xB6, 0x3D, 0x4C, 0x54, 0xF0, 0xC1, 0x66, 0x9A, 0x42, 0x17, 0x1A, 0x99, 0x9A,
+    0x1D, 0x83, 0x44, 0x5B, 0x1E, 0xB9, 0xBC, 0x16, 0x91, 0x8C, 0x15, 0xD9, 0x41, 0x93, 0x5D, 0x0F,
+    0x2E, 0xAC, 0x81, 0xAB, 0x4D, 0x81, 0x99, 0x65, 0xB6, 0xEF, 0x80, 0xC5, 0xDC, 0xA2, 0x26, 0x81,
+    0xED, 0x5B, 0x60, 0x41, 0x05, 0x55, 0x74, 0x06, 0x17, 0x7C, 0x0F, 0x2B, 0xD6, 0xA0, 0x73, 0x53,
+    0xA0, 0xC5, 0x45, 0xAE, 0x8D, 0x2C, 0xD1, 0x77, 0x7B, 0x35, 0xE2, 0x2B, 0x9B, 0x1D, 0x5D, 0x6F,
+    0x64, 0x7A, 0x48, 0xC3, 0xC3, 0x88, 0xED, 0x69, 0xF7, 0x1C, 0x49, 0x4F, 0x37, 0x81, 0x44, 0x86,
+    0x08, 0x12, 0xF9, 0x38, 0xA2, 0x3E, 0x8E, 0xCD, 0x9D, 0x48, 0xF3, 0x6E, 0x32, 0x3F, 0x8E, 0xE8,
+    0xB7, 0x92, 0xFB, 0x7A, 0xC4, 0xDC, 0xCE, 0xDE, 0x45, 0xEC, 0xED, 0xBC, 0x70, 0x3D, 0xEE, 0xA9,
+    0x72, 0xEC, 0x7A, 0x5C, 0x53, 0x8A, 0xEB, 0x69, 0xD5, 0x7F, 0x66, 0xD7, 0xB3, 0xE4, 0xA3, 0xE8,
+    0x02, 0x0B, 0x24, 0xF8, 0xC0, 0x0A, 0xC1, 0x07, 0x4E, 0x39, 0xC3, 0xC3, 0xC8, 0x31, 0x2D, 0xAA,
+    0x70, 0x99, 0x96, 0x2F, 0xEC, 0x41, 0x49, 0xEE, 0x04, 0x8C, 0x94, 0xFF, 0x91, 0x0E, 0x3A, 0xA3,
+    0x0B, 0x6A, 0x84, 0x0A, 0x5B, 0x58, 0x42, 0x07, 0x3E, 0xE0, 0x7A, 0xEC, 0xCF, 0x9E, 0x7B, 0x21,
+    0xA3, 0x45, 0x64, 0x84, 0xFD, 0x6B, 0xAF, 0xD5, 0xF3, 0x7A, 0xCF, 0x5F, 0x47, 0x4C, 0x42, 0x17,
+    0x9A, 0x11, 0x26, 0xD8, 0xC2, 0xFA, 0x77, 0xD3, 0xE1, 0xB1, 0x67, 0xA1, 0x91, 0x3D, 0x78, 0x91,
+    0xC8, 0x10, 0x5C, 0x69, 0x26, 0xF4, 0x68, 0xF2, 0xAC, 0xC0, 0xD4, 0x36, 0x40, 0xED, 0x80, 0x7A,
+    0x02, 0xD4, 0xB3, 0xF3, 0xB7, 0x0A, 0x6A, 0xAA, 0xD0, 0x8C, 0x3B, 0xD0, 0xE5, 0x0C, 0x6C, 0xDA,
+    0x80, 0xEF, 0xBB, 0xC0, 0x06, 0x9F, 0x4D, 0xC5, 0x88, 0x64, 0x18, 0xF6, 0x8F, 0xB6, 0xC1, 0x20,
+    0x07, 0xFD, 0x96, 0x11, 0x93, 0xF1, 0x3D, 0x36, 0x1E, 0x6E, 0xDE, 0x82, 0x8B, 0x74, 0xE0, 0x7A,
+    0x96, 0xE0, 0x03, 0x6B, 0x68, 0xE1, 0x0C, 0xBA, 0x07, 0x38, 0x54, 0x58, 0xC3, 0x04, 0x67, 0xA8,
+    0x11, 0xB6, 0x34, 0x05, 0x2A, 0xBA, 0xC0, 0x74, 0x00, 0x4D, 0x67, 0x9A, 0x82, 0x49, 0xB4, 0xC2,
+    0x66, 0xC7, 0x20, 0x4A, 0x76, 0x17, 0xF5, 0xEF, 0xBE, 0xF4, 0xAC, 0xA9, 0xD8, 0x68, 0x32, 0x95,
+    0x25, 0xAE, 0xD7, 0x59, 0x4D, 0xAC, 0xF1, 0xC1, 0xC5, 0xA6, 0x34, 0x23, 0x9D, 0xDA, 0xA1, 0x45,
+    0x02, 0x9B, 0x7D, 0xC0, 0xA6, 0x83, 0x60, 0xB9, 0xC8, 0x05, 0x29, 0x2E, 0xD0, 0xC8, 0x04, 0xC3,
+    0xC1, 0x34, 0x04, 0x68, 0x65, 0xA4, 0x15, 0x89, 0x76, 0x54, 0xB5, 0x99, 0x30, 0xF1, 0x04, 0x4E,
+    0x5D, 0xC4, 0x36, 0xE3, 0x41, 0xD7, 0x74, 0x3E, 0xC8, 0x9D, 0x8D, 0x87, 0x43, 0x6D, 0x04, 0xCE,
+    0x00, 0x9B, 0x67, 0xBF, 0x71, 0x49, 0x57, 0x9A, 0xE4, 0xEF, 0xFD, 0x45, 0x65, 0x23, 0xFB, 0x03,
+    0x80, 0x97, 0x1F, 0x36, 0x50, 0xED, 0x44, 0xE4, 0x47, 0xB1, 0x65, 0x75, 0xAC, 0x8B, 0x79, 0x35,
+    0x2C, 0xF9, 0xCE, 0xB7, 0x4D, 0x3A, 0x9A, 0x0F, 0x71, 0x71, 0x1E, 0xAB, 0xB8, 0xFE, 0x60, 0x84,
+    0xDA, 0x07, 0x4A, 0xFB, 0xC9, 0xF0, 0x15, 0xD4, 0xB0, 0x83, 0xEE, 0xE0, 0x40, 0xA0, 0x93, 0x30,
+    0xEC, 0xDB, 0x1D, 0xD7, 0x27, 0x93, 0x71, 0x51, 0x17, 0x3C, 0xBA, 0xB0, 0xA0, 0x19, 0xD9, 0xC2,
+    0xA4, 0x0A, 0x54, 0x9D, 0x60, 0x6B, 0x22, 0xAC, 0x1D, 0xB0, 0x7C, 0x12, 0xE8, 0x56, 0x40, 0x5B,
+    0x00, 0x97, 0x1E, 0x64, 0xE1, 0x80, 0xCB, 0x0B, 0xE0, 0x07, 0x13, 0x20, 0x19, 0x18, 0x2E, 0x4C,
+    0xC3, 0x4E, 0x02, 0xD8, 0x7D, 0x38, 0x98, 0x36, 0xFC, 0x0D, 0xB0, 0x22, 0x89, 0xF6, 0xCE, 0x7D,
+    0xA1, 0xEB, 0x27, 0x9B, 0xDB, 0xB0, 0xA0, 0xFA, 0xDE, 0x87, 0xD6, 0x46, 0x13, 0xED, 0xED, 0xD2,
+    0x94, 0xA6, 0x4C, 0x4C, 0xD4, 0x8E, 0x05, 0x4B, 0x17, 0x3D, 0x5D, 0x33, 0x99, 0xD8, 0x85, 0xEE,
+    0xCD, 0xDF, 0x0C, 0x41, 0x8B, 0xEC, 0xE1, 0x68, 0xF8, 0x7B, 0xC0, 0x73, 0xAE, 0xA3, 0x02, 0x3C,
+    0xF6, 0xDC, 0x23, 0xBA, 0x21, 0x3B, 0xFC, 0x3E, 0x5C, 0x1F, 0x51, 0x13, 0x3E, 0x40, 0x65, 0x09,
+    0x9C, 0x30, 0x01, 0xB3, 0x52, 0xFA, 0x67, 0x22, 0xE0, 0xEE, 0x02, 0x98, 0x0A, 0xA0, 0x47, 0x00,
+    0x3B, 0x01, 0xB4, 0x15, 0x60, 0x75, 0x02, 0xA8, 0xD2, 0x01, 0x26, 0xF9, 0x1E, 0x5C, 0xEF, 0x22,
+    0x2C, 0x31, 0xF9, 0x40, 0xC9, 0x2F, 0x48, 0xF0, 0xD2, 0x77, 0xD2, 0x77, 0x33, 0x47, 0xE0, 0xC0,
+    0xC6, 0xEB, 0xF7, 0xD4, 0xF0, 0x0E, 0x26, 0xE1, 0x03, 0xF6, 0x22, 0xF1, 0x7F, 0x1B, 0xFD, 0xB7,
+    0xD0, 0x41, 0x85, 0x25, 0x4C, 0xB0, 0x46, 0x8D, 0x70, 0x46, 0xF3, 0x49, 0xFA, 0x67, 0xD4, 0x88,
+    0x49, 0x34, 0x23, 0x36, 0x1D, 0x9C, 0xCB, 0x20, 0x22, 0x32, 0x23, 0x0E, 0xC0, 0x02, 0x80, 0x15,
+    0x00, 0xC7, 0x00, 0xDC, 0x04, 0xE0, 0xDB, 0x0F, 0xCA, 0xF2, 0x92, 0xD4, 0x76, 0xA7, 0x86, 0x77,
+    0x74, 0xC1, 0x07, 0x9D, 0x69, 0x31, 0x89, 0x0E, 0x13, 0x59, 0x62, 0x23, 0x6B, 0x5C, 0xE4, 0x0C,
+    0x9B, 0xD8, 0x62, 0xC6, 0xA3, 0x8A, 0x16, 0x99, 0x60, 0xB8, 0x3F, 0x32, 0x37, 0xC5, 0xCC, 0xB6,
+    0xF9, 0x2D, 0x3F, 0x70, 0x71, 0x36, 0x02, 0x43, 0x05, 0x2D, 0xBB, 0x0B, 0x5E, 0x71, 0xEA, 0xF6,
+    0x4E, 0xD2, 0x91, 0xF4, 0x43, 0x6E, 0xEF, 0xA1, 0x46, 0xD6, 0x33, 0x22, 0x4D, 0x99, 0x6F, 0xED,
+    0xE2, 0x7C, 0xB3, 0x25, 0xAE, 0x47, 0x27, 0xC6, 0x19, 0x18, 0x93, 0xE6, 0xDE, 0x6F, 0xB1, 0x11,
+    0x5D, 0xA8, 0x33, 0x6A, 0x3A, 0xCF, 0xF8, 0xF8, 0x60, 0x12, 0x4D, 0x61, 0x85, 0xE7, 0x77, 0x1D,
+    0x66, 0x92, 0x1A, 0x59, 0x43, 0x1B, 0x6C, 0x6C, 0x0A, 0x56, 0x44, 0x44, 0xEA, 0x8C, 0x96, 0x8C,
+    0xFF, 0xAB, 0x14, 0x17, 0xFF, 0x97, 0x29, 0x1E, 0x0A, 0x3A, 0x1B, 0xB6, 0x03, 0xC2, 0x0F, 0xEC,
+    0xE4, 0x79, 0x5D, 0x69, 0x0E, 0x1F, 0xDB, 0xC3, 0xC7, 0x8F, 0x9F, 0x8F, 0x8F, 0x4A, 0x27, 0x7B,
+    0x4C, 0xEC, 0xE0, 0x58, 0x67, 0x6C, 0x58, 0xC3, 0xB7, 0xCF, 0x87, 0x91, 0x8B, 0xC0, 0xFE, 0x5F,
+    0xC0, 0xCB, 0x8E, 0xE6, 0x83, 0x17, 0x46, 0x3A, 0x7C, 0xD4, 0x85, 0xCA, 0x12, 0x1B, 0xCD, 0xC3,
+    0x65, 0xA3, 0x19, 0xA9, 0x6A, 0xAF, 0x06, 0x91, 0xD0, 0x3D, 0xB2, 0x00, 0x00, 0xAD, 0x24, 0x3A,
+    0x89, 0x47, 0x72, 0x03, 0x2B, 0x3D, 0x3E, 0x40, 0x37, 0x53, 0xC0, 0xF5, 0xE8, 0xC2, 0xA1, 0x41,
+    0x50, 0xE3, 0xDC, 0xFB, 0x5B, 0xCE, 0x9F, 0x79, 0xEF, 0x06, 0xAE, 0x47, 0x8B, 0x04, 0x93, 0x60,
+    0xF7, 0xC2, 0xD4, 0x14, 0x58, 0xD3, 0x51, 0xA1, 0x0D, 0x36, 0x75, 0x60, 0xA3, 0x1A, 0xE7, 0x73,
+    0xCE, 0x4C, 0x82, 0x89, 0x6E, 0x7E, 0xC6, 0xF7, 0x15, 0xDA, 0xD0, 0xC6, 0x0E, 0x06, 0x91, 0x97,
+    0x86, 0x89, 0x41, 0xF6, 0x1C, 0xC8, 0xFF, 0x48, 0x72, 0x47, 0x72, 0x63, 0x0E, 0x69, 0xE3, 0x81,
+    0xA9, 0xF5, 0x30, 0x86, 0x7C, 0x98, 0x93, 0xD0, 0x22, 0x91, 0xDD, 0xF3, 0x95, 0x35, 0x6D, 0xDF,
+    0x06, 0x5D, 0x6C, 0xA4, 0xEA, 0x42, 0xC7, 0x84, 0xEB, 0xD7, 0xB8, 0xD8, 0x06, 0x9F, 0x06, 0x91,
+    0x74, 0x61, 0xFD, 0xF9, 0xC6, 0xAC, 0x00, 0x5E, 0xA4, 0xB7, 0xD1, 0x8C, 0x4D, 0x66, 0x43, 0xC1,
+    0xA5, 0x27, 0x68, 0x26, 0x66, 0x7F, 0xEF, 0x7B, 0x30, 0x19, 0x91, 0x89, 0xCD, 0x7B, 0xBB, 0x43,
+    0x53, 0xCE, 0x96, 0xEA, 0x59, 0x74, 0x39, 0x46, 0x8F, 0x1D, 0x7A, 0xB2, 0xC5, 0x4E, 0x88, 0x8C,
+    0x58, 0x49, 0x70, 0xE9, 0x41, 0xEE, 0xCF, 0x41, 0x2B, 0xE9, 0x48, 0x26, 0x8E, 0xE4, 0x86, 0x15,
+    0x89, 0xF8, 0xE0, 0xB2, 0x99, 0xE6, 0x55, 0x6E, 0x83, 0x2E, 0x26, 0x61, 0x33, 0x55, 0x67, 0xD4,
+    0xC4, 0x52, 0x15, 0xE8, 0xF0, 0xA1, 0x82, 0x8B, 0xF6, 0x67, 0x27, 0xA0, 0x8B, 0x16, 0x09, 0x30,
+    0xB1, 0x7F, 0x3D, 0xC2, 0x92, 0x75, 0x53, 0xC0, 0x87, 0x36, 0x6C, 0xC1, 0x46, 0x1B, 0xDB, 0x80,
+    0xCE, 0xBA, 0x98, 0x4C, 0x53, 0x98, 0xA8, 0xA8, 0x89, 0x35, 0x5D, 0xAF, 0x2A, 0x2D, 0x66, 0x6A,
+    0x2A, 0xC3, 0x8E, 0x41, 0x26, 0x06, 0x09, 0x46, 0x66, 0x9A, 0xA9, 0x87, 0xE8, 0x2A, 0x91, 0x3C,
+    0x0B, 0xBF, 0x1D, 0x6D, 0xC4, 0x94, 0xA6, 0xCC, 0x07, 0x31, 0xB1, 0x80, 0xE5, 0xAC, 0xF4, 0x26,
+    0xD2, 0x4C, 0x4D, 0x81, 0xEE, 0xBD, 0xE9, 0xC1, 0x48, 0xB8, 0xF5, 0x3A, 0xB0, 0xB0, 0x11, 0x96,
+    0xBA, 0x40, 0xCB, 0x04, 0x3E, 0x2C, 0xA0, 0xED, 0x3D, 0x6A, 0x13, 0x6D, 0x54, 0x12, 0xDB, 0x3D,
+    0x5D, 0xDF, 0x4A, 0xBC, 0x10, 0xD1, 0x8F, 0x37, 0x19, 0xA4, 0x34, 0x53, 0x9B, 0x4D, 0x32, 0xC9,
+    0xF5, 0x26, 0xB6, 0xD8, 0xB8, 0xC4, 0xF5, 0x6B, 0x7C, 0xD8, 0xD2, 0xB1, 0x65, 0x43, 0x65, 0x4F,
+    0xD5, 0xBF, 0x7E, 0xFC, 0xD6, 0x8B, 0x57, 0x56, 0x9B, 0x5D, 0x5B, 0xDA, 0xEC, 0x1F, 0x9C, 0x72,
+    0x04, 0x0C, 0xD0, 0xEE, 0x69, 0x64, 0xC2, 0xDD, 0x9B, 0x99, 0x30, 0x81, 0x2A, 0xA0, 0x23, 0xD8,
+    0x57, 0xF7, 0xB8, 0x41, 0x7A, 0x3F, 0xFA, 0xD8, 0x45, 0x9B, 0xBA, 0x60, 0xD2, 0x06, 0x93, 0xD6,
+    0x98, 0xB4, 0xC2, 0xC6, 0x2D, 0x2E, 0xAE, 0xF0, 0x61, 0x4D, 0x47, 0xA7, 0x2A, 0x5E, 0x0A, 0x46,
+    0xFA, 0x73, 0xD5, 0x6E, 0x24, 0xD8, 0x8F, 0x47, 0x1B, 0x97, 0x36, 0xBA, 0x97, 0xA3, 0x79, 0x23,
+    0x9B, 0x34, 0x5E, 0x4F, 0x1B, 0xD9, 0xB5, 0xC1, 0xFD, 0x24, 0xAA, 0xF7, 0x0B, 0xDB, 0x2D, 0x4B,
+    0xDF, 0x77, 0x7A, 0x2F, 0x74, 0xBB, 0xF3, 0x25, 0x67, 0x33, 0x6A, 0xA9, 0xAE, 0xBF, 0xF5, 0x29,
+    0x96, 0xB0, 0x46, 0x4D, 0xF8, 0xCC, 0x2D, 0xCC, 0x88, 0xEF, 0xE9, 0xB8, 0xD4, 0xF1, 0x78, 0x17,
+    0xB6, 0xAD, 0x14, 0x2B, 0x81, 0xCB, 0xA0, 0x02, 0x56, 0x7A, 0x7D, 0x5F, 0xF8, 0x72, 0x33, 0xCD,
+    0xB4, 0x5A, 0xCF, 0x23, 0x62, 0x89, 0x7D, 0xB7, 0x58, 0x11, 0x3D, 0xFA, 0x5C, 0x59, 0x7A, 0xF4,
+    0x2F, 0x33, 0x8B, 0x35, 0xE6, 0xC7, 0x91, 0xED, 0x16, 0xF7, 0xDD, 0xA8, 0x4A, 0x65, 0x69, 0xA3,
+    0x8D, 0x9B, 0x66, 0xD4, 0xB2, 0xC3, 0xEE, 0x1F, 0x22, 0x3C, 0x71, 0x6B, 0xA7, 0xF3, 0xD2, 0xF6,
+    0x4B, 0xCF, 0x7A, 0xA9, 0xA6, 0x85, 0xCD, 0x6B, 0x09, 0xC3, 0xC8, 0xEE, 0x60, 0x50, 0xBF, 0x74,
+    0x72, 0x34, 0x76, 0x92, 0xFC, 0xFE, 0xC2, 0x7E, 0x66, 0xC7, 0x26, 0x35, 0x55, 0x4B, 0xBC, 0x8A,
+    0xA4, 0x1F, 0x9C, 0x99, 0xB8, 0xFC, 0xEB, 0xCF, 0xE8, 0x3C, 0xB9, 0x00, 0x57, 0xBA, 0xA7, 0x12,
+    0xA8, 0x77, 0xCB, 0x0A, 0xB8, 0xF2, 0x73, 0xDF, 0x43, 0x73, 0xEF, 0xFD, 0x02, 0x74, 0x57, 0xEE,
+    0x02, 0xE6, 0x76, 0x2D, 0x40, 0xE9, 0x1C, 0xF0, 0xA4, 0x4E, 0xA3, 0x39, 0x7A, 0xA1, 0x5F, 0xB9,
+    0x37, 0x8A, 0x64, 0x1B, 0x86, 0x6A, 0x47, 0x8A, 0xDE, 0x5D, 0xEC, 0xE9, 0xCD, 0xA8, 0x65, 0x67,
+    0xFB, 0xEE, 0xD3, 0xB4, 0xB0, 0x84, 0x2D, 0x7F, 0x9A, 0x19, 0x0A, 0xAA, 0xC2, 0xFA, 0x32, 0xEB,
+    0x9B, 0x6C, 0x6B, 0x33, 0x0D, 0x92, 0x5B, 0x09, 0x87, 0x0C, 0xDB, 0xC2, 0x6A, 0x28, 0x4C, 0x4D,
+    0x51, 0xA3, 0x2E, 0xAA, 0xE8, 0xDC, 0x14, 0x9D, 0x74, 0xB6, 0x51, 0x27, 0x17, 0x6D, 0x74, 0xC1,
+    0x45, 0x4F, 0xDB, 0xB7, 0x6C, 0xFA, 0x56, 0xDD, 0xF9, 0x6A, 0xF7, 0xCC, 0x4F, 0xFE, 0xAD, 0x15,
+    0x57, 0xDD, 0x64, 0xF3, 0x85, 0x25, 0xF4, 0x53, 0x58, 0x9E, 0xC0, 0x73, 0x4C, 0x7B, 0xAD, 0xE0,
+    0x24, 0xD2, 0xDC, 0x7B, 0x38, 0x6A, 0x7E, 0x0F, 0x31, 0x86, 0xDE, 0xFF, 0x78, 0xAF, 0x24, 0x4C,
+    0xFE, 0x5F, 0xF5, 0x4F, 0x0B, 0xCE, 0xC1, 0xAA, 0xD0, 0xDC, 0x09, 0xB8, 0x5B, 0xD0, 0x6D, 0x51,
+    0xE3, 0x88, 0x79, 0xA3, 0xD0, 0xEA, 0xFC, 0xCD, 0xC9, 0xBD, 0xFD, 0x72, 0x72, 0xD5, 0xE3, 0xFB,
+    0x8B, 0xE8, 0x4C, 0xB3, 0xDB, 0xB2, 0x6F, 0x14, 0x28, 0x1D, 0x3C, 0xA9, 0x33, 0x3A, 0x2E, 0xE0,
+    0xD8, 0x44, 0x6C, 0xD8, 0x42, 0x71, 0x3D, 0x5F, 0x64, 0x44, 0x27, 0x0F, 0xAB, 0xA6, 0xBC, 0x75,
+    0xB7, 0x6F, 0x57, 0x5D, 0xD1, 0xF2, 0x74, 0xA5, 0x8D, 0x97, 0x2E, 0x6C, 0x50, 0x13, 0x7A, 0x6C,
+    0x24, 0x23, 0x20, 0xB4, 0x99, 0xCF, 0x8C, 0xFA, 0x7B, 0xA8, 0xB7, 0xFB, 0xF7, 0x13, 0x4F, 0xAC,
+    0xBE, 0x78, 0x95, 0xE6, 0xF6, 0xED, 0x1F, 0x45, 0xAE, 0x5E, 0xFD, 0xCE, 0x29, 0xFA, 0xE5, 0x9F,
+    0xD8, 0x9E, 0xEF, 0x2C, 0xD3, 0x88, 0xD3, 0xD5, 0x41, 0xEE, 0x42, 0x79, 0x6D, 0xAD, 0x8B, 0x3B,
+    0x93, 0xB8, 0x40, 0x5E, 0x2D, 0x2A, 0xB8, 0xC4, 0x45, 0xB8, 0x6E, 0xCE, 0x70, 0x31, 0xEA, 0xAC,
+    0x8A, 0x4E, 0x4D, 0x31, 0x51, 0x67, 0xFB, 0xB3, 0xE7, 0xB3, 0x13, 0x49, 0xEE, 0x1F, 0x5E, 0x88,
+    0x2E, 0xD8, 0xE8, 0x71, 0x7D, 0x8B, 0x7B, 0x66, 0x89, 0xBF, 0xB5, 0xC0, 0x4F, 0x2B, 0x5C, 0x7E,
+    0x38, 0x7F, 0x12, 0x22, 0xA1, 0xBB, 0x56, 0x5D, 0xB4, 0x3F, 0x1D, 0x39, 0xE9, 0xD0, 0xEF, 0x26,
+    0xD6, 0x5B, 0xCC, 0xDB, 0x91, 0x6D, 0xC5, 0x7D, 0x37, 0x36, 0xE3, 0x19, 0x27, 0xA6, 0xF8, 0xD8,
+    0x49, 0x61, 0x18, 0xCF, 0x39, 0xDB, 0x66, 0x9F, 0x87, 0x32, 0x8C, 0xFA, 0x17, 0x1F, 0x8E, 0xFA,
+    0xED, 0x97, 0x46, 0xFD, 0x6B, 0x55, 0x4C, 0x6D, 0x8A, 0x2D, 0x3A, 0xBB, 0xAC, 0x93, 0x8B, 0x26,
+    0xFA, 0xFE, 0x3C, 0xFE, 0xD7, 0x1E, 0xC6, 0xF7, 0xE9, 0x02, 0x40, 0xB6, 0x34, 0xF2, 0x8A, 0x44,
+    0xA6, 0x0F, 0x2A, 0x6E, 0x65, 0x13, 0xC2, 0x1A, 0x9F, 0x4C, 0x6A, 0x2A, 0x2B, 0x5A, 0x6C, 0xD4,
+    0x85, 0x89, 0x05, 0x3E, 0x98, 0xA8, 0x0B, 0x5B, 0xD6, 0xB8, 0xD4, 0xF6, 0x88, 0x64, 0xFC, 0x30,
+    0xD2, 0x94, 0xCB, 0x70, 0x05, 0xD0, 0xE9, 0xE0, 0xD7, 0x6C, 0x02, 0x2D, 0x23, 0xFC, 0xD5, 0x6B,
+    0x0F, 0x7B, 0x52, 0xAA, 0xFE, 0x60, 0x65, 0x23, 0x1E, 0x96, 0xB0, 0x80, 0x15, 0xF3, 0x6F, 0x8C,
+    0x54, 0x38, 0xE3, 0xCB, 0x9B, 0x3F, 0x2F, 0x9D, 0x44, 0xF7, 0x70, 0x9C, 0xD0, 0x66, 0x9F, 0x6C,
+    0x1E, 0xCA, 0x50, 0x36, 0xA3, 0xFE, 0xC5, 0x47, 0xBF, 0xF9, 0x70, 0xD4, 0x6F, 0xFF, 0xCD, 0xBB,
+    0x3F, 0x1C, 0xF5, 0xAF, 0x9B, 0xBB, 0xAA, 0x98, 0xAA, 0xE7, 0xCB, 0x8E, 0x3A, 0xBB, 0x6C, 0x8A,
+    0x4E, 0x2E, 0xDA, 0x64, 0xA2, 0xEF, 0x5D, 0xB4, 0xD1, 0xE3, 0x82, 0xEB, 0x5B, 0x3C, 0xEE, 0x6B,
+    0x4B, 0x5A, 0xFC, 0xC9, 0x82, 0x25, 0xED, 0xB4, 0x62, 0x71, 0xF1, 0xFA, 0x70, 0x34, 0x52, 0x95,
+    0x44, 0x9B, 0x39, 0x63, 0x89, 0xCE, 0x3A, 0xD3, 0xB1, 0xA0, 0x29, 0x26, 0xE2, 0xC2, 0x29, 0x8C,
+    0x0E, 0xDC, 0x4B, 0x05, 0x4E, 0x17, 0x60, 0x5F, 0xE9, 0xE1, 0xB8, 0x80, 0xF9, 0x1E, 0x30, 0xF4,
+    0x60, 0x1F, 0xC8, 0xB1, 0x0F, 0xA0, 0x13, 0x4A, 0x8D, 0xB0, 0xA9, 0x60, 0xF6, 0xCC, 0xB0, 0x9C,
+    0x43, 0xBD, 0x83, 0xE6, 0xE3, 0x02, 0xA7, 0x7F, 0x38, 0x6F, 0x1B, 0xAA, 0xF0, 0x10, 0xB8, 0x23,
+    0x79, 0x07, 0x23, 0x92, 0xF5, 0xBD, 0xD5, 0xF5, 0x58, 0x6D, 0x3C, 0x6B, 0x39, 0xD5, 0xBF, 0xCC,
+    0x2E, 0x74, 0x2B, 0x46, 0xFD, 0x71, 0x74, 0x2C, 0xAB, 0x2A, 0xFA, 0xE7, 0xD1, 0xB3, 0xDA, 0x36,
+    0xD9, 0xBD, 0x92, 0x97, 0xBA, 0x74, 0x2F, 0xBF, 0x59, 0x11, 0xD9, 0xA3, 0x86, 0xFD, 0xC1, 0x4D,
+    0xD9, 0x1E, 0x18, 0xE1, 0xB2, 0x03, 0xF3, 0x4A, 0x82, 0xCD, 0x08, 0x6A, 0x3A, 0x4F, 0x22, 0xAB,
+    0x6A, 0x84, 0x4D, 0xFC, 0xCB, 0xC9, 0xFF, 0x23, 0xEE, 0x76, 0x82, 0xF5, 0x29, 0x68, 0x01, 0xDA,
+    0x78, 0x78, 0xB2, 0x8B, 0x73, 0xB6, 0xEA, 0xFD, 0x02, 0x57, 0x5B, 0x9A, 0x17, 0xAF, 0xDD, 0xFB,
+    0x66, 0x97, 0x9D, 0xE8, 0x89, 0x4D, 0x38, 0x6F, 0x2F, 0x5B, 0xF1, 0x56, 0x70, 0xBD, 0x8D, 0x26,
+    0x35, 0x45, 0x15, 0x26, 0xB6, 0x2C, 0x58, 0xD2, 0xE2, 0x82, 0x8B, 0x36, 0xEA, 0xA4, 0x8B, 0x2A,
+    0xCD, 0xC4, 0x56, 0xED, 0x68, 0xD5, 0x9D, 0xAF, 0xBB, 0x37, 0xDF, 0xBF, 0xFB, 0x94, 0x14, 0x89,
+    0x5D, 0xBE, 0xF2, 0x7D, 0xE0, 0x2A, 0xE0, 0x66, 0xE0, 0x66, 0xF9, 0x1A, 0x81, 0x67, 0x0F, 0xD5,
+    0xE7, 0xFB, 0x92, 0x75, 0xD1, 0x59, 0x67, 0x9D, 0x74, 0x32, 0xD1, 0x44, 0x1B, 0x5D, 0xB4, 0xB1,
+    0xED, 0xCD, 0x87, 0x12, 0xB4, 0xFC, 0x3C, 0xF0, 0x0D, 0x7F, 0x58, 0x19, 0x97, 0x8F, 0xC3, 0x72,
+    0x0B, 0x5D, 0x81, 0xAE, 0x7F, 0xE8, 0x41, 0x86, 0x68, 0xA2, 0x7D, 0x55, 0xE8, 0x58, 0xB3, 0x65,
+    0x6A, 0x8A, 0x2E, 0x26, 0xB9, 0xE8, 0xFA, 0x96, 0x25, 0x0B, 0x4E, 0x19, 0x9B, 0xA2, 0x93, 0x89,
+    0xAE, 0xF7, 0x74, 0x2C, 0xA8, 0x4C, 0xAA, 0x98, 0xEC, 0x92, 0x8D, 0x5D, 0xD8, 0xD0, 0xE9, 0x9D,
+    0x59, 0xFD, 0x49, 0x5D, 0x4D, 0xC7, 0x1F, 0xBD, 0x29, 0x6F, 0xC9, 0xED, 0xBD, 0xA9, 0x66, 0x72,
+    0x49, 0x5D, 0xF0, 0x10, 0xBF, 0x8F, 0x08, 0x7F, 0x56, 0x57, 0xD3, 0xF1, 0x47, 0x6F, 0xC8, 0x5B,
+    0x72, 0x5B, 0x4C, 0x35, 0x93, 0x5B, 0x29, 0x14, 0x14, 0x98, 0x15, 0x7D, 0xE6, 0x0B, 0x9C, 0xF2,
+    0xC0, 0xF4, 0xF2, 0xD9, 0x83, 0x7D, 0x29, 0x1B, 0x11, 0x17, 0x5C, 0x5F, 0x74, 0xB2, 0xA1, 0xC0,
+    0x55, 0x70, 0x92, 0xD5, 0xFD, 0x21, 0x2E, 0xD8, 0xEA, 0x68, 0xD2, 0x8A, 0x95, 0x89, 0x36, 0x2E,
+    0xD4, 0xA8, 0xEF, 0xEF, 0x70, 0x72, 0xF8, 0xBF, 0x00, 0xB8, 0x9E, 0xE0, 0xA6, 0x64, 0x18, 0x75,
+    0x42, 0x15, 0x13, 0x69, 0x8A, 0x8D, 0xE8, 0xE2, 0xFE, 0x36, 0xE8, 0xEC, 0x64, 0xD4, 0xC9, 0xFF,
+    0xC7, 0xCE, 0xC4, 0x96, 0x13, 0x1B, 0xAF, 0xB0, 0x74, 0xFD, 0x82, 0x85, 0x0B, 0x4B, 0x56, 0xFE,
+    0x6B, 0x9D, 0x9A, 0xFC, 0xDA, 0xDF, 0xC9, 0xED, 0x64, 0x25, 0xF8, 0x74, 0xA8, 0x19, 0x47, 0x3B,
+    0xB4, 0x04, 0x74, 0x44, 0x15, 0x38, 0x85, 0xC5, 0xE7, 0xF0, 0x32, 0x99, 0x7B, 0xC3, 0x53, 0x59,
+    0xE7, 0x91, 0x69, 0xC1, 0xD2, 0x05, 0xF7, 0x74, 0x76, 0xFD, 0xF0, 0x7A, 0xB4, 0x12, 0xE6, 0x7B,
+    0xC0, 0x17, 0x76, 0xB4, 0x92, 0xDA, 0x6B, 0xF5, 0x33, 0xF8, 0x80, 0xCE, 0x30, 0xF1, 0xDC, 0x09,
+    0x83, 0xF4, 0x8F, 0x3D, 0x9F, 0xE6, 0xAD, 0xF1, 0x98, 0x75, 0xCB, 0x89, 0xD9, 0xEF, 0x19, 0x2E,
+    0x0C, 0x09, 0x5B, 0xB1, 0x3B, 0x2B, 0xB4, 0x92, 0x5C, 0x6C, 0x5F, 0xAA, 0x3A, 0xB7, 0xA1, 0x0D,
+    0xA3, 0xEB, 0x4D, 0x5A, 0xD9, 0xC8, 0xD8, 0x3E, 0x9F, 0x59, 0x38, 0x19, 0xF1, 0x4F, 0xFF, 0xAA,
+    0x62, 0x7F, 0x38, 0xB6, 0xE8, 0xBC, 0xB2, 0xB1, 0x29, 0xAD, 0x1A, 0xD5, 0xE4, 0xFA, 0x4E, 0x4D,
+    0x3A, 0x59, 0x99, 0xD4, 0x3C, 0x5C, 0xE7, 0xCA, 0xAA, 0xA1, 0xE2, 0xA4, 0xD2, 0x85, 0x89, 0x15,
+    0x23, 0x5B, 0x0A, 0x55, 0x15, 0x6E, 0x35, 0x99, 0x4E, 0x12, 0xF6, 0x4E, 0xC4, 0x7D, 0x35, 0xD2,
+    0xDA, 0xC8, 0xCA, 0xFD, 0xDD, 0x57, 0x26, 0x77, 0xAB, 0x2B, 0x6E, 0xEA, 0x7A, 0x97, 0x2E, 0x01,
+    0x7C, 0x56, 0x05, 0x9B, 0x2A, 0x3B, 0x1F, 0x6D, 0xB8, 0xF8, 0x87, 0x90, 0x92, 0x9E, 0x5B, 0x3B,
+    0x96, 0x3A, 0xDB, 0x7E, 0xA9, 0x8A, 0x49, 0x4B, 0x35, 0xE9, 0x74, 0x8B, 0xB5, 0x04, 0x2B, 0x81,
+    0xDD, 0x5C, 0xDD, 0x2D, 0x5F, 0x32, 0xF9, 0x7A, 0xE8, 0x24, 0x29, 0xC9, 0x10, 0xE0, 0xBF, 0x00,
+    0xCD, 0xBC, 0x3F, 0xAC, 0x24, 0xC7, 0x9D, 0xE7, 0xF9, 0x89, 0x0C, 0xF6, 0x0B, 0xAA, 0x63, 0xA5,
+    0x68, 0x83, 0xDC, 0x95, 0x48, 0x91, 0xB9, 0x86, 0x0C, 0x42, 0xDB, 0xDD, 0x39, 0x06, 0x0D, 0x1A,
+    0xAF, 0x2A, 0x83, 0x24, 0xB0, 0x04, 0x56, 0x86, 0xFA, 0x00, 0xB5, 0x64, 0x10, 0x07, 0xCA, 0x18,
+    0x63, 0x31, 0x83, 0x9D, 0x27, 0x83, 0x46, 0xE3, 0x50, 0xF5, 0x2A, 0x49, 0x1A, 0x34, 0x08, 0x1C,
+    0xDF, 0x01, 0x37, 0xE7, 0xC8, 0x91, 0x31, 0x07, 0x1C, 0xDE, 0xEC, 0x4D, 0xD3, 0x68, 0xA3, 0xF7,
+    0xB6, 0xDE, 0xAB, 0x10, 0xDB, 0xA0, 0x21, 0x43, 0x29, 0xE9, 0x06, 0x34, 0x68, 0x28, 0x34, 0xA4,
+    0x66, 0x70, 0xE2, 0x9D, 0x3A, 0x24, 0x25, 0x67, 0xB2, 0xC9, 0xAC, 0xFA, 0x9D, 0x11, 0x59, 0xEF,
+    0x4F, 0x53, 0xD2, 0x4A, 0x23, 0x0E, 0xB5, 0x05, 0xBC, 0xD7, 0xAF, 0x2A, 0xAB, 0x33, 0x23, 0x7E,
+    0xF1, 0x8B, 0xDF, 0x9F, 0xEF, 0xEF, 0xFB, 0x0B, 0x1E, 0xC0, 0x05, 0x93, 0x54, 0xC7, 0x25, 0x00,
+    0x4F, 0xE4, 0x29, 0x1E, 0xC3, 0x7A, 0x1D, 0x48, 0xCC, 0xA8, 0x70, 0x8D, 0x6E, 0x8B, 0xC4, 0x40,
+    0x4D, 0xE5, 0x5D, 0x28, 0x3C, 0x00, 0x14, 0x11, 0x26, 0xA0, 0x03, 0xEC, 0x82, 0x69, 0x50, 0x1B,
+    0x5F, 0xC8, 0x06, 0x91, 0x54, 0x3F, 0xFE, 0x98, 0xFB, 0x6E, 0x5B, 0xA4, 0xCB, 0x4C, 0x75, 0xD0,
+    0xED, 0x53, 0xCC, 0x8C, 0xB7, 0xE1, 0x0D, 0x96, 0x0E, 0xD3, 0xC6, 0x07, 0xEA, 0xC7, 0xCC, 0x9B,
+    0xF2, 0x76, 0x67, 0x65, 0xA0, 0xBC, 0x07, 0x37, 0xC0, 0x7A, 0x48, 0xE0, 0x40, 0x45, 0xB8, 0x02,
+    0x6A, 0x7C, 0x08, 0xB0, 0x23, 0xC0, 0x4A, 0xC0, 0xB6, 0x47, 0x30, 0xA3, 0x43, 0x47, 0x1D, 0x28,
+    0x79, 0x00, 0x96, 0x80, 0x8E, 0x40, 0xE9, 0xE1, 0xE2, 0xE6, 0xB0, 0x61, 0x25, 0x1B, 0x28, 0x1B,
+    0x60, 0x0E, 0xE8, 0x04, 0xB8, 0xED, 0xBB, 0x22, 0x41, 0x71, 0xF3, 0x2F, 0xBF, 0x7E, 0xCB, 0x89,
+    0x48, 0xA8, 0xFF, 0xB7, 0xD5, 0x86, 0xEF, 0x9C, 0x3C, 0xE6, 0x29, 0xB8, 0xA2, 0x7F, 0x28, 0xAF,
+    0x37, 0x6E, 0x23, 0x2D, 0x73, 0xD5, 0xE1, 0xBC, 0x6B, 0x54, 0xE2, 0x36, 0x8F, 0xE3, 0x7C, 0x11,
+    0x55, 0xA2, 0x62, 0x8A, 0x5E, 0xBF, 0xD0, 0x16, 0x1F, 0xC9, 0x5D, 0x7F, 0xFB, 0xE2, 0xC1, 0xAE,
+    0x02, 0xC5, 0x42, 0x94, 0xDC, 0x93, 0xDE, 0x48, 0xBB, 0xA1, 0xE8, 0x54, 0x4F, 0xE9, 0x75, 0xA2,
+    0xC7, 0x06, 0x17, 0x28, 0x9B, 0x25, 0xD4, 0xBA, 0xE5, 0x0B, 0xEB, 0xFA, 0x4F, 0x59, 0x7C, 0x28,
+    0x2D, 0x5F, 0x97, 0xEB, 0x60, 0x3A, 0x28, 0x45, 0x22, 0xB5, 0x08, 0xA8, 0x0E, 0xB0, 0x01, 0xA8,
+    0x01, 0x7A, 0x60, 0x6F, 0x03, 0x46, 0x06, 0x00, 0x4A, 0xAE, 0x32, 0x61, 0x97, 0x5D, 0x6E, 0x70,
+    0x9B, 0x8E, 0xA4, 0x12, 0xA7, 0xF2, 0xF1, 0xD6, 0x3B, 0xEF, 0xCE, 0x7C, 0x69, 0xC6, 0x43, 0xB0,
+    0xD3, 0x63, 0xA5, 0x75, 0x4F, 0xF7, 0xCE, 0x5F, 0x75, 0xAD, 0x79, 0x6E, 0x49, 0xF1, 0xBD, 0x86,
+    0xD4, 0xB3, 0x6B, 0x83, 0xE5, 0x48, 0x25, 0xD3, 0xD6, 0xCC, 0x74, 0xE7, 0x7C, 0xF5, 0x4C, 0xAB,
+    0xBA, 0x17, 0x29, 0xAF, 0xA0, 0xDE, 0xFF, 0x0C, 0xF5, 0xEB, 0x8D, 0xFB, 0x51, 0x32, 0x71, 0xF5,
+    0xED, 0x68, 0xA5, 0xE5, 0x61, 0xF8, 0xBC, 0x7A, 0x2E, 0x1E, 0x1F, 0xBB, 0xB7, 0x9B, 0xDB, 0xF0,
+    0xB0, 0x07, 0x16, 0x12, 0xA1, 0x3E, 0x78, 0x3E, 0xE2, 0x1A, 0x6C, 0xA3, 0x5B, 0xB8, 0xCA, 0x2D,
+    0x75, 0xEC, 0x6F, 0x39, 0xA4, 0xD7, 0x6F, 0xB6, 0x13, 0xDD, 0x5C, 0xDE, 0x35, 0xCD, 0x93, 0xEA,
+    0xDD, 0x70, 0x0B, 0x3E, 0xF7, 0x94, 0x03, 0x7E, 0xD5, 0x24, 0x70, 0xBB, 0xCE, 0xC3, 0xBB, 0x61,
+    0x09, 0x8F, 0x5F, 0xD1, 0xEF, 0x7D, 0xBE, 0x08, 0xB1, 0x94, 0xB0, 0x6B, 0xFD, 0x23, 0x07, 0xD6,
+    0x4F, 0xA0, 0x88, 0x74, 0xB0, 0x44, 0xDF, 0x53, 0xC7, 0x60, 0x64, 0x03, 0xA8, 0xEB, 0xC0, 0x43,
+    0x18, 0x09, 0xF3, 0x7D, 0xDD, 0xDE, 0x7A, 0x5C, 0x87, 0x5B, 0x4E, 0x87, 0xDB, 0xCE, 0xFC, 0x60,
+    0xFA, 0x5F, 0x6F, 0xAD, 0xBE, 0x1A, 0xAE, 0x3D, 0x04, 0xD4, 0xF2, 0x77, 0xB2, 0x01, 0xA8, 0x45,
+    0xBE, 0x2F, 0x92, 0x60, 0x17, 0x5C, 0xD6, 0xCE, 0x04, 0xFC, 0xD9, 0xE1, 0x42, 0xDE, 0x97, 0x0E,
+    0x75, 0x0D, 0x4A, 0x69, 0xB9, 0xCA, 0x55, 0xAE, 0xA0, 0xDA, 0xCF, 0xD6, 0xDD, 0x65, 0xAB, 0x5F,
+    0xD7, 0xAF, 0x34, 0x7F, 0x17, 0xDE, 0x68, 0x27, 0xF1, 0xF2, 0x93, 0x2E, 0xD9, 0xCF, 0xE9, 0xFF,
+    0xB9, 0xB8, 0x13, 0x7E, 0x12, 0xE3, 0xB7, 0x36, 0x8F, 0xBD, 0xE8, 0xE0, 0x29, 0x3A, 0x66, 0xD8,
+    0x9F, 0xF5, 0xF0, 0xC8, 0x01, 0x5F, 0x3E, 0x7C, 0x4E, 0x86, 0x2F, 0x1F, 0x36, 0x80, 0x5D, 0x23,
+    0x6B, 0xDB, 0x2C, 0x77, 0xE9, 0x92, 0xFE, 0x51, 0xEB, 0x6C, 0x58, 0x3A, 0x09, 0xB6, 0x07, 0xEE,
+    0x1B, 0xC0, 0x2E, 0x5F, 0xBE, 0x79, 0xF8, 0xBA, 0x48, 0xBA, 0xFE, 0xC1, 0xD7, 0xCE, 0x5F, 0x79,
+    0x68, 0x5C, 0x46, 0x2D, 0x32, 0x88, 0x08, 0xEC, 0x35, 0x4E, 0xC2, 0x51, 0xF9, 0x6C, 0x98, 0x3C,
+    0x40, 0xC2, 0x35, 0x2C, 0x71, 0x0D, 0x3D, 0xA5, 0x2F, 0x12, 0x95, 0x74, 0x22, 0x01, 0xE0, 0x2F,
+    0x7C, 0xBD, 0xB6, 0x2F, 0xC7, 0x6F, 0x3E, 0x8E, 0x0E, 0xAA, 0x2B, 0x84, 0x2F, 0xF7, 0x98, 0xC0,
+    0x0C, 0xF7, 0xD2, 0xF3, 0x71, 0xD5, 0xA9, 0xFF, 0x15, 0xFC, 0xD4, 0xFE, 0xA0, 0x9F, 0x5A, 0x7F,
+    0x6D, 0x7C, 0xC4, 0x6D, 0x26, 0x98, 0xB6, 0x48, 0x94, 0xB8, 0xC0, 0x92, 0x29, 0x3A, 0xD2, 0xE1,
+    0xBC, 0x09, 0x4C, 0xA8, 0x50, 0x59, 0x6B, 0x75, 0x4B, 0x4D, 0xE9, 0x19, 0x18, 0xD0, 0xC9, 0x76,
+    0x94, 0xF1, 0xFF, 0xFA, 0xFB, 0xB0, 0x92, 0xB7, 0x36, 0xC5, 0x8F, 0x7B, 0xD7, 0x3A, 0xC5, 0x03,
+    0xEC, 0x02, 0x2A, 0x7D, 0x4C, 0x69, 0x75, 0xC3, 0xB9, 0x97, 0x5A, 0x49, 0x60, 0x21, 0x6B, 0xAC,
+    0x7C, 0x0F, 0x16, 0xB2, 0x8B, 0x96, 0x3E, 0x51, 0xCA, 0x8F, 0x1A, 0x56, 0xF2, 0x18, 0x5A, 0x86,
+    0x37, 0x70, 0xF2, 0xAB, 0x40, 0x25, 0xAF, 0xC3, 0x62, 0xFD, 0x14, 0xC8, 0x2F, 0x5A, 0xF8, 0xAF,
+    0xDF, 0x03, 0xDC, 0x2E, 0xF0, 0x54, 0x02, 0xF5, 0xA3, 0x06, 0xEC, 0x63, 0xC0, 0xEE, 0x1B, 0xC0,
+    0xBB, 0x01, 0xCC, 0xFF, 0x08, 0x4C, 0x12, 0xAA, 0x10, 0xA8, 0x8E, 0xAF, 0xC1, 0xA2, 0xDD, 0x3E,
+    0xB5, 0x2C, 0xDF, 0xF9, 0x45, 0x07, 0x3B, 0x4F, 0x6F, 0x74, 0x9C, 0xD8, 0x57, 0xE3, 0x35, 0x78,
+    0xCC, 0xAC, 0xED, 0xC0, 0x8C, 0xE5, 0x76, 0xFF, 0x14, 0x51, 0xB7, 0x8F, 0x76, 0x8B, 0x01, 0xB8,
+    0x80, 0x92, 0xA6, 0x7A, 0xC1, 0xA7, 0xAB, 0xB6, 0xB9, 0x3D, 0xD1, 0x31, 0x39, 0x1D, 0x96, 0xEE,
+    0xB5, 0x50, 0x0E, 0x5C, 0xF0, 0x40, 0x25, 0x3F, 0xC9, 0xBA, 0x75, 0xF2, 0xFA, 0x12, 0xFC, 0x27,
+    0x60, 0x86, 0x5D, 0x03, 0x1D, 0x3B, 0xCB, 0x6C, 0x86, 0x66, 0x59, 0x1E, 0xB7, 0xA1, 0xCC, 0x02,
+    0x99, 0x00, 0x1D, 0xDC, 0x06, 0x12, 0x2A, 0x31, 0x51, 0x09, 0x1D, 0x18, 0x8A, 0x88, 0xF3, 0x7A,
+    0xD0, 0x2D, 0x57, 0x71, 0xB3, 0xB2, 0x67, 0xC6, 0xE4, 0xC6, 0x62, 0x20, 0xD1, 0xDD, 0x02, 0xDD,
+    0xEA, 0x36, 0x81, 0x0D, 0xCE, 0x27, 0x28, 0xA9, 0x65, 0x03, 0x93, 0xFC, 0x4F, 0x0F, 0x45, 0x4B,
+    0x91, 0x40, 0x07, 0x4C, 0x9B, 0xFF, 0xB9, 0x4F, 0xEA, 0x27, 0xAF, 0x16, 0xFE, 0x13, 0x14, 0x09,
+    0xBB, 0x06, 0xD3, 0xB2, 0xB3, 0x04, 0xE7, 0x61, 0x06, 0x57, 0x81, 0xDB, 0x30, 0xCB, 0xE3, 0x4C,
+    0x40, 0x87, 0x6E, 0x81, 0x84, 0x69, 0xCA, 0x4E, 0x25, 0x1C, 0xAB, 0xA1, 0x88, 0xEC, 0x16, 0xDD,
+    0x54, 0xB7, 0xDC, 0xD2, 0xE1, 0x6A, 0xD9, 0xAB, 0x04, 0x93, 0xC5, 0xA0, 0xF3, 0x24, 0x9D, 0xA7,
+    0x48, 0x70, 0x15, 0x5C, 0x80, 0x19, 0x4C, 0x81, 0x0E, 0xD5, 0x81, 0x8E, 0xD8, 0x00, 0x36, 0x50,
+    0x49, 0x4F, 0x09, 0xA5, 0x74, 0x3C, 0xF6, 0x1B, 0x86, 0x89, 0x06, 0xDB, 0x83, 0x8E, 0x38, 0x69,
+    0x28, 0x12, 0xF6, 0x99, 0x88, 0x4A, 0xE0, 0x6F, 0x43, 0x97, 0xF7, 0xD2, 0x6D, 0x50, 0x4B, 0x98,
+    0x81, 0x16, 0xD8, 0x05, 0xBE, 0x91, 0x98, 0xA0, 0x5B, 0x66, 0x3C, 0x8E, 0x4E, 0x54, 0x38, 0xF4,
+    0x40, 0xE9, 0x1D, 0xFA, 0xC7, 0xFF, 0x7A, 0xD5, 0x58, 0xAF, 0xDF, 0x7E, 0x6D, 0xE3, 0x4D, 0xD0,
+    0x3F, 0x6C, 0xAF, 0xA1, 0x83, 0x6E, 0x53, 0x16, 0xED, 0x2E, 0x14, 0x51, 0x8B, 0x44, 0x54, 0x42,
+    0xA4, 0x87, 0x0E, 0x8A, 0x36, 0x6B, 0x70, 0xCA, 0x4E, 0x65, 0x17, 0x2E, 0x9F, 0x1F, 0xA3, 0x67,
+    0x8E, 0x6B, 0x19, 0x50, 0x00, 0x5F, 0xC0, 0xF4, 0xDC, 0x0C, 0xCC, 0x28, 0x31, 0x6D, 0xD1, 0x71,
+    0x44, 0x99, 0xC7, 0x62, 0x02, 0xF3, 0xE2, 0x59, 0xE9, 0x9D, 0x50, 0x9D, 0xAC, 0x4B, 0x19, 0x5A,
+    0xD0, 0x32, 0x07, 0x6E, 0x4B, 0x00, 0x63, 0xD2, 0x7D, 0x22, 0xB8, 0xC6, 0x76, 0x1F, 0xE5, 0x4B,
+    0xE2, 0x81, 0xAB, 0x3D, 0xA0, 0xBF, 0x1F, 0x80, 0x6E, 0x09, 0x94, 0x36, 0x80, 0x6E, 0xE7, 0xC0,
+    0x52, 0x47, 0x70, 0x4C, 0xA1, 0x88, 0x3A, 0xC1, 0xF4, 0xFA, 0x02, 0x9C, 0x48, 0x87, 0xFA, 0xF0,
+    0xF0, 0x66, 0xC3, 0x14, 0xD5, 0x63, 0x03, 0x2E, 0xD0, 0xC1, 0x40, 0x05, 0xAE, 0x7D, 0xF4, 0x1E,
+    0x3B, 0xF2, 0xB6, 0x24, 0x25, 0x6B, 0xE0, 0x02, 0x80, 0xD9, 0x00, 0x7C, 0x90, 0x80, 0xC7, 0x8C,
+    0x87, 0xA2, 0xBD, 0x05, 0x94, 0x2F, 0x00, 0xAC, 0xC2, 0xC9, 0xC8, 0x2E, 0xB0, 0xF5, 0xA6, 0x2C,
+    0x00, 0x5C, 0x07, 0x14, 0x77, 0x1B, 0x60, 0x77, 0x00, 0xDC, 0x57, 0x02, 0xA8, 0xB4, 0x04, 0x26,
+    0xA6, 0x05, 0x1B, 0xA6, 0x40, 0xD2, 0x11, 0xAE, 0x52, 0x83, 0xFE, 0xE9, 0x37, 0x12, 0x88, 0x88,
+    0xA7, 0x3C, 0x3C, 0xEC, 0xD1, 0x91, 0xB2, 0x61, 0x09, 0x03, 0xCE, 0xE3, 0x42, 0x91, 0x60, 0xAD,
+    0x56, 0x07, 0xEC, 0xAD, 0x17, 0x42, 0x29, 0xED, 0x19, 0xE5, 0x10, 0x91, 0x08, 0xEC, 0x89, 0x74,
+    0x80, 0x1D, 0x98, 0x00, 0x46, 0x70, 0x80, 0xFE, 0x71, 0xA3, 0x1B, 0xD0, 0x6F, 0xB7, 0x00, 0xC5,
+    0xDF, 0x25, 0x80, 0x22, 0x2D, 0x01, 0x54, 0xAA, 0x2F, 0x5C, 0x03, 0x3A, 0x27, 0x03, 0xD0, 0x1B,
+    0x59, 0x03, 0x47, 0x5F, 0xCF, 0xB3, 0xC8, 0xAE, 0x75, 0x72, 0x7D, 0x01, 0x30, 0xC1, 0x35, 0x34,
+    0x5C, 0xC5, 0xB4, 0xDC, 0xA2, 0xA2, 0x48, 0xEC, 0x52, 0xC2, 0xC0, 0x1E, 0x55, 0x5F, 0x88, 0x88,
+    0xAF, 0x37, 0x5A, 0xB2, 0xE9, 0x7D, 0xF8, 0x1A, 0x94, 0x22, 0x2D, 0x4E, 0x6E, 0x0A, 0x94, 0xBE,
+    0x4C, 0xD8, 0x80, 0xA0, 0x13, 0xAE, 0xA5, 0xA7, 0xE8, 0x99, 0xC3, 0x82, 0xD2, 0xE3, 0x82, 0x0D,
+    0xE8, 0x24, 0xD2, 0xAB, 0xBE, 0x96, 0x35, 0xFB, 0xCC, 0xA1, 0xF2, 0xD5, 0x78, 0xC5, 0x44, 0x9D,
+    0xD0, 0x89, 0x1E, 0xDD, 0x31, 0x47, 0x77, 0x54, 0xFE, 0xD1, 0x8E, 0x95, 0x48, 0x64, 0x25, 0x1B,
+    0x7F, 0x5E, 0x47, 0xEA, 0x67, 0x3D, 0xC8, 0x3B, 0x0D, 0xEA, 0x57, 0x02, 0x84, 0xF5, 0xB9, 0xAB,
+    0x17, 0xAE, 0x41, 0x21, 0x1B, 0x28, 0x45, 0x02, 0x2B, 0xEF, 0x52, 0xD1, 0xA3, 0x3B, 0x13, 0x51,
+    0x83, 0x0B, 0x30, 0x54, 0x1E, 0x86, 0x1A, 0x18, 0xF6, 0x81, 0xE1, 0xE8, 0xE4, 0xD7, 0x00, 0xAA,
+    0x1F, 0xA0, 0xE8, 0xD6, 0xA0, 0xD3, 0x11, 0xD8, 0x76, 0x01, 0x65, 0x53, 0x7B, 0x16, 0x94, 0xD1,
+    0x0C, 0x18, 0x91, 0x08, 0xAB, 0x0D, 0x27, 0xA1, 0xD9, 0x2E, 0xBB, 0x35, 0x4B, 0xF7, 0x66, 0xD2,
+    0xEF, 0x07, 0x04, 0x8E, 0x29, 0xA4, 0xB1, 0x77, 0x62, 0x45, 0x3F, 0x63, 0x72, 0x89, 0x07, 0x80,
+    0xEB, 0x5C, 0x82, 0x85, 0xBC, 0xDC, 0x52, 0x8A, 0xFC, 0x9C, 0x62, 0xCD, 0x22, 0x52, 0x35, 0xD4,
+    0x5E, 0xF5, 0x68, 0xC1, 0x05, 0xA6, 0x03, 0x47, 0xE8, 0x77, 0x93, 0x4E, 0x4C, 0x5C, 0x28, 0x1B,
+    0xDD, 0xD6, 0x1C, 0x31, 0x61, 0x28, 0x3A, 0xDD, 0xEA, 0xE4, 0xC2, 0x9C, 0xB2, 0xA9, 0x4D, 0xCB,
+    0x11, 0xEB, 0x19, 0x3A, 0x15, 0x12, 0xA8, 0xBC, 0x19, 0x50, 0x3D, 0x2E, 0x52, 0x05, 0x56, 0xD1,
+    0x0C, 0xD8, 0xBB, 0x22, 0x0D, 0xBB, 0x8F, 0x4A, 0xCC, 0x7B, 0x15, 0x80, 0x07, 0x20, 0x1B, 0x3A,
+    0xB5, 0x01, 0xDC, 0x00, 0xD4, 0x07, 0xD9, 0x7C, 0x9F, 0x11, 0xAA, 0x04, 0x59, 0x57, 0x1B, 0x16,
+    0x9D, 0x4E, 0xB8, 0x46, 0x27, 0x6A, 0x54, 0xCF, 0x12, 0x06, 0xD5, 0x8D, 0xFB, 0x6C, 0x6A, 0x03,
+    0xD4, 0x25, 0x50, 0x1E, 0x01, 0xAE, 0x07, 0x6C, 0x02, 0x6C, 0xBB, 0x75, 0x81, 0x2E, 0x6C, 0x23,
+    0xCD, 0xD2, 0x03, 0x15, 0x50, 0x48, 0x0F, 0x4E, 0xFA, 0xF1, 0x41, 0x56, 0x12, 0xEC, 0xF5, 0x64,
+    0xA3, 0x6B, 0x5B, 0x40, 0xA4, 0xC1, 0xBD, 0x2F, 0xD0, 0x15, 0x3D, 0x65, 0xDE, 0x06, 0x4B, 0x6A,
+    0x6C, 0xD0, 0x91, 0x81, 0x39, 0xA5, 0xB7, 0xC1, 0x24, 0x96, 0x3B, 0x03, 0x4E, 0xD6, 0x20, 0xF7,
+    0xF2, 0xFD, 0x8B, 0x04, 0x85, 0xC4, 0x1C, 0x17, 0x03, 0xF0, 0x67, 0x00, 0x95, 0x78, 0xD0, 0xF7,
+    0x56, 0x40, 0xC5, 0x1C, 0x54, 0x47, 0x07, 0x36, 0xE8, 0x00, 0x53, 0xAE, 0x82, 0xEA, 0xC8, 0x8E,
+    0x05, 0xA8, 0xB9, 0x05, 0xF4, 0xA6, 0x01, 0xDD, 0x4E, 0x80, 0x92, 0x01, 0x58, 0x16, 0x3D, 0xE8,
+    0xA8, 0x7B, 0x70, 0x8D, 0xEE, 0x60, 0x8E, 0x4E, 0xA8, 0x84, 0x6D, 0xB1, 0x81, 0xD2, 0x33, 0x7D,
+    0x90, 0x19, 0x74, 0xBD, 0x6E, 0x31, 0x77, 0x64, 0x0D, 0x55, 0x21, 0x01, 0x06, 0x2E, 0x91, 0x5D,
+    0x08, 0x25, 0xA0, 0xE8, 0x01, 0xF7, 0xED, 0x00, 0xD4, 0x6B, 0x80, 0xAB, 0xCD, 0xD6, 0x92, 0x62,
+    0xD3, 0xB7, 0x28, 0xD7, 0x89, 0x2B, 0x75, 0xE4, 0xF3, 0xE5, 0x79, 0xF7, 0x55, 0x76, 0xB7, 0x58,
+    0x49, 0x2A, 0xFA, 0x2A, 0x9A, 0xD6, 0xB4, 0xAE, 0x31, 0xA1, 0xC2, 0x86, 0x29, 0xAE, 0x99, 0x53,
+    0xFA, 0x25, 0x35, 0x4B, 0x16, 0x0C, 0x6C, 0x18, 0xF4, 0xCF, 0xBF, 0x78, 0xFC, 0xC2, 0xD5, 0xD9,
+    0x62, 0x5D, 0xA5, 0x2A, 0x96, 0x41, 0x01, 0x70, 0x0C, 0x85, 0x34, 0x98, 0x57, 0x02, 0xF6, 0xD9,
+    0xF1, 0xE7, 0x9D, 0x06, 0xBD, 0xD9, 0x1A, 0xB3, 0x4F, 0xE0, 0x19, 0x00, 0x85, 0x3C, 0x2D, 0xDE,
+    0x88, 0x7C, 0x94, 0x6C, 0xAC, 0xDA, 0x89, 0x89, 0xBA, 0x75, 0xCF, 0xC6, 0x22, 0xD9, 0x37, 0x13,
+    0x9D, 0x6D, 0x7B, 0x96, 0x65, 0x3B, 0xA7, 0x5E, 0x84, 0x8A, 0x6A, 0xE3, 0x6D, 0x70, 0x1D, 0x3A,
+    0xB9, 0x1E, 0x06, 0xBB, 0xE0, 0xB1, 0xEA, 0xDB, 0xAF, 0xC7, 0x3D, 0x23, 0xDF, 0x15, 0x41, 0x9A,
+    0x72, 0x8D, 0x22, 0x27, 0x60, 0x80, 0xC1, 0x53, 0x3B, 0x4F, 0x9D, 0xA0, 0xCE, 0x26, 0xFA, 0xC6,
+    0x0C, 0x7C, 0x0F, 0x2A, 0x51, 0xFD, 0x53, 0x30, 0x22, 0x7E, 0x5F, 0xAD, 0x75, 0x2C, 0xFA, 0x1A,
+    0x13, 0x7B, 0xDC, 0x57, 0x02, 0x93, 0x1A, 0x95, 0x06, 0xEC, 0x9D, 0xC4, 0xD4, 0x05, 0x95, 0x6A,
+    0x5C, 0x73, 0xAC, 0x7A, 0x44, 0x1A, 0x56, 0x1D, 0xDB, 0xF4, 0x8E, 0xEA, 0xBB, 0x41, 0xC9, 0x8F,
+    0xB1, 0x5F, 0xED, 0xEF, 0x17, 0x7D, 0xB9, 0x46, 0xCB, 0x9A, 0xFA, 0xE9, 0x41, 0xA7, 0xA2, 0x2B,
+    0xBD, 0x89, 0x03, 0xEE, 0xD5, 0x96, 0x79, 0x85, 0xEA, 0x96, 0xDB, 0x3B, 0x17, 0x5D, 0xE5, 0xCB,
+    0x66, 0xA1, 0x06, 0x44, 0xC2, 0xC9, 0x9D, 0x1F, 0x80, 0xB2, 0xC1, 0xA6, 0x9C, 0xCA, 0x00, 0x38,
+    0x91, 0x5F, 0xC9, 0x98, 0xC0, 0x40, 0xD1, 0x50, 0xF4, 0x70, 0x0C, 0x17, 0x4F, 0x82, 0x43, 0xF9,
+    0x41, 0x4B, 0x2D, 0x77, 0xD1, 0x5D, 0x19, 0xA9, 0xA9, 0xBD, 0xEA, 0xF4, 0x06, 0x17, 0xA6, 0x3D,
+    0x73, 0xFD, 0x76, 0x5B, 0xA4, 0x59, 0xE9, 0xED, 0x5B, 0x61, 0x49, 0x7D, 0x5B, 0x27, 0xA4, 0xA9,
+    0x7C, 0xD1, 0xAB, 0x1E, 0x17, 0xCB, 0xA0, 0x44, 0x06, 0x9C, 0x95, 0x53, 0x0B, 0xF9, 0xC0, 0x98,
+    0x92, 0x72, 0x44, 0x4E, 0x00, 0x75, 0xCC, 0x21, 0x4E, 0xF6, 0x5D, 0xDB, 0x64, 0xA9, 0x63, 0x50,
+    0x12, 0x6C, 0xE4, 0x88, 0x29, 0x3A, 0xEA, 0x48, 0xCD, 0x84, 0x22, 0x99, 0x80, 0xF3, 0xB7, 0xA1,
+    0x73, 0xE0, 0x5E, 0x4A, 0x70, 0x7B, 0x02, 0xF6, 0xD5, 0x06, 0x6E, 0x24, 0x30, 0xFF, 0x27, 0xB0,
+    0x6A, 0xC6, 0x5D, 0x3F, 0x8C, 0xBB, 0x5C, 0xB7, 0x28, 0xD5, 0xC1, 0x62, 0x18, 0xFD, 0xE8, 0xD5,
+    0xFC, 0x90, 0xAF, 0x01, 0x12, 0xE0, 0x91, 0x61, 0x6B, 0x1D, 0x7A, 0x72, 0xE0, 0xA5, 0xD2, 0xD6,
+    0x36, 0xC4, 0x85, 0x67, 0x52, 0xAD, 0xD1, 0xDF, 0xFF, 0x76, 0x64, 0xBF, 0xAD, 0xB1, 0xBD, 0x4E,
+    0x08, 0x35, 0x2E, 0xE8, 0xA8, 0x7A, 0x26, 0x54, 0xD8, 0xA0, 0x13, 0x3D, 0x13, 0x4A, 0xAF, 0x83,
+    0x8E, 0xEC, 0xAB, 0x01, 0x2B, 0x02, 0x1F, 0x89, 0xC7, 0x3D, 0x7D, 0xE6, 0x7E, 0x3A, 0x02, 0xFB,
+    0xD9, 0x9C, 0x51, 0x1C, 0xFE, 0x15, 0xC0, 0x37, 0x2F, 0x40, 0xF9, 0x66, 0x4F, 0xD1, 0xD7, 0x9E,
+    0xC7, 0x8B, 0x78, 0xDE, 0x99, 0x7C, 0x2A, 0x92, 0x28, 0x0E, 0xFF, 0x0F, 0x60, 0x21, 0x61, 0xFB,
+    0xE7, 0x1F, 0x35, 0xE4, 0xB9, 0x78, 0x78, 0x40, 0x25, 0x89, 0x8B, 0x87, 0xDF, 0xF9, 0x64, 0x2D,
+    0x0E, 0xA3, 0x47, 0xFC, 0x26, 0x98, 0x78, 0x05, 0xA8, 0xA5, 0x01, 0xA4, 0x05, 0xD4, 0xB5, 0x3F,
+    0x6A, 0x90, 0x07, 0x9F, 0xE3, 0x4B, 0x94, 0x3E, 0xE1, 0xA4, 0xC5, 0x88, 0x3F, 0xB1, 0x81, 0x9F,
+    0xCC, 0xCC, 0xFF, 0x18, 0x81, 0x61, 0x76, 0x32, 0x29, 0x07, 0x6E, 0x5B, 0xE5, 0xA7, 0xEE, 0x01,
+    0x36, 0x9F, 0xD4, 0xBA, 0x3A, 0xE0, 0x4A, 0xCE, 0x04, 0x98, 0x01, 0x8B, 0x08, 0xD5, 0x36, 0x2C,
+    0x55, 0xE4, 0xC4, 0x8E, 0x95, 0xCF, 0x57, 0xCA, 0x78, 0x1A, 0x76, 0xC0, 0xD7, 0xA0, 0x10, 0xF1,
+    0x85, 0xC8, 0xC0, 0xCA, 0x97, 0xA1, 0x6A, 0x98, 0x99, 0x88, 0x6D, 0x06, 0x78, 0xA3, 0xF2, 0xA3,
+    0xC0, 0xA6, 0x80, 0x69, 0xC9, 0x09, 0x87, 0x0D, 0xDB, 0x3F, 0xDA, 0xEC, 0xC2, 0x30, 0x09, 0x7C,
+    0x1D, 0xB8, 0xA2, 0xE4, 0x2F, 0xF7, 0x82, 0x11, 0x89, 0x58, 0x89, 0xE3, 0xB3, 0xB9, 0x00, 0x3A,
+    0xA0, 0x13, 0x45, 0x4E, 0xB8, 0x12, 0xFC, 0xDB, 0xED, 0xE3, 0xCD, 0x06, 0x27, 0xC1, 0xFD, 0x6D,
+    0xB2, 0x01, 0x13, 0xD0, 0x11, 0x3A, 0x98, 0x41, 0x05, 0x2E, 0xA0, 0x13, 0x1C, 0xF1, 0x64, 0xF9,
+    0x83, 0xA5, 0x96, 0x81, 0xBA, 0xDB, 0x0E, 0xFC, 0x1A, 0x50, 0x37, 0xE0, 0xD6, 0xA0, 0x7F, 0xD9,
+    0xC1, 0x60, 0x1B, 0xAE, 0x9E, 0x44, 0x4B, 0x9F, 0xC2, 0xA4, 0xB2, 0x0D, 0xAB, 0x5B, 0xA6, 0x03,
+    0xD3, 0x92, 0xAA, 0x68, 0x3F, 0xC7, 0x9F, 0xFC, 0x61, 0x93, 0x62, 0x34, 0x90, 0x26, 0x01, 0x2B,
+    0xB8, 0x2F, 0x59, 0xFE, 0x14, 0x26, 0xF5, 0x06, 0xBA, 0xC3, 0xA4, 0x51, 0x6B, 0x47, 0xCD, 0xEC,
+    0x91, 0x41, 0x7F, 0x30, 0xB3, 0x81, 0x12, 0xA6, 0x30, 0x81, 0x19, 0x59, 0xED, 0x19, 0xE0, 0x88,
+    0x27, 0x17, 0xFF, 0x3E, 0xD5, 0x12, 0xDC, 0x3A, 0x4F, 0xE4, 0xA0, 0x68, 0x29, 0xFD, 0x32, 0x07,
+    0xF0, 0x46, 0x02, 0x94, 0x69, 0x74, 0x6F, 0x9F, 0xDA, 0xE2, 0x78, 0xD3, 0xCC, 0x99, 0x39, 0xAF,
+    0xDF, 0x6D, 0x29, 0x7B, 0xD8, 0x40, 0xD1, 0x9C, 0x3A, 0xF3, 0x06, 0x19, 0xA8, 0xBF, 0x11, 0x6C,
+    0x40, 0x25, 0x98, 0xE6, 0x7D, 0x3A, 0x42, 0x22, 0x43, 0x8E, 0x90, 0x8F, 0x78, 0xD2, 0x74, 0x7B,
+    0xD4, 0x12, 0x90, 0x76, 0x5C, 0xA2, 0x2F, 0xF2, 0x14, 0xB8, 0xB0, 0x0F, 0xAA, 0x9F, 0x03, 0xD5,
+    0x11, 0xA0, 0xD7, 0x27, 0xBB, 0x1B, 0x80, 0xEB, 0x1E, 0x16, 0x22, 0x9E, 0x7A, 0xB3, 0x1A, 0x60,
+    0xCE, 0x22, 0x50, 0xA1, 0x07, 0x5C, 0xA0, 0xF6, 0x3A, 0x62, 0xA3, 0xEA, 0x51, 0x03, 0x73, 0xA8,
+    0xB3, 0x4A, 0xB8, 0x80, 0x89, 0x3A, 0xA2, 0x7A, 0xD5, 0xC1, 0x11, 0x47, 0xE3, 0x95, 0xB2, 0x71,
+    0x01, 0x17, 0x74, 0xC4, 0xB5, 0xAA, 0xC3, 0xB5, 0x1C, 0xB1, 0xD7, 0x16, 0x22, 0xD2, 0x14, 0x22,
+    0xF7, 0xCE, 0x6A, 0xC7, 0x45, 0x46, 0x6B, 0xA3, 0x7C, 0x82, 0xBA, 0x9B, 0xC1, 0x23, 0xEB, 0x2B,
+    0x40, 0xE5, 0x00, 0x7B, 0xC7, 0x6F, 0x6D, 0x4F, 0xC7, 0x68, 0x25, 0x56, 0x7B, 0xA0, 0x44, 0x1A,
+    0x54, 0x5F, 0x45, 0x54, 0xA7, 0x3A, 0xE8, 0x99, 0xC1, 0x8C, 0x0A, 0xA6, 0xB8, 0x06, 0xE7, 0x4D,
+    0x8B, 0x09, 0x3A, 0x51, 0x24, 0x35, 0xC0, 0x92, 0x0D, 0xD4, 0x7C, 0xF4, 0x2A, 0xF6, 0xA7, 0xBF,
+    0xFC, 0x87, 0xA0, 0xA4, 0x5B, 0x05, 0xAA, 0x58, 0x86, 0x13, 0x15, 0xFE, 0xA3, 0x24, 0x9C, 0x0F,
+    0x8D, 0x0E, 0xEC, 0x91, 0x35, 0x60, 0x46, 0x5D, 0xB1, 0x32, 0xC0, 0xD7, 0xEF, 0x79, 0x28, 0x61,
+    0xE7, 0x7F, 0x49, 0x68, 0xD9, 0xA0, 0xD6, 0x8B, 0xC8, 0x94, 0x35, 0x2E, 0x98, 0xA0, 0x12, 0x4B,
+    0xA6, 0xB8, 0x46, 0xB7, 0xAA, 0x63, 0x46, 0x4D, 0xCE, 0x60, 0xD8, 0xE0, 0xC2, 0xF4, 0x27, 0xE1,
+    0xF8, 0x85, 0xAB, 0x33, 0x23, 0x3F, 0x94, 0x3C, 0xC3, 0x1C, 0xF1, 0x7E, 0xF9, 0xF0, 0x00, 0x44,
+    0xFC, 0xAF, 0x89, 0x11, 0xAC, 0x88, 0xF8, 0x47, 0x45, 0x06, 0x4C, 0xAB, 0x12, 0x15, 0x3A, 0x30,
+    0xF0, 0xD9, 0x2C, 0xF6, 0x33, 0xC0, 0xBE, 0x02, 0x27, 0x1B, 0xA8, 0xA5, 0x43, 0xF5, 0x5B, 0xA5,
+    0xAE, 0x00, 0x06, 0x76, 0xD0, 0x91, 0x5D, 0x4A, 0xAF, 0x12, 0x47, 0xBC, 0xD0, 0x54, 0x22, 0x43,
+    0x21, 0x22, 0x09, 0xBE, 0x7C, 0xE8, 0x2B, 0x49, 0x3B, 0x39, 0x60, 0x3A, 0xD1, 0xE4, 0xE2, 0xA3,
+    0x4E, 0xC7, 0x69, 0x11, 0xDD, 0x4B, 0xC9, 0xB4, 0xBD, 0x89, 0x13, 0x1B, 0xCB, 0x45, 0x6B, 0xC5,
+    0xEB, 0x0E, 0x06, 0xA8, 0xB8, 0x68, 0xE2, 0x9E, 0x17, 0xF1, 0xE5, 0xE6, 0x34, 0x6C, 0x87, 0x37,
+    0x54, 0x40, 0xC7, 0xAB, 0x63, 0xAE, 0xE7, 0xCE, 0x64, 0xCB, 0xF9, 0xB5, 0x12, 0xE9, 0xD4, 0x4A,
+    0x24, 0x30, 0xA7, 0xCC, 0x20, 0x83, 0x0B, 0xB4, 0x4C, 0xB7, 0xF8, 0xA9, 0xC9, 0xA3, 0xBE, 0x04,
+    0x22, 0x11, 0x2D, 0xE2, 0x73, 0x2D, 0xE3, 0x68, 0xAC, 0x5E, 0xE0, 0x02, 0xDF, 0x64, 0x8A, 0x0E,
+    0xAA, 0xA3, 0xC4, 0xB6, 0x17, 0xFA, 0x42, 0x44, 0x42, 0x25, 0x92, 0x13, 0x41, 0xE3, 0xFF, 0x15,
+    0x4B, 0x13, 0x8C, 0x24, 0xAA, 0xE1, 0x14, 0x5C, 0x86, 0xB2, 0xC7, 0xDE, 0x6D, 0x75, 0x9C, 0x72,
+    0x5B, 0xC7, 0x92, 0xB9, 0x8E, 0x65, 0x33, 0xB1, 0xD1, 0xFC, 0xB8, 0x63, 0xD5, 0xE1, 0x5A, 0x18,
+    0xC0, 0x86, 0xA2, 0xD9, 0xDF, 0xE9, 0xB4, 0xAC, 0x29, 0x37, 0x63, 0xFE, 0x9C, 0xE3, 0xB8, 0x04,
+    0x54, 0x01, 0x10, 0x72, 0x8D, 0xE6, 0xFC, 0xEB, 0x5F, 0x7A, 0x62, 0xBF, 0xC1, 0x86, 0x1E, 0xAF,
+    0x75, 0x9C, 0xDA, 0x66, 0x5A, 0x32, 0x9F, 0xAA, 0x7E, 0x62, 0xE3, 0x5C, 0xFC, 0xAA, 0x63, 0x0D,
+    0x03, 0x2C, 0x79, 0x62, 0x7F, 0xA7, 0xAB, 0xA5, 0x2D, 0x37, 0x27, 0x3B, 0xA9, 0x10, 0x91, 0x76,
+    0x47, 0x44, 0x50, 0x1D, 0x33, 0x6C, 0x20, 0x51, 0xA3, 0x7D, 0x06, 0xAF, 0xB7, 0x85, 0x24, 0x96,
+    0x78, 0xB4, 0x48, 0x93, 0x93, 0xEE, 0x7D, 0xA0, 0x38, 0x53, 0xA0, 0x51, 0x0D, 0x3D, 0x0E, 0xD3,
+    0x32, 0xA3, 0xF2, 0xFF, 0x26, 0x5A, 0x11, 0x61, 0x95, 0x53, 0x1D, 0xDB, 0x00, 0xB7, 0xC8, 0xE8,
+    0x3E, 0x25, 0x40, 0x9D, 0x80, 0x85, 0xFF, 0x67, 0x8C, 0x5B, 0x3C, 0x33, 0x78, 0x11, 0x12, 0x24,
+    0x90, 0x86, 0x95, 0x1F, 0xF1, 0xE7, 0x5B, 0xA8, 0xE4, 0x02, 0x3A, 0x0D, 0x60, 0xA4, 0xC9, 0xF8,
+    0x69, 0x7E, 0xFA, 0xA7, 0xA6, 0x6C, 0xFF, 0x4D, 0x7F, 0x70, 0xBC, 0x66, 0xAA, 0xA3, 0x6D, 0xA6,
+    0x2A, 0x99, 0x76, 0xAA, 0x7A, 0xDD, 0x1E, 0x33, 0x17, 0x6F, 0xC5, 0xB3, 0xCE, 0xFE, 0x60, 0xC9,
+    0x13, 0x26, 0xEE, 0xF9, 0x5A, 0x5A, 0x25, 0xF1, 0x6C, 0x1C, 0x62, 0x13, 0xB0, 0x4A, 0x60, 0xDF,
+    0x8E, 0x70, 0x64, 0x02, 0xA6, 0xB9, 0x78, 0xC6, 0xD9, 0xA9, 0x95, 0x44, 0x2A, 0x91, 0x56, 0xDF,
+    0x63, 0xCF, 0xD7, 0x9E, 0xDD, 0xA2, 0x83, 0x54, 0x36, 0x18, 0x3F, 0x00, 0x26, 0x02, 0x95, 0x1F,
+    0x53, 0x14, 0x9D, 0xB8, 0x70, 0xFD, 0xAB, 0x81, 0xD5, 0xA6, 0x86, 0xE7, 0xE3, 0x00, 0xE5, 0xB3,
+    0x1D, 0x2C, 0x6D, 0x42, 0x27, 0x17, 0x71, 0x4D, 0xD9, 0x5F, 0x38, 0xA2, 0x12, 0x49, 0x58, 0xB9,
+    0xC7, 0xD9, 0x18, 0x59, 0xF5, 0xDB, 0xA8, 0xF6, 0xA3, 0x04, 0xEE, 0xD5, 0x00, 0x4B, 0xEB, 0xD1,
+    0xCD, 0xBF, 0x3A, 0x5F, 0xE7, 0x88, 0x54, 0x77, 0xC5, 0x17, 0x9D, 0xBB, 0x86, 0xF3, 0x53, 0x58,
+    0x6E, 0x0B, 0x95, 0xAE, 0xA9, 0xA1, 0xD2, 0x09, 0xEA, 0x0D, 0x50, 0x1D, 0x8C, 0x69, 0x5B, 0xE9,
+    0x81, 0x45, 0x33, 0x02, 0x39, 0xB2, 0xD7, 0x51, 0x36, 0xB6, 0xA7, 0xC7, 0x24, 0xD3, 0x62, 0x43,
+    0xD9, 0xB0, 0x4F, 0xFD, 0xD3, 0x17, 0x52, 0x06, 0xFE, 0x2F, 0x7E, 0x78, 0xA2, 0x42, 0xAA, 0xD5,
+    0x60, 0xC3, 0x0C, 0x4A, 0x09, 0x50, 0x0D, 0xE7, 0x92, 0xDC, 0x4F, 0x55, 0x3A, 0x2F, 0x12, 0x28,
+    0x52, 0x09, 0x46, 0x12, 0x58, 0xB9, 0xDF, 0xE2, 0xB1, 0x27, 0x3D, 0xF6, 0x23, 0x69, 0x39, 0xD2,
+    0xFF, 0x37, 0xBA, 0x75, 0x0D, 0x15, 0x13, 0xE8, 0x49, 0xE8, 0xE8, 0x02, 0x36, 0x0C, 0xE0, 0xA4,
+    0x01, 0xFB, 0xDE, 0xE8, 0x43, 0x4D, 0xCB, 0x18, 0x50, 0xAF, 0x7A, 0xA8, 0xDF, 0x59, 0x63, 0x62,
+    0xB1, 0x61, 0x8A, 0x1A, 0x54, 0x47, 0x91, 0x4C, 0xA4, 0x6C, 0xDC, 0xBD, 0x6F, 0x0C, 0x38, 0x91,
+    0x86, 0xE2, 0xF8, 0xE0, 0xE4, 0x69, 0x26, 0x00, 0xB5, 0x07, 0x35, 0x9C, 0xE4, 0x09, 0x9F, 0xBE,
+    0x60, 0x2E, 0x03, 0xBA, 0x03, 0xCA, 0x70, 0x2E, 0x88, 0xD9, 0xBE, 0x1E, 0x95, 0x0D, 0xC5, 0x46,
+    0x3A, 0x2A, 0xFF, 0x01, 0x74, 0x3A, 0x62, 0x83, 0xF3, 0x4C, 0xD9, 0x85, 0x5E, 0x27, 0x8A, 0x54,
+    0x83, 0x96, 0x08, 0xC5, 0xBD, 0x2D, 0x9A, 0xD6, 0x01, 0xA6, 0x07, 0xAA, 0x0D, 0xB8, 0x7F, 0x14,
+    0xAF, 0x7A, 0x56, 0x8D, 0x6B, 0x58, 0x30, 0x87, 0xA5, 0xEA, 0x31, 0x51, 0x6F, 0xAE, 0x0B, 0x5A,
+    0x24, 0xC2, 0xCD, 0xBF, 0x62, 0xCC, 0x3D, 0x77, 0x44, 0x1A, 0x56, 0x22, 0xDE, 0xBD, 0xA7, 0x8E,
+    0x58, 0x43, 0xB2, 0x2D, 0x3A, 0xEC, 0xC3, 0x63, 0x3A, 0x8D, 0x50, 0x09, 0x47, 0x27, 0xB5, 0xF2,
+    0xC0, 0xC3, 0xD7, 0x6B, 0x0A, 0xE9, 0x07, 0xD4, 0xDE, 0x2B, 0x09, 0xE6, 0xAE, 0xA5, 0x48, 0x55,
+    0xC0, 0x85, 0xBA, 0x61, 0xCA, 0x22, 0xFE, 0xEB, 0x8E, 0x95, 0x48, 0xA0, 0x92, 0xF7, 0xC6, 0xD5,
+    0xBE, 0xC0, 0x28, 0xB1, 0xE2, 0xA4, 0x24, 0xB8, 0xBB, 0x95, 0xFF, 0x03, 0x67, 0x32, 0xA6, 0xD9,
+    0x76, 0x89, 0x26, 0xDB, 0xF2, 0xA1, 0x3B, 0x29, 0x1F, 0x1E, 0x9D, 0x03, 0x27, 0x44, 0x1A, 0x56,
+    0xAB, 0x35, 0xB6, 0x9D, 0x78, 0x26, 0xF4, 0x14, 0x49, 0xB7, 0xB8, 0xC6, 0xC1, 0x94, 0x01, 0x96,
+    0x2E, 0x80, 0xF4, 0xC0, 0xB1, 0x1F, 0xEF, 0x39, 0xDF, 0x02, 0xBD, 0x56, 0x1A, 0xF4, 0x7A, 0xD5,
+    0xB2, 0x4F, 0x15, 0x75, 0xA4, 0x0C, 0xA5, 0xA7, 0x62, 0x1F, 0xD5, 0x23, 0x7F, 0xB9, 0x08, 0xB9,
+    0xE6, 0xF3, 0xEF, 0xFE, 0x9F, 0x3C, 0x2E, 0x0F, 0xA3, 0xBA, 0xA0, 0x24, 0x00, 0xC5, 0x07, 0x3D,
+    0x50, 0x74, 0x25, 0x40, 0x52, 0xCD, 0xFD, 0x9E, 0x8E, 0x5A, 0x9A, 0x47, 0x37, 0xDE, 0x4A, 0x93,
+    0x83, 0x4D, 0x2A, 0x70, 0x0D, 0x2E, 0x60, 0x5A, 0x74, 0xA2, 0x48, 0xD0, 0xC3, 0x00, 0x73, 0x98,
+    0x42, 0x75, 0xFD, 0xFA, 0x5E, 0x83, 0x13, 0x91, 0x16, 0xFD, 0xE1, 0xE1, 0x5F, 0x27, 0x54, 0x3F,
+    0x06, 0xF9, 0x4C, 0xA1, 0x22, 0x87, 0x6D, 0xD8, 0x16, 0x1D, 0x29, 0x32, 0x82, 0x36, 0xC0, 0x12,
+    0xA6, 0x14, 0x92, 0xD4, 0xAA, 0x2F, 0x64, 0x40, 0x36, 0x79, 0x3D, 0xD5, 0x3A, 0x0F, 0x54, 0xF5,
+    0x03, 0x45, 0xE7, 0xE0, 0x3B, 0xDB, 0x21, 0x7E, 0x2D, 0x97, 0xC6, 0xD4, 0xCD, 0x30, 0x2E, 0x44,
+    0x3F, 0x4A, 0xBA, 0x1C, 0x17, 0x45, 0xC7, 0x2A, 0xD0, 0x2D, 0x7A, 0x76, 0xF7, 0x17, 0x94, 0xBB,
+    0x2E, 0xD8, 0xA5, 0x8E, 0x7A, 0x4D, 0xC7, 0x86, 0x19, 0x0B, 0x2A, 0x2A, 0xEF, 0x1A, 0x17, 0x74,
+    0xAB, 0xA3, 0x4A, 0xAA, 0x63, 0xF9, 0xAD, 0x25, 0xF5, 0xB2, 0xC2, 0x0D, 0xAE, 0xD1, 0x3D, 0x67,
+    0x42, 0x9D, 0x4A, 0x82, 0x93, 0xB8, 0x23, 0x07, 0x85, 0xC4, 0xED, 0xF8, 0x03, 0x3A, 0xB2, 0x12,
+    0x11, 0x09, 0xB5, 0x88, 0x48, 0x62, 0x0A, 0x75, 0x9E, 0x5E, 0x83, 0xFD, 0xDB, 0xEB, 0xCF, 0x47,
+    0xB4, 0x88, 0x74, 0xB0, 0x39, 0x3C, 0x1C, 0x72, 0xAE, 0x07, 0x55, 0xBE, 0x7C, 0x22, 0xBE, 0x0E,
+    0x7A, 0x58, 0x72, 0x4E, 0xBA, 0xAB, 0x81, 0xBD, 0xCD, 0x28, 0x7C, 0x78, 0x78, 0x04, 0xD8, 0xFE,
+    0x3C, 0x8D, 0x29, 0x4C, 0x0D, 0x5A, 0x04, 0x9E, 0xFF, 0x5B, 0x3F, 0x4E, 0x7D, 0xE7, 0x3B, 0x4C,
+    0xDC, 0x86, 0xD2, 0x49, 0x30, 0xDF, 0x7F, 0x36, 0x16, 0x77, 0x7D, 0x8F, 0xF8, 0x09, 0x75, 0x53,
+    0x52, 0x06, 0x1B, 0x6C, 0xAB, 0xA3, 0x4E, 0x74, 0xF4, 0xCC, 0x98, 0x53, 0x7D, 0xB1, 0xC2, 0xDD,
+    0xB5, 0x41, 0x8B, 0x8E, 0x6C, 0x4E, 0xD5, 0xF6, 0xD8, 0x52, 0xDD, 0x4B, 0xFA, 0x9D, 0x35, 0x4F,
+    0x56, 0xE7, 0x9D, 0xAB, 0xDF, 0x91, 0x03, 0x4C, 0x0B, 0xCB, 0xAC, 0xC5, 0x03, 0xB8, 0x06, 0xD5,
+    0x41, 0x95, 0xF7, 0xD2, 0x34, 0x5B, 0xB2, 0xA3, 0xD3, 0x04, 0xE8, 0xE4, 0x72, 0x25, 0xDE, 0x4A,
+    0x07, 0x1E, 0x17, 0xA3, 0xBC, 0xF3, 0xCA, 0xF7, 0x86, 0xCF, 0xDA, 0x13, 0x5B, 0xF5, 0x68, 0x52,
+    0xD2, 0x52, 0xC2, 0x12, 0x1D, 0x29, 0x3D, 0x4B, 0x74, 0xC2, 0x35, 0xCC, 0x29, 0x12, 0xEE, 0x55,
+    0xA6, 0x4B, 0x25, 0x41, 0xE7, 0xB2, 0xC2, 0x23, 0x87, 0x07, 0x5A, 0x36, 0x3C, 0x72, 0x78, 0xF0,
+    0x49, 0x0F, 0x6E, 0xE7, 0xF0, 0x3B, 0xB5, 0xC4, 0xC3, 0xC3, 0x53, 0x17, 0x47, 0xB9, 0x46, 0x25,
+    0x6C, 0x60, 0x8A, 0xEA, 0xB0, 0x81, 0x1A, 0x7A, 0x4C, 0x4B, 0x05, 0xFD, 0xB7, 0xF4, 0xFB, 0xA1,
+    0x1C, 0xA8, 0x9B, 0xB3, 0xBE, 0x41, 0xA7, 0x12, 0x23, 0x09, 0xBB, 0x39, 0xE7, 0x17, 0x56, 0xE2,
+    0xD5, 0xEA, 0x3D, 0x98, 0x67, 0x45, 0x75, 0x21, 0xDB, 0x80, 0x3E, 0x0F, 0xAA, 0xCA, 0xC6, 0x44,
+    0xC7, 0xEC, 0x23, 0x8F, 0x4E, 0xBF, 0x34, 0xCD, 0x86, 0xD0, 0x06, 0x0A, 0xE9, 0xA8, 0x72, 0x95,
+    0xF0, 0x32, 0x7F, 0xD2, 0x9B, 0x97, 0x65, 0x28, 0xA4, 0xD9, 0x3A, 0xA6, 0xDF, 0x4B, 0x84, 0x40,
+    0x25, 0xED, 0x8E, 0x1C, 0x50, 0x7A, 0x6C, 0x46, 0x12, 0x06, 0x98, 0x72, 0xE6, 0x7D, 0x4F, 0x4E,
+    0xA3, 0xEE, 0x7B, 0x0F, 0xAB, 0x35, 0x2B, 0xF1, 0x38, 0x70, 0x60, 0x3D, 0x3A, 0xC2, 0x2A, 0xE2,
+    0xB6, 0xE5, 0x5D, 0x17, 0x4C, 0x2A, 0x06, 0x9E, 0x38, 0x59, 0xDB, 0x72, 0x4D, 0x89, 0x0D, 0x3A,
+    0xAA, 0x8E, 0x25, 0x35, 0xAE, 0x31, 0x6D, 0x91, 0xE8, 0xBF, 0x35, 0x5D, 0x96, 0x83, 0x1E, 0xD8,
+    0x65, 0x97, 0xC7, 0xB1, 0x4D, 0xB1, 0x69, 0xEA, 0x70, 0x12, 0x32, 0x42, 0xD9, 0x62, 0xD3, 0x98,
+    0x68, 0x9E, 0x4A, 0xF1, 0xD1, 0x8D, 0x1F, 0x07, 0xE2, 0xEE, 0x1B, 0x98, 0x0B, 0xE8, 0x48, 0xCE,
+    0x7C, 0xCF, 0xBF, 0x5F, 0x52, 0x48, 0x57, 0xC8, 0x1A, 0x78, 0x34, 0x2D, 0x3A, 0x95, 0x8A, 0xA4,
+    0xA3, 0x69, 0x6D, 0x70, 0xC1, 0x35, 0xA5, 0xAF, 0x98, 0x7E, 0x71, 0xBA, 0x5C, 0xA4, 0x33, 0x0B,
+    0xB9, 0x92, 0x67, 0x64, 0x60, 0xEF, 0x9E, 0x5A, 0xBD, 0x87, 0x69, 0x47, 0xB1, 0xE4, 0x7B, 0xD6,
+    0x27, 0xBF, 0x9B, 0x51, 0x62, 0xF9, 0xF1, 0x4B, 0xA8, 0xB7, 0x62, 0x1C, 0x60, 0x8E, 0xEA, 0xE1,
+    0x68, 0xFB, 0xFC, 0x04, 0xC3, 0x38, 0xDC, 0x3C, 0x28, 0x13, 0x29, 0x12, 0xB6, 0xA5, 0x12, 0xEF,
+    0x02, 0x2B, 0xF1, 0xAE, 0x61, 0x1B, 0x23, 0x51, 0x03, 0x45, 0xBB, 0x06, 0xB4, 0xF4, 0x40, 0x91,
+    0x17, 0xFE, 0x24, 0xB9, 0xD1, 0x89, 0x25, 0x0B, 0xCA, 0xD6, 0x26, 0x35, 0xF0, 0xC4, 0x69, 0x85,
+    0x61, 0x2B, 0xF4, 0x9D, 0xB5, 0x11, 0x2F, 0xAD, 0x4A, 0x4C, 0xA8, 0x30, 0x41, 0x47, 0x96, 0xCC,
+    0x73, 0x46, 0xDC, 0x33, 0x8C, 0x4C, 0x2F, 0xD5, 0x51, 0x51, 0xA1, 0xA3, 0xFE, 0x49, 0x98, 0x30,
+    0x5D, 0x9A, 0x60, 0x84, 0x25, 0x75, 0xE3, 0x9A, 0xD1, 0x01, 0x57, 0xA3, 0x53, 0x6B, 0x96, 0x50,
+    0x09, 0x14, 0x12, 0xC0, 0x1E, 0x9C, 0xD4, 0x1F, 0xD4, 0x00, 0x94, 0x03, 0xA8, 0x0F, 0x7A, 0xA8,
+    0x9E, 0x4E, 0xF7, 0x3B, 0x90, 0x95, 0x78, 0xD4, 0xAA, 0x1B, 0xA1, 0x98, 0xFB, 0x58, 0x5F, 0xC3,
+    0x7D, 0x39, 0xC8, 0x59, 0xFA, 0xDA, 0xFD, 0x39, 0xC8, 0xF9, 0x10, 0xFE, 0xEC, 0x7F, 0xAE, 0xC0,
+    0x3C, 0xD3, 0x41, 0x25, 0x0D, 0x2C, 0x3A, 0xB2, 0xB5, 0x3C, 0xA9, 0x76, 0x02, 0x55, 0xCA, 0x75,
+    0xCC, 0xD2, 0x35, 0x38, 0x9F, 0xB0, 0xFE, 0x89, 0xD3, 0x2F, 0xFC, 0xBB, 0x94, 0x67, 0x40, 0x35,
+    0x7A, 0x67, 0x1D, 0x47, 0x7C, 0x63, 0xB6, 0xFD, 0xB0, 0x19, 0x31, 0x91, 0x33, 0xC6, 0x17, 0x37,
+    0x7A, 0x61, 0x9D, 0xC6, 0x6F, 0x2F, 0xE1, 0x9B, 0x93, 0x1C, 0xF2, 0xBA, 0x0D, 0xA8, 0xFF, 0x72,
+    0xA6, 0x6C, 0x36, 0x94, 0x12, 0x76, 0xE4, 0xA0, 0xEC, 0x51, 0x1D, 0xFB, 0x60, 0x83, 0x8D, 0x50,
+    0x73, 0x04, 0x0C, 0xAE, 0x05, 0x1D, 0x07, 0xA0, 0xFC, 0x6A, 0x00, 0x8E, 0x7A, 0x40, 0x4B, 0x00,
+    0xDC, 0x4D, 0x0F, 0xCC, 0x6B, 0xA0, 0xE8, 0x8E, 0x01, 0x1B, 0xD6, 0x40, 0xAD, 0xD6, 0x40, 0x5F,
+    0x0C, 0x60, 0x5A, 0x3D, 0x40, 0x85, 0x5E, 0x63, 0x25, 0xEA, 0x0D, 0x2B, 0x09, 0x7A, 0xB3, 0xAD,
+    0x3A, 0x66, 0x0B, 0x54, 0x86, 0x13, 0x14, 0x9E, 0xFE, 0x24, 0x68, 0x64, 0x76, 0x1A, 0x0D, 0x3C,
+    0x04, 0xAB, 0xC8, 0xC5, 0xE3, 0x2C, 0xDF, 0x11, 0xC1, 0xEA, 0xC1, 0x79, 0x54, 0x5A, 0x35, 0x57,
+    0xEB, 0xB5, 0xBE, 0xFB, 0x6C, 0x5B, 0x87, 0x89, 0x49, 0x36, 0x2C, 0x55, 0x67, 0x5F, 0x5A, 0x23,
+    0x1B, 0xDC, 0x06, 0xF5, 0xCB, 0x44, 0xE5, 0x1A, 0x1D, 0x8F, 0x99, 0xE8, 0xC1, 0xB4, 0x6E, 0xB3,
+    0xA4, 0x6E, 0xE1, 0x12, 0x0F, 0xE5, 0xE0, 0x72, 0x44, 0xC5, 0x6E, 0xC3, 0xE3, 0xA7, 0x16, 0x71,
+    0xD5, 0x54, 0xAF, 0x6D, 0xB4, 0xD0, 0xD7, 0xB7, 0xF5, 0x8F, 0x22, 0xEE, 0x0A, 0xCC, 0x5B, 0x0A,
+    0xC9, 0x35, 0xEB, 0x69, 0x8F, 0xFA, 0x20, 0x61, 0xEE, 0x44, 0x2A, 0x1B, 0xBE, 0xD9, 0xBB, 0x77,
+    0x5E, 0x69, 0xCB, 0xA1, 0x3C, 0x65, 0x97, 0xF8, 0x0C, 0x04, 0xAA, 0x4D, 0xF6, 0xFF, 0xFA, 0x1E,
+    0x70, 0x9F, 0x3B, 0xE0, 0xD1, 0x8D, 0xCF, 0x11, 0xD2, 0xC9, 0xB2, 0x6E, 0x03, 0x84, 0xF9, 0x7D,
+    0x6B, 0xAD, 0xBA, 0x31, 0x18, 0x1B, 0x3F, 0x7C, 0x52, 0x47, 0xAE, 0xA8, 0x0E, 0xC7, 0x11, 0x2F,
+    0xBC, 0x29, 0x22, 0x3F, 0xCC, 0xC8, 0x09, 0x3C, 0x8E, 0x4B, 0x76, 0x63, 0x36, 0xFE, 0xA1, 0x2C,
+    0x3A, 0xB7, 0x56, 0x37, 0x5B, 0x96, 0xB8, 0x40, 0x8F, 0xF3, 0x19, 0xAE, 0x89, 0x4C, 0x30, 0x61,
+    0xFB, 0x69, 0xE9, 0x8B, 0x44, 0x8D, 0x8E, 0x4C, 0x9E, 0x30, 0x77, 0xFD, 0x2A, 0x9A, 0x53, 0x83,
+    0x56, 0x49, 0xCB, 0x8E, 0x1C, 0x64, 0xF5, 0xB7, 0xDB, 0x21, 0x0E, 0xE3, 0x5E, 0x39, 0xF7, 0xE1,
+    0xC9, 0xB8, 0x4F, 0x3F, 0xFC, 0x2C, 0x3D, 0xD6, 0xCF, 0xD1, 0xA1, 0xF2, 0xFF, 0x26, 0xAD, 0x44,
+    0xBA, 0xD5, 0x49, 0xF1, 0xF1, 0xA1, 0x6D, 0x45, 0xF0, 0x8C, 0x72, 0x32, 0xDB, 0x5A, 0x90, 0x3F,
+    0x60, 0xE0, 0xCA, 0x33, 0x60, 0x03, 0x4B, 0x1C, 0xBA, 0x1D, 0xA3, 0x23, 0x35, 0x92, 0xFF, 0x30,
+    0xC1, 0x4A, 0xB7, 0x64, 0xEF, 0x9E, 0xF5, 0xCC, 0x49, 0xD8, 0xF0, 0x59, 0x18, 0xF0, 0x39, 0xE8,
+    0xED, 0x39, 0x2D, 0xE5, 0x53, 0x6F, 0x77, 0xEF, 0x7C, 0x0B, 0x5D, 0x2D, 0x47, 0xE9, 0xD3, 0x63,
+    0x7D, 0xE9, 0x49, 0x45, 0xA7, 0x16, 0x85, 0x88, 0xB4, 0xE3, 0xBC, 0x2E, 0x82, 0x6E, 0x95, 0x4F,
+    0x75, 0x37, 0x7B, 0x64, 0x7D, 0x85, 0xCA, 0xE1, 0xEE, 0xF8, 0xF3, 0xA8, 0x78, 0x83, 0x6E, 0x51,
+    0x69, 0x6B, 0x8D, 0x5D, 0x83, 0x69, 0x47, 0xE3, 0xCB, 0x14, 0xDC, 0x7F, 0xC0, 0xDC, 0xF5, 0x85,
+    0x34, 0x67, 0xD1, 0x09, 0xAC, 0x74, 0xB0, 0x77, 0x6F, 0x3B, 0x96, 0x30, 0xAE, 0xC1, 0x38, 0xE6,
+    0x27, 0x28, 0xBD, 0x6B, 0x8B, 0x54, 0x0C, 0xD4, 0x54, 0xCD, 0xEF, 0x37, 0xE6, 0x87, 0x70, 0x6B,
+    0x1E, 0x59, 0x6F, 0x71, 0xEE, 0x1E, 0x3A, 0x54, 0xA2, 0x48, 0xE8, 0x88, 0x6E, 0x1F, 0x32, 0x61,
+    0x6D, 0xC3, 0xDA, 0x85, 0xDE, 0x35, 0x94, 0x9E, 0x0A, 0xEA, 0x0C, 0x8E, 0x3F, 0xC1, 0x7E, 0xC7,
+    0x2A, 0x9E, 0x1D, 0xE7, 0x6F, 0xD1, 0x96, 0x07, 0x32, 0x7F, 0x29, 0xA7, 0x01, 0x60, 0x07, 0xA8,
+    0xD6, 0x70, 0x71, 0xEF, 0xBF, 0xAD, 0x2D, 0xCA, 0x6B, 0xF1, 0x8F, 0xAC, 0x29, 0x12, 0x2E, 0x30,
+    0x85, 0x0E, 0x13, 0xA8, 0xE0, 0xC3, 0x56, 0x6F, 0x28, 0xDB, 0x62, 0x60, 0x91, 0xF4, 0x8F, 0xB7,
+    0x81, 0x44, 0xFE, 0xCA, 0x77, 0xCC, 0x5D, 0x5F, 0xF5, 0xA7, 0x83, 0xCB, 0xA1, 0x63, 0xAE, 0x80,
+    0x2E, 0x1A, 0xC6, 0x58, 0x15, 0x32, 0xBA, 0xFA, 0xA5, 0x8F, 0x61, 0x67, 0x2D, 0xB5, 0x60, 0x7B,
+    0xEC, 0x1A, 0x56, 0xB0, 0x0B, 0x55, 0xA4, 0x04, 0x37, 0x60, 0x03, 0xFA, 0xAE, 0xD7, 0x11, 0xF5,
+    0xAB, 0x44, 0x07, 0xCB, 0x23, 0x76, 0x61, 0xEA, 0x42, 0x09, 0xEE, 0x99, 0xCE, 0x06, 0x74, 0x98,
+    0xEA, 0x88, 0x4A, 0x36, 0x74, 0xB0, 0x54, 0xFD, 0x2E, 0x4C, 0xA9, 0x4B, 0x70, 0xDE, 0xBC, 0xDF,
+    0xA0, 0x03, 0x99, 0xE7, 0x56, 0x66, 0x5E, 0xED, 0x80, 0x5A, 0x45, 0x56, 0x28, 0x19, 0xB2, 0x63,
+    0x39, 0xA5, 0xB7, 0xA1, 0xDB, 0x2C, 0x9F, 0x6A, 0x34, 0x15, 0x1D, 0xE7, 0x8A, 0x28, 0xB1, 0x8C,
+    0xAB, 0xB4, 0xEA, 0xF4, 0xDF, 0xFD, 0x63, 0xA7, 0xDF, 0x79, 0xA9, 0xD3, 0x3F, 0x57, 0xC9, 0x0C,
+    0x45, 0xB2, 0x49, 0x47, 0x17, 0x75, 0xEB, 0x82, 0x09, 0x65, 0x63, 0x43, 0x89, 0x6B, 0x2A, 0xDC,
+    0x7F, 0x98, 0x52, 0x1E, 0x4F, 0x28, 0xFB, 0x19, 0xE5, 0xD9, 0x34, 0xBC, 0xEA, 0x70, 0x12, 0x8A,
+    0x0D, 0x85, 0x78, 0xAA, 0x80, 0x03, 0xDB, 0x63, 0x02, 0x5A, 0x28, 0x12, 0x7C, 0xD4, 0xD2, 0xC3,
+    0x6C, 0x60, 0x02, 0x55, 0xE5, 0x1D, 0xB8, 0x57, 0x92, 0x09, 0xE8, 0xF6, 0xA8, 0x48, 0x90, 0x5C,
+    0xD3, 0xC3, 0xAC, 0x48, 0x13, 0xA8, 0xD8, 0x77, 0xE0, 0x1A, 0xF7, 0x56, 0x40, 0xB7, 0xEA, 0xC3,
+    0x08, 0x89, 0xBA, 0x87, 0x19, 0x66, 0x0D, 0x15, 0x08, 0xEC, 0xF5, 0x54, 0x81, 0x85, 0x8C, 0x40,
+    0xFD, 0x99, 0x9C, 0x8F, 0x81, 0x53, 0x47, 0x90, 0x65, 0x91, 0x3D, 0x41, 0xFE, 0x7D, 0x1A, 0xAE,
+    0xFE, 0xC1, 0x33, 0xBF, 0xB0, 0x75, 0xBC, 0xE3, 0xCF, 0xEE, 0x59, 0xE1, 0x5E, 0xE4, 0x71, 0x40,
+    0xC7, 0xCA, 0x03, 0x47, 0x95, 0x07, 0xDC, 0x5D, 0x18, 0xA1, 0xD6, 0x11, 0x43, 0xFC, 0xEF, 0x4F,
+    0x5F, 0x2E, 0xF1, 0x39, 0x3A, 0x9C, 0x6E, 0xB1, 0xAF, 0x67, 0x6E, 0x4D, 0x31, 0xC0, 0x19, 0x3E,
+    0xFD, 0x1F, 0x2A, 0x35, 0xE5, 0xB7, 0x28, 0x0A, 0x6B, 0xB6, 0xA8, 0x8C, 0x0B, 0x5B, 0x58, 0xA1,
+    0x48, 0x00, 0xA9, 0x8A, 0x65, 0xEA, 0xAA, 0xA1, 0x5A, 0xC3, 0xD5, 0x6A, 0xCF, 0xE3, 0xFE, 0x46,
+    0xB7, 0xE8, 0x9F, 0xAB, 0x84, 0x12, 0x96, 0xB0, 0x60, 0x0A, 0x55, 0xE3, 0x3C, 0x2E, 0x98, 0x80,
+    0x8E, 0x39, 0xBF, 0xEE, 0x61, 0xC9, 0xE4, 0x32, 0x53, 0xCA, 0x63, 0x9C, 0x37, 0x1B, 0x4C, 0xE0,
+    0x3C, 0xC7, 0xF7, 0x13, 0x55, 0xD4, 0xA9, 0x03, 0xD7, 0xD8, 0xDF, 0xAA, 0xA8, 0x1D, 0x65, 0xC3,
+    0x42, 0xB6, 0xA8, 0x55, 0x1A, 0x29, 0xDB, 0x40, 0x9C, 0x41, 0xE6, 0x56, 0x8C, 0x2C, 0xB6, 0x53,
+    0x04, 0x6E, 0xD5, 0x2C, 0x5E, 0x13, 0x2B, 0xBE, 0x3F, 0x3A, 0xD2, 0xEF, 0xBC, 0xD4, 0xB9, 0xDB,
+    0x26, 0x2C, 0x42, 0x55, 0x0C, 0xF4, 0x2E, 0xEA, 0xB6, 0xA6, 0x54, 0x3D, 0x4B, 0x13, 0x74, 0xAC,
+    0x70, 0xBE, 0x67, 0xA6, 0xDB, 0x22, 0x95, 0xB8, 0x06, 0x66, 0x63, 0x5A, 0xE5, 0x69, 0x96, 0x58,
+    0x09, 0x54, 0x03, 0x5C, 0xF5, 0x00, 0x87, 0x87, 0xE4, 0x7A, 0x0C, 0xA7, 0xE9, 0xDF, 0xA7, 0x4F,
+    0x31, 0xBC, 0x78, 0x78, 0xC0, 0x42, 0xC2, 0x7D, 0x63, 0x50, 0xD2, 0x52, 0x4B, 0xAB, 0xBB, 0x32,
+    0xD4, 0x54, 0x4F, 0x77, 0xEC, 0xBB, 0x40, 0x3F, 0xC7, 0xFC, 0x30, 0x51, 0x7E, 0x25, 0xB0, 0xAC,
+    0xD1, 0x71, 0xA0, 0x7A, 0xA6, 0x53, 0xBD, 0x49, 0x65, 0x70, 0x32, 0x60, 0xC5, 0x73, 0x86, 0xA8,
+    0x91, 0x54, 0x03, 0xBD, 0xF5, 0x20, 0x9B, 0x2D, 0x6F, 0xE0, 0x74, 0xB7, 0x7F, 0xCA, 0x34, 0x4A,
+    0x78, 0x8A, 0x03, 0xD5, 0x39, 0xB4, 0x74, 0x18, 0xF1, 0x67, 0xD3, 0xE4, 0x3F, 0x84, 0x8F, 0x35,
+    0xBE, 0x9E, 0x54, 0x01, 0x16, 0x45, 0x07, 0xAB, 0x57, 0xD6, 0x20, 0xCF, 0x0D, 0xB0, 0xD1, 0x1D,
+    0x7C, 0x89, 0xF6, 0xEC, 0x8C, 0x59, 0x49, 0x83, 0x12, 0x19, 0x28, 0xD6, 0xD4, 0xA1, 0xE8, 0xD1,
+    0x9D, 0xEA, 0x61, 0x91, 0x2B, 0xB7, 0x47, 0xA0, 0x53, 0x0D, 0x0C, 0x65, 0x03, 0xB5, 0x6D, 0xC1,
+    0xBD, 0xD9, 0x91, 0xEB, 0x0F, 0xAA, 0xAF, 0x81, 0x23, 0xD7, 0x42, 0x5D, 0x74, 0x50, 0xF9, 0x05,
+    0x94, 0x8D, 0x6B, 0x29, 0x83, 0xDA, 0xB0, 0x08, 0x94, 0x22, 0xCD, 0x38, 0xED, 0x33, 0xD8, 0x71,
+    0xBA, 0x42, 0xD1, 0xED, 0x63, 0xD2, 0x80, 0xBB, 0x93, 0xA8, 0x4C, 0xE0, 0x89, 0x9D, 0x73, 0x6C,
+    0x34, 0x44, 0xBC, 0xEE, 0xCA, 0xE0, 0x82, 0x6D, 0x4B, 0x6F, 0x62, 0x8D, 0x8E, 0x73, 0x4C, 0xBB,
+    0xC4, 0xB4, 0x4B, 0x6C, 0x18, 0x70, 0xCD, 0x40, 0xE5, 0x8F, 0xD8, 0x67, 0xA1, 0x06, 0x6A, 0x49,
+    0x58, 0xF1, 0x5B, 0xB7, 0xA5, 0x18, 0x83, 0x92, 0x32, 0x41, 0x21, 0x1E, 0xEA, 0xF6, 0x6C, 0x6C,
+    0xFC, 0xF0, 0x35, 0x58, 0x48, 0x8F, 0x96, 0xF7, 0x07, 0x98, 0x17, 0x03, 0x45, 0xD2, 0x29, 0xA7,
+    0x85, 0x53, 0x2A, 0x54, 0xC7, 0x80, 0x09, 0xB6, 0xA5, 0xE2, 0x18, 0xD6, 0x7B, 0x31, 0x27, 0xA0,
+    0xE5, 0xCD, 0x00, 0xCB, 0xD2, 0x67, 0xA0, 0xD6, 0x85, 0x7D, 0x98, 0xB2, 0x46, 0x75, 0x6A, 0xC0,
+    0x86, 0x62, 0x28, 0xA4, 0x2B, 0xD6, 0x95, 0x44, 0xB5, 0x39, 0x8D, 0x08, 0x4C, 0x20, 0x57, 0x5E,
+    0x8B, 0x84, 0x3A, 0x43, 0xD6, 0xB0, 0x7D, 0xF9, 0x9A, 0x94, 0xC9, 0xBE, 0xDE, 0xEB, 0x77, 0x3C,
+    0x1F, 0x35, 0xD4, 0x81, 0x32, 0x60, 0xE3, 0x7D, 0xE9, 0x7C, 0xB3, 0x4D, 0xDF, 0xE1, 0xBA, 0x47,
+    0x89, 0x44, 0x9C, 0xDC, 0x4C, 0xA8, 0xCE, 0xA6, 0xDC, 0x69, 0x54, 0x53, 0x41, 0xCF, 0x12, 0xD3,
+    0xEA, 0x44, 0x49, 0xE5, 0x59, 0x16, 0x3D, 0xFA, 0x83, 0x55, 0x83, 0x93, 0x08, 0xFB, 0x2B, 0x28,
+    0xD2, 0x9C, 0x8C, 0xB9, 0xD7, 0xAA, 0x87, 0x5E, 0x77, 0x98, 0xD6, 0x24, 0x2A, 0x6C, 0xB2, 0xD2,
+    0xDA, 0x6E, 0x25, 0x8D, 0xE9, 0xCF, 0x50, 0x7B, 0x16, 0xE7, 0x33, 0xD3, 0x2D, 0x6E, 0x7B, 0xE1,
+    0xC4, 0xCA, 0xEF, 0x5B, 0x29, 0x53, 0xF1, 0xEE, 0x86, 0xC9, 0x2D, 0xF4, 0xCF, 0xA1, 0x0E, 0x98,
+    0x04, 0xC7, 0xD9, 0x58, 0xF7, 0x50, 0x66, 0x48, 0x6E, 0x9A, 0x6F, 0x31, 0xDF, 0xBA, 0x8F, 0xB3,
+    0xB8, 0x54, 0x6E, 0xD7, 0xB9, 0x00, 0xA0, 0x82, 0x6E, 0x70, 0xCD, 0x3E, 0x94, 0xCF, 0xB5, 0x23,
+    0x19, 0xA0, 0x6E, 0xCF, 0xC2, 0xE8, 0x9F, 0xD6, 0xAA, 0x5D, 0x52, 0xDE, 0xFA, 0x25, 0xB7, 0x2B,
+    0xF4, 0xDB, 0x81, 0xAA, 0x83, 0x35, 0xEC, 0x6C, 0x77, 0x67, 0xB1, 0x31, 0x71, 0xF5, 0x0B, 0xE1,
+    0x6A, 0x1D, 0xF5, 0x3B, 0x9E, 0x69, 0x44, 0x0F, 0xB0, 0x00, 0x1B, 0xEF, 0x87, 0xDB, 0xE2, 0x09,
+    0xDC, 0x96, 0x27, 0xAE, 0x5B, 0x58, 0x79, 0xCA, 0x1E, 0xB5, 0x39, 0x95, 0xE4, 0xC3, 0x50, 0x4A,
+    0x2C, 0x36, 0xAB, 0x58, 0x79, 0xE7, 0x7B, 0x76, 0x4D, 0x24, 0x95, 0x4D, 0xC1, 0x62, 0x24, 0x8A,
+    0x49, 0x93, 0x0B, 0xF2, 0xAB, 0x98, 0x25, 0x52, 0x85, 0x03, 0x6A, 0xD3, 0xB0, 0xAC, 0x28, 0xD2,
+    0x12, 0xF7, 0x72, 0xAF, 0x06, 0x23, 0xD2, 0x16, 0xD2, 0x8F, 0x99, 0xCD, 0xEF, 0xC0, 0x11, 0x7A,
+    0x29, 0x99, 0x80, 0xEA, 0xA0, 0xF6, 0xD8, 0x1E, 0x56, 0x01, 0xD3, 0x43, 0x0D, 0x36, 0xBC, 0xA8,
+    0x52, 0xD5, 0xF4, 0x46, 0x06, 0x16, 0x5B, 0x3A, 0xCD, 0x85, 0xCC, 0xB0, 0x72, 0x6B, 0x18, 0x06,
+    0x5C, 0xB8, 0xCD, 0xED, 0xD1, 0x8E, 0xFC, 0x0B, 0x0C, 0xFF, 0x77, 0x60, 0x03, 0xFD, 0x9E, 0xC3,
+    0xFF, 0x1A, 0x2C, 0xA4, 0xB1, 0x1F, 0x4A, 0x73, 0xC4, 0x44, 0x47, 0x52, 0xD9, 0xE8, 0xB0, 0xCF,
+    0x83, 0x6A, 0xC8, 0x8C, 0x13, 0xBD, 0x01, 0x2D, 0x9E, 0x42, 0x9A, 0x3C, 0xE8, 0x55, 0xE1, 0x19,
+    0x1E, 0xA7, 0x48, 0x4B, 0xEC, 0x9B, 0x89, 0xA9, 0x8D, 0x26, 0x95, 0x22, 0xDE, 0x4A, 0x84, 0x6B,
+    0xA0, 0x9A, 0x4C, 0x0A, 0x2B, 0x3D, 0xEC, 0xE6, 0xA5, 0x3E, 0x3A, 0x35, 0xED, 0x99, 0xE5, 0x13,
+    0x67, 0x26, 0x63, 0xDB, 0x1D, 0xC5, 0x06, 0x56, 0x81, 0x32, 0x66, 0x43, 0xF0, 0xA2, 0x4A, 0xC7,
+    0x3A, 0x2E, 0x24, 0x94, 0x6B, 0xF0, 0xA8, 0x03, 0x4C, 0x46, 0xBE, 0x7B, 0x8A, 0x44, 0xD9, 0xF0,
+    0x19, 0xE0, 0x33, 0x5C, 0xA1, 0x24, 0x9B, 0x48, 0x23, 0x0D, 0xC5, 0xE6, 0x0C, 0xEF, 0xE7, 0x6B,
+    0x50, 0x4A, 0x64, 0x75, 0xB3, 0x2F, 0x3A, 0x3A, 0x1D, 0x49, 0x26, 0xFF, 0x34, 0x26, 0x8D, 0x24,
+    0x1A, 0x69, 0xA0, 0xEE, 0xC0, 0x6E, 0xC6, 0x85, 0xA8, 0xC2, 0x97, 0x70, 0xE1, 0x06, 0x36, 0x2C,
+    0xB1, 0x61, 0x89, 0x6B, 0x8E, 0x59, 0x8C, 0x4D, 0x5A, 0x71, 0x2B, 0xFA, 0xDF, 0x85, 0xEB, 0x33,
+    0x35, 0xC1, 0x04, 0x98, 0xE7, 0x30, 0xAD, 0x8A, 0xB0, 0x0A, 0x19, 0x85, 0x48, 0x50, 0xF1, 0xA2,
+    0x4A, 0x36, 0x4E, 0x59, 0x48, 0x50, 0x27, 0x5C, 0x9F, 0xDC, 0xCD, 0x31, 0xD4, 0x22, 0xF2, 0x56,
+    0xA8, 0x98, 0xDD, 0xD0, 0xC9, 0xBC, 0xE6, 0xA7, 0xBC, 0xF8, 0x2D, 0xD3, 0xEE, 0x64, 0xD8, 0xC1,
+    0x9D, 0x64, 0x9C, 0xE7, 0x50, 0xB7, 0x8F, 0x67, 0xC9, 0xE3, 0xF7, 0xD4, 0x6A, 0x0D, 0xF5, 0xB6,
+    0x61, 0x44, 0x1D, 0x8C, 0x49, 0x97, 0xDA, 0xDE, 0xA2, 0x48, 0x63, 0x0D, 0xF7, 0x0B, 0x5B, 0x4A,
+    0xCF, 0xD5, 0x91, 0x6E, 0xB5, 0x23, 0xEB, 0x5A, 0x86, 0x8F, 0xA5, 0xA1, 0x98, 0x16, 0x13, 0xB0,
+    0xE1, 0x92, 0x6B, 0x6E, 0xB9, 0xB7, 0x93, 0x93, 0x60, 0xF2, 0xFA, 0x34, 0xB8, 0x34, 0x6E, 0x24,
+    0xDD, 0x52, 0x79, 0x1E, 0x02, 0x2E, 0xF2, 0x18, 0x74, 0xB6, 0xC5, 0xBE, 0x99, 0xA0, 0x1E, 0x40,
+    0xC9, 0x49, 0x12, 0xB1, 0x6D, 0x31, 0x10, 0xB9, 0x23, 0x22, 0xC3, 0xAC, 0x48, 0xE6, 0xAD, 0xA6,
+    0xE6, 0xC6, 0x2D, 0x1D, 0xCD, 0x73, 0xCC, 0xF9, 0x66, 0x4E, 0x9C, 0xCF, 0x24, 0xD8, 0xF7, 0x83,
+    0x02, 0x1F, 0xA3, 0x6D, 0xB9, 0x00, 0x8F, 0x4A, 0x8B, 0x96, 0x6D, 0xFB, 0x47, 0x11, 0xA0, 0x83,
+    0x5D, 0x78, 0x9C, 0xE2, 0x35, 0x8A, 0x77, 0x9B, 0x8C, 0x01, 0xA8, 0x95, 0x3C, 0x2B, 0x12, 0x7E,
+    0x1D, 0x26, 0xB0, 0x7D, 0xEF, 0x5D, 0x73, 0x4B, 0x7F, 0x30, 0x20, 0x03, 0x65, 0xF7, 0xBB, 0xAD,
+    0xD1, 0xF2, 0xCC, 0x1A, 0xE9, 0x4C, 0xB9, 0x69, 0x7F, 0x8F, 0x35, 0xFA, 0xAD, 0xF2, 0x5F, 0x49,
+    0x7A, 0xFE, 0xA7, 0xD7, 0x7E, 0x93, 0xFC, 0xB7, 0x68, 0x6F, 0xF7, 0x24, 0xB9, 0x0D, 0x86, 0xB2,
+    0x4E, 0x1F, 0xEF, 0x83, 0x19, 0x45, 0xDE, 0x38, 0x79, 0x53, 0x22, 0xAB, 0x98, 0xBB, 0x17, 0xA6,
+    0x50, 0x8E, 0x30, 0xF3, 0x1C, 0xA6, 0xD8, 0x80, 0x6E, 0x19, 0x60, 0x86, 0x6B, 0x30, 0x41, 0x75,
+    0x70, 0x3B, 0xD7, 0xA2, 0x8A, 0x04, 0x1D, 0x35, 0x94, 0xA3, 0xBF, 0xAE, 0x61, 0x8A, 0x4E, 0x98,
+    0x90, 0x3B, 0x57, 0x8A, 0x8D, 0x3A, 0x26, 0x17, 0x9F, 0xA9, 0xE4, 0xE0, 0xD4, 0x1D, 0x7A, 0x30,
+    0xE9, 0x49, 0xDC, 0xBA, 0xE3, 0x6A, 0x9D, 0xF8, 0xE2, 0xB9, 0x8C, 0x89, 0x2A, 0x31, 0x5B, 0x25,
+    0xFA, 0x22, 0xA9, 0x4E, 0x27, 0x95, 0x74, 0x2C, 0x92, 0x6E, 0x75, 0xB4, 0x41, 0xB7, 0x2E, 0xD8,
+    0xE0, 0xBC, 0x0B, 0x25, 0x55, 0x53, 0xB1, 0x68, 0x2A, 0xF5, 0xFE, 0x73, 0xF5, 0x57, 0xBE, 0xFF,
+    0x37, 0x95, 0xB8, 0xC1, 0xF5, 0x36, 0x72, 0x1A, 0x98, 0x3B, 0xE9, 0xF8, 0x58, 0x64, 0xFE, 0xC7,
+    0x9B, 0xF4, 0xC5, 0xC3, 0x03, 0xCA, 0x8F, 0x93, 0xAA, 0xFF, 0xF0, 0xC9, 0xE6, 0xBC, 0x9C, 0xCF,
+    0x33, 0x06, 0xEB, 0x4E, 0xE2, 0x09, 0xCB, 0xF7, 0xA1, 0xFF, 0x0E, 0x16, 0x7B, 0x1C, 0x9D, 0xF3,
+    0xB7, 0x70, 0x12, 0x33, 0xB5, 0xFA, 0xA1, 0x4F, 0x70, 0xFE, 0x99, 0x38, 0x2E, 0x0D, 0x30, 0x99,
+    0x00, 0xE6, 0xA5, 0x08, 0xDC, 0x78, 0x0C, 0xD0, 0x6F, 0x07, 0xA0, 0xEC, 0xCE, 0x8A, 0x42, 0x4B,
+    0x8F, 0x0C, 0xD5, 0x06, 0xBB, 0x19, 0xA7, 0x13, 0x51, 0x89, 0x7D, 0xA8, 0x30, 0x2D, 0x3A, 0xB2,
+    0x84, 0x09, 0x2E, 0x60, 0x02, 0x3D, 0xCC, 0x28, 0x3D, 0xB6, 0xC9, 0xE5, 0xD6, 0x0A, 0x9C, 0xCF,
+    0xB2, 0xAB, 0xA1, 0x42, 0x27, 0x74, 0xA4, 0x86, 0x19, 0xBA, 0xA3, 0x6C, 0xA8, 0xE2, 0xA3, 0x91,
+    0x5C, 0x38, 0x2F, 0x32, 0x47, 0xF2, 0xDA, 0xD6, 0x41, 0x17, 0x12, 0xD0, 0x77, 0x5A, 0xCC, 0x33,
+    0x2D, 0xF6, 0x99, 0x80, 0x79, 0x27, 0x50, 0xC8, 0xC9, 0xC8, 0x3E, 0x21, 0x45, 0xE0, 0xB3, 0x7C,
+    0x0B, 0x4C, 0xAA, 0x3C, 0xC5, 0xC6, 0x75, 0x20, 0xCF, 0x0E, 0x50, 0x37, 0x6B, 0x28, 0xFC, 0x67,
+    0xCF, 0x35, 0x93, 0xFE, 0x51, 0x04, 0x01, 0x70, 0xEB, 0x31, 0x54, 0x5F, 0xA3, 0xD3, 0x80, 0x7B,
+    0xB3, 0xA3, 0x32, 0x2D, 0x9F, 0xD7, 0x9F, 0xEC, 0x8E, 0xF8, 0xC4, 0x27, 0xD7, 0x9E, 0x4E, 0xCE,
+    0x9F, 0x9F, 0xDC, 0xC0, 0x68, 0xC5, 0x71, 0x7E, 0x1B, 0xF6, 0xE7, 0x5A, 0x53, 0xE6, 0x49, 0xD8,
+    0xEE, 0x13, 0xDA, 0xEF, 0x09, 0xAF, 0x03, 0x38, 0xE0, 0xF1, 0x11, 0x38, 0xAD, 0xDE, 0xE3, 0xB4,
+    0x86, 0xBA, 0x95, 0x70, 0x9D, 0x85, 0xE0, 0xB2, 0xB9, 0xD7, 0xBF, 0xCA, 0xD7, 0xFB, 0x6C, 0x64,
+    0xAF, 0xF0, 0xE4, 0xC7, 0xEC, 0xE1, 0x42, 0x1A, 0x8B, 0x93, 0x1F, 0x4A, 0x54, 0x89, 0x55, 0x67,
+    0x22, 0xB5, 0xA7, 0x67, 0x1F, 0xD3, 0x65, 0xFB, 0x20, 0x5E, 0x47, 0xA6, 0x94, 0x3D, 0x33, 0x74,
+    0xD2, 0x77, 0x1B, 0xD7, 0x50, 0x33, 0xEB, 0x55, 0x42, 0x27, 0xF7, 0x7A, 0xB8, 0x0A, 0xB5, 0x4A,
+    0x4B, 0x1D, 0xD0, 0x69, 0x6A, 0xC3, 0x6D, 0xA8, 0x74, 0x98, 0x39, 0x28, 0xD2, 0x6D, 0xF3, 0x66,
+    0x84, 0xCA, 0x31, 0xDF, 0x05, 0xF5, 0xCB, 0xA8, 0xDF, 0x0E, 0x50, 0xCE, 0x98, 0x74, 0xA0, 0xA4,
+    0xD1, 0x02, 0xB8, 0x94, 0x53, 0x97, 0x35, 0x7A, 0xF4, 0xF0, 0x95, 0xFF, 0xB8, 0xD5, 0xAE, 0x3C,
+    0x60, 0x06, 0x80, 0x7F, 0x6A, 0x81, 0x49, 0x2E, 0xB2, 0x25, 0x50, 0xED, 0xCE, 0x39, 0xE8, 0x63,
+    0x60, 0x60, 0x58, 0x44, 0xDB, 0xDA, 0x58, 0x33, 0x65, 0xBF, 0xE8, 0x74, 0xD2, 0xD1, 0xF9, 0x9A,
+    0x09, 0xBD, 0xE9, 0x4C, 0x70, 0x61, 0xE5, 0x7B, 0x96, 0xAE, 0x77, 0x98, 0xEF, 0xBE, 0xFF, 0x72,
+    0x64, 0x77, 0x77, 0xB6, 0x8B, 0x7E, 0xEB, 0xD5, 0xEF, 0x35, 0x4C, 0xD2, 0x24, 0xA1, 0x07, 0x3D,
+    0x40, 0xED, 0x6B, 0xD0, 0xAD, 0x0E, 0xE7, 0x11, 0x51, 0x9B, 0x80, 0xAA, 0x07, 0x8E, 0x8E, 0xA0,
+    0xE8, 0x2A, 0xCE, 0x92, 0xEE, 0x3E, 0xCD, 0x56, 0xC9, 0x1C, 0x46, 0xD8, 0x1E, 0x8A, 0x8F, 0x02,
+    0xCC, 0xA6, 0x50, 0xAA, 0x44, 0x11, 0x3E, 0xF3, 0x29, 0xF7, 0x2F, 0x5D, 0xBB, 0x00, 0xBA, 0xAB,
+    0x3D, 0x26, 0x2D, 0x40, 0xC7, 0xE9, 0xC7, 0x5D, 0xEE, 0xA7, 0x22, 0x92, 0x6D, 0x73, 0x9B, 0xDA,
+    0x8C, 0xD5, 0x84, 0xFA, 0x00, 0x8A, 0xFB, 0xA8, 0xC5, 0xAD, 0x13, 0x59, 0xAB, 0x8E, 0x32, 0x3C,
+    0x8E, 0x4E, 0x45, 0xCB, 0xC0, 0x83, 0xD4, 0x3E, 0x3F, 0xA7, 0xE8, 0xC7, 0x64, 0xFE, 0xA4, 0xF8,
+    0xB7, 0xDE, 0x16, 0xD0, 0x22, 0xA8, 0x01, 0x4B, 0x0D, 0xC9, 0x05, 0x2A, 0xDD, 0x5F, 0xF8, 0x46,
+    0x5C, 0x88, 0x0C, 0xDB, 0x86, 0xE7, 0x6D, 0xE6, 0x97, 0xDB, 0x11, 0x6D, 0x8E, 0x1F, 0x27, 0x50,
+    0x9C, 0x8A, 0xE1, 0x60, 0xD7, 0xC9, 0xDB, 0xED, 0x87, 0xD2, 0x3F, 0xC6, 0x31, 0xC1, 0x05, 0x8A,
+    0x5C, 0x76, 0xAA, 0x60, 0xEC, 0x07, 0x98, 0x43, 0xE9, 0xB5, 0x91, 0xFF, 0xBD, 0x13, 0x91, 0xAF,
+    0xFC, 0xFB, 0x53, 0xBA, 0xE7, 0x16, 0xA3, 0x69, 0x47, 0x08, 0xD9, 0xF9, 0x8F, 0x93, 0x8B, 0xFF,
+    0x45, 0xA7, 0xF6, 0x06, 0xD4, 0x1E, 0x93, 0xEE, 0xA3, 0xEA, 0xFD, 0xB3, 0xE7, 0x54, 0x34, 0xC6,
+    0x33, 0x29, 0x12, 0x3A, 0x2D, 0xC1, 0x09, 0xB0, 0x08, 0x5B, 0x03, 0xFA, 0x29, 0xCD, 0x09, 0x6F,
+    0x9A, 0x09, 0xBB, 0xA7, 0x09, 0xDC, 0xF1, 0xD9, 0x04, 0xEE, 0x0F, 0x5C, 0xAE, 0x7C, 0xEC, 0x45,
+    0x2D, 0xC0, 0xED, 0xCF, 0x8D, 0x13, 0x2B, 0xD2, 0x16, 0x99, 0x37, 0xBF, 0x46, 0xAB, 0x9D, 0xDF,
+    0x56, 0x32, 0xAA, 0x93, 0x9A, 0xCB, 0xF4, 0xC4, 0xBF, 0xCC, 0xB6, 0x3A, 0x90, 0xEB, 0xF1, 0xDD,
+    0x96, 0x1A, 0x91, 0xEF, 0x99, 0xB6, 0x19, 0x85, 0x09, 0xF0, 0x6F, 0x5D, 0x03, 0xC7, 0x7B, 0xC0,
+    0x6A, 0x00, 0x1E, 0x3D, 0xC8, 0xA4, 0xF7, 0xC1, 0xA6, 0xCA, 0xCF, 0x54, 0x00, 0x7F, 0xD5, 0xC4,
+    0x7E, 0x6A, 0x9B, 0x4B, 0x23, 0x31, 0x64, 0xD5, 0x54, 0x4B, 0x73, 0xE7, 0x27, 0x5D, 0x79, 0x99,
+    0x03, 0x85, 0x5A, 0x7F, 0xB6, 0xFE, 0xA7, 0xB7, 0x5F, 0x1F, 0xFE, 0xA4, 0x06, 0xBE, 0x7C, 0xF8,
+    0x9C, 0xAC, 0xBF, 0x7C, 0xD8, 0x80, 0x0E, 0x3B, 0xD3, 0xE2, 0x47, 0xD2, 0xBB, 0x35, 0x17, 0xB8,
+    0xB2, 0xDA, 0xDC, 0x7E, 0x50, 0xBD, 0x9A, 0xF6, 0x8F, 0xDD, 0xDB, 0xCD, 0x0D, 0x30, 0x7D, 0x75,
+    0xBC, 0x7B, 0xF5, 0x4B, 0x13, 0x7A, 0x13, 0xAD, 0x37, 0x98, 0x58, 0x0E, 0xBB, 0x57, 0x6E, 0x5C,
+    0xB9, 0x71, 0x65, 0xBE, 0xAC, 0x52, 0xB6, 0x9C, 0x4F, 0xC7, 0x7D, 0x77, 0x27, 0xAD, 0x6B, 0xFB,
+    0x83, 0x34, 0xDF, 0x21, 0x70, 0x49, 0x39, 0x6E, 0x77, 0x57, 0xCD, 0xF7, 0x42, 0x9D, 0xD4, 0x90,
+    0x51, 0x23, 0x67, 0x9E, 0xBB, 0x13, 0xFB, 0x65, 0xE5, 0xF4, 0x9B, 0xED, 0xB7, 0x9E, 0x04, 0x2E,
+    0xB1, 0x48, 0x95, 0xBC, 0xD5, 0x2C, 0x0F, 0x74, 0x00, 0xFC, 0xC4, 0x3D, 0x93, 0x26, 0xA6, 0xDD,
+    0xCF, 0xDD, 0x74, 0x65, 0xB3, 0x60, 0xD0, 0xD1, 0xD1, 0xDB, 0xE6, 0x21, 0x60, 0x59, 0xBD, 0x92,
+    0x26, 0xBA, 0xBD, 0x4A, 0x52, 0x5C, 0x9E, 0x4E, 0x66, 0xB7, 0xDF, 0xF8, 0x0E, 0x70, 0x64, 0xDB,
+    0xA1, 0xD2, 0xE1, 0x12, 0x0F, 0x2C, 0x64, 0x0D, 0xE8, 0xB4, 0xBF, 0x72, 0xFF, 0x10, 0x96, 0xB9,
+    0xAE, 0xDD, 0x5D, 0xDE, 0xDD, 0xBD, 0xBC, 0xFB, 0x54, 0x99, 0x76, 0xBC, 0x62, 0x70, 0xA1, 0x2F,
+    0x75, 0xB8, 0xC6, 0xCE, 0xD3, 0x9B, 0x22, 0x4D, 0xEC, 0x5B, 0xF1, 0x4F, 0x51, 0xC4, 0x5D, 0xE3,
+    0x3B, 0x7B, 0xAF, 0x6E, 0xB8, 0xA0, 0xDB, 0x34, 0xBB, 0xEA, 0x5E, 0x6E, 0xA8, 0x28, 0x84, 0xEA,
+    0xB8, 0xE8, 0x96, 0x15, 0xDD, 0x35, 0x3C, 0x68, 0xFF, 0xE0, 0x52, 0xBF, 0x25, 0x5D, 0xB5, 0xE6,
+    0x61, 0x76, 0x9A, 0x97, 0x37, 0x8F, 0xED, 0x7F, 0xF4, 0xF6, 0x57, 0xFA, 0x4B, 0x5F, 0xA0, 0x96,
+    0xB7, 0x64, 0xB8, 0x70, 0xDD, 0xDF, 0x3F, 0x1B, 0x0E, 0x30, 0x2D, 0x35, 0x45, 0xA2, 0xCC, 0xC5,
+    0x8C, 0x1D, 0xFF, 0xA7, 0x0B, 0xF3, 0xCB, 0xA1, 0xBA, 0xD3, 0xDC, 0x60, 0xA2, 0xC3, 0xCC, 0x0C,
+    0xD5, 0xB6, 0x58, 0x7A, 0x83, 0x71, 0xEF, 0x9B, 0x61, 0xFB, 0xD7, 0xD9, 0x2E, 0xC5, 0x4F, 0xA1,
+    0x6F, 0xE2, 0x4C, 0xCA, 0x5B, 0x33, 0xBB, 0xA1, 0xA3, 0x79, 0xCD, 0xCF, 0x79, 0xF1, 0x92, 0x0D,
+    0x17, 0xCE, 0xA0, 0x11, 0xFD, 0xDF, 0x78, 0x4A, 0x11, 0x5F, 0x6C, 0xFE, 0x7A, 0xA0, 0xC6, 0xB5,
+    0x3A, 0xB2, 0xCF, 0x1C, 0x9D, 0x6C, 0x4B, 0xCD, 0x12, 0x9D, 0x5C, 0x60, 0x4A, 0x8F, 0xF9, 0xC1,
+    0xAA, 0x63, 0x59, 0x4B, 0xE3, 0xC2, 0xA8, 0xCC, 0x35, 0x5C, 0x73, 0x01, 0xF7, 0xD7, 0x1D, 0xC8,
+    0x00, 0xE6, 0xDE, 0x29, 0x7B, 0xA3, 0x04, 0x8A, 0xF5, 0xD8, 0x64, 0x68, 0xFA, 0xFB, 0x13, 0x9C,
+    0xB3, 0xD3, 0xAF, 0x28, 0x12, 0x4B, 0x5C, 0x28, 0x22, 0x35, 0x16, 0x7A, 0x1E, 0xFA, 0x75, 0x34,
+    0xA0, 0xD2, 0xDF, 0x37, 0xFD, 0xFB, 0x28, 0x47, 0x85, 0xF4, 0x50, 0xE5, 0xE3, 0x12, 0x2E, 0x5C,
+    0x83, 0x4A, 0x3A, 0x4A, 0x91, 0x60, 0x3B, 0x35, 0x14, 0x3D, 0x26, 0xEC, 0xC3, 0x6D, 0x17, 0xB0,
+    0x45, 0x77, 0x92, 0xD5, 0x5F, 0xF7, 0x23, 0x4C, 0x24, 0xCD, 0x69, 0x07, 0xD9, 0x11, 0xD9, 0x26,
+    0xF9, 0x05, 0x5C, 0xD1, 0x03, 0x36, 0x96, 0x9D, 0x19, 0x72, 0xB3, 0xD6, 0xEA, 0x24, 0x27, 0xFA,
+    0xC4, 0x91, 0xB7, 0x4F, 0x84, 0xB6, 0xC7, 0x05, 0xAE, 0x31, 0xB8, 0x60, 0xD2, 0x02, 0xD7, 0xF4,
+    0xE7, 0xA2, 0x32, 0x69, 0xD9, 0x1B, 0x4F, 0x5B, 0x58, 0x66, 0x2B, 0x74, 0x9E, 0x81, 0x78, 0x8E,
+    0xB1, 0x78, 0xE6, 0x4B, 0xCD, 0x09, 0xAD, 0x71, 0xB5, 0xCE, 0x64, 0x8A, 0xB3, 0x84, 0x85, 0x36,
+    0x7F, 0xC3, 0xB4, 0xE3, 0xC2, 0x0C, 0x5B, 0xFE, 0xD4, 0xFD, 0x1F, 0x4E, 0x47, 0xCE, 0x8A, 0xFD,
+    0xD8, 0x87, 0xF7, 0x13, 0x61, 0x96, 0xA8, 0xF6, 0x28, 0x57, 0x57, 0xCA, 0xF5, 0xD8, 0x7D, 0x7E,
+    0xDF, 0xD9, 0x29, 0x56, 0x64, 0x0D, 0x14, 0x71, 0x34, 0xC6, 0x73, 0x80, 0xDD, 0x22, 0x41, 0x6E,
+    0x23, 0x01, 0xDB, 0x4C, 0x73, 0xC3, 0x5D, 0x07, 0xA8, 0x64, 0x7E, 0x76, 0x00, 0xB6, 0xA9, 0xA4,
+    0x87, 0x09, 0xEB, 0xE7, 0x07, 0x54, 0xD2, 0x51, 0x77, 0x38, 0x5F, 0x7A, 0x13, 0x99, 0x31, 0xC7,
+    0x35, 0x3A, 0x16, 0x89, 0x39, 0x15, 0x2E, 0x14, 0xE9, 0xE9, 0x8E, 0x29, 0xEE, 0xCE, 0xDD, 0x46,
+    0x75, 0xC5, 0x50, 0x0E, 0x2C, 0x44, 0x9A, 0xBA, 0x31, 0x22, 0xF1, 0x6C, 0x3D, 0x2A, 0xF3, 0xBF,
+    0xAC, 0x24, 0x76, 0xA4, 0x29, 0x37, 0x8C, 0x44, 0xD2, 0x4C, 0x2A, 0x25, 0x13, 0x4A, 0x61, 0xC8,
+    0x27, 0x1B, 0x45, 0xAA, 0x3C, 0xE1, 0x01, 0x38, 0xBA, 0xFE, 0x8D, 0x0F, 0xAF, 0xA1, 0x45, 0x44,
+    0x7A, 0xDC, 0xCF, 0x0E, 0x37, 0xCF, 0x0F, 0xEC, 0x53, 0xA4, 0xA2, 0x2F, 0x3A, 0x5C, 0xD0, 0xC9,
+    0x06, 0xA6, 0xB8, 0x50, 0xA3, 0x3A, 0x6A, 0x7A, 0x4C, 0xA0, 0x37, 0x2D, 0x15, 0x2E, 0x54, 0x30,
+    0xA8, 0xB5, 0x95, 0x50, 0x89, 0xB4, 0x2B, 0x29, 0x44, 0xDE, 0x3B, 0x37, 0x24, 0x11, 0x11, 0x2D,
+    0x22, 0x43, 0xC9, 0xA0, 0xD2, 0x0D, 0x1D, 0xCD, 0xCB, 0x6D, 0xE9, 0x1F, 0x53, 0x2C, 0xB9, 0x76,
+    0x96, 0x84, 0xB7, 0xD7, 0xE7, 0x1A, 0x99, 0xBD, 0x67, 0x3A, 0x6A, 0x4C, 0xA4, 0xA7, 0x6C, 0x4C,
+    0x64, 0x4E, 0xE5, 0x8B, 0xC4, 0x32, 0x77, 0xEC, 0xD7, 0xB8, 0x86, 0x7E, 0x47, 0xDA, 0x6A, 0x5D,
+    0xCB, 0x33, 0x59, 0x05, 0x1E, 0x60, 0xDB, 0x9F, 0x93, 0x6D, 0x9C, 0x9C, 0x30, 0x42, 0x3E, 0x73,
+    0x76, 0x24, 0x7F, 0xCA, 0x4A, 0x58, 0x84, 0x1D, 0x39, 0x28, 0x07, 0x4C, 0x6B, 0xFE, 0xBE, 0x61,
+    0x49, 0x0F, 0x2E, 0x4C, 0xC9, 0x0D, 0xB9, 0x39, 0xA6, 0x55, 0xDD, 0x2E, 0x50, 0xBD, 0xE0, 0x41,
+    0x4B, 0x02, 0xEA, 0xBD, 0x06, 0x4C, 0x3B, 0x00, 0x47, 0x26, 0x82, 0x0D, 0x35, 0x30, 0x14, 0x3D,
+    0xB8, 0xC6, 0x05, 0x54, 0xC7, 0x31, 0x54, 0xE8, 0x8E, 0x4A, 0x9A, 0xAA, 0xB5, 0x32, 0xB0, 0x3A,
+    0x47, 0xFF, 0x18, 0x1B, 0x97, 0x18, 0x29, 0xBC, 0xE3, 0x29, 0x66, 0x23, 0xCB, 0xEC, 0x1A, 0xBF,
+    0x0B, 0x0D, 0xBE, 0x6A, 0x70, 0x81, 0xAA, 0x45, 0x27, 0xEA, 0x04, 0x3D, 0x93, 0x01, 0xE6, 0x4C,
+    0xA6, 0x50, 0x31, 0x29, 0x1B, 0x5C, 0x98, 0x98, 0x16, 0x1D, 0x67, 0x45, 0x42, 0x75, 0x33, 0x06,
+    0x38, 0x9A, 0x31, 0x85, 0x6A, 0x49, 0xE9, 0x71, 0x03, 0xB6, 0x45, 0xF7, 0x14, 0x27, 0x2C, 0xF9,
+    0x5F, 0x43, 0x83, 0x1F, 0x53, 0x96, 0x8B, 0x60, 0x9B, 0xCF, 0x81, 0x6B, 0x76, 0xC1, 0xFD, 0x7D,
+    0x0F, 0x5A, 0xDA, 0xFB, 0x6D, 0x67, 0x2D, 0x7E, 0xB5, 0xA9, 0xD6, 0xEC, 0xF5, 0x26, 0xE2, 0x82,
+    0x4E, 0x19, 0xE8, 0x99, 0x50, 0x74, 0x2C, 0xA1, 0x57, 0x09, 0x06, 0xDD, 0xC2, 0xD2, 0x04, 0x98,
+    0x3B, 0x60, 0x7A, 0x05, 0xA8, 0x67, 0x23, 0x53, 0x12, 0xD7, 0x9E, 0x84, 0x32, 0xC0, 0xA5, 0x09,
+    0xF0, 0x5F, 0x7A, 0x40, 0xE2, 0xD8, 0xFF, 0x7D, 0x9F, 0x60, 0x94, 0xAC, 0xFF, 0xF9, 0x5C, 0xD9,
+    0x1E, 0xE6, 0x23, 0x6B, 0xB7, 0xF8, 0x4D, 0x5C, 0xD9, 0x96, 0xA2, 0xCB, 0x27, 0x6B, 0x89, 0xAC,
+    0x59, 0x49, 0xDE, 0xDC, 0xC3, 0x19, 0x4E, 0x4B, 0x77, 0x86, 0x41, 0x90, 0xB6, 0x27, 0x81, 0x9D,
+    0x79, 0x5D, 0xCE, 0x95, 0x15, 0x3F, 0xB2, 0x82, 0x4F, 0x58, 0x1B, 0xBF, 0x6F, 0x4B, 0xDD, 0xC3,
+    0x99, 0x8F, 0xF0, 0xE7, 0x29, 0x9B, 0xA4, 0xE9, 0x05, 0x5F, 0x89, 0xF0, 0xE7, 0x3F, 0xFB, 0x2B,
+    0xAA, 0x6C, 0x9C, 0x74, 0xBB, 0x47, 0x69, 0x85, 0xD9, 0x66, 0x5D, 0xBC, 0xFF, 0x52, 0xE7, 0x3A,
+    0x13, 0xEB, 0xC6, 0xBD, 0x34, 0x30, 0xB7, 0xAD, 0xEA, 0x6A, 0x4C, 0xDB, 0x53, 0x99, 0x96, 0xA1,
+    0x42, 0xC7, 0x25, 0xE5, 0xB3, 0x91, 0xF1, 0x28, 0xB5, 0x0A, 0xE8, 0xB8, 0xE4, 0x1A, 0xF5, 0xC1,
+    0x80, 0x91, 0x86, 0x9D, 0xF7, 0x7E, 0x4D, 0x25, 0xF5, 0x5C, 0x49, 0xAB, 0x1C, 0xA8, 0x25, 0x4C,
+    0x8B, 0xFE, 0x41, 0xA6, 0x50, 0x79, 0xAA, 0x86, 0x85, 0xE7, 0x18, 0x35, 0x8C, 0xCA, 0x74, 0x69,
+    0xCA, 0x65, 0xD7, 0x56, 0x5A, 0x84, 0x6A, 0x7D, 0x52, 0x27, 0x2F, 0xD7, 0xAC, 0x44, 0x7F, 0xF0,
+    0x17, 0xB6, 0xA1, 0x84, 0x09, 0x4C, 0x0F, 0xC3, 0x42, 0xC2, 0x99, 0x66, 0xEC, 0xCB, 0x8B, 0x67,
+    0xFA, 0x5A, 0x5A, 0x77, 0xD2, 0x48, 0xF8, 0x7B, 0x56, 0x76, 0x7E, 0x7F, 0x22, 0x78, 0xE6, 0x24,
+    0x5C, 0xAA, 0xF5, 0x2F, 0x86, 0xEA, 0x95, 0x70, 0xE3, 0x24, 0xE9, 0x1D, 0x58, 0x6C, 0x29, 0x69,
+    0x5B, 0xE6, 0xFD, 0x70, 0xCA, 0x71, 0xFF, 0x49, 0x70, 0x37, 0x59, 0xA4, 0x73, 0x4C, 0x16, 0x9D,
+    0x72, 0xE7, 0xE6, 0x06, 0xD4, 0xF9, 0x63, 0x2F, 0x6E, 0x06, 0x8C, 0x70, 0xCE, 0x73, 0x4D, 0x72,
+    0x34, 0x6F, 0xC3, 0xF6, 0x2C, 0x37, 0x4C, 0x38, 0x25, 0xE4, 0xB7, 0x39, 0x52, 0x19, 0xFF, 0xAC,
+    0x50, 0x4D, 0x87, 0x93, 0x86, 0xBA, 0x87, 0xBF, 0x38, 0xB3, 0x11, 0x56, 0x7D, 0xDE, 0x78, 0x60,
+    0x5F, 0x4A, 0x40, 0x9A, 0x02, 0x57, 0x74, 0x00, 0x1D, 0x66, 0xC0, 0x0D, 0x7B, 0x37, 0x62, 0xBD,
+    0x48, 0x20, 0x39, 0x7F, 0x44, 0xA9, 0x92, 0x6E, 0x75, 0x5B, 0x32, 0x61, 0x56, 0x24, 0x73, 0xE7,
+    0x6E, 0x53, 0xFA, 0xBE, 0x4E, 0x6C, 0x56, 0x7A, 0x40, 0x4B, 0xF3, 0xC0, 0xE9, 0xF9, 0x00, 0xAB,
+    0x60, 0xB1, 0xC2, 0x04, 0x96, 0x2A, 0xA1, 0xA3, 0x0D, 0xB9, 0xDB, 0x6E, 0x46, 0x47, 0xF1, 0xC1,
+    0xF3, 0x77, 0xA3, 0x13, 0x91, 0x34, 0xBD, 0xDE, 0x9B, 0xD8, 0xE9, 0xE8, 0x5E, 0x0D, 0xCE, 0x4F,
+    0x2B, 0x26, 0x74, 0x3D, 0x83, 0xBD, 0xD3, 0x16, 0x9B, 0xA1, 0xCC, 0x31, 0x06, 0x97, 0x7E, 0x4D,
+    0x1B, 0xC9, 0xF4, 0x82, 0x2F, 0x44, 0x12, 0x7F, 0xFE, 0xB3, 0xBF, 0x3A, 0xD3, 0x41, 0xA3, 0x7A,
+    0x4A, 0x23, 0x8D, 0x79, 0xEB, 0xFD, 0x58, 0xFC, 0x43, 0xE8, 0xF9, 0xA7, 0x30, 0xA1, 0x0E, 0x25,
+    0x65, 0x6B, 0x83, 0x4D, 0x63, 0x1B, 0xC9, 0xF0, 0x9B, 0xDB, 0x48, 0x54, 0x0E, 0xCE, 0x54, 0x7F,
+    0x52, 0xF3, 0x36, 0x0D, 0x3C, 0x78, 0x2A, 0xAE, 0xA6, 0xFC, 0xDE, 0x46, 0x89, 0xEF, 0xCB, 0xFF,
+    0xAC, 0x7F, 0x90, 0x70, 0x0E, 0x66, 0x89, 0xE2, 0x7D, 0x8F, 0x3B, 0x86, 0x7A, 0x89, 0xEA, 0x3A,
+    0xCC, 0x9B, 0x89, 0x4A, 0xC7, 0x4C, 0xFF, 0x75, 0x43, 0xC9, 0x99, 0xA3, 0x7B, 0x8C, 0xCF, 0x77,
+    0xB6, 0x71, 0x24, 0x89, 0x2F, 0x81, 0x2F, 0x7E, 0xD2, 0x50, 0x3C, 0x0F, 0xC2, 0x1B, 0x45, 0xA0,
+    0xE4, 0x46, 0xEE, 0x8E, 0x72, 0x12, 0x72, 0x3B, 0xE3, 0xA7, 0x0A, 0xC9, 0xFC, 0x21, 0xF3, 0x79,
+    0x2D, 0xF2, 0x74, 0xC8, 0x05, 0x33, 0x1D, 0xF2, 0x32, 0xD4, 0xA3, 0xC3, 0x78, 0xE4, 0xB0, 0xC9,
+    0x31, 0x71, 0x31, 0x96, 0x1C, 0x2F, 0xFE, 0xF5, 0x87, 0x87, 0x4A, 0x44, 0x52, 0xF5, 0xED, 0x9F,
+    0xEE, 0xE9, 0x30, 0x57, 0x71, 0xD7, 0x86, 0xCB, 0xCA, 0x9F, 0xD4, 0xEA, 0xEE, 0x7D, 0x0D, 0x4A,
+    0x59, 0x53, 0x7C, 0x78, 0xB3, 0xA3, 0xA6, 0x0C, 0x3A, 0xCF, 0xDB, 0xB4, 0xA6, 0xE5, 0x88, 0x25,
+    0x2E, 0xB8, 0xA0, 0x7A, 0x7A, 0x8E, 0xD5, 0x4A, 0xA4, 0xA9, 0xE5, 0xCC, 0x69, 0x45, 0xB9, 0xFD,
+    0x7D, 0x95, 0x56, 0x11, 0xFD, 0xEE, 0x3F, 0x44, 0xF4, 0x3B, 0xCF, 0xB6, 0xE8, 0xFF, 0x4F, 0x07,
+    0x4C, 0x6F, 0x02, 0x36, 0xD9, 0xBB, 0xD1, 0xB5, 0x4E, 0x06, 0x17, 0x9C, 0x3F, 0x2A, 0x9B, 0x92,
+    0x49, 0x49, 0xC9, 0xA4, 0xA2, 0x62, 0x36, 0xA5, 0xF4, 0xFD, 0x04, 0xF7, 0x7E, 0x9A, 0xA1, 0xB7,
+    0xCA, 0xCC, 0x85, 0x6B, 0xA0, 0x7E, 0x27, 0xE2, 0xD2, 0x72, 0x1F, 0x58, 0xAE, 0x44, 0x64, 0x38,
+    0x3E, 0x3C, 0x3C, 0x1C, 0x06, 0x20, 0x13, 0x97, 0x86, 0xDF, 0x85, 0xB8, 0x74, 0xD2, 0x10, 0xD4,
+    0xB2, 0x92, 0xA6, 0xF6, 0x47, 0x36, 0xE8, 0x9F, 0x74, 0xD4, 0x53, 0x8A, 0x5F, 0xFD, 0xF4, 0xFA,
+    0x62, 0x25, 0xF2, 0xFE, 0xDF, 0x5E, 0x9F, 0xF7, 0xD8, 0xEF, 0x07, 0xFA, 0x25, 0xB5, 0x89, 0x2E,
+    0xD4, 0x92, 0x58, 0xF5, 0x27, 0x26, 0xF7, 0x0B, 0xA5, 0x44, 0xEA, 0x37, 0x25, 0x52, 0xA7, 0xAA,
+    0xA1, 0xFA, 0xCF, 0x26, 0x52, 0x7A, 0x7A, 0x5C, 0x43, 0x8D, 0x19, 0xCF, 0x67, 0x28, 0x52, 0x26,
+    0x2F, 0xF7, 0x50, 0xFA, 0x19, 0xE8, 0x76, 0x0A, 0xF4, 0x0E, 0x98, 0xDA, 0x06, 0xDC, 0x9D, 0x00,
+    0xC5, 0x2F, 0x23, 0x30, 0x4B, 0x40, 0x79, 0x1B, 0x32, 0xD4, 0x9A, 0x2D, 0x60, 0x7D, 0xFE, 0x2C,
+    0xD2, 0x63, 0x18, 0x56, 0x89, 0x3A, 0xD4, 0xB8, 0xFF, 0xB7, 0x48, 0x45, 0xA2, 0x64, 0x86, 0x4A,
+    0x0E, 0xDC, 0x33, 0x2D, 0x74, 0x37, 0xC0, 0x7D, 0x15, 0xF8, 0xC7, 0x16, 0xDC, 0x6C, 0x64, 0x60,
+    0xBA, 0x38, 0x2A, 0xA5, 0xFD, 0x18, 0x76, 0x7B, 0x49, 0x05, 0x60, 0x46, 0x3A, 0x39, 0x4D, 0xCD,
+    0x7E, 0xD0, 0x03, 0xAC, 0x3A, 0x3E, 0xD6, 0x08, 0xFB, 0x1B, 0x9B, 0xE6, 0x32, 0xD5, 0xC7, 0x76,
+    0x30, 0x64, 0xBE, 0x3F, 0x6E, 0x01, 0xA5, 0x77, 0x5F, 0x6D, 0xB0, 0xC1, 0x3D, 0x17, 0xD1, 0xC9,
+    0x3D, 0xDD, 0x41, 0x5F, 0xB2, 0x84, 0x79, 0x49, 0x0D, 0xD5, 0x0B, 0xB8, 0x06, 0x7B, 0x17, 0xD3,
+    0xA2, 0x85, 0xA2, 0x83, 0x0D, 0x2C, 0x4F, 0x7A, 0xEA, 0xEE, 0x6F, 0x9A, 0x0B, 0x6C, 0xF1, 0xC6,
+    0xF1, 0xB0, 0x9E, 0xCC, 0x9F, 0x1C, 0x23, 0x85, 0xFC, 0xFB, 0x14, 0x40, 0x2F, 0xF2, 0x4E, 0x9F,
+    0xA9, 0x48, 0xF5, 0x74, 0xCA, 0x11, 0xE6, 0x99, 0x8D, 0x7E, 0x71, 0xA0, 0xB4, 0x82, 0x6B, 0x6C,
+    0x30, 0xAD, 0x4E, 0x2A, 0xD1, 0xB3, 0x64, 0xC2, 0x94, 0x0A, 0xE7, 0x5D, 0x63, 0x83, 0x6E, 0x75,
+    0x52, 0xA9, 0xE8, 0x59, 0xAA, 0x0D, 0x95, 0x7A, 0xFF, 0x2B, 0xEE, 0x87, 0xBF, 0x7A, 0xFF, 0x4D,
+    0x49, 0x12, 0xEB, 0x58, 0x75, 0x78, 0x66, 0xE3, 0xE9, 0x3A, 0x6E, 0xFC, 0x31, 0x9E, 0xDF, 0x4C,
+    0xED, 0x5E, 0x48, 0xA4, 0x92, 0xFE, 0x4C, 0xFE, 0xF3, 0xB3, 0x03, 0xB4, 0x48, 0x60, 0xFD, 0x8D,
+    0x81, 0x39, 0x55, 0x53, 0x79, 0x9D, 0x6C, 0x60, 0xD0, 0x89, 0x9A, 0x1E, 0xD7, 0xCC, 0x71, 0xA1,
+    0xF2, 0x65, 0xBB, 0x12, 0x69, 0x4F, 0xCE, 0xB5, 0x50, 0xFF, 0x11, 0x2D, 0x0D, 0xCF, 0x67, 0x52,
+    0xFC, 0x6D, 0x98, 0xA0, 0x65, 0x40, 0x32, 0xE7, 0x32, 0xE5, 0x73, 0x51, 0x1F, 0xC6, 0xC9, 0xA0,
+    0xEF, 0xAD, 0x5E, 0x4A, 0x3A, 0x2D, 0x99, 0x5D, 0xA5, 0x72, 0x8D, 0x7B, 0x39, 0xD9, 0xB0, 0xB8,
+    0xD9, 0x1A, 0x69, 0x72, 0x20, 0x7F, 0xDD, 0x63, 0x44, 0x5A, 0xE4, 0x43, 0x69, 0x98, 0x33, 0x60,
+    0x83, 0x89, 0x0C, 0xF9, 0xE0, 0x8B, 0xA8, 0xFA, 0x4B, 0x73, 0xCA, 0xAF, 0xBA, 0x50, 0xA4, 0xFF,
+    0xA9, 0xA3, 0xD6, 0xEB, 0xDC, 0x9C, 0xB8, 0xD8, 0x24, 0x6C, 0x6B, 0x3D, 0x4B, 0x76, 0x71, 0x41,
+    0x9D, 0x2F, 0xF7, 0x17, 0xD2, 0xC3, 0xEA, 0x04, 0xC0, 0xB3, 0xBD, 0x4D, 0x85, 0xBC, 0x2A, 0x81,
+    0xFE, 0x83, 0x01, 0x37, 0xB3, 0x2D, 0xC2, 0x9C, 0xB2, 0x35, 0x6D, 0x31, 0x30, 0xA3, 0xF2, 0xDB,
+    0xC3, 0xC1, 0xBE, 0x58, 0x7A, 0xF3, 0xDD, 0x77, 0x13, 0x4B, 0xB7, 0xC4, 0xB5, 0xAB, 0x06, 0x91,
+    0x48, 0xB9, 0x5A, 0x53, 0xA4, 0x4B, 0x89, 0xAB, 0xD8, 0x0C, 0xCB, 0x4D, 0x46, 0x05, 0xD0, 0xD2,
+    0xC1, 0x9F, 0x6D, 0xAB, 0xC7, 0x4F, 0x6C, 0x43, 0x44, 0xD3, 0x00, 0x13, 0x56, 0x22, 0x69, 0x0B,
+    0x35, 0x9C, 0xC5, 0x0E, 0x7E, 0x5B, 0xC7, 0xD1, 0xEF, 0x08, 0x35, 0xA4, 0x2D, 0x3F, 0xA3, 0xCC,
+    0x8F, 0x7C, 0x5C, 0xAD, 0x24, 0xD4, 0x12, 0xA9, 0xD8, 0x1E, 0x23, 0xAB, 0xE3, 0xC9, 0x91, 0xE2,
+    0xB3, 0x1C, 0x7A, 0xE4, 0x53, 0x66, 0xFF, 0x87, 0xDC, 0x41, 0xB8, 0x68, 0x4E, 0x41, 0xC8, 0x73,
+    0x27, 0x39, 0x2C, 0xB1, 0xA1, 0x48, 0xD4, 0xD8, 0x86, 0x9E, 0xCB, 0x98, 0xC8, 0xB5, 0xD3, 0x2E,
+    0x2A, 0x91, 0x3E, 0xAF, 0x56, 0x9E, 0xD3, 0x6F, 0xE9, 0xA2, 0xB2, 0xF9, 0x48, 0xC5, 0xD1, 0xB3,
+    0x2E, 0x3A, 0x2D, 0x83, 0x6B, 0x8E, 0x1F, 0x64, 0x0A, 0xF3, 0xE2, 0xBB, 0x3D, 0x12, 0x59, 0x61,
+    0xA4, 0x71, 0x2F, 0x87, 0x9A, 0x07, 0x6A, 0xBE, 0x58, 0xFB, 0x65, 0x25, 0xC9, 0x8A, 0xDF, 0x1A,
+    0x36, 0x2B, 0xB2, 0x61, 0x4F, 0x24, 0x32, 0x67, 0x92, 0x4F, 0x5E, 0x1C, 0xD8, 0xC5, 0x35, 0x67,
+    0x57, 0xFB, 0x17, 0x87, 0x9E, 0x5A, 0x04, 0xBD, 0xB9, 0xD9, 0xB3, 0x4F, 0x15, 0x6C, 0xCB, 0x9A,
+    0x25, 0xB6, 0x75, 0x81, 0x23, 0x7A, 0x6C, 0x5B, 0x7A, 0x8E, 0x8A, 0x84, 0x7B, 0x53, 0x3A, 0x86,
+    0x95, 0xF8, 0x72, 0x7B, 0x84, 0xCF, 0x1C, 0x9A, 0x32, 0x50, 0xDE, 0x4C, 0x28, 0xE9, 0x73, 0xD7,
+    0x7C, 0x25, 0xF2, 0xAC, 0x48, 0xA7, 0x53, 0xC9, 0x94, 0xA8, 0xDB, 0x07, 0xB6, 0x3D, 0x4B, 0xEB,
+    0x55, 0xEB, 0x44, 0xFC, 0xE6, 0xEB, 0x43, 0x89, 0xFB, 0x61, 0xE2, 0x68, 0x8A, 0xF9, 0x51, 0x64,
+    0xBE, 0x7B, 0xD2, 0xF5, 0xE9, 0x29, 0x92, 0x62, 0xCE, 0xD1, 0x9E, 0xB7, 0xD2, 0x52, 0x1D, 0xF0,
+    0xFF, 0x03, 0xCD, 0xBC, 0x4D, 0x8C, 0x24, 0xC7, 0x95, 0xE7, 0xF9, 0x33, 0xB7, 0xCA, 0x34, 0x75,
+    0xD9, 0xB4, 0xAC, 0x76, 0x51, 0xDC, 0x51, 0x8B, 0x2C, 0x3A, 0x0F, 0x7D, 0x90, 0xD4, 0xAC, 0xF4,
+    0x39, 0xF0, 0xA0, 0x43, 0x46, 0xB8, 0x93, 0x35, 0x68, 0x01, 0x43, 0xEC, 0x32, 0x81, 0x65, 0x4A,
+    0xC0, 0x6A, 0x07, 0xD4, 0xA1, 0x17, 0xE8, 0xD1, 0xF4, 0x4C, 0xEA, 0x50, 0xD8, 0x29, 0xCC, 0x46,
+    0x66, 0x38, 0x45, 0x0C, 0x74, 0x20, 0xB0, 0xAA, 0xC3, 0xF4, 0xF6, 0x2E, 0x84, 0x19, 0x11, 0x58,
+    0xCD, 0x8E, 0x94, 0xEA, 0xEE, 0xE2, 0x02, 0xB5, 0x40, 0x6A, 0x27, 0x32, 0xC3, 0xAA, 0x0A, 0x33,
+    0x04, 0x56, 0x07, 0x19, 0x45, 0x68, 0x78, 0x20, 0xB0, 0x72, 0x49, 0xA4, 0xD8, 0xD3, 0xD5, 0x18,
+    0x1A, 0x29, 0xA7, 0xE8, 0x55, 0xF4, 0x88, 0xB7, 0x07, 0xF3, 0xC8, 0xCC, 0x22, 0x25, 0xB5, 0xBE,
+    0x5A, 0xBD, 0x5E, 0x19, 0x91, 0x15, 0x1F, 0x69, 0x66, 0xEF, 0xD9, 0xB3, 0xF7, 0xF1, 0x7F, 0xEF,
+    0x39, 0xBF, 0x03, 0xA0, 0xAE, 0x2A, 0xA1, 0x14, 0xA6, 0xDE, 0x2C, 0x99, 0x37, 0x46, 0xF8, 0xAD,
+    0x43, 0x46, 0xEC, 0xFD, 0x21, 0x1C, 0xA8, 0x68, 0x02, 0x10, 0xAD, 0x1F, 0x01, 0x59, 0x53, 0xEA,
+    0x06, 0xD0, 0xBE, 0x2B, 0x00, 0xEC, 0xA5, 0x10, 0x01, 0x36, 0x8A, 0xA7, 0x2A, 0x40, 0x89, 0xF4,
+    0x00, 0xEE, 0xE5, 0x1F, 0xB7, 0x00, 0x0B, 0xF7, 0x4C, 0x04, 0x6C, 0xB3, 0x6B, 0x02, 0x30, 0x57,
+    0xD1, 0x79, 0x30, 0xD1, 0xFA, 0xA2, 0x82, 0x69, 0x35, 0xA6, 0x04, 0xD3, 0xD1, 0x72, 0x04, 0xD3,
+    0xDA, 0x78, 0x16, 0xD8, 0x8E, 0x79, 0xCC, 0x96, 0x4C, 0x6B, 0x27, 0x3E, 0x13, 0xCE, 0x01, 0xA8,
+    0x1E, 0x00, 0x74, 0x93, 0x7E, 0xE7, 0xE9, 0x17, 0x93, 0xF4, 0x2B, 0x0B, 0xE9, 0xB7, 0x61, 0x75,
+    0xD9, 0x36, 0x0B, 0x59, 0xAF, 0xC5, 0x6F, 0x22, 0xE1, 0x1B, 0x87, 0xC6, 0x8F, 0xFF, 0xE8, 0x83,
+    0xBA, 0xE9, 0x5C, 0x05, 0x1B, 0xE5, 0x63, 0x01, 0xD4, 0xEB, 0x71, 0x02, 0x6C, 0x7C, 0x37, 0xAF,
+    0x21, 0xBB, 0xF3, 0xA3, 0x08, 0x94, 0x1B, 0x6F, 0x00, 0xE6, 0x56, 0x1F, 0x81, 0x58, 0x3A, 0xE0,
+    0xA2, 0x0E, 0xAD, 0x5D, 0xFF, 0x74, 0x3D, 0x71, 0x37, 0xA3, 0x34, 0xB6, 0x9A, 0x2F, 0x6C, 0x4B,
+    0xD4, 0x8B, 0x34, 0xE1, 0x46, 0x9A, 0xBD, 0x39, 0xF5, 0x42, 0x07, 0x80, 0xAC, 0x03, 0xE0, 0x0C,
+    0xA8, 0x27, 0xC9, 0x64, 0x49, 0x2E, 0x4B, 0x66, 0xF4, 0x3A, 0x64, 0xAD, 0xC3, 0x84, 0x0F, 0x91,
+    0x03, 0x3D, 0xD8, 0xC0, 0x7D, 0x0B, 0xB4, 0x34, 0x9C, 0x95, 0x06, 0xF2, 0x00, 0x79, 0x0D, 0xE5,
+    0x1A, 0x74, 0x57, 0xB0, 0x2F, 0x45, 0xA6, 0x36, 0xDA, 0xD6, 0x89, 0x54, 0x56, 0x02, 0xEC, 0x02,
+    0xD7, 0x21, 0x0B, 0x98, 0x1D, 0x28, 0x5A, 0xD8, 0xAB, 0x12, 0xC5, 0xD3, 0x56, 0xCB, 0xC2, 0xD6,
+    0xE5, 0x6F, 0x51, 0xC0, 0x18, 0x66, 0xFC, 0x5E, 0xC3, 0x3C, 0xA2, 0x7A, 0xD8, 0x3D, 0xC7, 0xEE,
+    0x75, 0x66, 0x7D, 0xD6, 0xCD, 0xA5, 0x29, 0x96, 0x15, 0x13, 0xD8, 0x84, 0x4D, 0x1E, 0xEC, 0xC8,
+    0x23, 0x6B, 0x69, 0x88, 0xF5, 0xCA, 0x4A, 0x34, 0x3D, 0x3B, 0x77, 0x94, 0x78, 0x76, 0xD9, 0xFB,
+    0x43, 0xAC, 0x77, 0x35, 0xF4, 0xBA, 0x01, 0xE7, 0x0F, 0x80, 0x2E, 0x07, 0xF2, 0x4B, 0x1E, 0xB2,
+    0xB7, 0x5B, 0xA0, 0x14, 0x40, 0xFF, 0xB8, 0x03, 0x76, 0x9D, 0x07, 0x1B, 0xF6, 0x80, 0x99, 0x8E,
+    0xE0, 0x7C, 0x51, 0x43, 0x47, 0x0F, 0x79, 0x65, 0x1B, 0xB2, 0x48, 0x59, 0x65, 0xD2, 0x65, 0x4B,
+    0xE6, 0xE2, 0x6D, 0x0F, 0x90, 0x7B, 0x40, 0x75, 0xC7, 0x5B, 0xAA, 0x22, 0xC0, 0x45, 0x00, 0xE5,
+    0x01, 0x98, 0xD7, 0xF9, 0x37, 0x97, 0x4A, 0xAA, 0x2E, 0xFF, 0x53, 0xFD, 0x62, 0xC4, 0x39, 0x98,
+    0x44, 0xB2, 0xDB, 0x15, 0xEE, 0x08, 0xCA, 0x19, 0xAA, 0x6D, 0x31, 0x37, 0x23, 0x85, 0x09, 0x97,
+    0x3B, 0xF7, 0xF2, 0xAD, 0x90, 0x4B, 0x4E, 0xF1, 0x47, 0x40, 0x04, 0xED, 0xC1, 0x01, 0x33, 0x70,
+    0x1E, 0xCE, 0x27, 0x56, 0x7D, 0x26, 0x93, 0x9E, 0x22, 0xAE, 0x4B, 0x9D, 0x89, 0x57, 0x2D, 0xC5,
+    0xFF, 0x86, 0xF5, 0x2A, 0x42, 0x89, 0x03, 0xBA, 0xD0, 0x82, 0x7E, 0xF9, 0xF1, 0x0A, 0xF2, 0x87,
+    0xAF, 0x00, 0xB3, 0x77, 0x3C, 0x68, 0x59, 0x02, 0xEE, 0x5F, 0xCF, 0x80, 0xDD, 0xCB, 0x1D, 0x64,
+    0x6F, 0xDD, 0x8C, 0x60, 0xBF, 0xA9, 0x1B, 0x18, 0x9F, 0x77, 0x1E, 0x3A, 0xF2, 0x1A, 0x13, 0x28,
+    0x2B, 0x0A, 0x98, 0x62, 0xA5, 0x61, 0xCE, 0x5C, 0x6A, 0x84, 0x93, 0xCB, 0x76, 0xE4, 0xDF, 0x5C,
+    0x92, 0x47, 0x57, 0xE7, 0x7F, 0xAA, 0x83, 0x83, 0x1F, 0x3D, 0x01, 0x93, 0x57, 0x2A, 0x8A, 0x7F,
+    0x56, 0xE3, 0xA4, 0x41, 0xFF, 0xBF, 0x13, 0xD4, 0x8F, 0x9E, 0xA8, 0x98, 0xDC, 0x8C, 0x6C, 0x30,
+    0x5A, 0x77, 0xB5, 0x7B, 0xF9, 0x99, 0xA0, 0xE4, 0x46, 0x4C, 0x1C, 0xE3, 0x67, 0xEE, 0x57, 0x21,
+    0xB7, 0x1A, 0x32, 0xE9, 0x7E, 0x5D, 0xFB, 0xB5, 0x60, 0x2E, 0xDE, 0xC6, 0x34, 0xA9, 0xFA, 0x0A,
+    0x94, 0x11, 0x3E, 0xED, 0x93, 0xC4, 0x77, 0xA0, 0x03, 0x5A, 0x62, 0x71, 0x76, 0xF9, 0xCC, 0x22,
+    0x6B, 0xC6, 0xCF, 0xBB, 0x4B, 0x9E, 0xCD, 0x4D, 0xD4, 0x8F, 0x3C, 0xF6, 0xCF, 0x60, 0xDC, 0xC1,
+    0x32, 0x62, 0x5E, 0x0A, 0xE4, 0xD6, 0x33, 0x73, 0x4F, 0x3F, 0xD3, 0x14, 0xFF, 0xD4, 0x55, 0x65,
+    0x9C, 0xB0, 0x77, 0x4C, 0x4B, 0x76, 0x49, 0xA4, 0xCB, 0x96, 0xA5, 0x2C, 0x91, 0xD7, 0x7D, 0x49,
+    0xF9, 0xDF, 0x5F, 0xD1, 0x8D, 0xF5, 0xB6, 0xDA, 0xCD, 0x22, 0x9F, 0xB3, 0x7E, 0x02, 0xF4, 0xAE,
+    0x02, 0x77, 0xB3, 0x01, 0xBA, 0x09, 0x90, 0x4B, 0x0D, 0xD9, 0xDB, 0x3D, 0x50, 0x9A, 0x06, 0x74,
+    0x2C, 0x81, 0x3D, 0xD5, 0x82, 0x09, 0xCE, 0xC3, 0x8C, 0x23, 0x70, 0x5E, 0x47, 0xE8, 0x28, 0xBC,
+    0x9A, 0x2F, 0x10, 0x4A, 0x09, 0xBA, 0x1B, 0x0E, 0x27, 0x60, 0xC4, 0xBB, 0x17, 0x24, 0xE6, 0xEF,
+    0xF8, 0x2B, 0xF9, 0x9F, 0xC6, 0x8B, 0x79, 0x75, 0xD1, 0x39, 0xD0, 0xDF, 0x02, 0x75, 0xBB, 0x86,
+    0x7F, 0x17, 0xA1, 0x9C, 0x81, 0x7B, 0xA2, 0xC6, 0xDC, 0x8C, 0x64, 0x71, 0xBC, 0x4E, 0x67, 0x5F,
+    0xAF, 0x47, 0x88, 0xCF, 0x4F, 0xEF, 0x06, 0x50, 0x88, 0x77, 0xD2, 0xAC, 0xCB, 0xD5, 0x4C, 0x1A,
+    0xF2, 0x0A, 0xE7, 0xB1, 0x1E, 0xDD, 0xA0, 0x23, 0xAA, 0x85, 0x1E, 0x66, 0x30, 0x86, 0x12, 0xF2,
+    0x0A, 0x57, 0x63, 0xBF, 0xB3, 0xFD, 0xE9, 0x06, 0x2D, 0x22, 0x2D, 0x2C, 0xF7, 0xF7, 0x7B, 0xD8,
+    0x83, 0x12, 0x8A, 0xF4, 0xB1, 0xC7, 0x04, 0x74, 0x24, 0x6B, 0xA1, 0x83, 0x19, 0xEC, 0xA6, 0x8F,
+    0xC1, 0xD5, 0xCC, 0x7B, 0x76, 0xA4, 0x9A, 0x0B, 0xA5, 0x04, 0x00, 0x9D, 0xF6, 0x28, 0xE9, 0xCA,
+    0x31, 0x90, 0x84, 0x3F, 0x1D, 0x03, 0x20, 0x29, 0x2D, 0xDB, 0x73, 0xD1, 0x0A, 0xAE, 0xB6, 0x5E,
+    0x07, 0xDD, 0xA8, 0x48, 0xCB, 0x8C, 0x09, 0x63, 0x8A, 0xED, 0xA7, 0x6A, 0x27, 0x12, 0xF4, 0x6B,
+    0x9F, 0x3C, 0xF5, 0x26, 0xEE, 0x71, 0x57, 0x9B, 0x57, 0x6E, 0x05, 0x25, 0x2F, 0x46, 0xCA, 0xCB,
+    0xC3, 0x01, 0xB5, 0xF5, 0xA0, 0xF9, 0x5A, 0xC8, 0x5A, 0x48, 0x8A, 0xFA, 0x84, 0x0F, 0x12, 0xD6,
+    0xE5, 0x6A, 0x26, 0xD2, 0x26, 0x4E, 0x4C, 0x12, 0x2B, 0x5C, 0xE2, 0x85, 0xA9, 0xE9, 0x61, 0xA6,
+    0xEA, 0x81, 0x1B, 0x03, 0xB7, 0x06, 0x7E, 0xAC, 0x18, 0x32, 0x70, 0x64, 0x60, 0xC9, 0xC0, 0x93,
+    0x81, 0x29, 0x2B, 0xAE, 0x0C, 0x6C, 0x19, 0xF8, 0x32, 0x30, 0x86, 0x79, 0xCF, 0xCE, 0x12, 0xE6,
+    0x42, 0x29, 0xF5, 0x6A, 0x55, 0x91, 0x79, 0x37, 0x8F, 0x88, 0x64, 0x91, 0x36, 0xD7, 0x8D, 0x8A,
+    0x23, 0x1D, 0xB2, 0xD8, 0x1B, 0xAF, 0x9B, 0x73, 0xF6, 0x3B, 0x9F, 0x0A, 0x38, 0x91, 0x80, 0xFB,
+    0xE3, 0x4F, 0x7B, 0x5C, 0x65, 0x3D, 0x39, 0xAE, 0xA6, 0xC0, 0x3D, 0xCE, 0x98, 0xFC, 0x88, 0x11,
+    0x79, 0xC7, 0x04, 0xD7, 0x70, 0xCF, 0x65, 0x45, 0x44, 0x3C, 0xEC, 0x88, 0xC8, 0xAB, 0xC0, 0x2E,
+    0x59, 0x04, 0xAC, 0xA7, 0x4C, 0xBB, 0xA1, 0x23, 0xE0, 0x6A, 0xC6, 0x49, 0xD7, 0x99, 0x90, 0xE8,
+    0x9D, 0x01, 0x59, 0xC4, 0xDD, 0xF8, 0xBF, 0xA1, 0x84, 0xA5, 0x2C, 0xD1, 0x0D, 0xF9, 0xF2, 0x5A,
+    0xCB, 0x2E, 0xAA, 0xA3, 0xF0, 0x36, 0x50, 0x40, 0x9F, 0x86, 0x70, 0xDE, 0xF9, 0xA4, 0xD7, 0x3B,
+    0x4C, 0xC0, 0xF9, 0xBC, 0xE2, 0x10, 0xFA, 0x2C, 0xE2, 0x3C, 0xEE, 0xA6, 0x44, 0x2B, 0x9E, 0x6E,
+    0x2E, 0x99, 0xF4, 0x14, 0x49, 0xA3, 0x0F, 0x02, 0xC1, 0x21, 0x00, 0x75, 0x51, 0x03, 0x14, 0xD7,
+    0x1A, 0x80, 0x4C, 0xDA, 0xB4, 0xFC, 0x57, 0x57, 0x84, 0xCC, 0xEB, 0x69, 0x8D, 0x15, 0x2B, 0x15,
+    0x74, 0x87, 0x87, 0xA0, 0x5F, 0x79, 0xBA, 0x05, 0x77, 0x60, 0x3C, 0x4C, 0x7D, 0xB1, 0x56, 0x65,
+    0x3D, 0x22, 0xC1, 0x35, 0x5A, 0xE6, 0xA1, 0x24, 0xAF, 0x8B, 0x1B, 0x1D, 0x33, 0x4A, 0xE3, 0x75,
+    0xE4, 0xB0, 0xC0, 0xD5, 0xAA, 0xED, 0x18, 0x61, 0x5E, 0x0A, 0x2A, 0x52, 0xE4, 0x58, 0xCF, 0xEC,
+    0xC4, 0x6C, 0xE7, 0xD5, 0x4A, 0x3A, 0x1F, 0xB2, 0x1E, 0xB2, 0xB7, 0x17, 0x80, 0x15, 0x0F, 0x9C,
+    0xFD, 0x0A, 0xC0, 0x7D, 0x15, 0x50, 0xF4, 0x40, 0xF1, 0xAA, 0xAA, 0x70, 0x8D, 0x96, 0x5A, 0xB7,
+    0xEA, 0xCE, 0x9C, 0x25, 0x7B, 0x59, 0x9B, 0x7B, 0xE7, 0xF3, 0x67, 0x5A, 0xD5, 0xD2, 0x95, 0x94,
+    0xB8, 0x2F, 0x34, 0xBA, 0x51, 0xDD, 0x21, 0x7B, 0xE4, 0x8F, 0x07, 0x13, 0xB2, 0xB8, 0x60, 0x97,
+    0xD2, 0x05, 0x13, 0x4C, 0x38, 0x62, 0x8F, 0xDE, 0x44, 0x1D, 0x8B, 0xAA, 0xA4, 0x30, 0x4D, 0xD6,
+    0xB3, 0xEC, 0x70, 0xAD, 0x59, 0x42, 0x29, 0xF2, 0xDA, 0x1F, 0x31, 0x95, 0x1D, 0x81, 0x33, 0xAC,
+    0x01, 0x5B, 0x60, 0x16, 0xE0, 0xC2, 0x4E, 0xE5, 0x6A, 0x69, 0x5D, 0x7D, 0x50, 0x58, 0x3F, 0x31,
+    0xB7, 0xC2, 0x58, 0xBD, 0x19, 0x5D, 0x35, 0x99, 0xE9, 0x50, 0x14, 0x2A, 0xBA, 0x2F, 0xFA, 0x4D,
+    0x73, 0x33, 0xBA, 0x4B, 0x61, 0x2F, 0xFB, 0x51, 0x74, 0xA1, 0x6C, 0x94, 0x5C, 0x6B, 0x7F, 0xD7,
+    0xCA, 0xBC, 0xE3, 0x0C, 0x5B, 0xC0, 0xDA, 0x16, 0x14, 0xD2, 0x92, 0x8B, 0x78, 0xDB, 0xAA, 0x3E,
+    0xEB, 0x30, 0x7E, 0x0F, 0x0E, 0x9C, 0xC7, 0x66, 0x2D, 0x49, 0x48, 0x75, 0x93, 0x04, 0x16, 0xEB,
+    0x93, 0x6D, 0x4A, 0xFF, 0x39, 0x04, 0x6C, 0x03, 0x4C, 0xE1, 0x8C, 0xEE, 0xC9, 0x42, 0x7E, 0xE7,
+    0x93, 0x3D, 0x53, 0x59, 0xC2, 0x7C, 0x09, 0x8C, 0x80, 0xCC, 0x03, 0x9B, 0x90, 0x7D, 0xC9, 0x43,
+    0xD9, 0xAE, 0xAC, 0x27, 0x90, 0x77, 0xCC, 0x7B, 0xFD, 0xF6, 0xC4, 0x7A, 0x72, 0x18, 0xC3, 0x08,
+    0x26, 0x30, 0x83, 0x1E, 0x7A, 0x38, 0xE4, 0xF2, 0xF4, 0xF7, 0x63, 0x29, 0xDE, 0x2D, 0xE0, 0x0A,
+    0x6C, 0xC2, 0xC7, 0xD9, 0x68, 0x29, 0x9A, 0x95, 0x03, 0xA0, 0x45, 0xA4, 0x2F, 0x45, 0xE4, 0x05,
+    0x5F, 0x30, 0xB9, 0xA2, 0xA3, 0x79, 0xB6, 0x1A, 0x73, 0xF9, 0x73, 0x26, 0xAC, 0xA7, 0xD5, 0x39,
+    0x3F, 0x6C, 0xA0, 0xAB, 0x41, 0xB5, 0xE9, 0xBC, 0x25, 0x29, 0x7B, 0x3F, 0x5D, 0x3D, 0xA8, 0xF9,
+    0x12, 0x4A, 0x39, 0xFE, 0x3C, 0x0C, 0x2E, 0x9B, 0xF1, 0xC9, 0x8D, 0x39, 0xED, 0xB0, 0x75, 0xA6,
+    0xCD, 0x3A, 0x2B, 0x56, 0x8C, 0x54, 0xEE, 0xD9, 0xEF, 0xBE, 0xF0, 0x4A, 0xD0, 0xAF, 0x7C, 0xFE,
+    0xF5, 0x1B, 0x2D, 0xEF, 0xD6, 0xFF, 0xCE, 0x4F, 0x98, 0xFA, 0xD2, 0x17, 0x14, 0xDE, 0x05, 0x57,
+    0xBB, 0xC6, 0x44, 0x1D, 0x74, 0xCC, 0x5A, 0x15, 0x55, 0x47, 0xCF, 0x8C, 0x09, 0x23, 0xC6, 0x14,
+    0xE4, 0xB8, 0x27, 0x5C, 0x6D, 0xBD, 0x79, 0xE5, 0x99, 0xA0, 0x1B, 0x25, 0x2F, 0x46, 0x5A, 0xC6,
+    0x9F, 0xE3, 0xD8, 0xAD, 0xC0, 0x55, 0x27, 0x6E, 0x5A, 0x72, 0x37, 0xB2, 0x74, 0x10, 0x06, 0xFD,
+    0x55, 0x8A, 0x97, 0x45, 0xB1, 0x64, 0xDA, 0xEA, 0x88, 0xAB, 0x75, 0xA4, 0x44, 0x75, 0xCC, 0xA0,
+    0x57, 0x2D, 0xCC, 0x74, 0x03, 0x63, 0xEB, 0xA1, 0xCC, 0x81, 0xFC, 0x10, 0x70, 0x1D, 0x60, 0x23,
+    0x60, 0xC3, 0x8A, 0x7A, 0xE7, 0x07, 0x36, 0x25, 0xB1, 0x2F, 0x80, 0x4C, 0x3A, 0x70, 0x32, 0xEC,
+    0xD7, 0x94, 0xFC, 0x0B, 0x4B, 0x4A, 0x7A, 0x66, 0x59, 0xCC, 0xA2, 0x09, 0xD6, 0xBB, 0x7A, 0xC4,
+    0x58, 0x45, 0x7A, 0x57, 0x67, 0x71, 0x82, 0xB9, 0x15, 0xC8, 0x37, 0x60, 0x2F, 0x82, 0x24, 0x36,
+    0xBB, 0x0A, 0x26, 0x90, 0xC5, 0x34, 0xF6, 0x28, 0xED, 0xC2, 0xB4, 0x47, 0xED, 0x3F, 0xC7, 0xCF,
+    0xB5, 0xFE, 0x43, 0xDD, 0xC0, 0xD8, 0xD5, 0x50, 0x16, 0x40, 0x3E, 0x03, 0x5C, 0x0B, 0xD9, 0xB5,
+    0xBB, 0x35, 0x5A, 0xC4, 0xAF, 0x96, 0xFE, 0x2B, 0xAC, 0x7F, 0x76, 0xEF, 0xFA, 0xC7, 0x69, 0xFD,
+    0x9F, 0xBA, 0x53, 0x69, 0x59, 0xB2, 0x76, 0xB8, 0xF5, 0x33, 0xD7, 0x0F, 0x85, 0x78, 0x59, 0x90,
+    0x2F, 0xAB, 0x9D, 0x16, 0xD5, 0x91, 0x57, 0xD0, 0x33, 0x06, 0xF6, 0xE8, 0x80, 0x14, 0x81, 0xE4,
+    0x8F, 0x7B, 0xC0, 0xBD, 0x01, 0x60, 0x7A, 0x00, 0xDD, 0x0E, 0xDE, 0xD5, 0x4A, 0x89, 0x30, 0xD9,
+    0x03, 0x54, 0x2C, 0x01, 0x13, 0xF2, 0x1A, 0x5C, 0xED, 0x3C, 0x8C, 0x31, 0xCD, 0xA0, 0x97, 0xEF,
+    0x97, 0x2A, 0x97, 0xBA, 0x94, 0xBA, 0x14, 0xCF, 0x8A, 0xEA, 0x41, 0x44, 0x52, 0x8C, 0xF1, 0xE0,
+    0x29, 0xD1, 0x79, 0x60, 0x10, 0xD5, 0x46, 0xF5, 0x46, 0x98, 0xFA, 0xFF, 0xA1, 0xCB, 0xFF, 0x57,
+    0xDC, 0xAD, 0x00, 0xBB, 0x07, 0xA0, 0x05, 0x28, 0xFC, 0x70, 0x22, 0x4B, 0x0F, 0x76, 0x01, 0xEA,
+    0x47, 0xCD, 0x43, 0x6C, 0x16, 0xF6, 0xB1, 0xA7, 0x1E, 0x7D, 0x37, 0x96, 0x8D, 0x13, 0xDD, 0xB1,
+    0x1B, 0xCF, 0x0C, 0x96, 0x39, 0x0E, 0x26, 0x3A, 0x6B, 0x86, 0x83, 0xB5, 0x36, 0xF0, 0x40, 0x8B,
+    0x2C, 0x73, 0xF1, 0x22, 0xF2, 0x98, 0x5C, 0x9D, 0xE4, 0xDA, 0x17, 0x3C, 0x68, 0x7D, 0xB4, 0xDE,
+    0x5E, 0x8A, 0x9B, 0xBA, 0x51, 0xBE, 0xFB, 0x3B, 0x74, 0xB0, 0x0B, 0xBB, 0x50, 0x40, 0x01, 0xD6,
+    0xE3, 0x92, 0xB7, 0xD1, 0x40, 0x0B, 0x2D, 0xEC, 0xC2, 0x64, 0xF5, 0xB1, 0xBB, 0xF7, 0x63, 0xD5,
+    0xC2, 0xE4, 0xD4, 0xC7, 0x73, 0x11, 0x59, 0x32, 0x1F, 0x6C, 0x19, 0xC9, 0x4A, 0x25, 0x4B, 0x96,
+    0x54, 0xD4, 0xF1, 0xF9, 0x49, 0xFE, 0x5A, 0x0D, 0x67, 0xF7, 0xAF, 0x62, 0xA4, 0x87, 0xFD, 0xFD,
+    0x7B, 0x0C, 0x62, 0x26, 0x98, 0x9B, 0xE2, 0x75, 0x93, 0x45, 0x75, 0xCA, 0x8B, 0xA8, 0x06, 0x8F,
+    0x23, 0x66, 0x91, 0x96, 0x9E, 0x09, 0x47, 0x14, 0x4C, 0x2B, 0xEB, 0xFF, 0xF9, 0x4B, 0xB7, 0xDA,
+    0xD9, 0xBB, 0x61, 0xDE, 0x97, 0xD1, 0x75, 0xF6, 0x4F, 0x87, 0x49, 0x74, 0x48, 0xCE, 0x05, 0x13,
+    0x60, 0xC1, 0xB1, 0xF7, 0x5E, 0xCA, 0xD3, 0xD2, 0x17, 0x0B, 0x35, 0x7F, 0x55, 0x47, 0xF2, 0x4A,
+    0x37, 0x14, 0x98, 0x40, 0x89, 0xF1, 0x8C, 0xB1, 0x9E, 0x5D, 0x9C, 0xE7, 0x10, 0x1B, 0x98, 0x61,
+    0xDA, 0xF5, 0x1E, 0x2D, 0xD2, 0xC1, 0xFC, 0x6E, 0xBB, 0xA2, 0x48, 0x9F, 0x3C, 0x35, 0x2B, 0x5A,
+    0xAD, 0x27, 0xA9, 0x59, 0x2D, 0x42, 0x72, 0x3A, 0x92, 0x32, 0x4B, 0x41, 0xE6, 0x01, 0x83, 0xCA,
+    0x22, 0x29, 0x93, 0xA2, 0xE1, 0x79, 0x69, 0x74, 0xD4, 0x8D, 0x6E, 0x74, 0xD0, 0xC1, 0x78, 0xE3,
+    0xAD, 0x77, 0xDE, 0xFA, 0xA2, 0x36, 0x3F, 0x96, 0x4A, 0xCB, 0x77, 0x2B, 0x9E, 0xCC, 0x87, 0xA3,
+    0x33, 0xBE, 0x00, 0xE3, 0x09, 0x94, 0x1D, 0x94, 0x57, 0x80, 0x2B, 0xC3, 0xB8, 0x93, 0x44, 0xA3,
+    0x69, 0x40, 0xFD, 0x7C, 0xE4, 0x85, 0x5D, 0xDC, 0x8D, 0x70, 0x88, 0xFD, 0xB6, 0x9F, 0x61, 0xDE,
+    0xF9, 0x0F, 0xF7, 0x90, 0x67, 0x1E, 0x8B, 0x60, 0x75, 0x04, 0xA7, 0x23, 0xAC, 0xBD, 0x97, 0xBC,
+    0x1E, 0xB4, 0x2C, 0x7E, 0x3A, 0x01, 0x2F, 0x38, 0x6F, 0xBF, 0x59, 0xD4, 0x46, 0xA4, 0xCA, 0xE4,
+    0xBB, 0x15, 0x17, 0x73, 0x78, 0xA0, 0x80, 0x87, 0xC7, 0x0F, 0xC0, 0x78, 0x96, 0x5C, 0xFF, 0xB2,
+    0x5E, 0x39, 0xCF, 0x64, 0xB2, 0x80, 0x75, 0xB9, 0x3A, 0x58, 0x03, 0xEB, 0x07, 0x4D, 0x4F, 0xB7,
+    0xE2, 0x6D, 0xFE, 0xFB, 0x5F, 0x85, 0xB9, 0x2C, 0xD0, 0xF2, 0xF5, 0x1E, 0x17, 0x74, 0x64, 0x17,
+    0x1B, 0xB2, 0x96, 0x02, 0xEB, 0xE9, 0x29, 0xD1, 0x0D, 0x1D, 0xAE, 0x36, 0x81, 0x5D, 0x0A, 0xB2,
+    0x68, 0xA5, 0x9E, 0x76, 0x73, 0xD1, 0x12, 0xB9, 0x0F, 0x10, 0x0F, 0xFF, 0x38, 0x0E, 0x52, 0x38,
+    0x1E, 0x8E, 0xA7, 0xF1, 0xC3, 0x56, 0x76, 0x36, 0x32, 0xCA, 0x97, 0xB8, 0xFC, 0xCB, 0xDE, 0x7C,
+    0x4B, 0xC7, 0xEC, 0x0D, 0x3A, 0xA4, 0x1A, 0x51, 0xD6, 0x39, 0xB9, 0xB7, 0xDE, 0x06, 0xDD, 0xE8,
+    0x48, 0x4B, 0xC7, 0x84, 0x5D, 0x8A, 0x07, 0x0A, 0xDC, 0x1B, 0xD6, 0x6B, 0xD1, 0x0D, 0xCB, 0x55,
+    0x18, 0xB0, 0x56, 0x01, 0xD3, 0x25, 0x28, 0x91, 0x88, 0x5A, 0xB0, 0xF8, 0xA0, 0xEA, 0xC8, 0xBF,
+    0x48, 0x8F, 0x7E, 0xD7, 0xCF, 0x60, 0x19, 0xC7, 0x30, 0xDE, 0x2D, 0x20, 0x7F, 0x42, 0x44, 0xC4,
+    0xCF, 0x45, 0x24, 0x66, 0x77, 0xB6, 0xB7, 0xB7, 0x92, 0x77, 0x55, 0x54, 0x2B, 0xF5, 0x9F, 0xCC,
+    0xC9, 0x14, 0x1E, 0xC0, 0x05, 0x0A, 0xB2, 0xE5, 0xF6, 0x1C, 0x4A, 0x59, 0x0E, 0x1A, 0x74, 0xB5,
+    0xD1, 0xC0, 0xFD, 0x1D, 0x1C, 0x2D, 0xD1, 0x4D, 0x89, 0xAD, 0xCB, 0x8B, 0x39, 0xBB, 0x93, 0xB1,
+    0xEA, 0x27, 0x23, 0xDB, 0x8C, 0x8F, 0xE6, 0x55, 0x21, 0x2D, 0x6A, 0x31, 0x10, 0x3E, 0xE3, 0x61,
+    0xA6, 0xBF, 0xDF, 0x51, 0x4A, 0xC0, 0x2D, 0x81, 0xEA, 0x37, 0xBE, 0x6E, 0xD3, 0x30, 0xEC, 0x73,
+    0x52, 0x08, 0x1B, 0x00, 0x96, 0x95, 0x53, 0xC2, 0xAF, 0x85, 0xAC, 0x76, 0xD0, 0x8A, 0x11, 0x68,
+    0x86, 0x98, 0xA5, 0x1E, 0xCC, 0x42, 0x58, 0x97, 0xAB, 0xE4, 0x15, 0xD6, 0xA3, 0x23, 0xF4, 0x30,
+    0xE6, 0xD4, 0xEB, 0xA4, 0x0F, 0x8B, 0xF7, 0xBE, 0x86, 0xF9, 0x82, 0xB9, 0x54, 0xA7, 0x57, 0x78,
+    0x86, 0xDF, 0x05, 0xA0, 0x55, 0x29, 0x70, 0x6A, 0x92, 0x56, 0x73, 0x3F, 0x4C, 0xAE, 0x40, 0x3E,
+    0xC4, 0xEB, 0xEA, 0xF4, 0x1F, 0xFD, 0xFF, 0x15, 0x2A, 0x5B, 0x0C, 0x50, 0x59, 0x7F, 0x2A, 0x02,
+    0x3B, 0xBE, 0x1E, 0x02, 0x94, 0x37, 0x49, 0x8D, 0x45, 0xC0, 0x34, 0x9B, 0x49, 0xCB, 0x54, 0x00,
+    0x3B, 0xF5, 0x7B, 0xBE, 0xFF, 0xEB, 0xC4, 0xCD, 0xCC, 0x69, 0xDC, 0xAC, 0x4F, 0xB8, 0xD9, 0xE9,
+    0xB9, 0xDE, 0x8B, 0x5F, 0x4C, 0xFF, 0x10, 0xEB, 0xF3, 0x13, 0xBC, 0x69, 0x76, 0x2F, 0x7E, 0x71,
+    0x77, 0x01, 0x94, 0xD2, 0x83, 0x7E, 0x7B, 0x27, 0xC2, 0x2E, 0xA5, 0xC7, 0x06, 0x16, 0x30, 0xC3,
+    0x36, 0x38, 0xCF, 0x14, 0x3A, 0x74, 0x24, 0xAF, 0xD8, 0x23, 0x8B, 0x98, 0x26, 0x93, 0x8E, 0x43,
+    0xE6, 0xE2, 0x93, 0x65, 0xEF, 0x18, 0x14, 0xD4, 0x39, 0x1B, 0xC0, 0xDD, 0xEE, 0x00, 0x59, 0x00,
+    0xD9, 0x9D, 0xE3, 0x20, 0x28, 0x7F, 0x76, 0xA9, 0x84, 0xCE, 0x1D, 0xE8, 0xD0, 0xE2, 0x4C, 0xCD,
+    0x64, 0x93, 0xEC, 0xCD, 0x06, 0xF7, 0x46, 0x47, 0x29, 0xBD, 0x6A, 0x75, 0x6B, 0xBC, 0x8E, 0x1B,
+    0x38, 0xDF, 0x51, 0xE8, 0xC0, 0x2C, 0x3F, 0x76, 0x68, 0x26, 0xA0, 0x23, 0x55, 0x81, 0xFB, 0x93,
+    0x96, 0x52, 0x60, 0xE3, 0xEA, 0x31, 0xB9, 0x5A, 0x44, 0x1A, 0xAC, 0xC8, 0x02, 0xB2, 0xC6, 0xD5,
+    0xE0, 0xAA, 0x5D, 0x60, 0x33, 0x8B, 0x90, 0xB6, 0xDB, 0xD6, 0x25, 0x30, 0xA2, 0x83, 0x24, 0x4C,
+    0xB6, 0x2E, 0x80, 0x11, 0x3D, 0xA8, 0xA8, 0x1B, 0x70, 0x55, 0x5E, 0xC3, 0x84, 0x5D, 0xD0, 0x4D,
+    0x16, 0xA1, 0xC0, 0x79, 0x1E, 0x6D, 0x19, 0xA3, 0xDF, 0xA8, 0x55, 0x47, 0xDE, 0x33, 0x5D, 0x52,
+    0xD6, 0x46, 0x3A, 0xCE, 0x0D, 0x1A, 0x39, 0x61, 0x01, 0x29, 0x18, 0x4C, 0x5E, 0x4D, 0x7B, 0x2F,
+    0x5A, 0xCA, 0xBC, 0x4B, 0x22, 0x61, 0x6F, 0x46, 0x88, 0x25, 0x5C, 0xD4, 0x0D, 0xDA, 0x8F, 0xE0,
+    0x8A, 0xF1, 0xD8, 0x6A, 0x06, 0xD1, 0xD5, 0x3C, 0x48, 0x8B, 0x0E, 0xF9, 0xDF, 0x67, 0x92, 0xC5,
+    0x1F, 0xBC, 0x51, 0x15, 0x7B, 0x65, 0xD4, 0xF2, 0x52, 0x4F, 0x31, 0x3B, 0x93, 0x00, 0x01, 0xE2,
+    0xE0, 0x27, 0x68, 0x0F, 0x3C, 0xFF, 0xAB, 0x80, 0x23, 0xFE, 0x17, 0x05, 0x47, 0xFA, 0xF7, 0x81,
+    0x23, 0x26, 0x30, 0x97, 0x95, 0x0F, 0x93, 0xDC, 0xD6, 0x5D, 0x80, 0xBA, 0x04, 0xD8, 0x9B, 0x9F,
+    0x1C, 0xF5, 0x93, 0xED, 0xF7, 0xD9, 0x2B, 0x82, 0xAB, 0x67, 0x8C, 0x74, 0xA3, 0xA2, 0xAB, 0xAC,
+    0x9F, 0x30, 0xCE, 0xDE, 0xDE, 0xEE, 0x9C, 0x48, 0x18, 0x6F, 0xEF, 0xD0, 0x32, 0x33, 0x5E, 0x37,
+    0x05, 0xAE, 0xEA, 0xD8, 0xD4, 0x41, 0xC5, 0x1C, 0x9B, 0x7C, 0x59, 0x22, 0x58, 0xCF, 0x43, 0x23,
+    0x94, 0x34, 0x18, 0x01, 0x7B, 0xF5, 0x6F, 0x15, 0x1C, 0x5A, 0x26, 0x04, 0xC4, 0xB3, 0xD2, 0xF1,
+    0x83, 0x10, 0x24, 0x96, 0x24, 0x55, 0x9E, 0x64, 0x81, 0x47, 0xF8, 0x25, 0xC1, 0xA1, 0x27, 0x5C,
+    0xAD, 0x5F, 0xB9, 0x15, 0x90, 0xEF, 0x45, 0xCA, 0x36, 0x05, 0xA7, 0x5C, 0x1C, 0x7C, 0x38, 0x07,
+    0x98, 0x53, 0x4A, 0xF4, 0x6F, 0xD0, 0x77, 0x53, 0xF3, 0x1E, 0x8C, 0x2C, 0x86, 0xB7, 0x8C, 0x5F,
+    0x3D, 0xD9, 0x6A, 0x65, 0xA6, 0xD6, 0x8F, 0xCF, 0x78, 0xF6, 0xAD, 0x25, 0x25, 0x1D, 0x9D, 0x0E,
+    0x3A, 0xE4, 0xE4, 0xCC, 0xE8, 0xB3, 0x68, 0x1B, 0xF3, 0x63, 0xA9, 0x9C, 0xEC, 0xB2, 0xF6, 0x68,
+    0xDA, 0x4A, 0xC6, 0x89, 0x41, 0xF7, 0x07, 0xB4, 0x54, 0xAB, 0x23, 0xAE, 0x9A, 0x34, 0xEA, 0xC3,
+    0xEF, 0x05, 0x82, 0x6A, 0x8A, 0x25, 0x99, 0xD4, 0x94, 0x1D, 0x88, 0x67, 0xEE, 0x41, 0x3C, 0xEF,
+    0x7A, 0xD4, 0xBB, 0x3E, 0xBB, 0xED, 0xC9, 0x5E, 0x0F, 0xE6, 0x9B, 0x1E, 0xFD, 0x52, 0x70, 0x4F,
+    0x78, 0xCC, 0xAD, 0x26, 0x77, 0x1E, 0x7B, 0xAB, 0x19, 0xB9, 0x1A, 0x77, 0x29, 0x5E, 0x71, 0x35,
+    0x2E, 0x8B, 0xD1, 0xD5, 0x14, 0xEA, 0xAD, 0xC6, 0xD5, 0x8C, 0x79, 0xC7, 0xBB, 0x8A, 0x11, 0x52,
+    0xE5, 0x15, 0x13, 0x84, 0xBC, 0xE2, 0x80, 0x43, 0x72, 0x68, 0xB9, 0x42, 0x81, 0x8A, 0x9C, 0xA3,
+    0xE0, 0xFE, 0x25, 0xA8, 0x79, 0x5B, 0x0A, 0x98, 0x01, 0xD9, 0x19, 0xD0, 0x9F, 0xB4, 0xF1, 0x29,
+    0x96, 0x4B, 0xDE, 0xE8, 0x49, 0xE2, 0xE4, 0xB9, 0x13, 0x4C, 0x5A, 0xB7, 0x99, 0x34, 0x08, 0x08,
+    0x45, 0xC3, 0x07, 0x5B, 0xFD, 0x67, 0xA8, 0x57, 0xEA, 0x1F, 0x05, 0x1E, 0x9E, 0x3C, 0xB8, 0x49,
+    0x76, 0xEB, 0xD6, 0x0B, 0x9E, 0xCD, 0xCD, 0xCB, 0x07, 0xE8, 0x67, 0xBE, 0x65, 0x6B, 0x2E, 0x8F,
+    0x43, 0x8B, 0xD3, 0xBD, 0x3B, 0x43, 0x53, 0x56, 0xF1, 0xEE, 0xAE, 0x8E, 0x6E, 0x47, 0xFC, 0x08,
+    0xB9, 0x1D, 0x55, 0xE5, 0xFA, 0x13, 0xD8, 0xF1, 0xFA, 0xB1, 0xDA, 0x49, 0xAF, 0x2F, 0xDF, 0xA3,
+    0x13, 0xD6, 0xA5, 0xBE, 0xD7, 0x84, 0xBF, 0xD7, 0xA4, 0xFF, 0xAC, 0xD7, 0x46, 0x6A, 0x2B, 0xF1,
+    0x94, 0x55, 0xFF, 0x1C, 0x18, 0xEF, 0x80, 0x3E, 0x0B, 0x60, 0x5F, 0xEB, 0x80, 0x62, 0xC1, 0x49,
+    0xF0, 0xC0, 0x2A, 0xC6, 0x4A, 0xCC, 0x99, 0x32, 0x84, 0xBF, 0x64, 0x6F, 0xD4, 0xC0, 0x66, 0x0F,
+    0xB8, 0xC7, 0x3D, 0xA8, 0x38, 0x03, 0x46, 0x26, 0x80, 0xF5, 0x63, 0x20, 0xEA, 0x06, 0x36, 0x28,
+    0x41, 0xBF, 0xF6, 0xA9, 0x08, 0x22, 0x52, 0x91, 0xEF, 0xEF, 0x77, 0xE8, 0x86, 0xBC, 0x4E, 0x38,
+    0x8B, 0xAB, 0x70, 0x3E, 0x8B, 0xB0, 0x50, 0xF3, 0xAB, 0xEC, 0x2C, 0xA6, 0x42, 0x2E, 0xE1, 0x78,
+    0x79, 0x67, 0xF9, 0x08, 0x05, 0x97, 0x29, 0x55, 0x24, 0x17, 0x7F, 0xA2, 0x76, 0x80, 0xBC, 0xBD,
+    0xCE, 0x5C, 0x62, 0xD6, 0x15, 0x8D, 0x09, 0x26, 0xB8, 0xDA, 0xF8, 0x02, 0xEB, 0xC7, 0xB8, 0x7A,
+    0x97, 0xBC, 0x9A, 0x51, 0x32, 0x63, 0x4A, 0xCF, 0x92, 0x5E, 0xFF, 0xE7, 0x07, 0x8E, 0x9E, 0xDA,
+    0x98, 0x4C, 0x17, 0x45, 0x2C, 0x9A, 0xDC, 0xAB, 0xC1, 0x59, 0x39, 0x0F, 0xEC, 0x99, 0x06, 0x5C,
+    0xB3, 0x04, 0x66, 0xF6, 0x5E, 0xB7, 0xEC, 0x6F, 0x81, 0xF0, 0x35, 0xB6, 0x28, 0x9E, 0x69, 0x29,
+    0x2F, 0x45, 0x36, 0x56, 0x59, 0xBA, 0x5F, 0x17, 0xC1, 0xF7, 0x1A, 0x56, 0xD8, 0x49, 0xA0, 0xB1,
+    0xED, 0x19, 0x01, 0x46, 0x52, 0x14, 0xF9, 0xDD, 0x5A, 0xD7, 0xA0, 0x5F, 0x4E, 0xF1, 0xEC, 0xF7,
+    0x07, 0xFD, 0x37, 0x4B, 0xF0, 0x4F, 0xB9, 0xB6, 0x05, 0xB4, 0x4E, 0x7A, 0xA0, 0x33, 0xB2, 0x00,
+    0x0E, 0x3F, 0x99, 0x38, 0x94, 0xFC, 0xB3, 0xD1, 0xF6, 0x14, 0x60, 0x84, 0xAB, 0xA9, 0xD9, 0xC0,
+    0x04, 0xAE, 0x53, 0x90, 0x45, 0x36, 0xC9, 0xA1, 0x67, 0x87, 0xA2, 0xCB, 0x44, 0xA4, 0x2A, 0x97,
+    0x7A, 0x15, 0x3C, 0x03, 0x99, 0x3C, 0x2A, 0x95, 0x11, 0x79, 0x37, 0xDA, 0xA6, 0x08, 0x23, 0xD3,
+    0xE8, 0xE0, 0x2E, 0x35, 0x59, 0xB4, 0x37, 0x23, 0xAD, 0x0D, 0x1D, 0xB3, 0x3C, 0xEC, 0x52, 0x4E,
+    0x7D, 0x41, 0xB1, 0xAC, 0xAC, 0x77, 0x2D, 0x3A, 0xBA, 0x0E, 0x7A, 0x3B, 0xE5, 0x42, 0xF1, 0xA5,
+    0x2F, 0x36, 0x3B, 0x46, 0x6E, 0x88, 0x20, 0x75, 0xBE, 0x40, 0x9D, 0x86, 0xD7, 0xCF, 0xE1, 0xD1,
+    0xDE, 0x42, 0xC1, 0x15, 0x98, 0x7E, 0xDA, 0x27, 0xFB, 0xCD, 0x7D, 0xF7, 0xC4, 0xE0, 0x22, 0x61,
+    0x5D, 0x44, 0x50, 0x2D, 0x13, 0xAC, 0x27, 0x52, 0xA2, 0xAB, 0x53, 0x81, 0x59, 0x05, 0xCC, 0xA8,
+    0xD0, 0x22, 0x35, 0x4E, 0x16, 0x29, 0xE4, 0xCD, 0x4E, 0xC5, 0x71, 0xAA, 0xA6, 0xC3, 0x61, 0x02,
+    0x13, 0x8A, 0xEA, 0xEF, 0x36, 0x56, 0x44, 0x98, 0x0F, 0x8E, 0x2B, 0x70, 0x86, 0x8F, 0x10, 0x5C,
+    0xFD, 0x30, 0xBD, 0xAD, 0x8D, 0x34, 0xDC, 0x7F, 0x0C, 0x25, 0x2B, 0xA9, 0x39, 0x5A, 0x30, 0xD6,
+    0x8D, 0xAD, 0xC7, 0x2A, 0x9A, 0x30, 0x56, 0x9D, 0x0E, 0x47, 0xEC, 0x4A, 0x65, 0xA5, 0x62, 0x91,
+    0x90, 0x96, 0x19, 0x1F, 0x31, 0xCD, 0x4E, 0x55, 0x4A, 0x50, 0xD2, 0x0C, 0x11, 0xCD, 0x36, 0x28,
+    0x59, 0x82, 0x48, 0x4F, 0x59, 0xB9, 0x46, 0xD7, 0x94, 0x9C, 0x4B, 0x98, 0xCA, 0x09, 0xFC, 0xE8,
+    0x81, 0x7E, 0x6D, 0x7B, 0xFB, 0x29, 0x2F, 0x22, 0x7D, 0xB1, 0xBF, 0x3F, 0xBF, 0xD4, 0x90, 0xC5,
+    0x5D, 0x18, 0x1B, 0x8F, 0xF5, 0x13, 0x54, 0x67, 0x02, 0x53, 0xCA, 0xAA, 0xA8, 0x95, 0x48, 0xC0,
+    0xC8, 0x49, 0x88, 0x8D, 0x59, 0x92, 0x4B, 0x74, 0xF5, 0xC2, 0x90, 0xD7, 0xE8, 0x06, 0xD5, 0x71,
+    0xFF, 0x92, 0xE9, 0x97, 0xAB, 0xA5, 0xF1, 0x7D, 0x16, 0x7B, 0xD5, 0x8E, 0xE8, 0x5D, 0xDD, 0xEB,
+    0x77, 0x7B, 0xCA, 0x36, 0x2D, 0x4D, 0x55, 0xE7, 0xE1, 0xC8, 0x36, 0xE9, 0x74, 0xF5, 0xEE, 0xF4,
+    0xE1, 0xFA, 0x9B, 0x5F, 0xF5, 0x79, 0x55, 0xB9, 0xD0, 0xD3, 0xE7, 0xDE, 0x56, 0xED, 0xA9, 0x99,
+    0x95, 0xD4, 0x4A, 0x84, 0xB1, 0x6E, 0x0D, 0x79, 0x0D, 0x1D, 0xE4, 0x35, 0x3B, 0x1D, 0xD3, 0x2F,
+    0x57, 0xE5, 0xD3, 0xD1, 0xF9, 0x42, 0x47, 0x13, 0x46, 0xF4, 0xBA, 0x29, 0x29, 0xE7, 0x1E, 0x09,
+    0x03, 0xA7, 0x07, 0x85, 0x01, 0xE5, 0xA5, 0x16, 0x40, 0x2D, 0xDC, 0x10, 0x0C, 0x8D, 0xDF, 0x1F,
+    0x47, 0xA8, 0xAB, 0x29, 0x04, 0xCA, 0xA3, 0x96, 0x68, 0x7A, 0xA6, 0x8D, 0x5D, 0x32, 0x8D, 0x7C,
+    0x29, 0xE8, 0x60, 0x7E, 0x58, 0x63, 0xEB, 0x9C, 0x5D, 0xC0, 0x31, 0xD3, 0x01, 0xD8, 0xD0, 0x71,
+    0x0C, 0xB0, 0xE9, 0x3E, 0x1F, 0x01, 0xAE, 0x8F, 0x5C, 0x3A, 0x7F, 0x6F, 0xB7, 0xC9, 0xEB, 0x4A,
+    0x07, 0x65, 0x31, 0xDD, 0xA9, 0x00, 0x17, 0xBA, 0x12, 0xE0, 0xC8, 0x84, 0x5D, 0xC0, 0xC6, 0x9C,
+    0x1E, 0x98, 0x32, 0xCB, 0x5A, 0x30, 0xAD, 0x6E, 0x74, 0x84, 0x69, 0xED, 0x2A, 0xDB, 0x60, 0x3A,
+    0x26, 0xB8, 0xC0, 0xBC, 0xB6, 0x42, 0x11, 0x4C, 0x87, 0xF4, 0x14, 0xA7, 0x75, 0xC2, 0xD6, 0x87,
+    0x00, 0x4A, 0x13, 0x01, 0x13, 0x8F, 0x00, 0x3E, 0x6E, 0x6A, 0x7E, 0xD2, 0xF5, 0x1B, 0x8B, 0x77,
+    0xD6, 0xD8, 0xE2, 0xC8, 0x36, 0xBA, 0x2D, 0x2B, 0xE7, 0xFB, 0xE3, 0xB7, 0xEF, 0xAB, 0x28, 0xA4,
+    0x51, 0x22, 0x8D, 0xF5, 0xCE, 0x8F, 0x28, 0xAA, 0xC8, 0xAE, 0xAA, 0x55, 0x4C, 0xE2, 0x72, 0x88,
+    0x7A, 0x2A, 0x50, 0x2E, 0xE1, 0xDA, 0x12, 0xD4, 0x22, 0x81, 0x8B, 0x3A, 0x6E, 0xE1, 0xBE, 0x50,
+    0x73, 0x58, 0x62, 0xE2, 0x9C, 0x39, 0x22, 0x2D, 0xF3, 0x45, 0xC2, 0x32, 0xCE, 0xAB, 0xCA, 0xF9,
+    0x9E, 0x3E, 0xF7, 0xAE, 0x8A, 0xA7, 0x28, 0x35, 0x52, 0x69, 0x59, 0x70, 0xA0, 0xE3, 0x6F, 0x51,
+    0x24, 0x1D, 0x30, 0x23, 0x3B, 0x82, 0x79, 0x4C, 0x79, 0xF8, 0x5D, 0x85, 0x09, 0xD7, 0x99, 0x39,
+    0x5F, 0xD4, 0x73, 0x69, 0x32, 0x69, 0x57, 0x82, 0x92, 0xE0, 0x48, 0x4A, 0x91, 0xC6, 0x78, 0xD5,
+    0x71, 0x9D, 0x3D, 0x1C, 0x79, 0xCD, 0x96, 0x69, 0x06, 0xB8, 0x73, 0x0F, 0x70, 0xAF, 0x82, 0x92,
+    0x06, 0x98, 0x56, 0x43, 0xC9, 0xC6, 0x20, 0xFB, 0x15, 0xCE, 0x5F, 0x44, 0x75, 0x3A, 0x52, 0x52,
+    0xD6, 0x45, 0x50, 0x22, 0xED, 0xE0, 0xA7, 0x54, 0x80, 0x88, 0x30, 0x15, 0xF1, 0x1B, 0xD8, 0xE0,
+    0x30, 0x41, 0x57, 0xA6, 0x49, 0x78, 0x83, 0x3E, 0xF5, 0xC8, 0x04, 0x98, 0xB7, 0x83, 0xF5, 0x32,
+    0xCD, 0xE0, 0xD4, 0x8F, 0x07, 0xE7, 0xC6, 0x84, 0xDF, 0x46, 0x47, 0x1B, 0xB2, 0x56, 0xC9, 0x97,
+    0x5A, 0x72, 0x69, 0xE1, 0xB3, 0x15, 0x40, 0xB6, 0xFF, 0xD5, 0x14, 0x71, 0x03, 0x7C, 0x6C, 0xFF,
+    0x27, 0x4A, 0x82, 0x95, 0xA8, 0xA5, 0x53, 0xF3, 0x57, 0x99, 0x77, 0x2B, 0xBF, 0x3A, 0x92, 0x75,
+    0xD0, 0x93, 0x2D, 0xA0, 0x44, 0x0B, 0xB8, 0x5A, 0x7F, 0xD7, 0x63, 0x82, 0x7E, 0xA9, 0x21, 0x8B,
+    0xFA, 0xC5, 0x0E, 0x7A, 0x1D, 0xD2, 0x01, 0x2E, 0x20, 0xFF, 0x84, 0x77, 0x1E, 0xFB, 0xB2, 0xD7,
+    0x0D, 0xD9, 0xBB, 0x5E, 0xB5, 0x20, 0x9E, 0x43, 0x28, 0x6B, 0x0A, 0xC8, 0xEB, 0x13, 0xAF, 0xBF,
+    0x10, 0xEE, 0x97, 0x3A, 0x05, 0x05, 0x09, 0x4A, 0xCD, 0x25, 0x72, 0xF6, 0x14, 0x0C, 0x9E, 0x52,
+    0x96, 0x93, 0x79, 0xA4, 0xCB, 0xA2, 0x6A, 0x75, 0x54, 0x51, 0x37, 0x59, 0xD4, 0x41, 0x37, 0xD6,
+    0xEB, 0xE0, 0xBC, 0xF5, 0xAE, 0x72, 0x3E, 0xA7, 0xA8, 0x0B, 0xA6, 0x75, 0xA1, 0x6E, 0x7F, 0xA2,
+    0x7C, 0xFC, 0x5B, 0x7F, 0x5E, 0x88, 0xEB, 0x5D, 0x67, 0x9B, 0xB4, 0x77, 0xE9, 0x8C, 0xAB, 0x3E,
+    0xF7, 0xC0, 0xD2, 0x35, 0x40, 0x91, 0xC5, 0x9F, 0xC4, 0x80, 0x4C, 0x7A, 0x64, 0xC9, 0xCE, 0x1D,
+    0x8A, 0xE5, 0xA9, 0x80, 0xE4, 0x08, 0x4A, 0x98, 0x57, 0x38, 0x8F, 0x78, 0x74, 0xC3, 0x3B, 0x11,
+    0xD5, 0xD2, 0x76, 0x30, 0xA3, 0xDD, 0x83, 0x92, 0x36, 0xAF, 0x70, 0x4F, 0x47, 0xEB, 0x31, 0x2F,
+    0x46, 0x1D, 0xC9, 0xDE, 0x8E, 0x74, 0x70, 0x14, 0xD9, 0x85, 0x32, 0x52, 0x54, 0xB8, 0x06, 0xEB,
+    0x31, 0xCD, 0xC0, 0x57, 0x3A, 0xAC, 0xF8, 0x75, 0x69, 0x12, 0xDB, 0x61, 0x9D, 0x2D, 0xF2, 0x9B,
+    0x1D, 0xC5, 0x33, 0x2D, 0x0F, 0x66, 0xCD, 0xAF, 0x97, 0x09, 0xE7, 0xD4, 0xC0, 0x82, 0xAC, 0x2F,
+    0x3C, 0x59, 0x2C, 0xEE, 0xF5, 0x8A, 0xB6, 0x20, 0x93, 0xE5, 0xA0, 0x94, 0xE6, 0x95, 0x8B, 0x59,
+    0x87, 0x6E, 0x4D, 0x83, 0xEA, 0x9D, 0x87, 0xBE, 0xA8, 0xA0, 0x2F, 0x81, 0x7E, 0x0F, 0xE8, 0x0F,
+    0x8F, 0x9F, 0x7A, 0x50, 0x5D, 0x0F, 0x59, 0xBB, 0x00, 0x1D, 0x0F, 0xC1, 0x86, 0x29, 0xE4, 0x75,
+    0x59, 0x31, 0x25, 0x6F, 0x4C, 0x8F, 0x11, 0x69, 0x86, 0xEC, 0x9D, 0xAA, 0x48, 0x74, 0x1E, 0xD9,
+    0xA0, 0xDB, 0xB2, 0xB2, 0xF5, 0x75, 0xEE, 0x3D, 0x9F, 0x88, 0x54, 0x2E, 0x4C, 0xE9, 0x39, 0x34,
+    0x41, 0x75, 0x25, 0xFA, 0x7B, 0x2D, 0xF9, 0xE3, 0x9E, 0xDD, 0x82, 0x2C, 0xF6, 0xB8, 0x67, 0x22,
+    0x87, 0x36, 0x98, 0x26, 0xF7, 0x53, 0x4A, 0x89, 0x14, 0x8B, 0x15, 0x12, 0xBB, 0xB6, 0x35, 0x58,
+    0xA0, 0xBF, 0x96, 0x88, 0xD9, 0x1E, 0x30, 0x9B, 0x8B, 0x48, 0x7F, 0xB4, 0xBF, 0xBF, 0xDF, 0xF7,
+    0x40, 0x22, 0xA2, 0xFF, 0x79, 0x88, 0x58, 0xD9, 0x83, 0x79, 0x60, 0x2E, 0x75, 0x59, 0x1D, 0x5A,
+    0xAF, 0xBF, 0xD7, 0x52, 0x8E, 0xC9, 0x7E, 0xF4, 0xDA, 0xF6, 0x74, 0x2E, 0x72, 0xFB, 0x3B, 0xDB,
+    0xBB, 0x1D, 0xF6, 0x5B, 0x9E, 0x6E, 0x46, 0x69, 0x1A, 0xE7, 0x4B, 0x89, 0xCC, 0xBB, 0xC1, 0x85,
+    0xF9, 0xEB, 0x37, 0xE3, 0x37, 0x46, 0xC7, 0x3A, 0x5B, 0xEC, 0xD9, 0x26, 0xEB, 0xCA, 0xCA, 0xD4,
+    0x07, 0xF7, 0x40, 0x53, 0x52, 0x31, 0x97, 0xDA, 0x85, 0xA2, 0x9A, 0x31, 0x36, 0x81, 0x7E, 0x4C,
+    0x16, 0xEF, 0x6C, 0x3F, 0xF5, 0x4D, 0x91, 0x65, 0xB1, 0xBD, 0xDD, 0x76, 0xD8, 0x5B, 0x91, 0xB1,
+    0xF5, 0x3A, 0xE6, 0x75, 0x99, 0x36, 0x63, 0x39, 0x0C, 0xAB, 0xAA, 0xF3, 0xE8, 0xB6, 0xAC, 0xD4,
+    0x22, 0x0F, 0x8C, 0xF5, 0x29, 0x61, 0x5E, 0xAB, 0xC8, 0x44, 0x2A, 0x25, 0xD2, 0x31, 0x63, 0x5A,
+    0x6D, 0x60, 0xA2, 0x83, 0x45, 0xE6, 0x29, 0xEA, 0x21, 0x0B, 0x90, 0xB4, 0xA9, 0x13, 0xA9, 0xCD,
+    0xF2, 0x5A, 0x18, 0xFC, 0xF5, 0x1E, 0x38, 0x5C, 0x83, 0xD2, 0xD4, 0x94, 0x97, 0x22, 0x65, 0x3D,
+    0x67, 0x5E, 0x3B, 0x91, 0x8A, 0xF9, 0x62, 0x50, 0xA2, 0xE7, 0x55, 0x55, 0xEA, 0x98, 0xDF, 0xEC,
+    0x75, 0xF8, 0xF8, 0x29, 0xC3, 0x3D, 0x0F, 0x99, 0x2C, 0xB2, 0x36, 0xF7, 0x8D, 0x6A, 0x61, 0x0C,
+    0xAE, 0x5E, 0xFB, 0x54, 0x63, 0xA5, 0x63, 0x3B, 0xA1, 0xA3, 0xEE, 0x85, 0xDA, 0x7C, 0x3B, 0x9A,
+    0x66, 0xFA, 0x46, 0x63, 0x25, 0x70, 0x66, 0xA5, 0x30, 0xAD, 0xF4, 0x90, 0xED, 0x7F, 0xE5, 0xBD,
+    0x8A, 0xA2, 0x94, 0x6A, 0xBE, 0x2C, 0x16, 0xEC, 0x74, 0xA6, 0x49, 0xD5, 0x35, 0x39, 0x3A, 0x32,
+    0x22, 0x6B, 0x99, 0x41, 0xA7, 0x22, 0xF4, 0x3A, 0xC0, 0xCC, 0x78, 0xD8, 0x75, 0xC0, 0xF8, 0x22,
+    0x50, 0x4E, 0xD2, 0x61, 0x06, 0x17, 0x8E, 0x13, 0x8C, 0xC0, 0xB9, 0x11, 0xF0, 0x8D, 0x0E, 0x90,
+    0x06, 0x98, 0x9F, 0x82, 0x0B, 0xF6, 0xBF, 0x06, 0xB9, 0xC4, 0xF7, 0x65, 0x98, 0x60, 0xA7, 0x72,
+    0x3E, 0xEF, 0x39, 0xC2, 0x06, 0xDD, 0x30, 0x66, 0x8C, 0x8E, 0x3A, 0x50, 0x30, 0x81, 0xD6, 0xD6,
+    0xB8, 0x2A, 0x26, 0xF0, 0xD0, 0x3E, 0x13, 0xE0, 0xE0, 0x0A, 0x98, 0x2F, 0x02, 0xFF, 0x3C, 0x0C,
+    0x19, 0xC2, 0xF9, 0xB0, 0x02, 0xD5, 0xA6, 0xBC, 0xFA, 0xB9, 0xBC, 0xC2, 0x88, 0x87, 0x69, 0xB3,
+    0x2A, 0xE8, 0x53, 0xD5, 0x79, 0xB0, 0xCD, 0x11, 0xB8, 0xB0, 0x00, 0x57, 0x77, 0x7F, 0x8B, 0x9C,
+    0xF8, 0xCC, 0x1A, 0xE4, 0x37, 0x3B, 0xB2, 0xAE, 0xAC, 0xDE, 0xAB, 0x20, 0x61, 0xBD, 0xA5, 0x57,
+    0xE2, 0x6D, 0xC3, 0x21, 0x63, 0x74, 0xA3, 0x1B, 0x4A, 0x46, 0x64, 0xD1, 0x78, 0x5C, 0x75, 0x00,
+    0xAD, 0x03, 0xF7, 0x74, 0x84, 0x83, 0x11, 0xD8, 0x2F, 0xD4, 0x70, 0x25, 0x82, 0xF9, 0x33, 0x60,
+    0x5E, 0x0F, 0xB9, 0xEB, 0x7E, 0x08, 0x0A, 0x74, 0x40, 0x0D, 0x59, 0x59, 0xCC, 0xF2, 0xB8, 0xB0,
+    0x71, 0x55, 0x61, 0xF9, 0x11, 0x28, 0xAA, 0x1E, 0xC4, 0xF4, 0x98, 0xBE, 0x68, 0x70, 0x61, 0x0F,
+    0x7E, 0x9B, 0xCF, 0xFC, 0xED, 0x30, 0x06, 0x80, 0xEB, 0x17, 0x20, 0x7F, 0x26, 0xA2, 0x63, 0x9F,
+    0x54, 0x44, 0x61, 0x02, 0xAA, 0xFE, 0x7B, 0xBF, 0x61, 0x0E, 0x55, 0x67, 0xC0, 0xC4, 0x12, 0x6C,
+    0x9C, 0x43, 0xF2, 0x65, 0xDF, 0x23, 0x30, 0x7F, 0x83, 0xA9, 0xCB, 0x55, 0x6E, 0x6F, 0x8D, 0x2D,
+    0x4A, 0x1D, 0x99, 0x9A, 0xC8, 0x48, 0xDF, 0x5B, 0xA0, 0xF6, 0x8B, 0x25, 0x2D, 0x7F, 0x5A, 0xCE,
+    0xEF, 0x54, 0x68, 0x39, 0xC3, 0xFA, 0x2C, 0x52, 0x62, 0x6B, 0x3A, 0x1E, 0x46, 0x37, 0x6C, 0xAD,
+    0x42, 0x4B, 0x8E, 0x2B, 0x9F, 0x12, 0xEE, 0x9A, 0xBD, 0x3F, 0x45, 0x68, 0xC2, 0x90, 0x82, 0xB2,
+    0xD2, 0xC2, 0x5C, 0xC2, 0xEA, 0xC3, 0x7E, 0x95, 0x00, 0x76, 0x00, 0x1F, 0x07, 0x58, 0x51, 0x32,
+    0x6D, 0xB5, 0xF4, 0xAE, 0x3E, 0xFA, 0x00, 0x63, 0x52, 0xA5, 0x54, 0xDE, 0x70, 0x84, 0x69, 0xC9,
+    0x6B, 0x4A, 0x28, 0xF9, 0x78, 0xA9, 0xDA, 0x52, 0xA2, 0x5D, 0x44, 0xAA, 0x08, 0x11, 0x22, 0x59,
+    0x83, 0xF3, 0x09, 0x01, 0x39, 0x9F, 0xD2, 0x3A, 0xC5, 0xE7, 0x3B, 0x58, 0x61, 0x25, 0x43, 0xF1,
+    0x20, 0x3F, 0xD9, 0x33, 0x5A, 0xA0, 0xA5, 0x67, 0xE7, 0x0E, 0xCC, 0x3B, 0x54, 0x9B, 0x08, 0x9B,
+    0x25, 0x1A, 0xCA, 0xE4, 0xFD, 0x3A, 0x0F, 0x79, 0x85, 0x6E, 0xC0, 0xFA, 0xE3, 0xEF, 0x1C, 0x7D,
+    0x2D, 0x7D, 0x47, 0x5A, 0x76, 0xC1, 0x7D, 0x67, 0x5E, 0x17, 0x60, 0x82, 0x8E, 0xCE, 0x93, 0xB5,
+    0x1C, 0xA6, 0x71, 0xF2, 0xAA, 0x83, 0x12, 0x1B, 0x76, 0xC1, 0xD5, 0x3A, 0x16, 0x60, 0x82, 0xEA,
+    0x9C, 0x27, 0x6B, 0xB3, 0x5E, 0x47, 0xAC, 0x48, 0x77, 0xBF, 0xD4, 0x56, 0xA4, 0x71, 0xA7, 0xF0,
+    0x2E, 0xB6, 0xD6, 0x48, 0x1A, 0x41, 0xB7, 0x25, 0x64, 0xCD, 0xC5, 0xF7, 0x2E, 0x7D, 0x27, 0xC0,
+    0x75, 0x69, 0xA0, 0xD5, 0x01, 0x15, 0x8D, 0x27, 0x8B, 0xD6, 0xA3, 0xA3, 0xFB, 0x17, 0x95, 0x6E,
+    0x9C, 0xB4, 0x3A, 0xE4, 0x3F, 0x5C, 0x18, 0x5F, 0xB0, 0x67, 0xFD, 0x06, 0x63, 0x57, 0x8F, 0x18,
+    0xB9, 0x6A, 0xCC, 0x24, 0xFF, 0x07, 0xA5, 0xEA, 0xF2, 0xDD, 0xFC, 0x76, 0x53, 0x74, 0x56, 0xAA,
+    0x3C, 0xB0, 0xF5, 0x13, 0xB1, 0x85, 0xF7, 0x0A, 0x80, 0xB9, 0x47, 0x00, 0x44, 0x3A, 0x8C, 0xAC,
+    0x0A, 0x97, 0x7F, 0xAA, 0x00, 0x00, 0x56, 0x1A, 0x98, 0x4B, 0x5C, 0xC1, 0x84, 0x8E, 0x21, 0x4B,
+    0xFE, 0x6F, 0x03, 0xE8, 0xE5, 0xAA, 0x34, 0xEA, 0xFD, 0x02, 0x90, 0xDD, 0xE8, 0x90, 0x86, 0x39,
+    0x46, 0x6A, 0xF7, 0x79, 0x5F, 0x42, 0xC9, 0x87, 0xCA, 0x6A, 0x56, 0x48, 0x6F, 0x65, 0xC2, 0xB9,
+    0x4D, 0xD8, 0x84, 0xEB, 0xFC, 0x4F, 0x91, 0x79, 0x7D, 0x02, 0x03, 0xFE, 0x66, 0x8B, 0x4C, 0xB2,
+    0x48, 0x29, 0x75, 0x02, 0xDC, 0x87, 0xE7, 0x08, 0x9C, 0x49, 0xB3, 0x5C, 0xF3, 0xC7, 0x89, 0x08,
+    0xB3, 0x82, 0x50, 0x7E, 0xD1, 0x22, 0x13, 0xD8, 0x2C, 0xC8, 0x9E, 0x7A, 0xB4, 0xA5, 0x6C, 0x9C,
+    0xD7, 0x1D, 0x33, 0xCE, 0x24, 0xEE, 0x8E, 0x06, 0x96, 0x56, 0x13, 0x28, 0x9E, 0xAA, 0xC8, 0x24,
+    0x9C, 0x62, 0xE6, 0x2F, 0xCB, 0x89, 0x94, 0xC7, 0xB2, 0x09, 0x0C, 0xFA, 0x65, 0xCB, 0x6D, 0x7E,
+    0x36, 0x95, 0x01, 0x25, 0xD2, 0xB1, 0x36, 0xFD, 0xCE, 0xFB, 0xA8, 0xBC, 0xF3, 0x99, 0xA1, 0x94,
+    0x66, 0x5A, 0x9D, 0x01, 0xF8, 0xEF, 0xF6, 0x8F, 0xAF, 0xE7, 0xB6, 0x3E, 0xF5, 0x0F, 0xF3, 0x2A,
+    0x96, 0xFF, 0xFE, 0xDF, 0x9C, 0xE5, 0xB9, 0x9F, 0xFE, 0x43, 0xCA, 0x4C, 0x5C, 0x80, 0x47, 0x3E,
+    0xFB, 0xF5, 0x57, 0xF6, 0x0F, 0x9F, 0x33, 0xFF, 0x40, 0x85, 0xE7, 0x2E, 0x9F, 0x85, 0xE7, 0xF8,
+    0x79, 0x9F, 0xD2, 0x75, 0x01, 0x53, 0x29, 0xCF, 0xDE, 0xFE, 0x9F, 0xFC, 0xE5, 0x9F, 0x5F, 0xE0,
+    0x33, 0x97, 0xD7, 0x09, 0x9F, 0x61, 0x1D, 0x7E, 0xFE, 0x27, 0x3E, 0xBB, 0x3F, 0x95, 0xDB, 0xD2,
+    0x0E, 0xBF, 0xE6, 0x22, 0xB7, 0x45, 0x96, 0x00, 0xDB, 0xE9, 0x9A, 0x8A, 0x88, 0x88, 0xDC, 0x4D,
+    0x14, 0x7E, 0xF5, 0xBC, 0xBA, 0xD4, 0x8C, 0xC7, 0xFA, 0x07, 0xBF, 0xEA, 0xD3, 0xF7, 0xAF, 0x7E,
+    0x74, 0x7F, 0x7F, 0xFF, 0xDF, 0x8A, 0xC8, 0x6B, 0xDB, 0xDB, 0xDB, 0xA4, 0x40, 0xFC, 0x9D, 0x01,
+    0x4D, 0x45, 0x55, 0x0B, 0x17, 0x0E, 0x9D, 0x6F, 0x0B, 0xED, 0x23, 0x9C, 0x71, 0xAF, 0xBC, 0xD5,
+    0xEE, 0xBA, 0xC7, 0x9A, 0x4D, 0x53, 0xA3, 0xAA, 0xF3, 0xEE, 0xC5, 0xDE, 0x85, 0x85, 0x0D, 0xBD,
+    0xF3, 0x9D, 0x7B, 0x34, 0x16, 0xBA, 0xD9, 0x34, 0x3E, 0xBA, 0x84, 0x0B, 0x56, 0x8B, 0xFC, 0x9B,
+    0xF1, 0xA8, 0xB8, 0x14, 0x77, 0xAD, 0x6F, 0xF3, 0xAC, 0x19, 0x6B, 0x3F, 0x31, 0xF5, 0x95, 0x21,
+    0xA7, 0x3E, 0x20, 0xF9, 0x23, 0x70, 0xA0, 0xFD, 0x25, 0x91, 0x37, 0x45, 0xFA, 0xF3, 0x0F, 0xAF,
+    0xA5, 0xD7, 0xA8, 0x08, 0x07, 0xE9, 0xF3, 0x0A, 0xE3, 0x87, 0x80, 0x91, 0x11, 0xA9, 0x54, 0xB3,
+    0x4C, 0xB6, 0x6F, 0x94, 0xC4, 0x7A, 0xF3, 0x8C, 0x13, 0xB9, 0x21, 0xD2, 0xAF, 0xB9, 0x47, 0x2B,
+    0x22, 0xE4, 0x49, 0xF5, 0x96, 0xA0, 0x03, 0xE7, 0x36, 0xD7, 0x9C, 0x48, 0x23, 0xB2, 0x38, 0x63,
+    0xAB, 0x8A, 0x16, 0x5C, 0x85, 0x8A, 0x50, 0x80, 0xDA, 0x02, 0x98, 0x3E, 0x23, 0x79, 0x3F, 0x8D,
+    0x52, 0x6D, 0x71, 0x19, 0xD7, 0x22, 0xAD, 0x93, 0x56, 0xE4, 0x0D, 0x59, 0xCA, 0xD2, 0x2D, 0x59,
+    0xB2, 0x0E, 0x6B, 0xBA, 0x2F, 0x6F, 0x75, 0x6B, 0x9C, 0xE5, 0x43, 0x65, 0x75, 0x34, 0xAD, 0x96,
+    0x7B, 0xF4, 0xE7, 0x39, 0x97, 0x5F, 0xEA, 0xCB, 0x1B, 0xED, 0x89, 0x20, 0x7D, 0xE6, 0xF7, 0x5E,
+    0xC9, 0x7E, 0x0D, 0x82, 0x54, 0xFF, 0xC9, 0x5F, 0x7C, 0xF0, 0x97, 0x14, 0x24, 0xAE, 0x52, 0x54,
+    0xE6, 0xCF, 0xD4, 0xFF, 0xF3, 0xC8, 0xDF, 0x7B, 0xCE, 0xFF, 0x42, 0x4B, 0x58, 0x3D, 0xA5, 0xA0,
+    0xE1, 0xA5, 0x8A, 0xCB, 0x0D, 0x17, 0x3E, 0xFE, 0xD9, 0x6B, 0xFF, 0xCD, 0x5F, 0x5E, 0xFB, 0xAF,
+    0xC3, 0x85, 0x47, 0xC2, 0xE7, 0xC2, 0x8B, 0xB7, 0xAA, 0x00, 0xBF, 0xC4, 0xCF, 0x30, 0xE6, 0x0B,
+    0x95, 0xBD, 0xC0, 0xC3, 0x97, 0xF9, 0x3F, 0xEF, 0x7E, 0xED, 0x73, 0x77, 0xBF, 0xFE, 0xC0, 0x23,
+    0xC6, 0xFC, 0xB6, 0x51, 0xB7, 0x3E, 0x01, 0xE6, 0x97, 0xFA, 0x79, 0x8F, 0x07, 0x9C, 0xB0, 0xD0,
+    0x2A, 0xD5, 0xEE, 0x99, 0xDB, 0x21, 0xE5, 0xBC, 0xF3, 0xAC, 0x49, 0xB5, 0x2A, 0x23, 0x15, 0x53,
+    0xB1, 0xE7, 0x84, 0x98, 0x6A, 0x3F, 0xAF, 0xAB, 0x68, 0xEB, 0x54, 0x03, 0xD2, 0xA4, 0xA4, 0x78,
+    0xD4, 0x61, 0x33, 0x65, 0x44, 0x8D, 0x6F, 0xD7, 0x1B, 0xCE, 0x5E, 0x3D, 0x70, 0x8F, 0x35, 0x65,
+    0xCF, 0xBC, 0xDB, 0x3B, 0x34, 0xBE, 0xDB, 0xC8, 0xE2, 0x24, 0x6F, 0x5D, 0xD6, 0xE4, 0xDA, 0x8F,
+    0xE0, 0xA2, 0xF6, 0xCE, 0xD6, 0x1B, 0x70, 0x60, 0x6B, 0xE7, 0xB8, 0x88, 0x8A, 0xAE, 0xCA, 0x73,
+    0x46, 0xE8, 0xE0, 0xAA, 0x8D, 0x9C, 0x4D, 0x6C, 0xED, 0xAA, 0xCD, 0x9C, 0x03, 0x0A, 0x6C, 0x7D,
+    0x90, 0x13, 0x99, 0x60, 0xFE, 0x63, 0x74, 0x5F, 0x0A, 0x74, 0x64, 0x52, 0x1B, 0xA9, 0x88, 0x70,
+    0x1E, 0x9E, 0x3C, 0x4D, 0xCC, 0xC7, 0x4D, 0x73, 0xE8, 0x6E, 0xB6, 0x63, 0xE3, 0x5B, 0x05, 0xA0,
+    0xEB, 0x47, 0x4C, 0x33, 0xB3, 0xA1, 0x77, 0x37, 0xBB, 0xE2, 0x52, 0x1C, 0x9B, 0x30, 0x71, 0x75,
+    0xEB, 0x38, 0x37, 0x78, 0x64, 0xCD, 0x6F, 0x67, 0x7E, 0xCF, 0xFA, 0xBE, 0xB8, 0x14, 0xF7, 0xDC,
+    0xCD, 0xAE, 0xB4, 0xA1, 0xCF, 0x9F, 0x69, 0x76, 0xED, 0x8D, 0x38, 0xD6, 0xA1, 0x75, 0xAA, 0x39,
+    0xA3, 0x78, 0x08, 0x4C, 0xD5, 0xBB, 0x30, 0xD5, 0xD1, 0xD5, 0x93, 0x2C, 0x7C, 0x00, 0xB8, 0x9C,
+    0xF9, 0xDE, 0xFA, 0x85, 0x69, 0xA6, 0x3A, 0x96, 0xAA, 0x73, 0x75, 0x6F, 0xFC, 0x28, 0x0B, 0x0F,
+    0x52, 0x9F, 0x01, 0x50, 0xC1, 0xF2, 0xBC, 0xF3, 0x33, 0xD3, 0x94, 0x8F, 0x76, 0xCE, 0x4F, 0x75,
+    0x2C, 0xAA, 0xDE, 0x34, 0x25, 0x9D, 0xF3, 0xBB, 0x2A, 0xBA, 0xAA, 0xCB, 0xC2, 0x83, 0xC4, 0x8C,
+    0x73, 0xAA, 0xE2, 0x43, 0x90, 0xD7, 0xE4, 0x07, 0xE4, 0xB6, 0xCE, 0x39, 0x70, 0x95, 0xAD, 0xF9,
+    0x10, 0x33, 0x1D, 0x9D, 0x9F, 0xB2, 0x60, 0x41, 0x89, 0xAB, 0xB5, 0xE7, 0x6A, 0x06, 0x43, 0x38,
+    0x30, 0xC5, 0x79, 0x17, 0x5C, 0xB0, 0xDE, 0xFA, 0xAC, 0xE2, 0x1C, 0xF0, 0x89, 0x0A, 0x1E, 0xBC,
+    0x48, 0x34, 0xF5, 0xF5, 0xBC, 0x6A, 0x32, 0xFF, 0xDC, 0xC7, 0xB1, 0x38, 0xD8, 0xD4, 0x1E, 0x62,
+    0xE4, 0xAC, 0xEE, 0xCF, 0xAA, 0xCE, 0xA9, 0xD6, 0x3D, 0xD6, 0x39, 0xF8, 0xBF, 0x1A, 0xB8, 0x68,
+    0x6A, 0x4C, 0x75, 0x01, 0xD5, 0x6C, 0x5D, 0xE6, 0x4A, 0xFE, 0x58, 0xF8, 0xA0, 0x6A, 0xED, 0xA5,
+    0x7A, 0x8D, 0x87, 0x3F, 0x07, 0x5C, 0x1D, 0xC0, 0xD7, 0x35, 0xC6, 0x8C, 0x39, 0xE4, 0x90, 0x9E,
+    0x9E, 0x4E, 0x75, 0xAA, 0xCD, 0x62, 0x16, 0xB3, 0x63, 0x57, 0x58, 0x7B, 0xED, 0x8D, 0x37, 0xDE,
+    0xD4, 0xB6, 0xB6, 0x95, 0xAD, 0x2C, 0x6E, 0xF8, 0xF7, 0x41, 0x3E, 0xC0, 0x07, 0x4E, 0xAC, 0x25,
+    0x05, 0x65, 0x55, 0x52, 0xB2, 0xC7, 0x79, 0xCE, 0x73, 0x5A, 0x81, 0x7E, 0xF6, 0x7F, 0x97, 0x57,
+    0x4E, 0xEA, 0x8C, 0xFE, 0xCE, 0xCA, 0x47, 0x9F, 0x0D, 0xF9, 0x4F, 0x1D, 0x86, 0x3A, 0xC2, 0x7C,
+    0xE5, 0xE4, 0x5C, 0x1F, 0x0A, 0x4C, 0xB5, 0x1F, 0x4A, 0x27, 0x36, 0x56, 0x49, 0xEB, 0x38, 0x18,
+    0x6E, 0x5B, 0x0F, 0xAE, 0xC2, 0x68, 0xF0, 0xA4, 0xB3, 0xC8, 0xA9, 0xC4, 0x73, 0xF6, 0x15, 0xD6,
+    0x9F, 0xD3, 0xE2, 0xAD, 0x7C, 0x5E, 0x7A, 0x2D, 0xED, 0x1F, 0x14, 0x55, 0x33, 0x45, 0x07, 0x8C,
+    0xA7, 0x45, 0x45, 0x36, 0xE1, 0x20, 0x15, 0x82, 0x8F, 0x87, 0xA7, 0x43, 0xF6, 0x60, 0x96, 0x3A,
+    0x09, 0x36, 0x60, 0x13, 0xF7, 0x17, 0xE4, 0x5F, 0xC9, 0x96, 0xE8, 0x9E, 0x8F, 0xC2, 0x1F, 0x9E,
+    0x4E, 0xAC, 0x45, 0x4C, 0x50, 0x3D, 0xBA, 0x63, 0x0F, 0x7A, 0xD6, 0x8E, 0x63, 0x80, 0xAD, 0xB3,
+    0x57, 0xB1, 0x5E, 0x22, 0xA5, 0x95, 0x98, 0xB5, 0xBF, 0x63, 0x83, 0xF3, 0xB8, 0xAA, 0x84, 0x11,
+    0x2D, 0xA4, 0xA8, 0xAA, 0x80, 0x8E, 0x03, 0x5C, 0xAD, 0x83, 0xEA, 0x70, 0xB8, 0x9A, 0x4D, 0x0E,
+    0xA0, 0xD1, 0x77, 0x31, 0x95, 0xED, 0xB8, 0xC0, 0xD9, 0xEA, 0xC4, 0xAD, 0x04, 0xE7, 0x19, 0x33,
+    0x25, 0xEB, 0x54, 0x87, 0x0D, 0xAA, 0xE2, 0xCC, 0x2A, 0x69, 0x39, 0xE6, 0x63, 0x15, 0x87, 0x4A,
+    0x22, 0x7D, 0x26, 0x1D, 0x5D, 0x76, 0x75, 0xA6, 0xDA, 0xA1, 0x74, 0x66, 0x53, 0x37, 0x30, 0xD1,
+    0x01, 0xD5, 0x6A, 0x8F, 0x09, 0xC6, 0x93, 0x57, 0xA6, 0x66, 0x17, 0x5B, 0xA9, 0x16, 0x8B, 0x0E,
+    0x38, 0xF4, 0x7F, 0xC2, 0xA1, 0x17, 0x7C, 0x00, 0x4E, 0x23, 0x1A, 0x05, 0xBA, 0xA1, 0xAC, 0x6C,
+    0xA4, 0xC4, 0x06, 0xCE, 0xA3, 0x80, 0x27, 0x21, 0x93, 0x46, 0xDF, 0xBC, 0x2B, 0x7F, 0xD2, 0xC4,
+    0x75, 0x69, 0xCE, 0xB1, 0xBE, 0xDA, 0xD5, 0x0F, 0x12, 0x1E, 0xD6, 0xF5, 0x9E, 0xF5, 0x7D, 0xFE,
+    0x58, 0x5B, 0x9A, 0x66, 0xE1, 0x6E, 0x76, 0xA5, 0x8E, 0x87, 0xEE, 0x46, 0x57, 0x5C, 0x6A, 0x76,
+    0xAD, 0xEF, 0x72, 0xDD, 0x8C, 0xAC, 0x6F, 0x9D, 0x6A, 0x46, 0x54, 0xE7, 0x32, 0xCE, 0x41, 0x51,
+    0x5B, 0xF1, 0x87, 0xC5, 0xA5, 0x30, 0xDE, 0xE0, 0xA0, 0xD5, 0xAF, 0x7B, 0xF7, 0x4F, 0xD9, 0x3C,
+    0x50, 0x6F, 0x35, 0xEE, 0x71, 0x3F, 0xCB, 0xBF, 0xE4, 0x8B, 0x9E, 0xDF, 0xA9, 0x80, 0x8F, 0x40,
+    0x8F, 0xEE, 0x71, 0x07, 0x6C, 0x5E, 0x27, 0x46, 0x1D, 0xA2, 0x7B, 0x34, 0x96, 0x5F, 0xBF, 0x53,
+    0xCA, 0x02, 0xED, 0xD1, 0x9E, 0x94, 0xC6, 0xF8, 0xEC, 0x57, 0xB4, 0x34, 0xF9, 0x3E, 0xD7, 0xD1,
+    0x81, 0xBC, 0x63, 0xBD, 0x43, 0x45, 0xB4, 0x27, 0x47, 0xB5, 0x6B, 0xF3, 0x7A, 0xDE, 0xF2, 0x24,
+    0xA0, 0x0E, 0xC8, 0xEF, 0xB0, 0x44, 0x47, 0xAC, 0xC7, 0x2D, 0x29, 0xAE, 0x85, 0x51, 0x16, 0x37,
+    0x55, 0xDC, 0x54, 0x71, 0xA4, 0x43, 0xF1, 0x94, 0xB7, 0x4B, 0xD4, 0x16, 0x1F, 0xDB, 0xFF, 0x84,
+    0x2C, 0xBE, 0xF1, 0xE9, 0x6F, 0x11, 0xB7, 0x46, 0xD8, 0x5A, 0x45, 0x86, 0x5F, 0x63, 0x8C, 0xE7,
+    0x0A, 0x0A, 0x28, 0x6A, 0xF3, 0x86, 0x9F, 0xB8, 0xC7, 0xC2, 0xC8, 0x3E, 0x1D, 0xDD, 0x35, 0x8A,
+    0xA8, 0x5F, 0x6E, 0x46, 0xE6, 0x46, 0x74, 0x9F, 0xF0, 0x9B, 0xEE, 0x0B, 0x4D, 0xB1, 0x64, 0xAD,
+    0x82, 0xFC, 0x2A, 0xD2, 0xE9, 0x66, 0x62, 0xFC, 0xC8, 0xD4, 0x17, 0xAD, 0x1F, 0x99, 0x30, 0xC9,
+    0xA4, 0xE7, 0x77, 0x5A, 0x74, 0x43, 0xEE, 0xD5, 0x92, 0xB2, 0x4D, 0x9B, 0xAA, 0x16, 0xC5, 0xD3,
+    0xEF, 0x2C, 0xF5, 0x5F, 0x5C, 0x71, 0x37, 0xC3, 0xC4, 0x65, 0xCD, 0xA6, 0x7B, 0xB4, 0xD9, 0xB4,
+    0xD7, 0x63, 0xF9, 0x34, 0x7F, 0x90, 0xE2, 0x8C, 0xAA, 0x9C, 0xEB, 0x66, 0x94, 0xD3, 0xB5, 0xD9,
+    0x0F, 0xBC, 0xFB, 0x32, 0xA3, 0x03, 0xF5, 0x56, 0x63, 0xBF, 0x59, 0x8F, 0x72, 0xDD, 0x94, 0x4B,
+    0xA6, 0x2B, 0xE3, 0x72, 0xE4, 0x16, 0x6B, 0x33, 0x26, 0x1C, 0xD0, 0xD2, 0x12, 0x55, 0xCC, 0x1A,
+    0x1D, 0x8A, 0x7E, 0xDA, 0xA5, 0x51, 0xA6, 0x73, 0xDD, 0x8C, 0x3E, 0x48, 0x8B, 0xF1, 0x8C, 0x30,
+    0x81, 0x5D, 0xAC, 0xA7, 0xC3, 0xD5, 0x88, 0xBC, 0x98, 0x3C, 0x2D, 0xD7, 0x9B, 0xDB, 0xCD, 0xF3,
+    0x1B, 0x64, 0x0D, 0x13, 0xA6, 0x94, 0xAD, 0xB2, 0x9E, 0x09, 0xD6, 0x67, 0xED, 0x3F, 0x5E, 0x98,
+    0xE5, 0xB1, 0xC0, 0x4C, 0xC8, 0x7A, 0x4C, 0xC7, 0x83, 0x07, 0x5C, 0x69, 0x55, 0x8C, 0xC6, 0xC7,
+    0x5C, 0x35, 0xA5, 0x2C, 0x0A, 0xE9, 0xD1, 0x1E, 0xE3, 0x31, 0x15, 0xD2, 0x69, 0x09, 0x1B, 0x10,
+    0xD1, 0x1D, 0x76, 0x01, 0x3D, 0x44, 0xB4, 0xA7, 0x20, 0x8B, 0xF7, 0xCB, 0xC9, 0xCA, 0x31, 0x0B,
+    0xCA, 0xAB, 0xAA, 0x43, 0x07, 0xDC, 0xBF, 0x24, 0x97, 0x7A, 0xE3, 0x53, 0x4D, 0xDA, 0xA0, 0xCD,
+    0xAC, 0x19, 0xEB, 0x90, 0x4B, 0x6D, 0x16, 0x09, 0x3B, 0x78, 0x59, 0x16, 0xCF, 0xDB, 0xFF, 0x59,
+    0x45, 0x36, 0x71, 0x55, 0xD6, 0x30, 0xC1, 0x55, 0x59, 0x64, 0x84, 0xF1, 0xC7, 0x45, 0x15, 0x99,
+    0x54, 0xE3, 0x9D, 0xAC, 0x19, 0xD9, 0x2A, 0xE6, 0xB6, 0x2E, 0x5A, 0xC4, 0xE7, 0xCE, 0x47, 0xF7,
+    0x89, 0x7A, 0x94, 0xAB, 0x58, 0x5E, 0xAB, 0x8A, 0xE4, 0xF8, 0x2B, 0x98, 0x46, 0x75, 0xB7, 0xD7,
+    0x61, 0xD3, 0xF8, 0x91, 0xAD, 0x47, 0xC6, 0x8F, 0xF4, 0x9D, 0x19, 0xD2, 0xA1, 0x22, 0x26, 0x50,
+    0x54, 0xF7, 0x2F, 0x28, 0xC2, 0x00, 0x5B, 0x48, 0x30, 0x22, 0x0B, 0xCC, 0x6B, 0x9F, 0x0A, 0xEC,
+    0xB2, 0x89, 0xF5, 0xDA, 0xD3, 0x73, 0x2E, 0x05, 0xF7, 0x1D, 0x90, 0xFF, 0xF1, 0x1F, 0x90, 0x89,
+    0xD4, 0x94, 0xFB, 0xCF, 0x9D, 0x34, 0x82, 0x7C, 0xFA, 0xB5, 0x0A, 0x27, 0xED, 0x00, 0xE5, 0x74,
+    0x03, 0x7E, 0x92, 0x4B, 0x9D, 0x0A, 0xC7, 0x8F, 0xD1, 0x56, 0x60, 0x2E, 0x60, 0xC3, 0x21, 0x4C,
+    0x68, 0xD1, 0x8D, 0xF6, 0xE4, 0x9C, 0x19, 0x80, 0x80, 0x06, 0xB2, 0x6B, 0xFB, 0xCF, 0xE1, 0x44,
+    0x52, 0x1D, 0x88, 0x7A, 0xEA, 0x5F, 0x6C, 0xA5, 0x57, 0x7F, 0xF7, 0xED, 0xED, 0xD3, 0x10, 0x43,
+    0x84, 0xEC, 0xDA, 0x1F, 0x7F, 0xF2, 0xBA, 0x13, 0x11, 0x5F, 0xFE, 0x2F, 0xF3, 0x25, 0xEF, 0xC1,
+    0x2F, 0xE7, 0x92, 0x4C, 0x82, 0x93, 0x21, 0x90, 0xFE, 0x2F, 0xE3, 0x10, 0x0B, 0xB9, 0xA1, 0x46,
+    0x90, 0x72, 0x55, 0x24, 0xD3, 0x31, 0xD3, 0x1E, 0x30, 0x21, 0x8B, 0x0F, 0x26, 0x6D, 0xE1, 0xEA,
+    0xEB, 0xA8, 0x2D, 0x7A, 0x66, 0x85, 0xF8, 0x79, 0xA3, 0x9B, 0xFC, 0xDB, 0xB2, 0xB0, 0x5F, 0xAA,
+    0xDD, 0x1B, 0x3D, 0x13, 0x36, 0x61, 0xBA, 0xAC, 0xB2, 0x46, 0xA5, 0xA2, 0x2C, 0x57, 0xE9, 0x88,
+    0xF3, 0xB0, 0x89, 0x69, 0x19, 0x83, 0x8A, 0xE8, 0x56, 0xB5, 0x60, 0x3C, 0x3A, 0x5A, 0x0F, 0x1B,
+    0xD9, 0x39, 0xE3, 0x0B, 0xA0, 0x9B, 0xC4, 0x07, 0xAD, 0x04, 0xB4, 0xDC, 0xBA, 0x1B, 0xE7, 0x52,
+    0x63, 0xBA, 0x53, 0x52, 0x77, 0x82, 0xE6, 0x76, 0x90, 0xCB, 0x12, 0x64, 0x6B, 0x17, 0xDD, 0xB2,
+    0x89, 0xF3, 0x7C, 0x9C, 0xBC, 0xE2, 0x5C, 0xF2, 0x78, 0x76, 0xB7, 0x9F, 0xC4, 0x8A, 0x44, 0xD6,
+    0x16, 0xDB, 0x5B, 0x89, 0xE5, 0x85, 0x88, 0xE7, 0x63, 0xCB, 0xFD, 0x7A, 0x28, 0x82, 0xEB, 0x19,
+    0x0A, 0xEA, 0x99, 0xC2, 0x39, 0x8A, 0x57, 0xD7, 0x9B, 0xC4, 0x4B, 0x25, 0x2B, 0x68, 0xFC, 0xDC,
+    0x60, 0x71, 0xC6, 0xC3, 0x63, 0x23, 0x0D, 0x23, 0xB7, 0x45, 0x52, 0x5F, 0xA9, 0xAD, 0x07, 0x5B,
+    0xE6, 0x2A, 0x8E, 0xD3, 0x84, 0xB6, 0xC6, 0x76, 0x58, 0xA9, 0xED, 0xBF, 0x3A, 0xB0, 0x5F, 0x78,
+    0xE2, 0xE9, 0x1B, 0x21, 0x70, 0x19, 0x2E, 0x80, 0xA9, 0x50, 0x01, 0xAE, 0xC3, 0x45, 0xB0, 0x35,
+    0x59, 0x03, 0x07, 0xB0, 0x71, 0xFC, 0x62, 0x90, 0xC9, 0x64, 0xEB, 0x8A, 0x15, 0xD8, 0xB5, 0x71,
+    0x3C, 0xE7, 0x30, 0xDB, 0xEA, 0x31, 0x39, 0xEE, 0xDF, 0xFC, 0x49, 0x83, 0xA5, 0x69, 0x86, 0x39,
+    0x2F, 0xC3, 0x05, 0xAC, 0xB9, 0xF4, 0xD8, 0x9B, 0x2F, 0x35, 0xC5, 0x3F, 0x6B, 0x32, 0x69, 0x28,
+    0x1A, 0x4E, 0x21, 0xA8, 0xDA, 0x3B, 0x68, 0x99, 0x30, 0x42, 0x45, 0x57, 0x61, 0x6E, 0x89, 0x88,
+    0x94, 0x22, 0x12, 0xDB, 0x64, 0x58, 0xF2, 0xD4, 0x0E, 0xB8, 0x49, 0x5C, 0xD5, 0x3D, 0xE0, 0x3C,
+    0xAE, 0xC7, 0x89, 0x77, 0xFF, 0x70, 0xE2, 0xBE, 0xF0, 0xB8, 0x7F, 0x3A, 0xD4, 0xF7, 0x92, 0x7A,
+    0x19, 0x2E, 0xB0, 0x6E, 0x1E, 0xBB, 0xF4, 0xBD, 0x6F, 0xC7, 0xF1, 0xFF, 0x18, 0xB5, 0x44, 0xCA,
+    0x88, 0x8E, 0x70, 0x0E, 0x52, 0xB5, 0xE4, 0x30, 0xC0, 0xBF, 0x9A, 0xB9, 0x2F, 0x3C, 0x7E, 0xE3,
+    0xE9, 0x70, 0xF5, 0x9E, 0x01, 0x3E, 0x73, 0xF9, 0x77, 0xC7, 0x17, 0x0A, 0xFD, 0xFA, 0x0E, 0xC5,
+    0x92, 0x6C, 0x09, 0x1B, 0xE4, 0x22, 0x2F, 0x8B, 0x1C, 0x27, 0xFF, 0x4D, 0x0A, 0x94, 0x26, 0x43,
+    0x14, 0x05, 0x11, 0x36, 0x79, 0xC4, 0x31, 0xD6, 0x7E, 0x83, 0xB8, 0xC1, 0x66, 0xB1, 0xFD, 0x94,
+    0x13, 0xB9, 0xF9, 0xF6, 0xF6, 0x56, 0x91, 0x18, 0x5A, 0x40, 0xB6, 0xB2, 0x64, 0xAE, 0x3A, 0xF9,
+    0xA3, 0xD3, 0x23, 0x58, 0x9C, 0x6E, 0xB4, 0xDF, 0x20, 0x66, 0xCD, 0x68, 0x7B, 0xCF, 0x89, 0xDC,
+    0xD8, 0xFE, 0x54, 0x33, 0x34, 0x8E, 0xE8, 0x86, 0x63, 0xA0, 0xF7, 0x2C, 0x60, 0xBC, 0x42, 0x45,
+    0x15, 0x99, 0xA8, 0x96, 0x9C, 0x16, 0xED, 0x5B, 0x88, 0x22, 0xD2, 0x97, 0xFB, 0xFB, 0xFB, 0xBA,
+    0x19, 0xE4, 0x47, 0x37, 0x43, 0x61, 0xE0, 0xF1, 0xF5, 0xC1, 0xC1, 0x9F, 0x71, 0x75, 0xEA, 0xA0,
+    0x7C, 0x56, 0x44, 0x6E, 0xAF, 0x5A, 0x4A, 0x0B, 0x11, 0xF9, 0xBC, 0x88, 0x34, 0x1B, 0xAB, 0xDE,
+    0x98, 0x47, 0x4E, 0x6A, 0xBC, 0x56, 0x62, 0xF6, 0x6C, 0xED, 0xBE, 0xDF, 0xBB, 0x6E, 0xFE, 0xC2,
+    0xBF, 0xBE, 0x78, 0xFD, 0x13, 0xCF, 0xFE, 0x7D, 0xF5, 0xFD, 0xC0, 0x95, 0xEB, 0x6C, 0x5C, 0xC4,
+    0x3E, 0x5B, 0x65, 0xDF, 0x6F, 0x38, 0x38, 0x60, 0x63, 0x03, 0xFB, 0x6C, 0x9D, 0x7D, 0xFF, 0x14,
+    0x5C, 0x9E, 0x1D, 0xB7, 0xDC, 0xD5, 0x73, 0x91, 0xAE, 0x10, 0x91, 0x95, 0x28, 0x6F, 0xCC, 0x45,
+    0x96, 0x45, 0x8A, 0xBC, 0x37, 0x56, 0xCE, 0xD8, 0xF0, 0x67, 0x55, 0x75, 0xEF, 0x78, 0x07, 0x07,
+    0x6C, 0x5C, 0xC4, 0x3C, 0x5B, 0xA5, 0x69, 0xD5, 0x83, 0x17, 0xFF, 0x8B, 0xD7, 0x9F, 0xFD, 0x27,
+    0xC5, 0xF7, 0x97, 0x59, 0x77, 0xC4, 0xC6, 0xC6, 0xB0, 0x63, 0x27, 0xD7, 0xE7, 0x74, 0x85, 0x09,
+    0x79, 0xC5, 0x04, 0x57, 0x69, 0x11, 0xA1, 0x14, 0x11, 0xED, 0xC1, 0xB9, 0x0A, 0x26, 0x4E, 0x44,
+    0xBC, 0x13, 0xE9, 0x71, 0x18, 0x8F, 0xAB, 0x26, 0xF0, 0x00, 0xA7, 0x0A, 0xA6, 0xB2, 0x0E, 0xF4,
+    0xEB, 0x11, 0x8A, 0x27, 0x02, 0xF4, 0x45, 0x8D, 0x09, 0x25, 0x14, 0x1C, 0x42, 0xA7, 0x96, 0xFB,
+    0xD7, 0xBC, 0x16, 0x11, 0xEC, 0xDB, 0x9F, 0x6C, 0x71, 0xDE, 0x7A, 0xCA, 0x6A, 0x0C, 0x7B, 0x2A,
+    0x42, 0xEF, 0x6A, 0xB2, 0x76, 0x04, 0xFA, 0xAD, 0x08, 0xEE, 0x5B, 0x15, 0xE4, 0x3D, 0x50, 0x36,
+    0x43, 0x22, 0x44, 0xB5, 0x1C, 0xA7, 0xAE, 0xB0, 0xE2, 0xF5, 0x5D, 0xE1, 0x11, 0xD5, 0x25, 0xAC,
+    0x6E, 0x37, 0xED, 0xDE, 0x18, 0xFB, 0x7A, 0xB4, 0x22, 0xBA, 0xCD, 0xE3, 0x8C, 0x71, 0x5E, 0xE9,
+    0x1F, 0x44, 0x46, 0x23, 0xCC, 0x0B, 0x9E, 0xD9, 0x0C, 0xF7, 0xAC, 0x57, 0x71, 0xC6, 0xD8, 0x06,
+    0xE3, 0xA7, 0xAA, 0xD5, 0xB2, 0xC0, 0x2E, 0x4F, 0x10, 0x26, 0xB9, 0x2D, 0xD2, 0x3F, 0x49, 0x09,
+    0xEE, 0xB8, 0x76, 0xBF, 0x04, 0xF7, 0xEF, 0x9F, 0x34, 0xEF, 0x88, 0x2C, 0x44, 0xE4, 0xBD, 0x9F,
+    0x78, 0xF4, 0xDB, 0xDB, 0x8F, 0x26, 0xDC, 0xE3, 0xC4, 0xA7, 0xBE, 0xAF, 0xD2, 0x15, 0x85, 0xB4,
+    0x25, 0x46, 0xE4, 0xDD, 0xC8, 0xFC, 0xAA, 0x11, 0x4C, 0x44, 0x77, 0x94, 0x50, 0xB4, 0xAA, 0x23,
+    0x7B, 0xA7, 0x71, 0x9E, 0xC2, 0xF9, 0x31, 0x59, 0x5B, 0xA8, 0x8E, 0xBC, 0xDA, 0x35, 0x41, 0xB5,
+    0xAA, 0xCD, 0xAB, 0xBC, 0x32, 0x61, 0x57, 0xB5, 0x14, 0x8F, 0x76, 0x79, 0xC5, 0x4C, 0xC7, 0x0E,
+    0x1D, 0xED, 0x77, 0x6B, 0x8A, 0x2A, 0xEF, 0xA0, 0xA7, 0xF0, 0xE4, 0x01, 0x09, 0xEB, 0x4B, 0xDC,
+    0x35, 0x91, 0x40, 0x9F, 0x4B, 0x87, 0xF2, 0xEA, 0xC9, 0xD3, 0xBD, 0x03, 0x03, 0xFA, 0xE6, 0x22,
+    0x30, 0xF5, 0xA0, 0xA5, 0x06, 0x57, 0x02, 0x07, 0x87, 0xA0, 0x5F, 0xEC, 0x20, 0xD7, 0x11, 0x3A,
+    0x1B, 0x30, 0x3E, 0xF7, 0x14, 0x94, 0xD0, 0x72, 0x94, 0x3A, 0x5E, 0xC6, 0xE8, 0xA8, 0x22, 0xB6,
+    0x71, 0x1E, 0xE7, 0x47, 0x50, 0x3E, 0xD6, 0xC2, 0x91, 0x5B, 0x75, 0x5F, 0x26, 0x2D, 0x23, 0x22,
+    0x72, 0x4B, 0x44, 0xC4, 0xDD, 0xBB, 0xDF, 0x0B, 0xE8, 0x54, 0x8F, 0xF1, 0x3A, 0x52, 0x62, 0x1B,
+    0xDE, 0xBF, 0xDF, 0xF6, 0xE7, 0xDE, 0xEF, 0xD4, 0xAE, 0x21, 0xD2, 0x18, 0x11, 0xA9, 0xE7, 0xFF,
+    0x12, 0xCC, 0xAA, 0x59, 0x33, 0x8B, 0xAB, 0x0C, 0xCC, 0xEE, 0xEA, 0x4F, 0xAC, 0x88, 0xC8, 0x8E,
+    0x88, 0x2C, 0x76, 0x57, 0x3C, 0xD0, 0xC7, 0x5D, 0x8F, 0xCE, 0x93, 0xEE, 0x5F, 0x41, 0x7E, 0x67,
+    0x7B, 0x9B, 0x5C, 0x64, 0xC9, 0xBA, 0xC8, 0x71, 0xD2, 0x6C, 0x33, 0x8D, 0xA9, 0xE6, 0xB2, 0x64,
+    0x2A, 0xD2, 0xD9, 0x3B, 0x8F, 0x45, 0xA6, 0xA9, 0x43, 0x71, 0x33, 0xD5, 0xB1, 0xF6, 0xA9, 0x0B,
+    0x68, 0x93, 0xBC, 0xCA, 0x22, 0x73, 0x11, 0xF9, 0xB1, 0x88, 0xC8, 0xCB, 0x41, 0x45, 0xF2, 0xDA,
+    0xD5, 0x94, 0x8C, 0xE0, 0x70, 0x45, 0xA3, 0x5A, 0x8C, 0x40, 0xC9, 0xDB, 0xDB, 0x5B, 0x4A, 0x44,
+    0x1A, 0xA6, 0x22, 0xB5, 0x8A, 0x2B, 0xE3, 0x74, 0x7E, 0x20, 0xAD, 0x35, 0x22, 0xD2, 0xCC, 0x5F,
+    0xDB, 0xDE, 0x36, 0xED, 0x3D, 0xC8, 0x73, 0x73, 0xDF, 0xF6, 0x93, 0x85, 0x88, 0x74, 0x53, 0x11,
+    0xF9, 0x5E, 0x7B, 0x2F, 0x31, 0x0D, 0x90, 0x2F, 0xF7, 0xF7, 0xAF, 0x5A, 0x11, 0xA9, 0xD5, 0x67,
+    0xF7, 0xBF, 0x36, 0x20, 0xDF, 0x77, 0xB0, 0x49, 0x20, 0xD7, 0xE6, 0x35, 0x50, 0x56, 0xAB, 0x31,
+    0xF7, 0x56, 0xA6, 0x55, 0xB5, 0x80, 0x79, 0x59, 0x44, 0xE4, 0xCB, 0x22, 0xB2, 0x38, 0xE6, 0xDE,
+    0x2A, 0xB9, 0x71, 0x5C, 0x15, 0xA6, 0x16, 0x6A, 0x7B, 0x7B, 0x1E, 0x0A, 0x91, 0x9E, 0xB9, 0x2C,
+    0x07, 0x29, 0x77, 0xAB, 0x8A, 0xFD, 0x42, 0xE4, 0x2A, 0x73, 0x91, 0x16, 0xDD, 0x7C, 0xBA, 0xC3,
+    0x7A, 0xDD, 0xE2, 0x52, 0x1E, 0xCD, 0x34, 0xCC, 0x70, 0x9E, 0x21, 0x8B, 0xB4, 0x3B, 0x15, 0x91,
+    0x3B, 0x22, 0x22, 0x0D, 0xA3, 0xD4, 0x5B, 0x7E, 0x88, 0x8A, 0x3A, 0xA2, 0x43, 0x5E, 0x63, 0xEB,
+    0x1E, 0xF2, 0x3C, 0xDC, 0xB7, 0x3D, 0x5D, 0x64, 0x22, 0x12, 0x6C, 0x32, 0x23, 0x3A, 0xAC, 0x98,
+    0xB5, 0x06, 0x53, 0x91, 0xAB, 0x99, 0x88, 0xB4, 0x6A, 0x7B, 0x7B, 0xA7, 0x05, 0xCC, 0x09, 0x4B,
+    0xFC, 0xF6, 0xF6, 0x56, 0xF1, 0xB8, 0x24, 0xF5, 0x28, 0xED, 0x0A, 0xB7, 0x3F, 0x26, 0xA6, 0xB8,
+    0xB1, 0xBF, 0x7F, 0xAD, 0xB7, 0x22, 0x52, 0x7F, 0x78, 0x7F, 0x7F, 0xEB, 0x54, 0x5F, 0xFC, 0x62,
+    0x2A, 0x22, 0xCB, 0xAA, 0x84, 0xA2, 0xD6, 0x11, 0xD5, 0x51, 0x42, 0xFE, 0x37, 0xFC, 0xDF, 0xF9,
+    0x55, 0x76, 0x5E, 0x9D, 0x4B, 0x5D, 0xCA, 0x7F, 0xD8, 0x7F, 0x2E, 0x15, 0xFF, 0xA0, 0x64, 0xA5,
+    0xED, 0x97, 0xD0, 0x9B, 0x16, 0xE3, 0x0B, 0xCF, 0x26, 0x42, 0x56, 0xE9, 0x6E, 0x75, 0x2B, 0x92,
+    0x39, 0xA0, 0xBB, 0x55, 0xFE, 0xF1, 0x68, 0xD8, 0xA7, 0xAC, 0x5D, 0x55, 0x38, 0xF9, 0x81, 0x23,
+    0x87, 0x40, 0x5E, 0xF3, 0x80, 0x8E, 0xE8, 0xD0, 0xC3, 0x66, 0x51, 0x73, 0xFF, 0xAD, 0xD5, 0x01,
+    0xAE, 0xF7, 0xF7, 0xF7, 0x9F, 0x4B, 0x3E, 0xC4, 0x90, 0xB4, 0xDA, 0x58, 0xD5, 0xC3, 0xD7, 0x29,
+    0xBE, 0xD7, 0x61, 0x38, 0x60, 0xF1, 0x94, 0x43, 0x33, 0x1A, 0x5C, 0x1F, 0x37, 0xEC, 0xCA, 0x3D,
+    0x5F, 0x6C, 0xDF, 0xF3, 0xC5, 0x7C, 0xF0, 0xBD, 0x54, 0x05, 0x5C, 0x1F, 0xC2, 0x3F, 0x5B, 0x93,
+    0xC3, 0x08, 0x0E, 0x50, 0x11, 0x1D, 0xB0, 0x35, 0x6E, 0xD5, 0x08, 0x1E, 0xC9, 0x9A, 0x64, 0x5B,
+    0x52, 0xDC, 0x9F, 0x00, 0x02, 0xED, 0x51, 0x29, 0xC8, 0x8E, 0xE0, 0x50, 0x75, 0x3C, 0x5F, 0x3E,
+    0xE1, 0xFC, 0xD1, 0xBB, 0x0D, 0xD2, 0x62, 0x16, 0x18, 0x59, 0x64, 0xDD, 0x5B, 0xFD, 0x45, 0x67,
+    0xEA, 0xF4, 0x95, 0xB4, 0x68, 0xE6, 0x4D, 0x71, 0xED, 0x05, 0x3F, 0x3A, 0xC8, 0x6E, 0x57, 0x0F,
+    0x1E, 0x64, 0xAF, 0x87, 0x49, 0x21, 0xD5, 0x4E, 0x7D, 0x0C, 0x89, 0xAA, 0xAD, 0x41, 0x8A, 0x4D,
+    0x18, 0x0C, 0xAE, 0xAB, 0x07, 0x32, 0x8E, 0x7B, 0xC6, 0x47, 0x2B, 0xB4, 0x63, 0xB6, 0xB6, 0x8D,
+    0xAB, 0x25, 0xAA, 0xE8, 0x84, 0x82, 0xAC, 0xD5, 0x0D, 0xAE, 0x1E, 0x41, 0x6F, 0x3C, 0xD6, 0x77,
+    0xB0, 0xEB, 0x2A, 0xF4, 0x9B, 0x11, 0x8A, 0x0D, 0x50, 0xEF, 0x04, 0x70, 0x3D, 0x30, 0xF7, 0x83,
+    0x9C, 0x96, 0xAB, 0x31, 0x07, 0x80, 0x62, 0x5A, 0x6D, 0x14, 0x4B, 0xFB, 0xF2, 0x8B, 0x77, 0x9A,
+    0xEB, 0xBA, 0x77, 0xE4, 0x44, 0xD5, 0xDA, 0x7A, 0xEA, 0xA7, 0xD7, 0xF2, 0xCF, 0x8B, 0xDF, 0x53,
+    0x5B, 0x5C, 0xCD, 0x3A, 0x8E, 0x90, 0x38, 0xED, 0xC7, 0xF6, 0x8B, 0x9F, 0x78, 0xD9, 0x97, 0x7E,
+    0xE3, 0x0A, 0xAD, 0x7A, 0xBD, 0xCE, 0xEB, 0x07, 0x27, 0x7A, 0xA9, 0x5F, 0xBA, 0x1B, 0x97, 0xBD,
+    0xEB, 0xB5, 0x70, 0xDF, 0xD0, 0x1F, 0xAF, 0xE2, 0x6A, 0xBD, 0xF9, 0xAA, 0x84, 0xFE, 0x57, 0x7C,
+    0xEB, 0x2F, 0xF7, 0xF7, 0xF7, 0x73, 0x11, 0xE9, 0xA7, 0xC7, 0x6A, 0xFF, 0xB8, 0x17, 0xA3, 0x04,
+    0x28, 0xEA, 0x95, 0x64, 0xA6, 0x5C, 0x78, 0x58, 0xE5, 0xC1, 0x86, 0xDA, 0xC6, 0x55, 0x46, 0x4A,
+    0x77, 0x40, 0xD6, 0x1F, 0xDF, 0x29, 0xE9, 0xC4, 0xC5, 0x3F, 0x3A, 0xAE, 0xF6, 0x2E, 0xFF, 0x72,
+    0x7F, 0xFF, 0x2B, 0xA5, 0x88, 0x2C, 0x0A, 0x11, 0x91, 0xEA, 0xFC, 0xF8, 0x67, 0x5C, 0x1F, 0x7D,
+    0x72, 0xAD, 0x30, 0xDF, 0xBC, 0xF1, 0x56, 0x9C, 0xCC, 0xF2, 0x5F, 0xEE, 0x3F, 0x1F, 0xCE, 0x6A,
+    0x4E, 0xDA, 0x10, 0x5C, 0x33, 0xEC, 0x96, 0x7E, 0xA3, 0x82, 0x7C, 0x0C, 0x74, 0x33, 0xD0, 0xA1,
+    0x85, 0x42, 0x47, 0xE8, 0x8C, 0xC7, 0x78, 0x57, 0x53, 0x50, 0x40, 0xC7, 0x2E, 0xC6, 0xD3, 0x51,
+    0x92, 0x45, 0x5A, 0x74, 0xB0, 0x1E, 0xE7, 0xC7, 0x90, 0x3F, 0xDA, 0xC2, 0xD8, 0x79, 0x98, 0x8D,
+    0x8F, 0x5B, 0x58, 0x3A, 0x30, 0xDF, 0x8E, 0x50, 0x98, 0x00, 0x9D, 0xAB, 0x31, 0xBE, 0x20, 0x59,
+    0x8B, 0x96, 0x3E, 0xDD, 0xDC, 0x67, 0x8C, 0x6E, 0x54, 0x8B, 0xF5, 0xD6, 0x93, 0x57, 0x63, 0x18,
+    0xAB, 0x08, 0x13, 0xE7, 0xA1, 0x1D, 0x41, 0xF6, 0x56, 0x04, 0xF3, 0xAD, 0x7A, 0x10, 0xAC, 0x22,
+    0xAE, 0x94, 0x7B, 0x0F, 0xAC, 0x7F, 0x05, 0xA6, 0xD2, 0x32, 0x15, 0xA9, 0xA6, 0x95, 0x69, 0x4B,
+    0x28, 0x5D, 0x8D, 0x7D, 0x21, 0xA0, 0xDE, 0x8E, 0x30, 0x9A, 0x81, 0xBB, 0x06, 0xFA, 0xB6, 0x87,
+    0xBB, 0x31, 0xA5, 0xCD, 0x7F, 0x8E, 0x37, 0xEA, 0xA1, 0x23, 0xE3, 0x17, 0xFD, 0xBB, 0x6B, 0xA0,
+    0x5F, 0xF7, 0xF0, 0x76, 0x0B, 0xBB, 0x63, 0x28, 0x5C, 0x20, 0xBF, 0xB1, 0xA4, 0xF0, 0xB9, 0x48,
+    0x60, 0x2E, 0x35, 0x6A, 0x1B, 0x60, 0xFD, 0x6A, 0xAA, 0x52, 0x58, 0x2E, 0xC8, 0xE2, 0x26, 0x7A,
+    0xA8, 0xAA, 0x34, 0x4D, 0x3A, 0x97, 0xBF, 0xEA, 0xC3, 0x06, 0xB0, 0x9E, 0x4D, 0xE7, 0x99, 0x5E,
+    0xAB, 0x28, 0x17, 0x69, 0xC6, 0x14, 0x3F, 0xEA, 0x16, 0xC8, 0x57, 0xE5, 0xA0, 0x09, 0xD2, 0xF9,
+    0x6B, 0xAE, 0x35, 0x50, 0xD5, 0x12, 0x8A, 0x5B, 0x3D, 0x88, 0x6B, 0xC8, 0xFA, 0x35, 0x50, 0xD5,
+    0x1A, 0x50, 0x2D, 0x21, 0x3F, 0x79, 0xFF, 0xB7, 0xDE, 0xD3, 0x9D, 0xF9, 0xD3, 0xAE, 0xF3, 0xEF,
+    0x5F, 0xC9, 0x39, 0xA0, 0x9A, 0xBA, 0xB8, 0x58, 0x3F, 0x19, 0xA0, 0x2A, 0x6D, 0x3C, 0xCA, 0x7E,
+    0xF9, 0x89, 0x7E, 0xDA, 0xCA, 0x7F, 0x32, 0x96, 0xA8, 0xBE, 0xCA, 0x9A, 0x96, 0x56, 0xDF, 0x7A,
+    0x7B, 0x7E, 0x3B, 0x34, 0x4A, 0xC2, 0x69, 0x77, 0x8C, 0xFD, 0xFD, 0xFD, 0xAF, 0x96, 0x22, 0xB2,
+    0xB6, 0xBD, 0xBD, 0x7D, 0x3C, 0xF3, 0xC7, 0xF6, 0xF7, 0xF7, 0x9D, 0x88, 0xDC, 0xD8, 0xDE, 0xDE,
+    0xDE, 0xCA, 0xAE, 0xF2, 0xA8, 0x84, 0x8D, 0x72, 0xFE, 0xCA, 0xCB, 0x7E, 0xDE, 0x3D, 0xC4, 0x21,
+    0x1F, 0xE5, 0x4C, 0xBE, 0xC8, 0x5E, 0x92, 0xC5, 0xE1, 0xC4, 0xCA, 0x2D, 0xEE, 0x6F, 0xCE, 0x81,
+    0x72, 0x77, 0xF7, 0xE7, 0x37, 0x45, 0xA4, 0x51, 0x9F, 0xFD, 0x37, 0x27, 0xC3, 0x7F, 0x78, 0xFE,
+    0x35, 0x44, 0xA4, 0x1F, 0xFF, 0xF1, 0xF6, 0xB5, 0x93, 0x2E, 0xD1, 0xCD, 0xB5, 0xED, 0x9D, 0xFF,
+    0x56, 0xA4, 0xDF, 0xBF, 0xB6, 0x8F, 0xAD, 0xD0, 0x5E, 0x7D, 0xEA, 0x3B, 0x4F, 0x8A, 0xC8, 0xEF,
+    0xDD, 0xDD, 0xAF, 0xE3, 0x50, 0x81, 0xF1, 0x9E, 0x55, 0xAC, 0x06, 0x3C, 0xBB, 0xBF, 0xBF, 0xFF,
+    0x8C, 0x88, 0xC4, 0xED, 0xED, 0xED, 0x63, 0x3F, 0x39, 0x1B, 0x6C, 0x60, 0x7F, 0xDF, 0x90, 0x5A,
+    0x4C, 0x9D, 0x3F, 0x53, 0xCF, 0xB4, 0x61, 0x1A, 0x98, 0x06, 0xCA, 0x80, 0x5E, 0xA4, 0xD4, 0xAE,
+    0xED, 0xD2, 0x23, 0x4F, 0xE5, 0xEB, 0xC7, 0xCD, 0x0E, 0xA5, 0xC8, 0xAD, 0x94, 0x62, 0x56, 0x01,
+    0xCA, 0x90, 0x8A, 0x71, 0xA4, 0x46, 0x0D, 0x8F, 0xAC, 0x47, 0xCD, 0x6B, 0x25, 0xC3, 0x0F, 0x45,
+    0x7D, 0x52, 0xB4, 0x7C, 0xFA, 0xCF, 0x49, 0xE5, 0x04, 0x99, 0x27, 0x8F, 0xCC, 0x2B, 0xB3, 0xA4,
+    0x68, 0x95, 0x54, 0xB6, 0x63, 0x1A, 0xB2, 0x25, 0xAE, 0x65, 0x5A, 0x53, 0x06, 0xA4, 0x22, 0x6F,
+    0x99, 0x7B, 0xCC, 0x82, 0xA2, 0x21, 0x93, 0xCA, 0x76, 0x30, 0xF7, 0x66, 0x09, 0xC5, 0x4A, 0xDD,
+    0x0C, 0x13, 0x34, 0xD8, 0x0A, 0xDB, 0x51, 0x06, 0xCC, 0x92, 0xA2, 0x85, 0x79, 0x6D, 0x16, 0x50,
+    0x34, 0x4A, 0x2A, 0x6C, 0x64, 0xEA, 0x99, 0xFA, 0x6C, 0x49, 0x3E, 0xCC, 0x92, 0xB7, 0xE9, 0x1B,
+    0x45, 0x8B, 0xD4, 0xEC, 0xA2, 0x57, 0x4D, 0x0F, 0x4C, 0xE5, 0x6E, 0x95, 0x89, 0x48, 0x5C, 0xDF,
+    0xDF, 0xBF, 0x76, 0xEC, 0x7C, 0x99, 0xB8, 0xAA, 0x97, 0xC8, 0xAB, 0xC1, 0x9A, 0xAA, 0xEE, 0x1E,
+    0xE7, 0xAB, 0x1F, 0x9C, 0xAF, 0xAF, 0x2F, 0x56, 0xCE, 0xD7, 0xD5, 0xE3, 0x5B, 0x5B, 0x1D, 0xAC,
+    0x3C, 0xBC, 0x7C, 0x78, 0xF5, 0x61, 0x91, 0xE0, 0x44, 0xE4, 0x69, 0xD9, 0x5F, 0x7E, 0x2D, 0x0F,
+    0x3A, 0xB0, 0x20, 0x47, 0x37, 0xCC, 0xC8, 0x2B, 0x1D, 0x98, 0x91, 0x93, 0x45, 0x66, 0x98, 0xA0,
+    0x03, 0xAE, 0x76, 0x50, 0x56, 0x33, 0x28, 0x2F, 0x35, 0x30, 0x7D, 0x63, 0x7F, 0xBF, 0x2A, 0x45,
+    0x96, 0x98, 0xBB, 0xFB, 0x5F, 0x49, 0x4E, 0xEA, 0x64, 0x15, 0xD9, 0xBB, 0xEA, 0xB8, 0xC3, 0x4A,
+    0x55, 0xA7, 0x66, 0x5C, 0xCD, 0xAF, 0x44, 0x16, 0x58, 0x11, 0xF1, 0x1F, 0xDE, 0xBF, 0x36, 0x0F,
+    0x70, 0x90, 0x07, 0x74, 0xC8, 0x3D, 0x39, 0x05, 0xCC, 0xD8, 0x45, 0x87, 0xD4, 0x6B, 0x72, 0xBC,
+    0x9A, 0x1E, 0x87, 0x89, 0xCC, 0x98, 0xAF, 0x7F, 0xFD, 0xEE, 0xB5, 0xB6, 0x10, 0x59, 0xF2, 0xD9,
+    0xE5, 0x7E, 0x35, 0xCC, 0x78, 0xCF, 0xFC, 0x6B, 0xA7, 0xF1, 0x3D, 0x69, 0x0A, 0x11, 0xF9, 0xFC,
+    0xB2, 0x1A, 0x2C, 0x67, 0xBF, 0x2A, 0x16, 0x3F, 0xAE, 0x4A, 0x51, 0xC7, 0x1E, 0xAC, 0xF3, 0x2B,
+    0x23, 0x5B, 0x86, 0x24, 0x2F, 0x52, 0xE7, 0x22, 0x4B, 0xD4, 0x4A, 0xBE, 0xB7, 0xB7, 0xB7, 0xB7,
+    0xED, 0xCA, 0xF3, 0xED, 0x56, 0xE5, 0x2F, 0xB5, 0x5D, 0xF5, 0x1C, 0x35, 0xF7, 0x14, 0xAB, 0x15,
+    0xD5, 0xAA, 0xC7, 0xF4, 0x78, 0x9F, 0xF2, 0x95, 0x11, 0xB1, 0x0D, 0x28, 0xB1, 0x22, 0x12, 0x0B,
+    0x91, 0x05, 0xF7, 0xAD, 0xCE, 0x85, 0xDA, 0xDE, 0x1E, 0x22, 0x91, 0x79, 0x1A, 0xF5, 0x3E, 0x86,
+    0x8A, 0x64, 0xFB, 0xC3, 0x1F, 0x76, 0xB8, 0xFA, 0xB2, 0xF5, 0xAE, 0xBA, 0xC0, 0xC4, 0xD4, 0xA6,
+    0xB2, 0x97, 0xBC, 0x0A, 0xBC, 0x19, 0xB8, 0xCC, 0xC5, 0xE7, 0xB9, 0x80, 0x9E, 0x61, 0x2A, 0xE4,
+    0xE4, 0x8A, 0x5C, 0x40, 0xFF, 0x15, 0xA6, 0xE2, 0xF5, 0x4A, 0x05, 0x2E, 0x47, 0x2E, 0xB3, 0xB9,
+    0xC1, 0x05, 0x36, 0x74, 0x30, 0x55, 0xCE, 0x58, 0x85, 0x82, 0xEC, 0xCE, 0x37, 0x8E, 0x20, 0x97,
+    0x05, 0x70, 0xDF, 0x16, 0x9C, 0x9E, 0xF3, 0xB5, 0xFF, 0xAA, 0x4B, 0xED, 0xA5, 0xAE, 0x82, 0x89,
+    0xA9, 0xC1, 0x5E, 0xF2, 0xC0, 0x9B, 0x01, 0xB8, 0xF8, 0x3C, 0xA0, 0x67, 0xAB, 0x00, 0xF5, 0x78,
+    0x4E, 0xD0, 0x7F, 0x05, 0xF0, 0x7A, 0x05, 0x5C, 0x8E, 0xC0, 0xE6, 0x06, 0xB0, 0xA1, 0x03, 0xE4,
+    0x8C, 0xA1, 0x20, 0xBB, 0xA3, 0x7E, 0x8E, 0x39, 0x3D, 0xAA, 0x37, 0x33, 0xD4, 0xBB, 0x97, 0x5E,
+    0xF0, 0xAA, 0x7D, 0x33, 0x4C, 0x54, 0x7B, 0xE1, 0x79, 0x73, 0xA3, 0xD5, 0x33, 0x76, 0x23, 0x82,
+    0x89, 0x94, 0x5E, 0xF5, 0xB8, 0xA8, 0xDE, 0xF5, 0xFA, 0xAF, 0x54, 0x9C, 0xF0, 0xFA, 0xA3, 0xD1,
+    0xF8, 0xCB, 0x6F, 0x46, 0x26, 0x9B, 0x1B, 0x11, 0xF3, 0x9F, 0x75, 0x84, 0xE9, 0x2F, 0x32, 0x67,
+    0x85, 0xEA, 0x4D, 0x8D, 0x7A, 0xF7, 0x92, 0x47, 0xB5, 0x6F, 0x06, 0x54, 0x7B, 0xE1, 0x79, 0x54,
+    0xAB, 0x67, 0xA8, 0x16, 0x41, 0xB5, 0x94, 0x5E, 0xB5, 0xB8, 0xA8, 0x5A, 0xF4, 0x5F, 0xA9, 0x16,
+    0x5E, 0x7F, 0xB4, 0x85, 0xCB, 0x6F, 0xB6, 0xB0, 0xB9, 0xD1, 0xC2, 0x86, 0x6E, 0x7F, 0x06, 0x9D,
+    0x2B, 0x8F, 0xAC, 0x3C, 0x1D, 0x42, 0xFC, 0x52, 0x6F, 0xAC, 0xEF, 0xCF, 0xF7, 0xFF, 0x0F, 0x11,
+    0x59, 0xCE, 0x45, 0xA4, 0x3E, 0x7B, 0xA9, 0x2F, 0x6F, 0x76, 0x70, 0x16, 0xF5, 0x1C, 0x1F, 0x75,
+    0x51, 0x2D, 0x28, 0x6E, 0xF5, 0xCC, 0x6B, 0x17, 0x17, 0x38, 0xAF, 0xBA, 0xF7, 0xDB, 0xA9, 0xFB,
+    0x5F, 0xCD, 0x3B, 0x20, 0x97, 0x77, 0x25, 0x80, 0x09, 0x3B, 0xF1, 0x61, 0xA0, 0x4D, 0xD1, 0x6B,
+    0x91, 0x9C, 0x54, 0x1D, 0x52, 0xCE, 0x7C, 0x37, 0x39, 0x28, 0x3B, 0x49, 0xF0, 0xCB, 0x01, 0x88,
+    0x71, 0x75, 0xEA, 0x1F, 0x68, 0x13, 0x4A, 0x9E, 0xA7, 0x13, 0x98, 0xC5, 0x54, 0x9E, 0x31, 0xFE,
+    0x89, 0x43, 0x58, 0x9F, 0x90, 0xE7, 0x59, 0x3A, 0x0D, 0x2E, 0x85, 0xE9, 0x3F, 0x65, 0x88, 0xF2,
+    0xDE, 0x21, 0x26, 0xB8, 0x0A, 0x1E, 0x72, 0x4D, 0x16, 0xC1, 0xFE, 0x50, 0xEE, 0xF6, 0xC0, 0xBC,
+    0x9F, 0x2E, 0x81, 0xEC, 0x1B, 0xF7, 0x34, 0xBD, 0xAD, 0xDA, 0x4F, 0x72, 0xE9, 0x81, 0x5D, 0xD5,
+    0x03, 0x2D, 0x8F, 0xAC, 0xFA, 0x9D, 0x53, 0xDE, 0xDF, 0x78, 0x12, 0x51, 0xA9, 0xB5, 0x3A, 0x82,
+    0xAB, 0x53, 0x67, 0x7D, 0x92, 0x55, 0xE3, 0x87, 0xA6, 0x7A, 0xC6, 0xC3, 0x3D, 0x8A, 0xF2, 0x0A,
+    0x76, 0x29, 0x18, 0xD2, 0xA6, 0xCC, 0x18, 0x01, 0x1D, 0x93, 0x47, 0xA0, 0xE5, 0xB0, 0x45, 0x45,
+    0x24, 0x90, 0x45, 0xE6, 0xAB, 0xF6, 0xCA, 0x53, 0x53, 0x3D, 0xE4, 0x6A, 0xE0, 0x68, 0x87, 0xA1,
+    0x46, 0x13, 0x7E, 0xEF, 0xA4, 0x29, 0x5C, 0x01, 0x4C, 0xDF, 0xF5, 0x80, 0x48, 0x04, 0xD5, 0xAA,
+    0x0E, 0x68, 0x87, 0x79, 0xF2, 0x0A, 0x46, 0x58, 0x4F, 0x4A, 0x98, 0xB3, 0x23, 0xBE, 0x03, 0x91,
+    0xB8, 0x0B, 0x74, 0xE4, 0x9C, 0xFA, 0x38, 0x15, 0x1E, 0xB6, 0xA0, 0x9B, 0xE1, 0xAE, 0x32, 0xC5,
+    0xF1, 0x06, 0x14, 0xC3, 0xC7, 0x2A, 0x7D, 0x3C, 0x7B, 0x04, 0x5A, 0xCA, 0x09, 0x4C, 0x70, 0x0B,
+    0x28, 0xC8, 0x7A, 0x70, 0x9E, 0x73, 0xF7, 0xDC, 0x18, 0x2B, 0xA3, 0x03, 0xB2, 0x3B, 0xB3, 0x93,
+    0xA5, 0x9F, 0x7D, 0xF5, 0x7D, 0x12, 0xB5, 0x73, 0xD5, 0x4A, 0x05, 0x4A, 0xA4, 0x90, 0x16, 0x54,
+    0x7B, 0xFF, 0x92, 0x43, 0xA0, 0x65, 0xCA, 0x59, 0x60, 0x36, 0xDC, 0x4E, 0x69, 0x34, 0xDC, 0x8B,
+    0x20, 0xAF, 0x52, 0x45, 0xFC, 0x8E, 0x88, 0x48, 0xBF, 0x52, 0x23, 0x40, 0x97, 0xEE, 0x08, 0xC3,
+    0x28, 0x55, 0x14, 0x26, 0x9A, 0xBA, 0x81, 0xAA, 0xDD, 0x81, 0xAE, 0x62, 0xA0, 0xCC, 0xF9, 0x44,
+    0x9B, 0x0E, 0x89, 0x3A, 0x15, 0x07, 0xFA, 0x66, 0xC3, 0x17, 0xC7, 0x0F, 0x0C, 0x5F, 0xFC, 0x73,
+    0x98, 0xE0, 0x6A, 0x23, 0x50, 0xA0, 0x03, 0x4B, 0x70, 0x5E, 0xAD, 0x76, 0x69, 0xE8, 0x03, 0x4D,
+    0xB7, 0x56, 0x63, 0x99, 0x52, 0x0F, 0x77, 0xE6, 0xCB, 0x39, 0x27, 0x52, 0xC6, 0xD9, 0x57, 0xEF,
+    0xAD, 0xCF, 0xA0, 0x02, 0xEE, 0x7F, 0x35, 0x93, 0x43, 0x20, 0x97, 0xB7, 0x64, 0x38, 0x4B, 0x1D,
+    0xB3, 0x81, 0x70, 0xEB, 0x87, 0xD9, 0xFA, 0x61, 0x16, 0x57, 0xA7, 0xF5, 0xAA, 0x76, 0x38, 0x50,
+    0xC5, 0x70, 0xA2, 0x2E, 0xC5, 0xE1, 0x48, 0x8D, 0x07, 0xCA, 0x92, 0x14, 0xA6, 0x4D, 0xCC, 0xE2,
+    0xC0, 0xB6, 0x71, 0x8A, 0x86, 0x86, 0xB1, 0xAA, 0x61, 0xAC, 0x38, 0x9C, 0xAC, 0x62, 0x10, 0x16,
+    0x1D, 0x87, 0xB3, 0x35, 0x7E, 0x38, 0x8D, 0x65, 0x6E, 0xD7, 0x69, 0xAC, 0x69, 0x93, 0xC6, 0xD2,
+    0xDD, 0xF1, 0xF9, 0x3A, 0xA6, 0x7E, 0x38, 0x61, 0xAB, 0x23, 0x76, 0x7C, 0xC6, 0x8E, 0xC9, 0x7F,
+    0xDF, 0x29, 0x4B, 0x37, 0x9E, 0x05, 0x9D, 0x62, 0xD6, 0xB1, 0xA9, 0x13, 0x13, 0x3F, 0x02, 0xB8,
+    0x3A, 0x6B, 0x52, 0xBF, 0x6C, 0x05, 0x2A, 0x32, 0x19, 0xB6, 0xBA, 0xC5, 0x0D, 0xF7, 0x96, 0xEA,
+    0x52, 0x46, 0x20, 0xA8, 0x96, 0xD5, 0x79, 0x63, 0x96, 0x40, 0x81, 0x86, 0x8E, 0xD5, 0x49, 0x64,
+    0x97, 0x3C, 0x69, 0x85, 0x74, 0x83, 0xBC, 0x2C, 0x9E, 0x49, 0x47, 0xF2, 0x3A, 0xB4, 0x94, 0x4F,
+    0x79, 0x8C, 0x47, 0x7A, 0x28, 0x50, 0x52, 0x41, 0x0F, 0xD5, 0x4A, 0x7C, 0x93, 0x03, 0x92, 0xE4,
+    0x97, 0xE2, 0x4B, 0xFE, 0x44, 0x80, 0xF9, 0xF3, 0xEA, 0x3D, 0x87, 0x4F, 0x00, 0x73, 0x77, 0x0E,
+    0x38, 0xC6, 0xC0, 0x45, 0x46, 0xC0, 0x88, 0x09, 0xE4, 0x8B, 0x75, 0xE9, 0x91, 0x65, 0x2E, 0xBD,
+    0x6E, 0x1E, 0x50, 0xDD, 0x90, 0x72, 0x31, 0x81, 0x2C, 0xA2, 0x5B, 0x74, 0x24, 0x5B, 0xA2, 0x1B,
+    0x98, 0xD7, 0x3A, 0x40, 0xDE, 0x18, 0xCF, 0x90, 0xD8, 0xCB, 0xA2, 0xAB, 0xCF, 0x5D, 0x56, 0xD1,
+    0xD5, 0xCF, 0x1F, 0xE9, 0xC6, 0xBD, 0x1C, 0xA7, 0xE2, 0x9D, 0xD4, 0xF9, 0x02, 0xB3, 0x80, 0x6A,
+    0x70, 0xFC, 0x1E, 0x3A, 0x7D, 0x03, 0xE1, 0x62, 0xB8, 0x2F, 0x63, 0x03, 0xB0, 0xF1, 0xE9, 0x06,
+    0xC8, 0x7C, 0xD6, 0x00, 0x1B, 0xA8, 0x06, 0xB2, 0xFE, 0x1F, 0x65, 0x0D, 0x14, 0x22, 0xBA, 0x21,
+    0x13, 0x11, 0xD7, 0x50, 0x88, 0xF4, 0x45, 0x93, 0x89, 0x48, 0x9C, 0x37, 0x85, 0x88, 0x3C, 0x26,
+    0xDF, 0x17, 0x59, 0x56, 0x4E, 0x7E, 0x20, 0xE2, 0x11, 0xD1, 0x22, 0x14, 0x12, 0xB5, 0xF4, 0x56,
+    0x04, 0x2D, 0x71, 0x2E, 0x11, 0x2D, 0x2F, 0x8A, 0xB0, 0xD2, 0x7F, 0x5A, 0xDE, 0x10, 0x40, 0xF7,
+    0x2E, 0x9E, 0x14, 0x42, 0xEB, 0x6F, 0xA7, 0x23, 0x22, 0xA7, 0x6F, 0x25, 0xA0, 0x4F, 0x24, 0xE0,
+    0xFF, 0x03,
 };
 
 static const EpdGlyph bookerly_14_italicGlyphs[] = {
@@ -1902,7 +1937,7 @@ static const EpdGlyph bookerly_14_italicGlyphs[] = {
     { 8, 27, 8, 0, 23, 54, 7679 }, // |
     { 11, 29, 11, -1, 24, 80, 7733 }, // }
     { 14, 6, 18, 2, 13, 21, 7813 }, // ~
-    { 0, 0, 6, 0, 0, 0, 0 }, //  
+    { 0, 0, 6, 0, 0, 0, 7834 }, //  
     { 9, 23, 9, -1, 16, 52, 0 }, // ¡
     { 14, 29, 18, 2, 23, 102, 52 }, // ¢
     { 19, 22, 18, -1, 21, 105, 154 }, // £
@@ -1913,642 +1948,649 @@ static const EpdGlyph bookerly_14_italicGlyphs[] = {
     { 10, 4, 18, 4, 22, 10, 546 }, // ¨
     { 22, 22, 23, 0, 21, 121, 556 }, // ©
     { 11, 14, 13, 1, 21, 39, 677 }, // ª
-    { 14, 11, 15, 1, 13, 39, 716 }, // «
-    { 13, 8, 18, 3, 14, 26, 755 }, // ¬
-    { 9, 3, 11, 1, 9, 7, 781 }, // ­
-    { 17, 16, 17, 0, 23, 68, 788 }, // ®
-    { 10, 3, 18, 4, 21, 8, 856 }, // ¯
-    { 11, 11, 15, 2, 21, 31, 864 }, // °
-    { 13, 17, 18, 3, 17, 56, 895 }, // ±
-    { 11, 14, 13, 1, 24, 39, 951 }, // ²
-    { 10, 14, 13, 1, 24, 35, 990 }, // ³
-    { 6, 7, 18, 6, 24, 11, 1025 }, // ´
-    { 19, 24, 17, -1, 16, 114, 1036 }, // µ
-    { 19, 26, 17, -1, 21, 124, 1150 }, // ¶
-    { 5, 5, 9, 2, 10, 7, 1274 }, // ·
-    { 6, 7, 18, 6, -1, 11, 1281 }, // ¸
-    { 8, 14, 13, 2, 24, 28, 1292 }, // ¹
-    { 11, 14, 13, 1, 21, 39, 1320 }, // º
-    { 14, 11, 15, 0, 13, 39, 1359 }, // »
-    { 28, 24, 31, 2, 22, 168, 1398 }, // ¼
-    { 28, 24, 31, 2, 22, 168, 1566 }, // ½
-    { 29, 24, 31, 1, 22, 174, 1734 }, // ¾
-    { 10, 22, 12, 0, 16, 55, 1908 }, // ¿
-    { 22, 28, 21, -2, 28, 154, 1963 }, // À
-    { 22, 28, 21, -2, 28, 154, 2117 }, // Á
-    { 22, 28, 21, -2, 28, 154, 2271 }, // Â
-    { 22, 28, 21, -2, 28, 154, 2425 }, // Ã
-    { 22, 27, 21, -2, 27, 149, 2579 }, // Ä
-    { 22, 29, 21, -2, 29, 160, 2728 }, // Å
-    { 29, 21, 26, -3, 21, 153, 2888 }, // Æ
-    { 18, 29, 19, 1, 21, 131, 3041 }, // Ç
-    { 19, 28, 18, -1, 28, 133, 3172 }, // È
-    { 19, 28, 18, -1, 28, 133, 3305 }, // É
-    { 19, 28, 18, -1, 28, 133, 3438 }, // Ê
-    { 19, 27, 18, -1, 27, 129, 3571 }, // Ë
-    { 13, 28, 11, -1, 28, 91, 3700 }, // Ì
-    { 14, 28, 11, -1, 28, 98, 3791 }, // Í
-    { 15, 28, 11, -1, 28, 105, 3889 }, // Î
-    { 15, 27, 11, -1, 27, 102, 3994 }, // Ï
-    { 21, 22, 21, -1, 21, 116, 4096 }, // Ð
-    { 25, 29, 22, -1, 28, 182, 4212 }, // Ñ
-    { 20, 29, 21, 1, 28, 145, 4394 }, // Ò
-    { 20, 29, 21, 1, 28, 145, 4539 }, // Ó
-    { 20, 29, 21, 1, 28, 145, 4684 }, // Ô
-    { 20, 29, 21, 1, 28, 145, 4829 }, // Õ
-    { 20, 28, 21, 1, 27, 140, 4974 }, // Ö
-    { 12, 12, 18, 3, 16, 36, 5114 }, // ×
-    { 23, 22, 21, -1, 21, 127, 5150 }, // Ø
-    { 22, 29, 22, 2, 28, 160, 5277 }, // Ù
-    { 22, 29, 22, 2, 28, 160, 5437 }, // Ú
-    { 22, 29, 22, 2, 28, 160, 5597 }, // Û
-    { 22, 28, 22, 2, 27, 154, 5757 }, // Ü
-    { 20, 28, 19, 1, 28, 140, 5911 }, // Ý
-    { 18, 21, 17, -1, 21, 95, 6051 }, // Þ
-    { 23, 30, 19, -5, 23, 173, 6146 }, // ß
-    { 16, 25, 17, 1, 24, 100, 6319 }, // à
-    { 16, 25, 17, 1, 24, 100, 6419 }, // á
-    { 16, 25, 17, 1, 24, 100, 6519 }, // â
-    { 16, 24, 17, 1, 23, 96, 6619 }, // ã
-    { 16, 23, 17, 1, 22, 92, 6715 }, // ä
-    { 16, 25, 17, 1, 24, 100, 6807 }, // å
-    { 21, 17, 22, 1, 16, 90, 6907 }, // æ
-    { 12, 24, 13, 1, 16, 72, 6997 }, // ç
-    { 12, 25, 14, 1, 24, 75, 7069 }, // è
-    { 13, 25, 14, 1, 24, 82, 7144 }, // é
-    { 13, 25, 14, 1, 24, 82, 7226 }, // ê
-    { 14, 23, 14, 1, 22, 81, 7308 }, // ë
-    { 8, 25, 10, 1, 24, 50, 7389 }, // ì
-    { 11, 25, 10, 1, 24, 69, 7439 }, // í
-    { 11, 25, 10, 1, 24, 69, 7508 }, // î
-    { 11, 23, 10, 1, 22, 64, 7577 }, // ï
-    { 15, 25, 16, 0, 24, 94, 7641 }, // ð
-    { 16, 24, 18, 1, 23, 96, 7735 }, // ñ
-    { 14, 25, 16, 1, 24, 88, 7831 }, // ò
-    { 14, 25, 16, 1, 24, 88, 7919 }, // ó
-    { 14, 25, 16, 1, 24, 88, 8007 }, // ô
-    { 15, 24, 16, 1, 23, 90, 8095 }, // õ
-    { 15, 23, 16, 1, 22, 87, 8185 }, // ö
-    { 13, 14, 18, 3, 17, 46, 8272 }, // ÷
-    { 19, 17, 16, -2, 16, 81, 8318 }, // ø
-    { 16, 25, 18, 1, 24, 100, 8399 }, // ù
-    { 16, 25, 18, 1, 24, 100, 8499 }, // ú
-    { 16, 25, 18, 1, 24, 100, 8599 }, // û
-    { 16, 23, 18, 1, 22, 92, 8699 }, // ü
-    { 18, 31, 16, -3, 24, 140, 8791 }, // ý
-    { 18, 30, 16, -3, 23, 135, 8931 }, // þ
-    { 18, 29, 16, -3, 22, 131, 9066 }, // ÿ
-    { 22, 26, 21, -2, 26, 143, 0 }, // Ā
-    { 16, 22, 17, 1, 21, 88, 143 }, // ā
-    { 22, 28, 21, -2, 28, 154, 231 }, // Ă
-    { 16, 24, 17, 1, 23, 96, 385 }, // ă
-    { 22, 28, 21, -2, 21, 154, 481 }, // Ą
-    { 16, 23, 17, 1, 16, 92, 635 }, // ą
-    { 18, 29, 19, 1, 28, 131, 727 }, // Ć
-    { 13, 25, 13, 1, 24, 82, 858 }, // ć
-    { 18, 29, 19, 1, 28, 131, 940 }, // Ĉ
-    { 13, 25, 13, 1, 24, 82, 1071 }, // ĉ
-    { 18, 29, 19, 1, 28, 131, 1153 }, // Ċ
-    { 12, 23, 13, 1, 22, 69, 1284 }, // ċ
-    { 18, 29, 19, 1, 28, 131, 1353 }, // Č
-    { 14, 25, 13, 1, 24, 88, 1484 }, // č
-    { 21, 29, 21, -1, 28, 153, 1572 }, // Ď
-    { 21, 26, 18, 1, 25, 137, 1725 }, // ď
-    { 21, 22, 21, -1, 21, 116, 1862 }, // Đ
-    { 18, 24, 17, 1, 23, 108, 1978 }, // đ
-    { 19, 26, 18, -1, 26, 124, 2086 }, // Ē
-    { 13, 22, 14, 1, 21, 72, 2210 }, // ē
-    { 19, 28, 18, -1, 28, 133, 2282 }, // Ĕ
-    { 14, 24, 14, 1, 23, 84, 2415 }, // ĕ
-    { 19, 28, 18, -1, 28, 133, 2499 }, // Ė
-    { 12, 23, 14, 1, 22, 69, 2632 }, // ė
-    { 19, 28, 18, -1, 21, 133, 2701 }, // Ę
-    { 12, 23, 14, 1, 16, 69, 2834 }, // ę
-    { 19, 28, 18, -1, 28, 133, 2903 }, // Ě
-    { 14, 25, 14, 1, 24, 88, 3036 }, // ě
-    { 19, 29, 21, 1, 28, 138, 3124 }, // Ĝ
-    { 19, 31, 14, -3, 24, 148, 3262 }, // ĝ
-    { 19, 29, 21, 1, 28, 138, 3410 }, // Ğ
-    { 19, 30, 14, -3, 23, 143, 3548 }, // ğ
-    { 19, 29, 21, 1, 28, 138, 3691 }, // Ġ
-    { 19, 29, 14, -3, 22, 138, 3829 }, // ġ
-    { 19, 29, 21, 1, 21, 138, 3967 }, // Ģ
-    { 19, 32, 14, -3, 25, 152, 4105 }, // ģ
-    { 25, 28, 23, -1, 28, 175, 4257 }, // Ĥ
-    { 17, 31, 17, 0, 30, 132, 4432 }, // ĥ
-    { 25, 21, 23, -1, 21, 132, 4564 }, // Ħ
-    { 17, 24, 17, 0, 23, 102, 4696 }, // ħ
-    { 14, 28, 11, -1, 28, 98, 4798 }, // Ĩ
-    { 11, 24, 10, 1, 23, 66, 4896 }, // ĩ
-    { 14, 26, 11, -1, 26, 91, 4962 }, // Ī
-    { 11, 22, 10, 1, 21, 61, 5053 }, // ī
-    { 15, 28, 11, -1, 28, 105, 5114 }, // Ĭ
-    { 11, 24, 10, 1, 23, 66, 5219 }, // ĭ
-    { 13, 28, 11, -1, 21, 91, 5285 }, // Į
-    { 9, 30, 9, 1, 23, 68, 5376 }, // į
-    { 13, 28, 11, -1, 28, 91, 5444 }, // İ
-    { 8, 17, 9, 1, 16, 34, 5535 }, // ı
-    { 24, 27, 21, -1, 21, 162, 5569 }, // Ĳ
-    { 18, 30, 18, 1, 23, 135, 5731 }, // ĳ
-    { 19, 34, 10, -5, 28, 162, 5866 }, // Ĵ
-    { 17, 31, 8, -6, 24, 132, 6028 }, // ĵ
-    { 23, 29, 20, -1, 21, 167, 6160 }, // Ķ
-    { 14, 31, 15, 1, 23, 109, 6327 }, // ķ
-    { 15, 17, 16, 1, 16, 64, 6436 }, // ĸ
-    { 17, 28, 17, -1, 28, 119, 6500 }, // Ĺ
-    { 10, 31, 9, 1, 30, 78, 6619 }, // ĺ
-    { 17, 29, 17, -1, 21, 124, 6697 }, // Ļ
-    { 10, 31, 9, -1, 23, 78, 6821 }, // ļ
-    { 18, 23, 17, -1, 23, 104, 6899 }, // Ľ
-    { 13, 26, 10, 1, 25, 85, 7003 }, // ľ
-    { 18, 21, 17, -1, 21, 95, 7088 }, // Ŀ
-    { 12, 24, 12, 1, 23, 72, 7183 }, // ŀ
-    { 17, 21, 17, -1, 21, 90, 7255 }, // Ł
-    { 11, 24, 9, -1, 23, 66, 7345 }, // ł
-    { 25, 29, 22, -1, 28, 182, 7411 }, // Ń
-    { 16, 25, 18, 1, 24, 100, 7593 }, // ń
-    { 25, 29, 22, -1, 21, 182, 7693 }, // Ņ
-    { 16, 24, 18, 1, 16, 96, 7875 }, // ņ
-    { 25, 29, 22, -1, 28, 182, 7971 }, // Ň
-    { 16, 25, 18, 1, 24, 100, 8153 }, // ň
-    { 21, 23, 24, 2, 22, 121, 8253 }, // ŉ
-    { 25, 27, 22, -1, 21, 169, 8374 }, // Ŋ
-    { 15, 23, 17, 1, 16, 87, 8543 }, // ŋ
-    { 20, 27, 21, 1, 26, 135, 8630 }, // Ō
-    { 15, 22, 16, 1, 21, 83, 8765 }, // ō
-    { 20, 29, 21, 1, 28, 145, 8848 }, // Ŏ
-    { 15, 24, 16, 1, 23, 90, 8993 }, // ŏ
-    { 21, 30, 21, 1, 29, 158, 9083 }, // Ő
-    { 16, 25, 16, 1, 24, 100, 9241 }, // ő
-    { 27, 22, 28, 1, 21, 149, 9341 }, // Œ
-    { 22, 17, 24, 1, 16, 94, 9490 }, // œ
-    { 19, 29, 19, -1, 28, 138, 9584 }, // Ŕ
-    { 13, 24, 12, 1, 24, 78, 9722 }, // ŕ
-    { 19, 29, 19, -1, 21, 138, 9800 }, // Ŗ
-    { 14, 24, 12, -1, 16, 84, 9938 }, // ŗ
-    { 19, 29, 19, -1, 28, 138, 10022 }, // Ř
-    { 14, 24, 12, 1, 24, 84, 10160 }, // ř
-    { 15, 29, 15, 0, 28, 109, 10244 }, // Ś
-    { 13, 25, 12, 0, 24, 82, 10353 }, // ś
-    { 15, 29, 15, 0, 28, 109, 10435 }, // Ŝ
-    { 13, 25, 12, 0, 24, 82, 10544 }, // ŝ
-    { 15, 29, 15, 0, 21, 109, 10626 }, // Ş
-    { 12, 24, 12, 0, 16, 72, 10735 }, // ş
-    { 16, 29, 15, 0, 28, 116, 10807 }, // Š
-    { 14, 25, 12, 0, 24, 88, 10923 }, // š
-    { 18, 29, 19, 2, 21, 131, 11011 }, // Ţ
-    { 12, 27, 11, 0, 19, 81, 11142 }, // ţ
-    { 18, 28, 19, 2, 28, 126, 11223 }, // Ť
-    { 13, 25, 11, 0, 24, 82, 11349 }, // ť
-    { 18, 21, 19, 2, 21, 95, 11431 }, // Ŧ
-    { 12, 20, 11, 0, 19, 60, 11526 }, // ŧ
-    { 22, 29, 22, 2, 28, 160, 11586 }, // Ũ
-    { 16, 24, 18, 1, 23, 96, 11746 }, // ũ
-    { 22, 27, 22, 2, 26, 149, 11842 }, // Ū
-    { 16, 22, 18, 1, 21, 88, 11991 }, // ū
-    { 22, 29, 22, 2, 28, 160, 12079 }, // Ŭ
-    { 16, 24, 18, 1, 23, 96, 12239 }, // ŭ
-    { 22, 30, 22, 2, 29, 165, 12335 }, // Ů
-    { 16, 25, 18, 1, 24, 100, 12500 }, // ů
-    { 22, 30, 22, 2, 29, 165, 12600 }, // Ű
-    { 16, 25, 18, 1, 24, 100, 12765 }, // ű
-    { 22, 28, 22, 2, 21, 154, 12865 }, // Ų
-    { 16, 23, 18, 1, 16, 92, 13019 }, // ų
-    { 30, 29, 30, 2, 28, 218, 13111 }, // Ŵ
-    { 22, 25, 22, 0, 24, 138, 13329 }, // ŵ
-    { 20, 28, 19, 1, 28, 140, 13467 }, // Ŷ
-    { 18, 31, 16, -3, 24, 140, 13607 }, // ŷ
-    { 20, 27, 19, 1, 27, 135, 13747 }, // Ÿ
-    { 18, 29, 17, -1, 28, 131, 13882 }, // Ź
-    { 14, 25, 14, 0, 24, 88, 14013 }, // ź
-    { 18, 29, 17, -1, 28, 131, 14101 }, // Ż
-    { 14, 23, 14, 0, 22, 81, 14232 }, // ż
-    { 18, 29, 17, -1, 28, 131, 14313 }, // Ž
-    { 14, 25, 14, 0, 24, 88, 14444 }, // ž
-    { 20, 30, 12, -5, 23, 150, 14532 }, // ſ
-    { 6, 8, 0, -4, 24, 12, 0 }, // ̀
-    { 6, 7, 0, -2, 24, 11, 12 }, // ́
-    { 10, 7, 0, -6, 24, 18, 23 }, // ̂
-    { 10, 6, 0, -5, 23, 15, 41 }, // ̃
-    { 10, 3, 0, -5, 21, 8, 56 }, // ̄
-    { 10, 6, 0, -5, 23, 15, 64 }, // ̆
-    { 4, 4, 0, -2, 22, 4, 79 }, // ̇
-    { 10, 4, 0, -5, 22, 10, 83 }, // ̈
-    { 8, 9, 0, -4, 26, 18, 93 }, // ̉
-    { 8, 8, 0, -4, 24, 16, 111 }, // ̊
-    { 11, 7, 0, -5, 24, 20, 127 }, // ̋
-    { 10, 7, 0, -4, 24, 18, 147 }, // ̌
-    { 9, 8, 0, -6, 24, 18, 165 }, // ̏
-    { 10, 6, 0, -5, 23, 15, 183 }, // ̑
-    { 6, 9, 0, -3, 25, 14, 198 }, // ̒
-    { 7, 9, 0, -3, 26, 16, 212 }, // ̓
-    { 6, 9, 0, -4, 26, 14, 228 }, // ̔
-    { 4, 8, 0, -2, 25, 8, 242 }, // ̕
-    { 6, 7, 0, -3, 19, 11, 250 }, // ̛
-    { 4, 5, 0, -2, -2, 5, 261 }, // ̣
-    { 10, 5, 0, -5, -2, 13, 266 }, // ̤
-    { 8, 7, 0, -4, -1, 14, 279 }, // ̥
-    { 6, 7, 0, -3, -1, 11, 293 }, // ̦
-    { 6, 7, 0, -3, -1, 11, 304 }, // ̧
-    { 6, 8, 0, -3, 1, 12, 315 }, // ̨
-    { 5, 7, 8, -1, -1, 9, 327 }, // ̩
-    { 11, 6, 0, -6, -2, 17, 336 }, // ̭
-    { 10, 6, 0, -5, -1, 15, 353 }, // ̮
-    { 10, 5, 0, -5, -2, 13, 368 }, // ̰
-    { 10, 3, 0, -5, -3, 8, 381 }, // ̱
-    { 10, 6, 0, -5, 23, 15, 389 }, // ͂
-    { 11, 11, 0, -6, 29, 31, 404 }, // ̈́
-    { 6, 5, 0, -2, -2, 8, 435 }, // ͅ
-    { 19, 28, 18, -1, 28, 133, 0 }, // Ѐ
-    { 19, 27, 18, -1, 27, 129, 133 }, // Ё
-    { 18, 27, 22, 2, 21, 122, 262 }, // Ђ
-    { 19, 28, 16, -1, 28, 133, 384 }, // Ѓ
-    { 18, 22, 19, 1, 21, 99, 517 }, // Є
-    { 15, 22, 15, 0, 21, 83, 616 }, // Ѕ
-    { 13, 21, 11, -1, 21, 69, 699 }, // І
-    { 15, 27, 11, -1, 27, 102, 768 }, // Ї
-    { 17, 27, 10, -5, 21, 115, 870 }, // Ј
-    { 27, 22, 26, -2, 21, 149, 985 }, // Љ
-    { 27, 22, 27, -1, 21, 149, 1134 }, // Њ
-    { 19, 21, 23, 2, 21, 100, 1283 }, // Ћ
-    { 22, 29, 20, -1, 28, 160, 1383 }, // Ќ
-    { 25, 28, 23, -1, 28, 175, 1543 }, // Ѝ
-    { 20, 30, 18, 1, 29, 150, 1718 }, // Ў
-    { 24, 28, 22, -1, 21, 168, 1868 }, // Џ
-    { 22, 21, 21, -2, 21, 116, 2036 }, // А
-    { 18, 22, 17, -1, 21, 99, 2152 }, // Б
-    { 18, 22, 18, -1, 21, 99, 2251 }, // В
-    { 19, 21, 16, -1, 21, 100, 2350 }, // Г
-    { 24, 27, 21, -2, 21, 162, 2450 }, // Д
-    { 19, 21, 18, -1, 21, 100, 2612 }, // Е
-    { 31, 22, 28, -2, 21, 171, 2712 }, // Ж
-    { 15, 22, 16, 0, 21, 83, 2883 }, // З
-    { 25, 21, 23, -1, 21, 132, 2966 }, // И
-    { 25, 29, 23, -1, 29, 182, 3098 }, // Й
-    { 22, 22, 20, -1, 21, 121, 3280 }, // К
-    { 23, 22, 20, -2, 21, 127, 3401 }, // Л
-    { 28, 21, 26, -2, 21, 147, 3528 }, // М
-    { 25, 21, 23, -1, 21, 132, 3675 }, // Н
-    { 20, 22, 21, 1, 21, 110, 3807 }, // О
-    { 24, 21, 22, -1, 21, 126, 3917 }, // П
-    { 18, 21, 17, -1, 21, 95, 4043 }, // Р
-    { 18, 22, 19, 1, 21, 99, 4138 }, // С
-    { 18, 21, 19, 2, 21, 95, 4237 }, // Т
-    { 20, 22, 18, 1, 21, 110, 4332 }, // У
-    { 21, 22, 21, 0, 21, 116, 4442 }, // Ф
-    { 24, 21, 19, -3, 21, 126, 4558 }, // Х
-    { 24, 27, 22, -1, 21, 162, 4684 }, // Ц
-    { 20, 21, 20, 1, 21, 105, 4846 }, // Ч
-    { 31, 21, 29, -1, 21, 163, 4951 }, // Ш
-    { 31, 27, 29, -1, 21, 210, 5114 }, // Щ
-    { 18, 22, 20, 2, 21, 99, 5324 }, // Ъ
-    { 29, 22, 26, -1, 21, 160, 5423 }, // Ы
-    { 17, 22, 17, -1, 21, 94, 5583 }, // Ь
-    { 17, 22, 18, 0, 21, 94, 5677 }, // Э
-    { 29, 22, 29, -1, 21, 160, 5771 }, // Ю
-    { 21, 22, 19, -2, 21, 116, 5931 }, // Я
-    { 16, 17, 17, 1, 16, 68, 6047 }, // а
-    { 16, 24, 16, 1, 23, 96, 6115 }, // б
-    { 13, 17, 15, 1, 16, 56, 6211 }, // в
-    { 12, 17, 13, 0, 16, 51, 6267 }, // г
-    { 14, 24, 16, 1, 23, 84, 6318 }, // д
-    { 12, 17, 14, 1, 16, 51, 6402 }, // е
-    { 26, 17, 26, 0, 16, 111, 6453 }, // ж
-    { 12, 17, 13, 0, 16, 51, 6564 }, // з
-    { 16, 17, 18, 1, 16, 68, 6615 }, // и
-    { 16, 25, 18, 1, 24, 100, 6683 }, // й
-    { 15, 17, 16, 1, 16, 64, 6783 }, // к
-    { 18, 17, 18, -1, 16, 77, 6847 }, // л
-    { 22, 17, 22, 0, 16, 94, 6924 }, // м
-    { 16, 17, 18, 1, 16, 68, 7018 }, // н
-    { 14, 17, 16, 1, 16, 60, 7086 }, // о
-    { 16, 17, 18, 1, 16, 68, 7146 }, // п
-    { 18, 23, 17, -2, 16, 104, 7214 }, // р
-    { 12, 17, 13, 1, 16, 51, 7318 }, // с
-    { 24, 17, 26, 1, 16, 102, 7369 }, // т
-    { 18, 23, 16, -3, 16, 104, 7471 }, // у
-    { 18, 30, 20, 1, 23, 135, 7575 }, // ф
-    { 18, 17, 16, -1, 16, 77, 7710 }, // х
-    { 17, 22, 18, 1, 16, 94, 7787 }, // ц
-    { 16, 17, 17, 1, 16, 68, 7881 }, // ч
-    { 23, 17, 24, 1, 16, 98, 7949 }, // ш
-    { 23, 22, 25, 1, 16, 127, 8047 }, // щ
-    { 14, 17, 15, 1, 16, 60, 8174 }, // ъ
-    { 20, 17, 22, 1, 16, 85, 8234 }, // ы
-    { 13, 17, 14, 0, 16, 56, 8319 }, // ь
-    { 13, 17, 14, 0, 16, 56, 8375 }, // э
-    { 21, 17, 23, 1, 16, 90, 8431 }, // ю
-    { 16, 16, 16, -1, 15, 64, 8521 }, // я
-    { 12, 25, 14, 1, 24, 75, 8585 }, // ѐ
-    { 14, 23, 14, 1, 22, 81, 8660 }, // ё
-    { 15, 30, 16, 0, 23, 113, 8741 }, // ђ
-    { 13, 25, 13, 0, 24, 82, 8854 }, // ѓ
-    { 12, 17, 14, 1, 16, 51, 8936 }, // є
-    { 12, 17, 12, 0, 16, 51, 8987 }, // ѕ
-    { 9, 24, 9, 1, 23, 54, 9038 }, // і
-    { 11, 23, 9, 1, 22, 64, 9092 }, // ї
-    { 15, 30, 8, -6, 23, 113, 9156 }, // ј
-    { 22, 17, 21, -1, 16, 94, 9269 }, // љ
-    { 19, 17, 21, 1, 16, 81, 9363 }, // њ
-    { 17, 24, 17, 0, 23, 102, 9444 }, // ћ
-    { 15, 25, 16, 1, 24, 94, 9546 }, // ќ
-    { 16, 25, 18, 1, 24, 100, 9640 }, // ѝ
-    { 18, 31, 16, -3, 24, 140, 9740 }, // ў
-    { 16, 22, 18, 1, 16, 88, 9880 }, // џ
-    { 18, 24, 19, 1, 23, 108, 9968 }, // Ѣ
-    { 20, 17, 21, 1, 16, 85, 10076 }, // ѣ
-    { 20, 22, 21, 1, 21, 110, 10161 }, // Ѳ
-    { 14, 17, 16, 1, 16, 60, 10271 }, // ѳ
-    { 21, 22, 21, 2, 21, 116, 10331 }, // Ѵ
-    { 18, 17, 16, 0, 16, 77, 10447 }, // ѵ
-    { 25, 35, 23, -1, 29, 219, 10524 }, // Ҋ
-    { 17, 30, 18, 1, 24, 128, 10743 }, // ҋ
-    { 17, 22, 17, -1, 21, 94, 10871 }, // Ҍ
-    { 13, 22, 14, 1, 21, 72, 10965 }, // ҍ
-    { 18, 21, 17, -1, 21, 95, 11037 }, // Ҏ
-    { 18, 23, 17, -2, 16, 104, 11132 }, // ҏ
-    { 19, 24, 16, -1, 24, 114, 11236 }, // Ґ
-    { 14, 20, 13, 0, 19, 70, 11350 }, // ґ
-    { 19, 21, 16, -1, 21, 100, 11420 }, // Ғ
-    { 12, 17, 13, 0, 16, 51, 11520 }, // ғ
-    { 18, 27, 17, -1, 21, 122, 11571 }, // Ҕ
-    { 14, 22, 15, 1, 15, 77, 11693 }, // ҕ
-    { 31, 27, 28, -2, 21, 210, 11770 }, // Җ
-    { 26, 22, 26, 0, 16, 143, 11980 }, // җ
-    { 15, 27, 16, 0, 21, 102, 12123 }, // Ҙ
-    { 12, 22, 13, 0, 16, 66, 12225 }, // ҙ
-    { 22, 27, 20, -1, 21, 149, 12291 }, // Қ
-    { 15, 22, 16, 1, 16, 83, 12440 }, // қ
-    { 23, 22, 21, -1, 21, 127, 12523 }, // Ҝ
-    { 17, 17, 18, 1, 16, 73, 12650 }, // ҝ
-    { 22, 22, 20, -1, 21, 121, 12723 }, // Ҟ
-    { 15, 22, 16, 1, 21, 83, 12844 }, // ҟ
-    { 22, 22, 23, 2, 21, 121, 12927 }, // Ҡ
-    { 17, 17, 18, 1, 16, 73, 13048 }, // ҡ
-    { 25, 27, 23, -1, 21, 169, 13121 }, // Ң
-    { 17, 22, 18, 1, 16, 94, 13290 }, // ң
-    { 29, 21, 27, -1, 21, 153, 13384 }, // Ҥ
-    { 20, 17, 21, 1, 16, 85, 13537 }, // ҥ
-    { 30, 27, 30, -1, 21, 203, 13622 }, // Ҧ
-    { 23, 23, 24, 1, 16, 133, 13825 }, // ҧ
-    { 22, 22, 23, 1, 21, 121, 13958 }, // Ҩ
-    { 17, 17, 19, 1, 16, 73, 14079 }, // ҩ
-    { 18, 27, 19, 1, 21, 122, 14152 }, // Ҫ
-    { 12, 22, 13, 1, 16, 66, 14274 }, // ҫ
-    { 18, 27, 19, 2, 21, 122, 14340 }, // Ҭ
-    { 25, 22, 26, 1, 16, 138, 14462 }, // ҭ
-    { 20, 21, 19, 1, 21, 105, 14600 }, // Ү
-    { 15, 23, 15, 0, 16, 87, 14705 }, // ү
-    { 20, 21, 19, 1, 21, 105, 14792 }, // Ұ
-    { 15, 23, 15, 0, 16, 87, 14897 }, // ұ
-    { 24, 27, 19, -3, 21, 162, 14984 }, // Ҳ
-    { 18, 22, 16, -1, 16, 99, 15146 }, // ҳ
-    { 25, 27, 25, 1, 21, 169, 15245 }, // Ҵ
-    { 17, 27, 18, 1, 21, 115, 15414 }, // ҵ
-    { 20, 27, 20, 1, 21, 135, 15529 }, // Ҷ
-    { 16, 22, 17, 1, 16, 88, 15664 }, // ҷ
-    { 20, 21, 20, 1, 21, 105, 15752 }, // Ҹ
-    { 16, 17, 17, 1, 16, 68, 15857 }, // ҹ
-    { 19, 21, 19, -1, 21, 100, 15925 }, // Һ
-    { 17, 24, 17, 0, 23, 102, 16025 }, // һ
-    { 21, 22, 23, 1, 21, 116, 16127 }, // Ҽ
-    { 16, 17, 17, 0, 16, 68, 16243 }, // ҽ
-    { 21, 28, 23, 1, 21, 147, 16311 }, // Ҿ
-    { 16, 22, 17, 0, 16, 88, 16458 }, // ҿ
-    { 13, 21, 11, -1, 21, 69, 16546 }, // Ӏ
-    { 31, 30, 28, -2, 29, 233, 16615 }, // Ӂ
-    { 26, 25, 26, 0, 24, 163, 16848 }, // ӂ
-    { 22, 27, 20, -1, 21, 149, 17011 }, // Ӄ
-    { 15, 23, 16, 1, 16, 87, 17160 }, // ӄ
-    { 23, 27, 20, -2, 21, 156, 17247 }, // Ӆ
-    { 18, 22, 18, -1, 16, 99, 17403 }, // ӆ
-    { 25, 27, 23, -1, 21, 169, 17502 }, // Ӈ
-    { 15, 23, 17, 1, 16, 87, 17671 }, // ӈ
-    { 25, 27, 23, -1, 21, 169, 17758 }, // Ӊ
-    { 17, 22, 18, 1, 16, 94, 17927 }, // ӊ
-    { 20, 27, 20, 1, 21, 135, 18021 }, // Ӌ
-    { 15, 22, 16, 1, 16, 83, 18156 }, // ӌ
-    { 28, 27, 26, -2, 21, 189, 18239 }, // Ӎ
-    { 22, 22, 22, 0, 16, 121, 18428 }, // ӎ
-    { 13, 23, 9, -1, 23, 75, 18549 }, // ӏ
-    { 22, 29, 21, -2, 29, 160, 18624 }, // Ӑ
-    { 16, 25, 17, 1, 24, 100, 18784 }, // ӑ
-    { 22, 27, 21, -2, 27, 149, 18884 }, // Ӓ
-    { 16, 23, 17, 1, 22, 92, 19033 }, // ӓ
-    { 29, 21, 26, -3, 21, 153, 19125 }, // Ӕ
-    { 21, 17, 22, 1, 16, 90, 19278 }, // ӕ
-    { 19, 29, 18, -1, 29, 138, 19368 }, // Ӗ
-    { 14, 25, 14, 1, 24, 88, 19506 }, // ӗ
-    { 18, 22, 18, 0, 21, 99, 19594 }, // Ә
-    { 13, 17, 14, 0, 16, 56, 19693 }, // ә
-    { 18, 28, 18, 0, 27, 126, 19749 }, // Ӛ
-    { 14, 23, 14, 0, 22, 81, 19875 }, // ӛ
-    { 31, 28, 28, -2, 27, 217, 19956 }, // Ӝ
-    { 26, 23, 26, 0, 22, 150, 20173 }, // ӝ
-    { 15, 28, 16, 0, 27, 105, 20323 }, // Ӟ
-    { 14, 23, 13, 0, 22, 81, 20428 }, // ӟ
-    { 18, 22, 17, -1, 21, 99, 20509 }, // Ӡ
-    { 17, 22, 15, -2, 15, 94, 20608 }, // ӡ
-    { 25, 26, 23, -1, 26, 163, 20702 }, // Ӣ
-    { 16, 22, 18, 1, 21, 88, 20865 }, // ӣ
-    { 25, 27, 23, -1, 27, 169, 20953 }, // Ӥ
-    { 16, 23, 18, 1, 22, 92, 21122 }, // ӥ
-    { 20, 28, 21, 1, 27, 140, 21214 }, // Ӧ
-    { 15, 23, 16, 1, 22, 87, 21354 }, // ӧ
-    { 20, 22, 21, 1, 21, 110, 21441 }, // Ө
-    { 14, 17, 16, 1, 16, 60, 21551 }, // ө
-    { 20, 28, 21, 1, 27, 140, 21611 }, // Ӫ
-    { 15, 23, 16, 1, 22, 87, 21751 }, // ӫ
-    { 17, 28, 18, 0, 27, 119, 21838 }, // Ӭ
-    { 13, 23, 14, 0, 22, 75, 21957 }, // ӭ
-    { 20, 27, 18, 1, 26, 135, 22032 }, // Ӯ
-    { 18, 28, 16, -3, 21, 126, 22167 }, // ӯ
-    { 20, 28, 18, 1, 27, 140, 22293 }, // Ӱ
-    { 18, 29, 16, -3, 22, 131, 22433 }, // ӱ
-    { 20, 30, 18, 1, 29, 150, 22564 }, // Ӳ
-    { 18, 31, 16, -3, 24, 140, 22714 }, // ӳ
-    { 20, 27, 20, 1, 27, 135, 22854 }, // Ӵ
-    { 16, 23, 17, 1, 22, 92, 22989 }, // ӵ
-    { 19, 27, 16, -1, 21, 129, 23081 }, // Ӷ
-    { 12, 22, 13, 0, 16, 66, 23210 }, // ӷ
-    { 29, 28, 26, -1, 27, 203, 23276 }, // Ӹ
-    { 20, 23, 22, 1, 22, 115, 23479 }, // ӹ
-    { 19, 27, 16, -1, 21, 129, 23594 }, // Ӻ
-    { 12, 22, 13, 0, 16, 66, 23723 }, // ӻ
-    { 24, 27, 19, -3, 21, 162, 23789 }, // Ӽ
-    { 18, 23, 16, -1, 16, 104, 23951 }, // ӽ
-    { 24, 21, 19, -3, 21, 126, 24055 }, // Ӿ
-    { 18, 17, 16, -1, 16, 77, 24181 }, // ӿ
-    { 0, 0, 15, 0, 0, 0, 0 }, //  
-    { 0, 0, 29, 0, 0, 0, 0 }, //  
-    { 0, 0, 15, 0, 0, 0, 0 }, //  
-    { 0, 0, 29, 0, 0, 0, 0 }, //  
-    { 0, 0, 10, 0, 0, 0, 0 }, //  
-    { 0, 0, 7, 0, 0, 0, 0 }, //  
-    { 0, 0, 5, 0, 0, 0, 0 }, //  
-    { 0, 0, 18, 0, 0, 0, 0 }, //  
-    { 0, 0, 8, 0, 0, 0, 0 }, //  
-    { 0, 0, 6, 0, 0, 0, 0 }, //  
-    { 0, 0, 1, 0, 0, 0, 0 }, //  
-    { 0, 0, 0, 0, 0, 0, 0 }, // ​
-    { 2, 24, 0, -1, 17, 12, 0 }, // ‌
-    { 6, 26, 0, -3, 19, 39, 12 }, // ‍
-    { 10, 28, 0, -5, 21, 70, 51 }, // ‎
-    { 10, 28, 0, -5, 21, 70, 121 }, // ‏
-    { 9, 3, 11, 1, 9, 7, 191 }, // ‐
-    { 9, 3, 11, 1, 9, 7, 198 }, // ‑
-    { 14, 3, 18, 2, 11, 11, 205 }, // ‒
-    { 15, 3, 15, 0, 9, 12, 216 }, // –
-    { 29, 3, 29, 0, 9, 22, 228 }, // —
-    { 29, 3, 29, 0, 9, 22, 250 }, // ―
-    { 10, 30, 15, 2, 23, 75, 272 }, // ‖
-    { 15, 7, 15, 0, -1, 27, 347 }, // ‗
-    { 7, 10, 9, 2, 22, 18, 374 }, // ‘
-    { 6, 9, 9, 2, 22, 14, 392 }, // ’
-    { 6, 10, 9, 1, 4, 15, 406 }, // ‚
-    { 5, 10, 7, 1, 22, 13, 421 }, // ‛
-    { 12, 10, 15, 2, 22, 30, 434 }, // “
-    { 12, 10, 15, 2, 22, 30, 464 }, // ”
-    { 12, 10, 15, 1, 4, 30, 494 }, // „
-    { 11, 10, 13, 1, 22, 28, 524 }, // ‟
-    { 13, 19, 14, 1, 21, 62, 552 }, // †
-    { 14, 23, 14, 0, 21, 81, 614 }, // ‡
-    { 7, 7, 9, 1, 11, 13, 695 }, // •
-    { 10, 10, 18, 4, 15, 25, 708 }, // ‣
-    { 6, 5, 8, 1, 4, 8, 733 }, // ․
-    { 12, 5, 15, 1, 4, 15, 741 }, // ‥
-    { 24, 5, 29, 2, 4, 30, 756 }, // …
-    { 6, 4, 8, 1, 10, 6, 786 }, // ‧
-    { 0, 0, 0, 0, 0, 0, 792 }, //  
-    { 0, 0, 0, 0, 0, 0, 792 }, //  
-    { 10, 28, 0, -5, 21, 70, 792 }, // ‪
-    { 10, 28, 0, -5, 21, 70, 862 }, // ‫
-    { 10, 27, 0, -5, 20, 68, 932 }, // ‬
-    { 12, 28, 0, -6, 21, 84, 1000 }, // ‭
-    { 12, 28, 0, -6, 21, 84, 1084 }, // ‮
-    { 0, 0, 3, 0, 0, 0, 1168 }, //  
-    { 36, 24, 40, 2, 22, 216, 1168 }, // ‰
-    { 6, 10, 8, 1, 21, 15, 1384 }, // ′
-    { 12, 10, 13, 1, 21, 30, 1399 }, // ″
-    { 17, 10, 19, 1, 21, 43, 1429 }, // ‴
-    { 6, 10, 8, 1, 21, 15, 1472 }, // ‵
-    { 12, 10, 14, 1, 21, 30, 1487 }, // ‶
-    { 19, 10, 20, 1, 21, 48, 1517 }, // ‷
-    { 13, 6, 14, 1, 0, 20, 1565 }, // ‸
-    { 8, 11, 9, 1, 13, 22, 1585 }, // ‹
-    { 9, 11, 9, 0, 13, 25, 1607 }, // ›
-    { 18, 20, 18, 0, 19, 90, 1632 }, // ※
-    { 16, 23, 17, 1, 22, 92, 1722 }, // ‼
-    { 15, 3, 15, 0, 24, 12, 1814 }, // ‾
-    { 7, 3, 9, 1, 9, 6, 1826 }, // ⁃
-    { 18, 24, 7, -6, 22, 108, 1832 }, // ⁄
-    { 21, 22, 24, 2, 21, 116, 1940 }, // ⁇
-    { 19, 23, 20, 2, 22, 110, 2056 }, // ⁈
-    { 20, 23, 21, 1, 22, 115, 2166 }, // ⁉
-    { 17, 5, 29, 6, 11, 22, 2281 }, // ⁓
-    { 23, 10, 25, 1, 21, 58, 2303 }, // ⁗
-    { 0, 0, 6, 0, 0, 0, 2361 }, //  
-    { 0, 0, 0, 0, 0, 0, 2361 }, // ⁠
-    { 0, 0, 0, 0, 0, 0, 2361 }, // ⁡
-    { 0, 0, 0, 0, 0, 0, 2361 }, // ⁢
-    { 0, 0, 0, 0, 0, 0, 2361 }, // ⁣
-    { 0, 0, 0, 0, 0, 0, 2361 }, // ⁤
-    { 11, 14, 13, 1, 24, 39, 0 }, // ⁰
-    { 12, 14, 13, 0, 24, 42, 39 }, // ⁴
-    { 11, 14, 13, 1, 24, 39, 81 }, // ⁵
-    { 12, 14, 13, 1, 24, 42, 120 }, // ⁶
-    { 10, 14, 13, 3, 24, 35, 162 }, // ⁷
-    { 11, 14, 13, 1, 24, 39, 197 }, // ⁸
-    { 12, 14, 13, 0, 24, 42, 236 }, // ⁹
-    { 11, 11, 16, 3, 21, 31, 278 }, // ⁿ
-    { 11, 15, 13, 1, 10, 42, 309 }, // ₀
-    { 8, 14, 13, 2, 10, 28, 351 }, // ₁
-    { 11, 14, 13, 1, 10, 39, 379 }, // ₂
-    { 10, 15, 13, 1, 10, 38, 418 }, // ₃
-    { 12, 14, 13, 0, 10, 42, 456 }, // ₄
-    { 11, 14, 13, 1, 9, 39, 498 }, // ₅
-    { 12, 15, 13, 1, 10, 45, 537 }, // ₆
-    { 10, 14, 13, 3, 9, 35, 582 }, // ₇
-    { 11, 15, 13, 1, 10, 42, 617 }, // ₈
-    { 12, 15, 13, 0, 10, 45, 659 }, // ₉
-    { 18, 20, 18, 0, 20, 90, 0 }, // ₣
-    { 19, 22, 18, -1, 21, 105, 90 }, // ₤
-    { 35, 22, 36, 0, 21, 193, 195 }, // ₧
-    { 20, 22, 18, -1, 21, 110, 388 }, // €
-    { 17, 12, 29, 6, 16, 51, 0 }, // ←
-    { 13, 20, 29, 8, 20, 65, 51 }, // ↑
-    { 17, 12, 29, 6, 16, 51, 116 }, // →
-    { 13, 20, 29, 8, 20, 65, 167 }, // ↓
-    { 18, 12, 29, 5, 16, 54, 232 }, // ↔
-    { 13, 20, 29, 8, 20, 65, 286 }, // ↕
-    { 13, 20, 29, 8, 20, 65, 351 }, // ↨
-    { 13, 20, 29, 8, 20, 65, 416 }, // ↲
-    { 13, 20, 29, 8, 20, 65, 481 }, // ↳
-    { 17, 14, 29, 6, 17, 60, 546 }, // ↵
-    { 17, 14, 29, 6, 17, 60, 606 }, // ⇐
-    { 13, 18, 29, 8, 19, 59, 666 }, // ⇑
-    { 17, 14, 29, 6, 17, 60, 725 }, // ⇒
-    { 13, 18, 29, 8, 19, 59, 785 }, // ⇓
-    { 19, 14, 29, 5, 17, 67, 844 }, // ⇔
-    { 19, 22, 29, 5, 21, 105, 0 }, // ∀
-    { 14, 24, 18, 2, 23, 84, 105 }, // ∂
-    { 13, 21, 29, 8, 21, 69, 189 }, // ∃
-    { 23, 24, 29, 3, 22, 138, 258 }, // ∅
-    { 19, 21, 19, 0, 21, 100, 396 }, // ∆
-    { 19, 22, 29, 5, 21, 105, 496 }, // ∇
-    { 19, 21, 29, 5, 21, 100, 601 }, // ∈
-    { 19, 26, 29, 5, 23, 124, 701 }, // ∉
-    { 19, 16, 29, 5, 18, 76, 825 }, // ∊
-    { 19, 21, 29, 5, 21, 100, 901 }, // ∋
-    { 19, 26, 29, 5, 23, 124, 1001 }, // ∌
-    { 19, 16, 29, 5, 18, 76, 1125 }, // ∍
-    { 22, 26, 23, 1, 21, 143, 1201 }, // ∏
-    { 18, 26, 18, 0, 21, 117, 1344 }, // ∑
-    { 13, 3, 18, 3, 11, 10, 1461 }, // −
-    { 17, 23, 14, -1, 21, 98, 1471 }, // ∕
-    { 11, 23, 14, 2, 21, 64, 1569 }, // ∖
-    { 14, 14, 18, 2, 17, 49, 1633 }, // ∗
-    { 10, 10, 18, 4, 15, 25, 1682 }, // ∘
-    { 6, 4, 18, 6, 10, 6, 1707 }, // ∙
-    { 18, 28, 18, 0, 24, 126, 1713 }, // √
-    { 14, 11, 18, 2, 15, 39, 1839 }, // ∝
-    { 18, 10, 18, 0, 14, 45, 1878 }, // ∞
-    { 19, 21, 29, 5, 21, 100, 1923 }, // ∟
-    { 21, 21, 29, 3, 21, 111, 2023 }, // ∠
-    { 4, 30, 15, 5, 23, 30, 2134 }, // ∣
-    { 9, 30, 15, 3, 23, 68, 2164 }, // ∥
-    { 19, 21, 29, 5, 21, 100, 2232 }, // ∧
-    { 19, 21, 29, 5, 21, 100, 2332 }, // ∨
-    { 17, 21, 29, 6, 21, 90, 2432 }, // ∩
-    { 17, 22, 29, 6, 21, 94, 2522 }, // ∪
-    { 16, 30, 18, 1, 23, 120, 2616 }, // ∫
-    { 19, 17, 29, 5, 16, 81, 2736 }, // ∴
-    { 19, 17, 29, 5, 16, 81, 2817 }, // ∵
-    { 6, 16, 9, 1, 18, 24, 2898 }, // ∶
-    { 19, 17, 29, 5, 16, 81, 2922 }, // ∷
-    { 17, 5, 29, 6, 11, 22, 3003 }, // ∼
-    { 17, 15, 29, 6, 17, 64, 3025 }, // ≅
-    { 14, 10, 18, 2, 15, 35, 3089 }, // ≈
-    { 17, 10, 29, 6, 13, 43, 3124 }, // ≍
-    { 13, 13, 18, 3, 16, 43, 3167 }, // ≠
-    { 17, 13, 29, 6, 15, 56, 3210 }, // ≡
-    { 14, 18, 18, 2, 18, 63, 3266 }, // ≤
-    { 14, 18, 18, 2, 18, 63, 3329 }, // ≥
-    { 23, 14, 29, 3, 17, 81, 3392 }, // ≪
-    { 23, 14, 29, 3, 17, 81, 3473 }, // ≫
-    { 19, 16, 29, 5, 18, 76, 3554 }, // ⊃
-    { 19, 26, 29, 5, 23, 124, 3630 }, // ⊄
-    { 19, 26, 29, 5, 23, 124, 3754 }, // ⊅
-    { 19, 21, 29, 5, 21, 100, 3878 }, // ⊆
-    { 19, 21, 29, 5, 21, 100, 3978 }, // ⊇
-    { 21, 22, 29, 4, 21, 116, 4078 }, // ⊕
-    { 21, 22, 29, 4, 21, 116, 4194 }, // ⊖
-    { 21, 22, 29, 4, 21, 116, 4310 }, // ⊗
-    { 21, 22, 29, 4, 21, 116, 4426 }, // ⊘
-    { 17, 21, 29, 6, 21, 90, 4542 }, // ⊥
-    { 6, 5, 18, 6, 10, 8, 4632 }, // ⋅
-    { 25, 5, 29, 2, 10, 32, 4640 }, // ⋯
-    { 27, 28, 29, 1, 24, 189, 0 }, // �
+    { 14, 11, 15, 1, 13, 39, 7834 }, // «
+    { 13, 8, 18, 3, 14, 26, 716 }, // ¬
+    { 9, 3, 11, 1, 9, 7, 742 }, // ­
+    { 17, 16, 17, 0, 23, 68, 749 }, // ®
+    { 10, 3, 18, 4, 21, 8, 817 }, // ¯
+    { 11, 11, 15, 2, 21, 31, 825 }, // °
+    { 13, 17, 18, 3, 17, 56, 856 }, // ±
+    { 11, 14, 13, 1, 24, 39, 912 }, // ²
+    { 10, 14, 13, 1, 24, 35, 951 }, // ³
+    { 6, 7, 18, 6, 24, 11, 986 }, // ´
+    { 19, 24, 17, -1, 16, 114, 997 }, // µ
+    { 19, 26, 17, -1, 21, 124, 1111 }, // ¶
+    { 5, 5, 9, 2, 10, 7, 1235 }, // ·
+    { 6, 7, 18, 6, -1, 11, 1242 }, // ¸
+    { 8, 14, 13, 2, 24, 28, 1253 }, // ¹
+    { 11, 14, 13, 1, 21, 39, 1281 }, // º
+    { 14, 11, 15, 0, 13, 39, 7873 }, // »
+    { 28, 24, 31, 2, 22, 168, 1320 }, // ¼
+    { 28, 24, 31, 2, 22, 168, 1488 }, // ½
+    { 29, 24, 31, 1, 22, 174, 1656 }, // ¾
+    { 10, 22, 12, 0, 16, 55, 1830 }, // ¿
+    { 22, 28, 21, -2, 28, 154, 7912 }, // À
+    { 22, 28, 21, -2, 28, 154, 8066 }, // Á
+    { 22, 28, 21, -2, 28, 154, 8220 }, // Â
+    { 22, 28, 21, -2, 28, 154, 1885 }, // Ã
+    { 22, 27, 21, -2, 27, 149, 8374 }, // Ä
+    { 22, 29, 21, -2, 29, 160, 2039 }, // Å
+    { 29, 21, 26, -3, 21, 153, 2199 }, // Æ
+    { 18, 29, 19, 1, 21, 131, 8523 }, // Ç
+    { 19, 28, 18, -1, 28, 133, 8654 }, // È
+    { 19, 28, 18, -1, 28, 133, 8787 }, // É
+    { 19, 28, 18, -1, 28, 133, 8920 }, // Ê
+    { 19, 27, 18, -1, 27, 129, 9053 }, // Ë
+    { 13, 28, 11, -1, 28, 91, 9182 }, // Ì
+    { 14, 28, 11, -1, 28, 98, 9273 }, // Í
+    { 15, 28, 11, -1, 28, 105, 9371 }, // Î
+    { 15, 27, 11, -1, 27, 102, 9476 }, // Ï
+    { 21, 22, 21, -1, 21, 116, 2352 }, // Ð
+    { 25, 29, 22, -1, 28, 182, 9578 }, // Ñ
+    { 20, 29, 21, 1, 28, 145, 9760 }, // Ò
+    { 20, 29, 21, 1, 28, 145, 9905 }, // Ó
+    { 20, 29, 21, 1, 28, 145, 10050 }, // Ô
+    { 20, 29, 21, 1, 28, 145, 2468 }, // Õ
+    { 20, 28, 21, 1, 27, 140, 10195 }, // Ö
+    { 12, 12, 18, 3, 16, 36, 2613 }, // ×
+    { 23, 22, 21, -1, 21, 127, 2649 }, // Ø
+    { 22, 29, 22, 2, 28, 160, 10335 }, // Ù
+    { 22, 29, 22, 2, 28, 160, 10495 }, // Ú
+    { 22, 29, 22, 2, 28, 160, 10655 }, // Û
+    { 22, 28, 22, 2, 27, 154, 10815 }, // Ü
+    { 20, 28, 19, 1, 28, 140, 2776 }, // Ý
+    { 18, 21, 17, -1, 21, 95, 2916 }, // Þ
+    { 23, 30, 19, -5, 23, 173, 3011 }, // ß
+    { 16, 25, 17, 1, 24, 100, 10969 }, // à
+    { 16, 25, 17, 1, 24, 100, 11069 }, // á
+    { 16, 25, 17, 1, 24, 100, 11169 }, // â
+    { 16, 24, 17, 1, 23, 96, 3184 }, // ã
+    { 16, 23, 17, 1, 22, 92, 11269 }, // ä
+    { 16, 25, 17, 1, 24, 100, 3280 }, // å
+    { 21, 17, 22, 1, 16, 90, 3380 }, // æ
+    { 12, 24, 13, 1, 16, 72, 11361 }, // ç
+    { 12, 25, 14, 1, 24, 75, 11433 }, // è
+    { 13, 25, 14, 1, 24, 82, 11508 }, // é
+    { 13, 25, 14, 1, 24, 82, 11590 }, // ê
+    { 14, 23, 14, 1, 22, 81, 11672 }, // ë
+    { 8, 25, 10, 1, 24, 50, 11753 }, // ì
+    { 11, 25, 10, 1, 24, 69, 11803 }, // í
+    { 11, 25, 10, 1, 24, 69, 11872 }, // î
+    { 11, 23, 10, 1, 22, 64, 11941 }, // ï
+    { 15, 25, 16, 0, 24, 94, 3470 }, // ð
+    { 16, 24, 18, 1, 23, 96, 12005 }, // ñ
+    { 14, 25, 16, 1, 24, 88, 12101 }, // ò
+    { 14, 25, 16, 1, 24, 88, 12189 }, // ó
+    { 14, 25, 16, 1, 24, 88, 12277 }, // ô
+    { 15, 24, 16, 1, 23, 90, 3564 }, // õ
+    { 15, 23, 16, 1, 22, 87, 12365 }, // ö
+    { 13, 14, 18, 3, 17, 46, 3654 }, // ÷
+    { 19, 17, 16, -2, 16, 81, 3700 }, // ø
+    { 16, 25, 18, 1, 24, 100, 12452 }, // ù
+    { 16, 25, 18, 1, 24, 100, 12552 }, // ú
+    { 16, 25, 18, 1, 24, 100, 12652 }, // û
+    { 16, 23, 18, 1, 22, 92, 12752 }, // ü
+    { 18, 31, 16, -3, 24, 140, 3781 }, // ý
+    { 18, 30, 16, -3, 23, 135, 3921 }, // þ
+    { 18, 29, 16, -3, 22, 131, 4056 }, // ÿ
+    { 22, 26, 21, -2, 26, 143, 4187 }, // Ā
+    { 16, 22, 17, 1, 21, 88, 4330 }, // ā
+    { 22, 28, 21, -2, 28, 154, 4418 }, // Ă
+    { 16, 24, 17, 1, 23, 96, 4572 }, // ă
+    { 22, 28, 21, -2, 21, 154, 4668 }, // Ą
+    { 16, 23, 17, 1, 16, 92, 4822 }, // ą
+    { 18, 29, 19, 1, 28, 131, 4914 }, // Ć
+    { 13, 25, 13, 1, 24, 82, 5045 }, // ć
+    { 18, 29, 19, 1, 28, 131, 5127 }, // Ĉ
+    { 13, 25, 13, 1, 24, 82, 5258 }, // ĉ
+    { 18, 29, 19, 1, 28, 131, 5340 }, // Ċ
+    { 12, 23, 13, 1, 22, 69, 5471 }, // ċ
+    { 18, 29, 19, 1, 28, 131, 5540 }, // Č
+    { 14, 25, 13, 1, 24, 88, 5671 }, // č
+    { 21, 29, 21, -1, 28, 153, 5759 }, // Ď
+    { 21, 26, 18, 1, 25, 137, 5912 }, // ď
+    { 21, 22, 21, -1, 21, 116, 6049 }, // Đ
+    { 18, 24, 17, 1, 23, 108, 6165 }, // đ
+    { 19, 26, 18, -1, 26, 124, 6273 }, // Ē
+    { 13, 22, 14, 1, 21, 72, 6397 }, // ē
+    { 19, 28, 18, -1, 28, 133, 6469 }, // Ĕ
+    { 14, 24, 14, 1, 23, 84, 6602 }, // ĕ
+    { 19, 28, 18, -1, 28, 133, 6686 }, // Ė
+    { 12, 23, 14, 1, 22, 69, 6819 }, // ė
+    { 19, 28, 18, -1, 21, 133, 6888 }, // Ę
+    { 12, 23, 14, 1, 16, 69, 7021 }, // ę
+    { 19, 28, 18, -1, 28, 133, 7090 }, // Ě
+    { 14, 25, 14, 1, 24, 88, 7223 }, // ě
+    { 19, 29, 21, 1, 28, 138, 7311 }, // Ĝ
+    { 19, 31, 14, -3, 24, 148, 7449 }, // ĝ
+    { 19, 29, 21, 1, 28, 138, 7597 }, // Ğ
+    { 19, 30, 14, -3, 23, 143, 7735 }, // ğ
+    { 19, 29, 21, 1, 28, 138, 7878 }, // Ġ
+    { 19, 29, 14, -3, 22, 138, 8016 }, // ġ
+    { 19, 29, 21, 1, 21, 138, 8154 }, // Ģ
+    { 19, 32, 14, -3, 25, 152, 8292 }, // ģ
+    { 25, 28, 23, -1, 28, 175, 8444 }, // Ĥ
+    { 17, 31, 17, 0, 30, 132, 8619 }, // ĥ
+    { 25, 21, 23, -1, 21, 132, 8751 }, // Ħ
+    { 17, 24, 17, 0, 23, 102, 8883 }, // ħ
+    { 14, 28, 11, -1, 28, 98, 8985 }, // Ĩ
+    { 11, 24, 10, 1, 23, 66, 9083 }, // ĩ
+    { 14, 26, 11, -1, 26, 91, 9149 }, // Ī
+    { 11, 22, 10, 1, 21, 61, 9240 }, // ī
+    { 15, 28, 11, -1, 28, 105, 9301 }, // Ĭ
+    { 11, 24, 10, 1, 23, 66, 9406 }, // ĭ
+    { 13, 28, 11, -1, 21, 91, 9472 }, // Į
+    { 9, 30, 9, 1, 23, 68, 9563 }, // į
+    { 13, 28, 11, -1, 28, 91, 9631 }, // İ
+    { 8, 17, 9, 1, 16, 34, 9722 }, // ı
+    { 24, 27, 21, -1, 21, 162, 9756 }, // Ĳ
+    { 18, 30, 18, 1, 23, 135, 9918 }, // ĳ
+    { 19, 34, 10, -5, 28, 162, 10053 }, // Ĵ
+    { 17, 31, 8, -6, 24, 132, 10215 }, // ĵ
+    { 23, 29, 20, -1, 21, 167, 10347 }, // Ķ
+    { 14, 31, 15, 1, 23, 109, 10514 }, // ķ
+    { 15, 17, 16, 1, 16, 64, 10623 }, // ĸ
+    { 17, 28, 17, -1, 28, 119, 10687 }, // Ĺ
+    { 10, 31, 9, 1, 30, 78, 10806 }, // ĺ
+    { 17, 29, 17, -1, 21, 124, 10884 }, // Ļ
+    { 10, 31, 9, -1, 23, 78, 11008 }, // ļ
+    { 18, 23, 17, -1, 23, 104, 11086 }, // Ľ
+    { 13, 26, 10, 1, 25, 85, 11190 }, // ľ
+    { 18, 21, 17, -1, 21, 95, 11275 }, // Ŀ
+    { 12, 24, 12, 1, 23, 72, 11370 }, // ŀ
+    { 17, 21, 17, -1, 21, 90, 11442 }, // Ł
+    { 11, 24, 9, -1, 23, 66, 11532 }, // ł
+    { 25, 29, 22, -1, 28, 182, 11598 }, // Ń
+    { 16, 25, 18, 1, 24, 100, 11780 }, // ń
+    { 25, 29, 22, -1, 21, 182, 11880 }, // Ņ
+    { 16, 24, 18, 1, 16, 96, 12062 }, // ņ
+    { 25, 29, 22, -1, 28, 182, 12158 }, // Ň
+    { 16, 25, 18, 1, 24, 100, 12340 }, // ň
+    { 21, 23, 24, 2, 22, 121, 12440 }, // ŉ
+    { 25, 27, 22, -1, 21, 169, 12561 }, // Ŋ
+    { 15, 23, 17, 1, 16, 87, 12730 }, // ŋ
+    { 20, 27, 21, 1, 26, 135, 12817 }, // Ō
+    { 15, 22, 16, 1, 21, 83, 12952 }, // ō
+    { 20, 29, 21, 1, 28, 145, 13035 }, // Ŏ
+    { 15, 24, 16, 1, 23, 90, 13180 }, // ŏ
+    { 21, 30, 21, 1, 29, 158, 13270 }, // Ő
+    { 16, 25, 16, 1, 24, 100, 13428 }, // ő
+    { 27, 22, 28, 1, 21, 149, 12844 }, // Œ
+    { 22, 17, 24, 1, 16, 94, 12993 }, // œ
+    { 19, 29, 19, -1, 28, 138, 13528 }, // Ŕ
+    { 13, 24, 12, 1, 24, 78, 13666 }, // ŕ
+    { 19, 29, 19, -1, 21, 138, 13744 }, // Ŗ
+    { 14, 24, 12, -1, 16, 84, 13882 }, // ŗ
+    { 19, 29, 19, -1, 28, 138, 13966 }, // Ř
+    { 14, 24, 12, 1, 24, 84, 14104 }, // ř
+    { 15, 29, 15, 0, 28, 109, 14188 }, // Ś
+    { 13, 25, 12, 0, 24, 82, 14297 }, // ś
+    { 15, 29, 15, 0, 28, 109, 14379 }, // Ŝ
+    { 13, 25, 12, 0, 24, 82, 14488 }, // ŝ
+    { 15, 29, 15, 0, 21, 109, 14570 }, // Ş
+    { 12, 24, 12, 0, 16, 72, 14679 }, // ş
+    { 16, 29, 15, 0, 28, 116, 14751 }, // Š
+    { 14, 25, 12, 0, 24, 88, 14867 }, // š
+    { 18, 29, 19, 2, 21, 131, 14955 }, // Ţ
+    { 12, 27, 11, 0, 19, 81, 15086 }, // ţ
+    { 18, 28, 19, 2, 28, 126, 15167 }, // Ť
+    { 13, 25, 11, 0, 24, 82, 15293 }, // ť
+    { 18, 21, 19, 2, 21, 95, 15375 }, // Ŧ
+    { 12, 20, 11, 0, 19, 60, 15470 }, // ŧ
+    { 22, 29, 22, 2, 28, 160, 15530 }, // Ũ
+    { 16, 24, 18, 1, 23, 96, 15690 }, // ũ
+    { 22, 27, 22, 2, 26, 149, 15786 }, // Ū
+    { 16, 22, 18, 1, 21, 88, 15935 }, // ū
+    { 22, 29, 22, 2, 28, 160, 16023 }, // Ŭ
+    { 16, 24, 18, 1, 23, 96, 16183 }, // ŭ
+    { 22, 30, 22, 2, 29, 165, 16279 }, // Ů
+    { 16, 25, 18, 1, 24, 100, 16444 }, // ů
+    { 22, 30, 22, 2, 29, 165, 16544 }, // Ű
+    { 16, 25, 18, 1, 24, 100, 16709 }, // ű
+    { 22, 28, 22, 2, 21, 154, 16809 }, // Ų
+    { 16, 23, 18, 1, 16, 92, 16963 }, // ų
+    { 30, 29, 30, 2, 28, 218, 17055 }, // Ŵ
+    { 22, 25, 22, 0, 24, 138, 17273 }, // ŵ
+    { 20, 28, 19, 1, 28, 140, 17411 }, // Ŷ
+    { 18, 31, 16, -3, 24, 140, 17551 }, // ŷ
+    { 20, 27, 19, 1, 27, 135, 17691 }, // Ÿ
+    { 18, 29, 17, -1, 28, 131, 17826 }, // Ź
+    { 14, 25, 14, 0, 24, 88, 17957 }, // ź
+    { 18, 29, 17, -1, 28, 131, 18045 }, // Ż
+    { 14, 23, 14, 0, 22, 81, 18176 }, // ż
+    { 18, 29, 17, -1, 28, 131, 18257 }, // Ž
+    { 14, 25, 14, 0, 24, 88, 18388 }, // ž
+    { 20, 30, 12, -5, 23, 150, 18476 }, // ſ
+    { 6, 8, 0, -4, 24, 12, 18626 }, // ̀
+    { 6, 7, 0, -2, 24, 11, 18638 }, // ́
+    { 10, 7, 0, -6, 24, 18, 18649 }, // ̂
+    { 10, 6, 0, -5, 23, 15, 18667 }, // ̃
+    { 10, 3, 0, -5, 21, 8, 18682 }, // ̄
+    { 10, 6, 0, -5, 23, 15, 18690 }, // ̆
+    { 4, 4, 0, -2, 22, 4, 18705 }, // ̇
+    { 10, 4, 0, -5, 22, 10, 18709 }, // ̈
+    { 8, 9, 0, -4, 26, 18, 18719 }, // ̉
+    { 8, 8, 0, -4, 24, 16, 18737 }, // ̊
+    { 11, 7, 0, -5, 24, 20, 18753 }, // ̋
+    { 10, 7, 0, -4, 24, 18, 18773 }, // ̌
+    { 9, 8, 0, -6, 24, 18, 18791 }, // ̏
+    { 10, 6, 0, -5, 23, 15, 18809 }, // ̑
+    { 6, 9, 0, -3, 25, 14, 18824 }, // ̒
+    { 7, 9, 0, -3, 26, 16, 18838 }, // ̓
+    { 6, 9, 0, -4, 26, 14, 18854 }, // ̔
+    { 4, 8, 0, -2, 25, 8, 18868 }, // ̕
+    { 6, 7, 0, -3, 19, 11, 18876 }, // ̛
+    { 4, 5, 0, -2, -2, 5, 18887 }, // ̣
+    { 10, 5, 0, -5, -2, 13, 18892 }, // ̤
+    { 8, 7, 0, -4, -1, 14, 18905 }, // ̥
+    { 6, 7, 0, -3, -1, 11, 18919 }, // ̦
+    { 6, 7, 0, -3, -1, 11, 18930 }, // ̧
+    { 6, 8, 0, -3, 1, 12, 18941 }, // ̨
+    { 5, 7, 8, -1, -1, 9, 18953 }, // ̩
+    { 11, 6, 0, -6, -2, 17, 18962 }, // ̭
+    { 10, 6, 0, -5, -1, 15, 18979 }, // ̮
+    { 10, 5, 0, -5, -2, 13, 18994 }, // ̰
+    { 10, 3, 0, -5, -3, 8, 19007 }, // ̱
+    { 10, 6, 0, -5, 23, 15, 19015 }, // ͂
+    { 11, 11, 0, -6, 29, 31, 19030 }, // ̈́
+    { 6, 5, 0, -2, -2, 8, 19061 }, // ͅ
+    { 19, 28, 18, -1, 28, 133, 19069 }, // Ѐ
+    { 19, 27, 18, -1, 27, 129, 0 }, // Ё
+    { 18, 27, 22, 2, 21, 122, 19202 }, // Ђ
+    { 19, 28, 16, -1, 28, 133, 19324 }, // Ѓ
+    { 18, 22, 19, 1, 21, 99, 19457 }, // Є
+    { 15, 22, 15, 0, 21, 83, 19556 }, // Ѕ
+    { 13, 21, 11, -1, 21, 69, 19639 }, // І
+    { 15, 27, 11, -1, 27, 102, 19708 }, // Ї
+    { 17, 27, 10, -5, 21, 115, 19810 }, // Ј
+    { 27, 22, 26, -2, 21, 149, 19925 }, // Љ
+    { 27, 22, 27, -1, 21, 149, 20074 }, // Њ
+    { 19, 21, 23, 2, 21, 100, 20223 }, // Ћ
+    { 22, 29, 20, -1, 28, 160, 20323 }, // Ќ
+    { 25, 28, 23, -1, 28, 175, 20483 }, // Ѝ
+    { 20, 30, 18, 1, 29, 150, 20658 }, // Ў
+    { 24, 28, 22, -1, 21, 168, 20808 }, // Џ
+    { 22, 21, 21, -2, 21, 116, 129 }, // А
+    { 18, 22, 17, -1, 21, 99, 245 }, // Б
+    { 18, 22, 18, -1, 21, 99, 344 }, // В
+    { 19, 21, 16, -1, 21, 100, 443 }, // Г
+    { 24, 27, 21, -2, 21, 162, 543 }, // Д
+    { 19, 21, 18, -1, 21, 100, 705 }, // Е
+    { 31, 22, 28, -2, 21, 171, 805 }, // Ж
+    { 15, 22, 16, 0, 21, 83, 976 }, // З
+    { 25, 21, 23, -1, 21, 132, 1059 }, // И
+    { 25, 29, 23, -1, 29, 182, 1191 }, // Й
+    { 22, 22, 20, -1, 21, 121, 1373 }, // К
+    { 23, 22, 20, -2, 21, 127, 1494 }, // Л
+    { 28, 21, 26, -2, 21, 147, 1621 }, // М
+    { 25, 21, 23, -1, 21, 132, 1768 }, // Н
+    { 20, 22, 21, 1, 21, 110, 1900 }, // О
+    { 24, 21, 22, -1, 21, 126, 2010 }, // П
+    { 18, 21, 17, -1, 21, 95, 2136 }, // Р
+    { 18, 22, 19, 1, 21, 99, 2231 }, // С
+    { 18, 21, 19, 2, 21, 95, 2330 }, // Т
+    { 20, 22, 18, 1, 21, 110, 2425 }, // У
+    { 21, 22, 21, 0, 21, 116, 2535 }, // Ф
+    { 24, 21, 19, -3, 21, 126, 2651 }, // Х
+    { 24, 27, 22, -1, 21, 162, 2777 }, // Ц
+    { 20, 21, 20, 1, 21, 105, 2939 }, // Ч
+    { 31, 21, 29, -1, 21, 163, 3044 }, // Ш
+    { 31, 27, 29, -1, 21, 210, 3207 }, // Щ
+    { 18, 22, 20, 2, 21, 99, 3417 }, // Ъ
+    { 29, 22, 26, -1, 21, 160, 3516 }, // Ы
+    { 17, 22, 17, -1, 21, 94, 3676 }, // Ь
+    { 17, 22, 18, 0, 21, 94, 3770 }, // Э
+    { 29, 22, 29, -1, 21, 160, 3864 }, // Ю
+    { 21, 22, 19, -2, 21, 116, 4024 }, // Я
+    { 16, 17, 17, 1, 16, 68, 4140 }, // а
+    { 16, 24, 16, 1, 23, 96, 4208 }, // б
+    { 13, 17, 15, 1, 16, 56, 4304 }, // в
+    { 12, 17, 13, 0, 16, 51, 4360 }, // г
+    { 14, 24, 16, 1, 23, 84, 4411 }, // д
+    { 12, 17, 14, 1, 16, 51, 4495 }, // е
+    { 26, 17, 26, 0, 16, 111, 4546 }, // ж
+    { 12, 17, 13, 0, 16, 51, 4657 }, // з
+    { 16, 17, 18, 1, 16, 68, 4708 }, // и
+    { 16, 25, 18, 1, 24, 100, 4776 }, // й
+    { 15, 17, 16, 1, 16, 64, 4876 }, // к
+    { 18, 17, 18, -1, 16, 77, 4940 }, // л
+    { 22, 17, 22, 0, 16, 94, 5017 }, // м
+    { 16, 17, 18, 1, 16, 68, 5111 }, // н
+    { 14, 17, 16, 1, 16, 60, 5179 }, // о
+    { 16, 17, 18, 1, 16, 68, 5239 }, // п
+    { 18, 23, 17, -2, 16, 104, 5307 }, // р
+    { 12, 17, 13, 1, 16, 51, 5411 }, // с
+    { 24, 17, 26, 1, 16, 102, 5462 }, // т
+    { 18, 23, 16, -3, 16, 104, 5564 }, // у
+    { 18, 30, 20, 1, 23, 135, 5668 }, // ф
+    { 18, 17, 16, -1, 16, 77, 5803 }, // х
+    { 17, 22, 18, 1, 16, 94, 5880 }, // ц
+    { 16, 17, 17, 1, 16, 68, 5974 }, // ч
+    { 23, 17, 24, 1, 16, 98, 6042 }, // ш
+    { 23, 22, 25, 1, 16, 127, 6140 }, // щ
+    { 14, 17, 15, 1, 16, 60, 6267 }, // ъ
+    { 20, 17, 22, 1, 16, 85, 6327 }, // ы
+    { 13, 17, 14, 0, 16, 56, 6412 }, // ь
+    { 13, 17, 14, 0, 16, 56, 6468 }, // э
+    { 21, 17, 23, 1, 16, 90, 6524 }, // ю
+    { 16, 16, 16, -1, 15, 64, 6614 }, // я
+    { 12, 25, 14, 1, 24, 75, 20976 }, // ѐ
+    { 14, 23, 14, 1, 22, 81, 6678 }, // ё
+    { 15, 30, 16, 0, 23, 113, 21051 }, // ђ
+    { 13, 25, 13, 0, 24, 82, 21164 }, // ѓ
+    { 12, 17, 14, 1, 16, 51, 21246 }, // є
+    { 12, 17, 12, 0, 16, 51, 21297 }, // ѕ
+    { 9, 24, 9, 1, 23, 54, 21348 }, // і
+    { 11, 23, 9, 1, 22, 64, 21402 }, // ї
+    { 15, 30, 8, -6, 23, 113, 21466 }, // ј
+    { 22, 17, 21, -1, 16, 94, 21579 }, // љ
+    { 19, 17, 21, 1, 16, 81, 21673 }, // њ
+    { 17, 24, 17, 0, 23, 102, 21754 }, // ћ
+    { 15, 25, 16, 1, 24, 94, 21856 }, // ќ
+    { 16, 25, 18, 1, 24, 100, 21950 }, // ѝ
+    { 18, 31, 16, -3, 24, 140, 22050 }, // ў
+    { 16, 22, 18, 1, 16, 88, 22190 }, // џ
+    { 18, 24, 19, 1, 23, 108, 22278 }, // Ѣ
+    { 20, 17, 21, 1, 16, 85, 22386 }, // ѣ
+    { 20, 22, 21, 1, 21, 110, 22471 }, // Ѳ
+    { 14, 17, 16, 1, 16, 60, 22581 }, // ѳ
+    { 21, 22, 21, 2, 21, 116, 22641 }, // Ѵ
+    { 18, 17, 16, 0, 16, 77, 22757 }, // ѵ
+    { 25, 35, 23, -1, 29, 219, 22834 }, // Ҋ
+    { 17, 30, 18, 1, 24, 128, 23053 }, // ҋ
+    { 17, 22, 17, -1, 21, 94, 23181 }, // Ҍ
+    { 13, 22, 14, 1, 21, 72, 23275 }, // ҍ
+    { 18, 21, 17, -1, 21, 95, 23347 }, // Ҏ
+    { 18, 23, 17, -2, 16, 104, 23442 }, // ҏ
+    { 19, 24, 16, -1, 24, 114, 23546 }, // Ґ
+    { 14, 20, 13, 0, 19, 70, 23660 }, // ґ
+    { 19, 21, 16, -1, 21, 100, 23730 }, // Ғ
+    { 12, 17, 13, 0, 16, 51, 23830 }, // ғ
+    { 18, 27, 17, -1, 21, 122, 23881 }, // Ҕ
+    { 14, 22, 15, 1, 15, 77, 24003 }, // ҕ
+    { 31, 27, 28, -2, 21, 210, 0 }, // Җ
+    { 26, 22, 26, 0, 16, 143, 210 }, // җ
+    { 15, 27, 16, 0, 21, 102, 353 }, // Ҙ
+    { 12, 22, 13, 0, 16, 66, 455 }, // ҙ
+    { 22, 27, 20, -1, 21, 149, 521 }, // Қ
+    { 15, 22, 16, 1, 16, 83, 670 }, // қ
+    { 23, 22, 21, -1, 21, 127, 753 }, // Ҝ
+    { 17, 17, 18, 1, 16, 73, 880 }, // ҝ
+    { 22, 22, 20, -1, 21, 121, 953 }, // Ҟ
+    { 15, 22, 16, 1, 21, 83, 1074 }, // ҟ
+    { 22, 22, 23, 2, 21, 121, 1157 }, // Ҡ
+    { 17, 17, 18, 1, 16, 73, 1278 }, // ҡ
+    { 25, 27, 23, -1, 21, 169, 1351 }, // Ң
+    { 17, 22, 18, 1, 16, 94, 1520 }, // ң
+    { 29, 21, 27, -1, 21, 153, 1614 }, // Ҥ
+    { 20, 17, 21, 1, 16, 85, 1767 }, // ҥ
+    { 30, 27, 30, -1, 21, 203, 1852 }, // Ҧ
+    { 23, 23, 24, 1, 16, 133, 2055 }, // ҧ
+    { 22, 22, 23, 1, 21, 121, 2188 }, // Ҩ
+    { 17, 17, 19, 1, 16, 73, 2309 }, // ҩ
+    { 18, 27, 19, 1, 21, 122, 2382 }, // Ҫ
+    { 12, 22, 13, 1, 16, 66, 2504 }, // ҫ
+    { 18, 27, 19, 2, 21, 122, 2570 }, // Ҭ
+    { 25, 22, 26, 1, 16, 138, 2692 }, // ҭ
+    { 20, 21, 19, 1, 21, 105, 2830 }, // Ү
+    { 15, 23, 15, 0, 16, 87, 2935 }, // ү
+    { 20, 21, 19, 1, 21, 105, 3022 }, // Ұ
+    { 15, 23, 15, 0, 16, 87, 3127 }, // ұ
+    { 24, 27, 19, -3, 21, 162, 3214 }, // Ҳ
+    { 18, 22, 16, -1, 16, 99, 3376 }, // ҳ
+    { 25, 27, 25, 1, 21, 169, 3475 }, // Ҵ
+    { 17, 27, 18, 1, 21, 115, 3644 }, // ҵ
+    { 20, 27, 20, 1, 21, 135, 3759 }, // Ҷ
+    { 16, 22, 17, 1, 16, 88, 3894 }, // ҷ
+    { 20, 21, 20, 1, 21, 105, 3982 }, // Ҹ
+    { 16, 17, 17, 1, 16, 68, 4087 }, // ҹ
+    { 19, 21, 19, -1, 21, 100, 4155 }, // Һ
+    { 17, 24, 17, 0, 23, 102, 4255 }, // һ
+    { 21, 22, 23, 1, 21, 116, 4357 }, // Ҽ
+    { 16, 17, 17, 0, 16, 68, 4473 }, // ҽ
+    { 21, 28, 23, 1, 21, 147, 4541 }, // Ҿ
+    { 16, 22, 17, 0, 16, 88, 4688 }, // ҿ
+    { 13, 21, 11, -1, 21, 69, 4776 }, // Ӏ
+    { 31, 30, 28, -2, 29, 233, 4845 }, // Ӂ
+    { 26, 25, 26, 0, 24, 163, 5078 }, // ӂ
+    { 22, 27, 20, -1, 21, 149, 5241 }, // Ӄ
+    { 15, 23, 16, 1, 16, 87, 5390 }, // ӄ
+    { 23, 27, 20, -2, 21, 156, 5477 }, // Ӆ
+    { 18, 22, 18, -1, 16, 99, 5633 }, // ӆ
+    { 25, 27, 23, -1, 21, 169, 5732 }, // Ӈ
+    { 15, 23, 17, 1, 16, 87, 5901 }, // ӈ
+    { 25, 27, 23, -1, 21, 169, 5988 }, // Ӊ
+    { 17, 22, 18, 1, 16, 94, 6157 }, // ӊ
+    { 20, 27, 20, 1, 21, 135, 6251 }, // Ӌ
+    { 15, 22, 16, 1, 16, 83, 6386 }, // ӌ
+    { 28, 27, 26, -2, 21, 189, 6469 }, // Ӎ
+    { 22, 22, 22, 0, 16, 121, 6658 }, // ӎ
+    { 13, 23, 9, -1, 23, 75, 6779 }, // ӏ
+    { 22, 29, 21, -2, 29, 160, 6854 }, // Ӑ
+    { 16, 25, 17, 1, 24, 100, 7014 }, // ӑ
+    { 22, 27, 21, -2, 27, 149, 7114 }, // Ӓ
+    { 16, 23, 17, 1, 22, 92, 7263 }, // ӓ
+    { 29, 21, 26, -3, 21, 153, 7355 }, // Ӕ
+    { 21, 17, 22, 1, 16, 90, 7508 }, // ӕ
+    { 19, 29, 18, -1, 29, 138, 7598 }, // Ӗ
+    { 14, 25, 14, 1, 24, 88, 7736 }, // ӗ
+    { 18, 22, 18, 0, 21, 99, 7824 }, // Ә
+    { 13, 17, 14, 0, 16, 56, 7923 }, // ә
+    { 18, 28, 18, 0, 27, 126, 7979 }, // Ӛ
+    { 14, 23, 14, 0, 22, 81, 8105 }, // ӛ
+    { 31, 28, 28, -2, 27, 217, 8186 }, // Ӝ
+    { 26, 23, 26, 0, 22, 150, 8403 }, // ӝ
+    { 15, 28, 16, 0, 27, 105, 8553 }, // Ӟ
+    { 14, 23, 13, 0, 22, 81, 8658 }, // ӟ
+    { 18, 22, 17, -1, 21, 99, 8739 }, // Ӡ
+    { 17, 22, 15, -2, 15, 94, 8838 }, // ӡ
+    { 25, 26, 23, -1, 26, 163, 8932 }, // Ӣ
+    { 16, 22, 18, 1, 21, 88, 9095 }, // ӣ
+    { 25, 27, 23, -1, 27, 169, 9183 }, // Ӥ
+    { 16, 23, 18, 1, 22, 92, 9352 }, // ӥ
+    { 20, 28, 21, 1, 27, 140, 9444 }, // Ӧ
+    { 15, 23, 16, 1, 22, 87, 9584 }, // ӧ
+    { 20, 22, 21, 1, 21, 110, 9671 }, // Ө
+    { 14, 17, 16, 1, 16, 60, 9781 }, // ө
+    { 20, 28, 21, 1, 27, 140, 9841 }, // Ӫ
+    { 15, 23, 16, 1, 22, 87, 9981 }, // ӫ
+    { 17, 28, 18, 0, 27, 119, 10068 }, // Ӭ
+    { 13, 23, 14, 0, 22, 75, 10187 }, // ӭ
+    { 20, 27, 18, 1, 26, 135, 10262 }, // Ӯ
+    { 18, 28, 16, -3, 21, 126, 10397 }, // ӯ
+    { 20, 28, 18, 1, 27, 140, 10523 }, // Ӱ
+    { 18, 29, 16, -3, 22, 131, 10663 }, // ӱ
+    { 20, 30, 18, 1, 29, 150, 10794 }, // Ӳ
+    { 18, 31, 16, -3, 24, 140, 10944 }, // ӳ
+    { 20, 27, 20, 1, 27, 135, 11084 }, // Ӵ
+    { 16, 23, 17, 1, 22, 92, 11219 }, // ӵ
+    { 19, 27, 16, -1, 21, 129, 11311 }, // Ӷ
+    { 12, 22, 13, 0, 16, 66, 11440 }, // ӷ
+    { 29, 28, 26, -1, 27, 203, 11506 }, // Ӹ
+    { 20, 23, 22, 1, 22, 115, 11709 }, // ӹ
+    { 19, 27, 16, -1, 21, 129, 11824 }, // Ӻ
+    { 12, 22, 13, 0, 16, 66, 11953 }, // ӻ
+    { 24, 27, 19, -3, 21, 162, 12019 }, // Ӽ
+    { 18, 23, 16, -1, 16, 104, 12181 }, // ӽ
+    { 24, 21, 19, -3, 21, 126, 12285 }, // Ӿ
+    { 18, 17, 16, -1, 16, 77, 12411 }, // ӿ
+    { 0, 0, 15, 0, 0, 0, 12488 }, //  
+    { 0, 0, 29, 0, 0, 0, 12488 }, //  
+    { 0, 0, 15, 0, 0, 0, 12488 }, //  
+    { 0, 0, 29, 0, 0, 0, 12488 }, //  
+    { 0, 0, 10, 0, 0, 0, 12488 }, //  
+    { 0, 0, 7, 0, 0, 0, 12488 }, //  
+    { 0, 0, 5, 0, 0, 0, 12488 }, //  
+    { 0, 0, 18, 0, 0, 0, 12488 }, //  
+    { 0, 0, 8, 0, 0, 0, 12488 }, //  
+    { 0, 0, 6, 0, 0, 0, 12488 }, //  
+    { 0, 0, 1, 0, 0, 0, 12488 }, //  
+    { 0, 0, 0, 0, 0, 0, 12488 }, // ​
+    { 2, 24, 0, -1, 17, 12, 12488 }, // ‌
+    { 6, 26, 0, -3, 19, 39, 12500 }, // ‍
+    { 10, 28, 0, -5, 21, 70, 12539 }, // ‎
+    { 10, 28, 0, -5, 21, 70, 12609 }, // ‏
+    { 9, 3, 11, 1, 9, 7, 12679 }, // ‐
+    { 9, 3, 11, 1, 9, 7, 12686 }, // ‑
+    { 14, 3, 18, 2, 11, 11, 12693 }, // ‒
+    { 15, 3, 15, 0, 9, 12, 13087 }, // –
+    { 29, 3, 29, 0, 9, 22, 13099 }, // —
+    { 29, 3, 29, 0, 9, 22, 12704 }, // ―
+    { 10, 30, 15, 2, 23, 75, 12726 }, // ‖
+    { 15, 7, 15, 0, -1, 27, 12801 }, // ‗
+    { 7, 10, 9, 2, 22, 18, 13121 }, // ‘
+    { 6, 9, 9, 2, 22, 14, 13139 }, // ’
+    { 6, 10, 9, 1, 4, 15, 12828 }, // ‚
+    { 5, 10, 7, 1, 22, 13, 12843 }, // ‛
+    { 12, 10, 15, 2, 22, 30, 13153 }, // “
+    { 12, 10, 15, 2, 22, 30, 13183 }, // ”
+    { 12, 10, 15, 1, 4, 30, 12856 }, // „
+    { 11, 10, 13, 1, 22, 28, 12886 }, // ‟
+    { 13, 19, 14, 1, 21, 62, 12914 }, // †
+    { 14, 23, 14, 0, 21, 81, 12976 }, // ‡
+    { 7, 7, 9, 1, 11, 13, 13057 }, // •
+    { 10, 10, 18, 4, 15, 25, 13070 }, // ‣
+    { 6, 5, 8, 1, 4, 8, 13095 }, // ․
+    { 12, 5, 15, 1, 4, 15, 13103 }, // ‥
+    { 24, 5, 29, 2, 4, 30, 13213 }, // …
+    { 6, 4, 8, 1, 10, 6, 13118 }, // ‧
+    { 0, 0, 0, 0, 0, 0, 13124 }, //  
+    { 0, 0, 0, 0, 0, 0, 13124 }, //  
+    { 10, 28, 0, -5, 21, 70, 13124 }, // ‪
+    { 10, 28, 0, -5, 21, 70, 13194 }, // ‫
+    { 10, 27, 0, -5, 20, 68, 13264 }, // ‬
+    { 12, 28, 0, -6, 21, 84, 13332 }, // ‭
+    { 12, 28, 0, -6, 21, 84, 13416 }, // ‮
+    { 0, 0, 3, 0, 0, 0, 13500 }, //  
+    { 36, 24, 40, 2, 22, 216, 13500 }, // ‰
+    { 6, 10, 8, 1, 21, 15, 13716 }, // ′
+    { 12, 10, 13, 1, 21, 30, 13731 }, // ″
+    { 17, 10, 19, 1, 21, 43, 13761 }, // ‴
+    { 6, 10, 8, 1, 21, 15, 13804 }, // ‵
+    { 12, 10, 14, 1, 21, 30, 13819 }, // ‶
+    { 19, 10, 20, 1, 21, 48, 13849 }, // ‷
+    { 13, 6, 14, 1, 0, 20, 13897 }, // ‸
+    { 8, 11, 9, 1, 13, 22, 13917 }, // ‹
+    { 9, 11, 9, 0, 13, 25, 13939 }, // ›
+    { 18, 20, 18, 0, 19, 90, 13964 }, // ※
+    { 16, 23, 17, 1, 22, 92, 14054 }, // ‼
+    { 15, 3, 15, 0, 24, 12, 14146 }, // ‾
+    { 7, 3, 9, 1, 9, 6, 14158 }, // ⁃
+    { 18, 24, 7, -6, 22, 108, 14164 }, // ⁄
+    { 21, 22, 24, 2, 21, 116, 14272 }, // ⁇
+    { 19, 23, 20, 2, 22, 110, 14388 }, // ⁈
+    { 20, 23, 21, 1, 22, 115, 14498 }, // ⁉
+    { 17, 5, 29, 6, 11, 22, 14613 }, // ⁓
+    { 23, 10, 25, 1, 21, 58, 14635 }, // ⁗
+    { 0, 0, 6, 0, 0, 0, 14693 }, //  
+    { 0, 0, 0, 0, 0, 0, 14693 }, // ⁠
+    { 0, 0, 0, 0, 0, 0, 14693 }, // ⁡
+    { 0, 0, 0, 0, 0, 0, 14693 }, // ⁢
+    { 0, 0, 0, 0, 0, 0, 14693 }, // ⁣
+    { 0, 0, 0, 0, 0, 0, 14693 }, // ⁤
+    { 11, 14, 13, 1, 24, 39, 14693 }, // ⁰
+    { 12, 14, 13, 0, 24, 42, 14732 }, // ⁴
+    { 11, 14, 13, 1, 24, 39, 14774 }, // ⁵
+    { 12, 14, 13, 1, 24, 42, 14813 }, // ⁶
+    { 10, 14, 13, 3, 24, 35, 14855 }, // ⁷
+    { 11, 14, 13, 1, 24, 39, 14890 }, // ⁸
+    { 12, 14, 13, 0, 24, 42, 14929 }, // ⁹
+    { 11, 11, 16, 3, 21, 31, 14971 }, // ⁿ
+    { 11, 15, 13, 1, 10, 42, 15002 }, // ₀
+    { 8, 14, 13, 2, 10, 28, 15044 }, // ₁
+    { 11, 14, 13, 1, 10, 39, 15072 }, // ₂
+    { 10, 15, 13, 1, 10, 38, 15111 }, // ₃
+    { 12, 14, 13, 0, 10, 42, 15149 }, // ₄
+    { 11, 14, 13, 1, 9, 39, 15191 }, // ₅
+    { 12, 15, 13, 1, 10, 45, 15230 }, // ₆
+    { 10, 14, 13, 3, 9, 35, 15275 }, // ₇
+    { 11, 15, 13, 1, 10, 42, 15310 }, // ₈
+    { 12, 15, 13, 0, 10, 45, 15352 }, // ₉
+    { 18, 20, 18, 0, 20, 90, 15397 }, // ₣
+    { 19, 22, 18, -1, 21, 105, 15487 }, // ₤
+    { 35, 22, 36, 0, 21, 193, 15592 }, // ₧
+    { 20, 22, 18, -1, 21, 110, 15785 }, // €
+    { 17, 12, 29, 6, 16, 51, 15895 }, // ←
+    { 13, 20, 29, 8, 20, 65, 15946 }, // ↑
+    { 17, 12, 29, 6, 16, 51, 16011 }, // →
+    { 13, 20, 29, 8, 20, 65, 16062 }, // ↓
+    { 18, 12, 29, 5, 16, 54, 16127 }, // ↔
+    { 13, 20, 29, 8, 20, 65, 16181 }, // ↕
+    { 13, 20, 29, 8, 20, 65, 16246 }, // ↨
+    { 13, 20, 29, 8, 20, 65, 16311 }, // ↲
+    { 13, 20, 29, 8, 20, 65, 16376 }, // ↳
+    { 17, 14, 29, 6, 17, 60, 16441 }, // ↵
+    { 17, 14, 29, 6, 17, 60, 16501 }, // ⇐
+    { 13, 18, 29, 8, 19, 59, 16561 }, // ⇑
+    { 17, 14, 29, 6, 17, 60, 16620 }, // ⇒
+    { 13, 18, 29, 8, 19, 59, 16680 }, // ⇓
+    { 19, 14, 29, 5, 17, 67, 16739 }, // ⇔
+    { 19, 22, 29, 5, 21, 105, 16806 }, // ∀
+    { 14, 24, 18, 2, 23, 84, 16911 }, // ∂
+    { 13, 21, 29, 8, 21, 69, 16995 }, // ∃
+    { 23, 24, 29, 3, 22, 138, 17064 }, // ∅
+    { 19, 21, 19, 0, 21, 100, 17202 }, // ∆
+    { 19, 22, 29, 5, 21, 105, 17302 }, // ∇
+    { 19, 21, 29, 5, 21, 100, 17407 }, // ∈
+    { 19, 26, 29, 5, 23, 124, 17507 }, // ∉
+    { 19, 16, 29, 5, 18, 76, 17631 }, // ∊
+    { 19, 21, 29, 5, 21, 100, 17707 }, // ∋
+    { 19, 26, 29, 5, 23, 124, 17807 }, // ∌
+    { 19, 16, 29, 5, 18, 76, 17931 }, // ∍
+    { 22, 26, 23, 1, 21, 143, 18007 }, // ∏
+    { 18, 26, 18, 0, 21, 117, 18150 }, // ∑
+    { 13, 3, 18, 3, 11, 10, 18267 }, // −
+    { 17, 23, 14, -1, 21, 98, 18277 }, // ∕
+    { 11, 23, 14, 2, 21, 64, 18375 }, // ∖
+    { 14, 14, 18, 2, 17, 49, 18439 }, // ∗
+    { 10, 10, 18, 4, 15, 25, 18488 }, // ∘
+    { 6, 4, 18, 6, 10, 6, 18513 }, // ∙
+    { 18, 28, 18, 0, 24, 126, 18519 }, // √
+    { 14, 11, 18, 2, 15, 39, 18645 }, // ∝
+    { 18, 10, 18, 0, 14, 45, 18684 }, // ∞
+    { 19, 21, 29, 5, 21, 100, 18729 }, // ∟
+    { 21, 21, 29, 3, 21, 111, 18829 }, // ∠
+    { 4, 30, 15, 5, 23, 30, 18940 }, // ∣
+    { 9, 30, 15, 3, 23, 68, 18970 }, // ∥
+    { 19, 21, 29, 5, 21, 100, 19038 }, // ∧
+    { 19, 21, 29, 5, 21, 100, 19138 }, // ∨
+    { 17, 21, 29, 6, 21, 90, 19238 }, // ∩
+    { 17, 22, 29, 6, 21, 94, 19328 }, // ∪
+    { 16, 30, 18, 1, 23, 120, 19422 }, // ∫
+    { 19, 17, 29, 5, 16, 81, 19542 }, // ∴
+    { 19, 17, 29, 5, 16, 81, 19623 }, // ∵
+    { 6, 16, 9, 1, 18, 24, 19704 }, // ∶
+    { 19, 17, 29, 5, 16, 81, 19728 }, // ∷
+    { 17, 5, 29, 6, 11, 22, 19809 }, // ∼
+    { 17, 15, 29, 6, 17, 64, 19831 }, // ≅
+    { 14, 10, 18, 2, 15, 35, 19895 }, // ≈
+    { 17, 10, 29, 6, 13, 43, 19930 }, // ≍
+    { 13, 13, 18, 3, 16, 43, 19973 }, // ≠
+    { 17, 13, 29, 6, 15, 56, 20016 }, // ≡
+    { 14, 18, 18, 2, 18, 63, 20072 }, // ≤
+    { 14, 18, 18, 2, 18, 63, 20135 }, // ≥
+    { 23, 14, 29, 3, 17, 81, 20198 }, // ≪
+    { 23, 14, 29, 3, 17, 81, 20279 }, // ≫
+    { 19, 16, 29, 5, 18, 76, 20360 }, // ⊃
+    { 19, 26, 29, 5, 23, 124, 20436 }, // ⊄
+    { 19, 26, 29, 5, 23, 124, 20560 }, // ⊅
+    { 19, 21, 29, 5, 21, 100, 20684 }, // ⊆
+    { 19, 21, 29, 5, 21, 100, 20784 }, // ⊇
+    { 21, 22, 29, 4, 21, 116, 20884 }, // ⊕
+    { 21, 22, 29, 4, 21, 116, 21000 }, // ⊖
+    { 21, 22, 29, 4, 21, 116, 21116 }, // ⊗
+    { 21, 22, 29, 4, 21, 116, 21232 }, // ⊘
+    { 17, 21, 29, 6, 21, 90, 21348 }, // ⊥
+    { 6, 5, 18, 6, 10, 8, 21438 }, // ⋅
+    { 25, 5, 29, 2, 10, 32, 21446 }, // ⋯
+    { 30, 30, 21, -5, 23, 225, 21478 }, // ﬀ
+    { 24, 30, 19, -5, 23, 180, 21703 }, // ﬁ
+    { 25, 30, 20, -5, 23, 188, 21883 }, // ﬂ
+    { 33, 30, 28, -5, 23, 248, 22071 }, // ﬃ
+    { 34, 30, 29, -5, 23, 255, 22319 }, // ﬄ
+    { 27, 30, 21, -5, 23, 203, 22574 }, // ﬅ
+    { 24, 22, 23, 0, 21, 132, 22777 }, // ﬆ
+    { 27, 28, 29, 1, 24, 189, 22909 }, // �
 };
 
 static const EpdUnicodeInterval bookerly_14_italicIntervals[] = {
@@ -2615,32 +2657,329 @@ static const EpdUnicodeInterval bookerly_14_italicIntervals[] = {
     { 0x22A5, 0x22A5, 0x2E7 },
     { 0x22C5, 0x22C5, 0x2E8 },
     { 0x22EF, 0x22EF, 0x2E9 },
-    { 0xFFFD, 0xFFFD, 0x2EA },
+    { 0xFB00, 0xFB06, 0x2EA },
+    { 0xFFFD, 0xFFFD, 0x2F1 },
 };
 
 static const EpdFontGroup bookerly_14_italicGroups[] = {
-    { 0, 4229, 7834, 100, 0 },
-    { 4229, 3924, 9197, 96, 100 },
-    { 8153, 5816, 14682, 128, 196 },
-    { 13969, 375, 443, 33, 324 },
-    { 14344, 9339, 24258, 220, 357 },
-    { 23683, 1260, 2361, 74, 577 },
-    { 24943, 517, 704, 18, 651 },
-    { 25460, 327, 498, 4, 669 },
-    { 25787, 513, 911, 15, 673 },
-    { 26300, 2222, 4672, 58, 688 },
-    { 28522, 116, 189, 1, 746 },
+    { 0, 5623, 13243, 151, 5 },
+    { 5623, 3449, 6759, 66, 358 },
+    { 9072, 9698, 24080, 261, 0 },
+    { 18770, 10416, 23098, 276, 471 },
+};
+
+static const uint8_t bookerly_14_italicGlyphGroups[754] = {
+    2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0,
+    2, 2, 2, 2, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0,
+    0, 2, 2, 2, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0,
+    0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 3, 3, 3, 0, 0, 3, 3, 0, 0, 3,
+    3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+};
+
+static const uint8_t bookerly_14_italicKernLeftClasses[754] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 0, 89,
+    0, 3, 65, 3, 30, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 2, 84, 80, 9, 35, 64, 50, 13, 13, 55,
+    53, 34, 110, 23, 9, 57, 52, 22, 59, 17, 7, 16, 16, 81, 11, 82,
+    92, 45, 0, 0, 0, 0, 29, 20, 103, 0, 37, 40, 25, 33, 0, 125,
+    102, 0, 33, 33, 20, 20, 98, 43, 74, 105, 29, 47, 47, 121, 47, 68,
+    73, 0, 0, 0, 0, 77, 0, 0, 0, 0, 0, 0, 0, 0, 0, 106,
+    0, 65, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 72,
+    0, 0, 0, 62, 2, 2, 2, 2, 2, 2, 35, 80, 35, 35, 35, 35,
+    13, 13, 13, 13, 9, 23, 9, 9, 9, 9, 9, 0, 9, 7, 7, 7,
+    7, 11, 70, 129, 29, 29, 29, 29, 29, 29, 37, 126, 37, 37, 37, 37,
+    0, 0, 39, 39, 20, 33, 20, 20, 20, 20, 20, 0, 88, 29, 29, 29,
+    29, 47, 20, 47, 2, 29, 2, 29, 41, 85, 80, 103, 80, 103, 80, 103,
+    80, 103, 9, 28, 9, 0, 35, 37, 35, 37, 35, 37, 87, 95, 35, 37,
+    50, 25, 50, 25, 50, 25, 50, 25, 13, 33, 13, 33, 13, 93, 13, 39,
+    13, 39, 78, 112, 13, 29, 55, 125, 55, 120, 53, 102, 79, 34, 0, 34,
+    127, 0, 28, 0, 0, 34, 111, 23, 33, 23, 33, 23, 33, 33, 23, 122,
+    9, 20, 9, 20, 9, 20, 35, 37, 22, 43, 22, 43, 22, 43, 59, 74,
+    59, 74, 59, 107, 59, 74, 17, 124, 17, 0, 17, 105, 7, 29, 7, 29,
+    7, 29, 7, 29, 7, 29, 7, 90, 16, 47, 11, 47, 11, 82, 68, 82,
+    68, 82, 68, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 61, 61, 83, 0, 133, 108, 1, 1, 56, 26, 26,
+    66, 6, 1, 4, 1, 10, 132, 38, 14, 46, 61, 6, 38, 1, 1, 6,
+    1, 100, 1, 12, 1, 24, 96, 48, 4, 63, 42, 46, 1, 1, 46, 26,
+    1, 26, 12, 12, 1, 21, 97, 75, 0, 15, 69, 79, 75, 21, 21, 79,
+    21, 21, 21, 15, 60, 15, 103, 60, 32, 15, 115, 19, 21, 21, 19, 27,
+    21, 27, 15, 15, 21, 69, 69, 99, 0, 103, 113, 0, 94, 116, 27, 27,
+    60, 79, 21, 32, 21, 119, 27, 12, 15, 51, 130, 46, 19, 26, 27, 24,
+    15, 44, 76, 36, 0, 0, 0, 71, 91, 38, 75, 71, 91, 6, 79, 6,
+    79, 6, 79, 46, 19, 0, 0, 0, 0, 104, 114, 96, 103, 14, 19, 18,
+    32, 18, 32, 58, 86, 46, 19, 46, 19, 1, 21, 67, 60, 117, 69, 117,
+    69, 1, 6, 79, 128, 123, 46, 19, 56, 116, 46, 19, 1, 0, 46, 19,
+    131, 10, 21, 10, 21, 61, 69, 61, 69, 12, 15, 12, 15, 6, 79, 38,
+    75, 109, 118, 1, 21, 1, 21, 12, 15, 12, 15, 12, 15, 12, 15, 4,
+    32, 4, 32, 4, 32, 1, 21, 14, 0, 1, 21, 36, 0, 54, 101, 42,
+    115, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 65, 65, 0, 65, 65, 65, 0, 0, 8, 5, 31, 8, 8, 5, 3,
+    0, 0, 0, 0, 0, 0, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 106, 72, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 0, 0, 0, 0, 105,
+    105, 0,
+};
+
+static const uint8_t bookerly_14_italicKernRightClasses[754] = {
+    0, 0, 0, 0, 0, 0, 91, 0, 0, 0, 0, 0, 0, 0, 78, 32,
+    0, 22, 23, 2, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 36,
+    35, 0, 0, 0, 62, 0, 4, 26, 5, 26, 26, 26, 5, 26, 26, 55,
+    26, 26, 92, 26, 5, 26, 5, 26, 89, 30, 7, 24, 24, 84, 18, 100,
+    0, 11, 79, 0, 0, 0, 1, 25, 1, 1, 1, 14, 16, 25, 72, 66,
+    25, 25, 17, 17, 1, 87, 1, 17, 31, 44, 12, 21, 21, 86, 67, 70,
+    0, 0, 79, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 41,
+    0, 23, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 59,
+    0, 0, 0, 101, 4, 4, 4, 4, 4, 4, 49, 5, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 5, 5, 5, 5, 5, 0, 5, 7, 7, 7,
+    7, 18, 26, 74, 1, 1, 1, 1, 37, 1, 1, 1, 1, 1, 1, 1,
+    96, 72, 51, 51, 1, 17, 1, 1, 1, 1, 1, 0, 54, 12, 12, 12,
+    12, 21, 85, 21, 4, 1, 4, 1, 4, 1, 5, 1, 5, 1, 5, 1,
+    5, 37, 26, 1, 26, 1, 26, 1, 26, 1, 26, 1, 26, 1, 26, 1,
+    5, 16, 5, 16, 5, 16, 5, 16, 26, 25, 26, 81, 26, 88, 26, 51,
+    26, 51, 26, 72, 26, 17, 26, 72, 55, 104, 26, 25, 17, 26, 25, 26,
+    25, 26, 25, 26, 25, 26, 76, 26, 17, 26, 17, 26, 17, 17, 26, 17,
+    5, 1, 5, 1, 5, 1, 5, 1, 26, 17, 26, 17, 26, 17, 89, 31,
+    89, 31, 89, 31, 89, 73, 30, 44, 30, 44, 30, 44, 7, 12, 7, 12,
+    7, 12, 7, 12, 7, 12, 7, 12, 24, 21, 18, 21, 18, 100, 70, 100,
+    70, 100, 70, 74, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 9, 9, 20, 9, 29, 89, 9, 9, 61, 38, 9,
+    20, 9, 9, 40, 9, 28, 9, 95, 9, 57, 9, 58, 99, 9, 9, 9,
+    38, 94, 9, 29, 9, 95, 29, 20, 40, 69, 46, 9, 27, 9, 9, 20,
+    9, 9, 97, 9, 75, 3, 68, 3, 65, 60, 3, 34, 42, 10, 10, 13,
+    15, 45, 13, 3, 13, 13, 3, 13, 19, 3, 71, 10, 8, 10, 10, 63,
+    10, 10, 42, 13, 80, 3, 3, 90, 65, 3, 83, 102, 93, 52, 15, 13,
+    82, 13, 10, 19, 10, 20, 13, 29, 3, 56, 19, 9, 13, 0, 98, 95,
+    13, 9, 77, 9, 65, 9, 13, 58, 34, 99, 42, 9, 13, 9, 13, 0,
+    0, 20, 0, 9, 13, 9, 13, 9, 13, 29, 3, 29, 3, 20, 13, 43,
+    19, 43, 19, 46, 71, 0, 0, 27, 8, 27, 8, 9, 82, 47, 39, 47,
+    39, 9, 58, 34, 9, 13, 38, 15, 9, 13, 9, 13, 27, 8, 0, 45,
+    103, 28, 3, 28, 3, 50, 3, 9, 3, 105, 53, 0, 53, 58, 34, 99,
+    42, 100, 64, 9, 10, 9, 10, 29, 3, 29, 3, 29, 3, 0, 42, 40,
+    19, 40, 19, 40, 19, 0, 8, 9, 65, 9, 10, 9, 65, 46, 71, 46,
+    71, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 23, 23, 0, 23, 23, 23, 0, 0, 6, 33, 2, 6, 6, 33, 2,
+    0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 41, 59, 0, 91, 0, 0, 0,
+    62, 62, 91, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 14, 14, 14, 14, 14,
+    31, 0,
+};
+
+static const int8_t bookerly_14_italicKernMatrix[14204] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -1, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, 1, -1, -3, -2, 0, 0, 0, -5, -1, 0, 0, 0, 1, -1, -3, 0, 0, -2, 0, -1, -4, 0, 0, 0, 0, 0, -2, 0, -3, -2, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, -1, 1, -1, -3, -2, -3, 0, -1, 0, -1, -1, 1, 0, 1, -1, -2, -2, -1, -2, 0, 0, -3, 0, 0, -3, 1, -1, -1, 0, 0, -3, 0, 0, 0, -1, 1, -1, 0, 0, 0, -2, -1, 0, 1, -4, 0, 1, 1, 0, 2, 0, -1, 2, -3, 1, 1, 0, -1, 2, 0, -2, 0, 0, 2, -2, -1, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -4, -2, 0, 0, 0, 0, 0, 1, 0, 2, 0, 0, 0, -4, 0, 0, 0, 0, 1, 0, -4, 0, 0, 0, 0, 2, -3, 0, 0, 0, 2, 1, -1, 0, 0, 0, -2, -1, 2, 0, -1, 2, 0, -1, 1, 0, -3, 0, -4, 0, 0, -1, 0, 0, 1, -2, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, 1, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -3, -4, -3, -4, -2, 0, -1, 0, -1, -1, 0, -1, -1, -2, -5, -3, -1, -1, 0, -1, 0, -4, 0, -1, -1, -1, 0, -4, -2, -1, -3, 0, 0, -2, 0, 0, -3, -4, -3, 0, 0, -2, -1, 0, -3, -1, 0, 0, -4, -4, 0, 0, 0, -3, -1, -1, -4, -1, 0, -3, -1, -1, 0, 0, -2, 0, 0, -2, -1, -1, -1, -1, -3, 0, -2, -1, -2, 0, 0, -3, -1, -1, -3, -1, -1, -1, -1, 0, -1, -1, -2, -2, 0, -2, -1, -1, -1, 0, -1, -1, 0, -1, -1, 0, 0,
+    0, 0, -1, -1, 0, 0, 0, 0, -2, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, -1, -1, -1, 0, 0, -2, 0, -1, -1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, -1, 0, 0, 0, 1, 0, 0, -1, 0, 0, -2, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -2, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, -3, -2, -3, -1, 0, -1, 0, -1, 0, 0, 0, 0, -1, -5, -2, 0, 0, 0, 0, 0, -3, 0, -1, 0, -1, 0, -3, -1, 0, -2, 0, 0, -2, 0, 0, -2, -3, 0, 0, 0, -1, 0, 0, -2, 0, 0, 0, -3, -3, 0, 0, -1, -2, 0, -1, -2, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, 0, -2, 0, -2, 0, -2, 0, 0, -2, 0, 0, -2, 0, 0, -1, 0, 0, -1, 0, -1, -1, 0, -1, -1, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0,
+    0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, -3, 0, -3, 0, -1, -5, 0, -1, 0, 0, 0, 0, 0, -2, -2, 0, 0, -1, 0, 0, 0, -4, 1, -1, 0, 0, -3, -2, 0, 0, 0, 0, 1, -2, -1, -1, 0, -3, 0, 0, 1, -3, 0, 0, 1, 0, 0, 0, 0, 0, -4, 1, 1, 0, -1, 0, -1, -2, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0,
+    0, -2, -3, 0, -3, -1, 0, 0, 0, 0, 0, 1, -1, 0, -1, 0, -1, 0, 1, 0, 0, 0, -3, -1, 0, 0, 0, 0, 0, 0, 0, -2, 2, 1, 0, -1, -1, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -3, -3, 0, 1, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -3, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 1, -3, 0, 0, 0, 2, 1, -1, -2, -2, 0, -1, -3, 1, -1, -1, 0, 0, -1, 0, 0, -2, 0, -3, 0, 0, -1, 0, 0, 0, -2, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, -4, 0, -3, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -4, -1, 0, 0, 0, 0, 0, 0, 0, -1, 1, 1, 0, -2, -2, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -3, -4, 0, 1, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -3, 0, -3, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, -1, 2, 1, 0, -2, -2, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -2, -3, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -3, -1, 0, 0, 0, 0, 0, 0, -1, 1, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, -3, -1, 0, 0, 0, 1, -2, -1, 0, 0, 2, 1, -1, -1, -1, 0, -2, -2, 1, -1, -1, 1, 0, -2, 0, 0, -3, 0, -3, 0, 0, -1, 0, 0, 0, -2, 0, -1, -1, 0, 0, -1, -1, -1, 0, 0, -1, -1, 0, -1, 0, 0, 0, -1, 0, -1, 0, 0, -2, 0, 1, -2, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, -1, -2, -2, 0, 0, 0, -3, -1, 0, -1, 0, 0, 0, -3, 0, 0, -1, 0, -1, -2, 0, 0, 0, 0, 0, -2, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -2, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -4, -1, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, -1, -2, -2, 0, -2, 0, 0, 0, -1, -1, 0, -1, -1, 0, -2, 0, -4, 0, 0, -1, 0, 0, -1, -3, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 2, 0, 1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -2, 0, -1, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, -2, 0, -2, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 3, 1, 0, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 3, 3, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 1, 1, 0, 0, 1, 0, 1, 1, 0, 0, 3, 0, 3, 1, 0, 3, 0, 0, 0, 3, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -3, 0, -3, -3, -1, 0, 0, 0, 0, -1, 0, -1, -1, -1, -3, -3, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, -1, 0, -3, 0, 0, -2, 0, 0, -3, -1, -1, 0, 0, -2, 0, -1, -2, 0, 0, 0, -4, -4, 0, 0, -2, -3, 0, 0, -2, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, -1, -1, -2, -1, 0, -3, 0, -1, 0, -2, 0, 0, -3, 0, 0, -3, 0, 0, -1, -1, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, -1, 1, -1, -3, -2, -3, 0, -1, 0, -1, -1, 2, 0, 1, -1, -2, -2, -1, -2, 0, 0, -3, 0, 0, -3, 1, -1, -1, 0, 0, -3, 0, 0, 0, -1, 1, -1, 0, 0, 0, -2, -1, 0, 1, -4, 0, 1, 1, 0, 2, 0, -1, 2, -3, 1, 1, 0, -1, 2, 0, -2, 0, 0, 2, 0, -1, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -2, -1, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, -2, 0, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -3, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 1, 0, -2, -2, 0, -1, 0, 1, -1, 0, 0, 0, -1, 0, 0, -2, 0, -3, 0, 0, 0, 0, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, -2, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 1, 0, 0, 2, 0, 0, 0, 2, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -2, 0, 0, 0, 1, 0, 0, 0, 0, 2, 0, 0, 0, 0, -1, -1, 0, 0, 0, 1, -2, 0, 0, 1, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 1, 0, 0, 0, 1, 0, -1, 2, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+    0, -1, 0, 0, 1, -1, -3, -2, 0, 0, 0, -5, -1, 0, 3, 0, 1, -1, -3, 0, 0, -2, 0, -1, -4, 0, 0, 0, 0, 0, -2, 0, -3, -2, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 4, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -1, 0, 0, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 1, -1, 0, 0, 0, 0, 0, -1, -1, 0, 1, -2, 0, -1, 0, 0, 0, 0, 1, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1, 0, -1, 0, 0, -1, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, -2, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, -4, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 1, -3, 0, 0, 0, 1, 1, -2, 0, 0, 0, -2, -3, 1, 0, -2, 0, 0, -2, 0, 0, 0, 0, -4, 0, 0, -2, 0, 0, 0, -2, 0, 0, 0, 0, 0, -2, -2, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, -2, 1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, -1, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 2, 0, -3, -1, -2, -1, 0, 0, -3, 0, 0, -2, 1, -1, -2, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, -3, 0, 0, 2, -2, 0, 1, 1, 0, 0, 0, 0, 0, -3, 2, 1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, 1, 1, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -3, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 1, -3, 0, 0, 0, 2, 1, -1, -2, -2, 0, -1, -3, 1, -1, -1, 0, 0, -1, 0, 0, -2, 0, -3, 0, 0, -1, 0, 0, 0, -2, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 4, -1, 2, 0, 1, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, -1, 3, 0, 1, 0, 0, -1, 3, 0, 0, 0, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 2, 0, 0, 2, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, -1, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -3, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, -3, -1, 0, 0, 0, 0, -4, -1, 0, 0, 0, 0, -1, -1, -1, 0, -2, -1, 1, 0, -1, 0, 0, -1, 0, 0, 0, 0, -3, 0, 0, -1, 0, 0, 0, -3, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, 2, 0, -1, 0, 0, 0, 5, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 5, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 7, 6, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, 1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 1, 0, 0, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -2, 0, 0, 0, 0, -2, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, -1, 0, -1, -2, 0, -1, -1, 0, 0, -1, 1, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0, 1, 1, 0, -2, 0, 0, -1, -1, -2, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 1, 0, -1, -1, -1, 0, -1, 0, 1, 0, -1, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -4, 0, -3, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, -4, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -2, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -4, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -1, 0, 0, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, -1, 0, 0, 0, 0, 1, -1, 0, 0, 0, 0, 0, -1, -1, 0, 1, -2, 0, -1, 0, 0, 0, 0, 1, -1, 0, 0, 1, 0, 3, 0, 0, 0, 0, 1, 1, 0, -1, 4, 0, -1, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 2, 0, 1, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, -1, 3, -1, 0, 0, 0, -1, 3, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1, 0, 0, -1, 0, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0,
+    0, -1, -3, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, -2, -2, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -2, -3, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -2, 0, -2, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -2, -2, 0, 0, 0, 0, 0, 0, -2, 0, -1, 0, 0, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 1, -2, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -3, 0, 0, 0, 0, 0, 0, -3, 0, -1, 0, 0, -3, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, -3, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -3, 0, -2, 0, 0, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -3, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 1, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 2, 0, -1, 1, 0, 0, 0, 0, -1, 1, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, -1, 0, 0, 0, 0, -1, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 2, -1, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -1, 0, 1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, -1, 0, 0, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -2, 0, 0, 4, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -2, 0, 0, 3, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 1, 0, 0, 0, 0, -1, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 2, 0, 1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t bookerly_14_italicGlyphLookup[368] = {
+    0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0001, 0x0002, 0xFFFF, 0xFFFF, 0xFFFF, 0x0003, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0004, 0xFFFF, 0xFFFF,
+    0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, 0x0010, 0x0011, 0x0012, 0x0013, 0x0014,
+    0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, 0x0020, 0x0021, 0x0022, 0x0023, 0x0024,
+    0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, 0x0030, 0x0031, 0x0032, 0x0033, 0x0034,
+    0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, 0x0040, 0x0041, 0x0042, 0x0043, 0x0044,
+    0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051, 0x0052, 0x0053, 0x0054,
+    0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, 0x0060, 0x0061, 0x0062, 0x0063, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x0072, 0x0073,
+    0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, 0x0080, 0x0081, 0x0082, 0x0083,
+    0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F, 0x0090, 0x0091, 0x0092, 0x0093,
+    0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F, 0x00A0, 0x00A1, 0x00A2, 0x00A3,
+    0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF, 0x00B0, 0x00B1, 0x00B2, 0x00B3,
+    0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF, 0x00C0, 0x00C1, 0x00C2, 0x00C3,
+    0x0241, 0x0242, 0x0243, 0x0244, 0x0245, 0x0246, 0x0247, 0x0248, 0x0249, 0x024A, 0x024B, 0x024C, 0x024D, 0x024E, 0x024F, 0x0250,
+    0x0251, 0x0252, 0x0253, 0x0254, 0x0255, 0x0256, 0x0257, 0x0258, 0x0259, 0x025A, 0x025B, 0x025C, 0x025D, 0x025E, 0x025F, 0x0260,
+    0x0261, 0x0262, 0x0263, 0x0264, 0x0265, 0x0266, 0x0267, 0x0268, 0x0269, 0x026A, 0x026B, 0x026C, 0x026D, 0x026E, 0x026F, 0x0270,
+    0x0271, 0xFFFF, 0x0272, 0x0273, 0x0274, 0x0275, 0x0276, 0x0277, 0x0278, 0x0279, 0x027A, 0x027B, 0x027C, 0xFFFF, 0x027D, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x027E, 0x027F, 0xFFFF, 0xFFFF, 0x0280, 0x0281, 0x0282, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x0283, 0xFFFF, 0xFFFF, 0xFFFF, 0x0284, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0285,
+    0x0286, 0x0287, 0x0288, 0x0289, 0x028A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
 };
 
 static const EpdFontData bookerly_14_italic = {
     bookerly_14_italicBitmaps,
     bookerly_14_italicGlyphs,
     bookerly_14_italicIntervals,
-    64,
+    65,
     38,
     31,
     -8,
     true,
     bookerly_14_italicGroups,
-    11,
+    4,
+    bookerly_14_italicKernLeftClasses,
+    bookerly_14_italicKernRightClasses,
+    bookerly_14_italicKernMatrix,
+    106,
+    nullptr,
+    0,
+    0,
+    bookerly_14_italicGlyphLookup,
+    bookerly_14_italicGlyphGroups,
+    false,
+    nullptr,
 };
@@ -3,1699 +3,1745 @@
  * name: bookerly_14_regular
  * size: 14
  * mode: 2-bit  compressed: true
- * Command used: fontconvert.py bookerly_14_regular 14 ../builtinFonts/source/Bookerly/Bookerly-Regular.ttf --2bit --compress
+ * Command used: fontconvert.py bookerly_14_regular 14 ../builtinFonts/source/Bookerly/Bookerly-Regular.ttf --2bit --compress --frequency-corpus ../../../test/hyphenation_eval/resources/english_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/french_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/german_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/italian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/russian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/spanish_hyphenation_tests.txt
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t bookerly_14_regularBitmaps[26979] = {
-    0x95, 0x59, 0x3F, 0x8C, 0xDC, 0xD6, 0x99, 0xFF, 0xC8, 0xE7, 0x5D, 0x06, 0x21, 0x72, 0x4F, 0x85,
-    0x95, 0x18, 0x59, 0x27, 0xBC, 0xE2, 0x8A, 0x3B, 0xC0, 0x36, 0x1B, 0x17, 0x2A, 0x56, 0x43, 0xDA,
-    0x0A, 0x90, 0x22, 0x85, 0xB7, 0xD0, 0x5E, 0x80, 0xBB, 0x42, 0xF5, 0xF9, 0x80, 0xEC, 0x15, 0x2E,
-    0xAE, 0xD8, 0x1D, 0x52, 0x48, 0x91, 0x22, 0x45, 0x74, 0x4D, 0xDA, 0xB8, 0x38, 0xE0, 0x92, 0x0D,
-    0x70, 0xEB, 0x42, 0x85, 0x0E, 0x99, 0x59, 0x72, 0xA5, 0xC2, 0x40, 0xD4, 0xD0, 0x36, 0xEE, 0x52,
-    0xB8, 0x30, 0x73, 0x56, 0xA0, 0x00, 0x2A, 0x44, 0x49, 0xD4, 0x89, 0x5A, 0x93, 0xF3, 0xEE, 0xF7,
-    0xFB, 0x38, 0x3B, 0x2B, 0xC9, 0x96, 0x1D, 0x0F, 0x86, 0xB3, 0x9C, 0x37, 0x8F, 0xEF, 0x7D, 0x7F,
-    0x7F, 0xDF, 0xEF, 0x7B, 0xFB, 0xDD, 0xE8, 0xE6, 0xFF, 0xB6, 0xF3, 0xF8, 0x47, 0xD7, 0x9B, 0x59,
-    0x1C, 0x1C, 0x35, 0xBB, 0xD6, 0x94, 0x8D, 0x88, 0xA4, 0x7D, 0x71, 0xE9, 0x28, 0x7D, 0x69, 0x3D,
-    0x0A, 0x6E, 0x5E, 0xBF, 0xD7, 0xCC, 0x76, 0xA3, 0x28, 0x78, 0xFF, 0xE8, 0x5E, 0xB3, 0xFB, 0xFA,
-    0xB7, 0x64, 0x7C, 0x6D, 0x9A, 0x52, 0x82, 0xFC, 0x9C, 0xC8, 0xD5, 0x20, 0x15, 0x2B, 0xEF, 0xC9,
-    0xFE, 0xF1, 0xC1, 0x6F, 0xAC, 0x73, 0xAE, 0xF2, 0xAB, 0xD7, 0x44, 0x5E, 0xF1, 0x4B, 0x31, 0xE5,
-    0xA6, 0xC8, 0x39, 0xCC, 0x0B, 0xF3, 0x6B, 0x92, 0xE0, 0xA7, 0xF5, 0x83, 0xFD, 0xE3, 0x77, 0xA5,
-    0xB1, 0x22, 0xDF, 0xF7, 0x6A, 0xF1, 0xAB, 0x57, 0xC7, 0x65, 0x4E, 0x5F, 0x98, 0xCF, 0xEF, 0x58,
-    0xD5, 0xE4, 0xB2, 0xEE, 0xAE, 0xF8, 0xCE, 0xE5, 0xF3, 0x73, 0x83, 0xBD, 0x70, 0xE1, 0x8F, 0xCD,
-    0xEB, 0xE7, 0x23, 0xF3, 0xC6, 0x1B, 0xDD, 0x3B, 0x62, 0x3F, 0x4B, 0x25, 0xE9, 0x44, 0x0A, 0x5E,
-    0x8D, 0x84, 0x71, 0x99, 0xBE, 0xB7, 0xB7, 0x19, 0x9A, 0xDB, 0xE5, 0x7B, 0xE7, 0xA7, 0x36, 0xB8,
-    0xD1, 0xDD, 0xEB, 0x22, 0xB7, 0x90, 0x78, 0x41, 0xB9, 0x44, 0xA0, 0xCD, 0x13, 0x7F, 0xB6, 0x9E,
-    0xD8, 0x4D, 0x2A, 0xF1, 0x5C, 0x2A, 0x11, 0x96, 0x19, 0xC4, 0x54, 0x12, 0xF9, 0x8D, 0x5C, 0x13,
-    0x53, 0xDB, 0x14, 0x33, 0xCF, 0x4B, 0xE7, 0x57, 0x90, 0x26, 0xCC, 0x21, 0xD4, 0xAE, 0x5C, 0xC3,
-    0x90, 0xA9, 0xEC, 0xE5, 0x9A, 0xBF, 0xB4, 0x9B, 0x41, 0xE7, 0x37, 0x71, 0x70, 0xC1, 0x35, 0xF6,
-    0x6E, 0xD5, 0xCC, 0x6C, 0x9E, 0x34, 0xAF, 0xD8, 0x74, 0x26, 0x12, 0x5C, 0x6E, 0xA8, 0x40, 0x13,
-    0x63, 0x96, 0xBC, 0xE6, 0x37, 0x86, 0x4B, 0xC4, 0xD4, 0xEB, 0xAA, 0xD7, 0x04, 0x25, 0xF6, 0xB2,
-    0x69, 0xC7, 0xBD, 0x0E, 0x33, 0xC1, 0x5E, 0xBE, 0x83, 0x71, 0x44, 0xBC, 0x54, 0x9E, 0x7A, 0xC5,
-    0xD8, 0x45, 0x22, 0xFC, 0x26, 0x41, 0x3D, 0xC5, 0x6D, 0x6F, 0x30, 0x60, 0x73, 0x98, 0x55, 0x3A,
-    0x3C, 0x8B, 0xDB, 0x5D, 0x8E, 0x42, 0x70, 0x09, 0x8F, 0x72, 0x7C, 0x2E, 0xE4, 0xEC, 0x45, 0xC9,
-    0x9A, 0xD0, 0x55, 0xF6, 0x57, 0xE5, 0xCE, 0x9F, 0x4D, 0x73, 0x08, 0x91, 0x27, 0xA6, 0x0B, 0xCA,
-    0xA0, 0xB2, 0xF5, 0xAE, 0xEC, 0x49, 0xF2, 0xB3, 0x32, 0xA8, 0xC5, 0xB5, 0x92, 0x60, 0x53, 0xF1,
-    0x07, 0xB1, 0x8B, 0x34, 0x5C, 0x1C, 0x7C, 0xE6, 0xAE, 0x44, 0xAE, 0x0B, 0x07, 0x59, 0xDB, 0x92,
-    0x35, 0x79, 0x69, 0x77, 0xB6, 0xCB, 0xD7, 0xEB, 0x58, 0xD2, 0x2B, 0xBD, 0x56, 0x5A, 0xE9, 0x64,
-    0xC6, 0xA7, 0x21, 0x76, 0x58, 0x42, 0x8A, 0x16, 0x5F, 0x62, 0x09, 0x4B, 0x58, 0x6A, 0x26, 0x51,
-    0x1A, 0x54, 0x98, 0x90, 0x08, 0xFE, 0xF4, 0x12, 0xA7, 0xA6, 0x91, 0x0C, 0x12, 0xCB, 0x54, 0x02,
-    0x2C, 0x80, 0x00, 0x48, 0x20, 0xA4, 0x60, 0x34, 0xCA, 0xF1, 0x17, 0x3F, 0x24, 0x82, 0x35, 0x2D,
-    0xBF, 0x84, 0x25, 0x9E, 0x3F, 0xFD, 0xC0, 0x58, 0x0B, 0xDB, 0x60, 0xEA, 0x79, 0xB1, 0xA5, 0xD7,
-    0xC8, 0x04, 0x43, 0xD8, 0xE3, 0x25, 0x35, 0x87, 0x5F, 0xBD, 0x3C, 0x31, 0x0F, 0xCA, 0xA8, 0xDD,
-    0x8A, 0x5C, 0xF8, 0xF0, 0xC1, 0x83, 0xFC, 0x95, 0x4D, 0x78, 0x49, 0xCE, 0xE8, 0x8F, 0x76, 0x0C,
-    0x99, 0x46, 0x83, 0xC7, 0x0A, 0x22, 0xF0, 0x81, 0x73, 0x3D, 0xCD, 0xFF, 0xD4, 0x2F, 0x6B, 0xF4,
-    0x7D, 0x54, 0x26, 0x69, 0x6F, 0x9A, 0x28, 0xED, 0x83, 0x12, 0x13, 0xE4, 0xED, 0xFD, 0xCC, 0xDD,
-    0x71, 0xED, 0x9A, 0xE9, 0x93, 0x1B, 0x1D, 0x67, 0x44, 0xB4, 0xAD, 0xC0, 0x4F, 0x3E, 0x0C, 0xDE,
-    0x0A, 0x24, 0xE3, 0x42, 0xAB, 0x51, 0xBA, 0xA1, 0x39, 0x19, 0x8D, 0x31, 0x9A, 0x2E, 0x47, 0x21,
-    0x31, 0xBC, 0xB9, 0x1C, 0xF5, 0x56, 0x6E, 0x1C, 0x10, 0x5F, 0xAE, 0x0C, 0x1E, 0x5F, 0x6A, 0x6C,
-    0x65, 0xBA, 0x38, 0xF7, 0x7A, 0x58, 0x64, 0xC0, 0x35, 0x87, 0x57, 0x0F, 0x0F, 0x45, 0xA6, 0x73,
-    0x91, 0x6C, 0x3E, 0xFE, 0x9D, 0xE2, 0xFB, 0x21, 0xC6, 0xE7, 0x88, 0x0C, 0xCC, 0xF3, 0xBA, 0xB8,
-    0x34, 0x8D, 0xAD, 0x6D, 0x1D, 0x20, 0x09, 0xC4, 0x0D, 0xD0, 0x61, 0x0C, 0x93, 0x10, 0xAB, 0x22,
-    0x9D, 0xF8, 0xA6, 0x85, 0xFF, 0xA2, 0x77, 0xBA, 0xE1, 0x86, 0x84, 0x6B, 0x88, 0x6C, 0xB8, 0x34,
-    0x74, 0x0B, 0xD3, 0x6D, 0xB4, 0x53, 0x49, 0x7E, 0x5E, 0x7A, 0x3D, 0x1C, 0x79, 0x94, 0x7A, 0x3D,
-    0xE4, 0x4D, 0xE9, 0x01, 0xC1, 0xAC, 0x38, 0x97, 0x10, 0x09, 0x8A, 0x04, 0x3B, 0x5C, 0x7D, 0x81,
-    0x39, 0x8A, 0xFD, 0xFD, 0xDF, 0x22, 0x8D, 0x91, 0xCA, 0x15, 0x57, 0xDA, 0x19, 0x04, 0x77, 0x8B,
-    0x37, 0x7B, 0x04, 0xC8, 0x5F, 0x49, 0x58, 0xF1, 0x69, 0xAC, 0x83, 0x77, 0x80, 0x70, 0x70, 0x79,
-    0x00, 0x3F, 0x48, 0x06, 0xCB, 0x35, 0x8C, 0x03, 0xC4, 0x86, 0x24, 0xB9, 0xC4, 0xA5, 0x14, 0x1F,
-    0x1C, 0xB8, 0x2A, 0x71, 0xA9, 0x77, 0x71, 0x65, 0x29, 0x5C, 0xD0, 0x06, 0x7A, 0x89, 0xC1, 0x65,
-    0xEF, 0x62, 0x68, 0x07, 0x26, 0xC1, 0x78, 0x1F, 0x0B, 0x52, 0x0D, 0x21, 0x16, 0xC3, 0x09, 0x31,
-    0x94, 0x89, 0x65, 0x0E, 0x49, 0x21, 0xC6, 0x22, 0xC3, 0xB5, 0xB6, 0xBD, 0x73, 0x71, 0x7C, 0xFE,
-    0xC9, 0xEB, 0x2C, 0x96, 0x71, 0x79, 0xE2, 0x7A, 0x73, 0xBC, 0x9F, 0xEF, 0x09, 0xBD, 0x84, 0x84,
-    0xA0, 0x88, 0x44, 0x8D, 0xD0, 0x75, 0xF2, 0xB6, 0xAB, 0x35, 0xF9, 0x0D, 0x74, 0x8C, 0x4A, 0x58,
-    0x5B, 0xF5, 0x34, 0xAD, 0xCA, 0x51, 0x94, 0xFF, 0xEC, 0x9A, 0x00, 0xC9, 0xB2, 0x76, 0x02, 0x17,
-    0x1B, 0x3D, 0x22, 0xEB, 0x4A, 0xB0, 0x10, 0x6F, 0x01, 0x45, 0x00, 0x2C, 0x15, 0xD5, 0x94, 0x64,
-    0x3B, 0xE5, 0x46, 0x10, 0x24, 0xAC, 0x4C, 0x3F, 0x17, 0xFB, 0x09, 0x32, 0x7B, 0x2E, 0xC1, 0x1D,
-    0x24, 0x01, 0x52, 0xE1, 0xD3, 0x56, 0x86, 0xB8, 0x8A, 0x4B, 0xE7, 0x1A, 0x1F, 0x7B, 0x42, 0xDF,
-    0xC8, 0xB9, 0x1A, 0xA2, 0x7F, 0x84, 0xCB, 0xA6, 0x5E, 0xB7, 0x89, 0x68, 0x6F, 0xA0, 0x8F, 0x46,
-    0x16, 0xFC, 0x84, 0xF4, 0xC0, 0x88, 0x20, 0xC9, 0xD4, 0x13, 0xC8, 0x1B, 0x1A, 0x8E, 0xF6, 0x83,
-    0x6F, 0x78, 0xCB, 0x51, 0xC4, 0x22, 0xF2, 0x43, 0x96, 0xF1, 0x2F, 0x81, 0xCB, 0x21, 0x83, 0x0C,
-    0x41, 0x1F, 0xA7, 0xF6, 0x06, 0xF2, 0x32, 0x91, 0xF0, 0x7A, 0x27, 0x9D, 0x6D, 0x12, 0x49, 0xEE,
-    0x96, 0xE2, 0x1A, 0xF8, 0xA2, 0xB2, 0x95, 0xFB, 0x69, 0xE3, 0x0F, 0x53, 0x09, 0xEF, 0x54, 0x0C,
-    0x39, 0x03, 0x11, 0xE7, 0x49, 0x1E, 0x1F, 0x39, 0x6A, 0xAA, 0xB2, 0xF1, 0xE5, 0xC1, 0x2C, 0x89,
-    0x6B, 0xCD, 0x70, 0xA9, 0x89, 0x72, 0x5B, 0x0F, 0x12, 0x61, 0xC5, 0xE4, 0xAD, 0x12, 0x73, 0x11,
-    0x0E, 0x87, 0x12, 0xFE, 0x71, 0x90, 0xF8, 0x4D, 0xF7, 0xCB, 0x01, 0xC8, 0xDC, 0xC8, 0xDB, 0x07,
-    0xA5, 0x86, 0x0B, 0x05, 0x84, 0x51, 0x82, 0x96, 0x26, 0x5D, 0x2B, 0x5A, 0x46, 0xBE, 0x66, 0xDC,
-    0x69, 0x66, 0x2D, 0x5F, 0x5B, 0xC9, 0x8D, 0x3E, 0xC9, 0xB7, 0x24, 0x8D, 0xCA, 0xE2, 0x8D, 0xFE,
-    0x29, 0xDC, 0x7B, 0x31, 0x40, 0x96, 0x24, 0xD2, 0x07, 0x55, 0xE2, 0x35, 0x76, 0xF5, 0xCB, 0x55,
-    0xBA, 0x43, 0x8A, 0x6A, 0xF9, 0x46, 0x04, 0x19, 0xEE, 0x88, 0x2B, 0x3C, 0xB9, 0x60, 0x97, 0x10,
-    0x36, 0x39, 0xB3, 0xBD, 0xBD, 0x8D, 0xD0, 0xFC, 0xFD, 0xFE, 0xFE, 0xBB, 0xE3, 0xA3, 0x67, 0xB7,
-    0xB7, 0xDF, 0x72, 0xEE, 0xFE, 0xFE, 0xFE, 0xAF, 0xA9, 0x19, 0x7C, 0x9F, 0xD0, 0xFF, 0x95, 0x2E,
-    0x28, 0x45, 0xAE, 0x97, 0xDF, 0x53, 0x66, 0xBC, 0x7D, 0x7D, 0x03, 0xD3, 0x50, 0xFB, 0xF4, 0xE9,
-    0x22, 0x07, 0x9C, 0xC2, 0x72, 0x7F, 0x8D, 0xF0, 0x80, 0xC9, 0x23, 0x85, 0x11, 0x60, 0x59, 0x19,
-    0x2F, 0x02, 0x57, 0x47, 0x1D, 0x60, 0x0E, 0x5F, 0x9F, 0x28, 0x5F, 0x48, 0x17, 0x0B, 0xEB, 0xA5,
-    0xF2, 0x22, 0xBF, 0xAD, 0xEF, 0x5F, 0x61, 0xAE, 0x3A, 0x44, 0x91, 0x84, 0x8B, 0xED, 0xA2, 0x96,
-    0xA0, 0x63, 0x36, 0x78, 0x4C, 0xC2, 0x43, 0x3A, 0x1B, 0x71, 0x0D, 0xAC, 0xFB, 0x2F, 0xB1, 0x97,
-    0x3B, 0x0F, 0x1E, 0x98, 0xC5, 0xB2, 0x67, 0xCB, 0xE0, 0x46, 0x1D, 0xA6, 0xBB, 0xB2, 0xBB, 0x27,
-    0x67, 0x82, 0xD2, 0xFC, 0x41, 0xE3, 0x76, 0x13, 0x28, 0x09, 0x18, 0xB9, 0x59, 0x9A, 0xC7, 0x33,
-    0x99, 0xCD, 0x04, 0xB0, 0x6E, 0x7F, 0x58, 0xDA, 0x74, 0xCF, 0x6F, 0xF6, 0x50, 0x05, 0x1E, 0xA2,
-    0x3C, 0x84, 0xEE, 0x00, 0x80, 0x20, 0x51, 0xF5, 0x13, 0xCD, 0x64, 0xEE, 0x5C, 0xEB, 0x1F, 0xD8,
-    0x4B, 0x5E, 0x40, 0x50, 0x5F, 0x91, 0x8D, 0x92, 0x68, 0x84, 0x8D, 0xF8, 0xA7, 0x55, 0xFB, 0x8C,
-    0x2E, 0xD7, 0x8F, 0x4E, 0x27, 0x53, 0x99, 0x40, 0x51, 0xA2, 0xE0, 0xE3, 0x56, 0xA5, 0xBC, 0xCF,
-    0xC9, 0xE7, 0x19, 0x96, 0x41, 0xC9, 0xB5, 0x3B, 0x2E, 0x6D, 0xA9, 0x01, 0xEA, 0x5B, 0xCB, 0x24,
-    0xD8, 0x41, 0x8E, 0x13, 0x74, 0x65, 0xB1, 0x7F, 0x50, 0xD1, 0x84, 0x19, 0x7E, 0x62, 0xAC, 0x4E,
-    0x28, 0x00, 0x10, 0xDE, 0xEB, 0x51, 0xCC, 0x3D, 0xD7, 0x03, 0x81, 0x12, 0x94, 0xB5, 0xB3, 0x5B,
-    0x52, 0x38, 0x97, 0x66, 0xC7, 0x45, 0x6D, 0x9A, 0xA0, 0x31, 0x8D, 0xDF, 0x99, 0xC6, 0xC3, 0x25,
-    0xFC, 0xDB, 0x1A, 0x8C, 0x98, 0xE3, 0x7F, 0x2C, 0x11, 0xD6, 0xB5, 0x39, 0x3E, 0x00, 0x62, 0x7B,
-    0x03, 0x6B, 0x0B, 0xAE, 0x64, 0x79, 0xF1, 0x7E, 0x81, 0x67, 0xFB, 0x18, 0x71, 0x08, 0x18, 0x58,
-    0x86, 0xCB, 0x76, 0x8A, 0xEA, 0x46, 0x7C, 0x73, 0x55, 0xD8, 0x7A, 0x2D, 0x4A, 0xCE, 0x79, 0x4C,
-    0xB4, 0x6F, 0xB6, 0xA8, 0x46, 0x14, 0x9D, 0xFA, 0x30, 0xA9, 0xA8, 0x01, 0xD1, 0x8D, 0xF0, 0x46,
-    0x44, 0xD2, 0x08, 0x66, 0x24, 0xAB, 0x09, 0xD4, 0x02, 0xC5, 0xE3, 0xBF, 0xBF, 0xAA, 0x4A, 0xC5,
-    0x34, 0xD9, 0x59, 0x6C, 0x80, 0x12, 0x4B, 0xB1, 0x6B, 0xC9, 0x8E, 0x41, 0x2F, 0x20, 0x94, 0x2B,
-    0x59, 0xDB, 0xA0, 0x82, 0x50, 0x07, 0x40, 0x89, 0xE2, 0x1F, 0x53, 0x54, 0x3F, 0x86, 0xA7, 0x3F,
-    0x56, 0x3F, 0xA8, 0xA2, 0x06, 0x5A, 0x42, 0x0C, 0x7C, 0x10, 0xE6, 0xD7, 0x1D, 0xB6, 0xC1, 0x3E,
-    0xA7, 0x9A, 0x28, 0x2A, 0xC2, 0x5D, 0x3F, 0x24, 0xA3, 0x82, 0xED, 0x39, 0xFD, 0x55, 0x56, 0x51,
-    0xD5, 0x81, 0xCE, 0xE0, 0x72, 0xD2, 0x43, 0x28, 0xC4, 0x3C, 0xCB, 0x5E, 0x3A, 0x0E, 0x2C, 0xB5,
-    0xC4, 0x8C, 0x97, 0xA8, 0x3A, 0x0B, 0x70, 0x99, 0xC8, 0xB7, 0x1B, 0x48, 0xDE, 0x13, 0x34, 0x35,
-    0x52, 0x71, 0x73, 0x1B, 0x57, 0xDE, 0xCB, 0x14, 0x93, 0xAE, 0x21, 0x0C, 0xAB, 0x44, 0x4E, 0x01,
-    0x06, 0xAB, 0xB3, 0x58, 0xC0, 0xB4, 0xAB, 0xAF, 0xCF, 0xFC, 0xCA, 0xC8, 0x6E, 0x30, 0x81, 0x01,
-    0x03, 0x6F, 0x0A, 0x09, 0x97, 0x5A, 0x2B, 0x43, 0xD9, 0x86, 0x31, 0x03, 0xEC, 0x29, 0x96, 0x35,
-    0xE3, 0x1C, 0xE7, 0xEB, 0xF3, 0x1A, 0x63, 0x1A, 0x96, 0x40, 0xDA, 0xED, 0xED, 0x43, 0x3C, 0x70,
-    0xDC, 0xCB, 0x7A, 0xF1, 0x3E, 0x16, 0x9D, 0x12, 0x50, 0x3B, 0x18, 0x3F, 0xA8, 0x33, 0xB0, 0xA4,
-    0x3C, 0xBB, 0xE5, 0x1D, 0x4A, 0x46, 0x93, 0xC4, 0xAC, 0x7E, 0xDE, 0xF6, 0x49, 0x8E, 0x41, 0xAC,
-    0xCC, 0xBD, 0x8F, 0xFA, 0xE3, 0x1E, 0x8B, 0x96, 0x2C, 0x8A, 0x34, 0xA7, 0x50, 0x7E, 0xAB, 0x62,
-    0x55, 0x4F, 0x0D, 0xFF, 0xF7, 0xF6, 0x8F, 0x5B, 0xA5, 0x9E, 0x78, 0xC0, 0x2D, 0x6D, 0xF4, 0xFC,
-    0xD9, 0xA7, 0xC3, 0x48, 0x7D, 0xE4, 0x24, 0x1E, 0x88, 0xA0, 0x26, 0x16, 0xB8, 0xED, 0x6A, 0x4B,
-    0x6F, 0xF7, 0xA4, 0x42, 0xCF, 0xBF, 0x29, 0x06, 0x4A, 0xCB, 0x22, 0xE6, 0x08, 0xF8, 0x58, 0xF0,
-    0xEB, 0xBE, 0x11, 0x9D, 0xC8, 0x9F, 0x84, 0x91, 0x09, 0x68, 0x8A, 0x95, 0x3B, 0x2D, 0x83, 0xA1,
-    0xCE, 0x10, 0x0D, 0x60, 0x03, 0x29, 0xA6, 0x31, 0xFE, 0x18, 0xAF, 0x3D, 0x3F, 0x12, 0x2A, 0x61,
-    0x8F, 0xE8, 0x9F, 0x7B, 0xF4, 0xFF, 0x40, 0x43, 0x27, 0xBC, 0xB3, 0x74, 0x90, 0x79, 0xC0, 0xEF,
-    0x3D, 0x91, 0x20, 0x21, 0x06, 0xD9, 0x12, 0x35, 0x99, 0xB9, 0xC3, 0xC7, 0x33, 0xB2, 0x34, 0x04,
-    0x3C, 0x18, 0x70, 0x56, 0xD3, 0x40, 0x8B, 0x53, 0x64, 0x88, 0xA1, 0x3B, 0xA0, 0xEE, 0xC9, 0x70,
-    0x3B, 0x8D, 0xAE, 0xAF, 0x1E, 0x78, 0x65, 0x19, 0x7F, 0x8C, 0x85, 0xEF, 0x30, 0xFE, 0x60, 0xCF,
-    0x91, 0x82, 0xF0, 0xC5, 0x9A, 0xC3, 0xD2, 0x53, 0xB2, 0x58, 0x00, 0xC6, 0xB9, 0xF1, 0xEF, 0x90,
-    0x5B, 0x78, 0x26, 0x93, 0x10, 0x5C, 0xE1, 0xFF, 0x1A, 0xB9, 0x8F, 0x2F, 0x51, 0x1A, 0xA1, 0xA2,
-    0x37, 0xBD, 0xFF, 0x21, 0xBE, 0x84, 0xE5, 0x66, 0x04, 0xB2, 0xB5, 0x17, 0x5C, 0x06, 0x5D, 0x34,
-    0xF5, 0xD5, 0x28, 0xF5, 0x9A, 0xD8, 0x82, 0xA9, 0xBD, 0x26, 0x0F, 0x6B, 0x30, 0xC6, 0xDA, 0xCE,
-    0x41, 0x48, 0x27, 0x00, 0x78, 0xB8, 0x04, 0x94, 0x4B, 0x48, 0x04, 0xD5, 0x3F, 0x15, 0x28, 0xDA,
-    0xCC, 0x77, 0xF5, 0x0B, 0xD0, 0xB4, 0x70, 0x0C, 0xD8, 0x11, 0x1F, 0x43, 0xDC, 0x3B, 0xB7, 0x03,
-    0x46, 0x0A, 0xBE, 0x50, 0x23, 0x57, 0xC8, 0x3F, 0x36, 0x69, 0x3D, 0xDC, 0x7E, 0x5C, 0xE3, 0xF6,
-    0x7C, 0x92, 0xE2, 0xF6, 0x83, 0x9E, 0xB7, 0x48, 0x58, 0x2C, 0x95, 0xA4, 0xB8, 0x45, 0xA2, 0xE3,
-    0x36, 0x6C, 0x36, 0xB9, 0xC3, 0x05, 0xDC, 0x4A, 0xCF, 0xDB, 0xE0, 0x01, 0x6F, 0x13, 0x25, 0xA0,
-    0x8E, 0xB7, 0x41, 0xEF, 0xB3, 0x02, 0x83, 0x03, 0x8C, 0xC6, 0x51, 0xBC, 0xFD, 0x87, 0x94, 0x75,
-    0x1B, 0xE5, 0x26, 0x74, 0x05, 0x98, 0x45, 0x0B, 0x81, 0x43, 0xD8, 0xBA, 0x23, 0x0C, 0x15, 0x04,
-    0x26, 0x5B, 0x63, 0xAE, 0xDF, 0xC3, 0x0C, 0x92, 0xA1, 0xFE, 0x88, 0xBD, 0x09, 0x71, 0xCD, 0x7D,
-    0x75, 0x64, 0x41, 0x13, 0x73, 0x30, 0x62, 0xE6, 0x84, 0x35, 0x0C, 0x67, 0x5A, 0x80, 0x98, 0xDF,
-    0x1B, 0x25, 0x5F, 0x59, 0x05, 0x7A, 0x1F, 0xA8, 0xA9, 0x15, 0xBB, 0x88, 0x8A, 0xF8, 0x50, 0xCC,
-    0xCD, 0x81, 0xB9, 0x2D, 0x7D, 0xCF, 0x80, 0xC5, 0x35, 0x7F, 0xE2, 0xEA, 0x47, 0x1C, 0xDE, 0x68,
-    0x48, 0x69, 0x0C, 0xF2, 0x8B, 0x0E, 0xFD, 0xA2, 0x2B, 0x26, 0x1F, 0x1D, 0x53, 0x9F, 0x2B, 0x17,
-    0x64, 0x83, 0x5C, 0x5B, 0xE2, 0x0A, 0xBD, 0x85, 0x2A, 0xA2, 0x69, 0x55, 0x22, 0xCF, 0x89, 0xD2,
-    0x10, 0xB2, 0x51, 0x4D, 0x02, 0x5D, 0x80, 0x98, 0x9B, 0x10, 0x07, 0x4C, 0xA3, 0xAA, 0x70, 0x34,
-    0xD0, 0x09, 0x87, 0x46, 0xC3, 0x93, 0xBA, 0x74, 0xE4, 0x61, 0x19, 0x23, 0x13, 0xDF, 0x22, 0x92,
-    0x0D, 0x7C, 0xDE, 0xA2, 0xC3, 0x18, 0x65, 0x28, 0x74, 0x5A, 0xAF, 0x6E, 0x69, 0xA9, 0x52, 0x57,
-    0x16, 0x1A, 0xB8, 0x6F, 0xA7, 0x0A, 0x47, 0x2A, 0x0D, 0x54, 0x65, 0x11, 0x82, 0x30, 0x9A, 0x9D,
-    0x9A, 0x30, 0x54, 0x75, 0xF5, 0x95, 0x1F, 0xD8, 0xDC, 0x3C, 0x04, 0x1F, 0x30, 0x34, 0x97, 0x39,
-    0xEE, 0x97, 0x02, 0x9A, 0x26, 0x21, 0x19, 0x8E, 0xC8, 0x69, 0x43, 0xAE, 0x62, 0xF4, 0x59, 0x97,
-    0xC6, 0x2E, 0x4D, 0x90, 0x27, 0xB9, 0xA5, 0x2F, 0xBD, 0x2D, 0x32, 0xC4, 0xC8, 0xB5, 0xB0, 0xF6,
-    0xD1, 0x00, 0xAA, 0x9A, 0x86, 0xA0, 0x4B, 0xBB, 0x48, 0xA8, 0x0B, 0xF8, 0x39, 0x22, 0x63, 0x6E,
-    0x95, 0x52, 0xF9, 0x30, 0x91, 0x0F, 0x91, 0x82, 0xFE, 0x8C, 0xD8, 0x8F, 0x73, 0x99, 0xA3, 0xA2,
-    0x7F, 0x5C, 0xD2, 0x95, 0xC9, 0xCF, 0x51, 0x51, 0x62, 0x52, 0xCD, 0x8B, 0xCB, 0x78, 0x04, 0x46,
-    0x13, 0xAA, 0xEE, 0xE6, 0x49, 0x3A, 0x69, 0x51, 0x26, 0x3E, 0x01, 0xA5, 0x78, 0xF5, 0x5F, 0x4C,
-    0xEB, 0xE7, 0xE4, 0x16, 0x4A, 0x51, 0xBF, 0xD6, 0xCD, 0x3A, 0x35, 0x5B, 0x32, 0x76, 0x46, 0x5D,
-    0x8F, 0x2F, 0xC9, 0x42, 0xE3, 0x1D, 0x94, 0xAD, 0xE2, 0x94, 0x3D, 0xF9, 0xDA, 0xB7, 0x84, 0xF6,
-    0x5D, 0xB2, 0xD2, 0xB0, 0xF4, 0x14, 0x48, 0x00, 0xE0, 0x70, 0x77, 0x91, 0x6F, 0x34, 0x44, 0x3F,
-    0x52, 0x32, 0xAD, 0x35, 0x2B, 0x8E, 0x0F, 0x30, 0xB1, 0xEE, 0x91, 0xBB, 0xE5, 0x15, 0xB7, 0x80,
-    0x0D, 0x01, 0x93, 0x53, 0xFB, 0x45, 0x51, 0x98, 0xDC, 0x5B, 0x22, 0x6F, 0x46, 0xAA, 0x05, 0x16,
-    0x44, 0x24, 0x66, 0xE0, 0x4C, 0x44, 0x19, 0x31, 0xB8, 0xBB, 0xDF, 0x92, 0xF3, 0x4E, 0x48, 0x0C,
-    0xED, 0xFB, 0x88, 0x3D, 0xEF, 0x11, 0xBD, 0x9E, 0x30, 0x1A, 0x42, 0xF5, 0x85, 0x22, 0x4B, 0x22,
-    0xCF, 0xBC, 0x12, 0x57, 0x7B, 0xA0, 0x77, 0x0B, 0xC4, 0x2C, 0x38, 0x76, 0xD1, 0x61, 0x5B, 0xB8,
-    0xDC, 0x52, 0xE8, 0x70, 0xD9, 0x8B, 0xDA, 0x8E, 0x90, 0x8B, 0x8E, 0xB8, 0x67, 0xEF, 0x70, 0x28,
-    0x51, 0x3F, 0x76, 0x4D, 0x93, 0x3D, 0x26, 0x71, 0x22, 0x9B, 0x09, 0x7B, 0x87, 0x38, 0x85, 0x5F,
-    0x67, 0xA4, 0x0F, 0xD7, 0xA2, 0x54, 0x85, 0x6A, 0xED, 0x65, 0x86, 0xF6, 0x51, 0x63, 0xAF, 0x33,
-    0x82, 0x3F, 0xAC, 0x83, 0x8F, 0x18, 0xD4, 0x0F, 0x2A, 0xF3, 0x29, 0xE4, 0xF3, 0x1F, 0x95, 0xE6,
-    0x11, 0xE5, 0x74, 0xB9, 0xAF, 0x35, 0x01, 0xD9, 0xEE, 0x34, 0x5D, 0xB4, 0xC5, 0xD0, 0x76, 0xE8,
-    0xF0, 0x19, 0x61, 0xAD, 0xEB, 0xAC, 0x3B, 0x72, 0x9D, 0x57, 0x54, 0xE0, 0xD2, 0x10, 0xAA, 0x50,
-    0x73, 0x34, 0x44, 0xD7, 0x21, 0xD4, 0x8C, 0xAF, 0x58, 0x03, 0x57, 0x9A, 0x07, 0xAD, 0x8C, 0x1D,
-    0x93, 0x10, 0x64, 0xD0, 0x3E, 0xD0, 0x08, 0x1D, 0xB1, 0xA1, 0x47, 0xF5, 0x40, 0xA8, 0x03, 0xF4,
-    0xA7, 0x9C, 0x95, 0x70, 0xDF, 0x02, 0x0B, 0x23, 0xB6, 0x64, 0xAC, 0x51, 0xCC, 0x92, 0xB2, 0x58,
-    0x64, 0x0B, 0xD9, 0xE9, 0xE0, 0x58, 0xF4, 0xF4, 0x3D, 0x77, 0x1B, 0x68, 0x84, 0x4C, 0x5B, 0x59,
-    0x1E, 0x68, 0xD8, 0x23, 0xEA, 0xF8, 0x29, 0x15, 0x1B, 0xB5, 0x49, 0x65, 0x29, 0xFF, 0xF4, 0xCB,
-    0x3E, 0xD8, 0x62, 0xC1, 0xE5, 0xFD, 0xD2, 0x07, 0xAE, 0xC3, 0xD5, 0x4F, 0x20, 0xC9, 0x2E, 0xA0,
-    0xED, 0x5F, 0x41, 0xA2, 0xFF, 0x46, 0x5D, 0x35, 0x8C, 0x34, 0x8C, 0x08, 0x80, 0xF8, 0x61, 0x00,
-    0xD1, 0x2C, 0x1C, 0x26, 0x12, 0x20, 0xF1, 0x5E, 0x86, 0xEA, 0x9B, 0x08, 0xB8, 0xDD, 0x42, 0xB6,
-    0x49, 0x5F, 0xBA, 0x62, 0xC9, 0x5D, 0x8B, 0x4F, 0x86, 0xCE, 0xE6, 0x5F, 0xF9, 0x76, 0xFF, 0xF3,
-    0xEB, 0x6B, 0xDA, 0xC0, 0xB3, 0xC1, 0xDA, 0xD5, 0x8E, 0x1D, 0xCC, 0x94, 0xDA, 0xA1, 0x63, 0xF0,
-    0x34, 0xC0, 0xB4, 0x39, 0x6C, 0xB5, 0x6F, 0xE4, 0xD9, 0xCA, 0x6C, 0x3C, 0x38, 0x58, 0x4E, 0xCF,
-    0x57, 0xD3, 0x31, 0x69, 0x2B, 0xBB, 0xED, 0xD0, 0x8B, 0x7E, 0xE5, 0x3B, 0xBB, 0xFF, 0x1B, 0x76,
-    0x3F, 0xD4, 0x8C, 0x8C, 0x06, 0xDA, 0x3C, 0x46, 0xC8, 0xD9, 0xD4, 0xAF, 0xAF, 0xC9, 0xF9, 0xA0,
-    0xE4, 0xD9, 0x43, 0x07, 0xEE, 0x0F, 0x5E, 0x0A, 0xC2, 0x8B, 0x92, 0x71, 0x3D, 0x97, 0xBF, 0xDD,
-    0xDF, 0xDF, 0xFF, 0x0F, 0xE8, 0xF7, 0x27, 0xF4, 0x30, 0xF2, 0x0D, 0xB2, 0xBD, 0x10, 0xD0, 0x84,
-    0x34, 0xD3, 0x3E, 0x2A, 0x20, 0x7D, 0x41, 0x4D, 0xAB, 0xE2, 0x1C, 0x61, 0x29, 0xEF, 0x9C, 0x50,
-    0xB1, 0x4B, 0x25, 0x98, 0x1C, 0x70, 0xAE, 0x27, 0x9B, 0x44, 0xF7, 0x57, 0xC2, 0xE1, 0xA8, 0x4B,
-    0x83, 0x01, 0x84, 0xDC, 0x70, 0x37, 0x7A, 0x6F, 0xCB, 0xD3, 0x13, 0x2F, 0x36, 0x36, 0x92, 0xD0,
-    0x6E, 0x6C, 0x6F, 0xBC, 0x67, 0x6E, 0xB6, 0x70, 0x03, 0x9C, 0x8A, 0x0A, 0x72, 0x9E, 0x7F, 0x73,
-    0x70, 0x8E, 0xE9, 0xF0, 0x53, 0x54, 0x62, 0x4E, 0xCF, 0x03, 0x9B, 0xCF, 0xDD, 0x44, 0x79, 0x94,
-    0x92, 0xB0, 0x33, 0x58, 0x10, 0x4C, 0x9E, 0xA2, 0x0B, 0x6B, 0x01, 0x1A, 0xBA, 0x78, 0x01, 0x7F,
-    0xA3, 0xF5, 0x1C, 0x62, 0x89, 0xDE, 0xCA, 0xCD, 0xCF, 0x2A, 0xB5, 0x60, 0x2F, 0x4B, 0xBA, 0xE5,
-    0x8F, 0x47, 0x02, 0xF6, 0xB1, 0x6C, 0xC1, 0x9B, 0x0C, 0x93, 0xB1, 0xC7, 0x26, 0x87, 0xEC, 0xC7,
-    0x72, 0xFC, 0x39, 0x32, 0xB1, 0x86, 0x81, 0xC2, 0x81, 0x6F, 0x3B, 0xD2, 0x9D, 0x4C, 0x99, 0xDA,
-    0x84, 0xE8, 0x0C, 0x69, 0xB0, 0x24, 0xFB, 0x01, 0x5B, 0x12, 0x9F, 0x63, 0x0E, 0xD4, 0xB4, 0x01,
-    0xA4, 0x4F, 0xAA, 0x98, 0x95, 0xCC, 0xD5, 0xC9, 0x02, 0xCD, 0xDA, 0x45, 0x4F, 0x2D, 0x89, 0x68,
-    0xCF, 0x5C, 0x3D, 0xE5, 0x21, 0x4C, 0xF4, 0xAB, 0xD4, 0x7C, 0x56, 0x89, 0x82, 0xAD, 0x73, 0x85,
-    0xBA, 0x98, 0xA8, 0x86, 0x00, 0xB4, 0x9D, 0x77, 0x05, 0x71, 0x46, 0xE9, 0xB4, 0xC2, 0xFD, 0x93,
-    0x9E, 0x10, 0xC6, 0xBF, 0x85, 0x43, 0xBE, 0xA7, 0x5C, 0x2B, 0x57, 0xDB, 0x61, 0xBB, 0x0D, 0x37,
-    0x00, 0xFB, 0xAB, 0x6F, 0x3F, 0xBE, 0x48, 0x8B, 0x72, 0xF0, 0x4B, 0xFE, 0x78, 0x05, 0xDB, 0x9F,
-    0x7A, 0x3C, 0xEF, 0x43, 0x4D, 0x43, 0x77, 0xE9, 0xDA, 0x28, 0x8F, 0x7F, 0x10, 0x96, 0x6C, 0x79,
-    0x10, 0x7A, 0x44, 0x1E, 0xFA, 0xD1, 0xB4, 0xA8, 0x3C, 0x19, 0xAC, 0x3A, 0x61, 0x55, 0x3D, 0x31,
-    0xC9, 0x63, 0x14, 0x72, 0x56, 0x36, 0x90, 0x7D, 0x84, 0xB6, 0x64, 0x64, 0x8C, 0x37, 0xC0, 0x59,
-    0x6A, 0x16, 0xB2, 0xE4, 0x4F, 0x3B, 0x54, 0xB7, 0x96, 0xEF, 0x1E, 0xA7, 0xE3, 0x31, 0x27, 0xBB,
-    0xDC, 0x40, 0x53, 0x95, 0x76, 0x54, 0x83, 0xAE, 0xB8, 0xB8, 0xB0, 0xF7, 0x36, 0xF7, 0x90, 0x4B,
-    0xF6, 0x2E, 0x90, 0x23, 0x69, 0xA3, 0x1A, 0x9C, 0x32, 0x22, 0x8F, 0x25, 0x5D, 0x52, 0x41, 0xB4,
-    0x42, 0xDA, 0xE7, 0x0E, 0x65, 0x20, 0x36, 0x1F, 0xB9, 0x26, 0x56, 0x44, 0x48, 0x52, 0x94, 0xD9,
-    0x24, 0xF7, 0xDE, 0x3D, 0x81, 0xB2, 0x0D, 0xD4, 0xC4, 0x54, 0x41, 0xCC, 0xFB, 0xC2, 0x0F, 0xAF,
-    0xE8, 0x12, 0xA5, 0x10, 0x51, 0x19, 0xB6, 0x08, 0x8A, 0xBF, 0x5B, 0x11, 0x7C, 0xE3, 0xCA, 0xEF,
-    0x7C, 0x05, 0xD1, 0x9E, 0xC0, 0x48, 0xE8, 0xC3, 0xAB, 0xAC, 0xFA, 0x66, 0xBA, 0x0C, 0x70, 0x02,
-    0x6A, 0xB3, 0x54, 0xCE, 0x7C, 0xC1, 0x0D, 0xF0, 0x3F, 0xF1, 0x1C, 0xA9, 0x0F, 0xC0, 0xD0, 0xEB,
-    0xC6, 0x2A, 0x9F, 0xF0, 0xC4, 0x8B, 0xB1, 0x9B, 0x64, 0x64, 0x57, 0xFD, 0xC8, 0x4B, 0x60, 0x4B,
-    0x94, 0x5A, 0x80, 0x1C, 0x9C, 0xD2, 0xA3, 0x7A, 0x47, 0x2D, 0x0F, 0xDB, 0x4A, 0x0D, 0xD2, 0xAD,
-    0xB0, 0x87, 0x49, 0xED, 0x78, 0xFE, 0xB9, 0x3A, 0x08, 0x7D, 0xDE, 0x4D, 0x80, 0xBE, 0xA1, 0x57,
-    0xC6, 0xB7, 0x85, 0xC0, 0x8F, 0x91, 0x97, 0x65, 0xE0, 0x32, 0x77, 0x13, 0x83, 0x3B, 0x0B, 0x24,
-    0x75, 0xC1, 0x66, 0x3D, 0xCB, 0xB1, 0xE7, 0xDE, 0x68, 0x61, 0xA6, 0xD5, 0xC9, 0x79, 0xAA, 0xE5,
-    0x01, 0xAC, 0x9A, 0xFC, 0x2F, 0xF8, 0xD1, 0x2B, 0x10, 0xAD, 0xE0, 0xD3, 0x6E, 0x08, 0x5D, 0xA9,
-    0x7B, 0x22, 0x13, 0xAF, 0xB3, 0x5B, 0x40, 0x14, 0xAD, 0xA3, 0x75, 0x60, 0xC1, 0xD3, 0x67, 0xE7,
-    0x58, 0xC7, 0xE7, 0x31, 0x6E, 0x58, 0x61, 0x89, 0x38, 0x7D, 0xCE, 0x90, 0x2E, 0xF8, 0x0B, 0x57,
-    0x65, 0x4E, 0xA3, 0x15, 0xEC, 0x0A, 0xC1, 0x05, 0x04, 0x8A, 0x90, 0xDA, 0x06, 0xA5, 0xD8, 0xEF,
-    0xE6, 0x08, 0x22, 0x80, 0x65, 0xCF, 0xEA, 0xCF, 0x4E, 0x64, 0xAE, 0xD4, 0x14, 0x4D, 0x1C, 0xC4,
-    0x8C, 0xAB, 0xB0, 0xB6, 0x8B, 0x22, 0x67, 0xBB, 0x36, 0xA6, 0xD0, 0x9A, 0xAC, 0xB7, 0x59, 0x17,
-    0x2E, 0x50, 0x73, 0x76, 0x86, 0x0D, 0x16, 0x9C, 0x42, 0x49, 0x03, 0x8F, 0x95, 0xA0, 0xC0, 0x54,
-    0x4F, 0x89, 0xD1, 0x2B, 0x70, 0x80, 0xF5, 0x8E, 0xE4, 0xF4, 0x10, 0xD9, 0x5E, 0x2C, 0xDB, 0xDB,
-    0xE1, 0xF3, 0xFD, 0x46, 0xF0, 0x90, 0x59, 0xD4, 0xC8, 0xFA, 0xFE, 0xBF, 0xCB, 0x98, 0x53, 0x31,
-    0x18, 0x22, 0x9A, 0x46, 0x44, 0x23, 0x4F, 0x7A, 0x4D, 0xC3, 0xF2, 0x0E, 0x65, 0x12, 0x9F, 0xD8,
-    0xD5, 0x8F, 0xA4, 0x4E, 0x11, 0x83, 0x47, 0x35, 0x25, 0xDA, 0x8C, 0xC6, 0xB6, 0x11, 0xF9, 0x50,
-    0x01, 0xE0, 0x79, 0xEB, 0x8B, 0x7A, 0x1A, 0x16, 0x58, 0xC6, 0xE9, 0x37, 0x79, 0xA6, 0xE4, 0xF9,
-    0x7D, 0xF4, 0xC8, 0xC5, 0xFD, 0xCE, 0xDD, 0xFF, 0xD4, 0x63, 0x40, 0xCD, 0x6B, 0xAC, 0xEF, 0x29,
-    0x2D, 0x7A, 0xEA, 0x0B, 0x0A, 0x2D, 0x8F, 0x7E, 0xE5, 0x45, 0x84, 0x66, 0x67, 0xEF, 0xF4, 0xB1,
-    0xCC, 0x26, 0x24, 0x12, 0x67, 0xE2, 0x5A, 0x2C, 0x6D, 0x89, 0x4E, 0xA7, 0x43, 0x4C, 0x9C, 0x93,
-    0x3D, 0x74, 0x0D, 0x13, 0x99, 0x25, 0x77, 0xDA, 0x18, 0xF8, 0x0B, 0xB6, 0xF4, 0x2E, 0x8B, 0xCF,
-    0xF8, 0xDE, 0x60, 0xCB, 0xD4, 0xFD, 0xF8, 0xE1, 0xD6, 0x6A, 0xE4, 0xD9, 0x37, 0x0F, 0x12, 0x94,
-    0xBB, 0x9E, 0x40, 0x15, 0xD3, 0x3E, 0x04, 0xAE, 0x4A, 0x51, 0xAF, 0xA3, 0x79, 0x26, 0xE9, 0x99,
-    0x02, 0xAF, 0x3C, 0x76, 0x45, 0x41, 0x0D, 0xB2, 0x15, 0x3D, 0x3B, 0xD4, 0x73, 0x88, 0xC6, 0xB6,
-    0x3C, 0xD4, 0x8A, 0xDC, 0x67, 0x6C, 0x7A, 0x7F, 0x34, 0xC8, 0x5A, 0xFA, 0x02, 0xE0, 0xD2, 0xB0,
-    0xD9, 0x8E, 0x3B, 0x54, 0xE7, 0x09, 0x9E, 0x22, 0x50, 0x61, 0x0D, 0x64, 0x1F, 0x0C, 0x89, 0x40,
-    0x0F, 0x79, 0x8C, 0x3E, 0x05, 0x70, 0x9A, 0x86, 0x28, 0x77, 0x09, 0xDB, 0x1F, 0xD7, 0x4B, 0x42,
-    0xC6, 0x7E, 0xD3, 0x6F, 0xC7, 0xAC, 0x06, 0xEC, 0xBE, 0x67, 0x80, 0x16, 0x95, 0x4D, 0xE3, 0xDE,
-    0x56, 0xBA, 0xF5, 0x14, 0xCC, 0x1E, 0x34, 0x90, 0xCC, 0x1A, 0xF9, 0x92, 0x66, 0x35, 0x45, 0x0A,
-    0x0F, 0x84, 0x60, 0x7E, 0xAF, 0x05, 0xE8, 0xCD, 0x22, 0xFB, 0x53, 0xF0, 0xEF, 0x0F, 0xAB, 0xD9,
-    0x26, 0x56, 0xDB, 0x0C, 0xFE, 0x80, 0x62, 0xFC, 0x28, 0x9F, 0x90, 0x7B, 0xB5, 0x9A, 0xF0, 0x8E,
-    0xE7, 0x6D, 0x54, 0x61, 0xD5, 0x54, 0x26, 0xC8, 0xAA, 0x5F, 0xB8, 0x37, 0x10, 0xB6, 0x50, 0x30,
-    0xA0, 0xFF, 0xA7, 0xA8, 0xF3, 0x21, 0x8F, 0xD1, 0x88, 0x86, 0xE4, 0x18, 0x6C, 0x7B, 0xCD, 0x27,
-    0x90, 0x18, 0x1D, 0x9D, 0xA9, 0x61, 0xA0, 0xC6, 0xB4, 0x21, 0x9C, 0xF5, 0xB1, 0xFB, 0xC0, 0x75,
-    0xCF, 0xD7, 0x57, 0x4E, 0xF5, 0x9D, 0x7C, 0x89, 0xBE, 0x27, 0x80, 0x83, 0x40, 0xD0, 0x03, 0x62,
-    0xB2, 0xBD, 0x50, 0xFB, 0x23, 0xCC, 0xF7, 0xFF, 0xAC, 0x1C, 0xCF, 0x5D, 0x46, 0x6F, 0x16, 0xA5,
-    0xF1, 0xE5, 0x2A, 0x68, 0x5E, 0xD6, 0xCA, 0x98, 0xB2, 0x32, 0xF2, 0x78, 0x24, 0xD3, 0xA8, 0x83,
-    0x4B, 0xEB, 0x43, 0xF9, 0x3E, 0xDC, 0xF2, 0x29, 0x66, 0xC6, 0x63, 0xAB, 0xA5, 0x07, 0x55, 0x59,
-    0x9D, 0x50, 0x31, 0xA6, 0x29, 0xFF, 0x43, 0x62, 0x4E, 0xA0, 0x06, 0xD9, 0x56, 0xFB, 0x2C, 0x7A,
-    0x4B, 0xF0, 0xB1, 0x27, 0xFF, 0xAB, 0x01, 0x66, 0xD0, 0x3C, 0x76, 0x90, 0x9F, 0xA0, 0xAD, 0x7D,
-    0xDE, 0xEB, 0x45, 0x6C, 0x7B, 0xCB, 0xE8, 0xE9, 0x08, 0xE0, 0x24, 0x35, 0x5C, 0x7F, 0xB5, 0x0C,
-    0xE3, 0x03, 0x6B, 0x17, 0x64, 0x93, 0xA7, 0x7B, 0x42, 0xC1, 0x16, 0xBC, 0x28, 0xE2, 0x41, 0xAE,
-    0xF6, 0x79, 0xD4, 0x35, 0xFD, 0x56, 0xE2, 0x2E, 0xDC, 0xFE, 0xD0, 0xF5, 0xEF, 0x90, 0x71, 0x78,
-    0xE9, 0xFF, 0x03, 0xCD, 0x59, 0x3D, 0x8C, 0xDD, 0xD6, 0x95, 0x3E, 0xE4, 0xD5, 0x0C, 0x13, 0x5D,
-    0x44, 0x57, 0xC5, 0x68, 0xD7, 0x96, 0x14, 0xD1, 0x85, 0x8B, 0x45, 0x60, 0x8B, 0x4D, 0x0A, 0x17,
-    0x6F, 0x86, 0x8C, 0x54, 0xA4, 0x48, 0xE1, 0x09, 0x56, 0x4A, 0x16, 0x50, 0x61, 0xB7, 0x9B, 0x05,
-    0x22, 0x17, 0x2E, 0x54, 0x8C, 0x44, 0x3A, 0x46, 0xA0, 0x62, 0x81, 0xD5, 0x34, 0xD9, 0x66, 0x0B,
-    0x6F, 0x91, 0x4A, 0xC1, 0xC6, 0x2E, 0x54, 0xA8, 0x78, 0x1A, 0x72, 0xA4, 0x22, 0x45, 0x0A, 0x13,
-    0xAB, 0x20, 0x2E, 0x5C, 0x98, 0x5E, 0x39, 0x08, 0x60, 0x03, 0x2B, 0x4A, 0xA2, 0x62, 0x8E, 0x86,
-    0xE4, 0xCD, 0xF7, 0x5D, 0xBE, 0x37, 0xA3, 0x99, 0xC4, 0x1B, 0x6F, 0x2C, 0xAD, 0xF6, 0x01, 0x24,
-    0x2F, 0x7F, 0xEE, 0xBD, 0xE7, 0x9E, 0x7B, 0xCE, 0x77, 0xBE, 0x73, 0xDE, 0x01, 0xF3, 0x41, 0xD3,
-    0x1D, 0x10, 0x91, 0x89, 0x51, 0x45, 0xBD, 0x6C, 0x4E, 0x97, 0xCD, 0x72, 0x78, 0xF9, 0xE3, 0x76,
-    0x23, 0xBA, 0x72, 0xBB, 0x14, 0xFE, 0x54, 0x26, 0x72, 0x02, 0xD7, 0x0B, 0x22, 0x1E, 0x9E, 0x04,
-    0x89, 0x48, 0xBA, 0x2E, 0x91, 0x6D, 0xD4, 0xA3, 0x0F, 0xEB, 0x28, 0xD0, 0x45, 0x73, 0xFC, 0x84,
-    0x2E, 0xDE, 0x93, 0xD8, 0x2F, 0xA4, 0xD3, 0xA2, 0xEA, 0x97, 0xC4, 0xCC, 0x6E, 0x6F, 0x18, 0xF1,
-    0xBA, 0x89, 0xA8, 0xE1, 0xDE, 0x9A, 0xB2, 0xB6, 0xF6, 0x6D, 0x8F, 0x79, 0x30, 0x54, 0x35, 0x8E,
-    0x7A, 0x08, 0xCD, 0x57, 0xC6, 0x5B, 0x4F, 0x66, 0xBF, 0xBC, 0x12, 0x65, 0x3B, 0xD1, 0xE5, 0x86,
-    0x84, 0x49, 0x2C, 0x91, 0xBC, 0x2C, 0x2B, 0x72, 0x00, 0x87, 0xC8, 0xC5, 0xF1, 0x38, 0x3A, 0xFC,
-    0xA2, 0x88, 0xAC, 0xCD, 0xA4, 0xC3, 0x7D, 0x3B, 0x1E, 0x5E, 0x23, 0xE2, 0xD7, 0x18, 0x15, 0x43,
-    0x05, 0x95, 0xFC, 0x43, 0x6A, 0x6D, 0x17, 0xE7, 0xB6, 0x7B, 0x4E, 0x16, 0x56, 0x0F, 0x8B, 0x1C,
-    0xB8, 0xE0, 0x25, 0x2F, 0x9F, 0x8C, 0xFA, 0xEB, 0x7A, 0xC8, 0x2B, 0x55, 0xE9, 0x42, 0x15, 0xAA,
-    0x0C, 0x0A, 0x55, 0x05, 0xE3, 0xB5, 0x74, 0xE7, 0xAD, 0xF3, 0x65, 0x98, 0x0F, 0xCD, 0xDA, 0xE2,
-    0xFA, 0xF2, 0x0B, 0x22, 0x5F, 0x4B, 0x07, 0x89, 0xDA, 0xB4, 0x97, 0xB8, 0xD5, 0xB5, 0x04, 0xA5,
-    0x6A, 0xC4, 0x64, 0x5E, 0x27, 0xA1, 0xC8, 0x0D, 0x8A, 0x13, 0xCB, 0x9A, 0x48, 0x94, 0x61, 0xE2,
-    0xD7, 0x36, 0x1F, 0x26, 0x9E, 0xBD, 0x63, 0x13, 0xF9, 0xE1, 0xF6, 0xCF, 0x20, 0x8F, 0xE5, 0x61,
-    0x71, 0xCE, 0xED, 0x30, 0x13, 0x7B, 0xDF, 0x49, 0x5B, 0x74, 0x8B, 0x78, 0x9A, 0xEC, 0xFC, 0xDC,
-    0xEA, 0xFF, 0x6E, 0xE7, 0x76, 0x49, 0xA2, 0x0A, 0x03, 0xC8, 0x54, 0x97, 0x6B, 0x52, 0xC7, 0xB2,
-    0x14, 0x96, 0xA2, 0x7B, 0xF1, 0x3F, 0x6A, 0xA4, 0xCE, 0xB3, 0x97, 0x83, 0x2E, 0x28, 0xC2, 0xA2,
-    0x93, 0xD6, 0x54, 0x46, 0xEC, 0xA9, 0x52, 0xB7, 0x6F, 0x4A, 0xF4, 0x1F, 0xE2, 0xD9, 0xEF, 0x48,
-    0x78, 0xAB, 0x50, 0x1F, 0x37, 0x7E, 0x9D, 0xFE, 0x6B, 0xAD, 0x6D, 0x25, 0x47, 0x13, 0xF9, 0xBA,
-    0xAC, 0xF6, 0xE6, 0x4E, 0x13, 0xFF, 0x73, 0x06, 0x91, 0x8F, 0x60, 0xFF, 0x24, 0xC5, 0x0B, 0x89,
-    0xD7, 0xCF, 0x55, 0x58, 0x93, 0xE8, 0x4C, 0x61, 0x5F, 0x4F, 0xCA, 0x35, 0x6F, 0x23, 0xB9, 0x86,
-    0xD1, 0x5A, 0x75, 0xB3, 0x5C, 0x56, 0xD9, 0x4B, 0x93, 0x20, 0xFB, 0xB6, 0x77, 0xA7, 0xB8, 0x86,
-    0x8D, 0x7A, 0xC5, 0xA0, 0xD3, 0x83, 0x0C, 0x1A, 0x36, 0x13, 0x83, 0x01, 0xEE, 0x14, 0x53, 0x18,
-    0xC5, 0xCB, 0xEA, 0x93, 0xE7, 0xFC, 0xA2, 0x0A, 0x6D, 0x31, 0xD1, 0xC9, 0xD1, 0x75, 0x9D, 0x2C,
-    0x63, 0x17, 0x2A, 0xC1, 0xB2, 0xA6, 0xA2, 0xB6, 0xBC, 0x0D, 0xEC, 0x85, 0xD3, 0x80, 0x77, 0x16,
-    0xA7, 0x55, 0x68, 0xD3, 0xAF, 0x6B, 0x7D, 0xBA, 0x14, 0x93, 0x44, 0xBD, 0xDF, 0x34, 0x46, 0x95,
-    0x2B, 0x61, 0x99, 0x7E, 0x54, 0x2C, 0xD1, 0xFE, 0x22, 0x5B, 0x51, 0x67, 0x2F, 0xCA, 0xAA, 0x2A,
-    0x75, 0x76, 0x49, 0xBA, 0xA0, 0x0A, 0x8B, 0xDC, 0xEB, 0x54, 0xA3, 0x2B, 0x8D, 0xA6, 0x2E, 0xC3,
-    0x8C, 0x47, 0x50, 0x98, 0x44, 0x25, 0x07, 0xA9, 0xAD, 0xD8, 0xDA, 0xF7, 0x61, 0x56, 0xCE, 0xA6,
-    0x20, 0xA0, 0x2A, 0x44, 0x70, 0x23, 0x3F, 0xBA, 0x9A, 0xDA, 0xCF, 0xA0, 0x5C, 0x6F, 0x55, 0x24,
-    0xB4, 0x25, 0x56, 0x76, 0x12, 0x56, 0xE4, 0x95, 0xDF, 0x88, 0x9B, 0x97, 0xB4, 0xBA, 0xA2, 0xDE,
-    0xCE, 0xFE, 0xAB, 0x78, 0xAF, 0x5C, 0xAE, 0x5E, 0xFA, 0xB6, 0xA9, 0xF5, 0x21, 0xF5, 0x2F, 0xFE,
-    0xAD, 0xE2, 0xE3, 0xAA, 0x7A, 0x63, 0xF8, 0xE6, 0x9B, 0x86, 0xF6, 0xD8, 0x60, 0x63, 0xF5, 0xA7,
-    0x30, 0xAA, 0xA3, 0xEB, 0x18, 0xEA, 0x8A, 0xED, 0xAF, 0x5E, 0xCD, 0xB8, 0x67, 0xBD, 0xD8, 0x5E,
-    0x67, 0xD3, 0x89, 0x34, 0xB5, 0xBA, 0x5D, 0x1A, 0x5D, 0x4C, 0x8D, 0x2D, 0x74, 0xEB, 0xF6, 0x6D,
-    0x8F, 0x00, 0x13, 0xF9, 0xD6, 0xBB, 0xE8, 0x67, 0xEB, 0xB3, 0x0F, 0xCF, 0xEC, 0x7D, 0xB3, 0x34,
-    0x33, 0x72, 0x38, 0x43, 0x47, 0x0B, 0x81, 0x8A, 0x62, 0x7B, 0xAA, 0x49, 0x4D, 0x32, 0x3D, 0x0E,
-    0xF3, 0x85, 0x66, 0x3B, 0xF8, 0x0E, 0x4F, 0x19, 0xAC, 0xDA, 0xD8, 0x21, 0xA6, 0x8D, 0x88, 0x6E,
-    0x42, 0xFB, 0xFE, 0x5B, 0x0F, 0xB3, 0x65, 0xB8, 0x43, 0x2A, 0xB6, 0xFC, 0x56, 0x8F, 0x0F, 0x54,
-    0xE5, 0x3D, 0x3C, 0xD7, 0xDA, 0xE6, 0xE0, 0x3A, 0x9C, 0x67, 0xD9, 0xFC, 0x67, 0x1B, 0xEB, 0xEC,
-    0xF0, 0x38, 0x7A, 0x05, 0x23, 0xDB, 0x80, 0x0B, 0xE9, 0x12, 0x1B, 0x71, 0x43, 0x74, 0xB1, 0xBF,
-    0x61, 0xD8, 0xE8, 0xC6, 0x46, 0xE5, 0xF5, 0x92, 0xC3, 0xD8, 0x74, 0xA7, 0xEF, 0x26, 0xB9, 0x6D,
-    0xED, 0x87, 0xEF, 0x0C, 0xBA, 0x9B, 0x1E, 0x91, 0x25, 0x0D, 0xA1, 0xF1, 0x39, 0xE6, 0x67, 0x03,
-    0xAE, 0x4B, 0xD9, 0x44, 0x7E, 0x3E, 0x77, 0x55, 0x2F, 0xB7, 0x55, 0x6C, 0x07, 0x65, 0x1F, 0xC0,
-    0x1F, 0xAF, 0x88, 0x1D, 0x26, 0x81, 0x6D, 0xEB, 0xD0, 0xDE, 0x29, 0xD2, 0xF1, 0x56, 0xE1, 0x56,
-    0xE1, 0x36, 0xC0, 0xAD, 0xFF, 0xDF, 0xD0, 0xC4, 0x2B, 0x35, 0x4D, 0x47, 0xD4, 0x15, 0x98, 0xD4,
-    0x9F, 0xB9, 0x2D, 0x47, 0x64, 0x48, 0xDC, 0xE8, 0xE1, 0xE9, 0x2E, 0xDE, 0x6C, 0x9E, 0xD7, 0xDD,
-    0xB1, 0x62, 0xCD, 0x5C, 0xAE, 0x5E, 0x14, 0x79, 0x7D, 0xB1, 0x0B, 0x2C, 0x84, 0xF1, 0x6A, 0xEC,
-    0x50, 0x28, 0xC1, 0xBC, 0x71, 0xEC, 0x93, 0xD8, 0xB2, 0xCF, 0x92, 0x84, 0x83, 0x6C, 0x6D, 0x98,
-    0x6C, 0x6D, 0xBE, 0x47, 0xAF, 0x66, 0x6B, 0xD1, 0xE5, 0x2A, 0x1A, 0x64, 0x91, 0xEF, 0x8D, 0xAD,
-    0x52, 0x2B, 0x2F, 0xC8, 0xBA, 0x34, 0xB0, 0xD2, 0x56, 0xD5, 0x1E, 0x8F, 0x4E, 0xD5, 0x34, 0xB1,
-    0xA8, 0x48, 0xBF, 0x03, 0x5B, 0x33, 0x45, 0x2C, 0x30, 0x53, 0x95, 0x1C, 0x92, 0xC7, 0x7F, 0x90,
-    0xC9, 0x7B, 0x0F, 0xE6, 0x5C, 0x48, 0x44, 0x1F, 0x48, 0x24, 0xAD, 0xE9, 0x31, 0xE2, 0x8D, 0xC6,
-    0xC7, 0xCB, 0xF5, 0xF1, 0x52, 0xBB, 0x8B, 0x5F, 0xBA, 0x8B, 0x2A, 0xFC, 0x0A, 0x17, 0x2D, 0x9A,
-    0x97, 0x13, 0x12, 0xF2, 0x32, 0x91, 0xB8, 0x3A, 0x36, 0x00, 0x4E, 0x1F, 0x41, 0x7B, 0x49, 0xED,
-    0xDF, 0xC7, 0x9A, 0xFD, 0x32, 0xB8, 0xC9, 0xA5, 0x17, 0xE6, 0x54, 0xC5, 0xF1, 0xE3, 0x5F, 0x6C,
-    0x41, 0x03, 0xF0, 0x09, 0xCB, 0xF1, 0x17, 0x7E, 0xF8, 0x3B, 0x37, 0x3E, 0xA4, 0xE6, 0xF8, 0xB8,
-    0xB0, 0x45, 0xF3, 0xCE, 0x64, 0xEF, 0x6F, 0x51, 0x9C, 0x9C, 0x10, 0x30, 0x1A, 0x05, 0x4C, 0xFF,
-    0x92, 0x80, 0xEE, 0xA2, 0x93, 0xB4, 0xA4, 0x80, 0xD8, 0x30, 0x0A, 0xA8, 0x8B, 0x0E, 0x97, 0x0B,
-    0x3A, 0x5B, 0x83, 0x9C, 0xB5, 0x9F, 0x4C, 0x61, 0xA4, 0xA5, 0xC3, 0x59, 0x7C, 0xAF, 0x30, 0x80,
-    0x4E, 0x9C, 0x4D, 0x84, 0x44, 0x41, 0x11, 0x78, 0x7D, 0xE7, 0xE2, 0x03, 0x5F, 0x61, 0x7C, 0x03,
-    0xA9, 0x21, 0x60, 0x00, 0xB4, 0xE7, 0xF8, 0xB4, 0x94, 0x64, 0x9F, 0x9C, 0x52, 0x02, 0xAA, 0x20,
-    0xFC, 0x9A, 0xF8, 0x00, 0x7B, 0x8E, 0xD0, 0x40, 0x66, 0xC8, 0x7B, 0x00, 0x3D, 0x88, 0x35, 0x18,
-    0x4A, 0xE3, 0xFD, 0xB1, 0xCA, 0x0D, 0x61, 0x06, 0x27, 0xB0, 0x7F, 0xAE, 0x14, 0x6E, 0x39, 0x24,
-    0x79, 0x0F, 0x8E, 0x00, 0x14, 0xBE, 0x20, 0x31, 0xB6, 0x84, 0x2A, 0xAD, 0x8F, 0xDA, 0xE4, 0x84,
-    0x44, 0x6B, 0xC6, 0x26, 0x46, 0xC2, 0x50, 0xCE, 0x40, 0x48, 0xF3, 0xDD, 0xC2, 0xE9, 0xF4, 0x2D,
-    0x46, 0x86, 0x32, 0xF8, 0x74, 0x23, 0xC3, 0x62, 0x3D, 0x87, 0x18, 0xB5, 0x1C, 0x39, 0xF7, 0x9B,
-    0x1D, 0x9D, 0x10, 0x7C, 0xD7, 0x9C, 0xBE, 0x64, 0x01, 0xD3, 0x8C, 0x22, 0xA2, 0xB5, 0x21, 0x0A,
-    0xBE, 0x58, 0xB1, 0x39, 0xAE, 0xC3, 0x89, 0x13, 0x89, 0xEE, 0x7C, 0x5B, 0xC3, 0xAC, 0x7A, 0x5A,
-    0x44, 0xE8, 0xFA, 0x77, 0x88, 0x74, 0x3E, 0x02, 0x9C, 0x6F, 0x1B, 0x2F, 0x77, 0xDB, 0x32, 0x86,
-    0xB4, 0xEB, 0x3C, 0x99, 0xC6, 0xC1, 0x55, 0xC5, 0x73, 0xEA, 0x54, 0xB2, 0xB4, 0xAB, 0x0A, 0xE7,
-    0xB4, 0x21, 0xBB, 0xA8, 0xCE, 0x7D, 0xC0, 0xB0, 0xAB, 0x89, 0x9B, 0xF2, 0x80, 0x0A, 0x8D, 0xA2,
-    0x84, 0xE2, 0xF3, 0xDD, 0x1A, 0x1D, 0xD0, 0x64, 0x1B, 0x54, 0x33, 0x95, 0x1D, 0x49, 0x9C, 0x88,
-    0x7A, 0xF8, 0x83, 0x96, 0x88, 0x6E, 0xA1, 0xB9, 0x4F, 0xAF, 0xF6, 0x8C, 0x85, 0x41, 0x8D, 0x57,
-    0xD8, 0x1B, 0x20, 0x81, 0x6A, 0xE9, 0xC2, 0x61, 0x71, 0x7E, 0x0B, 0x58, 0xF8, 0xBE, 0x2D, 0x19,
-    0x5C, 0x67, 0x73, 0x12, 0xC8, 0xC5, 0x01, 0x98, 0x62, 0xC8, 0x92, 0x81, 0xF7, 0x5F, 0x97, 0x67,
-    0x2A, 0xD9, 0x01, 0xE7, 0x6D, 0x4E, 0x5D, 0x96, 0xB3, 0xC5, 0x9C, 0x42, 0x33, 0xDA, 0xC0, 0x10,
-    0x8B, 0x67, 0xAA, 0x33, 0x37, 0xCF, 0xE9, 0x8C, 0xD6, 0x48, 0x71, 0xFE, 0x80, 0xBE, 0x72, 0x28,
-    0xA8, 0xF7, 0x19, 0xF6, 0xFF, 0xBD, 0x64, 0x0B, 0x9C, 0xD3, 0xEB, 0x38, 0x58, 0xB4, 0x09, 0x94,
-    0xF6, 0x5A, 0x53, 0xEC, 0x95, 0xC9, 0x59, 0xA2, 0xE7, 0x22, 0x55, 0xCC, 0x57, 0x41, 0x3F, 0x63,
-    0x5A, 0x98, 0x9E, 0x0E, 0xEC, 0xDF, 0xA7, 0xC2, 0x97, 0xD9, 0x2D, 0x28, 0x1C, 0xAB, 0xD2, 0x44,
-    0x21, 0x3A, 0x37, 0xA0, 0x10, 0xEF, 0xE2, 0xB3, 0xE7, 0x33, 0xF8, 0x33, 0xD5, 0x30, 0x5C, 0x7D,
-    0xB7, 0x04, 0x33, 0x83, 0xFB, 0x21, 0x60, 0x41, 0x6A, 0x32, 0xA1, 0x0C, 0x60, 0xE0, 0x75, 0x8B,
-    0x76, 0xDD, 0x43, 0x58, 0x03, 0x61, 0xA2, 0x66, 0x9E, 0x77, 0x16, 0xC6, 0xC1, 0xD4, 0x6F, 0x2B,
-    0x47, 0x2F, 0xD9, 0x2C, 0xA8, 0x82, 0x95, 0x1F, 0x53, 0x1C, 0x7E, 0xE4, 0x30, 0xEC, 0xD9, 0xC8,
-    0x37, 0xFB, 0x01, 0x61, 0x79, 0x17, 0x39, 0xBE, 0x26, 0x2B, 0x2D, 0x61, 0xC0, 0xFF, 0x7D, 0x45,
-    0x94, 0x34, 0x61, 0x46, 0x8B, 0xBB, 0x7E, 0x89, 0xDF, 0x05, 0x9B, 0x4E, 0xBC, 0x95, 0x80, 0x42,
-    0x79, 0x75, 0xF8, 0xD3, 0x33, 0xF4, 0x9F, 0x94, 0xE1, 0x79, 0xEA, 0x71, 0x08, 0xF5, 0xBB, 0x73,
-    0xD5, 0x48, 0x49, 0xB0, 0xF7, 0xDE, 0xA3, 0xAB, 0xDC, 0x71, 0xF0, 0xC5, 0x16, 0x0E, 0x35, 0x25,
-    0x25, 0x9D, 0x60, 0xF7, 0x30, 0x60, 0x8D, 0x9D, 0xDC, 0xF0, 0x5E, 0xBB, 0x6C, 0xB3, 0xD0, 0x32,
-    0xBC, 0x27, 0xD6, 0xC1, 0xD1, 0xD9, 0x04, 0x40, 0x68, 0x13, 0x6D, 0x6D, 0xA9, 0x1B, 0xAF, 0xC1,
-    0xF7, 0xCB, 0x90, 0xDD, 0x9C, 0x6A, 0xC4, 0x77, 0x0B, 0x8E, 0x67, 0x46, 0xC5, 0x75, 0xFB, 0x94,
-    0x84, 0x46, 0x13, 0x51, 0x1F, 0xF5, 0x2C, 0x34, 0x53, 0x71, 0x4E, 0x6F, 0xF9, 0xD6, 0x0F, 0xAE,
-    0x39, 0x55, 0x44, 0xB6, 0x1D, 0xD9, 0x1E, 0x83, 0x9F, 0x73, 0xF3, 0x74, 0x16, 0xCB, 0xB9, 0x08,
-    0x8E, 0x84, 0x48, 0x48, 0x5E, 0x26, 0x8E, 0x5D, 0x1B, 0x06, 0x06, 0x0A, 0x1F, 0xB4, 0x23, 0xF8,
-    0xED, 0x30, 0x72, 0x6B, 0x7B, 0x08, 0x6B, 0xC1, 0xC6, 0x55, 0x89, 0x3D, 0xB8, 0x06, 0xC9, 0x8E,
-    0xCB, 0x5C, 0x2A, 0x6E, 0x8A, 0xAA, 0xCF, 0xAE, 0x0A, 0xA7, 0x8C, 0xA1, 0xDD, 0xF1, 0x81, 0xC8,
-    0xFC, 0x8B, 0xD7, 0xF1, 0x60, 0xC2, 0xC5, 0xE0, 0xC1, 0xB9, 0x9B, 0x18, 0xE7, 0x01, 0x8E, 0x76,
-    0xDC, 0x74, 0xA0, 0x27, 0xC8, 0x0D, 0x96, 0x86, 0x7B, 0x53, 0xED, 0x20, 0xEF, 0xD3, 0x9C, 0x16,
-    0xBA, 0xF0, 0xFA, 0x19, 0xBA, 0x74, 0xF8, 0x96, 0x7E, 0x73, 0x41, 0xFE, 0xFD, 0x29, 0x4F, 0xBB,
-    0xCA, 0x60, 0x82, 0xBD, 0x8A, 0x6F, 0x76, 0x48, 0x25, 0x56, 0xF6, 0x78, 0x27, 0x36, 0xDE, 0x36,
-    0x70, 0xF8, 0x9E, 0xBC, 0x0F, 0xD3, 0xFA, 0x9C, 0xF6, 0x8D, 0xC7, 0x07, 0x15, 0xB3, 0x79, 0x36,
-    0x61, 0x02, 0x85, 0x69, 0x9B, 0xC7, 0xE4, 0x70, 0x5F, 0x78, 0x19, 0x1E, 0xD4, 0xE3, 0xB4, 0xDE,
-    0x79, 0x58, 0x10, 0x39, 0xB1, 0xAD, 0x0E, 0x33, 0x4C, 0x35, 0x62, 0xB3, 0xC5, 0x6E, 0xB6, 0x99,
-    0xD6, 0xBE, 0x63, 0xF1, 0xAD, 0x29, 0xD0, 0x11, 0xC2, 0x7F, 0x61, 0xC3, 0xB7, 0x9F, 0x83, 0xB5,
-    0x7B, 0x8C, 0x98, 0xAD, 0xE9, 0xCC, 0x27, 0x7E, 0xF2, 0x57, 0x74, 0x5F, 0x22, 0x88, 0xC7, 0xAD,
-    0x7F, 0xBF, 0x8D, 0x40, 0xFA, 0xBD, 0xD1, 0xE1, 0x62, 0x10, 0xB0, 0x81, 0xB2, 0xC7, 0x14, 0x9C,
-    0x5A, 0xFA, 0x4B, 0xCD, 0xBC, 0x37, 0xB6, 0x5D, 0x92, 0xEF, 0x77, 0xE6, 0xC3, 0x3A, 0x7D, 0x35,
-    0x9B, 0xC3, 0x30, 0x28, 0x46, 0x1B, 0xDA, 0xEC, 0xCB, 0x8C, 0x30, 0x6F, 0x46, 0xF6, 0x34, 0x73,
-    0x91, 0x85, 0xB3, 0xCC, 0xBE, 0xB8, 0x3E, 0xA4, 0x08, 0x2D, 0x3E, 0x20, 0x0E, 0x75, 0xB4, 0xF9,
-    0x98, 0xFE, 0x81, 0xAF, 0x4D, 0x85, 0x5E, 0xC8, 0xF3, 0x3A, 0xAA, 0x1E, 0x0F, 0xCD, 0x6D, 0x68,
-    0x53, 0x35, 0xDC, 0xC5, 0x7E, 0xF7, 0x61, 0x81, 0x2F, 0x03, 0x7E, 0x89, 0x65, 0x76, 0x74, 0x49,
-    0xEC, 0x1B, 0xB9, 0xFB, 0x31, 0xCE, 0x84, 0x4F, 0x81, 0x03, 0xEB, 0x7B, 0x41, 0x78, 0x7F, 0xE8,
-    0x38, 0xF8, 0x27, 0xA1, 0x83, 0xD6, 0x47, 0xF6, 0xC4, 0xD7, 0x79, 0xAB, 0x06, 0x71, 0xBC, 0x06,
-    0xA0, 0xA9, 0xF0, 0x60, 0x22, 0xCB, 0x1B, 0x6C, 0xDE, 0x6E, 0xD8, 0x0C, 0x5D, 0x06, 0xBB, 0xC1,
-    0xA6, 0x6A, 0xD8, 0x0C, 0x0B, 0x34, 0x25, 0x67, 0x53, 0x35, 0x6C, 0x1A, 0x64, 0x81, 0xA5, 0xA4,
-    0x6C, 0xA2, 0x3B, 0x9A, 0xC0, 0xE2, 0x65, 0xB2, 0x8F, 0x08, 0xE4, 0xAC, 0x33, 0xB6, 0x1E, 0xC9,
-    0xBC, 0x8B, 0x1D, 0xCE, 0x0A, 0x1D, 0x39, 0x71, 0x3C, 0x3A, 0x74, 0x50, 0x97, 0x3A, 0x12, 0xB3,
-    0xBA, 0x13, 0x43, 0xFE, 0x91, 0x6F, 0x98, 0xC0, 0x47, 0x03, 0x3A, 0xC7, 0xA5, 0x6F, 0x09, 0x40,
-    0x21, 0x32, 0x33, 0x8C, 0x47, 0x34, 0x89, 0xDF, 0x26, 0x33, 0xBC, 0xD7, 0x31, 0x18, 0xA5, 0x2E,
-    0x74, 0x73, 0xC1, 0xBF, 0x26, 0xAD, 0xBD, 0xCF, 0x8D, 0x73, 0x0F, 0xD3, 0x90, 0x68, 0xFB, 0x36,
-    0xFD, 0xBD, 0xCC, 0xF1, 0x79, 0x0D, 0xD8, 0x09, 0xB0, 0x09, 0x09, 0x6C, 0x35, 0xA4, 0x75, 0xC3,
-    0x01, 0xAB, 0x59, 0xC6, 0x38, 0x8F, 0xA6, 0x2E, 0x6D, 0xCE, 0x29, 0x19, 0xE1, 0x49, 0x5C, 0x2C,
-    0x7D, 0x51, 0x9E, 0xA9, 0x60, 0x8E, 0xA6, 0x18, 0x86, 0x76, 0xE3, 0xF2, 0xA2, 0xF7, 0x4B, 0xDA,
-    0xC4, 0x94, 0x65, 0x8D, 0x83, 0xCF, 0x56, 0x63, 0xDC, 0xCA, 0x9E, 0xC9, 0x8B, 0xFD, 0x10, 0xFD,
-    0x2E, 0x32, 0x88, 0x7E, 0x43, 0xEF, 0xB5, 0xB4, 0x67, 0x21, 0x98, 0x23, 0x29, 0xBA, 0x8E, 0x49,
-    0x8B, 0x42, 0x28, 0xEB, 0x92, 0xDA, 0x2B, 0xD3, 0xC2, 0xCF, 0x5D, 0x55, 0x82, 0x9D, 0xB6, 0x61,
-    0xED, 0x18, 0xA4, 0x43, 0x56, 0x0A, 0x23, 0x4C, 0xD9, 0x8D, 0xD3, 0x0F, 0x8E, 0xE0, 0xFC, 0x0A,
-    0xDD, 0x82, 0x7B, 0x4E, 0x86, 0x8D, 0x5D, 0xC1, 0xC8, 0xEF, 0x77, 0xA5, 0xDD, 0x60, 0x28, 0x89,
-    0x4F, 0x75, 0x8C, 0x90, 0x08, 0x8B, 0x61, 0x81, 0xB8, 0x18, 0x95, 0xE4, 0x54, 0x25, 0xC1, 0x16,
-    0x3D, 0x16, 0xCE, 0xCC, 0xB2, 0xF6, 0x49, 0x2C, 0x53, 0x73, 0xB3, 0x56, 0x9F, 0x15, 0xAC, 0xDA,
-    0x6C, 0xE0, 0x75, 0xA6, 0x6F, 0x55, 0x91, 0xB4, 0x6B, 0xB2, 0x7C, 0x98, 0xBB, 0xFC, 0x37, 0xEB,
-    0x88, 0x18, 0x90, 0xEB, 0x04, 0x75, 0xB5, 0x5D, 0x80, 0xC8, 0xE7, 0x35, 0x1C, 0xDD, 0x1B, 0x18,
-    0x4C, 0xA3, 0x1A, 0xCA, 0xD2, 0x16, 0xB0, 0xE4, 0xDF, 0xEF, 0xA0, 0x8D, 0x69, 0xB8, 0x09, 0xF7,
-    0xF7, 0xBA, 0x08, 0x84, 0xC3, 0xDC, 0x44, 0x1A, 0x29, 0x5D, 0x04, 0xA3, 0x30, 0x9B, 0x5D, 0x04,
-    0xD1, 0x42, 0x6C, 0x48, 0x94, 0x59, 0x42, 0x06, 0x16, 0x87, 0xD5, 0x39, 0xD9, 0x34, 0xF5, 0xE5,
-    0x7F, 0x4E, 0xF8, 0x9F, 0x68, 0x57, 0x2D, 0x19, 0x85, 0x73, 0xA0, 0x1B, 0x8D, 0xDB, 0xE9, 0x8C,
-    0xCD, 0x39, 0xE5, 0xB1, 0x5A, 0xF6, 0x06, 0x67, 0xA7, 0xB5, 0xC2, 0x20, 0xCC, 0x54, 0xC4, 0x8C,
-    0x86, 0xDE, 0x02, 0x16, 0xE9, 0xCA, 0x55, 0xFF, 0xCB, 0x26, 0x88, 0x69, 0x50, 0xF8, 0xAE, 0x78,
-    0x83, 0xB5, 0x40, 0xDB, 0x3D, 0x71, 0x4D, 0xB7, 0x5E, 0xEE, 0x68, 0x4D, 0x31, 0xDB, 0xCF, 0xB1,
-    0x80, 0x34, 0x67, 0xEA, 0x74, 0x01, 0xDF, 0x79, 0xA4, 0x23, 0x55, 0x31, 0x41, 0xCF, 0x4F, 0xFE,
-    0x1F, 0xC8, 0x37, 0xA6, 0x9C, 0x4E, 0x75, 0x31, 0x55, 0xA7, 0x7F, 0xCD, 0x04, 0x92, 0xF4, 0x0B,
-    0xDB, 0xFE, 0xC6, 0x33, 0x97, 0xCF, 0x4B, 0xB8, 0x89, 0x29, 0x7B, 0xEA, 0x3A, 0x4D, 0xFE, 0xD4,
-    0x21, 0x1C, 0xE9, 0x04, 0xC9, 0xB0, 0x36, 0x1E, 0x68, 0x63, 0x7F, 0xA5, 0x50, 0xAE, 0x49, 0xA1,
-    0xD6, 0x28, 0x9F, 0x2E, 0x3C, 0x52, 0x1E, 0x22, 0x17, 0x1C, 0x27, 0xCF, 0x60, 0x4E, 0xCA, 0xB1,
-    0xE6, 0xD1, 0xF2, 0xBC, 0xD1, 0x2D, 0x92, 0x79, 0x38, 0x08, 0x29, 0x52, 0x5E, 0xCE, 0x4C, 0x70,
-    0x6F, 0x12, 0x9F, 0xDB, 0x22, 0x1F, 0x10, 0xCD, 0xCF, 0x53, 0x69, 0xBA, 0xF0, 0x5D, 0xCD, 0xAA,
-    0xA7, 0xC5, 0xA6, 0x8C, 0x33, 0x51, 0x32, 0x25, 0x6D, 0x21, 0x8C, 0xDC, 0x21, 0x6C, 0x7C, 0xCE,
-    0x42, 0x83, 0x8B, 0x2E, 0x2E, 0xD5, 0xBC, 0xF4, 0x3F, 0x9D, 0x34, 0x79, 0x5A, 0x34, 0xCB, 0xB9,
-    0x72, 0x74, 0x42, 0xB6, 0xE3, 0xD8, 0x8E, 0xBA, 0xE7, 0x4A, 0x67, 0x99, 0x7A, 0x94, 0x23, 0x61,
-    0x52, 0x1D, 0x9E, 0xF5, 0x38, 0x2E, 0x3D, 0x76, 0xDC, 0x18, 0x2B, 0x3A, 0xBA, 0xC6, 0x77, 0x88,
-    0x9B, 0x5B, 0x63, 0x3F, 0x26, 0x57, 0x03, 0x29, 0x0C, 0x05, 0xF8, 0x11, 0x0B, 0xD8, 0x68, 0x85,
-    0x9F, 0x21, 0x7D, 0xAF, 0x82, 0x19, 0x77, 0x01, 0x99, 0x40, 0xAA, 0xB5, 0x42, 0xD6, 0x54, 0xF8,
-    0x4C, 0xC7, 0x22, 0xA4, 0xEE, 0x7E, 0x8D, 0xAC, 0x25, 0xC2, 0x73, 0xBF, 0x0E, 0x99, 0xF7, 0xDB,
-    0x04, 0xAF, 0x06, 0x34, 0x0C, 0x9D, 0x3B, 0x2A, 0x49, 0xE6, 0x99, 0x66, 0x54, 0xD1, 0x21, 0x59,
-    0x01, 0xCF, 0x09, 0x36, 0xAD, 0xF9, 0xB4, 0x8D, 0xEB, 0x94, 0xFA, 0x3A, 0xE3, 0x1C, 0x21, 0xE4,
-    0x1A, 0x66, 0x51, 0xAB, 0x9F, 0xD5, 0xD3, 0x5E, 0xD8, 0x29, 0x30, 0x04, 0x80, 0x24, 0x9B, 0x17,
-    0xA6, 0x8C, 0x40, 0xAD, 0x56, 0xE4, 0x4D, 0x12, 0x0C, 0x4A, 0xFB, 0x5A, 0x01, 0xA0, 0x92, 0xF4,
-    0x51, 0x87, 0xE8, 0x5E, 0x47, 0x89, 0x29, 0x6E, 0x48, 0x8C, 0x75, 0xF5, 0xCA, 0x0E, 0xF6, 0x96,
-    0xBD, 0xD5, 0x79, 0xAB, 0xDE, 0xB8, 0x51, 0x64, 0xD0, 0xF1, 0x98, 0x13, 0x30, 0x3F, 0x68, 0x77,
-    0xB7, 0xE9, 0x2B, 0x8F, 0x3E, 0xF2, 0x4F, 0x42, 0x15, 0xD2, 0x22, 0x75, 0xAF, 0x11, 0x30, 0x39,
-    0x24, 0xE1, 0xD9, 0x93, 0x1A, 0x3D, 0x2C, 0x2B, 0xB1, 0x1F, 0x14, 0xEA, 0x57, 0x76, 0x0F, 0x17,
-    0x82, 0xFC, 0x1E, 0x59, 0xEE, 0x5D, 0x57, 0x96, 0x03, 0xD1, 0xCA, 0xBE, 0xE9, 0x28, 0x2F, 0x46,
-    0xFF, 0xDB, 0x9A, 0x66, 0x17, 0x0E, 0x39, 0x99, 0x98, 0x2E, 0xC7, 0xD1, 0x53, 0x61, 0x12, 0x95,
-    0xD7, 0xB6, 0xB6, 0x50, 0x79, 0xB2, 0x08, 0x6A, 0x90, 0xD2, 0x08, 0xC2, 0xD2, 0x2F, 0x4F, 0xEE,
-    0xDA, 0x2B, 0x88, 0x0C, 0x76, 0xC5, 0x6C, 0x77, 0xD2, 0xFB, 0x2D, 0x8C, 0xA7, 0x0A, 0x12, 0x33,
-    0xEA, 0x6E, 0x81, 0x94, 0xAD, 0x0E, 0xEC, 0xBB, 0x45, 0x9C, 0xC4, 0x70, 0x15, 0x37, 0x72, 0x58,
-    0xC4, 0x65, 0x6C, 0xEF, 0x76, 0x71, 0x17, 0x17, 0x47, 0x18, 0xBB, 0x7E, 0x0C, 0x47, 0x82, 0xD1,
-    0x4C, 0xB0, 0x9F, 0xF5, 0xC4, 0x25, 0xB2, 0xE6, 0xDF, 0x32, 0x87, 0xCA, 0x0B, 0x4F, 0x40, 0x1D,
-    0x0B, 0x5C, 0x76, 0x38, 0x28, 0x5B, 0x9A, 0xED, 0x2D, 0x6B, 0x4F, 0x37, 0xBA, 0xF7, 0x3A, 0x30,
-    0xCD, 0xCC, 0x6C, 0x96, 0xB4, 0x6A, 0x08, 0xEA, 0xBD, 0x56, 0xCA, 0x3F, 0x59, 0x16, 0x98, 0xEC,
-    0xA3, 0x9F, 0x79, 0xC3, 0xDF, 0xD7, 0x33, 0x2A, 0xAA, 0x9D, 0x7B, 0xDF, 0x60, 0x04, 0x0F, 0x6A,
-    0x44, 0x93, 0xE7, 0x62, 0x10, 0x70, 0x5B, 0xD8, 0x06, 0x1C, 0x0F, 0xE9, 0xF5, 0xC2, 0xAA, 0x53,
-    0x29, 0xCC, 0x3F, 0xB6, 0x08, 0xBF, 0x7D, 0x24, 0xE1, 0xAB, 0x99, 0xBA, 0x5C, 0xBA, 0xBF, 0x4B,
-    0x1C, 0x9D, 0xC5, 0x08, 0xE4, 0xAE, 0x24, 0x7C, 0x66, 0x4B, 0x56, 0xC1, 0x5E, 0xE9, 0x80, 0xE8,
-    0x87, 0x6E, 0xAA, 0x67, 0xB5, 0x81, 0xEB, 0x60, 0xCD, 0xB0, 0x71, 0x6A, 0x1C, 0xCD, 0x8C, 0xC0,
-    0x52, 0xBB, 0x94, 0x92, 0xFF, 0xB9, 0x1C, 0x9E, 0x1B, 0x05, 0x10, 0x21, 0xB5, 0xD5, 0x25, 0xE9,
-    0x63, 0x09, 0xDF, 0x49, 0xD4, 0x76, 0x29, 0x83, 0x75, 0xBF, 0xDC, 0xA5, 0x9E, 0x1C, 0x22, 0x65,
-    0x30, 0xF3, 0xD6, 0xC1, 0x10, 0x38, 0x8F, 0x43, 0xC3, 0xC3, 0x2E, 0x05, 0x1D, 0x51, 0x13, 0xD8,
-    0x44, 0xA3, 0xCE, 0xBE, 0xDA, 0x88, 0x2E, 0xC9, 0x85, 0xAB, 0xFA, 0xDB, 0xA5, 0xD7, 0xF0, 0x6F,
-    0x92, 0xE4, 0x82, 0x94, 0x5F, 0x61, 0x44, 0x2F, 0x59, 0x52, 0x6D, 0x54, 0x0C, 0xBA, 0x0E, 0xA5,
-    0xD9, 0xB5, 0xA9, 0xC0, 0x56, 0x81, 0x1D, 0x82, 0xCA, 0xDC, 0xAE, 0xBD, 0x2D, 0x18, 0xED, 0x0D,
-    0x31, 0x77, 0xDD, 0x50, 0xDB, 0xB5, 0x73, 0xF5, 0x68, 0xD4, 0x92, 0xCD, 0x9E, 0x37, 0x00, 0x9F,
-    0xDC, 0x66, 0x80, 0xD8, 0x25, 0x46, 0xCD, 0x94, 0x2A, 0x07, 0x7B, 0x08, 0x93, 0x19, 0x1A, 0x78,
-    0x79, 0x92, 0x36, 0x92, 0x26, 0x00, 0x9B, 0xF0, 0xCF, 0x9E, 0x8E, 0xD9, 0xB7, 0x5D, 0xB1, 0x07,
-    0xD3, 0x47, 0x89, 0x43, 0xAD, 0x93, 0x73, 0x2D, 0x7D, 0xC9, 0xBE, 0x14, 0x27, 0x40, 0x44, 0xA9,
-    0x23, 0x73, 0xB9, 0x5C, 0xBB, 0xE6, 0x65, 0x5F, 0xBE, 0xEF, 0x9E, 0x7F, 0x90, 0xE6, 0xD5, 0xFF,
-    0x24, 0x04, 0x80, 0x36, 0x88, 0x2F, 0x5C, 0xC5, 0x45, 0x57, 0xA9, 0xDA, 0xD7, 0x5C, 0xE4, 0x1F,
-    0x04, 0x2E, 0xCD, 0xF0, 0x91, 0x9F, 0x98, 0x0F, 0x4A, 0x07, 0x27, 0x61, 0x25, 0xFE, 0xE7, 0x95,
-    0x9C, 0xC0, 0x27, 0xAE, 0x1C, 0x61, 0xE0, 0x21, 0x57, 0x12, 0x84, 0x48, 0xD5, 0x04, 0x60, 0x4A,
-    0xAA, 0x41, 0xD4, 0xFC, 0x3D, 0x12, 0x96, 0xBB, 0xB0, 0x32, 0x7C, 0x0E, 0x30, 0xE0, 0x1E, 0x99,
-    0x77, 0x0B, 0xB9, 0x18, 0x27, 0xAA, 0xCE, 0x93, 0x28, 0xB1, 0x77, 0x5B, 0x17, 0x19, 0x8E, 0xCC,
-    0x63, 0x52, 0xFC, 0x16, 0x36, 0xCE, 0x7E, 0x84, 0x10, 0x77, 0x05, 0x26, 0x7B, 0xDC, 0x55, 0x37,
-    0x1E, 0x77, 0x7E, 0x5D, 0xE7, 0xAD, 0x67, 0x3F, 0x62, 0x71, 0xB6, 0x45, 0x58, 0x63, 0xA6, 0xE7,
-    0x39, 0x45, 0x96, 0x70, 0x9D, 0x30, 0xC1, 0x9E, 0x5F, 0x84, 0x1F, 0x7C, 0xD1, 0xA3, 0xF3, 0xF0,
-    0xBA, 0x3B, 0xB6, 0x09, 0xB1, 0x96, 0x55, 0x19, 0x4B, 0xE8, 0xDD, 0x2C, 0x94, 0x91, 0x80, 0xD2,
-    0x5E, 0xE7, 0xA5, 0x78, 0xC2, 0x6F, 0x3E, 0x30, 0x4C, 0x01, 0x0A, 0x42, 0x78, 0x9C, 0x6A, 0x56,
-    0x00, 0xCF, 0xF0, 0xE0, 0x6E, 0x3A, 0xAB, 0x38, 0x40, 0xC0, 0x8E, 0xF7, 0xB9, 0x78, 0x2D, 0x17,
-    0x14, 0x95, 0xC0, 0xB9, 0x21, 0xCF, 0xDC, 0xDF, 0xA3, 0x73, 0x7F, 0x60, 0x10, 0x65, 0xC0, 0x20,
-    0xB2, 0xBB, 0x92, 0x7B, 0xB6, 0xFB, 0x27, 0xE9, 0x13, 0x99, 0x43, 0x9C, 0xE3, 0xBB, 0x18, 0xBF,
-    0x82, 0x1E, 0xD3, 0x4B, 0x2C, 0x6B, 0x89, 0x5F, 0x1E, 0x7C, 0xA2, 0x73, 0x78, 0x83, 0xC6, 0x18,
-    0xEF, 0x88, 0xFA, 0xC0, 0x8A, 0x57, 0xF4, 0xF2, 0x38, 0xCC, 0x7F, 0xD5, 0xF1, 0xBD, 0xF5, 0x05,
-    0xA8, 0x26, 0x4E, 0x82, 0x26, 0x4E, 0xFC, 0xEA, 0xE4, 0x13, 0x1D, 0x9B, 0xF4, 0x16, 0x01, 0x15,
-    0x99, 0x93, 0xD7, 0xEC, 0xD4, 0x1C, 0x58, 0xCC, 0x99, 0x97, 0x20, 0x10, 0x07, 0x09, 0x9A, 0x48,
-    0x42, 0x0E, 0xCE, 0xC2, 0x8B, 0xB6, 0x1F, 0x83, 0x48, 0xDA, 0xDA, 0x14, 0x21, 0x0E, 0xBF, 0x57,
-    0x95, 0x6F, 0x7F, 0xD2, 0xF8, 0x0F, 0xEA, 0xA9, 0x5F, 0x77, 0xB1, 0x5F, 0xC7, 0x48, 0x34, 0xCC,
-    0xCD, 0x3F, 0x80, 0x5B, 0x20, 0xCB, 0x6F, 0x91, 0x2C, 0x4D, 0x55, 0x07, 0xFA, 0x60, 0x1F, 0x0D,
-    0x72, 0x9F, 0xB3, 0x12, 0xA9, 0xE5, 0x6B, 0x32, 0xFB, 0x53, 0xDB, 0xD5, 0xC0, 0x5D, 0xE2, 0xE6,
-    0x62, 0x23, 0x41, 0x76, 0x4F, 0x79, 0x4C, 0xF2, 0x42, 0x03, 0xA8, 0x25, 0xAF, 0x16, 0x5B, 0x18,
-    0x21, 0xDE, 0x5F, 0x1A, 0xEB, 0x8D, 0x2B, 0x44, 0xBE, 0x16, 0xC2, 0xEF, 0x7B, 0xD4, 0xF1, 0x51,
-    0x0D, 0x81, 0x4D, 0x85, 0x04, 0x3F, 0xB4, 0xDB, 0x36, 0x09, 0xED, 0xF7, 0x7A, 0x59, 0x48, 0x0E,
-    0xCC, 0x4B, 0xB0, 0xAC, 0x4B, 0xB9, 0xEA, 0xA2, 0x2B, 0x0D, 0x74, 0xB3, 0x02, 0xDD, 0x28, 0xD3,
-    0xD3, 0x99, 0x76, 0x06, 0xD4, 0xF0, 0x5F, 0xB2, 0x4C, 0x42, 0x45, 0xF8, 0x2A, 0x4E, 0x80, 0x6B,
-    0x09, 0xB2, 0xE3, 0x4F, 0x6B, 0xDA, 0x25, 0x46, 0xB6, 0x16, 0x9E, 0x6B, 0x2A, 0xB8, 0x70, 0xB8,
-    0xB3, 0xC3, 0xF3, 0x1F, 0x73, 0xCF, 0x2C, 0xAF, 0x35, 0xD8, 0x6D, 0xE6, 0x7F, 0xF1, 0x1C, 0xBB,
-    0x8F, 0x0A, 0x8F, 0x05, 0x20, 0x80, 0xCE, 0xE0, 0x01, 0xE2, 0x11, 0x48, 0x1A, 0x50, 0x18, 0x10,
-    0xE7, 0x33, 0x8E, 0x4B, 0x3B, 0xFD, 0xD6, 0xB3, 0x52, 0x1E, 0x91, 0xC9, 0x95, 0xBA, 0x97, 0xF7,
-    0x51, 0x6A, 0x84, 0x92, 0xB8, 0x4B, 0x01, 0x34, 0x59, 0x8F, 0xDD, 0xC6, 0xF0, 0x53, 0x47, 0x4B,
-    0xFD, 0xC6, 0x63, 0xA9, 0x06, 0x4C, 0x73, 0x8A, 0xB0, 0xA1, 0x2A, 0x18, 0x70, 0x0C, 0xED, 0x78,
-    0x0F, 0x59, 0xA1, 0xFE, 0xA5, 0xD3, 0x8C, 0xF0, 0x6F, 0x81, 0x31, 0x59, 0x74, 0x49, 0x04, 0xEB,
-    0x25, 0xCC, 0xCD, 0x69, 0x3D, 0x79, 0x4F, 0xC3, 0xC4, 0x34, 0x27, 0xE7, 0xE5, 0x1C, 0x22, 0x70,
-    0x60, 0x67, 0x9B, 0x4C, 0x12, 0xE0, 0x28, 0x69, 0xE4, 0x4A, 0xC3, 0x4B, 0xE2, 0xDF, 0x43, 0x82,
-    0xBA, 0x01, 0xC2, 0x12, 0x35, 0xCC, 0x6E, 0xBD, 0x9E, 0x3C, 0x37, 0x63, 0x05, 0x9B, 0x29, 0x2C,
-    0xD0, 0x1A, 0x86, 0x8C, 0x65, 0xE3, 0x01, 0xC8, 0xAF, 0x5F, 0x23, 0xA1, 0x68, 0x21, 0x21, 0xF4,
-    0x35, 0x2B, 0x38, 0xEB, 0xFD, 0x83, 0x9A, 0x4F, 0xC4, 0x15, 0xDC, 0x0F, 0x5E, 0x65, 0x8D, 0xF5,
-    0xF5, 0x45, 0xD0, 0x9C, 0x02, 0xF9, 0x32, 0xD3, 0x65, 0x93, 0x5C, 0xDF, 0x9F, 0xEF, 0x3C, 0x7D,
-    0x15, 0xFC, 0x11, 0xC5, 0x5B, 0x3D, 0x90, 0xDD, 0x54, 0x96, 0x3E, 0x92, 0xEC, 0xD6, 0x0E, 0xDA,
-    0x45, 0x0E, 0x6C, 0x98, 0xC1, 0xC3, 0x68, 0x02, 0x02, 0xD7, 0x14, 0x58, 0x13, 0x10, 0x10, 0xB8,
-    0x5B, 0x62, 0xBC, 0x55, 0x1B, 0x6C, 0x40, 0x07, 0xEE, 0xD9, 0xAA, 0x99, 0x00, 0x82, 0x49, 0x66,
-    0x36, 0x68, 0x02, 0x02, 0x07, 0xDD, 0x96, 0x28, 0x07, 0x13, 0x4C, 0x80, 0x93, 0x49, 0x76, 0x03,
-    0xD8, 0xAA, 0xAD, 0x5A, 0xE8, 0xAD, 0x1A, 0x26, 0x20, 0x70, 0x6D, 0x75, 0xB7, 0x04, 0x0E, 0x26,
-    0x70, 0x80, 0xC0, 0x01, 0x01, 0x01, 0x62, 0x31, 0x45, 0xED, 0x12, 0x58, 0x83, 0xE5, 0x45, 0xB6,
-    0x25, 0xDD, 0xFD, 0xBE, 0x23, 0xE9, 0xF5, 0xEB, 0xB6, 0x31, 0x8D, 0xF1, 0x4F, 0x57, 0x5B, 0xBE,
-    0x4F, 0x4F, 0xBA, 0xF7, 0xFC, 0xDD, 0x73, 0xBE, 0x73, 0xCE, 0x6D, 0xF1, 0x4C, 0x2B, 0x22, 0xC6,
-    0xE4, 0x22, 0x8F, 0x6C, 0xFC, 0xBB, 0xEC, 0xFE, 0x39, 0xC4, 0x4B, 0x90, 0xE2, 0xE2, 0xF0, 0x29,
-    0x49, 0x0A, 0x5C, 0xBC, 0x9E, 0xC3, 0xAB, 0x15, 0x2E, 0x61, 0x18, 0xE3, 0xAB, 0x82, 0xDF, 0xAD,
-    0xF9, 0x98, 0xC1, 0x4F, 0xB7, 0x31, 0xAC, 0x1C, 0x7C, 0x17, 0x4A, 0x14, 0x8B, 0x73, 0xED, 0x97,
-    0x0D, 0xDE, 0xE2, 0xEC, 0xFE, 0xFF, 0x6E, 0x74, 0x62, 0xD5, 0xE2, 0x56, 0xF8, 0x4A, 0x22, 0x71,
-    0x4A, 0x71, 0x1A, 0xD9, 0xC4, 0xF4, 0xF9, 0xEA, 0x75, 0x09, 0xCC, 0xFB, 0xA6, 0x70, 0x4C, 0xFB,
-    0xC8, 0xC6, 0x9B, 0x12, 0x99, 0x4A, 0x36, 0x36, 0xE2, 0x19, 0x11, 0x87, 0xF1, 0x8C, 0x89, 0x9D,
-    0xDE, 0x60, 0xC6, 0x6D, 0x69, 0xA5, 0xB1, 0x0A, 0x2E, 0x80, 0xF5, 0xAC, 0x44, 0x40, 0xBE, 0x65,
-    0xBE, 0xAC, 0xFC, 0xC2, 0xCF, 0xB7, 0x24, 0xB2, 0x6B, 0x69, 0xDD, 0xCA, 0xAF, 0x7D, 0x73, 0xD3,
-    0xF8, 0xC6, 0xAF, 0x0E, 0xC6, 0x07, 0xA6, 0x59, 0x4A, 0xC9, 0xC9, 0xCA, 0x9A, 0x32, 0x8B, 0xC9,
-    0x6D, 0x43, 0x5E, 0xAC, 0xE5, 0x87, 0xC8, 0x2C, 0x67, 0x3E, 0x21, 0x2F, 0x4B, 0xE3, 0xE6, 0xB6,
-    0xE9, 0x06, 0x8A, 0x4E, 0x0D, 0xB4, 0x58, 0xB1, 0x58, 0xA6, 0x96, 0xE8, 0x4A, 0xE5, 0xD4, 0x5E,
-    0xE9, 0xE7, 0x7E, 0xFA, 0x24, 0xA6, 0x11, 0x70, 0x2F, 0x8F, 0x57, 0x92, 0x99, 0x3C, 0xE8, 0x33,
-    0xE9, 0xA4, 0xF5, 0x20, 0x8A, 0x30, 0xF6, 0xF3, 0x44, 0x4C, 0x6C, 0x4C, 0x56, 0x99, 0xCA, 0x60,
-    0x0A, 0xD0, 0x69, 0xE9, 0x2C, 0x0D, 0xAF, 0x11, 0x68, 0x15, 0xB7, 0xE3, 0x30, 0x2B, 0x71, 0xF1,
-    0x39, 0x91, 0xFD, 0x55, 0x8D, 0xEB, 0x22, 0xF9, 0x70, 0x73, 0x52, 0xD2, 0x78, 0xF8, 0xCE, 0xE7,
-    0x22, 0x36, 0xD6, 0xC4, 0x5B, 0x2B, 0xAB, 0xA9, 0xB8, 0x86, 0x54, 0xF6, 0x1B, 0x6F, 0x17, 0x12,
-    0xC4, 0x92, 0xE0, 0x2B, 0x01, 0xBB, 0x4B, 0xF8, 0x36, 0xF5, 0x20, 0xFE, 0x76, 0xC1, 0x9C, 0xB3,
-    0x4C, 0x0B, 0xDA, 0x23, 0xDA, 0x0F, 0x9F, 0x81, 0xC4, 0x38, 0x12, 0x5D, 0xD9, 0xD7, 0xA1, 0xA1,
-    0xF0, 0xEC, 0x7E, 0x94, 0xF2, 0x41, 0x2C, 0x08, 0x46, 0x4D, 0x96, 0xFB, 0x45, 0x98, 0x46, 0x98,
-    0xEC, 0x15, 0x72, 0x45, 0x29, 0xBE, 0x08, 0x31, 0x18, 0x49, 0x6E, 0xB4, 0x4E, 0x3D, 0x70, 0x05,
-    0x8D, 0x5A, 0xAD, 0xD3, 0x39, 0xA6, 0x37, 0x17, 0xCC, 0x85, 0xD6, 0x5A, 0xF6, 0xA0, 0x9D, 0xF3,
-    0x54, 0xC2, 0x30, 0x77, 0x84, 0x55, 0xC2, 0x62, 0x9C, 0x98, 0x6B, 0x43, 0xC2, 0x96, 0xA1, 0x6E,
-    0x63, 0xB1, 0xC9, 0xF0, 0xA4, 0x5D, 0x6B, 0x05, 0x74, 0x81, 0xCC, 0x10, 0xAA, 0x0F, 0x0B, 0xB7,
-    0x80, 0x96, 0x6B, 0x4C, 0xB0, 0xE8, 0x15, 0xE2, 0x71, 0x65, 0x52, 0x20, 0x67, 0xA8, 0x63, 0x2C,
-    0x40, 0x41, 0xD8, 0xA4, 0x3F, 0x23, 0x4B, 0x58, 0x86, 0xE2, 0x10, 0xC3, 0x0F, 0x35, 0xE7, 0xFE,
-    0xFC, 0x57, 0x45, 0x60, 0x0C, 0xB5, 0x80, 0x07, 0x57, 0x46, 0xCB, 0x09, 0xF5, 0x51, 0x1F, 0xF3,
-    0x15, 0x4A, 0x5E, 0x3A, 0xA9, 0x31, 0xEC, 0x69, 0xD0, 0x91, 0x74, 0xA1, 0x04, 0x2F, 0xA4, 0xCE,
-    0xEF, 0x0B, 0x0A, 0x91, 0xEB, 0x41, 0xD2, 0x78, 0xD6, 0xC6, 0x28, 0x49, 0xC5, 0xBF, 0x2E, 0xCB,
-    0xC6, 0x34, 0x9E, 0x69, 0xE4, 0xE0, 0xF2, 0x60, 0xF3, 0x4A, 0x4B, 0x88, 0xAF, 0x83, 0x17, 0x73,
-    0x09, 0x9E, 0xAF, 0xC5, 0x8B, 0xFF, 0xEE, 0x81, 0x70, 0xA3, 0xCA, 0x70, 0x7A, 0xB1, 0x6E, 0x16,
-    0x52, 0x6F, 0x4A, 0xE3, 0xA7, 0xCF, 0x49, 0xF1, 0xBD, 0xB8, 0xE1, 0x0F, 0x37, 0x8F, 0x8F, 0x25,
-    0x9C, 0x66, 0xD0, 0xD3, 0xEC, 0xE7, 0xFE, 0x72, 0xE3, 0xC5, 0xE2, 0x55, 0x4A, 0xD7, 0xE2, 0x9C,
-    0x43, 0xB1, 0x4D, 0xE9, 0x18, 0xE3, 0x54, 0xFE, 0x87, 0x95, 0x55, 0x37, 0xF2, 0xDC, 0xBA, 0x2A,
-    0x10, 0xAB, 0x72, 0xC1, 0x2D, 0x7C, 0xC8, 0xC5, 0xC5, 0x2A, 0xE6, 0xDC, 0x41, 0xDF, 0x98, 0x34,
-    0x33, 0x29, 0xE7, 0xFA, 0xA9, 0x3C, 0x05, 0x0B, 0x3F, 0x83, 0x25, 0x41, 0x4D, 0x84, 0xBD, 0xEF,
-    0xD0, 0xA6, 0x8F, 0x3F, 0x08, 0x36, 0x2C, 0x39, 0x60, 0x97, 0x7E, 0xBA, 0xE8, 0xE5, 0xDE, 0x47,
-    0xB9, 0x64, 0x85, 0x4A, 0xF2, 0x8D, 0xEF, 0x65, 0x62, 0xA9, 0x9C, 0x13, 0xAB, 0x72, 0x31, 0x4F,
-    0x47, 0x9F, 0x47, 0x7E, 0xC4, 0x27, 0x49, 0x76, 0x39, 0xC9, 0xE9, 0x08, 0x9C, 0x51, 0x66, 0x40,
-    0x42, 0x72, 0xC3, 0xF4, 0x10, 0x8D, 0x65, 0x72, 0x70, 0x12, 0x94, 0xB8, 0xB8, 0x74, 0x7B, 0x4E,
-    0x83, 0x0B, 0x36, 0x28, 0x17, 0xE3, 0xA5, 0xDB, 0x7D, 0x99, 0x7D, 0x61, 0xF1, 0x39, 0xEE, 0x69,
-    0xF0, 0x8D, 0x4B, 0x88, 0x59, 0x16, 0x0C, 0x05, 0xD5, 0xC0, 0x15, 0xF7, 0x3B, 0x8E, 0x7E, 0x19,
-    0xFB, 0x28, 0xA9, 0x4E, 0x60, 0xD1, 0x6A, 0x8D, 0x46, 0xA8, 0x17, 0x6E, 0xF7, 0xEA, 0xCF, 0xC3,
-    0xC5, 0x3A, 0x59, 0x91, 0xA2, 0x8A, 0x7E, 0xA9, 0xC2, 0x66, 0xA3, 0x7B, 0x8D, 0xD5, 0x21, 0xE1,
-    0xB2, 0xCE, 0xCB, 0x16, 0x2F, 0x2D, 0x2F, 0xDD, 0xEC, 0xE3, 0x36, 0x2F, 0x09, 0x7D, 0x71, 0x54,
-    0x84, 0x78, 0xCD, 0x40, 0xA5, 0x8E, 0xF9, 0x14, 0x4A, 0x3D, 0x42, 0xA7, 0x71, 0x50, 0x15, 0x07,
-    0x06, 0x11, 0x47, 0x40, 0x91, 0xB2, 0x89, 0x29, 0xA0, 0x7F, 0x88, 0x2F, 0xA1, 0x51, 0xF8, 0xA5,
-    0xF2, 0x39, 0x48, 0x14, 0x37, 0xFD, 0x4B, 0x10, 0x8A, 0x53, 0x93, 0xFE, 0x6E, 0xE7, 0x66, 0x8E,
-    0x27, 0xDD, 0x52, 0x39, 0xC5, 0x4D, 0x9B, 0xAF, 0x43, 0xF2, 0x7E, 0x7E, 0xB4, 0x1D, 0x58, 0x8D,
-    0x8C, 0x39, 0xB7, 0x63, 0xF5, 0xD0, 0x40, 0xD0, 0x72, 0xE1, 0xD1, 0x4D, 0x82, 0x3A, 0x08, 0xA3,
-    0x90, 0x27, 0xB2, 0x37, 0xF4, 0xC6, 0x13, 0xFF, 0x01, 0x9A, 0xE1, 0x7C, 0xB3, 0x7F, 0x31, 0xB0,
-    0x1A, 0x3F, 0x47, 0x0C, 0xA9, 0xA0, 0x27, 0x38, 0x7C, 0x44, 0x39, 0x30, 0x91, 0x93, 0x49, 0xEC,
-    0xA9, 0x16, 0xA6, 0x04, 0x27, 0x09, 0x23, 0x22, 0x73, 0x90, 0x8B, 0x29, 0xA3, 0x3E, 0x68, 0xE4,
-    0x94, 0xC5, 0xF9, 0x52, 0xCC, 0x51, 0xCA, 0x13, 0x1B, 0x6F, 0xEC, 0x8A, 0xEA, 0xE0, 0xD6, 0x7C,
-    0x80, 0x7F, 0xD4, 0xC8, 0x22, 0x68, 0xF5, 0xE2, 0x48, 0x2C, 0x92, 0x2F, 0x33, 0x43, 0x8D, 0x20,
-    0x15, 0x08, 0x2A, 0x77, 0x48, 0x93, 0xDE, 0x18, 0xE9, 0xC4, 0x13, 0x0B, 0x14, 0x30, 0x08, 0x92,
-    0xCA, 0xCF, 0x0F, 0x6E, 0x82, 0x37, 0x13, 0x51, 0xA4, 0xF6, 0xC6, 0x5B, 0x70, 0xDF, 0xE9, 0xEF,
-    0x36, 0x52, 0x99, 0xC5, 0xB0, 0xC0, 0xA4, 0x81, 0x69, 0x82, 0x34, 0x7A, 0x21, 0x77, 0xBF, 0x28,
-    0xA4, 0x47, 0x44, 0x83, 0x41, 0xE1, 0xE7, 0x4A, 0xAE, 0x36, 0xBA, 0xA5, 0xD6, 0x8F, 0x7D, 0xF4,
-    0x9B, 0xC8, 0x74, 0x36, 0x74, 0x30, 0xB9, 0x8B, 0x57, 0xE4, 0x25, 0xA8, 0xF6, 0xB4, 0x68, 0x94,
-    0x8C, 0xDA, 0x39, 0x57, 0x2E, 0x6A, 0x93, 0x1D, 0xB6, 0x87, 0x01, 0xD9, 0x0E, 0xE2, 0xBE, 0xBC,
-    0x03, 0xA2, 0x7E, 0xBC, 0x87, 0xCA, 0x95, 0x65, 0x61, 0xEC, 0xC2, 0xB4, 0xB2, 0x9B, 0x31, 0x91,
-    0x97, 0x70, 0xE3, 0x04, 0x6E, 0xF8, 0xB8, 0xF1, 0xEB, 0xF7, 0x30, 0xCF, 0x55, 0x43, 0xFD, 0x80,
-    0xE0, 0xC2, 0x8E, 0xB7, 0xEC, 0xC2, 0x87, 0x6D, 0x41, 0x6A, 0x56, 0x3C, 0x3A, 0x0B, 0xCB, 0x34,
-    0x96, 0x31, 0xAF, 0x36, 0x4E, 0xDD, 0xCA, 0x99, 0x75, 0xF1, 0xAF, 0xC4, 0xCE, 0x4D, 0x65, 0xA2,
-    0x6F, 0xD5, 0x6D, 0x40, 0x25, 0x16, 0xA9, 0x2C, 0x17, 0x4E, 0x42, 0x5A, 0x21, 0x5E, 0x1D, 0xDD,
-    0xA8, 0x86, 0x5F, 0x33, 0x46, 0x60, 0xB7, 0xD8, 0x0D, 0xAD, 0xEE, 0x0F, 0x13, 0x7E, 0x2C, 0x7E,
-    0xA5, 0xF8, 0x65, 0x7D, 0xCE, 0xD4, 0x5C, 0x53, 0xBA, 0xA6, 0x77, 0x4B, 0xFF, 0x52, 0x65, 0x5D,
-    0x87, 0x0E, 0xB6, 0xC0, 0x84, 0x72, 0x70, 0xB3, 0x52, 0x5F, 0x0C, 0x3B, 0x52, 0xFB, 0x4B, 0x7F,
-    0x04, 0x9D, 0xC7, 0x70, 0x77, 0xD6, 0x00, 0x43, 0xA8, 0xDB, 0x7F, 0xC0, 0x3F, 0xD2, 0x47, 0x63,
-    0x79, 0x86, 0xFB, 0x62, 0xDE, 0x14, 0x40, 0x0E, 0x9C, 0x04, 0xD4, 0x4F, 0x63, 0x89, 0xE7, 0xE9,
-    0xE3, 0x13, 0x3F, 0x1C, 0xE9, 0xA3, 0xB1, 0x3C, 0x56, 0x81, 0xE1, 0x96, 0x42, 0x13, 0x02, 0x23,
-    0xB8, 0x9E, 0x11, 0x24, 0xE8, 0xB3, 0x14, 0x52, 0x96, 0x4E, 0xF8, 0x20, 0xE9, 0x69, 0xB6, 0x67,
-    0xA4, 0x8B, 0x24, 0x78, 0x1D, 0xC2, 0x86, 0xE1, 0x28, 0xB5, 0x26, 0x53, 0x74, 0x01, 0x90, 0x87,
-    0x7D, 0x09, 0x67, 0x65, 0x9D, 0x83, 0x0D, 0xD3, 0x9F, 0x3D, 0x86, 0x3B, 0xF8, 0x5D, 0x53, 0x04,
-    0xE2, 0x20, 0xF8, 0x27, 0xB9, 0xDA, 0x9F, 0x9D, 0x0A, 0x5D, 0x4F, 0x70, 0x16, 0xDB, 0x97, 0x28,
-    0x24, 0xA8, 0x86, 0xC5, 0xEF, 0xAB, 0x0E, 0xE8, 0xAB, 0x0B, 0x3F, 0x5E, 0xF7, 0x53, 0xEF, 0x62,
-    0x2E, 0x66, 0xDE, 0x57, 0xDF, 0x0D, 0x6F, 0x47, 0xE2, 0xE1, 0x45, 0x38, 0x55, 0xD2, 0xC4, 0x90,
-    0xB3, 0xB9, 0xCD, 0x67, 0x37, 0x07, 0xF0, 0x38, 0xA2, 0xAA, 0x53, 0x84, 0x55, 0x50, 0x1C, 0x66,
-    0x82, 0x87, 0x96, 0x4D, 0x58, 0xA4, 0x55, 0x31, 0xA0, 0x01, 0x44, 0xC9, 0xA3, 0x4A, 0xB5, 0xA2,
-    0x31, 0x46, 0x20, 0x8D, 0x3C, 0xF0, 0x1B, 0x47, 0x00, 0xF1, 0x2C, 0x03, 0x20, 0x69, 0xBD, 0xFD,
-    0x57, 0xE2, 0x8C, 0xB3, 0x58, 0xFC, 0x8C, 0x4F, 0x7F, 0x0D, 0x41, 0xB9, 0x65, 0x70, 0x5D, 0x56,
-    0xB1, 0x7D, 0xA1, 0x31, 0xCF, 0x68, 0x1C, 0x1A, 0x3D, 0xB5, 0xA5, 0x09, 0x03, 0xB4, 0xB5, 0x8D,
-    0xE7, 0x17, 0xB1, 0x01, 0x96, 0x00, 0x6F, 0x1F, 0x95, 0x67, 0x67, 0xBB, 0x1E, 0xDB, 0x9E, 0xFB,
-    0xC0, 0xD4, 0x41, 0x1A, 0xFE, 0xBD, 0x07, 0x6F, 0x8F, 0xE5, 0x37, 0x21, 0xA3, 0x48, 0x08, 0xEA,
-    0x9C, 0x3A, 0x28, 0x20, 0x83, 0x42, 0x96, 0x30, 0x47, 0x38, 0xC9, 0xF9, 0x3A, 0x66, 0x87, 0x3A,
-    0x52, 0xD8, 0x11, 0x00, 0x87, 0x24, 0x74, 0xBB, 0x17, 0x80, 0x9A, 0x4B, 0xFA, 0xB9, 0xE8, 0xF3,
-    0xD5, 0xCA, 0x21, 0x0D, 0x4F, 0xDC, 0x98, 0xA2, 0xC5, 0x73, 0xF2, 0x73, 0xD8, 0x8F, 0x03, 0x06,
-    0x69, 0x51, 0x03, 0x98, 0x3F, 0x25, 0x0F, 0x41, 0x1A, 0xCF, 0x42, 0xB7, 0x41, 0x7C, 0x7E, 0xF4,
-    0x54, 0xCD, 0x9C, 0xA7, 0xA2, 0xD2, 0x12, 0xDD, 0x4F, 0xA6, 0x38, 0x23, 0x5B, 0x87, 0x42, 0x8D,
-    0x11, 0x76, 0xA5, 0x11, 0x0A, 0xD0, 0x16, 0x01, 0x2C, 0x89, 0x2D, 0x26, 0x23, 0x37, 0xFB, 0x01,
-    0x12, 0xA9, 0xD5, 0x7D, 0xBE, 0x02, 0x76, 0x0C, 0x43, 0xBA, 0x29, 0x97, 0x20, 0x6C, 0xDC, 0x8C,
-    0x20, 0x11, 0xFF, 0x2C, 0xBD, 0xBE, 0xF9, 0x23, 0x70, 0x33, 0xFD, 0xFA, 0x3F, 0xFF, 0xCF, 0xCC,
-    0x8A, 0xA9, 0x0E, 0x97, 0x56, 0x1D, 0x14, 0x73, 0x78, 0xE4, 0xC1, 0x4A, 0x82, 0x90, 0xD7, 0x6E,
-    0x27, 0x0C, 0x13, 0xCF, 0x51, 0x70, 0x98, 0x90, 0x9C, 0xCE, 0xDD, 0x98, 0xE7, 0x1B, 0xBB, 0x8E,
-    0x37, 0x35, 0x5C, 0x7A, 0x90, 0x84, 0x53, 0x31, 0x5D, 0x93, 0xE8, 0xF9, 0x0E, 0x24, 0x22, 0x5C,
-    0x5F, 0x69, 0x34, 0x26, 0x0C, 0xBB, 0xEB, 0x8F, 0xA7, 0x38, 0x3B, 0x01, 0x82, 0x49, 0x1B, 0x78,
-    0x27, 0xDC, 0x6C, 0x91, 0x77, 0x2C, 0x81, 0xD8, 0xC8, 0xE9, 0x7F, 0x89, 0x5C, 0x90, 0x11, 0xFB,
-    0x6D, 0x4D, 0x58, 0x8F, 0x30, 0x98, 0xE2, 0xA3, 0x66, 0x2B, 0x49, 0x6A, 0x57, 0x70, 0x66, 0x2E,
-    0x03, 0x94, 0xCF, 0xED, 0xF4, 0x9C, 0xF2, 0x17, 0x4D, 0xFE, 0x98, 0xD0, 0x8B, 0x18, 0x6C, 0x65,
-    0x65, 0x1B, 0x2F, 0xDC, 0x68, 0x65, 0x21, 0xFB, 0x4B, 0x45, 0xFE, 0xE0, 0xC5, 0x9B, 0x88, 0x21,
-    0x1C, 0xCE, 0x23, 0x48, 0x93, 0xCB, 0xD6, 0x36, 0xB5, 0xD7, 0xD0, 0x09, 0xA6, 0x8A, 0xEE, 0x06,
-    0xCD, 0xEA, 0xFB, 0xB3, 0x29, 0xE9, 0x76, 0x84, 0x59, 0x89, 0x22, 0x76, 0x4D, 0x21, 0x99, 0x61,
-    0x12, 0x6B, 0xAA, 0x69, 0xE3, 0x1B, 0xA7, 0x1C, 0xF7, 0x6E, 0x98, 0xEE, 0xC4, 0x7E, 0x57, 0x77,
-    0xB7, 0xE9, 0xDC, 0xD2, 0xFB, 0xC0, 0xA6, 0x3D, 0xB4, 0xCC, 0x21, 0x31, 0x2F, 0x13, 0x3A, 0xE9,
-    0xA0, 0xCE, 0x00, 0xE9, 0x9F, 0x8F, 0x7C, 0xCD, 0x9B, 0x9C, 0x4E, 0x0F, 0x4F, 0x14, 0x1A, 0x05,
-    0xAE, 0x3D, 0xE6, 0x0C, 0x2E, 0x30, 0x17, 0x03, 0x47, 0x0D, 0xE8, 0x68, 0xFD, 0xEB, 0xBF, 0x6E,
-    0x85, 0xD4, 0x2E, 0x6C, 0x13, 0x64, 0x68, 0xF6, 0x47, 0x47, 0x82, 0x77, 0xA9, 0x11, 0x59, 0x8A,
-    0x14, 0xD6, 0xF3, 0xFA, 0x13, 0x39, 0xB6, 0x27, 0x10, 0xC5, 0x81, 0xF9, 0x2B, 0x93, 0xCD, 0x3E,
-    0x1E, 0x00, 0x23, 0xC3, 0x5A, 0x3C, 0x20, 0x61, 0x5F, 0x5D, 0xD2, 0xFC, 0xED, 0x6B, 0x2B, 0x2B,
-    0x9D, 0x62, 0xA8, 0x9A, 0x16, 0x6A, 0xBE, 0xE5, 0xE9, 0x9D, 0xDB, 0x36, 0x5E, 0x48, 0xFA, 0xC8,
-    0x14, 0x2E, 0x94, 0xA4, 0xC2, 0xEA, 0x95, 0x3A, 0xD8, 0x8A, 0x77, 0x11, 0xD6, 0x13, 0x50, 0xF7,
-    0xC7, 0xE4, 0xDC, 0x9C, 0xDD, 0x88, 0x47, 0x53, 0x08, 0xDA, 0xC9, 0xC8, 0x6F, 0xB9, 0xD0, 0xD7,
-    0xB4, 0x09, 0x64, 0x0B, 0x1F, 0x0A, 0xD3, 0x2B, 0x80, 0x72, 0x7B, 0x02, 0x0A, 0xC2, 0xAE, 0xFD,
-    0x5E, 0x5C, 0x93, 0x87, 0x9D, 0x6F, 0xF2, 0xAC, 0x1B, 0xF3, 0x14, 0xA5, 0x90, 0x05, 0x07, 0x73,
-    0x79, 0x60, 0x62, 0xB8, 0x92, 0x59, 0xD3, 0x0D, 0xD7, 0xF9, 0xFB, 0xD2, 0xAD, 0xAC, 0x24, 0x31,
-    0xED, 0xD4, 0x4C, 0xD7, 0xF9, 0x6F, 0xEF, 0x78, 0xF5, 0x4C, 0x01, 0x70, 0x31, 0xCA, 0x84, 0xC6,
-    0x95, 0x11, 0x28, 0x98, 0x89, 0x41, 0x26, 0x05, 0x16, 0xCB, 0x09, 0x76, 0xF6, 0xD6, 0x74, 0xAB,
-    0xFA, 0xD9, 0x39, 0xF1, 0x2F, 0x62, 0xDB, 0x45, 0x94, 0xBD, 0x49, 0x01, 0xA6, 0x6B, 0x35, 0x1C,
-    0xF5, 0xAF, 0xEA, 0x5A, 0xB8, 0xB3, 0x6E, 0x7F, 0x2B, 0x69, 0x6D, 0x73, 0xC9, 0x54, 0x21, 0x85,
-    0x2E, 0xC9, 0xC9, 0xB3, 0xE6, 0x75, 0x7F, 0xB5, 0x3D, 0x16, 0xE4, 0x93, 0xCC, 0x23, 0x53, 0x22,
-    0x3E, 0x71, 0x8B, 0xC9, 0x00, 0xA2, 0xBF, 0x75, 0x98, 0x41, 0x74, 0x0D, 0x93, 0xBA, 0xA7, 0xB3,
-    0x2F, 0x3E, 0x79, 0xA1, 0x7D, 0x39, 0x9A, 0xB6, 0xFE, 0xD1, 0xDA, 0x35, 0x31, 0xCD, 0x38, 0xB6,
-    0x6E, 0x7B, 0xB1, 0x32, 0xF0, 0x9D, 0x87, 0xA6, 0x32, 0xE6, 0xBD, 0x8D, 0xB7, 0x26, 0x02, 0xE0,
-    0xCC, 0x81, 0x55, 0xF6, 0xB9, 0xB6, 0x0E, 0x21, 0x42, 0x05, 0x9D, 0xAF, 0x99, 0x76, 0x63, 0x86,
-    0x3C, 0xF7, 0xB7, 0xB8, 0x16, 0x85, 0x2E, 0x94, 0xBE, 0xCF, 0xA4, 0x28, 0x9E, 0x2A, 0x41, 0x77,
-    0x2D, 0x03, 0x4F, 0xFE, 0xB6, 0x75, 0xFE, 0x02, 0xB4, 0xDB, 0x0F, 0xE1, 0x7A, 0xFF, 0x64, 0x44,
-    0xE6, 0x0B, 0x53, 0xAA, 0x8A, 0x5A, 0xD5, 0xDB, 0x37, 0x0E, 0xB2, 0x0E, 0xBC, 0x9E, 0x07, 0x6C,
-    0x5A, 0x83, 0x87, 0x72, 0x4C, 0x9A, 0x0C, 0x98, 0x32, 0x8A, 0x99, 0xAC, 0xA4, 0xD6, 0x0C, 0xE5,
-    0xEF, 0x6F, 0x61, 0xB7, 0xB0, 0xC6, 0xD4, 0x29, 0x6C, 0x27, 0xF4, 0x05, 0xFF, 0x19, 0x07, 0xC5,
-    0x2C, 0x05, 0x34, 0xE6, 0x75, 0x93, 0xDE, 0x91, 0xA4, 0x61, 0x60, 0x9B, 0xAF, 0x15, 0xD8, 0x65,
-    0x71, 0x82, 0x5D, 0xFE, 0x0D, 0xAB, 0xE2, 0x72, 0xD4, 0x9C, 0x1D, 0xCA, 0x5E, 0x98, 0xF9, 0x0F,
-    0xA6, 0x4D, 0xA0, 0xED, 0xCB, 0xB4, 0xCC, 0xF8, 0x1E, 0x5E, 0x42, 0xC2, 0x39, 0x43, 0xB2, 0x27,
-    0x1F, 0xBD, 0xBD, 0x2B, 0x4A, 0x26, 0x64, 0x6E, 0x69, 0xB4, 0xB7, 0x1A, 0xBE, 0xB6, 0xB1, 0x7A,
-    0xA7, 0xB1, 0x3A, 0x88, 0xEF, 0xCD, 0x79, 0xBF, 0x78, 0xB4, 0x5E, 0x68, 0x93, 0x3A, 0x68, 0xDD,
-    0xDA, 0x6A, 0x41, 0xFC, 0xE6, 0x7E, 0xFE, 0x1D, 0x35, 0xE9, 0x26, 0x24, 0xBB, 0x39, 0x96, 0x38,
-    0xDA, 0xE1, 0x1F, 0xF7, 0x31, 0x62, 0xAF, 0x62, 0xA6, 0xF3, 0xEA, 0x9C, 0x71, 0x07, 0x9E, 0xCF,
-    0xF9, 0xAA, 0xB6, 0xAB, 0x50, 0x2A, 0x2B, 0x9F, 0xAC, 0xDF, 0x48, 0xD6, 0x4F, 0x99, 0xFB, 0x58,
-    0x8D, 0xD8, 0xFF, 0x87, 0x33, 0x1A, 0x79, 0xF1, 0x19, 0x21, 0xCA, 0x83, 0x52, 0x19, 0xAB, 0x27,
-    0x84, 0xE0, 0x35, 0x72, 0xA6, 0x76, 0xFE, 0xBB, 0x0A, 0x9D, 0xB2, 0x74, 0x86, 0x3D, 0x0A, 0xE7,
-    0x0A, 0x4C, 0xFC, 0xE2, 0xFE, 0x0C, 0xBD, 0xA1, 0x4B, 0x4F, 0xC4, 0xAB, 0x2D, 0x13, 0xDB, 0x93,
-    0x8F, 0x46, 0xAA, 0x93, 0x20, 0x3F, 0x40, 0x6E, 0x01, 0x58, 0x27, 0xFD, 0x90, 0x75, 0xE3, 0xAD,
-    0x8E, 0x84, 0x81, 0x20, 0xFF, 0x5D, 0x32, 0x4F, 0x08, 0x21, 0x9D, 0x42, 0xFD, 0x56, 0xB1, 0x3E,
-    0x03, 0xDA, 0x55, 0x7E, 0x6E, 0x23, 0x16, 0x1E, 0x58, 0x68, 0xF1, 0x73, 0xB8, 0x6E, 0xA7, 0x72,
-    0x5B, 0xB5, 0x40, 0xAE, 0xE8, 0x76, 0xB0, 0x76, 0xE8, 0x8A, 0x69, 0x85, 0x96, 0x0E, 0x8F, 0xC8,
-    0x98, 0x91, 0xB5, 0x53, 0x35, 0x89, 0x24, 0xC9, 0x00, 0x19, 0x34, 0x9B, 0x18, 0x80, 0xD7, 0x32,
-    0xD1, 0x20, 0xD5, 0x5C, 0x8D, 0xEA, 0x77, 0x6E, 0x33, 0x08, 0x61, 0x1E, 0x16, 0xF3, 0x5F, 0x58,
-    0x44, 0x64, 0x31, 0xE9, 0x87, 0x8D, 0x44, 0x21, 0x93, 0x07, 0xCC, 0x19, 0x21, 0x70, 0x3A, 0x5F,
-    0x51, 0xBC, 0x90, 0x24, 0x82, 0x66, 0x8A, 0xB7, 0x0C, 0x06, 0x4E, 0x6B, 0x99, 0x32, 0xA8, 0x23,
-    0x33, 0x94, 0x54, 0x97, 0x87, 0x20, 0xE5, 0x17, 0x23, 0x7C, 0x22, 0x06, 0xD2, 0xE8, 0xEF, 0xC7,
-    0x63, 0x39, 0x92, 0x94, 0x65, 0xCF, 0x1B, 0x9A, 0x11, 0x36, 0x6B, 0x1C, 0x61, 0x13, 0xE0, 0xE9,
-    0xE0, 0x24, 0xA0, 0x54, 0x4D, 0x60, 0x95, 0xC9, 0x98, 0x97, 0xAC, 0xE6, 0xB8, 0x03, 0xAA, 0x83,
-    0x93, 0x80, 0x67, 0x35, 0xA0, 0x56, 0x10, 0x47, 0xB9, 0xD7, 0x0B, 0xB6, 0x4B, 0xED, 0x30, 0x30,
-    0x1D, 0x8C, 0x35, 0xA6, 0x73, 0x09, 0x8F, 0xF2, 0xA2, 0x74, 0x2F, 0x83, 0xD3, 0x78, 0x57, 0x20,
-    0xCF, 0x99, 0x70, 0xCB, 0x9E, 0x04, 0x4D, 0xF6, 0x79, 0xE3, 0xCF, 0x63, 0x36, 0x13, 0xE0, 0xC6,
-    0x8B, 0xCC, 0x66, 0x3E, 0xD3, 0x20, 0x8F, 0x45, 0x72, 0xAF, 0x0A, 0xDB, 0xE8, 0xF2, 0xC1, 0x01,
-    0xDE, 0x87, 0x55, 0xD0, 0x2A, 0x82, 0xB3, 0x89, 0xEA, 0xC3, 0x3B, 0x0F, 0x02, 0x38, 0x90, 0x6A,
-    0xB0, 0x15, 0x56, 0x6D, 0xCA, 0xBB, 0x21, 0x8C, 0x37, 0x9E, 0x1E, 0xD3, 0x2C, 0xC2, 0xBA, 0xC7,
-    0x99, 0x4A, 0x36, 0x1A, 0x87, 0x67, 0x48, 0x81, 0x71, 0x87, 0xD6, 0xAE, 0x10, 0x6F, 0x42, 0x60,
-    0x7F, 0xA3, 0xF6, 0xE0, 0xB5, 0x88, 0xA8, 0xFE, 0xBE, 0xA8, 0x05, 0x72, 0x84, 0x2B, 0x1E, 0xAA,
-    0x0D, 0x1D, 0x5D, 0x2C, 0x3D, 0x64, 0x3D, 0x34, 0x06, 0x28, 0xE9, 0xF3, 0x64, 0x04, 0x48, 0xD6,
-    0x4F, 0x93, 0xDE, 0x21, 0xC4, 0x61, 0x50, 0x7D, 0x16, 0x93, 0x1F, 0xD8, 0x3F, 0x4B, 0xF6, 0x58,
-    0x39, 0x91, 0x35, 0xA7, 0xB2, 0x12, 0x96, 0x62, 0x5E, 0x53, 0x18, 0xB5, 0x7C, 0x28, 0xAC, 0x16,
-    0x93, 0x6A, 0xC9, 0xA9, 0x16, 0xED, 0xEA, 0x84, 0x5D, 0x9D, 0xB6, 0xAB, 0x97, 0xED, 0xEA, 0x10,
-    0x68, 0xDB, 0xCF, 0x2F, 0xED, 0x4B, 0x23, 0xDA, 0x1D, 0x05, 0x6D, 0xA7, 0x34, 0x62, 0xDC, 0x30,
-    0xCC, 0xC5, 0x52, 0x3F, 0xB7, 0xF6, 0x2D, 0xE8, 0x65, 0xDD, 0x55, 0xDC, 0x54, 0xD1, 0xB0, 0xE7,
-    0xC2, 0x5B, 0xFF, 0x5B, 0x88, 0x43, 0xE9, 0xEC, 0x2A, 0x28, 0x42, 0x44, 0x84, 0xDB, 0x3F, 0xC2,
-    0x62, 0x8A, 0x8C, 0x94, 0x0E, 0xB4, 0x32, 0x23, 0x9E, 0x07, 0xD4, 0xED, 0xB4, 0x53, 0xFD, 0x3C,
-    0x1D, 0xF6, 0xA4, 0xD0, 0x0A, 0x75, 0x17, 0x10, 0x1E, 0x85, 0xDC, 0xDC, 0xEF, 0xCC, 0x3D, 0x25,
-    0x4F, 0xF3, 0xC5, 0x4A, 0x69, 0xA6, 0x48, 0x99, 0x46, 0x36, 0xBE, 0xCA, 0xF4, 0x30, 0x9C, 0x20,
-    0xAB, 0x79, 0x11, 0xDD, 0x31, 0x16, 0x07, 0x96, 0x06, 0x15, 0x9B, 0x3F, 0xB5, 0xBF, 0x2E, 0xBC,
-    0x4E, 0xC2, 0x1C, 0xC9, 0x50, 0x88, 0xC4, 0x32, 0x7F, 0x34, 0xDC, 0xFD, 0x00, 0xC4, 0xF9, 0xAA,
-    0x31, 0xB3, 0x9E, 0x90, 0xEE, 0x67, 0x6E, 0xBB, 0x11, 0x4C, 0x6B, 0xC9, 0xF2, 0x07, 0x7B, 0xCA,
-    0x39, 0x2C, 0x2C, 0xFE, 0x1F, 0xD6, 0xCA, 0x1A, 0xFA, 0xAB, 0x13, 0x12, 0x01, 0x9E, 0xE7, 0x98,
-    0x1B, 0xC3, 0xC5, 0x6D, 0x0E, 0x2F, 0xD5, 0x1C, 0x06, 0x39, 0x86, 0xC5, 0x36, 0x87, 0x4E, 0xCD,
-    0x61, 0x90, 0x63, 0x28, 0x19, 0x87, 0x4E, 0xCD, 0xA1, 0x7F, 0x01, 0x43, 0x49, 0x38, 0xC4, 0xEB,
-    0x18, 0x62, 0xB3, 0xC3, 0x9A, 0x13, 0x80, 0x25, 0xA4, 0x58, 0x2C, 0x4E, 0x0D, 0x6D, 0x95, 0x99,
-    0x55, 0x32, 0xC9, 0xD0, 0x18, 0x37, 0x73, 0x70, 0xEA, 0x0E, 0xED, 0x9D, 0x0A, 0x7B, 0x2C, 0xE1,
-    0x7B, 0x74, 0xD3, 0xC8, 0xBA, 0x17, 0xE0, 0xB3, 0xC9, 0x77, 0xC4, 0x82, 0xD4, 0x16, 0xFC, 0x0C,
-    0x00, 0xFB, 0x3A, 0x3C, 0x29, 0xA2, 0x57, 0x18, 0x7F, 0xC3, 0x2D, 0x2B, 0x43, 0xAE, 0xF2, 0x1A,
-    0xE0, 0xB5, 0x19, 0xCB, 0x87, 0x0C, 0xDF, 0xAB, 0x08, 0x2A, 0xF0, 0xA2, 0xA5, 0x72, 0xA9, 0x0C,
-    0xB3, 0xD0, 0xE3, 0x7C, 0x5C, 0x92, 0x35, 0x84, 0xE2, 0xDC, 0xF9, 0xA0, 0xE5, 0xD0, 0x2B, 0xC9,
-    0x5A, 0x14, 0x63, 0x68, 0xB5, 0x1C, 0x7A, 0x15, 0x59, 0x8B, 0x4E, 0x92, 0xB5, 0x96, 0x43, 0xF7,
-    0x2A, 0x87, 0x91, 0x72, 0xA9, 0x0C, 0xBB, 0xC0, 0x13, 0x2C, 0x13, 0x53, 0x05, 0xEA, 0xED, 0xAD,
-    0xA9, 0x04, 0x62, 0xCF, 0xB5, 0x95, 0xDA, 0x99, 0x6A, 0x06, 0xB8, 0x72, 0xF8, 0x7E, 0xF0, 0xBA,
-    0x37, 0xE7, 0x5B, 0x9A, 0xA4, 0xAB, 0x0B, 0x3F, 0xA5, 0x4E, 0xE6, 0x87, 0x34, 0x6C, 0xC6, 0x22,
-    0xFF, 0x3D, 0xC5, 0x17, 0x5B, 0x7C, 0x46, 0x21, 0xB6, 0x53, 0x3E, 0x7C, 0x1B, 0x39, 0xC0, 0x4B,
-    0x8D, 0x47, 0xAC, 0x6A, 0x89, 0x61, 0xAD, 0x1A, 0xAD, 0x58, 0x3B, 0x0E, 0x76, 0x7A, 0xEF, 0x6D,
-    0xC4, 0xDA, 0x29, 0x12, 0x8D, 0xC1, 0x51, 0xEB, 0xBC, 0x32, 0x2B, 0x81, 0x0E, 0xCD, 0x1F, 0x0A,
-    0xF0, 0x30, 0x88, 0x5A, 0x68, 0xA2, 0x4E, 0x4E, 0x58, 0xE6, 0x13, 0xEE, 0xF2, 0x05, 0xCD, 0xE1,
-    0x28, 0xEF, 0x56, 0x1F, 0x24, 0x17, 0x5E, 0x3E, 0x7E, 0xF0, 0x86, 0x0F, 0x9B, 0xFB, 0xF8, 0xC0,
-    0x44, 0xA7, 0x20, 0xD4, 0xC8, 0xFA, 0x39, 0x93, 0x4D, 0x06, 0x93, 0x2D, 0xF6, 0x9A, 0x6C, 0xA1,
-    0x26, 0x2B, 0x3B, 0x26, 0x5B, 0xA8, 0xC9, 0xCA, 0x8E, 0xC9, 0x96, 0x6A, 0xB2, 0xCE, 0x8E, 0xC9,
-    0x7E, 0xA6, 0x26, 0xBB, 0xF6, 0xCD, 0x26, 0x4B, 0x2A, 0xAC, 0x58, 0xA3, 0x11, 0xCB, 0x21, 0xAE,
-    0x46, 0x41, 0x05, 0x40, 0xF2, 0xDB, 0x41, 0xDE, 0x76, 0x1B, 0xF6, 0x2A, 0xEE, 0xD5, 0xDE, 0x6D,
-    0x55, 0xDA, 0x14, 0x28, 0x25, 0xAB, 0xF2, 0xA4, 0x60, 0x6F, 0x7B, 0x23, 0xAB, 0xED, 0x1A, 0x1E,
-    0x79, 0x6B, 0xEA, 0xA9, 0x8D, 0x6E, 0x9E, 0xFA, 0x54, 0x28, 0x85, 0x7F, 0xD6, 0x65, 0xE2, 0xAC,
-    0x46, 0xCB, 0x0C, 0x78, 0x6C, 0xBE, 0x99, 0xCE, 0x9F, 0xC7, 0xCE, 0x69, 0x5E, 0x59, 0xC0, 0xA5,
-    0x5F, 0x31, 0xF4, 0xAC, 0x61, 0x65, 0x03, 0x77, 0xF4, 0xD4, 0x59, 0x98, 0xB3, 0xB1, 0xC5, 0x9A,
-    0x82, 0x64, 0x4C, 0x0C, 0x03, 0x16, 0x47, 0x9C, 0xAF, 0x14, 0xAE, 0xD1, 0xC7, 0x44, 0x21, 0x3B,
-    0xDF, 0xBC, 0xE9, 0x12, 0xD8, 0xD9, 0x0D, 0x31, 0x5C, 0xE7, 0xB1, 0x2F, 0xC3, 0xDA, 0x4F, 0xC2,
-    0x06, 0x56, 0xC6, 0xAA, 0x16, 0x36, 0x80, 0xC7, 0x9C, 0x40, 0xAB, 0x33, 0xD6, 0xC6, 0x86, 0xA2,
-    0x5B, 0x1B, 0xFF, 0xCF, 0xBB, 0x25, 0xC2, 0x5D, 0xDC, 0xCF, 0xFD, 0x22, 0xA8, 0xA0, 0x80, 0x7A,
-    0x09, 0x13, 0x82, 0xB1, 0x16, 0x9A, 0x6C, 0x89, 0x05, 0x09, 0x27, 0xF9, 0x39, 0x63, 0x6D, 0x06,
-    0xF0, 0x3E, 0x84, 0x2A, 0xFC, 0x3E, 0x4B, 0xD9, 0x2E, 0x1F, 0x2A, 0xA3, 0x8A, 0x9B, 0x53, 0x97,
-    0x91, 0xDF, 0xD5, 0x54, 0xAA, 0x98, 0xAA, 0x81, 0x07, 0x77, 0x16, 0xA2, 0xC4, 0x03, 0xBE, 0x12,
-    0xF6, 0x86, 0x5D, 0x20, 0x84, 0x32, 0xB0, 0x11, 0x94, 0x60, 0xD0, 0x66, 0x03, 0x45, 0xA2, 0xB3,
-    0x60, 0xC0, 0x23, 0x43, 0x56, 0x9B, 0x28, 0x97, 0xE0, 0xCA, 0xBF, 0x58, 0x8E, 0x38, 0x50, 0xF4,
-    0x66, 0x42, 0x79, 0x84, 0x67, 0x29, 0xE3, 0x82, 0xD5, 0xDA, 0xCA, 0x67, 0x1F, 0x0C, 0x3B, 0xDD,
-    0x63, 0xB5, 0x86, 0xE6, 0xAB, 0xED, 0x3A, 0x6B, 0xAC, 0xFE, 0x23, 0xD2, 0x3B, 0xD0, 0x8C, 0x2F,
-    0xEC, 0x6B, 0x48, 0x52, 0x4F, 0xF8, 0xF5, 0x1E, 0x32, 0x2E, 0x4E, 0xFC, 0xB4, 0x0C, 0x7D, 0x20,
-    0xB7, 0x61, 0xCF, 0xB2, 0xD6, 0x02, 0x16, 0xC1, 0x50, 0xF1, 0xC8, 0x8C, 0xFD, 0x5F, 0xA9, 0xFD,
-    0xA9, 0x3E, 0xB2, 0x56, 0x7C, 0xE8, 0x07, 0x80, 0x0E, 0x2F, 0xB0, 0xE4, 0x9F, 0xD1, 0xA3, 0xFA,
-    0x25, 0x35, 0xB9, 0xC3, 0xE3, 0xC8, 0xB8, 0xEA, 0x9C, 0x0D, 0xCA, 0x68, 0x66, 0x08, 0x5E, 0xD9,
-    0xD3, 0xD2, 0x42, 0xCA, 0x0D, 0x40, 0x02, 0x06, 0x93, 0x14, 0x36, 0xCB, 0x77, 0x2A, 0x5C, 0x6D,
-    0xA2, 0x4C, 0x75, 0x51, 0xF1, 0x4F, 0x02, 0xEA, 0xFE, 0xBE, 0x94, 0x08, 0x16, 0xBA, 0x8E, 0x3D,
-    0x50, 0x63, 0xAF, 0xBC, 0x71, 0xEC, 0x5E, 0x4B, 0x40, 0x56, 0x8D, 0x56, 0xFD, 0x58, 0x79, 0x29,
-    0x02, 0x26, 0x93, 0x8B, 0xC4, 0xF4, 0xD8, 0xCC, 0x9A, 0xBD, 0x3C, 0x1D, 0x12, 0xBC, 0x6B, 0x43,
-    0xBB, 0xD2, 0x82, 0x58, 0xA4, 0x38, 0xD1, 0xA9, 0x56, 0x62, 0x22, 0x7E, 0xD3, 0x13, 0xE1, 0xE3,
-    0xCD, 0xED, 0xE1, 0x9B, 0xE1, 0xB1, 0x48, 0x7F, 0x1D, 0xA6, 0x05, 0x72, 0x30, 0x50, 0xF8, 0x50,
-    0x69, 0x77, 0x23, 0x70, 0x58, 0x22, 0x7B, 0xBC, 0xF2, 0xB4, 0xFB, 0xA3, 0x7D, 0xB4, 0xD9, 0x99,
-    0x0D, 0x4B, 0x2D, 0x2E, 0xEC, 0xE1, 0xDC, 0x41, 0x4D, 0x05, 0xCE, 0x80, 0x44, 0x5A, 0xBB, 0x06,
-    0x52, 0xEE, 0x20, 0xC1, 0x14, 0xBB, 0xC3, 0xBF, 0x58, 0x00, 0x75, 0xD1, 0x05, 0xB3, 0x52, 0xD9,
-    0x72, 0x0F, 0xF6, 0xD0, 0xD5, 0xBA, 0x66, 0x32, 0x78, 0x02, 0xBA, 0xF0, 0x95, 0x4A, 0x17, 0x52,
-    0xF6, 0x81, 0x45, 0x6B, 0x2B, 0x35, 0x57, 0xBE, 0x32, 0xA6, 0xF4, 0x91, 0x77, 0xC0, 0xB6, 0xC0,
-    0xB6, 0x72, 0xAE, 0x87, 0x5A, 0x8E, 0xCB, 0x70, 0xD8, 0x61, 0xA8, 0x92, 0x45, 0xC5, 0x2C, 0x04,
-    0x4E, 0x25, 0xD1, 0x4C, 0xFB, 0x7F, 0x37, 0x32, 0x32, 0xE5, 0x36, 0xB7, 0x69, 0x8C, 0xB6, 0xD3,
-    0x85, 0x7C, 0x5F, 0xCB, 0x58, 0x4B, 0x87, 0x6C, 0x9D, 0x1B, 0x7A, 0x1C, 0x63, 0x5B, 0xEB, 0x85,
-    0x31, 0xDB, 0x8E, 0x70, 0x98, 0x95, 0xC7, 0x59, 0x1C, 0x7D, 0xD7, 0x68, 0x8A, 0x5D, 0xB2, 0x58,
-    0xDF, 0x8E, 0x47, 0x68, 0x62, 0x05, 0xDC, 0x78, 0x9A, 0x67, 0x20, 0x72, 0x2D, 0x88, 0x4E, 0xB6,
-    0x6E, 0xB7, 0xC1, 0xD7, 0x26, 0x6C, 0x57, 0xAF, 0xFC, 0xC9, 0xEA, 0x55, 0x03, 0x30, 0x05, 0xF8,
-    0x33, 0xB6, 0x61, 0xD6, 0x77, 0x7F, 0xB0, 0xB2, 0x5E, 0xAB, 0x5D, 0x0F, 0x98, 0xF6, 0xC3, 0x53,
-    0x6F, 0x45, 0x93, 0xB8, 0xE1, 0xB2, 0x36, 0x95, 0x76, 0x87, 0x73, 0x1C, 0x77, 0xC1, 0xC4, 0xA0,
-    0x8D, 0x30, 0x55, 0x83, 0x6A, 0x54, 0x3C, 0x4B, 0x6A, 0x21, 0xB6, 0x2C, 0xC4, 0x4C, 0x8C, 0x40,
-    0x5D, 0x4D, 0x1F, 0xDE, 0x73, 0x99, 0xA8, 0x9C, 0xCA, 0xC8, 0x0F, 0x43, 0x7B, 0x07, 0x9C, 0x3C,
-    0x90, 0x4D, 0x3F, 0xF6, 0xDF, 0x4F, 0x89, 0x96, 0xA1, 0x43, 0xEB, 0xDC, 0x5D, 0x6B, 0x8F, 0xC6,
-    0x09, 0x4F, 0x0C, 0xAF, 0x60, 0x81, 0x01, 0x44, 0x87, 0x09, 0x87, 0xAE, 0xD0, 0xDE, 0xE3, 0xC4,
-    0xB4, 0x41, 0x41, 0xA0, 0xB4, 0x09, 0x74, 0x71, 0xA1, 0x92, 0x57, 0xE0, 0xB1, 0x2C, 0xF5, 0x4D,
-    0x30, 0x1E, 0x2C, 0x11, 0xD2, 0x91, 0xF0, 0x18, 0xD5, 0xBB, 0x50, 0xCA, 0x79, 0xF1, 0x3E, 0xCE,
-    0x65, 0x0B, 0x38, 0xE0, 0x62, 0xE5, 0x34, 0x99, 0xE9, 0x6D, 0xBA, 0xB1, 0x95, 0x21, 0xBD, 0x06,
-    0xEA, 0x73, 0x15, 0xE7, 0xC0, 0xFB, 0x9D, 0xE0, 0xE9, 0x8C, 0xE9, 0x68, 0x47, 0xE3, 0x7F, 0xD9,
-    0x86, 0xB2, 0xB9, 0x24, 0x27, 0x22, 0x39, 0x14, 0x96, 0xEC, 0x99, 0x39, 0x3C, 0xC4, 0xD0, 0xC0,
-    0x69, 0x3D, 0x27, 0xEB, 0x88, 0xDF, 0x4B, 0x58, 0xFD, 0xCB, 0x3A, 0x34, 0x05, 0xFB, 0x9C, 0xD8,
-    0xB8, 0x16, 0x2B, 0x16, 0xB5, 0xF8, 0xEF, 0xF3, 0x34, 0x95, 0x9C, 0x1E, 0xBB, 0x75, 0xF7, 0x96,
-    0x60, 0xB5, 0x2C, 0x93, 0xDA, 0x37, 0x0B, 0xE7, 0x52, 0xE5, 0xA7, 0xF5, 0x4F, 0x86, 0x86, 0xD9,
-    0x5D, 0x10, 0x7C, 0x70, 0x99, 0xCD, 0x01, 0xB8, 0x90, 0x77, 0x3B, 0x69, 0xC3, 0xD8, 0x03, 0x51,
-    0x6B, 0xA0, 0xED, 0x64, 0x3B, 0x9C, 0x1E, 0xC9, 0x6A, 0xD0, 0x57, 0x6A, 0x10, 0xB4, 0xA1, 0x01,
-    0xB7, 0x3D, 0x24, 0xFE, 0xC7, 0x29, 0x89, 0x22, 0x6D, 0xF0, 0xA7, 0xD1, 0x1F, 0xE0, 0x51, 0x42,
-    0xC4, 0x2B, 0x36, 0x87, 0x7E, 0x30, 0xA4, 0x56, 0x8F, 0x97, 0x6A, 0x9F, 0x40, 0x2D, 0xC4, 0x11,
-    0x87, 0xEF, 0x8E, 0xB0, 0xDF, 0x68, 0xFB, 0x67, 0x35, 0x25, 0xB6, 0x0B, 0x15, 0x07, 0x2D, 0xC3,
-    0xE2, 0x1F, 0x61, 0x0F, 0xD6, 0x45, 0x88, 0x09, 0x88, 0x0F, 0xF2, 0x59, 0x03, 0xF6, 0x5E, 0x8A,
-    0x17, 0x20, 0xF7, 0xB8, 0x34, 0xC1, 0xC9, 0xCA, 0xBB, 0x98, 0xB3, 0xA5, 0xD0, 0xCB, 0xD8, 0xE4,
-    0xB8, 0x0B, 0x2E, 0xC6, 0x03, 0x12, 0xDA, 0x96, 0xBD, 0x92, 0x46, 0xF1, 0x52, 0x0D, 0x10, 0xFE,
-    0x09, 0x9C, 0xDB, 0x33, 0x2F, 0x3B, 0x35, 0x00, 0x33, 0xA3, 0xAB, 0x82, 0xE7, 0xEF, 0x32, 0x58,
-    0xE0, 0xDE, 0xD4, 0x60, 0xA1, 0xDB, 0x8A, 0xDB, 0x8B, 0x3D, 0x6A, 0x1A, 0xDE, 0x70, 0x60, 0xAE,
-    0x19, 0xFB, 0x35, 0x5A, 0xD1, 0x79, 0x43, 0x0F, 0x0C, 0xEA, 0xEF, 0x51, 0x26, 0xE0, 0xCD, 0x3F,
-    0x5D, 0x5B, 0x9E, 0xDD, 0xD9, 0xFB, 0x5B, 0x0D, 0xD5, 0xC4, 0x4E, 0x86, 0x66, 0xF1, 0x8F, 0x74,
-    0xE6, 0xA3, 0x7A, 0x0A, 0x6D, 0xA8, 0xDD, 0x1D, 0x1E, 0x0E, 0xFB, 0xF0, 0xE8, 0x92, 0x9E, 0xF5,
-    0x71, 0x6E, 0x96, 0xE3, 0x51, 0x9F, 0x70, 0xF7, 0x79, 0x04, 0xC3, 0x43, 0x01, 0x7D, 0x03, 0x76,
-    0xAF, 0xC4, 0x51, 0xBC, 0x58, 0x81, 0xDD, 0x8F, 0xC0, 0xC1, 0xB1, 0xEF, 0xCE, 0xAE, 0x0E, 0x56,
-    0x15, 0x82, 0x8F, 0x45, 0x9A, 0x4A, 0xFD, 0x69, 0xC5, 0xE4, 0xE9, 0xDF, 0x0A, 0xE7, 0xD3, 0xDC,
-    0x29, 0xE3, 0xBB, 0xE1, 0xEE, 0x3B, 0x29, 0x87, 0xF2, 0xF6, 0xD4, 0x29, 0xEE, 0x57, 0x39, 0x77,
-    0x14, 0x3C, 0xC6, 0x99, 0xA9, 0x1E, 0x9F, 0xDD, 0xB9, 0x95, 0x34, 0xED, 0xC1, 0x12, 0x3B, 0x99,
-    0xB7, 0x59, 0x82, 0x82, 0xEF, 0x16, 0xFB, 0xD5, 0x56, 0x6E, 0xF9, 0x49, 0x00, 0x7B, 0xCC, 0x55,
-    0xD8, 0x20, 0x12, 0x41, 0x75, 0x9E, 0x11, 0x1D, 0xE9, 0x77, 0x1F, 0x12, 0xF7, 0xE5, 0xEC, 0x71,
-    0x6E, 0x8E, 0x81, 0xB7, 0x23, 0x86, 0xF0, 0x1A, 0x2B, 0x23, 0xB6, 0xA1, 0x33, 0x56, 0x44, 0x3A,
-    0x07, 0x97, 0x8C, 0x4B, 0x01, 0xC2, 0x75, 0x1F, 0x87, 0xBF, 0x93, 0x9F, 0xCF, 0x5A, 0x92, 0xD3,
-    0x0F, 0x32, 0x01, 0x6C, 0xAA, 0x3C, 0x6C, 0xAC, 0x6D, 0x66, 0x61, 0x0D, 0x8B, 0x60, 0x25, 0x0F,
-    0x20, 0xA5, 0x56, 0x03, 0x07, 0xE1, 0xEE, 0xBD, 0x15, 0xF1, 0x56, 0x4B, 0x54, 0xD3, 0xB8, 0x6C,
-    0xC0, 0xF6, 0xEC, 0x65, 0x7D, 0xC8, 0x6E, 0x8A, 0x45, 0x1C, 0xAE, 0x87, 0x5F, 0x98, 0xFA, 0xD8,
-    0x3B, 0x3D, 0x9E, 0x87, 0x2C, 0x86, 0x9F, 0x6D, 0x9C, 0x13, 0x75, 0x1B, 0x0B, 0x1B, 0x6F, 0xEE,
-    0xA1, 0x87, 0x69, 0x41, 0x19, 0x22, 0x93, 0x4B, 0x8F, 0x96, 0xB2, 0xFD, 0x8D, 0x3C, 0xEF, 0xDC,
-    0xAA, 0xF4, 0x68, 0x16, 0x8F, 0x7A, 0xA5, 0x09, 0x1C, 0x8A, 0xB9, 0xD2, 0x49, 0xD2, 0x85, 0xB5,
-    0x1C, 0x19, 0x8A, 0x33, 0xB3, 0x73, 0x0A, 0x6E, 0x19, 0xC8, 0x98, 0x9B, 0xD0, 0x3D, 0xCF, 0x1F,
-    0x55, 0x78, 0xB8, 0xF6, 0xC0, 0x13, 0x4F, 0x00, 0x9F, 0xCF, 0x30, 0x5D, 0x64, 0x1D, 0xBA, 0x97,
-    0x9D, 0x2C, 0xE5, 0xDE, 0xDB, 0x03, 0x91, 0xCF, 0x54, 0x43, 0xBB, 0xC6, 0x64, 0xDD, 0x77, 0xE8,
-    0xFA, 0x78, 0xE2, 0x4F, 0xFC, 0x7F, 0x4D, 0xA7, 0xA2, 0xFD, 0x4C, 0x38, 0xEC, 0x8A, 0x1A, 0x13,
-    0xF5, 0x9A, 0xB5, 0xDF, 0x9D, 0x44, 0x74, 0x68, 0xEB, 0xD9, 0xA0, 0x90, 0xB0, 0xCB, 0xD2, 0x0E,
-    0x83, 0x4F, 0x1C, 0x2E, 0x59, 0x7A, 0xB4, 0x22, 0xF8, 0xD7, 0x63, 0x78, 0xCA, 0xF9, 0xA9, 0xA9,
-    0xC4, 0xC4, 0x44, 0xDD, 0x2A, 0xF1, 0x9A, 0xF7, 0x0B, 0xC8, 0xEB, 0xB8, 0x07, 0xBA, 0xD7, 0x89,
-    0x09, 0xB3, 0x79, 0x94, 0x8D, 0x34, 0xAA, 0xF1, 0x8C, 0x64, 0xE5, 0x42, 0x43, 0x86, 0xEF, 0x24,
-    0x96, 0xA5, 0x41, 0x2C, 0x6A, 0x32, 0x30, 0xAC, 0x32, 0xC0, 0xD7, 0xE6, 0x26, 0x1B, 0xEF, 0xFF,
-    0xD8, 0xC9, 0xDC, 0x21, 0x75, 0x79, 0x96, 0xBD, 0x20, 0x1E, 0x7C, 0x46, 0xFA, 0x81, 0x2C, 0xCB,
-    0xEA, 0x99, 0x59, 0x47, 0xA4, 0xC9, 0x89, 0x77, 0xB5, 0xED, 0x1F, 0x8A, 0x6C, 0x24, 0x86, 0x5D,
-    0xBB, 0xAF, 0x32, 0x61, 0xE6, 0xE9, 0x7B, 0xE2, 0x57, 0xFF, 0x2C, 0x3E, 0xAD, 0x21, 0x90, 0x58,
-    0xE9, 0x4B, 0xF3, 0xD1, 0xE4, 0x5E, 0xCB, 0xE6, 0x81, 0xF3, 0x9B, 0xC8, 0xB7, 0x9F, 0x65, 0xBF,
-    0xC7, 0xAC, 0x6A, 0x02, 0x70, 0x7E, 0xEA, 0x24, 0x69, 0x59, 0x57, 0x0F, 0x14, 0xCD, 0x8E, 0xB8,
-    0xCF, 0xF6, 0xA6, 0x57, 0x8D, 0xD1, 0x66, 0x0C, 0x2E, 0x67, 0x92, 0xF1, 0xC0, 0xA1, 0xBE, 0x24,
-    0x76, 0xE1, 0xC4, 0xB7, 0xBA, 0xDB, 0xC8, 0x94, 0x56, 0x6C, 0x99, 0x3E, 0x34, 0x24, 0x09, 0xAE,
-    0xA6, 0x19, 0x00, 0x34, 0xE4, 0xE0, 0xD5, 0x5C, 0xAE, 0x25, 0x2A, 0x00, 0xA6, 0xEF, 0x58, 0x4E,
-    0x0C, 0x59, 0x53, 0xD6, 0x4E, 0x0F, 0x7E, 0x97, 0xD6, 0x35, 0xBF, 0x23, 0x82, 0x5A, 0x63, 0xD9,
-    0x09, 0x78, 0x93, 0x7F, 0xCC, 0x90, 0x9E, 0x0F, 0xE2, 0x9A, 0xA2, 0xA9, 0xFD, 0x57, 0x59, 0x1D,
-    0x78, 0xB7, 0xF2, 0xDF, 0x63, 0x65, 0xE8, 0xC3, 0xD2, 0xBD, 0xC4, 0x30, 0x78, 0xB5, 0x70, 0x3E,
-    0x83, 0xD8, 0xEC, 0xAF, 0x73, 0xE7, 0x6B, 0xA2, 0x1D, 0xC0, 0x5F, 0xF6, 0xA7, 0x84, 0x27, 0x25,
-    0xE2, 0xE1, 0xF4, 0xB3, 0x19, 0x0F, 0xAA, 0x6C, 0xDF, 0x4A, 0xEF, 0xD0, 0xE4, 0x13, 0x77, 0xE0,
-    0xF1, 0xE6, 0xD0, 0x46, 0xD2, 0xB3, 0x45, 0x6E, 0xAE, 0x09, 0xDA, 0x3B, 0xF6, 0x9E, 0xF0, 0xE5,
-    0x9A, 0xD2, 0x93, 0xA8, 0x8B, 0x3A, 0xA9, 0xE1, 0xB4, 0xB4, 0x83, 0x53, 0xBA, 0xA5, 0xDD, 0x52,
-    0xF9, 0xC8, 0x90, 0x3D, 0xF8, 0x46, 0x78, 0x25, 0xEA, 0xE4, 0xBF, 0x2A, 0x9F, 0xA7, 0x66, 0x82,
-    0x5F, 0x54, 0xA4, 0xBA, 0x01, 0x73, 0x8B, 0xCF, 0x78, 0x17, 0x80, 0x7E, 0xAF, 0xE6, 0xEB, 0xA7,
-    0xB1, 0xCC, 0x69, 0x40, 0x20, 0xD2, 0x19, 0xF2, 0x0F, 0x4D, 0x2A, 0x3D, 0xAA, 0x72, 0x66, 0x2A,
-    0x66, 0xCE, 0x9A, 0x4E, 0x4A, 0xB4, 0x4D, 0xB7, 0xEA, 0x7E, 0x44, 0xEF, 0xF9, 0x3C, 0x64, 0xF1,
-    0xCC, 0x74, 0x0E, 0x6E, 0x6A, 0xC9, 0x65, 0x7D, 0xD2, 0xCB, 0x2A, 0xFD, 0x3A, 0x96, 0x6F, 0x29,
-    0xE6, 0x8E, 0xB2, 0x4D, 0x28, 0xD0, 0x30, 0xDE, 0x64, 0x97, 0x94, 0xA2, 0xFB, 0x8C, 0xF2, 0x1A,
-    0x84, 0x14, 0x8F, 0xC7, 0xA8, 0xE6, 0xF2, 0xD1, 0xDB, 0x5C, 0x78, 0x36, 0x50, 0x42, 0x33, 0xA1,
-    0x8B, 0x68, 0x2C, 0x04, 0x58, 0x04, 0x77, 0x4B, 0x41, 0x3C, 0x1C, 0x10, 0xAC, 0x9C, 0x74, 0x5E,
-    0x38, 0x51, 0x9B, 0x74, 0xD0, 0x00, 0xF2, 0x40, 0x88, 0x45, 0x78, 0x12, 0xCB, 0x4F, 0xED, 0xDA,
-    0xA2, 0x11, 0xB0, 0xED, 0x01, 0xB3, 0x73, 0xCA, 0x4D, 0x6E, 0xEE, 0x58, 0xAC, 0x6B, 0xE4, 0xFC,
-    0x4F, 0x63, 0xD3, 0xC5, 0x99, 0xD0, 0xA2, 0xB6, 0x18, 0xD6, 0xC7, 0x43, 0xEB, 0x5A, 0xF5, 0xEB,
-    0x44, 0xB1, 0xBA, 0x1C, 0xD7, 0x95, 0x0E, 0xB0, 0x5E, 0x1E, 0x9D, 0x24, 0x60, 0xE7, 0x85, 0x7F,
-    0x90, 0x23, 0x7B, 0xCF, 0xBD, 0x3E, 0x08, 0x91, 0x1C, 0x18, 0x6A, 0xF5, 0x4C, 0x5A, 0x29, 0x95,
-    0xE8, 0xDC, 0x7C, 0x71, 0x84, 0xB1, 0xB0, 0xC1, 0xBF, 0x16, 0xFB, 0xB1, 0x5E, 0xC3, 0x3E, 0x3C,
-    0x0D, 0x76, 0x9E, 0x52, 0x11, 0x76, 0x43, 0x00, 0x60, 0x69, 0x8C, 0xDA, 0x26, 0x3E, 0x4A, 0x86,
-    0xDB, 0x14, 0x01, 0x18, 0xFE, 0x31, 0xBB, 0xA4, 0xF0, 0x24, 0x6B, 0x99, 0xAC, 0xF0, 0x38, 0x2B,
-    0xB2, 0x10, 0x53, 0xCF, 0xFE, 0x7E, 0x88, 0x25, 0xC8, 0x56, 0x5F, 0x63, 0x33, 0xB2, 0x99, 0x2F,
-    0x42, 0xE2, 0xD1, 0xC0, 0x98, 0x0F, 0x6A, 0xBB, 0x79, 0x52, 0x12, 0x3D, 0x6D, 0x4D, 0xAF, 0xB4,
-    0xA5, 0x7F, 0x71, 0xE4, 0x8E, 0xDD, 0xFC, 0xF8, 0x51, 0xAF, 0xB4, 0x3E, 0x85, 0x9F, 0x00, 0x71,
-    0x1F, 0x1A, 0xB3, 0x83, 0x1C, 0xE9, 0x87, 0x78, 0x82, 0x80, 0x27, 0xFC, 0xBC, 0x74, 0xCF, 0xAE,
-    0xBE, 0x0F, 0xBC, 0x60, 0x0D, 0xA6, 0x26, 0x5C, 0xEE, 0xFC, 0xFC, 0x62, 0x77, 0xCB, 0x04, 0x8B,
-    0x1E, 0x5E, 0xCE, 0xF3, 0x60, 0x5B, 0x43, 0xC5, 0x83, 0x05, 0x8F, 0x39, 0x46, 0xEE, 0x8F, 0x42,
-    0x0E, 0xC8, 0x09, 0xBB, 0x72, 0xCA, 0x35, 0x09, 0x5E, 0x8B, 0x79, 0xEC, 0x83, 0x07, 0x14, 0x17,
-    0xE2, 0xEF, 0xAF, 0x90, 0xDF, 0xAA, 0xD9, 0x87, 0xFF, 0x59, 0xB9, 0xC5, 0x93, 0x7A, 0xCE, 0x21,
-    0xD5, 0xA4, 0x16, 0x9B, 0xEE, 0x3B, 0xFD, 0x67, 0x65, 0xFC, 0xBB, 0xA9, 0x52, 0xFE, 0x1F, 0x5D,
-    0x50, 0xB1, 0x4E, 0x1B, 0x41, 0x10, 0x7D, 0x7B, 0x6B, 0xB2, 0xD8, 0x97, 0x68, 0x29, 0x9C, 0x02,
-    0x10, 0x3E, 0x4A, 0x84, 0x48, 0x4C, 0x91, 0x22, 0xC5, 0xED, 0xED, 0x22, 0x0A, 0x0A, 0x0A, 0x57,
-    0xFC, 0x04, 0x35, 0x05, 0xC5, 0x19, 0x1F, 0xF0, 0x01, 0xF9, 0x80, 0x34, 0xD4, 0x54, 0x29, 0x5C,
-    0x50, 0x18, 0xFB, 0x64, 0x17, 0x29, 0xD2, 0x9C, 0xC3, 0x0F, 0x6C, 0x47, 0x41, 0xC1, 0x0A, 0x9D,
-    0x84, 0x95, 0xEC, 0xDD, 0xB2, 0x6E, 0x99, 0x99, 0xE2, 0x8D, 0xF4, 0x66, 0xE6, 0xBD, 0x59, 0xC5,
-    0x82, 0x96, 0xCC, 0x30, 0x43, 0x35, 0x01, 0x54, 0xC2, 0x8C, 0x95, 0x47, 0xF9, 0x36, 0x7C, 0x44,
-    0x19, 0xAD, 0x31, 0x2E, 0xA3, 0xDE, 0x4C, 0x8B, 0x73, 0x14, 0x00, 0xB5, 0x9F, 0x06, 0xAF, 0x4F,
-    0x3F, 0xAA, 0xFD, 0x6E, 0x06, 0xEC, 0xDE, 0xFE, 0x74, 0xF5, 0xE9, 0xAD, 0x47, 0x4C, 0x35, 0xEF,
-    0x83, 0x07, 0x67, 0x79, 0x8D, 0x15, 0x08, 0xE7, 0xFA, 0x6D, 0xD2, 0xD3, 0x93, 0x3A, 0x7C, 0xCD,
-    0x85, 0x5F, 0x52, 0x0E, 0xAA, 0xBB, 0xEE, 0xD9, 0x57, 0xA4, 0x1F, 0x0C, 0xCB, 0xA8, 0x0A, 0xB5,
-    0xB4, 0xE7, 0x62, 0xD8, 0xB9, 0xEB, 0xF4, 0xD3, 0x6E, 0x49, 0x14, 0x81, 0xEA, 0xB0, 0xCC, 0x4A,
-    0x36, 0x2F, 0x13, 0x7E, 0x69, 0x52, 0x8A, 0x1C, 0x6B, 0x38, 0x56, 0xA2, 0xCF, 0xAF, 0x5E, 0x0C,
-    0xAF, 0x20, 0x33, 0xDC, 0xA0, 0x41, 0x30, 0xFC, 0x42, 0x8D, 0xF5, 0xAC, 0x70, 0x6A, 0xF8, 0x61,
-    0xF1, 0x91, 0x2E, 0x15, 0x4E, 0xB4, 0x74, 0xBF, 0xB3, 0xF1, 0x2F, 0xE2, 0xC5, 0x41, 0xA5, 0x9C,
-    0x6A, 0xC1, 0xB4, 0x0C, 0x16, 0xBE, 0xE3, 0xB3, 0x45, 0xC2, 0xAF, 0xFF, 0x1A, 0xE3, 0xAD, 0xF0,
-    0x3F, 0x2F, 0x66, 0x14, 0x51, 0x1D, 0x07, 0xD8, 0x49, 0x12, 0x11, 0x7F, 0xDB, 0x47, 0x83, 0xCF,
-    0xCC, 0x62, 0x14, 0xAF, 0xA2, 0x3D, 0x71, 0x63, 0x4F, 0x0F, 0x8B, 0x8B, 0x3A, 0xFC, 0x5F, 0x5C,
-    0x78, 0x48, 0x54, 0x54, 0xC6, 0xF1, 0xF7, 0xBD, 0x38, 0x8E, 0xBC, 0xBE, 0x95, 0x50, 0x5B, 0xC9,
-    0x7B, 0x97, 0x6A, 0x9D, 0xDA, 0x4D, 0x2D, 0xFC, 0x58, 0x7B, 0x79, 0x8A, 0xE5, 0x09, 0x6C, 0xE0,
-    0xA6, 0x35, 0xD0, 0x4E, 0x97, 0xB1, 0x83, 0x21, 0xA4, 0x0E, 0x9F, 0x0F, 0xCA, 0x91, 0x08, 0xE6,
-    0x68, 0xF8, 0x6F, 0xA1, 0x39, 0x22, 0x8F, 0xFF, 0x6C, 0xE4, 0xD4, 0x86, 0xCF, 0xEB, 0x6A, 0x6B,
-    0xEC, 0x1E, 0x8F, 0xEC, 0x5A, 0x0B, 0x03, 0xF7, 0xE4, 0xAA, 0xCF, 0x27, 0xEA, 0xBD, 0x03, 0x92,
-    0x81, 0x6A, 0xB0, 0x02, 0x3C, 0x47, 0x04, 0xEC, 0x2D, 0x2D, 0xB6, 0x70, 0x23, 0xAF, 0xAC, 0xAF,
-    0x08, 0x65, 0xCC, 0xF2, 0x94, 0x56, 0x5D, 0xF5, 0x06, 0xD5, 0x7C, 0x4D, 0x8C, 0xDE, 0xE6, 0x9D,
-    0xDF, 0x43, 0xD2, 0x23, 0xC6, 0x21, 0x52, 0x0A, 0x0B, 0xC9, 0xEB, 0x8D, 0x1C, 0x71, 0x0F, 0x39,
-    0x74, 0xB3, 0xB2, 0xD8, 0x43, 0x16, 0x30, 0xD0, 0x99, 0x97, 0x8C, 0x85, 0x62, 0x0F, 0x3E, 0x78,
-    0x8A, 0x6A, 0x62, 0xA0, 0x2E, 0xA0, 0x5C, 0xF6, 0xB0, 0x9B, 0x45, 0xC7, 0x07, 0xA3, 0xD0, 0x61,
-    0x66, 0x48, 0x39, 0x1B, 0xEC, 0x21, 0x07, 0x0B, 0xE8, 0x6E, 0x7A, 0xE8, 0x21, 0x3A, 0xA4, 0x40,
-    0x3B, 0x5E, 0x44, 0x46, 0xEB, 0x83, 0xBA, 0x7D, 0x67, 0x48, 0xC9, 0x07, 0x1F, 0x72, 0x30, 0x63,
-    0xD7, 0x9B, 0x83, 0x0E, 0x61, 0x36, 0xD2, 0xAA, 0x1B, 0xA1, 0x10, 0xAD, 0x50, 0x31, 0x47, 0x22,
-    0xF9, 0xF4, 0xF7, 0xFB, 0x3F, 0x7C, 0x3F, 0x66, 0x34, 0xB2, 0xA5, 0x48, 0x9E, 0x6C, 0x47, 0x7A,
-    0xF9, 0x92, 0xCF, 0xCB, 0x8F, 0xE7, 0xF9, 0x3F, 0xFF, 0x8F, 0xDF, 0xFF, 0xE3, 0xA1, 0x5A, 0x56,
-    0x4A, 0x8D, 0xF0, 0xF1, 0x2B, 0xA5, 0x2C, 0x9D, 0x2A, 0xE5, 0x36, 0x38, 0x5A, 0x50, 0xD3, 0xBF,
-    0x4C, 0xEB, 0x2E, 0xD0, 0x5A, 0xC7, 0x91, 0x72, 0x0A, 0x3F, 0x57, 0xEF, 0x38, 0x95, 0x7A, 0x4E,
-    0xB5, 0xF8, 0x25, 0xE2, 0x65, 0xB9, 0x52, 0x4E, 0xB5, 0xB2, 0xAC, 0xB4, 0x6E, 0x55, 0xA4, 0xBB,
-    0xA1, 0x01, 0xBF, 0x0C, 0x67, 0x7C, 0x0B, 0x0D, 0x8B, 0x68, 0xF0, 0xD1, 0xF0, 0xEA, 0x15, 0xDC,
-    0xE7, 0x57, 0xF8, 0x34, 0x6A, 0x19, 0x4F, 0xD8, 0x76, 0x2B, 0x15, 0x5D, 0x69, 0x95, 0x5B, 0x8C,
-    0xD4, 0xFC, 0x9F, 0x8D, 0x33, 0xEA, 0x04, 0x8F, 0xC5, 0x25, 0x3E, 0x1E, 0x6B, 0xF3, 0xB1, 0xAF,
-    0xCD, 0xDF, 0x54, 0xF9, 0x97, 0x57, 0x62, 0x47, 0xEB, 0x0A, 0x8F, 0xAD, 0xE7, 0xFA, 0x21, 0x67,
-    0x58, 0x29, 0x1A, 0x2A, 0xF3, 0x58, 0x6B, 0xD5, 0xC3, 0xCD, 0xDE, 0xC7, 0xA7, 0x94, 0x5B, 0xF3,
-    0xA8, 0xC3, 0x45, 0x5A, 0x17, 0x3E, 0x4E, 0x5B, 0x53, 0xB5, 0x53, 0x39, 0xB9, 0x8F, 0x5B, 0x2C,
-    0xF2, 0x09, 0xF6, 0x70, 0x7B, 0x73, 0x2B, 0x15, 0x7D, 0xFB, 0x87, 0xD8, 0xE5, 0x23, 0x54, 0xB4,
-    0xA9, 0x0B, 0xB6, 0x6A, 0x9E, 0xE0, 0x34, 0xDC, 0x0D, 0x72, 0x9E, 0xDB, 0x72, 0xD7, 0x9F, 0xDF,
-    0x3D, 0x84, 0xF3, 0x5B, 0x3C, 0x23, 0xF6, 0x53, 0x0E, 0xA6, 0x56, 0x93, 0x9B, 0xFA, 0x05, 0x7B,
-    0x40, 0xF2, 0x26, 0x1D, 0x7F, 0xD9, 0x61, 0xE3, 0x53, 0xF8, 0xA0, 0x29, 0x28, 0x31, 0x6C, 0x9C,
-    0x77, 0x5E, 0xA9, 0xE5, 0x79, 0xD2, 0xEF, 0xB0, 0xEB, 0x91, 0x0A, 0xD2, 0x56, 0x2D, 0xE1, 0xEE,
-    0xB5, 0x9F, 0xDB, 0x79, 0x84, 0xE9, 0x69, 0x4D, 0x1F, 0x39, 0xEC, 0xC8, 0xD0, 0x65, 0xFF, 0x43,
-    0x5B, 0xA6, 0x85, 0xA3, 0x59, 0xE1, 0xFC, 0xEA, 0xF3, 0xBC, 0xA9, 0x8A, 0x52, 0xB7, 0xF2, 0x4A,
-    0x15, 0x58, 0xA0, 0x56, 0x15, 0xC6, 0xCA, 0xE7, 0xD9, 0xF1, 0x06, 0xCE, 0x72, 0x4B, 0x2B, 0xC6,
-    0x29, 0x3D, 0x29, 0x55, 0xA8, 0x6D, 0x76, 0x98, 0x94, 0x4B, 0x06, 0x9A, 0x1C, 0x8E, 0x52, 0xE5,
-    0x9E, 0xEB, 0xF1, 0x04, 0x8C, 0x23, 0xC9, 0x43, 0x4E, 0xC1, 0x2A, 0xA6, 0x53, 0x1D, 0x45, 0xAF,
-    0x17, 0x96, 0x55, 0xA0, 0x6B, 0x57, 0xEB, 0xCB, 0x98, 0xB9, 0x30, 0xF6, 0xDE, 0xAD, 0xD4, 0x5A,
-    0xA4, 0xDC, 0x53, 0xE8, 0x4D, 0x00, 0x2A, 0x64, 0x35, 0x3A, 0xC0, 0x61, 0x16, 0xF8, 0xE0, 0x36,
-    0xED, 0x61, 0xE5, 0x5F, 0x4D, 0xD5, 0xD6, 0x58, 0x79, 0x57, 0x73, 0xD5, 0x66, 0x2A, 0xFA, 0x1E,
-    0xC6, 0x1A, 0x82, 0x7A, 0x0B, 0xA7, 0x49, 0x32, 0x7D, 0x43, 0x97, 0x7E, 0x8E, 0xA7, 0x62, 0x04,
-    0xEA, 0x53, 0x76, 0xB2, 0x4E, 0xEB, 0xF4, 0x88, 0xFA, 0xD7, 0xAD, 0x7F, 0xB5, 0x4A, 0x5E, 0x4E,
-    0xDB, 0x09, 0xF5, 0x7C, 0xDD, 0x04, 0x3A, 0xDD, 0x3B, 0x3B, 0x9F, 0xB6, 0x1B, 0xEA, 0x53, 0x18,
-    0xB9, 0x92, 0x39, 0xB7, 0x31, 0x2A, 0xB4, 0x3F, 0xEA, 0xFF, 0x20, 0x55, 0x41, 0xCC, 0xBB, 0x6D,
-    0x2B, 0x1B, 0x37, 0xAC, 0xD8, 0x30, 0xF9, 0x03, 0x4B, 0x6B, 0xF3, 0xC5, 0x99, 0xB7, 0x2B, 0xE1,
-    0x07, 0xBB, 0xF4, 0xEE, 0xFF, 0x72, 0x86, 0xAF, 0x62, 0xF2, 0xA5, 0xFF, 0x11, 0x5F, 0x39, 0xE6,
-    0x24, 0x57, 0x6E, 0xEE, 0x5D, 0x5F, 0xAD, 0x94, 0x97, 0x7B, 0x85, 0x8D, 0x2E, 0xA6, 0x38, 0x85,
-    0x62, 0x22, 0x5F, 0xA1, 0x92, 0xAF, 0x91, 0x7C, 0xFD, 0x3E, 0x08, 0x8B, 0x53, 0x92, 0x06, 0x5F,
-    0x41, 0x95, 0x55, 0x9C, 0xF9, 0x3C, 0x49, 0x6D, 0x3E, 0xFE, 0xE8, 0x2E, 0x81, 0xCB, 0x74, 0x9C,
-    0x61, 0x46, 0xC0, 0x95, 0x64, 0x4C, 0x10, 0x84, 0x53, 0xFD, 0x30, 0x5F, 0x77, 0x56, 0x5E, 0xB9,
-    0xB3, 0x4C, 0x6A, 0xE1, 0xEF, 0xBC, 0xF9, 0xAA, 0xE5, 0x37, 0xBB, 0x35, 0xA7, 0x6C, 0x9B, 0xAF,
-    0x8D, 0x5D, 0x5F, 0x43, 0xA3, 0x39, 0xC5, 0x6B, 0x42, 0x1D, 0x83, 0x8F, 0x4A, 0xCD, 0x4E, 0xF4,
-    0x6A, 0x4F, 0xC7, 0xC8, 0x85, 0x22, 0xAE, 0xAA, 0x71, 0x2A, 0x37, 0x37, 0xF2, 0xAA, 0x2A, 0xD9,
-    0x0E, 0x02, 0x6B, 0x64, 0x75, 0xD8, 0x7E, 0xFC, 0xA3, 0xF3, 0x32, 0x7D, 0x94, 0x80, 0x7E, 0x53,
-    0x4B, 0x7B, 0x14, 0x73, 0x1B, 0xA6, 0x22, 0xB4, 0xE9, 0x20, 0xBA, 0xF7, 0x6F, 0x57, 0xB5, 0xCA,
-    0x28, 0xB7, 0x2F, 0xF2, 0x62, 0x75, 0x18, 0x1F, 0x8B, 0xF7, 0xF4, 0x28, 0xC0, 0x09, 0x84, 0xC0,
-    0x92, 0xCE, 0xCD, 0xA6, 0x53, 0x59, 0xE8, 0x5F, 0x1A, 0xE4, 0x49, 0xAF, 0xA2, 0x02, 0xB7, 0xE8,
-    0xC1, 0x90, 0x16, 0x87, 0xE4, 0x50, 0x53, 0x78, 0xBC, 0xAD, 0xCF, 0xE7, 0x9F, 0x24, 0xA1, 0xD6,
-    0xD8, 0x2B, 0x76, 0xEA, 0xD7, 0xDB, 0x6C, 0x8B, 0xB8, 0x91, 0x27, 0xFB, 0x25, 0xAF, 0x30, 0x34,
-    0x63, 0x47, 0x7A, 0x6E, 0x92, 0x94, 0x44, 0x21, 0x49, 0x3C, 0x61, 0xE7, 0x65, 0x3C, 0x8B, 0x7F,
-    0x4B, 0x32, 0x46, 0x69, 0x0A, 0x45, 0xAF, 0x84, 0xC5, 0x44, 0x87, 0xEC, 0x9A, 0xCD, 0x40, 0x7F,
-    0x02, 0x8A, 0x65, 0x0D, 0x89, 0x42, 0x11, 0x31, 0xC2, 0xE2, 0xC8, 0xAE, 0xE6, 0x6E, 0x24, 0x12,
-    0xF4, 0x7E, 0xCE, 0x47, 0x73, 0xB7, 0xE5, 0x09, 0x11, 0xCF, 0xF5, 0x73, 0xEC, 0xFE, 0x4A, 0x24,
-    0xAB, 0xE5, 0x65, 0x5A, 0xEE, 0x90, 0x9B, 0x3B, 0x4C, 0x6E, 0x86, 0xDE, 0x79, 0xFA, 0x96, 0xAE,
-    0xAD, 0xC9, 0x84, 0x39, 0x39, 0xE6, 0xC6, 0xAA, 0x6D, 0x9C, 0x12, 0x7D, 0xBF, 0xE1, 0x58, 0xA9,
-    0xE6, 0xA0, 0x4A, 0x76, 0xF5, 0x2B, 0x8F, 0xF4, 0x0F, 0xF4, 0xF9, 0x43, 0x9A, 0x0A, 0x3A, 0xA4,
-    0x62, 0x81, 0x86, 0x6C, 0xC1, 0xC9, 0x98, 0x1B, 0x87, 0x64, 0x20, 0xBD, 0xB7, 0xA9, 0x0D, 0xFD,
-    0x1C, 0xF4, 0xB2, 0x1A, 0x9A, 0x85, 0xC8, 0xA7, 0x56, 0xBA, 0x49, 0xB2, 0x83, 0xF9, 0x45, 0x51,
-    0x4E, 0x26, 0xFB, 0x12, 0x37, 0x6B, 0x24, 0xCB, 0x3A, 0xC5, 0x9D, 0x5D, 0x71, 0xA4, 0x3F, 0x47,
-    0xA6, 0xCF, 0x0C, 0x75, 0x21, 0xB4, 0x70, 0xA8, 0x4A, 0xA0, 0x80, 0x49, 0x05, 0x6A, 0x67, 0xD5,
-    0x71, 0x20, 0x51, 0xFC, 0x18, 0x8D, 0xB1, 0x4A, 0x62, 0xF2, 0x67, 0x2F, 0x6C, 0x2F, 0xC2, 0x3F,
-    0xE9, 0x98, 0x4C, 0xD0, 0x49, 0xB1, 0x37, 0xA4, 0x80, 0x55, 0xCC, 0xB1, 0x0C, 0x37, 0x8D, 0x98,
-    0x04, 0x9E, 0xEF, 0x76, 0x42, 0x19, 0x8E, 0xC9, 0xA7, 0xE2, 0xB6, 0x6F, 0x73, 0x5A, 0x97, 0x78,
-    0x2F, 0x37, 0xE7, 0x6D, 0x1A, 0xAA, 0x5F, 0xDA, 0x27, 0xE8, 0x0B, 0x87, 0x76, 0x68, 0x65, 0x15,
-    0xAA, 0x53, 0xF8, 0xBB, 0xDF, 0xBC, 0x58, 0x50, 0xD9, 0x24, 0xF8, 0x89, 0x0F, 0x06, 0xB5, 0xA2,
-    0x14, 0xC4, 0xB4, 0xDA, 0x43, 0xFA, 0xBC, 0xA5, 0x5B, 0x18, 0xBA, 0x48, 0x48, 0x06, 0x2A, 0xE8,
-    0x1E, 0xD7, 0xE8, 0xD4, 0xCF, 0xDD, 0x12, 0x67, 0xBE, 0x83, 0x1E, 0x9E, 0xD8, 0x6D, 0x36, 0xFB,
-    0x4D, 0x68, 0x2D, 0xA8, 0x27, 0xFF, 0xA3, 0x55, 0x72, 0x63, 0x46, 0x9D, 0x02, 0x43, 0x63, 0xC3,
-    0xE0, 0xA8, 0x2D, 0x32, 0x0C, 0xB5, 0x0B, 0x1A, 0x56, 0x73, 0x6A, 0x11, 0xDC, 0x6F, 0x98, 0x5A,
-    0xE8, 0x7D, 0x34, 0xC4, 0xC9, 0xDD, 0x0C, 0x37, 0x76, 0x71, 0xA9, 0x0D, 0xA6, 0xB3, 0xC8, 0x78,
-    0xFC, 0xA6, 0xB4, 0x56, 0xCE, 0xDD, 0x57, 0xC1, 0x46, 0xBA, 0x74, 0xEE, 0x5E, 0x84, 0xC8, 0x5B,
-    0x1D, 0xF9, 0x9B, 0x77, 0x1C, 0x3E, 0xDC, 0xEF, 0x71, 0x6D, 0x4B, 0x63, 0x32, 0xBB, 0xB1, 0xA0,
-    0x80, 0x1B, 0xEC, 0x74, 0x2B, 0x7A, 0x03, 0x1D, 0x71, 0x8A, 0x48, 0x79, 0xE8, 0xC7, 0x91, 0x87,
-    0xB2, 0x7C, 0x3C, 0xF4, 0x04, 0x21, 0xE4, 0xC3, 0x1D, 0x89, 0x62, 0x0A, 0x47, 0x94, 0x89, 0x9B,
-    0x43, 0x11, 0x58, 0x95, 0x0B, 0xE2, 0x5E, 0xE2, 0x74, 0x9C, 0x54, 0x30, 0x7E, 0x7E, 0x4C, 0xED,
-    0x50, 0xB0, 0xB1, 0x62, 0xE3, 0x1A, 0x1B, 0x4F, 0x52, 0x65, 0xF8, 0x29, 0x1A, 0x9D, 0x1C, 0x8D,
-    0x60, 0xD1, 0x0D, 0x1A, 0x6C, 0x34, 0x2E, 0xC2, 0x58, 0xE2, 0x21, 0x68, 0x0C, 0x53, 0x6B, 0x5B,
-    0xB4, 0x54, 0x47, 0x15, 0xAF, 0xDF, 0xC4, 0x03, 0xBD, 0x5F, 0x50, 0x63, 0xD4, 0x9C, 0xE9, 0x25,
-    0x4A, 0xAD, 0xEF, 0x91, 0x3B, 0x2E, 0xB3, 0x2B, 0xAF, 0x0D, 0x53, 0xA2, 0xFF, 0x58, 0x60, 0x88,
-    0xE8, 0x34, 0xF5, 0x3C, 0x7A, 0xEE, 0xEE, 0x41, 0x32, 0x47, 0x4F, 0x9B, 0x29, 0x01, 0x7D, 0x77,
-    0x83, 0x9F, 0x5C, 0x3D, 0x3B, 0x20, 0x2A, 0x07, 0x53, 0xF2, 0x4C, 0x85, 0x19, 0x68, 0xC9, 0x89,
-    0x83, 0xC0, 0x1D, 0xB6, 0x5B, 0x0A, 0x66, 0xA6, 0xB2, 0x3C, 0xEC, 0x69, 0xA5, 0xC9, 0xB2, 0xD1,
-    0xDB, 0x2A, 0xC0, 0xD5, 0x21, 0x8D, 0x8B, 0x9F, 0x07, 0x38, 0x0D, 0xF0, 0x88, 0x08, 0xC5, 0x4B,
-    0x5B, 0x97, 0xDD, 0xAA, 0x22, 0x87, 0x7C, 0x1A, 0x9C, 0xF9, 0x3B, 0x3E, 0xCB, 0xD5, 0x22, 0xC1,
-    0xCE, 0x4E, 0xBF, 0x1A, 0x13, 0xC4, 0x44, 0xA6, 0x07, 0x7E, 0x4E, 0x48, 0x80, 0x29, 0xA4, 0xED,
-    0x02, 0x93, 0x00, 0x40, 0x80, 0xFF, 0x22, 0x30, 0x1E, 0xFE, 0x83, 0xBB, 0x00, 0xC6, 0xA8, 0x27,
-    0xB2, 0x38, 0x82, 0xCD, 0x2A, 0xFD, 0x3A, 0x2A, 0x5C, 0xDC, 0x47, 0x7F, 0x57, 0xFA, 0xB5, 0x10,
-    0xAB, 0x2F, 0x9F, 0xC7, 0xC8, 0x1B, 0x5B, 0x5F, 0x6C, 0x21, 0x4C, 0x35, 0xEC, 0x54, 0x59, 0xAB,
-    0xE0, 0x8D, 0x9C, 0x34, 0xA5, 0xEE, 0x40, 0x7F, 0x56, 0x40, 0x07, 0xA0, 0x04, 0x9F, 0x98, 0x25,
-    0xA8, 0x0C, 0x68, 0x82, 0xEA, 0x56, 0xDB, 0x67, 0x95, 0xF3, 0x09, 0x06, 0xFD, 0x7E, 0xAD, 0xFA,
-    0xA0, 0xCF, 0x4A, 0x1F, 0xEC, 0x6D, 0xFD, 0xC9, 0x30, 0xB3, 0x1E, 0x55, 0x91, 0x86, 0xF1, 0xF2,
-    0x44, 0xB7, 0xCC, 0xE9, 0x2A, 0xE9, 0x8E, 0xCF, 0x5D, 0x47, 0x14, 0x5F, 0xCB, 0xDD, 0x88, 0x27,
-    0xF8, 0x90, 0xAF, 0x88, 0x5F, 0xD4, 0x80, 0xD8, 0x15, 0x44, 0x01, 0x5E, 0xC1, 0x2E, 0x11, 0x01,
-    0xB5, 0xEC, 0x4C, 0x75, 0xAA, 0xD6, 0x06, 0x2E, 0xC9, 0x20, 0xEB, 0xD0, 0xAD, 0xE5, 0xF0, 0xD4,
-    0x9A, 0xFA, 0x2A, 0x48, 0x81, 0x9F, 0x54, 0xFF, 0x6A, 0x45, 0x8E, 0x6D, 0x8C, 0xB2, 0xFE, 0xAD,
-    0x6A, 0xE3, 0x83, 0xB4, 0x4A, 0x33, 0xB1, 0x72, 0x45, 0xAC, 0xBC, 0x1C, 0x53, 0x65, 0x97, 0x7B,
-    0xC4, 0x2A, 0x9D, 0x8A, 0x55, 0xCD, 0xC6, 0x45, 0x36, 0x06, 0x94, 0x20, 0x2F, 0xA7, 0x58, 0x95,
-    0x6C, 0xAC, 0xD9, 0x38, 0x66, 0xE3, 0x08, 0x62, 0xF5, 0x85, 0x10, 0x62, 0xE5, 0x02, 0x92, 0x6C,
-    0xD8, 0x3A, 0x87, 0x2A, 0x4B, 0x52, 0x4C, 0xEF, 0xC2, 0xBC, 0x35, 0x01, 0xA9, 0x2D, 0x5D, 0xB9,
-    0x98, 0xAF, 0x10, 0xB3, 0xDE, 0x89, 0xE2, 0xFF, 0x5F, 0xA5, 0x4A, 0x30, 0x75, 0x89, 0xF2, 0x00,
-    0x57, 0x7F, 0x5D, 0xA9, 0xDB, 0x38, 0x08, 0xE2, 0x00, 0x2C, 0x5F, 0xB5, 0xF6, 0x07, 0x38, 0xF0,
-    0xF2, 0xC5, 0x00, 0x12, 0xBC, 0xEE, 0x9E, 0x03, 0xD7, 0x39, 0xE5, 0x3B, 0x41, 0x0C, 0xF4, 0xEB,
-    0xE3, 0xD9, 0x27, 0xD5, 0x9D, 0xD2, 0x4F, 0xED, 0xD2, 0xDF, 0x82, 0x68, 0x8F, 0x20, 0x37, 0x54,
-    0x36, 0x40, 0xF9, 0x00, 0xDD, 0x06, 0x69, 0x16, 0x20, 0xE1, 0xD8, 0xD6, 0xE5, 0x53, 0x40, 0x9B,
-    0x99, 0xE6, 0x98, 0xCB, 0x41, 0x49, 0x01, 0x33, 0xE9, 0xF7, 0x08, 0x52, 0x76, 0x28, 0x9F, 0xA1,
-    0x48, 0xEA, 0x96, 0x20, 0x6F, 0x71, 0x4C, 0x04, 0x8F, 0xCD, 0x9A, 0x3F, 0x5A, 0x79, 0xA5, 0xA6,
-    0x50, 0x0F, 0xA8, 0xE6, 0x33, 0xCE, 0x9E, 0x35, 0x7B, 0xBA, 0xB0, 0x74, 0x23, 0xDC, 0x87, 0x9F,
-    0xFE, 0x6D, 0x2C, 0x02, 0x1A, 0x83, 0xDD, 0x81, 0x58, 0x7C, 0x30, 0x66, 0xEE, 0x55, 0x70, 0xDC,
-    0xE0, 0x4F, 0xA9, 0xCC, 0xA6, 0xFD, 0x2C, 0x71, 0x1B, 0xBB, 0x25, 0x6A, 0x4F, 0x30, 0x9F, 0xCA,
-    0xFF, 0x31, 0xBA, 0xEB, 0xDC, 0x26, 0x7B, 0x02, 0x67, 0x43, 0x2A, 0xD8, 0x18, 0xBC, 0x57, 0x11,
-    0xDD, 0x83, 0x70, 0x4E, 0x1D, 0xE2, 0x51, 0x2D, 0x38, 0x12, 0xF2, 0x9C, 0x14, 0x76, 0xC7, 0xBB,
-    0x77, 0x54, 0x52, 0xBC, 0x62, 0x25, 0x9E, 0x4A, 0xD9, 0x44, 0xC5, 0xF5, 0x31, 0x2D, 0x38, 0xB1,
-    0x35, 0xE6, 0x2E, 0xA2, 0x10, 0x3C, 0xA1, 0x5D, 0x9B, 0x5C, 0xDC, 0xD2, 0xD9, 0xC4, 0xCC, 0xAE,
-    0x88, 0x6D, 0x49, 0x61, 0x5B, 0x6A, 0xDA, 0x87, 0x01, 0x32, 0x6E, 0xCD, 0x7D, 0x5A, 0x63, 0x6F,
-    0x8E, 0x55, 0xD0, 0xEA, 0xA9, 0x83, 0x29, 0x18, 0xC0, 0xE9, 0x7D, 0x9F, 0x10, 0xBC, 0x64, 0x0C,
-    0x01, 0x46, 0x63, 0x93, 0x83, 0x31, 0x05, 0x5E, 0x6D, 0xD5, 0x60, 0x40, 0xFA, 0x55, 0xFE, 0x8B,
-    0xB5, 0xB2, 0xF3, 0x89, 0x82, 0x25, 0x66, 0xA7, 0xDD, 0x25, 0x29, 0xC5, 0x07, 0x0A, 0x69, 0x8F,
-    0xA9, 0x00, 0xBB, 0xC1, 0x70, 0x8B, 0xDD, 0xCE, 0x76, 0xBE, 0xF9, 0x8E, 0x98, 0x62, 0xA1, 0xD3,
-    0xD1, 0x78, 0x4A, 0x24, 0x81, 0x04, 0xB7, 0xD2, 0x28, 0x1E, 0xD5, 0x4E, 0xED, 0xFC, 0x0C, 0x58,
-    0xE1, 0xF9, 0xD7, 0x9C, 0xDA, 0x4E, 0x09, 0x1A, 0x08, 0x20, 0xD4, 0x23, 0xED, 0x1C, 0xE2, 0x54,
-    0x90, 0x63, 0x06, 0x44, 0x53, 0xF9, 0xB0, 0x8B, 0xD7, 0xAC, 0x8C, 0x88, 0xC6, 0xCB, 0xD1, 0x47,
-    0x87, 0x66, 0x08, 0xEA, 0x13, 0x5D, 0x6E, 0xA8, 0x14, 0xD6, 0x38, 0x37, 0x23, 0x91, 0x65, 0x5C,
-    0xB0, 0x41, 0x25, 0xEF, 0xBF, 0x8B, 0x4E, 0x5B, 0x77, 0xC9, 0xB4, 0x91, 0xA8, 0xF7, 0x66, 0x37,
-    0x4E, 0xE1, 0x89, 0xFE, 0x19, 0x3E, 0x50, 0x0B, 0xD2, 0x4A, 0xA7, 0x31, 0x00, 0xEA, 0x6F, 0x88,
-    0xDA, 0xCE, 0x2E, 0x70, 0x13, 0xD2, 0x4C, 0x63, 0x88, 0x1D, 0x2D, 0x77, 0x58, 0x74, 0x34, 0x04,
-    0x62, 0x06, 0x2E, 0x02, 0x27, 0xB9, 0xB7, 0xA0, 0x77, 0x2C, 0x71, 0x82, 0x37, 0xB6, 0x69, 0x72,
-    0x7E, 0x00, 0x71, 0xF2, 0xAF, 0x60, 0xAE, 0x82, 0x22, 0xBC, 0xDE, 0xAD, 0x82, 0x93, 0x31, 0x5B,
-    0xCA, 0x5A, 0xBD, 0x3E, 0xB9, 0xA7, 0xD5, 0x09, 0x43, 0x63, 0xAC, 0xD6, 0xCA, 0xE9, 0x99, 0xF7,
-    0xE6, 0xEB, 0xCB, 0xBA, 0xB1, 0xB2, 0x02, 0x56, 0x05, 0x30, 0x27, 0xA3, 0x75, 0xF0, 0xE9, 0xD7,
-    0xAB, 0xCE, 0x13, 0xF6, 0x2D, 0x28, 0x7F, 0xB3, 0x21, 0xD5, 0xE2, 0xB8, 0x89, 0x50, 0x32, 0x96,
-    0x51, 0x73, 0x8A, 0x1A, 0x32, 0x7A, 0x0B, 0x1D, 0x06, 0x71, 0x82, 0x8D, 0xDA, 0xE0, 0x59, 0x11,
-    0x2D, 0x57, 0x86, 0x1B, 0x63, 0x9A, 0x94, 0xD6, 0xE9, 0xC4, 0x82, 0xB8, 0xD0, 0x33, 0x80, 0x4C,
-    0xBD, 0xC1, 0x7B, 0x06, 0xEA, 0x3D, 0xA9, 0xDD, 0x1A, 0x0F, 0x26, 0xA0, 0x11, 0x3B, 0x3D, 0xCC,
-    0xA5, 0x50, 0xDF, 0x13, 0x70, 0x32, 0x16, 0x4A, 0xCB, 0xEE, 0x0B, 0x02, 0xA7, 0x0D, 0x2F, 0x45,
-    0xFA, 0x0D, 0xDD, 0x85, 0x3D, 0x68, 0x89, 0x1B, 0x04, 0xF9, 0x9E, 0x8D, 0x3D, 0xDD, 0x40, 0x6A,
-    0x31, 0x4E, 0xCD, 0x0D, 0xD1, 0x19, 0x35, 0x32, 0xEE, 0x75, 0x3A, 0x10, 0xBC, 0xFC, 0x80, 0x0D,
-    0x35, 0x17, 0x46, 0xDD, 0x4D, 0x81, 0xF2, 0x65, 0x86, 0x79, 0x6E, 0xE8, 0xF3, 0x51, 0x67, 0xC0,
-    0x72, 0x6B, 0x8C, 0x4C, 0x24, 0xAE, 0x9A, 0x92, 0x06, 0xD9, 0x8F, 0xD4, 0x13, 0xFF, 0x91, 0xA4,
-    0x4A, 0xC4, 0xD9, 0x83, 0x7E, 0xD1, 0xE6, 0x2F, 0x9D, 0x2A, 0x9D, 0x2A, 0x01, 0x52, 0x6A, 0x92,
-    0x1D, 0x47, 0x17, 0x32, 0x39, 0x93, 0xAB, 0x0F, 0x68, 0xC3, 0x29, 0x74, 0x2B, 0xDB, 0xF4, 0xAA,
-    0x1D, 0x7A, 0x37, 0x40, 0xCA, 0x21, 0xD6, 0xE0, 0x0F, 0x87, 0xCD, 0xD0, 0xE5, 0xA1, 0xEF, 0xEF,
-    0x0C, 0xBE, 0xD1, 0x84, 0xC2, 0x60, 0x4B, 0x60, 0xB9, 0x6B, 0x83, 0x77, 0x5F, 0x33, 0x32, 0xB4,
-    0x08, 0xBE, 0x04, 0xEE, 0x23, 0x84, 0x50, 0x26, 0x00, 0x20, 0x6E, 0x5D, 0xD6, 0x9F, 0x97, 0x0B,
-    0xD0, 0x48, 0x5F, 0x1F, 0x8D, 0xD9, 0x60, 0x10, 0xC4, 0x36, 0x88, 0x99, 0x30, 0xA6, 0x61, 0x8B,
-    0xE0, 0x28, 0x8C, 0x93, 0x61, 0xE6, 0x93, 0x19, 0x7E, 0x1E, 0xA8, 0xD7, 0x28, 0xF2, 0x35, 0x94,
-    0x7C, 0x24, 0x4A, 0x7B, 0x30, 0x2E, 0xE6, 0xE2, 0x07, 0x1D, 0xE8, 0xF3, 0x3C, 0x00, 0x64, 0xE7,
-    0xC1, 0x0A, 0x50, 0x24, 0x7F, 0xE9, 0xE4, 0x34, 0xB7, 0x94, 0x83, 0x48, 0x0E, 0x20, 0xFB, 0x3C,
-    0xD8, 0x90, 0x03, 0xBF, 0xE0, 0x81, 0xDB, 0xD8, 0x64, 0xF4, 0xDE, 0x26, 0xA9, 0x00, 0x3E, 0xA7,
-    0xE0, 0x5B, 0x28, 0x50, 0x0A, 0xB6, 0xBB, 0x2F, 0x46, 0x38, 0x6B, 0xD0, 0x18, 0x78, 0xC4, 0xD0,
-    0xD9, 0x47, 0xAB, 0xF5, 0x23, 0xBA, 0x21, 0x78, 0x56, 0x4D, 0x9A, 0xB1, 0xD3, 0xE8, 0x32, 0xDC,
-    0x75, 0xBB, 0x54, 0x5E, 0xF5, 0x15, 0xA3, 0x48, 0x45, 0x95, 0x43, 0x52, 0x56, 0xBE, 0xC9, 0x78,
-    0x98, 0xCE, 0x4D, 0x88, 0x40, 0x24, 0x41, 0xDC, 0xB1, 0x30, 0x66, 0x90, 0x60, 0x11, 0xEA, 0x1E,
-    0xC4, 0x0D, 0xF2, 0x2C, 0xF5, 0x6A, 0x87, 0x36, 0xD0, 0x23, 0xA6, 0xB2, 0x06, 0xA5, 0x04, 0x04,
-    0x12, 0x12, 0xC9, 0xE9, 0xD4, 0xA5, 0x3D, 0xD6, 0xEC, 0x9C, 0x45, 0x84, 0x4D, 0xF2, 0x10, 0xD0,
-    0xB5, 0xB4, 0x16, 0x09, 0xE8, 0x4C, 0x5C, 0x06, 0x21, 0xC2, 0xDC, 0x58, 0xAD, 0x01, 0xCB, 0x91,
-    0xEA, 0x5E, 0x11, 0xC7, 0x24, 0x12, 0xC0, 0x05, 0x25, 0x4E, 0x55, 0xC5, 0x1F, 0xC5, 0x55, 0x69,
-    0xA9, 0xE9, 0x39, 0xD4, 0x9E, 0x31, 0x38, 0x5C, 0x09, 0x14, 0x46, 0xEF, 0xA9, 0xA1, 0x49, 0x6E,
-    0x01, 0xA8, 0x4D, 0xCC, 0xAB, 0xB1, 0x3A, 0x20, 0x10, 0x65, 0x82, 0x98, 0xB1, 0x6B, 0x00, 0xA7,
-    0x9A, 0x21, 0x23, 0x2B, 0x63, 0xA7, 0xC8, 0x64, 0x51, 0x0A, 0x9D, 0xB9, 0x4D, 0xC5, 0xD9, 0xEE,
-    0xB3, 0x49, 0xB8, 0x09, 0xAF, 0x85, 0x84, 0x10, 0xC0, 0x11, 0x16, 0x37, 0xD0, 0xCF, 0x38, 0x2C,
-    0xB1, 0x81, 0x7F, 0x10, 0x9B, 0x1B, 0x64, 0x38, 0x0F, 0xDA, 0x33, 0x00, 0x39, 0x60, 0x97, 0x89,
-    0xE6, 0x5B, 0x13, 0x3A, 0x5A, 0xA0, 0xC2, 0x06, 0x88, 0x01, 0x54, 0x2A, 0x42, 0x60, 0xEE, 0x91,
-    0x7A, 0x7D, 0xE2, 0x7B, 0x9D, 0xC9, 0xC1, 0x00, 0x2A, 0xB9, 0xDB, 0x72, 0x00, 0x21, 0x0C, 0x02,
-    0x54, 0x2F, 0xA8, 0x00, 0xB5, 0xD2, 0xEB, 0x77, 0xF5, 0xBB, 0xAD, 0xB5, 0x2C, 0x5E, 0xF0, 0x61,
-    0xA5, 0xBE, 0x69, 0xCE, 0xD4, 0x8D, 0x53, 0x3E, 0x43, 0xE6, 0xB4, 0x6A, 0xA3, 0x10, 0xE9, 0xF7,
-    0xD7, 0x59, 0xED, 0xDE, 0xD2, 0x4D, 0x58, 0x7B, 0xCD, 0xB6, 0x72, 0x01, 0x81, 0xFD, 0x9F, 0x41,
-    0xB1, 0x5D, 0x84, 0x3D, 0xDB, 0x52, 0xD6, 0x0E, 0xB8, 0xFA, 0x46, 0xA5, 0xC2, 0x97, 0x21, 0x08,
-    0x41, 0x81, 0x1E, 0xDC, 0xEB, 0xA1, 0xF4, 0x0A, 0x46, 0x20, 0x33, 0x5D, 0x63, 0x48, 0x15, 0x91,
-    0xE8, 0x9A, 0x82, 0x67, 0xE3, 0xE5, 0x6B, 0xAA, 0x71, 0x7F, 0x79, 0x91, 0xEC, 0xE1, 0x16, 0xAB,
-    0x38, 0xDA, 0x70, 0x73, 0xA7, 0x5C, 0x53, 0x23, 0x17, 0x46, 0x49, 0x5F, 0xAC, 0x8D, 0xA3, 0x43,
-    0xF1, 0x59, 0x85, 0x62, 0xDE, 0x5E, 0x00, 0x15, 0x16, 0xDD, 0xC2, 0xB7, 0x60, 0xAF, 0xD7, 0x15,
-    0xC9, 0xE4, 0x16, 0xD2, 0xB1, 0xE9, 0x01, 0x1D, 0x1B, 0x50, 0x99, 0x1A, 0x81, 0x01, 0xD0, 0x46,
-    0x1C, 0x31, 0x45, 0x5F, 0xCA, 0xA7, 0x06, 0xE0, 0xCE, 0x71, 0xEC, 0xD8, 0x05, 0x76, 0x96, 0xB0,
-    0xE3, 0xE4, 0xD8, 0x39, 0x8B, 0x1D, 0x3F, 0x06, 0xC6, 0xAC, 0xE8, 0x4A, 0x60, 0xFE, 0x08, 0x02,
-    0xE9, 0x23, 0x8E, 0xE0, 0x1D, 0x3A, 0x1F, 0x82, 0x41, 0x96, 0x4E, 0x80, 0x4B, 0xAF, 0x60, 0xF4,
-    0xCF, 0xA9, 0x09, 0x85, 0x13, 0x0A, 0x50, 0xB9, 0xA1, 0xBA, 0x48, 0x05, 0x3F, 0x88, 0x9D, 0x7B,
-    0x85, 0x32, 0xC1, 0x06, 0x9D, 0x09, 0x9D, 0xA8, 0x2B, 0x00, 0xF1, 0xC0, 0x14, 0xE7, 0x35, 0x47,
-    0xDD, 0x10, 0x83, 0x48, 0x2C, 0x28, 0x0E, 0xD3, 0xA4, 0x75, 0xAB, 0xB0, 0x4C, 0xEA, 0x00, 0x5E,
-    0xB8, 0x97, 0x83, 0xA2, 0x6B, 0x5E, 0x7E, 0x49, 0xA9, 0xE7, 0xBD, 0x9C, 0x5C, 0xE8, 0x5D, 0xC1,
-    0xA3, 0xBD, 0xFF, 0xFC, 0x53, 0x62, 0x43, 0xD1, 0x66, 0xC1, 0x4B, 0xEF, 0xA2, 0x7D, 0xE4, 0x5D,
-    0xC6, 0x3D, 0xC7, 0x1E, 0x90, 0x90, 0xD5, 0x78, 0xF9, 0x86, 0x78, 0x0C, 0x51, 0x0C, 0x02, 0x5F,
-    0xF3, 0x8B, 0x24, 0xCD, 0x5A, 0xB7, 0x39, 0x62, 0x90, 0xFF, 0x02, 0x95, 0x14, 0x78, 0xB0, 0x3C,
-    0x6B, 0xB5, 0x4F, 0x09, 0x46, 0x05, 0xC3, 0x16, 0xD6, 0x5B, 0x85, 0x8A, 0x3A, 0x11, 0x2B, 0x4A,
-    0xD5, 0xE8, 0x84, 0x0A, 0xDE, 0x24, 0x95, 0xB3, 0x82, 0x72, 0xB3, 0x82, 0x6B, 0x5A, 0x47, 0xDF,
-    0x83, 0x8F, 0xD6, 0x41, 0xCA, 0x46, 0x20, 0xA9, 0x5F, 0xB8, 0x85, 0xD3, 0x61, 0xE7, 0x1E, 0x76,
-    0xE0, 0x28, 0xAF, 0xFB, 0xA7, 0x0A, 0xF7, 0xC3, 0x62, 0x49, 0x6D, 0xD4, 0xF0, 0x18, 0x08, 0xBF,
-    0x13, 0xBA, 0x0E, 0x85, 0x5A, 0xB2, 0xE1, 0xD4, 0xF4, 0x1A, 0x4C, 0x54, 0xA9, 0xD7, 0x2D, 0x46,
-    0x8E, 0x42, 0x65, 0x22, 0x88, 0x77, 0xF1, 0xBC, 0x43, 0x3B, 0xF3, 0x2A, 0x0F, 0x22, 0x06, 0x67,
-    0x4B, 0x17, 0x5B, 0xD0, 0xB4, 0xB8, 0x94, 0xB7, 0x07, 0xE7, 0x16, 0x00, 0xF7, 0xEB, 0xA0, 0xB4,
-    0x5B, 0xD4, 0x78, 0xCE, 0x12, 0xEE, 0x7A, 0x2B, 0x5E, 0xA2, 0xEC, 0x16, 0x40, 0x76, 0x68, 0xC1,
-    0x73, 0xC2, 0xC6, 0x82, 0x1F, 0x55, 0x44, 0x94, 0xCC, 0xC3, 0x59, 0x6B, 0x37, 0x59, 0xE3, 0x35,
-    0x5E, 0x11, 0xC4, 0xE8, 0x1B, 0x66, 0xFE, 0x2C, 0x3E, 0x80, 0xD9, 0x37, 0x0A, 0xD1, 0x62, 0xEE,
-    0x07, 0x30, 0xEA, 0x05, 0xB3, 0x17, 0x40, 0x15, 0x45, 0x84, 0x73, 0x20, 0xB5, 0x80, 0xE0, 0xBA,
-    0xB3, 0x68, 0x54, 0x8F, 0x70, 0x96, 0x53, 0x70, 0x55, 0x21, 0x11, 0x76, 0xB0, 0x94, 0x02, 0x4F,
-    0x29, 0x17, 0x4C, 0x65, 0x51, 0xC6, 0xDE, 0x41, 0xC3, 0x22, 0x1A, 0x7C, 0x3C, 0xD9, 0x85, 0xA8,
-    0x71, 0x94, 0xFF, 0x12, 0x73, 0x15, 0x40, 0x7D, 0xDE, 0x80, 0xEE, 0x69, 0x97, 0x0D, 0xB0, 0x71,
-    0x7B, 0x1F, 0xCE, 0x97, 0x86, 0x86, 0xB7, 0xB4, 0x3A, 0x5E, 0xAB, 0x7B, 0xB9, 0x7B, 0x51, 0xFD,
-    0x87, 0xCA, 0xFA, 0x45, 0xB1, 0x38, 0x56, 0x67, 0xC7, 0xC7, 0x43, 0x75, 0xDC, 0x7F, 0x19, 0x8E,
-    0xD4, 0x1B, 0x37, 0xDE, 0xA8, 0xAC, 0x32, 0xC9, 0xD1, 0xE8, 0x97, 0x68, 0xB4, 0x30, 0x73, 0x6E,
-    0xFA, 0x82, 0x5D, 0x79, 0x3D, 0x58, 0xF5, 0x7B, 0xD4, 0x78, 0x55, 0xD6, 0xB9, 0xFA, 0xB6, 0xAE,
-    0x02, 0x1D, 0x6F, 0x33, 0xD0, 0x0F, 0xE8, 0x90, 0xA2, 0x17, 0x1B, 0xE0, 0x6B, 0xCC, 0xD6, 0xC6,
-    0xCA, 0xAB, 0xA5, 0x20, 0x33, 0xF7, 0xFA, 0xCA, 0xB6, 0x69, 0x5A, 0xDF, 0x75, 0x56, 0x06, 0x16,
-    0x7B, 0x53, 0x97, 0x89, 0x36, 0x81, 0xBD, 0x8C, 0xDD, 0xD2, 0x10, 0xFF, 0xA0, 0xA2, 0x95, 0x1C,
-    0x41, 0xC5, 0xC2, 0x96, 0xB5, 0x80, 0x32, 0x2D, 0x5D, 0x67, 0xD0, 0xA0, 0xDD, 0x12, 0x77, 0xC3,
-    0x6A, 0x68, 0xE0, 0xC3, 0xC2, 0x2B, 0xFD, 0x3E, 0x4B, 0x05, 0x77, 0x1C, 0x8D, 0xC5, 0xDA, 0xDF,
-    0xC4, 0x67, 0x07, 0xA8, 0x15, 0x13, 0x03, 0x9B, 0x86, 0x87, 0x3C, 0xD4, 0x8E, 0xAD, 0x8B, 0xB0,
-    0xD3, 0x9D, 0x58, 0x92, 0x05, 0x75, 0xA8, 0x4E, 0x1A, 0xAF, 0xCF, 0x74, 0xBE, 0xDA, 0x1D, 0x6B,
-    0x9C, 0xDA, 0x98, 0x8C, 0x02, 0x26, 0xA3, 0x81, 0x62, 0xDD, 0x90, 0x88, 0x2F, 0xE7, 0x88, 0x00,
-    0x99, 0x60, 0x83, 0xE1, 0x67, 0x70, 0x44, 0x36, 0x44, 0x56, 0xBA, 0xFB, 0xED, 0x90, 0x7B, 0x87,
-    0xEE, 0x5D, 0xA5, 0x0E, 0x6D, 0xFE, 0xD0, 0x84, 0x30, 0xC3, 0x9E, 0x19, 0x14, 0xE8, 0xEF, 0x50,
-    0x05, 0x2F, 0xA7, 0xCE, 0x5F, 0x16, 0x12, 0xAA, 0x68, 0xD5, 0xE0, 0xB0, 0x11, 0x5C, 0x26, 0x90,
-    0xFD, 0x1D, 0xB5, 0x0C, 0x65, 0x40, 0x29, 0x14, 0x2D, 0x24, 0x79, 0xAE, 0xF7, 0xBF, 0xBF, 0x73,
-    0x06, 0x33, 0xBF, 0x08, 0x9D, 0x72, 0x3B, 0x5F, 0x77, 0x62, 0xEA, 0x11, 0x0C, 0x81, 0x8A, 0x84,
-    0xFA, 0x64, 0xEE, 0xF0, 0x10, 0x9E, 0x98, 0x40, 0x46, 0x92, 0xDE, 0xA1, 0x3B, 0x19, 0x36, 0x3E,
-    0x05, 0x64, 0x03, 0x62, 0xC5, 0x50, 0x1A, 0xCC, 0x53, 0x40, 0x1C, 0xCB, 0xB0, 0xFF, 0x12, 0xC5,
-    0x94, 0x3E, 0x7A, 0xCD, 0x60, 0x0D, 0xBA, 0x48, 0x54, 0x2F, 0x0E, 0x39, 0x00, 0xAE, 0x74, 0x4D,
-    0xF4, 0xA7, 0xA0, 0x49, 0x9C, 0xF2, 0x1A, 0x3D, 0x70, 0xA2, 0x29, 0x92, 0xEB, 0x90, 0xF1, 0x5A,
-    0x29, 0xC3, 0x72, 0x45, 0xD0, 0x4E, 0xD1, 0xE7, 0x3E, 0x1B, 0xBA, 0x35, 0xC2, 0xC5, 0xFE, 0xB5,
-    0x71, 0x08, 0xBB, 0x3F, 0xE6, 0x2C, 0x8F, 0x2D, 0x4C, 0xEB, 0x98, 0xF3, 0x8C, 0x7F, 0xED, 0x74,
-    0x23, 0x6D, 0x1B, 0xD8, 0x60, 0xB2, 0xC7, 0xB0, 0x24, 0xD7, 0xC6, 0x81, 0xC4, 0x04, 0x62, 0x31,
-    0xCB, 0xFB, 0x3F, 0x63, 0x4B, 0x60, 0x3E, 0xBA, 0xF4, 0xC5, 0x4D, 0x58, 0xFD, 0xDE, 0x05, 0x77,
-    0x7D, 0x43, 0x17, 0x09, 0xA3, 0x6D, 0x54, 0xA2, 0x1B, 0xC0, 0x51, 0x1E, 0x35, 0x54, 0x96, 0x9B,
-    0x30, 0x90, 0x4B, 0x03, 0x03, 0x2B, 0xE0, 0xFC, 0xA4, 0x85, 0x64, 0xD3, 0xFD, 0x74, 0x6A, 0x0F,
-    0xE8, 0xF8, 0xAA, 0xFE, 0x89, 0x6E, 0xB2, 0xCE, 0xD3, 0x1F, 0xE8, 0x12, 0x93, 0x45, 0x9C, 0x64,
-    0x09, 0x56, 0x29, 0xC4, 0xD8, 0x81, 0x80, 0xEB, 0x9F, 0xD5, 0x44, 0x6E, 0x7C, 0x53, 0x9B, 0xFC,
-    0x8C, 0x70, 0x83, 0xD0, 0xD1, 0x25, 0x90, 0x3B, 0xCE, 0xA6, 0xAF, 0x9B, 0x58, 0x4E, 0x1B, 0xE8,
-    0x55, 0xF4, 0x33, 0x05, 0xEA, 0xC2, 0x94, 0x48, 0x0A, 0xA6, 0x82, 0x16, 0x1E, 0x63, 0xA2, 0x42,
-    0xE5, 0xDF, 0x59, 0x05, 0x08, 0xC7, 0x3C, 0x2E, 0xFC, 0x17, 0xA1, 0xDE, 0x80, 0xEE, 0x79, 0x27,
-    0x8F, 0xB1, 0x11, 0x60, 0xD8, 0x36, 0x6A, 0xA2, 0x2E, 0x69, 0xA2, 0x3A, 0x82, 0x5A, 0xC1, 0xE5,
-    0x39, 0xED, 0xD3, 0x6F, 0xB0, 0x95, 0x6B, 0xC3, 0x19, 0x5C, 0xEE, 0xCC, 0x9D, 0x83, 0xDE, 0xEF,
-    0x7C, 0x12, 0x80, 0x93, 0x13, 0xB0, 0x8F, 0xCA, 0x5C, 0x60, 0x55, 0xE8, 0x67, 0x05, 0xC7, 0xF0,
-    0x61, 0x7E, 0x90, 0x9B, 0x8B, 0xAF, 0x6F, 0x48, 0x22, 0xD9, 0xC3, 0x09, 0xD6, 0x3D, 0x39, 0x87,
-    0x70, 0x87, 0xB8, 0xF6, 0xD7, 0xA7, 0x91, 0xAE, 0x21, 0x03, 0xFC, 0xD7, 0xB4, 0x79, 0x23, 0x63,
-    0x09, 0x9F, 0x75, 0xC8, 0x72, 0x84, 0xF3, 0xD1, 0xAD, 0x96, 0x5A, 0x3B, 0x76, 0x4A, 0x87, 0x7E,
-    0x6A, 0x63, 0xF4, 0x3F, 0xA0, 0x03, 0xC6, 0x11, 0x87, 0x43, 0x22, 0x21, 0xA3, 0x1D, 0xBF, 0x2A,
-    0xC1, 0x0E, 0xC2, 0xE1, 0x96, 0x52, 0x02, 0x8F, 0x72, 0x6E, 0x57, 0xB2, 0xC2, 0xE0, 0x29, 0xB6,
-    0x32, 0x84, 0xB7, 0x0E, 0x9B, 0x81, 0x5D, 0x6A, 0xE2, 0x75, 0xB5, 0xC6, 0xDD, 0x20, 0xA7, 0x85,
-    0xAD, 0x12, 0x00, 0x50, 0xB8, 0x90, 0xC5, 0xE4, 0xBE, 0x32, 0x07, 0x85, 0xC8, 0x9D, 0x3B, 0x7C,
-    0x11, 0xA0, 0xDE, 0x6A, 0x70, 0x9F, 0x62, 0x5D, 0x2D, 0xC1, 0x10, 0xE1, 0x6B, 0x1D, 0x47, 0xB0,
-    0x57, 0x13, 0x54, 0x00, 0x51, 0xB1, 0x01, 0x4F, 0xB4, 0xBE, 0x5C, 0xBA, 0xCD, 0xE1, 0x41, 0xE2,
-    0xAD, 0xC6, 0xDE, 0x64, 0xBC, 0x37, 0x3D, 0xFA, 0x4A, 0x29, 0x32, 0x3C, 0x7E, 0x9B, 0xE1, 0xC3,
-    0xF0, 0x25, 0x49, 0x61, 0xC5, 0x03, 0x5A, 0xB4, 0x62, 0x5B, 0x43, 0x97, 0xD7, 0x0C, 0x49, 0x62,
-    0x07, 0x2E, 0x9C, 0x5B, 0xA1, 0x73, 0x31, 0x11, 0x16, 0x81, 0xE3, 0x3A, 0xE1, 0xAC, 0xB5, 0xB3,
-    0x9A, 0xAA, 0x31, 0x3B, 0x62, 0xD7, 0xC1, 0x66, 0x03, 0x86, 0x61, 0x73, 0x68, 0x11, 0xEF, 0xB6,
-    0x2E, 0x10, 0x35, 0xAF, 0x00, 0xA0, 0x84, 0xCE, 0xCB, 0x6E, 0x56, 0x11, 0xCC, 0x80, 0x70, 0x28,
-    0x63, 0x0D, 0x5F, 0x06, 0x25, 0x32, 0x0D, 0xB8, 0x4D, 0x38, 0xE3, 0xD2, 0x8C, 0x99, 0xEF, 0xC6,
-    0xCD, 0x25, 0xD4, 0x11, 0xE2, 0x13, 0x61, 0x7F, 0xDD, 0xE5, 0xAD, 0x72, 0xBB, 0xC2, 0x8C, 0x97,
-    0xAB, 0x5D, 0x98, 0xEA, 0xFE, 0xE8, 0x90, 0xC8, 0x6A, 0x04, 0x1B, 0x33, 0xB0, 0x91, 0x30, 0x2C,
-    0x6C, 0x92, 0x5E, 0xBF, 0x31, 0xF2, 0xB0, 0xE2, 0x23, 0x4E, 0x13, 0xE6, 0xBD, 0x57, 0x05, 0xAA,
-    0x9E, 0x58, 0xE3, 0x65, 0xDA, 0x4A, 0x8C, 0x0F, 0x98, 0xF6, 0xC3, 0xCA, 0xDA, 0x81, 0xC0, 0x41,
-    0x3C, 0x6F, 0xC9, 0xAD, 0xEE, 0x55, 0xA2, 0x07, 0x42, 0xD3, 0x03, 0x9D, 0xFE, 0x9E, 0x2F, 0xF4,
-    0x4B, 0x49, 0xBF, 0x65, 0xA3, 0xA0, 0x5C, 0x3D, 0x71, 0x0E, 0x6A, 0x89, 0x33, 0xE6, 0x76, 0xB6,
-    0x79, 0x61, 0xCE, 0x7D, 0x08, 0x80, 0x73, 0x13, 0x78, 0x0B, 0xFA, 0x62, 0x05, 0xF4, 0xDD, 0x53,
-    0xB6, 0x73, 0xBA, 0x25, 0x38, 0x83, 0x69, 0x86, 0x10, 0x84, 0xF6, 0x8A, 0x39, 0xF7, 0x21, 0x74,
-    0x61, 0xB0, 0xDE, 0xD5, 0x95, 0x5C, 0xDD, 0x0C, 0x2A, 0xC8, 0xF8, 0x3E, 0xA2, 0xC4, 0x2D, 0x42,
-    0xA1, 0x93, 0x44, 0xD3, 0xB1, 0xF4, 0x2D, 0x11, 0x02, 0x31, 0x41, 0x1E, 0x0F, 0x19, 0x38, 0xE3,
-    0xC8, 0x5D, 0xC5, 0xA8, 0xC3, 0x73, 0x6B, 0x02, 0x13, 0x9D, 0x7C, 0x5D, 0x5D, 0xD8, 0x07, 0x26,
-    0xE2, 0xC0, 0xB0, 0x8E, 0x31, 0x22, 0x3A, 0x4D, 0x2E, 0x36, 0x23, 0x95, 0x44, 0xCA, 0x7B, 0x33,
-    0x56, 0x2F, 0x81, 0x86, 0x77, 0x56, 0x62, 0xE6, 0xF6, 0x37, 0x2F, 0x90, 0xA0, 0x8D, 0xF4, 0xC3,
-    0x6F, 0xD4, 0xB7, 0x66, 0x46, 0xC4, 0x30, 0x9F, 0x7F, 0xB3, 0x0D, 0xD5, 0x78, 0xA4, 0x16, 0x23,
-    0x75, 0x38, 0x2C, 0x95, 0xA0, 0x81, 0x52, 0x25, 0x50, 0xCD, 0xED, 0x0B, 0x6A, 0x7D, 0x51, 0x2D,
-    0x41, 0x27, 0x47, 0x37, 0x6B, 0x00, 0x2C, 0xC3, 0x78, 0x40, 0x22, 0x0D, 0x4C, 0x81, 0x75, 0x61,
-    0xD2, 0xDF, 0x63, 0xB5, 0x0B, 0x57, 0x81, 0x31, 0x14, 0x6B, 0xDF, 0x8D, 0x95, 0x35, 0x91, 0xCE,
-    0x9F, 0x56, 0xCB, 0x9D, 0xFF, 0x8B, 0x3A, 0xFA, 0x5E, 0xBA, 0x36, 0x73, 0x26, 0xE2, 0xA0, 0x63,
-    0xC4, 0xC4, 0x95, 0x3C, 0xD3, 0x3A, 0x87, 0xB4, 0x77, 0xF7, 0x10, 0x46, 0x60, 0xF2, 0x72, 0xB9,
-    0x57, 0xC3, 0x14, 0xFE, 0xC1, 0x34, 0x7B, 0xE3, 0xE8, 0xFC, 0x77, 0x3F, 0x23, 0x77, 0x3F, 0xA2,
-    0x5D, 0xCB, 0xC3, 0x22, 0x29, 0xBE, 0x18, 0x1B, 0x4B, 0x43, 0x77, 0xA4, 0x53, 0xA6, 0x28, 0x41,
-    0x91, 0xB2, 0x4A, 0x50, 0x93, 0x52, 0x67, 0x29, 0xB3, 0x00, 0x4E, 0x30, 0x26, 0x5E, 0x9C, 0x5C,
-    0xAC, 0x89, 0x9D, 0xC0, 0x36, 0x15, 0xB5, 0x15, 0xE1, 0x53, 0x20, 0x10, 0x6E, 0x4C, 0x04, 0xE5,
-    0xFE, 0x1C, 0xFA, 0xE4, 0x9E, 0x76, 0xE9, 0xC0, 0x15, 0x0B, 0x83, 0xE2, 0x06, 0x2A, 0xB4, 0xD1,
-    0xD5, 0x7E, 0x70, 0xA3, 0x45, 0xF3, 0x1B, 0xD5, 0x6F, 0xCC, 0x01, 0xE0, 0xCF, 0x19, 0x7D, 0x8D,
-    0xF8, 0x47, 0x37, 0x00, 0x40, 0xF0, 0x5D, 0xD8, 0xEC, 0x94, 0x34, 0x13, 0xFE, 0x39, 0x9E, 0x3D,
-    0xE2, 0xD9, 0x4E, 0x95, 0xD5, 0xE0, 0xC3, 0x97, 0x75, 0xA1, 0xA7, 0x69, 0x00, 0x02, 0x35, 0x9A,
-    0x28, 0x77, 0x6A, 0x3C, 0xC8, 0xAD, 0xE2, 0x1E, 0x0A, 0xBB, 0x9A, 0xA6, 0x4A, 0xAA, 0x56, 0xE0,
-    0xC7, 0x45, 0xA4, 0x97, 0xBE, 0xAB, 0x63, 0x87, 0x30, 0x64, 0x16, 0x1D, 0x99, 0x06, 0x46, 0xF6,
-    0x69, 0x4A, 0xA0, 0xD1, 0x3E, 0xD4, 0x55, 0x08, 0x73, 0x2A, 0x00, 0x7F, 0x34, 0x94, 0x64, 0x0C,
-    0x1E, 0x17, 0x6D, 0xBD, 0x3D, 0x05, 0xC0, 0x8F, 0x8D, 0x5C, 0xD5, 0x17, 0x94, 0x51, 0x07, 0xE2,
-    0x39, 0x4B, 0x9B, 0x04, 0x3F, 0xA5, 0x9E, 0xE5, 0xC8, 0x13, 0x46, 0xDA, 0xA5, 0x93, 0xC2, 0xE8,
-    0x2C, 0x41, 0x46, 0x21, 0x06, 0xFE, 0x3D, 0xC8, 0xC1, 0xB1, 0xFF, 0x33, 0x7B, 0x04, 0xBA, 0x1B,
-    0xB5, 0x49, 0x07, 0xF0, 0xDF, 0xF1, 0x11, 0x25, 0x84, 0x12, 0x04, 0x4A, 0x6D, 0xA6, 0x5E, 0xD0,
-    0x69, 0x08, 0x29, 0xD3, 0x1A, 0xE5, 0x98, 0x79, 0x62, 0x88, 0xE8, 0x1D, 0xFA, 0x36, 0x3F, 0x1A,
-    0xE6, 0xC3, 0x69, 0x06, 0x2B, 0x2C, 0x43, 0x21, 0x57, 0xE3, 0x14, 0x97, 0x69, 0x08, 0xEA, 0x76,
-    0x49, 0x17, 0xFF, 0x7B, 0x61, 0x0E, 0x20, 0x87, 0xAB, 0x80, 0xEA, 0x8D, 0x84, 0x55, 0xD6, 0x8D,
-    0xBD, 0x79, 0xA8, 0x1D, 0x7B, 0x62, 0x80, 0x4B, 0x79, 0x8E, 0x94, 0x0B, 0x30, 0x92, 0xAA, 0xB8,
-    0xF3, 0xCF, 0x26, 0xBC, 0xF1, 0x67, 0x9B, 0xB1, 0x12, 0xEF, 0x74, 0x52, 0x06, 0x84, 0xBE, 0x7D,
-    0xED, 0xAD, 0xBB, 0x9B, 0x29, 0x13, 0x27, 0x95, 0x7B, 0x3D, 0x59, 0x19, 0x5B, 0xF0, 0xF8, 0x7D,
-    0xF5, 0x3A, 0xAB, 0x1A, 0xBE, 0x80, 0xFB, 0xC7, 0x93, 0x33, 0x3F, 0x5A, 0x96, 0x62, 0x06, 0x76,
-    0x59, 0x4B, 0xE5, 0x51, 0x50, 0x1A, 0xF6, 0x10, 0xAE, 0x30, 0xF1, 0xB3, 0xC8, 0x54, 0xB0, 0x30,
-    0x0E, 0x5C, 0x01, 0x21, 0x79, 0xE4, 0x3B, 0x8F, 0x11, 0x80, 0x21, 0x32, 0x02, 0x22, 0x62, 0xA8,
-    0x5E, 0x3F, 0xB0, 0xCD, 0xF0, 0x31, 0xE1, 0x13, 0x9D, 0x57, 0x23, 0x87, 0x9F, 0x74, 0xFA, 0x5B,
-    0x84, 0x8E, 0x32, 0x44, 0x31, 0x02, 0x4E, 0x1E, 0x91, 0xED, 0xE5, 0xC3, 0x7F, 0x00, 0xDE, 0xB7,
-    0xA0, 0x9A, 0xF4, 0x79, 0x73, 0xE3, 0x59, 0x12, 0xA2, 0xBF, 0x2F, 0x09, 0x91, 0x48, 0x34, 0x63,
-    0x2E, 0x09, 0xC1, 0x0C, 0x5E, 0xF0, 0x63, 0x92, 0xEA, 0xB6, 0x84, 0xD1, 0x18, 0x54, 0x8F, 0xC2,
-    0x59, 0x12, 0x42, 0xCA, 0x4E, 0x3E, 0x33, 0x09, 0xB1, 0x8F, 0xDB, 0xB1, 0x04, 0x6B, 0x4C, 0x97,
-    0x63, 0x6B, 0x65, 0x85, 0xB1, 0xB9, 0xB6, 0xC3, 0x37, 0xDD, 0x0E, 0x3C, 0xA0, 0x21, 0xE6, 0xDF,
-    0xEB, 0x76, 0xF0, 0xEF, 0xD0, 0x4B, 0x18, 0x9F, 0xDB, 0x25, 0x8C, 0x61, 0x17, 0x4C, 0x64, 0xFC,
-    0x8D, 0x23, 0x41, 0x74, 0x78, 0xAD, 0xE3, 0x81, 0xA8, 0x60, 0x05, 0x31, 0x71, 0x4C, 0x97, 0x8A,
-    0xB5, 0x08, 0x63, 0x66, 0x71, 0x69, 0x5B, 0xF1, 0x33, 0xE1, 0xDD, 0x96, 0x4F, 0x0D, 0xF5, 0xF3,
-    0x4A, 0x06, 0xC2, 0xBE, 0x7D, 0xC2, 0x09, 0xF6, 0x05, 0x25, 0x65, 0xE9, 0x24, 0x1E, 0x6D, 0xE6,
-    0x71, 0xA2, 0x4F, 0x29, 0x7C, 0x1D, 0x63, 0xCC, 0x18, 0xAF, 0xF7, 0x7F, 0xC1, 0x89, 0xD4, 0x2B,
-    0x01, 0x58, 0x1F, 0x4C, 0xEC, 0xA7, 0x8B, 0xAC, 0xAA, 0x4A, 0x21, 0x91, 0xB8, 0x70, 0x14, 0xB0,
-    0x16, 0x80, 0xA1, 0xB2, 0xB5, 0xA1, 0xF0, 0x41, 0x6E, 0x17, 0xED, 0x2E, 0x8F, 0x59, 0x52, 0x52,
-    0x26, 0x41, 0x6B, 0xEC, 0xEC, 0xAC, 0xE6, 0xD3, 0x0C, 0xE4, 0x11, 0x75, 0x7F, 0x0A, 0xF2, 0x63,
-    0x46, 0xC7, 0x7A, 0x93, 0x30, 0x34, 0xCE, 0x8B, 0xC9, 0x41, 0x92, 0x83, 0x2A, 0x93, 0x1E, 0x35,
-    0x59, 0x50, 0x93, 0x84, 0xF4, 0xF3, 0x21, 0x3F, 0xCF, 0xB3, 0x19, 0xCF, 0x32, 0x59, 0x48, 0x5F,
-    0x0B, 0xEB, 0x49, 0xC9, 0x94, 0x1E, 0x6E, 0x62, 0x28, 0xE6, 0xD4, 0x92, 0x21, 0xD5, 0x11, 0x73,
-    0x81, 0x42, 0x05, 0x57, 0x14, 0x64, 0x38, 0x8B, 0x8C, 0x3A, 0x12, 0x0B, 0x7C, 0x5E, 0x1A, 0x5E,
-    0x53, 0xE2, 0xC6, 0x3B, 0x25, 0xA5, 0x3E, 0x67, 0xAF, 0x6E, 0xD6, 0xBB, 0xFD, 0x78, 0x4C, 0xBC,
-    0xD2, 0xAD, 0xA8, 0x17, 0x18, 0x83, 0x46, 0x82, 0x05, 0x50, 0xDB, 0x3A, 0x16, 0xFD, 0x12, 0xC4,
-    0x75, 0x2D, 0xD1, 0x02, 0xAB, 0xAE, 0xFD, 0x58, 0x14, 0x4C, 0x50, 0x81, 0x9E, 0x0C, 0x17, 0xD0,
-    0xAB, 0x8E, 0xA9, 0x61, 0x7E, 0x01, 0x98, 0x28, 0xC6, 0x49, 0xEA, 0x0B, 0xEB, 0x09, 0x70, 0x5D,
-    0xE4, 0x51, 0x39, 0x57, 0x6E, 0xD8, 0x53, 0x3E, 0xD3, 0x21, 0x8E, 0xDB, 0x8A, 0xC8, 0xB1, 0x1A,
-    0xA2, 0x9E, 0xB5, 0x60, 0xE0, 0xFF, 0xA8, 0x24, 0xEC, 0xC6, 0xC8, 0xA4, 0x04, 0x21, 0x85, 0x8C,
-    0xC4, 0x17, 0xC4, 0x16, 0x42, 0x03, 0x08, 0x21, 0x5A, 0xAC, 0x4C, 0x84, 0x2B, 0x9A, 0x0A, 0xCA,
-    0xB2, 0xA8, 0x23, 0xB1, 0x0E, 0xB3, 0xEA, 0x04, 0x42, 0xBE, 0x40, 0x37, 0xF7, 0xD5, 0x2E, 0x30,
-    0xF6, 0x79, 0x57, 0x4B, 0x04, 0x11, 0x7E, 0x15, 0x53, 0xB7, 0x3E, 0xD0, 0x78, 0xA4, 0x36, 0x5C,
-    0x9D, 0x55, 0xD1, 0x24, 0x5C, 0xFF, 0xA9, 0x99, 0xB1, 0x65, 0x7C, 0x2A, 0x1C, 0xFF, 0xCF, 0xC6,
-    0xA9, 0x22, 0x66, 0xC6, 0xE0, 0xFA, 0xDF, 0x83, 0x1D, 0xB1, 0x99, 0x0E, 0xAE, 0x1E, 0x9C, 0x19,
-    0x7B, 0x38, 0x5F, 0xFA, 0x29, 0x58, 0x0C, 0xF7, 0x0D, 0xF4, 0xAA, 0x66, 0xEC, 0x72, 0x4B, 0x41,
-    0x37, 0x4F, 0xAA, 0x14, 0x68, 0xAB, 0xCE, 0xE2, 0x92, 0x2F, 0x3E, 0xC0, 0x97, 0x96, 0x59, 0xB7,
-    0x0B, 0xD1, 0xC3, 0x6A, 0x03, 0x03, 0xB8, 0xC3, 0x54, 0x48, 0x04, 0x64, 0xF5, 0xB0, 0xD5, 0x8C,
-    0x0F, 0x2C, 0x6E, 0x7C, 0xCA, 0x70, 0x17, 0x76, 0xD7, 0x70, 0x5F, 0x20, 0xB4, 0x7C, 0x43, 0x2D,
-    0x07, 0x29, 0x79, 0x90, 0x81, 0xA8, 0x0D, 0xC9, 0xE9, 0xED, 0x3D, 0x18, 0x02, 0x79, 0x93, 0x0A,
-    0x99, 0x80, 0x01, 0xEB, 0x16, 0x3F, 0x33, 0xEC, 0x64, 0x3E, 0x27, 0x58, 0x6D, 0x22, 0xF3, 0x4F,
-    0x89, 0x91, 0x82, 0x9A, 0x4E, 0x4D, 0x8E, 0xF7, 0xFB, 0xB0, 0xE0, 0x84, 0x3D, 0xDA, 0x27, 0x9A,
-    0xF8, 0xDD, 0xED, 0xD3, 0x04, 0x83, 0xAF, 0x5E, 0x8F, 0xF7, 0x8B, 0x26, 0x4E, 0x52, 0x87, 0x69,
-    0x42, 0xCF, 0x23, 0x32, 0xA0, 0x84, 0xEA, 0xC1, 0xE3, 0x60, 0x97, 0x65, 0xE0, 0x82, 0x21, 0x58,
-    0x93, 0x2A, 0x25, 0xA9, 0xAC, 0x48, 0x65, 0x9E, 0x4D, 0xEA, 0x51, 0xA5, 0x82, 0x2D, 0x32, 0x11,
-    0x31, 0x7F, 0xBA, 0x73, 0x85, 0x49, 0xB8, 0xA1, 0x10, 0xD5, 0x9E, 0xE8, 0x0F, 0x7A, 0xD2, 0xAC,
-    0x69, 0x63, 0xA9, 0x1F, 0x4B, 0x50, 0xC9, 0xAC, 0xFC, 0x78, 0xE5, 0xEF, 0xC2, 0xA8, 0x39, 0xA9,
-    0x5B, 0x58, 0xE2, 0x20, 0xB9, 0x37, 0x7B, 0x6A, 0xE0, 0xC2, 0x2D, 0x8F, 0x01, 0x65, 0xD9, 0x0D,
-    0x0D, 0xDE, 0xE4, 0x13, 0x76, 0x6A, 0x2C, 0xC4, 0x32, 0x03, 0x6F, 0xCC, 0xED, 0xD9, 0x3F, 0xE8,
-    0x50, 0x0F, 0x9C, 0x6E, 0x5F, 0xFB, 0x27, 0x5E, 0x8B, 0xE2, 0x56, 0xBB, 0x32, 0x38, 0x43, 0x01,
-    0xB2, 0x67, 0x0C, 0x84, 0x3D, 0xE4, 0x5A, 0xFF, 0xC5, 0xE7, 0x1C, 0x4C, 0x6D, 0x8F, 0xCC, 0xBA,
-    0x20, 0x11, 0x11, 0x53, 0xD2, 0x06, 0x21, 0x9A, 0xF7, 0xAB, 0x9F, 0x70, 0xCD, 0x0C, 0x1C, 0x4E,
-    0xF1, 0xE2, 0xF1, 0xA8, 0x9F, 0x96, 0xA2, 0x96, 0xA4, 0xC2, 0xF7, 0x37, 0x09, 0xE8, 0x9E, 0x89,
-    0x85, 0x54, 0xEF, 0x28, 0x7F, 0xAC, 0x80, 0x66, 0x07, 0xBB, 0x73, 0x70, 0x05, 0x28, 0x7B, 0xA2,
-    0x57, 0x6B, 0xD3, 0xFC, 0xE9, 0x57, 0x1F, 0x0F, 0x06, 0xDB, 0xF3, 0x60, 0x69, 0x69, 0xB0, 0x59,
-    0xCF, 0x4D, 0xEC, 0x45, 0x1C, 0xEA, 0xD2, 0x6E, 0x71, 0x07, 0xC8, 0x1E, 0x94, 0x10, 0xC7, 0xC7,
-    0x47, 0x53, 0x63, 0xA8, 0xE8, 0xB9, 0x80, 0xD5, 0x16, 0x2F, 0xC5, 0xCA, 0xB9, 0xFD, 0x21, 0x33,
-    0xD5, 0x7F, 0x5B, 0x52, 0x71, 0x10, 0x6F, 0x5E, 0xCD, 0x58, 0x82, 0x01, 0x92, 0xAB, 0xF6, 0x1D,
-    0xD0, 0x2A, 0x7A, 0x1E, 0xE3, 0xF4, 0x2F, 0x9B, 0x52, 0xF2, 0x84, 0x97, 0x7B, 0x82, 0xE9, 0x7A,
-    0xE6, 0x77, 0x02, 0x8E, 0xD1, 0xD4, 0x9B, 0x8A, 0x03, 0x73, 0x18, 0xB6, 0x30, 0x62, 0x20, 0x01,
-    0x90, 0x37, 0x38, 0xEC, 0x02, 0x2B, 0x5A, 0xB7, 0xDF, 0x4B, 0xD5, 0xDA, 0xFF, 0xC8, 0x55, 0xB0,
-    0xC1, 0x49, 0x04, 0x8B, 0xDD, 0x7E, 0x1F, 0x0D, 0xFF, 0x1D, 0x7A, 0xE0, 0xC4, 0x08, 0x0E, 0x81,
-    0x9F, 0x5B, 0x95, 0x05, 0x80, 0x9A, 0x86, 0x74, 0x77, 0xDB, 0x09, 0x28, 0xD8, 0x7F, 0x6E, 0xB4,
-    0x3E, 0xC5, 0x7A, 0x94, 0x97, 0x9E, 0x68, 0x71, 0x90, 0x05, 0xBB, 0x17, 0x12, 0x0B, 0xEE, 0x36,
-    0x38, 0x87, 0x13, 0xFD, 0x8D, 0x36, 0xD1, 0x7F, 0x4C, 0xEB, 0xF1, 0x17, 0x7C, 0x12, 0xB3, 0x6E,
-    0x0C, 0x66, 0x3A, 0xBF, 0xC6, 0x1D, 0xC1, 0xC1, 0xCE, 0xC7, 0x24, 0xC9, 0x58, 0x9E, 0x08, 0x4C,
-    0x98, 0x52, 0xBE, 0x83, 0xCE, 0xAD, 0x23, 0x3D, 0x78, 0x27, 0x24, 0x8A, 0x4D, 0x94, 0xBB, 0xED,
-    0xB3, 0x88, 0xA3, 0x1D, 0x11, 0x2F, 0x5E, 0x80, 0x37, 0xE8, 0x94, 0x4E, 0x1E, 0x40, 0x9D, 0xB8,
-    0xA0, 0x27, 0x3D, 0xB0, 0xD6, 0x93, 0xB2, 0x0D, 0x9A, 0xFB, 0xE0, 0xEF, 0xA4, 0x8A, 0x9D, 0x46,
-    0xDE, 0xEA, 0x32, 0x91, 0xFF, 0x0D, 0x71, 0x5A, 0x3B, 0xF1, 0xA4, 0x5A, 0x9E, 0x4D, 0x1F, 0xDC,
-    0x95, 0x22, 0xCB, 0x80, 0xCA, 0x03, 0xCD, 0x7E, 0xA5, 0x8E, 0x01, 0x6A, 0x92, 0x40, 0x04, 0xB8,
-    0x93, 0x4C, 0x9B, 0xE5, 0xE9, 0xDE, 0x82, 0x5E, 0x2D, 0x92, 0xF7, 0xFF, 0x13, 0x06, 0x51, 0x45,
-    0x76, 0xE9, 0x73, 0x14, 0x6F, 0xD3, 0x07, 0xE1, 0x30, 0x14, 0x33, 0x08, 0x1C, 0x07, 0x26, 0xAD,
-    0x30, 0xA4, 0x8B, 0x04, 0x9F, 0x03, 0xC1, 0xE8, 0x32, 0x89, 0x31, 0x94, 0x7E, 0x56, 0x1E, 0x7B,
-    0xA0, 0x35, 0x44, 0xAD, 0xD4, 0x10, 0xD5, 0xD3, 0xE5, 0x08, 0x03, 0x3E, 0x13, 0xF9, 0xB1, 0x4C,
-    0x09, 0xB5, 0xC4, 0xF6, 0x9E, 0x56, 0x8F, 0x9F, 0x2C, 0xF8, 0x19, 0x93, 0x05, 0xBC, 0xDB, 0xFA,
-    0x04, 0x7E, 0x09, 0x02, 0x64, 0x41, 0x2F, 0x2C, 0xEB, 0xFC, 0x7A, 0x0F, 0x12, 0xC0, 0x50, 0x00,
-    0x94, 0x96, 0xDE, 0x8F, 0xA5, 0xFB, 0x44, 0x3F, 0xE8, 0xBF, 0x9B, 0xCA, 0x00, 0x9E, 0x33, 0x3F,
-    0x29, 0x33, 0xB2, 0x81, 0x10, 0x03, 0x25, 0x0C, 0x29, 0xA6, 0x3F, 0x99, 0x10, 0x95, 0xA1, 0xC6,
-    0x9E, 0xAB, 0xE6, 0x7F, 0x32, 0x65, 0x55, 0x6A, 0xA8, 0xAB, 0xE2, 0x88, 0xF5, 0x45, 0x8D, 0x71,
-    0x95, 0x18, 0xF2, 0xF5, 0x4B, 0x1C, 0xD6, 0x71, 0x8E, 0xC6, 0xFD, 0x06, 0xC6, 0x75, 0x2E, 0xE7,
-    0xA0, 0x19, 0x85, 0x6A, 0x94, 0x8C, 0x5A, 0x06, 0x2B, 0xC3, 0x36, 0x04, 0x90, 0x71, 0x7B, 0x3A,
-    0xCE, 0x1A, 0xDF, 0x64, 0x49, 0xA6, 0xE1, 0x22, 0x29, 0xDB, 0x97, 0x1A, 0x79, 0x65, 0x72, 0xF8,
-    0x22, 0x09, 0x92, 0xEF, 0x6F, 0xA7, 0x86, 0x79, 0x4B, 0xED, 0xF7, 0xE3, 0xDD, 0xBF, 0x95, 0xD5,
-    0x04, 0x99, 0x59, 0x59, 0x13, 0xFE, 0x52, 0x97, 0xF2, 0xA3, 0xD3, 0x0D, 0x15, 0x00, 0xA9, 0x5C,
-    0xE9, 0x56, 0xE6, 0xCA, 0xD6, 0x5C, 0x19, 0xC5, 0xF2, 0xA3, 0x00, 0x01, 0xB8, 0xE6, 0x55, 0xD6,
-    0x61, 0xE2, 0x05, 0x09, 0x70, 0xED, 0xC7, 0xD0, 0xAD, 0x78, 0xBE, 0x74, 0xC1, 0xF0, 0x82, 0x0A,
-    0x4B, 0xE3, 0x74, 0x9B, 0xA3, 0x6D, 0x93, 0xA5, 0x29, 0x87, 0x55, 0x33, 0x4A, 0x32, 0x35, 0x4A,
-    0xF2, 0x30, 0x12, 0x3B, 0x99, 0x1C, 0xFC, 0x89, 0x1C, 0x68, 0xFA, 0xC5, 0x4C, 0xBD, 0xE2, 0x00,
-    0x36, 0x37, 0xE5, 0x2F, 0x56, 0x2B, 0xA7, 0x31, 0xBE, 0x8A, 0x6B, 0xB6, 0xE4, 0xC0, 0xFD, 0x00,
-    0x80, 0x1E, 0xE7, 0x32, 0x83, 0x63, 0xD6, 0x37, 0x4C, 0x8C, 0x9F, 0xE9, 0x8B, 0x65, 0x62, 0x87,
-    0xA6, 0x9B, 0x81, 0xFC, 0x9E, 0x48, 0x93, 0x4D, 0x97, 0xF6, 0x19, 0x69, 0x95, 0x90, 0xC4, 0x8E,
-    0xF5, 0x43, 0x0A, 0x69, 0x22, 0x8E, 0xEF, 0x3F, 0x10, 0x34, 0x8D, 0xEC, 0x1A, 0xDE, 0x50, 0x45,
-    0x50, 0xC1, 0x7F, 0xE2, 0xBC, 0x5A, 0x0D, 0xA6, 0x66, 0xEC, 0x95, 0x6E, 0x09, 0x67, 0x30, 0x0D,
-    0x52, 0xA2, 0x06, 0x36, 0x13, 0xBB, 0x37, 0x2C, 0x58, 0x66, 0xF8, 0xD7, 0x2D, 0x42, 0x41, 0xF4,
-    0x84, 0x0C, 0xC1, 0x9B, 0xC0, 0x0F, 0x45, 0x48, 0xE1, 0xBD, 0x9B, 0x5D, 0xFF, 0x77, 0x98, 0xF0,
-    0x9B, 0xA4, 0xC7, 0x32, 0x71, 0x3C, 0x25, 0xD6, 0xDD, 0x61, 0x80, 0xE7, 0x58, 0xAA, 0x1A, 0x3F,
-    0x8B, 0x43, 0xA7, 0x1C, 0x3B, 0xC5, 0x9A, 0x5B, 0x00, 0x10, 0x8C, 0x60, 0xE9, 0x9D, 0xB2, 0xF5,
-    0xD3, 0x91, 0x8F, 0x9D, 0x02, 0x86, 0x7F, 0x51, 0xDA, 0x23, 0xA7, 0xAC, 0xED, 0x26, 0x00, 0x6F,
-    0xDC, 0xC9, 0x2E, 0xA7, 0xC2, 0x3F, 0x47, 0xE3, 0xD3, 0x4F, 0xBE, 0x14, 0xCD, 0x9B, 0x96, 0xA2,
-    0x71, 0x6E, 0x89, 0xA3, 0x28, 0xD0, 0x7F, 0xD4, 0x18, 0xAF, 0xD4, 0x6E, 0x1E, 0x3A, 0x9B, 0x15,
-    0xED, 0xCA, 0x66, 0x79, 0xE7, 0x15, 0x1C, 0x35, 0x60, 0x12, 0x80, 0x7D, 0x56, 0x59, 0x1E, 0x51,
-    0x9F, 0x6F, 0x9D, 0x5B, 0x39, 0x84, 0x65, 0x85, 0x35, 0xD6, 0x26, 0x4A, 0x83, 0x4A, 0x1C, 0x37,
-    0x7E, 0xC4, 0xBC, 0x5A, 0xAA, 0xB8, 0x18, 0x2B, 0x91, 0x9A, 0x93, 0x74, 0xA8, 0x2B, 0xC0, 0x7D,
-    0x48, 0xB5, 0x5D, 0xEB, 0x12, 0xB2, 0x1E, 0x16, 0x71, 0x95, 0x2E, 0x8F, 0x47, 0x1F, 0x0E, 0xE7,
-    0x76, 0x54, 0x8C, 0x09, 0x4D, 0x3A, 0x74, 0x11, 0x23, 0x77, 0xD5, 0x50, 0xD3, 0xED, 0x7C, 0x42,
-    0xC2, 0x32, 0x10, 0xA7, 0x44, 0xC4, 0x37, 0x3E, 0x6D, 0xE3, 0xC9, 0x6C, 0x60, 0x5A, 0x1E, 0x2A,
-    0xAD, 0xB7, 0xF1, 0x19, 0x69, 0xBD, 0x50, 0xED, 0xDD, 0x89, 0x96, 0xA9, 0xFF, 0xC0, 0x46, 0x9B,
-    0x17, 0x1E, 0x61, 0x2C, 0x04, 0xAD, 0xDE, 0x07, 0x1C, 0xCB, 0xAF, 0x26, 0x63, 0xE1, 0xA2, 0x30,
-    0x65, 0x96, 0xDF, 0x3C, 0x99, 0xB1, 0x2C, 0xB9, 0x93, 0xB1, 0x50, 0xDD, 0xDF, 0x1D, 0xB2, 0x77,
-    0x0B, 0xC9, 0xFF, 0x36, 0xA5, 0x8C, 0x0B, 0xAB, 0xA7, 0xEF, 0x1B, 0x4B, 0xBC, 0x67, 0x2C, 0x07,
-    0x56, 0x01, 0x98, 0x4F, 0xFD, 0x81, 0x66, 0xEA, 0x0B, 0xD0, 0x45, 0x15, 0x46, 0x81, 0xD3, 0xFA,
-    0x18, 0xA9, 0xC9, 0x9B, 0xFA, 0x27, 0x7A, 0x9A, 0x5C, 0xE6, 0x3C, 0xB2, 0xB3, 0xAF, 0xE3, 0xF3,
-    0xA5, 0x5D, 0x81, 0x0E, 0xDD, 0x84, 0x5C, 0xA4, 0x08, 0x5F, 0xFA, 0x3F, 0x96, 0x5B, 0x3E, 0x1C,
-    0x8E, 0x3A, 0x3C, 0x55, 0x78, 0xE5, 0xA2, 0x57, 0xBC, 0x0D, 0xC7, 0xCB, 0xAE, 0xFF, 0x39, 0x45,
-    0x7F, 0x4B, 0x99, 0x5A, 0x2F, 0xEA, 0x03, 0x4A, 0x6A, 0x23, 0xA6, 0xE3, 0xD1, 0x7E, 0x70, 0x76,
-    0x94, 0xB5, 0x3D, 0x14, 0xF2, 0xBA, 0xB3, 0x3A, 0x3B, 0xA3, 0x86, 0x07, 0xCD, 0x6B, 0xE2, 0xFF,
-    0xBE, 0x9A, 0x85, 0x6C, 0xD4, 0x05, 0x18, 0xD9, 0xEF, 0x30, 0xE6, 0xAD, 0xFD, 0xDE, 0xB9, 0x52,
-    0x9F, 0x85, 0x76, 0xF5, 0x8A, 0x32, 0x52, 0x2F, 0x84, 0xA7, 0x62, 0x52, 0xF6, 0x29, 0xA7, 0x32,
-    0x06, 0x47, 0xAC, 0x8F, 0x28, 0xA0, 0xD6, 0x98, 0x9E, 0xFB, 0x9B, 0x0F, 0xC9, 0x53, 0xA3, 0x49,
-    0xB2, 0xD5, 0x80, 0x78, 0xE1, 0x80, 0x21, 0xAD, 0xF8, 0x95, 0x5D, 0xDE, 0xCF, 0xE7, 0x5F, 0x07,
-    0xD9, 0x8B, 0x32, 0x9B, 0xF2, 0xFA, 0x68, 0xBA, 0xD0, 0x6A, 0x69, 0x0A, 0x54, 0x9E, 0x63, 0xE6,
-    0xF7, 0x25, 0x7D, 0x4E, 0x97, 0xCC, 0xF8, 0xB2, 0xE8, 0x4E, 0x4D, 0x77, 0x68, 0x58, 0x54, 0xF4,
-    0x51, 0xA6, 0x24, 0xF7, 0x6B, 0xFD, 0xE9, 0xEA, 0x5E, 0x29, 0x95, 0xA0, 0x5C, 0xA6, 0x27, 0x91,
-    0x24, 0xA9, 0xF8, 0x3C, 0x3B, 0xC9, 0x2E, 0x7F, 0xFD, 0x11, 0x47, 0x79, 0x82, 0xA3, 0x3C, 0xC1,
-    0x51, 0xFE, 0xF9, 0xEE, 0x51, 0xAE, 0x73, 0x30, 0x27, 0xA6, 0x9B, 0x67, 0xF7, 0xAF, 0xF6, 0x7C,
-    0x40, 0x06, 0xFB, 0x5B, 0x63, 0xB5, 0xF1, 0x5C, 0xA8, 0xFC, 0x7B, 0x17, 0x87, 0x0C, 0xF6, 0x0E,
-    0xF4, 0x04, 0x1A, 0x94, 0xBB, 0x27, 0x83, 0x3D, 0x28, 0x99, 0x54, 0x32, 0x84, 0x43, 0x44, 0x62,
-    0xDF, 0x0D, 0xD7, 0xE1, 0x49, 0x8D, 0x9D, 0xAC, 0xC2, 0x93, 0x45, 0x78, 0xB2, 0x06, 0x4F, 0x82,
-    0x48, 0x0F, 0xDC, 0x84, 0x5C, 0x82, 0x67, 0x56, 0xE0, 0xED, 0x93, 0x55, 0xA9, 0x26, 0x18, 0x41,
-    0xB0, 0x41, 0x0B, 0x63, 0xE6, 0x30, 0xAA, 0xE9, 0xDF, 0x62, 0xD0, 0xA5, 0x0E, 0x4A, 0x38, 0x22,
-    0xC1, 0x03, 0x53, 0x28, 0x9F, 0x91, 0x55, 0x91, 0x70, 0xB6, 0xE2, 0xE2, 0x53, 0x3C, 0x31, 0x23,
-    0xFA, 0x8F, 0x3D, 0x59, 0x55, 0xE5, 0x97, 0x5F, 0x85, 0x0C, 0x05, 0x57, 0x68, 0x91, 0x23, 0x9F,
-    0x31, 0xCD, 0x6E, 0x49, 0xD0, 0xA4, 0x48, 0xCF, 0x15, 0xD9, 0xAA, 0x33, 0xD7, 0x57, 0x56, 0x4E,
-    0x8B, 0x06, 0x33, 0x46, 0x5A, 0xCC, 0xE8, 0x44, 0xA9, 0xF8, 0xB2, 0x0D, 0x64, 0x1B, 0xEE, 0xAC,
-    0xFC, 0x48, 0x04, 0x1E, 0x4F, 0x38, 0x66, 0x72, 0xDE, 0x2B, 0x13, 0xBF, 0xC2, 0xD3, 0xB2, 0xB2,
-    0x4B, 0xC5, 0x0D, 0xA6, 0x19, 0x93, 0xF1, 0xEE, 0xBB, 0xA5, 0x6A, 0x97, 0x36, 0xB0, 0xC3, 0xC0,
-    0xB6, 0x04, 0x87, 0x84, 0x77, 0xB6, 0x26, 0xB1, 0x55, 0xA9, 0x6B, 0xEC, 0xE3, 0x67, 0x19, 0x75,
-    0x48, 0xA5, 0xBA, 0x52, 0xB2, 0x86, 0xBF, 0xBD, 0xB1, 0x88, 0x83, 0x66, 0xD2, 0x2D, 0x26, 0x59,
-    0x64, 0x44, 0x68, 0x28, 0x84, 0xCD, 0x9F, 0xE4, 0x40, 0xE5, 0xF6, 0xF5, 0x44, 0x51, 0xF3, 0x01,
-    0x5C, 0x60, 0xA5, 0x7E, 0xFF, 0x91, 0x17, 0x0E, 0xCF, 0x52, 0x4D, 0xB9, 0xA8, 0x1F, 0xDB, 0x24,
-    0x87, 0x55, 0xF2, 0x4A, 0x63, 0xB0, 0x70, 0xBD, 0xA7, 0xC4, 0x72, 0x52, 0x18, 0x0F, 0x9A, 0xBA,
-    0xBA, 0xB1, 0xC1, 0x43, 0x34, 0x25, 0xD8, 0x18, 0x87, 0x1A, 0xEA, 0x93, 0x05, 0x31, 0xCA, 0x2C,
-    0x2F, 0x97, 0x85, 0xE8, 0xD4, 0x28, 0x27, 0x4D, 0x31, 0xBE, 0x93, 0xB7, 0xD2, 0xE1, 0xF5, 0xE4,
-    0xD5, 0xDC, 0x2C, 0x9D, 0x91, 0xA5, 0x7F, 0x37, 0x76, 0x0C, 0xE2, 0x69, 0x4D, 0x6A, 0x9B, 0xCE,
-    0x22, 0x20, 0x11, 0x10, 0x6C, 0xCC, 0x8C, 0x48, 0x05, 0xDA, 0x0B, 0x5E, 0xED, 0x19, 0x1E, 0x88,
-    0x08, 0x8A, 0x19, 0x79, 0xB0, 0x3B, 0xC5, 0xC2, 0x89, 0x34, 0x2A, 0x64, 0x51, 0x92, 0x63, 0xD2,
-    0xFA, 0x4C, 0xF8, 0xD8, 0x39, 0x03, 0x59, 0x2E, 0x0B, 0x10, 0x31, 0x1B, 0x84, 0x90, 0x76, 0x2F,
-    0x62, 0xF4, 0x87, 0x93, 0xAC, 0xD0, 0x41, 0x95, 0x09, 0x82, 0x27, 0x5E, 0x04, 0x6B, 0x44, 0xEF,
-    0xA1, 0x7F, 0xF4, 0xEC, 0xA2, 0xBF, 0x71, 0x58, 0x6F, 0x62, 0x0A, 0x4C, 0x39, 0x7F, 0x80, 0xCB,
-    0xB8, 0x7A, 0x8D, 0xF1, 0x91, 0x1D, 0xF1, 0xE5, 0x62, 0xA5, 0xDF, 0xE2, 0xAA, 0x6D, 0xC0, 0x12,
-    0xC9, 0x31, 0x48, 0x9A, 0xAB, 0x95, 0x62, 0x58, 0x98, 0x31, 0x71, 0x73, 0xE8, 0xD5, 0x78, 0x0C,
-    0x7E, 0x6A, 0x39, 0xC7, 0xB0, 0xA9, 0x33, 0xC1, 0x10, 0x8C, 0x6D, 0x8A, 0x48, 0x87, 0x26, 0xFE,
-    0xFE, 0x3B, 0xBA, 0xF2, 0x6E, 0xEA, 0x34, 0x7B, 0xA3, 0x66, 0x95, 0xC8, 0xA2, 0x0A, 0x5E, 0x2C,
-    0xD5, 0xBA, 0xAF, 0xAC, 0x9D, 0x1D, 0x49, 0x5F, 0x05, 0xDF, 0xD7, 0xF1, 0xBA, 0x4A, 0x60, 0xFB,
-    0xE0, 0x9E, 0x58, 0x4D, 0x10, 0x3B, 0xB7, 0x75, 0xEA, 0x67, 0x3A, 0x1E, 0xCD, 0xEA, 0x51, 0x23,
-    0x13, 0xDF, 0x4C, 0x00, 0x6C, 0x9B, 0xC1, 0x4A, 0x1C, 0xCC, 0xC2, 0xA7, 0x4E, 0x16, 0x3E, 0xFD,
-    0xAB, 0x78, 0xD0, 0x7B, 0x22, 0x59, 0xC6, 0x4B, 0x17, 0xAE, 0x94, 0x44, 0xC6, 0x97, 0x4C, 0xE6,
-    0x5C, 0xE4, 0x30, 0x60, 0x37, 0x59, 0xC6, 0xCB, 0xA4, 0xB9, 0x94, 0x19, 0x1E, 0x67, 0x19, 0x42,
-    0x81, 0x1D, 0xD6, 0x1A, 0x3A, 0x24, 0xFB, 0x59, 0x49, 0x8F, 0x04, 0xB1, 0xA4, 0xCA, 0x3B, 0xF0,
-    0x2E, 0xE3, 0x11, 0x97, 0x63, 0x03, 0x7E, 0x02, 0x35, 0x60, 0x94, 0xC5, 0xC9, 0x2A, 0x84, 0xC3,
-    0xEA, 0xA0, 0x83, 0x14, 0xD8, 0x21, 0x1B, 0xB4, 0xB3, 0x55, 0xDD, 0x41, 0x3C, 0x05, 0x0A, 0xE2,
-    0x10, 0x66, 0xDD, 0xE0, 0x9E, 0x3E, 0x76, 0x90, 0xC2, 0xA2, 0xAF, 0x4E, 0x57, 0xC1, 0xF8, 0xC3,
-    0xE3, 0x79, 0x46, 0x72, 0x9B, 0x61, 0x39, 0x8C, 0x77, 0x41, 0xA9, 0xDF, 0x56, 0xA4, 0xA6, 0x9A,
-    0xE9, 0xD2, 0xB5, 0x39, 0xE5, 0x3A, 0x0B, 0x13, 0x5B, 0xB9, 0x7A, 0x62, 0x65, 0x9D, 0x83, 0x9D,
-    0x2D, 0x26, 0x69, 0xEC, 0xB7, 0xA7, 0xE1, 0xA0, 0x83, 0xC0, 0x61, 0x9D, 0x92, 0x82, 0xCC, 0xE1,
-    0x35, 0x19, 0xF9, 0xA4, 0x86, 0x51, 0x36, 0xD2, 0x0B, 0xFA, 0x7F, 0x8F, 0x59, 0x81, 0x67, 0xA4,
-    0x67, 0x6D, 0x20, 0xA1, 0xA0, 0xDB, 0x72, 0x57, 0xAE, 0xF4, 0xB7, 0xB7, 0xAE, 0xB0, 0x9F, 0x5F,
-    0x57, 0xB8, 0x75, 0x7F, 0x40, 0x24, 0x9C, 0x07, 0xE4, 0x5F, 0x7F, 0x72, 0xA5, 0xC1, 0x57, 0x99,
-    0x1F, 0xAC, 0xA7, 0x51, 0x98, 0xD1, 0x94, 0xBF, 0x04, 0x9F, 0xDA, 0xF9, 0x4C, 0xDB, 0xDD, 0x06,
-    0xFC, 0xCD, 0x41, 0xCC, 0x31, 0xE1, 0xEF, 0xA7, 0xEF, 0xB8, 0xB0, 0xC1, 0x43, 0x6A, 0xC5, 0x2E,
-    0x1D, 0x59, 0xFE, 0x80, 0x1B, 0xDB, 0xDD, 0x99, 0x62, 0x62, 0x52, 0xAD, 0xB9, 0x65, 0xB2, 0xA2,
-    0x63, 0xE4, 0x45, 0x19, 0xE6, 0xDD, 0x06, 0x89, 0x70, 0x80, 0xA0, 0xA3, 0x5F, 0x09, 0x92, 0x96,
-    0xA0, 0x58, 0xC1, 0xDF, 0xD6, 0x48, 0x13, 0x3F, 0xA5, 0xC6, 0x37, 0x79, 0x79, 0x79, 0xBB, 0xC3,
-    0x9D, 0x6F, 0x36, 0xF2, 0x5E, 0x8D, 0x5C, 0xF9, 0xBF, 0xDC, 0xEC, 0xA4, 0x38, 0xA9, 0x22, 0xC1,
-    0x22, 0xCA, 0x0B, 0xE8, 0x3D, 0x26, 0x8F, 0xAD, 0xEE, 0x60, 0x0C, 0xEF, 0x73, 0x05, 0x78, 0xFB,
-    0x45, 0xF5, 0x02, 0xDA, 0x6A, 0x98, 0xBC, 0xC2, 0xE9, 0x7B, 0xB8, 0x44, 0xE9, 0x34, 0x55, 0x9B,
-    0x74, 0x80, 0xC1, 0xAD, 0xEA, 0xB8, 0xAE, 0xD0, 0x29, 0xDD, 0x78, 0xC8, 0x3A, 0x2E, 0x30, 0xB4,
-    0x82, 0x61, 0x5D, 0x84, 0x9D, 0xE3, 0xE2, 0x97, 0x16, 0x57, 0x56, 0x41, 0x1E, 0x15, 0x91, 0xBE,
-    0xD5, 0x46, 0x6D, 0x94, 0x1F, 0xE5, 0x28, 0x16, 0xB8, 0xB1, 0xC4, 0x8A, 0x87, 0x97, 0x59, 0xC7,
-    0xD4, 0xF8, 0xF9, 0xEE, 0x5C, 0xFC, 0xC1, 0xBF, 0x00, 0xE0, 0x90, 0xFA, 0x2A, 0xD7, 0xD8, 0x5B,
-    0x6D, 0x50, 0xD8, 0xC5, 0xC9, 0x59, 0x4F, 0x1E, 0x77, 0xAC, 0xF3, 0xF1, 0xCD, 0xDC, 0x7C, 0x91,
-    0x7D, 0x1A, 0x4A, 0x97, 0x7D, 0xA3, 0x64, 0x2E, 0xD6, 0x0F, 0x52, 0xF2, 0xCF, 0x25, 0xB1, 0x98,
-    0xEE, 0x65, 0xE3, 0x5D, 0xBB, 0xC6, 0x88, 0x05, 0xDF, 0x3D, 0x4D, 0xF0, 0x26, 0xD5, 0xC1, 0x63,
-    0x8B, 0xB7, 0x70, 0xAE, 0xBF, 0x2A, 0x60, 0x4F, 0x40, 0x99, 0x75, 0x77, 0xB3, 0x17, 0xCD, 0x07,
-    0x5A, 0x3D, 0x8D, 0xB9, 0xC2, 0x55, 0x8B, 0x2C, 0xD1, 0x48, 0xED, 0x0A, 0xF3, 0xBA, 0x6D, 0x9D,
-    0xF9, 0x4B, 0xCD, 0x50, 0x5A, 0x1F, 0x31, 0xA6, 0x49, 0x89, 0x67, 0x6C, 0x2B, 0xE8, 0x1D, 0x5D,
-    0xF8, 0xF7, 0x76, 0xB4, 0x3E, 0x55, 0x7B, 0x9D, 0xC5, 0xBA, 0x85, 0xD4, 0xBF, 0x4C, 0x5C, 0x06,
-    0x79, 0x8A, 0x2C, 0x30, 0xDF, 0xB7, 0xC5, 0xC9, 0xD6, 0x77, 0xFF, 0xDA, 0xEA, 0xFF, 0x0D, 0xE3,
-    0xF4, 0x46, 0xDF, 0xD2, 0x6A, 0x6E, 0x31, 0xB2, 0xE6, 0x56, 0x9E, 0x8E, 0x9F, 0x8D, 0xF4, 0x27,
-    0xAC, 0x8E, 0xA9, 0x7D, 0x5D, 0x81, 0x4B, 0x17, 0x06, 0x46, 0xAD, 0x55, 0x65, 0x4A, 0x56, 0xAF,
-    0x67, 0x74, 0x81, 0x76, 0x2F, 0xF4, 0xFE, 0x5C, 0x5E, 0x92, 0xE4, 0xC6, 0x5F, 0x61, 0x7D, 0x04,
-    0x17, 0x4E, 0xDE, 0xAC, 0xD5, 0xEA, 0xF9, 0xC7, 0x29, 0xA8, 0x3C, 0xF4, 0x57, 0xA6, 0x92, 0xC6,
-    0xD7, 0xA2, 0xBC, 0x13, 0xBE, 0x60, 0x43, 0xDB, 0x43, 0x04, 0x8E, 0x31, 0x45, 0xAB, 0x9D, 0x28,
-    0x9C, 0xEE, 0xE8, 0xCA, 0xCA, 0x99, 0x9F, 0x32, 0x42, 0xC0, 0xE8, 0xEF, 0xD5, 0xC2, 0x14, 0xF2,
-    0xFB, 0x3F, 0x66, 0xE1, 0x2B, 0x66, 0x32, 0x62, 0x64, 0xA9, 0x0C, 0x0B, 0x9B, 0xEF, 0x4A, 0xE9,
-    0x25, 0x82, 0x09, 0xAF, 0x57, 0x32, 0x33, 0xD6, 0x50, 0x2A, 0xEB, 0x98, 0x52, 0x59, 0xCE, 0x34,
-    0x3D, 0x0D, 0x08, 0x26, 0x3B, 0xF8, 0xD1, 0x0A, 0x3A, 0x38, 0x02, 0x9D, 0x83, 0x3C, 0x78, 0xA3,
-    0xBF, 0x98, 0xB3, 0xF2, 0x60, 0x45, 0x32, 0x45, 0xB1, 0x24, 0x62, 0x6C, 0x70, 0x28, 0x26, 0xBC,
-    0x9D, 0x93, 0x96, 0xCF, 0xBF, 0xD7, 0x0B, 0x6A, 0xD9, 0x2B, 0x13, 0xA7, 0x0D, 0xF3, 0x35, 0x67,
-    0xF2, 0x9A, 0x0E, 0xF6, 0x87, 0x11, 0x8A, 0xF6, 0xB8, 0x8A, 0xCE, 0xC9, 0x3C, 0x6D, 0xC8, 0x43,
-    0x9C, 0x4F, 0x4C, 0xC8, 0xB3, 0x5B, 0x39, 0x93, 0x29, 0xE7, 0x66, 0x61, 0x7F, 0xDC, 0x5A, 0x4D,
-    0xF8, 0xCB, 0xD6, 0x1E, 0xCA, 0x35, 0x21, 0xDC, 0x47, 0x0C, 0x68, 0x61, 0xC8, 0x0E, 0xDE, 0x90,
-    0x2F, 0xCA, 0x3C, 0xB2, 0x6B, 0xB5, 0xF7, 0x6F, 0x48, 0xC6, 0x85, 0x39, 0x14, 0xBE, 0x57, 0x79,
-    0xB8, 0x45, 0xE9, 0x62, 0x03, 0x09, 0x74, 0xEE, 0x41, 0x38, 0x04, 0x24, 0x83, 0xDB, 0x5A, 0x9A,
-    0x2B, 0xBE, 0xE3, 0x81, 0xA2, 0x73, 0x49, 0xDE, 0x8A, 0xC2, 0x77, 0x35, 0xD1, 0xAB, 0xB2, 0xEE,
-    0x74, 0xAB, 0xC3, 0x4B, 0x85, 0xF8, 0xB0, 0xE8, 0x07, 0xFF, 0x20, 0x34, 0x39, 0x55, 0x19, 0x86,
-    0x6B, 0x45, 0x6D, 0x14, 0x11, 0xC3, 0xC4, 0x1E, 0x7C, 0x90, 0x80, 0xCC, 0x2D, 0xEB, 0xC9, 0xC4,
-    0xFC, 0x24, 0xB1, 0xBC, 0x7E, 0xC0, 0xAB, 0x59, 0x84, 0xD8, 0x2B, 0x7D, 0x8A, 0xC0, 0x26, 0xF5,
-    0x1B, 0x53, 0xBA, 0x8C, 0xED, 0xF9, 0x05, 0xA9, 0x63, 0x34, 0xB1, 0x59, 0x89, 0x40, 0x96, 0xC7,
-    0x77, 0x0F, 0xE1, 0x60, 0x3C, 0x08, 0x2B, 0x7E, 0x0A, 0xCC, 0xD1, 0xAA, 0xCC, 0xAD, 0xE7, 0x95,
-    0xA9, 0xF5, 0xDF, 0x38, 0x85, 0x69, 0x78, 0x57, 0x83, 0x71, 0xA2, 0x53, 0xA5, 0xDA, 0xF6, 0x81,
-    0x6C, 0x4E, 0x08, 0xCB, 0x85, 0x12, 0xC8, 0x5B, 0x38, 0x93, 0x4B, 0x8C, 0x42, 0xEA, 0x6F, 0xB5,
-    0x89, 0x97, 0xD3, 0xAD, 0xF2, 0x6E, 0x00, 0xC5, 0x33, 0xDF, 0x0A, 0x62, 0xFF, 0x5C, 0xDF, 0xEC,
-    0x25, 0x1C, 0xF9, 0xCC, 0xB2, 0xB2, 0xE3, 0x23, 0x1C, 0x2E, 0xE6, 0xEC, 0xA4, 0x55, 0xCE, 0x74,
-    0xA4, 0x94, 0x67, 0xF4, 0x6E, 0x1A, 0xE4, 0x02, 0xD3, 0xC6, 0x74, 0x69, 0xBF, 0xBC, 0x05, 0xAB,
-    0x5B, 0x08, 0xEF, 0x11, 0xE0, 0xFF, 0x7D, 0x6E, 0x35, 0x70, 0x51, 0xC2, 0x7B, 0x1D, 0x31, 0xCC,
-    0xA0, 0x2E, 0x30, 0xD8, 0x16, 0x9F, 0x0E, 0xD6, 0xBF, 0xF1, 0xB9, 0xA2, 0x0F, 0xA7, 0x3E, 0x4D,
-    0x3E, 0xA2, 0xEE, 0x97, 0xF2, 0x95, 0x9E, 0x27, 0x15, 0xC6, 0x99, 0x96, 0xE0, 0xFC, 0xAE, 0x52,
-    0x92, 0x45, 0xB4, 0x41, 0x99, 0x57, 0xA1, 0xB8, 0x18, 0xBD, 0xAC, 0x70, 0x0C, 0x19, 0x84, 0xD3,
-    0xED, 0x48, 0x85, 0xDF, 0x81, 0xFF, 0xF0, 0x82, 0x24, 0xE4, 0x05, 0x1C, 0x3A, 0xF2, 0xDE, 0x1C,
-    0xDC, 0x2E, 0x56, 0xDF, 0xEE, 0x07, 0x0F, 0x28, 0x97, 0x1B, 0xF9, 0xC3, 0xD7, 0x15, 0x50, 0x67,
-    0x1D, 0x42, 0xD0, 0x67, 0x05, 0x31, 0xE5, 0x97, 0xE5, 0xBD, 0x66, 0xBD, 0x28, 0x2E, 0x2E, 0x0B,
-    0xD9, 0xFC, 0xAF, 0xF7, 0x71, 0xE8, 0x41, 0xBF, 0xB8, 0xE2, 0x6B, 0x9B, 0xE7, 0xCD, 0x62, 0xCB,
-    0x3F, 0xDB, 0x4C, 0xF7, 0x74, 0xE4, 0x49, 0xAC, 0x19, 0xB3, 0x62, 0xF2, 0x53, 0x4F, 0xC5, 0xE8,
-    0x97, 0x4C, 0x00, 0x6F, 0xB9, 0xE5, 0x7D, 0x43, 0x3E, 0xE8, 0xD7, 0x88, 0x1C, 0xB1, 0x18, 0x9A,
-    0x45, 0x6F, 0x7A, 0x56, 0x4E, 0xE6, 0x4B, 0x7B, 0x7B, 0xF3, 0x04, 0xCA, 0x6B, 0x05, 0x91, 0x78,
-    0x92, 0xBC, 0xA7, 0x7A, 0x95, 0x2A, 0xAE, 0xF9, 0xBF, 0x85, 0x1F, 0x2A, 0xB3, 0x72, 0x56, 0x65,
-    0xF7, 0x58, 0x97, 0xCC, 0xEC, 0x7D, 0x46, 0x57, 0x37, 0xE1, 0x65, 0x2C, 0x22, 0xE9, 0x05, 0xCD,
-    0xB0, 0x4C, 0xD3, 0xFD, 0x58, 0x58, 0xD3, 0xD4, 0x6E, 0xB2, 0x5C, 0xEE, 0xC7, 0xD4, 0x4E, 0x1F,
-    0x4B, 0xF2, 0x9C, 0x55, 0x9E, 0xDB, 0xD4, 0x77, 0xD1, 0x8B, 0xF4, 0x69, 0x72, 0x4C, 0x75, 0x90,
-    0x03, 0xDC, 0x84, 0x05, 0x35, 0x54, 0x21, 0xD2, 0xAA, 0xE4, 0xC5, 0x6E, 0x16, 0x54, 0x0B, 0x98,
-    0x24, 0x76, 0x21, 0x6D, 0x76, 0x39, 0x07, 0x48, 0x9E, 0xC0, 0xA2, 0xB2, 0xFF, 0x6F, 0xAB, 0x52,
-    0x1F, 0x61, 0x9A, 0x6E, 0xEE, 0x9D, 0x26, 0xB7, 0xA2, 0x96, 0x9E, 0x9B, 0x26, 0xBE, 0xE7, 0xC3,
-    0x6A, 0x65, 0x39, 0xBD, 0x24, 0x9F, 0xCD, 0xCB, 0x3F, 0xE6, 0xA6, 0x89, 0x78, 0xDC, 0x7E, 0x82,
-    0xD3, 0xF4, 0xA8, 0xC3, 0xB5, 0xE2, 0x05, 0x33, 0x1B, 0x1E, 0xBB, 0x3E, 0xDA, 0x35, 0xD6, 0xCF,
-    0x7F, 0x25, 0xF7, 0xD3, 0x6A, 0xD9, 0x2F, 0x7A, 0x5A, 0xB5, 0x4B, 0xEE, 0xC4, 0xA0, 0x58, 0xD4,
-    0xAE, 0xC6, 0xE4, 0x27, 0xE7, 0x26, 0xA5, 0x02, 0x41, 0xFA, 0xB5, 0xB7, 0xA0, 0xFD, 0x1B, 0x6B,
-    0x65, 0xC3, 0x54, 0xEB, 0xBD, 0xC7, 0x2A, 0x58, 0xBB, 0x96, 0x25, 0xC6, 0xB5, 0xCC, 0x1B, 0x97,
-    0x23, 0x19, 0x30, 0x71, 0xBF, 0xDE, 0xA2, 0x04, 0x43, 0x75, 0xED, 0xE8, 0x1D, 0xA6, 0xE3, 0x2A,
-    0x82, 0x74, 0x12, 0x84, 0x3A, 0x79, 0xCC, 0x51, 0x8C, 0xA4, 0xA0, 0x9B, 0x7C, 0x46, 0xFF, 0x5E,
-    0x0A, 0xDF, 0x82, 0xEF, 0x70, 0xAA, 0x2A, 0xD2, 0x63, 0xE3, 0xD2, 0xA4, 0x9C, 0xD8, 0xD4, 0x01,
-    0x45, 0xD3, 0x04, 0x09, 0x4F, 0x74, 0x7E, 0x4A, 0xB0, 0x62, 0x52, 0x5F, 0xE5, 0xB4, 0x94, 0x64,
-    0x13, 0x5D, 0x90, 0x62, 0xC2, 0xCD, 0xCD, 0x78, 0x77, 0x4F, 0x0E, 0x62, 0x59, 0xA1, 0xA8, 0x58,
-    0xA7, 0x36, 0x3A, 0x83, 0xE0, 0xDA, 0xBA, 0x0F, 0xF7, 0x70, 0xB9, 0xB7, 0xEE, 0x93, 0x3E, 0x3E,
-    0x26, 0xC5, 0x83, 0x63, 0xA6, 0xA7, 0x46, 0xF2, 0x72, 0x3E, 0x1A, 0x30, 0x66, 0xF7, 0xF8, 0x1E,
-    0x39, 0xB8, 0x23, 0x54, 0x24, 0xC4, 0x3E, 0x6E, 0xD9, 0x18, 0x6B, 0x88, 0x4E, 0xFD, 0x68, 0x92,
-    0xDD, 0x63, 0x20, 0x6E, 0x40, 0x7D, 0xF6, 0x34, 0x22, 0x76, 0x47, 0x52, 0xC9, 0x3C, 0xDB, 0x9F,
-    0xBD, 0x85, 0xE9, 0x5B, 0x87, 0x62, 0x41, 0x0F, 0x80, 0x96, 0x30, 0x3D, 0xF1, 0xA5, 0xDD, 0xBD,
-    0x39, 0x88, 0xC5, 0x05, 0x13, 0xFE, 0xCA, 0xBF, 0xA4, 0xCC, 0x32, 0x24, 0x74, 0xA5, 0x34, 0x42,
-    0x2E, 0x87, 0xEA, 0x82, 0x13, 0xEF, 0x4A, 0x05, 0x1E, 0xEC, 0xDB, 0x5D, 0xE4, 0x6F, 0xD1, 0x67,
-    0x3E, 0x98, 0xC1, 0x58, 0xE6, 0xE8, 0xA4, 0xEE, 0x0F, 0x07, 0x5F, 0x7D, 0xFA, 0x80, 0x29, 0xB5,
-    0xC0, 0x39, 0x8B, 0xCE, 0xD1, 0x63, 0x78, 0x83, 0xCA, 0xE9, 0x1B, 0xCD, 0x5E, 0xF6, 0x39, 0x90,
-    0xF7, 0xA1, 0x2C, 0x1F, 0x42, 0xBF, 0x19, 0x3E, 0xB8, 0xDC, 0x82, 0x10, 0xCF, 0xEF, 0xE1, 0xDF,
-    0x2A, 0xE9, 0xB2, 0x26, 0xE8, 0x25, 0xE4, 0x34, 0x1F, 0x83, 0x62, 0x91, 0x89, 0x64, 0x01, 0xA9,
-    0x17, 0xD5, 0x33, 0xDF, 0xAF, 0x26, 0x6B, 0x68, 0x87, 0x18, 0x14, 0x23, 0xD2, 0x92, 0xB8, 0x78,
-    0x82, 0xEF, 0xB5, 0x2B, 0xA6, 0x3F, 0xD9, 0xC3, 0x22, 0xA0, 0xE3, 0x26, 0xA3, 0xF8, 0xB0, 0xEF,
-    0x32, 0x98, 0x95, 0x40, 0x47, 0x82, 0x23, 0x29, 0x4D, 0xAF, 0xCF, 0x72, 0xD3, 0x47, 0x44, 0xAB,
-    0xF8, 0x85, 0x64, 0x81, 0x3A, 0xDF, 0xA4, 0xDF, 0xB6, 0xD4, 0x7E, 0x7F, 0xFF, 0x74, 0xDE, 0x33,
-    0x62, 0x0B, 0xD0, 0x13, 0xD7, 0x0B, 0x5A, 0x9E, 0x6E, 0x93, 0x9B, 0xEF, 0xD3, 0xDD, 0xD2, 0x82,
-    0xA3, 0xD8, 0xD1, 0xCF, 0xDB, 0xDA, 0xBB, 0xC2, 0x54, 0x76, 0x13, 0xBE, 0x99, 0x8F, 0x40, 0x82,
-    0xAD, 0xED, 0x6C, 0x85, 0xA9, 0x59, 0x6C, 0xCA, 0x75, 0xA7, 0x0C, 0xF3, 0xC0, 0x48, 0xB9, 0x4C,
-    0xDC, 0xA7, 0xD3, 0xF7, 0xE8, 0x3C, 0xD1, 0x5A, 0xF2, 0x46, 0x56, 0xE2, 0x98, 0xF2, 0xD3, 0x93,
-    0xE6, 0xF3, 0x15, 0xE6, 0xF4, 0x1B, 0x89, 0x1D, 0x3F, 0x4A, 0x8D, 0xF9, 0x79, 0x99, 0x65, 0xDF,
-    0x94, 0x36, 0x57, 0x5C, 0xF7, 0x4D, 0x60, 0x7A, 0xE4, 0xA0, 0xDE, 0xB5, 0x84, 0xA9, 0x40, 0xB7,
-    0xEC, 0x46, 0xCD, 0xAF, 0x81, 0x32, 0xB9, 0x3D, 0xC9, 0x2B, 0x4A, 0x44, 0x10, 0x7A, 0xF1, 0x37,
-    0xAE, 0xB4, 0x60, 0x75, 0xAC, 0x24, 0x5A, 0x84, 0x78, 0x41, 0x6C, 0xEA, 0x7F, 0xEC, 0xC1, 0xB5,
-    0x22, 0xC1, 0x0E, 0x5D, 0xFB, 0xD4, 0xB1, 0x96, 0x7B, 0xC6, 0x7A, 0x6F, 0x32, 0x56, 0x99, 0x49,
-    0xFB, 0x2D, 0x0D, 0x8B, 0x2A, 0x8D, 0x7B, 0xC7, 0x3A, 0x7E, 0xE0, 0x7B, 0xA5, 0x3E, 0x7D, 0x30,
-    0x01, 0xDF, 0x0C, 0xF1, 0x6A, 0xBF, 0xAC, 0x9C, 0xF7, 0x39, 0x98, 0xE6, 0xFE, 0x15, 0xED, 0xFF,
-    0x0F, 0xAD, 0x55, 0x4F, 0x68, 0x9C, 0x45, 0x14, 0x7F, 0xF3, 0xCD, 0x26, 0x23, 0xFD, 0x68, 0x66,
-    0x0F, 0x11, 0xA4, 0xB8, 0x9D, 0x1E, 0xF4, 0x20, 0xA6, 0xFD, 0x3C, 0xE4, 0xD0, 0xC3, 0xEE, 0x7E,
-    0x93, 0xE4, 0x50, 0xB0, 0x28, 0x01, 0x0D, 0x82, 0x20, 0xF4, 0x9C, 0x53, 0x0F, 0x7B, 0xE8, 0x61,
-    0x93, 0x9D, 0xD2, 0x63, 0x2F, 0xBD, 0xF5, 0xBA, 0x20, 0xA2, 0xA6, 0x68, 0x15, 0x2A, 0xE4, 0xB0,
-    0xE9, 0x4E, 0x36, 0x48, 0x41, 0x2F, 0x53, 0x7A, 0xCC, 0x65, 0xA8, 0x08, 0x52, 0x0F, 0x1D, 0xCA,
-    0x80, 0x6B, 0xF8, 0x76, 0xC7, 0x37, 0xDF, 0x6E, 0xD2, 0xD8, 0xAA, 0xD4, 0xEA, 0xF0, 0x76, 0xF6,
-    0x9B, 0xF7, 0x66, 0x7E, 0xEF, 0xCF, 0xBC, 0xF7, 0xE6, 0xE3, 0xAD, 0xA3, 0xD1, 0x5D, 0xFD, 0xE8,
-    0x13, 0x21, 0x5D, 0xFE, 0xFD, 0x67, 0x27, 0xA0, 0xFB, 0xF7, 0x14, 0x07, 0x93, 0x50, 0x03, 0x58,
-    0x5C, 0xBF, 0xB5, 0xBF, 0xB5, 0xD3, 0x65, 0xEF, 0x12, 0xD3, 0x6D, 0xA1, 0xA0, 0x0B, 0x2F, 0x3A,
-    0x4D, 0x46, 0x0D, 0x71, 0x88, 0x86, 0xCD, 0xAD, 0x9B, 0x8F, 0xBE, 0xAE, 0xC1, 0xA5, 0xD6, 0x2C,
-    0x98, 0x4B, 0x30, 0x0B, 0xF0, 0xE2, 0x13, 0xAC, 0x6F, 0x75, 0xC2, 0xAF, 0xC1, 0x4F, 0xFF, 0xFA,
-    0x01, 0xE7, 0x30, 0x8E, 0xD8, 0x6B, 0x6B, 0x6B, 0x1F, 0x84, 0x10, 0x1E, 0xA1, 0x5F, 0x72, 0x6D,
-    0x32, 0x3A, 0xA1, 0x1C, 0x07, 0x13, 0x6F, 0xBF, 0xF8, 0x6B, 0xEE, 0x3C, 0x59, 0xB1, 0xCD, 0x26,
-    0xFD, 0xE9, 0xBF, 0x4E, 0x0F, 0x6F, 0xBC, 0x85, 0x70, 0x9F, 0x23, 0xF2, 0xCF, 0xA8, 0x24, 0x5A,
-    0x84, 0x9F, 0xBF, 0xE1, 0xCF, 0xC6, 0x6F, 0x42, 0xAC, 0xDB, 0x6E, 0x88, 0x8B, 0xF7, 0x8B, 0x3C,
-    0x2E, 0x0A, 0x6E, 0x76, 0x98, 0xE9, 0xF1, 0x25, 0x57, 0x7F, 0x6E, 0x59, 0xE1, 0xFB, 0x4F, 0xFC,
-    0x06, 0x5F, 0xB6, 0x75, 0xA6, 0x80, 0x40, 0xF5, 0x74, 0x62, 0x9C, 0x48, 0x95, 0x6F, 0xB0, 0x5D,
-    0x9F, 0xA5, 0x66, 0x24, 0x06, 0x45, 0x4E, 0x5D, 0xC4, 0x84, 0x2A, 0x7E, 0x73, 0x53, 0xA4, 0xE5,
-    0xE9, 0x54, 0x0F, 0xB9, 0xF4, 0x22, 0xB1, 0x75, 0xAA, 0x4B, 0xE9, 0xEA, 0x73, 0x52, 0x77, 0x24,
-    0xAD, 0x80, 0x1C, 0x89, 0x1F, 0xDD, 0xDD, 0x6C, 0xC5, 0x6D, 0xA4, 0x3A, 0x9E, 0x6A, 0x52, 0xDD,
-    0x66, 0xEA, 0x4A, 0x34, 0x76, 0x06, 0x4F, 0x17, 0x00, 0x42, 0x01, 0x0C, 0x01, 0xB8, 0x24, 0xD2,
-    0x57, 0xF2, 0xC7, 0xFD, 0x07, 0x21, 0x8C, 0xDE, 0xE4, 0x4B, 0x0A, 0x7C, 0x64, 0xC2, 0x33, 0x7F,
-    0x71, 0xA7, 0x3A, 0xFA, 0x9B, 0x42, 0xF0, 0x7F, 0x82, 0x50, 0xC7, 0x0E, 0xBD, 0xCA, 0x97, 0xAE,
-    0xA1, 0x2C, 0x0F, 0xE1, 0xBE, 0xF4, 0xF3, 0xC7, 0x64, 0x11, 0x65, 0x06, 0xE1, 0xA1, 0x7F, 0x21,
-    0x64, 0xA3, 0x8E, 0x0B, 0x6A, 0x15, 0x5A, 0xC0, 0x3D, 0x04, 0xCF, 0x83, 0x0F, 0xE1, 0x71, 0x18,
-    0x87, 0x31, 0x1F, 0xC3, 0x38, 0xE6, 0xC7, 0x0C, 0x2D, 0xF2, 0xBD, 0xE1, 0x0C, 0x6A, 0x9F, 0xCF,
-    0x55, 0xE8, 0xA8, 0x90, 0xCB, 0x71, 0x05, 0xAA, 0x68, 0xCC, 0x2A, 0xCC, 0x73, 0x4B, 0x46, 0x90,
-    0xED, 0x15, 0xD0, 0x57, 0xDC, 0x8D, 0x41, 0xE8, 0xA4, 0xA8, 0x00, 0x48, 0x98, 0x07, 0xB1, 0x52,
-    0xE4, 0xBB, 0xFE, 0x69, 0x96, 0x5F, 0x7A, 0x7B, 0x3F, 0xF9, 0x1F, 0xB2, 0x5C, 0xDD, 0xFC, 0x65,
-    0xEE, 0x25, 0xB3, 0x1C, 0x6E, 0x40, 0x26, 0xD9, 0x57, 0xE4, 0x87, 0xC5, 0x77, 0xBA, 0xFA, 0x5F,
-    0x99, 0x70, 0x38, 0x95, 0x83, 0x3C, 0x90, 0xD0, 0xB2, 0x50, 0x3B, 0xBF, 0x7E, 0xFB, 0xFD, 0x47,
-    0xB7, 0xDF, 0x33, 0xB5, 0x45, 0x73, 0xD9, 0xDC, 0xDF, 0x93, 0x06, 0xE0, 0x25, 0x68, 0x8A, 0x79,
-    0x4F, 0xA6, 0x35, 0x58, 0x68, 0xC1, 0xB7, 0x07, 0x5F, 0x5E, 0x3E, 0xB8, 0xF5, 0xFA, 0x22, 0x63,
-    0x27, 0x19, 0xD9, 0xBB, 0x80, 0xD1, 0x7B, 0x29, 0x7A, 0x66, 0x94, 0x7A, 0x48, 0x90, 0x20, 0xCA,
-    0x65, 0x7F, 0x04, 0xB4, 0x64, 0x89, 0xC4, 0xC1, 0x76, 0xFC, 0xA0, 0x96, 0x4B, 0x5E, 0xCA, 0x1A,
-    0x30, 0x4C, 0x4A, 0x19, 0xD5, 0xA9, 0xAA, 0x97, 0xAC, 0x36, 0x6C, 0x4F, 0x64, 0xD4, 0xF0, 0xAB,
-    0x76, 0xBA, 0xCB, 0xD7, 0xD9, 0x10, 0x52, 0x9F, 0xB8, 0x8C, 0xAD, 0x04, 0x47, 0x83, 0xE3, 0x8F,
-    0x8D, 0xEB, 0x71, 0x55, 0x08, 0x99, 0xBB, 0x05, 0x2E, 0x7B, 0x1C, 0x7A, 0x68, 0xCA, 0x55, 0x47,
-    0x07, 0x8E, 0x61, 0x71, 0xB8, 0x0C, 0x1A, 0xE7, 0x10, 0x0A, 0xCE, 0x25, 0x8E, 0x3E, 0xB0, 0xC8,
-    0xA2, 0x3A, 0x83, 0x7A, 0xC9, 0xBA, 0x43, 0x1C, 0x1B, 0xB8, 0x54, 0xA3, 0x79, 0x5C, 0x0E, 0x85,
-    0xF4, 0xD1, 0xBC, 0xBB, 0x1D, 0x18, 0x77, 0x00, 0xCD, 0x4B, 0x82, 0xA6, 0x41, 0x41, 0x8A, 0x1E,
-    0xC8, 0x48, 0xC7, 0xC6, 0x79, 0x66, 0x77, 0xF8, 0xC0, 0x37, 0x99, 0xF6, 0xA4, 0x34, 0x50, 0x2D,
-    0x32, 0xDB, 0x4B, 0x4D, 0xC1, 0x07, 0x43, 0x2C, 0xC2, 0x26, 0x33, 0x6D, 0xAE, 0x3C, 0x87, 0x6A,
-    0x65, 0xB2, 0xDF, 0x9E, 0x4C, 0xF4, 0x66, 0xAA, 0x0B, 0x94, 0x6D, 0xE2, 0x96, 0x1C, 0x77, 0x8A,
-    0x6B, 0x76, 0x23, 0xDD, 0x75, 0x4D, 0x6A, 0x3C, 0x27, 0xB6, 0x42, 0xE0, 0x4C, 0xCC, 0x58, 0x2C,
-    0xF1, 0x0E, 0x75, 0x5C, 0xB5, 0x13, 0xF3, 0x0A, 0x9E, 0x6B, 0x25, 0xBA, 0x48, 0xF5, 0x88, 0x59,
-    0x64, 0xE6, 0x64, 0x88, 0x5E, 0x32, 0xDD, 0x48, 0xCC, 0x69, 0x50, 0x25, 0x30, 0x31, 0x29, 0x7C,
-    0xC3, 0x75, 0x8F, 0xD9, 0x7C, 0x69, 0xC8, 0x35, 0x6E, 0xCA, 0x64, 0x81, 0x0B, 0xC0, 0xC5, 0x06,
-    0x71, 0xE8, 0x53, 0xDC, 0xEB, 0x12, 0xA8, 0xA2, 0xF9, 0xAF, 0x95, 0x3D, 0x40, 0x6C, 0x03, 0xB6,
-    0x1F, 0x81, 0x91, 0x95, 0xA9, 0x82, 0x37, 0xA8, 0xD9, 0x64, 0xB6, 0x4F, 0x7D, 0x6A, 0x53, 0x93,
-    0x1A, 0xA6, 0xA9, 0x3C, 0x83, 0x31, 0xE6, 0x8A, 0x59, 0x2C, 0xD5, 0x51, 0x52, 0x30, 0xC7, 0x75,
-    0x13, 0x16, 0xA1, 0x8A, 0xDA, 0x2E, 0x60, 0x08, 0x4E, 0x9F, 0x05, 0xC7, 0xD4, 0x1D, 0x21, 0x6D,
-    0xA2, 0xBB, 0xE7, 0x31, 0x36, 0x78, 0x41, 0x65, 0x0F, 0x72, 0x0E, 0x4E, 0xD0, 0xE2, 0x04, 0xDA,
-    0x48, 0x3C, 0x5F, 0x1E, 0x22, 0xFB, 0x3B, 0xBC, 0xB1, 0xB3, 0xD8, 0xF4, 0x98, 0xAC, 0x01, 0xB1,
-    0xAB, 0x2D, 0xB8, 0x22, 0x96, 0xCD, 0x1C, 0xF1, 0xE9, 0x8A, 0x9A, 0x81, 0x85, 0xCB, 0x30, 0x2D,
-    0xB1, 0x53, 0x70, 0x4A, 0x68, 0x71, 0xDD, 0xA6, 0x0F, 0x3D, 0xF5, 0x3B, 0x30, 0xCA, 0x64, 0x96,
-    0xEA, 0x74, 0xE0, 0x12, 0xD7, 0x83, 0x5E, 0x06, 0x19, 0xD3, 0x18, 0x25, 0xE2, 0xDA, 0xD0, 0xE6,
-    0xC0, 0xA9, 0xA6, 0xDA, 0x81, 0x9B, 0xDE, 0x82, 0x04, 0x59, 0x90, 0xA2, 0x2F, 0xFB, 0x08, 0xB0,
-    0x8B, 0x4D, 0xE9, 0x78, 0xC7, 0x5E, 0xFF, 0x34, 0xEC, 0x87, 0xE9, 0x9D, 0x11, 0x35, 0x69, 0x6A,
-    0xBD, 0x98, 0x5C, 0x98, 0x08, 0xC8, 0x42, 0x88, 0x14, 0x39, 0x98, 0x67, 0x31, 0xE9, 0xE6, 0x26,
-    0x1C, 0x34, 0xF6, 0x90, 0x13, 0xF3, 0xEE, 0x0E, 0x72, 0x74, 0x4C, 0x39, 0x34, 0x7F, 0xC2, 0xD9,
-    0x9E, 0x00, 0x90, 0xA3, 0x3C, 0xE8, 0x2B, 0xA4, 0x34, 0x18, 0xA4, 0xAC, 0xA4, 0x33, 0x42, 0x23,
-    0xC5, 0x56, 0x87, 0x84, 0x49, 0x2F, 0x4A, 0xC4, 0x7A, 0x09, 0xEF, 0xB0, 0x4B, 0x21, 0x65, 0xD8,
-    0xAD, 0xC6, 0x2C, 0x58, 0x1A, 0xAC, 0x18, 0x82, 0xF8, 0x1D, 0x36, 0x01, 0x9A, 0xD3, 0x0D, 0x88,
-    0x9E, 0xE8, 0x67, 0x8B, 0xA8, 0x02, 0xC9, 0x30, 0x12, 0xB7, 0xC0, 0x1D, 0xE4, 0x12, 0x72, 0x85,
-    0x6D, 0x2E, 0x12, 0x8E, 0xE4, 0x06, 0xDA, 0x90, 0x5D, 0x0F, 0x06, 0x23, 0x17, 0x0C, 0xF5, 0xA8,
-    0x9D, 0x47, 0xFD, 0x79, 0xD4, 0x5D, 0xC4, 0xCB, 0x89, 0xC0, 0xBC, 0x54, 0x0C, 0xA8, 0xBA, 0x87,
-    0x9A, 0x13, 0x87, 0x8A, 0x99, 0xDE, 0x8C, 0x5B, 0x50, 0xDA, 0x2E, 0xEF, 0xEF, 0xCF, 0x2A, 0x51,
-    0x1D, 0xBE, 0x63, 0x16, 0x52, 0x87, 0xFA, 0x32, 0x5D, 0xAA, 0x3B, 0x05, 0xE5, 0x33, 0x80, 0x0E,
-    0xDB, 0xE8, 0xAF, 0xCC, 0x83, 0xD9, 0x89, 0xCF, 0x52, 0xEC, 0xFE, 0x17, 0x11, 0x22, 0xCB, 0x70,
-    0x43, 0x1D, 0x83, 0x4C, 0x9E, 0x20, 0x9A, 0xB8, 0xA7, 0x21, 0x1B, 0x09, 0x40, 0x7D, 0x6D, 0x40,
-    0x7D, 0x0E, 0x36, 0xA2, 0x7B, 0x0E, 0x03, 0x49, 0x8F, 0xBB, 0x28, 0x31, 0xB7, 0xB8, 0xA6, 0x1E,
-    0xFA, 0x92, 0xC7, 0xA4, 0xCB, 0xF1, 0x22, 0x4B, 0xDF, 0x3E, 0x44, 0xE7, 0x30, 0x4A, 0x83, 0x83,
-    0x70, 0xD3, 0xBA, 0xD9, 0x60, 0xAB, 0x30, 0x7B, 0x58, 0x83, 0x73, 0x60, 0x16, 0xA8, 0x8A, 0x05,
-    0x25, 0x96, 0x7D, 0xCE, 0xEC, 0x28, 0xD6, 0x14, 0x75, 0x3B, 0x7C, 0x17, 0xAB, 0x0F, 0xCB, 0x4A,
-    0x0F, 0x05, 0xB5, 0x0D, 0x7C, 0x09, 0xB1, 0xB2, 0x1A, 0x20, 0xAB, 0x09, 0xBE, 0x18, 0x7F, 0x00,
-    0x3D, 0x52, 0x3D, 0x6F, 0x14, 0x31, 0x14, 0x1C, 0xAF, 0x51, 0xB6, 0x70, 0xE1, 0x6B, 0x40, 0xA2,
-    0x72, 0x5A, 0x28, 0x6E, 0xFF, 0x40, 0xEE, 0x76, 0x45, 0x8A, 0x14, 0x14, 0xA1, 0x48, 0x47, 0x71,
-    0xFF, 0x00, 0x7A, 0x74, 0x64, 0x2D, 0x51, 0xD0, 0xA6, 0xE2, 0x17, 0x40, 0x93, 0x14, 0x69, 0x52,
-    0x5C, 0x71, 0xC9, 0x3A, 0x49, 0x41, 0x41, 0xB3, 0x80, 0x04, 0x05, 0x8D, 0x0B, 0x3E, 0x24, 0xAE,
-    0xB1, 0xC0, 0x48, 0x4B, 0xD8, 0xDD, 0xC7, 0xDB, 0x04, 0xE2, 0xEA, 0x59, 0x1E, 0xCD, 0xBC, 0x99,
-    0xB1, 0x38, 0x41, 0x4E, 0x9B, 0xB1, 0x34, 0xC5, 0x74, 0x09, 0xF2, 0x09, 0x59, 0xD5, 0x23, 0x6B,
-    0x40, 0x41, 0x7E, 0xAB, 0x33, 0xFD, 0xB5, 0x31, 0x64, 0xD7, 0xF6, 0x80, 0x35, 0x8B, 0x5D, 0xC8,
-    0x06, 0xB9, 0x4F, 0x56, 0xD6, 0x8C, 0x11, 0x16, 0xFA, 0x9E, 0x3F, 0x9E, 0x7D, 0x20, 0xFA, 0xB1,
-    0xDF, 0x17, 0x89, 0x87, 0xB2, 0xB8, 0x8D, 0x64, 0xDF, 0x96, 0x6D, 0xFA, 0xDD, 0x1E, 0x41, 0xED,
-    0x31, 0xDB, 0x5A, 0xE5, 0xF0, 0x14, 0xB2, 0xC6, 0x04, 0xEA, 0xF4, 0x61, 0xCC, 0x3B, 0xF1, 0x0A,
-    0x50, 0xB5, 0x20, 0x9B, 0xD9, 0x24, 0xC2, 0x58, 0x54, 0x9D, 0xA4, 0x5E, 0x17, 0xCB, 0x09, 0x62,
-    0x94, 0xEF, 0x83, 0xD9, 0xFA, 0xD5, 0x2A, 0x72, 0xE2, 0x25, 0xEE, 0xEE, 0x3F, 0xA7, 0xFE, 0xC9,
-    0xC1, 0x27, 0x2C, 0xD6, 0xCD, 0xC0, 0xB0, 0x80, 0x46, 0x12, 0x98, 0x28, 0x75, 0x3C, 0xB3, 0xD8,
-    0x3A, 0xC4, 0x09, 0x32, 0x12, 0x61, 0xAA, 0xEC, 0xDC, 0x48, 0x9F, 0xB3, 0x91, 0x20, 0xFF, 0xC4,
-    0xB1, 0x0C, 0x21, 0x3D, 0x77, 0x46, 0xBF, 0xFD, 0xB7, 0xBA, 0xE8, 0xD8, 0x61, 0x12, 0x77, 0x75,
-    0x31, 0x67, 0x95, 0x46, 0xBE, 0x8B, 0x66, 0x93, 0x5A, 0x51, 0x05, 0x98, 0x42, 0x34, 0x78, 0xEC,
-    0xD8, 0xED, 0x1D, 0x0C, 0x47, 0xBD, 0x89, 0x29, 0x55, 0x98, 0xCA, 0x5A, 0x17, 0x8D, 0xAC, 0xA7,
-    0x88, 0xDA, 0x4E, 0xA4, 0xE7, 0x8B, 0x69, 0xAA, 0xD3, 0x9D, 0x9B, 0x0F, 0x18, 0x63, 0x7A, 0xC1,
-    0x0B, 0xBB, 0xE3, 0x39, 0x2E, 0xC2, 0x75, 0x58, 0x95, 0x97, 0x2B, 0xA7, 0x67, 0xB6, 0xCD, 0x68,
-    0x60, 0xBB, 0x3A, 0xF3, 0x94, 0x70, 0xE8, 0x44, 0xC0, 0x1C, 0x86, 0xB7, 0xBE, 0x1E, 0x32, 0xDA,
-    0xA6, 0x7A, 0x50, 0xEB, 0x45, 0xDF, 0x6B, 0xDB, 0x4E, 0x92, 0x30, 0xD2, 0x96, 0x1F, 0xD3, 0x9A,
-    0x23, 0x4E, 0x3D, 0x27, 0xA6, 0xBE, 0xEC, 0xE4, 0xD4, 0x94, 0x64, 0x51, 0x28, 0xBA, 0xBF, 0xFA,
-    0xE9, 0x26, 0x23, 0x0D, 0x6D, 0x4B, 0x9B, 0xB7, 0x37, 0x4C, 0x21, 0x3D, 0x1A, 0xD1, 0x1E, 0x76,
-    0xD7, 0x4A, 0x53, 0x24, 0x0D, 0x8C, 0x07, 0x59, 0xFD, 0x08, 0x8B, 0x45, 0x7A, 0xE6, 0x37, 0xD4,
-    0x33, 0xA2, 0x15, 0x91, 0xBB, 0x2A, 0x66, 0x3C, 0xA0, 0x52, 0x72, 0x65, 0xCB, 0x17, 0xEE, 0xE6,
-    0x33, 0x28, 0xB2, 0x71, 0x4E, 0xF3, 0xB2, 0x1B, 0x73, 0x56, 0x85, 0xFC, 0x3F, 0x59, 0xE9, 0x74,
-    0x44, 0x0B, 0xED, 0xB0, 0xBB, 0x27, 0xA9, 0xD5, 0x2F, 0xDA, 0x0D, 0x31, 0x74, 0xE3, 0xF5, 0x76,
-    0xBD, 0xD4, 0xE4, 0x75, 0x77, 0x89, 0xA2, 0x8F, 0xD4, 0x1F, 0xA5, 0xAF, 0x11, 0x47, 0xE3, 0xA1,
-    0x12, 0xD6, 0x07, 0xEF, 0xB5, 0x71, 0x55, 0x4F, 0x5A, 0x0C, 0x98, 0x11, 0x5B, 0xC4, 0xEF, 0x63,
-    0xE5, 0x96, 0xE3, 0xC4, 0x73, 0xFC, 0x65, 0x04, 0xD5, 0x66, 0xE6, 0xA3, 0x3A, 0x77, 0x9A, 0xDB,
-    0xC8, 0x0E, 0xEA, 0xEC, 0x92, 0x8C, 0x91, 0xA6, 0x13, 0x7D, 0x37, 0x84, 0x21, 0xC2, 0xF0, 0x0F,
-    0xF4, 0xD6, 0xC5, 0x32, 0xA5, 0x20, 0x66, 0x16, 0x4B, 0xFE, 0x30, 0xB7, 0x3A, 0x54, 0x76, 0x00,
-    0xFE, 0x05, 0x35, 0x91, 0xBF, 0x4E, 0xC3, 0x30, 0x10, 0x87, 0x7F, 0xB6, 0x69, 0x2B, 0x91, 0xA1,
-    0x0C, 0x20, 0x90, 0x18, 0xB2, 0x23, 0xA1, 0xAC, 0x99, 0x9A, 0x3C, 0x02, 0x4B, 0x24, 0x24, 0x1E,
-    0x82, 0x17, 0x68, 0xA9, 0x1F, 0x01, 0x84, 0x78, 0x07, 0xD4, 0x85, 0x17, 0x68, 0x53, 0x0B, 0x5E,
-    0x20, 0x13, 0x73, 0x87, 0x4E, 0x4C, 0x19, 0x82, 0xE4, 0x54, 0xA6, 0xC7, 0xD9, 0x49, 0x4E, 0xB2,
-    0xF4, 0x9D, 0xFF, 0xDC, 0xE9, 0x3E, 0x27, 0x44, 0x96, 0x88, 0xEA, 0xE4, 0xED, 0xC1, 0x6C, 0x10,
-    0xCB, 0x06, 0x69, 0x54, 0x21, 0x4F, 0x72, 0x60, 0x03, 0xC8, 0xB6, 0xD0, 0x11, 0x91, 0x4E, 0x7E,
-    0xDE, 0x43, 0xDA, 0x00, 0x1F, 0x87, 0x5C, 0x11, 0x01, 0x65, 0x97, 0xF2, 0x65, 0x41, 0x47, 0x4C,
-    0xC9, 0xA2, 0x8B, 0xE5, 0x0E, 0x8A, 0x1C, 0xEF, 0x97, 0x98, 0xEA, 0x0C, 0x09, 0x6E, 0x91, 0xE1,
-    0x04, 0x33, 0x3E, 0x5A, 0x00, 0xA7, 0xE5, 0x4A, 0xC7, 0x5C, 0x10, 0x6B, 0xCE, 0xDD, 0x08, 0x19,
-    0x97, 0xBA, 0x69, 0x0B, 0x08, 0x2E, 0x25, 0x6B, 0x40, 0xED, 0x80, 0x49, 0x85, 0xFB, 0x25, 0x91,
-    0xCB, 0xB6, 0xE4, 0xAE, 0x30, 0xBA, 0xC3, 0x10, 0xD7, 0x74, 0xCC, 0x03, 0xF0, 0xAB, 0x3A, 0xC0,
-    0xD8, 0x4A, 0x17, 0x40, 0x58, 0xFC, 0x0D, 0xF0, 0x34, 0xC0, 0x4C, 0x98, 0x1E, 0x54, 0x0F, 0x8B,
-    0x01, 0xDC, 0x23, 0x99, 0x65, 0x23, 0x6C, 0xD4, 0x10, 0x7D, 0xB6, 0x6B, 0x41, 0x54, 0x4D, 0x8C,
-    0x32, 0xA9, 0xA0, 0x16, 0x0C, 0xD5, 0x19, 0xDF, 0xF1, 0x60, 0xD1, 0x81, 0x20, 0xDD, 0x01, 0x92,
-    0xA6, 0x07, 0xE1, 0x3A, 0x90, 0xF9, 0x3C, 0x40, 0xA5, 0xF4, 0x3C, 0xA6, 0x0A, 0xEA, 0xF0, 0xFA,
-    0xDD, 0x64, 0xB4, 0x83, 0xA4, 0x2F, 0x4E, 0x7D, 0x9C, 0xE3, 0xA2, 0x1F, 0x41, 0xD2, 0x1E, 0xBE,
-    0x19, 0xB6, 0x2F, 0x6B, 0xC4, 0xDC, 0x51, 0xD5, 0x48, 0x59, 0xAD, 0xC4, 0xD4, 0x04, 0xDD, 0x5E,
-    0xAE, 0xC5, 0xE5, 0x6F, 0xC1, 0x53, 0x7A, 0x9B, 0xEC, 0x67, 0xBC, 0x5D, 0x3D, 0x07, 0xD7, 0x88,
-    0xB5, 0xB7, 0xC6, 0x2B, 0xF2, 0xE3, 0x67, 0xFB, 0x91, 0x01, 0x7B, 0x0A, 0x1F, 0x00, 0x14, 0xF8,
-    0x07, 0x65, 0x53, 0x3D, 0x6F, 0xD3, 0x50, 0x14, 0x3D, 0xF6, 0xAB, 0xB0, 0x84, 0x25, 0x5E, 0xD9,
-    0x29, 0x59, 0x58, 0x63, 0x2F, 0x1D, 0xF3, 0x61, 0xB5, 0x48, 0x0C, 0x0C, 0xB0, 0x44, 0x4C, 0x88,
-    0xFE, 0x01, 0x04, 0x43, 0x05, 0x0C, 0x11, 0x72, 0x58, 0x3A, 0x78, 0xE1, 0x0F, 0x94, 0x1F, 0x90,
-    0x39, 0x43, 0x86, 0x8A, 0x3A, 0x65, 0x60, 0xB5, 0x60, 0x60, 0x35, 0x59, 0x3A, 0xB0, 0x18, 0xC9,
-    0x48, 0x19, 0x22, 0x3F, 0xCE, 0x7D, 0xFE, 0xA0, 0x11, 0x4F, 0x3E, 0xF6, 0x7B, 0x2F, 0xF7, 0x9E,
-    0x73, 0xBF, 0x82, 0x7D, 0x00, 0x43, 0x62, 0xD4, 0x20, 0x20, 0x42, 0x63, 0xCC, 0x2F, 0x62, 0xB3,
-    0xE4, 0xC1, 0x8F, 0xF9, 0x92, 0x8D, 0x8E, 0xF8, 0x12, 0xD4, 0x97, 0xFE, 0x06, 0xBE, 0x89, 0xFD,
-    0xF3, 0xA5, 0x7F, 0xF6, 0x64, 0xB6, 0xCA, 0x32, 0x9C, 0x02, 0x07, 0x80, 0x17, 0xC1, 0xC9, 0x80,
-    0x05, 0xD0, 0xB7, 0x66, 0x6E, 0x6E, 0xBD, 0x83, 0xEE, 0x20, 0xCB, 0x11, 0x14, 0xA2, 0x44, 0xB8,
-    0xB2, 0x09, 0x3A, 0xCD, 0x46, 0xAD, 0xC5, 0x94, 0xD8, 0x6B, 0x35, 0xFF, 0x23, 0xAB, 0x65, 0x1A,
-    0x4D, 0x1B, 0x80, 0xEF, 0x1D, 0x1F, 0xFD, 0xFE, 0x9E, 0x87, 0x6F, 0x73, 0xD7, 0xE4, 0x08, 0xF3,
-    0x4E, 0x93, 0x4B, 0xA5, 0x1A, 0x28, 0x49, 0x39, 0xA4, 0x3A, 0xD3, 0xF1, 0xBE, 0x50, 0xD0, 0x8C,
-    0x89, 0xA2, 0xA4, 0x92, 0xCA, 0xD0, 0x63, 0x96, 0x7E, 0x8A, 0x01, 0x8A, 0xDA, 0x83, 0xCA, 0x3A,
-    0x85, 0xDE, 0x42, 0x9B, 0x54, 0x3F, 0x9F, 0xEA, 0xB3, 0xC7, 0xE9, 0x2C, 0x8B, 0x77, 0x53, 0xB5,
-    0x87, 0x5B, 0xDE, 0xD1, 0xF1, 0xCF, 0x6F, 0xC5, 0xE8, 0x4D, 0xA1, 0x4C, 0x81, 0x71, 0x01, 0x45,
-    0x86, 0x7D, 0x4B, 0xC0, 0x50, 0x1B, 0x82, 0xF3, 0x0B, 0x12, 0xAC, 0x66, 0xD9, 0xC7, 0x1D, 0x82,
-    0x93, 0xD3, 0x07, 0xA3, 0x83, 0x50, 0x5D, 0xBF, 0x42, 0x58, 0xC1, 0xAD, 0x24, 0xBD, 0x9E, 0x31,
-    0x3F, 0x8C, 0x29, 0xDB, 0xB8, 0xBD, 0xD4, 0x56, 0x8B, 0xA5, 0xD0, 0x92, 0x04, 0x24, 0xBA, 0x01,
-    0x0E, 0x35, 0x46, 0x2A, 0x0D, 0x50, 0x04, 0x18, 0x84, 0x93, 0x17, 0xDA, 0x98, 0xAB, 0x3F, 0x93,
-    0xA7, 0x61, 0x5D, 0x50, 0xF9, 0x34, 0xBD, 0x92, 0xC6, 0x75, 0x4E, 0x37, 0x19, 0x7C, 0x68, 0x95,
-    0x5B, 0x06, 0x37, 0x1F, 0x4E, 0xDE, 0x93, 0x60, 0x35, 0x79, 0x96, 0x43, 0xB5, 0x0F, 0x4E, 0x1A,
-    0x82, 0xDB, 0x36, 0x06, 0x87, 0x41, 0x30, 0x8C, 0xA9, 0x53, 0xB2, 0x4C, 0x25, 0x59, 0x18, 0x5F,
-    0xC1, 0xDA, 0x6D, 0xC7, 0xF3, 0xF9, 0x5C, 0xCC, 0xED, 0xFC, 0xD8, 0xCD, 0x00, 0x37, 0xD6, 0x1D,
-    0x09, 0x21, 0xAE, 0xE1, 0xD3, 0x3E, 0x91, 0x4E, 0x73, 0x6F, 0x1B, 0x23, 0x6D, 0xFF, 0x40, 0xE4,
-    0x32, 0x77, 0xF6, 0xE6, 0xB0, 0xF5, 0xDB, 0xEB, 0xC6, 0x2C, 0x89, 0xF5, 0x7A, 0xAB, 0x37, 0x97,
-    0x5F, 0x3F, 0xF5, 0x17, 0x8F, 0x92, 0x87, 0xCE, 0x3A, 0xC3, 0xBB, 0x05, 0x82, 0x3E, 0x7F, 0x89,
-    0xDC, 0x75, 0x8E, 0xE5, 0x12, 0x41, 0x20, 0x66, 0x72, 0xE8, 0x96, 0xCB, 0x34, 0x71, 0x61, 0x07,
-    0xE7, 0x92, 0x73, 0x25, 0x4A, 0xED, 0x28, 0x07, 0xBC, 0xA8, 0x78, 0x51, 0x35, 0x03, 0x2F, 0xF0,
-    0x1A, 0xB7, 0x28, 0xDA, 0xE5, 0x93, 0x43, 0x1F, 0x5E, 0x12, 0xD5, 0xB2, 0xCE, 0xFD, 0xFE, 0xDD,
-    0xEB, 0xE4, 0x65, 0xB8, 0xAE, 0xDC, 0xCD, 0x67, 0x31, 0xAB, 0x3B, 0xF6, 0x6F, 0xBD, 0x56, 0x1C,
-    0xAC, 0xAC, 0x17, 0xB1, 0x5D, 0x3A, 0x52, 0x14, 0x85, 0x0C, 0x98, 0xD4, 0x5C, 0xCB, 0x3F, 0x68,
-    0xCA, 0x32, 0x73, 0x14, 0x58, 0x36, 0xB6, 0x82, 0x8D, 0xD5, 0x11, 0xDB, 0x7A, 0x0F, 0x59, 0xED,
-    0xFC, 0x17, 0xB5, 0x57, 0x3F, 0x6C, 0xDC, 0xD6, 0x19, 0xFF, 0x1E, 0x69, 0x89, 0xA8, 0x39, 0xD0,
-    0x83, 0x55, 0xA0, 0x76, 0x9D, 0x97, 0xD5, 0x2D, 0x22, 0x2E, 0x19, 0x3A, 0x48, 0x47, 0x3A, 0x1E,
-    0x3A, 0x74, 0x88, 0x80, 0xEA, 0xDA, 0xA1, 0x6B, 0x26, 0x2F, 0x5A, 0x34, 0x64, 0x38, 0xF9, 0xD8,
-    0x64, 0xEC, 0x50, 0x0D, 0x2D, 0x3A, 0xD6, 0x83, 0x5B, 0xD8, 0xCC, 0x70, 0x19, 0x3A, 0xA8, 0xC0,
-    0xD9, 0xA4, 0x6C, 0xB4, 0x1E, 0x32, 0x84, 0x69, 0x50, 0x78, 0xE8, 0xD0, 0x2B, 0xDA, 0x44, 0x40,
-    0x6D, 0x34, 0xB4, 0x41, 0xD5, 0x27, 0x99, 0x77, 0xAF, 0xBF, 0xDF, 0x23, 0x79, 0x8A, 0x93, 0x36,
-    0x71, 0x1C, 0x94, 0x10, 0xA9, 0x7B, 0x1F, 0xDF, 0xFB, 0xFE, 0xFE, 0xBE, 0x3F, 0x14, 0x11, 0x71,
-    0xA6, 0x22, 0xEE, 0x41, 0x29, 0x12, 0xBE, 0x5E, 0x88, 0xD4, 0x61, 0x22, 0x5E, 0x11, 0x61, 0x25,
-    0xB7, 0x44, 0xA6, 0x6A, 0x9E, 0x8E, 0x72, 0xD7, 0x18, 0x23, 0xFE, 0xE1, 0x8F, 0x2A, 0x09, 0x72,
-    0x3F, 0x97, 0x28, 0xEE, 0x89, 0x5C, 0x55, 0x38, 0x51, 0x07, 0x89, 0x38, 0xD5, 0x3A, 0xCE, 0x3F,
-    0xC6, 0x2A, 0x78, 0x3F, 0x16, 0xD1, 0x35, 0x58, 0x46, 0x13, 0x3C, 0x32, 0xDC, 0xAA, 0xE2, 0x43,
-    0xF8, 0x88, 0xC5, 0x37, 0xB9, 0x7B, 0x6C, 0xE4, 0x55, 0x05, 0x81, 0x60, 0x23, 0x3B, 0x38, 0x87,
-    0x8D, 0x3D, 0xF1, 0x0F, 0x4A, 0xDF, 0x18, 0xB7, 0xD2, 0xE5, 0x58, 0x7A, 0x3A, 0x76, 0xFF, 0x5E,
-    0xCA, 0xFA, 0xBA, 0x78, 0xF7, 0x72, 0x19, 0x8F, 0x25, 0xF8, 0x59, 0xAE, 0x48, 0xF7, 0x0B, 0x2F,
-    0x1F, 0xAA, 0xCA, 0x35, 0x33, 0xF1, 0xE7, 0xD2, 0x5E, 0xA1, 0x31, 0x0F, 0x8C, 0xA9, 0x37, 0x05,
-    0x0A, 0x07, 0xB9, 0xB8, 0xD4, 0x49, 0xEC, 0xE2, 0x0F, 0x9B, 0xDE, 0x13, 0x63, 0x66, 0xD4, 0xFC,
-    0x33, 0x6F, 0xB0, 0x38, 0xEC, 0x5F, 0x32, 0xCD, 0x15, 0x77, 0x9C, 0x56, 0x62, 0x37, 0x06, 0xBB,
-    0x2A, 0x12, 0xCF, 0x98, 0xA7, 0xA5, 0x64, 0xBB, 0x9E, 0x11, 0xAF, 0x14, 0x77, 0xCA, 0x43, 0x61,
-    0x05, 0xA5, 0x9D, 0x27, 0x13, 0x1C, 0x0E, 0x83, 0xBC, 0x07, 0xA3, 0x43, 0x10, 0x74, 0xBC, 0xE3,
-    0x15, 0xAA, 0x52, 0x95, 0x8E, 0x75, 0xEC, 0x15, 0x3B, 0xB0, 0x36, 0xBC, 0x34, 0xD5, 0xB1, 0x8C,
-    0xDD, 0x72, 0x0A, 0x91, 0xFE, 0x5F, 0x13, 0x09, 0x63, 0x3D, 0xA5, 0xE8, 0x30, 0x17, 0x5D, 0x88,
-    0x29, 0x96, 0xE7, 0x12, 0x8C, 0x8C, 0x29, 0xA4, 0xD6, 0x66, 0x2A, 0x2A, 0x57, 0x9B, 0xB2, 0xB8,
-    0x4E, 0xD1, 0x4F, 0xD8, 0x2D, 0x01, 0xB4, 0x95, 0x21, 0x5C, 0xE4, 0x9A, 0x04, 0x2B, 0x28, 0x20,
-    0x7B, 0x88, 0x86, 0xFB, 0x01, 0x5E, 0x6A, 0x9A, 0x32, 0xF5, 0x0B, 0xF1, 0x72, 0x0D, 0x6D, 0xA8,
-    0x5D, 0x25, 0xB7, 0xE9, 0xD0, 0x1A, 0xAE, 0x74, 0x4B, 0xC4, 0xC5, 0xA7, 0x9E, 0x41, 0x8E, 0xB8,
-    0x44, 0xAF, 0x21, 0x00, 0xB7, 0x03, 0x18, 0x5A, 0x47, 0x78, 0x94, 0x56, 0x0C, 0xED, 0xBE, 0xCB,
-    0x47, 0xF0, 0x6C, 0xBC, 0x67, 0x8C, 0x77, 0x0D, 0xBE, 0x90, 0x10, 0x81, 0x89, 0x7C, 0x3E, 0xDE,
-    0xFE, 0x73, 0xC7, 0xDB, 0x5E, 0xE7, 0x8D, 0x99, 0xC0, 0x9D, 0x26, 0xC9, 0x7E, 0x21, 0x74, 0xA6,
-    0x0D, 0x80, 0x38, 0xFC, 0x01, 0x0D, 0x2D, 0x02, 0x9A, 0x23, 0x3E, 0xD5, 0xD9, 0xC2, 0x3D, 0xDB,
-    0xE9, 0x7C, 0x40, 0x33, 0x05, 0x66, 0xB6, 0x5B, 0x35, 0x7F, 0xE9, 0xA3, 0x7E, 0x5F, 0xB4, 0x31,
-    0x73, 0x59, 0x36, 0x66, 0xDA, 0x49, 0x59, 0x6B, 0x78, 0xAA, 0x0C, 0xF4, 0x21, 0xE8, 0xFE, 0xD1,
-    0x6B, 0xA5, 0x0C, 0x25, 0x48, 0xC0, 0x62, 0x0D, 0x76, 0x41, 0xF3, 0x1A, 0x2B, 0xAF, 0xC0, 0x4A,
-    0xC7, 0xD8, 0x99, 0x41, 0xD0, 0xBF, 0x29, 0xF1, 0x7E, 0x81, 0x77, 0x3A, 0x01, 0x8A, 0x23, 0x81,
-    0x55, 0xB7, 0x3A, 0x1B, 0xD5, 0x0C, 0x2B, 0x65, 0x0E, 0xFB, 0x1B, 0x0A, 0xBB, 0x26, 0xE4, 0x9A,
-    0x28, 0xAB, 0x0F, 0xC2, 0x21, 0x67, 0x5B, 0xD3, 0x2A, 0x9A, 0x36, 0xC9, 0x3E, 0xEA, 0xF7, 0xBD,
-    0xAA, 0x35, 0x4D, 0xA8, 0x94, 0x37, 0x59, 0xE9, 0x6F, 0x02, 0x99, 0x66, 0x8A, 0x73, 0xE6, 0x6F,
-    0xD5, 0xB3, 0xC6, 0xD0, 0x55, 0x7A, 0x9E, 0xA6, 0xBB, 0xB4, 0x39, 0x51, 0x57, 0xD2, 0x9B, 0x3C,
-    0xE7, 0x18, 0x73, 0x64, 0xBD, 0x00, 0x97, 0x2E, 0x65, 0x94, 0x12, 0xC5, 0x1D, 0xCF, 0xAB, 0x7C,
-    0xD4, 0x9D, 0xAB, 0xBC, 0xFB, 0xD4, 0xFC, 0xD7, 0xF4, 0xD5, 0xC2, 0x7B, 0x45, 0xBB, 0xB5, 0x01,
-    0x0F, 0xDC, 0xA5, 0x66, 0xAA, 0xDF, 0xCF, 0x0A, 0x28, 0x51, 0xC3, 0xDA, 0x79, 0x8B, 0xF2, 0x80,
-    0x8F, 0x5E, 0x93, 0x36, 0xBB, 0xF4, 0x42, 0x85, 0x04, 0xFC, 0xC9, 0x14, 0xD8, 0x71, 0x11, 0x6A,
-    0x2A, 0x89, 0xAC, 0x9B, 0xC8, 0x98, 0x2C, 0xE0, 0x97, 0x18, 0xD9, 0xB9, 0x43, 0x13, 0x8E, 0x8C,
-    0xF5, 0xC2, 0xBA, 0x10, 0xDA, 0x28, 0x0B, 0xAA, 0xC4, 0x56, 0xB7, 0xD0, 0x09, 0xFC, 0x01, 0xBD,
-    0xB4, 0x2E, 0x56, 0xFA, 0xC3, 0x19, 0x4C, 0x30, 0x85, 0x4F, 0xA6, 0xB0, 0xB7, 0xE8, 0x9C, 0xB5,
-    0x24, 0xF4, 0xDE, 0x2E, 0x5F, 0x56, 0xD0, 0x69, 0xCB, 0x9A, 0x70, 0xE2, 0x92, 0xBC, 0xDF, 0xDF,
-    0x08, 0x7F, 0x80, 0x97, 0x73, 0x3A, 0xCC, 0xBE, 0x7C, 0xC6, 0x98, 0x70, 0x3F, 0x4D, 0x47, 0xB5,
-    0x75, 0xD5, 0xB9, 0x34, 0xDD, 0x68, 0xEC, 0xB0, 0x68, 0x99, 0x51, 0xB3, 0x79, 0x4C, 0xE4, 0x32,
-    0xD0, 0xCA, 0xE6, 0xA9, 0xFE, 0x3F, 0xFF, 0xCC, 0x76, 0x65, 0xEB, 0x1F, 0x99, 0x49, 0x22, 0xF3,
-    0xC7, 0xF4, 0x9A, 0x93, 0xDE, 0xB0, 0x95, 0x8D, 0x91, 0xA6, 0xF6, 0x09, 0xCA, 0x52, 0x0D, 0xDB,
-    0xBC, 0x1C, 0xC9, 0xBE, 0x26, 0x46, 0x9C, 0xD8, 0xA5, 0x0D, 0x3A, 0x6F, 0xB3, 0xC3, 0xAE, 0x98,
-    0x74, 0xC8, 0xD7, 0x26, 0x4E, 0x4E, 0xD5, 0xC6, 0x97, 0x0B, 0xEB, 0x91, 0x5B, 0x3C, 0x90, 0xC8,
-    0xB7, 0xAD, 0x87, 0xE1, 0xDC, 0x35, 0xE4, 0xE7, 0xF9, 0xBB, 0x5D, 0x02, 0x27, 0x69, 0x9A, 0x5E,
-    0xC3, 0x7F, 0xFC, 0xCE, 0xAD, 0x2B, 0x34, 0x8E, 0x22, 0x81, 0x73, 0x71, 0x26, 0xAC, 0x03, 0x08,
-    0x0F, 0x81, 0xBC, 0xA0, 0xB2, 0xBE, 0x96, 0x1D, 0x35, 0x04, 0x35, 0x6E, 0xA9, 0x44, 0xF3, 0x5E,
-    0x47, 0x65, 0xC2, 0xEE, 0xD9, 0x53, 0xDC, 0x3F, 0xB0, 0xDB, 0x98, 0xA4, 0xEB, 0x4D, 0x9D, 0x2E,
-    0x2D, 0x68, 0x70, 0x8E, 0xE8, 0x0E, 0x9B, 0xE0, 0x8E, 0x2D, 0x9A, 0xBA, 0xED, 0x89, 0xE5, 0xD7,
-    0x6E, 0xDF, 0x60, 0xCC, 0x79, 0x28, 0x10, 0x95, 0x94, 0x67, 0xA3, 0xD7, 0x83, 0xFC, 0xF6, 0xD3,
-    0x89, 0x20, 0xB8, 0xDE, 0x0C, 0xC5, 0x75, 0xE6, 0x4C, 0x1F, 0xD7, 0xAF, 0x04, 0x5E, 0xD2, 0x6C,
-    0xB1, 0x3B, 0xE1, 0x9E, 0x49, 0x38, 0xBA, 0x97, 0xAF, 0xEF, 0x39, 0x0F, 0xE2, 0x97, 0xF6, 0x9C,
-    0x83, 0x62, 0x10, 0x9A, 0x78, 0x2B, 0xD1, 0x97, 0xEB, 0x68, 0xDF, 0x96, 0x94, 0x8D, 0x16, 0xB9,
-    0x16, 0x1D, 0x63, 0xB1, 0x32, 0xAD, 0xC1, 0x54, 0xA8, 0xF1, 0xDC, 0xBA, 0x34, 0x4A, 0xCA, 0x78,
-    0xA9, 0x8F, 0xD7, 0x06, 0x95, 0x30, 0x30, 0x78, 0xED, 0x54, 0x50, 0x33, 0x48, 0xD6, 0x19, 0x9C,
-    0x1C, 0x1A, 0xC2, 0x88, 0x1D, 0x18, 0xE8, 0x3E, 0x62, 0xCB, 0x5B, 0x05, 0xEF, 0x27, 0xE0, 0x19,
-    0x30, 0xBF, 0xB2, 0xBC, 0xC5, 0x66, 0xD4, 0xF1, 0x3C, 0xD5, 0x00, 0x6E, 0x18, 0xAF, 0x86, 0x73,
-    0xFF, 0xFE, 0x07, 0x47, 0x93, 0xDF, 0xB9, 0x75, 0x00, 0x47, 0x95, 0xAA, 0xF2, 0x93, 0x61, 0x3E,
-    0x1C, 0xE9, 0xB7, 0x4C, 0x7E, 0x15, 0xDA, 0xED, 0xA2, 0x8B, 0xDE, 0x16, 0x53, 0x0E, 0xEB, 0x9E,
-    0xFF, 0xF3, 0xEF, 0xDF, 0xCF, 0xA3, 0x7C, 0xF5, 0x4D, 0xA9, 0xD4, 0x41, 0xA2, 0x93, 0x97, 0x06,
-    0xEE, 0xDC, 0xFD, 0xF0, 0xB8, 0x9C, 0xD7, 0x41, 0xED, 0x1A, 0x59, 0x91, 0x25, 0x9B, 0x8E, 0xB6,
-    0x9E, 0x58, 0x7D, 0x35, 0x97, 0x83, 0xAF, 0x4F, 0xFA, 0x27, 0xC0, 0xA1, 0x89, 0x94, 0xE1, 0xA2,
-    0xD4, 0xF3, 0x7A, 0x55, 0xBA, 0x42, 0x12, 0x26, 0x1D, 0x1A, 0x6D, 0x49, 0xB5, 0x48, 0xF4, 0x59,
-    0x8F, 0x6C, 0x69, 0xB6, 0x0F, 0xB7, 0xEA, 0x70, 0xEA, 0xD8, 0x8A, 0x53, 0x77, 0xB5, 0x87, 0xDD,
-    0xA1, 0xC1, 0x2D, 0x4A, 0x2B, 0x19, 0x42, 0xDA, 0x75, 0x42, 0x72, 0x16, 0xDA, 0x3E, 0x7A, 0xB6,
-    0xF7, 0x05, 0xD7, 0xC5, 0xCD, 0xA5, 0xD0, 0x7B, 0x6F, 0xFF, 0x71, 0x39, 0x18, 0xEB, 0x17, 0xFB,
-    0x71, 0xCE, 0x49, 0x1A, 0x6B, 0x6C, 0x58, 0x6C, 0x11, 0x65, 0xB4, 0xDC, 0x4F, 0xD8, 0x82, 0x08,
-    0x8C, 0xE9, 0x98, 0xC0, 0x84, 0xF6, 0xA1, 0xED, 0x8F, 0xF0, 0x8F, 0x97, 0x03, 0x23, 0x21, 0xF1,
-    0x31, 0x45, 0xA3, 0x01, 0x81, 0x99, 0x0C, 0x58, 0xA3, 0xE8, 0x15, 0x3E, 0xFB, 0x23, 0x8E, 0xE9,
-    0x4B, 0x38, 0xD1, 0xA3, 0x37, 0xC6, 0xBD, 0xB6, 0x98, 0x5A, 0x94, 0x7B, 0x7F, 0x22, 0x38, 0x08,
-    0xB6, 0xA9, 0x4D, 0xA4, 0x50, 0x9A, 0x0E, 0x51, 0xC1, 0x17, 0x3E, 0xE6, 0x11, 0x76, 0xDA, 0x09,
-    0xB6, 0xFB, 0xEC, 0x8F, 0x9A, 0xFD, 0xB1, 0xC7, 0x18, 0x0C, 0xC8, 0x89, 0xFD, 0xD1, 0x61, 0x7F,
-    0xF4, 0xDE, 0x4F, 0x5A, 0x60, 0x85, 0x65, 0x57, 0xD0, 0xB9, 0x5A, 0xBE, 0xCE, 0x9A, 0x58, 0xB1,
-    0x2E, 0xC6, 0xC3, 0xD8, 0xC3, 0xC8, 0x21, 0x11, 0xA4, 0xF8, 0xF7, 0x0A, 0x51, 0x87, 0xCC, 0x23,
-    0x26, 0xD7, 0x08, 0xE6, 0x3C, 0x00, 0xB7, 0x63, 0x66, 0xDF, 0xF3, 0x11, 0xAC, 0x87, 0xC2, 0xAF,
-    0x7E, 0x8E, 0x84, 0x03, 0x10, 0x0E, 0x61, 0xFE, 0x0E, 0x4C, 0x09, 0x01, 0x0C, 0xBD, 0x3F, 0xC7,
-    0xC8, 0xA2, 0x39, 0xA8, 0xA0, 0xDC, 0x89, 0xEA, 0x93, 0xF7, 0xF2, 0x2E, 0x14, 0x87, 0x05, 0xF3,
-    0x19, 0xFC, 0xB8, 0x66, 0xB3, 0xDF, 0xEB, 0xEE, 0xE2, 0xEB, 0xDF, 0x6C, 0x63, 0x70, 0xE7, 0x1A,
-    0x9C, 0x38, 0x1C, 0xC5, 0x12, 0xCD, 0x1A, 0x89, 0x22, 0x67, 0x3A, 0x60, 0xEA, 0x89, 0x4D, 0x46,
-    0x3C, 0xDE, 0x90, 0x2F, 0xBF, 0x96, 0x38, 0x75, 0xA2, 0x26, 0x87, 0x77, 0xA1, 0xB3, 0x01, 0x66,
-    0x9C, 0xDA, 0x92, 0x58, 0x9E, 0x48, 0xD7, 0x27, 0xF4, 0x6F, 0xD8, 0x01, 0xF5, 0xCB, 0xAF, 0xB3,
-    0x9F, 0xD7, 0x84, 0xCA, 0x05, 0xEF, 0x1D, 0xCD, 0xBE, 0xD5, 0xED, 0x39, 0x13, 0x6D, 0x1D, 0x54,
-    0x6F, 0xBC, 0xB0, 0x90, 0xFF, 0xA5, 0xB5, 0x6C, 0x72, 0x4A, 0x98, 0xB8, 0x77, 0x8E, 0xCD, 0xAF,
-    0x26, 0xE5, 0xB2, 0x99, 0x9C, 0x91, 0xE5, 0x58, 0xD4, 0x0D, 0x59, 0x72, 0x4D, 0xE5, 0xDE, 0x3D,
-    0xCC, 0x1E, 0x14, 0x13, 0x85, 0x70, 0x7D, 0x6A, 0xFC, 0x12, 0x14, 0x84, 0x1B, 0xCC, 0xD1, 0xA5,
-    0x7E, 0xBF, 0xBF, 0x90, 0xFC, 0x1D, 0x50, 0x39, 0x11, 0xEE, 0x83, 0xB8, 0xE1, 0xEC, 0xCA, 0x25,
-    0x53, 0xAC, 0x46, 0xD9, 0x5F, 0xEE, 0xE7, 0xD9, 0xF4, 0x65, 0xB4, 0x9F, 0x8B, 0x72, 0x4A, 0xCF,
-    0x9C, 0x0F, 0xCD, 0xEC, 0xD6, 0xC0, 0x37, 0x6F, 0xCB, 0x79, 0xC8, 0x11, 0x15, 0x1C, 0xA7, 0xD9,
-    0x1D, 0x0E, 0x01, 0xEA, 0xCA, 0x6F, 0x4E, 0xD8, 0x9F, 0xCB, 0x6E, 0x72, 0x98, 0xAC, 0x7B, 0xBF,
-    0xEC, 0x8F, 0x5A, 0xD2, 0xCB, 0xE8, 0x58, 0x4B, 0xFD, 0xAD, 0x1F, 0x82, 0x9A, 0x8E, 0x52, 0xF1,
-    0x51, 0x67, 0x73, 0xF5, 0xE3, 0x3F, 0x6F, 0x62, 0xDB, 0x77, 0x8F, 0xD3, 0x04, 0x90, 0xFB, 0xDE,
-    0x7F, 0xD1, 0xA2, 0x63, 0x78, 0x1A, 0xC4, 0xB7, 0x59, 0xBC, 0x40, 0x5C, 0xCC, 0xC5, 0x4E, 0xDB,
-    0xF3, 0xEA, 0x15, 0x50, 0x5B, 0xDA, 0xB6, 0x1D, 0x8F, 0x87, 0x98, 0xCC, 0x0A, 0xFE, 0x45, 0x85,
-    0xB8, 0x40, 0x8B, 0xCF, 0x7B, 0xDA, 0xDC, 0x9C, 0xBA, 0xD1, 0x47, 0x6D, 0x78, 0x6C, 0xBD, 0xB2,
-    0x33, 0xAF, 0xAD, 0x69, 0xF0, 0x11, 0x0E, 0x08, 0xA7, 0x2C, 0x42, 0xBB, 0xBD, 0x51, 0xEF, 0x54,
-    0x96, 0xE0, 0x57, 0xF3, 0x67, 0x8B, 0xE5, 0x49, 0xB4, 0x4E, 0x8E, 0xDB, 0xEB, 0x4D, 0x71, 0x90,
-    0xF7, 0x98, 0x24, 0x63, 0x6F, 0xCE, 0x8F, 0x03, 0x13, 0x43, 0xE6, 0xB0, 0x70, 0x30, 0xDC, 0x23,
-    0xAF, 0x13, 0xF2, 0xC7, 0x24, 0xA7, 0x2B, 0x16, 0x29, 0x74, 0xBD, 0x10, 0x51, 0xB4, 0x5B, 0xB0,
-    0xF6, 0x18, 0xDB, 0xAE, 0xD4, 0xB4, 0x02, 0x26, 0x74, 0x14, 0x5E, 0xE3, 0x98, 0xE5, 0x47, 0xE5,
-    0x70, 0x0C, 0xE7, 0xC0, 0x59, 0xFC, 0xD2, 0x1A, 0x9B, 0x83, 0xBB, 0x6E, 0xA5, 0x90, 0x33, 0x77,
-    0x60, 0x2B, 0x54, 0xDD, 0xB1, 0xA9, 0xD8, 0xF0, 0x1A, 0x9A, 0xE3, 0x98, 0xC3, 0x56, 0xB9, 0x8C,
-    0xC1, 0x69, 0x31, 0x6C, 0x79, 0xCD, 0xB0, 0x45, 0xE0, 0xC6, 0x6D, 0x27, 0xB5, 0xE3, 0xD5, 0xC9,
-    0xB0, 0x55, 0xB7, 0xC3, 0xD6, 0x3B, 0xB3, 0x6E, 0xD8, 0xDA, 0xED, 0x3E, 0x49, 0x38, 0x1B, 0x34,
-    0x13, 0x9D, 0x6E, 0x57, 0xE7, 0x50, 0x17, 0x18, 0xBC, 0x9F, 0x9A, 0x74, 0x7E, 0x53, 0x17, 0x78,
-    0x37, 0xC3, 0x3B, 0x97, 0xA3, 0x23, 0xA6, 0xC6, 0x82, 0xFF, 0x58, 0x69, 0xC7, 0xE0, 0x8F, 0x55,
-    0x90, 0x04, 0xAC, 0x7E, 0x28, 0x35, 0xD1, 0x65, 0xE8, 0x39, 0xFC, 0x24, 0x4D, 0xE3, 0x88, 0x43,
-    0xBC, 0x77, 0x9C, 0x5E, 0x6F, 0x86, 0x52, 0x36, 0x31, 0xDA, 0xC0, 0xC9, 0xA3, 0x1D, 0xB0, 0x9B,
-    0x5C, 0xD1, 0x9F, 0x91, 0xAF, 0x38, 0xF6, 0x52, 0xC3, 0xFC, 0x5C, 0x3A, 0xCA, 0x40, 0xDB, 0xC3,
-    0x87, 0x01, 0x46, 0x51, 0x44, 0x83, 0xA5, 0x6F, 0x4C, 0x5F, 0x14, 0xA8, 0xE0, 0x41, 0x33, 0xC8,
-    0x5A, 0x6D, 0x6A, 0xAE, 0xA8, 0x4D, 0xB6, 0xFC, 0xCE, 0xF1, 0xA8, 0x0A, 0x29, 0xFA, 0xCA, 0x3C,
-    0x8D, 0x5B, 0x89, 0xCF, 0xC8, 0x5F, 0x3A, 0x41, 0x37, 0xE6, 0xE3, 0x09, 0x7B, 0xDB, 0x5B, 0x1C,
-    0x9F, 0x6D, 0xD7, 0xAC, 0xA5, 0x29, 0x76, 0x8D, 0x13, 0xC7, 0x8B, 0x89, 0x7C, 0xF1, 0x91, 0x62,
-    0x1B, 0x6C, 0x54, 0x34, 0x78, 0x31, 0x89, 0xFD, 0x52, 0x51, 0x1D, 0xBE, 0x81, 0xDE, 0xBE, 0xDF,
-    0x4D, 0xBA, 0xD3, 0x76, 0xE8, 0x37, 0x89, 0x6F, 0x67, 0x6B, 0x91, 0xAD, 0x49, 0xD7, 0x92, 0x1B,
-    0x56, 0x71, 0xFB, 0x7D, 0x24, 0x8B, 0x38, 0xE9, 0xAE, 0x81, 0xB0, 0x67, 0x2B, 0xC3, 0x83, 0x65,
-    0x48, 0x7F, 0xAC, 0x74, 0x79, 0xA1, 0x98, 0x37, 0x96, 0x7D, 0xD6, 0x70, 0x5D, 0xB1, 0x52, 0x80,
-    0x38, 0xFF, 0xE3, 0x8F, 0xE1, 0x94, 0x64, 0xDB, 0xCF, 0x83, 0xF8, 0x82, 0x0C, 0xBC, 0xC4, 0x8B,
-    0xFD, 0xCB, 0x39, 0x52, 0xE1, 0x51, 0x81, 0x64, 0x7A, 0xE5, 0x5D, 0xB9, 0x20, 0x2E, 0xC2, 0x15,
-    0x8B, 0x39, 0xB9, 0x4A, 0x12, 0x1F, 0x92, 0x78, 0x10, 0x63, 0xE7, 0x76, 0x89, 0x9D, 0x6B, 0xAB,
-    0x20, 0xAE, 0xBA, 0x85, 0x17, 0x6B, 0xB4, 0xBC, 0x02, 0xD3, 0xD5, 0xD1, 0xEF, 0x31, 0x14, 0x68,
-    0xFB, 0x31, 0xB2, 0x62, 0x0D, 0x3D, 0x91, 0xF9, 0xD1, 0x37, 0x29, 0x53, 0x28, 0x53, 0x28, 0x13,
-    0xA4, 0xCB, 0xB4, 0xED, 0x11, 0xAD, 0x81, 0x4C, 0xA1, 0xCC, 0xF6, 0x83, 0x74, 0x21, 0x53, 0x28,
-    0x13, 0xD7, 0x01, 0xAD, 0xDD, 0xE6, 0x1A, 0x32, 0x85, 0x32, 0x19, 0x7F, 0xB6, 0x27, 0xC8, 0x54,
-    0xCF, 0x21, 0x33, 0x07, 0xA8, 0xBD, 0xB1, 0xA8, 0xA7, 0x97, 0xEF, 0xE5, 0xAA, 0x7A, 0x54, 0x0C,
-    0x54, 0x75, 0xE1, 0x5D, 0x6F, 0xBF, 0x82, 0xCC, 0x9D, 0x52, 0xEC, 0xC7, 0x7D, 0x94, 0x03, 0xF7,
-    0x41, 0xA9, 0x9E, 0xE6, 0xEE, 0x43, 0x55, 0x0E, 0xE4, 0xE0, 0x52, 0xE9, 0xE5, 0xDB, 0x18, 0x0C,
-    0x07, 0x6B, 0xAB, 0xA5, 0x78, 0xFF, 0xE2, 0x28, 0x31, 0xFC, 0x2A, 0x32, 0x63, 0xCA, 0x4C, 0x28,
-    0x13, 0xD2, 0x21, 0x53, 0x28, 0x13, 0x0F, 0xC8, 0x04, 0x54, 0x0C, 0x1F, 0x90, 0x59, 0x51, 0x26,
-    0xC6, 0x90, 0x87, 0x84, 0xCF, 0x01, 0x47, 0x90, 0xED, 0x47, 0x15, 0xED, 0xAC, 0x68, 0x67, 0xF5,
-    0x05, 0x76, 0x76, 0xD3, 0x58, 0xF4, 0xE9, 0x4F, 0x86, 0x17, 0x22, 0x2C, 0xA7, 0x59, 0xFA, 0x5B,
-    0xA2, 0x91, 0x48, 0x49, 0x4E, 0x63, 0xD0, 0xBE, 0x03, 0xA0, 0x9D, 0x16, 0x75, 0x4D, 0x2E, 0x42,
-    0xBB, 0x99, 0xED, 0x3F, 0x59, 0x12, 0x94, 0x33, 0x9C, 0x52, 0xDD, 0xB7, 0xF6, 0x7F, 0x00, 0x3D,
-    0xCE, 0xD1, 0x0D, 0x83, 0x30, 0x0C, 0x04, 0x50, 0x13, 0x7F, 0xF2, 0x91, 0x15, 0x3A, 0x01, 0x19,
-    0x01, 0xC4, 0x1A, 0x9D, 0xA0, 0x53, 0x96, 0x15, 0xCA, 0x04, 0x16, 0x0C, 0x80, 0x07, 0x88, 0xB8,
-    0x9E, 0x5D, 0xA9, 0xFE, 0x79, 0x39, 0xE5, 0x22, 0x47, 0x44, 0x1E, 0x12, 0x53, 0x2C, 0x69, 0x49,
-    0x41, 0x32, 0x3D, 0x83, 0xB2, 0xE5, 0xDD, 0x24, 0x03, 0x29, 0xFD, 0x15, 0xA9, 0x01, 0x6A, 0xAC,
-    0x01, 0xD5, 0x22, 0xF4, 0x66, 0x11, 0xFC, 0x6D, 0x0C, 0x58, 0x71, 0x00, 0xF7, 0x52, 0x71, 0x02,
-    0x9B, 0xB0, 0x0A, 0xB0, 0xE4, 0x8A, 0x3E, 0xF2, 0xA4, 0xAC, 0xC1, 0xC9, 0x87, 0x81, 0xF0, 0x59,
-    0x70, 0x31, 0x88, 0xF6, 0xEA, 0x81, 0xCF, 0xB1, 0x5F, 0x77, 0x4F, 0x90, 0x5F, 0x53, 0xFF, 0x21,
-    0xFF, 0xF9, 0x02,
+static const uint8_t bookerly_14_regularBitmaps[27716] = {
+    0xCD, 0x9B, 0x3F, 0x8C, 0x27, 0xB7, 0x95, 0xE7, 0x3F, 0x2C, 0xAA, 0x87, 0xBB, 0x2A, 0xEC, 0x72,
+    0x82, 0x99, 0xB5, 0x6F, 0x47, 0x67, 0x3A, 0x70, 0x70, 0x07, 0xC8, 0xAA, 0xC4, 0x81, 0x82, 0xEE,
+    0x26, 0x25, 0x1D, 0xE0, 0xC0, 0x81, 0xFA, 0x70, 0xD3, 0xBB, 0xC0, 0x6D, 0xA0, 0x4B, 0xD7, 0x07,
+    0xEC, 0x38, 0x70, 0xE0, 0xA0, 0xBB, 0xAB, 0x04, 0x05, 0x0E, 0x1C, 0x78, 0x2E, 0xD9, 0xD4, 0x0A,
+    0x16, 0x38, 0x6F, 0x2F, 0x70, 0xE3, 0x40, 0xC1, 0x1C, 0xAE, 0xBB, 0x8B, 0x33, 0x13, 0x08, 0x38,
+    0x05, 0xA6, 0x2C, 0xDC, 0x39, 0x50, 0xA0, 0xDA, 0x93, 0x16, 0x5A, 0xAC, 0x02, 0x71, 0x34, 0x25,
+    0xAB, 0x66, 0xC4, 0xFA, 0xBD, 0x0B, 0xEA, 0xD7, 0xD3, 0x33, 0x92, 0xF5, 0xC7, 0xB6, 0x04, 0x2D,
+    0x51, 0x55, 0x3F, 0xD6, 0xAB, 0x2A, 0xF2, 0x91, 0x7C, 0x7C, 0x7C, 0xEF, 0xCB, 0xF7, 0xFB, 0x73,
+    0xF7, 0xCA, 0xFF, 0x1B, 0x8F, 0x9B, 0xEF, 0xDD, 0xCC, 0x47, 0x8D, 0xB9, 0x91, 0xF7, 0xAC, 0x8E,
+    0x19, 0x08, 0xA5, 0x7F, 0xEE, 0x46, 0xF8, 0xFA, 0x39, 0x67, 0x5E, 0xB9, 0x79, 0x3B, 0x1F, 0xED,
+    0x39, 0x67, 0x5E, 0xBE, 0x71, 0x3B, 0xEF, 0x7D, 0xE7, 0x4F, 0x58, 0xD2, 0xA6, 0x8E, 0x98, 0xEE,
+    0x49, 0x78, 0xC9, 0x04, 0x2C, 0xBF, 0xE0, 0xF0, 0xDE, 0xB5, 0xBF, 0xB7, 0x22, 0x92, 0xAA, 0xF4,
+    0x04, 0x3C, 0x5E, 0x45, 0x74, 0xDC, 0x84, 0x27, 0x75, 0xA4, 0xEE, 0xAE, 0xE3, 0x45, 0xE4, 0xDC,
+    0xB5, 0xC3, 0x7B, 0x2F, 0x92, 0x2D, 0x7C, 0x43, 0x0D, 0x54, 0xE9, 0xDB, 0x4B, 0x31, 0x67, 0x69,
+    0x13, 0x74, 0x84, 0x27, 0x41, 0x77, 0x9C, 0x93, 0xAB, 0x95, 0x48, 0x77, 0xFC, 0xE4, 0x6C, 0x9F,
+    0x79, 0xE6, 0x1F, 0xF3, 0x77, 0xB6, 0x9C, 0x7E, 0xEA, 0xA9, 0xE9, 0x87, 0xD8, 0x0F, 0x03, 0x7E,
+    0x82, 0x7E, 0x82, 0x3E, 0x53, 0x37, 0x31, 0xFC, 0x62, 0x7F, 0xB3, 0xD6, 0x6F, 0xC7, 0x5F, 0x6C,
+    0x1D, 0x58, 0x73, 0x6B, 0xBA, 0x3D, 0x39, 0x59, 0xD1, 0xAC, 0x02, 0x16, 0xC8, 0x3C, 0xF8, 0xB3,
+    0xF3, 0x40, 0x6D, 0x24, 0x94, 0x04, 0x1C, 0xF4, 0x33, 0x3A, 0xE1, 0xAA, 0xCC, 0x75, 0xF4, 0x60,
+    0x83, 0x85, 0x2D, 0xA6, 0x2A, 0xA1, 0x63, 0xDD, 0x6D, 0xC2, 0x1E, 0xD7, 0x2D, 0xE8, 0x64, 0x9F,
+    0x1F, 0x60, 0x8B, 0x71, 0xD3, 0x4C, 0x55, 0x6E, 0xCC, 0x33, 0x92, 0xED, 0xBB, 0x29, 0x1F, 0xD9,
+    0xCE, 0xE7, 0xC7, 0x6D, 0x38, 0x02, 0xF3, 0x7C, 0xD6, 0x11, 0x72, 0xC3, 0x16, 0x3C, 0x51, 0x65,
+    0x9D, 0xD0, 0xB1, 0x61, 0x13, 0x5E, 0x52, 0xD9, 0x44, 0x1C, 0x36, 0x4C, 0xE8, 0xC4, 0x49, 0x0B,
+    0xD7, 0xA9, 0x24, 0x52, 0x83, 0x0A, 0x3C, 0x94, 0x9A, 0x01, 0x70, 0x12, 0xC1, 0x0C, 0x07, 0x40,
+    0xD1, 0x03, 0xD8, 0xEE, 0x09, 0x60, 0xD2, 0x09, 0x6C, 0xB7, 0x07, 0x14, 0x07, 0xD4, 0x37, 0x3A,
+    0x60, 0xC5, 0xC5, 0xCB, 0xB4, 0xB9, 0x96, 0x64, 0x7F, 0x16, 0xAF, 0xFC, 0xB3, 0xCE, 0x27, 0xEC,
+    0xB1, 0xAD, 0x27, 0x13, 0x4D, 0xB2, 0xC3, 0x1E, 0xFB, 0xF8, 0x1F, 0x47, 0x33, 0x20, 0x23, 0x9E,
+    0x4A, 0xA8, 0x66, 0xEC, 0x2A, 0xD4, 0xAB, 0x6B, 0x1F, 0xCA, 0x55, 0x27, 0x53, 0x3D, 0xB3, 0xB1,
+    0xC3, 0x06, 0x5F, 0xDF, 0x3B, 0xDA, 0xDB, 0xDB, 0xDB, 0xDB, 0xFB, 0x0E, 0xA0, 0xA2, 0x1A, 0x19,
+    0x99, 0x38, 0x62, 0x1F, 0x8F, 0x0D, 0x75, 0xD4, 0x03, 0x23, 0xFB, 0x34, 0xD4, 0xB1, 0xCA, 0x1C,
+    0xE1, 0x82, 0x49, 0x4C, 0x78, 0x4C, 0xA2, 0xD0, 0x04, 0x9D, 0x69, 0x31, 0x03, 0x07, 0x18, 0xA0,
+    0x8A, 0x78, 0x28, 0xE8, 0x8C, 0xEB, 0x28, 0x98, 0x01, 0x8F, 0x1A, 0xB1, 0x1D, 0x85, 0x3A, 0x72,
+    0xF4, 0xC0, 0xC5, 0x76, 0x8C, 0x38, 0x74, 0x66, 0x0B, 0x1B, 0x55, 0x66, 0x1B, 0xDB, 0x55, 0x99,
+    0xAF, 0x03, 0x50, 0xA5, 0xC7, 0xB6, 0xF5, 0x9D, 0xE8, 0xC6, 0x1D, 0x27, 0xF5, 0xFB, 0x77, 0xEE,
+    0x74, 0x8F, 0x6F, 0xA2, 0x07, 0xCE, 0x03, 0x60, 0x17, 0x91, 0xC9, 0xB0, 0x09, 0x16, 0x2B, 0x72,
+    0x47, 0xA4, 0xB0, 0xF5, 0x91, 0x27, 0x1B, 0xC0, 0x8E, 0x8B, 0x3E, 0x14, 0x9D, 0x5D, 0x28, 0x26,
+    0x6E, 0x01, 0xDF, 0x3F, 0x6C, 0xE5, 0x1D, 0x19, 0x37, 0x74, 0xF1, 0xB7, 0xA6, 0x0D, 0xC0, 0x81,
+    0xED, 0x30, 0x91, 0x6A, 0x80, 0x11, 0x8E, 0x60, 0xEB, 0x01, 0xAA, 0x1E, 0x20, 0x9F, 0x52, 0x1B,
+    0xB0, 0x61, 0x4D, 0x55, 0x19, 0xAE, 0x9F, 0x52, 0xD5, 0xFD, 0x61, 0x9C, 0x51, 0x22, 0xD1, 0xDC,
+    0x7D, 0x2E, 0xDB, 0xA4, 0xA7, 0xA6, 0x53, 0xC5, 0xC3, 0xEC, 0xE1, 0xF8, 0x00, 0x4E, 0x4E, 0xE0,
+    0xE0, 0x18, 0xDA, 0xE3, 0xE5, 0xF7, 0xE0, 0x04, 0x4E, 0x0E, 0xE0, 0xB8, 0x85, 0xE2, 0x51, 0x53,
+    0x13, 0x75, 0xB6, 0x83, 0x1D, 0x8C, 0x48, 0x87, 0xCC, 0xB0, 0xB1, 0x88, 0x49, 0x8D, 0x12, 0xBC,
+    0xE0, 0x05, 0xFC, 0xE7, 0x3C, 0xC2, 0x25, 0x99, 0xBD, 0xCC, 0x00, 0x97, 0x24, 0xD4, 0xB2, 0xD2,
+    0xD3, 0xA5, 0xF1, 0x00, 0xFF, 0x93, 0xA8, 0xCA, 0x11, 0xEE, 0x46, 0x50, 0x05, 0x9A, 0x80, 0xCE,
+    0x30, 0x43, 0xD3, 0x51, 0x0F, 0x54, 0x13, 0x9C, 0xDC, 0xBF, 0x19, 0xA1, 0x3F, 0x3C, 0xFC, 0x07,
+    0x11, 0xF1, 0x22, 0x09, 0xE0, 0xCA, 0x8C, 0x48, 0x5A, 0x3D, 0x5D, 0xF6, 0xF1, 0x7F, 0x4A, 0x9D,
+    0xD0, 0x19, 0x55, 0x50, 0x05, 0x53, 0x68, 0xA4, 0x33, 0x52, 0xA0, 0xED, 0x30, 0x19, 0x0A, 0xB4,
+    0xE0, 0x3B, 0x9A, 0x48, 0xFF, 0xEA, 0x35, 0x49, 0x5E, 0x82, 0xBA, 0x7C, 0xBF, 0xA7, 0x00, 0x01,
+    0x25, 0xA0, 0x05, 0xEC, 0xBB, 0xD0, 0x5C, 0x81, 0x83, 0x06, 0x4A, 0x43, 0x95, 0x1B, 0x4C, 0x6A,
+    0xB0, 0x5D, 0x83, 0xA7, 0xE1, 0x98, 0x26, 0x88, 0xC8, 0xAA, 0x15, 0x59, 0x6D, 0xEC, 0x5E, 0xB9,
+    0xBC, 0x7C, 0xFF, 0xE0, 0x79, 0x11, 0x2D, 0xD2, 0x79, 0x29, 0xFA, 0xDE, 0x61, 0xB7, 0x0F, 0x26,
+    0xC2, 0x1E, 0xD4, 0x09, 0xFA, 0x89, 0x5A, 0x26, 0xBE, 0x2F, 0x03, 0x4A, 0x02, 0x7A, 0x02, 0x17,
+    0x51, 0x13, 0x34, 0x1D, 0x7A, 0x04, 0x81, 0x3E, 0xFE, 0x57, 0xC9, 0x46, 0x46, 0x36, 0x4E, 0xD5,
+    0xC5, 0xA5, 0x82, 0x95, 0xAB, 0x66, 0x85, 0x5A, 0x41, 0x1B, 0xB0, 0x09, 0x55, 0xC0, 0xEF, 0x06,
+    0x2D, 0xD2, 0xB5, 0x22, 0x75, 0xD2, 0xE5, 0x18, 0xFB, 0x46, 0xE2, 0xE4, 0x18, 0xF3, 0xCE, 0xC0,
+    0x41, 0x8B, 0x79, 0x73, 0x64, 0x6E, 0x52, 0x13, 0x45, 0x72, 0x25, 0x13, 0xEA, 0x32, 0x4E, 0x64,
+    0x10, 0x91, 0xD7, 0x44, 0xC4, 0x06, 0x35, 0x6D, 0x62, 0x63, 0xE6, 0x18, 0xF4, 0x00, 0x1E, 0xD4,
+    0x08, 0x36, 0xC2, 0x3E, 0xE8, 0x0C, 0xAE, 0x83, 0x02, 0x26, 0x43, 0x13, 0xA0, 0x2C, 0x54, 0xDB,
+    0xC1, 0x36, 0xAC, 0xE5, 0x1F, 0x23, 0x9D, 0x16, 0x61, 0x36, 0xA5, 0x09, 0xF6, 0x56, 0xE6, 0xC8,
+    0x53, 0xDF, 0x9C, 0x98, 0x6C, 0xF6, 0xF8, 0x77, 0x23, 0x92, 0x69, 0x24, 0xD9, 0x24, 0x2F, 0xE4,
+    0x6A, 0x3E, 0xA0, 0x7E, 0x27, 0xD1, 0x1E, 0xA3, 0xDF, 0x19, 0x38, 0xF6, 0x5D, 0x73, 0x43, 0x24,
+    0x9B, 0x85, 0x37, 0x00, 0x25, 0x03, 0x5E, 0x46, 0x3D, 0x3F, 0x97, 0x5D, 0x67, 0x87, 0x19, 0x77,
+    0x2B, 0xE3, 0x9F, 0x8D, 0x1C, 0x7B, 0xAA, 0xE9, 0x84, 0xFA, 0x1F, 0x67, 0x9A, 0xA7, 0xE5, 0x6F,
+    0xE7, 0x4A, 0x24, 0xF3, 0xFD, 0x6B, 0x11, 0xE6, 0x85, 0xC1, 0x36, 0x60, 0x46, 0x94, 0x84, 0x8D,
+    0x7E, 0xA4, 0x99, 0x97, 0x19, 0x77, 0x36, 0xB3, 0xD6, 0x69, 0xC7, 0xDF, 0x2A, 0xBE, 0xDB, 0x21,
+    0xB8, 0xD8, 0x3F, 0x55, 0x1E, 0xD2, 0x7B, 0x17, 0x4C, 0xB6, 0xC9, 0x53, 0x4C, 0xF2, 0x2A, 0xDB,
+    0xFB, 0x4F, 0x5E, 0x82, 0x3E, 0xD2, 0xA7, 0xF5, 0xE1, 0x3B, 0xF4, 0x0C, 0x66, 0x86, 0xFA, 0xF4,
+    0x2C, 0x50, 0x77, 0x70, 0x7E, 0x77, 0x77, 0xD7, 0x8B, 0xFC, 0xEF, 0xC3, 0xC3, 0x17, 0x97, 0x4F,
+    0x2F, 0xEE, 0xEE, 0x3E, 0x2B, 0xF2, 0xDE, 0xE1, 0xE1, 0xCF, 0x01, 0x95, 0xC0, 0x27, 0xE8, 0x13,
+    0xF4, 0x11, 0xFA, 0x0E, 0xFA, 0x8E, 0xAA, 0xA0, 0x24, 0x28, 0x09, 0x95, 0x84, 0x4A, 0x02, 0x2E,
+    0xC0, 0x52, 0x77, 0xDF, 0xD5, 0x92, 0x1A, 0x49, 0xDF, 0x74, 0x11, 0xDB, 0xE1, 0x60, 0x13, 0x32,
+    0x2E, 0x36, 0x2B, 0x23, 0x83, 0x9B, 0x38, 0x80, 0xCC, 0x03, 0xCB, 0x57, 0x35, 0x61, 0x07, 0x7C,
+    0xE0, 0x02, 0xC0, 0xB9, 0xC3, 0xAB, 0x40, 0x2D, 0x32, 0x42, 0xBD, 0xDA, 0xED, 0x07, 0xCC, 0x04,
+    0x6D, 0xA7, 0x66, 0xE0, 0x04, 0x0F, 0x54, 0xD9, 0x46, 0xF5, 0x3F, 0xB1, 0xCF, 0x4F, 0x4A, 0x26,
+    0x8E, 0x1A, 0xF6, 0x6D, 0x34, 0xB7, 0x86, 0x3A, 0xEC, 0xB1, 0xB7, 0xCF, 0x79, 0x13, 0xF5, 0xAF,
+    0x23, 0xEC, 0xB1, 0x79, 0x44, 0x2D, 0xD1, 0xBC, 0x12, 0xF5, 0xDD, 0x23, 0x8E, 0x8E, 0x98, 0x4C,
+    0xB4, 0xDF, 0x8D, 0x36, 0xEC, 0x57, 0x79, 0x9F, 0xE2, 0xDE, 0x2F, 0x7A, 0xA8, 0xE5, 0x9A, 0xE0,
+    0x71, 0xE9, 0x6F, 0x82, 0x2A, 0x8B, 0x96, 0x18, 0x00, 0xF0, 0x1D, 0x3C, 0x02, 0x72, 0x95, 0x4B,
+    0x11, 0x25, 0x22, 0x13, 0x28, 0x91, 0x11, 0xE0, 0xE2, 0x32, 0xE4, 0x00, 0x6A, 0x02, 0xF0, 0x91,
+    0xA5, 0x6B, 0xA1, 0x1F, 0x00, 0xEB, 0x81, 0xEA, 0xBD, 0x11, 0xD8, 0xB2, 0x11, 0x4C, 0x2C, 0xC0,
+    0x54, 0x0F, 0x60, 0xF1, 0x50, 0x65, 0x3D, 0x82, 0xDF, 0xBD, 0xD2, 0x61, 0x44, 0x0A, 0xAC, 0x0E,
+    0xAF, 0x25, 0x5C, 0xA0, 0xA5, 0xCA, 0xE8, 0xCC, 0x36, 0xF8, 0xAE, 0x8E, 0xA8, 0x72, 0x4E, 0xAE,
+    0x2A, 0x29, 0x32, 0xE3, 0x25, 0x72, 0x71, 0x87, 0x5E, 0x24, 0xB4, 0xF7, 0xFA, 0x41, 0x67, 0x93,
+    0x75, 0xAE, 0x26, 0x9D, 0xD5, 0xA4, 0x33, 0x93, 0xCE, 0x6A, 0xD4, 0x59, 0x67, 0x7D, 0xEF, 0xAF,
+    0xA2, 0x16, 0x19, 0xF4, 0xBD, 0x6B, 0x45, 0x67, 0x35, 0xEB, 0x4C, 0xAB, 0x33, 0x7E, 0x7D, 0xB6,
+    0x3A, 0xB3, 0xD2, 0xD9, 0x94, 0x46, 0x24, 0x8B, 0xAC, 0xD6, 0xE2, 0xB2, 0x1B, 0xA8, 0x44, 0x42,
+    0x2D, 0x92, 0xEA, 0x51, 0x8D, 0x66, 0x60, 0x4B, 0x67, 0xEC, 0xD3, 0x23, 0x55, 0x2C, 0x80, 0x67,
+    0x99, 0x54, 0xF5, 0x00, 0xD5, 0x04, 0x9C, 0x00, 0x4D, 0x5C, 0x24, 0x98, 0x79, 0xDD, 0x05, 0x66,
+    0x06, 0xFA, 0xBB, 0x7F, 0xF1, 0x92, 0x11, 0x29, 0x34, 0x32, 0xC1, 0xC5, 0x00, 0x17, 0x2F, 0x43,
+    0x2F, 0x32, 0xD0, 0xDE, 0x93, 0x15, 0x3A, 0x2B, 0x89, 0x3A, 0xE3, 0x06, 0x9D, 0x31, 0x59, 0x67,
+    0xF4, 0xA4, 0x33, 0xAA, 0xE8, 0x0C, 0x45, 0x67, 0x98, 0x1F, 0xBE, 0xDC, 0x7F, 0xA0, 0x26, 0x9D,
+    0xD1, 0xA3, 0xCE, 0xD4, 0x83, 0xCE, 0x34, 0x51, 0xE7, 0x73, 0x42, 0x23, 0x32, 0x71, 0xD6, 0x12,
+    0x80, 0x46, 0x44, 0xBE, 0x2B, 0x22, 0xC9, 0x46, 0x46, 0x9D, 0xF9, 0x36, 0x05, 0x83, 0x67, 0xD1,
+    0x11, 0x3A, 0x03, 0xE5, 0xE2, 0x65, 0xBC, 0x08, 0x56, 0x24, 0x2C, 0x84, 0x75, 0x2B, 0x6D, 0xE4,
+    0xEB, 0x3A, 0x63, 0x29, 0xE8, 0xE8, 0xF9, 0xB3, 0xDC, 0x8B, 0x14, 0x11, 0x59, 0x01, 0x54, 0x22,
+    0xF2, 0xB6, 0x88, 0x74, 0x85, 0x03, 0x9D, 0xB9, 0x6E, 0xA3, 0x4A, 0x9E, 0x33, 0x05, 0x13, 0xC1,
+    0xCB, 0x8C, 0x48, 0xBE, 0x7F, 0xFB, 0x91, 0xA7, 0x50, 0x4B, 0x46, 0x24, 0x02, 0x17, 0x77, 0xC0,
+    0xC9, 0x6A, 0x11, 0x81, 0xB6, 0xAB, 0xB2, 0xC9, 0x98, 0xE8, 0xC1, 0x56, 0x23, 0x3C, 0x69, 0xE3,
+    0x9A, 0x25, 0x35, 0x9D, 0x8A, 0x65, 0xD3, 0xB1, 0xBB, 0x7B, 0x82, 0x91, 0x7B, 0x85, 0x73, 0xFD,
+    0xCB, 0x19, 0x0E, 0x6C, 0x42, 0x4D, 0x3E, 0x62, 0x86, 0x36, 0xE2, 0xBA, 0xF6, 0x2D, 0x75, 0x42,
+    0x2B, 0x32, 0xD1, 0x88, 0x74, 0xA8, 0xDD, 0xD3, 0x39, 0x26, 0x33, 0xAD, 0xBC, 0x2C, 0x09, 0xB9,
+    0x4B, 0x61, 0x31, 0x3A, 0x38, 0xC6, 0x46, 0xAA, 0x11, 0x0F, 0x75, 0x7A, 0x88, 0xFC, 0x7F, 0x76,
+    0xFF, 0x72, 0xC4, 0x8B, 0x48, 0x42, 0x64, 0xDD, 0x47, 0x9F, 0xFC, 0xF6, 0x19, 0xB9, 0x96, 0xA4,
+    0x64, 0x12, 0x09, 0x4E, 0x32, 0x78, 0x79, 0x5B, 0x06, 0x1B, 0x75, 0xA6, 0xE0, 0xF9, 0x94, 0x4C,
+    0x3F, 0x8B, 0x74, 0x80, 0x16, 0xA9, 0x64, 0xC2, 0xC6, 0xDF, 0xF9, 0x70, 0x1D, 0x2E, 0xE0, 0xE1,
+    0x84, 0xAA, 0xD0, 0x64, 0x5C, 0x77, 0x2A, 0x0C, 0x43, 0x2B, 0xDF, 0x95, 0xC1, 0x48, 0xB0, 0x91,
+    0x15, 0x3A, 0x33, 0x43, 0x61, 0x06, 0x4F, 0x01, 0x7B, 0xA3, 0x80, 0xBE, 0x5D, 0x80, 0x79, 0x02,
+    0x7C, 0x01, 0xAC, 0x44, 0xD0, 0x77, 0x26, 0xA0, 0xF8, 0x0E, 0xBC, 0x99, 0xC0, 0xC6, 0xB6, 0x43,
+    0x67, 0x53, 0xA0, 0xD0, 0x46, 0x3C, 0x66, 0xA6, 0x9F, 0x69, 0x07, 0x91, 0xA0, 0x57, 0x67, 0x9A,
+    0xA1, 0x91, 0x8C, 0x91, 0xE1, 0x41, 0x71, 0x3B, 0x93, 0xAE, 0xCF, 0x26, 0x3C, 0xBE, 0x96, 0x3F,
+    0x13, 0x3D, 0x5F, 0xCB, 0xBD, 0xC8, 0x24, 0xB2, 0x98, 0x20, 0x00, 0x32, 0xA1, 0x24, 0x1B, 0x89,
+    0x34, 0x33, 0xF5, 0x8C, 0x5E, 0xC1, 0xFF, 0x1A, 0x68, 0x33, 0xB6, 0xA5, 0x6E, 0xE1, 0x37, 0x99,
+    0xF7, 0x32, 0xD6, 0x05, 0xD7, 0x40, 0x2E, 0xD5, 0xAF, 0x32, 0xB6, 0x8E, 0x9B, 0x0E, 0x95, 0xF7,
+    0xCD, 0xF3, 0x23, 0x4E, 0x0F, 0x2F, 0xB9, 0xA0, 0x72, 0x63, 0x19, 0x79, 0x82, 0xF7, 0x07, 0xDB,
+    0x55, 0x83, 0x3D, 0x66, 0x62, 0x9B, 0x3E, 0xDA, 0xA8, 0x93, 0x9E, 0x28, 0x6C, 0x2D, 0xE3, 0x93,
+    0x54, 0xE6, 0xA8, 0x92, 0xE1, 0x11, 0xFA, 0xB9, 0x17, 0x70, 0xB2, 0xE8, 0xC7, 0x5A, 0x40, 0xE4,
+    0x4A, 0xA1, 0x96, 0xCE, 0x0F, 0xE8, 0xA8, 0x05, 0x36, 0xF1, 0x05, 0x1D, 0xF5, 0xEB, 0x03, 0x9B,
+    0x6C, 0xF9, 0xA0, 0xA3, 0x7E, 0xB5, 0xB0, 0xC9, 0x56, 0x3D, 0xE8, 0xA8, 0x93, 0x0F, 0x9B, 0x6C,
+    0xA9, 0xA2, 0xA3, 0x4E, 0x75, 0xDE, 0x64, 0x0B, 0xFF, 0x4C, 0xD4, 0x89, 0xB2, 0xC9, 0x16, 0xE6,
+    0x4E, 0xD4, 0x09, 0x5F, 0xD8, 0x02, 0x89, 0x3A, 0x61, 0x4A, 0x25, 0x99, 0x26, 0x8A, 0x2C, 0x9D,
+    0x83, 0x02, 0xFE, 0x73, 0x00, 0x23, 0x12, 0xA8, 0xA5, 0x2F, 0xD8, 0x91, 0x3E, 0xD6, 0x19, 0x33,
+    0x99, 0x0C, 0x7D, 0x35, 0x81, 0x1D, 0x0A, 0x54, 0xA5, 0x05, 0x5A, 0x17, 0xC1, 0xBE, 0x32, 0x80,
+    0x7E, 0x6F, 0x02, 0x4A, 0x0F, 0x78, 0x17, 0xC1, 0xBD, 0x9C, 0xA1, 0x1E, 0x56, 0xA0, 0xC7, 0x26,
+    0x52, 0x15, 0x5D, 0x50, 0x85, 0x36, 0x55, 0x33, 0x46, 0x64, 0x66, 0xD1, 0x5D, 0xEC, 0x06, 0x60,
+    0x77, 0x87, 0x5E, 0xA4, 0x6B, 0xEF, 0xF5, 0xA3, 0xCE, 0xA6, 0xE8, 0x4C, 0xD1, 0x99, 0xE3, 0x07,
+    0xCE, 0xB2, 0xE8, 0xE1, 0x4B, 0x59, 0x8B, 0x74, 0x5A, 0xEE, 0xA2, 0x33, 0xBF, 0xF5, 0x6C, 0xA4,
+    0x3B, 0x9D, 0xFA, 0x01, 0xE8, 0x25, 0x41, 0x2F, 0xD2, 0xD1, 0xA4, 0x4A, 0xA8, 0x33, 0x66, 0xA2,
+    0x40, 0x13, 0x9B, 0x0E, 0x56, 0x3A, 0x43, 0x9D, 0x5B, 0xA0, 0x35, 0x19, 0x74, 0x3E, 0x01, 0x7C,
+    0x3D, 0x80, 0xCE, 0x3D, 0xE0, 0x4D, 0x06, 0x93, 0x5B, 0xE0, 0x44, 0x4F, 0x60, 0x63, 0x13, 0xA9,
+    0x26, 0x04, 0x5A, 0xCC, 0x4C, 0x13, 0x71, 0x22, 0x19, 0x9C, 0xBC, 0x05, 0xD4, 0x19, 0xC0, 0x25,
+    0x00, 0xFF, 0x16, 0x40, 0x2F, 0x03, 0xD0, 0xAF, 0x00, 0xBE, 0x1F, 0xB8, 0xB8, 0xB3, 0xE6, 0xA6,
+    0xBD, 0xD7, 0x67, 0x74, 0x36, 0x13, 0x3A, 0x2F, 0x7E, 0xC8, 0x8C, 0xCE, 0x1C, 0xDF, 0xBF, 0x2D,
+    0xE8, 0x6C, 0x32, 0xFA, 0xFD, 0x3E, 0xA2, 0x65, 0x06, 0x7D, 0xAF, 0xAC, 0x19, 0xD4, 0xD9, 0x07,
+    0x74, 0x76, 0x09, 0x9D, 0xEB, 0x8C, 0xCE, 0x7A, 0x46, 0x67, 0x24, 0x34, 0x12, 0xFC, 0x20, 0xD2,
+    0xD9, 0x02, 0xA8, 0x1D, 0x36, 0x76, 0x70, 0x32, 0x1A, 0x91, 0x1B, 0x33, 0xA5, 0x09, 0xF5, 0xAD,
+    0xCC, 0x9E, 0xC7, 0x3C, 0x53, 0xC0, 0x8D, 0xD0, 0x8F, 0x28, 0x19, 0xA8, 0x24, 0x51, 0x49, 0x87,
+    0x29, 0xE7, 0xB1, 0xAF, 0x77, 0x1C, 0x1F, 0x51, 0xBF, 0x1E, 0x29, 0x3D, 0xFE, 0x27, 0x22, 0x43,
+    0x23, 0x23, 0x1B, 0x97, 0xD7, 0xF2, 0x28, 0xB2, 0x12, 0x11, 0x79, 0xB7, 0xF3, 0x61, 0x7B, 0xD4,
+    0xA3, 0x7E, 0x03, 0x1F, 0xBE, 0xFD, 0x03, 0x3D, 0x56, 0x1D, 0x3E, 0x80, 0x1E, 0xE1, 0x77, 0xCA,
+    0x9C, 0x93, 0x19, 0xD6, 0x16, 0x3B, 0x18, 0x29, 0x88, 0xF8, 0x15, 0xB5, 0x74, 0x3E, 0x60, 0x92,
+    0x1E, 0x61, 0x9F, 0xDF, 0x39, 0x5B, 0x8D, 0xB0, 0x47, 0x13, 0xA8, 0xA3, 0x2A, 0x50, 0xB0, 0x89,
+    0xA6, 0xA3, 0xEF, 0x2E, 0x65, 0xB4, 0x48, 0x81, 0x5A, 0x56, 0xC0, 0x7D, 0x1B, 0xBF, 0x91, 0x6C,
+    0xE5, 0x03, 0x79, 0x4B, 0xF5, 0x6F, 0xD9, 0x88, 0x49, 0x7A, 0x42, 0x67, 0x5A, 0x98, 0xB0, 0x91,
+    0xFD, 0xB5, 0xE6, 0x6D, 0xB1, 0x1D, 0x36, 0x9A, 0x48, 0x35, 0xEA, 0x0C, 0xDB, 0x8C, 0x60, 0xE3,
+    0x1E, 0x54, 0xE3, 0x36, 0xB0, 0x6D, 0x03, 0xD8, 0x97, 0x23, 0xA8, 0x0F, 0x06, 0xC0, 0x67, 0x16,
+    0x03, 0x10, 0x35, 0xB3, 0x56, 0x3D, 0x0F, 0x25, 0x2F, 0x83, 0x0A, 0x4A, 0x56, 0x8D, 0x74, 0x7A,
+    0xA0, 0x9F, 0xF4, 0x84, 0xC9, 0xD8, 0xA8, 0x0A, 0xF5, 0xDA, 0x17, 0xB5, 0x13, 0x2E, 0x30, 0x63,
+    0x0B, 0x0D, 0x9C, 0xE0, 0xCA, 0xE2, 0x35, 0x6D, 0xEF, 0xB3, 0x05, 0x9E, 0x4D, 0xCF, 0x1E, 0x34,
+    0x61, 0xCF, 0x73, 0x04, 0xAE, 0xBB, 0xEE, 0xC2, 0x08, 0x36, 0x8E, 0xF6, 0xF9, 0x0C, 0xF5, 0x8D,
+    0x6C, 0x6F, 0x66, 0x30, 0xBF, 0x1A, 0xCC, 0x6B, 0x03, 0xE8, 0x3B, 0x49, 0xBF, 0x19, 0xA1, 0xFA,
+    0x20, 0xEA, 0x0F, 0x22, 0x28, 0xE9, 0x2A, 0xE9, 0x00, 0x09, 0x48, 0x00, 0x7A, 0x10, 0x80, 0x76,
+    0xB1, 0x3E, 0x1E, 0x4C, 0x56, 0x26, 0x2B, 0x37, 0x64, 0x52, 0x7D, 0x32, 0x23, 0x2E, 0xD0, 0x63,
+    0x3B, 0x6C, 0xB6, 0x11, 0xE6, 0x3A, 0x82, 0x7B, 0x39, 0x41, 0x25, 0xF7, 0x5B, 0x6E, 0x46, 0x16,
+    0x8F, 0x89, 0x4A, 0x32, 0xA8, 0x71, 0x06, 0x26, 0x17, 0xA1, 0x54, 0x05, 0x8E, 0xF1, 0x1D, 0x07,
+    0x98, 0x11, 0x0F, 0x3D, 0xFD, 0xA4, 0xFA, 0x95, 0x08, 0xCB, 0x1A, 0x05, 0xBD, 0xC4, 0x7E, 0xD5,
+    0xAE, 0xB8, 0x32, 0xE9, 0x91, 0x3A, 0x56, 0x05, 0xDB, 0x31, 0xD3, 0x40, 0xCB, 0x16, 0x34, 0xE1,
+    0x08, 0xEC, 0x8D, 0x0C, 0xF5, 0x9B, 0x03, 0xAC, 0x5B, 0x13, 0x58, 0xF3, 0x7F, 0xF0, 0x69, 0x97,
+    0x5A, 0x26, 0x68, 0xA4, 0xAC, 0xC7, 0x40, 0x26, 0x2F, 0x52, 0xB6, 0x31, 0xE3, 0x1E, 0x76, 0xF8,
+    0x11, 0x2E, 0x7E, 0x0B, 0xBF, 0x58, 0x5C, 0xD5, 0xB4, 0x58, 0x5F, 0x36, 0x41, 0xD3, 0x41, 0xBB,
+    0x90, 0xF5, 0x04, 0x75, 0xE6, 0x31, 0x1B, 0xD9, 0xF4, 0x81, 0xBD, 0x9E, 0xDD, 0x22, 0x22, 0x53,
+    0xBF, 0xB6, 0x5D, 0xFB, 0x37, 0xE6, 0xC9, 0x76, 0x9F, 0x79, 0xC8, 0xFF, 0xFD, 0xF9, 0x75, 0x70,
+    0x8B, 0x83, 0xB5, 0x07, 0x36, 0x50, 0x65, 0xD8, 0x82, 0xBA, 0x43, 0x65, 0xD8, 0x5E, 0x9C, 0xC3,
+    0x11, 0x1A, 0xD0, 0x09, 0x8E, 0x16, 0xE0, 0x60, 0xFD, 0x7A, 0x77, 0xFF, 0xF5, 0x08, 0x3B, 0xED,
+    0xDB, 0x52, 0xE5, 0xE6, 0x33, 0x8F, 0xF6, 0xBD, 0xBF, 0x67, 0x63, 0x69, 0x99, 0x8F, 0x98, 0x19,
+    0xEE, 0x66, 0xAC, 0x0D, 0xD5, 0x70, 0x9D, 0x2D, 0x13, 0x4D, 0xDC, 0x62, 0xAA, 0xB2, 0xC5, 0x3E,
+    0x9D, 0x99, 0xB6, 0x30, 0x37, 0x3B, 0xFE, 0xDD, 0xE1, 0xE1, 0xE1, 0x7F, 0x17, 0x91, 0x7F, 0xDA,
+    0xDD, 0xDD, 0xE5, 0x8F, 0x18, 0x75, 0xAE, 0xB3, 0xC9, 0x26, 0x55, 0xB0, 0x01, 0x46, 0x12, 0xD2,
+    0x47, 0x9B, 0x9A, 0xCE, 0xB3, 0xCD, 0x0F, 0x4F, 0x4D, 0xB1, 0xE7, 0x62, 0x25, 0x42, 0x7B, 0xAF,
+    0xE8, 0x51, 0xE7, 0x26, 0xD8, 0x78, 0x8C, 0x57, 0x45, 0xCF, 0x5A, 0x56, 0x72, 0x4B, 0x6E, 0x15,
+    0xB5, 0xA3, 0x60, 0x07, 0x2A, 0x09, 0xE0, 0x47, 0xC0, 0x85, 0xC5, 0xC9, 0x7C, 0x30, 0xB3, 0x83,
+    0x1A, 0xFB, 0x11, 0xD7, 0x4B, 0x52, 0xF2, 0xDF, 0x04, 0x17, 0xF5, 0xA4, 0x46, 0x5C, 0x74, 0x81,
+    0xA2, 0x46, 0xEC, 0xC7, 0x32, 0xAE, 0x73, 0x41, 0x67, 0x35, 0x31, 0xD3, 0x88, 0x74, 0x4A, 0x24,
+    0x2D, 0x6B, 0x81, 0x0A, 0x34, 0x2B, 0xBC, 0x64, 0xCF, 0xDC, 0xE0, 0x9E, 0xED, 0xF4, 0x8F, 0x13,
+    0xD5, 0xE2, 0xFE, 0x2F, 0xE6, 0x56, 0xB5, 0x40, 0x02, 0xF6, 0x2E, 0x3B, 0x22, 0x53, 0x2D, 0xD3,
+    0xDA, 0xC7, 0xDE, 0x01, 0x57, 0x96, 0xE5, 0xF8, 0x63, 0xC6, 0xC4, 0x86, 0x8D, 0xF4, 0x92, 0x95,
+    0x48, 0x61, 0xA6, 0xE5, 0x18, 0x1B, 0xB7, 0xD1, 0xD9, 0x05, 0x4A, 0x9D, 0xF0, 0x3A, 0x63, 0xE3,
+    0x8C, 0xCE, 0x4D, 0xA0, 0xD4, 0x03, 0x5E, 0x15, 0x5C, 0xF4, 0xA9, 0xC9, 0x5A, 0x44, 0x06, 0xBF,
+    0x72, 0x13, 0x97, 0x15, 0x6C, 0x40, 0xBB, 0xA2, 0x95, 0xE1, 0x80, 0xD9, 0xE3, 0x7E, 0x16, 0xF4,
+    0x87, 0x89, 0x95, 0x88, 0x88, 0x48, 0x0F, 0x75, 0xA4, 0x1A, 0xA1, 0x05, 0x3B, 0xA9, 0xAB, 0x22,
+    0x63, 0x2D, 0xD3, 0xB2, 0xC2, 0xFD, 0x35, 0xF4, 0x33, 0xCD, 0x3F, 0x64, 0x93, 0xFE, 0x2D, 0x05,
+    0x6C, 0x87, 0x1A, 0xA1, 0x09, 0x5C, 0x92, 0xD9, 0x88, 0xA4, 0x3F, 0xBB, 0x7B, 0x19, 0x17, 0x50,
+    0x23, 0x9F, 0xF6, 0xA3, 0xFA, 0x19, 0x2F, 0xC3, 0x82, 0xF7, 0x39, 0x91, 0xD4, 0x88, 0x8C, 0xAE,
+    0x6B, 0xFE, 0x43, 0x1D, 0x75, 0xD6, 0x99, 0x23, 0x0A, 0x9E, 0x26, 0xD8, 0xA8, 0x47, 0x97, 0x68,
+    0x25, 0xB1, 0x2D, 0x1D, 0xCD, 0x69, 0x97, 0xDC, 0xDD, 0x0D, 0xF4, 0x22, 0x9D, 0x15, 0x99, 0x6C,
+    0x47, 0x6B, 0x23, 0xF6, 0xD6, 0x80, 0x1E, 0x0A, 0x3A, 0xFB, 0x7F, 0xBA, 0x92, 0xB5, 0xC8, 0xC0,
+    0x9F, 0xDF, 0x0B, 0x0B, 0xCC, 0xD9, 0x47, 0x30, 0xC2, 0xBA, 0x1F, 0x75, 0x5E, 0x17, 0xB3, 0xE8,
+    0xC8, 0xA2, 0x02, 0xFA, 0xB6, 0x8C, 0xD8, 0x77, 0x25, 0xE3, 0x47, 0x37, 0xB0, 0xC2, 0x45, 0x9D,
+    0xF1, 0xD8, 0x48, 0xC1, 0x2F, 0x2B, 0xA4, 0xFD, 0x44, 0x52, 0x5B, 0x2A, 0x79, 0x4D, 0x72, 0x23,
+    0x01, 0xF0, 0xC1, 0x4C, 0xF8, 0x4E, 0xBD, 0x78, 0xAA, 0xCA, 0x2E, 0x8D, 0x46, 0x82, 0x19, 0x71,
+    0x41, 0xFD, 0xD6, 0x8B, 0xEA, 0x27, 0x2F, 0x11, 0x70, 0xB1, 0x1E, 0xAB, 0xC2, 0xBF, 0xBF, 0x6F,
+    0xE0, 0x6B, 0x89, 0x5F, 0xFB, 0x0C, 0x43, 0x7B, 0x9B, 0x26, 0xB8, 0xD8, 0xA4, 0x36, 0x3D, 0x1A,
+    0xD6, 0x02, 0x0E, 0xB4, 0x79, 0xDD, 0x38, 0xFD, 0x5B, 0x32, 0x8D, 0x74, 0x5E, 0xC9, 0xA8, 0xB3,
+    0x19, 0xF1, 0x6A, 0x5A, 0x56, 0x79, 0xDF, 0x04, 0xB4, 0x24, 0xF0, 0x2D, 0xE8, 0xF7, 0xCA, 0x62,
+    0x97, 0xE8, 0xEC, 0x3B, 0x3C, 0x82, 0xCE, 0xBA, 0x28, 0x19, 0xDC, 0xE8, 0x65, 0x71, 0x8D, 0x77,
+    0xD8, 0xA9, 0x8B, 0x11, 0xEC, 0x82, 0x7F, 0xDE, 0x07, 0x42, 0x3F, 0x29, 0x63, 0xE4, 0x6D, 0x29,
+    0xA0, 0x60, 0x87, 0xAA, 0x34, 0xB3, 0x96, 0x68, 0xA4, 0x95, 0x57, 0xA4, 0x70, 0x65, 0x65, 0x24,
+    0xF5, 0x41, 0x15, 0xDA, 0xAE, 0x1E, 0xD8, 0x5F, 0x7A, 0xD8, 0x05, 0x9D, 0x4F, 0xF1, 0x54, 0x1B,
+    0xD5, 0xB8, 0x74, 0xF9, 0xE7, 0x78, 0xA8, 0xFA, 0xB1, 0x16, 0x25, 0x59, 0xE6, 0x5A, 0xA2, 0x94,
+    0x65, 0x26, 0xDE, 0x94, 0xC1, 0x48, 0x2B, 0xE9, 0x9C, 0x0C, 0x6D, 0x54, 0x65, 0xF9, 0xF6, 0x18,
+    0x17, 0xAA, 0x91, 0x7D, 0xEA, 0xA4, 0x46, 0x9A, 0xF0, 0x09, 0x24, 0xD5, 0x8F, 0xB5, 0xFC, 0x54,
+    0x52, 0x2B, 0xA8, 0x00, 0xFD, 0x0A, 0x2D, 0x12, 0x6D, 0x72, 0xD9, 0xA3, 0xC7, 0x6D, 0xAA, 0xE9,
+    0x18, 0xCA, 0x11, 0x94, 0x02, 0x65, 0x86, 0x72, 0x0C, 0xA5, 0x47, 0x4D, 0x3E, 0xE8, 0xDC, 0xA4,
+    0x7A, 0xB0, 0xAB, 0xBE, 0xAB, 0x64, 0x5E, 0x1B, 0x89, 0x1B, 0x9C, 0x1B, 0xDB, 0xA9, 0x5E, 0xF5,
+    0x12, 0xAF, 0xCC, 0x97, 0x26, 0x3D, 0xD2, 0x53, 0xB0, 0xC9, 0x53, 0x4D, 0x36, 0x72, 0xA0, 0x33,
+    0xAE, 0x2B, 0x98, 0xE4, 0xA9, 0xB2, 0x8D, 0x14, 0x9D, 0x39, 0x61, 0xA6, 0x5F, 0xBB, 0xB7, 0xF3,
+    0xC7, 0xFD, 0x0D, 0xF3, 0x3E, 0x38, 0xC9, 0x9C, 0x3B, 0xFC, 0x3B, 0x96, 0x39, 0xD5, 0xC8, 0x5B,
+    0xB4, 0x22, 0xF8, 0xE0, 0xA2, 0x0F, 0x3A, 0xDB, 0x8E, 0x62, 0x12, 0xBE, 0x1A, 0xB1, 0xB1, 0x2C,
+    0x46, 0x5D, 0xA9, 0x13, 0xBE, 0x9A, 0xB0, 0xB1, 0xA5, 0xCE, 0x76, 0x74, 0x05, 0x91, 0x9E, 0x5A,
+    0x9E, 0xFD, 0x6D, 0x3E, 0x8D, 0x19, 0xC1, 0x4B, 0xE4, 0xD1, 0xC3, 0x17, 0x41, 0x55, 0xC5, 0x7D,
+    0x20, 0x4D, 0xB9, 0xF2, 0xEE, 0xFF, 0x50, 0x2B, 0x68, 0xC1, 0x05, 0x4C, 0x42, 0x8D, 0xB0, 0xFF,
+    0xF0, 0x8D, 0xEA, 0x57, 0x4A, 0x24, 0x72, 0x81, 0x4A, 0x26, 0xFB, 0x4E, 0x69, 0x38, 0xDA, 0x66,
+    0xD3, 0x73, 0xBE, 0x19, 0xB0, 0x2B, 0xB4, 0x0C, 0xB4, 0x13, 0x55, 0x79, 0x92, 0xFD, 0x4D, 0xB6,
+    0xB6, 0x39, 0xF2, 0xEF, 0x8C, 0x8D, 0x24, 0x75, 0x19, 0x5E, 0x44, 0x0F, 0xEB, 0xE3, 0x92, 0x4C,
+    0x22, 0xD3, 0x5F, 0xBE, 0xBF, 0x73, 0x9F, 0xF2, 0xD1, 0x23, 0xA3, 0x47, 0xB4, 0xCC, 0x9C, 0xAA,
+    0x2A, 0xE8, 0x63, 0x3D, 0xD5, 0x42, 0x3F, 0x9C, 0x9B, 0x68, 0x3A, 0x3D, 0x70, 0x80, 0xED, 0xD4,
+    0xC4, 0x36, 0x66, 0x60, 0xC2, 0x7D, 0x94, 0x54, 0x70, 0x9D, 0xCE, 0x9C, 0x60, 0x07, 0x37, 0xE1,
+    0xE4, 0x43, 0x09, 0x4E, 0xBE, 0x37, 0xB3, 0x11, 0x1E, 0xA1, 0x5D, 0x69, 0x79, 0x59, 0x52, 0x33,
+    0xD9, 0xC4, 0x36, 0x07, 0xD4, 0x51, 0x67, 0x26, 0x9A, 0xE0, 0x02, 0xA5, 0xCA, 0xD4, 0x71, 0x0B,
+    0x0E, 0xEA, 0x88, 0xCE, 0x23, 0xB8, 0xE7, 0x80, 0x7B, 0xC3, 0xDA, 0x20, 0xF3, 0x1D, 0x54, 0xE3,
+    0x32, 0xAB, 0xDB, 0x15, 0xBF, 0xD0, 0xF2, 0x9A, 0x24, 0x1B, 0x9A, 0x62, 0x93, 0x9A, 0xD8, 0xE6,
+    0x80, 0x26, 0x9A, 0xA4, 0xB3, 0x9E, 0x39, 0xA2, 0x09, 0xED, 0x60, 0x3B, 0x35, 0xD5, 0xD7, 0xC8,
+    0xD8, 0x78, 0x7B, 0x6C, 0xE0, 0xC8, 0xD9, 0x17, 0x12, 0xFA, 0x57, 0xE9, 0x68, 0x13, 0xFC, 0xA6,
+    0xF9, 0x75, 0x47, 0xF5, 0x41, 0xB7, 0x3D, 0x82, 0x1D, 0x2B, 0x01, 0x04, 0x3B, 0x80, 0x19, 0xB8,
+    0xEF, 0x54, 0xFA, 0x95, 0x91, 0x9F, 0xCA, 0x53, 0x92, 0x5A, 0x6C, 0x67, 0xB2, 0xED, 0x38, 0xA8,
+    0x3B, 0xEA, 0x5F, 0xC7, 0x45, 0x1B, 0xDA, 0x04, 0xA6, 0x80, 0x7E, 0x23, 0xA2, 0x5F, 0x2D, 0xE8,
+    0xA1, 0xE9, 0x74, 0xD6, 0x63, 0xBD, 0x52, 0xF2, 0xBA, 0xBC, 0x2A, 0xD3, 0x27, 0xB7, 0x97, 0xB3,
+    0xF6, 0x6E, 0x7F, 0x4A, 0x7B, 0x4F, 0x15, 0x8E, 0x49, 0xA0, 0xCA, 0x62, 0xED, 0xD5, 0x92, 0xA0,
+    0x1F, 0xA1, 0xFA, 0x67, 0xC0, 0x8A, 0x3C, 0x2F, 0x32, 0xBB, 0xD0, 0x3C, 0x9F, 0x4C, 0x7E, 0x8C,
+    0x02, 0x3E, 0x50, 0x27, 0xD4, 0xB4, 0xAC, 0x3D, 0x11, 0x3D, 0x32, 0x9C, 0xF0, 0x0D, 0xD7, 0xE9,
+    0x37, 0x45, 0xE6, 0x66, 0x71, 0xB5, 0x80, 0x26, 0xB6, 0x83, 0xC7, 0x76, 0x26, 0xA9, 0x91, 0x6D,
+    0x6C, 0xA7, 0x4F, 0x55, 0x4D, 0x3D, 0xD8, 0xA1, 0x2A, 0xB8, 0x53, 0xE5, 0x63, 0x4F, 0xF7, 0x6A,
+    0x5C, 0xD0, 0x03, 0x33, 0x76, 0xE6, 0x6F, 0x60, 0xF3, 0x93, 0xD2, 0x05, 0xB0, 0x6F, 0x69, 0x09,
+    0x8B, 0x3A, 0x09, 0x3A, 0xA9, 0xF1, 0xAC, 0x98, 0x82, 0xEB, 0xAA, 0x42, 0xCF, 0x31, 0xFE, 0xAC,
+    0x4E, 0x93, 0x18, 0xD9, 0xC2, 0x05, 0x17, 0xFB, 0xD8, 0xAC, 0xED, 0xC9, 0xF0, 0x27, 0x5E, 0x9E,
+    0x79, 0xFB, 0x57, 0x52, 0x7E, 0x58, 0x49, 0x40, 0x05, 0xBE, 0xC5, 0x8E, 0x4E, 0x75, 0x77, 0x40,
+    0x31, 0x83, 0x8B, 0xBD, 0x2A, 0x7A, 0xAC, 0x87, 0x7A, 0x70, 0xB1, 0x4E, 0xAE, 0xAB, 0x93, 0xEB,
+    0x4C, 0xB4, 0x41, 0x87, 0x47, 0xF9, 0x26, 0x57, 0x19, 0xAB, 0x81, 0x35, 0x0E, 0xA8, 0x8A, 0xCE,
+    0x7A, 0xAC, 0x87, 0x26, 0xB6, 0x4F, 0x15, 0x3D, 0xDA, 0xE8, 0x99, 0xAA, 0xAC, 0xC3, 0x9F, 0x9E,
+    0xE2, 0x95, 0x5C, 0x07, 0xB0, 0x23, 0x80, 0x1F, 0x00, 0xDA, 0x08, 0x2C, 0xD0, 0xEB, 0x92, 0xCE,
+    0xB3, 0x06, 0xFB, 0xD0, 0x05, 0xA0, 0x4D, 0x40, 0xBD, 0x02, 0xB8, 0x93, 0x81, 0xA6, 0x09, 0xA0,
+    0x53, 0x01, 0xF6, 0x6C, 0x04, 0xDB, 0x9D, 0x00, 0x59, 0x67, 0x68, 0xF0, 0x01, 0xFD, 0xFE, 0x5F,
+    0x4C, 0xD0, 0x8A, 0x44, 0xEC, 0xBF, 0x1C, 0xCE, 0xA8, 0x11, 0x93, 0x69, 0xC0, 0xA3, 0x07, 0xF4,
+    0xC4, 0x11, 0xB8, 0x78, 0xE5, 0x2E, 0x4E, 0x7E, 0x29, 0x49, 0x4B, 0x39, 0xAD, 0xD3, 0x06, 0xA0,
+    0x9E, 0x4E, 0x2D, 0x73, 0x56, 0x01, 0xF8, 0x63, 0xBE, 0x52, 0xCE, 0x1E, 0x81, 0xB5, 0x5B, 0x88,
+    0x24, 0x96, 0x95, 0x8F, 0x3A, 0x1E, 0x01, 0xB9, 0x8A, 0x5F, 0x21, 0x67, 0x1B, 0x9C, 0x07, 0x55,
+    0x6C, 0x84, 0xE6, 0xC6, 0x0C, 0x6A, 0xB2, 0xF1, 0x61, 0xA7, 0xE8, 0x2B, 0xC0, 0xA7, 0xBF, 0x5C,
+    0x1C, 0xF9, 0x5C, 0x58, 0x8B, 0x47, 0xCB, 0xE2, 0x57, 0x98, 0x61, 0x8D, 0x8B, 0x5E, 0x5D, 0x6F,
+    0x50, 0x6F, 0x03, 0x36, 0x83, 0x92, 0x0E, 0xCC, 0xC4, 0xB2, 0x99, 0xB2, 0x4E, 0xBD, 0xC8, 0xEC,
+    0x44, 0x24, 0x78, 0x74, 0xB2, 0x91, 0x97, 0x74, 0xE6, 0xB1, 0x8F, 0x00, 0x71, 0xBB, 0x3B, 0x88,
+    0x14, 0xBC, 0xCC, 0x1F, 0x33, 0xA6, 0xFF, 0x8B, 0x8D, 0x6C, 0xAE, 0x91, 0xB9, 0xBF, 0xBA, 0x29,
+    0x22, 0x77, 0xD6, 0x9B, 0x02, 0x2C, 0x9E, 0x50, 0x3D, 0x82, 0x9B, 0xC0, 0x0E, 0x50, 0xF1, 0xA5,
+    0x57, 0x1B, 0xD6, 0x9E, 0xBB, 0xA4, 0xB5, 0x29, 0x61, 0x23, 0x3F, 0xE2, 0xC5, 0x2F, 0xB9, 0xDA,
+    0x9D, 0x0D, 0x38, 0x31, 0x19, 0x7F, 0xB3, 0x60, 0xD2, 0xF6, 0x43, 0xF2, 0x56, 0x89, 0xC8, 0xD8,
+    0x8A, 0xCC, 0x14, 0x6C, 0xF0, 0x54, 0xC9, 0x46, 0x7E, 0xF0, 0xB0, 0x65, 0x70, 0x63, 0x37, 0x68,
+    0x91, 0x8C, 0xC8, 0xF8, 0x51, 0xF8, 0x53, 0x75, 0x1E, 0xF2, 0x52, 0xAD, 0xBA, 0x52, 0x8B, 0xC8,
+    0x2F, 0x45, 0x64, 0x38, 0x4F, 0x43, 0x3D, 0x22, 0xDD, 0xB9, 0xB2, 0x1E, 0x4C, 0x91, 0x9F, 0x49,
+    0xF7, 0xA9, 0x68, 0xF2, 0x92, 0xA9, 0xE4, 0x03, 0x59, 0xA1, 0xD0, 0xC9, 0x4C, 0xB6, 0xD8, 0xB7,
+    0xAA, 0xF0, 0x7B, 0x7C, 0x7E, 0x01, 0x3D, 0xE2, 0xA7, 0xEA, 0xBD, 0xA9, 0xA9, 0x72, 0x56, 0xF1,
+    0x14, 0x1B, 0x69, 0x57, 0xD8, 0xB3, 0x7D, 0xFA, 0xCF, 0xCC, 0xF6, 0xB3, 0x95, 0xE9, 0x02, 0xFF,
+    0xB1, 0xD8, 0xD7, 0x73, 0xFB, 0x6C, 0x57, 0x1E, 0x00, 0x2E, 0x9C, 0x74, 0x9F, 0xA7, 0x84, 0xD3,
+    0x6C, 0x23, 0xCF, 0x2C, 0x7B, 0x11, 0x00, 0xED, 0x33, 0x1D, 0xD8, 0xD5, 0x11, 0xF0, 0x1B, 0x89,
+    0xF0, 0xA8, 0xC9, 0x7C, 0x2C, 0xF5, 0x19, 0x2B, 0xBF, 0x91, 0x48, 0x3F, 0xE9, 0x15, 0x6C, 0xE2,
+    0x33, 0x3A, 0x6A, 0x89, 0x6C, 0xB2, 0x75, 0x82, 0x8E, 0xFA, 0xB5, 0x91, 0x4D, 0xB6, 0x5C, 0xD4,
+    0x51, 0xA7, 0x13, 0x36, 0xD9, 0xD2, 0xA3, 0x8E, 0x3A, 0xB9, 0xB8, 0xC9, 0x16, 0xBD, 0x8E, 0x3A,
+    0xE9, 0x71, 0x93, 0x2D, 0xEC, 0xAD, 0xA8, 0x13, 0xED, 0x26, 0x5B, 0x68, 0x89, 0x3A, 0x61, 0x0B,
+    0x5B, 0xD0, 0xC6, 0x46, 0xA8, 0x8A, 0x95, 0xBC, 0xF8, 0x49, 0x9C, 0x5F, 0x2B, 0x9F, 0x6A, 0x60,
+    0xC1, 0x6F, 0x96, 0x99, 0x01, 0x6D, 0xC7, 0x83, 0xA1, 0x24, 0xEA, 0xAF, 0x01, 0x27, 0x33, 0x34,
+    0x2B, 0xC9, 0xF8, 0x54, 0x09, 0x4D, 0xC4, 0x0D, 0x2E, 0x52, 0x95, 0x7A, 0x00, 0xFF, 0x42, 0x86,
+    0xFA, 0x76, 0x01, 0x55, 0x5A, 0xC0, 0x37, 0xDD, 0x7D, 0x4C, 0xB7, 0x00, 0x67, 0x40, 0x6F, 0xF3,
+    0xC2, 0x04, 0x36, 0xF5, 0x50, 0x67, 0x9B, 0x31, 0x59, 0x49, 0xA8, 0x47, 0x9C, 0xC8, 0xB8, 0x46,
+    0x3A, 0x4F, 0xF7, 0x42, 0xCE, 0x03, 0xEC, 0x2F, 0xEB, 0x2E, 0x20, 0x4B, 0x1C, 0x08, 0xF0, 0x2D,
+    0xBE, 0x52, 0xC6, 0x1E, 0x81, 0xC5, 0xD2, 0xC2, 0xCE, 0x80, 0xFD, 0x65, 0x02, 0x1B, 0x8F, 0x40,
+    0x77, 0x8F, 0x7E, 0x95, 0x8C, 0x6D, 0x70, 0x1E, 0xEA, 0xEC, 0x41, 0x17, 0x97, 0xE0, 0x40, 0x3F,
+    0x2C, 0x64, 0x1B, 0x7F, 0x07, 0xB4, 0x32, 0x42, 0xFF, 0xA1, 0x44, 0x24, 0xD4, 0x85, 0x1E, 0xDA,
+    0xAE, 0x85, 0x3A, 0x37, 0x1D, 0xAC, 0x6C, 0x84, 0xE6, 0xE5, 0x0C, 0xE6, 0x76, 0x01, 0xCA, 0xC9,
+    0x19, 0x63, 0x79, 0xBD, 0xF9, 0xB2, 0x70, 0x7B, 0x62, 0x07, 0xF0, 0x4F, 0x17, 0x68, 0xA2, 0x8F,
+    0xB8, 0x68, 0x66, 0x9A, 0x44, 0x2B, 0x92, 0xA8, 0x44, 0x3A, 0xD6, 0x70, 0x6F, 0x38, 0x0D, 0x7E,
+    0xA0, 0x9A, 0x01, 0xEC, 0x04, 0x70, 0x29, 0xF3, 0xB0, 0xCA, 0x07, 0x5A, 0x89, 0x56, 0xEE, 0xC8,
+    0x40, 0x3F, 0xFD, 0x9E, 0x88, 0xED, 0x92, 0x6D, 0x02, 0x26, 0x56, 0x23, 0x1C, 0xE1, 0x22, 0x36,
+    0x32, 0x53, 0x4D, 0xD4, 0x93, 0xEA, 0xC1, 0x8B, 0xC4, 0x53, 0x38, 0x7D, 0xED, 0x4C, 0x2C, 0x76,
+    0x43, 0x02, 0xAA, 0x15, 0x80, 0x44, 0xC0, 0x5F, 0x05, 0xAA, 0xF0, 0xAF, 0x80, 0xBF, 0x25, 0x80,
+    0x60, 0x41, 0x7E, 0x27, 0xA0, 0x7E, 0x25, 0x41, 0x95, 0x1B, 0x60, 0x93, 0x1F, 0x7C, 0xE5, 0xFC,
+    0xA9, 0xB0, 0x01, 0xB4, 0x7A, 0x84, 0x3A, 0xB7, 0xE1, 0xE3, 0x32, 0xF7, 0x55, 0x21, 0xF2, 0x55,
+    0x00, 0xB7, 0x78, 0x27, 0xAC, 0xD6, 0x3D, 0x78, 0x04, 0x7C, 0x73, 0x3D, 0x15, 0xFE, 0x40, 0xC8,
+    0x91, 0xB0, 0xD8, 0x12, 0x7E, 0xB1, 0x8E, 0x5C, 0x07, 0xD3, 0x59, 0x94, 0xDB, 0x1F, 0x5C, 0xFA,
+    0xB2, 0x12, 0xD7, 0x05, 0xB6, 0x27, 0xF4, 0xED, 0x91, 0xA6, 0xCA, 0xE4, 0xAA, 0xFB, 0x22, 0x4A,
+    0x3F, 0xC7, 0xB7, 0x68, 0x75, 0x56, 0xC5, 0x2D, 0x71, 0x8C, 0xF7, 0x03, 0x57, 0xA0, 0x9D, 0xB1,
+    0x1F, 0x16, 0xE6, 0x6A, 0xD2, 0x59, 0x0F, 0x26, 0xAC, 0x37, 0xC2, 0x37, 0x0A, 0x8D, 0x64, 0x23,
+    0xD7, 0xA2, 0x0F, 0xBE, 0x1A, 0x29, 0x75, 0xD2, 0xD9, 0x45, 0x9F, 0xBC, 0xBC, 0x5B, 0x7C, 0xF1,
+    0xF1, 0x22, 0xE7, 0x7F, 0x6F, 0x64, 0x54, 0x05, 0xF4, 0x0C, 0x2E, 0xA2, 0x33, 0x2A, 0x53, 0x8D,
+    0xB0, 0x03, 0x4B, 0x87, 0xFA, 0xB0, 0x44, 0xDE, 0x2C, 0x70, 0xF5, 0xF9, 0xD3, 0xE6, 0xFF, 0x7E,
+    0x18, 0xE7, 0x79, 0xD8, 0x66, 0x2D, 0xD3, 0x36, 0x61, 0x22, 0x74, 0x7F, 0x58, 0x89, 0x60, 0x06,
+    0xF4, 0x8A, 0xEA, 0xC3, 0xA4, 0xC6, 0xC2, 0x64, 0xC3, 0x8F, 0x48, 0x7F, 0x40, 0x89, 0x2A, 0x5C,
+    0xD0, 0x53, 0x13, 0x57, 0x75, 0x76, 0x8C, 0x67, 0xE3, 0x62, 0x64, 0x30, 0xB2, 0x32, 0x83, 0x7D,
+    0x2D, 0xAB, 0xBB, 0x23, 0xFE, 0x18, 0xFB, 0xAE, 0x88, 0x88, 0x7C, 0xB8, 0x84, 0xEA, 0x35, 0x4B,
+    0x2F, 0x49, 0xF7, 0x6F, 0xAC, 0x48, 0xE8, 0xA5, 0x53, 0x97, 0xB9, 0x80, 0x4E, 0xB4, 0x54, 0x85,
+    0x7A, 0xC0, 0x85, 0xB5, 0xDC, 0xAB, 0x3E, 0xB4, 0x23, 0xED, 0x27, 0x20, 0x96, 0xB8, 0x70, 0x49,
+    0x5E, 0x90, 0xC2, 0x06, 0x8C, 0x34, 0xC1, 0x64, 0x0A, 0x4F, 0x9C, 0xF6, 0xD2, 0xE7, 0xFC, 0x16,
+    0x9A, 0x60, 0x0A, 0x92, 0x1B, 0xFB, 0xE3, 0xB4, 0xF7, 0x92, 0xEA, 0x3E, 0xFF, 0xB7, 0x7F, 0xCC,
+    0xCE, 0x6C, 0xDF, 0x1C, 0xFD, 0x4F, 0xBA, 0xBD, 0xFB, 0xCB, 0x68, 0x1F, 0xDC, 0x8C, 0x19, 0x31,
+    0x09, 0x17, 0xD8, 0x47, 0x7D, 0x3C, 0x7B, 0x4E, 0x06, 0x7F, 0x0A, 0x20, 0xF8, 0xE7, 0x23, 0x95,
+    0xBC, 0x11, 0xA8, 0x7F, 0x3A, 0xC3, 0x63, 0xEB, 0x10, 0xA1, 0xB3, 0xAE, 0xAC, 0x73, 0x3F, 0x29,
+    0x79, 0x43, 0x46, 0xD5, 0x4F, 0x2E, 0xD3, 0x2E, 0x30, 0xE3, 0x27, 0x62, 0x84, 0x1F, 0x21, 0x5D,
+    0x99, 0x2B, 0x79, 0x53, 0x46, 0x27, 0x91, 0x9D, 0x25, 0xE0, 0x56, 0x95, 0xF5, 0x66, 0x51, 0xD3,
+    0x2D, 0x0A, 0x61, 0xDD, 0x59, 0x5F, 0x0C, 0xA4, 0x78, 0x1E, 0xD8, 0x3A, 0xDB, 0x44, 0xD2, 0x79,
+    0x09, 0x03, 0x3B, 0x0D, 0xBF, 0xFC, 0x42, 0xEA, 0x60, 0x09, 0x1A, 0x74, 0x19, 0xB6, 0x0B, 0x1C,
+    0x1D, 0xA0, 0xB2, 0xA3, 0x4A, 0x8F, 0x7E, 0x61, 0x75, 0xA8, 0xAB, 0x1B, 0xE8, 0xEC, 0x83, 0x19,
+    0x7D, 0xA8, 0x86, 0x07, 0x34, 0xCE, 0x17, 0xC1, 0xFF, 0x1F, 0x01, 0x4C, 0xA7, 0xAE, 0x7F, 0x9D,
+    0x59, 0x7B, 0xA8, 0x7A, 0xE0, 0x61, 0xEF, 0xEE, 0x0B, 0x45, 0x0D, 0xD7, 0x63, 0xB0, 0xCD, 0xDA,
+    0x39, 0xB6, 0x71, 0xED, 0x3B, 0x99, 0xC8, 0x9A, 0xA7, 0x2F, 0xA7, 0xDA, 0xB5, 0xCE, 0x59, 0x02,
+    0xFD, 0x2A, 0x89, 0xE0, 0x9E, 0x8D, 0x30, 0xD9, 0x80, 0xE9, 0x1E, 0xFB, 0xB2, 0xAA, 0xBD, 0xA0,
+    0x02, 0x7A, 0x6A, 0x3A, 0xEC, 0x20, 0xE0, 0xD4, 0xF8, 0x91, 0x05, 0xBE, 0x2E, 0xF4, 0x5D, 0x9F,
+    0xEB, 0x15, 0x57, 0xBA, 0xEA, 0x93, 0xEB, 0x38, 0x23, 0x45, 0x35, 0xE1, 0xA9, 0x07, 0x56, 0x4A,
+    0x3A, 0x25, 0xD2, 0x8F, 0x4A, 0xC6, 0x3E, 0x71, 0x99, 0x33, 0x9B, 0xEB, 0x8A, 0x88, 0x14, 0x5A,
+    0x11, 0x91, 0xE4, 0xDE, 0xD2, 0x99, 0x2D, 0x33, 0xE2, 0xD1, 0xB1, 0xA0, 0x33, 0x8F, 0x37, 0x1D,
+    0x1E, 0x74, 0x46, 0x2F, 0x0B, 0x84, 0x5F, 0x94, 0x71, 0xDE, 0x0D, 0x27, 0xE0, 0x65, 0x55, 0x0F,
+    0x68, 0x91, 0x74, 0xB2, 0x3C, 0x59, 0x5E, 0x5B, 0x42, 0x85, 0x97, 0x7D, 0xF9, 0x0D, 0x17, 0xF1,
+    0x90, 0x25, 0xE8, 0x8C, 0xD3, 0xAB, 0xE0, 0xF9, 0x5A, 0xAE, 0x45, 0x44, 0x56, 0xD4, 0x22, 0x22,
+    0x09, 0x2E, 0xAF, 0xD1, 0x99, 0x0D, 0x68, 0x56, 0xF4, 0x13, 0xAD, 0x64, 0x91, 0xD8, 0xD2, 0x97,
+    0x6A, 0xF4, 0xD4, 0x33, 0xDE, 0x75, 0x08, 0xF6, 0x95, 0x44, 0xD3, 0xE9, 0xF7, 0x32, 0x46, 0xA4,
+    0x14, 0x94, 0xC8, 0xCA, 0x07, 0xF6, 0xA1, 0x4E, 0xB8, 0x8E, 0x6A, 0xC2, 0x66, 0x68, 0x31, 0x2B,
+    0xB0, 0xD9, 0xC8, 0xA8, 0x3A, 0x79, 0xF7, 0x3D, 0x91, 0xC1, 0xCA, 0xE0, 0x64, 0xE0, 0x62, 0xE0,
+    0x62, 0x60, 0x77, 0x77, 0xF7, 0x3F, 0x89, 0xC8, 0xBF, 0x1C, 0x1E, 0x1E, 0x86, 0xDD, 0x25, 0xB5,
+    0xCB, 0x9A, 0x71, 0xEF, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xE7, 0x4A, 0x0D, 0xF9, 0xFA, 0x96,
+    0xFB, 0xDE, 0xAB, 0xC5, 0x83, 0x52, 0xC5, 0xA6, 0x63, 0x93, 0x8E, 0xEC, 0x53, 0x79, 0x13, 0x14,
+    0xE7, 0xBF, 0x51, 0xA5, 0xEC, 0xEA, 0x6E, 0xDC, 0x32, 0x37, 0xC6, 0xA6, 0x4E, 0xB3, 0xBB, 0x59,
+    0xBC, 0xCE, 0x80, 0xE2, 0xBC, 0xBB, 0x59, 0x6C, 0x2A, 0x75, 0x3A, 0x36, 0xE9, 0xA8, 0x8E, 0x93,
+    0x0D, 0xA3, 0xAB, 0x86, 0xE5, 0xBF, 0x09, 0x1B, 0xB0, 0xC3, 0x05, 0x3B, 0xA8, 0x99, 0xE6, 0x56,
+    0xA1, 0xEF, 0x6C, 0x5E, 0xE1, 0x62, 0x55, 0x1E, 0x81, 0xC0, 0x05, 0xFE, 0x3F, 0xBD, 0x98, 0xB1,
+    0xAF, 0xE5, 0xC6, 0x75, 0xC6, 0x7F, 0xE4, 0x78, 0x35, 0x41, 0x58, 0x8C, 0x0A, 0xAD, 0xE1, 0xD8,
+    0x89, 0xF8, 0x0F, 0xD8, 0x62, 0xE3, 0x22, 0x40, 0xF6, 0xBD, 0x99, 0x24, 0x85, 0x0B, 0x17, 0xDE,
+    0x42, 0x6B, 0x03, 0x71, 0xA1, 0x2A, 0xF5, 0x53, 0x61, 0x04, 0x2A, 0xF6, 0xBE, 0xCB, 0x08, 0x08,
+    0x52, 0xA4, 0xD0, 0x36, 0x49, 0x93, 0xC2, 0x4D, 0xD2, 0x28, 0xC5, 0xBA, 0x50, 0x61, 0x20, 0xEF,
+    0x3D, 0x8E, 0xA4, 0x42, 0x45, 0x0A, 0x8D, 0x2D, 0x38, 0x2E, 0x5C, 0x98, 0x80, 0x25, 0x08, 0x88,
+    0x8B, 0x1D, 0xC8, 0x23, 0x9B, 0xBB, 0x1A, 0xF2, 0x4B, 0x71, 0xEF, 0x5B, 0xED, 0x3A, 0x16, 0x62,
+    0x07, 0x46, 0x08, 0x70, 0x38, 0x33, 0x24, 0x0F, 0x0F, 0xCF, 0x39, 0x73, 0xBE, 0xEF, 0x0C, 0xB7,
+    0x6F, 0xC0, 0x95, 0xCD, 0xF8, 0xB7, 0x2A, 0x36, 0x9D, 0xF2, 0xE4, 0xD1, 0x4A, 0x2A, 0x7B, 0x69,
+    0xA5, 0xE2, 0x82, 0xA7, 0x4D, 0x2E, 0xF2, 0xB2, 0xC9, 0x40, 0x05, 0x3C, 0xE0, 0xDE, 0xBC, 0x13,
+    0x8C, 0x94, 0x91, 0xCA, 0x61, 0x22, 0xC2, 0xF1, 0x89, 0x66, 0xF4, 0x90, 0x5D, 0xE4, 0x96, 0xC9,
+    0xCD, 0x59, 0x27, 0xE9, 0x5D, 0x49, 0x33, 0x34, 0x00, 0xCD, 0x02, 0xE0, 0x23, 0x60, 0x57, 0x80,
+    0x69, 0x06, 0x9C, 0x07, 0xDA, 0x8F, 0x0A, 0x70, 0xE2, 0x22, 0xD8, 0x58, 0x81, 0xA5, 0x9B, 0xC1,
+    0xE1, 0xA1, 0xCD, 0xA6, 0x80, 0xBF, 0x73, 0x36, 0x62, 0xA5, 0x0A, 0xDB, 0xEB, 0xF7, 0x13, 0x7D,
+    0x60, 0x4F, 0x9B, 0x31, 0x99, 0x53, 0xF0, 0x63, 0x17, 0x69, 0xEA, 0x33, 0xBA, 0xD7, 0xA8, 0x6A,
+    0xC5, 0x2B, 0x02, 0x0C, 0xD2, 0x66, 0x25, 0x8D, 0x2E, 0xDA, 0xD9, 0x64, 0xDE, 0xA0, 0xF2, 0xE5,
+    0xA7, 0x75, 0xDE, 0x5E, 0x0F, 0x78, 0x09, 0xF7, 0xA3, 0xB3, 0x6C, 0x32, 0x13, 0x15, 0x17, 0x3D,
+    0x6D, 0x71, 0x91, 0x4B, 0x93, 0xF1, 0x54, 0x86, 0xE8, 0x39, 0x8B, 0x93, 0x14, 0xA5, 0x2D, 0x1C,
+    0x0C, 0x75, 0xF3, 0x36, 0x93, 0x14, 0xF6, 0x8F, 0xA6, 0xD9, 0x64, 0x9B, 0x4D, 0x6E, 0x17, 0x93,
+    0x9B, 0xC5, 0x64, 0x16, 0x93, 0x9B, 0x62, 0xB2, 0xC9, 0xE6, 0xD1, 0xB7, 0xA3, 0x91, 0x66, 0xF3,
+    0xE8, 0x7E, 0x35, 0xB9, 0x59, 0x4D, 0x66, 0x6F, 0x32, 0xFE, 0x78, 0xEE, 0x4D, 0x66, 0x33, 0xD9,
+    0xD6, 0x41, 0xCA, 0x9F, 0x0A, 0xA6, 0x95, 0xF4, 0xA1, 0xA4, 0xB1, 0x72, 0x6E, 0x32, 0xC5, 0x45,
+    0x93, 0x3C, 0x1D, 0x95, 0xE7, 0x4C, 0x3E, 0x68, 0xEE, 0x0F, 0xEE, 0xF8, 0xEC, 0x61, 0xA7, 0x8C,
+    0x0E, 0x36, 0x00, 0x7A, 0x49, 0xC9, 0x48, 0x4A, 0xD8, 0xD8, 0x8F, 0x34, 0xD9, 0xCE, 0xF0, 0xFD,
+    0x66, 0x81, 0x17, 0x38, 0x07, 0x17, 0xFA, 0x11, 0x93, 0xEC, 0x0C, 0xB9, 0x59, 0xE0, 0x2E, 0xE7,
+    0xF0, 0x02, 0xFD, 0x88, 0x1B, 0xED, 0x8C, 0x89, 0xCD, 0x42, 0x93, 0x39, 0x87, 0x85, 0x7E, 0xE4,
+    0x16, 0x76, 0xC6, 0xD3, 0x2C, 0x0C, 0x63, 0x73, 0x85, 0x24, 0xAD, 0x7B, 0x49, 0x7A, 0x2D, 0x42,
+    0xF7, 0xB3, 0x19, 0x9A, 0xB2, 0x00, 0x27, 0x27, 0x80, 0xEB, 0x00, 0xF3, 0x66, 0x04, 0x5E, 0x3E,
+    0xBA, 0x44, 0x5F, 0x93, 0x94, 0x5C, 0xA4, 0x98, 0xCC, 0x57, 0xA8, 0xD8, 0x5F, 0x0B, 0xA3, 0x9B,
+    0x2F, 0x1E, 0x5C, 0x22, 0x85, 0xA7, 0x23, 0x2F, 0xF2, 0x05, 0x93, 0x71, 0x54, 0x4C, 0xF4, 0x7C,
+    0x3E, 0x4F, 0x52, 0x95, 0xB4, 0xD1, 0x04, 0x80, 0x67, 0xDB, 0xDA, 0x68, 0x63, 0x62, 0x8A, 0xC3,
+    0xC6, 0x3E, 0x0E, 0x85, 0x8A, 0xFF, 0x1E, 0x3D, 0x9E, 0x01, 0xCC, 0xEC, 0x62, 0x0F, 0xDC, 0x32,
+    0xD9, 0x8D, 0xD0, 0x8D, 0xD5, 0x46, 0x20, 0x7B, 0x93, 0x80, 0xFE, 0xA5, 0xFF, 0xCC, 0x80, 0x95,
+    0x16, 0xC0, 0x3C, 0xDC, 0xCE, 0x02, 0xB4, 0xC5, 0x1F, 0x34, 0x70, 0xF1, 0x0A, 0x58, 0x4D, 0x76,
+    0x09, 0x26, 0x6A, 0x53, 0x61, 0x8F, 0xC7, 0x8F, 0xF8, 0xD1, 0x45, 0x5B, 0xF0, 0xD1, 0x64, 0xA6,
+    0xE0, 0x53, 0xA7, 0xD9, 0x15, 0x9F, 0xAC, 0x16, 0xF4, 0x77, 0x01, 0xE0, 0x46, 0xE0, 0x8B, 0xF7,
+    0x18, 0xB4, 0xB4, 0xBA, 0x5F, 0x5D, 0x32, 0xE5, 0x94, 0x6E, 0x2E, 0xF4, 0xAF, 0x46, 0xCE, 0xA1,
+    0xCD, 0xE0, 0x46, 0xEE, 0x54, 0xAC, 0x66, 0x9C, 0x32, 0xF4, 0x19, 0x5C, 0x82, 0x61, 0x84, 0xAB,
+    0x57, 0x30, 0xBF, 0xCA, 0xB8, 0x77, 0x0B, 0x5B, 0xBF, 0x4D, 0xB3, 0xD3, 0x4A, 0xF3, 0xD7, 0x47,
+    0xCF, 0x76, 0x2A, 0x8D, 0xB4, 0x5F, 0xE9, 0x34, 0x7A, 0x70, 0xD1, 0x64, 0xA8, 0x78, 0x0E, 0xEA,
+    0xB8, 0x8A, 0xC7, 0x28, 0x9A, 0x4C, 0xAD, 0x78, 0xBC, 0x8B, 0x26, 0xBB, 0x58, 0xF1, 0x26, 0xBB,
+    0x68, 0x72, 0xA5, 0xE2, 0x3D, 0x2E, 0x1A, 0x45, 0x2A, 0x3E, 0xE3, 0xA2, 0xA9, 0x47, 0x09, 0x47,
+    0x61, 0xAD, 0x0A, 0xD3, 0x26, 0x85, 0x5E, 0xF3, 0xF1, 0xAB, 0xA5, 0xC9, 0xD0, 0x8F, 0x43, 0x80,
+    0xED, 0xDB, 0x19, 0x5A, 0x2D, 0x00, 0xB7, 0x9F, 0xCA, 0x24, 0x93, 0x42, 0xAF, 0x5F, 0x29, 0x31,
+    0x2D, 0x8F, 0x95, 0x72, 0xD1, 0x64, 0x4C, 0xC5, 0x83, 0xA2, 0xC9, 0xF8, 0x8A, 0xC7, 0xBD, 0x1B,
+    0x4D, 0x36, 0xB9, 0xE2, 0xA9, 0x2E, 0x9A, 0xEC, 0xA9, 0x78, 0x17, 0x5D, 0x34, 0xBF, 0xC8, 0x54,
+    0x7C, 0xC5, 0x45, 0x23, 0xA8, 0xF8, 0xF8, 0xE4, 0x1F, 0xBA, 0x38, 0x28, 0x74, 0x7A, 0xA0, 0xD2,
+    0x68, 0x03, 0x1A, 0x26, 0x8D, 0x7D, 0xDC, 0x6F, 0xF8, 0x64, 0x32, 0x5B, 0x34, 0xB9, 0xC9, 0x98,
+    0x6C, 0x12, 0x26, 0x77, 0x11, 0x93, 0x1D, 0x98, 0xFC, 0x02, 0x98, 0x8F, 0xEF, 0x82, 0x51, 0x05,
+    0xF3, 0xCB, 0x2B, 0x30, 0xD9, 0x83, 0xC9, 0x7D, 0xC4, 0x64, 0x37, 0x63, 0xB2, 0xC9, 0x98, 0xDC,
+    0x56, 0x4C, 0x66, 0xC3, 0x64, 0xF6, 0xE3, 0xA0, 0x30, 0xCC, 0x52, 0xE8, 0xEA, 0x13, 0x3F, 0xDA,
+    0x4B, 0x4A, 0x56, 0x52, 0xA2, 0x8B, 0xC3, 0x48, 0x3B, 0xFF, 0xDA, 0xB2, 0x1A, 0x1F, 0x2F, 0xAB,
+    0xD2, 0x2C, 0x70, 0x8B, 0x73, 0xE8, 0xE9, 0x47, 0xBA, 0x68, 0x67, 0xCC, 0xDC, 0x2C, 0x50, 0x38,
+    0x87, 0x0B, 0xFA, 0x91, 0x53, 0xEC, 0xFC, 0x07, 0x03, 0xCD, 0x62, 0x35, 0x72, 0xDE, 0x2A, 0x36,
+    0xAA, 0xFB, 0xB1, 0x91, 0x6E, 0x84, 0x27, 0xCC, 0xAA, 0x85, 0x46, 0xD9, 0x2A, 0x32, 0xAC, 0x74,
+    0x2B, 0x66, 0x83, 0x7F, 0x9F, 0xD9, 0x67, 0xDC, 0x9E, 0x6E, 0x0F, 0xBF, 0xCC, 0x7C, 0x94, 0x71,
+    0x7D, 0xE8, 0x07, 0xC8, 0xB5, 0xFD, 0x61, 0xC6, 0x75, 0xF1, 0x56, 0x4F, 0x93, 0x77, 0xF6, 0x6F,
+    0x0B, 0xBD, 0x99, 0xDF, 0xE8, 0x43, 0x93, 0x07, 0x47, 0xE1, 0x05, 0x3E, 0x9E, 0xDD, 0xD8, 0xCE,
+    0xEE, 0x92, 0x85, 0x53, 0xA6, 0xE8, 0xA2, 0x49, 0x66, 0xA1, 0x72, 0x82, 0xC7, 0x45, 0x93, 0x9A,
+    0xCC, 0x45, 0xAB, 0xF9, 0x73, 0x4C, 0xEB, 0x24, 0xB8, 0x0E, 0x82, 0x56, 0x2B, 0x7B, 0xBD, 0xA3,
+    0x84, 0x1E, 0x52, 0x61, 0x08, 0x26, 0xC3, 0x25, 0x2E, 0xD2, 0x16, 0x3C, 0x74, 0xE9, 0xA9, 0xE9,
+    0x1F, 0xDD, 0xF9, 0x56, 0xC1, 0x4B, 0x4A, 0x48, 0xC7, 0x75, 0xFD, 0xD9, 0x4F, 0x7F, 0x3A, 0xDD,
+    0x29, 0x35, 0x5A, 0xA4, 0xD0, 0x2B, 0xC3, 0x5F, 0x05, 0xB0, 0x52, 0xA0, 0xD3, 0x54, 0x71, 0x85,
+    0x29, 0x76, 0x19, 0xBB, 0xD8, 0x0C, 0x53, 0xBB, 0x80, 0x9B, 0x2B, 0xB4, 0x75, 0x0F, 0xEC, 0xFB,
+    0x08, 0xEE, 0x3F, 0x66, 0x30, 0x1F, 0x2D, 0x40, 0x9D, 0x00, 0xDF, 0x47, 0xE8, 0xDF, 0xC9, 0xD0,
+    0xCD, 0x1B, 0x98, 0x32, 0x44, 0xDA, 0x6A, 0x2A, 0x4D, 0x65, 0x9F, 0xDA, 0x15, 0x2B, 0xAD, 0x30,
+    0x68, 0x01, 0xEE, 0x84, 0xC7, 0xAB, 0xEC, 0x3A, 0xC5, 0x6D, 0xC1, 0xC3, 0x30, 0x9A, 0x4C, 0xB3,
+    0xE0, 0xA1, 0xFF, 0x7D, 0x75, 0x5B, 0x95, 0x46, 0x55, 0x0A, 0x5E, 0x91, 0x3B, 0xB7, 0x99, 0xA4,
+    0x71, 0xFF, 0x68, 0x2A, 0x26, 0xDB, 0x6A, 0x32, 0xD5, 0x64, 0x2E, 0x9F, 0x38, 0xEB, 0x01, 0x6F,
+    0xBE, 0x94, 0x8D, 0x34, 0x1A, 0x3D, 0xC4, 0x64, 0x7E, 0xE3, 0x39, 0x68, 0x3C, 0x02, 0xC1, 0x9D,
+    0x40, 0x2B, 0x85, 0x4E, 0x4A, 0x5D, 0x69, 0x8A, 0x9D, 0x39, 0x31, 0x19, 0xF7, 0x17, 0x85, 0x36,
+    0x5E, 0x27, 0xD8, 0x7E, 0x84, 0x6E, 0x86, 0x76, 0x01, 0xAE, 0x80, 0x21, 0x82, 0xCD, 0xC0, 0x7A,
+    0x04, 0x6E, 0xBB, 0x02, 0xD3, 0xC3, 0x6F, 0xBE, 0x61, 0xA5, 0x7A, 0xB0, 0xD3, 0xCD, 0xF0, 0xD8,
+    0x48, 0x9B, 0x24, 0x3D, 0x18, 0x7D, 0x38, 0x2D, 0xA6, 0x98, 0x9F, 0xE2, 0xC3, 0x57, 0x5E, 0x36,
+    0xA5, 0x1D, 0xF1, 0x01, 0x4C, 0x81, 0xDF, 0xA9, 0xF3, 0x8C, 0x56, 0x90, 0xD2, 0xC1, 0x09, 0x83,
+    0xB2, 0xD3, 0x87, 0x7A, 0xBF, 0x99, 0x66, 0x17, 0xE9, 0x62, 0xBB, 0x60, 0x66, 0x3C, 0x6D, 0xA6,
+    0x9B, 0x59, 0xA0, 0x72, 0x17, 0x86, 0xF1, 0x14, 0x4C, 0xEE, 0x81, 0x73, 0x37, 0x82, 0x7B, 0x3B,
+    0x42, 0xF3, 0x68, 0x06, 0x7C, 0x06, 0xEC, 0xC2, 0x11, 0x50, 0x78, 0x01, 0xA0, 0x07, 0xDC, 0x4B,
+    0x01, 0x8C, 0x46, 0x40, 0x23, 0x70, 0x03, 0x00, 0xAB, 0x05, 0x1A, 0x3D, 0xE4, 0x88, 0x4A, 0x54,
+    0x60, 0xD0, 0x16, 0x90, 0x1E, 0xAC, 0x6C, 0x26, 0x0F, 0x69, 0xA5, 0x36, 0x75, 0x8F, 0xC7, 0xDF,
+    0x0F, 0x2E, 0xDA, 0x07, 0xC9, 0xE4, 0x46, 0x85, 0xCA, 0xF9, 0x15, 0x9E, 0xE1, 0xBB, 0xD1, 0x45,
+    0xF7, 0x56, 0x35, 0xB9, 0x4F, 0xC3, 0x07, 0xEB, 0x59, 0x6A, 0x24, 0x8D, 0x34, 0x67, 0x1F, 0x5C,
+    0xCB, 0x6C, 0xD6, 0x00, 0x56, 0x05, 0x9A, 0x3B, 0x2F, 0x1E, 0x83, 0xCD, 0x69, 0x71, 0x7A, 0x53,
+    0x4B, 0x33, 0x25, 0x5B, 0xE8, 0x03, 0x13, 0x6E, 0xC4, 0x65, 0x17, 0x61, 0xED, 0x22, 0xF4, 0xEF,
+    0x24, 0x68, 0xF5, 0xE9, 0x2F, 0x15, 0xC0, 0x08, 0x68, 0x95, 0xA1, 0x29, 0x2B, 0xB0, 0xF4, 0x11,
+    0x6A, 0x5B, 0xE1, 0x12, 0x3F, 0x72, 0x8E, 0x2D, 0x78, 0x98, 0x98, 0x96, 0x66, 0xDA, 0x24, 0xA4,
+    0xF1, 0x1A, 0x41, 0xAC, 0xEA, 0x7E, 0xC5, 0x6F, 0x78, 0xF0, 0xC1, 0x64, 0x4C, 0xF9, 0xBD, 0x75,
+    0x0B, 0xB6, 0xB4, 0xD2, 0x01, 0xA7, 0x8F, 0xBE, 0xAC, 0x00, 0x5D, 0x04, 0xB8, 0x00, 0xB0, 0x11,
+    0xE0, 0x4F, 0x01, 0xCC, 0x21, 0x96, 0xBC, 0x5E, 0xD5, 0x3A, 0x6C, 0x8D, 0x8A, 0x29, 0xF4, 0xF1,
+    0xD7, 0x9A, 0xF6, 0x71, 0xD3, 0x54, 0xFA, 0x88, 0xE8, 0x23, 0x93, 0x14, 0xE9, 0xA5, 0x08, 0x2F,
+    0xF6, 0x11, 0xF8, 0xAC, 0xA6, 0xD5, 0x0A, 0x9D, 0x56, 0xAE, 0xC3, 0xEA, 0x4D, 0xAD, 0xBD, 0x3E,
+    0xD4, 0x3D, 0xBF, 0x1A, 0xCD, 0x2E, 0x52, 0x0F, 0x20, 0xE3, 0x31, 0x99, 0x8A, 0x8B, 0xD4, 0x43,
+    0xDF, 0xF3, 0x7B, 0xBF, 0x19, 0x4C, 0x66, 0xCF, 0x24, 0x49, 0x5A, 0x75, 0x38, 0xC6, 0xC7, 0x49,
+    0x27, 0xEF, 0xF5, 0x35, 0x2D, 0xFB, 0x87, 0x46, 0xC9, 0x6F, 0xD7, 0x92, 0xFE, 0xFF, 0x9A, 0x82,
+    0xC7, 0xE6, 0xF6, 0xA0, 0x55, 0x3D, 0x6A, 0x77, 0xA4, 0x94, 0xF5, 0x18, 0xAB, 0xC7, 0xE1, 0x72,
+    0x54, 0xF9, 0xA8, 0xFB, 0x1B, 0x87, 0x8B, 0xB9, 0xB6, 0xB0, 0x32, 0x4E, 0x7A, 0x1F, 0x33, 0x77,
+    0x09, 0x4A, 0x5B, 0xE0, 0x16, 0x97, 0x60, 0x19, 0x02, 0xD0, 0x25, 0xA0, 0x2D, 0x00, 0xD3, 0x76,
+    0x0F, 0x06, 0x09, 0xBA, 0x0F, 0xCE, 0x32, 0x6D, 0x61, 0x3A, 0x02, 0xC2, 0x10, 0x4C, 0x3E, 0xC0,
+    0xC4, 0x01, 0x1A, 0x2E, 0x19, 0x46, 0x86, 0xB0, 0x3F, 0x7A, 0x7E, 0xFF, 0x29, 0x7F, 0x3E, 0x5A,
+    0x6F, 0xC1, 0xAA, 0xEE, 0x37, 0xF0, 0x5B, 0xF0, 0x5C, 0x83, 0xCB, 0xE1, 0xE5, 0xCF, 0x1A, 0xE8,
+    0x1E, 0x43, 0x30, 0xD2, 0xDC, 0x16, 0xFC, 0x9D, 0x29, 0x0E, 0xC1, 0x64, 0xD6, 0xB6, 0xE0, 0xB1,
+    0xF3, 0x10, 0x4C, 0xC6, 0xB7, 0x05, 0x8F, 0xC9, 0x43, 0x30, 0x99, 0xF3, 0xB6, 0xE0, 0x71, 0x69,
+    0x08, 0x26, 0xDB, 0xA5, 0x2D, 0xAD, 0xB4, 0xB5, 0xAA, 0xD2, 0xC6, 0xFE, 0x31, 0xF9, 0x06, 0x06,
+    0xCD, 0x58, 0xCD, 0x4F, 0x55, 0x4A, 0x3C, 0xCD, 0x79, 0xB5, 0xDD, 0xC3, 0x4B, 0xC1, 0xFD, 0xE8,
+    0xAC, 0xFC, 0x8E, 0x65, 0x08, 0x7B, 0x15, 0x86, 0x83, 0xD2, 0x53, 0x1C, 0x68, 0xB6, 0x76, 0xA6,
+    0xCB, 0x7F, 0x72, 0x48, 0xA4, 0xED, 0x02, 0xF4, 0xB1, 0xB9, 0xF3, 0xCD, 0x8A, 0x97, 0xA2, 0x91,
+    0xEA, 0x71, 0x25, 0x34, 0x0B, 0x30, 0x84, 0x80, 0xC9, 0xB7, 0xE0, 0xAA, 0x4B, 0xF4, 0x71, 0x1A,
+    0xBB, 0x62, 0xA4, 0x95, 0x4E, 0x1B, 0x34, 0xC7, 0xA4, 0x74, 0x23, 0x30, 0x28, 0x31, 0x69, 0xB4,
+    0x4A, 0x8D, 0x54, 0x71, 0xB1, 0xD9, 0xD8, 0x47, 0x93, 0x59, 0x31, 0x95, 0xCA, 0x15, 0xEC, 0x83,
+    0xC7, 0x83, 0x9B, 0x5D, 0x1C, 0x46, 0x9A, 0x7A, 0x20, 0xCB, 0x9E, 0xF5, 0x5B, 0x19, 0x5C, 0xF4,
+    0xAA, 0x60, 0xB2, 0x93, 0x80, 0x6A, 0xF2, 0xA1, 0x54, 0xA9, 0xA6, 0x80, 0x8B, 0x9E, 0x0D, 0xEC,
+    0xEC, 0xE2, 0x10, 0x31, 0xC5, 0x64, 0xB3, 0xD0, 0x54, 0x2A, 0x53, 0xA0, 0xE2, 0x71, 0x4B, 0xB3,
+    0x32, 0xAD, 0x48, 0x2B, 0x52, 0xB0, 0x07, 0xC2, 0xC9, 0xA7, 0xCC, 0xA8, 0x99, 0x54, 0x0F, 0x41,
+    0xE6, 0xC7, 0x3E, 0x70, 0x45, 0x1F, 0xA8, 0xBF, 0xA1, 0xD9, 0xD3, 0x07, 0x86, 0xF7, 0x87, 0x40,
+    0x27, 0x05, 0x1A, 0x29, 0x60, 0x72, 0x1F, 0xE8, 0xE6, 0x3E, 0xE0, 0x62, 0x1F, 0x0E, 0x02, 0x26,
+    0xFA, 0xD0, 0x56, 0xFA, 0xB1, 0x2B, 0x8D, 0xAA, 0x4F, 0x56, 0xF5, 0xE6, 0xE1, 0x93, 0x60, 0x95,
+    0xD0, 0x14, 0x5D, 0x1A, 0x46, 0xCF, 0x29, 0xDF, 0xB9, 0xAE, 0xBD, 0x5E, 0x8A, 0xAD, 0xC4, 0xFE,
+    0x51, 0x35, 0xC5, 0xE4, 0x21, 0xB8, 0x78, 0x89, 0x6F, 0xAA, 0x59, 0x8D, 0x36, 0xBD, 0xAD, 0xB7,
+    0x6B, 0x73, 0xBB, 0x01, 0x78, 0x16, 0xBE, 0x79, 0x78, 0x52, 0x8B, 0x99, 0x3F, 0x1F, 0x3C, 0x34,
+    0xE5, 0x90, 0x10, 0x4F, 0x81, 0x32, 0x15, 0xFB, 0x40, 0xCB, 0x50, 0xBA, 0xE5, 0x0A, 0xFB, 0x8B,
+    0x8C, 0xFB, 0x69, 0xA4, 0xBF, 0x0F, 0xE7, 0x97, 0x34, 0x0F, 0x17, 0xEC, 0x87, 0x99, 0xE1, 0x1B,
+    0x89, 0xDA, 0x27, 0x97, 0x86, 0x4F, 0x36, 0x7A, 0x25, 0x6E, 0xDC, 0x66, 0x52, 0xE9, 0xA4, 0xDC,
+    0xC5, 0x61, 0xBC, 0x4B, 0xB5, 0xB1, 0x8B, 0x77, 0x59, 0xEC, 0x7F, 0xDD, 0x67, 0xAF, 0x62, 0xD3,
+    0x59, 0xBC, 0xCB, 0xB9, 0x8D, 0x66, 0xBE, 0xCB, 0xA9, 0x8D, 0xEE, 0x2D, 0xDD, 0x2F, 0x87, 0x42,
+    0x87, 0x49, 0x3A, 0x93, 0xD2, 0xD5, 0x8D, 0xDC, 0x87, 0x5B, 0x36, 0xB9, 0xA6, 0xB4, 0xE3, 0x0E,
+    0xFA, 0x80, 0x4D, 0x34, 0x05, 0x1E, 0x0F, 0x3A, 0xCD, 0x4E, 0x95, 0x56, 0x52, 0x1C, 0xA4, 0x05,
+    0x47, 0x85, 0xEC, 0x46, 0x1C, 0xCB, 0xA1, 0xF3, 0x3C, 0x0B, 0x6D, 0x72, 0x23, 0x27, 0x2C, 0x98,
+    0xE8, 0x46, 0x5E, 0x61, 0xC1, 0x05, 0x37, 0xB6, 0x99, 0xDA, 0x4A, 0x5A, 0xBD, 0xA4, 0x9F, 0xCD,
+    0x70, 0x7A, 0x02, 0xE6, 0xBD, 0x04, 0x27, 0x5F, 0x86, 0xF6, 0xAD, 0x08, 0x7F, 0xCC, 0xB5, 0x85,
+    0xF7, 0x1B, 0x7B, 0xCD, 0xE7, 0xAC, 0x9E, 0xFE, 0xBB, 0xC1, 0x7C, 0x92, 0xD8, 0x0E, 0xE9, 0x67,
+    0x82, 0x2E, 0xD2, 0x16, 0xD8, 0x83, 0x5B, 0x9A, 0x7B, 0x52, 0xE9, 0xB4, 0x70, 0x33, 0xF0, 0x39,
+    0x80, 0x30, 0x8C, 0xFB, 0x6A, 0xF3, 0x30, 0xEF, 0x4B, 0x9F, 0x9B, 0xD2, 0xC5, 0x53, 0xB8, 0xDB,
+    0xC5, 0xEF, 0xC3, 0x57, 0xBA, 0x98, 0xC1, 0x75, 0x6F, 0xCD, 0xD0, 0xFD, 0xF3, 0x8F, 0x23, 0x38,
+    0x29, 0x42, 0xFF, 0xF5, 0xB7, 0x33, 0x9C, 0x76, 0x6F, 0x16, 0xB8, 0xE8, 0x62, 0xA5, 0x59, 0xBA,
+    0x78, 0x8E, 0xC9, 0x5D, 0xF4, 0xC1, 0xA5, 0xE1, 0x7D, 0x97, 0xF6, 0xE3, 0x54, 0xED, 0xF2, 0xDC,
+    0x81, 0xF9, 0xDF, 0x80, 0x69, 0x43, 0x9A, 0x5F, 0x69, 0xEA, 0xE7, 0xF0, 0xD0, 0x45, 0x4C, 0x6A,
+    0xFE, 0x2D, 0xE1, 0x57, 0xE8, 0x23, 0xCD, 0x02, 0xA7, 0x5F, 0xA6, 0x7F, 0x2D, 0xBA, 0xB7, 0x34,
+    0xA5, 0x41, 0x89, 0x3B, 0x30, 0x55, 0xA3, 0x4F, 0x34, 0xFA, 0xB5, 0x4B, 0x9C, 0xB2, 0xC3, 0x25,
+    0x9B, 0xCC, 0xCA, 0x8E, 0x4F, 0x92, 0x4D, 0x27, 0x27, 0xEC, 0xDC, 0x5F, 0x26, 0xFB, 0x5E, 0x3A,
+    0xE1, 0xBC, 0x98, 0x64, 0x2B, 0x27, 0xEC, 0x31, 0xC9, 0x26, 0x4E, 0x5A, 0x8D, 0xFD, 0xA6, 0xD5,
+    0x28, 0xF3, 0x9D, 0x66, 0xC6, 0x8D, 0x03, 0x54, 0x93, 0x31, 0x8F, 0x56, 0x78, 0xE6, 0xE1, 0x93,
+    0x29, 0x2F, 0x7A, 0x4D, 0x8B, 0x51, 0xBA, 0xC4, 0xCC, 0x36, 0xB1, 0xB2, 0xC3, 0x27, 0x9B, 0xDC,
+    0x25, 0x3B, 0xF3, 0x5E, 0xB2, 0xA9, 0x9C, 0xB0, 0x3B, 0x31, 0xC9, 0x3E, 0x08, 0x27, 0xEC, 0xA3,
+    0x49, 0x36, 0x73, 0xC2, 0x0E, 0x93, 0x86, 0xA5, 0xD1, 0x03, 0x25, 0x2F, 0xE0, 0xD9, 0xA9, 0xB6,
+    0xCB, 0xB4, 0x74, 0x4B, 0x97, 0xFA, 0x60, 0xD3, 0x09, 0x36, 0xBD, 0x82, 0x4D, 0x19, 0xFB, 0x61,
+    0xC2, 0x6A, 0xC6, 0xFE, 0xB0, 0x60, 0x53, 0xC5, 0xA6, 0x73, 0x6C, 0xF2, 0xC1, 0x26, 0x17, 0x87,
+    0xC5, 0x66, 0xAD, 0xCD, 0x0A, 0x3C, 0xD7, 0x4A, 0x1A, 0x27, 0x29, 0x35, 0x79, 0x08, 0xDC, 0xB2,
+    0x09, 0xD7, 0x14, 0xEC, 0xB8, 0xA3, 0x99, 0xFB, 0xC0, 0x1B, 0x36, 0x71, 0xAB, 0x29, 0x38, 0x76,
+    0xD8, 0xB1, 0x0F, 0x26, 0xD9, 0xF4, 0x67, 0xB9, 0x29, 0x7D, 0x69, 0xF5, 0x61, 0x31, 0xAA, 0xB7,
+    0x0F, 0xC4, 0xC6, 0x6E, 0x6E, 0xC3, 0x28, 0xEC, 0x63, 0x23, 0x9E, 0x2F, 0x7C, 0x12, 0xED, 0x7D,
+    0xFE, 0x26, 0x37, 0x3F, 0x4B, 0xB7, 0x2E, 0x78, 0xE5, 0xE2, 0xF9, 0x81, 0xE7, 0xDD, 0x37, 0xBA,
+    0x68, 0x5F, 0xFD, 0xF0, 0xD5, 0xDC, 0xCC, 0xFB, 0x78, 0xC1, 0x2B, 0x6E, 0x1E, 0x78, 0xBE, 0xC9,
+    0x5D, 0xB4, 0xE3, 0x9F, 0xB6, 0xB9, 0xDB, 0x68, 0xF5, 0x0F, 0x8A, 0x46, 0x79, 0x5A, 0xAD, 0x3E,
+    0x52, 0xEE, 0x15, 0xAE, 0xB0, 0x73, 0x53, 0xE8, 0x47, 0x9B, 0x38, 0xA7, 0x0F, 0xCD, 0xC2, 0xF9,
+    0x9D, 0x6F, 0xCF, 0x8D, 0xA4, 0xD1, 0x7E, 0x70, 0xE7, 0xEA, 0x30, 0xB5, 0x7B, 0xEA, 0xA9, 0xA9,
+    0x74, 0x7A, 0x4D, 0xF3, 0x5E, 0xD0, 0x04, 0x98, 0x36, 0x8C, 0x14, 0x5D, 0xEA, 0xB3, 0xC7, 0x94,
+    0x53, 0xDA, 0xE5, 0x12, 0xEA, 0x05, 0xD4, 0x0A, 0x75, 0x85, 0x7A, 0x09, 0x75, 0xA2, 0x59, 0x7C,
+    0x30, 0x79, 0x48, 0xDD, 0xEC, 0xB6, 0x69, 0x6C, 0xB5, 0xC2, 0xCD, 0xC0, 0x24, 0xE9, 0xE7, 0x92,
+    0x1E, 0x76, 0x33, 0x97, 0xEC, 0xE8, 0x92, 0x4D, 0xBF, 0x5D, 0xA7, 0x55, 0x1A, 0x56, 0xAD, 0x56,
+    0x33, 0xDC, 0xE0, 0x99, 0xB2, 0x5F, 0xBA, 0x6D, 0x52, 0x3C, 0x5B, 0xBF, 0xB4, 0x98, 0x72, 0x80,
+    0x8C, 0xE4, 0x69, 0x17, 0x17, 0x39, 0x37, 0x99, 0x7E, 0xAC, 0xD8, 0xE4, 0x69, 0xB3, 0x8B, 0x54,
+    0x93, 0xB9, 0x62, 0x65, 0x3A, 0xEE, 0xAC, 0xAC, 0xFF, 0x13, 0x87, 0xEC, 0xC7, 0xD0, 0x2B, 0xF3,
+    0xCC, 0xEB, 0xFF, 0x02, 0x34, 0x81, 0x61, 0xC3, 0x2B, 0x7B, 0xD6, 0x81, 0xFE, 0x1B, 0xA3, 0xF9,
+    0xFB, 0x44, 0x9B, 0xA1, 0x72, 0x2C, 0xD8, 0xDA, 0x0A, 0xFB, 0x11, 0xF7, 0x90, 0xDB, 0xD2, 0xD2,
+    0x69, 0x39, 0x64, 0x21, 0xFD, 0x42, 0xD2, 0xBB, 0xFF, 0xF4, 0xF0, 0xA5, 0x5B, 0x36, 0xDD, 0xCA,
+    0x7D, 0xF8, 0x28, 0xEE, 0x4C, 0x68, 0x0A, 0xD8, 0x04, 0x7D, 0x80, 0xDD, 0x21, 0xDF, 0x1D, 0x87,
+    0xCF, 0x28, 0xB3, 0x57, 0x62, 0xBF, 0x19, 0xBD, 0xA3, 0x34, 0x2C, 0x2E, 0x71, 0xCA, 0x39, 0x5D,
+    0x34, 0x99, 0x85, 0x21, 0xF4, 0x50, 0xDB, 0x4C, 0x17, 0x4F, 0xE0, 0xB4, 0x8B, 0x98, 0x5C, 0xA0,
+    0x7F, 0x09, 0x78, 0x34, 0x43, 0x57, 0x01, 0x3F, 0x1E, 0x76, 0x51, 0x38, 0xBD, 0x66, 0x93, 0x05,
+    0x5E, 0x3E, 0x07, 0xA7, 0x11, 0x34, 0xC3, 0x33, 0x87, 0xAA, 0xF5, 0x39, 0x8E, 0x6F, 0xF4, 0xF5,
+    0x31, 0xFB, 0xFC, 0x0D, 0xCD, 0xA0, 0x85, 0x56, 0xD2, 0xE8, 0xDE, 0xBF, 0x18, 0xE6, 0x21, 0x5C,
+    0x98, 0x72, 0xCA, 0x45, 0x53, 0x2F, 0xB9, 0xA0, 0x5E, 0x70, 0xC1, 0x45, 0x7D, 0xDC, 0x5C, 0x72,
+    0x41, 0x3D, 0xE7, 0x82, 0xC5, 0x87, 0x0B, 0x93, 0xFB, 0xF7, 0x2F, 0xFA, 0x64, 0x25, 0x05, 0xF6,
+    0x2A, 0x9F, 0xF1, 0x8D, 0x4B, 0xC0, 0x69, 0x86, 0x3F, 0x7C, 0xFD, 0x1E, 0x7E, 0xB3, 0x7A, 0x4D,
+    0x7F, 0xAE, 0xB4, 0xC7, 0x8D, 0x36, 0xBB, 0x91, 0xF3, 0x6E, 0xA4, 0xFB, 0x71, 0x84, 0x29, 0x1E,
+    0xB6, 0x81, 0x6C, 0x05, 0xF3, 0xD3, 0x88, 0xF9, 0x41, 0xC5, 0xCC, 0xC3, 0x68, 0xB2, 0x29, 0xDD,
+    0xD6, 0xE8, 0x27, 0xFA, 0x81, 0x96, 0x69, 0xED, 0xF4, 0x43, 0xCD, 0xC3, 0xC6, 0x25, 0x2E, 0x36,
+    0x05, 0x8F, 0x4D, 0x54, 0xFA, 0x60, 0x32, 0xBB, 0xFF, 0x6D, 0x6A, 0x92, 0xF4, 0x9A, 0x24, 0x5D,
+    0xB3, 0xBA, 0x36, 0x03, 0x76, 0x04, 0x9E, 0x07, 0xF8, 0xEA, 0x61, 0x2F, 0xA7, 0xF6, 0x3A, 0xDB,
+    0xAC, 0xC6, 0x4B, 0x06, 0x86, 0xD0, 0xC5, 0x2E, 0xB5, 0xB9, 0x2D, 0x5C, 0x70, 0xCE, 0x80, 0xFB,
+    0xF8, 0x2C, 0x22, 0x65, 0x6E, 0xFC, 0xEB, 0x05, 0x30, 0x1C, 0xD9, 0x7D, 0x9B, 0xA1, 0x53, 0xA2,
+    0xD3, 0xB2, 0xAF, 0x7E, 0xF1, 0xEB, 0x7E, 0xF1, 0xC5, 0x2F, 0x5D, 0xEA, 0x62, 0x17, 0x6D, 0xFC,
+    0x3F, 0xB5, 0xA9, 0x8B, 0x5D, 0x1C, 0x3E, 0xA5, 0xCB, 0xEB, 0x41, 0x72, 0xBF, 0xB9, 0xD5, 0x6D,
+    0x5C, 0x72, 0xC1, 0x05, 0x3D, 0x03, 0x03, 0x87, 0x17, 0x9A, 0xDC, 0xE6, 0x36, 0x73, 0xF7, 0xB7,
+    0xBA, 0x91, 0xBA, 0xD8, 0xC5, 0x4E, 0xBA, 0x36, 0x89, 0xF2, 0x13, 0x5C, 0xF7, 0x85, 0x27, 0x18,
+    0x6E, 0x73, 0x28, 0x49, 0xBF, 0xFA, 0x78, 0xA7, 0xAB, 0xE2, 0xB5, 0xE2, 0xFE, 0x71, 0xC1, 0xC4,
+    0xD3, 0x03, 0x12, 0x7E, 0xC1, 0xCC, 0x80, 0x34, 0xE2, 0x1F, 0x54, 0xDC, 0x38, 0x04, 0x33, 0x9B,
+    0x99, 0x85, 0xE5, 0x90, 0xFF, 0x47, 0xCF, 0x20, 0x85, 0x41, 0xDB, 0x41, 0xC6, 0x46, 0xAF, 0x9F,
+    0x28, 0x35, 0x5A, 0xBA, 0x04, 0x95, 0x1D, 0xB8, 0x68, 0x9F, 0xE8, 0x6A, 0xA5, 0xB2, 0x57, 0x71,
+    0xD1, 0x26, 0x17, 0x2B, 0x3B, 0x76, 0x2E, 0xDA, 0x64, 0x53, 0x65, 0xC7, 0x5D, 0x17, 0x6D, 0xEA,
+    0x63, 0x6D, 0xA5, 0xBC, 0xAF, 0xD2, 0xE2, 0x8E, 0x65, 0xF3, 0xB4, 0x1D, 0x7C, 0x90, 0x60, 0x77,
+    0x58, 0x73, 0x3B, 0xB0, 0xDA, 0xD8, 0x3F, 0x58, 0x6C, 0x72, 0x69, 0xC7, 0x89, 0x4D, 0x26, 0xED,
+    0xD8, 0xD9, 0xE4, 0xDE, 0xD2, 0x74, 0xCD, 0x0A, 0x78, 0x8E, 0x56, 0x8B, 0x91, 0xDE, 0x9C, 0xED,
+    0xF2, 0xEC, 0x71, 0xC5, 0x37, 0x4B, 0xFB, 0xFA, 0x15, 0xD2, 0x78, 0xF3, 0x5B, 0x33, 0x4D, 0x81,
+    0x8B, 0xEF, 0xE1, 0x3D, 0xC3, 0xD7, 0xA5, 0x30, 0x29, 0x1C, 0xD9, 0x62, 0x13, 0x5A, 0x95, 0x56,
+    0xA5, 0xD3, 0xE8, 0x55, 0xDA, 0x62, 0x8A, 0xCD, 0x36, 0xF5, 0xA1, 0x9B, 0xFB, 0x50, 0x71, 0x71,
+    0x67, 0x32, 0xBE, 0x79, 0x78, 0x36, 0x72, 0x61, 0xB5, 0xD1, 0x96, 0xFE, 0xF5, 0x85, 0x2E, 0xEE,
+    0x4C, 0x66, 0x68, 0x8A, 0x8B, 0x54, 0x9B, 0x86, 0x60, 0x53, 0x1F, 0xF6, 0xC1, 0xB7, 0x4A, 0xD3,
+    0xCF, 0xB3, 0x57, 0xD8, 0x0B, 0x0E, 0x7B, 0x0D, 0x5F, 0xD4, 0xCA, 0xA4, 0xA5, 0x2D, 0x36, 0x9A,
+    0xD9, 0x46, 0x93, 0x8E, 0xD7, 0xC5, 0x46, 0xA4, 0xC8, 0xA0, 0x88, 0xB7, 0x91, 0x9D, 0x8D, 0x54,
+    0x1B, 0xDB, 0x6C, 0x63, 0x37, 0x9F, 0xAD, 0xC3, 0xA8, 0xED, 0x26, 0xD0, 0x84, 0xE7, 0xCC, 0x32,
+    0xC4, 0xAD, 0xCB, 0x3D, 0xE5, 0x1A, 0x3B, 0x6F, 0x63, 0x35, 0x5B, 0x6D, 0x76, 0x76, 0xEF, 0xE5,
+    0xE6, 0x61, 0xC1, 0x5F, 0xE2, 0x1E, 0x48, 0x92, 0x3E, 0xC9, 0x70, 0x01, 0x43, 0xC0, 0x66, 0xD0,
+    0xF8, 0x47, 0x4E, 0x0A, 0x93, 0xC6, 0xE6, 0x45, 0xFE, 0x1B, 0xC5, 0x9C, 0x3D, 0x90, 0x1C, 0xC7,
+    0x95, 0xE7, 0x7F, 0x59, 0x09, 0xA0, 0x24, 0xD6, 0x8A, 0x09, 0x03, 0xD4, 0x07, 0x21, 0xB1, 0x64,
+    0xC8, 0xE0, 0x29, 0x48, 0x96, 0x0C, 0x19, 0x8C, 0xB8, 0xEE, 0xC9, 0x94, 0x70, 0x11, 0x32, 0x64,
+    0x70, 0x2E, 0x0E, 0xB3, 0xBA, 0x58, 0x1A, 0x94, 0xB1, 0xCE, 0x4A, 0x11, 0x0B, 0x1A, 0x34, 0x60,
+    0xCC, 0x4C, 0x15, 0xC5, 0xD8, 0x90, 0xB1, 0x11, 0x47, 0x38, 0x5A, 0xE3, 0xD6, 0x10, 0x2F, 0x42,
+    0x11, 0xB7, 0x3B, 0xBA, 0x5B, 0xD2, 0xA0, 0x81, 0xBB, 0xE8, 0x99, 0x4A, 0x12, 0x86, 0x0C, 0x1A,
+    0x2A, 0x89, 0xB7, 0x27, 0x83, 0x86, 0x8A, 0x4B, 0x32, 0x78, 0x2B, 0xC6, 0x1D, 0x92, 0x64, 0x41,
+    0x2C, 0x00, 0x59, 0xF5, 0xCE, 0xA8, 0xEA, 0xC1, 0x00, 0x24, 0x25, 0x90, 0xE2, 0x47, 0x47, 0xD7,
+    0x57, 0x76, 0x77, 0x75, 0xE6, 0xAB, 0x97, 0x99, 0xFF, 0xF7, 0xDE, 0xFF, 0xE5, 0x31, 0xF3, 0x9B,
+    0x2E, 0x1E, 0x03, 0x16, 0x46, 0xFB, 0xB0, 0x34, 0x67, 0x9A, 0x6E, 0x99, 0xFF, 0xF8, 0xE5, 0xFE,
+    0xA0, 0x78, 0xF2, 0xC5, 0x06, 0x00, 0x5D, 0xC1, 0x3D, 0xC0, 0x79, 0x50, 0x0D, 0xA4, 0x0E, 0xCA,
+    0x0B, 0x14, 0xD2, 0xE9, 0x6B, 0x2F, 0x85, 0x22, 0xCD, 0x7C, 0xF7, 0xE5, 0x7B, 0x32, 0xFF, 0x0C,
+    0x36, 0xF1, 0xC4, 0x0C, 0x1D, 0xEE, 0xC3, 0xCC, 0x97, 0xFB, 0x06, 0x15, 0x17, 0xE8, 0xF1, 0xCD,
+    0x6D, 0x2D, 0x12, 0x12, 0x19, 0x60, 0x01, 0xB4, 0xD3, 0x5D, 0xEF, 0x04, 0x1E, 0x9C, 0x2E, 0x15,
+    0xF3, 0xAB, 0x6E, 0xD1, 0x12, 0xC9, 0x9A, 0x03, 0x72, 0x67, 0x29, 0xB8, 0x9F, 0x0D, 0x8E, 0xB1,
+    0x01, 0xEC, 0x4C, 0xDB, 0xDD, 0xE3, 0xCF, 0x7D, 0x21, 0x52, 0x11, 0x81, 0x7E, 0xDA, 0x54, 0x07,
+    0x49, 0x00, 0xDD, 0x42, 0xDA, 0xF2, 0x1F, 0x4B, 0x91, 0x68, 0x6B, 0x89, 0x5F, 0xE4, 0xF8, 0xE6,
+    0x49, 0x38, 0x76, 0x5E, 0xB9, 0xFB, 0x1F, 0x28, 0x86, 0x8B, 0xD9, 0x58, 0xB7, 0xBA, 0xCD, 0xBC,
+    0xF6, 0xBA, 0x49, 0xBD, 0x6E, 0xD3, 0xE9, 0xD8, 0xE8, 0x26, 0xF5, 0xFA, 0xEA, 0xB9, 0x26, 0xAF,
+    0xC7, 0x6E, 0xFB, 0xC4, 0x85, 0xE5, 0x57, 0xE1, 0x33, 0xE5, 0x48, 0xD1, 0x97, 0x03, 0xB6, 0xCF,
+    0x02, 0x69, 0xA3, 0x3B, 0x4C, 0xA5, 0x22, 0x39, 0xEC, 0xB3, 0x01, 0x96, 0x6D, 0x28, 0xAA, 0x0E,
+    0x1E, 0x79, 0xEE, 0x8A, 0x53, 0xF2, 0x8A, 0x38, 0xBE, 0x77, 0xFD, 0x27, 0x80, 0x00, 0x22, 0x02,
+    0xB5, 0x8C, 0x73, 0xB5, 0x6F, 0xD9, 0x65, 0xD2, 0x41, 0x21, 0x1D, 0x2C, 0x0E, 0x5F, 0x00, 0xDC,
+    0x7B, 0x78, 0x79, 0x8A, 0xA2, 0xA5, 0x16, 0x56, 0x59, 0xB3, 0x4D, 0xB0, 0x9C, 0xCA, 0x1B, 0xB2,
+    0x81, 0xE4, 0xB7, 0x1D, 0xA1, 0xAE, 0xEE, 0x4F, 0x63, 0xEA, 0x73, 0x1F, 0xE9, 0x4D, 0x6B, 0x90,
+    0x6F, 0x37, 0x59, 0xFF, 0x18, 0xC5, 0x7F, 0x47, 0xC9, 0xB7, 0xC8, 0x2F, 0x79, 0xFD, 0x72, 0x97,
+    0x84, 0xF2, 0xEF, 0x42, 0x26, 0x2D, 0x77, 0x3B, 0x3E, 0xCB, 0xE6, 0x60, 0x5E, 0xE9, 0xEC, 0xDF,
+    0x56, 0xDB, 0x70, 0x97, 0x03, 0x4A, 0x69, 0xC1, 0x5E, 0x78, 0xB8, 0xC5, 0x54, 0x64, 0x95, 0x6E,
+    0xE0, 0x01, 0x9E, 0x55, 0x07, 0xEE, 0x59, 0x83, 0xF4, 0xFA, 0xF9, 0x66, 0xA9, 0xAB, 0xFB, 0x16,
+    0x69, 0xF5, 0x4D, 0xF5, 0x8A, 0x7F, 0x16, 0xEE, 0x7C, 0xD0, 0x00, 0x6F, 0x57, 0x01, 0xCC, 0xC2,
+    0x38, 0x78, 0xC5, 0xAF, 0xE0, 0x9E, 0xFB, 0xF5, 0xAB, 0x5F, 0x4C, 0x7C, 0x9B, 0x8B, 0x5F, 0x64,
+    0xEE, 0xEE, 0x0B, 0x99, 0x5B, 0x42, 0xD2, 0xD2, 0xC1, 0x0A, 0x7D, 0x55, 0x1D, 0x40, 0x2A, 0x23,
+    0xA0, 0xB6, 0x80, 0x4D, 0x8A, 0x3E, 0x09, 0x21, 0x3B, 0xD3, 0x60, 0x5C, 0x31, 0x24, 0x5D, 0x67,
+    0x74, 0xB3, 0x91, 0x37, 0xE5, 0x6F, 0xFD, 0xA9, 0x63, 0x40, 0x21, 0xAD, 0x08, 0x80, 0x15, 0xF9,
+    0xA5, 0x48, 0x80, 0x05, 0x18, 0xD0, 0x1E, 0x02, 0xF0, 0x83, 0xBD, 0x52, 0xDE, 0x90, 0x0E, 0xB5,
+    0x09, 0xB9, 0x34, 0x3C, 0xC0, 0x03, 0xDC, 0x8F, 0x6A, 0x3E, 0x67, 0xBB, 0xFB, 0x32, 0xFD, 0xA4,
+    0x7E, 0xA2, 0xFA, 0x17, 0xFF, 0x4C, 0xB3, 0x6C, 0xEF, 0xFB, 0xA6, 0x09, 0xD9, 0x9D, 0xFA, 0x3F,
+    0x25, 0x97, 0xFC, 0xCB, 0x6D, 0xFB, 0xE8, 0xF8, 0x95, 0xC7, 0x0C, 0x3C, 0x48, 0xC7, 0x36, 0xD9,
+    0xEF, 0x7A, 0xB8, 0xFB, 0x02, 0x3F, 0xD8, 0x7B, 0x52, 0x86, 0xBD, 0xBD, 0x0A, 0xC8, 0x06, 0x64,
+    0xC8, 0xAA, 0xD5, 0x82, 0x2E, 0xE8, 0x17, 0x1B, 0x93, 0xF9, 0x95, 0x11, 0x9F, 0xF5, 0xC0, 0x2D,
+    0x15, 0x58, 0xF0, 0xF5, 0xA7, 0xF7, 0x9E, 0x14, 0x09, 0x5B, 0x57, 0xCE, 0xDE, 0xFC, 0xC9, 0xA9,
+    0x59, 0x75, 0xB5, 0x48, 0x14, 0x11, 0xD4, 0x01, 0x56, 0xBE, 0xDD, 0x95, 0xC6, 0xAD, 0xBE, 0x9C,
+    0x04, 0x8C, 0x23, 0x62, 0x3C, 0x11, 0x53, 0xD1, 0x63, 0x64, 0xB4, 0xD2, 0x01, 0x59, 0x97, 0xCB,
+    0x2F, 0x1F, 0xBF, 0x52, 0x2D, 0x29, 0x28, 0x91, 0xE6, 0xEB, 0x03, 0xA6, 0xD2, 0xAD, 0xBA, 0xF2,
+    0x70, 0x2F, 0xDD, 0x1D, 0x17, 0x50, 0x2C, 0xCD, 0xAF, 0x7B, 0x9B, 0x55, 0x27, 0xA7, 0xBB, 0xB7,
+    0xEC, 0x70, 0x40, 0xD6, 0x64, 0x0D, 0x2B, 0xF6, 0xC9, 0xFC, 0xAD, 0x27, 0xC6, 0x67, 0x0D, 0x71,
+    0x3A, 0x69, 0xD5, 0x40, 0x4D, 0xD1, 0x66, 0x31, 0xBB, 0xEC, 0x6A, 0xE9, 0xE5, 0xA5, 0x9F, 0x8E,
+    0x59, 0x5C, 0xDD, 0xC5, 0xA9, 0xCC, 0x03, 0x2B, 0x20, 0xF3, 0xC0, 0x00, 0x18, 0x0F, 0xFC, 0x6C,
+    0xDD, 0x01, 0x55, 0x2D, 0xAD, 0x95, 0x51, 0xCB, 0xDB, 0xBE, 0x90, 0x27, 0x91, 0x71, 0x91, 0x4A,
+    0x1F, 0x72, 0x79, 0xC5, 0x97, 0xD3, 0xA5, 0x96, 0x3E, 0x68, 0x79, 0xC5, 0xA7, 0xF2, 0x24, 0xC9,
+    0xFF, 0x5B, 0xC0, 0x83, 0x01, 0x5E, 0xF1, 0xE8, 0x27, 0xE1, 0xCE, 0xF7, 0xB8, 0x6C, 0xA6, 0xFE,
+    0xEE, 0x00, 0xC8, 0xCF, 0x44, 0xFB, 0x5C, 0xF7, 0xA5, 0x2C, 0x9E, 0xF6, 0xDB, 0xE6, 0xC7, 0xED,
+    0xD7, 0xE0, 0xFB, 0x27, 0x62, 0x2A, 0x64, 0x5E, 0x05, 0xB6, 0xC9, 0x49, 0xD7, 0x27, 0xA7, 0x5F,
+    0xB5, 0xE2, 0x80, 0x53, 0xE4, 0x23, 0x57, 0x0F, 0x4C, 0xB5, 0xBD, 0x7E, 0x46, 0x0F, 0x55, 0xDB,
+    0xC5, 0x8F, 0xDB, 0x62, 0xE4, 0x84, 0x03, 0x8C, 0xB4, 0xA5, 0x70, 0xE4, 0xA5, 0x1D, 0xEA, 0x19,
+    0x48, 0x3D, 0x45, 0x00, 0xE3, 0x28, 0x03, 0x3C, 0x00, 0x6A, 0x52, 0x29, 0x15, 0xE0, 0xE2, 0x74,
+    0x08, 0xA0, 0x02, 0x49, 0x03, 0x2A, 0xA0, 0x7D, 0xD2, 0xAA, 0x40, 0x46, 0xD6, 0xAA, 0xC0, 0x3D,
+    0xE4, 0xAD, 0x0A, 0x2C, 0xB0, 0xED, 0xE9, 0x91, 0xF3, 0x5C, 0x6B, 0xAD, 0xB8, 0x90, 0xBC, 0xD5,
+    0x42, 0xD2, 0xA4, 0xCF, 0xB7, 0xA0, 0xBD, 0xF9, 0x76, 0x0B, 0xC6, 0xD9, 0x9F, 0x5F, 0x85, 0x9C,
+    0x42, 0x04, 0x16, 0x1C, 0xFF, 0xDE, 0x6B, 0x70, 0x11, 0x92, 0x16, 0x02, 0x24, 0x2D, 0x49, 0x0B,
+    0x6A, 0x13, 0x2A, 0x6E, 0x7E, 0x9D, 0x00, 0xF5, 0x0C, 0x18, 0x47, 0x31, 0x55, 0xB0, 0xFC, 0x63,
+    0x15, 0x04, 0x15, 0xC8, 0x5C, 0xD9, 0xA8, 0xC0, 0x3D, 0x5A, 0x7A, 0x15, 0x58, 0x64, 0x3E, 0xAA,
+    0xC0, 0xF9, 0xAC, 0xDA, 0x3E, 0x3D, 0x12, 0x12, 0xB7, 0xB2, 0xF2, 0xED, 0x06, 0x7A, 0xD0, 0x1E,
+    0x1D, 0x20, 0x73, 0x64, 0x1E, 0x72, 0xB0, 0xC0, 0x12, 0x22, 0x70, 0x1E, 0x1D, 0x80, 0x80, 0x11,
+    0x21, 0x69, 0x49, 0x65, 0x40, 0xFB, 0xE9, 0xF9, 0xBB, 0x5B, 0xEA, 0x49, 0x83, 0x92, 0x0A, 0xB6,
+    0x49, 0x24, 0xC2, 0x12, 0x3A, 0xE3, 0x78, 0x00, 0x8E, 0x69, 0x8F, 0x01, 0x74, 0x20, 0xAB, 0xE0,
+    0x74, 0x8B, 0xF6, 0x60, 0x46, 0x92, 0x06, 0x92, 0x87, 0x1B, 0x02, 0xDB, 0xD0, 0xF3, 0x0C, 0x25,
+    0x6C, 0x70, 0x1E, 0xEB, 0x29, 0x58, 0x60, 0xC3, 0xDD, 0xE2, 0xEE, 0xA1, 0xD8, 0x36, 0xE2, 0x0C,
+    0x79, 0xCE, 0x59, 0x32, 0x67, 0xBE, 0xE3, 0x41, 0x7B, 0xF3, 0x78, 0x00, 0xDD, 0xA4, 0xBF, 0x3B,
+    0xA8, 0x50, 0x41, 0x89, 0x04, 0x08, 0xDC, 0xF5, 0xF0, 0xFF, 0x3A, 0x94, 0xC9, 0x02, 0xD8, 0x86,
+    0x07, 0x80, 0xE3, 0x90, 0x4C, 0x55, 0x3C, 0x0E, 0x07, 0xE8, 0x88, 0x69, 0x39, 0xBE, 0xD6, 0xE3,
+    0x16, 0xED, 0x29, 0xC8, 0x62, 0x22, 0xA1, 0x18, 0x19, 0x48, 0x3D, 0x39, 0x2C, 0x20, 0xA2, 0x62,
+    0x92, 0xC8, 0x90, 0x48, 0xA7, 0xEA, 0x23, 0x8F, 0xA5, 0x3C, 0x53, 0x81, 0x19, 0x57, 0xC0, 0xEF,
+    0xC5, 0xC3, 0x9D, 0x69, 0xB8, 0x45, 0x14, 0x27, 0x01, 0xF2, 0x0A, 0xD0, 0x11, 0xA0, 0x6C, 0x80,
+    0x6C, 0x04, 0x78, 0x3B, 0x00, 0x45, 0xE1, 0x40, 0x37, 0x11, 0xD8, 0x36, 0x1E, 0x4C, 0x75, 0x00,
+    0x04, 0x1D, 0xA0, 0xC0, 0x3A, 0xF4, 0x95, 0x3F, 0xEF, 0xA1, 0x14, 0xF1, 0x98, 0xDF, 0xED, 0x0D,
+    0xA8, 0x8E, 0x34, 0x50, 0x80, 0x45, 0xB7, 0xE8, 0x9E, 0x15, 0xE4, 0xFE, 0xDC, 0x55, 0x72, 0xF9,
+    0xA5, 0x34, 0x5A, 0x22, 0x7C, 0x09, 0xC0, 0x44, 0x40, 0xFF, 0xEF, 0x16, 0x58, 0x18, 0x40, 0xFB,
+    0x00, 0x6C, 0xFC, 0x35, 0xA0, 0xC4, 0x33, 0x29, 0xD8, 0x3C, 0x8B, 0xAA, 0x1E, 0xC0, 0x7A, 0x20,
+    0x1D, 0xE6, 0x29, 0x15, 0x8C, 0x05, 0x92, 0xB7, 0x3A, 0x60, 0x69, 0x3C, 0xA4, 0x3E, 0x02, 0x7D,
+    0xD6, 0x82, 0xC1, 0x42, 0x12, 0x74, 0x07, 0x76, 0xEB, 0x5C, 0x45, 0x2A, 0x12, 0x61, 0xDC, 0x7B,
+    0xBA, 0x21, 0x77, 0x94, 0x24, 0x01, 0x1D, 0xD8, 0x00, 0x5B, 0x65, 0x1E, 0x15, 0x4F, 0xC8, 0x05,
+    0x25, 0x51, 0x06, 0xAC, 0xF8, 0x43, 0xC9, 0x14, 0x22, 0xE2, 0xA7, 0x03, 0xB0, 0xD1, 0xB3, 0x0D,
+    0xC9, 0xEB, 0x2D, 0x01, 0x4C, 0x5E, 0x25, 0x1E, 0x2E, 0xEE, 0x02, 0xA4, 0xCF, 0xF5, 0x00, 0x1B,
+    0x69, 0x0B, 0xA8, 0x90, 0xFF, 0xCD, 0x59, 0x30, 0xAE, 0x94, 0x0E, 0x56, 0x4A, 0xC4, 0xA3, 0x5F,
+    0x7B, 0xB8, 0x9D, 0x66, 0x81, 0x0A, 0xD4, 0xB5, 0xBD, 0x11, 0x30, 0x95, 0xEA, 0xF9, 0x2C, 0x2B,
+    0xD2, 0x96, 0x85, 0x6E, 0xC9, 0xAB, 0x24, 0x14, 0x70, 0xA0, 0x1E, 0xF9, 0xB1, 0x54, 0xB9, 0xC8,
+    0x68, 0xC5, 0x89, 0x48, 0xE0, 0xF8, 0x16, 0x64, 0x22, 0x23, 0x4A, 0xDE, 0x90, 0x1E, 0x1D, 0x94,
+    0x78, 0x22, 0x69, 0x8F, 0x85, 0x12, 0xE3, 0x31, 0xAD, 0x0E, 0xA8, 0x48, 0x04, 0x8B, 0x05, 0xF3,
+    0xA2, 0x48, 0xAB, 0x3B, 0x91, 0x9E, 0xE1, 0x46, 0xA1, 0x37, 0x9E, 0xB4, 0xD5, 0x01, 0xDD, 0x11,
+    0x49, 0x7A, 0x2C, 0x49, 0xC4, 0xF8, 0xD3, 0x91, 0x42, 0xA4, 0xC7, 0x8A, 0x5C, 0xB8, 0x49, 0x31,
+    0x92, 0xE1, 0x4E, 0x40, 0x5E, 0xF2, 0xB0, 0x53, 0xB7, 0xF0, 0xB9, 0xEC, 0x66, 0xD5, 0x51, 0x7F,
+    0x05, 0xE4, 0x32, 0x40, 0x31, 0x4A, 0xC0, 0x36, 0x89, 0x50, 0x78, 0xF2, 0x36, 0xF7, 0x24, 0x31,
+    0x6B, 0xC1, 0x3E, 0x11, 0x20, 0x7B, 0x33, 0x82, 0x8A, 0x25, 0x60, 0x8B, 0x0A, 0xCC, 0x0B, 0x2D,
+    0xE8, 0xB7, 0x22, 0x10, 0x4B, 0xA0, 0xCC, 0x3D, 0x14, 0x4F, 0xF4, 0x60, 0x9A, 0x1A, 0xB2, 0x60,
+    0x02, 0x69, 0x50, 0xE2, 0xB2, 0x8E, 0x5C, 0xA4, 0x83, 0x5A, 0xDA, 0x79, 0xC2, 0x05, 0x16, 0x2C,
+    0x2C, 0x2B, 0xF3, 0x7C, 0xD0, 0x6F, 0x78, 0x04, 0x0E, 0x48, 0xA4, 0xCA, 0x2E, 0xB5, 0x05, 0xFD,
+    0x36, 0xCB, 0x93, 0x1C, 0x83, 0xCF, 0x5F, 0xC0, 0x51, 0x4A, 0x77, 0x0F, 0xC5, 0x28, 0xD7, 0xBD,
+    0xE9, 0xA8, 0x43, 0x12, 0x51, 0x23, 0x25, 0x14, 0x21, 0x6B, 0xC9, 0xA4, 0x8A, 0x24, 0x6F, 0xC5,
+    0xDC, 0xB3, 0xCA, 0x9F, 0x8B, 0x14, 0x2A, 0x16, 0x55, 0xE6, 0xCD, 0xF3, 0x7D, 0x12, 0x88, 0x85,
+    0x5F, 0x61, 0x9E, 0x8B, 0x05, 0x2A, 0xE6, 0x2F, 0x79, 0x8A, 0x4A, 0x02, 0xBA, 0xCB, 0x22, 0xD4,
+    0x58, 0x4F, 0xEE, 0x33, 0x71, 0x59, 0x97, 0xBC, 0x23, 0x32, 0xB0, 0xC8, 0x64, 0x04, 0x8E, 0x9F,
+    0x05, 0xC0, 0x31, 0x8D, 0x92, 0xE4, 0x01, 0xA8, 0x1B, 0x48, 0x86, 0x77, 0x8D, 0x3F, 0xB5, 0xF8,
+    0x7A, 0x2C, 0x47, 0xCE, 0xF5, 0xBA, 0x23, 0xF3, 0x49, 0xC4, 0x54, 0x0C, 0x14, 0x50, 0xB2, 0x84,
+    0xC2, 0xAD, 0xC0, 0x3C, 0x17, 0x20, 0x7B, 0xA5, 0x05, 0xFD, 0x8E, 0x07, 0x25, 0x6E, 0x06, 0x61,
+    0xEC, 0xFE, 0xA1, 0x5D, 0x26, 0x3D, 0x14, 0x12, 0xE7, 0xFF, 0x71, 0x9C, 0xBB, 0x0A, 0x3A, 0x80,
+    0x7E, 0x13, 0xB4, 0x48, 0xA5, 0xAF, 0xD5, 0x41, 0x07, 0x1D, 0x75, 0x60, 0xD0, 0x81, 0xDD, 0x23,
+    0xDB, 0xBE, 0x0E, 0x2A, 0xEA, 0x90, 0x05, 0x2D, 0xE2, 0xB5, 0x5C, 0x9D, 0x7E, 0x17, 0xA0, 0x18,
+    0x41, 0xC4, 0x01, 0x3F, 0x70, 0x50, 0x8A, 0x23, 0x7F, 0x63, 0x20, 0x6D, 0xD3, 0x40, 0xC4, 0x62,
+    0x2A, 0x1D, 0x54, 0xC7, 0x06, 0x05, 0x99, 0x4F, 0x82, 0x0E, 0x14, 0x5C, 0x24, 0x09, 0x06, 0x0A,
+    0xD5, 0x91, 0x84, 0xDC, 0x53, 0x20, 0x2E, 0x09, 0x7A, 0xA4, 0xC0, 0xF4, 0x49, 0xA0, 0x68, 0x0A,
+    0x38, 0x48, 0x02, 0xBA, 0x2D, 0xEE, 0x64, 0x23, 0x09, 0x21, 0x7D, 0x4E, 0xCC, 0xEF, 0x7A, 0x1B,
+    0xCA, 0x01, 0x98, 0x84, 0x99, 0x37, 0x2D, 0xF2, 0x1B, 0xAF, 0x7F, 0x21, 0xDC, 0x71, 0x64, 0xD4,
+    0x52, 0x0E, 0x25, 0x1D, 0xF6, 0x72, 0xD0, 0x5D, 0xD6, 0x1A, 0x6F, 0xAA, 0xAF, 0x60, 0x81, 0x08,
+    0x5F, 0x08, 0xD4, 0xE2, 0xF3, 0xB1, 0x66, 0x20, 0x66, 0x8D, 0x0E, 0x85, 0x33, 0xBE, 0x44, 0x9C,
+    0x48, 0x1D, 0x24, 0x08, 0x67, 0x71, 0xFC, 0xB5, 0x23, 0x15, 0xC7, 0x22, 0x87, 0xB0, 0x40, 0xFB,
+    0x80, 0xF9, 0xFB, 0x0A, 0xD3, 0xC3, 0xF1, 0x69, 0xD4, 0x4D, 0xA5, 0x41, 0x6A, 0x6F, 0x9A, 0xA2,
+    0xB2, 0x6C, 0xF0, 0x18, 0x71, 0x92, 0xC3, 0x23, 0x3E, 0x11, 0xA1, 0xBC, 0x16, 0x75, 0x37, 0xDD,
+    0x79, 0x1F, 0xAB, 0xA2, 0x1E, 0xB4, 0x8C, 0x72, 0x49, 0x2E, 0x45, 0xB5, 0xA9, 0xE0, 0x38, 0xCA,
+    0x91, 0x8F, 0x5A, 0x1A, 0x73, 0xFD, 0xAA, 0xC8, 0x99, 0x2E, 0x1B, 0x54, 0xB4, 0xD8, 0xCA, 0x3C,
+    0xD7, 0xE8, 0xC0, 0x3E, 0x58, 0xF5, 0x48, 0xC3, 0x0F, 0x45, 0x86, 0x44, 0xE4, 0xDA, 0x4F, 0xD4,
+    0xF8, 0x1F, 0xC2, 0xDC, 0x43, 0xB3, 0x26, 0xE9, 0x60, 0x9F, 0xC2, 0x93, 0x86, 0x4C, 0xDC, 0x17,
+    0xAD, 0xBC, 0x23, 0xE2, 0xA5, 0x33, 0x12, 0xD4, 0x26, 0xC7, 0x37, 0xA7, 0x5E, 0xE9, 0x17, 0x98,
+    0xDF, 0x34, 0x64, 0x11, 0xF2, 0x96, 0xE4, 0x9D, 0x96, 0x7B, 0xD2, 0x66, 0x82, 0x3E, 0xC6, 0x27,
+    0xF2, 0xA4, 0xB3, 0x22, 0xBA, 0x4B, 0x63, 0x81, 0xEE, 0x7A, 0xB2, 0xD7, 0x1B, 0xCC, 0x65, 0xB0,
+    0x11, 0xA4, 0x43, 0x5F, 0x6F, 0x30, 0x4F, 0x7B, 0x76, 0xAC, 0xD3, 0xA1, 0x76, 0x85, 0x93, 0xCB,
+    0x3D, 0xB5, 0xB8, 0x09, 0x42, 0x83, 0x1A, 0x33, 0xB4, 0xFC, 0x14, 0xFD, 0x1B, 0x41, 0xF9, 0x81,
+    0xA3, 0x52, 0xA7, 0x1E, 0xD1, 0x22, 0xDE, 0x34, 0x79, 0xB0, 0xE8, 0x6E, 0x83, 0xA4, 0xDF, 0x87,
+    0xB8, 0x82, 0x18, 0x21, 0x0E, 0x10, 0xF7, 0x21, 0xD6, 0xA8, 0xDE, 0x3A, 0x1D, 0x8A, 0x26, 0x6B,
+    0xCD, 0x58, 0x57, 0x89, 0x0C, 0x13, 0x44, 0x3F, 0x06, 0x79, 0x45, 0x16, 0x50, 0xDD, 0x7C, 0x57,
+    0x23, 0xF2, 0xB6, 0xCC, 0xEA, 0x0A, 0x49, 0x45, 0x12, 0xE1, 0x00, 0xEE, 0x00, 0xD8, 0x84, 0x4C,
+    0x5E, 0xF6, 0x46, 0x24, 0x18, 0x9F, 0x07, 0xE3, 0x93, 0x41, 0xB7, 0x89, 0xFC, 0xA8, 0x4B, 0xDE,
+    0x0E, 0xAB, 0x24, 0x44, 0x9B, 0x04, 0x6B, 0x9E, 0x0F, 0xE6, 0xF9, 0xDF, 0x07, 0x1D, 0xEA, 0x40,
+    0x6F, 0x02, 0x2B, 0x1D, 0x39, 0x48, 0xE4, 0xDA, 0xC8, 0x5B, 0x32, 0x30, 0xCB, 0xEC, 0x18, 0xD3,
+    0x34, 0x8B, 0x05, 0xB2, 0x76, 0x9E, 0x4E, 0x96, 0xB7, 0x74, 0xCC, 0x54, 0x5A, 0x1B, 0xCB, 0x21,
+    0x91, 0x6A, 0x40, 0xB7, 0x69, 0xCB, 0x0A, 0x8B, 0xA9, 0x92, 0x4E, 0x05, 0x8C, 0x2F, 0x60, 0xA5,
+    0x1B, 0x74, 0xBB, 0x02, 0x6B, 0x1C, 0xEA, 0x4A, 0x00, 0xF3, 0x4F, 0x40, 0xED, 0x41, 0xF7, 0x40,
+    0x31, 0xE1, 0x86, 0xC9, 0x1C, 0xCA, 0x3D, 0x64, 0x01, 0xEA, 0x01, 0x32, 0x71, 0xF0, 0x40, 0xB5,
+    0x6E, 0x53, 0x84, 0x54, 0x66, 0x8C, 0x9A, 0x84, 0x19, 0xB9, 0x16, 0x40, 0xE6, 0x4F, 0x91, 0xBC,
+    0x29, 0x81, 0x03, 0x11, 0x8A, 0xAE, 0x08, 0x59, 0xAB, 0x86, 0x24, 0x50, 0x54, 0x2B, 0xD2, 0xB6,
+    0x40, 0xC5, 0xCC, 0x63, 0x93, 0x40, 0x5E, 0xAD, 0x48, 0x9B, 0x82, 0x24, 0x64, 0x5E, 0xF5, 0x49,
+    0xA7, 0x22, 0xB5, 0x44, 0x0A, 0xE9, 0xC9, 0x6E, 0xBD, 0xA9, 0x79, 0x15, 0xAC, 0x78, 0xEE, 0xD8,
+    0x7B, 0x0A, 0xF8, 0xFE, 0x09, 0x47, 0xEE, 0x23, 0x49, 0xCC, 0x3D, 0xC6, 0x5D, 0xBC, 0x19, 0x0A,
+    0x7C, 0x22, 0x22, 0xC8, 0x24, 0x02, 0x22, 0x1E, 0xEE, 0xD8, 0xFB, 0xD9, 0xA7, 0x0D, 0x46, 0xEE,
+    0xD8, 0xFB, 0x07, 0xAC, 0x04, 0xF6, 0xF6, 0x6E, 0xA8, 0xC2, 0x29, 0xC8, 0xC5, 0xE9, 0x51, 0xB0,
+    0xEE, 0x80, 0x48, 0xAF, 0x1A, 0x1D, 0xC0, 0x78, 0x54, 0x49, 0x26, 0x51, 0xC9, 0x1B, 0xC1, 0x34,
+    0xC6, 0xEF, 0x63, 0x93, 0x8E, 0x98, 0x06, 0xD3, 0x19, 0xB9, 0x2E, 0x46, 0x4C, 0x38, 0xEE, 0x8E,
+    0xAD, 0xEF, 0xD2, 0xE2, 0x21, 0xAF, 0xB6, 0x99, 0x47, 0xCF, 0x44, 0x9A, 0x43, 0x50, 0xF3, 0xA9,
+    0x21, 0x2F, 0x58, 0xF0, 0x28, 0x7D, 0xEA, 0x13, 0x19, 0xA6, 0x1A, 0x9D, 0xFD, 0x68, 0x46, 0xD5,
+    0x4F, 0x07, 0xA7, 0xE5, 0x6E, 0x6D, 0xF4, 0xD1, 0xB3, 0x36, 0xFB, 0x90, 0x00, 0x24, 0x23, 0x87,
+    0x38, 0xFA, 0xC3, 0x8F, 0xE8, 0x59, 0x05, 0x17, 0x41, 0x37, 0xD3, 0xBD, 0x6D, 0x0F, 0x45, 0x33,
+    0xDF, 0xD8, 0x4D, 0xBD, 0x4C, 0x09, 0x24, 0xE2, 0xA6, 0x99, 0x7E, 0xFD, 0x74, 0xD5, 0x16, 0x64,
+    0x32, 0x50, 0x88, 0xB8, 0xA2, 0x49, 0x9B, 0xBC, 0xA2, 0x33, 0x9E, 0x65, 0xD6, 0x90, 0xE9, 0x30,
+    0xC9, 0x95, 0x5D, 0xA0, 0xA8, 0xA6, 0x21, 0x29, 0xE9, 0x81, 0x7A, 0xEE, 0x35, 0xBA, 0x9B, 0x67,
+    0xFB, 0xBC, 0x83, 0x44, 0x5E, 0xFB, 0x8B, 0x26, 0x17, 0x09, 0x13, 0x0E, 0xDA, 0x9A, 0x35, 0xA7,
+    0x80, 0xDC, 0x63, 0x1A, 0xB2, 0x06, 0xDD, 0xAC, 0x4D, 0x31, 0xE5, 0x28, 0x46, 0xAC, 0x04, 0xCB,
+    0x50, 0x90, 0x3F, 0x54, 0xE9, 0x1F, 0x37, 0x24, 0x81, 0x09, 0x06, 0x92, 0x35, 0x24, 0x11, 0xCA,
+    0x0A, 0x73, 0x95, 0x4D, 0x91, 0x3E, 0x93, 0x7E, 0x1A, 0x24, 0x4F, 0xCD, 0x75, 0x29, 0x22, 0xE4,
+    0x8F, 0x78, 0xF2, 0x6F, 0x75, 0x64, 0xEE, 0x73, 0x9F, 0x48, 0x6B, 0x40, 0x07, 0xF4, 0x88, 0xBA,
+    0xDE, 0xD0, 0xAD, 0xE8, 0x4D, 0xF5, 0x20, 0xCD, 0x9F, 0xD4, 0x1A, 0x80, 0xC2, 0x81, 0x69, 0xE7,
+    0x81, 0x69, 0x75, 0x14, 0xB7, 0x7E, 0xAC, 0xAD, 0xC9, 0x1C, 0x59, 0x20, 0x99, 0xAC, 0xCA, 0xC3,
+    0x01, 0x25, 0x91, 0x56, 0x8B, 0xE8, 0x60, 0x7E, 0x1D, 0x54, 0xD7, 0xF3, 0xE0, 0x0E, 0x14, 0x60,
+    0x26, 0x73, 0x76, 0x1F, 0x0A, 0x4F, 0xDA, 0x83, 0x5C, 0x38, 0x6E, 0x44, 0xAA, 0x5A, 0x2A, 0xB6,
+    0xE0, 0xAB, 0x7C, 0x8D, 0xDC, 0xED, 0xA2, 0xBB, 0x5D, 0xB0, 0x07, 0xA0, 0x47, 0x26, 0x2B, 0xF1,
+    0x63, 0x6F, 0x86, 0xE2, 0x58, 0xD2, 0x9A, 0x6A, 0x99, 0xF9, 0xEC, 0x37, 0x9E, 0xBA, 0xC1, 0xB4,
+    0xF0, 0xD4, 0x9F, 0xA4, 0x62, 0x15, 0x17, 0x50, 0x21, 0x6D, 0x61, 0xC8, 0xAB, 0xA9, 0x3D, 0x98,
+    0x7E, 0x0D, 0x98, 0x01, 0xB8, 0xEB, 0x2C, 0xD4, 0x22, 0x2D, 0xE5, 0x35, 0x19, 0x27, 0x4B, 0x47,
+    0x07, 0xF2, 0x56, 0x07, 0xD2, 0xA0, 0x03, 0xBA, 0xD7, 0x01, 0x15, 0x75, 0x80, 0xA8, 0x03, 0x0C,
+    0x37, 0xEF, 0x0E, 0x3F, 0x50, 0xBD, 0x0E, 0xE8, 0x4E, 0x07, 0xB2, 0x56, 0x07, 0x0A, 0xAF, 0xC3,
+    0x09, 0x99, 0xAC, 0x1C, 0x91, 0xF1, 0xC6, 0x40, 0xBF, 0x79, 0x12, 0xCA, 0xB0, 0x80, 0x3A, 0x6C,
+    0x83, 0x9E, 0x76, 0x17, 0x41, 0x87, 0x67, 0xA6, 0x9D, 0x3A, 0x13, 0xA0, 0x96, 0x40, 0x2A, 0x12,
+    0x30, 0x4D, 0x1A, 0x28, 0x9C, 0x0E, 0x6C, 0xA0, 0x03, 0x3B, 0xE8, 0xC0, 0x3E, 0x3A, 0x10, 0xD1,
+    0x81, 0xE1, 0xF0, 0xF2, 0x00, 0x1D, 0x28, 0x49, 0x03, 0xB6, 0x29, 0x02, 0x46, 0x44, 0x2A, 0x2D,
+    0x2F, 0x4B, 0xC5, 0x5D, 0x38, 0x3E, 0x25, 0x83, 0x6E, 0x13, 0xF2, 0x08, 0xD9, 0x1A, 0x79, 0xA4,
+    0x01, 0x44, 0x1A, 0xEE, 0xAE, 0x9F, 0x02, 0xE3, 0xB9, 0xFB, 0xBF, 0x06, 0x4A, 0x89, 0xD4, 0xFF,
+    0x59, 0xD8, 0xC5, 0x78, 0x8B, 0x0E, 0x79, 0x45, 0xCC, 0x1A, 0x6C, 0x12, 0x30, 0x3E, 0xA2, 0x43,
+    0xE1, 0x88, 0x59, 0x8B, 0x55, 0x91, 0xDC, 0xDB, 0xA6, 0x08, 0xA9, 0x88, 0xB4, 0x76, 0xCC, 0x7B,
+    0xCE, 0x2A, 0x10, 0xA9, 0x28, 0xA5, 0xE5, 0xEE, 0xBD, 0xA7, 0x6E, 0x9A, 0xD5, 0x33, 0x11, 0xF9,
+    0x95, 0x88, 0x74, 0x3A, 0xB0, 0x24, 0x92, 0x39, 0x8B, 0xF2, 0xC6, 0xCF, 0x60, 0x21, 0x02, 0xF6,
+    0xF8, 0x16, 0x46, 0xC4, 0x6B, 0x91, 0x66, 0x2A, 0x98, 0xEB, 0xA9, 0x03, 0x27, 0x88, 0x68, 0x6F,
+    0x21, 0x18, 0x7F, 0x7C, 0x55, 0x88, 0x88, 0x15, 0x91, 0x2A, 0xD9, 0xFB, 0xC7, 0x44, 0xA4, 0xFA,
+    0xC1, 0x5E, 0x75, 0x03, 0xA3, 0xE6, 0x52, 0xE5, 0xD2, 0xE7, 0x95, 0x7D, 0xC8, 0xA7, 0xAF, 0x37,
+    0x8C, 0x1D, 0xB6, 0x16, 0x11, 0x91, 0xCB, 0x9E, 0x64, 0xEA, 0x6A, 0xB9, 0x47, 0x8F, 0xFC, 0xA5,
+    0x95, 0x21, 0x91, 0xF1, 0x70, 0xB8, 0x78, 0x8C, 0xEF, 0x53, 0xB8, 0xF3, 0x68, 0x89, 0x13, 0x58,
+    0x66, 0xF3, 0xA8, 0xC5, 0x26, 0x43, 0x2E, 0x22, 0xCE, 0xA2, 0x1B, 0xE3, 0x79, 0x56, 0x07, 0xBE,
+    0x7C, 0x4B, 0x2D, 0xB7, 0x36, 0x11, 0x89, 0x58, 0x19, 0xB8, 0xB9, 0x61, 0xF0, 0x7D, 0xE3, 0x59,
+    0xE8, 0x80, 0x21, 0xF2, 0xF0, 0xF3, 0x22, 0xF2, 0xB6, 0x88, 0xF4, 0x80, 0x6A, 0x12, 0xB7, 0x9F,
+    0x34, 0x46, 0x02, 0xD2, 0xAE, 0xC1, 0xE8, 0x29, 0x94, 0xF4, 0x4A, 0xE4, 0xF1, 0x5E, 0x77, 0x91,
+    0xDD, 0x1D, 0xCC, 0x65, 0xA7, 0xAF, 0x8B, 0x88, 0xC8, 0x18, 0xA1, 0x80, 0xAC, 0x41, 0x45, 0xB0,
+    0xED, 0x89, 0x33, 0x22, 0x4D, 0x21, 0xED, 0x7A, 0x18, 0x55, 0xFD, 0xDC, 0xA9, 0xAD, 0x87, 0xB4,
+    0xB9, 0x19, 0x5A, 0x7D, 0x3C, 0x8D, 0x30, 0x0E, 0x13, 0xD0, 0x71, 0x8E, 0x04, 0xCC, 0xAA, 0x96,
+    0x4A, 0x9B, 0xCA, 0x98, 0xB6, 0xE6, 0xC5, 0xA0, 0xAE, 0x76, 0xD8, 0x7D, 0xCC, 0x65, 0x11, 0x11,
+    0xB9, 0x1E, 0x60, 0x05, 0x85, 0x9B, 0xF4, 0xAF, 0xFA, 0x92, 0x11, 0x71, 0xB5, 0x54, 0xEA, 0xEC,
+    0xA1, 0xC7, 0xE5, 0x3B, 0x22, 0xD2, 0x18, 0x4F, 0xA7, 0x03, 0xF7, 0x13, 0x49, 0x8F, 0xAA, 0x02,
+    0xC4, 0xBB, 0xCE, 0x62, 0x45, 0x30, 0x22, 0xEE, 0x68, 0xFD, 0x30, 0x9E, 0x2F, 0xCE, 0xF5, 0xD3,
+    0xDE, 0xF2, 0xF9, 0x50, 0x4F, 0xBE, 0xEB, 0x71, 0x0A, 0xA5, 0xA8, 0x30, 0x83, 0x04, 0x0B, 0x18,
+    0x01, 0x66, 0x37, 0xD9, 0x71, 0x28, 0x47, 0x4A, 0x69, 0x77, 0x19, 0x2C, 0xF9, 0x4F, 0x9D, 0xBE,
+    0xDE, 0x30, 0x8A, 0x88, 0x88, 0xD4, 0x90, 0x79, 0x92, 0x0E, 0x4A, 0x30, 0xBD, 0xBA, 0x20, 0xD2,
+    0x65, 0xD2, 0xF3, 0xF9, 0x0E, 0x3A, 0xD8, 0x86, 0xDC, 0xA1, 0xC5, 0x51, 0x7A, 0x40, 0xB9, 0xA4,
+    0xA2, 0xD7, 0x81, 0xFC, 0x89, 0x80, 0x92, 0x30, 0xB9, 0x01, 0x0E, 0x8D, 0x9D, 0x8F, 0xEB, 0x19,
+    0x28, 0x8E, 0x25, 0x8D, 0x71, 0x3B, 0xA6, 0xCA, 0x5E, 0xF0, 0xC8, 0xD1, 0xB1, 0xFA, 0xC3, 0xB4,
+    0xED, 0x2E, 0x37, 0xFD, 0x70, 0x76, 0xA4, 0x8F, 0xC0, 0xEA, 0x00, 0x32, 0xBF, 0x9A, 0xC0, 0xE3,
+    0x8C, 0xAA, 0xCE, 0x42, 0x2A, 0x52, 0x29, 0x11, 0x21, 0x6F, 0x59, 0xA9, 0x88, 0x0A, 0xC6, 0xA3,
+    0xFD, 0x3E, 0xDC, 0xA9, 0xC3, 0x1A, 0x8D, 0xED, 0x32, 0xCF, 0x3C, 0x59, 0xCB, 0x5D, 0x5B, 0xE7,
+    0x2A, 0x25, 0x63, 0x8D, 0x7A, 0xFA, 0xCD, 0x08, 0xF9, 0x13, 0x1D, 0xEC, 0x9A, 0x80, 0xEA, 0xF3,
+    0x40, 0xDA, 0xE6, 0x57, 0x39, 0x57, 0xE5, 0x22, 0x23, 0x99, 0x48, 0x0B, 0x5B, 0xF3, 0x48, 0xAD,
+    0x22, 0x20, 0x15, 0x1C, 0x74, 0xB0, 0x2C, 0x60, 0x43, 0xB7, 0xDC, 0xC9, 0x37, 0x6F, 0x58, 0xA6,
+    0xB9, 0x48, 0x53, 0x88, 0x74, 0x79, 0x55, 0xFC, 0xBB, 0xCC, 0xEB, 0xA0, 0x03, 0x2B, 0x22, 0x96,
+    0xC2, 0x19, 0xAF, 0xBB, 0xBC, 0xA1, 0x94, 0x86, 0x0D, 0xA9, 0x26, 0x93, 0xC8, 0x83, 0xBE, 0xBA,
+    0xE5, 0xA8, 0x45, 0x2A, 0x23, 0xD2, 0x9B, 0x8A, 0xD2, 0x78, 0xCC, 0xA5, 0x16, 0xDD, 0x46, 0x74,
+    0xB0, 0xAF, 0x9D, 0x0B, 0x5A, 0xA4, 0xE5, 0xEE, 0x6B, 0xEB, 0xD9, 0xE2, 0x41, 0xBE, 0x01, 0xBD,
+    0xF6, 0x68, 0x19, 0xD7, 0x60, 0xFE, 0x2C, 0x9F, 0x82, 0x34, 0xBE, 0xC9, 0x53, 0xE4, 0xEE, 0xE2,
+    0x3C, 0x52, 0xF5, 0x47, 0x46, 0xAA, 0xE3, 0x40, 0x29, 0xE2, 0x6A, 0x91, 0x66, 0x97, 0xFD, 0x93,
+    0x05, 0xC6, 0x9B, 0xC9, 0x25, 0x13, 0xD9, 0xC7, 0x62, 0x9A, 0xD2, 0x29, 0x11, 0xC7, 0xF5, 0x71,
+    0x82, 0x44, 0x16, 0x30, 0xAF, 0x6D, 0x91, 0x88, 0x8C, 0x58, 0x91, 0x76, 0x03, 0x15, 0x2D, 0x58,
+    0x53, 0x61, 0x9E, 0x08, 0x18, 0x2F, 0x3F, 0xA9, 0xBD, 0x11, 0xA9, 0xF8, 0xE1, 0xBF, 0x1E, 0x6A,
+    0x71, 0x04, 0xD2, 0x0E, 0xC8, 0x9B, 0x23, 0x78, 0xE4, 0x93, 0x95, 0x84, 0x6E, 0x20, 0x89, 0x6B,
+    0x0C, 0x73, 0xD4, 0xBF, 0x76, 0x0A, 0xD4, 0xE4, 0x5D, 0x91, 0x6F, 0xF5, 0x49, 0xE7, 0x56, 0x58,
+    0x2C, 0x99, 0x37, 0x5E, 0x87, 0xA4, 0x23, 0x62, 0xBF, 0x35, 0x4C, 0xC1, 0x81, 0xCB, 0xFD, 0x64,
+    0x2A, 0x47, 0xC0, 0xFE, 0xE4, 0x2C, 0xD9, 0x04, 0x10, 0xA4, 0xEA, 0x49, 0x43, 0x84, 0xB8, 0x01,
+    0x1B, 0xC6, 0x63, 0xF5, 0xF8, 0xE7, 0x82, 0x95, 0x11, 0xF5, 0xF4, 0xCF, 0x00, 0xEE, 0xDA, 0x84,
+    0x5C, 0xC6, 0xC9, 0x5A, 0x29, 0xAB, 0x24, 0xA4, 0x81, 0xD4, 0x5B, 0x30, 0x49, 0x07, 0x0F, 0x1A,
+    0x3F, 0x8B, 0x56, 0xCD, 0xED, 0x83, 0xA2, 0x62, 0x6B, 0xEB, 0x80, 0x54, 0xAE, 0x45, 0x4E, 0xD4,
+    0xBF, 0x08, 0xB0, 0x6B, 0x1A, 0x54, 0x6F, 0x3D, 0x69, 0x5B, 0x7A, 0xF2, 0xAA, 0x7C, 0x55, 0x1D,
+    0x50, 0x8A, 0xF4, 0x14, 0x22, 0xD5, 0xEC, 0xEE, 0xDC, 0x5C, 0xFF, 0xFE, 0xF0, 0x96, 0x74, 0x40,
+    0x56, 0xCD, 0x88, 0x9D, 0x93, 0x53, 0xE4, 0x80, 0xE5, 0xDA, 0xDA, 0xAF, 0xA6, 0x80, 0x31, 0xC3,
+    0x0C, 0xFC, 0xD6, 0x73, 0x7F, 0x2A, 0xD2, 0x65, 0x22, 0x43, 0xDA, 0x66, 0xBF, 0x4A, 0x02, 0x91,
+    0x48, 0x81, 0xC5, 0xF8, 0xAC, 0xD1, 0x81, 0x21, 0xED, 0xC8, 0xA5, 0xC3, 0xD4, 0x2D, 0xD9, 0x7A,
+    0xD0, 0x19, 0xB7, 0x36, 0x29, 0x44, 0x5A, 0x2D, 0x32, 0xEA, 0x96, 0xFC, 0x52, 0x40, 0x87, 0x1E,
+    0x7A, 0x0B, 0xD1, 0x5C, 0x7D, 0x38, 0x22, 0xD2, 0x73, 0xE2, 0xE0, 0xC2, 0xDA, 0x4B, 0x4F, 0x39,
+    0x85, 0x0C, 0x01, 0x36, 0x2C, 0xA0, 0x83, 0x05, 0xEE, 0xE1, 0xDE, 0x5B, 0x26, 0x22, 0x97, 0xCB,
+    0x9B, 0xD2, 0x61, 0x47, 0x37, 0x01, 0xC6, 0xC8, 0x04, 0xAB, 0xD8, 0xC7, 0x78, 0x92, 0x8E, 0xA3,
+    0xC5, 0x57, 0xB6, 0xB6, 0x06, 0x8C, 0x88, 0x74, 0x58, 0x99, 0xD1, 0xC1, 0xFB, 0x7F, 0xFB, 0x46,
+    0x71, 0x22, 0x1D, 0xE5, 0x68, 0xA5, 0x49, 0x25, 0x4E, 0xC2, 0x1A, 0x01, 0x2D, 0x0E, 0xB2, 0x17,
+    0x1A, 0xC8, 0x93, 0x00, 0xF7, 0x72, 0xE1, 0x88, 0xDE, 0x90, 0x45, 0x26, 0x98, 0x34, 0x29, 0xC5,
+    0xBB, 0x76, 0xCA, 0x41, 0x2C, 0x07, 0x18, 0x45, 0x40, 0x9A, 0xB2, 0x62, 0x24, 0xF7, 0x87, 0xC1,
+    0xD0, 0xDB, 0xD9, 0xA5, 0xE2, 0x8B, 0xC1, 0x88, 0xAF, 0x87, 0x75, 0x94, 0xA1, 0x49, 0x25, 0xE6,
+    0xE2, 0xB4, 0xBC, 0x3A, 0x35, 0x62, 0xDA, 0x5B, 0x11, 0x91, 0x61, 0xDA, 0x1F, 0x2D, 0x67, 0xD8,
+    0xDA, 0x2A, 0x1D, 0x22, 0x22, 0xEB, 0xFD, 0xD1, 0x4F, 0xFF, 0xE0, 0x3E, 0x93, 0x46, 0x49, 0x3F,
+    0xCB, 0x64, 0x73, 0xF6, 0xDC, 0xA4, 0xB2, 0x6E, 0xA0, 0xEE, 0x40, 0x89, 0x78, 0x92, 0xFA, 0x1F,
+    0xD7, 0x45, 0xE1, 0xEB, 0x17, 0x30, 0x2F, 0x48, 0x8B, 0x15, 0x69, 0x90, 0xAA, 0xF0, 0xBA, 0xC3,
+    0x4E, 0x8D, 0xB1, 0x13, 0xF8, 0x35, 0x5E, 0x87, 0xF7, 0x2E, 0x2A, 0x63, 0x22, 0x2F, 0x4A, 0x28,
+    0xC4, 0x01, 0xE5, 0x99, 0x27, 0xE4, 0xA7, 0xE6, 0x5C, 0xBC, 0x37, 0x3F, 0x0C, 0xB1, 0x58, 0x69,
+    0xCB, 0x11, 0xE3, 0xB1, 0x4C, 0x20, 0xFA, 0x8F, 0x9E, 0xD6, 0x83, 0x91, 0x1E, 0x74, 0x7F, 0x5F,
+    0xFD, 0xFA, 0x6F, 0x1F, 0x8A, 0x8F, 0xDA, 0x75, 0xD7, 0x3F, 0xDD, 0xA5, 0xE2, 0xD2, 0x8E, 0xDC,
+    0xA9, 0xF7, 0xDC, 0xA9, 0xBA, 0xB7, 0xE2, 0x0B, 0x09, 0x22, 0xCF, 0xEF, 0xFD, 0xE3, 0x61, 0x60,
+    0x55, 0xC6, 0x54, 0xDA, 0xDB, 0xFC, 0x6F, 0xE3, 0xB1, 0x64, 0xD2, 0x88, 0x54, 0x3F, 0xD8, 0x7B,
+    0x52, 0xE2, 0xDE, 0x21, 0xF2, 0xBC, 0xBD, 0x3F, 0x07, 0x5A, 0x2E, 0xB5, 0xC6, 0x48, 0x9F, 0x89,
+    0x5B, 0x7B, 0x82, 0x3E, 0xB4, 0x0C, 0x32, 0xFE, 0x2C, 0xEA, 0x5F, 0x48, 0x9F, 0x8F, 0xEB, 0x00,
+    0xE1, 0xED, 0x56, 0xC3, 0xCA, 0xEB, 0xD2, 0x1A, 0xAF, 0x67, 0x07, 0xFE, 0xFB, 0x9F, 0xD4, 0x83,
+    0x48, 0x75, 0x91, 0x9E, 0x6D, 0xF2, 0x4A, 0x4B, 0x55, 0x4E, 0x98, 0xD2, 0xBA, 0xB4, 0xC7, 0x56,
+    0xEA, 0x10, 0xE5, 0xDF, 0xDE, 0x1F, 0xA7, 0x8D, 0x9A, 0x4D, 0xA7, 0x22, 0xAE, 0xD1, 0x57, 0xA4,
+    0x74, 0x79, 0x73, 0x68, 0x02, 0x8A, 0xFC, 0x54, 0xAA, 0x3F, 0x58, 0xA5, 0xE9, 0x24, 0x91, 0x77,
+    0x64, 0x04, 0x55, 0xBB, 0xB2, 0xA3, 0x7C, 0x9F, 0x7F, 0x25, 0x77, 0xA7, 0xE5, 0x89, 0xD9, 0xBD,
+    0x2C, 0xF2, 0xB7, 0x12, 0xCB, 0x31, 0x95, 0x57, 0x75, 0xC0, 0xBA, 0x8F, 0x70, 0x57, 0x88, 0xB3,
+    0x88, 0x54, 0x96, 0xF5, 0x18, 0x7D, 0x70, 0xD3, 0x2C, 0x59, 0xB6, 0xC0, 0xC6, 0xAC, 0x6F, 0x1D,
+    0x43, 0xDA, 0xAB, 0x51, 0xF7, 0x6A, 0x50, 0x4F, 0xF1, 0x0F, 0x47, 0xC7, 0xC5, 0xD3, 0xDD, 0x89,
+    0x58, 0x76, 0x79, 0x4C, 0x3B, 0x15, 0x55, 0xC7, 0xEA, 0x76, 0xB6, 0xD3, 0x52, 0xAD, 0xAC, 0xF8,
+    0xD5, 0xEC, 0xE2, 0x88, 0xD3, 0xA6, 0x3B, 0xC8, 0xDB, 0x09, 0x33, 0x5D, 0x04, 0x05, 0xBA, 0x43,
+    0x8B, 0xD3, 0x6F, 0x75, 0x49, 0x28, 0x08, 0xCA, 0x1F, 0xB2, 0x3B, 0xA8, 0xC7, 0xB5, 0xE5, 0x3E,
+    0x7B, 0x23, 0x6E, 0xFF, 0x62, 0x17, 0x72, 0x87, 0xF1, 0x64, 0x2D, 0x59, 0xA0, 0x08, 0xA4, 0xED,
+    0x1A, 0x21, 0x64, 0x3D, 0xBB, 0x9D, 0xFE, 0x97, 0x50, 0xE8, 0xB6, 0x9D, 0x79, 0x12, 0x59, 0x44,
+    0x02, 0x8F, 0xDC, 0x9E, 0xA2, 0xF7, 0x64, 0x0D, 0x25, 0x59, 0xA7, 0xC4, 0x25, 0x17, 0x0E, 0x03,
+    0xB2, 0x6D, 0x29, 0xDF, 0x91, 0x36, 0x15, 0x67, 0x3C, 0xE3, 0x64, 0x75, 0x13, 0x19, 0xC0, 0x12,
+    0xC1, 0x3C, 0x17, 0x41, 0xBF, 0x19, 0x81, 0xA1, 0x67, 0xB6, 0xE3, 0x8C, 0x78, 0xD0, 0x6F, 0xF7,
+    0x40, 0xB4, 0x15, 0xD8, 0xB4, 0x07, 0xE3, 0xCB, 0x0A, 0x1D, 0xD2, 0x08, 0x91, 0xD2, 0x63, 0x49,
+    0x07, 0xEA, 0x81, 0xB2, 0x15, 0x71, 0x7A, 0x04, 0xB8, 0x6B, 0x1D, 0x1E, 0x88, 0x6B, 0x6F, 0x12,
+    0x59, 0xC3, 0xEC, 0x5D, 0x57, 0x61, 0x3D, 0x3D, 0xB3, 0x09, 0x89, 0x30, 0x51, 0x1D, 0xB0, 0x6B,
+    0x07, 0xF8, 0x2D, 0x27, 0x85, 0x54, 0x56, 0x49, 0xA7, 0x43, 0xDA, 0x61, 0x55, 0x8F, 0x0E, 0x07,
+    0x60, 0x0B, 0x87, 0x96, 0x06, 0x6C, 0x39, 0x47, 0x44, 0x6D, 0xD6, 0xA2, 0x83, 0xAD, 0xB0, 0x08,
+    0x3A, 0xE8, 0xA8, 0xA4, 0xCD, 0x3B, 0x2B, 0x93, 0x4B, 0x75, 0x73, 0x9A, 0xA4, 0x4C, 0x33, 0xC3,
+    0x27, 0xDD, 0xCC, 0xB3, 0xBF, 0x71, 0xB3, 0x3B, 0x12, 0x50, 0xF5, 0xB7, 0x24, 0x96, 0x5D, 0x2E,
+    0x55, 0xE9, 0xAC, 0x53, 0x9D, 0x69, 0xC8, 0xCF, 0x04, 0x54, 0x17, 0x21, 0xAF, 0x99, 0xED, 0x92,
+    0x73, 0x1E, 0xD5, 0x09, 0xE4, 0x67, 0x22, 0xAA, 0x33, 0x81, 0xDC, 0x59, 0x9F, 0x8D, 0xC8, 0x13,
+    0xD2, 0xE9, 0x01, 0x38, 0xEE, 0x50, 0xF3, 0x5F, 0x64, 0xFD, 0x14, 0xAC, 0x37, 0xAF, 0x42, 0xE2,
+    0x6E, 0x0E, 0x64, 0x92, 0x4B, 0xC5, 0x2D, 0x06, 0x1A, 0xB7, 0x59, 0xF0, 0xCC, 0x6C, 0xCD, 0xE4,
+    0x44, 0x1E, 0x79, 0x5E, 0x44, 0x5E, 0x11, 0x91, 0x0E, 0x48, 0x7C, 0x16, 0x8A, 0x68, 0x5F, 0x3D,
+    0x3E, 0xC1, 0xFB, 0x22, 0xE4, 0x11, 0x4B, 0xE6, 0x93, 0xC0, 0x6A, 0x8E, 0x32, 0xBE, 0xEF, 0x49,
+    0x2E, 0x3F, 0x95, 0x30, 0xE9, 0x4A, 0x20, 0x95, 0xF6, 0xC3, 0x54, 0x0C, 0xE3, 0xB9, 0x6F, 0x36,
+    0xB3, 0x52, 0x6F, 0xF9, 0x42, 0xA8, 0x45, 0x7A, 0x11, 0x19, 0x6E, 0x20, 0x05, 0xEB, 0x20, 0x5D,
+    0x87, 0x92, 0xD6, 0x08, 0xEC, 0x33, 0x00, 0x9B, 0x59, 0x4C, 0x05, 0x73, 0x5B, 0xB5, 0x4D, 0x42,
+    0x2A, 0xAF, 0xCB, 0xE4, 0x6D, 0x18, 0xC8, 0x2B, 0xDD, 0xA8, 0x40, 0x37, 0x05, 0x06, 0x1C, 0x70,
+    0x11, 0x28, 0x12, 0x11, 0x53, 0x95, 0xA3, 0x6E, 0x88, 0x04, 0x2C, 0xDF, 0xC4, 0xF8, 0x63, 0xB7,
+    0xDF, 0xA4, 0x64, 0xF6, 0x9C, 0xB0, 0xAD, 0x83, 0x2A, 0x33, 0x11, 0x79, 0x52, 0x44, 0x1A, 0x36,
+    0x4F, 0x16, 0x61, 0x59, 0x86, 0x0D, 0x1D, 0x96, 0x49, 0x58, 0x24, 0xE1, 0x7C, 0x12, 0x1E, 0x4D,
+    0xC2, 0xC9, 0x24, 0x70, 0x3B, 0xEF, 0x5C, 0xAA, 0x72, 0xA2, 0x4A, 0xFC, 0x21, 0x41, 0x27, 0x95,
+    0x0E, 0x3A, 0x12, 0x11, 0x2C, 0x45, 0x65, 0xBC, 0xBA, 0x6D, 0x41, 0x6F, 0x92, 0xC8, 0xD4, 0xA9,
+    0xEC, 0xD4, 0xE7, 0x8A, 0x77, 0x1F, 0x4E, 0xB8, 0x82, 0x21, 0x09, 0x79, 0x53, 0x10, 0xDF, 0xE7,
+    0x2B, 0x28, 0xE9, 0x29, 0xD7, 0xA4, 0x8E, 0x42, 0x02, 0x94, 0xE3, 0x4D, 0x80, 0x3A, 0xAE, 0x7B,
+    0xAA, 0xF1, 0xD5, 0xD4, 0x27, 0x91, 0x0E, 0xF4, 0x30, 0xC3, 0xA3, 0x42, 0x80, 0x67, 0x8F, 0x7C,
+    0x8B, 0xFB, 0xB0, 0x10, 0x88, 0xA4, 0x5E, 0x07, 0x55, 0x52, 0x8B, 0xF4, 0x46, 0x44, 0x1A, 0x4E,
+    0x51, 0x04, 0x25, 0x1E, 0x0B, 0x2B, 0x92, 0x40, 0xE6, 0x29, 0x60, 0xF5, 0xD5, 0xE4, 0x9D, 0x26,
+    0x1B, 0x28, 0xBC, 0x8A, 0x14, 0x41, 0x8B, 0xBF, 0xB3, 0xB8, 0xF9, 0x0B, 0xE4, 0xF2, 0xF8, 0xC4,
+    0x14, 0x3C, 0xC9, 0xBA, 0x3F, 0x67, 0xFD, 0x21, 0x98, 0x1E, 0x1D, 0xF0, 0xD9, 0x5B, 0xDC, 0x39,
+    0x01, 0x23, 0xBF, 0x17, 0x4F, 0xDD, 0xEB, 0x11, 0x16, 0xD8, 0x80, 0xF6, 0x5A, 0x3C, 0x0B, 0x96,
+    0x07, 0x68, 0xAF, 0x5F, 0xEC, 0x58, 0xB0, 0xCC, 0xBD, 0xF6, 0xBA, 0x39, 0x60, 0xC1, 0x52, 0x77,
+    0xDA, 0xEB, 0x26, 0xF7, 0x0B, 0x96, 0xD4, 0xDA, 0xEB, 0x46, 0x77, 0x0B, 0x96, 0x98, 0x4B, 0x5E,
+    0x37, 0x94, 0x0B, 0x96, 0x68, 0xF1, 0xBA, 0xC1, 0x44, 0x96, 0x50, 0xFA, 0x42, 0x48, 0xA2, 0x91,
+    0x30, 0x87, 0x55, 0x0E, 0xB5, 0xD2, 0x54, 0xF3, 0x1C, 0x77, 0x38, 0xC0, 0xA9, 0xC0, 0x21, 0x6F,
+    0x69, 0x76, 0x11, 0x3F, 0x2F, 0x6D, 0x2A, 0xA5, 0x34, 0x27, 0xA4, 0x2D, 0xBD, 0x8A, 0x58, 0xD2,
+    0x86, 0x7D, 0x72, 0x97, 0x74, 0xEC, 0x90, 0x35, 0xAA, 0xA3, 0x70, 0xEF, 0x53, 0xA4, 0xEA, 0x2E,
+    0x93, 0x27, 0xA5, 0x99, 0x49, 0x70, 0x99, 0x80, 0xC8, 0xB9, 0x48, 0x26, 0x95, 0x6D, 0xD1, 0x5E,
+    0x0B, 0x2C, 0xB0, 0x11, 0xED, 0xF5, 0x4B, 0x2D, 0x0B, 0x96, 0xD6, 0x69, 0xAF, 0x7F, 0x15, 0x59,
+    0xB0, 0xCC, 0x5A, 0xED, 0x75, 0x63, 0xDD, 0x82, 0xA5, 0x8A, 0xDA, 0xEB, 0x26, 0x0B, 0x0B, 0x96,
+    0xD8, 0x33, 0x5E, 0x37, 0xC4, 0x05, 0x4B, 0xD2, 0xB7, 0xBD, 0x6E, 0xB0, 0x91, 0x25, 0x88, 0xD7,
+    0x0D, 0x69, 0x4C, 0x24, 0x50, 0x78, 0x91, 0x79, 0xB4, 0x57, 0x6B, 0x17, 0x48, 0x72, 0x24, 0xAC,
+    0x14, 0x0F, 0x1F, 0xCD, 0x04, 0x57, 0x4E, 0x7D, 0x1C, 0x6D, 0xBD, 0xD5, 0xE6, 0xDB, 0x58, 0x4B,
+    0xD7, 0x38, 0xE0, 0x6B, 0xC0, 0x67, 0xF8, 0x22, 0x24, 0x21, 0x6B, 0xC0, 0x3C, 0xDF, 0x01, 0xE5,
+    0x3E, 0x6B, 0x86, 0x88, 0x6E, 0x3F, 0x7D, 0x1D, 0x39, 0xC6, 0x49, 0xE8, 0x74, 0x83, 0x0A, 0x1B,
+    0xA0, 0xDF, 0x0A, 0xB3, 0x16, 0xEB, 0x6E, 0x0A, 0xF1, 0x7F, 0xE4, 0x3A, 0xA2, 0x6E, 0x38, 0x89,
+    0xE6, 0xC9, 0x11, 0xF6, 0xA7, 0x78, 0xF6, 0x74, 0x31, 0x05, 0x7F, 0x8C, 0x83, 0x53, 0xA8, 0x70,
+    0xA2, 0xB7, 0x03, 0x0B, 0x25, 0xBF, 0x95, 0x0E, 0x4E, 0x48, 0x53, 0x4E, 0xE1, 0x91, 0x08, 0xAC,
+    0x30, 0x1E, 0x32, 0x3F, 0x5F, 0x64, 0xD3, 0xC5, 0xEA, 0x36, 0x2E, 0xCA, 0x98, 0x48, 0x83, 0x11,
+    0x5F, 0x8F, 0x47, 0x54, 0xB6, 0x9C, 0x54, 0xB6, 0xB9, 0x55, 0x65, 0x1B, 0x16, 0x2C, 0x2D, 0x37,
+    0x54, 0xB6, 0xD1, 0x5E, 0x37, 0x96, 0x1B, 0x2A, 0xDB, 0x2E, 0x58, 0x62, 0xF5, 0x0D, 0x95, 0x7D,
+    0xC5, 0xEB, 0x06, 0xBB, 0xFD, 0xFE, 0x2A, 0x9B, 0x79, 0x50, 0xAE, 0x07, 0xB6, 0x73, 0x07, 0xA9,
+    0x84, 0x35, 0x00, 0xE2, 0xAF, 0x26, 0x79, 0x27, 0xB1, 0x18, 0x53, 0x29, 0xA5, 0x39, 0x37, 0xA6,
+    0x51, 0x45, 0x2C, 0x3B, 0x64, 0x4D, 0xEE, 0x92, 0x2E, 0x6D, 0xD8, 0x57, 0x1D, 0x85, 0x7B, 0xCF,
+    0x82, 0xBA, 0x4B, 0x3A, 0x19, 0xD8, 0x5F, 0xC7, 0xD4, 0xE6, 0x61, 0x5E, 0x77, 0x90, 0xF6, 0x53,
+    0x0C, 0x47, 0xBD, 0x0A, 0x46, 0x7A, 0x48, 0x45, 0xE0, 0xA6, 0x60, 0x3A, 0xC0, 0xE7, 0x2F, 0x80,
+    0x12, 0x69, 0x48, 0xE4, 0xB2, 0xA0, 0x07, 0x8A, 0x89, 0x8F, 0xA5, 0x22, 0x14, 0xFE, 0x00, 0x74,
+    0x6F, 0x81, 0x3A, 0xF7, 0x90, 0xFF, 0x22, 0x80, 0x7E, 0xAB, 0x07, 0xE2, 0x01, 0x60, 0x0B, 0x0F,
+    0xE6, 0x17, 0x01, 0xD2, 0x37, 0x23, 0x24, 0xBD, 0xAD, 0x60, 0xC8, 0x02, 0xD4, 0x08, 0x94, 0xE4,
+    0x1D, 0xB5, 0x53, 0x22, 0xE2, 0x98, 0xB8, 0x58, 0x77, 0x6D, 0x82, 0xDA, 0xDB, 0x43, 0x8B, 0x90,
+    0xEC, 0xED, 0x7D, 0xB4, 0x1C, 0x96, 0x39, 0x7D, 0x20, 0x05, 0xD5, 0xA7, 0x1E, 0xAC, 0x34, 0x6B,
+    0x6F, 0xE0, 0xF1, 0x4F, 0x99, 0x19, 0x47, 0xE2, 0x35, 0x3A, 0x18, 0x12, 0x19, 0xA1, 0xEC, 0x6E,
+    0xD0, 0x5B, 0x3E, 0xB2, 0x86, 0xA3, 0xDD, 0x7D, 0x4C, 0x71, 0xA0, 0xB4, 0x2F, 0x3C, 0x69, 0x67,
+    0x3D, 0x69, 0x6B, 0x1D, 0x34, 0x77, 0x1C, 0x36, 0xFF, 0x2F, 0x1C, 0xA4, 0xD3, 0xF3, 0xA8, 0x23,
+    0xA6, 0xA3, 0xF6, 0x59, 0x20, 0xED, 0xD3, 0x00, 0x75, 0xD2, 0x83, 0x69, 0x23, 0x24, 0x37, 0xDA,
+    0x38, 0x37, 0xBC, 0x07, 0x62, 0x0D, 0xD8, 0x43, 0x45, 0xC8, 0xDA, 0x11, 0x74, 0x57, 0x78, 0x92,
+    0xA8, 0x23, 0x2A, 0x52, 0x36, 0xC9, 0x40, 0x2A, 0x32, 0x40, 0x21, 0x3D, 0x37, 0xFC, 0xA2, 0x98,
+    0x33, 0x0D, 0xF9, 0x8F, 0x5B, 0xAC, 0xF1, 0xEC, 0xE4, 0x8E, 0x6E, 0x09, 0x4F, 0xDD, 0xFB, 0x11,
+    0x4A, 0xE0, 0x18, 0xB3, 0xBB, 0x53, 0xC9, 0xDA, 0x57, 0x64, 0x1B, 0x6E, 0x90, 0xE5, 0x27, 0xD5,
+    0xAB, 0x45, 0x2A, 0xCA, 0x6B, 0x75, 0x40, 0x87, 0xB4, 0x7F, 0x8F, 0xF0, 0x60, 0x5C, 0xEF, 0xD2,
+    0x80, 0xBE, 0x52, 0x7B, 0xB4, 0x0C, 0xA0, 0xAF, 0x45, 0x26, 0xB3, 0x40, 0x07, 0xEB, 0xD0, 0x21,
+    0x6F, 0xD0, 0x21, 0x0B, 0xE8, 0xA0, 0x07, 0x74, 0x40, 0x5C, 0x21, 0xCE, 0xB6, 0x22, 0x95, 0x89,
+    0x33, 0x91, 0xC4, 0xC1, 0x12, 0xAC, 0x23, 0xF7, 0x18, 0x4F, 0x56, 0xDD, 0xB0, 0x02, 0x92, 0x98,
+    0xBF, 0x23, 0x45, 0x3C, 0x77, 0xF9, 0x9F, 0xD4, 0x08, 0x25, 0xE4, 0x8E, 0xB4, 0x41, 0x75, 0xB0,
+    0x73, 0xF3, 0x85, 0xAA, 0x47, 0x25, 0xE2, 0x3F, 0xE9, 0xBA, 0x9F, 0x5A, 0x47, 0x18, 0x8E, 0x50,
+    0x18, 0xB7, 0xD7, 0x0E, 0xCE, 0x89, 0xCD, 0xF0, 0x21, 0x1A, 0x31, 0x3D, 0x8D, 0xA2, 0x42, 0x07,
+    0xE8, 0x61, 0x09, 0x1B, 0x33, 0xA9, 0xFA, 0x84, 0x23, 0xF3, 0xB9, 0x43, 0x77, 0xFB, 0xC0, 0xD8,
+    0x01, 0xB6, 0x5D, 0x3B, 0x53, 0x3F, 0x8D, 0xA7, 0x77, 0x4C, 0xFB, 0x9C, 0x95, 0x71, 0xE6, 0x97,
+    0x95, 0x12, 0x4F, 0xEE, 0x51, 0x17, 0x3E, 0xF4, 0xD3, 0xE3, 0x18, 0xA4, 0x9E, 0x64, 0x40, 0x49,
+    0x85, 0xAD, 0x0E, 0xD1, 0xD8, 0x16, 0x4A, 0xC4, 0x95, 0x12, 0xF3, 0xC6, 0x3C, 0xDF, 0xB1, 0xB2,
+    0xA4, 0x97, 0x02, 0x8F, 0x59, 0x8F, 0x12, 0x47, 0x26, 0x8E, 0x7C, 0x84, 0x62, 0x80, 0xA2, 0x87,
+    0xF2, 0x39, 0x18, 0x2E, 0x92, 0xBD, 0xE4, 0xD9, 0x5F, 0x61, 0x5E, 0x08, 0xBA, 0xAF, 0x65, 0x4C,
+    0x44, 0xDC, 0xD4, 0xCF, 0x1C, 0x49, 0x4B, 0x1A, 0x30, 0x9E, 0xC2, 0xB1, 0x80, 0xAF, 0x1E, 0x12,
+    0x1C, 0x7A, 0xF3, 0x46, 0x2C, 0x58, 0x6D, 0xB0, 0xB0, 0x9C, 0x2C, 0x5A, 0xCC, 0x88, 0x96, 0x96,
+    0xB2, 0x27, 0x89, 0x0F, 0xB2, 0xB3, 0x60, 0xB9, 0xC1, 0xCA, 0xBE, 0xD1, 0x15, 0xD2, 0xA8, 0xB3,
+    0xA0, 0x40, 0x0D, 0x60, 0x3B, 0xCC, 0x2F, 0x1B, 0x1D, 0x0A, 0xCE, 0xCF, 0x31, 0xAB, 0x8F, 0xB6,
+    0xC2, 0xB0, 0x0B, 0x52, 0x25, 0xD7, 0x1B, 0xFD, 0x62, 0x30, 0x55, 0x77, 0xCF, 0x14, 0x36, 0xFA,
+    0x10, 0x15, 0x3E, 0xBE, 0x49, 0x2E, 0x5D, 0x2A, 0xF2, 0xDC, 0x40, 0x2C, 0x5C, 0x76, 0x29, 0xB0,
+    0x6D, 0x49, 0xCF, 0xC4, 0x89, 0x43, 0x51, 0x77, 0x28, 0x69, 0x49, 0xA4, 0x21, 0x91, 0x8A, 0x34,
+    0x9E, 0xC4, 0xBC, 0x54, 0xB1, 0xBF, 0x22, 0x7B, 0xC9, 0x13, 0x6B, 0xEC, 0xDF, 0x8A, 0xB4, 0x85,
+    0x74, 0x1C, 0x3F, 0x0B, 0x9F, 0x9D, 0x0C, 0x8C, 0x2F, 0xB4, 0xB0, 0x01, 0x99, 0x47, 0x77, 0x53,
+    0x97, 0xF8, 0x10, 0x15, 0xFB, 0x4B, 0x10, 0x38, 0x57, 0x61, 0x1C, 0x05, 0x44, 0xD8, 0xE4, 0x38,
+    0x77, 0xD0, 0xEB, 0x90, 0xB6, 0x91, 0x5C, 0xA0, 0xF4, 0x87, 0x61, 0xC8, 0x8F, 0x52, 0xBC, 0xC7,
+    0x38, 0xF9, 0x00, 0x7D, 0x7E, 0x26, 0x64, 0x2F, 0x78, 0x2D, 0x8E, 0x91, 0xD9, 0xD5, 0xFF, 0x21,
+    0x5A, 0x31, 0xD3, 0x04, 0x46, 0x11, 0x91, 0xCB, 0x95, 0x75, 0x1B, 0x9D, 0xEE, 0xF4, 0x6F, 0xB1,
+    0xEE, 0xFE, 0x47, 0x75, 0x97, 0x54, 0x58, 0x37, 0x43, 0xC8, 0x0F, 0x72, 0x72, 0x42, 0x86, 0x89,
+    0xE5, 0x30, 0x75, 0xAB, 0x0B, 0x40, 0xE9, 0x27, 0xC5, 0x9B, 0x68, 0x63, 0xFD, 0x1C, 0xB5, 0x48,
+    0x1C, 0xF0, 0x14, 0xBA, 0x9D, 0xDF, 0xA7, 0xA5, 0x17, 0xE9, 0xBF, 0x77, 0x65, 0xF3, 0xB0, 0xE4,
+    0xD6, 0x77, 0x98, 0x7C, 0x6A, 0x03, 0x53, 0xC8, 0xF4, 0x4B, 0x50, 0x7A, 0x4E, 0x37, 0xE8, 0x66,
+    0xF6, 0x60, 0x9D, 0x9A, 0x28, 0x2F, 0xB9, 0xDB, 0x9D, 0x18, 0x2F, 0xFA, 0x7A, 0x3B, 0x13, 0x5E,
+    0x8A, 0x9B, 0xA3, 0xF2, 0x72, 0x59, 0x44, 0xC6, 0x5E, 0x77, 0xFA, 0xB2, 0xB3, 0x6E, 0x19, 0x74,
+    0x97, 0xFC, 0x06, 0xEB, 0xEE, 0xFD, 0xE0, 0xCD, 0xC5, 0x3A, 0x38, 0x27, 0x0D, 0x66, 0xED, 0xAA,
+    0x08, 0xD0, 0x41, 0x40, 0x05, 0xFE, 0x4B, 0xA3, 0x5F, 0xF6, 0xBA, 0x75, 0x1F, 0xA6, 0x75, 0x1F,
+    0xE8, 0xE1, 0x88, 0x34, 0x64, 0x32, 0x7C, 0x80, 0x87, 0xF3, 0x07, 0x05, 0xFF, 0xBD, 0x2B, 0x9B,
+    0xB5, 0x84, 0x2F, 0x1C, 0x96, 0xBC, 0xBB, 0x6A, 0x33, 0x57, 0x1C, 0x2D, 0x4F, 0x03, 0xCB, 0x3A,
+    0x40, 0xF2, 0x78, 0xE4, 0x5D, 0xAF, 0x52, 0xBC, 0x91, 0xB7, 0xA5, 0xA5, 0xEE, 0x75, 0x07, 0x3B,
+    0x58, 0x37, 0x25, 0x41, 0x7E, 0xC0, 0xD3, 0xC2, 0x91, 0xFA, 0xA4, 0x83, 0xD5, 0x3C, 0xF1, 0x0E,
+    0x24, 0x3D, 0x59, 0xAF, 0x6A, 0xB0, 0x22, 0x7E, 0xC6, 0x65, 0x47, 0x60, 0x93, 0xA4, 0x90, 0xC9,
+    0x0E, 0x3C, 0x60, 0x3B, 0xF8, 0x46, 0x71, 0x6B, 0xDE, 0x54, 0x11, 0x92, 0x31, 0x11, 0x5F, 0xF4,
+    0xEA, 0x80, 0xAC, 0xA5, 0x27, 0xAF, 0x74, 0xCB, 0xEE, 0x94, 0x24, 0xB2, 0x41, 0x7A, 0x6B, 0x91,
+    0x25, 0x6D, 0x89, 0x14, 0x95, 0xEE, 0xD3, 0x91, 0x54, 0x46, 0x69, 0x52, 0xF9, 0xB5, 0x38, 0xB5,
+    0xA9, 0x20, 0x11, 0x01, 0xAC, 0x04, 0x48, 0x6E, 0x44, 0x3A, 0x3E, 0x65, 0x31, 0x7C, 0x7D, 0xEF,
+    0x02, 0x89, 0x88, 0xE3, 0xC4, 0xDE, 0x3F, 0xDC, 0x52, 0x9F, 0x44, 0x28, 0xDA, 0x22, 0x26, 0x52,
+    0x9D, 0x6E, 0x39, 0x78, 0xDF, 0x36, 0xDF, 0x28, 0x0A, 0xEC, 0x62, 0x7C, 0xD2, 0x63, 0xAB, 0xB2,
+    0xA5, 0x94, 0xCB, 0x03, 0xE5, 0x50, 0x74, 0xDC, 0x35, 0xB9, 0x28, 0x0E, 0xA3, 0xF5, 0x69, 0x9B,
+    0x33, 0x23, 0x74, 0xEA, 0x8E, 0xA3, 0x01, 0xFB, 0x4F, 0x57, 0x1F, 0x54, 0x93, 0x38, 0xB2, 0xE6,
+    0x7E, 0x30, 0x12, 0x20, 0x1F, 0x6F, 0xCD, 0x11, 0xF9, 0x48, 0xF5, 0x61, 0xCA, 0x29, 0x9C, 0x3C,
+    0x49, 0x57, 0x56, 0x80, 0xD1, 0x1E, 0x08, 0x0B, 0xC0, 0xFC, 0x7D, 0xB5, 0x76, 0x5D, 0x1F, 0x0A,
+    0x27, 0x95, 0x88, 0x88, 0x1D, 0xC9, 0xA4, 0xFA, 0x90, 0x12, 0xB1, 0x8E, 0xB4, 0x49, 0x3A, 0xD8,
+    0xA6, 0x70, 0x64, 0x5E, 0x45, 0x88, 0x98, 0x86, 0xA2, 0xA2, 0xAE, 0x4E, 0x07, 0xB4, 0x48, 0x64,
+    0xB6, 0xD7, 0xD4, 0xD9, 0xB5, 0xA3, 0xC5, 0x46, 0x50, 0x6D, 0x07, 0xD9, 0xB7, 0x5B, 0x78, 0x20,
+    0x73, 0xB0, 0xB3, 0x3D, 0x27, 0xD2, 0x1C, 0xA2, 0xEC, 0xDA, 0x67, 0x7D, 0x26, 0xD4, 0xED, 0x89,
+    0x9E, 0xE2, 0x0F, 0x8B, 0x65, 0x63, 0x12, 0x4B, 0x5E, 0xE9, 0xC0, 0x01, 0xA6, 0xCD, 0x7B, 0x72,
+    0xB9, 0x2E, 0x2E, 0x97, 0xEF, 0x0E, 0x1C, 0xA1, 0x6A, 0xF3, 0x4D, 0xE5, 0xC1, 0xF8, 0x7D, 0xD0,
+    0x7D, 0xE1, 0x51, 0x63, 0x16, 0xC0, 0x26, 0x3D, 0x68, 0x77, 0xEF, 0xCD, 0x0C, 0xF9, 0x4F, 0x41,
+    0x36, 0xB8, 0x93, 0x90, 0x3E, 0xDE, 0x82, 0x35, 0x1E, 0xD5, 0xED, 0x83, 0x79, 0xA2, 0x85, 0xED,
+    0x02, 0x54, 0xF5, 0xFD, 0xA3, 0xB3, 0xC9, 0x47, 0x2D, 0x9B, 0x4F, 0xBC, 0xBD, 0x25, 0x7F, 0x9C,
+    0xD1, 0xFD, 0x11, 0x37, 0x35, 0xAB, 0x66, 0x4F, 0xBB, 0x6E, 0xD6, 0xCE, 0x4D, 0xDB, 0x73, 0x84,
+    0xE8, 0x7D, 0xD8, 0x37, 0xD7, 0x09, 0x70, 0xF9, 0x3C, 0xB9, 0xEC, 0x96, 0x33, 0xED, 0xCE, 0x54,
+    0x00, 0x49, 0xA3, 0xDD, 0xBB, 0x87, 0x5B, 0x2B, 0xAD, 0x72, 0x4A, 0xC6, 0x42, 0x2A, 0xDD, 0x52,
+    0xF7, 0xBA, 0x9F, 0x00, 0xB4, 0x8A, 0x64, 0x1D, 0xA6, 0x22, 0x62, 0x7A, 0x72, 0xC7, 0x80, 0x89,
+    0x14, 0x70, 0x40, 0x1E, 0xB1, 0x60, 0xD9, 0xD8, 0x61, 0x09, 0x96, 0xC5, 0x94, 0x98, 0xEF, 0xB6,
+    0x2D, 0x2B, 0xC8, 0xAB, 0x8B, 0xB9, 0xEB, 0xC0, 0xF8, 0xCE, 0x3C, 0x1E, 0x20, 0x7B, 0x2E, 0x98,
+    0xE7, 0x03, 0xA4, 0xBF, 0x6E, 0xD3, 0x17, 0x5B, 0xD0, 0x6F, 0x37, 0xFA, 0x15, 0x0F, 0xC9, 0x3B,
+    0x7E, 0x4E, 0x1E, 0xAB, 0x12, 0xA9, 0x00, 0x71, 0x88, 0x9B, 0x38, 0xC0, 0x32, 0xD3, 0x35, 0x0E,
+    0xDE, 0x5D, 0xDF, 0x29, 0xD4, 0x45, 0x3A, 0xB5, 0xF1, 0xFA, 0x14, 0x4C, 0xC9, 0x1D, 0x90, 0xFA,
+    0x6D, 0x80, 0x67, 0x93, 0xEA, 0x5D, 0x69, 0x23, 0x19, 0x76, 0xB0, 0x03, 0x5D, 0x22, 0x7E, 0x20,
+    0xAF, 0x74, 0x9B, 0xB6, 0x49, 0x64, 0x07, 0x8B, 0x6D, 0x32, 0x9F, 0x74, 0xE9, 0x48, 0x4F, 0x5E,
+    0xFD, 0xCF, 0x60, 0x20, 0x9A, 0xFC, 0xDB, 0x81, 0xEC, 0xB9, 0xD0, 0x2F, 0x61, 0x79, 0x7F, 0x76,
+    0xC9, 0xA3, 0xDF, 0xF6, 0x3B, 0xE7, 0xA1, 0x38, 0xAF, 0x2F, 0x3B, 0x10, 0x57, 0x04, 0x30, 0x81,
+    0x11, 0xD8, 0x5D, 0xBB, 0xF4, 0x0E, 0x43, 0x2F, 0x1C, 0x00, 0x89, 0x78, 0x48, 0x7F, 0x13, 0x20,
+    0xFF, 0x56, 0x07, 0xF7, 0xAF, 0xD9, 0x60, 0x9F, 0x68, 0x86, 0xDD, 0x9C, 0x51, 0x14, 0x41, 0x5D,
+    0x6F, 0x61, 0x23, 0x77, 0x13, 0x4D, 0x2E, 0xE8, 0xEA, 0x93, 0xCD, 0xA9, 0x39, 0xC6, 0x26, 0xD8,
+    0x33, 0x3D, 0x94, 0x67, 0x7A, 0xB0, 0x49, 0x77, 0xEB, 0x43, 0xFD, 0x64, 0x44, 0x72, 0x6C, 0xF2,
+    0x58, 0xAB, 0x71, 0x92, 0x8A, 0xBD, 0x70, 0xD4, 0x39, 0x82, 0x15, 0xE9, 0xAD, 0x48, 0xDC, 0x20,
+    0xED, 0xB6, 0x31, 0xED, 0x79, 0x72, 0xFF, 0x35, 0xEC, 0xE4, 0x07, 0x48, 0xFA, 0x89, 0x93, 0x6C,
+    0x9A, 0x89, 0xB8, 0x54, 0x4E, 0xC5, 0xBA, 0x87, 0x2C, 0xF0, 0x65, 0xE3, 0x59, 0x58, 0xC7, 0x76,
+    0xCD, 0x56, 0x14, 0x91, 0xBE, 0x9E, 0x42, 0x85, 0x93, 0xCB, 0x39, 0xF5, 0x10, 0xA1, 0xA8, 0x48,
+    0x5B, 0xE8, 0x8F, 0xBA, 0xE2, 0x44, 0xFA, 0x5C, 0xE4, 0x57, 0x5D, 0xD2, 0x7F, 0x85, 0x52, 0x79,
+    0x33, 0x59, 0x5A, 0xFB, 0x90, 0x57, 0xA4, 0x73, 0x4C, 0xDB, 0xDD, 0x99, 0xB5, 0xEA, 0xE5, 0x9E,
+    0x0D, 0x2B, 0xF2, 0xEB, 0x1B, 0xE9, 0x68, 0xD3, 0x38, 0x94, 0xB7, 0x13, 0xCF, 0x2D, 0xAB, 0x6E,
+    0xE9, 0xD5, 0x1F, 0x43, 0x5B, 0xB2, 0x0A, 0x35, 0x4C, 0x7F, 0x77, 0x53, 0x66, 0xD6, 0x87, 0x6D,
+    0x44, 0xC2, 0x09, 0x97, 0xF9, 0xC2, 0xE9, 0xB0, 0x3F, 0x79, 0x3C, 0x6C, 0x7B, 0x53, 0x43, 0x3E,
+    0x9E, 0x07, 0x72, 0x8C, 0x45, 0x12, 0x74, 0xBB, 0x4D, 0xFE, 0xA4, 0xA3, 0x6C, 0x49, 0xE2, 0x0C,
+    0x41, 0xFE, 0xC4, 0x07, 0xF2, 0x57, 0x50, 0x0F, 0x14, 0x3F, 0x0F, 0x69, 0xF3, 0x15, 0x22, 0x98,
+    0x0A, 0xD5, 0x41, 0xEE, 0x3E, 0xD8, 0x41, 0xD5, 0x03, 0x56, 0x5A, 0x3E, 0x43, 0xAF, 0xBB, 0x34,
+    0xA4, 0x41, 0xB7, 0x0A, 0xDC, 0x46, 0x1A, 0xA2, 0xFD, 0x8E, 0xFF, 0xEA, 0x94, 0x93, 0xA5, 0x47,
+    0x0E, 0xBA, 0xFC, 0xA1, 0x4B, 0xED, 0xF2, 0x3C, 0x0D, 0xE8, 0xF8, 0xB9, 0xF2, 0x9D, 0x37, 0x9E,
+    0x1C, 0xBE, 0x51, 0x54, 0xF0, 0xF5, 0xBD, 0xBF, 0x97, 0xF1, 0x07, 0x7B, 0x15, 0xA4, 0xEE, 0xB3,
+    0xFB, 0xC9, 0x8B, 0x12, 0xCD, 0xC8, 0x71, 0x96, 0x22, 0x3B, 0xA7, 0xD4, 0x43, 0x6D, 0x3D, 0x66,
+    0xEF, 0xF8, 0x25, 0xE4, 0x5D, 0x39, 0x5C, 0x2C, 0x1E, 0x7B, 0x80, 0xED, 0x13, 0x21, 0xAD, 0xB4,
+    0xCB, 0x5A, 0x1B, 0xCF, 0x2F, 0x9F, 0xBD, 0xE7, 0xE2, 0x3D, 0x3B, 0xDB, 0x45, 0xA7, 0x9C, 0xC2,
+    0xDD, 0x93, 0x56, 0xD1, 0xA6, 0xBF, 0xEA, 0x36, 0xCC, 0xE3, 0x61, 0x5B, 0xE3, 0x39, 0xC9, 0x77,
+    0xDD, 0x72, 0xC7, 0xFC, 0xE8, 0xAD, 0x60, 0x06, 0x6C, 0xC5, 0x53, 0x1C, 0x53, 0x3C, 0x7B, 0xBF,
+    0x0E, 0x31, 0xFD, 0x55, 0x97, 0x3D, 0x1F, 0xCC, 0x99, 0xE6, 0xCF, 0xF4, 0x94, 0x57, 0x65, 0xE5,
+    0x17, 0xD5, 0xC1, 0x33, 0xAA, 0x01, 0xDC, 0xB6, 0xD1, 0xED, 0x32, 0x6D, 0x6D, 0xD2, 0x03, 0xE6,
+    0x52, 0xBF, 0x61, 0x9E, 0xF8, 0x75, 0x08, 0x5F, 0x05, 0xF3, 0xC2, 0x5B, 0x61, 0x95, 0xEB, 0x76,
+    0x91, 0x70, 0xEF, 0xC6, 0xC6, 0x72, 0xF1, 0xCD, 0x6F, 0x70, 0xCC, 0x5C, 0x0A, 0xFD, 0x6A, 0xF1,
+    0x19, 0x4E, 0xD5, 0x72, 0x00, 0x64, 0xCD, 0xEE, 0x98, 0x5D, 0x6F, 0x76, 0x01, 0xE5, 0xF2, 0x6E,
+    0xB1, 0x78, 0xF0, 0xBE, 0xC5, 0x22, 0xEF, 0x94, 0x3B, 0x9E, 0xB5, 0xD1, 0x9A, 0x87, 0x1E, 0x77,
+    0x5F, 0xD2, 0xF1, 0x74, 0xBB, 0x34, 0x97, 0xC2, 0x29, 0x70, 0xDB, 0xA9, 0xDF, 0x20, 0x26, 0xF2,
+    0xFC, 0x08, 0xA7, 0xB6, 0xB7, 0xB7, 0xB7, 0xB7, 0xEF, 0xE5, 0x59, 0x6C, 0x9B, 0x5D, 0xFE, 0x56,
+    0xB7, 0x5A, 0x26, 0xBF, 0xE2, 0x18, 0x68, 0x3E, 0xBB, 0x52, 0xAF, 0x5F, 0x8B, 0xB9, 0xB8, 0xBB,
+    0xDD, 0xDD, 0xEE, 0x89, 0xE1, 0x2B, 0x07, 0xF2, 0xFA, 0x77, 0xE2, 0xC9, 0x3B, 0x28, 0xE5, 0x0D,
+    0x19, 0xEE, 0xDA, 0x72, 0xB7, 0xB6, 0x40, 0x55, 0xE8, 0x96, 0xB4, 0xC1, 0x78, 0x72, 0xB8, 0x0F,
+    0xE0, 0x0E, 0x9E, 0xB2, 0x3F, 0x8A, 0xF6, 0x47, 0x31, 0xA7, 0x5B, 0xA4, 0x7E, 0x5B, 0x0F, 0x85,
+    0x63, 0x73, 0x0E, 0x89, 0x99, 0xC0, 0xB4, 0x82, 0x43, 0xDA, 0xDF, 0xE4, 0x79, 0xFF, 0xD8, 0xA8,
+    0xFA, 0x93, 0x01, 0x3C, 0x20, 0x22, 0xD2, 0x98, 0xCA, 0xB2, 0x4D, 0xA7, 0x83, 0xF6, 0x06, 0xCB,
+    0x82, 0x47, 0x75, 0x48, 0xD6, 0xF1, 0x64, 0x1D, 0x00, 0xEC, 0x0F, 0x7F, 0x06, 0x5A, 0xA4, 0x03,
+    0xBB, 0x27, 0x0D, 0x3A, 0x20, 0x60, 0xD1, 0x3D, 0x3A, 0x90, 0xBF, 0x0F, 0xF3, 0xE5, 0x84, 0x74,
+    0x44, 0x44, 0x9C, 0xA9, 0x80, 0x69, 0x14, 0xB7, 0x87, 0x61, 0xAD, 0xAC, 0x07, 0xCA, 0x01, 0x48,
+    0xAE, 0xAE, 0xF3, 0x5A, 0xFB, 0x29, 0x0B, 0x58, 0xA6, 0xC1, 0x76, 0xF3, 0xA8, 0x1C, 0xAE, 0x8A,
+    0x48, 0x6B, 0xC9, 0xAB, 0xC8, 0x52, 0x07, 0x3A, 0xE3, 0x13, 0x6F, 0x39, 0xBE, 0x4E, 0x7E, 0x33,
+    0x9E, 0x75, 0x86, 0xDF, 0x7B, 0x5F, 0x26, 0x12, 0x27, 0x2B, 0x92, 0x2D, 0x50, 0x22, 0x17, 0xA8,
+    0x45, 0xB0, 0x55, 0x1A, 0xB2, 0x96, 0x5C, 0x45, 0x54, 0x28, 0x1C, 0x46, 0x07, 0x70, 0xBB, 0x40,
+    0xDA, 0x2A, 0x47, 0x3D, 0xB1, 0x74, 0x1B, 0x0E, 0xD6, 0x61, 0xCC, 0x72, 0x96, 0xC9, 0x49, 0x5B,
+    0x91, 0x3E, 0x3E, 0x42, 0xCC, 0x7A, 0x4A, 0x5F, 0x88, 0x04, 0xCE, 0x49, 0x3F, 0xB9, 0x5D, 0x3F,
+    0x52, 0xE7, 0xDA, 0x07, 0xE4, 0xB7, 0x9D, 0xE2, 0xDF, 0x47, 0xF3, 0x52, 0x28, 0x1F, 0xAA, 0x0E,
+    0x47, 0x7E, 0x23, 0x7D, 0x2E, 0xD5, 0x6D, 0x73, 0x02, 0x89, 0x14, 0x72, 0x46, 0xC6, 0x99, 0x53,
+    0x95, 0x48, 0x8F, 0xF1, 0x1F, 0xF8, 0x9D, 0x57, 0xE4, 0x0E, 0x0B, 0x07, 0x24, 0x91, 0x22, 0x4C,
+    0xA9, 0xA1, 0x6B, 0x53, 0x55, 0x64, 0x3A, 0x5C, 0x05, 0x92, 0x60, 0x1A, 0x20, 0x69, 0xB3, 0x77,
+    0x1F, 0xF4, 0x7C, 0x68, 0xD6, 0x07, 0xF9, 0x57, 0xD0, 0x3E, 0x13, 0xF1, 0xA4, 0x3E, 0x7B, 0xED,
+    0x5C, 0x20, 0xF3, 0x59, 0x93, 0xF4, 0x98, 0x2A, 0x6B, 0x88, 0x18, 0x97, 0x35, 0x44, 0x8A, 0x89,
+    0x43, 0xBB, 0x41, 0xD6, 0x10, 0xBF, 0xBA, 0x22, 0x6B, 0x92, 0xBE, 0xEC, 0xC9, 0x9A, 0x3C, 0xD4,
+    0x81, 0x5A, 0xC4, 0x97, 0x55, 0x22, 0x72, 0x95, 0xBB, 0x6E, 0x25, 0xF3, 0xD6, 0x52, 0x51, 0x0E,
+    0x94, 0xC3, 0x94, 0xC7, 0x17, 0x6E, 0xEF, 0x70, 0x65, 0xEB, 0x7B, 0x57, 0x36, 0xD1, 0x22, 0x22,
+    0x72, 0x61, 0x3A, 0x74, 0x3A, 0xA0, 0x43, 0x12, 0xA7, 0xAF, 0x1C, 0x4C, 0x87, 0xDD, 0x9B, 0x0E,
+    0x73, 0xE1, 0xF4, 0x95, 0xAC, 0x2F, 0xC4, 0x15, 0x22, 0xAD, 0x88, 0x9B, 0xD6, 0xA5, 0xBA, 0xC5,
+    0xB1, 0xD6, 0x4C, 0xDD, 0x95, 0x5E, 0x87, 0xD4, 0x4F, 0xFD, 0x95, 0xA0, 0x83, 0xF6, 0xEB, 0x0E,
+    0x3B, 0xF5, 0xD5, 0x79, 0xFF, 0xE6, 0x3F, 0x5D, 0x60, 0x36, 0x46, 0xF4, 0xB8, 0x27, 0xA0, 0x03,
+    0xD6, 0xA1, 0xC3, 0x1C, 0x4F, 0xC8, 0xAB, 0xB9, 0xEB, 0xBE, 0x7B, 0x7F, 0x4E, 0xA8, 0x23, 0x22,
+    0xDF, 0x96, 0x38, 0x13, 0x25, 0x54, 0x00, 0xB2, 0x35, 0xFD, 0x4F, 0x8D, 0x87, 0x41, 0x8D, 0xD9,
+    0xA2, 0xA0, 0x96, 0x2A, 0xF7, 0xE5, 0x88, 0x6D, 0x74, 0x60, 0xF4, 0x3A, 0xA8, 0x80, 0x0E, 0xBA,
+    0x41, 0x87, 0xCC, 0xA3, 0x83, 0x01, 0x1D, 0x1E, 0x00, 0x7D, 0x65, 0x9B, 0x89, 0xEB, 0xAF, 0x7F,
+    0x7F, 0x30, 0x53, 0xAA, 0x75, 0xC8, 0x3D, 0x3A, 0x98, 0x16, 0x1D, 0x66, 0x99, 0xA1, 0xC3, 0x44,
+    0x88, 0x2B, 0xAB, 0x42, 0x5C, 0xD1, 0x8A, 0xB8, 0x2C, 0x4E, 0x74, 0x82, 0x29, 0x3E, 0xBE, 0xE4,
+    0x30, 0xCF, 0xB8, 0xE8, 0x38, 0x34, 0x6F, 0x8E, 0xBD, 0x9B, 0x9A, 0xFD, 0x8E, 0x34, 0xD4, 0xFD,
+    0xC4, 0xF1, 0xB3, 0x4C, 0x9D, 0x45, 0x47, 0x2C, 0x88, 0xD7, 0x01, 0x1B, 0xB1, 0x98, 0x5F, 0x7A,
+    0x1D, 0x74, 0x88, 0x58, 0xA2, 0xF1, 0x3A, 0x58, 0x22, 0xD6, 0x78, 0xE3, 0xF5, 0xDB, 0x81, 0x88,
+    0x8D, 0x18, 0xAF, 0x05, 0x22, 0xD6, 0x4F, 0x77, 0x58, 0xDF, 0xAC, 0x10, 0x97, 0xC9, 0x65, 0xE9,
+    0xD4, 0xFA, 0x81, 0x69, 0x9F, 0x7A, 0x54, 0x97, 0x04, 0xB0, 0x7F, 0xD7, 0x83, 0x9E, 0x52, 0xA3,
+    0x6E, 0x5D, 0x32, 0xC3, 0xCA, 0x4F, 0xE5, 0xC2, 0x09, 0xA9, 0x2C, 0x14, 0x64, 0xED, 0x64, 0x38,
+    0x65, 0x7E, 0xB2, 0xFD, 0x74, 0x50, 0x01, 0x0E, 0xE8, 0xC1, 0xF8, 0x6D, 0x50, 0xFD, 0x06, 0x60,
+    0x0D, 0x90, 0xBE, 0x51, 0x01, 0x53, 0xB6, 0x70, 0x7B, 0xF8, 0xB0, 0x2F, 0xAE, 0xC3, 0x4D, 0xCB,
+    0x9D, 0x75, 0x92, 0xCB, 0xC4, 0xFA, 0x3B, 0x75, 0x64, 0xF5, 0x97, 0x26, 0x97, 0x77, 0xA4, 0xD1,
+    0xD2, 0x1A, 0x8F, 0x69, 0xD6, 0x89, 0x76, 0x0C, 0x58, 0xB0, 0xEE, 0x4F, 0x28, 0x74, 0x94, 0xAE,
+    0x5E, 0xFB, 0x53, 0xC5, 0x4F, 0x46, 0xEE, 0x54, 0xB1, 0xB8, 0x8E, 0x31, 0x92, 0x39, 0xA6, 0xD5,
+    0xE9, 0xA6, 0x57, 0x05, 0x3D, 0xD8, 0x29, 0x71, 0xAA, 0x9C, 0xA8, 0x1E, 0x27, 0xFF, 0xA4, 0x24,
+    0x9F, 0x5B, 0xD7, 0x22, 0xD0, 0x1D, 0xE4, 0x22, 0x3E, 0xA9, 0xF7, 0x9E, 0x3A, 0x32, 0x31, 0xE6,
+    0xAF, 0x62, 0x4B, 0x71, 0x46, 0x9E, 0x0E, 0x3A, 0x32, 0x12, 0xC9, 0xBD, 0x45, 0x07, 0xE3, 0x19,
+    0x74, 0xA0, 0x70, 0x91, 0xAC, 0xB1, 0x24, 0x9D, 0xF1, 0xEC, 0xEB, 0x40, 0x91, 0x8A, 0x37, 0x97,
+    0x24, 0xE8, 0x75, 0xC2, 0xD5, 0xFE, 0x3C, 0x89, 0x15, 0x0E, 0xCA, 0x6A, 0x5A, 0xDC, 0xE7, 0x81,
+    0x99, 0xB1, 0xB8, 0x82, 0x12, 0xAC, 0xA3, 0x70, 0x18, 0x77, 0x63, 0xC9, 0xBC, 0x42, 0xE4, 0x25,
+    0x91, 0xAE, 0x78, 0x7C, 0x3B, 0x6D, 0x8C, 0xEA, 0xB4, 0xDF, 0xE1, 0xA9, 0xF7, 0x8E, 0x81, 0x25,
+    0xD2, 0x6B, 0x91, 0x89, 0x4F, 0x22, 0x55, 0xF9, 0x74, 0xBF, 0x41, 0x69, 0xC9, 0x9E, 0x74, 0x7C,
+    0xD7, 0x93, 0x5C, 0xD9, 0x72, 0x22, 0xAD, 0xDD, 0x7B, 0x2A, 0xF3, 0x24, 0xFD, 0xC4, 0x5F, 0xED,
+    0xF9, 0xFE, 0x91, 0xB4, 0xD4, 0x0F, 0x15, 0xAA, 0xF8, 0x90, 0x04, 0xE8, 0x9B, 0x16, 0xAD, 0x5B,
+    0xD3, 0x35, 0x5D, 0x3E, 0x90, 0x76, 0xA4, 0x0D, 0xB9, 0x63, 0x07, 0xF5, 0xEE, 0xD3, 0x13, 0xD2,
+    0xCE, 0xE9, 0xEE, 0x3E, 0xEB, 0x92, 0xC8, 0xBF, 0x39, 0x74, 0x9C, 0x6A, 0xF1, 0x5F, 0xF8, 0x23,
+    0x93, 0xDC, 0x06, 0x85, 0xCB, 0x7D, 0xD1, 0x94, 0xCD, 0x1D, 0x8E, 0x44, 0x44, 0x2A, 0x32, 0x91,
+    0x81, 0x69, 0xF6, 0x46, 0xFB, 0x1D, 0xC0, 0xA8, 0x0E, 0x38, 0x9F, 0x36, 0xA0, 0xDA, 0x5C, 0x3A,
+    0x32, 0x57, 0x3E, 0xDD, 0xB1, 0x50, 0x5D, 0x1A, 0x08, 0x69, 0x93, 0xF9, 0xB4, 0xCA, 0x5D, 0xCE,
+    0x92, 0x1D, 0x56, 0xFF, 0x36, 0xA8, 0x2E, 0x7D, 0x59, 0x5C, 0x71, 0x5D, 0xD2, 0x4E, 0x8B, 0x34,
+    0x13, 0xFC, 0xAA, 0x63, 0x26, 0x3E, 0x91, 0xD6, 0x8E, 0x73, 0x0A, 0x86, 0xEA, 0xB0, 0x90, 0x36,
+    0x44, 0xC8, 0x9D, 0x0E, 0xB0, 0xBB, 0xF5, 0x88, 0xBC, 0xAA, 0x44, 0x44, 0xFA, 0xF4, 0xB5, 0xAD,
+    0xA8, 0xBB, 0xDC, 0xE9, 0xA0, 0xDB, 0x1D, 0x8C, 0x37, 0x8F, 0x77, 0x58, 0x36, 0xD2, 0x86, 0xA8,
+    0x43, 0xDD, 0xE5, 0x22, 0x0F, 0x49, 0x23, 0xD2, 0x1E, 0x21, 0x45, 0xBD, 0x67, 0xAE, 0x42, 0x24,
+    0xA9, 0xF7, 0x9E, 0x3A, 0xCA, 0xE2, 0x7B, 0xAE, 0x76, 0x58, 0x2B, 0x1E, 0xB9, 0x26, 0x4E, 0x0F,
+    0xD4, 0x1F, 0x22, 0x57, 0x61, 0xB6, 0x63, 0x29, 0x6F, 0x00, 0xA2, 0xD4, 0x1F, 0x65, 0xB8, 0x9D,
+    0xAC, 0x63, 0xD2, 0xD7, 0x7D, 0xD6, 0x67, 0x4D, 0xEE, 0xD2, 0x66, 0x49, 0xDA, 0x9C, 0x27, 0x6D,
+    0x02, 0xE9, 0xEB, 0x0D, 0xA9, 0xB4, 0xA4, 0xBF, 0xEE, 0x48, 0x9B, 0x48, 0xDA, 0xEC, 0x92, 0x36,
+    0xD6, 0xA5, 0x8D, 0xF1, 0x45, 0x9F, 0x06, 0x19, 0xD4, 0x00, 0x9C, 0xE2, 0x33, 0x6B, 0xBA, 0x96,
+    0x75, 0x73, 0x40, 0x2A, 0x0D, 0x6B, 0xF7, 0xD3, 0xA9, 0xA3, 0xA9, 0xB3, 0xDE, 0x4A, 0xDD, 0x6B,
+    0x69, 0xF6, 0xD1, 0x6D, 0xDA, 0x30, 0xB0, 0x83, 0x6D, 0xD2, 0xC6, 0xEC, 0xB3, 0xA3, 0x5F, 0x6C,
+    0xD2, 0xA6, 0x5B, 0xB2, 0xB3, 0xD4, 0x4D, 0x7A, 0xD9, 0x2D, 0x29, 0xBD, 0x6E, 0xD2, 0xC0, 0x92,
+    0x1D, 0x74, 0x53, 0xF4, 0x4A, 0x2E, 0x4B, 0x63, 0x85, 0x56, 0x57, 0x14, 0x2C, 0x49, 0xBA, 0xCC,
+    0x63, 0xAE, 0xF7, 0x70, 0xFA, 0xFF, 0x7C, 0xD4, 0xAB, 0x7E, 0xB4, 0x37, 0xB8, 0xC8, 0x69, 0xDA,
+    0x82, 0xF4, 0xF3, 0xB8, 0xFA, 0xD7, 0x00, 0xF5, 0x90, 0xC9, 0x4B, 0x52, 0xD5, 0x7D, 0xD6, 0x10,
+    0xD9, 0xC1, 0xF8, 0xF4, 0x36, 0x4F, 0x12, 0x11, 0x19, 0x44, 0x44, 0x5A, 0x8A, 0xF5, 0xBC, 0x9A,
+    0xCF, 0xA1, 0x2D, 0xEE, 0x5C, 0xEB, 0xC6, 0x0F, 0xF6, 0xDC, 0xB4, 0x84, 0xE2, 0x1A, 0x2F, 0x7B,
+    0xF8, 0xFA, 0xCF, 0xAF, 0xED, 0x55, 0xB9, 0x88, 0x84, 0xF4, 0xB5, 0x72, 0x6B, 0xA5, 0x5A, 0xE3,
+    0x0D, 0x8F, 0xE9, 0xA0, 0xFD, 0x67, 0x88, 0xB8, 0xF5, 0x37, 0xFF, 0x79, 0x13, 0xB4, 0x48, 0x3B,
+    0x2F, 0x70, 0x69, 0xC9, 0xDB, 0x49, 0x3D, 0x74, 0x98, 0xA0, 0x9D, 0xF1, 0x93, 0xA6, 0x18, 0x9F,
+    0xF4, 0x13, 0x67, 0x3C, 0x13, 0x89, 0x64, 0x22, 0xAF, 0xAE, 0x89, 0x03, 0x90, 0x8E, 0xF3, 0xD2,
+    0x1D, 0x1B, 0x37, 0xB6, 0x5A, 0xC4, 0x8B, 0x88, 0x0F, 0x1B, 0xDA, 0x87, 0x0D, 0x5D, 0x1D, 0x7E,
+    0x66, 0xA5, 0xC1, 0x4A, 0x64, 0x83, 0x03, 0x36, 0xB0, 0xF3, 0xB6, 0xC1, 0x06, 0xFB, 0x89, 0x5C,
+    0xEE, 0xB3, 0xC3, 0xC4, 0xED, 0x1B, 0x4C, 0x9A, 0xF1, 0x5D, 0x4C, 0x9A, 0x52, 0x77, 0x37, 0x33,
+    0x69, 0x8A, 0x0A, 0xF2, 0x17, 0x44, 0x44, 0xDE, 0x12, 0x11, 0xB9, 0xC1, 0x9E, 0x9A, 0x99, 0x34,
+    0x03, 0xE8, 0xF0, 0x47, 0x99, 0x34, 0xEF, 0xC1, 0x94, 0x59, 0xA2, 0xFA, 0x15, 0xC4, 0xFD, 0xAD,
+    0xAD, 0x28, 0x22, 0x71, 0xD8, 0xDA, 0x8A, 0xFB, 0x13, 0x3D, 0xAB, 0xB7, 0x24, 0xEF, 0xC9, 0x15,
+    0x3A, 0xF1, 0x5D, 0x89, 0xA4, 0x43, 0x39, 0x3A, 0xA4, 0xB1, 0x50, 0xFC, 0x37, 0xDD, 0xA3, 0x5B,
+    0x72, 0xCF, 0x6A, 0x16, 0x6A, 0xD6, 0xD0, 0x41, 0x49, 0xC1, 0x04, 0x63, 0x28, 0xDC, 0x12, 0xE8,
+    0x53, 0x0F, 0xC6, 0xAF, 0x80, 0x7D, 0xE3, 0x40, 0xBF, 0x1C, 0x00, 0x5B, 0x00, 0xEA, 0x9D, 0x66,
+    0xBD, 0x70, 0xDC, 0x94, 0x3F, 0x92, 0xDE, 0xB0, 0x90, 0xD6, 0xE3, 0x69, 0x2A, 0x2D, 0x43, 0x39,
+    0x60, 0xDB, 0x81, 0xEC, 0xFF, 0xA6, 0x2D, 0x1D, 0x96, 0x9C, 0xA4, 0xD3, 0x0D, 0xA6, 0x5A, 0x40,
+    0xCC, 0x2A, 0xD2, 0xA6, 0x83, 0x8D, 0x1C, 0x92, 0xB7, 0x5A, 0x30, 0xDB, 0x33, 0x42, 0x48, 0xBB,
+    0x5B, 0xEE, 0x06, 0x2C, 0xD9, 0x06, 0xD5, 0x27, 0x1D, 0xE8, 0xAB, 0xE7, 0x3C, 0x24, 0x93, 0x3D,
+    0x78, 0x8A, 0xF7, 0x4E, 0x6A, 0x2B, 0xC6, 0x39, 0x49, 0x22, 0x32, 0xA9, 0x8D, 0x9E, 0x34, 0x28,
+    0x60, 0xD1, 0xE2, 0x89, 0x58, 0xCB, 0x84, 0x9D, 0x8C, 0xB7, 0x3A, 0x60, 0x75, 0x30, 0x9E, 0x68,
+    0xB1, 0x4C, 0xE0, 0xC9, 0x08, 0x3A, 0x60, 0x03, 0xC6, 0xCF, 0x36, 0x63, 0x98, 0x25, 0xA6, 0xBB,
+    0x44, 0x3A, 0x6A, 0x99, 0x13, 0xB8, 0x60, 0x4E, 0xB8, 0x98, 0x02, 0xCA, 0xFD, 0x84, 0xA6, 0x00,
+    0xEE, 0x07, 0xE0, 0x51, 0x78, 0x4C, 0xB5, 0xE8, 0x36, 0xF3, 0x18, 0x6F, 0xC1, 0xBC, 0xD1, 0xC1,
+    0x89, 0xAB, 0x47, 0x7D, 0xBD, 0x82, 0xC4, 0xBA, 0xD7, 0xD2, 0x14, 0x8E, 0x9E, 0x1D, 0x4C, 0xA3,
+    0x3A, 0xC4, 0xA5, 0x8D, 0xD9, 0x27, 0x77, 0x5D, 0xC7, 0x8E, 0x39, 0xD3, 0xA8, 0xAE, 0x33, 0x2E,
+    0xBD, 0xEC, 0x96, 0xE4, 0x81, 0x8E, 0x12, 0xDD, 0xA8, 0x0E, 0xE3, 0x8A, 0x5E, 0xC9, 0x2B, 0xD2,
+    0x19, 0x59, 0x33, 0x55, 0x6F, 0x64, 0x27, 0x2E, 0xA6, 0x25, 0x70, 0x6E, 0xC4, 0xF8, 0x46, 0xA6,
+    0x5C, 0x01, 0xE3, 0xE7, 0x31, 0x55, 0xC4, 0x61, 0xA5, 0xBB, 0x51, 0x82, 0x91, 0x7F, 0x05, 0x91,
+    0x01, 0xF3, 0xCF, 0xE7, 0x3A, 0x22, 0x85, 0x37, 0x9E, 0x48, 0x24, 0x6B, 0x8C, 0x67, 0x9F, 0x38,
+    0xE5, 0xB3, 0x46, 0xA2, 0xAA, 0xA9, 0x45, 0xFC, 0x8D, 0x15, 0x0E, 0x36, 0xA1, 0xF6, 0xD3, 0xEC,
+    0x70, 0xC3, 0x80, 0x4D, 0x65, 0x24, 0x97, 0xFE, 0x5D, 0xE6, 0xAD, 0x88, 0x33, 0xD7, 0xC4, 0x59,
+    0x2C, 0x91, 0x95, 0x0E, 0x2A, 0x18, 0x9F, 0x79, 0xCB, 0x6E, 0x2A, 0x75, 0xB0, 0xEB, 0xD0, 0xF9,
+    0xD6, 0x26, 0xB5, 0x48, 0x55, 0x5E, 0xAB, 0x3B, 0x1D, 0xD2, 0x38, 0x5B, 0x1D, 0xFB, 0xD3, 0xB6,
+    0xB9, 0xAF, 0x43, 0x88, 0x3A, 0xFC, 0x8F, 0x5E, 0x07, 0x3B, 0xAF, 0x98, 0x76, 0xDD, 0xEB, 0x90,
+    0x34, 0x3A, 0x4C, 0x2B, 0xF4, 0x1C, 0xDD, 0x0A, 0xA9, 0xA6, 0x05, 0x8F, 0x38, 0xCE, 0x89, 0xAE,
+    0xEC, 0xB3, 0xB1, 0x16, 0x7F, 0x6E, 0x38, 0xDD, 0xEB, 0x8E, 0x9A, 0x88, 0x69, 0x2C, 0x49, 0x6F,
+    0x3C, 0xBB, 0x3A, 0x90, 0x57, 0xF1, 0x58, 0xDA, 0xD8, 0xF4, 0x47, 0xC1, 0xF8, 0x2E, 0xEA, 0x60,
+    0xF6, 0x19, 0x12, 0x59, 0xE7, 0xBC, 0x7B, 0x1D, 0x38, 0x4F, 0xE4, 0x8E, 0x43, 0x7F, 0x46, 0x7A,
+    0x05, 0x72, 0x09, 0x9C, 0x98, 0x17, 0x53, 0x7A, 0x14, 0x92, 0x66, 0xA2, 0xBB, 0xEE, 0xD6, 0x22,
+    0x57, 0x44, 0xA4, 0xB1, 0xA8, 0xDB, 0x36, 0xFB, 0xDF, 0xD7, 0x0B, 0x70, 0xEC, 0x70, 0x75, 0xD8,
+    0xED, 0x5A, 0xA4, 0x10, 0xF1, 0xBB, 0x6C, 0xE6, 0x15, 0x69, 0x8B, 0xEA, 0xA7, 0x6C, 0xA0, 0x77,
+    0x5F, 0x64, 0xD2, 0x9A, 0xD9, 0x81, 0x57, 0x88, 0x8C, 0xB9, 0xC8, 0x48, 0x64, 0x97, 0xC8, 0x72,
+    0xDE, 0xEE, 0x23, 0x72, 0x6A, 0x9D, 0xB9, 0x64, 0x65, 0xC0, 0xCA, 0x70, 0x98, 0xC9, 0xF4, 0x5E,
+    0x5B, 0x26, 0x01, 0x2B, 0x81, 0x5A, 0xE4, 0x9C, 0x48, 0x73, 0x70, 0x3C, 0xE4, 0x6E, 0x91, 0x36,
+    0x46, 0x75, 0xC9, 0xDF, 0x1C, 0x9C, 0xD5, 0x22, 0x3C, 0xFC, 0x9A, 0xBB, 0x09, 0x26, 0x1E, 0xA9,
+    0x44, 0x26, 0x22, 0x55, 0x29, 0xD2, 0x63, 0x27, 0x50, 0xD2, 0x61, 0xC9, 0xD0, 0x81, 0xCD, 0x23,
+    0x39, 0x3B, 0x3F, 0xFC, 0xD9, 0xE4, 0xBB, 0xB1, 0x7B, 0xD2, 0xE8, 0xA0, 0x04, 0x3B, 0xAD, 0x3D,
+    0x92, 0x7B, 0x3B, 0xAD, 0x30, 0x62, 0x0E, 0x4F, 0x9E, 0x97, 0x8E, 0x38, 0x7B, 0x6C, 0x92, 0xF5,
+    0xF8, 0x61, 0x9A, 0xC9, 0xF8, 0x2B, 0x87, 0xC9, 0x57, 0x53, 0x8B, 0xF8, 0x5A, 0xC4, 0x67, 0xED,
+    0x17, 0x7C, 0xDA, 0xE8, 0x2A, 0x6D, 0x14, 0x69, 0x03, 0xE9, 0x1B, 0x23, 0xA9, 0x48, 0x93, 0xB6,
+    0xA7, 0x43, 0xDA, 0x24, 0x7D, 0xDA, 0x10, 0xD7, 0x5B, 0x31, 0xB0, 0x92, 0xF1, 0xB0, 0xE1, 0xFD,
+    0x74, 0x7B, 0x1D, 0x20, 0xF7, 0x64, 0x02, 0xC9, 0xAB, 0xFC, 0x7F, 0xC5, 0xBC, 0x4F, 0x8C, 0x25,
+    0xC7, 0x9D, 0xE7, 0xF7, 0x89, 0x0C, 0x56, 0xC7, 0x8A, 0x09, 0x29, 0x7A, 0x8D, 0xA6, 0xAC, 0x21,
+    0xD9, 0x4C, 0x1E, 0x64, 0xC0, 0xD2, 0x90, 0x95, 0x7B, 0xA0, 0x01, 0x02, 0xAE, 0x7A, 0x19, 0x64,
+    0xDB, 0x10, 0x60, 0xC1, 0x56, 0x01, 0xDB, 0x35, 0x5A, 0x2C, 0xBD, 0xA0, 0x0E, 0xEB, 0xC3, 0x68,
+    0xED, 0x6D, 0x1D, 0x1A, 0x6B, 0xC2, 0xA8, 0xAA, 0x97, 0x24, 0x77, 0xA0, 0x03, 0x0F, 0x6A, 0x63,
+    0x57, 0x33, 0x07, 0x63, 0xBD, 0x04, 0x2C, 0xD9, 0x52, 0xD1, 0x56, 0xD3, 0x36, 0x0D, 0xB4, 0x77,
+    0x5F, 0x55, 0x46, 0x77, 0x63, 0x4D, 0xC0, 0x3A, 0x30, 0x28, 0x5A, 0xC3, 0x03, 0x0F, 0x93, 0x23,
+    0x91, 0x6A, 0x83, 0x3D, 0x30, 0x83, 0xAD, 0xA4, 0x94, 0xDD, 0x8C, 0x7C, 0x3F, 0x1F, 0x32, 0x5F,
+    0x55, 0x77, 0x53, 0xD2, 0x88, 0xFA, 0x33, 0x9B, 0x78, 0x99, 0x2F, 0x5F, 0x66, 0xBE, 0x88, 0xF8,
+    0xC5, 0x9F, 0xDF, 0x9F, 0xEF, 0xEF, 0xF7, 0x4B, 0xE5, 0x00, 0x4E, 0x66, 0x49, 0xC9, 0x92, 0x86,
+    0xC6, 0x97, 0x4B, 0xE6, 0xBE, 0xEC, 0x48, 0x54, 0x2F, 0x53, 0x50, 0x51, 0x82, 0x6E, 0xAD, 0x2F,
+    0x80, 0x0D, 0x1D, 0x6D, 0x0D, 0x79, 0x9D, 0x8C, 0x07, 0x62, 0xA5, 0x03, 0x50, 0x3C, 0xFD, 0xE7,
+    0x11, 0x30, 0x22, 0x3D, 0xA0, 0x6F, 0x2E, 0xCF, 0x39, 0xC8, 0xBA, 0x4A, 0x47, 0x20, 0x59, 0x7F,
+    0x08, 0x0C, 0x3A, 0xDA, 0x00, 0x0D, 0x49, 0x25, 0x98, 0x53, 0x51, 0xD5, 0x54, 0xB5, 0xF5, 0xA6,
+    0xA3, 0xF2, 0x3A, 0xD2, 0xB8, 0x2A, 0xE4, 0xD2, 0xDA, 0xAE, 0x0A, 0x46, 0x7A, 0xE4, 0x4F, 0x1C,
+    0x80, 0x89, 0x00, 0x90, 0xC6, 0xAF, 0xD9, 0xF8, 0x95, 0x3B, 0x00, 0xB2, 0x30, 0xFE, 0xFC, 0x3B,
+    0xF7, 0x00, 0xB8, 0xB2, 0x9E, 0x27, 0x13, 0xCB, 0x76, 0xDE, 0x15, 0x51, 0x75, 0xB9, 0x9F, 0xC1,
+    0x4E, 0xEE, 0x2F, 0xC1, 0xA3, 0xB9, 0x8F, 0x60, 0xF3, 0x2B, 0x2D, 0xE4, 0xFF, 0xDD, 0x9B, 0x1E,
+    0xAC, 0x88, 0x87, 0xE2, 0x8B, 0x57, 0x23, 0xCC, 0xF2, 0xCB, 0x1D, 0x2C, 0x72, 0x9F, 0x50, 0x7D,
+    0xEE, 0xF7, 0xD0, 0x31, 0xF7, 0x95, 0xB3, 0xA1, 0x7C, 0xDB, 0x86, 0x79, 0xDD, 0x24, 0x93, 0x4E,
+    0x1D, 0x37, 0x61, 0x01, 0xC0, 0x25, 0x00, 0x9E, 0x01, 0xE0, 0xB1, 0xB1, 0x11, 0xDC, 0x7F, 0x81,
+    0x52, 0xFA, 0x4C, 0x2E, 0x26, 0x1B, 0x74, 0x37, 0x23, 0x6F, 0x3B, 0x8A, 0xE7, 0x3C, 0x7B, 0x90,
+    0x45, 0xB0, 0x35, 0xDB, 0x09, 0x23, 0x2D, 0x56, 0x22, 0x14, 0x11, 0x6C, 0x80, 0xB2, 0x86, 0xC3,
+    0x67, 0xD0, 0x3F, 0x8F, 0xD8, 0xD7, 0x3A, 0x96, 0xC5, 0xB2, 0x69, 0xAD, 0x0C, 0xA8, 0x73, 0x35,
+    0xAC, 0x8F, 0x55, 0xBD, 0xD9, 0x62, 0x04, 0xF2, 0x16, 0x58, 0x83, 0x66, 0x89, 0x48, 0xFB, 0x8C,
+    0x4A, 0xF7, 0x50, 0x41, 0xEE, 0xD1, 0x41, 0xBD, 0x14, 0xA8, 0x06, 0x28, 0x3C, 0xAA, 0x87, 0xD9,
+    0x23, 0x14, 0xDF, 0xF0, 0xF6, 0x8A, 0x34, 0xA1, 0x94, 0xC0, 0xD3, 0x8E, 0x2C, 0xC0, 0x2B, 0xD8,
+    0x05, 0x7A, 0x80, 0x53, 0x00, 0x28, 0x1A, 0xA9, 0x0B, 0x3F, 0x5F, 0x52, 0x05, 0x1D, 0x59, 0x7A,
+    0x1D, 0x55, 0x44, 0x47, 0x1D, 0xD0, 0x31, 0xF7, 0xE8, 0x68, 0x41, 0xC7, 0x75, 0xD0, 0x1F, 0xEC,
+    0x80, 0x96, 0x04, 0xFA, 0x67, 0x87, 0xA0, 0x63, 0x05, 0x3A, 0x16, 0x1E, 0x1D, 0x6D, 0x8B, 0x8E,
+    0x3A, 0xA2, 0x63, 0x96, 0xD0, 0x91, 0x25, 0x3A, 0x32, 0xAF, 0x4B, 0x71, 0x65, 0x2B, 0xE2, 0xF2,
+    0x74, 0xD4, 0x73, 0x8B, 0xA3, 0xC3, 0x0E, 0xC0, 0xE3, 0x00, 0x9F, 0x05, 0x4E, 0x36, 0x29, 0xEB,
+    0x9B, 0x3E, 0xEF, 0xF3, 0x50, 0x38, 0x13, 0x36, 0x31, 0xE1, 0x19, 0x4C, 0x88, 0x98, 0x6B, 0x01,
+    0x23, 0x2D, 0xE6, 0x07, 0x1D, 0x26, 0x24, 0x4C, 0xD8, 0xC3, 0x84, 0xCA, 0x99, 0x60, 0x7D, 0xD9,
+    0x9B, 0x28, 0x43, 0xB6, 0x9C, 0xA6, 0xC4, 0x0C, 0xD8, 0x04, 0x1E, 0x05, 0x1E, 0x9C, 0x86, 0x03,
+    0x57, 0x4A, 0x9B, 0x25, 0x23, 0xAD, 0x12, 0xAC, 0x67, 0xE9, 0x75, 0x64, 0x07, 0x12, 0x9B, 0x50,
+    0x3D, 0x58, 0x80, 0xFD, 0xFE, 0x17, 0x1D, 0xFA, 0xC6, 0x1B, 0x1E, 0x86, 0x7F, 0xD5, 0x42, 0x25,
+    0x3D, 0xD8, 0xB7, 0x1A, 0xD0, 0x37, 0xDE, 0x6C, 0x21, 0xBD, 0x32, 0x40, 0xF5, 0x68, 0xE1, 0xB1,
+    0x97, 0x75, 0x8F, 0x8E, 0xCC, 0x21, 0x91, 0x47, 0x2A, 0x58, 0xD2, 0x0C, 0x14, 0xAD, 0x88, 0x53,
+    0x4B, 0xC6, 0x71, 0x81, 0x93, 0xA5, 0x50, 0xE5, 0x52, 0x57, 0xBE, 0xA4, 0x38, 0x69, 0xBC, 0x45,
+    0xDD, 0x78, 0xB5, 0x66, 0xE7, 0x7F, 0xF7, 0x14, 0x7B, 0x2D, 0x46, 0x12, 0xEA, 0xC6, 0x6B, 0x35,
+    0x3B, 0xFF, 0x5B, 0xA4, 0x78, 0x64, 0x86, 0xF1, 0xD6, 0xAB, 0xA8, 0x52, 0x26, 0x75, 0x79, 0x55,
+    0xA2, 0x4E, 0x4C, 0x83, 0xF3, 0x8B, 0xC7, 0x46, 0xE4, 0x4C, 0x40, 0xE4, 0x8B, 0xBF, 0xCB, 0xB1,
+    0xD9, 0x52, 0x5B, 0x50, 0x46, 0x98, 0x47, 0xD0, 0xC7, 0xFB, 0xC9, 0xB9, 0x3C, 0x91, 0xE6, 0xF2,
+    0x85, 0xA4, 0xA3, 0xFD, 0xA7, 0x3A, 0xAE, 0xA3, 0xE3, 0x06, 0x3A, 0x76, 0xE8, 0x9F, 0x45, 0xB4,
+    0x44, 0xF4, 0xFB, 0x3D, 0x3A, 0x2E, 0xD0, 0xB1, 0x42, 0xC7, 0xB2, 0xD6, 0xD1, 0x86, 0x62, 0x30,
+    0x5D, 0x25, 0x6A, 0x58, 0x91, 0xB1, 0x96, 0x89, 0x24, 0x0E, 0xAD, 0x48, 0xC8, 0xD3, 0x4C, 0x25,
+    0xE6, 0x2F, 0x76, 0x26, 0xEA, 0x56, 0xFB, 0xC2, 0x17, 0x18, 0xE6, 0x74, 0xA0, 0x52, 0xEE, 0xC1,
+    0xC4, 0x0D, 0xA0, 0xF8, 0xF3, 0x16, 0x98, 0x4B, 0x0D, 0x6A, 0x68, 0x00, 0x13, 0xF7, 0x80, 0xC2,
+    0x0F, 0xC0, 0x9C, 0x04, 0x2A, 0x65, 0x3D, 0x98, 0xA8, 0x3B, 0x28, 0xBC, 0xE9, 0x60, 0x8E, 0x8D,
+    0x3C, 0x20, 0xDE, 0x46, 0x44, 0xB0, 0x1D, 0xC0, 0x9A, 0x03, 0x54, 0x2E, 0x4B, 0x95, 0x44, 0xC2,
+    0xFC, 0xB5, 0x3F, 0x8B, 0xF6, 0x9F, 0xC6, 0x2A, 0x6B, 0xAD, 0x8E, 0x1B, 0xBC, 0x5C, 0x59, 0x87,
+    0xFE, 0x59, 0x84, 0x4A, 0x40, 0xBF, 0xDF, 0x43, 0x95, 0x87, 0xB1, 0xEB, 0xAA, 0xAC, 0x47, 0x47,
+    0x1B, 0x94, 0xB4, 0x73, 0x57, 0x89, 0x5A, 0x02, 0x6A, 0xE2, 0x36, 0x32, 0x30, 0x97, 0x57, 0x25,
+    0x20, 0x37, 0x49, 0x50, 0x3A, 0x1D, 0xE1, 0x00, 0xEB, 0xC9, 0x3A, 0x2A, 0xC8, 0xC3, 0x1D, 0x97,
+    0x7F, 0xB8, 0xFD, 0xE5, 0x8E, 0x4A, 0x44, 0x02, 0x22, 0x22, 0x7F, 0xCD, 0xD3, 0xC7, 0x97, 0x73,
+    0x09, 0x4A, 0x92, 0x88, 0x2B, 0xA4, 0x83, 0x91, 0x4B, 0x40, 0x79, 0xCC, 0x7D, 0x54, 0x04, 0xD0,
+    0x35, 0xC0, 0x27, 0x68, 0x06, 0x23, 0x37, 0x24, 0x16, 0xE2, 0x0E, 0x31, 0xAD, 0xEA, 0x28, 0x6A,
+    0x13, 0xD8, 0xA3, 0x70, 0xAA, 0x67, 0x6F, 0xFB, 0xA9, 0x56, 0x89, 0x48, 0x6D, 0xDE, 0xD9, 0x3E,
+    0x1C, 0x2F, 0xED, 0xDE, 0xF1, 0x54, 0xD3, 0xE5, 0xF2, 0x17, 0xD2, 0xCE, 0xA5, 0x06, 0x76, 0x01,
+    0x3A, 0x40, 0x7B, 0xC0, 0x02, 0x3C, 0xC2, 0xF1, 0x36, 0x76, 0xC0, 0xD8, 0x03, 0x22, 0x63, 0xEB,
+    0x17, 0x3A, 0xC2, 0x81, 0x8A, 0xD6, 0x93, 0x75, 0xA6, 0xAE, 0x20, 0x0F, 0x0F, 0x8E, 0xB7, 0x18,
+    0x29, 0x9B, 0x3A, 0x62, 0xEA, 0x89, 0xB1, 0x2B, 0x8E, 0x6E, 0x79, 0xB2, 0x8E, 0xA9, 0x37, 0xEE,
+    0xFA, 0xD7, 0xED, 0xB7, 0x72, 0x09, 0x4A, 0x7A, 0x44, 0x5C, 0x21, 0x91, 0x66, 0x30, 0x22, 0x17,
+    0x45, 0x89, 0xB4, 0x87, 0x98, 0x77, 0x2E, 0x15, 0x4E, 0xF5, 0x0F, 0x99, 0xC0, 0x9E, 0x79, 0xA2,
+    0xA3, 0x78, 0xD6, 0xEF, 0x6D, 0x3F, 0xD5, 0x52, 0x88, 0xF4, 0x98, 0x77, 0xB6, 0x0F, 0x51, 0x1D,
+    0x45, 0xCD, 0x2E, 0xA6, 0x1D, 0x3B, 0xC0, 0x04, 0xF6, 0xC8, 0xC5, 0x35, 0xBD, 0x95, 0x76, 0x2E,
+    0x2B, 0xEA, 0x4A, 0x11, 0x11, 0x8F, 0x11, 0x11, 0xB9, 0x00, 0xD6, 0x53, 0x3A, 0xD0, 0x91, 0x3C,
+    0x00, 0x89, 0xAC, 0x03, 0x2A, 0x38, 0xE0, 0x17, 0xDD, 0xBC, 0xF5, 0xAF, 0x1C, 0x15, 0x34, 0x32,
+    0x60, 0x3D, 0xE5, 0xBB, 0xD2, 0xEA, 0x48, 0x1E, 0xF4, 0x30, 0xFE, 0xB3, 0xAA, 0x2B, 0x38, 0xC0,
+    0xC4, 0xF1, 0x9F, 0x69, 0xFC, 0x67, 0xE5, 0x12, 0x59, 0x87, 0xF5, 0x15, 0x1C, 0xA0, 0x63, 0x33,
+    0x28, 0x49, 0x24, 0x11, 0x27, 0x42, 0x35, 0x35, 0x6B, 0x9C, 0x7C, 0xD6, 0x73, 0x3C, 0x17, 0x28,
+    0x5B, 0x00, 0x23, 0xE3, 0xAF, 0x43, 0x47, 0x23, 0x22, 0x2D, 0xB9, 0x88, 0x0C, 0x90, 0xB7, 0x1C,
+    0x00, 0xBB, 0xE4, 0x01, 0x4C, 0x38, 0xFA, 0xF1, 0x5F, 0x60, 0x02, 0x07, 0x92, 0xD8, 0x25, 0x17,
+    0x89, 0x26, 0xD0, 0xB8, 0xAA, 0xDE, 0x25, 0x0F, 0x2A, 0x99, 0xC0, 0x01, 0x36, 0xEC, 0x92, 0x07,
+    0x0E, 0x4C, 0xE0, 0x00, 0xF3, 0x03, 0x09, 0x65, 0x62, 0x57, 0x06, 0x23, 0x21, 0x0F, 0xB7, 0x09,
+    0xBF, 0xB1, 0x2D, 0xAA, 0x83, 0xB1, 0x47, 0x80, 0x22, 0x00, 0xCC, 0x3B, 0x80, 0xEC, 0x6D, 0xE0,
+    0xD3, 0x00, 0xC5, 0x00, 0x98, 0x9B, 0xEA, 0x5B, 0x30, 0x67, 0xDE, 0xA3, 0xA3, 0xF9, 0x49, 0x4F,
+    0xC5, 0x2C, 0xEB, 0x54, 0x9F, 0x45, 0xDD, 0x5A, 0x6F, 0xBD, 0xF5, 0x15, 0x33, 0x2A, 0xD5, 0xAB,
+    0x9E, 0x45, 0xDE, 0x9A, 0x36, 0x8B, 0x65, 0x5D, 0xD4, 0xD6, 0x1F, 0x32, 0xA3, 0x52, 0x89, 0x44,
+    0x6F, 0xA2, 0x8E, 0x26, 0xD8, 0x60, 0x42, 0x49, 0xE9, 0xAD, 0xEF, 0xA8, 0x7C, 0xF1, 0x8D, 0x9A,
+    0x2A, 0x94, 0x3D, 0x54, 0xB7, 0x9A, 0x77, 0xFE, 0x73, 0x0A, 0xB9, 0x2E, 0x01, 0xB6, 0xD8, 0x1A,
+    0x57, 0xAC, 0xB9, 0x09, 0xBA, 0x7B, 0xA0, 0xA6, 0xB7, 0x8D, 0x2B, 0x75, 0xBB, 0xD0, 0x61, 0xC7,
+    0x84, 0x9D, 0xDC, 0xCF, 0x72, 0x9F, 0x74, 0x9B, 0x6C, 0x3D, 0xB3, 0x3E, 0xE9, 0xB0, 0xC8, 0xFD,
+    0x86, 0x09, 0x3B, 0xB9, 0xAF, 0x74, 0xDB, 0x65, 0x7D, 0xB1, 0x47, 0xFE, 0x41, 0x73, 0xB9, 0x2E,
+    0x44, 0x7A, 0xEE, 0x73, 0x67, 0x81, 0x6D, 0x47, 0x26, 0xE2, 0x72, 0x91, 0x90, 0x77, 0xAA, 0x33,
+    0x2D, 0x9B, 0x3A, 0x62, 0x9F, 0xEC, 0xC8, 0x7C, 0x9A, 0xBA, 0xA0, 0xA8, 0x47, 0xF9, 0x9C, 0xF5,
+    0xC0, 0x21, 0x50, 0xFA, 0x49, 0x79, 0x19, 0x80, 0xCA, 0x83, 0x19, 0x80, 0xE6, 0xE6, 0x1F, 0xBD,
+    0x92, 0x8B, 0x24, 0x4A, 0xE9, 0xC7, 0xB1, 0x35, 0x7E, 0x5C, 0xD0, 0xFF, 0x41, 0x0F, 0x36, 0x4D,
+    0x05, 0x28, 0x47, 0xB9, 0xA4, 0x92, 0x58, 0x31, 0x94, 0x14, 0x5F, 0xAA, 0xF5, 0xD7, 0x03, 0x59,
+    0x84, 0xB4, 0x5A, 0x11, 0x59, 0x82, 0xAA, 0xC6, 0xDE, 0x64, 0x4B, 0xA4, 0xCF, 0xA5, 0x27, 0xBF,
+    0x80, 0x6A, 0xE1, 0x19, 0xEC, 0x01, 0x7A, 0xB9, 0x12, 0xF2, 0xE4, 0x22, 0xB2, 0x14, 0x11, 0x79,
+    0xAF, 0xAE, 0xDC, 0xAC, 0xD3, 0x9D, 0xFE, 0x0B, 0x2A, 0xF7, 0xE8, 0xD7, 0x74, 0x97, 0xD5, 0x54,
+    0x0E, 0x74, 0x07, 0x1F, 0xEB, 0xE4, 0x84, 0x0C, 0x20, 0xD2, 0x32, 0xAE, 0x85, 0x3C, 0x4C, 0x22,
+    0x5D, 0x7B, 0x60, 0x03, 0xC8, 0x6A, 0x1A, 0x91, 0x9F, 0x8A, 0xC8, 0x6B, 0x7F, 0x7A, 0xF3, 0xE9,
+    0x0D, 0x13, 0x36, 0x62, 0xE1, 0x6E, 0xF8, 0x5D, 0xED, 0x54, 0x07, 0x26, 0x40, 0xE1, 0x60, 0x77,
+    0x9C, 0x42, 0x26, 0x40, 0x51, 0x73, 0x42, 0x3A, 0xE6, 0xD2, 0x82, 0xAD, 0x47, 0x71, 0xDE, 0x41,
+    0xE6, 0xC1, 0x1C, 0xB3, 0x9F, 0x46, 0x7C, 0xB3, 0x9C, 0x2F, 0x39, 0xD7, 0xEB, 0x8E, 0xDC, 0x67,
+    0x09, 0x5B, 0x33, 0x50, 0xC2, 0x9C, 0x4D, 0x28, 0xDD, 0x02, 0xEC, 0xE5, 0x08, 0xF9, 0x8F, 0x5B,
+    0xD0, 0x3F, 0xF7, 0xA0, 0xC4, 0x01, 0x02, 0xB0, 0xF7, 0xAB, 0x0E, 0xB9, 0xF4, 0x50, 0x4A, 0x62,
+    0xBE, 0xD4, 0xF2, 0xAA, 0x84, 0xB2, 0xB7, 0x81, 0x19, 0x7B, 0xE4, 0x5E, 0x47, 0x7A, 0x4A, 0x57,
+    0x40, 0xCA, 0x22, 0xB9, 0xDF, 0x84, 0xBD, 0xDC, 0xA3, 0x63, 0x07, 0xC5, 0xD3, 0xC0, 0xAD, 0x16,
+    0xF2, 0x04, 0x54, 0xF5, 0xA8, 0xE8, 0x51, 0x72, 0xF7, 0x49, 0xB5, 0x05, 0x95, 0x38, 0xB2, 0xFD,
+    0x17, 0x3F, 0x06, 0x2D, 0x3E, 0x42, 0xFE, 0x83, 0x16, 0xF4, 0x4F, 0x57, 0xB4, 0x34, 0x22, 0xD0,
+    0xC8, 0xF2, 0x77, 0x46, 0xCB, 0xA6, 0x59, 0xD1, 0x62, 0x81, 0x5B, 0x01, 0x4C, 0x82, 0xB5, 0xF9,
+    0xFF, 0x03, 0x22, 0x81, 0xB5, 0x73, 0x67, 0x3F, 0x42, 0x8B, 0xBB, 0x8B, 0x16, 0x2B, 0xBD, 0x95,
+    0xCB, 0xD2, 0xAB, 0x26, 0x98, 0x8E, 0xC2, 0xD1, 0x60, 0x6B, 0x6C, 0xB4, 0x1E, 0x86, 0xDC, 0x43,
+    0xF1, 0x6A, 0x80, 0x4C, 0x5A, 0xA0, 0x8A, 0x80, 0xE9, 0x00, 0x2D, 0x40, 0x26, 0x11, 0x54, 0x37,
+    0x00, 0x7D, 0xE1, 0x21, 0x65, 0x09, 0x0E, 0xA8, 0x6A, 0xF6, 0x30, 0x1D, 0x15, 0x34, 0x34, 0xBD,
+    0x6A, 0x96, 0x22, 0x88, 0xF8, 0x23, 0x7B, 0xA0, 0x3F, 0xB2, 0x05, 0xAC, 0x63, 0x9C, 0x28, 0xF0,
+    0xB5, 0x6A, 0x69, 0xE4, 0x1B, 0xF2, 0x84, 0x84, 0x39, 0xB6, 0x36, 0xD1, 0xD6, 0xEC, 0xE5, 0x35,
+    0xF9, 0x9B, 0x1E, 0x1A, 0x3F, 0xF2, 0x4E, 0x93, 0x40, 0xFF, 0x85, 0x47, 0xBF, 0x9E, 0xD0, 0x6D,
+    0x59, 0xEB, 0xA8, 0xBB, 0x7C, 0xA9, 0xE4, 0xBA, 0xBC, 0x2E, 0xAB, 0xA5, 0x6C, 0x6B, 0xC8, 0x5A,
+    0xE0, 0x3C, 0xF0, 0xC9, 0xDB, 0xE4, 0x5F, 0x29, 0xD2, 0x97, 0xF2, 0x9A, 0xC8, 0x90, 0xC9, 0x3F,
+    0x6B, 0x0F, 0xAC, 0x2B, 0xEB, 0xAE, 0x3C, 0x13, 0xF2, 0x76, 0x23, 0x0F, 0x2F, 0x67, 0xBD, 0xC9,
+    0xBA, 0x7F, 0x9F, 0x43, 0x38, 0x80, 0xB2, 0xA6, 0x74, 0xE4, 0x2D, 0x79, 0x20, 0xEB, 0xC9, 0x3A,
+    0x3E, 0xE6, 0x0D, 0x7D, 0x13, 0x75, 0x48, 0x2E, 0x22, 0x32, 0x18, 0x11, 0x11, 0xA9, 0x59, 0xAD,
+    0xB5, 0x15, 0xE7, 0xDD, 0x19, 0x7B, 0x1F, 0x56, 0x6B, 0x0F, 0x5E, 0xAC, 0x44, 0x9E, 0x97, 0x20,
+    0x22, 0x76, 0xA9, 0xAF, 0x74, 0xCF, 0x58, 0x6F, 0xF3, 0xD0, 0x56, 0x3C, 0x5E, 0x9E, 0x71, 0x09,
+    0x0E, 0xEE, 0xD1, 0x71, 0x14, 0x38, 0xE4, 0x81, 0x0A, 0x4A, 0x47, 0x1A, 0x45, 0xCF, 0x47, 0x2F,
+    0x9F, 0x10, 0x11, 0xA9, 0x2B, 0x11, 0x91, 0x63, 0x0B, 0x2C, 0x8B, 0x00, 0x79, 0x0D, 0x70, 0xFA,
+    0x0E, 0xEB, 0x07, 0xA0, 0x92, 0xE7, 0x64, 0x28, 0x97, 0x4A, 0x3A, 0xDD, 0x51, 0xF8, 0xBB, 0x0E,
+    0xD9, 0xD1, 0x41, 0x25, 0x0A, 0x8F, 0x50, 0x78, 0x1A, 0x11, 0x4F, 0x21, 0xE2, 0xE1, 0x6C, 0xE1,
+    0x81, 0x5F, 0x76, 0xC8, 0x64, 0x09, 0xB9, 0x1C, 0xAF, 0xE5, 0x19, 0x93, 0xD2, 0x3F, 0x1E, 0x1E,
+    0x01, 0x78, 0xB0, 0x49, 0x85, 0x7C, 0x51, 0x9E, 0x95, 0x36, 0x0F, 0x59, 0xE4, 0x80, 0x92, 0xA3,
+    0x13, 0xD3, 0x66, 0x91, 0xEA, 0x87, 0x0D, 0x88, 0x44, 0xD4, 0x1F, 0x9F, 0xBB, 0x7B, 0x95, 0x66,
+    0xD2, 0x43, 0x23, 0x7E, 0xA2, 0x35, 0xF7, 0x93, 0x85, 0x67, 0xEA, 0x3B, 0xC9, 0xFC, 0xB5, 0xA8,
+    0x7C, 0xA4, 0xF0, 0x2A, 0x3D, 0x52, 0x78, 0xE4, 0xBF, 0xBC, 0x93, 0xCA, 0xDD, 0xC2, 0xC3, 0x23,
+    0x47, 0x87, 0xCF, 0xDC, 0x4D, 0xE5, 0x00, 0xB9, 0x0C, 0x4D, 0x2A, 0xE4, 0xDC, 0xD2, 0x48, 0x7D,
+    0x40, 0x49, 0xE9, 0x72, 0x9F, 0x87, 0x2C, 0x66, 0xDD, 0x57, 0x16, 0xEC, 0x3D, 0x58, 0x62, 0x3F,
+    0xBC, 0xE8, 0x11, 0x89, 0xAC, 0xDD, 0x5C, 0xC0, 0x83, 0x25, 0x98, 0xDC, 0x8F, 0x44, 0xE4, 0x12,
+    0x46, 0x0E, 0x00, 0x34, 0x52, 0xC3, 0x7C, 0xC9, 0xA8, 0xD3, 0xFF, 0xE2, 0xC3, 0xFB, 0xDF, 0xBB,
+    0x80, 0x16, 0x49, 0xE8, 0xE5, 0xBE, 0xA0, 0x23, 0x95, 0xD3, 0x91, 0xB2, 0xD6, 0x91, 0xE2, 0x97,
+    0x1F, 0x4A, 0xA1, 0x49, 0x22, 0x4F, 0x4A, 0x62, 0x8B, 0x71, 0x75, 0x19, 0x59, 0x4D, 0x12, 0x1D,
+    0x57, 0x3A, 0x42, 0x05, 0x90, 0x94, 0x43, 0xBF, 0x2F, 0x1D, 0xF6, 0x3D, 0x89, 0x54, 0x5D, 0xD1,
+    0xB2, 0xA4, 0xF0, 0x3A, 0x52, 0x61, 0x3D, 0x89, 0x0A, 0x1D, 0x49, 0xD8, 0x5F, 0x7A, 0x69, 0x9E,
+    0x32, 0x79, 0x43, 0x62, 0x29, 0x0E, 0xF8, 0xFB, 0x0E, 0x28, 0xA5, 0x03, 0x23, 0x4D, 0x07, 0x73,
+    0x97, 0x47, 0x74, 0xC4, 0xB6, 0x9F, 0x2D, 0x6B, 0x8A, 0x2B, 0x3E, 0x41, 0x65, 0x4D, 0x0B, 0xC3,
+    0x66, 0xE9, 0xD0, 0x51, 0x44, 0x44, 0xAE, 0x88, 0x88, 0x08, 0x4F, 0xBF, 0xB3, 0xBD, 0x7D, 0x96,
+    0xCA, 0x31, 0x09, 0x69, 0xB2, 0x74, 0x0C, 0x32, 0xD8, 0x08, 0xA3, 0x5D, 0x0E, 0xE5, 0xCD, 0xED,
+    0xEF, 0x41, 0x29, 0xD2, 0xC1, 0x03, 0xB2, 0x04, 0xD8, 0x5E, 0xD9, 0x15, 0xB9, 0xD4, 0x18, 0x11,
+    0x5C, 0x9F, 0x75, 0x8F, 0x94, 0xD8, 0xAB, 0x57, 0x5B, 0xD2, 0xE6, 0x1E, 0xF6, 0xAA, 0x88, 0xA4,
+    0x5C, 0x44, 0xEA, 0xDC, 0x4F, 0xC2, 0xD1, 0xB4, 0x13, 0xC7, 0xCC, 0x96, 0xEE, 0x33, 0x58, 0x91,
+    0x9A, 0x52, 0x5A, 0x58, 0xDB, 0xE2, 0xDF, 0x22, 0x2D, 0x6A, 0x00, 0xD0, 0x2D, 0x13, 0xB7, 0x9B,
+    0x96, 0x10, 0xAF, 0x00, 0xE0, 0x7F, 0x97, 0x84, 0xDA, 0x7A, 0x32, 0x29, 0xAC, 0x9B, 0x2A, 0xC8,
+    0x01, 0x1E, 0x06, 0x2A, 0xB9, 0x26, 0xAD, 0xF5, 0x3A, 0x92, 0xA8, 0xF8, 0x15, 0x27, 0xCD, 0x30,
+    0xB1, 0x3F, 0x00, 0x8C, 0xCF, 0x6B, 0x20, 0x8B, 0x3A, 0x02, 0xCC, 0xBF, 0xDC, 0x8F, 0xBA, 0xF0,
+    0xC8, 0x14, 0xD7, 0xDC, 0xF1, 0x42, 0x5D, 0x1B, 0x61, 0x80, 0x3C, 0x1A, 0xE9, 0xB3, 0x94, 0x09,
+    0x4D, 0xAF, 0x84, 0x66, 0x34, 0xA8, 0xD9, 0x21, 0xB1, 0x00, 0x5B, 0x57, 0xEC, 0x00, 0xD1, 0xFA,
+    0x19, 0xB0, 0xAE, 0x63, 0x01, 0x68, 0x9F, 0xAC, 0x03, 0x76, 0xE7, 0x4F, 0x79, 0xA0, 0x18, 0xD5,
+    0x1D, 0x7B, 0xED, 0xE6, 0xA8, 0xF1, 0x24, 0xEB, 0x41, 0xC7, 0x2A, 0xEB, 0x41, 0x77, 0xD6, 0x57,
+    0x8E, 0x2C, 0xE9, 0x68, 0x22, 0x2A, 0x91, 0x58, 0xC2, 0x92, 0x8A, 0x22, 0x20, 0x58, 0x9F, 0x0D,
+    0x88, 0x2B, 0xA5, 0xAE, 0x82, 0xB8, 0x42, 0x5A, 0xBD, 0xBC, 0x0F, 0x80, 0xFB, 0x20, 0xF3, 0xB9,
+    0x03, 0x13, 0x6C, 0x0D, 0xBA, 0x2D, 0x6A, 0xC8, 0x96, 0x02, 0xF0, 0x87, 0x6F, 0xAF, 0x68, 0xF8,
+    0x3D, 0x23, 0x5B, 0xFD, 0x29, 0x80, 0x2D, 0x40, 0x3D, 0x29, 0x4B, 0xAA, 0x57, 0xA5, 0xD5, 0x42,
+    0xA2, 0xFA, 0x9F, 0x75, 0xCC, 0x22, 0xD6, 0x17, 0x8E, 0x8A, 0x0E, 0x92, 0xAD, 0xD1, 0x71, 0x07,
+    0xEC, 0x5B, 0x37, 0xA1, 0x12, 0x71, 0xC8, 0x4B, 0x52, 0xEB, 0xA8, 0xC4, 0x59, 0x8F, 0x50, 0x41,
+    0x22, 0xA1, 0x3B, 0x1D, 0xC9, 0x5B, 0xEB, 0x29, 0x5D, 0x05, 0x07, 0xB9, 0x04, 0x1D, 0x45, 0x9C,
+    0xF5, 0xD3, 0x34, 0xD5, 0x2B, 0x1D, 0x22, 0xEF, 0xA0, 0x14, 0x07, 0xE5, 0x05, 0x00, 0xFE, 0x1D,
+    0x89, 0xF9, 0x75, 0xA9, 0x9B, 0xE7, 0x3A, 0x13, 0x4C, 0xD8, 0xA0, 0x78, 0xB2, 0x65, 0xD7, 0xA2,
+    0x6E, 0xDE, 0xC4, 0x88, 0xB8, 0xE2, 0x4F, 0xC5, 0xED, 0x32, 0x57, 0x1D, 0x07, 0x26, 0xA8, 0xBE,
+    0x70, 0xFA, 0x86, 0xD4, 0xB6, 0x11, 0x37, 0x1B, 0x05, 0x62, 0xEE, 0xA1, 0x82, 0xAC, 0x83, 0x79,
+    0x4D, 0xD5, 0x4F, 0x52, 0x82, 0x71, 0xF4, 0x24, 0x18, 0x11, 0x09, 0xE4, 0xBE, 0xAC, 0xC9, 0x5A,
+    0xD3, 0xC2, 0x25, 0xD5, 0xC3, 0x3A, 0x7B, 0x60, 0xEB, 0xA2, 0x46, 0x07, 0xD3, 0x42, 0xA7, 0x7A,
+    0xD8, 0x60, 0x0F, 0x0A, 0x8A, 0x9A, 0xDC, 0x9B, 0x16, 0xDD, 0xAA, 0x1E, 0x3A, 0xF6, 0x60, 0x41,
+    0x51, 0x33, 0xC3, 0xB4, 0x7F, 0xAB, 0x44, 0xF5, 0x46, 0x6A, 0xF6, 0x32, 0xF1, 0x4A, 0x86, 0x79,
+    0xAD, 0x44, 0xFE, 0x63, 0x37, 0xF1, 0x3D, 0xDD, 0x1E, 0x59, 0xE9, 0x1D, 0x93, 0x52, 0xCC, 0x27,
+    0xC9, 0x44, 0xA4, 0x2E, 0x45, 0x3A, 0x8A, 0xAC, 0x83, 0x58, 0x38, 0xAC, 0xEA, 0x50, 0x6D, 0xE1,
+    0x78, 0x48, 0x75, 0x64, 0xA1, 0x70, 0x6C, 0xA8, 0x0E, 0xED, 0x0B, 0xC7, 0x33, 0xAA, 0xC3, 0xBA,
+    0xC2, 0xFD, 0x87, 0x51, 0x75, 0x66, 0xA0, 0xE9, 0xE7, 0xAE, 0x92, 0xCB, 0x6E, 0x54, 0x7E, 0x0A,
+    0x26, 0x1D, 0x65, 0x03, 0xD0, 0x0E, 0x38, 0xC9, 0xDF, 0x34, 0x48, 0x41, 0x85, 0x88, 0x1B, 0xF5,
+    0x82, 0x71, 0x2D, 0x16, 0xEE, 0x48, 0x51, 0x28, 0x02, 0xD0, 0x0C, 0x93, 0x79, 0xFA, 0x5B, 0x83,
+    0x14, 0xAA, 0xB7, 0xD2, 0x9A, 0xB0, 0xB2, 0x87, 0x17, 0xB7, 0x4F, 0x24, 0xD3, 0x83, 0x96, 0x1A,
+    0xF2, 0x17, 0xE1, 0xDF, 0x16, 0x52, 0x13, 0x8F, 0x79, 0xE9, 0xCE, 0x6D, 0xCC, 0xF5, 0x18, 0x26,
+    0x56, 0xFE, 0x77, 0x80, 0xD4, 0x7C, 0x63, 0x05, 0x58, 0x24, 0x60, 0x84, 0xDE, 0x01, 0x5E, 0x3E,
+    0x82, 0x83, 0xFE, 0x26, 0xF4, 0xB0, 0x01, 0xAC, 0x0C, 0x13, 0x16, 0x91, 0x7B, 0x46, 0x1B, 0x76,
+    0x3C, 0xE8, 0x7A, 0xB2, 0xFF, 0x7E, 0xB1, 0xFE, 0xC2, 0x82, 0x3D, 0x4A, 0xEC, 0x07, 0xE7, 0x26,
+    0xFD, 0xE5, 0xDB, 0x8B, 0x49, 0x01, 0xBB, 0x5B, 0x7F, 0x51, 0x71, 0xEA, 0x49, 0xBB, 0xD2, 0x6E,
+    0x5B, 0x6E, 0xDF, 0xA4, 0x47, 0x49, 0x34, 0xE2, 0x29, 0x07, 0xF2, 0x01, 0xBD, 0x84, 0x7F, 0xDD,
+    0x32, 0x8F, 0xD8, 0x39, 0xF9, 0x1C, 0x7E, 0x16, 0xB9, 0x11, 0xB1, 0x85, 0x2B, 0x4A, 0x88, 0x29,
+    0xFB, 0x41, 0xC4, 0xE6, 0x7E, 0xA3, 0x40, 0xC5, 0x5D, 0xF3, 0x6C, 0x47, 0xA1, 0xDB, 0x57, 0x0A,
+    0xA7, 0x62, 0x69, 0xE9, 0x58, 0xE7, 0x83, 0xD6, 0xD6, 0x59, 0x6B, 0x0F, 0xE8, 0x99, 0xD1, 0x78,
+    0xEB, 0x75, 0xD0, 0x3D, 0x89, 0xCD, 0x51, 0x10, 0x05, 0x15, 0x59, 0x64, 0xD2, 0xDE, 0x43, 0xB3,
+    0x6C, 0x04, 0x0A, 0x19, 0x9B, 0x73, 0xF0, 0x51, 0x40, 0xA4, 0xBC, 0x5D, 0x21, 0x7F, 0x8C, 0x2A,
+    0x62, 0x96, 0x76, 0x89, 0x16, 0x37, 0xF7, 0x4A, 0x78, 0xA8, 0xE3, 0x43, 0x6F, 0x2E, 0xF2, 0x4F,
+    0xA2, 0xFA, 0x71, 0xD8, 0x58, 0xF0, 0xCC, 0xE2, 0xA1, 0x92, 0x87, 0xEC, 0x97, 0x72, 0x6F, 0x9E,
+    0xBB, 0xF6, 0x5C, 0x54, 0xED, 0xDC, 0x2F, 0x78, 0xC6, 0xB6, 0x25, 0x0F, 0xA9, 0x98, 0x7B, 0x53,
+    0x3F, 0x9E, 0xC5, 0x7C, 0x49, 0x26, 0x6F, 0x89, 0xD7, 0xA3, 0x90, 0x5B, 0x1C, 0x5B, 0x3F, 0xAC,
+    0xF4, 0xD3, 0xD1, 0x04, 0x1A, 0xB9, 0xDD, 0x0D, 0x69, 0x73, 0x9F, 0x45, 0x16, 0x94, 0xFC, 0x35,
+    0x27, 0x46, 0xAE, 0xC9, 0xE4, 0x5A, 0xC9, 0x5A, 0x1D, 0xA0, 0x62, 0x06, 0xD9, 0xF0, 0x74, 0x58,
+    0x89, 0x54, 0xB5, 0x75, 0xDC, 0xE9, 0x27, 0x99, 0x90, 0x0E, 0x74, 0x02, 0x98, 0x07, 0x20, 0x5F,
+    0x02, 0xFC, 0x34, 0x02, 0x65, 0xE9, 0x40, 0x87, 0x04, 0xEC, 0x58, 0x0F, 0xB6, 0x3E, 0x04, 0xA2,
+    0x8E, 0x50, 0x52, 0x39, 0xF4, 0x07, 0x7F, 0xD4, 0xC3, 0x5C, 0xC4, 0x63, 0xDF, 0xDD, 0x1F, 0x50,
+    0x1D, 0x26, 0x52, 0x42, 0x85, 0x6E, 0xD1, 0x3D, 0x0B, 0x28, 0xFC, 0xB9, 0x9B, 0x14, 0xF2, 0x9A,
+    0x04, 0x2D, 0xE9, 0x5E, 0x1E, 0x67, 0x41, 0xA7, 0xBA, 0x3C, 0xE8, 0xE5, 0x12, 0x75, 0x38, 0x4D,
+    0xF2, 0x2D, 0x98, 0x0F, 0xD8, 0x0F, 0x13, 0x43, 0xD6, 0xEB, 0xA8, 0x5B, 0xE3, 0xEC, 0xC8, 0xFF,
+    0xD7, 0x12, 0xA5, 0x44, 0x23, 0x17, 0x7D, 0xE5, 0xAA, 0xAC, 0x23, 0xE5, 0x41, 0xC7, 0xC2, 0x57,
+    0xA1, 0x92, 0xF7, 0x52, 0x95, 0x2A, 0x7F, 0x1F, 0x27, 0x61, 0x8D, 0x93, 0xA0, 0x92, 0xF5, 0x50,
+    0x5E, 0x1E, 0x40, 0xF5, 0xD6, 0xDF, 0x31, 0xBD, 0x50, 0x00, 0xAA, 0x67, 0x02, 0x6F, 0x46, 0xF4,
+    0x86, 0xA6, 0x05, 0x6C, 0x05, 0x64, 0x37, 0x3A, 0x60, 0xD3, 0x7A, 0x30, 0x3E, 0x01, 0x7D, 0xDE,
+    0x82, 0xA5, 0x82, 0x2C, 0xEA, 0x0E, 0xAA, 0xED, 0x73, 0x35, 0x46, 0x24, 0xC1, 0x72, 0xFF, 0x62,
+    0xA0, 0x70, 0xCC, 0xC9, 0x22, 0x3A, 0x32, 0x83, 0xAA, 0xCE, 0x3D, 0x2A, 0x9D, 0x90, 0x0B, 0x4A,
+    0x92, 0x0C, 0x54, 0xE2, 0x4F, 0xF0, 0x59, 0xE6, 0x3A, 0xAA, 0x54, 0x84, 0x2C, 0xAC, 0x1F, 0xB7,
+    0xE4, 0xB7, 0xA5, 0xF5, 0x76, 0x7C, 0xD3, 0x8F, 0x5F, 0xC0, 0xAC, 0x67, 0x07, 0xB2, 0x6B, 0x2D,
+    0x11, 0x6C, 0x51, 0x67, 0x1E, 0x2E, 0xED, 0x01, 0x98, 0xCB, 0xA3, 0x75, 0x6D, 0x46, 0x21, 0x56,
+    0xFC, 0xC9, 0x59, 0xB0, 0x6E, 0x2E, 0x1D, 0x2C, 0x94, 0x88, 0x47, 0xBF, 0xF3, 0x54, 0x0B, 0x54,
+    0x22, 0x35, 0xA8, 0x5B, 0xFB, 0x4B, 0xC0, 0xD6, 0xAA, 0xE7, 0x13, 0x2C, 0x30, 0x2D, 0x1B, 0xBA,
+    0xA5, 0xA8, 0xB3, 0x58, 0xC2, 0xA1, 0x7A, 0xFA, 0xEB, 0x52, 0x17, 0x22, 0xCB, 0x4A, 0x9C, 0x88,
+    0x44, 0xD6, 0x50, 0x8E, 0x62, 0xA9, 0x25, 0xD8, 0x0F, 0x6F, 0x8A, 0x9C, 0xE9, 0xF2, 0x41, 0xA5,
+    0x8A, 0xAA, 0xB6, 0x97, 0x83, 0x8E, 0x1C, 0x40, 0xA5, 0x9E, 0x0E, 0xFC, 0x23, 0x91, 0x21, 0x13,
+    0xB9, 0xF5, 0x4D, 0xB5, 0xFC, 0xBB, 0x11, 0xAA, 0x91, 0xDF, 0x66, 0x1D, 0x1C, 0x50, 0x7A, 0x4C,
+    0xCC, 0xC5, 0x7D, 0xA6, 0x92, 0x9F, 0x8B, 0x78, 0xE9, 0xAC, 0x44, 0xB5, 0x35, 0xA9, 0xD4, 0xD0,
+    0x11, 0x99, 0xB1, 0x8B, 0x7D, 0xA7, 0x81, 0x46, 0x26, 0xF5, 0xE6, 0x08, 0x43, 0x92, 0xA1, 0x10,
+    0x11, 0x57, 0xA1, 0x83, 0xF5, 0xBC, 0xA2, 0x23, 0x0F, 0x72, 0x64, 0xF9, 0x7B, 0xD0, 0x71, 0x7B,
+    0x0B, 0x91, 0x44, 0x35, 0x42, 0xB9, 0xA3, 0x9C, 0x99, 0x9E, 0xF8, 0x8A, 0xF5, 0x6C, 0xE8, 0x88,
+    0x25, 0xF1, 0xD4, 0x15, 0x19, 0x41, 0xAE, 0xDE, 0xB8, 0xD3, 0xBA, 0xCD, 0x7D, 0xD2, 0xB1, 0xB8,
+    0xDE, 0x71, 0xEE, 0xC2, 0x34, 0x6C, 0x46, 0x5A, 0x23, 0x4B, 0xD3, 0xDA, 0x37, 0xA2, 0xBA, 0xD9,
+    0x51, 0x1D, 0x60, 0xDF, 0x13, 0x11, 0x91, 0x0F, 0x23, 0x2C, 0xA0, 0x74, 0x98, 0x08, 0x52, 0xFF,
+    0x81, 0x15, 0x71, 0x8D, 0xD4, 0xEA, 0x2C, 0x9C, 0xF8, 0xE7, 0x50, 0x4A, 0x8F, 0x15, 0xE9, 0x74,
+    0xC7, 0xDC, 0xEF, 0x80, 0x64, 0x13, 0x02, 0x57, 0x7A, 0x50, 0x69, 0xC5, 0x70, 0x86, 0xFB, 0xB6,
+    0xB7, 0x9F, 0x7E, 0x53, 0x44, 0x86, 0x46, 0x44, 0xDE, 0x0A, 0x90, 0x0E, 0xC0, 0x7E, 0x3F, 0xA0,
+    0xFA, 0x3D, 0xA8, 0x74, 0x47, 0xDE, 0x96, 0x21, 0x4B, 0x88, 0x2C, 0xC9, 0x44, 0x1C, 0xEA, 0x8F,
+    0x81, 0x53, 0x28, 0xE9, 0xB5, 0xC8, 0xE5, 0x56, 0xF7, 0x27, 0xA9, 0x46, 0xDD, 0x3D, 0x41, 0x35,
+    0x17, 0x79, 0x4F, 0x44, 0x7E, 0xB8, 0xFD, 0x61, 0x64, 0x76, 0x40, 0x59, 0xF8, 0xE2, 0xB9, 0xE5,
+    0x45, 0x5F, 0x4A, 0xCD, 0x36, 0xB0, 0xA5, 0x1C, 0x85, 0x1F, 0xC8, 0x52, 0x11, 0xB0, 0x75, 0xBA,
+    0x6D, 0xB5, 0xFC, 0xFE, 0x5B, 0xBD, 0xC6, 0x56, 0xDE, 0xCE, 0x75, 0x2A, 0xFD, 0x8E, 0x0E, 0xAB,
+    0x35, 0xEA, 0x28, 0xA4, 0xAE, 0x24, 0x3D, 0x44, 0xF5, 0x2C, 0x3A, 0xC2, 0x1E, 0x58, 0x8F, 0xFE,
+    0xF9, 0x08, 0x79, 0x0E, 0xDB, 0x4F, 0x37, 0xE8, 0xEB, 0x21, 0x7B, 0x3F, 0xA9, 0xBE, 0x7C, 0x37,
+    0x65, 0xD2, 0x8F, 0xB3, 0x44, 0x8D, 0xE0, 0xA8, 0x8E, 0x55, 0x0D, 0xA8, 0xC1, 0xB6, 0x00, 0x55,
+    0xD6, 0x71, 0xF7, 0x36, 0x39, 0xE3, 0x4A, 0x5F, 0x48, 0x9B, 0xC7, 0x3C, 0x65, 0xD2, 0x9A, 0x94,
+    0x89, 0xB3, 0x5E, 0x7F, 0x88, 0x8A, 0x3A, 0x66, 0x11, 0x66, 0x24, 0x15, 0x41, 0xFB, 0x8A, 0x1E,
+    0xB8, 0x64, 0xFD, 0x0E, 0x60, 0x75, 0xDC, 0x04, 0xD4, 0x07, 0xC3, 0x39, 0x80, 0xF9, 0x68, 0xC3,
+    0x54, 0xFF, 0xF2, 0x27, 0x1D, 0x50, 0x9E, 0x89, 0xE3, 0x84, 0x4B, 0x79, 0x0B, 0x36, 0x54, 0x0C,
+    0x90, 0x47, 0xEB, 0x0B, 0x8F, 0x89, 0x3A, 0xEA, 0x1E, 0xDD, 0x93, 0x98, 0x3B, 0x9D, 0xA8, 0xC8,
+    0x3B, 0x3D, 0xD0, 0x2C, 0x91, 0x33, 0x03, 0x73, 0xA9, 0x6D, 0x7F, 0x16, 0x80, 0xB3, 0x70, 0x61,
+    0x0D, 0xD0, 0xDD, 0x88, 0xCD, 0x56, 0x35, 0x64, 0xED, 0x43, 0x77, 0x92, 0xF0, 0x37, 0x63, 0x41,
+    0x28, 0x77, 0x0F, 0x85, 0x4F, 0x34, 0xA6, 0xBB, 0x9D, 0x99, 0xAA, 0xEF, 0x92, 0x89, 0xD4, 0xE5,
+    0x2D, 0xF1, 0x03, 0xD5, 0x99, 0x96, 0x43, 0xEB, 0x54, 0xFF, 0x08, 0xA6, 0x1D, 0x05, 0x65, 0xCF,
+    0xDA, 0xD3, 0x9E, 0xF9, 0x12, 0x44, 0x40, 0xC9, 0x88, 0x97, 0x67, 0x3D, 0xE4, 0xD7, 0x6A, 0xAA,
+    0x39, 0x24, 0x71, 0xF6, 0x2F, 0xE5, 0xFA, 0x12, 0x91, 0xC0, 0xA7, 0xB7, 0xC8, 0xDC, 0x29, 0xDD,
+    0x55, 0x6E, 0xB0, 0xED, 0xBA, 0x6A, 0x8F, 0x79, 0x64, 0x2E, 0xAD, 0x95, 0xA5, 0xA9, 0x0B, 0xEF,
+    0xF4, 0xB8, 0xBC, 0x36, 0xB9, 0xFF, 0x00, 0x2D, 0x01, 0x95, 0xA0, 0xA8, 0xD1, 0x3F, 0xF2, 0xAA,
+    0x4F, 0xA4, 0xF2, 0xC3, 0x21, 0x93, 0x61, 0xC5, 0x2E, 0xAC, 0x48, 0xB2, 0x22, 0x83, 0xAD, 0xB3,
+    0xDE, 0x62, 0x5A, 0x4B, 0x51, 0x7F, 0x82, 0xBD, 0x91, 0xF7, 0xEB, 0x08, 0x76, 0x09, 0x56, 0xC2,
+    0x68, 0x4C, 0x67, 0xFD, 0xC4, 0x0B, 0x8E, 0xF6, 0x0D, 0xB2, 0xBE, 0xAA, 0xF3, 0x58, 0x8A, 0x04,
+    0x23, 0x4B, 0xB8, 0x6F, 0x8B, 0x52, 0xE4, 0x79, 0x91, 0x34, 0xA3, 0x7C, 0xDE, 0x9B, 0xF6, 0x71,
+    0xD5, 0xC3, 0x0C, 0x6C, 0x8D, 0x8E, 0x70, 0x08, 0x56, 0x1C, 0xFF, 0x68, 0x39, 0x59, 0x40, 0x1E,
+    0xD2, 0xB8, 0x34, 0x12, 0xD8, 0x2B, 0x4E, 0xF5, 0xBB, 0x54, 0x7A, 0xD9, 0x84, 0x42, 0x22, 0xF7,
+    0x7F, 0x0B, 0xB4, 0x2C, 0x81, 0x46, 0x5A, 0x38, 0xB1, 0xFF, 0x9D, 0x8F, 0xCC, 0x50, 0x1A, 0x71,
+    0x85, 0xFC, 0x5C, 0x02, 0x4D, 0xAF, 0x23, 0x24, 0x2A, 0x46, 0xD3, 0x59, 0x27, 0x2A, 0x10, 0xAF,
+    0x23, 0x55, 0xA2, 0xC2, 0xBE, 0xE6, 0x75, 0xD4, 0x31, 0x51, 0x91, 0xAC, 0xD7, 0xB1, 0x22, 0x51,
+    0x59, 0x6F, 0xBD, 0xFE, 0x69, 0x24, 0x51, 0x25, 0xAC, 0xD7, 0x02, 0x89, 0xCA, 0x8F, 0x25, 0xAC,
+    0x0A, 0x2B, 0xC5, 0xE5, 0xF2, 0x9E, 0x74, 0x4A, 0x96, 0x7C, 0x7E, 0xFF, 0x02, 0xB9, 0x2C, 0xE1,
+    0xAB, 0xFB, 0xF5, 0x5D, 0x0D, 0x49, 0x5A, 0x3E, 0x94, 0xBA, 0x1A, 0xF2, 0x30, 0x32, 0xE0, 0x60,
+    0x82, 0x1E, 0xD8, 0xE5, 0xC3, 0x60, 0xC2, 0xE6, 0x26, 0xBB, 0xF6, 0x4C, 0x30, 0x6F, 0x84, 0x4D,
+    0xF6, 0x3A, 0x1D, 0x4C, 0x62, 0x93, 0x39, 0x3A, 0x98, 0xC0, 0x66, 0x26, 0x75, 0xB1, 0x94, 0x41,
+    0x4B, 0x44, 0xB9, 0x53, 0xC0, 0xD2, 0x44, 0xB0, 0x6D, 0x03, 0x1C, 0x98, 0xF6, 0x23, 0x24, 0xE7,
+    0xD2, 0x29, 0x91, 0xF9, 0x40, 0x2E, 0xF5, 0x8A, 0xDA, 0xB1, 0xAD, 0x95, 0xD7, 0x11, 0x9B, 0xA8,
+    0xD0, 0xE2, 0x75, 0x24, 0x25, 0x2A, 0x2A, 0xEB, 0x75, 0xB4, 0x3E, 0x51, 0xE9, 0x68, 0xBD, 0x8E,
+    0x89, 0x44, 0x55, 0x61, 0xBD, 0x16, 0x4F, 0xA2, 0x8A, 0x58, 0xAF, 0xD3, 0xED, 0x5D, 0x47, 0xCA,
+    0xA4, 0xA3, 0x59, 0x8A, 0xB8, 0x42, 0x5A, 0x4E, 0x29, 0x47, 0xDE, 0x36, 0xB0, 0xCC, 0x23, 0xC6,
+    0x6F, 0xDE, 0xDD, 0x1A, 0x5F, 0x49, 0xD3, 0x6B, 0x09, 0x07, 0xE8, 0xD6, 0x04, 0x06, 0x76, 0xA9,
+    0x82, 0x09, 0xF6, 0x80, 0x5D, 0xFD, 0x46, 0x30, 0xA1, 0xDB, 0x64, 0x77, 0x53, 0x07, 0xF3, 0x9E,
+    0xDB, 0x64, 0xEE, 0x75, 0x30, 0x91, 0x4D, 0x76, 0xD1, 0xA1, 0xEC, 0x95, 0xBC, 0x27, 0xA1, 0x92,
+    0x51, 0x23, 0xC9, 0x63, 0x05, 0x3A, 0x15, 0x01, 0xF6, 0x74, 0xBC, 0xA3, 0x92, 0xB5, 0x6F, 0x01,
+    0x73, 0xE9, 0xA0, 0xF9, 0x50, 0x3C, 0xE2, 0xF2, 0x44, 0x03, 0xF3, 0x7A, 0x0E, 0x79, 0x2C, 0x6B,
+    0x58, 0x5A, 0x0F, 0xE5, 0xAB, 0x11, 0xCC, 0xFB, 0x09, 0x48, 0x87, 0x40, 0x55, 0xD6, 0x60, 0xBF,
+    0x1F, 0x41, 0xBF, 0x9F, 0x40, 0xA5, 0x39, 0x70, 0x68, 0x5B, 0xA8, 0x9E, 0x4C, 0x50, 0xFA, 0xCA,
+    0x53, 0x78, 0x33, 0x50, 0x06, 0xE6, 0x22, 0x81, 0x4C, 0xA4, 0x86, 0xB5, 0xB3, 0xA0, 0x2E, 0xAC,
+    0xA1, 0x63, 0xE5, 0x4C, 0x57, 0xB9, 0xAC, 0xBD, 0x4D, 0x21, 0x51, 0x0E, 0x9A, 0x25, 0x5A, 0xC4,
+    0xDB, 0x50, 0xC4, 0x0A, 0xDD, 0xCD, 0xC8, 0xFA, 0x03, 0x48, 0x0B, 0x48, 0x09, 0xD2, 0x30, 0x72,
+    0xF5, 0xD4, 0xA0, 0xFA, 0xCA, 0xE9, 0x58, 0x86, 0xBC, 0xB5, 0xCB, 0xA6, 0xCE, 0x64, 0x80, 0xFB,
+    0x56, 0x30, 0x9E, 0x11, 0x71, 0xE4, 0xCB, 0x26, 0x61, 0x3B, 0x1A, 0x9F, 0x47, 0x4C, 0x6F, 0x22,
+    0xCC, 0x75, 0x07, 0xB6, 0x4D, 0x90, 0xA5, 0x39, 0x30, 0x2F, 0x6B, 0x28, 0xBE, 0x2F, 0x22, 0x72,
+    0x43, 0x44, 0x64, 0xA2, 0xCC, 0x43, 0xF1, 0x6A, 0x84, 0xBC, 0x1D, 0x40, 0xC7, 0xD2, 0x93, 0x25,
+    0x9D, 0x50, 0x89, 0x79, 0xC8, 0x06, 0x8C, 0xC8, 0x30, 0x4A, 0x25, 0xD8, 0x76, 0xBF, 0xB8, 0xDD,
+    0x9B, 0xA8, 0x7E, 0x01, 0xE9, 0x60, 0x7B, 0x3B, 0x89, 0x48, 0x1A, 0xB6, 0xB7, 0xD3, 0xC1, 0xD8,
+    0x75, 0x7D, 0x45, 0xF6, 0xD1, 0x76, 0x7F, 0x8C, 0x61, 0xBA, 0x7E, 0xF7, 0x30, 0x99, 0x58, 0xB9,
+    0x3B, 0x86, 0xE9, 0x46, 0x0F, 0x2A, 0x35, 0x22, 0x22, 0xA5, 0x88, 0xC8, 0xF7, 0x5B, 0xD0, 0x37,
+    0x6E, 0x1B, 0xA6, 0x00, 0x55, 0xF6, 0x3B, 0x1C, 0xA6, 0x8F, 0x4B, 0xAE, 0x72, 0x6B, 0xE3, 0x68,
+    0xE4, 0xB1, 0x72, 0xCC, 0xEE, 0xA0, 0xF5, 0xBE, 0xAD, 0x91, 0xD0, 0x52, 0xA4, 0xCD, 0x3A, 0x1A,
+    0x5F, 0xA2, 0x96, 0x59, 0x4B, 0x1E, 0x4F, 0x4F, 0x40, 0x60, 0x0F, 0x14, 0x5E, 0x6D, 0xFF, 0x51,
+    0xA2, 0x12, 0xF1, 0x5A, 0x24, 0x4D, 0x36, 0xA4, 0xEA, 0x81, 0xD2, 0x39, 0x74, 0xDC, 0x80, 0xC3,
+    0x3C, 0x50, 0xF8, 0xA6, 0xCE, 0x3B, 0x2D, 0x32, 0x8C, 0xCC, 0x45, 0x9D, 0x85, 0x4F, 0xB0, 0x65,
+    0xC3, 0x52, 0x77, 0x55, 0x7D, 0xC9, 0xAC, 0x04, 0x8A, 0xDA, 0xA2, 0x9C, 0x44, 0xFE, 0xFC, 0xD9,
+    0x55, 0xA8, 0x40, 0x51, 0x7F, 0xFE, 0xA5, 0xD6, 0x4A, 0xAF, 0xB6, 0xF7, 0xA0, 0x70, 0x98, 0x57,
+    0xD1, 0x3F, 0x8D, 0x59, 0xD7, 0x48, 0x97, 0x4B, 0xC7, 0x7D, 0x0E, 0x8C, 0x0C, 0x8C, 0xCA, 0xC4,
+    0x47, 0xF9, 0x16, 0xE4, 0x92, 0xB4, 0xDC, 0x94, 0x9B, 0x9C, 0xEB, 0x75, 0x24, 0x8B, 0x1C, 0x42,
+    0x8F, 0xF5, 0x2C, 0xC8, 0x7A, 0x66, 0x50, 0x51, 0x40, 0xDE, 0xDA, 0x1A, 0x92, 0xF1, 0x50, 0x3C,
+    0xDF, 0x82, 0x8E, 0x11, 0xD8, 0xBB, 0xC4, 0xE8, 0xB8, 0x65, 0x8C, 0x03, 0xAA, 0x8E, 0x1C, 0x24,
+    0xC6, 0x83, 0x7E, 0x33, 0x00, 0xA3, 0xEB, 0xAB, 0x3D, 0x0A, 0x25, 0xD9, 0xDF, 0xAF, 0xB1, 0x92,
+    0x60, 0x7F, 0xDF, 0xDD, 0xD9, 0x92, 0x5F, 0xCB, 0x67, 0x37, 0xFB, 0x6B, 0xFC, 0x8F, 0xB3, 0x95,
+    0x35, 0xDE, 0xC1, 0xD7, 0xF6, 0xC0, 0x4A, 0x3D, 0xB6, 0xE1, 0x44, 0x3B, 0x4E, 0x8C, 0x53, 0xA0,
+    0xBB, 0x91, 0x67, 0x44, 0xA8, 0xD4, 0x47, 0xF4, 0x9E, 0x4C, 0x04, 0x59, 0xCE, 0x97, 0xEE, 0x81,
+    0x25, 0x09, 0x16, 0x94, 0x35, 0x33, 0x74, 0xA4, 0x84, 0x43, 0x6C, 0x8D, 0xF5, 0xC6, 0x93, 0xF5,
+    0xBA, 0x85, 0x4A, 0x45, 0x30, 0x6D, 0x3F, 0x4A, 0x43, 0x28, 0xBE, 0xB7, 0xF2, 0xEE, 0x31, 0xAF,
+    0x57, 0x5A, 0x5F, 0x76, 0x84, 0x88, 0x7D, 0xD0, 0x01, 0x55, 0x0F, 0xD8, 0x7E, 0x85, 0x3D, 0xF2,
+    0x95, 0x13, 0x8E, 0xC2, 0x27, 0xB2, 0x54, 0x78, 0xAC, 0xBB, 0x74, 0x67, 0x6B, 0x8C, 0xB4, 0x55,
+    0x9A, 0x0F, 0x99, 0xD4, 0x03, 0xBA, 0x35, 0x2D, 0x0B, 0x2A, 0x6C, 0x9D, 0x75, 0x2A, 0x62, 0x7D,
+    0x09, 0x0B, 0x1D, 0xD0, 0xED, 0x02, 0x2A, 0xEB, 0x50, 0x1F, 0x44, 0xB0, 0xDF, 0x9B, 0xDC, 0x12,
+    0xBA, 0x9F, 0x4C, 0x72, 0xDD, 0xAE, 0x00, 0x05, 0x87, 0x31, 0x2D, 0x48, 0x3F, 0x0A, 0x77, 0xFE,
+    0xF1, 0xED, 0x66, 0x9F, 0xFF, 0x24, 0x64, 0x9D, 0xF5, 0x64, 0xA9, 0x68, 0xC7, 0x45, 0x9E, 0x75,
+    0xD6, 0xC3, 0x8B, 0xDA, 0xDD, 0xE1, 0x0A, 0x8C, 0x56, 0xAE, 0xC9, 0xDB, 0xAA, 0x69, 0xAD, 0x27,
+    0xF7, 0x59, 0x8F, 0x6E, 0xA9, 0xC8, 0x22, 0x79, 0x4B, 0x0F, 0x89, 0x1D, 0x28, 0xEB, 0x19, 0x8C,
+    0x80, 0xF2, 0x9E, 0xAD, 0xC1, 0x5E, 0xF5, 0xA0, 0x6E, 0x1D, 0x3B, 0x42, 0xFB, 0x23, 0xBC, 0x6C,
+    0x9D, 0x09, 0xCC, 0xB1, 0x4F, 0xBB, 0x09, 0xCE, 0x42, 0xEA, 0x23, 0x10, 0x1B, 0x80, 0x0D, 0x0B,
+    0xF9, 0x0F, 0x3A, 0x48, 0x15, 0x94, 0xB9, 0x47, 0x87, 0x0E, 0x3E, 0xFB, 0x89, 0xBF, 0xE1, 0x9E,
+    0x5A, 0x63, 0x0B, 0xAA, 0x67, 0x13, 0x54, 0xCF, 0x25, 0x28, 0x9F, 0xE8, 0xEF, 0x9E, 0x3E, 0xBF,
+    0x77, 0xFC, 0x29, 0x97, 0x81, 0xAD, 0x13, 0xD0, 0x98, 0x48, 0x79, 0x39, 0xA1, 0xC3, 0xA3, 0x77,
+    0xCD, 0xDF, 0x38, 0x1F, 0x9A, 0xBE, 0x58, 0x66, 0x1D, 0x0B, 0x6E, 0xC7, 0xA0, 0x54, 0xCF, 0x82,
+    0xEA, 0x87, 0x0D, 0x5A, 0xC4, 0xF3, 0xE9, 0x3F, 0x8D, 0x13, 0x9E, 0xB2, 0xC2, 0xA0, 0x4A, 0x71,
+    0xA3, 0xE3, 0x82, 0x4C, 0x44, 0xAE, 0x89, 0x48, 0x9D, 0xD8, 0xD3, 0x91, 0xCE, 0x7A, 0x1D, 0x2A,
+    0x72, 0x12, 0xA7, 0x74, 0x1C, 0xA7, 0x75, 0x35, 0x8E, 0xDE, 0x2F, 0xFF, 0x99, 0x4B, 0x44, 0x24,
+    0x1C, 0xDD, 0xCA, 0xE2, 0xB8, 0x32, 0x1F, 0x1A, 0x3D, 0x8A, 0x8D, 0xC8, 0x39, 0x91, 0x70, 0xB8,
+    0x16, 0x0B, 0xB7, 0x61, 0x82, 0x55, 0x5D, 0x56, 0xEF, 0x8E, 0x2C, 0x2C, 0xA0, 0x3A, 0x98, 0x7E,
+    0xB4, 0xA3, 0x7A, 0x3B, 0x06, 0x7F, 0xD8, 0x9A, 0xAC, 0x85, 0xF3, 0xC7, 0xBE, 0xE9, 0x53, 0xCA,
+    0x01, 0x36, 0x1C, 0x02, 0x0C, 0x76, 0x74, 0xBF, 0x1D, 0xF0, 0x8B, 0xB6, 0x5C, 0x7A, 0x8C, 0xA4,
+    0xF9, 0x12, 0xAA, 0xA5, 0xAB, 0x58, 0xC1, 0x9A, 0x23, 0xA2, 0xF9, 0xCB, 0x7E, 0xC8, 0x05, 0x4A,
+    0xA7, 0x47, 0x46, 0x5F, 0x6D, 0x37, 0xBE, 0x74, 0x3A, 0x32, 0x64, 0x1D, 0x15, 0xA6, 0x2D, 0x9D,
+    0x8E, 0x54, 0x59, 0x47, 0x85, 0x8E, 0xA5, 0xD3, 0x91, 0xBD, 0xAC, 0xA3, 0xC2, 0x86, 0xD2, 0xE9,
+    0x68, 0xFA, 0xAC, 0xCB, 0x44, 0x96, 0x99, 0x24, 0x91, 0x25, 0x73, 0x59, 0x71, 0xF2, 0xCC, 0x9D,
+    0x02, 0x06, 0xDB, 0x82, 0x0D, 0x4B, 0xE0, 0x98, 0xC9, 0xDF, 0xDE, 0xDC, 0x56, 0xC9, 0xD0, 0x0C,
+    0x14, 0x52, 0x1F, 0x80, 0xF5, 0x26, 0x40, 0x62, 0xF7, 0xF8, 0x74, 0x2E, 0xC1, 0x7A, 0x23, 0xE2,
+    0x12, 0xBB, 0x24, 0xEB, 0x4D, 0x30, 0x21, 0xB1, 0xCB, 0xAE, 0xF5, 0x26, 0x18, 0x9F, 0xD8, 0x55,
+    0xC9, 0xFA, 0x52, 0xC4, 0xC8, 0x6B, 0x22, 0xB5, 0x0C, 0x77, 0x00, 0x22, 0xCB, 0x42, 0x64, 0x49,
+    0x62, 0x8F, 0xC4, 0xE6, 0xB4, 0x3F, 0x42, 0xE2, 0xD4, 0x4A, 0xC1, 0xAF, 0x64, 0xA0, 0x92, 0xE1,
+    0x2E, 0xA5, 0xFF, 0xCE, 0x3D, 0x97, 0x9E, 0x4A, 0xD2, 0x14, 0x7E, 0xBA, 0x3E, 0xEE, 0xA7, 0x0F,
+    0xA0, 0xEC, 0x21, 0x0F, 0xBF, 0x68, 0x94, 0xFF, 0xE4, 0xF0, 0xAC, 0x16, 0xE1, 0xA9, 0x77, 0xDC,
+    0x6D, 0xA3, 0x1C, 0xC8, 0xE5, 0x82, 0x95, 0x04, 0x76, 0x0C, 0x6D, 0x8E, 0x14, 0x09, 0x9D, 0x8E,
+    0x42, 0x79, 0x7E, 0xFF, 0x91, 0x16, 0xD8, 0x20, 0x32, 0x4A, 0xEE, 0x51, 0x90, 0x59, 0xBF, 0xF2,
+    0xED, 0x99, 0x08, 0x48, 0x07, 0x14, 0x2D, 0xBF, 0x71, 0xA4, 0x05, 0x55, 0x2E, 0xC1, 0xB4, 0x53,
+    0xE7, 0x15, 0x6E, 0x8C, 0xFF, 0xC9, 0x26, 0xD3, 0xAA, 0xEC, 0xE1, 0xC4, 0xDB, 0xBF, 0x92, 0xD6,
+    0xF6, 0x2E, 0x5A, 0x3F, 0x5C, 0xD1, 0x5A, 0x88, 0x2C, 0xC9, 0x5E, 0x92, 0x7D, 0x37, 0x5E, 0xBC,
+    0x9B, 0xD6, 0xC5, 0x2F, 0x8B, 0x2A, 0xA9, 0x7F, 0x35, 0x31, 0x85, 0x48, 0x50, 0x4F, 0x2D, 0xB7,
+    0xD0, 0xAF, 0x79, 0xF4, 0xEB, 0xFD, 0x1D, 0x61, 0x23, 0x6F, 0xC9, 0xEB, 0xD2, 0xFF, 0xFD, 0xFD,
+    0xA3, 0xED, 0xC5, 0xAD, 0x2F, 0xFF, 0x83, 0xC2, 0xC5, 0xEA, 0xDF, 0x7C, 0xFB, 0x5E, 0x5E, 0xFC,
+    0xE5, 0x1F, 0x00, 0xE3, 0x38, 0x0D, 0x8F, 0x7D, 0xF5, 0xA5, 0xB7, 0xF6, 0x0F, 0x5E, 0x34, 0xFF,
+    0x89, 0x0A, 0x2F, 0x9E, 0xBF, 0x17, 0x5E, 0xE4, 0xD7, 0x3D, 0x8C, 0xDB, 0x69, 0x8C, 0x53, 0x9E,
+    0xBD, 0xFD, 0x3F, 0x7B, 0xF7, 0x7B, 0xA7, 0xF9, 0xCA, 0xF9, 0x13, 0x84, 0xAF, 0x70, 0x02, 0x7E,
+    0xFD, 0x03, 0x5F, 0xDD, 0x9F, 0xCB, 0x75, 0xE9, 0xA6, 0xAF, 0x46, 0xE4, 0xBA, 0x4C, 0x0E, 0xEF,
+    0x71, 0x9B, 0x8B, 0x88, 0x88, 0xDC, 0x1A, 0x29, 0xFC, 0xCE, 0x29, 0x75, 0xA6, 0x9D, 0xCD, 0xF4,
+    0x8F, 0x7F, 0xDB, 0xC3, 0x8F, 0x2E, 0x7C, 0x6E, 0x7F, 0x7F, 0xFF, 0x7F, 0x12, 0x91, 0x77, 0xB6,
+    0xB7, 0xB7, 0x01, 0x44, 0xE4, 0xE7, 0x32, 0x3A, 0x5A, 0x51, 0x2A, 0xD9, 0x70, 0x60, 0xC2, 0xC2,
+    0x3E, 0x11, 0x37, 0xE0, 0x1E, 0xFB, 0xD6, 0x8D, 0x6E, 0xD7, 0x3E, 0xD9, 0x6E, 0x98, 0x1A, 0xC5,
+    0x56, 0x71, 0x25, 0xD9, 0x90, 0xF2, 0x70, 0x60, 0xC2, 0x22, 0xF7, 0xBD, 0x75, 0xB1, 0xC8, 0xDA,
+    0x0D, 0xED, 0x81, 0x7B, 0x70, 0x43, 0xF1, 0xFD, 0x78, 0x58, 0x9E, 0x89, 0xBB, 0xB9, 0xEF, 0x8A,
+    0xAC, 0x9D, 0x69, 0xBF, 0x63, 0xEA, 0x67, 0x26, 0x8F, 0xF0, 0x84, 0x06, 0xD0, 0x83, 0x75, 0xCA,
+    0x75, 0xF7, 0x54, 0xEF, 0x35, 0x6F, 0x88, 0x0C, 0xFF, 0x9E, 0x7D, 0xA2, 0xA6, 0x1B, 0xFD, 0xD4,
+    0x77, 0x7E, 0xF5, 0xA3, 0x63, 0x67, 0xFA, 0x9A, 0x8A, 0xB0, 0xBF, 0xAA, 0x88, 0xFA, 0xB6, 0x3F,
+    0xDD, 0x67, 0x9F, 0x78, 0x5E, 0x64, 0xA8, 0x44, 0x5E, 0x77, 0xDD, 0xA9, 0xDB, 0xEE, 0xA9, 0x34,
+    0x79, 0xAB, 0x9B, 0x2F, 0x48, 0x39, 0xCC, 0xA3, 0xD4, 0x5B, 0x9C, 0xC7, 0x76, 0x48, 0x67, 0xA5,
+    0x13, 0x79, 0x4F, 0x96, 0xB2, 0xB4, 0x4B, 0x96, 0x9C, 0x80, 0x35, 0x9D, 0xAA, 0xAB, 0xFD, 0x1A,
+    0x6B, 0x9C, 0xAA, 0x6A, 0x99, 0xD7, 0x52, 0xB9, 0xE5, 0x3D, 0x9C, 0x2C, 0xCE, 0xA4, 0xEA, 0x72,
+    0x77, 0x3C, 0x9B, 0xBE, 0xF2, 0x87, 0x6F, 0x65, 0xBF, 0x83, 0xD9, 0x54, 0xFF, 0xD9, 0xFF, 0xFB,
+    0xA9, 0xDF, 0x70, 0x36, 0x71, 0x81, 0xD2, 0x99, 0xFF, 0x45, 0xFD, 0xDF, 0x8F, 0xFD, 0x9D, 0x17,
+    0xFD, 0xC7, 0x6A, 0xC2, 0xEA, 0x30, 0xEA, 0x61, 0x6F, 0x38, 0xCE, 0xB7, 0x9C, 0x7E, 0xFC, 0xAB,
+    0x17, 0xFF, 0xB3, 0x77, 0x2F, 0xFE, 0xA7, 0xE1, 0xF4, 0x63, 0xE1, 0x6B, 0xE1, 0xF5, 0xAB, 0x2E,
+    0xC0, 0x6F, 0xF0, 0x99, 0xCA, 0x7C, 0xD5, 0xE5, 0xA7, 0x79, 0xE4, 0x3C, 0xFF, 0xEB, 0xAD, 0xEF,
+    0x7E, 0xED, 0xD6, 0x4B, 0x0F, 0x3E, 0x66, 0xCC, 0x27, 0x8D, 0xBA, 0xFA, 0x05, 0x30, 0xBF, 0xD1,
+    0xE7, 0xAE, 0x6D, 0x0C, 0xCD, 0x12, 0x37, 0xBA, 0xE4, 0x68, 0x86, 0xD1, 0x41, 0x47, 0x91, 0xC5,
+    0x31, 0x5D, 0x44, 0xB7, 0xD6, 0x8D, 0x0E, 0xC1, 0x4D, 0xFA, 0x31, 0x75, 0x45, 0xFB, 0xBC, 0xDE,
+    0x98, 0x82, 0xB9, 0x2E, 0x4D, 0x91, 0x5C, 0xC1, 0x3E, 0xDB, 0x4E, 0x4F, 0x75, 0x1B, 0xA6, 0x27,
+    0xEF, 0xB2, 0x58, 0x9A, 0x33, 0x12, 0xB5, 0x44, 0xFB, 0x5E, 0x88, 0x0B, 0x5B, 0xA7, 0xC2, 0x55,
+    0xF1, 0x11, 0xEB, 0x16, 0x96, 0x05, 0x98, 0x67, 0xA3, 0xBE, 0x12, 0x8D, 0x87, 0x58, 0xB2, 0xB9,
+    0xCE, 0x0E, 0xAC, 0x67, 0x51, 0xBF, 0xD1, 0x1A, 0x8F, 0xF6, 0x25, 0x1B, 0xEB, 0xEC, 0xC0, 0x2B,
+    0x2A, 0x9A, 0x2B, 0x31, 0xF7, 0x14, 0x58, 0xD7, 0x17, 0xAE, 0x43, 0x07, 0x0E, 0xE7, 0x2C, 0xE7,
+    0x70, 0x89, 0x4C, 0xBC, 0x96, 0x9A, 0x1C, 0x94, 0x5B, 0xC5, 0xBB, 0x4F, 0xDB, 0xE3, 0xA6, 0x3D,
+    0xB0, 0x57, 0xBA, 0x99, 0xF1, 0x9D, 0x1A, 0xE3, 0xCE, 0x1F, 0x33, 0xED, 0x22, 0x0F, 0xC9, 0x5E,
+    0xE9, 0xCB, 0x33, 0x71, 0x66, 0xC2, 0x8E, 0xAD, 0x3B, 0xCB, 0xC9, 0x7B, 0xC6, 0xE7, 0xDB, 0x4F,
+    0x66, 0x7E, 0x2F, 0xF7, 0xA9, 0x3C, 0x13, 0xF7, 0xEC, 0x95, 0xBE, 0xCA, 0x43, 0x2A, 0x9E, 0x6F,
+    0x77, 0xF3, 0xCB, 0x71, 0xA6, 0x43, 0x67, 0x55, 0x7B, 0x8F, 0xE2, 0x61, 0x30, 0x2E, 0xD9, 0x30,
+    0xD7, 0xD1, 0xD6, 0x3B, 0x59, 0xF8, 0x5B, 0xC0, 0xF9, 0xCC, 0xA7, 0xDC, 0x0F, 0xA6, 0x9D, 0xEB,
+    0x58, 0xA9, 0xDE, 0xD6, 0xC9, 0xF8, 0xCD, 0x2C, 0x3C, 0x44, 0x7D, 0x0F, 0x80, 0x0A, 0x39, 0x2F,
+    0x5B, 0xBF, 0x30, 0x6D, 0xF5, 0x44, 0x6F, 0xFD, 0x5C, 0xC7, 0xD2, 0x25, 0xD3, 0x56, 0xF4, 0xD6,
+    0xEF, 0xAA, 0x68, 0x5D, 0x9F, 0x85, 0x87, 0x88, 0x19, 0x27, 0x95, 0xE3, 0x33, 0x50, 0xD4, 0x14,
+    0x97, 0x28, 0xF2, 0xBA, 0xE0, 0x92, 0x75, 0x79, 0xCD, 0x67, 0x75, 0xD8, 0x33, 0x6D, 0xA3, 0xBB,
+    0xBC, 0xCD, 0x43, 0x1E, 0x8C, 0xD7, 0xEE, 0x61, 0x36, 0xB1, 0xB5, 0x69, 0x55, 0x62, 0xC8, 0x92,
+    0x89, 0xD6, 0xCF, 0x78, 0x8C, 0x93, 0xC0, 0x17, 0x1C, 0x3C, 0xF4, 0x28, 0xD1, 0xD4, 0xAF, 0x14,
+    0xAE, 0xCD, 0xFC, 0x8B, 0x8F, 0x93, 0x63, 0x61, 0x43, 0x7B, 0x88, 0x91, 0x7B, 0x75, 0xBA, 0x57,
+    0xF5, 0x56, 0x75, 0xF6, 0xC9, 0xDE, 0xC2, 0xFF, 0xD1, 0xC2, 0xA3, 0xA6, 0xC6, 0xB8, 0xD3, 0xA8,
+    0x76, 0xEB, 0x3C, 0xCF, 0x14, 0x4F, 0x86, 0x4F, 0xA9, 0x2E, 0x3F, 0x53, 0xAF, 0xF1, 0xC8, 0xD7,
+    0x98, 0x96, 0xD8, 0xFD, 0xDC, 0x5F, 0xF8, 0xE2, 0x85, 0x36, 0xFF, 0x51, 0xA7, 0xBB, 0x03, 0x86,
+    0xD2, 0x95, 0xB9, 0xCF, 0xAF, 0xC4, 0x2C, 0x2E, 0x58, 0x94, 0x94, 0xC6, 0xE7, 0x97, 0xA3, 0x8A,
+    0x3B, 0xEC, 0x58, 0xAC, 0xF6, 0xDA, 0x47, 0x56, 0x26, 0xB7, 0xC3, 0x25, 0x95, 0x1A, 0xD7, 0x14,
+    0xBE, 0xB8, 0xEC, 0x94, 0xBB, 0x9D, 0x77, 0x7E, 0xF5, 0x7F, 0x90, 0xB7, 0x64, 0x1A, 0x33, 0x55,
+    0x8F, 0x4C, 0x6B, 0x31, 0xBA, 0x20, 0xD7, 0x81, 0x38, 0xE6, 0x4B, 0x6D, 0x8C, 0x4A, 0xC5, 0xA7,
+    0xC6, 0x2B, 0xA6, 0x3E, 0xBA, 0x62, 0xC7, 0xC0, 0x1C, 0xE3, 0x61, 0x13, 0x54, 0x3B, 0x5E, 0xB9,
+    0x34, 0x16, 0xA0, 0x8E, 0xE1, 0xBD, 0x9A, 0xA6, 0xCE, 0x25, 0xE4, 0x12, 0x4A, 0x09, 0xA5, 0x84,
+    0x87, 0x0B, 0xFF, 0x70, 0xE1, 0xB1, 0x35, 0xB6, 0xA6, 0x80, 0x02, 0x36, 0x60, 0x03, 0x22, 0x44,
+    0x0A, 0x4F, 0xE1, 0xCB, 0x25, 0xC5, 0xD2, 0x48, 0xAB, 0xA5, 0x2D, 0x7A, 0x8A, 0x9B, 0xEC, 0xC1,
+    0x6C, 0x7A, 0x40, 0xFB, 0xDB, 0x9C, 0x96, 0xC7, 0x60, 0x75, 0xD6, 0x93, 0xF5, 0xD8, 0x16, 0x1B,
+    0xA9, 0x1C, 0x55, 0xCD, 0xA9, 0x95, 0x02, 0x94, 0x5D, 0x68, 0x6A, 0xCA, 0x17, 0x24, 0x30, 0x94,
+    0x12, 0x74, 0xF7, 0x70, 0xE1, 0xAD, 0xC7, 0xD6, 0x15, 0x14, 0x24, 0xD8, 0xD0, 0x11, 0xA2, 0xF5,
+    0x14, 0xBE, 0xA4, 0x5C, 0xB2, 0x30, 0xD2, 0x66, 0xB1, 0xE8, 0x31, 0x7E, 0x0F, 0x0A, 0x22, 0xEC,
+    0x68, 0x0F, 0x77, 0x42, 0x36, 0xF7, 0x64, 0x3D, 0x2A, 0xD9, 0x76, 0x04, 0x39, 0x4A, 0x7F, 0x0A,
+    0x4E, 0x71, 0x3F, 0xA0, 0x12, 0x4D, 0x9D, 0xB7, 0xB9, 0x84, 0xD2, 0x55, 0x12, 0x0E, 0xD8, 0x2A,
+    0xAE, 0x74, 0x60, 0xBF, 0xE8, 0xA1, 0x2C, 0x81, 0x8D, 0x05, 0xA8, 0x1B, 0x11, 0x8A, 0x57, 0x3D,
+    0xE5, 0x50, 0x60, 0xA4, 0xDD, 0xA1, 0xE8, 0x89, 0xEC, 0xA2, 0x3D, 0x11, 0xBB, 0xF2, 0x03, 0xAF,
+    0x06, 0xF1, 0x24, 0xD6, 0xEB, 0x8E, 0xC6, 0xD9, 0x56, 0x25, 0x2A, 0xA7, 0x1C, 0xA7, 0x46, 0x20,
+    0x3F, 0x93, 0x56, 0x5F, 0xB9, 0x25, 0x7F, 0xD6, 0xC6, 0x13, 0xD2, 0x9E, 0xE4, 0xC4, 0x6A, 0x0D,
+    0x7E, 0x8A, 0xF0, 0x88, 0xAE, 0xF7, 0x72, 0x9F, 0x8A, 0x27, 0xBB, 0xCA, 0xB4, 0x83, 0xBD, 0xD2,
+    0x57, 0x3A, 0x1E, 0xD8, 0xCB, 0x7D, 0x79, 0xA6, 0xDD, 0xCD, 0x7D, 0x5F, 0xE8, 0x76, 0x33, 0xF7,
+    0x9D, 0x55, 0xED, 0x26, 0xEE, 0x64, 0xC6, 0x16, 0xEA, 0x90, 0x4A, 0xCE, 0x74, 0xF3, 0xC2, 0xCD,
+    0x16, 0x48, 0x9B, 0x49, 0x9D, 0x2F, 0x29, 0x7B, 0x24, 0xEA, 0x6B, 0xA1, 0xB4, 0x3F, 0xE9, 0x0B,
+    0xA9, 0x4F, 0x5C, 0x80, 0x13, 0x35, 0x7B, 0xE8, 0x9E, 0xAA, 0xCD, 0xAE, 0xD7, 0xC5, 0x3A, 0xF1,
+    0x92, 0x7D, 0xB2, 0x3D, 0x78, 0xFA, 0xCF, 0x45, 0x6E, 0xEC, 0x2F, 0x5D, 0xD6, 0x92, 0xD7, 0xFC,
+    0x01, 0xD9, 0x7E, 0x3D, 0x4F, 0xE6, 0xDD, 0xFA, 0x15, 0xF2, 0x0B, 0x48, 0x7B, 0xA2, 0xF1, 0xEC,
+    0xA2, 0x03, 0x9B, 0xE4, 0x97, 0x9F, 0xEA, 0xAA, 0x41, 0x7D, 0x1B, 0xF2, 0xA0, 0xA4, 0x2E, 0xEB,
+    0xAC, 0xA3, 0xA8, 0x69, 0x06, 0x2D, 0x4B, 0xEB, 0x16, 0x9B, 0x74, 0x9D, 0x7E, 0x23, 0x16, 0x5F,
+    0xF8, 0x20, 0xE5, 0xE2, 0xD5, 0xB7, 0xF8, 0xFC, 0xFE, 0xD7, 0x65, 0xF9, 0xDF, 0xBC, 0xF4, 0x16,
+    0x97, 0x1E, 0x2E, 0xD0, 0x81, 0x4B, 0x58, 0xB2, 0xC8, 0x26, 0xC6, 0x73, 0x89, 0xBC, 0xE6, 0x61,
+    0xD4, 0x21, 0xA5, 0xA8, 0x38, 0xCB, 0xEB, 0x9D, 0x42, 0xB7, 0xD5, 0x21, 0x55, 0xD4, 0x1F, 0x76,
+    0xEB, 0x3A, 0x46, 0x73, 0xD5, 0x17, 0xF6, 0xF5, 0xA9, 0xE9, 0x6A, 0xA0, 0x92, 0xAC, 0xDB, 0xB3,
+    0x6E, 0x67, 0x93, 0xAE, 0xD7, 0x3F, 0xE8, 0x8A, 0x33, 0x92, 0x54, 0x13, 0xC7, 0xC8, 0x89, 0x73,
+    0xBE, 0xEC, 0xF9, 0xDC, 0x68, 0x42, 0x7C, 0xBF, 0x33, 0xD2, 0x30, 0xD3, 0xC1, 0xBA, 0x5E, 0x87,
+    0x19, 0x9D, 0xAD, 0x37, 0x75, 0x6B, 0x5D, 0x5F, 0xF4, 0xCD, 0xE5, 0xB3, 0xF7, 0x6D, 0x01, 0xC5,
+    0x52, 0xC9, 0xD2, 0xFA, 0x83, 0x1D, 0x6E, 0xC5, 0xA3, 0xCE, 0x6A, 0x5A, 0x7D, 0xDD, 0xDB, 0xA7,
+    0xEB, 0x54, 0x8A, 0x2F, 0x57, 0x26, 0xEE, 0x8E, 0x11, 0x2E, 0x7A, 0x15, 0xD9, 0xA1, 0xC0, 0x1C,
+    0x9F, 0x94, 0xF2, 0x25, 0x19, 0x9D, 0xE1, 0x6A, 0xB9, 0xB4, 0x75, 0xDA, 0xCC, 0xE2, 0x49, 0x5B,
+    0xB3, 0x33, 0x26, 0x9B, 0x98, 0x96, 0x5D, 0xF2, 0x77, 0xCE, 0x56, 0xD2, 0xCF, 0xA5, 0xC6, 0xE5,
+    0xF2, 0xC5, 0xEB, 0x3F, 0xF5, 0x9B, 0x27, 0x2D, 0xB6, 0x9E, 0xD7, 0x55, 0xBA, 0xA7, 0x70, 0xBA,
+    0xA5, 0x57, 0xE9, 0xE2, 0x70, 0x54, 0xD3, 0x8C, 0xAC, 0xA7, 0x68, 0x91, 0xDA, 0xFE, 0x63, 0x2E,
+    0x5D, 0x32, 0x57, 0xDA, 0x8D, 0xFC, 0x79, 0x91, 0xEB, 0x22, 0x7E, 0x1C, 0x98, 0xF5, 0xD1, 0xE0,
+    0xF7, 0xF3, 0x94, 0xD7, 0xBC, 0x42, 0xFE, 0x36, 0xD2, 0x71, 0xCE, 0xB3, 0x39, 0x8E, 0x4D, 0x71,
+    0xA5, 0x89, 0xD5, 0xAA, 0xB0, 0xB9, 0xB7, 0x1D, 0x09, 0xEB, 0xD9, 0xBB, 0xA0, 0x25, 0xD9, 0x3F,
+    0x4D, 0x1B, 0xAA, 0xEB, 0xF4, 0x1B, 0xAD, 0xFD, 0x52, 0x58, 0x58, 0x69, 0xED, 0x30, 0xBA, 0xA8,
+    0xDE, 0x94, 0xE5, 0x2B, 0xE6, 0x55, 0xBA, 0x93, 0xEB, 0x18, 0x4F, 0x4F, 0x81, 0x6E, 0xD9, 0x18,
+    0x87, 0xC7, 0x8C, 0x79, 0xA2, 0xE4, 0x4B, 0x6E, 0x1E, 0xE4, 0x7E, 0xB1, 0x9E, 0xB5, 0x7B, 0xD6,
+    0xCD, 0x3B, 0x24, 0x14, 0x4F, 0xB7, 0x5D, 0x7E, 0xD5, 0x5B, 0xEB, 0x76, 0xCA, 0x97, 0x42, 0x39,
+    0x4C, 0xC1, 0x02, 0xC5, 0xA0, 0x96, 0x83, 0xAD, 0xD3, 0xA6, 0x8A, 0x9D, 0x7E, 0x23, 0xDA, 0x2F,
+    0xDC, 0x5A, 0x18, 0x89, 0xEA, 0xE9, 0x9A, 0x05, 0x79, 0xF8, 0xF4, 0x40, 0x53, 0xAF, 0xC2, 0xAA,
+    0x45, 0x24, 0x96, 0xDF, 0x7C, 0xCA, 0x1F, 0x50, 0x64, 0x1D, 0x8F, 0xE7, 0x01, 0x57, 0x3A, 0x38,
+    0x80, 0xEC, 0xE6, 0x76, 0x9D, 0x8B, 0xD4, 0xE5, 0xBB, 0xDF, 0xE1, 0x60, 0x8C, 0xEF, 0xBA, 0x78,
+    0xCB, 0x69, 0x11, 0x38, 0x1C, 0x7F, 0xE6, 0x01, 0x25, 0x4B, 0xAC, 0x1C, 0x51, 0xDB, 0xA2, 0x25,
+    0x91, 0x87, 0x43, 0x6C, 0x5D, 0x51, 0xF2, 0x28, 0x15, 0xF7, 0x30, 0x1B, 0x33, 0x9C, 0xEE, 0x3D,
+    0xDC, 0xAF, 0x0B, 0x91, 0x9A, 0x05, 0x90, 0xD6, 0xA8, 0x44, 0xF8, 0xFC, 0xCD, 0x6D, 0x54, 0x37,
+    0x1A, 0x22, 0xBA, 0x05, 0x13, 0xF8, 0x7B, 0x73, 0x91, 0x54, 0x35, 0x92, 0x3E, 0x73, 0xE4, 0x59,
+    0x06, 0x1E, 0x90, 0xA5, 0x9B, 0x20, 0x8E, 0x31, 0xE4, 0x87, 0x13, 0xFD, 0x18, 0x77, 0x89, 0xEA,
+    0x19, 0x56, 0x27, 0x7B, 0xAB, 0x93, 0x99, 0xF2, 0xD3, 0x89, 0x9E, 0x4E, 0x76, 0x57, 0x27, 0xE9,
+    0x9C, 0xF8, 0x79, 0xA7, 0xFA, 0xBC, 0x13, 0xB9, 0x72, 0x73, 0xA1, 0x44, 0x82, 0xF1, 0xDA, 0x3F,
+    0xAE, 0xE4, 0x26, 0xC6, 0xEB, 0x70, 0x52, 0xF5, 0x60, 0xBC, 0xEE, 0x19, 0x4F, 0x94, 0xD4, 0xE3,
+    0x09, 0x65, 0x37, 0x9D, 0xA8, 0x34, 0x9E, 0x64, 0x6E, 0x47, 0xF5, 0x60, 0x82, 0xAE, 0x77, 0x0A,
+    0x09, 0xE8, 0x5B, 0xFF, 0xEC, 0xCF, 0xBB, 0x4A, 0x5A, 0x32, 0xB9, 0x3A, 0xE5, 0x08, 0x9D, 0xE2,
+    0xBE, 0x23, 0x6C, 0xE4, 0x6D, 0x94, 0x48, 0xA0, 0xF9, 0x6F, 0x17, 0x14, 0x5E, 0x7B, 0x1D, 0x79,
+    0x9C, 0x03, 0x32, 0xAC, 0x87, 0xEC, 0xE6, 0xB6, 0xD3, 0x22, 0x3D, 0xFF, 0xEE, 0x07, 0xDB, 0xA3,
+    0x0D, 0x38, 0x17, 0xE1, 0x44, 0xB3, 0x7F, 0x61, 0x4C, 0x80, 0x2A, 0xEA, 0x55, 0x78, 0x74, 0x04,
+    0xAA, 0xB7, 0xD7, 0x3C, 0x22, 0x09, 0x25, 0xCB, 0x31, 0x44, 0xF6, 0xE4, 0x14, 0x4C, 0xBA, 0xCA,
+    0xCA, 0x5C, 0x9F, 0x22, 0x0F, 0xAE, 0x8B, 0x48, 0x7F, 0x69, 0x05, 0x8D, 0x5E, 0x5A, 0x05, 0x84,
+    0x4E, 0x5C, 0x2E, 0xAF, 0xC9, 0x7B, 0x72, 0xA9, 0xF3, 0x7F, 0x71, 0x29, 0xFF, 0xFA, 0x97, 0x9E,
+    0xBD, 0x1C, 0x02, 0xE7, 0xE1, 0x34, 0x18, 0x87, 0x0A, 0xF0, 0x0A, 0x3C, 0x0A, 0xF9, 0x08, 0x7D,
+    0x5C, 0x82, 0xF5, 0xA3, 0x1F, 0xAB, 0x60, 0x0D, 0x75, 0x47, 0x92, 0xC2, 0xFA, 0x51, 0x9D, 0x53,
+    0x6D, 0xAB, 0x7D, 0x67, 0xE5, 0x11, 0xFD, 0x85, 0x85, 0x8D, 0xD5, 0x4C, 0x75, 0x9E, 0x87, 0xD3,
+    0xE4, 0xE6, 0xCC, 0x93, 0xEF, 0xBF, 0xD1, 0x96, 0xFF, 0x75, 0x9B, 0x49, 0x4B, 0xD9, 0x1E, 0xD5,
+    0x09, 0x68, 0x6F, 0xA1, 0x63, 0x87, 0x4D, 0x54, 0xB4, 0x0E, 0x73, 0x55, 0x44, 0xA4, 0x12, 0x91,
+    0xD8, 0xC1, 0x8E, 0x0E, 0x14, 0x58, 0x97, 0x7B, 0x36, 0x56, 0x22, 0xE7, 0x1E, 0xB0, 0x1E, 0x9B,
+    0xB0, 0xE2, 0xED, 0x3F, 0xD8, 0xB1, 0x5F, 0xFF, 0xA2, 0x7F, 0x36, 0xD4, 0x77, 0x92, 0x7A, 0x1E,
+    0x4E, 0x73, 0xC2, 0x3C, 0x79, 0xE6, 0x2F, 0x7F, 0x10, 0x67, 0xFF, 0x24, 0x6A, 0x89, 0x54, 0x11,
+    0x1D, 0xE1, 0x24, 0xDC, 0x03, 0x79, 0xBD, 0x2A, 0xE0, 0x5F, 0x2C, 0xEC, 0xD7, 0xBF, 0x78, 0xF9,
+    0xD9, 0x70, 0xE1, 0x8E, 0x02, 0xBE, 0x72, 0xFE, 0xB3, 0xB3, 0xD3, 0xA5, 0xBE, 0x76, 0x8E, 0x72,
+    0x49, 0xB6, 0x84, 0x75, 0x0A, 0x91, 0x37, 0x45, 0xBA, 0xE3, 0x08, 0x5A, 0x54, 0x84, 0x1D, 0xB0,
+    0xA3, 0x90, 0x8F, 0xB0, 0xC1, 0x63, 0x96, 0x99, 0xF6, 0xEB, 0xC4, 0x75, 0x36, 0xCA, 0xED, 0xA7,
+    0xAD, 0xC8, 0x95, 0x0F, 0xB6, 0xB7, 0xCA, 0xB1, 0x43, 0x4B, 0xC8, 0x56, 0x12, 0xC9, 0xBA, 0xE3,
+    0x3F, 0xDD, 0x5E, 0x42, 0x8E, 0xD5, 0xAD, 0xF6, 0xEB, 0xC4, 0xAC, 0xDD, 0xDC, 0xDE, 0xB3, 0x22,
+    0x97, 0xB7, 0xBF, 0xDC, 0xA2, 0x57, 0x1F, 0xBE, 0x32, 0x15, 0x70, 0x2F, 0x60, 0xBC, 0x42, 0x45,
+    0x15, 0xD9, 0x51, 0x1D, 0x05, 0x1D, 0xDA, 0x77, 0x10, 0x45, 0x24, 0x55, 0xFB, 0xFB, 0xFB, 0xBA,
+    0x9D, 0xE6, 0x8F, 0x5E, 0x05, 0x39, 0x1E, 0x6D, 0x9F, 0x9A, 0x02, 0xED, 0x6C, 0x3D, 0x26, 0x37,
+    0xBD, 0x20, 0x22, 0xD7, 0x57, 0x29, 0x1B, 0xA5, 0x88, 0x3C, 0x27, 0x22, 0xED, 0xFA, 0x0A, 0x74,
+    0x7E, 0xEC, 0x36, 0x3F, 0xF8, 0x34, 0xCD, 0x5E, 0xA8, 0xED, 0x8F, 0x92, 0xED, 0x9B, 0x57, 0xFF,
+    0xFB, 0x47, 0x5F, 0xF9, 0xC2, 0x0B, 0xFF, 0x91, 0xFA, 0x51, 0xE0, 0x99, 0x57, 0x58, 0x7F, 0x94,
+    0xFC, 0x05, 0x97, 0xFD, 0xA8, 0xE5, 0xD2, 0x25, 0xD6, 0xD7, 0xC9, 0x5F, 0xA8, 0xB3, 0x1F, 0xDD,
+    0xE6, 0x7B, 0xCC, 0xFC, 0x04, 0x15, 0xE6, 0x75, 0x23, 0xD2, 0x97, 0x53, 0x4E, 0xC6, 0x25, 0x60,
+    0xBD, 0x11, 0x59, 0x96, 0xA3, 0xD9, 0x3C, 0xE1, 0x3F, 0x47, 0x06, 0x82, 0x73, 0x77, 0x96, 0x77,
+    0xE9, 0x12, 0xEB, 0x8F, 0x62, 0x5E, 0x70, 0x63, 0xB5, 0xEA, 0xA1, 0x47, 0xFF, 0xF6, 0xB5, 0x17,
+    0xFE, 0xAB, 0xF2, 0x47, 0xCB, 0xAC, 0x3F, 0x64, 0x7D, 0x7D, 0x1A, 0xB1, 0xE3, 0xED, 0x6B, 0xDA,
+    0x61, 0x42, 0xE1, 0xD8, 0xC1, 0x3A, 0x2D, 0x22, 0x54, 0x22, 0xA2, 0x3D, 0x58, 0xEB, 0x60, 0xC7,
+    0x8A, 0x88, 0xB7, 0x22, 0x09, 0x8B, 0xF1, 0x58, 0xB7, 0x03, 0x0F, 0x1E, 0x1B, 0x3D, 0x23, 0xB0,
+    0xA2, 0xAF, 0x45, 0x28, 0xBF, 0x14, 0x20, 0x95, 0x35, 0x26, 0x54, 0x50, 0x72, 0x00, 0xBD, 0x5A,
+    0xEE, 0x5F, 0xF4, 0x5A, 0x44, 0xC8, 0x3F, 0xF8, 0xA3, 0x0E, 0xEB, 0x73, 0x4F, 0xE5, 0x66, 0xB0,
+    0xA7, 0xE2, 0x18, 0xF4, 0x9B, 0x75, 0x9B, 0xA0, 0x6F, 0x44, 0xB0, 0xAF, 0x39, 0x28, 0xD2, 0xCA,
+    0x95, 0xD1, 0xAC, 0x42, 0xDE, 0xD4, 0xE4, 0x6D, 0xCA, 0xC5, 0xEB, 0x5B, 0xC2, 0x63, 0xAA, 0x1F,
+    0xA1, 0xD4, 0xDD, 0x71, 0xF4, 0x66, 0xE4, 0xD7, 0x62, 0x2E, 0xA2, 0xBB, 0x22, 0x2E, 0x98, 0x15,
+    0x4E, 0xFF, 0x38, 0xB2, 0xB9, 0x89, 0x79, 0xD5, 0xB3, 0x58, 0x60, 0x5F, 0xF0, 0x2A, 0x2E, 0x98,
+    0xE5, 0xC1, 0xF8, 0xB9, 0xEA, 0xB4, 0x0C, 0x53, 0x44, 0xD9, 0x24, 0x1A, 0xAE, 0x8B, 0xA4, 0xB3,
+    0xA3, 0x63, 0x16, 0x7D, 0x94, 0x01, 0x67, 0xFF, 0xCD, 0x59, 0xF3, 0x73, 0x91, 0x41, 0x44, 0xEE,
+    0xBE, 0xE3, 0xD1, 0x1F, 0x6C, 0x3F, 0x31, 0x82, 0x16, 0x72, 0x64, 0xC9, 0xDC, 0xE7, 0xB4, 0xA3,
+    0x94, 0xAE, 0xC2, 0x88, 0x7C, 0x18, 0x69, 0x2E, 0x18, 0xC1, 0x44, 0x74, 0x4F, 0xC5, 0xC8, 0x51,
+    0xB3, 0x9F, 0xB7, 0xD6, 0x53, 0x5A, 0x3F, 0x23, 0xEB, 0x4A, 0xD5, 0x53, 0xB8, 0x5D, 0x13, 0x54,
+    0xA7, 0xBA, 0xC2, 0x15, 0xCE, 0x84, 0x5D, 0xD5, 0x51, 0x3E, 0xD1, 0x17, 0x8E, 0x85, 0x8E, 0x3D,
+    0x3A, 0xE6, 0x7F, 0x51, 0x53, 0xBA, 0xA2, 0x87, 0x44, 0xE9, 0x29, 0x02, 0x12, 0x4E, 0x2C, 0xB1,
+    0x17, 0x45, 0x02, 0xA9, 0x90, 0x1E, 0xE5, 0xD5, 0xD9, 0x3B, 0x23, 0x31, 0x54, 0xBF, 0x8A, 0xCE,
+    0x9F, 0xFB, 0x09, 0xE7, 0xB7, 0x15, 0x70, 0xE9, 0x00, 0xF4, 0xEB, 0x3D, 0x14, 0x3A, 0x42, 0x9F,
+    0x07, 0x8C, 0x2F, 0x3C, 0x25, 0x15, 0x74, 0x1C, 0x92, 0x7B, 0x12, 0x33, 0x74, 0x54, 0x53, 0x78,
+    0xB5, 0xF5, 0x9B, 0x50, 0x3D, 0xD9, 0xC1, 0xA1, 0x15, 0x91, 0x54, 0xC9, 0x4A, 0x22, 0x89, 0x88,
+    0x5C, 0x15, 0x11, 0xB1, 0x77, 0x8E, 0xF7, 0x00, 0xBD, 0x4A, 0x98, 0x31, 0xA9, 0x22, 0x6F, 0xF9,
+    0xE8, 0x78, 0xE7, 0xBF, 0xF6, 0x78, 0x4F, 0xD2, 0x50, 0x5A, 0x23, 0x22, 0x75, 0xF3, 0xCF, 0x27,
+    0x80, 0xB0, 0x5A, 0x31, 0x60, 0xEB, 0xA7, 0x7C, 0x62, 0xD5, 0x4D, 0x49, 0x88, 0x72, 0x4E, 0x44,
+    0x86, 0xDD, 0x55, 0x1F, 0xE8, 0xB8, 0xCA, 0x67, 0xB2, 0x7E, 0x15, 0x2F, 0x5C, 0xDC, 0xDC, 0xDE,
+    0x1E, 0x81, 0xBC, 0x13, 0x72, 0x24, 0xCD, 0xC7, 0x94, 0xC2, 0x88, 0x6A, 0x64, 0xC9, 0x5C, 0xA4,
+    0xCF, 0x6F, 0x3E, 0x19, 0x99, 0x63, 0x6B, 0x1D, 0xD9, 0xA0, 0x44, 0x45, 0x12, 0xB6, 0x36, 0x81,
+    0x0D, 0x0A, 0x97, 0x45, 0x1A, 0x11, 0xF9, 0x99, 0x88, 0xC8, 0x9B, 0x41, 0x45, 0x8A, 0xDA, 0xD6,
+    0x54, 0x6C, 0xC2, 0xC1, 0x8A, 0x46, 0x35, 0x6C, 0x82, 0x92, 0x0F, 0xB6, 0xB7, 0x94, 0x88, 0xB4,
+    0xCC, 0x45, 0x6A, 0x15, 0x57, 0xC2, 0xE9, 0xD4, 0x44, 0x5A, 0x67, 0x44, 0xA4, 0x6D, 0xDE, 0xD9,
+    0xDE, 0x36, 0xDD, 0x0A, 0x0F, 0xED, 0x01, 0xD3, 0xDE, 0xB7, 0x7D, 0xB6, 0x14, 0x91, 0x7E, 0x2E,
+    0x22, 0x7F, 0xD9, 0xDD, 0x49, 0x4C, 0x0B, 0x14, 0xCB, 0xFD, 0xFD, 0x0B, 0xB9, 0x88, 0xD4, 0xEA,
+    0xAB, 0xFB, 0xDF, 0x9D, 0x1C, 0x6A, 0x37, 0xC9, 0xC7, 0x09, 0xB9, 0xD6, 0xD4, 0x53, 0xE4, 0xF2,
+    0x58, 0xE6, 0xDE, 0xCA, 0x09, 0xA4, 0x3A, 0xC0, 0xBC, 0x29, 0x22, 0xF2, 0x2F, 0xC7, 0x4C, 0xDE,
+    0xA9, 0xF7, 0xC2, 0xF4, 0xE8, 0x38, 0x79, 0x3C, 0xA8, 0x41, 0x6D, 0x6F, 0x37, 0xA1, 0x14, 0x49,
+    0x34, 0x2B, 0x95, 0x64, 0x8C, 0x06, 0x9D, 0x8D, 0xCB, 0xE6, 0x02, 0x8D, 0x48, 0x87, 0x6E, 0x9F,
+    0xEA, 0xC9, 0xBD, 0xEE, 0xB0, 0xE8, 0xC8, 0x26, 0xA6, 0x65, 0x81, 0xF5, 0x44, 0x0A, 0xA7, 0x5B,
+    0x76, 0xE7, 0x22, 0x72, 0x53, 0x44, 0xA4, 0x65, 0x93, 0xC2, 0xB1, 0xE0, 0x00, 0x15, 0x75, 0x44,
+    0x87, 0xA2, 0x26, 0xAF, 0x13, 0x14, 0x45, 0xB8, 0x6F, 0x7B, 0x3E, 0x64, 0x22, 0x12, 0xF2, 0x51,
+    0x8C, 0xE8, 0xB0, 0xEA, 0xAC, 0x35, 0x98, 0x8B, 0x5C, 0xC8, 0x44, 0xA4, 0x53, 0xDB, 0xDB, 0xE7,
+    0xBA, 0x23, 0xD4, 0x39, 0x02, 0xB9, 0xDF, 0xDE, 0xDE, 0x2A, 0xBF, 0x28, 0x23, 0x7B, 0x94, 0x8E,
+    0x11, 0xEF, 0x3D, 0x26, 0xA6, 0xBC, 0xBC, 0xBF, 0x7F, 0x71, 0x4C, 0x25, 0xB9, 0x7F, 0x7F, 0x7F,
+    0xEB, 0x38, 0x65, 0x55, 0x86, 0xB9, 0x88, 0x2C, 0x5D, 0xC5, 0x98, 0x8C, 0xA4, 0x7A, 0x2A, 0xC6,
+    0xF4, 0xA3, 0xDF, 0xE3, 0x69, 0x73, 0x81, 0x73, 0x6F, 0x37, 0x52, 0x57, 0xF2, 0x7F, 0xED, 0xBF,
+    0x98, 0x8D, 0xD1, 0x36, 0x4A, 0x56, 0xDC, 0x7E, 0x09, 0xC9, 0x74, 0x18, 0x5F, 0x7A, 0x36, 0x10,
+    0x32, 0xA7, 0xFB, 0x95, 0x6B, 0xAA, 0x61, 0xF2, 0xA0, 0xD9, 0x30, 0x25, 0x3A, 0x58, 0x3F, 0xAA,
+    0xA7, 0xEC, 0x1D, 0x45, 0x16, 0x4E, 0x01, 0xC3, 0x45, 0xCD, 0x83, 0x3A, 0x8E, 0x81, 0xB2, 0x1B,
+    0x65, 0xCD, 0x03, 0x57, 0x57, 0x0B, 0xB8, 0xDE, 0xDF, 0xDF, 0x7F, 0x71, 0xD4, 0x21, 0x46, 0xBB,
+    0xB1, 0x00, 0x5B, 0x63, 0x3C, 0x59, 0x0B, 0xDD, 0x14, 0xD7, 0x74, 0x7C, 0x55, 0xB7, 0xB0, 0x8A,
+    0x76, 0xA2, 0x1C, 0x3D, 0x76, 0x1E, 0xDD, 0xA2, 0x22, 0x5C, 0x5A, 0x5D, 0x55, 0xA3, 0x98, 0x2A,
+    0x46, 0x7E, 0xBC, 0x03, 0xD6, 0x91, 0x45, 0xD8, 0x1C, 0xF9, 0x74, 0x84, 0xD9, 0x68, 0xFE, 0xF7,
+    0x50, 0x8E, 0x83, 0xBB, 0x18, 0x25, 0xFB, 0xF4, 0x78, 0x8D, 0x3A, 0x7E, 0x7C, 0x8B, 0xB5, 0x11,
+    0x42, 0xB0, 0xA8, 0x3A, 0x9E, 0xAA, 0xBE, 0x64, 0xFD, 0xE1, 0x87, 0x2D, 0xD2, 0x61, 0x06, 0x8C,
+    0x0C, 0x59, 0x7F, 0x23, 0x3D, 0x6A, 0x4D, 0x3D, 0x3E, 0x32, 0x59, 0xDB, 0x4D, 0x5B, 0x5E, 0x7C,
+    0xD5, 0x6F, 0x5E, 0xCA, 0xAE, 0xBB, 0x87, 0x2E, 0x65, 0xD7, 0xC2, 0x4E, 0x29, 0xEE, 0x5C, 0x7D,
+    0x04, 0x5F, 0xAA, 0xAD, 0x95, 0xDB, 0x3A, 0x4C, 0x42, 0xF6, 0x28, 0x6F, 0xA8, 0x5C, 0xCD, 0xA5,
+    0xCD, 0x95, 0x57, 0x7B, 0xB1, 0xB6, 0x8D, 0xAD, 0x25, 0xAA, 0x68, 0x85, 0x92, 0xAC, 0xD3, 0x2D,
+    0xB6, 0xDE, 0x1C, 0x5D, 0xF3, 0xB9, 0xEF, 0x61, 0xD7, 0x3A, 0xF4, 0xFB, 0x11, 0xCA, 0x75, 0x50,
+    0x3F, 0x0F, 0x93, 0x83, 0xBE, 0xF1, 0xD3, 0xDC, 0xAC, 0x56, 0x65, 0x4E, 0x90, 0xD5, 0xDC, 0xAD,
+    0x97, 0xCB, 0xFC, 0xCD, 0xD7, 0x6F, 0xB6, 0xAF, 0xE8, 0x64, 0x29, 0x88, 0xAA, 0xCB, 0xEB, 0xB9,
+    0x9F, 0x5F, 0x2C, 0x9E, 0x13, 0xBF, 0xA7, 0xB6, 0xB8, 0x90, 0xF5, 0x1C, 0x22, 0x71, 0x9E, 0x66,
+    0xF9, 0x37, 0xBE, 0xF0, 0xA6, 0xAF, 0xFC, 0xFA, 0x33, 0x74, 0xEA, 0x5A, 0x5D, 0xD4, 0x0F, 0xED,
+    0xE8, 0xA5, 0x7E, 0xE3, 0x56, 0x5C, 0x26, 0x9B, 0xB4, 0x70, 0xDF, 0x94, 0x82, 0xA4, 0xE2, 0xAA,
+    0xBD, 0xC5, 0x2A, 0x29, 0xE0, 0xB7, 0xBC, 0xF4, 0xEE, 0xFE, 0xFE, 0x7E, 0x21, 0x22, 0x69, 0x7E,
+    0xC4, 0xEA, 0x8F, 0x12, 0x30, 0x2B, 0x18, 0x5F, 0x25, 0x33, 0xCE, 0x46, 0xEB, 0x57, 0x33, 0x31,
+    0x3F, 0xF2, 0xDD, 0x98, 0xC8, 0x14, 0x90, 0xA9, 0xFB, 0x55, 0xB6, 0x98, 0x3A, 0x7E, 0x3D, 0xCB,
+    0x70, 0x94, 0x47, 0x36, 0x07, 0xA8, 0xDE, 0xDD, 0xDF, 0xFF, 0x56, 0x25, 0x22, 0x43, 0x29, 0x22,
+    0xE2, 0x4E, 0xCD, 0x7E, 0xC5, 0xF6, 0xB9, 0xB3, 0x6B, 0xA5, 0xF9, 0xFE, 0xE5, 0x1B, 0x71, 0x67,
+    0x51, 0xFC, 0x66, 0x27, 0xF7, 0x67, 0x53, 0x50, 0xC6, 0x98, 0x3C, 0xD8, 0xAE, 0x7C, 0xD2, 0xEF,
+    0x39, 0x28, 0x66, 0x40, 0xBF, 0x60, 0x74, 0x77, 0x97, 0x3A, 0x42, 0x6F, 0x3C, 0xC6, 0xDB, 0x9A,
+    0x92, 0x12, 0x7A, 0x76, 0x47, 0x73, 0xB5, 0x22, 0x8B, 0x74, 0xE8, 0x90, 0x7B, 0xAC, 0x9F, 0x41,
+    0xF1, 0x44, 0x07, 0x33, 0xEB, 0x61, 0x31, 0x3B, 0x0A, 0xD0, 0xEF, 0xC1, 0xFC, 0x20, 0x42, 0x69,
+    0x02, 0xF4, 0xB6, 0xC6, 0xF8, 0x92, 0x51, 0x42, 0x74, 0x24, 0x72, 0xAF, 0x22, 0x33, 0x74, 0xAB,
+    0x3A, 0x72, 0x9F, 0x7B, 0x0A, 0x37, 0x83, 0x99, 0x8A, 0x53, 0x50, 0x7B, 0xB7, 0x09, 0xD9, 0x8D,
+    0x08, 0xE6, 0xB5, 0x7A, 0x9A, 0x58, 0xE5, 0x2A, 0x15, 0x85, 0x04, 0x9C, 0xF8, 0xD6, 0x18, 0x19,
+    0x33, 0x17, 0x71, 0x73, 0x67, 0xBA, 0x0A, 0x2A, 0x5B, 0x93, 0xBF, 0x1A, 0x46, 0x8F, 0xFB, 0xE6,
+    0x02, 0xEC, 0x45, 0xD0, 0xD7, 0x3D, 0xDC, 0x8A, 0x30, 0xFB, 0xF5, 0x2E, 0xD4, 0x53, 0x76, 0xC1,
+    0xC7, 0xFD, 0xDF, 0x45, 0xD0, 0xD7, 0xFC, 0x18, 0x79, 0xB1, 0x3B, 0x83, 0xD2, 0x06, 0x8A, 0xCB,
+    0x4B, 0x4A, 0x5F, 0x88, 0x04, 0x1A, 0xA9, 0x51, 0xDB, 0x00, 0x27, 0x2E, 0xC0, 0x3C, 0xC1, 0x72,
+    0x20, 0x8B, 0x1B, 0xA3, 0x21, 0xBC, 0xDA, 0xC3, 0x6F, 0xBF, 0xE7, 0x01, 0x72, 0xCF, 0x86, 0xF5,
+    0xCC, 0x2F, 0x3A, 0xAA, 0x61, 0xAC, 0x71, 0xB4, 0x19, 0xF5, 0xE4, 0x59, 0x84, 0xB9, 0x03, 0xFE,
+    0x21, 0x7F, 0xFD, 0xB6, 0x06, 0xCA, 0x2D, 0xA1, 0xBC, 0x9A, 0x40, 0x6C, 0x4B, 0x96, 0xD6, 0x18,
+    0x63, 0x96, 0x70, 0x4B, 0x28, 0x8E, 0xAF, 0x7F, 0x82, 0xBB, 0x40, 0xED, 0x5F, 0xB2, 0x9D, 0xFA,
+    0x68, 0x4B, 0x4E, 0x02, 0xF6, 0xFB, 0x37, 0x87, 0x3F, 0x38, 0x4A, 0x82, 0xA8, 0xCE, 0x5D, 0xEB,
+    0xFE, 0xE1, 0x6F, 0x5C, 0xC9, 0x2F, 0x6B, 0xF5, 0x2F, 0xC6, 0x00, 0xD5, 0x77, 0x58, 0xD3, 0xD2,
+    0xE9, 0xAB, 0x1F, 0x34, 0xD7, 0x43, 0xAB, 0x24, 0xDC, 0xAE, 0x7E, 0xB1, 0xBF, 0xBF, 0xFF, 0x9D,
+    0x4A, 0x44, 0xD6, 0xB6, 0xB7, 0xB7, 0x8F, 0x6A, 0xFE, 0xFC, 0xFE, 0xFE, 0xBE, 0x15, 0x91, 0xCB,
+    0xDB, 0xDB, 0xDB, 0x5B, 0xD9, 0x05, 0x9E, 0x90, 0xB0, 0x5E, 0x35, 0x6F, 0xBD, 0xE9, 0x9B, 0xFE,
+    0x61, 0x0E, 0xF8, 0x1C, 0xF7, 0x14, 0x43, 0xF6, 0x86, 0x0C, 0x07, 0x3B, 0xB9, 0x3C, 0xCF, 0x03,
+    0xED, 0x49, 0x50, 0xF6, 0xD6, 0x7E, 0x73, 0x45, 0x44, 0x5A, 0xF5, 0xD5, 0x6F, 0x1F, 0x17, 0x7F,
+    0x7F, 0xF3, 0x5D, 0x44, 0x24, 0xCD, 0xBE, 0xB9, 0x7D, 0x71, 0xBA, 0xF4, 0x30, 0x6C, 0xAC, 0x6D,
+    0x9F, 0xFB, 0xBB, 0x22, 0x69, 0xFF, 0xE2, 0x3E, 0xB9, 0x43, 0x7B, 0xF5, 0xE5, 0x1F, 0x9E, 0x15,
+    0x91, 0x3F, 0xBC, 0xB5, 0x5F, 0xC7, 0xE9, 0xBD, 0x4E, 0x77, 0xB5, 0x62, 0x55, 0xE0, 0xBD, 0xFB,
+    0xFB, 0xFB, 0xCF, 0x8B, 0x48, 0xDC, 0xDE, 0xDE, 0x3E, 0xD2, 0x8B, 0xB3, 0x49, 0xE6, 0xA5, 0xFB,
+    0x26, 0x3F, 0xE0, 0x98, 0x79, 0x3F, 0xF7, 0xCC, 0x5B, 0xE6, 0x81, 0x79, 0xA0, 0x0A, 0xE8, 0x01,
+    0xF2, 0x01, 0xF2, 0x7E, 0xDC, 0x8B, 0x7E, 0xC4, 0x22, 0x4E, 0x1E, 0x85, 0x9C, 0xC8, 0xD5, 0x31,
+    0xC0, 0x4C, 0x05, 0xA8, 0x02, 0x34, 0x35, 0x48, 0x8D, 0x9A, 0xF6, 0x2C, 0xA1, 0x9A, 0x5A, 0xC9,
+    0xF4, 0xA1, 0xAC, 0x8F, 0xD0, 0x87, 0x3B, 0xFE, 0x3E, 0x65, 0x6C, 0x65, 0x9E, 0x22, 0xD2, 0x38,
+    0xB3, 0xA4, 0xEC, 0x94, 0xB8, 0xBC, 0x67, 0x1E, 0xB2, 0x25, 0xB6, 0x63, 0x5E, 0x53, 0x05, 0xC4,
+    0x51, 0x74, 0x34, 0x1E, 0x33, 0x50, 0xB6, 0x64, 0xE2, 0xF2, 0x1E, 0x1A, 0x6F, 0x96, 0x50, 0xAE,
+    0x58, 0xCD, 0x54, 0x41, 0x4B, 0xEE, 0xC8, 0x7B, 0xAA, 0x80, 0x59, 0x52, 0x76, 0xD0, 0xD4, 0x66,
+    0x80, 0xB2, 0x55, 0xE2, 0xC8, 0x23, 0x73, 0xCF, 0xDC, 0x67, 0x4B, 0x8A, 0xA9, 0x96, 0xA2, 0x1B,
+    0x9F, 0x28, 0x3B, 0xA4, 0x66, 0x17, 0xDD, 0xAE, 0xCA, 0x9A, 0xCB, 0x2D, 0x97, 0x89, 0x48, 0x3C,
+    0xB1, 0xBF, 0x7F, 0xF1, 0x48, 0xD9, 0x32, 0x71, 0x95, 0x8A, 0x55, 0xB8, 0x49, 0x92, 0xAA, 0xFE,
+    0x0E, 0x65, 0x2B, 0x4D, 0xCA, 0xD6, 0x4B, 0xC3, 0x4A, 0xD9, 0xBA, 0x70, 0x14, 0x1C, 0x7E, 0xE9,
+    0x8E, 0x64, 0xB2, 0x4B, 0x70, 0xBF, 0x48, 0xB0, 0x22, 0xF2, 0xAC, 0xEC, 0x2F, 0xBF, 0x5B, 0x04,
+    0x1D, 0x18, 0x46, 0x28, 0x70, 0x41, 0xE1, 0x74, 0x60, 0x41, 0x41, 0x16, 0x59, 0x60, 0x82, 0x0E,
+    0xD8, 0xDA, 0x42, 0xE5, 0x16, 0x50, 0x9D, 0x69, 0x61, 0xFE, 0xDE, 0xFE, 0xBE, 0xAB, 0x44, 0x96,
+    0x98, 0x5B, 0xFB, 0xDF, 0x1A, 0x95, 0xD2, 0x9D, 0x95, 0x25, 0x6F, 0x1D, 0x47, 0xAF, 0x1F, 0x73,
+    0xB7, 0xD5, 0xB8, 0xAA, 0x5F, 0x8D, 0x11, 0x80, 0x22, 0xFE, 0xFE, 0xFD, 0x8B, 0x4D, 0x80, 0x4B,
+    0x45, 0x40, 0x87, 0xC2, 0x53, 0x50, 0xC2, 0x62, 0x44, 0x9E, 0x7B, 0xEC, 0xA8, 0xC8, 0x16, 0x4E,
+    0x07, 0x12, 0x16, 0x13, 0x59, 0xD0, 0x9C, 0x78, 0xE9, 0xD6, 0xC5, 0xAE, 0x14, 0x59, 0xF2, 0xD5,
+    0xE5, 0xBE, 0x9B, 0x6A, 0xBC, 0xA3, 0xFE, 0xB5, 0x3B, 0x52, 0x41, 0xDA, 0x52, 0x44, 0x9E, 0x5B,
+    0xBA, 0x49, 0x6A, 0xA6, 0x55, 0xAC, 0x43, 0xB1, 0xCA, 0x31, 0x54, 0x47, 0x1A, 0xAB, 0xF5, 0x2B,
+    0x01, 0x5B, 0x85, 0x71, 0xBE, 0x8C, 0x79, 0x2D, 0xA8, 0xD5, 0xFC, 0xDE, 0xDE, 0xDE, 0xDE, 0xCE,
+    0x57, 0x9A, 0x6E, 0x3F, 0x29, 0xFD, 0x52, 0xE7, 0x93, 0x4B, 0xFB, 0x5C, 0xBB, 0x12, 0xC9, 0x63,
+    0x51, 0x6E, 0xF5, 0xBE, 0xA5, 0xA3, 0x71, 0x2A, 0x56, 0x02, 0x24, 0x6F, 0x41, 0x49, 0x2E, 0x22,
+    0xB1, 0x14, 0x19, 0xB8, 0x6F, 0xB5, 0x2E, 0xD4, 0xF6, 0xF6, 0x64, 0x79, 0x8C, 0xEF, 0xFB, 0xE1,
+    0x3E, 0x56, 0x2F, 0x46, 0xF8, 0xC9, 0x4F, 0x7A, 0x6C, 0x7D, 0x3E, 0xF7, 0xD6, 0x9D, 0x66, 0xC7,
+    0xD4, 0xC6, 0xE5, 0x67, 0xBC, 0x0A, 0xBC, 0x1F, 0x38, 0xCF, 0xA3, 0x2F, 0x73, 0x1A, 0xBD, 0xC0,
+    0x38, 0xE4, 0x78, 0x8B, 0x9C, 0x46, 0xFF, 0x15, 0xC6, 0x71, 0xCD, 0xA9, 0xC0, 0xF9, 0xC8, 0x79,
+    0x36, 0xD6, 0x39, 0xCD, 0xBA, 0x0E, 0xC6, 0x15, 0xCC, 0x54, 0x28, 0xC9, 0x6E, 0xFE, 0x9F, 0x87,
+    0x50, 0xC8, 0x30, 0x85, 0x7C, 0xDE, 0x5E, 0xE7, 0x3B, 0x9F, 0xEE, 0xB1, 0x35, 0xB9, 0xB7, 0x0E,
+    0x76, 0x4C, 0x0D, 0xF9, 0x19, 0x0F, 0xBC, 0x1F, 0x80, 0x47, 0x5F, 0x06, 0xF4, 0x62, 0x65, 0x90,
+    0x1E, 0xD5, 0x09, 0xFA, 0xAF, 0x00, 0xAE, 0x39, 0xE0, 0x7C, 0x04, 0x36, 0xD6, 0x81, 0x75, 0x1D,
+    0xA0, 0x60, 0x06, 0x25, 0xD9, 0x4D, 0xF5, 0x6B, 0xD4, 0xE9, 0x51, 0xC9, 0x2C, 0x50, 0x1F, 0x9E,
+    0x79, 0xD5, 0xAB, 0xEE, 0xFD, 0xB0, 0xA3, 0xBA, 0xD3, 0x2F, 0x9B, 0xCB, 0x9D, 0x5E, 0xB0, 0x1B,
+    0x11, 0x4C, 0xA4, 0xF2, 0x2A, 0x61, 0xA3, 0xFA, 0xD0, 0xEB, 0xBF, 0x52, 0x71, 0x87, 0x6B, 0x4F,
+    0x44, 0xE3, 0xCF, 0xBF, 0x1F, 0xD9, 0xD9, 0x58, 0x8F, 0x98, 0xFF, 0x4F, 0x47, 0x98, 0x7F, 0x9C,
+    0x3A, 0x1D, 0x2A, 0x99, 0x1A, 0xF5, 0xE1, 0x19, 0x8F, 0xEA, 0xDE, 0x0F, 0xA8, 0xEE, 0xF4, 0xCB,
+    0xA8, 0x4E, 0x2F, 0x50, 0x1D, 0x82, 0xEA, 0xA8, 0xBC, 0xEA, 0xB0, 0x51, 0x75, 0xE8, 0xBF, 0x52,
+    0x1D, 0x5C, 0x7B, 0xA2, 0x83, 0xF3, 0xEF, 0x77, 0xB0, 0xB1, 0xDE, 0xC1, 0xBA, 0xEE, 0x7E, 0x05,
+    0x9D, 0x1C, 0xA7, 0x1A, 0x7D, 0x24, 0xF7, 0xE8, 0xE3, 0x5D, 0x38, 0xB1, 0xDF, 0xEC, 0xFF, 0x8F,
+    0x22, 0xB2, 0x6C, 0x44, 0xA4, 0xBE, 0xF7, 0x4C, 0xAA, 0xAE, 0xF4, 0x70, 0x2F, 0xEA, 0x45, 0x3E,
+    0x67, 0xA3, 0x1A, 0x28, 0xAF, 0x26, 0x9A, 0xDA, 0xC6, 0x01, 0xEB, 0xD5, 0xED, 0x11, 0x7C, 0x27,
+    0x2E, 0x40, 0xF3, 0x76, 0x93, 0xC8, 0x45, 0x6E, 0x2D, 0x29, 0xEB, 0xB9, 0x7F, 0x94, 0x5D, 0x6C,
+    0x0D, 0x89, 0xC2, 0xA1, 0x7A, 0x4A, 0x50, 0x1D, 0x25, 0x3C, 0x20, 0x22, 0xE2, 0xE7, 0x22, 0x22,
+    0xFE, 0xD3, 0x37, 0xB7, 0xE7, 0xDF, 0x74, 0xE3, 0xF5, 0xDF, 0xEC, 0xF8, 0x80, 0x3C, 0x21, 0x03,
+    0x95, 0x3C, 0x2F, 0x4B, 0xE0, 0xFE, 0x2D, 0x28, 0xA4, 0x43, 0x2D, 0x2F, 0x46, 0x6C, 0x6D, 0x3D,
+    0x0B, 0x3E, 0x35, 0xAE, 0xE2, 0xC2, 0x4D, 0x96, 0xD4, 0x03, 0x22, 0xA2, 0x44, 0x24, 0xA9, 0x73,
+    0xDF, 0xFC, 0x72, 0x64, 0x97, 0xDC, 0xAB, 0x8E, 0x12, 0x13, 0x58, 0x8C, 0x58, 0xC0, 0xAF, 0xBA,
+    0x74, 0x6E, 0x30, 0xF2, 0x63, 0xE9, 0x2B, 0xF1, 0x70, 0xFF, 0x37, 0x21, 0x97, 0x04, 0xCB, 0x8B,
+    0x11, 0x1B, 0x72, 0xCF, 0x01, 0x25, 0x3A, 0xB2, 0xA0, 0xA8, 0xA7, 0x3F, 0x3D, 0x20, 0x5D, 0xA9,
+    0x44, 0xDA, 0x85, 0x3A, 0xF7, 0xCD, 0xEC, 0xB7, 0xAA, 0x6D, 0x0A, 0x14, 0x2F, 0x6F, 0x16, 0x12,
+    0xA1, 0x11, 0x79, 0x77, 0x09, 0x87, 0x4A, 0x6A, 0xEB, 0xD9, 0xC5, 0x7A, 0x15, 0xA8, 0x26, 0xA6,
+    0x50, 0x67, 0x13, 0x0F, 0x5A, 0x4C, 0xF4, 0x8A, 0xC4, 0x42, 0x64, 0x45, 0xF4, 0xCD, 0xED, 0xF9,
+    0x78, 0xD3, 0x8E, 0xB5, 0xE8, 0xB1, 0x46, 0xD2, 0x58, 0x7B, 0xF5, 0x71, 0x6E, 0x9E, 0x90, 0x30,
+    0x1F, 0x8C, 0xBC, 0x21, 0x7D, 0x25, 0xCF, 0x8F, 0x2C, 0x4C, 0x7D, 0x7B, 0x0B, 0xCA, 0x9B, 0xB9,
+    0x24, 0x68, 0xE4, 0xBD, 0x77, 0x05, 0x0E, 0x33, 0xF1, 0x53, 0x33, 0x75, 0x1C, 0x33, 0x37, 0x13,
+    0x45, 0xAD, 0xBA, 0xB1, 0xBC, 0x03, 0xAC, 0x7F, 0x40, 0x44, 0xE4, 0xCC, 0xD8, 0xCC, 0x30, 0x36,
+    0x73, 0xAB, 0xFA, 0xBD, 0x35, 0x53, 0x7D, 0x8B, 0x55, 0x68, 0x5A, 0x75, 0xB1, 0x06, 0xE3, 0xCF,
+    0x03, 0x89, 0x1C, 0x6C, 0xAD, 0xE2, 0x34, 0xB9, 0x4A, 0x97, 0xC5, 0xB1, 0xFF, 0x5E, 0x15, 0x11,
+    0x49, 0xE3, 0x74, 0x2D, 0x5C, 0xB6, 0x7A, 0xE0, 0xD7, 0x39, 0xED, 0x50, 0x1D, 0x65, 0xFD, 0xB7,
+    0x9B, 0x4E, 0x89, 0x54, 0x52, 0xE7, 0xE2, 0xA7, 0x77, 0x4E, 0x9C, 0xF8, 0xD6, 0x98, 0x7B, 0x1B,
+    0x80, 0xE2, 0xFA, 0x00, 0xD8, 0xBA, 0xF0, 0xA0, 0x7D, 0xD6, 0x81, 0x8A, 0xEC, 0x01, 0x1B, 0x14,
+    0x35, 0x3C, 0xED, 0x74, 0x4B, 0x26, 0xBD, 0x91, 0xA5, 0xBE, 0x25, 0x56, 0xE4, 0xB9, 0x98, 0x5F,
+    0x3E, 0xF7, 0x43, 0xD7, 0x13, 0x75, 0x4B, 0xC5, 0x49, 0x7A, 0xF2, 0x31, 0x67, 0x48, 0x5A, 0x6C,
+    0x8D, 0x95, 0x5A, 0xB7, 0x30, 0xEF, 0xE9, 0x81, 0x86, 0x19, 0xBA, 0x36, 0xC1, 0xD6, 0x44, 0x3A,
+    0xDD, 0x32, 0x63, 0xC1, 0xA0, 0xEC, 0xAD, 0x81, 0x4A, 0xAE, 0xC8, 0x80, 0x91, 0x76, 0x6D, 0x6B,
+    0x4A, 0xB3, 0x78, 0x78, 0x4A, 0xED, 0xBD, 0xED, 0xAD, 0x71, 0x63, 0x78, 0x20, 0xEB, 0x4F, 0xB5,
+    0x40, 0xE6, 0xB3, 0x16, 0x58, 0x47, 0xB5, 0x90, 0xA5, 0x3F, 0xCE, 0x5A, 0x28, 0x45, 0x74, 0x4B,
+    0x26, 0x22, 0xB6, 0xA5, 0x14, 0x49, 0x65, 0x9B, 0x89, 0x48, 0x6C, 0xDA, 0x52, 0x44, 0x9E, 0x94,
+    0x1F, 0x89, 0x2C, 0x9D, 0x95, 0x1F, 0x8B, 0x78, 0x44, 0xB4, 0x08, 0xA5, 0x44, 0x2D, 0x29, 0x17,
+    0x41, 0x4B, 0x6C, 0x24, 0xA2, 0xE5, 0x75, 0x11, 0xD0, 0x23, 0xC7, 0xD7, 0xF2, 0x9E, 0x00, 0x3A,
+    0xD9, 0xF1, 0xBD, 0x33, 0x15, 0x80, 0xFE, 0xC1, 0xF8, 0x16, 0x43, 0x39, 0x36, 0xFB, 0x40, 0x1F,
+    0xB3, 0xA1, 0xFF, 0x1F,
 };
 
 static const EpdGlyph bookerly_14_regularGlyphs[] = {
@@ -1799,7 +1845,7 @@ static const EpdGlyph bookerly_14_regularGlyphs[] = {
     { 4, 27, 8, 2, 23, 27, 7146 }, // |
     { 9, 29, 11, 0, 24, 66, 7173 }, // }
     { 14, 6, 18, 2, 13, 21, 7239 }, // ~
-    { 0, 0, 6, 0, 0, 0, 0 }, //  
+    { 0, 0, 6, 0, 0, 0, 7260 }, //  
     { 5, 23, 8, 1, 16, 29, 0 }, // ¡
     { 15, 29, 18, 1, 23, 109, 29 }, // ¢
     { 16, 22, 18, 1, 21, 88, 138 }, // £
@@ -1810,642 +1856,649 @@ static const EpdGlyph bookerly_14_regularGlyphs[] = {
     { 11, 4, 19, 4, 22, 11, 484 }, // ¨
     { 22, 22, 23, 0, 21, 121, 495 }, // ©
     { 11, 14, 13, 1, 21, 39, 616 }, // ª
-    { 15, 11, 15, 1, 13, 42, 655 }, // «
-    { 13, 8, 18, 3, 14, 26, 697 }, // ¬
-    { 9, 3, 11, 1, 9, 7, 723 }, // ­
-    { 17, 16, 17, 0, 23, 68, 730 }, // ®
-    { 10, 3, 19, 5, 21, 8, 798 }, // ¯
-    { 11, 11, 15, 2, 21, 31, 806 }, // °
-    { 13, 17, 18, 3, 17, 56, 837 }, // ±
-    { 11, 14, 13, 1, 24, 39, 893 }, // ²
-    { 9, 14, 13, 2, 24, 32, 932 }, // ³
-    { 6, 7, 19, 7, 24, 11, 964 }, // ´
-    { 18, 23, 19, 2, 16, 104, 975 }, // µ
-    { 15, 26, 16, 0, 21, 98, 1079 }, // ¶
-    { 6, 4, 8, 1, 10, 6, 1177 }, // ·
-    { 6, 7, 19, 7, -1, 11, 1183 }, // ¸
-    { 9, 14, 13, 2, 24, 32, 1194 }, // ¹
-    { 11, 14, 13, 1, 21, 39, 1226 }, // º
-    { 15, 11, 15, 1, 13, 42, 1265 }, // »
-    { 28, 24, 31, 2, 22, 168, 1307 }, // ¼
-    { 28, 24, 31, 2, 22, 168, 1475 }, // ½
-    { 29, 24, 31, 2, 22, 174, 1643 }, // ¾
-    { 11, 23, 14, 1, 16, 64, 1817 }, // ¿
-    { 22, 28, 22, 0, 28, 154, 1881 }, // À
-    { 22, 28, 22, 0, 28, 154, 2035 }, // Á
-    { 22, 28, 22, 0, 28, 154, 2189 }, // Â
-    { 22, 28, 22, 0, 28, 154, 2343 }, // Ã
-    { 22, 27, 22, 0, 27, 149, 2497 }, // Ä
-    { 22, 29, 22, 0, 29, 160, 2646 }, // Å
-    { 27, 21, 27, -1, 21, 142, 2806 }, // Æ
-    { 17, 29, 19, 1, 21, 124, 2948 }, // Ç
-    { 17, 28, 18, 1, 28, 119, 3072 }, // È
-    { 17, 28, 18, 1, 28, 119, 3191 }, // É
-    { 17, 28, 18, 1, 28, 119, 3310 }, // Ê
-    { 17, 27, 18, 1, 27, 115, 3429 }, // Ë
-    { 9, 28, 11, 1, 28, 63, 3544 }, // Ì
-    { 9, 28, 11, 1, 28, 63, 3607 }, // Í
-    { 11, 28, 11, 0, 28, 77, 3670 }, // Î
-    { 11, 27, 11, 0, 27, 75, 3747 }, // Ï
-    { 21, 22, 22, 0, 21, 116, 3822 }, // Ð
-    { 22, 29, 24, 1, 28, 160, 3938 }, // Ñ
-    { 21, 29, 23, 1, 28, 153, 4098 }, // Ò
-    { 21, 29, 23, 1, 28, 153, 4251 }, // Ó
-    { 21, 29, 23, 1, 28, 153, 4404 }, // Ô
-    { 21, 29, 23, 1, 28, 153, 4557 }, // Õ
-    { 21, 28, 23, 1, 27, 147, 4710 }, // Ö
-    { 12, 12, 18, 3, 16, 36, 4857 }, // ×
-    { 22, 22, 23, 0, 21, 121, 4893 }, // Ø
-    { 22, 29, 22, 0, 28, 160, 5014 }, // Ù
-    { 22, 29, 22, 0, 28, 160, 5174 }, // Ú
-    { 22, 29, 22, 0, 28, 160, 5334 }, // Û
-    { 22, 28, 22, 0, 27, 154, 5494 }, // Ü
-    { 20, 28, 20, 0, 28, 140, 5648 }, // Ý
-    { 16, 21, 18, 1, 21, 84, 5788 }, // Þ
-    { 18, 24, 19, 0, 23, 108, 5872 }, // ß
-    { 15, 25, 16, 1, 24, 94, 5980 }, // à
-    { 15, 25, 16, 1, 24, 94, 6074 }, // á
-    { 15, 25, 16, 1, 24, 94, 6168 }, // â
-    { 15, 24, 16, 1, 23, 90, 6262 }, // ã
-    { 15, 23, 16, 1, 22, 87, 6352 }, // ä
-    { 15, 25, 16, 1, 24, 94, 6439 }, // å
-    { 22, 17, 24, 1, 16, 94, 6533 }, // æ
-    { 13, 24, 15, 1, 16, 78, 6627 }, // ç
-    { 13, 25, 15, 1, 24, 82, 6705 }, // è
-    { 13, 25, 15, 1, 24, 82, 6787 }, // é
-    { 13, 25, 15, 1, 24, 82, 6869 }, // ê
-    { 13, 23, 15, 1, 22, 75, 6951 }, // ë
-    { 10, 24, 10, 0, 24, 60, 7026 }, // ì
-    { 10, 24, 10, 0, 24, 60, 7086 }, // í
-    { 10, 24, 10, 0, 24, 60, 7146 }, // î
-    { 11, 22, 10, -1, 22, 61, 7206 }, // ï
-    { 15, 25, 17, 1, 24, 94, 7267 }, // ð
-    { 19, 23, 19, 0, 23, 110, 7361 }, // ñ
-    { 16, 25, 17, 1, 24, 100, 7471 }, // ò
-    { 16, 25, 17, 1, 24, 100, 7571 }, // ó
-    { 16, 25, 17, 1, 24, 100, 7671 }, // ô
-    { 16, 24, 17, 1, 23, 96, 7771 }, // õ
-    { 16, 23, 17, 1, 22, 92, 7867 }, // ö
-    { 13, 14, 18, 3, 17, 46, 7959 }, // ÷
-    { 17, 17, 17, 0, 16, 73, 8005 }, // ø
-    { 19, 25, 19, 0, 24, 119, 8078 }, // ù
-    { 19, 25, 19, 0, 24, 119, 8197 }, // ú
-    { 19, 25, 19, 0, 24, 119, 8316 }, // û
-    { 19, 23, 19, 0, 22, 110, 8435 }, // ü
-    { 18, 31, 17, 0, 24, 140, 8545 }, // ý
-    { 17, 30, 18, 0, 23, 128, 8685 }, // þ
-    { 18, 29, 17, 0, 22, 131, 8813 }, // ÿ
-    { 22, 26, 22, 0, 26, 143, 0 }, // Ā
-    { 15, 22, 16, 1, 21, 83, 143 }, // ā
-    { 22, 28, 22, 0, 28, 154, 226 }, // Ă
-    { 15, 24, 16, 1, 23, 90, 380 }, // ă
-    { 22, 28, 22, 0, 21, 154, 470 }, // Ą
-    { 15, 23, 16, 1, 16, 87, 624 }, // ą
-    { 17, 29, 19, 1, 28, 124, 711 }, // Ć
-    { 13, 25, 15, 1, 24, 82, 835 }, // ć
-    { 17, 29, 19, 1, 28, 124, 917 }, // Ĉ
-    { 13, 25, 15, 1, 24, 82, 1041 }, // ĉ
-    { 17, 29, 19, 1, 28, 124, 1123 }, // Ċ
-    { 13, 23, 15, 1, 22, 75, 1247 }, // ċ
-    { 17, 29, 19, 1, 28, 124, 1322 }, // Č
-    { 13, 25, 15, 1, 24, 82, 1446 }, // č
-    { 20, 29, 22, 1, 28, 145, 1528 }, // Ď
-    { 20, 24, 19, 1, 23, 120, 1673 }, // ď
-    { 21, 22, 22, 0, 21, 116, 1793 }, // Đ
-    { 17, 24, 18, 1, 23, 102, 1909 }, // đ
-    { 17, 26, 18, 1, 26, 111, 2011 }, // Ē
-    { 13, 22, 15, 1, 21, 72, 2122 }, // ē
-    { 17, 28, 18, 1, 28, 119, 2194 }, // Ĕ
-    { 13, 24, 15, 1, 23, 78, 2313 }, // ĕ
-    { 17, 28, 18, 1, 28, 119, 2391 }, // Ė
-    { 13, 23, 15, 1, 22, 75, 2510 }, // ė
-    { 17, 28, 18, 1, 21, 119, 2585 }, // Ę
-    { 13, 23, 15, 1, 16, 75, 2704 }, // ę
-    { 17, 28, 18, 1, 28, 119, 2779 }, // Ě
-    { 13, 25, 15, 1, 24, 82, 2898 }, // ě
-    { 19, 29, 21, 1, 28, 138, 2980 }, // Ĝ
-    { 17, 31, 17, 0, 24, 132, 3118 }, // ĝ
-    { 19, 29, 21, 1, 28, 138, 3250 }, // Ğ
-    { 17, 30, 17, 0, 23, 128, 3388 }, // ğ
-    { 19, 29, 21, 1, 28, 138, 3516 }, // Ġ
-    { 17, 29, 17, 0, 22, 124, 3654 }, // ġ
-    { 19, 29, 21, 1, 21, 138, 3778 }, // Ģ
-    { 17, 32, 17, 0, 25, 136, 3916 }, // ģ
-    { 23, 28, 24, 1, 28, 161, 4052 }, // Ĥ
-    { 20, 30, 19, -1, 30, 150, 4213 }, // ĥ
-    { 24, 21, 24, 0, 21, 126, 4363 }, // Ħ
-    { 19, 23, 19, 0, 23, 110, 4489 }, // ħ
-    { 11, 28, 11, 0, 28, 77, 4599 }, // Ĩ
-    { 10, 23, 10, 0, 23, 58, 4676 }, // ĩ
-    { 11, 26, 11, 0, 26, 72, 4734 }, // Ī
-    { 10, 21, 10, 0, 21, 53, 4806 }, // ī
-    { 11, 28, 11, 0, 28, 77, 4859 }, // Ĭ
-    { 10, 23, 10, 0, 23, 58, 4936 }, // ĭ
-    { 9, 28, 11, 1, 21, 63, 4994 }, // Į
-    { 10, 30, 10, 0, 23, 75, 5057 }, // į
-    { 9, 28, 11, 1, 28, 63, 5132 }, // İ
-    { 10, 16, 10, 0, 16, 40, 5195 }, // ı
-    { 20, 27, 21, 1, 21, 135, 5235 }, // Ĳ
-    { 16, 30, 18, 0, 23, 120, 5370 }, // ĳ
-    { 13, 34, 11, -2, 28, 111, 5490 }, // Ĵ
-    { 11, 31, 8, -2, 24, 86, 5601 }, // ĵ
-    { 21, 29, 21, 1, 21, 153, 5687 }, // Ķ
-    { 18, 31, 18, 0, 23, 140, 5840 }, // ķ
-    { 18, 17, 18, 0, 16, 77, 5980 }, // ĸ
-    { 17, 28, 17, 1, 28, 119, 6057 }, // Ĺ
-    { 9, 30, 9, 0, 30, 68, 6176 }, // ĺ
-    { 17, 29, 17, 1, 21, 124, 6244 }, // Ļ
-    { 9, 31, 9, 0, 23, 70, 6368 }, // ļ
-    { 17, 23, 17, 1, 23, 98, 6438 }, // Ľ
-    { 12, 23, 10, 0, 23, 69, 6536 }, // ľ
-    { 17, 21, 17, 1, 21, 90, 6605 }, // Ŀ
-    { 14, 23, 14, 0, 23, 81, 6695 }, // ŀ
-    { 19, 21, 17, -1, 21, 100, 6776 }, // Ł
-    { 11, 23, 9, -1, 23, 64, 6876 }, // ł
-    { 22, 29, 24, 1, 28, 160, 6940 }, // Ń
-    { 19, 24, 19, 0, 24, 114, 7100 }, // ń
-    { 22, 29, 24, 1, 21, 160, 7214 }, // Ņ
-    { 19, 24, 19, 0, 16, 114, 7374 }, // ņ
-    { 22, 29, 24, 1, 28, 160, 7488 }, // Ň
-    { 19, 24, 19, 0, 24, 114, 7648 }, // ň
-    { 26, 22, 26, 0, 22, 143, 7762 }, // ŉ
-    { 22, 27, 24, 1, 21, 149, 7905 }, // Ŋ
-    { 17, 23, 19, 0, 16, 98, 8054 }, // ŋ
-    { 21, 27, 23, 1, 26, 142, 8152 }, // Ō
-    { 16, 22, 17, 1, 21, 88, 8294 }, // ō
-    { 21, 29, 23, 1, 28, 153, 8382 }, // Ŏ
-    { 16, 24, 17, 1, 23, 96, 8535 }, // ŏ
-    { 21, 30, 23, 1, 29, 158, 8631 }, // Ő
-    { 16, 25, 17, 1, 24, 100, 8789 }, // ő
-    { 26, 22, 28, 1, 21, 143, 8889 }, // Œ
-    { 25, 17, 26, 1, 16, 107, 9032 }, // œ
-    { 20, 29, 20, 1, 28, 145, 9139 }, // Ŕ
-    { 13, 24, 13, 0, 24, 78, 9284 }, // ŕ
-    { 20, 29, 20, 1, 21, 145, 9362 }, // Ŗ
-    { 13, 24, 13, 0, 16, 78, 9507 }, // ŗ
-    { 20, 29, 20, 1, 28, 145, 9585 }, // Ř
-    { 13, 24, 13, 0, 24, 78, 9730 }, // ř
-    { 14, 29, 16, 1, 28, 102, 9808 }, // Ś
-    { 12, 25, 14, 1, 24, 75, 9910 }, // ś
-    { 14, 29, 16, 1, 28, 102, 9985 }, // Ŝ
-    { 12, 25, 14, 1, 24, 75, 10087 }, // ŝ
-    { 14, 29, 16, 1, 21, 102, 10162 }, // Ş
-    { 12, 24, 14, 1, 16, 72, 10264 }, // ş
-    { 14, 29, 16, 1, 28, 102, 10336 }, // Š
-    { 12, 25, 14, 1, 24, 75, 10438 }, // š
-    { 18, 29, 20, 1, 21, 131, 10513 }, // Ţ
-    { 12, 27, 12, 0, 19, 81, 10644 }, // ţ
-    { 18, 28, 20, 1, 28, 126, 10725 }, // Ť
-    { 12, 25, 12, 0, 24, 75, 10851 }, // ť
-    { 18, 21, 20, 1, 21, 95, 10926 }, // Ŧ
-    { 12, 20, 12, 0, 19, 60, 11021 }, // ŧ
-    { 22, 29, 22, 0, 28, 160, 11081 }, // Ũ
-    { 19, 24, 19, 0, 23, 114, 11241 }, // ũ
-    { 22, 27, 22, 0, 26, 149, 11355 }, // Ū
-    { 19, 22, 19, 0, 21, 105, 11504 }, // ū
-    { 22, 29, 22, 0, 28, 160, 11609 }, // Ŭ
-    { 19, 24, 19, 0, 23, 114, 11769 }, // ŭ
-    { 22, 30, 22, 0, 29, 165, 11883 }, // Ů
-    { 19, 25, 19, 0, 24, 119, 12048 }, // ů
-    { 22, 30, 22, 0, 29, 165, 12167 }, // Ű
-    { 19, 25, 19, 0, 24, 119, 12332 }, // ű
-    { 22, 28, 22, 0, 21, 154, 12451 }, // Ų
-    { 19, 23, 19, 0, 16, 110, 12605 }, // ų
-    { 32, 29, 32, 0, 28, 232, 12715 }, // Ŵ
-    { 26, 25, 26, 0, 24, 163, 12947 }, // ŵ
-    { 20, 28, 20, 0, 28, 140, 13110 }, // Ŷ
-    { 18, 31, 17, 0, 24, 140, 13250 }, // ŷ
-    { 20, 27, 20, 0, 27, 135, 13390 }, // Ÿ
-    { 16, 29, 17, 1, 28, 116, 13525 }, // Ź
-    { 14, 25, 15, 0, 24, 88, 13641 }, // ź
-    { 16, 29, 17, 1, 28, 116, 13729 }, // Ż
-    { 14, 23, 15, 0, 22, 81, 13845 }, // ż
-    { 16, 29, 17, 1, 28, 116, 13926 }, // Ž
-    { 14, 25, 15, 0, 24, 88, 14042 }, // ž
-    { 14, 23, 12, 0, 23, 81, 14130 }, // ſ
-    { 7, 7, 0, -5, 24, 13, 0 }, // ̀
-    { 6, 7, 0, -2, 24, 11, 13 }, // ́
-    { 10, 7, 0, -5, 24, 18, 24 }, // ̂
-    { 10, 6, 0, -5, 23, 15, 42 }, // ̃
-    { 10, 3, 0, -5, 21, 8, 57 }, // ̄
-    { 10, 6, 0, -5, 23, 15, 65 }, // ̆
-    { 4, 4, 0, -2, 22, 4, 80 }, // ̇
-    { 10, 4, 0, -5, 22, 10, 84 }, // ̈
-    { 8, 9, 0, -4, 26, 18, 94 }, // ̉
-    { 8, 8, 0, -4, 24, 16, 112 }, // ̊
-    { 11, 7, 0, -4, 24, 20, 128 }, // ̋
-    { 10, 7, 0, -5, 24, 18, 148 }, // ̌
-    { 11, 7, 0, -7, 24, 20, 166 }, // ̏
-    { 10, 6, 0, -5, 23, 15, 186 }, // ̑
-    { 6, 9, 0, -3, 25, 14, 201 }, // ̒
-    { 5, 9, 0, -2, 26, 12, 215 }, // ̓
-    { 5, 9, 0, -3, 26, 12, 227 }, // ̔
-    { 4, 8, 0, -2, 25, 8, 239 }, // ̕
-    { 5, 7, 0, -2, 19, 9, 247 }, // ̛
-    { 4, 5, 0, -2, -2, 5, 256 }, // ̣
-    { 10, 5, 0, -5, -2, 13, 261 }, // ̤
-    { 8, 7, 0, -4, -1, 14, 274 }, // ̥
-    { 5, 7, 0, -3, -1, 9, 288 }, // ̦
-    { 6, 7, 0, -3, -1, 11, 297 }, // ̧
-    { 7, 8, 0, -3, 1, 14, 308 }, // ̨
-    { 4, 7, 8, 2, -1, 7, 322 }, // ̩
-    { 10, 6, 0, -5, -2, 15, 329 }, // ̭
-    { 10, 6, 0, -5, -1, 15, 344 }, // ̮
-    { 10, 5, 0, -5, -2, 13, 359 }, // ̰
-    { 10, 3, 0, -5, -3, 8, 372 }, // ̱
-    { 10, 6, 0, -5, 23, 15, 380 }, // ͂
-    { 12, 11, 0, -6, 29, 33, 395 }, // ̈́
-    { 6, 5, 0, -2, -2, 8, 428 }, // ͅ
-    { 17, 28, 18, 1, 28, 119, 0 }, // Ѐ
-    { 17, 27, 18, 1, 27, 115, 119 }, // Ё
-    { 22, 27, 23, 1, 21, 149, 234 }, // Ђ
-    { 15, 28, 17, 1, 28, 105, 383 }, // Ѓ
-    { 18, 22, 19, 1, 21, 99, 488 }, // Є
-    { 14, 22, 16, 1, 21, 77, 587 }, // Ѕ
-    { 9, 21, 11, 1, 21, 48, 664 }, // І
-    { 11, 27, 11, 0, 27, 75, 712 }, // Ї
-    { 12, 27, 11, -2, 21, 81, 787 }, // Ј
-    { 28, 22, 28, 0, 21, 154, 868 }, // Љ
-    { 28, 22, 30, 1, 21, 154, 1022 }, // Њ
-    { 24, 21, 25, 1, 21, 126, 1176 }, // Ћ
-    { 20, 29, 21, 1, 28, 145, 1302 }, // Ќ
-    { 22, 28, 24, 1, 28, 154, 1447 }, // Ѝ
-    { 21, 29, 21, 0, 28, 153, 1601 }, // Ў
-    { 21, 28, 23, 1, 21, 147, 1754 }, // Џ
-    { 22, 21, 22, 0, 21, 116, 1901 }, // А
-    { 17, 22, 18, 1, 21, 94, 2017 }, // Б
-    { 16, 22, 18, 1, 21, 88, 2111 }, // В
-    { 15, 21, 17, 1, 21, 79, 2199 }, // Г
-    { 21, 27, 22, 0, 21, 142, 2278 }, // Д
-    { 17, 21, 18, 1, 21, 90, 2420 }, // Е
-    { 29, 22, 29, 0, 21, 160, 2510 }, // Ж
-    { 15, 22, 17, 1, 21, 83, 2670 }, // З
-    { 22, 21, 24, 1, 21, 116, 2753 }, // И
-    { 22, 28, 24, 1, 28, 154, 2869 }, // Й
-    { 20, 22, 21, 1, 21, 110, 3023 }, // К
-    { 21, 22, 22, 0, 21, 116, 3133 }, // Л
-    { 26, 21, 26, 0, 21, 137, 3249 }, // М
-    { 23, 21, 24, 1, 21, 121, 3386 }, // Н
-    { 21, 22, 23, 1, 21, 116, 3507 }, // О
-    { 22, 21, 23, 1, 21, 116, 3623 }, // П
-    { 16, 21, 17, 1, 21, 84, 3739 }, // Р
-    { 17, 22, 19, 1, 21, 94, 3823 }, // С
-    { 18, 21, 20, 1, 21, 95, 3917 }, // Т
-    { 21, 22, 21, 0, 21, 116, 4012 }, // У
-    { 21, 22, 23, 1, 21, 116, 4128 }, // Ф
-    { 21, 21, 21, 0, 21, 111, 4244 }, // Х
-    { 22, 27, 23, 1, 21, 149, 4355 }, // Ц
-    { 20, 21, 21, 0, 21, 105, 4504 }, // Ч
-    { 29, 21, 31, 1, 21, 153, 4609 }, // Ш
-    { 30, 27, 31, 1, 21, 203, 4762 }, // Щ
-    { 21, 22, 22, 1, 21, 116, 4965 }, // Ъ
-    { 26, 22, 27, 1, 21, 143, 5081 }, // Ы
-    { 17, 22, 18, 1, 21, 94, 5224 }, // Ь
-    { 18, 22, 19, 1, 21, 99, 5318 }, // Э
-    { 29, 22, 31, 1, 21, 160, 5417 }, // Ю
-    { 20, 22, 19, -1, 21, 110, 5577 }, // Я
-    { 15, 17, 16, 1, 16, 64, 5687 }, // а
-    { 15, 24, 17, 1, 23, 90, 5751 }, // б
-    { 14, 16, 16, 1, 15, 56, 5841 }, // в
-    { 13, 15, 14, 1, 15, 49, 5897 }, // г
-    { 18, 21, 19, 0, 15, 95, 5946 }, // д
-    { 13, 17, 15, 1, 16, 56, 6041 }, // е
-    { 24, 17, 23, 0, 16, 102, 6097 }, // ж
-    { 13, 17, 14, 0, 16, 56, 6199 }, // з
-    { 18, 15, 20, 1, 15, 68, 6255 }, // и
-    { 18, 22, 20, 1, 22, 99, 6323 }, // й
-    { 16, 17, 17, 1, 16, 68, 6422 }, // к
-    { 17, 16, 18, 0, 15, 68, 6490 }, // л
-    { 21, 15, 22, 1, 15, 79, 6558 }, // м
-    { 19, 15, 20, 1, 15, 72, 6637 }, // н
-    { 16, 17, 17, 1, 16, 68, 6709 }, // о
-    { 18, 15, 20, 1, 15, 68, 6777 }, // п
-    { 17, 23, 18, 0, 16, 98, 6845 }, // р
-    { 13, 17, 15, 1, 16, 56, 6943 }, // с
-    { 15, 15, 16, 1, 15, 57, 6999 }, // т
-    { 18, 22, 17, 0, 15, 99, 7056 }, // у
-    { 20, 30, 21, 1, 23, 150, 7155 }, // ф
-    { 17, 15, 17, 0, 15, 64, 7305 }, // х
-    { 19, 21, 20, 1, 15, 100, 7369 }, // ц
-    { 17, 15, 18, 0, 15, 64, 7469 }, // ч
-    { 24, 15, 26, 1, 15, 90, 7533 }, // ш
-    { 25, 21, 26, 1, 15, 132, 7623 }, // щ
-    { 17, 16, 19, 1, 15, 68, 7755 }, // ъ
-    { 22, 16, 24, 1, 15, 88, 7823 }, // ы
-    { 14, 16, 16, 1, 15, 56, 7911 }, // ь
-    { 13, 17, 15, 1, 16, 56, 7967 }, // э
-    { 23, 17, 24, 1, 16, 98, 8023 }, // ю
-    { 16, 16, 17, 0, 15, 64, 8121 }, // я
-    { 13, 25, 15, 1, 24, 82, 8185 }, // ѐ
-    { 13, 23, 15, 1, 22, 75, 8267 }, // ё
-    { 17, 30, 18, 0, 23, 128, 8342 }, // ђ
-    { 13, 24, 14, 1, 24, 78, 8470 }, // ѓ
-    { 13, 17, 15, 1, 16, 56, 8548 }, // є
-    { 12, 17, 14, 1, 16, 51, 8604 }, // ѕ
-    { 10, 23, 10, 0, 23, 58, 8655 }, // і
-    { 11, 22, 10, -1, 22, 61, 8713 }, // ї
-    { 9, 30, 8, -2, 23, 68, 8774 }, // ј
-    { 23, 16, 23, 0, 15, 92, 8842 }, // љ
-    { 23, 16, 25, 1, 15, 92, 8934 }, // њ
-    { 19, 23, 19, 0, 23, 110, 9026 }, // ћ
-    { 16, 25, 17, 1, 24, 100, 9136 }, // ќ
-    { 18, 24, 20, 1, 24, 108, 9236 }, // ѝ
-    { 18, 29, 17, 0, 22, 131, 9344 }, // ў
-    { 18, 21, 20, 1, 15, 95, 9475 }, // џ
-    { 21, 24, 21, 0, 23, 126, 9570 }, // Ѣ
-    { 16, 22, 18, 1, 21, 88, 9696 }, // ѣ
-    { 21, 22, 23, 1, 21, 116, 9784 }, // Ѳ
-    { 16, 17, 17, 1, 16, 68, 9900 }, // ѳ
-    { 22, 22, 22, 0, 21, 121, 9968 }, // Ѵ
-    { 18, 17, 18, 0, 16, 77, 10089 }, // ѵ
-    { 23, 34, 24, 1, 28, 196, 10166 }, // Ҋ
-    { 19, 28, 20, 1, 22, 133, 10362 }, // ҋ
-    { 18, 22, 18, 0, 21, 99, 10495 }, // Ҍ
-    { 15, 22, 15, 0, 21, 83, 10594 }, // ҍ
-    { 16, 21, 17, 1, 21, 84, 10677 }, // Ҏ
-    { 17, 23, 18, 0, 16, 98, 10761 }, // ҏ
-    { 15, 24, 16, 1, 24, 90, 10859 }, // Ґ
-    { 13, 19, 14, 1, 19, 62, 10949 }, // ґ
-    { 16, 21, 17, 0, 21, 84, 11011 }, // Ғ
-    { 13, 15, 14, 1, 15, 49, 11095 }, // ғ
-    { 18, 27, 19, 1, 21, 122, 11144 }, // Ҕ
-    { 16, 22, 18, 1, 15, 88, 11266 }, // ҕ
-    { 29, 27, 29, 0, 21, 196, 11354 }, // Җ
-    { 24, 22, 23, 0, 16, 132, 11550 }, // җ
-    { 15, 27, 17, 1, 21, 102, 11682 }, // Ҙ
-    { 13, 22, 14, 0, 16, 72, 11784 }, // ҙ
-    { 20, 27, 21, 1, 21, 135, 11856 }, // Қ
-    { 16, 22, 17, 1, 16, 88, 11991 }, // қ
-    { 21, 22, 22, 1, 21, 116, 12079 }, // Ҝ
-    { 17, 17, 18, 1, 16, 73, 12195 }, // ҝ
-    { 20, 22, 21, 1, 21, 110, 12268 }, // Ҟ
-    { 16, 22, 16, 0, 21, 88, 12378 }, // ҟ
-    { 23, 22, 24, 1, 21, 127, 12466 }, // Ҡ
-    { 18, 17, 19, 1, 16, 77, 12593 }, // ҡ
-    { 23, 27, 24, 1, 21, 156, 12670 }, // Ң
-    { 19, 21, 20, 1, 15, 100, 12826 }, // ң
-    { 27, 21, 28, 1, 21, 142, 12926 }, // Ҥ
-    { 21, 15, 23, 1, 15, 79, 13068 }, // ҥ
-    { 29, 27, 30, 1, 21, 196, 13147 }, // Ҧ
-    { 26, 22, 28, 1, 15, 143, 13343 }, // ҧ
-    { 23, 22, 24, 1, 21, 127, 13486 }, // Ҩ
-    { 18, 17, 19, 1, 16, 77, 13613 }, // ҩ
-    { 17, 27, 19, 1, 21, 115, 13690 }, // Ҫ
-    { 13, 22, 15, 1, 16, 72, 13805 }, // ҫ
-    { 18, 27, 20, 1, 21, 122, 13877 }, // Ҭ
-    { 15, 21, 16, 1, 15, 79, 13999 }, // ҭ
-    { 20, 21, 20, 0, 21, 105, 14078 }, // Ү
-    { 18, 22, 17, 0, 15, 99, 14183 }, // ү
-    { 20, 21, 20, 0, 21, 105, 14282 }, // Ұ
-    { 18, 22, 17, 0, 15, 99, 14387 }, // ұ
-    { 21, 27, 21, 0, 21, 142, 14486 }, // Ҳ
-    { 17, 21, 17, 0, 15, 90, 14628 }, // ҳ
-    { 25, 27, 26, 1, 21, 169, 14718 }, // Ҵ
-    { 23, 21, 23, 0, 15, 121, 14887 }, // ҵ
-    { 20, 27, 21, 0, 21, 135, 15008 }, // Ҷ
-    { 18, 21, 18, 0, 15, 95, 15143 }, // ҷ
-    { 20, 21, 21, 0, 21, 105, 15238 }, // Ҹ
-    { 17, 15, 18, 0, 15, 64, 15343 }, // ҹ
-    { 20, 21, 21, 1, 21, 105, 15407 }, // Һ
-    { 19, 23, 19, 0, 23, 110, 15512 }, // һ
-    { 23, 22, 24, 0, 21, 127, 15622 }, // Ҽ
-    { 18, 17, 18, 0, 16, 77, 15749 }, // ҽ
-    { 23, 27, 24, 0, 21, 156, 15826 }, // Ҿ
-    { 18, 22, 18, 0, 16, 99, 15982 }, // ҿ
-    { 9, 21, 11, 1, 21, 48, 16081 }, // Ӏ
-    { 29, 29, 29, 0, 28, 211, 16129 }, // Ӂ
-    { 24, 23, 23, 0, 22, 138, 16340 }, // ӂ
-    { 19, 27, 20, 1, 21, 129, 16478 }, // Ӄ
-    { 15, 23, 17, 1, 16, 87, 16607 }, // ӄ
-    { 21, 27, 22, 0, 21, 142, 16694 }, // Ӆ
-    { 18, 21, 18, 0, 15, 95, 16836 }, // ӆ
-    { 23, 27, 24, 1, 21, 156, 16931 }, // Ӈ
-    { 19, 22, 20, 1, 15, 105, 17087 }, // ӈ
-    { 23, 27, 24, 1, 21, 156, 17192 }, // Ӊ
-    { 19, 21, 20, 1, 15, 100, 17348 }, // ӊ
-    { 20, 27, 21, 0, 21, 135, 17448 }, // Ӌ
-    { 17, 21, 18, 0, 15, 90, 17583 }, // ӌ
-    { 26, 27, 26, 0, 21, 176, 17673 }, // Ӎ
-    { 21, 21, 22, 1, 15, 111, 17849 }, // ӎ
-    { 9, 23, 9, 0, 23, 52, 17960 }, // ӏ
-    { 22, 28, 22, 0, 28, 154, 18012 }, // Ӑ
-    { 15, 23, 16, 1, 22, 87, 18166 }, // ӑ
-    { 22, 27, 22, 0, 27, 149, 18253 }, // Ӓ
-    { 15, 23, 16, 1, 22, 87, 18402 }, // ӓ
-    { 27, 21, 27, -1, 21, 142, 18489 }, // Ӕ
-    { 22, 17, 24, 1, 16, 94, 18631 }, // ӕ
-    { 17, 28, 18, 1, 28, 119, 18725 }, // Ӗ
-    { 13, 23, 15, 1, 22, 75, 18844 }, // ӗ
-    { 18, 22, 20, 1, 21, 99, 18919 }, // Ә
-    { 13, 17, 15, 1, 16, 56, 19018 }, // ә
-    { 18, 28, 20, 1, 27, 126, 19074 }, // Ӛ
-    { 13, 23, 15, 1, 22, 75, 19200 }, // ӛ
-    { 29, 28, 29, 0, 27, 203, 19275 }, // Ӝ
-    { 24, 23, 23, 0, 22, 138, 19478 }, // ӝ
-    { 15, 28, 17, 1, 27, 105, 19616 }, // Ӟ
-    { 13, 23, 14, 0, 22, 75, 19721 }, // ӟ
-    { 16, 22, 17, 0, 21, 88, 19796 }, // Ӡ
-    { 14, 22, 15, 0, 15, 77, 19884 }, // ӡ
-    { 22, 26, 24, 1, 26, 143, 19961 }, // Ӣ
-    { 18, 21, 20, 1, 21, 95, 20104 }, // ӣ
-    { 22, 27, 24, 1, 27, 149, 20199 }, // Ӥ
-    { 18, 22, 20, 1, 22, 99, 20348 }, // ӥ
-    { 21, 28, 23, 1, 27, 147, 20447 }, // Ӧ
-    { 16, 23, 17, 1, 22, 92, 20594 }, // ӧ
-    { 21, 22, 23, 1, 21, 116, 20686 }, // Ө
-    { 16, 17, 17, 1, 16, 68, 20802 }, // ө
-    { 21, 28, 24, 1, 27, 147, 20870 }, // Ӫ
-    { 16, 23, 17, 1, 22, 92, 21017 }, // ӫ
-    { 18, 28, 19, 1, 27, 126, 21109 }, // Ӭ
-    { 13, 23, 15, 1, 22, 75, 21235 }, // ӭ
-    { 21, 27, 21, 0, 26, 142, 21310 }, // Ӯ
-    { 18, 28, 17, 0, 21, 126, 21452 }, // ӯ
-    { 21, 28, 21, 0, 27, 147, 21578 }, // Ӱ
-    { 18, 29, 17, 0, 22, 131, 21725 }, // ӱ
-    { 21, 30, 21, 0, 29, 158, 21856 }, // Ӳ
-    { 18, 31, 17, 0, 24, 140, 22014 }, // ӳ
-    { 20, 27, 21, 0, 27, 135, 22154 }, // Ӵ
-    { 17, 22, 18, 0, 22, 94, 22289 }, // ӵ
-    { 15, 27, 17, 1, 21, 102, 22383 }, // Ӷ
-    { 13, 21, 14, 1, 15, 69, 22485 }, // ӷ
-    { 26, 28, 28, 1, 27, 182, 22554 }, // Ӹ
-    { 22, 23, 24, 1, 22, 127, 22736 }, // ӹ
-    { 16, 27, 17, 0, 21, 108, 22863 }, // Ӻ
-    { 13, 21, 14, 1, 15, 69, 22971 }, // ӻ
-    { 21, 27, 20, 0, 21, 142, 23040 }, // Ӽ
-    { 17, 22, 17, 0, 15, 94, 23182 }, // ӽ
-    { 21, 21, 21, 0, 21, 111, 23276 }, // Ӿ
-    { 17, 15, 17, 0, 15, 64, 23387 }, // ӿ
-    { 0, 0, 15, 0, 0, 0, 0 }, //  
-    { 0, 0, 29, 0, 0, 0, 0 }, //  
-    { 0, 0, 15, 0, 0, 0, 0 }, //  
-    { 0, 0, 29, 0, 0, 0, 0 }, //  
-    { 0, 0, 10, 0, 0, 0, 0 }, //  
-    { 0, 0, 7, 0, 0, 0, 0 }, //  
-    { 0, 0, 5, 0, 0, 0, 0 }, //  
-    { 0, 0, 18, 0, 0, 0, 0 }, //  
-    { 0, 0, 8, 0, 0, 0, 0 }, //  
-    { 0, 0, 6, 0, 0, 0, 0 }, //  
-    { 0, 0, 1, 0, 0, 0, 0 }, //  
-    { 0, 0, 0, 0, 0, 0, 0 }, // ​
-    { 2, 24, 0, -1, 17, 12, 0 }, // ‌
-    { 6, 26, 0, -3, 19, 39, 12 }, // ‍
-    { 10, 28, 0, -5, 21, 70, 51 }, // ‎
-    { 10, 28, 0, -5, 21, 70, 121 }, // ‏
-    { 9, 3, 11, 1, 9, 7, 191 }, // ‐
-    { 9, 3, 11, 1, 9, 7, 198 }, // ‑
-    { 14, 3, 18, 2, 11, 11, 205 }, // ‒
-    { 15, 3, 15, 0, 9, 12, 216 }, // –
-    { 29, 3, 29, 0, 9, 22, 228 }, // —
-    { 29, 3, 29, 0, 9, 22, 250 }, // ―
-    { 10, 30, 15, 2, 23, 75, 272 }, // ‖
-    { 15, 7, 15, 0, -1, 27, 347 }, // ‗
-    { 5, 10, 7, 1, 22, 13, 374 }, // ‘
-    { 6, 10, 7, 0, 22, 15, 387 }, // ’
-    { 6, 10, 7, 0, 4, 15, 402 }, // ‚
-    { 5, 10, 7, 1, 22, 13, 417 }, // ‛
-    { 11, 10, 13, 1, 22, 28, 430 }, // “
-    { 12, 10, 13, 0, 22, 30, 458 }, // ”
-    { 12, 10, 13, 0, 4, 30, 488 }, // „
-    { 11, 10, 13, 1, 22, 28, 518 }, // ‟
-    { 14, 19, 15, 0, 21, 67, 546 }, // †
-    { 14, 23, 15, 0, 21, 81, 613 }, // ‡
-    { 7, 7, 9, 1, 11, 13, 694 }, // •
-    { 10, 10, 18, 4, 15, 25, 707 }, // ‣
-    { 6, 5, 8, 1, 4, 8, 732 }, // ․
-    { 12, 5, 15, 1, 4, 15, 740 }, // ‥
-    { 25, 5, 29, 2, 4, 32, 755 }, // …
-    { 6, 4, 8, 1, 10, 6, 787 }, // ‧
-    { 0, 0, 0, 0, 0, 0, 793 }, //  
-    { 0, 0, 0, 0, 0, 0, 793 }, //  
-    { 10, 28, 0, -5, 21, 70, 793 }, // ‪
-    { 10, 28, 0, -5, 21, 70, 863 }, // ‫
-    { 10, 27, 0, -5, 20, 68, 933 }, // ‬
-    { 12, 28, 0, -6, 21, 84, 1001 }, // ‭
-    { 12, 28, 0, -6, 21, 84, 1085 }, // ‮
-    { 0, 0, 3, 0, 0, 0, 1169 }, //  
-    { 38, 24, 40, 1, 22, 228, 1169 }, // ‰
-    { 6, 10, 8, 1, 21, 15, 1397 }, // ′
-    { 12, 10, 13, 1, 21, 30, 1412 }, // ″
-    { 17, 10, 19, 1, 21, 43, 1442 }, // ‴
-    { 6, 10, 8, 1, 21, 15, 1485 }, // ‵
-    { 12, 10, 14, 1, 21, 30, 1500 }, // ‶
-    { 19, 10, 20, 1, 21, 48, 1530 }, // ‷
-    { 13, 6, 14, 1, 0, 20, 1578 }, // ‸
-    { 7, 11, 9, 1, 13, 20, 1598 }, // ‹
-    { 8, 11, 9, 1, 13, 22, 1618 }, // ›
-    { 18, 20, 18, 0, 19, 90, 1640 }, // ※
-    { 13, 23, 16, 2, 22, 75, 1730 }, // ‼
-    { 15, 3, 15, 0, 24, 12, 1805 }, // ‾
-    { 7, 3, 9, 1, 9, 6, 1817 }, // ⁃
-    { 15, 24, 5, -5, 22, 90, 1823 }, // ⁄
-    { 23, 23, 26, 2, 22, 133, 1913 }, // ⁇
-    { 19, 23, 22, 2, 22, 110, 2046 }, // ⁈
-    { 19, 23, 22, 2, 22, 110, 2156 }, // ⁉
-    { 17, 5, 29, 6, 11, 22, 2266 }, // ⁓
-    { 23, 10, 25, 1, 21, 58, 2288 }, // ⁗
-    { 0, 0, 6, 0, 0, 0, 2346 }, //  
-    { 0, 0, 0, 0, 0, 0, 2346 }, // ⁠
-    { 0, 0, 0, 0, 0, 0, 2346 }, // ⁡
-    { 0, 0, 0, 0, 0, 0, 2346 }, // ⁢
-    { 0, 0, 0, 0, 0, 0, 2346 }, // ⁣
-    { 0, 0, 0, 0, 0, 0, 2346 }, // ⁤
-    { 11, 14, 13, 1, 24, 39, 0 }, // ⁰
-    { 11, 14, 13, 1, 24, 39, 39 }, // ⁴
-    { 10, 14, 13, 1, 24, 35, 78 }, // ⁵
-    { 11, 14, 13, 1, 24, 39, 113 }, // ⁶
-    { 10, 14, 13, 2, 24, 35, 152 }, // ⁷
-    { 11, 14, 13, 1, 24, 39, 187 }, // ⁸
-    { 11, 14, 13, 1, 24, 39, 226 }, // ⁹
-    { 13, 11, 16, 2, 21, 36, 265 }, // ⁿ
-    { 11, 15, 13, 1, 10, 42, 301 }, // ₀
-    { 9, 14, 13, 2, 10, 32, 343 }, // ₁
-    { 11, 14, 13, 1, 10, 39, 375 }, // ₂
-    { 9, 15, 13, 2, 10, 34, 414 }, // ₃
-    { 11, 15, 13, 1, 10, 42, 448 }, // ₄
-    { 10, 14, 13, 1, 9, 35, 490 }, // ₅
-    { 11, 15, 13, 1, 10, 42, 525 }, // ₆
-    { 10, 14, 13, 2, 9, 35, 567 }, // ₇
-    { 11, 15, 13, 1, 10, 42, 602 }, // ₈
-    { 11, 15, 13, 1, 10, 42, 644 }, // ₉
-    { 15, 20, 18, 1, 20, 75, 0 }, // ₣
-    { 16, 22, 18, 1, 21, 88, 75 }, // ₤
-    { 36, 22, 36, 0, 21, 198, 163 }, // ₧
-    { 18, 22, 18, 0, 21, 99, 361 }, // €
-    { 17, 12, 29, 6, 16, 51, 0 }, // ←
-    { 13, 20, 29, 8, 20, 65, 51 }, // ↑
-    { 17, 12, 29, 6, 16, 51, 116 }, // →
-    { 13, 20, 29, 8, 20, 65, 167 }, // ↓
-    { 18, 12, 29, 5, 16, 54, 232 }, // ↔
-    { 13, 20, 29, 8, 20, 65, 286 }, // ↕
-    { 13, 20, 29, 8, 20, 65, 351 }, // ↨
-    { 13, 20, 29, 8, 20, 65, 416 }, // ↲
-    { 13, 20, 29, 8, 20, 65, 481 }, // ↳
-    { 17, 14, 29, 6, 17, 60, 546 }, // ↵
-    { 17, 14, 29, 6, 17, 60, 606 }, // ⇐
-    { 13, 18, 29, 8, 19, 59, 666 }, // ⇑
-    { 17, 14, 29, 6, 17, 60, 725 }, // ⇒
-    { 13, 18, 29, 8, 19, 59, 785 }, // ⇓
-    { 19, 14, 29, 5, 17, 67, 844 }, // ⇔
-    { 19, 22, 29, 5, 21, 105, 0 }, // ∀
-    { 14, 24, 18, 2, 23, 84, 105 }, // ∂
-    { 13, 21, 29, 8, 21, 69, 189 }, // ∃
-    { 23, 24, 29, 3, 22, 138, 258 }, // ∅
-    { 19, 21, 19, 0, 21, 100, 396 }, // ∆
-    { 19, 22, 29, 5, 21, 105, 496 }, // ∇
-    { 19, 21, 29, 5, 21, 100, 601 }, // ∈
-    { 19, 26, 29, 5, 23, 124, 701 }, // ∉
-    { 19, 16, 29, 5, 18, 76, 825 }, // ∊
-    { 19, 21, 29, 5, 21, 100, 901 }, // ∋
-    { 19, 26, 29, 5, 23, 124, 1001 }, // ∌
-    { 19, 16, 29, 5, 18, 76, 1125 }, // ∍
-    { 22, 26, 23, 1, 21, 143, 1201 }, // ∏
-    { 18, 26, 18, 0, 21, 117, 1344 }, // ∑
-    { 13, 3, 18, 3, 11, 10, 1461 }, // −
-    { 13, 23, 14, 1, 21, 75, 1471 }, // ∕
-    { 13, 23, 15, 2, 21, 75, 1546 }, // ∖
-    { 14, 14, 18, 2, 17, 49, 1621 }, // ∗
-    { 10, 10, 18, 4, 15, 25, 1670 }, // ∘
-    { 6, 4, 18, 6, 10, 6, 1695 }, // ∙
-    { 18, 28, 18, 0, 24, 126, 1701 }, // √
-    { 14, 11, 18, 2, 15, 39, 1827 }, // ∝
-    { 18, 10, 18, 0, 14, 45, 1866 }, // ∞
-    { 19, 21, 29, 5, 21, 100, 1911 }, // ∟
-    { 21, 21, 29, 3, 21, 111, 2011 }, // ∠
-    { 4, 30, 15, 5, 23, 30, 2122 }, // ∣
-    { 9, 30, 15, 3, 23, 68, 2152 }, // ∥
-    { 19, 21, 29, 5, 21, 100, 2220 }, // ∧
-    { 19, 21, 29, 5, 21, 100, 2320 }, // ∨
-    { 17, 21, 29, 6, 21, 90, 2420 }, // ∩
-    { 17, 22, 29, 6, 21, 94, 2510 }, // ∪
-    { 16, 30, 18, 1, 23, 120, 2604 }, // ∫
-    { 19, 17, 29, 5, 16, 81, 2724 }, // ∴
-    { 19, 17, 29, 5, 16, 81, 2805 }, // ∵
-    { 5, 16, 9, 2, 18, 20, 2886 }, // ∶
-    { 19, 17, 29, 5, 16, 81, 2906 }, // ∷
-    { 17, 5, 29, 6, 11, 22, 2987 }, // ∼
-    { 17, 15, 29, 6, 17, 64, 3009 }, // ≅
-    { 14, 10, 18, 2, 15, 35, 3073 }, // ≈
-    { 17, 10, 29, 6, 13, 43, 3108 }, // ≍
-    { 13, 13, 18, 3, 16, 43, 3151 }, // ≠
-    { 17, 13, 29, 6, 15, 56, 3194 }, // ≡
-    { 14, 18, 18, 2, 18, 63, 3250 }, // ≤
-    { 14, 18, 18, 2, 18, 63, 3313 }, // ≥
-    { 23, 14, 29, 3, 17, 81, 3376 }, // ≪
-    { 23, 14, 29, 3, 17, 81, 3457 }, // ≫
-    { 19, 16, 29, 5, 18, 76, 3538 }, // ⊃
-    { 19, 26, 29, 5, 23, 124, 3614 }, // ⊄
-    { 19, 26, 29, 5, 23, 124, 3738 }, // ⊅
-    { 19, 21, 29, 5, 21, 100, 3862 }, // ⊆
-    { 19, 21, 29, 5, 21, 100, 3962 }, // ⊇
-    { 21, 22, 29, 4, 21, 116, 4062 }, // ⊕
-    { 21, 22, 29, 4, 21, 116, 4178 }, // ⊖
-    { 21, 22, 29, 4, 21, 116, 4294 }, // ⊗
-    { 21, 22, 29, 4, 21, 116, 4410 }, // ⊘
-    { 17, 21, 29, 6, 21, 90, 4526 }, // ⊥
-    { 6, 5, 18, 6, 10, 8, 4616 }, // ⋅
-    { 25, 5, 29, 2, 10, 32, 4624 }, // ⋯
-    { 27, 28, 29, 1, 24, 189, 0 }, // �
+    { 15, 11, 15, 1, 13, 42, 7260 }, // «
+    { 13, 8, 18, 3, 14, 26, 655 }, // ¬
+    { 9, 3, 11, 1, 9, 7, 681 }, // ­
+    { 17, 16, 17, 0, 23, 68, 688 }, // ®
+    { 10, 3, 19, 5, 21, 8, 756 }, // ¯
+    { 11, 11, 15, 2, 21, 31, 764 }, // °
+    { 13, 17, 18, 3, 17, 56, 795 }, // ±
+    { 11, 14, 13, 1, 24, 39, 851 }, // ²
+    { 9, 14, 13, 2, 24, 32, 890 }, // ³
+    { 6, 7, 19, 7, 24, 11, 922 }, // ´
+    { 18, 23, 19, 2, 16, 104, 933 }, // µ
+    { 15, 26, 16, 0, 21, 98, 1037 }, // ¶
+    { 6, 4, 8, 1, 10, 6, 1135 }, // ·
+    { 6, 7, 19, 7, -1, 11, 1141 }, // ¸
+    { 9, 14, 13, 2, 24, 32, 1152 }, // ¹
+    { 11, 14, 13, 1, 21, 39, 1184 }, // º
+    { 15, 11, 15, 1, 13, 42, 7302 }, // »
+    { 28, 24, 31, 2, 22, 168, 1223 }, // ¼
+    { 28, 24, 31, 2, 22, 168, 1391 }, // ½
+    { 29, 24, 31, 2, 22, 174, 1559 }, // ¾
+    { 11, 23, 14, 1, 16, 64, 1733 }, // ¿
+    { 22, 28, 22, 0, 28, 154, 7344 }, // À
+    { 22, 28, 22, 0, 28, 154, 7498 }, // Á
+    { 22, 28, 22, 0, 28, 154, 7652 }, // Â
+    { 22, 28, 22, 0, 28, 154, 1797 }, // Ã
+    { 22, 27, 22, 0, 27, 149, 7806 }, // Ä
+    { 22, 29, 22, 0, 29, 160, 1951 }, // Å
+    { 27, 21, 27, -1, 21, 142, 2111 }, // Æ
+    { 17, 29, 19, 1, 21, 124, 7955 }, // Ç
+    { 17, 28, 18, 1, 28, 119, 8079 }, // È
+    { 17, 28, 18, 1, 28, 119, 8198 }, // É
+    { 17, 28, 18, 1, 28, 119, 8317 }, // Ê
+    { 17, 27, 18, 1, 27, 115, 8436 }, // Ë
+    { 9, 28, 11, 1, 28, 63, 8551 }, // Ì
+    { 9, 28, 11, 1, 28, 63, 8614 }, // Í
+    { 11, 28, 11, 0, 28, 77, 8677 }, // Î
+    { 11, 27, 11, 0, 27, 75, 8754 }, // Ï
+    { 21, 22, 22, 0, 21, 116, 2253 }, // Ð
+    { 22, 29, 24, 1, 28, 160, 8829 }, // Ñ
+    { 21, 29, 23, 1, 28, 153, 8989 }, // Ò
+    { 21, 29, 23, 1, 28, 153, 9142 }, // Ó
+    { 21, 29, 23, 1, 28, 153, 9295 }, // Ô
+    { 21, 29, 23, 1, 28, 153, 2369 }, // Õ
+    { 21, 28, 23, 1, 27, 147, 9448 }, // Ö
+    { 12, 12, 18, 3, 16, 36, 2522 }, // ×
+    { 22, 22, 23, 0, 21, 121, 2558 }, // Ø
+    { 22, 29, 22, 0, 28, 160, 9595 }, // Ù
+    { 22, 29, 22, 0, 28, 160, 9755 }, // Ú
+    { 22, 29, 22, 0, 28, 160, 9915 }, // Û
+    { 22, 28, 22, 0, 27, 154, 10075 }, // Ü
+    { 20, 28, 20, 0, 28, 140, 2679 }, // Ý
+    { 16, 21, 18, 1, 21, 84, 2819 }, // Þ
+    { 18, 24, 19, 0, 23, 108, 2903 }, // ß
+    { 15, 25, 16, 1, 24, 94, 10229 }, // à
+    { 15, 25, 16, 1, 24, 94, 10323 }, // á
+    { 15, 25, 16, 1, 24, 94, 10417 }, // â
+    { 15, 24, 16, 1, 23, 90, 3011 }, // ã
+    { 15, 23, 16, 1, 22, 87, 10511 }, // ä
+    { 15, 25, 16, 1, 24, 94, 3101 }, // å
+    { 22, 17, 24, 1, 16, 94, 3195 }, // æ
+    { 13, 24, 15, 1, 16, 78, 10598 }, // ç
+    { 13, 25, 15, 1, 24, 82, 10676 }, // è
+    { 13, 25, 15, 1, 24, 82, 10758 }, // é
+    { 13, 25, 15, 1, 24, 82, 10840 }, // ê
+    { 13, 23, 15, 1, 22, 75, 10922 }, // ë
+    { 10, 24, 10, 0, 24, 60, 10997 }, // ì
+    { 10, 24, 10, 0, 24, 60, 11057 }, // í
+    { 10, 24, 10, 0, 24, 60, 11117 }, // î
+    { 11, 22, 10, -1, 22, 61, 11177 }, // ï
+    { 15, 25, 17, 1, 24, 94, 3289 }, // ð
+    { 19, 23, 19, 0, 23, 110, 11238 }, // ñ
+    { 16, 25, 17, 1, 24, 100, 11348 }, // ò
+    { 16, 25, 17, 1, 24, 100, 11448 }, // ó
+    { 16, 25, 17, 1, 24, 100, 11548 }, // ô
+    { 16, 24, 17, 1, 23, 96, 3383 }, // õ
+    { 16, 23, 17, 1, 22, 92, 11648 }, // ö
+    { 13, 14, 18, 3, 17, 46, 3479 }, // ÷
+    { 17, 17, 17, 0, 16, 73, 3525 }, // ø
+    { 19, 25, 19, 0, 24, 119, 11740 }, // ù
+    { 19, 25, 19, 0, 24, 119, 11859 }, // ú
+    { 19, 25, 19, 0, 24, 119, 11978 }, // û
+    { 19, 23, 19, 0, 22, 110, 12097 }, // ü
+    { 18, 31, 17, 0, 24, 140, 3598 }, // ý
+    { 17, 30, 18, 0, 23, 128, 3738 }, // þ
+    { 18, 29, 17, 0, 22, 131, 3866 }, // ÿ
+    { 22, 26, 22, 0, 26, 143, 3997 }, // Ā
+    { 15, 22, 16, 1, 21, 83, 4140 }, // ā
+    { 22, 28, 22, 0, 28, 154, 4223 }, // Ă
+    { 15, 24, 16, 1, 23, 90, 4377 }, // ă
+    { 22, 28, 22, 0, 21, 154, 4467 }, // Ą
+    { 15, 23, 16, 1, 16, 87, 4621 }, // ą
+    { 17, 29, 19, 1, 28, 124, 4708 }, // Ć
+    { 13, 25, 15, 1, 24, 82, 4832 }, // ć
+    { 17, 29, 19, 1, 28, 124, 4914 }, // Ĉ
+    { 13, 25, 15, 1, 24, 82, 5038 }, // ĉ
+    { 17, 29, 19, 1, 28, 124, 5120 }, // Ċ
+    { 13, 23, 15, 1, 22, 75, 5244 }, // ċ
+    { 17, 29, 19, 1, 28, 124, 5319 }, // Č
+    { 13, 25, 15, 1, 24, 82, 5443 }, // č
+    { 20, 29, 22, 1, 28, 145, 5525 }, // Ď
+    { 20, 24, 19, 1, 23, 120, 5670 }, // ď
+    { 21, 22, 22, 0, 21, 116, 5790 }, // Đ
+    { 17, 24, 18, 1, 23, 102, 5906 }, // đ
+    { 17, 26, 18, 1, 26, 111, 6008 }, // Ē
+    { 13, 22, 15, 1, 21, 72, 6119 }, // ē
+    { 17, 28, 18, 1, 28, 119, 6191 }, // Ĕ
+    { 13, 24, 15, 1, 23, 78, 6310 }, // ĕ
+    { 17, 28, 18, 1, 28, 119, 6388 }, // Ė
+    { 13, 23, 15, 1, 22, 75, 6507 }, // ė
+    { 17, 28, 18, 1, 21, 119, 6582 }, // Ę
+    { 13, 23, 15, 1, 16, 75, 6701 }, // ę
+    { 17, 28, 18, 1, 28, 119, 6776 }, // Ě
+    { 13, 25, 15, 1, 24, 82, 6895 }, // ě
+    { 19, 29, 21, 1, 28, 138, 6977 }, // Ĝ
+    { 17, 31, 17, 0, 24, 132, 7115 }, // ĝ
+    { 19, 29, 21, 1, 28, 138, 7247 }, // Ğ
+    { 17, 30, 17, 0, 23, 128, 7385 }, // ğ
+    { 19, 29, 21, 1, 28, 138, 7513 }, // Ġ
+    { 17, 29, 17, 0, 22, 124, 7651 }, // ġ
+    { 19, 29, 21, 1, 21, 138, 7775 }, // Ģ
+    { 17, 32, 17, 0, 25, 136, 7913 }, // ģ
+    { 23, 28, 24, 1, 28, 161, 8049 }, // Ĥ
+    { 20, 30, 19, -1, 30, 150, 8210 }, // ĥ
+    { 24, 21, 24, 0, 21, 126, 8360 }, // Ħ
+    { 19, 23, 19, 0, 23, 110, 8486 }, // ħ
+    { 11, 28, 11, 0, 28, 77, 8596 }, // Ĩ
+    { 10, 23, 10, 0, 23, 58, 8673 }, // ĩ
+    { 11, 26, 11, 0, 26, 72, 8731 }, // Ī
+    { 10, 21, 10, 0, 21, 53, 8803 }, // ī
+    { 11, 28, 11, 0, 28, 77, 8856 }, // Ĭ
+    { 10, 23, 10, 0, 23, 58, 8933 }, // ĭ
+    { 9, 28, 11, 1, 21, 63, 8991 }, // Į
+    { 10, 30, 10, 0, 23, 75, 9054 }, // į
+    { 9, 28, 11, 1, 28, 63, 9129 }, // İ
+    { 10, 16, 10, 0, 16, 40, 9192 }, // ı
+    { 20, 27, 21, 1, 21, 135, 9232 }, // Ĳ
+    { 16, 30, 18, 0, 23, 120, 9367 }, // ĳ
+    { 13, 34, 11, -2, 28, 111, 9487 }, // Ĵ
+    { 11, 31, 8, -2, 24, 86, 9598 }, // ĵ
+    { 21, 29, 21, 1, 21, 153, 9684 }, // Ķ
+    { 18, 31, 18, 0, 23, 140, 9837 }, // ķ
+    { 18, 17, 18, 0, 16, 77, 9977 }, // ĸ
+    { 17, 28, 17, 1, 28, 119, 10054 }, // Ĺ
+    { 9, 30, 9, 0, 30, 68, 10173 }, // ĺ
+    { 17, 29, 17, 1, 21, 124, 10241 }, // Ļ
+    { 9, 31, 9, 0, 23, 70, 10365 }, // ļ
+    { 17, 23, 17, 1, 23, 98, 10435 }, // Ľ
+    { 12, 23, 10, 0, 23, 69, 10533 }, // ľ
+    { 17, 21, 17, 1, 21, 90, 10602 }, // Ŀ
+    { 14, 23, 14, 0, 23, 81, 10692 }, // ŀ
+    { 19, 21, 17, -1, 21, 100, 10773 }, // Ł
+    { 11, 23, 9, -1, 23, 64, 10873 }, // ł
+    { 22, 29, 24, 1, 28, 160, 10937 }, // Ń
+    { 19, 24, 19, 0, 24, 114, 11097 }, // ń
+    { 22, 29, 24, 1, 21, 160, 11211 }, // Ņ
+    { 19, 24, 19, 0, 16, 114, 11371 }, // ņ
+    { 22, 29, 24, 1, 28, 160, 11485 }, // Ň
+    { 19, 24, 19, 0, 24, 114, 11645 }, // ň
+    { 26, 22, 26, 0, 22, 143, 11759 }, // ŉ
+    { 22, 27, 24, 1, 21, 149, 11902 }, // Ŋ
+    { 17, 23, 19, 0, 16, 98, 12051 }, // ŋ
+    { 21, 27, 23, 1, 26, 142, 12149 }, // Ō
+    { 16, 22, 17, 1, 21, 88, 12291 }, // ō
+    { 21, 29, 23, 1, 28, 153, 12379 }, // Ŏ
+    { 16, 24, 17, 1, 23, 96, 12532 }, // ŏ
+    { 21, 30, 23, 1, 29, 158, 12628 }, // Ő
+    { 16, 25, 17, 1, 24, 100, 12786 }, // ő
+    { 26, 22, 28, 1, 21, 143, 12207 }, // Œ
+    { 25, 17, 26, 1, 16, 107, 12350 }, // œ
+    { 20, 29, 20, 1, 28, 145, 12886 }, // Ŕ
+    { 13, 24, 13, 0, 24, 78, 13031 }, // ŕ
+    { 20, 29, 20, 1, 21, 145, 13109 }, // Ŗ
+    { 13, 24, 13, 0, 16, 78, 13254 }, // ŗ
+    { 20, 29, 20, 1, 28, 145, 13332 }, // Ř
+    { 13, 24, 13, 0, 24, 78, 13477 }, // ř
+    { 14, 29, 16, 1, 28, 102, 13555 }, // Ś
+    { 12, 25, 14, 1, 24, 75, 13657 }, // ś
+    { 14, 29, 16, 1, 28, 102, 13732 }, // Ŝ
+    { 12, 25, 14, 1, 24, 75, 13834 }, // ŝ
+    { 14, 29, 16, 1, 21, 102, 13909 }, // Ş
+    { 12, 24, 14, 1, 16, 72, 14011 }, // ş
+    { 14, 29, 16, 1, 28, 102, 14083 }, // Š
+    { 12, 25, 14, 1, 24, 75, 14185 }, // š
+    { 18, 29, 20, 1, 21, 131, 14260 }, // Ţ
+    { 12, 27, 12, 0, 19, 81, 14391 }, // ţ
+    { 18, 28, 20, 1, 28, 126, 14472 }, // Ť
+    { 12, 25, 12, 0, 24, 75, 14598 }, // ť
+    { 18, 21, 20, 1, 21, 95, 14673 }, // Ŧ
+    { 12, 20, 12, 0, 19, 60, 14768 }, // ŧ
+    { 22, 29, 22, 0, 28, 160, 14828 }, // Ũ
+    { 19, 24, 19, 0, 23, 114, 14988 }, // ũ
+    { 22, 27, 22, 0, 26, 149, 15102 }, // Ū
+    { 19, 22, 19, 0, 21, 105, 15251 }, // ū
+    { 22, 29, 22, 0, 28, 160, 15356 }, // Ŭ
+    { 19, 24, 19, 0, 23, 114, 15516 }, // ŭ
+    { 22, 30, 22, 0, 29, 165, 15630 }, // Ů
+    { 19, 25, 19, 0, 24, 119, 15795 }, // ů
+    { 22, 30, 22, 0, 29, 165, 15914 }, // Ű
+    { 19, 25, 19, 0, 24, 119, 16079 }, // ű
+    { 22, 28, 22, 0, 21, 154, 16198 }, // Ų
+    { 19, 23, 19, 0, 16, 110, 16352 }, // ų
+    { 32, 29, 32, 0, 28, 232, 16462 }, // Ŵ
+    { 26, 25, 26, 0, 24, 163, 16694 }, // ŵ
+    { 20, 28, 20, 0, 28, 140, 16857 }, // Ŷ
+    { 18, 31, 17, 0, 24, 140, 16997 }, // ŷ
+    { 20, 27, 20, 0, 27, 135, 17137 }, // Ÿ
+    { 16, 29, 17, 1, 28, 116, 17272 }, // Ź
+    { 14, 25, 15, 0, 24, 88, 17388 }, // ź
+    { 16, 29, 17, 1, 28, 116, 17476 }, // Ż
+    { 14, 23, 15, 0, 22, 81, 17592 }, // ż
+    { 16, 29, 17, 1, 28, 116, 17673 }, // Ž
+    { 14, 25, 15, 0, 24, 88, 17789 }, // ž
+    { 14, 23, 12, 0, 23, 81, 17877 }, // ſ
+    { 7, 7, 0, -5, 24, 13, 17958 }, // ̀
+    { 6, 7, 0, -2, 24, 11, 17971 }, // ́
+    { 10, 7, 0, -5, 24, 18, 17982 }, // ̂
+    { 10, 6, 0, -5, 23, 15, 18000 }, // ̃
+    { 10, 3, 0, -5, 21, 8, 18015 }, // ̄
+    { 10, 6, 0, -5, 23, 15, 18023 }, // ̆
+    { 4, 4, 0, -2, 22, 4, 18038 }, // ̇
+    { 10, 4, 0, -5, 22, 10, 18042 }, // ̈
+    { 8, 9, 0, -4, 26, 18, 18052 }, // ̉
+    { 8, 8, 0, -4, 24, 16, 18070 }, // ̊
+    { 11, 7, 0, -4, 24, 20, 18086 }, // ̋
+    { 10, 7, 0, -5, 24, 18, 18106 }, // ̌
+    { 11, 7, 0, -7, 24, 20, 18124 }, // ̏
+    { 10, 6, 0, -5, 23, 15, 18144 }, // ̑
+    { 6, 9, 0, -3, 25, 14, 18159 }, // ̒
+    { 5, 9, 0, -2, 26, 12, 18173 }, // ̓
+    { 5, 9, 0, -3, 26, 12, 18185 }, // ̔
+    { 4, 8, 0, -2, 25, 8, 18197 }, // ̕
+    { 5, 7, 0, -2, 19, 9, 18205 }, // ̛
+    { 4, 5, 0, -2, -2, 5, 18214 }, // ̣
+    { 10, 5, 0, -5, -2, 13, 18219 }, // ̤
+    { 8, 7, 0, -4, -1, 14, 18232 }, // ̥
+    { 5, 7, 0, -3, -1, 9, 18246 }, // ̦
+    { 6, 7, 0, -3, -1, 11, 18255 }, // ̧
+    { 7, 8, 0, -3, 1, 14, 18266 }, // ̨
+    { 4, 7, 8, 2, -1, 7, 18280 }, // ̩
+    { 10, 6, 0, -5, -2, 15, 18287 }, // ̭
+    { 10, 6, 0, -5, -1, 15, 18302 }, // ̮
+    { 10, 5, 0, -5, -2, 13, 18317 }, // ̰
+    { 10, 3, 0, -5, -3, 8, 18330 }, // ̱
+    { 10, 6, 0, -5, 23, 15, 18338 }, // ͂
+    { 12, 11, 0, -6, 29, 33, 18353 }, // ̈́
+    { 6, 5, 0, -2, -2, 8, 18386 }, // ͅ
+    { 17, 28, 18, 1, 28, 119, 18394 }, // Ѐ
+    { 17, 27, 18, 1, 27, 115, 0 }, // Ё
+    { 22, 27, 23, 1, 21, 149, 18513 }, // Ђ
+    { 15, 28, 17, 1, 28, 105, 18662 }, // Ѓ
+    { 18, 22, 19, 1, 21, 99, 18767 }, // Є
+    { 14, 22, 16, 1, 21, 77, 18866 }, // Ѕ
+    { 9, 21, 11, 1, 21, 48, 18943 }, // І
+    { 11, 27, 11, 0, 27, 75, 18991 }, // Ї
+    { 12, 27, 11, -2, 21, 81, 19066 }, // Ј
+    { 28, 22, 28, 0, 21, 154, 19147 }, // Љ
+    { 28, 22, 30, 1, 21, 154, 19301 }, // Њ
+    { 24, 21, 25, 1, 21, 126, 19455 }, // Ћ
+    { 20, 29, 21, 1, 28, 145, 19581 }, // Ќ
+    { 22, 28, 24, 1, 28, 154, 19726 }, // Ѝ
+    { 21, 29, 21, 0, 28, 153, 19880 }, // Ў
+    { 21, 28, 23, 1, 21, 147, 20033 }, // Џ
+    { 22, 21, 22, 0, 21, 116, 115 }, // А
+    { 17, 22, 18, 1, 21, 94, 231 }, // Б
+    { 16, 22, 18, 1, 21, 88, 325 }, // В
+    { 15, 21, 17, 1, 21, 79, 413 }, // Г
+    { 21, 27, 22, 0, 21, 142, 492 }, // Д
+    { 17, 21, 18, 1, 21, 90, 634 }, // Е
+    { 29, 22, 29, 0, 21, 160, 724 }, // Ж
+    { 15, 22, 17, 1, 21, 83, 884 }, // З
+    { 22, 21, 24, 1, 21, 116, 967 }, // И
+    { 22, 28, 24, 1, 28, 154, 1083 }, // Й
+    { 20, 22, 21, 1, 21, 110, 1237 }, // К
+    { 21, 22, 22, 0, 21, 116, 1347 }, // Л
+    { 26, 21, 26, 0, 21, 137, 1463 }, // М
+    { 23, 21, 24, 1, 21, 121, 1600 }, // Н
+    { 21, 22, 23, 1, 21, 116, 1721 }, // О
+    { 22, 21, 23, 1, 21, 116, 1837 }, // П
+    { 16, 21, 17, 1, 21, 84, 1953 }, // Р
+    { 17, 22, 19, 1, 21, 94, 2037 }, // С
+    { 18, 21, 20, 1, 21, 95, 2131 }, // Т
+    { 21, 22, 21, 0, 21, 116, 2226 }, // У
+    { 21, 22, 23, 1, 21, 116, 2342 }, // Ф
+    { 21, 21, 21, 0, 21, 111, 2458 }, // Х
+    { 22, 27, 23, 1, 21, 149, 2569 }, // Ц
+    { 20, 21, 21, 0, 21, 105, 2718 }, // Ч
+    { 29, 21, 31, 1, 21, 153, 2823 }, // Ш
+    { 30, 27, 31, 1, 21, 203, 2976 }, // Щ
+    { 21, 22, 22, 1, 21, 116, 3179 }, // Ъ
+    { 26, 22, 27, 1, 21, 143, 3295 }, // Ы
+    { 17, 22, 18, 1, 21, 94, 3438 }, // Ь
+    { 18, 22, 19, 1, 21, 99, 3532 }, // Э
+    { 29, 22, 31, 1, 21, 160, 3631 }, // Ю
+    { 20, 22, 19, -1, 21, 110, 3791 }, // Я
+    { 15, 17, 16, 1, 16, 64, 3901 }, // а
+    { 15, 24, 17, 1, 23, 90, 3965 }, // б
+    { 14, 16, 16, 1, 15, 56, 4055 }, // в
+    { 13, 15, 14, 1, 15, 49, 4111 }, // г
+    { 18, 21, 19, 0, 15, 95, 4160 }, // д
+    { 13, 17, 15, 1, 16, 56, 4255 }, // е
+    { 24, 17, 23, 0, 16, 102, 4311 }, // ж
+    { 13, 17, 14, 0, 16, 56, 4413 }, // з
+    { 18, 15, 20, 1, 15, 68, 4469 }, // и
+    { 18, 22, 20, 1, 22, 99, 4537 }, // й
+    { 16, 17, 17, 1, 16, 68, 4636 }, // к
+    { 17, 16, 18, 0, 15, 68, 4704 }, // л
+    { 21, 15, 22, 1, 15, 79, 4772 }, // м
+    { 19, 15, 20, 1, 15, 72, 4851 }, // н
+    { 16, 17, 17, 1, 16, 68, 4923 }, // о
+    { 18, 15, 20, 1, 15, 68, 4991 }, // п
+    { 17, 23, 18, 0, 16, 98, 5059 }, // р
+    { 13, 17, 15, 1, 16, 56, 5157 }, // с
+    { 15, 15, 16, 1, 15, 57, 5213 }, // т
+    { 18, 22, 17, 0, 15, 99, 5270 }, // у
+    { 20, 30, 21, 1, 23, 150, 5369 }, // ф
+    { 17, 15, 17, 0, 15, 64, 5519 }, // х
+    { 19, 21, 20, 1, 15, 100, 5583 }, // ц
+    { 17, 15, 18, 0, 15, 64, 5683 }, // ч
+    { 24, 15, 26, 1, 15, 90, 5747 }, // ш
+    { 25, 21, 26, 1, 15, 132, 5837 }, // щ
+    { 17, 16, 19, 1, 15, 68, 5969 }, // ъ
+    { 22, 16, 24, 1, 15, 88, 6037 }, // ы
+    { 14, 16, 16, 1, 15, 56, 6125 }, // ь
+    { 13, 17, 15, 1, 16, 56, 6181 }, // э
+    { 23, 17, 24, 1, 16, 98, 6237 }, // ю
+    { 16, 16, 17, 0, 15, 64, 6335 }, // я
+    { 13, 25, 15, 1, 24, 82, 20180 }, // ѐ
+    { 13, 23, 15, 1, 22, 75, 6399 }, // ё
+    { 17, 30, 18, 0, 23, 128, 20262 }, // ђ
+    { 13, 24, 14, 1, 24, 78, 20390 }, // ѓ
+    { 13, 17, 15, 1, 16, 56, 20468 }, // є
+    { 12, 17, 14, 1, 16, 51, 20524 }, // ѕ
+    { 10, 23, 10, 0, 23, 58, 20575 }, // і
+    { 11, 22, 10, -1, 22, 61, 20633 }, // ї
+    { 9, 30, 8, -2, 23, 68, 20694 }, // ј
+    { 23, 16, 23, 0, 15, 92, 20762 }, // љ
+    { 23, 16, 25, 1, 15, 92, 20854 }, // њ
+    { 19, 23, 19, 0, 23, 110, 20946 }, // ћ
+    { 16, 25, 17, 1, 24, 100, 21056 }, // ќ
+    { 18, 24, 20, 1, 24, 108, 21156 }, // ѝ
+    { 18, 29, 17, 0, 22, 131, 21264 }, // ў
+    { 18, 21, 20, 1, 15, 95, 21395 }, // џ
+    { 21, 24, 21, 0, 23, 126, 21490 }, // Ѣ
+    { 16, 22, 18, 1, 21, 88, 21616 }, // ѣ
+    { 21, 22, 23, 1, 21, 116, 21704 }, // Ѳ
+    { 16, 17, 17, 1, 16, 68, 21820 }, // ѳ
+    { 22, 22, 22, 0, 21, 121, 21888 }, // Ѵ
+    { 18, 17, 18, 0, 16, 77, 22009 }, // ѵ
+    { 23, 34, 24, 1, 28, 196, 22086 }, // Ҋ
+    { 19, 28, 20, 1, 22, 133, 22282 }, // ҋ
+    { 18, 22, 18, 0, 21, 99, 22415 }, // Ҍ
+    { 15, 22, 15, 0, 21, 83, 22514 }, // ҍ
+    { 16, 21, 17, 1, 21, 84, 22597 }, // Ҏ
+    { 17, 23, 18, 0, 16, 98, 22681 }, // ҏ
+    { 15, 24, 16, 1, 24, 90, 22779 }, // Ґ
+    { 13, 19, 14, 1, 19, 62, 22869 }, // ґ
+    { 16, 21, 17, 0, 21, 84, 22931 }, // Ғ
+    { 13, 15, 14, 1, 15, 49, 23015 }, // ғ
+    { 18, 27, 19, 1, 21, 122, 23064 }, // Ҕ
+    { 16, 22, 18, 1, 15, 88, 23186 }, // ҕ
+    { 29, 27, 29, 0, 21, 196, 0 }, // Җ
+    { 24, 22, 23, 0, 16, 132, 196 }, // җ
+    { 15, 27, 17, 1, 21, 102, 328 }, // Ҙ
+    { 13, 22, 14, 0, 16, 72, 430 }, // ҙ
+    { 20, 27, 21, 1, 21, 135, 502 }, // Қ
+    { 16, 22, 17, 1, 16, 88, 637 }, // қ
+    { 21, 22, 22, 1, 21, 116, 725 }, // Ҝ
+    { 17, 17, 18, 1, 16, 73, 841 }, // ҝ
+    { 20, 22, 21, 1, 21, 110, 914 }, // Ҟ
+    { 16, 22, 16, 0, 21, 88, 1024 }, // ҟ
+    { 23, 22, 24, 1, 21, 127, 1112 }, // Ҡ
+    { 18, 17, 19, 1, 16, 77, 1239 }, // ҡ
+    { 23, 27, 24, 1, 21, 156, 1316 }, // Ң
+    { 19, 21, 20, 1, 15, 100, 1472 }, // ң
+    { 27, 21, 28, 1, 21, 142, 1572 }, // Ҥ
+    { 21, 15, 23, 1, 15, 79, 1714 }, // ҥ
+    { 29, 27, 30, 1, 21, 196, 1793 }, // Ҧ
+    { 26, 22, 28, 1, 15, 143, 1989 }, // ҧ
+    { 23, 22, 24, 1, 21, 127, 2132 }, // Ҩ
+    { 18, 17, 19, 1, 16, 77, 2259 }, // ҩ
+    { 17, 27, 19, 1, 21, 115, 2336 }, // Ҫ
+    { 13, 22, 15, 1, 16, 72, 2451 }, // ҫ
+    { 18, 27, 20, 1, 21, 122, 2523 }, // Ҭ
+    { 15, 21, 16, 1, 15, 79, 2645 }, // ҭ
+    { 20, 21, 20, 0, 21, 105, 2724 }, // Ү
+    { 18, 22, 17, 0, 15, 99, 2829 }, // ү
+    { 20, 21, 20, 0, 21, 105, 2928 }, // Ұ
+    { 18, 22, 17, 0, 15, 99, 3033 }, // ұ
+    { 21, 27, 21, 0, 21, 142, 3132 }, // Ҳ
+    { 17, 21, 17, 0, 15, 90, 3274 }, // ҳ
+    { 25, 27, 26, 1, 21, 169, 3364 }, // Ҵ
+    { 23, 21, 23, 0, 15, 121, 3533 }, // ҵ
+    { 20, 27, 21, 0, 21, 135, 3654 }, // Ҷ
+    { 18, 21, 18, 0, 15, 95, 3789 }, // ҷ
+    { 20, 21, 21, 0, 21, 105, 3884 }, // Ҹ
+    { 17, 15, 18, 0, 15, 64, 3989 }, // ҹ
+    { 20, 21, 21, 1, 21, 105, 4053 }, // Һ
+    { 19, 23, 19, 0, 23, 110, 4158 }, // һ
+    { 23, 22, 24, 0, 21, 127, 4268 }, // Ҽ
+    { 18, 17, 18, 0, 16, 77, 4395 }, // ҽ
+    { 23, 27, 24, 0, 21, 156, 4472 }, // Ҿ
+    { 18, 22, 18, 0, 16, 99, 4628 }, // ҿ
+    { 9, 21, 11, 1, 21, 48, 4727 }, // Ӏ
+    { 29, 29, 29, 0, 28, 211, 4775 }, // Ӂ
+    { 24, 23, 23, 0, 22, 138, 4986 }, // ӂ
+    { 19, 27, 20, 1, 21, 129, 5124 }, // Ӄ
+    { 15, 23, 17, 1, 16, 87, 5253 }, // ӄ
+    { 21, 27, 22, 0, 21, 142, 5340 }, // Ӆ
+    { 18, 21, 18, 0, 15, 95, 5482 }, // ӆ
+    { 23, 27, 24, 1, 21, 156, 5577 }, // Ӈ
+    { 19, 22, 20, 1, 15, 105, 5733 }, // ӈ
+    { 23, 27, 24, 1, 21, 156, 5838 }, // Ӊ
+    { 19, 21, 20, 1, 15, 100, 5994 }, // ӊ
+    { 20, 27, 21, 0, 21, 135, 6094 }, // Ӌ
+    { 17, 21, 18, 0, 15, 90, 6229 }, // ӌ
+    { 26, 27, 26, 0, 21, 176, 6319 }, // Ӎ
+    { 21, 21, 22, 1, 15, 111, 6495 }, // ӎ
+    { 9, 23, 9, 0, 23, 52, 6606 }, // ӏ
+    { 22, 28, 22, 0, 28, 154, 6658 }, // Ӑ
+    { 15, 23, 16, 1, 22, 87, 6812 }, // ӑ
+    { 22, 27, 22, 0, 27, 149, 6899 }, // Ӓ
+    { 15, 23, 16, 1, 22, 87, 7048 }, // ӓ
+    { 27, 21, 27, -1, 21, 142, 7135 }, // Ӕ
+    { 22, 17, 24, 1, 16, 94, 7277 }, // ӕ
+    { 17, 28, 18, 1, 28, 119, 7371 }, // Ӗ
+    { 13, 23, 15, 1, 22, 75, 7490 }, // ӗ
+    { 18, 22, 20, 1, 21, 99, 7565 }, // Ә
+    { 13, 17, 15, 1, 16, 56, 7664 }, // ә
+    { 18, 28, 20, 1, 27, 126, 7720 }, // Ӛ
+    { 13, 23, 15, 1, 22, 75, 7846 }, // ӛ
+    { 29, 28, 29, 0, 27, 203, 7921 }, // Ӝ
+    { 24, 23, 23, 0, 22, 138, 8124 }, // ӝ
+    { 15, 28, 17, 1, 27, 105, 8262 }, // Ӟ
+    { 13, 23, 14, 0, 22, 75, 8367 }, // ӟ
+    { 16, 22, 17, 0, 21, 88, 8442 }, // Ӡ
+    { 14, 22, 15, 0, 15, 77, 8530 }, // ӡ
+    { 22, 26, 24, 1, 26, 143, 8607 }, // Ӣ
+    { 18, 21, 20, 1, 21, 95, 8750 }, // ӣ
+    { 22, 27, 24, 1, 27, 149, 8845 }, // Ӥ
+    { 18, 22, 20, 1, 22, 99, 8994 }, // ӥ
+    { 21, 28, 23, 1, 27, 147, 9093 }, // Ӧ
+    { 16, 23, 17, 1, 22, 92, 9240 }, // ӧ
+    { 21, 22, 23, 1, 21, 116, 9332 }, // Ө
+    { 16, 17, 17, 1, 16, 68, 9448 }, // ө
+    { 21, 28, 24, 1, 27, 147, 9516 }, // Ӫ
+    { 16, 23, 17, 1, 22, 92, 9663 }, // ӫ
+    { 18, 28, 19, 1, 27, 126, 9755 }, // Ӭ
+    { 13, 23, 15, 1, 22, 75, 9881 }, // ӭ
+    { 21, 27, 21, 0, 26, 142, 9956 }, // Ӯ
+    { 18, 28, 17, 0, 21, 126, 10098 }, // ӯ
+    { 21, 28, 21, 0, 27, 147, 10224 }, // Ӱ
+    { 18, 29, 17, 0, 22, 131, 10371 }, // ӱ
+    { 21, 30, 21, 0, 29, 158, 10502 }, // Ӳ
+    { 18, 31, 17, 0, 24, 140, 10660 }, // ӳ
+    { 20, 27, 21, 0, 27, 135, 10800 }, // Ӵ
+    { 17, 22, 18, 0, 22, 94, 10935 }, // ӵ
+    { 15, 27, 17, 1, 21, 102, 11029 }, // Ӷ
+    { 13, 21, 14, 1, 15, 69, 11131 }, // ӷ
+    { 26, 28, 28, 1, 27, 182, 11200 }, // Ӹ
+    { 22, 23, 24, 1, 22, 127, 11382 }, // ӹ
+    { 16, 27, 17, 0, 21, 108, 11509 }, // Ӻ
+    { 13, 21, 14, 1, 15, 69, 11617 }, // ӻ
+    { 21, 27, 20, 0, 21, 142, 11686 }, // Ӽ
+    { 17, 22, 17, 0, 15, 94, 11828 }, // ӽ
+    { 21, 21, 21, 0, 21, 111, 11922 }, // Ӿ
+    { 17, 15, 17, 0, 15, 64, 12033 }, // ӿ
+    { 0, 0, 15, 0, 0, 0, 12097 }, //  
+    { 0, 0, 29, 0, 0, 0, 12097 }, //  
+    { 0, 0, 15, 0, 0, 0, 12097 }, //  
+    { 0, 0, 29, 0, 0, 0, 12097 }, //  
+    { 0, 0, 10, 0, 0, 0, 12097 }, //  
+    { 0, 0, 7, 0, 0, 0, 12097 }, //  
+    { 0, 0, 5, 0, 0, 0, 12097 }, //  
+    { 0, 0, 18, 0, 0, 0, 12097 }, //  
+    { 0, 0, 8, 0, 0, 0, 12097 }, //  
+    { 0, 0, 6, 0, 0, 0, 12097 }, //  
+    { 0, 0, 1, 0, 0, 0, 12097 }, //  
+    { 0, 0, 0, 0, 0, 0, 12097 }, // ​
+    { 2, 24, 0, -1, 17, 12, 12097 }, // ‌
+    { 6, 26, 0, -3, 19, 39, 12109 }, // ‍
+    { 10, 28, 0, -5, 21, 70, 12148 }, // ‎
+    { 10, 28, 0, -5, 21, 70, 12218 }, // ‏
+    { 9, 3, 11, 1, 9, 7, 12288 }, // ‐
+    { 9, 3, 11, 1, 9, 7, 12295 }, // ‑
+    { 14, 3, 18, 2, 11, 11, 12302 }, // ‒
+    { 15, 3, 15, 0, 9, 12, 12457 }, // –
+    { 29, 3, 29, 0, 9, 22, 12469 }, // —
+    { 29, 3, 29, 0, 9, 22, 12313 }, // ―
+    { 10, 30, 15, 2, 23, 75, 12335 }, // ‖
+    { 15, 7, 15, 0, -1, 27, 12410 }, // ‗
+    { 5, 10, 7, 1, 22, 13, 12491 }, // ‘
+    { 6, 10, 7, 0, 22, 15, 12504 }, // ’
+    { 6, 10, 7, 0, 4, 15, 12437 }, // ‚
+    { 5, 10, 7, 1, 22, 13, 12452 }, // ‛
+    { 11, 10, 13, 1, 22, 28, 12519 }, // “
+    { 12, 10, 13, 0, 22, 30, 12547 }, // ”
+    { 12, 10, 13, 0, 4, 30, 12465 }, // „
+    { 11, 10, 13, 1, 22, 28, 12495 }, // ‟
+    { 14, 19, 15, 0, 21, 67, 12523 }, // †
+    { 14, 23, 15, 0, 21, 81, 12590 }, // ‡
+    { 7, 7, 9, 1, 11, 13, 12671 }, // •
+    { 10, 10, 18, 4, 15, 25, 12684 }, // ‣
+    { 6, 5, 8, 1, 4, 8, 12709 }, // ․
+    { 12, 5, 15, 1, 4, 15, 12717 }, // ‥
+    { 25, 5, 29, 2, 4, 32, 12577 }, // …
+    { 6, 4, 8, 1, 10, 6, 12732 }, // ‧
+    { 0, 0, 0, 0, 0, 0, 12738 }, //  
+    { 0, 0, 0, 0, 0, 0, 12738 }, //  
+    { 10, 28, 0, -5, 21, 70, 12738 }, // ‪
+    { 10, 28, 0, -5, 21, 70, 12808 }, // ‫
+    { 10, 27, 0, -5, 20, 68, 12878 }, // ‬
+    { 12, 28, 0, -6, 21, 84, 12946 }, // ‭
+    { 12, 28, 0, -6, 21, 84, 13030 }, // ‮
+    { 0, 0, 3, 0, 0, 0, 13114 }, //  
+    { 38, 24, 40, 1, 22, 228, 13114 }, // ‰
+    { 6, 10, 8, 1, 21, 15, 13342 }, // ′
+    { 12, 10, 13, 1, 21, 30, 13357 }, // ″
+    { 17, 10, 19, 1, 21, 43, 13387 }, // ‴
+    { 6, 10, 8, 1, 21, 15, 13430 }, // ‵
+    { 12, 10, 14, 1, 21, 30, 13445 }, // ‶
+    { 19, 10, 20, 1, 21, 48, 13475 }, // ‷
+    { 13, 6, 14, 1, 0, 20, 13523 }, // ‸
+    { 7, 11, 9, 1, 13, 20, 13543 }, // ‹
+    { 8, 11, 9, 1, 13, 22, 13563 }, // ›
+    { 18, 20, 18, 0, 19, 90, 13585 }, // ※
+    { 13, 23, 16, 2, 22, 75, 13675 }, // ‼
+    { 15, 3, 15, 0, 24, 12, 13750 }, // ‾
+    { 7, 3, 9, 1, 9, 6, 13762 }, // ⁃
+    { 15, 24, 5, -5, 22, 90, 13768 }, // ⁄
+    { 23, 23, 26, 2, 22, 133, 13858 }, // ⁇
+    { 19, 23, 22, 2, 22, 110, 13991 }, // ⁈
+    { 19, 23, 22, 2, 22, 110, 14101 }, // ⁉
+    { 17, 5, 29, 6, 11, 22, 14211 }, // ⁓
+    { 23, 10, 25, 1, 21, 58, 14233 }, // ⁗
+    { 0, 0, 6, 0, 0, 0, 14291 }, //  
+    { 0, 0, 0, 0, 0, 0, 14291 }, // ⁠
+    { 0, 0, 0, 0, 0, 0, 14291 }, // ⁡
+    { 0, 0, 0, 0, 0, 0, 14291 }, // ⁢
+    { 0, 0, 0, 0, 0, 0, 14291 }, // ⁣
+    { 0, 0, 0, 0, 0, 0, 14291 }, // ⁤
+    { 11, 14, 13, 1, 24, 39, 14291 }, // ⁰
+    { 11, 14, 13, 1, 24, 39, 14330 }, // ⁴
+    { 10, 14, 13, 1, 24, 35, 14369 }, // ⁵
+    { 11, 14, 13, 1, 24, 39, 14404 }, // ⁶
+    { 10, 14, 13, 2, 24, 35, 14443 }, // ⁷
+    { 11, 14, 13, 1, 24, 39, 14478 }, // ⁸
+    { 11, 14, 13, 1, 24, 39, 14517 }, // ⁹
+    { 13, 11, 16, 2, 21, 36, 14556 }, // ⁿ
+    { 11, 15, 13, 1, 10, 42, 14592 }, // ₀
+    { 9, 14, 13, 2, 10, 32, 14634 }, // ₁
+    { 11, 14, 13, 1, 10, 39, 14666 }, // ₂
+    { 9, 15, 13, 2, 10, 34, 14705 }, // ₃
+    { 11, 15, 13, 1, 10, 42, 14739 }, // ₄
+    { 10, 14, 13, 1, 9, 35, 14781 }, // ₅
+    { 11, 15, 13, 1, 10, 42, 14816 }, // ₆
+    { 10, 14, 13, 2, 9, 35, 14858 }, // ₇
+    { 11, 15, 13, 1, 10, 42, 14893 }, // ₈
+    { 11, 15, 13, 1, 10, 42, 14935 }, // ₉
+    { 15, 20, 18, 1, 20, 75, 14977 }, // ₣
+    { 16, 22, 18, 1, 21, 88, 15052 }, // ₤
+    { 36, 22, 36, 0, 21, 198, 15140 }, // ₧
+    { 18, 22, 18, 0, 21, 99, 15338 }, // €
+    { 17, 12, 29, 6, 16, 51, 15437 }, // ←
+    { 13, 20, 29, 8, 20, 65, 15488 }, // ↑
+    { 17, 12, 29, 6, 16, 51, 15553 }, // →
+    { 13, 20, 29, 8, 20, 65, 15604 }, // ↓
+    { 18, 12, 29, 5, 16, 54, 15669 }, // ↔
+    { 13, 20, 29, 8, 20, 65, 15723 }, // ↕
+    { 13, 20, 29, 8, 20, 65, 15788 }, // ↨
+    { 13, 20, 29, 8, 20, 65, 15853 }, // ↲
+    { 13, 20, 29, 8, 20, 65, 15918 }, // ↳
+    { 17, 14, 29, 6, 17, 60, 15983 }, // ↵
+    { 17, 14, 29, 6, 17, 60, 16043 }, // ⇐
+    { 13, 18, 29, 8, 19, 59, 16103 }, // ⇑
+    { 17, 14, 29, 6, 17, 60, 16162 }, // ⇒
+    { 13, 18, 29, 8, 19, 59, 16222 }, // ⇓
+    { 19, 14, 29, 5, 17, 67, 16281 }, // ⇔
+    { 19, 22, 29, 5, 21, 105, 16348 }, // ∀
+    { 14, 24, 18, 2, 23, 84, 16453 }, // ∂
+    { 13, 21, 29, 8, 21, 69, 16537 }, // ∃
+    { 23, 24, 29, 3, 22, 138, 16606 }, // ∅
+    { 19, 21, 19, 0, 21, 100, 16744 }, // ∆
+    { 19, 22, 29, 5, 21, 105, 16844 }, // ∇
+    { 19, 21, 29, 5, 21, 100, 16949 }, // ∈
+    { 19, 26, 29, 5, 23, 124, 17049 }, // ∉
+    { 19, 16, 29, 5, 18, 76, 17173 }, // ∊
+    { 19, 21, 29, 5, 21, 100, 17249 }, // ∋
+    { 19, 26, 29, 5, 23, 124, 17349 }, // ∌
+    { 19, 16, 29, 5, 18, 76, 17473 }, // ∍
+    { 22, 26, 23, 1, 21, 143, 17549 }, // ∏
+    { 18, 26, 18, 0, 21, 117, 17692 }, // ∑
+    { 13, 3, 18, 3, 11, 10, 17809 }, // −
+    { 13, 23, 14, 1, 21, 75, 17819 }, // ∕
+    { 13, 23, 15, 2, 21, 75, 17894 }, // ∖
+    { 14, 14, 18, 2, 17, 49, 17969 }, // ∗
+    { 10, 10, 18, 4, 15, 25, 18018 }, // ∘
+    { 6, 4, 18, 6, 10, 6, 18043 }, // ∙
+    { 18, 28, 18, 0, 24, 126, 18049 }, // √
+    { 14, 11, 18, 2, 15, 39, 18175 }, // ∝
+    { 18, 10, 18, 0, 14, 45, 18214 }, // ∞
+    { 19, 21, 29, 5, 21, 100, 18259 }, // ∟
+    { 21, 21, 29, 3, 21, 111, 18359 }, // ∠
+    { 4, 30, 15, 5, 23, 30, 18470 }, // ∣
+    { 9, 30, 15, 3, 23, 68, 18500 }, // ∥
+    { 19, 21, 29, 5, 21, 100, 18568 }, // ∧
+    { 19, 21, 29, 5, 21, 100, 18668 }, // ∨
+    { 17, 21, 29, 6, 21, 90, 18768 }, // ∩
+    { 17, 22, 29, 6, 21, 94, 18858 }, // ∪
+    { 16, 30, 18, 1, 23, 120, 18952 }, // ∫
+    { 19, 17, 29, 5, 16, 81, 19072 }, // ∴
+    { 19, 17, 29, 5, 16, 81, 19153 }, // ∵
+    { 5, 16, 9, 2, 18, 20, 19234 }, // ∶
+    { 19, 17, 29, 5, 16, 81, 19254 }, // ∷
+    { 17, 5, 29, 6, 11, 22, 19335 }, // ∼
+    { 17, 15, 29, 6, 17, 64, 19357 }, // ≅
+    { 14, 10, 18, 2, 15, 35, 19421 }, // ≈
+    { 17, 10, 29, 6, 13, 43, 19456 }, // ≍
+    { 13, 13, 18, 3, 16, 43, 19499 }, // ≠
+    { 17, 13, 29, 6, 15, 56, 19542 }, // ≡
+    { 14, 18, 18, 2, 18, 63, 19598 }, // ≤
+    { 14, 18, 18, 2, 18, 63, 19661 }, // ≥
+    { 23, 14, 29, 3, 17, 81, 19724 }, // ≪
+    { 23, 14, 29, 3, 17, 81, 19805 }, // ≫
+    { 19, 16, 29, 5, 18, 76, 19886 }, // ⊃
+    { 19, 26, 29, 5, 23, 124, 19962 }, // ⊄
+    { 19, 26, 29, 5, 23, 124, 20086 }, // ⊅
+    { 19, 21, 29, 5, 21, 100, 20210 }, // ⊆
+    { 19, 21, 29, 5, 21, 100, 20310 }, // ⊇
+    { 21, 22, 29, 4, 21, 116, 20410 }, // ⊕
+    { 21, 22, 29, 4, 21, 116, 20526 }, // ⊖
+    { 21, 22, 29, 4, 21, 116, 20642 }, // ⊗
+    { 21, 22, 29, 4, 21, 116, 20758 }, // ⊘
+    { 17, 21, 29, 6, 21, 90, 20874 }, // ⊥
+    { 6, 5, 18, 6, 10, 8, 20964 }, // ⋅
+    { 25, 5, 29, 2, 10, 32, 20972 }, // ⋯
+    { 24, 23, 22, 0, 23, 138, 21004 }, // ﬀ
+    { 19, 23, 19, 0, 23, 110, 21142 }, // ﬁ
+    { 19, 23, 19, 0, 23, 110, 21252 }, // ﬂ
+    { 29, 23, 29, 0, 23, 167, 21362 }, // ﬃ
+    { 29, 23, 29, 0, 23, 167, 21529 }, // ﬄ
+    { 22, 24, 22, 0, 23, 132, 21696 }, // ﬅ
+    { 25, 24, 26, 1, 23, 150, 21828 }, // ﬆ
+    { 27, 28, 29, 1, 24, 189, 21978 }, // �
 };
 
 static const EpdUnicodeInterval bookerly_14_regularIntervals[] = {
@@ -2512,32 +2565,332 @@ static const EpdUnicodeInterval bookerly_14_regularIntervals[] = {
     { 0x22A5, 0x22A5, 0x2E7 },
     { 0x22C5, 0x22C5, 0x2E8 },
     { 0x22EF, 0x22EF, 0x2E9 },
-    { 0xFFFD, 0xFFFD, 0x2EA },
+    { 0xFB00, 0xFB06, 0x2EA },
+    { 0xFFFD, 0xFFFD, 0x2F1 },
 };
 
 static const EpdFontGroup bookerly_14_regularGroups[] = {
-    { 0, 3859, 7260, 100, 0 },
-    { 3859, 3744, 8944, 96, 100 },
-    { 7603, 5260, 14211, 128, 196 },
-    { 12863, 378, 436, 33, 324 },
-    { 13241, 8856, 23451, 220, 357 },
-    { 22097, 1215, 2346, 74, 577 },
-    { 23312, 514, 686, 18, 651 },
-    { 23826, 303, 460, 4, 669 },
-    { 24129, 513, 911, 15, 673 },
-    { 24642, 2221, 4656, 58, 688 },
-    { 26863, 116, 189, 1, 746 },
+    { 0, 5261, 12609, 151, 5 },
+    { 5261, 3245, 6474, 66, 358 },
+    { 8506, 9025, 23274, 261, 0 },
+    { 17531, 10185, 22167, 276, 471 },
+};
+
+static const uint8_t bookerly_14_regularGlyphGroups[754] = {
+    2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0,
+    2, 2, 2, 2, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0,
+    0, 2, 2, 2, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0,
+    0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 3, 3, 3, 0, 0, 3, 3, 0, 0, 3,
+    3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+};
+
+static const uint8_t bookerly_14_regularKernLeftClasses[754] = {
+    0, 0, 0, 0, 0, 0, 0, 104, 0, 0, 0, 0, 104, 70, 0, 72,
+    0, 3, 23, 3, 26, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 132, 2, 103, 63, 12, 0, 58, 75, 35, 35, 37,
+    59, 39, 105, 27, 12, 61, 64, 30, 50, 7, 4, 9, 9, 77, 5, 92,
+    97, 55, 0, 0, 0, 0, 31, 24, 78, 71, 48, 22, 57, 21, 71, 118,
+    86, 68, 21, 21, 24, 24, 106, 29, 74, 110, 33, 14, 14, 123, 14, 126,
+    80, 0, 0, 0, 0, 112, 0, 0, 0, 0, 0, 0, 0, 0, 0, 81,
+    0, 23, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 54,
+    0, 0, 0, 44, 2, 2, 2, 2, 2, 2, 0, 63, 0, 0, 0, 0,
+    35, 35, 35, 35, 12, 27, 12, 12, 12, 12, 12, 0, 93, 4, 4, 4,
+    4, 5, 56, 100, 31, 31, 31, 31, 31, 31, 48, 78, 48, 48, 48, 48,
+    71, 71, 41, 41, 107, 21, 24, 24, 24, 24, 24, 0, 24, 33, 33, 33,
+    33, 14, 24, 14, 2, 31, 2, 31, 49, 82, 63, 78, 63, 78, 63, 78,
+    63, 78, 12, 28, 12, 71, 0, 48, 0, 48, 0, 48, 136, 119, 0, 48,
+    75, 57, 75, 57, 75, 57, 75, 57, 35, 21, 35, 21, 35, 41, 35, 41,
+    35, 41, 117, 115, 35, 71, 37, 118, 37, 99, 59, 86, 86, 39, 68, 39,
+    68, 0, 28, 0, 0, 39, 83, 27, 21, 27, 21, 27, 21, 21, 27, 21,
+    12, 24, 12, 24, 12, 24, 0, 48, 30, 29, 30, 29, 30, 29, 50, 74,
+    50, 74, 50, 74, 50, 74, 7, 128, 7, 0, 7, 110, 4, 33, 4, 33,
+    4, 33, 4, 33, 4, 33, 4, 91, 9, 14, 5, 14, 5, 92, 126, 92,
+    126, 92, 126, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 124, 124, 79, 0, 129, 95, 13, 13, 45, 15, 15,
+    62, 10, 13, 1, 13, 17, 102, 51, 6, 25, 124, 10, 51, 13, 13, 10,
+    13, 90, 13, 11, 13, 36, 108, 6, 1, 67, 47, 25, 13, 13, 25, 15,
+    13, 15, 11, 11, 13, 53, 18, 127, 34, 52, 66, 46, 89, 76, 76, 46,
+    76, 76, 76, 18, 76, 18, 109, 34, 16, 18, 84, 52, 76, 76, 52, 32,
+    76, 32, 18, 18, 76, 66, 66, 96, 34, 135, 122, 121, 111, 130, 32, 32,
+    73, 46, 76, 16, 76, 98, 113, 11, 18, 42, 85, 25, 52, 15, 32, 36,
+    18, 40, 94, 38, 34, 0, 0, 43, 88, 51, 89, 43, 88, 10, 46, 10,
+    46, 10, 46, 25, 52, 0, 0, 0, 0, 101, 114, 108, 109, 6, 34, 20,
+    16, 20, 16, 60, 116, 25, 52, 25, 52, 13, 76, 69, 73, 120, 66, 120,
+    66, 13, 10, 46, 133, 131, 25, 52, 45, 87, 25, 52, 13, 76, 25, 52,
+    125, 17, 53, 17, 53, 124, 66, 124, 66, 11, 18, 11, 18, 10, 46, 51,
+    89, 134, 76, 13, 76, 13, 76, 11, 18, 11, 18, 11, 18, 11, 18, 1,
+    16, 1, 16, 1, 16, 13, 76, 6, 34, 13, 76, 38, 34, 65, 84, 47,
+    84, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 23, 23, 0, 23, 23, 23, 0, 0, 8, 19, 3, 8, 8, 19, 3,
+    8, 0, 0, 0, 0, 0, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 81, 54, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22, 71, 68, 71, 68, 110,
+    110, 0,
+};
+
+static const uint8_t bookerly_14_regularKernRightClasses[754] = {
+    0, 0, 0, 0, 0, 0, 99, 74, 0, 0, 0, 0, 74, 0, 64, 46,
+    0, 37, 12, 4, 34, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 94,
+    93, 0, 0, 0, 33, 0, 2, 39, 5, 39, 39, 39, 5, 39, 39, 62,
+    39, 39, 92, 39, 5, 39, 5, 39, 73, 32, 19, 28, 28, 88, 18, 110,
+    0, 23, 101, 0, 0, 0, 24, 87, 1, 1, 1, 50, 21, 31, 91, 85,
+    31, 31, 52, 52, 1, 100, 1, 52, 26, 44, 14, 20, 20, 81, 11, 60,
+    0, 0, 98, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 41,
+    0, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65,
+    0, 0, 0, 105, 2, 2, 2, 2, 2, 2, 43, 5, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 5, 5, 5, 5, 5, 0, 89, 19, 19, 19,
+    19, 18, 39, 75, 24, 24, 24, 77, 79, 24, 24, 1, 1, 1, 1, 71,
+    107, 91, 63, 29, 1, 52, 1, 1, 1, 1, 1, 0, 76, 14, 14, 14,
+    14, 11, 31, 11, 2, 82, 2, 80, 2, 24, 5, 1, 5, 1, 5, 1,
+    5, 1, 39, 1, 39, 1, 39, 1, 39, 1, 39, 1, 39, 1, 39, 1,
+    5, 21, 5, 21, 5, 21, 5, 21, 39, 31, 39, 86, 39, 29, 39, 29,
+    39, 29, 39, 91, 39, 91, 39, 91, 62, 59, 39, 31, 52, 39, 31, 39,
+    31, 39, 31, 39, 31, 39, 69, 39, 52, 39, 52, 39, 52, 52, 39, 52,
+    5, 1, 5, 1, 5, 1, 5, 1, 39, 52, 39, 52, 39, 103, 73, 26,
+    73, 26, 73, 26, 73, 61, 32, 44, 32, 44, 32, 44, 19, 14, 19, 14,
+    19, 14, 19, 14, 19, 14, 19, 14, 28, 20, 18, 11, 18, 110, 60, 110,
+    60, 110, 90, 75, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 42, 42, 13, 42, 15, 106, 42, 42, 83, 40, 42,
+    13, 42, 42, 25, 42, 22, 42, 42, 42, 57, 42, 45, 102, 42, 42, 42,
+    40, 97, 42, 15, 42, 42, 15, 13, 25, 56, 58, 42, 27, 42, 42, 13,
+    42, 42, 109, 42, 70, 35, 96, 8, 8, 53, 3, 55, 48, 8, 8, 8,
+    30, 8, 8, 3, 8, 66, 3, 9, 7, 3, 51, 8, 10, 8, 8, 9,
+    8, 8, 48, 8, 49, 3, 3, 78, 8, 3, 67, 108, 68, 84, 30, 8,
+    78, 8, 8, 7, 8, 13, 9, 15, 3, 54, 7, 42, 8, 111, 112, 42,
+    66, 42, 8, 42, 8, 42, 8, 45, 55, 102, 48, 42, 8, 42, 8, 0,
+    0, 13, 9, 42, 8, 42, 8, 42, 8, 15, 3, 15, 3, 13, 9, 38,
+    7, 38, 7, 58, 51, 0, 9, 27, 10, 27, 10, 42, 78, 36, 16, 36,
+    16, 42, 45, 55, 42, 8, 40, 30, 42, 8, 42, 8, 27, 10, 0, 8,
+    78, 22, 35, 22, 35, 47, 35, 42, 3, 104, 72, 0, 72, 45, 55, 102,
+    48, 0, 95, 42, 8, 42, 8, 15, 3, 15, 3, 15, 3, 0, 48, 25,
+    7, 25, 7, 25, 7, 0, 10, 42, 8, 42, 8, 42, 8, 58, 51, 58,
+    51, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 12, 12, 0, 12, 12, 12, 0, 0, 6, 17, 4, 6, 6, 17, 4,
+    6, 0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 41, 65, 0, 99, 0, 0, 0,
+    33, 33, 99, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50,
+    26, 0,
+};
+
+static const int8_t bookerly_14_regularKernMatrix[15481] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -3, -4, 0, 0, -1, -2, -1, -1, 0, -1, 0, 0, -2, -3, 1, 0, 0, 0, 0, -5, 0, 0, 1, 0, 0, 0, 0, -3, 0, 0, 0, -3, -3, -1, -4, 1, 0, -3, -2, 0, 0, 0, -1, 0, -5, -3, -4, 0, -1, 0, -4, 1, -2, -2, -3, 0, 0, 0, 0, 0, 0, 0, -1, -1, -3, 2, 0, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0,
+    0, 0, 1, 0, 0, -1, -3, 0, 0, 0, 0, -2, -1, 0, -1, 0, 0, -2, -3, -2, -2, 0, 0, -3, 0, 0, 0, 0, -3, 0, 0, 0, -3, -2, 1, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, -1, -2, -1, 0, -1, -2, -2, 0, -2, -1, -1, -1, -1, -2, -1, -2, 0, 1, 0, 0, -2, 0, -3, -3, 0, 0, 0, -2, 0, 0, 0, -2, 0, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, -3, 0, -1, 1, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, 1, 0, 0, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, -3, 0, -2, -1, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 1, 1, 0, -1, -2, 0, 0, -2, 0, -2, 0, 1, 2, 0, 1, 0, 0, -3, 0, 0, -2, 0, 0, 0, -1, 0, -3, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 1, -1, -2, 0, 1, 0, -1, 0, 0, 0, 1, 0, -2, 0, -1, 0, 0, -2, -2, 0, -1, -1, -1, -1, 0, 0, 0, 1, 1, 0, -1, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, -3, 0, 1, 0, 0, 0, 0, 0, -1, 0, 0, -1, -3, 1, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, -4, -2, -1, -3, 0, 0, -2, -1, 0, 0, 0, -1, 0, -3, -1, -3, 0, 0, 0, -2, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 1, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, -3, 0, -3, -1, 1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 1, 0, 0, 0, -2, 0, 0, -2, 0, -2, 0, 0, 1, 0, 0, 0, 0, -4, 0, 0, -3, 0, 0, 0, -1, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, 1, 0, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -2, -2, 0, -2, -2, 0, -2, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -2, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, -1, -2, 0, 0, 1, -1, 0, 1, 1, -1, 1, 1, 0, 0, 0, 0, -2, 1, 0, -2, 0, 0, -4, 0, 0, 0, -4, 0, -1, 0, 0, 0, -1, 1, 0, 0, -2, 0, 1, 0, -1, 0, 1, 0, 0, 0, -1, 1, 1, -1, -1, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 1, 0,
+    0, -2, -3, 0, -3, -1, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 1, 1, 0, -1, -3, 0, 0, -2, 0, -2, 0, 1, 2, 0, 1, 0, 0, -4, 0, 0, -3, 0, 0, 0, -1, 0, -4, 0, 0, 1, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 2, -1, -2, 0, 2, 0, -1, 0, 0, 0, 1, 0, -2, 0, -1, 0, 0, -2, -1, 0, -1, -2, -1, -1, 0, 0, 0, 1, 1, 0, -1, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, -1, -1, 0, -2, -2, 0, 0, -1, 0, -1, -3, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, -1, 0, 0, 0, -1, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, -2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, -2, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -2, 0, 0, -2, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, -1, -1, 0, -1, -1, 0, 1, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, -2, 0, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 1, -1, 0, -3, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, -1, -2, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, -2, 0, 1, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -2, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -3, -1, 0, -2, -2, 0, -1, -3, 0, -1, -1, -2, 0, 0, 0, 0, 1, -3, 0, -2, 0, -4, 0, 0, 1, 0, 0, -2, 1, 0, -3, 0, -3, 0, 1, -1, 0, 0, 0, 0, -2, 1, 0, 0, 0, 1, 0, 0, -3, 0, -1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -3, -1, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 1, 0, 0, -2, -3, 0, -1, 0, -2, 0, 1, 1, -2, 0, 0, 0, 0, -1, 0, -2, 1, 0, -2, 0, 0, -5, 0, -1, 0, -5, 0, -2, 0, 0, 0, -2, 1, 0, 0, -2, 0, 1, -1, -2, 0, 1, 0, 0, 0, -2, 1, 0, -1, -1, 0, -1, 0, 0, -1, -1, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, -2, 0, 0, -1, -1, -1, -1, 0, -1, 0, 0, -1, -2, 1, 0, 0, 0, 0, -2, 0, 0, 1, 0, 0, 0, 0, -2, 0, 0, 0, -3, -2, -1, -2, 1, 0, -2, -1, 0, 0, 0, -1, 0, -3, -1, -3, 0, -1, 0, -2, 1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, 2, 0, -2, 0, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 2, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 3, 0, 0, 1, 0, 0, 2, 0, 0, 0, 0, 0, 4, 0, 0, 0, 2, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 1, 0, 2, 3, 0, 0, 0, 0, 0, 0, 1, 0, 0, 3, 0, 0, 1, 0, 1, 0, 0, 1, 0, 0, 1, 3, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 3, 2, 0, 2, 0, 1, 0, 0, 0, 3, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, -1, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -3, -3, -3, 0, -1, 0, -1, -1, -1, 0, -1, 0, 0, -1, -1, -1, 0, 0, 0, -1, -2, -3, 0, -3, 0, -3, 0, 0, 1, -2, 0, 0, 0, 0, -3, 0, 0, 0, 0, -2, 0, 0, -4, 0, 0, 0, -4, -1, -3, -1, -1, -1, -3, 0, -1, -1, -2, 0, 0, -1, -3, 0, 1, 0, 0, -1, -3, 1, 0, 0, -3, 0, -1, 0, 0, -3, -3, 0, -3, -3, -1, -3, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0,
+    0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 2, 0, 0, 1, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 3, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 2, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 1, 0, 0, 3, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 2, 3, 3, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 2, 1, 0, 2, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, -2, 0, 1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 1, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, -2, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, -1, -2, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, -1, -2, -1, -1, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, -2, 0, -1, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -3, 0, 1, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -3, 0, 0, -3, 0, 0, -2, 0, 0, 0, 0, -1, 1, -4, 0, -1, 0, 0, 0, -2, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 1, 0, -1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, 1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, -2, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 1, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, -1, -1, -2, 0, 0, -2, 0, 0, 0, 0, 0, 1, -3, 0, -2, 0, 0, 0, -2, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -2, -1, -1, 0, 0, -3, 0, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, -2, 0, 1, -1, -2, -1, -2, 0, -1, 0, 0, -1, -3, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -3, -2, -3, -2, 0, 0, -2, 0, 0, 0, 0, -1, 1, -4, -2, -3, 0, -1, 0, -3, 0, -1, -1, -3, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, -2, 0, 1, 0, -1, -1, -1, 0, -1, 0, 0, -1, -3, 1, 0, 0, 0, 0, -4, 0, 0, 1, 0, 0, 0, 0, -3, 0, 0, 0, 0, -2, -1, -2, 1, 0, -2, -1, 0, 0, 0, -1, 0, -5, -2, -3, 0, -1, 0, -3, 0, -1, -1, -3, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, -1, 1, 0, -2, -2, 0, 0, -1, 0, -1, -3, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, -1, 0, -1, 0, -1, 0, 0, 0, -1, 0, -1, -1, -1, 0, 0, -2, -1, -1, 0, 0, 0, -1, 0, -1, 0, -2, 0, 0, -1, -1, 0, 0, -1, 0, 0, -1, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, -2, 0, 0, 0, 0, 0, -1, -1, 1, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, 1, 0, 0, -1, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -1, 0, -2, -2, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -2, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 1, 0, 1, 0, 0, -1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, -1, -3, 0, 0, 0, 0, -2, -1, 0, -1, 0, 0, -2, -3, -2, -2, 0, 0, -3, 0, 0, 0, 0, -3, 0, 0, 0, -3, -2, 1, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, -1, 0, -1, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, -1, 0, 0, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, -1, 0, -1, 0, -1, 0, -1, -1, -1, 0, -2, -1, -1, 0, 0, -2, -1, -1, 1, 0, 0, 0, -1, 0, -3, -3, 0, 0, 0, -2, 0, 0, 0, -2, 0, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -3, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, 0, -1, 0, -2, 0, 0, 0, 0, -2, 0, 0, -1, -1, -1, -3, 0, 0, -2, 0, -1, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -3, 0, -3, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, 1, 0, 0, 0, 0, -2, 0, 0, -3, 0, 0, 0, 0, 0, -3, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 1, 0, 0, -1, 0, 0, 0, 0, 0, -2, -1, 0, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, -2, -2, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -2, 0, 0, 0, 1, 0, 0, 0, 0, 1, 1, 1, 0, 1, 0, 1, 0, 1, 0, 1, -1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1,
+    0, 0, -3, 0, -3, 0, 1, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 1, 0, 0, 1, -1, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, 1, 0, -3, 0, 0, -3, 0, 0, 0, 0, 0, -4, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, -2, 0, -1, -2, 0, 0, -2, 0, -1, -1, -1, 0, 0, 0, 0, 0, -4, 0, -2, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -3, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, -2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 3, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 2, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, -1, 0, -2, -2, 0, 0, 0, 0, -1, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, -1, 0, 0, 1, 0, 1, 0, 0, -2, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, -2, 0, 0, -1, -1, 0, -1, 0, -1, 0, 0, -2, 0, -2, 0, -1, 0, 0, 0, -1, -1, 0, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, 0, -3, 0, -1, -1, 0, 0, 0, 0, 0, 0, -4, 0, -2, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, -1, 0, -1, 0, 1, 0, 0, 0, 1, 0, 0, 0, -1, 0, 0, 0, 0, 1, 0, 0, 0, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 0, -1, 0, 0, 0, 0, -1, -1, 0, -1, -1, 0, -1, 1, 1, 1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -4, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, -1, 0, -1, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -2, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 2, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, 0, 1, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, -2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, -1, 0, -1, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, -1, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, -1, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t bookerly_14_regularGlyphLookup[368] = {
+    0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0001, 0x0002, 0xFFFF, 0xFFFF, 0xFFFF, 0x0003, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0004, 0xFFFF, 0xFFFF,
+    0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, 0x0010, 0x0011, 0x0012, 0x0013, 0x0014,
+    0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, 0x0020, 0x0021, 0x0022, 0x0023, 0x0024,
+    0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, 0x0030, 0x0031, 0x0032, 0x0033, 0x0034,
+    0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, 0x0040, 0x0041, 0x0042, 0x0043, 0x0044,
+    0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051, 0x0052, 0x0053, 0x0054,
+    0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, 0x0060, 0x0061, 0x0062, 0x0063, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x0072, 0x0073,
+    0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, 0x0080, 0x0081, 0x0082, 0x0083,
+    0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F, 0x0090, 0x0091, 0x0092, 0x0093,
+    0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F, 0x00A0, 0x00A1, 0x00A2, 0x00A3,
+    0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF, 0x00B0, 0x00B1, 0x00B2, 0x00B3,
+    0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF, 0x00C0, 0x00C1, 0x00C2, 0x00C3,
+    0x0241, 0x0242, 0x0243, 0x0244, 0x0245, 0x0246, 0x0247, 0x0248, 0x0249, 0x024A, 0x024B, 0x024C, 0x024D, 0x024E, 0x024F, 0x0250,
+    0x0251, 0x0252, 0x0253, 0x0254, 0x0255, 0x0256, 0x0257, 0x0258, 0x0259, 0x025A, 0x025B, 0x025C, 0x025D, 0x025E, 0x025F, 0x0260,
+    0x0261, 0x0262, 0x0263, 0x0264, 0x0265, 0x0266, 0x0267, 0x0268, 0x0269, 0x026A, 0x026B, 0x026C, 0x026D, 0x026E, 0x026F, 0x0270,
+    0x0271, 0xFFFF, 0x0272, 0x0273, 0x0274, 0x0275, 0x0276, 0x0277, 0x0278, 0x0279, 0x027A, 0x027B, 0x027C, 0xFFFF, 0x027D, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x027E, 0x027F, 0xFFFF, 0xFFFF, 0x0280, 0x0281, 0x0282, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x0283, 0xFFFF, 0xFFFF, 0xFFFF, 0x0284, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0285,
+    0x0286, 0x0287, 0x0288, 0x0289, 0x028A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
 };
 
 static const EpdFontData bookerly_14_regular = {
     bookerly_14_regularBitmaps,
     bookerly_14_regularGlyphs,
     bookerly_14_regularIntervals,
-    64,
+    65,
     38,
     31,
     -8,
     true,
     bookerly_14_regularGroups,
-    11,
+    4,
+    bookerly_14_regularKernLeftClasses,
+    bookerly_14_regularKernRightClasses,
+    bookerly_14_regularKernMatrix,
+    113,
+    nullptr,
+    0,
+    0,
+    bookerly_14_regularGlyphLookup,
+    bookerly_14_regularGlyphGroups,
+    false,
+    nullptr,
 };
@@ -3,2025 +3,2120 @@
  * name: bookerly_16_bold
  * size: 16
  * mode: 2-bit  compressed: true
- * Command used: fontconvert.py bookerly_16_bold 16 ../builtinFonts/source/Bookerly/Bookerly-Bold.ttf --2bit --compress
+ * Command used: fontconvert.py bookerly_16_bold 16 ../builtinFonts/source/Bookerly/Bookerly-Bold.ttf --2bit --compress --frequency-corpus ../../../test/hyphenation_eval/resources/english_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/french_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/german_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/italian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/russian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/spanish_hyphenation_tests.txt
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t bookerly_16_boldBitmaps[32204] = {
-    0xAD, 0x5A, 0xBF, 0x93, 0xDD, 0xD6, 0x75, 0xBE, 0x00, 0xC2, 0xC5, 0x0C, 0x31, 0x63, 0xB8, 0xD0,
-    0x66, 0xC6, 0x64, 0x81, 0x46, 0x45, 0x7E, 0x4C, 0x8C, 0xDA, 0x8D, 0x2E, 0x56, 0x2C, 0x5C, 0xA8,
-    0x20, 0x8B, 0x5D, 0x3B, 0xA1, 0x0A, 0x36, 0x6A, 0x24, 0x26, 0xB3, 0xFF, 0x40, 0x12, 0x40, 0x62,
-    0xE1, 0x22, 0x85, 0xB6, 0x30, 0xAB, 0x14, 0x66, 0x21, 0x4F, 0xCC, 0x65, 0xC1, 0x26, 0x6D, 0x04,
-    0x88, 0x2C, 0x58, 0xB0, 0xE0, 0xB3, 0x38, 0x1E, 0x15, 0x2E, 0x84, 0x88, 0x6B, 0x6B, 0xC6, 0x2E,
-    0xF6, 0x4A, 0x82, 0x44, 0x70, 0x79, 0x81, 0x93, 0xEF, 0x3B, 0x17, 0x6F, 0xB9, 0x14, 0xA9, 0x88,
-    0x9C, 0xF1, 0xF2, 0xBD, 0x4B, 0xFC, 0xB8, 0xB8, 0x38, 0xBF, 0xCF, 0x77, 0xCE, 0x7D, 0xA7, 0xF7,
-    0xE4, 0x17, 0x73, 0x39, 0xB4, 0xB7, 0x24, 0xF3, 0xA5, 0xD3, 0xFF, 0x0A, 0x57, 0x77, 0x73, 0x32,
-    0xE6, 0xBD, 0xED, 0xDA, 0xA8, 0x32, 0xE6, 0x54, 0x25, 0x77, 0xA4, 0xF0, 0xD6, 0xFD, 0xC8, 0x9C,
-    0x6E, 0xAE, 0xDB, 0xDB, 0x53, 0x7D, 0xDB, 0xB7, 0x77, 0x7C, 0x7B, 0xDB, 0xE3, 0xA0, 0xBE, 0xC2,
-    0x8F, 0xC5, 0xE7, 0xDC, 0xF8, 0x93, 0xB8, 0x37, 0xF8, 0x8B, 0xC7, 0x14, 0xFF, 0xCF, 0x89, 0x37,
-    0xC6, 0x56, 0xB3, 0x31, 0x45, 0x57, 0x57, 0x26, 0x73, 0x65, 0x17, 0xDD, 0x98, 0x6F, 0x1E, 0x35,
-    0x82, 0x3F, 0x67, 0x31, 0x78, 0x53, 0x76, 0xB5, 0x31, 0x79, 0x5F, 0x76, 0x26, 0x19, 0xF2, 0xDE,
-    0x44, 0x3E, 0x19, 0xCC, 0xA6, 0xFC, 0x6C, 0xDA, 0x2E, 0x70, 0x7B, 0xCE, 0x38, 0x73, 0xEB, 0xCD,
-    0xAF, 0x77, 0xFF, 0x50, 0xC5, 0x3E, 0x75, 0x58, 0x32, 0x7E, 0xB2, 0xA4, 0xAD, 0x4C, 0x74, 0xE1,
-    0x54, 0x65, 0x96, 0xBF, 0x7F, 0xC7, 0xB7, 0xC0, 0x59, 0xBA, 0x32, 0x26, 0x1A, 0x8C, 0xD9, 0x90,
-    0xDE, 0xE4, 0x22, 0x0D, 0xBE, 0x63, 0xFE, 0xCD, 0x97, 0x92, 0x0E, 0xFF, 0x5A, 0xDE, 0xF2, 0x65,
-    0xD2, 0xB7, 0x6F, 0x74, 0xD7, 0xCA, 0x2F, 0x9D, 0x49, 0xF1, 0x7A, 0x23, 0x52, 0x61, 0x16, 0xD6,
-    0x6B, 0x65, 0x30, 0x31, 0xCF, 0xAC, 0xB8, 0x57, 0xF3, 0xFF, 0xF0, 0xAF, 0x25, 0xBD, 0x14, 0xDD,
-    0x68, 0xEF, 0x0E, 0xAF, 0xE5, 0x5F, 0x4A, 0x7E, 0x7E, 0x00, 0xBD, 0x3E, 0xC5, 0x5A, 0xA6, 0x94,
-    0x03, 0xBC, 0xA9, 0x79, 0xF2, 0x26, 0xF3, 0x3F, 0xF8, 0x96, 0x78, 0x75, 0xB6, 0x32, 0xCF, 0xFC,
-    0xFD, 0x00, 0x73, 0x40, 0x09, 0xE9, 0x6E, 0xA5, 0x33, 0xB6, 0x31, 0xC5, 0x1F, 0x67, 0xC8, 0xC2,
-    0x40, 0xBC, 0x2E, 0x9A, 0x8C, 0xA9, 0xAB, 0xD6, 0xD8, 0xCE, 0xA4, 0x2E, 0x1D, 0xC8, 0x61, 0x8B,
-    0x0B, 0x20, 0x27, 0xC3, 0x69, 0xD1, 0xE9, 0x29, 0x24, 0x62, 0xD2, 0x21, 0x73, 0xAD, 0x79, 0x1B,
-    0x13, 0xE7, 0x7C, 0xD5, 0x4E, 0x20, 0xF4, 0xD6, 0x68, 0x65, 0xC8, 0x20, 0xC6, 0x74, 0xA8, 0xBB,
-    0xB3, 0x07, 0x79, 0xAF, 0xA2, 0x89, 0x7C, 0xBE, 0x2A, 0x40, 0x85, 0x7D, 0x77, 0x32, 0xBA, 0x4A,
-    0xB1, 0x82, 0x54, 0xCD, 0x14, 0x4D, 0x7C, 0x55, 0xD9, 0x15, 0xBC, 0x9B, 0x0E, 0x41, 0x8E, 0x62,
-    0xF2, 0xA1, 0x06, 0x3D, 0x2B, 0xF2, 0x0C, 0x7A, 0x70, 0x05, 0xDF, 0x02, 0xAB, 0x6C, 0x83, 0xF0,
-    0x1F, 0x3E, 0xC5, 0xC6, 0xEE, 0xC8, 0xB1, 0x15, 0x72, 0x48, 0xBD, 0x81, 0xEE, 0x4E, 0x30, 0x5A,
-    0x7D, 0x5D, 0xEE, 0x48, 0x7A, 0xE2, 0xB9, 0xAA, 0x91, 0xAD, 0x89, 0x37, 0x7A, 0x8E, 0x99, 0xFF,
-    0x37, 0x9A, 0x83, 0x50, 0x4B, 0x89, 0xB8, 0x4C, 0x7C, 0x22, 0x53, 0x22, 0x12, 0x4B, 0xDB, 0xED,
-    0x1E, 0x6D, 0x49, 0xEE, 0x23, 0x6F, 0xDA, 0x77, 0x05, 0x56, 0x60, 0xFB, 0xD2, 0x17, 0x5D, 0x3E,
-    0xC6, 0xF2, 0x7B, 0x97, 0x08, 0xA4, 0x8C, 0x1B, 0xAB, 0x58, 0x26, 0x53, 0xE0, 0x23, 0x07, 0xB1,
-    0x1C, 0xDD, 0x14, 0x39, 0x28, 0x69, 0x11, 0x73, 0xD4, 0xCA, 0x58, 0xE2, 0xF5, 0x3B, 0x95, 0xD9,
-    0x31, 0xA7, 0x61, 0x7F, 0x77, 0x69, 0x8E, 0xF5, 0x2F, 0x46, 0x7B, 0x65, 0xF8, 0x49, 0x20, 0x38,
-    0xAF, 0x8C, 0x54, 0x39, 0xD6, 0xE8, 0x52, 0x0F, 0x2A, 0x23, 0x32, 0x0B, 0xF1, 0xC5, 0x73, 0xF8,
-    0x1F, 0xE7, 0xB8, 0x5E, 0xF6, 0xA6, 0x6D, 0x70, 0x29, 0xF3, 0xA6, 0x70, 0xE0, 0x08, 0x8F, 0x24,
-    0x33, 0x6F, 0x60, 0x4E, 0xE9, 0xF0, 0x18, 0x1E, 0x37, 0xD0, 0x9A, 0x34, 0x11, 0x58, 0x00, 0x73,
-    0x55, 0x58, 0x19, 0x37, 0xCA, 0x81, 0x4F, 0xC5, 0x20, 0x02, 0x77, 0xF0, 0x24, 0x2F, 0x39, 0x08,
-    0xC2, 0xE4, 0xA3, 0xC9, 0x46, 0xAE, 0x81, 0x4F, 0xB2, 0xFE, 0x84, 0x53, 0x5C, 0xCF, 0x06, 0xCE,
-    0x29, 0x74, 0x6D, 0xCB, 0xF7, 0x81, 0x90, 0x64, 0xE2, 0x43, 0xB6, 0xA7, 0x51, 0x45, 0x81, 0xFA,
-    0xC4, 0x99, 0x7E, 0x36, 0x1F, 0x5A, 0x63, 0x0F, 0x2B, 0x28, 0xBB, 0x83, 0xA2, 0x77, 0x27, 0x6F,
-    0x3F, 0xDD, 0xCA, 0xEE, 0x3B, 0xB3, 0x07, 0xC9, 0xBE, 0x46, 0xA7, 0xA4, 0x79, 0xA8, 0x65, 0xC1,
-    0x9C, 0xA0, 0x5C, 0x9E, 0x9E, 0xBE, 0x21, 0xFB, 0x35, 0x24, 0x04, 0x29, 0x3D, 0xDA, 0x69, 0x77,
-    0xAA, 0xA7, 0xEF, 0xEA, 0x64, 0xFE, 0xBD, 0x05, 0x96, 0xAC, 0xCB, 0x3C, 0x78, 0x97, 0xCA, 0x76,
-    0x25, 0xAC, 0x24, 0xEF, 0x13, 0xFA, 0xEE, 0xE6, 0xCE, 0xEB, 0x22, 0x9F, 0x8A, 0xD4, 0xE2, 0x37,
-    0x77, 0x2E, 0x6C, 0xEC, 0xB5, 0xF7, 0xE5, 0xFD, 0x99, 0x8E, 0x4F, 0xFD, 0x52, 0xA1, 0x86, 0xC2,
-    0x21, 0x07, 0x64, 0x81, 0x9C, 0x43, 0x84, 0xB4, 0x25, 0x83, 0xB5, 0xC8, 0x0A, 0x19, 0x3D, 0x9E,
-    0x02, 0x01, 0x93, 0xCD, 0x30, 0x05, 0xFE, 0x2A, 0x27, 0xA6, 0x8C, 0xB4, 0x9B, 0x13, 0x53, 0xF0,
-    0xDD, 0x21, 0x6D, 0x1B, 0x33, 0x27, 0xC2, 0x67, 0xA0, 0x6B, 0x87, 0x03, 0xE9, 0x73, 0x18, 0x7C,
-    0xD7, 0xF6, 0x89, 0x5C, 0x81, 0xD6, 0x10, 0x87, 0x4C, 0xEE, 0xDB, 0xDE, 0xD8, 0x6F, 0xB0, 0xA2,
-    0x7C, 0x3A, 0x41, 0x09, 0x35, 0x94, 0x31, 0xD1, 0xBB, 0x1E, 0x2E, 0x97, 0x12, 0x81, 0x7E, 0x74,
-    0x56, 0xFD, 0x85, 0x74, 0xB1, 0x9C, 0x93, 0xA6, 0x80, 0xF7, 0xBE, 0x2B, 0x2B, 0x84, 0x83, 0x99,
-    0x71, 0xA1, 0xC7, 0x4A, 0xB4, 0x50, 0x7D, 0x25, 0x19, 0x59, 0x99, 0x5D, 0x69, 0x4A, 0xDC, 0x64,
-    0x24, 0x10, 0x18, 0x3A, 0xAD, 0x36, 0xA3, 0xD7, 0x80, 0x97, 0xF6, 0x45, 0x4E, 0x8B, 0xF9, 0x02,
-    0xA2, 0x96, 0x03, 0xC5, 0xB7, 0xF1, 0x35, 0xE6, 0x34, 0x18, 0xC1, 0x85, 0x0A, 0x51, 0x63, 0x8A,
-    0xE4, 0x31, 0x7C, 0x75, 0x4C, 0x41, 0x89, 0xB1, 0xA3, 0xED, 0x63, 0x79, 0x6F, 0x32, 0xE5, 0x78,
-    0xAA, 0x4A, 0xE8, 0x1B, 0x35, 0xE4, 0x90, 0x4F, 0x74, 0x11, 0xC8, 0xA9, 0xA5, 0x50, 0x28, 0x6A,
-    0xCA, 0x94, 0x17, 0x84, 0x12, 0x1A, 0xD6, 0x33, 0xF0, 0xC7, 0xD0, 0xF9, 0x80, 0x7E, 0x00, 0x3E,
-    0x30, 0xE1, 0xF2, 0x23, 0xCA, 0x6B, 0x88, 0x19, 0x2B, 0xE5, 0x4F, 0xE2, 0xDA, 0x2E, 0x87, 0x27,
-    0xC5, 0xB2, 0xD5, 0xA9, 0x50, 0xAD, 0xD3, 0x6F, 0x84, 0x75, 0xCF, 0x82, 0x35, 0xC4, 0xD4, 0x4E,
-    0x5D, 0xF8, 0xD5, 0x94, 0x8B, 0xEB, 0xAB, 0xF1, 0xB6, 0x54, 0xC2, 0xEB, 0x53, 0xDC, 0xBD, 0x24,
-    0x7D, 0x0B, 0x09, 0x81, 0xF6, 0x95, 0x86, 0xC4, 0xCD, 0x6D, 0x35, 0x9A, 0xCB, 0x26, 0x10, 0x05,
-    0xA6, 0xE8, 0xE0, 0xA2, 0x01, 0x81, 0xE1, 0x4D, 0x1F, 0xC5, 0x90, 0x3F, 0xC6, 0x50, 0x7E, 0x85,
-    0xA1, 0xBE, 0x4D, 0xC7, 0x00, 0xAF, 0xF1, 0x9C, 0xD0, 0xD3, 0x30, 0xE4, 0xF4, 0x6A, 0x7B, 0x04,
-    0xFB, 0xB4, 0x6B, 0x1E, 0x84, 0x41, 0x5E, 0x1F, 0x36, 0xCF, 0x1F, 0xA2, 0x7D, 0x28, 0x68, 0x67,
-    0xA7, 0x82, 0x45, 0xAF, 0x30, 0x17, 0xF1, 0x4E, 0xA6, 0x58, 0xDF, 0xBB, 0xF0, 0x45, 0xCA, 0x13,
-    0xEA, 0x91, 0x81, 0x19, 0x4B, 0x76, 0x1B, 0x37, 0x19, 0xC3, 0x4A, 0x25, 0x6B, 0x75, 0x52, 0x6C,
-    0x15, 0x64, 0xD9, 0xE1, 0xDB, 0x43, 0x08, 0xCC, 0x3D, 0x4E, 0x6D, 0x80, 0xE2, 0x3B, 0xB5, 0x1D,
-    0xAC, 0x8E, 0xCC, 0xC1, 0x4D, 0xF1, 0xAA, 0x48, 0xA0, 0xB9, 0x1A, 0x17, 0xF2, 0x45, 0x28, 0x8B,
-    0x82, 0xB6, 0xC9, 0xEB, 0x4C, 0xBB, 0x64, 0x0C, 0x93, 0xC1, 0x82, 0x25, 0x30, 0x9A, 0x23, 0x31,
-    0x1A, 0xF8, 0x89, 0xC9, 0x66, 0xBC, 0xAF, 0xFD, 0x58, 0x9A, 0x6C, 0x82, 0x91, 0x4A, 0x27, 0x43,
-    0x3D, 0x72, 0x22, 0xAD, 0xA0, 0xC3, 0x63, 0xD0, 0xE3, 0x26, 0xA4, 0x09, 0x8E, 0xA8, 0xB8, 0xCF,
-    0x25, 0xF8, 0xE9, 0xDC, 0x5E, 0xFD, 0xB9, 0xC0, 0x3F, 0xE5, 0x0D, 0xD0, 0xD3, 0x0D, 0x81, 0xB7,
-    0x3E, 0xF0, 0x47, 0xEB, 0x22, 0x8F, 0xB4, 0xB4, 0xA0, 0x21, 0x58, 0x8B, 0xD0, 0x5B, 0x96, 0x09,
-    0x05, 0x6F, 0xCE, 0x4B, 0x88, 0xE5, 0x93, 0x74, 0x29, 0xB3, 0xAD, 0x0C, 0x51, 0x99, 0xD2, 0xD0,
-    0x2C, 0x4C, 0xFD, 0x75, 0x3D, 0xE6, 0x4A, 0x52, 0x93, 0x7B, 0x78, 0x1E, 0x0E, 0xBA, 0x62, 0xCC,
-    0xD4, 0x1A, 0x83, 0x3D, 0xF4, 0x54, 0x21, 0xA2, 0x11, 0x84, 0x59, 0xFF, 0xAF, 0x0C, 0x39, 0x08,
-    0xBF, 0x05, 0xD6, 0x26, 0xB2, 0xF6, 0x00, 0x2A, 0x44, 0x0C, 0x30, 0x72, 0x5F, 0x56, 0x08, 0xD2,
-    0x58, 0x50, 0x35, 0x02, 0xED, 0xF7, 0x1A, 0x83, 0xD5, 0x65, 0xA1, 0x1B, 0x2E, 0x31, 0xE1, 0xAA,
-    0x38, 0x3A, 0xDB, 0x7B, 0x52, 0x11, 0x32, 0xF0, 0x29, 0x4A, 0x06, 0xF1, 0xF5, 0x01, 0x7C, 0x61,
-    0x86, 0x69, 0xD7, 0x3D, 0x54, 0x39, 0x83, 0x38, 0xD5, 0xAA, 0x87, 0x46, 0xC8, 0x12, 0x75, 0x15,
-    0x6C, 0x1E, 0x27, 0x30, 0xD4, 0xA8, 0x9D, 0x79, 0xA7, 0x49, 0xF8, 0xAA, 0x9C, 0xDA, 0xDC, 0xD4,
-    0x64, 0x0F, 0xDB, 0x42, 0x44, 0x1A, 0x91, 0xB9, 0x4E, 0xFC, 0x9D, 0x79, 0x5D, 0xCE, 0xE3, 0xA2,
-    0x74, 0x6F, 0xF1, 0x4C, 0xAA, 0xD6, 0x59, 0x8F, 0xC5, 0xE4, 0x99, 0x7C, 0xFC, 0xB7, 0x78, 0x7B,
-    0xEE, 0x61, 0x44, 0x6D, 0x63, 0xBB, 0xA2, 0x67, 0x9E, 0x45, 0xE6, 0x1B, 0x97, 0xBB, 0x95, 0x66,
-    0x76, 0x48, 0x3A, 0x02, 0x01, 0x35, 0x3C, 0x54, 0xAA, 0x0C, 0xFA, 0xA7, 0xA4, 0x71, 0x81, 0x57,
-    0xA0, 0x4B, 0x4E, 0x40, 0x46, 0xE7, 0x05, 0x4A, 0xFC, 0x1F, 0xF8, 0xE0, 0xFE, 0xFE, 0xFE, 0x7F,
-    0x81, 0x9F, 0x43, 0x7C, 0xAF, 0x42, 0xBF, 0xCB, 0x72, 0xA7, 0x71, 0x79, 0x89, 0xC6, 0x47, 0x38,
-    0xDC, 0x63, 0x4E, 0x1D, 0x83, 0xC2, 0xD6, 0xCB, 0x44, 0xC7, 0xEB, 0xE2, 0x62, 0x39, 0x82, 0x63,
-    0xC4, 0x8B, 0xD5, 0xF2, 0x7A, 0x66, 0x9D, 0xE4, 0x09, 0xA8, 0xC8, 0xE6, 0x4A, 0x33, 0x28, 0x82,
-    0xA1, 0xF8, 0x1F, 0xFC, 0x0C, 0x2B, 0x50, 0xDB, 0x13, 0x11, 0x11, 0x30, 0x94, 0x39, 0x3B, 0x44,
-    0x2D, 0x98, 0x86, 0xC7, 0xCD, 0xCC, 0xE4, 0x08, 0xCF, 0x19, 0xD6, 0xC7, 0xFB, 0x5E, 0x0D, 0x8F,
-    0x5F, 0xD0, 0xF5, 0xF0, 0x4E, 0x3B, 0xAA, 0x41, 0xBD, 0x15, 0xBC, 0x7A, 0xDE, 0xD3, 0x04, 0x4F,
-    0x0F, 0xA2, 0xC5, 0x53, 0x85, 0x98, 0x38, 0xEF, 0x13, 0x15, 0x95, 0xB3, 0x12, 0xA6, 0x61, 0x08,
-    0x8F, 0x14, 0x83, 0xE6, 0x74, 0xC8, 0x77, 0xE3, 0x11, 0x62, 0x7C, 0x36, 0xD2, 0xF7, 0x0B, 0xA0,
-    0xC4, 0xF2, 0xF1, 0x64, 0xEC, 0xAD, 0xD9, 0xCC, 0x88, 0xEC, 0x92, 0x0F, 0x89, 0x83, 0xB7, 0x7B,
-    0x64, 0x59, 0xE4, 0x96, 0xDC, 0x41, 0x09, 0x7F, 0x0D, 0x3B, 0xBB, 0xE3, 0xD5, 0xC1, 0xA4, 0x40,
-    0x50, 0xBF, 0xE9, 0x92, 0xB1, 0xC6, 0x2D, 0x3C, 0xF9, 0x5B, 0x58, 0x67, 0x03, 0x4D, 0xA5, 0x3E,
-    0x92, 0x6C, 0xBE, 0xE4, 0xF0, 0x34, 0xA3, 0x42, 0x65, 0xFB, 0x4C, 0xEE, 0x02, 0x97, 0xB4, 0xDD,
-    0xC6, 0xB8, 0xF1, 0x9B, 0x60, 0xF5, 0x66, 0x89, 0x88, 0x1A, 0x1F, 0x70, 0x1E, 0x01, 0x36, 0x02,
-    0x8D, 0x45, 0xCC, 0x6C, 0x22, 0x7F, 0x26, 0x2E, 0x61, 0xC2, 0xD0, 0x29, 0xBB, 0xB4, 0x69, 0xC6,
-    0x90, 0x9D, 0x0B, 0x81, 0xFD, 0x57, 0x74, 0x2C, 0xF5, 0x62, 0x1A, 0x0C, 0x83, 0xB2, 0x0F, 0xAA,
-    0xE0, 0x82, 0x9A, 0x1B, 0xAD, 0x42, 0x9C, 0xEC, 0xA1, 0x4E, 0xA0, 0xD5, 0xE2, 0xFE, 0x2D, 0x4E,
-    0x48, 0x7C, 0xA1, 0xB0, 0xA7, 0xE2, 0x84, 0xCC, 0x51, 0x87, 0x80, 0x58, 0x0C, 0x0C, 0x25, 0x82,
-    0x5A, 0xA5, 0x91, 0x19, 0x13, 0xA0, 0x6E, 0x50, 0x96, 0x1F, 0xED, 0xDF, 0x9C, 0x34, 0xDD, 0x21,
-    0xEA, 0x96, 0x2B, 0xBE, 0x4F, 0xC1, 0x30, 0xD0, 0xCD, 0x88, 0xF7, 0x8D, 0xF0, 0x1C, 0xF8, 0xCB,
-    0x3D, 0xCD, 0x36, 0x5E, 0xF1, 0x16, 0xC8, 0x65, 0xDA, 0x81, 0x3C, 0x5B, 0xAE, 0x90, 0x08, 0xE2,
-    0x17, 0x03, 0xA6, 0x7B, 0x7A, 0x40, 0x12, 0x44, 0xCE, 0x4D, 0xE4, 0xD7, 0x40, 0x2A, 0x12, 0x3C,
-    0x8E, 0xF3, 0x6E, 0xC8, 0xC0, 0xBB, 0x1A, 0x67, 0x9F, 0x33, 0x94, 0x18, 0xB6, 0x64, 0x20, 0x78,
-    0x62, 0x64, 0x97, 0x0A, 0xDF, 0x83, 0xB5, 0x55, 0x9D, 0xFA, 0xB5, 0x4A, 0xEF, 0x80, 0x71, 0xCD,
-    0x93, 0x04, 0x4C, 0x3E, 0x38, 0x4B, 0xEF, 0x49, 0x3C, 0x62, 0x46, 0x32, 0xC2, 0x2A, 0xE3, 0x81,
-    0xDE, 0x59, 0xA9, 0x38, 0xEA, 0xE3, 0xA1, 0xFD, 0xD6, 0x40, 0x69, 0xD6, 0xB4, 0x22, 0xEB, 0xD7,
-    0x09, 0xA2, 0x80, 0x12, 0x7E, 0x44, 0x18, 0x3F, 0x05, 0xF9, 0xB4, 0x34, 0xB3, 0x4C, 0xD4, 0x9B,
-    0xB7, 0x17, 0xA4, 0x09, 0xD6, 0x11, 0x3F, 0xC8, 0xFB, 0xA0, 0xCC, 0x93, 0x2B, 0x04, 0x18, 0x70,
-    0x09, 0x57, 0xE8, 0x19, 0xF2, 0xC4, 0x71, 0x64, 0x30, 0xAD, 0x94, 0xC9, 0x4A, 0x39, 0x42, 0x76,
-    0x3D, 0x31, 0xE6, 0xCF, 0x5C, 0x29, 0xC3, 0xFC, 0x41, 0x9F, 0xD5, 0x15, 0x28, 0x2A, 0xC8, 0x0D,
-    0x2B, 0x5F, 0x6D, 0x09, 0x31, 0x49, 0x0C, 0xDF, 0xB8, 0x67, 0x4E, 0x0A, 0x84, 0x57, 0x46, 0xD2,
-    0x31, 0xB6, 0x41, 0x1A, 0x57, 0x6F, 0x70, 0xBD, 0x98, 0x43, 0xA4, 0x6B, 0xEA, 0x62, 0x66, 0x19,
-    0x9A, 0x4D, 0xD5, 0x42, 0x75, 0x3C, 0x84, 0x94, 0x71, 0x72, 0x4A, 0x65, 0xF4, 0xB1, 0xF5, 0x2A,
-    0x57, 0xDF, 0xD4, 0x20, 0xEA, 0x8F, 0x5F, 0x34, 0xF0, 0xE8, 0x1E, 0xA5, 0xC4, 0x83, 0x95, 0x7D,
-    0xF4, 0x0E, 0xC4, 0x55, 0xE5, 0x2B, 0x08, 0x9D, 0x07, 0x59, 0x47, 0xE9, 0xEB, 0x5A, 0xE1, 0xE0,
-    0x4F, 0x1F, 0x32, 0x6C, 0x3B, 0x7D, 0x99, 0x9D, 0xF7, 0xF7, 0x4E, 0xDC, 0x7A, 0xEA, 0x80, 0x70,
-    0x1E, 0xEE, 0x0C, 0x79, 0x23, 0x0C, 0xD3, 0x9F, 0xA1, 0xED, 0xEB, 0xAC, 0x91, 0xC8, 0x78, 0x24,
-    0xA1, 0x9A, 0x81, 0x4D, 0x20, 0x96, 0x45, 0x40, 0x48, 0xB0, 0x58, 0x44, 0x0E, 0x16, 0x08, 0xF4,
-    0x8F, 0x5C, 0xDF, 0xFA, 0x4A, 0x70, 0xBC, 0xE0, 0x30, 0xEA, 0x01, 0x41, 0xD9, 0x88, 0xD2, 0x58,
-    0xE0, 0xAE, 0x70, 0x71, 0x84, 0xF4, 0x5C, 0x46, 0x80, 0x30, 0xE6, 0x15, 0x87, 0x5B, 0x09, 0xB4,
-    0x9E, 0x79, 0x86, 0xB7, 0x12, 0x98, 0x7F, 0xBE, 0x28, 0x5D, 0xAE, 0x7A, 0xCD, 0xD4, 0x06, 0xE2,
-    0x40, 0x0A, 0xF5, 0xDF, 0xAA, 0x5D, 0x7C, 0x05, 0x09, 0xE4, 0x5C, 0x4C, 0xAA, 0x12, 0xE4, 0x2A,
-    0x36, 0xAB, 0x82, 0x4E, 0x35, 0x7B, 0xC3, 0xEC, 0xAC, 0x2E, 0x4E, 0xE2, 0x12, 0x35, 0x0F, 0xBD,
-    0x35, 0xAB, 0x1D, 0x2A, 0x92, 0xE8, 0xD4, 0x7E, 0x82, 0x3F, 0x48, 0xB8, 0xF5, 0x5D, 0x4F, 0x3D,
-    0xBD, 0x20, 0xF3, 0x5E, 0x55, 0xA8, 0x1D, 0x7C, 0x16, 0xC8, 0xB8, 0x47, 0x0D, 0xA8, 0x1F, 0xCE,
-    0xAA, 0x10, 0xA8, 0xAE, 0x79, 0xD9, 0x4F, 0xC1, 0x07, 0xE7, 0x60, 0xF5, 0x5C, 0x13, 0x0B, 0xCE,
-    0x81, 0x80, 0x29, 0xE8, 0x47, 0x49, 0x7A, 0xD9, 0x53, 0x1F, 0x80, 0x1C, 0xC8, 0x66, 0xF4, 0xC1,
-    0x1D, 0x06, 0xC1, 0x16, 0xB5, 0x0B, 0x26, 0x58, 0xCC, 0xFD, 0x31, 0x31, 0x80, 0xF8, 0x5C, 0x26,
-    0xC8, 0xA0, 0xA0, 0x7D, 0xF5, 0xC1, 0x81, 0x02, 0xF7, 0x74, 0x66, 0xA1, 0x0F, 0x63, 0x14, 0x46,
-    0xCE, 0x73, 0x44, 0xEC, 0x72, 0x7E, 0xE4, 0x58, 0xF7, 0x0A, 0xE2, 0x3A, 0x1D, 0xF5, 0xB8, 0xD5,
-    0xEB, 0xBB, 0x8A, 0x9E, 0xCE, 0x6B, 0x80, 0x3B, 0xA7, 0x4F, 0x6D, 0x89, 0xAE, 0xD0, 0xEA, 0x6A,
-    0xA5, 0x2A, 0x2A, 0x67, 0x22, 0x87, 0x9C, 0xE0, 0x30, 0x93, 0x09, 0x1A, 0x28, 0xD5, 0x54, 0xA2,
-    0xBD, 0x36, 0xA0, 0xB3, 0x29, 0x54, 0xD8, 0xCF, 0x73, 0x8D, 0x97, 0x1A, 0xFE, 0x7B, 0xED, 0x47,
-    0x11, 0x87, 0x84, 0xCE, 0x74, 0xF9, 0xDB, 0xCE, 0xA4, 0x58, 0x54, 0x2B, 0x7F, 0x85, 0x73, 0x8C,
-    0xB7, 0x30, 0x73, 0xD4, 0x03, 0xF4, 0x02, 0x0A, 0x4E, 0xBA, 0x94, 0xC9, 0x4E, 0xCD, 0x0D, 0xFA,
-    0x7F, 0x38, 0x1B, 0x16, 0x0F, 0xF9, 0xEF, 0x7D, 0xA2, 0xD8, 0xF5, 0x92, 0x2B, 0xEF, 0x21, 0x28,
-    0x7B, 0xBB, 0x9A, 0x51, 0xD2, 0x65, 0x4E, 0x6E, 0x03, 0x52, 0x9B, 0xF2, 0x23, 0x41, 0x22, 0x40,
-    0x0C, 0x49, 0xA6, 0x0F, 0xD3, 0x89, 0xB1, 0xF1, 0xB1, 0x2B, 0x58, 0xCD, 0x15, 0xA8, 0x5E, 0x91,
-    0x53, 0x3B, 0x0B, 0xDF, 0x69, 0x90, 0x12, 0xE0, 0x97, 0xA8, 0x21, 0x91, 0x1A, 0x01, 0xC3, 0x91,
-    0x1C, 0x71, 0x42, 0x0C, 0x55, 0xA1, 0xF2, 0x63, 0x1D, 0x77, 0xAD, 0xE8, 0x0A, 0x19, 0x18, 0x00,
-    0x23, 0x85, 0x80, 0xEA, 0x8C, 0x15, 0x48, 0x42, 0xE6, 0xC0, 0x65, 0xC0, 0x76, 0xF9, 0x58, 0x6B,
-    0x06, 0xE0, 0x30, 0xD1, 0xC2, 0x49, 0x88, 0xA2, 0x0D, 0x93, 0x3A, 0xEA, 0x47, 0xF2, 0x84, 0x14,
-    0x66, 0x19, 0x4A, 0x71, 0xAB, 0x1D, 0x79, 0xCB, 0x03, 0x4E, 0xE1, 0x96, 0x13, 0xC7, 0x5B, 0xB7,
-    0x10, 0xE3, 0x71, 0x2B, 0x91, 0x8F, 0x79, 0x2B, 0x91, 0xBB, 0xBC, 0x95, 0xCA, 0x21, 0x69, 0x64,
-    0x43, 0x84, 0x75, 0x3F, 0xAD, 0xD1, 0xAB, 0x60, 0x80, 0x20, 0x28, 0x04, 0x54, 0x60, 0x16, 0xB8,
-    0x95, 0xB0, 0x03, 0x1C, 0x30, 0xED, 0x8E, 0x6A, 0x0D, 0x12, 0xD0, 0x07, 0x21, 0xC2, 0xA9, 0x5F,
-    0xAA, 0xDB, 0xD3, 0x38, 0xCA, 0x45, 0xA1, 0x0A, 0x2F, 0x0F, 0x60, 0x7E, 0x08, 0x0F, 0x31, 0x20,
-    0x35, 0x55, 0x3D, 0x20, 0x5D, 0x20, 0x48, 0xD3, 0x6E, 0xAD, 0x57, 0x0C, 0x3B, 0x31, 0x59, 0x14,
-    0xCB, 0xD8, 0x2A, 0x92, 0x7E, 0x32, 0x16, 0x9E, 0x71, 0x03, 0x23, 0x61, 0xFB, 0xC8, 0xC4, 0x61,
-    0x87, 0x52, 0x1D, 0x3B, 0x27, 0x1C, 0x5D, 0x65, 0xC8, 0x45, 0x8A, 0x01, 0x43, 0x93, 0x86, 0x36,
-    0x54, 0x84, 0x04, 0x7F, 0x51, 0xF3, 0xFA, 0x0E, 0xB2, 0x7F, 0xF0, 0x31, 0xF1, 0x65, 0x08, 0xD7,
-    0xAF, 0xE3, 0x94, 0x51, 0xC4, 0xA2, 0x24, 0xEA, 0x48, 0x1B, 0x3D, 0xDC, 0xE3, 0x52, 0xDB, 0x6B,
-    0x32, 0x80, 0x37, 0x62, 0xD6, 0x4D, 0x0D, 0x4A, 0x9E, 0xE1, 0x03, 0x4A, 0x3D, 0xAA, 0x82, 0x8D,
-    0xE5, 0xDA, 0xBB, 0x60, 0x22, 0x23, 0xE7, 0xA1, 0x38, 0x0B, 0x45, 0x13, 0x85, 0xAE, 0xEF, 0x55,
-    0x39, 0x80, 0x94, 0x51, 0xA5, 0xA1, 0x85, 0x22, 0x89, 0x0B, 0x82, 0x88, 0x82, 0x47, 0x2A, 0x62,
-    0xAD, 0x08, 0xD2, 0x51, 0x6C, 0xA8, 0x24, 0x14, 0xC5, 0xCB, 0x4F, 0xB5, 0x30, 0xF9, 0x2D, 0xDD,
-    0xAC, 0x1E, 0x82, 0x10, 0x4A, 0x2D, 0x61, 0xDE, 0xD0, 0x1B, 0x1F, 0xF1, 0xA5, 0xB5, 0x0B, 0xB2,
-    0x60, 0xF1, 0xC1, 0xCA, 0x97, 0xD1, 0x90, 0x60, 0x30, 0x65, 0xFC, 0xFC, 0xFA, 0xAC, 0x84, 0x54,
-    0xD9, 0x68, 0x30, 0xAD, 0xA8, 0x8B, 0xC9, 0xAC, 0x13, 0xB2, 0x49, 0x03, 0x3A, 0xB2, 0x73, 0x15,
-    0x74, 0x35, 0x6B, 0x0A, 0xD6, 0x08, 0x1E, 0x7A, 0x37, 0x51, 0xDB, 0xAF, 0xD3, 0xDC, 0x8E, 0x51,
-    0xD1, 0x1D, 0x28, 0xE6, 0x0B, 0x89, 0xC0, 0xAB, 0x7B, 0xB3, 0x72, 0x06, 0xDD, 0x30, 0x5B, 0x72,
-    0xC3, 0x6C, 0xC9, 0xF0, 0xA9, 0x65, 0x37, 0xEB, 0x0E, 0xEB, 0x98, 0x0C, 0xC0, 0xC4, 0x10, 0xF2,
-    0x5E, 0xA8, 0xA6, 0x83, 0x1C, 0x8D, 0x7C, 0xA2, 0x55, 0x0A, 0x71, 0x3C, 0x0A, 0x0D, 0x8D, 0xC2,
-    0x1C, 0x51, 0x6D, 0xD0, 0x84, 0x59, 0x98, 0xD5, 0x50, 0x0C, 0xD8, 0x95, 0xCE, 0x0A, 0xDE, 0xBE,
-    0xC4, 0x89, 0x8D, 0xC6, 0x44, 0x6F, 0x87, 0x6A, 0x99, 0x55, 0x3F, 0x91, 0x08, 0x55, 0x08, 0xC8,
-    0x59, 0xA2, 0xC0, 0x82, 0x0B, 0xAE, 0xA2, 0xC1, 0xAA, 0x04, 0x89, 0x98, 0xC1, 0x64, 0xA9, 0x12,
-    0x07, 0x09, 0x7C, 0x04, 0x6B, 0xB2, 0x73, 0x36, 0x9F, 0x01, 0xFF, 0xEF, 0xC3, 0x91, 0x3E, 0xC7,
-    0xE5, 0x47, 0x78, 0x0C, 0x26, 0x97, 0x0A, 0xB9, 0x3B, 0x17, 0x4A, 0x16, 0x10, 0x72, 0xF1, 0x97,
-    0x26, 0x24, 0x0C, 0x0D, 0x15, 0x5A, 0x45, 0x8B, 0xBC, 0x7F, 0x74, 0x69, 0xBE, 0x3C, 0xC1, 0x83,
-    0x87, 0x74, 0x60, 0x02, 0x2C, 0xEE, 0xD3, 0x4C, 0xEA, 0xB8, 0x01, 0x0D, 0x1F, 0x2C, 0xE6, 0x10,
-    0x3C, 0x41, 0x0D, 0x22, 0x18, 0xC9, 0xCB, 0x5D, 0xDE, 0x50, 0xC8, 0xA3, 0x16, 0xA4, 0x35, 0x16,
-    0x48, 0x9E, 0x71, 0xF0, 0x10, 0xA2, 0x2B, 0x59, 0x0C, 0x13, 0x49, 0x37, 0x94, 0x05, 0xD3, 0x6A,
-    0x47, 0x49, 0x17, 0x7F, 0xD1, 0x93, 0x9C, 0x68, 0xB4, 0x51, 0xAD, 0xD2, 0x9A, 0x0F, 0x76, 0x25,
-    0xC8, 0x81, 0xA5, 0x96, 0x3A, 0x55, 0x1C, 0xF0, 0xBF, 0x79, 0x67, 0x8F, 0x37, 0x48, 0xDB, 0x1D,
-    0xA5, 0xCD, 0x5B, 0xCD, 0x8D, 0x55, 0xAD, 0xAB, 0x31, 0xE1, 0x20, 0xE8, 0x69, 0x49, 0x60, 0x74,
-    0xB5, 0x9E, 0x35, 0x1B, 0xFB, 0x39, 0xB5, 0x56, 0xAE, 0x98, 0xA0, 0xBD, 0x1F, 0x4F, 0xEC, 0x0B,
-    0x29, 0x10, 0x6E, 0x67, 0x92, 0x28, 0x1E, 0x74, 0xB5, 0x66, 0x97, 0xF3, 0x14, 0x50, 0x31, 0x2A,
-    0xA0, 0x60, 0x54, 0x0A, 0x75, 0xB7, 0x02, 0xC6, 0x4E, 0x85, 0xB6, 0x80, 0xF2, 0x80, 0xD0, 0xD5,
-    0x5C, 0x33, 0x7F, 0x5C, 0x03, 0x31, 0x91, 0xFE, 0x1D, 0x5B, 0x2A, 0x0C, 0x65, 0xA5, 0x63, 0x27,
-    0x14, 0x5C, 0x80, 0x3D, 0x4B, 0x7F, 0xD6, 0xFC, 0xC2, 0xA0, 0x04, 0x47, 0xD4, 0x86, 0x1E, 0xA9,
-    0xF2, 0xDA, 0x99, 0x9B, 0x19, 0xE0, 0x50, 0xFA, 0xC6, 0x9C, 0xE7, 0x48, 0x11, 0xAD, 0x43, 0xE9,
-    0xA4, 0x97, 0xC1, 0x5B, 0x1B, 0x16, 0x17, 0x48, 0x84, 0xEC, 0x46, 0xD5, 0xCE, 0x9E, 0xF7, 0xB9,
-    0x76, 0x18, 0x8A, 0xDB, 0x92, 0xAA, 0xAF, 0xBF, 0xE1, 0xEA, 0xCF, 0xB4, 0x04, 0x78, 0x80, 0x5A,
-    0x9A, 0xE4, 0xE5, 0x1E, 0x71, 0xC4, 0x36, 0xBC, 0xD7, 0x9A, 0xFA, 0x90, 0x2A, 0xAF, 0x99, 0x76,
-    0x9C, 0x16, 0x52, 0xC0, 0x9A, 0xA3, 0x7A, 0xA1, 0xD3, 0xFA, 0x4E, 0xA1, 0x71, 0xAE, 0x5C, 0xE5,
-    0x53, 0xC8, 0x83, 0xDA, 0xE4, 0xA8, 0x4F, 0x36, 0x8D, 0x0B, 0xB5, 0x55, 0xE2, 0x63, 0x41, 0x30,
-    0x60, 0x56, 0x45, 0xF8, 0xEA, 0x58, 0xB6, 0x41, 0xFE, 0xEA, 0xF3, 0x55, 0x68, 0x11, 0x69, 0xA9,
-    0x2F, 0x14, 0xA8, 0xF6, 0xAA, 0x8C, 0x62, 0x00, 0xA3, 0xFD, 0x0D, 0xBE, 0x69, 0x91, 0x67, 0xA3,
-    0x23, 0xE5, 0x59, 0x3E, 0x56, 0x34, 0xEE, 0x48, 0x5B, 0x3E, 0xD0, 0x25, 0x59, 0x04, 0xAF, 0x28,
-    0x59, 0xF8, 0x55, 0x46, 0x82, 0x90, 0x97, 0x0E, 0x60, 0xA6, 0x97, 0x44, 0x20, 0xDD, 0xC7, 0x22,
-    0xEF, 0xC2, 0x09, 0x6B, 0x99, 0x32, 0x42, 0x19, 0x62, 0x0A, 0x2C, 0x94, 0xF2, 0x83, 0x00, 0xD7,
-    0xB0, 0xB9, 0xA2, 0x06, 0xC0, 0xA6, 0x5F, 0x3D, 0x50, 0x9A, 0xA5, 0xCF, 0xB4, 0xD9, 0xC2, 0x7E,
-    0x73, 0xCA, 0x7E, 0x06, 0x41, 0x45, 0xA3, 0xF4, 0x69, 0xBC, 0x0C, 0xCE, 0xA1, 0x84, 0x95, 0xE3,
-    0xF7, 0x8E, 0x21, 0xCF, 0xE4, 0xA2, 0xF4, 0x72, 0xCC, 0xB5, 0x11, 0x48, 0x5B, 0x65, 0xB6, 0x1F,
-    0x8B, 0x47, 0x3B, 0xE2, 0x0A, 0x48, 0xA6, 0x2F, 0x68, 0x94, 0x79, 0x15, 0x1A, 0x53, 0xD3, 0xFA,
-    0x1D, 0x7C, 0x8E, 0xFC, 0x85, 0x88, 0xA8, 0x62, 0x2F, 0xA7, 0x75, 0x79, 0x82, 0x9B, 0x6F, 0xD1,
-    0x92, 0x51, 0xE3, 0x34, 0xD1, 0x84, 0x9B, 0xB1, 0xB7, 0xD3, 0xCE, 0x9B, 0x5E, 0xB7, 0x24, 0xAC,
-    0x2E, 0x1F, 0x9C, 0x82, 0x73, 0x67, 0xFD, 0x67, 0x5E, 0xFA, 0xDF, 0xC4, 0xE7, 0xC0, 0x77, 0x15,
-    0x9A, 0xA4, 0x6C, 0x96, 0x96, 0x2E, 0xF4, 0x67, 0xB2, 0x31, 0x34, 0x53, 0x01, 0x0D, 0x4C, 0xF0,
-    0x93, 0x93, 0x93, 0xFA, 0x27, 0x93, 0xE8, 0x57, 0xC9, 0x74, 0x62, 0x12, 0xFB, 0xA8, 0x34, 0x4F,
-    0x4E, 0x2A, 0x5C, 0xE8, 0xB3, 0x72, 0x52, 0xB4, 0x5D, 0x4B, 0x09, 0x8F, 0xA5, 0x5D, 0x0B, 0xF3,
-    0xFC, 0xCB, 0x1E, 0xF0, 0xF1, 0xBB, 0x6A, 0xB8, 0x5A, 0x5C, 0x53, 0x54, 0xEB, 0x5E, 0xA4, 0x65,
-    0x0F, 0xE0, 0x10, 0x51, 0xE4, 0x01, 0x02, 0xFE, 0x40, 0x61, 0x41, 0xB9, 0x73, 0x32, 0xB2, 0x14,
-    0xC6, 0xD3, 0xC5, 0x0A, 0x18, 0xC7, 0x67, 0x80, 0x56, 0x44, 0x14, 0x9F, 0x29, 0xB0, 0xD0, 0xF4,
-    0x82, 0x3F, 0xBB, 0xB4, 0x44, 0xD8, 0xFC, 0xB8, 0xFE, 0x57, 0xE6, 0xC7, 0x78, 0xA4, 0xEE, 0x50,
-    0x12, 0x8C, 0x91, 0x37, 0x7F, 0xC3, 0xA8, 0x78, 0x9D, 0x86, 0xEB, 0xB5, 0x40, 0x89, 0x51, 0xBF,
-    0xA3, 0xE8, 0x2F, 0x46, 0xBC, 0x5C, 0x9A, 0x0D, 0xBA, 0xAA, 0xD2, 0x70, 0x26, 0xE4, 0x26, 0x40,
-    0x6A, 0x45, 0xE2, 0xD2, 0xD4, 0x7D, 0x3E, 0x66, 0x9C, 0xD3, 0xF6, 0x25, 0x77, 0x64, 0x64, 0xB6,
-    0x88, 0xA3, 0x2B, 0x19, 0x11, 0xD9, 0xB6, 0xD9, 0xFA, 0x62, 0x63, 0x7C, 0x83, 0xBC, 0x84, 0x92,
-    0x3E, 0xD8, 0x9F, 0xC6, 0x16, 0xAD, 0x5F, 0x99, 0x89, 0x43, 0x7B, 0xD1, 0xC8, 0x47, 0x20, 0xC0,
-    0x3E, 0x24, 0x0C, 0x92, 0xD0, 0x69, 0x22, 0x44, 0x24, 0xFE, 0x60, 0xB5, 0x4D, 0xFC, 0xC6, 0xBA,
-    0x51, 0xD3, 0x61, 0xA7, 0x25, 0xB8, 0xD1, 0x8B, 0xF6, 0xF8, 0x62, 0x1A, 0x66, 0x56, 0x74, 0xA6,
-    0x8E, 0x8F, 0xB3, 0x28, 0xD2, 0x5E, 0x1F, 0xA5, 0xB7, 0xC9, 0x3E, 0x50, 0x7C, 0x9D, 0x11, 0x9F,
-    0x69, 0xED, 0x75, 0x39, 0x9C, 0x0B, 0x86, 0x8E, 0xAE, 0xFC, 0x7C, 0x36, 0xF5, 0xD2, 0x39, 0x56,
-    0x64, 0x3F, 0x87, 0x96, 0x6F, 0x4B, 0x74, 0x4F, 0x74, 0xFD, 0xE8, 0x4D, 0x44, 0x5F, 0xC6, 0x81,
-    0x91, 0x2D, 0x3C, 0xED, 0xB1, 0x85, 0xF6, 0x97, 0xF6, 0x2A, 0xEA, 0xE3, 0x21, 0x7E, 0x76, 0xD8,
-    0xD8, 0xC7, 0xD0, 0x2E, 0xDC, 0x20, 0x18, 0x1D, 0x32, 0xAF, 0xC4, 0x6C, 0xF7, 0xC7, 0x94, 0x5D,
-    0x4C, 0xB9, 0x71, 0x58, 0x31, 0xD8, 0xE9, 0xF0, 0xE4, 0x9A, 0x4E, 0x19, 0x38, 0x79, 0xBE, 0x84,
-    0x81, 0x45, 0x71, 0x4E, 0x33, 0x46, 0x4C, 0x86, 0xFF, 0x6E, 0xE2, 0x9F, 0xAA, 0xAC, 0x65, 0x6C,
-    0x03, 0xC8, 0x9A, 0x5B, 0x5F, 0xB8, 0x6C, 0xB2, 0xAB, 0x64, 0x66, 0x4F, 0xA2, 0xFD, 0xC3, 0xCF,
-    0x99, 0xD2, 0xB5, 0xA7, 0x29, 0xBF, 0xDB, 0xD9, 0x66, 0x8C, 0x6A, 0x57, 0x01, 0x9A, 0xD8, 0x79,
-    0xEB, 0x5F, 0xA0, 0x41, 0x44, 0x13, 0x86, 0x5C, 0xF8, 0xB6, 0x76, 0x5D, 0x2F, 0x1F, 0x84, 0xF8,
-    0x94, 0x6B, 0xC7, 0xE3, 0x90, 0x9D, 0xC1, 0xB2, 0x41, 0x48, 0xBA, 0xA6, 0xEA, 0xCA, 0xB5, 0x9D,
-    0xD3, 0x99, 0xD0, 0xC1, 0x14, 0x6E, 0x1F, 0xC9, 0xA4, 0x57, 0x34, 0xB7, 0xBD, 0xF0, 0x41, 0x8D,
-    0xFA, 0xBE, 0x0C, 0xB5, 0x21, 0x28, 0x89, 0xAE, 0x9F, 0xFA, 0x0D, 0x4F, 0x09, 0x73, 0x59, 0x9F,
-    0xFD, 0xE7, 0xFC, 0xCF, 0xE9, 0x04, 0x07, 0xD3, 0xB6, 0x16, 0x87, 0x46, 0x87, 0x74, 0x8E, 0x59,
-    0xDA, 0x1C, 0xCA, 0xB2, 0xDF, 0xA5, 0x1D, 0x52, 0xBF, 0xCD, 0xAD, 0x38, 0x13, 0x9C, 0x53, 0x01,
-    0x58, 0x43, 0x03, 0xD4, 0x42, 0x7C, 0xC8, 0x8F, 0xA0, 0x2E, 0xCB, 0x0D, 0x20, 0x6E, 0xE5, 0x0C,
-    0xE0, 0x1A, 0x49, 0x64, 0xBE, 0x81, 0x1C, 0x28, 0x61, 0x13, 0x00, 0xCF, 0xBC, 0xC3, 0xEA, 0x7B,
-    0x53, 0xE3, 0xDB, 0xA0, 0x98, 0x8C, 0xBB, 0x86, 0x7A, 0x18, 0xB0, 0x82, 0x3D, 0x71, 0xE8, 0xF4,
-    0x30, 0xA2, 0x85, 0x7E, 0x21, 0x93, 0x09, 0xC6, 0x69, 0x83, 0x9D, 0x1E, 0x20, 0xC2, 0x5B, 0x96,
-    0x18, 0xA1, 0xAC, 0xB3, 0x83, 0x79, 0xE1, 0xC3, 0xF6, 0x11, 0x90, 0xAA, 0x15, 0xD7, 0xCA, 0x7D,
-    0x26, 0x51, 0x0F, 0x72, 0x22, 0x2E, 0xC9, 0x30, 0x4A, 0xFB, 0xB9, 0x7E, 0x8C, 0x0F, 0x61, 0xB3,
-    0x4D, 0xCD, 0x3D, 0x11, 0x84, 0xFB, 0xEF, 0xF9, 0xA4, 0x5C, 0xD2, 0xB3, 0x2A, 0x89, 0x2E, 0x28,
-    0xF6, 0x98, 0xF9, 0xC1, 0x41, 0x7C, 0x6D, 0x59, 0x2D, 0xFA, 0x47, 0x23, 0x30, 0x43, 0x28, 0x5F,
-    0x71, 0xE4, 0x8B, 0x7F, 0x8A, 0x91, 0xD4, 0xB7, 0xC8, 0xD5, 0x10, 0x24, 0x7B, 0x14, 0x1B, 0x7B,
-    0x41, 0x84, 0x19, 0x75, 0x9B, 0x85, 0x40, 0x7F, 0xC2, 0xA5, 0x9F, 0xEB, 0xE7, 0x1D, 0x6B, 0x2C,
-    0x67, 0x65, 0x45, 0x47, 0x6D, 0xD8, 0x5C, 0x03, 0x8A, 0xFE, 0x88, 0xDD, 0x21, 0xA7, 0x75, 0xB6,
-    0xAC, 0xCB, 0x5E, 0xF9, 0xD4, 0xAB, 0xBC, 0x09, 0x9A, 0xEC, 0x88, 0x8B, 0xDA, 0x36, 0xEA, 0xDA,
-    0x81, 0x40, 0x16, 0x20, 0x78, 0xAE, 0xB8, 0x7B, 0x80, 0x9A, 0xEF, 0x3C, 0x59, 0xE1, 0xBB, 0x10,
-    0x6D, 0x36, 0x91, 0xDD, 0x32, 0xB6, 0xD7, 0xD8, 0x5E, 0x22, 0x14, 0x19, 0xCC, 0x4B, 0x1C, 0xC6,
-    0x32, 0xD6, 0xAC, 0xD8, 0x7B, 0x73, 0x11, 0xCA, 0xDE, 0xF8, 0x00, 0x3C, 0xDD, 0x61, 0x96, 0x43,
-    0x91, 0xFA, 0x58, 0xF7, 0xE1, 0x42, 0x6B, 0x03, 0x1C, 0xC0, 0x68, 0x6A, 0x54, 0x87, 0xBD, 0x46,
-    0x25, 0xA2, 0xC5, 0x82, 0x9D, 0xFC, 0x94, 0xDD, 0xF9, 0x00, 0xD6, 0x23, 0xB6, 0xF7, 0xE9, 0x6F,
-    0x75, 0x1F, 0x10, 0xFB, 0x0B, 0x4F, 0x28, 0x80, 0xF0, 0xC6, 0x98, 0xFB, 0xAB, 0xAE, 0xE6, 0xF6,
-    0x55, 0xCE, 0x6A, 0xAA, 0x67, 0x28, 0xBB, 0x18, 0xED, 0x43, 0xC0, 0x5F, 0xC0, 0x5F, 0x6A, 0x78,
-    0x77, 0x68, 0xCE, 0x76, 0xA4, 0x44, 0x11, 0x26, 0x81, 0x16, 0x61, 0x32, 0xD6, 0x69, 0x79, 0x98,
-    0xBD, 0xC0, 0x61, 0x0D, 0x77, 0x1B, 0x4B, 0xF2, 0x02, 0xF8, 0xFD, 0x53, 0x2C, 0xBC, 0xB1, 0x5F,
-    0x69, 0x15, 0x9C, 0x2C, 0x5E, 0x39, 0x20, 0x09, 0x70, 0x63, 0x45, 0x6B, 0x46, 0xF9, 0x33, 0x0C,
-    0x69, 0x46, 0xDD, 0xD1, 0x1E, 0xA2, 0x02, 0x9E, 0xC1, 0x7D, 0x8B, 0x2B, 0x19, 0x8B, 0x47, 0xC8,
-    0x89, 0x5B, 0x0C, 0x13, 0x8B, 0x16, 0xD1, 0x8E, 0xAA, 0x36, 0x57, 0x4D, 0x08, 0x2E, 0x6F, 0x43,
-    0x9A, 0x25, 0x50, 0x4B, 0xC7, 0x3A, 0xD5, 0xB1, 0x2F, 0x8B, 0x55, 0x57, 0x2D, 0xFB, 0x06, 0xA5,
-    0x76, 0x46, 0xA7, 0xEF, 0x1A, 0x9E, 0xF4, 0x4D, 0x59, 0x07, 0xB4, 0x6E, 0x69, 0xB2, 0x06, 0x0A,
-    0x69, 0x14, 0x57, 0xAB, 0x67, 0xB7, 0xAB, 0xB4, 0x14, 0xA3, 0xF1, 0x70, 0xD8, 0xDC, 0xD1, 0x2D,
-    0x98, 0xFD, 0x0B, 0x0C, 0x5E, 0xC4, 0xA6, 0xA2, 0x1B, 0x41, 0xBD, 0x46, 0x62, 0xE9, 0xB8, 0xF9,
-    0x01, 0x9C, 0x03, 0xA4, 0xD3, 0xF6, 0x8C, 0xBC, 0x57, 0x10, 0x79, 0x66, 0x24, 0x81, 0xF5, 0x25,
-    0xC4, 0x61, 0x6E, 0x55, 0x22, 0xEE, 0xFE, 0x51, 0xC6, 0x6C, 0x8D, 0x7C, 0x50, 0x9E, 0x7F, 0x82,
-    0x44, 0x51, 0x29, 0x40, 0x62, 0x1D, 0x17, 0xDA, 0xF2, 0xF3, 0x82, 0x99, 0xB2, 0x50, 0x56, 0x0C,
-    0x4C, 0xBD, 0x95, 0xF9, 0xA7, 0xE8, 0x5A, 0x39, 0xE7, 0xC8, 0xEB, 0x96, 0x88, 0xC6, 0xB3, 0x56,
-    0x02, 0x58, 0xFA, 0x61, 0xA4, 0x05, 0xC8, 0xFF, 0xFF, 0x4D, 0xC3, 0x5E, 0x9A, 0x42, 0x6D, 0x73,
-    0xE6, 0x03, 0x55, 0x0D, 0x64, 0x98, 0x4E, 0xA9, 0x2F, 0xFB, 0xD4, 0x41, 0xDF, 0x57, 0x64, 0xF5,
-    0x4A, 0xA6, 0x59, 0x73, 0x26, 0x64, 0xD5, 0xBD, 0x1F, 0x38, 0x36, 0xF2, 0xFB, 0xD7, 0xB0, 0xAE,
-    0x4F, 0xF0, 0xA6, 0x62, 0xDA, 0x1D, 0x59, 0xED, 0xB0, 0xE9, 0xA3, 0xDA, 0xD8, 0xA8, 0x74, 0x93,
-    0x38, 0x0B, 0x3D, 0x2C, 0xBA, 0xE9, 0x6E, 0xD8, 0x27, 0xE5, 0xEF, 0x33, 0xE8, 0x49, 0x2C, 0x2A,
-    0x0B, 0x45, 0xE5, 0xE6, 0x39, 0xA7, 0x14, 0x72, 0x2E, 0x17, 0x2B, 0xAB, 0x1B, 0x4C, 0x83, 0x46,
-    0x4E, 0xE6, 0xC3, 0x53, 0x01, 0x61, 0x9F, 0xE5, 0x9B, 0x12, 0x66, 0x4B, 0xD4, 0x8E, 0x0D, 0x35,
-    0x07, 0x16, 0x5C, 0xFC, 0xE2, 0x87, 0x83, 0x1E, 0xFE, 0xAE, 0x0D, 0x75, 0xF0, 0x81, 0x21, 0x6E,
-    0xE9, 0x43, 0xDA, 0x8B, 0xB6, 0xA3, 0x65, 0x07, 0x01, 0x82, 0x78, 0x4F, 0x71, 0x70, 0x89, 0x80,
-    0x32, 0xAA, 0x0F, 0x35, 0x89, 0xB6, 0xBA, 0xD8, 0x70, 0x61, 0xE1, 0x93, 0xCD, 0x84, 0x6A, 0xB5,
-    0x2B, 0x99, 0xD7, 0x09, 0x84, 0x90, 0x07, 0xC8, 0xF8, 0x3D, 0x02, 0xBA, 0x69, 0x5E, 0x17, 0x39,
-    0xB1, 0x56, 0x06, 0xA1, 0xC4, 0x51, 0xD0, 0x95, 0x4E, 0xDF, 0xDA, 0xA6, 0x62, 0x0F, 0x0B, 0xBE,
-    0x80, 0x97, 0x39, 0xED, 0x30, 0x71, 0x7B, 0x17, 0xF8, 0x91, 0x20, 0x64, 0x88, 0x27, 0x05, 0x1D,
-    0x0D, 0x7F, 0xC5, 0xD0, 0xD4, 0x1E, 0x48, 0x0C, 0xA5, 0xB6, 0xF0, 0x27, 0x36, 0x6D, 0x87, 0x0C,
-    0xEB, 0xB0, 0x5A, 0x71, 0xA9, 0x67, 0xED, 0xFD, 0x99, 0x93, 0x82, 0xF9, 0xD3, 0xE6, 0xDF, 0x90,
-    0x96, 0x87, 0x7D, 0x4B, 0x38, 0xCA, 0xAC, 0xE7, 0x34, 0x7E, 0x5A, 0xA5, 0x68, 0x8C, 0x97, 0x5E,
-    0x87, 0xB6, 0x77, 0x01, 0x2B, 0xA5, 0x79, 0x9A, 0x98, 0x9C, 0xA1, 0xFD, 0x8A, 0x4C, 0x08, 0xC1,
-    0x88, 0xEA, 0x44, 0xFF, 0x1D, 0x7F, 0x37, 0xE2, 0x81, 0x44, 0x23, 0x61, 0x96, 0x2F, 0x03, 0x53,
-    0xAB, 0x75, 0xE8, 0xB5, 0x61, 0x83, 0x98, 0x9D, 0x22, 0x5A, 0x6C, 0x09, 0x23, 0x07, 0xF1, 0x08,
-    0x13, 0x25, 0xD8, 0x38, 0xD0, 0x00, 0xB3, 0x44, 0x97, 0x17, 0x11, 0xAB, 0xFB, 0x4E, 0xB1, 0xBE,
-    0xFF, 0x3C, 0xB1, 0x86, 0x1A, 0xAB, 0x7D, 0x22, 0x56, 0x02, 0x66, 0x45, 0xCA, 0x5A, 0xB4, 0x02,
-    0x1A, 0x76, 0x4B, 0x33, 0x32, 0xFC, 0x02, 0xC0, 0xAE, 0x77, 0x9A, 0x8F, 0x25, 0xAF, 0xE1, 0x84,
-    0x11, 0x63, 0x2C, 0x3A, 0x40, 0xCC, 0x15, 0xE4, 0xA2, 0xBD, 0xAD, 0x7C, 0xD9, 0x12, 0xCE, 0xE4,
-    0x78, 0x37, 0xF6, 0x55, 0x06, 0x62, 0x42, 0xC5, 0x5B, 0xF0, 0x6A, 0xB7, 0xD4, 0x0F, 0xBA, 0xB5,
-    0xB9, 0xFE, 0x61, 0x52, 0xC4, 0x2A, 0x6E, 0x0B, 0x6E, 0xCC, 0x9F, 0xA1, 0x18, 0xDD, 0x07, 0xE2,
-    0xAF, 0x4B, 0x56, 0x2A, 0x47, 0xED, 0xC2, 0x51, 0xE0, 0xBA, 0x5F, 0x1C, 0x2F, 0x3F, 0x35, 0x59,
-    0xAE, 0xD6, 0x0D, 0x34, 0xAD, 0xBF, 0x56, 0x39, 0x7E, 0xAC, 0x38, 0x82, 0x07, 0x54, 0xA8, 0x64,
-    0x4E, 0x5D, 0x30, 0xF6, 0xDE, 0x57, 0x5E, 0xBE, 0x67, 0xD0, 0x64, 0x48, 0x6F, 0x36, 0x7F, 0x0F,
-    0xA5, 0xF2, 0x67, 0x2A, 0x4F, 0x7F, 0xA0, 0x46, 0xC8, 0x18, 0x46, 0xD1, 0x86, 0xBB, 0x34, 0x25,
-    0x0A, 0xBE, 0x5E, 0x9D, 0xB8, 0xFE, 0xCC, 0x83, 0x75, 0x77, 0x86, 0xE8, 0x90, 0xD3, 0x37, 0x17,
-    0x36, 0x11, 0xC0, 0xB6, 0xC4, 0x27, 0x90, 0xC0, 0xE7, 0xBE, 0xFD, 0x95, 0xCC, 0x05, 0x90, 0x43,
-    0xC4, 0x5F, 0xDB, 0xF0, 0xEF, 0xFF, 0x00, 0xD5, 0x5A, 0x3F, 0x90, 0xDE, 0xC6, 0x75, 0x5F, 0x00,
-    0xBC, 0x83, 0x22, 0xC4, 0x03, 0x16, 0xBA, 0x4C, 0xCC, 0x8B, 0x8D, 0x14, 0x2E, 0x12, 0x8F, 0x62,
-    0x34, 0x29, 0x29, 0x2E, 0x48, 0x4F, 0xAC, 0x99, 0xA8, 0xF0, 0x65, 0x86, 0x9F, 0x33, 0xB1, 0x0A,
-    0xB9, 0xC9, 0x8C, 0x86, 0x99, 0x84, 0x2E, 0x55, 0x50, 0x04, 0x68, 0x15, 0x2A, 0x54, 0x90, 0x85,
-    0x95, 0x14, 0x29, 0xAC, 0x99, 0x30, 0x33, 0xE2, 0x31, 0x33, 0x64, 0xA1, 0x42, 0x85, 0x43, 0x80,
-    0xE2, 0x64, 0x58, 0xB8, 0x10, 0x14, 0x46, 0x51, 0xA1, 0x42, 0x70, 0x48, 0xD9, 0x33, 0x52, 0x41,
-    0xD0, 0x04, 0x2D, 0x90, 0x06, 0xF0, 0xF2, 0xFB, 0xBD, 0xC5, 0x77, 0xBA, 0xE3, 0x9F, 0x48, 0x56,
-    0x7C, 0x43, 0xEA, 0xBB, 0xBB, 0x3D, 0x7C, 0xC0, 0x62, 0xF7, 0xBD, 0xB7, 0xEF, 0xFD, 0xDE, 0x9F,
-    0xDD, 0xF5, 0x13, 0xF2, 0x33, 0x49, 0x07, 0x5B, 0x19, 0x63, 0xBC, 0xF3, 0x49, 0x6D, 0xB3, 0x29,
-    0xE8, 0xE3, 0xD6, 0x56, 0x12, 0x0C, 0x49, 0x9B, 0x5F, 0x94, 0x67, 0xC6, 0xB4, 0x2B, 0xAF, 0x48,
-    0x3C, 0xD8, 0xFA, 0xB0, 0x71, 0x1F, 0xBF, 0x45, 0x63, 0xF1, 0x17, 0xDC, 0x73, 0x91, 0x4B, 0x81,
-    0x3F, 0xC9, 0x12, 0x91, 0x21, 0x98, 0x9E, 0xB2, 0xB5, 0xBC, 0xF4, 0xCE, 0x10, 0xB7, 0x4F, 0xC5,
-    0x87, 0xA6, 0xA0, 0xCE, 0x6C, 0xBD, 0xDF, 0x04, 0x63, 0x50, 0x19, 0x5B, 0x1F, 0x33, 0xC1, 0x14,
-    0xE2, 0xA2, 0x39, 0x66, 0x7C, 0xC1, 0x45, 0x32, 0x1C, 0x33, 0x99, 0xC8, 0x7F, 0x0C, 0xA1, 0x88,
-    0x54, 0x78, 0xBD, 0x33, 0xA9, 0xF4, 0xC6, 0xC4, 0x24, 0x6C, 0x30, 0x0F, 0xBC, 0xC8, 0x48, 0xD0,
-    0xEA, 0x84, 0x7F, 0x29, 0x5E, 0x31, 0x98, 0x16, 0xE3, 0x3D, 0x3D, 0x61, 0x1A, 0x7F, 0x32, 0xE1,
-    0xE0, 0x8D, 0x26, 0xEE, 0xBD, 0xDE, 0xC4, 0x1D, 0x5F, 0x60, 0x93, 0x80, 0xD4, 0x95, 0xA3, 0xB7,
-    0xBE, 0x67, 0x62, 0x4C, 0xC4, 0x66, 0x02, 0xE5, 0x4A, 0x7E, 0xC3, 0xA6, 0x26, 0x13, 0xD5, 0xB2,
-    0x29, 0x0B, 0x63, 0xD6, 0x64, 0xF1, 0xBD, 0x9F, 0x5A, 0x74, 0x1E, 0xB4, 0x49, 0xEE, 0x80, 0xB6,
-    0xB0, 0x30, 0x6B, 0xD9, 0x63, 0x90, 0x58, 0x36, 0xAC, 0x9E, 0x4E, 0x9E, 0x1E, 0x65, 0x92, 0x00,
-    0x0F, 0x9B, 0x40, 0xCE, 0x61, 0xC2, 0x36, 0xEA, 0x8C, 0x2D, 0xE2, 0xC6, 0x8C, 0xC6, 0x56, 0x41,
-    0x67, 0x26, 0xDC, 0x0A, 0x7A, 0x4C, 0x60, 0x2B, 0x0F, 0xBD, 0x8A, 0x14, 0xCD, 0xC5, 0x29, 0x1F,
-    0xED, 0x45, 0x4C, 0xB9, 0xDF, 0x23, 0x07, 0x6B, 0x8B, 0x8D, 0x95, 0xC5, 0x5F, 0x89, 0xD4, 0xB9,
-    0x5C, 0x12, 0xF1, 0x64, 0xF2, 0xA4, 0xC6, 0xEC, 0xBE, 0x14, 0xC1, 0x60, 0x02, 0x31, 0x49, 0x63,
-    0xA2, 0xC9, 0x08, 0x78, 0x18, 0x30, 0x92, 0x49, 0xBA, 0xB4, 0x22, 0xD9, 0x23, 0xD9, 0x7E, 0x5F,
-    0x1A, 0xCA, 0x5C, 0x32, 0xB3, 0x90, 0x11, 0x6B, 0xC4, 0x57, 0x95, 0x3B, 0x88, 0x57, 0xD9, 0x3B,
-    0x52, 0xDE, 0x39, 0x8D, 0x39, 0x84, 0x1C, 0x61, 0x2C, 0x4A, 0x82, 0xF2, 0x5B, 0x05, 0x29, 0x46,
-    0x57, 0x0B, 0xAF, 0x08, 0xEF, 0xD8, 0xB7, 0x6F, 0x0E, 0xB2, 0xD5, 0x2C, 0xDC, 0x6A, 0xAF, 0xFE,
-    0xCB, 0xB6, 0x7B, 0x02, 0x45, 0xF1, 0x4E, 0xA3, 0xFF, 0x84, 0x89, 0x47, 0xBF, 0x8F, 0x87, 0xA4,
-    0x8A, 0x1B, 0xD0, 0x17, 0x92, 0x14, 0xCC, 0x75, 0x41, 0x32, 0xFF, 0xA6, 0xD4, 0xD1, 0x5B, 0xD2,
-    0x24, 0x07, 0xA5, 0xB1, 0x59, 0xDE, 0x94, 0x45, 0x5A, 0x49, 0x93, 0x16, 0xD2, 0x1D, 0x30, 0x65,
-    0x3F, 0x18, 0xFB, 0xEB, 0xC6, 0x24, 0x72, 0xC2, 0xC4, 0xA3, 0x35, 0xF1, 0xAF, 0xF0, 0xFD, 0x95,
-    0xC1, 0x1F, 0xB0, 0xE2, 0x15, 0x17, 0x1C, 0x5C, 0x2A, 0x81, 0x0D, 0xEE, 0xDA, 0x9B, 0x50, 0xBB,
-    0xFC, 0xC4, 0xE4, 0x99, 0x3D, 0x66, 0xF9, 0x49, 0xE4, 0x1A, 0xD7, 0xE5, 0xA3, 0x12, 0x3C, 0x72,
-    0x3A, 0x55, 0x85, 0xA0, 0x31, 0x10, 0x8A, 0x39, 0x60, 0x8E, 0x61, 0x82, 0xA0, 0x7A, 0x0A, 0x6A,
-    0x60, 0xDE, 0x4C, 0xCC, 0x14, 0x55, 0x71, 0x94, 0x5D, 0xF0, 0x5A, 0xFF, 0x4A, 0x65, 0xCD, 0x5E,
-    0xF3, 0x42, 0x4B, 0x95, 0xF9, 0xFA, 0xFE, 0x10, 0xCB, 0x1D, 0xBE, 0xED, 0xE1, 0x45, 0xEF, 0x6A,
-    0x95, 0x43, 0x75, 0x5E, 0x78, 0x23, 0xC6, 0xAD, 0x3F, 0xFB, 0xBA, 0x2F, 0xFF, 0x58, 0xC7, 0x41,
-    0x65, 0xA5, 0x0D, 0xAB, 0x37, 0x7D, 0xE9, 0x82, 0x3A, 0xCE, 0x3C, 0xAA, 0x7B, 0xA7, 0x4A, 0x9F,
-    0x14, 0x86, 0xAF, 0xCA, 0xAB, 0x47, 0xB1, 0x6E, 0xA1, 0x4A, 0xCF, 0xAC, 0xFC, 0x2B, 0xA9, 0x5A,
-    0x40, 0xE9, 0x5A, 0x7F, 0x9A, 0x0C, 0xC4, 0xB1, 0x02, 0x63, 0xF8, 0x83, 0xC1, 0x94, 0x62, 0xA6,
-    0xE7, 0xAA, 0xE3, 0x41, 0x1B, 0xBF, 0x35, 0xBD, 0x24, 0xD2, 0xDA, 0x2B, 0x8D, 0x32, 0xB0, 0x02,
-    0x45, 0xA9, 0xF1, 0x7D, 0x6D, 0x81, 0x89, 0x7F, 0xCF, 0xAC, 0x9A, 0xB0, 0x0B, 0x7A, 0x1F, 0x4B,
-    0x6E, 0xCA, 0x2A, 0xAF, 0x6D, 0x9B, 0x76, 0xF1, 0xC8, 0xA5, 0x2E, 0xCA, 0x4A, 0x2F, 0x78, 0x07,
-    0x4B, 0x57, 0xD6, 0xDA, 0x27, 0xEC, 0xC2, 0xC1, 0x3C, 0x8E, 0x1F, 0x5D, 0x4A, 0x91, 0xEB, 0xF8,
-    0x2B, 0x75, 0x91, 0xA9, 0x16, 0x50, 0x39, 0x28, 0x9E, 0x0A, 0xC6, 0x3F, 0xBD, 0xB6, 0x38, 0x24,
-    0xF2, 0x81, 0x48, 0x2E, 0x03, 0xB4, 0xCB, 0x78, 0x5C, 0xCE, 0x12, 0x34, 0xC7, 0xA7, 0xA2, 0x1A,
-    0x0C, 0x05, 0x55, 0xB4, 0xEF, 0x4C, 0x50, 0xBD, 0x90, 0x5F, 0x08, 0x0F, 0x55, 0xC7, 0x8E, 0xC5,
-    0xB1, 0x77, 0xA3, 0x7D, 0x72, 0x7F, 0xF8, 0x41, 0x76, 0xBE, 0x49, 0x3A, 0xFF, 0x52, 0xF5, 0x62,
-    0x1B, 0x45, 0xDE, 0xCD, 0x76, 0xFF, 0xD7, 0x92, 0xAB, 0x37, 0x9A, 0xFD, 0x6B, 0x07, 0xBF, 0x6B,
-    0xF6, 0x1B, 0xF3, 0x86, 0x79, 0xD1, 0x24, 0x99, 0x33, 0xB5, 0xD5, 0xD7, 0x8D, 0xF9, 0xE6, 0xE6,
-    0x19, 0x2B, 0x53, 0x2E, 0xD3, 0xDA, 0xE2, 0xB0, 0x39, 0x7A, 0x8A, 0x72, 0x07, 0x6B, 0xE5, 0x3F,
-    0x8D, 0xB6, 0xB0, 0x27, 0xAB, 0xF8, 0x2A, 0x58, 0x9B, 0xCC, 0x98, 0xFE, 0x82, 0xD6, 0x91, 0xE5,
-    0x92, 0x79, 0x67, 0x20, 0x00, 0xF0, 0x5D, 0x82, 0x40, 0x88, 0x3F, 0x82, 0x34, 0xA9, 0xC8, 0xA5,
-    0x79, 0xFC, 0xEC, 0xB4, 0x09, 0x4D, 0x9C, 0xC0, 0xCE, 0xED, 0x45, 0xB9, 0xC8, 0x76, 0x3E, 0xD5,
-    0xCE, 0xDE, 0xC6, 0xBD, 0x4C, 0xBB, 0x4F, 0xDE, 0x63, 0xD6, 0x4A, 0xAE, 0xF7, 0xF6, 0xA2, 0xC4,
-    0xB5, 0xAD, 0x5E, 0x83, 0xB5, 0x60, 0x41, 0x61, 0xEE, 0xEE, 0x17, 0x26, 0x9F, 0xDC, 0x5A, 0x40,
-    0xC3, 0xAE, 0xC0, 0x74, 0x8F, 0x6C, 0xD2, 0x16, 0x7C, 0xA8, 0x27, 0x0C, 0xFA, 0xBD, 0xF1, 0x80,
-    0x37, 0x3E, 0x86, 0xD1, 0xA3, 0xCE, 0xA3, 0x84, 0x7B, 0xEF, 0xEC, 0x48, 0xF1, 0x79, 0xC0, 0x8E,
-    0xF1, 0x9B, 0xB4, 0xF8, 0x26, 0x25, 0xB6, 0x18, 0xCF, 0xC4, 0x99, 0x84, 0x83, 0x7D, 0x67, 0x8C,
-    0xEA, 0xAF, 0xF0, 0xFB, 0xF3, 0x66, 0xA5, 0xF0, 0x04, 0x4B, 0x64, 0x52, 0xCC, 0x5E, 0xC1, 0x50,
-    0x61, 0x53, 0xBA, 0x52, 0xBE, 0x64, 0x9F, 0x79, 0x99, 0xE0, 0xB2, 0xF7, 0x78, 0x59, 0x59, 0x5C,
-    0x4E, 0x91, 0x34, 0xBE, 0xC8, 0xA8, 0x10, 0x73, 0x92, 0x08, 0xD0, 0xE4, 0xAD, 0xFD, 0xF9, 0x86,
-    0x39, 0x1C, 0x28, 0x93, 0x8A, 0x4F, 0xCE, 0x72, 0xE7, 0xCB, 0x6C, 0x79, 0xE9, 0x6F, 0x38, 0x23,
-    0x05, 0x67, 0x18, 0x41, 0x6A, 0x0C, 0x30, 0x42, 0x46, 0x09, 0x40, 0x66, 0x38, 0x0E, 0xB1, 0xDC,
-    0xE8, 0xA1, 0xA8, 0x97, 0xC1, 0x2C, 0x6E, 0x41, 0x13, 0x8E, 0x7B, 0x5B, 0xB7, 0x62, 0xDE, 0x4A,
-    0xD8, 0x2B, 0xC5, 0x2D, 0x93, 0x7E, 0x70, 0xB9, 0x31, 0x7B, 0x2C, 0x74, 0xDC, 0xE0, 0x96, 0x09,
-    0x6E, 0x50, 0x9F, 0x2E, 0x53, 0xA1, 0x1E, 0x74, 0xEB, 0xD8, 0x8C, 0xFB, 0x31, 0xED, 0xE0, 0x1B,
-    0xA0, 0xE1, 0x14, 0x04, 0x7C, 0x72, 0x4A, 0xDB, 0x35, 0xB3, 0xE2, 0xC9, 0xCB, 0xE2, 0x8D, 0x61,
-    0x6B, 0x9F, 0xEE, 0x54, 0x57, 0xBD, 0x37, 0xBC, 0xB2, 0x4D, 0xA5, 0xCA, 0x27, 0x2A, 0x2A, 0xF4,
-    0x14, 0x6A, 0xBA, 0xE3, 0xF2, 0xA8, 0xC0, 0x48, 0xFE, 0x72, 0xF3, 0x75, 0xF3, 0x37, 0x99, 0x07,
-    0x2C, 0xC2, 0x7A, 0x8E, 0x61, 0x9F, 0x9B, 0x32, 0xA9, 0x92, 0x9F, 0xB5, 0xE1, 0x8D, 0xC1, 0x1B,
-    0xF2, 0xEC, 0x42, 0x7C, 0xAB, 0xC4, 0x93, 0x6C, 0xC6, 0x08, 0xB3, 0xC2, 0x6E, 0xA5, 0x34, 0x2B,
-    0x30, 0xA5, 0x3F, 0x34, 0x5F, 0x55, 0x4B, 0x02, 0xCA, 0xA6, 0xAD, 0x5A, 0x4F, 0x00, 0xA5, 0x83,
-    0xA0, 0x21, 0x75, 0x1A, 0x16, 0x2F, 0x02, 0x81, 0xE8, 0xF9, 0x28, 0x6D, 0x92, 0x56, 0x3B, 0xF3,
-    0xAD, 0x9D, 0x9F, 0x10, 0x92, 0xF5, 0xC0, 0x10, 0x60, 0xD7, 0xAC, 0x53, 0xEB, 0x46, 0x5A, 0x0D,
-    0xD1, 0x93, 0xD8, 0x43, 0xBC, 0x04, 0x5A, 0x3E, 0x37, 0xDB, 0x99, 0x42, 0x31, 0x51, 0x75, 0x72,
-    0xB6, 0xC7, 0x9B, 0xA1, 0x8A, 0xA4, 0x31, 0xC0, 0xFD, 0x7D, 0xEC, 0x00, 0x98, 0x01, 0x66, 0xA2,
-    0x03, 0x34, 0xA5, 0x65, 0x87, 0x12, 0xBE, 0xCE, 0x1C, 0xBD, 0x0D, 0x77, 0x19, 0xD3, 0x5A, 0xEA,
-    0xB4, 0x88, 0x3F, 0xA8, 0x72, 0xE9, 0x00, 0xA4, 0x57, 0xDC, 0xBB, 0x51, 0x43, 0x30, 0x0E, 0x5B,
-    0x88, 0x8F, 0x8B, 0xDD, 0x07, 0xB7, 0x9E, 0xFB, 0x2F, 0xDA, 0x80, 0x3A, 0x0F, 0x0E, 0x84, 0x45,
-    0x6E, 0x94, 0xA2, 0x45, 0xBE, 0xA1, 0x14, 0xA9, 0x2F, 0xA4, 0x0F, 0xE7, 0x82, 0x24, 0xF4, 0x61,
-    0xF4, 0xD5, 0xAD, 0x79, 0xE0, 0xE7, 0x6B, 0xC6, 0xB1, 0x49, 0xDC, 0x23, 0x9B, 0x61, 0xE7, 0xD8,
-    0x24, 0xDB, 0x64, 0x93, 0x6C, 0x2B, 0x9B, 0x62, 0x1C, 0x9B, 0xB9, 0x71, 0x6C, 0x92, 0x6D, 0x36,
-    0xCA, 0x36, 0xD8, 0x8C, 0xEB, 0xF5, 0x9E, 0x1D, 0x40, 0x2B, 0xDC, 0x0E, 0x96, 0xB4, 0xB3, 0x58,
-    0x3E, 0x5B, 0x00, 0xD1, 0x1B, 0x29, 0xC0, 0xE6, 0x10, 0xB6, 0xB8, 0x92, 0xFA, 0x82, 0xF9, 0x69,
-    0xD4, 0x81, 0xCD, 0xDC, 0x4D, 0xC2, 0x31, 0x82, 0xD1, 0xA8, 0xFC, 0xF4, 0x3F, 0x45, 0xC6, 0xFF,
-    0xB0, 0x7A, 0xFD, 0x0F, 0xF9, 0x85, 0xEC, 0x87, 0xCE, 0x21, 0xA3, 0x01, 0x50, 0xE4, 0xBC, 0x14,
-    0x28, 0xB2, 0xB4, 0xFD, 0x3C, 0x73, 0xAC, 0x04, 0xD5, 0x83, 0xD9, 0x34, 0xE7, 0xC1, 0x46, 0x79,
-    0x0A, 0xA3, 0xD7, 0x8C, 0x0D, 0x0A, 0x05, 0x12, 0x7B, 0x7D, 0x70, 0xD3, 0xB7, 0x69, 0xAD, 0x20,
-    0xF3, 0x47, 0xBC, 0x3B, 0x2A, 0x92, 0x14, 0x8A, 0x38, 0x26, 0xD7, 0xF5, 0xE3, 0x44, 0x19, 0x99,
-    0x06, 0x5C, 0x8C, 0x24, 0xF4, 0x79, 0x90, 0xDB, 0x50, 0xC7, 0x2A, 0xCA, 0x22, 0x37, 0x11, 0x07,
-    0x6A, 0xE2, 0x1A, 0x96, 0xBC, 0x76, 0x6E, 0xE0, 0x4A, 0x43, 0xC7, 0xC4, 0xD8, 0x0C, 0x2B, 0x6A,
-    0xA5, 0x88, 0xDA, 0xA0, 0x1B, 0xE0, 0x1B, 0x30, 0xF6, 0x05, 0x0D, 0x56, 0x6C, 0x91, 0x54, 0x6E,
-    0x69, 0xDD, 0x92, 0x72, 0x10, 0x5D, 0xCA, 0x14, 0xDA, 0x3A, 0x83, 0xB8, 0xB7, 0x18, 0x1D, 0x40,
-    0xEA, 0x9A, 0x26, 0x8D, 0x0B, 0x76, 0x48, 0xA1, 0x22, 0x67, 0x98, 0xED, 0x64, 0x70, 0xB5, 0x51,
-    0xC7, 0x0E, 0x95, 0x02, 0x11, 0x2E, 0xC2, 0x99, 0x1F, 0x40, 0x4F, 0x9D, 0x7A, 0x82, 0xCA, 0x44,
-    0xAA, 0x48, 0x06, 0x00, 0x44, 0x61, 0x47, 0x13, 0xBA, 0xE5, 0xA4, 0xA2, 0xDA, 0xCC, 0xF8, 0xA3,
-    0xD9, 0x1B, 0x4F, 0xE7, 0x8A, 0x52, 0x9F, 0x57, 0x21, 0x7C, 0xF0, 0xEA, 0x6D, 0xBC, 0x7F, 0xCA,
-    0xB9, 0xDB, 0x42, 0x03, 0x3E, 0xC5, 0x1B, 0xF5, 0xEF, 0x74, 0x22, 0x83, 0x43, 0x5D, 0x27, 0xF7,
-    0x27, 0xB6, 0x53, 0xE3, 0xBE, 0xA4, 0xEA, 0xE9, 0x42, 0xC5, 0x2B, 0x23, 0x9D, 0x73, 0xDB, 0x85,
-    0xE2, 0x96, 0xBE, 0x4A, 0x4D, 0xC1, 0x42, 0x7F, 0xA2, 0x1D, 0x26, 0x85, 0xB1, 0xE4, 0x2D, 0x51,
-    0xA3, 0x4B, 0xD8, 0x21, 0xCF, 0xD8, 0x21, 0x6A, 0xD5, 0xCE, 0x21, 0x22, 0xFA, 0x81, 0x3B, 0x67,
-    0x41, 0x03, 0xC1, 0x7F, 0xD0, 0x90, 0x85, 0xBC, 0xDE, 0xD9, 0x3C, 0x47, 0x9D, 0x00, 0x41, 0xAD,
-    0xC1, 0x4A, 0x62, 0x3E, 0x2A, 0x96, 0x85, 0x33, 0xED, 0x31, 0x5F, 0x0F, 0x60, 0x88, 0x44, 0xDE,
-    0x86, 0x58, 0x4B, 0x9D, 0xD6, 0x57, 0x72, 0x3C, 0x47, 0x3C, 0xC3, 0x07, 0x0C, 0x34, 0x38, 0xDA,
-    0xC8, 0x9D, 0xAF, 0x38, 0xBF, 0x2D, 0xD2, 0x78, 0xC4, 0xF9, 0xF1, 0xCF, 0x3B, 0x72, 0x94, 0x91,
-    0x54, 0x59, 0x88, 0x3E, 0xA1, 0x12, 0xFB, 0x23, 0x8D, 0x1A, 0x93, 0x5A, 0x67, 0xE3, 0xC5, 0x97,
-    0x64, 0x7D, 0xF4, 0x13, 0xB5, 0x4F, 0x2A, 0x1D, 0x1A, 0x2C, 0xA9, 0x99, 0x9B, 0xE0, 0x7F, 0x94,
-    0x9C, 0x27, 0xA3, 0xEE, 0x5E, 0xF3, 0x7E, 0x84, 0xF9, 0xD9, 0xF0, 0xB8, 0x24, 0x48, 0xA0, 0x34,
-    0xDC, 0x4E, 0x49, 0x95, 0xBC, 0xC5, 0x65, 0x0A, 0xFB, 0xF8, 0x5E, 0x60, 0xD6, 0xCE, 0xD0, 0x41,
-    0x67, 0x59, 0xFA, 0x3C, 0xD6, 0x35, 0xF5, 0x98, 0x04, 0x91, 0x05, 0x17, 0xBC, 0x2B, 0x4A, 0x95,
-    0xDA, 0x21, 0xBE, 0x2A, 0xAA, 0xCF, 0x29, 0x3B, 0x20, 0xF2, 0xA9, 0x88, 0xE2, 0x31, 0x3B, 0x94,
-    0xA6, 0x6C, 0x08, 0xA8, 0x94, 0x88, 0x2F, 0x9B, 0x65, 0xC7, 0xF7, 0xC9, 0x42, 0xE8, 0xF8, 0x91,
-    0xCD, 0x4D, 0x30, 0x8C, 0xA8, 0x28, 0x12, 0x9A, 0x3F, 0xE7, 0x03, 0xA2, 0x05, 0x4C, 0x4C, 0x10,
-    0xD3, 0xC8, 0x2B, 0x8E, 0x05, 0x51, 0x7E, 0xAA, 0x65, 0xE0, 0xE5, 0x39, 0x4D, 0xCB, 0x4B, 0xA5,
-    0xED, 0xA2, 0x52, 0xD5, 0xAB, 0xEB, 0x8F, 0x2B, 0x15, 0x79, 0x59, 0xBA, 0xF8, 0x4C, 0x61, 0x61,
-    0x65, 0xE3, 0x91, 0x67, 0x0B, 0xAD, 0xBE, 0xC6, 0x45, 0x16, 0x51, 0x23, 0xD2, 0xD1, 0xE8, 0x28,
-    0xFE, 0xFB, 0x1C, 0x49, 0x11, 0x8C, 0xA0, 0xFA, 0xF1, 0x93, 0x41, 0x93, 0x5B, 0x7B, 0x59, 0x34,
-    0xF2, 0x4E, 0xDF, 0x71, 0x4C, 0xC6, 0xAD, 0x63, 0x29, 0xEA, 0x92, 0x81, 0x0C, 0x07, 0x4C, 0x5E,
-    0x39, 0xE2, 0xE8, 0xE9, 0x88, 0x9E, 0xC2, 0x3B, 0xBA, 0xCA, 0x47, 0xE7, 0x54, 0x11, 0x73, 0x37,
-    0xD1, 0x4C, 0x36, 0x06, 0xFA, 0x70, 0x01, 0x5D, 0x3A, 0x40, 0x2F, 0x0C, 0x45, 0x44, 0x00, 0xD0,
-    0x51, 0xAB, 0xE2, 0x36, 0x24, 0x9A, 0xBF, 0xFB, 0x77, 0x03, 0xC2, 0x42, 0x04, 0x76, 0x32, 0xC5,
-    0x1A, 0xD3, 0x09, 0x43, 0xA4, 0x83, 0x33, 0x91, 0xCC, 0x3B, 0x80, 0xD7, 0xD7, 0x48, 0x35, 0xC3,
-    0x25, 0xA4, 0xDB, 0x72, 0x6D, 0x1D, 0x6F, 0x80, 0x0A, 0x84, 0x3C, 0x41, 0x0F, 0xF9, 0xF9, 0x9D,
-    0x85, 0x8C, 0x32, 0x55, 0xF8, 0x7C, 0xAB, 0x29, 0xEF, 0x6A, 0x3A, 0x17, 0x41, 0x83, 0x2A, 0x75,
-    0xCB, 0xA2, 0xD6, 0xD3, 0x98, 0xAF, 0x52, 0x3E, 0xA3, 0xB3, 0x00, 0x04, 0xDB, 0x3D, 0xE5, 0x05,
-    0x0D, 0x58, 0x3B, 0xAC, 0x81, 0x97, 0xF3, 0x91, 0x68, 0xF8, 0x76, 0xA8, 0xCD, 0x1C, 0xF7, 0xB8,
-    0xA4, 0xD9, 0xFC, 0x29, 0xFE, 0x1E, 0x53, 0x5E, 0xB3, 0x65, 0x5F, 0x3B, 0x2E, 0xC1, 0xD6, 0xD3,
-    0x2E, 0xDE, 0x76, 0x03, 0xC0, 0x14, 0xD2, 0x93, 0xB7, 0xBE, 0x74, 0xCC, 0xBC, 0x7A, 0x16, 0x0D,
-    0xF2, 0x00, 0x34, 0x5E, 0xCF, 0x80, 0xB7, 0xD5, 0xA8, 0x77, 0x6E, 0x8A, 0x35, 0x5D, 0xB7, 0x6C,
-    0xAB, 0xE1, 0xBD, 0xAD, 0xA7, 0x73, 0xA3, 0xAF, 0x2D, 0x47, 0x79, 0xF5, 0x59, 0xE6, 0x98, 0x32,
-    0x6C, 0x4D, 0x44, 0xA2, 0x7F, 0x40, 0xED, 0xD4, 0xAA, 0x00, 0x05, 0x50, 0xF6, 0x7C, 0xAF, 0x31,
-    0x2E, 0x00, 0xF1, 0xB2, 0x87, 0x4E, 0xDF, 0x3F, 0xA8, 0xA5, 0x14, 0xC4, 0x36, 0x48, 0x37, 0xFE,
-    0x18, 0xF4, 0xD9, 0x13, 0x9A, 0xA0, 0x1C, 0x67, 0xC4, 0xFD, 0xC4, 0x43, 0xA6, 0xEF, 0x09, 0x03,
-    0xA5, 0x97, 0x6F, 0x23, 0x5D, 0x82, 0x66, 0xBA, 0xC6, 0x88, 0x3F, 0xDE, 0x8D, 0x6D, 0x0F, 0x81,
-    0xB4, 0xC7, 0x54, 0xEF, 0xA0, 0xF8, 0xD0, 0x39, 0xB8, 0x02, 0xAF, 0xAC, 0xB6, 0x96, 0xB3, 0x64,
-    0x92, 0x39, 0x96, 0x82, 0x11, 0x8A, 0xDF, 0xF6, 0x37, 0xE1, 0x8B, 0x7C, 0x9D, 0x9A, 0xE3, 0xF7,
-    0x34, 0xDA, 0x12, 0xF3, 0xB7, 0xC8, 0xD2, 0xB6, 0xB4, 0xE5, 0x77, 0x33, 0xFE, 0x7A, 0xC1, 0xC1,
-    0x63, 0x24, 0x98, 0x9F, 0x0C, 0x80, 0x99, 0x93, 0xC8, 0x05, 0x5E, 0x33, 0x1B, 0xB3, 0x8F, 0x14,
-    0xB9, 0x0A, 0x1E, 0x31, 0x85, 0x81, 0xB2, 0x5A, 0xE4, 0x50, 0x93, 0x8A, 0xE8, 0x73, 0x7F, 0x01,
-    0x3A, 0xFD, 0xA7, 0x4A, 0x6A, 0x5C, 0x31, 0x2B, 0xC1, 0x18, 0xF5, 0xB6, 0x45, 0xCE, 0x09, 0x27,
-    0x55, 0x97, 0xDB, 0x74, 0x3E, 0x55, 0xBC, 0xE9, 0x52, 0xC0, 0x26, 0xDE, 0xE4, 0x18, 0x5F, 0xE4,
-    0x1F, 0x10, 0xF1, 0x10, 0xE6, 0xB2, 0xAC, 0x32, 0x31, 0x14, 0x66, 0xA6, 0x0A, 0xD4, 0x52, 0x38,
-    0xAB, 0x55, 0x35, 0xA8, 0x34, 0x75, 0x02, 0x05, 0x07, 0x58, 0x21, 0x3D, 0x04, 0xD4, 0xC3, 0x87,
-    0x70, 0x79, 0x99, 0xD6, 0xD7, 0x4C, 0x92, 0xF0, 0xC0, 0xD7, 0x54, 0x1B, 0x00, 0x76, 0x56, 0x3E,
-    0x2A, 0x12, 0xA6, 0xC9, 0xD0, 0x99, 0xC7, 0xCB, 0xE9, 0x75, 0x6F, 0xF9, 0x80, 0x6F, 0xA4, 0xEE,
-    0x8D, 0x91, 0x6F, 0x10, 0x48, 0x39, 0x54, 0xA6, 0xBF, 0x95, 0x91, 0x0F, 0x8F, 0x32, 0xDF, 0x66,
-    0x0A, 0xC5, 0x16, 0xD1, 0x9E, 0x12, 0x72, 0x8F, 0x23, 0x9E, 0x02, 0xF5, 0x69, 0x92, 0x64, 0xBA,
-    0x98, 0x1A, 0x51, 0xDD, 0x12, 0xCD, 0xBA, 0x2B, 0x79, 0x40, 0x96, 0x21, 0xD4, 0x7E, 0x56, 0x17,
-    0xB8, 0x36, 0xCF, 0x30, 0x57, 0x90, 0x8E, 0x59, 0xAC, 0x3F, 0x69, 0x08, 0x12, 0x41, 0xF6, 0x58,
-    0x2C, 0x84, 0x29, 0x16, 0x03, 0x01, 0xFB, 0x84, 0xC5, 0x22, 0x13, 0x4C, 0x70, 0x45, 0x78, 0x74,
-    0x13, 0x39, 0x20, 0x1E, 0x5D, 0x42, 0x2E, 0x8B, 0x47, 0x91, 0xFC, 0x68, 0x22, 0x86, 0xCB, 0x33,
-    0x78, 0xD4, 0xC6, 0xC2, 0x47, 0x55, 0x22, 0x7C, 0xA4, 0x01, 0x11, 0x62, 0x0E, 0x2B, 0x7C, 0x04,
-    0x6F, 0xC2, 0x47, 0x5A, 0xD3, 0xA1, 0x0C, 0x59, 0x91, 0x43, 0x26, 0x02, 0xBD, 0x23, 0x9F, 0x4C,
-    0xEF, 0xE7, 0x3A, 0x81, 0xF1, 0xD9, 0x6A, 0x18, 0xA8, 0x49, 0xCD, 0x5C, 0x49, 0x08, 0xD4, 0xA1,
-    0xCF, 0x8E, 0x78, 0x7D, 0xB8, 0x3B, 0x98, 0x5F, 0xF9, 0xB1, 0x06, 0xFE, 0x9A, 0x9D, 0xA8, 0xC6,
-    0x97, 0x4E, 0x74, 0xD7, 0x12, 0xA9, 0x21, 0x5B, 0x5F, 0x5A, 0xCA, 0x1D, 0xFA, 0x41, 0x50, 0x1A,
-    0xE8, 0x68, 0xD0, 0x32, 0x72, 0x1A, 0xE9, 0x65, 0x92, 0xB9, 0xA5, 0x8B, 0x89, 0xB7, 0xB5, 0xC9,
-    0x40, 0x8F, 0x81, 0x16, 0x6F, 0xA5, 0x3D, 0x3D, 0x8E, 0xED, 0x98, 0x56, 0xE4, 0xE0, 0x14, 0x89,
-    0x7F, 0x1D, 0xC1, 0x89, 0xD1, 0x14, 0x34, 0x1B, 0x2A, 0x15, 0x04, 0x13, 0x57, 0x68, 0xFB, 0xFE,
-    0x5C, 0xE8, 0x70, 0xBA, 0xA9, 0xFE, 0x43, 0x7D, 0x68, 0xA4, 0x4F, 0xAD, 0xF3, 0xAB, 0xCD, 0xDD,
-    0x19, 0xC9, 0xA3, 0xC9, 0xC5, 0xAA, 0xD2, 0x99, 0xCC, 0xC1, 0xA9, 0x6A, 0x10, 0xB3, 0x29, 0x84,
-    0xA3, 0x0C, 0x70, 0x5A, 0xBA, 0x52, 0xBF, 0xD8, 0xE6, 0x7F, 0x1E, 0xD1, 0xB5, 0xF8, 0xD4, 0x5E,
-    0x02, 0x79, 0xA5, 0x36, 0x73, 0x84, 0x10, 0xBD, 0xC7, 0x75, 0xB9, 0x8F, 0xB1, 0x3C, 0x92, 0x5C,
-    0x78, 0x19, 0xE5, 0x1C, 0x77, 0xCC, 0x21, 0x12, 0x9D, 0x2E, 0xD6, 0x36, 0xEA, 0xD2, 0xFA, 0xCB,
-    0x40, 0x3F, 0x3E, 0x7F, 0x62, 0x7E, 0x1F, 0xBE, 0x68, 0x4C, 0xBA, 0x78, 0x48, 0x3A, 0xEE, 0x9D,
-    0x68, 0xBE, 0x6F, 0xD2, 0x41, 0x93, 0xA1, 0x18, 0x7F, 0x72, 0xBD, 0x8B, 0x90, 0x82, 0xE4, 0x55,
-    0xDA, 0x1E, 0x33, 0xA9, 0xC9, 0xCC, 0x5E, 0x72, 0xFE, 0xB7, 0x8C, 0xC0, 0xB0, 0x66, 0xC5, 0x9B,
-    0x1A, 0x0B, 0x1F, 0x55, 0x5C, 0x04, 0x77, 0xE5, 0xED, 0x90, 0x43, 0x00, 0xB7, 0x1C, 0x0E, 0xC3,
-    0x87, 0x22, 0xF0, 0x8E, 0x94, 0x3D, 0x9F, 0x15, 0xDE, 0xCA, 0x5C, 0x28, 0x3B, 0x96, 0x30, 0x5F,
-    0x46, 0x38, 0x5A, 0x45, 0x4D, 0xDE, 0xA5, 0x83, 0x0F, 0xDC, 0x39, 0x24, 0xD5, 0x05, 0x52, 0x3F,
-    0xA4, 0x45, 0x28, 0x9E, 0xBC, 0xDF, 0x80, 0x89, 0xC4, 0xD5, 0xF4, 0x49, 0x3C, 0x79, 0xD1, 0x4A,
-    0x45, 0x3E, 0x02, 0x9D, 0x01, 0xCA, 0xB7, 0x01, 0x53, 0x46, 0x03, 0x03, 0x63, 0xCF, 0x51, 0xA2,
-    0x41, 0x93, 0xB3, 0xE3, 0x1E, 0xB3, 0xEF, 0xB4, 0x72, 0xF6, 0x0D, 0x57, 0x92, 0x6B, 0xB6, 0xA5,
-    0xEC, 0xCE, 0xDC, 0xB1, 0x00, 0x0E, 0x07, 0xDA, 0xB9, 0x10, 0x78, 0x57, 0x11, 0x4F, 0x58, 0xDE,
-    0x15, 0x0C, 0x06, 0x7A, 0x6F, 0x0A, 0x1D, 0x2B, 0xB2, 0xB4, 0x8A, 0xDB, 0x1E, 0x34, 0x3A, 0xA9,
-    0xBC, 0xDF, 0xE9, 0x17, 0x3A, 0x9D, 0x84, 0x18, 0xAF, 0x80, 0x5B, 0x4E, 0xDF, 0x01, 0xCA, 0xCF,
-    0xA9, 0x63, 0xAC, 0xFB, 0x32, 0xD4, 0x17, 0x92, 0xBD, 0x7A, 0x66, 0x26, 0xD0, 0xE5, 0xE4, 0xB9,
-    0xE3, 0x61, 0x4E, 0x58, 0x1D, 0xE1, 0xCA, 0x64, 0xA9, 0xC5, 0x17, 0xCF, 0x7C, 0xC9, 0xD8, 0xFA,
-    0x37, 0x6D, 0x6D, 0xE7, 0xD6, 0xA9, 0xD6, 0x5A, 0x84, 0x7A, 0xA0, 0xF2, 0xDB, 0x84, 0xBA, 0xA4,
-    0xD6, 0x22, 0xD8, 0x0F, 0xCC, 0x1F, 0x7F, 0xA9, 0xD8, 0xD2, 0x28, 0x17, 0x69, 0xA5, 0x22, 0xB4,
-    0x44, 0xA3, 0x56, 0xDE, 0xA9, 0x8C, 0x80, 0xBE, 0xE1, 0xBE, 0xE1, 0x40, 0xCE, 0xED, 0x3B, 0xF9,
-    0x04, 0x6C, 0x61, 0x24, 0x38, 0x6B, 0x8F, 0x7B, 0x7E, 0xBB, 0xC0, 0xC9, 0xFC, 0x25, 0x1E, 0x35,
-    0x49, 0x70, 0x11, 0x14, 0xE0, 0xE2, 0xA8, 0x6C, 0x65, 0x98, 0x2E, 0x8D, 0xF0, 0xC5, 0x39, 0xF9,
-    0x23, 0xA7, 0xB6, 0xBB, 0xD0, 0x6C, 0x99, 0x5C, 0x2C, 0x5D, 0xA8, 0x66, 0xE9, 0x79, 0x7D, 0x4F,
-    0x51, 0x4F, 0x39, 0x1A, 0x23, 0xC6, 0xA6, 0x08, 0x4B, 0x46, 0x2B, 0x5D, 0xC8, 0x5F, 0x44, 0x1E,
-    0x05, 0x8B, 0x02, 0x8C, 0x3D, 0x18, 0xCE, 0x20, 0x17, 0xA4, 0x3C, 0xD2, 0x81, 0x85, 0x9A, 0x78,
-    0x8C, 0x75, 0x8F, 0x2C, 0x55, 0xA1, 0xE5, 0x85, 0x0B, 0x92, 0xA8, 0x0A, 0x9A, 0x1E, 0x68, 0xAA,
-    0x69, 0x34, 0xC5, 0xFF, 0xBF, 0x5B, 0x07, 0xB7, 0x58, 0x97, 0x76, 0x6E, 0x35, 0x22, 0x53, 0xF4,
-    0x3D, 0x2A, 0xA7, 0xB6, 0x12, 0x82, 0xCD, 0x0D, 0xA3, 0x05, 0x54, 0xAE, 0x63, 0x1D, 0xC8, 0x5F,
-    0x48, 0x87, 0x07, 0x2C, 0xC6, 0x66, 0x09, 0x9B, 0x78, 0x64, 0x33, 0x2C, 0x1B, 0xBD, 0x67, 0xD1,
-    0xE5, 0x3B, 0xDC, 0xB1, 0x15, 0x45, 0xD7, 0x1E, 0xEF, 0xBE, 0x3A, 0x8F, 0x17, 0xC9, 0xE9, 0x39,
-    0xF4, 0x73, 0xF1, 0x9F, 0x59, 0xBF, 0xAD, 0xB1, 0xA0, 0xEE, 0x2F, 0xA3, 0x83, 0xFC, 0x82, 0x84,
-    0xD4, 0x10, 0xBD, 0x45, 0x2C, 0x6D, 0x12, 0xC4, 0xAD, 0x55, 0x04, 0x38, 0xC4, 0x60, 0x44, 0x24,
-    0xA9, 0x18, 0xB3, 0xB1, 0xB8, 0x1C, 0xD3, 0xA1, 0x43, 0x67, 0x7A, 0xAD, 0xFD, 0x14, 0xD4, 0x1B,
-    0x28, 0x1E, 0x84, 0x08, 0x5C, 0xD5, 0x5D, 0x0E, 0x80, 0x75, 0x05, 0x17, 0x21, 0x1D, 0x97, 0x51,
-    0x70, 0x13, 0xB7, 0xE4, 0x12, 0x6E, 0xD9, 0x5F, 0x75, 0xF0, 0x49, 0x83, 0x9C, 0x1B, 0x72, 0x49,
-    0x05, 0xE9, 0xCD, 0x4B, 0xBA, 0x84, 0xAC, 0x32, 0x10, 0xBB, 0xE3, 0x6C, 0x2E, 0x09, 0x2B, 0x00,
-    0x72, 0xF9, 0xB4, 0xC6, 0xA2, 0x39, 0xF8, 0x57, 0x76, 0x94, 0x87, 0xCF, 0x10, 0x5A, 0x08, 0xE5,
-    0x58, 0x23, 0xF9, 0x18, 0x6C, 0x37, 0x49, 0x8F, 0xF4, 0x56, 0x8A, 0xD5, 0x22, 0xEE, 0xDD, 0xBB,
-    0xFB, 0x18, 0x9B, 0xAA, 0xD9, 0x69, 0xD2, 0x22, 0x45, 0xDE, 0xC4, 0x7D, 0xC4, 0x3E, 0x65, 0x93,
-    0xEA, 0x7E, 0xFC, 0x64, 0xA1, 0xCD, 0x35, 0xA2, 0xF8, 0xCE, 0x1C, 0xD6, 0x9D, 0x05, 0xD2, 0x10,
-    0xD6, 0x6E, 0x57, 0x44, 0x6B, 0xD4, 0x6A, 0x09, 0xCC, 0x1E, 0x58, 0x68, 0x37, 0x7F, 0xBE, 0xFB,
-    0x24, 0xF8, 0xAF, 0xCD, 0x8C, 0xA7, 0x58, 0xA1, 0xF0, 0x37, 0x60, 0x7C, 0x44, 0x2C, 0x9C, 0x16,
-    0x70, 0x22, 0x6D, 0xB8, 0x7D, 0x47, 0x00, 0x4A, 0xEF, 0xD1, 0x16, 0xE0, 0x3A, 0x4D, 0x3A, 0x95,
-    0x5D, 0x00, 0xDB, 0x2C, 0x6C, 0x8D, 0x99, 0x9F, 0xD7, 0xF7, 0x71, 0xE1, 0x9D, 0xD3, 0x9C, 0xA0,
-    0xD7, 0xFD, 0x15, 0xDB, 0xC7, 0x7D, 0xA8, 0xFB, 0xAF, 0xE8, 0x13, 0x01, 0x92, 0x2A, 0x56, 0x6D,
-    0x90, 0x70, 0xE5, 0x63, 0x8C, 0x55, 0xC8, 0x56, 0xF0, 0x63, 0xFE, 0x3D, 0x80, 0x5B, 0xEC, 0x5F,
-    0x24, 0x74, 0xD5, 0xE6, 0xC5, 0x7C, 0x60, 0xB8, 0x73, 0x57, 0x61, 0x7E, 0xB7, 0x44, 0x4F, 0x6B,
-    0x3C, 0x38, 0xBA, 0x28, 0x05, 0x59, 0x9B, 0x0B, 0x54, 0xF6, 0xE8, 0x8A, 0xEC, 0xEE, 0xCC, 0x2C,
-    0x03, 0x12, 0x96, 0xE1, 0xFC, 0x21, 0xB5, 0x43, 0xAD, 0xF1, 0x3A, 0xE4, 0x48, 0xC9, 0x41, 0x8A,
-    0xFE, 0x38, 0x6D, 0x9D, 0x35, 0xB5, 0x53, 0xBB, 0x4A, 0xC2, 0xEA, 0x69, 0x73, 0x24, 0x33, 0xEB,
-    0xD2, 0xE5, 0x52, 0x68, 0xF9, 0x4E, 0x38, 0xF6, 0x9D, 0xB2, 0x83, 0xB5, 0xE1, 0xBD, 0x4B, 0xF8,
-    0x83, 0x21, 0x46, 0xAC, 0xA3, 0x95, 0x44, 0xBF, 0x4D, 0x50, 0xB0, 0xAE, 0x05, 0x33, 0xD6, 0xF6,
-    0xEE, 0xFC, 0x38, 0x96, 0xEB, 0x5A, 0xE2, 0xC9, 0x74, 0x23, 0x8F, 0x06, 0x6C, 0x22, 0x0D, 0x6E,
-    0x4C, 0x89, 0x40, 0xE5, 0xC3, 0x67, 0x5F, 0xD6, 0x31, 0x91, 0xAC, 0x4E, 0xD0, 0x96, 0x4C, 0x8B,
-    0x6D, 0x35, 0x93, 0x56, 0x6E, 0xD5, 0xFB, 0x67, 0xA8, 0x47, 0x59, 0xCA, 0x7C, 0xF6, 0xFA, 0x94,
-    0xF4, 0xF1, 0x80, 0x51, 0x7F, 0x39, 0x99, 0x9C, 0xFE, 0x1B, 0xEE, 0x80, 0xC8, 0xC1, 0xB4, 0x97,
-    0x40, 0x8F, 0xB8, 0xCE, 0x53, 0xAF, 0x72, 0xFB, 0xD9, 0xCB, 0x18, 0x10, 0xA4, 0xF6, 0x7A, 0x5C,
-    0x80, 0xE3, 0x1C, 0x76, 0xA7, 0x2F, 0xEC, 0x72, 0xBB, 0x3E, 0x73, 0x7B, 0x52, 0x20, 0xF7, 0xF4,
-    0x6C, 0x58, 0xC7, 0xDC, 0x4E, 0x9B, 0xA1, 0x46, 0x11, 0x8E, 0x79, 0x62, 0x45, 0x13, 0xB7, 0x1F,
-    0xEE, 0x5C, 0xE2, 0x92, 0x50, 0x07, 0xE8, 0x98, 0xCA, 0x21, 0x69, 0xA3, 0xD1, 0xD6, 0xC1, 0x94,
-    0x03, 0x58, 0xCA, 0x0F, 0xFF, 0x5A, 0x77, 0xC7, 0x29, 0x3F, 0x79, 0x77, 0x71, 0x98, 0x92, 0xA0,
-    0xBB, 0x62, 0xF8, 0x69, 0xA7, 0x83, 0x7F, 0x0F, 0x71, 0x03, 0xCC, 0x85, 0xBB, 0x89, 0x8D, 0x59,
-    0x39, 0x3C, 0xEF, 0x79, 0x1C, 0x30, 0x6E, 0x47, 0x4D, 0x1C, 0x94, 0xD0, 0x9E, 0x19, 0x77, 0xF9,
-    0xC5, 0xEE, 0xCC, 0xE9, 0x9D, 0x37, 0xBA, 0x7B, 0x16, 0xD3, 0x57, 0x21, 0xB7, 0xCD, 0x93, 0x9A,
-    0x3B, 0x85, 0x7E, 0xE7, 0x37, 0xBB, 0xC3, 0x23, 0xF1, 0x32, 0x6A, 0x43, 0x44, 0xC9, 0xE1, 0x98,
-    0xC2, 0x51, 0x21, 0x7F, 0xCE, 0xBC, 0x5D, 0xE1, 0xCD, 0x53, 0x78, 0x86, 0xE3, 0x03, 0x36, 0xC7,
-    0x5A, 0x03, 0x60, 0xA0, 0xB7, 0x85, 0xCA, 0x0B, 0xA8, 0x50, 0x91, 0xCF, 0x45, 0xE9, 0xCF, 0xF8,
-    0x0D, 0xE5, 0x9A, 0xE5, 0x99, 0x80, 0x81, 0x83, 0x02, 0x6F, 0x59, 0x27, 0x6E, 0x79, 0x46, 0x09,
-    0x48, 0x3B, 0x6E, 0x83, 0xD9, 0x2F, 0x36, 0xE6, 0x3E, 0x5A, 0xA1, 0x8F, 0xDC, 0xE5, 0x37, 0x6D,
-    0x7C, 0x05, 0x31, 0xFB, 0x68, 0x79, 0xC4, 0xE3, 0xFF, 0x31, 0xA0, 0x22, 0x13, 0x4F, 0x2F, 0x5C,
-    0x92, 0xF2, 0xD0, 0xF8, 0x29, 0x26, 0x7D, 0xD1, 0xD1, 0xF0, 0xE9, 0x52, 0xEE, 0xD7, 0xD2, 0x89,
-    0x76, 0x4E, 0x59, 0x7C, 0x3E, 0xB9, 0x90, 0x37, 0xC6, 0xF7, 0xD4, 0x55, 0xE3, 0xDB, 0x02, 0x69,
-    0x3F, 0xD1, 0x1D, 0x31, 0x4F, 0xCF, 0x08, 0x0E, 0x9E, 0x36, 0x07, 0x3A, 0x7A, 0xF2, 0x1E, 0x4B,
-    0x40, 0xB0, 0x6E, 0xF9, 0x78, 0x42, 0x0E, 0xC2, 0xCC, 0xE6, 0x3A, 0x2F, 0x70, 0xA7, 0x7C, 0x1F,
-    0x8F, 0x90, 0x78, 0xB1, 0x66, 0x59, 0xDB, 0x96, 0x4B, 0xA8, 0x07, 0xA1, 0x3C, 0x8D, 0xFC, 0x68,
-    0xA6, 0x5E, 0xBF, 0xAA, 0x15, 0x72, 0x17, 0x15, 0x62, 0xC9, 0x07, 0x56, 0x87, 0xA3, 0x43, 0xD3,
-    0x7D, 0x22, 0xF3, 0xEF, 0x7B, 0x9B, 0xA0, 0xEB, 0x86, 0xB0, 0xDC, 0x5F, 0x32, 0xF4, 0x10, 0x2D,
-    0xC1, 0x74, 0xB9, 0x06, 0x6A, 0x2C, 0xCA, 0x14, 0x88, 0xD1, 0x10, 0x73, 0x96, 0xBC, 0x8C, 0x3E,
-    0xC7, 0x65, 0x3E, 0x7A, 0xD2, 0xA7, 0xC4, 0x39, 0x38, 0x9E, 0xA7, 0x31, 0x30, 0x4D, 0x34, 0xA8,
-    0x8D, 0xDB, 0x18, 0x8E, 0x86, 0x65, 0xAD, 0x83, 0x75, 0x74, 0xDD, 0xD1, 0x0C, 0xB6, 0x7B, 0x9F,
-    0xD5, 0xCD, 0x8C, 0x9E, 0x29, 0xD3, 0x90, 0x88, 0x21, 0x20, 0xA0, 0x97, 0xAE, 0x42, 0x53, 0x50,
-    0x0A, 0x23, 0x56, 0x19, 0x5C, 0x5F, 0x4A, 0x85, 0xE2, 0x61, 0x2E, 0x2A, 0x97, 0x19, 0x1B, 0x59,
-    0x04, 0x4B, 0xDC, 0x65, 0xE0, 0x36, 0x89, 0x6E, 0x6C, 0x99, 0xD9, 0x82, 0x48, 0x83, 0xA7, 0xBB,
-    0xE2, 0xDC, 0x93, 0xE9, 0x67, 0xEF, 0xCF, 0x34, 0x59, 0xD1, 0x69, 0x67, 0xDC, 0xB1, 0x3B, 0x24,
-    0xBC, 0x3E, 0x33, 0x1E, 0xF1, 0xCC, 0xDA, 0x44, 0xDC, 0xFC, 0x6E, 0x6B, 0xA2, 0x06, 0x20, 0x3A,
-    0x78, 0xDB, 0x37, 0xD5, 0x8E, 0x9C, 0x66, 0xCC, 0xDA, 0xE9, 0x41, 0x09, 0xAA, 0xC4, 0x41, 0xF8,
-    0xF5, 0x2D, 0x95, 0x98, 0x3E, 0x43, 0x25, 0x2E, 0x41, 0x25, 0xBA, 0x44, 0x74, 0xBB, 0x48, 0x77,
-    0x8E, 0x66, 0x95, 0x48, 0x33, 0x58, 0xE0, 0x94, 0x50, 0x49, 0x3A, 0x93, 0x3C, 0x07, 0xE6, 0x5B,
-    0x7B, 0x77, 0x8D, 0x60, 0x97, 0xF8, 0xD6, 0xEC, 0x29, 0xC7, 0xA8, 0x8C, 0x39, 0x5B, 0x28, 0xD7,
-    0x88, 0x20, 0xDB, 0xDB, 0xB1, 0x59, 0xBD, 0x3B, 0x33, 0xAF, 0x66, 0x1A, 0xD6, 0xF1, 0x18, 0x12,
-    0xCF, 0x16, 0xB8, 0xE3, 0x00, 0x8F, 0x6F, 0x6E, 0x7E, 0x7A, 0x58, 0x6B, 0xB1, 0x50, 0xD5, 0xD3,
-    0xD3, 0x04, 0x8D, 0xFA, 0x75, 0x3D, 0xAC, 0x45, 0x13, 0xDA, 0x3C, 0xB5, 0x17, 0x43, 0x8D, 0x2F,
-    0x90, 0x1C, 0x10, 0xF3, 0xCF, 0x02, 0xFC, 0x45, 0xAE, 0xC0, 0x13, 0x39, 0xA0, 0xCE, 0x87, 0x86,
-    0x77, 0x11, 0x9B, 0xF4, 0x27, 0x83, 0xED, 0x2E, 0x24, 0xBD, 0xFD, 0x75, 0x9F, 0x40, 0xEB, 0x1B,
-    0xDC, 0x01, 0x58, 0xB4, 0x09, 0x0F, 0xBF, 0xC1, 0xE6, 0xCB, 0x3A, 0x82, 0x97, 0xE7, 0xA9, 0xC9,
-    0xC9, 0x7C, 0x0B, 0x8F, 0xCD, 0x1E, 0x3D, 0xCB, 0xE6, 0x8E, 0x7E, 0xEE, 0x77, 0x1B, 0x71, 0x66,
-    0x8E, 0x06, 0x4D, 0xA8, 0x01, 0xBB, 0x3B, 0x07, 0xA1, 0x55, 0xC2, 0xED, 0x5E, 0x73, 0x59, 0x2B,
-    0xF0, 0xA5, 0x5D, 0x47, 0x94, 0x81, 0x80, 0x1B, 0x7E, 0xB9, 0x4D, 0x99, 0x00, 0x30, 0xDD, 0xB0,
-    0xAD, 0xFF, 0xF9, 0x2F, 0x3B, 0xBD, 0x7C, 0xB7, 0xD4, 0x18, 0x46, 0xAE, 0x19, 0x1E, 0x4B, 0x43,
-    0x02, 0xD0, 0x21, 0xC1, 0xF1, 0x0E, 0xBB, 0x2D, 0x53, 0x77, 0x68, 0xC2, 0xCC, 0x27, 0x68, 0x9C,
-    0x43, 0x57, 0x6F, 0xEE, 0xC2, 0x65, 0xDD, 0x53, 0x34, 0x5E, 0xF5, 0xB0, 0xE8, 0x5B, 0xCF, 0xB6,
-    0xE4, 0xA5, 0xF5, 0xED, 0x54, 0xF7, 0x5A, 0x5B, 0x22, 0xDC, 0xC8, 0xE5, 0x4C, 0x8A, 0x74, 0x27,
-    0x69, 0x1B, 0xDA, 0xC9, 0x2B, 0xFB, 0x48, 0x5A, 0x4B, 0x44, 0xE7, 0xCE, 0xF7, 0x6F, 0x45, 0x94,
-    0xBB, 0xCC, 0x78, 0x39, 0x3E, 0xBB, 0x2C, 0xC4, 0xC7, 0xD0, 0x24, 0x2C, 0xB5, 0x3C, 0x83, 0x60,
-    0x6B, 0x2D, 0x5B, 0x5B, 0x1E, 0x32, 0x1E, 0x78, 0x34, 0xC7, 0xFE, 0x1C, 0xAB, 0x1A, 0x4C, 0xDC,
-    0x9E, 0xB3, 0x5A, 0x51, 0xDC, 0x6B, 0xB2, 0x87, 0x24, 0x2E, 0x07, 0xFA, 0x07, 0xDC, 0x29, 0x05,
-    0x33, 0xA3, 0x9F, 0x3B, 0x30, 0xAC, 0x60, 0xC8, 0xB3, 0xA8, 0x3B, 0x03, 0xA6, 0x6D, 0x05, 0x8E,
-    0x1F, 0x69, 0xDE, 0x0C, 0x09, 0x43, 0x62, 0x79, 0x13, 0xE8, 0xB1, 0x5E, 0x44, 0x8A, 0xAC, 0xEA,
-    0x57, 0xD0, 0xDE, 0x68, 0xE2, 0xB9, 0x82, 0x9C, 0x39, 0x63, 0x20, 0x7A, 0x06, 0xAB, 0xD3, 0x60,
-    0xEC, 0x24, 0x2B, 0x91, 0xE3, 0xB4, 0xDC, 0x29, 0xF7, 0x35, 0x09, 0x8C, 0x5D, 0x22, 0xDD, 0x6E,
-    0xAD, 0x9E, 0x1E, 0xDE, 0x56, 0x95, 0xF7, 0x45, 0x77, 0x58, 0xAA, 0x39, 0x5B, 0x0D, 0x35, 0x7D,
-    0xD5, 0x0A, 0x33, 0x5C, 0x94, 0x9E, 0x33, 0x5E, 0xD6, 0xCE, 0x34, 0x1B, 0xD7, 0x83, 0x6D, 0xC1,
-    0x7D, 0x1B, 0xEF, 0x0C, 0xF3, 0x76, 0x26, 0xAA, 0xBA, 0xD5, 0xA2, 0x06, 0x5C, 0x73, 0xB3, 0x2B,
-    0x4B, 0xD1, 0x18, 0x66, 0xD4, 0xF7, 0x6F, 0x86, 0x65, 0x93, 0x32, 0x07, 0x2F, 0xDB, 0x39, 0x25,
-    0x77, 0xC8, 0xA4, 0x59, 0x76, 0x76, 0xEF, 0x6C, 0x5A, 0x74, 0x21, 0x9C, 0xB3, 0xE1, 0x59, 0xD2,
-    0xF9, 0x13, 0xF4, 0x8C, 0x91, 0xCB, 0xB7, 0x84, 0x4E, 0x8F, 0xB9, 0x6E, 0x7E, 0x82, 0xC2, 0xC8,
-    0xBC, 0x47, 0x59, 0xC8, 0xFF, 0x0B, 0xD5, 0x5C, 0x3D, 0xB0, 0xDE, 0x54, 0x7A, 0x3E, 0x92, 0xF0,
-    0x55, 0xD6, 0xCA, 0x44, 0x2E, 0x70, 0x61, 0xB3, 0xA0, 0x2D, 0xB6, 0x60, 0xC8, 0x2C, 0x6A, 0x53,
-    0x60, 0x24, 0x87, 0x99, 0x50, 0x6C, 0x81, 0x33, 0xE3, 0xBB, 0x3B, 0x81, 0x02, 0x8A, 0x6D, 0xF0,
-    0x6E, 0xF6, 0xB6, 0x29, 0x00, 0x69, 0x97, 0x92, 0x02, 0x17, 0x50, 0xA5, 0xC8, 0x2D, 0xC8, 0x0C,
-    0xBE, 0xCE, 0x0C, 0x14, 0x14, 0x64, 0x06, 0xAF, 0x84, 0x29, 0x28, 0x28, 0x10, 0x26, 0x1B, 0x8A,
-    0x14, 0x56, 0x36, 0xF6, 0x6C, 0x36, 0x14, 0x57, 0x04, 0x11, 0x64, 0x5B, 0xD2, 0x9B, 0xF7, 0x79,
-    0x8E, 0xF4, 0x7D, 0xDF, 0xBD, 0x36, 0x3F, 0x36, 0xB6, 0xEF, 0xE5, 0x62, 0xCE, 0xFD, 0x3E, 0xFD,
-    0x9C, 0xF3, 0x9E, 0xE7, 0xBC, 0xE7, 0xFD, 0x3F, 0xD7, 0x38, 0x5B, 0x5B, 0xB9, 0x31, 0x26, 0x91,
-    0x51, 0x5B, 0x4F, 0xA4, 0xD6, 0x5F, 0x0F, 0x6D, 0xBD, 0x6E, 0xAE, 0xFB, 0xB9, 0x97, 0x6D, 0x8C,
-    0xFB, 0xC6, 0x17, 0x7E, 0x91, 0x16, 0x6D, 0x24, 0x39, 0x5F, 0xED, 0x0D, 0xFB, 0xA9, 0xB4, 0x0D,
-    0xBE, 0xE4, 0x03, 0x63, 0xD2, 0xE0, 0xFE, 0x79, 0x3C, 0xE0, 0xF5, 0x11, 0x1E, 0xC8, 0x52, 0x3C,
-    0x10, 0x34, 0x01, 0x86, 0x1B, 0x4D, 0xA6, 0x0F, 0xC4, 0x57, 0xCF, 0x4A, 0x8A, 0xA1, 0xD1, 0x43,
-    0xA6, 0xBF, 0x4A, 0x13, 0x5E, 0xDD, 0x7A, 0x63, 0x30, 0x8E, 0x76, 0x52, 0x34, 0x26, 0xAE, 0x30,
-    0x9E, 0xA7, 0x37, 0x93, 0xCE, 0x95, 0x4E, 0xC7, 0xEB, 0x0A, 0xA9, 0x03, 0x91, 0x0F, 0x95, 0xE6,
-    0x42, 0x7A, 0x17, 0x33, 0xC8, 0xF4, 0xB3, 0x5E, 0xAA, 0xCC, 0xE1, 0xF5, 0x93, 0x2B, 0x44, 0xAF,
-    0x9D, 0x01, 0x7D, 0x3D, 0x6E, 0x35, 0xAE, 0x7C, 0x2A, 0x69, 0x52, 0x47, 0x9D, 0x37, 0x18, 0xC9,
-    0xD7, 0xF2, 0xB0, 0xC3, 0x14, 0x72, 0x73, 0x54, 0xFB, 0x8C, 0x45, 0xF2, 0x48, 0xA4, 0xF3, 0x24,
-    0x97, 0x3C, 0xAB, 0xC3, 0x2E, 0xC0, 0x33, 0x45, 0x1D, 0xF7, 0xBE, 0x12, 0x34, 0x26, 0xF2, 0xA5,
-    0x54, 0xD2, 0x25, 0xAD, 0x39, 0x69, 0x96, 0xDD, 0xFF, 0xC4, 0xFC, 0x05, 0x26, 0xDE, 0x7A, 0x98,
-    0x65, 0x72, 0x0D, 0x33, 0x72, 0x41, 0x3D, 0xF0, 0x21, 0x4C, 0x07, 0xD2, 0xEF, 0x05, 0x80, 0x26,
-    0xD5, 0xFF, 0x8E, 0x99, 0xFB, 0x4D, 0xD0, 0xF9, 0x95, 0x76, 0xD0, 0x63, 0x1A, 0x3A, 0x97, 0x31,
-    0xBD, 0x0B, 0x48, 0xEE, 0x5F, 0x54, 0x30, 0x86, 0x25, 0x8B, 0xF4, 0x98, 0x91, 0x6D, 0x84, 0xB1,
-    0xB5, 0x8F, 0xFF, 0xC6, 0xAF, 0x90, 0xAB, 0x6D, 0xE2, 0xEE, 0x0E, 0xA2, 0x04, 0x42, 0x12, 0x5D,
-    0x09, 0x1F, 0x03, 0x17, 0x40, 0x61, 0x38, 0xA1, 0x57, 0x40, 0x4D, 0x91, 0x4F, 0xC3, 0xFE, 0x80,
-    0x18, 0x91, 0xFF, 0x52, 0x50, 0x95, 0x4E, 0x0F, 0x64, 0xA7, 0xB5, 0xF9, 0xD1, 0x62, 0x0D, 0x0F,
-    0xFC, 0x33, 0x39, 0xF4, 0x12, 0x86, 0xEF, 0x0D, 0x90, 0xF1, 0xE4, 0xD2, 0x7D, 0x7D, 0x00, 0x18,
-    0xC2, 0xDE, 0x78, 0x9D, 0x4E, 0xC4, 0x6D, 0x75, 0x54, 0x93, 0x12, 0xE2, 0x6C, 0xD1, 0x14, 0xBB,
-    0x1A, 0x20, 0x92, 0x61, 0x3E, 0x09, 0xC9, 0x13, 0xAE, 0x57, 0x6D, 0x8E, 0xE8, 0xBC, 0x65, 0xB0,
-    0x98, 0x17, 0x3A, 0x3D, 0xBB, 0x25, 0xCD, 0xE1, 0x93, 0xD3, 0x42, 0x77, 0x76, 0x1A, 0x49, 0xA9,
-    0xCC, 0xA5, 0x74, 0x2A, 0xBA, 0x2F, 0xE8, 0xD5, 0xCD, 0x25, 0x97, 0x3D, 0x74, 0x5A, 0xFB, 0x69,
-    0x95, 0xC6, 0x36, 0x1E, 0xE5, 0x3F, 0x15, 0x9C, 0x0F, 0x7B, 0x77, 0xCC, 0x6A, 0xFF, 0x7F, 0x75,
-    0x4A, 0x0A, 0x91, 0x01, 0x6D, 0x3A, 0x8E, 0xAB, 0xB8, 0x2B, 0xD5, 0xFA, 0x2C, 0x06, 0x7F, 0xF5,
-    0x1D, 0x5D, 0xDE, 0x46, 0xC7, 0xCB, 0x33, 0x1D, 0xF2, 0x00, 0x06, 0x3B, 0x58, 0xCD, 0xCB, 0x92,
-    0xE9, 0x40, 0xCE, 0xA0, 0x48, 0xF9, 0x9D, 0xAE, 0x78, 0x58, 0x07, 0x95, 0x59, 0x4B, 0xDD, 0x74,
-    0x1F, 0x20, 0xE2, 0xBC, 0xA9, 0x24, 0xEA, 0xBB, 0xD2, 0x98, 0x70, 0xBB, 0x36, 0x45, 0x54, 0xFA,
-    0x4D, 0x9C, 0xC7, 0xE9, 0xA3, 0x0B, 0x34, 0x0E, 0xBE, 0xA6, 0x2C, 0x3A, 0xE8, 0x7B, 0x43, 0x20,
-    0x45, 0x97, 0xD5, 0xC9, 0xE7, 0x62, 0x8A, 0x7F, 0xEA, 0x9C, 0xBE, 0xA8, 0xB8, 0xD2, 0x21, 0x10,
-    0xE9, 0x48, 0x01, 0x10, 0xF1, 0xC1, 0xE2, 0x72, 0x79, 0x43, 0x19, 0xAB, 0xD7, 0xF9, 0xD4, 0x91,
-    0x32, 0xB2, 0xB3, 0x3E, 0x77, 0x16, 0x01, 0x12, 0x3B, 0x89, 0x76, 0xFE, 0x14, 0x57, 0x3B, 0x44,
-    0xFC, 0x5E, 0xA2, 0xE1, 0x6E, 0x92, 0x26, 0x47, 0xE7, 0xE0, 0xE9, 0xE3, 0xA1, 0xF6, 0xE0, 0x2C,
-    0x29, 0x73, 0xCF, 0xE8, 0x1D, 0x49, 0x95, 0xAE, 0xBF, 0x96, 0xED, 0x31, 0xEA, 0xC2, 0x5E, 0xCA,
-    0xF8, 0x8F, 0xBA, 0xD1, 0x63, 0x7D, 0x4E, 0xD1, 0xF0, 0x80, 0x86, 0xAE, 0x74, 0xDC, 0x93, 0x02,
-    0x47, 0x31, 0xF5, 0xE4, 0xCA, 0x53, 0xEF, 0xEB, 0x48, 0x3A, 0x44, 0xA7, 0x9B, 0x2A, 0x37, 0xEB,
-    0xBA, 0xE8, 0x07, 0x8D, 0x9F, 0x9B, 0x28, 0x8F, 0xC0, 0x09, 0x99, 0xB2, 0xD4, 0x95, 0x01, 0x33,
-    0xEE, 0x66, 0xBA, 0xA3, 0x72, 0x5F, 0x6C, 0x15, 0xDD, 0xE3, 0x79, 0x98, 0x27, 0x46, 0x65, 0x82,
-    0xEE, 0x11, 0x29, 0x38, 0x1F, 0x47, 0xA7, 0xE8, 0x74, 0xB7, 0x7D, 0xAB, 0x3C, 0x68, 0x1E, 0x30,
-    0xD8, 0x86, 0x8A, 0x86, 0xC9, 0x7E, 0x33, 0x80, 0x29, 0xFE, 0x08, 0x92, 0x03, 0xAA, 0x30, 0xD7,
-    0x0A, 0xB8, 0x6C, 0x39, 0xAC, 0x03, 0x02, 0x37, 0x54, 0x46, 0xA5, 0x40, 0x45, 0x45, 0x75, 0x81,
-    0x5F, 0x58, 0x80, 0x4C, 0x4A, 0x6D, 0x55, 0xF5, 0x61, 0x31, 0xA4, 0x41, 0x9B, 0x75, 0x68, 0x93,
-    0x1E, 0x6D, 0xCC, 0x36, 0x5A, 0x69, 0xC3, 0xEB, 0xAE, 0xC4, 0xF6, 0xF9, 0x96, 0xEF, 0xB2, 0x07,
-    0xA9, 0xB4, 0xF5, 0xD0, 0xF3, 0xAB, 0x85, 0x60, 0x31, 0x94, 0x6C, 0x8C, 0x78, 0x1A, 0xA3, 0x5F,
-    0x5A, 0xE1, 0xDD, 0xC3, 0xC7, 0x4F, 0x60, 0xB3, 0x07, 0x90, 0xEA, 0x5D, 0x92, 0x03, 0x63, 0xAE,
-    0xED, 0x8B, 0xBA, 0x08, 0xC1, 0x18, 0xE6, 0x10, 0x07, 0xC7, 0xB0, 0x1E, 0x75, 0x63, 0xD6, 0xB6,
-    0x94, 0x1D, 0x14, 0xB9, 0x11, 0x90, 0x68, 0x87, 0x9E, 0x5C, 0xD3, 0xD9, 0xC6, 0xBD, 0xAB, 0x97,
-    0xA5, 0x54, 0x1D, 0xE2, 0x8F, 0x10, 0x1E, 0xFA, 0xAF, 0xD0, 0x7D, 0x59, 0xE9, 0x65, 0x25, 0x42,
-    0x2F, 0x87, 0xAB, 0x97, 0x55, 0xBE, 0xE7, 0x8E, 0x54, 0x7A, 0xD9, 0x93, 0xCB, 0xDA, 0x49, 0xA8,
-    0x04, 0x5D, 0xD1, 0x76, 0xD4, 0x6E, 0x43, 0xB9, 0xA0, 0xC8, 0x38, 0x27, 0x9C, 0x13, 0x20, 0x0D,
-    0x5B, 0x70, 0x8D, 0xE4, 0x62, 0xB9, 0x75, 0x95, 0x2D, 0x64, 0x3A, 0xB7, 0x48, 0xD7, 0x55, 0xD7,
-    0x49, 0x65, 0x94, 0x6E, 0x65, 0xCE, 0x12, 0x98, 0xE9, 0x0D, 0xED, 0x01, 0x37, 0x14, 0x7E, 0xEC,
-    0xF1, 0xAC, 0x39, 0x2B, 0xFF, 0x93, 0x47, 0xBD, 0x12, 0xAB, 0xA0, 0x1C, 0x2C, 0xC6, 0xD7, 0x9D,
-    0xF9, 0x86, 0x45, 0x8D, 0x6F, 0x0C, 0x78, 0x43, 0x55, 0x1A, 0xBB, 0x4A, 0x2D, 0x6C, 0x46, 0xC5,
-    0x81, 0x94, 0x2E, 0xC6, 0xCB, 0xD1, 0xDA, 0x55, 0x5B, 0xC5, 0xCD, 0x1C, 0x4E, 0x27, 0x5D, 0x9B,
-    0x2D, 0x1A, 0xE0, 0xE0, 0x9C, 0x95, 0x3F, 0x81, 0xDE, 0xD1, 0x7E, 0xE2, 0xB5, 0xA3, 0xD7, 0x30,
-    0x65, 0xED, 0x0A, 0x4A, 0x4A, 0xF5, 0xD7, 0x59, 0xC9, 0xA1, 0x3B, 0xF3, 0x04, 0x58, 0x14, 0xF5,
-    0xDC, 0x08, 0x10, 0x93, 0xC5, 0x57, 0x22, 0x95, 0xB5, 0x78, 0x6E, 0x7C, 0x5A, 0x1B, 0x10, 0x40,
-    0x98, 0x3C, 0x69, 0x8B, 0xC1, 0x1C, 0xD6, 0xFF, 0xD4, 0xE2, 0x7C, 0xCD, 0x58, 0xA5, 0xCB, 0xE6,
-    0xD4, 0xF5, 0x06, 0x28, 0x30, 0xEB, 0x30, 0x8F, 0xAE, 0xB0, 0xBB, 0xF1, 0xD5, 0xB3, 0x60, 0x19,
-    0x17, 0x8D, 0x43, 0xB6, 0x21, 0x16, 0x66, 0x6A, 0xF2, 0xC3, 0x04, 0x3B, 0x5D, 0x34, 0xB8, 0xB6,
-    0xB8, 0x3B, 0x35, 0x7C, 0x6D, 0xEE, 0xE5, 0xD5, 0xA7, 0xFA, 0x08, 0x3D, 0x2F, 0x06, 0x6A, 0xD5,
-    0x34, 0xDE, 0xF4, 0x08, 0xB9, 0x34, 0xCE, 0xFA, 0x7A, 0xBA, 0xC3, 0x16, 0x2A, 0xC0, 0x99, 0xD2,
-    0x86, 0x63, 0xD1, 0x47, 0x4D, 0x30, 0x24, 0x95, 0x37, 0x66, 0xBA, 0x7E, 0xC5, 0xE5, 0x9F, 0x8B,
-    0xF6, 0x30, 0x02, 0x6B, 0xF9, 0xFD, 0xFA, 0xC9, 0xA2, 0xA4, 0x7C, 0xA2, 0x68, 0x48, 0xC6, 0xE3,
-    0x7F, 0xAF, 0x43, 0xA8, 0x30, 0x97, 0xDE, 0x81, 0xA5, 0x7D, 0x60, 0xB6, 0x25, 0x9F, 0x33, 0x3F,
-    0x84, 0x7D, 0xF1, 0x9C, 0x3E, 0xFB, 0x29, 0x0C, 0x12, 0x58, 0x40, 0x01, 0xED, 0x9F, 0x93, 0x7B,
-    0x8C, 0x81, 0x5A, 0x86, 0x87, 0xDC, 0xC6, 0xBC, 0xE9, 0xF5, 0x1E, 0x70, 0xA8, 0x94, 0x7D, 0x74,
-    0xB3, 0x76, 0xE6, 0xCE, 0x61, 0x61, 0xAC, 0x23, 0xB2, 0x4A, 0xA3, 0x71, 0x46, 0xB3, 0x0F, 0xF8,
-    0x81, 0x3A, 0x4A, 0x85, 0xFF, 0xE2, 0xFF, 0x00, 0x82, 0x32, 0xBD, 0x23, 0x58, 0xEC, 0xC5, 0xF4,
-    0x8C, 0xF9, 0x1D, 0xA0, 0xC7, 0xE2, 0x72, 0x66, 0x21, 0x9B, 0x71, 0x13, 0x86, 0x79, 0x63, 0xA8,
-    0x9A, 0x6F, 0xE3, 0x34, 0x1B, 0x73, 0x60, 0x23, 0xB7, 0x56, 0x2B, 0x86, 0x85, 0x5E, 0x94, 0x7F,
-    0xD3, 0x27, 0x55, 0xAC, 0x4D, 0xFC, 0xF5, 0x8C, 0x2A, 0x27, 0x35, 0x7F, 0x75, 0xED, 0x05, 0x44,
-    0x65, 0x17, 0x6B, 0x48, 0xAA, 0x72, 0xF6, 0x13, 0xFA, 0xBD, 0x66, 0x07, 0x68, 0xC3, 0xDA, 0xAB,
-    0xBD, 0x36, 0xAC, 0xDC, 0x3E, 0xCE, 0xA1, 0xA8, 0x4D, 0x32, 0x91, 0xEF, 0xD7, 0x77, 0x68, 0x8B,
-    0xB8, 0x6F, 0xD1, 0xD6, 0x6F, 0xA9, 0x9C, 0xD1, 0x46, 0x17, 0x61, 0x2A, 0x0D, 0x61, 0x03, 0x13,
-    0x2F, 0xD4, 0x77, 0x8F, 0x98, 0x3F, 0x5B, 0x5A, 0x74, 0x67, 0xE0, 0x39, 0x40, 0xC7, 0x39, 0x54,
-    0x9D, 0x50, 0xA0, 0x2A, 0x93, 0x5B, 0x47, 0xC5, 0xF7, 0x80, 0x6D, 0xA5, 0x3B, 0xDA, 0x6F, 0x81,
-    0x67, 0x58, 0xA2, 0xCF, 0x7B, 0xCD, 0xE4, 0xBF, 0xD2, 0x62, 0x24, 0xC2, 0xB4, 0x62, 0x54, 0x11,
-    0x69, 0x07, 0x1F, 0x08, 0xAC, 0x14, 0xB5, 0xB1, 0x42, 0xE9, 0x60, 0x44, 0x4A, 0x29, 0xB0, 0x3C,
-    0x3D, 0xA5, 0x2D, 0xE8, 0xE1, 0xF3, 0xC6, 0x4D, 0x20, 0xE3, 0x93, 0xAA, 0x9B, 0xA8, 0xE0, 0x02,
-    0x1A, 0x37, 0x56, 0xCF, 0x4E, 0x86, 0xCD, 0xAF, 0xD8, 0x17, 0x37, 0xB8, 0x8E, 0x03, 0xB3, 0xD7,
-    0xC4, 0xEF, 0x6B, 0x4F, 0x99, 0xAB, 0x63, 0x9D, 0x33, 0xDD, 0xEA, 0x92, 0x3A, 0x67, 0x0E, 0xBC,
-    0x0E, 0x82, 0x47, 0x63, 0x2D, 0xA5, 0x7F, 0x1C, 0x7F, 0xE5, 0x0F, 0xEA, 0xBC, 0x05, 0x6A, 0x8F,
-    0xA5, 0x68, 0x72, 0x36, 0xFE, 0xE8, 0x62, 0x09, 0xB7, 0xA1, 0x50, 0xA1, 0x3B, 0x80, 0x94, 0xD7,
-    0x9F, 0x9C, 0xDC, 0xB6, 0x80, 0xDC, 0x3C, 0xEB, 0x2C, 0x88, 0x30, 0x5D, 0x84, 0xAB, 0x0A, 0x85,
-    0x5A, 0x6D, 0x61, 0x97, 0xD4, 0x26, 0x6A, 0x15, 0xEB, 0xAC, 0x49, 0xC6, 0xB3, 0x52, 0x01, 0x9D,
-    0x94, 0x68, 0x99, 0x53, 0x67, 0x16, 0xFB, 0x3A, 0x48, 0x5D, 0xF0, 0x69, 0x1A, 0x83, 0x43, 0xB7,
-    0x3B, 0x6C, 0x04, 0x10, 0xEF, 0xD0, 0x6C, 0x34, 0xEB, 0x66, 0xBF, 0x82, 0x7D, 0xC8, 0x6E, 0x92,
-    0x47, 0xF4, 0x55, 0x87, 0xB8, 0xB4, 0x93, 0x1F, 0xED, 0xEF, 0x94, 0xA6, 0xFB, 0x05, 0x67, 0xEB,
-    0xA1, 0x5C, 0x8F, 0xC9, 0x2E, 0x27, 0x65, 0xFF, 0x31, 0xF5, 0xEB, 0xE4, 0xE7, 0x79, 0x04, 0x7E,
-    0x72, 0x61, 0x48, 0xDB, 0x15, 0xD8, 0x4F, 0x38, 0xEF, 0x37, 0xE4, 0x1C, 0x2E, 0x7E, 0x46, 0xBD,
-    0x42, 0x73, 0xC7, 0x25, 0x6B, 0x52, 0xFB, 0x20, 0x4A, 0xA0, 0x17, 0x38, 0xE8, 0xDA, 0x92, 0x49,
-    0xA0, 0x2F, 0xCC, 0x30, 0xDF, 0xA1, 0xB2, 0x22, 0x30, 0x3E, 0x3F, 0xF1, 0x1A, 0xFB, 0x78, 0x6D,
-    0x3F, 0xB1, 0xF7, 0xBF, 0x90, 0x92, 0x70, 0xB0, 0xAA, 0x8A, 0xBF, 0x82, 0x2F, 0x2D, 0x9C, 0x08,
-    0x40, 0xE9, 0x84, 0x19, 0x43, 0x3C, 0x68, 0xDC, 0x5D, 0xAC, 0x0E, 0xF7, 0x2E, 0x44, 0x48, 0x4A,
-    0x2A, 0xB5, 0x9B, 0x63, 0x06, 0x03, 0x5A, 0xA8, 0x2A, 0x5D, 0x2E, 0x7A, 0xFF, 0x8D, 0xF5, 0xF3,
-    0x4A, 0xAC, 0x9C, 0x27, 0xD6, 0x0F, 0xEE, 0x17, 0xB7, 0x3A, 0x2A, 0x6D, 0x99, 0x3C, 0x34, 0xE2,
-    0xCF, 0xB5, 0xE0, 0xAD, 0xAF, 0x7C, 0x6B, 0x67, 0x87, 0x39, 0xAE, 0x67, 0x60, 0x13, 0x79, 0xC9,
-    0x92, 0xA1, 0xFF, 0x52, 0x74, 0x75, 0xC0, 0x46, 0xC2, 0x6C, 0x20, 0x8C, 0x4B, 0x88, 0x36, 0xF8,
-    0x0C, 0x6D, 0xE6, 0x0C, 0x08, 0x8D, 0x3A, 0xCD, 0x72, 0xD7, 0x02, 0x89, 0x18, 0xBA, 0xD5, 0x95,
-    0x81, 0x68, 0x72, 0x95, 0x19, 0xD8, 0xA3, 0xCA, 0x9D, 0xF0, 0xA1, 0x3B, 0xAD, 0x04, 0x9C, 0x42,
-    0xF0, 0x2E, 0xA2, 0x2B, 0x04, 0x79, 0x0B, 0xB7, 0x41, 0x55, 0xEC, 0x95, 0x88, 0x34, 0x45, 0xA4,
-    0xD6, 0x12, 0x4B, 0x5A, 0xED, 0x2C, 0xC2, 0x6F, 0xB8, 0x5C, 0x5C, 0x71, 0xE1, 0x7B, 0xF4, 0xB1,
-    0xB4, 0x89, 0x34, 0xDA, 0x6D, 0x6C, 0xA7, 0x32, 0xCD, 0x28, 0x22, 0xBE, 0x97, 0xE0, 0x36, 0x7B,
-    0xF4, 0xCF, 0xF0, 0x2B, 0x21, 0x7C, 0x83, 0xFD, 0x35, 0x1E, 0x96, 0xCB, 0xEB, 0x3F, 0x97, 0x57,
-    0xA6, 0x7B, 0x8B, 0x27, 0x27, 0x87, 0x6E, 0xE7, 0x2F, 0x3C, 0x69, 0x16, 0x4F, 0x7E, 0xDD, 0x2F,
-    0xF4, 0xA2, 0x1C, 0xA3, 0xEE, 0xA5, 0x74, 0x3B, 0x49, 0x82, 0x73, 0x34, 0x29, 0xFA, 0x42, 0xB8,
-    0x79, 0xDB, 0x19, 0xAF, 0xB5, 0xE2, 0xEA, 0x26, 0x0D, 0x9F, 0x74, 0xFA, 0x48, 0xC9, 0xA3, 0xD3,
-    0xFC, 0x4B, 0x74, 0x17, 0x6B, 0xDF, 0xC9, 0xBC, 0xEE, 0x9D, 0x1A, 0x13, 0x3E, 0xDD, 0x4B, 0x05,
-    0x8E, 0xD8, 0x58, 0x54, 0xBE, 0xF1, 0x23, 0x01, 0x4B, 0x10, 0x31, 0xF8, 0x58, 0x24, 0x64, 0x50,
-    0x34, 0xAA, 0xFF, 0x2A, 0xE9, 0x9F, 0x2F, 0x64, 0x38, 0x97, 0xF5, 0x8F, 0x84, 0xCD, 0x8A, 0x05,
-    0xA6, 0x56, 0xCC, 0x50, 0x30, 0xA6, 0x79, 0xB3, 0xFF, 0x22, 0xBC, 0x88, 0xD7, 0x83, 0xEA, 0xC7,
-    0x49, 0x77, 0x2C, 0x93, 0xE1, 0x05, 0x74, 0xDE, 0x2E, 0x37, 0xC2, 0x7A, 0x1A, 0x23, 0x66, 0x91,
-    0xC7, 0xF0, 0x40, 0xBF, 0xE1, 0x9F, 0x0F, 0x92, 0x15, 0xC0, 0x5E, 0xBD, 0xCA, 0x0C, 0x3D, 0xF7,
-    0xAB, 0x09, 0x8D, 0xDB, 0x42, 0xE7, 0x43, 0x5B, 0x67, 0x32, 0x19, 0x15, 0x84, 0x65, 0xBA, 0xE1,
-    0x96, 0x28, 0xD4, 0xF7, 0x1E, 0x31, 0x7F, 0x5E, 0x98, 0xE7, 0xB3, 0x6B, 0xFA, 0xB5, 0x0D, 0x74,
-    0xD1, 0x4E, 0xDE, 0x4E, 0x3A, 0xEF, 0x31, 0xF7, 0x1C, 0x33, 0xF7, 0x67, 0xF9, 0xF3, 0x09, 0xB8,
-    0xBB, 0x59, 0x86, 0xF4, 0x6F, 0x89, 0xDA, 0xDB, 0x42, 0x92, 0xDB, 0x21, 0xF0, 0xAB, 0xBA, 0x5E,
-    0xF5, 0x7A, 0x7C, 0x55, 0xAF, 0x97, 0x3E, 0x77, 0xBF, 0x72, 0xBA, 0x83, 0x27, 0x95, 0xF3, 0x4A,
-    0x04, 0x1B, 0xCE, 0x7C, 0xA7, 0xA5, 0x87, 0xD8, 0x8E, 0x54, 0x6A, 0xE4, 0xFC, 0x77, 0x19, 0x71,
-    0xB7, 0x60, 0x98, 0x3A, 0xFC, 0x9D, 0x71, 0x67, 0xAA, 0xCC, 0x68, 0x6E, 0x2F, 0x63, 0xDC, 0x32,
-    0xB0, 0x6A, 0xE9, 0x5F, 0x14, 0xF9, 0x88, 0x1E, 0x46, 0xA7, 0x22, 0x2F, 0x55, 0x09, 0xED, 0x5B,
-    0xF9, 0x6B, 0x25, 0xB9, 0x77, 0x47, 0xBF, 0x40, 0xF4, 0x25, 0xAA, 0xAE, 0xA5, 0xD6, 0x41, 0x31,
-    0x8F, 0xAC, 0x5E, 0xAA, 0xAC, 0xC9, 0xF3, 0x63, 0x14, 0x53, 0x45, 0x94, 0xCD, 0xCE, 0x58, 0xA5,
-    0xCD, 0xFD, 0xBF, 0x76, 0x89, 0xCB, 0xA7, 0xAC, 0xAB, 0x6F, 0x49, 0x99, 0xA8, 0xDC, 0x68, 0x54,
-    0x23, 0x30, 0xA0, 0xA6, 0xDD, 0x3D, 0x94, 0x9A, 0x53, 0xAB, 0x4A, 0x6D, 0x3D, 0x35, 0xEB, 0x01,
-    0xC2, 0xD3, 0xEF, 0x63, 0xA6, 0x4D, 0xA1, 0x9A, 0xB7, 0xE7, 0xD2, 0xDB, 0xD7, 0xD5, 0x7D, 0x4A,
-    0x1A, 0xB5, 0x51, 0xC3, 0x6F, 0x77, 0x31, 0x92, 0xD3, 0x21, 0x30, 0xF4, 0x54, 0x3E, 0x89, 0xA5,
-    0x94, 0xB4, 0xC7, 0xF4, 0x5E, 0x7B, 0xBA, 0xB0, 0xC6, 0xC6, 0x3F, 0x95, 0x0B, 0x52, 0xC3, 0x68,
-    0xA8, 0x21, 0x7B, 0x39, 0x6F, 0xD3, 0x59, 0x83, 0x25, 0x1F, 0x7E, 0xDA, 0x99, 0x31, 0x68, 0xC3,
-    0xDA, 0xAF, 0x8F, 0x58, 0xC5, 0x66, 0xD5, 0x1A, 0x15, 0x5E, 0x0A, 0x09, 0x1A, 0xCE, 0x31, 0xD5,
-    0x29, 0xDA, 0x7C, 0xD3, 0x5F, 0x1B, 0xAA, 0x55, 0xD8, 0x52, 0x48, 0x4C, 0xD8, 0x18, 0x9F, 0xAB,
-    0x00, 0x66, 0x08, 0x73, 0xEA, 0xB3, 0xFF, 0x4A, 0xA8, 0xDF, 0xB2, 0x29, 0x26, 0xBD, 0x1E, 0xE0,
-    0x5E, 0x58, 0x79, 0x6D, 0x54, 0x46, 0xE9, 0xC3, 0x4B, 0x3D, 0xFA, 0x0C, 0xD3, 0x4E, 0x85, 0x28,
-    0xDD, 0xFD, 0xA2, 0x5B, 0xC6, 0xCC, 0x6F, 0xE6, 0x6B, 0x64, 0x69, 0x08, 0xD0, 0x4D, 0xAB, 0x8B,
-    0x9A, 0x33, 0x2D, 0xF0, 0x2C, 0xF7, 0x41, 0x1F, 0xCA, 0x40, 0x75, 0xA8, 0xBC, 0x58, 0xDB, 0x80,
-    0xEE, 0x42, 0x91, 0x6A, 0x9B, 0x20, 0xB8, 0x9E, 0xB2, 0x9F, 0xC7, 0x46, 0xA8, 0x9D, 0x27, 0x3A,
-    0xB4, 0x40, 0xDD, 0xA3, 0x6B, 0x64, 0xD3, 0xC8, 0xEA, 0xDD, 0xF2, 0xFA, 0xC6, 0xC0, 0x67, 0x98,
-    0x8C, 0x7B, 0x8C, 0x6F, 0x1D, 0x67, 0x78, 0x3E, 0x2D, 0xD8, 0x5B, 0xCC, 0x58, 0x65, 0x88, 0x60,
-    0xA8, 0xEE, 0x3C, 0x75, 0xDF, 0x07, 0x63, 0x2D, 0x95, 0x98, 0x06, 0x92, 0x73, 0x7A, 0x8E, 0xB1,
-    0xD0, 0x06, 0x83, 0xD9, 0x06, 0x05, 0xB8, 0xD2, 0xDA, 0xF4, 0x9C, 0x4D, 0xD5, 0x1D, 0xB4, 0x82,
-    0x04, 0x8B, 0x5C, 0x1A, 0x22, 0xA8, 0x10, 0xF7, 0xB3, 0x55, 0x6E, 0xAD, 0x59, 0x1A, 0x18, 0xE1,
-    0xEA, 0x45, 0xEC, 0xB6, 0x46, 0x5D, 0xA3, 0xB0, 0xA7, 0x60, 0x40, 0xA4, 0x5D, 0xDE, 0x45, 0x20,
-    0xBA, 0xE1, 0xDA, 0xC9, 0x3C, 0x23, 0xB9, 0x08, 0x0C, 0x3F, 0x43, 0x9A, 0xA5, 0xE7, 0xB6, 0x61,
-    0x84, 0xBA, 0x2C, 0x5A, 0x7D, 0x52, 0x17, 0x33, 0x1A, 0x53, 0xD1, 0x6E, 0x94, 0x23, 0x9F, 0x00,
-    0x43, 0x97, 0x93, 0xD1, 0x73, 0x0F, 0xB5, 0x72, 0x35, 0x0F, 0x6A, 0xAC, 0x96, 0xCE, 0xE7, 0x74,
-    0x03, 0xBD, 0x1E, 0x26, 0xA4, 0xD6, 0x69, 0x1B, 0x75, 0xDA, 0x43, 0x26, 0xBF, 0x15, 0x71, 0x91,
-    0xB7, 0x48, 0x95, 0xDD, 0xB5, 0xA7, 0xA8, 0x8B, 0x91, 0x01, 0x78, 0x49, 0x3B, 0x88, 0xAE, 0x08,
-    0x5D, 0x50, 0x06, 0x43, 0x90, 0x13, 0x90, 0x97, 0x71, 0xB5, 0x63, 0xDA, 0xE3, 0x45, 0x98, 0x86,
-    0x5D, 0x34, 0x42, 0x94, 0x2A, 0xFA, 0x99, 0xDA, 0xBB, 0x75, 0x8C, 0x5D, 0xF6, 0xA2, 0x20, 0x56,
-    0x6B, 0xA6, 0x88, 0xE2, 0x33, 0x18, 0xB2, 0x9B, 0x6D, 0x7A, 0xBB, 0x4C, 0xCD, 0x64, 0x39, 0x3B,
-    0xE9, 0xAE, 0x38, 0xDB, 0x60, 0x28, 0x10, 0x60, 0x79, 0x9A, 0x1B, 0x85, 0x49, 0x6E, 0xAA, 0x79,
-    0x6B, 0x8E, 0xA9, 0x38, 0x68, 0x3C, 0x04, 0x56, 0x7E, 0x79, 0x7D, 0x60, 0xE5, 0x84, 0x42, 0xA3,
-    0x1B, 0xA5, 0x50, 0x46, 0xAC, 0x92, 0xD3, 0x73, 0xA0, 0x5A, 0x2D, 0x67, 0x35, 0x1A, 0x63, 0xA6,
-    0x04, 0x6C, 0xB4, 0xFB, 0x26, 0x3E, 0x2A, 0x9A, 0x19, 0xB8, 0xBA, 0xDE, 0x93, 0x09, 0xF1, 0xE7,
-    0xC4, 0x0E, 0x0F, 0x85, 0x61, 0x10, 0x06, 0x36, 0xAD, 0x0B, 0xD0, 0xCC, 0x7E, 0xCE, 0x6D, 0x9A,
-    0xA7, 0x01, 0xE7, 0x69, 0xFF, 0x3A, 0xA2, 0x1A, 0x52, 0x71, 0xA9, 0xAA, 0x4E, 0xF5, 0xEE, 0x11,
-    0x2B, 0x43, 0x28, 0xDC, 0xC0, 0x7D, 0x61, 0xA5, 0x78, 0x84, 0xBA, 0x03, 0x86, 0xA8, 0x54, 0x3C,
-    0xA2, 0x14, 0xCA, 0x0C, 0x13, 0xBB, 0x1F, 0xCD, 0x3D, 0x77, 0x08, 0x8F, 0xC3, 0x4E, 0x5A, 0x0C,
-    0xE1, 0x07, 0x6A, 0x85, 0x6F, 0x48, 0xA5, 0x8F, 0x3C, 0xD6, 0x84, 0x43, 0x94, 0x26, 0xED, 0x73,
-    0x46, 0x3E, 0x52, 0x69, 0x73, 0xFC, 0x96, 0x84, 0x2D, 0xF2, 0x78, 0xD9, 0x14, 0x2A, 0xFB, 0x76,
-    0x8B, 0xBC, 0x06, 0xC9, 0x16, 0x21, 0xCC, 0xC7, 0xE4, 0x14, 0x9B, 0x08, 0xC9, 0x27, 0x27, 0xBD,
-    0x95, 0x49, 0x4D, 0x86, 0x3A, 0xEC, 0xF4, 0xC0, 0x8E, 0x9A, 0x5A, 0x3A, 0xBF, 0xF2, 0x83, 0xBB,
-    0x49, 0x41, 0x9A, 0xB4, 0xE1, 0x30, 0x7D, 0x08, 0x3A, 0xC2, 0xFE, 0x35, 0x6F, 0x15, 0xA3, 0x61,
-    0x8D, 0x06, 0x73, 0x9A, 0x36, 0x69, 0xC8, 0x89, 0x06, 0x32, 0x85, 0x36, 0xE7, 0xF0, 0xA0, 0x75,
-    0xAA, 0xA6, 0x8F, 0xC7, 0xF5, 0xB1, 0xE4, 0x8A, 0x95, 0x64, 0xF8, 0x88, 0xC7, 0x7C, 0xDB, 0xB0,
-    0x63, 0x3C, 0xFB, 0xF0, 0xE2, 0xB5, 0xB7, 0xF0, 0x5A, 0x58, 0x72, 0xC2, 0xF8, 0x98, 0x94, 0x9C,
-    0x31, 0x82, 0x06, 0x2A, 0xEE, 0x30, 0x65, 0xBA, 0x91, 0xA9, 0xCA, 0x37, 0x17, 0x39, 0xC8, 0x81,
-    0x93, 0x86, 0xC7, 0xD1, 0x4E, 0xE9, 0x27, 0x7E, 0xF9, 0x3F, 0xF5, 0xFC, 0x15, 0xCE, 0xD6, 0xD8,
-    0x34, 0x57, 0x02, 0x3F, 0x52, 0xE5, 0x7D, 0xE5, 0xEE, 0x7C, 0x8C, 0x5F, 0x68, 0x10, 0x08, 0x27,
-    0xA5, 0xDB, 0xC2, 0x16, 0x36, 0xC4, 0xF9, 0x4A, 0x55, 0x48, 0xD1, 0xAF, 0x54, 0x5C, 0x24, 0xF5,
-    0x62, 0x47, 0xED, 0xFC, 0x11, 0xE8, 0x33, 0x38, 0x2B, 0xC0, 0xE3, 0xA7, 0x4A, 0x58, 0x84, 0xE8,
-    0x46, 0x8F, 0xC0, 0x02, 0x4A, 0x49, 0x02, 0xE4, 0xE9, 0x3A, 0x94, 0x9B, 0xA8, 0x94, 0x45, 0xFD,
-    0x04, 0xEA, 0x34, 0xF4, 0xD6, 0x28, 0x35, 0x6E, 0x7D, 0xAE, 0xCE, 0xBB, 0xDE, 0x7A, 0x4F, 0x27,
-    0xA9, 0xB7, 0x02, 0xF9, 0xED, 0x88, 0x74, 0xAF, 0xFC, 0x54, 0x6F, 0xA9, 0x80, 0xC7, 0xAD, 0x32,
-    0x12, 0xDC, 0x62, 0xBD, 0x94, 0xEE, 0xDB, 0x04, 0x86, 0x01, 0x54, 0x38, 0x6E, 0x29, 0x08, 0xB8,
-    0x65, 0xE8, 0xC7, 0x55, 0x0E, 0xD4, 0x19, 0x4C, 0xD9, 0x3A, 0xB4, 0xF9, 0x51, 0x33, 0xCB, 0x79,
-    0x1B, 0x17, 0x0A, 0x39, 0xD1, 0x61, 0x11, 0xE9, 0xB0, 0xEA, 0xCD, 0x1A, 0x57, 0x9C, 0xF7, 0xE6,
-    0xCE, 0x99, 0x3D, 0xE9, 0x6C, 0x29, 0x7F, 0x7D, 0xA6, 0x9D, 0x67, 0xC2, 0x20, 0x80, 0xB0, 0xF7,
-    0x36, 0xEB, 0x21, 0xC5, 0x31, 0x5E, 0xAE, 0x30, 0xAA, 0x5A, 0x2F, 0xF0, 0x31, 0xF8, 0x16, 0x1F,
-    0xB3, 0xC1, 0x81, 0xBB, 0xD9, 0x66, 0xF2, 0x5F, 0x22, 0x8F, 0xA3, 0xEA, 0xA4, 0xD4, 0xBE, 0x5B,
-    0x76, 0x2B, 0x17, 0x18, 0xC3, 0xC0, 0x8A, 0x19, 0x8B, 0x93, 0x85, 0x70, 0xB4, 0x10, 0xF6, 0x16,
-    0xC2, 0x9E, 0xB7, 0x8A, 0x0E, 0xB7, 0x7A, 0x75, 0x5F, 0x00, 0x86, 0x34, 0xB8, 0x75, 0x5E, 0x05,
-    0xAD, 0xDE, 0xF2, 0xE4, 0x02, 0x6E, 0x79, 0xF2, 0x01, 0x6E, 0xF9, 0xB2, 0x0D, 0x9C, 0x42, 0x7A,
-    0xF2, 0x48, 0x95, 0x02, 0xC2, 0xC8, 0x42, 0x18, 0x5B, 0x08, 0x95, 0x31, 0xB1, 0x77, 0x32, 0x44,
-    0x6B, 0x74, 0x81, 0x08, 0xA1, 0x8D, 0x11, 0x18, 0x73, 0x7A, 0x59, 0x2F, 0x64, 0xC1, 0x9A, 0x8A,
-    0x71, 0xAC, 0x72, 0x9D, 0xB0, 0xB3, 0x81, 0xA0, 0x49, 0xC1, 0x1A, 0xF3, 0x8B, 0xBB, 0x03, 0xDD,
-    0xBC, 0x48, 0x87, 0x16, 0x01, 0x4B, 0xD7, 0xC6, 0x45, 0x9A, 0xE5, 0xA2, 0x32, 0xD0, 0x41, 0x5D,
-    0xF0, 0xA0, 0xB1, 0x3C, 0xFE, 0x16, 0xA5, 0x30, 0x9F, 0x49, 0x4A, 0x6B, 0x16, 0x5C, 0xE4, 0x0B,
-    0x99, 0x9D, 0x4A, 0x36, 0x4D, 0x2F, 0xFD, 0x5E, 0x72, 0x39, 0x7E, 0xFE, 0x01, 0x21, 0xFD, 0xB0,
-    0xC2, 0x0C, 0x8A, 0x00, 0x36, 0xE1, 0x48, 0x83, 0x9C, 0x8F, 0xD1, 0x4A, 0x77, 0xBA, 0xBB, 0xCD,
-    0xE5, 0xAE, 0xB5, 0x27, 0x1C, 0x4B, 0xAA, 0x09, 0x27, 0x02, 0x0A, 0x9B, 0xDC, 0xF2, 0xA7, 0xAC,
-    0x52, 0x66, 0xD9, 0xC7, 0x6F, 0xCC, 0xB3, 0x8E, 0xBA, 0x0A, 0xEA, 0xA2, 0xFC, 0x01, 0x30, 0x53,
-    0xF8, 0x35, 0x5E, 0xEB, 0x33, 0xA3, 0x0E, 0xF5, 0x78, 0x29, 0x63, 0x59, 0x47, 0xEB, 0x58, 0xC3,
-    0x37, 0x0D, 0xED, 0x57, 0x73, 0xCB, 0x5F, 0x8B, 0x2B, 0x8E, 0x8D, 0xD4, 0x37, 0x05, 0xF5, 0x9B,
-    0xBA, 0x35, 0xC3, 0x62, 0x67, 0xE6, 0x37, 0xD8, 0x99, 0xA3, 0x5D, 0xF6, 0x61, 0xC7, 0xCE, 0xEC,
-    0xEC, 0xCE, 0x6C, 0xED, 0xCE, 0x6C, 0xEC, 0xCE, 0xAC, 0xED, 0xCE, 0xAC, 0xEC, 0xCE, 0x3C, 0x6F,
-    0x77, 0xE6, 0x4B, 0x76, 0x67, 0x6E, 0x60, 0x6D, 0x03, 0xBB, 0xEC, 0x5F, 0xB1, 0x33, 0x53, 0xEC,
-    0xCC, 0x64, 0xB0, 0x3B, 0xB3, 0x5D, 0xD9, 0x99, 0x36, 0x06, 0xF8, 0x43, 0x62, 0xE7, 0xF4, 0xDC,
-    0x8D, 0x01, 0x63, 0x81, 0xFA, 0x6E, 0x63, 0xE6, 0xAA, 0x17, 0x35, 0x6F, 0x00, 0xFD, 0x29, 0x5D,
-    0xE1, 0x58, 0x22, 0xA9, 0xB9, 0xC0, 0x08, 0x51, 0xF5, 0x5C, 0x5F, 0x96, 0x34, 0x70, 0x79, 0xB9,
-    0x6E, 0xDF, 0xA2, 0xF1, 0xA5, 0x0A, 0x06, 0x5D, 0xD9, 0x40, 0xF1, 0x69, 0xAD, 0xA7, 0xB7, 0x68,
-    0x6C, 0xED, 0x17, 0xCD, 0x7F, 0xE4, 0x98, 0xA0, 0x55, 0x22, 0xEC, 0xD2, 0x35, 0x95, 0xAA, 0xEE,
-    0xD6, 0x96, 0x0D, 0x83, 0x57, 0xA4, 0xB3, 0xE4, 0x95, 0x7C, 0x77, 0x92, 0xE1, 0x15, 0x1B, 0x7E,
-    0xE5, 0xDB, 0xD6, 0x90, 0x20, 0xFC, 0x97, 0x22, 0xA9, 0x7C, 0x3A, 0x6E, 0x30, 0x3B, 0xD4, 0x4C,
-    0xEB, 0x50, 0xD9, 0x03, 0xCD, 0xA9, 0x2D, 0xCA, 0x0E, 0x07, 0x8C, 0x1A, 0x4D, 0x2D, 0xA2, 0xE5,
-    0xE1, 0x4A, 0x1B, 0xF5, 0xF0, 0xB2, 0xB4, 0xED, 0x40, 0x22, 0x2A, 0x82, 0x92, 0x36, 0x86, 0x42,
-    0xD7, 0x8D, 0x97, 0xA2, 0x9A, 0x44, 0x2E, 0xDD, 0x07, 0x17, 0x84, 0x41, 0xF2, 0x82, 0xA6, 0x63,
-    0x64, 0x55, 0xE2, 0x93, 0xD0, 0x75, 0x5B, 0x5B, 0x9B, 0xFC, 0x8E, 0xB0, 0xB0, 0x39, 0xB0, 0xBE,
-    0xBE, 0x5A, 0x9F, 0xA9, 0x73, 0xF2, 0x6D, 0x32, 0x93, 0x91, 0xEE, 0x16, 0x76, 0xCD, 0x7B, 0x62,
-    0x29, 0x91, 0x4F, 0x51, 0xBC, 0x82, 0xAA, 0x95, 0x6D, 0x15, 0xE0, 0x23, 0x0C, 0x24, 0xBD, 0x12,
-    0x80, 0x24, 0x75, 0xC2, 0xD3, 0xA8, 0x4F, 0x06, 0x78, 0x65, 0xC2, 0xFA, 0x47, 0x96, 0x42, 0x9A,
-    0x95, 0x84, 0xBC, 0xF1, 0x4A, 0x07, 0xDE, 0x54, 0xE3, 0x23, 0x79, 0x24, 0x45, 0x39, 0x1B, 0x0C,
-    0x53, 0x28, 0x7B, 0xB5, 0xCC, 0x75, 0x5F, 0xC2, 0x76, 0x48, 0xFF, 0x0B, 0x53, 0x3F, 0x75, 0x47,
-    0xA7, 0xC5, 0x0D, 0x3C, 0x83, 0x44, 0xEB, 0xE9, 0x3B, 0x8F, 0x9F, 0x93, 0x22, 0xA4, 0xEF, 0x55,
-    0xD0, 0xF6, 0x61, 0xA3, 0x56, 0xB8, 0xBA, 0x8A, 0x00, 0x50, 0xCE, 0x2B, 0x80, 0xEE, 0x88, 0x2D,
-    0xE3, 0x35, 0x81, 0xE2, 0xEA, 0xE6, 0x6B, 0xFB, 0x1C, 0x45, 0x07, 0xDA, 0xED, 0x51, 0xE5, 0x01,
-    0xBF, 0x81, 0xF8, 0x57, 0x7D, 0x16, 0x5D, 0x50, 0x95, 0xD3, 0xA9, 0x70, 0x4F, 0xFC, 0xDA, 0xB8,
-    0xE5, 0x23, 0x77, 0x1E, 0xCE, 0x0D, 0x9B, 0xBD, 0x88, 0x19, 0x62, 0x2F, 0x29, 0x85, 0x75, 0x39,
-    0xB3, 0xF1, 0xB8, 0x5C, 0x3E, 0xDB, 0xFB, 0xAC, 0xD3, 0xF2, 0x9A, 0x84, 0xC1, 0x9A, 0xF0, 0x5D,
-    0x64, 0x0D, 0x5A, 0xF3, 0x20, 0xA1, 0xAA, 0xE8, 0xF7, 0x7B, 0xF4, 0x97, 0x4B, 0x44, 0x84, 0x4E,
-    0xFA, 0xB6, 0xFA, 0xAB, 0x61, 0x30, 0x06, 0x66, 0x6D, 0xCD, 0x72, 0x27, 0xD7, 0xDE, 0xA6, 0xD5,
-    0x09, 0x60, 0x21, 0x4D, 0xF8, 0x76, 0x67, 0x6B, 0x02, 0x0A, 0x5A, 0xAB, 0x0A, 0x41, 0x4B, 0x93,
-    0xF6, 0x5D, 0x84, 0x2B, 0x2E, 0xFF, 0x4C, 0x1C, 0x4B, 0x4A, 0x67, 0x83, 0xFF, 0xFA, 0x42, 0x3C,
-    0x65, 0x01, 0x8C, 0xAD, 0x1B, 0x5A, 0x3B, 0xC3, 0x32, 0x80, 0x0C, 0x62, 0xAF, 0xD2, 0x95, 0xBD,
-    0x6A, 0x13, 0x3B, 0x32, 0xBE, 0xD1, 0x03, 0x99, 0x26, 0x18, 0x93, 0xC6, 0x91, 0xDA, 0x1B, 0x01,
-    0x8F, 0x3A, 0x73, 0x4A, 0x8D, 0xA0, 0x36, 0xA0, 0xB6, 0xC5, 0x62, 0xFC, 0x45, 0xA0, 0x50, 0x24,
-    0x50, 0xB3, 0x46, 0x00, 0x68, 0xD5, 0xA8, 0xE6, 0xB4, 0xFA, 0x42, 0x21, 0x1B, 0xFF, 0x16, 0x05,
-    0x03, 0x62, 0x6B, 0x06, 0x3E, 0xB7, 0x65, 0x03, 0x79, 0x81, 0xCA, 0x81, 0x13, 0x53, 0x21, 0x28,
-    0x39, 0x9E, 0x61, 0x07, 0xD7, 0xEA, 0xE0, 0x9E, 0x06, 0x36, 0xAB, 0x65, 0x2F, 0xED, 0x4E, 0x59,
-    0xEA, 0x1B, 0x4E, 0x81, 0x6A, 0xB1, 0x70, 0x91, 0x2C, 0xEC, 0x19, 0xBD, 0x69, 0x81, 0x0A, 0x6C,
-    0xFA, 0x86, 0xE9, 0xA5, 0x92, 0xC1, 0x21, 0xE8, 0x67, 0x64, 0x0C, 0x6A, 0x04, 0xEA, 0xC0, 0x20,
-    0x1F, 0xE9, 0x73, 0xAC, 0xAF, 0xC0, 0xFB, 0x35, 0xC1, 0xD6, 0x21, 0xE5, 0x13, 0x3A, 0x21, 0x01,
-    0x23, 0x52, 0x00, 0x3A, 0x69, 0xD0, 0x4A, 0x19, 0x41, 0x89, 0x21, 0xBA, 0xA8, 0x18, 0x25, 0x6A,
-    0xD4, 0xA8, 0x37, 0x84, 0xD2, 0x88, 0x29, 0x0C, 0xB4, 0x96, 0xDB, 0x40, 0x4A, 0x34, 0x99, 0x76,
-    0x28, 0x7D, 0x16, 0x9B, 0x67, 0xA5, 0x4D, 0x55, 0x2E, 0xC9, 0xFE, 0x3B, 0x67, 0x33, 0x1E, 0xC3,
-    0x3E, 0x93, 0x04, 0x49, 0x94, 0x1E, 0xB2, 0x52, 0x91, 0x3D, 0xE4, 0xA0, 0xA8, 0xED, 0x1B, 0xFE,
-    0xF7, 0x91, 0x29, 0x11, 0x99, 0x4E, 0x43, 0xEC, 0xB7, 0xF9, 0x1F, 0x30, 0x0B, 0xBB, 0xD2, 0xA7,
-    0xE0, 0x0D, 0x97, 0x79, 0x52, 0x1B, 0xC8, 0x0E, 0xE9, 0x16, 0x1D, 0xB9, 0xAD, 0x28, 0x4C, 0x36,
-    0xB7, 0x4C, 0x29, 0x5A, 0x18, 0x46, 0xA8, 0x15, 0x2D, 0x6C, 0x06, 0x96, 0xE1, 0xB9, 0x4D, 0xB5,
-    0xF3, 0x4C, 0x50, 0x21, 0x6D, 0x1B, 0xA1, 0xAC, 0x76, 0x2A, 0x21, 0x65, 0xB4, 0x75, 0x2A, 0x8E,
-    0x8F, 0xF2, 0xFD, 0xCB, 0x57, 0xFA, 0xD3, 0xB8, 0x8D, 0xDB, 0x05, 0x8D, 0x33, 0xE8, 0xDE, 0x28,
-    0x8A, 0xD4, 0x40, 0x2C, 0x62, 0xE7, 0xBB, 0xED, 0x1D, 0xE0, 0x2B, 0x78, 0xB7, 0x88, 0xBE, 0x61,
-    0x36, 0x01, 0x6B, 0xB6, 0x4B, 0x1B, 0x12, 0x9A, 0xDD, 0x59, 0xE7, 0xD9, 0x94, 0xB1, 0xBD, 0x18,
-    0xE2, 0x49, 0x87, 0x52, 0x81, 0x23, 0x6A, 0xC9, 0xC6, 0x2A, 0x3F, 0x83, 0x46, 0x6D, 0xE0, 0x16,
-    0xB2, 0x1B, 0x05, 0xBA, 0xD8, 0xDF, 0x3A, 0xB5, 0x91, 0x79, 0x62, 0x1B, 0x0E, 0xCC, 0x60, 0x71,
-    0x15, 0xE3, 0x51, 0xED, 0xFD, 0x65, 0x35, 0x1A, 0x75, 0x21, 0x10, 0x30, 0x0C, 0x54, 0xEC, 0xFA,
-    0x08, 0x90, 0xCB, 0x63, 0x40, 0x0E, 0xA7, 0x65, 0xCC, 0x93, 0xAF, 0x4C, 0x1B, 0xDE, 0xAB, 0xAD,
-    0x77, 0x82, 0xB8, 0x45, 0x47, 0x7E, 0x42, 0xBD, 0x88, 0xBB, 0x5C, 0x31, 0x67, 0x0B, 0xFD, 0xB6,
-    0x38, 0xD4, 0x90, 0x55, 0x99, 0xDA, 0x8D, 0x99, 0x5A, 0xCD, 0x5D, 0x32, 0x38, 0x29, 0x7D, 0x01,
-    0xA9, 0x59, 0xCE, 0x55, 0xE8, 0xFF, 0x91, 0x9C, 0xAF, 0x7D, 0x79, 0xBA, 0xF4, 0x87, 0x2C, 0x8D,
-    0x3E, 0x93, 0x7F, 0x47, 0xDC, 0xB1, 0x63, 0x64, 0x02, 0x62, 0x10, 0xF1, 0x76, 0xDA, 0xBA, 0x4C,
-    0xB0, 0x67, 0xBA, 0xC4, 0xEA, 0xAC, 0xE9, 0xC2, 0x98, 0x83, 0x73, 0xC8, 0xFD, 0x2E, 0xCE, 0x7C,
-    0xAD, 0xA4, 0xD1, 0x8F, 0x42, 0xA4, 0xA4, 0xC8, 0x9D, 0x3E, 0x4B, 0xC3, 0x32, 0x33, 0xE7, 0xCC,
-    0xDB, 0x8B, 0x69, 0x9F, 0x42, 0x85, 0xF5, 0xE0, 0x22, 0x12, 0xDE, 0x46, 0x4D, 0x91, 0x47, 0xEF,
-    0x8D, 0xE6, 0x51, 0x55, 0x95, 0x27, 0x68, 0x11, 0xDB, 0x68, 0x93, 0xD2, 0x80, 0x50, 0x4C, 0xF3,
-    0xB6, 0x23, 0x9F, 0x28, 0xD7, 0x3E, 0x5D, 0xF9, 0x7D, 0xF6, 0x45, 0x51, 0x53, 0x91, 0xE0, 0x34,
-    0xD2, 0x89, 0xBB, 0x3A, 0x27, 0xE8, 0x48, 0xA8, 0x06, 0x96, 0x9A, 0xE3, 0xAC, 0x08, 0x0C, 0x0E,
-    0x1A, 0x1D, 0xD5, 0x14, 0x5C, 0x3C, 0xFA, 0x1A, 0xD5, 0xB2, 0x6E, 0x00, 0x7F, 0xF0, 0xFB, 0xB8,
-    0x56, 0x45, 0x96, 0x87, 0x2F, 0x4A, 0x75, 0x6F, 0xC0, 0x12, 0xE6, 0x91, 0xE6, 0x51, 0x40, 0xFF,
-    0xB2, 0x7F, 0xD8, 0x64, 0x5F, 0xF4, 0x26, 0xFB, 0x44, 0xD9, 0x3C, 0x1A, 0x36, 0xBA, 0x84, 0xCA,
-    0xA4, 0xA5, 0x26, 0x46, 0x90, 0x98, 0xC9, 0x84, 0xCA, 0x8A, 0xE3, 0x81, 0xB2, 0x07, 0xD1, 0x4C,
-    0xB8, 0x57, 0x74, 0x6D, 0x7B, 0xF8, 0x8F, 0xEA, 0xD5, 0x7A, 0x88, 0x9F, 0xC3, 0x57, 0x61, 0x1C,
-    0x67, 0xF6, 0x65, 0xEF, 0x26, 0x8B, 0x1B, 0xF3, 0x80, 0x79, 0xD4, 0x0C, 0x5E, 0x8B, 0x2A, 0x3D,
-    0x78, 0xA0, 0x1E, 0xCA, 0x5C, 0xC6, 0x1D, 0x45, 0x7A, 0xB7, 0x89, 0xC5, 0x59, 0x25, 0xC0, 0x78,
-    0x20, 0xBC, 0x4D, 0xFD, 0x79, 0xF9, 0xEA, 0xD3, 0xE3, 0x2F, 0x87, 0xA4, 0x4C, 0x5A, 0xBF, 0x45,
-    0x79, 0x4D, 0xF4, 0x31, 0xE2, 0x8B, 0x99, 0x0B, 0x2F, 0xF6, 0xB5, 0x29, 0x3A, 0x77, 0x83, 0x1A,
-    0x88, 0x9B, 0xB9, 0xBC, 0x36, 0x45, 0xF4, 0x28, 0x6B, 0x64, 0xD8, 0x59, 0x70, 0x61, 0x53, 0x1E,
-    0xDE, 0x94, 0xAD, 0x33, 0x73, 0xC9, 0x0C, 0x99, 0x62, 0xCA, 0x9F, 0x1C, 0x4C, 0xA7, 0xC8, 0xB3,
-    0xD8, 0xEC, 0xCA, 0x94, 0x24, 0x52, 0x53, 0xEB, 0x3D, 0x81, 0xF7, 0x29, 0x9D, 0x33, 0xE5, 0xAD,
-    0x90, 0x2D, 0xC8, 0xEC, 0x19, 0x8D, 0x5D, 0x5F, 0x99, 0x60, 0x92, 0x27, 0xD3, 0xC4, 0x56, 0xA8,
-    0x30, 0x1C, 0x88, 0xC2, 0xF2, 0x7B, 0x6D, 0xB5, 0x19, 0x9E, 0x44, 0x9A, 0x06, 0x96, 0xC7, 0x68,
-    0x73, 0x35, 0x88, 0x81, 0xAC, 0x51, 0xC8, 0x24, 0xE4, 0x20, 0x96, 0x78, 0x3A, 0x02, 0xF5, 0xC2,
-    0xBC, 0xD6, 0x9C, 0x74, 0x1C, 0x76, 0x47, 0x3E, 0x96, 0xD0, 0xB2, 0x20, 0x23, 0xF9, 0x53, 0x76,
-    0xE5, 0x8D, 0x56, 0x08, 0x2D, 0x62, 0xA7, 0xD9, 0x13, 0x95, 0x7A, 0x90, 0xFD, 0x41, 0x44, 0x57,
-    0x4F, 0x7F, 0x57, 0x68, 0xED, 0xE5, 0xFB, 0xAC, 0x82, 0x11, 0x5A, 0x85, 0x8B, 0x68, 0x3E, 0xC2,
-    0xE7, 0xE0, 0x66, 0x5A, 0xF0, 0xE6, 0x48, 0x94, 0x7B, 0xFD, 0x73, 0x26, 0x6E, 0xEA, 0x29, 0xC1,
-    0x06, 0x0D, 0x17, 0xDA, 0x3A, 0x8E, 0xFA, 0xEB, 0xB1, 0xF3, 0xE7, 0xE4, 0xDC, 0xF0, 0x2C, 0x8A,
-    0xF4, 0x20, 0x37, 0x58, 0x21, 0xB3, 0xFE, 0x1D, 0xB8, 0xC9, 0x39, 0x2B, 0x5B, 0x74, 0x6E, 0x7B,
-    0xDA, 0xF0, 0xF5, 0x77, 0xE1, 0xA6, 0x9B, 0x61, 0x0D, 0xDD, 0xCA, 0xA5, 0xDE, 0x71, 0x36, 0x86,
-    0x93, 0xDF, 0xC4, 0x1A, 0x73, 0x85, 0x53, 0x1F, 0xD8, 0x33, 0x7F, 0x9D, 0xCD, 0xB7, 0x42, 0xEB,
-    0x74, 0x3C, 0x34, 0x13, 0xB8, 0x83, 0xB9, 0xD1, 0x8F, 0xCF, 0xA3, 0x4D, 0x92, 0x51, 0xC4, 0x7E,
-    0xCE, 0x83, 0x08, 0x1D, 0xAD, 0x76, 0x86, 0x88, 0x0C, 0x4A, 0xD3, 0x6E, 0xE7, 0x17, 0x20, 0x14,
-    0x41, 0x36, 0x12, 0xA5, 0x62, 0xFC, 0x1B, 0x26, 0x2F, 0x89, 0x6C, 0x48, 0x2B, 0x84, 0x87, 0xF9,
-    0xA6, 0x32, 0x5F, 0xB0, 0xF9, 0x0F, 0xC0, 0xBB, 0x17, 0x1A, 0x5E, 0x57, 0x68, 0xBF, 0x80, 0xB4,
-    0x7A, 0xC0, 0xC6, 0x95, 0xEE, 0xD9, 0x15, 0x63, 0xA0, 0x3D, 0xD7, 0xDC, 0x07, 0xB9, 0xEA, 0x21,
-    0xDB, 0xA7, 0xA2, 0x10, 0xC9, 0xED, 0x18, 0x79, 0x6D, 0xF7, 0xDB, 0x7F, 0x6C, 0xF9, 0xF1, 0xF7,
-    0x85, 0xB5, 0xA5, 0x2E, 0x29, 0x17, 0x6D, 0x23, 0x69, 0x8B, 0xD3, 0x15, 0xCE, 0x49, 0x9E, 0x41,
-    0x39, 0xB5, 0xB5, 0xB9, 0x84, 0x97, 0x95, 0x69, 0xE6, 0xE0, 0xD6, 0xD6, 0xF7, 0x10, 0xDE, 0xA3,
-    0xA0, 0xDA, 0x9D, 0x6A, 0x59, 0xE9, 0x5E, 0xAD, 0x9F, 0xD8, 0x23, 0x4C, 0xE7, 0xEA, 0x60, 0x2F,
-    0xA7, 0x98, 0xB2, 0x95, 0x06, 0x24, 0xB5, 0x60, 0xD4, 0x6B, 0x2A, 0x10, 0x76, 0x4E, 0x7C, 0xAF,
-    0x00, 0x3E, 0x80, 0x63, 0x77, 0x4E, 0x63, 0xDE, 0x84, 0xD1, 0x10, 0xCF, 0x51, 0x88, 0x90, 0x73,
-    0xB9, 0xAF, 0xDB, 0x2B, 0xFE, 0x9D, 0xAA, 0xA2, 0x32, 0x9B, 0xEA, 0xDF, 0xA6, 0xF2, 0x6A, 0x70,
-    0x76, 0xD4, 0x3C, 0x0A, 0xEB, 0x55, 0xBF, 0x1C, 0xA3, 0x56, 0xDB, 0x5E, 0xA9, 0x4A, 0x71, 0x96,
-    0x01, 0x2C, 0xC5, 0x5A, 0x85, 0xD9, 0x97, 0x82, 0x64, 0xB8, 0x24, 0x90, 0x5A, 0x92, 0xC7, 0x77,
-    0x00, 0xEB, 0xE9, 0x4B, 0x38, 0xD0, 0xEA, 0xB7, 0x59, 0xAF, 0x40, 0x2E, 0x6D, 0xF0, 0xEC, 0x1D,
-    0x23, 0x8D, 0x36, 0x1D, 0xEC, 0xDA, 0x2D, 0x08, 0x0B, 0x73, 0xAA, 0x57, 0xB0, 0x45, 0x2A, 0xDE,
-    0x35, 0x5C, 0x7E, 0x0E, 0xAA, 0x25, 0x28, 0xDF, 0xD1, 0x8F, 0xEF, 0x04, 0x38, 0xEE, 0xF0, 0x05,
-    0xA6, 0x1D, 0xD3, 0x19, 0xFB, 0x75, 0xBA, 0x07, 0xE0, 0xFF, 0x88, 0x05, 0x18, 0x41, 0x1E, 0xB1,
-    0xB2, 0x99, 0x09, 0x96, 0x02, 0xF5, 0x11, 0x26, 0x6A, 0x91, 0x88, 0xF3, 0x7B, 0x3A, 0xA2, 0xE7,
-    0x18, 0xCB, 0x77, 0xED, 0x61, 0xE4, 0x95, 0x9F, 0xFD, 0x0D, 0xFE, 0x21, 0x9C, 0x32, 0xF5, 0x2B,
-    0x80, 0x2D, 0x38, 0x3D, 0x11, 0xFE, 0x01, 0xBE, 0x4F, 0x0F, 0x93, 0x24, 0x79, 0xBC, 0x81, 0x8D,
-    0x78, 0x0E, 0x45, 0x7A, 0x7E, 0xBE, 0x27, 0x9C, 0xBF, 0x77, 0xD8, 0x35, 0x2A, 0xA7, 0x2E, 0x6F,
-    0x8C, 0xAB, 0xD8, 0xF1, 0x0C, 0x90, 0xC5, 0xEE, 0x67, 0xFD, 0xB2, 0x18, 0x7B, 0x4A, 0x72, 0x4D,
-    0xE9, 0xB7, 0x70, 0x24, 0xAC, 0xD6, 0x0E, 0x75, 0x25, 0xBF, 0x6B, 0x90, 0x65, 0x3D, 0x76, 0x3C,
-    0x87, 0x8D, 0x53, 0x33, 0x9D, 0x97, 0xA7, 0x13, 0x64, 0x82, 0x11, 0x6C, 0xCC, 0x13, 0xF1, 0xCB,
-    0x33, 0xF3, 0x66, 0x59, 0x94, 0x96, 0xCC, 0x55, 0xAC, 0x53, 0x9E, 0x62, 0x91, 0x87, 0x5B, 0xE4,
-    0xE5, 0x60, 0x30, 0x87, 0x36, 0xC6, 0xE4, 0xE6, 0x4E, 0x7A, 0x43, 0xC5, 0x09, 0xED, 0x7A, 0xF0,
-    0xB4, 0x43, 0xDB, 0xA8, 0x0E, 0x70, 0xAA, 0xB7, 0x29, 0x78, 0x0C, 0x36, 0x44, 0x5B, 0x22, 0x58,
-    0xA7, 0xBB, 0x45, 0x4D, 0x1B, 0xE4, 0xB2, 0x1A, 0x54, 0x70, 0xC7, 0xAC, 0x42, 0xF7, 0xD4, 0x03,
-    0x43, 0xE4, 0x0F, 0x11, 0x3D, 0x64, 0xEF, 0x68, 0x4D, 0x39, 0x08, 0x6B, 0x96, 0xAC, 0x92, 0x62,
-    0xB6, 0xCE, 0x14, 0x75, 0x72, 0xB1, 0xE3, 0x21, 0x9F, 0x3E, 0xFC, 0x58, 0x60, 0xB9, 0x7B, 0xA2,
-    0xCE, 0xDB, 0xBB, 0xFC, 0x3B, 0x00, 0x17, 0xFA, 0xA8, 0xC3, 0x4C, 0xA3, 0x6E, 0xF4, 0x24, 0x61,
-    0x7C, 0x3E, 0x31, 0xF2, 0x21, 0x24, 0x63, 0xB1, 0x5D, 0x46, 0xD7, 0x5A, 0x7B, 0xE8, 0xD8, 0x9B,
-    0x4A, 0xA1, 0x5A, 0x63, 0x23, 0x3B, 0x05, 0x72, 0x3C, 0x98, 0x0C, 0x63, 0x24, 0xE5, 0x64, 0x08,
-    0xDA, 0xBF, 0x5D, 0x81, 0xA2, 0xA3, 0x76, 0xD7, 0x0C, 0x8F, 0xDA, 0x89, 0x7B, 0x93, 0x5D, 0x66,
-    0xC5, 0xEC, 0x5C, 0x0A, 0xE8, 0x35, 0x36, 0x5A, 0x34, 0xB0, 0x94, 0x1D, 0x87, 0xAC, 0xCD, 0x57,
-    0xFD, 0x24, 0xD2, 0x84, 0x75, 0xC8, 0xFC, 0xA5, 0x38, 0xA8, 0x36, 0x4B, 0x63, 0x5D, 0x60, 0x5D,
-    0x06, 0x14, 0x61, 0xA0, 0x66, 0x3B, 0xE9, 0x90, 0x7E, 0x52, 0x1E, 0x29, 0x13, 0x9C, 0xC8, 0x95,
-    0x5E, 0x9D, 0x87, 0x00, 0xC5, 0x40, 0x3A, 0xC9, 0xEC, 0xA3, 0x2F, 0x46, 0xF5, 0x35, 0xBD, 0x31,
-    0x0E, 0x3F, 0xD3, 0xE9, 0xC4, 0x9F, 0x37, 0xB2, 0x51, 0x2A, 0x63, 0xBE, 0x10, 0x60, 0x9A, 0x28,
-    0x18, 0x12, 0x4E, 0xCD, 0xB3, 0x35, 0x68, 0x79, 0x3C, 0x2C, 0xF3, 0x73, 0x8E, 0x2C, 0xF2, 0x7D,
-    0x36, 0x4A, 0xCD, 0xA9, 0xDA, 0xE3, 0x66, 0x19, 0xC9, 0x1F, 0xC1, 0x1F, 0x5E, 0x87, 0x70, 0x08,
-    0x6A, 0x01, 0x91, 0xCB, 0xDC, 0xB5, 0xDC, 0x19, 0xA2, 0xAB, 0x83, 0x2D, 0x92, 0x4B, 0xA4, 0xF5,
-    0xF1, 0xAF, 0x54, 0xB6, 0x72, 0x70, 0x38, 0x12, 0xA0, 0xE0, 0x0C, 0x43, 0xD6, 0x62, 0x85, 0xE2,
-    0x1E, 0x21, 0xB1, 0x70, 0x40, 0x58, 0xCE, 0x97, 0x98, 0xEB, 0x92, 0xE5, 0x73, 0xA1, 0xFC, 0x94,
-    0x3D, 0x49, 0xFA, 0xE5, 0x9F, 0x90, 0xF8, 0xDA, 0x76, 0xD6, 0xC4, 0x80, 0xDD, 0xB6, 0xE6, 0xA8,
-    0x99, 0xF3, 0x5D, 0x0E, 0x57, 0x2D, 0x29, 0x50, 0xDF, 0x08, 0x09, 0xE6, 0xF4, 0x48, 0xB7, 0x26,
-    0xE6, 0xD8, 0xF5, 0xE8, 0x67, 0x48, 0x87, 0x7E, 0x8C, 0x93, 0xF4, 0x3A, 0x85, 0x5C, 0xDD, 0xB3,
-    0x44, 0x77, 0x55, 0xA9, 0x16, 0x08, 0x92, 0x84, 0x64, 0xBF, 0xA2, 0x8E, 0xB0, 0xFD, 0x5D, 0x56,
-    0x2D, 0x22, 0x1C, 0x24, 0x8F, 0x63, 0x1E, 0x1D, 0x81, 0xBD, 0x58, 0xCF, 0x7F, 0x95, 0x23, 0xB6,
-    0xD6, 0x64, 0x63, 0xE6, 0x9A, 0xCA, 0xAC, 0x5A, 0x38, 0x95, 0x36, 0xF4, 0x87, 0x5B, 0x1B, 0xFD,
-    0x5C, 0x9B, 0x92, 0xC1, 0xB3, 0xF0, 0x2C, 0xE1, 0xB6, 0xB8, 0xC1, 0x49, 0x0F, 0x30, 0x8C, 0x89,
-    0xF0, 0x44, 0xD4, 0x31, 0x6B, 0x81, 0x13, 0x15, 0xC8, 0x94, 0x54, 0xE6, 0x46, 0x94, 0xEF, 0x1F,
-    0xE8, 0xF9, 0x67, 0x35, 0x58, 0x43, 0x67, 0xB3, 0xB6, 0x3D, 0xA5, 0x1B, 0x32, 0xDC, 0xE9, 0xEE,
-    0x1A, 0x3A, 0x98, 0x59, 0x48, 0x8F, 0x4B, 0x8B, 0xE8, 0x7C, 0x17, 0x5D, 0x59, 0x97, 0x26, 0x52,
-    0x91, 0x5B, 0x47, 0xA8, 0x75, 0x0E, 0x53, 0x82, 0x17, 0x0D, 0x33, 0x41, 0xB6, 0x68, 0xB1, 0x9A,
-    0xEA, 0x73, 0x78, 0xB2, 0x82, 0x3C, 0xCC, 0xF2, 0x5B, 0xBD, 0xF9, 0x0B, 0x6C, 0xD5, 0x3E, 0x90,
-    0xDC, 0x19, 0x50, 0x41, 0xDA, 0x27, 0xC3, 0xFA, 0x53, 0x3D, 0xF3, 0xA8, 0x09, 0xBB, 0x5F, 0xA9,
-    0x38, 0xBB, 0x77, 0xAA, 0x33, 0x81, 0x2C, 0x04, 0x2A, 0xEE, 0x38, 0x45, 0x8A, 0x5F, 0x98, 0x6B,
-    0x25, 0x77, 0xEC, 0x4A, 0x4B, 0x20, 0xB2, 0x2A, 0xBF, 0xE9, 0x95, 0x1F, 0x9E, 0x47, 0x4A, 0x96,
-    0x0E, 0x22, 0x8B, 0x1F, 0x1B, 0x7B, 0xF8, 0x87, 0x47, 0x13, 0x5B, 0x37, 0x4D, 0x3A, 0xB7, 0x51,
-    0x7A, 0x7B, 0x55, 0x47, 0x05, 0x26, 0x07, 0x8F, 0xB0, 0xCE, 0x96, 0x63, 0x9B, 0x59, 0xFC, 0xBA,
-    0xB6, 0xF8, 0x2A, 0x9F, 0xD5, 0xC1, 0x78, 0x23, 0xC9, 0xB9, 0x37, 0x00, 0xB9, 0xD3, 0xA9, 0x09,
-    0x0A, 0x07, 0x32, 0x5E, 0x7B, 0xDD, 0xB1, 0x2D, 0x1A, 0xCB, 0x48, 0x46, 0x35, 0x19, 0x5E, 0x2E,
-    0xE3, 0xDE, 0xAF, 0x54, 0x69, 0x32, 0x03, 0x07, 0xA3, 0x2D, 0x14, 0xCB, 0xFE, 0x3E, 0xE3, 0xCF,
-    0xE9, 0x8F, 0x21, 0x72, 0x40, 0xF5, 0x79, 0xDD, 0x50, 0xCD, 0x34, 0xE8, 0xE8, 0x5B, 0x4B, 0x9B,
-    0xA5, 0x97, 0x3F, 0x31, 0x8C, 0x8D, 0x19, 0x0A, 0xF1, 0xE4, 0x3F, 0x9A, 0x49, 0x82, 0x5A, 0x1F,
-    0xFC, 0xDC, 0xFE, 0x60, 0x1C, 0xFD, 0x79, 0xDB, 0xA8, 0x58, 0x50, 0x7D, 0x1A, 0x42, 0xAE, 0xE3,
-    0x68, 0x6B, 0x24, 0x53, 0xD5, 0x44, 0x94, 0xDF, 0x51, 0xC6, 0xD9, 0xD8, 0xC4, 0x7E, 0x43, 0x1E,
-    0x52, 0x55, 0xFD, 0xF6, 0xA0, 0xF2, 0x3F, 0x33, 0x45, 0xE5, 0xF3, 0xEF, 0x6C, 0x84, 0xFD, 0x54,
-    0xB5, 0xBB, 0x58, 0xB0, 0x9B, 0xBF, 0x10, 0xCB, 0x69, 0xFE, 0xB9, 0x28, 0xC6, 0x12, 0xFF, 0x1F,
-    0x6D, 0x91, 0x3F, 0x6F, 0x13, 0x31, 0x18, 0xC6, 0x9F, 0xBB, 0x4B, 0x73, 0xC3, 0x09, 0x39, 0x4B,
-    0x25, 0x54, 0xA9, 0x1C, 0x03, 0x43, 0x15, 0x85, 0x7A, 0x65, 0x68, 0x6B, 0xB7, 0x0B, 0x43, 0x87,
-    0x2E, 0x61, 0xEE, 0x37, 0x40, 0x7C, 0x80, 0x5E, 0x9C, 0x96, 0x81, 0x81, 0x85, 0x8F, 0xC0, 0xC0,
-    0x00, 0x5D, 0x58, 0x19, 0x1A, 0xEE, 0xD2, 0x0C, 0x1D, 0x71, 0x14, 0xA1, 0x0E, 0x2C, 0x37, 0xB0,
-    0x31, 0xE0, 0x20, 0x23, 0x59, 0xAA, 0xFF, 0xE0, 0xB4, 0x42, 0x62, 0xC0, 0xB2, 0x3C, 0x3C, 0x7A,
-    0xDF, 0xE7, 0xF5, 0xFB, 0xFC, 0x3A, 0xD0, 0x85, 0xA2, 0x8A, 0x29, 0xDA, 0x96, 0xCD, 0x3D, 0x20,
-    0x41, 0x45, 0x96, 0x81, 0x7D, 0xD3, 0x2E, 0xE3, 0x00, 0x36, 0x80, 0x30, 0x4E, 0x83, 0xCC, 0x6F,
-    0x14, 0x59, 0x58, 0x3A, 0x76, 0x0C, 0x3B, 0x51, 0x2E, 0xE4, 0x23, 0x66, 0x76, 0x45, 0x70, 0x23,
-    0x61, 0x77, 0x88, 0x8E, 0x4A, 0xFF, 0xFC, 0x83, 0x08, 0xBE, 0x0E, 0x6E, 0xFD, 0xD9, 0xB0, 0x83,
-    0xCE, 0x2E, 0x36, 0xC5, 0xB8, 0x62, 0xC1, 0x96, 0x41, 0xA5, 0x9E, 0x6F, 0x3C, 0x75, 0xF5, 0x0F,
-    0xCF, 0x9A, 0x95, 0xA5, 0xD8, 0x77, 0x61, 0x16, 0xE2, 0xAD, 0x0F, 0x5C, 0x07, 0xBD, 0xAE, 0xCB,
-    0x82, 0x15, 0xC7, 0xD7, 0xF2, 0xF3, 0x80, 0xC8, 0xD4, 0x64, 0x1E, 0x0C, 0x49, 0x1B, 0xEB, 0x30,
-    0x44, 0xAD, 0xE8, 0xC7, 0x99, 0xBC, 0xA8, 0xF2, 0x6B, 0x79, 0xC2, 0x8E, 0xA7, 0xD1, 0xEA, 0x3B,
-    0x3A, 0xE0, 0x7B, 0xF9, 0xDC, 0xB2, 0x2F, 0x4B, 0x2F, 0x0E, 0x7F, 0x19, 0x76, 0x34, 0x35, 0x8F,
-    0xB3, 0x06, 0xB7, 0x67, 0x80, 0x8B, 0x3A, 0xB1, 0xEC, 0xA5, 0x2A, 0x7F, 0xCA, 0x22, 0x34, 0x69,
-    0x00, 0x26, 0xB1, 0x61, 0x5F, 0x53, 0xA2, 0x1C, 0x5D, 0x58, 0xF6, 0x4A, 0x8B, 0xA2, 0x9D, 0x90,
-    0x46, 0x3D, 0x88, 0xD5, 0x49, 0x3D, 0x26, 0xC1, 0xC4, 0x3F, 0x56, 0xA9, 0x7B, 0x81, 0x93, 0x1E,
-    0x7A, 0x40, 0x55, 0xCE, 0x8C, 0x28, 0x54, 0x28, 0x8C, 0x98, 0xBE, 0x2D, 0xDA, 0x5A, 0x86, 0x53,
-    0x9F, 0x6B, 0xDA, 0x38, 0xD2, 0x6E, 0x83, 0x9E, 0x86, 0xD7, 0x96, 0x4A, 0xC1, 0x7D, 0x62, 0x53,
-    0x9B, 0xB6, 0x3D, 0x72, 0xB5, 0xB4, 0x23, 0x7A, 0x78, 0x29, 0x1F, 0x02, 0xA9, 0xA1, 0x73, 0x47,
-    0xAF, 0xF4, 0xA4, 0x88, 0xD6, 0x6B, 0x99, 0x8D, 0xFB, 0x8A, 0xF9, 0x3B, 0xC6, 0xFF, 0x2E, 0x7B,
-    0xE6, 0xD7, 0x31, 0x4C, 0x78, 0x69, 0x46, 0x93, 0x4F, 0x7B, 0x66, 0x7B, 0x52, 0x31, 0xD3, 0x7D,
-    0x93, 0x70, 0xD6, 0x84, 0x83, 0x38, 0x81, 0x5D, 0xDA, 0x2E, 0x5F, 0xE3, 0x54, 0xD3, 0x95, 0xB3,
-    0xCD, 0x15, 0x95, 0x1B, 0xAB, 0x9C, 0x5B, 0x3A, 0x16, 0xA8, 0x51, 0x7F, 0x65, 0xBE, 0x30, 0x51,
-    0x20, 0x0B, 0xED, 0xD8, 0x51, 0x7C, 0xFA, 0xC0, 0x73, 0x24, 0xA1, 0xC9, 0x82, 0x22, 0x37, 0x96,
-    0x4E, 0xBD, 0xC0, 0x68, 0x0B, 0xF7, 0xFF, 0x8D, 0x9E, 0xDE, 0x46, 0x1F, 0x9B, 0xCA, 0xF6, 0x09,
-    0xB3, 0x55, 0xA4, 0x55, 0x31, 0x3B, 0x28, 0x54, 0x54, 0x22, 0xA4, 0x3B, 0x5A, 0xFD, 0xF3, 0xF7,
-    0xFF, 0x8B, 0x81, 0x23, 0x6B, 0x91, 0x6B, 0x44, 0xB4, 0xB4, 0x05, 0x6B, 0x20, 0x80, 0xAD, 0x98,
-    0x64, 0x4F, 0x9C, 0xF9, 0xBB, 0x7D, 0x22, 0xC5, 0x15, 0x75, 0xEE, 0x32, 0x4D, 0x7E, 0xD3, 0x98,
-    0x0A, 0xF0, 0x07, 0xE5, 0x7D, 0x3D, 0xB0, 0x1D, 0xD7, 0x7D, 0xDF, 0xD9, 0x7B, 0x89, 0xB7, 0x11,
-    0x77, 0xC6, 0xCB, 0x82, 0x50, 0x2C, 0x72, 0x92, 0x75, 0xA1, 0x42, 0x89, 0x13, 0x6D, 0xEB, 0x2A,
-    0x7B, 0x41, 0x8E, 0x87, 0x99, 0x51, 0x01, 0x14, 0x78, 0x51, 0x46, 0xF4, 0x0C, 0x52, 0x28, 0x33,
-    0xB1, 0x34, 0x09, 0x52, 0xB8, 0x70, 0x41, 0x6B, 0x2F, 0x85, 0xF1, 0xA8, 0x60, 0x41, 0x14, 0x64,
-    0xE2, 0xB1, 0x0B, 0xA1, 0xA0, 0x66, 0x0C, 0xA0, 0x40, 0xE3, 0xC2, 0x85, 0xC2, 0xBD, 0x20, 0x0A,
-    0x16, 0x2C, 0xB8, 0x94, 0x22, 0xB3, 0x60, 0xC1, 0x6B, 0x1B, 0x14, 0x6D, 0xB0, 0xC0, 0x4A, 0x5C,
-    0x9A, 0xFB, 0x1E, 0x76, 0xF7, 0xE4, 0xF7, 0xFB, 0xFD, 0xCF, 0xDE, 0x7B, 0x1F, 0x08, 0xF0, 0x4B,
-    0x80, 0x08, 0xC5, 0x77, 0xDE, 0xDB, 0xBB, 0x9F, 0x67, 0xCF, 0xF9, 0x9F, 0xFF, 0xF7, 0xC7, 0xB9,
-    0xEE, 0x5F, 0x38, 0x7C, 0x8A, 0x05, 0x36, 0xE5, 0x9A, 0x7B, 0x03, 0x36, 0x99, 0xC7, 0x71, 0x54,
-    0x2D, 0xB1, 0x1B, 0xB9, 0x9D, 0x4F, 0xE5, 0xBD, 0xEF, 0x3C, 0x37, 0xDC, 0xEB, 0xE7, 0xFE, 0xC5,
-    0xCB, 0xD8, 0x2C, 0x66, 0xDC, 0x44, 0x1D, 0x36, 0xAE, 0xE1, 0xC6, 0x85, 0xCD, 0xF2, 0x38, 0x36,
-    0xDE, 0x2F, 0x36, 0x1B, 0x9E, 0xDB, 0x5C, 0x0D, 0x1B, 0x3D, 0x36, 0xB5, 0xF2, 0xE2, 0xD3, 0x7D,
-    0xC6, 0x96, 0x37, 0x2F, 0x6A, 0xDD, 0xA3, 0xEE, 0x94, 0x73, 0xFE, 0xC9, 0xD1, 0x45, 0xFE, 0x9C,
-    0xB7, 0x8D, 0xF3, 0xB3, 0xC1, 0xDD, 0xF6, 0xF9, 0x02, 0xBA, 0x56, 0x58, 0x07, 0xB9, 0xF5, 0xF5,
-    0x5C, 0x5F, 0x2E, 0x3D, 0x3C, 0x3B, 0x7C, 0xB7, 0x77, 0xC5, 0xAA, 0x6C, 0x92, 0xC6, 0x8D, 0x91,
-    0x5F, 0xE5, 0xAB, 0x59, 0x1B, 0x7B, 0xF7, 0xB2, 0x8B, 0x16, 0x59, 0xCF, 0xB1, 0xB8, 0xB2, 0x61,
-    0x87, 0x23, 0x7F, 0xF5, 0x34, 0xBE, 0x62, 0x3C, 0xB5, 0x24, 0xC4, 0xD1, 0x06, 0x2E, 0xE1, 0x6B,
-    0x85, 0x4B, 0x75, 0x86, 0x2F, 0x3C, 0x95, 0xA2, 0x03, 0x78, 0x2A, 0x1D, 0xF5, 0x54, 0xDE, 0xE3,
-    0xD2, 0xCA, 0x55, 0x0D, 0x2F, 0x71, 0x0F, 0x97, 0xB0, 0x87, 0x26, 0x5C, 0xD6, 0x01, 0x02, 0xA3,
-    0xAB, 0xD6, 0x33, 0x74, 0x69, 0xEE, 0x05, 0x92, 0xB4, 0xD7, 0x17, 0xDB, 0x75, 0x2E, 0xF1, 0xF6,
-    0xD2, 0xC6, 0xDE, 0xE9, 0x34, 0xCB, 0xBA, 0xF2, 0xD8, 0x4B, 0xBA, 0xED, 0x3C, 0xCF, 0xAC, 0x9C,
-    0x9B, 0x71, 0xF4, 0xC4, 0x82, 0x98, 0x97, 0xF3, 0xEB, 0x38, 0xFD, 0xC8, 0x0E, 0x9C, 0x67, 0x1C,
-    0xE6, 0xDB, 0xDC, 0x9C, 0x35, 0x38, 0xDF, 0xB8, 0xD2, 0xA4, 0x03, 0x06, 0x5C, 0xB4, 0xAE, 0xC2,
-    0xBB, 0x04, 0xF0, 0xB8, 0xC6, 0xA9, 0x87, 0x1C, 0x4E, 0xD9, 0xEB, 0x05, 0xD1, 0x94, 0x73, 0xF6,
-    0xF1, 0xA7, 0x96, 0x84, 0x40, 0x8B, 0xBE, 0xA2, 0x9B, 0x85, 0xE0, 0xE2, 0x8E, 0xBD, 0xA0, 0xC9,
-    0xED, 0xD0, 0x75, 0x40, 0x88, 0x6F, 0xEF, 0x66, 0x7E, 0x1D, 0x13, 0xB2, 0xAE, 0x5C, 0x62, 0x93,
-    0xAE, 0x81, 0xB7, 0xF3, 0x96, 0xAD, 0x74, 0x1A, 0x71, 0xEC, 0x35, 0x50, 0x02, 0xB2, 0x62, 0x43,
-    0x39, 0xBA, 0x69, 0xC3, 0x9F, 0xE1, 0x14, 0xDE, 0xC0, 0xF7, 0x11, 0xA2, 0xE9, 0x9C, 0x40, 0x6E,
-    0xAA, 0xDE, 0xCD, 0x87, 0xD4, 0xD7, 0x78, 0x8E, 0xC3, 0x5A, 0xA5, 0x7A, 0x14, 0x33, 0x81, 0x0E,
-    0x7E, 0x8B, 0x6F, 0x8F, 0xFE, 0x70, 0xC1, 0xF9, 0x59, 0xA0, 0xA1, 0x86, 0x8D, 0xA1, 0xD7, 0x3E,
-    0x19, 0x5C, 0x7E, 0xCD, 0xBB, 0xA4, 0xF1, 0x75, 0xD4, 0x16, 0x3D, 0xE1, 0xBB, 0xE6, 0x4B, 0x97,
-    0x78, 0xDD, 0x48, 0x20, 0xB5, 0x7A, 0x04, 0xCD, 0x00, 0xE0, 0xD5, 0xF8, 0x18, 0x7A, 0xF5, 0x3C,
-    0x1A, 0x7D, 0x17, 0xA7, 0x0F, 0xF0, 0xD8, 0x50, 0x36, 0xB1, 0xE7, 0x8B, 0x9E, 0x24, 0xFE, 0x95,
-    0x78, 0x44, 0xAF, 0xC2, 0x14, 0x7A, 0x3F, 0x60, 0xB4, 0x00, 0xC5, 0x67, 0xFD, 0xCB, 0xF8, 0x20,
-    0x1F, 0x3F, 0xE6, 0x8E, 0xCD, 0x87, 0xA4, 0x2B, 0x1A, 0x7F, 0xCD, 0xA7, 0x7D, 0x5E, 0x57, 0x8B,
-    0xED, 0xEC, 0xA1, 0xFB, 0xE7, 0xD0, 0x37, 0xF6, 0x91, 0x10, 0x40, 0x9F, 0x3F, 0xCF, 0x17, 0xF0,
-    0xE7, 0x09, 0xCC, 0x43, 0x61, 0xA4, 0xD3, 0x62, 0x1C, 0x75, 0x81, 0x16, 0x39, 0xA5, 0x9C, 0x51,
-    0x4E, 0x05, 0xE6, 0xF3, 0xB3, 0x1F, 0x02, 0x8C, 0x45, 0x23, 0xC4, 0x4E, 0x46, 0x5D, 0xE1, 0x04,
-    0x61, 0x7A, 0x88, 0xA8, 0xC4, 0xC8, 0xAF, 0x73, 0x24, 0xA2, 0x3A, 0x67, 0xA4, 0xE2, 0xC3, 0xB1,
-    0xB8, 0x81, 0xFF, 0x4F, 0x9A, 0x5E, 0x37, 0xBA, 0x8F, 0xFD, 0x8E, 0x86, 0xED, 0xF7, 0x0D, 0x20,
-    0x7D, 0xD4, 0x73, 0xDA, 0x17, 0x6E, 0xA6, 0xEF, 0xC6, 0xCD, 0xF1, 0x7D, 0x03, 0xF8, 0x36, 0xEF,
-    0x70, 0x1F, 0x28, 0x2E, 0x06, 0x85, 0xAF, 0x30, 0xE8, 0x84, 0xDF, 0x31, 0xE0, 0xD6, 0xD8, 0x77,
-    0xB6, 0xC6, 0x77, 0x32, 0xFC, 0x5E, 0xB1, 0xC2, 0x77, 0xD6, 0x17, 0x68, 0xD4, 0xBF, 0x51, 0x75,
-    0xA5, 0x77, 0x8F, 0xB3, 0x9D, 0x72, 0x50, 0x0F, 0x97, 0x24, 0x0B, 0xEF, 0xAF, 0xBB, 0xBD, 0xC5,
-    0xC4, 0xA7, 0x86, 0x84, 0xA4, 0x5E, 0x68, 0xEE, 0x1B, 0xE2, 0xFA, 0xA2, 0x02, 0xB6, 0x18, 0x78,
-    0x03, 0x61, 0x4C, 0x24, 0x31, 0xD1, 0xC7, 0x86, 0x58, 0x8E, 0xDE, 0xF0, 0xCE, 0xFE, 0x99, 0xF1,
-    0x74, 0x80, 0x08, 0x60, 0x90, 0xEA, 0xDB, 0x37, 0xC6, 0x8A, 0x00, 0x1C, 0xCE, 0xD6, 0x00, 0x32,
-    0xB6, 0x16, 0xF2, 0xCE, 0x5A, 0x88, 0x7D, 0x68, 0xC1, 0xAF, 0xEC, 0x15, 0x65, 0x63, 0x37, 0x14,
-    0xAD, 0xFA, 0xF0, 0x46, 0x09, 0x46, 0xD7, 0x91, 0xD2, 0x86, 0xDC, 0x10, 0x74, 0xE0, 0x0C, 0x7B,
-    0x8E, 0x62, 0xFA, 0x04, 0xD6, 0x67, 0x6F, 0x5A, 0xD8, 0x21, 0x40, 0x37, 0xFE, 0x85, 0xFF, 0x16,
-    0xE6, 0x24, 0x70, 0xBF, 0x79, 0x07, 0x92, 0xAA, 0x80, 0x74, 0x0B, 0x1C, 0x42, 0xB6, 0x9C, 0xC2,
-    0xE1, 0xA3, 0x6E, 0xC3, 0x00, 0x81, 0x46, 0xD1, 0x69, 0x1D, 0xDE, 0x22, 0xFE, 0x8B, 0x13, 0xF6,
-    0x61, 0x62, 0xD7, 0x3C, 0x3C, 0x9F, 0x7B, 0xBB, 0x99, 0x14, 0x1B, 0x7B, 0x83, 0x02, 0x0E, 0x8B,
-    0x4E, 0x87, 0x33, 0xB1, 0x0B, 0xD0, 0xF7, 0xF6, 0x10, 0x4D, 0x80, 0x06, 0x57, 0xE8, 0x7B, 0x47,
-    0x9A, 0x42, 0xF7, 0x9F, 0x12, 0x5B, 0x75, 0xD1, 0x52, 0x0C, 0x51, 0xFC, 0x4E, 0x62, 0x6E, 0xAE,
-    0xD3, 0xA9, 0x58, 0x4C, 0xA6, 0x71, 0x7D, 0xE9, 0x88, 0x38, 0x39, 0xC6, 0x89, 0x72, 0xE5, 0x0A,
-    0x5D, 0x8A, 0xFC, 0xBA, 0xF2, 0xD7, 0xE7, 0x7E, 0x8D, 0xF7, 0x27, 0xDA, 0xA6, 0x07, 0xE7, 0x09,
-    0x4F, 0x61, 0x6D, 0xB9, 0xE4, 0xD6, 0xB3, 0xC5, 0x13, 0x03, 0xB7, 0xFF, 0xBB, 0xE7, 0x16, 0x08,
-    0xC4, 0xAD, 0xF6, 0x2F, 0x8F, 0xDC, 0x3E, 0x89, 0xDE, 0xE3, 0x1E, 0xA0, 0x09, 0xEF, 0x5F, 0xEB,
-    0x59, 0x03, 0x7B, 0xCF, 0x6D, 0xA6, 0xF1, 0x25, 0xA4, 0x63, 0x50, 0x3F, 0xDE, 0x88, 0xF7, 0x76,
-    0x6C, 0xA0, 0x24, 0x6C, 0xDC, 0x1E, 0x30, 0xF5, 0x77, 0xD4, 0x33, 0x42, 0x92, 0x93, 0x2F, 0x9C,
-    0xB6, 0x01, 0xB8, 0x42, 0xF7, 0xB8, 0xB3, 0x4D, 0xE8, 0xFB, 0xD1, 0x4F, 0x22, 0xFA, 0x24, 0x74,
-    0x01, 0x9F, 0x5B, 0x62, 0x64, 0x92, 0x6C, 0x90, 0x1E, 0x98, 0x78, 0x90, 0x9B, 0xF0, 0x41, 0x07,
-    0xA9, 0x0E, 0xE6, 0x5E, 0x07, 0x5E, 0x07, 0xC5, 0x4D, 0x1E, 0xA4, 0x1F, 0xF0, 0xE0, 0xC9, 0x41,
-    0xCF, 0x70, 0x14, 0x73, 0x5F, 0xD5, 0x3C, 0xF0, 0xAD, 0x1A, 0x18, 0xD4, 0x1A, 0x44, 0x2D, 0x0F,
-    0xEA, 0xA3, 0x4D, 0x67, 0x3D, 0x19, 0x63, 0x42, 0xFE, 0x34, 0x18, 0xC6, 0xAC, 0x30, 0xC7, 0x90,
-    0x87, 0xD1, 0x82, 0xC3, 0xE1, 0x80, 0xD2, 0x06, 0x64, 0xE5, 0x92, 0x2E, 0x6F, 0x04, 0x36, 0xCE,
-    0x4D, 0x35, 0xBA, 0x3B, 0x7C, 0x4A, 0x0E, 0x62, 0x04, 0x74, 0x12, 0x3F, 0x42, 0x54, 0xEC, 0x79,
-    0xE0, 0xD8, 0x12, 0xF3, 0x44, 0xD6, 0x8E, 0x57, 0x81, 0x1B, 0x63, 0x2A, 0xAA, 0xF5, 0x9C, 0x9C,
-    0xA5, 0x01, 0x29, 0x03, 0x3B, 0x12, 0x12, 0x57, 0x9F, 0xE2, 0x2D, 0xC9, 0x90, 0x03, 0x6A, 0xF3,
-    0xB1, 0x58, 0x52, 0x16, 0x54, 0x02, 0xA3, 0xDE, 0x52, 0x4A, 0x52, 0x8A, 0xA8, 0x5C, 0x26, 0x20,
-    0x66, 0xEC, 0x42, 0x5D, 0x50, 0x1E, 0x1E, 0x78, 0xE1, 0xCB, 0xA0, 0x6D, 0x27, 0xD9, 0xA2, 0x29,
-    0xF8, 0x37, 0x81, 0x9C, 0x8D, 0xEC, 0x9E, 0x32, 0xD0, 0x02, 0x75, 0xD3, 0x71, 0x1A, 0x38, 0x90,
-    0x73, 0x03, 0x0B, 0x0A, 0xF3, 0xE1, 0xDE, 0x5D, 0x18, 0x17, 0x7B, 0xE0, 0x3A, 0x7A, 0xF3, 0x15,
-    0xBF, 0xFD, 0x18, 0x07, 0x25, 0x62, 0x74, 0x12, 0xD6, 0x06, 0xC3, 0x52, 0xBC, 0x27, 0x15, 0xC6,
-    0xCC, 0x0D, 0x47, 0x7E, 0xBC, 0x0B, 0xD4, 0x47, 0x4D, 0x36, 0xAC, 0xDD, 0x24, 0x3D, 0x01, 0x17,
-    0x83, 0x85, 0xD0, 0x6B, 0xEE, 0x0D, 0x3C, 0x9A, 0x96, 0xE4, 0x43, 0xDD, 0x30, 0xEA, 0x35, 0xD9,
-    0x2B, 0x52, 0x9A, 0xFA, 0x4C, 0x74, 0xBB, 0xE0, 0x0D, 0x49, 0x43, 0xDE, 0x0D, 0x66, 0x4B, 0x22,
-    0xCF, 0x0F, 0x2F, 0x0B, 0xEB, 0xD5, 0x31, 0xD3, 0x6D, 0xD2, 0xC3, 0x4B, 0x57, 0x38, 0x2A, 0x47,
-    0x35, 0x06, 0x24, 0x44, 0xBA, 0x66, 0xAF, 0xC1, 0x70, 0x3A, 0xBC, 0x0F, 0xDA, 0xDB, 0x1A, 0xF8,
-    0xFA, 0x3A, 0x75, 0x19, 0xD3, 0xB5, 0x5A, 0xB1, 0x9A, 0xCA, 0x18, 0x1B, 0x94, 0x0D, 0x52, 0x09,
-    0x37, 0x31, 0x37, 0x73, 0x92, 0xE3, 0x6C, 0x19, 0x34, 0xB6, 0x1B, 0x7A, 0xD7, 0xA8, 0x17, 0x42,
-    0x21, 0x7B, 0x8F, 0x9A, 0x10, 0xC8, 0x8B, 0x14, 0x3B, 0xF0, 0xB1, 0xCD, 0x26, 0xE5, 0xB9, 0x0C,
-    0x9B, 0x67, 0xAB, 0x96, 0x40, 0x5C, 0xB3, 0xF9, 0xC5, 0x0E, 0x87, 0x23, 0x63, 0x3A, 0x3B, 0x29,
-    0x77, 0xD2, 0x2D, 0x31, 0x0B, 0x11, 0x1B, 0x25, 0x5A, 0x1D, 0xD9, 0xA0, 0x07, 0xC0, 0xBF, 0xB9,
-    0xFF, 0xD1, 0x46, 0x8F, 0xD4, 0xCB, 0x2F, 0x4B, 0x0D, 0xE3, 0xCB, 0x5D, 0x7A, 0x87, 0x4D, 0xDE,
-    0x93, 0x17, 0x40, 0x10, 0x7F, 0xF4, 0xE5, 0x3C, 0xFC, 0x90, 0xEF, 0x7D, 0xCB, 0x98, 0xF8, 0xA1,
-    0x14, 0xD9, 0x94, 0x5A, 0x56, 0x3E, 0x69, 0x59, 0x11, 0x47, 0x16, 0x7D, 0x1A, 0x95, 0xEA, 0xE8,
-    0xA9, 0x35, 0xE7, 0x74, 0xA0, 0x7E, 0xD2, 0x53, 0x5C, 0xAC, 0x27, 0x56, 0xBE, 0x9C, 0x1B, 0x43,
-    0xE7, 0x01, 0x35, 0xA3, 0x36, 0xE3, 0x24, 0x62, 0xE4, 0xA2, 0xCD, 0x30, 0xA3, 0x3A, 0x58, 0xEF,
-    0x1C, 0x64, 0x35, 0x0F, 0x20, 0x48, 0x79, 0x90, 0xAF, 0x78, 0x80, 0xB9, 0xE4, 0x41, 0xB1, 0xE4,
-    0x01, 0x44, 0x27, 0x0F, 0x2A, 0x89, 0x73, 0x10, 0x38, 0x0E, 0x80, 0x91, 0x92, 0xED, 0x2B, 0x1E,
-    0xA4, 0xD2, 0x6C, 0x73, 0x61, 0xEE, 0x0F, 0x4C, 0x88, 0x49, 0xAA, 0xFB, 0x37, 0xD9, 0xE3, 0x78,
-    0x28, 0x88, 0x70, 0xE5, 0x35, 0x22, 0xD7, 0xBC, 0x27, 0xE9, 0xBA, 0xE2, 0xFB, 0xC4, 0xEB, 0x59,
-    0x97, 0x11, 0xA3, 0xB3, 0xC5, 0x05, 0xC2, 0xEB, 0xC2, 0x17, 0x61, 0x95, 0x9C, 0x32, 0x34, 0x01,
-    0x8C, 0xC0, 0xD8, 0xFC, 0x32, 0x6D, 0x5D, 0x89, 0x47, 0x40, 0xFC, 0x98, 0x5A, 0x0A, 0xF4, 0x3A,
-    0x81, 0x92, 0xE0, 0x1B, 0x51, 0x6F, 0xE3, 0x30, 0x1E, 0x20, 0xCB, 0xF8, 0xDF, 0x38, 0xF0, 0xB4,
-    0x27, 0xF2, 0x43, 0x9D, 0x00, 0x16, 0x88, 0x94, 0xF0, 0xB5, 0x12, 0x85, 0x66, 0xEB, 0xA2, 0x21,
-    0xC7, 0x71, 0xB3, 0xE1, 0xCC, 0x70, 0xD6, 0x64, 0x95, 0xE4, 0x6A, 0x98, 0x25, 0x11, 0x73, 0x3E,
-    0x56, 0x87, 0xE2, 0xFD, 0x59, 0x9F, 0x1A, 0xDD, 0xA5, 0xE3, 0x5C, 0x12, 0x9D, 0x3A, 0x2E, 0x5A,
-    0x6A, 0x48, 0xC3, 0xCB, 0xA2, 0x49, 0x25, 0x93, 0xF4, 0x3A, 0x0A, 0x1B, 0xA1, 0x2E, 0x67, 0x5E,
-    0xEA, 0x0B, 0x65, 0x64, 0x33, 0xA3, 0xEA, 0xD1, 0xCF, 0x88, 0xA8, 0xEC, 0xF8, 0x1B, 0x42, 0x77,
-    0xFC, 0xF7, 0x14, 0x36, 0x94, 0x39, 0x2F, 0x50, 0xF7, 0x95, 0xCA, 0x5F, 0x4B, 0x95, 0xA6, 0x84,
-    0x5E, 0x67, 0xED, 0x8C, 0xFD, 0x05, 0xFA, 0x62, 0xF6, 0x86, 0xF9, 0x1A, 0x23, 0x03, 0x1F, 0x67,
-    0x97, 0x92, 0xC1, 0xA4, 0x6B, 0x42, 0xBD, 0x2C, 0x63, 0x77, 0x0B, 0x69, 0x68, 0x67, 0xD9, 0xF1,
-    0xBC, 0x17, 0x12, 0xFE, 0x7B, 0x8C, 0xF7, 0xA7, 0x50, 0xAE, 0x7C, 0xDE, 0xE2, 0x54, 0x05, 0xE1,
-    0xF1, 0x06, 0xD8, 0xF9, 0x48, 0x6D, 0x63, 0x1D, 0x49, 0x6A, 0x7E, 0xF9, 0x47, 0xE2, 0xAA, 0x5B,
-    0x41, 0x01, 0xED, 0x68, 0x66, 0x8A, 0xD4, 0x46, 0x9E, 0x04, 0xDD, 0x90, 0x07, 0x26, 0xAA, 0x0A,
-    0x1D, 0xA4, 0x3A, 0x98, 0x8F, 0x3A, 0xF0, 0x67, 0x78, 0x50, 0xBC, 0xC1, 0x83, 0x93, 0x2D, 0x9F,
-    0xB9, 0x35, 0xA8, 0x01, 0x52, 0x3E, 0x99, 0x99, 0x0E, 0x5A, 0xB5, 0x36, 0x1C, 0x6D, 0x3A, 0x22,
-    0x6B, 0xA5, 0x41, 0xF5, 0xD6, 0xAE, 0xE4, 0x04, 0x60, 0x4F, 0x69, 0xDE, 0xF3, 0x65, 0x2E, 0xAE,
-    0x47, 0xBE, 0x05, 0xAE, 0x59, 0x71, 0x36, 0xBC, 0x18, 0xE6, 0x4C, 0xF2, 0xE1, 0xA3, 0x9F, 0x07,
-    0x54, 0x02, 0x3F, 0x98, 0x7A, 0x8E, 0x00, 0xB5, 0xC8, 0xB6, 0x56, 0x35, 0xDE, 0x3F, 0x7C, 0x93,
-    0x08, 0x3E, 0x8A, 0xA7, 0x15, 0x44, 0x05, 0x30, 0x22, 0xB2, 0xB5, 0xB9, 0xC0, 0x48, 0x55, 0x9E,
-    0xC6, 0xF3, 0x82, 0x17, 0xB2, 0x15, 0x2F, 0x48, 0x44, 0x48, 0x97, 0xAF, 0xF9, 0x1C, 0x2F, 0x94,
-    0x0B, 0x5E, 0xC8, 0x6B, 0x99, 0x1A, 0x12, 0xA7, 0x71, 0x47, 0x74, 0x39, 0x47, 0x3C, 0x76, 0x62,
-    0x03, 0x0B, 0x69, 0xEF, 0x63, 0x46, 0x54, 0xF2, 0x3F, 0x85, 0x8C, 0xC1, 0xB4, 0x7E, 0x45, 0x33,
-    0x38, 0x27, 0xB8, 0x48, 0xE8, 0xBE, 0x37, 0x7B, 0x1B, 0x03, 0xCF, 0x3D, 0xA7, 0xAB, 0x71, 0x86,
-    0xE9, 0x20, 0xAA, 0x8E, 0xB7, 0x60, 0x6E, 0x31, 0xE8, 0x0F, 0x47, 0x37, 0x50, 0xDA, 0xBD, 0xD5,
-    0xCF, 0xDF, 0xC7, 0x93, 0xE5, 0x99, 0x26, 0x7F, 0x1D, 0xD6, 0x7B, 0x5F, 0xD4, 0x23, 0x74, 0x1C,
-    0x98, 0x8D, 0xD7, 0x1A, 0xE0, 0x4D, 0x7E, 0xD5, 0x43, 0x84, 0x02, 0x89, 0xE7, 0xC3, 0xCB, 0xF1,
-    0x80, 0xEE, 0xA6, 0xB7, 0x9A, 0x0C, 0x8D, 0x36, 0x30, 0xFF, 0x41, 0x48, 0x30, 0xAA, 0x31, 0xE4,
-    0x25, 0xC7, 0x0D, 0xEE, 0x81, 0xEE, 0x46, 0xA4, 0x67, 0xF0, 0x09, 0x1C, 0x40, 0xFE, 0x56, 0x0B,
-    0xD9, 0x24, 0x89, 0xBF, 0x90, 0x01, 0x5F, 0x5B, 0x02, 0x0A, 0xD3, 0xFC, 0x2E, 0x7B, 0x1A, 0xCB,
-    0xAA, 0xE0, 0x5C, 0xBF, 0x6F, 0x06, 0xDA, 0x6B, 0xEA, 0xD8, 0x40, 0x09, 0x10, 0x13, 0xBD, 0x64,
-    0x6D, 0xC9, 0xFE, 0x6A, 0xCC, 0x04, 0x5B, 0x99, 0x15, 0x36, 0x19, 0x62, 0xC1, 0xE3, 0xA0, 0xB9,
-    0x58, 0x99, 0x8B, 0xC3, 0xB4, 0x7D, 0xBB, 0x74, 0xB7, 0xA7, 0x8E, 0x36, 0xB8, 0xB6, 0x09, 0x27,
-    0x25, 0xFD, 0x9D, 0x75, 0xE3, 0x75, 0x23, 0x84, 0xC9, 0xAE, 0x9F, 0x49, 0x04, 0xE5, 0x32, 0xE0,
-    0xC8, 0x5C, 0x97, 0x33, 0x7F, 0x3D, 0x93, 0x25, 0x0E, 0xF6, 0x24, 0x6B, 0xA5, 0xA5, 0x76, 0x5F,
-    0xF4, 0x6C, 0x11, 0x5B, 0xAA, 0x14, 0x03, 0x39, 0x5C, 0x16, 0xB6, 0xD0, 0x21, 0xF0, 0xD2, 0xED,
-    0x36, 0xEB, 0x69, 0x2B, 0x60, 0xDB, 0x51, 0xF3, 0xA3, 0x5D, 0x5E, 0xB4, 0xB9, 0x86, 0x92, 0x92,
-    0x32, 0xC0, 0x95, 0xAF, 0x3F, 0x6E, 0xC2, 0x6E, 0xD4, 0x1B, 0x5B, 0x79, 0x5E, 0xA8, 0xE4, 0x7C,
-    0xEB, 0x94, 0x75, 0x21, 0x38, 0x37, 0x48, 0x2A, 0xC2, 0xC3, 0xE2, 0x60, 0xFF, 0x9B, 0x7E, 0x19,
-    0x2C, 0x26, 0xB3, 0x93, 0xEE, 0xCF, 0x01, 0x99, 0xE2, 0xD2, 0x0C, 0xAF, 0xE7, 0x00, 0x25, 0xCC,
-    0x5E, 0x30, 0xBC, 0x9C, 0xDB, 0x77, 0x51, 0x65, 0xF0, 0xF3, 0x7D, 0x6E, 0x22, 0xEE, 0x09, 0x1C,
-    0x72, 0x36, 0x0B, 0x72, 0xE3, 0x60, 0xD3, 0x65, 0xF4, 0x4C, 0x54, 0x38, 0x45, 0xC2, 0xAB, 0xA9,
-    0x7A, 0x5C, 0x91, 0x37, 0x83, 0x6C, 0x81, 0x48, 0x76, 0xB8, 0xB8, 0xAB, 0x8A, 0x10, 0xBC, 0x2E,
-    0xEB, 0x8D, 0xD7, 0xE5, 0x47, 0x9A, 0x9C, 0xEB, 0xE6, 0x3C, 0xB1, 0x57, 0x5E, 0x7F, 0x1C, 0x4A,
-    0x37, 0x71, 0x14, 0x74, 0xDC, 0x61, 0x5A, 0x66, 0xF2, 0xB9, 0x2C, 0xA4, 0x08, 0x96, 0x9B, 0x4D,
-    0x75, 0xDB, 0x86, 0xAF, 0xE1, 0x6C, 0x90, 0xBD, 0x91, 0x4C, 0xA4, 0x55, 0xAE, 0xDD, 0x57, 0x12,
-    0xC2, 0xD8, 0x34, 0xC3, 0x8A, 0x5C, 0x44, 0x46, 0xB1, 0x3B, 0x7E, 0xDA, 0x50, 0x4E, 0x52, 0xD6,
-    0xFF, 0xBD, 0xB6, 0xCF, 0x1F, 0x9E, 0x19, 0xBF, 0x3B, 0xD0, 0xC1, 0x14, 0xB7, 0xE4, 0x00, 0xD9,
-    0x4F, 0x39, 0xC0, 0x72, 0xB6, 0xC4, 0x38, 0x5E, 0x9A, 0xB4, 0x76, 0xE9, 0xA6, 0x1A, 0x8A, 0x0D,
-    0xEF, 0xB3, 0x9D, 0xDE, 0xD3, 0xCB, 0x35, 0xF6, 0x48, 0xC8, 0xF8, 0xA0, 0x99, 0x19, 0x6E, 0x76,
-    0xE9, 0xD2, 0x05, 0x89, 0x19, 0x81, 0xD2, 0xC4, 0x8C, 0x99, 0xD1, 0xD9, 0x20, 0xD1, 0x6F, 0xAE,
-    0x27, 0xE2, 0x75, 0x31, 0x96, 0xFF, 0xE4, 0x1B, 0x58, 0xFB, 0x5D, 0x36, 0x42, 0xD7, 0x1C, 0x23,
-    0xFF, 0x1A, 0x30, 0x65, 0x59, 0x7C, 0x08, 0x64, 0x5E, 0x27, 0xE0, 0x4A, 0x29, 0x70, 0xEC, 0x2C,
-    0xC4, 0xA4, 0xAB, 0xDE, 0x22, 0x7B, 0x29, 0x1A, 0x20, 0xCB, 0x3A, 0xEF, 0xF2, 0x31, 0xED, 0xF2,
-    0x7E, 0x66, 0x44, 0x9E, 0x49, 0xCB, 0x21, 0x33, 0x5C, 0x6E, 0xAC, 0x89, 0x38, 0x78, 0x0D, 0x47,
-    0x19, 0x9E, 0x94, 0xF8, 0xE8, 0xD5, 0x79, 0x51, 0xD0, 0x93, 0xDE, 0x27, 0xF2, 0x11, 0x5C, 0xF5,
-    0xF4, 0x5D, 0x02, 0x1F, 0x57, 0x11, 0xAD, 0x96, 0x9E, 0xEC, 0x2B, 0x01, 0x3A, 0x2E, 0x89, 0x0F,
-    0x94, 0x94, 0xA9, 0x2F, 0x4D, 0x5E, 0xD6, 0x1B, 0x0F, 0xE4, 0xCC, 0x06, 0x1A, 0xA0, 0x23, 0xFC,
-    0x2B, 0x24, 0x4E, 0xF3, 0x5B, 0x42, 0x97, 0x86, 0xA2, 0x37, 0x95, 0x73, 0x22, 0x45, 0xFF, 0x6A,
-    0x97, 0xF4, 0xC4, 0x26, 0xA8, 0x1B, 0x73, 0x0A, 0xEA, 0xEB, 0x98, 0xBD, 0x33, 0xDE, 0x9B, 0x64,
-    0x7D, 0x56, 0x6A, 0xDA, 0x60, 0xAC, 0xE6, 0x0D, 0x1D, 0x80, 0x6E, 0x46, 0x92, 0x57, 0xF0, 0x20,
-    0x94, 0x4D, 0xB0, 0xA1, 0xEE, 0xCF, 0xC1, 0x01, 0x60, 0xE6, 0xCC, 0x30, 0x7B, 0x6B, 0xC7, 0x30,
-    0x33, 0x2D, 0x6E, 0x6E, 0xF6, 0x98, 0xF4, 0x5A, 0x37, 0x37, 0x1F, 0xB6, 0xF4, 0x5A, 0x7A, 0xA1,
-    0x64, 0xA3, 0xC9, 0x9C, 0x77, 0xDF, 0x2E, 0xFC, 0x90, 0x69, 0x54, 0xDF, 0xA0, 0x1C, 0xE2, 0xA8,
-    0xEA, 0x44, 0xEF, 0x88, 0x8C, 0xE5, 0xDA, 0x6B, 0x33, 0x71, 0xDC, 0x78, 0xF7, 0x82, 0xB1, 0x95,
-    0x94, 0x16, 0x8F, 0xB9, 0x6A, 0xCD, 0x39, 0x53, 0xEB, 0x00, 0x30, 0xDD, 0xBB, 0x78, 0x72, 0x70,
-    0x1B, 0xE4, 0x0F, 0xBE, 0x61, 0xC3, 0xC8, 0x74, 0xE7, 0x42, 0x32, 0x4D, 0xB2, 0x18, 0x04, 0xCD,
-    0x2F, 0x02, 0x52, 0x76, 0xC9, 0xFB, 0xEA, 0xD1, 0x5B, 0x7E, 0x4C, 0xF4, 0x27, 0x5A, 0x00, 0x5D,
-    0x2C, 0x25, 0x05, 0x1C, 0x1D, 0x64, 0x3D, 0xFF, 0xB2, 0x4E, 0x92, 0xA0, 0xA1, 0x42, 0xC8, 0xAE,
-    0x01, 0x1F, 0x7E, 0x0D, 0xB7, 0xFC, 0x5F, 0xDC, 0xB2, 0x47, 0x36, 0x6A, 0x9F, 0x5F, 0x4E, 0xD0,
-    0xBF, 0x39, 0xED, 0x2C, 0xA6, 0x91, 0xE0, 0xAF, 0xD7, 0x16, 0x63, 0x5B, 0xDB, 0x1F, 0x8D, 0x4A,
-    0x4F, 0xF3, 0x64, 0xF3, 0x86, 0x2F, 0x7A, 0xE7, 0x14, 0x76, 0x1E, 0x1F, 0xDD, 0x34, 0x9C, 0xAE,
-    0x0A, 0x3B, 0xC3, 0x34, 0x9C, 0x29, 0x0C, 0x92, 0xF4, 0x61, 0x27, 0x9E, 0x76, 0xE6, 0x9B, 0x9D,
-    0x49, 0x25, 0x9D, 0xB7, 0x93, 0x0B, 0x7F, 0xDA, 0x71, 0x17, 0x0A, 0xB3, 0xC9, 0xCD, 0x7B, 0x67,
-    0x18, 0x02, 0x43, 0x96, 0x06, 0xDC, 0x6A, 0x47, 0xC9, 0x6A, 0x85, 0x14, 0x5F, 0x3B, 0x8A, 0x2D,
-    0xFE, 0xA2, 0xA9, 0x45, 0x32, 0x14, 0x85, 0xDF, 0xC5, 0x61, 0xE5, 0x89, 0x46, 0x91, 0xF9, 0x73,
-    0x29, 0xB9, 0x25, 0xCB, 0xF1, 0x04, 0xB1, 0x93, 0x9E, 0xC6, 0xB5, 0xF9, 0x19, 0xE9, 0x65, 0xAC,
-    0x7A, 0xE1, 0x64, 0xAF, 0xF7, 0x4A, 0x73, 0x32, 0x36, 0x60, 0x4E, 0x15, 0x6D, 0x34, 0x3E, 0x89,
-    0xE2, 0x96, 0xC7, 0xED, 0x64, 0xA7, 0x4D, 0x56, 0xDA, 0x27, 0x7F, 0xDF, 0x38, 0x65, 0xDF, 0xE6,
-    0x9D, 0x0E, 0xA6, 0x39, 0xBE, 0xFF, 0xC2, 0x37, 0x76, 0x5F, 0xD1, 0xD9, 0x37, 0x9D, 0x01, 0x8B,
-    0xC9, 0x33, 0xB0, 0xF3, 0x3D, 0x9D, 0x0F, 0xF7, 0xFD, 0xA9, 0x9E, 0x53, 0xB0, 0x26, 0xB7, 0xE9,
-    0x70, 0x36, 0x1B, 0x6B, 0xB7, 0x9D, 0x0C, 0xEB, 0x7F, 0x50, 0x6A, 0x5A, 0x77, 0x27, 0xF3, 0xF2,
-    0xC8, 0xE6, 0xC6, 0xF9, 0xAD, 0x41, 0x0A, 0x24, 0xFC, 0x73, 0xB9, 0x2D, 0xF2, 0xCF, 0xE3, 0xB6,
-    0xA0, 0xD8, 0xD6, 0xDB, 0x67, 0x9A, 0x11, 0x53, 0x60, 0x20, 0xBD, 0xE8, 0x5D, 0xCB, 0xFC, 0x9C,
-    0x10, 0x5F, 0xBD, 0x4C, 0x67, 0x4B, 0xB2, 0xB4, 0x88, 0x48, 0x64, 0x11, 0x91, 0xC6, 0x74, 0xB0,
-    0x58, 0xFC, 0x42, 0x28, 0x11, 0xA4, 0x8B, 0x0C, 0xCC, 0x64, 0x9C, 0x51, 0x99, 0x7F, 0xB2, 0xC5,
-    0xE3, 0xAF, 0x30, 0xF0, 0x54, 0x57, 0xD0, 0x3A, 0xD6, 0xEA, 0x81, 0x0C, 0xB7, 0xA0, 0x43, 0x7D,
-    0xF9, 0x85, 0x09, 0x00, 0xD8, 0x0B, 0x21, 0x90, 0x51, 0x92, 0x82, 0x77, 0x49, 0xFD, 0x2C, 0xCC,
-    0xD7, 0x80, 0xA1, 0xD6, 0xA5, 0x78, 0x14, 0xCC, 0xC2, 0xDC, 0x9B, 0x33, 0x9A, 0x66, 0x98, 0x97,
-    0x47, 0x81, 0xA6, 0xB4, 0x61, 0x09, 0x95, 0x40, 0x5C, 0x41, 0xB7, 0x0B, 0x06, 0xD1, 0x64, 0xE2,
-    0xCA, 0xDA, 0x20, 0x78, 0x84, 0x74, 0xD4, 0xEC, 0x2C, 0x66, 0x86, 0x5B, 0x92, 0x70, 0x4B, 0x9D,
-    0x51, 0xD3, 0x67, 0x2B, 0xA5, 0x90, 0x90, 0xAD, 0x10, 0xC1, 0xA9, 0xEE, 0x03, 0x39, 0x81, 0x99,
-    0x12, 0x51, 0x2E, 0x58, 0x8D, 0xEB, 0x9C, 0xCE, 0xFA, 0x35, 0x1B, 0xA2, 0xF3, 0xA9, 0x4E, 0xBD,
-    0x75, 0x95, 0x00, 0x31, 0x86, 0xEC, 0xBE, 0x23, 0x83, 0x5F, 0x2E, 0xA1, 0x7C, 0x32, 0x4C, 0xD0,
-    0xFB, 0xF1, 0x09, 0xDC, 0xC0, 0x30, 0x00, 0xD9, 0x06, 0x4D, 0xDA, 0xD6, 0x55, 0x35, 0xA3, 0x60,
-    0x7E, 0x01, 0x96, 0x98, 0x88, 0x39, 0xE7, 0xE2, 0xC7, 0x38, 0x9D, 0x0A, 0xBC, 0x89, 0x10, 0x23,
-    0x11, 0xAD, 0x15, 0xEB, 0x8A, 0x9C, 0x79, 0x26, 0x13, 0x2D, 0x91, 0x77, 0x9E, 0x77, 0x8F, 0x6A,
-    0x04, 0xF6, 0x39, 0xCC, 0x0D, 0x98, 0x24, 0x6B, 0xDF, 0xE1, 0xF6, 0x37, 0x15, 0x80, 0x3A, 0x11,
-    0x4C, 0xF3, 0x8B, 0x14, 0x9E, 0xBD, 0x22, 0x65, 0x33, 0xFF, 0x1E, 0x25, 0x7B, 0xD6, 0xCD, 0x29,
-    0xE6, 0xF7, 0x96, 0x12, 0xD6, 0xE8, 0xD6, 0x63, 0x32, 0x51, 0xC4, 0x0C, 0x19, 0x4F, 0xF2, 0xCB,
-    0x72, 0x9D, 0x76, 0x09, 0xEF, 0xA9, 0xD6, 0x39, 0x0D, 0x51, 0x3F, 0x16, 0x60, 0xE8, 0xB5, 0xEF,
-    0x00, 0xEA, 0xD3, 0xEE, 0xF4, 0xC6, 0x5A, 0xFD, 0x6D, 0xFC, 0x9F, 0x61, 0x04, 0x4C, 0x8A, 0x23,
-    0x35, 0xC8, 0x4E, 0xC6, 0x9D, 0xC4, 0x77, 0x47, 0x79, 0x4D, 0x2E, 0xD0, 0x1C, 0x87, 0x38, 0xAB,
-    0x46, 0xBA, 0x28, 0x7A, 0xAA, 0x1F, 0x4D, 0x85, 0x19, 0x7A, 0x9E, 0x56, 0x28, 0x20, 0xEC, 0xDF,
-    0x1E, 0xA8, 0x91, 0x83, 0x2A, 0xA0, 0x62, 0xA4, 0x54, 0xD6, 0x21, 0x34, 0xC0, 0xAD, 0x0B, 0x98,
-    0x30, 0xCF, 0x62, 0xEE, 0x39, 0x69, 0xA3, 0x29, 0x5C, 0x15, 0x41, 0xBC, 0xBF, 0x70, 0xC7, 0xBE,
-    0x75, 0x51, 0x58, 0x48, 0x28, 0xD5, 0x65, 0x7B, 0xB6, 0x8F, 0x21, 0xEB, 0x23, 0xFA, 0xD6, 0xCA,
-    0x55, 0xD6, 0x64, 0x1F, 0x7C, 0x03, 0xCD, 0xFB, 0x8E, 0x71, 0xBD, 0x65, 0xF9, 0x33, 0xE0, 0x3F,
-    0x08, 0x11, 0xCC, 0x0E, 0x0A, 0x07, 0xBA, 0x82, 0x3B, 0xBA, 0xF2, 0xB0, 0xA2, 0x83, 0x66, 0x28,
-    0xFC, 0x8E, 0x11, 0x8E, 0x13, 0x23, 0x67, 0x0A, 0x30, 0x18, 0xE2, 0x31, 0xC2, 0xBF, 0xE3, 0x7F,
-    0x8F, 0xFF, 0x2E, 0xA6, 0x87, 0xEA, 0x2E, 0xFF, 0x99, 0x7F, 0x89, 0xFE, 0x47, 0x67, 0x11, 0x09,
-    0xE3, 0x77, 0x6C, 0x57, 0x14, 0xB5, 0xE7, 0x2F, 0x33, 0xD6, 0xD0, 0x60, 0xAA, 0xDC, 0xCB, 0x9C,
-    0xBB, 0x64, 0xCD, 0xDD, 0x91, 0xBB, 0x29, 0x27, 0xD0, 0xF5, 0x9A, 0xD1, 0x15, 0x76, 0x67, 0xDA,
-    0x2D, 0x16, 0xD8, 0x8D, 0x1B, 0xEE, 0x12, 0x4D, 0xA2, 0x0A, 0xAA, 0x65, 0x27, 0x57, 0xD7, 0xBB,
-    0x5E, 0xF3, 0x40, 0xED, 0xF3, 0xA7, 0x3D, 0x3D, 0x3F, 0xD4, 0x05, 0xF3, 0x57, 0x3A, 0x6A, 0x04,
-    0xD9, 0x92, 0x0A, 0x01, 0xC9, 0xF0, 0xAF, 0x35, 0xE1, 0x95, 0xD0, 0x0E, 0x7A, 0x50, 0xD5, 0x67,
-    0x4D, 0x32, 0x14, 0xF5, 0x7C, 0xA4, 0xE3, 0xB1, 0x7A, 0xE7, 0x9B, 0x3E, 0x8C, 0x73, 0xF4, 0x3F,
-    0xDB, 0x3F, 0xCD, 0x69, 0xAA, 0x6A, 0x23, 0xE0, 0x62, 0x3C, 0xF1, 0xDF, 0x39, 0xF6, 0x44, 0xF6,
-    0x3D, 0x28, 0xF5, 0xD8, 0x69, 0x37, 0x13, 0x0A, 0x7D, 0x9B, 0x9A, 0x1F, 0x68, 0x66, 0x9D, 0x8D,
-    0x50, 0x37, 0x53, 0x40, 0x1A, 0x4D, 0xC2, 0xEA, 0xFA, 0x52, 0x05, 0x78, 0x17, 0x7F, 0x03, 0x9B,
-    0x3A, 0xEE, 0x13, 0xFA, 0xE4, 0x01, 0x5C, 0xD9, 0x0B, 0x4F, 0xF5, 0xF2, 0x7A, 0x98, 0x90, 0x08,
-    0xCE, 0x5C, 0xCE, 0xF1, 0x9B, 0x23, 0x31, 0x22, 0xEE, 0x39, 0xEE, 0x72, 0x5D, 0xAE, 0xC4, 0xE9,
-    0xF1, 0x2C, 0xA3, 0xA0, 0x6C, 0x0A, 0x14, 0xD1, 0x80, 0x83, 0xF8, 0x55, 0x8E, 0x17, 0xF5, 0x29,
-    0x54, 0x45, 0xBD, 0xB7, 0x3B, 0x26, 0x05, 0x04, 0x58, 0xF7, 0xE5, 0x8B, 0x54, 0xBA, 0x49, 0x78,
-    0x7D, 0x76, 0x50, 0x62, 0xD4, 0xE9, 0x70, 0x4C, 0x02, 0x0D, 0xC2, 0xFD, 0xF8, 0x59, 0xD2, 0x5B,
-    0x2D, 0x53, 0xFB, 0xE1, 0x4A, 0x41, 0xE9, 0x98, 0xCE, 0x23, 0xF0, 0x90, 0xA2, 0x06, 0x08, 0x08,
-    0x0A, 0x73, 0x4C, 0x2D, 0xDC, 0xF1, 0x53, 0x53, 0x8C, 0xB3, 0x29, 0x20, 0xF0, 0xF1, 0xAA, 0x0E,
-    0xD4, 0x5F, 0xAD, 0x61, 0x58, 0x67, 0x10, 0x40, 0x0B, 0xF0, 0x84, 0x12, 0xBA, 0xE9, 0x22, 0x6B,
-    0xA9, 0xA0, 0x0E, 0xD9, 0x4D, 0x9C, 0x3C, 0xF3, 0x26, 0x4E, 0xDE, 0xBC, 0x4A, 0x96, 0xBE, 0x2A,
-    0xC9, 0x12, 0x78, 0xE7, 0x2A, 0xE6, 0x9D, 0x91, 0x98, 0x47, 0x05, 0x26, 0xBF, 0xA2, 0x0F, 0x0A,
-    0x6D, 0xAE, 0xDD, 0x43, 0x74, 0x95, 0xA7, 0xAB, 0x6C, 0xE5, 0xE2, 0x96, 0xC0, 0xF1, 0x52, 0xFD,
-    0xBD, 0x20, 0x40, 0x39, 0x78, 0xEC, 0xF4, 0xAE, 0xD7, 0xE7, 0x3E, 0x76, 0x04, 0x1C, 0x60, 0x89,
-    0xE3, 0xBC, 0xC1, 0x2C, 0x54, 0x74, 0xD6, 0xFA, 0x36, 0x1E, 0x66, 0xE3, 0x7F, 0x89, 0x87, 0x18,
-    0x8A, 0xEE, 0x00, 0x76, 0x8F, 0x76, 0x99, 0x41, 0xA0, 0x34, 0x02, 0x1A, 0xFD, 0xE3, 0x59, 0x9E,
-    0x03, 0x48, 0xE3, 0x81, 0x6C, 0x69, 0xA0, 0x8A, 0x81, 0xF9, 0x5E, 0x65, 0xE3, 0x82, 0x72, 0x64,
-    0x55, 0xC2, 0xE4, 0x5A, 0x91, 0x6D, 0xBA, 0xE8, 0xD4, 0xD6, 0x0F, 0xBD, 0x22, 0xB3, 0x6B, 0xA2,
-    0xEA, 0x06, 0x23, 0x85, 0x35, 0x94, 0xAC, 0x79, 0xCB, 0x28, 0x2D, 0x9F, 0x76, 0x05, 0x39, 0x73,
-    0xBA, 0xC2, 0xC9, 0xB8, 0xC1, 0xC9, 0x59, 0xC7, 0x93, 0x62, 0xD7, 0x05, 0x48, 0xF2, 0x4B, 0xF9,
-    0x8A, 0xE2, 0x0A, 0xF2, 0x0C, 0x48, 0xB5, 0xE7, 0xAF, 0x57, 0x34, 0x5F, 0x33, 0xBA, 0x1A, 0x57,
-    0xA7, 0x76, 0xB3, 0x36, 0x20, 0x6F, 0x20, 0xDF, 0x61, 0xF8, 0x83, 0x46, 0x81, 0xCC, 0xEB, 0x98,
-    0x98, 0x00, 0x00, 0x34, 0x8C, 0xC8, 0xDF, 0x6A, 0xB3, 0xAA, 0x8E, 0x3F, 0xEC, 0x8B, 0xA2, 0x8E,
-    0x7F, 0xD9, 0x7F, 0x0F, 0xDB, 0x5F, 0x8C, 0x3D, 0xB6, 0x0D, 0x78, 0x16, 0xB6, 0x65, 0xCB, 0x6D,
-    0xD1, 0x70, 0x9B, 0xD7, 0xDC, 0xA2, 0x3B, 0x75, 0xDA, 0x3D, 0xE4, 0xCA, 0xEB, 0x15, 0xB9, 0x37,
-    0xC8, 0x2C, 0xA8, 0xB2, 0x61, 0x36, 0xFC, 0x66, 0x36, 0x5A, 0xCE, 0x06, 0xD8, 0xC9, 0x02, 0xE4,
-    0x4E, 0x18, 0x2F, 0xB3, 0x16, 0xE8, 0x4B, 0xAE, 0x28, 0x1E, 0x83, 0x93, 0x87, 0x97, 0xA7, 0x93,
-    0xB7, 0xDD, 0x59, 0xC2, 0xCA, 0x3E, 0xD0, 0x6C, 0x78, 0xB6, 0xD9, 0xB8, 0xBD, 0x4B, 0x0B, 0x79,
-    0x5C, 0xA4, 0x67, 0x90, 0x40, 0xC0, 0x8B, 0xFD, 0x35, 0x6F, 0x5E, 0x0A, 0xFF, 0x1E, 0x63, 0xED,
-    0x60, 0x85, 0xD5, 0x4D, 0xFA, 0xBE, 0x31, 0x17, 0x15, 0xCE, 0x24, 0x74, 0x57, 0xF8, 0x57, 0x29,
-    0xCE, 0x8B, 0x81, 0xEE, 0x32, 0xA3, 0x00, 0x85, 0x40, 0x76, 0xF0, 0x28, 0xDF, 0x28, 0xAF, 0x62,
-    0x17, 0xEB, 0x58, 0xEC, 0x43, 0x92, 0xA5, 0x84, 0xEC, 0x5D, 0x30, 0xED, 0xA3, 0xFE, 0x54, 0x27,
-    0x4B, 0xA8, 0x65, 0x40, 0xA1, 0x5A, 0x28, 0x04, 0x99, 0xE2, 0xFE, 0x30, 0x02, 0xBF, 0x05, 0xB7,
-    0x5C, 0x29, 0xB4, 0xC2, 0xD6, 0xD1, 0xE9, 0xBA, 0xEA, 0x83, 0xEE, 0x41, 0xDF, 0xEE, 0x5D, 0x36,
-    0xDB, 0x20, 0x06, 0x15, 0x95, 0xAA, 0x99, 0x4F, 0x02, 0x71, 0x21, 0x7F, 0xE0, 0xDC, 0xBF, 0x48,
-    0x47, 0x83, 0xB4, 0xC3, 0xED, 0x66, 0xC1, 0xC1, 0xD0, 0x1F, 0xC3, 0xCD, 0xF1, 0x7D, 0x0E, 0x70,
-    0x26, 0xC2, 0xA7, 0x54, 0x7B, 0xC2, 0xDF, 0x1C, 0xB3, 0x2E, 0xED, 0x81, 0x6F, 0xEF, 0x02, 0xC8,
-    0x64, 0x25, 0x55, 0xC8, 0x09, 0x18, 0xCD, 0x75, 0x5C, 0x35, 0xCA, 0x5D, 0x99, 0xFB, 0x83, 0xA7,
-    0x5F, 0xF5, 0x32, 0x36, 0x3B, 0x09, 0xE7, 0xFD, 0xC5, 0x36, 0x20, 0x3D, 0x68, 0x7E, 0x6D, 0x73,
-    0xD5, 0x3F, 0xDB, 0x17, 0xCF, 0x72, 0x73, 0x02, 0x9B, 0x0C, 0x80, 0xA0, 0x33, 0x74, 0xE9, 0x3E,
-    0x61, 0x13, 0x53, 0x95, 0x2A, 0x28, 0xA0, 0x8B, 0x49, 0x9D, 0xC3, 0x6B, 0xBE, 0xCF, 0xA6, 0xDB,
-    0x1C, 0x33, 0xDE, 0x01, 0x98, 0x4C, 0xB7, 0xE8, 0xD9, 0xA9, 0x8A, 0xA2, 0x1F, 0xA4, 0x96, 0x8C,
-    0xF4, 0x06, 0x94, 0x8D, 0x1C, 0xA5, 0xE4, 0x08, 0x59, 0x4B, 0x7F, 0xBE, 0x7F, 0x9E, 0xEC, 0x73,
-    0x18, 0xD5, 0xBB, 0xD5, 0xE4, 0x1C, 0x4E, 0x65, 0x44, 0xCB, 0x37, 0x12, 0x9B, 0x47, 0x82, 0xCA,
-    0x16, 0xA3, 0x9F, 0x5F, 0xA5, 0x75, 0x18, 0xFF, 0x9C, 0xB7, 0x56, 0xD4, 0x6C, 0x12, 0x8B, 0x86,
-    0xF3, 0xF9, 0xE8, 0x62, 0xD0, 0xEF, 0x4E, 0xC9, 0x5C, 0xB6, 0x1C, 0x9E, 0xED, 0x76, 0x72, 0x26,
-    0x7C, 0x64, 0x4B, 0x40, 0x32, 0x1D, 0xA1, 0x55, 0x3E, 0x8C, 0xFC, 0x99, 0xB7, 0xA0, 0xB8, 0x0D,
-    0x19, 0x84, 0x75, 0xD1, 0x40, 0xAA, 0xF6, 0xE5, 0x3A, 0x83, 0x8E, 0x55, 0xD5, 0x14, 0x28, 0x15,
-    0xE4, 0x6C, 0x3C, 0xFA, 0x9D, 0xAD, 0x9D, 0x2F, 0x71, 0x27, 0x44, 0x37, 0x44, 0x6E, 0xDE, 0x65,
-    0x23, 0x9E, 0x6D, 0x12, 0xB9, 0x05, 0x8D, 0x4E, 0xD8, 0x7E, 0x3D, 0xBD, 0xEB, 0x6E, 0x7D, 0x98,
-    0x49, 0x5A, 0x88, 0x1D, 0xB9, 0x68, 0x7F, 0x9A, 0xB4, 0x94, 0xB3, 0x75, 0xCE, 0x33, 0x45, 0x01,
-    0x2C, 0xAC, 0x5A, 0x82, 0xE3, 0x95, 0x4B, 0x28, 0x10, 0x05, 0xD5, 0x39, 0x8A, 0xB1, 0xDC, 0xE0,
-    0x56, 0xBB, 0x10, 0xD6, 0x2C, 0x2C, 0xE1, 0x83, 0x3E, 0x43, 0x8A, 0x9D, 0x7C, 0x0D, 0xB2, 0xCA,
-    0x15, 0x18, 0x83, 0x42, 0x7A, 0xBD, 0x04, 0xCD, 0xF9, 0x1C, 0xEA, 0x92, 0xC5, 0xC6, 0x01, 0xC0,
-    0x21, 0xA7, 0x27, 0xE9, 0x15, 0xA8, 0x4D, 0x64, 0x2C, 0xCB, 0x78, 0x34, 0x3B, 0xD1, 0xCC, 0xAB,
-    0xCF, 0xB6, 0x2B, 0x00, 0xFE, 0x43, 0xB5, 0xA1, 0xC7, 0x61, 0x63, 0xC8, 0x9B, 0xA5, 0x25, 0x33,
-    0x7E, 0xA6, 0xDD, 0x4C, 0x3A, 0x63, 0x1B, 0x18, 0xDC, 0x4F, 0x49, 0x71, 0xD7, 0xE8, 0x54, 0x26,
-    0xD3, 0x19, 0xC9, 0x4F, 0xB6, 0x1B, 0xAF, 0x37, 0x2C, 0xCA, 0xA0, 0x47, 0x6B, 0xF3, 0xB8, 0x19,
-    0x42, 0xE5, 0x91, 0x4D, 0x54, 0x1D, 0x88, 0x1B, 0x4C, 0x31, 0x15, 0x63, 0x0E, 0xEF, 0xFB, 0xBE,
-    0xF4, 0xAF, 0x73, 0x8C, 0xE0, 0x6E, 0x65, 0x4B, 0x44, 0xAC, 0xA9, 0x14, 0x41, 0x1D, 0x04, 0x4A,
-    0x92, 0x15, 0x42, 0x7D, 0x4A, 0xE9, 0xEA, 0x81, 0xBA, 0x44, 0xCD, 0xEF, 0x73, 0x5C, 0xB4, 0x88,
-    0xDC, 0xF5, 0x60, 0x7A, 0x5A, 0xAE, 0x49, 0x00, 0xB0, 0x70, 0x14, 0x5C, 0xDD, 0x43, 0x0C, 0x3D,
-    0x4F, 0x63, 0x1B, 0xAF, 0xCF, 0x41, 0x97, 0x8B, 0xD0, 0xD2, 0xD4, 0xC4, 0x3D, 0x38, 0x8C, 0xFC,
-    0x91, 0x6E, 0xBC, 0xBE, 0x09, 0x77, 0x0B, 0xC8, 0xD6, 0x9D, 0x38, 0xE8, 0x7D, 0xC5, 0xF2, 0x88,
-    0xBD, 0x5B, 0x84, 0x90, 0x6E, 0x33, 0x39, 0xF2, 0x29, 0xA1, 0x82, 0xE1, 0x09, 0xA0, 0x82, 0x4B,
-    0x80, 0x5D, 0xB5, 0x19, 0xD5, 0x71, 0xFA, 0xAC, 0xA2, 0x06, 0x56, 0xCB, 0x82, 0x04, 0x23, 0x3D,
-    0x50, 0xB4, 0xB3, 0x60, 0xAE, 0x5D, 0x9B, 0x30, 0xFD, 0x6E, 0x51, 0x6D, 0x77, 0xE9, 0x12, 0x1C,
-    0x2D, 0x55, 0x4D, 0xC6, 0xD3, 0xD1, 0x8C, 0x85, 0x99, 0x79, 0xCE, 0x6F, 0x9A, 0xE7, 0xFC, 0x07,
-    0xFE, 0x3C, 0x3D, 0x7A, 0xA4, 0x79, 0xB2, 0xE8, 0x56, 0xE1, 0xB2, 0x92, 0x19, 0x76, 0xE0, 0xD2,
-    0xE0, 0x3A, 0xE0, 0xD8, 0x4A, 0x6D, 0xA3, 0x71, 0xD9, 0xEA, 0x52, 0xD1, 0xF0, 0x12, 0xDE, 0x87,
-    0x4B, 0x83, 0x8C, 0x04, 0xBE, 0xD7, 0x2E, 0x41, 0xE1, 0x8C, 0xD1, 0xB2, 0x58, 0x3A, 0x13, 0x11,
-    0x6F, 0x99, 0xE4, 0x59, 0x1F, 0xD1, 0x3E, 0x14, 0xE2, 0x05, 0xFA, 0x1C, 0x18, 0xAB, 0x89, 0xE4,
-    0xE8, 0xAD, 0x35, 0x28, 0x72, 0x82, 0xDE, 0x74, 0x69, 0xBC, 0x87, 0xED, 0xC6, 0x90, 0x0F, 0x7A,
-    0x1B, 0x4F, 0x60, 0x54, 0xAD, 0x35, 0x3C, 0x35, 0xF9, 0xD8, 0x45, 0xCB, 0xC2, 0x53, 0xE8, 0xE8,
-    0x86, 0xEF, 0xB2, 0x65, 0xE2, 0x67, 0x0B, 0x79, 0x04, 0x20, 0x6E, 0xF6, 0x9F, 0x96, 0x32, 0xBF,
-    0x92, 0x0B, 0xF9, 0xE2, 0x59, 0x26, 0xE4, 0x8C, 0x31, 0xC6, 0xF9, 0x0D, 0xA0, 0xF4, 0x35, 0x48,
-    0xCB, 0xDA, 0x1F, 0x2A, 0x75, 0x8E, 0x54, 0x54, 0x83, 0x01, 0x04, 0x9B, 0xEA, 0x3C, 0x9A, 0x5C,
-    0xC5, 0xEA, 0x39, 0x15, 0x8D, 0x15, 0x99, 0x00, 0xB5, 0x39, 0x2A, 0x11, 0x14, 0xD0, 0x30, 0x34,
-    0x8A, 0x4E, 0xAA, 0x4A, 0x06, 0x8D, 0xFD, 0x9B, 0xF4, 0xF8, 0x08, 0xCA, 0x3B, 0x5F, 0x57, 0x28,
-    0x8A, 0xA0, 0xF5, 0xD8, 0x17, 0xEF, 0xD4, 0x03, 0xCB, 0xBC, 0xE1, 0xE3, 0x35, 0xD8, 0x9B, 0x0C,
-    0xE4, 0x55, 0x65, 0x11, 0x2F, 0x99, 0x33, 0x86, 0x17, 0xFB, 0x3B, 0x39, 0x71, 0x62, 0x68, 0x4B,
-    0x08, 0x75, 0x05, 0x65, 0x21, 0xF5, 0x89, 0xF7, 0xA4, 0x01, 0x2A, 0xC8, 0x33, 0xFF, 0x0E, 0xF5,
-    0x13, 0xCF, 0xB4, 0x0E, 0x3A, 0xAA, 0x07, 0x46, 0x66, 0x6A, 0x9A, 0xB1, 0x73, 0xCA, 0x58, 0x7A,
-    0x53, 0x57, 0xD5, 0x41, 0x0E, 0x23, 0x68, 0x60, 0x70, 0xA3, 0x31, 0xD9, 0xCD, 0x9C, 0xC9, 0x67,
-    0x14, 0x29, 0x77, 0x6E, 0x03, 0xF8, 0x26, 0x60, 0xE5, 0xFF, 0xDC, 0x4E, 0xD3, 0x3D, 0x54, 0xEC,
-    0x85, 0x74, 0x50, 0xDA, 0xA1, 0xFA, 0x01, 0x78, 0x10, 0xCE, 0x3D, 0xC4, 0xCA, 0x22, 0xBA, 0x3F,
-    0xEF, 0x3A, 0x2E, 0xC8, 0x2D, 0x4C, 0x85, 0x03, 0x93, 0x98, 0xDC, 0x19, 0xDF, 0xF5, 0x97, 0x68,
-    0xD3, 0x61, 0x9A, 0xB5, 0x17, 0x5C, 0x1C, 0x22, 0xBC, 0x3D, 0x3A, 0x61, 0x4A, 0x53, 0x15, 0xA4,
-    0x34, 0x50, 0xE1, 0x28, 0x26, 0x9F, 0x86, 0x79, 0x37, 0xE4, 0xF1, 0xB8, 0xE3, 0x06, 0xF0, 0x3D,
-    0x0F, 0x29, 0xE4, 0x1B, 0x6D, 0x32, 0xD2, 0x3A, 0xA9, 0x28, 0x08, 0x86, 0x75, 0x48, 0x89, 0x7A,
-    0x5A, 0x2E, 0x7C, 0x66, 0x25, 0x48, 0xDA, 0x7E, 0x67, 0x11, 0xA6, 0xE2, 0x4F, 0x14, 0x68, 0x77,
-    0x91, 0xA5, 0x28, 0x38, 0x39, 0xEB, 0xE9, 0xDB, 0x5C, 0xDC, 0x9E, 0x44, 0xFC, 0xAB, 0x9B, 0x8B,
-    0x7B, 0x17, 0x17, 0xE6, 0xAC, 0x82, 0x2D, 0x3B, 0x3E, 0xED, 0xF3, 0x26, 0x1A, 0xD1, 0xBD, 0x8E,
-    0x08, 0x40, 0x88, 0x56, 0xC2, 0xF7, 0x41, 0xF7, 0xEA, 0x78, 0x6D, 0x29, 0xA9, 0x80, 0xF2, 0xFF,
-    0x00, 0x2A, 0x8E, 0x47, 0xA0, 0xFC, 0xD8, 0x4B, 0x21, 0x94, 0xE7, 0x81, 0xE3, 0x7D, 0xBE, 0x86,
-    0xE6, 0xBB, 0x4C, 0xCF, 0xF9, 0xFA, 0xD1, 0x04, 0xC3, 0xA3, 0x5F, 0x1B, 0x3D, 0x55, 0xBC, 0x3D,
-    0xF2, 0xFD, 0xD7, 0x5D, 0xF9, 0x41, 0xEF, 0xCA, 0x37, 0xC1, 0x34, 0xB2, 0xE1, 0x2C, 0xB3, 0x33,
-    0x97, 0x74, 0x3F, 0x09, 0x31, 0x8E, 0x3B, 0x39, 0x4E, 0x31, 0xD1, 0x74, 0xD5, 0xBA, 0x8B, 0xD3,
-    0x80, 0xF7, 0xA1, 0x7D, 0x2D, 0x4B, 0x90, 0x8B, 0x87, 0xF0, 0xFD, 0x84, 0x3F, 0xE8, 0x46, 0x05,
-    0x05, 0xB6, 0xB4, 0x92, 0x13, 0x03, 0x85, 0xED, 0x35, 0x5F, 0x3D, 0x31, 0x3C, 0xB4, 0xC9, 0x0F,
-    0xFE, 0x7C, 0xAD, 0xC1, 0xDE, 0xA0, 0x1B, 0x77, 0xE4, 0x1F, 0xED, 0x88, 0x0B, 0x53, 0x0E, 0xCE,
-    0x7F, 0x76, 0x1E, 0xD6, 0x33, 0x80, 0xD1, 0x07, 0x57, 0xEF, 0xA7, 0xFC, 0xA3, 0x47, 0x98, 0x56,
-    0x67, 0x4C, 0x27, 0xDD, 0x12, 0x36, 0x4D, 0xC8, 0x67, 0x08, 0xFA, 0x74, 0x1D, 0xFC, 0x8E, 0x6E,
-    0xCF, 0x5F, 0x19, 0x94, 0x15, 0x28, 0xF9, 0x31, 0xC8, 0x87, 0x1A, 0x0E, 0xE8, 0xD1, 0x58, 0xC2,
-    0xB8, 0x01, 0xE0, 0x17, 0x11, 0x0E, 0x2A, 0x28, 0x7C, 0x4B, 0x72, 0xE2, 0x39, 0x58, 0x25, 0xA3,
-    0xAF, 0x90, 0x39, 0xC5, 0xDF, 0x9D, 0x6C, 0x78, 0x50, 0xD0, 0x33, 0x52, 0xBD, 0x45, 0xF6, 0x55,
-    0xF5, 0x55, 0x4B, 0x56, 0x02, 0x0E, 0xC6, 0x27, 0x8F, 0xDD, 0x26, 0x0E, 0x62, 0xB9, 0xC3, 0x60,
-    0xB1, 0x32, 0x62, 0xB0, 0x64, 0x8A, 0x4D, 0x3C, 0x48, 0x3F, 0xCA, 0x5A, 0x23, 0x36, 0xFA, 0x8D,
-    0x30, 0x53, 0x2F, 0x3E, 0xED, 0xFD, 0xF9, 0x58, 0x12, 0x4E, 0x5E, 0xB6, 0x43, 0x30, 0x32, 0x58,
-    0x23, 0xD0, 0x64, 0xCD, 0x11, 0xA8, 0xA7, 0x92, 0x5E, 0x4F, 0x81, 0x59, 0xE3, 0xA9, 0x13, 0x90,
-    0x2F, 0xD0, 0xA1, 0xAE, 0xF4, 0x15, 0x23, 0x30, 0xD4, 0x39, 0xE2, 0x5D, 0x37, 0xC8, 0x71, 0xBD,
-    0xBF, 0x0D, 0x06, 0x17, 0x5E, 0xDE, 0x4E, 0x3A, 0xF9, 0x5E, 0x75, 0xF8, 0x97, 0xCE, 0xE8, 0xD5,
-    0x76, 0xCD, 0xFF, 0x2F, 0xA2, 0x22, 0xC5, 0x2E, 0x5C, 0xF1, 0x61, 0xC8, 0xA8, 0x6A, 0x27, 0xEF,
-    0x5D, 0xAD, 0x4C, 0x05, 0x4B, 0x2D, 0x48, 0x2D, 0x4F, 0xE1, 0x63, 0x77, 0xAB, 0x83, 0x19, 0x27,
-    0xBB, 0x91, 0x2E, 0xC4, 0x00, 0xBA, 0x15, 0x15, 0xCC, 0x49, 0xB3, 0xB4, 0xA2, 0xA5, 0xFD, 0x9A,
-    0x2E, 0x55, 0x52, 0x74, 0xBF, 0xCC, 0xAB, 0x5F, 0xBD, 0x2D, 0x85, 0xE2, 0xBE, 0xDA, 0xBB, 0xD1,
-    0x56, 0x41, 0x18, 0x37, 0x7A, 0x9D, 0xA9, 0xE7, 0x8A, 0x56, 0x99, 0x2A, 0xF1, 0xEF, 0x3E, 0x92,
-    0xD7, 0x81, 0x39, 0x9D, 0x93, 0x63, 0xAC, 0x28, 0xDF, 0x99, 0xF2, 0x24, 0x6B, 0x9D, 0xA6, 0x7B,
-    0x4D, 0x79, 0x8A, 0xEF, 0x13, 0xCC, 0xAE, 0x78, 0x63, 0xC4, 0xC9, 0x0F, 0x06, 0xD8, 0xF5, 0x63,
-    0xCF, 0x8B, 0x3D, 0xED, 0xFA, 0x3E, 0x52, 0x22, 0x0A, 0x4E, 0xD2, 0x2D, 0x10, 0x33, 0x3D, 0xE3,
-    0x39, 0x5A, 0xA7, 0xB7, 0xD4, 0xA6, 0xB9, 0x1A, 0x62, 0xE5, 0xCD, 0x96, 0xE4, 0x5C, 0x71, 0x47,
-    0xE9, 0x61, 0x56, 0x89, 0x26, 0x71, 0x63, 0xFA, 0x3C, 0x78, 0x66, 0x8A, 0x08, 0x0D, 0x0A, 0xC4,
-    0x4D, 0x86, 0xAB, 0xDB, 0xB2, 0x8B, 0x64, 0xB8, 0x52, 0x87, 0x5E, 0x62, 0x42, 0xA4, 0x53, 0x67,
-    0x9D, 0x65, 0x51, 0x7F, 0xF2, 0xC9, 0x72, 0x13, 0xF8, 0xA8, 0x2C, 0x19, 0x44, 0xFE, 0x4D, 0x2B,
-    0x00, 0x51, 0x6C, 0x35, 0x5B, 0x6D, 0xD2, 0x1A, 0x85, 0xF1, 0x0F, 0x59, 0xE2, 0x94, 0x34, 0x1E,
-    0x22, 0xFA, 0x8C, 0xEA, 0x9C, 0x09, 0x60, 0xE9, 0x40, 0x0A, 0x8B, 0x29, 0xF9, 0xDE, 0x8C, 0x45,
-    0xDF, 0x00, 0x30, 0x8B, 0xE2, 0x1C, 0x3D, 0x02, 0x63, 0x52, 0x67, 0xED, 0xAC, 0x7D, 0x18, 0x77,
-    0x3F, 0xBC, 0x34, 0x8D, 0x89, 0x90, 0x3D, 0x1F, 0x34, 0x41, 0x76, 0x86, 0x95, 0x08, 0xCF, 0x7A,
-    0x22, 0x17, 0x59, 0x77, 0x26, 0xCF, 0x75, 0xC9, 0xEC, 0xAA, 0x48, 0xC8, 0xCE, 0xD3, 0x35, 0x46,
-    0x02, 0x75, 0x7F, 0x6F, 0x43, 0x34, 0x32, 0xBF, 0xCE, 0xEF, 0x24, 0x17, 0x13, 0x6C, 0x0A, 0x86,
-    0x36, 0xEC, 0x5F, 0x3F, 0x99, 0xC9, 0x96, 0xD5, 0x4B, 0xE2, 0x13, 0xED, 0xF3, 0xD1, 0x36, 0xBD,
-    0xE1, 0x6F, 0x0C, 0xF3, 0x06, 0xDA, 0xE0, 0xA2, 0x87, 0x10, 0x5C, 0x7D, 0x09, 0x77, 0x2E, 0xA6,
-    0x3B, 0xA9, 0xC0, 0xA6, 0x16, 0xBC, 0xB9, 0xC2, 0x04, 0x15, 0x70, 0x28, 0x3C, 0x0E, 0x08, 0x41,
-    0x98, 0x32, 0x3C, 0x3A, 0x63, 0x26, 0xC5, 0x5B, 0xCA, 0x51, 0x33, 0x1D, 0x66, 0x83, 0x33, 0x9F,
-    0x22, 0xFF, 0x82, 0x66, 0xF7, 0x4E, 0xFE, 0x45, 0xAE, 0xFC, 0x8B, 0x29, 0xF3, 0xA2, 0xDC, 0x26,
-    0x49, 0x4C, 0x5B, 0x46, 0x69, 0xFB, 0x72, 0x9B, 0x85, 0x31, 0xE5, 0x5F, 0x0C, 0x21, 0xFF, 0xC2,
-    0x29, 0xFF, 0x22, 0xB9, 0x4B, 0xFE, 0x05, 0xC1, 0x73, 0xD4, 0x91, 0x22, 0x2F, 0x6F, 0xE4, 0xAF,
-    0xC9, 0x83, 0x0C, 0x20, 0xBF, 0xD7, 0xD3, 0xE3, 0x1C, 0x0C, 0xB0, 0xD1, 0xDF, 0xB8, 0x54, 0xF1,
-    0x0C, 0x8C, 0x57, 0x57, 0xBE, 0x0A, 0x29, 0x28, 0xE7, 0xF2, 0x09, 0x7F, 0x58, 0xDD, 0xC9, 0x91,
-    0xF2, 0x95, 0xB9, 0xE2, 0x14, 0x3D, 0xD3, 0xC2, 0x63, 0x26, 0x16, 0x80, 0x28, 0x46, 0x86, 0x00,
-    0x72, 0xB1, 0xB3, 0xB9, 0xFF, 0x03, 0x86, 0xDB, 0x4B, 0xC6, 0xC2, 0xE4, 0x7B, 0xA4, 0x77, 0x86,
-    0x7D, 0x59, 0x88, 0xEA, 0xFA, 0x99, 0x34, 0x8A, 0x15, 0xF9, 0x02, 0xB4, 0x91, 0x5E, 0xA4, 0x51,
-    0xCA, 0x1D, 0x9A, 0x48, 0x07, 0x69, 0x2D, 0x98, 0xF2, 0xFC, 0x5A, 0xF9, 0x78, 0x86, 0x9B, 0x9A,
-    0x21, 0x0B, 0xE5, 0x33, 0x2F, 0x6B, 0x53, 0x7D, 0x23, 0x9F, 0xC6, 0xD6, 0x6A, 0x99, 0x3E, 0x8F,
-    0x3D, 0xC5, 0x14, 0xAD, 0x41, 0xE9, 0x5C, 0x0D, 0x9E, 0x2A, 0xC0, 0x06, 0x20, 0x25, 0xD7, 0xA0,
-    0x60, 0xFF, 0x1F, 0x27, 0x0A, 0x9E, 0x09, 0x96, 0x05, 0xC3, 0x31, 0x8C, 0xEB, 0x65, 0x2D, 0x29,
-    0xC0, 0xBF, 0x2E, 0x0A, 0x1E, 0x8E, 0x52, 0x70, 0x66, 0x08, 0xB5, 0xDE, 0x50, 0xB0, 0x7D, 0x16,
-    0x4A, 0x61, 0x4B, 0x6B, 0xE5, 0xC2, 0x17, 0x4B, 0xD9, 0x4A, 0xFE, 0xC9, 0xC1, 0x90, 0xA1, 0x51,
-    0x27, 0xAD, 0x7B, 0x0F, 0xDD, 0x81, 0xD9, 0x85, 0x14, 0x1E, 0xAA, 0xD2, 0x8C, 0xE6, 0x58, 0xCC,
-    0x34, 0x84, 0xA1, 0x43, 0x4C, 0x7A, 0x1E, 0xE2, 0xD0, 0xDE, 0x85, 0x34, 0x36, 0x16, 0x07, 0xD1,
-    0x46, 0x52, 0x5E, 0x1E, 0x2E, 0x15, 0x6F, 0xF2, 0x92, 0xF2, 0xD8, 0x52, 0xA8, 0x9F, 0x7C, 0x4A,
-    0x89, 0x79, 0x4C, 0x09, 0x50, 0x28, 0x5B, 0x89, 0x6C, 0x69, 0x08, 0x72, 0x2B, 0x33, 0x4F, 0xB9,
-    0x5A, 0x16, 0x62, 0x27, 0xC7, 0x54, 0xD4, 0xE9, 0x39, 0xCB, 0x24, 0x2A, 0x95, 0xF1, 0x6F, 0x76,
-    0xA0, 0x94, 0x40, 0xA5, 0x16, 0x93, 0xBE, 0x4C, 0xFA, 0x15, 0x06, 0x64, 0x03, 0x40, 0x6C, 0xC6,
-    0xCC, 0xC3, 0x1A, 0xDD, 0xA3, 0x64, 0x1A, 0x31, 0x23, 0x48, 0x8B, 0x8A, 0x71, 0xD3, 0x8F, 0x67,
-    0xAF, 0xA9, 0x1C, 0x87, 0x98, 0x21, 0xFA, 0x12, 0x6A, 0xC6, 0x76, 0x7A, 0x05, 0x7B, 0x60, 0xBE,
-    0x2C, 0x12, 0xB0, 0x72, 0xEE, 0x96, 0xDC, 0xCD, 0x6F, 0x62, 0xF7, 0xB5, 0x5F, 0x60, 0x77, 0x94,
-    0x80, 0xA6, 0x51, 0x95, 0xD0, 0x9D, 0x0B, 0x8C, 0xE1, 0x6E, 0x2F, 0x1F, 0x30, 0xE0, 0x76, 0x5D,
-    0x62, 0xE3, 0x75, 0xFA, 0xDE, 0xD5, 0x7D, 0x51, 0x41, 0xBA, 0x95, 0x41, 0x62, 0x6B, 0x91, 0x46,
-    0x91, 0xDD, 0x3D, 0xA2, 0x38, 0x45, 0xEC, 0x16, 0x47, 0xA2, 0x8C, 0xF7, 0x30, 0xA2, 0x18, 0xB0,
-    0xB6, 0x52, 0x64, 0xAD, 0x09, 0xC1, 0x9F, 0x3C, 0xEC, 0x28, 0x2B, 0x52, 0x99, 0x84, 0xF9, 0xED,
-    0x97, 0xE8, 0x16, 0x5F, 0xC8, 0x6A, 0xCA, 0x47, 0x26, 0x70, 0xB2, 0x12, 0xAE, 0x61, 0xFA, 0x86,
-    0x9B, 0x76, 0xC0, 0xE3, 0xAB, 0x43, 0x79, 0x1E, 0x87, 0x64, 0x27, 0x78, 0xFA, 0x19, 0x92, 0x9D,
-    0xBE, 0x56, 0xAD, 0x8B, 0x0F, 0x3E, 0x44, 0x7F, 0x7F, 0xE2, 0x8F, 0x26, 0x3B, 0x01, 0x63, 0x0E,
-    0x4F, 0x52, 0xFB, 0xF8, 0xAD, 0x4F, 0x91, 0xEC, 0xF4, 0x79, 0x1D, 0xA1, 0x7B, 0x04, 0x5E, 0x7A,
-    0x12, 0x9B, 0xE4, 0x66, 0xC7, 0xBC, 0xC7, 0xA3, 0x8E, 0x50, 0x2A, 0x4D, 0x2F, 0x9E, 0x21, 0x5F,
-    0x4F, 0x98, 0xB2, 0x10, 0x7D, 0x8C, 0x23, 0x34, 0x7C, 0xBA, 0xA9, 0x02, 0x4F, 0x99, 0x52, 0xAF,
-    0x79, 0x65, 0x28, 0x28, 0x75, 0x8F, 0x3D, 0xBA, 0x71, 0x49, 0x21, 0x51, 0x35, 0xF0, 0xAB, 0xEC,
-    0x28, 0xC5, 0x49, 0xF9, 0xBC, 0x53, 0x06, 0x38, 0x39, 0x02, 0x95, 0x31, 0xBE, 0xBB, 0x62, 0x92,
-    0x4A, 0x60, 0xB1, 0x3F, 0xC0, 0x20, 0x64, 0xDD, 0x74, 0xF2, 0x41, 0xD1, 0x41, 0x7A, 0xF7, 0xC3,
-    0xD8, 0xFF, 0x23, 0x4D, 0xA0, 0x39, 0x31, 0xE2, 0x33, 0x66, 0xB0, 0x1F, 0x2B, 0x0F, 0x94, 0xF6,
-    0xA5, 0x80, 0xF5, 0xF2, 0xB3, 0x67, 0xB0, 0x5B, 0x82, 0xAD, 0xB2, 0xC5, 0x20, 0x76, 0x3D, 0xA4,
-    0xF9, 0xB2, 0x58, 0x94, 0xEB, 0xB4, 0xCE, 0x3A, 0x50, 0xF8, 0xE8, 0xFE, 0xF8, 0xCB, 0xFE, 0x05,
-    0x85, 0xA1, 0xE7, 0xA6, 0x19, 0x06, 0x5F, 0x2F, 0xDD, 0x6A, 0xEC, 0x3C, 0x8D, 0xB7, 0xDC, 0xA0,
-    0xA1, 0x8A, 0x41, 0x0B, 0x04, 0x8F, 0xB6, 0xEB, 0x8A, 0x83, 0xEF, 0x28, 0x77, 0x20, 0x55, 0x6E,
-    0xCD, 0xA0, 0xE4, 0xD5, 0x15, 0x77, 0x1F, 0x99, 0x54, 0xE5, 0x76, 0xDF, 0x4A, 0x1C, 0xEA, 0x49,
-    0x3F, 0x56, 0x68, 0xB3, 0xDB, 0x13, 0xD1, 0xC5, 0x0C, 0x4B, 0x2B, 0x5A, 0x4D, 0xF1, 0xC7, 0xD4,
-    0x9C, 0x21, 0xEC, 0x42, 0x46, 0x0F, 0x94, 0x51, 0x9C, 0xDF, 0x55, 0xDA, 0xCB, 0xEA, 0x5B, 0x4D,
-    0xFE, 0xD2, 0x50, 0xC3, 0x58, 0xD3, 0xF1, 0xD7, 0x91, 0xFB, 0x0C, 0x53, 0x12, 0xD9, 0xA4, 0x63,
-    0xA9, 0x12, 0x52, 0xB1, 0xD2, 0xD8, 0x5F, 0xAA, 0xE8, 0x71, 0xFB, 0x3F, 0x0E, 0xD2, 0x12, 0xE4,
-    0xB8, 0x8A, 0x8C, 0x07, 0xC6, 0x63, 0x75, 0xDE, 0xD4, 0x96, 0x52, 0x41, 0x8D, 0x45, 0xD5, 0xC6,
-    0xCC, 0xCE, 0xCF, 0x98, 0x01, 0x4E, 0x9B, 0x3F, 0xA6, 0x41, 0x4D, 0xAD, 0xFA, 0x7D, 0x4E, 0xD2,
-    0x2A, 0xE8, 0x20, 0x52, 0xAF, 0xCA, 0xE9, 0x88, 0x22, 0xFF, 0xAC, 0x94, 0xA6, 0x46, 0x0E, 0x7B,
-    0xF7, 0xFF, 0x75, 0xE6, 0xFB, 0x30, 0x65, 0xBE, 0xFB, 0x4D, 0xA1, 0xDB, 0x24, 0xA4, 0x8D, 0x33,
-    0xEF, 0xE6, 0xD3, 0x00, 0xE0, 0xE1, 0x93, 0x4D, 0xA2, 0x62, 0xB6, 0x7C, 0x30, 0x82, 0xAB, 0xBD,
-    0x05, 0x57, 0xCB, 0xD5, 0x91, 0x54, 0xA0, 0xE0, 0x17, 0x9D, 0x75, 0x47, 0x7B, 0xDD, 0xDC, 0xBF,
-    0x24, 0xFF, 0xB3, 0x77, 0x4D, 0xF2, 0x97, 0xE6, 0xDE, 0x07, 0xD3, 0xEA, 0xB7, 0xCE, 0xA8, 0xF4,
-    0x99, 0x18, 0xDF, 0x6E, 0x8A, 0x96, 0xDC, 0xBD, 0x8B, 0x0C, 0xFF, 0xCB, 0xD6, 0x92, 0x9E, 0xF0,
-    0x3F, 0x7B, 0x8F, 0xBA, 0xF2, 0xDA, 0x8A, 0x07, 0x4F, 0x3F, 0x70, 0xB5, 0x7E, 0x7E, 0x9B, 0x67,
-    0x69, 0x60, 0x88, 0x86, 0xED, 0xD6, 0xF5, 0x3B, 0xDB, 0xAF, 0xDE, 0x2F, 0x9B, 0x98, 0xE9, 0xD2,
-    0x96, 0xA8, 0x28, 0x1B, 0xCB, 0x12, 0x13, 0xB7, 0x9B, 0x3F, 0x36, 0x2D, 0x92, 0x69, 0x32, 0xF4,
-    0x80, 0x53, 0xDE, 0x32, 0x49, 0x96, 0x3A, 0xCE, 0xB6, 0x1C, 0x23, 0xFF, 0xB9, 0x92, 0x7C, 0x68,
-    0x3A, 0xB4, 0x4D, 0x49, 0x88, 0x9C, 0x24, 0xFD, 0x14, 0xED, 0x2F, 0x04, 0xB6, 0x33, 0x44, 0xCC,
-    0x62, 0x82, 0x1B, 0xB1, 0xAA, 0x38, 0xBC, 0x25, 0xB0, 0x9E, 0x24, 0xA2, 0xE3, 0x36, 0x41, 0xEE,
-    0xA4, 0x32, 0xCD, 0xD1, 0x40, 0xC8, 0x93, 0x16, 0xDB, 0xCD, 0xAC, 0xCE, 0x98, 0x5A, 0x32, 0xD5,
-    0xE3, 0x9A, 0x6E, 0xB7, 0xDC, 0x9F, 0x14, 0xEF, 0x36, 0xC4, 0xD6, 0xAC, 0x46, 0x17, 0x72, 0xAA,
-    0x89, 0xA9, 0x8A, 0x23, 0x18, 0x85, 0x6D, 0xC0, 0xFB, 0xCA, 0x3F, 0x8B, 0xFC, 0xD7, 0x8A, 0x85,
-    0x2B, 0x5F, 0x4F, 0x57, 0x2E, 0x7B, 0xFF, 0xB5, 0xDA, 0x14, 0x18, 0x73, 0xF5, 0x97, 0x6F, 0x97,
-    0x3C, 0xF9, 0x2A, 0xA0, 0xD3, 0x37, 0xCC, 0xA7, 0x7C, 0x34, 0x27, 0x33, 0xA5, 0x27, 0x98, 0xC1,
-    0xFB, 0x0A, 0xAC, 0x0E, 0x4A, 0xC2, 0xDA, 0x98, 0xB4, 0xD1, 0xD7, 0x27, 0x21, 0x0E, 0x35, 0x98,
-    0x9A, 0x8E, 0xBE, 0x42, 0x88, 0x53, 0x49, 0x9A, 0x09, 0x02, 0xFF, 0xEB, 0x7E, 0x15, 0x4F, 0x1C,
-    0x13, 0xFE, 0xAC, 0x36, 0xCA, 0x5A, 0xEF, 0x82, 0x3A, 0x66, 0xE6, 0x06, 0x86, 0xF4, 0x18, 0x49,
-    0xAA, 0x80, 0x9E, 0x43, 0xF3, 0xAC, 0x5A, 0xA1, 0x49, 0xA8, 0x63, 0x07, 0xD0, 0x67, 0x13, 0xE6,
-    0x77, 0x71, 0xCE, 0xAA, 0x57, 0xA6, 0xAC, 0x86, 0xC4, 0xBC, 0x65, 0x67, 0x68, 0x10, 0x5D, 0x65,
-    0x82, 0x31, 0xCC, 0x50, 0x10, 0xA0, 0xEC, 0x43, 0x47, 0xF8, 0x82, 0xC1, 0xC5, 0x1E, 0x84, 0xFD,
-    0x77, 0x98, 0x0C, 0x11, 0xFF, 0x44, 0x53, 0xD1, 0x42, 0xB2, 0x29, 0xE9, 0xE4, 0xEC, 0xB5, 0xB4,
-    0xAD, 0xEB, 0x2C, 0x45, 0xFE, 0x47, 0xF2, 0xE3, 0x26, 0x6D, 0xA8, 0xCB, 0xFD, 0xC1, 0x9C, 0x25,
-    0xC9, 0x5E, 0xF9, 0x04, 0x8B, 0x6A, 0x01, 0xC5, 0x1C, 0x37, 0x28, 0xFD, 0xB7, 0x55, 0x38, 0x2D,
-    0x1D, 0xCE, 0x58, 0xA2, 0xB6, 0x49, 0x02, 0xAB, 0xF7, 0x06, 0xAE, 0x58, 0xED, 0xEE, 0x90, 0x9A,
-    0xDD, 0xFC, 0x84, 0x34, 0x67, 0x09, 0x57, 0x3E, 0xA9, 0xBC, 0x36, 0x4B, 0xF8, 0x52, 0x16, 0xA2,
-    0x1C, 0xF0, 0xF5, 0x3C, 0x94, 0xE7, 0x97, 0x52, 0x1D, 0x9A, 0x44, 0xC1, 0xB6, 0x9E, 0xC5, 0xE5,
-    0x6E, 0x9B, 0xF2, 0x10, 0x5D, 0xA0, 0x02, 0x09, 0x20, 0xE0, 0x4D, 0x33, 0x86, 0xCA, 0x49, 0x53,
-    0x8C, 0x0F, 0x55, 0x7F, 0x96, 0xD6, 0x65, 0x5D, 0x2E, 0xE7, 0x4D, 0xD6, 0x42, 0x22, 0x3C, 0x23,
-    0xC2, 0x62, 0x7B, 0x4A, 0x7B, 0x97, 0x78, 0xCA, 0x0E, 0x08, 0x60, 0x51, 0x17, 0x2E, 0x3C, 0x61,
-    0x2E, 0x7F, 0x19, 0xCC, 0xEA, 0x91, 0x48, 0x8C, 0x86, 0x10, 0xFD, 0x9C, 0x9C, 0x36, 0x09, 0xB9,
-    0x63, 0xA1, 0x48, 0xA3, 0xB1, 0x5C, 0xF8, 0xC6, 0x4A, 0x9D, 0x6A, 0x2A, 0x69, 0xD9, 0x30, 0x15,
-    0x55, 0x7C, 0xFC, 0x17, 0xE3, 0xA5, 0x53, 0x65, 0xC6, 0xED, 0x5F, 0xCB, 0x4F, 0x7E, 0x7C, 0xD3,
-    0x0A, 0x20, 0x66, 0x95, 0x1A, 0x9D, 0x75, 0xA9, 0xB7, 0x2E, 0xF5, 0xBB, 0x2B, 0x49, 0x04, 0x9B,
-    0x2A, 0xB1, 0x00, 0x4A, 0x6C, 0x5F, 0xA1, 0xA0, 0x34, 0x7C, 0xB9, 0x0B, 0x53, 0x5C, 0x30, 0x65,
-    0x13, 0x2B, 0xE6, 0x2E, 0x03, 0x4F, 0xE4, 0xE4, 0xEA, 0x2C, 0x7D, 0x62, 0x77, 0x57, 0x49, 0x55,
-    0xAA, 0x93, 0xA7, 0x16, 0x73, 0x87, 0x1B, 0x2C, 0xF5, 0x02, 0x50, 0x99, 0x12, 0x2E, 0xFA, 0xD4,
-    0xB0, 0x40, 0xD5, 0xAA, 0xD1, 0xB8, 0x49, 0xA2, 0x37, 0xEE, 0x64, 0x35, 0xAE, 0xCF, 0x84, 0x32,
-    0xA7, 0x5B, 0xC1, 0x8E, 0x78, 0xCF, 0xB2, 0x0C, 0x60, 0xBC, 0x51, 0x4F, 0xBD, 0x3C, 0xD8, 0xB0,
-    0xE3, 0xD6, 0xCA, 0x55, 0xB2, 0xDA, 0xEA, 0x55, 0xCA, 0x50, 0xCB, 0xF2, 0xD2, 0xB4, 0x16, 0x41,
-    0xA8, 0x81, 0x99, 0x8A, 0x60, 0x42, 0x15, 0xCC, 0x04, 0xDE, 0xA9, 0x0E, 0x66, 0xAA, 0x76, 0x09,
-    0x4F, 0x6F, 0x56, 0x32, 0x08, 0xB5, 0x30, 0xDB, 0xCB, 0x6B, 0x33, 0x60, 0x05, 0xE4, 0x75, 0x30,
-    0xA6, 0x57, 0xE9, 0xA6, 0x20, 0x66, 0x0B, 0xB7, 0x00, 0x38, 0x7F, 0x55, 0xB7, 0xF5, 0x82, 0x41,
-    0xBE, 0x22, 0x3C, 0x9E, 0xB5, 0x83, 0x6C, 0xA9, 0x83, 0xC6, 0xC0, 0x67, 0xF0, 0x73, 0x06, 0x40,
-    0x03, 0x9B, 0x33, 0x10, 0x1E, 0x39, 0x10, 0x14, 0xAF, 0x3B, 0x81, 0x71, 0x25, 0x73, 0xB6, 0x0F,
-    0x05, 0x2F, 0x8B, 0x50, 0xC7, 0x6F, 0x69, 0x89, 0x21, 0x0F, 0xD7, 0xBF, 0xB3, 0xAF, 0xB2, 0x0D,
-    0xF6, 0xB9, 0x5A, 0x1B, 0x49, 0xCD, 0x2C, 0x37, 0xBF, 0x55, 0x09, 0xA7, 0x06, 0x9C, 0x7F, 0xF4,
-    0x96, 0x3F, 0xBF, 0x68, 0xB7, 0xA8, 0x53, 0x12, 0xD0, 0x56, 0xC5, 0x66, 0xF9, 0x44, 0xD6, 0x4A,
-    0xA6, 0xF4, 0xCE, 0x84, 0xDE, 0xF0, 0xD0, 0x8A, 0x69, 0xC8, 0x15, 0x15, 0x8D, 0xF0, 0x22, 0x11,
-    0xB4, 0x92, 0xB1, 0x45, 0x39, 0x74, 0x69, 0x65, 0x4C, 0xFA, 0x80, 0x6E, 0xFD, 0x4B, 0xD9, 0x69,
-    0xBD, 0xA3, 0x2F, 0xE2, 0x2A, 0x85, 0xFC, 0xA4, 0x31, 0x14, 0x21, 0xE4, 0x1B, 0x4D, 0x01, 0xEA,
-    0x2C, 0xA8, 0x3E, 0x7B, 0x46, 0x6F, 0x41, 0x91, 0xDE, 0x94, 0x19, 0xD0, 0xED, 0x72, 0x7E, 0x77,
-    0x71, 0x8C, 0x29, 0x1B, 0x5A, 0x99, 0xA5, 0xB6, 0x24, 0x4B, 0x3C, 0x68, 0x1A, 0xCD, 0xBB, 0x47,
-    0x90, 0x4A, 0x36, 0xD2, 0xEF, 0xF7, 0xA7, 0x2F, 0xE9, 0xA2, 0x94, 0x1A, 0xB1, 0x3B, 0xF9, 0x01,
-    0x7F, 0x4E, 0xED, 0x49, 0x4B, 0x42, 0xE8, 0x49, 0xFA, 0xE6, 0x17, 0xF2, 0x65, 0xCA, 0x49, 0x98,
-    0xF6, 0xE5, 0x81, 0xCC, 0xFF, 0xCA, 0xBF, 0x62, 0xC9, 0x42, 0x20, 0xFA, 0x85, 0x79, 0x2E, 0x42,
-    0x99, 0xC5, 0xE4, 0xAE, 0x09, 0xAB, 0xB8, 0x98, 0x13, 0xD2, 0x4C, 0x16, 0xE7, 0x7E, 0xF7, 0x48,
-    0xDD, 0xBF, 0x05, 0x72, 0x8E, 0x5D, 0xB0, 0x21, 0x8A, 0x02, 0x2B, 0x15, 0x6C, 0x00, 0xC0, 0x5F,
-    0x61, 0x24, 0x01, 0xCA, 0xED, 0x5A, 0x19, 0xD9, 0xE4, 0x77, 0xEB, 0xF4, 0xC0, 0x56, 0x39, 0x81,
-    0x1A, 0x99, 0x77, 0x94, 0xFC, 0x0B, 0x5F, 0xE7, 0x80, 0x9E, 0xCE, 0x65, 0x3D, 0xFD, 0x00, 0x40,
-    0xF8, 0xAA, 0xA1, 0xE6, 0xFC, 0x0A, 0xD4, 0x48, 0x5C, 0x92, 0x66, 0x0D, 0x8C, 0xE3, 0xA5, 0x0A,
-    0x33, 0x42, 0xAF, 0x01, 0xD3, 0x72, 0x3B, 0x39, 0xB9, 0xF3, 0xA6, 0x62, 0x48, 0xA9, 0xF8, 0x90,
-    0x3C, 0xA4, 0x2E, 0x45, 0x01, 0x07, 0x7E, 0x3C, 0x56, 0xCF, 0x02, 0x62, 0x55, 0xA0, 0xBD, 0x4E,
-    0x79, 0x2B, 0xFB, 0x18, 0xC2, 0x5F, 0x6A, 0x54, 0x6B, 0x59, 0x36, 0x8F, 0x32, 0x1A, 0x06, 0xE6,
-    0xCC, 0x24, 0xB8, 0x9E, 0xFE, 0x68, 0x70, 0xCB, 0xBA, 0x3A, 0xE7, 0x93, 0x3E, 0x6D, 0xD9, 0x2C,
-    0xC0, 0x86, 0x09, 0x6F, 0xB3, 0xC6, 0x73, 0xD7, 0xCE, 0x96, 0xB5, 0x3F, 0xC7, 0xF0, 0x47, 0x5F,
-    0xA2, 0xFF, 0xF9, 0x4D, 0x48, 0xF5, 0xD6, 0xF7, 0x0F, 0x59, 0x8D, 0xA0, 0xD1, 0x42, 0xB4, 0xAF,
-    0x25, 0x25, 0xBE, 0xA8, 0xF2, 0xA5, 0x6C, 0x3D, 0x2D, 0xD0, 0x20, 0xED, 0xFE, 0x0C, 0x0B, 0xA6,
-    0x79, 0x5E, 0xD3, 0xB5, 0xF5, 0xC2, 0xFD, 0x0A, 0x89, 0x4F, 0x96, 0x24, 0x80, 0xE6, 0xCE, 0xA2,
-    0xC5, 0xEF, 0xC9, 0x41, 0x14, 0x5F, 0x21, 0x91, 0x59, 0xFF, 0x8F, 0xBB, 0x2F, 0xAA, 0x7E, 0x6A,
-    0xED, 0xCC, 0xF1, 0x12, 0x05, 0x29, 0x6D, 0x22, 0x23, 0x17, 0x4E, 0x2A, 0xAA, 0x63, 0x3E, 0x38,
-    0x13, 0x13, 0xC6, 0xA6, 0x1F, 0x76, 0xF7, 0x38, 0x77, 0xAB, 0x0B, 0xC6, 0x88, 0x31, 0xD4, 0x1D,
-    0x1D, 0x76, 0x38, 0xAA, 0xC3, 0xFE, 0x35, 0xC3, 0x03, 0xAA, 0x86, 0x05, 0x17, 0xA4, 0xC7, 0x35,
-    0xE6, 0xDF, 0x4A, 0x19, 0x48, 0x35, 0xF5, 0x11, 0x58, 0x88, 0xE4, 0xFD, 0xAD, 0xD2, 0x3B, 0x7B,
-    0x05, 0x8B, 0x87, 0x54, 0x6B, 0x92, 0xA8, 0xB2, 0xCB, 0x6B, 0x40, 0x36, 0xCE, 0xCA, 0xC0, 0x62,
-    0xA3, 0xED, 0x3E, 0x71, 0x6B, 0x1E, 0x77, 0xB9, 0xEC, 0xC3, 0xF6, 0xE3, 0x83, 0x37, 0xA5, 0x82,
-    0x37, 0xED, 0x1D, 0x83, 0x37, 0xCB, 0x29, 0x78, 0xD3, 0x8F, 0xB7, 0xBB, 0x7E, 0x39, 0x33, 0x7E,
-    0x1B, 0xBC, 0x29, 0xEB, 0x3B, 0xED, 0x56, 0x8A, 0xB8, 0x69, 0xD1, 0x06, 0xB1, 0x45, 0xE6, 0x65,
-    0x7D, 0x12, 0x60, 0xD6, 0xB3, 0xF1, 0x4E, 0x25, 0x6F, 0xF1, 0x68, 0x80, 0x29, 0x6E, 0x03, 0x8C,
-    0x32, 0x63, 0xC2, 0xF6, 0x78, 0x39, 0x9C, 0xBE, 0xD7, 0x80, 0x69, 0x68, 0x8F, 0xDE, 0x31, 0xAA,
-    0xF5, 0x1C, 0xBD, 0x01, 0xBD, 0xFA, 0x70, 0xF3, 0x68, 0x54, 0x4B, 0x68, 0x1A, 0x54, 0x9B, 0x4F,
-    0x0F, 0x18, 0x2B, 0x72, 0x9B, 0x29, 0x29, 0xA6, 0xC9, 0x3C, 0x58, 0x2A, 0x15, 0x26, 0x3D, 0x60,
-    0x55, 0x6E, 0x33, 0x56, 0xD1, 0xF1, 0x09, 0xC5, 0x91, 0x8B, 0xC1, 0x3C, 0x1C, 0xA2, 0x14, 0x8B,
-    0xB7, 0xBA, 0x7C, 0xDC, 0x2E, 0xC1, 0x15, 0x04, 0x90, 0xC9, 0xA3, 0x99, 0x17, 0xB3, 0x29, 0xAF,
-    0xC9, 0xEA, 0x57, 0xA1, 0x1B, 0xD9, 0x2D, 0x99, 0x81, 0x6A, 0xB9, 0x55, 0x41, 0xE0, 0xAC, 0xD2,
-    0xED, 0x07, 0x12, 0x79, 0x5C, 0x23, 0x2A, 0xF3, 0x61, 0x65, 0x2F, 0x93, 0x71, 0x66, 0xEC, 0x87,
-    0xFA, 0x1F, 0x33, 0xF5, 0x43, 0x06, 0x54, 0xBE, 0xAB, 0x99, 0xDD, 0xDB, 0x9C, 0xBB, 0x7F, 0x50,
-    0xCE, 0xDD, 0x59, 0xE6, 0xDC, 0xD5, 0x53, 0xC6, 0x9F, 0xB9, 0x1B, 0x4C, 0x49, 0x63, 0x37, 0x62,
-    0xF5, 0x52, 0xC9, 0xB7, 0x3F, 0xD1, 0xF2, 0x53, 0x9C, 0xD0, 0xCE, 0x0E, 0xC7, 0x79, 0x5B, 0x36,
-    0xB4, 0x27, 0x8A, 0xD8, 0xA7, 0xB0, 0xD3, 0xE6, 0x8D, 0x1D, 0xFE, 0x6B, 0x1C, 0x2E, 0x4A, 0x95,
-    0x77, 0xC8, 0x1C, 0x8E, 0x03, 0x7F, 0xBB, 0x97, 0x87, 0x2D, 0x2B, 0xF5, 0x42, 0x7A, 0x5B, 0x6D,
-    0x8B, 0x50, 0xF8, 0xD9, 0x4E, 0xB1, 0xDE, 0x54, 0xAD, 0x17, 0xCA, 0xF5, 0xA6, 0x7A, 0xBD, 0x50,
-    0xB0, 0x37, 0x55, 0xEC, 0x4D, 0x25, 0x7B, 0xEE, 0xDB, 0x6E, 0x93, 0x5F, 0xF6, 0xAA, 0x38, 0x59,
-    0x5F, 0xFA, 0x73, 0x1F, 0xF8, 0xB7, 0xAF, 0x02, 0x2F, 0xD2, 0xEE, 0xC7, 0x69, 0x37, 0x6F, 0xFC,
-    0x73, 0x2B, 0xBF, 0xFC, 0x7A, 0xDA, 0xFD, 0x15, 0x05, 0x3D, 0x55, 0x9C, 0x25, 0x45, 0xFE, 0xA7,
-    0x3F, 0x50, 0xEF, 0x0E, 0x4C, 0x0F, 0x6D, 0xD2, 0xA0, 0x8E, 0x6E, 0xB8, 0xAC, 0x29, 0xC3, 0x41,
-    0x1B, 0x0E, 0x5E, 0x02, 0x63, 0xB4, 0xEE, 0x19, 0xAB, 0x27, 0x7C, 0x4A, 0x33, 0x00, 0x04, 0xEE,
-    0xE8, 0x42, 0xCD, 0xFB, 0xB0, 0xBE, 0x4C, 0x58, 0x59, 0xE6, 0x2E, 0x07, 0xE9, 0x60, 0x2B, 0x4F,
-    0xB5, 0x3C, 0x48, 0xFC, 0x44, 0xD0, 0x5E, 0xA9, 0x2C, 0x42, 0xDF, 0xEF, 0xBC, 0x60, 0x88, 0x68,
-    0x12, 0xC2, 0xDD, 0xF5, 0x40, 0x39, 0x15, 0x13, 0xE5, 0x15, 0x21, 0x89, 0x30, 0x60, 0xAF, 0x05,
-    0xC3, 0x42, 0x06, 0xDF, 0xDD, 0xB1, 0x37, 0x67, 0xC5, 0xDE, 0x6B, 0x04, 0xEF, 0xBA, 0x64, 0x29,
-    0xA8, 0xB2, 0x28, 0x99, 0xBC, 0xDD, 0x59, 0x4A, 0x25, 0x17, 0x3A, 0x58, 0x2A, 0xA1, 0xD2, 0xC4,
-    0xB2, 0xCA, 0x4C, 0x58, 0xB6, 0xB3, 0x9C, 0x92, 0x29, 0x95, 0x38, 0x24, 0x85, 0x71, 0xCF, 0x5B,
-    0x4A, 0xE5, 0x6A, 0xE2, 0x37, 0xEA, 0x8A, 0x41, 0x51, 0x5E, 0xC9, 0x74, 0x1B, 0x58, 0x7E, 0xE6,
-    0xF3, 0x14, 0x64, 0x5E, 0x6D, 0x54, 0x90, 0xF9, 0x8C, 0x0A, 0x32, 0xCF, 0xDC, 0xAD, 0x20, 0xB3,
-    0x52, 0x41, 0x66, 0x7C, 0x4D, 0x4B, 0x2E, 0x36, 0x82, 0xD7, 0x57, 0x3F, 0xB9, 0x20, 0x73, 0x1B,
-    0x64, 0x7F, 0x8B, 0x61, 0x92, 0x86, 0xE9, 0x04, 0xF5, 0x47, 0xE3, 0xE9, 0x7F, 0x44, 0xD5, 0xFB,
-    0x5F, 0x15, 0x72, 0xC9, 0xCB, 0x5F, 0xEE, 0xE9, 0xA9, 0x23, 0xE4, 0x79, 0xD2, 0xC5, 0x27, 0x37,
-    0xA1, 0xE7, 0x3D, 0x86, 0x7C, 0xD2, 0x60, 0x0C, 0xAC, 0x14, 0x6F, 0xB2, 0xB2, 0x71, 0xAD, 0x50,
-    0xB6, 0x89, 0x5A, 0x7E, 0x4C, 0xDD, 0xE8, 0xEF, 0x5F, 0xB2, 0x78, 0x54, 0xC0, 0x8F, 0xB5, 0x5E,
-    0x27, 0xE3, 0x32, 0x31, 0x4B, 0xC0, 0xEF, 0xC0, 0x28, 0xAC, 0x19, 0x10, 0x82, 0x85, 0xBA, 0x60,
-    0xAB, 0x0E, 0x30, 0xAD, 0x9C, 0xF5, 0x4E, 0x63, 0xAE, 0x2C, 0xEF, 0xD7, 0x99, 0x64, 0x84, 0x07,
-    0x6F, 0xCB, 0x60, 0x49, 0xB6, 0x19, 0x2C, 0xD6, 0x8B, 0x23, 0x69, 0x2B, 0xF4, 0x91, 0x17, 0xBF,
-    0xF0, 0x83, 0xB3, 0x1A, 0xB1, 0xE0, 0x96, 0xBF, 0x0E, 0x3E, 0xCD, 0x10, 0xF1, 0xA7, 0x4D, 0x5B,
-    0xF9, 0xD8, 0x0C, 0x16, 0xF9, 0x4C, 0x9D, 0x85, 0x52, 0x9C, 0x05, 0x2F, 0xC2, 0xDB, 0xF4, 0x8E,
-    0x75, 0x34, 0x63, 0x96, 0xD3, 0x0A, 0x8A, 0x33, 0xBA, 0x7D, 0x72, 0xCD, 0x00, 0xE6, 0x50, 0x3C,
-    0x49, 0x47, 0xC0, 0xC1, 0x48, 0xA3, 0xA4, 0x7C, 0xD7, 0xFB, 0xC3, 0x4B, 0x97, 0xFD, 0xF3, 0x66,
-    0x79, 0x59, 0x85, 0x67, 0xBB, 0x57, 0x8D, 0x97, 0x2E, 0x31, 0x7F, 0xAE, 0x71, 0x9B, 0xE5, 0x0A,
-    0x19, 0x84, 0x76, 0x9B, 0x8C, 0x8C, 0x69, 0xA9, 0x2F, 0x7A, 0x0A, 0x7F, 0x9B, 0xE0, 0xBE, 0x71,
-    0x25, 0x64, 0x0B, 0xAC, 0x26, 0xE0, 0x93, 0xA5, 0xA9, 0x86, 0x5F, 0x11, 0xCC, 0xE8, 0xD2, 0x22,
-    0x88, 0x31, 0x22, 0xCF, 0x43, 0xE9, 0x78, 0xA5, 0xCF, 0x58, 0x59, 0x75, 0xF2, 0x1A, 0x90, 0xE5,
-    0xDD, 0x86, 0x11, 0xC1, 0xD1, 0xBF, 0xF3, 0x4D, 0x4B, 0xEC, 0xD5, 0x22, 0x3C, 0xEB, 0xD8, 0xEF,
-    0xEF, 0x9F, 0x0A, 0xFE, 0xA2, 0x6E, 0xE3, 0x8F, 0xF4, 0x07, 0xBF, 0xFF, 0x57, 0x94, 0x82, 0x86,
-    0xC6, 0x2A, 0x0D, 0x77, 0x2A, 0xD8, 0xFF, 0x8D, 0x00, 0x46, 0x30, 0x11, 0xD3, 0x40, 0x38, 0xC6,
-    0x23, 0xAB, 0x5D, 0x46, 0x3E, 0x37, 0x1B, 0xCC, 0xD6, 0xE9, 0xBB, 0x6F, 0x50, 0xB3, 0xEA, 0xF9,
-    0x7C, 0x2B, 0x27, 0xC7, 0x0D, 0xC3, 0x4B, 0xEA, 0x4D, 0x12, 0xD2, 0xA3, 0xF7, 0x68, 0x29, 0x48,
-    0x35, 0x15, 0x02, 0xF9, 0xD9, 0x2A, 0x0B, 0x69, 0xF1, 0x4D, 0xD2, 0x04, 0xCB, 0x72, 0xAA, 0x16,
-    0x2E, 0xA6, 0xD4, 0xE5, 0xD9, 0x36, 0x0E, 0x7B, 0x34, 0x33, 0xF2, 0x9F, 0xCD, 0x82, 0x47, 0xEE,
-    0x98, 0xAD, 0x9F, 0x37, 0xEB, 0x4C, 0xFE, 0xC0, 0x6E, 0xD2, 0x1A, 0x68, 0x43, 0x12, 0x56, 0x44,
-    0xF3, 0x01, 0xE5, 0x0C, 0x98, 0xC7, 0x77, 0xC0, 0xF4, 0xA0, 0x15, 0xD6, 0x71, 0xBE, 0xA8, 0xB0,
-    0x46, 0x72, 0x8F, 0x67, 0x3E, 0xA7, 0xEE, 0xA0, 0x48, 0xAC, 0xEA, 0x6A, 0xAB, 0x9F, 0x2F, 0x0B,
-    0x59, 0x38, 0xD0, 0x7E, 0xA8, 0x10, 0x9F, 0x18, 0x65, 0xE6, 0x34, 0x93, 0x87, 0xD5, 0x5B, 0x31,
-    0x8F, 0x09, 0x8E, 0xCB, 0x61, 0x41, 0xA2, 0xCE, 0x18, 0xB9, 0xE4, 0x5B, 0x2D, 0x3E, 0xBE, 0x34,
-    0x37, 0x8D, 0xDC, 0x38, 0xE6, 0xC3, 0x51, 0x82, 0xC6, 0x73, 0x72, 0xF6, 0xD0, 0x12, 0x2B, 0x9A,
-    0x8D, 0xFB, 0xC2, 0x8C, 0x42, 0xF9, 0x97, 0x14, 0x2F, 0xAA, 0xB8, 0x6B, 0x38, 0x37, 0xC5, 0x35,
-    0xF7, 0xBE, 0xCF, 0x05, 0xD7, 0x5E, 0x67, 0x4D, 0xE9, 0x53, 0x68, 0x7B, 0x50, 0x48, 0x23, 0x6B,
-    0x61, 0x59, 0xC3, 0xFA, 0x47, 0x33, 0x4F, 0x51, 0x8B, 0xB3, 0xD5, 0x55, 0x21, 0xE5, 0x0E, 0xE9,
-    0x4A, 0x5D, 0x94, 0x1D, 0x13, 0xEA, 0x1A, 0xB9, 0x5D, 0x98, 0x0D, 0xF9, 0x94, 0x3F, 0x9F, 0x0C,
-    0x0C, 0x8D, 0x7C, 0xC8, 0xB6, 0xEA, 0xE0, 0x01, 0x4F, 0x27, 0x85, 0xDF, 0x02, 0x9B, 0xAD, 0x05,
-    0x36, 0x15, 0x72, 0xD2, 0xCB, 0xBF, 0xF0, 0x75, 0x87, 0xA0, 0x5E, 0xD0, 0x8D, 0xF4, 0xBE, 0xB2,
-    0xF3, 0xBB, 0xAF, 0x6C, 0x94, 0xA3, 0xA0, 0x87, 0xFA, 0x9D, 0xB5, 0xFC, 0xF2, 0xE5, 0x56, 0xBB,
-    0x8B, 0xCE, 0xBB, 0xFB, 0x50, 0xB0, 0xD7, 0xA9, 0x60, 0xEF, 0x87, 0x24, 0x95, 0xFA, 0x54, 0xD0,
-    0xEC, 0xE5, 0xFF, 0x9D, 0xED, 0xB0, 0x2D, 0xB1, 0x93, 0x07, 0x64, 0xA1, 0x21, 0x79, 0x56, 0x99,
-    0x57, 0xC2, 0x9C, 0xBB, 0x46, 0x9A, 0x52, 0x10, 0x19, 0xE3, 0x8E, 0x6F, 0x30, 0x78, 0x06, 0xCF,
-    0x0E, 0x5B, 0xEB, 0xCC, 0xD6, 0x5C, 0x01, 0xCB, 0xDF, 0xC9, 0x5D, 0x94, 0x23, 0x02, 0x0D, 0x42,
-    0xAD, 0x52, 0xD1, 0x4E, 0xDE, 0x45, 0x96, 0xDF, 0xB9, 0xA6, 0xF7, 0xF2, 0x60, 0xBF, 0xFA, 0x68,
-    0xA5, 0xA0, 0x2A, 0x3C, 0x6F, 0xBB, 0x93, 0x95, 0x82, 0xEB, 0x8A, 0x45, 0x31, 0x30, 0x61, 0xE5,
-    0x34, 0xD5, 0xEA, 0xCA, 0x26, 0x25, 0x6C, 0x05, 0xC5, 0x2E, 0x78, 0x29, 0xAD, 0x17, 0xDA, 0x70,
-    0x41, 0xE6, 0x07, 0x71, 0xF1, 0xA6, 0x9B, 0xE6, 0xAB, 0x5E, 0xEC, 0x44, 0x04, 0xCC, 0x34, 0x9A,
-    0x52, 0xAE, 0x9A, 0xDD, 0x30, 0x73, 0x1F, 0x22, 0xE2, 0xEE, 0x3E, 0x05, 0x04, 0xAC, 0x1E, 0x56,
-    0xE5, 0xB5, 0xC3, 0xC6, 0x82, 0x30, 0x26, 0xED, 0xB7, 0x8B, 0xBD, 0x5A, 0x54, 0xC0, 0x3D, 0x18,
-    0xEB, 0xA9, 0x98, 0xC5, 0x9E, 0x86, 0xAC, 0xD4, 0x1D, 0xBB, 0xC7, 0x2A, 0xE5, 0x42, 0x66, 0xC1,
-    0xB0, 0x63, 0xF6, 0x4C, 0xE0, 0xBB, 0x77, 0x75, 0x64, 0xFE, 0x48, 0x1D, 0x99, 0xA2, 0x28, 0xF2,
-    0x5A, 0xCA, 0x6C, 0x14, 0x43, 0xD1, 0x26, 0x5E, 0x6D, 0x96, 0x3C, 0x9B, 0x5B, 0xFE, 0x2A, 0xCB,
-    0xFD, 0x98, 0x42, 0xBA, 0xB0, 0xC5, 0xF6, 0xBA, 0xED, 0x9A, 0x67, 0x05, 0x81, 0xC9, 0xEF, 0x72,
-    0x9D, 0xBE, 0xCD, 0xCC, 0xA6, 0xB3, 0x4D, 0xFA, 0x7A, 0xBF, 0x59, 0xF4, 0xCC, 0x95, 0x69, 0x5B,
-    0x3C, 0x47, 0x57, 0x66, 0xDA, 0x17, 0xCA, 0xAD, 0x8C, 0xFB, 0x52, 0x8B, 0x1D, 0xD8, 0xAA, 0x67,
-    0xF8, 0x1E, 0x7B, 0x7D, 0x33, 0x33, 0x7A, 0x94, 0x7E, 0xD0, 0x91, 0xE7, 0x85, 0x65, 0xCF, 0x22,
-    0xAE, 0x25, 0xCA, 0x0C, 0xAA, 0xD1, 0x16, 0xDB, 0x9C, 0x0D, 0x62, 0xA6, 0x2E, 0xAC, 0x7B, 0xD6,
-    0x15, 0x96, 0x98, 0xDB, 0x97, 0xE6, 0xB4, 0x0F, 0x2A, 0x4D, 0x16, 0x42, 0x01, 0x79, 0x73, 0xC4,
-    0x88, 0x9F, 0xB0, 0xD3, 0x95, 0xB7, 0x25, 0x71, 0x7C, 0x6D, 0x43, 0xFC, 0xCC, 0xE3, 0xF9, 0x86,
-    0xD6, 0x4E, 0xA8, 0x4B, 0x66, 0x05, 0x2D, 0xAD, 0x24, 0x39, 0xA2, 0xE8, 0x84, 0xD6, 0x53, 0x9D,
-    0xB8, 0x05, 0x1C, 0x7C, 0xBB, 0xE9, 0xC1, 0xA6, 0x55, 0x93, 0x1C, 0xF5, 0x65, 0x45, 0x75, 0x28,
-    0xF5, 0xE7, 0x70, 0x01, 0xE6, 0x3E, 0xD7, 0x26, 0x65, 0x51, 0x72, 0xD4, 0x27, 0x2D, 0x2F, 0x38,
-    0xE6, 0xE2, 0x16, 0xEB, 0x47, 0x22, 0x6F, 0x55, 0xC9, 0xFE, 0xAC, 0x56, 0xC4, 0x58, 0x6D, 0x73,
-    0x16, 0x4D, 0x2D, 0x0D, 0xF3, 0x6F, 0x03, 0xF8, 0x9E, 0xE9, 0xAB, 0xA6, 0x0A, 0xB1, 0x4E, 0xE2,
-    0xF1, 0xB0, 0xAA, 0xC4, 0xE7, 0xF9, 0x4B, 0x54, 0x6C, 0x41, 0xD8, 0x44, 0x0B, 0x29, 0x76, 0xA5,
-    0xC6, 0x1F, 0x34, 0xC1, 0xF2, 0xAA, 0x65, 0xA6, 0x09, 0x5D, 0x92, 0x60, 0x5B, 0x2E, 0x7E, 0x23,
-    0x16, 0x88, 0xD5, 0x1A, 0xC2, 0x2F, 0x83, 0x64, 0x92, 0x26, 0x85, 0xC9, 0xFF, 0x84, 0x2A, 0x15,
-    0x56, 0xB8, 0xAD, 0x09, 0xC5, 0xB2, 0xF7, 0x71, 0xB1, 0x8C, 0x53, 0xD1, 0x62, 0x03, 0xBC, 0x54,
-    0x5A, 0x9A, 0xF3, 0xAF, 0xA8, 0xBC, 0xA2, 0xDB, 0x24, 0x0B, 0x6D, 0x3F, 0xBA, 0x79, 0xB3, 0x20,
-    0xAF, 0x79, 0xC1, 0x43, 0x52, 0x70, 0xC8, 0x10, 0x5E, 0x6D, 0x65, 0x51, 0xA5, 0x1B, 0xD2, 0xBF,
-    0x57, 0x16, 0x58, 0x2F, 0x73, 0xA2, 0xB8, 0xAA, 0x0A, 0x5A, 0xC5, 0x2C, 0x61, 0xB8, 0xD8, 0x5A,
-    0xAC, 0x9C, 0x8B, 0x19, 0xF8, 0x64, 0x6B, 0xDA, 0xCB, 0x6A, 0x5A, 0x43, 0xDB, 0x5F, 0xBA, 0x44,
-    0x37, 0x0E, 0x57, 0x17, 0x77, 0xB3, 0x90, 0x9A, 0x4B, 0x82, 0xB6, 0xCA, 0x1C, 0xE8, 0x66, 0x02,
-    0x9E, 0xA5, 0xD6, 0x98, 0x1E, 0x5B, 0x9E, 0x18, 0xB8, 0x3C, 0x07, 0xD4, 0x13, 0xAE, 0x6A, 0xDF,
-    0x02, 0xEE, 0x0F, 0x1D, 0x59, 0xF6, 0xFF, 0x3E, 0xC1, 0x30, 0x09, 0xB1, 0xD4, 0xF9, 0xE4, 0xCC,
-    0xCA, 0xA7, 0xEA, 0x52, 0xEF, 0xFF, 0x86, 0xC6, 0x9C, 0xF3, 0xE8, 0xBB, 0x90, 0xE7, 0x87, 0xBD,
-    0xF4, 0x8D, 0xE2, 0x55, 0xAF, 0xC0, 0x41, 0xFE, 0x46, 0x88, 0x84, 0x35, 0x06, 0xCC, 0xA4, 0xCD,
-    0x7A, 0xCE, 0xF8, 0x9C, 0x2F, 0x62, 0x8B, 0x83, 0x45, 0x22, 0x22, 0x55, 0xB0, 0xD2, 0x1E, 0xBC,
-    0x71, 0xA5, 0x9F, 0x2C, 0x8C, 0xC9, 0xC0, 0x90, 0xB1, 0xF6, 0xCE, 0x3E, 0x10, 0xED, 0x3F, 0x50,
-    0x35, 0x03, 0x96, 0x66, 0x74, 0xB6, 0xB3, 0x9A, 0x90, 0xF9, 0x22, 0x91, 0xFF, 0xD9, 0x77, 0xA1,
-    0x87, 0xAE, 0x99, 0xC8, 0x3F, 0xA6, 0x61, 0xE9, 0xCC, 0x73, 0x5E, 0xD5, 0xFA, 0x78, 0x76, 0xEF,
-    0x25, 0xD6, 0x97, 0x3D, 0xEE, 0xDB, 0xD2, 0x12, 0xEC, 0xE9, 0x3E, 0x7C, 0xCF, 0x1F, 0xB2, 0xB4,
-    0x3A, 0x1F, 0x54, 0xF8, 0xE8, 0x57, 0x49, 0x9F, 0xB0, 0x45, 0xB2, 0x79, 0x7F, 0x09, 0xFD, 0x7A,
-    0xDC, 0x4F, 0x4A, 0xDA, 0xE1, 0x0B, 0xA9, 0xBF, 0xA9, 0x04, 0x10, 0xAD, 0x8E, 0x56, 0xD6, 0x14,
-    0xA9, 0x89, 0xAD, 0xA5, 0x5B, 0x35, 0x99, 0x7F, 0xE7, 0x69, 0x5B, 0x12, 0x17, 0xFC, 0x8D, 0x49,
-    0xEF, 0x0B, 0xBD, 0xB6, 0x66, 0x1C, 0x8D, 0x76, 0xFD, 0x23, 0xA4, 0xC9, 0x81, 0xB2, 0x62, 0xA4,
-    0x2E, 0xA6, 0x0C, 0x6E, 0xA6, 0xC2, 0x28, 0x3A, 0x75, 0xF4, 0x17, 0x1B, 0xBE, 0x90, 0x5F, 0xED,
-    0x00, 0x5D, 0x32, 0xBB, 0x7A, 0xDE, 0x42, 0x21, 0xEE, 0xD3, 0x46, 0xDE, 0x7D, 0xAE, 0xF4, 0x32,
-    0x25, 0xE4, 0xDF, 0xCB, 0x52, 0xC4, 0xE8, 0xBF, 0x2E, 0x42, 0xBE, 0x8A, 0xCA, 0x33, 0x54, 0xC8,
-    0x50, 0x1C, 0xC4, 0x68, 0x99, 0x2B, 0x13, 0xCD, 0xEA, 0xB0, 0x92, 0x5E, 0xD1, 0x6F, 0xFC, 0x07,
-    0xE6, 0xA7, 0xE8, 0xF6, 0xF7, 0xF7, 0xCF, 0x8C, 0x72, 0x00, 0xFF, 0xD0, 0x5B, 0x9A, 0x00, 0x6B,
-    0xAD, 0xF8, 0xBB, 0x04, 0x15, 0xF9, 0x0E, 0x97, 0x6F, 0xF1, 0xAF, 0x6A, 0x59, 0x7E, 0x19, 0x3D,
-    0xF9, 0x78, 0xC2, 0x72, 0x7C, 0x1B, 0xF3, 0x71, 0x28, 0x65, 0xCE, 0xD6, 0x5C, 0x9A, 0x0A, 0xF5,
-    0x30, 0xB1, 0x6B, 0x76, 0xE2, 0x4F, 0x5C, 0xDE, 0xFF, 0x8E, 0x34, 0x00, 0x0A, 0xB4, 0xF9, 0xF8,
-    0x9D, 0x4B, 0x97, 0x35, 0x26, 0x8D, 0xEB, 0x67, 0x4F, 0x0F, 0x90, 0x9C, 0x7D, 0x05, 0xE4, 0x28,
-    0xD7, 0x59, 0x5B, 0x8C, 0xAA, 0xF2, 0x5A, 0x8A, 0xF6, 0x69, 0x4F, 0x1E, 0xE7, 0xDC, 0x6A, 0x5D,
-    0x59, 0x51, 0xE4, 0xDC, 0xAB, 0x12, 0xE3, 0xC4, 0xD1, 0xEA, 0xE2, 0x63, 0x2F, 0xEE, 0xFC, 0x2E,
-    0x86, 0xC4, 0x3E, 0xC4, 0x25, 0x8B, 0x37, 0x20, 0xE0, 0xCA, 0x3E, 0x61, 0xED, 0xC2, 0x72, 0x0A,
-    0x02, 0x65, 0xC3, 0x46, 0x11, 0xF1, 0x7F, 0x8B, 0x41, 0x97, 0x07, 0x5A, 0x75, 0xA6, 0xDC, 0xAC,
-    0x1E, 0xFE, 0x1E, 0x55, 0xBF, 0x7F, 0x52, 0x7A, 0x7D, 0x45, 0x27, 0x6F, 0xD6, 0x59, 0x2E, 0xD2,
-    0x9C, 0x95, 0xAD, 0xF1, 0xF4, 0x93, 0x18, 0xDA, 0x98, 0x37, 0x70, 0x5A, 0xEA, 0x29, 0x81, 0xFD,
-    0x9E, 0xB5, 0x55, 0xCD, 0xFF, 0x14, 0xFB, 0xD1, 0x6E, 0xD9, 0xC0, 0xBD, 0x84, 0x09, 0xED, 0xF2,
-    0x47, 0x83, 0x64, 0x6F, 0x42, 0x5E, 0x63, 0x60, 0xBA, 0xAA, 0xC2, 0x08, 0x6E, 0x8B, 0x72, 0xE9,
-    0xEF, 0xB8, 0x00, 0x6F, 0x60, 0xBF, 0xE8, 0x1D, 0x6B, 0x76, 0x99, 0x43, 0x50, 0x2B, 0x38, 0x0E,
-    0x44, 0xE9, 0x5D, 0x35, 0xCC, 0xD4, 0x4D, 0x20, 0xCB, 0x4A, 0xBF, 0xB9, 0xB2, 0x9A, 0x9F, 0xD1,
-    0x8F, 0x3E, 0x1C, 0x5C, 0xA0, 0x32, 0x52, 0x34, 0x72, 0x93, 0xE4, 0x20, 0xD0, 0xB9, 0x2D, 0x45,
-    0x3D, 0xF7, 0x16, 0x51, 0xE4, 0xEF, 0x8F, 0xE8, 0x7D, 0xC9, 0x07, 0xE5, 0x07, 0xD5, 0x22, 0xFC,
-    0xEC, 0x88, 0xF1, 0x25, 0xEF, 0x43, 0x01, 0x5E, 0x75, 0x08, 0xC4, 0x32, 0xA6, 0x5F, 0x18, 0xAF,
-    0x2A, 0xBA, 0xB4, 0x17, 0x1B, 0x67, 0xD2, 0x83, 0x0C, 0x12, 0x26, 0xEF, 0xAD, 0x88, 0x9F, 0xA9,
-    0x5E, 0x47, 0x87, 0xBF, 0xFC, 0x8E, 0x4A, 0x54, 0x5F, 0xC9, 0xB6, 0xE1, 0x4E, 0xE2, 0xE9, 0x48,
-    0x48, 0xB4, 0x40, 0x15, 0x6C, 0xFD, 0xA7, 0x44, 0x3F, 0x4C, 0xA7, 0x7A, 0xCC, 0x46, 0xF7, 0xD8,
-    0x76, 0x65, 0x95, 0x68, 0xB0, 0xF4, 0x9C, 0xA2, 0x09, 0x12, 0xDA, 0x72, 0x0B, 0xF2, 0xDA, 0xF4,
-    0xD4, 0x47, 0x6E, 0x77, 0xEF, 0x3C, 0x80, 0xEE, 0x0B, 0xCA, 0x57, 0xE0, 0x54, 0xED, 0xAA, 0xBF,
-    0xA5, 0xE2, 0xF9, 0x83, 0xD1, 0xA9, 0xA0, 0x79, 0xE7, 0xF3, 0xAD, 0x85, 0xD5, 0x43, 0xE4, 0xA1,
-    0x98, 0x9D, 0x6E, 0x00, 0xB0, 0x4E, 0x2E, 0xC0, 0x55, 0x12, 0xDF, 0x69, 0x0F, 0xBA, 0x53, 0x32,
-    0xB4, 0x64, 0x77, 0x65, 0x9D, 0x15, 0xE5, 0x6B, 0xE5, 0x10, 0x5B, 0xC1, 0xF2, 0x71, 0x82, 0x27,
-    0xA4, 0x8C, 0x25, 0x5C, 0x88, 0x95, 0xE4, 0xFE, 0x1A, 0xF4, 0x09, 0xCF, 0x35, 0xC1, 0xC0, 0xD9,
-    0xAF, 0xB0, 0x8A, 0x56, 0x36, 0x09, 0xAE, 0x1C, 0xBB, 0xB8, 0x08, 0x55, 0xD6, 0x90, 0x0F, 0x43,
-    0x7E, 0xE7, 0x2A, 0xEB, 0x7B, 0xB8, 0x9E, 0x51, 0xAA, 0xA4, 0x25, 0x09, 0x1F, 0xEF, 0x7F, 0x31,
-    0xEE, 0x9F, 0x19, 0x32, 0xA8, 0xE1, 0x27, 0x58, 0x35, 0x98, 0xD2, 0x05, 0x67, 0xAE, 0x01, 0x0E,
-    0x21, 0x6F, 0x43, 0x00, 0x9C, 0x5A, 0xF0, 0x4C, 0xB5, 0x47, 0xF9, 0x10, 0xB2, 0x18, 0x62, 0xFB,
-    0x19, 0x0D, 0x1A, 0x8F, 0x98, 0x2A, 0xAE, 0x6B, 0x9C, 0x2B, 0xD2, 0x7E, 0x22, 0xFC, 0xA2, 0xCE,
-    0xDA, 0x45, 0xB6, 0xBC, 0x99, 0xD4, 0x87, 0xAB, 0x41, 0x50, 0xF4, 0xF9, 0xF9, 0x64, 0x48, 0x56,
-    0xF1, 0x10, 0x71, 0x75, 0x88, 0x47, 0xE6, 0xA3, 0xBD, 0x6D, 0x36, 0x06, 0x60, 0x9A, 0x25, 0xD0,
-    0xB9, 0x3D, 0x2D, 0xE0, 0xA5, 0xB0, 0xAD, 0xD6, 0x36, 0x98, 0x32, 0xEB, 0xDB, 0xDF, 0x83, 0x34,
-    0x2B, 0x30, 0x38, 0xE6, 0x12, 0x3F, 0xA9, 0xA5, 0x06, 0x64, 0xD5, 0xE1, 0xB1, 0x3D, 0xFD, 0xE2,
-    0x90, 0xAD, 0x68, 0xAA, 0x90, 0x43, 0xA8, 0xD4, 0x73, 0x0F, 0x5F, 0xBA, 0xF4, 0x9B, 0xB4, 0x7E,
-    0xF6, 0x63, 0xEC, 0x6E, 0x1A, 0xC2, 0xC9, 0x0D, 0xE3, 0xC4, 0xA7, 0x7E, 0x8D, 0x15, 0xA2, 0xA0,
-    0x11, 0xAD, 0x46, 0xBE, 0xB6, 0x64, 0x7D, 0x59, 0xE4, 0x20, 0x77, 0x46, 0x6F, 0x87, 0xF8, 0xCE,
-    0xEB, 0x90, 0x3F, 0xA8, 0xEB, 0xAA, 0x9B, 0x28, 0xC9, 0x57, 0xCC, 0x58, 0xE6, 0x6D, 0xDF, 0xA0,
-    0x3C, 0x22, 0x6B, 0x8D, 0x3E, 0x5A, 0x86, 0x76, 0x3F, 0x97, 0xD5, 0xB2, 0x9F, 0x24, 0x49, 0x5B,
-    0x5A, 0x3A, 0x99, 0xCA, 0x1D, 0x25, 0x81, 0x4D, 0x21, 0x3E, 0xFA, 0x79, 0x10, 0xD7, 0xAF, 0x0E,
-    0xF1, 0x5F, 0xE6, 0xED, 0x33, 0x7E, 0x05, 0x5C, 0x98, 0xD1, 0x6D, 0x7D, 0x14, 0x88, 0xF7, 0x69,
-    0xB1, 0xAA, 0x7F, 0x46, 0xF5, 0xA4, 0xF7, 0x16, 0x4B, 0x7E, 0xFD, 0x50, 0xF9, 0xEC, 0x58, 0x72,
-    0xAF, 0x20, 0x27, 0x93, 0xD9, 0x33, 0x91, 0x82, 0x32, 0x1D, 0x18, 0xCE, 0x05, 0x61, 0x6F, 0x13,
-    0xEA, 0xD2, 0x2D, 0xE5, 0xC5, 0x4D, 0x2C, 0x73, 0x54, 0x8B, 0x65, 0xD4, 0x8F, 0x43, 0x37, 0xC0,
-    0x9B, 0x79, 0x73, 0xE2, 0x59, 0xC2, 0xE2, 0xD7, 0x5F, 0x0F, 0x05, 0x27, 0xF1, 0xB4, 0x92, 0x69,
-    0x15, 0x02, 0x03, 0x16, 0xF8, 0xDD, 0x5D, 0xDE, 0x54, 0xD9, 0x4A, 0x0A, 0x6F, 0xD4, 0x96, 0xA1,
-    0x13, 0xFB, 0x27, 0x08, 0xA7, 0xA5, 0x5C, 0x8D, 0x96, 0xAB, 0x6A, 0x79, 0xDC, 0x1B, 0x3A, 0x1A,
-    0xC1, 0x43, 0xAB, 0x6B, 0x5E, 0x00, 0x8A, 0xBB, 0x6C, 0x7D, 0x54, 0x67, 0xBA, 0xE7, 0xEB, 0xE1,
-    0xCC, 0x18, 0xEA, 0x0C, 0xBF, 0x7D, 0x14, 0x6B, 0x6B, 0x67, 0x1E, 0xF8, 0x5F, 0x40, 0x72, 0xFF,
-    0xF6, 0xD2, 0xC5, 0x29, 0x47, 0x5F, 0x20, 0xDC, 0xAE, 0xEF, 0xF5, 0x60, 0x2E, 0x4F, 0x10, 0x09,
-    0x0B, 0x13, 0xAD, 0xA7, 0x90, 0x1E, 0x21, 0xDF, 0x6C, 0xFD, 0x9B, 0x00, 0xEF, 0x50, 0x85, 0xC6,
-    0xE6, 0xAB, 0x57, 0x58, 0x96, 0xDB, 0xD3, 0xC7, 0x59, 0x3E, 0xCB, 0x76, 0x17, 0x91, 0x7B, 0x90,
-    0x41, 0x8F, 0x0E, 0xCE, 0xD8, 0xF9, 0x3A, 0xE1, 0xD2, 0xA6, 0x7C, 0x9F, 0x63, 0x56, 0x2F, 0xEE,
-    0x7F, 0x83, 0x75, 0xA9, 0xE3, 0x5C, 0xAB, 0x4D, 0x33, 0x81, 0x36, 0x5A, 0xCE, 0x1E, 0xF4, 0x69,
-    0x38, 0xF5, 0x90, 0x9C, 0xE5, 0xBC, 0xA0, 0xE6, 0xF3, 0x6B, 0xF4, 0xE6, 0x74, 0x74, 0xAC, 0x96,
-    0x7A, 0xE9, 0x8A, 0x8D, 0xFF, 0x51, 0xF2, 0x60, 0xCF, 0x88, 0x88, 0x21, 0x12, 0x4F, 0xB6, 0x59,
-    0x80, 0x29, 0x41, 0xFD, 0xFD, 0x23, 0x6C, 0x79, 0x93, 0xAC, 0xFB, 0x60, 0xAD, 0x4C, 0x1F, 0x7A,
-    0xF5, 0x2C, 0x95, 0xAD, 0x6B, 0x3E, 0x6C, 0xCA, 0xEF, 0x8F, 0xEE, 0x36, 0x07, 0xE6, 0xFD, 0x5B,
-    0x8D, 0xEF, 0xBE, 0xFF, 0x5E, 0x97, 0x7E, 0x4F, 0x74, 0x08, 0x71, 0x23, 0xB9, 0x12, 0xAD, 0xBE,
-    0x57, 0xB9, 0x10, 0xEB, 0xE9, 0xD7, 0x7B, 0x7F, 0xBC, 0xCD, 0x92, 0xFB, 0x15, 0xD6, 0xB1, 0xBA,
-    0xBE, 0x5D, 0xC7, 0x8A, 0xD1, 0x5E, 0xDA, 0x11, 0x74, 0x24, 0x30, 0x0B, 0x8E, 0xFF, 0x4A, 0x4F,
-    0x89, 0x16, 0x66, 0xA3, 0x9B, 0x06, 0x24, 0x15, 0xA4, 0xD9, 0xFD, 0x36, 0xC2, 0xBE, 0xDB, 0xE7,
-    0x37, 0x7D, 0x71, 0xF7, 0x8D, 0x65, 0x27, 0x37, 0x08, 0x09, 0x53, 0xD9, 0xC2, 0x3F, 0x31, 0xF7,
-    0x9A, 0x25, 0xF5, 0xDC, 0x89, 0x0D, 0x7F, 0xC1, 0x4B, 0x02, 0xDE, 0xF7, 0x9A, 0x7C, 0xAD, 0xF6,
-    0xA0, 0x2A, 0xFA, 0x7E, 0x4A, 0x9B, 0xB4, 0x35, 0x46, 0x70, 0xEF, 0x8D, 0x9E, 0x4C, 0x6F, 0x1D,
-    0x58, 0xD5, 0x54, 0x72, 0x73, 0x0F, 0x8A, 0xF6, 0x17, 0xB6, 0x04, 0x80, 0x52, 0xB8, 0x0A, 0x90,
-    0x7C, 0xB6, 0xD4, 0xCF, 0x16, 0x2B, 0xC7, 0x3A, 0x0F, 0x43, 0xBF, 0x7F, 0x3F, 0x4F, 0xF2, 0xE1,
-    0x47, 0x7F, 0x9E, 0x24, 0xB2, 0x9F, 0x27, 0xC9, 0x77, 0x7E, 0x9E, 0xC4, 0x95, 0x5C, 0x5A, 0x03,
-    0x2D, 0x33, 0x6F, 0x2A, 0xE4, 0x1F, 0x04, 0x42, 0xE9, 0xB7, 0x01, 0xB5, 0xC4, 0xF0, 0x27, 0x34,
-    0xBF, 0xDC, 0x95, 0x99, 0x85, 0x6F, 0x18, 0x39, 0xA9, 0xCB, 0x01, 0x22, 0x2F, 0x5F, 0x5B, 0xC6,
-    0x76, 0xD9, 0x30, 0x9B, 0xEC, 0x56, 0xBF, 0xA9, 0xF4, 0xAC, 0xC3, 0xF2, 0x41, 0x73, 0xCB, 0xA0,
-    0xA7, 0x01, 0xC9, 0x9F, 0xD1, 0xAB, 0xBE, 0xCF, 0x08, 0xA0, 0xAD, 0x51, 0x5F, 0xAC, 0x4B, 0xBF,
-    0xCA, 0xDB, 0x4A, 0x19, 0xA2, 0x41, 0x58, 0xCC, 0x8F, 0x6E, 0xE8, 0xA7, 0xDA, 0xAB, 0xDA, 0xF0,
-    0xEB, 0xCF, 0xE8, 0xC2, 0x27, 0x41, 0x2F, 0x3E, 0x02, 0xBD, 0xB1, 0xB8, 0x0D, 0x7A, 0x16, 0x90,
-    0x8A, 0x2C, 0xBA, 0x73, 0xBC, 0xF4, 0x3F, 0xB3, 0xFC, 0x8A, 0xBB, 0x40, 0xEF, 0x53, 0xFC, 0xB8,
-    0xCB, 0x1D, 0x93, 0xD8, 0xDD, 0x94, 0xC4, 0xCE, 0xC5, 0x2D, 0x2A, 0xFD, 0x9C, 0xF6, 0xCA, 0x45,
-    0x97, 0xFD, 0xE1, 0x79, 0xB3, 0x09, 0x8E, 0x95, 0xFE, 0x34, 0xDF, 0xBB, 0x0E, 0x40, 0xC9, 0xB9,
-    0xEE, 0xFE, 0x1D, 0x17, 0x8E, 0xFD, 0x7F, 0xB5, 0x56, 0xBF, 0x8F, 0xDD, 0x44, 0x10, 0x9E, 0xB5,
-    0x73, 0x67, 0x78, 0xAB, 0x3B, 0x5F, 0x71, 0x27, 0xE5, 0x17, 0x31, 0x05, 0x05, 0x8A, 0x48, 0xDC,
-    0xA1, 0x43, 0x8A, 0x58, 0x27, 0x29, 0x28, 0x52, 0x70, 0x45, 0xAE, 0x40, 0x08, 0x48, 0x11, 0x1A,
-    0x24, 0x74, 0x57, 0x1C, 0x2D, 0x76, 0x12, 0x09, 0x8A, 0x14, 0x1C, 0x05, 0x1D, 0xC5, 0x13, 0xA2,
-    0x48, 0x68, 0x48, 0x91, 0x02, 0x8A, 0xC4, 0x3E, 0x4E, 0x51, 0x24, 0xD2, 0x98, 0xF0, 0x07, 0x60,
-    0x20, 0x01, 0x89, 0x14, 0x2C, 0x60, 0xC0, 0x81, 0xB5, 0x87, 0x6F, 0xFC, 0xEE, 0x5D, 0xEE, 0x42,
-    0x24, 0x50, 0x7E, 0xEC, 0x7B, 0x6B, 0xAF, 0xBD, 0xB3, 0xB3, 0x33, 0xB3, 0xF3, 0x7D, 0xE3, 0xC1,
-    0x27, 0x5B, 0xDA, 0x90, 0x68, 0xFE, 0x99, 0x7D, 0x17, 0x83, 0x52, 0x97, 0x71, 0xFD, 0xEC, 0x87,
-    0x5E, 0xF6, 0xFF, 0x7F, 0x44, 0xB4, 0x97, 0x48, 0x27, 0xE4, 0x95, 0x44, 0x2B, 0x86, 0xDD, 0x5B,
-    0x8B, 0x9F, 0x2D, 0x53, 0xB5, 0xEC, 0x67, 0xCB, 0xD3, 0xB4, 0x3C, 0x4B, 0xCB, 0x74, 0xFF, 0x7F,
-    0x69, 0xF3, 0x44, 0x15, 0x05, 0x19, 0xED, 0x23, 0x82, 0xF2, 0x83, 0x8B, 0xAF, 0x68, 0x9A, 0xF2,
-    0x8A, 0x29, 0xBA, 0x30, 0x45, 0xB3, 0x53, 0x44, 0x0F, 0xF2, 0xA7, 0xB9, 0xC5, 0x23, 0xCC, 0xDF,
-    0x30, 0xA7, 0xEC, 0xE6, 0x16, 0x17, 0xB6, 0x3F, 0x2D, 0xA2, 0xC5, 0xCC, 0x7C, 0x0D, 0xFD, 0x17,
-    0x84, 0xE8, 0x9C, 0x18, 0x63, 0xF0, 0xF0, 0x33, 0xFA, 0xDF, 0xE8, 0x1D, 0x6D, 0x6D, 0x32, 0x73,
-    0xCF, 0x46, 0x77, 0xB7, 0xFF, 0x96, 0xDC, 0x9F, 0x9C, 0x37, 0x05, 0x3F, 0xD2, 0xFF, 0x5C, 0x22,
-    0xFE, 0x2D, 0x8E, 0xFD, 0xF9, 0x0B, 0x0E, 0x9E, 0x1F, 0x6F, 0x1F, 0x8E, 0x1D, 0x14, 0xA3, 0x32,
-    0x4A, 0xC2, 0xA2, 0xD5, 0xD6, 0x9C, 0x6A, 0x75, 0x6D, 0xAA, 0x7C, 0x8D, 0x0F, 0x57, 0x44, 0x49,
-    0xBC, 0xC6, 0x67, 0x38, 0x70, 0x51, 0x95, 0x1E, 0x71, 0x61, 0x79, 0x59, 0x0D, 0xEF, 0xF1, 0xAE,
-    0xA2, 0x09, 0x62, 0xDD, 0xC6, 0x36, 0x3F, 0xD2, 0xFA, 0x8D, 0xB6, 0x61, 0x19, 0x17, 0xBB, 0x20,
-    0x37, 0x41, 0x4E, 0x97, 0x6D, 0x60, 0x73, 0xBF, 0x31, 0xA7, 0x5C, 0x54, 0x32, 0x14, 0xAF, 0x77,
-    0x61, 0x9D, 0xAF, 0x73, 0x54, 0xE7, 0x6B, 0x95, 0xCE, 0x44, 0x26, 0x0F, 0x9A, 0xA8, 0xE1, 0x82,
-    0xD7, 0xDB, 0xC0, 0x99, 0x32, 0x3D, 0xED, 0x82, 0xDA, 0x14, 0xB9, 0x5F, 0x87, 0x65, 0xEE, 0x35,
-    0x61, 0xB1, 0x9B, 0x3E, 0x86, 0x2A, 0xFA, 0x97, 0x58, 0xBB, 0x4D, 0xAC, 0xDC, 0x47, 0x17, 0x61,
-    0xC5, 0x4C, 0x68, 0xD3, 0xB3, 0xAD, 0xF9, 0x95, 0xB1, 0xC9, 0x51, 0x17, 0x97, 0xEC, 0x37, 0xF1,
-    0x58, 0x08, 0xA6, 0xEE, 0xA2, 0x21, 0x29, 0x38, 0x0E, 0x67, 0xFD, 0x16, 0xFE, 0xD7, 0x38, 0xA4,
-    0x02, 0xAA, 0x49, 0xBF, 0xEF, 0x96, 0x10, 0xA2, 0x16, 0x71, 0xF8, 0xB3, 0xCB, 0xF3, 0x2B, 0xAA,
-    0x99, 0xA0, 0x00, 0xEE, 0x47, 0x98, 0x4D, 0x89, 0x3C, 0x87, 0xC4, 0xB7, 0x44, 0x71, 0x2F, 0x4C,
-    0xBE, 0xDB, 0x58, 0x0B, 0x20, 0xBC, 0x01, 0x75, 0x77, 0xA9, 0x8C, 0xEF, 0xA1, 0xF2, 0xD3, 0x2B,
-    0xCA, 0xA9, 0x5E, 0x87, 0x6C, 0xC8, 0x49, 0xAF, 0x32, 0xB0, 0xF4, 0x79, 0xF8, 0xCE, 0x6F, 0xDC,
-    0x27, 0x23, 0xA7, 0xB7, 0xFE, 0x70, 0x0B, 0x51, 0x31, 0xB3, 0x6D, 0x87, 0x6A, 0xB4, 0x03, 0x45,
-    0xB5, 0x69, 0xF3, 0x0E, 0xBF, 0xD6, 0xB8, 0xC1, 0xF0, 0x69, 0xCC, 0x64, 0x64, 0x1A, 0xA4, 0x58,
-    0x66, 0xB8, 0x31, 0xDC, 0x19, 0x6E, 0x0D, 0x97, 0xA6, 0x15, 0x9B, 0x0E, 0xF4, 0x87, 0x3B, 0xB9,
-    0x9A, 0x7F, 0xCD, 0xEF, 0x75, 0x71, 0x3D, 0x47, 0xBB, 0xB3, 0xC1, 0x29, 0x44, 0xEE, 0x1A, 0x6B,
-    0x5E, 0x72, 0xB1, 0x4B, 0x2B, 0x63, 0x5F, 0xA2, 0x5D, 0x34, 0xC8, 0x68, 0x3F, 0xD1, 0xB9, 0xD0,
-    0x91, 0xB1, 0xC4, 0x57, 0x39, 0x89, 0x5A, 0x4A, 0x7F, 0xE7, 0x32, 0x90, 0x91, 0xBC, 0x2A, 0x7C,
-    0x56, 0xAB, 0x34, 0x99, 0x40, 0x76, 0xAC, 0xCD, 0xCE, 0x6D, 0x63, 0x81, 0xF9, 0xC8, 0xAD, 0x4C,
-    0x3C, 0x32, 0x16, 0xA8, 0xF7, 0x1E, 0x5C, 0x98, 0x7A, 0x88, 0x2C, 0x40, 0x0B, 0x14, 0x25, 0x81,
-    0xA3, 0x9F, 0x96, 0xE7, 0x3F, 0xFA, 0x72, 0x30, 0x48, 0x86, 0x33, 0x03, 0x42, 0x46, 0xDC, 0xD7,
-    0x05, 0x6D, 0x58, 0x92, 0x7F, 0x35, 0xA3, 0x70, 0x9A, 0xE8, 0xD0, 0x7C, 0xCE, 0xF6, 0xD6, 0xE2,
-    0x9B, 0xCF, 0x0C, 0x83, 0x63, 0x03, 0x75, 0xBD, 0x18, 0xAE, 0x5C, 0x18, 0xEC, 0xD8, 0x01, 0xC9,
-    0x5E, 0xF4, 0x01, 0x6F, 0x7D, 0x5B, 0x1E, 0xD2, 0x81, 0x43, 0xA4, 0x5F, 0x24, 0x6F, 0xBD, 0xA0,
-    0x0B, 0xCC, 0xDF, 0xBF, 0xFB, 0xC1, 0xAB, 0xD3, 0x4F, 0xD0, 0x70, 0x7E, 0x65, 0x40, 0xDF, 0x96,
-    0x43, 0xA5, 0x1E, 0xC2, 0x46, 0x5B, 0xF7, 0xDB, 0xDA, 0xAA, 0xFE, 0xAA, 0xB8, 0xEA, 0xB3, 0x16,
-    0x4D, 0xB3, 0x23, 0xBF, 0xE9, 0x87, 0xD1, 0x0F, 0x5D, 0x9F, 0xD6, 0xC2, 0x77, 0x19, 0x53, 0x54,
-    0xF6, 0xC3, 0x34, 0xC9, 0xFB, 0x44, 0x97, 0x21, 0x1E, 0xD2, 0x91, 0x9E, 0x1C, 0xC3, 0x6E, 0x73,
-    0x78, 0xD8, 0x6D, 0x0E, 0xFD, 0x9A, 0xC6, 0xCB, 0xB4, 0x9D, 0x5C, 0x25, 0x7A, 0x1D, 0xAB, 0x3B,
-    0x80, 0xB6, 0xC5, 0x56, 0x65, 0xCC, 0x2E, 0x3E, 0xC3, 0x9C, 0x18, 0xB6, 0x9A, 0xAD, 0x09, 0xEA,
-    0xB4, 0xC8, 0x5F, 0x70, 0xEA, 0x72, 0xD2, 0x85, 0x55, 0x5C, 0x74, 0x62, 0x93, 0x02, 0xB8, 0xA3,
-    0xAF, 0x5A, 0x05, 0x04, 0xFA, 0x4D, 0x54, 0x86, 0xDF, 0x39, 0x19, 0x6A, 0xBB, 0x39, 0xC4, 0x74,
-    0x19, 0x5D, 0xEF, 0x87, 0x71, 0x11, 0x89, 0xAC, 0x2C, 0x4B, 0x13, 0x68, 0x58, 0xEB, 0x04, 0x6D,
-    0x0C, 0xBC, 0xA5, 0x19, 0x1F, 0xAB, 0x09, 0x32, 0x3E, 0x38, 0x3A, 0x85, 0xBB, 0xE2, 0x23, 0x37,
-    0x14, 0x01, 0xDC, 0x0A, 0x3E, 0xCE, 0x25, 0xA4, 0x8E, 0xC3, 0xCC, 0x99, 0xCD, 0xC8, 0x9C, 0x84,
-    0xD3, 0x91, 0x0D, 0x9D, 0xDF, 0x79, 0x0C, 0x54, 0xE7, 0x99, 0x29, 0xC2, 0x02, 0x69, 0x86, 0x89,
-    0x55, 0x82, 0x65, 0x8A, 0xFD, 0xD6, 0x67, 0x8D, 0xF9, 0xB0, 0xD1, 0x2E, 0xB6, 0x21, 0x98, 0x35,
-    0xAE, 0xD2, 0x02, 0xC4, 0x4C, 0x86, 0x2E, 0x81, 0xB1, 0x66, 0x7B, 0x59, 0x3F, 0x11, 0xDE, 0x8C,
-    0x8A, 0xC8, 0x9A, 0x92, 0x33, 0xFE, 0x82, 0x83, 0x56, 0x96, 0x18, 0x0B, 0x4E, 0x5D, 0xE3, 0x84,
-    0x8F, 0xCA, 0xFA, 0x06, 0xB3, 0xB2, 0xD2, 0x6B, 0xC9, 0x79, 0x35, 0xE8, 0x69, 0x41, 0x25, 0x93,
-    0x00, 0x7A, 0xA2, 0x2D, 0xA8, 0x87, 0x8B, 0xD8, 0xFA, 0x1D, 0xA5, 0x85, 0x6E, 0xC4, 0x99, 0x42,
-    0x25, 0x03, 0xDA, 0xA9, 0x1C, 0xB8, 0xAF, 0x89, 0xA1, 0x26, 0x2D, 0x4D, 0xC5, 0x05, 0x94, 0x11,
-    0x94, 0xC1, 0x2C, 0xE7, 0x81, 0x40, 0x7D, 0xAB, 0x4B, 0x8F, 0x1E, 0xC3, 0xA9, 0xEF, 0xA4, 0x13,
-    0x01, 0x78, 0x1B, 0x47, 0x78, 0x1A, 0xCC, 0xAE, 0x1D, 0xF8, 0xA6, 0xC2, 0x82, 0x75, 0xF6, 0x84,
-    0xE8, 0x6B, 0xB1, 0x3B, 0x2F, 0xD2, 0x02, 0xEE, 0xC8, 0xBA, 0xB0, 0x0A, 0x8B, 0x38, 0x79, 0x9B,
-    0x9E, 0xA4, 0x4C, 0x25, 0x04, 0x1B, 0x14, 0x02, 0x95, 0x56, 0x12, 0xA8, 0xA0, 0xE9, 0x54, 0x07,
-    0xD6, 0xCD, 0xC2, 0x92, 0x1E, 0x47, 0x3A, 0xC8, 0xDE, 0xC6, 0x1A, 0x58, 0xE1, 0xE3, 0x04, 0xAD,
-    0xCF, 0x14, 0x5B, 0x44, 0x58, 0x76, 0x8C, 0x4A, 0xD8, 0x6B, 0x2A, 0xBC, 0x4A, 0xAD, 0x76, 0x01,
-    0xFB, 0x8C, 0x30, 0x76, 0x98, 0xDC, 0xB9, 0x11, 0x5D, 0x00, 0x8B, 0x82, 0xB3, 0x95, 0x5F, 0xF9,
-    0xF6, 0xB2, 0xE7, 0x60, 0x6C, 0x05, 0x2A, 0xA7, 0x36, 0x3C, 0x5A, 0xE3, 0x3C, 0x25, 0x67, 0x5A,
-    0x0F, 0x97, 0xF0, 0x7A, 0x43, 0x2A, 0xEB, 0x9A, 0x9D, 0x9E, 0x8B, 0x9A, 0x08, 0xE1, 0x71, 0xBA,
-    0x8E, 0xD6, 0x78, 0xCD, 0xA9, 0xC3, 0xAD, 0xDB, 0x81, 0xD4, 0x88, 0xF0, 0xE9, 0xE2, 0x3C, 0x58,
-    0xE8, 0x28, 0xCE, 0xB0, 0xFC, 0x74, 0x43, 0x52, 0xE7, 0x12, 0xA4, 0x80, 0x5F, 0x5F, 0x02, 0x5D,
-    0x1A, 0xC9, 0x7A, 0x3F, 0xE9, 0xF7, 0x1C, 0xAC, 0xAA, 0x73, 0xA6, 0xD2, 0x20, 0xC9, 0xD0, 0xE5,
-    0x25, 0x7A, 0xD1, 0xF7, 0x66, 0xA3, 0xD7, 0x5B, 0x7B, 0xBA, 0xD1, 0x4D, 0xA6, 0x37, 0xBA, 0xD4,
-    0xA4, 0xA0, 0x8E, 0x0B, 0xBF, 0x9E, 0x25, 0xAF, 0x57, 0x38, 0x91, 0xD0, 0x82, 0xB1, 0x41, 0x9B,
-    0xDA, 0x90, 0xA5, 0x1B, 0xAB, 0xDB, 0xC9, 0x44, 0xAD, 0xCA, 0xC7, 0x58, 0xBA, 0xB5, 0x28, 0xCF,
-    0x2D, 0xE4, 0x1D, 0x2A, 0x71, 0x3B, 0x77, 0x7C, 0x2B, 0xEC, 0xA4, 0x96, 0xF4, 0x48, 0xCB, 0xA5,
-    0x5E, 0x57, 0xA3, 0x52, 0x44, 0x26, 0x19, 0xD5, 0x23, 0x6A, 0x45, 0x04, 0xEE, 0xF9, 0xF2, 0x70,
-    0x99, 0x46, 0x05, 0xAB, 0x47, 0x93, 0x40, 0x0E, 0x47, 0x70, 0x47, 0x3E, 0x84, 0x88, 0xA4, 0xBF,
-    0x54, 0x8E, 0xD1, 0xE2, 0x6E, 0xAB, 0x7E, 0x7D, 0x17, 0xE6, 0xE3, 0xDB, 0xD8, 0xB3, 0xA2, 0x5C,
-    0x8A, 0x40, 0x47, 0xCC, 0x38, 0x39, 0xA4, 0x0F, 0x3B, 0xDC, 0xAA, 0xE7, 0x5E, 0xEE, 0xD4, 0xCD,
-    0x25, 0x2B, 0xA0, 0xA1, 0xA0, 0xE9, 0xD5, 0x2B, 0x37, 0xDA, 0xC5, 0x8D, 0xF4, 0xB7, 0xA4, 0xF2,
-    0x84, 0x40, 0xB5, 0x4B, 0x0C, 0xDE, 0x70, 0x1A, 0x2A, 0x0C, 0xD7, 0x21, 0xB0, 0x94, 0x72, 0x19,
-    0x02, 0x4E, 0xA6, 0x1B, 0x57, 0x50, 0x5D, 0xF5, 0x2B, 0xA5, 0xDA, 0xC6, 0x49, 0x1F, 0xB4, 0x1D,
-    0x77, 0xAC, 0x00, 0x92, 0x90, 0x60, 0x81, 0xA0, 0xD6, 0x52, 0xD8, 0x49, 0x4D, 0x18, 0xDF, 0x34,
-    0x5E, 0xA2, 0x48, 0xA1, 0x40, 0x49, 0x85, 0x92, 0xB6, 0x7B, 0x35, 0xBF, 0x01, 0x9B, 0xCE, 0x82,
-    0x9C, 0x34, 0xAA, 0x21, 0xCA, 0x5A, 0x0D, 0x83, 0x01, 0x8C, 0x9B, 0x4B, 0x48, 0x3E, 0x89, 0x40,
-    0x28, 0x65, 0xB5, 0x34, 0x52, 0x85, 0x13, 0x86, 0xE7, 0x48, 0x37, 0xA2, 0x3D, 0x35, 0x10, 0xB3,
-    0x07, 0xF0, 0xA9, 0xC4, 0xCC, 0x14, 0x05, 0xB5, 0x52, 0x9D, 0xC0, 0xDE, 0x6F, 0xFA, 0x8A, 0x5E,
-    0xF5, 0x16, 0x66, 0x92, 0x45, 0x1D, 0x3D, 0xD5, 0x1B, 0xB4, 0x69, 0xDC, 0x44, 0x12, 0xD5, 0x52,
-    0xFB, 0xC1, 0x15, 0x92, 0xBF, 0x19, 0xC5, 0xAE, 0xB7, 0xAB, 0x12, 0x93, 0x50, 0x61, 0x57, 0x25,
-    0xB1, 0xA0, 0xB4, 0x06, 0x3A, 0x22, 0xAE, 0x75, 0xEB, 0x31, 0x97, 0x79, 0x11, 0x31, 0x38, 0x81,
-    0x6E, 0xBF, 0x86, 0xCC, 0x82, 0x67, 0xD7, 0xE4, 0x88, 0x3A, 0x19, 0xEA, 0x5B, 0x32, 0xCC, 0xFB,
-    0xB7, 0x3F, 0x3A, 0xC4, 0xB0, 0x4D, 0x0B, 0xC5, 0xBC, 0xDE, 0x50, 0x0C, 0xE2, 0xCB, 0x3C, 0xBE,
-    0x81, 0xB3, 0x8A, 0x2B, 0x90, 0x23, 0xE2, 0x8D, 0x93, 0x05, 0xD7, 0xCC, 0xF6, 0x76, 0xD0, 0x46,
-    0xAA, 0xCD, 0x82, 0xBA, 0x28, 0x44, 0x94, 0xAD, 0xC7, 0x45, 0x00, 0xAC, 0x49, 0x6D, 0x57, 0xF8,
-    0xDC, 0x38, 0x49, 0x93, 0x1B, 0x62, 0x8A, 0x6F, 0xD0, 0x21, 0x0D, 0x3A, 0x65, 0x58, 0x81, 0xAF,
-    0x86, 0x2C, 0xE5, 0x66, 0x9A, 0x3C, 0x2E, 0xC7, 0x8C, 0x06, 0x32, 0x1A, 0x90, 0x30, 0x6B, 0xAA,
-    0x5A, 0xE1, 0x2F, 0xD0, 0x10, 0x3E, 0x18, 0xC0, 0x1C, 0x47, 0xBB, 0x11, 0x27, 0xE5, 0x45, 0x2E,
-    0x04, 0x15, 0x36, 0xC2, 0x0A, 0xE0, 0x0B, 0xAF, 0x0B, 0x5C, 0x38, 0xA6, 0xA6, 0xA0, 0x11, 0x52,
-    0x89, 0xB2, 0xE7, 0x7B, 0x6E, 0x3B, 0x41, 0x19, 0xFD, 0x03, 0x45, 0x53, 0xBD, 0x6E, 0xD6, 0x30,
-    0x14, 0xBD, 0x71, 0xD0, 0x17, 0xA9, 0x1E, 0x32, 0xB1, 0x94, 0x21, 0x0B, 0x13, 0x12, 0xF8, 0x11,
-    0x1C, 0x8A, 0x50, 0x07, 0x86, 0x32, 0xD0, 0x01, 0x31, 0xB0, 0xB0, 0x30, 0xF5, 0x11, 0x6C, 0xDA,
-    0x07, 0x80, 0x47, 0x40, 0x82, 0x85, 0x3E, 0x01, 0x62, 0xA8, 0x23, 0x31, 0x7C, 0xAB, 0x11, 0x43,
-    0xD7, 0x08, 0x18, 0x40, 0x1D, 0xEA, 0x0A, 0x23, 0x99, 0xCA, 0xC9, 0xE1, 0x3A, 0xFD, 0xC1, 0xB2,
-    0x9C, 0xDC, 0x28, 0xD7, 0xE7, 0xF8, 0x9C, 0x63, 0x22, 0xA2, 0x0A, 0x23, 0x69, 0xC4, 0x1A, 0x08,
-    0x5D, 0xD0, 0x1E, 0xBD, 0x39, 0xC8, 0x84, 0x36, 0xD4, 0xD9, 0x0C, 0xED, 0x19, 0x48, 0x7F, 0x5E,
-    0x4A, 0x99, 0xD4, 0xA8, 0x07, 0x83, 0x99, 0x0C, 0x37, 0x98, 0x89, 0xAE, 0x87, 0xF4, 0x54, 0x73,
-    0xE9, 0x3C, 0x75, 0x13, 0xD5, 0xF0, 0x94, 0x27, 0x52, 0x3B, 0x5E, 0x8E, 0x53, 0x95, 0x5B, 0xAF,
-    0x0F, 0xF1, 0x0E, 0x40, 0xC7, 0xDB, 0x53, 0xEB, 0x89, 0xF8, 0xCF, 0xF2, 0xE0, 0x15, 0x51, 0xE3,
-    0x0B, 0xD0, 0x04, 0x52, 0x96, 0xDC, 0x0F, 0x81, 0xBC, 0x72, 0x99, 0xDA, 0x48, 0x1D, 0xEF, 0x6F,
-    0x9B, 0x7C, 0x88, 0xEF, 0x98, 0x1B, 0xBC, 0xB9, 0x84, 0xA9, 0xD0, 0x37, 0x08, 0x5C, 0x37, 0x73,
-    0xC1, 0x13, 0xF8, 0x40, 0xBC, 0xA7, 0x3E, 0x41, 0xE7, 0xF5, 0x3A, 0x36, 0x71, 0xAE, 0x26, 0x3D,
-    0x38, 0x39, 0xBB, 0x01, 0x18, 0x24, 0x6C, 0xE9, 0x31, 0xF8, 0xE9, 0x30, 0x01, 0xD3, 0x54, 0xA7,
-    0xDC, 0x84, 0xDB, 0x8C, 0xAC, 0x2D, 0x19, 0xA2, 0x99, 0x44, 0xA6, 0x3A, 0x53, 0x13, 0x49, 0x86,
-    0x32, 0x99, 0xC5, 0xE5, 0x30, 0x89, 0x1C, 0x06, 0xB3, 0x9D, 0x14, 0xEF, 0x16, 0xF4, 0x2B, 0xA8,
-    0xA1, 0xC3, 0x50, 0x17, 0x68, 0x3C, 0x48, 0xDD, 0x59, 0x16, 0xD9, 0x90, 0x6B, 0xA3, 0xD9, 0x67,
-    0x9C, 0x0E, 0xFD, 0x55, 0x9F, 0x8B, 0xCC, 0xC7, 0xE2, 0x34, 0xEA, 0xE1, 0x82, 0x92, 0x0C, 0x10,
-    0x59, 0x9D, 0x83, 0x95, 0x1D, 0x36, 0x59, 0xB3, 0x8E, 0x0F, 0x1A, 0x2B, 0x97, 0x6A, 0x24, 0x32,
-    0xE3, 0xD2, 0x73, 0x6B, 0x9D, 0x04, 0x90, 0x05, 0x4E, 0xA2, 0xC8, 0xED, 0x28, 0x47, 0x65, 0x95,
-    0x3D, 0xA2, 0x23, 0x91, 0x44, 0x92, 0x4B, 0x89, 0x6F, 0x58, 0xE3, 0x35, 0x88, 0x56, 0x6F, 0x68,
-    0x69, 0x44, 0xAA, 0xE7, 0xBD, 0xA0, 0x46, 0x35, 0x5E, 0x5B, 0xB3, 0x38, 0x15, 0x96, 0xB2, 0x9A,
-    0xD9, 0xA9, 0xA8, 0x82, 0x1B, 0x34, 0x32, 0xDB, 0x3A, 0xD0, 0xE6, 0x7B, 0xA2, 0x1B, 0xB4, 0xCA,
-    0x2B, 0x04, 0x05, 0x7B, 0x87, 0xB5, 0x4B, 0xD4, 0x8E, 0x45, 0x86, 0xFF, 0xAF, 0x2C, 0x2D, 0x70,
-    0x0C, 0x3C, 0xDC, 0x7D, 0x42, 0x4F, 0xFB, 0x0A, 0x53, 0x05, 0x78, 0x3C, 0x4F, 0xDA, 0x42, 0x7A,
-    0x33, 0x90, 0xF2, 0x85, 0xFC, 0xC5, 0x54, 0x63, 0x99, 0x1A, 0xD8, 0x01, 0xBE, 0xB2, 0x01, 0x37,
-    0x77, 0x1F, 0x73, 0x8F, 0x44, 0x54, 0xC8, 0x7A, 0x6B, 0xBA, 0x5B, 0x4D, 0x45, 0xD7, 0x2E, 0xD4,
-    0x18, 0xD9, 0x51, 0x12, 0x33, 0x11, 0xCA, 0xDA, 0x65, 0x5D, 0x0C, 0xF7, 0x1B, 0xBF, 0xA8, 0x10,
-    0xA2, 0xEE, 0x22, 0x35, 0x1C, 0x17, 0x35, 0x91, 0x3C, 0xF5, 0x15, 0xA7, 0x46, 0xB7, 0xBE, 0xF5,
-    0x93, 0x48, 0x9C, 0x1A, 0xE0, 0x37, 0xA7, 0x66, 0xE3, 0x10, 0x6F, 0xAF, 0x52, 0x23, 0x4B, 0x6A,
-    0x96, 0xC4, 0x6C, 0x23, 0x77, 0x03, 0xB9, 0x5E, 0x20, 0xB6, 0x48, 0x95, 0x59, 0x48, 0x19, 0x2B,
-    0x26, 0xDA, 0xE3, 0xA6, 0x47, 0x88, 0xB2, 0x60, 0xBC, 0xA0, 0x06, 0x56, 0x22, 0xB4, 0x33, 0x49,
-    0x36, 0x9A, 0xED, 0x46, 0x39, 0x66, 0xD4, 0xFB, 0x6C, 0x8F, 0x3A, 0x4E, 0x4D, 0x04, 0x27, 0xC6,
-    0x83, 0x6D, 0xB5, 0x06, 0x56, 0x7C, 0x5A, 0x4C, 0x44, 0x46, 0x09, 0x4C, 0xCE, 0x75, 0xFC, 0xC8,
-    0xDA, 0x30, 0x8E, 0xEE, 0xC9, 0x15, 0x02, 0x7C, 0x2A, 0xD6, 0x4B, 0x5E, 0x05, 0x46, 0xB0, 0x83,
-    0x9B, 0x3D, 0x61, 0x22, 0x38, 0xEF, 0x6A, 0x4E, 0xCB, 0x91, 0x8C, 0xBA, 0x87, 0xB3, 0x2D, 0x6C,
-    0x83, 0x24, 0xFF, 0xE0, 0x20, 0xB6, 0x4B, 0x5A, 0x7A, 0xD7, 0x9E, 0xE3, 0x3E, 0xA3, 0xAF, 0xFE,
-    0x12, 0xBD, 0xE4, 0x20, 0x27, 0xD6, 0x77, 0xC0, 0xB3, 0xA2, 0x2F, 0x53, 0x59, 0x27, 0x4E, 0xCA,
-    0x56, 0xE6, 0x1B, 0x52, 0x3E, 0x57, 0x86, 0x15, 0x09, 0x64, 0xC2, 0x46, 0xB9, 0x93, 0x23, 0xDD,
-    0xB3, 0xF4, 0x0F, 0x45, 0x92, 0x3D, 0x6E, 0xDB, 0x40, 0x14, 0x84, 0x67, 0x97, 0xB0, 0x04, 0x98,
-    0xC5, 0xBA, 0x88, 0xDA, 0xE8, 0x08, 0x3C, 0x02, 0xD9, 0xA5, 0x0E, 0x20, 0x26, 0x65, 0x5A, 0x23,
-    0x4D, 0x2E, 0x10, 0x40, 0x6A, 0xDC, 0xA7, 0x71, 0xEF, 0xC2, 0x8D, 0xED, 0xC2, 0x17, 0x70, 0x40,
-    0x76, 0x69, 0xD5, 0xA4, 0x57, 0xE1, 0x03, 0x28, 0x80, 0x0A, 0x9A, 0x58, 0xEE, 0x64, 0x1E, 0xC9,
-    0x28, 0x5B, 0x2C, 0x3F, 0xEC, 0xCE, 0xBC, 0x7D, 0x3F, 0x5C, 0xD5, 0x75, 0xFD, 0x91, 0x5A, 0xBF,
-    0x6C, 0x73, 0x4D, 0xCF, 0xE8, 0xB8, 0xCB, 0x4E, 0xCB, 0x84, 0xD0, 0xAE, 0x3B, 0x94, 0xD8, 0x1E,
-    0x00, 0x1D, 0x01, 0x4B, 0xD6, 0x1B, 0xAC, 0xC9, 0x0E, 0x5B, 0x72, 0xEF, 0x24, 0x87, 0x54, 0x80,
-    0x54, 0xB8, 0x64, 0xFF, 0x03, 0x25, 0x59, 0xE1, 0x89, 0x0F, 0xD3, 0xD1, 0x68, 0xCC, 0x29, 0x05,
-    0x39, 0xC8, 0xCC, 0x93, 0xCE, 0xE0, 0x53, 0x05, 0x14, 0xC6, 0x64, 0x54, 0xDC, 0x0F, 0x09, 0x59,
-    0xF2, 0x09, 0xCB, 0xE8, 0x06, 0xE4, 0x11, 0x1D, 0x82, 0x79, 0x83, 0x04, 0xFE, 0xB9, 0x7F, 0xAE,
-    0x32, 0x3D, 0x53, 0xF9, 0x26, 0x3D, 0xCA, 0x75, 0x04, 0x16, 0xDB, 0xFE, 0x11, 0x81, 0x8A, 0x1A,
-    0xCC, 0x8F, 0x72, 0x6F, 0x0F, 0xB5, 0xDA, 0x1A, 0x65, 0xB8, 0xE2, 0xED, 0xA7, 0x17, 0x65, 0xC1,
-    0x58, 0xD8, 0xB6, 0xEE, 0x95, 0xEC, 0x62, 0x87, 0xBA, 0x72, 0x5F, 0x79, 0x8F, 0x69, 0xD9, 0x75,
-    0xF5, 0x1F, 0xF7, 0x13, 0x2E, 0xF8, 0x9B, 0xC7, 0x59, 0xC1, 0xB6, 0xE8, 0xCE, 0x18, 0x22, 0xAE,
-    0xCF, 0xE8, 0xE3, 0x19, 0xB3, 0x33, 0x76, 0x4B, 0xE1, 0x6A, 0xB4, 0x9D, 0xBE, 0x71, 0xF0, 0xEA,
-    0x0F, 0xDB, 0xE6, 0x8F, 0x8A, 0x0E, 0x4A, 0x53, 0x4F, 0xB4, 0x96, 0xCF, 0xFE, 0xA7, 0xA1, 0x55,
-    0x58, 0xB6, 0xDF, 0x85, 0xAF, 0x23, 0x1E, 0xDE, 0x49, 0x0B, 0xC3, 0x42, 0x7D, 0x99, 0x31, 0x28,
-    0x93, 0x19, 0xBD, 0x6A, 0x9C, 0x51, 0x8A, 0x7F, 0xF8, 0xDE, 0xCF, 0x38, 0x68, 0x3C, 0x29, 0x57,
-    0x58, 0x6B, 0x6F, 0xE9, 0x07, 0x15, 0xB4, 0x43, 0xC6, 0x54, 0x32, 0x8E, 0xB3, 0x70, 0xEC, 0x0A,
-    0x1E, 0xA6, 0x52, 0x2E, 0x2A, 0xD4, 0xFA, 0xB8, 0xE6, 0xCE, 0xA6, 0x22, 0xBB, 0x26, 0x79, 0xC4,
-    0x3A, 0x7D, 0xD6, 0x83, 0x11, 0x8D, 0x6D, 0xC5, 0x4E, 0xA5, 0xE4, 0x6D, 0x66, 0x43, 0x75, 0xBC,
-    0xD9, 0x4C, 0x8D, 0x1E, 0x27, 0x60, 0xD7, 0x10, 0xE2, 0xCA, 0x7C, 0xD1, 0x22, 0x0C, 0xC0, 0x97,
-    0x41, 0x21, 0xBD, 0xFD, 0x1B, 0x28, 0xAD, 0x7B, 0x81, 0xA3, 0xF3, 0xCD, 0xBD, 0x98, 0x8A, 0x70,
-    0xA3, 0x35, 0x1F, 0x1B, 0x7E, 0xB1, 0xC1, 0x5F, 0x85, 0x54, 0x3D, 0x6F, 0xD4, 0x40, 0x10, 0x1D,
-    0x9F, 0x01, 0x07, 0xAD, 0xC0, 0x29, 0x51, 0x9A, 0xFD, 0x07, 0xA4, 0xA1, 0xA0, 0x00, 0xD9, 0x90,
-    0xE2, 0x0A, 0x1A, 0x8A, 0x58, 0x48, 0x50, 0x5C, 0x43, 0x95, 0x26, 0x14, 0x94, 0x1C, 0xBB, 0x52,
-    0x0A, 0x8A, 0x14, 0xA4, 0xC9, 0x3F, 0x80, 0x26, 0x55, 0x4A, 0x8A, 0xA0, 0x35, 0xDC, 0x0F, 0xC8,
-    0x9D, 0x10, 0x4A, 0x7B, 0xF0, 0x07, 0x58, 0x90, 0xE1, 0x0C, 0xB1, 0x6F, 0x98, 0xB7, 0x97, 0xCB,
-    0x07, 0x10, 0xB1, 0x92, 0x9F, 0x7D, 0xB3, 0xF3, 0xF1, 0x66, 0xF6, 0xED, 0xD1, 0x05, 0x92, 0x95,
-    0x94, 0x80, 0x06, 0xD0, 0x02, 0xEA, 0x19, 0x44, 0xC5, 0x0A, 0xCB, 0xFA, 0x05, 0x98, 0x1A, 0xE0,
-    0x8B, 0x9F, 0x45, 0x51, 0xE4, 0xC6, 0xCE, 0xDD, 0xC9, 0x21, 0x52, 0x01, 0x08, 0x46, 0x52, 0xB9,
-    0xD8, 0x2C, 0x29, 0xB6, 0xE4, 0xD8, 0x2A, 0x66, 0xEB, 0x8C, 0xD9, 0xAC, 0x1A, 0xF3, 0x72, 0xC3,
-    0xEF, 0x2D, 0xE8, 0xD2, 0x92, 0x21, 0x8A, 0x24, 0x34, 0xA9, 0x88, 0xF4, 0x90, 0xC8, 0xE4, 0x14,
-    0xB5, 0xE7, 0xFE, 0x24, 0x0A, 0xFC, 0xD2, 0x1C, 0x20, 0x36, 0x8A, 0x18, 0x9F, 0xAA, 0xBA, 0x58,
-    0x48, 0x9D, 0x7B, 0xA0, 0xF4, 0x2D, 0xB0, 0x73, 0x40, 0xE1, 0x56, 0x38, 0xEC, 0x07, 0xE0, 0x63,
-    0x48, 0xED, 0x11, 0xBF, 0xFF, 0x17, 0xC4, 0x4F, 0xB0, 0xF3, 0x04, 0xB2, 0x6F, 0x32, 0x15, 0xB8,
-    0x4F, 0x26, 0x4D, 0xCA, 0x5C, 0xA6, 0xDC, 0x50, 0x2A, 0x9D, 0x29, 0x99, 0x8F, 0x0A, 0x39, 0xC1,
-    0x85, 0x62, 0xB1, 0xF8, 0xB8, 0x26, 0xD5, 0x90, 0xB4, 0x2C, 0xEF, 0x5A, 0x49, 0x36, 0xD3, 0x05,
-    0xA5, 0x09, 0x80, 0x03, 0xBB, 0xCD, 0xEF, 0x45, 0x61, 0xAC, 0x50, 0x33, 0x70, 0x92, 0x21, 0x31,
-    0x65, 0x96, 0x52, 0x8A, 0x4B, 0x3A, 0x59, 0x19, 0x51, 0xCC, 0xF2, 0x62, 0x79, 0xC9, 0x3E, 0x73,
-    0xDC, 0x36, 0xAC, 0x06, 0x5F, 0xEB, 0xCB, 0xE9, 0x7B, 0x8B, 0x5D, 0x12, 0x76, 0xB1, 0x97, 0x9E,
-    0xCA, 0xE0, 0xBC, 0xD5, 0x5C, 0x53, 0x03, 0x5F, 0x67, 0xFB, 0xFB, 0xDE, 0x38, 0x27, 0x01, 0x1E,
-    0xB1, 0x94, 0xF9, 0xB0, 0x4B, 0x8B, 0xF2, 0x5C, 0xCA, 0x43, 0x5B, 0xA7, 0x8E, 0x84, 0x8D, 0x19,
-    0x48, 0x5B, 0xF1, 0x86, 0xDF, 0x9D, 0xE7, 0x91, 0xB4, 0x51, 0xEC, 0x17, 0x75, 0x3A, 0x18, 0x72,
-    0x96, 0xBD, 0x63, 0x6E, 0x23, 0xE6, 0x61, 0xC4, 0x32, 0x1A, 0x2E, 0xB1, 0x2B, 0x54, 0xA6, 0x3C,
-    0x5B, 0x87, 0xF2, 0x48, 0xF7, 0x9D, 0x57, 0xE7, 0x4D, 0x90, 0x5A, 0x5A, 0x88, 0x2B, 0xDA, 0x4B,
-    0x87, 0xAA, 0xC9, 0x72, 0x57, 0xB6, 0x49, 0x1D, 0x57, 0x66, 0xBB, 0x77, 0x20, 0x81, 0xEB, 0x92,
-    0x5A, 0x72, 0x79, 0x68, 0x28, 0x3C, 0x08, 0x91, 0x0A, 0xCF, 0x84, 0x83, 0x44, 0xAE, 0x49, 0xDE,
-    0x16, 0x07, 0xFC, 0xE7, 0x71, 0x90, 0x16, 0x27, 0x13, 0xD9, 0xA8, 0xD1, 0x36, 0xF1, 0x6C, 0x75,
-    0xC9, 0xB9, 0x21, 0x77, 0xA7, 0x2D, 0x1C, 0x06, 0xDD, 0x9B, 0x29, 0x54, 0xFC, 0x5C, 0x50, 0x0A,
-    0x74, 0x02, 0xC1, 0x40, 0x39, 0x41, 0x42, 0x33, 0x51, 0xEB, 0x31, 0x66, 0x9C, 0x27, 0x56, 0x28,
-    0x66, 0x36, 0xAE, 0xE2, 0x96, 0xD2, 0x61, 0x56, 0x52, 0xB6, 0x22, 0xBB, 0xE0, 0xC5, 0x3F, 0xD0,
-    0x21, 0x88, 0xF2, 0x3D, 0xD1, 0xFA, 0x2A, 0x88, 0x84, 0xF3, 0xC6, 0xE9, 0x4A, 0x3A, 0x68, 0xF2,
-    0x0A, 0x9D, 0x5D, 0xBB, 0xE1, 0x22, 0xD0, 0x5C, 0x77, 0x01, 0x4C, 0x5E, 0x3C, 0xDC, 0xC2, 0x95,
-    0xA9, 0x4D, 0xB8, 0x3C, 0x90, 0xE6, 0x3A, 0x36, 0x12, 0x51, 0x41, 0x71, 0x1F, 0x82, 0x98, 0x2A,
-    0x54, 0xB1, 0x6E, 0x7B, 0x6D, 0x67, 0xAC, 0xFC, 0x71, 0x8E, 0xD9, 0xA7, 0x3F, 0x49, 0xFF, 0x98,
-    0x66, 0xC3, 0x25, 0x23, 0x90, 0x4C, 0x04, 0x5C, 0x57, 0x44, 0xD6, 0x6A, 0x11, 0x51, 0x65, 0x6A,
-    0x75, 0x38, 0x3A, 0xAC, 0xB3, 0x5E, 0xF7, 0xC0, 0xDF, 0xE8, 0xEB, 0x2E, 0x45, 0x55, 0x5F, 0xBC,
-    0x46, 0x98, 0x5F, 0x57, 0xC8, 0xF6, 0x75, 0x4E, 0x1D, 0x98, 0xD4, 0x48, 0x9A, 0x58, 0xEE, 0x4A,
-    0xFF, 0x6F, 0xB5, 0x15, 0xD3, 0xF3, 0xD3, 0xA6, 0xA3, 0x75, 0x33, 0x28, 0xD0, 0xCE, 0x87, 0x25,
-    0xE7, 0xB3, 0xB4, 0xBD, 0x9A, 0x54, 0x81, 0xE7, 0x5D, 0x40, 0x85, 0x36, 0x4C, 0x68, 0xE3, 0x93,
-    0x7C, 0x3D, 0x08, 0xC3, 0xAA, 0xD1, 0x4C, 0x7D, 0x7D, 0xE7, 0xF5, 0x23, 0x04, 0xC5, 0x67, 0x81,
-    0x6E, 0xCD, 0x93, 0x2F, 0x75, 0xB6, 0xFE, 0x59, 0x7B, 0x66, 0xFA, 0x8B, 0x34, 0xFA, 0x88, 0xC5,
-    0xF4, 0x24, 0xD3, 0xDD, 0x0F, 0x9E, 0xFB, 0xDA, 0x94, 0xE8, 0x96, 0xDC, 0x08, 0x3A, 0x96, 0x01,
-    0x90, 0x83, 0x7C, 0x1C, 0x8A, 0x38, 0x50, 0x7E, 0x3A, 0x2F, 0xD4, 0x29, 0xAF, 0x0A, 0x34, 0xE9,
-    0x58, 0x94, 0x14, 0x4D, 0x21, 0x27, 0x3D, 0xEE, 0x60, 0xDE, 0x00, 0x1E, 0xB5, 0x42, 0xBC, 0xC5,
-    0xBF, 0x9C, 0xFE, 0xF2, 0xB1, 0x28, 0x7A, 0x9F, 0x61, 0x1C, 0x2F, 0x03, 0x82, 0x27, 0x65, 0xA5,
-    0x44, 0xC6, 0x4D, 0x2A, 0x27, 0x70, 0x3B, 0x12, 0x88, 0x70, 0x89, 0x7E, 0x03, 0xCD, 0x58, 0x3F,
-    0xCC, 0xDD, 0x56, 0x15, 0x3F, 0x7E, 0x6E, 0x3E, 0xD3, 0x58, 0xE0, 0x0E, 0xFD, 0x90, 0x68, 0x24,
-    0xCC, 0x1C, 0xFE, 0x78, 0x61, 0x44, 0xB5, 0xD3, 0xA8, 0x62, 0xE8, 0x40, 0x41, 0x79, 0x54, 0xD0,
-    0xE1, 0x63, 0x61, 0x68, 0x3A, 0x74, 0x65, 0x49, 0xFD, 0x5A, 0x84, 0xB2, 0x66, 0xA0, 0xAC, 0xED,
-    0x10, 0x24, 0xF2, 0x18, 0xB2, 0xA3, 0x0A, 0x9B, 0x66, 0xC8, 0x90, 0xA1, 0x16, 0x11, 0x64, 0xE8,
-    0x50, 0x47, 0x4D, 0x41, 0x0D, 0x43, 0x9D, 0xE2, 0x8F, 0x38, 0x89, 0xED, 0xD3, 0xDF, 0xEF, 0x5C,
-    0x3F, 0xBF, 0x97, 0x06, 0x89, 0x54, 0x0D, 0x02, 0xEB, 0xF3, 0xFD, 0x9E, 0xAF, 0xCF, 0x3D, 0xF7,
-    0x77, 0xCF, 0xFF, 0xE3, 0xA2, 0x11, 0x89, 0x5A, 0xAD, 0x45, 0xD2, 0x4B, 0x5A, 0xCA, 0x62, 0x0C,
-    0x95, 0x13, 0xD1, 0x20, 0x92, 0x97, 0x69, 0x2F, 0x8B, 0x41, 0xF2, 0xBB, 0xEB, 0x8B, 0x8D, 0x28,
-    0xAE, 0xD5, 0x02, 0x43, 0x2F, 0x01, 0xC6, 0x46, 0x40, 0x52, 0x64, 0x92, 0xF4, 0x7E, 0x8F, 0xB5,
-    0x4D, 0x04, 0x0E, 0x5A, 0x15, 0x22, 0x9E, 0x5E, 0xEA, 0x44, 0x7C, 0x8D, 0x4B, 0x91, 0x70, 0xC0,
-    0x84, 0xC4, 0xDA, 0x62, 0x4C, 0xC1, 0x5D, 0xA4, 0x18, 0x31, 0x08, 0x56, 0x93, 0x64, 0x85, 0x31,
-    0xE8, 0x39, 0xF1, 0x38, 0x07, 0xEF, 0x8F, 0x19, 0x56, 0x6B, 0x26, 0x85, 0x0E, 0x12, 0xFD, 0xA5,
-    0x68, 0xE4, 0xDC, 0x82, 0x34, 0x11, 0x49, 0x8A, 0x72, 0xA2, 0xCD, 0x2B, 0x49, 0xEE, 0x0D, 0x60,
-    0xAA, 0x55, 0xA8, 0x3A, 0x2C, 0x34, 0xD3, 0x32, 0xAD, 0x82, 0x3E, 0xEC, 0x00, 0x58, 0x25, 0xEC,
-    0x63, 0x60, 0x7D, 0x7D, 0x94, 0xA8, 0x49, 0x6B, 0x4F, 0xFD, 0x51, 0xD2, 0x3A, 0xAD, 0xFD, 0xDE,
-    0x57, 0xD1, 0x2C, 0x69, 0x39, 0x87, 0x13, 0x84, 0x3A, 0x12, 0x57, 0x26, 0x72, 0xC4, 0xA0, 0xE9,
-    0x18, 0xE1, 0x4C, 0x57, 0x71, 0xB7, 0x7A, 0xF3, 0xE2, 0x40, 0x70, 0x19, 0xCF, 0x83, 0x77, 0xC0,
-    0x1E, 0xD9, 0xC4, 0xB3, 0xCB, 0x4C, 0xFF, 0x4C, 0x8A, 0x02, 0xDB, 0x26, 0xAA, 0x0F, 0x52, 0x6C,
-    0x26, 0x0E, 0x6F, 0xAE, 0x0F, 0x86, 0x1C, 0x14, 0x07, 0xB8, 0xAF, 0x99, 0xB0, 0xA6, 0xCB, 0x7B,
-    0x29, 0x5B, 0xAC, 0xE4, 0x98, 0xEA, 0x33, 0x1D, 0x77, 0xBD, 0xDB, 0x73, 0x04, 0x9E, 0x74, 0x94,
-    0x02, 0x63, 0x47, 0x26, 0x71, 0x07, 0x29, 0x34, 0x38, 0xB4, 0xA7, 0x43, 0x30, 0x88, 0xD7, 0xEB,
-    0xEB, 0x8A, 0x31, 0x69, 0xB4, 0xF4, 0x86, 0xB0, 0x4F, 0x6B, 0xC1, 0xA1, 0xA3, 0x4E, 0x20, 0xFE,
-    0x4B, 0x23, 0x46, 0xBC, 0x58, 0x41, 0x5E, 0x78, 0x31, 0x88, 0x3F, 0x86, 0xFD, 0x88, 0x85, 0x27,
-    0x78, 0x3E, 0xC8, 0x05, 0x63, 0x51, 0x05, 0xD0, 0x28, 0x84, 0xA9, 0x2D, 0xD8, 0x42, 0xB6, 0x38,
-    0x81, 0x8D, 0xF8, 0x0D, 0x45, 0x56, 0x12, 0xC9, 0xDE, 0x6F, 0x65, 0xE7, 0x7A, 0x9E, 0x38, 0x95,
-    0xBF, 0x80, 0x07, 0x3A, 0x34, 0xBD, 0x41, 0x23, 0x14, 0x18, 0x94, 0xEC, 0xDF, 0xE3, 0xBB, 0x9C,
-    0xA7, 0x0E, 0x6F, 0xF1, 0xDD, 0x40, 0xFD, 0x24, 0x25, 0xDE, 0xF9, 0x1D, 0xB7, 0xCA, 0x33, 0xBC,
-    0x8B, 0x1A, 0xAA, 0x77, 0x94, 0xB8, 0xC7, 0x2B, 0x48, 0x05, 0x46, 0x12, 0x8D, 0x92, 0xAF, 0x24,
-    0x6F, 0xA2, 0x06, 0xA7, 0x3C, 0x01, 0xC2, 0xB4, 0x4F, 0x2B, 0x9A, 0x0B, 0x2D, 0x6B, 0xA4, 0xB8,
-    0xF4, 0xEF, 0xF6, 0x93, 0x22, 0x51, 0x7B, 0xB6, 0xEB, 0x8E, 0x7E, 0xB8, 0x7C, 0x61, 0x48, 0x29,
-    0x15, 0xDA, 0x66, 0x71, 0x02, 0x9B, 0xA6, 0x25, 0x9E, 0xE3, 0x1A, 0xCF, 0x51, 0xE3, 0x69, 0xE9,
-    0x53, 0x76, 0xB0, 0x54, 0x3C, 0xAB, 0x9D, 0x7B, 0x85, 0x67, 0xEC, 0x1B, 0xA8, 0x99, 0xE5, 0x65,
-    0x60, 0x4D, 0x20, 0x6B, 0x3C, 0xF3, 0x18, 0xCA, 0x03, 0x24, 0xB4, 0x2C, 0xDF, 0x9D, 0xAD, 0xE6,
-    0xD9, 0xA8, 0xA3, 0x45, 0xC6, 0x63, 0xBF, 0x4C, 0x09, 0x51, 0xC1, 0x15, 0x0D, 0x5D, 0x33, 0x42,
-    0x19, 0x02, 0x3D, 0x27, 0x4E, 0xD7, 0xC0, 0x41, 0xC3, 0x35, 0xAB, 0x84, 0x71, 0xD9, 0xC4, 0xAF,
-    0x96, 0xCB, 0xE5, 0xF7, 0x0D, 0x2D, 0x55, 0xAE, 0xA6, 0x7C, 0x3D, 0xD4, 0x37, 0x30, 0x7D, 0xD2,
-    0x2C, 0xDE, 0x51, 0x27, 0xAD, 0x6C, 0x98, 0x48, 0x4E, 0xE1, 0x9A, 0x22, 0x86, 0x49, 0x29, 0xB6,
-    0xA5, 0xEC, 0x39, 0xCB, 0x12, 0x39, 0xCD, 0xC1, 0xB7, 0x75, 0x10, 0x99, 0x3C, 0x45, 0xC2, 0x90,
-    0x84, 0x1E, 0x99, 0x57, 0x31, 0xC7, 0x13, 0x7A, 0x83, 0x92, 0x85, 0x3B, 0xD4, 0x92, 0xD7, 0xF0,
-    0x47, 0x98, 0x39, 0x27, 0x3A, 0x9B, 0xB8, 0xBE, 0xD4, 0x37, 0x7E, 0x68, 0xA8, 0xAE, 0xED, 0x62,
-    0xFB, 0xF0, 0xC5, 0x61, 0xF9, 0xBC, 0xAE, 0x92, 0x4A, 0x7C, 0x93, 0x57, 0x38, 0x04, 0x1D, 0x4D,
-    0x18, 0x13, 0x12, 0x8F, 0x4E, 0x38, 0x04, 0x91, 0x18, 0xB6, 0xD8, 0xB0, 0x85, 0x86, 0x2D, 0xA5,
-    0xB8, 0x3C, 0x3B, 0x50, 0x60, 0x87, 0xF0, 0x8A, 0x8D, 0x35, 0x6D, 0xF0, 0x70, 0x4D, 0x64, 0x07,
-    0x28, 0x6A, 0x73, 0x72, 0xC3, 0xDF, 0xED, 0x2F, 0x97, 0xA7, 0x26, 0xA1, 0xEC, 0xE0, 0xB9, 0x03,
-    0xF9, 0x9C, 0x4A, 0xCD, 0x3B, 0x8C, 0xDA, 0xA9, 0xC2, 0xCE, 0x37, 0xD8, 0xD8, 0x5A, 0xD8, 0xA9,
-    0xE4, 0x9B, 0x1B, 0xA1, 0x08, 0x98, 0x9C, 0x37, 0x8A, 0x51, 0x9C, 0x76, 0x6C, 0x5F, 0xBE, 0x3B,
-    0x66, 0x63, 0x60, 0x1B, 0x86, 0xC3, 0x8E, 0xD0, 0x1B, 0xEE, 0x52, 0x5C, 0xFB, 0xAC, 0x7A, 0x5A,
-    0x4C, 0x2F, 0x8B, 0x8A, 0x6A, 0xD7, 0x2D, 0x75, 0x5E, 0xCF, 0x4C, 0x8A, 0xD6, 0x78, 0xAF, 0x48,
-    0xDD, 0xCD, 0x5B, 0x8E, 0xD8, 0x65, 0xEF, 0xFC, 0x46, 0x2B, 0xE2, 0x64, 0x02, 0xC2, 0x8F, 0x0C,
-    0x9B, 0xAE, 0x9C, 0x76, 0x02, 0x87, 0x3B, 0x6A, 0xF6, 0x30, 0x26, 0x15, 0x6C, 0x14, 0xC6, 0x8F,
-    0x58, 0x05, 0x79, 0x43, 0x24, 0x34, 0xD5, 0x7E, 0x1F, 0x6A, 0x48, 0x0E, 0x1F, 0x50, 0xCF, 0x3E,
-    0x94, 0xF6, 0x4A, 0x4B, 0x29, 0x23, 0xE4, 0x59, 0xDC, 0x92, 0xB0, 0x45, 0x4C, 0x90, 0xF8, 0x3A,
-    0xAD, 0x35, 0xFD, 0x78, 0x30, 0xDE, 0x75, 0x6C, 0x80, 0xB8, 0x65, 0xC5, 0x2D, 0xBB, 0x2D, 0x22,
-    0xEA, 0x91, 0x6E, 0xC8, 0x97, 0x77, 0x9C, 0x34, 0x57, 0xC1, 0xD6, 0x66, 0x2A, 0x3B, 0x60, 0x69,
-    0xE7, 0x5E, 0x99, 0x8A, 0x8E, 0x40, 0x10, 0x61, 0xFF, 0x80, 0x7A, 0x9E, 0xC5, 0xF4, 0x8B, 0x26,
-    0x48, 0x53, 0x91, 0xA3, 0x4E, 0x7A, 0xC7, 0x24, 0x9F, 0x75, 0x54, 0x92, 0xF7, 0x5B, 0x53, 0xF0,
-    0x28, 0x6C, 0xE5, 0xFB, 0x36, 0x0E, 0xEE, 0x21, 0x4B, 0xEF, 0x2C, 0x5F, 0xD0, 0x15, 0xC3, 0x23,
-    0x2C, 0x1F, 0x7F, 0xF8, 0xF5, 0x3F, 0x7C, 0x00, 0xE6, 0x55, 0xAC, 0x1D, 0x72, 0x4C, 0x68, 0x40,
-    0x2B, 0xB5, 0xA0, 0x20, 0x4E, 0x8B, 0xDA, 0x31, 0x11, 0xA8, 0x89, 0xAB, 0xD4, 0xC3, 0xE5, 0x41,
-    0x13, 0x33, 0x04, 0x2F, 0x18, 0x73, 0x18, 0x0F, 0x43, 0x9C, 0xD6, 0x8C, 0x9B, 0x12, 0x89, 0x46,
-    0xB3, 0xD6, 0xCA, 0xC4, 0x32, 0x67, 0xB4, 0xBC, 0xD9, 0x18, 0x93, 0x0D, 0x66, 0x8A, 0xC1, 0xB8,
-    0xF1, 0x05, 0x1B, 0x68, 0x70, 0x4F, 0x7B, 0x60, 0x14, 0x97, 0x58, 0x12, 0x21, 0xB2, 0x23, 0xB7,
-    0x15, 0x73, 0xEC, 0x7B, 0xCE, 0xED, 0xBE, 0x49, 0x1C, 0x4F, 0xD0, 0x09, 0x6E, 0xE3, 0xFE, 0x18,
-    0x37, 0x42, 0xCA, 0x29, 0x17, 0x16, 0xC2, 0x9E, 0x89, 0xDA, 0x45, 0x2E, 0x04, 0x52, 0x64, 0x3F,
-    0xC0, 0x02, 0x00, 0xF0, 0x5E, 0x60, 0x3B, 0x7F, 0x70, 0x09, 0x73, 0x43, 0x92, 0xD4, 0xCE, 0x56,
-    0x8D, 0x24, 0xB3, 0x08, 0x3F, 0x93, 0x74, 0xCE, 0x74, 0x66, 0x12, 0xDC, 0x4B, 0x1E, 0x32, 0x73,
-    0x5C, 0xC9, 0x3D, 0x69, 0x1C, 0x4D, 0xD8, 0xB9, 0xDD, 0x91, 0x58, 0x5D, 0x96, 0xD0, 0x5D, 0xA2,
-    0x7A, 0x4B, 0x44, 0xC6, 0xDC, 0x60, 0x26, 0xE2, 0xC6, 0xE4, 0x4E, 0xA2, 0xB8, 0x71, 0xC0, 0x48,
-    0xE4, 0x9D, 0x92, 0x00, 0x8F, 0xD3, 0x1D, 0xF9, 0xCD, 0x2F, 0x92, 0xAB, 0x1F, 0xF4, 0xA9, 0xC5,
-    0x5C, 0xC4, 0x83, 0x9C, 0x39, 0x4C, 0x33, 0x28, 0xAB, 0x4D, 0xEF, 0xE9, 0x10, 0x5F, 0xBA, 0xDE,
-    0x7F, 0x39, 0x68, 0xBE, 0x3B, 0xAF, 0xF1, 0x90, 0xAF, 0x4E, 0x67, 0x9E, 0x19, 0x63, 0xA5, 0x2F,
-    0xF6, 0xB9, 0x14, 0x49, 0x19, 0x5F, 0x69, 0xFC, 0x4F, 0xFA, 0x45, 0x9F, 0xFE, 0x15, 0xF5, 0x8C,
-    0x32, 0xE2, 0xEF, 0xDD, 0x91, 0xA7, 0x5E, 0xD3, 0x2B, 0x9A, 0xF4, 0x79, 0xBD, 0x6F, 0xDA, 0x3E,
-    0x4A, 0x65, 0x2D, 0xFA, 0xD9, 0x87, 0x7D, 0x17, 0x96, 0xB7, 0x7E, 0x64, 0x71, 0x2E, 0x2E, 0xB7,
-    0x54, 0xAB, 0x99, 0xAA, 0x30, 0xAA, 0x3A, 0x80, 0xEE, 0x07, 0x22, 0x8C, 0x61, 0x16, 0xCD, 0xA2,
-    0x93, 0xAF, 0xAA, 0xA4, 0x19, 0x4E, 0x46, 0x60, 0xC5, 0xAA, 0xE0, 0x01, 0x23, 0x56, 0x04, 0xA5,
-    0x09, 0x83, 0xBC, 0xE2, 0x0F, 0xE8, 0xA9, 0x9A, 0x72, 0xFD, 0xED, 0x66, 0x53, 0x11, 0xF9, 0x66,
-    0x44, 0x69, 0x3F, 0xBB, 0x59, 0xBC, 0xDD, 0xE6, 0x09, 0xF1, 0x90, 0x40, 0x83, 0x12, 0x06, 0xDB,
-    0xA8, 0x5E, 0xE9, 0xD2, 0xD7, 0xB5, 0x89, 0xCB, 0xB4, 0x09, 0x6B, 0xBF, 0x5B, 0xC0, 0x32, 0xB3,
-    0xFC, 0x19, 0x6D, 0x23, 0x65, 0x99, 0xD0, 0x47, 0x4D, 0xD2, 0x49, 0x8F, 0x14, 0xBE, 0x67, 0xEB,
-    0x20, 0x96, 0x32, 0x84, 0x60, 0xFA, 0x88, 0x66, 0xFE, 0xAE, 0xF6, 0xF9, 0x49, 0xAD, 0x21, 0x9E,
-    0xB4, 0x8E, 0xAE, 0xD4, 0x21, 0x44, 0xD4, 0xC1, 0x1C, 0xFB, 0xDC, 0xC7, 0x64, 0x84, 0x3C, 0x0B,
-    0x0E, 0x5D, 0xAC, 0x65, 0xD2, 0x31, 0x5C, 0x3D, 0x8F, 0x6D, 0x99, 0xB0, 0x85, 0xA9, 0x04, 0x07,
-    0xE9, 0xE6, 0xD0, 0xFF, 0x88, 0x27, 0xB7, 0x11, 0xF9, 0x60, 0x8E, 0x3D, 0xED, 0x5C, 0x14, 0x4A,
-    0x60, 0xD1, 0xCC, 0x1C, 0x68, 0xCA, 0x26, 0x56, 0x68, 0x4D, 0x72, 0xF2, 0xA6, 0xB1, 0xB4, 0xEC,
-    0xE1, 0x46, 0x5B, 0x50, 0x54, 0x73, 0x34, 0x77, 0x1E, 0xE9, 0x82, 0xD8, 0x34, 0xBA, 0x44, 0x1C,
-    0x5B, 0xD0, 0x8C, 0xFB, 0x6D, 0xF4, 0x37, 0xE7, 0xA7, 0xC9, 0xE0, 0x3A, 0xAB, 0x73, 0x49, 0xA2,
-    0xDD, 0xE9, 0xF4, 0xFD, 0xDB, 0x83, 0xE6, 0xFF, 0x79, 0x58, 0x66, 0xC7, 0xB3, 0x0B, 0xE9, 0x9F,
-    0xC6, 0xFF, 0xEA, 0xDF, 0x7E, 0xB6, 0x9C, 0x44, 0x68, 0xBE, 0x3A, 0x49, 0x24, 0x31, 0xE9, 0x68,
-    0x6F, 0xF1, 0x9D, 0x47, 0x4B, 0x3F, 0x6E, 0xCC, 0xD6, 0x2A, 0x7A, 0xA4, 0xF3, 0x51, 0xF3, 0x7C,
-    0x86, 0x87, 0xA8, 0xB3, 0xBA, 0xBD, 0x84, 0x17, 0x22, 0x1A, 0xC1, 0x1F, 0xF1, 0x03, 0x84, 0xA0,
-    0x2A, 0x56, 0x3E, 0x4B, 0x48, 0x3A, 0x81, 0x6F, 0x49, 0x28, 0xEC, 0xE9, 0xC7, 0x51, 0x6B, 0x51,
-    0xA4, 0xA1, 0xC0, 0xF3, 0xCB, 0x56, 0x47, 0xAD, 0xC8, 0x33, 0xEA, 0x6C, 0xE6, 0x1D, 0x86, 0x1D,
-    0x75, 0x84, 0x8C, 0x4C, 0x79, 0x19, 0xDB, 0x7A, 0x14, 0x48, 0x60, 0x44, 0xB6, 0x28, 0x03, 0x33,
-    0xBC, 0xC7, 0xE6, 0x78, 0x03, 0xC7, 0x67, 0xE4, 0x33, 0x10, 0x71, 0x63, 0x81, 0xA7, 0xB2, 0x20,
-    0x71, 0x96, 0xF0, 0x95, 0x13, 0xBE, 0x95, 0x22, 0xEE, 0x24, 0x91, 0x0B, 0xB2, 0xBA, 0x2D, 0x9F,
-    0x74, 0x5B, 0x8A, 0x78, 0x3F, 0x37, 0x2B, 0xAA, 0x58, 0x4B, 0xA3, 0xEC, 0xC4, 0x90, 0x8C, 0x3F,
-    0xD6, 0x1A, 0xFC, 0x8B, 0xCB, 0xE0, 0xA6, 0x07, 0x35, 0x12, 0x2E, 0x62, 0x59, 0x70, 0x17, 0xE8,
-    0xE2, 0x7F, 0x60, 0x79, 0x7E, 0x11, 0x85, 0xE7, 0xF8, 0x7F, 0x31, 0x05, 0x6F, 0x08, 0x0F, 0x59,
-    0x0C, 0x5F, 0x1D, 0x21, 0xBF, 0x50, 0xDF, 0x28, 0x2C, 0x03, 0x95, 0xD1, 0xD4, 0x68, 0x41, 0x26,
-    0x3F, 0x31, 0x73, 0xFF, 0x83, 0x15, 0x3F, 0x2B, 0x56, 0x62, 0xA0, 0xBE, 0x87, 0xCE, 0x4C, 0xE1,
-    0x1A, 0x51, 0xFF, 0x98, 0xB3, 0x69, 0x73, 0x01, 0xAB, 0x5B, 0xCC, 0x9E, 0xF3, 0x47, 0x3E, 0xB5,
-    0x92, 0xC7, 0xD0, 0x8D, 0x08, 0xFA, 0x10, 0x09, 0x47, 0x3C, 0x25, 0x34, 0x34, 0x6B, 0xEA, 0x9E,
-    0x3A, 0xBF, 0xD3, 0x3D, 0x14, 0xD6, 0xD4, 0x99, 0x3D, 0xC6, 0xDB, 0xDA, 0xC1, 0x52, 0xC9, 0xE7,
-    0xBB, 0x5E, 0xC2, 0xA6, 0xBF, 0x0B, 0xD9, 0xA6, 0x75, 0x8C, 0x8B, 0xDA, 0x28, 0xFB, 0x86, 0x77,
-    0xC0, 0x39, 0x18, 0x19, 0xF3, 0x8F, 0x4C, 0x1C, 0x69, 0xDD, 0x7A, 0x12, 0x38, 0x42, 0x8D, 0x5C,
-    0x53, 0xD1, 0x31, 0x3D, 0x33, 0x58, 0x8F, 0x9F, 0x77, 0x4F, 0xB9, 0xB0, 0x53, 0x08, 0xB6, 0x73,
-    0x72, 0x77, 0x61, 0x87, 0x9B, 0x82, 0xF3, 0x73, 0x9A, 0xF6, 0x45, 0xA3, 0xF7, 0x9D, 0xE7, 0x6B,
-    0xC1, 0x98, 0xF4, 0x7A, 0x4B, 0x5F, 0xDB, 0x48, 0xE2, 0x11, 0x82, 0x7A, 0x48, 0x39, 0x78, 0x7A,
-    0x43, 0xBE, 0x07, 0xDB, 0xC8, 0x94, 0x55, 0xCC, 0x90, 0xA2, 0x6A, 0xED, 0xBE, 0x02, 0x1B, 0xA9,
-    0x1C, 0x97, 0xD3, 0x99, 0x3C, 0xE9, 0xC3, 0x95, 0xCE, 0xC0, 0xAE, 0x7E, 0x33, 0x26, 0x7F, 0x83,
-    0x75, 0x25, 0x28, 0x9D, 0x9B, 0xA3, 0xD6, 0x75, 0xCF, 0xD7, 0x3E, 0x4B, 0x65, 0xAB, 0xFB, 0x6D,
-    0x30, 0x56, 0xDB, 0xB7, 0x47, 0xFE, 0xCD, 0x5B, 0xEF, 0x3C, 0x19, 0x57, 0xD1, 0x25, 0x84, 0xCD,
-    0x5B, 0xEC, 0x65, 0x0B, 0x1F, 0x0D, 0x40, 0x06, 0xDD, 0x67, 0x72, 0x4A, 0xC2, 0x5A, 0x7E, 0x16,
-    0xE9, 0x2A, 0x8D, 0xB0, 0xE4, 0xF2, 0xA8, 0xFA, 0x49, 0x17, 0x6A, 0xF3, 0xAD, 0x29, 0x20, 0xBB,
-    0xEB, 0x06, 0xCA, 0x69, 0x6B, 0x01, 0x69, 0xF6, 0x3D, 0x43, 0xEF, 0x4A, 0x8E, 0x9C, 0xDA, 0x95,
-    0xC0, 0xE9, 0xF5, 0x79, 0xAB, 0x2B, 0x7F, 0x69, 0x54, 0x77, 0x97, 0x2F, 0xF7, 0xDF, 0xC0, 0x2C,
-    0xEE, 0x2F, 0xE1, 0xDF, 0x19, 0xA8, 0xA7, 0x39, 0xBE, 0x2E, 0x3E, 0xC2, 0xBB, 0x7B, 0xB8, 0x6F,
-    0xAE, 0x75, 0x9D, 0xF9, 0x8C, 0x54, 0xAB, 0xC5, 0x7A, 0x5C, 0xBF, 0x89, 0x29, 0xAC, 0x1D, 0x7F,
-    0x7F, 0x77, 0x7D, 0x3E, 0x81, 0xF4, 0xDF, 0x76, 0x0D, 0x2E, 0x4B, 0xFF, 0x1F, 0x91, 0xDD, 0x7B,
-    0x1C, 0x7E, 0xBA, 0x5E, 0xAF, 0x2F, 0xDC, 0x77, 0xCA, 0x65, 0xB2, 0xA9, 0x5F, 0x0F, 0x37, 0x25,
-    0xF3, 0x56, 0x40, 0xDB, 0x85, 0x07, 0x93, 0x7C, 0x20, 0xC1, 0x98, 0x9E, 0x09, 0x79, 0xA3, 0x1B,
-    0xBA, 0x23, 0xC9, 0x88, 0x87, 0x95, 0x99, 0x7E, 0x01, 0xC5, 0xE7, 0xF6, 0xB1, 0x61, 0x05, 0xB7,
-    0xA8, 0xA1, 0xA7, 0xD6, 0xD5, 0x4B, 0xDF, 0x9E, 0x38, 0xFA, 0x53, 0x61, 0x47, 0x94, 0x7C, 0xAE,
-    0x5D, 0x5E, 0x4C, 0x1E, 0x58, 0x83, 0x8D, 0x90, 0xDC, 0xA1, 0x51, 0x0F, 0x3C, 0x73, 0x36, 0x66,
-    0x19, 0xD5, 0xCB, 0x82, 0xE4, 0xF1, 0xAD, 0xB0, 0xA2, 0x89, 0xD5, 0xD4, 0x12, 0x64, 0x76, 0x5C,
-    0x80, 0x8B, 0xD9, 0x0D, 0xD3, 0x31, 0x3D, 0x36, 0x90, 0xC6, 0xC0, 0xF1, 0xC0, 0x1F, 0x7A, 0x5B,
-    0x56, 0x32, 0x80, 0xCB, 0xD8, 0x0A, 0xEE, 0x13, 0xE8, 0x09, 0xF7, 0x04, 0x63, 0x42, 0x62, 0x60,
-    0x10, 0xCC, 0x79, 0x86, 0xEF, 0x88, 0x7C, 0x7D, 0xDA, 0xF7, 0x49, 0x11, 0x44, 0x22, 0x54, 0x43,
-    0xFC, 0x0B, 0x5C, 0xB1, 0x1D, 0xB2, 0x0F, 0xAA, 0xE6, 0x45, 0x6E, 0x4B, 0xEE, 0x79, 0xCC, 0xAC,
-    0xD7, 0x42, 0x8C, 0xDB, 0x0D, 0x91, 0x3D, 0x61, 0x8D, 0x57, 0xE1, 0x0F, 0x32, 0xA4, 0x18, 0x27,
-    0x6A, 0xB6, 0x4C, 0x99, 0x2C, 0x2A, 0x59, 0xD4, 0xF3, 0x19, 0x1F, 0xB6, 0xAF, 0x91, 0xF9, 0xFB,
-    0x52, 0xD4, 0x6E, 0xBC, 0xD2, 0xD5, 0xA2, 0x12, 0x6C, 0x63, 0x93, 0xF7, 0x30, 0x7D, 0x8D, 0xE9,
-    0xFE, 0xFE, 0x86, 0x7C, 0x8A, 0x75, 0x9C, 0xD8, 0x83, 0xC4, 0xAB, 0xC5, 0xEE, 0xC7, 0x02, 0xD6,
-    0x30, 0x29, 0x3F, 0x90, 0x01, 0x0B, 0x1B, 0xF2, 0x9E, 0xE9, 0x1A, 0xFB, 0x2B, 0x33, 0x2B, 0x26,
-    0x00, 0x0B, 0x6D, 0x1A, 0x3F, 0x55, 0xF1, 0x8B, 0x16, 0x41, 0x5A, 0x43, 0xCE, 0xAF, 0x59, 0x44,
-    0x7E, 0xB6, 0xE3, 0x87, 0x17, 0x85, 0xD1, 0x86, 0xDB, 0x76, 0x32, 0x63, 0xB7, 0x3D, 0x58, 0x81,
-    0xCF, 0x9E, 0x70, 0x2E, 0x5C, 0xBD, 0x9D, 0x09, 0x91, 0xE3, 0x96, 0x2D, 0x86, 0x2D, 0x4A, 0xAB,
-    0xB7, 0x90, 0x78, 0x3D, 0xAB, 0xAB, 0x02, 0x6B, 0x1B, 0xE3, 0x19, 0xAB, 0x25, 0xDD, 0x37, 0xB9,
-    0x69, 0x6F, 0x41, 0xA6, 0x66, 0xF4, 0x2B, 0x32, 0x26, 0xEF, 0x9E, 0x80, 0x01, 0xDB, 0x54, 0x00,
-    0x06, 0x98, 0x40, 0x59, 0xCA, 0x09, 0xA4, 0x72, 0xEA, 0x0F, 0x13, 0x45, 0x73, 0xBA, 0xB8, 0x5B,
-    0xB8, 0xBE, 0xBF, 0xDB, 0x36, 0xE4, 0xE7, 0x26, 0x94, 0x56, 0xE1, 0x6D, 0xE4, 0xCE, 0xC1, 0x75,
-    0xCE, 0x26, 0xB0, 0x92, 0x3E, 0xD6, 0x10, 0x43, 0x6F, 0x5D, 0x4F, 0x3A, 0x6C, 0x4A, 0xB2, 0xB0,
-    0x9F, 0xD5, 0x67, 0xBA, 0xB1, 0x8F, 0x2C, 0x16, 0x95, 0x9D, 0xAE, 0xEC, 0xBB, 0x54, 0xA0, 0xE3,
-    0x7A, 0xFD, 0x96, 0x2D, 0xA7, 0x0B, 0xA9, 0x7D, 0xA2, 0x28, 0xB7, 0xDA, 0xB2, 0xBA, 0xCD, 0x18,
-    0xBF, 0xCB, 0xE1, 0x9F, 0x1C, 0x7A, 0xE5, 0xD7, 0x03, 0x4E, 0xD6, 0x56, 0xE9, 0x9D, 0xDC, 0xF4,
-    0x58, 0xB1, 0xCE, 0x35, 0x23, 0x9B, 0xA1, 0x69, 0x73, 0xAB, 0xAD, 0x92, 0x66, 0x33, 0x69, 0x9D,
-    0x5C, 0xA8, 0xC7, 0xD7, 0x6B, 0xD5, 0x1F, 0xCC, 0xCB, 0x65, 0xD3, 0x7C, 0xEF, 0xF8, 0xB3, 0x6D,
-    0xB4, 0xBB, 0xFB, 0x1C, 0xEF, 0x5E, 0x41, 0x98, 0xB6, 0x2E, 0x79, 0x85, 0xB3, 0xBC, 0xF9, 0x1E,
-    0xB4, 0x32, 0xFA, 0x4D, 0xC2, 0x2E, 0xA2, 0xF7, 0x7A, 0x8C, 0x29, 0x1C, 0xF5, 0x55, 0x89, 0xCA,
-    0x45, 0x9B, 0x20, 0xAE, 0xC9, 0xD3, 0xD1, 0x0A, 0xE5, 0x7C, 0x74, 0x09, 0xB6, 0x23, 0x8B, 0x5B,
-    0xE3, 0xFA, 0xE2, 0xCD, 0xB5, 0x2B, 0x95, 0x5D, 0xAD, 0xAC, 0x57, 0xE1, 0xB5, 0xE2, 0x35, 0x1D,
-    0x56, 0xC8, 0xDB, 0x29, 0x57, 0xA4, 0x28, 0x0A, 0xA0, 0xA7, 0x0C, 0xCA, 0xC3, 0x64, 0x5C, 0x46,
-    0x65, 0x54, 0x2D, 0x7A, 0x9F, 0xDF, 0x67, 0x93, 0x1B, 0xFD, 0x2B, 0xB5, 0x99, 0x41, 0x65, 0xD6,
-    0x45, 0x51, 0x1E, 0xF9, 0xF5, 0x0E, 0xF4, 0xFB, 0xC0, 0x9D, 0x3B, 0x06, 0x70, 0x74, 0x57, 0xF2,
-    0x43, 0xDE, 0x17, 0x53, 0x0F, 0xC0, 0xC1, 0xBA, 0x00, 0x0E, 0xD7, 0xD3, 0x11, 0xE5, 0x43, 0x70,
-    0x62, 0xE0, 0x70, 0x7D, 0x16, 0x9C, 0x18, 0x38, 0x5C, 0x6F, 0xA7, 0x66, 0x08, 0x56, 0xCC, 0x13,
-    0x9C, 0x18, 0x38, 0x8C, 0x15, 0x7B, 0x2B, 0x03, 0x27, 0x9F, 0x17, 0xDC, 0x68, 0xE0, 0xD4, 0x7C,
-    0x1C, 0x12, 0x86, 0xEF, 0xBF, 0x5A, 0x48, 0xF0, 0xAF, 0x36, 0x09, 0x9B, 0xA0, 0x05, 0xB8, 0x22,
-    0x68, 0x01, 0x2E, 0xBC, 0xDD, 0x2E, 0x6E, 0x21, 0x2A, 0xB7, 0x72, 0xE6, 0x0C, 0x1B, 0xD3, 0xF8,
-    0x20, 0x63, 0x20, 0xBC, 0x0A, 0x9F, 0x6A, 0x00, 0x2E, 0x68, 0x0B, 0x80, 0x0B, 0xDA, 0xB0, 0x49,
-    0x83, 0x6B, 0x20, 0x8B, 0x33, 0xFB, 0xDA, 0x55, 0xB2, 0x01, 0x2B, 0xBE, 0x00, 0x38, 0x27, 0x39,
-    0xD7, 0x60, 0x5B, 0x44, 0xA4, 0xE4, 0x08, 0x8E, 0x9F, 0xCE, 0x28, 0x39, 0x03, 0x87, 0x91, 0xE0,
-    0x02, 0x03, 0x87, 0x91, 0xE0, 0x5A, 0x03, 0xD7, 0x8A, 0x81, 0x13, 0x03, 0x47, 0xC9, 0x5D, 0x63,
-    0x1F, 0x4F, 0x70, 0x94, 0x5C, 0xFB, 0x50, 0x92, 0xF3, 0xCC, 0x60, 0x29, 0x7F, 0xD6, 0xD3, 0x16,
-    0xAE, 0x58, 0xFA, 0x7F, 0xF1, 0xA9, 0x54, 0x1F, 0xB8, 0xCA, 0x9D, 0xEE, 0xFA, 0xE8, 0x39, 0x46,
-    0xA1, 0x0B, 0xF0, 0x58, 0x04, 0x58, 0xBD, 0xAC, 0xAC, 0x06, 0xF2, 0x43, 0x46, 0x31, 0xFC, 0xE2,
-    0x54, 0xE9, 0x2B, 0x4A, 0x17, 0x54, 0x2E, 0xFB, 0xF2, 0x29, 0x45, 0xCF, 0x3B, 0x0A, 0x42, 0x31,
-    0x10, 0x85, 0xE1, 0xA3, 0xB7, 0xB0, 0x11, 0xB2, 0x94, 0x6C, 0xE1, 0x82, 0x5B, 0xB2, 0xD5, 0xF1,
-    0xEE, 0x4B, 0x2C, 0x5C, 0x81, 0x4B, 0xB0, 0xB0, 0xD7, 0x22, 0x85, 0xC2, 0x90, 0xE3, 0x3C, 0x82,
-    0x06, 0xC2, 0xCF, 0x97, 0x09, 0x81, 0x00, 0xBF, 0xB5, 0x1D, 0xD5, 0x4C, 0x19, 0x65, 0xB6, 0x3C,
-    0xB3, 0xAF, 0x55, 0xB4, 0x00, 0xE7, 0x71, 0xD9, 0x5B, 0x3E, 0x97, 0xD9, 0xCF, 0x49, 0x2E, 0xD6,
-    0x62, 0xDD, 0x69, 0xB0, 0xDB, 0x3B, 0x4E, 0xAD, 0xEA, 0xE4, 0x8D, 0xEA, 0x7C, 0x4C, 0x54, 0x31,
-    0xA1, 0xB2, 0x09, 0x3B, 0xD6, 0xE4, 0x2C, 0x7C, 0x43, 0xD8, 0x6C, 0xDF, 0xAB, 0xD1, 0x7A, 0xA5,
-    0xD1, 0xBA, 0x71, 0x42, 0xBA, 0x4F, 0xDD, 0x41, 0x48, 0x13, 0x27, 0xE4, 0x14, 0xC4, 0x71, 0x0A,
-    0xE2, 0x50, 0x83, 0xC8, 0xA9, 0x35, 0x89, 0xFD, 0xFF, 0xAF, 0xF8, 0x02,
+static const uint8_t bookerly_16_boldBitmaps[33717] = {
+    0xD5, 0x9B, 0xB1, 0xB3, 0x25, 0xC7, 0x75, 0xDE, 0x7F, 0x33, 0xCD, 0x7D, 0x23, 0x63, 0xCA, 0x6A,
+    0x06, 0x5C, 0x97, 0x88, 0x0D, 0xC6, 0x01, 0x03, 0x49, 0x2E, 0x6B, 0x12, 0x27, 0xAA, 0x72, 0xB1,
+    0x7B, 0x81, 0x2A, 0x2B, 0x40, 0x80, 0x75, 0xD5, 0x3E, 0xC9, 0x26, 0x03, 0x28, 0x60, 0x60, 0x91,
+    0x92, 0xE1, 0x3F, 0x40, 0xD6, 0x0C, 0x88, 0x40, 0x81, 0x02, 0x6E, 0x20, 0x44, 0x0E, 0x8C, 0x80,
+    0x2A, 0x73, 0x17, 0xAE, 0x82, 0x02, 0xA7, 0x66, 0x37, 0xB0, 0x01, 0x02, 0x04, 0x1C, 0x11, 0xA5,
+    0x62, 0xA0, 0x80, 0x23, 0x62, 0x29, 0x56, 0x89, 0x01, 0x9A, 0xC4, 0x50, 0x18, 0x00, 0x3D, 0xFD,
+    0x39, 0xE8, 0xFB, 0x76, 0xDF, 0x02, 0x60, 0x11, 0xA0, 0x09, 0x81, 0xBC, 0x7B, 0xB7, 0xDF, 0xCC,
+    0x9D, 0x9E, 0x99, 0x3E, 0xDD, 0x7D, 0xFA, 0x9C, 0xF3, 0x7D, 0xA7, 0x1F, 0xB9, 0xA5, 0x3F, 0x2F,
+    0xE3, 0x16, 0x5E, 0x56, 0x9F, 0xC7, 0x14, 0x5E, 0x56, 0x9F, 0x87, 0x34, 0xC5, 0x62, 0x76, 0xBB,
+    0xBA, 0x18, 0x1A, 0x0F, 0x57, 0xBC, 0x5E, 0xD1, 0x90, 0x5D, 0xFA, 0x2C, 0x8F, 0xCC, 0xB7, 0xDD,
+    0xDD, 0x63, 0xBA, 0x9B, 0xC3, 0x2B, 0x39, 0xDC, 0xCD, 0xD3, 0xDD, 0x3C, 0x3D, 0x9B, 0xA7, 0x67,
+    0xB3, 0x7B, 0x36, 0xBB, 0xC7, 0xF7, 0xDF, 0x6D, 0x57, 0x80, 0x76, 0xEF, 0x56, 0x28, 0x26, 0x83,
+    0xF3, 0x05, 0x86, 0x38, 0x79, 0xFA, 0x34, 0xC6, 0xE6, 0x85, 0xF2, 0xE2, 0x3B, 0xB3, 0x24, 0x25,
+    0x27, 0x29, 0x33, 0xC6, 0x09, 0xEC, 0x3A, 0x46, 0xCC, 0x66, 0x57, 0x9A, 0x6C, 0x36, 0xAE, 0xEA,
+    0xF7, 0x8F, 0x9B, 0x83, 0xA4, 0xD2, 0x4B, 0xD2, 0xF5, 0x2F, 0xFE, 0xE4, 0xE9, 0xEF, 0xFB, 0x36,
+    0x77, 0x09, 0x4A, 0xFB, 0xE0, 0x91, 0xCE, 0xD3, 0xDC, 0xB8, 0xE2, 0x39, 0x7D, 0xFE, 0x0C, 0x18,
+    0x3C, 0x74, 0x0B, 0x34, 0x1B, 0x9C, 0x69, 0xC5, 0x4A, 0xB3, 0x95, 0x76, 0xFB, 0x4F, 0x3F, 0x56,
+    0xB7, 0xFD, 0xE9, 0xF8, 0x72, 0x1E, 0xCD, 0x1A, 0x9E, 0x88, 0xCF, 0x8F, 0x3F, 0x4E, 0x74, 0xCA,
+    0x20, 0x79, 0xAC, 0x0A, 0x04, 0x6D, 0xB4, 0x92, 0xC7, 0x29, 0x7D, 0xCE, 0xFE, 0x45, 0xFE, 0xBC,
+    0x59, 0x35, 0xC4, 0xDD, 0xBD, 0xBA, 0x7D, 0xDE, 0xFE, 0x58, 0xF6, 0xC9, 0xCD, 0x49, 0xB9, 0x93,
+    0x76, 0x46, 0xDD, 0x83, 0x61, 0x7E, 0xF0, 0x26, 0xFE, 0x2F, 0x30, 0x7A, 0xE8, 0x17, 0xDE, 0xF7,
+    0xF9, 0x75, 0x68, 0xB4, 0xD2, 0x66, 0x08, 0x8A, 0xB8, 0x99, 0xE1, 0x1F, 0x0A, 0x7D, 0xC2, 0xEC,
+    0x36, 0x35, 0x07, 0x4C, 0x3E, 0xE0, 0x22, 0x5D, 0xEA, 0xB6, 0x2E, 0x41, 0x60, 0xF2, 0x05, 0xFA,
+    0xD4, 0x6D, 0x43, 0x84, 0xC0, 0x64, 0x36, 0xE8, 0xB6, 0x3E, 0x05, 0xFE, 0x08, 0x17, 0x8B, 0x5D,
+    0xC2, 0xD1, 0x4A, 0x2F, 0xEF, 0x4E, 0x5B, 0xAF, 0xE4, 0xBA, 0x6D, 0x8A, 0xD7, 0xEE, 0xD9, 0xB5,
+    0xB4, 0x19, 0x9A, 0x6C, 0x97, 0x61, 0x01, 0xF7, 0xCC, 0x41, 0x81, 0x3E, 0x0D, 0x8B, 0x5D, 0xE1,
+    0x68, 0x8E, 0xE6, 0x80, 0x31, 0x0E, 0xCB, 0xB0, 0xD0, 0x6D, 0xB5, 0x1F, 0x85, 0xDD, 0xA6, 0x99,
+    0x61, 0xC1, 0x29, 0x61, 0x76, 0xD0, 0x0E, 0x03, 0x34, 0x37, 0x81, 0x4F, 0x3F, 0x24, 0xC6, 0xD3,
+    0x3B, 0x40, 0xD0, 0x02, 0x48, 0x19, 0x98, 0xA2, 0x00, 0xB7, 0x0C, 0x0B, 0xD8, 0xD4, 0x25, 0x30,
+    0xB9, 0xCD, 0x80, 0xAE, 0x1F, 0x80, 0x5B, 0x0F, 0xA0, 0xCF, 0xFF, 0x1D, 0x68, 0xE5, 0x01, 0xA3,
+    0xD4, 0x2B, 0x1B, 0x1D, 0x46, 0x6A, 0x15, 0xE2, 0xD3, 0xEF, 0x5C, 0x97, 0xCD, 0x4D, 0x26, 0x3C,
+    0xA3, 0x38, 0xE1, 0xD6, 0x31, 0x0F, 0xD1, 0xEE, 0xAD, 0xFE, 0x2E, 0x19, 0x31, 0x2A, 0x13, 0x96,
+    0x56, 0x07, 0xC3, 0xC1, 0xA0, 0x7B, 0xAD, 0xDE, 0x79, 0x51, 0xBA, 0x37, 0x4A, 0x52, 0x69, 0x82,
+    0xF6, 0x51, 0x70, 0xEE, 0x39, 0xE7, 0x91, 0x67, 0xF3, 0xF4, 0x6A, 0x0E, 0xAF, 0xE4, 0xE9, 0xCF,
+    0x77, 0xF7, 0xEC, 0xF6, 0xBB, 0xB5, 0xC1, 0xD6, 0x23, 0x6F, 0x33, 0x21, 0x76, 0x19, 0xB7, 0x34,
+    0xC2, 0x6E, 0xB8, 0xD8, 0x96, 0xFA, 0xB7, 0x11, 0x5D, 0x66, 0x5C, 0x09, 0x73, 0x5B, 0xE8, 0x33,
+    0x43, 0x62, 0x8A, 0xC8, 0x9B, 0x42, 0x97, 0xB1, 0x1B, 0x63, 0xC2, 0x2D, 0x84, 0x88, 0x22, 0x9A,
+    0x1B, 0x79, 0x32, 0xF8, 0xFA, 0x64, 0xB7, 0x30, 0x6E, 0xF4, 0x99, 0x56, 0x20, 0xCF, 0x14, 0x71,
+    0x0B, 0x63, 0xC2, 0x26, 0xEC, 0x4E, 0xBF, 0xD3, 0x65, 0xBA, 0x8C, 0xB9, 0xF8, 0xD6, 0xD3, 0x7E,
+    0xA7, 0xDF, 0xB0, 0x89, 0x21, 0xE1, 0x16, 0x5C, 0x44, 0xBE, 0x11, 0xE6, 0xC0, 0xEE, 0xB8, 0x95,
+    0x61, 0xA6, 0xA9, 0xAD, 0x37, 0x89, 0xB5, 0xF0, 0x4D, 0x87, 0x7B, 0xC3, 0xB7, 0x52, 0xEC, 0x95,
+    0x9E, 0x3E, 0xB2, 0xFB, 0xEE, 0xF5, 0xFE, 0xB5, 0xC4, 0xAD, 0x03, 0x3E, 0x0F, 0x57, 0x3C, 0x04,
+    0x68, 0x33, 0xF4, 0x09, 0xC6, 0x08, 0x81, 0x47, 0x5E, 0xD0, 0x9D, 0x49, 0x2A, 0x92, 0xDE, 0x3E,
+    0x0F, 0xE7, 0xFE, 0xE1, 0xAB, 0xB4, 0xB9, 0x3E, 0xFF, 0x4B, 0x68, 0x76, 0xA9, 0xCF, 0x6D, 0x41,
+    0xDE, 0xC5, 0x71, 0xB1, 0xAB, 0x5D, 0xCD, 0x0A, 0x5C, 0x3D, 0x7F, 0x4C, 0xFA, 0xAE, 0x34, 0x29,
+    0x5F, 0x3D, 0xBF, 0x71, 0x76, 0x2B, 0xBC, 0xA6, 0xAF, 0x15, 0x97, 0x3E, 0x0B, 0x98, 0x0C, 0x7D,
+    0x06, 0xBB, 0xC1, 0x90, 0xC0, 0x2D, 0x30, 0x45, 0x08, 0x33, 0x08, 0xDA, 0x02, 0xE6, 0x80, 0xEE,
+    0x52, 0x95, 0x71, 0x05, 0x77, 0x51, 0xC5, 0xD3, 0xE8, 0x52, 0x95, 0x1D, 0xEC, 0xE5, 0x2A, 0x11,
+    0xCE, 0x01, 0xCE, 0x8A, 0xA7, 0x91, 0x56, 0x46, 0x29, 0x35, 0x92, 0x56, 0x7B, 0xB4, 0x8A, 0x61,
+    0x35, 0x7A, 0x56, 0x74, 0x1A, 0x32, 0x36, 0x87, 0x15, 0xF7, 0x4F, 0xF2, 0xE8, 0xBB, 0x07, 0xAD,
+    0xA6, 0x8D, 0xFE, 0x50, 0xC4, 0xBD, 0x75, 0xFA, 0xC9, 0x68, 0xDC, 0x6A, 0xAD, 0xE9, 0x47, 0x8A,
+    0xAD, 0x1E, 0xD7, 0x3C, 0xE4, 0x4E, 0xCF, 0x68, 0xB1, 0x52, 0xC1, 0x4A, 0x2B, 0x9D, 0x0E, 0x4E,
+    0xAF, 0x5C, 0x60, 0x5A, 0x78, 0x5A, 0xF3, 0xA8, 0x42, 0xD0, 0x86, 0xB4, 0xD0, 0xCA, 0xD3, 0x1F,
+    0x30, 0x6E, 0x10, 0x3E, 0xCC, 0xE9, 0x50, 0x6E, 0x0C, 0x52, 0x92, 0x74, 0x57, 0x12, 0x3C, 0x52,
+    0x3C, 0x83, 0xE4, 0x3B, 0xE9, 0x68, 0xF4, 0xAE, 0x92, 0xDB, 0x3B, 0x3D, 0x2E, 0xDC, 0xEE, 0xD6,
+    0x56, 0x5F, 0x3D, 0x18, 0xF7, 0x2B, 0xDE, 0xC8, 0xC3, 0x94, 0xC0, 0x1E, 0x60, 0x34, 0x43, 0x48,
+    0x30, 0x66, 0xE8, 0x05, 0xAD, 0x66, 0xD0, 0x0A, 0x6E, 0xBB, 0xA8, 0x21, 0xC9, 0x49, 0x7A, 0x5D,
+    0x52, 0xB1, 0x92, 0x66, 0xBE, 0xF2, 0x36, 0x8D, 0xB4, 0xB5, 0x92, 0xAE, 0xEB, 0x1F, 0x95, 0x42,
+    0xB4, 0x79, 0x88, 0xAD, 0xAE, 0x47, 0x42, 0x04, 0x97, 0xC0, 0x25, 0x9A, 0x90, 0xB8, 0xA6, 0x8D,
+    0x5E, 0x8A, 0x48, 0x99, 0xCF, 0x75, 0x9A, 0x4F, 0xAF, 0xCE, 0xD0, 0xA9, 0xBE, 0xBE, 0x53, 0xE4,
+    0x29, 0xAD, 0x41, 0x5A, 0x07, 0x69, 0x69, 0x25, 0xCF, 0xD5, 0x9B, 0x00, 0x7C, 0x85, 0xDA, 0x28,
+    0x06, 0x01, 0x4E, 0x40, 0x10, 0x34, 0x12, 0x18, 0x09, 0xEC, 0xBB, 0x82, 0xF1, 0x4D, 0xC1, 0x74,
+    0x57, 0xA0, 0xC7, 0x45, 0x5B, 0x8C, 0xE8, 0xB2, 0x11, 0x36, 0x19, 0xE1, 0xDE, 0x79, 0x41, 0x77,
+    0xDC, 0x85, 0x0C, 0x1A, 0xA4, 0x7A, 0x33, 0x1F, 0x5C, 0x34, 0x77, 0xE0, 0xFC, 0xFC, 0xDC, 0x4F,
+    0xD2, 0x32, 0x48, 0x5B, 0x2F, 0x1D, 0xAD, 0xE0, 0xBE, 0x5C, 0x36, 0x83, 0xD1, 0x01, 0xD2, 0x8E,
+    0x93, 0xE2, 0xD9, 0x8B, 0xDA, 0x61, 0x14, 0x34, 0x5A, 0x2E, 0x77, 0x9B, 0xA7, 0x55, 0xA4, 0xD5,
+    0xCA, 0x35, 0x25, 0x27, 0x25, 0x2B, 0xAD, 0x48, 0x33, 0x57, 0x6E, 0xD6, 0x59, 0x07, 0xBD, 0x32,
+    0x9D, 0xB4, 0x34, 0x2A, 0x9E, 0xA9, 0x80, 0x3D, 0x75, 0xCA, 0x69, 0x80, 0x6E, 0xD2, 0x48, 0x85,
+    0x51, 0x3A, 0x8C, 0xA4, 0xCD, 0x25, 0xA3, 0xBB, 0xC2, 0x66, 0x97, 0x08, 0xAF, 0x89, 0xBE, 0xB8,
+    0x8D, 0xF0, 0x6D, 0xCD, 0xFD, 0x31, 0x64, 0x14, 0xB5, 0x4D, 0xBB, 0x91, 0xC4, 0x20, 0x45, 0x46,
+    0xAD, 0x70, 0xD5, 0x73, 0xF5, 0xFC, 0xFC, 0xDC, 0x4A, 0xFA, 0x81, 0xAA, 0x9E, 0x96, 0xF0, 0xDC,
+    0x1F, 0x68, 0x8C, 0xE8, 0x89, 0x15, 0xC5, 0xAD, 0xCA, 0xB6, 0x56, 0xF9, 0xC6, 0xAD, 0xCA, 0xD8,
+    0x1F, 0x17, 0x23, 0xE4, 0x41, 0x11, 0xC2, 0xA9, 0xC2, 0x90, 0xA1, 0x2F, 0xA7, 0x25, 0x36, 0xC4,
+    0xAA, 0x52, 0xDC, 0x04, 0xCE, 0xCA, 0x4C, 0x27, 0xCD, 0xAD, 0x24, 0xA6, 0x9F, 0x4C, 0xBB, 0xCD,
+    0x28, 0x6A, 0xB6, 0xD9, 0xEE, 0x28, 0x2A, 0x0E, 0x7B, 0xAF, 0xC7, 0x85, 0xAB, 0xF3, 0x61, 0xC5,
+    0x48, 0xBE, 0x91, 0x0E, 0xA6, 0xBF, 0xD7, 0x66, 0x77, 0xA3, 0x97, 0x85, 0x3D, 0x5C, 0x22, 0xBC,
+    0x2E, 0xBA, 0xE2, 0x12, 0x7A, 0x4D, 0xCB, 0x98, 0x07, 0x49, 0x7E, 0x92, 0x16, 0x82, 0x56, 0x38,
+    0xF7, 0x55, 0x65, 0x7B, 0x09, 0x23, 0x1D, 0x04, 0x29, 0x0D, 0xB9, 0xD3, 0x57, 0xE5, 0x87, 0x5C,
+    0xEF, 0xA2, 0x2F, 0x2E, 0x31, 0xBD, 0x2E, 0xDF, 0x95, 0x31, 0x33, 0xAD, 0xDA, 0xFA, 0xD2, 0xA9,
+    0x8E, 0x6A, 0xE6, 0x9A, 0x14, 0xEB, 0x58, 0xD5, 0x39, 0x1F, 0x41, 0x1B, 0x4D, 0x28, 0x5C, 0x93,
+    0x66, 0x23, 0x2D, 0x58, 0x2D, 0x70, 0xD5, 0x03, 0x4C, 0x77, 0xF5, 0xB5, 0xE2, 0xF6, 0x69, 0xBE,
+    0x6C, 0x9F, 0x1E, 0x7D, 0x4C, 0x4F, 0x16, 0xB7, 0x2B, 0x7E, 0x09, 0x40, 0x3E, 0x24, 0x97, 0x7B,
+    0xA1, 0xF7, 0xD9, 0xE3, 0xDF, 0x62, 0x5A, 0x6D, 0x6E, 0x45, 0x98, 0x5D, 0x1C, 0xD6, 0x3E, 0x75,
+    0x9B, 0xD9, 0xD9, 0x4F, 0x57, 0x3D, 0x0C, 0x33, 0x9D, 0x68, 0xB4, 0x31, 0x1D, 0x8C, 0xF2, 0xBD,
+    0x66, 0x5C, 0x02, 0x6D, 0x30, 0x1D, 0x30, 0x68, 0xA6, 0xD3, 0x4A, 0xAB, 0xAD, 0xF6, 0xF8, 0xBF,
+    0x05, 0xB8, 0x73, 0xE7, 0xCE, 0xFF, 0x92, 0xF4, 0x86, 0xA4, 0xE7, 0xCE, 0xCF, 0xCF, 0x4F, 0x8F,
+    0x7B, 0xE4, 0xCE, 0x9D, 0x8B, 0xD5, 0xF8, 0x9D, 0x3B, 0x77, 0xEE, 0xDC, 0xFA, 0x34, 0xB0, 0xD7,
+    0x01, 0xBB, 0x78, 0x4C, 0x73, 0xFF, 0xB9, 0x05, 0xC6, 0x9D, 0x6B, 0xF2, 0x9D, 0x96, 0xD3, 0xEB,
+    0x1B, 0x79, 0xCC, 0x03, 0xA7, 0xA2, 0x2F, 0xBE, 0x57, 0x36, 0x52, 0x0C, 0xCA, 0xBF, 0xFE, 0xFB,
+    0x9A, 0xB1, 0x09, 0x0E, 0x70, 0x1E, 0xBB, 0x72, 0x6D, 0x6B, 0x42, 0xEE, 0x55, 0x8C, 0x0A, 0xDA,
+    0x71, 0x0B, 0xFD, 0x4A, 0xB3, 0xC3, 0xE7, 0xEA, 0xED, 0x37, 0x68, 0xE4, 0xD1, 0x8A, 0xDB, 0xE9,
+    0x0F, 0xF8, 0x52, 0xD5, 0xEA, 0x72, 0x0B, 0xE0, 0x69, 0x69, 0x07, 0xAC, 0xA4, 0x03, 0x1A, 0x95,
+    0x3B, 0x2A, 0x30, 0x16, 0x18, 0x4A, 0x5D, 0x86, 0xFA, 0x83, 0x61, 0x03, 0xFA, 0x8C, 0xFC, 0xD9,
+    0xDB, 0xD8, 0xAD, 0xDF, 0x1B, 0x89, 0x61, 0x75, 0x71, 0x7C, 0xF7, 0xC0, 0xBD, 0x5C, 0x28, 0x5D,
+    0x46, 0x76, 0x33, 0xC9, 0x26, 0x93, 0x5D, 0x6C, 0xBC, 0x8B, 0x36, 0x09, 0xFE, 0x95, 0x70, 0xAF,
+    0x64, 0x7A, 0x65, 0x34, 0xA4, 0x46, 0x2F, 0x26, 0xB3, 0x4F, 0xD1, 0x26, 0x17, 0xC7, 0xBF, 0x11,
+    0xD3, 0x2C, 0xD4, 0xE5, 0x46, 0x7D, 0x79, 0x2A, 0xD9, 0xCD, 0x48, 0x92, 0x77, 0x6B, 0xAF, 0x57,
+    0x95, 0x08, 0xF1, 0x6C, 0x3F, 0xFB, 0x46, 0x9D, 0xF5, 0x9C, 0x56, 0x44, 0xC0, 0x28, 0x42, 0x13,
+    0x31, 0xBA, 0x47, 0x13, 0xA0, 0x95, 0x7E, 0xA8, 0x0C, 0x8D, 0x24, 0xCD, 0x55, 0xA0, 0x15, 0xA0,
+    0x39, 0xBF, 0x51, 0xC5, 0xFF, 0x0C, 0x50, 0xCD, 0x4D, 0xD5, 0x25, 0xEA, 0x98, 0xD6, 0xA1, 0x00,
+    0xA3, 0x0C, 0xE0, 0xB4, 0x00, 0xFD, 0x5B, 0x02, 0x28, 0x2E, 0x01, 0xC3, 0xCB, 0x9A, 0xC1, 0xE4,
+    0x21, 0x03, 0x93, 0xD7, 0x02, 0x7D, 0xEA, 0x0B, 0x50, 0x98, 0x12, 0x8C, 0xEF, 0xBC, 0x20, 0x8F,
+    0x91, 0x94, 0x61, 0x92, 0x14, 0xB1, 0xEF, 0xDC, 0x79, 0xF1, 0xA0, 0x11, 0x84, 0xC4, 0xB8, 0xD0,
+    0x09, 0x93, 0xC1, 0xED, 0xAD, 0x76, 0x06, 0xED, 0x41, 0x6B, 0x2F, 0x7D, 0x4B, 0x85, 0xA0, 0x4C,
+    0x73, 0x13, 0x9E, 0x96, 0x36, 0x24, 0x89, 0x20, 0x29, 0x1A, 0x35, 0x5A, 0x8C, 0x70, 0xE9, 0xE1,
+    0x62, 0x35, 0x62, 0x8A, 0x46, 0x7F, 0x25, 0x6F, 0x54, 0x35, 0x4E, 0x8B, 0xD1, 0x0B, 0xDA, 0x8C,
+    0x70, 0xD9, 0x08, 0xFB, 0x01, 0xC5, 0x98, 0x8D, 0xAE, 0x6B, 0x1B, 0x25, 0xAD, 0x41, 0x92, 0x97,
+    0x74, 0xEF, 0x62, 0x56, 0x5D, 0xF9, 0x2B, 0x68, 0xA5, 0x7B, 0x8C, 0x52, 0x46, 0x52, 0x36, 0xBA,
+    0x77, 0x2D, 0xF7, 0xC2, 0x64, 0x9B, 0x31, 0xFB, 0xB8, 0xD3, 0x6E, 0x6E, 0x03, 0xEF, 0x12, 0x75,
+    0x2D, 0xAC, 0x45, 0x78, 0x4F, 0xB1, 0x01, 0xD3, 0x0E, 0xB8, 0x7C, 0x61, 0x20, 0x06, 0xAD, 0x7C,
+    0xB6, 0xD7, 0x69, 0xC5, 0xCC, 0x04, 0x69, 0xA7, 0x97, 0x16, 0xB8, 0x7A, 0xF3, 0xE4, 0x69, 0x3E,
+    0x2D, 0x15, 0x8F, 0x24, 0x6D, 0x04, 0x55, 0xA9, 0xFC, 0xA4, 0x68, 0xE4, 0x3B, 0xAD, 0x46, 0x1E,
+    0x25, 0x23, 0xCF, 0xB4, 0x1B, 0x79, 0x5C, 0x36, 0xF2, 0x8C, 0xD9, 0xC8, 0x33, 0x5C, 0x2A, 0xED,
+    0xFB, 0x7E, 0x19, 0x6B, 0xFD, 0xCD, 0xC8, 0x33, 0x25, 0x23, 0x8F, 0x16, 0x23, 0x6F, 0x14, 0x8D,
+    0x9E, 0x0B, 0x62, 0x94, 0xB4, 0x13, 0x24, 0xDD, 0xE2, 0x72, 0x87, 0x04, 0x49, 0xBB, 0x24, 0xED,
+    0xA1, 0xF6, 0xC6, 0x73, 0x2F, 0x64, 0x23, 0xDF, 0x66, 0x23, 0xDF, 0xEC, 0x46, 0x9E, 0x64, 0xE4,
+    0x4F, 0x8B, 0xB1, 0xD1, 0x7C, 0x15, 0x23, 0xD5, 0xF1, 0xB8, 0x18, 0x94, 0xF9, 0xFE, 0xD5, 0x53,
+    0xB1, 0x1B, 0x79, 0x2E, 0x9E, 0xF2, 0xDC, 0x17, 0xF3, 0x20, 0x29, 0xDF, 0x7F, 0xD1, 0x16, 0x24,
+    0x7D, 0x4B, 0xD2, 0x11, 0x24, 0x2D, 0xEE, 0xED, 0x2F, 0x1F, 0x46, 0xDE, 0x2E, 0x6E, 0xE3, 0x30,
+    0xF2, 0x7D, 0x74, 0xDB, 0xE9, 0x59, 0xF5, 0xE0, 0x1F, 0xBF, 0x89, 0x93, 0x92, 0x91, 0x84, 0x2B,
+    0x77, 0x6E, 0x5D, 0xBA, 0xF4, 0xD0, 0xC1, 0x0E, 0x83, 0x0E, 0x7A, 0x29, 0x21, 0x15, 0x80, 0x2B,
+    0xB7, 0x3D, 0x74, 0xD2, 0x4E, 0xA3, 0x1A, 0xCD, 0x48, 0x6B, 0xAB, 0xAD, 0xD1, 0x3C, 0x1C, 0x34,
+    0x05, 0x2D, 0x74, 0x5B, 0x27, 0xB0, 0xD1, 0x6D, 0xF0, 0x99, 0xAA, 0x78, 0x55, 0x61, 0x86, 0xCC,
+    0xC5, 0x60, 0xB7, 0x8A, 0x8D, 0xF4, 0xAA, 0xE8, 0xA5, 0x31, 0x63, 0xB5, 0x4F, 0x1B, 0x28, 0x2A,
+    0xD1, 0xCA, 0x68, 0xA5, 0xCF, 0x9D, 0x56, 0xC6, 0xD4, 0xAB, 0x7C, 0x41, 0xD1, 0x4A, 0x12, 0xBD,
+    0xA4, 0x4C, 0x5B, 0x9B, 0x72, 0xF5, 0x26, 0x04, 0x1D, 0x46, 0x7A, 0x53, 0xDA, 0xAC, 0xF4, 0xAA,
+    0xE4, 0x47, 0x1D, 0x68, 0xA5, 0x93, 0xAF, 0x63, 0x8A, 0x3D, 0xC0, 0x25, 0xDC, 0x06, 0x8A, 0x68,
+    0xC1, 0x88, 0x8B, 0x4B, 0x05, 0xA6, 0x84, 0x93, 0xAA, 0x09, 0xBB, 0xD0, 0x07, 0xD5, 0x4B, 0x3F,
+    0xED, 0xAE, 0x87, 0x1F, 0xB8, 0x62, 0xE4, 0x07, 0xED, 0x04, 0x7D, 0xAF, 0x36, 0xE3, 0x5B, 0xD2,
+    0xE2, 0x24, 0x82, 0x8A, 0x74, 0x04, 0xED, 0x46, 0xF3, 0x47, 0xFD, 0x0E, 0x3A, 0xEA, 0xED, 0xA6,
+    0x3E, 0x73, 0x71, 0x2A, 0xB5, 0x01, 0x47, 0x1D, 0x1F, 0x2D, 0x3F, 0xC7, 0x69, 0xAE, 0x8E, 0x9C,
+    0x22, 0x7D, 0x01, 0xB7, 0x61, 0x14, 0x09, 0x99, 0x41, 0x0B, 0xEE, 0x80, 0xDF, 0xF1, 0x10, 0x94,
+    0xAD, 0x0E, 0x29, 0x0F, 0xCA, 0x41, 0x6B, 0x55, 0xA0, 0x2A, 0xBD, 0xCD, 0x18, 0x79, 0x97, 0x30,
+    0xF2, 0x8A, 0x18, 0x3D, 0x5E, 0xC0, 0xE8, 0xC9, 0x1D, 0x8C, 0xA6, 0x15, 0x8C, 0x14, 0xC1, 0x48,
+    0x2B, 0x18, 0x85, 0x1D, 0x8C, 0x9E, 0x3E, 0xC0, 0xE8, 0x49, 0x79, 0x8C, 0x1E, 0x57, 0xC4, 0xE8,
+    0xBA, 0x12, 0x46, 0x3E, 0x64, 0x8C, 0xFC, 0x28, 0x6F, 0xE4, 0xAD, 0x96, 0x41, 0xBB, 0xD1, 0x1E,
+    0x74, 0x50, 0x47, 0x60, 0xCC, 0x00, 0xCD, 0xAD, 0x50, 0xBD, 0xB3, 0xA3, 0x46, 0xD8, 0x1F, 0xA4,
+    0x1A, 0x1F, 0xA9, 0xF8, 0x3F, 0x17, 0x7A, 0xD4, 0x64, 0x23, 0x6F, 0xB2, 0xD1, 0x73, 0x5F, 0x79,
+    0xAF, 0x32, 0x19, 0x09, 0xA4, 0xD9, 0x56, 0x77, 0x8E, 0x41, 0x3B, 0xA3, 0x36, 0xAC, 0x12, 0x2A,
+    0xE0, 0x14, 0x3B, 0xED, 0x20, 0xF9, 0x51, 0x2B, 0xE6, 0xAD, 0xC2, 0xA1, 0x88, 0xFD, 0xBB, 0x6C,
+    0xDE, 0x14, 0x4C, 0x4F, 0xA5, 0xF1, 0x5B, 0x99, 0x26, 0xBB, 0xA5, 0x8C, 0x89, 0x3E, 0xE9, 0x6E,
+    0x0A, 0x91, 0xF1, 0x25, 0x0D, 0x2F, 0xCB, 0x23, 0x73, 0x7C, 0xB3, 0x3B, 0x30, 0xD9, 0xBE, 0x9B,
+    0x86, 0x0D, 0x9B, 0x06, 0xC5, 0x69, 0xC5, 0x45, 0x57, 0xD0, 0x4C, 0x41, 0xC9, 0x14, 0xBA, 0xBD,
+    0x51, 0xB4, 0x99, 0x61, 0x35, 0x05, 0x97, 0x08, 0xBE, 0xDF, 0x50, 0xEC, 0xF5, 0xFC, 0x10, 0x07,
+    0x6D, 0xD2, 0x42, 0x23, 0xFD, 0x40, 0x82, 0x4E, 0xF2, 0x4E, 0x91, 0x49, 0x9B, 0x14, 0x5B, 0xE9,
+    0xDB, 0x92, 0xEF, 0x74, 0x30, 0x09, 0xC2, 0x8C, 0x44, 0x5B, 0x30, 0x2A, 0xF4, 0x3B, 0x56, 0x99,
+    0x71, 0xC5, 0x29, 0x13, 0x66, 0x14, 0xF6, 0xB6, 0x60, 0xB2, 0xB6, 0x7E, 0xC7, 0x26, 0xA5, 0x71,
+    0xC5, 0xBD, 0xAC, 0x35, 0xCC, 0xC8, 0xE8, 0xDB, 0x05, 0x93, 0x8D, 0x5E, 0xDD, 0xB1, 0xA9, 0xD3,
+    0x1B, 0x2B, 0x2E, 0x5A, 0x69, 0x46, 0x58, 0x15, 0x4C, 0x66, 0xD0, 0x8E, 0x4D, 0x8C, 0x5A, 0x71,
+    0x11, 0xA7, 0xB9, 0xD7, 0xC6, 0x54, 0x90, 0x12, 0x61, 0x37, 0xAA, 0xAA, 0x03, 0x70, 0x0B, 0xB8,
+    0xF2, 0x97, 0x40, 0x2B, 0xAD, 0x30, 0x9E, 0x06, 0x54, 0x9A, 0x5B, 0xDD, 0x1B, 0xB4, 0x74, 0xA2,
+    0x55, 0xB2, 0x07, 0x68, 0x1B, 0x77, 0x70, 0xD9, 0x6D, 0xE0, 0xB2, 0x4B, 0x30, 0x1E, 0x53, 0x82,
+    0xE1, 0x54, 0x86, 0x04, 0xF6, 0x52, 0x39, 0xE4, 0x69, 0x83, 0x21, 0x4F, 0x3B, 0x8C, 0xBB, 0xCB,
+    0xE0, 0xB6, 0xB1, 0xC0, 0x94, 0xAC, 0x7C, 0xA3, 0xA5, 0xD7, 0xBD, 0x6B, 0x9A, 0x8D, 0x54, 0x41,
+    0x1A, 0x6D, 0x30, 0x54, 0x03, 0xFF, 0x85, 0x1B, 0x00, 0xE7, 0x34, 0xA1, 0xEA, 0x98, 0xF2, 0x58,
+    0x97, 0xEB, 0xC7, 0xB4, 0xD9, 0x03, 0xAD, 0x6E, 0x6B, 0x15, 0xB5, 0x74, 0x32, 0xF2, 0x43, 0xB6,
+    0x07, 0x61, 0x75, 0x9B, 0x91, 0xD7, 0xE2, 0xB2, 0xD1, 0x8B, 0x8A, 0x56, 0xCA, 0x38, 0xC9, 0xA3,
+    0x77, 0x7C, 0x9D, 0x63, 0xF6, 0xA0, 0xEA, 0x1C, 0x5A, 0x4E, 0xD3, 0x6E, 0xAA, 0x41, 0xD3, 0x8A,
+    0xAB, 0xEF, 0xBD, 0xF2, 0x97, 0xD5, 0x48, 0xEC, 0xD0, 0xAA, 0x06, 0x8A, 0x52, 0xA1, 0x76, 0x44,
+    0x53, 0x35, 0x52, 0x0B, 0x56, 0x3E, 0xAC, 0xA0, 0x54, 0x7B, 0xC2, 0x66, 0xE8, 0xF5, 0x7B, 0x82,
+    0x46, 0x7F, 0xA3, 0x08, 0xD3, 0x56, 0x3B, 0x61, 0xCC, 0x60, 0xF4, 0x84, 0xA0, 0xD1, 0x4B, 0x5A,
+    0x60, 0x4A, 0xB5, 0x2F, 0xAC, 0xC0, 0x1E, 0xAD, 0x56, 0x3A, 0x31, 0x1D, 0x74, 0xA2, 0xD7, 0x4F,
+    0xAE, 0xA9, 0x9A, 0xCA, 0x99, 0x5E, 0x92, 0x87, 0x51, 0x07, 0x17, 0x06, 0x99, 0xAE, 0x7A, 0x47,
+    0xAE, 0xF8, 0x3A, 0x56, 0x05, 0x6A, 0xF0, 0x71, 0x81, 0xDD, 0x34, 0x61, 0xBD, 0x30, 0x73, 0xE7,
+    0xD0, 0x04, 0xE9, 0x1E, 0xF6, 0xBE, 0x21, 0xC8, 0x18, 0x5D, 0xD7, 0x86, 0xCD, 0x28, 0xE1, 0x52,
+    0xA3, 0x88, 0xA2, 0x11, 0x46, 0x0C, 0x19, 0x9B, 0x09, 0x2B, 0x2E, 0x75, 0x02, 0xFD, 0x8D, 0xB6,
+    0x6A, 0xF7, 0x6A, 0x34, 0x5D, 0xFB, 0x11, 0x7D, 0x47, 0x60, 0xD4, 0x0B, 0x6C, 0xAE, 0xAB, 0xB0,
+    0x2D, 0xA0, 0x38, 0x14, 0x8C, 0x18, 0xC5, 0xA4, 0xD5, 0xE9, 0x09, 0x29, 0x3A, 0x05, 0xE9, 0xB4,
+    0x4E, 0x9C, 0xCD, 0x34, 0x7F, 0x54, 0xA3, 0xE5, 0x51, 0x4A, 0xA3, 0x94, 0xED, 0x81, 0xFA, 0x83,
+    0xF1, 0xAE, 0xE8, 0x93, 0x96, 0x66, 0x73, 0x19, 0x7A, 0xAD, 0x34, 0xD2, 0xCC, 0xA8, 0x42, 0x2B,
+    0x6D, 0x0C, 0x92, 0x67, 0x52, 0x82, 0x50, 0x1E, 0xA5, 0xD3, 0xD7, 0x22, 0xD3, 0x0F, 0x36, 0x86,
+    0xB7, 0x45, 0x7F, 0x4C, 0xA9, 0x93, 0x95, 0xF4, 0x78, 0x0D, 0x59, 0x0A, 0x7C, 0xE1, 0x2F, 0xA9,
+    0x06, 0x63, 0x97, 0x4E, 0x51, 0xB4, 0xF4, 0xB5, 0x77, 0x9E, 0x2A, 0x5F, 0x39, 0x5C, 0x74, 0x5B,
+    0xB7, 0x15, 0xB4, 0x0C, 0xAF, 0x6D, 0x46, 0x7E, 0x6A, 0x67, 0x7B, 0xF0, 0xF5, 0xD3, 0x74, 0xA8,
+    0x9A, 0x60, 0xE4, 0x39, 0x4D, 0x92, 0x8F, 0xF6, 0xF3, 0x99, 0xB4, 0x50, 0x67, 0x50, 0x23, 0x1D,
+    0x30, 0xA9, 0x34, 0xD2, 0x5B, 0xD2, 0x3A, 0x4A, 0x4E, 0x7B, 0x23, 0xCD, 0x63, 0x06, 0xC5, 0x46,
+    0x11, 0x9B, 0x19, 0x7E, 0xA1, 0x27, 0xF6, 0xA0, 0xD1, 0x8C, 0x12, 0x6E, 0xA3, 0xD7, 0xBD, 0xA7,
+    0x55, 0xFB, 0x21, 0x82, 0xA4, 0x0D, 0xDA, 0xEA, 0xFF, 0xF3, 0xE5, 0x5B, 0xE0, 0x54, 0x1A, 0xE9,
+    0x15, 0x69, 0x1D, 0x95, 0x9D, 0x76, 0x82, 0xFC, 0x94, 0x41, 0xD1, 0x28, 0x32, 0x6C, 0x35, 0x24,
+    0x00, 0x25, 0xDC, 0x4A, 0x2F, 0xBA, 0x0C, 0xD3, 0x46, 0x88, 0x18, 0x45, 0xBB, 0xC1, 0x90, 0x1B,
+    0x01, 0x5A, 0xC6, 0x15, 0x7A, 0x99, 0x0C, 0xB8, 0x34, 0x45, 0x30, 0x7A, 0x72, 0x03, 0x86, 0x5D,
+    0x00, 0x7A, 0x63, 0xA5, 0xC6, 0xDD, 0x80, 0x53, 0x04, 0xCC, 0x85, 0x53, 0x5E, 0x3D, 0xF4, 0x95,
+    0x1A, 0x72, 0x5C, 0x7C, 0x9C, 0x0A, 0xBF, 0xED, 0x3B, 0xC9, 0x4A, 0xF3, 0x98, 0x5A, 0xE9, 0x65,
+    0x29, 0xDA, 0x03, 0xA7, 0x68, 0xAB, 0xEB, 0xA5, 0xB9, 0xD5, 0xD2, 0x28, 0x31, 0x45, 0xA6, 0x8D,
+    0x90, 0x19, 0x13, 0xB6, 0xE0, 0x34, 0xDB, 0x9D, 0x56, 0xD1, 0x2A, 0x99, 0x0C, 0x53, 0xEA, 0x94,
+    0x9B, 0x93, 0x96, 0xC9, 0x87, 0x99, 0x56, 0xB3, 0xA6, 0xD5, 0x45, 0x98, 0x92, 0x7B, 0x32, 0xDB,
+    0x04, 0x36, 0x0F, 0x77, 0xD5, 0xED, 0xD0, 0xEA, 0x89, 0x34, 0x7D, 0x2F, 0x03, 0xD3, 0xEB, 0xBB,
+    0xCD, 0x02, 0x6C, 0xCE, 0x46, 0x6E, 0x86, 0x56, 0x81, 0xE9, 0x8D, 0x05, 0x98, 0x34, 0x5B, 0x25,
+    0xC0, 0x6A, 0x31, 0xDA, 0x81, 0x56, 0x89, 0xA9, 0xAA, 0xE8, 0x8E, 0x15, 0x75, 0x46, 0x98, 0x53,
+    0xCC, 0x01, 0xD3, 0x65, 0xD0, 0x78, 0x90, 0x1E, 0x97, 0x7A, 0x69, 0x91, 0x5E, 0x92, 0x96, 0x41,
+    0x4B, 0xA7, 0xD8, 0xC8, 0x33, 0x65, 0x34, 0xD3, 0xCB, 0x57, 0x88, 0x28, 0x44, 0xB0, 0x9A, 0x22,
+    0x20, 0x2D, 0xC0, 0xA0, 0x05, 0x68, 0x6B, 0x7F, 0x4D, 0xA7, 0xFE, 0x9C, 0x01, 0xA7, 0x0D, 0x18,
+    0xDF, 0x15, 0x30, 0x24, 0x25, 0xB0, 0x9B, 0x2D, 0x60, 0x73, 0xAB, 0x85, 0x3E, 0xE3, 0x32, 0xFD,
+    0x81, 0x51, 0x1C, 0x74, 0xEF, 0x4C, 0x7A, 0x4A, 0xEA, 0xA4, 0x77, 0xA5, 0x67, 0xA4, 0x3C, 0xE9,
+    0xE8, 0x75, 0x54, 0x9F, 0xC2, 0x69, 0xEB, 0xB4, 0x75, 0x8A, 0x84, 0xB9, 0xD1, 0x82, 0x40, 0xA9,
+    0x2D, 0x30, 0x6D, 0x26, 0xC3, 0x98, 0xFB, 0x0D, 0xEC, 0x61, 0x57, 0xE8, 0x34, 0x46, 0x30, 0x9A,
+    0x66, 0x40, 0x02, 0x08, 0x55, 0x39, 0x32, 0xC0, 0xB8, 0xFF, 0xCC, 0xB2, 0xDA, 0x19, 0x2B, 0xA5,
+    0x53, 0x69, 0x25, 0xAD, 0x56, 0xD2, 0x36, 0x48, 0xDA, 0x87, 0xB7, 0xCF, 0x95, 0x86, 0xD8, 0x68,
+    0x1D, 0xA2, 0x51, 0xB4, 0xBE, 0x02, 0x53, 0xC7, 0xC5, 0x3B, 0x94, 0xA0, 0xD5, 0x72, 0x5A, 0x11,
+    0xAD, 0x80, 0xF1, 0xB8, 0x08, 0x4F, 0x94, 0xF8, 0x92, 0x51, 0x24, 0xF7, 0x9A, 0x9B, 0xC3, 0x8A,
+    0x36, 0xBB, 0xE3, 0xFC, 0x8B, 0xD9, 0x49, 0xCA, 0x4E, 0xD2, 0x3E, 0x54, 0xA5, 0x00, 0x54, 0x54,
+    0x54, 0xC4, 0x47, 0xFE, 0x77, 0xA8, 0xA8, 0x40, 0xF0, 0x15, 0x24, 0x75, 0x0B, 0x8C, 0xA9, 0xE2,
+    0x33, 0xFD, 0x5E, 0xC1, 0x54, 0x53, 0xA0, 0xEA, 0xC9, 0xE5, 0x4A, 0xEB, 0x83, 0x4A, 0x5D, 0xAE,
+    0x78, 0xE9, 0xFD, 0x4A, 0x61, 0xAE, 0x60, 0xE9, 0xB8, 0x56, 0x7C, 0xD5, 0x6E, 0xB5, 0x52, 0x73,
+    0x73, 0xD2, 0xA8, 0x57, 0x94, 0x4C, 0x46, 0xB8, 0x68, 0x3F, 0xEA, 0xC1, 0xA4, 0x51, 0xAF, 0x2A,
+    0x9D, 0xA6, 0xA1, 0x39, 0x80, 0x0B, 0x2C, 0xD2, 0x15, 0x18, 0xDE, 0x88, 0xD8, 0xD7, 0x37, 0xCC,
+    0x26, 0xDA, 0x3C, 0x46, 0x8A, 0xD9, 0x99, 0xBC, 0x70, 0x71, 0x58, 0x86, 0xD5, 0xE4, 0x3E, 0x21,
+    0x93, 0x19, 0xBE, 0x57, 0x30, 0x55, 0x59, 0xCF, 0xCF, 0xCF, 0xCF, 0xDD, 0x09, 0x12, 0x79, 0xE7,
+    0xCE, 0x9D, 0x3B, 0xB7, 0x3F, 0xC5, 0xEF, 0x30, 0xF9, 0x29, 0x8E, 0xA9, 0xDF, 0x9B, 0xCC, 0x6F,
+    0x02, 0x67, 0xB7, 0x61, 0x50, 0xA6, 0x97, 0x52, 0xAB, 0x1F, 0xCA, 0xBB, 0x75, 0xD8, 0xCD, 0x81,
+    0xE6, 0xB3, 0xD9, 0xEE, 0xB5, 0x0D, 0x8F, 0x56, 0xDB, 0x34, 0x0F, 0xD2, 0x6E, 0x34, 0x6B, 0x9E,
+    0x56, 0xBB, 0xF7, 0x07, 0x9A, 0xC3, 0x3A, 0xE6, 0x4E, 0x52, 0x71, 0x7A, 0x4B, 0x8B, 0x76, 0xB7,
+    0x71, 0x93, 0x9B, 0x15, 0x18, 0x3F, 0x53, 0xBA, 0x08, 0xE9, 0xEB, 0xFC, 0x53, 0xA4, 0x22, 0x66,
+    0xD8, 0x7C, 0x01, 0x2F, 0xA2, 0x97, 0x6E, 0x83, 0x7B, 0x4B, 0x3B, 0x56, 0x15, 0x69, 0x52, 0x42,
+    0xDB, 0x58, 0x70, 0xC9, 0x28, 0xDA, 0xCC, 0x94, 0x8C, 0xB0, 0xB9, 0x5A, 0x41, 0x97, 0x50, 0xB4,
+    0xB9, 0x86, 0xE2, 0x36, 0xA3, 0xD8, 0xD5, 0x9A, 0xDE, 0xE6, 0x56, 0xD1, 0x48, 0x8A, 0x8D, 0x2A,
+    0xD6, 0xA7, 0x19, 0xAE, 0x9E, 0x03, 0xED, 0x6D, 0x9A, 0x6A, 0xD6, 0x1E, 0xD3, 0x1B, 0x65, 0xD8,
+    0x6D, 0x56, 0x1C, 0x7F, 0x50, 0x98, 0x4E, 0xC8, 0xB1, 0x91, 0xC7, 0x96, 0x0A, 0xF9, 0x86, 0x44,
+    0xA3, 0x84, 0xD1, 0xDB, 0x5F, 0x7C, 0x45, 0x52, 0x2F, 0xED, 0x9D, 0x34, 0x73, 0xEE, 0xA1, 0xC2,
+    0x5F, 0x83, 0x66, 0x98, 0xEE, 0x17, 0xED, 0xFB, 0x8B, 0xB3, 0x3B, 0x9A, 0x09, 0x27, 0x69, 0x66,
+    0xAB, 0x37, 0x34, 0x8F, 0xB9, 0xD5, 0xEC, 0x52, 0xAB, 0x79, 0x5A, 0x5B, 0xCD, 0x61, 0x6D, 0x35,
+    0x87, 0xA5, 0xD5, 0xAC, 0xA5, 0xD5, 0xAC, 0x07, 0xBF, 0xA5, 0x56, 0xF3, 0xB4, 0xB5, 0x9A, 0x5D,
+    0x79, 0x4A, 0xB3, 0x93, 0x74, 0xCF, 0xAA, 0xA8, 0x18, 0x6D, 0xE1, 0xE0, 0x2A, 0x57, 0xEB, 0x90,
+    0x05, 0x2D, 0x46, 0xDA, 0x6C, 0x09, 0x79, 0x48, 0xFD, 0xE1, 0x16, 0x53, 0xA6, 0x68, 0x14, 0xBE,
+    0xFF, 0x07, 0x0A, 0x27, 0x4C, 0x53, 0x7F, 0x7B, 0x7E, 0x33, 0x44, 0x08, 0x4B, 0x75, 0x4D, 0x5C,
+    0xB9, 0xFE, 0x27, 0x83, 0x74, 0xF4, 0x52, 0x6E, 0xA4, 0xB5, 0xA2, 0xAE, 0x5F, 0xB9, 0x57, 0xD7,
+    0x27, 0x2B, 0x45, 0xA3, 0x37, 0x32, 0xD3, 0x3A, 0xCE, 0x7D, 0xE6, 0x79, 0x14, 0xEB, 0x40, 0x35,
+    0x8A, 0x54, 0x04, 0x53, 0x4A, 0xBD, 0x74, 0xD0, 0x28, 0xD6, 0x40, 0xF4, 0x43, 0x1F, 0x4C, 0xBA,
+    0xC5, 0x58, 0x63, 0xC3, 0x04, 0xCD, 0xED, 0x2B, 0xDF, 0x60, 0x94, 0x0A, 0x15, 0x95, 0xF8, 0x1F,
+    0xE5, 0x8F, 0xBB, 0xA3, 0x51, 0x85, 0xB5, 0xFA, 0x8C, 0xE6, 0x3E, 0xA3, 0xB9, 0x2B, 0xAD, 0xBC,
+    0xD1, 0x1B, 0x3A, 0xF1, 0x5D, 0xD2, 0x8A, 0xC9, 0x37, 0xA1, 0xDB, 0xA8, 0xCA, 0x49, 0x2F, 0x69,
+    0xEE, 0x74, 0x0A, 0xC4, 0x37, 0xFB, 0x8E, 0xB4, 0xBB, 0x84, 0xDD, 0xDD, 0xCA, 0xB0, 0x4D, 0x89,
+    0x29, 0xB9, 0xF2, 0x82, 0x96, 0x51, 0x95, 0x04, 0xD8, 0xE1, 0xCB, 0xB7, 0x3D, 0x5C, 0x85, 0x8A,
+    0x1E, 0x12, 0xE4, 0xA1, 0xD7, 0x76, 0xDF, 0x57, 0x70, 0x97, 0x0E, 0x13, 0x60, 0xD4, 0xDC, 0x06,
+    0xF7, 0x23, 0x1D, 0xD4, 0xC9, 0xE9, 0xEA, 0x3C, 0xBD, 0x37, 0x65, 0xDC, 0xDE, 0x28, 0xD6, 0xB0,
+    0xCE, 0x6D, 0x7C, 0xE8, 0xC3, 0xF0, 0x76, 0xAB, 0x7B, 0x4E, 0x29, 0xE8, 0x35, 0xC9, 0x2A, 0x73,
+    0x95, 0x46, 0xB3, 0x51, 0x34, 0x8A, 0xAD, 0x66, 0x6E, 0xDF, 0xF7, 0x0F, 0xFD, 0xA8, 0x79, 0xD2,
+    0x3C, 0x6A, 0x6E, 0x7E, 0xD6, 0xB7, 0xD3, 0x3D, 0xA7, 0xEC, 0x94, 0x69, 0x6E, 0x60, 0x33, 0x43,
+    0x61, 0x28, 0xD8, 0x4C, 0xFB, 0xFC, 0xE9, 0x69, 0xCD, 0x7F, 0x42, 0xB9, 0x55, 0x6E, 0x94, 0xB1,
+    0x1F, 0xE5, 0x3B, 0xEC, 0xB8, 0x8D, 0x90, 0x3A, 0x2D, 0xA3, 0xE6, 0xE1, 0xE0, 0xEC, 0x56, 0xED,
+    0xC2, 0x5E, 0x11, 0xFA, 0xBA, 0xD0, 0x5F, 0x52, 0xE9, 0x0F, 0xD4, 0xF3, 0x28, 0x79, 0x97, 0x9C,
+    0x16, 0x9B, 0x5B, 0xCD, 0x46, 0x8D, 0x3C, 0x7A, 0x49, 0x1E, 0x97, 0xE4, 0xB1, 0x87, 0x2E, 0xC2,
+    0x5E, 0x7D, 0x37, 0x83, 0xFB, 0x91, 0x22, 0x36, 0xBB, 0x1D, 0x23, 0x23, 0x8F, 0x62, 0xD8, 0x70,
+    0xC9, 0x8A, 0xA1, 0x78, 0x25, 0xA7, 0x34, 0xE8, 0x49, 0xE5, 0x46, 0x11, 0xB8, 0xE2, 0xB9, 0x4A,
+    0x38, 0x7A, 0x6D, 0xA3, 0x16, 0x23, 0x6F, 0x0F, 0xDC, 0xC6, 0x47, 0x38, 0x6C, 0xB5, 0x4F, 0x3A,
+    0xA4, 0x95, 0x2F, 0x34, 0xB7, 0x39, 0xFB, 0x3A, 0xBD, 0x5E, 0xD1, 0x36, 0x28, 0x76, 0x7A, 0x57,
+    0x9A, 0x2A, 0x26, 0x27, 0x49, 0xBE, 0xD5, 0x36, 0xE9, 0xDB, 0x5A, 0x99, 0x92, 0xD1, 0x3C, 0x66,
+    0x86, 0x1D, 0xC5, 0x4E, 0x74, 0xA5, 0x3A, 0xEB, 0x8D, 0x66, 0x9B, 0x99, 0x12, 0xD3, 0x5A, 0x3D,
+    0xF6, 0x0F, 0x5D, 0x61, 0x90, 0x9F, 0xF6, 0x56, 0xF7, 0x46, 0xA5, 0x49, 0x77, 0x25, 0xAB, 0x3C,
+    0x6A, 0x95, 0x22, 0x5F, 0x68, 0xEE, 0xD0, 0xEA, 0x47, 0x2A, 0x4C, 0x0A, 0xAA, 0xE0, 0x6C, 0x6C,
+    0xB5, 0x4D, 0x99, 0x21, 0xA3, 0xA5, 0xD1, 0x6C, 0x0F, 0x86, 0x9D, 0xB0, 0x34, 0x9A, 0xFB, 0x0F,
+    0x71, 0x38, 0x1D, 0x8D, 0xF6, 0x51, 0xDB, 0xA4, 0xD7, 0xA5, 0xDF, 0x53, 0xE1, 0xEC, 0x8E, 0xA7,
+    0xAB, 0xE0, 0x59, 0x41, 0xD2, 0x36, 0xEC, 0x46, 0x77, 0x55, 0x63, 0x46, 0xFD, 0xB0, 0x60, 0x4B,
+    0x58, 0x09, 0x6F, 0x14, 0xFA, 0xA2, 0x95, 0xF0, 0xC3, 0x42, 0x7F, 0x84, 0x84, 0x5E, 0x91, 0x1F,
+    0xB2, 0x3B, 0x8C, 0xAE, 0x4B, 0x5A, 0x7B, 0x55, 0x70, 0x95, 0xBA, 0xB8, 0xFC, 0x51, 0x73, 0x9B,
+    0xF1, 0x70, 0x8A, 0x41, 0x52, 0x9A, 0x24, 0xED, 0x46, 0x4B, 0xC8, 0x46, 0x7E, 0xCC, 0x46, 0xD8,
+    0xE3, 0xA7, 0x15, 0x0F, 0x70, 0xD3, 0xCD, 0xC8, 0x87, 0x74, 0x02, 0x59, 0x6B, 0x0B, 0x77, 0x8C,
+    0x9E, 0xF3, 0xEF, 0xA7, 0xAB, 0x3C, 0x8C, 0xCA, 0xE0, 0x94, 0xE1, 0xEA, 0xF9, 0x4D, 0xE0, 0xEC,
+    0xCE, 0x0D, 0x5A, 0xE9, 0xC0, 0x49, 0xBB, 0x91, 0xB4, 0x8E, 0xB9, 0xD5, 0xAC, 0xD8, 0x97, 0x4E,
+    0x8C, 0xFB, 0xB8, 0x13, 0xD6, 0xB0, 0xB6, 0x7A, 0x56, 0xBE, 0x2F, 0xB6, 0xDC, 0xFF, 0x29, 0xB5,
+    0x7A, 0x46, 0x8B, 0x2D, 0x46, 0xFF, 0xA0, 0xBD, 0xBF, 0xF0, 0x7C, 0xE6, 0x5E, 0xDF, 0x29, 0xE0,
+    0xC7, 0x9D, 0x4A, 0x00, 0x55, 0x58, 0xBE, 0x9C, 0x7C, 0xA6, 0xBE, 0x86, 0x15, 0x1B, 0x9C, 0x9F,
+    0x7B, 0xFE, 0x73, 0xF3, 0xFC, 0x58, 0x6C, 0x9E, 0xE4, 0xB2, 0x93, 0x72, 0x2B, 0x6D, 0x8D, 0xD6,
+    0x4F, 0x37, 0x9A, 0xF9, 0x59, 0xFF, 0xBB, 0xCA, 0xA5, 0xE1, 0x54, 0xE0, 0xD1, 0xAF, 0xD3, 0x49,
+    0x3E, 0x48, 0xDD, 0xD1, 0xE5, 0x71, 0xED, 0x92, 0x66, 0xFB, 0xAC, 0x96, 0xCF, 0xF4, 0xDA, 0xB1,
+    0x2A, 0x0C, 0x15, 0xD7, 0xA3, 0x51, 0xFE, 0x1D, 0xA6, 0x9F, 0x64, 0xA6, 0xEF, 0x6C, 0x8D, 0x86,
+    0xE3, 0xE9, 0xDD, 0x49, 0x73, 0xD0, 0x56, 0x47, 0xE3, 0xCC, 0x83, 0xAA, 0x27, 0xEF, 0x12, 0x28,
+    0xF2, 0x74, 0xE5, 0x49, 0xAD, 0xB4, 0x37, 0x8A, 0x74, 0xAA, 0x4B, 0xF6, 0x54, 0x11, 0xAE, 0xF7,
+    0x9C, 0x1A, 0x81, 0xD5, 0x17, 0xBC, 0xD3, 0x41, 0xD0, 0x46, 0x90, 0xE7, 0xAA, 0x87, 0x2B, 0xD5,
+    0xC3, 0xBE, 0xA6, 0x39, 0xC8, 0x68, 0xEF, 0x94, 0x46, 0xCD, 0x46, 0x8C, 0x3B, 0x2E, 0xB5, 0x1F,
+    0xFE, 0x70, 0x6B, 0x35, 0x1B, 0xFD, 0x6D, 0xA8, 0x71, 0xF0, 0x3D, 0xA4, 0x37, 0xB4, 0x56, 0xB3,
+    0xD7, 0xDC, 0x6C, 0x4E, 0x0C, 0x42, 0x27, 0x7D, 0x55, 0x87, 0xD3, 0x36, 0x2A, 0x6A, 0x67, 0x5A,
+    0x8D, 0x66, 0x93, 0x19, 0x2B, 0x16, 0x13, 0xED, 0x46, 0x5F, 0x1A, 0xC1, 0x94, 0xC6, 0x05, 0x23,
+    0x93, 0x61, 0xD8, 0x26, 0x0F, 0xFA, 0x56, 0x82, 0xFE, 0x28, 0x17, 0x41, 0x4E, 0xAB, 0xFD, 0x7E,
+    0x88, 0xA3, 0x04, 0x74, 0xC7, 0x7B, 0x68, 0x2A, 0x23, 0x51, 0xD0, 0xE1, 0x94, 0x6C, 0x1A, 0x14,
+    0xB5, 0xB5, 0x62, 0x4C, 0x46, 0xB8, 0xAD, 0x3D, 0x70, 0xC9, 0x68, 0x76, 0xB1, 0xD1, 0x3C, 0x65,
+    0xB3, 0x63, 0xB3, 0x55, 0x9C, 0x3C, 0x21, 0xEA, 0xE8, 0x13, 0xDD, 0x31, 0x3C, 0xB5, 0x16, 0x70,
+    0xDF, 0x4B, 0x1A, 0x22, 0xAD, 0x9C, 0xFD, 0xA7, 0x0C, 0xC3, 0x5B, 0x6B, 0x08, 0x1E, 0x74, 0x18,
+    0x25, 0xE8, 0x15, 0x5D, 0xA1, 0x92, 0x12, 0x15, 0xEB, 0x18, 0x32, 0x30, 0x24, 0x34, 0x3F, 0xDC,
+    0x18, 0xAB, 0xEC, 0xF4, 0xAC, 0x8E, 0x4E, 0xCB, 0x50, 0x08, 0x73, 0xA3, 0x38, 0xCD, 0x0C, 0xD9,
+    0x45, 0x1A, 0x85, 0x08, 0x63, 0x15, 0x6A, 0xB9, 0x58, 0x7A, 0x5D, 0x25, 0x88, 0x57, 0x18, 0xBF,
+    0x53, 0x60, 0x5C, 0xC3, 0xCA, 0x98, 0xEC, 0xC1, 0xB8, 0xB5, 0xBA, 0x37, 0xE9, 0xAE, 0x74, 0x5A,
+    0x5D, 0x3E, 0x4C, 0xB7, 0xA6, 0x9F, 0xDA, 0xAD, 0x5F, 0xFB, 0xA0, 0x6E, 0xAD, 0x31, 0x56, 0x78,
+    0xD0, 0xAD, 0x2E, 0x52, 0x3D, 0x65, 0x5A, 0x01, 0x67, 0x8A, 0x27, 0x30, 0xB2, 0x66, 0x00, 0xB8,
+    0x0B, 0xA6, 0xF9, 0x7E, 0xCF, 0xEB, 0xFA, 0x69, 0xC5, 0xD8, 0x87, 0x38, 0xE6, 0x6E, 0x19, 0x32,
+    0xC9, 0x1E, 0x60, 0x4F, 0x94, 0x70, 0xAF, 0xFB, 0x6C, 0xEC, 0xE7, 0x8C, 0xE6, 0xD1, 0x28, 0xDA,
+    0x97, 0x15, 0xFB, 0x74, 0x8A, 0x1F, 0x4A, 0x57, 0xA1, 0x99, 0x6A, 0xF8, 0xB4, 0x0C, 0xBA, 0xAE,
+    0xBD, 0xCF, 0xB8, 0x05, 0x61, 0x6A, 0x76, 0xC9, 0x42, 0x98, 0x1B, 0x61, 0x72, 0xED, 0xF0, 0x21,
+    0xA3, 0xD8, 0x9E, 0x52, 0x4D, 0x4E, 0xBF, 0x4E, 0x73, 0x7B, 0xD4, 0x6C, 0x95, 0xFB, 0xB7, 0x0D,
+    0xEF, 0x78, 0x27, 0x3F, 0x1E, 0x5C, 0xB9, 0x81, 0xFB, 0xD6, 0x9B, 0x59, 0x3F, 0xA3, 0x88, 0x80,
+    0xDB, 0x71, 0xE2, 0xDF, 0x68, 0x66, 0x8A, 0xB8, 0x87, 0xBF, 0xD3, 0x4C, 0x98, 0x09, 0x9E, 0x50,
+    0xAF, 0xEE, 0xD8, 0xCC, 0x98, 0x99, 0x96, 0x4B, 0xBF, 0xBF, 0xEF, 0xC6, 0x29, 0x3E, 0xAA, 0xD9,
+    0x09, 0xB7, 0x9F, 0x28, 0x59, 0x90, 0xEF, 0xAF, 0x2B, 0x9B, 0x24, 0xFD, 0x20, 0x87, 0xFF, 0xA9,
+    0x32, 0xCC, 0x93, 0x9A, 0xD8, 0x96, 0x7A, 0xF5, 0x5F, 0x70, 0x46, 0xB7, 0x99, 0xBD, 0x55, 0x23,
+    0x42, 0x9C, 0x16, 0x97, 0xC6, 0xCD, 0x1E, 0x7D, 0x41, 0x73, 0x88, 0xF6, 0xE8, 0x0B, 0x2E, 0x8D,
+    0x1B, 0x8A, 0x61, 0x69, 0xD5, 0x88, 0x6E, 0xEB, 0x32, 0x8F, 0xF0, 0x08, 0xBF, 0xC1, 0x67, 0xE9,
+    0x36, 0xB3, 0xE3, 0xD6, 0x31, 0xA1, 0x39, 0x44, 0x73, 0x82, 0xF3, 0x32, 0x21, 0x4E, 0xCB, 0x90,
+    0x6D, 0x36, 0x6A, 0xE5, 0x35, 0x87, 0x38, 0xAE, 0x43, 0xA5, 0x73, 0x7F, 0x83, 0xCF, 0x5E, 0xA0,
+    0x96, 0x35, 0x55, 0xEB, 0x22, 0x07, 0x89, 0xB1, 0xB6, 0x28, 0xD4, 0x18, 0x65, 0x8A, 0x97, 0x98,
+    0x41, 0x7E, 0xD9, 0x69, 0x42, 0x68, 0xEB, 0x8C, 0xAA, 0x8D, 0x0F, 0xCB, 0x83, 0x50, 0x7F, 0x90,
+    0x07, 0xDA, 0xE2, 0x01, 0x3E, 0xC5, 0xAF, 0x88, 0x3C, 0xED, 0x5F, 0x73, 0x1F, 0x2B, 0x63, 0x94,
+    0x07, 0xFA, 0xB7, 0x0E, 0xA0, 0x3D, 0x6C, 0x02, 0x26, 0xEF, 0x80, 0x66, 0x66, 0xFE, 0xD5, 0x90,
+    0xE7, 0x46, 0xE3, 0x81, 0xE9, 0xA5, 0x8A, 0x0D, 0x8D, 0x1B, 0xA0, 0x97, 0xE5, 0xA1, 0xDB, 0x6D,
+    0x7A, 0x5F, 0x26, 0x42, 0xE3, 0xA1, 0x66, 0x4D, 0xDD, 0x87, 0x6F, 0xAD, 0x3C, 0xD0, 0x54, 0x24,
+    0xEE, 0x02, 0x0E, 0x3B, 0x00, 0xC2, 0x94, 0x00, 0xFB, 0xBA, 0x80, 0x26, 0x8F, 0x3B, 0xE0, 0x5E,
+    0x52, 0x84, 0x6E, 0xB3, 0x07, 0x10, 0x08, 0x2B, 0xD8, 0xB5, 0x13, 0xB4, 0xBA, 0x13, 0xB6, 0x0B,
+    0x78, 0xAF, 0xAB, 0xF2, 0xE8, 0xCE, 0x1D, 0x2D, 0x0C, 0x89, 0x5E, 0xB4, 0x47, 0xE5, 0xCD, 0x22,
+    0xE6, 0xE4, 0xDD, 0xEB, 0x2F, 0xAA, 0x08, 0xD5, 0x89, 0x8A, 0x9F, 0x2C, 0x27, 0xCC, 0x15, 0x80,
+    0x69, 0x05, 0xA6, 0x8D, 0x53, 0xC0, 0xD5, 0x25, 0xC0, 0xAE, 0x54, 0x08, 0x84, 0xDF, 0x02, 0x7E,
+    0x0D, 0xC0, 0xF9, 0x8B, 0xBA, 0xEE, 0xB8, 0xD0, 0x83, 0x26, 0xCC, 0x70, 0x91, 0x49, 0xF7, 0x89,
+    0x51, 0xBA, 0xC0, 0x1F, 0x02, 0x6D, 0x45, 0x3B, 0x81, 0xCA, 0xA7, 0xAD, 0x27, 0x74, 0xA5, 0xF1,
+    0x9F, 0x78, 0xFB, 0xFE, 0x2B, 0xD0, 0x68, 0x86, 0x4E, 0x09, 0xEC, 0x0F, 0xF7, 0x9A, 0x37, 0x4A,
+    0xE1, 0xCF, 0xE0, 0x73, 0x0F, 0xAD, 0x8A, 0x9F, 0x44, 0xFB, 0x3E, 0xC3, 0x0D, 0xD0, 0xE3, 0x85,
+    0x46, 0xCF, 0xAA, 0x16, 0xA8, 0x7D, 0xAF, 0xA3, 0xF4, 0x49, 0x34, 0xED, 0xD7, 0xC0, 0x79, 0x5C,
+    0xC2, 0x1D, 0x0C, 0x9A, 0x9B, 0x10, 0xEF, 0x0F, 0xE7, 0x2F, 0x84, 0x34, 0x86, 0x3F, 0xA4, 0xDD,
+    0x19, 0x32, 0x21, 0x1B, 0x25, 0x53, 0x1E, 0xCC, 0x96, 0x5F, 0xCC, 0xF3, 0xAF, 0xCD, 0x0C, 0x19,
+    0xAB, 0x68, 0xDF, 0xCA, 0x36, 0x4D, 0x5F, 0x4B, 0x5D, 0x7A, 0x9E, 0x93, 0x93, 0xDB, 0x4B, 0xAF,
+    0x4B, 0x5B, 0xD0, 0x7E, 0x4A, 0x15, 0xB2, 0xA5, 0xA2, 0xEA, 0x1F, 0xF6, 0xA4, 0x91, 0xBE, 0x2D,
+    0xED, 0xD2, 0x71, 0x85, 0x2B, 0xE6, 0xE8, 0x77, 0x97, 0x74, 0x57, 0x36, 0x8F, 0x4B, 0xB8, 0x34,
+    0xE7, 0x47, 0xE9, 0x59, 0x69, 0x1B, 0x55, 0xB0, 0x05, 0xB4, 0xFE, 0x5C, 0x7F, 0x3A, 0xE9, 0x31,
+    0x69, 0x77, 0x0F, 0xDC, 0x2D, 0x9A, 0x62, 0x66, 0xC0, 0x6A, 0xF0, 0x40, 0xD0, 0x01, 0xB4, 0x3F,
+    0x51, 0x02, 0x4C, 0x7C, 0x7F, 0x3E, 0xD8, 0xC9, 0x7D, 0x11, 0x8D, 0xF4, 0x5A, 0x0D, 0x65, 0x9E,
+    0xD0, 0xC1, 0xA0, 0xAD, 0x51, 0xAE, 0xC4, 0x6B, 0xAE, 0xC4, 0xEB, 0x5E, 0x89, 0xD7, 0x54, 0x39,
+    0xD9, 0xD4, 0x16, 0x4C, 0xD1, 0xDA, 0xEF, 0xD8, 0x37, 0xB5, 0x8C, 0x2B, 0xEE, 0xAE, 0x62, 0x98,
+    0x51, 0xAF, 0xAF, 0x16, 0x4C, 0xB6, 0x7A, 0x62, 0xC7, 0x26, 0xAB, 0x71, 0xC5, 0xC5, 0x41, 0x61,
+    0xA6, 0x86, 0x54, 0x26, 0xE3, 0x2A, 0xF1, 0x3A, 0x55, 0xE2, 0x35, 0x68, 0x46, 0xA0, 0xC2, 0xA8,
+    0xA5, 0xD1, 0x6E, 0xA4, 0xD8, 0x6A, 0xB5, 0x35, 0x11, 0x06, 0xA0, 0xF5, 0x50, 0x8D, 0xA0, 0xD9,
+    0xB8, 0x8F, 0x6A, 0x98, 0xCA, 0xE8, 0x55, 0x6B, 0x71, 0x2D, 0xBF, 0xD7, 0x95, 0xF9, 0xE5, 0xE4,
+    0x6B, 0x39, 0xAB, 0xC3, 0x3F, 0x73, 0x42, 0xE7, 0xE8, 0x4F, 0x34, 0x05, 0xD4, 0xBC, 0xC7, 0x87,
+    0xFD, 0xB1, 0x5F, 0x4E, 0x29, 0xCE, 0xD6, 0x07, 0xE9, 0x30, 0xB5, 0xE5, 0x9A, 0x22, 0x98, 0x3C,
+    0xAC, 0x17, 0xD9, 0xF0, 0xED, 0x7C, 0x69, 0x89, 0xFF, 0xA5, 0x94, 0xA2, 0xF1, 0x8D, 0x07, 0xBB,
+    0x8D, 0x2B, 0x0C, 0xB9, 0xA6, 0xD3, 0xBA, 0x04, 0xFD, 0x36, 0xBE, 0x77, 0x23, 0xC3, 0x2F, 0xE7,
+    0x28, 0xD4, 0xBC, 0xC6, 0x6E, 0xBD, 0xE4, 0x0E, 0xD7, 0xC9, 0xC4, 0x58, 0x15, 0x7D, 0xAC, 0x5E,
+    0xD7, 0x95, 0xF7, 0x48, 0xD3, 0xD5, 0xE4, 0xE6, 0x49, 0xA5, 0x95, 0xDE, 0x94, 0xE6, 0x41, 0x7B,
+    0xFB, 0x71, 0xB0, 0xAE, 0xF5, 0x04, 0x2D, 0x0C, 0x3B, 0xB6, 0xAA, 0x73, 0x28, 0xFF, 0x41, 0xE9,
+    0xC2, 0xCD, 0xB4, 0x17, 0x1C, 0xBE, 0xE6, 0x13, 0x1D, 0x02, 0x17, 0xAA, 0xCE, 0x54, 0x65, 0xB8,
+    0x44, 0x87, 0x76, 0xD5, 0x55, 0x0E, 0xB7, 0x78, 0xAF, 0x83, 0xF3, 0xAB, 0x20, 0xD6, 0xFF, 0xE6,
+    0x01, 0x3F, 0xDE, 0x57, 0xBA, 0xF2, 0x90, 0x07, 0xC2, 0xE3, 0x19, 0x18, 0x16, 0x1B, 0x81, 0x3F,
+    0xE4, 0x5F, 0xFF, 0x4A, 0x89, 0xF5, 0x19, 0x6E, 0x00, 0xC3, 0x89, 0xDC, 0xEE, 0x0F, 0xC0, 0xA5,
+    0xB0, 0x40, 0x53, 0x4C, 0xFE, 0x40, 0x63, 0xF3, 0xCB, 0x4C, 0xFD, 0xF3, 0xE9, 0xBA, 0xC3, 0xA5,
+    0xEE, 0x14, 0x19, 0xD3, 0x89, 0x07, 0x6C, 0xCB, 0x85, 0x0F, 0xFE, 0x2F, 0x2F, 0x4B, 0xF2, 0xF1,
+    0xF0, 0x77, 0x7C, 0x9A, 0xBA, 0xB9, 0x0A, 0x01, 0xC3, 0x5A, 0xC9, 0x52, 0x82, 0x07, 0xBB, 0x00,
+    0xFF, 0xEE, 0xE3, 0x6F, 0x42, 0xFB, 0xFC, 0x49, 0xF0, 0xF1, 0x80, 0xEE, 0xDD, 0x04, 0x87, 0x8B,
+    0x8C, 0xF3, 0x81, 0x49, 0x5D, 0xBC, 0xF4, 0xFA, 0x2F, 0xDF, 0xA2, 0x91, 0x22, 0x41, 0x62, 0x2C,
+    0x61, 0x33, 0xA5, 0xD1, 0xEC, 0x16, 0xBB, 0xF3, 0x5F, 0xD0, 0x0C, 0x76, 0xA7, 0x79, 0x51, 0x73,
+    0x2B, 0xED, 0x8D, 0xA4, 0xD9, 0xED, 0x76, 0xEF, 0x0A, 0x9A, 0xC3, 0x62, 0xF7, 0xBE, 0xB4, 0x8A,
+    0x53, 0x4D, 0x43, 0x99, 0x0E, 0xAB, 0x67, 0xE5, 0xAF, 0xF8, 0xD3, 0x8E, 0xB6, 0xE9, 0xFA, 0x51,
+    0x97, 0x63, 0xDD, 0x55, 0x5D, 0x91, 0x3F, 0xF5, 0xD0, 0x96, 0xAC, 0x8F, 0x49, 0xEE, 0x5F, 0x10,
+    0x59, 0x79, 0xB3, 0xD2, 0x2F, 0x6E, 0xAF, 0x41, 0x9B, 0xF3, 0xB4, 0xB9, 0x02, 0x71, 0x5F, 0x3F,
+    0x8D, 0xEF, 0x9F, 0x02, 0xE5, 0x82, 0xFA, 0x5E, 0x2A, 0x9B, 0x6D, 0x36, 0xE0, 0xBF, 0x3D, 0x2C,
+    0xE3, 0x2F, 0x8C, 0x6B, 0xFC, 0x14, 0xF0, 0x79, 0x60, 0xF2, 0x0F, 0x76, 0x2B, 0xE5, 0x6A, 0x3D,
+    0xDA, 0xF9, 0xE3, 0x79, 0x67, 0xF3, 0xD7, 0xA7, 0x0D, 0x53, 0x02, 0x17, 0x66, 0xA6, 0x61, 0x21,
+    0x77, 0xA9, 0xDD, 0xDA, 0xF5, 0xE3, 0x91, 0x11, 0xDA, 0xDC, 0xA7, 0xEE, 0x18, 0xB6, 0xEE, 0x18,
+    0x37, 0x93, 0x6D, 0xC2, 0x37, 0x1F, 0x8B, 0x6C, 0x0D, 0x58, 0xCF, 0x18, 0x19, 0x13, 0x36, 0xD3,
+    0x16, 0x98, 0x2E, 0x2D, 0x0E, 0x3F, 0x27, 0x77, 0x08, 0xDD, 0xF2, 0x60, 0x7F, 0x5C, 0xF0, 0x1C,
+    0x97, 0xB4, 0xFD, 0xE7, 0x7B, 0xE6, 0xA3, 0xD4, 0x7C, 0xA0, 0xEE, 0xDD, 0x64, 0x5F, 0xCB, 0xE3,
+    0x7C, 0x38, 0xFE, 0xFD, 0xFF, 0xD7, 0x03, 0x61, 0xBA, 0x7E, 0xE8, 0xAE, 0x74, 0x57, 0xE1, 0xB1,
+    0xE3, 0x81, 0x52, 0xFE, 0x9C, 0x22, 0xEF, 0x67, 0x40, 0x48, 0xD5, 0xBA, 0x44, 0xC8, 0x61, 0x87,
+    0xFE, 0xB1, 0xF2, 0x01, 0x16, 0xFE, 0x9F, 0x81, 0x89, 0xFB, 0x14, 0xD4, 0x0D, 0x27, 0xE1, 0x22,
+    0xEB, 0xCA, 0x5D, 0x60, 0x2E, 0x4D, 0x06, 0xCC, 0x65, 0xD4, 0xE2, 0xE3, 0xA1, 0xED, 0xF8, 0x14,
+    0xA7, 0x6D, 0xB5, 0x2E, 0x42, 0xB7, 0x9F, 0xCC, 0xC0, 0xB8, 0x9C, 0xD6, 0x87, 0x87, 0x0D, 0xD0,
+    0xC7, 0xD3, 0x84, 0x6F, 0x9C, 0x04, 0xEF, 0xE5, 0x69, 0x4A, 0x06, 0xF7, 0x64, 0xA2, 0x5F, 0x9D,
+    0x27, 0x37, 0x97, 0x81, 0xBC, 0x2F, 0x7F, 0xBD, 0x32, 0x6E, 0xEE, 0xC4, 0xD0, 0x5D, 0xD7, 0xEC,
+    0xB2, 0x4B, 0x8D, 0xBE, 0xA3, 0xFA, 0x66, 0xFD, 0xF0, 0xE2, 0xCD, 0x6F, 0x14, 0xFA, 0x12, 0x56,
+    0xC2, 0xDF, 0x09, 0x9B, 0xA7, 0xAD, 0xD1, 0x5D, 0x2D, 0x6E, 0x1B, 0xA4, 0x42, 0x90, 0xE6, 0x46,
+    0x9A, 0x39, 0x25, 0x7A, 0xC0, 0xB0, 0x4C, 0xDE, 0xC8, 0x66, 0x5C, 0x52, 0x6C, 0x8F, 0x7E, 0xA3,
+    0x79, 0x08, 0xD6, 0xFD, 0x98, 0xE4, 0xF6, 0x40, 0x55, 0x8F, 0x8A, 0x57, 0x6A, 0xBE, 0x4F, 0xA2,
+    0xD8, 0xED, 0x7E, 0xD8, 0x76, 0x79, 0x89, 0xBE, 0x70, 0xAF, 0xFF, 0x99, 0x38, 0xB8, 0x8A, 0xE1,
+    0x03, 0x98, 0x9D, 0x93, 0xF5, 0x60, 0x48, 0xA7, 0xCD, 0xA9, 0xE0, 0x00, 0x9A, 0xF8, 0x49, 0xB5,
+    0xEF, 0x9A, 0xBF, 0xDF, 0x5F, 0x4A, 0x9C, 0x78, 0xB1, 0x2E, 0x15, 0xE0, 0xE8, 0x12, 0x0C, 0xF3,
+    0xF8, 0x70, 0xD3, 0x6E, 0x00, 0xA3, 0x9A, 0xB0, 0xF7, 0x4A, 0x4E, 0xF3, 0xA4, 0x56, 0x1F, 0xB1,
+    0x51, 0xF5, 0xD0, 0x8F, 0x3B, 0xEE, 0xF8, 0x62, 0xDD, 0xED, 0x57, 0xBC, 0x55, 0x51, 0xC1, 0xE9,
+    0x09, 0x2D, 0x5C, 0xF5, 0x57, 0x4F, 0x2F, 0x6B, 0x73, 0x9F, 0xC0, 0xFD, 0xBD, 0x66, 0x4C, 0x19,
+    0x76, 0x70, 0x51, 0xC0, 0xA7, 0xF1, 0x9F, 0x50, 0x77, 0x3D, 0x2D, 0x49, 0x89, 0x51, 0x92, 0x14,
+    0xBB, 0x9A, 0xE5, 0xC0, 0x54, 0xAE, 0xEB, 0xFB, 0x2F, 0xE4, 0x4E, 0xB3, 0x91, 0x37, 0xC9, 0xED,
+    0xD8, 0x03, 0xFB, 0x92, 0x22, 0x6E, 0xE3, 0x37, 0xED, 0x51, 0x09, 0x83, 0xBA, 0x8D, 0x81, 0x46,
+    0x11, 0x5B, 0xB8, 0xD9, 0x15, 0x70, 0x52, 0x1A, 0x77, 0x90, 0x14, 0xC3, 0x8A, 0x91, 0x4A, 0x5B,
+    0x2F, 0xD3, 0xE9, 0xB4, 0x17, 0x34, 0x9F, 0xEE, 0xDE, 0x2B, 0xCE, 0x17, 0x36, 0xEC, 0x41, 0x97,
+    0xB4, 0xE1, 0x36, 0xDC, 0x4B, 0x3A, 0xD0, 0xF7, 0x7F, 0x5F, 0x4D, 0x6D, 0xCA, 0x7E, 0xCA, 0xBC,
+    0x58, 0x4E, 0x4D, 0xE4, 0x42, 0x41, 0xCF, 0x6E, 0x73, 0x76, 0x1B, 0x26, 0xAD, 0x93, 0x96, 0x56,
+    0x7A, 0xE7, 0x94, 0x81, 0x5E, 0x5E, 0xCC, 0xC3, 0x6E, 0x94, 0xFA, 0xE2, 0x52, 0xA3, 0xD5, 0x94,
+    0x29, 0xA1, 0xC5, 0x28, 0xAC, 0xE8, 0xFB, 0x7F, 0xA0, 0xB0, 0xD6, 0xFD, 0x4D, 0x2B, 0x41, 0x2A,
+    0x5A, 0x09, 0x7F, 0x7B, 0x7E, 0x33, 0xAC, 0x84, 0x05, 0x42, 0x42, 0x2B, 0x4C, 0x5B, 0xA3, 0x0D,
+    0xDC, 0x61, 0x54, 0xFE, 0xE3, 0x9F, 0x0C, 0x92, 0xAA, 0xE1, 0x7D, 0xB3, 0xDA, 0xDE, 0x39, 0x68,
+    0xE5, 0xCA, 0x0D, 0x9A, 0xF3, 0x53, 0x32, 0x6C, 0xCD, 0xAF, 0x7B, 0x57, 0xA7, 0xDD, 0x3D, 0x97,
+    0xD2, 0x64, 0x7F, 0xCA, 0xE7, 0x41, 0x15, 0x6F, 0xE3, 0xD1, 0x27, 0xF7, 0xCC, 0xD1, 0x6F, 0x6E,
+    0x0D, 0x2F, 0xE9, 0xFA, 0x0A, 0x7E, 0x7C, 0x49, 0xCF, 0xAA, 0xCB, 0xC3, 0x3A, 0x3D, 0x96, 0xED,
+    0xF2, 0xCD, 0xE6, 0x79, 0xF0, 0x57, 0xC8, 0xFD, 0x72, 0x74, 0x29, 0x98, 0xDD, 0x3D, 0x93, 0x87,
+    0x45, 0xFD, 0xE6, 0xEE, 0x16, 0xBB, 0x85, 0xBB, 0x1A, 0xB6, 0xF0, 0xD2, 0xDA, 0xCF, 0xF8, 0x2B,
+    0x84, 0x6E, 0x1F, 0x76, 0x45, 0xDD, 0x3D, 0xBA, 0xEC, 0x96, 0xE9, 0xAB, 0xB9, 0xDB, 0x5C, 0x0C,
+    0x66, 0xB3, 0x4B, 0x68, 0x77, 0x1B, 0x1F, 0xE5, 0xEB, 0x3C, 0x32, 0xF3, 0xDB, 0xF0, 0x0D, 0x9B,
+    0x71, 0xA7, 0xA5, 0xE8, 0x60, 0xFA, 0x89, 0x96, 0x4E, 0x7E, 0x38, 0x5C, 0x42, 0xD1, 0xA8, 0xB9,
+    0xC5, 0x99, 0xE7, 0xB3, 0xFC, 0x3F, 0xC5, 0x9A, 0x3D, 0xB3, 0x27, 0xC7, 0x55, 0xC6, 0x9F, 0x99,
+    0x66, 0x77, 0x0A, 0x26, 0x98, 0xC4, 0x72, 0x61, 0x6F, 0xD0, 0x09, 0x01, 0x04, 0xD4, 0x7C, 0x84,
+    0xEE, 0xB5, 0x02, 0x02, 0x07, 0x6C, 0xB0, 0x5B, 0xAE, 0xC2, 0x81, 0x08, 0x08, 0x78, 0x29, 0x4A,
+    0xDF, 0x80, 0x99, 0xC5, 0x45, 0x11, 0x10, 0x58, 0x81, 0x5D, 0x54, 0x41, 0xA2, 0x00, 0x05, 0x2B,
+    0x05, 0x4E, 0x89, 0xDC, 0x2D, 0x29, 0x20, 0x20, 0xD0, 0xA8, 0x04, 0x28, 0x50, 0xC0, 0x14, 0x2C,
+    0x98, 0x92, 0x83, 0x6D, 0xEC, 0x06, 0xCD, 0xAE, 0xBA, 0xFB, 0x47, 0x30, 0xFF, 0xFF, 0xDD, 0x5D,
+    0x63, 0xF3, 0x56, 0x18, 0xA6, 0xEE, 0x3D, 0xDD, 0xD3, 0x3D, 0xB7, 0xDF, 0x4E, 0xF7, 0x39, 0xCF,
+    0x73, 0xFA, 0xEA, 0x0B, 0xBA, 0x27, 0xF1, 0x6A, 0x53, 0xC7, 0x37, 0x38, 0x85, 0xE8, 0xAB, 0x7E,
+    0xE4, 0x09, 0xC0, 0x01, 0x70, 0x04, 0xA0, 0x18, 0xBE, 0xFD, 0x4E, 0x31, 0xF8, 0xBE, 0x18, 0x7C,
+    0x77, 0x18, 0xBC, 0x92, 0xC1, 0x4B, 0x17, 0xB1, 0xBE, 0x22, 0x03, 0xF8, 0x1B, 0x21, 0xC3, 0x7A,
+    0x53, 0x7B, 0x11, 0x87, 0xC1, 0xEB, 0xDA, 0xCA, 0xB7, 0xBF, 0x5E, 0x2C, 0x50, 0x6E, 0x3A, 0xCA,
+    0x92, 0xBE, 0x20, 0x49, 0x9A, 0x77, 0x49, 0x1A, 0x90, 0x24, 0x91, 0x25, 0xC9, 0xB2, 0x4A, 0x32,
+    0x14, 0x49, 0x72, 0x6C, 0x92, 0xC6, 0xCF, 0x90, 0xA4, 0xE6, 0x92, 0x24, 0xFB, 0x1E, 0xAB, 0x64,
+    0x8A, 0x2D, 0x92, 0x16, 0xCF, 0x26, 0x8D, 0x69, 0x6C, 0x92, 0x9A, 0x96, 0x24, 0xCD, 0xCF, 0xDE,
+    0xC1, 0xCB, 0x00, 0x45, 0x5A, 0x80, 0xA8, 0xE9, 0xD9, 0xDB, 0xDF, 0xA9, 0xEA, 0x90, 0x42, 0xD2,
+    0xBC, 0x69, 0x40, 0xA6, 0x48, 0xEE, 0xE8, 0x39, 0x64, 0x39, 0x02, 0xFB, 0x08, 0x1F, 0xD0, 0x14,
+    0xCE, 0x51, 0x66, 0x80, 0x1C, 0x80, 0x64, 0xF8, 0xF4, 0x3B, 0xC9, 0xE0, 0xC7, 0x64, 0xF0, 0x43,
+    0x32, 0x78, 0xB3, 0x1B, 0x7C, 0xBF, 0x5E, 0xE6, 0xFA, 0xA9, 0x97, 0x81, 0x26, 0x03, 0x6C, 0x86,
+    0xEF, 0x93, 0x0D, 0xDE, 0x15, 0x83, 0x9F, 0xAA, 0xC1, 0x8F, 0x37, 0x62, 0x2A, 0x06, 0x6F, 0x8B,
+    0xE1, 0x61, 0xC8, 0x16, 0xD8, 0x03, 0xE0, 0x81, 0xC7, 0x17, 0x3D, 0x74, 0xF7, 0xA5, 0xD7, 0x21,
+    0x0B, 0x40, 0x01, 0x88, 0x86, 0x8E, 0xCD, 0x20, 0x97, 0x5E, 0x16, 0xBB, 0x41, 0x4B, 0x34, 0xBC,
+    0x75, 0xA3, 0x01, 0xD8, 0x0C, 0xEF, 0x90, 0x0D, 0x72, 0xC5, 0xA0, 0xE9, 0xC7, 0x88, 0xB9, 0x18,
+    0xEE, 0x92, 0xE7, 0x1F, 0xD3, 0x79, 0x00, 0x3E, 0x03, 0xF8, 0x04, 0x40, 0x3C, 0x7B, 0xA7, 0x18,
+    0xFC, 0x94, 0xA6, 0xAA, 0x39, 0xBA, 0xAC, 0x20, 0xB6, 0x2E, 0x1B, 0x7C, 0xA7, 0xA9, 0x4A, 0x72,
+    0x59, 0x12, 0xDB, 0x45, 0xE3, 0xFF, 0x71, 0xD1, 0x2E, 0x59, 0xAA, 0x7A, 0x28, 0x9A, 0x60, 0x97,
+    0xE4, 0x00, 0x56, 0x73, 0xEE, 0x05, 0x07, 0x34, 0x69, 0xCA, 0xB6, 0x49, 0x42, 0x61, 0x97, 0xA6,
+    0xAB, 0x46, 0xC3, 0x2E, 0x4D, 0xFB, 0x0B, 0x2F, 0x76, 0x1B, 0x9B, 0xD4, 0x55, 0x85, 0x5D, 0x9A,
+    0xE3, 0xD8, 0x24, 0x53, 0x14, 0x76, 0xC9, 0xAD, 0x63, 0x93, 0x86, 0xAC, 0xB0, 0x4B, 0x41, 0x63,
+    0x93, 0xA6, 0xA4, 0xB0, 0xAB, 0x6F, 0x1A, 0x9B, 0xE4, 0xA2, 0xC2, 0xAE, 0xA9, 0x68, 0x6A, 0x9A,
+    0x01, 0xF8, 0x43, 0x00, 0xEA, 0x02, 0xC0, 0xC7, 0x55, 0xD2, 0x50, 0xDD, 0x26, 0x69, 0x79, 0xBF,
+    0x48, 0x32, 0x65, 0x8E, 0x92, 0xDC, 0xEF, 0x1F, 0x92, 0xFA, 0xC3, 0x7A, 0x49, 0xD6, 0xBF, 0x29,
+    0x49, 0x6F, 0xFE, 0x7F, 0x1C, 0x9A, 0x7B, 0xE7, 0x36, 0x91, 0x58, 0x47, 0x58, 0xA7, 0xAC, 0xE5,
+    0x30, 0xB0, 0x4F, 0x68, 0xC6, 0x07, 0xB6, 0x91, 0x38, 0x90, 0x3A, 0xA2, 0x21, 0xE9, 0xE3, 0x2A,
+    0x97, 0x4C, 0xFB, 0x4D, 0xC9, 0xC5, 0xA9, 0x74, 0x48, 0x1A, 0xB3, 0x41, 0x48, 0x12, 0x22, 0x2E,
+    0x5E, 0x92, 0xDD, 0x5D, 0x72, 0x51, 0x52, 0x5F, 0x5F, 0xAB, 0xAF, 0x6F, 0xD2, 0x79, 0x66, 0x92,
+    0x2E, 0x5A, 0x6A, 0x92, 0x34, 0xB7, 0xF0, 0x8C, 0x28, 0xC9, 0x96, 0xE9, 0x3C, 0x77, 0x53, 0x33,
+    0x18, 0xBC, 0x34, 0x22, 0xE2, 0x92, 0xA4, 0x81, 0xD5, 0xA5, 0x09, 0xC9, 0x10, 0xA7, 0xD2, 0xB1,
+    0xCB, 0x9C, 0x5B, 0xB7, 0xAA, 0x27, 0x89, 0x38, 0x10, 0x7B, 0x52, 0x0F, 0x3E, 0x94, 0x9E, 0x7C,
+    0x0E, 0xFC, 0x43, 0xB2, 0x20, 0x8B, 0x72, 0xFB, 0x0D, 0x49, 0xD2, 0xED, 0x6F, 0x49, 0xDD, 0x6F,
+    0x49, 0x3D, 0x6C, 0x0A, 0x90, 0x06, 0x60, 0xB7, 0xB9, 0x27, 0x2E, 0xDE, 0x70, 0xB7, 0x68, 0xAA,
+    0x66, 0x97, 0x4B, 0x9D, 0x17, 0x51, 0x1A, 0xAB, 0xA4, 0x65, 0xD7, 0x08, 0x92, 0xA5, 0x49, 0x0E,
+    0x24, 0xBD, 0xDE, 0x24, 0xCD, 0x45, 0x92, 0xCB, 0xBF, 0x2C, 0xF1, 0xD1, 0x21, 0xC3, 0x9C, 0x35,
+    0x97, 0x90, 0x3B, 0x3E, 0xA4, 0x85, 0xD6, 0x03, 0x7B, 0x07, 0x87, 0xF4, 0xC5, 0xB7, 0xA4, 0x40,
+    0x35, 0x00, 0xC4, 0x05, 0x02, 0xB9, 0x87, 0xD5, 0x65, 0x75, 0x44, 0x83, 0x97, 0x2D, 0x72, 0x59,
+    0xE6, 0x7C, 0xA1, 0xC8, 0x65, 0x39, 0xA2, 0xC1, 0x4F, 0x14, 0xB9, 0x6C, 0x1A, 0xD1, 0xE0, 0x79,
+    0xAD, 0xC8, 0x65, 0xF7, 0x21, 0xD1, 0xF0, 0xAB, 0xD9, 0x16, 0xB9, 0xCF, 0x6B, 0x47, 0x34, 0xE0,
+    0x6D, 0x91, 0x63, 0xEB, 0x88, 0x86, 0x2C, 0x5B, 0xE4, 0xEA, 0xCB, 0x4D, 0x77, 0x44, 0xCB, 0xA1,
+    0xC0, 0x27, 0xB0, 0x39, 0x80, 0x32, 0x40, 0x92, 0xEE, 0xE9, 0x9E, 0xA4, 0x79, 0x9D, 0x57, 0xC9,
+    0x14, 0x53, 0x24, 0xCD, 0x7B, 0x88, 0x92, 0x4E, 0x43, 0xDA, 0x73, 0xE8, 0xC7, 0x3D, 0xE3, 0x8B,
+    0xED, 0x7C, 0x0E, 0x7E, 0xE6, 0x78, 0xA9, 0x3B, 0x83, 0x97, 0x2B, 0x72, 0x59, 0x13, 0xD1, 0xE0,
+    0xCD, 0x39, 0x2D, 0x88, 0x06, 0xEF, 0x9E, 0x14, 0xB9, 0x3C, 0xFD, 0x0B, 0xD1, 0xF0, 0x6A, 0xB5,
+    0x45, 0x2E, 0x73, 0x97, 0x68, 0x08, 0x9B, 0x2D, 0x72, 0xE4, 0x8E, 0x68, 0xA8, 0xB2, 0x45, 0x0E,
+    0xDF, 0x11, 0x0D, 0xDB, 0xCB, 0x4D, 0xDB, 0xD2, 0xC1, 0x3A, 0x52, 0x5F, 0x5A, 0x58, 0x49, 0xBA,
+    0xA5, 0x40, 0xD5, 0x12, 0xA1, 0x74, 0xEC, 0x81, 0xC7, 0x86, 0xDD, 0xE0, 0x47, 0x76, 0x83, 0x9F,
+    0x9E, 0xBE, 0x61, 0xF0, 0xF3, 0x26, 0x83, 0x5F, 0x56, 0x19, 0x3C, 0x92, 0xE1, 0x6E, 0x95, 0x0C,
+    0x7F, 0x5C, 0x24, 0x03, 0x87, 0x64, 0xA0, 0x48, 0x86, 0x77, 0x9A, 0x64, 0x78, 0x15, 0x2F, 0xC3,
+    0x5D, 0xA2, 0x0C, 0x9E, 0x5D, 0x06, 0xBF, 0x64, 0x19, 0xBC, 0x2B, 0x32, 0x78, 0x8B, 0x0C, 0x7E,
+    0x64, 0xB5, 0x1C, 0x86, 0x3D, 0x50, 0x3A, 0x0E, 0x28, 0x5A, 0x9A, 0x24, 0xDD, 0x7E, 0xE3, 0x34,
+    0x48, 0xDE, 0x72, 0xDA, 0x51, 0x60, 0x93, 0xA9, 0x5F, 0xC3, 0x4B, 0x4D, 0x6C, 0x92, 0x5B, 0x5D,
+    0x96, 0xA6, 0x7D, 0xAA, 0x92, 0x39, 0x0C, 0x5E, 0x5D, 0x15, 0x9B, 0xB4, 0x78, 0x97, 0x25, 0x1B,
+    0xA7, 0x2A, 0x8D, 0xC9, 0xE0, 0x65, 0x8A, 0xD8, 0xA4, 0x26, 0x97, 0xA5, 0xC5, 0x4F, 0x55, 0x9A,
+    0x37, 0x83, 0xD7, 0x94, 0xC4, 0xA6, 0xE1, 0x90, 0xCB, 0xE6, 0x1B, 0x45, 0x53, 0x15, 0xC8, 0xE0,
+    0x17, 0x74, 0x87, 0x66, 0xF1, 0x13, 0x7C, 0x84, 0x1F, 0x20, 0x7F, 0x49, 0x92, 0x64, 0x40, 0x82,
+    0x75, 0xA2, 0x68, 0x00, 0x59, 0x0E, 0xCD, 0x64, 0x4D, 0x24, 0x9D, 0x3B, 0x3D, 0x0E, 0x1C, 0x12,
+    0xF8, 0x99, 0x5D, 0xE6, 0xB3, 0xA6, 0x4A, 0xD4, 0xF4, 0x49, 0x31, 0x3F, 0x44, 0x5A, 0x5E, 0x4B,
+    0xF3, 0x07, 0x45, 0x5D, 0x71, 0x5B, 0x9B, 0x93, 0xC6, 0xC4, 0xFB, 0x29, 0x44, 0xCD, 0xEF, 0x62,
+    0xDF, 0xC3, 0x0B, 0x53, 0xBF, 0x3B, 0x54, 0x99, 0x32, 0x7D, 0x9E, 0x6C, 0xD6, 0x94, 0x2C, 0x71,
+    0xD9, 0xE5, 0xA2, 0x6B, 0x62, 0x55, 0x13, 0xC9, 0x34, 0x0D, 0x47, 0x47, 0x9C, 0x8A, 0xEC, 0x6E,
+    0x9A, 0x5C, 0x52, 0xF0, 0x63, 0x16, 0x71, 0xE4, 0x4D, 0x1B, 0x2D, 0x19, 0x36, 0x75, 0xF0, 0x3D,
+    0x90, 0x06, 0xF0, 0xA7, 0xAE, 0x7F, 0x08, 0x79, 0x82, 0xBF, 0x04, 0x3F, 0x53, 0xC5, 0xAE, 0x01,
+    0x6F, 0xF0, 0x9A, 0x8A, 0xA6, 0x2A, 0xB9, 0x24, 0x97, 0x25, 0xA2, 0xD8, 0x64, 0xD0, 0xB5, 0xAA,
+    0x49, 0x4B, 0x3A, 0x75, 0x11, 0x05, 0x57, 0xCF, 0xC6, 0x59, 0xF5, 0x93, 0xFE, 0xEA, 0xE5, 0x06,
+    0xF7, 0x53, 0xE1, 0x87, 0x02, 0x7F, 0x77, 0x0E, 0xE3, 0x83, 0xF3, 0x20, 0x48, 0xBA, 0xF5, 0x2D,
+    0x49, 0x3D, 0xEC, 0xD2, 0x0C, 0xF5, 0x74, 0x7B, 0x6B, 0xCF, 0x63, 0xCB, 0x36, 0xA0, 0x9E, 0x34,
+    0x55, 0x89, 0x3C, 0x1F, 0x92, 0x2B, 0x2E, 0x4B, 0xAE, 0xB8, 0x24, 0xCD, 0x75, 0x49, 0x92, 0xBD,
+    0xC8, 0x90, 0xA4, 0xE9, 0x05, 0x69, 0xCB, 0x92, 0x25, 0x5B, 0x96, 0x43, 0x9A, 0x0F, 0x57, 0x24,
+    0x97, 0xE7, 0x26, 0x2D, 0x69, 0xC2, 0x77, 0x6C, 0x23, 0x8F, 0xEF, 0x9C, 0xCE, 0xAE, 0x49, 0x01,
+    0xB2, 0x64, 0x61, 0x95, 0xF4, 0x6B, 0xF7, 0xCE, 0x21, 0xC0, 0xDF, 0x9E, 0x9E, 0xE8, 0x7C, 0xF1,
+    0xEE, 0xE9, 0x83, 0xAF, 0xB1, 0x1A, 0xBC, 0x5C, 0x3E, 0xCD, 0x8E, 0xFF, 0xE9, 0xBC, 0x1C, 0x32,
+    0xAC, 0x96, 0xA3, 0x87, 0x3F, 0x82, 0x2D, 0x50, 0xA1, 0x4E, 0xB0, 0x49, 0x0F, 0xD4, 0x85, 0x73,
+    0xFD, 0x28, 0xF3, 0xE9, 0xE2, 0xBE, 0x42, 0x9E, 0xAA, 0xD8, 0x5D, 0xEE, 0x89, 0x6C, 0x03, 0x06,
+    0x6F, 0xCB, 0x54, 0x15, 0x76, 0x97, 0x0D, 0x9E, 0xCD, 0x15, 0xC3, 0x77, 0x88, 0x13, 0x14, 0x39,
+    0xF0, 0xE2, 0x99, 0xFF, 0x89, 0x10, 0x61, 0x21, 0x6B, 0x84, 0x5D, 0xEE, 0x5C, 0x8D, 0x5B, 0x6F,
+    0x49, 0x3D, 0x3C, 0xD6, 0x0C, 0x45, 0x67, 0x97, 0x8F, 0xEF, 0x94, 0x11, 0x99, 0x32, 0x15, 0x99,
+    0x63, 0x3E, 0xD4, 0x67, 0x97, 0x25, 0xEF, 0x92, 0xA4, 0xE5, 0x46, 0x84, 0x1F, 0x11, 0x59, 0xD2,
+    0x72, 0x48, 0x72, 0x45, 0x92, 0x43, 0x92, 0x65, 0xD7, 0x97, 0x46, 0x38, 0x6D, 0x51, 0x51, 0x80,
+    0x43, 0x23, 0x6C, 0xD2, 0x2B, 0xF7, 0xCF, 0x2D, 0x77, 0x00, 0xF0, 0xF7, 0x00, 0x7C, 0xF3, 0xD9,
+    0x6B, 0xED, 0x77, 0xAA, 0x8B, 0x2E, 0x0F, 0xB9, 0x89, 0xCD, 0x7E, 0x94, 0x0D, 0x7E, 0xE9, 0xD7,
+    0xA9, 0xEA, 0xCF, 0x2E, 0x13, 0x11, 0x9B, 0x2E, 0x53, 0x39, 0xA7, 0xF7, 0xDF, 0x2B, 0xBE, 0x0D,
+    0x9B, 0xCE, 0xB9, 0x77, 0x50, 0xA5, 0x85, 0x32, 0xD0, 0x02, 0x65, 0xA4, 0x2D, 0xE4, 0xDB, 0x1C,
+    0x03, 0xAB, 0x96, 0xD8, 0x13, 0x85, 0x17, 0x5B, 0x87, 0x14, 0x76, 0x53, 0x25, 0x97, 0x4C, 0x91,
+    0xE6, 0x63, 0xCC, 0xD2, 0x54, 0xA6, 0x5D, 0x1A, 0xEB, 0x1C, 0x25, 0xD3, 0xDC, 0x2A, 0xF5, 0x04,
+    0x49, 0x3A, 0x7D, 0xF7, 0x52, 0x9E, 0x0F, 0xC1, 0x26, 0x49, 0xB2, 0x9B, 0xA4, 0xCD, 0x45, 0xA9,
+    0x7F, 0x8A, 0x24, 0x43, 0x95, 0x64, 0x38, 0x24, 0x75, 0xEC, 0x92, 0xF4, 0x4B, 0x92, 0xA4, 0xFE,
+    0xED, 0xB7, 0xDF, 0x94, 0x04, 0x87, 0x24, 0x77, 0xBA, 0x99, 0xE5, 0x6C, 0xA2, 0x7A, 0x69, 0x04,
+    0x56, 0xCD, 0x40, 0x93, 0x6B, 0xCB, 0xBF, 0x92, 0xE6, 0x63, 0x3A, 0x6C, 0x9B, 0x8A, 0x69, 0x1D,
+    0x7F, 0x59, 0xC5, 0xEA, 0x3E, 0xC3, 0xBB, 0x7D, 0xAC, 0xC4, 0xE9, 0xE8, 0x79, 0x3D, 0x9B, 0xA6,
+    0xF0, 0x49, 0x13, 0xAB, 0x4B, 0x6C, 0x6E, 0x9F, 0x8F, 0xB9, 0x4D, 0xC7, 0x5C, 0xFA, 0xF3, 0x90,
+    0xDB, 0x93, 0x1A, 0xDC, 0xA1, 0xAD, 0x92, 0xA6, 0xE3, 0x39, 0x35, 0xB0, 0x34, 0x49, 0x13, 0x44,
+    0xA9, 0x7F, 0xFB, 0xED, 0x37, 0x24, 0x0B, 0xAF, 0xC2, 0x08, 0x1B, 0xBC, 0x0B, 0x9B, 0x65, 0x1B,
+    0x88, 0x1D, 0x5E, 0x4B, 0x11, 0xAB, 0x46, 0x3C, 0xAB, 0x14, 0x52, 0x88, 0xD2, 0xC4, 0x72, 0xFA,
+    0xCB, 0x4D, 0x92, 0x65, 0x93, 0xD4, 0x9F, 0x13, 0xBD, 0xAC, 0x0E, 0xAB, 0x24, 0x47, 0x96, 0x34,
+    0x7F, 0x8E, 0x24, 0x9B, 0x48, 0xD2, 0x94, 0xA7, 0x26, 0x4D, 0xA5, 0x67, 0xD3, 0x58, 0xE4, 0x8A,
+    0xC6, 0x2A, 0x43, 0xB4, 0x3C, 0xBE, 0x0D, 0xAF, 0xC1, 0xE9, 0x59, 0x1F, 0x42, 0x09, 0xD4, 0xD3,
+    0xD4, 0x7C, 0x08, 0x25, 0x90, 0x27, 0x9A, 0xDC, 0xA1, 0xE1, 0x34, 0x53, 0x4B, 0x92, 0xCB, 0x3F,
+    0xBD, 0x97, 0xA7, 0xBA, 0x83, 0x2C, 0x37, 0xF8, 0xFD, 0xFA, 0x24, 0x49, 0x32, 0x4D, 0x92, 0xE4,
+    0x36, 0x49, 0x32, 0x27, 0xFB, 0x9B, 0xA3, 0x24, 0x75, 0x45, 0x92, 0x34, 0xAD, 0x92, 0xA4, 0xDF,
+    0x70, 0x54, 0x0B, 0xAF, 0xC1, 0x57, 0xE1, 0x23, 0x78, 0x08, 0xDB, 0x88, 0x0C, 0xBE, 0x3B, 0x4D,
+    0xEE, 0xD9, 0xAD, 0x2D, 0x9A, 0xEA, 0xA5, 0xF3, 0x4B, 0xC5, 0x69, 0x56, 0x26, 0xFC, 0x54, 0xD5,
+    0x03, 0x78, 0x39, 0x60, 0x53, 0x7F, 0x2A, 0xF4, 0xF6, 0xA3, 0x5F, 0xAD, 0xBA, 0xD9, 0xFC, 0xE7,
+    0x41, 0xB8, 0xEC, 0xC8, 0xE9, 0x85, 0x8A, 0xF1, 0xAA, 0xE4, 0x4D, 0x32, 0x90, 0x03, 0x25, 0x90,
+    0xE1, 0x33, 0xF8, 0x21, 0x7C, 0x04, 0x9F, 0xD0, 0x46, 0xDA, 0x48, 0x13, 0x5B, 0x47, 0xEC, 0x59,
+    0x0D, 0x32, 0x68, 0x68, 0x9A, 0x8A, 0xA6, 0x22, 0x7B, 0xC8, 0x25, 0xB9, 0xA4, 0x65, 0x17, 0x51,
+    0xC4, 0xEE, 0xFF, 0xE2, 0x93, 0xBF, 0x12, 0xF1, 0x36, 0xAB, 0xBD, 0x2C, 0xFA, 0x0F, 0xAE, 0xAB,
+    0xFF, 0xE4, 0x9A, 0xF1, 0xD7, 0x99, 0x64, 0x28, 0x90, 0x21, 0x07, 0xF6, 0xF3, 0xC7, 0xE0, 0x07,
+    0x34, 0x36, 0xDD, 0xF4, 0xF0, 0xFF, 0x9D, 0xB9, 0x67, 0xD0, 0x9D, 0xA6, 0xEB, 0x74, 0x8E, 0x70,
+    0xC9, 0xD4, 0xEB, 0x74, 0xAE, 0x01, 0x84, 0xB1, 0x5C, 0x32, 0xC3, 0x35, 0x63, 0x6E, 0x32, 0x57,
+    0x48, 0x6A, 0xF2, 0x25, 0xD3, 0x5F, 0x33, 0x7A, 0xD3, 0x9D, 0x9C, 0x1C, 0x48, 0x32, 0xE7, 0x0E,
+    0xE1, 0x2D, 0x76, 0xC9, 0xC5, 0x17, 0x40, 0x56, 0x36, 0x78, 0xE9, 0x17, 0x5F, 0xDE, 0x2D, 0x3C,
+    0x3A, 0x61, 0x51, 0x93, 0x74, 0xEE, 0x6F, 0xF7, 0x2C, 0x20, 0x4D, 0xB5, 0x63, 0x93, 0xC1, 0xCF,
+    0x87, 0xC4, 0x36, 0x20, 0xB9, 0xDC, 0x11, 0x35, 0x55, 0x2D, 0xBB, 0x0C, 0xDE, 0x65, 0x89, 0x0F,
+    0x43, 0x51, 0x0F, 0x14, 0x19, 0x38, 0x91, 0xD3, 0x69, 0x06, 0x24, 0x85, 0x13, 0x0F, 0x54, 0xA8,
+    0x12, 0xD4, 0x40, 0x96, 0x02, 0xF9, 0xCA, 0xD3, 0xAE, 0x2C, 0xED, 0x3F, 0x4F, 0x3F, 0xBD, 0x77,
+    0xA6, 0xB4, 0x4B, 0xCA, 0x66, 0xF0, 0x86, 0x3F, 0x25, 0x9D, 0xDF, 0xB9, 0xE3, 0x4C, 0x6D, 0x39,
+    0xD3, 0xE9, 0x47, 0xD2, 0x6B, 0xF9, 0xE5, 0xBB, 0x3F, 0x20, 0x99, 0x13, 0x9B, 0x6E, 0xF3, 0xA9,
+    0x0E, 0x9D, 0xDA, 0xD8, 0xF5, 0x5C, 0x19, 0xE7, 0xF8, 0x2F, 0xA0, 0x26, 0xEB, 0xC7, 0xD1, 0xCB,
+    0x97, 0xC4, 0xA7, 0x6F, 0x3C, 0x27, 0xA4, 0xBB, 0xE1, 0x4F, 0xC8, 0x06, 0x3F, 0xFF, 0x4F, 0xC2,
+    0x16, 0xB7, 0xDE, 0xBA, 0xF4, 0xDE, 0x03, 0x49, 0x27, 0x80, 0xC9, 0xB7, 0x49, 0x53, 0x92, 0xC5,
+    0x14, 0xF5, 0xC4, 0xEF, 0x4A, 0xEE, 0x18, 0x57, 0x8D, 0x48, 0xEA, 0x88, 0xA7, 0x23, 0x99, 0xA1,
+    0x6A, 0x00, 0xBC, 0xE0, 0x5A, 0x28, 0xD9, 0x22, 0x69, 0x6C, 0x7D, 0x94, 0xE1, 0xD5, 0xAC, 0x9E,
+    0xF7, 0x50, 0xC7, 0x16, 0x72, 0xCF, 0x6E, 0x81, 0xBD, 0x07, 0xF6, 0x0B, 0x86, 0xFA, 0xE2, 0xB7,
+    0xAE, 0x0B, 0xF0, 0xC5, 0x6F, 0xA9, 0x87, 0x2C, 0x4B, 0xD3, 0x04, 0xB1, 0xE7, 0x02, 0x3F, 0xDD,
+    0x19, 0x6B, 0xF0, 0x86, 0x6D, 0xC1, 0x4F, 0x55, 0x73, 0xD1, 0x8C, 0x5C, 0x16, 0x51, 0xAE, 0x8A,
+    0x6D, 0x6C, 0xD2, 0x72, 0x5C, 0x77, 0x49, 0x9A, 0xAA, 0x88, 0xEA, 0x89, 0x2E, 0x0F, 0x9C, 0x14,
+    0x17, 0x8A, 0x34, 0x17, 0x73, 0x6E, 0xBA, 0x25, 0x4D, 0x40, 0x54, 0x47, 0x74, 0x79, 0xBC, 0x7C,
+    0xB2, 0xD9, 0x2A, 0xCD, 0x87, 0xC1, 0x2F, 0x87, 0xC4, 0x36, 0x55, 0x91, 0x64, 0x90, 0xCB, 0x86,
+    0x4D, 0xF3, 0x21, 0xB6, 0x81, 0xA8, 0x0B, 0x6B, 0xDC, 0xE7, 0xAA, 0x85, 0x7D, 0x02, 0xF6, 0x11,
+    0xB6, 0x89, 0x73, 0xA8, 0x1A, 0x4E, 0x34, 0x24, 0xE9, 0xB7, 0xEF, 0x49, 0x97, 0x90, 0xD0, 0x7C,
+    0x25, 0x26, 0x55, 0x73, 0xFB, 0x0A, 0xAB, 0x88, 0x63, 0xD5, 0xD8, 0x34, 0x67, 0xCD, 0x59, 0x61,
+    0x13, 0x5B, 0x8F, 0xEF, 0x59, 0xC7, 0xAA, 0x01, 0xCD, 0x59, 0x13, 0x3E, 0x6C, 0x9A, 0x00, 0xAF,
+    0x11, 0xAA, 0x34, 0x42, 0x96, 0xDC, 0x1E, 0x36, 0xF5, 0xF4, 0x78, 0xD9, 0x32, 0x56, 0x89, 0x6D,
+    0xCE, 0x9A, 0x9A, 0xC2, 0x26, 0x52, 0xCF, 0x3A, 0xE1, 0x17, 0x76, 0x8E, 0x11, 0x3E, 0xC6, 0xCF,
+    0x70, 0xF7, 0x42, 0xCD, 0x1F, 0x49, 0x96, 0xA2, 0x11, 0x52, 0xCF, 0xF7, 0xF1, 0x6E, 0xB7, 0x87,
+    0xA9, 0x62, 0xBD, 0xBD, 0x4E, 0x87, 0x24, 0x56, 0x7D, 0x99, 0x43, 0x33, 0xAC, 0x16, 0x0E, 0xC3,
+    0xCA, 0xBA, 0xEC, 0xD3, 0x31, 0x56, 0xB1, 0x86, 0x7D, 0x2E, 0x03, 0xD0, 0x1C, 0x9F, 0xB1, 0x71,
+    0xB8, 0xAC, 0xFB, 0xBA, 0x7F, 0xC3, 0x56, 0x7F, 0x5E, 0xD2, 0x6B, 0x51, 0xCB, 0x09, 0x1C, 0xE3,
+    0x04, 0x87, 0xE1, 0x9D, 0xA6, 0x10, 0x4F, 0x24, 0xD0, 0x23, 0xC9, 0xA5, 0x57, 0x64, 0x5A, 0x68,
+    0x5A, 0xA0, 0x8C, 0x40, 0x0A, 0x79, 0xE0, 0x9B, 0x55, 0xB6, 0xB0, 0x89, 0xBF, 0xAD, 0x9A, 0x6A,
+    0xD8, 0xC5, 0x27, 0x4D, 0x53, 0x5D, 0x92, 0xF8, 0x08, 0x4D, 0xC5, 0x1D, 0x1D, 0x0F, 0xD9, 0x96,
+    0x34, 0x41, 0x3B, 0x01, 0x57, 0x60, 0x95, 0x1E, 0x78, 0xDD, 0xFA, 0xB5, 0x47, 0x9A, 0x4F, 0xC8,
+    0xCB, 0xB6, 0xE4, 0xD7, 0xCB, 0x50, 0x7A, 0x3A, 0xB4, 0xC4, 0x25, 0xDA, 0x64, 0xFF, 0xE5, 0xAB,
+    0x79, 0x80, 0xA3, 0x03, 0xD6, 0xE5, 0xAF, 0x43, 0xB6, 0xC9, 0x30, 0x14, 0xF1, 0x2E, 0x72, 0x69,
+    0x89, 0xF6, 0x58, 0x9E, 0x85, 0x12, 0xA0, 0x3A, 0x5E, 0x20, 0xE1, 0x01, 0x1A, 0x50, 0x2D, 0xD4,
+    0xA1, 0x75, 0x75, 0x68, 0xAA, 0x43, 0x53, 0x19, 0x9A, 0x8E, 0xA1, 0x49, 0x3F, 0xE9, 0xD7, 0xF2,
+    0x67, 0x0A, 0x14, 0xC1, 0xD5, 0x8C, 0x4E, 0xC0, 0x71, 0x9E, 0xA8, 0xDB, 0xBC, 0xC3, 0xAA, 0x21,
+    0xCD, 0x59, 0xFA, 0x6E, 0x8F, 0xD7, 0xB8, 0xCF, 0x59, 0x6A, 0x3D, 0x5E, 0xD3, 0x36, 0x67, 0xA9,
+    0xF4, 0x78, 0xD9, 0x38, 0x67, 0xF5, 0xA5, 0xC7, 0xCB, 0xF9, 0x39, 0x6B, 0x48, 0x3D, 0x5E, 0x4D,
+    0x73, 0xEE, 0x42, 0x0B, 0x1C, 0x0B, 0xC0, 0xF7, 0x00, 0x9A, 0xDB, 0x24, 0xF7, 0x51, 0x91, 0xFA,
+    0xEA, 0xA2, 0x34, 0xBF, 0x77, 0x48, 0x5D, 0xB1, 0xAB, 0x34, 0xAD, 0x49, 0xD2, 0x9F, 0xEB, 0xF6,
+    0x23, 0x29, 0xB0, 0x19, 0xC8, 0x53, 0x0B, 0xC5, 0xA6, 0xB1, 0xBA, 0xCD, 0xB4, 0x25, 0x1A, 0xC2,
+    0x3F, 0x7C, 0x8D, 0xCB, 0x3C, 0x1B, 0x7F, 0xFD, 0xE0, 0x7E, 0x88, 0x52, 0xD8, 0xCE, 0x03, 0xEC,
+    0xDA, 0xDD, 0xDF, 0xB5, 0x50, 0x47, 0x28, 0x1D, 0xEC, 0xBA, 0x75, 0x5F, 0xFD, 0x1B, 0x92, 0xF4,
+    0x1B, 0x62, 0x75, 0x44, 0xB7, 0xDB, 0x66, 0x38, 0x26, 0x3A, 0xD2, 0x58, 0x7B, 0xD2, 0xCF, 0x86,
+    0xB8, 0x44, 0xF7, 0x37, 0xEA, 0xEA, 0x50, 0xC6, 0x24, 0x8D, 0x69, 0x89, 0x55, 0x92, 0xFB, 0x95,
+    0x32, 0xAF, 0xBA, 0x3A, 0x89, 0x4B, 0x30, 0x57, 0x53, 0x0D, 0x1F, 0x37, 0xA9, 0x67, 0x28, 0x73,
+    0x96, 0x96, 0x7D, 0x89, 0x44, 0x4D, 0x75, 0x28, 0x63, 0x53, 0x4F, 0x5C, 0xA2, 0xCB, 0x0A, 0x69,
+    0x6C, 0x3D, 0x71, 0x6E, 0x86, 0x32, 0xF1, 0xEA, 0xD9, 0xEF, 0x71, 0xCB, 0x4B, 0xD2, 0x7D, 0xE9,
+    0x8B, 0x8F, 0xD4, 0x9D, 0x07, 0xAF, 0xD8, 0xA7, 0x4B, 0xB1, 0xEB, 0x54, 0x6F, 0x69, 0x2C, 0xD2,
+    0x54, 0xF4, 0xCA, 0xEB, 0x59, 0x33, 0x9B, 0x66, 0xB2, 0x7E, 0x2E, 0x54, 0x69, 0x60, 0x90, 0x61,
+    0x5E, 0x0D, 0x6E, 0x1B, 0xAB, 0x6B, 0xA1, 0xD8, 0x33, 0x30, 0xE5, 0xF5, 0xCA, 0x19, 0x93, 0xD3,
+    0x4C, 0x72, 0x3C, 0xA1, 0x4C, 0x1C, 0xCB, 0xA1, 0xB0, 0x0F, 0x55, 0x36, 0x77, 0x78, 0x5B, 0xB5,
+    0x6C, 0x16, 0x6F, 0xB3, 0x65, 0x1B, 0xAA, 0x7D, 0x92, 0x3B, 0x5E, 0xFB, 0xB8, 0x6A, 0x79, 0xF2,
+    0x2E, 0xDE, 0x12, 0x97, 0x6D, 0x20, 0xDA, 0xDC, 0x11, 0x87, 0xAA, 0x65, 0xEB, 0xF0, 0xCB, 0xA1,
+    0x70, 0x04, 0x22, 0x04, 0x92, 0x63, 0xD7, 0xCF, 0xE8, 0x0B, 0xD2, 0x14, 0x6D, 0xD4, 0x90, 0xC7,
+    0x24, 0x61, 0x8A, 0x34, 0xD3, 0xA4, 0x9E, 0x26, 0xE9, 0xD6, 0xFD, 0x17, 0xA3, 0x3E, 0x3F, 0xC5,
+    0x81, 0x48, 0xB7, 0xD7, 0x40, 0x9C, 0x13, 0xC4, 0x90, 0x6D, 0x13, 0x79, 0xA8, 0x7D, 0xFB, 0xF5,
+    0xA1, 0x0E, 0x87, 0x86, 0x3A, 0x25, 0x0D, 0xD5, 0x46, 0x0D, 0x10, 0x35, 0xC0, 0xAE, 0xA1, 0xBD,
+    0x9E, 0x34, 0xD4, 0xA9, 0x68, 0xA8, 0x63, 0xD5, 0x50, 0x0D, 0x1A, 0x6A, 0x4F, 0xB4, 0xCD, 0xB3,
+    0x07, 0xE2, 0x72, 0x40, 0xB4, 0x55, 0x52, 0x77, 0xEF, 0x79, 0x1C, 0x3A, 0xCE, 0x40, 0xEA, 0xC2,
+    0xA7, 0x6C, 0x9A, 0x36, 0x97, 0x64, 0xF2, 0x54, 0xA4, 0x6A, 0x90, 0x9C, 0x88, 0x9A, 0xA2, 0x4B,
+    0x1A, 0xD2, 0x54, 0xD4, 0x1F, 0x06, 0xA9, 0x8A, 0x28, 0x27, 0x97, 0x7E, 0x76, 0x8E, 0x53, 0x31,
+    0xEC, 0x86, 0x9E, 0x74, 0x9B, 0xC7, 0x21, 0x4F, 0x60, 0xB3, 0x81, 0x78, 0xEF, 0xC5, 0xFB, 0x0E,
+    0x2F, 0x6A, 0x60, 0xED, 0xA9, 0x96, 0x68, 0xD8, 0x07, 0xF6, 0x91, 0x6D, 0x20, 0x4D, 0x6C, 0xC3,
+    0xE7, 0xD9, 0x86, 0x6D, 0xF8, 0xAC, 0x38, 0xB7, 0x0D, 0x3F, 0x28, 0xBF, 0xE7, 0xB6, 0xE1, 0x9F,
+    0x5B, 0x71, 0xDB, 0x90, 0x38, 0xDC, 0x36, 0xA4, 0x25, 0xBB, 0x6D, 0x48, 0x2E, 0xB9, 0x6D, 0x48,
+    0xF3, 0xE6, 0xB6, 0x21, 0x4D, 0xD1, 0x6D, 0xD3, 0xF1, 0x33, 0x5A, 0x1E, 0x07, 0x34, 0xD0, 0x02,
+    0x17, 0x28, 0x7B, 0xD1, 0x06, 0x37, 0xDA, 0xC8, 0x43, 0x95, 0x3D, 0x3A, 0xFC, 0xD0, 0xB4, 0x6C,
+    0x1D, 0xAB, 0xCD, 0x5A, 0xF6, 0x81, 0x8B, 0x8D, 0x69, 0x5A, 0x9E, 0xBD, 0x73, 0x2D, 0xFC, 0x91,
+    0x2F, 0x97, 0xAA, 0xF0, 0x34, 0x10, 0x01, 0x92, 0x23, 0xE9, 0xF6, 0xDB, 0x5E, 0x03, 0x17, 0x9C,
+    0x01, 0x64, 0x7B, 0x18, 0xDE, 0xE7, 0x8C, 0x52, 0xF0, 0xFD, 0xA6, 0xA9, 0x85, 0x5D, 0xE1, 0x49,
+    0xD3, 0xD8, 0xD8, 0x15, 0xBE, 0xDF, 0x34, 0xD6, 0x90, 0xC4, 0x5F, 0xE0, 0x6D, 0x71, 0xD5, 0x70,
+    0xF7, 0xE2, 0x7A, 0x0E, 0x59, 0x8E, 0x17, 0xF6, 0xD1, 0x7C, 0x03, 0x5E, 0x8F, 0x05, 0xD8, 0x87,
+    0xA6, 0x39, 0x77, 0xAC, 0x63, 0xD5, 0xB2, 0xF7, 0x78, 0x7B, 0x28, 0x6C, 0xFF, 0xA5, 0xC2, 0xA5,
+    0x76, 0x1C, 0x81, 0x0D, 0x02, 0x69, 0x61, 0xD7, 0x6F, 0x75, 0x8F, 0x34, 0x57, 0x47, 0x0C, 0x40,
+    0x5A, 0x80, 0xC3, 0xB0, 0x85, 0x72, 0xC1, 0x1E, 0x9A, 0xEA, 0x4F, 0x12, 0xCF, 0x2F, 0x31, 0xB2,
+    0xC1, 0x87, 0x64, 0xAE, 0x0E, 0xD1, 0x1B, 0x38, 0x64, 0xF8, 0xB6, 0x97, 0x39, 0xD9, 0xEC, 0x73,
+    0xE1, 0xA5, 0x99, 0x22, 0x39, 0x8A, 0xF4, 0xCA, 0x83, 0xFB, 0x92, 0xFA, 0x47, 0xEA, 0xC0, 0xCF,
+    0xF0, 0x15, 0x9E, 0x34, 0x7B, 0x4C, 0x85, 0x38, 0x7F, 0xAF, 0x69, 0x99, 0xB3, 0x14, 0xB6, 0x33,
+    0xA8, 0xD4, 0xCE, 0xD0, 0x71, 0x48, 0xEA, 0x48, 0x32, 0x3C, 0xFD, 0xFA, 0x5F, 0x00, 0x23, 0x1C,
+    0x03, 0xAC, 0x7A, 0xE0, 0xCF, 0x85, 0x72, 0x9C, 0xA6, 0x9F, 0x72, 0x8A, 0x77, 0x79, 0x58, 0xDC,
+    0x43, 0x1E, 0x16, 0x77, 0x97, 0x87, 0xC5, 0x76, 0xAC, 0x59, 0x1D, 0xAB, 0xFE, 0x13, 0x31, 0xF0,
+    0x58, 0x72, 0xD4, 0x8B, 0x38, 0x59, 0x2F, 0xBF, 0x4F, 0x75, 0xE4, 0x99, 0xC8, 0xA1, 0x65, 0x37,
+    0xAC, 0xA6, 0x68, 0x2E, 0x0A, 0xAB, 0x88, 0x53, 0xD2, 0xD8, 0x3A, 0xA4, 0x25, 0xCD, 0x9B, 0x0C,
+    0xA6, 0x48, 0x36, 0x2F, 0x5E, 0xE2, 0x9B, 0x49, 0x1A, 0x6B, 0x93, 0xE4, 0x88, 0xD7, 0xE0, 0xF0,
+    0x84, 0xAE, 0xB1, 0x91, 0xE1, 0x8C, 0x48, 0x44, 0x49, 0x53, 0x92, 0x7E, 0xC1, 0x34, 0x69, 0xF8,
+    0x47, 0xA2, 0x14, 0x48, 0xD2, 0x48, 0x91, 0xCE, 0xB0, 0x68, 0xF7, 0xE8, 0x82, 0xEF, 0xEE, 0x49,
+    0xEA, 0x49, 0x92, 0x86, 0x17, 0xE4, 0x35, 0x98, 0xF0, 0xEF, 0xE4, 0x9C, 0x25, 0xDD, 0x81, 0xAC,
+    0x0E, 0xC0, 0x0F, 0xF0, 0x39, 0xBB, 0xAD, 0x36, 0x85, 0xEC, 0x92, 0x4D, 0xB6, 0x2C, 0xBB, 0x4D,
+    0x53, 0x0D, 0x9B, 0x4D, 0x63, 0x0D, 0xD1, 0xA6, 0xA1, 0xF1, 0x82, 0x3C, 0xCB, 0x97, 0x64, 0xD3,
+    0x54, 0x5C, 0xB6, 0x69, 0x3E, 0x6C, 0xB3, 0x29, 0xA4, 0x11, 0x20, 0x9E, 0xE7, 0x44, 0x77, 0x4E,
+    0x2E, 0x3F, 0xE7, 0xFF, 0x60, 0x0C, 0x3D, 0x44, 0x9D, 0xE6, 0x48, 0xDD, 0x83, 0xAB, 0xD2, 0x26,
+    0x8A, 0xE3, 0x1B, 0xD4, 0x81, 0xCD, 0x36, 0x85, 0xB5, 0x23, 0x2E, 0xAB, 0x6C, 0x71, 0x51, 0x1D,
+    0x21, 0x4A, 0xF3, 0xB9, 0x6E, 0x9B, 0x24, 0x97, 0xAE, 0xE1, 0x23, 0xC7, 0x2E, 0xCD, 0x1F, 0x37,
+    0x69, 0xDE, 0xC3, 0xAE, 0x39, 0x4D, 0x55, 0x73, 0xEE, 0x79, 0xBC, 0xF0, 0x3E, 0xCC, 0xEC, 0x27,
+    0x7E, 0x95, 0x46, 0xEA, 0xCC, 0x01, 0xEF, 0xC1, 0x5D, 0xF6, 0x81, 0x75, 0x68, 0x27, 0x4F, 0x3C,
+    0xE9, 0xD5, 0x7F, 0x2F, 0xDB, 0x01, 0xFC, 0x53, 0xB8, 0x39, 0x8F, 0xF5, 0x86, 0xC8, 0x9F, 0x4C,
+    0x6B, 0x8E, 0x92, 0xFA, 0x22, 0x49, 0x76, 0x95, 0xA4, 0x7C, 0x31, 0x70, 0x1F, 0x41, 0xE0, 0x7D,
+    0x9A, 0x45, 0x21, 0x0F, 0x4D, 0xCB, 0xFE, 0x82, 0x40, 0xCB, 0x6E, 0xF0, 0xCB, 0x05, 0x47, 0x03,
+    0xBB, 0xEE, 0x9C, 0x44, 0x68, 0x79, 0x49, 0x74, 0xE1, 0xA9, 0x34, 0xC3, 0xF5, 0x4E, 0xE5, 0x34,
+    0x0E, 0x3F, 0xA4, 0x2C, 0x7C, 0xC0, 0x01, 0x33, 0x69, 0xC9, 0x63, 0xEB, 0xD8, 0x86, 0x22, 0xBC,
+    0xDB, 0x3B, 0xE4, 0xB6, 0xE9, 0xD0, 0x12, 0xA7, 0x6C, 0x9A, 0x6C, 0x32, 0x55, 0xAC, 0xFF, 0x83,
+    0xCA, 0xF3, 0x46, 0xEE, 0xF1, 0x85, 0x7A, 0xBA, 0x33, 0x89, 0x37, 0x17, 0x1B, 0x05, 0x2C, 0x09,
+    0xBE, 0xC9, 0x0F, 0xA0, 0x63, 0x9B, 0x8F, 0x01, 0x7F, 0x69, 0xE9, 0xDA, 0xC4, 0xFF, 0xC2, 0x6B,
+    0xC7, 0x4B, 0xC3, 0xF8, 0xE0, 0x4C, 0x2E, 0xE0, 0x2C, 0x9C, 0xC3, 0x19, 0x2E, 0xB8, 0xCF, 0xAD,
+    0x2F, 0xF1, 0x5D, 0x77, 0xB9, 0xD2, 0x4D, 0xD7, 0x40, 0x3E, 0x51, 0xEE, 0x42, 0x3C, 0x9F, 0x4A,
+    0xEE, 0x21, 0x5E, 0x26, 0xDB, 0x2C, 0xB9, 0x0E, 0xAF, 0x2E, 0x59, 0x9A, 0x57, 0x07, 0x4D, 0xB2,
+    0xE7, 0xD9, 0xF1, 0x44, 0xD9, 0x3C, 0x16, 0x75, 0xF8, 0xF0, 0x3C, 0xCB, 0xAA, 0xA5, 0x91, 0xE4,
+    0x2E, 0xE4, 0xA9, 0xBD, 0x74, 0xE9, 0xD3, 0x9F, 0x91, 0xF3, 0x27, 0x67, 0xE4, 0xFC, 0x0F, 0x79,
+    0x43, 0x1D, 0xFB, 0x50, 0xA5, 0x1E, 0x6F, 0xB3, 0x34, 0x56, 0x2D, 0x9B, 0x34, 0xE7, 0x0E, 0x1E,
+    0x2B, 0x6C, 0x03, 0x1C, 0x3D, 0xDE, 0x42, 0x1E, 0xAB, 0x96, 0xCD, 0xA5, 0x39, 0x77, 0xF8, 0x10,
+    0xC3, 0x36, 0xD4, 0x9E, 0x1E, 0x6F, 0xF3, 0x58, 0xCE, 0xAA, 0x7D, 0xCE, 0x03, 0x4F, 0xE8, 0x38,
+    0x02, 0x64, 0xC7, 0xE7, 0xA7, 0xE7, 0xD9, 0x5F, 0x42, 0x1F, 0x45, 0x13, 0x48, 0xCB, 0xD3, 0xD3,
+    0xD4, 0x74, 0x78, 0x69, 0xD9, 0x24, 0x7B, 0x5A, 0x82, 0x72, 0x62, 0xE9, 0xCD, 0x25, 0x9B, 0xC7,
+    0x32, 0xD4, 0x8E, 0x0E, 0x1F, 0xE2, 0xB2, 0xB9, 0xB4, 0x34, 0xF2, 0xD9, 0xF0, 0xB5, 0xC9, 0x2F,
+    0x3F, 0x92, 0xC2, 0x09, 0x80, 0xE3, 0xF2, 0x29, 0x87, 0x5D, 0x47, 0x7A, 0x2F, 0x36, 0xC9, 0x1E,
+    0x7A, 0xF0, 0xF5, 0x26, 0x07, 0x71, 0x84, 0x5D, 0x8F, 0x5E, 0x3F, 0xA4, 0xA1, 0x0D, 0xEA, 0xF9,
+    0xEA, 0x2E, 0xDE, 0xAF, 0x0A, 0x1B, 0xCF, 0x48, 0x33, 0xA4, 0x0E, 0x36, 0x75, 0x0F, 0x2E, 0x9C,
+    0xEA, 0x0D, 0x05, 0xE2, 0x40, 0xD3, 0x09, 0x34, 0xA2, 0x6D, 0xE7, 0x35, 0x63, 0x15, 0x31, 0xE4,
+    0xA1, 0xF6, 0xC8, 0x1D, 0x43, 0x35, 0xC8, 0x96, 0xA1, 0x7D, 0xAD, 0x69, 0x2A, 0x03, 0xBC, 0x94,
+    0x7C, 0x07, 0x4D, 0x65, 0xA8, 0xC3, 0x99, 0x18, 0x64, 0x8F, 0xA1, 0x1A, 0xD6, 0x39, 0x0D, 0xB5,
+    0x67, 0x5B, 0x76, 0x8B, 0x07, 0x62, 0x38, 0x6F, 0xBC, 0x20, 0x4E, 0xE7, 0xBF, 0x36, 0xE8, 0xC1,
+    0xF3, 0x85, 0x22, 0x8D, 0xC0, 0x1A, 0x9E, 0x86, 0x6C, 0x10, 0xAB, 0xCD, 0xA6, 0x69, 0xD9, 0xA6,
+    0x43, 0x44, 0xB7, 0xF7, 0xFC, 0x03, 0x6B, 0x0F, 0x4D, 0x1D, 0x1C, 0x1A, 0xEB, 0xB2, 0xCB, 0x6D,
+    0xAC, 0x06, 0xD3, 0x34, 0xE7, 0xE9, 0xE8, 0x89, 0xE1, 0xE9, 0x5C, 0x46, 0x2A, 0x9B, 0x23, 0xDD,
+    0x60, 0xC0, 0xBE, 0x8C, 0x69, 0xA8, 0x36, 0x0F, 0x75, 0xCE, 0xA6, 0x4C, 0x49, 0xBE, 0x7B, 0xAE,
+    0x9E, 0xFF, 0x45, 0x40, 0xFF, 0x6F, 0xD5, 0xBD, 0x4F, 0xB0, 0xE5, 0xD4, 0x9D, 0xE7, 0xF9, 0x91,
+    0x0E, 0xF9, 0x54, 0x85, 0xBA, 0xFB, 0xE4, 0xC2, 0xD9, 0x31, 0x86, 0xB2, 0x55, 0x8B, 0x5A, 0x78,
+    0x18, 0x97, 0xB5, 0xED, 0x05, 0xE6, 0x28, 0x21, 0xA6, 0x99, 0x18, 0x2F, 0xC8, 0x89, 0xC8, 0x57,
+    0x35, 0x6D, 0x77, 0x04, 0x5E, 0xD4, 0x44, 0x94, 0x71, 0x77, 0x65, 0x2F, 0xBD, 0x00, 0x24, 0xCC,
+    0xC2, 0x0B, 0x2F, 0x9C, 0x0B, 0x33, 0x1D, 0x31, 0xB5, 0x28, 0x22, 0x86, 0x8E, 0x30, 0x8F, 0x89,
+    0xC0, 0x0B, 0x2F, 0x3C, 0x11, 0x06, 0x1D, 0x20, 0x26, 0x58, 0xB0, 0xB0, 0x70, 0xB6, 0x8B, 0x85,
+    0x17, 0xA8, 0xED, 0xA4, 0x6A, 0x0A, 0x16, 0x79, 0x28, 0x8B, 0xB2, 0x32, 0x39, 0xD2, 0xB7, 0x17,
+    0x47, 0xF7, 0xBE, 0x97, 0x09, 0x18, 0x4C, 0xF1, 0x27, 0x7D, 0xE3, 0xBD, 0x73, 0x25, 0xDD, 0x7B,
+    0xA5, 0x73, 0x7E, 0x3A, 0x7F, 0x7E, 0xBF, 0xEF, 0xEF, 0xFB, 0xFB, 0xE9, 0xF6, 0x47, 0xF4, 0x92,
+    0xEA, 0xE8, 0x3C, 0x90, 0xFD, 0xB0, 0x1A, 0x5C, 0xB3, 0x9A, 0xD9, 0x06, 0xE7, 0x65, 0x62, 0x15,
+    0xDA, 0xE7, 0xF4, 0x95, 0xA5, 0x9E, 0xFA, 0x4B, 0xB2, 0xD1, 0x0D, 0xE7, 0x49, 0xAF, 0x3C, 0x00,
+    0x0E, 0x30, 0xEF, 0xD8, 0x68, 0xD5, 0xD1, 0x4A, 0x4D, 0x25, 0x45, 0xB3, 0x7E, 0xD9, 0x0D, 0x7A,
+    0xF4, 0xE5, 0x68, 0xC3, 0x97, 0xED, 0xDD, 0xAB, 0x19, 0x1A, 0x37, 0xDC, 0x89, 0x59, 0x8C, 0xC7,
+    0x0D, 0x0F, 0x62, 0xD6, 0xC2, 0xE3, 0xC6, 0x07, 0xC9, 0x55, 0x78, 0xAA, 0xF8, 0x20, 0x8D, 0xF4,
+    0xFF, 0xC5, 0x42, 0x92, 0xAF, 0xA4, 0x89, 0x5A, 0x33, 0x58, 0x0F, 0x44, 0xDE, 0x73, 0xA3, 0x01,
+    0x38, 0x58, 0x1B, 0xA8, 0x35, 0x81, 0x14, 0xC9, 0x75, 0xEF, 0x8A, 0x59, 0xF2, 0x95, 0x22, 0x66,
+    0x0B, 0x76, 0xCE, 0x66, 0xEC, 0x04, 0xA9, 0xA8, 0x02, 0x9C, 0xBA, 0xF0, 0xD6, 0x9F, 0x61, 0x25,
+    0x61, 0xA5, 0x15, 0x5C, 0x00, 0xDC, 0x08, 0xB8, 0x01, 0x68, 0xFD, 0xAE, 0xE8, 0x3B, 0x38, 0xA3,
+    0xC3, 0x3F, 0xFB, 0x89, 0x93, 0x14, 0x9D, 0xA4, 0x58, 0x5D, 0x93, 0xA6, 0xA2, 0xE3, 0x4C, 0xF3,
+    0x07, 0x90, 0x35, 0xF1, 0xE0, 0x89, 0xEA, 0xDE, 0x45, 0xAB, 0x8C, 0xA4, 0xD1, 0xE8, 0xE9, 0x05,
+    0x1B, 0xCA, 0x09, 0xD7, 0xD9, 0x91, 0x05, 0xE7, 0xCD, 0xC4, 0x8A, 0x0D, 0x66, 0xC6, 0x8D, 0xCE,
+    0x67, 0x92, 0xBA, 0x5A, 0xD2, 0x73, 0x6B, 0xBB, 0xB8, 0xE7, 0x46, 0xB8, 0x33, 0x03, 0x38, 0x73,
+    0x78, 0xEE, 0xD4, 0xE1, 0xFF, 0x26, 0x0D, 0xAD, 0x5E, 0x90, 0x32, 0xAD, 0x99, 0x06, 0xFA, 0x2E,
+    0x57, 0x67, 0x22, 0x46, 0x54, 0x23, 0xE5, 0x8A, 0xC0, 0x46, 0x33, 0x43, 0x35, 0xD5, 0x1E, 0x5C,
+    0x58, 0xA0, 0xD6, 0x2F, 0x34, 0xD2, 0x4A, 0x6A, 0x38, 0xD4, 0x72, 0x1E, 0x32, 0x0D, 0x60, 0x25,
+    0x79, 0x9C, 0xB4, 0xC2, 0x03, 0xFD, 0xB5, 0x27, 0x00, 0x79, 0xC0, 0x08, 0xC0, 0x46, 0xE0, 0x40,
+    0xEA, 0xA0, 0x95, 0x1A, 0x32, 0x29, 0x02, 0xEE, 0xA7, 0xBF, 0x8E, 0xDA, 0x17, 0x87, 0xE9, 0x6E,
+    0x1F, 0xFC, 0xDF, 0x27, 0x8E, 0xC9, 0x79, 0xB2, 0x27, 0xC8, 0xB4, 0x52, 0x6B, 0xC9, 0x67, 0x1B,
+    0x2B, 0x6F, 0x47, 0x51, 0x15, 0x0B, 0xD4, 0x2B, 0x3C, 0xAB, 0x26, 0xFF, 0xB5, 0x86, 0xF2, 0x79,
+    0x8D, 0xD5, 0x59, 0x8D, 0xAE, 0x69, 0xC7, 0xBE, 0xAB, 0xBD, 0xC6, 0xBA, 0xD3, 0x74, 0x17, 0xFD,
+    0x1C, 0x71, 0xFF, 0x34, 0x52, 0xE9, 0x11, 0xEC, 0xE2, 0xB0, 0xFF, 0x18, 0x71, 0xDF, 0x8D, 0x79,
+    0xAC, 0x24, 0x5F, 0x6B, 0xA6, 0x5C, 0x01, 0xB0, 0xA3, 0xFB, 0x6E, 0x74, 0xBF, 0x96, 0x8D, 0xED,
+    0x23, 0x6B, 0xC6, 0x2D, 0xEC, 0x5E, 0x95, 0x2E, 0x03, 0xFD, 0xEB, 0xFD, 0x00, 0x2B, 0x3C, 0x0B,
+    0x11, 0xCC, 0xC8, 0x0C, 0xDC, 0xC5, 0x83, 0xF4, 0xB3, 0xF1, 0x5F, 0x46, 0xE2, 0xC7, 0x15, 0x6B,
+    0xE9, 0x6D, 0xD9, 0x3C, 0x9B, 0x85, 0xFC, 0x92, 0x77, 0x9C, 0xE6, 0x5B, 0xC1, 0x7A, 0xF8, 0xFC,
+    0x9D, 0x45, 0x80, 0xE2, 0xA7, 0x59, 0x84, 0xEC, 0x57, 0xBE, 0x6D, 0xE0, 0x5B, 0x3F, 0xB2, 0x01,
+    0xFE, 0xF4, 0xF3, 0xB9, 0xFE, 0xCF, 0xC1, 0x1A, 0xEF, 0x14, 0x0A, 0xFF, 0xE3, 0x5C, 0x93, 0x19,
+    0x6C, 0x93, 0x91, 0x07, 0x26, 0xC8, 0x03, 0x55, 0x47, 0x11, 0x40, 0x8F, 0x5D, 0x18, 0xA1, 0x90,
+    0x3A, 0xE0, 0xD4, 0x7F, 0x01, 0x38, 0x24, 0x57, 0xC8, 0xD7, 0x95, 0x58, 0xF9, 0x53, 0x26, 0xF0,
+    0xAF, 0x23, 0xBD, 0x58, 0xEF, 0xF7, 0x0F, 0x9B, 0x60, 0x9F, 0x5F, 0x1F, 0x95, 0x82, 0xBB, 0x34,
+    0x02, 0x70, 0xCA, 0x48, 0x83, 0x14, 0xCE, 0x1C, 0x36, 0x00, 0x46, 0xD2, 0x15, 0x49, 0xBD, 0xB4,
+    0x82, 0x99, 0xC1, 0x8E, 0xE0, 0x3A, 0x58, 0x21, 0x7F, 0xE2, 0xCC, 0xE1, 0xDD, 0xD2, 0xAB, 0x52,
+    0xAB, 0x78, 0xE6, 0xF0, 0x1C, 0xD9, 0x21, 0xD0, 0xAB, 0xC3, 0x5E, 0x2C, 0x07, 0x26, 0x8C, 0x2F,
+    0x6F, 0x7B, 0xD2, 0xF8, 0x6F, 0xB5, 0xCF, 0x16, 0x77, 0xFB, 0x07, 0x1F, 0xB4, 0x36, 0x7B, 0x33,
+    0x7C, 0xF1, 0xCE, 0xE2, 0xD5, 0xE6, 0x87, 0x63, 0x35, 0xE5, 0x2F, 0xF8, 0x87, 0x42, 0x59, 0x66,
+    0xBF, 0x0E, 0x77, 0x7E, 0xAE, 0xFA, 0xD5, 0x9B, 0xE3, 0x9D, 0x67, 0xCE, 0xDE, 0xC7, 0x9D, 0xF0,
+    0x23, 0x1E, 0xA2, 0x6A, 0xD2, 0x78, 0x39, 0xF8, 0x01, 0xDC, 0x71, 0xF4, 0xA4, 0xD3, 0xDA, 0x6A,
+    0x3D, 0x73, 0x78, 0x9E, 0x0B, 0x17, 0x91, 0x90, 0x42, 0xFF, 0x9F, 0x17, 0xD7, 0xB9, 0xEF, 0x79,
+    0xFB, 0xAB, 0xC9, 0xCC, 0x2B, 0x4B, 0xFD, 0x77, 0x32, 0x52, 0xD3, 0xAA, 0xC9, 0x9E, 0x84, 0x53,
+    0x0D, 0xF4, 0x90, 0x47, 0x28, 0x03, 0xD4, 0x1E, 0x7A, 0x6E, 0x7D, 0x6A, 0x3D, 0x6A, 0xA5, 0x55,
+    0xD2, 0xD5, 0xC3, 0xFE, 0xB0, 0xB9, 0xFE, 0x53, 0xF2, 0x08, 0xD9, 0xB9, 0x77, 0x36, 0x3A, 0xBD,
+    0xDA, 0x19, 0xC9, 0xEB, 0xCA, 0xEC, 0x9E, 0x93, 0x1D, 0x9C, 0x7F, 0xBC, 0x1A, 0xB1, 0x01, 0x3B,
+    0x6D, 0x7F, 0x55, 0xA0, 0x7A, 0xEB, 0xB0, 0x92, 0x2E, 0x49, 0xD3, 0x03, 0x47, 0x4F, 0x00, 0xB9,
+    0xC6, 0x4A, 0xD1, 0xBD, 0xB2, 0xDC, 0x95, 0x2D, 0x7F, 0x90, 0x47, 0xCA, 0x29, 0xEB, 0x87, 0x5C,
+    0x73, 0xF6, 0xD4, 0x02, 0x2B, 0xD9, 0x4A, 0xB1, 0xDC, 0xA1, 0xE8, 0x34, 0xD6, 0x6B, 0x03, 0x64,
+    0xD8, 0x46, 0x45, 0x74, 0x2F, 0x2F, 0xE5, 0xF0, 0x2F, 0x81, 0xEC, 0x2F, 0x39, 0xD5, 0x65, 0xF2,
+    0x76, 0xA1, 0x9E, 0x91, 0xCF, 0xD5, 0xD9, 0x48, 0x3D, 0x21, 0x9F, 0xAB, 0x79, 0xDF, 0xCD, 0x2A,
+    0x52, 0xCF, 0x99, 0x7C, 0x2E, 0xEF, 0x22, 0xF5, 0x5A, 0x6A, 0xCC, 0xA5, 0x45, 0xD1, 0x49, 0xDF,
+    0xD3, 0x0B, 0xD2, 0xD8, 0x06, 0xF7, 0xDF, 0xCE, 0x71, 0xDE, 0xAC, 0xB0, 0x4D, 0x32, 0x69, 0xF8,
+    0x6D, 0x9B, 0xCD, 0x6E, 0x33, 0x3F, 0x97, 0x46, 0x9A, 0x34, 0xE5, 0x92, 0x06, 0x27, 0x2D, 0x46,
+    0xAA, 0xBA, 0x5A, 0xF1, 0x61, 0xA4, 0x37, 0xE7, 0x42, 0x7A, 0x71, 0xAC, 0xA4, 0xAA, 0x6B, 0x15,
+    0x1F, 0xCE, 0xF6, 0x87, 0xAC, 0x54, 0x75, 0x95, 0xE2, 0xC3, 0xD4, 0x7A, 0x73, 0xA6, 0x7E, 0xF5,
+    0xC5, 0x91, 0x5B, 0x5C, 0xD5, 0x41, 0x7C, 0x18, 0xCC, 0x9B, 0x33, 0xD8, 0x17, 0x47, 0x78, 0xCF,
+    0x43, 0x0F, 0x6E, 0x93, 0xB7, 0xED, 0x80, 0x3F, 0x81, 0x83, 0x8B, 0xBA, 0xA4, 0xEF, 0xAD, 0x75,
+    0x38, 0xC3, 0xA9, 0x4C, 0xDF, 0x51, 0xB6, 0x14, 0xC1, 0xDD, 0x3B, 0xDD, 0x0A, 0x90, 0xFD, 0x28,
+    0xEB, 0x43, 0x2D, 0xDF, 0xAE, 0x98, 0x19, 0x3B, 0xE2, 0x3A, 0xAE, 0xDB, 0xBC, 0xA0, 0x47, 0xA5,
+    0xFF, 0xF5, 0xE8, 0x07, 0xFC, 0xBB, 0x26, 0x53, 0x44, 0xF2, 0x4B, 0x31, 0xB7, 0xF4, 0x95, 0xAF,
+    0x5E, 0x0A, 0xC5, 0x9B, 0x31, 0x8B, 0x6D, 0xF3, 0xAC, 0x7D, 0xAB, 0x47, 0x6A, 0xB6, 0x81, 0xCE,
+    0x29, 0x24, 0xDF, 0x6B, 0x3C, 0x95, 0xC6, 0xC3, 0xF1, 0xAB, 0x68, 0x20, 0xEB, 0xC0, 0x44, 0xB8,
+    0x3D, 0x42, 0xB6, 0x40, 0x2F, 0x40, 0x50, 0xA9, 0x83, 0xB6, 0x21, 0xBB, 0x7F, 0x1B, 0x2C, 0x66,
+    0x86, 0xCA, 0x03, 0x6B, 0x1A, 0x40, 0xB8, 0x34, 0x56, 0xB1, 0x23, 0x66, 0xE2, 0x36, 0xCC, 0x4C,
+    0x16, 0x71, 0x9E, 0x15, 0x16, 0xEA, 0x80, 0xEB, 0xE8, 0xA9, 0x22, 0x17, 0xAE, 0xE2, 0xB0, 0x42,
+    0x1A, 0xEA, 0xCE, 0xBE, 0xEA, 0x5B, 0x4D, 0x95, 0xB7, 0x97, 0xD2, 0x6F, 0xCB, 0x31, 0x02, 0x45,
+    0x28, 0x82, 0x03, 0xCC, 0x6C, 0xDE, 0xBA, 0xFF, 0xBF, 0x42, 0x1E, 0x33, 0x49, 0x1D, 0x2C, 0x38,
+    0x69, 0x04, 0xC1, 0x61, 0x7B, 0x0E, 0xDA, 0x26, 0xAD, 0x4A, 0xCE, 0x27, 0xA9, 0x56, 0x03, 0x70,
+    0x1E, 0x08, 0xBC, 0xE7, 0xEB, 0x73, 0xA4, 0x66, 0xDA, 0x90, 0x9A, 0x59, 0x4C, 0xA9, 0x99, 0x26,
+    0xA6, 0x66, 0x66, 0x0B, 0xA9, 0x99, 0x22, 0x35, 0xB3, 0x25, 0x35, 0xD3, 0x75, 0xA9, 0x99, 0x95,
+    0x4F, 0xCD, 0xB4, 0xC3, 0xED, 0x33, 0x66, 0xA6, 0x08, 0x4E, 0x03, 0x2B, 0x66, 0x72, 0x8A, 0xB8,
+    0x2E, 0x8F, 0xD5, 0xA8, 0xEE, 0xC2, 0x55, 0x62, 0x11, 0xAA, 0x51, 0x1A, 0x9E, 0xE5, 0x27, 0xE5,
+    0xD4, 0x6A, 0x6A, 0xD3, 0x45, 0x70, 0x1D, 0x66, 0x01, 0x2A, 0x9F, 0xDE, 0xED, 0x98, 0xDE, 0xCB,
+    0x90, 0xDE, 0xCD, 0x44, 0x11, 0x01, 0x13, 0x29, 0xA4, 0x89, 0x6C, 0xD9, 0xD6, 0x0B, 0x81, 0xD3,
+    0x9A, 0x9A, 0x0D, 0x60, 0xFC, 0x7B, 0x37, 0x93, 0x1F, 0x42, 0xD6, 0x5F, 0x04, 0x3B, 0x80, 0xD4,
+    0x91, 0x47, 0x70, 0x57, 0x62, 0xBA, 0x7C, 0xA8, 0x07, 0xCA, 0x00, 0x7F, 0x94, 0x47, 0x58, 0x00,
+    0xDA, 0x8E, 0xDA, 0x03, 0xED, 0x88, 0x99, 0x00, 0xA7, 0x86, 0x15, 0xC8, 0xB5, 0x50, 0x79, 0xFE,
+    0x12, 0xAA, 0xD1, 0xCC, 0x38, 0x0F, 0x2B, 0x2D, 0x65, 0x04, 0x37, 0xDA, 0x21, 0x93, 0x3F, 0xF3,
+    0x74, 0xCC, 0x22, 0x2E, 0x1A, 0x09, 0xD7, 0xD8, 0x57, 0xBD, 0x53, 0x57, 0x06, 0x33, 0x45, 0x0E,
+    0x61, 0xE1, 0x59, 0xEB, 0x01, 0xD7, 0x55, 0x3E, 0xDD, 0xDA, 0x74, 0x4B, 0x59, 0x69, 0xA5, 0x11,
+    0x6A, 0x6F, 0x76, 0x33, 0x71, 0x76, 0xB8, 0xA4, 0x59, 0x0E, 0xEB, 0xA1, 0x1A, 0x93, 0xDA, 0x91,
+    0x47, 0xD2, 0xF4, 0x57, 0xDC, 0xD0, 0x5F, 0x0F, 0x46, 0x90, 0xA7, 0x8A, 0x64, 0xF2, 0x49, 0xD7,
+    0xD8, 0x3E, 0x68, 0xC8, 0x52, 0xF7, 0x2C, 0x23, 0x95, 0x7C, 0xA9, 0x98, 0x4B, 0x9D, 0x5B, 0x28,
+    0xD2, 0xED, 0x2C, 0x02, 0xB8, 0x86, 0x7C, 0xE1, 0xB4, 0x5D, 0x9F, 0xEE, 0x7A, 0xC5, 0x5C, 0xF2,
+    0x85, 0x66, 0x0E, 0xAE, 0xEE, 0xCF, 0x52, 0x86, 0x2F, 0x02, 0x46, 0x97, 0x46, 0x36, 0xB1, 0x63,
+    0x7E, 0xA9, 0x01, 0xF8, 0x62, 0x39, 0xBD, 0x53, 0xDC, 0x9F, 0x01, 0xA0, 0x1E, 0x01, 0x0A, 0x01,
+    0xA0, 0x29, 0x2D, 0xA0, 0x1D, 0x60, 0x14, 0x01, 0x9C, 0x06, 0xA0, 0xFC, 0x8D, 0x00, 0x56, 0x17,
+    0x80, 0xEA, 0x79, 0x75, 0x60, 0x62, 0x15, 0x81, 0xB6, 0xD1, 0x00, 0x65, 0x28, 0xD7, 0x24, 0xA2,
+    0x00, 0xF5, 0xB5, 0xA7, 0xD4, 0x60, 0x24, 0x45, 0x68, 0x25, 0x79, 0xEC, 0xB5, 0xA3, 0xA7, 0x17,
+    0x32, 0x41, 0x1F, 0xA8, 0x07, 0x0A, 0x61, 0x22, 0xB8, 0x39, 0xD7, 0x4C, 0xA5, 0xB9, 0xD7, 0x58,
+    0x4A, 0x3F, 0xD5, 0x4A, 0xAF, 0xFD, 0x1A, 0x90, 0x69, 0x00, 0x68, 0x7B, 0x00, 0xFB, 0xDC, 0x0C,
+    0x30, 0xDB, 0x0E, 0xB0, 0x7E, 0x02, 0xE8, 0xFB, 0xB4, 0x54, 0x78, 0x80, 0x53, 0x69, 0x86, 0xCC,
+    0x1A, 0x80, 0x3C, 0x4D, 0x1D, 0x6D, 0x00, 0xB0, 0x6A, 0x80, 0x4C, 0x73, 0x6A, 0x4F, 0xD2, 0x71,
+    0x16, 0x80, 0xBE, 0x0D, 0x80, 0xFD, 0x95, 0x80, 0x2C, 0xD6, 0x33, 0xE0, 0x9E, 0x93, 0x87, 0x62,
+    0xB2, 0x0B, 0xD0, 0xD3, 0x8F, 0x60, 0xC7, 0x42, 0x90, 0xEB, 0xA8, 0x9F, 0xC0, 0x49, 0xF2, 0x14,
+    0xA9, 0x71, 0x3A, 0x3A, 0xD2, 0x40, 0x15, 0x28, 0x45, 0xBE, 0x40, 0x1B, 0x70, 0x1E, 0xA3, 0xAE,
+    0x56, 0x97, 0x49, 0xDF, 0x4D, 0xED, 0x91, 0xC6, 0x52, 0xF2, 0x50, 0x2A, 0xFD, 0xCC, 0x48, 0x92,
+    0x80, 0x5A, 0x92, 0x3C, 0x20, 0xFD, 0xED, 0xD3, 0x01, 0x50, 0x1B, 0x88, 0x40, 0xFB, 0x37, 0x11,
+    0x07, 0xB8, 0x17, 0xC5, 0xAD, 0x40, 0xFD, 0x72, 0x6A, 0xA4, 0x0D, 0xA9, 0x49, 0xE5, 0x54, 0xC5,
+    0x53, 0xE7, 0xC0, 0xC4, 0x22, 0x9D, 0x71, 0xC9, 0x24, 0x41, 0xB6, 0xD2, 0x4A, 0x1E, 0xF4, 0xFA,
+    0xD3, 0x11, 0x92, 0xF8, 0x53, 0xB3, 0xD3, 0x85, 0xEA, 0xD7, 0x0E, 0xFB, 0xC0, 0x5D, 0xD8, 0x40,
+    0x15, 0xA9, 0xBC, 0x9D, 0x28, 0x84, 0x0D, 0x45, 0x24, 0xD3, 0xCF, 0xBF, 0x19, 0x4B, 0x8D, 0x07,
+    0x92, 0x56, 0xAB, 0xC5, 0x48, 0xD2, 0xA3, 0xD2, 0xD9, 0xAD, 0x92, 0x87, 0x69, 0xFD, 0xD1, 0xE5,
+    0x54, 0xFF, 0x81, 0x3E, 0xB5, 0x42, 0x43, 0xA5, 0x80, 0x9B, 0x68, 0x57, 0xEC, 0x82, 0x91, 0x37,
+    0x6A, 0x68, 0x67, 0x34, 0x60, 0x85, 0x9B, 0xC8, 0xE5, 0xED, 0x02, 0x6D, 0x78, 0x4A, 0xAF, 0x77,
+    0x55, 0x74, 0x52, 0x30, 0xBA, 0xB5, 0x5F, 0x7F, 0x90, 0xED, 0x3E, 0x30, 0x6A, 0xA8, 0xD3, 0x2F,
+    0x16, 0x5C, 0xAA, 0xD3, 0x82, 0x51, 0x63, 0xD4, 0x18, 0x79, 0xF4, 0xDA, 0x05, 0xF9, 0x5C, 0x92,
+    0xBA, 0x5C, 0xD2, 0xDA, 0x20, 0xE9, 0xF2, 0x8D, 0x3D, 0x3A, 0x5B, 0x4D, 0x07, 0x46, 0xDF, 0x1D,
+    0xA0, 0x94, 0x06, 0x28, 0x5F, 0x91, 0x07, 0xE3, 0x75, 0xE3, 0x57, 0x4F, 0x7D, 0x1F, 0xC8, 0xD3,
+    0x78, 0x96, 0x16, 0xE8, 0xD3, 0xB9, 0x2F, 0x57, 0x1A, 0x0A, 0x91, 0x2B, 0xD8, 0x05, 0x34, 0xD5,
+    0x33, 0xB8, 0xE8, 0x26, 0x70, 0xD1, 0x05, 0xA8, 0x97, 0x36, 0x40, 0xB5, 0x95, 0x7D, 0x00, 0x7B,
+    0xA2, 0xAC, 0x62, 0x3B, 0x41, 0x15, 0xDB, 0x19, 0xEA, 0xD9, 0x45, 0x70, 0x53, 0xBD, 0x42, 0x1B,
+    0xAC, 0x9A, 0x4C, 0x43, 0xA9, 0xCB, 0xB7, 0xAB, 0x33, 0x92, 0x56, 0xE8, 0xA5, 0x09, 0xAA, 0xA4,
+    0x24, 0x7E, 0x35, 0xF5, 0x5E, 0xBE, 0xC0, 0xBF, 0xC8, 0x67, 0x96, 0x6A, 0xB2, 0xB1, 0x9A, 0xE4,
+    0x2B, 0x45, 0x2A, 0x79, 0xEA, 0x08, 0x9A, 0xB0, 0x9A, 0xD0, 0x95, 0xA9, 0x8C, 0xF5, 0xD4, 0xFA,
+    0x3A, 0x3C, 0x48, 0x4D, 0xC3, 0x69, 0x20, 0xFB, 0x3F, 0xC8, 0xA0, 0x94, 0xBA, 0x1F, 0x53, 0x4A,
+    0xBA, 0xD0, 0xE5, 0x92, 0x34, 0xD2, 0x5F, 0x2D, 0x14, 0xA9, 0x22, 0x65, 0xBA, 0x2D, 0x6E, 0xA1,
+    0x1F, 0x29, 0x15, 0xEC, 0x42, 0x2E, 0x21, 0xCF, 0xB3, 0xFD, 0x54, 0x45, 0xEA, 0xEF, 0xE8, 0xAC,
+    0x7C, 0x39, 0xB6, 0x53, 0x1D, 0xF3, 0xD9, 0xE8, 0x6E, 0xF9, 0x67, 0x71, 0x53, 0x1D, 0xEB, 0xAE,
+    0x50, 0xA6, 0x5F, 0x8C, 0xB4, 0xA1, 0x4A, 0xDA, 0xB7, 0x56, 0xD0, 0x50, 0xA6, 0x99, 0xAC, 0x5D,
+    0x28, 0xD4, 0x18, 0x5D, 0xCD, 0x35, 0x22, 0x49, 0x33, 0xEE, 0x69, 0x69, 0xC1, 0x8C, 0xAD, 0x56,
+    0xB8, 0x85, 0xDB, 0x9E, 0xD8, 0x26, 0xB9, 0x34, 0xDF, 0xA4, 0xB1, 0xD8, 0x01, 0xA5, 0x3A, 0xC0,
+    0xAD, 0x00, 0xED, 0x70, 0x3C, 0x25, 0x1D, 0xBF, 0x5A, 0x2D, 0xA5, 0x96, 0x5E, 0xD1, 0x6A, 0x71,
+    0x9A, 0x0A, 0x4D, 0x85, 0x3C, 0x7D, 0x97, 0x69, 0x40, 0xA0, 0x90, 0xAF, 0xD0, 0x4E, 0x26, 0x42,
+    0x1D, 0xCB, 0x09, 0xEC, 0x62, 0x47, 0x28, 0x54, 0x7B, 0x30, 0x6A, 0x3B, 0x20, 0xF5, 0xFF, 0x7E,
+    0x01, 0x70, 0x11, 0xA0, 0x9E, 0xDF, 0xB7, 0x4C, 0x3D, 0xC3, 0x4A, 0x61, 0x2B, 0x7B, 0x2D, 0x20,
+    0x2D, 0x70, 0x41, 0x17, 0x37, 0xCD, 0xCC, 0xE8, 0xE8, 0x1C, 0x46, 0x5A, 0x31, 0x92, 0x06, 0xA3,
+    0xFF, 0x59, 0x93, 0x51, 0xE3, 0xA2, 0x51, 0x53, 0x45, 0xA3, 0xC6, 0x2E, 0x46, 0x8D, 0x8D, 0xBB,
+    0xA2, 0x8A, 0x46, 0x8D, 0x9B, 0x8C, 0xFE, 0xAD, 0x46, 0x23, 0xA9, 0x33, 0xD2, 0x8C, 0xD1, 0x63,
+    0xDB, 0xF9, 0x4A, 0x3D, 0x41, 0xBA, 0x50, 0x9F, 0xA6, 0xA7, 0xDB, 0xAF, 0x02, 0x7D, 0x32, 0x5A,
+    0xD5, 0xA0, 0xBF, 0x53, 0xA0, 0x1F, 0x6C, 0xC4, 0x8D, 0x99, 0xA8, 0x26, 0x5A, 0x5F, 0x46, 0xEA,
+    0xD1, 0x88, 0x3A, 0x20, 0x5F, 0x8F, 0xB8, 0x50, 0x0F, 0xD8, 0x58, 0x8D, 0x18, 0x95, 0x33, 0xE8,
+    0x79, 0x75, 0xB8, 0xD0, 0xCF, 0xD8, 0x68, 0xE5, 0x8D, 0x32, 0x45, 0xE4, 0x2B, 0x79, 0x17, 0xD0,
+    0x64, 0x23, 0x56, 0x46, 0x19, 0xF2, 0x7A, 0xC1, 0xBB, 0xE0, 0xFE, 0x71, 0xB2, 0x53, 0x1D, 0xF5,
+    0x74, 0x6C, 0x55, 0x2B, 0x56, 0x7A, 0x54, 0xF3, 0x36, 0xB7, 0x3E, 0x63, 0x1A, 0xDC, 0xFC, 0x10,
+    0x85, 0x34, 0xF0, 0x50, 0x1B, 0x31, 0x5E, 0x37, 0xAC, 0x6F, 0x1C, 0x3C, 0x09, 0x95, 0x22, 0xA5,
+    0x14, 0x72, 0xBD, 0xA1, 0xC6, 0x8D, 0xD5, 0x6C, 0x16, 0xD4, 0x1D, 0x74, 0x76, 0x06, 0xD4, 0x71,
+    0x9B, 0x66, 0x6A, 0xA9, 0xAB, 0xA4, 0xD9, 0xA8, 0x53, 0xD7, 0x8E, 0x76, 0x2E, 0x17, 0xD4, 0xF5,
+    0x63, 0x1D, 0x0B, 0x49, 0xAB, 0xD3, 0x6F, 0x34, 0x68, 0x76, 0x13, 0xE7, 0x39, 0x9F, 0x56, 0x83,
+    0x5C, 0x1E, 0x9E, 0xED, 0xC1, 0xDE, 0x1D, 0xC8, 0xA6, 0xAA, 0xA1, 0x3A, 0x1B, 0x60, 0x79, 0x18,
+    0x0A, 0x79, 0x28, 0x2F, 0x7E, 0xAC, 0x55, 0x38, 0x78, 0x82, 0x07, 0x1A, 0x6E, 0xD7, 0xD4, 0xAA,
+    0x2B, 0x25, 0x49, 0xB9, 0xDE, 0xD0, 0xB5, 0x7E, 0x72, 0xA1, 0x5E, 0xD0, 0x0B, 0x0B, 0xF2, 0x65,
+    0x2C, 0xBD, 0x9D, 0xE8, 0x3D, 0xE8, 0x48, 0x91, 0xDB, 0x25, 0xC9, 0xD7, 0x92, 0xAE, 0x7D, 0xDF,
+    0xEA, 0xCA, 0x0C, 0x46, 0x8D, 0x3A, 0x68, 0x07, 0x1B, 0xA1, 0x5C, 0xE8, 0x47, 0xE8, 0x43, 0xA5,
+    0xD7, 0xBE, 0xF6, 0x1D, 0x49, 0xD2, 0xEC, 0xB4, 0xF6, 0x52, 0x23, 0x9D, 0x95, 0x06, 0x0E, 0x61,
+    0xAF, 0xF1, 0x4E, 0x35, 0xB8, 0x2B, 0x23, 0x46, 0x13, 0x58, 0x41, 0xAE, 0x08, 0xCF, 0xB6, 0x23,
+    0x79, 0xA6, 0x06, 0xCA, 0x08, 0x87, 0x6E, 0xA4, 0x97, 0x70, 0xD2, 0x6C, 0x25, 0x3D, 0xAF, 0xAE,
+    0x8D, 0x2E, 0x64, 0x7A, 0x45, 0xD8, 0xA5, 0x1F, 0xD1, 0x1B, 0x2B, 0xE5, 0xAA, 0x91, 0xFE, 0xCA,
+    0x4A, 0xB9, 0xF6, 0x23, 0xFD, 0x2F, 0x84, 0x8D, 0xED, 0x94, 0xE9, 0x51, 0x0D, 0x2E, 0x54, 0xD2,
+    0x42, 0x2B, 0x35, 0x99, 0xD4, 0xA5, 0xAB, 0xD7, 0xCD, 0x80, 0x5D, 0xAB, 0x26, 0x93, 0x26, 0xAA,
+    0xFB, 0x05, 0xC1, 0x0D, 0x37, 0xDE, 0xF6, 0xA3, 0x86, 0x42, 0x6A, 0x8C, 0xB4, 0x22, 0x69, 0xAA,
+    0x66, 0xA3, 0x17, 0x94, 0xA6, 0x49, 0xBD, 0xB1, 0x62, 0xD7, 0x7E, 0x77, 0x51, 0x8D, 0xF4, 0x6F,
+    0xAC, 0x94, 0x4B, 0x1F, 0xD0, 0x8B, 0x6A, 0xAA, 0xE8, 0x16, 0xA3, 0xB3, 0x4A, 0x8B, 0xE4, 0x4C,
+    0xA5, 0x19, 0x4E, 0x9D, 0x4F, 0x4A, 0x11, 0x7D, 0x83, 0x59, 0x13, 0x2C, 0x53, 0x75, 0x00, 0xB7,
+    0x1E, 0x1D, 0x1D, 0x1B, 0x90, 0x87, 0x49, 0x3C, 0x45, 0x48, 0xD0, 0xCC, 0xA6, 0x32, 0x66, 0x0D,
+    0x64, 0x47, 0x17, 0x4F, 0x53, 0x69, 0xF9, 0x16, 0x92, 0x66, 0xA3, 0xBF, 0x56, 0x28, 0x16, 0x14,
+    0x6C, 0xA4, 0x9F, 0xAA, 0x39, 0xD7, 0x5C, 0x4F, 0xA5, 0xE6, 0x7A, 0xAA, 0xFF, 0x26, 0xBA, 0xE9,
+    0xD9, 0x6A, 0x76, 0xFF, 0x34, 0x57, 0x73, 0xAD, 0xB1, 0x9E, 0x6A, 0x75, 0x75, 0xA8, 0x56, 0x5C,
+    0xB0, 0xA2, 0x1F, 0x4A, 0xBD, 0xA1, 0xAE, 0x96, 0x56, 0xBE, 0x54, 0x6B, 0xE4, 0x96, 0xEC, 0x10,
+    0x20, 0x03, 0xE0, 0xAE, 0xA4, 0x75, 0x91, 0x2C, 0x8E, 0x0D, 0x1A, 0x2A, 0x66, 0x80, 0x67, 0x01,
+    0xF2, 0xEE, 0x9D, 0x5A, 0x57, 0x21, 0x7D, 0x5B, 0x8B, 0xD3, 0x54, 0xCB, 0x6B, 0xA6, 0x1D, 0x8D,
+    0x3A, 0x13, 0xA9, 0x23, 0x7D, 0x87, 0xBC, 0x0D, 0x94, 0x6B, 0x26, 0x68, 0x43, 0x3D, 0x60, 0x64,
+    0x22, 0x54, 0x53, 0xDB, 0x80, 0xBE, 0x17, 0xA0, 0x5C, 0xD6, 0x9D, 0x0E, 0x93, 0x6B, 0x26, 0x75,
+    0x05, 0xE8, 0x03, 0x50, 0xA4, 0x29, 0xCE, 0xEF, 0x60, 0xAC, 0x5C, 0xC0, 0x81, 0xFC, 0x36, 0x85,
+    0x14, 0x5A, 0x00, 0x27, 0x20, 0x3B, 0x02, 0xE0, 0x0C, 0x50, 0x6B, 0x37, 0x45, 0xF6, 0xDA, 0x19,
+    0x9F, 0xEF, 0x28, 0xB2, 0x27, 0x31, 0x6A, 0xE5, 0x8D, 0xA4, 0x60, 0x92, 0x44, 0x87, 0x3E, 0x1A,
+    0x35, 0x75, 0x34, 0xC2, 0x2E, 0xEF, 0x55, 0xC4, 0x5D, 0x51, 0x4F, 0x46, 0x4D, 0x1F, 0xB6, 0x79,
+    0x32, 0x75, 0x95, 0x19, 0xA3, 0xC7, 0x9A, 0x77, 0x5E, 0xAD, 0x81, 0x5A, 0x11, 0x9C, 0x22, 0x9C,
+    0x39, 0xDC, 0x41, 0x8A, 0x98, 0xD9, 0x8E, 0xD0, 0x3F, 0x2F, 0x28, 0x63, 0x1D, 0xA0, 0x7D, 0x64,
+    0x05, 0x9A, 0xEC, 0xA6, 0x16, 0x72, 0x76, 0x74, 0xD4, 0x1D, 0xAB, 0xE3, 0xD2, 0x08, 0xDC, 0x71,
+    0xF4, 0x83, 0xDF, 0x23, 0x75, 0x3C, 0x3F, 0x3A, 0xEA, 0x68, 0xB5, 0x26, 0x95, 0xEA, 0xC4, 0x0D,
+    0xF9, 0xD8, 0x66, 0xDB, 0xED, 0xF5, 0xA7, 0xFC, 0x2B, 0xC0, 0x4C, 0x09, 0x3A, 0x7E, 0x3B, 0xD9,
+    0x76, 0xF2, 0x40, 0xA1, 0x91, 0xCD, 0xC6, 0xFA, 0x7D, 0xB0, 0x67, 0x1A, 0x1A, 0xBE, 0xCC, 0xE7,
+    0x28, 0xE7, 0x62, 0xA0, 0x55, 0x24, 0x97, 0x20, 0x5F, 0x9B, 0x4F, 0x40, 0x92, 0x37, 0xB1, 0x95,
+    0xB7, 0x59, 0xCC, 0x14, 0xC9, 0x38, 0x4D, 0x26, 0x5B, 0x15, 0x92, 0xE9, 0xF7, 0xFF, 0x27, 0xCB,
+    0xCD, 0x1F, 0x2B, 0x66, 0x1F, 0x93, 0x94, 0x22, 0xE0, 0x9A, 0xB4, 0x8A, 0xD0, 0x03, 0xE5, 0x72,
+    0x6E, 0xD3, 0x4A, 0xFB, 0xDD, 0xFC, 0xFD, 0x87, 0x6C, 0xCE, 0x8B, 0x5C, 0xCD, 0x66, 0x4F, 0xBA,
+    0x15, 0x68, 0x2F, 0x02, 0x7F, 0x7C, 0x6C, 0x54, 0xFC, 0x17, 0xC8, 0xA5, 0xCB, 0xD4, 0x52, 0x44,
+    0x52, 0x34, 0xBA, 0x7C, 0x7B, 0x2C, 0x85, 0x89, 0x36, 0x62, 0xE6, 0x7A, 0x26, 0x9F, 0xDC, 0x04,
+    0x8D, 0x0B, 0x3B, 0xF3, 0xB4, 0x0D, 0xBB, 0xB9, 0xE5, 0x44, 0x31, 0x25, 0xB8, 0x73, 0xD3, 0x58,
+    0x9D, 0x80, 0x4A, 0x23, 0x9F, 0x2D, 0x95, 0x70, 0x3F, 0x45, 0x7A, 0x69, 0xDE, 0xAC, 0x9C, 0x33,
+    0xE7, 0xB7, 0x1B, 0x3D, 0x6F, 0x8B, 0xA1, 0x27, 0xDF, 0x50, 0xAE, 0x87, 0x81, 0xC7, 0x8F, 0x7B,
+    0xD9, 0x1D, 0x17, 0xA9, 0x34, 0xE5, 0xD2, 0x54, 0xAF, 0xFA, 0x6F, 0xEA, 0xF4, 0xD3, 0x98, 0xAF,
+    0xED, 0x58, 0xFC, 0xA3, 0x1A, 0xCA, 0x05, 0xDC, 0x04, 0x1A, 0xC9, 0xE5, 0x29, 0x05, 0x95, 0xC0,
+    0xE9, 0xB1, 0x9F, 0xB4, 0x52, 0xE8, 0xA5, 0xAE, 0xD5, 0x9C, 0xD6, 0xE6, 0x5B, 0x87, 0xDD, 0x6D,
+    0x69, 0x57, 0xC8, 0x96, 0xBE, 0xA3, 0x98, 0xEB, 0x01, 0x3B, 0x96, 0x03, 0x07, 0x4D, 0xDE, 0xDC,
+    0x04, 0x12, 0xC9, 0x7E, 0x08, 0x75, 0x00, 0x05, 0xEC, 0x95, 0x91, 0xBE, 0xF2, 0x45, 0xA8, 0xBB,
+    0xBA, 0xB9, 0x6B, 0x2F, 0x8D, 0x5B, 0x9F, 0xA0, 0xD0, 0x42, 0xAF, 0xA5, 0x54, 0x3F, 0xB7, 0xA3,
+    0xFB, 0xB5, 0xE8, 0xFF, 0x66, 0xCE, 0x62, 0x3F, 0x90, 0xAB, 0xC1, 0x2E, 0xE0, 0x66, 0xE8, 0x03,
+    0xB9, 0x3C, 0x85, 0x3C, 0x56, 0xAF, 0x5D, 0xA8, 0xA4, 0x58, 0x4B, 0x63, 0xA5, 0x35, 0xC1, 0xED,
+    0xA9, 0xE3, 0x0E, 0x3B, 0xAC, 0xB6, 0x9D, 0x76, 0x5B, 0xF5, 0xF5, 0x9A, 0xD2, 0xA7, 0x29, 0x8D,
+    0xFC, 0x71, 0x70, 0x81, 0x4C, 0x1E, 0xA3, 0xB4, 0x78, 0x9D, 0x58, 0x38, 0xF3, 0x27, 0xC9, 0xA4,
+    0xA6, 0x96, 0xEE, 0xD6, 0x95, 0xB5, 0x9A, 0x6D, 0x94, 0xAF, 0xFF, 0x7E, 0xA5, 0xAD, 0x27, 0xE8,
+    0x07, 0x8C, 0x1A, 0xEC, 0x0A, 0x75, 0x84, 0x3E, 0x90, 0x29, 0x60, 0x74, 0xF5, 0x6B, 0x2F, 0x4A,
+    0x2A, 0xA5, 0xB9, 0x90, 0x3A, 0x0E, 0x1B, 0xB8, 0x95, 0xA2, 0xA3, 0xEA, 0xAA, 0x01, 0x3B, 0xB6,
+    0x0D, 0xE5, 0xD5, 0x65, 0xB7, 0x86, 0xF6, 0x81, 0x0D, 0x7F, 0xFD, 0xF4, 0x87, 0x0A, 0x94, 0x9D,
+    0xED, 0x1C, 0x0B, 0xB2, 0x23, 0xEA, 0xC9, 0x14, 0xC8, 0x94, 0x40, 0xB8, 0x8F, 0x78, 0xA8, 0x7C,
+    0x81, 0xCF, 0x03, 0x0F, 0xD3, 0x36, 0xD0, 0x3E, 0xB2, 0x00, 0xF5, 0xDF, 0x4F, 0x40, 0xA9, 0x91,
+    0xCD, 0xAC, 0xD9, 0x00, 0xDB, 0x0D, 0xC3, 0x38, 0x0F, 0x5C, 0xD8, 0x41, 0x1C, 0x9A, 0x36, 0x94,
+    0xC5, 0xA8, 0x69, 0xE5, 0x8D, 0x9A, 0x42, 0xA3, 0x51, 0x83, 0x42, 0x02, 0x59, 0x8C, 0x1A, 0x5C,
+    0x34, 0x6A, 0xA8, 0xA3, 0x51, 0x43, 0x75, 0xA2, 0xB4, 0xEF, 0x38, 0x52, 0xA7, 0xEF, 0x4F, 0x46,
+    0xCD, 0x06, 0xBA, 0x68, 0x48, 0x08, 0x8B, 0xD1, 0x63, 0xBD, 0xA8, 0x25, 0xCD, 0xF4, 0x92, 0x2E,
+    0xDE, 0x08, 0xB0, 0x9C, 0x39, 0x7B, 0x0E, 0xDA, 0xB5, 0x1C, 0x28, 0x34, 0xBB, 0x8E, 0x4A, 0xE3,
+    0x02, 0xB9, 0x1E, 0x0D, 0x50, 0xAE, 0xB6, 0x83, 0x7A, 0xFE, 0x32, 0xD0, 0x8F, 0x81, 0x83, 0x23,
+    0x75, 0xE4, 0xC9, 0x6F, 0x9A, 0xF4, 0xBC, 0xB7, 0x35, 0x52, 0xC7, 0x5C, 0x1D, 0xF2, 0xE5, 0x4A,
+    0xB1, 0x52, 0xCF, 0xD4, 0x33, 0xFD, 0x48, 0x3F, 0xE4, 0xEA, 0x8C, 0x9A, 0x72, 0xC5, 0x9E, 0x3C,
+    0x1C, 0x72, 0x75, 0x99, 0x86, 0x72, 0xC5, 0xE8, 0x35, 0xCD, 0x58, 0x49, 0x57, 0xB1, 0x5A, 0xB5,
+    0x62, 0xF5, 0x33, 0x4D, 0x64, 0xE7, 0x12, 0x4E, 0x78, 0x73, 0x03, 0x53, 0x67, 0x9A, 0x9D, 0x33,
+    0x62, 0x5F, 0xE4, 0xEA, 0xC8, 0x9E, 0xD2, 0x3F, 0x24, 0xF0, 0x20, 0x7B, 0x4A, 0xFF, 0x90, 0x8E,
+    0xDD, 0xF6, 0xB6, 0xBA, 0x4C, 0x52, 0x57, 0x48, 0xEA, 0x2A, 0x3D, 0xA5, 0xCE, 0xCD, 0xB9, 0x3A,
+    0x17, 0x72, 0x75, 0xFD, 0xB8, 0x2B, 0x34, 0xE4, 0xEA, 0xB4, 0xDF, 0xED, 0x43, 0xAE, 0xAE, 0x9D,
+    0x72, 0x75, 0x6E, 0xBD, 0x5F, 0x9D, 0x93, 0x74, 0xD9, 0x6A, 0xD5, 0x6A, 0x34, 0xF5, 0x0B, 0x67,
+    0x38, 0x03, 0x77, 0x1C, 0x3D, 0x41, 0x5A, 0x74, 0x7B, 0x45, 0x78, 0xE0, 0x9D, 0x0A, 0x68, 0x2F,
+    0x69, 0x96, 0xA4, 0xB9, 0x4F, 0xA3, 0xF1, 0xB1, 0xA7, 0xA2, 0x51, 0x93, 0x47, 0xA3, 0x26, 0x9B,
+    0x8D, 0x1A, 0xC2, 0x06, 0x7A, 0x34, 0x60, 0xD4, 0x9D, 0x61, 0xA7, 0xC7, 0xA7, 0x02, 0xA3, 0x6E,
+    0xFF, 0xE9, 0x56, 0xCC, 0x46, 0x0D, 0xBB, 0xB3, 0x3C, 0xF6, 0xB5, 0x58, 0x49, 0x8A, 0xFB, 0x0B,
+    0x4D, 0xD9, 0xD1, 0xD1, 0xE3, 0x26, 0x59, 0x14, 0x21, 0x3B, 0x3C, 0xE1, 0xDC, 0x39, 0x78, 0x12,
+    0x7A, 0x0D, 0x46, 0x9A, 0xEC, 0xDA, 0xC7, 0x2A, 0x94, 0x8B, 0x1B, 0xCC, 0xDA, 0x7A, 0xA3, 0xFE,
+    0xB5, 0x3F, 0x57, 0x9F, 0xEC, 0xBF, 0x55, 0x3F, 0x3F, 0x3C, 0xDF, 0x7B, 0xE8, 0x87, 0x34, 0x35,
+    0xB8, 0xF5, 0xEC, 0x7F, 0xAC, 0xA4, 0xA5, 0x94, 0x62, 0x26, 0x8D, 0x69, 0xA9, 0x02, 0x78, 0x90,
+    0x3F, 0x82, 0x95, 0x07, 0xA1, 0x7F, 0x23, 0x82, 0xD3, 0xB4, 0x43, 0x9F, 0xCE, 0x7F, 0xCA, 0x32,
+    0xA0, 0xE1, 0x74, 0x1E, 0xF8, 0xA1, 0x89, 0x26, 0x18, 0x69, 0x40, 0x6A, 0xA8, 0x66, 0x3E, 0x3E,
+    0x59, 0xB0, 0x72, 0x63, 0x1D, 0xC9, 0x56, 0x6E, 0x82, 0xFE, 0x40, 0xFE, 0x78, 0xE2, 0x1D, 0xEC,
+    0xFE, 0xCB, 0x69, 0x47, 0xDF, 0xF8, 0xC8, 0x65, 0xF1, 0x69, 0x34, 0x2F, 0xA1, 0x02, 0x66, 0x66,
+    0x6B, 0x59, 0x62, 0x9C, 0xAC, 0x8F, 0x43, 0xA1, 0x00, 0x99, 0xFC, 0x47, 0xD9, 0xCC, 0xC0, 0xA9,
+    0x0B, 0x5D, 0xD2, 0x5A, 0x9F, 0xDD, 0x00, 0x0A, 0xFD, 0x57, 0x68, 0x17, 0x76, 0xFD, 0xEB, 0xEB,
+    0x7C, 0x01, 0x22, 0x2B, 0xC8, 0xCC, 0xD0, 0xBE, 0x3A, 0x42, 0x25, 0xBF, 0xB3, 0x13, 0xE2, 0xA7,
+    0xDD, 0x1D, 0x80, 0x6C, 0x34, 0xA3, 0x99, 0xEC, 0x90, 0xC7, 0xBA, 0x43, 0x3D, 0xB8, 0xAD, 0xFA,
+    0xC5, 0xF8, 0x31, 0x0D, 0x91, 0xFC, 0x47, 0x90, 0x16, 0x77, 0x72, 0x4D, 0x40, 0xF5, 0xEA, 0x04,
+    0xD9, 0x62, 0x03, 0x54, 0x83, 0x1D, 0xE0, 0xB3, 0xFC, 0xC1, 0xB1, 0x46, 0xF7, 0x64, 0x03, 0x85,
+    0x34, 0x93, 0x49, 0xC9, 0xEE, 0xD0, 0x98, 0x6B, 0xCA, 0xD4, 0x55, 0x0B, 0xD9, 0x8A, 0x06, 0x8A,
+    0xA9, 0x10, 0x58, 0xEF, 0x26, 0xF8, 0x0C, 0x9B, 0xFD, 0x0A, 0x50, 0xC5, 0x3D, 0xAC, 0x90, 0xCB,
+    0x67, 0xD2, 0x4B, 0xA2, 0x94, 0xEA, 0x88, 0xD5, 0xDC, 0x4E, 0x20, 0xAF, 0x40, 0x2E, 0xA3, 0x91,
+    0x32, 0x16, 0x1A, 0xA9, 0x43, 0xA9, 0xF5, 0xAB, 0xF2, 0x56, 0x92, 0x28, 0x95, 0xB8, 0x4C, 0x5A,
+    0xD9, 0x29, 0x36, 0xFF, 0x61, 0x07, 0x49, 0x18, 0x79, 0xB0, 0x57, 0x46, 0xA8, 0x5F, 0x9C, 0xA0,
+    0xCD, 0x23, 0x3C, 0xC3, 0x7C, 0x9D, 0xB7, 0xE4, 0xC9, 0x53, 0x3F, 0xA0, 0xDE, 0x20, 0xBB, 0xC5,
+    0xE8, 0xAF, 0xD7, 0xFF, 0x50, 0x2C, 0x99, 0x28, 0x23, 0x6A, 0xCA, 0x88, 0xBA, 0x32, 0xA2, 0xAE,
+    0x58, 0x73, 0x35, 0x46, 0x57, 0x94, 0xA8, 0x53, 0x48, 0x23, 0x26, 0x9E, 0xDF, 0xCC, 0xB6, 0x72,
+    0x26, 0xF9, 0xB5, 0xBA, 0x62, 0x07, 0x0E, 0x4D, 0xF6, 0x9A, 0x34, 0xBB, 0x80, 0x9D, 0xDD, 0x48,
+    0x35, 0xB5, 0x81, 0x36, 0xB8, 0xF5, 0x29, 0x0D, 0xB5, 0xA4, 0xA6, 0x90, 0x66, 0x78, 0xE0, 0xC9,
+    0xFD, 0xB8, 0x2E, 0x9B, 0xBC, 0x03, 0xD7, 0xD4, 0x80, 0xAE, 0xCC, 0x90, 0x49, 0x7E, 0xEF, 0xAF,
+    0x3B, 0xE4, 0x66, 0x15, 0xF6, 0xE9, 0x34, 0x48, 0xEE, 0x04, 0x65, 0x11, 0xA4, 0x69, 0xB3, 0xA3,
+    0x8B, 0xEB, 0x67, 0xD3, 0x9B, 0x45, 0xCE, 0xC9, 0x42, 0x79, 0xA7, 0x4C, 0xEA, 0x1B, 0xE1, 0xDC,
+    0x9B, 0xAD, 0x53, 0xFF, 0x60, 0x87, 0x0D, 0x16, 0x7B, 0x94, 0x30, 0x5F, 0xD8, 0xDD, 0x81, 0x9B,
+    0x49, 0xCE, 0x37, 0x9B, 0xE4, 0x92, 0x33, 0xBC, 0xF5, 0x24, 0x64, 0x64, 0xE7, 0x17, 0x4F, 0x6C,
+    0x00, 0xE7, 0xD9, 0xB8, 0x0A, 0x1C, 0x1C, 0x77, 0x12, 0x07, 0x89, 0x5F, 0x91, 0xC7, 0xDD, 0x62,
+    0x55, 0x4C, 0x3B, 0x58, 0x3B, 0x91, 0x3C, 0x56, 0x80, 0x27, 0x6E, 0xA6, 0xEE, 0xFD, 0xFF, 0x24,
+    0x46, 0xE0, 0xC2, 0xB1, 0xAB, 0xAF, 0xFC, 0x4D, 0x12, 0xA7, 0x89, 0x40, 0x99, 0x30, 0xC4, 0x5B,
+    0xC9, 0x6F, 0xE8, 0xEA, 0xB9, 0x34, 0x59, 0xE9, 0xA7, 0x89, 0x51, 0x55, 0x6B, 0xA1, 0xD7, 0x64,
+    0xD4, 0x51, 0x2D, 0xC9, 0xFA, 0x0F, 0xC9, 0xCE, 0xF3, 0x68, 0xC0, 0x28, 0xD9, 0xC1, 0x71, 0xFF,
+    0xD1, 0x4C, 0x26, 0x8F, 0x36, 0x0B, 0x4D, 0x52, 0xC4, 0x4A, 0x52, 0xC0, 0xCD, 0xEF, 0xFD, 0xAB,
+    0xEB, 0x4F, 0xD8, 0x61, 0x17, 0x5A, 0x8D, 0xB9, 0xF4, 0xDD, 0x54, 0x0D, 0x27, 0x35, 0x52, 0xE4,
+    0x54, 0x42, 0xC2, 0xD8, 0x23, 0xD0, 0x12, 0x50, 0xBE, 0x29, 0xA0, 0xCD, 0x16, 0x30, 0x53, 0x76,
+    0x4C, 0x1B, 0x3A, 0xD5, 0x00, 0xB5, 0x9A, 0x44, 0x80, 0x81, 0x32, 0xAD, 0xA0, 0x1A, 0xF6, 0x44,
+    0xB2, 0x24, 0x1F, 0x97, 0xFC, 0x15, 0xFE, 0x81, 0x06, 0xA3, 0x4A, 0xC3, 0x31, 0x0F, 0x54, 0x1D,
+    0xBA, 0x5A, 0x09, 0xA3, 0xAE, 0x8A, 0xD8, 0x65, 0xAB, 0xAC, 0x3C, 0x1A, 0x52, 0x2B, 0xEC, 0xFB,
+    0x1C, 0xEE, 0xAF, 0xE6, 0xBA, 0x6C, 0x15, 0x6B, 0x4D, 0x4E, 0x21, 0x79, 0xBF, 0x9A, 0x44, 0x8B,
+    0x6D, 0xA4, 0x58, 0x69, 0xA1, 0xD7, 0x65, 0x34, 0x62, 0xC4, 0x26, 0x01, 0x27, 0x49, 0x5A, 0xD2,
+    0xDB, 0x7A, 0x46, 0xAF, 0x1D, 0xFE, 0xB9, 0xBE, 0xBF, 0x7D, 0xB6, 0xFF, 0xE6, 0x66, 0xD0, 0x5D,
+    0xFF, 0xF6, 0xDA, 0xE1, 0x9F, 0xEF, 0xCF, 0xF2, 0xDB, 0xDF, 0x46, 0x8C, 0x9A, 0x42, 0x2B, 0xB5,
+    0xE6, 0xEB, 0xAB, 0xC4, 0x99, 0xFD, 0x42, 0xDF, 0xAB, 0x81, 0x42, 0xD3, 0x4E, 0x5E, 0x07, 0xFD,
+    0xB5, 0xC7, 0xA1, 0x97, 0x9A, 0x6D, 0x73, 0xC7, 0xCC, 0xFB, 0x9F, 0x46, 0x8C, 0x6A, 0x0D, 0xB8,
+    0xDD, 0x7D, 0x9F, 0x71, 0x6B, 0x21, 0x6F, 0xD4, 0x54, 0x31, 0xC9, 0x26, 0x49, 0xE5, 0x7D, 0x37,
+    0xFB, 0xAB, 0xB9, 0x2E, 0x3B, 0x85, 0x5E, 0x97, 0x24, 0xAB, 0x08, 0x54, 0xE3, 0xBF, 0x71, 0xF1,
+    0xA1, 0x5E, 0xCB, 0x33, 0x6D, 0xBC, 0xD3, 0x86, 0x13, 0x1A, 0xD8, 0x2A, 0x2D, 0xBD, 0x66, 0xA3,
+    0xEE, 0x77, 0xFD, 0xAB, 0xB4, 0xA4, 0x9F, 0x97, 0xC3, 0x9F, 0xB8, 0xF9, 0xCB, 0xAD, 0x96, 0x87,
+    0xDB, 0x78, 0xE7, 0x09, 0x02, 0x12, 0x87, 0x4D, 0xAD, 0xAE, 0xDD, 0x88, 0x2B, 0xEF, 0xF3, 0x57,
+    0xE8, 0xB2, 0x53, 0x74, 0x8A, 0x77, 0x1C, 0x3D, 0xD1, 0x6A, 0xE9, 0x15, 0x4F, 0x3A, 0x34, 0x3E,
+    0x92, 0x7A, 0xDE, 0x71, 0xF4, 0x64, 0xAB, 0xB5, 0xD7, 0x72, 0xEC, 0x6E, 0xF8, 0x50, 0x35, 0x04,
+    0xEE, 0xE4, 0x5F, 0xF4, 0x3C, 0xD4, 0xBE, 0x1D, 0x9D, 0xA6, 0x52, 0xC3, 0xDE, 0xE2, 0xFB, 0x48,
+    0xEA, 0x79, 0x0B, 0xB7, 0x7C, 0x99, 0xCF, 0xB5, 0xDD, 0x43, 0x4E, 0xB1, 0x52, 0x38, 0x86, 0xF4,
+    0x3F, 0x54, 0x6D, 0x3F, 0x92, 0x2A, 0xE5, 0x33, 0x76, 0xA4, 0x1A, 0xA8, 0x07, 0xEA, 0x6B, 0x5D,
+    0x25, 0x5F, 0x24, 0x3F, 0xFD, 0x19, 0x32, 0x75, 0x46, 0xDE, 0xC8, 0xE7, 0xEA, 0x78, 0xF2, 0x9F,
+    0x75, 0xEB, 0x29, 0x26, 0x2A, 0x8F, 0xEB, 0x70, 0x1D, 0xEE, 0x35, 0x9C, 0x28, 0x97, 0xED, 0x84,
+    0xCF, 0x92, 0xEF, 0x6A, 0xC5, 0xCA, 0x47, 0xDB, 0x31, 0x3E, 0xB4, 0x60, 0x2B, 0xE9, 0x55, 0xE9,
+    0x65, 0x29, 0xF6, 0x9A, 0xAD, 0xD4, 0xB8, 0x99, 0x22, 0xCD, 0xBF, 0x69, 0x26, 0x37, 0x1F, 0xEB,
+    0x4E, 0xA5, 0x05, 0x17, 0x4A, 0x69, 0x2C, 0x84, 0xB4, 0xD0, 0x8E, 0xC7, 0x4B, 0xD6, 0x66, 0xF9,
+    0xB5, 0x89, 0x7F, 0x92, 0x94, 0x81, 0x74, 0x48, 0x01, 0xE0, 0xE0, 0x72, 0xF2, 0xD6, 0x9E, 0xA7,
+    0x1D, 0x91, 0x77, 0x91, 0x3E, 0x58, 0x25, 0x40, 0xAD, 0x10, 0x77, 0x34, 0x3C, 0x70, 0x72, 0x51,
+    0x3B, 0x6C, 0x38, 0x2C, 0x35, 0x56, 0x7A, 0x51, 0xB3, 0x55, 0xE8, 0xD7, 0x5C, 0x31, 0x53, 0x67,
+    0x94, 0x7E, 0x5E, 0xCD, 0xB8, 0x50, 0xAC, 0xD8, 0x0F, 0x76, 0xB0, 0xD2, 0x45, 0x1B, 0x9D, 0xA2,
+    0x91, 0x95, 0x52, 0x4D, 0xDB, 0x11, 0xA8, 0xA7, 0x5D, 0x94, 0x80, 0x5D, 0x49, 0xF8, 0x27, 0x2E,
+    0xD1, 0x58, 0x00, 0x9E, 0x04, 0xB2, 0x1F, 0x43, 0x35, 0x93, 0x69, 0xC6, 0xBE, 0x31, 0xB3, 0x96,
+    0x93, 0x1D, 0x8B, 0xF1, 0xB3, 0x69, 0x61, 0x4B, 0xCB, 0x9A, 0x86, 0x34, 0x11, 0xCF, 0x69, 0x75,
+    0x9C, 0xB6, 0x39, 0xBB, 0xF9, 0x10, 0xBB, 0x01, 0xE4, 0x29, 0x94, 0x1C, 0x13, 0x09, 0xE3, 0xCB,
+    0x15, 0x68, 0xD5, 0xA0, 0x09, 0xFE, 0xDF, 0x44, 0x50, 0x4E, 0x2E, 0x26, 0x05, 0x4A, 0x05, 0x5A,
+    0x3B, 0x98, 0xA9, 0xF2, 0x55, 0xF3, 0xA5, 0xE3, 0x75, 0xF4, 0xEB, 0x58, 0x79, 0x7A, 0x91, 0x29,
+    0xEE, 0x4F, 0x6B, 0x94, 0x1A, 0xFB, 0x81, 0x77, 0xAB, 0x54, 0x87, 0x52, 0x64, 0x9A, 0xA8, 0xD5,
+    0xD1, 0x4E, 0xF0, 0x0D, 0x20, 0xD1, 0x99, 0xA4, 0x58, 0x29, 0xF6, 0x1A, 0x13, 0xA0, 0xBB, 0x5F,
+    0x48, 0x8D, 0x1A, 0x17, 0x30, 0x6A, 0xE4, 0x31, 0xBA, 0x67, 0x05, 0xA3, 0xFB, 0x66, 0x30, 0x6A,
+    0x47, 0x30, 0x92, 0xDF, 0xB9, 0x91, 0x8D, 0xFA, 0x19, 0x8C, 0x2E, 0x2C, 0x60, 0x74, 0x9F, 0x1A,
+    0x8C, 0xEE, 0x91, 0xC7, 0xE8, 0xAC, 0x02, 0x46, 0x4D, 0x1F, 0x31, 0x6A, 0x6A, 0x35, 0x46, 0x8D,
+    0xD5, 0x50, 0x69, 0x36, 0x9A, 0x7B, 0x2D, 0x24, 0x4D, 0xA5, 0x8E, 0x00, 0xD9, 0xC5, 0x1D, 0xC6,
+    0x52, 0xCE, 0x90, 0x88, 0x24, 0x1B, 0xEB, 0x77, 0x2B, 0x93, 0x7B, 0x2E, 0xB9, 0xEA, 0x6E, 0xDD,
+    0xF1, 0x06, 0xCA, 0xC4, 0x67, 0x0C, 0x1B, 0x11, 0x65, 0x5B, 0x1B, 0xE5, 0x77, 0x0A, 0x86, 0x3D,
+    0x79, 0x50, 0x6A, 0x5C, 0x70, 0x1A, 0x6C, 0xCC, 0xD5, 0x19, 0x65, 0x6A, 0xD0, 0x73, 0x6A, 0x70,
+    0x41, 0x0D, 0x76, 0xD1, 0xAE, 0x45, 0x7A, 0x35, 0x82, 0x7B, 0x53, 0x1E, 0x1B, 0xDD, 0x8C, 0x91,
+    0x51, 0x83, 0x7C, 0x3F, 0x25, 0x32, 0x46, 0xB5, 0x36, 0x0A, 0x4E, 0xA1, 0xD2, 0x7D, 0x8A, 0xA9,
+    0x27, 0x9E, 0x6A, 0x48, 0x91, 0x1F, 0x6E, 0xD8, 0x5D, 0x74, 0xA3, 0x62, 0x74, 0x3B, 0x77, 0x43,
+    0x35, 0x00, 0x79, 0x93, 0xC6, 0x05, 0xB9, 0x66, 0xA7, 0xD0, 0xEA, 0xDB, 0x52, 0xAE, 0xB9, 0x50,
+    0x93, 0xA9, 0x93, 0xA7, 0x9A, 0xEB, 0x40, 0xA6, 0xEF, 0x46, 0xA8, 0xAE, 0x0A, 0x32, 0x69, 0x84,
+    0x2A, 0x05, 0xBE, 0x7C, 0x2F, 0x42, 0x35, 0xF7, 0x81, 0x4C, 0x8F, 0xAA, 0xA3, 0x9A, 0xAB, 0x95,
+    0x4C, 0x5D, 0x3F, 0xD3, 0x2E, 0x46, 0x63, 0xAD, 0xD9, 0xEA, 0x51, 0xA9, 0x73, 0x33, 0x1B, 0xA2,
+    0xF8, 0x75, 0x20, 0x9F, 0x77, 0x3A, 0x7D, 0xBA, 0x4D, 0x61, 0xD3, 0x9C, 0xB3, 0xE6, 0x06, 0x9C,
+    0x6D, 0x47, 0x2C, 0xEB, 0x35, 0xF1, 0x6E, 0x30, 0xC9, 0xEF, 0x54, 0xFC, 0x68, 0x87, 0xA9, 0x64,
+    0xD1, 0xA8, 0x31, 0xD1, 0xE8, 0xB1, 0x6F, 0xBE, 0x13, 0x58, 0x39, 0x47, 0xE5, 0x0B, 0xD1, 0x47,
+    0xAB, 0xC1, 0xED, 0x98, 0x53, 0x67, 0xE8, 0x97, 0x52, 0x53, 0xAD, 0xC1, 0xA8, 0x49, 0x68, 0xF7,
+    0xEF, 0xB0, 0x99, 0x6B, 0x6E, 0xB5, 0x48, 0xE3, 0xA7, 0xD2, 0x20, 0x00, 0xCE, 0x5D, 0x67, 0xA1,
+    0xE4, 0x62, 0x03, 0x36, 0x93, 0x09, 0x10, 0x76, 0x76, 0xCE, 0x47, 0xD4, 0x4E, 0xE0, 0x16, 0xB2,
+    0x95, 0x22, 0x62, 0x27, 0x6A, 0xCF, 0x8A, 0x1D, 0xF9, 0xEC, 0x16, 0xB1, 0xB0, 0x0B, 0x3E, 0xB3,
+    0x43, 0xAF, 0xC5, 0x7A, 0x69, 0xA9, 0x7C, 0xAF, 0xA9, 0x6A, 0x8C, 0xBA, 0x0A, 0xA3, 0xE6, 0x73,
+    0x18, 0x35, 0xB7, 0x7C, 0x4C, 0xF2, 0x38, 0x93, 0x35, 0xFD, 0x62, 0x5F, 0xD2, 0xE4, 0x2E, 0x68,
+    0x88, 0x46, 0xF7, 0x04, 0xBB, 0x54, 0x8D, 0x9B, 0x1E, 0x44, 0x2F, 0x8F, 0x46, 0x67, 0x3F, 0xD4,
+    0x64, 0x9B, 0x6B, 0xA6, 0xDD, 0xA0, 0xB2, 0x0F, 0x76, 0x93, 0x0F, 0x46, 0xA3, 0xA6, 0x9A, 0x37,
+    0x9E, 0x50, 0x2A, 0xAA, 0xC9, 0xA8, 0xC9, 0x9A, 0x0F, 0xD3, 0xA8, 0x4D, 0x51, 0xEF, 0xD5, 0x24,
+    0xE3, 0xC6, 0xA8, 0x49, 0xF5, 0x7C, 0xCF, 0x8D, 0xFC, 0x71, 0xA3, 0x46, 0xDE, 0x4D, 0x76, 0xD9,
+    0x36, 0xCA, 0xD9, 0xA8, 0xB9, 0xE5, 0xB7, 0xFD, 0xAA, 0x5F, 0xA1, 0x55, 0x4C, 0xD1, 0x5B, 0xC9,
+    0x69, 0x28, 0x2D, 0x50, 0x6A, 0x83, 0x36, 0x77, 0xF0, 0xE0, 0x16, 0x9D, 0x93, 0x36, 0xCF, 0x0E,
+    0xE0, 0xAE, 0xA6, 0x99, 0x6C, 0x00, 0xA7, 0x0E, 0x8A, 0x54, 0x4C, 0x60, 0xA4, 0x06, 0xBE, 0xB4,
+    0xFF, 0xD9, 0x8F, 0x70, 0x13, 0xD6, 0x1B, 0x35, 0x59, 0xC4, 0x4D, 0x38, 0x6F, 0xF4, 0xD8, 0x37,
+    0x63, 0x26, 0x49, 0xBE, 0xD7, 0xC6, 0xDF, 0x53, 0xC3, 0xA9, 0x26, 0xD7, 0x94, 0x6B, 0xA1, 0x57,
+    0x83, 0x06, 0xDC, 0xB4, 0xB9, 0x9F, 0xD0, 0x80, 0xFB, 0x27, 0x6F, 0x35, 0x19, 0x4D, 0x24, 0x37,
+    0x97, 0x5B, 0x68, 0xD5, 0xD4, 0x1A, 0xF2, 0xEB, 0xBF, 0x36, 0x61, 0x17, 0x4A, 0x8D, 0x95, 0xB4,
+    0x85, 0xA4, 0x65, 0x89, 0xD8, 0x50, 0x77, 0x27, 0x58, 0x21, 0x7D, 0x3C, 0xC1, 0xB8, 0x70, 0xE3,
+    0x7E, 0x44, 0x5D, 0xFF, 0x92, 0xC8, 0xA4, 0x4B, 0x09, 0x6E, 0xF8, 0x8A, 0x16, 0x2A, 0x4D, 0x99,
+    0x22, 0xF9, 0x8A, 0x51, 0xA4, 0x9C, 0xB1, 0x9A, 0xA9, 0x47, 0x9C, 0x02, 0x7D, 0x87, 0x14, 0xF2,
+    0x15, 0xB3, 0x6A, 0x2C, 0x67, 0xEC, 0xAF, 0x35, 0xD4, 0x23, 0xEE, 0x05, 0xF9, 0xBE, 0x43, 0xA5,
+    0xBE, 0xBD, 0x62, 0xA2, 0xD5, 0x57, 0x66, 0x6C, 0xB0, 0xAA, 0x47, 0x9C, 0xAF, 0xD4, 0x77, 0x08,
+    0xA7, 0x15, 0x13, 0x71, 0x9A, 0xB1, 0x81, 0x56, 0x23, 0xCE, 0xD3, 0xAB, 0x43, 0xA0, 0x95, 0x5A,
+    0x43, 0xA6, 0xD9, 0x48, 0x3E, 0xD7, 0x68, 0x93, 0x7F, 0x94, 0xDD, 0x3C, 0x9F, 0x70, 0x21, 0xDB,
+    0x91, 0x22, 0x82, 0x36, 0xA4, 0x23, 0x2D, 0x6F, 0x49, 0xB9, 0xEA, 0xB8, 0x9E, 0x16, 0x01, 0xF0,
+    0xD5, 0xEC, 0x88, 0x5C, 0x6F, 0x6A, 0xA5, 0x55, 0xAF, 0xC9, 0x48, 0x92, 0xCF, 0x35, 0xB5, 0x91,
+    0x2A, 0xA2, 0x21, 0x53, 0x67, 0x17, 0xAA, 0x99, 0x7E, 0xC8, 0xD4, 0x95, 0x1F, 0x60, 0xB3, 0x5D,
+    0x32, 0xCD, 0xB5, 0xA6, 0x56, 0xBF, 0x92, 0xEE, 0xD5, 0xEA, 0xE4, 0x69, 0x35, 0x49, 0x3E, 0x97,
+    0x7E, 0x26, 0x35, 0x85, 0x16, 0x5A, 0x91, 0xE4, 0x94, 0x44, 0xB8, 0x26, 0x11, 0xC6, 0x24, 0xC2,
+    0xC4, 0x57, 0xEB, 0xE7, 0x7C, 0xC5, 0x44, 0x4D, 0xE5, 0x8C, 0x0D, 0x0A, 0xF5, 0x88, 0x7B, 0x5E,
+    0x63, 0xDF, 0x21, 0xA3, 0x9F, 0xAD, 0x98, 0x68, 0xF4, 0xD2, 0x8C, 0x0D, 0x85, 0xAE, 0x8C, 0x38,
+    0x6F, 0xA5, 0x0E, 0x61, 0x93, 0x08, 0xAB, 0x24, 0xC2, 0x3A, 0x89, 0xD0, 0xA9, 0x2B, 0x35, 0xD1,
+    0xAE, 0x48, 0x81, 0x7E, 0x36, 0x4A, 0x50, 0x04, 0xC0, 0xC5, 0x63, 0xBE, 0x50, 0x12, 0xD6, 0x46,
+    0xC6, 0x61, 0x23, 0x7C, 0xA6, 0x7E, 0x92, 0xF8, 0x8D, 0x69, 0x81, 0x85, 0xBF, 0xF8, 0x64, 0x44,
+    0xB7, 0xBB, 0x49, 0xA7, 0xF7, 0x80, 0x65, 0x9E, 0x70, 0x91, 0x63, 0xF2, 0x65, 0x35, 0xA4, 0x40,
+    0x24, 0xE0, 0x0B, 0xA4, 0x3E, 0xFE, 0x23, 0xC0, 0x7A, 0x1B, 0x00, 0x97, 0x42, 0x00, 0xDC, 0xAB,
+    0x21, 0xF1, 0xCA, 0x4F, 0x84, 0x87, 0xE0, 0x9A, 0xDF, 0xCB, 0x5E, 0x0E, 0xF0, 0x2D, 0x66, 0xB0,
+    0x83, 0x6B, 0xA0, 0x2F, 0x47, 0x30, 0x6B, 0xDC, 0x07, 0xBC, 0xB4, 0x23, 0x5C, 0xC7, 0x68, 0xF8,
+    0x64, 0x6E, 0x55, 0x9E, 0xF4, 0x89, 0x6C, 0x23, 0x87, 0xDB, 0xAD, 0x02, 0x7D, 0x72, 0x6E, 0x15,
+    0x9B, 0x57, 0xA9, 0x4D, 0xDD, 0xA7, 0x08, 0x7C, 0x23, 0x7B, 0x12, 0xD6, 0x5C, 0xBF, 0xD4, 0x42,
+    0xE5, 0x7B, 0x49, 0xC1, 0x4C, 0x85, 0x24, 0x75, 0xB7, 0x60, 0x74, 0xB9, 0x8D, 0x80, 0x9B, 0xB2,
+    0xA4, 0xF8, 0x36, 0x36, 0xED, 0xF2, 0xA1, 0x77, 0xFB, 0xAB, 0x59, 0x42, 0xEA, 0x43, 0xAF, 0x01,
+    0x23, 0x59, 0x2D, 0xFB, 0x91, 0xD9, 0xBD, 0xCB, 0xC8, 0x5C, 0xD3, 0x6D, 0x5F, 0xAE, 0x1B, 0x99,
+    0x73, 0x1A, 0x99, 0x53, 0x1A, 0x99, 0x21, 0x8D, 0xCC, 0x31, 0x8D, 0xCC, 0x21, 0x8D, 0xCC, 0xE7,
+    0xD3, 0xC8, 0xFC, 0x6E, 0x1A, 0x99, 0x17, 0x46, 0x9C, 0x2F, 0xD3, 0x6D, 0x7F, 0x8F, 0x91, 0xD9,
+    0x94, 0x9A, 0x70, 0x4B, 0x1A, 0x99, 0xD3, 0x89, 0x91, 0x99, 0x30, 0xC0, 0x3F, 0x2A, 0x22, 0x90,
+    0x45, 0x37, 0x24, 0xAC, 0x34, 0x19, 0x8B, 0x81, 0x1D, 0xEB, 0x05, 0x0E, 0x2E, 0x02, 0x0F, 0x64,
+    0x47, 0xD4, 0xAA, 0x34, 0xB6, 0xEA, 0x35, 0x39, 0x49, 0x31, 0xD7, 0xD4, 0xC6, 0x4C, 0xDE, 0x2E,
+    0x99, 0x3A, 0xBB, 0x64, 0xEA, 0xCA, 0x0F, 0x52, 0x14, 0x1A, 0xCA, 0xA5, 0xD6, 0x54, 0x2E, 0x4E,
+    0x53, 0xB2, 0xF4, 0xF6, 0x45, 0xE2, 0x7E, 0x05, 0xC8, 0x53, 0x08, 0x4D, 0x07, 0xD5, 0x0A, 0x1C,
+    0x3C, 0x0E, 0xF9, 0xD1, 0x51, 0x82, 0xC1, 0x53, 0x18, 0x8E, 0x87, 0x3C, 0x91, 0x60, 0x6F, 0xFA,
+    0x00, 0x9C, 0xA3, 0xA3, 0xC7, 0xA9, 0x52, 0x2F, 0x98, 0x38, 0x75, 0x78, 0xF8, 0xB1, 0x73, 0xDC,
+    0x77, 0x51, 0x91, 0x99, 0x87, 0x32, 0x14, 0x03, 0x14, 0xEA, 0xFD, 0x4E, 0x61, 0xD8, 0xA0, 0xEC,
+    0x93, 0x34, 0xD7, 0x9B, 0x52, 0x6C, 0xA7, 0x39, 0x8D, 0x6D, 0x8A, 0x26, 0x5F, 0xB3, 0x89, 0x4A,
+    0x82, 0x5E, 0x1E, 0xFA, 0x8B, 0x1F, 0xBF, 0xFC, 0xB2, 0x26, 0x07, 0xCC, 0x60, 0x3B, 0xB0, 0x21,
+    0xA5, 0x3C, 0xE8, 0x3D, 0xE8, 0x79, 0x35, 0xE4, 0x6B, 0x11, 0xC1, 0x84, 0x72, 0x80, 0xBC, 0x3B,
+    0xB8, 0xC9, 0xA5, 0x98, 0x71, 0x1A, 0xEE, 0x2A, 0x06, 0x8A, 0x20, 0x50, 0x35, 0x50, 0xFD, 0x2C,
+    0x92, 0xCF, 0xAE, 0xC1, 0x15, 0x23, 0xB9, 0xBF, 0xF3, 0x13, 0xE8, 0x8E, 0x17, 0xD9, 0xD9, 0xCD,
+    0x79, 0x5A, 0x44, 0x22, 0x50, 0x68, 0x00, 0xEA, 0xCB, 0x37, 0xFA, 0xDC, 0x0E, 0x21, 0xEB, 0xA5,
+    0xCB, 0xD8, 0xBD, 0xB7, 0x2B, 0x62, 0x74, 0x56, 0x13, 0x36, 0xA2, 0x80, 0x0B, 0x99, 0x3C, 0xF2,
+    0x46, 0x18, 0x51, 0x45, 0x6C, 0xA4, 0x1F, 0x71, 0xA1, 0x10, 0xE8, 0x65, 0x4D, 0x89, 0x25, 0x80,
+    0x95, 0x46, 0x70, 0x52, 0x03, 0x7A, 0x45, 0x60, 0x54, 0x0A, 0x6C, 0xB4, 0x2B, 0xB8, 0x60, 0x57,
+    0x90, 0xAF, 0x56, 0x8C, 0xA8, 0x45, 0xAB, 0xD1, 0xE9, 0x2B, 0x92, 0x77, 0xEA, 0xA5, 0x0D, 0xC7,
+    0x38, 0xE8, 0x12, 0x12, 0x50, 0x6D, 0xBA, 0x49, 0xDF, 0x81, 0x92, 0xA3, 0xD0, 0x4C, 0xC0, 0x89,
+    0xC0, 0xE3, 0x7F, 0x97, 0x3D, 0x5E, 0xAF, 0x36, 0xB6, 0x72, 0xD1, 0x49, 0x31, 0x97, 0xA6, 0x4C,
+    0xE3, 0xE9, 0x4C, 0x1D, 0xEF, 0xF7, 0x5F, 0x68, 0xC6, 0x49, 0x1B, 0x9D, 0xFF, 0x66, 0x6B, 0xFF,
+    0x29, 0xF6, 0x8A, 0x51, 0x8A, 0x53, 0xB0, 0xC7, 0x8E, 0xBE, 0x84, 0xC4, 0xDA, 0x11, 0x48, 0x46,
+    0xEA, 0x47, 0x26, 0x85, 0x4D, 0x69, 0xD4, 0xE6, 0x63, 0x6C, 0x53, 0xDC, 0xFD, 0x3E, 0x9D, 0xC3,
+    0x45, 0xE0, 0x71, 0xBE, 0x05, 0xE5, 0x50, 0x4E, 0x50, 0x8D, 0x6D, 0xB3, 0xE3, 0x40, 0x3A, 0x35,
+    0x7B, 0x76, 0x77, 0xD5, 0xDD, 0xBC, 0xFD, 0x0A, 0x08, 0x79, 0xC8, 0xE7, 0x32, 0x64, 0x4B, 0xE5,
+    0xE9, 0xFB, 0x86, 0x7A, 0x4D, 0x0B, 0x61, 0x3E, 0x7D, 0x0C, 0xFD, 0x2A, 0xEB, 0x12, 0x7C, 0x54,
+    0x28, 0x01, 0x6D, 0x56, 0x3E, 0x61, 0x1A, 0x3B, 0x7B, 0x2C, 0xFB, 0x46, 0x43, 0x95, 0xF8, 0xBA,
+    0xA1, 0x96, 0xA2, 0x5D, 0x50, 0xB9, 0x50, 0xBF, 0x20, 0xCA, 0xA0, 0x21, 0x9B, 0x5C, 0x4C, 0x0C,
+    0xD3, 0x4C, 0xEA, 0xA8, 0xB5, 0x92, 0x4B, 0x53, 0xC2, 0xB3, 0x5A, 0x05, 0xE8, 0xD7, 0xDB, 0x28,
+    0xF4, 0x3D, 0x4F, 0xFB, 0xF7, 0x13, 0xD5, 0x55, 0x51, 0x2E, 0x6D, 0x28, 0x64, 0x25, 0xDD, 0x23,
+    0xA9, 0x69, 0xB5, 0xC2, 0x57, 0xBF, 0xBF, 0x0D, 0x78, 0x33, 0x26, 0xF5, 0x5A, 0x0D, 0xE5, 0x0C,
+    0xCE, 0x93, 0xC5, 0xEB, 0xA2, 0x9B, 0xB2, 0xA3, 0x86, 0x56, 0x53, 0x29, 0x85, 0x76, 0x68, 0x9F,
+    0x5F, 0x69, 0xED, 0xCC, 0xEC, 0x96, 0xAC, 0xE9, 0xD5, 0x21, 0x8D, 0x59, 0x8A, 0xA1, 0x0C, 0x54,
+    0x7A, 0x7E, 0x2C, 0x74, 0xBF, 0x2F, 0x96, 0xB6, 0xA9, 0xDE, 0xD4, 0xDF, 0xEA, 0x51, 0x69, 0x2E,
+    0xA5, 0x86, 0xC3, 0x26, 0x01, 0xC6, 0xC8, 0x83, 0x22, 0xA8, 0xF5, 0xA8, 0x98, 0x11, 0x2D, 0xB7,
+    0xEE, 0x30, 0xE3, 0x4F, 0xB0, 0xE5, 0x07, 0x1E, 0x7A, 0x8F, 0x91, 0xC7, 0xF5, 0x5D, 0x16, 0xDB,
+    0xC6, 0xFA, 0x96, 0x67, 0xF8, 0xF1, 0xBE, 0xD9, 0x0F, 0x5C, 0xA4, 0xD2, 0x92, 0x4B, 0xB1, 0x9A,
+    0xAA, 0xD0, 0x77, 0xD5, 0x0B, 0x2B, 0x77, 0x59, 0x35, 0xE7, 0x6A, 0x25, 0x1D, 0xB1, 0x55, 0xA4,
+    0x56, 0xA4, 0x50, 0xF8, 0x71, 0xA6, 0x57, 0x42, 0xA6, 0xFB, 0x87, 0x22, 0xB6, 0x6F, 0xF5, 0xA3,
+    0xB4, 0xE6, 0xD2, 0xC0, 0x99, 0x73, 0x9F, 0x68, 0x9B, 0xCE, 0x93, 0xF8, 0x4F, 0x2E, 0x6E, 0xC1,
+    0x0E, 0xB5, 0x4F, 0xFF, 0x6E, 0xD8, 0xD0, 0xB1, 0xDB, 0x9E, 0xA0, 0x90, 0x9A, 0x5E, 0x2A, 0x96,
+    0x22, 0xD6, 0x63, 0x11, 0xD4, 0xD9, 0x47, 0x35, 0x7C, 0xA6, 0xD4, 0x8C, 0xD5, 0x4A, 0x95, 0xAC,
+    0x22, 0x32, 0xC5, 0x2F, 0xD1, 0xBE, 0x15, 0x69, 0x5F, 0x99, 0x32, 0x55, 0xCB, 0x85, 0xD9, 0x49,
+    0x5D, 0xAF, 0x89, 0x53, 0xE7, 0x13, 0xCA, 0xE9, 0x42, 0x72, 0x3F, 0xBB, 0x0E, 0x16, 0xB0, 0x23,
+    0xD9, 0x0A, 0xF9, 0xC5, 0xCD, 0x36, 0x8B, 0x08, 0xE7, 0x85, 0x59, 0x94, 0x2C, 0xB2, 0x42, 0x27,
+    0x8C, 0xB1, 0x4F, 0xB2, 0x8B, 0xC3, 0xE7, 0xB9, 0x8B, 0xC5, 0x4C, 0x79, 0xAC, 0x3B, 0xB3, 0x46,
+    0x8C, 0x06, 0x8A, 0xF5, 0x3A, 0x96, 0xD9, 0x47, 0xD4, 0xC5, 0x9D, 0x76, 0x80, 0x96, 0x7E, 0x25,
+    0x49, 0xFA, 0xDE, 0xB5, 0xFB, 0xD7, 0x6F, 0x2E, 0xCE, 0xBB, 0xA9, 0x98, 0x56, 0x34, 0x54, 0x97,
+    0x26, 0xA3, 0xA6, 0xCD, 0x3B, 0xBB, 0xF0, 0xC4, 0x06, 0x2F, 0xBD, 0x8B, 0x13, 0xFF, 0x77, 0x39,
+    0x7C, 0xB0, 0x41, 0x52, 0xEA, 0xC8, 0xA4, 0xE5, 0x7A, 0xC6, 0xC0, 0x2E, 0xE7, 0x93, 0xDF, 0x1B,
+    0xD2, 0x26, 0xB9, 0xA1, 0xFC, 0xDE, 0x01, 0x70, 0x6B, 0xB3, 0x41, 0xA7, 0x4A, 0xEE, 0x81, 0xCD,
+    0xCB, 0x71, 0x41, 0x7A, 0x41, 0x92, 0x95, 0xE6, 0x6C, 0x73, 0xBC, 0x54, 0x11, 0xDA, 0x14, 0x64,
+    0x70, 0xC3, 0xAE, 0x11, 0x58, 0x7D, 0xB5, 0x71, 0x89, 0x62, 0x41, 0xAF, 0x86, 0x33, 0x0D, 0x7C,
+    0x26, 0xD1, 0xA5, 0xAA, 0x2D, 0xAD, 0x49, 0xE5, 0x61, 0x4D, 0xCE, 0x86, 0x2F, 0x00, 0x07, 0xE4,
+    0x1D, 0x38, 0x5C, 0xB7, 0x71, 0x14, 0x33, 0xB5, 0x1D, 0xC9, 0x31, 0xB3, 0xF3, 0x9A, 0x2D, 0x37,
+    0x9A, 0xEE, 0xC7, 0xA2, 0x95, 0xA4, 0xD5, 0xFD, 0x43, 0x7B, 0xF5, 0xE9, 0x49, 0x68, 0xA8, 0x2E,
+    0xCD, 0x46, 0x4D, 0x7B, 0xDF, 0x60, 0x97, 0x2C, 0xDE, 0x8A, 0x9B, 0xF2, 0x8B, 0xFF, 0x5C, 0xD1,
+    0xA6, 0xC3, 0xB7, 0xA7, 0x05, 0x46, 0x2B, 0x29, 0xFD, 0xC9, 0xE6, 0xDC, 0xF2, 0xA9, 0x37, 0x47,
+    0x30, 0x81, 0xCF, 0x56, 0x9D, 0x89, 0x0F, 0x52, 0x87, 0x71, 0xF3, 0x10, 0x65, 0xBD, 0x64, 0x13,
+    0x11, 0x61, 0xFC, 0xED, 0xB2, 0x2B, 0x76, 0xDE, 0xA5, 0xE5, 0x1B, 0xA4, 0xFC, 0x3F, 0x43, 0xAE,
+    0x05, 0x0E, 0xFF, 0x19, 0xBD, 0x29, 0x7B, 0x4A, 0x47, 0x50, 0x4A, 0x11, 0xAA, 0x84, 0x66, 0x7F,
+    0xE8, 0xDE, 0xF4, 0xBB, 0x74, 0x8D, 0x5A, 0xF2, 0x92, 0xB2, 0x0B, 0xCB, 0xF9, 0xF7, 0xEB, 0x1A,
+    0x3B, 0x8A, 0x4E, 0x2C, 0x53, 0xD0, 0x5A, 0x8A, 0xC4, 0x54, 0x07, 0xCC, 0xFD, 0x04, 0x94, 0xF9,
+    0xF2, 0xAE, 0x79, 0x64, 0x0A, 0x69, 0xAC, 0xA4, 0x56, 0x6B, 0x2E, 0xFD, 0x5A, 0xEA, 0x2A, 0xCD,
+    0xB9, 0x3C, 0x36, 0x52, 0x45, 0x90, 0xCF, 0x3E, 0xD2, 0x1D, 0x34, 0x50, 0xCD, 0xD8, 0x04, 0xCF,
+    0xF4, 0xEB, 0xBF, 0x55, 0xD8, 0x85, 0xC5, 0x59, 0x29, 0x85, 0xB3, 0xAA, 0xDB, 0x78, 0xAA, 0x50,
+    0x4C, 0x7F, 0x08, 0x99, 0x7E, 0x16, 0xA0, 0x96, 0xC0, 0xBC, 0xA5, 0x00, 0x9F, 0x4F, 0xC0, 0xC8,
+    0x2D, 0x37, 0x18, 0xC9, 0x40, 0xAE, 0x70, 0xBB, 0xBA, 0x5E, 0x46, 0x73, 0xA1, 0x50, 0xAB, 0x33,
+    0xA2, 0x9E, 0x71, 0x21, 0xFF, 0xE0, 0x9B, 0x53, 0xAE, 0xCE, 0xE8, 0xE7, 0x7D, 0xD2, 0xA5, 0x2E,
+    0x23, 0x5D, 0xD1, 0x98, 0xC2, 0x03, 0xB2, 0xF3, 0xD9, 0x39, 0xE0, 0x81, 0xA3, 0xC7, 0x8F, 0xC5,
+    0x2B, 0xCD, 0x29, 0xD4, 0xFA, 0xF7, 0x50, 0xBC, 0xB7, 0x1D, 0x1D, 0x25, 0x5A, 0x17, 0x38, 0x09,
+    0x38, 0x3C, 0x3C, 0xF7, 0x29, 0xC9, 0x74, 0x47, 0x6F, 0x35, 0x1D, 0xB0, 0xA4, 0x84, 0x84, 0xAB,
+    0x3A, 0xA0, 0x57, 0x38, 0xCE, 0x48, 0x93, 0x9D, 0xFB, 0xBD, 0x12, 0xF0, 0x29, 0x32, 0xC8, 0x02,
+    0x3F, 0x04, 0x37, 0xD4, 0xC7, 0xA9, 0x32, 0x66, 0xE0, 0xF6, 0xF9, 0xD3, 0xEA, 0xBF, 0x1B, 0xAD,
+    0xA7, 0x4D, 0xBE, 0xEA, 0x2B, 0x1E, 0x30, 0xE1, 0x61, 0x80, 0xBB, 0xCC, 0x08, 0x98, 0xF0, 0x65,
+    0x80, 0xFA, 0xCA, 0x09, 0x5A, 0x45, 0x76, 0xFE, 0x44, 0xA2, 0x91, 0x35, 0x93, 0x7E, 0x23, 0x8D,
+    0xB5, 0xE4, 0x34, 0x67, 0x52, 0x57, 0x7F, 0x0C, 0xB2, 0xDE, 0x76, 0xEC, 0x42, 0xA6, 0x6E, 0x73,
+    0xDB, 0x94, 0xBA, 0x7C, 0x41, 0xFB, 0x0C, 0x3D, 0xC9, 0x9F, 0x99, 0xA7, 0x21, 0xC8, 0x03, 0x17,
+    0x77, 0x0E, 0xF7, 0xC4, 0xB2, 0x30, 0x6F, 0xCF, 0xC0, 0x83, 0xD6, 0x43, 0xE9, 0x7F, 0x02, 0xFC,
+    0xA4, 0xF4, 0x50, 0xBC, 0x35, 0x91, 0x72, 0x2B, 0xC2, 0x5F, 0x35, 0x9F, 0x82, 0xF0, 0xFF, 0x98,
+    0x06, 0x28, 0xBB, 0x0A, 0xC8, 0x97, 0x62, 0x06, 0xFA, 0xE7, 0xD4, 0x40, 0x35, 0xB9, 0x11, 0x8A,
+    0x68, 0x27, 0xE0, 0x99, 0x6C, 0x06, 0xF2, 0x14, 0x4D, 0x7B, 0x5D, 0x96, 0x97, 0x9B, 0x59, 0xF8,
+    0xA7, 0x33, 0xA0, 0x18, 0x7E, 0x02, 0xC8, 0x0E, 0x60, 0x7F, 0x19, 0x21, 0x8F, 0xAE, 0x03, 0x77,
+    0x6F, 0x80, 0x62, 0x7C, 0x06, 0xB8, 0xB3, 0xE8, 0x3E, 0x95, 0x9E, 0xFF, 0xE9, 0xC9, 0x2E, 0x50,
+    0xE8, 0xB5, 0x0B, 0xEB, 0x49, 0xD9, 0x05, 0xC8, 0x36, 0xD9, 0xFD, 0x59, 0x3C, 0x66, 0x13, 0x6F,
+    0x5E, 0x9A, 0xCD, 0x7F, 0x64, 0xD7, 0x8B, 0x00, 0x49, 0x0F, 0xCD, 0xD5, 0x7D, 0x62, 0x22, 0x6B,
+    0x23, 0xD9, 0xF9, 0xA4, 0x2E, 0xD6, 0xCD, 0x96, 0x36, 0x24, 0x19, 0x41, 0x94, 0xEB, 0xB9, 0x7D,
+    0x26, 0xA2, 0xFE, 0xB8, 0x46, 0x7B, 0x56, 0x95, 0xDB, 0xD1, 0x30, 0xDD, 0x2E, 0x91, 0xD4, 0xE6,
+    0x48, 0xDA, 0x3B, 0x96, 0xA0, 0xF6, 0x36, 0x61, 0x4C, 0x79, 0x97, 0x35, 0xEF, 0xBA, 0x70, 0x5A,
+    0xA9, 0xBB, 0xF5, 0x62, 0x26, 0xBD, 0x20, 0x8D, 0x65, 0xA4, 0x57, 0xE8, 0x15, 0x8C, 0x1A, 0xAB,
+    0x60, 0xE4, 0xD1, 0x88, 0x1B, 0xE9, 0x27, 0xDA, 0x48, 0x15, 0xA8, 0x16, 0x6A, 0x51, 0x46, 0x8C,
+    0x3A, 0xAB, 0xD1, 0xAC, 0xD0, 0x07, 0xA3, 0x88, 0xA0, 0x8A, 0x99, 0x44, 0xEB, 0x31, 0x6A, 0x7A,
+    0x0D, 0xF5, 0x08, 0xFD, 0xE8, 0x5E, 0x9D, 0x6D, 0x80, 0x2A, 0xDA, 0x4B, 0x32, 0x11, 0x8C, 0x8A,
+    0xA0, 0xE7, 0x56, 0xA0, 0xFF, 0x59, 0xAC, 0xE6, 0x1E, 0xA8, 0xE6, 0xD5, 0xC8, 0x79, 0x30, 0x72,
+    0xE8, 0xA7, 0x23, 0xD0, 0x5F, 0xF1, 0xD5, 0xDB, 0x53, 0x8A, 0x9A, 0x35, 0x1B, 0x97, 0x67, 0x22,
+    0x21, 0x3B, 0x7D, 0xA4, 0x52, 0x03, 0x54, 0xEB, 0x66, 0x22, 0x18, 0x35, 0xA4, 0xE4, 0x0B, 0xF2,
+    0x54, 0x37, 0x66, 0x95, 0xBB, 0x2D, 0x35, 0xDC, 0x6C, 0x7A, 0x59, 0x9A, 0x66, 0x77, 0x5C, 0x36,
+    0x13, 0x12, 0x5A, 0xB4, 0x98, 0x90, 0x00, 0x9F, 0xEA, 0x3D, 0x33, 0x01, 0x3A, 0x05, 0x3B, 0x5A,
+    0x5D, 0x92, 0x50, 0xA6, 0x68, 0xD5, 0xD4, 0x21, 0x17, 0x2E, 0x18, 0x35, 0xF5, 0x60, 0x84, 0x9B,
+    0x4D, 0xA4, 0x9A, 0x0B, 0x79, 0xD7, 0x21, 0xAF, 0x58, 0x4C, 0x94, 0xD1, 0x6A, 0xE8, 0xA1, 0x7D,
+    0xF9, 0xAD, 0xD5, 0x8E, 0x98, 0xB5, 0xB6, 0x6F, 0x46, 0xA8, 0x7F, 0x1D, 0x74, 0xC1, 0x93, 0xE9,
+    0xE1, 0xF2, 0xED, 0x09, 0xAC, 0x06, 0x27, 0xA0, 0x8F, 0x26, 0x91, 0xA8, 0xBA, 0x7A, 0x39, 0x76,
+    0x30, 0x65, 0xDA, 0x3B, 0xAC, 0xF6, 0x19, 0xFB, 0x76, 0xF1, 0x52, 0xED, 0x0A, 0xB0, 0xF6, 0x1D,
+    0x98, 0xB9, 0x1A, 0xC0, 0x8E, 0xC5, 0x08, 0x79, 0x73, 0xC3, 0xED, 0xBE, 0x79, 0x92, 0x56, 0xC1,
+    0x6D, 0xFB, 0x54, 0xBE, 0x99, 0x46, 0xC0, 0xF5, 0x0D, 0x94, 0xBF, 0x8C, 0x90, 0xC5, 0x72, 0x04,
+    0xC7, 0x97, 0xDF, 0x29, 0xFD, 0x56, 0x73, 0xAD, 0x4B, 0xD2, 0xDD, 0x8A, 0x56, 0x5D, 0xB1, 0xE2,
+    0x66, 0x9C, 0xCF, 0xE5, 0xCB, 0x19, 0x1B, 0x11, 0xF4, 0x63, 0x15, 0x28, 0x94, 0x2F, 0xE0, 0x82,
+    0xF3, 0x64, 0xBA, 0x77, 0x02, 0x3B, 0x0B, 0xE8, 0x5F, 0x1D, 0x77, 0x69, 0x25, 0xEA, 0xA4, 0x4D,
+    0x06, 0x76, 0xA4, 0xC0, 0x76, 0xD8, 0x1B, 0x95, 0x09, 0xFA, 0x0B, 0xC0, 0x85, 0xB8, 0x23, 0x57,
+    0xB4, 0x1A, 0x36, 0xA6, 0x14, 0xB7, 0x3D, 0xBE, 0x65, 0xF3, 0x3B, 0x05, 0xD8, 0xC9, 0x0D, 0x50,
+    0xCD, 0x6D, 0x80, 0x6A, 0x76, 0x01, 0x6C, 0x78, 0x47, 0xD4, 0xCA, 0xCD, 0x26, 0x7A, 0xFE, 0x78,
+    0x47, 0x02, 0x4B, 0x6E, 0xC7, 0x08, 0x79, 0x22, 0x81, 0x35, 0x37, 0x92, 0xC0, 0xAC, 0xA4, 0xD1,
+    0x4A, 0x9A, 0x2A, 0x49, 0x73, 0x75, 0xF5, 0x50, 0xA1, 0xF2, 0x99, 0xC6, 0xCA, 0x1B, 0x79, 0xDB,
+    0x94, 0x02, 0xAA, 0x65, 0x57, 0xA1, 0xC4, 0xBA, 0x1B, 0x36, 0x82, 0x89, 0x15, 0x50, 0x2F, 0x3B,
+    0xFE, 0xA8, 0x02, 0x7F, 0x61, 0xE4, 0x89, 0xA5, 0xBA, 0x6C, 0xB1, 0x22, 0x8F, 0x6E, 0x39, 0xFC,
+    0x5A, 0xDC, 0xA7, 0xA7, 0x9E, 0xAB, 0x13, 0x94, 0xA9, 0xCF, 0x6C, 0x44, 0x89, 0x22, 0xA4, 0xFB,
+    0x92, 0xAF, 0x1B, 0x52, 0xFC, 0xF0, 0x8E, 0xEC, 0x77, 0xDD, 0xA8, 0x4C, 0x15, 0x2C, 0x24, 0x3D,
+    0x12, 0x73, 0xF9, 0x87, 0x32, 0x79, 0x8B, 0x06, 0xD0, 0x98, 0xAA, 0xD5, 0x87, 0x2D, 0xB6, 0x6E,
+    0xCA, 0x1B, 0x37, 0xE7, 0xC1, 0x45, 0x62, 0x1D, 0xE9, 0xAD, 0x92, 0x45, 0x38, 0xB6, 0xC7, 0xD7,
+    0x66, 0x37, 0xFD, 0xE6, 0x89, 0x3D, 0xD4, 0xED, 0x96, 0x83, 0xF5, 0xDD, 0x66, 0xCE, 0x4F, 0x47,
+    0x40, 0xF9, 0x46, 0xFB, 0xCF, 0xE4, 0xD3, 0x2A, 0x60, 0xA7, 0x77, 0xC4, 0x1D, 0x61, 0x94, 0x92,
+    0x24, 0x86, 0x56, 0x9A, 0x2B, 0x5F, 0xC7, 0x62, 0xA8, 0x22, 0xC1, 0x2E, 0x49, 0x69, 0xB3, 0x4A,
+    0xDD, 0xBF, 0x10, 0x18, 0x35, 0x7F, 0x62, 0xD4, 0xD5, 0x46, 0xDE, 0x3E, 0x2F, 0x5F, 0x86, 0xED,
+    0xA2, 0x6B, 0x91, 0x34, 0x6D, 0xE0, 0xEB, 0xFC, 0x29, 0x44, 0x04, 0x32, 0x11, 0xDC, 0x2F, 0xC2,
+    0x36, 0x83, 0x26, 0x1B, 0xFC, 0x99, 0x9B, 0xA3, 0xE3, 0x00, 0x3F, 0x66, 0xC6, 0xB1, 0x60, 0xC3,
+    0x0A, 0xEA, 0x13, 0x05, 0x38, 0x53, 0x73, 0x3D, 0x96, 0xFF, 0x31, 0x74, 0x9C, 0x0B, 0x8F, 0x93,
+    0xA7, 0xEC, 0x79, 0x53, 0xAE, 0x2B, 0x0B, 0xF2, 0x2D, 0xFD, 0x50, 0x34, 0x2E, 0xA4, 0xB1, 0x66,
+    0xB4, 0xC1, 0x5A, 0x1F, 0xF2, 0x40, 0xAD, 0x8B, 0xB4, 0x09, 0xE9, 0x6C, 0xB8, 0x85, 0xA9, 0x0C,
+    0x75, 0x70, 0xA1, 0x1E, 0x2B, 0xFF, 0x2F, 0x21, 0xE3, 0x21, 0xFB, 0xA6, 0xDC, 0x2F, 0xA6, 0xC5,
+    0x34, 0x69, 0x82, 0x55, 0x97, 0x6B, 0x28, 0xDE, 0x0E, 0xF6, 0x52, 0xAC, 0xBB, 0xC5, 0x71, 0x27,
+    0xF0, 0xCE, 0x38, 0x8B, 0x93, 0x11, 0x0D, 0xEF, 0x8C, 0x1A, 0xB8, 0xED, 0xDE, 0xA5, 0x7F, 0x63,
+    0x75, 0xBE, 0x01, 0xDA, 0xB3, 0x8B, 0x5E, 0x90, 0x5E, 0x50, 0x7F, 0xF7, 0x72, 0x0B, 0xA7, 0x0F,
+    0x16, 0xA3, 0xD8, 0xDE, 0xFF, 0xCA, 0xF0, 0xEC, 0x17, 0xED, 0x90, 0xCF, 0x66, 0xC5, 0x91, 0x8D,
+    0xC9, 0xE4, 0xE9, 0x43, 0xFD, 0xF4, 0x0B, 0xC3, 0x4F, 0x1E, 0x2A, 0x5E, 0x19, 0x1E, 0x74, 0xF7,
+    0x3F, 0xA7, 0x90, 0x5F, 0xE6, 0x16, 0x9A, 0xBB, 0x8A, 0x97, 0xA3, 0xFB, 0xE9, 0x9B, 0x6B, 0xFB,
+    0x95, 0x7F, 0x9C, 0xDD, 0x7D, 0xCF, 0xCD, 0x7F, 0xBA, 0x4B, 0xBB, 0xFB, 0x45, 0x7E, 0xD2, 0x67,
+    0xD1, 0x3D, 0x1A, 0xAA, 0x2B, 0x43, 0x29, 0x9F, 0x0B, 0x9E, 0xE1, 0x16, 0xCE, 0x4E, 0xB5, 0x0D,
+    0x4B, 0x7D, 0x29, 0xBA, 0xEF, 0x4C, 0x6D, 0x39, 0x3E, 0x63, 0x7D, 0xF8, 0x3C, 0x90, 0xF5, 0x9D,
+    0xD5, 0xEC, 0x14, 0x1F, 0xCA, 0x97, 0xFF, 0xC4, 0x83, 0xA7, 0x39, 0x0D, 0x0F, 0x55, 0x2F, 0xCC,
+    0x6D, 0x19, 0x54, 0xCE, 0xED, 0x73, 0x8F, 0x97, 0x63, 0x3F, 0xE8, 0x91, 0xB5, 0x98, 0x6A, 0xBF,
+    0xD8, 0xF1, 0x4B, 0xD4, 0x8F, 0xE8, 0xBB, 0xB1, 0x1E, 0xDA, 0x66, 0xCD, 0x62, 0x1E, 0xF3, 0xF1,
+    0xB4, 0x7D, 0xF1, 0xCD, 0xF8, 0x70, 0xFD, 0x95, 0xE7, 0x87, 0x3F, 0x86, 0x7C, 0xAE, 0x5F, 0x5E,
+    0xEA, 0x17, 0xA7, 0x67, 0x4A, 0xE0, 0x94, 0x89, 0xFD, 0x1B, 0x6B, 0xFB, 0xF2, 0x13, 0xAE, 0xD9,
+    0x35, 0xF6, 0xDB, 0xEB, 0x19, 0xCE, 0x67, 0x4D, 0x35, 0x3F, 0xFC, 0xCC, 0x8F, 0xEF, 0x9A, 0xBF,
+    0xF4, 0xCC, 0x43, 0x6E, 0x3E, 0xB8, 0x98, 0x35, 0xCE, 0xEB, 0xEE, 0xB5, 0x98, 0xDC, 0xF3, 0xF1,
+    0xA0, 0x39, 0xD5, 0xD4, 0x53, 0x1D, 0xF3, 0x98, 0xC7, 0x22, 0xD4, 0xC3, 0x6D, 0x40, 0x39, 0xD6,
+    0x5D, 0x4B, 0x4F, 0xFF, 0x73, 0xB7, 0x96, 0x33, 0x60, 0x2F, 0x4D, 0x8B, 0xBB, 0xEF, 0xD2, 0xB4,
+    0xDC, 0x01, 0x7F, 0x45, 0x26, 0x6F, 0x14, 0xEC, 0xDB, 0xB1, 0x7E, 0x6E, 0x6D, 0x79, 0xF8, 0x0B,
+    0xFC, 0x0F, 0x27, 0x45, 0x5F, 0xEF, 0x02, 0x36, 0x52, 0xC8, 0x4D, 0xAB, 0xE5, 0x21, 0x17, 0xBF,
+    0x58, 0x06, 0xE0, 0xCC, 0xE1, 0xF9, 0x74, 0xB7, 0xEE, 0x38, 0xFA, 0xC1, 0xBB, 0x89, 0xA1, 0xC1,
+    0x8C, 0x14, 0x13, 0x76, 0xA2, 0x1E, 0x71, 0x9E, 0x16, 0xBE, 0xC0, 0x2D, 0x9C, 0x6E, 0xBF, 0xBD,
+    0xA6, 0xF6, 0xB4, 0x67, 0x17, 0xE0, 0x8E, 0x66, 0x31, 0x93, 0x7D, 0xAB, 0x8E, 0xF5, 0x00, 0x29,
+    0x6E, 0xD8, 0xED, 0xB9, 0x39, 0x6E, 0x81, 0xA4, 0x5F, 0x65, 0x7D, 0xC7, 0x75, 0xF9, 0x58, 0x3E,
+    0x95, 0x80, 0x6B, 0x97, 0x78, 0x96, 0xD2, 0x2E, 0x4B, 0x9B, 0x84, 0xBD, 0x76, 0x61, 0xF9, 0x66,
+    0xC4, 0xF9, 0x36, 0x94, 0x81, 0x35, 0x93, 0xAF, 0x7D, 0x3E, 0x15, 0xE2, 0x59, 0xB2, 0xA6, 0x8A,
+    0x9C, 0xDB, 0xD3, 0xA8, 0x32, 0x3D, 0x77, 0x3E, 0x81, 0x17, 0xEA, 0xA0, 0x92, 0x34, 0xEC, 0xF2,
+    0x42, 0x65, 0x1A, 0xAA, 0x04, 0x03, 0x5A, 0x35, 0x54, 0x11, 0xBB, 0x26, 0x30, 0x30, 0x25, 0x42,
+    0xEE, 0x03, 0x85, 0xC8, 0x52, 0x3E, 0xD1, 0x42, 0x14, 0x12, 0xD5, 0x4C, 0xAF, 0x95, 0x7E, 0xCC,
+    0xA5, 0xC9, 0x6C, 0x96, 0x43, 0xB2, 0x29, 0x12, 0x27, 0x26, 0x29, 0x14, 0x99, 0x42, 0xBA, 0x66,
+    0xD2, 0x33, 0x07, 0x92, 0x07, 0x63, 0xE7, 0xC9, 0xAE, 0xFC, 0xE6, 0xC7, 0x76, 0xCB, 0xE6, 0xC5,
+    0xAE, 0x2F, 0xDF, 0x30, 0x7F, 0xE7, 0x92, 0xF4, 0xAA, 0x24, 0x5D, 0x48, 0x72, 0x7E, 0xFD, 0xE9,
+    0x60, 0x17, 0x9C, 0x77, 0x13, 0x3D, 0x1A, 0xF2, 0x68, 0xD4, 0x14, 0x83, 0x5D, 0x48, 0xAC, 0x51,
+    0x92, 0x8E, 0xD2, 0x6C, 0x68, 0xE8, 0x6F, 0x3F, 0xD4, 0x41, 0xAB, 0x89, 0x52, 0x0A, 0x09, 0x31,
+    0xDD, 0xA8, 0x07, 0xFD, 0x16, 0x21, 0x3A, 0xE4, 0x92, 0xE6, 0x5C, 0x63, 0xB1, 0x66, 0xF2, 0xB4,
+    0x9D, 0x3C, 0x76, 0x6C, 0x47, 0xCC, 0xE4, 0x26, 0x98, 0x6D, 0xDC, 0xF1, 0x33, 0x33, 0x49, 0x9E,
+    0x5E, 0x0A, 0x29, 0x63, 0x4E, 0xA9, 0x7D, 0xF6, 0x98, 0x76, 0xDA, 0xD0, 0x01, 0x6B, 0xE4, 0x29,
+    0x42, 0x1F, 0x31, 0x8B, 0xD5, 0x50, 0x08, 0x49, 0x29, 0x3A, 0xD4, 0xA7, 0x87, 0x38, 0x24, 0x7F,
+    0xC7, 0x27, 0xE7, 0x5A, 0xF9, 0x48, 0x42, 0x7E, 0x4E, 0x71, 0xCA, 0x2C, 0xE5, 0xEC, 0x82, 0x5E,
+    0x90, 0x8D, 0xF5, 0xD0, 0x9F, 0xD0, 0x9D, 0x6A, 0xE9, 0x51, 0x69, 0xAA, 0xB5, 0x62, 0x57, 0xD0,
+    0xF8, 0xA1, 0xDE, 0x0A, 0xE9, 0x6E, 0x69, 0x76, 0x69, 0xE8, 0x4C, 0x29, 0x2A, 0x65, 0xFD, 0x90,
+    0x61, 0x28, 0x27, 0x76, 0xE3, 0x3E, 0xE5, 0x52, 0xB9, 0x82, 0x9B, 0x30, 0xF2, 0xC9, 0xA6, 0x1A,
+    0x70, 0x0B, 0x7C, 0xA9, 0xD9, 0x32, 0x33, 0x6B, 0xCB, 0xD4, 0xAC, 0x6D, 0x7F, 0x01, 0xD0, 0x9F,
+    0x69, 0x73, 0xDC, 0xFF, 0xD6, 0xF7, 0x6C, 0x39, 0x7E, 0x7F, 0xFD, 0x22, 0x64, 0x31, 0x65, 0x8B,
+    0xCD, 0x63, 0x32, 0xC9, 0x4D, 0x44, 0xAF, 0x6B, 0xC6, 0xCC, 0xC8, 0xD7, 0x91, 0x62, 0x42, 0xDE,
+    0xAE, 0x94, 0x13, 0xF2, 0xC5, 0x8A, 0x0D, 0xE9, 0xBD, 0x1A, 0x91, 0x2F, 0x97, 0x7F, 0xE3, 0x3C,
+    0xF2, 0x55, 0x74, 0xF2, 0xE8, 0xE5, 0x7E, 0x6E, 0xC5, 0xED, 0x92, 0x42, 0xBB, 0xD0, 0x4A, 0xEA,
+    0xDC, 0x44, 0x2F, 0x5D, 0xDE, 0x87, 0x0C, 0xF7, 0x5A, 0x4A, 0xA5, 0x58, 0xC8, 0x7B, 0xA4, 0x40,
+    0x29, 0x35, 0xBD, 0xA6, 0xD4, 0x23, 0x77, 0x03, 0x63, 0x37, 0x24, 0x76, 0xE3, 0x63, 0x3F, 0x58,
+    0xAE, 0xFF, 0xC2, 0x6B, 0x87, 0xF7, 0xAF, 0xE7, 0xD9, 0x45, 0x84, 0xA6, 0x50, 0xDA, 0x2D, 0x1A,
+    0x58, 0x92, 0xD0, 0x88, 0x5D, 0x0A, 0x0D, 0xE9, 0x0C, 0xF5, 0x9C, 0xCE, 0x50, 0x68, 0x3B, 0x83,
+    0x7C, 0xBA, 0x44, 0x1B, 0xD2, 0x17, 0xDC, 0x64, 0x57, 0xD0, 0xCB, 0x6D, 0xAC, 0x34, 0xE7, 0x92,
+    0x96, 0x3A, 0x75, 0xD0, 0xC5, 0x4A, 0xC3, 0x75, 0x79, 0x7A, 0xB6, 0xA9, 0x2F, 0x5D, 0x69, 0xF3,
+    0xD2, 0x05, 0xCC, 0xFA, 0xD7, 0xFA, 0xAA, 0xD8, 0xCD, 0x7E, 0x66, 0x2E, 0x44, 0x0F, 0x75, 0xD3,
+    0x86, 0x72, 0x84, 0x73, 0x85, 0x12, 0x5D, 0x76, 0xE3, 0x91, 0x16, 0x4A, 0x88, 0x62, 0xFB, 0xB6,
+    0xD6, 0x6D, 0x26, 0x8C, 0xDB, 0x8D, 0x1D, 0xA1, 0xD0, 0xC5, 0x5A, 0xE9, 0xCB, 0xED, 0x44, 0x8A,
+    0x3D, 0x6B, 0x52, 0xCA, 0xF0, 0xE4, 0xEA, 0xCF, 0xD5, 0xA5, 0x59, 0xF1, 0x78, 0xB7, 0x90, 0xB2,
+    0x44, 0x17, 0x9E, 0x5B, 0xAD, 0xD4, 0xD2, 0xBD, 0xD2, 0xB0, 0x27, 0x70, 0xDB, 0x94, 0x1F, 0x7D,
+    0x04, 0x8C, 0x06, 0xC0, 0xAA, 0x03, 0xAA, 0xCB, 0xFB, 0x9C, 0x75, 0x27, 0xC0, 0x95, 0x5E, 0x0B,
+    0xAD, 0x97, 0x62, 0xA6, 0xB1, 0xD7, 0x65, 0xA3, 0xD1, 0xA8, 0x29, 0x35, 0x1A, 0x35, 0xF6, 0xEA,
+    0x45, 0xA3, 0xA6, 0x1E, 0x30, 0x6A, 0xDA, 0x0E, 0xA3, 0x46, 0x60, 0x74, 0x76, 0x01, 0xA3, 0xFF,
+    0x9C, 0x12, 0x96, 0xCF, 0x60, 0xB6, 0xE4, 0xE5, 0x4F, 0xAD, 0x60, 0x74, 0x8F, 0x1A, 0x8C, 0xCE,
+    0xCA, 0x63, 0xD4, 0xA4, 0x08, 0xDB, 0x36, 0x89, 0x3D, 0x62, 0xD4, 0x54, 0xC2, 0xA8, 0x29, 0xD5,
+    0x55, 0x9A, 0x8D, 0xC6, 0x5E, 0x31, 0xD3, 0x2C, 0xC5, 0xCD, 0x8C, 0x3E, 0xB8, 0xB8, 0x4B, 0x9C,
+    0x57, 0x26, 0x1F, 0xEB, 0x96, 0xDF, 0x3C, 0xE1, 0x41, 0x09, 0x89, 0xE1, 0x42, 0x38, 0x8E, 0xA6,
+    0x38, 0xF1, 0x2A, 0x53, 0xD4, 0x98, 0x14, 0x0B, 0xE9, 0x6D, 0xA9, 0xA9, 0x35, 0xA7, 0x1C, 0x57,
+    0xB8, 0x29, 0xAD, 0xF9, 0x0D, 0x2E, 0xE2, 0x26, 0xAC, 0xBC, 0x51, 0x63, 0x94, 0x82, 0x6E, 0xE5,
+    0x8D, 0x1A, 0x77, 0x25, 0xE2, 0x26, 0xFB, 0x96, 0xBC, 0xD1, 0x3D, 0x4B, 0x15, 0x71, 0x93, 0xCE,
+    0xCA, 0x1B, 0xF5, 0x43, 0x15, 0x71, 0x9A, 0x32, 0x79, 0xA3, 0x85, 0x2A, 0xE2, 0xD4, 0x64, 0xF2,
+    0x46, 0xC3, 0xF5, 0xA7, 0xAE, 0x62, 0x26, 0x75, 0xA5, 0x96, 0x7E, 0x4B, 0x92, 0x2E, 0xDF, 0x4A,
+    0x64, 0x4D, 0xD6, 0x40, 0x39, 0x96, 0x23, 0xD8, 0x60, 0x03, 0x94, 0x73, 0x1D, 0x76, 0x11, 0x01,
+    0xF4, 0x2B, 0xEF, 0x6A, 0xB1, 0xC6, 0x42, 0x6B, 0xAF, 0x58, 0x6A, 0x6D, 0x35, 0x1D, 0x68, 0x2E,
+    0xD4, 0xD1, 0xFA, 0x5C, 0x1E, 0x35, 0x68, 0xC8, 0x04, 0xFD, 0x68, 0x16, 0x70, 0xC1, 0x44, 0xA8,
+    0xE7, 0x72, 0x02, 0x1B, 0xED, 0x08, 0xE5, 0x52, 0x7B, 0x30, 0xAB, 0xEB, 0x20, 0x57, 0x0F, 0x6C,
+    0xB8, 0x4D, 0x1B, 0x8F, 0xFD, 0x77, 0x89, 0xC3, 0x5D, 0x0D, 0xC0, 0xE0, 0x3C, 0xE4, 0x57, 0xB5,
+    0x4F, 0x80, 0x6F, 0x34, 0xEF, 0xA1, 0x01, 0xFE, 0xC7, 0x6D, 0x38, 0xA7, 0x61, 0x77, 0x6F, 0x12,
+    0xAD, 0x34, 0xDA, 0x75, 0xD7, 0xF0, 0x36, 0xB0, 0x97, 0x45, 0x4A, 0x84, 0xF5, 0x91, 0x7D, 0xB0,
+    0x36, 0x07, 0xF2, 0x95, 0x24, 0xE9, 0x69, 0x1D, 0xBF, 0xE2, 0x0E, 0x7B, 0x4B, 0xA8, 0xCC, 0x2E,
+    0xAD, 0x7F, 0xB3, 0x8F, 0xAF, 0x49, 0x8F, 0x26, 0x81, 0x9F, 0x1C, 0x8B, 0xF4, 0x34, 0xF0, 0xE0,
+    0x66, 0x46, 0xAA, 0x49, 0xA0, 0x43, 0x15, 0x36, 0x1A, 0xD8, 0x7F, 0xFA, 0x78, 0xD2, 0xC6, 0x9C,
+    0xD9, 0xC5, 0xDE, 0xF7, 0x09, 0xC7, 0xD8, 0x69, 0x5D, 0xDF, 0xD4, 0x51, 0x47, 0x2F, 0x0D, 0x69,
+    0x6B, 0xD3, 0xC4, 0x00, 0xA3, 0x83, 0x15, 0xA3, 0x36, 0x29, 0x5A, 0xFB, 0xA4, 0xBA, 0x27, 0x72,
+    0x87, 0x1F, 0x27, 0x10, 0x7F, 0xB7, 0x22, 0x96, 0x29, 0x2C, 0x33, 0xD8, 0xE8, 0x14, 0xAA, 0x19,
+    0x12, 0x1A, 0x77, 0xFC, 0x9C, 0x2A, 0x79, 0xF8, 0x9A, 0x3A, 0x32, 0xAD, 0x3B, 0x57, 0xD3, 0x03,
+    0xCD, 0x26, 0x9E, 0x87, 0x12, 0x1A, 0x9B, 0xAD, 0xC9, 0xEA, 0x2F, 0xA7, 0x34, 0x97, 0x98, 0x1B,
+    0x43, 0xD3, 0xB4, 0x4A, 0x5A, 0x2A, 0x69, 0x29, 0xD6, 0x6C, 0x29, 0x56, 0x96, 0x62, 0x25, 0x16,
+    0x2B, 0x73, 0xB1, 0x26, 0xC7, 0xFD, 0xBB, 0xFD, 0x57, 0x7A, 0x82, 0x5E, 0x31, 0xE5, 0x79, 0x38,
+    0x78, 0xB2, 0x49, 0x39, 0x15, 0xB4, 0xD8, 0xF5, 0x6B, 0xAA, 0x43, 0xB6, 0xBA, 0x91, 0xB9, 0x1D,
+    0x92, 0x44, 0x7B, 0xAD, 0x48, 0x0B, 0x52, 0x4C, 0xFB, 0x63, 0x52, 0x68, 0xDC, 0x7A, 0xF6, 0xAF,
+    0x6A, 0x69, 0xBD, 0x4E, 0xCA, 0x1F, 0x11, 0x37, 0xE5, 0x23, 0x8E, 0x84, 0x7E, 0x87, 0xC5, 0xF6,
+    0xCF, 0x3A, 0x5B, 0x76, 0x0E, 0x1B, 0xA9, 0x56, 0xAA, 0x15, 0x1B, 0xC9, 0x77, 0x51, 0x2A, 0xD9,
+    0xFF, 0x8E, 0x62, 0xAE, 0x98, 0x29, 0x62, 0x7F, 0x97, 0xBF, 0x6A, 0xC6, 0x4D, 0xF4, 0xA1, 0xD0,
+    0x50, 0xAB, 0xAB, 0x96, 0xC4, 0x12, 0xDF, 0x69, 0x4F, 0x1A, 0xC8, 0xD3, 0x38, 0x3B, 0xD0, 0xD3,
+    0x4B, 0x0A, 0x58, 0xF3, 0xC0, 0x52, 0xC6, 0xE3, 0x9D, 0x58, 0x4A, 0x1D, 0xD6, 0xF7, 0x52, 0x93,
+    0xC5, 0x52, 0x7D, 0xA4, 0xEE, 0x7A, 0xDF, 0x0F, 0x66, 0x2A, 0xA3, 0x59, 0x71, 0xF4, 0xDE, 0xFD,
+    0xF2, 0xBE, 0x50, 0x46, 0xB3, 0xBA, 0x95, 0xDE, 0xF7, 0xBF, 0x90, 0xAF, 0xD6, 0x3E, 0xF6, 0x53,
+    0x29, 0xA9, 0x58, 0xE8, 0xA5, 0xE6, 0xD4, 0x0D, 0x89, 0x37, 0x0A, 0xAD, 0x58, 0xC5, 0x4A, 0x13,
+    0x85, 0xBA, 0x6A, 0x85, 0x62, 0xA1, 0x9E, 0xA0, 0x9A, 0xD2, 0x60, 0x1B, 0x72, 0x35, 0x64, 0x7A,
+    0xEC, 0x6B, 0xD2, 0xC5, 0x42, 0x52, 0x72, 0x8B, 0xEA, 0x9A, 0x86, 0xF6, 0xDA, 0x53, 0x3A, 0xAB,
+    0x47, 0xD4, 0x94, 0x8B, 0x51, 0xB1, 0x50, 0x4F, 0x65, 0xAC, 0x26, 0xFA, 0xC1, 0x85, 0x76, 0xC8,
+    0x75, 0x56, 0xDF, 0xD1, 0x50, 0xAD, 0x4F, 0xC7, 0x5E, 0xCF, 0x49, 0xBA, 0x24, 0x15, 0x9B, 0x5B,
+    0x62, 0x9F, 0xF7, 0xFA, 0x3D, 0x53, 0x3E, 0xFC, 0x80, 0x34, 0x5E, 0xD3, 0xE6, 0x89, 0x27, 0x30,
+    0x19, 0x1D, 0xAC, 0x0D, 0xEE, 0x37, 0x5B, 0xBA, 0xFF, 0x29, 0x65, 0xCC, 0x30, 0x1A, 0x5C, 0x4C,
+    0xE8, 0xF1, 0x87, 0x4E, 0xF9, 0x90, 0x41, 0xE2, 0xD8, 0xA5, 0x20, 0xC5, 0x14, 0xAF, 0x32, 0xEC,
+    0x82, 0x24, 0x9E, 0x25, 0x3D, 0x76, 0xE9, 0xFA, 0x8C, 0xEB, 0x5D, 0x2F, 0x5F, 0x07, 0xC9, 0xF7,
+    0x53, 0xB5, 0xA2, 0xA9, 0x58, 0xF2, 0xF5, 0xEB, 0xC5, 0x52, 0xCC, 0x14, 0x8B, 0x0D, 0x14, 0x4B,
+    0xE5, 0x29, 0xB6, 0x27, 0x95, 0x8C, 0x14, 0xEB, 0x85, 0x40, 0xB1, 0xD8, 0x48, 0xB1, 0x94, 0x0B,
+    0xC5, 0x62, 0x44, 0xB1, 0xE4, 0xF2, 0xD5, 0xDA, 0x68, 0xEC, 0xE5, 0xDB, 0x59, 0xF2, 0xD5, 0x92,
+    0xBC, 0xD1, 0x19, 0x40, 0xCA, 0x2C, 0xB2, 0x1E, 0xA7, 0x35, 0x5F, 0xF6, 0xA9, 0x64, 0x52, 0x90,
+    0xCD, 0x17, 0xDF, 0xB1, 0x96, 0xE5, 0x92, 0xD1, 0x2A, 0x79, 0xE9, 0x3B, 0xEA, 0xCA, 0x95, 0x76,
+    0xC8, 0xD4, 0x54, 0x53, 0xA6, 0xA1, 0x58, 0x32, 0x4D, 0x99, 0xCE, 0x6A, 0xA1, 0x7D, 0x79, 0x55,
+    0x53, 0xBD, 0xB5, 0xB4, 0x43, 0xB1, 0xC6, 0x6A, 0xCA, 0x14, 0x8B, 0x85, 0x36, 0x66, 0x6A, 0xAA,
+    0x48, 0x3B, 0x14, 0x0B, 0xD5, 0x54, 0xA8, 0x2B, 0xF5, 0x5D, 0x45, 0xAB, 0xB7, 0x25, 0xA3, 0x95,
+    0x5B, 0xF8, 0x0C, 0x14, 0xA1, 0x1C, 0xA1, 0x45, 0x50, 0xCC, 0x55, 0x00, 0xA7, 0x65, 0x77, 0x13,
+    0xB9, 0xFE, 0xD9, 0x50, 0x9F, 0x4C, 0x02, 0xF0, 0x00, 0x7F, 0x62, 0x56, 0x28, 0xFE, 0x2E, 0x25,
+    0x00, 0x0F, 0x50, 0xA6, 0x09, 0x61, 0x05, 0xB2, 0x27, 0x4F, 0x98, 0x29, 0x53, 0xAF, 0x2B, 0x8A,
+    0xB5, 0xA6, 0x76, 0xCE, 0x34, 0x16, 0x2B, 0x2E, 0x64, 0xEA, 0x6C, 0xA4, 0x1D, 0x8D, 0xA8, 0xE6,
+    0xA4, 0x83, 0xBF, 0xFF, 0xC1, 0x76, 0x87, 0x08, 0xA8, 0x4F, 0xB9, 0x2E, 0xED, 0xBC, 0x4F, 0x87,
+    0xD4, 0xEF, 0xB9, 0xDB, 0x69, 0x51, 0x9C, 0xF7, 0x8C, 0x92, 0x56, 0x0B, 0x64, 0x9B, 0x73, 0x73,
+    0x6D, 0x76, 0x48, 0x7C, 0xA6, 0x26, 0xD9, 0xBF, 0xB2, 0xDA, 0xA1, 0x7C, 0x0A, 0x6B, 0xA6, 0xC6,
+    0x3D, 0x3A, 0x15, 0x0B, 0x6B, 0x39, 0x54, 0x53, 0x3E, 0xDD, 0x4A, 0x3B, 0xDC, 0xDA, 0x6D, 0x11,
+    0x3D, 0x85, 0x74, 0x11, 0x2A, 0x69, 0x82, 0x36, 0x65, 0x3A, 0x7A, 0x44, 0x81, 0x62, 0xA1, 0x1F,
+    0xA9, 0x26, 0xE4, 0x69, 0x07, 0x23, 0x32, 0x35, 0x36, 0x52, 0x2C, 0xF4, 0x03, 0xD5, 0x5C, 0x89,
+    0x83, 0xFD, 0xA0, 0x21, 0x93, 0x74, 0xF1, 0x3A, 0xBF, 0x5F, 0x29, 0x0F, 0xF6, 0x3D, 0xC3, 0xC9,
+    0x25, 0x69, 0x74, 0x92, 0x26, 0xFB, 0xBA, 0x5E, 0x5F, 0x4C, 0x70, 0xA1, 0x6E, 0xA2, 0x8D, 0xA5,
+    0xFF, 0x43, 0x23, 0x9A, 0xDD, 0x37, 0x75, 0x75, 0x43, 0xDF, 0x8D, 0x9E, 0x16, 0xC8, 0xF7, 0x03,
+    0x2E, 0xD8, 0x19, 0x1B, 0xCD, 0x82, 0x51, 0x2E, 0x72, 0xFD, 0x22, 0x3D, 0xC1, 0xA1, 0xCB, 0xA5,
+    0xE3, 0x04, 0xDC, 0x1F, 0x20, 0x20, 0x20, 0x42, 0x7F, 0x22, 0x20, 0xA0, 0x8E, 0xEE, 0x44, 0x28,
+    0x40, 0x2B, 0x49, 0x4B, 0x7F, 0xB2, 0x0C, 0x60, 0x63, 0x7B, 0x1C, 0x16, 0xB0, 0x0B, 0x08, 0x58,
+    0xB6, 0x80, 0x00, 0x34, 0x94, 0xBA, 0x5C, 0xBE, 0x47, 0x40, 0xC0, 0xC5, 0x77, 0x70, 0xFC, 0x7F,
+    0xDE, 0x4F, 0x55, 0xC8, 0xF4, 0xC2, 0x8A, 0x5D, 0x5A, 0x4F, 0xFB, 0x46, 0xC4, 0xAC, 0xFD, 0xF6,
+    0x98, 0xBC, 0x55, 0xAF, 0x1F, 0xF5, 0x6F, 0x44, 0xCC, 0xD2, 0x0F, 0xB4, 0x2F, 0x8A, 0x32, 0xBA,
+    0x39, 0xD3, 0x59, 0x5D, 0xEB, 0xDF, 0x2D, 0xE4, 0xE4, 0xB3, 0x46, 0x1A, 0xA9, 0x62, 0xAB, 0x95,
+    0x42, 0xBF, 0x92, 0x3A, 0xB4, 0x16, 0xF2, 0xD4, 0x1A, 0x5C, 0xC4, 0xE8, 0xDF, 0x67, 0x1A, 0x69,
+    0x3D, 0x56, 0x94, 0x29, 0xE5, 0xAF, 0x1A, 0x0A, 0x35, 0x55, 0x00, 0x17, 0xF3, 0x15, 0x32, 0x79,
+    0x37, 0x80, 0x5D, 0x4C, 0x04, 0xFA, 0xD0, 0x76, 0x60, 0x54, 0x4E, 0x80, 0x9B, 0x12, 0x62, 0xF1,
+    0xBD, 0x11, 0xB0, 0x6B, 0xEA, 0x9B, 0x9B, 0xF7, 0x70, 0x7B, 0x06, 0x53, 0xB3, 0xC7, 0x6E, 0x12,
+    0xAF, 0x61, 0x1F, 0x1F, 0xB6, 0xF7, 0x24, 0xDE, 0x2B, 0x75, 0xE5, 0xE2, 0x34, 0x65, 0x0A, 0x9A,
+    0x71, 0x32, 0xEA, 0x0A, 0x8D, 0x75, 0x44, 0xFF, 0xCB, 0x6E, 0x04, 0xA7, 0x47, 0x2E, 0x39, 0x8F,
+    0x51, 0x7A, 0xE4, 0x65, 0x0F, 0xE8, 0xA7, 0x01, 0xCA, 0x65, 0xB9, 0x7E, 0x04, 0x57, 0xA9, 0x43,
+    0x8D, 0xFB, 0x11, 0x9C, 0x5E, 0x0D, 0xE7, 0x00, 0x3B, 0xD8, 0x01, 0x70, 0x9D, 0xEB, 0x00, 0xDD,
+    0xB3, 0xA4, 0xCE, 0x90, 0x38, 0x3A, 0xA9, 0x7A, 0xB7, 0xF0, 0x9E, 0x99, 0xA3, 0x7C, 0xBB, 0xCB,
+    0x1C, 0x35, 0x6E, 0x56, 0x88, 0xDD, 0x1E, 0x05, 0x95, 0x0C, 0x7E, 0x0D, 0x38, 0xB1, 0x99, 0x21,
+    0x76, 0xC1, 0x29, 0xE0, 0x26, 0xB3, 0xCA, 0xA3, 0xC1, 0xBD, 0x22, 0x36, 0x3B, 0xC4, 0x2E, 0x6E,
+    0x68, 0x03, 0xEE, 0xED, 0x25, 0x25, 0x95, 0x1A, 0x0A, 0xB1, 0x19, 0x22, 0x56, 0x03, 0x6D, 0xC0,
+    0x2D, 0x29, 0xDF, 0xD4, 0xB0, 0xB3, 0x1E, 0xAB, 0x78, 0x7D, 0xE6, 0xA8, 0x56, 0xDA, 0x9E, 0xD3,
+    0xB9, 0x0B, 0xE1, 0x4D, 0xA1, 0x63, 0xBB, 0x78, 0xCE, 0x14, 0x09, 0xB0, 0x51, 0x26, 0x37, 0x72,
+    0xEB, 0xAD, 0x90, 0xA6, 0x57, 0x13, 0x8A, 0x00, 0x6D, 0xD3, 0x43, 0x11, 0x7F, 0xFB, 0xF4, 0x6A,
+    0x15, 0xAD, 0x66, 0xA9, 0x93, 0xCE, 0x6A, 0xC8, 0xD5, 0x95, 0x91, 0x7A, 0xA2, 0xF7, 0x85, 0x9A,
+    0x32, 0x66, 0x9A, 0xE8, 0x7D, 0xAB, 0xA6, 0x8C, 0xF5, 0x95, 0x89, 0xFE, 0xA5, 0x37, 0xD5, 0x94,
+    0x6B, 0xAC, 0x26, 0x7A, 0x65, 0x6A, 0x4A, 0xF9, 0x6A, 0xA2, 0x0F, 0x99, 0x9A, 0x32, 0x52, 0x4D,
+    0x99, 0x46, 0xA3, 0xCB, 0x92, 0x97, 0x7E, 0xAA, 0x39, 0x25, 0x41, 0x4A, 0xD9, 0xCA, 0xEC, 0xF1,
+    0x1A, 0x54, 0xF9, 0x7D, 0x30, 0x63, 0xF5, 0xDE, 0xD1, 0xE7, 0xE9, 0x31, 0x39, 0x52, 0x73, 0x1D,
+    0xFA, 0xF9, 0xFA, 0xC5, 0x63, 0x6C, 0x74, 0x34, 0xFA, 0xBF, 0x34, 0xED, 0x82, 0xD1, 0xED, 0x62,
+    0x92, 0x0E, 0x91, 0x8A, 0xFD, 0x53, 0x7A, 0x1E, 0xE9, 0xA7, 0x4A, 0xD2, 0xD8, 0x4B, 0x6A, 0x4E,
+    0x00, 0x05, 0xA7, 0xB6, 0x5E, 0xDB, 0x6B, 0x9F, 0xFC, 0x62, 0xF3, 0x62, 0xE6, 0x82, 0x42, 0x0A,
+    0xB4, 0xD2, 0xF1, 0x91, 0x13, 0x1B, 0x5A, 0x9B, 0x5C, 0x5A, 0xA9, 0x57, 0x4D, 0xB9, 0x32, 0xF9,
+    0x3A, 0xD8, 0x98, 0x8B, 0xDD, 0x46, 0xA6, 0xAE, 0xBF, 0xA6, 0xD0, 0x26, 0xCB, 0x62, 0x39, 0x0E,
+    0x85, 0xC8, 0xFA, 0xD4, 0xD3, 0x14, 0xEB, 0x04, 0x50, 0xDE, 0xAD, 0xC9, 0x2E, 0x68, 0x74, 0x53,
+    0x2E, 0xBF, 0xC1, 0x1F, 0x55, 0xB4, 0xCB, 0x17, 0xFA, 0xD1, 0xBD, 0xF5, 0x1B, 0x35, 0xFA, 0x99,
+    0xA2, 0xD1, 0xD3, 0xF2, 0x56, 0x8A, 0x38, 0xC9, 0xA3, 0x6B, 0xF7, 0x79, 0xA3, 0xE6, 0x5F, 0xBD,
+    0x1B, 0x66, 0xB9, 0x01, 0x94, 0xE3, 0x06, 0x50, 0x7E, 0x23, 0x7B, 0x92, 0x7A, 0x71, 0x29, 0x0C,
+    0x3D, 0xB4, 0x1F, 0xF8, 0x61, 0x1F, 0x07, 0x36, 0x1A, 0xD9, 0xFB, 0xA2, 0x51, 0x79, 0x65, 0x36,
+    0xBA, 0x47, 0xD7, 0x3F, 0xEC, 0x63, 0xC5, 0xE8, 0xB1, 0xFB, 0x31, 0xA2, 0xEC, 0x8C, 0xC8, 0xDE,
+    0xEF, 0x61, 0x1F, 0x69, 0xF5, 0xAA, 0xFC, 0x96, 0x87, 0xCE, 0xBD, 0x24, 0x29, 0x4A, 0xD2, 0x4B,
+    0xA9, 0x46, 0xAF, 0x1F, 0x35, 0xEE, 0x03, 0xA5, 0x00, 0x78, 0x9F, 0x8D, 0x8E, 0x6C, 0xCB, 0x18,
+    0xBD, 0x05, 0x8B, 0xC0, 0xB9, 0x2D, 0xE0, 0x21, 0x3D, 0x92, 0xD4, 0xAC, 0xDB, 0x14, 0xFB, 0x1D,
+    0x69, 0x2D, 0xD6, 0x44, 0x06, 0x68, 0xC7, 0x14, 0xB5, 0xF1, 0x9E, 0xBB, 0x85, 0xFE, 0x81, 0x5E,
+    0xD1, 0x24, 0x4E, 0xB8, 0xF4, 0x1B, 0x49, 0xFA, 0x45, 0x02, 0xB1, 0xAE, 0x3D, 0x15, 0x8D, 0x1A,
+    0x1B, 0xEC, 0x42, 0xBD, 0x43, 0x99, 0xB3, 0xC9, 0xA8, 0xC9, 0xB0, 0x0B, 0x9C, 0x6A, 0xAF, 0x9E,
+    0xC7, 0x49, 0x01, 0x29, 0x25, 0x87, 0xFB, 0x2D, 0x28, 0xF3, 0x08, 0x95, 0x16, 0xF2, 0x2D, 0xF3,
+    0xDC, 0xB8, 0x07, 0x48, 0xF4, 0xAB, 0xCD, 0x63, 0xB7, 0x66, 0xEA, 0x5C, 0xD3, 0x8E, 0x76, 0xA8,
+    0x66, 0x13, 0x8A, 0x95, 0x6F, 0xFD, 0x6B, 0x7D, 0x1F, 0x2B, 0x79, 0x93, 0x34, 0xC3, 0xED, 0x69,
+    0x5C, 0xED, 0x98, 0x2A, 0x5F, 0xE9, 0x09, 0xEA, 0x24, 0x0D, 0x4F, 0xBF, 0xF3, 0x2F, 0xAE, 0x69,
+    0x13, 0x77, 0xF5, 0x81, 0x15, 0xA3, 0xC6, 0x0E, 0xB8, 0x89, 0x05, 0xA3, 0xA6, 0xF4, 0xB8, 0x89,
+    0xD3, 0xFB, 0x74, 0x08, 0x87, 0xE9, 0xA1, 0x10, 0xC3, 0x4E, 0x3F, 0x96, 0x56, 0xDC, 0x7C, 0xA0,
+    0xC9, 0xA8, 0x29, 0xE4, 0xDD, 0xB4, 0x65, 0x2A, 0xD7, 0xE0, 0x26, 0xEC, 0xB2, 0x6D, 0xCE, 0xD8,
+    0xA5, 0xD2, 0x8C, 0x5E, 0x92, 0xBC, 0x8D, 0xDA, 0x25, 0x78, 0xA9, 0xA7, 0x63, 0x04, 0x7C, 0x80,
+    0xAC, 0x9F, 0xC1, 0x6A, 0xD9, 0x21, 0x1D, 0x3B, 0x1D, 0x2B, 0xDF, 0xE5, 0x4C, 0x18, 0x0A, 0x1D,
+    0xF5, 0x4D, 0x11, 0x79, 0x86, 0x2A, 0x64, 0x81, 0xD6, 0x67, 0x69, 0x0E, 0x2C, 0xD6, 0xFE, 0x62,
+    0x52, 0x5B, 0x5A, 0x69, 0xCE, 0xD4, 0xF4, 0x53, 0x11, 0x13, 0x91, 0x41, 0xBE, 0xF5, 0x46, 0x85,
+    0x2E, 0xDA, 0xD8, 0xCB, 0xD7, 0xBF, 0x4E, 0x8F, 0x45, 0x4B, 0x3D, 0xD4, 0xCE, 0x9B, 0xD6, 0x6B,
+    0xB4, 0xE9, 0x22, 0x17, 0xD4, 0x24, 0x47, 0x7E, 0xFE, 0xE4, 0x3E, 0x22, 0x27, 0x03, 0x75, 0xA5,
+    0xD4, 0xD9, 0x89, 0x76, 0x36, 0xD2, 0x68, 0x45, 0xAD, 0xA6, 0xD7, 0x50, 0xCA, 0x17, 0x0A, 0xC9,
+    0x11, 0xC5, 0x2B, 0x0B, 0x2E, 0x98, 0xF5, 0x2F, 0xC1, 0x79, 0x1B, 0x33, 0xA5, 0xD4, 0x84, 0x4A,
+    0xCC, 0x28, 0x21, 0xDF, 0x26, 0x77, 0x94, 0x0B, 0x29, 0x39, 0xE3, 0x72, 0xFF, 0x72, 0x61, 0xD8,
+    0x3D, 0xC6, 0x2F, 0xEC, 0x80, 0xCA, 0x15, 0xA0, 0x5E, 0xFB, 0x6B, 0xF2, 0x40, 0x15, 0x6D, 0x7A,
+    0x46, 0x87, 0x5D, 0x53, 0xC2, 0x1C, 0x4A, 0x21, 0xDF, 0x06, 0x28, 0xD4, 0xB9, 0x60, 0x05, 0x46,
+    0xDE, 0xC6, 0x4C, 0x23, 0x46, 0x83, 0x11, 0x6E, 0x21, 0x57, 0x40, 0xBE, 0x90, 0xCF, 0x15, 0x72,
+    0xA9, 0xE9, 0x63, 0xAE, 0x29, 0x55, 0xFC, 0x65, 0x4D, 0x48, 0x13, 0x5A, 0x36, 0x4B, 0xF1, 0x60,
+    0xFF, 0xF4, 0x3C, 0xB7, 0x5B, 0xA4, 0xF7, 0x79, 0xE9, 0xCC, 0xDE, 0xAC, 0xDA, 0x3B, 0xA6, 0xAB,
+    0xDD, 0x52, 0x91, 0x77, 0x29, 0x16, 0xFC, 0x2F, 0x50, 0xE7, 0xE4, 0xDD, 0x58, 0xAD, 0x46, 0xB3,
+    0x55, 0xA6, 0x50, 0x2E, 0xB9, 0xC2, 0x1F, 0xF6, 0xBE, 0xF5, 0xEE, 0x6F, 0xC9, 0x96, 0x22, 0x96,
+    0x01, 0xCA, 0xD0, 0xFA, 0x05, 0x70, 0xF7, 0xC6, 0xBA, 0x63, 0xB3, 0xB2, 0x76, 0x3E, 0x24, 0xEC,
+    0xD2, 0xBF, 0xB2, 0x42, 0xAE, 0x22, 0xD6, 0x13, 0xB4, 0x63, 0xEB, 0xE5, 0xB1, 0x4B, 0x11, 0xCB,
+    0x95, 0x5C, 0xBE, 0xF5, 0x6E, 0xA2, 0x0F, 0xE5, 0x9A, 0xCB, 0xD7, 0xAB, 0x51, 0xB4, 0xBA, 0x27,
+    0x5D, 0x37, 0x9E, 0x3A, 0x91, 0x06, 0x73, 0xA3, 0x9F, 0xEC, 0x13, 0x18, 0xE4, 0xF3, 0xF5, 0xB5,
+    0x0E, 0xFF, 0x1D, 0xD5, 0xBD, 0x4F, 0xAC, 0xE5, 0xC6, 0x7D, 0xEF, 0xF9, 0x21, 0x4B, 0x7D, 0x99,
+    0x34, 0xC7, 0x2E, 0x2D, 0xD4, 0x1E, 0x5B, 0x7A, 0x31, 0xB3, 0xC8, 0x22, 0xE3, 0x97, 0x98, 0x9B,
+    0x87, 0x81, 0x07, 0xC8, 0x73, 0xB1, 0x25, 0x04, 0x5A, 0x68, 0xA1, 0x7E, 0x83, 0x3E, 0xCF, 0x48,
+    0x34, 0x33, 0x9D, 0x85, 0x03, 0xBC, 0x28, 0x78, 0x68, 0x2F, 0x3C, 0x40, 0x16, 0x96, 0x49, 0x49,
+    0xC8, 0x78, 0xA1, 0x85, 0x7B, 0x00, 0x2B, 0xF3, 0x30, 0x33, 0x80, 0x1B, 0x33, 0x0A, 0x10, 0x5D,
+    0x2D, 0x94, 0x45, 0x16, 0x99, 0x07, 0x47, 0xA4, 0xD4, 0x78, 0x10, 0x30, 0x5A, 0x88, 0xB2, 0xE0,
+    0x68, 0x91, 0x85, 0x69, 0xBB, 0xED, 0x24, 0xD2, 0xA2, 0x4B, 0x36, 0x65, 0xB1, 0x5B, 0x55, 0xFC,
+    0xCE, 0xA2, 0x78, 0xCE, 0xBD, 0x2D, 0xC9, 0x23, 0x39, 0x91, 0xE7, 0x79, 0xCE, 0xBD, 0x97, 0xE4,
+    0xE1, 0xAD, 0x43, 0x56, 0xFD, 0x58, 0xF5, 0xFB, 0xFB, 0xFD, 0xFD, 0x0E, 0xD9, 0x1F, 0x41, 0x2E,
+    0x8D, 0xF4, 0x92, 0x2F, 0x24, 0x4D, 0xD5, 0x9C, 0x6B, 0x68, 0x1B, 0xA3, 0xF3, 0x01, 0x1B, 0xCD,
+    0x84, 0xF3, 0x59, 0x83, 0x06, 0x28, 0x23, 0xD0, 0x4E, 0x94, 0x12, 0x54, 0x5A, 0xC1, 0x49, 0xC0,
+    0xE5, 0x15, 0xA8, 0x03, 0xE0, 0xE6, 0xDF, 0x06, 0xBD, 0xBA, 0x60, 0x74, 0x79, 0xA6, 0x0E, 0xFD,
+    0x9C, 0xE9, 0x15, 0xAD, 0xFD, 0x9A, 0x4B, 0x9A, 0x32, 0x69, 0x81, 0x4F, 0xF4, 0x00, 0x01, 0x30,
+    0x33, 0x7C, 0xFC, 0xD2, 0x08, 0xAD, 0x20, 0xD3, 0x0C, 0xF9, 0xCA, 0xF6, 0xFA, 0xC4, 0xD3, 0x64,
+    0xD2, 0x54, 0x4A, 0xA1, 0xBA, 0xD9, 0x86, 0xAA, 0xB3, 0xF1, 0x0C, 0x65, 0x00, 0x1B, 0x38, 0x77,
+    0x79, 0xA6, 0xD6, 0x48, 0xAD, 0x99, 0xB3, 0x7D, 0x84, 0x42, 0x05, 0x46, 0x75, 0x67, 0xE4, 0xC6,
+    0x32, 0xBA, 0xB5, 0x0F, 0x55, 0x1A, 0x4D, 0xC3, 0x7F, 0x39, 0x43, 0x9E, 0xFE, 0xF2, 0x37, 0x3C,
+    0x46, 0x13, 0xB9, 0x3A, 0xB8, 0x98, 0x6E, 0x73, 0x86, 0x5E, 0x91, 0x76, 0x90, 0x42, 0xA6, 0xA9,
+    0xD7, 0x75, 0xA3, 0xC9, 0xA8, 0x29, 0x35, 0x19, 0x35, 0xF6, 0xE6, 0x15, 0xA3, 0xA6, 0x1E, 0x31,
+    0x6A, 0xDA, 0x0E, 0xA3, 0x46, 0x60, 0x74, 0x3E, 0x82, 0xD1, 0xFF, 0x12, 0xC0, 0x48, 0x0B, 0x18,
+    0x29, 0x80, 0xD1, 0x33, 0x2B, 0x18, 0xDD, 0xA7, 0x06, 0xA3, 0xF3, 0x1A, 0x30, 0x6A, 0x34, 0x61,
+    0xD4, 0xB4, 0x33, 0x46, 0x8D, 0x0B, 0x18, 0x35, 0x95, 0x30, 0x6A, 0x4A, 0x75, 0x95, 0x16, 0xA3,
+    0xA9, 0x57, 0xC8, 0xB4, 0x48, 0x81, 0x56, 0x00, 0x85, 0x60, 0x4F, 0x86, 0x2C, 0x9E, 0x6C, 0x09,
+    0xA7, 0xB6, 0xBF, 0x01, 0x1C, 0x75, 0xBD, 0x86, 0xDA, 0x4B, 0x43, 0x3F, 0x57, 0x2B, 0x9A, 0x8B,
+    0x98, 0xAF, 0x7F, 0x50, 0xC4, 0x62, 0xA1, 0x88, 0xD6, 0x53, 0xC4, 0x6A, 0xA0, 0x90, 0x06, 0x0A,
+    0x69, 0xA2, 0x58, 0x2F, 0x7B, 0x8A, 0x68, 0x03, 0x45, 0x2C, 0x23, 0x45, 0x34, 0xA2, 0x88, 0xB9,
+    0x86, 0x6A, 0x6D, 0x34, 0xF5, 0x1A, 0xDA, 0x45, 0x1A, 0xEA, 0x15, 0x30, 0x2B, 0x90, 0x47, 0x20,
+    0x0B, 0x87, 0x7B, 0x06, 0x80, 0x3F, 0x01, 0xA0, 0x29, 0xA5, 0x31, 0x53, 0x23, 0x05, 0x5C, 0x28,
+    0xB5, 0x36, 0xA5, 0x06, 0xA3, 0x06, 0x05, 0xDC, 0x4C, 0xFD, 0xA3, 0xCE, 0xA8, 0x31, 0x0B, 0xB8,
+    0xD9, 0xB7, 0x60, 0xF4, 0xA0, 0xF5, 0xE0, 0xE6, 0x37, 0x23, 0x18, 0x5D, 0x6A, 0x07, 0x70, 0x7B,
+    0xBA, 0x69, 0x00, 0x77, 0xEB, 0x1D, 0x81, 0xD1, 0x83, 0xF5, 0x0C, 0x6E, 0x7E, 0x53, 0x03, 0x46,
+    0x0F, 0xDA, 0x35, 0x5D, 0x60, 0xC6, 0xA8, 0x31, 0x1A, 0x70, 0x33, 0xD5, 0x8A, 0x51, 0x83, 0xE6,
+    0x4C, 0xEA, 0x0A, 0x8D, 0xBD, 0x02, 0xB5, 0x1E, 0x94, 0x06, 0xFA, 0x05, 0xD8, 0x9E, 0x6A, 0x76,
+    0xB5, 0xD6, 0x94, 0xCB, 0x6A, 0xCE, 0x34, 0xB4, 0x1E, 0xF9, 0x22, 0xD0, 0xFE, 0x87, 0x4C, 0xBF,
+    0xE9, 0x1A, 0xDA, 0x97, 0xED, 0x40, 0xF5, 0x93, 0x97, 0x46, 0x0A, 0xC9, 0x93, 0x49, 0x2B, 0xB4,
+    0xDF, 0x6D, 0x07, 0xAA, 0x9F, 0xBC, 0x18, 0x28, 0x82, 0x57, 0x93, 0xE9, 0xAE, 0xDA, 0xD3, 0x0E,
+    0x66, 0xA5, 0x5D, 0xE8, 0xA7, 0x5E, 0x9D, 0x8D, 0x4E, 0x53, 0xA6, 0x01, 0x38, 0xD3, 0x7C, 0x98,
+    0x89, 0x23, 0x85, 0x7A, 0x44, 0x0A, 0xAE, 0xC3, 0xA8, 0xE9, 0xC1, 0xA8, 0x89, 0x60, 0xF4, 0x67,
+    0x1F, 0xF5, 0xC4, 0x59, 0x01, 0x8E, 0xAE, 0x70, 0x06, 0x28, 0x34, 0x40, 0x29, 0x0F, 0xB9, 0x02,
+    0x90, 0x0B, 0xA0, 0x1F, 0x80, 0xDA, 0x73, 0x77, 0x26, 0x4D, 0xCE, 0xB7, 0x5A, 0x5C, 0xA0, 0x1F,
+    0x2A, 0x51, 0x7B, 0x7B, 0xB3, 0x2B, 0x43, 0x39, 0x93, 0xCB, 0x2C, 0xD0, 0xBF, 0x10, 0xA0, 0xD6,
+    0x0A, 0xA5, 0x34, 0x92, 0xEB, 0x52, 0x80, 0xFE, 0x79, 0x75, 0xD4, 0xDE, 0x79, 0xCA, 0x50, 0x88,
+    0x5C, 0x68, 0xCA, 0x35, 0x55, 0x6B, 0xA1, 0x35, 0xD7, 0xF7, 0xA5, 0xAE, 0x0E, 0x07, 0xEA, 0x43,
+    0xD6, 0x58, 0x49, 0x63, 0xB9, 0x18, 0x49, 0xBE, 0x14, 0x92, 0xAE, 0x17, 0x1A, 0xDD, 0x3F, 0x6A,
+    0x34, 0xF2, 0xD6, 0xBB, 0x39, 0xD7, 0x7F, 0x67, 0x16, 0x1B, 0x11, 0x44, 0xA3, 0xA6, 0x6F, 0x38,
+    0x8B, 0x46, 0xD7, 0x01, 0x6E, 0xAE, 0x07, 0xC0, 0xC6, 0x4B, 0x23, 0x60, 0x24, 0x0F, 0x20, 0x09,
+    0xC0, 0xDD, 0xD2, 0x08, 0xD8, 0x68, 0x03, 0x60, 0x74, 0xAF, 0x3A, 0x40, 0xA3, 0x9B, 0x01, 0x37,
+    0x97, 0x02, 0x6C, 0x44, 0x1E, 0x8C, 0x9A, 0x7A, 0x05, 0x34, 0x1A, 0x4D, 0x64, 0x52, 0xD7, 0x46,
+    0x72, 0xC9, 0x97, 0x9A, 0x90, 0x02, 0x7D, 0x5A, 0x4C, 0xD9, 0x85, 0xB4, 0xBB, 0x6A, 0xA5, 0x90,
+    0xCB, 0x48, 0xCA, 0x35, 0x4A, 0x2B, 0x9A, 0xDD, 0xA3, 0x6A, 0xFA, 0xFF, 0x60, 0xC7, 0x76, 0x6C,
+    0x3B, 0xE3, 0xAB, 0xD9, 0x0D, 0x7C, 0xA5, 0x88, 0xD5, 0x00, 0x59, 0xEA, 0x57, 0xAB, 0x15, 0xA8,
+    0x6E, 0xF6, 0x03, 0x69, 0x75, 0x91, 0xE9, 0x5E, 0x35, 0xD0, 0x8E, 0xCE, 0x43, 0x35, 0x97, 0x82,
+    0x6A, 0x6D, 0x34, 0xE1, 0xE4, 0xAB, 0x95, 0x4A, 0x21, 0xD3, 0x08, 0x70, 0xA6, 0xE9, 0x15, 0x8D,
+    0xE4, 0x95, 0x76, 0xBD, 0xE6, 0x5C, 0x1A, 0x8D, 0x3A, 0xAA, 0x88, 0x51, 0x83, 0x0D, 0x1F, 0xB0,
+    0xEB, 0xA8, 0x02, 0x46, 0x92, 0xDE, 0xBB, 0xEB, 0x3E, 0xF8, 0xE3, 0x87, 0xAB, 0xD8, 0x48, 0xA5,
+    0x85, 0x5E, 0x4B, 0xEA, 0x52, 0x48, 0x5D, 0x4A, 0xF4, 0xB1, 0x69, 0x57, 0xA6, 0x05, 0x56, 0xCE,
+    0x00, 0x14, 0x69, 0x67, 0xFC, 0xE9, 0x1D, 0x57, 0x53, 0x13, 0x05, 0xAB, 0x20, 0x0D, 0xD2, 0xA3,
+    0x9A, 0x72, 0x8D, 0x45, 0xA4, 0x5A, 0x68, 0xC7, 0x4C, 0xDD, 0xE9, 0x43, 0x49, 0x0B, 0xAD, 0xA4,
+    0xAE, 0xD0, 0x71, 0xFF, 0x3E, 0x0D, 0x22, 0xD5, 0x92, 0x69, 0xCE, 0x75, 0xB3, 0xD7, 0x20, 0x49,
+    0xC1, 0xA6, 0x59, 0x50, 0x4F, 0x40, 0xB6, 0x02, 0x54, 0xE3, 0x81, 0x3B, 0xD9, 0x01, 0xE0, 0x2B,
+    0x69, 0x08, 0x7A, 0x47, 0x9A, 0xAD, 0xA4, 0x37, 0xA4, 0xA6, 0x96, 0xD4, 0x69, 0xA2, 0xD0, 0x33,
+    0x31, 0x0D, 0xBB, 0x98, 0x6D, 0x04, 0xE7, 0xAB, 0xD1, 0xCD, 0xA0, 0xA1, 0x45, 0x23, 0x46, 0x3C,
+    0xB5, 0x51, 0x05, 0xBB, 0x42, 0xEB, 0xC1, 0x29, 0x31, 0x29, 0x49, 0x12, 0x7B, 0xF2, 0x62, 0x57,
+    0x70, 0x1E, 0xD2, 0xA7, 0xD9, 0x3E, 0xCD, 0xE1, 0xD3, 0xF1, 0x5D, 0xFF, 0x9E, 0x30, 0x6A, 0x36,
+    0x22, 0x4F, 0x79, 0xEA, 0xDA, 0x60, 0xA5, 0x31, 0x09, 0xD0, 0x13, 0xBA, 0x6D, 0x84, 0xD3, 0xF3,
+    0x9A, 0x72, 0x29, 0x14, 0x91, 0x6A, 0xA9, 0x87, 0x76, 0xCC, 0xF4, 0x68, 0x7A, 0x53, 0x75, 0xED,
+    0x98, 0xE9, 0x51, 0x9F, 0xC8, 0x97, 0xE8, 0x47, 0x22, 0x60, 0x22, 0x1B, 0x89, 0x84, 0xB7, 0xBD,
+    0xC9, 0x34, 0xE7, 0xBA, 0x4E, 0xAF, 0x41, 0x1A, 0xAC, 0x82, 0x55, 0xA0, 0x97, 0x24, 0x35, 0x69,
+    0x48, 0x8A, 0x50, 0x4A, 0x92, 0x26, 0x40, 0x3F, 0xDC, 0xB5, 0x0B, 0x69, 0x38, 0xFD, 0x94, 0x96,
+    0x54, 0xAE, 0xB4, 0x38, 0x29, 0x57, 0x00, 0x8D, 0xD4, 0xEF, 0x6D, 0xF2, 0xBF, 0x3E, 0x9D, 0x9A,
+    0x48, 0xEA, 0xD0, 0x48, 0x2D, 0x25, 0xD1, 0xD0, 0x4B, 0x1A, 0xD2, 0x55, 0x2A, 0x35, 0xE9, 0x2A,
+    0x56, 0xDB, 0x55, 0xEA, 0xB0, 0x5D, 0xC5, 0xF9, 0xED, 0x46, 0x1A, 0x53, 0x93, 0xC4, 0x08, 0xDD,
+    0x82, 0x0D, 0x95, 0x96, 0x42, 0x2B, 0xEE, 0xC7, 0x92, 0x6F, 0x15, 0xD0, 0xCB, 0xD2, 0xF3, 0x92,
+    0x2F, 0xF6, 0x1A, 0x83, 0x9B, 0x37, 0xEE, 0xA3, 0x21, 0x1D, 0x54, 0x69, 0xE2, 0x72, 0x94, 0xD6,
+    0x1B, 0x56, 0x71, 0x6B, 0xA9, 0x2E, 0x1D, 0xDC, 0x7D, 0x65, 0x4F, 0x7B, 0xEA, 0xF4, 0x9C, 0xAD,
+    0x24, 0xF9, 0x44, 0xD6, 0x11, 0x8A, 0x88, 0xF3, 0x90, 0xA9, 0xB1, 0x01, 0x68, 0x47, 0xB3, 0x02,
+    0xD5, 0x8C, 0xFE, 0xF4, 0x29, 0x8A, 0x88, 0x93, 0xA6, 0x4C, 0x8D, 0x95, 0x44, 0x3B, 0x1A, 0xFD,
+    0x48, 0x53, 0x35, 0xA3, 0xA1, 0x0A, 0x45, 0xC4, 0xF9, 0x5C, 0xE7, 0xD5, 0xD8, 0x40, 0x3B, 0xB5,
+    0xA3, 0x11, 0x36, 0xB4, 0x37, 0x33, 0x4D, 0x46, 0xBD, 0x5E, 0xD0, 0x8A, 0x24, 0xDF, 0xAB, 0x71,
+    0x53, 0xEA, 0x5D, 0x5A, 0x5F, 0x45, 0xEA, 0xA3, 0xD1, 0x36, 0x96, 0x26, 0xED, 0x3A, 0x80, 0x7F,
+    0x99, 0x46, 0x66, 0xB7, 0xEE, 0x3F, 0x0D, 0x70, 0xE6, 0x6A, 0x1A, 0xA2, 0x07, 0xE8, 0xD7, 0x0E,
+    0xA8, 0xD4, 0x7C, 0xAA, 0x21, 0xD3, 0x64, 0x35, 0x61, 0x63, 0x26, 0x4D, 0x68, 0xB2, 0x37, 0x35,
+    0x16, 0x42, 0x83, 0x86, 0x7A, 0x29, 0x62, 0xAE, 0x46, 0x63, 0xED, 0x8B, 0xB5, 0x10, 0x1A, 0xAA,
+    0x50, 0x05, 0x23, 0x5A, 0xDF, 0x7B, 0x1B, 0x32, 0xBD, 0xA0, 0xC1, 0xF9, 0x62, 0x2D, 0x85, 0x86,
+    0x6A, 0xA9, 0x82, 0x11, 0xFD, 0xE8, 0xE6, 0x32, 0x1A, 0x21, 0x6F, 0x97, 0x6A, 0xCE, 0x34, 0xD6,
+    0xBE, 0x1F, 0x8C, 0x06, 0xF7, 0x76, 0xC0, 0x68, 0x6C, 0x35, 0x62, 0x74, 0x53, 0xEB, 0x99, 0x31,
+    0xDF, 0x26, 0x56, 0xAF, 0x37, 0xB4, 0xC0, 0x99, 0x0B, 0xEC, 0x20, 0xFB, 0x0B, 0xC0, 0x68, 0x82,
+    0x4C, 0xE3, 0x5D, 0xD0, 0x8F, 0xF5, 0x4A, 0x35, 0x57, 0x0A, 0x46, 0x26, 0xB4, 0xA3, 0x1B, 0xFB,
+    0xC7, 0x55, 0x06, 0x3B, 0xD7, 0xBE, 0x1F, 0x74, 0x5E, 0x36, 0x54, 0x73, 0xE5, 0x35, 0xE8, 0xFC,
+    0x76, 0xB6, 0x1D, 0xF5, 0x78, 0x34, 0x2A, 0x42, 0x3B, 0xD4, 0x4B, 0x7D, 0xC3, 0xA3, 0x59, 0xE1,
+    0x0E, 0x23, 0x49, 0x63, 0x5A, 0x0B, 0xD9, 0x2E, 0xBB, 0x08, 0x9C, 0xF9, 0x73, 0xC8, 0xA5, 0xEB,
+    0xD4, 0x52, 0x40, 0x52, 0x30, 0xBA, 0x7E, 0x4F, 0x28, 0x85, 0x09, 0x36, 0x60, 0x96, 0x7A, 0x21,
+    0x9F, 0xDD, 0x0C, 0x8D, 0xF3, 0xA4, 0x55, 0x9E, 0x36, 0xFD, 0xBB, 0x36, 0x33, 0xD0, 0x2E, 0x80,
+    0x0B, 0x80, 0x13, 0x50, 0x69, 0xE2, 0x53, 0xA5, 0x12, 0x7F, 0x4C, 0x8B, 0x68, 0x49, 0x92, 0x92,
+    0x6A, 0x02, 0xCA, 0x09, 0x28, 0x3D, 0x94, 0x97, 0x26, 0xB0, 0x1A, 0xB7, 0xC7, 0xB5, 0x3D, 0x56,
+    0x20, 0x7F, 0x9A, 0x2C, 0xB1, 0xA4, 0x7B, 0x75, 0x63, 0xAD, 0x16, 0x1B, 0x34, 0xD4, 0x7F, 0xBF,
+    0xD2, 0xD6, 0x33, 0xF4, 0x63, 0x62, 0x21, 0x6B, 0x52, 0xA7, 0x7B, 0x4F, 0x26, 0x8F, 0xD1, 0xCD,
+    0x87, 0x5E, 0x94, 0x54, 0x48, 0x4B, 0x2E, 0x75, 0x5C, 0xEE, 0xE0, 0xAB, 0x90, 0x2D, 0x14, 0xCF,
+    0x8E, 0xD4, 0x4A, 0xFD, 0x3F, 0xB7, 0x71, 0xAB, 0x45, 0x92, 0xF4, 0x03, 0x49, 0xD2, 0xD7, 0x6F,
+    0x5D, 0x5A, 0xFF, 0x38, 0xBA, 0xC1, 0xCD, 0xC5, 0xBC, 0xA2, 0xB1, 0x7A, 0x75, 0x36, 0x6A, 0xDA,
+    0xBC, 0xB3, 0x91, 0xA7, 0xF6, 0x6B, 0x46, 0xE3, 0xB6, 0x90, 0x13, 0xE3, 0xFA, 0x39, 0x4F, 0x1F,
+    0x49, 0x13, 0x38, 0x69, 0x20, 0xDB, 0xA4, 0x74, 0x12, 0x19, 0xB5, 0x07, 0x68, 0x3B, 0x80, 0x78,
+    0x22, 0x26, 0x12, 0x9B, 0x3E, 0xBB, 0x5F, 0xB5, 0x92, 0xA2, 0x93, 0x14, 0xD2, 0xE6, 0x79, 0x3D,
+    0x1A, 0xDC, 0xA3, 0x7A, 0x34, 0xB8, 0xF3, 0x7A, 0x34, 0x54, 0x99, 0xBA, 0x39, 0x4D, 0xFF, 0xFF,
+    0xF7, 0x4D, 0xA1, 0x65, 0x33, 0x46, 0x12, 0x43, 0x3D, 0xA5, 0xC3, 0xC6, 0xDB, 0x75, 0xD8, 0xBF,
+    0xA6, 0x55, 0x2C, 0x15, 0x7B, 0x05, 0xAB, 0xE8, 0x34, 0x17, 0x9A, 0x0B, 0x0D, 0xF4, 0x5D, 0xA6,
+    0x11, 0x81, 0x7C, 0xBE, 0x42, 0x3B, 0x9B, 0x00, 0x75, 0x28, 0x67, 0xB0, 0xD1, 0x4E, 0x50, 0xA8,
+    0x1E, 0xC0, 0xA8, 0xED, 0x80, 0x34, 0xCE, 0x3E, 0x91, 0x25, 0x8D, 0x76, 0xF9, 0xC0, 0x6D, 0x2E,
+    0x4D, 0x60, 0x25, 0xBF, 0xDF, 0x26, 0x8D, 0x5F, 0x8F, 0x29, 0x3A, 0xCD, 0xB5, 0x06, 0x2D, 0xB4,
+    0x93, 0x51, 0x67, 0x02, 0x75, 0xA0, 0xED, 0xD0, 0x60, 0x67, 0xCA, 0x35, 0x13, 0xB4, 0xBE, 0x1E,
+    0x31, 0x32, 0x01, 0xAA, 0xB9, 0xED, 0x40, 0x5F, 0xF7, 0x50, 0x86, 0x15, 0x70, 0x1A, 0x20, 0xD7,
+    0x92, 0x56, 0x3F, 0x20, 0x7F, 0xE0, 0x25, 0xED, 0xF8, 0x7E, 0x87, 0xFD, 0x08, 0xB4, 0x1A, 0xA1,
+    0x54, 0x04, 0x76, 0xBB, 0xE6, 0x03, 0x09, 0x33, 0xE5, 0x2B, 0x38, 0x6F, 0x02, 0xD4, 0x4B, 0x39,
+    0x83, 0x0D, 0x76, 0x82, 0x62, 0x4D, 0x84, 0x71, 0xEF, 0x22, 0x8C, 0x93, 0xE2, 0x7E, 0x7B, 0xAE,
+    0x8D, 0x17, 0x3F, 0x6A, 0xC2, 0x78, 0xCA, 0xC8, 0x7B, 0x08, 0xD3, 0x80, 0x9E, 0xF0, 0x50, 0x84,
+    0x08, 0xB8, 0x1B, 0x07, 0xC2, 0x58, 0xB1, 0x4D, 0xD3, 0x4D, 0xB5, 0xF9, 0xF0, 0x84, 0xA9, 0xA4,
+    0xFB, 0xA4, 0x5C, 0x9A, 0x9D, 0x7C, 0xA5, 0x98, 0x29, 0x52, 0x89, 0x22, 0x42, 0x1B, 0x50, 0x47,
+    0xAE, 0xD1, 0x4D, 0x50, 0xAA, 0x0C, 0x80, 0x8B, 0x4A, 0x2A, 0xEB, 0x08, 0x14, 0x9A, 0x01, 0xEA,
+    0x64, 0xD1, 0xA5, 0xB1, 0x25, 0x01, 0x94, 0xE4, 0x51, 0xAE, 0xDE, 0x03, 0xED, 0x35, 0x0D, 0x60,
+    0x67, 0xBB, 0x82, 0x11, 0xFD, 0x0C, 0xFD, 0x60, 0x34, 0x52, 0xCF, 0x58, 0x51, 0xE9, 0xFA, 0x91,
+    0xF4, 0x35, 0xE9, 0x79, 0x29, 0xF6, 0x5A, 0xAA, 0x74, 0x71, 0xCA, 0x24, 0xE3, 0xDA, 0x01, 0xA0,
+    0x48, 0x6F, 0x5C, 0xC7, 0x66, 0x5B, 0x03, 0xF5, 0x69, 0xCD, 0xCC, 0x2A, 0x38, 0x3D, 0xAE, 0x58,
+    0x68, 0xAC, 0x56, 0xFA, 0x2E, 0xD3, 0xD0, 0x76, 0x54, 0xC1, 0x0D, 0x64, 0xEA, 0x07, 0xA8, 0xD3,
+    0x3C, 0x1A, 0x49, 0xEA, 0x4B, 0xE2, 0x79, 0x4E, 0x13, 0xD4, 0xAF, 0xAD, 0x50, 0x4F, 0xFD, 0x44,
+    0xED, 0x6D, 0xA4, 0x9E, 0x73, 0xFD, 0x43, 0xAB, 0x6B, 0xD2, 0x65, 0x4D, 0xA9, 0x2F, 0x95, 0x07,
+    0x4C, 0x00, 0x48, 0x4A, 0x5A, 0x07, 0x14, 0x23, 0x80, 0x77, 0x92, 0xBE, 0x2D, 0x3D, 0x9E, 0x16,
+    0xFB, 0x92, 0xDE, 0xAE, 0x66, 0x6E, 0x7D, 0x28, 0x84, 0x2B, 0x64, 0x87, 0xD6, 0x1B, 0x9F, 0xDE,
+    0x7E, 0xBA, 0x90, 0x6D, 0x5A, 0x0F, 0xAD, 0xA7, 0x50, 0x32, 0x89, 0x3F, 0xEA, 0xB7, 0x33, 0xF7,
+    0x28, 0x49, 0x79, 0x69, 0xAC, 0x25, 0x49, 0x4A, 0x72, 0x6B, 0x9B, 0x7D, 0x66, 0x53, 0x2B, 0x5C,
+    0xD2, 0x1D, 0xCC, 0xC6, 0xBF, 0xEB, 0xA4, 0x5B, 0x64, 0x9B, 0x6A, 0x61, 0x37, 0x45, 0xE2, 0x8B,
+    0x6C, 0x52, 0x5B, 0x7A, 0x51, 0xC1, 0x49, 0xA1, 0xD5, 0xE3, 0x6F, 0xE9, 0xBB, 0xCF, 0x6B, 0x74,
+    0x76, 0xF9, 0x96, 0x5D, 0x8C, 0xD7, 0x13, 0x83, 0xBA, 0xCF, 0xDA, 0xE5, 0xAF, 0xEC, 0x02, 0xEA,
+    0x50, 0x87, 0x5D, 0xF8, 0xF0, 0x6F, 0x72, 0x49, 0xBA, 0x99, 0xF4, 0x50, 0x6F, 0x37, 0x75, 0xF4,
+    0xC0, 0x65, 0x93, 0x32, 0xBC, 0x69, 0xC3, 0x9B, 0x97, 0x20, 0x31, 0x5A, 0xBE, 0xE2, 0x14, 0x2B,
+    0xE9, 0x7E, 0xE9, 0xDB, 0xD2, 0xEC, 0xB4, 0x54, 0x8A, 0xD4, 0x01, 0x1B, 0xC9, 0x34, 0xA0, 0x91,
+    0xEA, 0x67, 0xBE, 0xB1, 0x11, 0x1B, 0x41, 0x33, 0x1A, 0x29, 0xB5, 0x5F, 0xD0, 0x1A, 0xA1, 0x97,
+    0x22, 0xF0, 0xF0, 0x37, 0xD2, 0x44, 0x4C, 0x12, 0x82, 0x9F, 0xF9, 0xA6, 0x94, 0xBA, 0xBD, 0xC1,
+    0x9B, 0x56, 0xE1, 0xC9, 0xEC, 0xED, 0xD3, 0xEC, 0x5D, 0x3E, 0x60, 0xF6, 0xD6, 0x9A, 0xA5, 0x97,
+    0x14, 0x9C, 0xA6, 0x36, 0xE4, 0x1A, 0x8B, 0x95, 0x76, 0xCA, 0xD4, 0x55, 0x0B, 0xED, 0x54, 0xAC,
+    0x54, 0x21, 0x53, 0x67, 0xD4, 0xB4, 0x53, 0x12, 0xCB, 0x56, 0x5A, 0xE1, 0xB2, 0xD4, 0x25, 0xAF,
+    0x15, 0x54, 0x0B, 0x50, 0xAC, 0xC0, 0x91, 0x6E, 0x42, 0xBD, 0x69, 0x7C, 0x7E, 0xDF, 0x95, 0x44,
+    0xC5, 0xB6, 0xD9, 0x13, 0x2F, 0x09, 0xAC, 0x8D, 0x80, 0x97, 0xA4, 0x07, 0xA4, 0x57, 0xA5, 0x47,
+    0xA5, 0xB1, 0x14, 0x46, 0xCD, 0x46, 0xA5, 0xD6, 0xE3, 0xE6, 0x8D, 0x70, 0xC5, 0xF6, 0x8F, 0xE7,
+    0xBD, 0x46, 0xDC, 0xFC, 0x15, 0x37, 0x63, 0x75, 0xC9, 0xC6, 0xF4, 0xFC, 0x9A, 0x8D, 0x7A, 0xB9,
+    0xA4, 0x19, 0x8E, 0xFA, 0x07, 0x23, 0x50, 0x5C, 0x53, 0x03, 0x99, 0xD7, 0x08, 0xFC, 0x46, 0x92,
+    0xB2, 0x89, 0x6A, 0x49, 0xCC, 0x96, 0x5A, 0x01, 0x2B, 0x8D, 0x60, 0xA4, 0x79, 0x4F, 0x8D, 0x5E,
+    0x7F, 0xA7, 0x50, 0xCB, 0xB7, 0x21, 0xD3, 0x58, 0xAC, 0x38, 0x9F, 0xA9, 0xB3, 0x81, 0x76, 0x32,
+    0xA2, 0x5A, 0xBE, 0xAC, 0xC1, 0xE8, 0xD7, 0x9C, 0xA7, 0x97, 0x02, 0x56, 0x12, 0x5C, 0x5E, 0x35,
+    0xC0, 0xAF, 0x39, 0x0F, 0xC5, 0x83, 0x61, 0xAF, 0x68, 0x1E, 0xE9, 0x3A, 0xD8, 0xCD, 0x18, 0x18,
+    0x7A, 0x6D, 0xDC, 0xBB, 0x81, 0x52, 0x49, 0xD0, 0xAF, 0x27, 0xBD, 0xD9, 0x1E, 0xEB, 0xED, 0xDD,
+    0xFC, 0xDD, 0xE3, 0x06, 0x4E, 0xE6, 0xC7, 0x84, 0xDD, 0x9B, 0xA1, 0x65, 0xB2, 0x04, 0x74, 0x8A,
+    0x46, 0x46, 0xC9, 0x8D, 0x33, 0xA0, 0x11, 0xE7, 0x71, 0x33, 0x36, 0x60, 0x57, 0x8C, 0xA8, 0xB5,
+    0x94, 0x5A, 0x6B, 0xA9, 0x94, 0x5E, 0x96, 0xAE, 0x49, 0x9E, 0x73, 0x40, 0xAE, 0x19, 0xE8, 0x53,
+    0x9F, 0xE6, 0x43, 0x67, 0xDC, 0xA9, 0x43, 0x0F, 0x18, 0x65, 0x4F, 0x83, 0x7B, 0x53, 0x11, 0x23,
+    0xC9, 0xE3, 0x24, 0x75, 0x46, 0xD7, 0xDB, 0x80, 0x5B, 0x32, 0x0D, 0x46, 0x8D, 0x0D, 0xB8, 0x99,
+    0x0F, 0x7D, 0xD8, 0xDF, 0xCC, 0x75, 0xDD, 0xC9, 0xF7, 0x7A, 0x55, 0xB2, 0x0A, 0x40, 0xF6, 0x47,
+    0x89, 0x99, 0x27, 0x46, 0xA9, 0xE4, 0x6D, 0x90, 0x3C, 0xB8, 0x25, 0xD3, 0x94, 0xE5, 0xEA, 0x32,
+    0x0D, 0x4B, 0x15, 0xC8, 0xF5, 0xE0, 0xA4, 0x91, 0x22, 0xBA, 0xFB, 0x04, 0xD5, 0xCD, 0xB5, 0x0A,
+    0xD0, 0xFE, 0xBD, 0x74, 0xEB, 0xF8, 0x19, 0x7D, 0x3D, 0x59, 0x5E, 0x95, 0x24, 0x69, 0x3E, 0xEA,
+    0xD7, 0xE3, 0xE3, 0xE3, 0x2E, 0xE9, 0x9E, 0xE4, 0x69, 0x85, 0x14, 0x89, 0xE4, 0x36, 0xAD, 0x75,
+    0x97, 0x56, 0x79, 0x2B, 0xF8, 0x24, 0x48, 0xAF, 0x3F, 0xEB, 0x93, 0x65, 0x3A, 0xEC, 0x89, 0x4F,
+    0x9B, 0xA6, 0xFB, 0x99, 0x5D, 0x03, 0x64, 0xC7, 0xCD, 0x26, 0xC6, 0xAC, 0x34, 0xDE, 0x61, 0xD7,
+    0x67, 0x43, 0x55, 0x84, 0x5C, 0x0F, 0x5E, 0x5B, 0x71, 0x7F, 0xEF, 0xD5, 0xD8, 0xB8, 0xEA, 0x87,
+    0x5F, 0x90, 0x93, 0xA4, 0xAF, 0x49, 0xD2, 0x54, 0x68, 0xB7, 0xBB, 0xB0, 0xF9, 0x8B, 0x96, 0x83,
+    0x3F, 0x52, 0x37, 0x7F, 0xF7, 0xAF, 0xA8, 0xA4, 0x34, 0x8D, 0xE1, 0x1E, 0xAD, 0xC0, 0xB9, 0xE4,
+    0x6D, 0xFB, 0xA5, 0x27, 0xC6, 0x66, 0x22, 0xDA, 0x6D, 0xE1, 0x24, 0x1E, 0xD9, 0x9F, 0x66, 0xE4,
+    0x26, 0xD9, 0x60, 0x47, 0xC9, 0xDA, 0xFA, 0x45, 0x51, 0xAD, 0xD2, 0xBA, 0x67, 0xD8, 0x49, 0x4E,
+    0xAE, 0x07, 0x86, 0x57, 0x8E, 0x40, 0xE6, 0x01, 0xEE, 0x82, 0x5E, 0x6B, 0x12, 0xF3, 0x46, 0xDD,
+    0xCF, 0xFB, 0x5B, 0x29, 0xA6, 0x8F, 0x03, 0x77, 0x71, 0xC7, 0x66, 0x0A, 0x0F, 0x55, 0x12, 0x06,
+    0xA5, 0x2F, 0xFD, 0x66, 0x59, 0x6E, 0xDA, 0x02, 0x4E, 0x9B, 0xA8, 0xCB, 0x75, 0x30, 0x52, 0x1A,
+    0x6E, 0x7B, 0x6D, 0x1E, 0x32, 0x50, 0x57, 0x4A, 0x9D, 0x9D, 0x69, 0x17, 0x23, 0x4D, 0x56, 0xD4,
+    0x6A, 0x7A, 0x8D, 0xA5, 0x86, 0x42, 0x3E, 0xD3, 0x60, 0xE4, 0x79, 0x2D, 0xE2, 0xBC, 0x59, 0xFF,
+    0x1D, 0xB8, 0xC1, 0x86, 0x4C, 0x40, 0x39, 0x1B, 0x25, 0xAD, 0x40, 0x68, 0x68, 0x1B, 0xA0, 0x9A,
+    0x9C, 0x77, 0x03, 0x90, 0xC7, 0x4B, 0xF1, 0xF2, 0x98, 0x1E, 0xA5, 0xF6, 0xFA, 0x91, 0x52, 0xA7,
+    0xEA, 0xB5, 0xBF, 0xA5, 0x01, 0xA8, 0x82, 0x0D, 0x55, 0x00, 0xEC, 0x6A, 0x64, 0x12, 0x17, 0x40,
+    0x43, 0xEB, 0xA1, 0x50, 0xE7, 0xBC, 0x15, 0x18, 0x0D, 0x36, 0x64, 0x9A, 0x30, 0x1A, 0x8D, 0x70,
+    0x91, 0x5C, 0x1E, 0x0D, 0x85, 0x86, 0x5C, 0x3E, 0x97, 0x9A, 0x3E, 0xE4, 0x9A, 0x53, 0xC7, 0x5F,
+    0xD1, 0x8C, 0x34, 0xA3, 0x70, 0x94, 0x9C, 0x00, 0x47, 0xDF, 0x00, 0xCE, 0x70, 0x06, 0x20, 0x5F,
+    0x92, 0xFC, 0x71, 0x83, 0xEB, 0x00, 0x13, 0x93, 0xD7, 0xAB, 0xDA, 0x44, 0x6E, 0xBB, 0x79, 0x18,
+    0xCE, 0x9D, 0x22, 0x53, 0x7E, 0x25, 0xE9, 0x01, 0xEA, 0x9C, 0x06, 0x37, 0x55, 0xAB, 0xD1, 0x62,
+    0x95, 0xC9, 0x97, 0x31, 0x97, 0xFF, 0xD5, 0x7E, 0x68, 0x07, 0xF7, 0xB7, 0x64, 0xB1, 0x08, 0xA5,
+    0x87, 0xD2, 0xB7, 0x43, 0x04, 0xDC, 0xFD, 0xA1, 0x4E, 0x62, 0x51, 0xF3, 0x46, 0x80, 0x01, 0x6C,
+    0xEC, 0x5F, 0x5B, 0x21, 0x57, 0x11, 0xEA, 0x19, 0xDA, 0xA9, 0x1D, 0x34, 0x60, 0x63, 0x11, 0xCA,
+    0x95, 0x5C, 0x43, 0x3B, 0xB8, 0x99, 0xDE, 0x97, 0x6B, 0xAE, 0xA1, 0x5E, 0x8D, 0x82, 0xD5, 0x7D,
+    0xE9, 0xBE, 0x4B, 0xF2, 0x4D, 0x27, 0x3F, 0x6C, 0x96, 0x4B, 0x73, 0xA6, 0x07, 0xA5, 0xA1, 0x52,
+    0xAD, 0x9B, 0x28, 0x18, 0x35, 0x56, 0xDE, 0x46, 0xFA, 0x1F, 0x75, 0x6E, 0x36, 0x01, 0x34, 0xD6,
+    0x03, 0x46, 0xE7, 0x57, 0xB0, 0xD1, 0xFA, 0xBD, 0x87, 0x55, 0xD2, 0x42, 0x32, 0x71, 0xAD, 0x9E,
+    0x49, 0x8E, 0x7D, 0x2D, 0x89, 0x91, 0x1B, 0x35, 0x99, 0x46, 0x1B, 0x31, 0xEA, 0x92, 0x9B, 0x46,
+    0x23, 0xF5, 0x92, 0x7C, 0x38, 0xAD, 0xA6, 0x5C, 0x4F, 0x48, 0x83, 0x8D, 0x4E, 0x4A, 0x4C, 0x39,
+    0xB9, 0x2F, 0x92, 0x51, 0xA8, 0x69, 0x1F, 0x2F, 0xEA, 0x35, 0xED, 0xE7, 0x5C, 0xF6, 0xF4, 0xE6,
+    0xA9, 0x79, 0x4C, 0xA2, 0x7F, 0x59, 0xA1, 0xD4, 0xFD, 0xEA, 0x5C, 0x2C, 0x62, 0xBE, 0xFE, 0x41,
+    0x35, 0x57, 0x13, 0xED, 0x28, 0x32, 0xDD, 0xEF, 0x29, 0xA4, 0x99, 0x4A, 0x0A, 0xB4, 0xB7, 0x14,
+    0x32, 0x35, 0xED, 0x52, 0x44, 0x5A, 0x5F, 0xCD, 0x68, 0x68, 0xC7, 0x5C, 0xF7, 0xEB, 0x4A, 0x19,
+    0x7B, 0x0D, 0xF5, 0xDB, 0x12, 0xFD, 0xB8, 0x79, 0xC0, 0xED, 0x5E, 0xE1, 0x37, 0xDA, 0xA4, 0xC6,
+    0x65, 0x35, 0x29, 0xE4, 0x94, 0x3D, 0xBD, 0xCD, 0x38, 0x35, 0x95, 0x24, 0x8D, 0xC9, 0xA7, 0x80,
+    0x89, 0x5F, 0x50, 0x03, 0x2B, 0x1A, 0xC1, 0x75, 0x6E, 0x06, 0x3B, 0xD9, 0x08, 0x66, 0x31, 0x6A,
+    0xC8, 0x22, 0x1A, 0xA1, 0x6D, 0xDC, 0x0C, 0xD5, 0x60, 0x23, 0x94, 0xDE, 0xA8, 0xC1, 0x04, 0x34,
+    0xC2, 0x8A, 0x9B, 0xA1, 0x6D, 0x6C, 0x84, 0x7A, 0x34, 0x6A, 0xB0, 0x1E, 0x8D, 0x14, 0x0B, 0x6E,
+    0x36, 0x8F, 0x07, 0x6C, 0x44, 0xC2, 0xA8, 0x69, 0xC5, 0x3D, 0xD2, 0x25, 0x35, 0x56, 0xFA, 0x89,
+    0x9A, 0x42, 0x5A, 0x3E, 0x75, 0x50, 0x8E, 0x36, 0x3D, 0x74, 0x9B, 0x78, 0xCD, 0x41, 0xB1, 0xDE,
+    0xB4, 0xBB, 0x6C, 0xEF, 0xC1, 0xEA, 0x25, 0x0D, 0xB5, 0x24, 0x9F, 0xF5, 0xAF, 0x6B, 0xC4, 0x8E,
+    0xCE, 0x63, 0x66, 0x1B, 0x20, 0x1A, 0x81, 0x43, 0x03, 0x76, 0x70, 0x9E, 0xC2, 0xDB, 0x40, 0xBE,
+    0x18, 0x41, 0x44, 0x03, 0x0E, 0xE7, 0x7F, 0xB5, 0x1E, 0x6C, 0x30, 0x9A, 0x8C, 0x72, 0xF9, 0x23,
+    0x2D, 0xFD, 0x6C, 0xA5, 0x6F, 0xCE, 0x46, 0x1A, 0x2F, 0x6C, 0x9A, 0x7D, 0xB9, 0x00, 0xF9, 0x29,
+    0xB6, 0x05, 0x50, 0x6E, 0x3E, 0xEC, 0x9F, 0x24, 0x8F, 0xE6, 0x4B, 0x52, 0x53, 0x2B, 0xA2, 0x89,
+    0x42, 0xCD, 0xE6, 0x0C, 0xDD, 0x7C, 0xA1, 0x9B, 0x2B, 0x34, 0x39, 0x4A, 0xF7, 0xFF, 0x4A, 0x4E,
+    0xD6, 0xCD, 0xC7, 0x9A, 0x74, 0xDA, 0xCD, 0xC3, 0xBA, 0x39, 0x58, 0xDF, 0xF7, 0x53, 0xB7, 0x5F,
+    0x70, 0xC2, 0x88, 0x4A, 0x0B, 0x36, 0xE4, 0xD2, 0x8C, 0xF3, 0x56, 0x1A, 0xD9, 0x44, 0xC6, 0x7A,
+    0xCA, 0x37, 0xB8, 0x79, 0x06, 0x2F, 0xC7, 0x13, 0xEB, 0xCC, 0x24, 0x9E, 0x97, 0x1D, 0x9F, 0xF8,
+    0x01, 0x67, 0x27, 0x29, 0x54, 0x5A, 0xDA, 0x90, 0xF5, 0x73, 0xB1, 0x52, 0x2F, 0x99, 0xBA, 0x72,
+    0xA5, 0x9D, 0x72, 0x75, 0xD5, 0xCD, 0x5D, 0x3F, 0x15, 0x92, 0x96, 0x4C, 0xD2, 0x4A, 0x7B, 0xEB,
+    0x19, 0x75, 0xD5, 0x42, 0x3F, 0xBD, 0xBB, 0x65, 0x1B, 0xE9, 0xA7, 0x5E, 0x63, 0xBD, 0x38, 0xCD,
+    0xE5, 0x0A, 0xE4, 0x6A, 0xF6, 0xDA, 0xAE, 0xF3, 0x7B, 0x75, 0xB4, 0x0A, 0xFB, 0x5E, 0x28, 0x02,
+    0x77, 0x3F, 0x05, 0xBF, 0x1C, 0x34, 0x6D, 0x92, 0xB7, 0xFA, 0xFB, 0xA9, 0x1B, 0x37, 0x92, 0xAF,
+    0xBA, 0x39, 0x15, 0x11, 0x48, 0xA6, 0x51, 0xA6, 0x4D, 0xB0, 0x9C, 0xD2, 0xDE, 0x37, 0x03, 0x24,
+    0xEF, 0xF8, 0x05, 0x05, 0x04, 0x96, 0x5E, 0x83, 0x74, 0x43, 0x61, 0xF3, 0xE9, 0xF6, 0xC3, 0x21,
+    0x34, 0x91, 0x1C, 0x50, 0xA7, 0xA2, 0x02, 0xFC, 0x53, 0xD4, 0xF7, 0xA4, 0x9A, 0xCE, 0xB8, 0x19,
+    0xAB, 0xE6, 0x67, 0xA9, 0xEF, 0x4F, 0x3F, 0x18, 0x3F, 0x40, 0x2F, 0x3E, 0x51, 0xDF, 0x93, 0xC5,
+    0x6E, 0xA5, 0x79, 0x1F, 0x94, 0xDB, 0xEC, 0x9E, 0xCA, 0x03, 0x98, 0x64, 0xFD, 0xC4, 0x53, 0x66,
+    0xCF, 0x9E, 0x7C, 0xF4, 0x7A, 0x55, 0xEA, 0x75, 0x4D, 0x6B, 0x25, 0xFA, 0xB9, 0x58, 0x93, 0xBD,
+    0xB3, 0xDF, 0x88, 0x76, 0x32, 0x6A, 0xDA, 0x29, 0x97, 0x34, 0x21, 0x69, 0xE2, 0x9E, 0xE4, 0xC8,
+    0x6F, 0x6F, 0xDB, 0x64, 0x9B, 0xD1, 0xB3, 0x39, 0xC9, 0xEA, 0x89, 0xCD, 0x6B, 0x59, 0x8D, 0x7B,
+    0x86, 0x62, 0x07, 0xA0, 0x18, 0x30, 0x12, 0x48, 0x9D, 0x91, 0xC8, 0xA4, 0x21, 0x93, 0xBA, 0x3C,
+    0x11, 0x60, 0x30, 0xC9, 0xD7, 0x36, 0x6C, 0x3E, 0xB7, 0xB1, 0xD4, 0x02, 0xAE, 0x9D, 0xEC, 0x77,
+    0x03, 0xB8, 0xCB, 0xDE, 0xBE, 0x1C, 0xA0, 0xBD, 0xE4, 0xEB, 0x97, 0x03, 0xB4, 0x76, 0x76, 0x4F,
+    0x04, 0xE8, 0x6D, 0x70, 0x65, 0x80, 0xBE, 0x08, 0x6D, 0x19, 0x41, 0x26, 0x3E, 0x57, 0x44, 0x90,
+    0x59, 0x43, 0x11, 0x41, 0x99, 0x42, 0xB1, 0x82, 0xD0, 0x62, 0x56, 0x58, 0x91, 0x37, 0x2B, 0xD9,
+    0x4A, 0xEB, 0x8D, 0xC8, 0x56, 0xDC, 0x64, 0x44, 0x1E, 0xA9, 0x47, 0x23, 0x4A, 0x5D, 0xAD, 0x86,
+    0x4A, 0x8B, 0xD3, 0x0C, 0xAD, 0x42, 0x9B, 0x9C, 0xF6, 0x9B, 0x4A, 0x53, 0x6D, 0xA1, 0x80, 0xDA,
+    0xDF, 0x66, 0xC4, 0xEF, 0x67, 0x27, 0xED, 0x46, 0xD8, 0xBF, 0xD9, 0xF6, 0xBF, 0x79, 0x58, 0xFC,
+    0x23, 0x4E, 0x0F, 0x68, 0xA1, 0xD6, 0xD8, 0x0A, 0xAB, 0xAE, 0xD0, 0x54, 0x6A, 0xCC, 0x14, 0x8C,
+    0x66, 0xDA, 0xFE, 0xFC, 0x3B, 0x91, 0xEA, 0xBB, 0x3E, 0xA8, 0x29, 0x7E, 0x1C, 0xBE, 0xEA, 0xC6,
+    0x2C, 0xB4, 0xBD, 0x9D, 0x69, 0xAD, 0x1E, 0x8F, 0x54, 0xCF, 0x6B, 0x54, 0x53, 0x78, 0xE7, 0xDD,
+    0x98, 0x85, 0x72, 0xB6, 0x33, 0x2D, 0xC1, 0x44, 0xDC, 0x74, 0x67, 0xA6, 0xEB, 0xBD, 0x28, 0xA4,
+    0xCB, 0x1A, 0xF2, 0xCD, 0xFC, 0x4D, 0x9E, 0xFF, 0xA4, 0x96, 0x6E, 0xCF, 0x3F, 0x0D, 0xE0, 0xAB,
+    0x49, 0x5F, 0x4D, 0xAA, 0x50, 0x70, 0x0A, 0xF7, 0x68, 0xCC, 0xD5, 0xFC, 0xD3, 0x7E, 0x4B, 0x5D,
+    0x77, 0x0A, 0xAD, 0x02, 0x59, 0x43, 0x03, 0xB4, 0xB4, 0x27, 0x9A, 0x60, 0xFB, 0xBC, 0x92, 0xE3,
+    0x62, 0x62, 0x6F, 0x59, 0xBD, 0x4B, 0xFD, 0xBB, 0x8B, 0x43, 0xC8, 0x6D, 0xD3, 0x6B, 0xD1, 0xA6,
+    0x0E, 0x75, 0x80, 0x49, 0x44, 0x77, 0x1A, 0x81, 0xF2, 0x6D, 0x01, 0xAC, 0x89, 0xBD, 0xBD, 0xA0,
+    0x0E, 0x4C, 0xD2, 0xDB, 0xDA, 0x46, 0x23, 0x94, 0xBE, 0x5C, 0x81, 0x95, 0xD6, 0x43, 0x7D, 0xEB,
+    0x99, 0x2D, 0xFC, 0x14, 0xF6, 0xAA, 0x8F, 0xBD, 0x75, 0xFC, 0x6C, 0x24, 0x13, 0xF4, 0x9E, 0x7A,
+    0xA4, 0x10, 0x26, 0x80, 0x5B, 0x72, 0x2D, 0x54, 0x5A, 0x7A, 0x4D, 0xA5, 0xF4, 0xB2, 0x56, 0x7A,
+    0x85, 0xAC, 0xC9, 0x1A, 0x9E, 0x23, 0x52, 0x7A, 0x3B, 0xD1, 0xDF, 0xBB, 0x62, 0xA4, 0x81, 0x4A,
+    0x1E, 0xCE, 0x5C, 0xD8, 0x7A, 0x7F, 0xF4, 0x34, 0x54, 0x0A, 0x94, 0x92, 0xCF, 0xF5, 0x86, 0x1A,
+    0x37, 0x55, 0x8B, 0x89, 0xA8, 0x3B, 0xEA, 0xEC, 0x02, 0xA8, 0xE3, 0x6E, 0x2D, 0xD4, 0x52, 0x57,
+    0x49, 0x8B, 0x51, 0xA7, 0xAE, 0x9D, 0xEC, 0x52, 0x46, 0xD4, 0xF5, 0x53, 0x1D, 0x0A, 0x49, 0xAB,
+    0xD3, 0xDB, 0x1A, 0xB5, 0xB8, 0x99, 0x8B, 0x5C, 0x04, 0x2E, 0x64, 0xCD, 0x81, 0x78, 0x36, 0xD4,
+    0x33, 0xA0, 0x17, 0xD4, 0x40, 0xB1, 0x58, 0xCF, 0xBB, 0x5F, 0x59, 0x73, 0x02, 0xEA, 0x48, 0xA1,
+    0x06, 0xAC, 0x1A, 0x20, 0xD3, 0xC2, 0xDE, 0x7D, 0xBB, 0x97, 0x45, 0x7D, 0xEB, 0x01, 0xFB, 0x03,
+    0x01, 0x59, 0xA8, 0x17, 0xC0, 0x3D, 0xAF, 0x01, 0x52, 0xCC, 0x92, 0x9E, 0x7E, 0x02, 0x3B, 0x15,
+    0x82, 0x5C, 0xC7, 0xFD, 0x9C, 0xB4, 0x97, 0x81, 0x22, 0x51, 0x52, 0xC7, 0xC7, 0x1A, 0xA9, 0x3C,
+    0xA5, 0xC8, 0x63, 0x12, 0x06, 0x03, 0x46, 0x5D, 0xAD, 0x2E, 0x93, 0x9E, 0x48, 0xC4, 0x4B, 0xD0,
+    0x9A, 0xA4, 0xC7, 0xB6, 0xE7, 0x23, 0x36, 0x38, 0x8F, 0xAE, 0x89, 0x72, 0xAE, 0x47, 0xEE, 0xE0,
+    0xCE, 0x53, 0xDD, 0xFF, 0x05, 0xD1, 0xB0, 0xDC, 0x62, 0xA9, 0x66, 0xEF, 0xCC, 0xDA, 0x62, 0x70,
+    0x20, 0xFD, 0xED, 0xB3, 0x1E, 0x50, 0xEB, 0x09, 0x40, 0xFB, 0xCD, 0x80, 0x03, 0xDC, 0x8B, 0xE2,
+    0x2C, 0x50, 0xBF, 0xB2, 0x45, 0xC2, 0x7C, 0x22, 0x66, 0x39, 0x57, 0xE1, 0xCC, 0x05, 0x30, 0xA1,
+    0x48, 0x57, 0x8C, 0x29, 0x12, 0x91, 0xAD, 0xB4, 0xC9, 0x1E, 0x7C, 0xFD, 0xD9, 0xB0, 0xB7, 0x30,
+    0xF6, 0x06, 0xC6, 0x00, 0xD4, 0x3F, 0xDC, 0xF5, 0x9E, 0xCF, 0x63, 0x3D, 0x55, 0xA0, 0x1A, 0xEC,
+    0x4C, 0x21, 0xAC, 0x2F, 0x02, 0x99, 0xBE, 0xF3, 0xC7, 0xA1, 0xD4, 0x74, 0x24, 0x69, 0xB5, 0x29,
+    0xDE, 0xA3, 0xC7, 0xA5, 0xF3, 0xA9, 0x93, 0x47, 0x4F, 0xF1, 0x70, 0xC3, 0x3D, 0x9A, 0x5B, 0x75,
+    0xE5, 0xE6, 0x3E, 0x7C, 0x43, 0xB7, 0xFA, 0xD9, 0xF9, 0x3A, 0xA2, 0x6B, 0x11, 0x0D, 0x65, 0x28,
+    0x07, 0x3B, 0xD3, 0x0F, 0xA0, 0x63, 0x05, 0xEE, 0xD1, 0x5E, 0x49, 0xBB, 0xF5, 0x0D, 0xAB, 0x1B,
+    0x0B, 0x18, 0x35, 0xEA, 0xA0, 0x1D, 0x6D, 0x80, 0x32, 0xD2, 0x4F, 0xD0, 0xFB, 0x4A, 0x3F, 0x7C,
+    0xE8, 0x6B, 0x92, 0xA4, 0xC5, 0x69, 0xED, 0xA5, 0x46, 0x3A, 0x2F, 0x8D, 0xEC, 0x60, 0xD7, 0xC0,
+    0x9D, 0xDC, 0x05, 0x91, 0x08, 0x2B, 0x2B, 0xE8, 0xBE, 0x08, 0xBD, 0x42, 0x8A, 0x4E, 0x71, 0xDB,
+    0xA3, 0xA3, 0xDF, 0x07, 0x84, 0x96, 0x3E, 0x85, 0xC2, 0x9E, 0x7C, 0x26, 0x18, 0x35, 0x79, 0x30,
+    0x6A, 0xB2, 0xC5, 0xA8, 0xC1, 0x1B, 0x35, 0x9B, 0xA8, 0x32, 0xEA, 0xCE, 0x61, 0x24, 0x35, 0x87,
+    0x0D, 0x26, 0xF9, 0xED, 0x9A, 0x53, 0x9B, 0xC5, 0xA8, 0x61, 0x7F, 0x95, 0x27, 0x1F, 0x0A, 0x95,
+    0xA4, 0x70, 0xB8, 0xD1, 0x4C, 0x93, 0x35, 0xC6, 0x17, 0xDE, 0xCC, 0xA5, 0x37, 0xC1, 0xFA, 0x5C,
+    0x9A, 0xE8, 0xD5, 0x71, 0xE6, 0xE2, 0xC9, 0x7C, 0xEA, 0x35, 0x1A, 0x69, 0xB6, 0x6B, 0x1F, 0x2A,
+    0x5F, 0x46, 0x37, 0x9A, 0xB5, 0x1D, 0x8C, 0xFA, 0x1F, 0x7E, 0x41, 0xBD, 0xB4, 0x4A, 0x5A, 0xF5,
+    0x9D, 0xDD, 0xC5, 0x7E, 0x48, 0x1E, 0xF9, 0xD6, 0x83, 0x5B, 0xCF, 0xFF, 0xFB, 0x4A, 0x8A, 0xA5,
+    0x14, 0x32, 0x69, 0xE2, 0xCC, 0x45, 0xC8, 0xFE, 0xB0, 0xD9, 0xF0, 0x2A, 0xAD, 0xB4, 0xD0, 0x4B,
+    0xEA, 0xDC, 0xCD, 0x42, 0xB3, 0x9D, 0xA8, 0x94, 0x8F, 0x64, 0x9A, 0xF6, 0x31, 0x9A, 0xE4, 0x3F,
+    0x48, 0x7E, 0x8A, 0x65, 0xB7, 0xDB, 0x5D, 0x5A, 0x5B, 0x49, 0xFA, 0xA6, 0x12, 0x4C, 0x40, 0xBA,
+    0xA5, 0x06, 0x1B, 0xFB, 0x91, 0x42, 0xF5, 0x4C, 0xAE, 0x17, 0x57, 0xD0, 0xA8, 0x11, 0xF9, 0x7A,
+    0x3D, 0x2F, 0x7F, 0x70, 0x29, 0xF9, 0x04, 0x99, 0xE3, 0xCC, 0x9F, 0x93, 0x74, 0xB6, 0x22, 0x85,
+    0xF4, 0xA6, 0x56, 0x5A, 0x1E, 0xA1, 0x0E, 0xBF, 0x8E, 0x8D, 0x49, 0xFB, 0x34, 0xEB, 0xC3, 0xC7,
+    0xCF, 0xA8, 0x97, 0xD6, 0x5E, 0x5A, 0xF5, 0x9D, 0x87, 0xA2, 0x86, 0x22, 0xF4, 0x43, 0x19, 0xDA,
+    0xA9, 0x9A, 0xDD, 0xAA, 0xA9, 0x92, 0x3A, 0xA3, 0x98, 0xEC, 0xC9, 0x73, 0xDC, 0x05, 0xF5, 0xD4,
+    0x0F, 0x69, 0x45, 0x1A, 0xD9, 0x00, 0xFD, 0xF9, 0xF5, 0x36, 0x7E, 0x72, 0xE6, 0x49, 0xA0, 0xD7,
+    0x42, 0x26, 0x69, 0xCA, 0x25, 0xAD, 0xE8, 0x7A, 0xA5, 0xD1, 0x75, 0xB4, 0xA1, 0x6C, 0x28, 0x12,
+    0x2C, 0xC6, 0x03, 0x55, 0x3C, 0x28, 0x22, 0xFA, 0xDE, 0x6E, 0xB7, 0x6B, 0x6F, 0x4A, 0x52, 0x1A,
+    0xF9, 0xB3, 0x92, 0xF4, 0x46, 0x04, 0xF7, 0x53, 0x35, 0x54, 0xA1, 0x1F, 0x29, 0x55, 0x2D, 0x09,
+    0x8B, 0x64, 0x34, 0xF4, 0x37, 0x0B, 0x0D, 0x76, 0xAF, 0x48, 0x0E, 0x9B, 0x37, 0xF0, 0x13, 0xDF,
+    0xD8, 0xD4, 0x3A, 0xEF, 0x86, 0x6A, 0xEE, 0xC7, 0x6A, 0xEE, 0x47, 0xEB, 0xDD, 0x90, 0xED, 0xBD,
+    0x0D, 0x1F, 0x35, 0x4D, 0xE0, 0xCC, 0x26, 0x85, 0xA8, 0x7C, 0x0A, 0x75, 0xEC, 0x99, 0x2E, 0x18,
+    0x95, 0x9B, 0xDB, 0xA2, 0xED, 0xC4, 0xFB, 0xBE, 0x12, 0xFB, 0xE5, 0x0E, 0xCC, 0x4A, 0xAD, 0x15,
+    0x37, 0x66, 0x9A, 0xAC, 0xD4, 0xB9, 0x40, 0x1F, 0x73, 0xA9, 0xA9, 0x45, 0xA5, 0xA1, 0x10, 0x56,
+    0x83, 0xB9, 0x34, 0xA3, 0xC1, 0xDE, 0xBC, 0x0A, 0xC2, 0xF9, 0x22, 0x00, 0xF5, 0x68, 0x83, 0x09,
+    0x80, 0x09, 0x46, 0x29, 0xA2, 0xD8, 0x76, 0x1A, 0x04, 0x50, 0xBE, 0xD5, 0xBE, 0xD5, 0x27, 0x66,
+    0xBE, 0x71, 0x15, 0x94, 0xB0, 0x19, 0xD0, 0xDF, 0xD2, 0x1B, 0x4A, 0x4C, 0xDF, 0x25, 0x5E, 0xE5,
+    0x16, 0x1B, 0x6C, 0x04, 0xEA, 0x60, 0x94, 0x69, 0x80, 0x6A, 0x45, 0x83, 0x0B, 0x60, 0x85, 0xF3,
+    0x85, 0x3A, 0xAC, 0x1A, 0x1B, 0xD0, 0x4C, 0xA9, 0xC1, 0x88, 0x4A, 0x94, 0x1A, 0x4A, 0xC5, 0x5C,
+    0xBE, 0xD4, 0x68, 0xA5, 0xCE, 0xE9, 0x7E, 0x8D, 0x46, 0x1A, 0x8D, 0xFC, 0xDD, 0x69, 0x74, 0x77,
+    0x5F, 0x38, 0x19, 0x6F, 0x4C, 0xF0, 0x1C, 0xE7, 0x37, 0x09, 0x9D, 0xB0, 0x05, 0xF5, 0x98, 0xF4,
+    0xD4, 0x3B, 0xDF, 0xED, 0xDE, 0xF9, 0x25, 0x74, 0x5F, 0x5C, 0xC8, 0x1A, 0xAC, 0x77, 0x23, 0xFD,
+    0xF7, 0xD4, 0xE5, 0xFA, 0xDA, 0x8A, 0x09, 0xB7, 0x0B, 0xD6, 0xDF, 0x6F, 0xA0, 0xD7, 0x4C, 0x9D,
+    0xB8, 0x81, 0x96, 0x22, 0xD2, 0xFB, 0x6A, 0x44, 0x63, 0x8B, 0x51, 0xB3, 0x60, 0x03, 0x17, 0x70,
+    0x7E, 0xB3, 0xBB, 0xAA, 0x85, 0x7C, 0x93, 0x92, 0x1D, 0x56, 0x1A, 0xE0, 0x1E, 0x75, 0xB0, 0x41,
+    0xC6, 0xCA, 0x06, 0x37, 0xAF, 0xA0, 0x97, 0x22, 0xA5, 0xEA, 0x48, 0x3B, 0xB7, 0x7A, 0x56, 0x5D,
+    0x9F, 0x6C, 0x92, 0x15, 0xCE, 0x3C, 0x9D, 0xC8, 0x96, 0x07, 0xEB, 0x8B, 0x58, 0xCF, 0x45, 0xAC,
+    0x67, 0x13, 0xAC, 0xA7, 0xC9, 0x4E, 0x7A, 0xF5, 0x51, 0xA1, 0x56, 0xCF, 0x5D, 0xC0, 0x4A, 0xEA,
+    0x92, 0xF0, 0x91, 0xDE, 0x5C, 0x77, 0x97, 0x62, 0x35, 0x64, 0x3A, 0x1F, 0x68, 0x47, 0xDB, 0xD9,
+    0x79, 0x73, 0x0D, 0xA8, 0x83, 0x7A, 0xDE, 0x02, 0xE0, 0xAD, 0x3C, 0x79, 0xAF, 0x01, 0xEA, 0xB8,
+    0xA1, 0x18, 0x0A, 0x01, 0xAD, 0x9F, 0x28, 0x54, 0x77, 0xE8, 0x55, 0x35, 0x75, 0x70, 0x4A, 0x62,
+    0x6C, 0xCC, 0xA5, 0x89, 0xEC, 0xE1, 0x0B, 0xFB, 0x70, 0xAB, 0x9E, 0xDF, 0x04, 0x45, 0xA8, 0xAF,
+    0x94, 0xB1, 0x1C, 0x8A, 0x98, 0x79, 0x13, 0xB9, 0xD3, 0xAC, 0xE9, 0x6E, 0xF9, 0xBA, 0x11, 0x33,
+    0x59, 0x02, 0x0B, 0x47, 0xBD, 0xBA, 0xC4, 0x67, 0x6C, 0x24, 0x41, 0x84, 0xDA, 0x09, 0xAA, 0xF9,
+    0x73, 0x94, 0xD1, 0x61, 0x54, 0xCD, 0xB9, 0xEE, 0x93, 0xD4, 0xB5, 0x52, 0x57, 0x48, 0x0D, 0x47,
+    0x4F, 0x01, 0x1C, 0x1F, 0x5F, 0x65, 0x0B, 0x39, 0x90, 0xA5, 0xD9, 0x73, 0xF6, 0xF8, 0xF8, 0x7D,
+    0x57, 0x6F, 0x99, 0x2C, 0x4F, 0x29, 0x14, 0xD2, 0x3B, 0x52, 0x53, 0x6B, 0x31, 0x6A, 0xA8, 0x02,
+    0x6E, 0x26, 0xB9, 0xF4, 0x71, 0x21, 0x99, 0x6A, 0x83, 0x51, 0x63, 0x36, 0x77, 0x95, 0x06, 0xA3,
+    0xC6, 0xDD, 0x08, 0xB8, 0xD9, 0xBE, 0xA5, 0xC1, 0xE8, 0xBE, 0x58, 0x05, 0xDC, 0xAC, 0xF3, 0x1A,
+    0x8C, 0xFA, 0xB1, 0x0A, 0x38, 0xCD, 0x99, 0x06, 0xA3, 0x48, 0x15, 0x70, 0x6A, 0x32, 0x0D, 0x26,
+    0xC5, 0xC0, 0x4E, 0x2E, 0x5D, 0x85, 0x4C, 0xEA, 0x4A, 0xC5, 0x0D, 0x58, 0x26, 0x0D, 0xAD, 0xC4,
+    0xDD, 0xC7, 0xC7, 0xA4, 0x79, 0x94, 0x20, 0x8A, 0xBB, 0xDD, 0x85, 0xF7, 0x2C, 0x2A, 0xC9, 0x68,
+    0x95, 0x06, 0xE9, 0x6B, 0xC9, 0x2F, 0x30, 0x66, 0x6A, 0xAA, 0x39, 0xD3, 0x58, 0xC4, 0x4C, 0x73,
+    0xA6, 0xF3, 0x8A, 0xB4, 0xAF, 0xAC, 0x6A, 0xAA, 0xB7, 0x62, 0x3B, 0x16, 0x6B, 0xA8, 0xE6, 0x4C,
+    0xA1, 0x88, 0xB4, 0x21, 0x53, 0x53, 0x05, 0xDA, 0xB1, 0x88, 0x54, 0x73, 0xA1, 0xAE, 0xD4, 0x13,
+    0x0A, 0x56, 0xEF, 0x48, 0x46, 0x2B, 0x5C, 0xE4, 0x02, 0x50, 0x4F, 0xED, 0xC0, 0x26, 0x24, 0x70,
+    0x5E, 0x03, 0xE4, 0x71, 0x0B, 0xA4, 0xBD, 0xFB, 0x75, 0x5B, 0xF7, 0x13, 0xD8, 0xB0, 0x3B, 0x3D,
+    0x4A, 0xDC, 0x8C, 0x39, 0x0D, 0xE4, 0x75, 0x29, 0x02, 0xA2, 0x80, 0x9B, 0xCD, 0xAA, 0xC1, 0xA8,
+    0xD1, 0xA5, 0x80, 0x9B, 0xDD, 0x2B, 0x1A, 0x8C, 0x1E, 0x9C, 0xAB, 0x80, 0x7B, 0x27, 0x66, 0x1A,
+    0x8C, 0xD4, 0x54, 0x01, 0xA7, 0x31, 0xD3, 0x60, 0x34, 0x53, 0x05, 0x5C, 0xBC, 0xFD, 0xD2, 0x99,
+    0x86, 0xE4, 0x50, 0xF8, 0xBB, 0xD3, 0xCF, 0xD3, 0xEF, 0x45, 0x49, 0x3D, 0x50, 0xC4, 0x6A, 0x26,
+    0xD3, 0x03, 0x11, 0xDC, 0x20, 0xB8, 0x4D, 0x9E, 0x1C, 0x2C, 0x34, 0xEF, 0x92, 0xDD, 0xBF, 0xB4,
+    0x0B, 0xFD, 0x54, 0x44, 0xAA, 0x39, 0x53, 0x53, 0x45, 0xDA, 0xB1, 0x52, 0x53, 0xCD, 0x95, 0xC6,
+    0x22, 0x56, 0x37, 0xE6, 0x4C, 0x97, 0x5E, 0x8B, 0xB4, 0x37, 0x9E, 0x57, 0x53, 0x69, 0x68, 0xC7,
+    0x42, 0x43, 0x35, 0x67, 0x1A, 0x8A, 0x98, 0x1E, 0x43, 0xBB, 0xD0, 0x27, 0x37, 0x42, 0x2F, 0xEF,
+    0x34, 0x91, 0x35, 0x59, 0x03, 0x76, 0xAE, 0x27, 0xA8, 0x82, 0xF3, 0x24, 0x09, 0x9C, 0x14, 0xE2,
+    0xDB, 0x5F, 0x67, 0xBE, 0x71, 0x00, 0x2D, 0xD4, 0x52, 0x4C, 0x5A, 0x56, 0x97, 0xEB, 0x7A, 0xA5,
+    0xB1, 0x10, 0xB9, 0x7C, 0x8A, 0x9A, 0xD6, 0x0B, 0xB8, 0xE0, 0x66, 0x70, 0xC1, 0x79, 0xA8, 0x63,
+    0xEB, 0xA1, 0xDA, 0xB6, 0xBD, 0x07, 0x7B, 0x6A, 0x5B, 0x85, 0x76, 0x86, 0x2A, 0xB4, 0x0B, 0xD4,
+    0x8B, 0x0B, 0xE0, 0xE6, 0x7A, 0x85, 0xD6, 0x5B, 0x35, 0x99, 0xC6, 0x52, 0xD7, 0xEF, 0x51, 0x67,
+    0x92, 0x6F, 0xBC, 0x97, 0x66, 0xA8, 0x52, 0x80, 0xE3, 0xF7, 0xF7, 0x53, 0xAF, 0x1A, 0xDB, 0xC6,
+    0xC8, 0x06, 0x9C, 0xD7, 0x90, 0xC7, 0x72, 0x7E, 0x17, 0x11, 0x8F, 0x8E, 0x1B, 0x8A, 0xA4, 0xD9,
+    0xAD, 0x48, 0x9A, 0xAB, 0xC5, 0xE8, 0x9A, 0x52, 0x97, 0xF4, 0xC6, 0x8A, 0x5D, 0xFB, 0x89, 0xFE,
+    0xC6, 0x4A, 0xB9, 0x6A, 0xA2, 0x7F, 0x63, 0xA5, 0x8C, 0xBD, 0x47, 0x2F, 0xAA, 0xA9, 0x82, 0x8B,
+    0x46, 0xE7, 0x95, 0xD8, 0xDB, 0x42, 0xA5, 0x85, 0x4D, 0xA5, 0xFB, 0x10, 0xF4, 0x08, 0xD0, 0x9F,
+    0xA2, 0x47, 0x1D, 0xDC, 0x29, 0x4A, 0xB4, 0x92, 0x14, 0xFB, 0xD3, 0x5B, 0x0F, 0x36, 0xB4, 0x27,
+    0x54, 0xD9, 0xD3, 0x23, 0x6E, 0xF4, 0x40, 0x63, 0xA9, 0xEB, 0xE5, 0xCF, 0xA0, 0xC7, 0x95, 0xF7,
+    0x8C, 0xF5, 0x3B, 0xFD, 0x5C, 0xF9, 0x4C, 0xD7, 0x56, 0x6C, 0x6C, 0x07, 0xDA, 0x37, 0x02, 0x66,
+    0xED, 0x25, 0xDD, 0x90, 0xB4, 0xEA, 0xF5, 0xE3, 0xFE, 0x8D, 0x80, 0x89, 0xFD, 0x48, 0xFB, 0xA2,
+    0x28, 0x83, 0x5B, 0x32, 0x9D, 0xD7, 0xAD, 0xFE, 0xDD, 0x63, 0xFD, 0x68, 0x67, 0xC9, 0xFF, 0xF7,
+    0x54, 0xF9, 0xF9, 0x67, 0xC9, 0x47, 0x45, 0xB9, 0x0B, 0x59, 0x03, 0x32, 0x11, 0xFA, 0xEF, 0xA9,
+    0xA3, 0x5E, 0xDA, 0xE9, 0x3D, 0x42, 0x9D, 0x4F, 0x7C, 0x03, 0x72, 0x29, 0x41, 0x48, 0x07, 0x23,
+    0x29, 0xA2, 0xF1, 0x1E, 0x0D, 0x6E, 0xA0, 0x0D, 0xD6, 0x53, 0x2A, 0x5F, 0x40, 0xD3, 0x67, 0xB7,
+    0x84, 0x93, 0x42, 0x9B, 0x63, 0xB7, 0xDF, 0x02, 0x03, 0x29, 0xF0, 0x7B, 0xF0, 0xF6, 0xB6, 0x1E,
+    0xA8, 0x97, 0x12, 0x6C, 0xB4, 0x63, 0x42, 0xE8, 0x14, 0xBA, 0x57, 0x63, 0xA9, 0xAE, 0x95, 0x92,
+    0xF1, 0xD6, 0x6D, 0x38, 0xEE, 0xC3, 0x3A, 0x5A, 0x8B, 0x85, 0xFE, 0x9A, 0x70, 0x5E, 0x43, 0xB1,
+    0x54, 0xD3, 0xED, 0x3A, 0xD3, 0xDD, 0x4F, 0x27, 0xED, 0x5B, 0xD2, 0xD0, 0xBE, 0xAE, 0xA5, 0xEA,
+    0x4A, 0xE5, 0x0D, 0x1A, 0xA1, 0x5A, 0xD8, 0x3D, 0xB4, 0xE2, 0xA4, 0xA1, 0x94, 0x26, 0x9E, 0xBE,
+    0xBC, 0x40, 0xB1, 0x16, 0xE4, 0x7A, 0x60, 0x42, 0xD7, 0x22, 0xFD, 0xA8, 0x5B, 0xF2, 0xB5, 0xE4,
+    0x33, 0x69, 0x24, 0xDB, 0x01, 0xF9, 0xF1, 0x71, 0x52, 0xA3, 0x46, 0x28, 0xA4, 0x71, 0x7F, 0xE6,
+    0x3D, 0xAF, 0x56, 0xA1, 0xD0, 0xDA, 0x2B, 0x94, 0x5A, 0x5B, 0xCD, 0x47, 0x5A, 0x0A, 0x75, 0xB4,
+    0x43, 0xAE, 0x01, 0x35, 0x68, 0xCC, 0x04, 0xFD, 0x64, 0xE2, 0xFB, 0xE1, 0xB4, 0xCA, 0x58, 0x0F,
+    0x60, 0x56, 0xD7, 0x41, 0xAE, 0x1E, 0x20, 0x45, 0xD9, 0xDA, 0x70, 0xE2, 0xB8, 0x4C, 0xDE, 0xC8,
+    0x6A, 0x04, 0x46, 0x37, 0x40, 0x7E, 0x53, 0x07, 0xD7, 0x84, 0xD1, 0x02, 0x9B, 0x41, 0xC5, 0x7F,
+    0x05, 0xC0, 0x67, 0x8E, 0x9F, 0xDE, 0x63, 0xF4, 0x5B, 0xAD, 0x90, 0xED, 0x76, 0xEF, 0x55, 0x2E,
+    0x7F, 0x36, 0x90, 0xAB, 0xDF, 0x03, 0xB9, 0xDE, 0x07, 0xE1, 0xD6, 0xEC, 0x11, 0x6E, 0xF1, 0x5D,
+    0x08, 0xB7, 0x14, 0xFF, 0xED, 0x4F, 0x10, 0x6E, 0x6E, 0x00, 0xAC, 0x87, 0xDF, 0x30, 0x2B, 0x14,
+    0x3F, 0xD2, 0x00, 0xBD, 0x3C, 0x94, 0x09, 0xE7, 0xB5, 0x9E, 0x84, 0x98, 0xB2, 0x0B, 0x59, 0x03,
+    0xE5, 0x52, 0x1D, 0x16, 0xEE, 0x7E, 0xF9, 0x56, 0xD3, 0xFF, 0x1F, 0xE8, 0x9D, 0x4C, 0x9E, 0xC5,
+    0x4E, 0xD0, 0xBF, 0x20, 0x28, 0x43, 0xED, 0xA1, 0x7D, 0x74, 0x85, 0xDB, 0xF4, 0xD0, 0x5F, 0x42,
+    0xD2, 0x43, 0x93, 0x03, 0x66, 0x2C, 0x3B, 0xB0, 0xBE, 0x1E, 0xA1, 0xF6, 0xED, 0x08, 0xFD, 0x2B,
+    0xEA, 0xC8, 0x56, 0x13, 0xC1, 0xCC, 0xE5, 0x04, 0x59, 0x97, 0xFF, 0xB2, 0x3F, 0x86, 0x0B, 0x77,
+    0x00, 0x76, 0x58, 0x80, 0x58, 0x0F, 0x50, 0x5F, 0x5B, 0xC0, 0x2C, 0x2D, 0xD0, 0xDA, 0x09, 0xCA,
+    0x21, 0x00, 0x5F, 0x2E, 0x7F, 0xB9, 0x9F, 0xC8, 0x85, 0xAC, 0x81, 0x4C, 0x26, 0xB2, 0x3D, 0x05,
+    0xEA, 0xB9, 0x9D, 0x78, 0x2F, 0x5B, 0x3E, 0x80, 0x75, 0x7F, 0x19, 0x22, 0x29, 0xEF, 0x02, 0x42,
+    0xE1, 0x1E, 0x8D, 0xA0, 0x6B, 0xDA, 0x36, 0xED, 0x63, 0x2B, 0xEF, 0x72, 0x60, 0x7E, 0xB4, 0x51,
+    0x94, 0xFE, 0x54, 0x14, 0xA5, 0x97, 0xF4, 0xB6, 0x24, 0xFD, 0x9D, 0x24, 0xA1, 0x5B, 0xCF, 0x04,
+    0xA3, 0xC6, 0x7A, 0x1B, 0xA9, 0x07, 0x37, 0xD3, 0xA3, 0x31, 0x9B, 0x8D, 0x9A, 0x2C, 0x0D, 0xC4,
+    0xCD, 0xDB, 0xF0, 0x8C, 0x1A, 0x3E, 0xE0, 0xD4, 0x94, 0x10, 0x23, 0xB9, 0x14, 0xB7, 0xB8, 0x11,
+    0xFD, 0xB0, 0x05, 0xDC, 0x8A, 0x00, 0xD8, 0x09, 0x70, 0x0D, 0xF0, 0xAD, 0x13, 0x94, 0x1C, 0x9B,
+    0xFB, 0x2C, 0x56, 0x52, 0x2C, 0xD6, 0x2C, 0x16, 0x2B, 0xB1, 0x58, 0x09, 0xC5, 0xCA, 0x52, 0xAC,
+    0xC9, 0x01, 0xF3, 0x7E, 0x7F, 0x95, 0xAE, 0xD3, 0x2B, 0x20, 0x85, 0x14, 0xED, 0x2D, 0x96, 0x94,
+    0xE7, 0x63, 0x7C, 0xFA, 0xCB, 0x3C, 0x90, 0x35, 0xC9, 0x46, 0x4F, 0x1A, 0x10, 0x54, 0x8B, 0xF3,
+    0xA7, 0xF7, 0x69, 0x61, 0xFF, 0xAC, 0x57, 0x9F, 0xD4, 0xA0, 0x28, 0x45, 0x90, 0x62, 0xAF, 0x19,
+    0x7A, 0xCD, 0x7B, 0x27, 0xE3, 0xDE, 0xC5, 0xF8, 0xC1, 0xFB, 0xD7, 0x2F, 0xA4, 0xBD, 0xD6, 0x6D,
+    0xAF, 0xD1, 0xA8, 0x31, 0xFA, 0xDF, 0xE4, 0x53, 0x3B, 0xB7, 0xA4, 0x7D, 0x15, 0xD2, 0xDE, 0xBE,
+    0x6B, 0xBF, 0x3F, 0xBF, 0xB5, 0xFB, 0x53, 0x79, 0x93, 0x00, 0x00, 0x63, 0x9D, 0x7C, 0xA5, 0x48,
+    0x71, 0x9B, 0x0A, 0xF1, 0x3D, 0x96, 0x5D, 0x28, 0x3D, 0x50, 0xCD, 0xED, 0x08, 0xB4, 0xDF, 0x4E,
+    0xEE, 0xB5, 0x04, 0xEA, 0x79, 0x3F, 0x36, 0xBC, 0x59, 0x83, 0x03, 0xD2, 0x8D, 0x14, 0x8F, 0xFD,
+    0x9A, 0xAE, 0x90, 0x69, 0x2A, 0x22, 0xE4, 0x6A, 0xAA, 0x19, 0xCA, 0x48, 0x3B, 0x42, 0x3D, 0x67,
+    0xD2, 0x75, 0xFA, 0x31, 0xA1, 0xFD, 0x9B, 0x4A, 0x9A, 0xCB, 0x48, 0x3B, 0x3A, 0x5F, 0xCF, 0x99,
+    0x9A, 0x7E, 0xE8, 0xC7, 0x22, 0xE6, 0xCA, 0xD5, 0x54, 0x73, 0x19, 0xD2, 0xBF, 0xA6, 0x7A, 0x2E,
+    0x74, 0x43, 0x99, 0x96, 0x5E, 0x9A, 0x9D, 0xDE, 0x49, 0xFA, 0xFD, 0x74, 0xCA, 0x09, 0xFC, 0x73,
+    0xCC, 0xD2, 0x33, 0xED, 0xCD, 0x8B, 0xC9, 0xCB, 0x29, 0xA5, 0xEC, 0xB0, 0x0F, 0x9C, 0xA5, 0x4D,
+    0x2E, 0x09, 0x9B, 0xE0, 0x9D, 0xC6, 0xEF, 0x43, 0xB0, 0xAE, 0x81, 0xD7, 0x03, 0x14, 0x09, 0xDF,
+    0x7D, 0x2A, 0xE5, 0xA6, 0xDC, 0x52, 0x14, 0x96, 0x4A, 0x5A, 0x33, 0x75, 0xAE, 0x69, 0x27, 0x3B,
+    0x56, 0x8B, 0xF1, 0xC5, 0xCA, 0x9F, 0x7C, 0x42, 0xDF, 0xC0, 0x26, 0x05, 0x70, 0xA2, 0x58, 0x37,
+    0x08, 0x49, 0x3B, 0xA5, 0x98, 0x79, 0xA5, 0xA7, 0xA8, 0xA5, 0xC6, 0x4A, 0xD3, 0x06, 0xE1, 0x72,
+    0x70, 0x47, 0xD5, 0x51, 0x68, 0x4C, 0x18, 0xEB, 0x7A, 0x1B, 0x7A, 0x42, 0x6E, 0x97, 0xD2, 0x28,
+    0x3D, 0x2F, 0x8D, 0x95, 0xC6, 0x42, 0x43, 0xA6, 0x66, 0x03, 0x6E, 0x97, 0xC9, 0x01, 0xDF, 0xFB,
+    0x7E, 0x00, 0xAB, 0x76, 0x38, 0x20, 0x03, 0x2A, 0x8D, 0x40, 0x9E, 0x68, 0xB8, 0x89, 0x8A, 0x94,
+    0x02, 0xA5, 0x19, 0xA8, 0xDF, 0x16, 0x50, 0x79, 0xF9, 0x3D, 0x6A, 0xDB, 0x86, 0x4C, 0x23, 0x65,
+    0xA0, 0x0E, 0x94, 0x11, 0xA3, 0xA1, 0xD2, 0x75, 0xDA, 0xB9, 0x92, 0xB0, 0x2A, 0xA5, 0x6E, 0xC3,
+    0x1F, 0x6C, 0x0B, 0x25, 0x9C, 0x04, 0xD4, 0xCA, 0x34, 0x7F, 0xB6, 0xCB, 0x77, 0xA7, 0x65, 0xA6,
+    0x93, 0xD7, 0xEA, 0x34, 0xB6, 0xB1, 0x50, 0x57, 0x4F, 0x09, 0xB1, 0xDD, 0x7A, 0x41, 0xF5, 0x4E,
+    0x38, 0x64, 0x7A, 0x8E, 0xA4, 0x3C, 0x33, 0x93, 0x10, 0xF4, 0x0B, 0xD4, 0xAF, 0x45, 0xE8, 0x1F,
+    0x53, 0x93, 0x0B, 0x0D, 0x65, 0xC4, 0x4D, 0xAD, 0x86, 0x7A, 0xEE, 0xD5, 0xD9, 0xB0, 0x17, 0x16,
+    0xE6, 0xF6, 0x4D, 0x19, 0xE0, 0xA8, 0x9F, 0xA1, 0xD0, 0x08, 0xD9, 0xD3, 0x1F, 0x48, 0xBD, 0xE2,
+    0x36, 0xEA, 0xAD, 0xEE, 0x5D, 0xD4, 0x4B, 0x01, 0xA9, 0x2C, 0x45, 0x77, 0xCE, 0xB5, 0xFA, 0x4E,
+    0xC2, 0x57, 0xFC, 0x0C, 0xEA, 0xE5, 0x89, 0x7A, 0xEE, 0x14, 0xF5, 0x8E, 0xA4, 0x4B, 0x52, 0x72,
+    0xFB, 0x3C, 0x7A, 0xC8, 0x47, 0x7C, 0x17, 0x88, 0x9D, 0x3D, 0x88, 0xBD, 0x23, 0x53, 0xDF, 0x41,
+    0xA5, 0x81, 0xEC, 0x19, 0xDD, 0xBA, 0x92, 0x6C, 0x82, 0x33, 0xAD, 0x2E, 0x42, 0x9D, 0x40, 0xEC,
+    0x11, 0xEA, 0xA9, 0x1F, 0x4F, 0x40, 0xEC, 0xD7, 0x5B, 0x5D, 0x93, 0x6A, 0x4D, 0xD2, 0x70, 0xF6,
+    0xF8, 0xD4, 0xEB, 0x2A, 0x7C, 0xEE, 0xB7, 0x3E, 0xFD, 0x57, 0xC5, 0x58, 0x8E, 0xF5, 0xFC, 0x5F,
+    0xFF, 0xEF, 0x79, 0xF7, 0xE1, 0x7F, 0x80, 0x7F, 0x01, 0x65, 0x43, 0x3E, 0xC2, 0x97, 0x9D, 0xC2,
+    0xFF, 0xB8, 0xFB, 0xEB, 0x2F, 0x31, 0x7D, 0xC9, 0x74, 0x5F, 0xFA, 0x38, 0x5F, 0xBA, 0x8B, 0x2F,
+    0xF1, 0x4F, 0xFF, 0x05, 0xF8, 0x1C, 0x4C, 0x14, 0x1D, 0x9F, 0x06, 0xA7, 0xF0, 0xD9, 0xDD, 0x7F,
+    0x5F, 0xF2, 0xB1, 0x7C, 0xF8, 0x18, 0x7F, 0xF9, 0x31, 0xEE, 0xFA, 0x18, 0xFC, 0x73, 0x7E, 0x39,
+    0xB7, 0xBB, 0x57, 0xFA, 0xAE, 0xD4, 0x2A, 0x9C, 0xDB, 0x5D, 0xB8, 0xFD, 0xDD, 0x6E, 0xB7, 0xDB,
+    0xD5, 0x92, 0x5E, 0x92, 0xF4, 0xE6, 0xF1, 0xF1, 0xF1, 0x5F, 0x70, 0x2A, 0x89, 0xE7, 0x7D, 0x5F,
+    0x07, 0xE6, 0xF7, 0x99, 0xE6, 0x69, 0x37, 0xE8, 0x17, 0xFA, 0x7B, 0xAE, 0xD9, 0xED, 0x76, 0xBB,
+    0x9D, 0xDB, 0x2C, 0xD3, 0x5B, 0xC7, 0xC7, 0xC7, 0xFB, 0x45, 0x84, 0x4D, 0x09, 0xA1, 0x5A, 0x25,
+    0xA9, 0xA3, 0xA9, 0x9F, 0xD7, 0xE3, 0x2A, 0x42, 0x35, 0xB5, 0xF7, 0x06, 0x3B, 0x3E, 0x97, 0x4D,
+    0x9C, 0x41, 0x65, 0xAC, 0x7D, 0x7F, 0x6F, 0x34, 0x4B, 0xE9, 0xED, 0x58, 0x0F, 0x9F, 0x82, 0x06,
+    0xFA, 0x62, 0xA9, 0x16, 0x0D, 0xBA, 0x16, 0x8B, 0xE0, 0xC6, 0xF6, 0xB1, 0x58, 0xCC, 0x6E, 0xE8,
+    0xCD, 0x6C, 0xC7, 0x3E, 0x5F, 0xEC, 0xF8, 0x69, 0xFE, 0x8A, 0x33, 0xDC, 0x69, 0x7D, 0xFB, 0x44,
+    0x74, 0x3F, 0x96, 0x9D, 0xFB, 0xFB, 0x42, 0x3D, 0xCA, 0x2C, 0xF5, 0xBE, 0x51, 0xB0, 0xE3, 0xA7,
+    0xB8, 0x4A, 0x96, 0x7C, 0xB5, 0x26, 0xA6, 0x80, 0xBF, 0x1B, 0xA0, 0xA7, 0xFC, 0x9F, 0xC3, 0x65,
+    0x97, 0xC4, 0xCC, 0xDB, 0x6B, 0xDF, 0xFF, 0xA7, 0x6C, 0x39, 0x43, 0x31, 0x41, 0x35, 0x40, 0x9B,
+    0xD0, 0x56, 0xA5, 0x4F, 0x49, 0x07, 0x7D, 0xC2, 0x8C, 0xDA, 0x39, 0xA1, 0x19, 0x1E, 0x4E, 0x78,
+    0xCC, 0xD3, 0x97, 0xAC, 0xDF, 0xE7, 0x92, 0xCF, 0xFE, 0xA7, 0x2C, 0x64, 0x94, 0x3E, 0xDD, 0x50,
+    0x0D, 0x79, 0x80, 0xC2, 0xF3, 0x7F, 0xD9, 0xFF, 0xE9, 0x27, 0x92, 0xBE, 0x2B, 0xA9, 0x7D, 0xE3,
+    0xA7, 0xE1, 0x42, 0x35, 0xDC, 0x79, 0xDB, 0x1D, 0xA6, 0x74, 0x07, 0xAA, 0xD9, 0xC5, 0x7E, 0xED,
+    0xD7, 0x3E, 0xBA, 0x70, 0xF6, 0xEA, 0x6F, 0x82, 0xEB, 0x70, 0x0B, 0x4E, 0x9D, 0xD3, 0xE2, 0xB4,
+    0x3A, 0x45, 0xA7, 0xD1, 0x45, 0xDC, 0xC8, 0x6F, 0x27, 0xDF, 0xC1, 0x95, 0xFE, 0x55, 0x7D, 0x7D,
+    0xAD, 0xE7, 0x73, 0xDC, 0xDD, 0x9D, 0x7D, 0x54, 0x83, 0x5E, 0x52, 0xA9, 0xCB, 0xA1, 0x0E, 0xED,
+    0xE4, 0xFC, 0xEF, 0xF1, 0xA9, 0x43, 0x0B, 0x7F, 0xEE, 0xB6, 0x65, 0xF2, 0xB9, 0x2A, 0x7C, 0xF9,
+    0xCC, 0x2F, 0x6C, 0x99, 0xCC, 0xFF, 0xE2, 0xB3, 0x17, 0x3E, 0xF6, 0x11, 0x2E, 0x13, 0x2E, 0x50,
+    0x35, 0x45, 0xE0, 0xF5, 0x2F, 0x7D, 0xEE, 0xFF, 0xF8, 0xBF, 0xCF, 0x9E, 0x6D, 0xAE, 0xDE, 0x79,
+    0x16, 0xAE, 0xF2, 0x4F, 0xDA, 0x00, 0x57, 0x47, 0xCC, 0x8B, 0x1D, 0xF6, 0xE3, 0xF0, 0x3B, 0x9F,
+    0xEB, 0xE5, 0xDF, 0xD8, 0xFD, 0xFB, 0xDF, 0xBA, 0x5A, 0x3C, 0x70, 0x36, 0xFB, 0xF6, 0x70, 0xF5,
+    0xCB, 0x7F, 0x79, 0xF6, 0x8E, 0x3B, 0xB8, 0x9A, 0x52, 0xE6, 0xFE, 0x99, 0x3B, 0x00, 0xBE, 0x74,
+    0x95, 0xDF, 0xFE, 0x1D, 0xCA, 0x07, 0xC9, 0xAF, 0x0D, 0xFC, 0xA5, 0xF4, 0x83, 0xAF, 0x3D, 0xF9,
+    0x3F, 0x7C, 0xFC, 0xD7, 0xB8, 0xFA, 0xB9, 0x2F, 0x9F, 0xE5, 0x7B, 0xE3, 0xD5, 0x2C, 0xFB, 0x08,
+    0x6E, 0x74, 0xFA, 0x7E, 0xA7, 0x5F, 0xD3, 0x06, 0x3E, 0x9E, 0x36, 0x28, 0x21, 0xA5, 0xC2, 0x1E,
+    0xFB, 0x52, 0xFD, 0x68, 0x3D, 0x81, 0x91, 0x69, 0x9F, 0xCB, 0xD2, 0x36, 0x7D, 0xB2, 0x69, 0xA0,
+    0xA5, 0x6D, 0x36, 0xE8, 0x4E, 0x4F, 0xDB, 0xAC, 0x87, 0xC3, 0xF3, 0xE1, 0x70, 0xB8, 0x25, 0x8E,
+    0xD0, 0x36, 0x7D, 0xE9, 0x8F, 0xAE, 0xC0, 0x1F, 0xE2, 0x86, 0xD5, 0x8E, 0x7D, 0xA4, 0xD4, 0x58,
+    0x2B, 0xD4, 0x8F, 0x4B, 0x8D, 0x93, 0x2F, 0xE5, 0x5D, 0x31, 0xB7, 0x43, 0x7F, 0x7F, 0xC8, 0x9E,
+    0x6B, 0x56, 0x3B, 0xD5, 0xC3, 0x9A, 0x07, 0xC8, 0x82, 0x1D, 0xAB, 0x57, 0x62, 0x16, 0xC1, 0x2C,
+    0xD5, 0x68, 0xBF, 0x1F, 0xB2, 0x08, 0xA5, 0x3F, 0x1C, 0xDA, 0xB1, 0x1A, 0xAB, 0x6F, 0x87, 0x2C,
+    0x42, 0x3D, 0x54, 0x63, 0xF5, 0x4A, 0xCC, 0x03, 0xB4, 0x8D, 0x9D, 0xEA, 0xE7, 0x57, 0x13, 0x40,
+    0xD8, 0xB9, 0xED, 0xF4, 0xC0, 0x4C, 0x16, 0x31, 0x12, 0xAD, 0x26, 0xCC, 0x02, 0x5A, 0xA8, 0xD4,
+    0x91, 0x79, 0x38, 0xD7, 0x90, 0x5D, 0xBC, 0x2D, 0x56, 0xFF, 0x45, 0x5C, 0x57, 0x79, 0x1B, 0xCC,
+    0x9A, 0x0B, 0x35, 0x7D, 0xE7, 0x06, 0x3B, 0x70, 0x01, 0xBE, 0xC8, 0x15, 0xD6, 0x3C, 0x64, 0x32,
+    0xD1, 0xA8, 0x0C, 0x66, 0xB5, 0x4B, 0x19, 0x6A, 0x6F, 0x67, 0x37, 0xD5, 0x53, 0x3B, 0xB8, 0x41,
+    0x38, 0xFE, 0x26, 0x85, 0x48, 0xBF, 0xC8, 0x15, 0xD3, 0x98, 0xA5, 0xF4, 0xD5, 0x50, 0x79, 0x37,
+    0xAA, 0xD3, 0x0B, 0x2A, 0xA2, 0x59, 0xED, 0xE2, 0x7C, 0xED, 0xFB, 0xE7, 0xD5, 0xE8, 0xBE, 0xD5,
+    0x2E, 0xE5, 0x52, 0x79, 0x37, 0xB8, 0x41, 0x79, 0x24, 0xE4, 0x73, 0x31, 0x71, 0x21, 0x6B, 0x8E,
+    0xE0, 0xA8, 0x29, 0xBD, 0x89, 0x68, 0xA8, 0xBD, 0x59, 0x69, 0x87, 0x72, 0x41, 0xD8, 0x21, 0x6B,
+    0xCE, 0xF2, 0xC9, 0x2C, 0x98, 0xD9, 0x2E, 0xB5, 0xAF, 0x7D, 0x3B, 0xBA, 0x49, 0x43, 0xFF, 0xBC,
+    0xD0, 0x7D, 0x6B, 0x26, 0x13, 0xF2, 0x58, 0xCC, 0xC6, 0x97, 0x63, 0xCE, 0xAF, 0x70, 0x96, 0x4F,
+    0xF2, 0x07, 0x85, 0xB7, 0xA3, 0xEB, 0xF4, 0x98, 0x8A, 0x50, 0x86, 0x6A, 0x76, 0x93, 0x9B, 0x74,
+    0x4D, 0xB9, 0x8A, 0x50, 0xCD, 0x76, 0x76, 0x53, 0x3F, 0xB4, 0x83, 0x4C, 0xCC, 0x63, 0x31, 0xDB,
+    0xC9, 0x0E, 0x75, 0xF3, 0x55, 0x7E, 0x9D, 0x2E, 0x6B, 0x38, 0x82, 0x6C, 0x81, 0x76, 0xA2, 0x52,
+    0x57, 0x2C, 0x6B, 0xB6, 0x9A, 0xA5, 0xEE, 0xEC, 0xC8, 0xAF, 0x52, 0x8D, 0xB5, 0xAF, 0xBD, 0xF3,
+    0x6E, 0xB6, 0x8B, 0x51, 0xE3, 0xBC, 0x11, 0xB5, 0xCF, 0x22, 0x67, 0xF9, 0x24, 0xD5, 0x68, 0x36,
+    0x80, 0x58, 0xEB, 0xCB, 0x50, 0xC8, 0xC8, 0xAC, 0xF9, 0x9A, 0x45, 0x3E, 0xB9, 0x51, 0xF7, 0xE3,
+    0x40, 0xF1, 0xC4, 0x64, 0x26, 0xE3, 0x9F, 0xCB, 0x83, 0xF1, 0xE5, 0xD4, 0x9B, 0x99, 0x68, 0xEF,
+    0x9B, 0xB1, 0xA3, 0x99, 0x21, 0xE6, 0x33, 0xD8, 0x6F, 0x2F, 0x64, 0xDD, 0xBA, 0x7C, 0x32, 0x0F,
+    0xD5, 0x52, 0x0D, 0xCA, 0x43, 0x39, 0x57, 0xCF, 0xEB, 0xF9, 0x90, 0x9D, 0x8F, 0xE1, 0x0E, 0xB2,
+    0x50, 0x75, 0x10, 0xF2, 0x05, 0x02, 0x75, 0x47, 0xB4, 0x8F, 0x2D, 0xC4, 0xD2, 0xBB, 0x26, 0xE6,
+    0xC1, 0xCC, 0x7F, 0xC3, 0x6F, 0xE3, 0xCE, 0x02, 0x26, 0xB9, 0xC0, 0xCE, 0x5E, 0xC9, 0xFE, 0xC2,
+    0x4D, 0x65, 0x68, 0x27, 0x1B, 0xFA, 0xD1, 0x86, 0x7E, 0xB0, 0xA1, 0x1F, 0xEC, 0xB2, 0xFD, 0xCD,
+    0xA7, 0xFF, 0xDA, 0xED, 0xCF, 0x75, 0xE5, 0xF6, 0x57, 0xCC, 0x6E, 0x28, 0xE6, 0x7A, 0x30, 0xF3,
+    0x5D, 0xE4, 0x29, 0x08, 0xDE, 0x70, 0xC1, 0xF9, 0x22, 0xB6, 0xDE, 0xAA, 0xF5, 0x56, 0xCE, 0x97,
+    0xF1, 0xA8, 0xC9, 0xAE, 0x1C, 0x1F, 0x1F, 0x1F, 0xB7, 0xA7, 0xA5, 0xDE, 0xB9, 0x0B, 0xFD, 0xAA,
+    0x55, 0xF1, 0xDC, 0xC5, 0xD3, 0xCB, 0xAE, 0x1E, 0x36, 0x94, 0x59, 0xBF, 0x99, 0x8E, 0x79, 0xD8,
+    0x34, 0xF4, 0xD2, 0x6F, 0xC8, 0xC3, 0xBA, 0xDB, 0x94, 0xF7, 0xE7, 0x48, 0x42, 0xC8, 0xCC, 0x1B,
+    0x5A, 0xCE, 0x8E, 0xA7, 0xDA, 0x5B, 0xBF, 0xA5, 0xD5, 0xBA, 0x6E, 0xFB, 0xF0, 0x7A, 0xFA, 0xFA,
+    0xEF, 0x76, 0x7A, 0xD4, 0x37, 0xA1, 0x9F, 0xE8, 0x35, 0x18, 0xAD, 0x48, 0x3E, 0x25, 0x19, 0x05,
+    0x23, 0x4D, 0xFF, 0xCD, 0x43, 0x6B, 0xF6, 0xC3, 0xCB, 0x1E, 0x94, 0xEC, 0x4D, 0xD7, 0x90, 0x85,
+    0x74, 0x97, 0x90, 0xAE, 0x1F, 0xC9, 0xFA, 0x86, 0x22, 0x70, 0x59, 0x64, 0x0A, 0xA5, 0x56, 0x9C,
+    0x66, 0xAB, 0x85, 0x56, 0xA3, 0x55, 0x87, 0x5B, 0xF7, 0x52, 0xB1, 0x9C, 0xC0, 0x35, 0x14, 0x13,
+    0xD4, 0x0D, 0x79, 0xC3, 0x69, 0xAF, 0xF6, 0x05, 0xC8, 0x1A, 0x8A, 0x08, 0xB5, 0x4F, 0x48, 0xD8,
+    0x79, 0xBF, 0x2B, 0x13, 0xF8, 0x35, 0xBB, 0xB2, 0xCF, 0x00, 0xE1, 0xEE, 0x2B, 0xFD, 0x75, 0xD0,
+    0x13, 0x0A, 0x94, 0xD1, 0x29, 0xE0, 0xE6, 0x5E, 0x01, 0x0D, 0x3F, 0xBC, 0xBC, 0x18, 0x81, 0xF5,
+    0x36, 0x90, 0x30, 0xD6, 0xB8, 0x46, 0x03, 0xAC, 0xF9, 0x0A, 0xF7, 0xCC, 0xE5, 0xC2, 0x3D, 0x1A,
+    0xEA, 0xA9, 0xD4, 0x4A, 0xDB, 0x39, 0x4D, 0xD9, 0x8A, 0x16, 0xCC, 0x62, 0x22, 0xD8, 0xA9, 0x9C,
+    0xC0, 0x75, 0x55, 0x07, 0x2B, 0xBF, 0x71, 0x00, 0x26, 0xC0, 0x05, 0x38, 0xD3, 0x54, 0x33, 0x6C,
+    0x65, 0x2A, 0x8C, 0x3A, 0xEA, 0x50, 0x46, 0x70, 0xD3, 0x51, 0x03, 0x9F, 0xE2, 0xEC, 0x95, 0x04,
+    0x06, 0x6F, 0x67, 0xDA, 0xA9, 0xD2, 0x5C, 0xC6, 0x5C, 0x1A, 0xFB, 0xA1, 0x92, 0xCA, 0xC0, 0xCD,
+    0x4B, 0xA1, 0x1F, 0xA0, 0x7E, 0x29, 0x00, 0x6B, 0x3F, 0x40, 0xF9, 0x46, 0x00, 0xFA, 0x7E, 0x80,
+    0xFA, 0xEF, 0x03, 0x59, 0x1F, 0xDB, 0x21, 0x93, 0xAE, 0x2D, 0xD4, 0xF2, 0xAE, 0xCB, 0x75, 0xDD,
+    0x2C, 0xD4, 0x13, 0x6E, 0xC8, 0x02, 0x79, 0xC0, 0x0E, 0xDC, 0xB5, 0x4F, 0xF4, 0x80, 0x33, 0x0D,
+    0x77, 0x61, 0x84, 0x5D, 0x68, 0x7D, 0xAE, 0xA1, 0x10, 0x75, 0xC0, 0xF9, 0x4C, 0x0D, 0x5F, 0xE4,
+    0xE8, 0xC2, 0xBE, 0xD2, 0xC2, 0x75, 0x7E, 0xA7, 0x94, 0x1A, 0x55, 0x92, 0xA2, 0xEB, 0x5A, 0x2D,
+    0x1F, 0xDF, 0xAC, 0x11, 0x36, 0x66, 0x74, 0x16, 0x3B, 0xD5, 0x43, 0x9B, 0xC5, 0x4C, 0x26, 0xDA,
+    0xC5, 0x4D, 0xCE, 0xF7, 0xCF, 0xEB, 0xBE, 0x35, 0xF1, 0xA4, 0x7E, 0xE8, 0x5F, 0x50, 0x11, 0xED,
+    0x62, 0x67, 0x37, 0xE9, 0x31, 0xE5, 0x6B, 0x11, 0xEC, 0x9E, 0x35, 0x15, 0x8B, 0xF1, 0xE5, 0x58,
+    0x75, 0x9F, 0xE7, 0x0C, 0x77, 0xF1, 0x07, 0x74, 0x07, 0xD9, 0xE1, 0x34, 0x1B, 0xC9, 0x57, 0xDE,
+    0x8D, 0x6A, 0xDA, 0xC7, 0x03, 0xB2, 0xDE, 0x84, 0x76, 0xB0, 0x6F, 0x0A, 0x77, 0x2D, 0x20, 0xEB,
+    0xCB, 0xA5, 0x9E, 0xDC, 0xD0, 0x6A, 0xA5, 0xD5, 0x44, 0x7B, 0xCA, 0x82, 0x2F, 0x47, 0x4C, 0x84,
+    0x7E, 0x4C, 0x65, 0x56, 0x46, 0x42, 0xA4, 0x7E, 0x70, 0x2C, 0xA7, 0x98, 0x05, 0x3B, 0xBA, 0x63,
+    0xFD, 0x9F, 0x92, 0x2A, 0xC9, 0x63, 0x47, 0x88, 0x7B, 0x30, 0xB1, 0xD5, 0xEC, 0xF4, 0x8A, 0x54,
+    0x78, 0xEA, 0x8E, 0xFE, 0x7A, 0xAE, 0x70, 0xD4, 0x07, 0xEC, 0x4C, 0x35, 0xD1, 0x76, 0x45, 0x38,
+    0xD6, 0x0F, 0xB4, 0x16, 0xDA, 0x07, 0x59, 0x32, 0x35, 0x85, 0x7C, 0xA1, 0x2B, 0xC5, 0x8A, 0x89,
+    0xE4, 0x7A, 0x1A, 0xC9, 0xBB, 0x37, 0x54, 0x8D, 0xEE, 0xC5, 0xB9, 0x98, 0xD7, 0x2C, 0xBA, 0xA1,
+    0x2F, 0xD7, 0x7E, 0x90, 0x86, 0x32, 0x95, 0x74, 0x68, 0xF5, 0x0F, 0xC9, 0x39, 0x12, 0xCD, 0x12,
+    0x0A, 0xFF, 0x1B, 0x76, 0xC4, 0x75, 0xB4, 0xB0, 0x92, 0x07, 0x4C, 0xA0, 0x98, 0x29, 0x3D, 0xA5,
+    0xA7, 0x38, 0xF8, 0xE7, 0xDA, 0x85, 0x5E, 0x43, 0x7B, 0xFF, 0x52, 0x0F, 0x7D, 0xE9, 0xDD, 0xA3,
+    0xAA, 0x87, 0x4A, 0x83, 0x91, 0x2F, 0xA4, 0xFB, 0x96, 0xEA, 0xCD, 0x90, 0x87, 0x96, 0xDE, 0xCE,
+    0xED, 0x63, 0xD2, 0x90, 0x92, 0xC3, 0x93, 0xAC, 0x9C, 0x91, 0x3A, 0xDD, 0x98, 0xDD, 0x90, 0xBA,
+    0x54, 0x7A, 0xE5, 0xA1, 0xBE, 0x25, 0x23, 0x0D, 0x77, 0x6B, 0xA2, 0xF2, 0xD4, 0x73, 0xD6, 0x2F,
+    0x46, 0x4B, 0x72, 0x7E, 0xC1, 0x3D, 0x2F, 0x2E, 0xB9, 0x14, 0x72, 0xBD, 0x31, 0xE7, 0xC1, 0x4E,
+    0xE5, 0x54, 0x77, 0x75, 0xF7, 0x1C, 0xCF, 0xE5, 0x4B, 0xBE, 0x94, 0x53, 0x39, 0xD5, 0x9D, 0xBE,
+    0xAF, 0x17, 0xF5, 0x75, 0xC1, 0xD1, 0x15, 0x8C, 0x16, 0x5A, 0x2D, 0x66, 0xBD, 0xEC, 0xEB, 0xA9,
+    0x9E, 0x0E, 0x8F, 0xC6, 0x84, 0x76, 0xB0, 0x5E, 0xB8, 0x6B, 0x21, 0x5B, 0xAD, 0x2F, 0xE7, 0xDA,
+    0xF7, 0x83, 0x53, 0xC0, 0x69, 0xE0, 0xEE, 0xA7, 0xE0, 0x0E, 0x8E, 0xC2, 0x91, 0x7C, 0xAD, 0xEE,
+    0x33, 0x2B, 0x66, 0xC1, 0x4E, 0xB8, 0x8E, 0x93, 0xC3, 0x4C, 0x8D, 0xF4, 0x9A, 0xF4, 0xBB, 0xBB,
+    0x8B, 0xFC, 0x5E, 0x93, 0x29, 0x66, 0xD2, 0xA8, 0x4B, 0x8B, 0xEB, 0x54, 0x8E, 0xED, 0x40, 0x3D,
+    0x52, 0xF9, 0xED, 0xB7, 0x9E, 0xA8, 0x27, 0x9C, 0xF4, 0xA0, 0xF4, 0xAA, 0xE4, 0xCF, 0xED, 0x2E,
+    0xF0, 0x7B, 0x4D, 0xA9, 0xB9, 0x56, 0x70, 0xF7, 0xC6, 0xDF, 0xCE, 0x22, 0x26, 0x50, 0x79, 0xA3,
+    0x29, 0x57, 0x20, 0x5F, 0x41, 0xE4, 0x2B, 0x55, 0x70, 0x9A, 0x9D, 0xC6, 0xB3, 0xFF, 0x08, 0xDC,
+    0x01, 0x55, 0x9A, 0x35, 0x1A, 0xA9, 0x23, 0xE5, 0x8D, 0x31, 0x0B, 0x11, 0x67, 0x47, 0x3B, 0xC6,
+    0x7C, 0xB1, 0xA3, 0x93, 0x7E, 0x22, 0xE9, 0xEC, 0xB1, 0xAE, 0xEE, 0x67, 0x4D, 0x99, 0xD2, 0xE1,
+    0x5E, 0x91, 0xEE, 0x57, 0xA8, 0x06, 0xFA, 0x26, 0xD7, 0x6C, 0xB5, 0x64, 0xAD, 0xA7, 0x9E, 0x68,
+    0xBB, 0x3C, 0x72, 0xF9, 0x27, 0xD2, 0x03, 0x9A, 0xCB, 0x7F, 0x04, 0xBE, 0x48, 0xA1, 0xAE, 0x94,
+    0xB7, 0x2B, 0x65, 0xA0, 0x08, 0x18, 0xA9, 0x91, 0x66, 0xF7, 0x98, 0xAA, 0xB1, 0x7E, 0x6D, 0x29,
+    0x66, 0x65, 0xD1, 0x8D, 0x2A, 0xA4, 0xAE, 0x55, 0x97, 0xFF, 0xC7, 0xE4, 0xD8, 0x09, 0x52, 0x94,
+    0x42, 0x30, 0xF3, 0x5F, 0xDB, 0x89, 0x6A, 0xC0, 0x35, 0xF4, 0x10, 0x31, 0x01, 0xB3, 0x50, 0xEE,
+    0x27, 0x4C, 0x3E, 0xC1, 0xDD, 0x0D, 0x8A, 0xA8, 0x1F, 0x7B, 0xB3, 0xD4, 0xC3, 0x73, 0xE5, 0xEC,
+    0x1A, 0xF5, 0x9D, 0x55, 0x57, 0x68, 0x29, 0xDF, 0xD2, 0xE3, 0xB3, 0x7D, 0x33, 0xE4, 0xA1, 0x6D,
+    0x7A, 0x7B, 0x4B, 0xE7, 0xA5, 0xE6, 0xE8, 0x26, 0xFC, 0x11, 0x99, 0x96, 0x4C, 0x1A, 0xF4, 0xD0,
+    0xE2, 0x3A, 0x55, 0x63, 0xFD, 0xE2, 0x52, 0x7A, 0xDD, 0x1B, 0x2A, 0x29, 0x93, 0x86, 0xAC, 0x1D,
+    0xA9, 0x3D, 0xAD, 0x3F, 0xAB, 0xD9, 0x68, 0xE2, 0xB3, 0x1D, 0xE7, 0x76, 0xBB, 0xDD, 0xBF, 0x91,
+    0xA4, 0x17, 0x25, 0x29, 0xEB, 0x6F, 0x29, 0x64, 0xEA, 0xCC, 0x5C, 0xAC, 0xD8, 0xA1, 0x5A, 0x70,
+    0x1B, 0x18, 0xBD, 0x83, 0x42, 0xBB, 0x8B, 0x54, 0x1B, 0xEC, 0x7F, 0xCC, 0x24, 0xA5, 0x8C, 0x8D,
+    0x6A, 0x81, 0xB3, 0xBA, 0x75, 0x25, 0x65, 0xA1, 0x3E, 0xA3, 0xA7, 0xB7, 0x64, 0x89, 0x76, 0xDA,
+    0x9C, 0xC0, 0x52, 0x4C, 0xA9, 0x40, 0x40, 0xBE, 0x36, 0x9B, 0x5F, 0x21, 0xB9, 0x1B, 0xEE, 0x5F,
+    0x31, 0x6B, 0xBE, 0x52, 0x84, 0x2C, 0x52, 0x06, 0x52, 0x2E, 0x35, 0x76, 0x86, 0xFC, 0xD9, 0x5B,
+    0xCF, 0x26, 0x6C, 0x63, 0xDE, 0xAF, 0xC7, 0x09, 0x20, 0x7E, 0xD4, 0xDE, 0x3A, 0x4E, 0xB9, 0xC2,
+    0xC9, 0x7D, 0xE5, 0xC6, 0x7D, 0x42, 0x7D, 0xDF, 0xC1, 0x39, 0x3D, 0xF9, 0x6F, 0xBF, 0xE5, 0x24,
+    0x85, 0x5A, 0x52, 0xA8, 0x6E, 0x49, 0xCB, 0x51, 0xC7, 0xAE, 0xC9, 0x1E, 0xD6, 0x53, 0xA7, 0xCC,
+    0xDF, 0xE6, 0xE4, 0x70, 0xDC, 0x97, 0x9D, 0xF9, 0xCE, 0x1E, 0xDE, 0x80, 0x86, 0x7A, 0x39, 0x1C,
+    0xDA, 0xC0, 0xBF, 0x3B, 0x1C, 0x6E, 0x6A, 0xB0, 0x86, 0x0D, 0x60, 0x06, 0x1A, 0xEC, 0x52, 0x04,
+    0x38, 0x07, 0x1A, 0xEA, 0xF9, 0xB2, 0x62, 0xAE, 0x05, 0x0D, 0xFD, 0x9B, 0x52, 0xB4, 0x29, 0x6E,
+    0x3F, 0x48, 0xA1, 0x1E, 0xFF, 0x06, 0x49, 0x94, 0x01, 0x37, 0x7C, 0x05, 0xE9, 0x3A, 0x65, 0xC0,
+    0x4D, 0x77, 0xA5, 0x52, 0x7D, 0x81, 0x7A, 0x6D, 0xF6, 0x87, 0x56, 0x7E, 0x7F, 0x98, 0x2B, 0xEC,
+    0x0F, 0xA9, 0xD7, 0xFD, 0xE1, 0xA7, 0xF3, 0x75, 0x5F, 0xE1, 0xCF, 0xB1, 0x96, 0x12, 0x14, 0x92,
+    0xCB, 0xA3, 0x93, 0x3A, 0x8C, 0x56, 0xA7, 0xE0, 0xA4, 0x86, 0x4C, 0x4B, 0xBD, 0xF7, 0x2B, 0x9E,
+    0x69, 0xD8, 0x01, 0x59, 0x7F, 0x15, 0xCA, 0x04, 0xBD, 0x96, 0xA7, 0x5A, 0xBF, 0x10, 0xB0, 0x81,
+    0x1E, 0x1B, 0xA8, 0xBB, 0x22, 0x50, 0x0E, 0x66, 0x05, 0x32, 0xFD, 0xE9, 0xC5, 0x44, 0x68, 0x23,
+    0x6D, 0x85, 0x92, 0x30, 0xE2, 0xCE, 0x94, 0xCF, 0x55, 0x4A, 0x11, 0x2E, 0xC5, 0x1D, 0xFB, 0x5A,
+    0x43, 0x7E, 0x1F, 0xDF, 0xC8, 0x74, 0x33, 0xFB, 0x16, 0x95, 0x52, 0x32, 0x82, 0x9A, 0x0D, 0x88,
+    0x78, 0xE6, 0xE2, 0x26, 0xE1, 0x8B, 0x61, 0xEF, 0x12, 0x2F, 0xE2, 0x3E, 0x93, 0xBC, 0x58, 0xC8,
+    0x76, 0xF7, 0x25, 0x54, 0xE7, 0x01, 0xF0, 0xF8, 0xB5, 0x9B, 0xBB, 0xDD, 0xAE, 0x69, 0xBB, 0x43,
+    0xB1, 0x84, 0x94, 0x38, 0x32, 0x00, 0x49, 0xBC, 0x94, 0x0D, 0xF4, 0x1D, 0xA5, 0x3A, 0xFA, 0x94,
+    0xEC, 0xD8, 0xB7, 0xED, 0x13, 0x73, 0x68, 0xBF, 0xFE, 0xB8, 0xFF, 0xD6, 0xAF, 0x54, 0x43, 0x47,
+    0x9B, 0x3C, 0x8E, 0xC5, 0x9C, 0xC2, 0x45, 0x6D, 0x43, 0x16, 0x7F, 0xE6, 0xDB, 0xAD, 0x7F, 0xB6,
+    0xD9, 0xE3, 0xFC, 0x53, 0x41, 0x9F, 0x72, 0x3E, 0xB3, 0x83, 0xFE, 0x01, 0x49, 0xFA, 0xB1, 0x94,
+    0x70, 0x90, 0xD2, 0x6E, 0xB7, 0xDB, 0xF5, 0x0D, 0xD0, 0x37, 0x80, 0x0E, 0x9B, 0x54, 0x65, 0xA0,
+    0xFB, 0x30, 0x37, 0x6C, 0x93, 0xFE, 0x54, 0x78, 0x7E, 0xA5, 0x1A, 0xBA, 0xBF, 0x76, 0xE5, 0x13,
+    0x73, 0x68, 0xBF, 0xFE, 0xF6, 0xDB, 0x21, 0xD5, 0x9B, 0x0A, 0x58, 0x75, 0x94, 0x0B, 0x94, 0xFB,
+    0xF0, 0x72, 0x89, 0xE9, 0x28, 0xBD, 0x59, 0x28, 0x03, 0xEA, 0xCA, 0x85, 0x72, 0x29, 0x67, 0x68,
+    0xEF, 0xD7, 0xDE, 0x6B, 0xAC, 0x5E, 0x92, 0x9E, 0x78, 0x6B, 0xB7, 0x6B, 0xBB, 0xBE, 0xA1, 0xED,
+    0xCA, 0x85, 0xBE, 0x43, 0xB8, 0x0E, 0x8B, 0x19, 0x4E, 0x47, 0x88, 0x52, 0x86, 0x9D, 0x13, 0x46,
+    0xC2, 0x49, 0x26, 0x06, 0x95, 0xD7, 0xDE, 0x5C, 0x7E, 0xD5, 0xBE, 0xD0, 0xE1, 0x52, 0x86, 0x83,
+    0xF1, 0x29, 0xD1, 0xC4, 0xC1, 0x95, 0xF0, 0xC9, 0xF2, 0x9A, 0x5F, 0xDC, 0xCB, 0x2F, 0xFB, 0xB6,
+    0xEF, 0x71, 0xF2, 0x38, 0x6D, 0xB5, 0xB3, 0x36, 0xF3, 0xE8, 0xA8, 0x81, 0xB6, 0x39, 0xFD, 0x48,
+    0xD4, 0xB6, 0xD7, 0xE6, 0xD0, 0x9A, 0xC7, 0xFD, 0x5F, 0xEE, 0xAF, 0x43, 0x20, 0x33, 0xFE, 0xCE,
+    0xCA, 0x5E, 0x1B, 0xE5, 0xDC, 0xF3, 0x4A, 0x32, 0x21, 0x53, 0x4C, 0x7E, 0xD1, 0x80, 0xDB, 0x9C,
+    0x3F, 0x9B, 0x23, 0xA8, 0x83, 0xFC, 0xA9, 0x9F, 0x45, 0x41, 0x22, 0xBF, 0x62, 0x66, 0xBE, 0x65,
+    0xC7, 0x32, 0xB8, 0xA6, 0x1F, 0x62, 0xB1, 0x98, 0xB9, 0x7D, 0xF2, 0xD2, 0x6B, 0x92, 0x2E, 0xA7,
+    0x72, 0x35, 0xBE, 0xED, 0x52, 0x69, 0x9B, 0x76, 0x4C, 0xCC, 0xE2, 0x2B, 0x29, 0x6D, 0xE2, 0xE1,
+    0x54, 0x75, 0xA6, 0x7C, 0xCF, 0xE3, 0x48, 0x3E, 0x9D, 0xAC, 0xCB, 0x42, 0xD5, 0x15, 0x5E, 0x5D,
+    0x35, 0xA8, 0x69, 0xE9, 0xCF, 0xC7, 0x5D, 0x7F, 0xBF, 0xA4, 0x4B, 0x69, 0x86, 0x7A, 0xE8, 0xC1,
+    0xCE, 0x64, 0x6A, 0xB0, 0x73, 0x9A, 0x39, 0x49, 0x89, 0x2D, 0x96, 0x7D, 0xB6, 0x8E, 0x6B, 0x8A,
+    0x8E, 0x88, 0xEB, 0xCC, 0x6C, 0x22, 0x76, 0x74, 0x03, 0xEE, 0xBE, 0x05, 0xA2, 0x93, 0xF4, 0x53,
+    0x49, 0x7A, 0x4D, 0x92, 0x1E, 0xB8, 0xB9, 0xDB, 0x5D, 0x2C, 0xE7, 0x7D, 0xEA, 0x5E, 0x19, 0xF6,
+    0x4E, 0xF9, 0x8F, 0xBD, 0x4B, 0x3F, 0xFF, 0xCB, 0x43, 0x3A, 0xF4, 0xC9, 0xE4, 0x6B, 0x9B, 0xDD,
+    0xEF, 0x5F, 0x69, 0x25, 0x2D, 0xAD, 0xA4, 0xB5, 0xDD, 0xED, 0x76, 0xBB, 0xCB, 0x0D, 0x50, 0xBC,
+    0xB5, 0xDB, 0xED, 0x2E, 0xF4, 0x92, 0xD6, 0x52, 0x92, 0xBA, 0xFE, 0xC9, 0x87, 0x8F, 0xA7, 0x64,
+    0xB6, 0xF7, 0x27, 0x89, 0x60, 0xA7, 0xC2, 0x87, 0x5F, 0xDC, 0x97, 0x8B, 0x6B, 0x67, 0x28, 0xDE,
+    0x9E, 0xA1, 0xBF, 0x7F, 0xA1, 0x8C, 0xD5, 0x42, 0x3F, 0xB7, 0x4B, 0xF9, 0xCE, 0x2B, 0xEF, 0x2C,
+    0xEE, 0xD2, 0xFD, 0xAF, 0xF9, 0x7F, 0xF5, 0x48, 0x75, 0x3F, 0xD9, 0xFC, 0x08, 0x14, 0xAF, 0xCC,
+    0x50, 0xDD, 0x3F, 0xC2, 0x23, 0x55, 0x43, 0x3E, 0x3F, 0x02, 0xE5, 0x2B, 0x0B, 0xD4, 0xF7, 0x4F,
+    0xF0, 0x37, 0x55, 0x47, 0x3E, 0x7F, 0xF5, 0xF4, 0x29, 0x0E, 0x0E, 0x9F, 0x2D, 0xC7, 0x27, 0x41,
+    0xE0, 0xDA, 0xEE, 0xEE, 0x27, 0x2F, 0x16, 0x73, 0x29, 0x49, 0xF7, 0x4A, 0xD2, 0xBC, 0xDB, 0xED,
+    0x76, 0x6D, 0x03, 0x14, 0xDF, 0xDB, 0xED, 0x76, 0x5F, 0xF8, 0xE9, 0x01, 0x18, 0xBF, 0x7C, 0xF6,
+    0xF8, 0xCF, 0x1F, 0x5A, 0xF6, 0x79, 0x38, 0x27, 0x1B, 0x7E, 0xE7, 0x00, 0xFA, 0xC8, 0xAF, 0xBC,
+    0xEF, 0xBD, 0xD3, 0xA9, 0xF7, 0x74, 0x3A, 0x9B, 0x1F, 0xC1, 0x14, 0xAF, 0xCC, 0x5F, 0x72, 0xD5,
+    0xFD, 0xAF, 0x7A, 0x3D, 0x52, 0xB5, 0x43, 0x3F, 0xB7, 0x4B, 0x0A, 0xB3, 0xF6, 0xF7, 0x2F, 0xD0,
+    0xB7, 0x1D, 0xA9, 0x6C, 0x65, 0xDF, 0x01, 0x5F, 0x3E, 0xC4, 0x89, 0x86, 0x8F, 0x43, 0x1E, 0xEC,
+    0x44, 0x1E, 0xB3, 0x95, 0x3C, 0x52, 0x25, 0x88, 0x77, 0x2E, 0x49, 0xAF, 0xC4, 0xDD, 0x6E, 0x17,
+    0x23, 0x50, 0xDD, 0xF8, 0xCE, 0x6E, 0x77, 0xE9, 0xFB, 0x92, 0x34, 0xD5, 0x92, 0xA6, 0x3C, 0x52,
+    0x4D, 0xB8, 0xC1, 0xEE, 0x71, 0x35, 0xFF, 0x3A, 0xF3, 0x90, 0x71, 0x67, 0x8A, 0x0F, 0xDB, 0x59,
+    0x13, 0xB8, 0x6B, 0x1A, 0xC8, 0xD7, 0x52, 0x60, 0x67, 0x1B, 0xA1, 0x1D, 0x5C, 0x20, 0x8F, 0xB4,
+    0xB7, 0x8E, 0x9F, 0xF5, 0x28, 0x41, 0x94, 0xA4, 0x40, 0x21, 0xC9, 0x63, 0x23, 0x7D, 0x43, 0x1D,
+    0x4C, 0x00, 0xE7, 0xED, 0x04, 0x1A, 0x7B, 0xC8, 0x74, 0x6D, 0x01, 0xA3, 0x6A, 0x80, 0x32, 0xF6,
+    0x40, 0xA5, 0xF9, 0x90, 0xC9, 0xD2, 0xA7, 0x12, 0x71, 0xA9, 0x20, 0xC3, 0x09, 0xB3, 0xFD, 0x55,
+    0x80, 0xEC, 0xB9, 0x86, 0x2C, 0x95, 0x07, 0x8B, 0xD8, 0xEF, 0xF4, 0x9E, 0x2B, 0xB9, 0xBA, 0x2D,
+    0x1E, 0xD2, 0x0F, 0x5B, 0xDB, 0x76, 0xA4, 0x7E, 0x27, 0x52, 0x49, 0x63, 0x29, 0xC5, 0x5C, 0x8D,
+    0x06, 0x37, 0x16, 0xA1, 0x5C, 0x68, 0x07, 0x51, 0x86, 0xCA, 0xA3, 0xC7, 0x56, 0xAC, 0x77, 0x53,
+    0x26, 0xB3, 0xE2, 0x26, 0x37, 0x99, 0x60, 0x84, 0x9A, 0x7A, 0x76, 0x53, 0x96, 0x24, 0xCA, 0xBA,
+    0xD5, 0x43, 0x3A, 0x93, 0x44, 0xF3, 0x6A, 0x25, 0xBD, 0x2A, 0x69, 0xD6, 0xEB, 0xCF, 0xC6, 0x2D,
+    0x96, 0xA5, 0x31, 0x85, 0xB2, 0x6C, 0x04, 0xA3, 0xDF, 0xDD, 0x35, 0xFA, 0xB6, 0xA4, 0xB9, 0x97,
+    0x62, 0x9D, 0x04, 0xFB, 0xED, 0x2D, 0xF6, 0x27, 0xDE, 0x7A, 0xFD, 0xF8, 0x52, 0x6C, 0xD3, 0xDA,
+    0xD5, 0x6B, 0x87, 0xC2, 0x31, 0x40, 0xF6, 0x47, 0x4D, 0xDE, 0x71, 0x8F, 0x74, 0xEF, 0x82, 0x93,
+    0x6E, 0x05, 0x9C, 0xA4, 0x80, 0x5B, 0xE9, 0x03, 0x6E, 0xC1, 0xA8, 0xA9, 0x16, 0x32, 0x79, 0x1B,
+    0xC8, 0x14, 0x8B, 0x48, 0x16, 0xF4, 0x98, 0xC8, 0x42, 0xED, 0x35, 0x64, 0xB1, 0x0C, 0x6E, 0x22,
+    0xE6, 0xB2, 0x0B, 0x91, 0xFE, 0xDA, 0x4A, 0xA4, 0xF6, 0xEA, 0x22, 0x36, 0xB8, 0x29, 0x62, 0xD6,
+    0x32, 0xAC, 0x64, 0x3A, 0xAF, 0x15, 0x34, 0xB8, 0x15, 0xFA, 0xB1, 0x48, 0x49, 0x53, 0x9A, 0x33,
+    0x79, 0x7A, 0x49, 0x33, 0xBD, 0x24, 0x4F, 0x5F, 0x48, 0x23, 0x96, 0xA3, 0x3F, 0x7F, 0x77, 0x4A,
+    0x7F, 0x4A, 0xDD, 0x74, 0x0B, 0x50, 0xA6, 0xBC, 0x9B, 0xB8, 0x95, 0x38, 0xC3, 0xBC, 0x23, 0xA0,
+    0x75, 0x33, 0x94, 0x6F, 0x6A, 0x80, 0x68, 0x03, 0xD4, 0x83, 0x26, 0xCC, 0x52, 0x68, 0xCB, 0x7B,
+    0xB6, 0xDE, 0xA8, 0x63, 0xA5, 0x0A, 0xD4, 0x03, 0x1A, 0x4D, 0xC0, 0xAE, 0xB4, 0x1D, 0xAD, 0xB7,
+    0x1E, 0xA3, 0xF3, 0x02, 0x17, 0xDC, 0x48, 0xA6, 0x6B, 0x27, 0x42, 0xF8, 0xEF, 0x95, 0xB2, 0x81,
+    0x24, 0xB5, 0x87, 0x48, 0xC1, 0x4D, 0xFD, 0x70, 0xF7, 0x85, 0xE8, 0x16, 0x32, 0x95, 0x82, 0xFE,
+    0xBC, 0x06, 0xDC, 0xE0, 0x16, 0xAA, 0xA9, 0x14, 0xD6, 0x67, 0x1A, 0x4C, 0xC0, 0x2D, 0x79, 0xA4,
+    0x14, 0x02, 0x0D, 0xAE, 0xC3, 0x2D, 0xF5, 0x40, 0x21, 0x3B, 0x81, 0x5E, 0x9C, 0xA1, 0xBE, 0x15,
+    0xA0, 0x48, 0xD9, 0xB4, 0x29, 0xA3, 0xA8, 0x03, 0x93, 0xC6, 0x36, 0xED, 0x61, 0x1E, 0xC9, 0x9B,
+    0xF2, 0xC7, 0x4A, 0xE0, 0xF1, 0x54, 0x3D, 0x4E, 0x4D, 0x2B, 0x29, 0x26, 0xF3, 0xCD, 0xCD, 0xEF,
+    0x4A, 0x5A, 0x77, 0x53, 0x52, 0x5F, 0x76, 0xBB, 0xDD, 0xFD, 0xD2, 0xF6, 0xC8, 0x95, 0x00, 0x7A,
+    0x6F, 0xE9, 0xC9, 0xDD, 0x6E, 0x77, 0xDF, 0x7A, 0xAA, 0xEE, 0xD9, 0x7C, 0x82, 0x5E, 0x68, 0x97,
+    0x7D, 0xFC, 0x35, 0x6E, 0x0F, 0xA5, 0x96, 0x34, 0x72, 0xB4, 0x57, 0x19, 0x1F, 0xE6, 0x50, 0x0D,
+    0xC2, 0x7A, 0xB8, 0x5B, 0x8A, 0x94, 0x92, 0xE6, 0x4C, 0x92, 0xC6, 0x4A, 0x92, 0xCE, 0xEB, 0xBA,
+    0x09, 0xD8, 0x48, 0x35, 0xD1, 0x4E, 0xF4, 0x8D, 0x11, 0x26, 0x60, 0x17, 0xAA, 0x89, 0xF6, 0x7B,
+    0x3B, 0x3D, 0xF9, 0x6F, 0x74, 0x60, 0xFB, 0xFB, 0xBE, 0xFD, 0xF0, 0xA1, 0xB8, 0xBB, 0xA0, 0xAE,
+    0x1E, 0x49, 0xA5, 0x17, 0xCA, 0x58, 0x2C, 0x60, 0x63, 0x3D, 0x42, 0xB5, 0x1E, 0xD2, 0xAD, 0x9A,
+    0x5A, 0x52, 0xA4, 0xD2, 0x1E, 0x74, 0x37, 0x26, 0x6F, 0x6B, 0x2A, 0x85, 0x93, 0xF2, 0x08, 0xB2,
+    0x7E, 0x3F, 0x9B, 0xF6, 0xFD, 0x91, 0x14, 0x53, 0x06, 0x5B, 0x3F, 0x1D, 0xAA, 0x15, 0xDA, 0xE5,
+    0xDC, 0x6E, 0x77, 0x71, 0x23, 0xCA, 0xA9, 0xFE, 0xDC, 0xDC, 0xED, 0x76, 0x17, 0x53, 0xD0, 0xB3,
+    0x9F, 0x0E, 0x35, 0x00, 0x32, 0x29, 0x49, 0x69, 0x69, 0x26, 0x65, 0xDC, 0xFF, 0xCB, 0x83, 0x1E,
+    0xDD, 0x4A, 0x4F, 0x91, 0x12, 0xAC, 0x8B, 0x93, 0xCC, 0xFC, 0x06, 0xB8, 0x47, 0xCD, 0x49, 0xD8,
+    0x34, 0x9E, 0x2E, 0x36, 0xB7, 0xDB, 0xED, 0x2E, 0xF6, 0xAF, 0xBD, 0xFB, 0xF1, 0xCC, 0xBB, 0xDD,
+    0x6E, 0xD7, 0x8F, 0x87, 0x4A, 0xB8, 0xA9, 0x75, 0x3B, 0x1D, 0x2E, 0xD2, 0xCF, 0x95, 0x36, 0x80,
+    0xFA, 0x3E, 0xA7, 0xBB, 0x90, 0xD6, 0x86, 0x0D, 0xA9, 0x9E, 0x90, 0x30, 0x6E, 0x48, 0xC1, 0xE4,
+    0x7F, 0xDC, 0x2A, 0x6E, 0x66, 0x87, 0xBA, 0x83, 0x1A, 0xB1, 0xFE, 0x48, 0x23, 0xF5, 0x98, 0x69,
+    0xA0, 0xED, 0x72, 0x35, 0x88, 0x94, 0xAB, 0x5A, 0x86, 0x73, 0x0F, 0xC5, 0x5D, 0xFD, 0xD6, 0x7B,
+    0x1E, 0xCF, 0xB9, 0x9D, 0x9E, 0xBC, 0x3C, 0x93, 0xAD, 0xF4, 0x03, 0x26, 0x18, 0x41, 0x39, 0x57,
+    0x0B, 0x54, 0xDF, 0xD3, 0x00, 0xEE, 0x46, 0x2C, 0x24, 0x69, 0xAA, 0x52, 0x92, 0xB9, 0x36, 0xEB,
+    0x68, 0x39, 0xE9, 0x51, 0x82, 0x59, 0xB4, 0x0D, 0xAD, 0x74, 0x33, 0x51, 0xB3, 0x2B, 0x4E, 0xE6,
+    0xCC, 0xB8, 0xAF, 0x05, 0xBC, 0x29, 0xD3, 0x46, 0x67, 0x76, 0xBB, 0x5D, 0x19, 0xDE, 0xF3, 0x78,
+    0x7E, 0x77, 0xB7, 0xDB, 0x3D, 0x14, 0x0F, 0x71, 0xE9, 0xD4, 0xBA, 0x0E, 0xE9, 0x22, 0xED, 0xE1,
+    0x19, 0x0D, 0x85, 0xA4, 0xAB, 0xA7, 0xF0, 0x04, 0x29, 0x7A, 0xB4, 0x87, 0xA6, 0xAA, 0x71, 0x37,
+    0x77, 0x5F, 0x50, 0x67, 0xD4, 0x6C, 0x60, 0x9F, 0x0D, 0xAD, 0xF1, 0x9F, 0xE9, 0x4D, 0x26, 0x75,
+    0x95, 0x96, 0x5E, 0xB1, 0x94, 0xBE, 0x2B, 0x8D, 0x27, 0x20, 0x8E, 0x4A, 0xD2, 0x62, 0x95, 0xEA,
+    0x29, 0x4A, 0x83, 0xDE, 0xDA, 0x5D, 0xF2, 0x55, 0x24, 0x0B, 0x79, 0xAA, 0x86, 0xB0, 0x50, 0x0E,
+    0x29, 0x55, 0xAC, 0xF7, 0xFB, 0xDA, 0x47, 0xA9, 0x66, 0x6F, 0x1D, 0x0E, 0x12, 0x2D, 0x25, 0x69,
+    0x86, 0xFD, 0xA6, 0x8C, 0xFB, 0x62, 0x03, 0x46, 0xFB, 0x4D, 0x2E, 0xF8, 0x7C, 0xA6, 0x86, 0x6A,
+    0x50, 0x87, 0xF5, 0x1A, 0x28, 0x42, 0x7F, 0xE0, 0x7D, 0x0F, 0xA4, 0xBB, 0xEF, 0x05, 0xC7, 0x9D,
+    0x6C, 0xEA, 0xF6, 0x0D, 0x49, 0x4F, 0xEE, 0x76, 0x17, 0x13, 0x5B, 0x28, 0xB7, 0x90, 0x5C, 0xE5,
+    0x93, 0x65, 0xDA, 0x0E, 0x49, 0x5F, 0x50, 0xCA, 0xC6, 0x30, 0x31, 0x09, 0xCC, 0x7D, 0x93, 0x7A,
+    0xDA, 0x62, 0x8B, 0x1D, 0xA8, 0x21, 0xD3, 0xA9, 0x26, 0x4B, 0x9A, 0x3A, 0x87, 0x26, 0x03, 0xEC,
+    0x36, 0x7D, 0xAF, 0x1D, 0xD2, 0xD5, 0x6B, 0x9F, 0xDA, 0x94, 0x4B, 0xBA, 0xBB, 0x59, 0x37, 0x29,
+    0xA1, 0xD3, 0x8D, 0xA6, 0x93, 0x46, 0x45, 0x48, 0x37, 0x38, 0x34, 0xEA, 0xBB, 0x74, 0xF5, 0x7A,
+    0x4A, 0x1D, 0xB2, 0x73, 0x6A, 0x94, 0x5D, 0xA4, 0xF0, 0xEC, 0xFF, 0xAC, 0xF1, 0x7F, 0x52, 0xBF,
+    0xFA, 0x83, 0xE0, 0xA4, 0x58, 0x48, 0x13, 0xED, 0x0A, 0xBD, 0x9A, 0x52, 0x9A, 0xDD, 0x3B, 0x8A,
+    0xD5, 0xB5, 0xEF, 0x85, 0x8F, 0x15, 0xFE, 0x5F, 0x1D, 0x3E, 0x93, 0x5D, 0x80, 0x87, 0x0F, 0xAE,
+    0x9E, 0x87, 0x42, 0x4B, 0x5F, 0x0F, 0xD5, 0x4B, 0xDE, 0xFC, 0x38, 0xE4, 0xC1, 0xFD, 0xED, 0x5A,
+    0x4A, 0x48, 0x1C, 0xDD, 0xE4, 0xEE, 0x47, 0xF5, 0x92, 0xEA, 0xD0, 0x4E, 0xE7, 0x92, 0x13, 0xBE,
+    0x3B, 0x94, 0xAD, 0x70, 0xC3, 0xA1, 0xB0, 0x58, 0x7B, 0xB2, 0x8E, 0x52, 0x15, 0xE1, 0xE1, 0xA4,
+    0x55, 0x77, 0x68, 0xD5, 0x43, 0x4A, 0xB4, 0x1D, 0x89, 0xB4, 0x2B, 0xD5, 0x50, 0xC8, 0xE7, 0x0B,
+    0x9F, 0x10, 0xAE, 0xC1, 0xCE, 0x85, 0x87, 0xBE, 0xEB, 0xA1, 0x08, 0x76, 0x04, 0x37, 0x04, 0x30,
+    0xB1, 0x1A, 0xA0, 0xFA, 0xC1, 0x02, 0xC8, 0x01, 0xF6, 0x6D, 0xBF, 0xD7, 0x88, 0x4C, 0x4A, 0x3D,
+    0x0C, 0x87, 0x65, 0x56, 0x9D, 0xDC, 0xE6, 0x4E, 0x32, 0x34, 0x16, 0x83, 0x62, 0xE9, 0xA5, 0x97,
+    0x16, 0xF7, 0x98, 0x7C, 0x35, 0x38, 0x5F, 0x4E, 0x66, 0xC9, 0x43, 0xAE, 0xA6, 0xBD, 0x57, 0xB3,
+    0x55, 0xD0, 0x63, 0x0A, 0xD6, 0xD7, 0x0B, 0x81, 0x0B, 0x1C, 0xC1, 0x9D, 0x64, 0x4D, 0xA6, 0xA1,
+    0x8C, 0x99, 0x82, 0xD5, 0x28, 0xBD, 0xAC, 0xD0, 0xDE, 0xA7, 0xA9, 0xAF, 0x07, 0x37, 0xD9, 0x97,
+    0xA6, 0xD2, 0x9B, 0x1F, 0x2F, 0x46, 0x84, 0xD6, 0x68, 0xEA, 0xAD, 0x6E, 0x4A, 0x8F, 0x69, 0xA9,
+    0x34, 0xD4, 0x4B, 0xA6, 0x81, 0x0B, 0x64, 0x5B, 0x89, 0xCE, 0x6A, 0xDA, 0xEB, 0xCD, 0x5B, 0x15,
+    0xB4, 0x8F, 0xF6, 0xE4, 0x09, 0x47, 0xBE, 0x74, 0xE0, 0x3D, 0xF3, 0x41, 0x29, 0xDC, 0xEA, 0x04,
+    0x16, 0xEB, 0x49, 0xED, 0xDB, 0x84, 0xF8, 0x4B, 0x74, 0xCA, 0xB6, 0x6D, 0x4A, 0xAE, 0x1B, 0x4E,
+    0x20, 0x82, 0xFD, 0x78, 0xE0, 0xE6, 0x5B, 0x5E, 0xB5, 0x3B, 0xB5, 0x4D, 0x82, 0xB8, 0x5A, 0x4E,
+    0x8A, 0x01, 0x27, 0xEE, 0x6F, 0x75, 0x30, 0x5F, 0x52, 0xFD, 0xA6, 0xA4, 0x92, 0x68, 0x79, 0xD8,
+    0x7D, 0xF7, 0xED, 0xA8, 0xF6, 0x83, 0x37, 0xBB, 0xE6, 0x33, 0xCD, 0xD3, 0xEE, 0xF9, 0xF5, 0x17,
+    0xFA, 0x7B, 0xAE, 0xD9, 0x6D, 0x24, 0x4C, 0x6E, 0x8A, 0x44, 0x91, 0x3A, 0x95, 0x51, 0x4A, 0xD8,
+    0xF7, 0x05, 0x70, 0x37, 0x3C, 0x20, 0x37, 0x42, 0xB9, 0xA4, 0x35, 0xAA, 0x86, 0x4C, 0xF9, 0x0A,
+    0x76, 0x31, 0x01, 0xDC, 0x60, 0x67, 0x72, 0x51, 0x79, 0xEC, 0x8C, 0x1B, 0x69, 0x07, 0xFA, 0xCE,
+    0xAC, 0x64, 0xC2, 0x7A, 0xCC, 0x4A, 0x3F, 0x50, 0x86, 0x04, 0x24, 0xA8, 0x3C, 0xD4, 0x5E, 0x1D,
+    0xB4, 0x2F, 0x46, 0x40, 0x5D, 0x3B, 0x80, 0x5D, 0xD4, 0x41, 0xFB, 0x82, 0x20, 0x57, 0x6A, 0x58,
+    0x06, 0x68, 0x87, 0xCA, 0x63, 0x56, 0xDC, 0x84, 0xF5, 0xB4, 0x03, 0xFD, 0x80, 0x1A, 0x13, 0xC9,
+    0x57, 0x2A, 0x4F, 0x11, 0x52, 0xFD, 0x42, 0x13, 0xA0, 0xF2, 0xF5, 0xB4, 0xF5, 0x8D, 0xFE, 0x6B,
+    0x01, 0x50, 0x3D, 0x81, 0x59, 0x75, 0x18, 0x89, 0x4D, 0x4C, 0x56, 0xA7, 0x6A, 0xCD, 0x9E, 0xA8,
+    0x22, 0xD9, 0x1F, 0x6E, 0x45, 0xC6, 0x9C, 0xB6, 0x44, 0xDC, 0x7A, 0xFD, 0xB7, 0x9A, 0xD4, 0xD1,
+    0xBF, 0x18, 0x40, 0x97, 0x26, 0xF2, 0xD8, 0x37, 0x14, 0xB7, 0x22, 0x54, 0x6F, 0xCC, 0xD0, 0x3E,
+    0x3B, 0x92, 0xAD, 0xBF, 0x14, 0xA7, 0xDA, 0x8E, 0xF2, 0x2D, 0x81, 0x7B, 0x75, 0x25, 0x57, 0xA9,
+    0x27, 0xFB, 0xC5, 0x2A, 0x55, 0x00, 0x0F, 0x14, 0x52, 0x03, 0xBF, 0xD7, 0x00, 0xF9, 0x7F, 0x04,
+    0x5A, 0x75, 0xE9, 0x1B, 0x36, 0xDC, 0x3B, 0x81, 0x5C, 0xC5, 0x88, 0x0D, 0x77, 0xB0, 0x15, 0xA2,
+    0x1E, 0x36, 0xBD, 0x25, 0x15, 0x55, 0xF8, 0xC8, 0x4F, 0x75, 0xDC, 0x51, 0x44, 0x08, 0xB5, 0xA7,
+    0x5C, 0xD5, 0x51, 0x2B, 0x6C, 0x46, 0xDD, 0xDD, 0x4F, 0x9D, 0xC6, 0x71, 0x76, 0x87, 0x74, 0xEA,
+    0xEA, 0x44, 0x77, 0x48, 0xAE, 0x83, 0x9F, 0xEB, 0xF5, 0x47, 0x90, 0xFD, 0x45, 0xB9, 0xEE, 0x53,
+    0x59, 0xE4, 0xE5, 0x31, 0x7A, 0x41, 0x0D, 0xC5, 0x9A, 0x5D, 0xD8, 0x7F, 0xD7, 0x42, 0x92, 0x3B,
+    0xBA, 0x4F, 0x03, 0xA5, 0x6C, 0x32, 0x2A, 0x16, 0xE8, 0xBD, 0xEB, 0x36, 0x06, 0xFE, 0x73, 0xBD,
+    0x9E, 0x3E, 0xA5, 0x08, 0xCE, 0x07, 0xE1, 0x9E, 0xD8, 0x4E, 0xFA, 0x36, 0x80, 0xFE, 0x01, 0xB9,
+    0xD0, 0x7B, 0xDD, 0x36, 0x9E, 0x4F, 0x15, 0x6B, 0x1D, 0xF4, 0xA6, 0x1E, 0x3D, 0xF8, 0x7D, 0x3F,
+    0xBA, 0x4E, 0x7D, 0x48, 0x3A, 0x7C, 0x40, 0xC4, 0xED, 0xE1, 0x86, 0xBB, 0x8C, 0x16, 0x1E, 0xB1,
+    0xD2, 0x9F, 0xAD, 0xF5, 0x8F, 0xA4, 0x50, 0x37, 0x95, 0xFC, 0x59, 0xB2, 0xE7, 0x4E, 0x0D, 0xE5,
+    0xDC, 0x6E, 0xB7, 0xBB, 0x58, 0x6B, 0x33, 0x70, 0x63, 0xA5, 0xDB, 0x10, 0xAE, 0x67, 0xDE, 0xE7,
+    0xBF, 0xD9, 0x53, 0xDC, 0x65, 0x34, 0xDA, 0x6B, 0x5A, 0xCB, 0x37, 0x25, 0x85, 0xDE, 0x28, 0xDA,
+    0xA6, 0x8A, 0x34, 0x5C, 0xA4, 0x9C, 0xF8, 0x03, 0xAB, 0xCE, 0x59, 0xC5, 0xFA, 0xC5, 0x55, 0xFA,
+    0xF1, 0x52, 0xCA, 0xFF, 0xD6, 0xC6, 0x90, 0xD3, 0xEB, 0x3A, 0x1C, 0x5D, 0x93, 0x24, 0x2B, 0x29,
+    0xA4, 0x9C, 0x9B, 0x33, 0x17, 0x4F, 0x53, 0xE0, 0xE1, 0xE3, 0xA7, 0xE8, 0x53, 0x89, 0x05, 0xC9,
+    0xDE, 0xDA, 0xFD, 0x71, 0xF8, 0x75, 0xE0, 0xD7, 0xE1, 0x57, 0x80, 0x47, 0xC0, 0xF8, 0xCF, 0x1C,
+    0xF7, 0xFF, 0xB8, 0xB9, 0xEF, 0x5E, 0x3F, 0xD6, 0x71, 0x63, 0x3C, 0xD4, 0x5D, 0x7E, 0xBC, 0x1E,
+    0x7F, 0x33, 0xF9, 0x28, 0xD7, 0x67, 0x6E, 0x1D, 0x3F, 0x55, 0x77, 0x09, 0x0E, 0x7D, 0x01, 0x76,
+    0xBB, 0xDD, 0xEE, 0xBF, 0x3D, 0xC0, 0x5E, 0x7F, 0xFF, 0x34, 0x20, 0x8C, 0x33, 0x7B, 0x30, 0x5B,
+    0xEC, 0xF7, 0x0A, 0xF1, 0x78, 0x1B, 0x81, 0x4E, 0x3E, 0x78, 0x69, 0xA3, 0x4F, 0x03, 0x55, 0x47,
+    0x29, 0x72, 0xCD, 0xF4, 0x37, 0xA9, 0x57, 0x4A, 0x75, 0x38, 0x9F, 0xDC, 0x38, 0xED, 0x9A, 0x4A,
+    0xA2, 0x14, 0x9A, 0x52, 0x61, 0xB1, 0x76, 0x60, 0x03, 0x45, 0xA5, 0x14, 0xE9, 0x1B, 0x5B, 0x2F,
+    0xB7, 0x80, 0x7C, 0xB1, 0xA4, 0xAA, 0xC0, 0xB7, 0x7F, 0x26, 0x42, 0xBD, 0x90, 0x6B, 0xCC, 0xFA,
+    0x85, 0x36, 0x52, 0xA9, 0xC9, 0x35, 0x62, 0xE6, 0xBD, 0xA4, 0x3C, 0xE0, 0xD9, 0x36, 0x9C, 0xF7,
+    0x92, 0x7A, 0x76, 0x01, 0xAA, 0x8E, 0x6A, 0xA0, 0x10, 0x85, 0x9A, 0x4C, 0x73, 0xA6, 0x85, 0x36,
+    0x6E, 0xD7, 0xA8, 0xD4, 0x14, 0xBA, 0x52, 0x1C, 0xEA, 0x6D, 0xD2, 0x2F, 0xFB, 0x4E, 0x6F, 0xFD,
+    0xDE, 0xBA, 0xB1, 0xF5, 0x24, 0xD3, 0x0C, 0xFD, 0x40, 0x3B, 0xC0, 0x67, 0xE1, 0xD3, 0x27, 0xB5,
+    0x60, 0xEE, 0x48, 0x58, 0x81, 0xC8, 0xBE, 0x1C, 0x55, 0xA9, 0x31, 0xC1, 0x6E, 0xE7, 0xFD, 0x08,
+    0xDA, 0x08, 0x95, 0x9A, 0x7B, 0xD4, 0x50, 0xAC, 0x14, 0xDA, 0xDF, 0xAD, 0x16, 0xB5, 0x9A, 0x52,
+    0x63, 0xA9, 0x31, 0xD7, 0x9C, 0x6B, 0xDE, 0xB7, 0x56, 0x83, 0x1A, 0xF2, 0x91, 0x7C, 0x3A, 0x95,
+    0xF4, 0xF1, 0xE1, 0xEC, 0x9A, 0x93, 0xCA, 0xC7, 0xA9, 0x92, 0x4E, 0x2A, 0xF6, 0x93, 0xCC, 0xC4,
+    0x13, 0xDE, 0x94, 0x7D, 0x18, 0xBB, 0x06, 0xE0, 0xDC, 0xED, 0x06, 0xF9, 0xC6, 0xEB, 0x4C, 0x80,
+    0xA3, 0x3E, 0xA5, 0x4C, 0x9F, 0x38, 0x0B, 0x24, 0xCD, 0x2E, 0xD2, 0x37, 0xB9, 0x3A, 0x13, 0xB0,
+    0x81, 0x6A, 0xC2, 0x8D, 0x88, 0x4C, 0x98, 0x40, 0x11, 0xB6, 0x58, 0xA4, 0xA0, 0x1D, 0x8B, 0x00,
+    0xEA, 0xEA, 0x91, 0x7C, 0xFB, 0x1E, 0xA1, 0xAF, 0x2D, 0x50, 0x4A, 0xB7, 0x8E, 0x9F, 0x2A, 0x4F,
+    0xCC, 0xC9, 0x26, 0x4B, 0x95, 0x75, 0x75, 0xF2, 0x6D, 0x1B, 0xC9, 0x20, 0x3F, 0x75, 0x02, 0x3E,
+    0xD3, 0xEC, 0xEB, 0x9B, 0x6F, 0xBD, 0x6C, 0x53, 0xA1, 0x42, 0x32, 0x49, 0x33, 0x85, 0xA4, 0x95,
+    0xEA, 0xD0, 0x57, 0x35, 0xD0, 0x7F, 0x53, 0x60, 0x42, 0xB9, 0x42, 0x35, 0xD9, 0x00, 0x7D, 0x53,
+    0x79, 0x4C, 0xC0, 0x8D, 0x54, 0x53, 0x7A, 0x04, 0x26, 0x45, 0x43, 0x67, 0xAA, 0x09, 0x0D, 0x88,
+    0x62, 0xC5, 0x04, 0x7A, 0xFF, 0x70, 0x7F, 0xAB, 0x4F, 0x76, 0xFF, 0x72, 0x62, 0x90, 0x5F, 0xD9,
+    0x7A, 0x99, 0xBC, 0xAD, 0x1B, 0xDD, 0x61, 0x6F, 0x39, 0x73, 0xD4, 0xEF, 0x6B, 0xD2, 0xB5, 0xFB,
+    0x02, 0xEF, 0x72, 0x71, 0xAF, 0x92, 0x95, 0x87, 0xF2, 0xB3, 0xA4, 0x70, 0xCF, 0xB4, 0xE7, 0xCA,
+    0xE9, 0x59, 0xB9, 0x54, 0x48, 0x73, 0x3D, 0x3E, 0xBE, 0xDA, 0xA6, 0xD2, 0x25, 0x92, 0x52, 0x5E,
+    0xE0, 0xC9, 0xD3, 0x92, 0xA4, 0x54, 0x88, 0xF3, 0x65, 0x29, 0x05, 0x61, 0x15, 0x24, 0x3D, 0x95,
+    0xCA, 0xD0, 0x5A, 0x49, 0xBA, 0x6F, 0x6F, 0x63, 0x55, 0x3A, 0xE8, 0x8C, 0x76, 0x39, 0xDC, 0x7C,
+    0xFF, 0xDD, 0x38, 0xDB, 0xC9, 0x32, 0x02, 0xA5, 0x3E, 0x73, 0x7C, 0x2C, 0x3D, 0x78, 0xF8, 0x38,
+    0x7B, 0xE3, 0xFB, 0xD4, 0x7A, 0x56, 0x78, 0xD7, 0xDD, 0x0F, 0xFC, 0xEE, 0xB2, 0xAE, 0x27, 0x2B,
+    0xB9, 0x23, 0xD3, 0x37, 0xFF, 0x2E, 0x92, 0xAD, 0xC6, 0xD7, 0x23, 0x91, 0x90, 0x05, 0x22, 0x8E,
+    0x6A, 0xF8, 0x2A, 0x76, 0xC8, 0xE7, 0x1A, 0xE3, 0xF9, 0xBC, 0xED, 0x08, 0xD8, 0x6B, 0x13, 0x8E,
+    0xFC, 0xCD, 0xF5, 0xF8, 0xD9, 0xD7, 0x8F, 0x93, 0xAA, 0x9C, 0x74, 0x65, 0xBD, 0x3A, 0xE2, 0xC8,
+    0xFC, 0x82, 0x1D, 0xF8, 0x96, 0xC3, 0x78, 0x5C, 0x31, 0x12, 0xA8, 0x9A, 0x80, 0xC3, 0x0E, 0xD5,
+    0x60, 0x07, 0x3B, 0xE6, 0xC1, 0x78, 0x3B, 0x51, 0x5F, 0x0F, 0x97, 0x27, 0xB2, 0xB4, 0x54, 0xCA,
+    0xAD, 0x1A, 0xEC, 0x37, 0x4E, 0x75, 0xFD, 0xB6, 0xCE, 0x5D, 0xB9, 0x27, 0x92, 0x45, 0xA8, 0x46,
+    0x02, 0x10, 0x88, 0x40, 0x35, 0x7C, 0x15, 0xC8, 0xE7, 0x1A, 0xE0, 0xF3, 0xA9, 0x2E, 0xD8, 0xB5,
+    0x09, 0xC8, 0xDF, 0x5C, 0x8F, 0x8F, 0x8F, 0xDF, 0xD3, 0x39, 0xC8, 0xFC, 0x02, 0xF0, 0x2D, 0x07,
+    0xE0, 0x8A, 0x11, 0xA8, 0x9A, 0x00, 0xD8, 0xA1, 0x1A, 0xC0, 0x8E, 0x79, 0x00, 0x3B, 0x51, 0x5F,
+    0xE7, 0xE7, 0xED, 0xDC, 0x0A, 0xD5, 0x88, 0xA0, 0x08, 0xC8, 0x53, 0x68, 0xF8, 0x6A, 0x4F, 0xF1,
+    0xD3, 0xB9, 0x2E, 0x7D, 0x31, 0x7F, 0xDE, 0x0E, 0x7D, 0x31, 0xDB, 0x6B, 0x53, 0xF9, 0xF6, 0x9C,
+    0xBF, 0x39, 0xD3, 0xCF, 0x3C, 0xF2, 0x08, 0xE5, 0x42, 0x75, 0xA9, 0x29, 0x44, 0xF1, 0xEA, 0x58,
+    0xC8, 0x67, 0x7E, 0x29, 0xE6, 0x9E, 0x6F, 0xB9, 0x62, 0x2E, 0xBD, 0x2B, 0x5E, 0x9B, 0xE9, 0xAB,
+    0x26, 0x55, 0xD7, 0xA8, 0x66, 0xE8, 0xFF, 0x19, 0x9D, 0x4B, 0x94, 0x4B, 0x06, 0x76, 0x84, 0x42,
+    0xC3, 0x57, 0xA1, 0xF8, 0xE9, 0x5C, 0x43, 0x31, 0x7F, 0xDE, 0x0E, 0x14, 0xB3, 0xBD, 0x36, 0x51,
+    0xCC, 0xF9, 0x9B, 0x33, 0xC5, 0xCC, 0x23, 0x8F, 0x50, 0xCC, 0x54, 0x97, 0x9A, 0x62, 0xA6, 0x78,
+    0x75, 0x2C, 0x66, 0x32, 0xBF, 0x14, 0x33, 0x7C, 0xCB, 0x15, 0x33, 0xB8, 0xE2, 0xB5, 0x19, 0xAA,
+    0x46, 0x33, 0xD8, 0xA1, 0x9A, 0x3F, 0x14, 0xE5, 0xB2, 0xB8, 0x0F, 0xF1, 0xD4, 0xD3, 0xC6, 0xAE,
+    0xF2, 0xF5, 0xA3, 0x38, 0xF5, 0x3E, 0xA8, 0xEE, 0xE1, 0x94, 0x75, 0x7D, 0xF6, 0x0A, 0x9F, 0x69,
+    0x78, 0xDA, 0x06, 0xDC, 0x96, 0x20, 0x1E, 0x69, 0xDF, 0xD2, 0x58, 0xA8, 0xA9, 0xA2, 0xF3, 0x68,
+    0x30, 0xCA, 0x2E, 0x70, 0xA6, 0x49, 0x2C, 0xF5, 0x02, 0x97, 0xAF, 0x42, 0xA5, 0xEF, 0xEF, 0x93,
+    0xBF, 0xB6, 0xE2, 0xCC, 0x37, 0x22, 0x6E, 0x2E, 0x34, 0xB4, 0x54, 0x33, 0xED, 0x58, 0x60, 0x03,
+    0xB5, 0x07, 0x23, 0xD2, 0xD7, 0x29, 0x0D, 0x46, 0xFB, 0xEF, 0xA6, 0xF1, 0x85, 0x24, 0x29, 0xA4,
+    0x4A, 0xED, 0xEB, 0xFE, 0x9F, 0xB4, 0x29, 0xBA, 0x5D, 0x05, 0x5C, 0x2A, 0x79, 0x71, 0xEA, 0x93,
+    0x3F, 0xCF, 0x3F, 0x2B, 0x75, 0xB5, 0xAE, 0x50, 0x6B, 0x71, 0x8A, 0x58, 0xAD, 0xA9, 0x40, 0x05,
+    0x47, 0xEB, 0x15, 0xC8, 0xF7, 0x5F, 0x0C, 0xE3, 0x31, 0xBA, 0xA1, 0x11, 0x37, 0x1B, 0x91, 0xA9,
+    0x31, 0x0B, 0x36, 0x90, 0x1D, 0x04, 0xCD, 0xC0, 0x8E, 0x7E, 0xAB, 0x6F, 0x20, 0xF9, 0x54, 0xD5,
+    0x2A, 0xDD, 0x30, 0xDD, 0x3D, 0xDD, 0xAD, 0xF5, 0x7C, 0xF8, 0xD3, 0x99, 0x96, 0x5C, 0xD7, 0x6B,
+    0x2D, 0x4E, 0x8B, 0xB6, 0x8A, 0xFB, 0x47, 0xEB, 0x0E, 0xF2, 0x84, 0x59, 0xD8, 0xF7, 0x6A, 0xA0,
+    0x9E, 0x8D, 0x40, 0x9D, 0x0D, 0x94, 0x01, 0xE7, 0x71, 0x27, 0x17, 0xEC, 0x15, 0x6C, 0x28, 0x24,
+    0xEF, 0x7C, 0x2D, 0x75, 0xBF, 0x90, 0x5E, 0x71, 0x81, 0xBB, 0x6F, 0x35, 0x50, 0x68, 0xA9, 0x4F,
+    0xBE, 0x5E, 0x28, 0x24, 0x56, 0xFD, 0x86, 0x26, 0xDC, 0x5C, 0x68, 0x2C, 0xE3, 0xF6, 0xCD, 0x44,
+    0xF5, 0x80, 0x86, 0x5C, 0x0D, 0x17, 0x48, 0x33, 0x69, 0xFF, 0x6C, 0xB2, 0x8B, 0x5B, 0x3D, 0xFE,
+    0x24, 0xAD, 0x95, 0x0A, 0x3F, 0xA5, 0x13, 0xA9, 0x85, 0x8D, 0x5B, 0xE7, 0x3E, 0xE2, 0x13, 0xED,
+    0x9A, 0xF5, 0x37, 0x33, 0x2D, 0xB5, 0x96, 0x56, 0xBE, 0xD7, 0x4F, 0xA4, 0x27, 0x24, 0xAB, 0x15,
+    0xB8, 0xC0, 0x3D, 0xB7, 0x2E, 0xEE, 0x07, 0x37, 0x9E, 0x7C, 0x77, 0x52, 0x1A, 0xDC, 0x88, 0x9B,
+    0x0B, 0x4D, 0x36, 0x52, 0x44, 0x6C, 0x40, 0x23, 0x1A, 0x32, 0x35, 0x36, 0x6E, 0xB3, 0xFA, 0xE4,
+    0x2E, 0x69, 0x70, 0xE3, 0x36, 0xB8, 0x68, 0xB7, 0xC1, 0x0D, 0xFF, 0x19, 0x07, 0x77, 0x79, 0x3A,
+    0x29, 0xE4, 0x97, 0x46, 0x9B, 0xEB, 0xF2, 0x04, 0xB8, 0xE1, 0x4F, 0xEE, 0x4E, 0x30, 0x12, 0x0F,
+    0x1A, 0x72, 0xB1, 0x3D, 0xAB, 0x74, 0xD5, 0x34, 0x94, 0xE4, 0x59, 0xD6, 0x4B, 0xC9, 0x93, 0xB2,
+    0xAD, 0xAF, 0xEA, 0x54, 0xB3, 0x7F, 0xC2, 0x9B, 0xBF, 0xBD, 0xDA, 0xEA, 0x8A, 0xD3, 0x5A, 0x4B,
+    0x59, 0x82, 0x6F, 0x95, 0x49, 0x0A, 0x27, 0xD3, 0xE1, 0xF2, 0x3F, 0x6C, 0x98, 0x9B, 0x65, 0xD3,
+    0x89, 0x93, 0x03, 0xFB, 0xA1, 0xA4, 0x3E, 0x34, 0xD5, 0x96, 0x8B, 0xA6, 0x01, 0xF8, 0x7C, 0x12,
+    0xEC, 0xC6, 0xD3, 0x8F, 0x70, 0x77, 0xDF, 0x94, 0x2B, 0xD4, 0x5A, 0x0B, 0x69, 0x29, 0x25, 0x2F,
+    0xE9, 0x51, 0x21, 0x2B, 0x79, 0x37, 0x15, 0xBE, 0x8C, 0x18, 0xF1, 0xAF, 0xE9, 0x47, 0x5C, 0x84,
+    0x32, 0x92, 0x6B, 0x85, 0x7E, 0xC4, 0x6A, 0x4D, 0x80, 0x51, 0x85, 0x54, 0x99, 0x4C, 0x3E, 0x7D,
+    0x2D, 0xA6, 0xE8, 0x47, 0x3E, 0x4B, 0x3B, 0x97, 0x91, 0xC2, 0x67, 0x6A, 0xFA, 0x89, 0xB6, 0xA9,
+    0x7C, 0xA9, 0x3F, 0x7B, 0x51, 0x0F, 0xAD, 0xB4, 0x0A, 0x2E, 0x55, 0xD4, 0x7C, 0x41, 0x1A, 0xA9,
+    0xE4, 0xD9, 0x35, 0x70, 0xEE, 0xB6, 0xB2, 0x31, 0xFF, 0xC5, 0xB6, 0xDF, 0x7F, 0xBF, 0xC4, 0xB6,
+    0xDF, 0xA7, 0x3E, 0xDD, 0x48, 0x7B, 0x9F, 0x6D, 0xA5, 0x4D, 0x53, 0xE2, 0x67, 0x48, 0x7B, 0x7B,
+    0xF3, 0xB9, 0x26, 0x24, 0x9D, 0xE8, 0xD1, 0x90, 0x6C, 0x84, 0xFB, 0xD2, 0xBA, 0x5B, 0x6D, 0xAA,
+    0xFF, 0x1F, 0xEA, 0x90, 0x42, 0x2D, 0x0A, 0x56, 0xD2, 0x75, 0xA3, 0xD0, 0x2A, 0x55, 0x24, 0x6A,
+    0x53, 0xA6, 0x69, 0xD3, 0x6A, 0xA1, 0xD5, 0x4C, 0xAB, 0xA9, 0x96, 0x1A, 0x5A, 0xBD, 0xA0, 0x54,
+    0x63, 0x33, 0xB9, 0x29, 0xDA, 0xB5, 0x3D, 0xD4, 0x7A, 0x6A, 0x80, 0x76, 0x6E, 0xE7, 0xAD, 0x1C,
+    0x56, 0x03, 0xF0, 0xD5, 0x0D, 0x80, 0xFF, 0x48, 0xBD, 0x45, 0x72, 0x0E, 0x78, 0xFC, 0xB4, 0xFF,
+    0xF2, 0xA9, 0xC1, 0xFE, 0x3F,
 };
 
 static const EpdGlyph bookerly_16_boldGlyphs[] = {
@@ -2125,7 +2220,7 @@ static const EpdGlyph bookerly_16_boldGlyphs[] = {
     { 5, 30, 10, 3, 26, 38, 9655 }, // |
     { 12, 33, 13, 0, 27, 99, 9693 }, // }
     { 17, 8, 21, 2, 15, 34, 9792 }, // ~
-    { 0, 0, 7, 0, 0, 0, 0 }, //  
+    { 0, 0, 7, 0, 0, 0, 9826 }, //  
     { 7, 26, 10, 1, 18, 46, 0 }, // ¡
     { 18, 33, 21, 1, 26, 149, 46 }, // ¢
     { 20, 24, 21, 0, 23, 120, 195 }, // £
@@ -2136,642 +2231,649 @@ static const EpdGlyph bookerly_16_boldGlyphs[] = {
     { 13, 6, 22, 5, 26, 20, 660 }, // ¨
     { 25, 25, 26, 0, 24, 157, 680 }, // ©
     { 13, 17, 15, 1, 24, 56, 837 }, // ª
-    { 18, 13, 19, 1, 15, 59, 893 }, // «
-    { 15, 9, 21, 3, 16, 34, 952 }, // ¬
-    { 11, 5, 13, 1, 11, 14, 986 }, // ­
-    { 19, 18, 19, 0, 26, 86, 1000 }, // ®
-    { 12, 4, 22, 5, 24, 12, 1086 }, // ¯
-    { 13, 12, 17, 2, 23, 39, 1098 }, // °
-    { 15, 21, 21, 3, 20, 79, 1137 }, // ±
-    { 13, 16, 15, 1, 28, 52, 1216 }, // ²
-    { 12, 17, 15, 1, 28, 51, 1268 }, // ³
-    { 7, 9, 22, 8, 28, 16, 1319 }, // ´
-    { 22, 26, 22, 1, 18, 143, 1335 }, // µ
-    { 19, 28, 20, 0, 23, 133, 1478 }, // ¶
-    { 7, 6, 10, 1, 12, 11, 1611 }, // ·
-    { 7, 8, 22, 8, -1, 14, 1622 }, // ¸
-    { 11, 16, 15, 2, 28, 44, 1636 }, // ¹
-    { 13, 17, 15, 1, 24, 56, 1680 }, // º
-    { 18, 13, 19, 1, 15, 59, 1736 }, // »
-    { 33, 28, 36, 2, 25, 231, 1795 }, // ¼
-    { 33, 28, 36, 2, 25, 231, 2026 }, // ½
-    { 34, 28, 36, 1, 25, 238, 2257 }, // ¾
-    { 14, 25, 16, 1, 18, 88, 2495 }, // ¿
-    { 26, 32, 25, 0, 32, 208, 2583 }, // À
-    { 26, 32, 25, 0, 32, 208, 2791 }, // Á
-    { 26, 32, 25, 0, 32, 208, 2999 }, // Â
-    { 26, 32, 25, 0, 32, 208, 3207 }, // Ã
-    { 26, 31, 25, 0, 31, 202, 3415 }, // Ä
-    { 26, 33, 25, 0, 33, 215, 3617 }, // Å
-    { 33, 23, 32, -1, 23, 190, 3832 }, // Æ
-    { 20, 33, 22, 1, 24, 165, 4022 }, // Ç
-    { 20, 32, 21, 1, 32, 160, 4187 }, // È
-    { 20, 32, 21, 1, 32, 160, 4347 }, // É
-    { 20, 32, 21, 1, 32, 160, 4507 }, // Ê
-    { 20, 31, 21, 1, 31, 155, 4667 }, // Ë
-    { 12, 32, 14, 1, 32, 96, 4822 }, // Ì
-    { 12, 32, 14, 1, 32, 96, 4918 }, // Í
-    { 13, 32, 14, 0, 32, 104, 5014 }, // Î
-    { 14, 31, 14, 0, 31, 109, 5118 }, // Ï
-    { 25, 25, 26, 0, 24, 157, 5227 }, // Ð
-    { 27, 33, 27, 0, 32, 223, 5384 }, // Ñ
-    { 24, 33, 26, 1, 32, 198, 5607 }, // Ò
-    { 24, 33, 26, 1, 32, 198, 5805 }, // Ó
-    { 24, 33, 26, 1, 32, 198, 6003 }, // Ô
-    { 24, 33, 26, 1, 32, 198, 6201 }, // Õ
-    { 24, 32, 26, 1, 31, 192, 6399 }, // Ö
-    { 15, 15, 21, 3, 19, 57, 6591 }, // ×
-    { 26, 25, 26, 0, 24, 163, 6648 }, // Ø
-    { 26, 33, 27, 0, 32, 215, 6811 }, // Ù
-    { 26, 33, 27, 0, 32, 215, 7026 }, // Ú
-    { 26, 33, 27, 0, 32, 215, 7241 }, // Û
-    { 26, 32, 27, 0, 31, 208, 7456 }, // Ü
-    { 24, 32, 24, 0, 32, 192, 7664 }, // Ý
-    { 20, 23, 21, 1, 23, 115, 7856 }, // Þ
-    { 21, 27, 22, 0, 26, 142, 7971 }, // ß
-    { 18, 29, 19, 1, 28, 131, 8113 }, // à
-    { 18, 29, 19, 1, 28, 131, 8244 }, // á
-    { 18, 28, 19, 1, 27, 126, 8375 }, // â
-    { 18, 27, 19, 1, 26, 122, 8501 }, // ã
-    { 18, 27, 19, 1, 26, 122, 8623 }, // ä
-    { 18, 29, 19, 1, 28, 131, 8745 }, // å
-    { 26, 19, 27, 1, 18, 124, 8876 }, // æ
-    { 15, 27, 17, 1, 18, 102, 9000 }, // ç
-    { 16, 29, 18, 1, 28, 116, 9102 }, // è
-    { 16, 29, 18, 1, 28, 116, 9218 }, // é
-    { 16, 28, 18, 1, 27, 112, 9334 }, // ê
-    { 16, 27, 18, 1, 26, 108, 9446 }, // ë
-    { 12, 28, 12, 0, 28, 84, 9554 }, // ì
-    { 12, 28, 12, 0, 28, 84, 9638 }, // í
-    { 12, 27, 12, 0, 27, 81, 9722 }, // î
-    { 12, 26, 12, 0, 26, 78, 9803 }, // ï
-    { 18, 28, 20, 1, 27, 126, 9881 }, // ð
-    { 22, 26, 22, 0, 26, 143, 10007 }, // ñ
-    { 18, 29, 20, 1, 28, 131, 10150 }, // ò
-    { 18, 29, 20, 1, 28, 131, 10281 }, // ó
-    { 18, 28, 20, 1, 27, 126, 10412 }, // ô
-    { 18, 27, 20, 1, 26, 122, 10538 }, // õ
-    { 18, 27, 20, 1, 26, 122, 10660 }, // ö
-    { 15, 16, 21, 3, 19, 60, 10782 }, // ÷
-    { 20, 19, 20, 0, 18, 95, 10842 }, // ø
-    { 22, 29, 22, 0, 28, 160, 10937 }, // ù
-    { 22, 29, 22, 0, 28, 160, 11097 }, // ú
-    { 22, 28, 22, 0, 27, 154, 11257 }, // û
-    { 22, 27, 22, 0, 26, 149, 11411 }, // ü
-    { 22, 36, 21, 0, 28, 198, 11560 }, // ý
-    { 20, 34, 21, 0, 26, 170, 11758 }, // þ
-    { 22, 34, 21, 0, 26, 187, 11928 }, // ÿ
-    { 26, 30, 25, 0, 30, 195, 0 }, // Ā
-    { 18, 25, 19, 1, 24, 113, 195 }, // ā
-    { 26, 32, 25, 0, 32, 208, 308 }, // Ă
-    { 18, 27, 19, 1, 26, 122, 516 }, // ă
-    { 26, 32, 25, 0, 24, 208, 638 }, // Ą
-    { 18, 26, 19, 1, 18, 117, 846 }, // ą
-    { 20, 33, 22, 1, 32, 165, 963 }, // Ć
-    { 15, 29, 17, 1, 28, 109, 1128 }, // ć
-    { 20, 33, 22, 1, 32, 165, 1237 }, // Ĉ
-    { 15, 28, 17, 1, 27, 105, 1402 }, // ĉ
-    { 20, 33, 22, 1, 32, 165, 1507 }, // Ċ
-    { 15, 27, 17, 1, 26, 102, 1672 }, // ċ
-    { 20, 33, 22, 1, 32, 165, 1774 }, // Č
-    { 15, 29, 17, 1, 28, 109, 1939 }, // č
-    { 24, 33, 26, 1, 32, 198, 2048 }, // Ď
-    { 23, 27, 21, 1, 26, 156, 2246 }, // ď
-    { 25, 25, 26, 0, 24, 157, 2402 }, // Đ
-    { 20, 27, 21, 1, 26, 135, 2559 }, // đ
-    { 20, 30, 21, 1, 30, 150, 2694 }, // Ē
-    { 16, 25, 18, 1, 24, 100, 2844 }, // ē
-    { 20, 32, 21, 1, 32, 160, 2944 }, // Ĕ
-    { 16, 27, 18, 1, 26, 108, 3104 }, // ĕ
-    { 20, 32, 21, 1, 32, 160, 3212 }, // Ė
-    { 16, 27, 18, 1, 26, 108, 3372 }, // ė
-    { 20, 31, 21, 1, 23, 155, 3480 }, // Ę
-    { 16, 26, 18, 1, 18, 104, 3635 }, // ę
-    { 20, 32, 21, 1, 32, 160, 3739 }, // Ě
-    { 16, 29, 18, 1, 28, 116, 3899 }, // ě
-    { 23, 33, 24, 1, 32, 190, 4015 }, // Ĝ
-    { 20, 35, 20, 0, 27, 175, 4205 }, // ĝ
-    { 23, 33, 24, 1, 32, 190, 4380 }, // Ğ
-    { 20, 34, 20, 0, 26, 170, 4570 }, // ğ
-    { 23, 33, 24, 1, 32, 190, 4740 }, // Ġ
-    { 20, 34, 20, 0, 26, 170, 4930 }, // ġ
-    { 23, 33, 24, 1, 24, 190, 5100 }, // Ģ
-    { 20, 37, 20, 0, 29, 185, 5290 }, // ģ
-    { 27, 32, 28, 1, 32, 216, 5475 }, // Ĥ
-    { 23, 34, 22, -1, 34, 196, 5691 }, // ĥ
-    { 28, 23, 28, 0, 23, 161, 5887 }, // Ħ
-    { 22, 26, 22, 0, 26, 143, 6048 }, // ħ
-    { 12, 32, 14, 1, 32, 96, 6191 }, // Ĩ
-    { 12, 26, 12, 0, 26, 78, 6287 }, // ĩ
-    { 12, 30, 14, 1, 30, 90, 6365 }, // Ī
-    { 12, 24, 12, 0, 24, 72, 6455 }, // ī
-    { 12, 32, 14, 1, 32, 96, 6527 }, // Ĭ
-    { 12, 26, 12, 0, 26, 78, 6623 }, // ĭ
-    { 12, 31, 14, 1, 23, 93, 6701 }, // Į
-    { 12, 34, 12, 0, 26, 102, 6794 }, // į
-    { 12, 32, 14, 1, 32, 96, 6896 }, // İ
-    { 12, 18, 12, 0, 18, 54, 6992 }, // ı
-    { 26, 30, 27, 1, 23, 195, 7046 }, // Ĳ
-    { 21, 34, 22, 0, 26, 179, 7241 }, // ĳ
-    { 15, 39, 13, -2, 32, 147, 7420 }, // Ĵ
-    { 15, 35, 10, -3, 27, 132, 7567 }, // ĵ
-    { 24, 32, 25, 1, 23, 192, 7699 }, // Ķ
-    { 21, 35, 21, 0, 26, 184, 7891 }, // ķ
-    { 22, 19, 21, 0, 18, 105, 8075 }, // ĸ
-    { 20, 32, 21, 1, 32, 160, 8180 }, // Ĺ
-    { 11, 34, 12, 0, 34, 94, 8340 }, // ĺ
-    { 20, 32, 21, 1, 23, 160, 8434 }, // Ļ
-    { 11, 35, 12, 0, 26, 97, 8594 }, // ļ
-    { 20, 26, 21, 1, 26, 130, 8691 }, // Ľ
-    { 15, 26, 12, 0, 26, 98, 8821 }, // ľ
-    { 20, 23, 21, 1, 23, 115, 8919 }, // Ŀ
-    { 18, 26, 18, 0, 26, 117, 9034 }, // ŀ
-    { 22, 23, 21, -1, 23, 127, 9151 }, // Ł
-    { 13, 26, 12, -1, 26, 85, 9278 }, // ł
-    { 27, 33, 27, 0, 32, 223, 9363 }, // Ń
-    { 22, 28, 22, 0, 28, 154, 9586 }, // ń
-    { 27, 32, 27, 0, 23, 216, 9740 }, // Ņ
-    { 22, 27, 22, 0, 18, 149, 9956 }, // ņ
-    { 27, 33, 27, 0, 32, 223, 10105 }, // Ň
-    { 22, 28, 22, 0, 28, 154, 10328 }, // ň
-    { 30, 24, 30, 0, 24, 180, 10482 }, // ŉ
-    { 27, 30, 27, 0, 23, 203, 10662 }, // Ŋ
-    { 20, 26, 22, 0, 18, 130, 10865 }, // ŋ
-    { 24, 31, 26, 1, 30, 186, 10995 }, // Ō
-    { 18, 25, 20, 1, 24, 113, 11181 }, // ō
-    { 24, 33, 26, 1, 32, 198, 11294 }, // Ŏ
-    { 18, 27, 20, 1, 26, 122, 11492 }, // ŏ
-    { 24, 34, 26, 1, 33, 204, 11614 }, // Ő
-    { 18, 29, 20, 1, 28, 131, 11818 }, // ő
-    { 31, 24, 33, 1, 23, 186, 11949 }, // Œ
-    { 28, 19, 30, 1, 18, 133, 12135 }, // œ
-    { 23, 33, 23, 1, 32, 190, 12268 }, // Ŕ
-    { 16, 28, 16, 0, 28, 112, 12458 }, // ŕ
-    { 23, 33, 23, 1, 24, 190, 12570 }, // Ŗ
-    { 16, 27, 16, 0, 18, 108, 12760 }, // ŗ
-    { 23, 33, 23, 1, 32, 190, 12868 }, // Ř
-    { 16, 28, 16, 0, 28, 112, 13058 }, // ř
-    { 17, 33, 19, 1, 32, 141, 13170 }, // Ś
-    { 15, 29, 17, 1, 28, 109, 13311 }, // ś
-    { 17, 33, 19, 1, 32, 141, 13420 }, // Ŝ
-    { 15, 28, 17, 1, 27, 105, 13561 }, // ŝ
-    { 17, 33, 19, 1, 24, 141, 13666 }, // Ş
-    { 15, 27, 17, 1, 18, 102, 13807 }, // ş
-    { 17, 33, 19, 1, 32, 141, 13909 }, // Š
-    { 15, 29, 17, 1, 28, 109, 14050 }, // š
-    { 23, 32, 24, 0, 23, 184, 14159 }, // Ţ
-    { 15, 31, 14, -1, 22, 117, 14343 }, // ţ
-    { 23, 32, 24, 0, 32, 184, 14460 }, // Ť
-    { 15, 28, 14, -1, 27, 105, 14644 }, // ť
-    { 23, 23, 24, 0, 23, 133, 14749 }, // Ŧ
-    { 15, 23, 14, -1, 22, 87, 14882 }, // ŧ
-    { 26, 33, 27, 0, 32, 215, 14969 }, // Ũ
-    { 22, 27, 22, 0, 26, 149, 15184 }, // ũ
-    { 26, 31, 27, 0, 30, 202, 15333 }, // Ū
-    { 22, 25, 22, 0, 24, 138, 15535 }, // ū
-    { 26, 33, 27, 0, 32, 215, 15673 }, // Ŭ
-    { 22, 27, 22, 0, 26, 149, 15888 }, // ŭ
-    { 26, 34, 27, 0, 33, 221, 16037 }, // Ů
-    { 22, 29, 22, 0, 28, 160, 16258 }, // ů
-    { 26, 34, 27, 0, 33, 221, 16418 }, // Ű
-    { 22, 29, 22, 0, 28, 160, 16639 }, // ű
-    { 26, 31, 27, 0, 23, 202, 16799 }, // Ų
-    { 22, 26, 22, 0, 18, 143, 17001 }, // ų
-    { 37, 33, 37, 0, 32, 306, 17144 }, // Ŵ
-    { 30, 28, 30, 0, 27, 210, 17450 }, // ŵ
-    { 24, 32, 24, 0, 32, 192, 17660 }, // Ŷ
-    { 22, 35, 21, 0, 27, 193, 17852 }, // ŷ
-    { 24, 31, 24, 0, 31, 186, 18045 }, // Ÿ
-    { 20, 33, 20, 0, 32, 165, 18231 }, // Ź
-    { 17, 29, 17, 0, 28, 124, 18396 }, // ź
-    { 20, 33, 20, 0, 32, 165, 18520 }, // Ż
-    { 17, 27, 17, 0, 26, 115, 18685 }, // ż
-    { 20, 33, 20, 0, 32, 165, 18800 }, // Ž
-    { 17, 29, 17, 0, 28, 124, 18965 }, // ž
-    { 17, 26, 14, 0, 26, 111, 19089 }, // ſ
-    { 7, 9, 0, -5, 28, 16, 0 }, // ̀
-    { 6, 9, 0, -2, 28, 14, 16 }, // ́
-    { 12, 8, 0, -6, 27, 24, 30 }, // ̂
-    { 12, 6, 0, -6, 26, 18, 54 }, // ̃
-    { 12, 4, 0, -6, 24, 12, 72 }, // ̄
-    { 12, 6, 0, -6, 26, 18, 84 }, // ̆
-    { 6, 6, 0, -3, 26, 9, 102 }, // ̇
-    { 12, 6, 0, -6, 26, 18, 111 }, // ̈
-    { 10, 10, 0, -5, 29, 25, 129 }, // ̉
-    { 10, 9, 0, -5, 28, 23, 154 }, // ̊
-    { 11, 9, 0, -4, 28, 25, 177 }, // ̋
-    { 12, 8, 0, -6, 28, 24, 202 }, // ̌
-    { 11, 9, 0, -7, 28, 25, 226 }, // ̏
-    { 12, 6, 0, -6, 26, 18, 251 }, // ̑
-    { 6, 10, 0, -3, 29, 15, 269 }, // ̒
-    { 7, 9, 0, -3, 29, 16, 284 }, // ̓
-    { 7, 9, 0, -4, 29, 16, 300 }, // ̔
-    { 5, 9, 0, -2, 29, 12, 316 }, // ̕
-    { 6, 9, 0, -3, 22, 14, 328 }, // ̛
-    { 6, 6, 0, -3, -2, 9, 342 }, // ̣
-    { 12, 5, 0, -6, -3, 15, 351 }, // ̤
-    { 8, 8, 0, -4, -1, 16, 366 }, // ̥
-    { 7, 8, 0, -4, -1, 14, 382 }, // ̦
-    { 8, 8, 0, -4, -1, 16, 396 }, // ̧
-    { 8, 9, 0, -4, 1, 18, 412 }, // ̨
-    { 5, 9, 9, 2, -1, 12, 430 }, // ̩
-    { 12, 7, 0, -6, -2, 21, 442 }, // ̭
-    { 12, 6, 0, -6, -2, 18, 463 }, // ̮
-    { 12, 7, 0, -6, -2, 21, 481 }, // ̰
-    { 12, 4, 0, -6, -3, 12, 502 }, // ̱
-    { 12, 6, 0, -6, 26, 18, 514 }, // ͂
-    { 12, 14, 0, -6, 34, 42, 532 }, // ̈́
-    { 7, 7, 0, -3, -2, 13, 574 }, // ͅ
-    { 20, 32, 21, 1, 32, 160, 0 }, // Ѐ
-    { 20, 31, 21, 1, 31, 155, 160 }, // Ё
-    { 27, 30, 28, 0, 23, 203, 315 }, // Ђ
-    { 19, 32, 21, 1, 32, 152, 518 }, // Ѓ
-    { 21, 25, 23, 1, 24, 132, 670 }, // Є
-    { 17, 25, 19, 1, 24, 107, 802 }, // Ѕ
-    { 12, 23, 14, 1, 23, 69, 909 }, // І
-    { 14, 31, 14, 0, 31, 109, 978 }, // Ї
-    { 15, 30, 13, -2, 23, 113, 1087 }, // Ј
-    { 32, 24, 33, 0, 23, 192, 1200 }, // Љ
-    { 33, 24, 35, 1, 23, 198, 1392 }, // Њ
-    { 30, 23, 30, 0, 23, 173, 1590 }, // Ћ
-    { 24, 33, 25, 1, 32, 198, 1763 }, // Ќ
-    { 26, 32, 28, 1, 32, 208, 1961 }, // Ѝ
-    { 24, 33, 24, 0, 32, 198, 2169 }, // Ў
-    { 25, 31, 27, 1, 23, 194, 2367 }, // Џ
-    { 26, 24, 25, 0, 24, 156, 2561 }, // А
-    { 20, 24, 22, 1, 23, 120, 2717 }, // Б
-    { 20, 25, 21, 1, 24, 125, 2837 }, // В
-    { 19, 23, 21, 1, 23, 110, 2962 }, // Г
-    { 26, 30, 26, 0, 23, 195, 3072 }, // Д
-    { 20, 23, 21, 1, 23, 115, 3267 }, // Е
-    { 37, 25, 37, 0, 24, 232, 3382 }, // Ж
-    { 19, 25, 21, 1, 24, 119, 3614 }, // З
-    { 26, 23, 28, 1, 23, 150, 3733 }, // И
-    { 26, 32, 28, 1, 32, 208, 3883 }, // Й
-    { 24, 25, 25, 1, 24, 150, 4091 }, // К
-    { 25, 24, 26, 0, 23, 150, 4241 }, // Л
-    { 31, 23, 31, 0, 23, 179, 4391 }, // М
-    { 27, 23, 28, 1, 23, 156, 4570 }, // Н
-    { 24, 25, 26, 1, 24, 150, 4726 }, // О
-    { 26, 23, 28, 1, 23, 150, 4876 }, // П
-    { 19, 24, 21, 1, 24, 114, 5026 }, // Р
-    { 20, 25, 22, 1, 24, 125, 5140 }, // С
-    { 23, 23, 24, 0, 23, 133, 5265 }, // Т
-    { 24, 24, 24, 0, 23, 144, 5398 }, // У
-    { 25, 25, 27, 1, 24, 157, 5542 }, // Ф
-    { 25, 23, 25, 0, 23, 144, 5699 }, // Х
-    { 26, 30, 28, 1, 23, 195, 5843 }, // Ц
-    { 25, 23, 26, 0, 23, 144, 6038 }, // Ч
-    { 35, 23, 37, 1, 23, 202, 6182 }, // Ш
-    { 36, 30, 37, 1, 23, 270, 6384 }, // Щ
-    { 25, 24, 26, 0, 23, 150, 6654 }, // Ъ
-    { 32, 24, 34, 1, 23, 192, 6804 }, // Ы
-    { 20, 24, 22, 1, 23, 120, 6996 }, // Ь
-    { 21, 25, 23, 1, 24, 132, 7116 }, // Э
-    { 35, 25, 37, 1, 24, 219, 7248 }, // Ю
-    { 23, 24, 24, 0, 23, 138, 7467 }, // Я
-    { 18, 19, 19, 1, 18, 86, 7605 }, // а
-    { 18, 28, 20, 1, 27, 126, 7691 }, // б
-    { 17, 19, 19, 1, 18, 81, 7817 }, // в
-    { 16, 18, 18, 1, 18, 72, 7898 }, // г
-    { 22, 24, 22, 0, 18, 132, 7970 }, // д
-    { 16, 19, 18, 1, 18, 76, 8102 }, // е
-    { 30, 19, 30, 0, 18, 143, 8178 }, // ж
-    { 16, 19, 17, 0, 18, 76, 8321 }, // з
-    { 21, 18, 23, 1, 18, 95, 8397 }, // и
-    { 21, 26, 23, 1, 26, 137, 8492 }, // й
-    { 20, 19, 21, 1, 18, 95, 8629 }, // к
-    { 21, 19, 21, 0, 18, 100, 8724 }, // л
-    { 24, 18, 26, 1, 18, 108, 8824 }, // м
-    { 21, 18, 23, 1, 18, 95, 8932 }, // н
-    { 18, 19, 20, 1, 18, 86, 9027 }, // о
-    { 21, 18, 23, 1, 18, 95, 9113 }, // п
-    { 20, 26, 21, 0, 18, 130, 9208 }, // р
-    { 15, 19, 17, 1, 18, 72, 9338 }, // с
-    { 20, 18, 20, 0, 18, 90, 9410 }, // т
-    { 22, 26, 21, 0, 18, 143, 9500 }, // у
-    { 24, 34, 26, 1, 26, 204, 9643 }, // ф
-    { 21, 18, 21, 0, 18, 95, 9847 }, // х
-    { 22, 24, 23, 1, 18, 132, 9942 }, // ц
-    { 20, 18, 21, 0, 18, 90, 10074 }, // ч
-    { 29, 18, 30, 1, 18, 131, 10164 }, // ш
-    { 30, 24, 31, 1, 18, 180, 10295 }, // щ
-    { 22, 19, 22, 0, 18, 105, 10475 }, // ъ
-    { 27, 19, 29, 1, 18, 129, 10580 }, // ы
-    { 17, 19, 18, 1, 18, 81, 10709 }, // ь
-    { 17, 19, 18, 0, 18, 81, 10790 }, // э
-    { 28, 19, 29, 1, 18, 133, 10871 }, // ю
-    { 19, 19, 20, 0, 18, 91, 11004 }, // я
-    { 16, 29, 18, 1, 28, 116, 11095 }, // ѐ
-    { 16, 27, 18, 1, 26, 108, 11211 }, // ё
-    { 20, 34, 21, 0, 26, 170, 11319 }, // ђ
-    { 16, 28, 18, 1, 28, 112, 11489 }, // ѓ
-    { 16, 19, 18, 1, 18, 76, 11601 }, // є
-    { 15, 19, 17, 1, 18, 72, 11677 }, // ѕ
-    { 12, 26, 12, 0, 26, 78, 11749 }, // і
-    { 12, 26, 12, 0, 26, 78, 11827 }, // ї
-    { 12, 34, 10, -3, 26, 102, 11905 }, // ј
-    { 26, 19, 27, 0, 18, 124, 12007 }, // љ
-    { 27, 19, 29, 1, 18, 129, 12131 }, // њ
-    { 22, 26, 22, 0, 26, 143, 12260 }, // ћ
-    { 20, 29, 21, 1, 28, 145, 12403 }, // ќ
-    { 21, 28, 23, 1, 28, 147, 12548 }, // ѝ
-    { 22, 34, 21, 0, 26, 187, 12695 }, // ў
-    { 21, 25, 23, 1, 18, 132, 12882 }, // џ
-    { 23, 27, 25, 1, 26, 156, 13014 }, // Ѣ
-    { 21, 25, 21, 0, 24, 132, 13170 }, // ѣ
-    { 24, 25, 26, 1, 24, 150, 13302 }, // Ѳ
-    { 18, 19, 20, 1, 18, 86, 13452 }, // ѳ
-    { 26, 25, 26, 0, 24, 163, 13538 }, // Ѵ
-    { 22, 19, 22, 0, 18, 105, 13701 }, // ѵ
-    { 27, 39, 28, 1, 32, 264, 13806 }, // Ҋ
-    { 22, 32, 23, 1, 26, 176, 14070 }, // ҋ
-    { 20, 24, 22, 1, 23, 120, 14246 }, // Ҍ
-    { 18, 25, 18, 0, 24, 113, 14366 }, // ҍ
-    { 19, 24, 21, 1, 24, 114, 14479 }, // Ҏ
-    { 20, 26, 21, 0, 18, 130, 14593 }, // ҏ
-    { 18, 28, 19, 1, 28, 126, 14723 }, // Ґ
-    { 15, 22, 17, 1, 22, 83, 14849 }, // ґ
-    { 19, 23, 20, 1, 23, 110, 14932 }, // Ғ
-    { 17, 18, 18, 0, 18, 77, 15042 }, // ғ
-    { 22, 30, 24, 1, 23, 165, 15119 }, // Ҕ
-    { 19, 26, 20, 1, 18, 124, 15284 }, // ҕ
-    { 37, 31, 37, 0, 24, 287, 15408 }, // Җ
-    { 30, 24, 30, 0, 18, 180, 15695 }, // җ
-    { 19, 32, 21, 1, 24, 152, 15875 }, // Ҙ
-    { 16, 25, 17, 0, 18, 100, 16027 }, // ҙ
-    { 24, 31, 25, 1, 24, 186, 16127 }, // Қ
-    { 20, 24, 21, 1, 18, 120, 16313 }, // қ
-    { 26, 25, 27, 1, 24, 163, 16433 }, // Ҝ
-    { 21, 19, 22, 1, 18, 100, 16596 }, // ҝ
-    { 24, 25, 25, 1, 24, 150, 16696 }, // Ҟ
-    { 21, 25, 21, 0, 24, 132, 16846 }, // ҟ
-    { 29, 25, 29, 0, 24, 182, 16978 }, // Ҡ
-    { 25, 19, 25, 0, 18, 119, 17160 }, // ҡ
-    { 28, 30, 29, 1, 23, 210, 17279 }, // Ң
-    { 22, 24, 24, 1, 18, 132, 17489 }, // ң
-    { 31, 23, 33, 1, 23, 179, 17621 }, // Ҥ
-    { 26, 18, 27, 1, 18, 117, 17800 }, // ҥ
-    { 35, 30, 37, 1, 23, 263, 17917 }, // Ҧ
-    { 29, 26, 31, 1, 18, 189, 18180 }, // ҧ
-    { 27, 25, 28, 1, 24, 169, 18369 }, // Ҩ
-    { 22, 19, 23, 1, 18, 105, 18538 }, // ҩ
-    { 20, 32, 22, 1, 24, 160, 18643 }, // Ҫ
-    { 15, 25, 17, 1, 18, 94, 18803 }, // ҫ
-    { 23, 30, 24, 0, 23, 173, 18897 }, // Ҭ
-    { 20, 24, 20, 0, 18, 120, 19070 }, // ҭ
-    { 24, 23, 24, 0, 23, 138, 19190 }, // Ү
-    { 22, 26, 22, 0, 18, 143, 19328 }, // ү
-    { 24, 23, 24, 0, 23, 138, 19471 }, // Ұ
-    { 22, 26, 22, 0, 18, 143, 19609 }, // ұ
-    { 26, 30, 26, 0, 23, 195, 19752 }, // Ҳ
-    { 21, 24, 21, 0, 18, 126, 19947 }, // ҳ
-    { 30, 30, 31, 0, 23, 225, 20073 }, // Ҵ
-    { 26, 24, 27, 0, 18, 156, 20298 }, // ҵ
-    { 26, 30, 26, 0, 23, 195, 20454 }, // Ҷ
-    { 21, 24, 22, 0, 18, 126, 20649 }, // ҷ
-    { 25, 23, 26, 0, 23, 144, 20775 }, // Ҹ
-    { 21, 18, 22, 0, 18, 95, 20919 }, // ҹ
-    { 25, 23, 26, 1, 23, 144, 21014 }, // Һ
-    { 22, 26, 22, 0, 26, 143, 21158 }, // һ
-    { 27, 25, 28, 0, 24, 169, 21301 }, // Ҽ
-    { 21, 19, 22, 0, 18, 100, 21470 }, // ҽ
-    { 27, 31, 28, 0, 24, 210, 21570 }, // Ҿ
-    { 21, 25, 22, 0, 18, 132, 21780 }, // ҿ
-    { 12, 23, 14, 1, 23, 69, 21912 }, // Ӏ
-    { 37, 33, 37, 0, 32, 306, 21981 }, // Ӂ
-    { 30, 27, 30, 0, 26, 203, 22287 }, // ӂ
-    { 23, 31, 24, 1, 24, 179, 22490 }, // Ӄ
-    { 19, 26, 21, 1, 18, 124, 22669 }, // ӄ
-    { 25, 30, 26, 0, 23, 188, 22793 }, // Ӆ
-    { 21, 24, 21, 0, 18, 126, 22981 }, // ӆ
-    { 27, 30, 28, 1, 23, 203, 23107 }, // Ӈ
-    { 21, 26, 23, 1, 18, 137, 23310 }, // ӈ
-    { 27, 30, 28, 1, 23, 203, 23447 }, // Ӊ
-    { 22, 24, 23, 1, 18, 132, 23650 }, // ӊ
-    { 25, 30, 26, 0, 23, 188, 23782 }, // Ӌ
-    { 20, 24, 21, 0, 18, 120, 23970 }, // ӌ
-    { 32, 30, 32, 0, 23, 240, 24090 }, // Ӎ
-    { 25, 24, 26, 1, 18, 150, 24330 }, // ӎ
-    { 12, 26, 14, 1, 26, 78, 24480 }, // ӏ
-    { 26, 32, 25, 0, 32, 208, 24558 }, // Ӑ
-    { 18, 27, 19, 1, 26, 122, 24766 }, // ӑ
-    { 26, 31, 25, 0, 31, 202, 24888 }, // Ӓ
-    { 18, 27, 19, 1, 26, 122, 25090 }, // ӓ
-    { 33, 23, 32, -1, 23, 190, 25212 }, // Ӕ
-    { 26, 19, 27, 1, 18, 124, 25402 }, // ӕ
-    { 20, 32, 21, 1, 32, 160, 25526 }, // Ӗ
-    { 16, 27, 18, 1, 26, 108, 25686 }, // ӗ
-    { 21, 25, 23, 1, 24, 132, 25794 }, // Ә
-    { 16, 19, 18, 1, 18, 76, 25926 }, // ә
-    { 21, 32, 23, 1, 31, 168, 26002 }, // Ӛ
-    { 16, 27, 18, 1, 26, 108, 26170 }, // ӛ
-    { 37, 32, 37, 0, 31, 296, 26278 }, // Ӝ
-    { 30, 27, 30, 0, 26, 203, 26574 }, // ӝ
-    { 19, 32, 21, 1, 31, 152, 26777 }, // Ӟ
-    { 16, 27, 17, 0, 26, 108, 26929 }, // ӟ
-    { 18, 24, 19, 0, 23, 108, 27037 }, // Ӡ
-    { 17, 26, 18, 0, 18, 111, 27145 }, // ӡ
-    { 26, 30, 28, 1, 30, 195, 27256 }, // Ӣ
-    { 21, 24, 23, 1, 24, 126, 27451 }, // ӣ
-    { 26, 31, 28, 1, 31, 202, 27577 }, // Ӥ
-    { 21, 26, 23, 1, 26, 137, 27779 }, // ӥ
-    { 24, 32, 26, 1, 31, 192, 27916 }, // Ӧ
-    { 18, 27, 20, 1, 26, 122, 28108 }, // ӧ
-    { 24, 25, 26, 1, 24, 150, 28230 }, // Ө
-    { 18, 19, 20, 1, 18, 86, 28380 }, // ө
-    { 24, 32, 26, 1, 31, 192, 28466 }, // Ӫ
-    { 18, 27, 20, 1, 26, 122, 28658 }, // ӫ
-    { 21, 32, 23, 1, 31, 168, 28780 }, // Ӭ
-    { 17, 27, 18, 0, 26, 115, 28948 }, // ӭ
-    { 24, 31, 24, 0, 30, 186, 29063 }, // Ӯ
-    { 22, 32, 21, 0, 24, 176, 29249 }, // ӯ
-    { 24, 32, 24, 0, 31, 192, 29425 }, // Ӱ
-    { 22, 34, 21, 0, 26, 187, 29617 }, // ӱ
-    { 24, 34, 24, 0, 33, 204, 29804 }, // Ӳ
-    { 22, 36, 21, 0, 28, 198, 30008 }, // ӳ
-    { 25, 31, 26, 0, 31, 194, 30206 }, // Ӵ
-    { 20, 26, 21, 0, 26, 130, 30400 }, // ӵ
-    { 19, 30, 21, 1, 23, 143, 30530 }, // Ӷ
-    { 16, 24, 18, 1, 18, 96, 30673 }, // ӷ
-    { 32, 32, 34, 1, 31, 256, 30769 }, // Ӹ
-    { 27, 27, 29, 1, 26, 183, 31025 }, // ӹ
-    { 19, 30, 20, 1, 23, 143, 31208 }, // Ӻ
-    { 17, 25, 18, 0, 18, 107, 31351 }, // ӻ
-    { 25, 30, 25, 0, 23, 188, 31458 }, // Ӽ
-    { 20, 26, 20, 0, 18, 130, 31646 }, // ӽ
-    { 25, 23, 25, 0, 23, 144, 31776 }, // Ӿ
-    { 21, 18, 21, 0, 18, 95, 31920 }, // ӿ
-    { 0, 0, 17, 0, 0, 0, 0 }, //  
-    { 0, 0, 33, 0, 0, 0, 0 }, //  
-    { 0, 0, 17, 0, 0, 0, 0 }, //  
-    { 0, 0, 33, 0, 0, 0, 0 }, //  
-    { 0, 0, 11, 0, 0, 0, 0 }, //  
-    { 0, 0, 8, 0, 0, 0, 0 }, //  
-    { 0, 0, 5, 0, 0, 0, 0 }, //  
-    { 0, 0, 21, 0, 0, 0, 0 }, //  
-    { 0, 0, 10, 0, 0, 0, 0 }, //  
-    { 0, 0, 7, 0, 0, 0, 0 }, //  
-    { 0, 0, 2, 0, 0, 0, 0 }, //  
-    { 0, 0, 0, 0, 0, 0, 0 }, // ​
-    { 2, 28, 0, -1, 20, 14, 0 }, // ‌
-    { 8, 30, 0, -4, 22, 60, 14 }, // ‍
-    { 12, 31, 0, -6, 23, 93, 74 }, // ‎
-    { 12, 31, 0, -6, 23, 93, 167 }, // ‏
-    { 11, 5, 13, 1, 11, 14, 260 }, // ‐
-    { 11, 5, 13, 1, 11, 14, 274 }, // ‑
-    { 17, 4, 21, 2, 13, 17, 288 }, // ‒
-    { 17, 5, 17, 0, 11, 22, 305 }, // –
-    { 33, 5, 33, 0, 11, 42, 327 }, // —
-    { 33, 5, 33, 0, 11, 42, 369 }, // ―
-    { 12, 34, 17, 2, 26, 102, 411 }, // ‖
-    { 17, 9, 17, 0, -1, 39, 513 }, // ‗
-    { 7, 11, 8, 1, 25, 20, 552 }, // ‘
-    { 7, 11, 8, 0, 25, 20, 572 }, // ’
-    { 7, 11, 8, 0, 5, 20, 592 }, // ‚
-    { 7, 11, 8, 1, 25, 20, 612 }, // ‛
-    { 13, 11, 15, 1, 25, 36, 632 }, // “
-    { 14, 11, 15, 0, 25, 39, 668 }, // ”
-    { 14, 11, 15, 0, 5, 39, 707 }, // „
-    { 13, 11, 15, 1, 25, 36, 746 }, // ‟
-    { 15, 22, 16, 1, 24, 83, 782 }, // †
-    { 15, 26, 16, 1, 24, 98, 865 }, // ‡
-    { 8, 8, 10, 1, 13, 16, 963 }, // •
-    { 12, 12, 21, 4, 17, 36, 979 }, // ‣
-    { 7, 6, 10, 1, 5, 11, 1015 }, // ․
-    { 15, 6, 17, 1, 5, 23, 1026 }, // ‥
-    { 29, 6, 33, 2, 5, 44, 1049 }, // …
-    { 7, 6, 10, 1, 12, 11, 1093 }, // ‧
-    { 0, 0, 0, 0, 0, 0, 1104 }, //  
-    { 0, 0, 0, 0, 0, 0, 1104 }, //  
-    { 12, 31, 0, -6, 23, 93, 1104 }, // ‪
-    { 12, 31, 0, -6, 23, 93, 1197 }, // ‫
-    { 10, 31, 0, -5, 23, 78, 1290 }, // ‬
-    { 14, 31, 0, -7, 23, 109, 1368 }, // ‭
-    { 14, 31, 0, -7, 23, 109, 1477 }, // ‮
-    { 0, 0, 4, 0, 0, 0, 1586 }, //  
-    { 44, 27, 46, 1, 25, 297, 1586 }, // ‰
-    { 9, 11, 9, 0, 23, 25, 1883 }, // ′
-    { 16, 11, 16, 0, 23, 44, 1908 }, // ″
-    { 23, 11, 23, 0, 23, 64, 1952 }, // ‴
-    { 9, 11, 9, 0, 23, 25, 2016 }, // ‵
-    { 15, 11, 17, 1, 23, 42, 2041 }, // ‶
-    { 22, 11, 24, 1, 23, 61, 2083 }, // ‷
-    { 14, 7, 16, 1, 0, 25, 2144 }, // ‸
-    { 9, 13, 11, 1, 15, 30, 2169 }, // ‹
-    { 9, 13, 11, 1, 15, 30, 2199 }, // ›
-    { 21, 23, 21, 0, 22, 121, 2229 }, // ※
-    { 16, 26, 19, 2, 25, 104, 2350 }, // ‼
-    { 17, 4, 17, 0, 28, 17, 2454 }, // ‾
-    { 8, 5, 10, 1, 11, 10, 2471 }, // ⁃
-    { 18, 28, 6, -6, 25, 126, 2481 }, // ⁄
-    { 28, 26, 31, 2, 25, 182, 2607 }, // ⁇
-    { 23, 26, 25, 2, 25, 150, 2789 }, // ⁈
-    { 22, 26, 25, 2, 25, 143, 2939 }, // ⁉
-    { 20, 7, 33, 6, 13, 35, 3082 }, // ⁓
-    { 30, 11, 31, 0, 23, 83, 3117 }, // ⁗
-    { 0, 0, 7, 0, 0, 0, 3200 }, //  
-    { 0, 0, 0, 0, 0, 0, 3200 }, // ⁠
-    { 0, 0, 0, 0, 0, 0, 3200 }, // ⁡
-    { 0, 0, 0, 0, 0, 0, 3200 }, // ⁢
-    { 0, 0, 0, 0, 0, 0, 3200 }, // ⁣
-    { 0, 0, 0, 0, 0, 0, 3200 }, // ⁤
-    { 15, 17, 15, 0, 28, 64, 0 }, // ⁰
-    { 14, 17, 15, 0, 28, 60, 64 }, // ⁴
-    { 11, 16, 15, 2, 27, 44, 124 }, // ⁵
-    { 13, 17, 15, 1, 28, 56, 168 }, // ⁶
-    { 12, 16, 15, 2, 27, 48, 224 }, // ⁷
-    { 13, 17, 15, 1, 28, 56, 272 }, // ⁸
-    { 13, 17, 15, 1, 28, 56, 328 }, // ⁹
-    { 15, 11, 19, 2, 23, 42, 384 }, // ⁿ
-    { 15, 16, 15, 0, 11, 60, 426 }, // ₀
-    { 11, 16, 15, 2, 11, 44, 486 }, // ₁
-    { 13, 16, 15, 1, 11, 52, 530 }, // ₂
-    { 12, 16, 15, 1, 11, 48, 582 }, // ₃
-    { 14, 16, 15, 0, 11, 56, 630 }, // ₄
-    { 11, 16, 15, 2, 11, 44, 686 }, // ₅
-    { 13, 16, 15, 1, 11, 52, 730 }, // ₆
-    { 12, 16, 15, 2, 11, 48, 782 }, // ₇
-    { 13, 16, 15, 1, 11, 52, 830 }, // ₈
-    { 13, 16, 15, 1, 11, 52, 882 }, // ₉
-    { 19, 23, 21, 1, 23, 110, 0 }, // ₣
-    { 20, 24, 21, 0, 23, 120, 110 }, // ₤
-    { 44, 24, 45, 0, 23, 264, 230 }, // ₧
-    { 21, 24, 21, 0, 23, 126, 494 }, // €
-    { 21, 15, 33, 6, 19, 79, 0 }, // ←
-    { 15, 21, 33, 9, 22, 79, 79 }, // ↑
-    { 21, 15, 33, 6, 19, 79, 158 }, // →
-    { 15, 21, 33, 9, 22, 79, 237 }, // ↓
-    { 21, 15, 33, 6, 19, 79, 316 }, // ↔
-    { 15, 23, 33, 9, 23, 87, 395 }, // ↕
-    { 15, 23, 33, 9, 23, 87, 482 }, // ↨
-    { 15, 23, 33, 9, 23, 87, 569 }, // ↲
-    { 15, 23, 33, 9, 23, 87, 656 }, // ↳
-    { 19, 18, 33, 7, 20, 86, 743 }, // ↵
-    { 21, 19, 33, 6, 21, 100, 829 }, // ⇐
-    { 19, 21, 33, 7, 22, 100, 929 }, // ⇑
-    { 21, 19, 33, 6, 21, 100, 1029 }, // ⇒
-    { 19, 21, 33, 7, 22, 100, 1129 }, // ⇓
-    { 21, 17, 33, 6, 20, 90, 1229 }, // ⇔
-    { 23, 24, 33, 5, 23, 138, 0 }, // ∀
-    { 18, 27, 21, 1, 26, 122, 138 }, // ∂
-    { 17, 23, 33, 8, 23, 98, 260 }, // ∃
-    { 25, 27, 33, 4, 25, 169, 358 }, // ∅
-    { 22, 24, 23, 0, 24, 132, 527 }, // ∆
-    { 21, 24, 33, 6, 23, 126, 659 }, // ∇
-    { 23, 23, 33, 5, 23, 133, 785 }, // ∈
-    { 23, 29, 33, 5, 26, 167, 918 }, // ∉
-    { 23, 20, 33, 5, 21, 115, 1085 }, // ∊
-    { 23, 23, 33, 5, 23, 133, 1200 }, // ∋
-    { 23, 29, 33, 5, 26, 167, 1333 }, // ∌
-    { 23, 20, 33, 5, 21, 115, 1500 }, // ∍
-    { 26, 29, 28, 1, 23, 189, 1615 }, // ∏
-    { 21, 29, 22, 1, 23, 153, 1804 }, // ∑
-    { 15, 4, 21, 3, 13, 15, 1957 }, // −
-    { 16, 26, 17, 1, 24, 104, 1972 }, // ∕
-    { 16, 26, 17, 1, 24, 104, 2076 }, // ∖
-    { 16, 16, 21, 2, 19, 64, 2180 }, // ∗
-    { 13, 12, 21, 4, 17, 39, 2244 }, // ∘
-    { 7, 6, 21, 7, 12, 11, 2283 }, // ∙
-    { 22, 31, 21, -1, 27, 171, 2294 }, // √
-    { 17, 13, 21, 2, 17, 56, 2465 }, // ∝
-    { 21, 13, 21, 0, 17, 69, 2521 }, // ∞
-    { 21, 23, 33, 6, 23, 121, 2590 }, // ∟
-    { 25, 23, 33, 4, 23, 144, 2711 }, // ∠
-    { 5, 34, 17, 6, 26, 43, 2855 }, // ∣
-    { 12, 34, 17, 2, 26, 102, 2898 }, // ∥
-    { 23, 23, 33, 5, 23, 133, 3000 }, // ∧
-    { 23, 23, 33, 5, 23, 133, 3133 }, // ∨
-    { 19, 24, 33, 7, 24, 114, 3266 }, // ∩
-    { 19, 24, 33, 7, 23, 114, 3380 }, // ∪
-    { 19, 34, 21, 1, 26, 162, 3494 }, // ∫
-    { 23, 20, 33, 5, 19, 115, 3656 }, // ∴
-    { 23, 20, 33, 5, 19, 115, 3771 }, // ∵
-    { 7, 19, 10, 2, 21, 34, 3886 }, // ∶
-    { 23, 20, 33, 5, 19, 115, 3920 }, // ∷
-    { 20, 7, 33, 6, 13, 35, 4035 }, // ∼
-    { 20, 18, 33, 6, 20, 90, 4070 }, // ≅
-    { 17, 14, 21, 2, 18, 60, 4160 }, // ≈
-    { 19, 13, 33, 7, 16, 62, 4220 }, // ≍
-    { 15, 16, 21, 3, 19, 60, 4282 }, // ≠
-    { 19, 16, 33, 7, 18, 76, 4342 }, // ≡
-    { 15, 20, 21, 3, 20, 75, 4418 }, // ≤
-    { 15, 21, 21, 3, 21, 79, 4493 }, // ≥
-    { 27, 16, 33, 3, 19, 108, 4572 }, // ≪
-    { 27, 16, 33, 3, 19, 108, 4680 }, // ≫
-    { 23, 20, 33, 5, 21, 115, 4788 }, // ⊃
-    { 23, 29, 33, 5, 26, 167, 4903 }, // ⊄
-    { 23, 29, 33, 5, 26, 167, 5070 }, // ⊅
-    { 21, 23, 33, 6, 23, 121, 5237 }, // ⊆
-    { 21, 23, 33, 6, 23, 121, 5358 }, // ⊇
-    { 25, 25, 33, 4, 24, 157, 5479 }, // ⊕
-    { 25, 25, 33, 4, 24, 157, 5636 }, // ⊖
-    { 25, 25, 33, 4, 24, 157, 5793 }, // ⊗
-    { 25, 25, 33, 4, 24, 157, 5950 }, // ⊘
-    { 19, 23, 33, 7, 23, 110, 6107 }, // ⊥
-    { 7, 6, 21, 7, 12, 11, 6217 }, // ⋅
-    { 29, 6, 33, 2, 12, 44, 6228 }, // ⋯
-    { 31, 32, 33, 1, 28, 248, 0 }, // �
+    { 18, 13, 19, 1, 15, 59, 9826 }, // «
+    { 15, 9, 21, 3, 16, 34, 893 }, // ¬
+    { 11, 5, 13, 1, 11, 14, 927 }, // ­
+    { 19, 18, 19, 0, 26, 86, 941 }, // ®
+    { 12, 4, 22, 5, 24, 12, 1027 }, // ¯
+    { 13, 12, 17, 2, 23, 39, 1039 }, // °
+    { 15, 21, 21, 3, 20, 79, 1078 }, // ±
+    { 13, 16, 15, 1, 28, 52, 1157 }, // ²
+    { 12, 17, 15, 1, 28, 51, 1209 }, // ³
+    { 7, 9, 22, 8, 28, 16, 1260 }, // ´
+    { 22, 26, 22, 1, 18, 143, 1276 }, // µ
+    { 19, 28, 20, 0, 23, 133, 1419 }, // ¶
+    { 7, 6, 10, 1, 12, 11, 1552 }, // ·
+    { 7, 8, 22, 8, -1, 14, 1563 }, // ¸
+    { 11, 16, 15, 2, 28, 44, 1577 }, // ¹
+    { 13, 17, 15, 1, 24, 56, 1621 }, // º
+    { 18, 13, 19, 1, 15, 59, 9885 }, // »
+    { 33, 28, 36, 2, 25, 231, 1677 }, // ¼
+    { 33, 28, 36, 2, 25, 231, 1908 }, // ½
+    { 34, 28, 36, 1, 25, 238, 2139 }, // ¾
+    { 14, 25, 16, 1, 18, 88, 2377 }, // ¿
+    { 26, 32, 25, 0, 32, 208, 9944 }, // À
+    { 26, 32, 25, 0, 32, 208, 10152 }, // Á
+    { 26, 32, 25, 0, 32, 208, 10360 }, // Â
+    { 26, 32, 25, 0, 32, 208, 2465 }, // Ã
+    { 26, 31, 25, 0, 31, 202, 10568 }, // Ä
+    { 26, 33, 25, 0, 33, 215, 2673 }, // Å
+    { 33, 23, 32, -1, 23, 190, 2888 }, // Æ
+    { 20, 33, 22, 1, 24, 165, 10770 }, // Ç
+    { 20, 32, 21, 1, 32, 160, 10935 }, // È
+    { 20, 32, 21, 1, 32, 160, 11095 }, // É
+    { 20, 32, 21, 1, 32, 160, 11255 }, // Ê
+    { 20, 31, 21, 1, 31, 155, 11415 }, // Ë
+    { 12, 32, 14, 1, 32, 96, 11570 }, // Ì
+    { 12, 32, 14, 1, 32, 96, 11666 }, // Í
+    { 13, 32, 14, 0, 32, 104, 11762 }, // Î
+    { 14, 31, 14, 0, 31, 109, 11866 }, // Ï
+    { 25, 25, 26, 0, 24, 157, 3078 }, // Ð
+    { 27, 33, 27, 0, 32, 223, 11975 }, // Ñ
+    { 24, 33, 26, 1, 32, 198, 12198 }, // Ò
+    { 24, 33, 26, 1, 32, 198, 12396 }, // Ó
+    { 24, 33, 26, 1, 32, 198, 12594 }, // Ô
+    { 24, 33, 26, 1, 32, 198, 3235 }, // Õ
+    { 24, 32, 26, 1, 31, 192, 12792 }, // Ö
+    { 15, 15, 21, 3, 19, 57, 3433 }, // ×
+    { 26, 25, 26, 0, 24, 163, 3490 }, // Ø
+    { 26, 33, 27, 0, 32, 215, 12984 }, // Ù
+    { 26, 33, 27, 0, 32, 215, 13199 }, // Ú
+    { 26, 33, 27, 0, 32, 215, 13414 }, // Û
+    { 26, 32, 27, 0, 31, 208, 13629 }, // Ü
+    { 24, 32, 24, 0, 32, 192, 3653 }, // Ý
+    { 20, 23, 21, 1, 23, 115, 3845 }, // Þ
+    { 21, 27, 22, 0, 26, 142, 3960 }, // ß
+    { 18, 29, 19, 1, 28, 131, 13837 }, // à
+    { 18, 29, 19, 1, 28, 131, 13968 }, // á
+    { 18, 28, 19, 1, 27, 126, 14099 }, // â
+    { 18, 27, 19, 1, 26, 122, 4102 }, // ã
+    { 18, 27, 19, 1, 26, 122, 14225 }, // ä
+    { 18, 29, 19, 1, 28, 131, 4224 }, // å
+    { 26, 19, 27, 1, 18, 124, 4355 }, // æ
+    { 15, 27, 17, 1, 18, 102, 14347 }, // ç
+    { 16, 29, 18, 1, 28, 116, 14449 }, // è
+    { 16, 29, 18, 1, 28, 116, 14565 }, // é
+    { 16, 28, 18, 1, 27, 112, 14681 }, // ê
+    { 16, 27, 18, 1, 26, 108, 14793 }, // ë
+    { 12, 28, 12, 0, 28, 84, 14901 }, // ì
+    { 12, 28, 12, 0, 28, 84, 14985 }, // í
+    { 12, 27, 12, 0, 27, 81, 15069 }, // î
+    { 12, 26, 12, 0, 26, 78, 15150 }, // ï
+    { 18, 28, 20, 1, 27, 126, 4479 }, // ð
+    { 22, 26, 22, 0, 26, 143, 15228 }, // ñ
+    { 18, 29, 20, 1, 28, 131, 15371 }, // ò
+    { 18, 29, 20, 1, 28, 131, 15502 }, // ó
+    { 18, 28, 20, 1, 27, 126, 15633 }, // ô
+    { 18, 27, 20, 1, 26, 122, 4605 }, // õ
+    { 18, 27, 20, 1, 26, 122, 15759 }, // ö
+    { 15, 16, 21, 3, 19, 60, 4727 }, // ÷
+    { 20, 19, 20, 0, 18, 95, 4787 }, // ø
+    { 22, 29, 22, 0, 28, 160, 15881 }, // ù
+    { 22, 29, 22, 0, 28, 160, 16041 }, // ú
+    { 22, 28, 22, 0, 27, 154, 16201 }, // û
+    { 22, 27, 22, 0, 26, 149, 16355 }, // ü
+    { 22, 36, 21, 0, 28, 198, 4882 }, // ý
+    { 20, 34, 21, 0, 26, 170, 5080 }, // þ
+    { 22, 34, 21, 0, 26, 187, 5250 }, // ÿ
+    { 26, 30, 25, 0, 30, 195, 5437 }, // Ā
+    { 18, 25, 19, 1, 24, 113, 5632 }, // ā
+    { 26, 32, 25, 0, 32, 208, 5745 }, // Ă
+    { 18, 27, 19, 1, 26, 122, 5953 }, // ă
+    { 26, 32, 25, 0, 24, 208, 6075 }, // Ą
+    { 18, 26, 19, 1, 18, 117, 6283 }, // ą
+    { 20, 33, 22, 1, 32, 165, 6400 }, // Ć
+    { 15, 29, 17, 1, 28, 109, 6565 }, // ć
+    { 20, 33, 22, 1, 32, 165, 6674 }, // Ĉ
+    { 15, 28, 17, 1, 27, 105, 6839 }, // ĉ
+    { 20, 33, 22, 1, 32, 165, 6944 }, // Ċ
+    { 15, 27, 17, 1, 26, 102, 7109 }, // ċ
+    { 20, 33, 22, 1, 32, 165, 7211 }, // Č
+    { 15, 29, 17, 1, 28, 109, 7376 }, // č
+    { 24, 33, 26, 1, 32, 198, 7485 }, // Ď
+    { 23, 27, 21, 1, 26, 156, 7683 }, // ď
+    { 25, 25, 26, 0, 24, 157, 7839 }, // Đ
+    { 20, 27, 21, 1, 26, 135, 7996 }, // đ
+    { 20, 30, 21, 1, 30, 150, 8131 }, // Ē
+    { 16, 25, 18, 1, 24, 100, 8281 }, // ē
+    { 20, 32, 21, 1, 32, 160, 8381 }, // Ĕ
+    { 16, 27, 18, 1, 26, 108, 8541 }, // ĕ
+    { 20, 32, 21, 1, 32, 160, 8649 }, // Ė
+    { 16, 27, 18, 1, 26, 108, 8809 }, // ė
+    { 20, 31, 21, 1, 23, 155, 8917 }, // Ę
+    { 16, 26, 18, 1, 18, 104, 9072 }, // ę
+    { 20, 32, 21, 1, 32, 160, 9176 }, // Ě
+    { 16, 29, 18, 1, 28, 116, 9336 }, // ě
+    { 23, 33, 24, 1, 32, 190, 9452 }, // Ĝ
+    { 20, 35, 20, 0, 27, 175, 9642 }, // ĝ
+    { 23, 33, 24, 1, 32, 190, 9817 }, // Ğ
+    { 20, 34, 20, 0, 26, 170, 10007 }, // ğ
+    { 23, 33, 24, 1, 32, 190, 10177 }, // Ġ
+    { 20, 34, 20, 0, 26, 170, 10367 }, // ġ
+    { 23, 33, 24, 1, 24, 190, 10537 }, // Ģ
+    { 20, 37, 20, 0, 29, 185, 10727 }, // ģ
+    { 27, 32, 28, 1, 32, 216, 10912 }, // Ĥ
+    { 23, 34, 22, -1, 34, 196, 11128 }, // ĥ
+    { 28, 23, 28, 0, 23, 161, 11324 }, // Ħ
+    { 22, 26, 22, 0, 26, 143, 11485 }, // ħ
+    { 12, 32, 14, 1, 32, 96, 11628 }, // Ĩ
+    { 12, 26, 12, 0, 26, 78, 11724 }, // ĩ
+    { 12, 30, 14, 1, 30, 90, 11802 }, // Ī
+    { 12, 24, 12, 0, 24, 72, 11892 }, // ī
+    { 12, 32, 14, 1, 32, 96, 11964 }, // Ĭ
+    { 12, 26, 12, 0, 26, 78, 12060 }, // ĭ
+    { 12, 31, 14, 1, 23, 93, 12138 }, // Į
+    { 12, 34, 12, 0, 26, 102, 12231 }, // į
+    { 12, 32, 14, 1, 32, 96, 12333 }, // İ
+    { 12, 18, 12, 0, 18, 54, 12429 }, // ı
+    { 26, 30, 27, 1, 23, 195, 12483 }, // Ĳ
+    { 21, 34, 22, 0, 26, 179, 12678 }, // ĳ
+    { 15, 39, 13, -2, 32, 147, 12857 }, // Ĵ
+    { 15, 35, 10, -3, 27, 132, 13004 }, // ĵ
+    { 24, 32, 25, 1, 23, 192, 13136 }, // Ķ
+    { 21, 35, 21, 0, 26, 184, 13328 }, // ķ
+    { 22, 19, 21, 0, 18, 105, 13512 }, // ĸ
+    { 20, 32, 21, 1, 32, 160, 13617 }, // Ĺ
+    { 11, 34, 12, 0, 34, 94, 13777 }, // ĺ
+    { 20, 32, 21, 1, 23, 160, 13871 }, // Ļ
+    { 11, 35, 12, 0, 26, 97, 14031 }, // ļ
+    { 20, 26, 21, 1, 26, 130, 14128 }, // Ľ
+    { 15, 26, 12, 0, 26, 98, 14258 }, // ľ
+    { 20, 23, 21, 1, 23, 115, 14356 }, // Ŀ
+    { 18, 26, 18, 0, 26, 117, 14471 }, // ŀ
+    { 22, 23, 21, -1, 23, 127, 14588 }, // Ł
+    { 13, 26, 12, -1, 26, 85, 14715 }, // ł
+    { 27, 33, 27, 0, 32, 223, 14800 }, // Ń
+    { 22, 28, 22, 0, 28, 154, 15023 }, // ń
+    { 27, 32, 27, 0, 23, 216, 15177 }, // Ņ
+    { 22, 27, 22, 0, 18, 149, 15393 }, // ņ
+    { 27, 33, 27, 0, 32, 223, 15542 }, // Ň
+    { 22, 28, 22, 0, 28, 154, 15765 }, // ň
+    { 30, 24, 30, 0, 24, 180, 15919 }, // ŉ
+    { 27, 30, 27, 0, 23, 203, 16099 }, // Ŋ
+    { 20, 26, 22, 0, 18, 130, 16302 }, // ŋ
+    { 24, 31, 26, 1, 30, 186, 16432 }, // Ō
+    { 18, 25, 20, 1, 24, 113, 16618 }, // ō
+    { 24, 33, 26, 1, 32, 198, 16731 }, // Ŏ
+    { 18, 27, 20, 1, 26, 122, 16929 }, // ŏ
+    { 24, 34, 26, 1, 33, 204, 17051 }, // Ő
+    { 18, 29, 20, 1, 28, 131, 17255 }, // ő
+    { 31, 24, 33, 1, 23, 186, 16504 }, // Œ
+    { 28, 19, 30, 1, 18, 133, 16690 }, // œ
+    { 23, 33, 23, 1, 32, 190, 17386 }, // Ŕ
+    { 16, 28, 16, 0, 28, 112, 17576 }, // ŕ
+    { 23, 33, 23, 1, 24, 190, 17688 }, // Ŗ
+    { 16, 27, 16, 0, 18, 108, 17878 }, // ŗ
+    { 23, 33, 23, 1, 32, 190, 17986 }, // Ř
+    { 16, 28, 16, 0, 28, 112, 18176 }, // ř
+    { 17, 33, 19, 1, 32, 141, 18288 }, // Ś
+    { 15, 29, 17, 1, 28, 109, 18429 }, // ś
+    { 17, 33, 19, 1, 32, 141, 18538 }, // Ŝ
+    { 15, 28, 17, 1, 27, 105, 18679 }, // ŝ
+    { 17, 33, 19, 1, 24, 141, 18784 }, // Ş
+    { 15, 27, 17, 1, 18, 102, 18925 }, // ş
+    { 17, 33, 19, 1, 32, 141, 19027 }, // Š
+    { 15, 29, 17, 1, 28, 109, 19168 }, // š
+    { 23, 32, 24, 0, 23, 184, 19277 }, // Ţ
+    { 15, 31, 14, -1, 22, 117, 19461 }, // ţ
+    { 23, 32, 24, 0, 32, 184, 19578 }, // Ť
+    { 15, 28, 14, -1, 27, 105, 19762 }, // ť
+    { 23, 23, 24, 0, 23, 133, 19867 }, // Ŧ
+    { 15, 23, 14, -1, 22, 87, 20000 }, // ŧ
+    { 26, 33, 27, 0, 32, 215, 20087 }, // Ũ
+    { 22, 27, 22, 0, 26, 149, 20302 }, // ũ
+    { 26, 31, 27, 0, 30, 202, 20451 }, // Ū
+    { 22, 25, 22, 0, 24, 138, 20653 }, // ū
+    { 26, 33, 27, 0, 32, 215, 20791 }, // Ŭ
+    { 22, 27, 22, 0, 26, 149, 21006 }, // ŭ
+    { 26, 34, 27, 0, 33, 221, 21155 }, // Ů
+    { 22, 29, 22, 0, 28, 160, 21376 }, // ů
+    { 26, 34, 27, 0, 33, 221, 21536 }, // Ű
+    { 22, 29, 22, 0, 28, 160, 21757 }, // ű
+    { 26, 31, 27, 0, 23, 202, 21917 }, // Ų
+    { 22, 26, 22, 0, 18, 143, 22119 }, // ų
+    { 37, 33, 37, 0, 32, 306, 22262 }, // Ŵ
+    { 30, 28, 30, 0, 27, 210, 22568 }, // ŵ
+    { 24, 32, 24, 0, 32, 192, 22778 }, // Ŷ
+    { 22, 35, 21, 0, 27, 193, 22970 }, // ŷ
+    { 24, 31, 24, 0, 31, 186, 23163 }, // Ÿ
+    { 20, 33, 20, 0, 32, 165, 23349 }, // Ź
+    { 17, 29, 17, 0, 28, 124, 23514 }, // ź
+    { 20, 33, 20, 0, 32, 165, 23638 }, // Ż
+    { 17, 27, 17, 0, 26, 115, 23803 }, // ż
+    { 20, 33, 20, 0, 32, 165, 23918 }, // Ž
+    { 17, 29, 17, 0, 28, 124, 24083 }, // ž
+    { 17, 26, 14, 0, 26, 111, 24207 }, // ſ
+    { 7, 9, 0, -5, 28, 16, 24318 }, // ̀
+    { 6, 9, 0, -2, 28, 14, 24334 }, // ́
+    { 12, 8, 0, -6, 27, 24, 24348 }, // ̂
+    { 12, 6, 0, -6, 26, 18, 24372 }, // ̃
+    { 12, 4, 0, -6, 24, 12, 24390 }, // ̄
+    { 12, 6, 0, -6, 26, 18, 24402 }, // ̆
+    { 6, 6, 0, -3, 26, 9, 24420 }, // ̇
+    { 12, 6, 0, -6, 26, 18, 24429 }, // ̈
+    { 10, 10, 0, -5, 29, 25, 24447 }, // ̉
+    { 10, 9, 0, -5, 28, 23, 24472 }, // ̊
+    { 11, 9, 0, -4, 28, 25, 24495 }, // ̋
+    { 12, 8, 0, -6, 28, 24, 24520 }, // ̌
+    { 11, 9, 0, -7, 28, 25, 24544 }, // ̏
+    { 12, 6, 0, -6, 26, 18, 24569 }, // ̑
+    { 6, 10, 0, -3, 29, 15, 24587 }, // ̒
+    { 7, 9, 0, -3, 29, 16, 24602 }, // ̓
+    { 7, 9, 0, -4, 29, 16, 24618 }, // ̔
+    { 5, 9, 0, -2, 29, 12, 24634 }, // ̕
+    { 6, 9, 0, -3, 22, 14, 24646 }, // ̛
+    { 6, 6, 0, -3, -2, 9, 24660 }, // ̣
+    { 12, 5, 0, -6, -3, 15, 24669 }, // ̤
+    { 8, 8, 0, -4, -1, 16, 24684 }, // ̥
+    { 7, 8, 0, -4, -1, 14, 24700 }, // ̦
+    { 8, 8, 0, -4, -1, 16, 24714 }, // ̧
+    { 8, 9, 0, -4, 1, 18, 24730 }, // ̨
+    { 5, 9, 9, 2, -1, 12, 24748 }, // ̩
+    { 12, 7, 0, -6, -2, 21, 24760 }, // ̭
+    { 12, 6, 0, -6, -2, 18, 24781 }, // ̮
+    { 12, 7, 0, -6, -2, 21, 24799 }, // ̰
+    { 12, 4, 0, -6, -3, 12, 24820 }, // ̱
+    { 12, 6, 0, -6, 26, 18, 24832 }, // ͂
+    { 12, 14, 0, -6, 34, 42, 24850 }, // ̈́
+    { 7, 7, 0, -3, -2, 13, 24892 }, // ͅ
+    { 20, 32, 21, 1, 32, 160, 24905 }, // Ѐ
+    { 20, 31, 21, 1, 31, 155, 0 }, // Ё
+    { 27, 30, 28, 0, 23, 203, 25065 }, // Ђ
+    { 19, 32, 21, 1, 32, 152, 25268 }, // Ѓ
+    { 21, 25, 23, 1, 24, 132, 25420 }, // Є
+    { 17, 25, 19, 1, 24, 107, 25552 }, // Ѕ
+    { 12, 23, 14, 1, 23, 69, 25659 }, // І
+    { 14, 31, 14, 0, 31, 109, 25728 }, // Ї
+    { 15, 30, 13, -2, 23, 113, 25837 }, // Ј
+    { 32, 24, 33, 0, 23, 192, 25950 }, // Љ
+    { 33, 24, 35, 1, 23, 198, 26142 }, // Њ
+    { 30, 23, 30, 0, 23, 173, 26340 }, // Ћ
+    { 24, 33, 25, 1, 32, 198, 26513 }, // Ќ
+    { 26, 32, 28, 1, 32, 208, 26711 }, // Ѝ
+    { 24, 33, 24, 0, 32, 198, 26919 }, // Ў
+    { 25, 31, 27, 1, 23, 194, 27117 }, // Џ
+    { 26, 24, 25, 0, 24, 156, 155 }, // А
+    { 20, 24, 22, 1, 23, 120, 311 }, // Б
+    { 20, 25, 21, 1, 24, 125, 431 }, // В
+    { 19, 23, 21, 1, 23, 110, 556 }, // Г
+    { 26, 30, 26, 0, 23, 195, 666 }, // Д
+    { 20, 23, 21, 1, 23, 115, 861 }, // Е
+    { 37, 25, 37, 0, 24, 232, 976 }, // Ж
+    { 19, 25, 21, 1, 24, 119, 1208 }, // З
+    { 26, 23, 28, 1, 23, 150, 1327 }, // И
+    { 26, 32, 28, 1, 32, 208, 1477 }, // Й
+    { 24, 25, 25, 1, 24, 150, 1685 }, // К
+    { 25, 24, 26, 0, 23, 150, 1835 }, // Л
+    { 31, 23, 31, 0, 23, 179, 1985 }, // М
+    { 27, 23, 28, 1, 23, 156, 2164 }, // Н
+    { 24, 25, 26, 1, 24, 150, 2320 }, // О
+    { 26, 23, 28, 1, 23, 150, 2470 }, // П
+    { 19, 24, 21, 1, 24, 114, 2620 }, // Р
+    { 20, 25, 22, 1, 24, 125, 2734 }, // С
+    { 23, 23, 24, 0, 23, 133, 2859 }, // Т
+    { 24, 24, 24, 0, 23, 144, 2992 }, // У
+    { 25, 25, 27, 1, 24, 157, 3136 }, // Ф
+    { 25, 23, 25, 0, 23, 144, 3293 }, // Х
+    { 26, 30, 28, 1, 23, 195, 3437 }, // Ц
+    { 25, 23, 26, 0, 23, 144, 3632 }, // Ч
+    { 35, 23, 37, 1, 23, 202, 3776 }, // Ш
+    { 36, 30, 37, 1, 23, 270, 3978 }, // Щ
+    { 25, 24, 26, 0, 23, 150, 4248 }, // Ъ
+    { 32, 24, 34, 1, 23, 192, 4398 }, // Ы
+    { 20, 24, 22, 1, 23, 120, 4590 }, // Ь
+    { 21, 25, 23, 1, 24, 132, 4710 }, // Э
+    { 35, 25, 37, 1, 24, 219, 4842 }, // Ю
+    { 23, 24, 24, 0, 23, 138, 5061 }, // Я
+    { 18, 19, 19, 1, 18, 86, 5199 }, // а
+    { 18, 28, 20, 1, 27, 126, 5285 }, // б
+    { 17, 19, 19, 1, 18, 81, 5411 }, // в
+    { 16, 18, 18, 1, 18, 72, 5492 }, // г
+    { 22, 24, 22, 0, 18, 132, 5564 }, // д
+    { 16, 19, 18, 1, 18, 76, 5696 }, // е
+    { 30, 19, 30, 0, 18, 143, 5772 }, // ж
+    { 16, 19, 17, 0, 18, 76, 5915 }, // з
+    { 21, 18, 23, 1, 18, 95, 5991 }, // и
+    { 21, 26, 23, 1, 26, 137, 6086 }, // й
+    { 20, 19, 21, 1, 18, 95, 6223 }, // к
+    { 21, 19, 21, 0, 18, 100, 6318 }, // л
+    { 24, 18, 26, 1, 18, 108, 6418 }, // м
+    { 21, 18, 23, 1, 18, 95, 6526 }, // н
+    { 18, 19, 20, 1, 18, 86, 6621 }, // о
+    { 21, 18, 23, 1, 18, 95, 6707 }, // п
+    { 20, 26, 21, 0, 18, 130, 6802 }, // р
+    { 15, 19, 17, 1, 18, 72, 6932 }, // с
+    { 20, 18, 20, 0, 18, 90, 7004 }, // т
+    { 22, 26, 21, 0, 18, 143, 7094 }, // у
+    { 24, 34, 26, 1, 26, 204, 7237 }, // ф
+    { 21, 18, 21, 0, 18, 95, 7441 }, // х
+    { 22, 24, 23, 1, 18, 132, 7536 }, // ц
+    { 20, 18, 21, 0, 18, 90, 7668 }, // ч
+    { 29, 18, 30, 1, 18, 131, 7758 }, // ш
+    { 30, 24, 31, 1, 18, 180, 7889 }, // щ
+    { 22, 19, 22, 0, 18, 105, 8069 }, // ъ
+    { 27, 19, 29, 1, 18, 129, 8174 }, // ы
+    { 17, 19, 18, 1, 18, 81, 8303 }, // ь
+    { 17, 19, 18, 0, 18, 81, 8384 }, // э
+    { 28, 19, 29, 1, 18, 133, 8465 }, // ю
+    { 19, 19, 20, 0, 18, 91, 8598 }, // я
+    { 16, 29, 18, 1, 28, 116, 27311 }, // ѐ
+    { 16, 27, 18, 1, 26, 108, 8689 }, // ё
+    { 20, 34, 21, 0, 26, 170, 27427 }, // ђ
+    { 16, 28, 18, 1, 28, 112, 27597 }, // ѓ
+    { 16, 19, 18, 1, 18, 76, 27709 }, // є
+    { 15, 19, 17, 1, 18, 72, 27785 }, // ѕ
+    { 12, 26, 12, 0, 26, 78, 27857 }, // і
+    { 12, 26, 12, 0, 26, 78, 27935 }, // ї
+    { 12, 34, 10, -3, 26, 102, 28013 }, // ј
+    { 26, 19, 27, 0, 18, 124, 28115 }, // љ
+    { 27, 19, 29, 1, 18, 129, 28239 }, // њ
+    { 22, 26, 22, 0, 26, 143, 28368 }, // ћ
+    { 20, 29, 21, 1, 28, 145, 28511 }, // ќ
+    { 21, 28, 23, 1, 28, 147, 28656 }, // ѝ
+    { 22, 34, 21, 0, 26, 187, 28803 }, // ў
+    { 21, 25, 23, 1, 18, 132, 28990 }, // џ
+    { 23, 27, 25, 1, 26, 156, 29122 }, // Ѣ
+    { 21, 25, 21, 0, 24, 132, 29278 }, // ѣ
+    { 24, 25, 26, 1, 24, 150, 29410 }, // Ѳ
+    { 18, 19, 20, 1, 18, 86, 29560 }, // ѳ
+    { 26, 25, 26, 0, 24, 163, 29646 }, // Ѵ
+    { 22, 19, 22, 0, 18, 105, 29809 }, // ѵ
+    { 27, 39, 28, 1, 32, 264, 29914 }, // Ҋ
+    { 22, 32, 23, 1, 26, 176, 30178 }, // ҋ
+    { 20, 24, 22, 1, 23, 120, 30354 }, // Ҍ
+    { 18, 25, 18, 0, 24, 113, 30474 }, // ҍ
+    { 19, 24, 21, 1, 24, 114, 30587 }, // Ҏ
+    { 20, 26, 21, 0, 18, 130, 30701 }, // ҏ
+    { 18, 28, 19, 1, 28, 126, 30831 }, // Ґ
+    { 15, 22, 17, 1, 22, 83, 30957 }, // ґ
+    { 19, 23, 20, 1, 23, 110, 31040 }, // Ғ
+    { 17, 18, 18, 0, 18, 77, 31150 }, // ғ
+    { 22, 30, 24, 1, 23, 165, 31227 }, // Ҕ
+    { 19, 26, 20, 1, 18, 124, 31392 }, // ҕ
+    { 37, 31, 37, 0, 24, 287, 31516 }, // Җ
+    { 30, 24, 30, 0, 18, 180, 31803 }, // җ
+    { 19, 32, 21, 1, 24, 152, 0 }, // Ҙ
+    { 16, 25, 17, 0, 18, 100, 152 }, // ҙ
+    { 24, 31, 25, 1, 24, 186, 252 }, // Қ
+    { 20, 24, 21, 1, 18, 120, 438 }, // қ
+    { 26, 25, 27, 1, 24, 163, 558 }, // Ҝ
+    { 21, 19, 22, 1, 18, 100, 721 }, // ҝ
+    { 24, 25, 25, 1, 24, 150, 821 }, // Ҟ
+    { 21, 25, 21, 0, 24, 132, 971 }, // ҟ
+    { 29, 25, 29, 0, 24, 182, 1103 }, // Ҡ
+    { 25, 19, 25, 0, 18, 119, 1285 }, // ҡ
+    { 28, 30, 29, 1, 23, 210, 1404 }, // Ң
+    { 22, 24, 24, 1, 18, 132, 1614 }, // ң
+    { 31, 23, 33, 1, 23, 179, 1746 }, // Ҥ
+    { 26, 18, 27, 1, 18, 117, 1925 }, // ҥ
+    { 35, 30, 37, 1, 23, 263, 2042 }, // Ҧ
+    { 29, 26, 31, 1, 18, 189, 2305 }, // ҧ
+    { 27, 25, 28, 1, 24, 169, 2494 }, // Ҩ
+    { 22, 19, 23, 1, 18, 105, 2663 }, // ҩ
+    { 20, 32, 22, 1, 24, 160, 2768 }, // Ҫ
+    { 15, 25, 17, 1, 18, 94, 2928 }, // ҫ
+    { 23, 30, 24, 0, 23, 173, 3022 }, // Ҭ
+    { 20, 24, 20, 0, 18, 120, 3195 }, // ҭ
+    { 24, 23, 24, 0, 23, 138, 3315 }, // Ү
+    { 22, 26, 22, 0, 18, 143, 3453 }, // ү
+    { 24, 23, 24, 0, 23, 138, 3596 }, // Ұ
+    { 22, 26, 22, 0, 18, 143, 3734 }, // ұ
+    { 26, 30, 26, 0, 23, 195, 3877 }, // Ҳ
+    { 21, 24, 21, 0, 18, 126, 4072 }, // ҳ
+    { 30, 30, 31, 0, 23, 225, 4198 }, // Ҵ
+    { 26, 24, 27, 0, 18, 156, 4423 }, // ҵ
+    { 26, 30, 26, 0, 23, 195, 4579 }, // Ҷ
+    { 21, 24, 22, 0, 18, 126, 4774 }, // ҷ
+    { 25, 23, 26, 0, 23, 144, 4900 }, // Ҹ
+    { 21, 18, 22, 0, 18, 95, 5044 }, // ҹ
+    { 25, 23, 26, 1, 23, 144, 5139 }, // Һ
+    { 22, 26, 22, 0, 26, 143, 5283 }, // һ
+    { 27, 25, 28, 0, 24, 169, 5426 }, // Ҽ
+    { 21, 19, 22, 0, 18, 100, 5595 }, // ҽ
+    { 27, 31, 28, 0, 24, 210, 5695 }, // Ҿ
+    { 21, 25, 22, 0, 18, 132, 5905 }, // ҿ
+    { 12, 23, 14, 1, 23, 69, 6037 }, // Ӏ
+    { 37, 33, 37, 0, 32, 306, 6106 }, // Ӂ
+    { 30, 27, 30, 0, 26, 203, 6412 }, // ӂ
+    { 23, 31, 24, 1, 24, 179, 6615 }, // Ӄ
+    { 19, 26, 21, 1, 18, 124, 6794 }, // ӄ
+    { 25, 30, 26, 0, 23, 188, 6918 }, // Ӆ
+    { 21, 24, 21, 0, 18, 126, 7106 }, // ӆ
+    { 27, 30, 28, 1, 23, 203, 7232 }, // Ӈ
+    { 21, 26, 23, 1, 18, 137, 7435 }, // ӈ
+    { 27, 30, 28, 1, 23, 203, 7572 }, // Ӊ
+    { 22, 24, 23, 1, 18, 132, 7775 }, // ӊ
+    { 25, 30, 26, 0, 23, 188, 7907 }, // Ӌ
+    { 20, 24, 21, 0, 18, 120, 8095 }, // ӌ
+    { 32, 30, 32, 0, 23, 240, 8215 }, // Ӎ
+    { 25, 24, 26, 1, 18, 150, 8455 }, // ӎ
+    { 12, 26, 14, 1, 26, 78, 8605 }, // ӏ
+    { 26, 32, 25, 0, 32, 208, 8683 }, // Ӑ
+    { 18, 27, 19, 1, 26, 122, 8891 }, // ӑ
+    { 26, 31, 25, 0, 31, 202, 9013 }, // Ӓ
+    { 18, 27, 19, 1, 26, 122, 9215 }, // ӓ
+    { 33, 23, 32, -1, 23, 190, 9337 }, // Ӕ
+    { 26, 19, 27, 1, 18, 124, 9527 }, // ӕ
+    { 20, 32, 21, 1, 32, 160, 9651 }, // Ӗ
+    { 16, 27, 18, 1, 26, 108, 9811 }, // ӗ
+    { 21, 25, 23, 1, 24, 132, 9919 }, // Ә
+    { 16, 19, 18, 1, 18, 76, 10051 }, // ә
+    { 21, 32, 23, 1, 31, 168, 10127 }, // Ӛ
+    { 16, 27, 18, 1, 26, 108, 10295 }, // ӛ
+    { 37, 32, 37, 0, 31, 296, 10403 }, // Ӝ
+    { 30, 27, 30, 0, 26, 203, 10699 }, // ӝ
+    { 19, 32, 21, 1, 31, 152, 10902 }, // Ӟ
+    { 16, 27, 17, 0, 26, 108, 11054 }, // ӟ
+    { 18, 24, 19, 0, 23, 108, 11162 }, // Ӡ
+    { 17, 26, 18, 0, 18, 111, 11270 }, // ӡ
+    { 26, 30, 28, 1, 30, 195, 11381 }, // Ӣ
+    { 21, 24, 23, 1, 24, 126, 11576 }, // ӣ
+    { 26, 31, 28, 1, 31, 202, 11702 }, // Ӥ
+    { 21, 26, 23, 1, 26, 137, 11904 }, // ӥ
+    { 24, 32, 26, 1, 31, 192, 12041 }, // Ӧ
+    { 18, 27, 20, 1, 26, 122, 12233 }, // ӧ
+    { 24, 25, 26, 1, 24, 150, 12355 }, // Ө
+    { 18, 19, 20, 1, 18, 86, 12505 }, // ө
+    { 24, 32, 26, 1, 31, 192, 12591 }, // Ӫ
+    { 18, 27, 20, 1, 26, 122, 12783 }, // ӫ
+    { 21, 32, 23, 1, 31, 168, 12905 }, // Ӭ
+    { 17, 27, 18, 0, 26, 115, 13073 }, // ӭ
+    { 24, 31, 24, 0, 30, 186, 13188 }, // Ӯ
+    { 22, 32, 21, 0, 24, 176, 13374 }, // ӯ
+    { 24, 32, 24, 0, 31, 192, 13550 }, // Ӱ
+    { 22, 34, 21, 0, 26, 187, 13742 }, // ӱ
+    { 24, 34, 24, 0, 33, 204, 13929 }, // Ӳ
+    { 22, 36, 21, 0, 28, 198, 14133 }, // ӳ
+    { 25, 31, 26, 0, 31, 194, 14331 }, // Ӵ
+    { 20, 26, 21, 0, 26, 130, 14525 }, // ӵ
+    { 19, 30, 21, 1, 23, 143, 14655 }, // Ӷ
+    { 16, 24, 18, 1, 18, 96, 14798 }, // ӷ
+    { 32, 32, 34, 1, 31, 256, 14894 }, // Ӹ
+    { 27, 27, 29, 1, 26, 183, 15150 }, // ӹ
+    { 19, 30, 20, 1, 23, 143, 15333 }, // Ӻ
+    { 17, 25, 18, 0, 18, 107, 15476 }, // ӻ
+    { 25, 30, 25, 0, 23, 188, 15583 }, // Ӽ
+    { 20, 26, 20, 0, 18, 130, 15771 }, // ӽ
+    { 25, 23, 25, 0, 23, 144, 15901 }, // Ӿ
+    { 21, 18, 21, 0, 18, 95, 16045 }, // ӿ
+    { 0, 0, 17, 0, 0, 0, 16140 }, //  
+    { 0, 0, 33, 0, 0, 0, 16140 }, //  
+    { 0, 0, 17, 0, 0, 0, 16140 }, //  
+    { 0, 0, 33, 0, 0, 0, 16140 }, //  
+    { 0, 0, 11, 0, 0, 0, 16140 }, //  
+    { 0, 0, 8, 0, 0, 0, 16140 }, //  
+    { 0, 0, 5, 0, 0, 0, 16140 }, //  
+    { 0, 0, 21, 0, 0, 0, 16140 }, //  
+    { 0, 0, 10, 0, 0, 0, 16140 }, //  
+    { 0, 0, 7, 0, 0, 0, 16140 }, //  
+    { 0, 0, 2, 0, 0, 0, 16140 }, //  
+    { 0, 0, 0, 0, 0, 0, 16140 }, // ​
+    { 2, 28, 0, -1, 20, 14, 16140 }, // ‌
+    { 8, 30, 0, -4, 22, 60, 16154 }, // ‍
+    { 12, 31, 0, -6, 23, 93, 16214 }, // ‎
+    { 12, 31, 0, -6, 23, 93, 16307 }, // ‏
+    { 11, 5, 13, 1, 11, 14, 16400 }, // ‐
+    { 11, 5, 13, 1, 11, 14, 16414 }, // ‑
+    { 17, 4, 21, 2, 13, 17, 16428 }, // ‒
+    { 17, 5, 17, 0, 11, 22, 16823 }, // –
+    { 33, 5, 33, 0, 11, 42, 16845 }, // —
+    { 33, 5, 33, 0, 11, 42, 16445 }, // ―
+    { 12, 34, 17, 2, 26, 102, 16487 }, // ‖
+    { 17, 9, 17, 0, -1, 39, 16589 }, // ‗
+    { 7, 11, 8, 1, 25, 20, 16887 }, // ‘
+    { 7, 11, 8, 0, 25, 20, 16907 }, // ’
+    { 7, 11, 8, 0, 5, 20, 16628 }, // ‚
+    { 7, 11, 8, 1, 25, 20, 16648 }, // ‛
+    { 13, 11, 15, 1, 25, 36, 16927 }, // “
+    { 14, 11, 15, 0, 25, 39, 16963 }, // ”
+    { 14, 11, 15, 0, 5, 39, 16668 }, // „
+    { 13, 11, 15, 1, 25, 36, 16707 }, // ‟
+    { 15, 22, 16, 1, 24, 83, 16743 }, // †
+    { 15, 26, 16, 1, 24, 98, 16826 }, // ‡
+    { 8, 8, 10, 1, 13, 16, 16924 }, // •
+    { 12, 12, 21, 4, 17, 36, 16940 }, // ‣
+    { 7, 6, 10, 1, 5, 11, 16976 }, // ․
+    { 15, 6, 17, 1, 5, 23, 16987 }, // ‥
+    { 29, 6, 33, 2, 5, 44, 17002 }, // …
+    { 7, 6, 10, 1, 12, 11, 17010 }, // ‧
+    { 0, 0, 0, 0, 0, 0, 17021 }, //  
+    { 0, 0, 0, 0, 0, 0, 17021 }, //  
+    { 12, 31, 0, -6, 23, 93, 17021 }, // ‪
+    { 12, 31, 0, -6, 23, 93, 17114 }, // ‫
+    { 10, 31, 0, -5, 23, 78, 17207 }, // ‬
+    { 14, 31, 0, -7, 23, 109, 17285 }, // ‭
+    { 14, 31, 0, -7, 23, 109, 17394 }, // ‮
+    { 0, 0, 4, 0, 0, 0, 17503 }, //  
+    { 44, 27, 46, 1, 25, 297, 17503 }, // ‰
+    { 9, 11, 9, 0, 23, 25, 17800 }, // ′
+    { 16, 11, 16, 0, 23, 44, 17825 }, // ″
+    { 23, 11, 23, 0, 23, 64, 17869 }, // ‴
+    { 9, 11, 9, 0, 23, 25, 17933 }, // ‵
+    { 15, 11, 17, 1, 23, 42, 17958 }, // ‶
+    { 22, 11, 24, 1, 23, 61, 18000 }, // ‷
+    { 14, 7, 16, 1, 0, 25, 18061 }, // ‸
+    { 9, 13, 11, 1, 15, 30, 18086 }, // ‹
+    { 9, 13, 11, 1, 15, 30, 18116 }, // ›
+    { 21, 23, 21, 0, 22, 121, 18146 }, // ※
+    { 16, 26, 19, 2, 25, 104, 18267 }, // ‼
+    { 17, 4, 17, 0, 28, 17, 18371 }, // ‾
+    { 8, 5, 10, 1, 11, 10, 18388 }, // ⁃
+    { 18, 28, 6, -6, 25, 126, 18398 }, // ⁄
+    { 28, 26, 31, 2, 25, 182, 18524 }, // ⁇
+    { 23, 26, 25, 2, 25, 150, 18706 }, // ⁈
+    { 22, 26, 25, 2, 25, 143, 18856 }, // ⁉
+    { 20, 7, 33, 6, 13, 35, 18999 }, // ⁓
+    { 30, 11, 31, 0, 23, 83, 19034 }, // ⁗
+    { 0, 0, 7, 0, 0, 0, 19117 }, //  
+    { 0, 0, 0, 0, 0, 0, 19117 }, // ⁠
+    { 0, 0, 0, 0, 0, 0, 19117 }, // ⁡
+    { 0, 0, 0, 0, 0, 0, 19117 }, // ⁢
+    { 0, 0, 0, 0, 0, 0, 19117 }, // ⁣
+    { 0, 0, 0, 0, 0, 0, 19117 }, // ⁤
+    { 15, 17, 15, 0, 28, 64, 19117 }, // ⁰
+    { 14, 17, 15, 0, 28, 60, 19181 }, // ⁴
+    { 11, 16, 15, 2, 27, 44, 19241 }, // ⁵
+    { 13, 17, 15, 1, 28, 56, 19285 }, // ⁶
+    { 12, 16, 15, 2, 27, 48, 19341 }, // ⁷
+    { 13, 17, 15, 1, 28, 56, 19389 }, // ⁸
+    { 13, 17, 15, 1, 28, 56, 19445 }, // ⁹
+    { 15, 11, 19, 2, 23, 42, 19501 }, // ⁿ
+    { 15, 16, 15, 0, 11, 60, 19543 }, // ₀
+    { 11, 16, 15, 2, 11, 44, 19603 }, // ₁
+    { 13, 16, 15, 1, 11, 52, 19647 }, // ₂
+    { 12, 16, 15, 1, 11, 48, 19699 }, // ₃
+    { 14, 16, 15, 0, 11, 56, 19747 }, // ₄
+    { 11, 16, 15, 2, 11, 44, 19803 }, // ₅
+    { 13, 16, 15, 1, 11, 52, 19847 }, // ₆
+    { 12, 16, 15, 2, 11, 48, 19899 }, // ₇
+    { 13, 16, 15, 1, 11, 52, 19947 }, // ₈
+    { 13, 16, 15, 1, 11, 52, 19999 }, // ₉
+    { 19, 23, 21, 1, 23, 110, 20051 }, // ₣
+    { 20, 24, 21, 0, 23, 120, 20161 }, // ₤
+    { 44, 24, 45, 0, 23, 264, 20281 }, // ₧
+    { 21, 24, 21, 0, 23, 126, 20545 }, // €
+    { 21, 15, 33, 6, 19, 79, 20671 }, // ←
+    { 15, 21, 33, 9, 22, 79, 20750 }, // ↑
+    { 21, 15, 33, 6, 19, 79, 20829 }, // →
+    { 15, 21, 33, 9, 22, 79, 20908 }, // ↓
+    { 21, 15, 33, 6, 19, 79, 20987 }, // ↔
+    { 15, 23, 33, 9, 23, 87, 21066 }, // ↕
+    { 15, 23, 33, 9, 23, 87, 21153 }, // ↨
+    { 15, 23, 33, 9, 23, 87, 21240 }, // ↲
+    { 15, 23, 33, 9, 23, 87, 21327 }, // ↳
+    { 19, 18, 33, 7, 20, 86, 21414 }, // ↵
+    { 21, 19, 33, 6, 21, 100, 21500 }, // ⇐
+    { 19, 21, 33, 7, 22, 100, 21600 }, // ⇑
+    { 21, 19, 33, 6, 21, 100, 21700 }, // ⇒
+    { 19, 21, 33, 7, 22, 100, 21800 }, // ⇓
+    { 21, 17, 33, 6, 20, 90, 21900 }, // ⇔
+    { 23, 24, 33, 5, 23, 138, 21990 }, // ∀
+    { 18, 27, 21, 1, 26, 122, 22128 }, // ∂
+    { 17, 23, 33, 8, 23, 98, 22250 }, // ∃
+    { 25, 27, 33, 4, 25, 169, 22348 }, // ∅
+    { 22, 24, 23, 0, 24, 132, 22517 }, // ∆
+    { 21, 24, 33, 6, 23, 126, 22649 }, // ∇
+    { 23, 23, 33, 5, 23, 133, 22775 }, // ∈
+    { 23, 29, 33, 5, 26, 167, 22908 }, // ∉
+    { 23, 20, 33, 5, 21, 115, 23075 }, // ∊
+    { 23, 23, 33, 5, 23, 133, 23190 }, // ∋
+    { 23, 29, 33, 5, 26, 167, 23323 }, // ∌
+    { 23, 20, 33, 5, 21, 115, 23490 }, // ∍
+    { 26, 29, 28, 1, 23, 189, 23605 }, // ∏
+    { 21, 29, 22, 1, 23, 153, 23794 }, // ∑
+    { 15, 4, 21, 3, 13, 15, 23947 }, // −
+    { 16, 26, 17, 1, 24, 104, 23962 }, // ∕
+    { 16, 26, 17, 1, 24, 104, 24066 }, // ∖
+    { 16, 16, 21, 2, 19, 64, 24170 }, // ∗
+    { 13, 12, 21, 4, 17, 39, 24234 }, // ∘
+    { 7, 6, 21, 7, 12, 11, 24273 }, // ∙
+    { 22, 31, 21, -1, 27, 171, 24284 }, // √
+    { 17, 13, 21, 2, 17, 56, 24455 }, // ∝
+    { 21, 13, 21, 0, 17, 69, 24511 }, // ∞
+    { 21, 23, 33, 6, 23, 121, 24580 }, // ∟
+    { 25, 23, 33, 4, 23, 144, 24701 }, // ∠
+    { 5, 34, 17, 6, 26, 43, 24845 }, // ∣
+    { 12, 34, 17, 2, 26, 102, 24888 }, // ∥
+    { 23, 23, 33, 5, 23, 133, 24990 }, // ∧
+    { 23, 23, 33, 5, 23, 133, 25123 }, // ∨
+    { 19, 24, 33, 7, 24, 114, 25256 }, // ∩
+    { 19, 24, 33, 7, 23, 114, 25370 }, // ∪
+    { 19, 34, 21, 1, 26, 162, 25484 }, // ∫
+    { 23, 20, 33, 5, 19, 115, 25646 }, // ∴
+    { 23, 20, 33, 5, 19, 115, 25761 }, // ∵
+    { 7, 19, 10, 2, 21, 34, 25876 }, // ∶
+    { 23, 20, 33, 5, 19, 115, 25910 }, // ∷
+    { 20, 7, 33, 6, 13, 35, 26025 }, // ∼
+    { 20, 18, 33, 6, 20, 90, 26060 }, // ≅
+    { 17, 14, 21, 2, 18, 60, 26150 }, // ≈
+    { 19, 13, 33, 7, 16, 62, 26210 }, // ≍
+    { 15, 16, 21, 3, 19, 60, 26272 }, // ≠
+    { 19, 16, 33, 7, 18, 76, 26332 }, // ≡
+    { 15, 20, 21, 3, 20, 75, 26408 }, // ≤
+    { 15, 21, 21, 3, 21, 79, 26483 }, // ≥
+    { 27, 16, 33, 3, 19, 108, 26562 }, // ≪
+    { 27, 16, 33, 3, 19, 108, 26670 }, // ≫
+    { 23, 20, 33, 5, 21, 115, 26778 }, // ⊃
+    { 23, 29, 33, 5, 26, 167, 26893 }, // ⊄
+    { 23, 29, 33, 5, 26, 167, 27060 }, // ⊅
+    { 21, 23, 33, 6, 23, 121, 27227 }, // ⊆
+    { 21, 23, 33, 6, 23, 121, 27348 }, // ⊇
+    { 25, 25, 33, 4, 24, 157, 27469 }, // ⊕
+    { 25, 25, 33, 4, 24, 157, 27626 }, // ⊖
+    { 25, 25, 33, 4, 24, 157, 27783 }, // ⊗
+    { 25, 25, 33, 4, 24, 157, 27940 }, // ⊘
+    { 19, 23, 33, 7, 23, 110, 28097 }, // ⊥
+    { 7, 6, 21, 7, 12, 11, 28207 }, // ⋅
+    { 29, 6, 33, 2, 12, 44, 28218 }, // ⋯
+    { 29, 26, 26, 0, 26, 189, 28262 }, // ﬀ
+    { 23, 26, 23, 0, 26, 150, 28451 }, // ﬁ
+    { 23, 26, 23, 0, 26, 150, 28601 }, // ﬂ
+    { 34, 26, 34, 0, 26, 221, 28751 }, // ﬃ
+    { 34, 26, 34, 0, 26, 221, 28972 }, // ﬄ
+    { 26, 27, 26, 0, 26, 176, 29193 }, // ﬅ
+    { 30, 27, 31, 1, 26, 203, 29369 }, // ﬆ
+    { 31, 32, 33, 1, 28, 248, 29572 }, // �
 };
 
 static const EpdUnicodeInterval bookerly_16_boldIntervals[] = {
@@ -2838,32 +2940,331 @@ static const EpdUnicodeInterval bookerly_16_boldIntervals[] = {
     { 0x22A5, 0x22A5, 0x2E7 },
     { 0x22C5, 0x22C5, 0x2E8 },
     { 0x22EF, 0x22EF, 0x2E9 },
-    { 0xFFFD, 0xFFFD, 0x2EA },
+    { 0xFB00, 0xFB06, 0x2EA },
+    { 0xFFFD, 0xFFFD, 0x2F1 },
 };
 
 static const EpdFontGroup bookerly_16_boldGroups[] = {
-    { 0, 4759, 9826, 100, 0 },
-    { 4759, 4463, 12115, 96, 100 },
-    { 9222, 5754, 19200, 128, 196 },
-    { 14976, 467, 587, 33, 324 },
-    { 15443, 10676, 32015, 220, 357 },
-    { 26119, 1571, 3200, 74, 577 },
-    { 27690, 617, 934, 18, 651 },
-    { 28307, 373, 620, 4, 669 },
-    { 28680, 709, 1319, 15, 673 },
-    { 29389, 2685, 6272, 58, 688 },
-    { 32074, 130, 248, 1, 746 },
+    { 0, 6278, 17046, 151, 5 },
+    { 6278, 3920, 8797, 66, 358 },
+    { 10198, 10941, 31983, 263, 0 },
+    { 21139, 12578, 29820, 274, 473 },
+};
+
+static const uint8_t bookerly_16_boldGlyphGroups[754] = {
+    2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0,
+    2, 2, 2, 2, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0,
+    0, 2, 2, 2, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0,
+    0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 3, 3, 3, 0, 0, 3, 3, 0, 0, 3,
+    3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+};
+
+static const uint8_t bookerly_16_boldKernLeftClasses[754] = {
+    0, 0, 0, 0, 0, 0, 0, 92, 0, 0, 0, 0, 92, 68, 0, 72,
+    0, 5, 23, 5, 28, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 130, 2, 120, 83, 14, 100, 62, 78, 60, 60, 38,
+    66, 33, 114, 20, 14, 63, 71, 32, 53, 13, 4, 9, 9, 82, 3, 102,
+    79, 55, 0, 0, 0, 0, 35, 15, 85, 76, 43, 25, 36, 24, 76, 115,
+    59, 73, 24, 24, 15, 15, 112, 26, 77, 91, 49, 12, 12, 119, 12, 126,
+    75, 0, 0, 0, 0, 117, 0, 0, 0, 0, 0, 0, 0, 0, 0, 84,
+    0, 23, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 56,
+    0, 0, 0, 46, 2, 2, 2, 2, 2, 2, 100, 83, 100, 100, 100, 100,
+    60, 60, 60, 60, 14, 20, 14, 14, 14, 14, 14, 0, 88, 4, 4, 4,
+    4, 3, 57, 98, 35, 35, 35, 35, 35, 35, 43, 85, 43, 43, 43, 43,
+    76, 76, 30, 30, 15, 24, 15, 15, 15, 15, 15, 0, 15, 49, 49, 49,
+    49, 12, 15, 12, 2, 35, 2, 35, 52, 89, 83, 85, 83, 85, 83, 85,
+    83, 85, 14, 27, 14, 128, 100, 43, 100, 43, 100, 43, 131, 111, 100, 43,
+    78, 36, 78, 36, 78, 36, 78, 36, 60, 24, 60, 24, 60, 30, 60, 30,
+    60, 30, 60, 109, 60, 76, 38, 115, 38, 101, 66, 59, 59, 33, 73, 33,
+    73, 0, 27, 0, 0, 33, 90, 20, 24, 20, 24, 20, 24, 24, 20, 24,
+    14, 15, 14, 15, 14, 15, 100, 43, 32, 26, 32, 26, 32, 26, 53, 77,
+    53, 77, 53, 77, 53, 77, 13, 91, 13, 135, 13, 91, 4, 49, 4, 49,
+    4, 49, 4, 49, 4, 49, 4, 104, 9, 12, 3, 12, 3, 102, 126, 102,
+    126, 102, 126, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 107, 107, 74, 0, 133, 96, 17, 17, 47, 16, 16,
+    54, 8, 17, 1, 17, 19, 110, 48, 11, 31, 107, 8, 48, 17, 17, 8,
+    17, 99, 17, 7, 17, 37, 116, 11, 1, 67, 51, 31, 17, 17, 31, 16,
+    17, 16, 7, 7, 17, 58, 10, 125, 34, 50, 64, 40, 81, 80, 80, 40,
+    80, 80, 80, 10, 80, 10, 118, 34, 21, 10, 97, 50, 80, 80, 50, 29,
+    80, 29, 10, 10, 80, 64, 64, 87, 34, 100, 124, 121, 105, 0, 29, 29,
+    70, 40, 80, 21, 80, 106, 108, 7, 10, 42, 93, 31, 50, 16, 29, 37,
+    10, 41, 95, 39, 34, 0, 0, 44, 86, 48, 81, 44, 86, 8, 40, 8,
+    40, 8, 40, 31, 50, 0, 0, 0, 0, 113, 122, 116, 118, 11, 34, 22,
+    21, 22, 21, 61, 94, 31, 50, 31, 50, 17, 80, 65, 70, 123, 64, 123,
+    64, 17, 8, 40, 132, 129, 31, 50, 47, 103, 31, 50, 17, 80, 31, 50,
+    127, 19, 58, 19, 58, 107, 64, 107, 64, 7, 10, 7, 10, 8, 40, 48,
+    81, 134, 80, 17, 80, 17, 80, 7, 10, 7, 10, 7, 10, 7, 10, 1,
+    21, 1, 21, 1, 21, 17, 80, 11, 34, 17, 80, 39, 34, 69, 94, 51,
+    97, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 23, 23, 0, 23, 23, 23, 0, 0, 6, 18, 45, 6, 6, 18, 5,
+    6, 0, 0, 0, 0, 0, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 84, 56, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 25, 76, 73, 76, 73, 91,
+    91, 0,
+};
+
+static const uint8_t bookerly_16_boldKernRightClasses[754] = {
+    0, 0, 0, 0, 0, 0, 0, 66, 0, 0, 0, 0, 66, 0, 75, 46,
+    0, 34, 10, 3, 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 102,
+    101, 0, 0, 0, 36, 0, 2, 40, 6, 40, 40, 40, 6, 40, 40, 69,
+    40, 40, 108, 40, 6, 40, 6, 40, 73, 24, 21, 22, 22, 97, 14, 116,
+    0, 28, 105, 0, 0, 0, 16, 88, 1, 1, 1, 87, 27, 18, 96, 91,
+    18, 18, 48, 48, 1, 106, 1, 48, 35, 47, 26, 12, 12, 67, 8, 63,
+    0, 0, 99, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 43,
+    0, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 70,
+    0, 0, 0, 109, 2, 2, 2, 2, 2, 2, 49, 6, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 6, 6, 6, 6, 6, 0, 94, 21, 21, 21,
+    21, 14, 40, 90, 16, 16, 16, 71, 78, 16, 16, 1, 1, 1, 1, 77,
+    111, 96, 62, 29, 1, 48, 1, 1, 1, 1, 1, 0, 81, 26, 26, 26,
+    26, 8, 89, 8, 2, 82, 2, 79, 2, 16, 6, 1, 6, 1, 6, 1,
+    6, 1, 40, 1, 40, 1, 40, 1, 40, 1, 40, 1, 40, 1, 40, 1,
+    6, 27, 6, 64, 6, 27, 6, 27, 40, 18, 40, 84, 40, 29, 40, 29,
+    40, 29, 40, 96, 40, 96, 40, 96, 69, 60, 40, 18, 48, 40, 18, 40,
+    18, 40, 18, 40, 18, 40, 68, 40, 48, 40, 48, 40, 48, 48, 40, 48,
+    6, 1, 6, 1, 6, 1, 6, 1, 40, 48, 40, 48, 40, 104, 73, 35,
+    73, 74, 73, 35, 73, 72, 24, 47, 24, 47, 24, 47, 21, 26, 21, 26,
+    21, 26, 21, 26, 21, 26, 21, 26, 22, 12, 14, 8, 14, 116, 63, 116,
+    63, 116, 95, 90, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 50, 50, 13, 50, 15, 107, 50, 50, 92, 45, 50,
+    13, 50, 50, 32, 50, 23, 50, 50, 50, 56, 50, 39, 61, 50, 50, 50,
+    45, 103, 50, 15, 50, 50, 15, 13, 32, 59, 58, 50, 25, 50, 50, 13,
+    50, 50, 114, 50, 80, 38, 100, 7, 7, 53, 4, 44, 55, 7, 7, 7,
+    31, 7, 7, 4, 7, 86, 4, 9, 20, 4, 41, 7, 11, 7, 7, 9,
+    7, 7, 98, 7, 52, 4, 4, 65, 7, 4, 85, 112, 83, 93, 31, 7,
+    65, 7, 7, 30, 7, 13, 9, 15, 4, 57, 20, 50, 7, 117, 115, 50,
+    86, 50, 7, 50, 7, 50, 7, 39, 44, 61, 55, 50, 7, 50, 7, 0,
+    0, 13, 9, 50, 7, 50, 7, 50, 7, 15, 4, 15, 4, 13, 9, 42,
+    20, 42, 20, 58, 41, 0, 9, 25, 11, 25, 11, 50, 65, 33, 19, 33,
+    19, 50, 39, 44, 50, 7, 45, 31, 50, 7, 50, 7, 25, 11, 0, 7,
+    65, 23, 38, 23, 38, 51, 38, 50, 4, 110, 76, 0, 76, 39, 44, 61,
+    55, 0, 113, 50, 7, 50, 7, 15, 4, 15, 4, 15, 4, 0, 55, 32,
+    30, 32, 54, 32, 30, 0, 11, 50, 7, 50, 7, 50, 7, 58, 41, 58,
+    41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 10, 10, 0, 10, 10, 10, 0, 0, 5, 17, 3, 5, 5, 17, 3,
+    5, 0, 0, 0, 0, 0, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 43, 70, 0, 0, 0, 0, 0,
+    36, 36, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 87, 87, 87, 87, 87, 87,
+    35, 0,
+};
+
+static const int8_t bookerly_16_boldKernMatrix[16048] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -4, -4, 0, 0, -3, 0, -2, -2, -2, 0, 0, 0, -2, 0, 1, 0, -4, -1, 0, 0, -6, 0, 0, 0, 0, 0, 0, -1, -3, 1, -1, -4, 0, 0, -3, -3, -1, 0, -2, 1, -3, -3, -3, 0, 0, 0, 0, 0, -6, -5, -4, -1, -3, -3, 0, 0, -2, 0, -2, 0, 0, 0, 1, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -3, 0, 0, 0, -3, 0, 0, 2, 0, -3, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, -2, 0, 0, 0, -2, 0, 0, -1, 0, 0, 0, -1, 1, 0, 0,
+    0, 0, 1, 0, 0, -4, 0, 0, -3, 0, -1, 0, -3, 0, -3, 0, 0, -3, 0, 0, 0, -2, -4, 0, -4, 0, -1, 0, -3, 0, 0, 0, 0, 0, 0, 0, -2, 1, 0, 0, 0, 0, 0, -1, 0, 0, -3, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -3, -4, -3, 0, 0, -2, 0, -1, 0, -2, 0, -1, 0, 1, 0, -3, 1, 1, 0, 0, 0, 0, 0, 0, 0, -1, -3, 0, 2, 0, 0, 0, 0, -3, -3, 0, -4, 0, 0, 0, 0, 0, -2, 0, 0, 1, 0, -2, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 2, -2, -3, 0, 0, -2, 1, 0, -1, -3, -3, -2, -3, 0, 0, -3, -1, -1, 0, -3, -1, 0, 1, 0, 0, 0, 1, 1, 0, 0, 0, 0, -2, -2, 0, 0, 0, 1, 0, -1, -1, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, -1, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, -1, -1, 0, 0, -1, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, -3, -1, 0, -3, -2, 0, -2, -3, -3, -3, -1, 0, -1, 0, -1, -2, -1, -4, 1, -3, -3, -1, 0, 0, 0, -2, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 1, -3, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -2, 0, 0, -4, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -3, -3, -1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 0, 1, 0, 1, 0, 1, -3, 1, 0, 0, -2, 0, 1, 1, -1, 1, 0, -3, -1, 0, 0, 0, 0, 0, 1, 1, 0, 0, -2, 0, 0, 0, -4, 0, -4, -2, -1, 1, 0, -2, 1, 0, 0, 1, 0, 1, 0, -2, 1, 0, 1, 1, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, -1, -1, 0, 1, 1, -1, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, -1, -1, 0, -2, 0, 0, -1, 0, -2, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, -2, -1, -1, 0, 0, -2, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, -1, 0, 0, 0, -2, -1, -2, 0, -1, 0, -2, 0, 0, 0, -3, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, -2, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -1, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, -5, -4, 0, 0, -2, 0, -1, 0, -2, 0, -1, 0, 1, 0, -2, 1, 1, 0, 0, 0, 0, 0, 0, 0, -1, -3, 0, 2, 0, 0, 0, 0, -4, -2, 0, -4, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, -1, -5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, -1, -2, 0, 0, -1, 1, 0, -1, -2, -2, -1, -2, 0, 0, -2, -1, -2, 0, -2, -1, 0, 1, 0, 0, -1, 1, 1, 0, 0, 0, 0, -2, -1, 0, 0, 0, 1, 0, -1, -1, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -3, -2, 1, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 1, 0, -3, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0, -3, 0, -1, -3, 0, 0, -4, -2, -1, 0, 0, 0, -1, 0, -3, 0, 0, 0, 0, 0, -3, -3, -3, 0, -1, -3, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, 0, 1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, -3, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -3, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, -1, 0, -1, 0, 0, -1, -1, -1, 0, -1, -1, 0, -1, 0, 0, 0, -1, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, -4, -3, 0, 1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 1, 0, 0, 0, 0, -3, -2, 0, -4, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, -2, 0, 0, 0, 0, 0, -1, -2, -2, 0, -2, 0, 0, -2, -2, -2, 0, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, -1, 0, 0, 0, -1, 1, -1, 0, -2, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -3, 0, 0, -2, 0, -1, 0, -2, -1, 0, 0, 0, 0, 1, -1, 0, -1, -3, 0, -1, 0, -2, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, -4, -3, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1, -1, -1, 0, 1, -1, 0, 0, 1, -4, 0, 0, 0, -3, 0, 1, 0, -2, 0, 0, -3, -2, 0, 0, -1, -1, 0, 0, 1, 0, 0, -2, 0, 0, 0, -6, 0, -6, -2, -2, 0, 0, -3, 1, 0, 0, 1, 0, 1, -1, -3, 1, 0, 0, 1, 0, 0, -1, -2, -1, -2, 0, 0, -2, -1, -1, -1, -2, -1, 1, 1, -2, 0, 0, 1, 1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -4, 0, 0, 0, -2, -1, -2, 0, -4, 0, 0, 0, -3, 0, -2, -1, 0, 0, 1, 0, -4, 0, 0, -3, 0, -1, 1, -2, -3, 0, 0, -2, 1, 0, 0, 0, 1, -3, -1, 0, 0, -3, 0, 0, 0, 0, 1, 0, 0, -1, 0, 1, -4, 0, -2, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, -1, 0, 2, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, 0, -1, 0, 0, 0, 1, 0, 0, -1, -1, 0, -1, 0, 0, 0, -1, -1, 0, 0, -1, 0, 1, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -3, -1, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -3, 0, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, -3, -2, 0, 0, -1, 0, -2, -2, -1, 0, 0, 0, -2, 0, 1, 0, -2, -1, 0, 0, -3, 0, 0, 0, 0, 0, 0, -1, -2, 1, -2, -3, 0, 0, -4, -2, -1, 0, -2, 1, -2, -2, -2, 1, 0, 0, 0, 0, -3, -3, -2, -1, -2, -2, 1, 0, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, 0, 2, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 1, 0, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, -2, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, -2, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -2, 0, 0, -2, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 3, 4, 0, 0, 0, 0, -1, -1, 2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 3, 0, 0, 0, 3, 0, 0, 0, 0, 1, 1, 0, 1, 3, 0, 1, 2, 1, 0, 0, 1, 0, 4, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 2, 1, 0, 0, 3, 0, 0, 0, 0, 1, 3, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, -2, 0, 1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -2, -1, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, -1, 0, -1, 0, 0, -1, -1, -1, 0, -1, -1, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 2, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 3, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 1, 4, 0, 0, 0, 1, 0, 0, 3, 0, 0, 1, 0, 0, 0, 0, 0, 4, 0, 0, 1, 4, 4, 0, 2, 0, 0, 0, 1, 2, 0, 0, 3, 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0,
+    0, -3, -3, 0, -3, 0, -1, -1, -1, -1, 0, 0, -1, 0, 0, -1, -3, 0, 0, -1, -1, 0, 0, -3, 0, 0, -1, -3, 0, 1, -1, -2, 0, 0, 0, -3, 0, 0, -3, 0, 0, -1, 0, 0, -2, -1, 0, 0, -2, -5, 0, -5, -3, -4, -1, -1, -1, 0, 0, -1, 0, 0, 1, -1, -3, 0, 0, -1, 0, 0, 0, -3, -3, -1, -3, 0, 0, -3, -3, -3, 0, -3, -3, 1, 0, -3, -2, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, -2, 0, -2, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, -2, 0, 0, 0, 0, 0, -1, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, -4, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, -2, -1, 0, -1, 0, -1, 0, -1, 0, -2, 0, 0, -1, 0, 0, 0, -1, -2, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, -2, 0, 0, -2, 0, 0, 0, -2, 0, -3, 0, 0, -1, 0, 0, 0, -1, -3, 0, -2, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -3, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, -4, 0, 0, 0, 0, 0, 0, 1, -1, 0, 0, -3, 0, 0, -3, 0, -1, 0, 0, 0, 0, 0, -2, 2, 0, 0, 0, 0, -4, -2, -2, 1, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, -1, 0, 0, 0, -1, -1, 0, -1, 0, 0, -1, -1, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, -2, 0, 0, -3, -1, 0, 0, 0, 0, 0, 0, -2, 1, 0, 0, 0, 0, -4, -2, -2, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, -2, 1, 0, -2, 0, -2, 0, -2, 0, 0, 0, -1, 0, 0, 0, -4, -1, 0, 0, -4, 0, 0, 0, 0, 0, 0, -1, -2, 0, -3, -1, 0, 0, -3, -3, -1, 0, -1, 0, 0, -2, -2, 1, 0, 0, 0, 0, -4, -3, -3, -1, -2, -3, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -2, 0, 0, 0, 0, -3, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0,
+    0, 0, 0, -3, -3, 1, 0, -1, 0, -1, -2, -1, 0, 0, 0, -1, 0, 1, 0, -3, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0, -2, 1, -2, -3, 0, 0, 0, -2, -1, 0, -1, 1, -1, -2, -3, 0, 0, 0, 0, 0, -5, -3, -3, 0, -2, -4, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, -1, 0, 0, 0, -2, 0, -2, 0, -1, 0, -1, 0, 0, 0, -3, 1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 1, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 1, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, -3, -1, 0, -1, -2, 0, -2, -3, -3, -3, -1, 0, -1, 0, -1, -1, -1, -4, 1, -3, -3, -1, 0, 0, 0, -1, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 1, -3, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -4, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, -1, -2, -1, -1, 0, -1, 0, -1, -1, -2, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, -1, 1, 0, -1, -1, 0, -1, 0, 0, -1, -1, -1, 0, -1, -1, 0, -1, -1, 0, -1, -1, -1, -1, 1, 1, 1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -2, -1, -1, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, -2, 0, 0, 0, -1, 0, 0, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, -1, 0, 1, 0, 1, -2, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, -4, 0, 0, -3, 0, -1, 0, -3, 0, -3, 0, 0, -3, 0, 0, 0, -2, -4, 0, -4, 0, -1, 0, -3, 0, 0, 0, 0, 0, 0, 0, -2, 1, 0, 0, 0, 0, 0, -1, 0, 0, -3, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -2, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -2, 0, 0, 0, -1, 0, -2, 0, -2, 0, -1, 0, -2, 0, -2, -3, 0, 0, 0, 0, -4, 0, 0, -5, 0, -3, 0, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, -3, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, -1, 0, -1, 0, -1, -1, 0, -1, -1, -3, -3, -1, 0, 0, 0, 0, -1, -2, -3, 0, -3, -3, -1, 1, 0, 0, -1, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -3, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, -1, 0, -2, 0, -1, 0, 0, 0, 0, -2, -1, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -3, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, -1, -2, 0, -1, 0, 0, -1, -2, 0, 0, 0, 0, 0, -3, 0, -1, -4, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -3, 0, -1, 1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, -2, 0, 0, 0, -1, 0, 0, 0, -2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 0, -2, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 1, 0, 1, 0, 0, 0, 0, 1, 1, 1, 2, 0, 1, 0, 1, -2, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0,
+    0, -1, -3, -2, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, -2, -1, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, -1, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, -1, -1, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -4, -3, 0, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, 0, 1, 0, 0, 0, 0, -3, -1, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, -1, 0, 1, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2, 0, -3, 0, -1, 0, 0, 0, -1, -2, 0, 0, 0, 0, -4, 0, 0, -5, 0, -2, 0, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -3, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 1, 0, 0, 0, -1, 0, -2, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, -2, 0, 0, -2, 0, -2, 0, 0, -1, 0, 0, -2, 0, 0, 0, 0, -1, -2, -1, -1, 0, 0, -3, -1, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0,
+    0, -1, 0, 0, -1, 0, -1, 0, 1, 0, 0, 0, 1, 0, 0, -1, -1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 2, 0, 1, 0, 0, 0, 0, 0, 0, 2, 0, -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, -1, 1, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, -2, -1, -2, 0, 0, 0, -1, 0, 0, 0, -3, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 1, 0, -2, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, -1, 0, 1, 0, 1, -2, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -3, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0,
+    0, 0, -1, -2, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 3, 0, 0, 0, 0, 0, -1, 0, 2, 0, 1, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -3, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, -3, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -2, 0, 0, 0, -4, 0, -4, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -2, 0, 0, -3, 0, -1, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 2, 0, 1, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 2, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 2, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 1, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -3, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0,
+    0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -2, -1, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t bookerly_16_boldGlyphLookup[368] = {
+    0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0001, 0x0002, 0xFFFF, 0xFFFF, 0xFFFF, 0x0003, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0004, 0xFFFF, 0xFFFF,
+    0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, 0x0010, 0x0011, 0x0012, 0x0013, 0x0014,
+    0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, 0x0020, 0x0021, 0x0022, 0x0023, 0x0024,
+    0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, 0x0030, 0x0031, 0x0032, 0x0033, 0x0034,
+    0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, 0x0040, 0x0041, 0x0042, 0x0043, 0x0044,
+    0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051, 0x0052, 0x0053, 0x0054,
+    0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, 0x0060, 0x0061, 0x0062, 0x0063, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x0072, 0x0073,
+    0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, 0x0080, 0x0081, 0x0082, 0x0083,
+    0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F, 0x0090, 0x0091, 0x0092, 0x0093,
+    0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F, 0x00A0, 0x00A1, 0x00A2, 0x00A3,
+    0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF, 0x00B0, 0x00B1, 0x00B2, 0x00B3,
+    0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF, 0x00C0, 0x00C1, 0x00C2, 0x00C3,
+    0x0241, 0x0242, 0x0243, 0x0244, 0x0245, 0x0246, 0x0247, 0x0248, 0x0249, 0x024A, 0x024B, 0x024C, 0x024D, 0x024E, 0x024F, 0x0250,
+    0x0251, 0x0252, 0x0253, 0x0254, 0x0255, 0x0256, 0x0257, 0x0258, 0x0259, 0x025A, 0x025B, 0x025C, 0x025D, 0x025E, 0x025F, 0x0260,
+    0x0261, 0x0262, 0x0263, 0x0264, 0x0265, 0x0266, 0x0267, 0x0268, 0x0269, 0x026A, 0x026B, 0x026C, 0x026D, 0x026E, 0x026F, 0x0270,
+    0x0271, 0xFFFF, 0x0272, 0x0273, 0x0274, 0x0275, 0x0276, 0x0277, 0x0278, 0x0279, 0x027A, 0x027B, 0x027C, 0xFFFF, 0x027D, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x027E, 0x027F, 0xFFFF, 0xFFFF, 0x0280, 0x0281, 0x0282, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x0283, 0xFFFF, 0xFFFF, 0xFFFF, 0x0284, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0285,
+    0x0286, 0x0287, 0x0288, 0x0289, 0x028A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
 };
 
 static const EpdFontData bookerly_16_bold = {
     bookerly_16_boldBitmaps,
     bookerly_16_boldGlyphs,
     bookerly_16_boldIntervals,
-    64,
+    65,
     44,
     36,
     -9,
     true,
     bookerly_16_boldGroups,
-    11,
+    4,
+    bookerly_16_boldKernLeftClasses,
+    bookerly_16_boldKernRightClasses,
+    bookerly_16_boldKernMatrix,
+    118,
+    nullptr,
+    0,
+    0,
+    bookerly_16_boldGlyphLookup,
+    bookerly_16_boldGlyphGroups,
+    false,
+    nullptr,
 };
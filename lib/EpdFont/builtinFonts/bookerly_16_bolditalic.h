@@ -3,2296 +3,2376 @@
  * name: bookerly_16_bolditalic
  * size: 16
  * mode: 2-bit  compressed: true
- * Command used: fontconvert.py bookerly_16_bolditalic 16 ../builtinFonts/source/Bookerly/Bookerly-BoldItalic.ttf --2bit --compress
+ * Command used: fontconvert.py bookerly_16_bolditalic 16 ../builtinFonts/source/Bookerly/Bookerly-BoldItalic.ttf --2bit --compress --frequency-corpus ../../../test/hyphenation_eval/resources/english_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/french_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/german_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/italian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/russian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/spanish_hyphenation_tests.txt
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t bookerly_16_bolditalicBitmaps[36538] = {
-    0xAD, 0x5A, 0x4F, 0x8C, 0xDF, 0xC6, 0x79, 0x1D, 0xFE, 0x28, 0x2D, 0x0B, 0xF1, 0xC0, 0x1C, 0xAC,
-    0x22, 0xD5, 0xA2, 0x65, 0x0F, 0x39, 0xB4, 0x76, 0x5B, 0xF6, 0x90, 0x43, 0x03, 0xD8, 0x1D, 0xCA,
-    0x3A, 0xE4, 0xD0, 0x83, 0x05, 0x54, 0x1B, 0x37, 0xF5, 0x41, 0x39, 0x38, 0x80, 0x9D, 0xCB, 0x9E,
-    0x0B, 0x04, 0x21, 0x65, 0x1F, 0x7A, 0xF0, 0x65, 0x5B, 0xD4, 0xE7, 0x08, 0xA8, 0x8A, 0x26, 0x16,
-    0x50, 0xE5, 0x18, 0x14, 0x8E, 0x87, 0xB6, 0x81, 0xEA, 0xD0, 0x83, 0x68, 0xF7, 0xE0, 0x43, 0x0E,
-    0x62, 0x62, 0xCB, 0x45, 0xE2, 0xC3, 0x32, 0x31, 0x1D, 0x71, 0x25, 0x92, 0xD3, 0xF7, 0xDE, 0xF0,
-    0xB7, 0xBB, 0xB2, 0x05, 0xA4, 0x05, 0xBA, 0xD2, 0x72, 0xF7, 0x47, 0x0E, 0x67, 0xBE, 0xF9, 0xFE,
-    0xBC, 0xEF, 0x7D, 0xDF, 0xAC, 0xD9, 0xB9, 0x6E, 0x5C, 0x93, 0xCC, 0xC6, 0xF6, 0xC6, 0xD7, 0xF8,
-    0x99, 0xF7, 0xC6, 0xD5, 0xF1, 0x6C, 0xB2, 0xDE, 0xD8, 0xC6, 0x2C, 0x26, 0x19, 0x4C, 0xDE, 0x18,
-    0x67, 0x36, 0xA3, 0x49, 0x5B, 0x63, 0x8D, 0x39, 0x30, 0xF8, 0x3A, 0x5B, 0x1A, 0x57, 0xC6, 0x8B,
-    0xC9, 0x07, 0x63, 0x6B, 0x73, 0xC5, 0x98, 0xE8, 0xC6, 0x85, 0x8B, 0x73, 0xD1, 0xF8, 0xAC, 0xAF,
-    0x6E, 0x8F, 0xF9, 0xFB, 0x73, 0xDA, 0xFB, 0x78, 0xB2, 0xCD, 0x92, 0x75, 0xF6, 0xD2, 0x90, 0x35,
-    0x53, 0x7C, 0xF0, 0x77, 0x7C, 0x0F, 0xD3, 0x24, 0x9D, 0x31, 0xCB, 0x66, 0x32, 0xC6, 0x96, 0x8B,
-    0xC1, 0xDC, 0xB6, 0x34, 0x69, 0x9F, 0x37, 0xD1, 0xCD, 0xE5, 0xD6, 0x83, 0x03, 0x8F, 0xAF, 0xDE,
-    0xE2, 0x32, 0x99, 0xA2, 0xA9, 0x8C, 0xC9, 0xBA, 0xA2, 0x31, 0xF1, 0x90, 0x75, 0x26, 0x9A, 0xE2,
-    0xC1, 0x9C, 0xF7, 0xDF, 0x58, 0xAE, 0xE4, 0x78, 0xBC, 0xA4, 0x1C, 0x79, 0xF1, 0x85, 0xCF, 0xAE,
-    0xDE, 0x2B, 0x37, 0x53, 0xD2, 0x7F, 0x61, 0xCA, 0xE8, 0x32, 0x44, 0xDC, 0x7E, 0xA5, 0x35, 0x2E,
-    0x03, 0xBE, 0x33, 0x7C, 0x47, 0x18, 0x9C, 0xF8, 0xDA, 0x60, 0x86, 0x72, 0xE3, 0xFD, 0x6C, 0xAA,
-    0xAF, 0xDF, 0xED, 0xB3, 0xEE, 0xC7, 0xCE, 0x2C, 0xD9, 0xD7, 0xBB, 0xFC, 0x57, 0xFD, 0xD3, 0xC6,
-    0x1F, 0x62, 0xA8, 0x87, 0x9C, 0x95, 0xC7, 0x78, 0x0C, 0xC1, 0x0B, 0x03, 0x6F, 0xB5, 0xC6, 0x78,
-    0x1F, 0xF5, 0x79, 0xD1, 0x57, 0x71, 0xE7, 0xD3, 0xE1, 0x99, 0xAC, 0x77, 0xB7, 0xDF, 0x5E, 0x92,
-    0xE5, 0xCD, 0xAA, 0x81, 0xD4, 0x83, 0xE1, 0x7C, 0x7A, 0x61, 0x83, 0xB7, 0xCD, 0x33, 0xF8, 0x4E,
-    0x1A, 0x5C, 0xDE, 0xE4, 0xDA, 0x5B, 0x21, 0xBE, 0xF0, 0x85, 0xA1, 0x29, 0x1E, 0x60, 0xA7, 0xA9,
-    0xEF, 0x4D, 0x3C, 0x19, 0x88, 0x55, 0x1B, 0x2C, 0xED, 0x2E, 0x41, 0x0D, 0xAD, 0x94, 0x90, 0x8C,
-    0x66, 0x33, 0x61, 0x8B, 0xD8, 0x9F, 0x6D, 0x6C, 0x43, 0xAD, 0x8C, 0xF1, 0x04, 0xE3, 0x40, 0xFF,
-    0xB6, 0xA6, 0x84, 0x63, 0xDA, 0x17, 0x75, 0x84, 0x8F, 0x4B, 0xD2, 0xE7, 0x4B, 0xBC, 0xB8, 0x66,
-    0x4A, 0xFD, 0x94, 0x43, 0x9D, 0xCF, 0x2E, 0x55, 0x5B, 0x0D, 0x69, 0x57, 0x5D, 0xC3, 0xDB, 0xD1,
-    0x94, 0x61, 0xB7, 0x41, 0x55, 0x0B, 0x15, 0x9C, 0xB7, 0x79, 0xA7, 0xB9, 0x23, 0xCC, 0x52, 0x95,
-    0x05, 0x66, 0xC7, 0x5D, 0x28, 0x75, 0xA4, 0x28, 0x45, 0x4B, 0x39, 0x4A, 0x6C, 0xAC, 0x31, 0x18,
-    0x97, 0x78, 0x5A, 0xC2, 0x98, 0x73, 0xD7, 0x8D, 0x89, 0xCD, 0x63, 0xBF, 0xD2, 0x85, 0xD7, 0x08,
-    0xDA, 0xC5, 0x8F, 0xDC, 0xEB, 0x13, 0x7C, 0x81, 0x4F, 0xFA, 0x14, 0xBA, 0x97, 0xC0, 0x18, 0x30,
-    0x6F, 0xC2, 0x3D, 0x6C, 0xE5, 0xAB, 0xA6, 0xF8, 0x60, 0x32, 0x70, 0x0C, 0xE7, 0xCB, 0x5D, 0x5F,
-    0x6F, 0x7C, 0xBB, 0x0B, 0x07, 0xA8, 0xA6, 0x8D, 0x5F, 0xCA, 0xD4, 0x0F, 0x19, 0xD6, 0x76, 0x57,
-    0xFB, 0xAF, 0xBD, 0x85, 0x4D, 0xDA, 0x16, 0x6E, 0x60, 0xDB, 0xAA, 0x81, 0x53, 0x7A, 0x78, 0x2C,
-    0x1C, 0x74, 0x8A, 0xFC, 0x6B, 0x3D, 0xFC, 0x56, 0x5A, 0xC3, 0x73, 0x3F, 0x62, 0x41, 0xFC, 0x68,
-    0x21, 0xC4, 0x42, 0xA3, 0x44, 0xF4, 0x95, 0xE5, 0x32, 0x66, 0xFF, 0x07, 0x0F, 0xF9, 0xE1, 0x18,
-    0xB4, 0x2B, 0xBD, 0xF8, 0x00, 0x7E, 0x9B, 0xB7, 0x3E, 0x99, 0xF2, 0xD6, 0xC5, 0x13, 0x7C, 0xB5,
-    0x84, 0xA3, 0x9E, 0xF2, 0x9A, 0x08, 0xE3, 0x0A, 0x98, 0x84, 0x5A, 0x87, 0x92, 0xE8, 0x5C, 0xD8,
-    0x01, 0x6E, 0x66, 0x50, 0x7C, 0x05, 0x1B, 0xCC, 0xE1, 0x0E, 0x14, 0xC4, 0x1D, 0x22, 0x66, 0x4C,
-    0x55, 0x9B, 0xCD, 0xBC, 0x1A, 0xB4, 0xD5, 0x13, 0x7D, 0x1C, 0xC3, 0x40, 0xE8, 0xD6, 0x40, 0x31,
-    0x1B, 0x4C, 0xC1, 0x77, 0x53, 0xBE, 0x34, 0x86, 0xE9, 0xF8, 0x38, 0x3F, 0xF1, 0x59, 0xF3, 0x07,
-    0x46, 0x2B, 0x69, 0xE8, 0x72, 0x6A, 0x38, 0x27, 0xEE, 0xB4, 0xBA, 0xD9, 0xCE, 0xB2, 0xDE, 0x72,
-    0x27, 0x4B, 0xDB, 0x36, 0x3C, 0x9D, 0xC2, 0x13, 0xFC, 0x9A, 0x4C, 0xBA, 0x1B, 0x2D, 0x41, 0x4C,
-    0x08, 0x41, 0x99, 0x5C, 0xA3, 0x49, 0xF1, 0x26, 0xC5, 0x40, 0x74, 0x9B, 0x2F, 0xAD, 0xCB, 0x6F,
-    0x06, 0xF3, 0x23, 0x6F, 0xDE, 0xB2, 0xC6, 0x1E, 0x96, 0x91, 0x3F, 0x6C, 0xE0, 0x9A, 0xFB, 0xF3,
-    0x9B, 0xF6, 0xEE, 0xC5, 0xE4, 0xC3, 0xDE, 0x7C, 0x0B, 0xB3, 0xFC, 0xA5, 0x50, 0x00, 0xC8, 0x60,
-    0x68, 0x48, 0x5A, 0x16, 0x96, 0xC4, 0xC7, 0x73, 0x37, 0xFD, 0x1B, 0x95, 0xA7, 0xE6, 0xFD, 0xD1,
-    0x9E, 0xDB, 0x2B, 0x1F, 0x7D, 0xAA, 0xC1, 0xFC, 0xBA, 0xC0, 0x15, 0x7D, 0x83, 0xD5, 0x5D, 0x9D,
-    0x0D, 0x10, 0xAB, 0x6A, 0x8A, 0x3E, 0x1E, 0xCD, 0x19, 0x63, 0xCE, 0xEF, 0x5D, 0xF4, 0xFE, 0xA7,
-    0xDE, 0xEF, 0xFB, 0xF9, 0xFC, 0xDE, 0xE5, 0x9D, 0xDA, 0xBD, 0xEB, 0x33, 0x60, 0xC9, 0x13, 0x7A,
-    0x4F, 0xFE, 0xE4, 0xA8, 0xA7, 0x8A, 0x01, 0x45, 0x85, 0x6A, 0x8B, 0xDA, 0x95, 0xF6, 0x0E, 0x2F,
-    0x31, 0x61, 0xEB, 0xDA, 0xAD, 0x76, 0xFF, 0x85, 0x57, 0xF2, 0xFF, 0xF5, 0x2B, 0xCD, 0x23, 0xAF,
-    0x9C, 0xBD, 0x1C, 0xC4, 0x3F, 0xC7, 0x61, 0xCE, 0x33, 0x22, 0xE0, 0x6F, 0x05, 0x01, 0xCB, 0xF5,
-    0xD9, 0x12, 0x01, 0x43, 0x7D, 0xEC, 0x4D, 0xEC, 0x01, 0xA5, 0x31, 0xC4, 0xC6, 0x05, 0x18, 0x19,
-    0x7B, 0x7A, 0x91, 0x07, 0xC6, 0x26, 0x0B, 0x1C, 0x29, 0x99, 0xAB, 0xCE, 0x64, 0x53, 0x85, 0xD0,
-    0x1E, 0x71, 0x01, 0x9A, 0x74, 0xF0, 0x2F, 0x5C, 0x7C, 0x63, 0xE1, 0xC6, 0xA5, 0x9D, 0xF7, 0x01,
-    0xC4, 0x74, 0xDD, 0x94, 0x71, 0x27, 0x40, 0x31, 0x27, 0x78, 0x96, 0x1B, 0xB3, 0xEB, 0xB1, 0x26,
-    0x1C, 0xDF, 0x77, 0x1B, 0x06, 0x1A, 0xD6, 0x31, 0x55, 0x0F, 0x5F, 0x81, 0x1D, 0x31, 0xD6, 0x62,
-    0x4B, 0x78, 0x2F, 0xA1, 0xF7, 0x2A, 0x18, 0xB0, 0x36, 0x5E, 0xA3, 0xA1, 0x4F, 0x0D, 0xEA, 0x19,
-    0x9D, 0x31, 0x10, 0x0B, 0x2B, 0x41, 0x11, 0x4F, 0x1D, 0x11, 0xE6, 0xF0, 0x5A, 0xC1, 0x8F, 0xEE,
-    0x81, 0xA3, 0x79, 0x72, 0xC4, 0x20, 0x66, 0x47, 0xC8, 0x63, 0x89, 0xAF, 0x98, 0x9C, 0x6A, 0xE2,
-    0xEC, 0xC6, 0x75, 0x74, 0x4D, 0xA8, 0x25, 0xA5, 0xAA, 0x0A, 0x6A, 0x8E, 0x93, 0xC4, 0xBC, 0x95,
-    0x53, 0x37, 0xD5, 0xB0, 0x1D, 0xC0, 0x4F, 0x84, 0xF4, 0xC6, 0xF1, 0xC2, 0x58, 0xAC, 0xE9, 0x1F,
-    0xB8, 0xFB, 0xD4, 0x18, 0x10, 0x62, 0xC3, 0x8F, 0xF9, 0x72, 0x6B, 0x42, 0x40, 0xE7, 0x03, 0x9C,
-    0xC0, 0xB6, 0x49, 0x13, 0x11, 0x40, 0x32, 0x4D, 0xDC, 0x84, 0x15, 0x72, 0x48, 0x9E, 0x68, 0xBB,
-    0xBC, 0x7C, 0xED, 0x2A, 0x57, 0xD6, 0x80, 0xA2, 0x5F, 0x47, 0x71, 0xAD, 0x08, 0x72, 0x44, 0xCE,
-    0xC3, 0x38, 0xBE, 0x8F, 0x88, 0xC7, 0x44, 0x11, 0x63, 0x56, 0xBB, 0x09, 0x97, 0x19, 0x6A, 0xD4,
-    0x17, 0xC6, 0x76, 0x46, 0x98, 0x86, 0xB9, 0x5B, 0xC2, 0x3D, 0x95, 0x0D, 0x63, 0x27, 0x13, 0x3C,
-    0x25, 0xEF, 0xE1, 0x00, 0x55, 0xE3, 0x89, 0x02, 0x5E, 0x30, 0x43, 0x90, 0x81, 0xA3, 0x32, 0x3D,
-    0xB9, 0xE3, 0x0B, 0xD4, 0xC5, 0xE4, 0xC0, 0x68, 0x52, 0x70, 0x06, 0xAF, 0xD2, 0x12, 0xF4, 0xCB,
-    0xB3, 0x7B, 0x7B, 0x57, 0xB8, 0xFD, 0x8E, 0x28, 0x04, 0x34, 0x83, 0xA3, 0x30, 0x38, 0xE5, 0x61,
-    0x8C, 0xC9, 0xA0, 0x4E, 0x6E, 0x28, 0x21, 0x7E, 0xE5, 0xBC, 0xC0, 0x04, 0xDC, 0x3B, 0x55, 0x94,
-    0x6B, 0x88, 0x44, 0xC5, 0x7D, 0xDA, 0x8D, 0x36, 0xC4, 0xB0, 0x32, 0x7A, 0x41, 0xF9, 0x46, 0x49,
-    0x8C, 0x6E, 0xF8, 0x11, 0xC6, 0xAC, 0x2E, 0xB2, 0x3B, 0x70, 0x57, 0x84, 0x73, 0x7F, 0x84, 0xED,
-    0xCF, 0x6B, 0xEA, 0xB2, 0xF3, 0x6A, 0x25, 0xBA, 0x00, 0x06, 0xBC, 0xCE, 0xFB, 0x78, 0x37, 0x97,
-    0x50, 0x98, 0x0A, 0x4E, 0x98, 0xF8, 0xB2, 0x6A, 0xF1, 0xDC, 0x41, 0xFF, 0xBA, 0x94, 0xEB, 0x05,
-    0x7E, 0x50, 0x75, 0xC9, 0x62, 0xEC, 0x08, 0x91, 0xB6, 0xBE, 0x09, 0x3C, 0x71, 0x94, 0x92, 0x0B,
-    0x47, 0x7B, 0x7B, 0x7B, 0xA5, 0xDD, 0x9A, 0x38, 0x91, 0x6A, 0xEE, 0xED, 0xE1, 0x13, 0x6C, 0x04,
-    0xCC, 0x76, 0x6D, 0x46, 0x9A, 0x01, 0x99, 0x3A, 0x23, 0x77, 0xD4, 0xAE, 0x36, 0xDC, 0x28, 0x7D,
-    0x34, 0xA2, 0xF9, 0x64, 0x4C, 0x27, 0x93, 0xAC, 0x8A, 0x09, 0xB7, 0xE7, 0x75, 0x34, 0x51, 0x6B,
-    0x8D, 0xD2, 0x60, 0x4E, 0x3A, 0x50, 0x06, 0xDF, 0x89, 0xE4, 0x40, 0xF3, 0x55, 0x3A, 0x50, 0x36,
-    0x24, 0x54, 0x71, 0x01, 0xE3, 0x03, 0xDE, 0x08, 0x32, 0xEF, 0x79, 0x48, 0xEF, 0x95, 0x56, 0x81,
-    0x7A, 0x08, 0xD7, 0x48, 0x31, 0x3B, 0x56, 0x23, 0x76, 0x66, 0x7B, 0x18, 0xAD, 0x6A, 0x01, 0x84,
-    0xFE, 0xD5, 0x05, 0x70, 0x0A, 0x19, 0x8A, 0xBE, 0x80, 0xDB, 0xD7, 0x96, 0xA3, 0x2A, 0xDA, 0xA3,
-    0xA0, 0x87, 0x04, 0xE5, 0xEE, 0x3E, 0xE0, 0x16, 0x98, 0x62, 0xF4, 0xA4, 0x7A, 0xE0, 0x90, 0x8E,
-    0xFA, 0x44, 0x4C, 0x48, 0x68, 0x56, 0x20, 0x80, 0x69, 0x58, 0xAE, 0x49, 0xA1, 0x5D, 0x03, 0xA7,
-    0x24, 0xB9, 0xBA, 0xB7, 0xBF, 0xE2, 0x84, 0xBC, 0x1D, 0x11, 0xCC, 0x3D, 0xC6, 0xDA, 0x11, 0xCD,
-    0x11, 0x87, 0x60, 0xA2, 0xAB, 0xE3, 0xE3, 0x4E, 0x70, 0x73, 0xB9, 0x33, 0xFD, 0xE3, 0xEC, 0x1A,
-    0xFA, 0x59, 0x9B, 0x4D, 0x89, 0x87, 0xD8, 0x45, 0xF9, 0xB9, 0xB4, 0x1B, 0x5D, 0xC7, 0x7A, 0xC4,
-    0x0F, 0xB8, 0xDF, 0xEA, 0xEB, 0x44, 0x20, 0xFE, 0x87, 0xDA, 0x37, 0xE3, 0xE3, 0x93, 0xF5, 0x05,
-    0xE8, 0xB4, 0x66, 0xE8, 0x60, 0xFF, 0x48, 0x02, 0xF0, 0x2A, 0x26, 0x54, 0x06, 0x14, 0x72, 0xF4,
-    0x19, 0x0D, 0xC1, 0x42, 0x39, 0xE3, 0x4E, 0x92, 0x54, 0x33, 0x7D, 0x33, 0x65, 0xA2, 0x65, 0x12,
-    0x61, 0x16, 0x9C, 0xB7, 0x81, 0x89, 0x04, 0xC9, 0x1B, 0x98, 0xC9, 0xFC, 0x29, 0x5F, 0x7C, 0xE3,
-    0x8D, 0x37, 0xFE, 0x15, 0x5E, 0x70, 0x88, 0xEF, 0xD7, 0xE1, 0x1B, 0xEB, 0x8A, 0xE7, 0x70, 0x7B,
-    0x4D, 0x0F, 0x0F, 0xF0, 0xEB, 0x01, 0xF3, 0xCD, 0x18, 0x22, 0x77, 0x3B, 0x4D, 0x74, 0x3C, 0xEF,
-    0x22, 0xE7, 0xD8, 0xF5, 0x65, 0xE2, 0xDB, 0x75, 0x79, 0xC2, 0x42, 0xDC, 0xAE, 0xC1, 0xBC, 0x94,
-    0xA0, 0x69, 0x85, 0x1F, 0x80, 0x85, 0xC5, 0xF3, 0xD3, 0x19, 0xE4, 0x16, 0xFC, 0x07, 0x7E, 0x04,
-    0xF2, 0xEA, 0xE9, 0x2B, 0xF8, 0xB5, 0x80, 0xB4, 0xAF, 0x1B, 0xBB, 0x10, 0x44, 0x76, 0xB6, 0xF4,
-    0x15, 0xC9, 0x19, 0x48, 0x0C, 0xF4, 0xC5, 0xC0, 0xA0, 0xDD, 0x1D, 0xF7, 0x0B, 0xFD, 0xF0, 0x0A,
-    0x41, 0x91, 0x86, 0x96, 0xD6, 0xF8, 0x97, 0x17, 0x04, 0xA0, 0x07, 0x82, 0x98, 0x00, 0x7E, 0x75,
-    0xBC, 0x66, 0x89, 0xA2, 0x8B, 0x7E, 0x7C, 0x61, 0x33, 0xC3, 0xD5, 0xEC, 0x02, 0x2F, 0xCF, 0x7A,
-    0xE0, 0x69, 0x97, 0x75, 0x55, 0x69, 0xC1, 0x9B, 0xEC, 0xAB, 0xE0, 0x54, 0x80, 0xCE, 0x39, 0xEB,
-    0xB2, 0x3E, 0xED, 0x92, 0xA1, 0x2A, 0xF1, 0xA0, 0x2C, 0xDE, 0x21, 0xD9, 0x82, 0x87, 0x80, 0x88,
-    0xE1, 0x5F, 0x32, 0x90, 0xD0, 0x55, 0xB5, 0x45, 0xA4, 0xF8, 0x78, 0xC6, 0xBF, 0x29, 0xF6, 0x6F,
-    0x21, 0x2F, 0xE0, 0x1D, 0xFF, 0x21, 0x82, 0xD7, 0x36, 0xF9, 0x22, 0x0A, 0x54, 0xEE, 0x1E, 0xA4,
-    0x37, 0xC4, 0x49, 0xF8, 0x15, 0x44, 0x58, 0xF1, 0xF5, 0x0F, 0x19, 0x07, 0xA5, 0xC9, 0x5B, 0x85,
-    0xB4, 0x5C, 0x8B, 0x0C, 0x99, 0x60, 0xB7, 0xA1, 0x1B, 0x9B, 0x53, 0xA9, 0xCB, 0x98, 0x90, 0x49,
-    0x95, 0xD4, 0x42, 0xCC, 0x61, 0x90, 0x54, 0x4A, 0xA5, 0xAF, 0xD4, 0x17, 0x89, 0x50, 0x0B, 0xD9,
-    0xEF, 0x2B, 0x49, 0xF6, 0xFA, 0xB0, 0x08, 0xE0, 0x20, 0x29, 0xF1, 0x63, 0x48, 0x05, 0xCE, 0x32,
-    0x78, 0xD1, 0x12, 0xCB, 0xE2, 0x79, 0xCF, 0x89, 0x22, 0x7B, 0x59, 0x93, 0x79, 0x24, 0x5E, 0xDE,
-    0xB8, 0xE9, 0x45, 0x30, 0xE0, 0x53, 0x19, 0xB3, 0x4F, 0x29, 0x1A, 0x35, 0x46, 0xEE, 0x23, 0x88,
-    0x38, 0x38, 0xDF, 0x02, 0x2A, 0xEE, 0x30, 0x7D, 0xE2, 0x1B, 0x68, 0xA9, 0xB4, 0xEA, 0x49, 0xD1,
-    0x30, 0x49, 0x0A, 0x3F, 0x19, 0xCC, 0x9E, 0xBF, 0x48, 0xF6, 0xC9, 0xF5, 0x88, 0x42, 0x0D, 0x03,
-    0x6E, 0xE2, 0xFE, 0x31, 0x2B, 0xD5, 0x84, 0xA4, 0xFA, 0xD7, 0xF3, 0xFA, 0x5A, 0x46, 0xC4, 0x37,
-    0xFE, 0x13, 0x2C, 0x8D, 0x4C, 0x42, 0x2E, 0x49, 0x08, 0x65, 0xFC, 0x35, 0x31, 0x91, 0x88, 0x46,
-    0x57, 0x9D, 0x53, 0xAC, 0xA1, 0x49, 0x34, 0xAF, 0x89, 0xE1, 0x60, 0x8C, 0xDE, 0x1F, 0x9C, 0x84,
-    0x06, 0x25, 0xD9, 0x65, 0xEA, 0x10, 0xB1, 0xAF, 0x94, 0xE1, 0x97, 0x8B, 0x9E, 0x89, 0x0D, 0x1C,
-    0xB9, 0x37, 0x69, 0x07, 0x5F, 0x88, 0x7B, 0xA6, 0xC4, 0xCB, 0x42, 0x28, 0x81, 0x9A, 0x60, 0x5A,
-    0x18, 0x06, 0xA4, 0x34, 0x2B, 0x88, 0x2B, 0xC0, 0x85, 0xBC, 0xCA, 0x63, 0xBF, 0xC3, 0x30, 0xCF,
-    0x0D, 0x04, 0xDD, 0x67, 0xD5, 0xE0, 0xE9, 0x34, 0x78, 0xC8, 0x24, 0x41, 0xB7, 0xE3, 0xD8, 0x2B,
-    0xC1, 0x62, 0x7B, 0x65, 0x50, 0x87, 0x72, 0x13, 0x7F, 0xA8, 0xEC, 0xA9, 0xCD, 0xB7, 0xFD, 0x35,
-    0xC7, 0xF8, 0x18, 0x98, 0xEC, 0x36, 0x5E, 0x30, 0x02, 0x91, 0x0A, 0xD2, 0x0D, 0x61, 0xA6, 0xF8,
-    0x05, 0x03, 0x7F, 0x8D, 0xED, 0x4C, 0x09, 0x9C, 0x1F, 0xB8, 0xF4, 0xC4, 0x44, 0xBE, 0xA1, 0x72,
-    0x4A, 0x3A, 0x34, 0x54, 0x91, 0x08, 0x28, 0xC8, 0x14, 0x30, 0x0D, 0x04, 0x27, 0xA0, 0xD1, 0x6C,
-    0xF7, 0xF6, 0x39, 0x99, 0x3C, 0xA9, 0xD0, 0xF5, 0x73, 0x4A, 0xCA, 0x94, 0xFC, 0x98, 0x07, 0xDB,
-    0x28, 0xF8, 0x9D, 0xED, 0x7E, 0x77, 0x62, 0x90, 0xA2, 0x26, 0x83, 0xBD, 0x72, 0x01, 0xC5, 0x77,
-    0x43, 0x76, 0xE6, 0xAC, 0x4C, 0x69, 0x2A, 0x82, 0x1C, 0xF7, 0x11, 0xFB, 0x90, 0x9C, 0xA8, 0x9A,
-    0x2A, 0x38, 0x6B, 0x79, 0xEC, 0x93, 0x78, 0xF1, 0xCF, 0x08, 0x4F, 0x91, 0x36, 0x82, 0x9A, 0xA5,
-    0x18, 0x22, 0x57, 0x2A, 0xB1, 0x68, 0x45, 0xA9, 0x4D, 0x89, 0xD2, 0x07, 0x1E, 0xC4, 0x1C, 0x20,
-    0x21, 0xB3, 0xE9, 0x2C, 0x81, 0xA2, 0xCE, 0x40, 0x66, 0x06, 0x23, 0xA5, 0x64, 0x65, 0xC8, 0x20,
-    0x41, 0x84, 0xAA, 0x55, 0xE0, 0x7C, 0xE7, 0xBA, 0x9C, 0x75, 0x4D, 0x83, 0x91, 0xFF, 0xE5, 0x0F,
-    0x0C, 0x5F, 0x58, 0x4D, 0x19, 0x5E, 0x08, 0xBF, 0x4A, 0xB8, 0x94, 0x56, 0x4E, 0xE8, 0xDB, 0x1B,
-    0xA5, 0x7C, 0xEB, 0xD7, 0x50, 0xA4, 0x99, 0x00, 0x1B, 0x1F, 0xF1, 0x7E, 0x50, 0x04, 0x24, 0x44,
-    0x61, 0xD9, 0xE4, 0x40, 0xDE, 0x89, 0x33, 0xD8, 0x9A, 0x18, 0xD2, 0x33, 0x9B, 0x3F, 0x21, 0xCC,
-    0x3F, 0x2D, 0x8D, 0xBC, 0x05, 0x8E, 0x02, 0xBC, 0x87, 0x18, 0xDE, 0xDF, 0xA5, 0xE3, 0x8F, 0x0C,
-    0x1E, 0x9F, 0x4A, 0xA3, 0x15, 0x4A, 0xB1, 0x39, 0xC6, 0x33, 0xCC, 0xE8, 0xEF, 0x5D, 0x0D, 0xDB,
-    0x6F, 0x22, 0xE9, 0x7E, 0xC3, 0x75, 0xC1, 0x99, 0x57, 0x6B, 0xE0, 0x63, 0x4B, 0x42, 0x60, 0x3D,
-    0xB3, 0xF4, 0x28, 0xEE, 0x93, 0x4D, 0xD2, 0x6B, 0xB4, 0xA2, 0x76, 0x31, 0x68, 0x53, 0xFC, 0xE6,
-    0xB6, 0xE8, 0xCA, 0x73, 0x10, 0x85, 0x91, 0x1C, 0x3C, 0x27, 0x38, 0x5A, 0x23, 0xF5, 0xF8, 0x71,
-    0x05, 0x95, 0xC7, 0x4E, 0x61, 0xC3, 0x14, 0x74, 0x35, 0x7E, 0x64, 0xFC, 0x6F, 0xA7, 0x98, 0x57,
-    0x16, 0x7A, 0x04, 0x79, 0xEB, 0xAD, 0x50, 0xD6, 0xCF, 0x62, 0x99, 0x9C, 0x52, 0xF4, 0x36, 0x0A,
-    0x8E, 0xB0, 0x86, 0x0E, 0xDF, 0xE7, 0x0A, 0x9C, 0xE0, 0xF1, 0x37, 0x97, 0xC7, 0xDC, 0x4C, 0x96,
-    0xE0, 0x3A, 0x3B, 0x58, 0x8B, 0x73, 0xC6, 0x01, 0xFA, 0xB2, 0x90, 0xF0, 0xC3, 0x3E, 0xEA, 0xAD,
-    0x2D, 0xE5, 0x8A, 0x32, 0xA8, 0x6C, 0x2D, 0x67, 0xFB, 0x2D, 0x4F, 0x42, 0x54, 0xCB, 0x6B, 0x1E,
-    0xFB, 0x84, 0xB2, 0x04, 0x8B, 0xB2, 0x8C, 0xD2, 0xCE, 0xFF, 0x48, 0x94, 0xFB, 0x83, 0x20, 0x40,
-    0x19, 0xB8, 0x47, 0xA8, 0x3B, 0xA3, 0x7F, 0xDA, 0x86, 0x4E, 0x06, 0xD5, 0x3A, 0x3F, 0x56, 0xF2,
-    0x99, 0x9A, 0xE0, 0x6B, 0x3B, 0x4E, 0xC8, 0xFC, 0x4E, 0x4A, 0x39, 0x29, 0x1C, 0x6C, 0x1F, 0xF8,
-    0xED, 0x3B, 0xA2, 0x8C, 0x8B, 0x96, 0xC9, 0xEF, 0x07, 0xCF, 0xD1, 0x36, 0xE3, 0xE0, 0x87, 0x59,
-    0xA8, 0xB5, 0xAB, 0xC3, 0x59, 0x81, 0x74, 0x75, 0x92, 0xA0, 0x45, 0x20, 0x90, 0x02, 0x23, 0xAC,
-    0x41, 0x66, 0x38, 0x2B, 0x71, 0x63, 0x52, 0xFC, 0x48, 0x3C, 0x48, 0x90, 0xA4, 0x88, 0x3C, 0x3C,
-    0x95, 0x92, 0x28, 0x2D, 0xB0, 0x0E, 0xA4, 0x85, 0x10, 0xF6, 0xC2, 0xF2, 0x71, 0x55, 0x8F, 0xF6,
-    0xBB, 0x09, 0xAC, 0x65, 0xAB, 0x03, 0x79, 0xB1, 0xB8, 0x9D, 0x22, 0x24, 0x9B, 0xB6, 0x17, 0x95,
-    0x0B, 0x52, 0x18, 0x84, 0xFE, 0x3D, 0x41, 0x0B, 0x2F, 0x15, 0x75, 0x0C, 0xF4, 0x6E, 0x77, 0xE6,
-    0x64, 0xCB, 0xA0, 0x47, 0x01, 0x21, 0xE1, 0x8F, 0xBB, 0xE2, 0x77, 0x23, 0x3A, 0x9E, 0x0A, 0x18,
-    0x69, 0x6E, 0x56, 0x44, 0xD4, 0x86, 0x2F, 0x45, 0x66, 0x73, 0x26, 0x0E, 0x2A, 0xE9, 0xE1, 0x18,
-    0xDF, 0xA7, 0x5F, 0x3C, 0x58, 0xA2, 0x89, 0xD2, 0x4C, 0x55, 0x33, 0x33, 0xB5, 0x39, 0xF0, 0x77,
-    0x95, 0xDC, 0xAF, 0x4E, 0x96, 0xC9, 0x29, 0x6B, 0xFD, 0xFE, 0x2B, 0x2C, 0x84, 0x7B, 0x7B, 0xD8,
-    0xC0, 0xD3, 0xE3, 0x29, 0x05, 0x77, 0xC0, 0x00, 0x64, 0xEF, 0x9E, 0x66, 0x83, 0x58, 0x23, 0xBD,
-    0xAB, 0x68, 0x32, 0xF2, 0x48, 0x20, 0x0E, 0x8A, 0x6B, 0x56, 0x6B, 0x00, 0x38, 0xDA, 0x15, 0xD4,
-    0xA2, 0x28, 0x71, 0x6B, 0x87, 0x00, 0xB8, 0xEB, 0x87, 0xD4, 0xAB, 0x26, 0x59, 0xA4, 0x7E, 0x19,
-    0xD9, 0x7A, 0xD9, 0xA2, 0x90, 0x3D, 0xE1, 0x84, 0x93, 0xB8, 0x1C, 0x13, 0xB3, 0x0F, 0x65, 0x06,
-    0x48, 0xD5, 0x86, 0x81, 0xA9, 0x24, 0x59, 0xAB, 0x50, 0x07, 0x8C, 0x51, 0x38, 0x18, 0x8D, 0x63,
-    0x3E, 0x03, 0x83, 0xC3, 0x98, 0xC9, 0x0E, 0x1A, 0x93, 0xF8, 0x54, 0x4D, 0x03, 0xFF, 0x2E, 0x97,
-    0xEA, 0x8A, 0x91, 0x2B, 0x21, 0xAD, 0xB1, 0xC9, 0x40, 0x14, 0x50, 0x95, 0x9F, 0x11, 0x3D, 0x6D,
-    0xBD, 0x91, 0x38, 0xAD, 0xA9, 0x16, 0xD5, 0xB4, 0x99, 0x5A, 0x5C, 0x75, 0x84, 0x31, 0xB4, 0x1E,
-    0xD4, 0x9E, 0x01, 0x6B, 0x93, 0xB5, 0xFA, 0xBE, 0x7C, 0x8C, 0x5B, 0x10, 0x71, 0x14, 0xA0, 0x85,
-    0xE4, 0xC9, 0x0C, 0xB0, 0x7C, 0x03, 0x33, 0xE2, 0x7F, 0x35, 0xB2, 0x80, 0xB3, 0x13, 0x01, 0x2B,
-    0x9F, 0x08, 0x45, 0xF9, 0xCC, 0x4C, 0x97, 0xCD, 0xC4, 0xB1, 0x6C, 0x56, 0x4D, 0x36, 0xD3, 0xB3,
-    0xF2, 0x89, 0xD7, 0x42, 0x57, 0x3B, 0xEA, 0x3A, 0xF0, 0xEA, 0x7A, 0xCB, 0xAC, 0xD3, 0x16, 0xA4,
-    0xA2, 0x4D, 0x46, 0x59, 0x21, 0xD4, 0x3D, 0x37, 0x9B, 0x90, 0xF2, 0x4C, 0xE0, 0x5A, 0xC1, 0xBD,
-    0x56, 0x5A, 0x22, 0x0A, 0x50, 0x84, 0x9A, 0x86, 0x63, 0x0A, 0x5D, 0xBF, 0xED, 0x5F, 0xE1, 0x9D,
-    0x99, 0x12, 0x15, 0xBD, 0x72, 0x55, 0xA3, 0xEA, 0x5A, 0x75, 0xEC, 0x48, 0xB7, 0x04, 0x15, 0x10,
-    0x41, 0x60, 0x02, 0x98, 0xF7, 0x17, 0xE1, 0x73, 0x1B, 0xB8, 0x3E, 0x16, 0xBD, 0xB1, 0x8D, 0xD0,
-    0x10, 0xE5, 0x81, 0x3D, 0xC9, 0x41, 0x43, 0xF4, 0xE6, 0xAB, 0x1A, 0xD4, 0xE7, 0x5B, 0x63, 0x40,
-    0xFA, 0x09, 0x0A, 0x12, 0x1F, 0x5C, 0x73, 0x0D, 0x81, 0x47, 0x3A, 0xA2, 0x92, 0xDC, 0x68, 0x82,
-    0x96, 0x94, 0x84, 0xA1, 0x92, 0xA0, 0x27, 0x13, 0x14, 0x65, 0x82, 0xA6, 0x42, 0xF9, 0x3A, 0x9B,
-    0xA0, 0x2B, 0x13, 0x94, 0x15, 0x7E, 0x8C, 0x26, 0xA8, 0x4B, 0x3F, 0x50, 0x93, 0x06, 0x85, 0x71,
-    0x14, 0xA7, 0x95, 0xBE, 0x28, 0xFE, 0x7B, 0x4E, 0x80, 0x28, 0xA5, 0x99, 0x20, 0x0A, 0xF6, 0x77,
-    0x5D, 0x04, 0x50, 0x1F, 0x20, 0xE0, 0x91, 0x09, 0xE2, 0xEA, 0x27, 0xC7, 0xFE, 0x9B, 0x6A, 0x15,
-    0x1F, 0xF0, 0xC0, 0xCB, 0xF4, 0xBB, 0x42, 0x0C, 0x73, 0xA2, 0xE9, 0x1D, 0xBF, 0x16, 0x33, 0x0A,
-    0xBA, 0x43, 0xAC, 0xB9, 0xE7, 0xAF, 0x29, 0x1B, 0x96, 0xEA, 0x28, 0x50, 0x69, 0x41, 0xCB, 0x50,
-    0x19, 0xA3, 0x81, 0x81, 0x0B, 0x43, 0x50, 0xE3, 0xE9, 0xB4, 0x1B, 0x92, 0x67, 0xC8, 0x10, 0xB2,
-    0xA4, 0xDA, 0x01, 0x7D, 0xC0, 0x2D, 0xAA, 0xD1, 0xF6, 0x4A, 0x32, 0x9D, 0xB6, 0xD7, 0x52, 0x2B,
-    0xA0, 0x5D, 0xEC, 0x92, 0x8C, 0x31, 0xA9, 0xFB, 0x62, 0xFC, 0xC4, 0xB4, 0x50, 0xC8, 0x12, 0xAC,
-    0xB1, 0xCE, 0x5E, 0x31, 0xA1, 0xCA, 0x27, 0x43, 0x48, 0x99, 0xD4, 0x51, 0x77, 0x0E, 0x6C, 0x43,
-    0xD0, 0xE0, 0x04, 0x90, 0x68, 0xA0, 0x8D, 0x21, 0x55, 0xBF, 0x36, 0x66, 0x15, 0x89, 0xBA, 0x24,
-    0xBC, 0x6C, 0xBC, 0x0A, 0xCA, 0x3E, 0x43, 0x6E, 0x69, 0x2A, 0x8C, 0xDB, 0x90, 0xFD, 0xB0, 0xCC,
-    0x03, 0x65, 0x83, 0x3A, 0x99, 0x37, 0x83, 0x39, 0x2B, 0xDA, 0x92, 0x8B, 0xD2, 0xC9, 0xFC, 0xBB,
-    0xBC, 0x4C, 0x04, 0x22, 0x7F, 0xFB, 0xE8, 0xEA, 0xFC, 0xFC, 0xE8, 0x58, 0x50, 0xFD, 0x55, 0x97,
-    0x8F, 0x71, 0xFF, 0x13, 0x60, 0xDE, 0xF7, 0x36, 0xB5, 0xED, 0x77, 0xEA, 0x2D, 0x3B, 0xE8, 0x4E,
-    0x12, 0x78, 0x7B, 0x4C, 0x5A, 0xE4, 0x39, 0x72, 0xAB, 0x40, 0x65, 0x3E, 0x4F, 0x27, 0xF4, 0x02,
-    0xD3, 0x14, 0x2D, 0xC2, 0xB8, 0x15, 0x68, 0x03, 0x45, 0x36, 0x5A, 0xBF, 0xB5, 0x84, 0xC3, 0x81,
-    0x35, 0x7B, 0xC1, 0xDC, 0xAE, 0xF6, 0x1F, 0x56, 0xA2, 0xFA, 0xE7, 0x90, 0xB2, 0x45, 0xEE, 0x10,
-    0xC7, 0xC4, 0x5A, 0xA7, 0xDA, 0x0D, 0x3B, 0x13, 0xB9, 0x2B, 0x45, 0xEE, 0x18, 0x0E, 0x2C, 0x12,
-    0xB8, 0x7E, 0x71, 0xFA, 0x4D, 0xDB, 0x28, 0xD7, 0x4F, 0x81, 0xE9, 0x95, 0x74, 0xB8, 0x8A, 0xB6,
-    0x7D, 0x20, 0x2A, 0xE9, 0xD7, 0x04, 0xA5, 0x42, 0xC0, 0x85, 0x72, 0x40, 0xA4, 0xA2, 0xA2, 0xA5,
-    0x3C, 0x2C, 0x05, 0x95, 0xDD, 0xF6, 0x44, 0xE1, 0xBA, 0x18, 0xC5, 0xF0, 0x96, 0x6D, 0xF1, 0x28,
-    0x4A, 0x4E, 0x31, 0x21, 0x46, 0x2E, 0xA7, 0x09, 0xFD, 0x51, 0xC1, 0xEE, 0x10, 0xAB, 0x32, 0x50,
-    0x5F, 0xCD, 0xD7, 0x72, 0x8F, 0x8E, 0x9D, 0xB5, 0x74, 0xB2, 0xCA, 0x27, 0x85, 0x72, 0xE7, 0x9D,
-    0x90, 0xAF, 0x03, 0xE3, 0x0A, 0x51, 0x29, 0x7D, 0xE6, 0xAA, 0x48, 0x92, 0x40, 0xB4, 0xFC, 0x09,
-    0xF1, 0xA4, 0xCF, 0xDC, 0x80, 0x25, 0x6F, 0x41, 0x7F, 0x6F, 0x41, 0xC6, 0xF7, 0x55, 0x28, 0x01,
-    0xD1, 0xB1, 0x79, 0x80, 0x3A, 0xD6, 0x5E, 0xC4, 0xF6, 0x81, 0xC4, 0x70, 0x22, 0x4A, 0x65, 0x7B,
-    0x42, 0x10, 0x55, 0xB5, 0x11, 0xE6, 0x42, 0x0B, 0x7E, 0xDA, 0x88, 0xA3, 0x38, 0x36, 0x78, 0xF0,
-    0x9A, 0xAD, 0x1A, 0x48, 0x96, 0x4E, 0xF9, 0x7F, 0xF6, 0x90, 0x6D, 0xE3, 0xB3, 0xF7, 0x67, 0x4A,
-    0x57, 0xDD, 0xEE, 0xDD, 0x73, 0x6C, 0xBA, 0x7C, 0x3A, 0xE4, 0x3F, 0x1D, 0xB8, 0x99, 0x29, 0x79,
-    0xA8, 0x84, 0x08, 0x9D, 0x28, 0xBD, 0xB2, 0xFC, 0x93, 0xFC, 0x75, 0x16, 0xB2, 0x62, 0x13, 0x6F,
-    0xEB, 0x00, 0x39, 0x44, 0xD1, 0xAF, 0xEE, 0x32, 0x86, 0xEE, 0xD0, 0xF1, 0x17, 0x0A, 0x57, 0x92,
-    0x00, 0xA0, 0x5D, 0x45, 0xDE, 0x06, 0xCE, 0x78, 0x14, 0xDE, 0x2A, 0x05, 0x70, 0xEA, 0xA1, 0xD5,
-    0x4E, 0xD9, 0x36, 0x0D, 0xCC, 0x42, 0x2D, 0xCC, 0x2C, 0xA8, 0xA8, 0x08, 0x38, 0x65, 0x03, 0xA8,
-    0x07, 0x9B, 0xA5, 0xE1, 0x9E, 0x93, 0xF7, 0x25, 0x0F, 0x03, 0x7B, 0x7D, 0x4D, 0xCC, 0x75, 0x92,
-    0x8B, 0xA2, 0xDA, 0xD4, 0x1E, 0xD4, 0x00, 0xB3, 0xAD, 0x51, 0x55, 0x71, 0xC0, 0xFE, 0x11, 0x6C,
-    0x0F, 0x9F, 0x4C, 0xD4, 0xBC, 0xA9, 0x57, 0xD1, 0x24, 0xD9, 0xCF, 0x29, 0xD8, 0xAC, 0x52, 0xA2,
-    0x0E, 0xDD, 0x0D, 0x1E, 0x18, 0xB1, 0xAA, 0xA0, 0xFE, 0x8A, 0x9E, 0x9D, 0xD1, 0x8A, 0x07, 0x05,
-    0xC6, 0xDF, 0x51, 0x53, 0x27, 0x48, 0xAC, 0xFA, 0x27, 0x04, 0xC4, 0x74, 0x4C, 0xA2, 0x43, 0x58,
-    0xA4, 0x93, 0x79, 0x14, 0x8F, 0x15, 0x17, 0x91, 0x5B, 0x42, 0x2C, 0x0A, 0xE3, 0xC6, 0xE0, 0x7D,
-    0xF0, 0x4B, 0xA5, 0x00, 0x22, 0xEF, 0x14, 0x1F, 0x95, 0x05, 0x4B, 0xEA, 0x1C, 0xA8, 0x20, 0xCA,
-    0x5C, 0x4A, 0xE1, 0x99, 0xDF, 0xE2, 0x60, 0x12, 0x2E, 0xF5, 0xE9, 0xAE, 0x8A, 0x2E, 0xAA, 0x70,
-    0x91, 0x0D, 0xA3, 0x03, 0x36, 0xFD, 0x26, 0x22, 0x48, 0x45, 0xFC, 0xB6, 0x8D, 0xEB, 0xCD, 0x7E,
-    0xCF, 0x75, 0x46, 0x2D, 0x11, 0x0A, 0x89, 0xB5, 0xA9, 0x02, 0x21, 0x52, 0xE6, 0x6D, 0x1F, 0x7A,
-    0xE8, 0x63, 0x68, 0xEA, 0xAF, 0x9D, 0x75, 0x6E, 0xFB, 0x74, 0xE7, 0xBF, 0x51, 0xF3, 0x58, 0x59,
-    0xBD, 0xF9, 0x3F, 0x8E, 0x7F, 0x80, 0x41, 0xD0, 0xAA, 0x0F, 0xCE, 0x51, 0xD4, 0x6A, 0x95, 0xF3,
-    0x29, 0x07, 0x73, 0x84, 0x8E, 0x6C, 0x48, 0xCF, 0xCB, 0x70, 0x2A, 0x30, 0x85, 0xD9, 0x39, 0x0F,
-    0x57, 0xE0, 0x89, 0x0A, 0xD9, 0xF2, 0xBC, 0xBE, 0xD1, 0x87, 0xD5, 0xC4, 0x83, 0x4A, 0x35, 0xCD,
-    0x79, 0x9B, 0xC7, 0x45, 0x7C, 0xE3, 0x7C, 0x29, 0x8C, 0x24, 0x8F, 0xB2, 0xFF, 0x6F, 0x7B, 0x61,
-    0x59, 0x9F, 0x7D, 0x61, 0xFC, 0x93, 0xAC, 0x47, 0xA7, 0xD0, 0x63, 0xDD, 0x7E, 0xC5, 0xEA, 0x43,
-    0xD6, 0xA1, 0x93, 0xC9, 0xC0, 0xC9, 0x0F, 0xE1, 0x4B, 0x1F, 0xA2, 0xA6, 0x18, 0x00, 0x5B, 0x53,
-    0xD1, 0x98, 0x25, 0x06, 0x36, 0x95, 0x9E, 0xAD, 0x8F, 0x36, 0xEF, 0xC0, 0xD4, 0x7A, 0x1D, 0x21,
-    0xE5, 0x3F, 0x5F, 0x42, 0xFB, 0x0F, 0xA9, 0x19, 0x5F, 0x76, 0xED, 0x2E, 0xB1, 0x8F, 0xF4, 0xC3,
-    0x33, 0xA6, 0xCF, 0x3A, 0xDB, 0xBA, 0xA6, 0x6A, 0xAA, 0xF2, 0x69, 0x0E, 0x79, 0x39, 0xBA, 0x8C,
-    0x75, 0xEF, 0xF4, 0x6B, 0x43, 0xFB, 0x21, 0x59, 0x59, 0xED, 0x1A, 0xF6, 0x0D, 0xD8, 0xA8, 0x43,
-    0xAC, 0x22, 0xF0, 0x80, 0x0C, 0xC0, 0x4A, 0x31, 0x0A, 0xAB, 0xF6, 0x66, 0x97, 0x91, 0xF4, 0x15,
-    0xBC, 0xBC, 0x35, 0xFD, 0x89, 0xFD, 0xCD, 0x11, 0x01, 0xF9, 0x67, 0x7E, 0xCC, 0x99, 0x15, 0xD3,
-    0x85, 0x91, 0x79, 0x99, 0xE4, 0xF8, 0xAC, 0x3C, 0x75, 0xC5, 0x2C, 0xE7, 0xD7, 0x2E, 0xB4, 0xB6,
-    0x46, 0x0D, 0x88, 0x68, 0xB9, 0xFA, 0x25, 0x68, 0x07, 0x9C, 0x1B, 0xF0, 0xD9, 0x64, 0x9F, 0xF8,
-    0x29, 0x5A, 0x46, 0xD7, 0x16, 0x0B, 0x8B, 0xB9, 0xC6, 0xB6, 0x40, 0xA4, 0x39, 0xE1, 0xC1, 0x47,
-    0x05, 0x79, 0x10, 0xDE, 0x40, 0xC7, 0x32, 0xEF, 0xB3, 0x7E, 0xE3, 0x23, 0xB6, 0x39, 0xC0, 0x01,
-    0x89, 0xBC, 0x6A, 0x51, 0xD4, 0xC9, 0xFD, 0x6D, 0xAA, 0x32, 0xE6, 0x02, 0x99, 0x9A, 0xEA, 0x26,
-    0xA1, 0xF2, 0xB3, 0xEC, 0x60, 0x96, 0xEE, 0xD4, 0x69, 0x54, 0x23, 0x7A, 0xA3, 0x13, 0x9D, 0xDE,
-    0xD4, 0xBE, 0xC9, 0x2F, 0xF9, 0x4F, 0x48, 0xB5, 0xFB, 0x4C, 0x3D, 0x95, 0x7A, 0xDB, 0x28, 0x56,
-    0x17, 0xD5, 0x29, 0x63, 0x6E, 0x2F, 0x21, 0x32, 0xB3, 0x47, 0x9A, 0xD9, 0x2F, 0xE7, 0x6C, 0x10,
-    0x1C, 0xAA, 0x05, 0xD0, 0x52, 0x91, 0xCD, 0xB1, 0x22, 0x6B, 0x2A, 0xB2, 0x7C, 0x44, 0x91, 0xCB,
-    0xA3, 0x8A, 0x9C, 0x7E, 0x9B, 0x22, 0xB9, 0x9D, 0x5C, 0x1D, 0xDA, 0xBA, 0xF8, 0xD8, 0x47, 0x33,
-    0xCF, 0xE1, 0xF2, 0x0E, 0xA9, 0x37, 0x1E, 0xD3, 0x21, 0x7F, 0xCF, 0x97, 0xCE, 0x81, 0xF1, 0x2E,
-    0xA2, 0xD1, 0x80, 0xAB, 0x03, 0xE8, 0xE8, 0x5D, 0xFF, 0xFC, 0xF2, 0x98, 0xED, 0x98, 0xA7, 0xAE,
-    0x0B, 0x60, 0x66, 0xB3, 0xD6, 0x2E, 0xA6, 0xF8, 0x58, 0x87, 0x0F, 0xCD, 0x77, 0x65, 0x0C, 0xB3,
-    0x76, 0x90, 0xD7, 0x16, 0xDA, 0x46, 0xD7, 0xFD, 0xB5, 0x3A, 0x53, 0x39, 0xAB, 0xC0, 0x0F, 0x1C,
-    0x39, 0x20, 0x94, 0x14, 0x11, 0x34, 0xB1, 0xF6, 0x2D, 0xD4, 0xD8, 0x0F, 0x27, 0x0E, 0x01, 0xD3,
-    0x43, 0x3B, 0x3F, 0x14, 0x87, 0xE1, 0xB4, 0x48, 0x75, 0x74, 0xF0, 0xF0, 0xC7, 0x2C, 0x28, 0xE6,
-    0xF9, 0x74, 0xF0, 0x8F, 0x5B, 0xCA, 0x22, 0x8A, 0x0D, 0xA7, 0xE1, 0xBB, 0x1F, 0xAD, 0xC0, 0xF3,
-    0xC3, 0x32, 0xF0, 0xBC, 0x56, 0x99, 0x19, 0x13, 0xBC, 0xB2, 0xDC, 0x80, 0x34, 0x3A, 0xC5, 0x6B,
-    0x32, 0x16, 0x4A, 0x5C, 0x2B, 0x51, 0xC1, 0x92, 0xF5, 0xAA, 0x73, 0x3E, 0x0E, 0xE5, 0x91, 0xBA,
-    0x4C, 0x47, 0xEA, 0x8E, 0x4A, 0xD2, 0xF6, 0x38, 0x37, 0x88, 0x17, 0xC1, 0x9B, 0x18, 0x71, 0x0B,
-    0xB6, 0xCD, 0x32, 0xD3, 0xD3, 0xC2, 0x59, 0x40, 0xF3, 0x9E, 0xC2, 0xC2, 0xAE, 0xFE, 0xE0, 0xEA,
-    0x2C, 0xF2, 0xCD, 0xB6, 0xA7, 0xDE, 0xD9, 0xFF, 0xC5, 0xDA, 0x35, 0x0D, 0xE9, 0xC5, 0x49, 0x65,
-    0x27, 0x27, 0x2F, 0xF5, 0xEA, 0xF8, 0xD2, 0x8D, 0x6B, 0xFE, 0x98, 0x6D, 0x74, 0x4C, 0xFC, 0x2B,
-    0x96, 0xFB, 0x77, 0xC1, 0xB5, 0x96, 0xD9, 0xB6, 0x29, 0x4F, 0x02, 0xEC, 0xC4, 0xCE, 0x78, 0x5B,
-    0x74, 0x48, 0xE8, 0xAC, 0x71, 0x63, 0xF6, 0xC9, 0xF3, 0x5E, 0x9E, 0x94, 0x0F, 0xCC, 0x49, 0xD8,
-    0xDB, 0x3F, 0x62, 0x6B, 0x87, 0x77, 0xD8, 0xBA, 0xB0, 0x28, 0xF1, 0x7E, 0xE6, 0x43, 0xFF, 0x3F,
-    0xF4, 0x68, 0x23, 0xFE, 0xA1, 0x02, 0xF2, 0xB9, 0x6B, 0x93, 0xB5, 0xA3, 0xFD, 0x12, 0xB2, 0xB9,
-    0xF3, 0xE7, 0x5C, 0xB7, 0xE1, 0x26, 0x92, 0x70, 0x9C, 0x28, 0x77, 0xA4, 0x27, 0xB6, 0xC9, 0xF4,
-    0x95, 0xEA, 0xF0, 0x35, 0x3F, 0xB8, 0x25, 0x5E, 0xCA, 0xB3, 0xA7, 0x12, 0x6F, 0xB3, 0xA6, 0xA2,
-    0x93, 0xC3, 0x05, 0xF7, 0x48, 0x67, 0xFC, 0x9B, 0x6B, 0x3B, 0x34, 0x26, 0xC1, 0x3C, 0x17, 0x92,
-    0xC7, 0xD6, 0x39, 0x1E, 0xBB, 0xEB, 0xD5, 0xB2, 0xF2, 0x18, 0xBB, 0x1D, 0x2E, 0x2F, 0x92, 0x9B,
-    0x9C, 0xFE, 0x74, 0x86, 0xCF, 0x46, 0x30, 0x15, 0x75, 0x42, 0x72, 0x6A, 0x52, 0x35, 0xEE, 0x85,
-    0x6D, 0x73, 0x5A, 0x41, 0x49, 0x2D, 0x2B, 0xC3, 0x73, 0x39, 0x4E, 0x4B, 0xE8, 0xD3, 0xAC, 0xAE,
-    0x7E, 0xD1, 0xD8, 0xB7, 0x01, 0x29, 0xBF, 0x06, 0x37, 0xBB, 0xFF, 0xC0, 0x47, 0x4B, 0x67, 0x6B,
-    0xD7, 0x01, 0xFF, 0xFA, 0x14, 0x60, 0x90, 0x0C, 0xC9, 0x94, 0x82, 0x43, 0x02, 0x5E, 0x75, 0x24,
-    0x8E, 0xC8, 0xCD, 0x3F, 0x65, 0xED, 0x57, 0xB5, 0x9B, 0x45, 0x91, 0x47, 0xD5, 0x66, 0xFE, 0x6A,
-    0xAF, 0x4D, 0x44, 0x24, 0x7A, 0x0E, 0xC1, 0xF9, 0x8E, 0x97, 0xF6, 0x10, 0xCC, 0x25, 0x4F, 0xD3,
-    0x21, 0xA9, 0x2C, 0x92, 0x9E, 0xD2, 0xE9, 0xE9, 0xBB, 0x7F, 0xEE, 0x0E, 0x9F, 0xF3, 0xBD, 0x27,
-    0x84, 0x41, 0xB1, 0xD1, 0x8B, 0xE6, 0x45, 0xD4, 0xF8, 0x6E, 0x60, 0xA5, 0x98, 0x81, 0x32, 0xE0,
-    0xC9, 0x93, 0x7E, 0xDF, 0xDF, 0xF5, 0xE3, 0x66, 0x19, 0xFD, 0x4F, 0x80, 0x07, 0xFE, 0x12, 0x08,
-    0x46, 0x69, 0xC7, 0x6C, 0xE6, 0x61, 0x5A, 0x53, 0xC1, 0x6D, 0x53, 0x14, 0x74, 0xA5, 0x07, 0xAD,
-    0xCE, 0x26, 0xCC, 0x8A, 0x5F, 0xDA, 0xBC, 0xD7, 0x49, 0x9B, 0x83, 0x5B, 0xA4, 0xBC, 0xE7, 0x6A,
-    0xBC, 0x39, 0xFC, 0x33, 0x1E, 0x96, 0xF6, 0xF0, 0xCE, 0xC0, 0x87, 0x4B, 0x85, 0x87, 0x89, 0xFF,
-    0x35, 0xBC, 0xA6, 0x94, 0xF9, 0xB4, 0x07, 0x2C, 0xFF, 0x32, 0xAA, 0x31, 0x94, 0xA8, 0x58, 0x7C,
-    0x7A, 0x12, 0xCC, 0xB0, 0xC7, 0xC2, 0x0E, 0x55, 0xE7, 0x35, 0x3A, 0x5E, 0x8A, 0x1A, 0x11, 0x98,
-    0xCB, 0xED, 0x87, 0xFE, 0x31, 0xE0, 0xA6, 0x63, 0x2B, 0xA4, 0xE4, 0x8A, 0x5A, 0xEF, 0x5D, 0x4C,
-    0x78, 0xF8, 0x1C, 0xC0, 0x66, 0xC2, 0xF6, 0xFC, 0xFB, 0x4B, 0xE0, 0xF1, 0x67, 0x57, 0xC8, 0x8D,
-    0xC2, 0x41, 0x25, 0x32, 0xC5, 0xE1, 0x4C, 0x84, 0xE6, 0xAC, 0x3D, 0xC8, 0xE5, 0x64, 0x41, 0xDC,
-    0xD8, 0x4D, 0xBE, 0x03, 0x6F, 0xFF, 0x10, 0x38, 0x35, 0x00, 0xAD, 0x27, 0x68, 0x69, 0x21, 0xD3,
-    0xDC, 0xF8, 0x67, 0x51, 0x48, 0x85, 0x93, 0xBF, 0x52, 0xB5, 0xB9, 0x6A, 0xEF, 0xE8, 0xC5, 0xE8,
-    0x06, 0x0C, 0x7F, 0x89, 0x45, 0xF1, 0x7F, 0x81, 0xEF, 0xDF, 0xBA, 0x8F, 0xD9, 0xE1, 0x6A, 0x6C,
-    0xD0, 0xB2, 0xDD, 0x53, 0xB1, 0xD9, 0x4D, 0xF8, 0x37, 0xCA, 0x54, 0x72, 0x65, 0x19, 0x80, 0x11,
-    0x02, 0x86, 0x4B, 0xC9, 0xC1, 0xAC, 0xF1, 0xCE, 0xA2, 0x8E, 0x6F, 0xA8, 0xDE, 0xFC, 0x5A, 0x4F,
-    0x64, 0xC3, 0x13, 0xDB, 0x73, 0x32, 0x7F, 0x8C, 0x47, 0xE1, 0xE4, 0x22, 0xD4, 0x1C, 0xEA, 0xB4,
-    0x87, 0x13, 0x19, 0x66, 0xC9, 0xDC, 0xDB, 0x46, 0xA7, 0x52, 0xC5, 0xC2, 0xCA, 0xA8, 0xE6, 0xB1,
-    0xD9, 0x86, 0x69, 0x52, 0x4B, 0x20, 0x09, 0xD3, 0xEE, 0xBC, 0x19, 0xB3, 0x18, 0xC3, 0x0F, 0xD8,
-    0x82, 0xC8, 0xEE, 0x5F, 0x79, 0x08, 0x75, 0xEC, 0x57, 0x60, 0xBD, 0x23, 0x7B, 0xAF, 0x7F, 0x3F,
-    0xA0, 0x6A, 0x01, 0xE0, 0x9C, 0x95, 0xB7, 0x4B, 0x80, 0x10, 0x1C, 0x75, 0x08, 0x0E, 0xFD, 0x85,
-    0x86, 0xDA, 0x54, 0xE7, 0xF7, 0xA0, 0x85, 0x17, 0xA3, 0xEB, 0xC5, 0x92, 0x4E, 0x7E, 0x29, 0xA6,
-    0x9B, 0x4B, 0x35, 0x45, 0x33, 0x5D, 0x65, 0xF8, 0x52, 0x2C, 0xDC, 0xD1, 0x91, 0x93, 0x0E, 0x37,
-    0xB2, 0xF5, 0x8F, 0x24, 0xF2, 0xD0, 0xB4, 0x52, 0xB0, 0xAA, 0xEB, 0xD8, 0x6E, 0xF1, 0xF6, 0x6F,
-    0x99, 0x41, 0xD8, 0xBF, 0xAF, 0x8B, 0x5F, 0x22, 0x21, 0x9A, 0x1F, 0x31, 0xD0, 0xC8, 0x39, 0x79,
-    0xE2, 0x59, 0xAD, 0xDF, 0x64, 0xC9, 0xF0, 0x3D, 0xBC, 0xEA, 0x8C, 0x7B, 0x15, 0x74, 0x82, 0x4D,
-    0xDF, 0x5C, 0x19, 0xA4, 0x5D, 0x8D, 0x72, 0x5D, 0xB8, 0x40, 0x9D, 0x29, 0x77, 0x76, 0x3C, 0xA4,
-    0x7B, 0x07, 0x7A, 0x51, 0x83, 0x9A, 0x5D, 0xCA, 0x53, 0x09, 0x76, 0x3B, 0xA8, 0xD5, 0xF8, 0x74,
-    0x8A, 0x4A, 0xDB, 0x17, 0xC6, 0x7F, 0xA2, 0x26, 0x5A, 0x8A, 0x1C, 0xC4, 0x7C, 0xA5, 0xC4, 0xF4,
-    0x4D, 0x13, 0x5D, 0xC9, 0x91, 0x24, 0x07, 0xC4, 0x78, 0xD1, 0x3F, 0xC9, 0x0B, 0x9D, 0xB9, 0xA3,
-    0x23, 0xB6, 0xC2, 0x71, 0xE9, 0x5A, 0xFE, 0x4F, 0xF7, 0x2E, 0x53, 0xB6, 0x8C, 0x33, 0x56, 0xAA,
-    0x40, 0x76, 0x1A, 0xFD, 0x7B, 0xFE, 0xF7, 0xF3, 0xDF, 0x40, 0x4F, 0x39, 0x82, 0x6A, 0x42, 0xAE,
-    0xF4, 0x03, 0x0F, 0x2E, 0x6A, 0x08, 0x7D, 0xC6, 0x44, 0xDF, 0x32, 0x2F, 0xB1, 0xA6, 0xFD, 0x00,
-    0x9B, 0x39, 0x62, 0x0B, 0x8F, 0xC1, 0x83, 0x38, 0x2A, 0x10, 0x35, 0xA0, 0x12, 0x0B, 0xAC, 0xE0,
-    0xAE, 0xF1, 0xCF, 0xBA, 0x78, 0x1A, 0x06, 0xF6, 0xE8, 0x2D, 0x11, 0xA1, 0x11, 0xF9, 0x8B, 0xD5,
-    0x40, 0xEA, 0x82, 0x3A, 0xD3, 0x95, 0xA1, 0xC1, 0x1F, 0x6E, 0x84, 0x29, 0x4B, 0xD4, 0x7B, 0x2D,
-    0xD8, 0xFD, 0x67, 0x6E, 0x8A, 0x11, 0x8A, 0x3C, 0x06, 0x2F, 0x5D, 0x09, 0xDE, 0xD2, 0x15, 0xF0,
-    0x8C, 0x6C, 0xE4, 0xF4, 0x89, 0x27, 0x55, 0x7B, 0xC5, 0xBF, 0x8D, 0x12, 0xBB, 0x03, 0x12, 0x73,
-    0x91, 0xC9, 0x72, 0x19, 0x07, 0x55, 0xDA, 0xC3, 0xAB, 0x77, 0xB9, 0xD4, 0x6D, 0x1D, 0x0E, 0xBE,
-    0x2D, 0xAA, 0xD4, 0x56, 0xE2, 0xAC, 0xD4, 0x63, 0xD2, 0xC6, 0x27, 0xD5, 0xD0, 0x4E, 0x89, 0x08,
-    0xB6, 0x03, 0xA3, 0x14, 0x7B, 0xC0, 0xC6, 0x5B, 0x52, 0xD4, 0xD1, 0x7D, 0x19, 0x0A, 0xAE, 0x42,
-    0x91, 0xB5, 0xD2, 0xFB, 0x90, 0x59, 0x43, 0x1F, 0x74, 0x0A, 0x65, 0xD7, 0xCA, 0xC3, 0xD2, 0x4F,
-    0x11, 0x11, 0x87, 0xBD, 0xFB, 0x8F, 0x6B, 0x7E, 0x80, 0xB2, 0x2A, 0x78, 0x2A, 0xE4, 0x34, 0xD5,
-    0x47, 0x50, 0x15, 0x21, 0xC2, 0xFC, 0x0D, 0x4F, 0x3C, 0x5D, 0x9F, 0xA9, 0x8C, 0xAD, 0xBA, 0xC8,
-    0x4D, 0xA1, 0xA6, 0x46, 0xA1, 0x1C, 0xCF, 0x4C, 0x98, 0xD8, 0x5D, 0x6B, 0xA4, 0x35, 0x50, 0x5C,
-    0xD6, 0x5A, 0xEA, 0xC0, 0x65, 0xBD, 0xAA, 0xD7, 0x9C, 0x6D, 0xEB, 0x4F, 0x95, 0xB3, 0x2B, 0x15,
-    0x1C, 0xAA, 0x95, 0x55, 0x97, 0x9D, 0xF4, 0x8F, 0x45, 0x16, 0x36, 0x82, 0xA5, 0x8A, 0x47, 0x95,
-    0xFB, 0x3A, 0xBC, 0x51, 0x97, 0x42, 0xA9, 0x46, 0x59, 0xF9, 0xDF, 0x4D, 0xA8, 0xAF, 0x2F, 0xC0,
-    0x45, 0xB3, 0xDE, 0xFA, 0x87, 0xF4, 0xC6, 0x39, 0x39, 0x72, 0x28, 0x6E, 0xF0, 0xEE, 0x33, 0x14,
-    0x85, 0xDF, 0xD1, 0xE7, 0xBF, 0xBD, 0xF9, 0x0B, 0xD2, 0x2C, 0x20, 0xF8, 0xAD, 0x8E, 0x25, 0x4B,
-    0x75, 0xE8, 0xA7, 0xB4, 0x65, 0x05, 0xBF, 0xFD, 0xCB, 0x1D, 0x36, 0x70, 0xAD, 0x0F, 0x04, 0xBF,
-    0x57, 0x56, 0x13, 0x49, 0xEF, 0x42, 0x91, 0xB0, 0x84, 0x2A, 0x20, 0x6F, 0x8F, 0xE9, 0x7B, 0xD5,
-    0xAA, 0x77, 0xCB, 0xC8, 0x2A, 0xD6, 0x92, 0x81, 0xE5, 0x02, 0x03, 0x6E, 0xFD, 0x13, 0xA3, 0xF0,
-    0xB7, 0x69, 0xBA, 0xBB, 0xBE, 0x5A, 0x11, 0x0E, 0x7F, 0xA0, 0x0E, 0x4C, 0xC2, 0xBF, 0x99, 0xB8,
-    0xB2, 0x9E, 0x06, 0xA1, 0xA6, 0xE2, 0xDF, 0xFB, 0x64, 0x3A, 0x3E, 0x9E, 0xB9, 0x52, 0xA1, 0x63,
-    0xD8, 0x51, 0x8D, 0x49, 0xB3, 0x7D, 0x84, 0x2C, 0x0E, 0xAD, 0x9E, 0x7A, 0xE4, 0x74, 0x52, 0xDB,
-    0x1D, 0x3F, 0xD2, 0x5F, 0x1E, 0xAE, 0x73, 0xE2, 0x97, 0x6A, 0x09, 0x74, 0x23, 0x3B, 0xF9, 0x33,
-    0x22, 0xCA, 0x97, 0xB5, 0xC7, 0xBF, 0xE6, 0x27, 0xBF, 0x66, 0x5B, 0x68, 0x08, 0x91, 0x49, 0x0C,
-    0xF7, 0x61, 0xD3, 0x45, 0x73, 0x5C, 0xBE, 0x64, 0xFD, 0xF1, 0x4E, 0x93, 0x50, 0xB3, 0xDC, 0x5C,
-    0xB4, 0x1D, 0x1E, 0x39, 0x9F, 0xDF, 0x9E, 0xAD, 0x23, 0x14, 0x2F, 0x22, 0xA4, 0x7A, 0xEF, 0xFF,
-    0x7B, 0x72, 0xDF, 0x47, 0xFC, 0xD5, 0x95, 0x8F, 0x9A, 0xC0, 0xAB, 0xCC, 0xFF, 0x00, 0xD5, 0x5A,
-    0x3F, 0xB0, 0xDD, 0x54, 0x7A, 0x3F, 0x92, 0x78, 0xD6, 0x62, 0xED, 0x46, 0x64, 0x06, 0x33, 0x09,
-    0x5E, 0xD0, 0x16, 0x5B, 0x30, 0x64, 0x83, 0x9A, 0x14, 0x29, 0x8C, 0x8F, 0xEC, 0x2D, 0x28, 0x28,
-    0x70, 0x66, 0x78, 0xBB, 0xC9, 0x50, 0xB0, 0x45, 0x76, 0x86, 0xAD, 0xDE, 0x96, 0x14, 0xC6, 0x12,
-    0x50, 0xA6, 0xE0, 0x35, 0x40, 0x91, 0x22, 0x14, 0x64, 0x86, 0x35, 0x05, 0x14, 0x14, 0x4C, 0xC6,
-    0xF8, 0x28, 0x7E, 0x05, 0x25, 0x5A, 0x98, 0xCC, 0x16, 0x14, 0x2B, 0xFE, 0x25, 0x19, 0x5C, 0x58,
-    0x5E, 0x04, 0xAB, 0x87, 0x25, 0x7D, 0xF9, 0xFD, 0xBE, 0xA3, 0x7B, 0xDF, 0x7D, 0xCF, 0xCE, 0x76,
-    0xEB, 0x31, 0x17, 0x9E, 0x7C, 0xAF, 0xA4, 0x73, 0xCE, 0xF7, 0xFF, 0xFB, 0x7D, 0xDF, 0x39, 0x26,
-    0xD8, 0x35, 0x79, 0x13, 0x48, 0x91, 0x4C, 0x26, 0x6B, 0xCD, 0x09, 0xC3, 0xCF, 0x2F, 0x4C, 0x5A,
-    0x9B, 0xD2, 0x84, 0x83, 0x49, 0x5B, 0x63, 0x8B, 0x60, 0x32, 0x49, 0x67, 0x6C, 0x6D, 0xC4, 0xC4,
-    0xA3, 0xC9, 0x5B, 0x23, 0x55, 0x3C, 0x99, 0xBC, 0x33, 0x52, 0xE3, 0x5F, 0xDB, 0x99, 0xDF, 0xE8,
-    0xA8, 0x7B, 0xF0, 0x37, 0xE2, 0xEF, 0x02, 0xFE, 0xF2, 0xC2, 0x70, 0x0E, 0x13, 0x75, 0xC6, 0x04,
-    0x83, 0x31, 0xC7, 0xA4, 0x35, 0xB9, 0x88, 0xB1, 0x22, 0x8D, 0xBD, 0x71, 0xB5, 0xB7, 0xD7, 0xBB,
-    0x87, 0xF2, 0xEE, 0x92, 0x49, 0xFB, 0xD3, 0x98, 0x33, 0x2D, 0xC2, 0x39, 0xC2, 0xF4, 0x67, 0xB0,
-    0x4A, 0x83, 0x9B, 0xC3, 0x69, 0x13, 0x49, 0x5A, 0xBC, 0xED, 0x7E, 0x57, 0xBF, 0x97, 0xCA, 0x37,
-    0x12, 0x88, 0xCC, 0x26, 0x93, 0xC9, 0x18, 0xF7, 0xB9, 0x31, 0xC9, 0x32, 0xAF, 0x19, 0x6E, 0xB1,
-    0xD8, 0xEA, 0x73, 0x72, 0x1F, 0x97, 0x54, 0x7A, 0x63, 0x62, 0x11, 0x3C, 0x93, 0x57, 0x31, 0xDA,
-    0x36, 0x79, 0x63, 0xE2, 0x21, 0x00, 0x95, 0x52, 0xE4, 0x78, 0xCE, 0x01, 0xE1, 0xCC, 0xF7, 0x6D,
-    0x83, 0xCB, 0xCF, 0xA7, 0xED, 0x8A, 0x64, 0x8E, 0x58, 0x5E, 0xA4, 0x32, 0x27, 0xE4, 0xE5, 0x73,
-    0xC6, 0x64, 0xFA, 0x96, 0xAC, 0xDF, 0x8A, 0xC8, 0xA4, 0x29, 0x2B, 0x7C, 0xBB, 0xB6, 0xFF, 0xB3,
-    0xB7, 0x9A, 0x12, 0xEF, 0x8E, 0x58, 0x05, 0xEB, 0x94, 0xED, 0x49, 0xE9, 0xC2, 0x5D, 0x3E, 0x0F,
-    0xF0, 0xFC, 0x7B, 0xC1, 0x70, 0xEC, 0xF5, 0xAC, 0x2A, 0xDF, 0x92, 0x6B, 0x2D, 0x5F, 0x68, 0x4C,
-    0xF9, 0x05, 0x88, 0xC9, 0x6B, 0x2C, 0x9C, 0x36, 0xE1, 0x68, 0xE2, 0xCE, 0x38, 0x03, 0x72, 0x6C,
-    0x05, 0x71, 0x67, 0xB5, 0xC9, 0x1A, 0xE8, 0x20, 0x9B, 0xDD, 0x40, 0x2A, 0xA4, 0xCA, 0x7F, 0x27,
-    0xFF, 0x33, 0x46, 0xF5, 0x96, 0x39, 0xE5, 0x99, 0x3A, 0xB1, 0xFD, 0xE4, 0x89, 0xED, 0x7F, 0xC0,
-    0x3C, 0x22, 0xEF, 0xCB, 0x1C, 0xC9, 0x14, 0x49, 0x05, 0xD5, 0xC5, 0x33, 0xE4, 0x68, 0xD2, 0xD1,
-    0xB8, 0xCA, 0x64, 0x7D, 0x0C, 0xB1, 0xD8, 0x16, 0xDA, 0x32, 0xEE, 0x0A, 0x28, 0xFD, 0x4B, 0xC9,
-    0x3E, 0x31, 0x81, 0xCC, 0x90, 0x1E, 0x49, 0xE8, 0x28, 0x15, 0x4C, 0x75, 0x6F, 0xDE, 0x3F, 0x09,
-    0x29, 0xF0, 0x06, 0x79, 0xC5, 0xDB, 0x98, 0x82, 0x1C, 0xD6, 0xA4, 0x5D, 0x99, 0x4D, 0x46, 0xFD,
-    0x4A, 0xF1, 0x58, 0x5E, 0x03, 0x1D, 0xAD, 0x1F, 0x98, 0x45, 0x59, 0x80, 0x7E, 0xF0, 0x01, 0xD2,
-    0x31, 0x73, 0x0F, 0xA6, 0x60, 0x1E, 0xD1, 0x00, 0x16, 0x16, 0x23, 0x3A, 0xF8, 0xDC, 0x5F, 0xAD,
-    0x1F, 0x39, 0x4A, 0x8F, 0x46, 0x55, 0xAD, 0x8D, 0x4A, 0xC5, 0x7F, 0x1F, 0x64, 0x56, 0x4A, 0x61,
-    0xB8, 0xC4, 0x0C, 0x23, 0x13, 0xC8, 0xC3, 0xD5, 0x69, 0x61, 0x41, 0xD4, 0x23, 0x25, 0x16, 0x7C,
-    0xA9, 0x37, 0x51, 0x0B, 0x95, 0x8C, 0x29, 0x64, 0x53, 0xB8, 0x3A, 0x26, 0x9F, 0x52, 0x94, 0x30,
-    0x96, 0xA4, 0x81, 0x21, 0x0E, 0x20, 0xF7, 0x34, 0x58, 0x7E, 0xA9, 0x32, 0xF1, 0x57, 0xCD, 0x5D,
-    0xC6, 0x75, 0x59, 0x91, 0x0E, 0x69, 0x1B, 0x8D, 0xD1, 0x14, 0x4D, 0x98, 0x77, 0x02, 0xDF, 0x60,
-    0x68, 0xE7, 0x73, 0xCF, 0x40, 0xFD, 0x9E, 0xFD, 0x70, 0xB6, 0x7B, 0xB3, 0x3D, 0x3B, 0xDC, 0x65,
-    0x8A, 0x15, 0xA5, 0x99, 0xF0, 0xB1, 0xFB, 0xD2, 0x41, 0xCF, 0xA0, 0xEB, 0xB2, 0x1A, 0x74, 0xD4,
-    0xAA, 0xA5, 0x9D, 0x36, 0xE7, 0x8D, 0x1B, 0xA2, 0xFA, 0x51, 0x4C, 0x66, 0xDE, 0xCD, 0xCC, 0x9C,
-    0xD4, 0x69, 0x52, 0x5C, 0x0E, 0xBA, 0xF0, 0xA3, 0xDA, 0xC2, 0xF8, 0x9F, 0xED, 0x68, 0x83, 0x0F,
-    0x9E, 0x82, 0x4E, 0x4D, 0xFC, 0x01, 0x6D, 0x2C, 0xF8, 0xAC, 0x2E, 0x31, 0xF5, 0xB3, 0xEF, 0xD0,
-    0xCE, 0xFE, 0xF6, 0xC1, 0x50, 0x5E, 0x69, 0xD2, 0xA8, 0xB6, 0xD2, 0xC5, 0xF5, 0xBB, 0xA1, 0xF4,
-    0x51, 0x93, 0x16, 0x81, 0x09, 0x3B, 0x03, 0x1E, 0x71, 0xCD, 0x2A, 0x9A, 0x83, 0x91, 0x97, 0x77,
-    0x5A, 0x35, 0x5A, 0xD8, 0x8F, 0xD9, 0xFA, 0x77, 0x52, 0xB5, 0x85, 0xDF, 0xF3, 0x08, 0xF1, 0x17,
-    0xF6, 0xB1, 0x2E, 0x6D, 0x4E, 0x9B, 0x31, 0x69, 0xB2, 0x62, 0x0C, 0xFB, 0xBC, 0xCA, 0x1F, 0x1B,
-    0x5E, 0x10, 0xB9, 0x94, 0x4D, 0x52, 0x5D, 0x4E, 0x5A, 0xE5, 0x21, 0x78, 0x0D, 0xB6, 0x03, 0x9D,
-    0x36, 0x27, 0xB6, 0xB1, 0x78, 0x58, 0x84, 0xB0, 0xAD, 0xA2, 0xAC, 0x92, 0x91, 0x62, 0xAD, 0x5D,
-    0x9D, 0x0D, 0x29, 0xE6, 0xAA, 0xA4, 0xC6, 0x1D, 0x78, 0x71, 0x9F, 0x0D, 0x70, 0xE1, 0x9C, 0x9E,
-    0x67, 0xA1, 0xD5, 0x1A, 0x26, 0x6E, 0x2B, 0xA8, 0xE5, 0x21, 0xFC, 0x47, 0x63, 0x87, 0x71, 0x5C,
-    0xC3, 0x9F, 0xA3, 0x0B, 0x52, 0x89, 0xD4, 0x1E, 0x95, 0x4E, 0xF9, 0x84, 0xAF, 0x9F, 0xD8, 0x3E,
-    0x23, 0xF2, 0xB1, 0xC8, 0x8E, 0x4C, 0x27, 0xB6, 0xCF, 0x99, 0x60, 0x9B, 0xE2, 0x03, 0xE9, 0xE9,
-    0x2E, 0xB4, 0x02, 0x95, 0xD5, 0xC9, 0xFD, 0xBF, 0x89, 0xEA, 0x67, 0xCB, 0xCB, 0xF1, 0xD9, 0xFA,
-    0xFC, 0xF9, 0x34, 0x0D, 0xAE, 0x77, 0x3F, 0x39, 0x15, 0xFF, 0xBE, 0x78, 0xBB, 0xCD, 0xFA, 0x70,
-    0xAF, 0x7E, 0xAE, 0x4B, 0x92, 0xE0, 0xAB, 0xEE, 0xD4, 0x03, 0xD9, 0x67, 0xD7, 0xDB, 0x53, 0x27,
-    0xCE, 0x3C, 0x41, 0x4B, 0x7F, 0xC7, 0x3C, 0x67, 0xB2, 0x02, 0x1E, 0x00, 0xB9, 0x1C, 0x7B, 0x03,
-    0xE6, 0x73, 0xF1, 0x0D, 0x2B, 0x93, 0x95, 0x11, 0xE6, 0x6F, 0x76, 0x76, 0x29, 0x7E, 0x98, 0x89,
-    0x7B, 0x75, 0x02, 0x9D, 0x2F, 0xD5, 0xE9, 0x67, 0x7D, 0x34, 0xCC, 0x66, 0xCA, 0xFF, 0x9B, 0x4C,
-    0x17, 0x30, 0xA2, 0x00, 0xE1, 0x68, 0x0B, 0xAC, 0x3B, 0x10, 0x08, 0x2D, 0xC0, 0xCA, 0x68, 0x9C,
-    0xF8, 0x79, 0xFC, 0xCD, 0xF9, 0x22, 0x9C, 0x75, 0x06, 0x3B, 0xFB, 0xDB, 0x6E, 0xBB, 0x38, 0xFC,
-    0x54, 0x5F, 0x0E, 0xCE, 0xDD, 0xCC, 0xB4, 0xFF, 0x04, 0xF0, 0x5E, 0x70, 0x96, 0x5F, 0x1D, 0xA3,
-    0x2E, 0x6B, 0x4E, 0x51, 0xBF, 0x90, 0x12, 0x86, 0x73, 0x98, 0x68, 0x3C, 0x80, 0x7D, 0x27, 0xEA,
-    0x4E, 0x3D, 0xC2, 0x5C, 0x70, 0xF1, 0xA2, 0xC6, 0x81, 0xBC, 0x0F, 0xE1, 0xA7, 0xFB, 0x12, 0xD7,
-    0x65, 0x00, 0x83, 0xC2, 0xDB, 0x3B, 0x5D, 0x20, 0x5D, 0x70, 0x75, 0xA4, 0xE3, 0xE3, 0xFF, 0x78,
-    0x38, 0xE1, 0x3A, 0xCC, 0x5C, 0x0E, 0x7E, 0xA1, 0xD8, 0xD8, 0x70, 0xCA, 0x3A, 0x49, 0x7A, 0x6B,
-    0x7E, 0xAD, 0x2B, 0x3F, 0x69, 0xEE, 0xD3, 0x80, 0x05, 0x1B, 0xE9, 0xA2, 0x99, 0xA1, 0x88, 0x4A,
-    0x6A, 0xA1, 0x4F, 0x58, 0xB6, 0xAB, 0x41, 0x47, 0x32, 0x30, 0x32, 0xC3, 0x7F, 0xCA, 0x0A, 0xB6,
-    0x96, 0x0C, 0x74, 0x60, 0x1D, 0x90, 0xF6, 0x18, 0x80, 0xAF, 0x0E, 0x61, 0xA5, 0xCF, 0xE6, 0x20,
-    0x94, 0xAB, 0x37, 0xBE, 0xED, 0x72, 0x99, 0x4A, 0x84, 0x0F, 0x79, 0x51, 0x6A, 0x5B, 0x22, 0xE4,
-    0xC4, 0xDD, 0x39, 0x18, 0xB0, 0x53, 0xC7, 0x50, 0x17, 0x57, 0xFF, 0xCF, 0x36, 0xA2, 0x23, 0xA3,
-    0x42, 0xF4, 0x9A, 0x27, 0x70, 0xCB, 0x41, 0x14, 0x31, 0x3D, 0x0A, 0x53, 0xCC, 0xF4, 0x59, 0x68,
-    0xCB, 0xCA, 0x1F, 0xB0, 0xB0, 0x48, 0xCE, 0xA0, 0xF2, 0x59, 0x0B, 0x67, 0x9B, 0x4E, 0x33, 0x62,
-    0xBC, 0xDF, 0xC0, 0xA9, 0xC6, 0x4B, 0xFC, 0xFA, 0x2F, 0x35, 0x03, 0x32, 0xA5, 0x25, 0x4F, 0xC0,
-    0xD6, 0xE5, 0x3A, 0xF4, 0x9B, 0x94, 0x19, 0x67, 0xFE, 0x94, 0x4B, 0x3D, 0x6A, 0xC9, 0xFD, 0x1E,
-    0xAD, 0xF8, 0xD2, 0x73, 0x24, 0xE5, 0x7D, 0xAE, 0x3A, 0x30, 0x0A, 0x65, 0x29, 0xA3, 0xED, 0x57,
-    0x7C, 0xEB, 0x02, 0xE2, 0xF8, 0x2F, 0x52, 0xB0, 0x9A, 0x5E, 0xA5, 0x8B, 0x94, 0x13, 0x25, 0xA4,
-    0x09, 0x28, 0xD9, 0x9B, 0xCB, 0xAB, 0x13, 0x4D, 0xF3, 0x5C, 0x34, 0x1D, 0x9B, 0x91, 0x1A, 0xC6,
-    0xA8, 0xCF, 0x9B, 0xBF, 0x56, 0xA2, 0xE1, 0x2A, 0x48, 0x23, 0x43, 0xB0, 0xD3, 0x30, 0xB1, 0x2D,
-    0x31, 0x88, 0x91, 0xAB, 0xA3, 0xFA, 0x67, 0x73, 0x72, 0x3E, 0x2B, 0xF3, 0xF1, 0x8B, 0xAF, 0x63,
-    0x30, 0x48, 0xAB, 0x12, 0xE9, 0x93, 0xAE, 0x84, 0xA6, 0xAF, 0x0C, 0x71, 0x37, 0x85, 0x83, 0x35,
-    0x53, 0x5A, 0xBB, 0x68, 0x70, 0x8C, 0x52, 0xF1, 0x62, 0x14, 0xF7, 0x05, 0x1A, 0x8A, 0xDB, 0x13,
-    0xB4, 0xFA, 0x5D, 0x66, 0xCD, 0x2E, 0xA1, 0x8E, 0x18, 0x15, 0x3B, 0x48, 0x0F, 0x51, 0x18, 0xF1,
-    0xBD, 0x29, 0x91, 0x28, 0x0B, 0xA9, 0xD2, 0x11, 0x29, 0x16, 0x0E, 0xD8, 0x20, 0x62, 0x41, 0x57,
-    0x15, 0xC2, 0x1B, 0x63, 0xD8, 0x71, 0x73, 0xAC, 0x38, 0x12, 0x2F, 0x23, 0xFA, 0x2D, 0x33, 0x0D,
-    0x34, 0x72, 0x92, 0xAA, 0x40, 0x52, 0x88, 0x91, 0x40, 0x35, 0xF3, 0xFC, 0xCD, 0xE4, 0x1F, 0x30,
-    0x5D, 0xD0, 0xE2, 0xD4, 0xFE, 0xE8, 0x97, 0x6A, 0xC6, 0x7C, 0x9B, 0x3F, 0xF8, 0x10, 0x99, 0xDB,
-    0x44, 0xBD, 0x49, 0x0A, 0x86, 0x95, 0x99, 0x83, 0x9D, 0x3E, 0x00, 0x29, 0x2D, 0x73, 0xA5, 0xED,
-    0x91, 0x3B, 0x0C, 0xE3, 0x62, 0x08, 0x97, 0xCA, 0x2B, 0xC8, 0xD7, 0x4A, 0x0B, 0x0E, 0x46, 0x2A,
-    0x82, 0x59, 0x29, 0xA6, 0x2E, 0x6C, 0x95, 0x36, 0xEF, 0xA9, 0x65, 0x44, 0xFB, 0x4F, 0x7F, 0xAE,
-    0xEB, 0x95, 0x4C, 0x65, 0x88, 0x2A, 0x11, 0x53, 0xA5, 0x9A, 0x0C, 0xA0, 0x82, 0xCF, 0x8B, 0x96,
-    0x8E, 0x57, 0xF8, 0x5C, 0x9C, 0xAC, 0xD2, 0xC5, 0xF7, 0xCD, 0x9F, 0xF8, 0xFC, 0xD0, 0x78, 0x6E,
-    0x41, 0xAA, 0xE7, 0x56, 0x8C, 0xE7, 0x96, 0xCC, 0x91, 0x5B, 0x65, 0x2E, 0x5B, 0x98, 0x23, 0xB7,
-    0x64, 0x94, 0x17, 0x8E, 0xD0, 0xA7, 0xDE, 0x46, 0x11, 0x32, 0xEA, 0xE4, 0x7F, 0xA9, 0xD1, 0xB8,
-    0x83, 0xFE, 0xC8, 0xED, 0x04, 0xCE, 0x6A, 0x70, 0x9B, 0x57, 0xE5, 0xD9, 0x91, 0x99, 0x12, 0xA1,
-    0x37, 0xBF, 0x02, 0x6E, 0x47, 0x73, 0x57, 0x34, 0x80, 0x5B, 0xEB, 0xE3, 0x84, 0x0F, 0x03, 0x8D,
-    0x72, 0xED, 0x5D, 0x00, 0x81, 0x5B, 0xF9, 0xC1, 0xE0, 0x60, 0x5E, 0x92, 0x3E, 0xF9, 0xE2, 0xC5,
-    0x7E, 0x7B, 0x51, 0x75, 0x12, 0x69, 0xF6, 0x64, 0x20, 0x20, 0x34, 0xB1, 0x2B, 0x35, 0xBE, 0xF6,
-    0xA7, 0xB8, 0x8D, 0x89, 0x4D, 0x28, 0xD6, 0x99, 0xD9, 0xA6, 0xD1, 0x55, 0x31, 0x0F, 0x1E, 0x80,
-    0x8F, 0xE7, 0x34, 0x01, 0x30, 0x68, 0x5F, 0x58, 0x7C, 0x0E, 0x6C, 0xC7, 0xE4, 0xF2, 0x24, 0x2E,
-    0x93, 0x26, 0x28, 0x1F, 0x7C, 0x61, 0xCA, 0xA4, 0x39, 0x29, 0xF8, 0xC6, 0x48, 0x22, 0xA8, 0x2F,
-    0xF8, 0x62, 0x85, 0xC7, 0x48, 0x04, 0xC8, 0x9B, 0x08, 0x33, 0x30, 0x73, 0x49, 0xA0, 0x22, 0x4B,
-    0xDF, 0x71, 0x13, 0x99, 0x19, 0x2D, 0xC2, 0x49, 0xB8, 0xD2, 0x2D, 0xD2, 0xA7, 0xD7, 0x6D, 0xE3,
-    0x75, 0x1B, 0xAD, 0x74, 0xEB, 0x8C, 0xD7, 0xAD, 0x1A, 0xD8, 0xB0, 0xE8, 0x80, 0x1C, 0xAA, 0x81,
-    0x11, 0x44, 0x34, 0x0B, 0x43, 0x7F, 0x75, 0x94, 0xC3, 0x73, 0x14, 0x8D, 0xD4, 0x88, 0x3B, 0x10,
-    0xE4, 0x16, 0xEF, 0x84, 0xAF, 0x99, 0xB2, 0x8B, 0xA4, 0xD9, 0x2A, 0x0B, 0x90, 0x94, 0x35, 0x21,
-    0xD2, 0x0E, 0x2F, 0x98, 0x5C, 0x41, 0x40, 0x5E, 0xDF, 0xE5, 0x5E, 0xB9, 0x2E, 0xB2, 0xC7, 0xBC,
-    0xD5, 0x87, 0x73, 0x71, 0x48, 0x5A, 0x0B, 0xAA, 0x04, 0x2D, 0x0A, 0x50, 0x8C, 0x68, 0x9A, 0x8B,
-    0x09, 0x59, 0x90, 0x1F, 0xFC, 0x23, 0x82, 0xAD, 0xF5, 0x27, 0xD0, 0xF1, 0x1E, 0xA5, 0x19, 0xFF,
-    0x5A, 0x3E, 0xF9, 0x31, 0x4A, 0xB4, 0x8F, 0xE9, 0xD9, 0x35, 0xAA, 0x19, 0x81, 0x99, 0x3F, 0x9C,
-    0xEA, 0x3C, 0x6D, 0x85, 0x96, 0x4B, 0x88, 0x41, 0x03, 0x70, 0x04, 0x45, 0x1D, 0x51, 0x10, 0x68,
-    0x2D, 0xF1, 0xC3, 0xFE, 0xD7, 0x53, 0x13, 0xE1, 0x13, 0x5C, 0x9E, 0xF1, 0x8C, 0x5A, 0xB3, 0x5F,
-    0x5E, 0x74, 0x0C, 0xB8, 0x8A, 0x0F, 0x85, 0xD1, 0x9E, 0xF8, 0x18, 0xE9, 0xF5, 0x24, 0xB8, 0x70,
-    0xF2, 0x38, 0x0C, 0xA3, 0x94, 0x11, 0x46, 0x98, 0x88, 0xA7, 0xE4, 0x90, 0x47, 0x24, 0x4A, 0x8F,
-    0x0F, 0x27, 0xE1, 0x42, 0x9C, 0x32, 0x99, 0x2B, 0x4A, 0x09, 0x76, 0xCD, 0x77, 0x85, 0xAD, 0x37,
-    0x94, 0x2A, 0xAB, 0x0E, 0x9F, 0x2A, 0x74, 0x89, 0x66, 0x25, 0x4E, 0x34, 0x08, 0x94, 0x75, 0x4E,
-    0x16, 0x77, 0xCD, 0x26, 0x47, 0xF7, 0x9A, 0x75, 0x6A, 0x21, 0x78, 0x3D, 0x90, 0x81, 0xC6, 0x74,
-    0x4C, 0x43, 0x45, 0x07, 0xB3, 0x07, 0xDE, 0xFF, 0xD6, 0xA9, 0x97, 0xEA, 0x8F, 0x59, 0xA1, 0xAA,
-    0xAD, 0xB9, 0x4E, 0xDC, 0x2B, 0x4C, 0x15, 0xE6, 0x41, 0x58, 0x55, 0xCC, 0x60, 0x38, 0x6D, 0x13,
-    0xBF, 0x89, 0x26, 0xEF, 0xCC, 0x43, 0xDC, 0xF9, 0xE2, 0x9B, 0x18, 0x0A, 0x7C, 0xCC, 0x9C, 0x88,
-    0x9C, 0x2D, 0x05, 0x13, 0x5B, 0x36, 0x04, 0x28, 0x28, 0x10, 0x2B, 0x90, 0xD1, 0x90, 0xD0, 0x3E,
-    0x80, 0xC5, 0x3B, 0x19, 0x0F, 0xE2, 0xF0, 0xF0, 0x17, 0xCA, 0x82, 0x66, 0x27, 0x56, 0x2F, 0xB8,
-    0x75, 0x5D, 0x49, 0xFC, 0x61, 0xDC, 0xDF, 0xEC, 0xDA, 0x77, 0x30, 0x3F, 0xF7, 0x2A, 0xC4, 0x4D,
-    0x5B, 0xA7, 0x44, 0xF9, 0xE5, 0x3E, 0xD1, 0x70, 0x3A, 0xAC, 0x1D, 0xF9, 0x3B, 0x62, 0x69, 0x0A,
-    0xD0, 0x8C, 0xD3, 0x20, 0x90, 0x7B, 0x4B, 0x43, 0xC9, 0x88, 0xCF, 0x79, 0xD6, 0x85, 0x26, 0xAE,
-    0x15, 0x46, 0x59, 0xB7, 0xC2, 0x6C, 0x66, 0x05, 0xEA, 0xEE, 0x68, 0xB6, 0x88, 0x38, 0xD5, 0x3E,
-    0xAC, 0x2C, 0x98, 0x73, 0x67, 0xB9, 0x81, 0x88, 0xB8, 0xA5, 0x54, 0x5E, 0x16, 0x2D, 0x72, 0x4D,
-    0xF6, 0x41, 0xA7, 0x01, 0x31, 0xBE, 0x3E, 0x03, 0x3C, 0xE0, 0x33, 0xE5, 0x5E, 0x85, 0xF6, 0x45,
-    0xCF, 0x5A, 0xD2, 0x79, 0x1B, 0x0C, 0xA7, 0xD8, 0x57, 0x6C, 0x65, 0xE1, 0xE7, 0x4C, 0xDB, 0x54,
-    0x57, 0x8B, 0x26, 0x5F, 0xE0, 0xF9, 0xF2, 0xCF, 0xDB, 0xB6, 0xAE, 0x19, 0x4F, 0xDB, 0x65, 0x83,
-    0x32, 0x07, 0x8F, 0x81, 0x2C, 0x53, 0x22, 0x4B, 0x30, 0xC8, 0x34, 0xD2, 0xB3, 0x1A, 0x2C, 0xEB,
-    0x18, 0x29, 0x14, 0x83, 0x86, 0x48, 0xE6, 0x50, 0x19, 0xB5, 0x28, 0xE7, 0x57, 0xB3, 0x10, 0x05,
-    0x9D, 0x24, 0x20, 0xC4, 0x9D, 0x9E, 0x79, 0x04, 0xD6, 0x37, 0x9F, 0x41, 0x25, 0xC7, 0xE2, 0x10,
-    0xA1, 0x21, 0x69, 0x91, 0x95, 0x00, 0xA9, 0x20, 0xC5, 0x73, 0xE9, 0xA4, 0xAC, 0xA9, 0x8E, 0xAA,
-    0x95, 0x3E, 0x2D, 0xE5, 0x9B, 0x6A, 0xB6, 0xD5, 0x9B, 0x3A, 0x6D, 0x0E, 0xA6, 0xBE, 0x97, 0x80,
-    0xEC, 0xCC, 0x40, 0x68, 0x3B, 0xB5, 0x2E, 0x17, 0xE9, 0x9A, 0x76, 0x11, 0x38, 0xDF, 0x7D, 0x72,
-    0xED, 0x81, 0x5A, 0xA3, 0x67, 0x2A, 0x8A, 0x0B, 0x0B, 0x2E, 0xF0, 0x39, 0x93, 0xEE, 0x82, 0x6A,
-    0xE2, 0x68, 0x36, 0x5E, 0xDE, 0xF0, 0x74, 0xF8, 0x85, 0x43, 0x6F, 0x1D, 0x9A, 0xEF, 0x8F, 0x26,
-    0x38, 0xB2, 0x5D, 0x40, 0x6B, 0x20, 0x66, 0xE5, 0x8B, 0xC1, 0x4E, 0xCD, 0xE4, 0x84, 0x32, 0xD5,
-    0xD5, 0xC1, 0x40, 0xB6, 0xE2, 0x7A, 0x89, 0x00, 0xA5, 0xFA, 0x3C, 0xCD, 0x87, 0xE0, 0x78, 0x50,
-    0xFD, 0x7A, 0x5F, 0x5E, 0xC5, 0xFD, 0xBC, 0x5F, 0x9B, 0x23, 0x06, 0x86, 0x40, 0xCE, 0x03, 0x73,
-    0x3A, 0xF4, 0x40, 0xA4, 0x5F, 0x9C, 0x54, 0x49, 0xAA, 0x9D, 0xF8, 0xF6, 0x89, 0xF4, 0x47, 0xD3,
-    0x48, 0x30, 0xAC, 0x63, 0x6F, 0xE2, 0xE5, 0x36, 0xA8, 0x2E, 0x79, 0xF7, 0x6E, 0x73, 0x27, 0x52,
-    0x1F, 0xBE, 0xAD, 0x63, 0x7D, 0x5F, 0x45, 0x95, 0x7C, 0x8D, 0xE8, 0x76, 0x22, 0xC8, 0xB3, 0x35,
-    0xDB, 0x39, 0x6F, 0x98, 0x1F, 0x1F, 0xA2, 0x9B, 0x43, 0x1B, 0x35, 0x39, 0x35, 0x40, 0x16, 0x11,
-    0xD5, 0x53, 0x1D, 0x99, 0xC4, 0x18, 0x4C, 0x74, 0x81, 0x44, 0x04, 0x9D, 0x37, 0x29, 0x93, 0xA9,
-    0x44, 0xCA, 0x46, 0xE7, 0xA7, 0x69, 0xA7, 0xBA, 0xB0, 0xA5, 0xF5, 0x7B, 0x3D, 0x27, 0xD3, 0x41,
-    0xBE, 0xC2, 0xCD, 0x77, 0x21, 0x07, 0x02, 0x47, 0xC8, 0x01, 0x96, 0xE2, 0x9A, 0x63, 0x8B, 0x78,
-    0x74, 0xC5, 0x3A, 0x55, 0x79, 0x31, 0xF6, 0x04, 0x8A, 0x83, 0x59, 0xD4, 0xBB, 0x3D, 0x96, 0xC3,
-    0x73, 0xA6, 0x30, 0xD7, 0x16, 0x37, 0x67, 0x83, 0x54, 0x99, 0x75, 0xA4, 0x7B, 0x15, 0x13, 0xDA,
-    0xFB, 0x46, 0xA3, 0x20, 0x94, 0xCE, 0x84, 0x72, 0x1F, 0xCB, 0x9F, 0x5F, 0x84, 0xE7, 0xA5, 0xE9,
-    0x11, 0x8E, 0xA3, 0x45, 0x47, 0xBA, 0x64, 0xAA, 0xAE, 0xA5, 0x6A, 0x08, 0x55, 0x0D, 0x5E, 0x2F,
-    0x18, 0xF8, 0x08, 0x25, 0xC0, 0xEA, 0x51, 0x51, 0x5D, 0xDE, 0x07, 0x6E, 0x11, 0x8C, 0x5B, 0xF9,
-    0x87, 0x6C, 0xE2, 0x51, 0xBB, 0xE8, 0x2A, 0xD6, 0x9A, 0x09, 0xE2, 0x09, 0xDC, 0x3A, 0x22, 0xAE,
-    0x2C, 0xA3, 0xD3, 0x64, 0x91, 0xA9, 0x9E, 0x3B, 0x2F, 0x44, 0x8A, 0x49, 0x45, 0x4A, 0x22, 0x6F,
-    0x7D, 0xB3, 0xBD, 0xC5, 0x4D, 0x12, 0xCC, 0xD5, 0x76, 0x64, 0x57, 0xE7, 0xB4, 0x07, 0x65, 0xB4,
-    0x09, 0xF0, 0x3C, 0xEC, 0x3D, 0xC7, 0x09, 0x68, 0xCC, 0xF0, 0x97, 0xEC, 0x1F, 0x01, 0x3B, 0xB7,
-    0x81, 0x98, 0x90, 0x42, 0xA5, 0x34, 0x2C, 0xED, 0xE3, 0x46, 0x8F, 0x02, 0x3A, 0xAF, 0x03, 0x56,
-    0x06, 0xC7, 0x8B, 0xF0, 0x88, 0x5C, 0x98, 0xFB, 0x7D, 0x9C, 0xE1, 0x84, 0x5C, 0x41, 0xB5, 0x41,
-    0x1A, 0x74, 0x19, 0x7E, 0x51, 0x0D, 0x32, 0x4F, 0xAB, 0x8A, 0xB4, 0xA1, 0x36, 0x2C, 0x51, 0x85,
-    0xAB, 0xDF, 0xFC, 0x1E, 0xE9, 0xE1, 0xC4, 0x91, 0x8F, 0xF3, 0xB4, 0x2D, 0xFB, 0x02, 0x42, 0xED,
-    0x08, 0xBB, 0x95, 0xC7, 0x59, 0xA1, 0x96, 0xC5, 0x4D, 0x26, 0x45, 0x7B, 0xEE, 0xBC, 0x58, 0xB8,
-    0xCE, 0xCD, 0xD3, 0xEB, 0x17, 0xB2, 0xAC, 0x16, 0xAE, 0x64, 0x8C, 0x0B, 0xA3, 0x37, 0xD3, 0xBD,
-    0x7A, 0xEF, 0x98, 0xEC, 0xFB, 0x89, 0x17, 0xD9, 0x6C, 0x6D, 0x17, 0xDE, 0x0E, 0x59, 0xE5, 0x69,
-    0xDF, 0x52, 0x1D, 0xB8, 0x32, 0xBF, 0x94, 0xE7, 0x51, 0x46, 0xC0, 0x4E, 0x03, 0x21, 0xE8, 0xC0,
-    0x2C, 0x05, 0x67, 0xCB, 0xD9, 0x30, 0x05, 0x31, 0x35, 0x67, 0x4C, 0xD5, 0x28, 0xB1, 0xF4, 0xC3,
-    0xF2, 0xE5, 0x2E, 0x8A, 0x5E, 0x3A, 0xA0, 0xD4, 0x6F, 0xCA, 0x97, 0x15, 0x82, 0x72, 0xC6, 0x8C,
-    0x58, 0x91, 0x0A, 0xE4, 0x02, 0x8C, 0x8C, 0x45, 0x29, 0xC1, 0x0A, 0xF8, 0x81, 0xF8, 0x1F, 0xCF,
-    0x5A, 0xE2, 0xB8, 0x2F, 0x76, 0x38, 0x99, 0xA6, 0xC0, 0x5C, 0xAF, 0xB4, 0xE8, 0xDD, 0x5B, 0xD4,
-    0x53, 0x69, 0xFB, 0xF7, 0xFA, 0xCF, 0x9C, 0x1B, 0x1F, 0xA5, 0xEA, 0x03, 0x94, 0x66, 0x7E, 0x9D,
-    0x35, 0xFF, 0x5F, 0x1D, 0x96, 0xE2, 0x45, 0x0D, 0x4C, 0x8C, 0x50, 0x1D, 0x7B, 0x4A, 0x89, 0xAE,
-    0xD2, 0x30, 0xE7, 0xB1, 0xBA, 0x62, 0x9B, 0xCB, 0x89, 0x56, 0x5F, 0xA8, 0x13, 0x43, 0x75, 0x46,
-    0xF6, 0x25, 0x4D, 0x74, 0x43, 0x0A, 0xBE, 0x33, 0x95, 0x9D, 0xBE, 0x93, 0x4E, 0xFA, 0xCE, 0x7F,
-    0xCA, 0x15, 0xAD, 0x1D, 0x6D, 0xA7, 0xC5, 0x5C, 0x32, 0xE3, 0x1D, 0x8C, 0x92, 0xDF, 0xF3, 0x1D,
-    0xDF, 0xCC, 0xB2, 0x75, 0xA4, 0xF5, 0x72, 0xCB, 0x89, 0x39, 0x73, 0x06, 0x91, 0x86, 0x6C, 0xA3,
-    0xB4, 0x90, 0x4A, 0xCB, 0x44, 0x19, 0x43, 0x58, 0xA9, 0xB6, 0x9F, 0x8B, 0x25, 0x47, 0x2F, 0xB0,
-    0x72, 0x33, 0x5F, 0x79, 0xC8, 0xE6, 0x83, 0x5C, 0xBA, 0x14, 0x0F, 0x1E, 0xCE, 0x34, 0x47, 0x8B,
-    0x21, 0x55, 0x64, 0x2E, 0xAA, 0x79, 0x46, 0x84, 0x54, 0xB5, 0x69, 0xE7, 0x9F, 0x91, 0xE7, 0x0E,
-    0x91, 0x80, 0x23, 0xED, 0x48, 0x3D, 0x66, 0x50, 0x15, 0x66, 0x9D, 0x98, 0x9A, 0xD3, 0x89, 0x09,
-    0x34, 0x9D, 0x98, 0x7C, 0xB3, 0x89, 0x79, 0x39, 0x1B, 0x79, 0xCD, 0xF5, 0x6A, 0x07, 0xBD, 0xF6,
-    0xBC, 0xBA, 0xCE, 0x32, 0x18, 0x37, 0x39, 0xD9, 0x40, 0xA4, 0x64, 0x77, 0x39, 0x91, 0x2F, 0x9C,
-    0x36, 0x87, 0x18, 0xBC, 0xD4, 0x6E, 0xBC, 0xC5, 0x1E, 0xE6, 0xC5, 0x98, 0x1F, 0x98, 0x75, 0x92,
-    0xF6, 0x71, 0x3B, 0x57, 0x66, 0xF4, 0x55, 0x9F, 0x75, 0x0E, 0xD5, 0x0B, 0x77, 0x26, 0x2F, 0xC7,
-    0xEB, 0x75, 0x2E, 0x33, 0x6E, 0xD4, 0x8E, 0x99, 0x62, 0xAD, 0xBE, 0x54, 0x2C, 0xC2, 0x64, 0xF6,
-    0xF0, 0x66, 0x1A, 0xBE, 0x83, 0x35, 0x12, 0x0E, 0x89, 0x7A, 0x06, 0x69, 0xCE, 0xB4, 0xDC, 0xC9,
-    0xD5, 0xBC, 0x7E, 0x10, 0xDD, 0x54, 0xED, 0xDC, 0x91, 0x5C, 0x04, 0xC5, 0x5D, 0xEB, 0xFC, 0x9C,
-    0x77, 0x1A, 0xDB, 0xAF, 0xD3, 0x8C, 0xB2, 0x7A, 0xFA, 0x4E, 0xD0, 0x6F, 0xCC, 0x43, 0xE6, 0xFB,
-    0xE1, 0x60, 0xA6, 0xAC, 0x4F, 0xC7, 0xAC, 0x97, 0x3A, 0xD3, 0x14, 0x58, 0x2B, 0x06, 0x46, 0x00,
-    0xE1, 0x76, 0x96, 0x5C, 0x43, 0x81, 0x98, 0xF7, 0x28, 0xA8, 0xBB, 0xF3, 0x26, 0x47, 0x59, 0x77,
-    0x8F, 0x6E, 0x0C, 0x9D, 0x33, 0x95, 0xF2, 0x03, 0xCC, 0x8E, 0x18, 0x38, 0x4D, 0x1E, 0xE9, 0x35,
-    0x18, 0xF2, 0x32, 0x03, 0xB6, 0xB2, 0x64, 0xC8, 0x07, 0x83, 0x3C, 0x13, 0x48, 0x1D, 0x72, 0xEB,
-    0x48, 0x0A, 0x04, 0x9B, 0xEC, 0x03, 0x14, 0x23, 0x5D, 0x30, 0xDA, 0x1E, 0xF7, 0xB2, 0x5A, 0x9A,
-    0x74, 0x0A, 0xC1, 0x39, 0x18, 0xC9, 0x2B, 0x3C, 0x96, 0x2B, 0x03, 0xC2, 0x7A, 0x24, 0x3B, 0x15,
-    0xA4, 0x91, 0x82, 0xDE, 0x8C, 0x39, 0xB4, 0x62, 0xCC, 0x76, 0xEB, 0x39, 0x75, 0x1B, 0x69, 0x7F,
-    0x47, 0x14, 0xFC, 0xF3, 0xC7, 0x1F, 0x15, 0x77, 0xE5, 0x67, 0x94, 0xCB, 0x1F, 0xF9, 0x3E, 0xD0,
-    0xFA, 0xD3, 0x2C, 0x2D, 0xD9, 0x03, 0xCF, 0x5F, 0x2A, 0x31, 0xE3, 0xBC, 0xA5, 0x95, 0xBE, 0x57,
-    0xF2, 0xA3, 0x23, 0x5A, 0xCB, 0xB4, 0xEC, 0xD8, 0xE3, 0x1E, 0xA2, 0x8C, 0x08, 0xA9, 0xA1, 0x70,
-    0x03, 0x83, 0x89, 0x28, 0x54, 0x7C, 0x45, 0xD6, 0xA2, 0x49, 0xA7, 0x2C, 0x35, 0x17, 0xA1, 0x7C,
-    0x66, 0x7E, 0x03, 0xF0, 0x87, 0x14, 0xFD, 0x1E, 0x19, 0xBB, 0xE4, 0xAC, 0x26, 0x3A, 0x06, 0xD0,
-    0x40, 0x34, 0x23, 0xE6, 0x9B, 0x23, 0x11, 0xB7, 0xAD, 0x22, 0x34, 0x4D, 0x4C, 0x05, 0xB3, 0x52,
-    0x49, 0xEE, 0xBE, 0xD5, 0xCC, 0xE7, 0x71, 0x95, 0x6F, 0x92, 0x19, 0xE7, 0xD3, 0xCC, 0x91, 0xFD,
-    0xAE, 0xB0, 0xDA, 0x68, 0x5A, 0x39, 0xE5, 0xA4, 0x1C, 0x7D, 0x99, 0xA5, 0x0C, 0x7B, 0x2C, 0xF4,
-    0x63, 0xF3, 0xDD, 0x62, 0xEE, 0x64, 0x61, 0xD6, 0x55, 0x45, 0xE0, 0x61, 0x7C, 0xA9, 0xCC, 0xE5,
-    0x2D, 0x19, 0x4A, 0x06, 0xDD, 0x7D, 0x7D, 0xE6, 0x68, 0xB9, 0x04, 0x1B, 0x6B, 0x73, 0x19, 0x2D,
-    0xF7, 0x2A, 0xE5, 0x0A, 0xE6, 0xCF, 0x89, 0xE3, 0x0B, 0x06, 0xCC, 0x9C, 0xD5, 0x87, 0xA7, 0x4A,
-    0xD3, 0x3F, 0xF8, 0x21, 0x38, 0x02, 0x73, 0x80, 0x47, 0x28, 0x9D, 0x0F, 0xF8, 0xF1, 0xCC, 0x05,
-    0xA2, 0x78, 0x07, 0xCC, 0x51, 0x2C, 0x9B, 0x23, 0x23, 0xCF, 0x8F, 0x53, 0xE6, 0xF0, 0x32, 0xAA,
-    0xB8, 0x98, 0x0F, 0xE5, 0x4D, 0xF0, 0x10, 0xF8, 0xAA, 0x23, 0xF6, 0x18, 0x3E, 0xF1, 0x48, 0x7E,
-    0x69, 0x09, 0x98, 0x40, 0x5D, 0x2F, 0x1C, 0x53, 0xAD, 0x3F, 0x3F, 0xA4, 0x82, 0xE2, 0xD1, 0xEA,
-    0x8F, 0xB3, 0xE3, 0x2D, 0x81, 0xC3, 0x77, 0xC2, 0x06, 0xBD, 0x09, 0x96, 0x1B, 0xBB, 0xB8, 0xDD,
-    0xDA, 0xFE, 0x7C, 0x85, 0x7B, 0x18, 0x5A, 0xB2, 0x4D, 0x2E, 0xF2, 0x92, 0xCC, 0xC0, 0x1F, 0x39,
-    0x7B, 0x47, 0x0D, 0xA8, 0x84, 0x0A, 0xA0, 0x22, 0x32, 0xD1, 0xB0, 0x69, 0x22, 0x35, 0xE0, 0x45,
-    0x28, 0xEC, 0x86, 0xC7, 0x13, 0xFB, 0x22, 0xE9, 0xA8, 0x29, 0xE2, 0x86, 0x76, 0x93, 0x7C, 0xE1,
-    0xE9, 0xD7, 0x3A, 0x28, 0x68, 0x7C, 0x79, 0xE8, 0xEA, 0xB5, 0x9F, 0x6F, 0xD4, 0x95, 0x27, 0xB9,
-    0xD7, 0x1A, 0x2E, 0x3B, 0xD2, 0x3A, 0x9C, 0xF8, 0x76, 0xB9, 0x93, 0xA9, 0x85, 0xA5, 0x1E, 0x09,
-    0x7C, 0xE1, 0x5B, 0x14, 0x85, 0x86, 0x4E, 0x06, 0x75, 0xA7, 0x40, 0x91, 0x08, 0xB1, 0x01, 0x7B,
-    0xF8, 0xDF, 0x71, 0x0B, 0x38, 0x21, 0x78, 0x66, 0x19, 0x28, 0x15, 0xDB, 0x2D, 0x7D, 0x42, 0x13,
-    0x79, 0x8A, 0x1D, 0x71, 0x4A, 0x2A, 0xF2, 0x68, 0xF6, 0xEB, 0x62, 0x81, 0xC6, 0xF1, 0x12, 0xFC,
-    0xBB, 0xA5, 0x7D, 0xEF, 0x77, 0xAA, 0xF7, 0x7D, 0x3F, 0x48, 0x89, 0x2F, 0xF5, 0x9F, 0x78, 0x7E,
-    0x5A, 0xF7, 0x35, 0x1A, 0xDD, 0xE6, 0x98, 0xB5, 0xBF, 0x87, 0xAF, 0xB3, 0x46, 0x29, 0x36, 0x37,
-    0x61, 0xC3, 0x3C, 0x0B, 0x90, 0xF6, 0xBE, 0x47, 0x5E, 0x73, 0x77, 0x22, 0x10, 0xEE, 0x53, 0x40,
-    0x82, 0xDE, 0xAE, 0x1A, 0x95, 0x80, 0x9C, 0xD5, 0x06, 0x9F, 0x26, 0x15, 0xE8, 0x3E, 0xE6, 0x3F,
-    0x4E, 0x0D, 0x15, 0x5A, 0x4F, 0x66, 0x9D, 0x96, 0xF2, 0x29, 0xD5, 0x32, 0x42, 0x49, 0xF9, 0x2D,
-    0x1D, 0xDC, 0x59, 0x6E, 0x2E, 0x7C, 0xA4, 0x55, 0x82, 0x24, 0xA4, 0x29, 0x1E, 0xB5, 0xCE, 0x87,
-    0xC5, 0x50, 0x8B, 0xB2, 0xD1, 0xD6, 0x6A, 0x73, 0xAE, 0x97, 0x7C, 0xED, 0x7B, 0x8C, 0xB2, 0x94,
-    0x93, 0xFA, 0xC2, 0xCE, 0x0A, 0x4A, 0x69, 0xC2, 0x78, 0x97, 0x82, 0x9D, 0xD6, 0x5B, 0xFD, 0x2A,
-    0x7E, 0x6D, 0x9C, 0x68, 0xBB, 0x36, 0x68, 0x0F, 0x59, 0xC7, 0xAF, 0x02, 0xEE, 0x89, 0x7D, 0xA0,
-    0x75, 0x10, 0xEA, 0xB2, 0x1B, 0xAC, 0x68, 0x2B, 0xC7, 0x0E, 0xBF, 0xAB, 0x75, 0x2B, 0x0B, 0x7A,
-    0x12, 0xD0, 0x8C, 0xB9, 0xF2, 0x8E, 0x89, 0xA3, 0x85, 0x76, 0x6C, 0x8B, 0x84, 0x69, 0xDB, 0x9C,
-    0x97, 0xCB, 0xE3, 0x4F, 0xEC, 0x37, 0xFB, 0x74, 0x97, 0x4F, 0x64, 0xC8, 0xE4, 0x79, 0x69, 0xC1,
-    0x2E, 0xC8, 0x3A, 0xE7, 0x89, 0xF1, 0xD0, 0x56, 0xCB, 0xDB, 0x7A, 0x85, 0x62, 0xB5, 0x85, 0x45,
-    0xCA, 0x95, 0x4A, 0x05, 0x20, 0x41, 0x7D, 0xDB, 0xA9, 0xE2, 0xD6, 0x87, 0xF7, 0xA0, 0x4C, 0x15,
-    0xEE, 0xB4, 0xDD, 0x86, 0xEA, 0xBC, 0x67, 0xA2, 0x6D, 0xE2, 0xEA, 0x36, 0x12, 0xF4, 0x08, 0x52,
-    0x7C, 0x20, 0x57, 0x5A, 0x5F, 0x30, 0x46, 0x9F, 0xC1, 0xFC, 0xA3, 0x5A, 0x75, 0x7B, 0xCF, 0xED,
-    0x96, 0x4B, 0x30, 0x26, 0x70, 0xA8, 0x29, 0x67, 0x70, 0x83, 0xD5, 0x44, 0x3D, 0x53, 0xB9, 0x82,
-    0xAF, 0xDB, 0x46, 0x86, 0xB6, 0x0B, 0xB2, 0x69, 0xD5, 0xEA, 0xBD, 0x94, 0x42, 0x10, 0x3D, 0x2F,
-    0x03, 0x37, 0x94, 0xE7, 0xCB, 0x7C, 0xA0, 0x2E, 0xB8, 0x7B, 0x9B, 0x08, 0xFA, 0x55, 0x11, 0xBC,
-    0xCE, 0x98, 0xF1, 0x02, 0xBC, 0x2E, 0x17, 0xDF, 0xF4, 0x72, 0xF2, 0xAF, 0x3C, 0x6A, 0xC1, 0xD3,
-    0x38, 0x96, 0x27, 0x51, 0x46, 0x86, 0xAA, 0xC2, 0x71, 0x33, 0xB8, 0xCB, 0xDB, 0xAC, 0x0B, 0xE7,
-    0x74, 0xE0, 0x6E, 0xFE, 0x55, 0x4E, 0x4F, 0xD7, 0x06, 0x31, 0x74, 0x70, 0x0C, 0x98, 0xCC, 0xF1,
-    0x68, 0x46, 0x49, 0x1A, 0x75, 0xF6, 0x9B, 0x6F, 0xE5, 0x15, 0x6E, 0xD1, 0xB2, 0x79, 0x0B, 0xE0,
-    0xE6, 0x58, 0x29, 0xB6, 0x21, 0xA3, 0x27, 0x92, 0x98, 0xFA, 0xF6, 0xFD, 0x04, 0xB0, 0x35, 0x3B,
-    0x14, 0xB9, 0xCC, 0x81, 0x9C, 0xED, 0x90, 0x66, 0xD8, 0xA6, 0x8E, 0x26, 0xBF, 0x8B, 0xCF, 0xAF,
-    0xB3, 0x0F, 0xA7, 0x48, 0x2B, 0x15, 0xA6, 0xF9, 0xA9, 0x5C, 0xD5, 0xEE, 0x70, 0x8A, 0xE5, 0x18,
-    0x4C, 0xD8, 0x09, 0xDA, 0xF2, 0x81, 0x40, 0x4F, 0x3A, 0x8D, 0x7E, 0x73, 0xEA, 0xB2, 0xEE, 0x73,
-    0x22, 0xAB, 0xF3, 0xC3, 0x53, 0x56, 0x7E, 0xEF, 0x39, 0x9C, 0x3D, 0x12, 0x88, 0x97, 0xAD, 0xE7,
-    0xF0, 0xA0, 0xCC, 0x86, 0x10, 0x02, 0xA4, 0x01, 0x40, 0xD1, 0x70, 0xDE, 0xE9, 0xB2, 0xC6, 0xD6,
-    0x73, 0x30, 0x27, 0x1D, 0xEA, 0xE2, 0xCA, 0x9D, 0x01, 0xB0, 0x4D, 0x58, 0x3D, 0x83, 0x03, 0x48,
-    0x09, 0xD4, 0xDD, 0x9D, 0xF6, 0xC0, 0x9D, 0x5F, 0x97, 0x6D, 0xA9, 0x87, 0x3A, 0x5A, 0x22, 0xCA,
-    0x8D, 0x92, 0x84, 0xED, 0x6D, 0x6E, 0x89, 0x32, 0xB8, 0x85, 0xCB, 0xD6, 0xB0, 0xFE, 0xD9, 0xE5,
-    0xE1, 0x81, 0xB5, 0x31, 0x6A, 0xF3, 0x00, 0x02, 0xD8, 0xD9, 0xE7, 0xE9, 0xA0, 0xB4, 0x8B, 0x86,
-    0x78, 0x00, 0x8E, 0x1D, 0xCD, 0xCC, 0x36, 0xFD, 0x63, 0xC8, 0xD2, 0xD7, 0xB8, 0xD7, 0x3D, 0x68,
-    0x91, 0x0F, 0xBD, 0x85, 0x85, 0x6D, 0xE2, 0x2E, 0x9D, 0x9E, 0x1E, 0x02, 0xD1, 0xB6, 0xD0, 0xA0,
-    0x45, 0xF8, 0x06, 0x54, 0x4D, 0x96, 0x3E, 0x93, 0x10, 0x6E, 0xF0, 0xB0, 0x16, 0xBB, 0x8D, 0x17,
-    0xB0, 0xF8, 0xA3, 0x1B, 0x67, 0x9B, 0x0A, 0x5D, 0x98, 0xA5, 0x84, 0x83, 0xB2, 0x27, 0x68, 0x19,
-    0xEB, 0x92, 0xE1, 0xB4, 0xCD, 0x9B, 0xEC, 0xB7, 0x00, 0x3C, 0x58, 0x96, 0x1C, 0x5B, 0x3D, 0x80,
-    0x66, 0x76, 0xB9, 0x2A, 0x59, 0xCE, 0xB4, 0xB3, 0x38, 0xFB, 0x45, 0x57, 0x3C, 0x07, 0x43, 0x06,
-    0x3D, 0x42, 0x7D, 0xEE, 0xFD, 0x71, 0xA9, 0x5B, 0x36, 0xDD, 0x0A, 0xAB, 0x51, 0xBA, 0x30, 0x86,
-    0x8A, 0xE2, 0xE5, 0x72, 0x06, 0xF2, 0x85, 0x4E, 0x60, 0x45, 0x95, 0x2B, 0xB8, 0x1E, 0x25, 0x1C,
-    0xD1, 0x8A, 0xB4, 0xE5, 0x80, 0x05, 0x29, 0xE3, 0x48, 0x7E, 0x3E, 0x13, 0x31, 0x18, 0xAE, 0xA8,
-    0x52, 0xD6, 0xDE, 0x5F, 0x61, 0xDE, 0xE1, 0xC1, 0x33, 0x9E, 0x2A, 0xB1, 0x3C, 0x8F, 0xF6, 0xA0,
-    0xAE, 0x72, 0xAC, 0x72, 0xA3, 0x93, 0x87, 0x61, 0x4D, 0x48, 0x7A, 0xF1, 0x18, 0xD2, 0xCA, 0x6D,
-    0x9D, 0x75, 0xE9, 0xC0, 0x9D, 0x83, 0xBB, 0xCB, 0x6B, 0x6F, 0xC9, 0xC7, 0xD2, 0xCA, 0xEE, 0xD6,
-    0x41, 0x57, 0x02, 0xE0, 0x0F, 0x52, 0xF6, 0xC7, 0x4E, 0x74, 0x8B, 0x7C, 0xBD, 0x77, 0xCB, 0x03,
-    0x49, 0x44, 0x1E, 0xB9, 0xD4, 0xC7, 0x5D, 0x6B, 0x92, 0x5E, 0x37, 0xAB, 0xFD, 0xE6, 0x15, 0xA8,
-    0x4B, 0x15, 0xF7, 0xF9, 0x43, 0x2A, 0xA6, 0xBC, 0x52, 0x64, 0x37, 0xE0, 0x08, 0x00, 0x55, 0x83,
-    0xB1, 0x9F, 0xAF, 0xFB, 0x93, 0x30, 0x45, 0x20, 0x11, 0x37, 0x04, 0xF3, 0x18, 0xF5, 0x97, 0xD3,
-    0xC6, 0xE6, 0xC5, 0x23, 0xCB, 0xE4, 0xCF, 0x70, 0x6E, 0x27, 0xE6, 0xCD, 0x59, 0x3B, 0x29, 0xA3,
-    0xC2, 0xAD, 0x41, 0x71, 0x16, 0x8F, 0x62, 0x28, 0x20, 0x6B, 0x38, 0x71, 0x79, 0xAD, 0x42, 0x26,
-    0x74, 0x33, 0xE7, 0xDD, 0x5A, 0xA2, 0x58, 0xDA, 0xC8, 0xE3, 0x43, 0xB9, 0x37, 0xA5, 0xCD, 0xBC,
-    0x11, 0xBE, 0x9E, 0x81, 0x19, 0xC1, 0x79, 0xBB, 0xF0, 0xAD, 0x81, 0x73, 0x1A, 0x8F, 0xE4, 0x10,
-    0xEC, 0xD2, 0x35, 0xED, 0xA2, 0xB4, 0x67, 0xDD, 0x6E, 0x3C, 0x0F, 0x04, 0x80, 0x98, 0x36, 0xDD,
-    0x5F, 0xED, 0x4D, 0x29, 0xC1, 0x4C, 0xE0, 0x90, 0x43, 0x42, 0x5B, 0xA3, 0x0D, 0xD1, 0xC9, 0xA2,
-    0x1B, 0x98, 0xED, 0x81, 0xAC, 0x5D, 0x8C, 0x38, 0x1E, 0x54, 0x91, 0xC1, 0xD2, 0xB5, 0xAD, 0xB3,
-    0x21, 0x1B, 0x35, 0x1A, 0xC1, 0x7E, 0x47, 0xAC, 0x55, 0x5E, 0x11, 0x0F, 0x46, 0xDD, 0x8B, 0x3C,
-    0xE0, 0x67, 0xDB, 0x40, 0xA8, 0xA7, 0xD6, 0x76, 0xC9, 0x18, 0xCA, 0xAB, 0x2C, 0xC6, 0x18, 0x0A,
-    0x64, 0xD0, 0x7E, 0xD5, 0xB2, 0xFA, 0xBB, 0x21, 0x6B, 0xD2, 0xD3, 0xAC, 0xFF, 0x00, 0x92, 0x98,
-    0x24, 0xD2, 0x48, 0xF3, 0xFC, 0xA6, 0xB7, 0xFC, 0x33, 0xFC, 0xC5, 0x0D, 0x28, 0x69, 0xE5, 0x53,
-    0x19, 0x1F, 0x96, 0xB7, 0xC0, 0xEB, 0x3C, 0x38, 0x58, 0xE3, 0xF3, 0x30, 0xA3, 0x91, 0xC7, 0x87,
-    0x6A, 0xDB, 0x30, 0xB8, 0x81, 0x74, 0x9E, 0x2B, 0xAA, 0xF2, 0x16, 0xEE, 0x2E, 0x45, 0xC6, 0x5F,
-    0x0E, 0x96, 0xB0, 0x07, 0x32, 0xAF, 0x3D, 0xD1, 0x47, 0x32, 0x02, 0x03, 0xC9, 0x87, 0xB3, 0x6F,
-    0x46, 0x6D, 0xAD, 0xE0, 0xC5, 0x23, 0x4B, 0x93, 0x2A, 0x5E, 0xB7, 0x42, 0xFB, 0xE5, 0xD0, 0x4A,
-    0xBC, 0x91, 0xC3, 0x19, 0x2F, 0xB3, 0xD5, 0xB9, 0xD0, 0x19, 0xA5, 0x72, 0x07, 0x09, 0x20, 0xF2,
-    0x22, 0x4C, 0xB9, 0x3D, 0xB8, 0xEB, 0x1F, 0x50, 0x31, 0x8F, 0x3C, 0x48, 0x00, 0x11, 0xC8, 0x13,
-    0x40, 0xC0, 0x7B, 0xE4, 0x1E, 0x30, 0xB4, 0xCB, 0xFB, 0xBC, 0x8F, 0x7D, 0x7B, 0xBD, 0xF7, 0x67,
-    0x45, 0x36, 0xEB, 0xCB, 0xBF, 0x5B, 0x56, 0xD7, 0xA3, 0x4B, 0x76, 0x59, 0x5D, 0x61, 0x04, 0x1B,
-    0x1B, 0x87, 0x50, 0x04, 0x49, 0x88, 0xD5, 0xF1, 0x59, 0xC3, 0xDE, 0xE0, 0x91, 0xA9, 0x6C, 0xD0,
-    0x73, 0x72, 0x52, 0x25, 0xD4, 0x81, 0xBB, 0x42, 0x22, 0xA0, 0x40, 0xB9, 0x95, 0x0E, 0xCE, 0x42,
-    0x24, 0xA2, 0xE7, 0xC2, 0xFA, 0x4D, 0x1D, 0xAC, 0xAB, 0x5B, 0x02, 0x4D, 0x85, 0xDE, 0x16, 0xA6,
-    0x90, 0x7E, 0x88, 0xD0, 0xC3, 0x02, 0xFD, 0x82, 0x79, 0xF6, 0xB0, 0x4B, 0x43, 0x87, 0x7A, 0xEC,
-    0x14, 0xCE, 0xE9, 0x60, 0xFA, 0xC8, 0x18, 0x65, 0x9D, 0x72, 0xB7, 0xD1, 0x21, 0xBF, 0xA3, 0xDA,
-    0x87, 0xE9, 0xEF, 0xE1, 0xE1, 0x40, 0x39, 0xFC, 0x14, 0xB2, 0xEE, 0x90, 0x4C, 0xE6, 0x88, 0x5B,
-    0xC4, 0x14, 0x44, 0xC0, 0xC2, 0x26, 0x11, 0x6D, 0xA5, 0x57, 0x2B, 0x49, 0x10, 0x2C, 0xA4, 0x63,
-    0x8E, 0x58, 0x77, 0xA3, 0x33, 0xA7, 0xD9, 0x84, 0x50, 0xA8, 0xB0, 0xD9, 0xF0, 0xFF, 0x33, 0xAD,
-    0xBC, 0x9C, 0xAE, 0x24, 0x3C, 0x80, 0xF7, 0x7D, 0x84, 0x9C, 0x36, 0x00, 0x11, 0x1F, 0xC6, 0x06,
-    0x7F, 0x96, 0x95, 0x8F, 0xF9, 0x93, 0x47, 0x9A, 0xE8, 0xA0, 0xF0, 0x4C, 0xB1, 0xD9, 0xF1, 0x8B,
-    0x17, 0x0F, 0x8E, 0xFC, 0x6D, 0x6F, 0xFB, 0x1A, 0xB6, 0xF3, 0x3B, 0x05, 0xCC, 0x75, 0xE3, 0x22,
-    0x93, 0xE0, 0xF5, 0x80, 0x81, 0x7C, 0xB8, 0xB4, 0xF4, 0x83, 0xE4, 0x2A, 0xDB, 0x2E, 0x88, 0x78,
-    0x7A, 0xAE, 0x8E, 0x67, 0xA6, 0x4A, 0x9E, 0x76, 0xD5, 0xBE, 0x49, 0x7C, 0x15, 0xD9, 0xE2, 0xD3,
-    0xDE, 0x55, 0xD1, 0xF4, 0x1E, 0x56, 0xB2, 0xC2, 0xED, 0x52, 0x78, 0x0C, 0x0B, 0xB8, 0x84, 0xC1,
-    0x99, 0xE5, 0x9C, 0x56, 0x67, 0x19, 0x6D, 0x34, 0xFE, 0x2D, 0x2D, 0xE3, 0xC7, 0x8B, 0x69, 0x28,
-    0x84, 0xEA, 0x97, 0x83, 0x4C, 0xCB, 0xE9, 0x3A, 0x05, 0x71, 0xDA, 0xF2, 0xD0, 0x72, 0x21, 0x3C,
-    0xD4, 0xB4, 0xFE, 0x27, 0x13, 0x3C, 0x99, 0xC1, 0xD7, 0x7B, 0x94, 0x58, 0x79, 0xC7, 0xA0, 0xCC,
-    0xE3, 0x64, 0x14, 0x0B, 0x42, 0x10, 0x56, 0x2E, 0xEB, 0x90, 0x31, 0x83, 0x67, 0x5C, 0xAB, 0x98,
-    0x67, 0x9C, 0x12, 0xF6, 0x6E, 0xD2, 0x3E, 0x11, 0xA5, 0x17, 0x92, 0xBB, 0x20, 0x0F, 0x64, 0xDF,
-    0x8C, 0x32, 0x67, 0xD2, 0xC9, 0x08, 0x0E, 0x84, 0x95, 0x11, 0x4A, 0x96, 0x73, 0x1B, 0x5A, 0x49,
-    0xCC, 0x0A, 0x7D, 0x2B, 0xF0, 0x56, 0x62, 0x56, 0xC7, 0xAD, 0xFC, 0xB9, 0xEA, 0xB0, 0xBA, 0xED,
-    0x54, 0x85, 0xFD, 0xAA, 0x62, 0xD4, 0xEE, 0x90, 0x73, 0x8C, 0xD9, 0x16, 0x7A, 0xEA, 0x53, 0x58,
-    0x77, 0x93, 0x14, 0xB7, 0x99, 0x20, 0x24, 0x0C, 0x00, 0x29, 0x22, 0x5E, 0x85, 0xBD, 0x71, 0x6F,
-    0x6F, 0x82, 0xBD, 0xB7, 0x47, 0x5B, 0x26, 0xD4, 0x20, 0x66, 0xD7, 0x07, 0x36, 0x7D, 0x15, 0xA7,
-    0xAA, 0xF3, 0x87, 0xEE, 0x46, 0x73, 0x14, 0x21, 0xC1, 0x4B, 0x2A, 0x64, 0x62, 0x2C, 0x44, 0xE0,
-    0x3B, 0x00, 0xDB, 0x9E, 0x94, 0x5A, 0xBB, 0x2E, 0x34, 0x42, 0xDB, 0x20, 0xBF, 0xE9, 0x49, 0x69,
-    0x24, 0x3A, 0xEE, 0x6E, 0xCC, 0x3C, 0x8F, 0x96, 0x76, 0x8C, 0xD9, 0x42, 0xAB, 0x4C, 0xAF, 0x6B,
-    0x2C, 0x27, 0xC7, 0xE9, 0x1F, 0xB9, 0x84, 0x9B, 0xD6, 0xFB, 0xCD, 0xAE, 0x5B, 0x57, 0xF6, 0x6A,
-    0xCA, 0x5A, 0xC0, 0x71, 0x53, 0xE4, 0xD1, 0x63, 0x93, 0x36, 0x5E, 0x8A, 0xA5, 0x4D, 0x11, 0xE9,
-    0x4E, 0x57, 0xB2, 0x3A, 0x47, 0x5A, 0xAC, 0x7A, 0x12, 0xA9, 0xB6, 0x27, 0xC4, 0x33, 0xA1, 0x87,
-    0x1E, 0xA6, 0x35, 0x3F, 0x9A, 0x43, 0xE0, 0xD8, 0xCF, 0x68, 0x67, 0x97, 0x68, 0x2C, 0x67, 0xEB,
-    0xE4, 0x63, 0xC2, 0x20, 0x24, 0x2D, 0x36, 0x6D, 0x63, 0x36, 0x4D, 0xAA, 0xB2, 0xF1, 0xD9, 0x0A,
-    0x9C, 0xB1, 0x85, 0xA4, 0xED, 0x80, 0x81, 0x4E, 0xCE, 0xBC, 0xB5, 0x3E, 0x39, 0x0B, 0x28, 0xCC,
-    0x00, 0xA2, 0x47, 0x57, 0x75, 0x47, 0xB8, 0xC2, 0x00, 0x3D, 0xF1, 0x56, 0x17, 0x4B, 0xC3, 0xC1,
-    0x33, 0xB1, 0x9C, 0xFA, 0x2F, 0xB4, 0x85, 0xC5, 0x73, 0x7A, 0x6C, 0x12, 0x04, 0x4B, 0x08, 0xF1,
-    0x9F, 0x52, 0x0F, 0xC2, 0x75, 0x42, 0x50, 0x46, 0x35, 0x64, 0x0D, 0xDD, 0xF9, 0x9E, 0xE0, 0xB0,
-    0xD8, 0xFF, 0x91, 0x47, 0x0E, 0x1C, 0x80, 0x26, 0x63, 0x55, 0xD9, 0x06, 0x6E, 0xF4, 0xBD, 0x21,
-    0x15, 0xB8, 0x97, 0x3D, 0x8C, 0x29, 0x9C, 0x09, 0x72, 0xB3, 0x96, 0xAD, 0x04, 0x3D, 0x33, 0x95,
-    0x76, 0x9C, 0x4C, 0xB8, 0x25, 0x9E, 0x7E, 0x45, 0xB2, 0xA4, 0x54, 0x81, 0x6B, 0xCF, 0x47, 0xCB,
-    0x52, 0x59, 0x6F, 0xBD, 0x6B, 0x7A, 0x0D, 0x55, 0x66, 0x3C, 0xB7, 0xD8, 0xEC, 0xE8, 0xBE, 0x5D,
-    0xBF, 0xEA, 0x76, 0x59, 0x8D, 0x32, 0xFF, 0xC1, 0xCB, 0xFF, 0x01, 0xD5, 0x5C, 0x3D, 0xB0, 0xE5,
-    0x66, 0x79, 0xFE, 0x24, 0xF9, 0xDE, 0x03, 0x7B, 0xC8, 0x68, 0x0B, 0x36, 0x89, 0x77, 0x93, 0xA8,
-    0xA1, 0x00, 0x27, 0x20, 0x4A, 0x0A, 0x6C, 0x09, 0x28, 0x52, 0xB8, 0xC8, 0x2D, 0xBC, 0xF9, 0xA3,
-    0x70, 0x0A, 0x67, 0xC6, 0x30, 0x93, 0x59, 0x4A, 0x0A, 0x58, 0xC9, 0xB8, 0xA0, 0x70, 0x91, 0x3B,
-    0x19, 0x98, 0x14, 0x29, 0x70, 0xE1, 0x22, 0xAC, 0x93, 0x59, 0x0A, 0x0A, 0x26, 0x63, 0xAF, 0x84,
-    0xB7, 0xF0, 0x4C, 0x28, 0x2C, 0xC2, 0x30, 0x29, 0x7D, 0x20, 0x86, 0x49, 0x4C, 0x71, 0x85, 0x11,
-    0xB6, 0x76, 0x57, 0xD2, 0x97, 0xE7, 0x79, 0x5E, 0xE9, 0x9C, 0x73, 0xEF, 0xAE, 0x03, 0x01, 0x0C,
-    0xCB, 0x99, 0xBD, 0xBA, 0x77, 0xCF, 0xD1, 0xCF, 0xF7, 0x3D, 0xDF, 0xFB, 0xF3, 0xBC, 0x3F, 0xDF,
-    0x71, 0xCE, 0x5D, 0xBE, 0x7C, 0xE4, 0x9C, 0x4B, 0xBC, 0xC7, 0x31, 0xF4, 0xBE, 0xC5, 0xAF, 0x8B,
-    0xD7, 0xBE, 0xEA, 0xEE, 0x7A, 0xBD, 0x57, 0xC7, 0xAC, 0xE6, 0x31, 0x1E, 0x9C, 0xCE, 0x6E, 0xF8,
-    0xAB, 0x18, 0xF5, 0x96, 0xDF, 0xE0, 0x18, 0x4C, 0x5E, 0x67, 0x7D, 0x85, 0xB7, 0x59, 0xB7, 0xFA,
-    0xCF, 0x14, 0x77, 0xBA, 0xD0, 0x97, 0xCE, 0xAD, 0xBA, 0x35, 0x2F, 0xF5, 0xAE, 0xC2, 0x7D, 0xD2,
-    0x66, 0x85, 0xFF, 0x44, 0xE3, 0xE5, 0x0A, 0xF7, 0xF1, 0xDE, 0x4F, 0x1A, 0x06, 0x46, 0x10, 0x4D,
-    0xD7, 0x9E, 0xC7, 0xA5, 0x55, 0xE9, 0xD2, 0xD6, 0xC5, 0x2D, 0x1E, 0x94, 0x87, 0xFC, 0xB0, 0x0F,
-    0xAA, 0xD7, 0xDC, 0xDA, 0x77, 0x95, 0x6F, 0x56, 0xDE, 0xBF, 0xE2, 0x07, 0x57, 0xE1, 0x27, 0xB8,
-    0x76, 0xAD, 0x74, 0x91, 0xC7, 0x60, 0x70, 0xA8, 0x5D, 0x70, 0xF9, 0x72, 0xBE, 0x3F, 0xEE, 0x4F,
-    0x05, 0x47, 0x6E, 0xE5, 0x5F, 0x69, 0x5D, 0xCA, 0x5B, 0x57, 0x77, 0x7C, 0x13, 0xF8, 0xB2, 0xAA,
-    0xA3, 0x09, 0x63, 0xC0, 0x60, 0x7C, 0x19, 0xF7, 0x18, 0x4F, 0xD2, 0x06, 0x1E, 0x4F, 0x8B, 0xBC,
-    0xCB, 0x36, 0xAB, 0x09, 0x87, 0x78, 0xC4, 0x21, 0xE5, 0xE1, 0xC6, 0xF0, 0x27, 0xD9, 0x9B, 0xB7,
-    0xFC, 0x90, 0xFA, 0xEF, 0xF9, 0x3E, 0xF1, 0x4F, 0xF9, 0xCD, 0x7A, 0x72, 0x3E, 0x77, 0x47, 0xEE,
-    0x3C, 0xEF, 0xAF, 0x83, 0x8B, 0xF3, 0x88, 0xD3, 0x1F, 0x02, 0x4E, 0x3C, 0xB9, 0x2D, 0x48, 0x3C,
-    0x67, 0xBC, 0xA0, 0xE4, 0xF2, 0xDF, 0x0A, 0x30, 0x1D, 0x85, 0x21, 0x6C, 0x1D, 0xC0, 0xEC, 0xD7,
-    0x35, 0x11, 0xC5, 0x83, 0x78, 0x33, 0x97, 0xBE, 0xE6, 0x7E, 0x9D, 0xB0, 0xDE, 0xC7, 0x10, 0xE1,
-    0x49, 0x1A, 0x48, 0xD4, 0x6A, 0x88, 0x7A, 0xC7, 0x25, 0x1A, 0x68, 0xE0, 0xFF, 0xD9, 0x06, 0xC7,
-    0x95, 0x77, 0xE9, 0xE6, 0x1D, 0x03, 0x0A, 0x63, 0x3D, 0x72, 0x1F, 0xE2, 0x43, 0x5E, 0xE0, 0xA1,
-    0xB3, 0x55, 0xC3, 0x61, 0x3C, 0xE2, 0x28, 0x38, 0xBE, 0xAA, 0xDC, 0x2E, 0xD6, 0xBB, 0xB7, 0x23,
-    0x4C, 0x79, 0x52, 0xC1, 0x21, 0x57, 0x3D, 0xFF, 0xDA, 0x2C, 0x9F, 0xDA, 0xEB, 0x02, 0xA4, 0xF4,
-    0xD0, 0xFB, 0x63, 0xCC, 0xC0, 0x8F, 0x42, 0x07, 0xC3, 0x3E, 0x2E, 0xEA, 0x64, 0x04, 0xBA, 0x58,
-    0x85, 0xB0, 0xC7, 0xB8, 0xDC, 0x80, 0x11, 0xBA, 0xF7, 0x46, 0x9E, 0x22, 0xED, 0xEB, 0xE5, 0x36,
-    0x29, 0x6F, 0x18, 0x53, 0x54, 0x22, 0x4D, 0x5F, 0x0B, 0x94, 0xF1, 0x51, 0x6B, 0x80, 0x1B, 0x86,
-    0x98, 0xFD, 0xAA, 0xCE, 0x7C, 0x7E, 0xA9, 0xC5, 0xCD, 0x81, 0xA3, 0x0E, 0xF8, 0x13, 0x97, 0x15,
-    0x3A, 0xF7, 0xC2, 0x6E, 0x1C, 0xE7, 0xF0, 0xB3, 0xC2, 0x50, 0xA3, 0x81, 0xCB, 0xAE, 0x15, 0xB4,
-    0x9F, 0x6C, 0xFE, 0x70, 0x27, 0x87, 0x7C, 0x1C, 0xEE, 0x8C, 0xD5, 0x5C, 0x43, 0x58, 0x57, 0xE3,
-    0xBA, 0x8E, 0x46, 0x77, 0xDE, 0x2E, 0xC2, 0x00, 0x8B, 0xDA, 0x26, 0x0D, 0x94, 0xB1, 0xCE, 0x1A,
-    0x70, 0xE8, 0xB2, 0x76, 0xD5, 0xC4, 0xFE, 0x7A, 0x17, 0x70, 0x08, 0x19, 0x46, 0x10, 0x72, 0x00,
-    0x07, 0x76, 0xC7, 0x4B, 0x02, 0x4B, 0x7A, 0xCC, 0x9B, 0xA4, 0x27, 0xF8, 0x33, 0xFD, 0x36, 0xA6,
-    0x9D, 0x35, 0x49, 0xE9, 0x0E, 0xCB, 0x60, 0xAB, 0xC9, 0x97, 0x79, 0xB6, 0x9F, 0x72, 0xDC, 0xC2,
-    0x77, 0x98, 0x04, 0x05, 0x64, 0xFA, 0x98, 0x77, 0x45, 0xE7, 0xD2, 0x3A, 0x6B, 0xDD, 0x7A, 0x93,
-    0x75, 0x90, 0x92, 0x04, 0x8F, 0x3E, 0x22, 0x6E, 0x18, 0xA9, 0x64, 0x84, 0xE8, 0x54, 0x42, 0xE7,
-    0x2C, 0x64, 0x7C, 0x6A, 0x8A, 0x39, 0xBF, 0x6B, 0x0D, 0x5C, 0x13, 0x87, 0x35, 0xB8, 0x02, 0xC8,
-    0x20, 0x38, 0x91, 0x04, 0x15, 0x7F, 0x6E, 0x70, 0xBD, 0xCE, 0x7D, 0x6C, 0x0B, 0x01, 0xF4, 0x14,
-    0x33, 0xC2, 0xD5, 0x9D, 0x0B, 0xA7, 0x01, 0xB8, 0x61, 0xE5, 0xEA, 0xAB, 0x80, 0xEA, 0xE1, 0x1D,
-    0x4C, 0x17, 0x73, 0xC1, 0x94, 0x60, 0xAE, 0x95, 0xEF, 0x03, 0xFF, 0xF1, 0x96, 0x28, 0x51, 0x39,
-    0xA8, 0x2D, 0x9C, 0x2D, 0x41, 0xCA, 0x36, 0xF3, 0x4F, 0xEB, 0x4A, 0x62, 0x94, 0x4D, 0x55, 0x03,
-    0x21, 0xA8, 0x63, 0xA0, 0x2B, 0x88, 0xDE, 0xEB, 0x4E, 0x3D, 0x55, 0xA8, 0x3A, 0x4A, 0x03, 0x46,
-    0x25, 0x45, 0xCC, 0x4F, 0x3B, 0x8D, 0xFB, 0x00, 0xA1, 0x73, 0xB9, 0x04, 0x61, 0x35, 0xDA, 0x14,
-    0x8B, 0x7C, 0x31, 0xD9, 0x0B, 0x2E, 0xB1, 0xAF, 0x79, 0x41, 0xEA, 0x27, 0xC2, 0x02, 0x38, 0x72,
-    0x18, 0x0B, 0xA0, 0x23, 0x54, 0xF8, 0xE7, 0x64, 0xF3, 0x24, 0x28, 0xBE, 0x4E, 0x3E, 0xE1, 0x7F,
-    0x34, 0xC2, 0x1A, 0xB4, 0xB1, 0x24, 0xAE, 0x74, 0x26, 0x0E, 0xEF, 0x77, 0x7F, 0x84, 0xFB, 0x97,
-    0x69, 0x03, 0x93, 0x43, 0x9B, 0x55, 0x51, 0xEE, 0x62, 0x29, 0x87, 0x0E, 0x71, 0x79, 0x1F, 0x61,
-    0x12, 0xB8, 0x43, 0xE7, 0xFA, 0xB0, 0x77, 0x71, 0x7D, 0x03, 0xF7, 0x4C, 0x6B, 0xC9, 0x86, 0x6E,
-    0x21, 0x9D, 0x59, 0x35, 0xFB, 0x6B, 0x08, 0x88, 0x70, 0x0B, 0x27, 0xD9, 0xA1, 0x8A, 0x11, 0x25,
-    0xE8, 0x42, 0xE0, 0xD6, 0xCB, 0xF9, 0x04, 0x4A, 0x0A, 0x47, 0xD9, 0x91, 0x92, 0x11, 0x2B, 0x0C,
-    0xFB, 0xF3, 0x8E, 0x12, 0x14, 0x98, 0xA2, 0xE3, 0xFD, 0x74, 0xDA, 0x1A, 0xF6, 0xE0, 0xD8, 0x7D,
-    0x5D, 0xFA, 0x9C, 0x61, 0x58, 0xE1, 0x90, 0x70, 0x62, 0xF1, 0x5B, 0xDD, 0xCE, 0xC0, 0x87, 0x32,
-    0x2F, 0xB3, 0xA9, 0xB5, 0xD7, 0x81, 0x3C, 0x7B, 0x45, 0x57, 0x4F, 0xDC, 0xF0, 0x0B, 0xE3, 0xE1,
-    0xBC, 0xFE, 0xD6, 0x3F, 0x55, 0x71, 0xC1, 0xA0, 0xD0, 0xB4, 0xDE, 0x8E, 0xA6, 0x09, 0x43, 0xC0,
-    0x84, 0x30, 0x88, 0x00, 0xA0, 0xC0, 0x40, 0xC1, 0x7A, 0x51, 0x06, 0xF0, 0x1F, 0xAC, 0x29, 0xFE,
-    0x43, 0x9F, 0x82, 0xFF, 0x10, 0xB1, 0x01, 0xA6, 0x1E, 0x97, 0x95, 0x7C, 0x24, 0xB0, 0x4F, 0x69,
-    0x4E, 0x84, 0x3A, 0x9E, 0x80, 0xDB, 0x00, 0x6F, 0x88, 0x38, 0x8D, 0x41, 0xF5, 0x83, 0x2B, 0xBC,
-    0x99, 0x27, 0xA0, 0xA9, 0x8E, 0x44, 0xF8, 0x78, 0x1F, 0xAD, 0xE0, 0x88, 0x66, 0x24, 0xF5, 0xAB,
-    0x0D, 0x8F, 0x2F, 0xF5, 0xB4, 0x7E, 0x2D, 0x27, 0xB4, 0x1E, 0x68, 0xBB, 0xA2, 0x29, 0x91, 0xD5,
-    0x7C, 0x94, 0x42, 0x91, 0xBD, 0x84, 0x89, 0x7C, 0x2A, 0x69, 0xCF, 0x63, 0x8C, 0x77, 0x7A, 0xD1,
-    0xAF, 0x91, 0xC7, 0x13, 0xAF, 0xF5, 0xA6, 0xCF, 0x82, 0x5C, 0x6E, 0x28, 0x85, 0xD4, 0xD2, 0x6C,
-    0x43, 0x73, 0x28, 0x4F, 0xE1, 0xE4, 0x39, 0x88, 0x35, 0x4D, 0xAF, 0x2F, 0x33, 0x7D, 0xCC, 0x05,
-    0x8C, 0xFB, 0xB4, 0x5A, 0x63, 0x58, 0x57, 0xBE, 0xC2, 0x99, 0xFA, 0x2F, 0x62, 0x8C, 0xF2, 0x19,
-    0x9C, 0x5F, 0xD6, 0xD0, 0xC8, 0x05, 0xBF, 0x42, 0x2C, 0x1F, 0xF2, 0xAF, 0x1F, 0xC7, 0xC3, 0x9A,
-    0xBE, 0xD4, 0xD7, 0xCF, 0xFB, 0xD7, 0xCB, 0xB3, 0x58, 0x66, 0xBF, 0x1C, 0x96, 0x72, 0x1E, 0x35,
-    0x31, 0xA1, 0xAC, 0x3D, 0x24, 0x55, 0x5A, 0x53, 0xFC, 0xAF, 0xF9, 0xFF, 0xA6, 0x7E, 0xF1, 0x8D,
-    0x6B, 0xFE, 0xB9, 0xD9, 0x60, 0x27, 0x6F, 0x4E, 0x7A, 0x13, 0x4A, 0x48, 0x91, 0xC3, 0x90, 0xF0,
-    0x79, 0xD6, 0xE2, 0x02, 0x38, 0x7E, 0x8C, 0x07, 0xBE, 0x16, 0xFE, 0x1D, 0x13, 0xE3, 0xBC, 0x20,
-    0xAB, 0x30, 0x71, 0x23, 0x31, 0xE4, 0xD0, 0x08, 0x5E, 0x34, 0xAD, 0x4F, 0x5E, 0xAA, 0xE5, 0x6C,
-    0x43, 0x3F, 0x25, 0xBE, 0x34, 0xE4, 0xAA, 0x0D, 0xD1, 0x9F, 0x79, 0x89, 0xD1, 0xCB, 0x58, 0x74,
-    0xB9, 0xD0, 0xA8, 0xAE, 0x5D, 0x3B, 0xBE, 0x9B, 0x2D, 0x73, 0x2E, 0xA3, 0xE6, 0x25, 0x15, 0xC7,
-    0x38, 0xE2, 0xFE, 0xA0, 0xC2, 0x25, 0x4D, 0x30, 0xF0, 0xE9, 0x2B, 0x81, 0x98, 0x98, 0xE1, 0x9E,
-    0x95, 0x7B, 0x25, 0xB9, 0x4F, 0x09, 0x05, 0x9D, 0x23, 0x2D, 0x36, 0x1F, 0x40, 0x43, 0x00, 0xB8,
-    0x9A, 0xC5, 0x12, 0xF0, 0xC2, 0x75, 0xC9, 0xF1, 0x17, 0xB8, 0x30, 0x8F, 0xA0, 0x95, 0x50, 0x78,
-    0x6A, 0x99, 0xBC, 0xF5, 0xEC, 0x5A, 0xB9, 0xAE, 0xE7, 0xAE, 0x5D, 0x13, 0x27, 0x0E, 0x78, 0xCB,
-    0x0B, 0xE2, 0xF9, 0x0B, 0xB2, 0xCF, 0x51, 0x9F, 0x6B, 0x9C, 0xDE, 0xBB, 0xF4, 0x87, 0xA0, 0x1F,
-    0x4D, 0x56, 0xC7, 0x9B, 0x64, 0x03, 0x27, 0xDF, 0x82, 0xF8, 0x75, 0xC1, 0x98, 0x74, 0xAE, 0xAA,
-    0xB0, 0x7E, 0xB8, 0x32, 0xE6, 0x50, 0x46, 0xD0, 0x04, 0x9F, 0x27, 0x75, 0xF6, 0xD3, 0x62, 0x43,
-    0xF3, 0xE7, 0x78, 0x4F, 0xDA, 0xBF, 0x7D, 0x9F, 0x80, 0x71, 0x45, 0x52, 0xEA, 0xCF, 0x51, 0xC6,
-    0xAF, 0x6F, 0xB8, 0x70, 0xD3, 0x8E, 0xB9, 0x9D, 0x3F, 0x8D, 0x11, 0x4D, 0x54, 0x13, 0x72, 0xAC,
-    0xF9, 0xCA, 0xDB, 0x82, 0x95, 0x9F, 0x6C, 0x09, 0x03, 0xA8, 0x0A, 0x94, 0xF0, 0x2A, 0x57, 0x10,
-    0x84, 0xDA, 0x66, 0x6D, 0x30, 0x14, 0x8D, 0x85, 0x29, 0xB6, 0xD0, 0x9D, 0x6E, 0x52, 0xCF, 0xF8,
-    0xAD, 0x85, 0x9F, 0x00, 0xA5, 0x5A, 0x7F, 0x83, 0x4B, 0x0B, 0x12, 0x81, 0x99, 0xC0, 0xC6, 0x54,
-    0xCD, 0xA1, 0x11, 0x9A, 0x56, 0x4F, 0xAC, 0x63, 0x6F, 0xCA, 0x06, 0x75, 0x88, 0x36, 0x41, 0x1D,
-    0x8C, 0x21, 0x0D, 0x65, 0x07, 0xC9, 0xE9, 0x66, 0xE2, 0xB6, 0x67, 0xFF, 0x02, 0xCF, 0x45, 0x83,
-    0x50, 0x4F, 0x57, 0xDA, 0x60, 0x84, 0x16, 0x4E, 0x01, 0x28, 0x18, 0x08, 0x49, 0x56, 0x56, 0x79,
-    0xF2, 0x6D, 0x9F, 0xAF, 0xEF, 0x60, 0x21, 0x38, 0x28, 0x0D, 0xA9, 0x71, 0xC7, 0x90, 0xB2, 0x21,
-    0xF2, 0x7F, 0x31, 0x71, 0xF1, 0xCD, 0xF6, 0x91, 0x6F, 0x05, 0xFB, 0xEE, 0x31, 0x16, 0x63, 0x94,
-    0x95, 0xB3, 0x91, 0x8B, 0x9B, 0x61, 0x51, 0xEF, 0xF1, 0xBA, 0x1F, 0xA0, 0xFA, 0xD9, 0x9E, 0x14,
-    0x12, 0x45, 0x94, 0x20, 0x50, 0x04, 0x89, 0xF2, 0x04, 0x8C, 0x28, 0x4E, 0x84, 0x08, 0xD2, 0x44,
-    0x84, 0x28, 0x4C, 0x04, 0x08, 0xB2, 0x74, 0x13, 0xF8, 0xDC, 0xE5, 0x49, 0x63, 0xA9, 0x4C, 0xC5,
-    0xF9, 0x9A, 0x44, 0x43, 0xD0, 0x7F, 0x77, 0xA0, 0xA0, 0x63, 0x7C, 0xB0, 0x7A, 0xA0, 0x60, 0x18,
-    0xF6, 0xE7, 0x66, 0xB7, 0x2A, 0xEA, 0xC1, 0x61, 0x9B, 0x2D, 0x53, 0x1C, 0x38, 0xEA, 0x26, 0xED,
-    0xCC, 0x4A, 0xCD, 0x8D, 0x58, 0x00, 0x81, 0x0B, 0x3F, 0x44, 0xE4, 0x02, 0x99, 0xAF, 0x18, 0x76,
-    0xA7, 0x0B, 0xAA, 0x19, 0xD0, 0x6A, 0xF1, 0x97, 0x3A, 0x3F, 0xD4, 0x1D, 0x33, 0xB7, 0xFD, 0xD3,
-    0x16, 0x2B, 0x7B, 0xDD, 0x2D, 0xCC, 0xD9, 0xE8, 0xF5, 0x2F, 0x3B, 0x69, 0xF8, 0xE5, 0xCF, 0xE3,
-    0x11, 0x18, 0x68, 0x62, 0x54, 0x3E, 0xBA, 0x75, 0x84, 0xB7, 0x73, 0xB7, 0x16, 0xA3, 0x2F, 0x03,
-    0x92, 0xB1, 0x9C, 0x84, 0xA2, 0x88, 0xE4, 0x6D, 0x0B, 0x39, 0xFC, 0x7E, 0x6B, 0x33, 0x82, 0xFE,
-    0xFE, 0x13, 0x94, 0xFF, 0x3F, 0xBD, 0x28, 0xBC, 0x93, 0x29, 0x5A, 0xDF, 0xAA, 0x6A, 0xE9, 0x57,
-    0x56, 0x16, 0x25, 0x6D, 0x91, 0x9B, 0x42, 0x3C, 0xE1, 0xDB, 0x8C, 0xC7, 0x68, 0xA4, 0xE5, 0x24,
-    0x1A, 0xD3, 0x30, 0x58, 0xA4, 0xC2, 0xD1, 0x1A, 0xDD, 0x93, 0x5E, 0xD0, 0x42, 0xCE, 0x5C, 0xC4,
-    0xE0, 0xCA, 0x4E, 0x1A, 0x3A, 0x09, 0x98, 0xE0, 0xD5, 0xC0, 0xC0, 0xED, 0x03, 0x7B, 0x61, 0xCF,
-    0x65, 0x8B, 0x7A, 0x5E, 0x23, 0x08, 0x26, 0x76, 0x90, 0x07, 0xDC, 0x9E, 0x61, 0x4F, 0x38, 0x10,
-    0xAA, 0xAC, 0x64, 0x7A, 0xA1, 0x85, 0x77, 0x5B, 0xE2, 0x1E, 0x41, 0x62, 0xE2, 0x27, 0x52, 0x16,
-    0x73, 0x95, 0x27, 0x0C, 0xD0, 0xFB, 0x57, 0xB9, 0xB2, 0x3D, 0xE3, 0x4A, 0xBF, 0x96, 0xFC, 0x16,
-    0x3D, 0xEC, 0x67, 0x84, 0xCF, 0x70, 0x47, 0xFF, 0x83, 0xC7, 0x4D, 0xD8, 0x68, 0x95, 0xC9, 0xD8,
-    0xF9, 0xDC, 0x53, 0xB1, 0xCF, 0xC2, 0x79, 0xCC, 0xD9, 0xE9, 0x61, 0x55, 0xA5, 0x78, 0x88, 0x6B,
-    0x51, 0x70, 0xC5, 0xA3, 0x2E, 0x6C, 0x4E, 0xAF, 0xFB, 0xC5, 0x2F, 0x99, 0xEE, 0x8C, 0x24, 0x7A,
-    0x24, 0xFA, 0x7D, 0xFA, 0x3A, 0x1D, 0x1E, 0x68, 0x28, 0xE0, 0x24, 0x7B, 0x6B, 0x19, 0xFC, 0x16,
-    0x25, 0x29, 0x9A, 0x27, 0x83, 0x88, 0xA6, 0x2B, 0x9D, 0xFC, 0x94, 0x16, 0xFF, 0x78, 0x09, 0x57,
-    0x43, 0x8B, 0xAE, 0x67, 0x57, 0xC4, 0x10, 0xDA, 0xD8, 0xE3, 0x09, 0xC6, 0x9A, 0x74, 0x0C, 0xE2,
-    0xE4, 0xCB, 0x29, 0x8D, 0x9E, 0xB1, 0x03, 0x54, 0x32, 0xBB, 0x75, 0x00, 0x74, 0x0A, 0xAD, 0x7D,
-    0x26, 0x9A, 0x79, 0x38, 0x1D, 0x1B, 0xCF, 0xB4, 0xD8, 0xF4, 0x33, 0x0C, 0x3E, 0x53, 0x8A, 0xEC,
-    0xF5, 0x86, 0xA3, 0xA4, 0x6C, 0xA7, 0x7A, 0xC2, 0x03, 0xEE, 0x3E, 0x5C, 0x84, 0x92, 0xB9, 0x9A,
-    0xB8, 0x5C, 0x29, 0x9E, 0x79, 0x41, 0x89, 0x9C, 0x86, 0x83, 0x1F, 0xDD, 0xE9, 0xA8, 0xDA, 0x3C,
-    0xE9, 0x57, 0xC5, 0xE7, 0x78, 0x8A, 0xC2, 0xE5, 0xC0, 0x7F, 0x61, 0x7A, 0x0E, 0xCE, 0x9E, 0x68,
-    0xC3, 0xA7, 0xB6, 0x0C, 0x8C, 0xB0, 0x08, 0xAB, 0x5E, 0x61, 0x44, 0x4B, 0x9A, 0x92, 0xFD, 0xD0,
-    0x8B, 0x52, 0x8B, 0xB6, 0xDF, 0x22, 0xE6, 0x9A, 0x41, 0x6A, 0xAB, 0x6E, 0xCA, 0xA8, 0xE0, 0x5C,
-    0x19, 0x8A, 0x09, 0xAA, 0x0C, 0xEB, 0x97, 0x7A, 0x66, 0x26, 0x98, 0x15, 0xA8, 0xF9, 0x07, 0xEE,
-    0x50, 0xD5, 0x91, 0x3F, 0x7E, 0x7C, 0xE4, 0x02, 0x59, 0xEE, 0x8B, 0xD7, 0x5C, 0xF9, 0x9F, 0xFD,
-    0xB1, 0x99, 0x7A, 0xD7, 0x5B, 0x03, 0x68, 0x2A, 0xBD, 0x39, 0xE3, 0x5C, 0xEE, 0x1F, 0xE4, 0xC3,
-    0x67, 0x65, 0x6D, 0x1A, 0x99, 0x37, 0x39, 0x46, 0x0D, 0x3B, 0x69, 0xCE, 0xC8, 0xCA, 0xFD, 0x8C,
-    0xFC, 0xFD, 0x82, 0xA6, 0x71, 0x0D, 0x23, 0x8C, 0xE6, 0x1F, 0x65, 0x5A, 0x44, 0x37, 0x87, 0x2D,
-    0xD1, 0x38, 0x3C, 0x15, 0xB0, 0x2B, 0x85, 0xE4, 0xD2, 0xB3, 0x6E, 0xEF, 0x86, 0x18, 0xAD, 0x84,
-    0x29, 0x6E, 0xB7, 0x2B, 0x84, 0x98, 0x77, 0xFB, 0xFA, 0xF4, 0x91, 0xF9, 0x9E, 0x4E, 0x98, 0x30,
-    0x46, 0xA8, 0xBE, 0x0A, 0x0B, 0x43, 0x3B, 0x03, 0x42, 0x49, 0xC3, 0x53, 0x03, 0x7F, 0x90, 0x26,
-    0xBA, 0xE8, 0x81, 0x2B, 0x14, 0xDF, 0xAA, 0x64, 0x0B, 0x94, 0x1F, 0x9A, 0xF2, 0x45, 0xB3, 0xD6,
-    0xE6, 0x78, 0x6D, 0xC0, 0x93, 0x25, 0xA6, 0x4B, 0xDC, 0xB4, 0xA2, 0x85, 0x69, 0x10, 0x0B, 0x44,
-    0x8C, 0x43, 0x72, 0x0C, 0x83, 0x5E, 0xA2, 0xA1, 0x4B, 0xF3, 0xAF, 0xFD, 0x1E, 0xD7, 0x49, 0x9E,
-    0x4B, 0x4E, 0xCC, 0x5D, 0xBA, 0x9D, 0xEF, 0x39, 0x81, 0xC5, 0x0D, 0xCC, 0x8E, 0x60, 0x76, 0x05,
-    0xB3, 0x33, 0x58, 0xDC, 0xC1, 0x69, 0x87, 0xB0, 0x7D, 0xC1, 0x94, 0xA6, 0xE2, 0xF1, 0xD3, 0xCC,
-    0xA3, 0xCB, 0x94, 0x08, 0x93, 0x39, 0x77, 0x72, 0x9F, 0x5C, 0xCF, 0xD0, 0x22, 0x24, 0xC5, 0x3A,
-    0x93, 0x91, 0x74, 0xCE, 0x0D, 0xF4, 0x83, 0xE2, 0xCB, 0xB7, 0x68, 0xCA, 0x2B, 0x73, 0xC7, 0xB1,
-    0x45, 0x59, 0xA2, 0xE8, 0xF7, 0xBC, 0x45, 0x34, 0xDF, 0x82, 0x5E, 0x99, 0xD9, 0x80, 0x71, 0xEF,
-    0x16, 0x8D, 0xF4, 0xB8, 0xF0, 0xC7, 0x6B, 0xF2, 0x76, 0x1B, 0x14, 0x33, 0xDF, 0x16, 0x88, 0xFC,
-    0xEB, 0xA2, 0x30, 0x15, 0x0E, 0x6B, 0x06, 0x94, 0xD5, 0x8A, 0xF9, 0xCC, 0x75, 0xED, 0x1E, 0xDC,
-    0x4E, 0xEE, 0x20, 0x9F, 0x43, 0xAA, 0x0A, 0x8F, 0xB4, 0xB0, 0x4A, 0xBC, 0x93, 0x63, 0x62, 0xD2,
-    0xC3, 0x32, 0x5F, 0x55, 0xFD, 0x01, 0xFC, 0x2F, 0x86, 0xE4, 0xFF, 0x98, 0x19, 0xB2, 0x57, 0x7D,
-    0x17, 0x4C, 0x63, 0x46, 0xFC, 0xC1, 0x79, 0xB9, 0x7E, 0xBE, 0x49, 0x11, 0x06, 0x40, 0x19, 0xD2,
-    0x8E, 0xFE, 0x05, 0xAB, 0xCB, 0x84, 0x66, 0x99, 0x74, 0x74, 0xCB, 0x50, 0xBE, 0x7F, 0x80, 0xEE,
-    0x9D, 0xBC, 0xD2, 0x83, 0xFE, 0x67, 0xCD, 0xCA, 0x7F, 0xCF, 0x9B, 0x47, 0x39, 0x30, 0x27, 0x15,
-    0x1A, 0x47, 0xD9, 0x64, 0xB8, 0x77, 0xE2, 0x79, 0x52, 0xCE, 0x89, 0x11, 0x04, 0xB2, 0x0E, 0xCE,
-    0x9A, 0xF0, 0x60, 0x8E, 0xFA, 0xE5, 0xEB, 0x83, 0xE2, 0xA7, 0x97, 0x3F, 0x39, 0x3D, 0x26, 0x20,
-    0x18, 0x15, 0x5B, 0x08, 0x6A, 0x67, 0xD5, 0x86, 0x65, 0x3F, 0x43, 0xBB, 0xBD, 0x05, 0x57, 0x88,
-    0x38, 0x4A, 0xE3, 0x2C, 0xA7, 0x45, 0xE6, 0xBA, 0xB7, 0x3A, 0xBA, 0x85, 0xA5, 0x04, 0x56, 0xFE,
-    0x16, 0x00, 0x29, 0x97, 0x41, 0x65, 0x9E, 0x29, 0x9E, 0xFA, 0x2C, 0x5A, 0xD7, 0x17, 0xB4, 0x10,
-    0xF6, 0x52, 0xD7, 0x06, 0x77, 0x78, 0xFD, 0xF6, 0xB1, 0x0D, 0x29, 0x1A, 0x49, 0x29, 0x5B, 0xBC,
-    0x57, 0xBC, 0x42, 0xB4, 0xA6, 0x0A, 0x68, 0x35, 0x40, 0x6B, 0x24, 0x5A, 0x9B, 0x5F, 0x14, 0x2D,
-    0xCB, 0x2D, 0x6F, 0x3E, 0x82, 0x71, 0x3F, 0x53, 0x3B, 0x31, 0x9D, 0x97, 0x31, 0x94, 0xCF, 0x58,
-    0xBA, 0xF9, 0xB4, 0xA4, 0x32, 0xF8, 0x9B, 0xF3, 0x3C, 0x1C, 0x72, 0xD2, 0xCF, 0xEC, 0x97, 0x60,
-    0x88, 0xEF, 0xF1, 0x0F, 0x59, 0x19, 0xA9, 0xDE, 0x30, 0x73, 0x0C, 0xE6, 0xB6, 0x44, 0xF6, 0xD2,
-    0xEE, 0x5E, 0xE7, 0x5D, 0x01, 0x37, 0xE0, 0x8D, 0x23, 0xF1, 0x80, 0x6F, 0x84, 0x81, 0xBF, 0xB9,
-    0x01, 0xDC, 0x57, 0xB3, 0x21, 0xA6, 0x62, 0x6F, 0x23, 0x80, 0x27, 0x09, 0xD4, 0x1A, 0x54, 0xF0,
-    0x7A, 0x2F, 0x12, 0xE1, 0xE5, 0x79, 0xC0, 0x29, 0x60, 0x7D, 0xA2, 0x41, 0xF9, 0x41, 0x2E, 0x0C,
-    0x8C, 0x75, 0x7B, 0xBC, 0x9A, 0x30, 0xD7, 0x91, 0x0A, 0x1E, 0xDF, 0xB2, 0x92, 0x83, 0xC2, 0x6A,
-    0x8A, 0x31, 0x33, 0x4C, 0xEE, 0xD3, 0xD7, 0x9E, 0xFB, 0x8D, 0x4C, 0xEF, 0xF0, 0xDA, 0x35, 0xAA,
-    0x13, 0x1E, 0x76, 0xE1, 0xF2, 0x92, 0x5F, 0x3D, 0x2C, 0xA9, 0x4F, 0x95, 0xC7, 0xA2, 0x97, 0xF4,
-    0x14, 0x30, 0x3D, 0x58, 0x51, 0x3A, 0x0E, 0xEA, 0x6C, 0x4D, 0x7D, 0x89, 0x69, 0x92, 0xF1, 0x90,
-    0x77, 0x63, 0x15, 0x61, 0x20, 0x1A, 0xF2, 0x7A, 0xDC, 0xF6, 0x60, 0x5B, 0xF7, 0x21, 0x05, 0x2A,
-    0x40, 0xEF, 0x59, 0x18, 0x8A, 0xC8, 0x23, 0xC4, 0x7E, 0xCE, 0x9F, 0x4A, 0x17, 0xD4, 0x2A, 0xBE,
-    0x29, 0x13, 0xEE, 0x4D, 0xC4, 0x35, 0x62, 0xCE, 0x43, 0xA3, 0xBE, 0xF7, 0x9B, 0xE5, 0xDD, 0x6F,
-    0x6A, 0xB2, 0x98, 0x5A, 0x50, 0x4D, 0x79, 0x68, 0x91, 0x7A, 0x4F, 0x6F, 0x10, 0xB5, 0x41, 0x33,
-    0x85, 0x6D, 0xE6, 0xFB, 0x88, 0xD6, 0xE3, 0xB5, 0x5F, 0xCD, 0xC2, 0x31, 0x13, 0xB2, 0x9E, 0x6D,
-    0xE3, 0xA9, 0xC7, 0x0B, 0xE6, 0xB3, 0x63, 0xDA, 0xBD, 0x39, 0xDD, 0xE3, 0x4D, 0x2E, 0x0A, 0x97,
-    0xF4, 0x10, 0xDA, 0xB8, 0x36, 0xD3, 0xB6, 0xB1, 0x70, 0x81, 0xC9, 0x66, 0xB2, 0xE2, 0x88, 0x8E,
-    0x81, 0x35, 0x96, 0x94, 0x37, 0x35, 0xB3, 0x1E, 0x8C, 0xCC, 0xF1, 0x78, 0xDC, 0x69, 0x35, 0x07,
-    0x43, 0x4F, 0x82, 0xA6, 0x56, 0xFE, 0x5C, 0xB5, 0x09, 0xE9, 0xB4, 0xB1, 0x5A, 0x55, 0x89, 0xB9,
-    0xB0, 0xC8, 0x82, 0xC7, 0x42, 0xC3, 0x86, 0xF7, 0x15, 0x27, 0xCF, 0xF8, 0xAE, 0x82, 0x1B, 0x85,
-    0x87, 0x43, 0x34, 0xF4, 0x30, 0x1F, 0x50, 0x3D, 0xB6, 0x82, 0x82, 0x6E, 0xF6, 0xB8, 0x53, 0xB0,
-    0xE0, 0x4E, 0xFB, 0x71, 0x96, 0x36, 0xBD, 0xE3, 0x4B, 0xE6, 0x9E, 0x5C, 0xFB, 0x6F, 0xF9, 0x37,
-    0xAE, 0xF7, 0x98, 0x05, 0x99, 0x4C, 0xBA, 0x89, 0x61, 0x3D, 0x30, 0x26, 0x26, 0xF2, 0x92, 0xF6,
-    0x1F, 0xA7, 0xDB, 0x7E, 0xAC, 0x26, 0xAC, 0xC3, 0x91, 0x56, 0x21, 0x32, 0xA3, 0xDA, 0x16, 0xA7,
-    0x8D, 0xEA, 0x72, 0xFB, 0x33, 0x16, 0xB1, 0xD8, 0x6C, 0xBD, 0x8B, 0x92, 0x73, 0xF5, 0xBE, 0x45,
-    0x0C, 0x66, 0x1D, 0x4B, 0x6C, 0x88, 0xD2, 0xB2, 0xF9, 0x16, 0x7B, 0xFE, 0xEA, 0xFF, 0xBC, 0x05,
-    0xFF, 0xCB, 0x65, 0x4C, 0x44, 0x4A, 0x5A, 0x66, 0x87, 0x33, 0xF8, 0x66, 0x0B, 0x24, 0xE7, 0x4C,
-    0xD7, 0xA1, 0x85, 0x38, 0x6E, 0x2A, 0x3A, 0x8B, 0x36, 0x26, 0xCB, 0xFB, 0x5A, 0xF1, 0x2C, 0x9E,
-    0xEB, 0xA6, 0x17, 0x76, 0x0C, 0x05, 0x2B, 0x1D, 0x29, 0xA5, 0x48, 0x79, 0x65, 0xDA, 0x96, 0xB9,
-    0xE5, 0x12, 0xAB, 0x1E, 0x9F, 0x5A, 0x9B, 0x27, 0x5D, 0xF0, 0x37, 0x90, 0x00, 0x48, 0x75, 0x85,
-    0x48, 0x67, 0x80, 0x1C, 0x5C, 0xC4, 0x52, 0x8D, 0x0A, 0x55, 0x60, 0x43, 0x4B, 0x08, 0x04, 0xC4,
-    0x01, 0x74, 0x43, 0x01, 0x4C, 0xC2, 0x88, 0x26, 0xA4, 0x70, 0x30, 0xC1, 0x3A, 0x51, 0x93, 0x21,
-    0xEB, 0x05, 0xC4, 0xE6, 0x7D, 0xB8, 0x00, 0x0A, 0xED, 0xCB, 0xB5, 0xEF, 0x78, 0x01, 0xE9, 0x4C,
-    0x34, 0xE5, 0x70, 0x00, 0x07, 0x33, 0xA5, 0x60, 0x60, 0x7E, 0x9E, 0xF9, 0xC8, 0xF8, 0xE3, 0x02,
-    0x85, 0x92, 0xC0, 0x72, 0xD2, 0x1C, 0x2C, 0x84, 0x73, 0x19, 0x3D, 0xF8, 0xFA, 0x36, 0xCC, 0x56,
-    0x49, 0x69, 0x75, 0x87, 0x65, 0xAD, 0x89, 0xA3, 0xF6, 0xF9, 0x55, 0x9A, 0x98, 0xA0, 0x3C, 0x63,
-    0xED, 0x3A, 0x25, 0x02, 0xB7, 0x45, 0x64, 0xBF, 0xE5, 0xF0, 0x16, 0x96, 0x53, 0x78, 0xE6, 0x18,
-    0x5E, 0x90, 0xDA, 0x9F, 0x4A, 0x78, 0x58, 0xC4, 0x7E, 0xF6, 0x02, 0xA5, 0x48, 0xC2, 0x1D, 0xD9,
-    0x7C, 0x9B, 0x0B, 0xFA, 0xF9, 0xAC, 0xB0, 0xE4, 0x59, 0x05, 0x38, 0x2E, 0x15, 0x31, 0xA7, 0xFF,
-    0x6B, 0x18, 0x0A, 0xF2, 0xD2, 0xC3, 0xA3, 0x53, 0x2C, 0x7C, 0x17, 0x58, 0xE8, 0xD3, 0x49, 0x86,
-    0x95, 0xBC, 0xB1, 0x22, 0x85, 0xCC, 0xDC, 0x47, 0x4F, 0xCD, 0xEC, 0xE0, 0x78, 0x49, 0xF0, 0x67,
-    0xBC, 0xED, 0x39, 0x2D, 0xB2, 0x28, 0x07, 0x49, 0xA1, 0x55, 0x11, 0xEC, 0x6E, 0xD9, 0xF6, 0x13,
-    0x71, 0x9A, 0x39, 0x94, 0x7F, 0xFB, 0x4F, 0xC4, 0x18, 0xEB, 0xB9, 0x08, 0x91, 0xF3, 0xE3, 0x3E,
-    0xE9, 0xE7, 0x1C, 0x6D, 0xE2, 0xA5, 0x68, 0x9C, 0xDD, 0xC5, 0x63, 0x13, 0x2E, 0x1F, 0x5B, 0x29,
-    0xAC, 0x10, 0x47, 0x2F, 0x39, 0xA4, 0x6C, 0x43, 0xAC, 0xC8, 0xF8, 0x3B, 0xDE, 0x7A, 0x76, 0x2E,
-    0xC6, 0x8E, 0x5E, 0xD2, 0xBA, 0x4D, 0xC2, 0x2E, 0x79, 0xCB, 0x98, 0xBA, 0x8A, 0x96, 0x16, 0x40,
-    0x5B, 0xFE, 0x01, 0x4F, 0x3B, 0xD1, 0xBA, 0xFB, 0xC7, 0x07, 0xC1, 0xAF, 0x94, 0x47, 0xD6, 0xAA,
-    0x60, 0x83, 0x67, 0x74, 0x92, 0x7C, 0xAD, 0x6D, 0xEB, 0xC4, 0x95, 0xFB, 0x60, 0x29, 0xC8, 0x0D,
-    0x91, 0xA2, 0x05, 0x73, 0xEB, 0xF2, 0x0C, 0x06, 0xF3, 0x6C, 0x90, 0x0A, 0xFB, 0xC0, 0x2C, 0xDE,
-    0xAA, 0x33, 0x1E, 0x5B, 0xEE, 0x78, 0xF9, 0x5C, 0x14, 0x25, 0x5F, 0x21, 0xFB, 0x23, 0x5D, 0x49,
-    0xFD, 0x7E, 0xE9, 0x73, 0x98, 0xCD, 0x59, 0x55, 0x3E, 0xE1, 0xB2, 0x6F, 0xFA, 0x3A, 0x7E, 0x03,
-    0x7E, 0xE0, 0xAD, 0xDB, 0x3E, 0x98, 0x36, 0x59, 0x59, 0x6D, 0xE2, 0x0D, 0x6C, 0x68, 0x1B, 0x77,
-    0xAB, 0x6E, 0x35, 0xAC, 0x11, 0xE6, 0x57, 0xAD, 0x24, 0x2F, 0x3B, 0xD9, 0xB8, 0xE4, 0x27, 0x88,
-    0x74, 0x86, 0xA2, 0x09, 0x27, 0x15, 0xE8, 0xC9, 0x51, 0x62, 0xFF, 0x78, 0xAB, 0xB5, 0x08, 0x2C,
-    0x2C, 0x8B, 0x9B, 0x79, 0x1C, 0xE3, 0x9C, 0x35, 0x4B, 0x73, 0xFB, 0x91, 0x0B, 0x7C, 0xC2, 0x9D,
-    0x0B, 0xFD, 0x66, 0x3D, 0x90, 0xAF, 0xFE, 0x7B, 0xD5, 0xC0, 0x36, 0x8D, 0xD9, 0x49, 0x9E, 0x7D,
-    0x0B, 0x5C, 0x77, 0xE4, 0x0A, 0xDD, 0x70, 0xCA, 0x84, 0x39, 0x22, 0x19, 0xDF, 0xE9, 0x30, 0x4E,
-    0xCC, 0x2C, 0x79, 0x63, 0xA4, 0x8A, 0xB4, 0x1F, 0xC9, 0x1A, 0x7F, 0x72, 0x73, 0x58, 0xF9, 0xAE,
-    0xA8, 0xB3, 0x09, 0xBA, 0x26, 0x19, 0xDE, 0xD9, 0x84, 0x95, 0x9B, 0x1F, 0x27, 0x39, 0x57, 0xBA,
-    0x44, 0xE2, 0x55, 0x1D, 0xEB, 0xC9, 0xFB, 0x2F, 0x25, 0xED, 0x53, 0x2B, 0xFB, 0xF7, 0xB3, 0xC8,
-    0xEB, 0x2A, 0xAD, 0xB4, 0x34, 0x22, 0xF2, 0x4B, 0x20, 0x26, 0x13, 0x25, 0xD5, 0x88, 0x87, 0xE5,
-    0xA0, 0x74, 0x99, 0x54, 0x0F, 0x72, 0xF0, 0xA0, 0xCA, 0x19, 0x3C, 0x14, 0xD4, 0xA3, 0x49, 0xD9,
-    0x30, 0xE5, 0xDC, 0x98, 0x83, 0xEF, 0x55, 0x7F, 0xD3, 0x63, 0x3F, 0x48, 0xB2, 0x90, 0x4E, 0x21,
-    0x97, 0xF8, 0x38, 0xB4, 0x5A, 0xC1, 0x05, 0xFA, 0xDC, 0x54, 0xFF, 0x64, 0x88, 0xF0, 0x2F, 0xB7,
-    0xB2, 0x84, 0x59, 0x20, 0x28, 0x03, 0x64, 0x1B, 0xB3, 0x85, 0xDD, 0x01, 0xE1, 0x80, 0x34, 0xA7,
-    0xAD, 0x2A, 0x16, 0xB4, 0x4C, 0xAE, 0xBA, 0xE9, 0xAA, 0x93, 0x1C, 0xB3, 0x81, 0x95, 0xC1, 0xA3,
-    0x0F, 0x7E, 0x73, 0x73, 0x9B, 0xA3, 0x72, 0x53, 0x3E, 0x2E, 0x4A, 0x91, 0x2F, 0x91, 0xE6, 0xB8,
-    0x08, 0xAA, 0x42, 0xCC, 0xE0, 0x08, 0x72, 0x19, 0xB2, 0xAE, 0x62, 0xD3, 0xEA, 0x67, 0xD3, 0x7B,
-    0x6A, 0x5A, 0x86, 0x45, 0xEE, 0x48, 0xF3, 0xCE, 0x60, 0xF1, 0xE1, 0xF5, 0xD4, 0xC5, 0xCC, 0x9A,
-    0x36, 0x9C, 0xC1, 0x11, 0x25, 0x00, 0x0E, 0x19, 0xD0, 0x20, 0xA0, 0x85, 0xF4, 0x25, 0x25, 0x33,
-    0x9B, 0xF3, 0x72, 0x1F, 0xEC, 0xDA, 0x32, 0x62, 0x72, 0xE6, 0x1F, 0x0F, 0x44, 0x26, 0x65, 0x8C,
-    0xF8, 0x34, 0xCB, 0xE4, 0xF5, 0xC3, 0x9C, 0x6E, 0x54, 0xBF, 0x8D, 0x3D, 0x34, 0xE7, 0xA4, 0x7A,
-    0xCB, 0x9C, 0x35, 0xA9, 0x17, 0x7C, 0xB6, 0x17, 0x3C, 0xC8, 0x0B, 0x10, 0x37, 0x0A, 0x21, 0x8C,
-    0x08, 0xA6, 0x5C, 0xC9, 0x50, 0x95, 0x7A, 0x84, 0x51, 0x64, 0xC9, 0xEB, 0x0B, 0xEE, 0x28, 0xF5,
-    0xEB, 0xEF, 0xFB, 0x21, 0x7B, 0x86, 0x65, 0xC0, 0xEA, 0x8B, 0xA0, 0x20, 0x69, 0x1E, 0x77, 0x2F,
-    0xB8, 0xE2, 0x26, 0xDC, 0x75, 0x60, 0x95, 0xE5, 0xC6, 0xCD, 0x35, 0x3D, 0xA9, 0x3B, 0xCB, 0x2D,
-    0xC3, 0xE9, 0xF2, 0x73, 0x27, 0x0B, 0x10, 0xFA, 0xF7, 0x20, 0x56, 0x66, 0x51, 0xA6, 0x76, 0x7E,
-    0x76, 0xD3, 0x47, 0x5B, 0xC9, 0x16, 0x73, 0x36, 0x7E, 0xBC, 0x5F, 0x31, 0x6E, 0x96, 0x29, 0x62,
-    0x32, 0x9F, 0xE3, 0x58, 0x8B, 0x12, 0x26, 0x0E, 0xEF, 0x54, 0x0D, 0x9E, 0x9D, 0xB5, 0xD0, 0x5B,
-    0x7C, 0x72, 0xDE, 0x24, 0x23, 0x5C, 0x7A, 0x3A, 0x9E, 0x30, 0x09, 0x60, 0x8D, 0xAA, 0xD6, 0xFC,
-    0xF0, 0xC9, 0xA5, 0x4E, 0x22, 0xC0, 0xA8, 0x6B, 0xDA, 0x4E, 0x8F, 0xE6, 0x26, 0x25, 0x13, 0x1A,
-    0x14, 0xC1, 0x73, 0x3A, 0xB8, 0x47, 0xA2, 0xD2, 0x21, 0x97, 0x96, 0x31, 0x65, 0x51, 0x3F, 0xB9,
-    0x1E, 0x10, 0x6E, 0x3F, 0xED, 0xE3, 0x0E, 0xEA, 0x1C, 0xF5, 0x49, 0xFB, 0xC0, 0xA9, 0x8F, 0xB9,
-    0xC0, 0x14, 0xE9, 0x98, 0xD4, 0x67, 0xD4, 0x50, 0x0E, 0x7E, 0x6E, 0x8D, 0x7D, 0x17, 0x1D, 0xD3,
-    0x0D, 0x1E, 0xE4, 0xAD, 0x98, 0xE6, 0x65, 0x12, 0xDA, 0x82, 0x6D, 0xFA, 0xE6, 0xEB, 0x40, 0xEF,
-    0x81, 0x9F, 0x57, 0xAA, 0x21, 0xA8, 0x29, 0xCB, 0x68, 0x64, 0xC4, 0x94, 0xD4, 0xC8, 0x88, 0x7E,
-    0xA1, 0xEC, 0x79, 0xDC, 0xE7, 0xD1, 0xD4, 0xD1, 0xB9, 0x57, 0x84, 0xCE, 0x55, 0x1D, 0x1F, 0xF3,
-    0x88, 0xD7, 0x42, 0x65, 0x62, 0xCC, 0x8C, 0x0D, 0xB0, 0x4C, 0x98, 0x4C, 0xC6, 0x84, 0x38, 0x09,
-    0xCA, 0x2E, 0x90, 0xB3, 0xD7, 0x67, 0xEC, 0xD7, 0x8B, 0xE6, 0x3F, 0x8D, 0xED, 0xCC, 0x15, 0xB2,
-    0xC8, 0x7E, 0x85, 0x93, 0x19, 0xB8, 0x27, 0xEE, 0x55, 0x58, 0x64, 0x9D, 0xAA, 0x0D, 0xD5, 0x9E,
-    0xC3, 0x48, 0xB5, 0x56, 0xCA, 0xCA, 0xCB, 0x4E, 0xB8, 0x62, 0x92, 0x1D, 0xC6, 0xF0, 0x83, 0xD1,
-    0xA6, 0x5F, 0xA9, 0x8C, 0x28, 0xA6, 0x32, 0xF9, 0x46, 0xE7, 0x3C, 0x3E, 0xE8, 0x9C, 0x9B, 0xFE,
-    0x63, 0x3C, 0xA7, 0x2D, 0x98, 0x07, 0x89, 0x86, 0x78, 0xC0, 0x39, 0x01, 0xCC, 0xD4, 0xDF, 0x53,
-    0xEE, 0xF2, 0xEC, 0x2D, 0x9E, 0x03, 0x14, 0x74, 0x8E, 0x6C, 0x73, 0xD4, 0xCB, 0xA7, 0x04, 0x4C,
-    0x7C, 0x6D, 0xA4, 0xEF, 0x7C, 0x32, 0x90, 0x48, 0x94, 0x75, 0x2E, 0xC5, 0x02, 0x7D, 0xB3, 0xF8,
-    0xAA, 0x83, 0x33, 0x53, 0x56, 0x9A, 0x25, 0x6D, 0x66, 0x3F, 0xA4, 0x9C, 0x14, 0x4D, 0x86, 0x28,
-    0xFD, 0x6A, 0x7F, 0x8A, 0x0F, 0xBA, 0x8B, 0x79, 0x3A, 0xAD, 0xFC, 0x27, 0x7C, 0x4F, 0x16, 0xFF,
-    0x23, 0x26, 0xD0, 0x6E, 0xB0, 0x37, 0x6A, 0x83, 0x58, 0xD9, 0xC3, 0x98, 0x16, 0x70, 0x54, 0x2C,
-    0x67, 0xD7, 0x31, 0xE9, 0x70, 0xB6, 0x59, 0xF7, 0x94, 0x68, 0xF0, 0x7A, 0xF5, 0x50, 0xAD, 0x86,
-    0x0F, 0xFB, 0x32, 0xBD, 0xF3, 0x1D, 0x78, 0x5A, 0x9F, 0x00, 0xA8, 0xAE, 0x2A, 0xAD, 0x43, 0xC5,
-    0xFA, 0x18, 0x22, 0x55, 0x49, 0xE9, 0xF4, 0x11, 0x5F, 0x0C, 0xCA, 0x71, 0xC7, 0xB2, 0x39, 0x9A,
-    0x15, 0x3C, 0x0F, 0x45, 0x39, 0x51, 0x87, 0x58, 0xB9, 0x56, 0x31, 0x44, 0x09, 0xAC, 0xF8, 0x64,
-    0xD4, 0x39, 0x3F, 0xF5, 0x35, 0xCF, 0x19, 0xB2, 0x4E, 0xE7, 0xAC, 0x3C, 0x33, 0x6A, 0x59, 0xED,
-    0x6F, 0x52, 0x63, 0x37, 0x69, 0x4F, 0x45, 0xEC, 0x22, 0xD6, 0x69, 0xC2, 0xC1, 0x58, 0x13, 0xEB,
-    0x7F, 0x3C, 0xA7, 0x94, 0x8E, 0xE0, 0x2A, 0x2C, 0x12, 0xF3, 0x5C, 0x6C, 0x12, 0x5B, 0xB3, 0x9D,
-    0xA2, 0x91, 0x74, 0x43, 0x9C, 0x62, 0x3F, 0x1A, 0x0D, 0x5A, 0xBC, 0xFF, 0x5C, 0x2F, 0x8C, 0xE6,
-    0xF7, 0xBC, 0xFD, 0x4A, 0x0D, 0xDF, 0x99, 0xF4, 0xAE, 0xCC, 0x12, 0xAF, 0xDB, 0xA5, 0xAD, 0xC2,
-    0x04, 0xE7, 0x53, 0x58, 0x98, 0x64, 0x8C, 0x3D, 0x4C, 0xCF, 0x43, 0xFE, 0x3A, 0x04, 0x66, 0xEA,
-    0x2B, 0xA0, 0xF7, 0x14, 0xF3, 0x37, 0xC4, 0xAB, 0xCE, 0x1A, 0xBA, 0x73, 0xD6, 0xC0, 0x07, 0x75,
-    0x19, 0x90, 0x99, 0xE4, 0xAA, 0x12, 0x54, 0x75, 0xD2, 0xDE, 0x84, 0x76, 0x9C, 0xFC, 0x19, 0x26,
-    0x32, 0x14, 0x90, 0x81, 0xFF, 0x98, 0xCC, 0xFE, 0x1D, 0xCC, 0xAE, 0x37, 0x6E, 0x16, 0xFA, 0x31,
-    0x2D, 0x0B, 0xCB, 0xB6, 0x86, 0x40, 0xE6, 0xDE, 0x2D, 0x03, 0xF9, 0x86, 0x99, 0x61, 0x8D, 0x3A,
-    0xFD, 0xA6, 0xA8, 0x4B, 0x34, 0x1A, 0x83, 0xB1, 0x16, 0x8F, 0xD9, 0xD4, 0x2E, 0xAA, 0x70, 0xC6,
-    0x59, 0xD3, 0x74, 0xE3, 0xD9, 0xAC, 0x9F, 0x4B, 0xFE, 0xD6, 0x73, 0xF5, 0x87, 0x62, 0xEA, 0x8D,
-    0xF3, 0x23, 0x2A, 0x5F, 0x69, 0x89, 0x18, 0xE9, 0x29, 0x99, 0x48, 0x31, 0xBD, 0xE3, 0x59, 0x31,
-    0x0B, 0x46, 0x88, 0x09, 0xCF, 0x89, 0x47, 0x9D, 0xF3, 0x4D, 0xFF, 0x12, 0x97, 0xB1, 0xCD, 0xD8,
-    0x25, 0xB8, 0xEA, 0xD7, 0x13, 0xCE, 0x61, 0x64, 0xF5, 0x2A, 0xCF, 0x81, 0x18, 0xF0, 0x1C, 0x49,
-    0x84, 0x8C, 0xB9, 0x97, 0xF3, 0x4A, 0xB0, 0x44, 0x21, 0x43, 0xF6, 0x8D, 0xDA, 0x9F, 0x8A, 0x4E,
-    0x7D, 0x66, 0x8A, 0xAA, 0xE4, 0xAF, 0x77, 0x8D, 0x8A, 0x41, 0x1E, 0x82, 0x71, 0x31, 0xA7, 0x7A,
-    0x83, 0x0B, 0x32, 0x14, 0xD4, 0x54, 0xF2, 0x3D, 0x1A, 0x2A, 0x75, 0x2C, 0xC4, 0xFB, 0x14, 0xFF,
-    0x30, 0x3F, 0x3C, 0x5E, 0x63, 0x31, 0x1A, 0xF8, 0x25, 0xFF, 0xD2, 0xF5, 0xDB, 0x94, 0xC9, 0x93,
-    0x67, 0x30, 0x7C, 0x98, 0xC6, 0x08, 0x71, 0x4B, 0x99, 0x0C, 0xB0, 0x8C, 0xA0, 0x65, 0xEC, 0x08,
-    0x84, 0xD4, 0xF7, 0x94, 0xFA, 0x46, 0xAD, 0x0B, 0x58, 0x0F, 0xC8, 0xF9, 0x7B, 0x20, 0xF5, 0x53,
-    0x87, 0x89, 0xFA, 0x97, 0x99, 0x5E, 0x4E, 0x37, 0x66, 0x47, 0x8E, 0x5C, 0xF0, 0xAC, 0xDB, 0x76,
-    0x63, 0xCD, 0x9A, 0x68, 0x39, 0x5B, 0x13, 0xA2, 0x60, 0xDC, 0x93, 0xA4, 0x22, 0xFF, 0x2B, 0xA8,
-    0x5A, 0xF6, 0x05, 0x28, 0x56, 0x97, 0x3E, 0x4D, 0x6D, 0x0B, 0xDC, 0xF3, 0x53, 0xA5, 0x7C, 0xD7,
-    0x0D, 0xF5, 0x83, 0x4D, 0x4A, 0xD5, 0x4E, 0xCC, 0x76, 0x28, 0x7F, 0xA5, 0x2E, 0x12, 0x66, 0xDC,
-    0x6A, 0x6B, 0x17, 0xA3, 0xB9, 0x57, 0x16, 0xCB, 0x71, 0x50, 0x32, 0xC9, 0x20, 0x27, 0x94, 0xA7,
-    0x3B, 0x58, 0xA8, 0x86, 0x82, 0xCF, 0x09, 0x75, 0x84, 0x40, 0xCE, 0xF5, 0xB7, 0x4B, 0x0B, 0x83,
-    0x25, 0x4E, 0xB5, 0x76, 0xCF, 0xCA, 0xFA, 0x79, 0x8D, 0xA4, 0x57, 0xF6, 0x6B, 0x6E, 0xF5, 0x54,
-    0x57, 0x97, 0xF4, 0x2E, 0x24, 0x9A, 0x5C, 0xD6, 0x7F, 0xA7, 0xE5, 0x92, 0xDA, 0x11, 0x46, 0xAD,
-    0x2A, 0x24, 0xB2, 0x37, 0x12, 0x0D, 0x15, 0xC3, 0xA2, 0x7A, 0xDA, 0xAD, 0x0D, 0x10, 0x1A, 0x43,
-    0x2E, 0x2C, 0xD6, 0x94, 0xCB, 0xCE, 0xAA, 0x5D, 0xDC, 0x51, 0x49, 0x97, 0x96, 0xAA, 0xC1, 0x62,
-    0x9B, 0x87, 0xC9, 0x77, 0xD4, 0x4B, 0xE0, 0x6B, 0x09, 0xA5, 0x3B, 0xF7, 0x9C, 0xF5, 0xF2, 0x5C,
-    0x5E, 0x9C, 0xE5, 0xDC, 0xC8, 0x7D, 0xEE, 0xEE, 0x0E, 0x6E, 0xF5, 0xFB, 0xB0, 0xC8, 0xAA, 0xC2,
-    0x44, 0xAE, 0x6C, 0x29, 0xD6, 0x68, 0xFA, 0x73, 0x6A, 0x17, 0x5C, 0x22, 0x46, 0x03, 0x1F, 0x36,
-    0xB0, 0x20, 0x91, 0x0C, 0x2C, 0x35, 0xC0, 0x7A, 0x50, 0xA9, 0x46, 0xD6, 0x29, 0xE2, 0x91, 0xA1,
-    0x4C, 0x32, 0x32, 0x92, 0x49, 0x06, 0x1E, 0x53, 0x1D, 0xB3, 0x5E, 0xC7, 0x8E, 0xC7, 0xAA, 0x65,
-    0xB3, 0xA7, 0x6F, 0x52, 0x2A, 0x4C, 0xCD, 0xDC, 0x31, 0x75, 0xF6, 0x07, 0xD5, 0xE8, 0xAC, 0x0D,
-    0xCD, 0x59, 0xE2, 0xDB, 0x3C, 0xF9, 0xAC, 0x35, 0x6C, 0xDD, 0xCE, 0xFC, 0x68, 0x9D, 0xDB, 0xBB,
-    0x9C, 0xDB, 0xAE, 0x2E, 0x5C, 0x2A, 0x0C, 0x8E, 0x7D, 0xD5, 0x11, 0x2C, 0x02, 0x33, 0x40, 0xE6,
-    0xAA, 0xDA, 0xE7, 0xEB, 0x01, 0x22, 0x58, 0xDD, 0xC4, 0x87, 0x3D, 0x30, 0xF2, 0x9F, 0x80, 0x89,
-    0x6A, 0x19, 0xC0, 0x53, 0x04, 0xEB, 0xB4, 0x4B, 0xD9, 0xDC, 0x39, 0x5A, 0xF4, 0x4A, 0x35, 0x3E,
-    0xE5, 0x8E, 0xAC, 0x4D, 0x25, 0xAE, 0x13, 0xD5, 0x5A, 0x26, 0xD5, 0x59, 0xFB, 0x9D, 0x17, 0x7E,
-    0xE0, 0x3E, 0x87, 0x4D, 0xBD, 0x48, 0xA9, 0xFB, 0x1D, 0x96, 0x52, 0x1A, 0x1B, 0x1C, 0xA5, 0x62,
-    0x61, 0x0D, 0xEF, 0x3C, 0x7E, 0x2E, 0x68, 0x42, 0x76, 0x65, 0x89, 0x48, 0x44, 0x7E, 0x25, 0xF3,
-    0xF0, 0x28, 0x95, 0x6E, 0xE2, 0xE4, 0xA3, 0x5E, 0xC4, 0xFF, 0x59, 0xB7, 0xD7, 0x18, 0x75, 0xE1,
-    0x68, 0x9B, 0xDB, 0x59, 0x2F, 0x3D, 0x1A, 0x00, 0x32, 0xF6, 0x5F, 0xAE, 0x58, 0xBD, 0xC7, 0xF5,
-    0x25, 0xD1, 0x63, 0x0F, 0x06, 0x91, 0x0C, 0x95, 0x94, 0xCF, 0xA5, 0xB9, 0x4D, 0x41, 0xC5, 0xED,
-    0x0C, 0xCA, 0x58, 0xCF, 0x62, 0xE3, 0x23, 0x4E, 0x51, 0xD4, 0xB8, 0x31, 0x2C, 0xF9, 0x41, 0x4A,
-    0x35, 0x63, 0xF2, 0xBC, 0xA2, 0x62, 0xCF, 0xFF, 0x42, 0x7F, 0xEB, 0x8A, 0x57, 0xB7, 0xA5, 0x0C,
-    0x94, 0xB7, 0xAA, 0x52, 0x7F, 0x96, 0xA2, 0xAC, 0xCA, 0xAF, 0x63, 0x50, 0xDF, 0x66, 0xF1, 0x90,
-    0x56, 0xA4, 0x7A, 0x14, 0x53, 0x18, 0x61, 0x27, 0xA2, 0x0E, 0x01, 0x6D, 0xD4, 0x9C, 0x4E, 0x63,
-    0x10, 0xDC, 0x95, 0xEF, 0xE7, 0x24, 0x8D, 0x87, 0xC7, 0x11, 0xBC, 0x74, 0xA5, 0xB5, 0xF0, 0x65,
-    0xBE, 0x88, 0x36, 0xB2, 0x62, 0x47, 0xA7, 0x67, 0xD5, 0x9D, 0x9A, 0x2E, 0xB6, 0xC2, 0x1C, 0x64,
-    0x0B, 0xAE, 0x4F, 0x8C, 0xA9, 0xAE, 0x8D, 0x81, 0x1C, 0xF8, 0xFE, 0xCC, 0x88, 0x4C, 0xE4, 0xAC,
-    0xCF, 0xCA, 0x4A, 0x1C, 0x89, 0x7E, 0xB3, 0x1E, 0x75, 0x1C, 0xF7, 0x41, 0x01, 0x96, 0xA4, 0x46,
-    0x96, 0x5A, 0x04, 0x0C, 0x06, 0x2A, 0xB6, 0xFA, 0x48, 0xBB, 0xF2, 0x4B, 0x5A, 0x3C, 0xB7, 0x9C,
-    0x0E, 0xD1, 0x1C, 0xAD, 0xBA, 0xC8, 0x7B, 0xAA, 0xC0, 0xC6, 0x7E, 0x19, 0x06, 0x38, 0x99, 0x6C,
-    0xB0, 0x3B, 0x7D, 0x62, 0xD6, 0x59, 0x2E, 0x26, 0xB6, 0xD2, 0xD3, 0x0B, 0x92, 0xF2, 0x0D, 0xD9,
-    0xB3, 0x92, 0x67, 0x24, 0x86, 0x3F, 0xB8, 0x32, 0xBA, 0xC7, 0x37, 0x73, 0x89, 0xA6, 0x9B, 0xC7,
-    0x38, 0x30, 0xA3, 0x6E, 0xBD, 0xF5, 0xBB, 0xCC, 0xDD, 0x5F, 0xE7, 0x6C, 0xD3, 0x4E, 0x18, 0x19,
-    0xE5, 0x58, 0x80, 0x9B, 0x1C, 0xC0, 0xE4, 0xAB, 0xFF, 0x1C, 0x08, 0x5A, 0xCF, 0xD2, 0x2C, 0x96,
-    0x8D, 0x0D, 0xFB, 0xEB, 0x31, 0x64, 0x19, 0x25, 0x6D, 0x61, 0xC3, 0x81, 0xDD, 0xD3, 0xEC, 0x2A,
-    0x8C, 0xA6, 0xAA, 0x89, 0x26, 0x71, 0x59, 0x8C, 0xD0, 0xF2, 0x34, 0x98, 0x57, 0x50, 0xE2, 0x76,
-    0x88, 0xAB, 0x43, 0xFF, 0x71, 0x3F, 0x7D, 0x72, 0x58, 0xE9, 0xE9, 0xCD, 0x9A, 0x86, 0x77, 0xC0,
-    0xD2, 0x34, 0x09, 0x1D, 0xEF, 0xD1, 0xDC, 0x82, 0xB0, 0xBC, 0xFE, 0x60, 0xC7, 0x36, 0xAC, 0xDA,
-    0x6A, 0x5D, 0x08, 0x6A, 0x48, 0x30, 0xED, 0x09, 0x8E, 0xF7, 0xDB, 0x4D, 0x9D, 0x4A, 0xB9, 0xBD,
-    0x75, 0x48, 0x12, 0xB1, 0x13, 0xC0, 0x70, 0x59, 0x4D, 0x81, 0xB0, 0xDC, 0x85, 0x82, 0x9C, 0x4C,
-    0xCD, 0x34, 0x56, 0xB8, 0x03, 0x42, 0x2B, 0x86, 0x15, 0xC0, 0x90, 0xFE, 0x78, 0x3D, 0x5C, 0xF2,
-    0x6E, 0x6E, 0x71, 0x8F, 0x67, 0x2D, 0x56, 0x4B, 0x79, 0x6B, 0xA9, 0x25, 0xA5, 0x96, 0x5B, 0xE5,
-    0x51, 0x25, 0xC4, 0xF0, 0xF0, 0x23, 0x17, 0x10, 0xFE, 0x68, 0xC5, 0x08, 0x72, 0xC3, 0xD0, 0x07,
-    0xA1, 0x23, 0x1D, 0x64, 0xBF, 0xC7, 0x07, 0xA9, 0x5A, 0x4A, 0xBC, 0xD1, 0x31, 0x90, 0x5C, 0xA8,
-    0xB6, 0x5D, 0x5B, 0xEA, 0x65, 0xAF, 0x2A, 0xFB, 0x44, 0xF0, 0x6C, 0x3A, 0x31, 0xEF, 0x92, 0x0E,
-    0xCF, 0x4F, 0xC5, 0x10, 0x8C, 0x1E, 0x3C, 0xA2, 0x3B, 0x1F, 0xA9, 0x68, 0xCD, 0xAA, 0x2A, 0x15,
-    0xD6, 0xA2, 0x5C, 0x73, 0xE4, 0x73, 0x17, 0xF8, 0xD2, 0x09, 0xDE, 0x2C, 0x0C, 0xE2, 0xFE, 0x44,
-    0xC2, 0xD0, 0x30, 0x76, 0x63, 0x47, 0x23, 0xC1, 0x46, 0x8C, 0xAD, 0x42, 0x56, 0xED, 0xE2, 0xA8,
-    0xC3, 0xFC, 0xA2, 0x23, 0x1C, 0xE4, 0xC4, 0x35, 0xF1, 0x70, 0xC9, 0xAB, 0x6C, 0xE9, 0xEB, 0xCE,
-    0xBB, 0x6C, 0x9C, 0x7B, 0xA9, 0x69, 0x69, 0xD6, 0xD3, 0xA9, 0xCA, 0x51, 0x6E, 0xA0, 0x44, 0x5B,
-    0x67, 0x3C, 0xEE, 0xD2, 0x71, 0xE6, 0x2A, 0xF4, 0x54, 0xBF, 0x50, 0xF1, 0x1B, 0x73, 0xD9, 0x3C,
-    0xE2, 0x28, 0xDE, 0xB7, 0x44, 0x34, 0xAC, 0x44, 0x67, 0x5A, 0x23, 0x63, 0xC2, 0xF1, 0x5B, 0xEA,
-    0x9C, 0xF7, 0xBB, 0x56, 0x87, 0x7D, 0x12, 0x7C, 0x5F, 0xE2, 0xFD, 0x80, 0xFB, 0x7D, 0x90, 0xD8,
-    0xB4, 0x8C, 0xDA, 0xB4, 0x54, 0x57, 0x17, 0x29, 0x7A, 0xA8, 0x3B, 0x35, 0xA7, 0x9B, 0xBA, 0x88,
-    0x74, 0xD5, 0xE3, 0x59, 0x10, 0xBC, 0x87, 0xFC, 0x57, 0xBC, 0x80, 0x5E, 0xDF, 0x69, 0x72, 0x85,
-    0xB7, 0x34, 0xDA, 0xC4, 0x99, 0x37, 0xDE, 0x95, 0x82, 0x72, 0xCB, 0xDE, 0x66, 0x4B, 0xBE, 0x72,
-    0xDC, 0x92, 0xD8, 0xD9, 0x14, 0x12, 0xA3, 0xAB, 0x73, 0x4E, 0x46, 0x7B, 0x11, 0xB2, 0xE5, 0xBA,
-    0x30, 0xDF, 0x77, 0x32, 0x09, 0xEC, 0xA3, 0x9A, 0xD9, 0x60, 0x9A, 0x41, 0xA1, 0xCA, 0xA4, 0x61,
-    0xDE, 0x9F, 0x37, 0xA6, 0x71, 0x5E, 0x35, 0x5A, 0x67, 0x75, 0xE6, 0x27, 0x1C, 0x4D, 0xAA, 0xD6,
-    0x34, 0x1E, 0x12, 0x1E, 0x94, 0x88, 0x5C, 0xC1, 0x1A, 0xE1, 0x10, 0xB0, 0x49, 0x7C, 0xCD, 0x24,
-    0x4F, 0xC6, 0x30, 0x1E, 0x2E, 0x9A, 0x49, 0x5A, 0xED, 0x05, 0x52, 0xC0, 0x9B, 0x9F, 0x32, 0xD7,
-    0xAB, 0x39, 0x12, 0x0A, 0x97, 0x91, 0xFB, 0x59, 0xFC, 0xB2, 0x33, 0xF1, 0x6D, 0xF0, 0x29, 0xA7,
-    0x2E, 0x53, 0x75, 0x00, 0xDE, 0x46, 0x70, 0x3A, 0x84, 0xB5, 0x6C, 0x2D, 0x41, 0x89, 0xE5, 0x09,
-    0xD8, 0x18, 0xA0, 0xA2, 0x4B, 0x2B, 0x0B, 0xFC, 0x51, 0x12, 0x6A, 0xD6, 0x7F, 0x06, 0xC6, 0x03,
-    0x58, 0xD3, 0x42, 0x5B, 0x56, 0xBA, 0xAD, 0x41, 0xF8, 0x97, 0xBB, 0x2A, 0xFF, 0xFE, 0x4F, 0xF1,
-    0x80, 0x0E, 0x8B, 0x72, 0x71, 0x57, 0xF9, 0x7F, 0x4C, 0xCD, 0x5C, 0xB9, 0x0C, 0xBF, 0x5A, 0xB6,
-    0x8B, 0xCD, 0x0A, 0xB4, 0x00, 0xD2, 0x1A, 0x1B, 0x42, 0x88, 0xDF, 0x38, 0x7D, 0x75, 0xEB, 0xA9,
-    0x0F, 0x76, 0xED, 0x87, 0xF9, 0xB0, 0xF2, 0xC3, 0xDC, 0x1C, 0x13, 0xF8, 0x36, 0xAE, 0x11, 0x3F,
-    0x16, 0x38, 0x2F, 0x24, 0x42, 0x70, 0x07, 0xC5, 0x26, 0xEB, 0xE0, 0xBD, 0xE9, 0x07, 0x02, 0xB1,
-    0xA4, 0x42, 0x1D, 0x53, 0xF9, 0x7E, 0x43, 0x1B, 0x57, 0xB6, 0xEA, 0x5D, 0x30, 0xEF, 0x50, 0x89,
-    0x9B, 0x47, 0x5C, 0x9A, 0x7F, 0x70, 0x07, 0x0B, 0x9C, 0x04, 0x9F, 0xC9, 0xF2, 0x49, 0xF5, 0x3C,
-    0xB9, 0xEF, 0xD7, 0x42, 0x95, 0xAE, 0x6A, 0xB3, 0xCF, 0x34, 0xFC, 0x89, 0x7A, 0xA2, 0xF9, 0xC6,
-    0x26, 0x66, 0xC7, 0x36, 0x20, 0xC1, 0xDA, 0x70, 0xAB, 0x43, 0x99, 0x68, 0x87, 0x4A, 0x37, 0xAF,
-    0xC8, 0x6F, 0x66, 0xAA, 0x07, 0xCB, 0x7E, 0x28, 0x4B, 0x26, 0x0E, 0x4B, 0xAF, 0x55, 0xB5, 0x94,
-    0x2B, 0x3E, 0xB0, 0x4C, 0x14, 0x92, 0xC7, 0x9D, 0x75, 0xE9, 0xEB, 0x2C, 0x29, 0x7D, 0x8D, 0x2B,
-    0x47, 0xB6, 0x48, 0x2B, 0x54, 0xCC, 0x3F, 0xE4, 0x84, 0x59, 0xCF, 0x59, 0x56, 0xF0, 0x83, 0x3E,
-    0x82, 0xD5, 0xF2, 0x9B, 0x44, 0x3D, 0xA3, 0x8D, 0x92, 0x03, 0x07, 0xA6, 0x30, 0x12, 0x1C, 0x0E,
-    0x7A, 0xA3, 0x86, 0x9E, 0xB8, 0x5D, 0x9E, 0xF2, 0xAC, 0xFB, 0xAC, 0x0B, 0x3B, 0x8C, 0x3A, 0x18,
-    0xF9, 0xA6, 0xA7, 0xC5, 0xCA, 0xA6, 0xED, 0x96, 0x9D, 0x6D, 0xC1, 0x8C, 0x50, 0x05, 0x33, 0x09,
-    0xE9, 0xA5, 0x33, 0xC2, 0x8A, 0x3D, 0x4E, 0xAC, 0xB3, 0xE9, 0x00, 0x31, 0x52, 0xAD, 0x43, 0xDD,
-    0x22, 0x85, 0x2C, 0xA2, 0xE9, 0x8A, 0x8A, 0x0A, 0x7E, 0xD7, 0x29, 0x58, 0x0B, 0xAE, 0x84, 0xBB,
-    0x2A, 0x52, 0x1E, 0xA4, 0x37, 0xC2, 0x2B, 0x9B, 0xF7, 0x93, 0x75, 0xB3, 0xE2, 0x08, 0xB0, 0x20,
-    0x3F, 0x74, 0xA0, 0x16, 0x03, 0xE4, 0x83, 0xAD, 0xF1, 0xC9, 0xDC, 0x28, 0xCA, 0xF4, 0x9D, 0xD2,
-    0xFC, 0xD1, 0xA9, 0xB2, 0xDE, 0x5F, 0xE7, 0xF6, 0x70, 0x4A, 0x08, 0xF5, 0x86, 0xD0, 0xC9, 0x34,
-    0x4B, 0x46, 0xE2, 0x25, 0xF3, 0x2F, 0xED, 0x91, 0x94, 0xB0, 0x8B, 0x0A, 0x00, 0x86, 0x08, 0xC2,
-    0xA8, 0xC3, 0x75, 0x64, 0x14, 0x8A, 0x3C, 0x71, 0xD1, 0x5D, 0x26, 0xFE, 0xC8, 0x47, 0x3C, 0x6D,
-    0x1D, 0x5E, 0x2F, 0xDF, 0x7A, 0x7C, 0xFC, 0x8B, 0xBE, 0xE2, 0xD0, 0x1F, 0xDD, 0x24, 0x7D, 0xD4,
-    0xBE, 0x18, 0xFA, 0xFC, 0x2A, 0xAB, 0x61, 0x87, 0xE5, 0x52, 0x6F, 0xDB, 0xEC, 0x7A, 0xB5, 0xDE,
-    0x3E, 0x47, 0x7C, 0xB6, 0x40, 0xA7, 0x0B, 0x58, 0x10, 0x9D, 0xF7, 0xD8, 0x66, 0x7E, 0xDA, 0x4E,
-    0xEC, 0xB1, 0x33, 0x65, 0xBC, 0x68, 0xD7, 0x07, 0xAE, 0x54, 0x8F, 0x64, 0xC7, 0x59, 0x47, 0x04,
-    0xC3, 0xFB, 0xB4, 0x96, 0x81, 0x51, 0xE6, 0x78, 0xE3, 0x2E, 0x79, 0xFF, 0x12, 0x24, 0x5C, 0x2D,
-    0xCF, 0x2C, 0xC1, 0xEF, 0x6D, 0x5C, 0x5A, 0x4E, 0x5A, 0xD2, 0xCB, 0x41, 0x9E, 0xB5, 0xA9, 0xF3,
-    0x3F, 0x52, 0xAD, 0x89, 0x99, 0x3D, 0x59, 0x9B, 0x5C, 0x51, 0x85, 0xC5, 0xF0, 0x26, 0x19, 0x29,
-    0xE2, 0x7C, 0x3A, 0x85, 0x72, 0xCE, 0x26, 0x84, 0x25, 0xB7, 0xB5, 0x5E, 0x55, 0x2E, 0xB1, 0xE3,
-    0x90, 0xD2, 0x57, 0xDB, 0x45, 0x1C, 0xE6, 0x2D, 0x09, 0xE5, 0x5D, 0xB4, 0xD5, 0x00, 0x35, 0x6C,
-    0x8B, 0x2F, 0xFB, 0xEF, 0x16, 0xCF, 0xB4, 0xF1, 0x10, 0x75, 0x37, 0x28, 0x11, 0xEB, 0x26, 0xED,
-    0x56, 0x9B, 0xF7, 0xE3, 0xDA, 0x27, 0x97, 0x99, 0x4F, 0x3F, 0xA3, 0x80, 0x99, 0xBE, 0x7D, 0x01,
-    0x93, 0x2D, 0x1C, 0x46, 0xC4, 0xAD, 0x61, 0x60, 0xC9, 0x20, 0x95, 0xB3, 0x41, 0xEE, 0x4D, 0x45,
-    0x9E, 0x7C, 0x04, 0xA8, 0x20, 0xE2, 0x2B, 0x5E, 0xCE, 0xB5, 0x88, 0x84, 0x06, 0x5C, 0x55, 0x36,
-    0x42, 0x1D, 0xCF, 0x7A, 0xB3, 0xB3, 0x4A, 0x64, 0xB8, 0x5F, 0xFA, 0xDF, 0x7B, 0xF3, 0x08, 0x6F,
-    0xBE, 0xE0, 0xB2, 0xDB, 0x8C, 0x2C, 0x48, 0xFA, 0x29, 0x8F, 0xA3, 0xA5, 0xEB, 0x7E, 0x01, 0x59,
-    0xE2, 0xF0, 0xC3, 0xEB, 0xEC, 0x67, 0xD0, 0x00, 0x56, 0x7E, 0x9B, 0xE5, 0xFE, 0x05, 0x64, 0xE9,
-    0xE7, 0x15, 0x8D, 0x83, 0xEA, 0xBB, 0x79, 0xA5, 0x26, 0xAC, 0xFE, 0xE7, 0x10, 0x8D, 0xED, 0xAB,
-    0xF8, 0x58, 0x23, 0xC2, 0x5C, 0xB8, 0x2D, 0xCE, 0x0F, 0xAB, 0xBE, 0x19, 0x96, 0x37, 0xEE, 0xB5,
-    0x65, 0x81, 0x8A, 0x0E, 0x1A, 0x01, 0x2C, 0xC6, 0x48, 0xE3, 0xC8, 0x53, 0x36, 0x28, 0xE4, 0x54,
-    0xD9, 0x54, 0x9C, 0x45, 0x9D, 0x59, 0xDA, 0x15, 0x04, 0x70, 0x39, 0x29, 0xD6, 0x80, 0x1A, 0x95,
-    0x87, 0x06, 0x19, 0x00, 0xC6, 0x72, 0x1D, 0xFF, 0x13, 0x78, 0x49, 0x01, 0xEB, 0x45, 0xDC, 0xE3,
-    0xB8, 0x77, 0x65, 0x64, 0x1D, 0x0E, 0x4C, 0xBF, 0xB7, 0x6A, 0x58, 0x21, 0x81, 0x21, 0x24, 0xCF,
-    0xFB, 0xC6, 0xCD, 0x4D, 0x81, 0x2B, 0xDB, 0xBE, 0xB0, 0xB6, 0x06, 0xDE, 0x60, 0x2E, 0x5F, 0x5F,
-    0x0D, 0x18, 0x42, 0x3E, 0xCD, 0x9C, 0xE2, 0x09, 0x68, 0xD3, 0x77, 0x98, 0x52, 0x79, 0xCA, 0xDF,
-    0xB5, 0x4D, 0xE5, 0xAF, 0x5C, 0xF0, 0x18, 0xFC, 0x4E, 0xDC, 0x65, 0xB0, 0xD7, 0xED, 0x43, 0x3C,
-    0x28, 0x94, 0x63, 0xEA, 0xB4, 0x51, 0x3A, 0x2E, 0xE4, 0x4E, 0x5E, 0xA5, 0x6D, 0x98, 0x80, 0x46,
-    0x5C, 0xCD, 0xAE, 0x12, 0xDA, 0x3C, 0x04, 0x36, 0x6C, 0x2B, 0xB8, 0xEA, 0xFF, 0x30, 0x79, 0x73,
-    0xE0, 0x7E, 0xA2, 0xD6, 0x0F, 0x08, 0x82, 0x7C, 0xB7, 0x66, 0x11, 0x06, 0x22, 0xF3, 0x80, 0xA8,
-    0xDE, 0x63, 0x6E, 0x69, 0x1D, 0x50, 0x2A, 0x04, 0xFF, 0x61, 0x56, 0xE4, 0xB7, 0x0E, 0xD0, 0x70,
-    0xDE, 0x86, 0x2F, 0x31, 0xD6, 0x36, 0xFC, 0x5F, 0x27, 0x8C, 0x33, 0x42, 0x2D, 0x23, 0x23, 0x97,
-    0x95, 0x0F, 0x0B, 0x53, 0xB5, 0x03, 0x24, 0x56, 0xAA, 0x2C, 0x7A, 0x77, 0x8F, 0x2D, 0x48, 0xF7,
-    0xBB, 0x90, 0xB2, 0x15, 0x9D, 0xDB, 0x93, 0xB6, 0xBB, 0xF1, 0xF3, 0xB9, 0xB5, 0xE4, 0xD4, 0x0E,
-    0xA5, 0x77, 0x1E, 0x5D, 0xEB, 0xCF, 0x96, 0x63, 0x36, 0x1F, 0x0D, 0xBF, 0x1D, 0xAB, 0x12, 0x90,
-    0xAB, 0x17, 0xA1, 0x4F, 0x44, 0xF3, 0xEC, 0x93, 0x6C, 0xD8, 0xB9, 0x35, 0xBB, 0xCE, 0x4F, 0xA1,
-    0x4C, 0x63, 0x93, 0xB1, 0xD6, 0xD6, 0xB1, 0x78, 0x95, 0x2A, 0xC1, 0x30, 0x57, 0x01, 0x89, 0xD1,
-    0x68, 0x7D, 0x49, 0xDA, 0x5F, 0xC8, 0x92, 0xEF, 0xA8, 0x7A, 0xE2, 0x16, 0xDD, 0x19, 0xEA, 0x84,
-    0x5B, 0x1B, 0xAC, 0x3C, 0x9C, 0x13, 0x84, 0xDD, 0x95, 0x99, 0xD0, 0x5D, 0x1B, 0xD4, 0x34, 0xCB,
-    0x3D, 0x09, 0x75, 0xE4, 0x6F, 0x6B, 0x37, 0xA3, 0xED, 0xEB, 0x29, 0xBC, 0xED, 0x8C, 0xB7, 0x34,
-    0xDF, 0x05, 0xB7, 0x2B, 0x99, 0x28, 0x11, 0x50, 0x54, 0xCB, 0x54, 0x5A, 0x1E, 0x3A, 0x36, 0x42,
-    0x8F, 0x2F, 0x2E, 0xC2, 0x73, 0xE9, 0xF8, 0xD7, 0x2A, 0xCB, 0xCE, 0x6D, 0x82, 0x46, 0x49, 0xFA,
-    0x4A, 0x3E, 0x40, 0x91, 0xD1, 0x94, 0x28, 0x52, 0x7D, 0x54, 0x4D, 0x36, 0xB9, 0xFC, 0xC0, 0x5D,
-    0x6D, 0xCB, 0xF7, 0x37, 0xDA, 0x16, 0x0F, 0xE4, 0xA4, 0x79, 0xAC, 0xC7, 0x64, 0x2F, 0x33, 0x58,
-    0xE1, 0x77, 0x2E, 0x0C, 0xDC, 0x27, 0xD4, 0xB2, 0x6E, 0x52, 0x7F, 0xF6, 0xD7, 0x27, 0xDB, 0xF7,
-    0x0D, 0x58, 0xD5, 0x29, 0xB0, 0x6C, 0xC7, 0x83, 0xB5, 0xE3, 0x5B, 0xFB, 0xBD, 0xD5, 0xDC, 0xAC,
-    0xF9, 0x71, 0xEE, 0x49, 0x66, 0xA9, 0xE3, 0x1D, 0x42, 0xA8, 0x25, 0x42, 0x35, 0x10, 0x8A, 0xF9,
-    0x80, 0x87, 0xB7, 0xDF, 0x33, 0x21, 0xCD, 0x9E, 0x8E, 0xB6, 0x9B, 0xCE, 0xEB, 0xBD, 0x2E, 0x7B,
-    0x8B, 0x2C, 0xF6, 0x4A, 0x22, 0xB6, 0xD1, 0x67, 0xDB, 0x68, 0x8F, 0xD1, 0xDA, 0x76, 0x82, 0xF0,
-    0xD8, 0x95, 0xF7, 0x2A, 0xF8, 0x79, 0x84, 0x2E, 0x99, 0xFF, 0x11, 0x03, 0x23, 0xC4, 0x73, 0x5D,
-    0xC5, 0x36, 0x7F, 0xC4, 0x61, 0x30, 0xBA, 0xDC, 0xF7, 0xD7, 0x06, 0xAA, 0x30, 0x2B, 0x04, 0x0B,
-    0x3D, 0xBB, 0x3A, 0x01, 0xBD, 0x6F, 0x0D, 0xE2, 0x4A, 0x95, 0x3F, 0x30, 0x2D, 0x4F, 0x92, 0x0A,
-    0x2A, 0xC3, 0x7C, 0x22, 0x2E, 0x8B, 0x5F, 0x6D, 0xD3, 0x06, 0x0B, 0xB2, 0x7A, 0x63, 0x60, 0x14,
-    0x54, 0xDD, 0xEC, 0x94, 0xD7, 0x4D, 0x7E, 0x3C, 0xA4, 0xDF, 0x21, 0xD9, 0x1D, 0xC6, 0xD5, 0x9B,
-    0x8A, 0x36, 0x8A, 0x40, 0x65, 0x00, 0x20, 0x58, 0x78, 0xAB, 0x3E, 0xC6, 0xD6, 0x48, 0xB1, 0x89,
-    0x6C, 0x13, 0x7F, 0x6B, 0x21, 0x50, 0xDA, 0x1B, 0x07, 0xC3, 0x88, 0x34, 0xDD, 0x60, 0xDA, 0x56,
-    0x67, 0xCF, 0xBC, 0x2E, 0xED, 0x7D, 0x73, 0x49, 0x6C, 0x9B, 0x59, 0xEE, 0xB4, 0xDB, 0x6D, 0x5C,
-    0xAB, 0x36, 0x11, 0x3D, 0x8D, 0xCE, 0xEC, 0xE3, 0xBA, 0xE0, 0xCE, 0xE5, 0x87, 0x65, 0xD5, 0xC6,
-    0x5D, 0x3C, 0x14, 0x23, 0xF3, 0xA3, 0x9F, 0xE4, 0x54, 0xD8, 0xF0, 0x89, 0x05, 0xEB, 0xA2, 0x31,
-    0x9A, 0x42, 0xEE, 0x65, 0xF6, 0xA5, 0x87, 0x8C, 0x15, 0x6D, 0x56, 0xAE, 0xFA, 0x74, 0x40, 0xE4,
-    0x04, 0x96, 0xC7, 0x54, 0xC5, 0xCB, 0xFE, 0x26, 0x64, 0xF2, 0x27, 0x77, 0xDE, 0xE0, 0x6E, 0xE6,
-    0x9F, 0x8E, 0x14, 0xCE, 0xA1, 0x50, 0x66, 0x9C, 0x9D, 0x87, 0xEB, 0x91, 0x7E, 0x27, 0x1C, 0x95,
-    0x9F, 0xF8, 0xBC, 0xED, 0x6F, 0x5C, 0x5E, 0x7F, 0xB7, 0x2B, 0xC8, 0xEA, 0xFB, 0x41, 0xD4, 0xA4,
-    0x88, 0xD8, 0x93, 0x59, 0x9A, 0x8E, 0x51, 0xC1, 0xC5, 0xA5, 0xB4, 0x3B, 0xBF, 0x2A, 0xDF, 0x66,
-    0xFE, 0xBF, 0xBC, 0x7F, 0xCA, 0xFB, 0x67, 0x18, 0x0C, 0x77, 0x58, 0x87, 0x70, 0x5E, 0x2B, 0xE6,
-    0x12, 0x95, 0x83, 0x66, 0xED, 0xAE, 0xAA, 0x19, 0x49, 0xF8, 0x4F, 0xA8, 0x07, 0x8F, 0x29, 0xB0,
-    0xF5, 0x34, 0x6E, 0xBF, 0xC1, 0x25, 0x33, 0x22, 0xBC, 0xDB, 0x05, 0xBD, 0xBF, 0x17, 0x56, 0xD0,
-    0xEF, 0x6D, 0x55, 0x14, 0xE9, 0xB5, 0x2F, 0x61, 0x39, 0x45, 0xF5, 0xE7, 0xE4, 0x99, 0xAD, 0x8C,
-    0x52, 0x42, 0x93, 0x42, 0x55, 0xEA, 0x4C, 0xD2, 0x3C, 0x72, 0x8F, 0x0D, 0x73, 0x7F, 0x89, 0xE9,
-    0x38, 0xC0, 0xCC, 0xA0, 0xB4, 0x2C, 0x36, 0x41, 0x35, 0x98, 0x8A, 0xA7, 0x6C, 0x49, 0x61, 0xB9,
-    0x33, 0x6B, 0xE0, 0xBB, 0xC3, 0x49, 0x8D, 0x38, 0x1B, 0xEE, 0xBA, 0x54, 0x89, 0x31, 0x6E, 0x95,
-    0x1C, 0x64, 0x6E, 0x31, 0xFE, 0x89, 0xB8, 0x7A, 0xE1, 0xE6, 0xA6, 0x13, 0xDB, 0x16, 0xBA, 0xF6,
-    0xBB, 0xE0, 0xA5, 0xDB, 0x6E, 0xA7, 0x2B, 0xE0, 0xC5, 0x9B, 0x2B, 0xDA, 0x69, 0xDF, 0x2D, 0x3E,
-    0x5E, 0xC1, 0xB8, 0xFB, 0xB7, 0x25, 0x8D, 0x78, 0xC4, 0x72, 0x0A, 0x33, 0x97, 0x49, 0xA7, 0x4E,
-    0xDA, 0x9B, 0xFC, 0x78, 0xBC, 0x6B, 0xAF, 0x96, 0x62, 0xD6, 0x21, 0xF6, 0x3D, 0xA6, 0x5F, 0xF8,
-    0xEF, 0xB3, 0x01, 0x6C, 0xD4, 0x77, 0x1A, 0x94, 0xDC, 0x54, 0xAE, 0x7D, 0xAD, 0xDC, 0xA6, 0x34,
-    0x84, 0xDA, 0xA4, 0x4B, 0xFB, 0x50, 0x34, 0x0A, 0x65, 0x5E, 0xD1, 0x77, 0x34, 0xA8, 0xE1, 0x42,
-    0x41, 0x86, 0x7D, 0x37, 0x45, 0x32, 0x6C, 0xA3, 0xA8, 0x70, 0x6F, 0xC3, 0x55, 0xB6, 0x43, 0xDF,
-    0x5A, 0x27, 0xAA, 0x29, 0xDF, 0x35, 0xA4, 0x9E, 0xDA, 0x72, 0xFA, 0xFE, 0x6D, 0xAC, 0x5A, 0xA9,
-    0x39, 0xA7, 0x9D, 0xB3, 0x73, 0xD6, 0xAA, 0xF9, 0xBE, 0x53, 0x23, 0x67, 0x92, 0xBE, 0x53, 0x70,
-    0xA8, 0xAA, 0x41, 0x9D, 0x7D, 0x29, 0xF4, 0x4D, 0x52, 0x07, 0x7E, 0xB3, 0x92, 0x7A, 0x75, 0x66,
-    0x55, 0x74, 0xA8, 0x88, 0x9E, 0x1A, 0x83, 0xE5, 0x7C, 0xD5, 0x42, 0x29, 0x62, 0xA1, 0x83, 0xDC,
-    0x35, 0x7C, 0xE1, 0x83, 0x2E, 0x99, 0x98, 0xD4, 0xE1, 0xA6, 0xD4, 0xD8, 0x43, 0x15, 0x81, 0xFF,
-    0xA1, 0x57, 0x31, 0xA0, 0xF4, 0x4B, 0x2F, 0xD6, 0x69, 0x0C, 0xCF, 0xCD, 0xE9, 0x0F, 0x7D, 0xB5,
-    0xCC, 0xB4, 0x97, 0xAB, 0x7B, 0xE4, 0xCC, 0x57, 0xCB, 0x3C, 0x86, 0xE0, 0xD4, 0x77, 0x59, 0xED,
-    0xFD, 0x49, 0xCB, 0xAD, 0x4D, 0xC9, 0x0F, 0x7D, 0xB7, 0xA2, 0x40, 0x77, 0x4C, 0xB9, 0xF3, 0x67,
-    0x75, 0xF6, 0x67, 0x70, 0x1B, 0xFC, 0xBC, 0x48, 0xCB, 0xFE, 0x34, 0x1E, 0xFC, 0x3D, 0x0F, 0x1D,
-    0x49, 0x3F, 0x2E, 0x33, 0xB8, 0x0B, 0xA5, 0xD2, 0x6D, 0x16, 0x41, 0x32, 0x6D, 0xA5, 0xE6, 0xF1,
-    0xEE, 0x75, 0x4E, 0xAC, 0xA0, 0xE1, 0xD5, 0x1A, 0x0A, 0xC8, 0xA6, 0x23, 0x88, 0x76, 0xC1, 0x42,
-    0x59, 0x52, 0x83, 0x41, 0x46, 0x4D, 0x64, 0xB9, 0xA6, 0x7A, 0xAE, 0x5B, 0x06, 0x76, 0xD8, 0x2C,
-    0x5F, 0xBD, 0x73, 0x37, 0x96, 0x4F, 0x10, 0xCB, 0x8C, 0x58, 0x26, 0x35, 0xEB, 0x38, 0x2D, 0xE2,
-    0xB7, 0x4B, 0x43, 0xB2, 0xEB, 0xE7, 0xAA, 0xFC, 0xDC, 0x7C, 0xBD, 0x7C, 0x71, 0x0A, 0x8D, 0xE6,
-    0x7A, 0x09, 0x87, 0x8B, 0xED, 0x96, 0xCE, 0xC5, 0x56, 0x5D, 0x44, 0xF0, 0x1B, 0x03, 0x9C, 0x3B,
-    0x4C, 0x4F, 0x8D, 0xAB, 0x5B, 0xD5, 0x18, 0x50, 0xF2, 0x1E, 0x0E, 0xA7, 0x19, 0xDB, 0xB3, 0x3F,
-    0xDE, 0x7D, 0x84, 0x3D, 0x3A, 0xB9, 0x9F, 0xAE, 0x6F, 0x58, 0xD1, 0x2A, 0x4E, 0xFC, 0xB0, 0x6E,
-    0xAA, 0x65, 0x37, 0xC4, 0xB3, 0xDC, 0xD8, 0xAD, 0x3C, 0x43, 0xDC, 0xE0, 0x10, 0x8E, 0x7E, 0xB1,
-    0x10, 0x66, 0x04, 0x1E, 0xB9, 0x9F, 0x00, 0xE2, 0x36, 0xE7, 0x68, 0x03, 0x95, 0xA5, 0xDA, 0xA6,
-    0xCF, 0x6C, 0x8C, 0x18, 0x57, 0xAD, 0xA1, 0x16, 0x74, 0xFB, 0xDF, 0x63, 0x11, 0x3C, 0x1B, 0xF9,
-    0x86, 0x2D, 0xFA, 0x55, 0xCD, 0x41, 0x17, 0xFF, 0x44, 0xB9, 0x4F, 0x9B, 0xA8, 0x21, 0x8F, 0xE7,
-    0x4F, 0x72, 0xF6, 0xA7, 0x8D, 0xCA, 0xA4, 0x0D, 0xBB, 0xD8, 0xBF, 0xCE, 0xF8, 0xDD, 0x7F, 0x71,
-    0x82, 0x30, 0xBF, 0x28, 0x43, 0x33, 0x2F, 0xC1, 0x1F, 0x3F, 0x2B, 0xA5, 0xB5, 0xA0, 0x41, 0x39,
-    0xB8, 0x37, 0xE5, 0xC1, 0xEA, 0xCF, 0x6D, 0x77, 0xA9, 0x4A, 0xA3, 0x2D, 0x8B, 0x6E, 0x8D, 0xD5,
-    0x73, 0x7E, 0x69, 0x6E, 0xC5, 0x71, 0x5B, 0xE9, 0x33, 0xAD, 0x37, 0xFF, 0x3D, 0x1F, 0xBB, 0xED,
-    0xB7, 0x20, 0xCD, 0xB6, 0x58, 0x12, 0x3B, 0xEF, 0xFC, 0x2B, 0x9A, 0x5D, 0x77, 0x49, 0x55, 0x6F,
-    0x1B, 0xB3, 0xEF, 0xF1, 0x40, 0x3E, 0xEA, 0xA3, 0x7A, 0x48, 0x75, 0x5D, 0xF6, 0x52, 0xC8, 0x57,
-    0x3A, 0xFD, 0x92, 0xB6, 0xA0, 0xFC, 0x2F, 0x55, 0x91, 0xBD, 0x6E, 0x13, 0x41, 0x14, 0x85, 0xCF,
-    0xCE, 0x1A, 0x2F, 0x61, 0x8B, 0x71, 0x91, 0x48, 0x28, 0x42, 0x0C, 0x85, 0x8B, 0x10, 0x91, 0x6C,
-    0x4B, 0x91, 0xEC, 0x5D, 0x94, 0x92, 0x22, 0x2E, 0x92, 0x9E, 0x82, 0x86, 0x0A, 0x0A, 0x0A, 0x17,
-    0x8E, 0xC6, 0x96, 0x1F, 0x00, 0x2A, 0x9E, 0x20, 0x05, 0xCA, 0x13, 0x50, 0xD8, 0xF1, 0xC0, 0xBE,
-    0xC0, 0x36, 0xC8, 0x05, 0xCD, 0x22, 0x21, 0x51, 0x32, 0x48, 0x83, 0xB4, 0x88, 0x99, 0x1D, 0x66,
-    0x1D, 0x51, 0x70, 0x75, 0xAB, 0xB9, 0x7F, 0x67, 0xBE, 0xD3, 0x83, 0x49, 0x75, 0xA6, 0xA9, 0x92,
-    0x8A, 0xA6, 0x07, 0x08, 0x91, 0x80, 0x98, 0x13, 0xDA, 0xA7, 0x86, 0xF0, 0x0A, 0x37, 0x91, 0x56,
-    0x20, 0x8D, 0x55, 0xC3, 0x5A, 0x9B, 0x68, 0x27, 0xAA, 0x9C, 0x8A, 0xAE, 0x37, 0xA9, 0xEF, 0x66,
-    0x4D, 0x4E, 0xAD, 0xBB, 0x20, 0xFB, 0x58, 0x68, 0x44, 0xD8, 0xBD, 0x7A, 0x4F, 0xDE, 0x4A, 0x6F,
-    0x77, 0xCE, 0x47, 0x5B, 0xE8, 0xE5, 0xB8, 0x47, 0xD3, 0x05, 0x79, 0x23, 0x7C, 0xC5, 0x5A, 0xF4,
-    0xE7, 0x4E, 0xAE, 0x2D, 0x15, 0x45, 0x98, 0x15, 0xCA, 0x52, 0xE9, 0x64, 0xC8, 0x93, 0xA6, 0x87,
-    0xA2, 0xFF, 0x9B, 0xFB, 0x2F, 0xDF, 0xFF, 0xD4, 0xD7, 0x43, 0x02, 0x15, 0x1E, 0x39, 0x78, 0xD7,
-    0x85, 0xE7, 0x58, 0x19, 0xF1, 0xA3, 0xAC, 0x27, 0xC7, 0x71, 0x59, 0x2D, 0xE8, 0xE5, 0xCC, 0xD7,
-    0xFD, 0x6F, 0x1B, 0x4D, 0x07, 0xB1, 0x12, 0x9F, 0x2C, 0xFF, 0xD9, 0xF2, 0xA0, 0x55, 0xAF, 0x62,
-    0x2D, 0xA1, 0xEF, 0x6F, 0x2A, 0x03, 0x3C, 0x5B, 0x30, 0xBB, 0x4C, 0xB5, 0xCC, 0x14, 0x79, 0x08,
-    0x07, 0x6E, 0x82, 0xD6, 0xAE, 0x34, 0xDC, 0x8A, 0xB5, 0xE5, 0xA5, 0xA6, 0xD3, 0x4A, 0x0A, 0xB5,
-    0xC8, 0xA0, 0x8F, 0xBA, 0xE7, 0xFD, 0x42, 0xF8, 0x8F, 0xDE, 0xBF, 0xF9, 0xEC, 0xC7, 0x70, 0x05,
-    0x9B, 0x6E, 0xD6, 0x24, 0x6A, 0x91, 0x54, 0xC4, 0x1A, 0x5E, 0x93, 0x5A, 0x15, 0x97, 0x48, 0x34,
-    0xD5, 0x52, 0xB5, 0x89, 0xCE, 0x66, 0x56, 0xA8, 0x31, 0x78, 0xE9, 0x56, 0xA7, 0xBA, 0x4D, 0x6B,
-    0xC9, 0xCC, 0x1D, 0xF4, 0x60, 0x83, 0x1C, 0x3A, 0xD1, 0xC7, 0x89, 0x1A, 0x04, 0x60, 0x9E, 0x7F,
-    0x75, 0xF4, 0xB4, 0x0A, 0x57, 0xA3, 0xC8, 0xD2, 0xDA, 0xC9, 0xD9, 0x5B, 0x1E, 0x50, 0xFC, 0xFB,
-    0xF2, 0x36, 0x46, 0x51, 0xC1, 0x9B, 0x7C, 0x39, 0x3E, 0xFC, 0x70, 0x78, 0x31, 0x21, 0xD3, 0x9F,
-    0xA2, 0x10, 0x4A, 0x16, 0x2E, 0xD6, 0x19, 0x33, 0xB7, 0x10, 0x8D, 0x52, 0x9B, 0x5A, 0xD8, 0x28,
-    0x10, 0x27, 0xF5, 0x10, 0x18, 0x25, 0x8A, 0x07, 0x2C, 0x39, 0xE4, 0x19, 0x59, 0x51, 0x23, 0x72,
-    0x59, 0x69, 0x69, 0x6E, 0x64, 0xAA, 0x5F, 0x6C, 0xF4, 0x32, 0x03, 0xE6, 0x0B, 0xE6, 0x35, 0x6B,
-    0xDB, 0xD8, 0x8A, 0xB2, 0x61, 0x7A, 0x88, 0xC1, 0xED, 0xFF, 0x5C, 0xA8, 0x83, 0x0B, 0x9D, 0x9F,
-    0xFA, 0x51, 0x66, 0x73, 0xE9, 0xDD, 0x84, 0x9A, 0x3D, 0xDE, 0x91, 0xD9, 0x39, 0x3F, 0xBB, 0x31,
-    0x6E, 0xFF, 0xEA, 0x12, 0xBB, 0x61, 0x8B, 0xE1, 0xDE, 0xD2, 0x3B, 0x7B, 0x04, 0xFB, 0x00, 0xAF,
-    0x37, 0xFB, 0x7B, 0x61, 0x6E, 0x8A, 0xC4, 0x20, 0xB6, 0x88, 0x1D, 0x98, 0x05, 0x42, 0xEE, 0x05,
-    0xD7, 0xB7, 0x13, 0x43, 0x73, 0x97, 0xD5, 0x9E, 0x1B, 0x7A, 0xD2, 0x6C, 0x80, 0x26, 0xF5, 0x92,
-    0xFF, 0xF2, 0x6B, 0x03, 0xFC, 0x05, 0xDD, 0x7D, 0x4D, 0x90, 0xDD, 0xD6, 0x95, 0xDE, 0xC5, 0x03,
-    0xBB, 0x61, 0x13, 0x35, 0x06, 0x53, 0x21, 0x53, 0xB6, 0x38, 0x11, 0x36, 0x5E, 0x38, 0x8A, 0x6D,
-    0x64, 0xE9, 0x85, 0x2C, 0x80, 0x62, 0xA5, 0xB8, 0xD0, 0xC2, 0x3D, 0x09, 0x5B, 0x9A, 0x89, 0x17,
-    0xF2, 0x42, 0xA9, 0xB2, 0x66, 0xD3, 0x59, 0xCC, 0x22, 0xA9, 0x92, 0x05, 0x48, 0x5C, 0xB8, 0x2A,
-    0x5A, 0x88, 0x95, 0x78, 0x92, 0x85, 0x17, 0x62, 0x55, 0x34, 0x29, 0x9B, 0x5C, 0x30, 0x8B, 0x54,
-    0x2A, 0x35, 0x25, 0x12, 0x90, 0x58, 0x15, 0x57, 0x8D, 0x16, 0x84, 0xA4, 0xD2, 0x78, 0xE1, 0x85,
-    0x40, 0x89, 0x56, 0x26, 0xE2, 0xA2, 0x41, 0x09, 0x94, 0xD0, 0x24, 0x80, 0x9B, 0xF3, 0x7D, 0xE7,
-    0xE2, 0xF5, 0x6B, 0xFE, 0xC8, 0x92, 0x4D, 0x5A, 0xB4, 0x9B, 0xEC, 0xF7, 0xBA, 0x5F, 0xE3, 0x5D,
-    0xDC, 0x7B, 0xEE, 0xF9, 0xF9, 0xCE, 0xDF, 0x7D, 0xC6, 0xE8, 0x57, 0xC0, 0xC7, 0x34, 0x93, 0x07,
-    0xCF, 0x16, 0xF2, 0xE8, 0xF3, 0x71, 0x61, 0x2B, 0xBC, 0x5E, 0xE2, 0x75, 0xF3, 0x55, 0xB3, 0xE7,
-    0xCB, 0xCA, 0x57, 0x16, 0xCA, 0xC3, 0x68, 0x62, 0x79, 0x6C, 0x8D, 0x3F, 0x79, 0x5B, 0x95, 0x89,
-    0x3B, 0x93, 0xCB, 0x3B, 0x2A, 0xAF, 0x97, 0x31, 0x4C, 0x50, 0x99, 0x68, 0xC0, 0xD5, 0x79, 0xC3,
-    0xA1, 0x31, 0x90, 0xBC, 0xA7, 0x97, 0x7B, 0x59, 0x5B, 0x73, 0x10, 0xB9, 0xF9, 0x84, 0x2B, 0x92,
-    0x8E, 0xA3, 0x56, 0xBC, 0xB9, 0x59, 0x34, 0x26, 0xEA, 0x4D, 0x5C, 0x99, 0xBC, 0x36, 0x93, 0xCC,
-    0x23, 0x3B, 0x2C, 0xE3, 0xCA, 0xD5, 0x15, 0xEE, 0x68, 0xF1, 0x6E, 0xCB, 0xEB, 0x37, 0x3C, 0x79,
-    0x88, 0xDA, 0x5C, 0x06, 0x2E, 0x2F, 0xC8, 0x38, 0xFE, 0x14, 0xB7, 0x72, 0x8B, 0x96, 0x4B, 0xB9,
-    0xE9, 0x2B, 0xE2, 0x9B, 0x4A, 0x79, 0xAC, 0x3D, 0x8E, 0x62, 0xD2, 0xE6, 0x9F, 0x0C, 0x98, 0x55,
-    0xD0, 0x9A, 0x70, 0x30, 0x71, 0x61, 0xD2, 0xD6, 0x3C, 0xE3, 0x26, 0xA1, 0xB3, 0x8A, 0x79, 0x17,
-    0x79, 0x4F, 0x21, 0xB3, 0x92, 0xA5, 0x62, 0x90, 0xD6, 0x2D, 0x67, 0xC1, 0xE5, 0xE8, 0xFA, 0xE4,
-    0x8D, 0xDF, 0x96, 0x37, 0x16, 0xDE, 0x60, 0x82, 0xD1, 0x44, 0x8D, 0x2C, 0xC7, 0x2B, 0xB3, 0x40,
-    0xEE, 0x32, 0xF0, 0x8E, 0xAD, 0x4F, 0x7A, 0x71, 0xE2, 0xF6, 0x02, 0x1E, 0x06, 0x2C, 0xC7, 0xBE,
-    0x70, 0xED, 0xC9, 0xF1, 0xFB, 0x5D, 0x29, 0xEF, 0xCC, 0x1F, 0x6B, 0xE2, 0x2E, 0x68, 0x5F, 0x59,
-    0x58, 0x73, 0xCE, 0xCB, 0x64, 0x3C, 0xD2, 0x01, 0xA4, 0xFB, 0xF5, 0xCB, 0x33, 0xD1, 0x4A, 0xDC,
-    0x3C, 0x9A, 0xBE, 0x2F, 0xB3, 0xB1, 0x45, 0x3C, 0x60, 0x76, 0xB6, 0x96, 0x69, 0x84, 0x23, 0x26,
-    0x90, 0xD7, 0xA0, 0xB8, 0xFC, 0xD8, 0x98, 0xB2, 0x96, 0xE7, 0x70, 0x58, 0xB7, 0x3B, 0xC6, 0xBE,
-    0x66, 0x6D, 0x13, 0xF5, 0xA9, 0x1D, 0x3D, 0x0E, 0x97, 0x62, 0xEA, 0x81, 0x4C, 0xFA, 0x4F, 0xB0,
-    0x1D, 0xFE, 0xF5, 0xB2, 0xC1, 0x66, 0xF4, 0x58, 0x8E, 0x2C, 0xCF, 0xAC, 0xFF, 0xBF, 0x55, 0x92,
-    0x71, 0xCF, 0xFD, 0x96, 0x34, 0xA8, 0x41, 0x0E, 0xCB, 0x75, 0xE3, 0x85, 0x68, 0x07, 0xAF, 0x7E,
-    0xDD, 0xDC, 0xCA, 0x15, 0x98, 0xAC, 0x2C, 0xDB, 0x71, 0x85, 0x3D, 0x94, 0x0B, 0x57, 0xF4, 0xB2,
-    0x8B, 0x32, 0x84, 0xDF, 0x61, 0x51, 0x11, 0xB9, 0xE2, 0xBB, 0x24, 0x63, 0x36, 0x73, 0xC5, 0xE8,
-    0xC8, 0x68, 0xF6, 0xD0, 0x7F, 0x2F, 0x57, 0x2C, 0xC9, 0xBD, 0x42, 0xFF, 0xDC, 0x36, 0x24, 0x4F,
-    0x4D, 0x9E, 0xD2, 0x59, 0x6C, 0x66, 0xF8, 0xAB, 0xFC, 0x01, 0xFB, 0x5C, 0x19, 0x4E, 0x27, 0x9D,
-    0xB2, 0xBC, 0x8A, 0x26, 0xE3, 0xF7, 0x0B, 0x21, 0x5F, 0x0A, 0x0A, 0xFB, 0xAD, 0xEC, 0xBA, 0x39,
-    0xA8, 0xC3, 0x73, 0xA7, 0xE5, 0x4D, 0xF8, 0x23, 0xF8, 0x44, 0x36, 0x6C, 0x72, 0x13, 0xD2, 0x3B,
-    0xA7, 0x72, 0xC1, 0x01, 0x48, 0x84, 0x5F, 0xC5, 0x32, 0xD9, 0xC9, 0xC8, 0x45, 0x49, 0x13, 0xD8,
-    0xEB, 0xE5, 0x68, 0x12, 0xBE, 0x2F, 0xE7, 0x2C, 0x4A, 0x3C, 0x98, 0x35, 0x4E, 0x64, 0xED, 0xB8,
-    0x2C, 0x04, 0xFB, 0x0E, 0x0E, 0x0A, 0x31, 0x62, 0xDE, 0x04, 0xDD, 0x02, 0x24, 0x90, 0x85, 0xA4,
-    0x32, 0xBC, 0x27, 0x5B, 0xD8, 0xE0, 0x16, 0x2D, 0xAE, 0xEC, 0xB0, 0x94, 0xC1, 0x3D, 0x04, 0x78,
-    0x58, 0x60, 0x6B, 0x3C, 0xDB, 0x46, 0x95, 0x67, 0xAB, 0x5C, 0xAE, 0x5B, 0x0C, 0x42, 0x83, 0x48,
-    0xA4, 0xA1, 0x49, 0xBB, 0xD0, 0x62, 0x6D, 0x9D, 0x47, 0xD6, 0xCA, 0x71, 0x5F, 0x2F, 0x53, 0x46,
-    0x07, 0x45, 0xE4, 0x1D, 0x64, 0x5B, 0x27, 0xD3, 0xD8, 0x40, 0x2C, 0x07, 0x14, 0xBC, 0xFD, 0x8B,
-    0xD3, 0x6D, 0x5E, 0xC4, 0x36, 0x80, 0xD0, 0x60, 0x25, 0x8C, 0xE9, 0x83, 0xAC, 0x2A, 0x77, 0xE9,
-    0xF3, 0x98, 0x8A, 0x08, 0xA8, 0x7D, 0x4C, 0x7E, 0x68, 0xF2, 0xEC, 0x16, 0x71, 0x03, 0x3D, 0x5B,
-    0x61, 0x84, 0x5E, 0xC7, 0xE2, 0xE0, 0xD8, 0x51, 0x12, 0x14, 0x77, 0xE0, 0x0F, 0xD8, 0x4C, 0x6E,
-    0x3F, 0xF6, 0x81, 0xFB, 0x8B, 0xEB, 0xE2, 0xDE, 0xED, 0xF0, 0x2D, 0xD7, 0x61, 0x2A, 0x1C, 0x38,
-    0xB5, 0x93, 0xBB, 0x51, 0xC6, 0xB9, 0x81, 0xFD, 0x8A, 0x79, 0xBB, 0xB8, 0xA9, 0xE4, 0x13, 0xF2,
-    0x10, 0xC7, 0xFD, 0x0D, 0x7F, 0x51, 0xD5, 0x97, 0xD7, 0x77, 0xFA, 0x0B, 0x45, 0x80, 0x1C, 0x21,
-    0xBA, 0x49, 0xE7, 0xF2, 0x0D, 0xFC, 0x39, 0xFE, 0xA5, 0x4E, 0x20, 0xC3, 0xB4, 0x32, 0xB0, 0x24,
-    0xDE, 0xF2, 0x13, 0x25, 0x43, 0x4E, 0xEE, 0xA3, 0xEC, 0x82, 0x0E, 0xFC, 0x1D, 0xF7, 0xF6, 0x87,
-    0x90, 0xB3, 0xF7, 0xFB, 0x90, 0x2C, 0x1D, 0x74, 0xCA, 0xDA, 0x61, 0xAB, 0xCF, 0x51, 0xC3, 0x9B,
-    0x98, 0xA8, 0x56, 0x1D, 0x14, 0x57, 0xC9, 0x35, 0xB2, 0x61, 0xA5, 0xCB, 0x16, 0x0E, 0x56, 0x76,
-    0x33, 0xF9, 0x75, 0xF0, 0xCD, 0x24, 0xD3, 0x4B, 0x44, 0x9B, 0x8D, 0xB2, 0x3E, 0x19, 0xC1, 0x1F,
-    0xE4, 0x59, 0x46, 0x0E, 0x84, 0xBF, 0x0A, 0x79, 0x8E, 0x5A, 0x91, 0xB3, 0x68, 0xF8, 0x7A, 0x5A,
-    0x09, 0x51, 0x63, 0x51, 0x07, 0x85, 0xCC, 0xBC, 0x6C, 0x4B, 0x4B, 0xDE, 0xAD, 0xCA, 0x01, 0x4C,
-    0x34, 0x89, 0x76, 0x58, 0x70, 0x7E, 0xFB, 0x76, 0x77, 0x71, 0xC2, 0x46, 0x62, 0x79, 0x01, 0x48,
-    0x2C, 0x97, 0x65, 0x25, 0xA9, 0x3C, 0x91, 0x61, 0x20, 0xBE, 0x2A, 0xC1, 0x65, 0x85, 0xFF, 0x24,
-    0xD0, 0x4C, 0x23, 0xAE, 0x40, 0x34, 0x51, 0x30, 0xEA, 0x85, 0x0B, 0xFB, 0x13, 0x47, 0x09, 0x67,
-    0x02, 0xA0, 0x8B, 0xA9, 0x97, 0xA7, 0x72, 0xD4, 0x0B, 0x85, 0xCB, 0x17, 0xE0, 0x1B, 0x93, 0xB4,
-    0xD8, 0x28, 0x59, 0x03, 0x15, 0x5A, 0xDA, 0x42, 0x68, 0x38, 0xA2, 0xAD, 0x74, 0xC4, 0xBC, 0xD1,
-    0x0B, 0xCB, 0x36, 0xB0, 0x3D, 0x66, 0x2D, 0xE2, 0x60, 0x7D, 0xA7, 0x6B, 0x5F, 0xA5, 0x40, 0xCE,
-    0x5F, 0xBC, 0x53, 0xA5, 0x8F, 0x54, 0xBB, 0x45, 0xB9, 0x69, 0xDF, 0x2E, 0x33, 0xEA, 0xDD, 0xEC,
-    0xBC, 0xCC, 0x2C, 0x37, 0x50, 0xBC, 0xE7, 0xCD, 0x41, 0xA1, 0xCA, 0x41, 0x15, 0x05, 0xF0, 0xFE,
-    0xDA, 0x4F, 0xB8, 0x72, 0xDD, 0x5E, 0x4E, 0xF5, 0xBF, 0x43, 0x03, 0xF7, 0x26, 0x6F, 0xA1, 0x30,
-    0x64, 0x9D, 0x49, 0xE7, 0x16, 0xAC, 0xFF, 0x85, 0xAD, 0x64, 0xB6, 0xC2, 0x42, 0xF2, 0xBF, 0xAC,
-    0xD6, 0x6D, 0x2F, 0xFF, 0x13, 0x3B, 0x25, 0x76, 0x4C, 0xED, 0x90, 0x92, 0x11, 0x96, 0x5F, 0xB4,
-    0xAD, 0x26, 0xE1, 0x34, 0x95, 0x33, 0x4D, 0xA9, 0x5B, 0xAE, 0x53, 0x27, 0xBB, 0x19, 0x73, 0x72,
-    0xAF, 0x58, 0xAD, 0x81, 0xCB, 0x65, 0x89, 0x98, 0x51, 0x91, 0x4F, 0x90, 0x2E, 0x1F, 0xEA, 0x4A,
-    0xF6, 0xEE, 0x06, 0xCC, 0xEF, 0x62, 0x5C, 0xC3, 0x5E, 0xC4, 0x35, 0x07, 0x9D, 0xC8, 0xC6, 0x51,
-    0x4B, 0x8E, 0xCF, 0xB9, 0x0B, 0x47, 0x3B, 0x35, 0xC2, 0x85, 0x59, 0x6A, 0x4C, 0xFB, 0xAB, 0x91,
-    0x1B, 0xC5, 0xFD, 0x4A, 0x3A, 0x98, 0x50, 0x21, 0x73, 0xAA, 0x43, 0x60, 0x53, 0xA3, 0x9E, 0x7B,
-    0x4C, 0x0B, 0x03, 0x9A, 0x8B, 0xE2, 0x11, 0x46, 0x2E, 0x44, 0x9D, 0x62, 0xA0, 0x58, 0xEE, 0x2D,
-    0xC6, 0x23, 0xE9, 0xE7, 0x09, 0xDE, 0xB2, 0x48, 0xE3, 0xEC, 0xB1, 0xD2, 0x55, 0x7E, 0x75, 0x84,
-    0x28, 0x5B, 0xF7, 0xEC, 0x74, 0xC7, 0x0F, 0x6E, 0x6B, 0xB5, 0xA1, 0xCA, 0xF1, 0x9D, 0x12, 0x6B,
-    0xF4, 0x14, 0x32, 0x61, 0x71, 0x68, 0x07, 0x08, 0x26, 0xB8, 0x4D, 0xB6, 0x01, 0x73, 0x92, 0xE9,
-    0xF9, 0x90, 0x2E, 0x79, 0x09, 0x42, 0x22, 0xCA, 0x8B, 0x5A, 0x31, 0xAF, 0x63, 0x6A, 0xD5, 0x21,
-    0xEC, 0xA9, 0x25, 0x5E, 0x9B, 0x62, 0xAA, 0x24, 0xFB, 0x28, 0x87, 0xB0, 0x35, 0x87, 0x20, 0x55,
-    0xE5, 0xFD, 0x03, 0x47, 0x4C, 0x27, 0xEA, 0x3E, 0x00, 0x21, 0x6C, 0x84, 0x6C, 0x2C, 0xE4, 0x12,
-    0x32, 0x2F, 0x43, 0x04, 0xA2, 0x82, 0x44, 0x0A, 0xE6, 0x49, 0xC9, 0x37, 0x85, 0x63, 0xF7, 0xEB,
-    0x2B, 0x58, 0xA4, 0x79, 0x10, 0x4B, 0x33, 0x3F, 0xC2, 0xE3, 0xDF, 0x0F, 0x24, 0x77, 0x4B, 0xDA,
-    0x17, 0xB7, 0x2E, 0x53, 0x16, 0x36, 0xFA, 0x76, 0x4C, 0xEC, 0x20, 0x6A, 0x3F, 0xB6, 0x8D, 0x67,
-    0x3B, 0xD8, 0xA9, 0x12, 0x96, 0xDE, 0x58, 0xDC, 0x54, 0x24, 0x5A, 0xF6, 0x22, 0xE8, 0xB1, 0x1C,
-    0x6C, 0x68, 0xDA, 0x24, 0x72, 0xC7, 0xA4, 0xCD, 0xA1, 0x2C, 0x5B, 0xEC, 0x63, 0xF4, 0x21, 0x6E,
-    0x12, 0xDD, 0xA0, 0xD4, 0x59, 0xB5, 0x5C, 0xD5, 0x0A, 0x98, 0xE3, 0x0E, 0xE0, 0x92, 0x6F, 0x84,
-    0xE0, 0x81, 0x67, 0xC9, 0x60, 0xA5, 0xAA, 0xB6, 0x71, 0x89, 0x0D, 0x8C, 0xB7, 0x94, 0xFC, 0x50,
-    0x21, 0xDE, 0x09, 0x67, 0x4B, 0x4A, 0x7B, 0x52, 0x29, 0xAC, 0x0A, 0x11, 0x63, 0xCB, 0x10, 0xB9,
-    0xD2, 0x1B, 0x1A, 0x53, 0x28, 0x14, 0xAA, 0xCD, 0xD0, 0x6B, 0x32, 0xBD, 0xA6, 0xBA, 0xE9, 0x9A,
-    0x68, 0xF7, 0x9A, 0x05, 0xB4, 0x47, 0x41, 0x9A, 0xAE, 0x5E, 0xD3, 0xDF, 0xE6, 0x1A, 0x80, 0x29,
-    0x35, 0x42, 0x56, 0xED, 0x90, 0x53, 0xA4, 0xA9, 0x8A, 0x49, 0xA4, 0xAC, 0xE4, 0x2B, 0x13, 0x7A,
-    0x8E, 0xC1, 0x72, 0x47, 0x5C, 0xE5, 0xAF, 0xA0, 0xBA, 0x89, 0xE8, 0x07, 0x95, 0x1B, 0xAB, 0x5D,
-    0x64, 0xB1, 0xA0, 0xF5, 0x36, 0xF9, 0xA8, 0x24, 0x20, 0x6C, 0x9D, 0xD4, 0xFE, 0xBF, 0xC4, 0xCD,
-    0x23, 0xA5, 0xCD, 0x14, 0x75, 0x7C, 0x23, 0xE6, 0x1E, 0x74, 0xD4, 0xE0, 0x2A, 0x29, 0x49, 0x0D,
-    0x6C, 0xE5, 0x8F, 0x9B, 0xA5, 0xC2, 0xDB, 0xC9, 0x2C, 0xE1, 0xF1, 0xE9, 0x33, 0xF2, 0x56, 0xD9,
-    0x50, 0xD1, 0x6C, 0x32, 0x59, 0x59, 0xD5, 0x02, 0x7F, 0xEC, 0xBD, 0xF2, 0xB2, 0x2C, 0xAA, 0x13,
-    0xD8, 0x20, 0x2B, 0xBC, 0x48, 0xBC, 0x38, 0x50, 0x27, 0x52, 0x15, 0x4F, 0x7C, 0xBB, 0x68, 0x9E,
-    0x7E, 0x6D, 0x14, 0x8A, 0x02, 0x3B, 0x25, 0xAD, 0x82, 0xEB, 0x78, 0x06, 0x73, 0x9C, 0x6B, 0x7E,
-    0xD9, 0xCC, 0x38, 0x88, 0xA0, 0x27, 0x9A, 0x44, 0xB7, 0xCB, 0x16, 0xA4, 0xBD, 0xAA, 0x52, 0xE0,
-    0x2E, 0x72, 0xB6, 0xFC, 0x38, 0x51, 0x85, 0xD5, 0x10, 0x64, 0xB9, 0x5D, 0x03, 0xCA, 0x52, 0x83,
-    0x82, 0x93, 0xED, 0xCE, 0xAE, 0xAA, 0xD9, 0x54, 0x6D, 0x0D, 0x6C, 0x61, 0x21, 0xEA, 0x93, 0x28,
-    0x9A, 0x4D, 0x7B, 0xC4, 0x42, 0xCF, 0x84, 0x10, 0x40, 0x23, 0xD8, 0x2E, 0x6D, 0x65, 0xC5, 0x32,
-    0xA4, 0xAC, 0x8C, 0x8C, 0x19, 0x4C, 0xFF, 0x7A, 0x74, 0x6F, 0x8B, 0x08, 0x99, 0xED, 0x15, 0x80,
-    0x80, 0xCE, 0x87, 0xBC, 0x98, 0x78, 0x9E, 0x83, 0x4E, 0xA7, 0x11, 0xF6, 0x96, 0xF9, 0xCB, 0x0C,
-    0xCB, 0x2A, 0x9C, 0x68, 0x1C, 0x0B, 0x18, 0xA4, 0x1A, 0xFB, 0x7B, 0x72, 0x15, 0xB9, 0xB7, 0xB4,
-    0x1B, 0xD5, 0x8C, 0xDC, 0xAF, 0x3E, 0x01, 0xE4, 0x5E, 0x08, 0xD2, 0x86, 0x81, 0xC8, 0x30, 0xE8,
-    0x40, 0x29, 0xA9, 0xC1, 0x36, 0xFB, 0x96, 0xC8, 0xBD, 0xBE, 0x33, 0x72, 0x5C, 0x22, 0xF7, 0xDB,
-    0x40, 0xCE, 0x80, 0x36, 0xB6, 0xC4, 0xF4, 0x7D, 0x22, 0x7E, 0x67, 0x45, 0x74, 0x65, 0x50, 0x26,
-    0x98, 0xEA, 0x65, 0xC8, 0x13, 0x47, 0xF7, 0x7B, 0x3E, 0x05, 0x1D, 0x35, 0x5C, 0xD8, 0x72, 0x4F,
-    0xA2, 0x86, 0xB0, 0x26, 0xAA, 0xC9, 0x1F, 0x49, 0xC5, 0x1B, 0xA6, 0x05, 0xB5, 0x6C, 0x9E, 0x71,
-    0x82, 0xB4, 0x73, 0x30, 0xDA, 0x44, 0x39, 0xAA, 0x79, 0xC4, 0x64, 0x63, 0x5F, 0xA3, 0x96, 0x50,
-    0x24, 0xA9, 0xC9, 0x57, 0x39, 0x6C, 0x21, 0x18, 0x00, 0xFA, 0x20, 0x51, 0x51, 0xA0, 0x29, 0xB3,
-    0x6A, 0x4F, 0x27, 0xEA, 0x50, 0x58, 0x7D, 0xB3, 0xFB, 0xD4, 0x19, 0xEA, 0x75, 0x92, 0xC6, 0x04,
-    0x8D, 0x3E, 0xD5, 0xE6, 0x14, 0x48, 0x50, 0xDC, 0x1F, 0x0E, 0x91, 0xF1, 0x36, 0x48, 0xDC, 0xE3,
-    0xE4, 0x68, 0x60, 0x59, 0x59, 0x68, 0x2B, 0xF8, 0x57, 0x14, 0xA0, 0x49, 0x05, 0x0E, 0xEC, 0x78,
-    0x10, 0x07, 0xE1, 0x0E, 0xB1, 0xFC, 0xA5, 0xF1, 0xFC, 0xCE, 0x17, 0x84, 0x03, 0x15, 0x75, 0x1E,
-    0x12, 0xC7, 0x8D, 0xAD, 0xF2, 0x8A, 0xE0, 0xD3, 0xEF, 0x92, 0x46, 0x0D, 0xCD, 0xF9, 0xB0, 0x53,
-    0xBB, 0x1A, 0x5F, 0x18, 0x23, 0x4A, 0xB7, 0xDA, 0x6F, 0xEE, 0xAC, 0xE2, 0x30, 0x59, 0xCF, 0xD6,
-    0xC7, 0xAA, 0x12, 0x6D, 0xD4, 0xA5, 0xCA, 0x27, 0x02, 0xCA, 0x14, 0xF3, 0x65, 0xD6, 0x53, 0x57,
-    0xA7, 0xC8, 0x2B, 0x6C, 0x86, 0xE0, 0xFE, 0xA4, 0x09, 0x89, 0xC7, 0x6B, 0x11, 0x7D, 0x78, 0x01,
-    0xC2, 0xA3, 0x03, 0x6C, 0x5E, 0x60, 0x9B, 0x75, 0xF0, 0xAB, 0x2C, 0xAE, 0x01, 0x6E, 0x17, 0x1B,
-    0x5E, 0x82, 0x7D, 0xC1, 0x98, 0x4E, 0x95, 0x1E, 0xA0, 0x34, 0x6D, 0xC0, 0xC6, 0x40, 0x72, 0xD5,
-    0x39, 0x92, 0x2B, 0xB3, 0xBC, 0x95, 0x3D, 0x2A, 0xEB, 0x08, 0xA0, 0xEC, 0x5B, 0xD4, 0x9D, 0x46,
-    0xEF, 0x66, 0xCC, 0x21, 0x81, 0x18, 0x86, 0xEE, 0x31, 0x1E, 0x1E, 0xA0, 0xA1, 0x4E, 0xB0, 0x9D,
-    0x29, 0x66, 0x5F, 0x36, 0x5F, 0x92, 0x7D, 0x7A, 0x4E, 0xAC, 0xDE, 0x08, 0x3E, 0x69, 0xD3, 0xEE,
-    0xB0, 0xCC, 0x19, 0xDB, 0x69, 0xD5, 0xDD, 0x58, 0xF1, 0x05, 0xFE, 0x00, 0xCD, 0xA7, 0x7C, 0xD1,
-    0x14, 0xA9, 0x09, 0x85, 0x3C, 0x71, 0xEF, 0xD4, 0x8A, 0x82, 0x82, 0x46, 0xF7, 0xF4, 0x36, 0x5E,
-    0xFE, 0x1F, 0x2A, 0x6C, 0xF0, 0x10, 0x1C, 0x00, 0x68, 0xC7, 0x5F, 0x63, 0xD1, 0x8A, 0x32, 0x13,
-    0x6A, 0x4F, 0x41, 0x59, 0x2D, 0x64, 0xA8, 0x3C, 0x92, 0x89, 0xB2, 0x08, 0x3A, 0xC5, 0x66, 0x85,
-    0xB2, 0x2B, 0x58, 0xBC, 0x8F, 0xE9, 0xD0, 0xD4, 0xA3, 0x71, 0x5E, 0x2F, 0x57, 0x4F, 0x28, 0xFE,
-    0x31, 0x25, 0xCC, 0x1E, 0xA5, 0x52, 0x1A, 0x03, 0xF2, 0x57, 0x1B, 0xE9, 0x10, 0x50, 0x3C, 0xA2,
-    0xAD, 0xA0, 0x63, 0xE2, 0xCE, 0x19, 0x6A, 0xB8, 0xB7, 0x02, 0x3E, 0x7C, 0x9D, 0x63, 0x20, 0xF7,
-    0x06, 0x02, 0x98, 0xE6, 0x09, 0x2E, 0xBD, 0x99, 0x15, 0x1D, 0xD8, 0xAC, 0xE8, 0x40, 0xAA, 0x88,
-    0xA0, 0xA3, 0xF2, 0x0B, 0xE9, 0x5C, 0xC3, 0x8D, 0xE1, 0x53, 0xCD, 0xA7, 0xB8, 0x02, 0x05, 0xC5,
-    0x6E, 0x52, 0xC9, 0xA6, 0x1A, 0xE6, 0x28, 0x55, 0x07, 0x4F, 0x7C, 0xF2, 0x46, 0xEA, 0x12, 0x59,
-    0x19, 0xC8, 0x17, 0xE8, 0xC4, 0x22, 0xFA, 0x02, 0xE2, 0xBB, 0x70, 0xDF, 0x30, 0x39, 0xB0, 0xB8,
-    0x39, 0x2C, 0x0A, 0xB8, 0x14, 0x92, 0x81, 0xF4, 0x02, 0x98, 0x44, 0xB6, 0x66, 0xB7, 0xC5, 0x03,
-    0x87, 0x94, 0xFC, 0x16, 0x60, 0x21, 0xDF, 0x21, 0xDD, 0xC5, 0x82, 0x40, 0x27, 0xA6, 0x57, 0x29,
-    0xDE, 0x10, 0xF6, 0x38, 0x86, 0xD9, 0x85, 0xDB, 0x7D, 0xA3, 0xF7, 0x3F, 0x81, 0xE5, 0xBE, 0x3E,
-    0x79, 0x03, 0x56, 0x33, 0xE4, 0xD5, 0x08, 0x60, 0x50, 0xC6, 0x6D, 0x09, 0x40, 0x9C, 0x9E, 0x18,
-    0x52, 0x10, 0x30, 0xAA, 0xED, 0xD6, 0xF3, 0x10, 0xCB, 0x36, 0xDD, 0xAE, 0x44, 0x33, 0x8B, 0xCA,
-    0xB0, 0x0D, 0x68, 0x39, 0xC2, 0x4B, 0x07, 0x3A, 0x33, 0x79, 0x0F, 0x2B, 0x40, 0x7D, 0x2F, 0xB7,
-    0x8C, 0x1A, 0x9F, 0x2E, 0x8C, 0xAC, 0xA5, 0x84, 0xDD, 0x15, 0x07, 0x3E, 0xC9, 0xE4, 0xA5, 0x75,
-    0xD8, 0xB7, 0xC3, 0xF0, 0x5A, 0x06, 0x4C, 0x63, 0xF2, 0x9D, 0x9B, 0x95, 0x39, 0xDE, 0xAD, 0x95,
-    0x4D, 0x06, 0xE5, 0xDD, 0xE9, 0x76, 0xBC, 0xAB, 0x8C, 0x67, 0x66, 0xE8, 0x04, 0x2E, 0xC3, 0x16,
-    0xD0, 0x5E, 0x38, 0xC6, 0x23, 0x58, 0xD2, 0xB8, 0x4C, 0xAF, 0x1A, 0xFF, 0xF6, 0x43, 0xA4, 0x3A,
-    0x44, 0x30, 0xEA, 0xAF, 0xBF, 0x81, 0x77, 0x87, 0x55, 0xDE, 0x45, 0xB4, 0x85, 0x9A, 0x8D, 0xE1,
-    0x13, 0x4E, 0x5F, 0x28, 0x9B, 0x4E, 0x8F, 0x0B, 0xCD, 0xE5, 0x7F, 0xDE, 0x83, 0xAB, 0x52, 0xE1,
-    0x91, 0x4C, 0xAC, 0x3F, 0xC4, 0x2D, 0x1E, 0x23, 0x18, 0x8E, 0x31, 0x06, 0x39, 0xC7, 0x04, 0xCB,
-    0x1F, 0xA1, 0xD5, 0xE2, 0x01, 0x8F, 0x09, 0x1F, 0xD3, 0x9E, 0x8F, 0x1D, 0x1E, 0xCB, 0x16, 0xFE,
-    0x82, 0xAD, 0x45, 0xFD, 0x09, 0xA0, 0x8D, 0x04, 0x39, 0xC0, 0x03, 0xF9, 0x75, 0x89, 0x5F, 0x69,
-    0x7D, 0xD4, 0xD9, 0x8B, 0x55, 0xAF, 0x1F, 0x9C, 0x11, 0x83, 0x86, 0x5C, 0x96, 0xD6, 0x4D, 0xE6,
-    0xE4, 0xDB, 0xCD, 0x27, 0xDC, 0xF2, 0x1D, 0x78, 0xA5, 0xC8, 0xB6, 0x5C, 0xA7, 0x7C, 0x07, 0x2A,
-    0xFC, 0x4A, 0xE5, 0xEC, 0xA6, 0x6B, 0x54, 0xF6, 0x49, 0x21, 0x77, 0xCD, 0xC2, 0x5D, 0x83, 0xE5,
-    0xED, 0xB9, 0xC6, 0x6D, 0x84, 0x03, 0xAF, 0x8E, 0x7A, 0x0B, 0x42, 0x28, 0x80, 0x69, 0x58, 0x87,
-    0x37, 0x14, 0x55, 0x10, 0x62, 0x25, 0x90, 0xA2, 0x80, 0x4B, 0x49, 0xF8, 0xF8, 0x6F, 0xED, 0xF3,
-    0x78, 0x65, 0x04, 0xE1, 0x12, 0xAA, 0x17, 0xF5, 0xE9, 0xAD, 0xDE, 0x03, 0xF3, 0xCF, 0x6B, 0xB2,
-    0x03, 0x82, 0x47, 0xD1, 0xB8, 0x35, 0xB9, 0x80, 0x2A, 0x85, 0x40, 0xEE, 0xF2, 0xF2, 0x5E, 0x60,
-    0xA3, 0x6E, 0x17, 0x45, 0x6F, 0x8E, 0xE3, 0xE9, 0x6E, 0x75, 0x4B, 0x55, 0x21, 0xDB, 0x68, 0xC0,
-    0x8E, 0x53, 0xA6, 0xE1, 0xAF, 0x9C, 0x06, 0x6A, 0x3A, 0x22, 0x10, 0xAF, 0x13, 0x56, 0x06, 0x77,
-    0x35, 0xA9, 0xB0, 0x4B, 0x8B, 0x51, 0x36, 0xB0, 0x7F, 0x7B, 0x22, 0x23, 0xCD, 0x6C, 0x98, 0xA2,
-    0x69, 0xE9, 0x70, 0x70, 0x81, 0xD8, 0xDD, 0x2F, 0x85, 0x50, 0x2B, 0xD0, 0x66, 0x5B, 0x74, 0xC2,
-    0x5B, 0xDD, 0xB6, 0xD4, 0x45, 0xE8, 0x0A, 0x9A, 0x7F, 0xA3, 0xA8, 0x46, 0x63, 0xA3, 0x74, 0xD5,
-    0x7F, 0xB1, 0xF3, 0xE4, 0xF8, 0x44, 0x5F, 0x42, 0xDB, 0x3D, 0xD6, 0xC4, 0xBD, 0xDF, 0x9E, 0x13,
-    0x62, 0x3E, 0xBB, 0x28, 0xD2, 0x76, 0xBD, 0x98, 0x63, 0x72, 0xCD, 0x12, 0x98, 0x70, 0x5D, 0x8A,
-    0x3D, 0x34, 0x9E, 0xD7, 0x2F, 0x11, 0x09, 0x95, 0x8D, 0x7B, 0x43, 0x3B, 0xBF, 0x01, 0x51, 0x24,
-    0x0D, 0x23, 0xB9, 0x38, 0xD2, 0x7D, 0xE7, 0x80, 0x99, 0xFD, 0xA7, 0x4F, 0x73, 0x5E, 0xD4, 0xDE,
-    0xCA, 0xDC, 0xBC, 0x96, 0xBE, 0xB8, 0x57, 0x62, 0xAF, 0xC8, 0x2F, 0x9E, 0xBD, 0x61, 0x4B, 0x99,
-    0xB6, 0x2F, 0x72, 0x15, 0x0D, 0x81, 0x48, 0x5A, 0xD2, 0xE1, 0x31, 0x15, 0x15, 0x2C, 0x8F, 0x4D,
-    0xD4, 0xF3, 0x51, 0xB0, 0x69, 0xDA, 0xC6, 0xF2, 0x5A, 0xDA, 0x26, 0x6D, 0xD2, 0x8B, 0xCC, 0x35,
-    0x65, 0x43, 0x41, 0x81, 0x54, 0x63, 0xFC, 0xC3, 0xF6, 0xBA, 0x8B, 0xE4, 0x2C, 0xA9, 0x68, 0xD5,
-    0x6F, 0xC5, 0xE3, 0x43, 0xA7, 0x5F, 0xE6, 0x2E, 0x0D, 0x91, 0x5C, 0x2B, 0x7B, 0x97, 0x43, 0x45,
-    0x89, 0xBA, 0xDE, 0xE1, 0xFE, 0x63, 0x4E, 0xC2, 0xA5, 0x1D, 0x41, 0x13, 0xB1, 0xA8, 0x0D, 0x35,
-    0x4A, 0x06, 0xFA, 0x98, 0x48, 0xE7, 0x9F, 0x28, 0xB3, 0x39, 0xFF, 0x5F, 0x11, 0x59, 0xE8, 0xB2,
-    0x0C, 0xDC, 0xAB, 0xE0, 0x86, 0x06, 0xBD, 0x5F, 0x20, 0x72, 0x1D, 0x14, 0x32, 0x57, 0x88, 0xBD,
-    0x8A, 0xCA, 0x04, 0x24, 0x12, 0xA4, 0x26, 0x6F, 0x0B, 0xED, 0xC9, 0x40, 0xB4, 0xBF, 0xF0, 0xBC,
-    0xAC, 0x3F, 0x60, 0x6C, 0xAA, 0xF8, 0x02, 0x5C, 0xD6, 0xFA, 0x33, 0xB8, 0xAC, 0x53, 0xA6, 0x5A,
-    0xA8, 0x51, 0x97, 0x55, 0xFD, 0x53, 0xDF, 0xF9, 0xA7, 0x76, 0x4F, 0x78, 0x24, 0x56, 0x49, 0x0C,
-    0xC8, 0x05, 0x66, 0xE1, 0x82, 0x23, 0x3F, 0x84, 0xA1, 0xED, 0x72, 0xD9, 0x64, 0x48, 0xC7, 0x2F,
-    0xA1, 0x78, 0x47, 0x06, 0xD3, 0xB2, 0x70, 0x70, 0x3E, 0x5D, 0xAA, 0xC1, 0xB2, 0xC2, 0x27, 0xFA,
-    0x10, 0xD6, 0x97, 0x29, 0xE5, 0xFA, 0x5A, 0xC3, 0xE5, 0xE3, 0xBE, 0x01, 0x75, 0x60, 0xA0, 0xB0,
-    0xFB, 0xE9, 0xEF, 0xED, 0x7A, 0x3F, 0x2A, 0xC3, 0xB7, 0x44, 0xE0, 0xB7, 0x60, 0xDB, 0x03, 0xC2,
-    0xE6, 0x84, 0x88, 0x2B, 0x82, 0x60, 0xBE, 0xA5, 0x04, 0x4E, 0xEC, 0x55, 0x92, 0x78, 0x12, 0xEB,
-    0x99, 0x80, 0xC8, 0xA3, 0xC6, 0xE8, 0x40, 0x42, 0x06, 0xE9, 0x28, 0x2B, 0xA3, 0xB3, 0x2B, 0x70,
-    0xFC, 0x94, 0x48, 0x0C, 0xE8, 0x31, 0x4B, 0xE1, 0xAE, 0x36, 0xBF, 0xE1, 0xEA, 0x41, 0xAF, 0x6E,
-    0x5C, 0xE4, 0x49, 0xD6, 0xA6, 0xC4, 0xFF, 0x6C, 0x57, 0x23, 0xFA, 0xA9, 0xDB, 0x00, 0x67, 0x45,
-    0x37, 0x62, 0x19, 0x3D, 0x20, 0x78, 0xF9, 0xD4, 0x45, 0x4D, 0xBF, 0xE5, 0xA2, 0xB2, 0xCF, 0xB9,
-    0xA8, 0xCE, 0xD9, 0x91, 0xCF, 0xBF, 0xA8, 0x99, 0xBB, 0x66, 0x8F, 0x6A, 0xC9, 0x61, 0xBB, 0x3C,
-    0xB6, 0xE4, 0xB2, 0x25, 0x9F, 0x2D, 0x39, 0x6D, 0xC9, 0x6B, 0xBB, 0xDC, 0x26, 0xCA, 0x49, 0x55,
-    0x31, 0x6D, 0x28, 0x29, 0x55, 0x78, 0xE3, 0x31, 0xC0, 0x0A, 0x48, 0x47, 0x52, 0x88, 0x6C, 0x84,
-    0xB0, 0x07, 0xE6, 0xD4, 0x1C, 0xDE, 0xC5, 0xAC, 0x36, 0x28, 0xC1, 0x3B, 0x46, 0xB5, 0x7A, 0x34,
-    0x95, 0x13, 0x83, 0xB9, 0x88, 0x31, 0x24, 0x58, 0x5D, 0x30, 0x11, 0xA3, 0xC1, 0xF9, 0x65, 0x72,
-    0x8A, 0x4B, 0xCC, 0x3B, 0x7A, 0x63, 0x58, 0x41, 0xB7, 0xEA, 0xF0, 0x33, 0xE2, 0xAC, 0xBE, 0xE9,
-    0x80, 0x85, 0x6A, 0x26, 0x83, 0x2A, 0x30, 0x6D, 0xCC, 0x52, 0x52, 0x15, 0x9E, 0x0C, 0x66, 0x09,
-    0x80, 0x54, 0xDF, 0x53, 0x13, 0x0C, 0x6E, 0x66, 0x78, 0x35, 0xBE, 0xE6, 0x58, 0xBA, 0x84, 0x14,
-    0x10, 0x9D, 0x8B, 0x4E, 0xA5, 0xD4, 0xEE, 0x94, 0x23, 0xFF, 0x22, 0x50, 0x7F, 0x70, 0xE4, 0x4D,
-    0x5B, 0x67, 0xC5, 0xCB, 0x3A, 0x77, 0x7B, 0xE1, 0x86, 0x8D, 0x06, 0x37, 0x6C, 0xDE, 0x10, 0x3D,
-    0x89, 0xE2, 0x99, 0xA5, 0xBC, 0x05, 0xBB, 0x00, 0x15, 0xFB, 0x33, 0xCD, 0x54, 0x6D, 0xAF, 0x26,
-    0x43, 0x34, 0x47, 0xA1, 0x06, 0x6F, 0x0E, 0x9D, 0xCF, 0xDA, 0x76, 0x37, 0xAB, 0xE0, 0x62, 0xE5,
-    0x27, 0xE7, 0xF0, 0x43, 0xAA, 0x39, 0xBF, 0x92, 0xA9, 0x3D, 0x38, 0x34, 0x98, 0x1A, 0xE3, 0x27,
-    0x14, 0x7A, 0x79, 0x4F, 0xDA, 0x30, 0x82, 0x02, 0x4A, 0xF7, 0xB7, 0xA7, 0xA7, 0x39, 0xB4, 0x01,
-    0x83, 0x47, 0x04, 0x64, 0x2D, 0xB3, 0x62, 0xAD, 0x78, 0x9F, 0x89, 0xEC, 0x89, 0xA8, 0x91, 0x4A,
-    0x3C, 0xE4, 0xB4, 0x5B, 0xD4, 0x6A, 0xBB, 0x35, 0xE7, 0x0B, 0x4D, 0x8B, 0x58, 0x0D, 0xC6, 0x73,
-    0x59, 0x31, 0x8A, 0xCB, 0x1A, 0xD3, 0x60, 0x6A, 0x67, 0xC5, 0x2F, 0x80, 0x72, 0x3D, 0x02, 0x60,
-    0x52, 0x41, 0x1F, 0x55, 0xE9, 0xCE, 0x61, 0x71, 0x8F, 0xE7, 0x9C, 0x5B, 0xE1, 0xA2, 0x28, 0xCE,
-    0xC3, 0x9F, 0xA1, 0x62, 0xC4, 0x98, 0x16, 0x80, 0x1E, 0xD4, 0x18, 0x94, 0x51, 0xCC, 0xD0, 0x3D,
-    0x23, 0x57, 0x45, 0x62, 0x01, 0x1B, 0x11, 0x91, 0xEF, 0x80, 0x3C, 0x80, 0x70, 0x6A, 0x20, 0x0B,
-    0xDF, 0xC2, 0x1A, 0x27, 0xB8, 0x17, 0x53, 0x2E, 0x08, 0x39, 0x05, 0xFA, 0x43, 0x30, 0xC2, 0x43,
-    0x81, 0x22, 0x67, 0x40, 0x22, 0x66, 0xF4, 0x6C, 0x58, 0xF9, 0x41, 0x9C, 0xF4, 0xA8, 0x03, 0xD8,
-    0x94, 0x2D, 0x8F, 0x99, 0x66, 0x81, 0xD2, 0x66, 0x9E, 0x25, 0x87, 0xEE, 0x04, 0x9A, 0xC1, 0x5D,
-    0x9A, 0x08, 0xB8, 0x0E, 0xD8, 0x2A, 0x80, 0x3A, 0xC0, 0xD6, 0xF8, 0x84, 0x99, 0xEB, 0xB6, 0xF7,
-    0xE8, 0x5C, 0x27, 0xB0, 0x77, 0x9A, 0x22, 0xC4, 0xED, 0xE6, 0x50, 0xD9, 0x21, 0x75, 0x3A, 0x4A,
-    0x2C, 0x5C, 0x4D, 0xA9, 0x66, 0x53, 0x4C, 0xBA, 0x83, 0xC9, 0x86, 0x13, 0xD9, 0x96, 0xE2, 0x0D,
-    0x05, 0x56, 0x56, 0x0C, 0x5D, 0xE9, 0x14, 0xA9, 0xCD, 0x1A, 0xD8, 0xCD, 0xC0, 0xBE, 0x0F, 0x86,
-    0x88, 0x15, 0x19, 0x6A, 0x68, 0x3E, 0x60, 0x7E, 0xD6, 0x58, 0x72, 0x45, 0x52, 0xE7, 0x15, 0x13,
-    0x47, 0x1A, 0x6E, 0x24, 0xDF, 0x22, 0x4B, 0x14, 0x20, 0x5A, 0x42, 0x8F, 0xA8, 0x84, 0x3A, 0xA8,
-    0x72, 0x0B, 0xA6, 0xA0, 0x2B, 0x31, 0x93, 0xFE, 0x69, 0xD9, 0x84, 0xC0, 0x5E, 0x24, 0xC0, 0x94,
-    0xAD, 0xBF, 0x01, 0x4C, 0x2C, 0x92, 0x8C, 0xB0, 0x1D, 0xF4, 0x0B, 0xE5, 0x52, 0x34, 0x8B, 0x40,
-    0x09, 0x05, 0x9C, 0xC2, 0x53, 0x98, 0x74, 0x04, 0xB5, 0x93, 0xE0, 0xE1, 0xFC, 0xF0, 0xCD, 0xF4,
-    0xE3, 0x1D, 0x3B, 0x24, 0xF6, 0x92, 0xED, 0x63, 0xFB, 0x9C, 0x6D, 0x64, 0x55, 0xBC, 0xC1, 0x81,
-    0xE5, 0xEE, 0x0A, 0x0B, 0x09, 0xA9, 0x0A, 0xCD, 0x24, 0x97, 0xCC, 0xFC, 0x21, 0x66, 0xF9, 0x6B,
-    0x17, 0x35, 0xB2, 0xF4, 0x0A, 0xB1, 0xB4, 0x23, 0xC7, 0xC5, 0x0B, 0xCA, 0x65, 0x7B, 0xAE, 0x68,
-    0x34, 0x48, 0x98, 0xB5, 0xCE, 0xB1, 0x0D, 0x32, 0xF7, 0x06, 0xE2, 0x26, 0x52, 0x2D, 0xE4, 0x49,
-    0x5A, 0xC6, 0x07, 0xC5, 0x17, 0x1E, 0x64, 0xA2, 0xD8, 0x30, 0x59, 0x66, 0xD2, 0xCB, 0x76, 0xA6,
-    0x9A, 0x6E, 0x05, 0x14, 0x9B, 0x96, 0x29, 0x87, 0x07, 0x36, 0xE8, 0xF3, 0x01, 0xD3, 0x2D, 0xA6,
-    0x63, 0x03, 0x32, 0x61, 0x70, 0x2A, 0xAB, 0x52, 0x08, 0x97, 0x3E, 0x57, 0x8A, 0x33, 0x6F, 0x2F,
-    0x83, 0xCF, 0x8E, 0x4E, 0x59, 0xDE, 0xC8, 0x2D, 0xFA, 0xB4, 0x5A, 0x20, 0x8E, 0x2B, 0x0C, 0x25,
-    0xC4, 0x90, 0x6D, 0x15, 0xD7, 0x02, 0x88, 0x0F, 0x23, 0x82, 0x6E, 0x6B, 0x2F, 0x63, 0x2C, 0xA0,
-    0xC3, 0x85, 0x3D, 0x3B, 0x88, 0x07, 0xDB, 0x7E, 0x15, 0x61, 0x38, 0x70, 0x5D, 0x89, 0xB5, 0x21,
-    0xF2, 0x83, 0x68, 0x0F, 0xB8, 0x4F, 0x26, 0xFA, 0x9C, 0xD0, 0xEF, 0xD8, 0xB8, 0x18, 0x65, 0x90,
-    0x26, 0x81, 0x7E, 0x91, 0xB1, 0xE8, 0x33, 0x7B, 0xE7, 0x19, 0x2D, 0xC8, 0x28, 0xCF, 0xD1, 0xDB,
-    0xF2, 0xDE, 0x7A, 0x31, 0xEB, 0x28, 0x4A, 0x3F, 0xFD, 0x72, 0xC1, 0x12, 0xC9, 0x0D, 0x66, 0x92,
-    0x6B, 0xF0, 0xB1, 0xA8, 0x1C, 0x64, 0x60, 0x04, 0x01, 0xF5, 0x72, 0x53, 0xCC, 0x16, 0x51, 0xDC,
-    0x13, 0x93, 0xF8, 0xC2, 0xD0, 0xA3, 0xB0, 0x4C, 0x8D, 0x58, 0x04, 0x28, 0x2D, 0xA1, 0x49, 0x47,
-    0xFF, 0x17, 0x2C, 0xC9, 0x78, 0x73, 0xB6, 0x24, 0x09, 0x84, 0x0B, 0x11, 0x85, 0x22, 0x79, 0xDF,
-    0x7A, 0xA3, 0x3F, 0x44, 0x4D, 0xDC, 0x08, 0xA2, 0xF6, 0xFB, 0xB0, 0x8B, 0xDF, 0xB0, 0x59, 0x59,
-    0x0A, 0xE9, 0x65, 0x4C, 0x54, 0x26, 0xD4, 0xE6, 0xA4, 0xCD, 0xE2, 0x0B, 0xF6, 0x09, 0x91, 0x2B,
-    0xF1, 0x64, 0xE9, 0xAD, 0xB8, 0x15, 0xAC, 0x9F, 0x14, 0x80, 0xFE, 0x80, 0xAC, 0xB7, 0x4A, 0x8B,
-    0x44, 0x36, 0x61, 0xF4, 0x45, 0x60, 0xEB, 0xDC, 0xB6, 0xF9, 0xC2, 0x0E, 0xE1, 0xFB, 0x36, 0x6C,
-    0xF3, 0x47, 0x8B, 0xBF, 0x8A, 0xDA, 0x29, 0x22, 0xA0, 0x4D, 0xDF, 0x22, 0xF0, 0xB3, 0x43, 0xA9,
-    0xB8, 0xEE, 0x9D, 0x56, 0x35, 0x20, 0x15, 0xA2, 0x4D, 0x89, 0xFA, 0xE2, 0x5F, 0x4C, 0xF4, 0x21,
-    0xBA, 0xF2, 0xA5, 0x7A, 0x9F, 0x67, 0xCE, 0x47, 0x57, 0xED, 0xA2, 0xF9, 0xAE, 0xF8, 0xDC, 0xD1,
-    0x24, 0x18, 0xAE, 0x8D, 0x2B, 0x24, 0x25, 0xC7, 0x85, 0xA0, 0xDA, 0x16, 0x9C, 0x28, 0xDB, 0x2E,
-    0x4B, 0xF2, 0x34, 0x94, 0xE6, 0xFD, 0x1C, 0xCA, 0x43, 0x58, 0x43, 0x1C, 0xE3, 0xE9, 0xC9, 0xC1,
-    0x6F, 0xFD, 0xC1, 0x2B, 0x60, 0xED, 0x80, 0xCD, 0x93, 0x86, 0xCB, 0x81, 0x73, 0xBF, 0x1F, 0xE9,
-    0xA5, 0x88, 0x66, 0x34, 0x96, 0x67, 0x99, 0x7B, 0x9B, 0x0A, 0xE7, 0x0B, 0x89, 0x33, 0xFA, 0xFC,
-    0xF0, 0x14, 0xFF, 0xC2, 0x78, 0xC7, 0x85, 0x60, 0xF2, 0x57, 0xA1, 0x51, 0xFB, 0x10, 0x1E, 0x84,
-    0xA0, 0xE0, 0x3B, 0xA1, 0x88, 0x87, 0x00, 0xF7, 0x02, 0x32, 0x82, 0xA0, 0xA3, 0xB0, 0xA1, 0x07,
-    0xCC, 0x85, 0xD0, 0x35, 0x52, 0xEF, 0x51, 0x1B, 0x43, 0x64, 0x9E, 0xB5, 0xFF, 0x34, 0xFE, 0x78,
-    0xB0, 0x53, 0x6C, 0x5B, 0x38, 0x0E, 0x95, 0x28, 0xB3, 0xC9, 0x08, 0xE6, 0xDD, 0xD8, 0x4D, 0xA2,
-    0x22, 0x0D, 0xB6, 0x68, 0x3D, 0x01, 0x5F, 0x2D, 0xE2, 0xD3, 0x08, 0xD8, 0xD0, 0xDB, 0xF7, 0x68,
-    0xAB, 0x0F, 0xCD, 0x46, 0xF9, 0x1E, 0xCF, 0xE5, 0x87, 0x66, 0xFF, 0x42, 0xC4, 0x76, 0x40, 0xA8,
-    0xE1, 0xEF, 0xCA, 0xC6, 0x0E, 0x8B, 0x31, 0xBD, 0x94, 0xA5, 0xAF, 0xB7, 0xC6, 0xEF, 0xA1, 0x0A,
-    0x73, 0x44, 0x41, 0xE8, 0x4D, 0x83, 0x7C, 0x88, 0x03, 0x27, 0xB5, 0x89, 0xAF, 0x8A, 0x4E, 0x14,
-    0x29, 0xF9, 0x8E, 0x38, 0x0B, 0xDB, 0x17, 0xC4, 0x43, 0xEA, 0xF2, 0x2A, 0x99, 0x10, 0x8C, 0xCD,
-    0x66, 0x47, 0xE5, 0x81, 0xBF, 0x31, 0x1A, 0x68, 0x31, 0xD4, 0x5C, 0xE5, 0xB6, 0x90, 0x36, 0x3D,
-    0x0A, 0x75, 0x2B, 0x22, 0x61, 0xA2, 0x4A, 0x5C, 0xA8, 0xA0, 0x15, 0xF6, 0xF2, 0x3B, 0x78, 0x4D,
-    0x03, 0x36, 0xA9, 0xF4, 0x61, 0xD9, 0x32, 0xE8, 0xEF, 0x2A, 0xAF, 0xF6, 0x45, 0x4D, 0xD2, 0x5E,
-    0xD8, 0x6E, 0xC3, 0xA9, 0x43, 0x32, 0x73, 0x10, 0xEF, 0xC0, 0x22, 0x17, 0x29, 0xAA, 0xF2, 0x00,
-    0x45, 0xD1, 0x7B, 0x5A, 0x34, 0x58, 0x66, 0x94, 0x53, 0x43, 0x91, 0x22, 0x99, 0xDD, 0x21, 0xDB,
-    0x43, 0xFE, 0x7C, 0xDB, 0xA6, 0xE2, 0x6D, 0xC4, 0x67, 0x5F, 0xFB, 0x58, 0xEE, 0xF8, 0xA3, 0x3C,
-    0x12, 0x1D, 0xB7, 0xB8, 0x36, 0xFE, 0x28, 0x2D, 0x4C, 0x74, 0xE1, 0x93, 0xAB, 0xB8, 0x4D, 0x64,
-    0x8F, 0x75, 0xC6, 0xEB, 0xD3, 0x41, 0xDC, 0xB5, 0xB0, 0x16, 0x8F, 0x41, 0x5E, 0x63, 0xEC, 0xCC,
-    0x13, 0xE1, 0x8A, 0x2E, 0x5D, 0xD8, 0xAE, 0xC5, 0xC1, 0xD8, 0x8E, 0x44, 0x90, 0x64, 0x3F, 0xD2,
-    0xCE, 0xEF, 0x68, 0xCE, 0xD6, 0x64, 0x1F, 0xA8, 0x06, 0xB0, 0x8B, 0x4F, 0x99, 0xB5, 0x0C, 0x91,
-    0xA6, 0x17, 0x05, 0x65, 0x4D, 0x0F, 0xC1, 0xCD, 0x91, 0x9D, 0xC8, 0xF1, 0x84, 0xAD, 0x41, 0x76,
-    0x74, 0x33, 0x87, 0xD8, 0xB2, 0x32, 0x49, 0xAE, 0x3B, 0x5D, 0x36, 0x22, 0xD4, 0x22, 0x4E, 0x2D,
-    0x02, 0x59, 0x55, 0xDC, 0xFE, 0x67, 0xD9, 0xB8, 0xED, 0x17, 0xE5, 0xF2, 0x31, 0xAF, 0x42, 0xFB,
-    0xEE, 0xA4, 0xB6, 0x7E, 0xCD, 0xC9, 0xA8, 0x20, 0x4E, 0xAA, 0x2D, 0xDF, 0x6E, 0x8B, 0xE0, 0x7B,
-    0xA2, 0x5D, 0xC5, 0x2A, 0x21, 0x6D, 0x9F, 0x8A, 0xA6, 0x40, 0x6E, 0xE4, 0xA2, 0xA0, 0xFC, 0xF7,
-    0xE4, 0x4D, 0x1D, 0x36, 0x5E, 0xC4, 0x7E, 0x8A, 0x06, 0xA8, 0xC9, 0x47, 0xC5, 0x4C, 0x2A, 0x72,
-    0xCD, 0x54, 0x11, 0x6E, 0x70, 0xAE, 0x4F, 0x8B, 0x56, 0x8A, 0x45, 0x0F, 0xBD, 0x6B, 0x87, 0x87,
-    0xEC, 0x59, 0x68, 0xC3, 0xBE, 0x14, 0xDD, 0x86, 0x51, 0x87, 0x50, 0xE6, 0x2A, 0x7A, 0x05, 0xCA,
-    0x5B, 0x33, 0x37, 0xC2, 0x65, 0xC0, 0x0F, 0x98, 0x6B, 0xA0, 0x73, 0xBD, 0x80, 0xB9, 0x7E, 0x4F,
-    0xA8, 0x30, 0x60, 0xAE, 0x6F, 0x4E, 0xEA, 0x4A, 0x63, 0xAE, 0xDE, 0x53, 0xDE, 0xCB, 0xA2, 0x50,
-    0x8E, 0x42, 0x53, 0xBE, 0x25, 0xFE, 0xF1, 0xD9, 0x4F, 0x2C, 0xFC, 0x9D, 0x8E, 0x31, 0x7B, 0x99,
-    0x67, 0x8E, 0xAC, 0x50, 0x8C, 0x54, 0x08, 0x6D, 0x0A, 0x94, 0x54, 0x4D, 0xB3, 0x02, 0x5A, 0xF5,
-    0x86, 0x37, 0x82, 0x1B, 0x2A, 0xB6, 0xDB, 0x57, 0x18, 0xC2, 0x50, 0xA2, 0xF3, 0xC0, 0xA3, 0xEE,
-    0xA0, 0x03, 0xAD, 0x5A, 0xA9, 0xA4, 0xC0, 0xA8, 0x33, 0x6A, 0x4B, 0xD4, 0x09, 0x5D, 0xDB, 0xDC,
-    0x9C, 0x15, 0x5B, 0xA4, 0xB0, 0x50, 0x54, 0xAD, 0x67, 0x1F, 0x45, 0x50, 0x33, 0x43, 0x34, 0x0E,
-    0x16, 0xB6, 0xE5, 0x7B, 0x01, 0xB1, 0x40, 0x65, 0xB1, 0xF5, 0x85, 0xAD, 0xE2, 0xA3, 0xF6, 0xCA,
-    0x78, 0xB3, 0x62, 0xF3, 0x9E, 0x12, 0x6A, 0x7D, 0xCD, 0x94, 0x1D, 0xE2, 0x52, 0xA0, 0x57, 0x6B,
-    0xC7, 0x87, 0xEC, 0x96, 0x7D, 0x07, 0x8A, 0xA5, 0xB7, 0xE7, 0xC4, 0x00, 0xCA, 0x62, 0x6B, 0x24,
-    0xD1, 0xA2, 0x11, 0x12, 0x57, 0xE5, 0x70, 0xA0, 0xA9, 0x9C, 0x0B, 0xC1, 0x0D, 0x03, 0x45, 0x31,
-    0xAD, 0x41, 0x3A, 0xCF, 0x92, 0x78, 0x21, 0x5E, 0x2B, 0x0B, 0xB8, 0xDB, 0xFF, 0x0D, 0x54, 0x4D,
-    0xB7, 0x2F, 0x76, 0xF8, 0xE3, 0x94, 0xCB, 0x1F, 0x03, 0xFB, 0x21, 0xF2, 0x34, 0x8C, 0x9E, 0x38,
-    0xE9, 0xF9, 0x73, 0xD1, 0xAB, 0x62, 0x4E, 0x22, 0x84, 0x25, 0x8B, 0xBC, 0xF1, 0x4A, 0xC2, 0x50,
-    0x91, 0x31, 0x61, 0xED, 0x11, 0x09, 0xC2, 0xB4, 0x16, 0x1A, 0x2E, 0x26, 0xD0, 0x25, 0x6E, 0xE0,
-    0x4A, 0x5B, 0xD8, 0x50, 0xD1, 0xB5, 0xD0, 0xA5, 0x80, 0xF1, 0xD1, 0x47, 0xD8, 0x1E, 0x9B, 0x53,
-    0xE5, 0xD6, 0x73, 0x11, 0x41, 0xB8, 0x5B, 0xEA, 0xC2, 0x78, 0xEF, 0x42, 0x93, 0x84, 0x99, 0xF1,
-    0xEB, 0xAD, 0x9A, 0x0E, 0x25, 0xAE, 0x21, 0x42, 0xA6, 0x5A, 0xFE, 0x5B, 0xB3, 0x8A, 0x65, 0x34,
-    0x45, 0x4D, 0x47, 0x31, 0xBA, 0x8E, 0x8B, 0x72, 0xAF, 0x99, 0x73, 0xAB, 0xB1, 0x86, 0xE2, 0xE9,
-    0x61, 0x8C, 0xC6, 0x79, 0x88, 0x8B, 0x39, 0xA2, 0x03, 0x26, 0x3E, 0xD6, 0xE5, 0x88, 0x30, 0x54,
-    0xA5, 0x88, 0x51, 0x89, 0xEA, 0x20, 0x31, 0x53, 0x93, 0x50, 0xA4, 0x8D, 0x7A, 0x21, 0x48, 0x91,
-    0xBE, 0x35, 0xC2, 0x36, 0x47, 0x3D, 0x12, 0xA7, 0xA9, 0x5C, 0x97, 0xD6, 0x79, 0x0D, 0x54, 0x67,
-    0xDF, 0x1B, 0x44, 0x63, 0xDB, 0x99, 0x2D, 0x6A, 0x04, 0x24, 0x4E, 0xCD, 0xA0, 0xC1, 0x24, 0x74,
-    0x59, 0x30, 0xD9, 0xAF, 0x06, 0x08, 0x14, 0xEF, 0x80, 0x18, 0xAC, 0x91, 0x72, 0x05, 0x13, 0xE1,
-    0x65, 0x2E, 0x60, 0x3D, 0x93, 0x4D, 0x4D, 0x91, 0x48, 0x4A, 0x45, 0x94, 0x44, 0x2F, 0xD6, 0x16,
-    0x75, 0x23, 0xE5, 0x57, 0x85, 0xAD, 0x72, 0x02, 0x2B, 0x4E, 0x3A, 0x9B, 0xA3, 0x29, 0xA9, 0x83,
-    0xBA, 0x6E, 0x98, 0x08, 0xBC, 0x16, 0x7E, 0x24, 0x3C, 0xBA, 0xDD, 0x96, 0xFF, 0xE7, 0x39, 0xDB,
-    0x89, 0x2E, 0xCD, 0x51, 0x62, 0x01, 0x43, 0x7C, 0x59, 0x24, 0xCC, 0xBB, 0x4B, 0x9A, 0xFA, 0x41,
-    0x68, 0xEA, 0xF3, 0x4B, 0x4D, 0x8D, 0x72, 0xA0, 0x73, 0xAF, 0x00, 0x4F, 0xD1, 0x6D, 0x5B, 0x3E,
-    0x30, 0x93, 0xCD, 0x70, 0x51, 0xD2, 0xA8, 0x18, 0x8A, 0x32, 0x7A, 0xD4, 0x0A, 0x32, 0x80, 0xEB,
-    0xF2, 0x1F, 0x45, 0xB0, 0x3B, 0x1F, 0xCC, 0x97, 0x82, 0xBF, 0x7A, 0xDC, 0x36, 0x13, 0x55, 0xD4,
-    0xC3, 0x7F, 0xD9, 0xA6, 0x2B, 0x02, 0x89, 0xE4, 0xC2, 0x88, 0xC1, 0xBE, 0x2C, 0x6B, 0xBD, 0x81,
-    0xEC, 0x33, 0x81, 0x42, 0xA1, 0x31, 0x18, 0xC8, 0xC2, 0x9F, 0x0B, 0x4E, 0xF7, 0x36, 0x72, 0x68,
-    0xAD, 0xF2, 0x84, 0x45, 0xFC, 0x68, 0xDC, 0x2F, 0x98, 0xA9, 0x45, 0xEC, 0x5D, 0x18, 0x3A, 0xAF,
-    0x64, 0x13, 0xC1, 0x90, 0x31, 0xF6, 0xB1, 0xC3, 0x5D, 0x8A, 0x54, 0x5E, 0x5B, 0xA0, 0xAC, 0x10,
-    0x57, 0xC1, 0xB1, 0x13, 0x44, 0x99, 0xD7, 0xFE, 0x48, 0xE9, 0x16, 0x9C, 0xD2, 0x09, 0x5C, 0xCF,
-    0x2F, 0xD8, 0xD7, 0x6E, 0xB4, 0x97, 0x6C, 0x6E, 0xCB, 0x27, 0xED, 0x2F, 0xEC, 0xC7, 0xB6, 0xCF,
-    0xC7, 0xD8, 0x1E, 0x03, 0x80, 0x14, 0x40, 0x87, 0x64, 0xDE, 0x3E, 0xF9, 0xE7, 0x99, 0x79, 0x02,
-    0x31, 0x28, 0x98, 0x34, 0xA9, 0x68, 0x36, 0xE1, 0x8B, 0x87, 0xF8, 0x54, 0xB9, 0x19, 0x00, 0xF3,
-    0x66, 0x65, 0xE1, 0x4D, 0xFC, 0x41, 0xEE, 0x8C, 0x1F, 0xDC, 0x14, 0x02, 0x32, 0x99, 0xC0, 0xA4,
-    0x70, 0xA0, 0x92, 0x89, 0x40, 0x01, 0x37, 0x87, 0xB8, 0xB5, 0xED, 0xF9, 0xE1, 0xE1, 0xF8, 0x13,
-    0x7B, 0xE3, 0xE3, 0x49, 0x88, 0xFD, 0x2B, 0x91, 0xF4, 0x4E, 0x27, 0xA1, 0xF2, 0xBA, 0xD3, 0x9A,
-    0x4C, 0xFE, 0xF9, 0xAE, 0x84, 0xA0, 0xDB, 0xF3, 0xA4, 0x2F, 0xC6, 0xEA, 0x27, 0xE7, 0xC5, 0x2C,
-    0x24, 0x7F, 0x93, 0x1D, 0x84, 0x2B, 0x80, 0x00, 0xDA, 0xB4, 0x98, 0xFE, 0x56, 0x76, 0x5F, 0x6C,
-    0x99, 0xE0, 0x22, 0x81, 0xD8, 0x27, 0x88, 0xCF, 0x4B, 0xE6, 0x69, 0x85, 0xD3, 0x90, 0x10, 0x84,
-    0x02, 0x6C, 0x99, 0x96, 0x4D, 0xF1, 0x43, 0xCF, 0x15, 0x44, 0x93, 0x18, 0x30, 0xD6, 0x5E, 0x52,
-    0x10, 0x37, 0xC8, 0x58, 0xC6, 0x1C, 0x27, 0x2C, 0x88, 0xDB, 0x94, 0x50, 0x7A, 0x71, 0xB6, 0x23,
-    0xBC, 0xB4, 0x14, 0x37, 0x66, 0x22, 0xC0, 0x5C, 0x00, 0x8D, 0xE9, 0x15, 0xD0, 0x5C, 0xB6, 0xB8,
-    0x43, 0x3D, 0xE0, 0x0D, 0x58, 0xAD, 0xB0, 0xF7, 0x87, 0x18, 0xBC, 0x98, 0xBC, 0x89, 0x2D, 0x58,
-    0x0C, 0x09, 0x79, 0xF2, 0xC2, 0xF8, 0x0D, 0x61, 0xBE, 0x1E, 0x19, 0x0B, 0xC4, 0xCA, 0x84, 0x9D,
-    0x45, 0x6D, 0x21, 0x88, 0x8E, 0xEA, 0x51, 0xF0, 0x94, 0x32, 0x35, 0x39, 0x02, 0xB7, 0x7D, 0x88,
-    0x0E, 0xAF, 0x2A, 0xE2, 0x05, 0xCB, 0x6A, 0x99, 0xD2, 0x14, 0x8B, 0x7B, 0x76, 0x94, 0x5B, 0x08,
-    0x1E, 0xF0, 0xA6, 0xA8, 0xC5, 0xB7, 0xE0, 0x5D, 0xE1, 0x95, 0xD0, 0x96, 0x08, 0x3F, 0x54, 0x0C,
-    0x63, 0xAE, 0x65, 0x6A, 0xB1, 0x97, 0x10, 0xED, 0x2C, 0x20, 0xDA, 0xB4, 0xE0, 0xB4, 0x17, 0xEA,
-    0x64, 0xC3, 0x1F, 0x86, 0x87, 0xFC, 0xC0, 0x99, 0x49, 0xD5, 0x48, 0x30, 0x2C, 0x21, 0xDA, 0x75,
-    0x5B, 0x25, 0xAC, 0x60, 0xBC, 0xAC, 0x10, 0xED, 0x29, 0x63, 0xFE, 0x12, 0x6E, 0x8D, 0xE0, 0x4E,
-    0x11, 0x4E, 0xD1, 0x34, 0x6F, 0xCA, 0x80, 0xC2, 0xD7, 0x0B, 0xC1, 0xE5, 0x47, 0x41, 0x47, 0xA1,
-    0xBD, 0x28, 0x49, 0xF1, 0x61, 0x3A, 0x21, 0x9A, 0x08, 0x5D, 0x08, 0x5D, 0x04, 0x4F, 0xBC, 0x47,
-    0x85, 0x06, 0x2A, 0x93, 0x1A, 0x81, 0xD0, 0x19, 0xFF, 0x2C, 0x72, 0x23, 0xBE, 0x45, 0x0F, 0x26,
-    0x5D, 0xD8, 0xFF, 0x0A, 0x17, 0x46, 0x36, 0xD1, 0xC0, 0xD0, 0x4D, 0x10, 0xB0, 0x52, 0x5D, 0x3A,
-    0x22, 0xB2, 0xF5, 0xD3, 0x1B, 0xAA, 0xDC, 0x60, 0xA2, 0xC2, 0xE9, 0x49, 0x8C, 0x46, 0xDA, 0xCB,
-    0x6F, 0x5D, 0x00, 0x73, 0x96, 0x20, 0x94, 0xC8, 0x50, 0x05, 0xF2, 0x13, 0x40, 0x23, 0x3B, 0x82,
-    0x45, 0x92, 0xD7, 0x50, 0x86, 0x17, 0xB5, 0x57, 0xCE, 0x36, 0xE9, 0x76, 0x29, 0x3A, 0x68, 0x40,
-    0x88, 0xF2, 0x4D, 0x46, 0xBA, 0x32, 0x05, 0x85, 0xD0, 0xAB, 0xAA, 0x44, 0xB9, 0x95, 0xA3, 0xFA,
-    0x00, 0xD0, 0xAF, 0x8B, 0x7A, 0x89, 0x19, 0xC5, 0xD6, 0x22, 0xF7, 0x9D, 0x80, 0x84, 0x5B, 0x6D,
-    0x2C, 0x28, 0x65, 0xF2, 0xA6, 0x50, 0x44, 0x2D, 0x2D, 0xCA, 0x23, 0x63, 0xDC, 0x85, 0x37, 0x64,
-    0xE1, 0xA0, 0x71, 0x07, 0x0A, 0x7E, 0x59, 0xF6, 0x64, 0x48, 0xAF, 0xE5, 0x0D, 0xD6, 0x63, 0xD5,
-    0x33, 0x71, 0xF5, 0x2D, 0x32, 0x94, 0x40, 0x4E, 0xCF, 0x42, 0x6C, 0x7F, 0x21, 0xE2, 0x50, 0x8D,
-    0x0E, 0xD6, 0xCC, 0x5F, 0x84, 0x20, 0x48, 0x27, 0xD8, 0x02, 0xB7, 0x82, 0xA3, 0x60, 0xE4, 0x5E,
-    0x32, 0x3F, 0xE1, 0x9D, 0xA2, 0xCC, 0xE0, 0x2A, 0xE0, 0x6E, 0xF0, 0x15, 0x70, 0x3B, 0x3A, 0x0B,
-    0xB8, 0x9F, 0x2F, 0xDE, 0x02, 0xA4, 0x80, 0x4E, 0x3D, 0xEF, 0x48, 0x7F, 0x01, 0x1C, 0x90, 0x30,
-    0xE0, 0xD1, 0x69, 0x1A, 0x8E, 0x55, 0x0E, 0x67, 0xEC, 0xD9, 0x9A, 0x0E, 0xF9, 0x99, 0xE9, 0x74,
-    0x86, 0xC0, 0xBA, 0x6C, 0xB8, 0x07, 0xDF, 0x56, 0x80, 0xCD, 0x55, 0xF1, 0xB0, 0xA7, 0x5C, 0x36,
-    0x7E, 0xFB, 0x1D, 0x19, 0xB4, 0x29, 0xAB, 0x74, 0x08, 0x04, 0xFB, 0xCB, 0xC6, 0x00, 0x49, 0x89,
-    0x28, 0xCB, 0x06, 0x8A, 0xA3, 0x2A, 0x7E, 0x64, 0xF9, 0x2A, 0x08, 0x09, 0x7D, 0x7B, 0x74, 0x82,
-    0x90, 0x08, 0x07, 0x43, 0x14, 0x6A, 0xE7, 0x46, 0xD1, 0x83, 0x6E, 0xCD, 0x37, 0xE5, 0x97, 0xE0,
-    0xBA, 0xCB, 0x84, 0x33, 0x14, 0x7F, 0xF8, 0xF2, 0x72, 0xB9, 0xA7, 0x40, 0x10, 0x85, 0x1A, 0x61,
-    0x6F, 0x9C, 0x4C, 0x19, 0xF3, 0x88, 0xC6, 0xBE, 0x96, 0xD5, 0x2F, 0x2F, 0x13, 0xD5, 0xA2, 0xE0,
-    0x35, 0x9C, 0xC4, 0x42, 0x8B, 0xFF, 0xB7, 0xCE, 0x6B, 0xF3, 0xD6, 0x68, 0x9E, 0x94, 0xF8, 0x1D,
-    0xA6, 0x32, 0xD1, 0xC0, 0x94, 0xA8, 0xA8, 0x40, 0x4C, 0x99, 0x78, 0x9B, 0x8A, 0x4B, 0xE4, 0x6F,
-    0x8D, 0xDB, 0x03, 0xA1, 0x70, 0xC0, 0xBD, 0x14, 0x9D, 0x0D, 0xE7, 0xCE, 0xBC, 0xC2, 0x5C, 0x22,
-    0x7C, 0x93, 0xF6, 0xA0, 0xC1, 0xB5, 0x4C, 0x08, 0x7F, 0xF0, 0x33, 0xAE, 0x44, 0xBE, 0x0F, 0xA0,
-    0x34, 0x38, 0xD9, 0x79, 0x52, 0xAC, 0x85, 0xA5, 0x2B, 0xCF, 0x42, 0x60, 0x02, 0xC6, 0x7F, 0x03,
-    0xA7, 0x0E, 0xE2, 0x58, 0x24, 0x1F, 0x08, 0xF6, 0x31, 0xFF, 0x23, 0xD4, 0x48, 0x82, 0x49, 0x47,
-    0x2D, 0x5C, 0xC2, 0x37, 0x22, 0xEC, 0x82, 0x5A, 0x64, 0x5A, 0xA5, 0x11, 0x7D, 0x2E, 0x9E, 0x1F,
-    0xD3, 0xCA, 0x93, 0x62, 0x04, 0x0D, 0x0B, 0xB0, 0xEC, 0x44, 0x4C, 0x52, 0x59, 0x07, 0x2E, 0x66,
-    0xF8, 0xC3, 0x85, 0x6D, 0x4B, 0xBB, 0xBF, 0x6C, 0x04, 0x2E, 0xA4, 0x15, 0xF0, 0x60, 0x01, 0x07,
-    0x59, 0x96, 0x4D, 0x2C, 0x17, 0x0C, 0x5F, 0xCF, 0xB7, 0x5F, 0xB0, 0x5D, 0x39, 0xF9, 0x53, 0xB6,
-    0xE6, 0x0A, 0xAD, 0xA2, 0xDA, 0x3E, 0xD6, 0xE7, 0x17, 0xC6, 0xA8, 0x9E, 0x4C, 0xB6, 0xE4, 0xAA,
-    0x1F, 0x22, 0xAC, 0x2F, 0x8E, 0xDC, 0xE2, 0x6C, 0x4F, 0xEC, 0x41, 0x50, 0x43, 0xE7, 0xAC, 0x03,
-    0xE1, 0x5D, 0x21, 0x8B, 0x2C, 0x34, 0x6E, 0x4F, 0x06, 0x53, 0x8F, 0x90, 0x81, 0x38, 0xDE, 0x28,
-    0x2A, 0xDF, 0x8D, 0x16, 0xD1, 0xE4, 0x33, 0xF6, 0x16, 0xCD, 0xA1, 0x3C, 0xC5, 0x1D, 0xCB, 0xAF,
-    0xBF, 0x70, 0xA5, 0x5A, 0xA8, 0x80, 0x34, 0xFB, 0x69, 0xCA, 0xAC, 0x2B, 0x6F, 0x27, 0xCB, 0xD1,
-    0xC2, 0x13, 0xA5, 0xB0, 0xA6, 0x11, 0x88, 0x92, 0x91, 0x37, 0xA2, 0xEF, 0x74, 0xBE, 0x7C, 0x59,
-    0x77, 0x61, 0x56, 0x7F, 0xDB, 0x87, 0xBF, 0xF5, 0x31, 0xE3, 0xE6, 0x95, 0x26, 0x42, 0x98, 0x41,
-    0x7E, 0xC0, 0x45, 0xD5, 0xE8, 0xF6, 0x2C, 0xF3, 0x32, 0x44, 0x5E, 0xA1, 0xAB, 0x14, 0x3B, 0xCA,
-    0xDC, 0x53, 0x9F, 0x30, 0x25, 0x55, 0x69, 0x42, 0xC3, 0x1F, 0x51, 0x32, 0x23, 0x66, 0x07, 0xB5,
-    0x59, 0x55, 0x79, 0x03, 0x01, 0x0C, 0x1A, 0x6E, 0xB8, 0x45, 0x3E, 0xA4, 0x12, 0x96, 0x21, 0xC3,
-    0x86, 0xE6, 0x27, 0xB6, 0xE5, 0x15, 0x6C, 0x59, 0x01, 0x13, 0x91, 0x0E, 0x0C, 0xA4, 0xC8, 0x1B,
-    0xA0, 0x9E, 0x0F, 0x38, 0x19, 0x7B, 0x0A, 0x46, 0x28, 0xB1, 0x4C, 0x50, 0x59, 0xFC, 0xF1, 0x0C,
-    0x54, 0xA1, 0xE8, 0x13, 0x8F, 0x96, 0x62, 0xC1, 0x47, 0x9F, 0xDA, 0xE5, 0x89, 0xA9, 0x3C, 0xC9,
-    0x28, 0x71, 0x87, 0xD8, 0xDC, 0xD9, 0x21, 0xBA, 0x7E, 0x56, 0x14, 0xA0, 0x60, 0xD5, 0x6E, 0x21,
-    0x8F, 0xE2, 0xC4, 0x8C, 0x34, 0xC5, 0x03, 0x32, 0x45, 0x62, 0x24, 0x6A, 0x68, 0xF3, 0x1C, 0x8C,
-    0x0F, 0xD7, 0x4D, 0x13, 0x53, 0x6B, 0x4E, 0xAA, 0x43, 0x0D, 0xA3, 0x22, 0xF7, 0x39, 0xD3, 0xF8,
-    0x21, 0x7B, 0x85, 0x55, 0x27, 0xD5, 0xE2, 0xEC, 0xF5, 0x9F, 0x3B, 0x1A, 0xB3, 0xEC, 0x09, 0x1E,
-    0x41, 0xFA, 0x0B, 0xDB, 0x52, 0xB0, 0xC3, 0x4F, 0x3E, 0x16, 0x5D, 0x32, 0xC1, 0xE1, 0x68, 0x51,
-    0x35, 0x0F, 0x13, 0xD5, 0xB3, 0x48, 0x39, 0x46, 0xBC, 0xA9, 0x2C, 0x62, 0x60, 0x01, 0x58, 0xC9,
-    0xFF, 0x24, 0x04, 0xD8, 0xBE, 0x88, 0x94, 0xB7, 0x30, 0x9C, 0xBD, 0x64, 0x75, 0xF3, 0x77, 0xAB,
-    0x4A, 0x7D, 0x98, 0xE0, 0x67, 0x5D, 0xC5, 0x1F, 0xD4, 0x27, 0x18, 0x4B, 0xCB, 0xFF, 0x40, 0xF6,
-    0xFD, 0x2B, 0xEC, 0xB1, 0x5E, 0x98, 0x53, 0x89, 0xA8, 0xB1, 0x8B, 0x20, 0xE2, 0x99, 0x49, 0x3C,
-    0x86, 0xE4, 0xAD, 0xE9, 0xA0, 0x8F, 0xB8, 0x44, 0xFA, 0x62, 0x65, 0x82, 0x4F, 0xE0, 0x29, 0x94,
-    0xC0, 0x7C, 0x1D, 0xB6, 0x50, 0x76, 0xF9, 0x43, 0x04, 0xAC, 0xC4, 0xD6, 0x27, 0x8D, 0x3D, 0x7A,
-    0x62, 0x0A, 0x27, 0xF1, 0xC0, 0x52, 0x7B, 0x4C, 0x9C, 0xAD, 0x86, 0x92, 0xA0, 0xF1, 0x07, 0x46,
-    0xBC, 0x08, 0xAA, 0x41, 0x83, 0x85, 0x86, 0x35, 0x32, 0x37, 0x11, 0xD4, 0x3A, 0xED, 0x51, 0xE3,
-    0xBF, 0xBF, 0x20, 0x83, 0xF9, 0x17, 0xB2, 0x41, 0x55, 0x90, 0x01, 0x33, 0xB6, 0x74, 0x17, 0x8C,
-    0x2E, 0x8B, 0x91, 0x2A, 0xAD, 0x40, 0x72, 0xBA, 0xAD, 0xF0, 0x4E, 0xC1, 0x45, 0x40, 0x18, 0x10,
-    0x55, 0x1B, 0x87, 0x2D, 0x22, 0xFA, 0xC1, 0xA0, 0x0E, 0x07, 0x7D, 0x0F, 0xEC, 0xA1, 0xE0, 0xB0,
-    0xCA, 0x78, 0x13, 0xB4, 0x43, 0xD4, 0x42, 0xF2, 0x2C, 0x16, 0x17, 0x5D, 0xA5, 0xA2, 0x45, 0x09,
-    0x4A, 0xF4, 0x49, 0x3B, 0xE7, 0x2E, 0xD5, 0x65, 0x60, 0x41, 0xAF, 0xCB, 0xC2, 0x32, 0xF5, 0x5A,
-    0xB3, 0x22, 0xC4, 0x98, 0xEF, 0xAE, 0x8F, 0xAE, 0x15, 0x42, 0x8B, 0x93, 0x58, 0x6F, 0x63, 0xC2,
-    0x53, 0xF7, 0x90, 0x3E, 0xDF, 0x02, 0x7D, 0x9E, 0x01, 0x7D, 0x5E, 0xB9, 0x15, 0x4C, 0xC7, 0xF5,
-    0x6E, 0xE1, 0xED, 0xC4, 0xE8, 0x94, 0xB8, 0x84, 0xE5, 0x94, 0xA9, 0x35, 0x3E, 0xF4, 0x84, 0xFD,
-    0xEB, 0xE3, 0x4C, 0x8D, 0x32, 0xCD, 0xF2, 0xFC, 0xB8, 0xB5, 0xF3, 0x64, 0x3D, 0x86, 0xA3, 0xDF,
-    0xA6, 0x22, 0x58, 0x43, 0x20, 0x0E, 0xE5, 0xC3, 0x4E, 0x65, 0xC4, 0xEA, 0x6D, 0x31, 0xCF, 0xC8,
-    0xB4, 0xC5, 0x36, 0x1C, 0x21, 0x84, 0x92, 0x99, 0xD5, 0x09, 0x91, 0x9F, 0xD3, 0x62, 0x47, 0x96,
-    0xDC, 0xA3, 0xC0, 0x3E, 0x8B, 0x3B, 0x31, 0x20, 0x5B, 0xAC, 0xBB, 0xB7, 0x44, 0x62, 0xBB, 0x45,
-    0x97, 0x4F, 0x21, 0xDD, 0x97, 0x30, 0xB4, 0x8D, 0xB2, 0x71, 0x11, 0xEB, 0x09, 0x09, 0x62, 0xB8,
-    0xA3, 0x48, 0x7A, 0x37, 0xE8, 0xD9, 0xB1, 0x15, 0xCB, 0xC2, 0x8C, 0xDD, 0x12, 0xCB, 0x84, 0xB8,
-    0x1F, 0xA2, 0x01, 0xDB, 0xA3, 0xA0, 0x1A, 0xD9, 0x40, 0x91, 0x23, 0xB9, 0x15, 0x03, 0x0F, 0x53,
-    0x02, 0xBF, 0x74, 0x44, 0x98, 0x30, 0x10, 0x46, 0xF6, 0x6D, 0xD9, 0xE5, 0xF0, 0x99, 0x6B, 0x94,
-    0x6A, 0x4E, 0xCB, 0x9A, 0x9E, 0x3B, 0x16, 0x70, 0x2C, 0x56, 0x0B, 0x38, 0x12, 0x3A, 0xA6, 0x11,
-    0xBB, 0x16, 0x90, 0x66, 0x5E, 0x29, 0xE0, 0x60, 0x72, 0x2D, 0xDD, 0x4D, 0xDC, 0x0F, 0xCC, 0x8E,
-    0xF4, 0x70, 0xDD, 0xD3, 0x0E, 0x8F, 0x79, 0x8B, 0xDA, 0x00, 0x8B, 0xFE, 0x04, 0xA4, 0x1B, 0x60,
-    0x84, 0xE4, 0xFF, 0xDB, 0x9F, 0x56, 0xC0, 0xB1, 0x12, 0x16, 0x69, 0x7C, 0x41, 0x9D, 0x48, 0x04,
-    0x3C, 0x87, 0xE0, 0x34, 0x23, 0x20, 0xB2, 0x0A, 0xDC, 0xF5, 0xA2, 0x7C, 0xBF, 0x67, 0x4F, 0x9F,
-    0xED, 0x04, 0x9A, 0x20, 0x56, 0x32, 0x21, 0x12, 0x83, 0x00, 0xCA, 0x6D, 0xC2, 0x22, 0x2C, 0x32,
-    0xC4, 0x5E, 0x7B, 0xF6, 0x75, 0x66, 0xBC, 0xAF, 0x59, 0x24, 0x69, 0x99, 0x3B, 0xB0, 0xCC, 0xE3,
-    0xD8, 0xD7, 0x50, 0x8F, 0x94, 0xB3, 0x39, 0x09, 0xE1, 0x2A, 0x4B, 0xD0, 0x5F, 0x56, 0x70, 0x3F,
-    0x63, 0x60, 0x76, 0xA8, 0x55, 0xC5, 0x18, 0x6C, 0xC0, 0xA0, 0x78, 0x89, 0xBE, 0x2C, 0x40, 0x37,
-    0xAD, 0xC1, 0x7A, 0x9D, 0xC5, 0x57, 0x1F, 0x69, 0xE6, 0x5F, 0x0D, 0x03, 0x65, 0x21, 0xD1, 0x7E,
-    0x02, 0x6B, 0x96, 0xD9, 0x56, 0x57, 0x74, 0xBC, 0x6B, 0xC7, 0xBE, 0x16, 0x08, 0xCD, 0xF3, 0xB7,
-    0xE4, 0x5D, 0x79, 0x2F, 0xA0, 0x38, 0x45, 0x30, 0x3C, 0x7D, 0x5F, 0x98, 0x47, 0x44, 0x28, 0x1A,
-    0x44, 0xEE, 0x16, 0x16, 0x3A, 0xAE, 0xFC, 0x31, 0x68, 0xFB, 0x1E, 0xD2, 0x05, 0x3B, 0x80, 0x5B,
-    0xD3, 0x30, 0x57, 0x2B, 0xC7, 0x76, 0xBE, 0x85, 0xDE, 0x81, 0x37, 0x88, 0xEA, 0xDB, 0x56, 0xC7,
-    0x7D, 0x51, 0xC5, 0x75, 0xE3, 0x3D, 0x2F, 0xAE, 0x73, 0x93, 0xB2, 0xAE, 0x40, 0xC9, 0x79, 0x74,
-    0xA3, 0x59, 0x29, 0xF4, 0x9E, 0x6B, 0xC4, 0x97, 0x4D, 0x09, 0x2E, 0xF3, 0xF9, 0x23, 0x97, 0xC5,
-    0x28, 0x7E, 0xAF, 0x61, 0xDB, 0x69, 0x9F, 0x68, 0xAF, 0xE9, 0x5B, 0xD0, 0x5E, 0x23, 0xB4, 0xD7,
-    0x38, 0x07, 0x03, 0x04, 0x4D, 0x6F, 0x98, 0x7F, 0xDC, 0xCE, 0x39, 0x5A, 0x96, 0xB1, 0xB2, 0x8E,
-    0x1D, 0x38, 0xD5, 0x7C, 0xE7, 0x37, 0x26, 0x16, 0x13, 0xD7, 0x5B, 0xD3, 0x1A, 0xEF, 0xC9, 0xF1,
-    0xF8, 0xBD, 0x49, 0x2C, 0x0A, 0x24, 0x38, 0x8C, 0x92, 0x89, 0x51, 0x1B, 0xD8, 0x68, 0x2D, 0x08,
-    0x6B, 0xA1, 0x4F, 0x73, 0x64, 0xDC, 0x3B, 0x7D, 0xD5, 0x2A, 0xD4, 0x4E, 0xAF, 0x00, 0xFF, 0x4E,
-    0x70, 0x23, 0x93, 0x06, 0xD1, 0xA0, 0xF8, 0x3D, 0x81, 0xF6, 0x2F, 0x8A, 0x17, 0x89, 0x20, 0x9A,
-    0x80, 0x22, 0x86, 0x90, 0x61, 0x4F, 0x0E, 0x99, 0x5B, 0xAA, 0xA3, 0xBA, 0x65, 0x75, 0xD4, 0x73,
-    0xAC, 0x8E, 0x32, 0x2B, 0xD5, 0x51, 0x21, 0xAB, 0xA3, 0x12, 0x54, 0x47, 0xB5, 0x40, 0x56, 0x6F,
-    0xBD, 0x37, 0x0A, 0x2F, 0x02, 0x7F, 0x47, 0x43, 0xBC, 0x52, 0x1D, 0x35, 0xB2, 0x3A, 0x8A, 0x51,
-    0x41, 0x24, 0xBC, 0x65, 0xB9, 0xD9, 0x67, 0xA9, 0x8E, 0xFA, 0x8C, 0x81, 0xCF, 0xC5, 0x4D, 0x81,
-    0x4F, 0x94, 0xE6, 0xBE, 0xFE, 0x63, 0xF1, 0x14, 0xDF, 0xFD, 0x10, 0x31, 0x89, 0x47, 0x10, 0xF8,
-    0x0C, 0xE1, 0x36, 0xDC, 0xD0, 0x96, 0x40, 0xD6, 0x5A, 0x55, 0x08, 0x7C, 0xF6, 0x00, 0xC5, 0x31,
-    0xE8, 0x24, 0xF0, 0xE6, 0xD3, 0x02, 0x9F, 0xEA, 0xBE, 0xB0, 0x8C, 0x7B, 0xD9, 0xB1, 0xEB, 0xFA,
-    0xC6, 0x18, 0x7E, 0x2B, 0xB4, 0x8E, 0x3F, 0x70, 0x7A, 0xF5, 0xED, 0xCD, 0x3B, 0x76, 0x52, 0xEA,
-    0x82, 0xD9, 0xED, 0x76, 0x4B, 0x3D, 0xFC, 0x1D, 0x2A, 0x42, 0x56, 0xDF, 0x78, 0xC7, 0x3A, 0xB2,
-    0xAF, 0xB9, 0x50, 0x15, 0x23, 0xB9, 0x39, 0x3B, 0x9C, 0x4A, 0xED, 0xBB, 0xAA, 0x62, 0xD4, 0x17,
-    0x01, 0x46, 0xF9, 0x83, 0x83, 0xDE, 0x79, 0xA5, 0x20, 0x32, 0xEA, 0x9D, 0x94, 0xB2, 0xCD, 0xA8,
-    0x32, 0xFB, 0xE4, 0xC5, 0xE0, 0xA5, 0x8E, 0x92, 0x4F, 0x1D, 0xCA, 0x9B, 0x6E, 0xDC, 0xB1, 0x19,
-    0xA0, 0xBF, 0x7D, 0x33, 0x40, 0xB5, 0x5A, 0xB5, 0x7E, 0xC8, 0xFE, 0x7A, 0xC3, 0x68, 0x7D, 0xF4,
-    0xFA, 0xD9, 0xE9, 0x67, 0xBF, 0x53, 0x33, 0xC0, 0xFA, 0xCB, 0xC8, 0xA7, 0xCB, 0x6B, 0x93, 0x0F,
-    0x40, 0x5D, 0x44, 0xED, 0x01, 0x38, 0x4C, 0xB2, 0xF1, 0x8F, 0x20, 0xA5, 0x2C, 0x7A, 0x0A, 0x71,
-    0x03, 0xE1, 0xFF, 0xE9, 0x15, 0x61, 0x85, 0xF6, 0x88, 0x30, 0xC6, 0x8F, 0x47, 0x0F, 0xAD, 0x74,
-    0x1D, 0xD2, 0x4F, 0x09, 0xB8, 0xD1, 0x95, 0x67, 0xAF, 0xF6, 0x79, 0x08, 0xBB, 0xEE, 0x3C, 0x0E,
-    0x08, 0x9A, 0xC5, 0xE0, 0xED, 0x85, 0x72, 0xF5, 0x6A, 0xD9, 0xDA, 0x6A, 0x3B, 0xB0, 0x55, 0x09,
-    0xDE, 0xB2, 0x85, 0x2C, 0x5E, 0x6C, 0x2B, 0x0B, 0x2D, 0x7C, 0x16, 0x9E, 0xCB, 0x1B, 0xCA, 0x1A,
-    0xF1, 0xB0, 0x41, 0x3B, 0xD1, 0xE4, 0xA5, 0x48, 0xFC, 0xE9, 0xDE, 0xD8, 0xE7, 0xE1, 0x07, 0x8A,
-    0xAA, 0x1A, 0x17, 0xBB, 0x15, 0x74, 0xE1, 0x6E, 0x3B, 0xB0, 0xF6, 0xD1, 0x76, 0xAA, 0x73, 0x65,
-    0x9D, 0xFF, 0xB0, 0xEC, 0xA0, 0x83, 0x6D, 0x1F, 0x0E, 0xDB, 0xC7, 0x11, 0x30, 0x13, 0xE7, 0xC4,
-    0x74, 0x82, 0xE5, 0x4F, 0x02, 0x1A, 0x86, 0x3B, 0xC7, 0x29, 0xEF, 0xF4, 0x30, 0xAF, 0xE5, 0x1D,
-    0x24, 0x1B, 0xBE, 0xA2, 0x20, 0x8E, 0x01, 0x61, 0x43, 0x51, 0x7D, 0x83, 0xCD, 0x02, 0xE7, 0x6D,
-    0x47, 0x44, 0xA6, 0x7E, 0x26, 0xDE, 0xCE, 0xAF, 0x51, 0x83, 0x3B, 0xB2, 0x36, 0xD7, 0x3B, 0xFD,
-    0xC7, 0xDD, 0x0A, 0x20, 0x50, 0x63, 0x8F, 0x09, 0x72, 0x6E, 0x82, 0x71, 0xE8, 0x78, 0x4F, 0xCF,
-    0x92, 0x31, 0xE7, 0x96, 0x0E, 0xF0, 0xD2, 0x93, 0xC9, 0x7E, 0x6F, 0x59, 0xD8, 0x76, 0x6F, 0x16,
-    0xB6, 0x46, 0x16, 0x36, 0xB4, 0xE7, 0x34, 0x0B, 0xFB, 0x7F, 0x2B, 0xCD, 0xC2, 0xBA, 0x19, 0xCE,
-    0xF0, 0x62, 0xDA, 0xF3, 0x6B, 0x30, 0xB8, 0x22, 0xEC, 0xA5, 0x91, 0xF8, 0x22, 0xBA, 0x1F, 0x86,
-    0xD9, 0xB4, 0x63, 0xD7, 0xFF, 0xC3, 0x79, 0x8C, 0xDB, 0x39, 0x58, 0xB3, 0x9F, 0xF6, 0xEB, 0x6E,
-    0xA5, 0x91, 0x0F, 0x57, 0xEC, 0x2C, 0x5B, 0x84, 0x15, 0xDD, 0x63, 0x38, 0x42, 0xFE, 0x6A, 0xED,
-    0xCF, 0x1A, 0x2B, 0xFB, 0x3D, 0xAD, 0xEC, 0x4F, 0x10, 0x11, 0x9E, 0xE8, 0x3D, 0xDB, 0x22, 0xBE,
-    0xA1, 0x76, 0xCC, 0x83, 0x12, 0x0C, 0xB5, 0xEB, 0x32, 0x57, 0xEE, 0xA3, 0x8F, 0xD2, 0x27, 0x5A,
-    0xD9, 0x3F, 0xDC, 0xB1, 0xB2, 0xFF, 0xC4, 0xDE, 0xCA, 0xFE, 0x7E, 0x4F, 0x65, 0x7F, 0xA3, 0x95,
-    0xFD, 0xF5, 0x1D, 0x2B, 0xFB, 0x03, 0x85, 0xA2, 0xAE, 0x50, 0xCC, 0x75, 0xD0, 0xA9, 0xD8, 0x38,
-    0x66, 0x74, 0xE5, 0x61, 0xB1, 0xAE, 0xE4, 0xEB, 0xE6, 0x6E, 0x65, 0x91, 0xFB, 0xBC, 0x4A, 0xEC,
-    0x0B, 0xBD, 0x99, 0x80, 0x61, 0xE3, 0xC2, 0xDD, 0x0F, 0x20, 0x7A, 0x81, 0x57, 0x50, 0x3F, 0x4A,
-    0x39, 0x9C, 0x91, 0xFB, 0x06, 0x23, 0x8C, 0xE1, 0xC8, 0x08, 0x5A, 0x0A, 0x65, 0xD9, 0x69, 0x77,
-    0x44, 0xE6, 0xDB, 0x57, 0xC0, 0x69, 0x61, 0xB7, 0x8F, 0x71, 0x65, 0xB8, 0x96, 0xD3, 0xC3, 0x6C,
-    0x8F, 0x98, 0x1E, 0xCE, 0x59, 0x4F, 0xF5, 0xEF, 0xB5, 0x94, 0xF4, 0x7F, 0x39, 0x47, 0xCD, 0x89,
-    0x01, 0xCB, 0x98, 0x76, 0x58, 0xAA, 0x1B, 0x5F, 0x7B, 0x8F, 0xC1, 0x8C, 0x0F, 0xDF, 0x24, 0xAE,
-    0xFF, 0xF0, 0x0D, 0xB6, 0xA7, 0xBF, 0x5B, 0x80, 0x3A, 0xB0, 0xE3, 0xDA, 0x7E, 0x95, 0xD3, 0x19,
-    0x80, 0x5D, 0x86, 0x1E, 0x4D, 0x34, 0x98, 0x17, 0x21, 0x04, 0x0B, 0x2D, 0x9D, 0xB9, 0x46, 0x1F,
-    0xEF, 0x29, 0xF1, 0xE1, 0x04, 0xEE, 0xFB, 0x23, 0xB2, 0xD5, 0x23, 0x90, 0xBC, 0x50, 0xC8, 0x94,
-    0x5F, 0xF5, 0xC7, 0x3F, 0x83, 0x91, 0xFF, 0x48, 0x76, 0x7C, 0xB8, 0x52, 0x21, 0x54, 0x54, 0xE8,
-    0x66, 0x46, 0x9F, 0xBC, 0x23, 0x04, 0xFA, 0xE8, 0xC5, 0xC6, 0xC4, 0x9F, 0xBC, 0xD0, 0x9A, 0xE4,
-    0x52, 0xD0, 0x7F, 0x53, 0x54, 0xE7, 0xC4, 0xE4, 0x6F, 0x8F, 0xAC, 0x47, 0x0B, 0x7F, 0xAD, 0xD8,
-    0x8D, 0xD9, 0x7E, 0x96, 0x56, 0x11, 0x91, 0x9B, 0x63, 0x1D, 0xAB, 0x75, 0x41, 0x8B, 0x27, 0xEC,
-    0xBF, 0xD2, 0x56, 0x91, 0x48, 0x19, 0xEA, 0xDC, 0xBD, 0x6F, 0x15, 0xD9, 0xD2, 0x66, 0x0B, 0x4A,
-    0x90, 0x79, 0x62, 0x70, 0xAA, 0x4F, 0x41, 0x41, 0xB1, 0xFE, 0xA8, 0x38, 0xD5, 0xE2, 0xDE, 0x76,
-    0xB6, 0x89, 0x5A, 0x71, 0x75, 0x84, 0x35, 0x8A, 0xF8, 0x4D, 0xF4, 0x46, 0x3C, 0x2B, 0xD7, 0x5D,
-    0x2C, 0xD4, 0x7B, 0xD2, 0xC6, 0x0D, 0x2C, 0xEC, 0xC5, 0x16, 0xB9, 0x6F, 0x01, 0x9A, 0xC7, 0x86,
-    0x3F, 0x8D, 0x45, 0xFA, 0xDE, 0x14, 0xFF, 0x43, 0xBC, 0xCC, 0xC8, 0x32, 0x66, 0x34, 0x07, 0xEC,
-    0x71, 0x63, 0xC1, 0x05, 0xE2, 0x03, 0xA2, 0x8A, 0x5C, 0xFC, 0x8B, 0xEF, 0x59, 0x94, 0x98, 0x8D,
-    0xF9, 0x9F, 0xC9, 0xEC, 0x6E, 0x7C, 0x38, 0x84, 0x10, 0xB5, 0xB0, 0x11, 0x51, 0x13, 0x28, 0x09,
-    0xF7, 0x2A, 0x33, 0xDF, 0xF0, 0x27, 0x7A, 0x03, 0x71, 0x47, 0x51, 0x2B, 0xDF, 0x50, 0x9D, 0xBF,
-    0x87, 0x32, 0xEF, 0xAB, 0x4F, 0xA5, 0x94, 0x51, 0xAB, 0xB0, 0xA4, 0x0C, 0xFB, 0xF5, 0x94, 0x32,
-    0xC9, 0x2E, 0x65, 0x0A, 0x47, 0x19, 0x9F, 0xC5, 0x3C, 0x05, 0xCF, 0x63, 0x98, 0x96, 0x39, 0xDF,
-    0x9F, 0x1F, 0x37, 0x5F, 0x03, 0x58, 0x4F, 0x1B, 0xF9, 0x73, 0x3E, 0x9C, 0xFB, 0x7E, 0x9B, 0x4F,
-    0xA9, 0xF8, 0xAF, 0x6F, 0x46, 0xF5, 0x94, 0x56, 0x8B, 0x3E, 0x07, 0xE9, 0x92, 0x77, 0x2A, 0x97,
-    0x8B, 0xA4, 0x21, 0x56, 0x70, 0x5F, 0x5E, 0x04, 0x1C, 0x7C, 0x17, 0x54, 0xED, 0xF2, 0x57, 0x51,
-    0x1C, 0x34, 0xC9, 0x62, 0x61, 0x15, 0xCB, 0x4A, 0xA8, 0x28, 0x5C, 0x33, 0xBA, 0x76, 0xB3, 0xFB,
-    0xB8, 0x85, 0xA4, 0xDE, 0xEB, 0xA1, 0x35, 0x9F, 0xEA, 0xA1, 0x39, 0x13, 0x79, 0xAB, 0x87, 0x86,
-    0x8A, 0x8C, 0x04, 0xE1, 0x14, 0x0C, 0xD4, 0x9C, 0x81, 0xAB, 0xC5, 0x92, 0x0C, 0x64, 0xDF, 0x9D,
-    0xAB, 0x35, 0x6E, 0xEA, 0x01, 0x35, 0x9C, 0xB2, 0x89, 0xAE, 0x9F, 0x41, 0xBE, 0x80, 0x39, 0x34,
-    0x58, 0xEB, 0x36, 0x18, 0x1E, 0x4E, 0x1B, 0x46, 0xF8, 0x42, 0x14, 0xB5, 0x84, 0x10, 0x33, 0x7F,
-    0x07, 0x77, 0x7A, 0xB4, 0x9B, 0xD3, 0x7F, 0xBB, 0x0F, 0x8C, 0x1F, 0x93, 0xD5, 0x0E, 0xCD, 0xD4,
-    0x25, 0x0A, 0xED, 0x23, 0x07, 0x44, 0xD9, 0xB6, 0xEA, 0x68, 0x18, 0xF4, 0x8E, 0x3E, 0xA2, 0x8E,
-    0x74, 0xED, 0xB9, 0x92, 0x66, 0x42, 0xDE, 0x01, 0x6E, 0x4B, 0xB7, 0x5E, 0x2C, 0xE9, 0x0C, 0x6C,
-    0xAB, 0xC8, 0x7A, 0x3E, 0x23, 0xC2, 0x9F, 0x7B, 0x9B, 0x1D, 0xB1, 0x97, 0x84, 0xE4, 0xEE, 0xA5,
-    0x73, 0x8C, 0x6D, 0x4E, 0x5F, 0x6B, 0x03, 0x30, 0x87, 0x75, 0x30, 0x91, 0x8C, 0xEB, 0xB6, 0x66,
-    0xEE, 0xDC, 0x31, 0x6E, 0xB6, 0x1C, 0x5E, 0x60, 0xC3, 0xA0, 0xE1, 0xA6, 0xB5, 0x4D, 0xE4, 0xD6,
-    0xE4, 0xF5, 0xEF, 0xB1, 0x82, 0xF8, 0xC3, 0xB3, 0x6C, 0xA8, 0x22, 0x2D, 0x53, 0x04, 0x69, 0xDB,
-    0x3C, 0x43, 0x85, 0x4B, 0x5E, 0xC5, 0xD7, 0x9E, 0x18, 0xD7, 0x95, 0xA0, 0x9C, 0x20, 0x58, 0xE2,
-    0x34, 0xAA, 0x13, 0x73, 0x56, 0xFD, 0x93, 0xAA, 0x22, 0x1F, 0x9E, 0xFD, 0x32, 0xBB, 0x81, 0xB7,
-    0x0B, 0xA3, 0x38, 0x17, 0xA4, 0x45, 0x40, 0x55, 0xA7, 0xAB, 0x81, 0x5C, 0x6D, 0xCF, 0xD1, 0x78,
-    0x13, 0x57, 0x1A, 0xCF, 0x85, 0xCB, 0xD1, 0xB8, 0xB9, 0xD5, 0xCF, 0xC7, 0x4A, 0x14, 0xBA, 0x8A,
-    0xB9, 0x7F, 0x63, 0xD9, 0xC2, 0x31, 0xC3, 0x61, 0x35, 0xB3, 0x38, 0x6D, 0x81, 0xA0, 0x78, 0x98,
-    0x71, 0x71, 0xE5, 0xA0, 0xF1, 0x40, 0x74, 0x8C, 0xAE, 0x31, 0xF9, 0x1F, 0x8F, 0x6E, 0xAC, 0x12,
-    0x85, 0xD4, 0x0B, 0xD8, 0xE1, 0xE5, 0xB9, 0x0D, 0xFE, 0xE4, 0xC6, 0x17, 0x3A, 0xE3, 0x08, 0x87,
-    0x56, 0x76, 0x4D, 0xFE, 0xA3, 0xC4, 0xB4, 0x5B, 0xA0, 0xD3, 0xF6, 0x4D, 0x59, 0x2F, 0x12, 0x31,
-    0x02, 0x82, 0xFB, 0x48, 0x83, 0xF1, 0x0A, 0xD0, 0x1C, 0x67, 0x3A, 0x83, 0xFF, 0x27, 0x4A, 0x79,
-    0x1C, 0xAB, 0x33, 0xF7, 0x0C, 0xAB, 0x1D, 0xF5, 0xAD, 0x63, 0x70, 0x9C, 0xAF, 0xE3, 0xA1, 0x44,
-    0x47, 0x66, 0xD0, 0xE4, 0xBD, 0x46, 0xF9, 0x2A, 0xC1, 0x18, 0x57, 0x78, 0xDA, 0x0B, 0x2A, 0x75,
-    0x10, 0xE7, 0x08, 0x79, 0x48, 0x0B, 0x2D, 0x50, 0xDE, 0x46, 0xD7, 0xC5, 0xF4, 0x4D, 0xF4, 0x5E,
-    0x99, 0x1A, 0x15, 0x3B, 0xBF, 0xB0, 0x47, 0x58, 0xCF, 0x23, 0x33, 0x22, 0x4F, 0xA7, 0xAF, 0x29,
-    0xF3, 0xE3, 0x05, 0x93, 0xBE, 0x35, 0xB2, 0x5D, 0x85, 0x45, 0x37, 0xE9, 0xEB, 0xA8, 0xD5, 0x72,
-    0x26, 0xBE, 0x2C, 0x76, 0x0D, 0xBD, 0xC7, 0x66, 0x3D, 0xE5, 0xE9, 0x69, 0xAB, 0x5D, 0x36, 0x7B,
-    0x18, 0x45, 0x88, 0x40, 0x47, 0xF2, 0x78, 0x5C, 0x81, 0x72, 0xED, 0xF8, 0x88, 0x81, 0x5B, 0xF1,
-    0x85, 0xD9, 0x57, 0x20, 0x83, 0xA3, 0x2E, 0xB6, 0x45, 0x28, 0xFA, 0x7D, 0xB4, 0x85, 0x47, 0x6D,
-    0xD8, 0xA7, 0x28, 0x8D, 0x2A, 0x2F, 0x58, 0xE6, 0x8F, 0x72, 0x94, 0x41, 0x95, 0xAF, 0xA3, 0x22,
-    0x06, 0x61, 0x1E, 0xC0, 0xE5, 0xEF, 0xA1, 0xC2, 0x20, 0x6A, 0xF1, 0x8B, 0x67, 0x11, 0x71, 0x10,
-    0xF6, 0x12, 0x20, 0xDD, 0x87, 0x8C, 0x79, 0x54, 0x16, 0xA8, 0x10, 0x21, 0x4B, 0x94, 0x6F, 0xF4,
-    0xA8, 0x65, 0x94, 0xE9, 0x6C, 0x40, 0x30, 0xAE, 0x4F, 0xDA, 0xC6, 0x05, 0xAB, 0xF7, 0x92, 0x26,
-    0xD6, 0x98, 0x69, 0x3E, 0xCF, 0x49, 0xD5, 0x64, 0x88, 0x83, 0xCC, 0x7C, 0xA0, 0x04, 0x41, 0xFC,
-    0x1B, 0xF9, 0x27, 0xE3, 0x79, 0x43, 0xD4, 0xE6, 0xC5, 0xB4, 0x18, 0x12, 0xD1, 0xF7, 0x36, 0x12,
-    0x4C, 0x9B, 0x5E, 0x18, 0x02, 0x91, 0x4C, 0xF9, 0x4B, 0xD8, 0xA6, 0x75, 0x7A, 0xB4, 0x0B, 0xFB,
-    0xE8, 0x23, 0x59, 0xC8, 0x11, 0x2C, 0x68, 0x27, 0xEF, 0xD7, 0xB4, 0x35, 0x39, 0xB1, 0xDB, 0x42,
-    0xFE, 0x83, 0x1A, 0x89, 0xF8, 0x42, 0x9B, 0xA3, 0x86, 0xA5, 0x2B, 0x00, 0xF3, 0xED, 0xFF, 0xB4,
-    0x9D, 0x43, 0x50, 0x1C, 0x74, 0xFD, 0xD4, 0x5D, 0xA9, 0x88, 0x3A, 0xC9, 0x0E, 0x00, 0xC1, 0xB1,
-    0x5F, 0x92, 0x3B, 0x95, 0xB0, 0x13, 0xCD, 0x12, 0xC6, 0xFE, 0xBE, 0x3B, 0xB3, 0x26, 0x9E, 0xA4,
-    0xA3, 0x47, 0xC4, 0x64, 0x4B, 0x86, 0x9D, 0x96, 0xD5, 0x47, 0x0A, 0x4E, 0xE9, 0xD6, 0x69, 0xDB,
-    0xC2, 0x03, 0x66, 0x59, 0xCC, 0x95, 0xC8, 0x9A, 0x04, 0x9B, 0x40, 0xAC, 0x04, 0x7A, 0x9C, 0x19,
-    0x4B, 0x9B, 0x8B, 0x87, 0xCD, 0x6A, 0x2E, 0x71, 0xC5, 0x6A, 0xDB, 0xE1, 0xA9, 0x10, 0x05, 0x58,
-    0xA1, 0x7A, 0x5F, 0xFC, 0x45, 0x57, 0xCE, 0x15, 0x69, 0x29, 0x2D, 0x4A, 0x03, 0x58, 0xD1, 0x12,
-    0x0C, 0x68, 0xB5, 0x40, 0x7D, 0x08, 0x0A, 0x03, 0xF0, 0xF2, 0x77, 0x45, 0x0F, 0x76, 0x3E, 0xC6,
-    0x41, 0x25, 0xD7, 0xA0, 0x05, 0x5D, 0x7D, 0x59, 0x24, 0xC2, 0x6F, 0x6A, 0xAF, 0xFE, 0x91, 0x3E,
-    0x2D, 0x86, 0xD5, 0x27, 0x67, 0xCB, 0x0E, 0x3B, 0x85, 0x50, 0xBB, 0x43, 0x52, 0xB4, 0x8F, 0x8A,
-    0x6D, 0x54, 0xEF, 0xA2, 0xAA, 0x9C, 0xE1, 0xAC, 0x12, 0x47, 0x24, 0x04, 0x6C, 0x32, 0x4C, 0x11,
-    0x87, 0x46, 0xE6, 0x34, 0x69, 0x11, 0x86, 0xCE, 0x51, 0xB6, 0x68, 0x50, 0xC1, 0x2D, 0xA4, 0xD1,
-    0xF6, 0x2A, 0x72, 0x94, 0x52, 0xF4, 0xE6, 0xA3, 0x0D, 0xC2, 0xDB, 0x46, 0x33, 0x34, 0xBF, 0xA1,
-    0xBD, 0x3C, 0xAA, 0x6D, 0xBD, 0x1F, 0x98, 0x1F, 0x22, 0x0D, 0xF4, 0x4B, 0xC1, 0x91, 0x3B, 0x76,
-    0x40, 0x21, 0x34, 0x8A, 0xD7, 0xEA, 0x44, 0x56, 0x1A, 0xB5, 0xAC, 0x3A, 0xCB, 0x9F, 0x1B, 0xD9,
-    0xDD, 0x26, 0xEA, 0x44, 0x93, 0x3E, 0xE9, 0x76, 0xC5, 0xDB, 0xF2, 0xA4, 0x8C, 0x52, 0x4F, 0x28,
-    0xE0, 0x0E, 0x31, 0xA8, 0x33, 0xB9, 0xD3, 0x5C, 0x52, 0x97, 0x93, 0x03, 0x86, 0xC3, 0xB1, 0x27,
-    0x6B, 0x9B, 0xC7, 0xCD, 0xDD, 0x5C, 0x73, 0x34, 0xF3, 0x87, 0x5C, 0xF7, 0xB8, 0xFD, 0xEB, 0xDF,
-    0xF3, 0x9A, 0x63, 0x3D, 0x89, 0xAE, 0xA5, 0xAB, 0xFB, 0xE9, 0x6B, 0xBE, 0x9F, 0x1A, 0xE6, 0xFE,
-    0x41, 0x1B, 0xE6, 0x7A, 0x6D, 0x98, 0x53, 0xE4, 0x55, 0xAE, 0xF6, 0x0A, 0xB9, 0xA0, 0x84, 0x83,
-    0x5D, 0x8E, 0x7F, 0x95, 0x63, 0xF7, 0xDF, 0xBD, 0xD2, 0xBA, 0x07, 0x51, 0x5A, 0xB7, 0xCD, 0xD2,
-    0xBA, 0x1A, 0xA5, 0x75, 0xF0, 0x5B, 0x73, 0x94, 0xBE, 0x79, 0x49, 0x36, 0x47, 0x11, 0xB4, 0xFA,
-    0x6A, 0x9C, 0xC3, 0x08, 0x1A, 0x4B, 0x38, 0xA4, 0x31, 0x9B, 0x5A, 0x13, 0x67, 0x03, 0x29, 0x8B,
-    0xB3, 0x9E, 0x26, 0x33, 0xA4, 0x97, 0x20, 0xBF, 0xF1, 0x85, 0x31, 0x16, 0x5C, 0xED, 0x75, 0xE9,
-    0xAB, 0x1D, 0xCA, 0x4A, 0x82, 0xE1, 0xDB, 0xC4, 0xE6, 0xE8, 0x59, 0x1A, 0x54, 0xF9, 0x11, 0xB7,
-    0x64, 0xFC, 0x31, 0x66, 0xA3, 0x09, 0xE3, 0x0D, 0xB0, 0xE3, 0x49, 0xC3, 0x1F, 0x7D, 0x77, 0xEC,
-    0x1B, 0x52, 0x40, 0x5A, 0x67, 0x75, 0xA7, 0x21, 0xB4, 0x82, 0xC3, 0x63, 0x6B, 0x12, 0xDB, 0x28,
-    0xB5, 0x27, 0x6B, 0xD2, 0x13, 0x39, 0x74, 0xAF, 0x96, 0x5D, 0x58, 0x69, 0xB1, 0x27, 0xDA, 0xE3,
-    0x0E, 0xA6, 0x09, 0x5D, 0x00, 0xE5, 0x95, 0x65, 0xC2, 0xDA, 0x2C, 0x4E, 0x9F, 0xE6, 0xD9, 0x1A,
-    0x95, 0x16, 0x1E, 0x78, 0xBB, 0x81, 0xDF, 0xBB, 0x95, 0x2A, 0xFD, 0x6D, 0x2B, 0x0F, 0xBF, 0xA0,
-    0x2E, 0xC4, 0x9E, 0xBB, 0xCE, 0x6C, 0x10, 0x5F, 0xD1, 0x52, 0x56, 0xB5, 0x09, 0x4A, 0xD5, 0x71,
-    0x37, 0x8D, 0x13, 0x15, 0xAE, 0x85, 0x4D, 0x6B, 0xB6, 0x85, 0x57, 0x43, 0xA0, 0x8B, 0x87, 0x40,
-    0x1E, 0x96, 0x5B, 0x44, 0x28, 0x73, 0xCE, 0x8B, 0xA4, 0x41, 0xD9, 0x60, 0xC6, 0x42, 0xC9, 0xE4,
-    0x86, 0x1A, 0x5C, 0xF1, 0xF1, 0xDF, 0x9B, 0xE6, 0x82, 0xD9, 0xF4, 0x02, 0xD2, 0x16, 0xA5, 0x2B,
-    0x62, 0x8A, 0x71, 0xE7, 0xF4, 0x25, 0x38, 0x57, 0xE3, 0xCC, 0x9D, 0xE4, 0x53, 0x44, 0x4B, 0xB4,
-    0x7F, 0xA3, 0x62, 0xE8, 0x52, 0x68, 0x24, 0x98, 0xCF, 0xA2, 0x8C, 0xA6, 0xCF, 0x01, 0xB3, 0x91,
-    0x43, 0x09, 0x18, 0x88, 0x65, 0x0C, 0xD6, 0x3D, 0xE2, 0x7F, 0xFF, 0xAD, 0x08, 0x49, 0x83, 0xEF,
-    0xC6, 0xA8, 0x74, 0x7F, 0x58, 0x68, 0x15, 0x8D, 0xCF, 0xA0, 0x17, 0xDD, 0x4E, 0x50, 0x2C, 0x44,
-    0x01, 0x9E, 0xA2, 0xE3, 0xF5, 0x0E, 0x7A, 0xD6, 0x6B, 0x31, 0x89, 0x45, 0x83, 0x47, 0xFF, 0x92,
-    0xEB, 0x04, 0x2E, 0x76, 0x6D, 0x29, 0x05, 0xDA, 0xEA, 0x79, 0x81, 0x98, 0xF3, 0x53, 0x70, 0x87,
-    0x05, 0x71, 0x3D, 0x86, 0x62, 0x51, 0x21, 0x40, 0xD2, 0xF8, 0xC4, 0x5E, 0x78, 0xCA, 0xFF, 0x65,
-    0xDC, 0x2E, 0xC6, 0xEF, 0x94, 0x55, 0x78, 0x4D, 0x96, 0x2C, 0x04, 0xE8, 0x1C, 0x01, 0x10, 0x07,
-    0xF5, 0x05, 0x32, 0x9A, 0xAF, 0xA4, 0x97, 0x0A, 0xF3, 0x57, 0x76, 0xDB, 0x39, 0xA0, 0x54, 0xBA,
-    0x34, 0xD7, 0xFB, 0xE6, 0xAC, 0x13, 0xCB, 0x96, 0x96, 0x59, 0xDB, 0x5B, 0xE6, 0xE3, 0xDB, 0xDD,
-    0x83, 0xCD, 0xFC, 0xE9, 0x81, 0x97, 0x55, 0x76, 0x55, 0x56, 0x10, 0x5C, 0xFB, 0x40, 0x11, 0x7A,
-    0xCA, 0xF3, 0xD4, 0xD2, 0xE5, 0x79, 0x6A, 0xCB, 0xC3, 0xD4, 0x1A, 0x77, 0x9E, 0x5A, 0x8E, 0xE3,
-    0x2C, 0xF1, 0xDF, 0xE2, 0x3C, 0xB5, 0x00, 0xE7, 0xA9, 0xA1, 0x4B, 0xDB, 0x9D, 0xA7, 0x76, 0x87,
-    0xA2, 0x94, 0x5B, 0x0A, 0x7F, 0xFE, 0x99, 0xFC, 0x86, 0x93, 0x03, 0xAE, 0x22, 0x95, 0xF8, 0x8E,
-    0xED, 0xBC, 0x69, 0x84, 0xE3, 0x57, 0xA1, 0x26, 0x1E, 0x45, 0x29, 0xF5, 0x5C, 0x94, 0xD2, 0xCD,
-    0x45, 0x29, 0xD3, 0x67, 0x2E, 0x4A, 0xD9, 0x74, 0x47, 0x4E, 0x30, 0x80, 0xE2, 0x72, 0x05, 0x72,
-    0x87, 0x0C, 0x50, 0xE4, 0x55, 0x48, 0x57, 0x34, 0xE4, 0x47, 0x90, 0x60, 0x7E, 0xBD, 0xE5, 0x59,
-    0x03, 0x96, 0x3E, 0xE1, 0xEB, 0xD8, 0x4E, 0x71, 0xAC, 0xB6, 0xC7, 0xCD, 0xC7, 0xED, 0x51, 0x6D,
-    0xE1, 0x0C, 0x55, 0x7F, 0x04, 0xF6, 0x34, 0x94, 0x80, 0x4A, 0x81, 0x3B, 0x1A, 0x8E, 0xF9, 0x20,
-    0x06, 0x9A, 0x16, 0x19, 0x81, 0x23, 0xC2, 0x5E, 0x0D, 0xD3, 0xD5, 0xF6, 0xFD, 0xB2, 0x33, 0x7A,
-    0x46, 0x93, 0xD1, 0x8E, 0x3A, 0x43, 0x6F, 0xDF, 0xF5, 0xD5, 0x2B, 0x38, 0x24, 0x0B, 0xA3, 0xC2,
-    0xCF, 0x24, 0xEF, 0x8B, 0xFB, 0x33, 0xFA, 0xC3, 0xB7, 0xA2, 0x26, 0x7E, 0xAF, 0x15, 0x14, 0x17,
-    0x9F, 0xE8, 0xC3, 0xEE, 0xD9, 0xE4, 0x0D, 0x7B, 0x64, 0xB4, 0x68, 0x08, 0xD2, 0xB4, 0xBB, 0x26,
-    0x62, 0x4E, 0xA2, 0x33, 0xA0, 0x60, 0x9D, 0x1F, 0x85, 0x90, 0x85, 0x7E, 0xAC, 0xF5, 0xF0, 0xB2,
-    0xFB, 0x7D, 0xF5, 0x2E, 0xA8, 0xA0, 0x31, 0x05, 0x57, 0xCE, 0x9B, 0xAF, 0x06, 0x14, 0x34, 0x9E,
-    0xE0, 0xEF, 0x39, 0x79, 0xE6, 0x5E, 0x90, 0x4A, 0xD5, 0x45, 0x35, 0x5B, 0xD6, 0x7E, 0xB6, 0xAA,
-    0xA8, 0x01, 0x5D, 0xCA, 0xD3, 0x3D, 0x3E, 0xB1, 0xD3, 0xAC, 0xD6, 0x7C, 0x06, 0xB3, 0xF5, 0xF1,
-    0xE7, 0x78, 0xCB, 0xDC, 0xFE, 0x6B, 0x7F, 0xDA, 0xCD, 0x98, 0xBF, 0x9F, 0xCF, 0x52, 0xB9, 0x7C,
-    0x87, 0x32, 0x80, 0xE3, 0x73, 0x2D, 0xB4, 0x15, 0x2C, 0x4D, 0xB0, 0x91, 0xA3, 0x30, 0x17, 0xB8,
-    0x4E, 0x4C, 0x54, 0x8E, 0x44, 0x3F, 0xAA, 0xE8, 0xE1, 0x9E, 0x6E, 0x17, 0x26, 0xA3, 0xAF, 0x57,
-    0x01, 0x8D, 0x15, 0x69, 0xC5, 0x70, 0x5B, 0xD0, 0xC6, 0xAD, 0x76, 0x22, 0x0F, 0xA2, 0x88, 0x69,
-    0x0A, 0x93, 0xA3, 0x63, 0xD8, 0xE8, 0x16, 0x59, 0xDD, 0xA5, 0xC5, 0x7C, 0xD6, 0xAF, 0xA6, 0xC9,
-    0x38, 0xA3, 0x97, 0x76, 0xDC, 0x19, 0x05, 0x27, 0xC6, 0xC8, 0xE5, 0x35, 0xAD, 0xAB, 0xC3, 0x12,
-    0x60, 0x4F, 0x55, 0x2C, 0xE8, 0x4E, 0xE3, 0xE1, 0xA5, 0x38, 0xA5, 0xCC, 0x75, 0x59, 0xCE, 0xA4,
-    0x65, 0x05, 0x2B, 0x05, 0xD8, 0x43, 0xA8, 0xF0, 0xB2, 0xC7, 0x22, 0x28, 0x74, 0xFA, 0x25, 0x6C,
-    0x0A, 0xA6, 0x87, 0x99, 0xB9, 0x88, 0xE2, 0xBE, 0x9B, 0x96, 0x7C, 0x52, 0x5D, 0xB1, 0x07, 0xD5,
-    0xE0, 0x28, 0x34, 0xCA, 0x9F, 0xDB, 0x53, 0x38, 0x11, 0xBB, 0xD8, 0xC0, 0xA1, 0xD5, 0xFA, 0x89,
-    0xA7, 0x45, 0x51, 0x79, 0xA7, 0x40, 0x1F, 0x14, 0xD3, 0x08, 0xEE, 0x49, 0xB3, 0x12, 0xCE, 0x57,
-    0xD0, 0x0A, 0xC0, 0x3B, 0xBF, 0xD5, 0x96, 0x41, 0xF7, 0x8D, 0x40, 0xDC, 0xD3, 0x86, 0xA5, 0x54,
-    0x1F, 0x8D, 0xB4, 0x6B, 0xA5, 0x48, 0x09, 0xE1, 0xDE, 0x68, 0xDD, 0xD9, 0xBA, 0x5A, 0x5E, 0xC2,
-    0x58, 0x82, 0x37, 0xE4, 0xDB, 0x34, 0x40, 0x8F, 0xED, 0x8C, 0x26, 0x3B, 0x10, 0x36, 0x36, 0x6E,
-    0xBF, 0xED, 0xFF, 0x12, 0xE5, 0x98, 0xDB, 0x4D, 0x09, 0xB7, 0x57, 0x0C, 0xBB, 0xA8, 0xB5, 0x2A,
-    0x47, 0x54, 0xC3, 0xE7, 0x61, 0x16, 0x68, 0xD6, 0x9C, 0x0F, 0x97, 0xF8, 0x9D, 0xCF, 0x1B, 0x7A,
-    0xDB, 0x9D, 0x37, 0x34, 0xB9, 0x78, 0x0E, 0xE6, 0xB2, 0x53, 0x2A, 0x47, 0x22, 0x55, 0x13, 0xEA,
-    0x89, 0x90, 0x2E, 0x5C, 0xC3, 0xB3, 0x3C, 0x8D, 0xC6, 0x59, 0xA0, 0xEA, 0xA3, 0x41, 0xA3, 0xE9,
-    0x68, 0xA4, 0x44, 0x68, 0x88, 0x41, 0xE4, 0x91, 0x67, 0xB9, 0xBA, 0x98, 0x8A, 0x92, 0x91, 0x78,
-    0x36, 0x50, 0x1F, 0x32, 0x3F, 0xEB, 0x6E, 0xA9, 0xD1, 0x08, 0xF2, 0xE7, 0xE2, 0xE7, 0xAE, 0x6C,
-    0x0A, 0x59, 0x89, 0x60, 0x40, 0x25, 0xCF, 0xDF, 0x95, 0x4D, 0x3A, 0x2C, 0xA6, 0xF0, 0x52, 0x96,
-    0xBE, 0x81, 0x83, 0x50, 0x45, 0xE6, 0xF2, 0x0B, 0x48, 0x0D, 0x9F, 0x53, 0xF3, 0x18, 0xF1, 0xC8,
-    0x8C, 0xC7, 0x6D, 0x01, 0xEF, 0x6E, 0x81, 0x0E, 0x51, 0x04, 0x4E, 0x71, 0xF8, 0x5A, 0x8D, 0x74,
-    0xA5, 0x20, 0x9E, 0xDD, 0x48, 0x75, 0x46, 0xA0, 0xF1, 0xA7, 0x02, 0x39, 0x82, 0x6B, 0x38, 0xE0,
-    0x94, 0x27, 0x1A, 0xF7, 0xCC, 0xFF, 0xDE, 0xF3, 0xD3, 0x90, 0x9A, 0xCF, 0x7B, 0x1A, 0x52, 0xAF,
-    0xA7, 0x21, 0x8D, 0xC6, 0x75, 0x83, 0x82, 0x79, 0x5D, 0x65, 0xAF, 0xCB, 0xED, 0xB8, 0xAA, 0x37,
-    0x87, 0x45, 0x4B, 0x57, 0x1B, 0xBE, 0xC2, 0xDA, 0x5A, 0xD5, 0x9A, 0x00, 0x6D, 0x45, 0x1A, 0xA0,
-    0xA3, 0x6A, 0x41, 0x37, 0x5F, 0xD8, 0x40, 0xAE, 0x06, 0x56, 0x4C, 0x57, 0xC8, 0x15, 0xB3, 0x9D,
-    0x2F, 0x85, 0xF7, 0x83, 0x38, 0x8A, 0xA0, 0x30, 0xF6, 0x28, 0x55, 0xF9, 0xAB, 0x1E, 0xCE, 0xB4,
-    0x7D, 0xE6, 0x11, 0x71, 0xAB, 0xB6, 0x2F, 0xA0, 0x41, 0x82, 0x0D, 0x7D, 0x48, 0x55, 0x05, 0x42,
-    0x78, 0x91, 0xA9, 0x67, 0xE7, 0x50, 0x86, 0xBB, 0x77, 0xBA, 0x8B, 0x84, 0xFF, 0xE7, 0xDE, 0x12,
-    0xA3, 0xFB, 0x30, 0x80, 0x2D, 0x5B, 0xA6, 0xB5, 0x4F, 0x99, 0x96, 0x6C, 0xB7, 0x7B, 0x0E, 0x36,
-    0xD5, 0x33, 0x5B, 0xFF, 0x9D, 0x46, 0x3B, 0xE2, 0x2B, 0xD6, 0xEC, 0x32, 0xAC, 0xAC, 0x41, 0xAF,
-    0xFD, 0xE7, 0xA7, 0x5C, 0xE4, 0xF5, 0x51, 0x74, 0x13, 0x22, 0x7E, 0xFD, 0x41, 0xD9, 0xB2, 0xB7,
-    0x06, 0x2D, 0x2F, 0xA1, 0x36, 0x95, 0xE5, 0x6F, 0x3F, 0xC9, 0xA6, 0x78, 0xA4, 0x35, 0xDB, 0xE8,
-    0xFA, 0x19, 0x78, 0xA9, 0x69, 0x83, 0x58, 0x1F, 0x4F, 0x5D, 0x44, 0x9C, 0x8F, 0xA1, 0x6E, 0xC4,
-    0xF8, 0x5C, 0x37, 0x66, 0x3C, 0xD7, 0xC3, 0x0A, 0xFB, 0xFE, 0xA9, 0xEC, 0x7B, 0x70, 0xCD, 0x1A,
-    0x57, 0xFF, 0xDE, 0x39, 0x8E, 0xFD, 0x83, 0x4B, 0x0B, 0xCC, 0xC7, 0x78, 0x16, 0xAB, 0x5C, 0xBC,
-    0x98, 0x5F, 0x55, 0x0D, 0x1B, 0x55, 0xBB, 0x75, 0x31, 0xBF, 0x63, 0x5A, 0xE0, 0x00, 0xD2, 0x02,
-    0xCF, 0x2C, 0xD3, 0x02, 0x6C, 0x80, 0xEC, 0xCB, 0x42, 0xCF, 0xF2, 0x39, 0xB6, 0x5B, 0x86, 0x55,
-    0xCC, 0x5C, 0x7B, 0x6E, 0x85, 0x69, 0xBF, 0xB8, 0x43, 0x5A, 0x56, 0x8F, 0x3F, 0x57, 0xEC, 0x3D,
-    0xEC, 0xA6, 0xE3, 0xD5, 0x99, 0xEF, 0x77, 0x5D, 0xF9, 0xFD, 0x66, 0xC9, 0x7F, 0xBF, 0xB1, 0x8B,
-    0x6C, 0xBC, 0x7D, 0x17, 0x99, 0xC3, 0xD5, 0x81, 0x75, 0xE7, 0x1C, 0xB1, 0x84, 0xB6, 0x75, 0x9E,
-    0x18, 0xCC, 0x03, 0x05, 0x1B, 0xD5, 0x6A, 0xC4, 0x15, 0xFB, 0xFE, 0xC0, 0xCE, 0x64, 0xEB, 0xDD,
-    0x99, 0x6C, 0x38, 0x46, 0x68, 0xA6, 0xEE, 0x0A, 0xFF, 0xA9, 0x53, 0xBC, 0x92, 0xA6, 0x9A, 0xD9,
-    0x74, 0x66, 0x4C, 0x33, 0x3F, 0x23, 0x61, 0x7E, 0x6F, 0x9A, 0x97, 0x0F, 0xB0, 0x79, 0xF9, 0xDD,
-    0xF7, 0xB4, 0x79, 0xF9, 0x45, 0x36, 0x2F, 0x8F, 0xDA, 0xBC, 0xDC, 0xB2, 0x79, 0xD9, 0x56, 0x6C,
-    0x5E, 0x3E, 0xB7, 0x5A, 0xE2, 0x98, 0x64, 0x2B, 0x0A, 0xDF, 0x89, 0xCD, 0xC3, 0xBB, 0xD5, 0xF2,
-    0xA7, 0x4F, 0x6B, 0xDC, 0x41, 0x39, 0xD0, 0x9D, 0xA4, 0x92, 0xBA, 0xE8, 0x5E, 0x30, 0xB8, 0x13,
-    0xAC, 0x3E, 0xFF, 0x8B, 0xB1, 0x7B, 0xF1, 0x30, 0xF2, 0x40, 0x4C, 0x9A, 0xCF, 0x07, 0xD2, 0xE8,
-    0xD9, 0x11, 0x3E, 0x5C, 0x87, 0x8E, 0x62, 0x24, 0xB6, 0x90, 0xDA, 0x74, 0xAB, 0xD9, 0xF5, 0x2C,
-    0xF3, 0xF1, 0x56, 0xE8, 0xA9, 0xCE, 0x87, 0xA3, 0xBB, 0x86, 0xC3, 0x58, 0x1E, 0xE2, 0x52, 0x15,
-    0x2E, 0x87, 0x11, 0x6F, 0xB3, 0x12, 0x77, 0x47, 0x93, 0x6B, 0xDC, 0xBD, 0x08, 0x15, 0xD4, 0xF2,
-    0x46, 0x77, 0x08, 0x2B, 0x0F, 0xB7, 0xA6, 0x6D, 0x5E, 0x68, 0x26, 0x39, 0x7D, 0xFB, 0xFB, 0xA3,
-    0x2B, 0xCB, 0x32, 0x73, 0x79, 0xD9, 0x07, 0xA7, 0xCB, 0x16, 0xB5, 0x4B, 0x58, 0x94, 0xD5, 0x8C,
-    0x14, 0xFE, 0x58, 0x1C, 0x9E, 0x60, 0x78, 0x1F, 0xE3, 0x99, 0x20, 0x83, 0x46, 0x04, 0xAB, 0x15,
-    0xA4, 0xE8, 0xB5, 0xA6, 0x51, 0x90, 0xE8, 0xBB, 0xD2, 0x51, 0x6D, 0xB3, 0x5A, 0x85, 0x86, 0xF7,
-    0xFA, 0x5C, 0x8E, 0x83, 0xC4, 0xB1, 0x51, 0x53, 0xD2, 0x0E, 0x69, 0x60, 0xE3, 0x12, 0xCB, 0x99,
-    0xFA, 0xDB, 0x94, 0x06, 0xDF, 0xE7, 0x54, 0xF5, 0x06, 0x01, 0x09, 0xFE, 0x98, 0xA0, 0x84, 0x82,
-    0xE7, 0x09, 0x20, 0x03, 0x90, 0xED, 0x85, 0xE8, 0xF7, 0x9A, 0xA0, 0xCB, 0xD4, 0x6C, 0x3A, 0x7B,
-    0x23, 0x5B, 0xF3, 0x81, 0xFE, 0xB6, 0x5B, 0x23, 0xB1, 0xCE, 0x5B, 0x67, 0x25, 0x2E, 0xBA, 0x83,
-    0x77, 0xAF, 0x4E, 0xAA, 0x73, 0xC7, 0xC4, 0xC1, 0xAF, 0x13, 0x4A, 0x61, 0x81, 0x4D, 0x5C, 0xD9,
-    0x62, 0xAE, 0x54, 0xCE, 0x33, 0x07, 0xA7, 0x1B, 0xAD, 0x3D, 0xF0, 0xDD, 0x67, 0x76, 0x68, 0x3A,
-    0x53, 0x13, 0x31, 0x5A, 0x49, 0x3E, 0x6E, 0xE6, 0xB5, 0x79, 0x86, 0xF5, 0xA2, 0x23, 0xEE, 0x26,
-    0x03, 0xE5, 0x95, 0x37, 0x40, 0x3D, 0xA3, 0xE4, 0x4F, 0xFC, 0x31, 0x9E, 0xB5, 0xDB, 0xFB, 0xA8,
-    0x35, 0xD2, 0x73, 0x09, 0xEA, 0xD4, 0x8D, 0xF2, 0x74, 0x86, 0x04, 0x5E, 0x6E, 0x9F, 0x77, 0x15,
-    0xB5, 0x20, 0x71, 0x69, 0x7F, 0x2A, 0xEA, 0xBF, 0x48, 0x1B, 0xD1, 0x26, 0x38, 0x55, 0x04, 0x65,
-    0x0E, 0x65, 0x56, 0x22, 0x2F, 0xD2, 0x26, 0x02, 0x3B, 0x50, 0x5A, 0x8F, 0xB3, 0x0E, 0xAE, 0x8C,
-    0x3C, 0x59, 0x86, 0xA9, 0x57, 0x1E, 0x70, 0xD3, 0xA4, 0xA3, 0xD9, 0x8F, 0xAA, 0xD6, 0xC6, 0x6F,
-    0xD3, 0x8F, 0xAF, 0xDB, 0xFF, 0x02, 0x80, 0x11, 0xB1, 0xD6, 0xB3, 0x2A, 0xE1, 0xA1, 0x0B, 0x52,
-    0xBA, 0xCC, 0x3A, 0x9E, 0x3D, 0xE5, 0xE4, 0x10, 0xF9, 0x67, 0x71, 0x42, 0xF0, 0x62, 0xF0, 0x50,
-    0x59, 0x35, 0x96, 0xC5, 0x9C, 0x7F, 0x8C, 0x6F, 0x5B, 0x78, 0x7E, 0x7F, 0x7C, 0xDC, 0x8C, 0x2B,
-    0x0A, 0xFF, 0xDF, 0xA2, 0xAB, 0x72, 0x21, 0x7F, 0x52, 0x3F, 0xAB, 0x05, 0x6A, 0xE8, 0x32, 0xF0,
-    0x8E, 0xCF, 0x7A, 0xF4, 0xA4, 0x7E, 0x04, 0x04, 0x96, 0x5F, 0xFE, 0x74, 0xC0, 0xAE, 0x0A, 0xE2,
-    0xCE, 0x8B, 0x04, 0x1D, 0x5E, 0x4D, 0x52, 0x07, 0x5D, 0x2E, 0xA0, 0x44, 0xE6, 0xC3, 0x83, 0x84,
-    0x58, 0xCC, 0x61, 0xBE, 0x8E, 0x38, 0x93, 0xB1, 0x6F, 0xE3, 0xDC, 0x28, 0xDA, 0xDB, 0x42, 0x7B,
-    0x06, 0x36, 0xE6, 0x93, 0x83, 0x09, 0xE4, 0x16, 0xF3, 0x69, 0x4C, 0x2D, 0x7C, 0xAC, 0xC9, 0x9C,
-    0x47, 0x31, 0xE2, 0x57, 0x5C, 0x74, 0x44, 0xD3, 0x1D, 0x76, 0xF7, 0x34, 0xA9, 0x61, 0x6D, 0x73,
-    0xF3, 0xFB, 0x96, 0xC0, 0xEC, 0x05, 0xCB, 0x4E, 0x09, 0x2C, 0x03, 0xD6, 0x0F, 0x1F, 0xDA, 0x11,
-    0x4E, 0x31, 0x30, 0x5A, 0x80, 0xD2, 0xED, 0x23, 0x28, 0x55, 0x29, 0x70, 0x7A, 0x13, 0x17, 0x5C,
-    0x68, 0x19, 0x9D, 0xE6, 0x7B, 0xD7, 0xD4, 0x66, 0xFC, 0x0C, 0xCC, 0x57, 0x20, 0xDB, 0x1B, 0x4C,
-    0x65, 0x17, 0x09, 0xFC, 0x8C, 0xB2, 0x60, 0xF0, 0xC0, 0x6D, 0xDA, 0xA4, 0x2A, 0xB2, 0xF5, 0xCB,
-    0x21, 0x18, 0x05, 0x33, 0xA0, 0x43, 0xB5, 0x8A, 0x9B, 0x54, 0xBC, 0xFC, 0xBC, 0x92, 0x61, 0xAF,
-    0x4C, 0x0C, 0x26, 0x30, 0x12, 0xB2, 0xA1, 0x4A, 0x49, 0x9E, 0xD2, 0x57, 0x99, 0x98, 0x44, 0x40,
-    0x10, 0xC2, 0xEC, 0x0D, 0xCB, 0x82, 0x48, 0xB3, 0x74, 0x9F, 0x17, 0xEE, 0x93, 0x17, 0x98, 0xD8,
-    0xE7, 0x19, 0x62, 0x65, 0xBF, 0xC0, 0x48, 0x28, 0x7F, 0xD7, 0x02, 0xC6, 0x7E, 0xD9, 0x57, 0xE1,
-    0x56, 0x7E, 0x68, 0x73, 0x73, 0x8B, 0x59, 0xCA, 0x89, 0xBC, 0xFD, 0x22, 0x1E, 0xDE, 0x02, 0xA7,
-    0x5E, 0xC5, 0xE9, 0x65, 0x7D, 0x8E, 0x6E, 0x0A, 0xF8, 0x9F, 0x23, 0xF2, 0x03, 0xC2, 0xC4, 0x97,
-    0xB7, 0xAC, 0x8A, 0x95, 0x1E, 0x67, 0x1D, 0x33, 0xDA, 0x71, 0x68, 0x59, 0x80, 0xF9, 0x1C, 0x5A,
-    0xD8, 0x45, 0x16, 0x7E, 0x2C, 0xDF, 0x0C, 0xE3, 0xEC, 0x32, 0xE7, 0x5D, 0xA5, 0x09, 0x82, 0x89,
-    0x07, 0xE6, 0xCA, 0x50, 0xD7, 0xE4, 0xC8, 0x7D, 0x52, 0xEF, 0x62, 0xAE, 0x33, 0x38, 0x1F, 0x74,
-    0xB7, 0x8F, 0xC5, 0xB8, 0x6D, 0xDA, 0x80, 0x00, 0xE4, 0xC0, 0x4F, 0x68, 0x13, 0x4A, 0xD0, 0x78,
-    0x2C, 0x7C, 0xD6, 0x05, 0xF6, 0x32, 0x70, 0xDA, 0x23, 0x0C, 0x02, 0x4F, 0xE2, 0x19, 0x46, 0x48,
-    0x65, 0x0E, 0xFB, 0x60, 0x07, 0xFC, 0x41, 0x61, 0x4B, 0xEA, 0x59, 0x4F, 0x23, 0xEB, 0x75, 0x59,
-    0xF0, 0x07, 0x74, 0x30, 0x9E, 0x57, 0x68, 0x1B, 0x75, 0xE9, 0x32, 0x13, 0x9C, 0xA9, 0x33, 0xE3,
-    0x30, 0x7A, 0xBC, 0x53, 0xFE, 0x4A, 0xD1, 0xA6, 0x6C, 0xA3, 0x2B, 0xA5, 0x66, 0xEB, 0x1F, 0xA4,
-    0x1A, 0x8D, 0x47, 0xEC, 0x8B, 0xF4, 0xD8, 0xA2, 0x88, 0x9D, 0x2B, 0x91, 0xB1, 0x40, 0x19, 0x66,
-    0xCA, 0x0F, 0x93, 0x88, 0x50, 0x0C, 0x80, 0x74, 0x58, 0x2C, 0x9A, 0xDF, 0x66, 0x7A, 0x0E, 0x46,
-    0x82, 0x36, 0x6F, 0xB8, 0x58, 0x28, 0x20, 0x14, 0x49, 0x75, 0x2A, 0x7E, 0x55, 0x2F, 0x08, 0xBF,
-    0x68, 0x62, 0xEC, 0x82, 0x2A, 0xC4, 0x41, 0x13, 0xAB, 0xDA, 0x7A, 0x79, 0x8B, 0x55, 0x98, 0xE5,
-    0xF2, 0x7E, 0x3A, 0xC5, 0xC8, 0x1C, 0x10, 0x73, 0x1B, 0x74, 0xA2, 0xB9, 0xD3, 0x37, 0xD1, 0x13,
-    0x20, 0x0A, 0xC8, 0xD7, 0x2A, 0xB4, 0xE5, 0x1A, 0x8F, 0x1B, 0x3D, 0xD1, 0xC9, 0xF2, 0x1C, 0x01,
-    0x44, 0xA8, 0xEA, 0x78, 0x30, 0xA8, 0x63, 0xF1, 0x51, 0xDF, 0x1D, 0x66, 0x84, 0x59, 0x1A, 0xE5,
-    0xAA, 0xCC, 0xDA, 0x93, 0x6C, 0x51, 0x65, 0x27, 0x48, 0x65, 0xD6, 0x79, 0x22, 0x0F, 0xCB, 0x5D,
-    0x59, 0x76, 0x90, 0xF4, 0x0B, 0xE8, 0xC5, 0x1F, 0x89, 0x50, 0x89, 0x37, 0x1F, 0x0F, 0xD1, 0xB8,
-    0x4E, 0x93, 0x30, 0xAA, 0x6E, 0x4C, 0xA8, 0xE0, 0xE6, 0x72, 0xCB, 0x85, 0xF6, 0x8B, 0xB7, 0xE4,
-    0xFB, 0x5B, 0xFA, 0xC5, 0x51, 0x1A, 0x12, 0x6A, 0x20, 0xA5, 0x08, 0x77, 0xF2, 0x16, 0x95, 0xB3,
-    0xE6, 0x07, 0xF4, 0x0A, 0xE0, 0xA8, 0x95, 0x05, 0x4B, 0x67, 0xD9, 0x93, 0x7B, 0xC6, 0xBA, 0x9C,
-    0x77, 0xD4, 0x07, 0xE2, 0x7F, 0x21, 0xFA, 0x85, 0x0E, 0xB9, 0x2C, 0xD1, 0xE6, 0x2B, 0x07, 0x39,
-    0x28, 0x7F, 0x2C, 0xA4, 0x62, 0xDA, 0x63, 0x31, 0xA1, 0x06, 0xE8, 0x3C, 0x84, 0x3B, 0xCD, 0xE4,
-    0x21, 0xD4, 0x38, 0x49, 0xB4, 0xFB, 0x30, 0xCC, 0x69, 0x60, 0xAD, 0xAB, 0x39, 0x6B, 0x97, 0x1D,
-    0x13, 0xF3, 0x47, 0xCD, 0x04, 0x38, 0xC6, 0x2D, 0x64, 0x6D, 0xCF, 0xC8, 0x43, 0x23, 0x2F, 0x6F,
-    0x41, 0x22, 0x59, 0xAB, 0xC9, 0xE3, 0x15, 0xC8, 0xBD, 0x07, 0x57, 0x3F, 0x22, 0x66, 0x70, 0x75,
-    0x1D, 0x78, 0xC0, 0x71, 0x63, 0x06, 0x65, 0x75, 0xA6, 0xDB, 0xED, 0x28, 0x66, 0x2A, 0x81, 0x26,
-    0x9B, 0x68, 0x47, 0x3F, 0xB7, 0x49, 0xEE, 0xB7, 0x60, 0x8B, 0xBB, 0xBF, 0x9B, 0xF7, 0xE4, 0x74,
-    0xF4, 0xA7, 0xE2, 0x4B, 0xB8, 0xFA, 0x59, 0x7E, 0x50, 0x0D, 0x3E, 0xA7, 0xAB, 0xDC, 0x29, 0x7B,
-    0xA5, 0x38, 0xC3, 0xC3, 0xDE, 0x79, 0x0D, 0xBB, 0x1C, 0x62, 0xAA, 0x98, 0x95, 0x59, 0xEA, 0x4A,
-    0xEA, 0x87, 0x51, 0x20, 0x0E, 0x7E, 0xA7, 0x2F, 0x1E, 0x3A, 0x08, 0x35, 0x82, 0x93, 0xA3, 0x6B,
-    0x2D, 0xFC, 0xE8, 0x96, 0x65, 0x60, 0xAE, 0xA6, 0x8C, 0xB1, 0x21, 0x3D, 0x9B, 0x38, 0x65, 0xE7,
-    0x94, 0x7E, 0xA6, 0x45, 0xDE, 0x04, 0xEC, 0xC5, 0x1A, 0xC9, 0x2A, 0xB2, 0xCC, 0xF2, 0x45, 0x9E,
-    0x80, 0x9C, 0x30, 0xAD, 0x64, 0x2F, 0x76, 0x1C, 0x02, 0x07, 0xE2, 0x1A, 0x3D, 0x03, 0x8D, 0x6D,
-    0x28, 0x95, 0xBA, 0xF4, 0x8D, 0x46, 0x05, 0xFA, 0x65, 0x54, 0xC0, 0x9D, 0xAA, 0xCA, 0xF3, 0xF4,
-    0xEC, 0x49, 0x70, 0x86, 0x9B, 0xD4, 0xB2, 0xD0, 0xEC, 0xDE, 0xE7, 0x34, 0x3F, 0xB5, 0x3D, 0x76,
-    0x4D, 0x37, 0xDA, 0x1F, 0x34, 0xFE, 0x95, 0xAB, 0xCE, 0x08, 0x9D, 0xCE, 0xC8, 0x67, 0x37, 0xEE,
-    0x8F, 0xE1, 0x18, 0x79, 0x55, 0x8C, 0xE8, 0x86, 0x54, 0x9D, 0x28, 0x0A, 0xE6, 0x16, 0x90, 0x7C,
-    0xAF, 0xE9, 0xED, 0xF1, 0x76, 0xFA, 0xA9, 0x7C, 0x68, 0xD8, 0x74, 0xC6, 0xD7, 0x29, 0x92, 0x3D,
-    0x5F, 0xF7, 0xE3, 0xD9, 0xE1, 0xCE, 0x3B, 0x3E, 0x07, 0x57, 0x43, 0xC4, 0xE6, 0x2D, 0x7C, 0x66,
-    0x9C, 0xE8, 0xE5, 0xBD, 0x16, 0xE5, 0x01, 0x7E, 0xCE, 0x97, 0x1E, 0xF1, 0x12, 0xD9, 0xB2, 0x5B,
-    0xF0, 0x0C, 0xC1, 0x2A, 0x82, 0x0B, 0x84, 0x2A, 0xB6, 0x70, 0xC0, 0xB9, 0x5D, 0x17, 0x70, 0x56,
-    0x05, 0x08, 0xAB, 0x67, 0x55, 0x34, 0x3C, 0x19, 0xA7, 0xAC, 0x12, 0x91, 0x2F, 0xCF, 0x1D, 0x48,
-    0x9B, 0x69, 0xC2, 0x60, 0xED, 0xD3, 0xE9, 0xF1, 0xC7, 0xD5, 0x8A, 0x7B, 0x17, 0x18, 0xE4, 0x0B,
-    0x25, 0xC8, 0xE7, 0x63, 0x10, 0xE0, 0x4C, 0x30, 0x08, 0xA2, 0xBA, 0x55, 0x38, 0x1F, 0xE8, 0x18,
-    0x0C, 0x89, 0x2B, 0xAA, 0xEB, 0xD3, 0xEB, 0xA7, 0xED, 0xD1, 0x11, 0xA7, 0x15, 0x09, 0xDD, 0x50,
-    0x67, 0x5F, 0x25, 0x6D, 0x7C, 0x7B, 0x06, 0xD9, 0x07, 0x02, 0x26, 0x15, 0x9B, 0x2C, 0xC5, 0x38,
-    0xE1, 0x30, 0x38, 0xF1, 0x2B, 0xC3, 0xE6, 0x16, 0x9A, 0x1D, 0x76, 0xC4, 0xD2, 0x23, 0x5C, 0x2B,
-    0xB4, 0x20, 0xF4, 0x06, 0xE3, 0x21, 0x1E, 0x68, 0x05, 0x3A, 0x68, 0xF1, 0x60, 0x68, 0x97, 0x4E,
-    0x03, 0x3E, 0xD2, 0xCC, 0x41, 0x6D, 0x82, 0x61, 0x16, 0x3F, 0xDA, 0xE5, 0x47, 0xDE, 0x09, 0x7E,
-    0xC8, 0x80, 0x9A, 0x91, 0xD7, 0xF4, 0x39, 0x10, 0xA0, 0x33, 0x3E, 0x84, 0xCE, 0xBA, 0xCF, 0x4A,
-    0x54, 0x12, 0xAD, 0x65, 0x2B, 0x04, 0x4A, 0xDF, 0xB5, 0xA4, 0x0F, 0x3E, 0x2A, 0x70, 0x95, 0x3C,
-    0x77, 0xF3, 0x78, 0x20, 0x67, 0x3B, 0x53, 0x22, 0x81, 0xDC, 0x9D, 0x54, 0xFE, 0xB3, 0x3F, 0x84,
-    0x4F, 0xD8, 0x72, 0x07, 0xBC, 0x93, 0xCB, 0x62, 0xC6, 0xC4, 0x36, 0x37, 0xF7, 0xFA, 0xBE, 0xF7,
-    0xD9, 0xE9, 0x70, 0x1E, 0x09, 0x9E, 0xBC, 0x3A, 0x2D, 0x8D, 0x68, 0x79, 0x61, 0xBC, 0xA3, 0x05,
-    0xBD, 0xFF, 0xE8, 0xED, 0xE2, 0xF4, 0x3E, 0x49, 0x44, 0xE3, 0xCB, 0x6E, 0xC4, 0x7A, 0x22, 0x1A,
-    0x37, 0xF7, 0x33, 0xE9, 0xDD, 0xD7, 0x83, 0xE6, 0x9B, 0x4C, 0xDC, 0x11, 0x1B, 0x1C, 0x83, 0xD2,
-    0x9B, 0x60, 0x03, 0xF3, 0x06, 0x45, 0xC6, 0x13, 0x2B, 0x11, 0x4F, 0xDD, 0xF4, 0x89, 0x81, 0xF7,
-    0xEB, 0x36, 0x2C, 0x70, 0x84, 0x86, 0xC9, 0x49, 0xB4, 0xAB, 0x58, 0xCF, 0xC0, 0xD0, 0x3E, 0x7F,
-    0x7F, 0x15, 0x83, 0xB5, 0x0F, 0xDE, 0xD7, 0x3B, 0xC2, 0xD0, 0x2A, 0x15, 0x3F, 0x6C, 0x18, 0xA2,
-    0xE5, 0x3F, 0x1E, 0xEE, 0x10, 0x57, 0xBD, 0x4F, 0xCE, 0xEF, 0x77, 0x11, 0x84, 0x96, 0xBB, 0xBA,
-    0xC0, 0x27, 0x25, 0xAB, 0xC1, 0x5D, 0xDD, 0x97, 0x7B, 0x73, 0xB8, 0xE0, 0x7D, 0xF1, 0x01, 0x6E,
-    0x2C, 0x0B, 0xD1, 0x10, 0x87, 0x3B, 0x51, 0xB2, 0x58, 0xA6, 0xF0, 0x34, 0x41, 0xB2, 0x9E, 0x99,
-    0xCF, 0x7F, 0xEE, 0xB3, 0xA7, 0xE7, 0x3E, 0xA3, 0x14, 0x55, 0x1C, 0xB2, 0x1B, 0x45, 0x32, 0x3D,
-    0x62, 0xBC, 0x23, 0x83, 0x16, 0x19, 0x81, 0xEB, 0x4A, 0x4D, 0x18, 0x61, 0xCA, 0x1B, 0xBB, 0x9C,
-    0x63, 0x66, 0xE6, 0x31, 0x33, 0xFA, 0x31, 0x8E, 0x85, 0xEE, 0x14, 0x9D, 0xBF, 0xF9, 0xC3, 0x75,
-    0xFF, 0xB8, 0x4E, 0xC8, 0xDF, 0xA3, 0x9D, 0xA1, 0x9E, 0x51, 0x62, 0xA6, 0x19, 0x8B, 0x88, 0x0A,
-    0xFA, 0x16, 0x0D, 0xFD, 0xC5, 0x9E, 0x96, 0xF8, 0x85, 0x1C, 0x43, 0x90, 0xB9, 0xF3, 0x72, 0x35,
-    0x56, 0xC9, 0xAC, 0xD9, 0xF2, 0x2C, 0x08, 0x36, 0x88, 0xBC, 0x3F, 0x2C, 0xB3, 0x35, 0x7A, 0xCA,
-    0xEC, 0x03, 0xD9, 0x6F, 0x71, 0x5C, 0x81, 0xA7, 0xC7, 0x15, 0x20, 0x76, 0x0C, 0x94, 0x2A, 0x5B,
-    0xF7, 0x52, 0xE5, 0x65, 0x29, 0x53, 0x87, 0xFB, 0x84, 0x33, 0x53, 0xC4, 0xAB, 0xBA, 0x95, 0xF6,
-    0x90, 0x2F, 0xA0, 0xC2, 0x3D, 0xD1, 0x13, 0x23, 0x5C, 0xA5, 0x76, 0xC9, 0x0A, 0x77, 0x9A, 0x34,
-    0x7E, 0xE6, 0x04, 0xA2, 0xF2, 0x37, 0xB5, 0x35, 0x63, 0xC4, 0xAF, 0xD0, 0x42, 0x9A, 0xF3, 0x5B,
-    0x6A, 0xC3, 0x5C, 0x82, 0xA0, 0x9B, 0x1B, 0xB3, 0xEE, 0xEE, 0xE1, 0xB1, 0xC2, 0x17, 0x64, 0xB5,
-    0x5E, 0x3F, 0x6F, 0x53, 0xE0, 0xFA, 0x86, 0x4E, 0x46, 0xEB, 0x12, 0x11, 0x56, 0xAC, 0xA1, 0x00,
-    0x26, 0xB5, 0x32, 0xCD, 0xFC, 0x79, 0xA3, 0x7F, 0x99, 0xDD, 0x25, 0x9A, 0x6A, 0x49, 0x86, 0xEF,
-    0x3E, 0x80, 0xFA, 0xEE, 0x7D, 0xCC, 0xCE, 0x6D, 0x89, 0x14, 0x82, 0x48, 0x66, 0x95, 0x48, 0xF2,
-    0x70, 0xDA, 0x7E, 0x70, 0x52, 0x5B, 0xA6, 0xD6, 0xB6, 0x70, 0x06, 0x4D, 0x44, 0x9D, 0xA4, 0x44,
-    0x1A, 0x3F, 0xED, 0x84, 0xDD, 0xFF, 0x0F, 0xB5, 0x56, 0x3B, 0x8C, 0xDC, 0x44, 0x18, 0xFE, 0xC7,
-    0xBE, 0xDB, 0x81, 0xB3, 0xEE, 0x26, 0xC5, 0xAD, 0x84, 0xC2, 0xC3, 0x4D, 0x90, 0x10, 0x02, 0xDC,
-    0xA1, 0x2B, 0x22, 0xC6, 0x39, 0x0A, 0x0A, 0x0A, 0xB6, 0xC8, 0x89, 0x8A, 0x47, 0x89, 0x84, 0x10,
-    0x57, 0x04, 0x89, 0x02, 0xC5, 0x73, 0xA1, 0xA0, 0xA0, 0x20, 0x4D, 0xA0, 0xA1, 0x58, 0x21, 0x0A,
-    0xA0, 0x4A, 0x41, 0x41, 0x93, 0xD8, 0x49, 0x0A, 0x24, 0x68, 0x46, 0x41, 0x54, 0x34, 0x8E, 0x00,
-    0x21, 0x41, 0x81, 0x91, 0x0C, 0x32, 0x30, 0xF6, 0xCF, 0xF7, 0x7B, 0x77, 0x2F, 0x17, 0x84, 0x04,
-    0x02, 0x32, 0xBB, 0x3B, 0x3B, 0x9E, 0xF9, 0xDF, 0x8F, 0x6F, 0xBC, 0xF1, 0xD1, 0x91, 0x31, 0x27,
-    0xDA, 0x79, 0xE8, 0xBE, 0x8F, 0xB5, 0x4F, 0x7C, 0xD6, 0x3E, 0xFA, 0x6E, 0xE4, 0xFE, 0xF9, 0x87,
-    0x88, 0xEE, 0x21, 0x4A, 0x72, 0x8A, 0x3C, 0xD1, 0x19, 0xCB, 0xE1, 0x95, 0xBD, 0x4F, 0xF6, 0xA9,
-    0xDE, 0x8F, 0xDD, 0xFE, 0x16, 0xED, 0x6F, 0xD3, 0x3E, 0xFD, 0xFB, 0xAF, 0x8C, 0x1D, 0xA2, 0x9A,
-    0xB4, 0xA3, 0xFB, 0x88, 0x20, 0xFC, 0x91, 0xBD, 0x67, 0x12, 0xDA, 0x8C, 0xAA, 0x4D, 0xBA, 0xB8,
-    0x49, 0xDB, 0x9B, 0x44, 0xFF, 0xE5, 0x4B, 0xD3, 0xBD, 0x53, 0xCC, 0x5F, 0x31, 0xBF, 0xCC, 0xFD,
-    0x74, 0x6F, 0x76, 0xEB, 0xD3, 0x1E, 0x46, 0xC6, 0xCC, 0x9F, 0xE3, 0xF7, 0x13, 0x42, 0xF4, 0x81,
-    0x18, 0x63, 0xF1, 0xF0, 0x23, 0x7E, 0xBF, 0xE3, 0x37, 0xD0, 0xD1, 0x21, 0x27, 0x7F, 0x39, 0xE8,
-    0xCF, 0xE3, 0xEF, 0x29, 0x1F, 0xCC, 0x3F, 0xB4, 0x57, 0x86, 0xDB, 0xFA, 0x9D, 0xE6, 0xE2, 0xDF,
-    0xDE, 0xCA, 0x9F, 0xDF, 0xE0, 0xE0, 0x87, 0x2B, 0xF5, 0x66, 0xE5, 0xA0, 0x18, 0xE5, 0x68, 0x8D,
-    0xCE, 0xAA, 0x10, 0xB7, 0xA6, 0x49, 0xBD, 0xAD, 0xF0, 0xF1, 0xB6, 0x3E, 0x9E, 0xD3, 0x4C, 0x07,
-    0x1D, 0x62, 0x7C, 0x74, 0x97, 0x34, 0xA6, 0xB6, 0x55, 0x29, 0x99, 0xCA, 0xF1, 0x34, 0xEE, 0xEB,
-    0x05, 0xBD, 0x2B, 0xE9, 0x55, 0x52, 0x94, 0x36, 0xB6, 0xB1, 0x23, 0x77, 0xEA, 0x4D, 0x13, 0xB7,
-    0x2A, 0xD0, 0x6B, 0x50, 0xB4, 0x46, 0xC7, 0x54, 0xA7, 0xEB, 0x14, 0xBC, 0xBD, 0x30, 0xD8, 0xAA,
-    0x38, 0xD5, 0xC7, 0xC1, 0x34, 0xB2, 0xB4, 0x9E, 0x89, 0x5F, 0xEF, 0xD5, 0xFB, 0x93, 0xF3, 0xA3,
-    0x55, 0x49, 0x9D, 0xB9, 0xF2, 0x2A, 0xF6, 0x44, 0x29, 0x48, 0xEA, 0xC2, 0x95, 0xBB, 0x21, 0xEE,
-    0x4C, 0x9D, 0x55, 0xA5, 0x0A, 0xBA, 0xD1, 0x55, 0xB6, 0xB0, 0x3F, 0x57, 0x54, 0x9C, 0xEB, 0x93,
-    0x60, 0xEB, 0xE2, 0xEA, 0x10, 0x87, 0xCC, 0x17, 0x8F, 0x83, 0xC1, 0x1E, 0xF4, 0xC9, 0x72, 0xCA,
-    0x5F, 0x45, 0xAD, 0x2A, 0xDA, 0xA6, 0xE2, 0xDA, 0x10, 0x73, 0xDA, 0x99, 0xB6, 0xAC, 0x10, 0x13,
-    0x11, 0xAD, 0x7A, 0xD8, 0x17, 0x8C, 0x8F, 0xDB, 0xAC, 0xD2, 0x8D, 0x75, 0xBA, 0xB2, 0x87, 0x69,
-    0x31, 0x0D, 0x51, 0xE1, 0x48, 0xF5, 0x44, 0x1A, 0xCB, 0xD4, 0x45, 0xB3, 0x4B, 0xEB, 0xCF, 0x21,
-    0x4E, 0x05, 0xF3, 0x2F, 0xBF, 0x9E, 0x7D, 0xB1, 0xA2, 0x16, 0x27, 0x15, 0x32, 0x0C, 0xE2, 0xB0,
-    0x20, 0xCA, 0xD0, 0x1F, 0x28, 0x94, 0x18, 0x27, 0x29, 0x4E, 0x90, 0xE3, 0x18, 0x27, 0x4B, 0x97,
-    0x96, 0x32, 0x75, 0x47, 0xA3, 0x50, 0x2A, 0x48, 0xA4, 0xD2, 0xFD, 0x89, 0x3F, 0x9D, 0x42, 0xAC,
-    0x46, 0xF8, 0x77, 0x47, 0xB9, 0xD8, 0x84, 0xFF, 0xE0, 0xFD, 0x33, 0xA5, 0xAE, 0x4E, 0x9B, 0x25,
-    0xE5, 0xC1, 0x6F, 0xB7, 0x50, 0xB6, 0x4B, 0xCA, 0x32, 0x27, 0x42, 0xBA, 0x44, 0x55, 0x67, 0xFB,
-    0x72, 0xC0, 0xA7, 0x2F, 0xBA, 0xBB, 0xCF, 0x3F, 0x00, 0x33, 0x1D, 0xD9, 0x0E, 0xE5, 0xE8, 0x2C,
-    0x77, 0x96, 0x07, 0xCB, 0xBD, 0x65, 0x6F, 0x7B, 0xB2, 0x9E, 0x1E, 0x1E, 0x8D, 0x9B, 0x9C, 0x2F,
-    0xBF, 0xE0, 0xB7, 0x86, 0xAC, 0x9D, 0xD2, 0xC4, 0x4D, 0x1C, 0xBB, 0xF2, 0xD3, 0x31, 0x5E, 0x69,
-    0x28, 0x90, 0xCA, 0xD3, 0x08, 0xE0, 0xC4, 0xD1, 0x71, 0xA2, 0x17, 0x92, 0x40, 0x59, 0x43, 0xE5,
-    0x35, 0x26, 0x13, 0xC8, 0x36, 0x5C, 0xC5, 0xB2, 0xB2, 0x15, 0xFC, 0x45, 0x48, 0x73, 0x5A, 0x27,
-    0xA1, 0x5D, 0x4A, 0x6B, 0xA6, 0xB7, 0x20, 0xC6, 0x4E, 0x1A, 0xCE, 0xAC, 0xDF, 0x36, 0xC4, 0x68,
-    0xEF, 0x79, 0x64, 0xB6, 0xF9, 0x3F, 0x22, 0x06, 0xCD, 0x28, 0xCD, 0x75, 0xA0, 0xEF, 0xF7, 0x77,
-    0xDE, 0xFB, 0x6C, 0x63, 0x23, 0x9F, 0x1F, 0xDB, 0x20, 0x9A, 0xD3, 0xBF, 0x9A, 0x30, 0xE6, 0x9E,
-    0xE2, 0x4F, 0x1D, 0x99, 0x2D, 0xA2, 0x93, 0x3B, 0x25, 0x37, 0x3F, 0xEC, 0xBD, 0xF4, 0xD0, 0x5C,
-    0x3F, 0xB9, 0xA1, 0xAE, 0x57, 0xF3, 0x33, 0x17, 0x37, 0xD6, 0xD6, 0x40, 0x39, 0x92, 0xFE, 0xC7,
-    0xBF, 0x71, 0xEC, 0xCF, 0xE9, 0xE1, 0x93, 0x94, 0x3C, 0x45, 0xD1, 0xB5, 0x8A, 0x2E, 0x32, 0x7F,
-    0xFD, 0xC6, 0x85, 0x67, 0xB7, 0xEE, 0xA5, 0xF9, 0xCE, 0x99, 0x0D, 0xBA, 0xE1, 0xE7, 0x4A, 0xFD,
-    0x0F, 0x8A, 0x8E, 0xEA, 0x3B, 0x3A, 0xB6, 0x16, 0x7F, 0x09, 0xCA, 0x32, 0xAB, 0xC6, 0x65, 0x89,
-    0x5E, 0xB0, 0xE3, 0x32, 0x12, 0x94, 0xE1, 0xE5, 0xB9, 0xAD, 0xA2, 0x7E, 0xD1, 0x19, 0xE8, 0x6B,
-    0xE9, 0x0C, 0x12, 0x8E, 0xAC, 0x32, 0xF5, 0x02, 0x3C, 0x51, 0x78, 0x4B, 0x01, 0xD6, 0x01, 0x2F,
-    0xF2, 0xD5, 0xD2, 0x2D, 0xB8, 0xD0, 0xA0, 0x65, 0xD4, 0xD1, 0x31, 0x54, 0x3F, 0x76, 0x07, 0xDD,
-    0xA4, 0x03, 0x29, 0xAE, 0xED, 0x0F, 0xC1, 0x54, 0x25, 0x57, 0x09, 0x87, 0x94, 0x1B, 0xBB, 0x3B,
-    0x14, 0x3E, 0xFB, 0xAE, 0xD7, 0x9C, 0x5F, 0xD6, 0x5D, 0x0A, 0x24, 0x41, 0x8B, 0xAA, 0x11, 0x54,
-    0x78, 0xD1, 0xAD, 0xA6, 0x36, 0xF5, 0x20, 0x4B, 0x53, 0xA7, 0x3E, 0xBD, 0xD1, 0xCB, 0x52, 0xAC,
-    0x48, 0xAF, 0x07, 0xE9, 0xAA, 0x22, 0xCF, 0x2A, 0x7B, 0x35, 0x48, 0x2B, 0x0F, 0xD8, 0x2F, 0xCE,
-    0x01, 0x05, 0xA5, 0xB1, 0x33, 0xCF, 0x11, 0x00, 0x44, 0xDC, 0x34, 0x1C, 0x88, 0x19, 0x0D, 0x89,
-    0x52, 0xE4, 0x9A, 0x0A, 0x5E, 0x00, 0xC0, 0x47, 0x88, 0x0F, 0x62, 0x14, 0xFF, 0x55, 0x8C, 0x10,
-    0xBC, 0x5E, 0x0D, 0x71, 0xAF, 0x43, 0xD2, 0x99, 0x26, 0x03, 0x7A, 0x5A, 0xBA, 0x03, 0xBB, 0x51,
-    0x0E, 0x34, 0x72, 0x29, 0x6C, 0xE3, 0x27, 0x00, 0xAE, 0xB6, 0xCE, 0x6E, 0x60, 0x99, 0xB4, 0x12,
-    0x2C, 0x7B, 0x10, 0x28, 0x68, 0x4F, 0x6E, 0x22, 0xFC, 0xCA, 0x09, 0xAD, 0xF1, 0x42, 0x5D, 0x54,
-    0x20, 0xDA, 0x1D, 0x04, 0xA6, 0x4D, 0x6B, 0x7D, 0x56, 0x97, 0x57, 0x46, 0xF0, 0x14, 0xBE, 0x14,
-    0x78, 0x0D, 0x6C, 0x8E, 0xC0, 0x1B, 0x35, 0xC2, 0xAD, 0x72, 0xB4, 0xE8, 0x84, 0x6C, 0x8E, 0xC6,
-    0x06, 0xA9, 0x69, 0x92, 0x4E, 0xB0, 0x90, 0x2E, 0xD1, 0x89, 0x09, 0xDD, 0x45, 0x7D, 0xD4, 0x69,
-    0x09, 0xCF, 0x28, 0x47, 0x7A, 0x9F, 0xF3, 0xF2, 0x60, 0x89, 0x97, 0x71, 0x17, 0xB5, 0xDA, 0x47,
-    0x10, 0x20, 0x94, 0x27, 0xE2, 0x36, 0x01, 0xA0, 0x43, 0x39, 0x60, 0xBA, 0x37, 0x6D, 0x56, 0x83,
-    0x61, 0x54, 0x8C, 0x87, 0xA4, 0x1B, 0x15, 0x57, 0x08, 0x92, 0xF0, 0x99, 0x3A, 0xF1, 0x69, 0xFE,
-    0x18, 0x9D, 0xA0, 0x19, 0x30, 0x02, 0x0E, 0x28, 0xA4, 0xBB, 0xA8, 0x29, 0x65, 0xA7, 0xBB, 0x01,
-    0x91, 0xE8, 0x32, 0x67, 0x3C, 0x45, 0x39, 0x0C, 0x01, 0x40, 0x37, 0x69, 0xA7, 0x07, 0x2C, 0x12,
-    0x20, 0x54, 0x43, 0x2C, 0x5D, 0x88, 0xA2, 0x00, 0x8E, 0x9D, 0x17, 0x14, 0x4D, 0x1B, 0xD9, 0xB5,
-    0x35, 0x95, 0x1E, 0x67, 0x80, 0x21, 0xAE, 0x4C, 0x47, 0xEC, 0x4C, 0x7B, 0x58, 0x90, 0x52, 0x83,
-    0xFA, 0xCD, 0x3A, 0xAE, 0xE3, 0xE6, 0x72, 0x14, 0xE2, 0x26, 0xA9, 0x4B, 0xC0, 0x64, 0x6F, 0x1E,
-    0x47, 0xB6, 0xBC, 0x00, 0x66, 0x1F, 0x61, 0x32, 0xD7, 0x3B, 0x52, 0x6E, 0xE8, 0xEE, 0x8A, 0x02,
-    0x90, 0x0E, 0xB6, 0x22, 0x62, 0xE9, 0x15, 0xBE, 0x12, 0xD4, 0xA9, 0x3E, 0xAC, 0xA1, 0x4C, 0x04,
-    0x62, 0x03, 0x6A, 0x0C, 0x10, 0x0F, 0x74, 0xEF, 0xCD, 0xB9, 0x8E, 0xC6, 0x4B, 0xA5, 0x87, 0xCC,
-    0xF6, 0x12, 0xA0, 0xD3, 0x8A, 0xC2, 0x78, 0x51, 0x99, 0x34, 0x99, 0xAB, 0x0F, 0x00, 0x8E, 0x40,
-    0xC8, 0xC2, 0xA7, 0x2D, 0xAC, 0x12, 0xDB, 0x9D, 0xAD, 0x15, 0xE7, 0x85, 0x57, 0x4C, 0x45, 0x15,
-    0x89, 0x53, 0x71, 0x0F, 0xAB, 0x51, 0x41, 0x02, 0x98, 0x32, 0x75, 0x28, 0x2C, 0xDD, 0xC2, 0x71,
-    0xDD, 0xE0, 0xB2, 0x4C, 0x1A, 0xA4, 0x2A, 0xA9, 0xA1, 0x34, 0xF1, 0xB0, 0xD1, 0x54, 0x71, 0x43,
-    0x77, 0x22, 0x30, 0x0B, 0x15, 0xEB, 0xB9, 0x9A, 0xA1, 0xF4, 0x50, 0x74, 0xB6, 0x86, 0xCF, 0xA3,
-    0x1E, 0xEB, 0x10, 0x93, 0x29, 0x8E, 0x48, 0x5E, 0xEF, 0x8A, 0xA3, 0xD7, 0xFC, 0x74, 0x56, 0xC8,
-    0x3D, 0xD0, 0x4F, 0x4F, 0x1F, 0x16, 0x9E, 0x16, 0x49, 0x72, 0xB9, 0xD0, 0xD8, 0x7C, 0x6A, 0x7C,
-    0xB5, 0xE1, 0xC3, 0x69, 0xEC, 0x32, 0xEB, 0x56, 0x93, 0xD4, 0x31, 0x6C, 0x90, 0xC9, 0xD3, 0xE2,
-    0xBA, 0x19, 0xEF, 0x3A, 0x8A, 0x9B, 0x43, 0x31, 0x41, 0xC4, 0xC8, 0x44, 0xFD, 0xA1, 0x98, 0xF2,
-    0xA6, 0xAC, 0x6A, 0x35, 0x8D, 0x12, 0xE8, 0xF9, 0x43, 0x4B, 0xA2, 0x21, 0x57, 0x65, 0x6E, 0xB8,
-    0x4E, 0xB8, 0xC9, 0xB8, 0x45, 0x17, 0x65, 0xD2, 0xB2, 0x21, 0x7B, 0x3A, 0x98, 0x77, 0xFA, 0xB5,
-    0x08, 0x19, 0x18, 0x46, 0xE9, 0xBD, 0x28, 0xC2, 0x02, 0x6E, 0xEA, 0x56, 0x64, 0xA1, 0xD1, 0xA0,
-    0xA5, 0x74, 0x88, 0x1F, 0x9C, 0x58, 0x34, 0x21, 0xF2, 0x03, 0x05, 0xF6, 0x02, 0x65, 0x5F, 0x92,
-    0x45, 0xA7, 0x32, 0x65, 0xE0, 0xE8, 0xE5, 0xFE, 0x8D, 0x56, 0x57, 0x30, 0x42, 0x84, 0xEA, 0xCB,
-    0xBC, 0xB0, 0xA0, 0x7C, 0x70, 0x8F, 0x15, 0x7E, 0x2C, 0xA5, 0x4A, 0x36, 0xD1, 0x16, 0xEB, 0x0B,
-    0xBA, 0xE3, 0x2E, 0xFB, 0x06, 0x97, 0x1A, 0x4C, 0x53, 0xBC, 0xCB, 0x9C, 0x5B, 0xD8, 0x17, 0xE2,
-    0x21, 0xFA, 0xB9, 0xA8, 0x0A, 0x0F, 0xC3, 0x90, 0x61, 0x40, 0x41, 0xE9, 0x60, 0x17, 0x6A, 0x0E,
-    0xB6, 0x8C, 0xF8, 0x06, 0xA1, 0xA6, 0x41, 0x3C, 0x61, 0x55, 0x8A, 0xC2, 0x94, 0x98, 0xC0, 0xA8,
-    0xAC, 0x8A, 0x7F, 0x9D, 0x21, 0x9B, 0xB0, 0xC9, 0xE6, 0x11, 0x4B, 0x3A, 0x61, 0xD2, 0x89, 0x9B,
-    0x16, 0x4D, 0xC5, 0x87, 0x31, 0xA1, 0x0A, 0xCD, 0xD0, 0x53, 0x3A, 0xBA, 0x38, 0xC8, 0xF5, 0x83,
-    0x53, 0x14, 0xD5, 0x08, 0x9B, 0x0A, 0xDA, 0x0A, 0x5F, 0xF0, 0x68, 0x16, 0xCA, 0xC6, 0x31, 0x23,
-    0xF7, 0xE6, 0xED, 0x01, 0x75, 0x95, 0x03, 0x3F, 0x91, 0x18, 0xC0, 0x89, 0x24, 0x0C, 0xCC, 0x1A,
-    0x1D, 0x2D, 0x99, 0x45, 0x0A, 0x0B, 0x87, 0x90, 0x21, 0x5E, 0x85, 0x84, 0x2E, 0x69, 0x24, 0x45,
-    0x97, 0x29, 0xFD, 0x16, 0xC5, 0xA5, 0xB8, 0x41, 0x59, 0x9B, 0x01, 0xD5, 0x25, 0x17, 0xFB, 0xCA,
-    0x9C, 0xED, 0x65, 0x48, 0x6D, 0x1D, 0x31, 0xC1, 0x1C, 0x04, 0xC9, 0x3A, 0x6C, 0xA1, 0xEE, 0x96,
-    0xD1, 0x01, 0xC8, 0x7E, 0x43, 0x27, 0x13, 0xC4, 0x85, 0xF1, 0xEA, 0x82, 0x37, 0x09, 0x57, 0x70,
-    0xB7, 0x05, 0x1B, 0xFD, 0x12, 0xDA, 0x04, 0x9A, 0xEE, 0x44, 0x36, 0x6C, 0x7E, 0x59, 0x05, 0x35,
-    0x08, 0x9C, 0xE0, 0x8D, 0xD0, 0x97, 0x07, 0xBC, 0x42, 0xA8, 0xD2, 0x95, 0xE7, 0x58, 0x2F, 0xDF,
-    0xFE, 0xCA, 0xDD, 0x21, 0xEA, 0x75, 0x37, 0xBE, 0x08, 0x0A, 0x50, 0xE9, 0x16, 0xFD, 0x5A, 0xA5,
-    0xF9, 0x59, 0x20, 0xE2, 0x36, 0xF0, 0xC2, 0xD1, 0x1F, 0x45, 0x53, 0x3F, 0x6E, 0xD5, 0x30, 0x1C,
-    0xFE, 0x62, 0xEB, 0x35, 0x12, 0x19, 0x3C, 0xC1, 0x00, 0x48, 0xD9, 0xA9, 0x50, 0x4E, 0x00, 0x0E,
-    0x65, 0x60, 0xA4, 0x03, 0x0F, 0x46, 0x16, 0x26, 0x18, 0x7A, 0x83, 0x26, 0x55, 0x2F, 0xF0, 0x86,
-    0x1E, 0x81, 0x09, 0x6E, 0xC0, 0xD0, 0x58, 0xF4, 0x02, 0x69, 0x3B, 0xB0, 0x46, 0xEA, 0x01, 0x6A,
-    0x95, 0x14, 0xA5, 0xC5, 0xF1, 0x8F, 0xCF, 0xAF, 0xA5, 0xF5, 0x62, 0xC5, 0xF2, 0xCF, 0xDF, 0xDF,
-    0x00, 0x5C, 0xDD, 0x80, 0x46, 0x5C, 0xF9, 0x77, 0xD6, 0x93, 0x19, 0x04, 0x62, 0x06, 0x73, 0x31,
-    0x23, 0x5A, 0x67, 0xCE, 0x82, 0x9A, 0x6D, 0x6B, 0x8F, 0xA6, 0x7C, 0xB4, 0x4E, 0x94, 0x74, 0xCE,
-    0x88, 0x47, 0x35, 0xE2, 0x7E, 0x05, 0xC0, 0x3A, 0x98, 0x00, 0x2D, 0x2D, 0xE2, 0x08, 0x6B, 0x61,
-    0x8E, 0xBC, 0xF6, 0x0D, 0xE6, 0x62, 0xB0, 0x22, 0x67, 0x22, 0x71, 0x53, 0xC4, 0xA1, 0x6C, 0xA1,
-    0x38, 0x68, 0x41, 0xB0, 0xD6, 0xCA, 0xC0, 0x97, 0xF2, 0x01, 0x9A, 0x47, 0x92, 0xF0, 0x81, 0x1D,
-    0x7E, 0xF1, 0xB5, 0x8E, 0x77, 0x5A, 0xBE, 0xB9, 0x94, 0xDE, 0x4A, 0x5F, 0x48, 0x7D, 0x07, 0xF5,
-    0x24, 0xA0, 0xE4, 0x49, 0xAC, 0x55, 0xE4, 0xB5, 0x1A, 0xE6, 0xBA, 0x55, 0xC2, 0xB7, 0xBE, 0xCF,
-    0xB9, 0x37, 0x43, 0x83, 0xC3, 0xDC, 0x17, 0xDC, 0x66, 0x7D, 0xD5, 0xB8, 0x92, 0x3C, 0x9B, 0x69,
-    0x3D, 0x56, 0xC8, 0x75, 0x2E, 0x72, 0x2A, 0xE2, 0x29, 0xE3, 0x85, 0x9E, 0x32, 0x3D, 0x41, 0x05,
-    0x64, 0x33, 0xC0, 0x77, 0x08, 0xDC, 0xD4, 0x49, 0x42, 0xD5, 0xA3, 0xF0, 0xC8, 0xEE, 0xB5, 0x15,
-    0x91, 0x70, 0xBE, 0x3C, 0x4E, 0x3A, 0x5E, 0x4F, 0xA5, 0x6B, 0x3E, 0x92, 0x4D, 0xAF, 0x64, 0xC8,
-    0xFF, 0x44, 0xED, 0xAB, 0x9F, 0x93, 0x1E, 0x0F, 0xB3, 0x50, 0x1D, 0x47, 0x2D, 0x11, 0xD5, 0xD5,
-    0xDD, 0x9C, 0x92, 0x1E, 0x22, 0xB5, 0xFD, 0x15, 0x48, 0xAB, 0xEF, 0x92, 0x0F, 0xEB, 0x2D, 0x8F,
-    0x9D, 0xAB, 0x64, 0xC2, 0x67, 0x42, 0x96, 0x03, 0x8A, 0x09, 0x3B, 0x91, 0xC2, 0x6B, 0x1D, 0xEF,
-    0x24, 0x16, 0x63, 0xF3, 0x26, 0x76, 0xBE, 0xFC, 0x11, 0x8A, 0x69, 0x57, 0x87, 0xAA, 0x9E, 0x8D,
-    0x6B, 0xF4, 0x50, 0xED, 0x8D, 0x6F, 0xFB, 0xC3, 0xDF, 0xDE, 0x5E, 0x4E, 0xA4, 0x98, 0x56, 0xF6,
-    0x89, 0x30, 0x23, 0x61, 0x9C, 0x3D, 0x89, 0xF9, 0x68, 0x3C, 0x63, 0x2B, 0x7B, 0x73, 0x11, 0x52,
-    0x6C, 0xE5, 0xE9, 0xA4, 0x42, 0x8A, 0x2D, 0x14, 0xA3, 0x3D, 0x8E, 0xC9, 0xA3, 0x82, 0x1E, 0x3F,
-    0x5E, 0x71, 0xAE, 0xCD, 0x3A, 0xD7, 0x44, 0x70, 0xB6, 0xEC, 0xD1, 0x24, 0x1F, 0xCC, 0x00, 0x5B,
-    0x67, 0x21, 0x89, 0xAF, 0x1C, 0x12, 0xA3, 0x7D, 0x89, 0x8B, 0xE5, 0x36, 0xB2, 0x03, 0x66, 0xEA,
-    0x6F, 0x30, 0x66, 0x4D, 0x0D, 0x4F, 0x55, 0x58, 0x67, 0xC3, 0x89, 0x7C, 0x42, 0x76, 0x13, 0x02,
-    0xBF, 0xCB, 0xCB, 0xA5, 0x16, 0x19, 0x19, 0x36, 0x96, 0x4B, 0x60, 0x63, 0x1B, 0x5D, 0xA0, 0x27,
-    0xF9, 0xD0, 0xE9, 0xB6, 0x01, 0x66, 0xDE, 0xCE, 0x64, 0xC8, 0x28, 0x7D, 0x8B, 0xB6, 0x87, 0x04,
-    0x5A, 0x8E, 0x5F, 0xA4, 0xEF, 0xA4, 0x7E, 0xB6, 0x4A, 0x62, 0xEA, 0x74, 0x84, 0x8E, 0x19, 0x90,
-    0x86, 0xB4, 0xD9, 0xF5, 0x88, 0x5D, 0x8B, 0x72, 0x9F, 0x05, 0xD9, 0xCD, 0xC2, 0xFF, 0x1A, 0xCD,
-    0x8B, 0xF7, 0x73, 0x8D, 0xAA, 0x5D, 0x77, 0xE6, 0xE1, 0xDA, 0x86, 0x2A, 0xD5, 0x68, 0xCC, 0x2F,
-    0xDF, 0xA5, 0x66, 0xD1, 0x46, 0x3B, 0xE3, 0x01, 0xDD, 0xCF, 0x6F, 0x6B, 0xE4, 0x92, 0xC8, 0xCA,
-    0x6F, 0x8A, 0x37, 0xD4, 0xFF, 0x2D, 0xD9, 0xFC, 0xA8, 0x46, 0x13, 0x60, 0xA5, 0x35, 0x57, 0xEB,
-    0xB6, 0xA5, 0x2C, 0x64, 0xD0, 0x49, 0xE4, 0xD6, 0x7D, 0x8D, 0xB8, 0xBD, 0x0A, 0x3A, 0xF2, 0xD6,
-    0xAD, 0x6F, 0xA0, 0x15, 0x72, 0x42, 0x91, 0xF3, 0x87, 0xF0, 0x52, 0x85, 0x82, 0x2A, 0x70, 0xD3,
-    0x9F, 0xEE, 0xA6, 0x3F, 0x6D, 0x32, 0x8F, 0xC6, 0xD0, 0x45, 0xC5, 0xDA, 0x3D, 0xE7, 0xC4, 0xC6,
-    0x8A, 0xFC, 0x6A, 0x7B, 0x3E, 0x56, 0x2E, 0x9A, 0xC1, 0x6E, 0x85, 0xCA, 0xD9, 0x73, 0x97, 0xA7,
-    0x30, 0xD8, 0x53, 0xC9, 0x7D, 0x79, 0xC2, 0x0A, 0x75, 0x2A, 0xF0, 0xCF, 0x53, 0x32, 0x63, 0xE3,
-    0x00, 0x58, 0xAC, 0x90, 0x27, 0xAB, 0xD8, 0xEA, 0xBD, 0xBB, 0xFA, 0x70, 0x4B, 0x74, 0xC8, 0x91,
-    0x62, 0xB1, 0x20, 0x65, 0x62, 0x55, 0xA3, 0xEA, 0x42, 0x12, 0x9C, 0x7D, 0x05, 0xFE, 0x01, 0x45,
-    0x52, 0xB1, 0x4E, 0xDC, 0x50, 0x10, 0x1C, 0xDB, 0x22, 0x4F, 0x91, 0x0B, 0xA7, 0xA0, 0xCA, 0x15,
-    0xA6, 0x4F, 0xE1, 0x3F, 0xC0, 0xEE, 0x68, 0xD3, 0x1C, 0x1F, 0x41, 0x73, 0x94, 0x14, 0x08, 0xFB,
-    0x13, 0xE8, 0xA2, 0x74, 0x14, 0x34, 0xDC, 0x15, 0xFC, 0x00, 0x92, 0x9D, 0x3F, 0x70, 0x93, 0x8A,
-    0xC6, 0x12, 0x4A, 0x13, 0x8A, 0x58, 0x0A, 0x48, 0x77, 0xF0, 0xFC, 0x36, 0xB3, 0x6B, 0x50, 0x5C,
-    0x3C, 0xAF, 0xD7, 0x3B, 0xB3, 0x3B, 0xB3, 0x0F, 0x7B, 0xCB, 0xE5, 0xF2, 0x6B, 0x24, 0x22, 0x01,
-    0x05, 0xCF, 0x01, 0x79, 0xD8, 0x4C, 0x88, 0xA4, 0xC9, 0x3A, 0xE4, 0x4F, 0xF0, 0x88, 0x05, 0x59,
-    0x85, 0x72, 0x04, 0x90, 0x04, 0x1E, 0xA8, 0x7B, 0x1E, 0xA9, 0x08, 0x33, 0x04, 0x00, 0x99, 0x08,
-    0x33, 0xD2, 0x30, 0x4B, 0x00, 0xF0, 0x45, 0xBE, 0xB3, 0x54, 0xA9, 0xB0, 0x92, 0x1B, 0x05, 0x30,
-    0x82, 0x9B, 0x78, 0x7C, 0x60, 0x17, 0x12, 0x0A, 0xCB, 0x4A, 0x85, 0xEA, 0xB3, 0xD8, 0x41, 0x39,
-    0x9E, 0x0C, 0xD3, 0x91, 0xE8, 0x1B, 0x2B, 0x8B, 0xA1, 0xE8, 0xE1, 0x7C, 0xE4, 0xF9, 0x5D, 0x15,
-    0x24, 0xD6, 0xF6, 0x71, 0xB0, 0xCA, 0x57, 0x1D, 0x4F, 0x4B, 0x3F, 0xCB, 0xEF, 0x6B, 0x26, 0xB6,
-    0xCC, 0x1E, 0xCA, 0xE3, 0x08, 0xA7, 0x22, 0xB0, 0x91, 0xF5, 0x25, 0xE9, 0x75, 0xC8, 0xC4, 0xDB,
-    0xBC, 0x9C, 0x2C, 0xF9, 0xB3, 0x3B, 0xBE, 0xED, 0x6B, 0xC2, 0x3C, 0xAB, 0x08, 0xAE, 0x87, 0x85,
-    0x8C, 0xF1, 0xA5, 0x4D, 0x10, 0x6D, 0x5E, 0xAA, 0x79, 0x16, 0xE5, 0xED, 0xE7, 0x30, 0xFF, 0x1F,
-    0x5E, 0xC8, 0xBD, 0x0E, 0x06, 0x73, 0x20, 0x31, 0xA1, 0xA6, 0xD5, 0x85, 0x39, 0x42, 0xDB, 0x65,
-    0x3E, 0x19, 0xED, 0xBF, 0xA0, 0x1C, 0x4A, 0x2B, 0xCE, 0xB6, 0x91, 0x54, 0xB3, 0xC6, 0x72, 0xC8,
-    0x7C, 0x1A, 0xAE, 0x68, 0x2A, 0x53, 0xED, 0x83, 0xB6, 0x97, 0x2A, 0xF5, 0x79, 0xC8, 0x25, 0x24,
-    0xBB, 0x3B, 0xF5, 0x62, 0xE0, 0xAC, 0x45, 0x77, 0x40, 0x47, 0x27, 0x15, 0xDB, 0x36, 0x54, 0xF3,
-    0x42, 0x66, 0x22, 0x1A, 0x53, 0x9F, 0x4C, 0x34, 0xAE, 0x63, 0x2B, 0x32, 0x8F, 0x1A, 0x26, 0xCA,
-    0xCD, 0x56, 0xB1, 0x54, 0x6A, 0x41, 0x24, 0xF1, 0x47, 0x1A, 0xA4, 0xCB, 0x49, 0xFD, 0xF9, 0x9D,
-    0xDB, 0xA6, 0xC2, 0x6C, 0x21, 0x7F, 0x43, 0xFD, 0xC3, 0x0C, 0xAF, 0xE5, 0x48, 0xA6, 0x74, 0xB6,
-    0x78, 0x70, 0xEF, 0x2A, 0x3E, 0x01, 0xA6, 0x7D, 0x11, 0xF8, 0x72, 0xF3, 0x26, 0x45, 0x2A, 0xCA,
-    0x5F, 0xAB, 0xF7, 0xBD, 0x1B, 0x91, 0x79, 0xE4, 0x8D, 0x36, 0x3E, 0x9B, 0x0D, 0x8D, 0x56, 0xCF,
-    0x27, 0x8D, 0x6E, 0x9D, 0x03, 0xB4, 0x46, 0x6D, 0xDB, 0xD9, 0x6B, 0x7F, 0x2E, 0x2D, 0xB1, 0xD5,
-    0x45, 0x6A, 0x9B, 0xC2, 0x2C, 0x69, 0x7B, 0x33, 0xB6, 0x31, 0x77, 0x1A, 0x9C, 0xF2, 0xEA, 0xFC,
-    0x5A, 0xF5, 0x6F, 0xF8, 0xCC, 0xAE, 0x91, 0x13, 0xBD, 0x03, 0xD8, 0x07, 0xFE, 0x01, 0x85, 0x54,
-    0x3D, 0x6F, 0xD4, 0x40, 0x10, 0x1D, 0x9F, 0x01, 0x07, 0xAD, 0xC0, 0x29, 0x51, 0x9A, 0xFD, 0x07,
-    0xA4, 0xA1, 0xA0, 0x00, 0xD9, 0x90, 0xE2, 0x0A, 0x1A, 0x8A, 0x58, 0x48, 0x50, 0x5C, 0x43, 0x95,
-    0x26, 0x14, 0x94, 0x1C, 0xBB, 0x52, 0x0A, 0x8A, 0x14, 0xA4, 0xC9, 0x3F, 0x80, 0x26, 0x55, 0x4A,
-    0x8A, 0xA0, 0x35, 0xDC, 0x0F, 0xC8, 0x9D, 0x10, 0x4A, 0x7B, 0xF0, 0x07, 0x58, 0x90, 0xE1, 0x0C,
-    0xB1, 0x6F, 0x98, 0xB7, 0x97, 0xCB, 0x07, 0x10, 0xB1, 0x92, 0x9F, 0x7D, 0xB3, 0xF3, 0xF1, 0x66,
-    0xF6, 0xED, 0xD1, 0x05, 0x92, 0x95, 0x94, 0x80, 0x06, 0xD0, 0x02, 0xEA, 0x19, 0x44, 0xC5, 0x0A,
-    0xCB, 0xFA, 0x05, 0x98, 0x1A, 0xE0, 0x8B, 0x9F, 0x45, 0x51, 0xE4, 0xC6, 0xCE, 0xDD, 0xC9, 0x21,
-    0x52, 0x01, 0x08, 0x46, 0x52, 0xB9, 0xD8, 0x2C, 0x29, 0xB6, 0xE4, 0xD8, 0x2A, 0x66, 0xEB, 0x8C,
-    0xD9, 0xAC, 0x1A, 0xF3, 0x72, 0xC3, 0xEF, 0x2D, 0xE8, 0xD2, 0x92, 0x21, 0x8A, 0x24, 0x34, 0xA9,
-    0x88, 0xF4, 0x90, 0xC8, 0xE4, 0x14, 0xB5, 0xE7, 0xFE, 0x24, 0x0A, 0xFC, 0xD2, 0x1C, 0x20, 0x36,
-    0x8A, 0x18, 0x9F, 0xAA, 0xBA, 0x58, 0x48, 0x9D, 0x7B, 0xA0, 0xF4, 0x2D, 0xB0, 0x73, 0x40, 0xE1,
-    0x56, 0x38, 0xEC, 0x07, 0xE0, 0x63, 0x48, 0xED, 0x11, 0xBF, 0xFF, 0x17, 0xC4, 0x4F, 0xB0, 0xF3,
-    0x04, 0xB2, 0x6F, 0x32, 0x15, 0xB8, 0x4F, 0x26, 0x4D, 0xCA, 0x5C, 0xA6, 0xDC, 0x50, 0x2A, 0x9D,
-    0x29, 0x99, 0x8F, 0x0A, 0x39, 0xC1, 0x85, 0x62, 0xB1, 0xF8, 0xB8, 0x26, 0xD5, 0x90, 0xB4, 0x2C,
-    0xEF, 0x5A, 0x49, 0x36, 0xD3, 0x05, 0xA5, 0x09, 0x80, 0x03, 0xBB, 0xCD, 0xEF, 0x45, 0x61, 0xAC,
-    0x50, 0x33, 0x70, 0x92, 0x21, 0x31, 0x65, 0x96, 0x52, 0x8A, 0x4B, 0x3A, 0x59, 0x19, 0x51, 0xCC,
-    0xF2, 0x62, 0x79, 0xC9, 0x3E, 0x73, 0xDC, 0x36, 0xAC, 0x06, 0x5F, 0xEB, 0xCB, 0xE9, 0x7B, 0x8B,
-    0x5D, 0x12, 0x76, 0xB1, 0x97, 0x9E, 0xCA, 0xE0, 0xBC, 0xD5, 0x5C, 0x53, 0x03, 0x5F, 0x67, 0xFB,
-    0xFB, 0xDE, 0x38, 0x27, 0x01, 0x1E, 0xB1, 0x94, 0xF9, 0xB0, 0x4B, 0x8B, 0xF2, 0x5C, 0xCA, 0x43,
-    0x5B, 0xA7, 0x8E, 0x84, 0x8D, 0x19, 0x48, 0x5B, 0xF1, 0x86, 0xDF, 0x9D, 0xE7, 0x91, 0xB4, 0x51,
-    0xEC, 0x17, 0x75, 0x3A, 0x18, 0x72, 0x96, 0xBD, 0x63, 0x6E, 0x23, 0xE6, 0x61, 0xC4, 0x32, 0x1A,
-    0x2E, 0xB1, 0x2B, 0x54, 0xA6, 0x3C, 0x5B, 0x87, 0xF2, 0x48, 0xF7, 0x9D, 0x57, 0xE7, 0x4D, 0x90,
-    0x5A, 0x5A, 0x88, 0x2B, 0xDA, 0x4B, 0x87, 0xAA, 0xC9, 0x72, 0x57, 0xB6, 0x49, 0x1D, 0x57, 0x66,
-    0xBB, 0x77, 0x20, 0x81, 0xEB, 0x92, 0x5A, 0x72, 0x79, 0x68, 0x28, 0x3C, 0x08, 0x91, 0x0A, 0xCF,
-    0x84, 0x83, 0x44, 0xAE, 0x49, 0xDE, 0x16, 0x07, 0xFC, 0xE7, 0x71, 0x90, 0x16, 0x27, 0x13, 0xD9,
-    0xA8, 0xD1, 0x36, 0xF1, 0x6C, 0x75, 0xC9, 0xB9, 0x21, 0x77, 0xA7, 0x2D, 0x1C, 0x06, 0xDD, 0x9B,
-    0x29, 0x54, 0xFC, 0x5C, 0x50, 0x0A, 0x74, 0x02, 0xC1, 0x40, 0x39, 0x41, 0x42, 0x33, 0x51, 0xEB,
-    0x31, 0x66, 0x9C, 0x27, 0x56, 0x28, 0x66, 0x36, 0xAE, 0xE2, 0x96, 0xD2, 0x61, 0x56, 0x52, 0xB6,
-    0x22, 0xBB, 0xE0, 0xC5, 0x3F, 0xD0, 0x21, 0x88, 0xF2, 0x3D, 0xD1, 0xFA, 0x2A, 0x88, 0x84, 0xF3,
-    0xC6, 0xE9, 0x4A, 0x3A, 0x68, 0xF2, 0x0A, 0x9D, 0x5D, 0xBB, 0xE1, 0x22, 0xD0, 0x5C, 0x77, 0x01,
-    0x4C, 0x5E, 0x3C, 0xDC, 0xC2, 0x95, 0xA9, 0x4D, 0xB8, 0x3C, 0x90, 0xE6, 0x3A, 0x36, 0x12, 0x51,
-    0x41, 0x71, 0x1F, 0x82, 0x98, 0x2A, 0x54, 0xB1, 0x6E, 0x7B, 0x6D, 0x67, 0xAC, 0xFC, 0x71, 0x8E,
-    0xD9, 0xA7, 0x3F, 0x49, 0xFF, 0x98, 0x66, 0xC3, 0x25, 0x23, 0x90, 0x4C, 0x04, 0x5C, 0x57, 0x44,
-    0xD6, 0x6A, 0x11, 0x51, 0x65, 0x6A, 0x75, 0x38, 0x3A, 0xAC, 0xB3, 0x5E, 0xF7, 0xC0, 0xDF, 0xE8,
-    0xEB, 0x2E, 0x45, 0x55, 0x5F, 0xBC, 0x46, 0x98, 0x5F, 0x57, 0xC8, 0xF6, 0x75, 0x4E, 0x1D, 0x98,
-    0xD4, 0x48, 0x9A, 0x58, 0xEE, 0x4A, 0xFF, 0x6F, 0xB5, 0x15, 0xD3, 0xF3, 0xD3, 0xA6, 0xA3, 0x75,
-    0x33, 0x28, 0xD0, 0xCE, 0x87, 0x25, 0xE7, 0xB3, 0xB4, 0xBD, 0x9A, 0x54, 0x81, 0xE7, 0x5D, 0x40,
-    0x85, 0x36, 0x4C, 0x68, 0xE3, 0x93, 0x7C, 0x3D, 0x08, 0xC3, 0xAA, 0xD1, 0x4C, 0x7D, 0x7D, 0xE7,
-    0xF5, 0x23, 0x04, 0xC5, 0x67, 0x81, 0x6E, 0xCD, 0x93, 0x2F, 0x75, 0xB6, 0xFE, 0x59, 0x7B, 0x66,
-    0xFA, 0x8B, 0x34, 0xFA, 0x88, 0xC5, 0xF4, 0x24, 0xD3, 0xDD, 0x0F, 0x9E, 0xFB, 0xDA, 0x94, 0xE8,
-    0x96, 0xDC, 0x08, 0x3A, 0x96, 0x01, 0x90, 0x83, 0x7C, 0x1C, 0x8A, 0x38, 0x50, 0x7E, 0x3A, 0x2F,
-    0xD4, 0x29, 0xAF, 0x0A, 0x34, 0xE9, 0x58, 0x94, 0x14, 0x4D, 0x21, 0x27, 0x3D, 0xEE, 0x60, 0xDE,
-    0x00, 0x1E, 0xB5, 0x42, 0xBC, 0xC5, 0xBF, 0x9C, 0xFE, 0xF2, 0xB1, 0x28, 0x7A, 0x9F, 0x61, 0x1C,
-    0x2F, 0x03, 0x82, 0x27, 0x65, 0xA5, 0x44, 0xC6, 0x4D, 0x2A, 0x27, 0x70, 0x3B, 0x12, 0x88, 0x70,
-    0x89, 0x7E, 0x03, 0xCD, 0x58, 0x3D, 0xCC, 0xDE, 0x56, 0x15, 0x3E, 0x7E, 0xDD, 0xEF, 0x33, 0x8D,
-    0x05, 0xEE, 0xD0, 0x8F, 0xA1, 0x91, 0x30, 0x73, 0xF8, 0xF1, 0xC2, 0x88, 0x6A, 0xA7, 0x51, 0xC5,
-    0xC0, 0x40, 0x40, 0x79, 0xA9, 0xA0, 0xC3, 0xC7, 0xC2, 0xD0, 0x74, 0xE8, 0xCA, 0x92, 0xDA, 0x14,
-    0xA1, 0xAE, 0x19, 0x28, 0x6B, 0x3B, 0x04, 0x89, 0xBC, 0x0C, 0x59, 0x11, 0x8A, 0xB0, 0x69, 0x86,
-    0x0C, 0x19, 0x6A, 0x11, 0x41, 0x86, 0x0E, 0x75, 0xD5, 0x14, 0xD4, 0x30, 0xD4, 0x29, 0xFE, 0x88,
-    0x93, 0xD8, 0x3E, 0x3C, 0xCF, 0xB9, 0x7E, 0x7F, 0xD2, 0x54, 0x22, 0x55, 0x8B, 0xC0, 0xFA, 0x7C,
-    0xBF, 0xD7, 0xD7, 0xF7, 0x9E, 0xFB, 0xDC, 0xE7, 0xFC, 0xDC, 0x73, 0x5C, 0xB6, 0x22, 0x51, 0xA7,
-    0x8D, 0x48, 0x7A, 0x45, 0x2B, 0x59, 0x4C, 0xA1, 0xB2, 0x23, 0x1A, 0x45, 0xF2, 0x2A, 0x1D, 0x64,
-    0x31, 0x4A, 0x7E, 0x6F, 0x75, 0xA9, 0x15, 0xC5, 0x55, 0x2C, 0xD0, 0x0C, 0x12, 0xA0, 0x6D, 0x05,
-    0x43, 0xCA, 0x4C, 0x92, 0xC1, 0x1F, 0x30, 0xB7, 0x8D, 0x20, 0x41, 0xEB, 0x52, 0xC4, 0xD3, 0x2B,
-    0xBD, 0x88, 0xAF, 0x71, 0x25, 0x12, 0x8E, 0xE8, 0x90, 0x58, 0x3B, 0xB4, 0x29, 0xA4, 0x8B, 0x94,
-    0x13, 0x1A, 0xC1, 0x6C, 0x0E, 0x29, 0xD0, 0x06, 0x03, 0x3B, 0x1E, 0x67, 0xE3, 0xFD, 0x31, 0xC3,
-    0x6C, 0xCD, 0xA4, 0xD4, 0x51, 0xA2, 0xBF, 0x94, 0xAD, 0x9C, 0x5F, 0x70, 0x4C, 0xC4, 0x21, 0x65,
-    0x35, 0x8F, 0xCD, 0x6B, 0x49, 0xEE, 0x8F, 0x10, 0xAA, 0x75, 0xA8, 0x3A, 0x2E, 0x34, 0xD3, 0x2A,
-    0xAD, 0x83, 0x21, 0xEC, 0x01, 0x58, 0x25, 0x1C, 0x62, 0x60, 0x7D, 0x65, 0x92, 0xA8, 0x4D, 0x1B,
-    0x4F, 0xFD, 0x49, 0xD2, 0x26, 0x6D, 0xFC, 0xC1, 0x57, 0xD1, 0x2C, 0xE9, 0xD8, 0x87, 0x1D, 0x84,
-    0x3A, 0x11, 0x57, 0x26, 0xB2, 0x67, 0xD0, 0x74, 0x8A, 0xB0, 0xA7, 0xEB, 0xB8, 0x3B, 0xBD, 0x75,
-    0x69, 0x24, 0xB8, 0x8C, 0xFB, 0xC1, 0x3B, 0x60, 0x8F, 0xAC, 0xE3, 0xD9, 0x65, 0xA6, 0x7F, 0xE6,
-    0x88, 0x12, 0xCB, 0x26, 0xAA, 0x0F, 0x8F, 0x58, 0x77, 0x1C, 0xDD, 0x5A, 0x1D, 0x8E, 0x39, 0x46,
-    0x1C, 0xE2, 0xBE, 0x61, 0x64, 0xCD, 0x97, 0xF7, 0x42, 0xB6, 0x28, 0xE4, 0xB8, 0xEA, 0x33, 0x3D,
-    0x57, 0xBD, 0x37, 0xB0, 0x05, 0x9E, 0x74, 0x92, 0x12, 0x6D, 0x4F, 0x21, 0x71, 0x0F, 0x16, 0x5A,
-    0x6C, 0xDA, 0xD3, 0x31, 0x18, 0xC5, 0x1B, 0xF4, 0x15, 0x45, 0x9B, 0xB4, 0x5A, 0x79, 0x63, 0x38,
-    0xA4, 0x8D, 0x60, 0xD3, 0x51, 0x2F, 0xA0, 0xFF, 0xCA, 0x84, 0x16, 0x2F, 0x0A, 0xF0, 0x85, 0x17,
-    0xA3, 0xF8, 0x53, 0x38, 0x4C, 0x98, 0x78, 0x92, 0xFB, 0x03, 0x2F, 0x68, 0xCB, 0x3A, 0x80, 0x46,
-    0x41, 0xA6, 0x76, 0x10, 0x0B, 0x6E, 0xB1, 0x03, 0x6B, 0xF1, 0x1B, 0x8A, 0xAC, 0x25, 0x92, 0xFD,
-    0xDF, 0xC8, 0xCE, 0x75, 0x9A, 0x38, 0x95, 0xBF, 0x80, 0x07, 0x3A, 0x34, 0xBD, 0x41, 0x23, 0x24,
-    0x0C, 0x4A, 0xF6, 0xEF, 0xF3, 0x5D, 0xCE, 0x5D, 0x87, 0xB7, 0xF9, 0x6E, 0xA4, 0x7E, 0x92, 0x0A,
-    0xEF, 0xFC, 0x9E, 0x4B, 0xE5, 0x19, 0xDE, 0x45, 0x2D, 0xD5, 0x3B, 0x49, 0x3C, 0xE0, 0x15, 0x58,
-    0x81, 0x91, 0x44, 0x93, 0xE4, 0x85, 0xE4, 0x6D, 0xD4, 0x62, 0x97, 0x27, 0x31, 0x30, 0x1D, 0xD2,
-    0x9A, 0xE6, 0x42, 0xCB, 0x9A, 0x48, 0x97, 0xFE, 0xDD, 0x7E, 0x92, 0x12, 0xB5, 0x67, 0xBB, 0xEE,
-    0xEA, 0xFB, 0xCB, 0xE7, 0xC6, 0x94, 0xAC, 0xD0, 0x36, 0xCB, 0x93, 0x58, 0x34, 0xAD, 0xF0, 0x1C,
-    0x37, 0x78, 0x8E, 0x5A, 0x4F, 0x2B, 0x9F, 0xDC, 0xC1, 0x52, 0xF1, 0xAC, 0xB6, 0xEF, 0x02, 0xCF,
-    0x58, 0x37, 0x50, 0x33, 0xCB, 0xAB, 0xC0, 0x9A, 0x80, 0x6B, 0x3C, 0x73, 0x1B, 0xCA, 0x0D, 0x24,
-    0xB4, 0x2C, 0xDF, 0xED, 0xAD, 0xE1, 0xDE, 0xA8, 0xA3, 0x45, 0xC6, 0x6D, 0xBF, 0x48, 0x86, 0xA8,
-    0xE0, 0x9A, 0x86, 0xAE, 0x19, 0xA1, 0x8C, 0x81, 0x9E, 0x17, 0xA7, 0x6B, 0xE0, 0xA0, 0xE1, 0x9A,
-    0x55, 0xC2, 0xB8, 0xAC, 0xE3, 0x97, 0xCB, 0xE5, 0xF2, 0x3B, 0x86, 0x96, 0x2A, 0x57, 0x53, 0xBE,
-    0x1E, 0xE9, 0x6B, 0xE8, 0x3E, 0x65, 0x16, 0xEF, 0x46, 0x27, 0x9D, 0xAC, 0x85, 0x48, 0x4E, 0x72,
-    0x4D, 0x11, 0xE3, 0xAC, 0x14, 0x5B, 0x52, 0xF6, 0x9D, 0x65, 0x89, 0x9C, 0x65, 0xE3, 0xDB, 0x3C,
-    0x50, 0x26, 0x4F, 0x71, 0x60, 0xC8, 0x81, 0x1E, 0x85, 0xD7, 0x31, 0xDB, 0x93, 0x7A, 0x93, 0xCC,
-    0xC2, 0x1D, 0x1A, 0xC9, 0x1B, 0xF8, 0x23, 0xCC, 0x9C, 0x1D, 0xBD, 0x75, 0xBC, 0xBB, 0xD4, 0xD7,
-    0xBE, 0x6F, 0xA8, 0x6E, 0xEC, 0x62, 0x7B, 0xFF, 0xF9, 0x71, 0x79, 0x5A, 0x8B, 0xA4, 0x16, 0xDF,
-    0xF8, 0x0A, 0xC7, 0xA0, 0xA7, 0x09, 0xA3, 0x43, 0xE2, 0xC9, 0x91, 0x43, 0x10, 0x89, 0x61, 0x8B,
-    0x0D, 0x5B, 0x68, 0xD8, 0x52, 0xD2, 0xE5, 0xD9, 0x86, 0x02, 0xDB, 0x84, 0x57, 0xAE, 0xAD, 0x69,
-    0x8D, 0x87, 0x73, 0x22, 0xDB, 0x40, 0xD9, 0x98, 0x93, 0x1B, 0xFE, 0xFE, 0x60, 0xB9, 0x3C, 0x33,
-    0x93, 0xB2, 0x83, 0xE7, 0x2E, 0xF8, 0x39, 0x93, 0x9A, 0x77, 0xD8, 0x68, 0xA7, 0x0A, 0xDB, 0xDF,
-    0x68, 0x6D, 0x67, 0x61, 0xA7, 0x96, 0xAF, 0xAD, 0x49, 0x11, 0x08, 0xB9, 0x60, 0x23, 0x26, 0x71,
-    0xDA, 0xB1, 0x75, 0xF9, 0xEE, 0xB8, 0xB5, 0x81, 0x2D, 0x18, 0x8E, 0x3B, 0xA4, 0xB7, 0x5C, 0xA5,
-    0xBC, 0xF1, 0x71, 0xF5, 0x74, 0xE8, 0x5E, 0x96, 0x35, 0xD5, 0xAE, 0xDB, 0xD1, 0x79, 0xB3, 0x11,
-    0x52, 0x76, 0x26, 0xBB, 0xE0, 0xE8, 0x7E, 0xB3, 0xE4, 0x84, 0x55, 0xF6, 0x2F, 0xAC, 0xB5, 0x22,
-    0x8E, 0x13, 0x0C, 0xFC, 0xC0, 0xB0, 0x69, 0xE1, 0xB4, 0x13, 0x38, 0xDC, 0x51, 0xBB, 0x8F, 0x36,
-    0xA9, 0x61, 0xA3, 0x30, 0x7E, 0xC4, 0x2A, 0xF0, 0x0D, 0x4A, 0x68, 0xAA, 0xC3, 0x01, 0xD4, 0x90,
-    0x1C, 0x3D, 0xA4, 0x9E, 0x03, 0x28, 0xED, 0xA5, 0x8E, 0x2C, 0x23, 0xE4, 0x59, 0xDC, 0x92, 0xB0,
-    0x43, 0x4C, 0x90, 0xF8, 0x5D, 0x5A, 0x6B, 0xFA, 0xE1, 0x68, 0xB2, 0x9B, 0xD8, 0x00, 0x71, 0xC9,
-    0x9A, 0x4B, 0xF6, 0x5B, 0x44, 0xD4, 0x23, 0xDD, 0x90, 0x2F, 0xEF, 0x3A, 0x36, 0x8B, 0x60, 0x6B,
-    0x33, 0xB5, 0x6D, 0xB0, 0xB2, 0x7D, 0x17, 0xA6, 0xA2, 0x3D, 0x10, 0x11, 0x0E, 0x0F, 0xA9, 0xE7,
-    0x59, 0x74, 0x3F, 0x6F, 0x44, 0x9A, 0x8A, 0xDC, 0xE8, 0x64, 0x70, 0x42, 0xF2, 0x8D, 0x8E, 0x2A,
-    0xCA, 0x7E, 0x63, 0x0E, 0x1E, 0xA5, 0xCD, 0x7C, 0xC7, 0xDA, 0xD1, 0x3D, 0x64, 0xE9, 0xDD, 0xE5,
-    0x73, 0x5A, 0x30, 0x3C, 0xC2, 0xF2, 0xF1, 0x87, 0x5F, 0xFF, 0xC3, 0x07, 0x60, 0x2E, 0x62, 0xED,
-    0x71, 0xC6, 0x84, 0x06, 0xB4, 0x56, 0x0B, 0x0A, 0xE2, 0xB4, 0xA8, 0x3D, 0x0F, 0x02, 0x35, 0xBA,
-    0x2A, 0x3D, 0x5A, 0x1E, 0xB6, 0x31, 0x43, 0xF0, 0x82, 0x31, 0x87, 0xF1, 0x30, 0xC4, 0x6E, 0xCD,
-    0xB8, 0xC9, 0x48, 0x34, 0x99, 0xB5, 0xD6, 0x46, 0xCB, 0xE6, 0x44, 0xCB, 0xDB, 0xB5, 0x31, 0x59,
-    0x63, 0xA6, 0x18, 0x4C, 0x6B, 0x5F, 0xB0, 0x86, 0x06, 0xF7, 0xB4, 0x07, 0x41, 0x71, 0x85, 0x29,
-    0x11, 0x22, 0x3B, 0xCE, 0xB6, 0x72, 0x13, 0xFB, 0xBE, 0xEB, 0x56, 0x5F, 0x1F, 0x1C, 0x4F, 0xD0,
-    0x09, 0xEE, 0xE0, 0xFE, 0x10, 0x37, 0x42, 0xCA, 0x19, 0x76, 0x9A, 0x13, 0x96, 0x84, 0x92, 0x17,
-    0x6B, 0x2B, 0x4C, 0x9A, 0xB5, 0x0D, 0x84, 0xF4, 0x4E, 0x7A, 0xB5, 0x0B, 0x20, 0xCE, 0x65, 0xF5,
-    0x13, 0xA6, 0xC4, 0x8F, 0x3C, 0xA5, 0x7A, 0x60, 0xCA, 0xDE, 0xE9, 0xF5, 0x1B, 0xBE, 0x40, 0x1C,
-    0x87, 0x9B, 0x39, 0x41, 0x61, 0xEF, 0x24, 0xE0, 0xE4, 0x75, 0xC7, 0x88, 0xEE, 0x0E, 0x6A, 0xB6,
-    0x83, 0x78, 0x9A, 0xFB, 0xE3, 0xCE, 0xA0, 0xB2, 0x70, 0x2B, 0x70, 0x50, 0x6C, 0x69, 0x89, 0x1B,
-    0xE4, 0x9D, 0x91, 0x00, 0x8F, 0xF3, 0x1D, 0xF9, 0xED, 0xCF, 0x92, 0xEB, 0xEF, 0x0D, 0xA9, 0x05,
-    0x65, 0x04, 0x8C, 0x9C, 0x87, 0x9C, 0x66, 0xD0, 0x66, 0x97, 0xDE, 0xD7, 0x31, 0xBE, 0xF2, 0xEE,
-    0xF0, 0xC5, 0xA0, 0xFD, 0xD6, 0x66, 0x8E, 0x07, 0xA8, 0x67, 0x33, 0xCF, 0xAC, 0xB5, 0xD6, 0xE7,
-    0x87, 0x5C, 0xCA, 0xA4, 0x8A, 0xAF, 0xB5, 0xFE, 0x47, 0xC3, 0x62, 0x48, 0xFF, 0x8A, 0x84, 0x47,
-    0x79, 0x24, 0xEC, 0xDF, 0x95, 0xA7, 0x7E, 0xAE, 0xD7, 0x34, 0x19, 0xF2, 0xE6, 0xC0, 0xCC, 0xE1,
-    0x18, 0x59, 0x5A, 0x0C, 0x1B, 0x27, 0xF7, 0x5D, 0xDC, 0xDE, 0x3A, 0x9A, 0x51, 0x14, 0x57, 0xDB,
-    0x51, 0xC5, 0x66, 0x54, 0x69, 0xA3, 0x9A, 0x00, 0xC6, 0x31, 0x12, 0x61, 0x0C, 0xBB, 0x69, 0x17,
-    0xBD, 0x7C, 0x59, 0x25, 0xCD, 0xB0, 0x33, 0x02, 0x2B, 0x8B, 0x92, 0x1B, 0x8C, 0x98, 0x32, 0x54,
-    0x46, 0x06, 0x65, 0xC5, 0xEF, 0x51, 0x07, 0x9A, 0x72, 0xFE, 0x9D, 0x76, 0x9D, 0x32, 0xF9, 0x66,
-    0x65, 0xE9, 0xB0, 0xF1, 0xC3, 0x78, 0xBB, 0xCC, 0x13, 0xE2, 0xE1, 0x84, 0x0D, 0x2A, 0x58, 0x74,
-    0xAB, 0x7A, 0xAD, 0x4F, 0x5F, 0xD1, 0x36, 0xAE, 0xD2, 0x36, 0x6C, 0xFC, 0x7E, 0x01, 0xD3, 0xCD,
-    0xF2, 0x67, 0xB4, 0x8B, 0x94, 0x79, 0xC4, 0x10, 0xB5, 0x49, 0x2F, 0x03, 0xCE, 0xF8, 0x7D, 0x9B,
-    0x07, 0x5A, 0xAA, 0x10, 0xC4, 0x0C, 0x11, 0xFD, 0xE0, 0x2D, 0x1D, 0xF2, 0x53, 0xDA, 0x80, 0x9E,
-    0xB4, 0x89, 0xAE, 0x35, 0x21, 0x28, 0xEA, 0x61, 0xAF, 0x43, 0xEE, 0xA3, 0x33, 0xC2, 0x41, 0x0C,
-    0x09, 0x7D, 0xAC, 0x55, 0xD2, 0x33, 0x9E, 0x9D, 0xC6, 0xB2, 0xCE, 0x92, 0xCC, 0x22, 0xCC, 0x74,
-    0x9C, 0xD5, 0x7C, 0xCE, 0x9D, 0xDB, 0x90, 0x7D, 0xB8, 0x09, 0x4E, 0xDD, 0x26, 0x6B, 0x94, 0xC0,
-    0xC2, 0x9D, 0x79, 0xD8, 0x7C, 0xDC, 0x58, 0x26, 0x36, 0xF3, 0xE4, 0xCD, 0x6D, 0x65, 0xE6, 0xEC,
-    0x5A, 0x9B, 0x50, 0xD6, 0x9B, 0x70, 0xEF, 0x5C, 0xD6, 0x45, 0xB9, 0xB9, 0x75, 0x27, 0x75, 0x6C,
-    0x51, 0x35, 0x1E, 0xB6, 0xC7, 0x83, 0x45, 0x07, 0x9A, 0x0C, 0xAE, 0x57, 0x75, 0x93, 0xB3, 0x68,
-    0x7F, 0x36, 0x7D, 0xE7, 0xCE, 0xA8, 0xF9, 0x7F, 0x6E, 0x96, 0xD9, 0x89, 0xEC, 0x62, 0xFA, 0xA7,
-    0xE9, 0xBF, 0xFA, 0x77, 0x90, 0x2D, 0x67, 0x0A, 0x2D, 0x71, 0x9E, 0x19, 0x49, 0x8C, 0x1D, 0x1D,
-    0xEC, 0x00, 0xE0, 0xD6, 0xD2, 0x0F, 0x5B, 0xB3, 0xB5, 0x9A, 0x1E, 0xE9, 0x7C, 0x54, 0x99, 0x83,
-    0x2F, 0x26, 0x9E, 0xD9, 0x96, 0xD8, 0x57, 0xF0, 0x42, 0x84, 0x2B, 0xF8, 0x23, 0x7E, 0x60, 0x20,
-    0x46, 0x95, 0x85, 0xCF, 0x1C, 0x93, 0x4E, 0xE0, 0xDB, 0x29, 0x15, 0x0E, 0xF4, 0xE3, 0xA8, 0xA3,
-    0xD3, 0x32, 0x1B, 0x05, 0xA1, 0x57, 0x2D, 0xD1, 0x2A, 0x28, 0x33, 0xEA, 0xAD, 0xE7, 0x4D, 0xA5,
-    0x4A, 0xDC, 0xC0, 0x70, 0x60, 0x48, 0x88, 0x6D, 0x3E, 0x32, 0x28, 0x08, 0xA2, 0x58, 0xE4, 0x89,
-    0x19, 0xDE, 0x63, 0x71, 0xBC, 0x81, 0xE3, 0x33, 0x34, 0x1A, 0x88, 0xB8, 0x65, 0x48, 0x30, 0x6C,
-    0x52, 0xBE, 0x4A, 0xF8, 0xCA, 0x0E, 0xDF, 0x72, 0x15, 0xB7, 0x93, 0xC8, 0x45, 0x61, 0xDD, 0xE6,
-    0x57, 0xBA, 0xCD, 0x55, 0xBC, 0x9F, 0x9A, 0x15, 0xD5, 0x4C, 0xB6, 0x91, 0x97, 0xA2, 0x49, 0xA6,
-    0x1F, 0x6A, 0x03, 0xF9, 0xE5, 0x55, 0x48, 0xD3, 0xC3, 0x06, 0x27, 0x32, 0x62, 0x59, 0x70, 0x0F,
-    0xE8, 0xE2, 0x7F, 0x60, 0x7A, 0x7E, 0x09, 0x99, 0xE9, 0xF4, 0x7F, 0xD1, 0x05, 0x6F, 0x08, 0x8F,
-    0x98, 0x2D, 0x5F, 0x9F, 0xC0, 0x5F, 0xA8, 0xAF, 0x95, 0x76, 0x44, 0x55, 0xD1, 0x5C, 0x89, 0x81,
-    0x93, 0x1F, 0x99, 0xB9, 0xFF, 0xC1, 0xB2, 0xA3, 0x82, 0xA9, 0x1A, 0x46, 0xDF, 0x47, 0xE9, 0xA6,
-    0x70, 0x8D, 0x68, 0x78, 0xCC, 0xD9, 0xB4, 0xB9, 0x80, 0x25, 0x36, 0x66, 0xCF, 0xF9, 0xE7, 0xDE,
-    0x55, 0xC8, 0x63, 0x28, 0x57, 0x04, 0x85, 0x8A, 0x84, 0x13, 0x9E, 0x12, 0x1A, 0x9A, 0x55, 0x7D,
-    0x4F, 0x5D, 0xD8, 0x29, 0x2F, 0x4A, 0xAB, 0xFA, 0xCC, 0x1E, 0xE3, 0x6D, 0x72, 0xE1, 0x0E, 0x99,
-    0x4F, 0x75, 0xBD, 0x80, 0x45, 0x7F, 0x1B, 0xB2, 0x8E, 0xEB, 0x19, 0x17, 0xB5, 0x55, 0x16, 0x16,
-    0x6F, 0x42, 0x72, 0x30, 0x31, 0xE6, 0xEF, 0xCD, 0x12, 0x69, 0xDD, 0x7A, 0x0A, 0x38, 0x42, 0x8D,
-    0x5C, 0xD5, 0xD1, 0xF3, 0xFC, 0x66, 0xB0, 0x9E, 0x3E, 0xED, 0x9A, 0x72, 0x71, 0x27, 0x53, 0xEC,
-    0x36, 0xA7, 0xBF, 0x0B, 0x3B, 0x5C, 0x54, 0x7E, 0xEF, 0x4F, 0x81, 0x06, 0x93, 0xDF, 0xCB, 0x03,
-    0x1B, 0xF2, 0x24, 0xAE, 0xD3, 0x36, 0x6F, 0xF2, 0xEA, 0x9B, 0xF2, 0xB9, 0xC3, 0x7A, 0x44, 0x26,
-    0x3C, 0xBD, 0x29, 0xDF, 0x86, 0x75, 0x64, 0xCA, 0x44, 0x67, 0x4C, 0x91, 0xD8, 0xF6, 0x5F, 0x82,
-    0x95, 0xD4, 0x4E, 0xCA, 0xD9, 0x4C, 0x9E, 0xF4, 0xE1, 0x4C, 0xE7, 0x60, 0x59, 0xBF, 0x9E, 0x92,
-    0xBF, 0xC1, 0xBE, 0x12, 0x64, 0xD7, 0xED, 0x31, 0x2B, 0xCC, 0x37, 0xD7, 0x01, 0xB3, 0x69, 0x2B,
-    0x0D, 0xAC, 0x31, 0x51, 0xDB, 0xB7, 0x7B, 0x9F, 0xF0, 0xD6, 0xBB, 0x40, 0xC1, 0x75, 0x74, 0x05,
-    0x81, 0xF3, 0x36, 0xCB, 0xDD, 0xD2, 0x47, 0x8D, 0x90, 0x41, 0xFB, 0x99, 0x9C, 0x91, 0xB0, 0x91,
-    0x9F, 0x44, 0x5A, 0xA4, 0x11, 0xA6, 0x5C, 0x9D, 0x54, 0x3F, 0xEA, 0x43, 0x6D, 0xBF, 0x3E, 0x87,
-    0x64, 0x77, 0xDD, 0x44, 0xC6, 0x6D, 0x55, 0x22, 0x0D, 0x7F, 0x60, 0xF0, 0x2D, 0x64, 0xEF, 0xCC,
-    0x2E, 0x03, 0x67, 0x57, 0x17, 0x2C, 0xF5, 0xFC, 0x85, 0x8D, 0xBA, 0xB7, 0x7C, 0x71, 0xF8, 0x2A,
-    0x7A, 0x71, 0x7F, 0x01, 0xFF, 0xCE, 0x41, 0x41, 0xED, 0x89, 0x55, 0xF9, 0x01, 0xDE, 0xDD, 0xC7,
-    0x7D, 0x6B, 0xA5, 0xAB, 0xCC, 0x67, 0xAC, 0x2A, 0x16, 0xAB, 0x69, 0xF5, 0x3A, 0xBA, 0x30, 0x77,
-    0xFA, 0xDD, 0xBD, 0xD5, 0x85, 0x04, 0xEC, 0x5F, 0x76, 0x35, 0x30, 0xAB, 0x83, 0x1F, 0x50, 0xDC,
-    0xDB, 0x6C, 0x7E, 0xBC, 0x5A, 0xAD, 0x2E, 0x3E, 0xB0, 0xCB, 0x65, 0xB2, 0x4E, 0x71, 0x8F, 0xD6,
-    0x59, 0xF5, 0x96, 0xA0, 0xED, 0xC4, 0xC3, 0x99, 0x1F, 0x30, 0x18, 0xD3, 0x37, 0xC1, 0x37, 0x0A,
-    0xA6, 0xBB, 0x92, 0x4C, 0x78, 0x28, 0xCC, 0xF8, 0x4B, 0x28, 0x3E, 0xB7, 0xEF, 0x11, 0x05, 0x1C,
-    0xA3, 0x81, 0x9E, 0x3A, 0x97, 0x31, 0x7D, 0x63, 0x96, 0xE8, 0xCF, 0xB9, 0x1F, 0x51, 0xF2, 0xB9,
-    0x71, 0x27, 0x63, 0xF2, 0xD0, 0x1C, 0x2C, 0x84, 0xE3, 0x1D, 0x1A, 0xF5, 0x20, 0x33, 0x67, 0xED,
-    0x96, 0x51, 0xBD, 0x4C, 0x49, 0x1E, 0xDF, 0x92, 0x15, 0xCD, 0xA2, 0xE6, 0xAA, 0x21, 0xB3, 0xED,
-    0x02, 0x5C, 0xCC, 0x82, 0x99, 0xAE, 0xE9, 0xB1, 0xC6, 0x34, 0x01, 0x4E, 0x06, 0xFE, 0x50, 0xFE,
-    0x32, 0x97, 0x01, 0x5C, 0x46, 0x57, 0x48, 0x9F, 0x41, 0xCF, 0xB8, 0x67, 0x18, 0x33, 0x12, 0x03,
-    0x83, 0x70, 0xCE, 0x3D, 0xC0, 0xDC, 0xBF, 0x32, 0xAF, 0xFB, 0xA4, 0x08, 0x62, 0x11, 0xF2, 0x21,
-    0xFE, 0x05, 0x2E, 0x1F, 0x0F, 0x59, 0x2A, 0xD5, 0x9B, 0x49, 0x6E, 0x49, 0xAE, 0x79, 0xDC, 0xAC,
-    0xD7, 0x82, 0x8C, 0x5B, 0x0D, 0xB1, 0x3D, 0x61, 0x96, 0x57, 0xE3, 0x0F, 0x1C, 0x92, 0xC6, 0x79,
-    0x34, 0xAB, 0xAA, 0x4C, 0x16, 0xB5, 0x2C, 0x9A, 0xCD, 0x1E, 0x1F, 0xB5, 0xF4, 0x91, 0xCD, 0x27,
-    0xA8, 0xA8, 0x5B, 0x7B, 0xA5, 0xCB, 0x46, 0x25, 0xD8, 0x46, 0x27, 0xEF, 0x51, 0x4A, 0x1F, 0xD3,
-    0xFD, 0x83, 0x35, 0xFB, 0x1C, 0xED, 0xD8, 0xB1, 0x0F, 0xC6, 0xEB, 0xC5, 0xEE, 0xF7, 0x04, 0x66,
-    0x31, 0x29, 0xBF, 0xA1, 0x01, 0x0B, 0x6B, 0xF6, 0x81, 0x07, 0x36, 0xD6, 0x57, 0x9E, 0xAD, 0xE8,
-    0x00, 0x2C, 0x54, 0x72, 0xFC, 0x9A, 0xC5, 0x8F, 0x5E, 0x04, 0x69, 0x35, 0x3B, 0x3F, 0x78, 0x11,
-    0xF9, 0xAB, 0x3D, 0xBF, 0xCD, 0x28, 0x8C, 0x36, 0xDC, 0x56, 0x9C, 0x19, 0x0B, 0xF2, 0x71, 0xCE,
-    0xDB, 0xC3, 0x6E, 0x93, 0xBA, 0x7A, 0x3B, 0x1D, 0x22, 0x27, 0xEC, 0xBC, 0x18, 0xB7, 0x28, 0x2D,
-    0xE3, 0xC2, 0xD1, 0xEB, 0x59, 0x66, 0x15, 0x58, 0x65, 0x19, 0x6F, 0xB0, 0xDA, 0xB1, 0xFB, 0x3A,
-    0x17, 0x1D, 0x2C, 0xC8, 0x34, 0x8C, 0x7F, 0x65, 0xC6, 0xE3, 0x7B, 0x20, 0x60, 0xC0, 0x36, 0x15,
-    0x40, 0x00, 0x3A, 0x90, 0x98, 0xB2, 0x03, 0x87, 0x39, 0xF5, 0x87, 0x8E, 0xB2, 0x3D, 0x5B, 0xDE,
-    0x2B, 0xDD, 0xA7, 0x81, 0x7E, 0x5B, 0xB3, 0x9F, 0x9F, 0x51, 0x5A, 0x8E, 0xB7, 0xE6, 0x9D, 0x8D,
-    0x2B, 0xAE, 0x8D, 0xB0, 0x8A, 0x3E, 0xD6, 0x12, 0xC3, 0x60, 0x85, 0x51, 0x3A, 0xAE, 0x93, 0xB2,
-    0x70, 0xD8, 0xA8, 0xCF, 0x74, 0x63, 0xDF, 0x61, 0x2C, 0x2E, 0x3B, 0x5D, 0xD9, 0xA7, 0xAB, 0x40,
-    0xA7, 0xD5, 0xEA, 0x0D, 0x9B, 0x4E, 0x17, 0x52, 0xFB, 0x8A, 0x51, 0x6D, 0xB5, 0x65, 0x99, 0x9B,
-    0x09, 0x7E, 0x8B, 0xCD, 0x3F, 0xD9, 0x0C, 0xCA, 0x0F, 0x0C, 0xEC, 0x6C, 0x2C, 0xD7, 0x3B, 0xB5,
-    0x2E, 0xC3, 0x62, 0xDD, 0x64, 0x8D, 0x51, 0xBF, 0x59, 0xDC, 0xB2, 0xAB, 0xA4, 0x5D, 0x77, 0x5A,
-    0xB1, 0x17, 0xEA, 0x89, 0xD5, 0x4A, 0xF5, 0x7B, 0x9B, 0xE9, 0xB2, 0xAE, 0xCF, 0x77, 0xFC, 0xD9,
-    0x16, 0xDA, 0x5D, 0x7D, 0x13, 0xEF, 0x5E, 0x42, 0x98, 0xB6, 0x42, 0xBA, 0xC0, 0x5E, 0x5E, 0x7F,
-    0x1B, 0x5A, 0x99, 0xFC, 0x36, 0x61, 0x1D, 0x31, 0x78, 0x03, 0xDA, 0x14, 0x8E, 0xFA, 0xB2, 0x44,
-    0xD5, 0xA2, 0x4B, 0x10, 0xD7, 0xE4, 0xE9, 0xA8, 0x40, 0x42, 0x1F, 0x5D, 0x81, 0xED, 0xC8, 0xE2,
-    0xF6, 0xB4, 0xBA, 0x74, 0x6B, 0xE5, 0x92, 0x65, 0x97, 0x2D, 0xEB, 0x75, 0x78, 0xAD, 0x78, 0x6D,
-    0x8F, 0x19, 0x72, 0x39, 0xE5, 0x8C, 0x14, 0x69, 0x01, 0xF4, 0x94, 0x41, 0x79, 0xE8, 0x8C, 0xAB,
-    0xA8, 0x8A, 0xEA, 0xC5, 0xE0, 0xF3, 0x13, 0x6E, 0x72, 0x73, 0x78, 0xA9, 0x31, 0x33, 0xA8, 0xCD,
-    0xBA, 0x48, 0xE5, 0xDE, 0xAF, 0x76, 0xA0, 0x3F, 0x00, 0xEE, 0xFC, 0x71, 0x80, 0xA3, 0xBB, 0x52,
-    0x1E, 0x4E, 0x7E, 0x31, 0xF5, 0x00, 0x1C, 0xAC, 0x0B, 0xE0, 0x70, 0x3D, 0x1D, 0x91, 0x1F, 0x82,
-    0x13, 0x03, 0x87, 0xEB, 0xE3, 0xE0, 0xC4, 0xC0, 0xE1, 0xBA, 0x9C, 0x9A, 0x21, 0x58, 0x3A, 0x4F,
-    0x70, 0x62, 0xE0, 0xD0, 0xD6, 0xAC, 0xAE, 0x0C, 0x9C, 0x7C, 0x5A, 0x70, 0x93, 0x81, 0x53, 0xF3,
-    0x71, 0x30, 0x0C, 0xDF, 0x7F, 0xB9, 0x94, 0xE0, 0x5F, 0x5D, 0x12, 0xB6, 0x41, 0x07, 0x70, 0x65,
-    0xD0, 0x01, 0x5C, 0x78, 0xA7, 0x5B, 0xDC, 0x46, 0x54, 0xEE, 0xE4, 0xDC, 0x39, 0x96, 0xA6, 0xF1,
-    0x61, 0xC6, 0x40, 0x78, 0x1D, 0x3E, 0xD5, 0x02, 0x5C, 0xD0, 0x95, 0x00, 0x17, 0x74, 0x61, 0x9B,
-    0x06, 0x37, 0x30, 0x2C, 0xCE, 0xEC, 0x83, 0x58, 0xC5, 0x12, 0xAC, 0xFC, 0x0C, 0xE0, 0x1C, 0x73,
-    0xA3, 0x81, 0xB3, 0x88, 0x48, 0xE6, 0x08, 0x8E, 0x5F, 0xD7, 0xC8, 0x9C, 0x81, 0x43, 0x4B, 0x70,
-    0x81, 0x81, 0x43, 0x4B, 0x70, 0x9D, 0x81, 0xEB, 0xC4, 0xC0, 0x89, 0x81, 0x23, 0x73, 0x00, 0x27,
-    0x06, 0x8E, 0xCC, 0x75, 0x8F, 0xC4, 0x9C, 0x67, 0x06, 0xDB, 0xAF, 0x3F, 0x1E, 0x30, 0x5C, 0x31,
-    0xF9, 0xFF, 0xEC, 0x5D, 0xA9, 0x3E, 0x74, 0x55, 0x3B, 0xF5, 0xF5, 0xB1, 0xF3, 0x8C, 0x42, 0x17,
-    0xE1, 0xB1, 0x08, 0xB0, 0x7A, 0x55, 0x99, 0x0D, 0xE4, 0x47, 0x8C, 0x62, 0xF8, 0xC5, 0xAE, 0xCA,
-    0x57, 0xA4, 0x2E, 0xC8, 0x5C, 0x0E, 0xE4, 0xDF, 0x45, 0xCF, 0x3B, 0x0A, 0x42, 0x31, 0x10, 0x85,
-    0xE1, 0xA3, 0xB7, 0xB0, 0x11, 0xB2, 0x94, 0x6C, 0xE1, 0x82, 0x5B, 0xB2, 0xD5, 0xF1, 0xEE, 0x4B,
-    0x2C, 0x5C, 0x81, 0x4B, 0xB0, 0xB0, 0xD7, 0x22, 0x85, 0xC2, 0x90, 0xE3, 0x3C, 0x82, 0x06, 0xC2,
-    0xCF, 0x97, 0x09, 0x81, 0x00, 0xBF, 0xB5, 0x1D, 0xD5, 0x4C, 0x19, 0x65, 0xB6, 0x3C, 0xB3, 0xAF,
-    0x55, 0xB4, 0x00, 0xE7, 0x71, 0xD9, 0x5B, 0x3E, 0x97, 0xD9, 0xCF, 0x49, 0x2E, 0xD6, 0x62, 0xDD,
-    0x69, 0xB0, 0xDB, 0x3B, 0x4E, 0xAD, 0xEA, 0xE4, 0x8D, 0xEA, 0x7C, 0x4C, 0x54, 0x31, 0xA1, 0xB2,
-    0x09, 0x3B, 0xD6, 0xE4, 0x2C, 0x7C, 0x43, 0xD8, 0x6C, 0xDF, 0xAB, 0xD1, 0x7A, 0xA5, 0xD1, 0xBA,
-    0x71, 0x42, 0xBA, 0x4F, 0xDD, 0x41, 0x48, 0x13, 0x27, 0xE4, 0x14, 0xC4, 0x71, 0x0A, 0xE2, 0x50,
-    0x83, 0xC8, 0xA9, 0x35, 0x89, 0xFD, 0xFF, 0xAF, 0xF8, 0x02,
+static const uint8_t bookerly_16_bolditalicBitmaps[37812] = {
+    0xD5, 0x9C, 0x3F, 0xEC, 0x26, 0xC7, 0x79, 0xDF, 0x3F, 0xB3, 0xC3, 0xBB, 0x8D, 0xB9, 0x09, 0x86,
+    0x05, 0x19, 0xD8, 0x3C, 0xC4, 0xEB, 0x42, 0x85, 0x23, 0x25, 0xDE, 0x14, 0x2E, 0x6C, 0xC0, 0xF2,
+    0x2C, 0xA5, 0xC2, 0x85, 0x0A, 0x1D, 0x10, 0xFE, 0xAC, 0xD8, 0x2A, 0xE8, 0x42, 0x06, 0xA8, 0x34,
+    0x97, 0x32, 0x01, 0x0C, 0xED, 0x52, 0x2A, 0x52, 0xB8, 0xB9, 0x04, 0x71, 0x95, 0xC2, 0x04, 0xC2,
+    0x20, 0x32, 0x09, 0x84, 0x2E, 0x52, 0x08, 0x81, 0xCC, 0x19, 0x91, 0x40, 0x58, 0xA4, 0xD0, 0x4A,
+    0x46, 0xA0, 0xC2, 0x85, 0xD6, 0x12, 0xE5, 0xC0, 0x56, 0x71, 0x23, 0x6B, 0x65, 0xED, 0x91, 0xB3,
+    0xF3, 0x4D, 0x31, 0xFB, 0xFE, 0xEE, 0x8E, 0xA4, 0xE1, 0x04, 0xB0, 0x18, 0x7A, 0x81, 0x7B, 0x7F,
+    0xEF, 0xBB, 0x3B, 0x3B, 0x7F, 0x9E, 0x79, 0xFE, 0x7E, 0x9F, 0x67, 0x8E, 0x9B, 0x2F, 0x12, 0x62,
+    0x7B, 0xE0, 0x13, 0x9A, 0xDB, 0x83, 0x3E, 0x11, 0x66, 0x7B, 0xE0, 0x12, 0x3E, 0x52, 0x68, 0x37,
+    0xFA, 0x48, 0xA0, 0xD9, 0xE9, 0x16, 0x3C, 0xDC, 0x05, 0xB8, 0x31, 0x12, 0x46, 0x5B, 0xE8, 0x37,
+    0xFC, 0xCC, 0xB3, 0x60, 0x5E, 0x7A, 0xFA, 0x99, 0x63, 0x88, 0x72, 0x69, 0x7A, 0x73, 0xEF, 0xBF,
+    0x79, 0x74, 0x49, 0x36, 0xFB, 0x58, 0xDC, 0xEA, 0x3F, 0xB9, 0xB9, 0x98, 0xED, 0xDD, 0x7F, 0x03,
+    0x40, 0xB3, 0xB7, 0x2B, 0x94, 0x26, 0x83, 0x1F, 0x0B, 0xF4, 0xD1, 0x8F, 0x74, 0xA9, 0x8F, 0xE6,
+    0x95, 0xF2, 0xEA, 0xDB, 0x77, 0x25, 0x29, 0x79, 0x49, 0x99, 0x21, 0x4E, 0xE0, 0xD6, 0x21, 0x62,
+    0x37, 0xB7, 0x62, 0xB2, 0xDD, 0x78, 0x4A, 0xBF, 0x5E, 0x9E, 0xED, 0x25, 0x95, 0x4E, 0x92, 0x9E,
+    0xF9, 0xEC, 0x8F, 0x9E, 0xFB, 0xDE, 0xD8, 0xE4, 0x36, 0xBD, 0xA7, 0x4B, 0x73, 0xFB, 0xC6, 0xC8,
+    0xE5, 0xEA, 0x66, 0x60, 0x03, 0x1C, 0x60, 0x12, 0xB4, 0x9A, 0xE9, 0xA4, 0xB1, 0x91, 0x0E, 0xA6,
+    0x5F, 0xFB, 0x76, 0x72, 0xEB, 0x57, 0x02, 0xC5, 0xFD, 0xDA, 0xDA, 0xFF, 0x20, 0xFD, 0x0A, 0xBA,
+    0x07, 0x4E, 0x2B, 0x4C, 0x02, 0xA3, 0x03, 0x5A, 0x6D, 0xE0, 0xB4, 0x80, 0x64, 0x52, 0x3F, 0xA4,
+    0xC9, 0xAE, 0xEA, 0xB6, 0x8F, 0xBB, 0x14, 0xDE, 0xFC, 0x5A, 0x69, 0xCB, 0x57, 0xA7, 0xE8, 0xA5,
+    0x0D, 0xE9, 0xA8, 0x2F, 0x34, 0x2B, 0xF0, 0x71, 0xA0, 0x8D, 0xC0, 0x57, 0x01, 0x77, 0x99, 0xC4,
+    0x7B, 0xAE, 0x15, 0xBA, 0x0D, 0x86, 0x48, 0xA7, 0x84, 0xCD, 0x34, 0xD2, 0x8C, 0x20, 0x7C, 0x32,
+    0x33, 0x2C, 0xB8, 0x75, 0x88, 0xED, 0x4E, 0x93, 0x9B, 0x4C, 0x01, 0x1F, 0x7D, 0x1C, 0x22, 0x76,
+    0xB7, 0xB9, 0xDD, 0xC0, 0xCF, 0x7E, 0x3E, 0xA0, 0xDD, 0xBB, 0x34, 0xCC, 0x06, 0x3F, 0x97, 0x36,
+    0xF5, 0xC5, 0x96, 0x10, 0x73, 0xA7, 0xDC, 0x2B, 0xF9, 0x4F, 0x94, 0x69, 0x99, 0xB6, 0x6E, 0x9D,
+    0x5E, 0x28, 0x60, 0xB2, 0x4B, 0x6E, 0xAD, 0xA4, 0x2A, 0xE0, 0xD6, 0x7E, 0xE9, 0x57, 0x9A, 0xDC,
+    0x64, 0x73, 0xC0, 0x34, 0x0E, 0xD1, 0x47, 0xDC, 0xDA, 0xE4, 0x76, 0xC7, 0x66, 0x86, 0x45, 0x10,
+    0x46, 0xA4, 0x48, 0xBF, 0xD2, 0x6A, 0xC5, 0x64, 0x78, 0xFC, 0x45, 0xB0, 0xBC, 0xEF, 0xD5, 0x15,
+    0x00, 0x23, 0x8D, 0x40, 0xAF, 0x02, 0x20, 0x9B, 0x81, 0x2E, 0x75, 0x89, 0x3A, 0x61, 0x30, 0x47,
+    0x53, 0xEF, 0x0D, 0x91, 0x5F, 0x64, 0xF8, 0x56, 0xA6, 0x5D, 0x09, 0x1A, 0x6F, 0x69, 0x6E, 0xB4,
+    0xDC, 0x52, 0x66, 0xCA, 0x8D, 0xCA, 0xD8, 0x69, 0x73, 0x8A, 0x84, 0xE7, 0xD2, 0x2F, 0xBF, 0x46,
+    0xBB, 0xFB, 0xC5, 0x6E, 0xF8, 0x65, 0x8A, 0x7D, 0x44, 0x68, 0x2E, 0xB4, 0xD9, 0xE8, 0x77, 0x13,
+    0x7D, 0x6A, 0xA4, 0x19, 0xBF, 0x58, 0xED, 0xA0, 0xC5, 0x6A, 0xC1, 0xA8, 0x48, 0x1B, 0x46, 0x92,
+    0xCA, 0x6D, 0x82, 0xFE, 0x9D, 0xB4, 0x72, 0x63, 0x64, 0x12, 0x00, 0x37, 0xEE, 0x62, 0x5E, 0xEA,
+    0x17, 0xB5, 0xB9, 0x5F, 0x82, 0xCD, 0x6E, 0xF5, 0x63, 0xB6, 0x77, 0x1F, 0xE2, 0x1A, 0x23, 0x18,
+    0x12, 0xB6, 0x80, 0x5F, 0x69, 0x0A, 0xF4, 0x09, 0x04, 0x6E, 0x83, 0x29, 0x62, 0x8F, 0x7A, 0x27,
+    0x8C, 0xD8, 0x0C, 0x2E, 0xC1, 0x34, 0xD3, 0x1C, 0xE7, 0x86, 0x2E, 0x10, 0xC6, 0xFA, 0x73, 0xAF,
+    0x0D, 0x7D, 0x04, 0x8D, 0x34, 0x02, 0x7B, 0x40, 0x97, 0xC1, 0xED, 0xB5, 0xBB, 0x3E, 0x41, 0xFF,
+    0x80, 0x67, 0xF9, 0x59, 0x40, 0xD4, 0xA6, 0xE5, 0xA1, 0xE6, 0x1B, 0x0C, 0x2B, 0x4C, 0x11, 0x2E,
+    0xBD, 0x9C, 0xB7, 0xC2, 0x83, 0xA1, 0xFD, 0x52, 0x9F, 0xE6, 0xFA, 0x44, 0xD0, 0x66, 0xF0, 0x0B,
+    0xA6, 0xD4, 0x69, 0x6A, 0xA4, 0xDB, 0x21, 0x44, 0xBA, 0x0C, 0x61, 0xC6, 0xED, 0xE0, 0x81, 0x27,
+    0xCE, 0xE1, 0x9B, 0x8D, 0x3F, 0x14, 0xAF, 0x79, 0xFC, 0xBD, 0xD1, 0xE8, 0x5E, 0xEC, 0x94, 0xEE,
+    0x1C, 0x5F, 0xF5, 0xDF, 0x7E, 0xA6, 0xFD, 0x6E, 0xE2, 0xB7, 0x0A, 0xFC, 0x2A, 0xDC, 0x18, 0x21,
+    0x40, 0x93, 0xA1, 0x4B, 0x30, 0x44, 0x08, 0x3C, 0xFE, 0x8A, 0x5E, 0x9E, 0xA4, 0x22, 0xE9, 0xFE,
+    0x55, 0xB8, 0x1A, 0x1F, 0x7D, 0x4A, 0x93, 0x6B, 0xFF, 0x4F, 0xE3, 0x76, 0x14, 0xBB, 0x4C, 0x98,
+    0xDD, 0x66, 0x0A, 0x53, 0x1C, 0x92, 0xDD, 0x79, 0x0C, 0x9E, 0xBA, 0x7A, 0x46, 0xFA, 0x13, 0xE9,
+    0x8E, 0x8E, 0xA7, 0xAE, 0x6E, 0xDF, 0x9C, 0xC3, 0x1B, 0x72, 0xD9, 0xC7, 0x27, 0x01, 0x28, 0x00,
+    0x61, 0x04, 0xA6, 0x99, 0x4A, 0x50, 0x86, 0x95, 0xBA, 0x2A, 0xBA, 0x0D, 0x68, 0x77, 0xEA, 0xD2,
+    0x31, 0x95, 0xFB, 0xDE, 0xE7, 0x95, 0xFE, 0xFF, 0xFA, 0x95, 0xF8, 0xC8, 0x2B, 0x37, 0x6E, 0xD7,
+    0xE9, 0x3F, 0x5E, 0x80, 0xA0, 0x95, 0x56, 0xDA, 0x19, 0xA4, 0x4C, 0x48, 0xAE, 0x18, 0xCD, 0xAD,
+    0xAC, 0xB0, 0x6A, 0x0F, 0xAC, 0x5C, 0xC6, 0xAA, 0xDF, 0xB0, 0x1A, 0x12, 0x56, 0x3E, 0xD1, 0x16,
+    0xBF, 0xD2, 0x1E, 0xD3, 0x8A, 0xCB, 0xD3, 0x82, 0xDB, 0xA7, 0x85, 0x21, 0x4D, 0x2B, 0x7E, 0x9D,
+    0x56, 0x14, 0x7D, 0x6A, 0x34, 0xFA, 0xE3, 0xCE, 0x41, 0x2F, 0x6D, 0x74, 0x52, 0xAC, 0x0A, 0x85,
+    0x07, 0xFA, 0xAC, 0x87, 0x5B, 0x62, 0x50, 0x36, 0xD2, 0xDA, 0x48, 0x23, 0x2E, 0xC3, 0x94, 0x68,
+    0x34, 0xE3, 0x0E, 0xF0, 0x1B, 0x28, 0xD2, 0x0A, 0x86, 0x1D, 0xB4, 0x60, 0x05, 0x7D, 0x86, 0xF0,
+    0x50, 0xA3, 0x44, 0xAF, 0x62, 0xA5, 0xA3, 0x97, 0x12, 0x7C, 0xEC, 0x3E, 0xB4, 0x52, 0x64, 0x90,
+    0x12, 0xE1, 0xED, 0xB0, 0xA3, 0xD8, 0xE7, 0x46, 0xB8, 0x6C, 0x32, 0x2E, 0xF3, 0x11, 0xFA, 0x9D,
+    0xDA, 0x3B, 0x61, 0x85, 0x46, 0x11, 0x3A, 0x01, 0x43, 0x06, 0x94, 0xC0, 0x2A, 0x42, 0x5F, 0x80,
+    0x69, 0xBB, 0x34, 0x28, 0x80, 0x97, 0x14, 0x83, 0xA4, 0x28, 0x49, 0xF3, 0x24, 0x15, 0xE0, 0x63,
+    0x7B, 0xD5, 0x10, 0x8D, 0x54, 0xE8, 0xCB, 0xAB, 0x19, 0xCD, 0xFD, 0x66, 0x77, 0xFC, 0xD2, 0x46,
+    0xA3, 0x11, 0x5C, 0x06, 0x14, 0xEB, 0x08, 0xBD, 0x66, 0x5A, 0x69, 0xC4, 0x49, 0x23, 0xBF, 0xFC,
+    0x9C, 0x38, 0x1B, 0x0C, 0xE9, 0x6C, 0xD5, 0x15, 0x30, 0x4A, 0x98, 0x20, 0x82, 0x94, 0x8C, 0x74,
+    0xD0, 0xA8, 0x8C, 0x70, 0xEE, 0x5B, 0xB3, 0x52, 0x45, 0x8D, 0x29, 0x81, 0xD1, 0x0A, 0xAD, 0x56,
+    0xE8, 0xB5, 0xC0, 0xA4, 0x88, 0x91, 0x8F, 0xB4, 0x79, 0x9A, 0xE9, 0x53, 0x18, 0x99, 0xA2, 0x30,
+    0x42, 0xB4, 0xD9, 0x88, 0x3E, 0x35, 0x85, 0x49, 0x52, 0x0E, 0xD7, 0x1F, 0x83, 0xA4, 0xAD, 0x4A,
+    0x38, 0x6E, 0xBB, 0x70, 0x55, 0x9F, 0x4E, 0xBE, 0xBC, 0x71, 0x75, 0xF5, 0x2C, 0x5E, 0x5A, 0x8D,
+    0xA4, 0xB1, 0x93, 0x32, 0x7E, 0x39, 0x39, 0xAC, 0xCD, 0x17, 0x72, 0x4A, 0x23, 0xAD, 0x34, 0xD3,
+    0x4B, 0x33, 0x0C, 0x1A, 0xC1, 0x15, 0xEA, 0xA6, 0xE1, 0x13, 0x18, 0xCD, 0xE0, 0x0E, 0x20, 0x24,
+    0xE8, 0x35, 0x9A, 0xCF, 0x6A, 0x43, 0xD5, 0x88, 0xAD, 0xB4, 0x7A, 0x0B, 0xCC, 0xC9, 0x22, 0xB7,
+    0x36, 0x68, 0x75, 0xC0, 0xA4, 0xFB, 0x34, 0x3A, 0x4E, 0xD3, 0xE5, 0x8F, 0x73, 0x97, 0x1A, 0xCD,
+    0xD0, 0xEA, 0xF7, 0xC0, 0x49, 0x2B, 0xBD, 0x94, 0xF1, 0x92, 0xF0, 0x6B, 0xAB, 0x71, 0x5A, 0x1A,
+    0xCD, 0x21, 0x9A, 0xFA, 0x31, 0x9E, 0x1F, 0x8D, 0x98, 0xD6, 0xB6, 0xE0, 0xF7, 0x3E, 0x5F, 0xF3,
+    0xE6, 0x82, 0x09, 0x85, 0x3A, 0xB0, 0xB9, 0xBA, 0xBA, 0x1A, 0xFD, 0x65, 0x8B, 0x5B, 0x49, 0x79,
+    0xF8, 0xDE, 0x95, 0xA2, 0x70, 0xD9, 0x6E, 0x84, 0xC5, 0xC5, 0xF6, 0x00, 0xA6, 0x15, 0xAC, 0xCE,
+    0x55, 0x35, 0x1A, 0x2B, 0x8F, 0x1A, 0xC5, 0x73, 0x33, 0xC3, 0x0A, 0xAD, 0x4E, 0xC2, 0xD4, 0xDB,
+    0xC7, 0xD9, 0x1A, 0x8D, 0x17, 0x29, 0xAD, 0xDB, 0xF9, 0xB1, 0x1D, 0x9C, 0x0A, 0x46, 0x2A, 0xF4,
+    0xC7, 0x73, 0x19, 0xCD, 0x6E, 0x6B, 0x33, 0x7E, 0x19, 0x92, 0x11, 0x21, 0xBA, 0x1D, 0x7D, 0x43,
+    0xB1, 0x91, 0x32, 0x8D, 0x34, 0xD2, 0x69, 0xC7, 0x48, 0x3B, 0xC3, 0x3E, 0xED, 0x46, 0xA3, 0x4F,
+    0x6E, 0x63, 0x5A, 0x42, 0x44, 0x5F, 0x2A, 0xD8, 0xC3, 0x65, 0x86, 0x34, 0xE4, 0x46, 0xB3, 0x97,
+    0x76, 0x26, 0x69, 0x66, 0xD0, 0x7A, 0x21, 0xEE, 0xAD, 0xB7, 0x81, 0x49, 0x3B, 0xF5, 0xC9, 0xF4,
+    0x76, 0xD8, 0xF0, 0xA9, 0x2D, 0xF4, 0x5B, 0xD5, 0x66, 0x43, 0x6A, 0x44, 0x9B, 0x51, 0x6C, 0x84,
+    0x4F, 0x84, 0xD8, 0x15, 0x7C, 0x42, 0xDF, 0xBB, 0x73, 0xEA, 0x89, 0x46, 0x2A, 0x70, 0x4B, 0x02,
+    0xAC, 0x46, 0xB0, 0x9A, 0x4F, 0xC9, 0xE9, 0x14, 0x61, 0xD0, 0xCC, 0xCD, 0xCA, 0xE6, 0x05, 0x8C,
+    0x36, 0xE0, 0xC6, 0x29, 0xFA, 0x6E, 0x71, 0xB9, 0x95, 0xD1, 0x38, 0x8C, 0xEF, 0x32, 0xBB, 0xE6,
+    0xC5, 0x46, 0x28, 0xFA, 0xE4, 0xD2, 0x85, 0xD7, 0x0F, 0xAC, 0xB0, 0xA2, 0x3D, 0x68, 0xF6, 0xF7,
+    0x37, 0xD6, 0x4F, 0x83, 0x66, 0x14, 0x09, 0x91, 0x30, 0xA3, 0xD1, 0x14, 0xDA, 0xCC, 0x90, 0xF0,
+    0x33, 0x8F, 0x01, 0x30, 0x42, 0x3F, 0xD3, 0x0A, 0xA3, 0x8D, 0xE9, 0x60, 0xD0, 0xD8, 0x69, 0xC6,
+    0x27, 0xD0, 0x06, 0xD3, 0x71, 0x11, 0xCC, 0x95, 0x46, 0x1B, 0x84, 0x08, 0xFF, 0x14, 0xE0, 0xE5,
+    0x97, 0x5F, 0xFE, 0x2F, 0x92, 0xEE, 0x49, 0xFA, 0xBD, 0xAB, 0xAB, 0xAB, 0x73, 0xC4, 0xC7, 0x5F,
+    0x7E, 0xF9, 0x62, 0x1E, 0xDE, 0x7E, 0xF9, 0xE5, 0x97, 0xEF, 0x3E, 0x01, 0xEC, 0x55, 0x72, 0x2F,
+    0xDD, 0x98, 0xEB, 0x7E, 0x0B, 0x0C, 0x3B, 0xB7, 0x34, 0xB6, 0x5A, 0xCE, 0xE1, 0x8D, 0x46, 0xEC,
+    0x72, 0x0A, 0x73, 0x19, 0x9D, 0xD6, 0x41, 0xDB, 0xA0, 0x3C, 0x7C, 0x26, 0x3F, 0xD6, 0x64, 0x9A,
+    0x8C, 0xDD, 0x4F, 0xE7, 0x55, 0xD8, 0x8C, 0x4B, 0x0C, 0x33, 0xFE, 0xF7, 0xF0, 0x85, 0x21, 0x73,
+    0xF3, 0xE2, 0xBE, 0x0E, 0x0B, 0x7E, 0x65, 0x5A, 0xF0, 0xF1, 0xA4, 0xEE, 0xCD, 0xF0, 0xE7, 0x00,
+    0x37, 0x25, 0xCD, 0x54, 0xA7, 0x61, 0x81, 0x41, 0xFF, 0xF9, 0xB3, 0x5A, 0xB0, 0xBA, 0x0B, 0x8A,
+    0xA7, 0xF2, 0x9B, 0xED, 0x69, 0x25, 0x86, 0xD5, 0x7C, 0xE5, 0xE9, 0xE6, 0x30, 0xC2, 0x97, 0x6C,
+    0x37, 0x97, 0xAC, 0xB4, 0xBA, 0x75, 0x1A, 0xFD, 0x22, 0xFC, 0x97, 0xB2, 0x39, 0x4C, 0xE6, 0x70,
+    0xAB, 0x4B, 0xDD, 0xDA, 0x6E, 0xD3, 0x38, 0x8D, 0x7E, 0x1C, 0x5E, 0xCF, 0x4D, 0x36, 0x19, 0xB9,
+    0xE4, 0x92, 0x4B, 0xED, 0xE6, 0xA3, 0x8F, 0xD3, 0xEC, 0xA3, 0x90, 0x3D, 0xEC, 0x61, 0xB3, 0xD5,
+    0x6B, 0xFB, 0xB4, 0xB8, 0xD4, 0xE9, 0xBB, 0x3A, 0xF0, 0xB1, 0x2F, 0x4E, 0x91, 0x30, 0xDE, 0xBA,
+    0xDB, 0xBD, 0x84, 0xA9, 0xBE, 0x0B, 0x75, 0x0A, 0xA7, 0x7E, 0xFD, 0x39, 0x70, 0x1A, 0xE9, 0x17,
+    0x70, 0x92, 0x04, 0x74, 0x92, 0x56, 0xA0, 0x91, 0xEA, 0xE6, 0x5F, 0x4C, 0x17, 0x54, 0x4B, 0xEA,
+    0x23, 0x17, 0x05, 0x4A, 0xA3, 0x05, 0x2A, 0xD1, 0x4F, 0xD7, 0x17, 0x53, 0x04, 0xE0, 0x7F, 0x3F,
+    0x01, 0x5D, 0x12, 0x40, 0x71, 0x1B, 0xE0, 0xA3, 0x66, 0x68, 0xB7, 0x2E, 0x03, 0x22, 0x44, 0x18,
+    0x96, 0x36, 0x83, 0x3D, 0xAE, 0xC2, 0x02, 0x92, 0x0A, 0xF4, 0x92, 0x12, 0xB6, 0xBC, 0xFC, 0x8A,
+    0x20, 0xCC, 0x0C, 0x09, 0x97, 0x68, 0x34, 0x36, 0x05, 0xFA, 0xDD, 0x84, 0xB7, 0xE8, 0xB4, 0x05,
+    0x2D, 0xAD, 0xF4, 0x75, 0x65, 0x82, 0x32, 0xDC, 0xB8, 0x02, 0x82, 0x34, 0x32, 0x49, 0x85, 0x4E,
+    0x45, 0x1B, 0x57, 0x7A, 0x46, 0x91, 0x7E, 0xEB, 0x32, 0x8D, 0x98, 0x22, 0x3E, 0xB5, 0x19, 0x5B,
+    0x08, 0x33, 0xD3, 0xE2, 0x12, 0x6D, 0xF9, 0xE7, 0xC7, 0xF9, 0x9A, 0x93, 0x0E, 0xD0, 0xF7, 0x95,
+    0xE8, 0x37, 0xAB, 0xB9, 0x11, 0x7D, 0xC6, 0x27, 0x14, 0xAD, 0x70, 0x19, 0xBF, 0xD6, 0x38, 0x67,
+    0x38, 0x45, 0x73, 0x92, 0x34, 0x0F, 0x92, 0x16, 0x2B, 0xE9, 0xEE, 0x03, 0xD1, 0xB8, 0x02, 0x6E,
+    0xA9, 0x8C, 0x78, 0x69, 0x63, 0x92, 0x32, 0xA1, 0x3C, 0x23, 0xA6, 0x8D, 0x21, 0xFA, 0x44, 0xB7,
+    0xFA, 0x0D, 0x9B, 0xFA, 0x1D, 0x6E, 0xBB, 0x83, 0x53, 0xA9, 0x19, 0xCD, 0xA7, 0x0E, 0xC3, 0xEF,
+    0x9C, 0x4A, 0xDC, 0x6A, 0x3E, 0x35, 0x2F, 0x43, 0x86, 0xBF, 0xD7, 0x29, 0xD2, 0xA3, 0x83, 0x3B,
+    0xD1, 0x4B, 0x4A, 0x56, 0x52, 0xC2, 0x4B, 0x2B, 0x46, 0x9A, 0x81, 0x67, 0xEB, 0x8E, 0x5D, 0x8D,
+    0x95, 0x1C, 0x0B, 0x4C, 0x92, 0x16, 0x3A, 0x49, 0x9A, 0xF9, 0x6D, 0xBD, 0x10, 0x0E, 0xE8, 0x37,
+    0xA3, 0x44, 0x23, 0xAC, 0x46, 0x7C, 0x62, 0xC8, 0x58, 0x61, 0x14, 0x99, 0x56, 0x5C, 0xA6, 0x3D,
+    0x38, 0x65, 0xDB, 0x65, 0x5C, 0x06, 0x45, 0x14, 0xE9, 0x33, 0xFD, 0x4E, 0xA3, 0xB9, 0xD1, 0x88,
+    0xDF, 0x18, 0x12, 0xAD, 0xB0, 0x02, 0x2D, 0xF8, 0x84, 0xDF, 0x69, 0x0B, 0xBD, 0x20, 0x7C, 0xEF,
+    0x8E, 0x22, 0x93, 0xA4, 0x95, 0x41, 0xD2, 0xCA, 0xBB, 0x88, 0xE4, 0x24, 0x6D, 0x04, 0x49, 0x8B,
+    0xA9, 0x7C, 0xE7, 0xD7, 0x7F, 0x98, 0x31, 0x1A, 0xDB, 0x44, 0x97, 0xE9, 0x67, 0x7C, 0xE2, 0x77,
+    0xAA, 0x75, 0xA6, 0x2D, 0x00, 0xFD, 0x46, 0x5D, 0xD5, 0x8C, 0x55, 0x35, 0x4E, 0x4A, 0xD5, 0x2E,
+    0x54, 0x7B, 0x70, 0xF2, 0xA4, 0x4F, 0xFC, 0x02, 0x68, 0x36, 0x99, 0xF6, 0xC0, 0xAD, 0x0C, 0x9B,
+    0x09, 0x63, 0x2B, 0x29, 0x13, 0x2E, 0x64, 0xD3, 0x58, 0x27, 0xB1, 0x36, 0x92, 0x0A, 0xBD, 0xA4,
+    0x15, 0x97, 0x6F, 0x1C, 0x18, 0xCD, 0x2E, 0x32, 0x6C, 0x64, 0xAC, 0x70, 0x63, 0xB5, 0x20, 0x75,
+    0x0A, 0xD3, 0x02, 0x74, 0xE5, 0x5F, 0xBE, 0x08, 0x92, 0x4E, 0x33, 0x68, 0xF4, 0x17, 0x5F, 0x86,
+    0x61, 0xBB, 0x6C, 0x65, 0x7D, 0xA1, 0x7E, 0x9D, 0x56, 0xA0, 0x3B, 0x80, 0x56, 0x05, 0x1A, 0x69,
+    0x03, 0xAF, 0x53, 0x14, 0xAF, 0x46, 0xB8, 0x29, 0xBD, 0x45, 0x73, 0x21, 0x44, 0x26, 0x1C, 0x4C,
+    0xB1, 0x3F, 0x68, 0xB2, 0x15, 0xF8, 0x59, 0x0B, 0x36, 0xF5, 0x19, 0x9E, 0xB4, 0x1A, 0x2F, 0x9D,
+    0xD7, 0xD9, 0x84, 0xB5, 0x32, 0x8A, 0x53, 0xD1, 0x8A, 0xF4, 0xED, 0x42, 0xA7, 0x5D, 0x09, 0xAB,
+    0x4E, 0xE0, 0xD7, 0x69, 0xC7, 0x1E, 0x56, 0x2B, 0x53, 0xEC, 0xF5, 0xBD, 0xE7, 0xEA, 0xF2, 0xA3,
+    0x91, 0xB4, 0xD1, 0x48, 0x6F, 0x01, 0x4F, 0x9D, 0xBB, 0xD1, 0x48, 0x4B, 0x23, 0xAD, 0x5E, 0x99,
+    0x5E, 0x7B, 0xA3, 0x32, 0xE2, 0x32, 0x8D, 0x46, 0xCC, 0xA9, 0xB5, 0x87, 0x0D, 0xAB, 0xBA, 0xB0,
+    0x69, 0x05, 0x9F, 0xE8, 0x8E, 0x3A, 0x95, 0x10, 0x39, 0x39, 0xA7, 0x32, 0x5A, 0x04, 0x49, 0xDA,
+    0x4F, 0xA5, 0xF2, 0xBE, 0x5D, 0xF8, 0xDA, 0x45, 0x7B, 0xD4, 0x9F, 0x61, 0x79, 0xD0, 0xC5, 0x71,
+    0x7A, 0xA1, 0xF7, 0x09, 0x9A, 0x2F, 0x93, 0xF2, 0x3A, 0x5A, 0x29, 0x82, 0x93, 0xE8, 0xEA, 0x32,
+    0x66, 0xAC, 0x4E, 0xD1, 0x09, 0x4B, 0x25, 0x8D, 0xCB, 0xFC, 0x35, 0x37, 0xCB, 0xFB, 0xDC, 0x6C,
+    0x4B, 0x65, 0x9D, 0x9B, 0xBA, 0x4F, 0x27, 0x45, 0x5B, 0x55, 0x9F, 0xAB, 0x06, 0xBF, 0xAE, 0x63,
+    0xBE, 0xEC, 0xA5, 0xE2, 0x65, 0x43, 0x87, 0xED, 0xC2, 0x6C, 0x7F, 0xC3, 0x93, 0x2A, 0xD5, 0xD3,
+    0xF2, 0xD7, 0x3D, 0x09, 0xCB, 0x65, 0x47, 0xDD, 0x7E, 0x32, 0xCA, 0xCF, 0x5B, 0x41, 0xFF, 0xAD,
+    0x3A, 0x81, 0xB1, 0xFA, 0x1E, 0x35, 0xEE, 0x34, 0xFF, 0xE1, 0x22, 0x3A, 0x4E, 0x3B, 0x41, 0xFB,
+    0xA4, 0xC5, 0x48, 0xF3, 0x74, 0x80, 0x5F, 0x8D, 0x66, 0x8C, 0xC6, 0x61, 0x83, 0x2E, 0x37, 0x1A,
+    0xC1, 0xA7, 0xEA, 0xDF, 0xBE, 0x2E, 0xA0, 0x2D, 0x3E, 0x01, 0xFD, 0x8F, 0x2B, 0xE7, 0x68, 0x05,
+    0x6C, 0xE5, 0x43, 0x57, 0x63, 0xED, 0xE9, 0xDE, 0x01, 0x34, 0x7A, 0x2E, 0x03, 0x2E, 0x0F, 0xD5,
+    0x81, 0xF4, 0x3B, 0xA0, 0x79, 0xDA, 0xA0, 0x3D, 0xD0, 0x06, 0x43, 0x42, 0x1B, 0xAD, 0x76, 0x53,
+    0x67, 0x61, 0x94, 0xAD, 0xB4, 0x18, 0x45, 0xA8, 0x71, 0xA0, 0x93, 0x60, 0xA8, 0xBA, 0x7C, 0x3F,
+    0xC9, 0x63, 0x34, 0x9F, 0x52, 0x6A, 0x75, 0xA1, 0x41, 0x5B, 0x80, 0xF6, 0xB8, 0x48, 0x88, 0xCB,
+    0x97, 0x8F, 0x7E, 0xBF, 0x10, 0xCC, 0x27, 0x7E, 0x06, 0x9F, 0xF0, 0xF8, 0xC4, 0xC4, 0xB4, 0x52,
+    0x08, 0xCB, 0xCD, 0xA3, 0xBD, 0x78, 0xD0, 0xBB, 0x97, 0x94, 0x30, 0x12, 0x04, 0x41, 0x50, 0x64,
+    0x52, 0x45, 0x44, 0xBC, 0x66, 0x08, 0x07, 0xBD, 0x46, 0xF0, 0x1A, 0x9D, 0x16, 0xE8, 0xB5, 0xB4,
+    0xDA, 0xA0, 0x7B, 0x67, 0xB7, 0x3F, 0xCE, 0x60, 0xDF, 0x2E, 0x26, 0x0B, 0xC8, 0x53, 0x3C, 0x7C,
+    0x84, 0xD0, 0xA7, 0xD0, 0x27, 0xF0, 0x5F, 0xCA, 0xBE, 0xCD, 0xE0, 0x16, 0xDD, 0xF9, 0xA2, 0xA0,
+    0x4D, 0xFE, 0x5E, 0x0C, 0x11, 0x9B, 0x3B, 0xAD, 0x43, 0x82, 0xC3, 0x28, 0xB9, 0x1D, 0x26, 0xA6,
+    0xDD, 0x16, 0x18, 0xA2, 0xCB, 0x68, 0xC6, 0xAD, 0xF6, 0xC0, 0xAF, 0xB4, 0x1B, 0x01, 0xB7, 0xD3,
+    0x64, 0x86, 0xD1, 0x1E, 0xDC, 0xD4, 0x5D, 0xB8, 0xA5, 0xAD, 0x53, 0xE6, 0x0C, 0xA1, 0xA8, 0x9B,
+    0xEC, 0x85, 0x95, 0x18, 0xB4, 0x18, 0x29, 0x5A, 0x65, 0x06, 0xCD, 0x38, 0x8D, 0xA8, 0x86, 0x19,
+    0x7E, 0xA6, 0x51, 0xA6, 0x5F, 0x40, 0x9A, 0xBB, 0x0D, 0xBC, 0x92, 0xCD, 0xE0, 0xEE, 0x1D, 0x08,
+    0xDA, 0x1F, 0x29, 0xFA, 0x99, 0x26, 0xFB, 0xAD, 0x5F, 0x40, 0xAD, 0xBA, 0x04, 0x3E, 0xEA, 0x8D,
+    0x0C, 0xFD, 0x3A, 0xEC, 0x82, 0x6E, 0xB3, 0x9A, 0x66, 0x9A, 0x4C, 0xD0, 0x02, 0xC2, 0x29, 0x81,
+    0x9F, 0x1B, 0x65, 0xE8, 0x17, 0xA6, 0x02, 0xDD, 0x86, 0xD3, 0x4C, 0xA7, 0xD9, 0x68, 0xA1, 0xD7,
+    0x8E, 0x4F, 0x38, 0x1D, 0x35, 0xE2, 0xE0, 0x12, 0x0D, 0x5D, 0x8D, 0xC0, 0xA0, 0x1D, 0x1A, 0x9D,
+    0xC6, 0x53, 0x0B, 0xBE, 0xFC, 0xBA, 0x12, 0x4A, 0x4C, 0x7B, 0xA3, 0x88, 0xCF, 0x56, 0x23, 0x7D,
+    0xEE, 0x04, 0xFD, 0xE1, 0x0E, 0x70, 0x47, 0x9F, 0xC1, 0x1D, 0x43, 0x86, 0xFE, 0xF0, 0x3B, 0xF4,
+    0xD9, 0xEF, 0x30, 0x64, 0xBF, 0x83, 0xDF, 0xFD, 0x0E, 0x7E, 0xF3, 0x3B, 0x84, 0xE4, 0x33, 0x68,
+    0x19, 0x0E, 0xAC, 0xA2, 0x13, 0x4E, 0x74, 0xFA, 0x5E, 0x38, 0xA8, 0x26, 0x8F, 0xEA, 0x6B, 0x55,
+    0xF6, 0x3A, 0xDD, 0x92, 0x1B, 0x57, 0xC0, 0x50, 0x63, 0x1A, 0x29, 0x31, 0x48, 0x4A, 0xFC, 0xB6,
+    0xBE, 0xA8, 0x95, 0xF6, 0x68, 0x14, 0x19, 0x92, 0x15, 0x28, 0xBA, 0x8C, 0x15, 0x3E, 0xD1, 0xEF,
+    0x46, 0x33, 0xD3, 0xE2, 0x32, 0x8D, 0xD0, 0x8A, 0x3B, 0xEE, 0x14, 0xF0, 0xD2, 0x52, 0x7D, 0x7D,
+    0x3A, 0xBD, 0x74, 0x91, 0xD0, 0x2A, 0xE5, 0xD5, 0x7B, 0xEA, 0x77, 0x2E, 0xD2, 0xDB, 0x9F, 0x64,
+    0xD8, 0xC0, 0xE9, 0x94, 0x81, 0xAB, 0x91, 0x0B, 0x81, 0x30, 0x0F, 0x6C, 0xCD, 0xC2, 0x49, 0x23,
+    0x94, 0x08, 0x3B, 0x95, 0x4A, 0x58, 0x8D, 0x0C, 0x99, 0x4A, 0x27, 0x2A, 0xA1, 0xA8, 0x94, 0xAA,
+    0xE1, 0xEB, 0x41, 0xA5, 0x15, 0x95, 0x58, 0xF5, 0xCF, 0x4E, 0x25, 0x17, 0x7E, 0x87, 0x29, 0x51,
+    0x09, 0x46, 0x9F, 0x69, 0x14, 0x2B, 0xBD, 0xA0, 0xD3, 0x37, 0x42, 0xE6, 0x42, 0x34, 0xEA, 0x54,
+    0xF0, 0x7A, 0x11, 0xA0, 0xD3, 0x58, 0x11, 0xB7, 0xFB, 0xD4, 0xE9, 0xDE, 0xA7, 0x2A, 0x05, 0xFD,
+    0x57, 0x60, 0x92, 0xAA, 0x3E, 0x50, 0x06, 0xB8, 0xA5, 0xF5, 0xDA, 0x78, 0xDF, 0xB8, 0xAA, 0xEE,
+    0x6E, 0x0D, 0x66, 0x04, 0x41, 0xF7, 0x14, 0xB9, 0xD2, 0x0B, 0x5A, 0x31, 0x1A, 0xA7, 0x44, 0x8D,
+    0x61, 0x2A, 0x95, 0x6D, 0xC1, 0xAF, 0xB4, 0x85, 0xB0, 0xD0, 0x1E, 0x46, 0x33, 0x5D, 0xBE, 0x55,
+    0x8D, 0x67, 0xB5, 0x10, 0x33, 0xF4, 0x12, 0x30, 0xA4, 0xAA, 0xB7, 0x14, 0xC1, 0xA7, 0x69, 0x05,
+    0xBF, 0xFA, 0x1D, 0xA6, 0xC5, 0x1D, 0x10, 0x62, 0xA7, 0xB9, 0xD5, 0x6E, 0xB5, 0x0E, 0x2A, 0x28,
+    0x7B, 0x65, 0x86, 0x9D, 0x33, 0x8E, 0xBC, 0xF1, 0x2C, 0x35, 0xCA, 0x0F, 0xD2, 0xDC, 0x49, 0x85,
+    0x69, 0x6D, 0xB7, 0x46, 0xB8, 0xE8, 0x32, 0x1E, 0x9F, 0xCC, 0x86, 0x56, 0xB0, 0x4A, 0x27, 0x30,
+    0xDB, 0x29, 0x9F, 0x1F, 0xAD, 0x32, 0x34, 0xDA, 0xC1, 0x28, 0xB9, 0x68, 0x14, 0x27, 0xAC, 0x9A,
+    0x8C, 0xCB, 0x6E, 0x63, 0x5A, 0xFD, 0xD6, 0x09, 0x49, 0x5B, 0xDD, 0xCE, 0x49, 0x4B, 0x1D, 0x74,
+    0x90, 0xA4, 0x37, 0x24, 0x29, 0x7B, 0x49, 0x7A, 0xF3, 0xFE, 0x73, 0xC7, 0x67, 0xF6, 0x80, 0xA2,
+    0xFF, 0xD4, 0xDA, 0xEF, 0x36, 0xFD, 0x51, 0xA3, 0xF1, 0x0B, 0xCD, 0xEC, 0xD3, 0xCD, 0xF9, 0xE2,
+    0x1D, 0xAC, 0x0F, 0x0C, 0xF8, 0x72, 0xED, 0xB4, 0x28, 0x5E, 0xD8, 0xAA, 0xBA, 0x32, 0xEF, 0x76,
+    0x27, 0xDA, 0x02, 0xDC, 0xD4, 0x7D, 0x68, 0xA4, 0x04, 0x5E, 0xA5, 0xC2, 0xA4, 0x8D, 0xF4, 0x86,
+    0xB4, 0x78, 0xE5, 0x41, 0x5B, 0xA3, 0x83, 0x61, 0xA3, 0x11, 0x4D, 0x35, 0xB1, 0x3E, 0x61, 0x8F,
+    0x6A, 0xB2, 0x23, 0xD3, 0x4A, 0x9B, 0xE9, 0x0E, 0x08, 0x33, 0x8A, 0xB8, 0xAD, 0x3A, 0x77, 0x23,
+    0x8A, 0xF4, 0x89, 0x7E, 0xC7, 0x88, 0x46, 0x23, 0xC3, 0xC3, 0x6F, 0xFA, 0x88, 0x4F, 0x74, 0xB9,
+    0x7A, 0x7A, 0x23, 0x7E, 0x67, 0x4A, 0x58, 0xBD, 0x1D, 0x8E, 0xEA, 0xAD, 0x8F, 0x30, 0x49, 0x0B,
+    0x54, 0xCD, 0x72, 0x3A, 0x15, 0x93, 0x76, 0x2B, 0x0D, 0x2A, 0x46, 0x7A, 0x53, 0x07, 0xBD, 0xE6,
+    0x61, 0xC7, 0x68, 0x6C, 0xCB, 0x25, 0x78, 0x9C, 0x22, 0x3E, 0xE1, 0x57, 0x5C, 0xA6, 0x4F, 0x34,
+    0x3A, 0xF1, 0xD1, 0x36, 0x83, 0xDB, 0x6C, 0x06, 0x7B, 0x98, 0x02, 0x68, 0x16, 0x30, 0xAC, 0x61,
+    0x84, 0x2E, 0xFB, 0x08, 0x46, 0xC3, 0x02, 0xF8, 0xAF, 0x57, 0x7B, 0x5D, 0x3D, 0xAE, 0x2A, 0x95,
+    0x19, 0xA0, 0x3F, 0xE0, 0xC4, 0x03, 0x4E, 0x54, 0xAE, 0x5E, 0x5E, 0x99, 0x97, 0x90, 0x5E, 0x55,
+    0xE1, 0x35, 0x26, 0x7D, 0x53, 0x07, 0x3E, 0x76, 0x5A, 0xFB, 0x9D, 0x21, 0x31, 0xC5, 0xB6, 0xE0,
+    0x32, 0x7E, 0x31, 0x9A, 0x3B, 0xD1, 0x27, 0x7C, 0xB2, 0x8A, 0x6E, 0xC3, 0xE5, 0x46, 0xC9, 0x66,
+    0xAC, 0x50, 0x6E, 0x0E, 0x50, 0x0C, 0x42, 0x30, 0x24, 0x3F, 0xC5, 0x30, 0xD2, 0xE5, 0xFE, 0x7F,
+    0x26, 0x1F, 0x69, 0xE4, 0xBE, 0x79, 0x0C, 0x0B, 0x4C, 0x6F, 0xA6, 0xF0, 0xE9, 0x04, 0xFD, 0x0F,
+    0xB7, 0xFE, 0x4F, 0x36, 0xB0, 0x47, 0x6E, 0xDF, 0xD9, 0x01, 0x15, 0xA3, 0x0C, 0x78, 0xE1, 0x0B,
+    0xE0, 0x34, 0xBB, 0x6A, 0x15, 0xA3, 0xBD, 0xC4, 0x01, 0x8A, 0x15, 0xA0, 0xAA, 0xEC, 0xB2, 0x57,
+    0x74, 0xE8, 0xFA, 0x1A, 0x94, 0x9D, 0x76, 0xA4, 0x75, 0xD2, 0xD2, 0xE8, 0x60, 0xBA, 0x5F, 0xDF,
+    0x1A, 0x41, 0xD1, 0x6D, 0xD0, 0x68, 0x0E, 0x23, 0x58, 0x75, 0xD5, 0xB3, 0x98, 0x66, 0xC0, 0x55,
+    0x12, 0x0D, 0x55, 0x4F, 0xF9, 0xAA, 0xD4, 0xEB, 0x9E, 0x75, 0xF5, 0x5E, 0xD0, 0x08, 0xB4, 0xEF,
+    0x54, 0xEF, 0xF5, 0x77, 0x0F, 0xA0, 0xCD, 0x2E, 0x03, 0x3E, 0xFA, 0x0D, 0xEC, 0xC1, 0x94, 0xC0,
+    0x2F, 0x68, 0xA1, 0xD3, 0xDD, 0x56, 0x6F, 0x21, 0x2D, 0x52, 0x6A, 0xA5, 0xB6, 0x82, 0x1E, 0xD9,
+    0x69, 0x97, 0xD6, 0x49, 0xDF, 0xD1, 0xC1, 0x74, 0xA0, 0x48, 0x98, 0x2B, 0xBA, 0xD1, 0x1E, 0xF8,
+    0x88, 0xCB, 0xCD, 0x01, 0x43, 0xEA, 0x57, 0x98, 0x16, 0x01, 0xFA, 0x7A, 0x82, 0x46, 0x75, 0xC6,
+    0x3B, 0xE0, 0xAA, 0x40, 0xE4, 0x6B, 0x27, 0xBA, 0x8A, 0x45, 0x97, 0x79, 0x54, 0x1F, 0xB7, 0x05,
+    0x30, 0xA1, 0x54, 0x59, 0x04, 0xCE, 0xA8, 0x75, 0x92, 0x34, 0x0E, 0x92, 0x92, 0x93, 0x94, 0xED,
+    0xFD, 0x71, 0x38, 0x4C, 0xA6, 0x2F, 0x4C, 0xB8, 0x82, 0x1B, 0x9D, 0x00, 0xA7, 0x8B, 0x1E, 0x6C,
+    0xEB, 0xC7, 0xFC, 0x30, 0xAA, 0x62, 0x15, 0xCF, 0x08, 0xD7, 0x68, 0x31, 0x77, 0x8D, 0x56, 0x32,
+    0x5A, 0x99, 0x50, 0xC2, 0xC7, 0x90, 0xB8, 0x93, 0x26, 0x49, 0xBB, 0x93, 0x94, 0x6B, 0x20, 0x71,
+    0x82, 0x2A, 0xDA, 0xE9, 0xB4, 0xE2, 0x55, 0x31, 0xF4, 0xBD, 0x82, 0xFA, 0x27, 0xB2, 0xDE, 0xAF,
+    0x8F, 0x22, 0xFF, 0x11, 0x53, 0x4E, 0xF8, 0x3D, 0xFE, 0x3F, 0xB6, 0x7F, 0x1B, 0x94, 0x69, 0x55,
+    0x99, 0x63, 0x98, 0x21, 0x54, 0x28, 0xDA, 0xE6, 0xDA, 0xC2, 0xAD, 0xB5, 0xD7, 0x69, 0xAC, 0x59,
+    0x81, 0x5C, 0x7B, 0x77, 0xA9, 0x8E, 0xE0, 0x67, 0x10, 0x98, 0xE3, 0x7C, 0x23, 0xD5, 0xD1, 0x7C,
+    0xAC, 0x28, 0xF6, 0xD9, 0x51, 0xBB, 0xD5, 0x37, 0x9E, 0x1A, 0x69, 0xB4, 0xE3, 0xB4, 0xE0, 0xFF,
+    0xD6, 0xD6, 0xD2, 0x94, 0x8A, 0x7F, 0x3E, 0xDA, 0xFE, 0xA3, 0xC2, 0x28, 0x57, 0x8C, 0xF5, 0x72,
+    0xD9, 0x03, 0xD0, 0x5C, 0x91, 0x4C, 0x5F, 0xA0, 0xBF, 0x17, 0x71, 0xDF, 0xDD, 0xB0, 0x9B, 0x68,
+    0xF2, 0x10, 0x29, 0x76, 0x67, 0x1A, 0x85, 0x8F, 0xFD, 0xD2, 0xAF, 0x36, 0x77, 0x09, 0xD9, 0x4C,
+    0xFF, 0x9D, 0x52, 0xE1, 0x3F, 0xB8, 0xBA, 0xBA, 0xBA, 0xF2, 0x27, 0xBA, 0xF4, 0xF6, 0xCB, 0x2F,
+    0xBF, 0xFC, 0x07, 0x8F, 0x91, 0xDC, 0xEA, 0x97, 0x10, 0xA7, 0x38, 0x8D, 0xBF, 0x02, 0xF0, 0x79,
+    0x73, 0x9B, 0x56, 0x5F, 0x4F, 0x27, 0xA0, 0xFD, 0x8E, 0x16, 0xA3, 0x39, 0x44, 0x5B, 0x08, 0xB1,
+    0xCB, 0x68, 0x76, 0x3B, 0xA2, 0x4F, 0x46, 0xD5, 0xA3, 0xF0, 0x6B, 0x5B, 0xF0, 0xAB, 0x3B, 0xF0,
+    0xEB, 0x70, 0xE0, 0xD7, 0xD7, 0xF2, 0x3F, 0xF1, 0x7F, 0x75, 0x5F, 0x79, 0xD0, 0x9F, 0x6A, 0xEF,
+    0xF5, 0x82, 0xD6, 0xAE, 0xA0, 0x91, 0xDB, 0x3C, 0x51, 0xE1, 0xF8, 0x41, 0xA7, 0xCE, 0x0A, 0x3A,
+    0x51, 0x68, 0x7B, 0x9C, 0xC0, 0x4A, 0x9B, 0x81, 0x30, 0x3F, 0x8F, 0x4B, 0xD3, 0x86, 0x06, 0x45,
+    0xF7, 0x7D, 0x65, 0x53, 0xF6, 0xB0, 0x0C, 0xC5, 0x1E, 0x56, 0xD1, 0x2F, 0x3E, 0xD9, 0xA3, 0x2D,
+    0x4C, 0x71, 0x8A, 0x5D, 0xEE, 0x76, 0x34, 0x6B, 0xEC, 0x93, 0x4B, 0x8D, 0x8C, 0x98, 0xA2, 0xDF,
+    0xFA, 0xDD, 0x4A, 0x85, 0x49, 0x9A, 0xDB, 0x1F, 0x5F, 0x4C, 0x15, 0x3C, 0x3D, 0xE2, 0x6A, 0xDC,
+    0x34, 0xA8, 0x18, 0x7D, 0x22, 0xB9, 0x8D, 0x31, 0x3C, 0x94, 0x8D, 0x8A, 0xD8, 0x52, 0x43, 0x11,
+    0x9F, 0x98, 0x15, 0xFB, 0x4F, 0xEA, 0xFB, 0x47, 0x2B, 0x25, 0xA7, 0x42, 0xA7, 0xF9, 0x02, 0x14,
+    0x9B, 0xDB, 0xA7, 0x9E, 0x6D, 0x74, 0xF9, 0xA8, 0x92, 0xE9, 0x1E, 0x01, 0xB3, 0x3F, 0xDF, 0x27,
+    0x5A, 0xDD, 0x5B, 0x19, 0xA4, 0x85, 0xF0, 0x8E, 0xE2, 0x35, 0x21, 0xE7, 0x2E, 0xA3, 0xF1, 0x11,
+    0x42, 0x96, 0x47, 0x09, 0x99, 0xFF, 0x26, 0x42, 0xF2, 0xF4, 0x48, 0xAF, 0xD8, 0x48, 0xF3, 0xF0,
+    0x67, 0x32, 0x87, 0xCD, 0x6E, 0xED, 0xD7, 0x80, 0xEC, 0xDE, 0x6D, 0xFD, 0x37, 0x34, 0x86, 0xB0,
+    0x59, 0x15, 0x9C, 0x46, 0xFC, 0xC2, 0x5D, 0x8D, 0xFD, 0x1B, 0xFA, 0x4C, 0x79, 0x9F, 0xE5, 0xF0,
+    0xB1, 0x17, 0xA1, 0xE2, 0xDD, 0x35, 0x76, 0x61, 0xF8, 0xB3, 0x02, 0xF8, 0xF8, 0x3B, 0x40, 0x98,
+    0x39, 0x11, 0xE4, 0x13, 0x42, 0x6B, 0x04, 0x70, 0xE7, 0x8C, 0xCE, 0x04, 0xB6, 0x0A, 0x7E, 0xF5,
+    0x91, 0xAB, 0x86, 0x72, 0x3B, 0x17, 0x4A, 0x9C, 0xB8, 0x45, 0x9F, 0xB8, 0x64, 0x1C, 0xAA, 0x4E,
+    0xAF, 0x70, 0x7E, 0x0D, 0x0E, 0x6B, 0xB6, 0x88, 0x10, 0x39, 0x39, 0xFC, 0x7D, 0x06, 0xB4, 0x05,
+    0xF8, 0x95, 0xCA, 0x1F, 0xAF, 0xEE, 0x40, 0x8D, 0x55, 0x83, 0x66, 0xE0, 0xD6, 0x5B, 0xA7, 0xE2,
+    0xF9, 0x83, 0xB1, 0xFA, 0x79, 0x0B, 0xBD, 0x24, 0x8C, 0xBE, 0x58, 0x5E, 0xC2, 0xED, 0x6D, 0x06,
+    0x1F, 0x5D, 0xC2, 0x88, 0x29, 0xD2, 0xEE, 0xB6, 0x80, 0x4B, 0x7D, 0x02, 0xFF, 0x67, 0x35, 0x3C,
+    0x4A, 0xC0, 0x70, 0x1F, 0x68, 0x0A, 0x54, 0x99, 0x3D, 0x6D, 0x43, 0xA3, 0x1D, 0x98, 0x54, 0xA0,
+    0x2F, 0xD2, 0x68, 0x34, 0x0E, 0xC2, 0x25, 0x5C, 0xD5, 0xE6, 0x09, 0x8D, 0x84, 0x68, 0x75, 0xF7,
+    0xB9, 0x83, 0x56, 0xD2, 0x82, 0xAD, 0x6A, 0xF8, 0xCE, 0x9F, 0x9F, 0xA8, 0x69, 0x35, 0x2F, 0x41,
+    0xE3, 0xC9, 0x2D, 0x35, 0x32, 0x9D, 0x4F, 0xC6, 0xEF, 0x13, 0x10, 0xE2, 0x3F, 0xC6, 0x1E, 0x4E,
+    0xB8, 0x1F, 0x28, 0xE3, 0xBF, 0xAD, 0xCD, 0x94, 0xC3, 0x2F, 0x9D, 0xA2, 0xF0, 0xB9, 0xCD, 0x68,
+    0x19, 0xD6, 0x56, 0x68, 0x1C, 0x36, 0x9B, 0x51, 0xEC, 0x93, 0x2D, 0x84, 0xB9, 0xDF, 0xEC, 0xC1,
+    0x14, 0x5D, 0xFA, 0xF7, 0x62, 0xBA, 0xF7, 0xF5, 0xBD, 0x51, 0xF1, 0x4B, 0xAB, 0x3F, 0x55, 0xC5,
+    0xFF, 0x2B, 0x46, 0x6B, 0x0E, 0x7C, 0xEA, 0x44, 0x58, 0xDA, 0x13, 0xD1, 0x7E, 0xBE, 0x51, 0x0A,
+    0x7A, 0x3C, 0xAC, 0xCD, 0x81, 0x8F, 0x6D, 0x4D, 0x27, 0x22, 0xFA, 0x64, 0x0B, 0x7E, 0x69, 0xF3,
+    0x47, 0xA6, 0x7B, 0xBF, 0xAB, 0x2D, 0x14, 0x5B, 0xC6, 0x1B, 0x0F, 0x19, 0xDE, 0x78, 0x9A, 0xA2,
+    0x07, 0xC9, 0x85, 0xF0, 0x08, 0x32, 0xFE, 0x1B, 0x27, 0x1C, 0x6A, 0xB5, 0xC1, 0xE3, 0xD5, 0x78,
+    0x5C, 0x98, 0xE3, 0x7D, 0x57, 0x7D, 0xEE, 0xAC, 0xDB, 0x4F, 0x96, 0x30, 0xBA, 0x70, 0x91, 0x5F,
+    0x4F, 0xDF, 0xE5, 0xF2, 0xEB, 0x31, 0x23, 0xD8, 0xFB, 0xBD, 0xE6, 0xDB, 0x7A, 0x65, 0x6A, 0x8C,
+    0xFB, 0xF4, 0x05, 0x9C, 0x26, 0xE4, 0x4A, 0xE5, 0x41, 0xB1, 0x0E, 0xE7, 0xF6, 0xAA, 0x77, 0x8D,
+    0x80, 0x30, 0x7F, 0x0E, 0xFF, 0x35, 0x45, 0xF7, 0x97, 0xDA, 0xED, 0x8F, 0xDF, 0x96, 0x29, 0xAB,
+    0x9F, 0xC3, 0xEA, 0x56, 0x9F, 0xBA, 0xE4, 0xB6, 0x76, 0x6B, 0x73, 0xB7, 0x35, 0x0A, 0x09, 0x69,
+    0xC6, 0xDF, 0x5B, 0xE9, 0x7F, 0x78, 0xD0, 0xE6, 0x69, 0x69, 0x4A, 0x57, 0xD0, 0xA8, 0xE2, 0x17,
+    0xA7, 0xE7, 0x12, 0x9A, 0xC1, 0xC0, 0x53, 0x84, 0x3C, 0xE8, 0x75, 0x65, 0xC2, 0xEC, 0x76, 0x34,
+    0xF6, 0xA9, 0x11, 0x7E, 0xB5, 0x07, 0xD3, 0x25, 0x45, 0x8B, 0x78, 0xF4, 0xEE, 0x3F, 0x0B, 0xF7,
+    0x3E, 0xAD, 0xA4, 0xA3, 0x2D, 0xDC, 0x00, 0xF3, 0x39, 0x3E, 0xC7, 0xCF, 0x10, 0xB6, 0x3E, 0x77,
+    0x72, 0xFA, 0x8E, 0x92, 0x8E, 0x8F, 0xEA, 0x8E, 0xBE, 0xAD, 0xBD, 0x29, 0xBB, 0xFE, 0xC8, 0xAF,
+    0x4E, 0x9F, 0xD4, 0xA2, 0xD1, 0xEF, 0xEE, 0x68, 0xB3, 0x51, 0x9C, 0x52, 0x9F, 0xBA, 0xA3, 0xD1,
+    0xA8, 0xD9, 0x27, 0x97, 0xED, 0x81, 0x66, 0xBF, 0xF4, 0xA9, 0xCD, 0x46, 0x84, 0xD8, 0xA7, 0x2E,
+    0xDB, 0x83, 0x30, 0xFB, 0xD5, 0x6D, 0xFF, 0xE9, 0x40, 0xA3, 0xBF, 0xF7, 0xF5, 0xAD, 0xCD, 0x46,
+    0x65, 0x8A, 0x7D, 0x6A, 0xF5, 0x97, 0x85, 0x30, 0xBA, 0xA3, 0xF2, 0x05, 0xF0, 0x39, 0x3E, 0x4F,
+    0xD8, 0xFB, 0xC3, 0xE9, 0x3B, 0xCA, 0x1F, 0xD5, 0xAB, 0x4A, 0x4D, 0xD9, 0x43, 0x74, 0x7A, 0x41,
+    0xF8, 0xDC, 0xED, 0x46, 0xD1, 0x2F, 0x5D, 0x41, 0x15, 0x3F, 0xD6, 0x3C, 0xAC, 0xED, 0x81, 0xC6,
+    0x3E, 0xB5, 0x99, 0x10, 0xFB, 0xF4, 0x46, 0x21, 0xDC, 0xFB, 0xF4, 0x66, 0x95, 0xA7, 0xD8, 0xE9,
+    0x9B, 0xA5, 0xFA, 0xF1, 0x37, 0x4E, 0x95, 0x6B, 0x6A, 0xA2, 0x32, 0x59, 0xDD, 0x3B, 0x1A, 0x19,
+    0xBD, 0x20, 0x7C, 0xD2, 0xDC, 0x65, 0xBF, 0x34, 0x1A, 0x12, 0xE1, 0xEB, 0x19, 0xFF, 0xDD, 0x82,
+    0xDB, 0x34, 0xB7, 0xD9, 0xAF, 0xB6, 0xB8, 0xDC, 0xA8, 0xD1, 0x27, 0x34, 0x4E, 0x35, 0xF3, 0x37,
+    0x32, 0x95, 0x33, 0xF6, 0x36, 0x9F, 0x33, 0x2F, 0xD1, 0xEB, 0x93, 0x8A, 0x4E, 0x7F, 0xAC, 0xAD,
+    0x79, 0xF5, 0xC7, 0x2A, 0x58, 0x6D, 0x8A, 0x28, 0x0D, 0x89, 0x69, 0xEB, 0x32, 0xFD, 0x6E, 0x45,
+    0x97, 0xD1, 0x6C, 0x0B, 0x7E, 0x41, 0xF4, 0x89, 0x29, 0xBA, 0x9D, 0x61, 0x6D, 0x0F, 0xDC, 0x66,
+    0x0B, 0xB6, 0x58, 0x61, 0xCE, 0xE8, 0x4D, 0x67, 0x3C, 0xE1, 0xB6, 0x27, 0x2F, 0x79, 0x32, 0x5D,
+    0xEB, 0xA3, 0x9A, 0xB9, 0xA8, 0x31, 0x47, 0x86, 0x1B, 0x67, 0x46, 0xE6, 0xF3, 0xE6, 0x36, 0xBD,
+    0x7C, 0x6C, 0xA4, 0xC2, 0x50, 0xB4, 0x19, 0xCD, 0x21, 0xBA, 0xBD, 0x29, 0x84, 0xE8, 0x36, 0x5B,
+    0xF0, 0xB1, 0x4F, 0x4D, 0xCD, 0xA5, 0xD9, 0xC2, 0xB4, 0xBA, 0xDD, 0x6A, 0xF4, 0xEB, 0x90, 0xD1,
+    0x17, 0xDF, 0x49, 0x56, 0x77, 0xA6, 0xD9, 0x69, 0x2F, 0xF4, 0xFA, 0xB7, 0x1B, 0xC3, 0x36, 0x2C,
+    0xDC, 0x40, 0x97, 0x74, 0x7A, 0x15, 0x8E, 0xB9, 0x0A, 0x47, 0x23, 0xCD, 0x15, 0xA6, 0x7A, 0xEA,
+    0xEA, 0x36, 0x7C, 0xCE, 0xBC, 0x38, 0x94, 0x2E, 0xAB, 0x0C, 0xF9, 0x95, 0x32, 0x65, 0x73, 0x68,
+    0x6F, 0xCA, 0xF6, 0x84, 0xD5, 0x82, 0xD5, 0x4C, 0xAB, 0x9A, 0xDC, 0x70, 0x67, 0x91, 0x44, 0x5F,
+    0x41, 0x2B, 0x7C, 0x3A, 0x51, 0xC7, 0xE5, 0xA2, 0x6F, 0x7F, 0x73, 0xA4, 0xD7, 0x62, 0xA5, 0x79,
+    0xF8, 0x8B, 0x62, 0xC4, 0x1F, 0x76, 0xB9, 0xFA, 0x9C, 0xFE, 0xA8, 0x42, 0x3C, 0x1D, 0xD5, 0x4B,
+    0xF6, 0xBB, 0xC3, 0xAF, 0x81, 0xF0, 0x25, 0xD9, 0xEC, 0xA4, 0xB5, 0x57, 0xA1, 0xD3, 0x72, 0x6E,
+    0xCA, 0x8B, 0x30, 0x44, 0x8C, 0x4E, 0xDB, 0xB9, 0x72, 0x4B, 0x7A, 0x5D, 0x2A, 0x4E, 0x4A, 0x68,
+    0x7E, 0xC4, 0xC0, 0x5E, 0x1A, 0x2D, 0x18, 0x41, 0x97, 0xCD, 0xE8, 0xD3, 0x80, 0xBE, 0x9F, 0xAD,
+    0xB4, 0x74, 0x3A, 0x70, 0x1A, 0xAB, 0x61, 0xFA, 0x0D, 0xCC, 0xB3, 0xBD, 0x46, 0xB7, 0x79, 0xCD,
+    0x43, 0xFA, 0xA8, 0xE6, 0x21, 0xA1, 0xD1, 0xAF, 0x08, 0xBF, 0x18, 0x31, 0xC5, 0xA6, 0x10, 0xA2,
+    0x3D, 0xD0, 0xDC, 0x66, 0xA3, 0xB1, 0xCB, 0x56, 0xB8, 0xAD, 0x13, 0x2E, 0xF5, 0xA2, 0x4F, 0x5F,
+    0xD0, 0x3F, 0xEA, 0xFF, 0x2A, 0xAB, 0xF4, 0x4A, 0xCA, 0xBD, 0xA2, 0xB6, 0xAE, 0x30, 0xCD, 0xDC,
+    0xE6, 0x31, 0xCC, 0x6F, 0xF1, 0x7C, 0x27, 0xF4, 0x2D, 0xAD, 0xFD, 0x7D, 0x65, 0x2B, 0x23, 0xC2,
+    0xEC, 0x97, 0x61, 0x75, 0x9B, 0x4B, 0x4D, 0xB1, 0x99, 0xF0, 0xC2, 0x41, 0x9F, 0x84, 0xCD, 0xD3,
+    0x88, 0xFC, 0x8C, 0xBF, 0x17, 0x71, 0x5A, 0xB0, 0x5A, 0x40, 0x6B, 0x25, 0x67, 0x77, 0x7A, 0x68,
+    0xE6, 0x36, 0x2F, 0xD5, 0x2E, 0x47, 0xBD, 0xA9, 0x65, 0x48, 0xFD, 0x8F, 0x42, 0xB6, 0xD9, 0x1E,
+    0x46, 0x68, 0x0C, 0xA3, 0x5F, 0xFC, 0x3A, 0x44, 0xB7, 0xB9, 0xDD, 0xA5, 0xA6, 0xB4, 0xB2, 0x3B,
+    0xD3, 0x17, 0xF5, 0xB5, 0x8C, 0x5B, 0x95, 0x02, 0x36, 0x4F, 0xD9, 0x8F, 0xC8, 0x87, 0x21, 0xE2,
+    0xEF, 0x3D, 0xF7, 0xED, 0x88, 0xD3, 0x9B, 0x5A, 0x69, 0xF4, 0x35, 0x25, 0x08, 0xCB, 0x94, 0x60,
+    0x58, 0xFA, 0x04, 0xED, 0x62, 0x1F, 0x44, 0x43, 0x37, 0x47, 0x3E, 0x87, 0xDF, 0x8C, 0xA2, 0x97,
+    0x51, 0xEA, 0xB5, 0x68, 0xC7, 0xED, 0xE1, 0xA7, 0x31, 0x9A, 0x6A, 0x90, 0x75, 0xBA, 0xF7, 0xD5,
+    0xB2, 0x56, 0x1C, 0x34, 0xD7, 0xB0, 0xEB, 0xF4, 0xC3, 0xBA, 0x1F, 0x16, 0xEC, 0xBD, 0x14, 0xFE,
+    0xC7, 0x0B, 0xDA, 0x7A, 0xA5, 0x69, 0xB7, 0xDA, 0xDC, 0xCE, 0xF4, 0x16, 0xB7, 0x31, 0x00, 0xFF,
+    0x82, 0xA7, 0x21, 0x24, 0x77, 0xD0, 0x6B, 0x9E, 0x56, 0x13, 0x72, 0x8D, 0xA9, 0x87, 0x15, 0x7B,
+    0x34, 0x05, 0xFC, 0xE2, 0x17, 0x9A, 0x52, 0x5D, 0xDC, 0x69, 0x06, 0x75, 0x09, 0x5C, 0x2A, 0x80,
+    0xFA, 0x08, 0xEE, 0x87, 0x3B, 0xA0, 0x09, 0x2A, 0xE3, 0x10, 0x76, 0xCE, 0x2A, 0x88, 0x1A, 0xC9,
+    0xB8, 0x0D, 0x68, 0x0E, 0x80, 0x69, 0xC4, 0x2E, 0x77, 0x16, 0x98, 0x2A, 0x4A, 0x71, 0x50, 0xFD,
+    0x5D, 0xF8, 0xEF, 0xD4, 0xF8, 0xFA, 0x69, 0xFC, 0xE1, 0x92, 0xD7, 0x3B, 0xD9, 0x49, 0x47, 0x7B,
+    0x3F, 0x1C, 0x26, 0x37, 0x07, 0x1F, 0x6F, 0x4A, 0xB5, 0xDF, 0xE6, 0xDD, 0xFF, 0xC4, 0x2F, 0x19,
+    0x31, 0x8C, 0x2A, 0xAF, 0xAE, 0x92, 0xF6, 0xE9, 0x9E, 0x72, 0xB7, 0x84, 0xE3, 0x41, 0xE5, 0x8E,
+    0x51, 0xC4, 0xAB, 0x3A, 0xF8, 0x09, 0x42, 0x15, 0x44, 0xB7, 0xD6, 0x20, 0xA1, 0xD4, 0x28, 0xA0,
+    0x5F, 0xAE, 0xDD, 0xF7, 0x69, 0xA1, 0x3D, 0xAA, 0x64, 0x0D, 0x67, 0xC8, 0x50, 0xC0, 0xEE, 0xD0,
+    0x9F, 0x25, 0x46, 0xB5, 0x36, 0x8D, 0x52, 0xBF, 0xF6, 0x0B, 0x4C, 0x23, 0x46, 0x5F, 0xC6, 0x2A,
+    0xD1, 0x2A, 0x62, 0x9E, 0x3D, 0xB3, 0x41, 0x2B, 0xD3, 0xD8, 0x64, 0x5C, 0xC2, 0xCF, 0x1C, 0xB4,
+    0x1B, 0x43, 0x44, 0xD8, 0x9D, 0x7E, 0x61, 0xE2, 0xF2, 0xC8, 0x1C, 0x74, 0xE9, 0xE1, 0x47, 0x01,
+    0x9B, 0x71, 0xEB, 0xF5, 0x23, 0x1F, 0xB9, 0x84, 0x60, 0xAE, 0xC0, 0x54, 0xAA, 0xBB, 0xE1, 0x1E,
+    0x94, 0x11, 0xD9, 0x1D, 0xDC, 0x72, 0xFD, 0xB5, 0x7F, 0xF0, 0xD5, 0x5D, 0x54, 0x43, 0x95, 0xCC,
+    0x7E, 0xAF, 0xE1, 0xC8, 0xB9, 0x88, 0x33, 0x7C, 0x71, 0xE9, 0x7A, 0xA5, 0x6D, 0x8D, 0x59, 0x5E,
+    0x29, 0x58, 0x25, 0xFA, 0x02, 0x4F, 0x5D, 0x72, 0xEB, 0x1A, 0xBB, 0x67, 0x94, 0x6D, 0x92, 0xFE,
+    0x77, 0x0E, 0xBF, 0xAF, 0xD2, 0xCF, 0x93, 0x4C, 0x6C, 0xCE, 0xA9, 0x35, 0x63, 0x33, 0x33, 0x8D,
+    0xD3, 0xDC, 0xE5, 0x36, 0xA3, 0x18, 0x62, 0xBF, 0xBB, 0x6C, 0x34, 0x2B, 0x76, 0xB9, 0x3D, 0x18,
+    0xB6, 0x7E, 0xAF, 0xE0, 0xBD, 0x5F, 0xFC, 0xCA, 0x14, 0xFD, 0x82, 0x9F, 0x7D, 0xE4, 0xE7, 0xF9,
+    0x79, 0xB8, 0xCB, 0x6F, 0xE1, 0x52, 0x97, 0xE8, 0x93, 0x4B, 0xF8, 0xD4, 0x27, 0xFC, 0xEA, 0x53,
+    0x95, 0x0F, 0x8D, 0x9A, 0x5D, 0xEE, 0x0E, 0x14, 0xC3, 0xE2, 0xF6, 0x2E, 0xA3, 0x39, 0x44, 0xB7,
+    0xB5, 0x3B, 0x8F, 0x73, 0xF3, 0xA1, 0xD4, 0x7F, 0x5B, 0xFF, 0xD4, 0x98, 0xA8, 0x3A, 0xA8, 0xD4,
+    0x50, 0xAB, 0xAD, 0x38, 0xC0, 0xCD, 0xFA, 0xC8, 0xCC, 0x0F, 0x97, 0x0A, 0x8C, 0x5C, 0xD4, 0xF3,
+    0xC9, 0xB3, 0x0C, 0x27, 0xCC, 0x52, 0x9D, 0xC5, 0x8A, 0x8D, 0xDE, 0x4B, 0x80, 0xBD, 0x5F, 0x2D,
+    0x88, 0x4B, 0x80, 0x5B, 0x6B, 0x01, 0x86, 0xDB, 0x81, 0x69, 0x0C, 0x11, 0x5C, 0xEA, 0x32, 0x34,
+    0x07, 0x53, 0x04, 0xFF, 0xBF, 0x3E, 0x7B, 0x9C, 0xE9, 0x38, 0x2E, 0xE9, 0xC0, 0xBF, 0x78, 0x39,
+    0x24, 0xBA, 0x9D, 0xA6, 0x86, 0xD0, 0xC3, 0xC6, 0xB0, 0x62, 0x34, 0xDF, 0x2A, 0x23, 0x41, 0x9F,
+    0xD2, 0xC1, 0xA4, 0x2C, 0xC5, 0xEE, 0x02, 0xBA, 0xD6, 0xEB, 0xEF, 0xD7, 0xDC, 0xF6, 0xC2, 0x35,
+    0xC8, 0x76, 0xA6, 0xA8, 0xB5, 0x01, 0x0C, 0x6F, 0x01, 0x98, 0xBB, 0xFC, 0x5D, 0x59, 0xD6, 0x97,
+    0x79, 0x00, 0x78, 0x38, 0xCD, 0x80, 0x2D, 0x07, 0x9C, 0xFA, 0x85, 0x29, 0x0E, 0x40, 0x73, 0x97,
+    0x87, 0x57, 0xF4, 0xE1, 0x4D, 0xD3, 0xF3, 0x24, 0x23, 0xE0, 0xD6, 0x00, 0x34, 0xAA, 0xC3, 0xFD,
+    0xA9, 0x80, 0x66, 0x77, 0xCB, 0x7B, 0xAA, 0x4C, 0x3E, 0xCC, 0x3B, 0xF3, 0xFF, 0x3F, 0xCD, 0xFF,
+    0xE4, 0x75, 0x10, 0x59, 0x61, 0xB2, 0x2F, 0x00, 0xF8, 0x91, 0xAA, 0xB0, 0x6B, 0xDC, 0xFA, 0xF4,
+    0xC3, 0xE4, 0xAC, 0x42, 0xEF, 0xC7, 0xEB, 0x79, 0xD4, 0x81, 0x9B, 0x13, 0xF9, 0x1B, 0x01, 0x7E,
+    0xFA, 0xD1, 0x1D, 0xD0, 0x59, 0x7C, 0xA6, 0xE3, 0x7A, 0xC3, 0xCD, 0x9D, 0x48, 0xBF, 0x31, 0x41,
+    0x88, 0x66, 0xC7, 0x8A, 0x36, 0x9E, 0x6C, 0x36, 0xAD, 0x80, 0xA9, 0x40, 0x9D, 0xB4, 0x9F, 0x99,
+    0x94, 0x9A, 0x2A, 0xAF, 0xC2, 0x38, 0x6C, 0x0F, 0x32, 0x29, 0xA2, 0x59, 0x71, 0x3B, 0x7D, 0x64,
+    0x5A, 0x28, 0x34, 0x1A, 0x6F, 0x6D, 0x4C, 0xAA, 0x34, 0x96, 0xF0, 0xB5, 0x42, 0xEE, 0x51, 0xD9,
+    0x36, 0xFB, 0xB5, 0x40, 0x74, 0x95, 0x6E, 0xFB, 0x25, 0x8B, 0xC8, 0x4F, 0xF1, 0x61, 0x9C, 0x7D,
+    0xF3, 0x87, 0xD7, 0x91, 0x7F, 0x53, 0x37, 0xF9, 0xDE, 0x0A, 0xF6, 0xE8, 0x23, 0xF8, 0x38, 0x8C,
+    0xF0, 0x65, 0x3E, 0xF2, 0xC8, 0xBC, 0xBD, 0x6A, 0x36, 0x5E, 0x3A, 0xCB, 0x16, 0xD0, 0xFC, 0xD9,
+    0x44, 0x7B, 0xD0, 0x47, 0x86, 0xC4, 0x17, 0x40, 0xD1, 0xA4, 0x33, 0x3F, 0x50, 0x93, 0x51, 0x53,
+    0x8D, 0xD4, 0x55, 0xC0, 0x5D, 0xAA, 0x0C, 0xE2, 0xB9, 0xCF, 0xDD, 0xF1, 0x08, 0x6A, 0xFA, 0x15,
+    0x6C, 0xA1, 0x4D, 0x67, 0x11, 0x7E, 0x58, 0x6E, 0x9E, 0xE4, 0x69, 0x24, 0x29, 0x3A, 0xD5, 0xCC,
+    0x0F, 0xB7, 0x0D, 0xE0, 0xD2, 0x34, 0x42, 0x78, 0xA3, 0x80, 0x2D, 0x7D, 0x82, 0x2E, 0xF9, 0xF1,
+    0xBD, 0xF5, 0x60, 0x1F, 0x8A, 0x7A, 0x0E, 0x00, 0x5E, 0xA4, 0xD6, 0x23, 0x0F, 0xDB, 0x89, 0xE7,
+    0x4E, 0x3B, 0x98, 0xC0, 0x83, 0x2A, 0xC7, 0xCA, 0x19, 0x89, 0x50, 0x4B, 0x1D, 0x2A, 0x61, 0xFA,
+    0xBD, 0x92, 0xC9, 0xEA, 0xDC, 0xE1, 0xF7, 0xBF, 0xB9, 0xBE, 0xCF, 0xCD, 0x69, 0xAD, 0xA3, 0xDD,
+    0xD1, 0x5D, 0x82, 0xF2, 0x99, 0x9A, 0x39, 0x35, 0x58, 0x84, 0x66, 0xAB, 0x2B, 0xEE, 0x34, 0xD2,
+    0x6B, 0xA4, 0xBB, 0xFF, 0x2E, 0x0B, 0xF4, 0x01, 0x4C, 0xA6, 0x59, 0x4F, 0xF7, 0xD7, 0x17, 0x70,
+    0xEF, 0x6C, 0xB4, 0x79, 0x88, 0x46, 0x64, 0x1E, 0x1F, 0x9B, 0x77, 0xD1, 0x65, 0x90, 0x4E, 0x3D,
+    0xA3, 0x58, 0x47, 0x38, 0xCB, 0x09, 0x1E, 0xAA, 0xBF, 0x6C, 0xCB, 0x99, 0xBE, 0xBA, 0x2E, 0xB4,
+    0x75, 0xFB, 0xA9, 0x55, 0x86, 0xED, 0xFD, 0xDA, 0xDD, 0xD1, 0x5D, 0x06, 0x89, 0xB3, 0xC2, 0xE2,
+    0xB6, 0x01, 0xFF, 0xC5, 0x5C, 0x8B, 0x99, 0xF5, 0xA9, 0x8C, 0x5B, 0xA7, 0xF1, 0x3D, 0x2C, 0x55,
+    0x73, 0x5D, 0xBD, 0xF6, 0x3A, 0xCE, 0x7B, 0xBB, 0xB7, 0x3A, 0xE5, 0xB6, 0x3B, 0x2E, 0xD3, 0xC8,
+    0xE7, 0x42, 0xDF, 0x3B, 0xEF, 0x4B, 0xBB, 0x9B, 0xBA, 0x5F, 0x3B, 0x7E, 0x78, 0xA3, 0x00, 0xB7,
+    0xFE, 0x52, 0x75, 0x1C, 0x87, 0x9A, 0x0F, 0xA9, 0x72, 0xFE, 0x83, 0x6A, 0x6A, 0xFE, 0x55, 0xBF,
+    0xF0, 0xD7, 0x5C, 0x4E, 0x11, 0x29, 0x76, 0xDA, 0x98, 0x94, 0x90, 0xE8, 0xB4, 0x62, 0xB5, 0xE0,
+    0x23, 0x46, 0x3B, 0x6E, 0x85, 0xA0, 0xEA, 0x30, 0x6A, 0x6D, 0x0E, 0x70, 0xCA, 0x08, 0xEC, 0x3B,
+    0x1A, 0x7D, 0xC4, 0x1C, 0x53, 0x72, 0x2B, 0x04, 0x77, 0xB4, 0x1B, 0xF8, 0xAF, 0xE9, 0xF5, 0x0C,
+    0x2E, 0xF9, 0x24, 0x68, 0xF7, 0xAE, 0xF8, 0x48, 0x73, 0xA0, 0x6F, 0xAF, 0x10, 0x18, 0xB4, 0x81,
+    0x8F, 0x56, 0xD5, 0x3B, 0x0F, 0xD5, 0x49, 0xED, 0x35, 0xD3, 0x1C, 0x58, 0xAD, 0x34, 0x5A, 0x99,
+    0x36, 0x5A, 0x15, 0x5C, 0xC6, 0x4A, 0xE3, 0xA5, 0xF4, 0xEF, 0xC9, 0xF7, 0x18, 0x83, 0x6A, 0x74,
+    0xAB, 0x06, 0x71, 0xA7, 0xBB, 0x14, 0x1F, 0xC0, 0x7F, 0x0F, 0xBB, 0x7F, 0x1F, 0xCA, 0xA4, 0xFF,
+    0xE5, 0xFA, 0x07, 0x5C, 0x5B, 0xC0, 0xAA, 0x14, 0x87, 0x5A, 0x68, 0xB9, 0x5F, 0xAB, 0xF4, 0x47,
+    0x3C, 0xA4, 0x0F, 0xE7, 0x5A, 0x1E, 0x8F, 0x0F, 0x20, 0xE2, 0x90, 0x81, 0xA6, 0x14, 0xC0, 0x6D,
+    0x13, 0xE0, 0x97, 0x61, 0x84, 0x8F, 0x3E, 0x6C, 0xE3, 0x3E, 0x94, 0xAB, 0x30, 0xE3, 0x63, 0xD7,
+    0x66, 0x63, 0x48, 0x9A, 0xC1, 0xFF, 0x40, 0x23, 0xF4, 0xF1, 0x78, 0xB7, 0xE0, 0x7C, 0x98, 0x39,
+    0x6A, 0xB9, 0x4E, 0xA8, 0x5D, 0x38, 0xEA, 0x74, 0x3D, 0x09, 0xD5, 0x25, 0xA9, 0x08, 0x12, 0x3F,
+    0xF7, 0xAE, 0x35, 0x7D, 0x98, 0x33, 0xF2, 0x0F, 0xAE, 0x66, 0x7E, 0x28, 0xFC, 0xAB, 0x59, 0x87,
+    0x29, 0xD7, 0xCC, 0xF0, 0x43, 0x25, 0xC2, 0x1F, 0xE1, 0xEF, 0xD6, 0xE2, 0x6E, 0x8D, 0x5C, 0xBB,
+    0x82, 0xB5, 0xFC, 0x9D, 0x29, 0xD4, 0x73, 0x3E, 0x05, 0xE8, 0x76, 0x9B, 0x80, 0xE7, 0xDF, 0xED,
+    0xE3, 0x1A, 0x69, 0x1D, 0x94, 0xBD, 0x0E, 0x2B, 0xBD, 0x2E, 0x8D, 0x83, 0x96, 0x46, 0x23, 0x43,
+    0x3A, 0xCF, 0x70, 0x59, 0x81, 0x5F, 0xF0, 0x89, 0x36, 0xD3, 0x16, 0x98, 0x22, 0x61, 0xA1, 0xDB,
+    0x1F, 0x5A, 0x4F, 0x5D, 0x9C, 0x11, 0x46, 0x33, 0x7D, 0x62, 0xD8, 0x68, 0x1E, 0x7E, 0xB3, 0x16,
+    0x0E, 0x10, 0x22, 0x3E, 0xE1, 0x36, 0xAC, 0xE6, 0x56, 0xE0, 0xF5, 0x4A, 0xAD, 0x35, 0xD2, 0x06,
+    0x6D, 0x75, 0xBC, 0x2A, 0xDE, 0x73, 0x39, 0xAA, 0x80, 0xE1, 0x49, 0xA0, 0xC9, 0x6E, 0x05, 0xFC,
+    0x37, 0x6B, 0x32, 0xC1, 0xAF, 0x80, 0xFF, 0x44, 0x7E, 0x5F, 0x83, 0xF4, 0xE1, 0xDE, 0xA6, 0x27,
+    0x00, 0xBE, 0x52, 0x73, 0x32, 0x17, 0xA0, 0xB9, 0x02, 0x73, 0x0B, 0x35, 0x03, 0x8D, 0x59, 0x1F,
+    0x59, 0xCF, 0x4F, 0x36, 0x21, 0x7B, 0xB1, 0x87, 0x23, 0xE0, 0xE2, 0xC5, 0xF4, 0xF9, 0x78, 0xE6,
+    0xE0, 0xCC, 0x41, 0xC5, 0xAF, 0x30, 0xF1, 0x03, 0x9F, 0x55, 0xB3, 0x5F, 0xB2, 0x3F, 0xF5, 0x6C,
+    0x54, 0x00, 0x8E, 0x61, 0xC6, 0x6E, 0x2E, 0xD2, 0x2D, 0xED, 0xFC, 0x01, 0x4F, 0xC8, 0xE4, 0x6E,
+    0xC1, 0x1E, 0xC3, 0x4A, 0x9B, 0xFD, 0x82, 0xDD, 0x86, 0x19, 0xC6, 0xC7, 0x3E, 0x48, 0xBA, 0xFC,
+    0xED, 0x24, 0xB1, 0x6F, 0x54, 0xA6, 0x6B, 0x54, 0xB5, 0x60, 0xB7, 0xC0, 0x6B, 0xB5, 0x38, 0xE1,
+    0xF9, 0xCB, 0xE1, 0x15, 0x57, 0x53, 0x7B, 0x4D, 0xA9, 0x2A, 0xA5, 0xCD, 0x15, 0x26, 0x6C, 0x1E,
+    0xF8, 0x81, 0xE6, 0x25, 0x8C, 0x32, 0x83, 0xF6, 0xA6, 0xDC, 0x49, 0xFD, 0xE2, 0x63, 0x31, 0xA5,
+    0x4B, 0x2E, 0xF9, 0x39, 0x3C, 0x73, 0xF4, 0x5B, 0xF7, 0x8E, 0x46, 0xAF, 0x15, 0x6D, 0xD8, 0x83,
+    0x9F, 0x72, 0x9B, 0xC9, 0xFE, 0x47, 0xD3, 0x3A, 0x49, 0x48, 0x2B, 0x61, 0x7F, 0xD8, 0xE6, 0x3C,
+    0x0E, 0xB4, 0xA9, 0xA2, 0x1D, 0x8D, 0xCE, 0xC4, 0x9F, 0xCE, 0x60, 0xE6, 0xF1, 0x47, 0x08, 0x0C,
+    0xAD, 0x12, 0x9D, 0x0A, 0xDD, 0xFD, 0x10, 0xDB, 0xCD, 0x25, 0xBB, 0xB7, 0x7B, 0x93, 0x6D, 0xA6,
+    0x34, 0x07, 0xD3, 0xAF, 0x1D, 0x0C, 0xF7, 0x0E, 0x9C, 0xF6, 0x13, 0xA9, 0x1F, 0x9B, 0xD1, 0x2F,
+    0x6D, 0x72, 0xC7, 0x73, 0xBB, 0xA9, 0x67, 0xB6, 0x76, 0x1A, 0xAD, 0x0F, 0x8E, 0x07, 0x41, 0x77,
+    0x46, 0x19, 0xDA, 0x68, 0x4A, 0xA6, 0x4D, 0x07, 0x7D, 0xFC, 0x02, 0x9E, 0x8F, 0x3F, 0x74, 0xE8,
+    0x67, 0xA4, 0x55, 0x62, 0xD0, 0x4E, 0xF8, 0x8F, 0xD9, 0x1C, 0x36, 0xDB, 0xBD, 0xDD, 0xBB, 0xE4,
+    0x92, 0x5B, 0x87, 0xA5, 0xFF, 0x86, 0xC6, 0xE1, 0xDE, 0x81, 0xD7, 0x8A, 0x3F, 0xC0, 0x2F, 0xDC,
+    0xF5, 0x4B, 0x9B, 0xFC, 0x8F, 0xA6, 0xB5, 0x97, 0xA2, 0x53, 0xA9, 0x83, 0x5E, 0xD6, 0x6C, 0xF6,
+    0x3E, 0x1A, 0xB9, 0x8D, 0xF0, 0x66, 0x3E, 0xDD, 0x83, 0x87, 0x39, 0xE9, 0xE9, 0x11, 0x53, 0x4F,
+    0x3D, 0xCD, 0x4D, 0xB9, 0x93, 0xCC, 0x61, 0x33, 0xC5, 0x14, 0x02, 0xC2, 0xCF, 0x61, 0xEC, 0xBF,
+    0xA1, 0xB1, 0x7B, 0x47, 0xA3, 0x55, 0xA9, 0xE8, 0x9E, 0x5F, 0xB8, 0xEB, 0x36, 0x93, 0xAD, 0x3E,
+    0x53, 0x98, 0xA4, 0x9A, 0x31, 0x0A, 0xFB, 0x19, 0xF9, 0x8D, 0xFC, 0x37, 0xA6, 0x4B, 0x7A, 0xB7,
+    0xC9, 0xFC, 0x6C, 0xCD, 0x1E, 0xCC, 0x21, 0x07, 0x7D, 0x54, 0xF3, 0xB0, 0xB8, 0xD4, 0xE6, 0xA6,
+    0xA0, 0xD1, 0xC7, 0x3E, 0xB9, 0xDD, 0x1E, 0x46, 0x3F, 0x35, 0xDD, 0x7B, 0x55, 0x7F, 0xA2, 0x55,
+    0x77, 0x6F, 0x3C, 0x70, 0x9B, 0x6D, 0xA2, 0x39, 0x30, 0x55, 0xED, 0x85, 0x11, 0x7F, 0x0D, 0xA7,
+    0x82, 0x79, 0x91, 0x41, 0x0C, 0x8A, 0x8F, 0x87, 0x95, 0x6E, 0xC3, 0x66, 0x4C, 0xC5, 0xC7, 0xFC,
+    0x82, 0x4B, 0xD4, 0xF3, 0x27, 0x68, 0x64, 0x7A, 0x7D, 0xEC, 0xDF, 0x59, 0x3B, 0x6D, 0x8D, 0x76,
+    0xFC, 0x5B, 0xD7, 0xD1, 0x69, 0xB7, 0x30, 0x24, 0xC2, 0x6E, 0x4A, 0xB6, 0xDB, 0x6B, 0x6E, 0xF1,
+    0xC3, 0xF8, 0x0B, 0x67, 0xE7, 0xCF, 0x33, 0x88, 0x20, 0x5E, 0x29, 0x34, 0x07, 0x36, 0xD3, 0x66,
+    0xBA, 0x1D, 0xB7, 0xE1, 0x12, 0x7D, 0xC2, 0xAF, 0xF8, 0x85, 0xE9, 0xF5, 0x71, 0xBA, 0x37, 0x07,
+    0x8D, 0xA1, 0xE0, 0xDF, 0xBA, 0xE4, 0xBF, 0xB3, 0x5B, 0xF4, 0xA9, 0x7D, 0x7A, 0xE3, 0x70, 0x4B,
+    0x79, 0x48, 0x62, 0x9F, 0xA7, 0x53, 0xEC, 0x94, 0x9A, 0x57, 0x77, 0x9A, 0x03, 0xAA, 0x49, 0x18,
+    0x56, 0xDC, 0xF5, 0xDC, 0x35, 0xE3, 0x17, 0xFA, 0x74, 0xB7, 0x2D, 0x7B, 0xA3, 0x83, 0x50, 0x70,
+    0xF7, 0xCF, 0x4A, 0xE0, 0xAF, 0x34, 0xD0, 0xE7, 0x5F, 0xAD, 0x55, 0x57, 0xED, 0x77, 0x15, 0x71,
+    0xF6, 0x38, 0xD3, 0xAA, 0xD7, 0xD7, 0x4F, 0x32, 0xBF, 0xFA, 0x04, 0xF0, 0x0B, 0x67, 0x1C, 0xD3,
+    0x5E, 0x87, 0xA2, 0xDB, 0x99, 0x95, 0x6F, 0x1F, 0xD2, 0xD8, 0xE6, 0x25, 0xE8, 0xEB, 0x71, 0x14,
+    0x7C, 0xD1, 0x32, 0xA4, 0x7E, 0xEF, 0x93, 0x95, 0xDB, 0x09, 0x6F, 0x1C, 0x0C, 0x7F, 0x29, 0xBA,
+    0xAC, 0x68, 0x8B, 0x5F, 0xD1, 0xA7, 0x77, 0xA6, 0x37, 0x0A, 0x7E, 0x55, 0x1C, 0xD2, 0xB0, 0x0D,
+    0x5B, 0x5B, 0xE1, 0x8D, 0xAD, 0x16, 0x24, 0x3D, 0x54, 0x0F, 0xC0, 0x2F, 0x9E, 0xA3, 0x37, 0xE5,
+    0xB4, 0x1A, 0x6E, 0x3B, 0x8D, 0xC6, 0x30, 0xBE, 0xCB, 0x66, 0x98, 0x97, 0xA0, 0xD5, 0x5E, 0x83,
+    0x4F, 0xBD, 0xA3, 0x71, 0x48, 0xFD, 0xDE, 0x66, 0x14, 0x35, 0x77, 0xD9, 0x6D, 0x84, 0xD7, 0x45,
+    0x97, 0x7D, 0x42, 0x5F, 0x2A, 0xB8, 0xCD, 0xAF, 0x46, 0xB6, 0xE0, 0x57, 0x9F, 0xBA, 0xDC, 0xE8,
+    0x13, 0x1A, 0x7B, 0x69, 0x21, 0x68, 0xC3, 0x68, 0xBF, 0xAE, 0xC6, 0xBE, 0x38, 0xAA, 0xDD, 0x51,
+    0x0F, 0xB1, 0xE2, 0xC3, 0x88, 0xFB, 0xE6, 0x8E, 0xDD, 0x5D, 0xE4, 0x0B, 0xFC, 0xEB, 0x47, 0x85,
+    0x8A, 0x49, 0x33, 0x83, 0x84, 0x53, 0xD8, 0x1A, 0x19, 0xCD, 0x53, 0x74, 0xD9, 0xED, 0x84, 0xA8,
+    0xB1, 0xCB, 0x43, 0x22, 0xBC, 0x21, 0xDC, 0xEE, 0x57, 0xF4, 0xC9, 0x42, 0x9F, 0xFC, 0x6A, 0x8B,
+    0x15, 0x21, 0x0E, 0xDB, 0xB0, 0x19, 0xE9, 0xA8, 0x45, 0xEB, 0xBD, 0xE6, 0x87, 0x29, 0xE1, 0xE2,
+    0x1F, 0x61, 0x8F, 0x21, 0xE1, 0xFF, 0xB8, 0x60, 0xF7, 0x21, 0xF2, 0xA8, 0x59, 0xF8, 0xC9, 0x8C,
+    0xFC, 0x04, 0xE7, 0x7F, 0x8E, 0xD0, 0xE4, 0xEB, 0xCA, 0x15, 0x5D, 0x1F, 0xBF, 0x76, 0x2B, 0x8F,
+    0x28, 0xEC, 0x9F, 0x78, 0x52, 0xF5, 0x5A, 0x9B, 0x72, 0x71, 0x26, 0x7C, 0xBC, 0x4C, 0x46, 0x97,
+    0x59, 0xDA, 0xF4, 0xC0, 0x03, 0xFF, 0x20, 0x67, 0xD5, 0x5C, 0x9F, 0x40, 0x19, 0x0E, 0x20, 0x04,
+    0x30, 0xD9, 0x8F, 0xB4, 0x9B, 0x9B, 0x71, 0x4B, 0x37, 0x7E, 0xC0, 0x13, 0x32, 0xD9, 0x45, 0x6C,
+    0xF6, 0x4B, 0x75, 0x26, 0xDA, 0xCD, 0xBF, 0xC7, 0x99, 0xF8, 0x60, 0x76, 0xAB, 0xC6, 0x9F, 0xD2,
+    0x5A, 0x4F, 0x2F, 0x69, 0xA7, 0x97, 0x24, 0x1D, 0x0C, 0xBA, 0xEB, 0x76, 0x33, 0x8D, 0x43, 0xA1,
+    0x3D, 0x70, 0xB1, 0x3F, 0x30, 0xC2, 0x26, 0x57, 0x0F, 0x3D, 0xA5, 0x56, 0x17, 0x7C, 0x69, 0xAC,
+    0x05, 0x3C, 0x8A, 0x35, 0xFE, 0x08, 0x6B, 0xAD, 0x0D, 0xF3, 0x5B, 0x45, 0x38, 0x5D, 0xAE, 0x80,
+    0xEC, 0x25, 0xFD, 0x7F, 0xDD, 0xD0, 0x6F, 0xD5, 0xDA, 0xBB, 0x02, 0x8A, 0x7C, 0xB5, 0x51, 0xC4,
+    0xAF, 0x78, 0x7C, 0xC6, 0x6D, 0x0C, 0xB1, 0xD3, 0xF7, 0xEE, 0x1C, 0x3C, 0xB7, 0x22, 0x49, 0xE7,
+    0xF1, 0xE9, 0x8A, 0x09, 0xDF, 0xD1, 0x59, 0x71, 0x7A, 0x9D, 0x77, 0xFC, 0xCD, 0x91, 0xCF, 0x43,
+    0xAF, 0x38, 0x68, 0xB4, 0xD2, 0x1B, 0x55, 0xD5, 0x85, 0x6F, 0xE5, 0x46, 0x46, 0xBB, 0x4B, 0x7D,
+    0xB2, 0x8A, 0x3E, 0x6A, 0xEE, 0x8E, 0xE6, 0x68, 0x0F, 0x86, 0xD4, 0xAF, 0x43, 0x22, 0x7C, 0xA9,
+    0xA0, 0x68, 0x4B, 0x58, 0x6C, 0xC1, 0x69, 0xC7, 0xED, 0xB5, 0xF2, 0x61, 0xB5, 0x1A, 0xCD, 0xAC,
+    0x38, 0x14, 0x86, 0x46, 0x9F, 0x50, 0xF9, 0x6C, 0x6E, 0x25, 0x49, 0x4B, 0xA7, 0x32, 0x28, 0xD3,
+    0x6A, 0xE9, 0x35, 0x72, 0xC9, 0x92, 0x9F, 0xD0, 0xF5, 0x3D, 0x49, 0xEF, 0x3C, 0x54, 0x0D, 0xFB,
+    0xE0, 0xC9, 0xFB, 0x5E, 0x0F, 0x9A, 0x3C, 0xC6, 0x17, 0x4C, 0xB6, 0x9B, 0x4B, 0xFD, 0xE2, 0xA3,
+    0x8F, 0x7E, 0xF1, 0xEB, 0xD3, 0x23, 0xB7, 0xDB, 0xDC, 0x66, 0x9B, 0x6D, 0x6E, 0xF7, 0x2E, 0xB9,
+    0xD5, 0xC7, 0xC0, 0x2F, 0xC1, 0x63, 0x3C, 0x61, 0xF6, 0x76, 0xED, 0x63, 0xE0, 0x68, 0x37, 0x97,
+    0x7C, 0x9C, 0x9E, 0x39, 0x6C, 0x76, 0xC9, 0x25, 0x1F, 0xFD, 0x22, 0xF4, 0xA5, 0xC3, 0xBC, 0x54,
+    0x8F, 0xED, 0xD2, 0xAD, 0xC3, 0x1C, 0x5E, 0x17, 0xB2, 0xD9, 0x66, 0x97, 0xDC, 0x3A, 0xCD, 0xE1,
+    0x13, 0xD9, 0xEE, 0x6E, 0x1D, 0x62, 0x30, 0xB9, 0x4D, 0x6D, 0x1C, 0x4E, 0x77, 0x80, 0xA7, 0xE1,
+    0xF9, 0x2E, 0x73, 0xD1, 0x46, 0x19, 0x9F, 0xCE, 0x33, 0xA0, 0xE7, 0xD1, 0x60, 0x33, 0x72, 0x03,
+    0x9E, 0xE4, 0xFF, 0x00, 0xD5, 0x99, 0x3F, 0xCC, 0x25, 0x47, 0x76, 0xDD, 0x7F, 0xDD, 0xC5, 0x99,
+    0x92, 0xB6, 0x83, 0xDA, 0x60, 0x69, 0xAC, 0x49, 0x58, 0x9D, 0x38, 0x58, 0x10, 0xB6, 0x3B, 0x75,
+    0x60, 0xA3, 0x9A, 0x64, 0xC0, 0x40, 0x81, 0x3E, 0x40, 0x1C, 0x51, 0x8A, 0x36, 0xA1, 0x01, 0xD1,
+    0x09, 0x13, 0x87, 0xD6, 0x76, 0x8F, 0x98, 0xD9, 0x81, 0x06, 0x50, 0xE0, 0x50, 0x0B, 0x78, 0x15,
+    0x98, 0x0A, 0x26, 0x17, 0xBC, 0xAC, 0xC2, 0x0E, 0xE0, 0x05, 0xEC, 0x80, 0xBD, 0xBB, 0xB0, 0x1D,
+    0x38, 0x50, 0xEF, 0x6A, 0x76, 0x13, 0x06, 0x53, 0x94, 0x5A, 0xDC, 0x1E, 0x4E, 0x55, 0x1D, 0x07,
+    0xF5, 0xDE, 0x37, 0x43, 0x9A, 0xC0, 0x5A, 0x82, 0x0D, 0xD8, 0x2F, 0xF8, 0xDE, 0x9F, 0xAF, 0x5E,
+    0xBF, 0x5B, 0xB7, 0xCE, 0x3D, 0xF7, 0x9C, 0xDB, 0xC0, 0x4D, 0x07, 0xB8, 0xB4, 0xCC, 0x10, 0x1E,
+    0x55, 0x30, 0x75, 0x4C, 0x30, 0x24, 0x3F, 0xF3, 0xBF, 0x3C, 0x9C, 0xA4, 0x83, 0x20, 0x69, 0xEB,
+    0x24, 0x09, 0xFC, 0xFE, 0xF7, 0x32, 0x9D, 0x66, 0x9B, 0x18, 0x32, 0xE3, 0x8A, 0x4F, 0xFC, 0x6B,
+    0x50, 0x04, 0x6C, 0x05, 0x18, 0x0F, 0x80, 0x20, 0xAD, 0x18, 0xA9, 0x80, 0x93, 0x12, 0x2C, 0x3B,
+    0xD0, 0x6B, 0x06, 0x5C, 0x06, 0xF0, 0x89, 0x7F, 0x02, 0x5A, 0xBB, 0x8C, 0x2D, 0xB8, 0x9D, 0xE9,
+    0xE8, 0xC2, 0x6C, 0x25, 0x65, 0x82, 0xA4, 0x64, 0x24, 0xA9, 0x05, 0xF5, 0x0D, 0x00, 0x7C, 0xE4,
+    0xF6, 0xDB, 0xBD, 0x36, 0x80, 0xA5, 0xB4, 0x30, 0x77, 0xA0, 0xAB, 0x02, 0xF0, 0x7F, 0x92, 0x80,
+    0x21, 0x09, 0xA0, 0xBA, 0x03, 0xF0, 0x51, 0x2B, 0xD8, 0x63, 0xC8, 0x80, 0x08, 0x11, 0xA6, 0xCD,
+    0x66, 0x30, 0xE5, 0x5E, 0xD8, 0x40, 0x52, 0x85, 0x51, 0x52, 0xC2, 0xD4, 0x0F, 0xFF, 0x4C, 0x10,
+    0x56, 0xA6, 0x84, 0x4B, 0xF4, 0x9A, 0xFB, 0x0A, 0xE3, 0xD9, 0x85, 0xC7, 0x0C, 0x3A, 0x82, 0x36,
+    0x2B, 0x7D, 0xAC, 0x4C, 0x50, 0xC6, 0x49, 0xDA, 0x7B, 0x49, 0x95, 0x51, 0xD2, 0x86, 0x3B, 0xEF,
+    0x14, 0x3A, 0xE1, 0x22, 0x53, 0xEA, 0x4E, 0x8C, 0x18, 0xC1, 0xEF, 0x80, 0x2D, 0x00, 0xCB, 0x63,
+    0x60, 0x90, 0xDA, 0xCF, 0x46, 0x5C, 0x0D, 0xA2, 0xD3, 0xEC, 0x4F, 0xA6, 0x84, 0xA2, 0x11, 0x2E,
+    0xE3, 0x13, 0x8A, 0xA6, 0xE2, 0x4E, 0x96, 0xAD, 0x17, 0x43, 0x26, 0xEC, 0x56, 0xD2, 0xD9, 0x4B,
+    0x2A, 0x78, 0xE9, 0xE9, 0xED, 0x29, 0xDD, 0xB9, 0xD7, 0x12, 0x3E, 0xB3, 0x48, 0x95, 0x41, 0x55,
+    0x07, 0xF7, 0xF4, 0xBA, 0x22, 0xE3, 0x31, 0x64, 0x7A, 0xB1, 0x44, 0x7C, 0xB2, 0x19, 0x53, 0x09,
+    0x2B, 0xCB, 0xE6, 0x12, 0xB6, 0xFE, 0x76, 0xB9, 0x7C, 0xCD, 0x49, 0x05, 0xF4, 0x89, 0x12, 0xE3,
+    0x61, 0xB4, 0xF6, 0x62, 0xBC, 0xC6, 0xD0, 0xC2, 0xD9, 0xD1, 0x6A, 0x0B, 0x53, 0x22, 0xC4, 0xA1,
+    0xB2, 0x48, 0x5A, 0x27, 0x49, 0x9B, 0x91, 0xF4, 0xE0, 0x45, 0xB8, 0x24, 0x82, 0xA4, 0x78, 0x85,
+    0xCB, 0xA7, 0xEF, 0x64, 0x3A, 0xAD, 0x6E, 0x67, 0x28, 0xF8, 0x19, 0x9F, 0xC8, 0xA0, 0x68, 0x36,
+    0x6C, 0xE5, 0xA5, 0x5B, 0xB8, 0x6C, 0x80, 0xD1, 0xF3, 0xF3, 0xFD, 0x2A, 0xB8, 0xF0, 0x05, 0x9C,
+    0x4D, 0x07, 0x60, 0x55, 0x81, 0xA0, 0x02, 0x46, 0x4A, 0x0D, 0x26, 0x92, 0xDA, 0xCE, 0x94, 0x61,
+    0x91, 0xF4, 0x18, 0x4C, 0x36, 0x02, 0xCC, 0x69, 0x04, 0xD8, 0xC3, 0x54, 0x60, 0x48, 0xB6, 0x00,
+    0x6E, 0x1F, 0x0A, 0xE0, 0xB6, 0x21, 0x03, 0x53, 0x74, 0x19, 0xF0, 0xAB, 0x3B, 0x81, 0x65, 0x1E,
+    0x0F, 0x40, 0x4C, 0x09, 0xBA, 0x82, 0x4F, 0x60, 0x32, 0x3E, 0x81, 0x3D, 0xF0, 0x3B, 0xB8, 0xC4,
+    0xB2, 0xC1, 0xB4, 0x11, 0x22, 0x2C, 0x11, 0x45, 0x3A, 0x81, 0x56, 0x26, 0x49, 0x7A, 0xCA, 0x22,
+    0x49, 0x22, 0x48, 0x52, 0x25, 0xCC, 0x60, 0x32, 0xE2, 0xF9, 0xD3, 0x41, 0x01, 0x6C, 0x22, 0x03,
+    0x76, 0x6F, 0x4F, 0x1B, 0xDF, 0x05, 0xFA, 0xF5, 0xFF, 0x91, 0x2A, 0xEC, 0x6E, 0x00, 0x78, 0x1B,
+    0x23, 0x46, 0x1D, 0x9D, 0x22, 0x4A, 0x83, 0x72, 0xA7, 0x03, 0x5F, 0x3A, 0x3D, 0xED, 0x94, 0x71,
+    0x21, 0x0E, 0x27, 0x0A, 0x74, 0xE6, 0x30, 0x05, 0x75, 0xC0, 0x47, 0x88, 0x00, 0xE0, 0xE2, 0x12,
+    0x97, 0x19, 0x30, 0xC7, 0xB4, 0x37, 0xB6, 0xF9, 0x68, 0x38, 0xA6, 0x15, 0x60, 0x7C, 0x54, 0x5C,
+    0xA4, 0x55, 0x46, 0xAB, 0x6C, 0x2B, 0xE9, 0x04, 0xB0, 0xF5, 0xFD, 0xCF, 0x04, 0x60, 0xE4, 0x0E,
+    0xDF, 0x70, 0x62, 0xF2, 0x90, 0x01, 0xA3, 0x59, 0x9D, 0x80, 0x5E, 0xEB, 0x12, 0xFD, 0x0E, 0xBD,
+    0xE2, 0xB4, 0x0F, 0x19, 0x7A, 0x6D, 0xEE, 0x40, 0x11, 0xA3, 0xCD, 0x64, 0xA6, 0x13, 0xAB, 0xFD,
+    0xAE, 0x36, 0xA3, 0xD9, 0x6A, 0x1F, 0x94, 0x09, 0x27, 0x61, 0x33, 0x12, 0x43, 0xA1, 0x6B, 0xF8,
+    0xFD, 0x3A, 0xC0, 0x9D, 0x1B, 0x98, 0x74, 0x62, 0xA4, 0xCC, 0x28, 0x65, 0xC2, 0xBC, 0x24, 0x73,
+    0x10, 0x36, 0x17, 0x7B, 0xCD, 0xFF, 0x98, 0x21, 0xD3, 0x4A, 0xBA, 0x17, 0xBC, 0xBC, 0x24, 0x90,
+    0xC0, 0x4A, 0xF0, 0x8A, 0x04, 0x4C, 0x05, 0xF0, 0x27, 0x10, 0xF6, 0x5F, 0xA3, 0xD3, 0xFD, 0x83,
+    0xA1, 0xB8, 0xC4, 0x92, 0xFC, 0xF1, 0xAA, 0x66, 0x49, 0x07, 0x92, 0x66, 0x82, 0x36, 0xE8, 0xE6,
+    0x56, 0x3A, 0x7D, 0xA3, 0x92, 0xDD, 0xAB, 0x30, 0xEA, 0xEC, 0xA5, 0x19, 0x97, 0xE9, 0x35, 0xD3,
+    0x69, 0xC5, 0x27, 0x98, 0x0E, 0x06, 0x81, 0x11, 0x46, 0x3B, 0xF8, 0x84, 0x2A, 0xD8, 0xCA, 0xA2,
+    0x0D, 0x96, 0x6D, 0x54, 0x86, 0x21, 0x0F, 0xA7, 0x22, 0xE8, 0x07, 0x75, 0x3C, 0xC1, 0x65, 0xBD,
+    0xA1, 0x99, 0x4E, 0xDA, 0x7C, 0x82, 0x49, 0xC9, 0x08, 0x8C, 0x1A, 0x88, 0x7D, 0xC5, 0x56, 0x30,
+    0x5A, 0x09, 0x1B, 0x2C, 0x3B, 0x2E, 0xC3, 0x50, 0x40, 0x11, 0xAB, 0xA7, 0x04, 0xAD, 0xD7, 0xA0,
+    0xBC, 0x8A, 0x95, 0xE2, 0x17, 0x5B, 0xC4, 0x0E, 0xE0, 0xF9, 0x0D, 0x5A, 0x3D, 0x6D, 0x00, 0xE1,
+    0xBF, 0xE5, 0x76, 0x60, 0xA2, 0x9D, 0xE9, 0x57, 0xB4, 0x96, 0xE7, 0x94, 0xF1, 0xFF, 0xD7, 0xBE,
+    0xBB, 0x19, 0xAF, 0x8C, 0x62, 0x2F, 0xED, 0xA3, 0x56, 0xAB, 0x8A, 0x0A, 0x68, 0x75, 0x35, 0x61,
+    0x0B, 0xE1, 0xF5, 0x99, 0x29, 0xD9, 0x03, 0x50, 0xF4, 0x6B, 0x83, 0x2B, 0x30, 0x9E, 0x63, 0x04,
+    0x96, 0xAD, 0x00, 0xBD, 0xB4, 0xB7, 0xDD, 0x47, 0xC0, 0x7F, 0xA6, 0x19, 0x3A, 0xBD, 0x59, 0x81,
+    0xA1, 0xD8, 0x0C, 0xF8, 0xE4, 0xDA, 0x25, 0xA6, 0x04, 0xA6, 0xB2, 0x6C, 0x30, 0x1E, 0x28, 0x42,
+    0x88, 0xBD, 0x22, 0xA3, 0x76, 0xD3, 0x62, 0xB4, 0x5A, 0x9D, 0x34, 0x0F, 0xF5, 0x1A, 0x60, 0x63,
+    0xBD, 0xFC, 0x05, 0x0E, 0xDC, 0x5F, 0xE0, 0x40, 0x5B, 0x01, 0x7B, 0xD8, 0x02, 0x0C, 0x69, 0xC8,
+    0x80, 0xDB, 0x5D, 0x06, 0xDC, 0xE6, 0x32, 0x30, 0xC6, 0xF1, 0x04, 0x7C, 0x9C, 0x0E, 0xC0, 0xCF,
+    0x3E, 0x01, 0xA1, 0x71, 0x70, 0xC5, 0x37, 0x2A, 0x5C, 0x76, 0x30, 0x99, 0xB0, 0x81, 0x6D, 0x81,
+    0xB9, 0x84, 0x22, 0xFF, 0xD0, 0xC7, 0x4E, 0x2B, 0x5E, 0x6B, 0xAF, 0x99, 0x20, 0x5E, 0xD5, 0x63,
+    0x42, 0x46, 0xCA, 0xF8, 0xBD, 0x93, 0x4E, 0x5E, 0xBA, 0x9C, 0x7E, 0x27, 0x41, 0x10, 0x04, 0x45,
+    0x16, 0x45, 0x06, 0x25, 0xBC, 0x56, 0x08, 0x85, 0x51, 0x33, 0x78, 0xCD, 0x4E, 0x1B, 0x8C, 0xDA,
+    0xAC, 0x0E, 0x18, 0x9E, 0x9D, 0xE6, 0x97, 0x19, 0xCC, 0xE7, 0xB5, 0xCB, 0x02, 0xF2, 0x12, 0x8B,
+    0x8F, 0x10, 0xC6, 0x14, 0xC6, 0x04, 0xFE, 0x83, 0xEC, 0x6D, 0x06, 0xB7, 0xE9, 0xFD, 0x3F, 0x14,
+    0xD8, 0xE4, 0x9F, 0xC4, 0x10, 0x31, 0x79, 0xD0, 0x3E, 0x25, 0x28, 0x9D, 0x92, 0x3B, 0x61, 0x61,
+    0x39, 0x4D, 0xBD, 0xF0, 0xBD, 0x56, 0xDC, 0x6E, 0x0A, 0x7E, 0xC7, 0x1E, 0x04, 0xDC, 0x49, 0x9F,
+    0x99, 0x66, 0x53, 0xB8, 0xAB, 0x07, 0xF0, 0xAA, 0x8E, 0x41, 0x19, 0x46, 0x55, 0x23, 0xC1, 0x70,
+    0x69, 0x9B, 0xBD, 0xB4, 0x35, 0x98, 0xE4, 0x86, 0xDD, 0xFA, 0x55, 0xD8, 0x6D, 0xC0, 0x6B, 0xEC,
+    0xEB, 0x13, 0x43, 0x69, 0x2C, 0x1D, 0xE2, 0x73, 0xE0, 0x49, 0x52, 0x04, 0x35, 0xD6, 0x73, 0x8D,
+    0x74, 0xBF, 0xE2, 0x12, 0xBE, 0x5D, 0xC2, 0x96, 0xF6, 0xF6, 0x57, 0x60, 0x37, 0xBF, 0x88, 0xDD,
+    0x7B, 0x33, 0x8D, 0xD9, 0xE8, 0x75, 0x09, 0x5F, 0x1B, 0xBE, 0xFE, 0x8E, 0x12, 0x4A, 0x2C, 0x67,
+    0xAF, 0x88, 0xCF, 0x46, 0x33, 0x63, 0x1E, 0x04, 0x63, 0x71, 0x05, 0x5C, 0x19, 0x33, 0xB8, 0x32,
+    0x65, 0x18, 0x8B, 0x3F, 0x61, 0xCC, 0xFE, 0x84, 0x29, 0xFB, 0x13, 0xFC, 0xE9, 0x4F, 0xF0, 0x87,
+    0x3F, 0x21, 0x24, 0x9F, 0x41, 0xDB, 0x54, 0x30, 0x8A, 0x4E, 0x38, 0x31, 0xE8, 0xE7, 0xA1, 0x60,
+    0x24, 0x25, 0x90, 0xB4, 0xC2, 0xD8, 0x78, 0xFD, 0x1B, 0x57, 0xC5, 0x20, 0xAD, 0x83, 0x74, 0xDB,
+    0xDD, 0xB4, 0x61, 0x74, 0xEF, 0x9D, 0xCB, 0xF6, 0x15, 0x21, 0x6C, 0xAD, 0x64, 0x13, 0x2E, 0x83,
+    0xCB, 0xD8, 0x56, 0xFC, 0x2D, 0xCB, 0xF3, 0x97, 0xD6, 0xB4, 0xDA, 0xC7, 0x96, 0xDB, 0x35, 0xFD,
+    0x65, 0x8D, 0xE2, 0x97, 0xD6, 0x5C, 0x0E, 0xC2, 0x88, 0xEB, 0x1A, 0xAB, 0xA7, 0xBD, 0x2A, 0x83,
+    0xF4, 0x41, 0x13, 0x37, 0x3F, 0x6A, 0xAA, 0xE2, 0xCE, 0x3D, 0x60, 0x92, 0x76, 0xAC, 0xA4, 0xC4,
+    0x24, 0x29, 0xF1, 0x2F, 0xF4, 0x87, 0xDA, 0xB1, 0xA5, 0x57, 0x64, 0x4A, 0x46, 0xA0, 0xE8, 0x32,
+    0x46, 0xED, 0x37, 0x3A, 0xAD, 0x2C, 0x9B, 0xCB, 0xF4, 0x42, 0x3B, 0xAE, 0xBC, 0x5F, 0xC1, 0x4B,
+    0x1B, 0x9D, 0x74, 0xC2, 0xA0, 0xEF, 0x7D, 0x51, 0xD8, 0x98, 0xD6, 0xBA, 0xCF, 0x5B, 0x45, 0x34,
+    0x5E, 0x4E, 0xEB, 0xB8, 0xA5, 0x0A, 0xB8, 0x07, 0xBC, 0xAA, 0x3A, 0xE3, 0xA5, 0x83, 0x45, 0xCA,
+    0x84, 0xFA, 0xBA, 0x58, 0x0E, 0xA6, 0xE8, 0x13, 0xC3, 0xEE, 0x0F, 0x4C, 0x1A, 0x4F, 0xB8, 0x71,
+    0xE5, 0x2A, 0xAB, 0x3A, 0xAD, 0x40, 0xD8, 0xAF, 0x8D, 0xC9, 0x55, 0x1A, 0xFB, 0x81, 0x12, 0x30,
+    0x65, 0xF8, 0xB5, 0x41, 0x91, 0x11, 0x15, 0xDE, 0x8F, 0xFE, 0xDA, 0xFB, 0x13, 0x5E, 0xDA, 0xE9,
+    0xA4, 0x15, 0x78, 0xBB, 0xA5, 0x41, 0x7A, 0x24, 0x49, 0xD9, 0x4B, 0xD2, 0x0F, 0x9F, 0x7E, 0xBB,
+    0xBC, 0x73, 0x06, 0x14, 0xFD, 0x6F, 0xEE, 0xE3, 0x69, 0xD2, 0xF7, 0x7B, 0xCD, 0xDF, 0xE9, 0x57,
+    0x9F, 0xEE, 0xAE, 0x17, 0x4D, 0xD7, 0xF4, 0x6F, 0xBD, 0xDD, 0x57, 0xD3, 0x1E, 0x8A, 0xD7, 0xDD,
+    0x36, 0x45, 0x32, 0x1D, 0xB7, 0x22, 0xD0, 0xA7, 0xEB, 0x17, 0xEE, 0xEA, 0x29, 0xF4, 0x52, 0x02,
+    0xAF, 0x0A, 0x8C, 0x2A, 0x46, 0x65, 0x52, 0xB6, 0xCA, 0xA3, 0xF6, 0x4E, 0x47, 0xAF, 0x95, 0xB0,
+    0xA2, 0x15, 0x81, 0xA2, 0xC9, 0x10, 0xA2, 0x3D, 0x69, 0x3A, 0x17, 0xBF, 0x4F, 0x11, 0xA6, 0xB4,
+    0xAC, 0x30, 0x26, 0x01, 0xEE, 0xAF, 0x32, 0xE0, 0x9E, 0x9D, 0x80, 0x55, 0x02, 0x4C, 0xCB, 0xBF,
+    0x56, 0x5A, 0x57, 0x07, 0x93, 0x81, 0x6F, 0x0D, 0x07, 0xF0, 0x9D, 0xB0, 0x01, 0xA1, 0x65, 0xB0,
+    0xDC, 0xEE, 0xE7, 0xAA, 0x1A, 0xF8, 0xDA, 0x87, 0x1F, 0x02, 0xA3, 0x2A, 0x30, 0x34, 0x70, 0x6B,
+    0x05, 0x3A, 0xCD, 0xD0, 0x05, 0xD5, 0xB9, 0xE1, 0xA5, 0xD3, 0x33, 0x85, 0x6C, 0x65, 0x8A, 0x2B,
+    0x2E, 0xDB, 0x6C, 0x34, 0x1D, 0x36, 0x1B, 0xF9, 0x34, 0x64, 0x23, 0xBF, 0xBB, 0xD3, 0xC8, 0xEF,
+    0xEE, 0x30, 0xD5, 0xA7, 0x31, 0x0D, 0xD9, 0xA7, 0x29, 0x4D, 0xE7, 0x58, 0xFC, 0x1E, 0x76, 0x27,
+    0x49, 0x6B, 0xDF, 0xE8, 0xE1, 0x55, 0x7D, 0x3E, 0xD3, 0xF8, 0xE3, 0x9A, 0x45, 0x65, 0xC0, 0x2B,
+    0x03, 0xAF, 0x7D, 0xF8, 0x3D, 0x60, 0x52, 0x76, 0x3A, 0x91, 0xF6, 0x45, 0x5B, 0xAF, 0xC2, 0xF2,
+    0x14, 0xC2, 0x8E, 0x66, 0x50, 0x74, 0x07, 0xF4, 0x5A, 0xC3, 0x0C, 0x46, 0xC3, 0x09, 0x0C, 0x65,
+    0x59, 0x01, 0xD7, 0xE2, 0x9F, 0x1A, 0xD8, 0x7C, 0x06, 0xA0, 0x29, 0xB2, 0xA1, 0x7D, 0x16, 0x34,
+    0x03, 0xF6, 0x99, 0x00, 0x96, 0x7F, 0x5B, 0x00, 0x9B, 0x9B, 0x64, 0x8E, 0xFE, 0x00, 0x53, 0x58,
+    0x12, 0xF8, 0x0D, 0x6D, 0x0C, 0x7A, 0x60, 0xF5, 0x18, 0x69, 0x93, 0x92, 0x95, 0xAC, 0xB4, 0x82,
+    0x53, 0x1D, 0xA4, 0xB9, 0x55, 0x59, 0xEC, 0xA4, 0x35, 0xE8, 0x41, 0xEB, 0xEE, 0xBC, 0x58, 0xF5,
+    0x17, 0xBE, 0x9C, 0x8E, 0x56, 0xAD, 0xF9, 0xB6, 0x5A, 0x6F, 0xAB, 0x3E, 0x7E, 0x69, 0x8D, 0xCB,
+    0x2F, 0x56, 0x74, 0xA7, 0x15, 0x14, 0x59, 0xB6, 0xE7, 0x6B, 0xCE, 0xAF, 0x58, 0x63, 0x25, 0xA9,
+    0xCE, 0x8D, 0x85, 0x76, 0x23, 0x5D, 0xB5, 0x67, 0x43, 0x01, 0xD0, 0x84, 0x0C, 0x17, 0x8F, 0x3C,
+    0xB6, 0x4A, 0xB4, 0x3B, 0x00, 0x7D, 0xB3, 0x1D, 0xFC, 0x3E, 0x2C, 0x3A, 0x16, 0x3D, 0x93, 0x1E,
+    0x49, 0xFF, 0x5D, 0xC5, 0xAA, 0x74, 0x9A, 0x7B, 0xCD, 0x43, 0xBE, 0x78, 0x3A, 0x9F, 0x50, 0x44,
+    0xAB, 0xA9, 0xD8, 0xCA, 0x78, 0x32, 0x1D, 0x2C, 0xED, 0xB3, 0xDD, 0x08, 0x23, 0xE9, 0xC4, 0x4A,
+    0xDA, 0xB0, 0x4D, 0x76, 0xBF, 0xF7, 0x5B, 0xCF, 0xDD, 0x4F, 0xAB, 0xE1, 0xA1, 0x7C, 0xC9, 0x0E,
+    0xBD, 0xAF, 0x1D, 0xAC, 0xB4, 0xC1, 0x24, 0x01, 0x4E, 0xD9, 0xEB, 0x27, 0x2D, 0xC1, 0x93, 0x3E,
+    0x95, 0x62, 0xA7, 0x6A, 0x75, 0x4C, 0x7A, 0x80, 0x29, 0xF8, 0xD4, 0xB7, 0x14, 0xBA, 0xF3, 0x92,
+    0x44, 0x5B, 0x2E, 0x7D, 0xA5, 0x17, 0x63, 0x4B, 0x92, 0xE2, 0x50, 0xC0, 0x3E, 0x5F, 0xCD, 0xAF,
+    0x58, 0x9D, 0xDB, 0xEA, 0xBD, 0xA5, 0x95, 0xF1, 0xA4, 0x25, 0xFF, 0x7F, 0x6F, 0xF5, 0xC1, 0xF5,
+    0x18, 0xA4, 0xD2, 0xBA, 0xA1, 0xA4, 0x68, 0x2E, 0x2F, 0xF6, 0x5F, 0xB1, 0xA9, 0xFA, 0x77, 0xDC,
+    0xD4, 0xFC, 0xB7, 0xDC, 0xD4, 0x71, 0xE9, 0x23, 0x7F, 0xFB, 0x4D, 0x5D, 0xD1, 0x75, 0x75, 0x54,
+    0xB7, 0x08, 0x7B, 0x8E, 0xB1, 0x5B, 0x94, 0xDD, 0xE2, 0xEC, 0x16, 0x69, 0xB7, 0x58, 0x7B, 0x8E,
+    0x36, 0xF8, 0x56, 0xA3, 0x62, 0xDC, 0x35, 0x53, 0x6B, 0x57, 0xDE, 0xAA, 0x10, 0x3A, 0xCD, 0x4C,
+    0x6B, 0x88, 0x0C, 0xD1, 0x27, 0xF8, 0xAE, 0x3B, 0xAF, 0xD3, 0x87, 0x5E, 0x37, 0x40, 0xD0, 0x53,
+    0x1A, 0xAB, 0xBB, 0x1A, 0x2A, 0xB6, 0x74, 0xDA, 0x7A, 0x31, 0x1D, 0x28, 0xDA, 0x8A, 0xDF, 0x3B,
+    0xAD, 0xEE, 0x24, 0x6C, 0xD7, 0x4C, 0x2D, 0x87, 0x95, 0x74, 0x0E, 0x92, 0x8E, 0x17, 0x0D, 0xBF,
+    0x93, 0xA0, 0x79, 0xD3, 0x8C, 0xBD, 0x94, 0x72, 0xA3, 0x40, 0xBF, 0x73, 0x5B, 0xA9, 0x4D, 0x9E,
+    0x64, 0x6E, 0x05, 0x50, 0xE3, 0x7B, 0xAD, 0xED, 0x3F, 0xB6, 0x5C, 0xF0, 0x3C, 0xFE, 0xCD, 0x05,
+    0xD2, 0x41, 0xE7, 0x45, 0x9D, 0xAB, 0xB6, 0xAA, 0x7D, 0x1A, 0x0A, 0x8A, 0xB0, 0x6C, 0x63, 0xBE,
+    0xA4, 0xD7, 0xA7, 0x4B, 0x17, 0x0F, 0xDB, 0x72, 0x39, 0x8B, 0xCB, 0x65, 0x5D, 0xBE, 0x5C, 0x76,
+    0xD9, 0x7D, 0x82, 0x29, 0x59, 0x5D, 0xAB, 0x3C, 0x4D, 0x7A, 0x40, 0x90, 0x64, 0xAE, 0x39, 0x6B,
+    0xB4, 0xCD, 0x8B, 0x3B, 0x1A, 0xA4, 0x78, 0x69, 0x78, 0xA6, 0x5E, 0x79, 0xBC, 0xB1, 0xAD, 0x4F,
+    0xC0, 0xF3, 0x7C, 0x76, 0x7A, 0x70, 0x1D, 0x3F, 0x78, 0x29, 0xB5, 0x61, 0x8E, 0x2D, 0x68, 0xEF,
+    0x85, 0xCB, 0x6D, 0x7E, 0xE2, 0x13, 0x8A, 0xEE, 0xC4, 0xEF, 0xB6, 0x30, 0xA5, 0x5E, 0x4C, 0xE7,
+    0x57, 0xE7, 0x93, 0x97, 0x6F, 0xE0, 0x6E, 0x53, 0x40, 0x12, 0x5D, 0x1B, 0xA7, 0xCC, 0x53, 0xC5,
+    0xCF, 0xBD, 0xA2, 0x8B, 0xF8, 0xA3, 0xDF, 0x5A, 0xEF, 0xEE, 0x15, 0x81, 0x25, 0x01, 0x63, 0xC6,
+    0x4A, 0xA2, 0x97, 0xB4, 0x22, 0x69, 0xE7, 0x0E, 0xFE, 0xB8, 0xF6, 0xD9, 0xA1, 0xF2, 0x00, 0xA3,
+    0xD7, 0x33, 0x46, 0x51, 0x73, 0xAF, 0xE8, 0x9F, 0xBE, 0xAA, 0xCD, 0x49, 0x8A, 0x4D, 0x92, 0xB5,
+    0x29, 0xCA, 0xC5, 0xE1, 0x5F, 0xA5, 0xA2, 0x53, 0x6D, 0xFA, 0x63, 0x52, 0xE9, 0x24, 0xCD, 0x8C,
+    0x3A, 0x2E, 0xF6, 0x5C, 0xEB, 0xA4, 0xDF, 0x51, 0xA2, 0xD3, 0xBC, 0x1C, 0x2C, 0x07, 0xBD, 0xD0,
+    0x86, 0x3F, 0x31, 0xEA, 0xB5, 0x32, 0x65, 0x8C, 0x8C, 0x60, 0xCC, 0x98, 0x6A, 0xDB, 0x0B, 0x5B,
+    0x86, 0xDA, 0x88, 0x5C, 0x2A, 0x30, 0x66, 0x9C, 0x94, 0x5F, 0x78, 0x31, 0x9D, 0xB8, 0x63, 0xCC,
+    0x30, 0x1D, 0x8C, 0x87, 0xCB, 0x8D, 0xB4, 0x93, 0xCB, 0xB0, 0x24, 0x7C, 0x72, 0x05, 0xB4, 0xE1,
+    0x77, 0x57, 0xE9, 0xB5, 0xB2, 0x6C, 0x56, 0xF3, 0x20, 0x08, 0xD1, 0xE8, 0xE7, 0xA1, 0x70, 0x57,
+    0x67, 0x27, 0xE9, 0x60, 0x52, 0x61, 0x91, 0x56, 0xBC, 0x32, 0xC3, 0xED, 0xA8, 0xEC, 0xE5, 0x66,
+    0x3A, 0x82, 0x14, 0x69, 0xAD, 0xB4, 0x6B, 0xA3, 0x3F, 0xFF, 0xD4, 0x08, 0x86, 0x8A, 0xDF, 0x2F,
+    0xE5, 0xCD, 0x78, 0x12, 0x22, 0x9D, 0x56, 0xD7, 0x42, 0xD4, 0x0A, 0xDA, 0xDD, 0x01, 0x56, 0xBF,
+    0xD0, 0x0C, 0x63, 0x53, 0x86, 0x5E, 0x02, 0xEC, 0xE7, 0x61, 0x07, 0x64, 0x0B, 0x30, 0x6D, 0x4B,
+    0x84, 0xCB, 0x8C, 0x42, 0x0D, 0xB7, 0xBB, 0x3B, 0xB1, 0xCA, 0x5D, 0x73, 0x44, 0xA1, 0xCE, 0x83,
+    0xE2, 0xA2, 0x13, 0xBF, 0x0F, 0xD2, 0xCC, 0x35, 0xF5, 0xEF, 0x75, 0x37, 0x58, 0x7D, 0x9C, 0x98,
+    0xA4, 0x44, 0x78, 0xA6, 0xAD, 0xD3, 0x1A, 0xA2, 0xA9, 0x84, 0x38, 0x64, 0xB4, 0xBA, 0x13, 0x31,
+    0xA6, 0x4E, 0x4D, 0x70, 0xFA, 0xDD, 0x56, 0xFC, 0xEE, 0x0A, 0x7E, 0x9F, 0x0A, 0x7E, 0xFF, 0x28,
+    0xFF, 0x23, 0xFF, 0xD9, 0x53, 0xE5, 0x49, 0x3F, 0xD5, 0x39, 0xEA, 0xBE, 0xF6, 0xA1, 0xA2, 0x99,
+    0x9B, 0x36, 0xDC, 0x68, 0x14, 0xB2, 0xC1, 0x5D, 0xAD, 0xF4, 0x6D, 0x4C, 0x96, 0x18, 0x55, 0xE8,
+    0xF4, 0xF3, 0xCB, 0xD4, 0x48, 0xC0, 0x90, 0x00, 0xFF, 0xFA, 0xDB, 0xF4, 0x79, 0xC9, 0xB8, 0x4F,
+    0xDA, 0x34, 0xE8, 0x30, 0xDA, 0x96, 0xE4, 0x0A, 0x8A, 0xCB, 0xDE, 0xAB, 0x17, 0x43, 0x76, 0x99,
+    0x29, 0xF9, 0x1D, 0xAD, 0x5A, 0x6D, 0x36, 0x95, 0x29, 0xB9, 0xDC, 0x69, 0x9E, 0xCE, 0xE9, 0xC4,
+    0x4B, 0x2B, 0x8B, 0x4E, 0x58, 0x2A, 0x70, 0x07, 0x80, 0x57, 0x6E, 0x20, 0x88, 0x5E, 0x4A, 0x7D,
+    0x7D, 0x2B, 0x77, 0x05, 0x51, 0xF1, 0x31, 0x30, 0x6D, 0xFE, 0x7E, 0xD8, 0x46, 0xE9, 0xF1, 0x20,
+    0xE9, 0xCD, 0x3A, 0x2F, 0xBB, 0x18, 0x4E, 0x1F, 0xFB, 0xEA, 0x0E, 0x64, 0xD4, 0x69, 0x5D, 0xA4,
+    0xE8, 0xA4, 0x95, 0x50, 0x81, 0x1B, 0xE0, 0xCE, 0xF7, 0xE8, 0x25, 0xBC, 0x6A, 0xAF, 0x87, 0xD9,
+    0x6D, 0x2E, 0x7D, 0x93, 0x25, 0x62, 0x05, 0x21, 0x31, 0x0A, 0xAB, 0x9D, 0x70, 0x32, 0x54, 0xF0,
+    0x3B, 0xF7, 0xC5, 0xF8, 0x56, 0xE9, 0x8B, 0x93, 0xF6, 0x49, 0x95, 0x49, 0x6B, 0xF3, 0xCC, 0xDD,
+    0x47, 0x33, 0x5D, 0x9B, 0xCA, 0x14, 0xDC, 0x7F, 0x0D, 0x89, 0xAD, 0xBF, 0x72, 0x14, 0x21, 0x82,
+    0xCD, 0xC0, 0xB2, 0x31, 0x3D, 0x2B, 0x4C, 0xD2, 0x36, 0x48, 0xA5, 0xD7, 0xAC, 0xE8, 0x37, 0x9B,
+    0xDD, 0xC9, 0x12, 0xC5, 0x70, 0x4E, 0x09, 0x7D, 0x50, 0x71, 0xC9, 0xEF, 0x9D, 0x4C, 0xC5, 0xEF,
+    0x7E, 0x37, 0xD9, 0x08, 0xCD, 0xD3, 0xE1, 0xF7, 0x4E, 0xCA, 0x0C, 0x6D, 0xDE, 0x3C, 0xDF, 0xA6,
+    0x64, 0x66, 0x54, 0xEC, 0xA5, 0x75, 0xFA, 0x85, 0xBA, 0x62, 0xB2, 0xDB, 0xC7, 0x3D, 0x20, 0x73,
+    0x0E, 0xC7, 0xF8, 0x23, 0xCD, 0x21, 0x1C, 0x46, 0x15, 0xA7, 0x19, 0xBF, 0xF1, 0x40, 0xF3, 0xF8,
+    0x48, 0xEF, 0x54, 0x2B, 0x25, 0xA7, 0xCA, 0x70, 0xDD, 0xC1, 0xDD, 0x07, 0xBC, 0xCD, 0x2B, 0x58,
+    0x45, 0xBF, 0x4E, 0xB9, 0x53, 0x31, 0xC7, 0xA0, 0x6D, 0x51, 0x5A, 0x7A, 0xE5, 0xE1, 0x17, 0x1A,
+    0xD2, 0xF2, 0xC6, 0xFA, 0xAF, 0x5C, 0xAA, 0x6E, 0x03, 0x82, 0xFF, 0xC9, 0x09, 0x0C, 0xCA, 0xA1,
+    0xE9, 0xBA, 0xBF, 0x48, 0x8D, 0x01, 0x2B, 0x80, 0xBC, 0x36, 0x60, 0xFC, 0x61, 0x2D, 0x80, 0x39,
+    0xC2, 0x9F, 0x6C, 0x2F, 0x75, 0x7C, 0xE4, 0x3E, 0x55, 0xBF, 0xFF, 0xF3, 0x25, 0x16, 0x57, 0xEB,
+    0xA0, 0x34, 0x46, 0x29, 0x86, 0xD2, 0x67, 0xAB, 0x64, 0x2B, 0x7E, 0x9E, 0x4E, 0xEE, 0xD0, 0xB5,
+    0x51, 0x5A, 0xF7, 0x1F, 0x60, 0xD2, 0x8E, 0x74, 0xF6, 0xF5, 0xDB, 0xD9, 0x24, 0x93, 0xBB, 0xD5,
+    0x64, 0xB0, 0x27, 0x4C, 0x3B, 0x4E, 0x33, 0x4E, 0x1B, 0x5F, 0x0B, 0x09, 0xDC, 0x01, 0xEE, 0x1C,
+    0x71, 0x87, 0x5F, 0xA7, 0xE4, 0x9F, 0x69, 0x9B, 0xA4, 0xD9, 0xEA, 0x68, 0x4E, 0xF1, 0xF7, 0xE8,
+    0xDE, 0x1E, 0x35, 0xBB, 0xC3, 0x6B, 0x9D, 0xD2, 0x6B, 0x5A, 0xA7, 0x84, 0x66, 0xBF, 0x23, 0xFC,
+    0xD6, 0x89, 0x25, 0xF6, 0x95, 0x10, 0x4D, 0x41, 0xAB, 0xCD, 0x9D, 0xE6, 0x21, 0x1B, 0xE1, 0x8E,
+    0x41, 0xB8, 0x34, 0x8A, 0x31, 0x7D, 0x47, 0xFF, 0x60, 0xFC, 0x2C, 0xAB, 0x8E, 0x4A, 0xCA, 0xA3,
+    0xA2, 0x8E, 0xA1, 0xB2, 0xAC, 0xDC, 0xDC, 0x4E, 0x23, 0x80, 0x48, 0x9F, 0xBA, 0x0D, 0x9B, 0xCC,
+    0x86, 0x3D, 0xC7, 0xD8, 0x66, 0x58, 0x9D, 0x4E, 0xE0, 0xE5, 0x6B, 0x53, 0xFE, 0xBF, 0x1C, 0xCB,
+    0xEF, 0xF3, 0xB5, 0x5E, 0xFB, 0x90, 0x55, 0x8D, 0xFE, 0x73, 0xD8, 0x95, 0xFB, 0xE2, 0x7F, 0x3A,
+    0xFB, 0xFF, 0x92, 0x30, 0x67, 0x86, 0x65, 0x81, 0xE1, 0x59, 0x82, 0xE6, 0xE1, 0x33, 0x9D, 0xA6,
+    0x8D, 0xF1, 0xD3, 0x4A, 0x5F, 0xDD, 0xF1, 0x4F, 0xFD, 0x1E, 0x9E, 0x3C, 0x2A, 0x46, 0xC7, 0x12,
+    0xA7, 0x3A, 0x9C, 0x68, 0xBE, 0x1A, 0x95, 0x57, 0xFE, 0x94, 0x36, 0x68, 0x41, 0x4A, 0x10, 0x9E,
+    0x1C, 0xE0, 0xDF, 0xCC, 0x30, 0xDD, 0x17, 0xB8, 0x18, 0x56, 0x6C, 0xF2, 0x1B, 0xE6, 0x70, 0x09,
+    0xB2, 0x3D, 0x21, 0x98, 0x02, 0x7E, 0x16, 0x8C, 0x71, 0x89, 0x2F, 0xB9, 0x7D, 0x4A, 0x8F, 0x9E,
+    0xA4, 0xA1, 0x1E, 0x3A, 0x8D, 0xB2, 0xCF, 0xA8, 0xB8, 0x93, 0xF1, 0xE4, 0xEB, 0x70, 0x03, 0xDD,
+    0x7B, 0xF0, 0xDE, 0x4C, 0x43, 0xEA, 0xA0, 0x82, 0x32, 0x2F, 0xEB, 0xB4, 0xDA, 0x31, 0x4A, 0x3E,
+    0xCC, 0x8C, 0x0F, 0x7F, 0xF0, 0x59, 0x86, 0x3F, 0x58, 0xDC, 0xC7, 0x89, 0xFE, 0x6F, 0xCA, 0x1F,
+    0xF8, 0x15, 0xF7, 0xE8, 0x97, 0x9F, 0x16, 0xF0, 0x4E, 0x6F, 0x1D, 0x74, 0xA7, 0xCF, 0x53, 0x64,
+    0xD8, 0xB4, 0x09, 0xBC, 0x91, 0xC9, 0x74, 0xD9, 0x9D, 0xEE, 0xA7, 0x8F, 0x9E, 0x6C, 0x3E, 0xFA,
+    0x27, 0x4E, 0xA8, 0xD3, 0xE9, 0x0F, 0x73, 0x18, 0x45, 0xCD, 0x77, 0x66, 0x77, 0x70, 0x03, 0xBC,
+    0x04, 0xBC, 0xCB, 0x9D, 0x39, 0x64, 0xF4, 0x47, 0x4A, 0xA6, 0xBE, 0xA6, 0xE8, 0x8E, 0xBE, 0xB2,
+    0x44, 0x77, 0xF4, 0xC2, 0x6F, 0xEE, 0xEC, 0x74, 0x6F, 0xD9, 0x06, 0x49, 0x78, 0x29, 0xA3, 0x0F,
+    0xC3, 0x6E, 0x33, 0x9A, 0xC7, 0x64, 0x32, 0x21, 0x8E, 0xE9, 0x8F, 0x2B, 0xE1, 0xC9, 0x1F, 0x1D,
+    0xBD, 0xCA, 0x12, 0x07, 0xFD, 0xAC, 0xB6, 0x5E, 0x7F, 0xE7, 0x52, 0xA3, 0x9D, 0x2A, 0xBD, 0x94,
+    0x8C, 0x9E, 0x94, 0x5E, 0x9D, 0xEE, 0x0B, 0x9F, 0xB4, 0x0E, 0xD9, 0x6F, 0xBD, 0xA6, 0x44, 0xF8,
+    0x38, 0xE3, 0xFF, 0xB2, 0xE2, 0x0E, 0xAD, 0x36, 0xFB, 0xDD, 0x54, 0x97, 0x7B, 0xF5, 0x7A, 0x43,
+    0xF3, 0xD2, 0x94, 0xEB, 0xDC, 0x88, 0xF0, 0x06, 0x78, 0x97, 0xF7, 0x08, 0xE7, 0x58, 0x9C, 0x7E,
+    0xA6, 0xFC, 0x9A, 0x1E, 0x2A, 0xF5, 0xF5, 0x0C, 0xD1, 0xE9, 0xBE, 0xF0, 0x79, 0x38, 0x3B, 0x45,
+    0xBF, 0x0D, 0x15, 0xB5, 0x3B, 0x37, 0x5A, 0xA7, 0xDD, 0x16, 0x34, 0x8F, 0xC9, 0xB6, 0x58, 0x1F,
+    0x55, 0xC2, 0x93, 0xDF, 0x3A, 0x8C, 0xF2, 0x12, 0x07, 0xFD, 0xB8, 0x36, 0x2B, 0x7D, 0x07, 0xE8,
+    0xDE, 0xED, 0xBE, 0xC7, 0xA8, 0x37, 0x15, 0x9D, 0x7E, 0xA2, 0xA3, 0x7F, 0xF8, 0x4B, 0x55, 0x8C,
+    0x0E, 0x45, 0x94, 0xA6, 0xC4, 0x72, 0x0C, 0x99, 0xF1, 0x34, 0x62, 0xC8, 0xCD, 0x8D, 0xF8, 0x0D,
+    0x31, 0x26, 0x96, 0xE8, 0x4E, 0xA6, 0xDD, 0x16, 0xDC, 0x61, 0x2A, 0xA6, 0x9A, 0x26, 0x43, 0x20,
+    0x48, 0x17, 0x07, 0xEE, 0x8E, 0x6F, 0x5C, 0x44, 0x6B, 0x27, 0x6E, 0x85, 0xD1, 0x41, 0xEB, 0x25,
+    0xCD, 0x84, 0xDE, 0xB9, 0x77, 0xEF, 0x4A, 0x6C, 0xAE, 0xC9, 0xC2, 0x49, 0xB5, 0xD3, 0x1B, 0xC9,
+    0x1D, 0xCC, 0x21, 0x62, 0x0A, 0x8C, 0x09, 0x42, 0xC4, 0xD4, 0xA6, 0xA8, 0x7C, 0x62, 0x55, 0x1C,
+    0xDF, 0xD4, 0x27, 0xE5, 0xCB, 0xC4, 0xD6, 0xBD, 0xCB, 0xBB, 0xFC, 0x7D, 0xC2, 0x31, 0xE6, 0x41,
+    0x4E, 0x3F, 0x53, 0x52, 0x79, 0x4D, 0xEF, 0xEB, 0x2F, 0x74, 0xF6, 0xF5, 0xD4, 0xF7, 0xFD, 0xEE,
+    0xF4, 0xA6, 0x36, 0xCD, 0xFE, 0x74, 0xC5, 0xE6, 0x4E, 0x71, 0x49, 0x63, 0x1A, 0x4A, 0xAF, 0x59,
+    0xAB, 0x4F, 0x2E, 0x9B, 0x82, 0x56, 0xBF, 0x8D, 0xC9, 0xE6, 0x4E, 0x84, 0x38, 0xA6, 0x21, 0x9B,
+    0x42, 0x58, 0xFD, 0xEE, 0x8E, 0x7F, 0x5F, 0xD0, 0xEC, 0x9F, 0x7C, 0x7C, 0xD8, 0xDC, 0xA9, 0x2E,
+    0x71, 0x4C, 0x56, 0x7F, 0x55, 0x09, 0xB3, 0x2B, 0xDC, 0xDA, 0xFC, 0xDF, 0xE5, 0x15, 0x08, 0xC9,
+    0x15, 0x46, 0xAD, 0xCB, 0xDE, 0x85, 0x6C, 0x04, 0x4B, 0x9C, 0x76, 0x4C, 0xE9, 0x2B, 0xF8, 0xCD,
+    0x6F, 0xF4, 0xD5, 0x64, 0x18, 0xF7, 0x65, 0x05, 0x0D, 0x09, 0x5C, 0xAA, 0x80, 0xC6, 0x08, 0xEE,
+    0xAF, 0x4F, 0x40, 0x0B, 0x30, 0x68, 0x03, 0x42, 0x63, 0xDF, 0x5B, 0x1F, 0xE7, 0x0E, 0xA0, 0x6F,
+    0x37, 0x09, 0x67, 0xCC, 0xF6, 0xFE, 0x06, 0x8B, 0x0E, 0x18, 0x54, 0x00, 0x5F, 0x01, 0xFE, 0x9C,
+    0x17, 0xB5, 0xCC, 0xD0, 0x06, 0x38, 0x9A, 0xC1, 0x7D, 0x5E, 0x80, 0xA5, 0xDB, 0xC1, 0x9C, 0x00,
+    0x63, 0x1B, 0xC5, 0x03, 0x98, 0xC2, 0xC5, 0x21, 0xF6, 0xD7, 0x89, 0x8E, 0x92, 0xD1, 0x5B, 0xC7,
+    0x92, 0xA6, 0x34, 0xC5, 0x10, 0x35, 0x07, 0xF4, 0x9B, 0xD9, 0x64, 0x53, 0xFD, 0xEE, 0x92, 0x3B,
+    0x35, 0xFB, 0xD5, 0xFF, 0xA4, 0x74, 0x05, 0xB9, 0xD3, 0x1E, 0x43, 0xF6, 0x69, 0x8A, 0x7E, 0x5B,
+    0x36, 0x19, 0xA1, 0xBF, 0xCC, 0x21, 0xA1, 0x2B, 0x2C, 0x36, 0x78, 0x55, 0xDF, 0xBD, 0x8A, 0x06,
+    0xA6, 0x08, 0x50, 0x81, 0x6F, 0xDA, 0x04, 0xDD, 0xD3, 0x65, 0x05, 0xAB, 0x0C, 0xB8, 0x66, 0x60,
+    0x1F, 0x03, 0x70, 0x77, 0xE6, 0x5D, 0xFC, 0xD1, 0x29, 0x7A, 0x75, 0x4A, 0xA3, 0x36, 0x9D, 0xB8,
+    0x33, 0x7C, 0x93, 0x4E, 0x0B, 0xE0, 0x05, 0x58, 0xCD, 0xD7, 0x69, 0x8A, 0xBF, 0x48, 0xDD, 0xCB,
+    0x65, 0x9C, 0x12, 0x0C, 0x7F, 0x5D, 0x31, 0x4F, 0x52, 0xF8, 0x4F, 0xF7, 0x75, 0x8C, 0x4A, 0xCB,
+    0x69, 0x74, 0xB8, 0x93, 0xE5, 0x31, 0x37, 0x74, 0xFF, 0x87, 0x98, 0xFA, 0x37, 0xC6, 0xCF, 0xB2,
+    0x3E, 0xBA, 0x65, 0xEA, 0x3C, 0x54, 0xBE, 0xFF, 0x1F, 0xB9, 0xE1, 0xEB, 0x19, 0xE0, 0xF6, 0x4F,
+    0x97, 0x81, 0xE1, 0x00, 0xA6, 0xBD, 0x95, 0xE1, 0xBB, 0xDC, 0x79, 0x43, 0x9B, 0xCD, 0xA1, 0xA0,
+    0x7F, 0x13, 0xA2, 0x3B, 0x4C, 0xEE, 0x84, 0x8F, 0x63, 0xB2, 0x67, 0x5F, 0x09, 0xF3, 0xB2, 0x0D,
+    0xA7, 0xCB, 0x84, 0x27, 0x8A, 0xED, 0x66, 0xD3, 0xA9, 0xF5, 0x02, 0x03, 0xFD, 0x3A, 0x8C, 0xCF,
+    0x12, 0x7D, 0x13, 0x0A, 0x6B, 0x9B, 0xC1, 0x74, 0x33, 0xFC, 0x2E, 0xDD, 0x4D, 0x77, 0xB3, 0x64,
+    0x34, 0x87, 0x0F, 0x74, 0xD8, 0x6C, 0xCA, 0xD7, 0xC2, 0x36, 0x26, 0x97, 0x10, 0x61, 0x5D, 0xA2,
+    0xC9, 0xA6, 0xF4, 0x95, 0x71, 0x77, 0xC9, 0x1D, 0x84, 0x79, 0x59, 0x7D, 0x34, 0xB9, 0x2F, 0x9D,
+    0x18, 0x93, 0x4B, 0xEE, 0x24, 0xAC, 0x21, 0x2E, 0x9B, 0x29, 0xA6, 0x1A, 0xE1, 0x92, 0x3F, 0xA6,
+    0xCC, 0xF2, 0x48, 0x3F, 0x78, 0x96, 0x7E, 0xAA, 0x45, 0xE1, 0xDB, 0xFA, 0xA1, 0x3E, 0xD3, 0xB9,
+    0x94, 0x51, 0x6F, 0xE9, 0xBE, 0xF6, 0x29, 0xB9, 0xC3, 0x14, 0x5E, 0xE2, 0x25, 0x3A, 0xAE, 0x01,
+    0x8C, 0xC2, 0x6F, 0xD3, 0xEE, 0x35, 0x2F, 0xD1, 0x6F, 0xAF, 0x69, 0x5E, 0xA2, 0x8F, 0x97, 0x08,
+    0x10, 0x9A, 0xC3, 0xDA, 0x55, 0x84, 0xE6, 0xBE, 0x74, 0x15, 0x71, 0x09, 0xC1, 0x66, 0x93, 0x4D,
+    0x65, 0x38, 0x87, 0x6C, 0x0B, 0xEE, 0x70, 0xA7, 0xCB, 0xD7, 0x18, 0xC6, 0xA4, 0xF4, 0x51, 0xFE,
+    0x67, 0xE3, 0x2F, 0xF5, 0xEC, 0xB3, 0x9A, 0x47, 0xFD, 0x0F, 0xFD, 0x4C, 0x47, 0x0B, 0xA2, 0xD5,
+    0xEB, 0xD3, 0xC4, 0xCC, 0x8C, 0x69, 0x16, 0xD8, 0x1C, 0x5F, 0x78, 0x6A, 0x1F, 0x8E, 0xCD, 0x27,
+    0x2F, 0xEB, 0xB5, 0x48, 0xFE, 0x74, 0xFE, 0x06, 0x8B, 0xB4, 0x3B, 0xA9, 0xF6, 0xF5, 0xCF, 0x35,
+    0x7B, 0xC6, 0x68, 0x8E, 0x21, 0x31, 0x7D, 0x90, 0x01, 0x85, 0x95, 0x49, 0xC2, 0x2A, 0x9C, 0x04,
+    0x96, 0xE8, 0x92, 0xC9, 0x08, 0x1F, 0x5D, 0x32, 0x27, 0x42, 0xB3, 0xAB, 0xDA, 0xF1, 0x3A, 0x41,
+    0xE5, 0x42, 0xDE, 0xBF, 0x07, 0xBC, 0xDD, 0xE9, 0x84, 0x31, 0x79, 0xAD, 0xF4, 0xEA, 0x1F, 0x1E,
+    0xE0, 0x77, 0x04, 0xA6, 0x30, 0x26, 0xF0, 0xB1, 0xAF, 0x60, 0x33, 0xFE, 0x93, 0x93, 0xB0, 0x1A,
+    0xE9, 0x70, 0x07, 0xCB, 0x33, 0x45, 0xCD, 0xC3, 0x69, 0xF2, 0x98, 0xD0, 0x3C, 0xFD, 0x58, 0xB8,
+    0xD4, 0xE7, 0x69, 0x47, 0xF8, 0x47, 0xE5, 0x5B, 0xEE, 0x18, 0x4E, 0xFF, 0x24, 0x06, 0xC9, 0xEA,
+    0x34, 0xD2, 0xEA, 0xC5, 0xA0, 0xAD, 0xD7, 0xCC, 0x1D, 0x2E, 0xA0, 0x66, 0x6C, 0xF7, 0x57, 0x78,
+    0x4D, 0x33, 0xB4, 0xF1, 0x0C, 0x7D, 0x05, 0x53, 0xC3, 0x66, 0xA4, 0xD3, 0xEA, 0x61, 0x19, 0x4E,
+    0x53, 0xDD, 0xD1, 0x55, 0x97, 0xBA, 0xEA, 0x52, 0x5F, 0xDC, 0x61, 0xF3, 0xA0, 0x90, 0x8C, 0x14,
+    0x09, 0x05, 0xEE, 0xCC, 0xAD, 0x63, 0xDF, 0x4A, 0xB4, 0x87, 0xD9, 0x24, 0x53, 0xFB, 0xD8, 0xD7,
+    0x36, 0x04, 0xED, 0x85, 0x93, 0x18, 0x55, 0x79, 0xE5, 0xCF, 0x6A, 0xA3, 0x11, 0x9B, 0x6F, 0x25,
+    0xDA, 0xE7, 0x8A, 0x93, 0xC4, 0xA0, 0xC7, 0x4D, 0xA2, 0xBD, 0x0B, 0xFF, 0x72, 0x1E, 0x14, 0x3B,
+    0x15, 0xA7, 0xD4, 0x4B, 0x3F, 0x7E, 0x98, 0x8D, 0x94, 0xFB, 0xDA, 0xEB, 0x4D, 0xA1, 0x59, 0xB3,
+    0xDF, 0xFC, 0xA6, 0xD5, 0x1D, 0x63, 0xF2, 0xD1, 0x94, 0x41, 0x4A, 0xC8, 0x48, 0x27, 0x3E, 0x4A,
+    0x85, 0x69, 0x5F, 0xA2, 0x66, 0x77, 0x8C, 0xC9, 0x6F, 0x36, 0x0F, 0xD9, 0x9D, 0xA6, 0x98, 0xDA,
+    0xEB, 0xDF, 0x55, 0x34, 0x2F, 0x12, 0x4B, 0x1C, 0x54, 0x99, 0x76, 0x42, 0xB3, 0x74, 0x33, 0xC0,
+    0xDD, 0x0F, 0x6F, 0x1A, 0xB9, 0x05, 0x89, 0xA1, 0x7E, 0xFB, 0xC4, 0x47, 0x1F, 0xFB, 0x8A, 0x18,
+    0x0E, 0x7B, 0x32, 0xED, 0xD3, 0xC6, 0xB2, 0x0B, 0xA4, 0x0C, 0xD2, 0x8E, 0x79, 0x1A, 0x66, 0xA6,
+    0x1F, 0x64, 0xBA, 0xE2, 0xD2, 0x27, 0x0F, 0x77, 0xFF, 0x24, 0xA8, 0x53, 0x56, 0xB2, 0xFA, 0xB1,
+    0x70, 0x27, 0xF3, 0xF3, 0x5B, 0x54, 0xE7, 0x18, 0x3B, 0xB9, 0x83, 0xF0, 0xC3, 0xCC, 0x18, 0xCB,
+    0x45, 0x69, 0x5C, 0x1F, 0xAF, 0xCC, 0x74, 0xCA, 0xF4, 0xD2, 0xDA, 0xD7, 0xF7, 0x53, 0x57, 0x4C,
+    0xA6, 0x76, 0x95, 0x80, 0xF0, 0x6B, 0x98, 0xC7, 0x1F, 0x69, 0x1E, 0x9E, 0x69, 0x36, 0xAA, 0xA0,
+    0x03, 0xFC, 0xC6, 0x03, 0x77, 0x74, 0xD9, 0xE8, 0x9D, 0xCA, 0x22, 0xE1, 0x54, 0x5B, 0x2F, 0xE8,
+    0x66, 0xF8, 0x9F, 0xD5, 0xBD, 0x3F, 0xB0, 0x25, 0xC7, 0x75, 0xE6, 0xF9, 0xAB, 0x4A, 0xF4, 0x2B,
+    0x11, 0x25, 0x4D, 0xF6, 0xC6, 0xA2, 0xB5, 0x22, 0xA0, 0x61, 0x8D, 0x41, 0x83, 0xC4, 0x88, 0x2C,
+    0x99, 0x32, 0x80, 0xCE, 0x22, 0x68, 0xC8, 0x80, 0xA1, 0xDE, 0x08, 0xB4, 0xB8, 0x33, 0x34, 0x20,
+    0x83, 0x13, 0x41, 0x4E, 0xC4, 0x46, 0xCB, 0x58, 0x83, 0x06, 0x80, 0x2A, 0x10, 0x06, 0x0D, 0x1A,
+    0xEC, 0xD8, 0xD0, 0x1F, 0x63, 0x0C, 0xC1, 0xC0, 0x6C, 0x90, 0x8D, 0xDD, 0x68, 0x19, 0x32, 0x18,
+    0x1B, 0x0D, 0x54, 0x12, 0x6D, 0x30, 0x62, 0x64, 0xB0, 0x38, 0x0C, 0x0E, 0x0D, 0x19, 0x2C, 0x91,
+    0x20, 0x47, 0x4B, 0x18, 0x9D, 0x20, 0x0B, 0x64, 0x35, 0x3A, 0x2B, 0xBF, 0x35, 0xB2, 0xEE, 0x7D,
+    0xEF, 0x35, 0x40, 0x49, 0x23, 0x09, 0x14, 0x54, 0x81, 0x77, 0x01, 0xDC, 0x5B, 0xB7, 0x6E, 0xE5,
+    0xC9, 0xCC, 0xF3, 0xE7, 0x3B, 0xDF, 0x39, 0x45, 0x71, 0x9D, 0x76, 0x2A, 0xD4, 0xD5, 0x1B, 0xCD,
+    0xCC, 0x25, 0x00, 0xFE, 0x00, 0xEB, 0xE9, 0x29, 0x57, 0xEC, 0x8C, 0xEB, 0x8A, 0x8D, 0x3A, 0xE0,
+    0x3C, 0xA2, 0x8A, 0xB4, 0x33, 0x1A, 0xAA, 0x8D, 0x36, 0x20, 0x5F, 0x6D, 0xB8, 0xC0, 0x57, 0x01,
+    0xB8, 0x08, 0x44, 0xE0, 0x39, 0xA0, 0xED, 0xC0, 0x7A, 0x30, 0x01, 0x8A, 0x15, 0x4E, 0x34, 0xD3,
+    0x4A, 0x38, 0x69, 0x72, 0xF7, 0xDE, 0x58, 0xDC, 0x9B, 0xE1, 0x23, 0x6D, 0xB8, 0x85, 0x5D, 0x2E,
+    0x53, 0x45, 0xDB, 0x95, 0xC9, 0x78, 0xF4, 0x89, 0x80, 0x9B, 0x6E, 0x61, 0xD7, 0xCB, 0x18, 0xD9,
+    0xEE, 0xCF, 0xC7, 0xEF, 0xFA, 0x57, 0xAC, 0x7E, 0xA6, 0x42, 0x4A, 0x34, 0xDA, 0x60, 0x7C, 0x1D,
+    0xEA, 0xFD, 0xBA, 0xAC, 0xEF, 0xF2, 0x63, 0x87, 0xE3, 0x91, 0xBB, 0x80, 0xD5, 0x02, 0x95, 0xE4,
+    0x41, 0x7F, 0xBA, 0x81, 0x9B, 0xDA, 0x89, 0x6A, 0x2D, 0x22, 0xA8, 0x6B, 0xC1, 0x06, 0xA0, 0x4C,
+    0x00, 0x6E, 0x02, 0x3E, 0xB5, 0x5D, 0x1D, 0x68, 0xA5, 0x88, 0x91, 0x34, 0x70, 0x49, 0x7F, 0x7C,
+    0x05, 0x9A, 0x00, 0x94, 0x3A, 0x9E, 0x65, 0x22, 0x40, 0x3F, 0x80, 0xB9, 0x73, 0xF7, 0xF7, 0x6F,
+    0x4E, 0xBD, 0xA4, 0x58, 0x49, 0x92, 0xEF, 0xE7, 0x47, 0x14, 0xCA, 0xEB, 0x00, 0xC5, 0x00, 0xBF,
+    0x52, 0xAC, 0x27, 0x2F, 0x35, 0x43, 0x7F, 0x53, 0x77, 0xE6, 0x4A, 0xD2, 0x44, 0xFF, 0x43, 0x79,
+    0x5A, 0x6F, 0x03, 0x76, 0x2A, 0x23, 0x55, 0x60, 0xA4, 0x88, 0xB8, 0x81, 0x9E, 0xC6, 0xD3, 0x4C,
+    0xCD, 0x4C, 0x93, 0xC6, 0x95, 0x56, 0xD2, 0xD0, 0x7E, 0x57, 0xFF, 0x3D, 0x1A, 0x7F, 0x81, 0xC7,
+    0xF2, 0xA0, 0x2E, 0x5D, 0x7D, 0xEA, 0xD2, 0xD5, 0xFF, 0x55, 0x9A, 0xA4, 0x6F, 0x28, 0x19, 0x6D,
+    0x46, 0x43, 0xA1, 0xAE, 0x4A, 0xD8, 0x05, 0x1B, 0x19, 0x07, 0x9A, 0xA5, 0x5A, 0xC1, 0xCD, 0xCE,
+    0xC3, 0xF8, 0x5A, 0x84, 0xFF, 0x49, 0xCD, 0x5F, 0x53, 0x28, 0x69, 0xA3, 0x92, 0x14, 0xC0, 0x0A,
+    0x78, 0xA8, 0x5D, 0x9E, 0x02, 0x49, 0x01, 0x23, 0xC9, 0x83, 0x5D, 0x00, 0x9C, 0x07, 0x0A, 0x01,
+    0xD4, 0x11, 0x28, 0x94, 0x00, 0xA7, 0x04, 0x85, 0x74, 0x10, 0xB0, 0x9D, 0xE9, 0xBB, 0x32, 0x62,
+    0x03, 0x6E, 0x60, 0xA3, 0x5A, 0x68, 0x3D, 0xC2, 0xAC, 0x34, 0xD3, 0xBE, 0x88, 0x4E, 0x8F, 0x87,
+    0x87, 0xE3, 0x47, 0x23, 0x26, 0x62, 0x67, 0xDC, 0x70, 0x5C, 0x54, 0x09, 0xE0, 0xD7, 0xAF, 0x43,
+    0xAF, 0x0E, 0x29, 0x90, 0xAA, 0x88, 0xE8, 0x19, 0xBD, 0xED, 0xDC, 0x02, 0x1F, 0xEF, 0xC1, 0x7E,
+    0x79, 0xC1, 0xCC, 0x1A, 0x88, 0x76, 0xA5, 0xED, 0x46, 0x5F, 0x2D, 0xD5, 0x8A, 0xBA, 0x1E, 0xBB,
+    0xD6, 0x13, 0xF2, 0x2B, 0x75, 0xBC, 0x0C, 0xE3, 0x97, 0x07, 0xAA, 0x9F, 0x4E, 0x0F, 0x30, 0x86,
+    0xA6, 0xB3, 0xAB, 0x9D, 0x4D, 0x34, 0x9B, 0xD9, 0x90, 0x36, 0xAC, 0x22, 0x5C, 0x7B, 0x3D, 0x0F,
+    0xC0, 0xBF, 0xE2, 0xFE, 0x6B, 0x72, 0xB7, 0x93, 0x7B, 0x62, 0x7D, 0x80, 0xEE, 0x70, 0xA7, 0x8D,
+    0x5E, 0x07, 0xC6, 0x1F, 0x8F, 0x13, 0x24, 0x78, 0x15, 0x22, 0x98, 0x99, 0x15, 0xB8, 0xCC, 0x33,
+    0x8C, 0xAB, 0xF1, 0x8F, 0x23, 0xF1, 0xB5, 0x86, 0x54, 0x7B, 0x5B, 0x77, 0xAF, 0x16, 0xA1, 0xFC,
+    0xB6, 0x77, 0x5C, 0xE4, 0xF3, 0xC1, 0x7A, 0xF8, 0xD0, 0x63, 0x55, 0x80, 0xEA, 0x9B, 0x45, 0x84,
+    0xE2, 0x07, 0xBE, 0xEF, 0xE0, 0xF3, 0x7F, 0x61, 0x03, 0x7C, 0xEC, 0x43, 0xA5, 0xFE, 0x64, 0xB2,
+    0xC6, 0x3B, 0x85, 0xCA, 0x7F, 0xAD, 0xD4, 0x62, 0x26, 0xDB, 0x15, 0x94, 0x81, 0x05, 0xCA, 0x40,
+    0x33, 0x50, 0x05, 0xD0, 0x1F, 0x5F, 0x9B, 0xA1, 0x92, 0x06, 0xE0, 0xC2, 0x7F, 0x06, 0xB8, 0x00,
+    0x55, 0x8A, 0x85, 0xD4, 0xB9, 0xDF, 0x0D, 0x76, 0xBA, 0x4C, 0xAC, 0xA7, 0xA6, 0x8B, 0xE5, 0xD2,
+    0x0E, 0xED, 0xEF, 0xAE, 0x5F, 0x90, 0x6E, 0x35, 0x9B, 0x86, 0x57, 0xEB, 0x19, 0x80, 0xE2, 0xC5,
+    0x56, 0x32, 0xD2, 0x74, 0xE9, 0x6A, 0x07, 0x60, 0x24, 0xDD, 0x91, 0x34, 0x4A, 0x09, 0xCC, 0x0A,
+    0x76, 0x06, 0x37, 0x40, 0x82, 0xF2, 0xA5, 0x4B, 0x57, 0x3F, 0x21, 0xFD, 0x95, 0x74, 0x4D, 0xDB,
+    0xA5, 0xAB, 0x57, 0x28, 0xAE, 0x02, 0xA3, 0x06, 0xEC, 0xF5, 0x7A, 0x62, 0xC1, 0xF8, 0xFA, 0xE1,
+    0xAF, 0x1A, 0xFF, 0xF9, 0xFE, 0xD5, 0xEA, 0x09, 0xFF, 0xCC, 0x33, 0xD6, 0x16, 0x6F, 0x86, 0xDF,
+    0x7A, 0xAC, 0xFA, 0x5E, 0xF7, 0xE7, 0x73, 0xB3, 0x94, 0xB7, 0xFD, 0xB3, 0xA1, 0xAE, 0x8B, 0x9F,
+    0x86, 0xC7, 0xFE, 0x75, 0xF3, 0x83, 0x37, 0xE7, 0xC7, 0x2E, 0x7D, 0xE2, 0xF7, 0x78, 0x0C, 0xFE,
+    0x82, 0x67, 0x69, 0x3A, 0x5A, 0x2D, 0x70, 0xF2, 0x15, 0x78, 0xF8, 0xC6, 0x57, 0x9C, 0x36, 0xA7,
+    0x78, 0xE9, 0xEA, 0x53, 0x5C, 0xBB, 0x8E, 0x84, 0x14, 0xC6, 0x3F, 0xDD, 0xDC, 0xE0, 0xBE, 0xEC,
+    0xED, 0x0F, 0x16, 0xB3, 0x26, 0xB6, 0xF6, 0x47, 0x32, 0x52, 0xD7, 0xAB, 0x2B, 0xBE, 0x0A, 0x17,
+    0x3A, 0x18, 0xA1, 0x8C, 0x50, 0x07, 0x68, 0x3D, 0x8C, 0x3C, 0xF8, 0x72, 0xBA, 0xD1, 0x4B, 0x49,
+    0xD2, 0xDD, 0xAB, 0xE3, 0xD5, 0xEE, 0xFC, 0xA7, 0x94, 0x11, 0x8A, 0x2B, 0xEF, 0x1C, 0x74, 0x3E,
+    0x0A, 0x4D, 0x8C, 0x1A, 0xDA, 0x37, 0xA2, 0x09, 0xCD, 0xF4, 0x58, 0x11, 0xC1, 0x79, 0xEA, 0x40,
+    0x19, 0x41, 0xD0, 0x0F, 0x34, 0x13, 0x75, 0xC0, 0x48, 0x8B, 0x93, 0x8A, 0x1B, 0x37, 0xAE, 0x03,
+    0xB4, 0x4B, 0xA9, 0xCD, 0xDC, 0x55, 0xE5, 0xFB, 0x82, 0x57, 0x29, 0x23, 0xD7, 0x42, 0xA1, 0x50,
+    0xBC, 0x11, 0x29, 0x22, 0x45, 0xA4, 0x5A, 0x2F, 0x8D, 0x61, 0xD4, 0xD0, 0xAF, 0xF9, 0x87, 0x2A,
+    0x5C, 0xB9, 0x35, 0x41, 0xF5, 0xE2, 0xF8, 0x43, 0x80, 0xE2, 0x29, 0x7E, 0x1D, 0xD4, 0xB5, 0x81,
+    0x26, 0x98, 0x44, 0x29, 0xDC, 0x84, 0x9B, 0xAB, 0x88, 0xD9, 0x18, 0x3D, 0xCE, 0xD7, 0x2B, 0x55,
+    0x44, 0x1D, 0xFD, 0x60, 0x03, 0xF5, 0x5A, 0x68, 0xFF, 0x82, 0x5D, 0x4C, 0x02, 0x75, 0xE3, 0x4C,
+    0xB3, 0x34, 0xA9, 0x28, 0xF5, 0xC6, 0xBD, 0xB7, 0x43, 0xAB, 0xAD, 0x4F, 0x46, 0x7A, 0x41, 0xDE,
+    0xF5, 0x53, 0x33, 0x57, 0xE1, 0x0A, 0x17, 0x19, 0x61, 0x57, 0x6A, 0x08, 0x0E, 0x9A, 0x2B, 0x1D,
+    0xF7, 0xB5, 0x79, 0x31, 0xDF, 0xE0, 0x85, 0x51, 0x13, 0x95, 0xB4, 0x61, 0xA4, 0xD4, 0x21, 0x35,
+    0x1D, 0x4E, 0x3F, 0x09, 0xD4, 0x52, 0x0B, 0xD2, 0x0F, 0x66, 0xAC, 0xB6, 0xCB, 0x14, 0xD2, 0x37,
+    0x26, 0x1A, 0xC5, 0x5B, 0x14, 0xD2, 0x97, 0x3C, 0x56, 0x4B, 0x04, 0xE9, 0xF7, 0x06, 0x2A, 0xBD,
+    0xB9, 0x40, 0xDD, 0x37, 0x80, 0xF9, 0x7E, 0x00, 0x1E, 0x77, 0x40, 0x75, 0x7B, 0x06, 0x6E, 0x3D,
+    0x0B, 0xD8, 0x6F, 0x78, 0x60, 0x8D, 0x40, 0x63, 0x07, 0x30, 0x3F, 0x0D, 0xC0, 0x73, 0x1B, 0xFC,
+    0x81, 0x55, 0x87, 0x7D, 0x43, 0x03, 0xF4, 0x1B, 0x50, 0x7C, 0x15, 0xA0, 0xBE, 0x9D, 0xFA, 0x37,
+    0x36, 0x37, 0xC0, 0x15, 0xB3, 0x9D, 0x24, 0x9E, 0x23, 0x9A, 0xA5, 0x9D, 0x3E, 0x08, 0x40, 0x3B,
+    0xB4, 0x2A, 0xB4, 0x16, 0xD7, 0x26, 0x7A, 0xCA, 0x5D, 0x8B, 0xB0, 0x51, 0x05, 0x5A, 0x4F, 0xE2,
+    0x91, 0xF4, 0x84, 0xD2, 0x83, 0x37, 0x5E, 0x82, 0x2B, 0x54, 0x1A, 0x6A, 0x2D, 0x75, 0xE8, 0x4D,
+    0x68, 0x5E, 0x5B, 0xAB, 0xB0, 0x95, 0xAB, 0x63, 0xB3, 0x7E, 0x34, 0xEB, 0x48, 0xAF, 0xAE, 0xDA,
+    0x17, 0xC5, 0xAF, 0x17, 0xD2, 0x24, 0xCD, 0x97, 0xAE, 0xDE, 0xA7, 0xB2, 0x30, 0x1D, 0x94, 0x13,
+    0x30, 0xC2, 0x23, 0x02, 0x9A, 0x99, 0x4A, 0x73, 0xD6, 0xFE, 0xFF, 0x76, 0xCB, 0x1F, 0xD0, 0x78,
+    0x68, 0xA6, 0xBC, 0xF0, 0xCC, 0x4A, 0x5E, 0x88, 0x22, 0xFF, 0x4F, 0xE3, 0x01, 0xD7, 0x61, 0x16,
+    0xEA, 0xAE, 0x0A, 0x90, 0x30, 0x91, 0x11, 0x1A, 0x8F, 0x06, 0x3B, 0x63, 0x02, 0x6E, 0x29, 0xD4,
+    0xB1, 0x61, 0x55, 0x4A, 0xB4, 0x83, 0xF9, 0x69, 0x70, 0x9A, 0xEB, 0x40, 0x74, 0x40, 0x11, 0x71,
+    0xD5, 0x0C, 0xB8, 0xC1, 0x4E, 0xAF, 0x00, 0x36, 0x98, 0xBB, 0x4F, 0xBF, 0x0E, 0x65, 0xA4, 0x97,
+    0x26, 0xE8, 0x3B, 0x23, 0xC5, 0x3C, 0xE9, 0xE5, 0xBA, 0xDB, 0x26, 0xD7, 0xC1, 0xD8, 0x65, 0x7B,
+    0x58, 0x1F, 0x54, 0xF6, 0xAF, 0xF2, 0xB7, 0x1C, 0xBF, 0x49, 0x1E, 0xAD, 0x59, 0xF6, 0xD1, 0x8A,
+    0x3C, 0xDA, 0x66, 0xCA, 0xA3, 0x35, 0xEB, 0x3E, 0x5A, 0x91, 0x47, 0xDB, 0xFA, 0x3C, 0x5A, 0xB3,
+    0xEC, 0xA3, 0xCD, 0xAB, 0xAC, 0xA3, 0xF5, 0xF5, 0xDF, 0x50, 0x05, 0xAA, 0x50, 0x6B, 0x61, 0x84,
+    0xAD, 0x94, 0xBC, 0x9D, 0x69, 0x87, 0xFE, 0x89, 0x58, 0xA8, 0xAB, 0x42, 0xE5, 0xDB, 0xD7, 0x24,
+    0x22, 0x0F, 0x98, 0xD5, 0x69, 0x76, 0x79, 0xA7, 0xE7, 0x8D, 0x3C, 0x41, 0xB1, 0x8F, 0x87, 0xBE,
+    0xCB, 0xE3, 0xB1, 0x33, 0x45, 0xDA, 0x0D, 0xEF, 0xD8, 0x01, 0x63, 0x87, 0x7B, 0xFB, 0x06, 0x34,
+    0x33, 0x46, 0x0A, 0x98, 0x08, 0x4E, 0x5B, 0x1E, 0x39, 0x00, 0x2F, 0xFE, 0x6D, 0xA3, 0xAD, 0x80,
+    0x47, 0x66, 0x20, 0x41, 0xA3, 0x09, 0xDA, 0x09, 0x23, 0x41, 0xB5, 0xC2, 0xB3, 0x55, 0x00, 0x41,
+    0xD9, 0x3D, 0xB7, 0xEF, 0x9A, 0xC6, 0x53, 0x2D, 0xC0, 0x23, 0x0B, 0x6C, 0x40, 0xA3, 0xAC, 0x3E,
+    0x0B, 0xAD, 0xD4, 0x81, 0xBA, 0xA3, 0xF1, 0x44, 0x4C, 0xA4, 0x88, 0xB8, 0x0E, 0x0D, 0xB8, 0xA1,
+    0x9E, 0x71, 0x0B, 0xD7, 0x42, 0x11, 0xB1, 0xAA, 0x15, 0x71, 0x98, 0x9F, 0x86, 0x71, 0xC3, 0xCE,
+    0x44, 0x57, 0x3C, 0x45, 0x79, 0x98, 0xDB, 0x9E, 0x7D, 0x6E, 0xA7, 0x3C, 0xB7, 0xE6, 0x30, 0xB7,
+    0x23, 0x79, 0x6E, 0x9B, 0x69, 0x9F, 0xDB, 0x75, 0x9F, 0x5B, 0x91, 0xE7, 0xD6, 0x4E, 0xFB, 0x80,
+    0x7E, 0xE3, 0xFE, 0x11, 0x5E, 0xA1, 0x99, 0x91, 0x37, 0x09, 0x1B, 0xB8, 0x00, 0x50, 0xBE, 0x48,
+    0x1F, 0x8C, 0xA6, 0x0B, 0x7D, 0x57, 0x44, 0x9A, 0xA9, 0xDC, 0x68, 0xA7, 0x72, 0xA3, 0x99, 0xD8,
+    0xA8, 0x03, 0xAD, 0x7F, 0x60, 0xFC, 0x93, 0x37, 0xA5, 0xDB, 0x92, 0xD1, 0x52, 0xA6, 0xEE, 0x74,
+    0x27, 0xAC, 0xFF, 0x0A, 0x40, 0xDF, 0x0F, 0x40, 0x2B, 0x01, 0xE6, 0x4D, 0x4D, 0xC0, 0x6F, 0x56,
+    0xCB, 0x3B, 0x85, 0xFB, 0x10, 0x47, 0x75, 0x83, 0x8D, 0x00, 0xA5, 0x26, 0xD8, 0xF7, 0x39, 0x56,
+    0x33, 0x50, 0xA4, 0xEC, 0x4E, 0xFD, 0x59, 0x00, 0xEA, 0x20, 0x80, 0x64, 0x17, 0xC0, 0x79, 0x0D,
+    0x50, 0x2D, 0x75, 0x04, 0xC4, 0xE8, 0xA1, 0x9D, 0xAA, 0x08, 0x66, 0xBB, 0x3A, 0x4E, 0x20, 0x29,
+    0x41, 0x93, 0x1D, 0x97, 0x74, 0xE3, 0x65, 0xC1, 0x38, 0xD0, 0x06, 0x6C, 0xA0, 0x54, 0x57, 0x26,
+    0x68, 0xD6, 0x62, 0x7C, 0x9D, 0x5A, 0xCB, 0xA8, 0xA9, 0x92, 0xBE, 0xA9, 0xC8, 0xA8, 0x98, 0xC5,
+    0x02, 0x30, 0xCE, 0x00, 0xAD, 0x06, 0xC0, 0x4C, 0xB7, 0x00, 0x9E, 0xA9, 0x3D, 0x50, 0xF9, 0x15,
+    0xC0, 0x8D, 0x07, 0x6B, 0xC1, 0xC1, 0x9C, 0x50, 0x64, 0x53, 0x1A, 0x01, 0x90, 0x07, 0x68, 0x37,
+    0x80, 0x2A, 0x9F, 0x96, 0xAD, 0x4C, 0x73, 0x27, 0x00, 0xE6, 0xAE, 0x00, 0x46, 0x1B, 0x00, 0x3B,
+    0xAB, 0x03, 0x13, 0xED, 0x0A, 0xF4, 0xDD, 0xE8, 0xC1, 0x86, 0x3A, 0x42, 0xB9, 0xD1, 0x7B, 0x70,
+    0xDF, 0xF9, 0xF4, 0x06, 0x56, 0xD2, 0x4C, 0x21, 0x49, 0xE0, 0x7E, 0x7C, 0x63, 0x0C, 0xD4, 0x2B,
+    0xA5, 0x40, 0xD0, 0x2E, 0xB4, 0x33, 0x85, 0x86, 0x47, 0x52, 0xC7, 0xA8, 0x27, 0xB5, 0xD1, 0x2B,
+    0x4A, 0xBE, 0x96, 0xFC, 0x6E, 0xEB, 0x34, 0x03, 0x4E, 0xBB, 0xB5, 0xBB, 0xB6, 0xBF, 0x61, 0xB4,
+    0x5C, 0xD8, 0x00, 0x5E, 0x15, 0xD6, 0x03, 0xCD, 0x37, 0x03, 0x11, 0xA8, 0xDE, 0x4C, 0x3C, 0x08,
+    0xB0, 0xB5, 0x79, 0x0D, 0xB9, 0x17, 0xF2, 0xD0, 0xEA, 0x90, 0x67, 0xAE, 0xDC, 0xAA, 0xEC, 0xED,
+    0xF5, 0x5D, 0xBE, 0xA6, 0x9D, 0xAD, 0xE4, 0xC1, 0x6C, 0xD9, 0x39, 0xCC, 0xAE, 0x63, 0x5E, 0x11,
+    0x09, 0xA0, 0xDA, 0xAE, 0xF6, 0x13, 0xCF, 0x50, 0x08, 0xB3, 0x61, 0x3D, 0xCE, 0xD3, 0xFB, 0x22,
+    0x62, 0x17, 0xEA, 0x48, 0xEF, 0x2B, 0x75, 0x95, 0xA4, 0xD5, 0x28, 0x95, 0x92, 0x84, 0xD3, 0xE4,
+    0xF6, 0xAB, 0x5C, 0xB8, 0xDA, 0x01, 0x63, 0x56, 0x69, 0x92, 0x26, 0x6A, 0x49, 0x1A, 0xF8, 0x0F,
+    0x7A, 0x7E, 0xDC, 0xA0, 0x59, 0x0A, 0x05, 0x4A, 0x61, 0xD4, 0xE1, 0x02, 0x6D, 0xC4, 0x88, 0x42,
+    0x9E, 0x7E, 0xC6, 0x46, 0xAA, 0x0D, 0xE4, 0x1F, 0xD5, 0x8F, 0xAF, 0xDB, 0x58, 0x4B, 0x09, 0xF9,
+    0x97, 0xF5, 0xE3, 0xA1, 0x89, 0x34, 0x2B, 0xA5, 0x86, 0x52, 0x1D, 0x6E, 0xC1, 0x05, 0x2A, 0x61,
+    0x04, 0x9A, 0x70, 0x01, 0xB7, 0x52, 0x25, 0x1A, 0xC1, 0xF8, 0xC3, 0x6B, 0xF2, 0xF4, 0x52, 0x8E,
+    0x53, 0x34, 0x63, 0x24, 0x5D, 0x7F, 0xC7, 0xEA, 0x2E, 0xD7, 0x1A, 0xB0, 0x6A, 0x3B, 0x68, 0x24,
+    0xA0, 0xB5, 0x09, 0xF8, 0x35, 0xF3, 0x8E, 0xAD, 0x70, 0xB5, 0x03, 0x5A, 0xAD, 0x50, 0x4A, 0xEA,
+    0xB0, 0x92, 0x26, 0x5C, 0xFA, 0x7D, 0x05, 0x14, 0xE8, 0xD7, 0x52, 0x1E, 0x17, 0x8D, 0x3A, 0x9A,
+    0x58, 0x0B, 0x9A, 0xCD, 0x6E, 0x60, 0xB7, 0x26, 0x82, 0xDD, 0xDA, 0x08, 0xCD, 0xE6, 0x56, 0x68,
+    0xA2, 0x5B, 0xA1, 0x8D, 0x6E, 0x05, 0xB7, 0xBA, 0x15, 0xDC, 0xE2, 0x56, 0x18, 0x83, 0x8B, 0xA0,
+    0xA9, 0xDD, 0x30, 0xF2, 0x56, 0x58, 0x51, 0xEB, 0x87, 0xE3, 0x86, 0xC9, 0x62, 0x95, 0x34, 0x40,
+    0xA3, 0xF5, 0x74, 0x5F, 0xC2, 0x47, 0xF8, 0xD5, 0x72, 0x65, 0x6B, 0x16, 0x1B, 0x9B, 0x45, 0xBE,
+    0x51, 0xA4, 0x91, 0xA7, 0x8D, 0xA0, 0x05, 0xAB, 0x05, 0xDD, 0x59, 0xEA, 0xD8, 0x2E, 0xBD, 0x6F,
+    0xC3, 0x33, 0xB4, 0x74, 0x5C, 0x04, 0xB8, 0x74, 0x85, 0x01, 0x5A, 0xAD, 0xD6, 0x53, 0x4B, 0xDB,
+    0x06, 0x92, 0x34, 0x61, 0xF5, 0xC7, 0xE3, 0x46, 0x1E, 0x12, 0xB5, 0x40, 0x01, 0x17, 0x68, 0xE4,
+    0x4B, 0x0D, 0x85, 0xD4, 0xD9, 0x48, 0xF3, 0xCD, 0x8D, 0x3E, 0x14, 0xD1, 0x2D, 0xA5, 0x86, 0xC6,
+    0x6B, 0xB2, 0x5B, 0x19, 0x8D, 0x70, 0x4B, 0x3B, 0xD8, 0x88, 0x5E, 0x5B, 0xE9, 0x67, 0xA3, 0x6B,
+    0x83, 0x51, 0x67, 0xB5, 0xD2, 0x44, 0x9C, 0x06, 0x34, 0x31, 0x1E, 0xAF, 0xA9, 0x80, 0xD1, 0xDD,
+    0x6B, 0xEA, 0xC8, 0xAB, 0xC6, 0xFC, 0x5C, 0x4A, 0xD0, 0x7E, 0x42, 0x1A, 0xE0, 0xDF, 0x64, 0x35,
+    0x77, 0x3A, 0x51, 0x03, 0x40, 0x7F, 0x26, 0x8E, 0xC9, 0xEA, 0x0B, 0x40, 0x03, 0x50, 0x76, 0xE7,
+    0xCF, 0x97, 0xBC, 0xF4, 0x65, 0xA5, 0x4A, 0xA9, 0xD5, 0x54, 0x69, 0xB2, 0x91, 0x7A, 0xA5, 0x0D,
+    0xF4, 0x9E, 0x7E, 0x32, 0x11, 0xE4, 0xDB, 0x89, 0x52, 0x45, 0x82, 0x6A, 0xB3, 0x01, 0x6C, 0x14,
+    0xD0, 0xDE, 0x5B, 0x00, 0xA7, 0x01, 0x50, 0xFE, 0x2D, 0x0F, 0x64, 0x1F, 0xA3, 0x5D, 0x00, 0xC6,
+    0xBC, 0x4F, 0x4F, 0x75, 0x62, 0x3F, 0x03, 0x8F, 0xE8, 0x75, 0x28, 0xF7, 0x98, 0x4C, 0x03, 0x60,
+    0xA5, 0xC3, 0x3B, 0x8D, 0x16, 0xC0, 0xAE, 0x40, 0xA1, 0x1F, 0xE6, 0x8D, 0xD6, 0x61, 0xB2, 0x86,
+    0x78, 0x73, 0x5C, 0xA9, 0x12, 0xF2, 0xF4, 0x53, 0x1D, 0xA9, 0x23, 0xE3, 0x84, 0x7C, 0x1D, 0xB1,
+    0x11, 0xF9, 0x42, 0x43, 0xBB, 0xD0, 0x2E, 0x75, 0xC2, 0xE8, 0xD3, 0x1A, 0x70, 0xD2, 0x84, 0xC9,
+    0xDB, 0xEB, 0xAD, 0x0E, 0xEA, 0x0D, 0xA8, 0xF6, 0xB5, 0x19, 0x76, 0xE3, 0x99, 0x63, 0xB5, 0xBB,
+    0x59, 0xAB, 0x25, 0x80, 0x5E, 0x09, 0xA8, 0xD2, 0xD3, 0x11, 0x70, 0x93, 0x0D, 0x50, 0x26, 0x9C,
+    0x07, 0x1B, 0x48, 0x40, 0xEF, 0xEB, 0x00, 0x26, 0xD1, 0x0F, 0x60, 0x97, 0x6C, 0xA1, 0x7C, 0xEB,
+    0xA1, 0x50, 0x19, 0x81, 0x7A, 0xB5, 0x33, 0xE0, 0xA6, 0xD1, 0x03, 0x7A, 0x42, 0x03, 0x54, 0xD1,
+    0xA8, 0x83, 0x26, 0x54, 0xEA, 0x60, 0x1C, 0x2A, 0x81, 0xD9, 0xA8, 0x13, 0xD8, 0x80, 0x8D, 0xD0,
+    0x7B, 0x9A, 0x40, 0x29, 0x4B, 0xEF, 0xB1, 0xEB, 0xF8, 0xC4, 0x06, 0xEE, 0xDB, 0xD2, 0x0C, 0xAA,
+    0x95, 0xA0, 0x8A, 0xB5, 0x06, 0x68, 0x67, 0x3A, 0x40, 0x67, 0x94, 0xF3, 0xDC, 0xCE, 0x40, 0xFD,
+    0x56, 0xB6, 0x2F, 0xCA, 0xD2, 0xCF, 0x27, 0x5C, 0x3B, 0x6C, 0xE7, 0x8F, 0x33, 0x50, 0xE8, 0xB5,
+    0x19, 0x23, 0xCD, 0x98, 0x1F, 0xC8, 0x63, 0xBC, 0xBA, 0x1D, 0xC2, 0x38, 0x3D, 0x3E, 0x57, 0x5C,
+    0xA1, 0xD2, 0x37, 0x03, 0xAD, 0x14, 0x18, 0xEF, 0x69, 0x2A, 0x34, 0x8C, 0xDE, 0x24, 0x46, 0x5F,
+    0x47, 0x34, 0xD8, 0x15, 0xD1, 0x84, 0x42, 0xB4, 0xC1, 0x08, 0x37, 0x57, 0x09, 0x37, 0xDB, 0x0D,
+    0x37, 0xB7, 0x1B, 0x6E, 0x7E, 0x35, 0xFE, 0x96, 0xFB, 0xD9, 0x5D, 0xC5, 0x56, 0x7F, 0xAD, 0xB5,
+    0xD1, 0xF3, 0x9A, 0xEB, 0x84, 0x3A, 0xAE, 0x70, 0x11, 0x28, 0xAE, 0x03, 0xCD, 0x76, 0xB0, 0x38,
+    0xB7, 0x6C, 0x07, 0x8B, 0xED, 0x60, 0x6D, 0x80, 0xF4, 0x2A, 0xE0, 0x22, 0x50, 0x5F, 0xFF, 0x25,
+    0xDD, 0xD0, 0xE7, 0xBA, 0xE2, 0x25, 0xE8, 0xF5, 0x05, 0x2D, 0xB4, 0x92, 0xE4, 0x6B, 0x8D, 0xFA,
+    0x4F, 0xB1, 0xD0, 0xE0, 0x66, 0xE7, 0xDD, 0x6C, 0xA2, 0x89, 0x75, 0x64, 0xEC, 0xC6, 0x4E, 0x83,
+    0x0D, 0xED, 0xDC, 0x84, 0x32, 0xD9, 0xB5, 0x14, 0xEE, 0x8D, 0x0D, 0x37, 0xD7, 0x4A, 0x98, 0x84,
+    0x12, 0xB8, 0xD9, 0x6D, 0x3C, 0x68, 0x52, 0xAD, 0xD9, 0x04, 0xF7, 0xB3, 0xB7, 0xF5, 0x27, 0x2A,
+    0x25, 0x2B, 0xF9, 0x46, 0x7E, 0xD4, 0x4C, 0x3F, 0x97, 0x7A, 0x1D, 0xAE, 0x70, 0x1A, 0x7D, 0xD7,
+    0x53, 0xA0, 0xD4, 0xD8, 0x51, 0x6B, 0x02, 0x17, 0xA0, 0xD6, 0x80, 0xB9, 0xB7, 0xC1, 0xBF, 0x6E,
+    0xE6, 0x3D, 0xA8, 0xA9, 0x56, 0x4A, 0x69, 0x28, 0xA4, 0xC8, 0x28, 0xF9, 0x66, 0x6D, 0xA2, 0x49,
+    0x8C, 0x7E, 0xF4, 0x55, 0xB4, 0x0B, 0xFD, 0x6B, 0xA2, 0x8A, 0x6E, 0x66, 0x7C, 0x21, 0x61, 0x17,
+    0x37, 0x17, 0x32, 0x09, 0x37, 0xBB, 0x50, 0xC7, 0x52, 0x7F, 0xAA, 0xCE, 0x4A, 0x33, 0xBD, 0x56,
+    0x0A, 0xAD, 0x07, 0x9F, 0xE0, 0xE3, 0x0C, 0xD8, 0xD8, 0x62, 0x74, 0x2F, 0x70, 0xB9, 0xDD, 0xF6,
+    0xF5, 0x50, 0x9C, 0xD5, 0x11, 0x0F, 0x77, 0xD0, 0x6B, 0xA0, 0x95, 0xB0, 0x1A, 0x97, 0x52, 0x85,
+    0x86, 0xDE, 0xDB, 0x68, 0x57, 0x46, 0xAF, 0xAE, 0x8E, 0x6D, 0x60, 0xBC, 0x2D, 0xEC, 0xEA, 0x66,
+    0xF4, 0xC9, 0x44, 0x13, 0xDC, 0x6C, 0x92, 0x11, 0xA3, 0x6F, 0x97, 0x76, 0x29, 0xA4, 0x8D, 0x5A,
+    0xEA, 0x68, 0x34, 0x90, 0xF5, 0xD5, 0x49, 0x76, 0xD5, 0x4D, 0xCA, 0xF8, 0x4B, 0x33, 0x00, 0x3C,
+    0x78, 0xE3, 0xC6, 0x69, 0x94, 0x7B, 0x35, 0x47, 0xF1, 0x55, 0x00, 0x37, 0x83, 0x86, 0x1C, 0xE5,
+    0x76, 0x40, 0xF1, 0x52, 0xD1, 0x51, 0x69, 0xBD, 0xB5, 0x5B, 0x18, 0xBD, 0x21, 0x4F, 0x1B, 0x6C,
+    0x0E, 0x25, 0x3D, 0x1A, 0xFA, 0x88, 0x0D, 0x8D, 0x7C, 0xA9, 0xEA, 0x8D, 0x88, 0xFB, 0xFE, 0x32,
+    0x0E, 0x66, 0x7B, 0xC5, 0x2E, 0x38, 0x15, 0xC2, 0xC8, 0xBB, 0x19, 0x17, 0xEA, 0x48, 0xA9, 0x52,
+    0x5D, 0xF6, 0x3B, 0x1B, 0x69, 0xA1, 0xFA, 0x96, 0x56, 0xF8, 0xF0, 0xEE, 0x31, 0x1D, 0x74, 0xA4,
+    0x07, 0x70, 0xC7, 0x20, 0x33, 0x7B, 0x02, 0xCE, 0x73, 0x08, 0x33, 0x22, 0x90, 0xFD, 0x8A, 0xD3,
+    0xE3, 0xC2, 0x50, 0xBC, 0x48, 0x2D, 0x34, 0x15, 0x5A, 0xAB, 0xC4, 0x23, 0xF2, 0x2E, 0x50, 0xC5,
+    0x32, 0x81, 0x9B, 0xDA, 0x19, 0xB3, 0x99, 0x0D, 0xDA, 0xD9, 0x79, 0x8A, 0x54, 0xAD, 0x60, 0xC3,
+    0x08, 0xC8, 0xCE, 0x60, 0xDF, 0x8C, 0x80, 0xDC, 0x00, 0xF6, 0xE7, 0x01, 0x18, 0x37, 0xF2, 0xAA,
+    0x80, 0x31, 0x1C, 0xB5, 0xA9, 0x3A, 0x72, 0xE8, 0x40, 0xB5, 0xC0, 0xE3, 0x27, 0x1B, 0x54, 0x52,
+    0x07, 0xA3, 0x26, 0x30, 0x9A, 0x81, 0xFA, 0x10, 0xFB, 0x76, 0x07, 0x3B, 0x60, 0x15, 0x00, 0xE5,
+    0x41, 0xCC, 0x80, 0xD9, 0x8E, 0xE3, 0xA9, 0x22, 0xC0, 0xD8, 0x7D, 0x16, 0x6C, 0xE8, 0x03, 0xA8,
+    0x95, 0xA7, 0xF9, 0x2B, 0x45, 0xCA, 0xB4, 0x8E, 0x13, 0x2E, 0x55, 0x1B, 0x46, 0x43, 0x3F, 0xE1,
+    0x42, 0x15, 0xA9, 0x12, 0xBD, 0xCF, 0xDB, 0xD0, 0xAE, 0x68, 0x40, 0x5D, 0x73, 0x1A, 0xED, 0x8F,
+    0x9E, 0x76, 0x69, 0x17, 0x8C, 0x94, 0xC0, 0x49, 0x03, 0x55, 0xD2, 0x04, 0xA3, 0xEF, 0x76, 0x25,
+    0x9F, 0x07, 0xB1, 0x63, 0x8D, 0x1D, 0x14, 0xD2, 0x04, 0xAD, 0x36, 0x28, 0xF6, 0x35, 0x90, 0x8F,
+    0xDE, 0x04, 0xB0, 0x41, 0x1D, 0x85, 0x6C, 0x80, 0x66, 0x4A, 0xC0, 0xC5, 0xE2, 0xBC, 0xD8, 0xFF,
+    0x37, 0x1E, 0x86, 0x31, 0xD8, 0x8D, 0x46, 0x43, 0x3F, 0x17, 0x63, 0x34, 0x82, 0xDE, 0xB7, 0x33,
+    0x66, 0xCB, 0xB2, 0x77, 0x13, 0x65, 0x32, 0x11, 0x9A, 0xB9, 0x1F, 0x40, 0x75, 0x00, 0x1B, 0x12,
+    0xA0, 0xC6, 0x83, 0xFD, 0xE9, 0x0A, 0xA8, 0x87, 0xBC, 0x1F, 0x19, 0x57, 0xA0, 0xD6, 0xD1, 0x03,
+    0xB6, 0x0B, 0x50, 0x6E, 0xEC, 0x91, 0xDA, 0x74, 0x6D, 0x82, 0x5E, 0x0B, 0xD4, 0xDA, 0x00, 0x97,
+    0x00, 0xFE, 0xDF, 0x83, 0x37, 0x74, 0xF5, 0x0A, 0x07, 0x97, 0x29, 0xDB, 0x1C, 0x1E, 0xBE, 0xF1,
+    0xD5, 0x7F, 0x41, 0xE1, 0x43, 0x71, 0xE3, 0xC6, 0x90, 0x4D, 0xA8, 0x91, 0xFC, 0x7D, 0x73, 0xF2,
+    0x9E, 0xAB, 0xE6, 0xDD, 0x32, 0xD9, 0xCE, 0x00, 0x45, 0x2C, 0x02, 0xD0, 0xBC, 0xBD, 0x65, 0x47,
+    0x7C, 0x38, 0x95, 0x12, 0xDD, 0xBF, 0x8C, 0x58, 0xEC, 0x0A, 0x50, 0x06, 0x26, 0xCC, 0x5A, 0x7B,
+    0x8C, 0x34, 0xEC, 0x31, 0x54, 0xFB, 0xFA, 0x2F, 0xD3, 0x04, 0xBF, 0xBF, 0xC3, 0xD5, 0x7A, 0x82,
+    0x63, 0x56, 0x23, 0xC7, 0x67, 0x8D, 0xCF, 0xB1, 0xE9, 0x57, 0xF2, 0xCD, 0x0D, 0x00, 0xED, 0xFC,
+    0x9E, 0x09, 0x6A, 0x1C, 0xB8, 0xC2, 0xC7, 0x01, 0x6E, 0x01, 0x2C, 0x79, 0xD6, 0xA0, 0xDC, 0xAE,
+    0x1C, 0x22, 0xE4, 0x71, 0x38, 0x4E, 0xD6, 0x07, 0x8E, 0x77, 0xD8, 0x06, 0xA0, 0x8F, 0x07, 0xA5,
+    0xD1, 0xCF, 0x87, 0x4F, 0xF7, 0x3C, 0x46, 0x07, 0x27, 0xD2, 0x75, 0xAC, 0xB4, 0xD1, 0x48, 0xA2,
+    0xD5, 0xF5, 0xDE, 0x37, 0x1B, 0x75, 0xB0, 0x91, 0x72, 0xB5, 0x1B, 0xC4, 0x2A, 0xC1, 0x43, 0x46,
+    0xDD, 0x41, 0xE1, 0xF4, 0x33, 0xD0, 0xAE, 0x80, 0x4D, 0x80, 0xC9, 0x1E, 0xF7, 0x7C, 0xF4, 0x93,
+    0x04, 0x65, 0xA9, 0x40, 0xE5, 0x9D, 0xBA, 0x47, 0x82, 0x95, 0x14, 0x91, 0x14, 0xB1, 0xD2, 0x0A,
+    0xBD, 0x66, 0x38, 0x9B, 0x9D, 0x78, 0x70, 0x37, 0xAC, 0x26, 0xEE, 0x09, 0x9E, 0xC3, 0x9F, 0xBB,
+    0xDF, 0x8E, 0x7D, 0x0E, 0x8C, 0x02, 0x95, 0x12, 0xB5, 0x34, 0x54, 0x5B, 0xED, 0xCD, 0xC6, 0xC5,
+    0xFC, 0xA5, 0x0E, 0x7A, 0x9F, 0x07, 0x6D, 0x57, 0x30, 0x09, 0x90, 0x2F, 0x71, 0xA1, 0x9A, 0xAC,
+    0x6E, 0x2E, 0x85, 0x14, 0x71, 0x5A, 0x29, 0x35, 0x73, 0x88, 0x53, 0x1E, 0x39, 0x02, 0xB4, 0x8D,
+    0x80, 0xF6, 0x4E, 0x80, 0xF6, 0x5B, 0x1B, 0xB8, 0xA9, 0x19, 0x38, 0x19, 0x4E, 0x7D, 0x8F, 0xAB,
+    0xC0, 0x23, 0x4A, 0x1D, 0x4E, 0x5A, 0xE8, 0xA5, 0xC8, 0x98, 0x3E, 0x21, 0xFA, 0x85, 0xD6, 0xBB,
+    0x40, 0x3D, 0xBB, 0x05, 0x13, 0x9A, 0x15, 0xAE, 0xD8, 0xED, 0x10, 0x68, 0x14, 0xD9, 0x48, 0xCE,
+    0x80, 0xBB, 0x5F, 0x64, 0x01, 0x68, 0x23, 0xFC, 0x4A, 0x2D, 0x4F, 0x83, 0x36, 0xAE, 0x79, 0x27,
+    0x29, 0xE4, 0xC0, 0xD1, 0xED, 0x60, 0xC4, 0x00, 0x3C, 0x75, 0x14, 0x41, 0xED, 0xB3, 0x4F, 0xA6,
+    0x85, 0x32, 0x45, 0xAA, 0xB0, 0xD1, 0xF8, 0xE7, 0x70, 0x3C, 0x7E, 0xCE, 0x47, 0x32, 0x0A, 0x34,
+    0x5A, 0x19, 0xB5, 0x16, 0x7A, 0x22, 0x98, 0x8D, 0x8B, 0x75, 0xDC, 0xBD, 0x9B, 0x90, 0x85, 0xE4,
+    0xE6, 0xFD, 0x2F, 0x30, 0xB8, 0x50, 0x4D, 0x2E, 0x8D, 0x53, 0x23, 0x79, 0xAB, 0x94, 0x45, 0xF4,
+    0x10, 0xE7, 0x7E, 0x35, 0x1B, 0xC8, 0x2A, 0x9D, 0xBA, 0x1C, 0xDD, 0x7D, 0xA1, 0xF6, 0x3F, 0xBF,
+    0x84, 0x1E, 0xEC, 0x40, 0x1D, 0xD5, 0x96, 0x87, 0xD8, 0x77, 0xE7, 0x82, 0x89, 0x87, 0x3B, 0xAC,
+    0x7C, 0x21, 0x0D, 0xAD, 0x52, 0xA1, 0x27, 0x82, 0x5D, 0xE8, 0x46, 0x8F, 0xD9, 0xB2, 0x54, 0x46,
+    0x9F, 0x5D, 0xC0, 0x35, 0x0B, 0x45, 0xBE, 0xF9, 0xA4, 0xDE, 0xD8, 0x2A, 0x29, 0x58, 0x25, 0x6A,
+    0x0D, 0xBB, 0x2B, 0xFA, 0x11, 0x3E, 0x04, 0xED, 0xD0, 0x4E, 0x54, 0x8B, 0xF3, 0x30, 0xF6, 0x1E,
+    0xAC, 0xFC, 0xD1, 0x24, 0x0F, 0xEF, 0x23, 0x99, 0x14, 0x9C, 0xC0, 0x5A, 0xAE, 0x58, 0xFF, 0x2A,
+    0x8C, 0xAD, 0xC7, 0x28, 0xE4, 0x4B, 0xA0, 0x0E, 0xAA, 0x89, 0xFB, 0xDC, 0x6B, 0xA7, 0x0C, 0x57,
+    0xD4, 0xD2, 0x50, 0xE8, 0x89, 0x80, 0x9B, 0x8A, 0x1C, 0xBE, 0xE7, 0x80, 0x71, 0xDF, 0xA5, 0x6E,
+    0xDE, 0x37, 0x99, 0x0B, 0x0C, 0x46, 0x3C, 0x8B, 0x4B, 0xE3, 0x54, 0xE4, 0x8D, 0x9E, 0xA0, 0x4D,
+    0x47, 0xC5, 0x5E, 0x5C, 0xE7, 0x2F, 0x00, 0x87, 0x1B, 0xA0, 0x8C, 0xCD, 0x0C, 0xD8, 0x9F, 0x2F,
+    0xA7, 0x0A, 0xBE, 0xCC, 0xB1, 0x61, 0x7D, 0xE6, 0x5E, 0xFE, 0x69, 0xC0, 0x28, 0x46, 0x8F, 0x8D,
+    0xD8, 0x08, 0xF2, 0xC8, 0x73, 0x3F, 0x18, 0xD5, 0xFE, 0x63, 0xC0, 0xA8, 0xE2, 0xCA, 0x05, 0xA0,
+    0x55, 0x35, 0x43, 0xAB, 0xD7, 0x56, 0xA8, 0x15, 0x36, 0xA0, 0x8E, 0x0E, 0x30, 0xA9, 0xE9, 0x00,
+    0x3D, 0xE9, 0x01, 0xF7, 0xDA, 0x04, 0x9F, 0x6B, 0xC2, 0x45, 0x0A, 0xDD, 0xCB, 0x21, 0xFF, 0x06,
+    0xA5, 0xEE, 0x08, 0x0A, 0x0D, 0xA3, 0x07, 0x0D, 0xED, 0x0C, 0xA3, 0xB7, 0x0B, 0xB8, 0xD9, 0x44,
+    0xB2, 0xA5, 0xA0, 0x8E, 0x68, 0xC0, 0x24, 0xFA, 0x19, 0x34, 0xB8, 0x05, 0xDC, 0xDC, 0x46, 0xB0,
+    0x6B, 0x3B, 0xD6, 0x18, 0x5D, 0xFB, 0x33, 0x79, 0x46, 0x7D, 0x51, 0x33, 0x8D, 0x9E, 0xD7, 0x4C,
+    0xA9, 0xC1, 0x4D, 0x70, 0x81, 0xE2, 0x9F, 0x50, 0x96, 0xEF, 0x2D, 0xB0, 0x57, 0x5C, 0x01, 0x6A,
+    0x79, 0x28, 0x15, 0x81, 0x47, 0xE5, 0x81, 0x7A, 0x05, 0x6E, 0xE8, 0x6F, 0x20, 0x03, 0x9F, 0x37,
+    0xF4, 0xD2, 0xAE, 0xB0, 0x9B, 0x9F, 0x25, 0xB0, 0xCA, 0x29, 0xB4, 0x08, 0xF2, 0xF2, 0xB8, 0x70,
+    0xCC, 0xE0, 0x69, 0xB0, 0x01, 0xBB, 0x14, 0xA2, 0x14, 0x6E, 0xC6, 0x85, 0x6A, 0xC3, 0x24, 0x34,
+    0x65, 0xE1, 0x99, 0x54, 0xDF, 0x79, 0xCD, 0xBB, 0x9F, 0xDD, 0x55, 0x2C, 0x95, 0x1A, 0x0D, 0x59,
+    0x72, 0xE3, 0x6C, 0x17, 0x0E, 0x7E, 0x49, 0x76, 0x2F, 0xAD, 0x04, 0xF4, 0x8A, 0xC0, 0x9E, 0x8C,
+    0xBC, 0x2F, 0x4B, 0x25, 0x69, 0xA3, 0xD5, 0xBE, 0xC5, 0xE5, 0xB1, 0xEB, 0x85, 0x11, 0xFA, 0xA9,
+    0x88, 0x94, 0xA2, 0x9A, 0xB1, 0x91, 0x26, 0x2B, 0xEE, 0x7D, 0x73, 0x57, 0xDB, 0x0E, 0xDB, 0xCE,
+    0xA0, 0x1D, 0x53, 0x8A, 0xD0, 0xAC, 0x00, 0xE3, 0x74, 0x16, 0xA8, 0xAA, 0x07, 0xDC, 0x4C, 0x4F,
+    0xA1, 0xCE, 0xAC, 0xD4, 0x1B, 0xD7, 0xA6, 0x8C, 0x51, 0xB7, 0x07, 0xD3, 0xAA, 0x09, 0x1E, 0xBC,
+    0x71, 0x03, 0x23, 0xF9, 0x42, 0x9A, 0xB9, 0x74, 0xF5, 0x4C, 0xC8, 0x58, 0xBC, 0x44, 0x06, 0x17,
+    0xB5, 0xD2, 0xFE, 0x48, 0x34, 0x93, 0xF3, 0x76, 0x6E, 0xE6, 0x3A, 0xD8, 0x60, 0xD6, 0x7A, 0x29,
+    0xB6, 0x66, 0x61, 0x1C, 0x17, 0x9C, 0x66, 0xAC, 0x3A, 0xCC, 0xC6, 0x07, 0x50, 0xD7, 0x78, 0xF7,
+    0x56, 0x3F, 0x57, 0x52, 0x40, 0x9A, 0x73, 0xBC, 0x77, 0xC6, 0x26, 0x50, 0x0F, 0x06, 0x70, 0x3C,
+    0x03, 0xE8, 0xE6, 0x0C, 0xA5, 0xD2, 0xA9, 0xE7, 0x76, 0x1E, 0xC4, 0xC1, 0x49, 0x9A, 0x4A, 0x49,
+    0x19, 0x7F, 0x8E, 0xA0, 0xE1, 0xD3, 0x81, 0x6A, 0xA3, 0xF1, 0xB4, 0x81, 0xE7, 0x40, 0xBE, 0x08,
+    0xFB, 0xA8, 0xB3, 0x18, 0xFA, 0x29, 0x87, 0x29, 0x79, 0xA2, 0x17, 0x70, 0x92, 0xDF, 0xE5, 0x57,
+    0xE7, 0x28, 0x31, 0xEC, 0x71, 0xD0, 0xD7, 0x30, 0x89, 0x2A, 0xD0, 0x2C, 0xB8, 0x81, 0x71, 0x3A,
+    0xC9, 0x0E, 0x4D, 0x28, 0x25, 0xC9, 0x5B, 0xE5, 0xCD, 0x46, 0x81, 0x99, 0x0B, 0x5F, 0x6C, 0x65,
+    0xC0, 0x69, 0xA1, 0xD2, 0xB2, 0x3B, 0x6E, 0x67, 0xF4, 0x5F, 0xA1, 0x48, 0x29, 0x0D, 0x65, 0xBA,
+    0x16, 0x8A, 0xCD, 0x44, 0x52, 0x91, 0x18, 0x11, 0x6E, 0x18, 0xBB, 0xE6, 0x5B, 0xEA, 0xEA, 0x7B,
+    0xEA, 0x8C, 0x12, 0x68, 0x01, 0x37, 0x71, 0xDD, 0x2E, 0x45, 0x34, 0xFA, 0x54, 0xA2, 0x97, 0xB2,
+    0xEE, 0x1B, 0xD7, 0xFB, 0x60, 0x0B, 0xEB, 0x8F, 0xC1, 0x65, 0xBE, 0xF3, 0x36, 0x1C, 0x91, 0xD1,
+    0xFB, 0x8F, 0xF7, 0x83, 0xA8, 0xFE, 0x6E, 0x4B, 0xDA, 0xC8, 0x97, 0xD2, 0xD0, 0xFE, 0x48, 0xC5,
+    0x66, 0xA2, 0x9D, 0x9B, 0x79, 0x44, 0x66, 0xAD, 0x97, 0xE6, 0x5B, 0xEA, 0xC6, 0x71, 0x31, 0x4A,
+    0x58, 0x75, 0xB8, 0x89, 0xEB, 0xEA, 0x9A, 0xDB, 0xFA, 0x54, 0x7A, 0x87, 0x25, 0xB5, 0x92, 0x16,
+    0x46, 0x49, 0xD3, 0x21, 0xEB, 0x32, 0xFF, 0x7A, 0xA4, 0x50, 0x57, 0x05, 0xEA, 0x48, 0x33, 0xE0,
+    0x02, 0xCF, 0xEC, 0x66, 0x35, 0x43, 0xB9, 0xCD, 0x0E, 0x26, 0x6A, 0xC0, 0x48, 0x39, 0x6B, 0x13,
+    0x76, 0xAF, 0x34, 0x9B, 0x91, 0x1C, 0x40, 0xB8, 0xC0, 0xC7, 0x41, 0x43, 0x11, 0xA9, 0x36, 0xEC,
+    0x4C, 0xBB, 0x14, 0xE3, 0x2E, 0xD0, 0xF1, 0x60, 0x2F, 0xD5, 0x01, 0xE5, 0x72, 0x04, 0x54, 0xF2,
+    0x7F, 0xE6, 0xC9, 0x72, 0x3F, 0xE6, 0xE0, 0x39, 0x67, 0xF7, 0xFA, 0x1F, 0x3B, 0xE8, 0x99, 0xE2,
+    0x59, 0x28, 0x67, 0x68, 0xB2, 0x2B, 0x6F, 0xEE, 0x5E, 0xA1, 0x56, 0x47, 0xBD, 0x00, 0xE5, 0x50,
+    0xCC, 0xE0, 0x3A, 0xE7, 0xA1, 0x37, 0x11, 0x50, 0x3F, 0x00, 0x5A, 0x8F, 0x3A, 0xA3, 0x58, 0xDF,
+    0x7F, 0x0B, 0xE5, 0x7F, 0xDC, 0xBD, 0xE8, 0x95, 0x13, 0x32, 0xF5, 0xDD, 0xD1, 0x17, 0x9B, 0x89,
+    0xB8, 0xA1, 0x1F, 0xEA, 0x60, 0x03, 0xA9, 0xDC, 0x68, 0xBE, 0xA5, 0xAE, 0x4C, 0x9A, 0x70, 0x9A,
+    0x31, 0x9A, 0xF2, 0x0E, 0x33, 0x1B, 0x3D, 0xEE, 0xAD, 0x7E, 0x7E, 0x57, 0xF7, 0x82, 0x7A, 0x60,
+    0xF7, 0x45, 0xB2, 0xB8, 0xDC, 0x9D, 0x09, 0x9A, 0x30, 0x42, 0x15, 0x4D, 0x80, 0x8F, 0x9E, 0x09,
+    0x7B, 0xAE, 0xE6, 0xA8, 0xE7, 0x75, 0xCA, 0xC3, 0xB2, 0x8B, 0x8C, 0x1B, 0xBD, 0x6F, 0x36, 0xCA,
+    0x68, 0x04, 0x6E, 0xD0, 0x84, 0x09, 0x4D, 0x3C, 0xC6, 0x3D, 0x2E, 0x1C, 0x97, 0xDF, 0x38, 0x67,
+    0x7F, 0xCC, 0x2A, 0x69, 0x46, 0xFA, 0x5E, 0xA2, 0xD6, 0xAA, 0x80, 0x51, 0x2D, 0x70, 0x73, 0xBF,
+    0x62, 0x36, 0xA3, 0x99, 0xDE, 0x37, 0xFA, 0xE1, 0xD3, 0x79, 0xB1, 0xF9, 0x42, 0xD2, 0x42, 0x29,
+    0xBD, 0x7E, 0x3E, 0xF6, 0x39, 0xF8, 0x3C, 0xD9, 0xD8, 0xA9, 0x03, 0xC6, 0x11, 0xA8, 0xC2, 0x06,
+    0xF4, 0xC5, 0x0A, 0x66, 0x29, 0xA7, 0xFB, 0x98, 0x5C, 0x7F, 0x94, 0xF7, 0xCE, 0x46, 0x21, 0x29,
+    0xD0, 0xAC, 0xED, 0x8F, 0x3B, 0x34, 0xF4, 0x1E, 0x13, 0x11, 0x34, 0xA1, 0x8A, 0xD0, 0x0F, 0x6E,
+    0x06, 0x15, 0x02, 0x93, 0xAE, 0x2D, 0xE4, 0xEC, 0x3A, 0xA5, 0xAE, 0x1F, 0xC2, 0xD5, 0x0C, 0x1B,
+    0xD9, 0xED, 0x98, 0x89, 0xAD, 0xB2, 0xF7, 0x78, 0x47, 0x0B, 0xCD, 0x52, 0x2A, 0x20, 0x50, 0xCE,
+    0xBA, 0xEC, 0x19, 0x44, 0x77, 0xF7, 0x82, 0x26, 0x7A, 0x69, 0xDB, 0x11, 0x34, 0x4E, 0x52, 0x66,
+    0xDA, 0x91, 0x63, 0xD3, 0x3F, 0x84, 0xC6, 0xB7, 0x50, 0xE8, 0xE6, 0xB4, 0x73, 0xFF, 0xF6, 0x24,
+    0xED, 0x03, 0xBC, 0x0F, 0x27, 0x61, 0xA0, 0x03, 0x3B, 0x54, 0x80, 0xEB, 0x6E, 0x01, 0xD2, 0x04,
+    0x45, 0xCE, 0xC4, 0x9C, 0x89, 0xAA, 0xB3, 0x25, 0xFD, 0x6A, 0x97, 0x73, 0xAE, 0x53, 0x0E, 0x97,
+    0x0B, 0x7D, 0x21, 0xBD, 0x84, 0x5D, 0xAB, 0x08, 0xCE, 0xDB, 0x40, 0x21, 0x7A, 0x4F, 0xB5, 0x9A,
+    0x04, 0x36, 0x34, 0x01, 0xDC, 0x8F, 0xD4, 0x81, 0xCB, 0x6E, 0xFB, 0xDD, 0x23, 0x11, 0x28, 0x27,
+    0x7C, 0x95, 0x37, 0xE3, 0x7A, 0x48, 0xF2, 0x34, 0x49, 0xEA, 0x0A, 0x75, 0xAD, 0xB0, 0x01, 0xBB,
+    0xE1, 0x3C, 0x36, 0xA0, 0x8E, 0xD1, 0x1B, 0x5D, 0x7F, 0x3A, 0x93, 0x07, 0x27, 0x8C, 0xB4, 0x02,
+    0xD7, 0xFE, 0xBF, 0xB3, 0xF7, 0x96, 0xB7, 0xB7, 0x3F, 0x85, 0x63, 0x07, 0xA0, 0x9E, 0xDF, 0x25,
+    0x1F, 0xFA, 0xFE, 0x90, 0x7C, 0xF9, 0xE2, 0x91, 0xCB, 0x59, 0x64, 0xC3, 0x18, 0x21, 0xF3, 0x2C,
+    0xCE, 0xAD, 0x95, 0xF7, 0xB3, 0xE4, 0xDF, 0x2F, 0xD2, 0xCC, 0xBE, 0x46, 0x76, 0x18, 0xB3, 0x7D,
+    0xE4, 0x90, 0x0E, 0x28, 0xE2, 0xD1, 0xD1, 0x38, 0x39, 0x17, 0xB0, 0x97, 0x99, 0x38, 0x70, 0xBF,
+    0xD9, 0x7B, 0x95, 0x9D, 0x4A, 0x74, 0xE0, 0xB0, 0xB9, 0x29, 0xC7, 0xBC, 0xC7, 0xE3, 0x3F, 0x5E,
+    0xC9, 0xB6, 0x67, 0xA1, 0x92, 0xE4, 0xE9, 0xE7, 0xF1, 0xAB, 0x98, 0x54, 0x08, 0x6C, 0x30, 0x11,
+    0x7A, 0xDF, 0x04, 0x8A, 0x84, 0x06, 0x4C, 0xAC, 0x22, 0xD8, 0xBB, 0xE3, 0x44, 0x66, 0x7E, 0x52,
+    0xA7, 0xEE, 0xB0, 0xB3, 0xEA, 0x6C, 0x78, 0xF3, 0x0D, 0xA7, 0x0C, 0x4C, 0x0F, 0x54, 0x1A, 0x35,
+    0xD1, 0x4F, 0xB5, 0xBC, 0x89, 0x18, 0x75, 0x36, 0x60, 0x22, 0x6E, 0xA2, 0x0D, 0xE8, 0xF5, 0xFF,
+    0x45, 0x5D, 0x1E, 0x3F, 0x99, 0xF2, 0xF0, 0xC8, 0xDB, 0xDD, 0x19, 0x23, 0x70, 0x30, 0x03, 0xBB,
+    0x21, 0xD8, 0x4D, 0xC1, 0x6E, 0x0C, 0x0E, 0xE6, 0xE0, 0xBC, 0x41, 0x38, 0x1E, 0x52, 0x68, 0xB5,
+    0xD1, 0x2A, 0xED, 0x7E, 0xF4, 0xD0, 0xEA, 0x75, 0x90, 0xA7, 0x5D, 0xA0, 0x59, 0x31, 0xCA, 0x2E,
+    0x86, 0x0B, 0xE0, 0x02, 0x55, 0xCA, 0x4E, 0xFA, 0x38, 0x41, 0x3F, 0x53, 0xC7, 0x3C, 0xAD, 0xF2,
+    0x30, 0x66, 0x73, 0x6C, 0x73, 0x94, 0x85, 0xF2, 0x0D, 0xBF, 0xF3, 0x12, 0x66, 0xBF, 0x44, 0x9F,
+    0x33, 0x6D, 0xF5, 0x76, 0xE6, 0x12, 0x53, 0x4E, 0xC2, 0xEA, 0x7A, 0xAD, 0xF5, 0x70, 0x53, 0x46,
+    0x9A, 0x72, 0x20, 0xF2, 0xFF, 0x1C, 0x36, 0xCC, 0x18, 0xA1, 0xBE, 0xB7, 0xC2, 0x58, 0x05, 0x6C,
+    0xA8, 0x3D, 0x1F, 0x3C, 0x0E, 0xEE, 0x42, 0xB7, 0x87, 0x54, 0xA3, 0xBA, 0x3D, 0xAC, 0x6A, 0xC3,
+    0xAE, 0x1A, 0xCC, 0x76, 0x40, 0xBE, 0x46, 0xFF, 0x51, 0xCC, 0x66, 0x85, 0x7D, 0x53, 0x11, 0xF7,
+    0x3D, 0x2D, 0x45, 0xDA, 0xDC, 0x54, 0xCB, 0x0B, 0x17, 0xAB, 0x88, 0xA6, 0x76, 0xAE, 0x84, 0xBA,
+    0x76, 0x31, 0x11, 0xF9, 0x26, 0x98, 0xC4, 0x38, 0x34, 0x8B, 0xD9, 0xE8, 0xBD, 0x0D, 0xFF, 0xA7,
+    0xE8, 0xEF, 0x7C, 0x73, 0x2D, 0x95, 0xDC, 0x54, 0xE9, 0xAF, 0x95, 0x2D, 0xCA, 0x85, 0x6C, 0xA4,
+    0xCA, 0xEC, 0xA3, 0xCC, 0x4E, 0x91, 0x46, 0x6B, 0xA9, 0xD4, 0x61, 0x23, 0xA5, 0x3A, 0x0A, 0x0D,
+    0xB8, 0x90, 0x63, 0x51, 0xAD, 0x48, 0x92, 0xE4, 0x2F, 0xF4, 0x6F, 0x5D, 0xFD, 0x74, 0x7A, 0x8A,
+    0x2A, 0xE5, 0x8C, 0x7D, 0x0E, 0x41, 0xF3, 0x59, 0x3E, 0xCB, 0x72, 0xDD, 0x45, 0x7B, 0xBC, 0x04,
+    0xED, 0x82, 0x51, 0x96, 0xE5, 0x8E, 0x69, 0x55, 0xDB, 0xB9, 0xD9, 0xB1, 0x31, 0xFB, 0x37, 0xF2,
+    0x54, 0xBA, 0xCB, 0xA8, 0xE1, 0x70, 0x53, 0x4E, 0x5B, 0x26, 0xA7, 0x9F, 0x97, 0xD6, 0xCD, 0x83,
+    0xB4, 0x1E, 0xD5, 0x8F, 0x29, 0xA5, 0xC8, 0xC9, 0xCD, 0xB7, 0xAF, 0xE7, 0x5B, 0x32, 0x5B, 0xB5,
+    0x61, 0x83, 0x22, 0xFD, 0x37, 0xB5, 0x14, 0x29, 0x8D, 0x53, 0xAD, 0x49, 0xB8, 0xAD, 0x8A, 0x68,
+    0xFE, 0x87, 0x4A, 0x2B, 0x63, 0xCB, 0xF3, 0xEF, 0x60, 0xF4, 0x25, 0x8F, 0x14, 0xB1, 0xDF, 0x50,
+    0xC7, 0x1F, 0x66, 0xB8, 0xF9, 0xFC, 0x4A, 0xA5, 0x95, 0x76, 0x9C, 0x47, 0x3E, 0x3B, 0x77, 0xA5,
+    0xBA, 0xAC, 0x5D, 0x8C, 0x76, 0x35, 0x53, 0xA5, 0x3D, 0x98, 0xB4, 0x71, 0xF7, 0x31, 0xEC, 0xBA,
+    0x3B, 0x93, 0xED, 0xF2, 0x6E, 0xE7, 0x5D, 0xD3, 0x75, 0x5A, 0x29, 0xA7, 0xE4, 0x8B, 0xAF, 0x95,
+    0x85, 0x6E, 0xCF, 0xD2, 0xFA, 0x9C, 0x8B, 0xD6, 0xC4, 0x33, 0x11, 0xC0, 0x67, 0xA9, 0xE5, 0x6B,
+    0x85, 0xF2, 0xE6, 0x4A, 0xB9, 0x65, 0xDE, 0xAE, 0xA7, 0x9D, 0xB1, 0x0B, 0x26, 0x52, 0x08, 0x34,
+    0xE0, 0x26, 0x9A, 0x70, 0xBD, 0x4A, 0x6B, 0xA9, 0x8D, 0x31, 0x61, 0xEF, 0xE6, 0x94, 0x43, 0x71,
+    0xF5, 0x6A, 0x47, 0xAF, 0x48, 0x2D, 0x0D, 0xFC, 0xC7, 0x1B, 0x2F, 0xFD, 0xB3, 0x0C, 0xEF, 0xE4,
+    0xC6, 0x0D, 0x23, 0x4D, 0x52, 0xB8, 0x74, 0xF5, 0x80, 0xAF, 0x9E, 0x0C, 0x8C, 0x91, 0x51, 0x3C,
+    0xAA, 0x81, 0x76, 0xC2, 0x06, 0xAA, 0x48, 0x99, 0x40, 0x1D, 0xCE, 0xD3, 0x04, 0xEC, 0x8A, 0xD9,
+    0x28, 0xF4, 0x01, 0xFA, 0x3B, 0x43, 0xAB, 0xA9, 0xD6, 0x8C, 0xAE, 0xEF, 0xF3, 0xD7, 0xED, 0x2E,
+    0x50, 0xCF, 0x2D, 0x9A, 0xB7, 0x37, 0x8C, 0xB6, 0xDD, 0xFB, 0xB9, 0x78, 0x0E, 0x2E, 0xF0, 0xA5,
+    0x14, 0x32, 0x12, 0xAE, 0xBC, 0xC4, 0x69, 0x97, 0x3C, 0x0E, 0x23, 0x7E, 0xD1, 0x9B, 0xC3, 0x3B,
+    0xDF, 0x2C, 0x34, 0xC0, 0x38, 0x51, 0x8C, 0xA9, 0x2B, 0x73, 0xA4, 0xBE, 0x52, 0x74, 0x98, 0x50,
+    0x4C, 0xA9, 0x0C, 0x4E, 0xAB, 0xD1, 0x7A, 0x26, 0x9D, 0xF3, 0x8F, 0x9B, 0x38, 0x2B, 0x51, 0xEF,
+    0xBA, 0xF1, 0xDC, 0xCF, 0xE3, 0xC2, 0x3B, 0xEF, 0xE9, 0xF4, 0xCD, 0xF4, 0x2E, 0x6F, 0x56, 0x29,
+    0x4F, 0xE9, 0x89, 0xEE, 0x52, 0x67, 0xD5, 0x36, 0xE7, 0x70, 0xA1, 0xF6, 0xD9, 0x2B, 0x36, 0x0B,
+    0xA0, 0xAF, 0xE4, 0x3C, 0x71, 0x91, 0xD5, 0x7A, 0xB1, 0xE1, 0x42, 0x2D, 0xC6, 0xA9, 0xDA, 0x83,
+    0xA1, 0xCF, 0x96, 0x0A, 0xA3, 0x1E, 0x1C, 0xE7, 0x72, 0xC3, 0xF9, 0x2A, 0x32, 0x0E, 0x76, 0x41,
+    0x39, 0xE9, 0xEB, 0xA6, 0x2A, 0x7E, 0xB8, 0xBF, 0xF3, 0x25, 0x2D, 0xE3, 0x66, 0x84, 0xF5, 0x45,
+    0xE0, 0x71, 0x6A, 0xCF, 0xF8, 0x54, 0xA5, 0xEE, 0x18, 0xF9, 0x17, 0xEB, 0x8E, 0x69, 0xCB, 0x67,
+    0xFD, 0x71, 0xBF, 0xDB, 0xF4, 0x9E, 0x4F, 0x19, 0x9F, 0xAD, 0xF5, 0x97, 0xFA, 0xC9, 0xCD, 0xB5,
+    0xDC, 0x10, 0xBD, 0x6F, 0x67, 0xBB, 0x98, 0x58, 0x08, 0x0D, 0x6E, 0x6A, 0xC2, 0x9F, 0xA6, 0xB7,
+    0xB5, 0x8D, 0xC9, 0xDE, 0xE5, 0x0A, 0xD8, 0x5C, 0x58, 0x50, 0x4A, 0xA1, 0x3F, 0xAF, 0x54, 0x0F,
+    0x97, 0xBF, 0x4F, 0x23, 0xF6, 0xF3, 0xD1, 0xBA, 0x18, 0x1D, 0xEF, 0x74, 0xD7, 0x88, 0xC5, 0xBE,
+    0xC7, 0x9A, 0x7C, 0x8B, 0xA5, 0xBA, 0xBC, 0x04, 0xC2, 0x39, 0x7B, 0xF5, 0xB7, 0x5E, 0x02, 0x79,
+    0x4E, 0x74, 0x97, 0x66, 0xA1, 0x94, 0x42, 0xA9, 0x5C, 0xAA, 0x92, 0x03, 0xC9, 0x1D, 0xE9, 0x3A,
+    0xD9, 0xF9, 0x9A, 0xA9, 0x5F, 0x72, 0xB4, 0x91, 0x76, 0xBE, 0xD7, 0x90, 0x73, 0x68, 0xD3, 0x31,
+    0x25, 0x75, 0x98, 0x93, 0x0D, 0xB3, 0xE0, 0x02, 0xF2, 0xB5, 0x68, 0x22, 0xE3, 0x54, 0x68, 0xA8,
+    0x56, 0xEC, 0xB9, 0xB9, 0xF9, 0x2C, 0xC5, 0x1F, 0x94, 0x0A, 0xB5, 0xFC, 0xA8, 0x42, 0xF1, 0xC1,
+    0x71, 0x7E, 0x58, 0xBE, 0xDC, 0xA8, 0x23, 0xCE, 0xA3, 0xA1, 0x8A, 0xD8, 0x85, 0x71, 0xC8, 0x01,
+    0x4C, 0x13, 0x10, 0xA5, 0x68, 0x02, 0x6E, 0x36, 0x09, 0xB3, 0xE1, 0x26, 0x7A, 0x5F, 0xC5, 0x0F,
+    0xD7, 0x91, 0xFE, 0xCE, 0xA0, 0xA1, 0xD6, 0x62, 0x17, 0xC6, 0x54, 0x08, 0x93, 0xBA, 0x36, 0x70,
+    0x61, 0x77, 0x29, 0x9C, 0x87, 0x8B, 0xF5, 0x0A, 0xF6, 0x89, 0x4C, 0x0F, 0x9B, 0xC1, 0x69, 0x3D,
+    0x04, 0x0B, 0xE5, 0x9E, 0x46, 0x2F, 0xFE, 0xE2, 0x18, 0x66, 0x37, 0x02, 0xAA, 0x7B, 0x11, 0xCA,
+    0x64, 0x67, 0x50, 0xF7, 0x1C, 0x9C, 0x0C, 0xC5, 0x70, 0x9F, 0xB6, 0x5B, 0x0E, 0x8C, 0xDE, 0x2C,
+    0x0D, 0x1D, 0x7D, 0xF8, 0x1C, 0x96, 0xB7, 0xCB, 0x11, 0x0D, 0x74, 0xE1, 0xF8, 0x9F, 0xFD, 0x7C,
+    0x8C, 0xD8, 0xEF, 0xFF, 0x42, 0xB3, 0x1C, 0xB1, 0x90, 0xBF, 0xED, 0x0B, 0xEB, 0x7E, 0x56, 0x39,
+    0xB8, 0x00, 0xFD, 0xD3, 0x1B, 0x99, 0x17, 0x93, 0xF9, 0x1A, 0x95, 0x02, 0x70, 0x72, 0x8E, 0x7A,
+    0x52, 0x9C, 0x06, 0x16, 0x0A, 0x40, 0x4A, 0xC0, 0x68, 0x3D, 0x8C, 0xE5, 0x02, 0xEE, 0x50, 0x21,
+    0x75, 0x70, 0x3F, 0xAE, 0x1F, 0x00, 0x7E, 0xA7, 0x0E, 0x1E, 0xD4, 0x74, 0x70, 0x39, 0xAA, 0x78,
+    0x2C, 0xE6, 0xD2, 0x70, 0xF0, 0x31, 0x9B, 0x70, 0xF0, 0x69, 0xF6, 0x50, 0xFE, 0x17, 0x7F, 0x72,
+    0x64, 0xF3, 0xB9, 0x19, 0xBA, 0x26, 0xC0, 0xDA, 0xAC, 0x3B, 0x46, 0xDB, 0x28, 0x82, 0xD1, 0x0A,
+    0x3C, 0x7C, 0x3D, 0x2F, 0x2E, 0xD9, 0x9C, 0x0A, 0xEB, 0x35, 0x15, 0xD2, 0xD0, 0x6F, 0xE0, 0xE6,
+    0x42, 0x03, 0x85, 0xBA, 0x76, 0x81, 0x3A, 0xEE, 0xC6, 0x25, 0x7B, 0x47, 0xAF, 0x09, 0xA8, 0x92,
+    0x0B, 0x40, 0xF3, 0xF3, 0xEC, 0xA9, 0xEF, 0x4C, 0xDE, 0xEC, 0x62, 0xEF, 0xBC, 0xBC, 0x3B, 0x1B,
+    0x50, 0xEA, 0xE9, 0x08, 0xD8, 0xD8, 0x46, 0xC0, 0x05, 0xB7, 0x02, 0x1A, 0xFA, 0x05, 0xAA, 0x0D,
+    0x2D, 0xD0, 0x06, 0xB4, 0x50, 0x69, 0x2D, 0x0E, 0x09, 0xB9, 0x68, 0xA4, 0x29, 0xF3, 0x13, 0x77,
+    0xCB, 0x90, 0xC5, 0xBC, 0x2B, 0xA4, 0x3E, 0x7F, 0x90, 0x35, 0xDE, 0xCE, 0xEE, 0x76, 0xC3, 0xA9,
+    0x5F, 0xBE, 0x27, 0x45, 0x2F, 0x74, 0xD9, 0xFB, 0x1B, 0xD5, 0xD1, 0xEA, 0x6C, 0xEA, 0x33, 0xEE,
+    0xEA, 0x6C, 0x1C, 0x3E, 0x83, 0xFB, 0xBA, 0xBC, 0xFD, 0x89, 0x56, 0xF3, 0xF3, 0xB7, 0x55, 0xA4,
+    0xD9, 0x0D, 0xE3, 0x6C, 0x67, 0x17, 0xEA, 0x60, 0x97, 0x6A, 0xA9, 0x62, 0xBD, 0x94, 0x1A, 0x03,
+    0xD2, 0x80, 0xBB, 0x33, 0xD3, 0xFC, 0x74, 0xA3, 0x8A, 0xFD, 0x54, 0xA6, 0x3A, 0xA1, 0x4E, 0xC9,
+    0x4D, 0x56, 0x4F, 0x07, 0x34, 0x40, 0x91, 0xC3, 0x32, 0x3B, 0xED, 0xF7, 0xB1, 0xED, 0xA8, 0x59,
+    0xDB, 0xE5, 0xBF, 0x0B, 0x00, 0x9F, 0xE1, 0xC1, 0x52, 0x73, 0x1D, 0x95, 0x8C, 0xFE, 0xCB, 0x38,
+    0x69, 0x2D, 0x37, 0x77, 0xA7, 0x73, 0x7F, 0x19, 0x30, 0xDB, 0x0A, 0xFD, 0xAB, 0x50, 0x67, 0xCC,
+    0x1B, 0xEC, 0xBD, 0x85, 0x42, 0x6E, 0xA0, 0xF9, 0xC9, 0x46, 0x99, 0x6C, 0xF8, 0x1D, 0x37, 0xE9,
+    0xCE, 0xED, 0x58, 0x69, 0xE9, 0xBD, 0x4B, 0xF5, 0x9A, 0x01, 0xD3, 0xEE, 0x5C, 0xC9, 0x00, 0x6D,
+    0xB7, 0xAF, 0xF3, 0x5A, 0xDD, 0xBE, 0xBC, 0xC6, 0xEB, 0xC0, 0x67, 0xCE, 0xAD, 0x3D, 0x2B, 0xED,
+    0x5A, 0x26, 0x33, 0x6F, 0xE5, 0xF7, 0x6F, 0x95, 0xEA, 0xF6, 0x1D, 0x61, 0x74, 0x08, 0xC4, 0xAA,
+    0xED, 0xB0, 0x35, 0x6C, 0x3C, 0xBC, 0x34, 0xEB, 0x61, 0xEB, 0xB9, 0xC0, 0x07, 0x71, 0x01, 0x87,
+    0x0B, 0xF4, 0xF4, 0x33, 0x89, 0x71, 0x3A, 0xD9, 0x2A, 0x49, 0xB1, 0x95, 0xB4, 0x1E, 0x08, 0xD4,
+    0xF0, 0x31, 0xCA, 0x44, 0x9B, 0x4A, 0x45, 0xA3, 0xEB, 0xB9, 0x04, 0x91, 0x4B, 0xD4, 0xF2, 0xAD,
+    0x7C, 0x2B, 0xCF, 0x38, 0x64, 0x56, 0x52, 0x4E, 0x4B, 0x64, 0x0D, 0x54, 0x45, 0xEA, 0x48, 0xBD,
+    0x62, 0x17, 0x6C, 0xA0, 0x09, 0xB4, 0x01, 0x37, 0x67, 0xCD, 0xC4, 0x78, 0x9B, 0xF1, 0x4E, 0x27,
+    0xA1, 0x8D, 0x7E, 0x3E, 0x78, 0xD5, 0xFF, 0x1C, 0x63, 0xDB, 0xA3, 0xF2, 0xBC, 0xF9, 0xBA, 0xCC,
+    0x37, 0xDA, 0x23, 0xCD, 0xED, 0xB0, 0x50, 0x4F, 0xBA, 0x9C, 0xCA, 0x19, 0x63, 0xA9, 0x58, 0x2A,
+    0x0F, 0x6B, 0xDD, 0x55, 0xEF, 0xB9, 0x61, 0x65, 0x59, 0x74, 0x88, 0x77, 0xC8, 0xE2, 0xB7, 0xEB,
+    0xB4, 0x58, 0x05, 0xAB, 0xA9, 0x4A, 0x3B, 0x37, 0xB1, 0x9E, 0xB1, 0x81, 0x3A, 0x60, 0x27, 0x9A,
+    0x81, 0xE7, 0x8E, 0xD3, 0x7D, 0xE1, 0x94, 0x96, 0x61, 0x3D, 0xD2, 0x9B, 0x91, 0x56, 0xA9, 0xED,
+    0x0A, 0xE9, 0x85, 0x00, 0xF2, 0x8F, 0x43, 0xB3, 0x1A, 0xFF, 0x0B, 0xF4, 0x61, 0x36, 0x4E, 0xE3,
+    0x74, 0x8A, 0x9A, 0xF8, 0x83, 0x7C, 0x8E, 0x5F, 0xF8, 0x20, 0x46, 0x98, 0x90, 0x25, 0x54, 0x25,
+    0xEC, 0x9C, 0xC1, 0xD0, 0x5E, 0x92, 0x6F, 0x33, 0x99, 0x5E, 0x12, 0x5C, 0xE2, 0x4A, 0xAB, 0xFA,
+    0xFB, 0x8A, 0xEE, 0x4B, 0x0A, 0x1B, 0xE3, 0x17, 0x83, 0x49, 0x6D, 0x67, 0x97, 0x5B, 0xF4, 0xB7,
+    0xA7, 0x52, 0x45, 0xCE, 0x2C, 0x4F, 0xEC, 0x39, 0x3D, 0xDA, 0x19, 0x94, 0xAB, 0x6B, 0xCE, 0xA6,
+    0x9F, 0x17, 0xE8, 0x3D, 0xA5, 0x7E, 0x95, 0x3A, 0x2D, 0x38, 0x79, 0xB4, 0x9B, 0xE9, 0x2B, 0xC7,
+    0x95, 0x5D, 0x4B, 0xC3, 0xEE, 0x1F, 0x9F, 0xCD, 0x18, 0x4F, 0x87, 0x21, 0xDA, 0xC8, 0x33, 0x54,
+    0x89, 0x7E, 0x28, 0xD4, 0xB9, 0xC0, 0x38, 0xD9, 0x15, 0x17, 0xCC, 0x8A, 0x8D, 0x5C, 0xCC, 0x2B,
+    0xA3, 0x3C, 0x70, 0x3A, 0x3E, 0x93, 0x57, 0x80, 0x8D, 0x34, 0xBE, 0x4A, 0xD8, 0xB9, 0x54, 0xF7,
+    0xC8, 0x52, 0x49, 0x8A, 0xB5, 0xA4, 0x74, 0x1C, 0x1E, 0x63, 0xA4, 0x95, 0x2F, 0x15, 0x61, 0x1C,
+    0xB0, 0x2B, 0xA8, 0xCB, 0x24, 0x61, 0x70, 0x33, 0x66, 0x83, 0xDE, 0x7F, 0xB6, 0x8E, 0x4D, 0x18,
+    0x5F, 0x90, 0x5D, 0xDC, 0x24, 0xB3, 0x36, 0xE1, 0x81, 0x73, 0x1F, 0x53, 0xC7, 0xDF, 0x66, 0xBC,
+    0xD3, 0x59, 0x05, 0xB4, 0x51, 0xA5, 0x7D, 0x12, 0xFF, 0x5E, 0xAB, 0xFA, 0x57, 0xA0, 0xD2, 0xAB,
+    0x50, 0x69, 0xDB, 0x09, 0x71, 0xCD, 0x06, 0x45, 0x0E, 0xB6, 0x57, 0xB0, 0x37, 0x17, 0x78, 0xE0,
+    0xEF, 0xBB, 0xAA, 0x8B, 0x2B, 0xB4, 0xA2, 0x95, 0xAF, 0x15, 0xA8, 0x57, 0x72, 0x8D, 0x1F, 0xBD,
+    0xA7, 0x0D, 0xD8, 0xB5, 0x33, 0x69, 0x29, 0xB4, 0x31, 0xAE, 0xB8, 0xC0, 0xB8, 0x14, 0x8A, 0x5C,
+    0x16, 0x8C, 0x1E, 0x37, 0x63, 0x17, 0xAA, 0x48, 0xA9, 0x5F, 0x65, 0xBC, 0xD3, 0x39, 0x79, 0xAB,
+    0xA9, 0xD0, 0x70, 0x1F, 0x01, 0x3E, 0x57, 0x1E, 0xC2, 0x2B, 0x7B, 0xED, 0xE3, 0x70, 0x86, 0xDB,
+    0x64, 0xF2, 0xBF, 0x0E, 0x55, 0x3E, 0x9F, 0x79, 0xB7, 0xC4, 0x62, 0xC0, 0x29, 0x94, 0xDA, 0x68,
+    0x14, 0x71, 0xF2, 0xA5, 0xD6, 0x5C, 0x21, 0x10, 0xA0, 0x4F, 0x98, 0x15, 0x5A, 0xF9, 0x62, 0xCB,
+    0xC3, 0x1F, 0x3B, 0x8C, 0x84, 0xF3, 0x90, 0x34, 0xD9, 0x00, 0xFD, 0xD3, 0xD1, 0xAC, 0xD0, 0xDE,
+    0xD6, 0x27, 0xB6, 0x4C, 0xA2, 0x1C, 0xC1, 0x44, 0x1B, 0x9D, 0xA7, 0x48, 0xA5, 0xBE, 0x1C, 0x60,
+    0xEC, 0xDC, 0xCF, 0x57, 0x68, 0x7D, 0xAD, 0x0D, 0x6C, 0x40, 0x02, 0xB3, 0xD2, 0xCA, 0x53, 0x6C,
+    0xB9, 0x02, 0x6D, 0xEC, 0xD0, 0x0A, 0xE3, 0x4A, 0xB3, 0x51, 0x48, 0x83, 0x51, 0x86, 0x4A, 0x77,
+    0x5B, 0x75, 0xE1, 0xBE, 0x21, 0x9B, 0xB0, 0x43, 0x6D, 0x85, 0x0E, 0x98, 0xD4, 0xD8, 0xED, 0x2E,
+    0x7D, 0x75, 0x76, 0x88, 0x1F, 0xE4, 0xE1, 0xAE, 0x4D, 0x95, 0x3E, 0xA9, 0x75, 0xD4, 0x83, 0xE3,
+    0x1B, 0x8A, 0x8C, 0xAF, 0xB6, 0xC1, 0x68, 0xEE, 0xBD, 0x55, 0x99, 0xE8, 0x83, 0x5D, 0x4A, 0x0D,
+    0xCE, 0xDB, 0x58, 0x08, 0x37, 0xD7, 0x6B, 0xA1, 0xCE, 0x4D, 0x55, 0x2C, 0x44, 0x1B, 0xAA, 0xF8,
+    0xDB, 0x1A, 0xDA, 0x7B, 0xDF, 0xDE, 0x90, 0x9A, 0x50, 0x6A, 0x19, 0x87, 0xCC, 0x50, 0xC9, 0x3C,
+    0x06, 0x23, 0xD1, 0x6A, 0x2A, 0x24, 0x6F, 0x14, 0x69, 0x35, 0x60, 0xD5, 0x1D, 0xEA, 0xEA, 0xDC,
+    0x40, 0xA9, 0x48, 0x33, 0x81, 0x34, 0xD4, 0x0B, 0x38, 0x05, 0x13, 0xC1, 0xDE, 0xD9, 0x10, 0x54,
+    0x6F, 0xC9, 0xBB, 0x81, 0x32, 0xBA, 0xA5, 0x99, 0x40, 0x95, 0xEA, 0x00, 0xCE, 0xEB, 0x76, 0x84,
+    0x66, 0x6E, 0x57, 0x41, 0xBD, 0x18, 0xF5, 0x03, 0x65, 0xCC, 0x5E, 0x93, 0x32, 0x9F, 0xD5, 0x0D,
+    0xE5, 0x5E, 0x33, 0xD6, 0x27, 0xA8, 0x17, 0xAC, 0x06, 0x6A, 0x0D, 0x85, 0x26, 0x1A, 0xAD, 0xB8,
+    0x80, 0xD5, 0xB6, 0xF3, 0x5B, 0xF7, 0x7D, 0xBD, 0xE7, 0x0B, 0xF7, 0xEA, 0xA6, 0xAC, 0x66, 0xF7,
+    0x0A, 0x3F, 0x0E, 0x4E, 0x6F, 0x15, 0x38, 0x02, 0x7B, 0x3B, 0x75, 0x1D, 0x3E, 0xC3, 0xE7, 0x18,
+    0xD7, 0x66, 0xB3, 0xFA, 0xBE, 0xE2, 0xA3, 0xBA, 0xA9, 0x50, 0xA6, 0x75, 0xF4, 0x56, 0xCF, 0x0B,
+    0x17, 0xEB, 0xB5, 0x90, 0x77, 0x53, 0x9D, 0x50, 0xE6, 0xC8, 0x6A, 0x68, 0xE7, 0x6A, 0x43, 0x5D,
+    0x13, 0xAA, 0xC8, 0xE8, 0x9B, 0x70, 0x3B, 0x31, 0xDE, 0xF9, 0xBD, 0xC5, 0x28, 0xF6, 0xBE, 0xD6,
+    0x7F, 0x4D, 0x59, 0xFF, 0x5D, 0xD8, 0x4D, 0xAF, 0x9D, 0x0E, 0xEE, 0x47, 0x3A, 0x4C, 0x6C, 0xD3,
+    0x41, 0xB1, 0x00, 0x27, 0x1C, 0x6E, 0xE4, 0x6B, 0x59, 0x0D, 0x0B, 0xA0, 0xFD, 0x7A, 0x02, 0x30,
+    0x5B, 0xF6, 0x60, 0x32, 0xC5, 0x63, 0x57, 0xB5, 0x87, 0xAD, 0x70, 0x9F, 0xB1, 0xF6, 0x48, 0xBE,
+    0xD6, 0x42, 0xAF, 0x80, 0x44, 0xBD, 0x67, 0x7F, 0x9C, 0xA7, 0x50, 0xF6, 0xF9, 0x47, 0x51, 0x2D,
+    0xE0, 0x34, 0x97, 0x5B, 0x06, 0x13, 0x05, 0xE6, 0x9E, 0x3A, 0xE7, 0x29, 0xB6, 0x3E, 0xD8, 0x19,
+    0x46, 0xBB, 0x55, 0x0B, 0xB8, 0xAF, 0xEB, 0xB5, 0x08, 0x36, 0xB8, 0x20, 0xA8, 0xD6, 0x3A, 0x39,
+    0x4F, 0xB9, 0xA1, 0xEF, 0xCD, 0x30, 0xE6, 0x8A, 0x68, 0xE7, 0x8D, 0x22, 0xD8, 0x99, 0x51, 0x50,
+    0x2D, 0x34, 0x1A, 0x28, 0x37, 0x8C, 0x66, 0x4A, 0xCD, 0xF4, 0x0B, 0x95, 0x52, 0x8E, 0xAA, 0xD4,
+    0xED, 0xE5, 0x56, 0x39, 0xE1, 0x54, 0x74, 0x65, 0x47, 0x4B, 0x0F, 0xAF, 0x56, 0x01, 0x62, 0x0F,
+    0x26, 0xF7, 0x38, 0xE8, 0x76, 0xC6, 0x82, 0x3D, 0xEB, 0xE2, 0x9F, 0x74, 0x27, 0xD7, 0x6B, 0x3D,
+    0xAF, 0x49, 0xA9, 0xD5, 0x6B, 0x37, 0xDF, 0x96, 0x68, 0xEF, 0x7C, 0x29, 0xA2, 0xB5, 0x09, 0x46,
+    0x7E, 0x1C, 0x9A, 0x68, 0x36, 0xC6, 0xD9, 0x06, 0x23, 0x7A, 0x6F, 0xD7, 0x32, 0xD1, 0x4F, 0x76,
+    0x29, 0x44, 0xEF, 0xEB, 0x58, 0xE8, 0x57, 0xDD, 0x5C, 0xA7, 0x45, 0x9D, 0xD3, 0x37, 0x22, 0xE3,
+    0xD6, 0xCE, 0x59, 0x8F, 0x5C, 0xA1, 0x78, 0x91, 0x23, 0x1B, 0x6B, 0xDF, 0x89, 0x19, 0xB3, 0xCD,
+    0x8B, 0xA8, 0xD8, 0xCE, 0xAC, 0xA4, 0xBE, 0xFB, 0x77, 0x3C, 0xDC, 0xB9, 0x2F, 0x68, 0xEE, 0x97,
+    0xF6, 0x05, 0xAD, 0xA3, 0x0A, 0x5E, 0x4E, 0xA3, 0x3C, 0x8C, 0xAF, 0xB6, 0x01, 0x5C, 0xAA, 0x22,
+    0xD8, 0x54, 0x26, 0xA8, 0x84, 0x3A, 0x4A, 0x0D, 0xCE, 0x83, 0x7C, 0xA6, 0x8B, 0xD9, 0x15, 0x9A,
+    0xC5, 0x6C, 0x50, 0xC7, 0x22, 0x87, 0x96, 0xE3, 0x6D, 0xD0, 0xD0, 0xDE, 0x9B, 0x70, 0x93, 0x55,
+    0xA0, 0x09, 0x46, 0x0B, 0xF5, 0x9A, 0x8D, 0xEB, 0xBF, 0xAC, 0x5D, 0x58, 0x1C, 0xE2, 0xD4, 0x4C,
+    0xF7, 0x1C, 0x87, 0xBD, 0x1E, 0x29, 0xBB, 0xFF, 0xFE, 0x0C, 0xD5, 0x93, 0xAB, 0x87, 0x7D, 0x57,
+    0x6A, 0xEE, 0x17, 0xA5, 0x56, 0xFF, 0x65, 0x7C, 0x43, 0xB1, 0x4C, 0xEB, 0xE8, 0x5D, 0xAA, 0xA2,
+    0x91, 0x1F, 0x87, 0x3E, 0xD8, 0x35, 0x3B, 0xD1, 0xBE, 0x09, 0x76, 0x2D, 0x55, 0xA8, 0x73, 0x73,
+    0x13, 0xCC, 0x56, 0x8A, 0xDE, 0xBB, 0xB9, 0x8E, 0x66, 0x43, 0x43, 0xEF, 0xED, 0x92, 0x2B, 0xCD,
+    0x33, 0xA5, 0x2A, 0xE6, 0xD8, 0xE6, 0x71, 0x1B, 0xA8, 0x95, 0xF2, 0x6F, 0x1B, 0xCD, 0xF0, 0xE0,
+    0x4B, 0x99, 0xCB, 0x73, 0xF5, 0x60, 0x2C, 0x77, 0x22, 0xF7, 0x83, 0xEF, 0x64, 0x70, 0xBF, 0x1F,
+    0xAB, 0xDE, 0x8A, 0x1B, 0x37, 0x06, 0x5C, 0xAE, 0x76, 0xF7, 0x9C, 0x62, 0x6E, 0xEF, 0x59, 0x55,
+    0xC7, 0x39, 0x9A, 0x8A, 0xF5, 0x0D, 0x60, 0x53, 0x02, 0x6A, 0xAD, 0xA7, 0x56, 0xF8, 0x81, 0xF7,
+    0x7B, 0xB1, 0xE0, 0x15, 0x2E, 0xD2, 0xF2, 0x6B, 0x98, 0x58, 0x4D, 0xF9, 0xE6, 0x94, 0x4E, 0xBD,
+    0x86, 0xF7, 0x5E, 0x7E, 0x14, 0x53, 0xE9, 0xA1, 0x8C, 0x66, 0x05, 0xA3, 0x2A, 0x41, 0xA5, 0x27,
+    0x05, 0x75, 0xB2, 0x1B, 0x98, 0xB5, 0x5A, 0x80, 0x17, 0x39, 0x43, 0x8C, 0xBA, 0x74, 0xE5, 0x88,
+    0xED, 0xD4, 0x07, 0x8E, 0xC6, 0x5E, 0xA3, 0x18, 0xB1, 0xCA, 0x8D, 0x01, 0x40, 0x21, 0x4B, 0xB2,
+    0x94, 0xA7, 0x52, 0xA7, 0x09, 0x34, 0xF5, 0x01, 0xDC, 0x92, 0x45, 0x69, 0x13, 0x54, 0x32, 0x1A,
+    0x28, 0xE5, 0x35, 0x83, 0xE6, 0x2C, 0x4B, 0x9B, 0xA0, 0x8D, 0x46, 0x1E, 0xBB, 0x31, 0x2E, 0x64,
+    0x49, 0x5A, 0x51, 0x9E, 0xD6, 0x26, 0xB2, 0xD7, 0x79, 0x1C, 0xA4, 0x79, 0x76, 0x4C, 0xD5, 0xF0,
+    0x17, 0x60, 0xBF, 0x15, 0xC1, 0xDD, 0x8E, 0x30, 0x3E, 0xB9, 0xC0, 0xD6, 0x4C, 0x98, 0xC5, 0x81,
+    0x99, 0xCE, 0xC3, 0x18, 0x0F, 0x77, 0x7B, 0x95, 0x5E, 0x2B, 0x81, 0xEE, 0xA9, 0x2B, 0x55, 0x68,
+    0xA8, 0x22, 0xF2, 0x76, 0xCD, 0x7C, 0xBD, 0xD1, 0xB7, 0x81, 0xD1, 0xBB, 0x80, 0x06, 0x37, 0xA3,
+    0xCE, 0xCD, 0x85, 0x32, 0xC6, 0xE4, 0x42, 0x1D, 0x73, 0xDD, 0x49, 0xB3, 0x33, 0xEF, 0xBA, 0xBD,
+    0xE8, 0xE9, 0xC2, 0x3B, 0xAA, 0xFF, 0x77, 0xEB, 0xB8, 0x17, 0x2D, 0x66, 0xAC, 0x66, 0x39, 0xFA,
+    0x88, 0xC5, 0xF5, 0xB3, 0xF4, 0x48, 0xE0, 0x64, 0x27, 0x54, 0x4B, 0x30, 0xEA, 0x8E, 0x3C, 0x57,
+    0xF5, 0xBC, 0x66, 0x0A, 0x75, 0x7D, 0xA0, 0x14, 0x2E, 0x60, 0xB4, 0x27, 0x9A, 0xDC, 0x4C, 0x95,
+    0x18, 0x27, 0xAA, 0xAD, 0xD0, 0x40, 0x1D, 0x1F, 0x11, 0x3B, 0x25, 0xDB, 0xEE, 0xAB, 0x4E, 0x40,
+    0x1B, 0x32, 0x14, 0x22, 0x0F, 0x2E, 0xF4, 0x33, 0xB8, 0xD9, 0xAD, 0xD0, 0x4F, 0x76, 0x83, 0xD1,
+    0xD7, 0x1A, 0x2A, 0xAD, 0x46, 0x73, 0xAB, 0x84, 0xA2, 0x53, 0xCC, 0x64, 0xF0, 0x53, 0xBE, 0xD3,
+    0x8B, 0x19, 0x28, 0x32, 0x31, 0x1B, 0xC3, 0x26, 0x64, 0xEC, 0xCC, 0x9D, 0xCF, 0x22, 0x7E, 0xA6,
+    0x78, 0xB1, 0x4D, 0x75, 0x54, 0x6A, 0xE3, 0xCB, 0xA9, 0x8F, 0xC5, 0xA6, 0xB5, 0x4C, 0xCB, 0x45,
+    0xA3, 0x09, 0xA3, 0x81, 0x4A, 0xE4, 0x5A, 0xC4, 0x98, 0x31, 0x8D, 0x66, 0xD9, 0x59, 0xCB, 0x07,
+    0xE6, 0xF2, 0x74, 0xB0, 0x78, 0xEF, 0x4F, 0x49, 0x64, 0x69, 0x64, 0x6B, 0x9C, 0x5F, 0xB3, 0xD3,
+    0x96, 0x1D, 0xB9, 0x9C, 0xD1, 0x19, 0x4F, 0xFD, 0xFE, 0x93, 0xEE, 0x61, 0xDA, 0x54, 0x47, 0xAB,
+    0xEF, 0xCB, 0xBF, 0x9C, 0xFA, 0x48, 0xF3, 0x3D, 0x0D, 0x65, 0x5A, 0x2E, 0xE2, 0xB6, 0x9D, 0xFB,
+    0xDB, 0x87, 0x2C, 0x92, 0x33, 0x99, 0x8E, 0x2E, 0x0B, 0xC5, 0x1C, 0x8D, 0xC7, 0x76, 0x0A, 0x1F,
+    0x65, 0xD5, 0x56, 0x87, 0x43, 0xC5, 0x5E, 0xD8, 0x93, 0xBB, 0xD6, 0x83, 0x99, 0x81, 0x0F, 0x1F,
+    0x3C, 0xF0, 0x7A, 0x00, 0x87, 0xF3, 0x07, 0xCF, 0xCD, 0xFE, 0x7C, 0x3D, 0xD6, 0xD4, 0xE7, 0xD4,
+    0xFC, 0x59, 0xA7, 0xED, 0x7D, 0x29, 0xEF, 0x07, 0xF8, 0x0D, 0xEC, 0xD0, 0x0E, 0x26, 0xB4, 0x03,
+    0x63, 0xEB, 0xB1, 0xF2, 0x94, 0xF2, 0x79, 0xA1, 0x9C, 0x25, 0x21, 0x9D, 0x74, 0x0F, 0x33, 0xAE,
+    0x6D, 0x50, 0x6A, 0xE3, 0xA3, 0xFA, 0x33, 0xD1, 0x7C, 0x4F, 0x43, 0x7D, 0x6F, 0xEA, 0x8C, 0xA6,
+    0x5C, 0xC7, 0xD0, 0x87, 0x5C, 0xDF, 0x70, 0x9A, 0xBA, 0xE8, 0x32, 0xDA, 0xE8, 0x0E, 0xF8, 0xDA,
+    0x76, 0x74, 0xBA, 0xF6, 0x54, 0x7A, 0xB7, 0xF7, 0xC0, 0xB2, 0x91, 0xCC, 0x9D, 0x77, 0x87, 0xEF,
+    0x9D, 0x16, 0x38, 0x5F, 0xBA, 0x02, 0x8D, 0xB6, 0x4C, 0xBE, 0x6A, 0xA5, 0xB5, 0xD0, 0xD0, 0x4C,
+    0x75, 0xCC, 0x51, 0x6A, 0x44, 0xBE, 0x9A, 0x8C, 0x86, 0x9D, 0x49, 0x9E, 0x3B, 0x62, 0x28, 0xEC,
+    0x2F, 0x8D, 0xC2, 0x0E, 0x9C, 0x55, 0xF2, 0x8E, 0x4A, 0x45, 0xC4, 0xC6, 0x3A, 0xE0, 0x82, 0x9B,
+    0x0A, 0x0D, 0x9A, 0xDA, 0x68, 0x24, 0x4D, 0xD5, 0x4E, 0x0B, 0xEA, 0xCE, 0xA9, 0x97, 0x6A, 0xF7,
+    0xDC, 0xCB, 0xC3, 0x9D, 0x6B, 0x5F, 0x7E, 0xEE, 0xBE, 0x78, 0xAC, 0xF8, 0x1C, 0x54, 0x5A, 0xB0,
+    0x4A, 0xD4, 0x6F, 0x8F, 0x43, 0x15, 0x4B, 0x5F, 0x8A, 0x2C, 0x14, 0xAB, 0x8E, 0x42, 0x0B, 0x34,
+    0xEA, 0x32, 0x02, 0x6C, 0x13, 0x8F, 0xA1, 0xA1, 0xF5, 0xED, 0x6C, 0xA3, 0x0D, 0x46, 0x5A, 0xE9,
+    0xB5, 0x52, 0x6A, 0x39, 0x2A, 0x84, 0xFF, 0xFB, 0x1D, 0x99, 0x6A, 0xFD, 0xEE, 0x82, 0x5D, 0xAA,
+    0x89, 0x87, 0x4F, 0x33, 0xD5, 0x4F, 0xED, 0xC5, 0x82, 0xA3, 0x34, 0xD4, 0x52, 0xA2, 0x9F, 0xAB,
+    0xA5, 0x14, 0xD6, 0xDB, 0x2C, 0xA1, 0x62, 0x41, 0x73, 0x0E, 0x89, 0x33, 0x6F, 0xB3, 0x56, 0xDC,
+    0x5F, 0x2A, 0xC5, 0x9D, 0xCC, 0x51, 0x28, 0x58, 0x5F, 0xC8, 0xF7, 0x18, 0x95, 0x11, 0x1B, 0xED,
+    0x42, 0x3F, 0xBB, 0xA5, 0x16, 0x92, 0x96, 0x42, 0x52, 0x47, 0xAF, 0xE9, 0x2C, 0x3B, 0xB3, 0xDE,
+    0x93, 0x52, 0xE3, 0x4A, 0xB1, 0x57, 0x54, 0xD8, 0xE9, 0x32, 0x6D, 0xF7, 0xB1, 0x53, 0xB1, 0xFC,
+    0xFB, 0x8E, 0x4A, 0x0B, 0x4E, 0x2B, 0xE3, 0xCB, 0x6B, 0x21, 0xFE, 0xBC, 0xD4, 0x5E, 0x61, 0xAE,
+    0x25, 0x47, 0x38, 0x8D, 0x3A, 0x8C, 0x3C, 0x68, 0xB6, 0xB8, 0xB9, 0xF5, 0xED, 0xEC, 0x82, 0xF3,
+    0x4E, 0x1A, 0x1A, 0xA5, 0x2C, 0x91, 0x0B, 0xFF, 0x7C, 0x43, 0xBD, 0x70, 0xA8, 0xDF, 0xC9, 0xE0,
+    0x57, 0x3C, 0x70, 0x83, 0xC6, 0x03, 0xBC, 0xFE, 0xD1, 0xC3, 0x40, 0x1B, 0x4D, 0x46, 0x1A, 0xDA,
+    0x1F, 0xA7, 0x42, 0xFC, 0x79, 0x1D, 0xA1, 0x89, 0xE0, 0xB6, 0x3C, 0xCC, 0x7E, 0xCB, 0x75, 0x3E,
+    0x6E, 0xB5, 0xB8, 0x79, 0x64, 0x7C, 0x41, 0x26, 0x5A, 0x69, 0x6E, 0x94, 0x32, 0x20, 0x73, 0x65,
+    0x47, 0xA6, 0x7D, 0x06, 0xF8, 0x23, 0x54, 0x33, 0xF4, 0x59, 0x0D, 0x7E, 0x74, 0xB7, 0x10, 0x9F,
+    0xA7, 0x5C, 0xCA, 0x48, 0xB1, 0xD9, 0x00, 0xEA, 0xFD, 0x5E, 0xA8, 0x98, 0x4B, 0x4C, 0x8E, 0x09,
+    0x9E, 0x0B, 0x4F, 0xED, 0x15, 0x98, 0xB5, 0xB4, 0xD2, 0x4A, 0x2B, 0xFD, 0x5C, 0x2D, 0x8C, 0xDE,
+    0x04, 0x94, 0x5F, 0xAA, 0x29, 0x17, 0x1F, 0x29, 0x92, 0x9B, 0x97, 0xE5, 0x0D, 0x53, 0x2B, 0x42,
+    0x91, 0xF5, 0x4A, 0x66, 0xB6, 0x79, 0xEB, 0x0B, 0xF9, 0xC6, 0x23, 0xDF, 0x7A, 0xE4, 0xDD, 0x54,
+    0x68, 0x70, 0x4B, 0x2D, 0xDC, 0x5E, 0xFF, 0xB4, 0xEC, 0x1B, 0x27, 0x97, 0xF5, 0x76, 0x27, 0x70,
+    0xAB, 0x8C, 0xD4, 0xD3, 0x08, 0x7D, 0xB3, 0x13, 0x1B, 0x9B, 0x6D, 0x27, 0x36, 0x9A, 0x73, 0x69,
+    0xA8, 0x7F, 0xDF, 0xE5, 0x1F, 0x77, 0x5A, 0xA9, 0xDF, 0x1E, 0x87, 0x42, 0xFC, 0x39, 0x6D, 0xD8,
+    0xD7, 0x88, 0x3D, 0x20, 0xD5, 0x85, 0x16, 0xF2, 0x2A, 0xB1, 0x09, 0x8B, 0x9B, 0xCB, 0x58, 0x26,
+    0x5C, 0x70, 0xDE, 0x48, 0x2B, 0x8D, 0x12, 0xB4, 0x87, 0xBD, 0xDB, 0x4A, 0xD2, 0x6D, 0x49, 0x8A,
+    0x4E, 0x92, 0xBE, 0x71, 0xF7, 0xE9, 0xED, 0x53, 0xEB, 0x88, 0xBC, 0x7B, 0x72, 0x6E, 0x56, 0x13,
+    0x5E, 0x29, 0xD5, 0x3D, 0x57, 0x0E, 0x2E, 0x9C, 0x0C, 0x87, 0xFC, 0xD0, 0x7C, 0xCA, 0x2D, 0xFA,
+    0xC5, 0x98, 0xE6, 0xFD, 0x09, 0xA5, 0x2A, 0x01, 0x27, 0xBA, 0x7B, 0xDA, 0x87, 0xE0, 0xD8, 0xAD,
+    0x2B, 0xD7, 0x90, 0x9C, 0x41, 0x4D, 0xCD, 0x29, 0x6F, 0xB9, 0xF5, 0x87, 0xB5, 0xC3, 0x4B, 0x7B,
+    0xCF, 0x33, 0x68, 0x3D, 0x85, 0xF6, 0x1A, 0x9A, 0x99, 0x47, 0xA4, 0xD7, 0xA4, 0x64, 0xA5, 0x80,
+    0x86, 0x73, 0x85, 0x36, 0x87, 0x93, 0x0E, 0x70, 0x68, 0xD1, 0xB9, 0xD0, 0xA2, 0x37, 0xA2, 0x91,
+    0xA6, 0x5A, 0x5B, 0xD6, 0x36, 0x1D, 0x3C, 0x94, 0x15, 0x6E, 0xBD, 0x2F, 0xA4, 0xB6, 0xA3, 0x5C,
+    0xA1, 0x1F, 0xF6, 0xE8, 0xB7, 0x1C, 0x8A, 0x00, 0xCF, 0x31, 0x76, 0x98, 0xA5, 0xF5, 0xD0, 0x7E,
+    0x2F, 0x1C, 0x96, 0xC3, 0x4E, 0xA1, 0x1F, 0xEE, 0x6B, 0x31, 0x71, 0x10, 0x68, 0x96, 0x6D, 0xFF,
+    0xC7, 0xFA, 0x4E, 0xFF, 0xA5, 0x60, 0xA3, 0x59, 0x5E, 0x2D, 0x34, 0xB8, 0x7A, 0x6A, 0x97, 0x6A,
+    0xFE, 0x88, 0x11, 0x9F, 0x3D, 0x8C, 0x3C, 0xFD, 0x1D, 0x09, 0xB7, 0xF6, 0x17, 0x27, 0xDC, 0xAE,
+    0xE9, 0xFA, 0xEE, 0x38, 0xE6, 0x04, 0xF7, 0x01, 0xF1, 0x18, 0x76, 0x85, 0xBC, 0xE6, 0x2D, 0xF2,
+    0xD9, 0xCB, 0x30, 0x36, 0xD0, 0x7F, 0xA3, 0xC3, 0xCD, 0x59, 0x34, 0xD7, 0x24, 0x46, 0x69, 0x70,
+    0x92, 0xCF, 0x6F, 0x2E, 0x39, 0x73, 0x56, 0x9E, 0x4D, 0x55, 0x9F, 0x79, 0xF3, 0x0A, 0xF2, 0xB7,
+    0x70, 0x6F, 0x0B, 0x2B, 0x75, 0xA5, 0xD4, 0xE1, 0xB6, 0x0C, 0x2F, 0xFD, 0x03, 0xD6, 0x52, 0x3F,
+    0x43, 0x79, 0x53, 0x5F, 0xD9, 0x29, 0xC2, 0x95, 0x8E, 0xA8, 0xEC, 0x3F, 0x60, 0x2D, 0xFD, 0x7D,
+    0x97, 0xC6, 0x85, 0xF1, 0x3B, 0xDD, 0x28, 0x95, 0xD2, 0xFA, 0xF7, 0x58, 0x1A, 0xA7, 0xD5, 0xD8,
+    0x9F, 0x98, 0x80, 0x76, 0xEB, 0x39, 0xCA, 0xF9, 0xF1, 0x36, 0x02, 0xE5, 0xF0, 0xEA, 0xBB, 0x36,
+    0x9F, 0x2A, 0xA4, 0xB9, 0x55, 0x74, 0xDA, 0x8C, 0xF4, 0x9A, 0xD4, 0xB5, 0x9A, 0x4A, 0x75, 0xB4,
+    0x81, 0x36, 0x60, 0x52, 0x66, 0x12, 0x4D, 0xB8, 0x40, 0x2E, 0x2B, 0xA7, 0xF7, 0x8C, 0x13, 0xF5,
+    0x9A, 0x6B, 0x89, 0x3A, 0xE4, 0xF7, 0x76, 0x8F, 0x85, 0x28, 0x34, 0xD0, 0x04, 0xDA, 0x85, 0xF2,
+    0xEC, 0x37, 0x4D, 0xCE, 0xC8, 0x8F, 0x1E, 0x17, 0xB0, 0x0B, 0x46, 0x43, 0x25, 0x70, 0x7A, 0x59,
+    0x13, 0x3B, 0x89, 0xAD, 0xCA, 0x74, 0xFB, 0x5C, 0xAC, 0x7D, 0xE8, 0x73, 0xC4, 0x73, 0xC5, 0x40,
+    0xA9, 0x17, 0x66, 0x8C, 0xEE, 0x4C, 0x54, 0xDF, 0x96, 0xC7, 0x3C, 0xAF, 0x77, 0x94, 0x55, 0xFC,
+    0x3B, 0x8A, 0xA7, 0x1A, 0x75, 0x76, 0x71, 0x1A, 0xDA, 0xF0, 0xA8, 0x86, 0x36, 0xA0, 0xCE, 0xCD,
+    0x08, 0x37, 0x15, 0xA2, 0xF7, 0x65, 0x62, 0xF4, 0x66, 0x43, 0x43, 0x15, 0x0B, 0x75, 0x75, 0x34,
+    0xC2, 0x2E, 0xB5, 0xB0, 0xA1, 0x11, 0x4D, 0x78, 0x4E, 0xFF, 0xBA, 0xF9, 0x59, 0x54, 0x6A, 0x14,
+    0x14, 0x1B, 0x79, 0x2D, 0x75, 0xA2, 0x1F, 0xB8, 0xC2, 0x03, 0xC0, 0x85, 0xAB, 0x4F, 0x71, 0x48,
+    0x75, 0xEF, 0xDD, 0x49, 0xCA, 0x1B, 0x37, 0x86, 0x7F, 0x79, 0x02, 0x2D, 0xF7, 0xB2, 0x71, 0x9F,
+    0xFB, 0x90, 0x16, 0x57, 0xAF, 0xFE, 0x32, 0xC5, 0xB8, 0x4B, 0x28, 0xF0, 0x22, 0xE0, 0x86, 0xC7,
+    0x81, 0x52, 0xA3, 0x67, 0x77, 0xEB, 0x60, 0x6F, 0x59, 0x78, 0xF1, 0x5F, 0xD6, 0x22, 0x1D, 0xE8,
+    0x30, 0x73, 0xE1, 0x8F, 0xD5, 0xE3, 0xDD, 0x4E, 0x85, 0x38, 0x57, 0x51, 0xF3, 0xDE, 0x4B, 0x37,
+    0xF3, 0x89, 0x9B, 0xED, 0x90, 0x31, 0x39, 0x74, 0x71, 0xC1, 0x76, 0x0B, 0xEC, 0x8D, 0x5C, 0xA8,
+    0xF3, 0x27, 0x2E, 0x9E, 0x9A, 0xB5, 0xBD, 0xD9, 0x68, 0x2A, 0xA5, 0xDB, 0xD2, 0xE4, 0x14, 0x5B,
+    0x2D, 0xA5, 0x36, 0xDA, 0x85, 0x52, 0x87, 0xA4, 0x96, 0x0B, 0x98, 0x2D, 0xF3, 0x68, 0x3C, 0xFD,
+    0x4C, 0x15, 0xA9, 0x37, 0x18, 0x87, 0x53, 0xE9, 0xEE, 0xA2, 0x6E, 0x02, 0xCD, 0x9A, 0xD3, 0x99,
+    0x1D, 0xED, 0xD9, 0x6F, 0x3A, 0x8F, 0x0B, 0xD4, 0x59, 0xD4, 0xEA, 0x70, 0x2B, 0x7D, 0xC0, 0xE8,
+    0xED, 0x71, 0xCB, 0x75, 0xE9, 0x1D, 0x7B, 0xBB, 0xB9, 0x0C, 0x60, 0x1E, 0x49, 0xD2, 0xC5, 0xF5,
+    0x03, 0x10, 0xD0, 0x8F, 0x87, 0xA1, 0x84, 0x06, 0x58, 0x5A, 0x60, 0x7B, 0xE5, 0xB0, 0x78, 0x1E,
+    0xB9, 0xFE, 0x4B, 0x5D, 0xCB, 0x30, 0x17, 0x53, 0x6E, 0xA5, 0x06, 0xB4, 0x8B, 0x0B, 0x60, 0x53,
+    0xB3, 0x81, 0xD1, 0x93, 0x09, 0x18, 0xBB, 0x04, 0x9C, 0xBC, 0x83, 0x66, 0xFB, 0xFE, 0x96, 0x76,
+    0x8E, 0x07, 0xBA, 0x00, 0xCD, 0x6B, 0x11, 0xDC, 0x37, 0x56, 0x90, 0x0D, 0x94, 0xB1, 0xF5, 0x98,
+    0xD0, 0x83, 0xF1, 0x9F, 0xFF, 0xE5, 0xAD, 0xED, 0xF7, 0x8D, 0xB0, 0xC6, 0x73, 0xC2, 0xCA, 0x0C,
+    0xFD, 0x4C, 0x1F, 0xCF, 0x74, 0xF1, 0x43, 0x0F, 0xC4, 0xDC, 0x10, 0xA1, 0xCE, 0x60, 0x79, 0x33,
+    0xBF, 0x47, 0x12, 0x0A, 0x75, 0xA2, 0xF7, 0x5C, 0xC1, 0x02, 0xB9, 0xEE, 0xFD, 0xD6, 0x91, 0x04,
+    0x90, 0xAE, 0x1C, 0x8B, 0xA4, 0xFD, 0x19, 0x56, 0xF8, 0xDE, 0xDD, 0xE5, 0x14, 0xC2, 0xCF, 0x85,
+    0x29, 0x47, 0x62, 0x38, 0xCD, 0x9C, 0xE9, 0xEF, 0xE5, 0x75, 0x86, 0x77, 0x4B, 0x50, 0x89, 0x8F,
+    0xE2, 0xF4, 0x86, 0x34, 0xB4, 0x43, 0xA3, 0x65, 0x54, 0x67, 0x43, 0xA9, 0xB5, 0x4A, 0xD4, 0x91,
+    0x26, 0x14, 0x1A, 0x8C, 0xB0, 0x0B, 0xFD, 0x5C, 0xCA, 0x57, 0xB9, 0x03, 0x58, 0xC8, 0x22, 0x1E,
+    0x23, 0x02, 0x79, 0x27, 0xC6, 0x0E, 0x17, 0x5A, 0x79, 0xE7, 0xA9, 0xA3, 0xFD, 0x5E, 0x68, 0x27,
+    0x4A, 0x55, 0x3F, 0x89, 0x36, 0xC0, 0x78, 0x7B, 0x19, 0x9F, 0x5C, 0xA0, 0x79, 0x33, 0xB6, 0xDF,
+    0x8E, 0x50, 0xC5, 0xAD, 0xFA, 0xD9, 0x06, 0xA8, 0x2F, 0x52, 0x6E, 0xFF, 0x3C, 0xF4, 0xB9, 0x63,
+    0x8E, 0xB7, 0x39, 0xF1, 0x3F, 0x9B, 0x5C, 0x74, 0x1E, 0x72, 0x08, 0xD4, 0xAE, 0xD9, 0x07, 0xCB,
+    0xDD, 0x6F, 0xA0, 0x48, 0xC7, 0x6C, 0xE2, 0x7D, 0xC7, 0x23, 0x67, 0x3A, 0x6D, 0xD8, 0x5C, 0x7C,
+    0x71, 0x2F, 0x1C, 0xCB, 0x8E, 0xAA, 0xD0, 0x0C, 0x60, 0x82, 0xB9, 0xAF, 0xEE, 0xE8, 0x12, 0x0F,
+    0x76, 0x27, 0xC3, 0x18, 0xEC, 0x62, 0x63, 0xBF, 0x95, 0x2A, 0xF4, 0x69, 0x79, 0xE7, 0xDD, 0xD4,
+    0x04, 0xBB, 0xD4, 0x8B, 0xD9, 0x4C, 0x2A, 0x23, 0xEA, 0x34, 0x88, 0x76, 0xEE, 0x83, 0x1B, 0xAA,
+    0xB5, 0x8D, 0x8D, 0x27, 0x59, 0xD5, 0x01, 0xF7, 0x0D, 0xDD, 0x5E, 0xB0, 0x3F, 0xBD, 0xF7, 0x93,
+    0x88, 0x49, 0x6F, 0x6D, 0x11, 0x14, 0xFB, 0x04, 0x6D, 0x6C, 0x04, 0xF5, 0x56, 0x09, 0xCA, 0xDC,
+    0xD9, 0xF0, 0xD9, 0x5C, 0x8F, 0x77, 0x38, 0xFE, 0xF7, 0xD3, 0x04, 0x62, 0x1F, 0x0F, 0xA4, 0x3A,
+    0xC6, 0x17, 0x56, 0xB0, 0x4B, 0x35, 0xC3, 0xC3, 0x87, 0x54, 0xE4, 0x7E, 0x8C, 0x0A, 0x4E, 0x3F,
+    0x90, 0x9E, 0x97, 0xBE, 0xA4, 0xA5, 0xD0, 0x62, 0x44, 0xB9, 0xCF, 0x15, 0xCD, 0x82, 0xC0, 0x85,
+    0x7A, 0x81, 0xD1, 0xF7, 0x03, 0x85, 0x3E, 0x19, 0xC1, 0xC8, 0x79, 0xA8, 0xD3, 0x76, 0xEC, 0x38,
+    0xE2, 0xB2, 0x23, 0x7C, 0x5A, 0xB5, 0x7B, 0xB6, 0x76, 0x53, 0xA7, 0xDD, 0xE4, 0x9A, 0xF5, 0xE0,
+    0xF4, 0xE6, 0xA6, 0x21, 0xE7, 0x5C, 0xFD, 0x1D, 0x3C, 0xCB, 0x33, 0xA3, 0x0E, 0xCA, 0x14, 0x81,
+    0xDE, 0x4E, 0xD0, 0x4C, 0x97, 0xDF, 0xA5, 0xC0, 0xEB, 0x7D, 0xD6, 0x35, 0xE8, 0x01, 0xAE, 0x40,
+    0x19, 0xED, 0x0C, 0xCD, 0x22, 0x0F, 0xFD, 0xED, 0x04, 0x6C, 0xEF, 0xA8, 0x2D, 0x02, 0x5A, 0x45,
+    0xAB, 0x55, 0x9A, 0x7B, 0x7D, 0x5F, 0x1B, 0xFD, 0x86, 0x3C, 0xE3, 0x50, 0x8A, 0x2A, 0x52, 0xE5,
+    0xB2, 0x9A, 0x58, 0x6E, 0xD0, 0x86, 0x66, 0x86, 0x7E, 0x12, 0xA0, 0x6F, 0x06, 0x72, 0xCB, 0xB1,
+    0x9D, 0xB7, 0x97, 0x7B, 0x29, 0x34, 0xA7, 0x3D, 0xFA, 0xCA, 0x33, 0x05, 0x42, 0xEE, 0x54, 0xFA,
+    0x39, 0xD5, 0x3F, 0xA6, 0xEE, 0x94, 0x40, 0x79, 0xAE, 0x44, 0xF2, 0x23, 0xC7, 0x58, 0x75, 0xF4,
+    0x7B, 0xF3, 0xC1, 0x32, 0x83, 0x05, 0xC3, 0x29, 0xFE, 0x79, 0x80, 0xC8, 0x24, 0x2D, 0xB9, 0x25,
+    0xA6, 0x24, 0x79, 0xF7, 0x47, 0xA5, 0xA6, 0xC6, 0x17, 0x9A, 0xAB, 0x80, 0x66, 0x96, 0xAC, 0x55,
+    0x14, 0x80, 0x71, 0x01, 0xFA, 0xE5, 0x60, 0x7C, 0xDD, 0x7A, 0x70, 0x2C, 0x5C, 0x3C, 0x98, 0xEB,
+    0x66, 0xE3, 0x83, 0x34, 0x09, 0xEB, 0x6D, 0xA2, 0x0A, 0x56, 0x98, 0x58, 0x8B, 0x13, 0x55, 0x92,
+    0x34, 0xE8, 0xC0, 0x1D, 0x3A, 0x2F, 0xC3, 0x07, 0x77, 0xF8, 0xC3, 0xC4, 0x5C, 0xAE, 0x74, 0xC4,
+    0xEA, 0x2E, 0xDF, 0xD7, 0x0A, 0xE5, 0x29, 0x3E, 0x8B, 0x16, 0xE7, 0xA5, 0x3B, 0xC1, 0x49, 0x4B,
+    0xF3, 0x23, 0x2D, 0x55, 0xA8, 0x17, 0x96, 0x7A, 0xCD, 0xB0, 0x7B, 0x75, 0xFF, 0x5F, 0x64, 0xAE,
+    0x22, 0xAF, 0x18, 0xBD, 0x3D, 0xBE, 0x20, 0xE9, 0xAF, 0x35, 0x2A, 0xB4, 0x4F, 0x68, 0x39, 0xC7,
+    0xB0, 0x6B, 0x8F, 0x28, 0x42, 0xB3, 0x1E, 0x1B, 0x70, 0x6D, 0xEF, 0x9C, 0xE7, 0x46, 0xD2, 0x54,
+    0x4B, 0x8A, 0x99, 0x1C, 0x94, 0xAE, 0xD4, 0xEA, 0x7A, 0x2A, 0x0D, 0x8D, 0x37, 0x1A, 0xCC, 0x64,
+    0x32, 0xD6, 0xE4, 0xF7, 0x3C, 0x5B, 0x91, 0x5F, 0xE6, 0x43, 0xAB, 0x98, 0x77, 0xCA, 0xF2, 0x33,
+    0xF4, 0x2B, 0x0E, 0xB7, 0xD2, 0x78, 0x17, 0xB1, 0xA1, 0x8D, 0x3C, 0x12, 0x9B, 0x53, 0xFE, 0xD1,
+    0xA8, 0x9D, 0x2C, 0x7C, 0x68, 0xF4, 0x61, 0x43, 0x5E, 0x12, 0x19, 0x9F, 0x3C, 0x96, 0x20, 0x1E,
+    0x74, 0xD5, 0xC3, 0xB8, 0xCD, 0x06, 0xA7, 0x7B, 0xD1, 0x4A, 0x5B, 0x75, 0x77, 0xDC, 0x8A, 0x58,
+    0x6E, 0x3C, 0x5E, 0xA6, 0x5D, 0xB6, 0xF7, 0xFF, 0x89, 0xDF, 0x29, 0x44, 0xDB, 0x29, 0xDD, 0x9C,
+    0x25, 0xAD, 0xFD, 0x1D, 0xC5, 0x7A, 0x1A, 0x0F, 0xEC, 0xFD, 0x17, 0x79, 0x66, 0xC7, 0x19, 0xEC,
+    0x34, 0x76, 0x94, 0x9B, 0x0E, 0x1A, 0x22, 0x2B, 0x81, 0xCB, 0xEF, 0x27, 0x01, 0x15, 0x9C, 0x60,
+    0x66, 0x3B, 0x13, 0xED, 0x4C, 0xFB, 0xA5, 0x39, 0x3B, 0xC6, 0x63, 0xC8, 0x52, 0x2B, 0x96, 0xB3,
+    0x7D, 0x17, 0x8A, 0x17, 0x8D, 0x26, 0x19, 0x69, 0xF4, 0x92, 0xA6, 0xFE, 0x3F, 0x69, 0x6A, 0x7C,
+    0x3B, 0x99, 0xA9, 0x9D, 0xB3, 0x2F, 0xDF, 0xDC, 0xFF, 0x17, 0xCC, 0xD0, 0x84, 0x72, 0xB1, 0xFA,
+    0x71, 0xB2, 0x92, 0xBE, 0x98, 0x24, 0xFF, 0x4A, 0xAD, 0xE9, 0x38, 0x05, 0xFF, 0xF6, 0x45, 0xA0,
+    0xDC, 0x83, 0x06, 0x01, 0xED, 0xCF, 0x12, 0xE0, 0xFC, 0x33, 0xC7, 0xAA, 0x4A, 0x75, 0x47, 0xEA,
+    0x42, 0x26, 0x02, 0xEF, 0xF8, 0xD2, 0x4E, 0x1D, 0xE1, 0xB8, 0xFA, 0xF2, 0xAE, 0xCF, 0xF6, 0x7B,
+    0x7F, 0x5D, 0x8E, 0x5D, 0x7B, 0x76, 0x5D, 0xEC, 0xE6, 0xD3, 0x4A, 0xB5, 0x7E, 0x3A, 0x65, 0x43,
+    0x8C, 0xFE, 0x48, 0x24, 0x7E, 0x97, 0x1F, 0x4C, 0xC0, 0x63, 0x55, 0x04, 0xC6, 0x9B, 0x2B, 0x90,
+    0x77, 0xE3, 0xA8, 0x01, 0x78, 0xE4, 0xF5, 0xAC, 0xFA, 0x96, 0x3A, 0xB4, 0xC1, 0x4D, 0xBD, 0x77,
+    0xC3, 0xC7, 0x32, 0x92, 0x7E, 0x5F, 0x57, 0xF9, 0x8C, 0x20, 0xBB, 0xC0, 0xB8, 0x96, 0x29, 0x56,
+    0x61, 0x6B, 0xA6, 0xCB, 0xAE, 0xFB, 0x18, 0x50, 0xCD, 0xBF, 0xD1, 0xAE, 0x97, 0x5D, 0xDA, 0x9E,
+    0x75, 0xF1, 0x77, 0x9A, 0x40, 0x91, 0x3B, 0xF0, 0xC7, 0x5E, 0xF1, 0xD2, 0xD5, 0x2B, 0x1F, 0xE0,
+    0x81, 0xCB, 0xFC, 0xA6, 0x1B, 0x6E, 0x39, 0x2D, 0x8D, 0xA6, 0x32, 0x71, 0xF2, 0xC2, 0xD6, 0x7F,
+    0x37, 0xBA, 0xAE, 0x03, 0x1A, 0x1F, 0xDD, 0xED, 0xAD, 0xBF, 0xBD, 0xF5, 0x9F, 0x5C, 0x1F, 0xA0,
+    0x3B, 0xB9, 0x6B, 0xF5, 0x57, 0xFF, 0xFD, 0xDE, 0xFC, 0xEA, 0x87, 0x1D, 0xAE, 0x13, 0x97, 0xB1,
+    0x5D, 0xCE, 0x1D, 0x8D, 0x4B, 0x73, 0xE7, 0xF6, 0xFC, 0xCC, 0xE3, 0xE6, 0xF6, 0x74, 0xCB, 0x5D,
+    0x7B, 0x5E, 0xF3, 0x49, 0xAE, 0xF5, 0xF8, 0x98, 0xF1, 0xCD, 0x6B, 0xD1, 0xBE, 0x99, 0x6C, 0x50,
+    0x1D, 0x46, 0x13, 0x7A, 0xC2, 0x87, 0xF6, 0x28, 0xF3, 0x0F, 0x6E, 0x95, 0xF1, 0x95, 0x3A, 0xF4,
+    0xAD, 0x77, 0xA2, 0xD9, 0xB0, 0xCB, 0x8E, 0xB9, 0x7E, 0xF8, 0x03, 0x26, 0x44, 0x7B, 0x3B, 0xB8,
+    0xDF, 0x9B, 0xFA, 0xC6, 0xDF, 0x6A, 0x09, 0x8F, 0x01, 0x3C, 0xDA, 0x35, 0xFA, 0xBA, 0xF4, 0xE5,
+    0xEF, 0xE8, 0xF3, 0x6C, 0x5D, 0xEE, 0xE9, 0x4A, 0xE5, 0x6F, 0x55, 0x93, 0x2B, 0x57, 0x3B, 0x3B,
+    0x3F, 0x76, 0x2F, 0x51, 0x05, 0x37, 0xF7, 0x3E, 0x55, 0xA1, 0x7D, 0x3E, 0x36, 0xFE, 0xF3, 0xD8,
+    0xDB, 0xDB, 0xF8, 0x7B, 0x21, 0xD5, 0x73, 0x5F, 0x2E, 0x0F, 0xF2, 0x00, 0xB1, 0x79, 0x2D, 0xBA,
+    0x4F, 0x86, 0xC7, 0x2B, 0x7F, 0x91, 0x7A, 0x92, 0xFD, 0xEB, 0xCD, 0x3D, 0x39, 0xCD, 0x50, 0x14,
+    0xD1, 0x7D, 0x77, 0xEB, 0x9F, 0xBF, 0x6E, 0x87, 0x5B, 0xC7, 0x21, 0x3F, 0xC4, 0x95, 0xA2, 0xB3,
+    0xEB, 0xE5, 0x57, 0x3E, 0xFF, 0xF1, 0xAF, 0x7D, 0xFC, 0xD9, 0x67, 0xDC, 0x72, 0x32, 0xD0, 0x35,
+    0xBE, 0xEF, 0x36, 0x13, 0xDA, 0x72, 0xB9, 0x40, 0x71, 0xA5, 0x8E, 0x75, 0x24, 0x16, 0xB1, 0x0A,
+    0xCE, 0x7F, 0x14, 0xAE, 0x54, 0xDE, 0x72, 0x99, 0xCB, 0xF4, 0x4F, 0xB9, 0xD8, 0xCC, 0x14, 0x5B,
+    0x7B, 0x3B, 0xBA, 0x17, 0x96, 0xBE, 0x0E, 0x9F, 0x63, 0xAF, 0x71, 0x2C, 0xD5, 0x95, 0x0A, 0x65,
+    0x4A, 0x26, 0x36, 0xB7, 0xD7, 0x32, 0x7C, 0x98, 0x8B, 0xBF, 0x72, 0x6E, 0x16, 0xE6, 0x5C, 0x22,
+    0x5A, 0x87, 0xDF, 0x6A, 0xE3, 0xE5, 0x5E, 0xDB, 0x33, 0x6E, 0xFD, 0x88, 0x9D, 0x81, 0x4B, 0x57,
+    0x9F, 0xCA, 0x13, 0xF7, 0xE8, 0x8D, 0x97, 0x78, 0xB8, 0x2B, 0xB5, 0x58, 0x45, 0xF7, 0x27, 0xF1,
+    0x31, 0xE2, 0xBF, 0xE1, 0xFF, 0x38, 0x24, 0xDB, 0xEA, 0x81, 0x6A, 0xC1, 0x44, 0xCC, 0x46, 0x19,
+    0x21, 0xC2, 0x47, 0x28, 0x78, 0xA8, 0x5A, 0xDC, 0x0B, 0x5B, 0x3B, 0xCB, 0x2E, 0xEE, 0x13, 0x2B,
+    0xC0, 0xA3, 0xD5, 0xFC, 0x8A, 0x7D, 0x4B, 0xDF, 0x5D, 0xCE, 0x67, 0x68, 0xF6, 0x96, 0x4A, 0xD9,
+    0xD5, 0x30, 0x7B, 0x43, 0x39, 0x7F, 0xA4, 0xDB, 0xDE, 0xDF, 0x60, 0x5C, 0x92, 0xBA, 0x5A, 0x87,
+    0xE6, 0x5D, 0x01, 0x93, 0x8A, 0x6B, 0x9E, 0x66, 0xA1, 0x87, 0xD1, 0x17, 0x2B, 0x46, 0x54, 0xFE,
+    0x6C, 0xAF, 0xDB, 0xBD, 0xD0, 0x56, 0x5A, 0xC9, 0xDD, 0x68, 0x91, 0x74, 0xBE, 0x49, 0xEE, 0xC1,
+    0xAD, 0x29, 0x67, 0xEC, 0x4A, 0xE3, 0xE9, 0x27, 0x12, 0xA5, 0xBA, 0x47, 0xF6, 0xE6, 0x26, 0xF5,
+    0xDE, 0x36, 0x5A, 0x5A, 0x38, 0x0B, 0xA3, 0x4A, 0xD2, 0x97, 0xDE, 0x7A, 0x7A, 0xFB, 0xF4, 0x32,
+    0xA2, 0xA1, 0x7F, 0x72, 0x6E, 0x96, 0x2A, 0xDC, 0x2A, 0xC5, 0x2B, 0x45, 0x77, 0x16, 0x15, 0xFD,
+    0xE1, 0x4B, 0x87, 0x3B, 0x18, 0xA5, 0x80, 0x4D, 0x9F, 0xD6, 0x80, 0x86, 0x26, 0xD2, 0x2C, 0x68,
+    0x2A, 0xD5, 0xD5, 0x1B, 0x2E, 0xD0, 0x4F, 0x46, 0x54, 0x1B, 0x6E, 0x66, 0x9C, 0xAA, 0x8D, 0x3A,
+    0x9E, 0xE8, 0x2E, 0x7A, 0x4D, 0x9A, 0xED, 0xEA, 0xB4, 0x77, 0xC0, 0xCE, 0x88, 0x77, 0x84, 0x5F,
+    0x2B, 0xD4, 0x61, 0xDE, 0x1E, 0x0F, 0x55, 0x19, 0x59, 0xFB, 0x9C, 0x9C, 0x2D, 0x91, 0xCE, 0x02,
+    0xCC, 0x08, 0xF6, 0x78, 0x2C, 0xD0, 0x28, 0x15, 0x00, 0x7B, 0x97, 0x77, 0xB8, 0x04, 0x59, 0xC4,
+    0xD4, 0x92, 0xE2, 0x41, 0xC4, 0xBA, 0xD4, 0x7B, 0x9A, 0x95, 0x04, 0xE3, 0x64, 0x16, 0x8C, 0xB0,
+    0x1E, 0x1B, 0x79, 0x1C, 0xFA, 0x99, 0xEE, 0x20, 0xE2, 0xED, 0xDD, 0x5C, 0x95, 0xFB, 0x44, 0x7C,
+    0xBE, 0x0F, 0x71, 0xF6, 0x71, 0x7A, 0xCD, 0x50, 0x4B, 0x13, 0x38, 0xE9, 0x94, 0x96, 0x52, 0x1E,
+    0x5A, 0x93, 0xFB, 0xDC, 0x4B, 0xCD, 0xA5, 0xAE, 0xF7, 0x36, 0x61, 0xD6, 0x52, 0x03, 0xAE, 0x73,
+    0x01, 0x13, 0xEA, 0x08, 0x0F, 0xED, 0x10, 0xED, 0xB2, 0x63, 0xDD, 0x43, 0x2E, 0xD5, 0xDD, 0x7B,
+    0x5E, 0x9E, 0xCE, 0x83, 0x5B, 0xE0, 0x62, 0x29, 0x8F, 0xF1, 0xCD, 0x06, 0x09, 0x2D, 0xB4, 0x73,
+    0xA5, 0xB7, 0xC7, 0xDC, 0xCA, 0x66, 0x38, 0xF4, 0xBF, 0xD7, 0x74, 0xA4, 0x2A, 0xFC, 0xF3, 0xA4,
+    0xAE, 0xDE, 0xFB, 0xAA, 0x33, 0xAE, 0x14, 0xE0, 0xBE, 0x10, 0xB1, 0xB1, 0x9F, 0xD0, 0x93, 0x11,
+    0x3B, 0xF7, 0xDD, 0x3B, 0x43, 0xC0, 0x52, 0x7B, 0x5B, 0x35, 0x6C, 0x7C, 0xB7, 0x42, 0x43, 0xA3,
+    0x7D, 0x32, 0xEB, 0xED, 0x90, 0xA6, 0x8F, 0xBB, 0xFD, 0x79, 0x67, 0x05, 0xE3, 0xE1, 0xBC, 0x13,
+    0xDD, 0xCD, 0x17, 0xDE, 0xA1, 0x72, 0x2B, 0x75, 0xD4, 0x7B, 0xAD, 0xEB, 0x81, 0xDF, 0x7D, 0xB6,
+    0xF5, 0xDE, 0x72, 0x58, 0x37, 0x7F, 0xC7, 0x27, 0x59, 0x8F, 0xF4, 0xD3, 0x2F, 0xFA, 0xE4, 0x0C,
+    0x5B, 0x7C, 0xDD, 0x97, 0xEC, 0x47, 0x8C, 0xA0, 0xF9, 0x6E, 0xBE, 0x81, 0x8E, 0x72, 0x87, 0x4A,
+    0x80, 0xE2, 0x8F, 0x76, 0xA4, 0x3D, 0x57, 0x36, 0x33, 0xE6, 0x32, 0xDC, 0xBD, 0xA7, 0x13, 0x98,
+    0x58, 0x67, 0xCB, 0xBD, 0x66, 0x7B, 0x5D, 0x2D, 0x79, 0x69, 0xD7, 0x61, 0x8F, 0x32, 0xE7, 0xDD,
+    0x76, 0x4F, 0xB9, 0x81, 0x4B, 0xE3, 0xDB, 0xB7, 0x72, 0x55, 0x55, 0x1E, 0xB6, 0xEB, 0xDC, 0xFE,
+    0xB8, 0x85, 0xFE, 0x6D, 0x2D, 0x90, 0x18, 0xA7, 0x36, 0x52, 0x6C, 0xC8, 0xDB, 0x88, 0x89, 0xB9,
+    0xB1, 0x76, 0xB5, 0xA0, 0xA1, 0x8E, 0xD8, 0x50, 0xA8, 0xB3, 0xF1, 0xC3, 0xCE, 0x97, 0xEA, 0x9A,
+    0xD5, 0x69, 0x30, 0x62, 0x0C, 0x63, 0x6E, 0x8A, 0xE4, 0xC7, 0x58, 0x48, 0x4A, 0xB8, 0xB9, 0x94,
+    0x34, 0x9F, 0x22, 0x57, 0x56, 0xE9, 0xC0, 0x9F, 0xCF, 0x48, 0xB0, 0xD4, 0x8D, 0x1A, 0xC0, 0xA4,
+    0xEC, 0x0F, 0x14, 0xEA, 0xF2, 0x0E, 0x1E, 0xFD, 0x5E, 0x61, 0x14, 0x8E, 0x32, 0xCA, 0xD9, 0xC9,
+    0x2D, 0x07, 0xA2, 0x85, 0xBA, 0x52, 0x7F, 0xB4, 0x4B, 0x62, 0xD7, 0xA7, 0x3B, 0xCB, 0x49, 0x4A,
+    0xE3, 0x96, 0x4F, 0x2C, 0xE4, 0x33, 0x5C, 0xD3, 0x86, 0xDC, 0x80, 0xAC, 0xDE, 0x32, 0x70, 0x53,
+    0x6A, 0xBF, 0xA2, 0x7C, 0xBE, 0x62, 0x3F, 0xE7, 0x13, 0xC7, 0x50, 0x69, 0x2D, 0x25, 0x2D, 0xB5,
+    0x64, 0xF6, 0x46, 0x35, 0x5F, 0x3F, 0xEB, 0xFB, 0xE6, 0x5F, 0xF2, 0xF9, 0xB5, 0x97, 0xA4, 0x61,
+    0xBC, 0xAA, 0xEF, 0x8C, 0xDD, 0x88, 0x86, 0xBE, 0x7B, 0xB5, 0x50, 0xD7, 0x73, 0xAB, 0x14, 0xAF,
+    0xF2, 0x90, 0x11, 0x0F, 0x1D, 0x9C, 0xAA, 0x2A, 0x5D, 0xF8, 0xA3, 0x5C, 0x47, 0xDD, 0x51, 0xEF,
+    0xB7, 0xFA, 0x7F, 0x29, 0x60, 0x57, 0xFA, 0xDC, 0xE5, 0x25, 0xD0, 0x2E, 0xFB, 0x80, 0xF3, 0x3F,
+    0xFD, 0x8C, 0x9B, 0xE9, 0x27, 0xFA, 0x89, 0xD1, 0x9F, 0x68, 0x3D, 0xD1, 0xDA, 0x2A, 0xB5, 0xDA,
+    0x5C, 0x26, 0x60, 0x9C, 0x39, 0x32, 0xEB, 0xA4, 0x1D, 0x4E, 0x7D, 0xB9, 0xBD, 0x79, 0xCE, 0x0E,
+    0xB9, 0x8C, 0x39, 0xC8, 0xBD, 0xAF, 0x7F, 0xD6, 0x05, 0x90, 0x82, 0x11, 0xB5, 0x34, 0xF4, 0x89,
+    0x46, 0xAB, 0xD1, 0x82, 0x49, 0xB8, 0x7B, 0x9E, 0x66, 0x29, 0xB7, 0x0B, 0x30, 0xFA, 0x66, 0x02,
+    0x23, 0x12, 0x60, 0x63, 0x7E, 0x2C, 0xC9, 0xDC, 0x03, 0x85, 0x3E, 0xB9, 0xB0, 0x97, 0x43, 0x1C,
+    0x35, 0xA6, 0xFE, 0x6A, 0x03, 0xAA, 0xCD, 0xE6, 0x32, 0x97, 0x26, 0x00, 0xF2, 0x2E, 0x5F, 0x62,
+    0xF4, 0x60, 0xD7, 0x42, 0x1D, 0xD9, 0xC2, 0x50, 0x8A, 0x5A, 0xD0, 0x6B, 0xB0, 0xB9, 0xAD, 0x64,
+    0x93, 0x70, 0xDA, 0x76, 0x6E, 0xC9, 0x7D, 0x24, 0xAD, 0x9D, 0x5A, 0xB3, 0xB7, 0x3E, 0x3C, 0xF4,
+    0x1A, 0xD8, 0x41, 0xE5, 0xDC, 0x0C, 0xF9, 0x68, 0xAE, 0xE1, 0x0F, 0xDE, 0x15, 0x49, 0x2A, 0xA5,
+    0x39, 0x17, 0x9F, 0x6F, 0xB9, 0x78, 0x53, 0xF7, 0x57, 0xC4, 0xD3, 0x2E, 0xD4, 0x99, 0x61, 0x6B,
+    0x94, 0x2B, 0x2F, 0x95, 0xA0, 0x4A, 0x59, 0x2B, 0xF6, 0x53, 0xA3, 0x08, 0x75, 0xAC, 0x57, 0x79,
+    0xD0, 0x6B, 0xA9, 0x59, 0xC1, 0x46, 0x3D, 0xA1, 0x8E, 0x42, 0x9A, 0x5C, 0xA6, 0x8D, 0xE4, 0xFA,
+    0xCF, 0x98, 0x39, 0x53, 0x69, 0xEF, 0x57, 0x30, 0xFC, 0x5D, 0x15, 0xF1, 0xDB, 0x69, 0x45, 0xFC,
+    0xF1, 0xF8, 0x57, 0x80, 0xE3, 0x43, 0xC0, 0xC8, 0xB3, 0xC0, 0xF8, 0xDF, 0x22, 0x87, 0xDE, 0x1A,
+    0xB5, 0xDE, 0x2D, 0x21, 0xD4, 0x68, 0x33, 0xDA, 0x5A, 0xC5, 0x4A, 0xB1, 0xD1, 0x5C, 0x68, 0x29,
+    0x35, 0x1C, 0xCA, 0x9F, 0x40, 0xDE, 0x44, 0x18, 0x7D, 0x95, 0xF9, 0x3D, 0x01, 0xDC, 0xDC, 0x7A,
+    0x68, 0x43, 0x3F, 0x40, 0x13, 0x04, 0xD8, 0x9F, 0x44, 0xC0, 0xDE, 0xCB, 0x64, 0xA4, 0x6C, 0xB9,
+    0xFC, 0x19, 0xCF, 0xE8, 0x48, 0x74, 0xFE, 0x48, 0xBD, 0x00, 0xCF, 0x8D, 0xD3, 0xD1, 0x7B, 0x1F,
+    0xB7, 0xD3, 0xA8, 0xA0, 0x38, 0xEE, 0xFC, 0x3A, 0xFB, 0x4B, 0x2F, 0xEC, 0xB6, 0x64, 0xD4, 0xF5,
+    0x2C, 0xE1, 0xAC, 0x10, 0xF7, 0xA6, 0x0B, 0x7B, 0xA5, 0xEB, 0x5E, 0xB1, 0xBB, 0x37, 0x75, 0xC8,
+    0xE7, 0x74, 0xF9, 0x1C, 0x7F, 0xDF, 0x39, 0xF6, 0xF4, 0x9C, 0x52, 0xDD, 0xA1, 0x9E, 0xF6, 0xEC,
+    0x39, 0xEB, 0xBB, 0x9C, 0x53, 0x49, 0xCA, 0x46, 0x48, 0xD9, 0x0E, 0x1D, 0x1E, 0x1F, 0x92, 0xB7,
+    0x49, 0xE6, 0x8C, 0x1D, 0x0A, 0xFE, 0x8A, 0x7D, 0x81, 0xED, 0xFD, 0xC2, 0x9A, 0x6E, 0x77, 0xC1,
+    0xCF, 0x89, 0xBC, 0x03, 0x9B, 0x19, 0x1D, 0x65, 0xCA, 0x68, 0x59, 0xB5, 0x3F, 0x10, 0xE9, 0x0C,
+    0xBE, 0x54, 0xBC, 0x44, 0xA1, 0x48, 0xAB, 0xB5, 0x4C, 0xD7, 0x42, 0x33, 0x39, 0x9F, 0x8A, 0x54,
+    0x07, 0x1B, 0xDC, 0x30, 0x7E, 0x62, 0x6B, 0x96, 0xFA, 0x9E, 0x3A, 0xA7, 0x19, 0x2D, 0x98, 0x8D,
+    0x0F, 0xD8, 0xA5, 0x88, 0xEE, 0xAD, 0x7E, 0xEE, 0x25, 0xA4, 0x99, 0x71, 0xCD, 0xB4, 0xD4, 0x0B,
+    0x5D, 0x2E, 0xCB, 0xAE, 0xB5, 0xC0, 0xA8, 0x3D, 0x10, 0x7B, 0x59, 0x37, 0x27, 0x2B, 0x45, 0x5E,
+    0x4E, 0x37, 0x3A, 0xC6, 0x01, 0xEC, 0x52, 0x80, 0xAA, 0x84, 0x7D, 0x53, 0x6B, 0x91, 0x7A, 0xF9,
+    0xF6, 0xCE, 0xF7, 0xA2, 0xD1, 0x3C, 0x7A, 0x17, 0xAB, 0x58, 0x89, 0xDE, 0x8F, 0x73, 0x15, 0x6D,
+    0xA4, 0xF7, 0xF2, 0x75, 0x6C, 0x16, 0xC6, 0xAF, 0x0B, 0xBB, 0xB6, 0xE1, 0xC0, 0x53, 0x9D, 0x4A,
+    0x55, 0x31, 0xF3, 0xB8, 0xCE, 0x34, 0xA1, 0xFC, 0xAD, 0x2A, 0x52, 0xBD, 0xAD, 0x8E, 0xFC, 0x14,
+    0xAD, 0x70, 0x08, 0xD9, 0x8E, 0x14, 0xC4, 0xF5, 0x9D, 0x14, 0xC4, 0xCB, 0xE7, 0x29, 0x88, 0x17,
+    0x5E, 0x82, 0x31, 0xFB, 0x00, 0x75, 0x1A, 0x83, 0x9D, 0x6C, 0x38, 0xA1, 0x09, 0xD0, 0x07, 0x4A,
+    0x79, 0x1A, 0xE5, 0xA7, 0x0B, 0x69, 0xA0, 0xCD, 0x49, 0xEB, 0xA1, 0xF7, 0xD5, 0xD4, 0x4F, 0xED,
+    0xE4, 0x72, 0x13, 0xD1, 0x4C, 0xC9, 0x7A, 0x68, 0x67, 0x89, 0x56, 0x8A, 0xB4, 0xDA, 0x90, 0xB6,
+    0x52, 0xDC, 0xAA, 0xF6, 0x86, 0xAB, 0x36, 0x3C, 0x44, 0xAB, 0xAC, 0x54, 0xDC, 0x8F, 0xBF, 0x82,
+    0xCB, 0x4D, 0xAD, 0x2E, 0xBA, 0x50, 0x2C, 0xED, 0xDD, 0xA7, 0x43, 0x23, 0xCD, 0xB5, 0xD4, 0x95,
+    0x5A, 0x77, 0x75, 0xF3, 0x4F, 0xC3, 0xC2, 0xF9, 0x47, 0x95, 0xCB, 0x27, 0x93, 0xBA, 0x0B, 0xFB,
+    0xDA, 0xB3, 0x93, 0x9E, 0x5C, 0xFB, 0xDB, 0x9B, 0x9D, 0x12, 0xDD, 0x03, 0xFF, 0x34, 0xAD, 0x04,
+    0x38, 0x2D, 0x6F, 0x29, 0xD5, 0xED, 0x4D, 0xA8, 0x5C, 0x38, 0xB2, 0x22, 0x4F, 0x33, 0x2C, 0x79,
+    0xB4, 0x46, 0xCB, 0x5E, 0x41, 0x5C, 0xE8, 0x00, 0x0D, 0xBC, 0x6B, 0x2F, 0x93, 0x5D, 0x2B, 0xDB,
+    0x75, 0xDF, 0x4B, 0x85, 0x0E, 0x18, 0x82, 0x9B, 0x77, 0x30, 0xED, 0xF0, 0x7F, 0x0F, 0x14, 0xCA,
+    0x85, 0xC3, 0x95, 0xE4, 0x73, 0xDD, 0xB0, 0xD3, 0x70, 0x28, 0x1B, 0x86, 0x87, 0xFF, 0x33, 0x47,
+    0xB6, 0x78, 0xEE, 0x0B, 0x45, 0xBD, 0xF7, 0xA0, 0xFE, 0xE4, 0x0A, 0x94, 0x6B, 0x3B, 0x01, 0xD6,
+    0xE7, 0xC0, 0xC6, 0x6C, 0x1A, 0x30, 0x4B, 0x23, 0x79, 0xAC, 0x1F, 0xEF, 0x69, 0xA0, 0x37, 0xB1,
+    0x10, 0x66, 0xB1, 0xC1, 0x44, 0x1A, 0xEF, 0xBC, 0x0D, 0x5D, 0x2A, 0x44, 0xFF, 0xC2, 0x9D, 0x60,
+    0xA2, 0x89, 0x56, 0x83, 0x4D, 0x9A, 0x5D, 0xA4, 0xD1, 0x86, 0x06, 0x1A, 0x0D, 0x5C, 0xDC, 0xFD,
+    0xDE, 0xCF, 0x70, 0x09, 0x5A, 0x31, 0x0E, 0x48, 0x68, 0xE0, 0xE5, 0x5C, 0x95, 0x91, 0x0A, 0x81,
+    0xD9, 0x4A, 0x81, 0xD9, 0x4C, 0x82, 0x6A, 0xFB, 0x54, 0x1A, 0xAF, 0xD7, 0x92, 0xB4, 0x58, 0x49,
+    0x37, 0xA3, 0x7D, 0xFB, 0xE6, 0x6A, 0xB6, 0x26, 0xD4, 0x4B, 0xB9, 0x35, 0xC1, 0x2E, 0xE5, 0xD6,
+    0x06, 0xBB, 0x98, 0xE8, 0x66, 0xBB, 0xD6, 0xAB, 0x9B, 0x6A, 0x8D, 0xA1, 0xF7, 0x46, 0xF2, 0xE3,
+    0xB0, 0x2B, 0xCB, 0x0B, 0xBF, 0xB8, 0x5F, 0xCC, 0xA3, 0x7A, 0x63, 0x41, 0x92, 0x2F, 0x6F, 0xBE,
+    0xFD, 0xD5, 0x43, 0x07, 0x14, 0xC0, 0x86, 0x36, 0xE0, 0xBE, 0xA1, 0x50, 0xA4, 0x5E, 0xBE, 0xFE,
+    0xF9, 0xCF, 0x94, 0x8B, 0x48, 0x14, 0x0E, 0x1D, 0x50, 0xD6, 0x43, 0x07, 0x14, 0xFD, 0x0F, 0x74,
+    0x40, 0xC1, 0x0C, 0x07, 0x3A, 0x65, 0xD8, 0xBB, 0x36, 0xF5, 0x7E, 0xD7, 0x88, 0xEB, 0x7D, 0x38,
+    0xE8, 0xC9, 0xC0, 0x8B, 0x6D, 0x62, 0xFC, 0xA6, 0x66, 0x17, 0x5F, 0x4E, 0x56, 0xBE, 0xFD, 0x76,
+    0x7A, 0xC8, 0xC4, 0x11, 0xDC, 0x97, 0x3D, 0xD5, 0xCF, 0x43, 0x6E, 0xA8, 0x66, 0x73, 0xC3, 0x20,
+    0x4F, 0xF3, 0x93, 0x8D, 0x42, 0xCD, 0x4C, 0x3B, 0xEB, 0x93, 0x2F, 0xA4, 0x3A, 0x45, 0x37, 0x39,
+    0xFD, 0x6E, 0x2C, 0x35, 0x8F, 0x83, 0x5D, 0x76, 0xAC, 0xEF, 0xE2, 0xB1, 0xCF, 0x76, 0x3C, 0x36,
+    0x8E, 0xCA, 0xE1, 0x99, 0x3F, 0x70, 0x78, 0xCF, 0x63, 0xF6, 0xBF, 0xAC, 0xB4, 0xEB, 0x6F, 0x43,
+    0xED, 0xAB, 0x8E, 0x22, 0x12, 0xA0, 0x99, 0x7B, 0xF2, 0xB0, 0x72, 0x95, 0x1E, 0x17, 0x8E, 0x5B,
+    0xEB, 0x7D, 0xF6, 0xC0, 0x87, 0xF7, 0x46, 0x3E, 0x1F, 0xEB, 0x07, 0xAE, 0x3C, 0xF3, 0xC0, 0xD9,
+    0x04, 0x60, 0x11, 0x0F, 0x8D, 0xA5, 0x9A, 0xE9, 0x4C, 0xD2, 0x79, 0x67, 0x1A, 0xE7, 0x5C, 0x41,
+    0xB5, 0xC1, 0xA5, 0x4F, 0xE9, 0x8F, 0x9F, 0xB2, 0x92, 0x32, 0x20, 0xFF, 0x85, 0xED, 0xDA, 0xDD,
+    0xA7, 0xA7, 0xAD, 0xDE, 0x4C, 0x70, 0xA5, 0x88, 0xD5, 0x20, 0xFF, 0xD8, 0x59, 0x24, 0xBC, 0x96,
+    0xAE, 0xEF, 0xCF, 0xFD, 0xD1, 0x1D, 0x05, 0xDC, 0x6C, 0x13, 0xCD, 0x92, 0xA3, 0x12, 0x17, 0x8C,
+    0xB0, 0x11, 0x0D, 0x46, 0xB8, 0xB9, 0x54, 0xD7, 0x2C, 0xA5, 0xFC, 0x35, 0x49, 0x7E, 0x54, 0xA6,
+    0x70, 0xDD, 0x3D, 0x12, 0xDF, 0xF9, 0x2C, 0xB4, 0xA9, 0x12, 0x28, 0xB5, 0x1A, 0x78, 0x39, 0x8D,
+    0x1A, 0x28, 0xD3, 0xAA, 0x01, 0xA3, 0x39, 0xF3, 0x48, 0x95, 0x8B, 0xB0, 0xAE, 0xCD, 0x75, 0x2A,
+    0xA4, 0x68, 0x63, 0xA9, 0x3B, 0x9B, 0x5D, 0x4D, 0x2C, 0x53, 0xB3, 0x98, 0x88, 0x9A, 0x60, 0x22,
+    0xA9, 0x0D, 0x55, 0x2C, 0x36, 0x37, 0x9B, 0x58, 0x45, 0x37, 0x19, 0x8D, 0x4B, 0xEF, 0x0B, 0x69,
+    0x1A, 0x07, 0xFA, 0x74, 0xCA, 0xCA, 0xFF, 0x45, 0x85, 0x2D, 0xE5, 0xD9, 0xC2, 0x96, 0x36, 0x1A,
+    0x81, 0x8D, 0x75, 0x02, 0xBB, 0xD9, 0x78, 0xA6, 0xB0, 0x45, 0x92, 0x36, 0x77, 0x4A, 0x1F, 0x8B,
+    0x2E, 0x40, 0xBB, 0xBA, 0x05, 0xDC, 0xE2, 0x16, 0xE8, 0x83, 0x5B, 0x41, 0x53, 0x1B, 0x29, 0xE5,
+    0x6D, 0xA2, 0x16, 0xB5, 0xBE, 0xF3, 0xB7, 0x16, 0xB6, 0x3C, 0xDC, 0x51, 0x28, 0x51, 0x4A, 0xB3,
+    0xD1, 0xCD, 0xAD, 0x14, 0x7A, 0x5E, 0xB4, 0x41, 0x43, 0x15, 0x9D, 0x2F, 0xD4, 0x4A, 0xFA, 0xA6,
+    0xA4, 0x1F, 0xE8, 0xC6, 0xCD, 0x45, 0x9D, 0x89, 0x6E, 0x2A, 0x93, 0x5D, 0x0B, 0x95, 0x2A, 0xD4,
+    0xF5, 0xD9, 0x99, 0xEB, 0xF2, 0x38, 0x0F, 0xEB, 0xFE, 0xA9, 0x46, 0x89, 0x42, 0x7F, 0x29, 0x0D,
+    0xA5, 0xDE, 0x92, 0xBA, 0x42, 0x5B, 0x9D, 0x40, 0x2A, 0x34, 0xA0, 0xD7, 0x3A, 0x17, 0xE8, 0x3D,
+    0x36, 0xE2, 0x26, 0x8C, 0x68, 0x66, 0x18, 0x7D, 0x1D, 0xA0, 0x09, 0x66, 0x05, 0xB3, 0x95, 0xD9,
+    0xC7, 0x48, 0x80, 0x9B, 0x7B, 0xA0, 0x5E, 0xDD, 0x00, 0xA5, 0x1A, 0x0F, 0xF4, 0x7F, 0x39, 0x03,
+    0xF6, 0xA7, 0xD9, 0x1B, 0xCD, 0x86, 0x21, 0xC2, 0xDE, 0x8E, 0x92, 0x4A, 0x67, 0xCA, 0x7C, 0x9D,
+    0x3F, 0x6F, 0xC7, 0x3E, 0x58, 0x69, 0xA2, 0xFF, 0xB6, 0x56, 0xFA, 0xF5, 0xE5, 0x84, 0xDB, 0x90,
+    0x77, 0x3F, 0xC2, 0x85, 0x76, 0xC2, 0x46, 0x3B, 0x53, 0xCA, 0x06, 0x18, 0xBF, 0x18, 0xA0, 0xFD,
+    0xC1, 0x02, 0xD5, 0xDD, 0x15, 0x8A, 0x9C, 0x2D, 0xDC, 0x8E, 0xFD, 0x44, 0x4E, 0x03, 0x78, 0xE7,
+    0x39, 0xF3, 0xF8, 0xC1, 0xF3, 0x47, 0x06, 0xC4, 0xF9, 0x50, 0x8E, 0xC1, 0x33, 0x01, 0x3E, 0x7B,
+    0xED, 0x87, 0x2E, 0x16, 0x7B, 0xBB, 0xC9, 0x77, 0x3F, 0xFE, 0xC1, 0x61, 0xCA, 0xF6, 0x9E, 0x87,
+    0x29, 0xFB, 0x4D, 0x69, 0x0F, 0x53, 0x76, 0x3F, 0x79, 0xCF, 0x51, 0xED, 0x32, 0xDF, 0xDD, 0xE6,
+    0x63, 0x9C, 0xB6, 0xC7, 0x65, 0xCF, 0xEE, 0x14, 0xD0, 0xE1, 0x6C, 0x40, 0x57, 0x86, 0x62, 0xA2,
+    0x0A, 0x66, 0xA2, 0x5A, 0x1B, 0x9F, 0xA5, 0x93, 0xEB, 0x73, 0x8E, 0xDD, 0x68, 0xFE, 0x71, 0xDA,
+    0x2B, 0x3D, 0xD0, 0x84, 0xE7, 0xD2, 0xC7, 0x9A, 0x9F, 0x45, 0x6D, 0x8D, 0x82, 0xB6, 0x46, 0x5E,
+    0xB1, 0x4E, 0x8C, 0x2B, 0x57, 0xF8, 0x9F, 0xC3, 0x81, 0xF2, 0x9C, 0x9F, 0x0D, 0xD8, 0x1D, 0x52,
+    0x49, 0xBF, 0x73, 0xB6, 0x93, 0x45, 0xBD, 0x83, 0x15, 0x03, 0x47, 0x98, 0x02, 0xDA, 0x1D, 0x6E,
+    0x08, 0x14, 0x4F, 0x6F, 0x4F, 0x71, 0xC0, 0x25, 0xAE, 0x03, 0xE3, 0xDE, 0x9F, 0x33, 0x60, 0xD3,
+    0x28, 0xAA, 0x0D, 0xCD, 0x65, 0xD6, 0x51, 0x3E, 0xD7, 0x65, 0xC8, 0xDB, 0x15, 0x37, 0x57, 0x1B,
+    0x6D, 0x28, 0x45, 0xBB, 0x56, 0x92, 0xD6, 0x5A, 0xD2, 0x72, 0xB6, 0x37, 0xF7, 0x85, 0x8E, 0x47,
+    0xD4, 0xA1, 0x2D, 0x63, 0x7A, 0xCE, 0x53, 0xE4, 0x1E, 0x05, 0x56, 0x1A, 0x7A, 0x6D, 0xD4, 0x4B,
+    0x7E, 0x57, 0xD9, 0xD5, 0x76, 0x6F, 0x6C, 0x48, 0xA9, 0xD2, 0xCD, 0xAD, 0x9D, 0xED, 0xAA, 0xAE,
+    0xF9, 0x41, 0xA4, 0xFF, 0x72, 0x28, 0x37, 0x37, 0x35, 0x61, 0xBC, 0x27, 0xA4, 0xC0, 0xB8, 0xED,
+    0x9C, 0x9B, 0x0B, 0x57, 0x0F, 0x5D, 0xB0, 0x2B, 0x69, 0x7F, 0xE0, 0x55, 0xE0, 0x3F, 0xE8, 0x79,
+    0xCD, 0x54, 0x1B, 0xF2, 0xF9, 0x39, 0x19, 0x59, 0xCD, 0x1A, 0xD1, 0x06, 0x9A, 0x35, 0x68, 0xA0,
+    0xFF, 0xF6, 0x0F, 0x36, 0x4A, 0xD5, 0x9A, 0xB1, 0xB1, 0x49, 0x3B, 0x9C, 0x5D, 0x28, 0xF7, 0x05,
+    0x78, 0x69, 0x05, 0x17, 0xCA, 0x00, 0xF2, 0xA6, 0xDB, 0xE3, 0xF4, 0x33, 0xBD, 0xB5, 0x9B, 0x5D,
+    0x15, 0x2E, 0x87, 0xBE, 0xE2, 0x14, 0x9F, 0x29, 0x5E, 0xA2, 0xD1, 0x27, 0xE5, 0xAD, 0xBE, 0xAD,
+    0xA5, 0xBC, 0xF9, 0x73, 0x25, 0x8C, 0x16, 0x79, 0x14, 0xDA, 0x40, 0xBF, 0xD4, 0x91, 0x66, 0x2D,
+    0x95, 0xBB, 0xB1, 0x9B, 0x84, 0x9B, 0x10, 0x36, 0xD0, 0xFF, 0xE5, 0x17, 0x57, 0xDA, 0xEF, 0xFF,
+    0x64, 0xC3, 0x2E, 0x97, 0x13, 0x26, 0xD5, 0xA2, 0xD0, 0xBD, 0x8C, 0x92, 0x76, 0x99, 0x3C, 0x6B,
+    0x97, 0x87, 0x56, 0x4C, 0xA4, 0xA1, 0x10, 0x66, 0xD8, 0x91, 0xA5, 0x25, 0x13, 0x15, 0xC0, 0x29,
+    0x1E, 0x0A, 0x3B, 0x0F, 0xE1, 0xCB, 0xA1, 0x68, 0x25, 0x67, 0x04, 0x76, 0x28, 0x0D, 0x27, 0x69,
+    0x28, 0xA5, 0xD3, 0xC7, 0x88, 0xEB, 0x3B, 0x57, 0x7F, 0x21, 0xB8, 0x7C, 0xAE, 0xE3, 0xEF, 0xB9,
+    0xCE, 0xC8, 0xBC, 0x7B, 0xC7, 0xDF, 0xF3, 0x5F, 0xFC, 0x05, 0x92, 0x82, 0x0F, 0xEE, 0x1C, 0x3F,
+    0x13, 0xF7, 0x90, 0xB4, 0x1D, 0xC6, 0x0C, 0x45, 0xF9, 0x46, 0x6F, 0x77, 0xD8, 0xE5, 0x4C, 0x0F,
+    0x9A, 0x73, 0xCF, 0xE4, 0x38, 0x90, 0xE7, 0x7B, 0xCF, 0x03, 0x6D, 0xA0, 0xFA, 0xB3, 0x05, 0xA3,
+    0x98, 0x75, 0x68, 0x73, 0x7C, 0x0E, 0x98, 0x95, 0x14, 0x4E, 0x5B, 0x5D, 0x0A, 0xDC, 0x9B, 0x9F,
+    0x5A, 0x29, 0x34, 0xD8, 0x99, 0x7A, 0xC3, 0x75, 0xB9, 0x62, 0x06, 0x79, 0xE3, 0xCF, 0xB6, 0x85,
+    0xBE, 0xA4, 0x1F, 0x5E, 0xD9, 0xDB, 0xA9, 0x9F, 0xDC, 0x4C, 0x5F, 0xE1, 0xDD, 0xDB, 0x42, 0xBF,
+    0x0B, 0x24, 0x9F, 0x9F, 0xB4, 0x37, 0x6A, 0x23, 0x3F, 0xCA, 0x16, 0x38, 0x79, 0x89, 0x13, 0x89,
+    0x51, 0xC9, 0xE8, 0x66, 0xB4, 0x83, 0x0D, 0x17, 0x71, 0xBE, 0x32, 0x89, 0xCB, 0x7D, 0xC0, 0x25,
+    0x2A, 0x4D, 0x8C, 0x1B, 0x75, 0xBA, 0x85, 0x9B, 0xC2, 0x27, 0x44, 0xFD, 0xC5, 0xAD, 0x48, 0x56,
+    0x5A, 0xDA, 0x4C, 0xD5, 0x3C, 0xED, 0x71, 0x3D, 0x97, 0x92, 0x12, 0x8D, 0xA4, 0x19, 0x7B, 0xF7,
+    0xF7, 0x37, 0x0A, 0x75, 0x8D, 0xA7, 0x0D, 0x65, 0x5E, 0xD5, 0xE7, 0xBA, 0x82, 0x9E, 0xC9, 0x90,
+    0x28, 0xEF, 0xE0, 0x6B, 0x1A, 0x0A, 0x0D, 0x6D, 0xA4, 0x5D, 0xF2, 0xFE, 0xCD, 0x19, 0x92, 0x71,
+    0x32, 0x89, 0x3A, 0x66, 0x70, 0xAE, 0xDE, 0xB0, 0xB1, 0xD2, 0x8A, 0xBE, 0x20, 0xCD, 0xCD, 0xE2,
+    0xB4, 0x95, 0xA7, 0x19, 0x92, 0xFA, 0x34, 0x43, 0x92, 0x53, 0x0B, 0x4B, 0xD6, 0xB9, 0x70, 0xF2,
+    0x37, 0xF0, 0xFF, 0x03, 0xD5, 0xBD, 0x4F, 0xAC, 0x25, 0xD7, 0x75, 0xEE, 0xF7, 0xAB, 0xDA, 0x7D,
+    0xBB, 0x24, 0x56, 0xA4, 0xCD, 0x00, 0xA4, 0xA1, 0x47, 0xEA, 0xA9, 0x3C, 0x50, 0x00, 0x45, 0xFF,
+    0x2A, 0x83, 0x87, 0x40, 0x03, 0x99, 0xBB, 0x48, 0xC2, 0xE0, 0x40, 0x03, 0x5D, 0x3F, 0xF4, 0x91,
+    0xE2, 0x27, 0x24, 0xF4, 0x40, 0x01, 0x2C, 0x19, 0x41, 0x6B, 0xA0, 0x00, 0x0E, 0x20, 0xB2, 0x8A,
+    0x24, 0x02, 0x01, 0xD1, 0x40, 0x8D, 0xC0, 0xF2, 0x43, 0xE0, 0x00, 0x6A, 0x04, 0x34, 0x60, 0x5D,
+    0x0E, 0xA8, 0x81, 0x11, 0x18, 0x06, 0xD9, 0xB5, 0xC9, 0x06, 0x22, 0xC0, 0x1C, 0xB0, 0x48, 0x42,
+    0xE1, 0xC0, 0x03, 0x15, 0x45, 0x4A, 0x8E, 0xC5, 0x41, 0x6F, 0x4A, 0x45, 0xAA, 0xBA, 0x7B, 0x57,
+    0x7D, 0x19, 0xEC, 0x3A, 0xE7, 0xDE, 0xA6, 0xC8, 0x67, 0xD9, 0x96, 0x6C, 0xBD, 0xC3, 0xE6, 0x39,
+    0xF7, 0x9E, 0x7B, 0x4E, 0xD5, 0xAE, 0xB5, 0xD7, 0x5E, 0x7B, 0xAD, 0x6F, 0x7D, 0x6B, 0x15, 0x80,
+    0x93, 0xA2, 0x93, 0xE2, 0xDD, 0xFA, 0x5C, 0x34, 0x0B, 0xD1, 0x44, 0xA6, 0x22, 0x72, 0xA9, 0x98,
+    0xA1, 0xBC, 0x7E, 0x01, 0x2B, 0x75, 0x56, 0x1A, 0xAB, 0x37, 0xDB, 0xA9, 0x1E, 0xED, 0xEC, 0x86,
+    0x22, 0xBA, 0xC1, 0xC4, 0xD6, 0x9B, 0xD8, 0x7B, 0x13, 0xD5, 0x14, 0x11, 0xCA, 0x19, 0x6C, 0x80,
+    0x6A, 0x34, 0x8D, 0xF3, 0xF6, 0x47, 0x6A, 0xAC, 0x16, 0x4A, 0x05, 0xB2, 0x93, 0x06, 0xB2, 0x63,
+    0x00, 0x2E, 0x60, 0x44, 0xA5, 0x29, 0x93, 0x47, 0xA1, 0x54, 0xCC, 0x34, 0xE1, 0x96, 0x4C, 0xD7,
+    0x33, 0x45, 0x6C, 0xEF, 0xCB, 0x19, 0xF5, 0x64, 0x66, 0x32, 0x0B, 0xCA, 0x80, 0x2B, 0x88, 0x1E,
+    0xC0, 0xFA, 0xD6, 0xB7, 0x0D, 0x60, 0xA6, 0x7A, 0x74, 0x0D, 0xC0, 0x95, 0x72, 0xAA, 0x3B, 0x80,
+    0xEA, 0xEA, 0x62, 0x3D, 0x40, 0x29, 0x69, 0x00, 0x28, 0x24, 0xCD, 0x00, 0xC5, 0x7A, 0xF1, 0x2D,
+    0x01, 0x18, 0xD9, 0xC9, 0x0D, 0x80, 0x91, 0x89, 0x65, 0x04, 0x8C, 0x1A, 0x65, 0x02, 0x72, 0x75,
+    0xAD, 0x77, 0x23, 0xE4, 0xF2, 0xF5, 0x58, 0x46, 0xC8, 0x35, 0xD8, 0x09, 0x79, 0x8C, 0x06, 0x13,
+    0xA9, 0x67, 0x0A, 0x8D, 0xE7, 0x35, 0x18, 0x35, 0x85, 0xC6, 0x52, 0x91, 0x7E, 0xA6, 0x1F, 0x8C,
+    0x44, 0xA9, 0x26, 0x03, 0x00, 0xE7, 0xD3, 0x2B, 0x76, 0xDC, 0x7E, 0x28, 0xA6, 0xED, 0x87, 0x2C,
+    0x6E, 0x3F, 0xF0, 0xF4, 0xFE, 0x87, 0x7A, 0xFF, 0xC3, 0xF9, 0x06, 0xCE, 0x5F, 0xE2, 0x02, 0x77,
+    0x51, 0xC8, 0xBB, 0xAE, 0x8E, 0x99, 0x16, 0x33, 0x95, 0x1A, 0x5A, 0x85, 0x36, 0x57, 0x2C, 0x7F,
+    0xAC, 0x32, 0xB4, 0xF7, 0x75, 0x5F, 0xB5, 0x61, 0xB5, 0x03, 0xD0, 0xBB, 0x97, 0x66, 0xA0, 0x54,
+    0xEC, 0x01, 0x7A, 0xFD, 0x20, 0x00, 0x56, 0x5A, 0x01, 0xE4, 0x34, 0x00, 0xD5, 0xF7, 0xD6, 0x05,
+    0x30, 0x53, 0xFF, 0xED, 0xE1, 0x5C, 0xC6, 0x15, 0xFB, 0x86, 0xF2, 0xF0, 0x3B, 0xAD, 0x5F, 0xEC,
+    0xBA, 0x96, 0x0A, 0x95, 0x97, 0x86, 0x7E, 0xC9, 0x63, 0xA9, 0xA7, 0x8B, 0x15, 0xD7, 0xD4, 0x7F,
+    0xE7, 0x8F, 0xC8, 0xE0, 0xF6, 0x6D, 0x84, 0x76, 0x48, 0xAF, 0xEB, 0x2D, 0xBF, 0x16, 0xE9, 0x42,
+    0x32, 0xA5, 0x77, 0x8F, 0x1A, 0xE0, 0xE8, 0x18, 0x6A, 0xCD, 0x18, 0x29, 0x52, 0x49, 0x91, 0xBE,
+    0x69, 0x83, 0x99, 0xE8, 0x07, 0xEB, 0x73, 0x35, 0x9F, 0xA0, 0x8C, 0x40, 0x12, 0x30, 0xDC, 0xD9,
+    0x06, 0x90, 0xA0, 0x90, 0xE0, 0x2E, 0x09, 0xA8, 0x17, 0xC0, 0xCD, 0x40, 0x3F, 0xBE, 0x87, 0x4C,
+    0x8F, 0x4C, 0x94, 0x8B, 0x0D, 0xB4, 0xC1, 0x4D, 0x77, 0xAB, 0x91, 0x34, 0x21, 0xA9, 0xA1, 0xD7,
+    0xB0, 0x49, 0xD3, 0x04, 0xC0, 0x7A, 0xF8, 0x5F, 0xAE, 0x40, 0xAE, 0x09, 0x4A, 0x35, 0x70, 0xDB,
+    0x25, 0x80, 0xEC, 0x3B, 0x50, 0x6B, 0x44, 0x9A, 0xF3, 0xF5, 0xC1, 0x68, 0x82, 0x89, 0x59, 0x67,
+    0x22, 0x14, 0x33, 0xD4, 0x23, 0x56, 0x0D, 0x56, 0x03, 0xB7, 0xF5, 0x01, 0xEC, 0x04, 0x76, 0xAE,
+    0xB0, 0x93, 0xEB, 0xEA, 0xE0, 0x6E, 0x6A, 0xA8, 0xA5, 0xA6, 0xD0, 0x04, 0x77, 0x7B, 0x28, 0x3C,
+    0x79, 0xE9, 0x29, 0xE5, 0x29, 0xD5, 0x61, 0x56, 0x4E, 0x1F, 0x47, 0x0D, 0x4E, 0x31, 0x93, 0xCF,
+    0xA5, 0xB1, 0x16, 0x85, 0xD6, 0x5C, 0x11, 0xD4, 0x55, 0x37, 0x47, 0x8A, 0xA4, 0xC3, 0x75, 0x28,
+    0x03, 0x20, 0xDF, 0x26, 0xED, 0x9B, 0x80, 0x6A, 0xAE, 0x3D, 0xD0, 0x0E, 0x11, 0xC8, 0xA5, 0x31,
+    0x4D, 0xA0, 0x07, 0xDC, 0x5B, 0x6A, 0x20, 0xD3, 0x63, 0x2B, 0x50, 0x2E, 0x45, 0x04, 0x5C, 0xB0,
+    0x33, 0x20, 0x5F, 0x07, 0x30, 0x2B, 0xED, 0x08, 0xD5, 0x84, 0x06, 0xE8, 0x7D, 0x2E, 0x4F, 0xA5,
+    0xD1, 0xA8, 0xCB, 0xA5, 0xB1, 0x50, 0x67, 0xA5, 0xA6, 0x50, 0x07, 0x60, 0xD2, 0x7C, 0xD9, 0x90,
+    0x34, 0xB4, 0x39, 0xA3, 0x8C, 0x45, 0xD2, 0xD2, 0x2A, 0x5D, 0xC9, 0x87, 0x81, 0x3F, 0xE4, 0xB6,
+    0x5C, 0x63, 0x19, 0xB5, 0x1A, 0xFD, 0x4D, 0x3F, 0x2A, 0xE6, 0x8B, 0x7B, 0xA5, 0x71, 0xCF, 0x05,
+    0xCC, 0x1C, 0xA1, 0x6D, 0xA1, 0xBC, 0x19, 0x40, 0x6A, 0xB0, 0x8A, 0x64, 0xAA, 0x07, 0xAA, 0x37,
+    0x56, 0xF2, 0xD5, 0x4E, 0x9F, 0x72, 0x63, 0x7F, 0xED, 0xEA, 0x62, 0x34, 0xB7, 0xBE, 0xD6, 0x37,
+    0x66, 0xD6, 0x19, 0xB2, 0xAA, 0xDB, 0xCE, 0x57, 0x79, 0xC8, 0x67, 0xC8, 0xFA, 0x06, 0xDC, 0x00,
+    0x1C, 0x6F, 0x32, 0x3C, 0xC6, 0x6A, 0xA5, 0x5C, 0xA8, 0xB5, 0xE0, 0x56, 0x2A, 0x4D, 0x68, 0x01,
+    0x35, 0x46, 0x4F, 0x91, 0x89, 0x72, 0x3A, 0x47, 0x2E, 0xEC, 0x00, 0x66, 0xFD, 0xB4, 0xEB, 0xC0,
+    0xAC, 0x9F, 0x6E, 0x81, 0x62, 0xF9, 0xE3, 0x05, 0x28, 0xE2, 0xFF, 0x9D, 0x96, 0x83, 0xB6, 0x65,
+    0x30, 0x01, 0xF6, 0xFA, 0xCD, 0x19, 0xA8, 0xDE, 0x7C, 0x35, 0x02, 0xF5, 0x4F, 0x5F, 0x5C, 0x01,
+    0xF7, 0xD3, 0x17, 0x04, 0xB8, 0x1F, 0x76, 0xEA, 0xC0, 0x0D, 0xC8, 0x43, 0xEB, 0x69, 0x47, 0xE8,
+    0x3D, 0x6E, 0xA2, 0xD0, 0x4C, 0x1D, 0xA9, 0xB5, 0x60, 0xD5, 0x38, 0x45, 0x8C, 0x1A, 0x00, 0x6E,
+    0x27, 0xFB, 0x22, 0x7C, 0xB1, 0x5E, 0x31, 0x8B, 0x56, 0xEC, 0xF2, 0xC4, 0x8A, 0x8B, 0xF9, 0x42,
+    0xFF, 0x01, 0xB3, 0xFC, 0xDE, 0x8C, 0x89, 0x3F, 0x1B, 0x29, 0xE2, 0xEB, 0x9E, 0x72, 0x55, 0x97,
+    0x26, 0xD3, 0xFE, 0xFC, 0x07, 0x03, 0xD5, 0xCF, 0xBE, 0x39, 0x52, 0xFD, 0xFC, 0x1B, 0x81, 0xFA,
+    0x95, 0x62, 0xFE, 0xB8, 0x1B, 0xCC, 0x1A, 0xDD, 0x90, 0x6B, 0x6E, 0x3D, 0x0A, 0x7D, 0x47, 0xDB,
+    0x01, 0xE7, 0x36, 0x43, 0xD1, 0xE0, 0x14, 0x49, 0x0A, 0x55, 0xA9, 0x2B, 0xB4, 0x26, 0x61, 0x74,
+    0x76, 0x0D, 0x14, 0x0B, 0xFD, 0xBD, 0x4D, 0x21, 0x3D, 0x30, 0x41, 0xAD, 0xE8, 0x3A, 0xF8, 0xBC,
+    0xFE, 0x7D, 0x04, 0xAA, 0xD9, 0x26, 0x85, 0x7A, 0xFA, 0x5D, 0x15, 0xEA, 0xFE, 0x5B, 0x15, 0x6A,
+    0xBA, 0x45, 0xA1, 0x86, 0xA4, 0x50, 0xFE, 0x5D, 0x15, 0xAA, 0x5C, 0xF7, 0x03, 0xE4, 0x62, 0x07,
+    0xFD, 0x02, 0x56, 0x03, 0x7C, 0x3E, 0x6E, 0xA6, 0xCF, 0x44, 0xA0, 0xED, 0xCE, 0xDF, 0x27, 0x3D,
+    0xBA, 0xD6, 0x9A, 0x34, 0xDA, 0xE0, 0x16, 0x56, 0x3B, 0x75, 0xD5, 0x8B, 0x33, 0x79, 0x7C, 0x18,
+    0xDC, 0xF3, 0x1D, 0x46, 0x33, 0xB4, 0xF2, 0x94, 0x5A, 0x40, 0xDF, 0x0C, 0xD8, 0x49, 0x0D, 0x7A,
+    0x20, 0x7E, 0xB0, 0x0A, 0xEE, 0xE6, 0x8B, 0xCA, 0x15, 0x5D, 0xB0, 0x32, 0x0B, 0xAD, 0x07, 0x9A,
+    0xBD, 0x64, 0x7A, 0x69, 0xCE, 0x74, 0x55, 0xD2, 0x50, 0xE9, 0xB3, 0xD2, 0x92, 0x69, 0x69, 0x7F,
+    0x4F, 0x9D, 0xBD, 0xF9, 0xD3, 0x58, 0x2E, 0x28, 0x2B, 0xC7, 0x3A, 0x94, 0x13, 0x35, 0xF2, 0xAE,
+    0xE1, 0x23, 0x66, 0x35, 0x33, 0x50, 0x4D, 0xB5, 0x07, 0xFA, 0x17, 0x92, 0xCD, 0xBF, 0x45, 0x32,
+    0x3F, 0x16, 0xA7, 0x92, 0x49, 0xBB, 0xC2, 0x41, 0x32, 0x2E, 0x40, 0x91, 0x24, 0x53, 0x9F, 0x4A,
+    0xA6, 0xDB, 0x24, 0x63, 0xA4, 0xA1, 0x54, 0x67, 0x25, 0xF6, 0x92, 0x01, 0xBE, 0x73, 0x81, 0x7F,
+    0x93, 0x49, 0x9D, 0x1B, 0xA5, 0xA1, 0x8D, 0x4F, 0x7F, 0x21, 0xB4, 0xAB, 0x33, 0xD1, 0xBD, 0x68,
+    0x87, 0xD5, 0xF9, 0x7C, 0x6E, 0x2F, 0x76, 0x50, 0xFF, 0xC0, 0x83, 0x55, 0x00, 0xA3, 0x08, 0x99,
+    0xD4, 0x41, 0xFF, 0x7C, 0x00, 0xF7, 0xC3, 0x05, 0xEC, 0xD4, 0x3E, 0x33, 0x14, 0xD1, 0xAE, 0x73,
+    0xA6, 0x4C, 0x91, 0xDE, 0xBB, 0x05, 0x37, 0x98, 0x25, 0x69, 0x21, 0x56, 0xCA, 0xA5, 0x21, 0x97,
+    0x46, 0xA7, 0x48, 0xA5, 0x39, 0xD7, 0xDA, 0x60, 0x23, 0xB9, 0x1A, 0x32, 0x75, 0xB8, 0x00, 0xF5,
+    0x84, 0x11, 0x18, 0x41, 0x3B, 0x82, 0x0B, 0x94, 0x0B, 0x14, 0x2B, 0xF4, 0x1E, 0xDA, 0x11, 0x1B,
+    0xD3, 0x76, 0x29, 0x0F, 0x4A, 0xBB, 0xA5, 0x95, 0xF4, 0xCE, 0x87, 0x70, 0xE9, 0x10, 0xC5, 0x92,
+    0x7E, 0xED, 0x87, 0xD3, 0x43, 0x2C, 0x20, 0x4F, 0xA1, 0xEB, 0xF4, 0xFB, 0x41, 0x09, 0xA7, 0xA5,
+    0x48, 0x92, 0x86, 0x34, 0xF0, 0xC3, 0xF6, 0x68, 0xE6, 0xED, 0xD7, 0x6D, 0x8B, 0x4C, 0x96, 0x89,
+    0x87, 0xD2, 0x4B, 0xDE, 0xC1, 0x17, 0x39, 0x6A, 0x6A, 0xE1, 0x46, 0x09, 0x37, 0x3E, 0x21, 0xDC,
+    0x90, 0xAF, 0xB4, 0xDE, 0x2C, 0xF4, 0xDE, 0x2C, 0xA8, 0x2B, 0x96, 0x9D, 0x9A, 0x52, 0x12, 0x56,
+    0x12, 0xF6, 0xC6, 0x13, 0x2B, 0x55, 0x30, 0x0B, 0x55, 0x30, 0x91, 0x3A, 0x14, 0xF1, 0xD3, 0x6E,
+    0x2C, 0xD7, 0xE8, 0x86, 0x52, 0x53, 0xEB, 0x4B, 0x85, 0xBE, 0x33, 0xD7, 0x03, 0x70, 0xDF, 0x04,
+    0x98, 0x5B, 0x9F, 0xAA, 0x00, 0x49, 0xD5, 0xEE, 0xDC, 0x4B, 0x57, 0x81, 0x5E, 0xB3, 0x95, 0xE4,
+    0x33, 0xA9, 0xAB, 0x25, 0x6D, 0x32, 0x2C, 0xE6, 0x4D, 0x3E, 0x76, 0xD8, 0xAE, 0xBD, 0x4D, 0xA2,
+    0x59, 0xB3, 0x19, 0xE4, 0xA9, 0xA7, 0xF3, 0xDD, 0x41, 0xCE, 0x54, 0x33, 0x46, 0x69, 0x93, 0x4E,
+    0x0E, 0x89, 0x91, 0x0E, 0x2A, 0x28, 0x35, 0x1C, 0x04, 0x49, 0xAE, 0x06, 0x17, 0x00, 0x1B, 0x41,
+    0x1D, 0x07, 0x89, 0x6F, 0x87, 0x25, 0x4D, 0x9F, 0x3C, 0x87, 0xA9, 0xD9, 0xC4, 0xDE, 0xB1, 0x8D,
+    0x16, 0x8C, 0x34, 0xB4, 0x8A, 0x00, 0x5F, 0xE4, 0x68, 0xD7, 0x94, 0xF2, 0x56, 0xFA, 0xAC, 0x82,
+    0x91, 0x7E, 0xFA, 0x64, 0x44, 0x8A, 0xF9, 0x4A, 0xEB, 0x1D, 0x6A, 0xEA, 0xD0, 0x36, 0x6E, 0xB0,
+    0x73, 0xEB, 0xAB, 0x37, 0x3F, 0xBF, 0x9C, 0x4F, 0x02, 0xC5, 0x6C, 0x2A, 0x71, 0xD2, 0x8F, 0xD0,
+    0x7A, 0x3B, 0x91, 0xA4, 0x4A, 0x19, 0x33, 0xBD, 0x17, 0xB3, 0xD2, 0x5F, 0xEB, 0x50, 0x53, 0x6B,
+    0xA0, 0xF5, 0xA5, 0x46, 0xEA, 0x31, 0x0D, 0x97, 0x23, 0xF6, 0xD7, 0x25, 0xC8, 0xB5, 0x5D, 0x69,
+    0xB5, 0x69, 0x17, 0x76, 0xD9, 0x5D, 0x9C, 0x81, 0x4C, 0x4D, 0xA6, 0x2E, 0x5D, 0x45, 0x3D, 0x01,
+    0x46, 0x9B, 0x90, 0x5C, 0x48, 0x12, 0x28, 0xD6, 0x6D, 0x9B, 0x6D, 0x07, 0xDA, 0x1F, 0x3D, 0x0E,
+    0x65, 0xA4, 0x94, 0x92, 0x80, 0x25, 0x05, 0x6C, 0xC4, 0xAE, 0x17, 0xE5, 0x33, 0x75, 0x99, 0xBA,
+    0x6A, 0xD9, 0x8E, 0xD5, 0x8F, 0x46, 0xE4, 0xA2, 0xD0, 0x76, 0x2C, 0x17, 0xCC, 0xBA, 0x1D, 0xBF,
+    0x1D, 0x69, 0x47, 0x5C, 0x28, 0x17, 0xCA, 0x05, 0xB3, 0x16, 0x9A, 0x72, 0x5D, 0xA7, 0x7D, 0x51,
+    0xF2, 0xD2, 0x58, 0x46, 0xA7, 0xD9, 0x6A, 0xD9, 0xAE, 0x05, 0xEA, 0x4D, 0x33, 0xB7, 0x0D, 0xFF,
+    0x7D, 0x49, 0xF2, 0x98, 0x1B, 0xFD, 0xB6, 0x99, 0x26, 0x31, 0x63, 0xB4, 0x29, 0xF8, 0xF9, 0xBF,
+    0x87, 0xEC, 0x8B, 0x7C, 0x09, 0x72, 0x8D, 0xED, 0x0C, 0x5A, 0x6B, 0x79, 0x6E, 0xEB, 0x5F, 0x57,
+    0x84, 0x7C, 0x9D, 0x7B, 0x0F, 0x6E, 0x2D, 0x23, 0x18, 0x75, 0xEA, 0xA0, 0x0D, 0xF6, 0xC6, 0x4A,
+    0xB9, 0x66, 0xD2, 0x82, 0x7C, 0x2D, 0x05, 0x3B, 0xE7, 0xBA, 0x57, 0x8F, 0x08, 0x37, 0x96, 0xB1,
+    0x0A, 0x66, 0xC1, 0x3D, 0x9B, 0x94, 0xDF, 0x8D, 0x65, 0xC4, 0xBD, 0xB4, 0x20, 0x6F, 0x62, 0xEB,
+    0xED, 0x8C, 0x7B, 0x6E, 0x46, 0xCD, 0xB6, 0xC5, 0xF7, 0xDD, 0xE9, 0x46, 0x9F, 0xAD, 0x40, 0x91,
+    0x74, 0x7A, 0xBD, 0x18, 0x80, 0x2A, 0x0D, 0x36, 0x79, 0x88, 0xD9, 0x77, 0x00, 0xB2, 0x0B, 0xC9,
+    0x51, 0x1E, 0x36, 0x3D, 0x02, 0xA3, 0x31, 0x7B, 0x1C, 0x34, 0x1A, 0xCD, 0xB8, 0x39, 0x93, 0x42,
+    0xB9, 0xD2, 0xFE, 0x58, 0xF7, 0xCA, 0xDB, 0x50, 0xCE, 0x6E, 0xCA, 0x57, 0xFA, 0xAB, 0xC2, 0xF9,
+    0x22, 0xB6, 0x63, 0x11, 0xE9, 0x9F, 0x5B, 0xE8, 0xBB, 0x72, 0x96, 0xB7, 0x13, 0xFA, 0x6C, 0x44,
+    0x8D, 0x0D, 0xF2, 0x76, 0xCA, 0x64, 0x23, 0x6A, 0xDC, 0xA0, 0xC1, 0xCE, 0x65, 0x2C, 0x57, 0x7A,
+    0xAF, 0xA6, 0x0D, 0x66, 0x71, 0xA3, 0x91, 0x77, 0x9A, 0xA9, 0xD4, 0x68, 0xE5, 0xB8, 0x97, 0x74,
+    0x63, 0xCD, 0x24, 0x49, 0x3E, 0x97, 0xBE, 0xAD, 0x11, 0xEE, 0xE0, 0xA8, 0x81, 0xEC, 0x0A, 0x60,
+    0x34, 0x40, 0xB1, 0x72, 0x07, 0x66, 0xC9, 0x35, 0x98, 0xC5, 0x68, 0xC9, 0x97, 0x7C, 0xE9, 0xBD,
+    0xB2, 0x68, 0x43, 0xDB, 0xAD, 0x79, 0xAC, 0xBD, 0x6B, 0x64, 0x43, 0xE5, 0xDD, 0xD5, 0x58, 0x04,
+    0x3B, 0x28, 0x8B, 0x65, 0x70, 0x83, 0xBB, 0x7F, 0x2A, 0x67, 0xFB, 0xB3, 0x39, 0xD3, 0xBD, 0x9A,
+    0x71, 0xD7, 0xDB, 0xF9, 0xC8, 0x48, 0x52, 0x53, 0xEB, 0x9A, 0x3A, 0xEE, 0xE0, 0x4E, 0x80, 0x1D,
+    0x70, 0xB7, 0xD6, 0x06, 0x27, 0x4D, 0xB4, 0x52, 0xA4, 0x5F, 0xEF, 0x15, 0xED, 0x44, 0xED, 0x5D,
+    0xA0, 0x1C, 0xDD, 0x84, 0x09, 0xD5, 0x0C, 0xC7, 0x76, 0x49, 0xEA, 0x0A, 0x49, 0x83, 0xFB, 0x71,
+    0xEF, 0xB7, 0xDA, 0x15, 0x30, 0xEA, 0x00, 0x05, 0xA0, 0x8E, 0xF0, 0x9E, 0x52, 0x9E, 0x0A, 0x2D,
+    0x5C, 0xF4, 0x4E, 0x52, 0x30, 0x92, 0x02, 0x4E, 0x1A, 0x37, 0xAB, 0x4F, 0x3C, 0x84, 0x02, 0xD6,
+    0x83, 0xF9, 0xB3, 0x00, 0x99, 0xE6, 0xFD, 0x41, 0xCF, 0x5F, 0x06, 0xE0, 0xAE, 0x06, 0xBB, 0x37,
+    0x44, 0x6B, 0xA6, 0xFB, 0x82, 0x9D, 0x68, 0x7A, 0x8F, 0x59, 0x92, 0xF1, 0xEA, 0x3D, 0x66, 0x05,
+    0x3B, 0x83, 0x0B, 0x74, 0xF2, 0xD5, 0xFD, 0x7A, 0x7D, 0x29, 0xA4, 0x60, 0xB5, 0x52, 0xEA, 0x12,
+    0x79, 0x80, 0xC2, 0xF3, 0x9E, 0x1A, 0xFA, 0x48, 0xAE, 0xF1, 0xE0, 0xC6, 0xD6, 0x92, 0x74, 0x55,
+    0x4A, 0x41, 0xA0, 0xF4, 0xBD, 0xEB, 0x0F, 0x2E, 0x9F, 0x9F, 0x7B, 0xE4, 0xDD, 0x67, 0xC6, 0x6A,
+    0x36, 0xE1, 0xE9, 0x5C, 0xCD, 0xC3, 0x79, 0xE7, 0xC2, 0xF9, 0x6E, 0xBF, 0x4A, 0xC7, 0xCD, 0x14,
+    0xA5, 0x8D, 0x20, 0x59, 0xAF, 0xB4, 0x3A, 0xAA, 0x79, 0x33, 0x64, 0x1C, 0x56, 0x76, 0x5A, 0xD6,
+    0xDB, 0x17, 0xCE, 0x6B, 0x6D, 0xC8, 0xA5, 0x19, 0x5C, 0xB2, 0x7E, 0x49, 0x61, 0x57, 0x80, 0x6A,
+    0x38, 0x38, 0xA7, 0x75, 0x07, 0xE4, 0x01, 0xE0, 0x2E, 0x20, 0xFB, 0x22, 0x5F, 0xE4, 0xDF, 0x50,
+    0x2F, 0x85, 0x72, 0x79, 0xAD, 0xB5, 0xAC, 0x86, 0x27, 0x96, 0x5E, 0xAD, 0xC6, 0x7C, 0x9D, 0xF5,
+    0xB4, 0x1B, 0x8C, 0x06, 0x4D, 0x6E, 0x30, 0xEA, 0x34, 0xB4, 0xBE, 0x50, 0x26, 0xDF, 0xFA, 0x72,
+    0xC9, 0xD5, 0xA8, 0xB3, 0xD1, 0x08, 0x35, 0x76, 0x36, 0x4B, 0x26, 0xAA, 0x50, 0xC4, 0x5C, 0x54,
+    0xA1, 0x8C, 0x66, 0xA5, 0x1E, 0xED, 0x6C, 0x96, 0xDF, 0x71, 0x83, 0x9D, 0x8C, 0x9E, 0x76, 0x43,
+    0x15, 0x0A, 0xC5, 0xD6, 0x57, 0xA1, 0xD0, 0xDC, 0x77, 0xF5, 0x60, 0x96, 0xB4, 0x5F, 0xFD, 0x97,
+    0xE9, 0x25, 0x8F, 0x67, 0x5F, 0xB6, 0xBD, 0xEC, 0xEE, 0xCD, 0x20, 0xA4, 0x10, 0xE9, 0x88, 0x5A,
+    0xD1, 0x6A, 0x96, 0xC6, 0x56, 0x3F, 0xD4, 0x42, 0xBB, 0x20, 0x4F, 0xDF, 0xE5, 0xA2, 0x88, 0x14,
+    0x0B, 0xCE, 0x63, 0x63, 0xBE, 0x40, 0x1D, 0xAA, 0x11, 0xDA, 0x41, 0x80, 0x9E, 0x0F, 0x90, 0xAB,
+    0x6F, 0x48, 0x1E, 0x12, 0x36, 0x49, 0x34, 0x92, 0xF6, 0x88, 0xBD, 0x5C, 0xCB, 0x78, 0x10, 0x69,
+    0x92, 0x79, 0xB1, 0x02, 0x59, 0xBF, 0x36, 0x50, 0x4B, 0x40, 0xB2, 0xB6, 0xD9, 0x1F, 0xF0, 0x87,
+    0xA5, 0xD0, 0xCB, 0x1A, 0xAB, 0xEB, 0x8A, 0x46, 0x99, 0xE8, 0x3B, 0x37, 0xD4, 0x83, 0x9D, 0x6C,
+    0xC8, 0x57, 0x13, 0x69, 0x1F, 0x59, 0xA8, 0x82, 0x30, 0xB1, 0x05, 0xB9, 0x0E, 0x77, 0xCD, 0x63,
+    0xE5, 0xC9, 0x35, 0xA4, 0xB9, 0xAD, 0x87, 0x34, 0x43, 0x26, 0x6E, 0x46, 0xA5, 0x6F, 0xD2, 0x46,
+    0x6E, 0x43, 0xF2, 0xE1, 0x9C, 0x02, 0x47, 0xBB, 0x0B, 0xFC, 0x2A, 0xAF, 0xD9, 0xEE, 0xF5, 0x63,
+    0x84, 0xCF, 0xE9, 0x5B, 0xFF, 0xC2, 0xD7, 0x5C, 0x49, 0xBE, 0x94, 0x02, 0xC5, 0x3F, 0x78, 0xCD,
+    0xDB, 0x45, 0x23, 0x8D, 0xAD, 0x86, 0x5C, 0x0B, 0xED, 0x75, 0xE8, 0x47, 0xD4, 0x80, 0xBC, 0x9D,
+    0x20, 0x57, 0x97, 0xAE, 0xAE, 0x9C, 0x81, 0x72, 0x69, 0x3B, 0xC0, 0x26, 0x68, 0xA2, 0x4E, 0x1B,
+    0x8A, 0x4B, 0xBA, 0x94, 0x70, 0x8B, 0x32, 0xBD, 0xD7, 0xAB, 0x01, 0x8A, 0x9B, 0x02, 0x68, 0xBF,
+    0x91, 0xA2, 0x1C, 0x9B, 0x3C, 0x6D, 0x37, 0x81, 0x59, 0x68, 0x43, 0x8A, 0x60, 0x06, 0x4A, 0x5D,
+    0x2A, 0xF4, 0xFF, 0x21, 0x0D, 0xD2, 0x5C, 0x48, 0x07, 0xCF, 0xAB, 0xE7, 0x6C, 0x08, 0x38, 0x9E,
+    0x75, 0xBB, 0x36, 0xFD, 0x4D, 0x1A, 0x7B, 0x5B, 0x42, 0x21, 0xBE, 0x88, 0x9B, 0x32, 0x79, 0xA7,
+    0x4C, 0xA1, 0xD2, 0xA0, 0x19, 0x3B, 0xF7, 0x1F, 0x20, 0x53, 0x0B, 0xB8, 0xE4, 0x6E, 0x34, 0x9C,
+    0xFA, 0x26, 0x9B, 0x72, 0x5A, 0x75, 0x9B, 0x3B, 0x5B, 0xFE, 0x6C, 0xFD, 0x90, 0xB9, 0x16, 0xFA,
+    0x6B, 0x8F, 0x68, 0xAA, 0x34, 0xB4, 0xB3, 0x51, 0xB0, 0x33, 0xED, 0x53, 0x1C, 0x93, 0xD5, 0xCD,
+    0x1E, 0x45, 0x30, 0x13, 0xC0, 0xB2, 0x87, 0x11, 0x12, 0x96, 0x70, 0x67, 0xC2, 0x6C, 0x06, 0xC9,
+    0xF7, 0x52, 0xAC, 0x15, 0xAD, 0xA4, 0x67, 0xB4, 0x12, 0xDD, 0x2B, 0xD1, 0x88, 0xEA, 0xEA, 0x52,
+    0x75, 0x6E, 0xCC, 0x26, 0xF7, 0xCC, 0x54, 0xAC, 0xD8, 0x22, 0x7E, 0x92, 0x76, 0x80, 0xDE, 0x53,
+    0xC6, 0x64, 0xFC, 0xE4, 0x41, 0x0D, 0x76, 0x86, 0x2A, 0x90, 0xA9, 0x21, 0x57, 0xDA, 0xC7, 0xEB,
+    0x91, 0x5C, 0x69, 0x2B, 0x77, 0x49, 0x6E, 0x66, 0x4D, 0x60, 0xC6, 0xBB, 0x1C, 0x22, 0x82, 0x9D,
+    0xC8, 0xD4, 0x25, 0x1F, 0x59, 0x5D, 0x21, 0x49, 0x5A, 0xE9, 0xA5, 0x3D, 0xC6, 0xB4, 0x97, 0x2C,
+    0xAE, 0xBB, 0x05, 0xED, 0x69, 0xD3, 0x4B, 0xB9, 0x01, 0x28, 0x4F, 0x6D, 0xDE, 0x41, 0x07, 0xF9,
+    0xC9, 0x49, 0x87, 0x91, 0x3C, 0x85, 0xE4, 0xC9, 0x76, 0xBB, 0x33, 0x58, 0x02, 0xBF, 0x4F, 0x76,
+    0xA1, 0x52, 0x63, 0x27, 0xA7, 0xAE, 0x0E, 0x1F, 0x55, 0x57, 0x07, 0xD4, 0xB8, 0x11, 0xE1, 0x86,
+    0x4C, 0xB4, 0x3E, 0x5F, 0x0F, 0x1E, 0x70, 0xCC, 0xD4, 0x94, 0xD1, 0x08, 0x3B, 0x95, 0xC2, 0x86,
+    0x4A, 0x54, 0xE1, 0x61, 0x7D, 0xA8, 0x7A, 0x2B, 0xEA, 0x4A, 0xA5, 0xA0, 0x58, 0xC9, 0x2B, 0x96,
+    0x2B, 0x4F, 0x3F, 0xC5, 0x31, 0xB7, 0xC7, 0xC3, 0xAC, 0xC7, 0xBD, 0x95, 0x2D, 0x27, 0xA0, 0x1E,
+    0x81, 0x23, 0x5A, 0x4D, 0xAD, 0x6E, 0x4A, 0x57, 0xA5, 0x97, 0xB5, 0x14, 0x5A, 0x32, 0x35, 0xB9,
+    0x9A, 0x32, 0x62, 0xE3, 0xE6, 0x4A, 0xC9, 0xA3, 0xCE, 0xAC, 0x14, 0x2B, 0xD5, 0x4C, 0x3D, 0xD1,
+    0xA6, 0xF7, 0x46, 0x23, 0x8C, 0xA4, 0x39, 0x4D, 0x20, 0x45, 0xF2, 0x6B, 0xBF, 0xF4, 0xD9, 0xD3,
+    0x45, 0x9B, 0x36, 0xCB, 0x72, 0x79, 0xDB, 0x2A, 0xBE, 0xA8, 0x19, 0x0A, 0x29, 0x40, 0x9D, 0x02,
+    0xB2, 0x7C, 0x39, 0x75, 0x62, 0x92, 0x54, 0x17, 0xF6, 0x58, 0x0F, 0xB6, 0x03, 0xF8, 0x48, 0x72,
+    0x6D, 0x9B, 0x7E, 0xCA, 0x54, 0x6A, 0xB0, 0xF3, 0x47, 0x85, 0x1B, 0x4C, 0xCC, 0x84, 0x0D, 0x45,
+    0xA4, 0xED, 0xEA, 0x31, 0x5F, 0x32, 0x35, 0xE5, 0x6C, 0x23, 0xF5, 0xCD, 0xB4, 0xE1, 0x7A, 0xDA,
+    0x57, 0x57, 0x12, 0xD6, 0x83, 0xBB, 0xEA, 0xC9, 0xD4, 0x43, 0xA9, 0x09, 0x2A, 0x79, 0x70, 0xDF,
+    0x06, 0x6E, 0x5F, 0xF6, 0xDA, 0x69, 0x87, 0x0D, 0x2D, 0x29, 0xE2, 0x3E, 0x36, 0xB8, 0x40, 0xAB,
+    0xC9, 0x29, 0x4A, 0xA1, 0xD7, 0xDC, 0x6A, 0x68, 0x35, 0x16, 0x0B, 0xC5, 0x4A, 0x19, 0x29, 0x17,
+    0xEC, 0xFE, 0xD9, 0x46, 0xEC, 0xFC, 0x09, 0x1B, 0xA9, 0xE6, 0xDF, 0xA9, 0x66, 0xAA, 0xF9, 0xD3,
+    0xF5, 0x84, 0x5D, 0xBE, 0xE6, 0x02, 0x56, 0xAB, 0x02, 0x85, 0xA4, 0x40, 0x96, 0xBC, 0xE3, 0xF3,
+    0x53, 0x3F, 0x40, 0x16, 0xE4, 0x21, 0x1F, 0xE5, 0xC1, 0xBC, 0xA2, 0xEE, 0x20, 0xB3, 0x6D, 0x2F,
+    0xD5, 0xB8, 0xB7, 0x71, 0x99, 0x34, 0xC1, 0x17, 0xC9, 0x9A, 0x7E, 0x42, 0x9F, 0xD1, 0x50, 0xC4,
+    0x8F, 0x8A, 0x7A, 0x34, 0x11, 0x35, 0x76, 0x34, 0x91, 0xF6, 0x77, 0xAB, 0x90, 0x2F, 0x9F, 0xEA,
+    0x7D, 0xF9, 0xE6, 0xAB, 0x2B, 0xF5, 0x4D, 0x4D, 0x9B, 0x00, 0xDE, 0x12, 0x98, 0xE7, 0x66, 0x78,
+    0xBF, 0x7B, 0xA5, 0xE3, 0xAB, 0xBA, 0xB6, 0x05, 0xA0, 0x56, 0x7E, 0xDB, 0xAE, 0xCF, 0x25, 0xFF,
+    0x1D, 0xA8, 0xB5, 0x02, 0x55, 0x32, 0x54, 0xBF, 0x30, 0x1E, 0xB3, 0x21, 0xAA, 0xC9, 0x3D, 0xBE,
+    0xEB, 0xF1, 0xB4, 0x76, 0xD3, 0x5A, 0x19, 0xB1, 0xFA, 0x49, 0xF2, 0xD0, 0x5D, 0xC0, 0xCE, 0xB8,
+    0x40, 0x35, 0xE1, 0x02, 0x75, 0xD8, 0x3B, 0xE5, 0x23, 0x2E, 0x6C, 0xFE, 0x78, 0x3F, 0xD0, 0x0F,
+    0xC8, 0x9F, 0xD7, 0x5C, 0x68, 0xAE, 0xB5, 0xD4, 0x8A, 0x4E, 0xD1, 0x29, 0x72, 0xD4, 0x6C, 0xF6,
+    0xB0, 0x57, 0x43, 0xAE, 0xB8, 0xF7, 0xC9, 0xD5, 0x6D, 0x41, 0x65, 0x15, 0x80, 0xDE, 0xFF, 0xD7,
+    0x98, 0xC5, 0x0A, 0xFB, 0x86, 0x22, 0xEE, 0x07, 0x9A, 0xB2, 0x75, 0x71, 0x43, 0x29, 0x2F, 0x5C,
+    0x2C, 0x22, 0x1A, 0xEA, 0xB1, 0x10, 0x6A, 0xEA, 0xC9, 0x44, 0xE4, 0xAB, 0x60, 0x56, 0xFA, 0xAE,
+    0x9A, 0xCC, 0x42, 0xEB, 0x6D, 0xF8, 0xDF, 0x45, 0x7B, 0xED, 0xF9, 0x39, 0xD7, 0xEA, 0x86, 0x42,
+    0xAF, 0x08, 0xBB, 0xEC, 0x63, 0x99, 0xE4, 0x1C, 0x92, 0x29, 0x01, 0x28, 0x5A, 0x53, 0x20, 0x37,
+    0x65, 0x4D, 0xBD, 0x14, 0x7A, 0x26, 0x96, 0x2B, 0x36, 0xB6, 0xF7, 0xAA, 0x43, 0xCF, 0x05, 0x17,
+    0xB0, 0x51, 0xE5, 0x02, 0x7A, 0x2E, 0xC8, 0x63, 0xE7, 0xF6, 0xDA, 0xB2, 0xFB, 0x9C, 0xEE, 0x97,
+    0x24, 0x85, 0x32, 0xD9, 0x8F, 0x42, 0x27, 0x27, 0x27, 0xDD, 0xB6, 0x0A, 0x92, 0x04, 0x71, 0x53,
+    0xFA, 0xA5, 0x21, 0x6F, 0xA8, 0x23, 0x3C, 0x45, 0xA6, 0x91, 0xD6, 0x63, 0xF5, 0xE3, 0x7E, 0x82,
+    0x56, 0x5A, 0x21, 0x4B, 0x0B, 0x2B, 0xD7, 0xDA, 0x24, 0x2C, 0x7D, 0xEF, 0x1C, 0x52, 0xC9, 0x93,
+    0x4B, 0x1D, 0xF5, 0x8F, 0x45, 0xBE, 0x98, 0xF8, 0x09, 0x3B, 0x56, 0xAF, 0x86, 0x1E, 0x55, 0x8F,
+    0xCD, 0xE5, 0xF4, 0x70, 0xFD, 0x82, 0xEE, 0x5D, 0xD4, 0x4F, 0x46, 0x5A, 0xC9, 0xA5, 0x06, 0x5A,
+    0xCF, 0x25, 0xD4, 0x54, 0x9D, 0xD1, 0xE7, 0xD7, 0xB4, 0x08, 0xAD, 0x56, 0x28, 0xD5, 0x25, 0x90,
+    0xE7, 0x37, 0xFB, 0xEA, 0x37, 0x50, 0x21, 0x61, 0x0A, 0x69, 0x43, 0xD9, 0xEC, 0xEE, 0x06, 0x28,
+    0x24, 0x3C, 0xC1, 0xF8, 0xB3, 0x06, 0xF6, 0xD7, 0x21, 0xAA, 0x64, 0x2E, 0xFC, 0x7E, 0x67, 0x9D,
+    0xF7, 0xBB, 0xAA, 0xE5, 0xCC, 0x7A, 0x2A, 0x37, 0x1C, 0x01, 0xA3, 0x6D, 0x21, 0xF5, 0x43, 0xB2,
+    0x84, 0x36, 0xF2, 0x2E, 0x6F, 0xAE, 0xEF, 0xF0, 0x66, 0xB1, 0xA6, 0x15, 0x78, 0x5E, 0xD7, 0x29,
+    0x25, 0x6F, 0xF6, 0x3B, 0xFD, 0x01, 0x3F, 0x84, 0x62, 0xBF, 0xFB, 0x98, 0x3D, 0xDE, 0x92, 0x6F,
+    0x81, 0xAC, 0xFE, 0x6C, 0xDA, 0xFB, 0xFC, 0x1B, 0x06, 0x93, 0xE9, 0x35, 0xDE, 0xF9, 0x91, 0x94,
+    0xEB, 0x4E, 0x90, 0x2F, 0xB4, 0xD0, 0x06, 0xDA, 0x68, 0x24, 0xDA, 0x85, 0x4A, 0x4D, 0xBB, 0xD2,
+    0x0A, 0x73, 0x2D, 0x98, 0x05, 0x77, 0xAD, 0xA3, 0x89, 0xA8, 0x71, 0xBE, 0x81, 0xBA, 0x73, 0xBE,
+    0xF6, 0x40, 0x11, 0xAA, 0x50, 0x79, 0x80, 0x58, 0xCE, 0x29, 0x79, 0x50, 0xDF, 0xBF, 0x94, 0x63,
+    0x9A, 0x22, 0xA5, 0x59, 0xCA, 0x95, 0xC0, 0x5A, 0x72, 0x6D, 0xC9, 0x8B, 0x4C, 0xDF, 0xBE, 0xDE,
+    0x7B, 0x00, 0x3D, 0xB6, 0xD8, 0x29, 0x6D, 0x15, 0xCA, 0x53, 0x62, 0x63, 0x68, 0x7D, 0xEB, 0x01,
+    0x8D, 0x55, 0xC2, 0xC3, 0xFB, 0x50, 0xCE, 0xB9, 0x00, 0x05, 0xB3, 0xE0, 0x02, 0x68, 0x42, 0xD8,
+    0x85, 0x4C, 0x73, 0xA6, 0xD7, 0x32, 0x0D, 0x99, 0xE6, 0x5C, 0xA2, 0x5E, 0xA9, 0x27, 0x24, 0x9F,
+    0xAB, 0xD9, 0x10, 0xC5, 0x73, 0x6F, 0xBB, 0xE4, 0x4B, 0x29, 0x14, 0xFB, 0x50, 0xDA, 0x70, 0x92,
+    0x6B, 0xD4, 0x3E, 0x12, 0x93, 0x72, 0x26, 0x55, 0xAD, 0x36, 0x6C, 0xE0, 0xCE, 0xE6, 0xCC, 0xF7,
+    0xBE, 0xC4, 0x51, 0x93, 0x5D, 0xA6, 0x8D, 0x66, 0xCE, 0xE5, 0x2B, 0x0D, 0xAE, 0xE9, 0x97, 0x42,
+    0x2A, 0x42, 0x2D, 0x7F, 0xE5, 0x62, 0xE8, 0x8B, 0xE9, 0x23, 0x45, 0x23, 0x3B, 0x2E, 0x40, 0xF9,
+    0xB3, 0xC5, 0x75, 0x40, 0xAF, 0xE7, 0x02, 0x50, 0x6A, 0x11, 0xC0, 0x1E, 0x13, 0xFA, 0x99, 0x16,
+    0x20, 0x8B, 0xED, 0xB5, 0x01, 0x70, 0x9F, 0xB9, 0xBE, 0xD0, 0xDC, 0x5E, 0x8E, 0xAA, 0xC2, 0x27,
+    0xCD, 0xCB, 0xD1, 0x0E, 0xBA, 0x36, 0xF6, 0xCA, 0xA2, 0x55, 0x2C, 0x35, 0xD4, 0xBE, 0x15, 0xED,
+    0x68, 0xA6, 0x5C, 0x1D, 0xC7, 0xDC, 0x4E, 0xC6, 0x2F, 0x0F, 0x22, 0x53, 0x87, 0x62, 0xC3, 0x39,
+    0xBB, 0x94, 0x13, 0x03, 0xAA, 0xB9, 0xF2, 0x40, 0xFB, 0xFD, 0x25, 0xCD, 0xC9, 0xBA, 0xE1, 0x39,
+    0x80, 0xBB, 0xDE, 0x27, 0x8D, 0xAC, 0x17, 0x28, 0x17, 0xEA, 0xF9, 0x00, 0xD7, 0xC8, 0x23, 0x4F,
+    0xC2, 0x59, 0xA8, 0x26, 0x6C, 0x4C, 0x68, 0x7A, 0xA0, 0xD2, 0xC8, 0x06, 0x22, 0x2F, 0x58, 0xA9,
+    0xD9, 0x30, 0x95, 0x24, 0x46, 0x1B, 0x81, 0x22, 0xC5, 0x90, 0xED, 0x93, 0xDB, 0x29, 0x13, 0x1A,
+    0x31, 0x03, 0xE4, 0xDF, 0x21, 0xE1, 0x58, 0xB7, 0xE5, 0x1A, 0x8B, 0x28, 0x65, 0xFA, 0x9B, 0x7E,
+    0x74, 0x31, 0x5F, 0xCB, 0x57, 0x1A, 0xF7, 0x42, 0xC4, 0x44, 0x07, 0xED, 0xD5, 0x91, 0x72, 0x79,
+    0x3A, 0x6D, 0x8F, 0x56, 0x0A, 0x99, 0x3E, 0xA7, 0xAE, 0x0A, 0x65, 0xCC, 0x57, 0x9C, 0x77, 0x83,
+    0x59, 0x4C, 0xC4, 0x0D, 0xAD, 0x37, 0xB1, 0x9C, 0xCE, 0x20, 0xD5, 0x0D, 0xD8, 0xC0, 0x07, 0xF3,
+    0x85, 0xE2, 0xCD, 0xDE, 0xD3, 0x2B, 0xA4, 0x20, 0xE4, 0xFC, 0xE3, 0x00, 0xAD, 0xA4, 0x98, 0x60,
+    0xBB, 0x98, 0x7E, 0x1B, 0xC1, 0x44, 0x23, 0xC0, 0xCC, 0xC5, 0x0A, 0x14, 0x53, 0xB1, 0x00, 0x65,
+    0x28, 0x23, 0x60, 0x47, 0x1B, 0x01, 0x3B, 0xD8, 0x94, 0xEE, 0xA8, 0x66, 0xC0, 0xF9, 0x7A, 0x02,
+    0x5C, 0xE3, 0x02, 0xD0, 0x27, 0xC3, 0xB7, 0xE2, 0x46, 0xC8, 0x16, 0xDA, 0x11, 0x4C, 0xA4, 0x1F,
+    0xA0, 0x48, 0x08, 0xB3, 0x0D, 0xC8, 0xF3, 0x61, 0xE7, 0x33, 0x75, 0x38, 0x75, 0xB9, 0x1A, 0x7A,
+    0x71, 0xB7, 0x66, 0xFA, 0x88, 0xB4, 0xE0, 0xC6, 0x4C, 0x8A, 0x9C, 0x23, 0xE5, 0xB2, 0x4E, 0x73,
+    0x3B, 0xD5, 0x70, 0xD6, 0x17, 0x4D, 0xAE, 0x7F, 0x36, 0x9F, 0x51, 0x6D, 0xEE, 0xFA, 0x73, 0xA0,
+    0x56, 0xD8, 0xF6, 0xF8, 0x5C, 0xFD, 0x00, 0xEE, 0xFE, 0x08, 0xE5, 0xD8, 0x7A, 0x88, 0xE5, 0x0C,
+    0x95, 0x57, 0x83, 0x99, 0x6C, 0x00, 0x97, 0xAD, 0x50, 0x06, 0x37, 0xC0, 0x62, 0x22, 0x54, 0xBE,
+    0x7D, 0x26, 0x33, 0x73, 0x19, 0xBF, 0x76, 0x8F, 0xE8, 0xAF, 0x5D, 0xD5, 0x68, 0x15, 0x5D, 0x44,
+    0x7A, 0x6C, 0xA5, 0x50, 0xC8, 0xE0, 0xDC, 0xC3, 0x7B, 0x28, 0x63, 0x3B, 0xB7, 0x3B, 0xF5, 0x84,
+    0xFF, 0x72, 0xBF, 0x60, 0x7E, 0x63, 0x01, 0xEC, 0x6A, 0x26, 0x97, 0xC6, 0x5C, 0x0D, 0x4E, 0xCB,
+    0xB6, 0x4B, 0x1D, 0x90, 0x92, 0x7E, 0x00, 0xF8, 0x4A, 0x42, 0x3B, 0xAA, 0xD7, 0xC5, 0xA9, 0xC2,
+    0x52, 0x29, 0x7D, 0xF6, 0x63, 0x97, 0x37, 0xE4, 0xF5, 0x3E, 0x05, 0xB3, 0x4A, 0xB8, 0x9F, 0xF4,
+    0xC1, 0x2C, 0x09, 0x72, 0x1D, 0xCA, 0x68, 0x16, 0xD4, 0xB5, 0xDF, 0x7F, 0x70, 0x2A, 0x25, 0x35,
+    0x92, 0x82, 0xBD, 0xF1, 0x84, 0x32, 0xE1, 0xC6, 0x2A, 0x98, 0x25, 0x17, 0xAD, 0x77, 0x63, 0x19,
+    0xCD, 0x42, 0xEF, 0x5B, 0x6F, 0xE7, 0x72, 0x46, 0x4D, 0xF2, 0x74, 0xF2, 0x35, 0x6D, 0x78, 0x1F,
+    0x2C, 0x66, 0x8A, 0x37, 0x05, 0xBD, 0x06, 0x0A, 0x4D, 0x9B, 0xC6, 0xFE, 0x67, 0x97, 0x16, 0xD8,
+    0x82, 0xA7, 0xB6, 0x3B, 0xAB, 0xC5, 0xF9, 0xFE, 0xDD, 0x64, 0x61, 0xED, 0xB6, 0x7F, 0x5F, 0xE6,
+    0x9F, 0x9D, 0x16, 0xB8, 0xBD, 0x0E, 0x45, 0xFC, 0xDA, 0x21, 0x2D, 0x10, 0x5B, 0x5F, 0x6A, 0xEE,
+    0xBB, 0x42, 0x01, 0x78, 0x60, 0xDC, 0x9F, 0xAC, 0xEA, 0xF6, 0x5A, 0xFB, 0xF4, 0x19, 0xA5, 0xFD,
+    0x57, 0x0A, 0x8F, 0x46, 0x28, 0xA5, 0x01, 0x5C, 0x02, 0x39, 0x9A, 0x83, 0xDC, 0xD2, 0x8E, 0x9A,
+    0x82, 0xF9, 0xF9, 0x34, 0x94, 0xBF, 0x8D, 0x83, 0xFE, 0x0D, 0x45, 0xEC, 0x17, 0xF4, 0xBF, 0xF5,
+    0xDE, 0x4E, 0x26, 0x66, 0xC2, 0xF9, 0x2A, 0x14, 0x73, 0xBE, 0xD2, 0x37, 0xED, 0x50, 0xCE, 0x76,
+    0xA1, 0xBF, 0x26, 0x9F, 0x92, 0xF6, 0xB3, 0xBA, 0x2D, 0x36, 0xD2, 0xE6, 0x57, 0x17, 0x82, 0x42,
+    0x21, 0x41, 0xC6, 0x36, 0x6C, 0x91, 0x58, 0xE5, 0xB7, 0x85, 0x5D, 0x35, 0x1B, 0x3E, 0x77, 0x6E,
+    0x73, 0x11, 0xA1, 0x17, 0xF4, 0xF2, 0x5B, 0x6A, 0x2F, 0xE0, 0x94, 0xD2, 0x84, 0x95, 0x1A, 0x70,
+    0x6A, 0xAC, 0x06, 0xA8, 0x34, 0x14, 0x9A, 0xA0, 0xBC, 0x39, 0x9B, 0x9F, 0x47, 0x30, 0x37, 0xD6,
+    0x2C, 0x0A, 0x88, 0xAD, 0x5F, 0x9C, 0x87, 0xBE, 0x0A, 0x7D, 0x15, 0xC0, 0x3D, 0x16, 0x5D, 0x11,
+    0xC1, 0x0E, 0xBA, 0xF8, 0xA8, 0xA0, 0x08, 0xEE, 0x9A, 0xEF, 0x3D, 0x26, 0x96, 0x1A, 0xEB, 0x00,
+    0x4B, 0xA6, 0x60, 0x67, 0x68, 0x69, 0x67, 0xB3, 0x42, 0xED, 0x6D, 0x44, 0x1D, 0x76, 0x34, 0x0B,
+    0x6E, 0xA4, 0x98, 0xE8, 0xB1, 0x33, 0x79, 0xA4, 0x6E, 0xCC, 0xC2, 0x79, 0x5D, 0x82, 0xBB, 0x35,
+    0x97, 0x8A, 0x50, 0x49, 0x8F, 0x49, 0x7B, 0xE9, 0x9E, 0xD1, 0xBF, 0x14, 0x14, 0x9F, 0x49, 0x53,
+    0xED, 0xD5, 0x74, 0xAF, 0x98, 0xEC, 0x5F, 0x3F, 0x0C, 0x64, 0x5F, 0x82, 0x2F, 0x35, 0x68, 0xC5,
+    0xAA, 0x29, 0xB5, 0xA0, 0xC8, 0x9D, 0x9A, 0x0B, 0x8D, 0x18, 0x05, 0xD7, 0x37, 0x54, 0x4F, 0x3E,
+    0xFB, 0x56, 0x84, 0x87, 0x5A, 0xFB, 0x7C, 0x20, 0x7F, 0x73, 0x79, 0xC8, 0x75, 0xD8, 0xAB, 0x3F,
+    0x7F, 0x63, 0x01, 0x67, 0xF5, 0xC0, 0x44, 0x36, 0xBB, 0x58, 0x7B, 0xCA, 0x41, 0x83, 0xC0, 0x19,
+    0x99, 0x78, 0x7B, 0x16, 0xED, 0x6C, 0x7F, 0xF8, 0xEA, 0xB5, 0xC1, 0x79, 0x77, 0xED, 0x9B, 0x42,
+    0x99, 0x16, 0x37, 0x99, 0xC9, 0x28, 0xA8, 0x39, 0x6A, 0xAC, 0xFC, 0x31, 0x70, 0x2E, 0x11, 0x35,
+    0x52, 0x6C, 0x4C, 0xDD, 0x9C, 0x31, 0xF8, 0xDB, 0xB2, 0xF9, 0xF4, 0xC1, 0x47, 0x39, 0x7F, 0x72,
+    0x92, 0x70, 0x87, 0xA4, 0x81, 0x4D, 0xDA, 0x82, 0xDD, 0x86, 0xEE, 0x15, 0x31, 0x31, 0x33, 0xFE,
+    0x09, 0x6F, 0x56, 0xDB, 0x9B, 0x77, 0x6B, 0xDC, 0x92, 0xE6, 0x1B, 0x33, 0x84, 0xDB, 0xD3, 0xE8,
+    0x1A, 0xC8, 0x26, 0xFE, 0x32, 0xED, 0x85, 0x80, 0x59, 0x2F, 0x8E, 0xA7, 0x91, 0x65, 0xBB, 0xFC,
+    0xA2, 0xEB, 0x99, 0x82, 0x8F, 0x4D, 0xEE, 0x09, 0x0E, 0xAB, 0x97, 0xD3, 0x54, 0xC5, 0x96, 0xC3,
+    0xA8, 0xAE, 0x05, 0xC0, 0x5C, 0x4F, 0xC9, 0x35, 0x1B, 0x00, 0x3B, 0xAA, 0x01, 0x13, 0xED, 0x0C,
+    0xB4, 0x4D, 0xEF, 0xC1, 0x86, 0x32, 0x42, 0x9E, 0x32, 0xC9, 0xEE, 0xFB, 0x5F, 0x58, 0x92, 0x35,
+    0x1B, 0xC9, 0x52, 0x92, 0xCA, 0xFD, 0xE4, 0xA4, 0x0F, 0x94, 0x33, 0xB9, 0x40, 0x29, 0x23, 0x35,
+    0x92, 0xA9, 0xBB, 0x7B, 0x6D, 0xE8, 0xF5, 0x19, 0x2D, 0xB4, 0x8A, 0x09, 0x11, 0xF4, 0x67, 0x3C,
+    0xC5, 0x2C, 0x30, 0x26, 0x27, 0xD1, 0xCC, 0x95, 0xC7, 0x24, 0xFB, 0x18, 0x6F, 0x71, 0x0D, 0xBF,
+    0x94, 0x1D, 0x53, 0xE8, 0xF9, 0x40, 0x2D, 0x05, 0xFA, 0x9B, 0x1A, 0x32, 0x75, 0xBD, 0x37, 0x2B,
+    0xBD, 0x2F, 0x23, 0xEA, 0xEC, 0x8C, 0xA8, 0x42, 0x26, 0xEA, 0x60, 0x84, 0x1B, 0x8B, 0x15, 0x37,
+    0xDA, 0x05, 0x37, 0xD6, 0x0B, 0x6E, 0xBC, 0x12, 0x3F, 0xEE, 0xDE, 0xBA, 0xAE, 0x58, 0xEB, 0x15,
+    0xCD, 0x95, 0x1E, 0xD1, 0x58, 0xAE, 0xA8, 0xE1, 0x38, 0xC9, 0xF6, 0x0E, 0x1A, 0xC0, 0x8E, 0x3D,
+    0x90, 0x2B, 0x01, 0x1B, 0xAF, 0x08, 0xC8, 0xE7, 0x3D, 0x77, 0xE7, 0x3F, 0x1F, 0xA9, 0x66, 0xB1,
+    0x1C, 0x30, 0x4B, 0x3D, 0x52, 0x44, 0x37, 0x60, 0xA6, 0xBA, 0x83, 0xE6, 0x56, 0x17, 0xFD, 0xD7,
+    0x2D, 0xD0, 0x43, 0x6A, 0xD6, 0xED, 0xA3, 0x91, 0x8B, 0xDB, 0x1B, 0x46, 0xD3, 0xD1, 0x02, 0x70,
+    0x45, 0xDB, 0x2E, 0xF1, 0x7C, 0x20, 0x02, 0xC5, 0x1B, 0x6B, 0xB2, 0xB9, 0x4B, 0xBD, 0xB9, 0x5F,
+    0x8F, 0x25, 0x09, 0x97, 0x21, 0x85, 0xA6, 0xF9, 0x92, 0xF0, 0x2D, 0xDA, 0x66, 0x73, 0xA7, 0xC7,
+    0xC4, 0x3D, 0x30, 0xCB, 0xC6, 0xA1, 0x52, 0xFA, 0x3B, 0xF5, 0x76, 0xCE, 0x62, 0xD9, 0xB5, 0x03,
+    0x5F, 0x23, 0x13, 0x66, 0xC1, 0x7A, 0x9C, 0xA7, 0xF5, 0x59, 0xC4, 0x4E, 0x94, 0x91, 0xD6, 0x17,
+    0x6A, 0x0A, 0x49, 0xB3, 0xD1, 0x9A, 0x4B, 0x12, 0x4E, 0x83, 0xDB, 0x8E, 0xF2, 0xA5, 0x26, 0x7B,
+    0x1C, 0x5A, 0x3D, 0xAA, 0x29, 0x65, 0x76, 0x7C, 0xA9, 0x5E, 0x7F, 0x16, 0x33, 0x75, 0x6E, 0x74,
+    0xDE, 0x8D, 0x26, 0x9A, 0x58, 0x46, 0xFA, 0xA6, 0x6F, 0xD4, 0xD9, 0x50, 0x8F, 0x55, 0xC8, 0x57,
+    0x3B, 0xE7, 0xC2, 0xBD, 0xBE, 0xE0, 0xC6, 0x52, 0x2B, 0x66, 0x45, 0x2B, 0xB8, 0xD1, 0x2D, 0xDC,
+    0x66, 0xD6, 0x52, 0xA3, 0x09, 0xEE, 0xAD, 0x1B, 0xFA, 0x53, 0xE5, 0x92, 0x95, 0x7C, 0x25, 0xDF,
+    0x6B, 0xA4, 0x1D, 0x73, 0xBD, 0x06, 0xC7, 0x07, 0x8A, 0x06, 0x87, 0x25, 0xFF, 0x30, 0x9F, 0x84,
+    0x3C, 0x66, 0x13, 0xD8, 0xA5, 0xEF, 0xF6, 0xF9, 0xC7, 0x4A, 0xCD, 0x3B, 0xC4, 0x9A, 0x92, 0xD2,
+    0xB6, 0xBD, 0x50, 0x49, 0x0A, 0x98, 0x35, 0xBB, 0xE8, 0xA9, 0x26, 0x5A, 0xE8, 0x7D, 0x36, 0x63,
+    0x44, 0xE1, 0xB7, 0x3C, 0x53, 0x3B, 0xA6, 0x14, 0x72, 0x62, 0xFC, 0xA4, 0x44, 0xC1, 0x00, 0x92,
+    0xF6, 0x49, 0xA9, 0x7A, 0x3A, 0xE8, 0xB8, 0x11, 0xF9, 0x88, 0x9D, 0xA9, 0x3C, 0xED, 0xC0, 0x4A,
+    0xAE, 0xE6, 0xEE, 0x89, 0x36, 0x49, 0x26, 0x09, 0x6F, 0x0B, 0x41, 0x01, 0xF0, 0xFC, 0x15, 0x7F,
+    0x49, 0xCB, 0xD7, 0xA8, 0x87, 0x87, 0x13, 0x41, 0xAD, 0x5D, 0xF7, 0xA9, 0x52, 0xE0, 0xFC, 0x25,
+    0x68, 0x05, 0xBD, 0x46, 0xFA, 0x3F, 0x8B, 0xB4, 0x8D, 0x70, 0x5D, 0xDB, 0xD5, 0xDE, 0x79, 0x3B,
+    0xD6, 0x43, 0x31, 0xB5, 0x43, 0xBE, 0x6A, 0x40, 0xEA, 0x70, 0x0B, 0xD8, 0x89, 0x0F, 0x9B, 0x85,
+    0x16, 0x7D, 0x5F, 0x5D, 0x95, 0x42, 0xF6, 0x8E, 0x7A, 0xDD, 0xF3, 0x9F, 0x8E, 0x8E, 0x49, 0x8E,
+    0x5C, 0x2E, 0x89, 0x5C, 0x52, 0xC8, 0xD4, 0xD5, 0x2B, 0x57, 0xC8, 0xE5, 0xDF, 0xBF, 0xA1, 0x23,
+    0x29, 0xDD, 0x91, 0x28, 0x2B, 0x89, 0x21, 0x70, 0xB4, 0xDB, 0x7D, 0x41, 0x56, 0x92, 0xBE, 0x21,
+    0x49, 0xAF, 0x4A, 0xD2, 0xA4, 0x0E, 0x1B, 0xDB, 0x81, 0x72, 0xAD, 0x26, 0x8C, 0x8A, 0x05, 0xA3,
+    0x7B, 0xD5, 0x19, 0x75, 0xEE, 0xFA, 0xDD, 0xE9, 0x82, 0xBB, 0x44, 0xA3, 0x4B, 0xF9, 0xDE, 0xA3,
+    0xB4, 0x67, 0xFC, 0x05, 0xD4, 0xEA, 0x32, 0x29, 0x14, 0x6B, 0x3F, 0xD9, 0xB1, 0x8C, 0xB6, 0x29,
+    0x62, 0x46, 0x19, 0xC9, 0x14, 0xA9, 0x15, 0xD1, 0xCB, 0xB1, 0x58, 0xCA, 0xD9, 0x06, 0x1B, 0x9C,
+    0xAF, 0x46, 0xD7, 0x39, 0xDF, 0x7A, 0x75, 0xEE, 0xF5, 0x95, 0x5A, 0x73, 0x42, 0x42, 0x8E, 0x93,
+    0x51, 0x3A, 0x06, 0xF7, 0xCC, 0x02, 0x55, 0x50, 0x47, 0x19, 0xDD, 0x40, 0x16, 0x0F, 0x84, 0x48,
+    0x0E, 0xE1, 0x73, 0x2E, 0x35, 0x94, 0x52, 0xA4, 0x94, 0xE4, 0x8B, 0x95, 0x7E, 0xCE, 0x67, 0x4A,
+    0xF1, 0xA9, 0x2D, 0x17, 0x52, 0xCD, 0x24, 0x37, 0x64, 0x9B, 0x4B, 0x17, 0xEE, 0xDC, 0xED, 0x2E,
+    0x46, 0x27, 0x69, 0xAD, 0x25, 0xE9, 0x9B, 0x92, 0xF4, 0xD2, 0x0A, 0xEE, 0x0D, 0x35, 0xD4, 0x73,
+    0x3B, 0x60, 0x63, 0x35, 0x61, 0x97, 0x62, 0xC5, 0xAE, 0xE8, 0xB5, 0x8B, 0x4A, 0xCB, 0xCA, 0x48,
+    0x0B, 0x54, 0x7A, 0x2D, 0x61, 0x1A, 0x1B, 0x0A, 0xF2, 0x48, 0xA4, 0xBD, 0x1A, 0xE9, 0xBF, 0x1E,
+    0xE9, 0xCD, 0xC4, 0x59, 0x35, 0xFE, 0x95, 0xCA, 0x04, 0x8E, 0xB6, 0xDD, 0x70, 0xB3, 0xD6, 0x90,
+    0xE6, 0x29, 0x45, 0x17, 0x7B, 0x9E, 0xC1, 0x95, 0x62, 0x7A, 0x67, 0x2C, 0x66, 0x9B, 0xA6, 0x63,
+    0x6C, 0xA4, 0xD5, 0x50, 0x08, 0x23, 0x5F, 0x2B, 0x14, 0x1A, 0xD0, 0x54, 0xE8, 0xB5, 0x42, 0x81,
+    0x7B, 0x44, 0x3D, 0x9A, 0x35, 0x72, 0xCE, 0x0E, 0x76, 0x32, 0xF1, 0x1C, 0xE4, 0xB3, 0x89, 0xC9,
+    0x6D, 0x71, 0x99, 0xB2, 0x84, 0xAC, 0x0F, 0x7D, 0xB7, 0x00, 0xE4, 0x73, 0x3D, 0x5C, 0x49, 0xAE,
+    0xAD, 0x9D, 0xDC, 0x21, 0x13, 0xDC, 0xA4, 0x60, 0x66, 0xF3, 0xD1, 0xAB, 0xEB, 0xFD, 0xDF, 0x26,
+    0x6F, 0x33, 0xBA, 0x21, 0x65, 0x6B, 0xA3, 0x0D, 0x75, 0x00, 0xEC, 0x62, 0x62, 0x11, 0x81, 0x72,
+    0xCD, 0x84, 0x3A, 0x28, 0x45, 0xDF, 0xD5, 0x01, 0x4A, 0x35, 0x6E, 0x30, 0x02, 0xAB, 0xC6, 0x06,
+    0xFA, 0x91, 0x4A, 0xDD, 0xDD, 0x6A, 0xEC, 0x42, 0xA5, 0xAE, 0x56, 0xC8, 0x35, 0xE6, 0x6A, 0xAC,
+    0x22, 0xF5, 0xB4, 0x47, 0x61, 0xCE, 0xDA, 0x85, 0x2C, 0x26, 0xFF, 0xC5, 0x5D, 0x4D, 0x06, 0x31,
+    0xA6, 0xC4, 0xAA, 0xBB, 0x3F, 0x39, 0x37, 0xCD, 0xB9, 0x5F, 0x14, 0xD1, 0xBF, 0x10, 0x7F, 0x76,
+    0xBC, 0x95, 0x3F, 0xEB, 0xFB, 0x25, 0x8F, 0x85, 0x42, 0xE2, 0xCF, 0xCE, 0x24, 0xFE, 0x2C, 0xC0,
+    0xED, 0x59, 0x43, 0x31, 0x39, 0x8F, 0x7B, 0x51, 0x64, 0xB2, 0x33, 0x26, 0xB1, 0xD0, 0x0E, 0xD7,
+    0x78, 0x01, 0x4A, 0xAD, 0xC9, 0x6E, 0x15, 0x92, 0xA8, 0x87, 0x2A, 0xB2, 0x50, 0x4F, 0x26, 0xD0,
+    0x0F, 0x65, 0x93, 0x8B, 0x94, 0x92, 0xA2, 0xF7, 0x1C, 0x3D, 0x18, 0xC1, 0xC9, 0x93, 0x49, 0x9E,
+    0xF3, 0xBD, 0xFC, 0x46, 0x77, 0xB5, 0x2B, 0x50, 0xCF, 0x39, 0xB4, 0xE3, 0x43, 0xE4, 0xBA, 0x3F,
+    0x52, 0x45, 0xBB, 0x9C, 0xD7, 0xE0, 0xA4, 0x25, 0xD9, 0xC6, 0x5A, 0xD3, 0x19, 0xBA, 0x65, 0x3E,
+    0x57, 0x3E, 0x93, 0x0D, 0xF4, 0x5F, 0x8F, 0x54, 0x7E, 0xB9, 0x15, 0x09, 0xCB, 0xBE, 0x03, 0x65,
+    0x02, 0x52, 0xBA, 0xF2, 0x7A, 0x1B, 0x4C, 0x30, 0x91, 0x3F, 0x40, 0x5B, 0xA0, 0xD6, 0x77, 0x58,
+    0x35, 0x18, 0x4D, 0xF0, 0x84, 0xB6, 0x9C, 0xB7, 0x9D, 0x0B, 0x6F, 0x16, 0x33, 0xE7, 0x42, 0xD7,
+    0xD4, 0xD4, 0x52, 0x93, 0x69, 0xD9, 0x5C, 0x8E, 0x5A, 0x5A, 0xB1, 0x92, 0x7C, 0x21, 0x29, 0xE4,
+    0xEB, 0xEE, 0xE2, 0xCC, 0x15, 0xAA, 0x19, 0xD7, 0x54, 0x33, 0x65, 0xC2, 0x49, 0xEC, 0xE9, 0x53,
+    0xDC, 0xA7, 0x81, 0x13, 0xAF, 0xE6, 0xC9, 0xB4, 0xF6, 0x27, 0x48, 0x5C, 0xA8, 0x4C, 0x4D, 0xD1,
+    0xD1, 0x0E, 0x65, 0xC0, 0x05, 0xB3, 0x50, 0xCD, 0xE8, 0xB5, 0x8B, 0x91, 0x5A, 0x8A, 0x18, 0x69,
+    0x86, 0x4A, 0x23, 0x70, 0xC7, 0xE1, 0x9A, 0x9C, 0x14, 0x37, 0x5E, 0x87, 0x14, 0x59, 0xA9, 0x03,
+    0x91, 0xDE, 0x33, 0x65, 0xDA, 0x53, 0x9A, 0xAB, 0xB0, 0x47, 0x93, 0xD5, 0x80, 0xD1, 0xB8, 0x9D,
+    0x3F, 0xEF, 0xB5, 0x81, 0xD3, 0x1B, 0x6A, 0x25, 0x7F, 0xF8, 0xA9, 0x7B, 0x0F, 0xA8, 0x79, 0x98,
+    0x5C, 0xF4, 0x4D, 0xB9, 0xD0, 0x5F, 0xEF, 0xE7, 0x24, 0x71, 0xAB, 0x15, 0xB2, 0x2B, 0x09, 0x76,
+    0xB9, 0x73, 0x77, 0x61, 0xF3, 0x2E, 0x12, 0xA4, 0x98, 0x98, 0x38, 0xF9, 0xC9, 0x49, 0xC7, 0xBB,
+    0x3D, 0xA4, 0x50, 0x6B, 0xA5, 0xD6, 0x6A, 0xA4, 0x21, 0x11, 0x3F, 0xA6, 0x03, 0x0D, 0x6C, 0xE3,
+    0x94, 0xE5, 0x6A, 0xE8, 0x43, 0x42, 0xE1, 0x56, 0x30, 0xC2, 0x6A, 0x84, 0x76, 0x2C, 0xB4, 0x40,
+    0xB1, 0x64, 0x4A, 0x9C, 0xC5, 0xFE, 0x9B, 0x11, 0x6C, 0xAC, 0x5F, 0x51, 0x07, 0x7A, 0x7E, 0xAA,
+    0x27, 0xA8, 0xB4, 0xA4, 0x43, 0x28, 0xE5, 0x43, 0xE5, 0x53, 0x48, 0x3F, 0x26, 0x54, 0x60, 0x3E,
+    0xA0, 0x02, 0xF2, 0xD0, 0x0F, 0xD8, 0x08, 0xAD, 0x2E, 0x95, 0x9A, 0xF7, 0x83, 0x3A, 0x10, 0xCD,
+    0x7E, 0xFD, 0x39, 0xCD, 0x7F, 0x5B, 0xBD, 0x15, 0xB5, 0x1E, 0x72, 0x9A, 0x53, 0xB9, 0xD2, 0x76,
+    0x1C, 0x27, 0xB5, 0x3D, 0x4A, 0x13, 0x6D, 0x62, 0xC2, 0xBF, 0xDA, 0x64, 0x33, 0xCA, 0xCD, 0x66,
+    0xB4, 0xFB, 0x30, 0xEE, 0x1D, 0x1E, 0x09, 0x30, 0x19, 0x13, 0x36, 0xB1, 0x24, 0xC0, 0x44, 0xEF,
+    0x04, 0x98, 0x94, 0xDA, 0x28, 0x6A, 0x09, 0xED, 0xD0, 0x9A, 0x78, 0xA1, 0x1A, 0xA0, 0x1D, 0x2A,
+    0x45, 0x28, 0x63, 0x39, 0xCB, 0x83, 0x9E, 0x5D, 0xAB, 0x19, 0x6C, 0xD4, 0x7D, 0x6A, 0xC8, 0xA4,
+    0xC1, 0x05, 0xA8, 0x15, 0x92, 0x74, 0x63, 0x12, 0xF6, 0x4A, 0xB1, 0x26, 0xAE, 0xD0, 0xBB, 0x01,
+    0x26, 0xDD, 0x7E, 0x50, 0x09, 0x30, 0xF1, 0x67, 0x0D, 0xA3, 0x89, 0x6E, 0x48, 0x36, 0xB1, 0x98,
+    0xDC, 0x2F, 0x38, 0xC9, 0xBF, 0x6E, 0x79, 0x67, 0xCD, 0x39, 0xC0, 0x86, 0xB6, 0x81, 0x3A, 0xA8,
+    0xDB, 0x36, 0xDF, 0xCD, 0x90, 0xDC, 0xF2, 0xD8, 0x35, 0xFB, 0x54, 0x43, 0xAE, 0xC4, 0x18, 0x97,
+    0x06, 0xDC, 0xFA, 0x39, 0x05, 0x14, 0x68, 0xE7, 0x5C, 0x1E, 0x17, 0x8D, 0x1A, 0xAA, 0x58, 0x0A,
+    0xAA, 0xC5, 0x2E, 0x60, 0x97, 0x2A, 0x82, 0x5D, 0xEA, 0x08, 0xD5, 0xE2, 0x66, 0xA8, 0xA2, 0x9B,
+    0xA1, 0x8E, 0x6E, 0x06, 0x37, 0xBB, 0x19, 0xDC, 0xE4, 0x66, 0xE8, 0x83, 0x8B, 0xA0, 0xA1, 0x5E,
+    0x30, 0xF2, 0x56, 0x58, 0x51, 0xEA, 0x47, 0xFD, 0x42, 0xE2, 0x59, 0x21, 0xA9, 0x3B, 0x84, 0x9A,
+    0xA7, 0xF6, 0xC0, 0xFA, 0xA7, 0x31, 0x4B, 0x1D, 0x70, 0x2F, 0xAD, 0x98, 0xB9, 0xF6, 0x6F, 0x4B,
+    0x05, 0xDC, 0xD5, 0x40, 0xAB, 0x8E, 0x5A, 0xC2, 0xAA, 0x9F, 0x72, 0x65, 0xEA, 0x5A, 0x6F, 0xA3,
+    0x9D, 0xE9, 0xBD, 0x9A, 0x32, 0xD6, 0x81, 0xFE, 0xAA, 0xB0, 0xB3, 0x1B, 0xD1, 0xFD, 0x2B, 0x55,
+    0x70, 0xA3, 0x59, 0x8D, 0xE8, 0x7D, 0x3D, 0xD5, 0x53, 0x26, 0x2D, 0x94, 0x52, 0x93, 0x12, 0x06,
+    0x47, 0xFF, 0x69, 0x79, 0xE4, 0x67, 0xE5, 0x51, 0x47, 0x23, 0xB0, 0xB1, 0x5C, 0xC1, 0x2E, 0x36,
+    0x9E, 0x91, 0x87, 0x24, 0x2D, 0xEE, 0x94, 0xA9, 0x15, 0x5D, 0x80, 0x7A, 0x76, 0x13, 0xB8, 0xC9,
+    0x4D, 0xD0, 0x06, 0x37, 0x83, 0x86, 0x3A, 0x92, 0xCB, 0xDB, 0x95, 0x52, 0x94, 0xFA, 0xFE, 0x7F,
+    0x52, 0x1E, 0x77, 0x35, 0x64, 0x29, 0xD1, 0x35, 0x1A, 0x3D, 0xB9, 0xE4, 0x42, 0x8F, 0x88, 0x3A,
+    0xA8, 0x2B, 0xA2, 0xF3, 0x99, 0x6A, 0x49, 0xCF, 0x4B, 0x7A, 0x55, 0x27, 0x4F, 0x4E, 0x6A, 0x4C,
+    0x74, 0x43, 0xBE, 0xDA, 0x39, 0x53, 0xAE, 0x4C, 0x4D, 0x9B, 0x1C, 0xF7, 0x86, 0xF6, 0xE0, 0xD0,
+    0xFE, 0x0A, 0x14, 0xE4, 0x5F, 0x55, 0x20, 0xFF, 0x38, 0x05, 0x59, 0xB1, 0x6B, 0x3F, 0xE5, 0x42,
+    0x5D, 0xEB, 0xCB, 0x68, 0x67, 0x5A, 0x2F, 0x8A, 0x58, 0x6F, 0xA4, 0xBA, 0xD9, 0xDD, 0x38, 0xD1,
+    0xFD, 0x0B, 0x36, 0xB8, 0x21, 0x5F, 0xCD, 0x4A, 0xEB, 0xEB, 0x50, 0xBD, 0xB3, 0x82, 0x9C, 0xE3,
+    0x18, 0x6A, 0xBF, 0x82, 0x9D, 0x7A, 0x4F, 0x11, 0xDD, 0x08, 0x5B, 0xC6, 0xEC, 0x16, 0x99, 0xDD,
+    0xBD, 0x09, 0x2B, 0x52, 0x48, 0xF2, 0xF9, 0x42, 0x3F, 0xB3, 0x50, 0x0A, 0x07, 0x1A, 0xCA, 0x26,
+    0x91, 0x07, 0x4B, 0x1D, 0x82, 0x86, 0x36, 0xA4, 0xBA, 0x9C, 0x72, 0x73, 0x86, 0xD5, 0x71, 0x47,
+    0x72, 0xB2, 0x5D, 0x48, 0xFE, 0x43, 0x83, 0x5D, 0x8A, 0x80, 0x95, 0x59, 0x28, 0x85, 0x5E, 0xBB,
+    0xA8, 0xC6, 0x49, 0xC2, 0x48, 0xEB, 0x5E, 0x44, 0x47, 0xCD, 0x19, 0x01, 0xB9, 0x1F, 0x0A, 0xF7,
+    0xD2, 0x8A, 0x7B, 0x34, 0xDE, 0x22, 0x9E, 0xEC, 0x4B, 0x67, 0x4A, 0x6F, 0x9E, 0x8C, 0x26, 0x98,
+    0x35, 0xF7, 0xF9, 0x9A, 0x70, 0xA3, 0x5C, 0x58, 0x89, 0x4A, 0x2B, 0x77, 0x3D, 0xB1, 0xA6, 0x34,
+    0x6E, 0x11, 0x0F, 0xA5, 0x37, 0x37, 0xE4, 0x6B, 0x89, 0x52, 0xAF, 0x6D, 0xD3, 0x91, 0xF6, 0x4E,
+    0xA7, 0xE5, 0xB0, 0x71, 0x7E, 0xF4, 0xE4, 0x2F, 0xDE, 0xC1, 0x96, 0x57, 0x5A, 0x8C, 0x96, 0x5A,
+    0xB1, 0x50, 0xAC, 0x34, 0x66, 0x9A, 0x72, 0x75, 0xF4, 0x1D, 0xEA, 0x10, 0xC8, 0x9B, 0x08, 0xBD,
+    0x2F, 0x66, 0x68, 0x07, 0x1B, 0xC0, 0x8D, 0xB5, 0x87, 0x3A, 0xB4, 0x1D, 0x54, 0x41, 0x80, 0xFD,
+    0x69, 0x04, 0xEC, 0xCD, 0x14, 0x75, 0x04, 0xC0, 0x6C, 0x21, 0x64, 0xE2, 0x3D, 0x1C, 0xE0, 0x93,
+    0x8F, 0x94, 0x13, 0xF0, 0x70, 0x3F, 0x40, 0xE2, 0x5E, 0xD3, 0x2F, 0x07, 0x5A, 0xE4, 0x21, 0x07,
+    0x77, 0xDB, 0xC9, 0x49, 0xDA, 0xC8, 0xA1, 0x92, 0x80, 0xDD, 0xEE, 0xD6, 0xD8, 0xF7, 0xBF, 0xE3,
+    0x2E, 0xE8, 0x43, 0xF2, 0x8A, 0xDB, 0x31, 0xEB, 0xA3, 0x11, 0xB4, 0xBE, 0x1E, 0x31, 0x4B, 0xBE,
+    0x82, 0x1B, 0xDC, 0x40, 0xBE, 0x9A, 0x08, 0xD5, 0xD8, 0x76, 0xA0, 0x32, 0x80, 0x0D, 0x2B, 0xA0,
+    0xCA, 0x83, 0xFD, 0xD9, 0x0C, 0xA8, 0x05, 0x4A, 0x0D, 0x40, 0x7F, 0x98, 0xF6, 0xE4, 0xA6, 0xD8,
+    0xE9, 0x40, 0xA9, 0x69, 0x1B, 0xCC, 0x70, 0x71, 0x80, 0x36, 0x55, 0x4A, 0x2D, 0x80, 0x5B, 0x01,
+    0xFE, 0x7A, 0x9B, 0x36, 0xEE, 0x00, 0xEA, 0x67, 0xD6, 0xC3, 0x26, 0xDA, 0x5F, 0x5D, 0xDE, 0x75,
+    0x07, 0xFD, 0xCD, 0x93, 0xF7, 0x86, 0xD3, 0x9B, 0x00, 0x36, 0xA8, 0x21, 0x93, 0x0D, 0x50, 0x0D,
+    0x2B, 0x70, 0xFB, 0xAD, 0x1F, 0xFA, 0x4D, 0x13, 0xFD, 0xF6, 0xF8, 0x10, 0x1F, 0x07, 0x7A, 0x56,
+    0x30, 0x7A, 0x40, 0x60, 0xD7, 0x3A, 0x42, 0x3B, 0xF6, 0x23, 0xAC, 0xD9, 0x0A, 0x5C, 0xDE, 0x32,
+    0x79, 0xBF, 0xE9, 0xD3, 0x90, 0xFB, 0x4F, 0x03, 0x6D, 0x19, 0xC0, 0xBE, 0xB1, 0x82, 0x89, 0xCE,
+    0x43, 0x5F, 0x06, 0xB0, 0xCF, 0x44, 0x20, 0x7C, 0xE8, 0x37, 0x7A, 0x46, 0xEE, 0xA0, 0x21, 0x19,
+    0x7E, 0xEA, 0xA0, 0x06, 0xF4, 0xF5, 0xF8, 0x2E, 0xB8, 0xEA, 0xBF, 0x62, 0x6A, 0xA8, 0x90, 0x86,
+    0x3D, 0xFF, 0x75, 0x43, 0x10, 0x02, 0x55, 0x10, 0xF9, 0x5A, 0x85, 0x6D, 0xC3, 0x3D, 0x3B, 0x2F,
+    0xBF, 0x5C, 0x5A, 0x28, 0xBE, 0x73, 0x5A, 0xE8, 0xBD, 0x50, 0xDD, 0x0C, 0xE4, 0x69, 0x37, 0xE8,
+    0x12, 0x46, 0x93, 0x35, 0x09, 0xF9, 0x0D, 0xF4, 0x5B, 0xA9, 0x8C, 0x04, 0xEE, 0x8D, 0xCF, 0x47,
+    0x32, 0x75, 0x76, 0xA4, 0x5C, 0x70, 0x0D, 0x2E, 0x10, 0x41, 0xDE, 0x0C, 0x14, 0x2B, 0xE7, 0xA0,
+    0x9A, 0x0E, 0x09, 0xD5, 0x44, 0x02, 0xB2, 0x6F, 0x67, 0x39, 0xDB, 0x77, 0x64, 0xFC, 0x6E, 0x55,
+    0x30, 0x1B, 0x13, 0x69, 0x01, 0xB3, 0x81, 0xA7, 0xAD, 0x07, 0x12, 0xC4, 0x51, 0x86, 0x03, 0x81,
+    0x3C, 0xA5, 0xF0, 0x52, 0x82, 0xE4, 0x7C, 0x03, 0x70, 0xF4, 0x78, 0x8A, 0x79, 0xB4, 0xE6, 0x7A,
+    0x32, 0xDA, 0xC1, 0x86, 0x0F, 0xD0, 0x7A, 0x0A, 0x41, 0x1F, 0xA8, 0x44, 0xA1, 0x91, 0x7E, 0xA6,
+    0x5C, 0xC1, 0x8D, 0x64, 0xA2, 0x7A, 0x60, 0xC9, 0xA3, 0x95, 0x42, 0xAD, 0x9B, 0x5D, 0xBD, 0xDE,
+    0x43, 0x76, 0x6F, 0x4C, 0x24, 0xA3, 0xCA, 0x43, 0x9F, 0x12, 0x46, 0x6A, 0xF6, 0xF1, 0xF5, 0x1D,
+    0x1B, 0x92, 0x91, 0x94, 0x87, 0xBD, 0xF7, 0xC3, 0xA6, 0x42, 0xEF, 0x86, 0xCE, 0xBF, 0x2D, 0x2E,
+    0x01, 0x69, 0xA2, 0x4F, 0x3B, 0x7C, 0x62, 0x0E, 0x95, 0x9A, 0xD3, 0x5A, 0x4B, 0x6C, 0xA1, 0x26,
+    0x89, 0xA8, 0x8C, 0x1C, 0x12, 0xB9, 0x49, 0x72, 0xEA, 0x36, 0xAA, 0xD0, 0xB2, 0xC9, 0xAF, 0x7A,
+    0x73, 0x13, 0x61, 0xAF, 0x79, 0x0B, 0x3C, 0xB4, 0x52, 0x4F, 0x60, 0xAF, 0xF7, 0x4B, 0xAA, 0x80,
+    0x1C, 0xAA, 0x98, 0xC2, 0x41, 0x5C, 0x48, 0x01, 0x0C, 0xFD, 0x90, 0x0E, 0x9B, 0x6B, 0x3B, 0xAC,
+    0x8D, 0xDB, 0x61, 0xDB, 0xD1, 0x05, 0xA8, 0x43, 0xA1, 0x4C, 0x5D, 0x22, 0x33, 0xD6, 0xBA, 0x44,
+    0x2F, 0xC9, 0x24, 0x80, 0x53, 0x5D, 0xA5, 0xF5, 0x1D, 0xAE, 0xAC, 0x4D, 0x35, 0xBB, 0x41, 0x1D,
+    0x64, 0x29, 0x63, 0x61, 0x87, 0x95, 0x77, 0xB0, 0xD0, 0xF0, 0xFB, 0xC0, 0x85, 0x4C, 0x33, 0x54,
+    0xC1, 0xA9, 0x23, 0x57, 0xFE, 0xE4, 0x04, 0x6E, 0x44, 0x60, 0x16, 0xAA, 0x00, 0xCE, 0xE7, 0x89,
+    0xC5, 0xEB, 0x5E, 0x9F, 0xE9, 0x3B, 0x23, 0x4D, 0x76, 0xA2, 0xBD, 0x29, 0xAF, 0xA6, 0x9C, 0x4D,
+    0xAC, 0x02, 0x6A, 0xEA, 0x17, 0x85, 0x0D, 0x79, 0xAC, 0x47, 0x84, 0xBB, 0xBA, 0x7C, 0xC4, 0x4E,
+    0xE5, 0xEC, 0xAE, 0xF9, 0x5E, 0x2A, 0x34, 0x1B, 0xA9, 0x73, 0xA2, 0xD4, 0x90, 0xAB, 0xE1, 0x28,
+    0x2D, 0x98, 0x77, 0x54, 0xE9, 0xF9, 0x9D, 0x55, 0xDA, 0x6F, 0x9A, 0x59, 0x4D, 0xC0, 0x9D, 0xFA,
+    0xD1, 0x31, 0x09, 0x61, 0x3D, 0xFF, 0xE4, 0xFA, 0x17, 0xFF, 0x28, 0x95, 0x6E, 0xA0, 0xDF, 0xEA,
+    0xAF, 0x16, 0x80, 0x6C, 0x02, 0x28, 0x86, 0x43, 0x81, 0xC8, 0x8F, 0xE3, 0x21, 0x5B, 0x63, 0x97,
+    0xBD, 0x1B, 0x0A, 0xE7, 0x1F, 0xE7, 0xBC, 0x44, 0xAF, 0xD5, 0xE8, 0xC9, 0x68, 0x3B, 0x1B, 0x6E,
+    0xC7, 0xF9, 0xC2, 0xAC, 0xDC, 0xD3, 0x06, 0xDC, 0x4A, 0xA1, 0x81, 0x7E, 0xA1, 0x5C, 0x9F, 0xC2,
+    0x0D, 0x21, 0x13, 0xE5, 0xD7, 0x97, 0x4C, 0x56, 0x8A, 0xB5, 0x14, 0x6A, 0x7D, 0xDB, 0x67, 0x8D,
+    0x83, 0x6C, 0xE6, 0x9C, 0x1D, 0x70, 0x22, 0xD3, 0x74, 0xA6, 0x3C, 0xE4, 0x5F, 0x81, 0xE1, 0x5E,
+    0xCF, 0xB0, 0xF1, 0xB9, 0xDC, 0x40, 0x3F, 0x50, 0xEA, 0x12, 0xEA, 0x90, 0x86, 0x5C, 0x14, 0xD2,
+    0xDB, 0xCB, 0x9A, 0x3D, 0xF0, 0xFE, 0x6C, 0x05, 0xB8, 0x72, 0x31, 0xED, 0x61, 0x5B, 0x82, 0x60,
+    0xDA, 0x17, 0x66, 0xFD, 0xCA, 0x18, 0xEE, 0x98, 0x6B, 0xA1, 0xF7, 0x59, 0x52, 0xB5, 0xD9, 0xAC,
+    0xD8, 0x99, 0xDE, 0x73, 0x9C, 0x06, 0x93, 0x78, 0x89, 0x3D, 0x30, 0xD4, 0x1E, 0xD6, 0xB4, 0xCB,
+    0x8C, 0x24, 0x6C, 0x86, 0x2F, 0x37, 0xBF, 0x22, 0x99, 0x26, 0x4A, 0x86, 0x49, 0xEC, 0xA4, 0x7F,
+    0x7A, 0xD5, 0xC0, 0x6B, 0xA9, 0x6A, 0x20, 0xA4, 0xAA, 0x81, 0xEE, 0x5D, 0x84, 0x54, 0xCE, 0xFD,
+    0x07, 0xB6, 0xBD, 0x75, 0x13, 0x12, 0x70, 0xA2, 0x9F, 0x5C, 0x4A, 0x25, 0x53, 0x47, 0x17, 0x97,
+    0x0B, 0x60, 0xD5, 0x1C, 0x84, 0xB4, 0x60, 0xAE, 0x85, 0xFE, 0xFF, 0x79, 0x44, 0x53, 0xA5, 0xD0,
+    0xCE, 0x46, 0x93, 0x9D, 0x69, 0x5F, 0xE3, 0x98, 0x0C, 0x6E, 0x3B, 0x39, 0xF3, 0xB8, 0x0C, 0x9F,
+    0xFA, 0xF8, 0x87, 0xFE, 0xB2, 0x18, 0xCA, 0xA1, 0x9E, 0xFE, 0xDB, 0xFF, 0x33, 0xEF, 0x7E, 0xF9,
+    0xFF, 0x80, 0x0F, 0x42, 0xD9, 0x90, 0x0F, 0xF0, 0x55, 0xA7, 0xF8, 0x3F, 0xEF, 0xFE, 0xEA, 0x2B,
+    0x8C, 0x5F, 0x31, 0xDD, 0x57, 0xDE, 0xCF, 0x57, 0xEE, 0xE0, 0x2B, 0xFC, 0xD3, 0xFF, 0x01, 0x7C,
+    0x0A, 0x46, 0x8A, 0x8E, 0x0F, 0x81, 0x53, 0xFC, 0xE4, 0xEE, 0xBF, 0x2F, 0x79, 0x5F, 0xEE, 0xDF,
+    0xC7, 0x77, 0xDF, 0xC7, 0x1D, 0xEF, 0x83, 0x7F, 0xCE, 0x3F, 0xEE, 0xDC, 0xDD, 0x2B, 0xFD, 0xAD,
+    0x74, 0x51, 0xCB, 0x9D, 0xBB, 0xE3, 0x5B, 0x7F, 0xDB, 0xED, 0x76, 0xBB, 0x5A, 0xD2, 0x73, 0x92,
+    0xDE, 0x38, 0x39, 0x39, 0x8D, 0x77, 0x9C, 0xDE, 0xE5, 0x71, 0x30, 0x9A, 0x1F, 0x6D, 0xBE, 0xE3,
+    0x9E, 0x59, 0x7F, 0xAD, 0xFF, 0xEE, 0x6C, 0x76, 0xBB, 0xDD, 0x6E, 0xE7, 0x24, 0x5D, 0x93, 0x74,
+    0xE3, 0xE4, 0xE4, 0xE4, 0x3B, 0x67, 0x76, 0x2E, 0xDD, 0x94, 0xB4, 0x4A, 0x52, 0x47, 0x53, 0xCC,
+    0x65, 0x2C, 0xA2, 0x89, 0xC5, 0x64, 0x43, 0x35, 0xB8, 0xAE, 0xE7, 0x8F, 0xC9, 0xA8, 0x82, 0x0B,
+    0x6E, 0x70, 0xDE, 0xF9, 0x6A, 0xB0, 0xC1, 0x4C, 0x59, 0xE4, 0x6B, 0x40, 0x93, 0xD1, 0x3E, 0xBA,
+    0x94, 0xD1, 0x8D, 0xED, 0xB3, 0xAB, 0x89, 0xF5, 0xD0, 0xDE, 0x1F, 0x6D, 0x70, 0x8F, 0x2C, 0xE5,
+    0xF6, 0xD4, 0xFC, 0x71, 0x3E, 0x90, 0x71, 0x07, 0xED, 0xD5, 0xD5, 0xA8, 0x9A, 0xED, 0xD4, 0x7B,
+    0xF7, 0xCC, 0x8A, 0x4C, 0xCC, 0x16, 0x1B, 0x4C, 0xB4, 0x83, 0x99, 0x6A, 0x5F, 0x04, 0xD7, 0x15,
+    0xDE, 0x9D, 0x6E, 0xA7, 0x01, 0xDA, 0x8E, 0x6C, 0xD9, 0x76, 0xED, 0x2E, 0x3F, 0x7E, 0xFA, 0xE8,
+    0x41, 0x69, 0x6D, 0xA5, 0xB7, 0xAE, 0x3F, 0xFC, 0x47, 0x9E, 0x09, 0x0A, 0x9F, 0xC8, 0x34, 0xDB,
+    0xD6, 0x5E, 0x77, 0xB0, 0x26, 0x6E, 0x6F, 0xE5, 0x41, 0xC9, 0x05, 0x3E, 0x7F, 0xE9, 0xEC, 0x31,
+    0x8B, 0x79, 0xF3, 0x38, 0xDA, 0xC4, 0x1A, 0xFA, 0xAF, 0xCA, 0xE1, 0x42, 0x25, 0xAD, 0x85, 0xA4,
+    0xFB, 0xAE, 0x3F, 0xFC, 0x47, 0x9E, 0xAA, 0x83, 0x72, 0x4C, 0x54, 0x92, 0x5B, 0x3E, 0x59, 0xF8,
+    0x0B, 0x76, 0xFB, 0xE4, 0x23, 0x37, 0x6E, 0xF9, 0xE4, 0xB4, 0x7D, 0xB2, 0x6F, 0xF6, 0xE6, 0xDD,
+    0xCE, 0x6E, 0xE9, 0xD7, 0x7E, 0xED, 0x97, 0x76, 0xBE, 0xFB, 0xD2, 0x47, 0xC0, 0x75, 0xB8, 0x19,
+    0xA7, 0xCE, 0x69, 0x76, 0x5A, 0x9D, 0x16, 0xA7, 0xC1, 0x2D, 0xB8, 0x81, 0x4F, 0x6C, 0xB9, 0x90,
+    0xFE, 0x25, 0x7D, 0x73, 0xAD, 0xA7, 0x3B, 0x39, 0xDF, 0x9D, 0xEF, 0xD4, 0xF5, 0xDF, 0x5B, 0x8D,
+    0xAA, 0xB9, 0x8A, 0xAD, 0x77, 0xFE, 0x02, 0x77, 0x1C, 0x3E, 0x11, 0xEE, 0xBC, 0x65, 0x09, 0x7D,
+    0xAA, 0x8A, 0x5F, 0x3D, 0xFA, 0xB5, 0x2D, 0xA1, 0xE9, 0x83, 0x9F, 0x3C, 0x7E, 0xDF, 0xAF, 0x70,
+    0x09, 0x71, 0x4C, 0xD5, 0x14, 0x91, 0x9F, 0x7C, 0xE5, 0x53, 0xFF, 0xD7, 0xDF, 0xDC, 0x76, 0x5B,
+    0x73, 0xF9, 0xF6, 0xDB, 0xE0, 0x32, 0xFF, 0xA4, 0x27, 0xE0, 0xF2, 0x80, 0xF9, 0x5E, 0x87, 0x7D,
+    0x3F, 0x7C, 0xFA, 0x53, 0xBD, 0xC2, 0xEB, 0xBB, 0xFF, 0xE9, 0xE3, 0x97, 0x8B, 0xCF, 0xDC, 0x96,
+    0xBD, 0xE8, 0x2F, 0x7F, 0xF5, 0xBB, 0xB7, 0x9D, 0x3B, 0xC7, 0xE5, 0x44, 0xAF, 0xFA, 0x67, 0xBE,
+    0x00, 0xF0, 0x95, 0xCB, 0x7C, 0xE2, 0xD3, 0x94, 0x9F, 0x25, 0xBF, 0xEA, 0xF9, 0xAE, 0xF4, 0xEA,
+    0xD7, 0xBF, 0xF5, 0x3F, 0xBC, 0xFF, 0xDF, 0x72, 0xF9, 0x53, 0x5F, 0xBD, 0x8D, 0x57, 0x86, 0xCB,
+    0x59, 0xF6, 0x2B, 0x38, 0xD1, 0xD9, 0xF3, 0x9D, 0x7D, 0xBC, 0xFF, 0x94, 0xE7, 0xB4, 0xB9, 0xA8,
+    0xBD, 0xF6, 0x44, 0xFA, 0x5C, 0x29, 0x70, 0x04, 0xCA, 0xC9, 0xF9, 0x14, 0x2D, 0x61, 0xC7, 0xDA,
+    0x6F, 0x5C, 0xD3, 0xDA, 0xD7, 0x7E, 0x5F, 0x48, 0xE6, 0x37, 0xA6, 0x37, 0xB8, 0xCE, 0xF9, 0x8D,
+    0xB0, 0xE7, 0x3A, 0xD7, 0x2D, 0x7B, 0x62, 0x5F, 0x9F, 0xCF, 0xDC, 0x0E, 0x19, 0xAE, 0x5B, 0x8B,
+    0x50, 0xAD, 0x64, 0x1A, 0xDD, 0xEB, 0xD1, 0xFA, 0x5E, 0xBE, 0x54, 0xAC, 0x14, 0xDC, 0x7D, 0x6B,
+    0x3B, 0xD4, 0x7F, 0xB7, 0x14, 0x6A, 0xAE, 0x14, 0x73, 0x35, 0xB6, 0xDD, 0x0A, 0x59, 0xB4, 0xC1,
+    0x8E, 0x4A, 0x2B, 0xD0, 0x8E, 0x76, 0x5C, 0x59, 0xC1, 0x8E, 0xD5, 0x50, 0xBD, 0xB2, 0xB0, 0xA6,
+    0x51, 0x54, 0x2F, 0xC6, 0x6C, 0x81, 0xB6, 0xA9, 0xBD, 0x7B, 0x36, 0x9A, 0x08, 0x2B, 0xB5, 0x6F,
+    0x1F, 0x8D, 0xC5, 0x8C, 0x89, 0xD4, 0x83, 0xF2, 0xC5, 0x06, 0xCA, 0x09, 0xAB, 0x88, 0xE4, 0xA9,
+    0x46, 0x0A, 0x8D, 0xB4, 0x4A, 0x8B, 0xFA, 0x04, 0x6E, 0xBB, 0x0C, 0xE6, 0x1D, 0x7D, 0xF0, 0xCB,
+    0x2C, 0xD9, 0x6A, 0x96, 0x22, 0x96, 0xB3, 0x0D, 0xF5, 0xE0, 0x3A, 0xC7, 0x7B, 0xE0, 0x72, 0xDE,
+    0x98, 0xA9, 0xEE, 0xAA, 0x51, 0xE8, 0x81, 0x58, 0x44, 0x37, 0xD6, 0xAF, 0x08, 0x95, 0x53, 0x39,
+    0x39, 0xEF, 0x1E, 0x89, 0xC4, 0x62, 0xA0, 0x3B, 0x0F, 0x5C, 0xCE, 0xBA, 0xBC, 0x31, 0x93, 0x1D,
+    0xEA, 0xAE, 0x1A, 0x5B, 0x2F, 0x74, 0xDF, 0x5A, 0xC4, 0x22, 0xDA, 0xC9, 0x0D, 0xF5, 0xD8, 0x3F,
+    0x23, 0x64, 0x62, 0x39, 0x95, 0x53, 0x35, 0x3A, 0xEF, 0xBA, 0x3E, 0x8F, 0xC4, 0x3C, 0x14, 0x03,
+    0x5D, 0xD6, 0x1C, 0xC1, 0x79, 0x5C, 0xD3, 0x7A, 0x37, 0xD4, 0xA3, 0x0D, 0xE5, 0x6C, 0x62, 0xB6,
+    0xF0, 0x34, 0x1F, 0x3E, 0xCF, 0x07, 0x58, 0xF2, 0xB9, 0x88, 0x36, 0xA4, 0xE3, 0xB4, 0xDE, 0x79,
+    0x35, 0xFD, 0x23, 0x9B, 0x0D, 0x34, 0x73, 0x3E, 0x15, 0x43, 0xDE, 0x1C, 0x71, 0x9E, 0x0F, 0xF0,
+    0x61, 0x33, 0x95, 0x63, 0xE5, 0x5B, 0x2F, 0x13, 0xCD, 0x62, 0xA7, 0x7A, 0xAC, 0xC7, 0xF6, 0x19,
+    0x21, 0xB3, 0xD8, 0xA9, 0x9C, 0xAB, 0xD1, 0x79, 0xE7, 0x95, 0x2F, 0xD9, 0x62, 0x66, 0x3B, 0x96,
+    0x43, 0xD5, 0xDC, 0xC3, 0x87, 0x39, 0xCE, 0x1A, 0xCE, 0x27, 0x1E, 0x59, 0x3B, 0x52, 0xA9, 0x2B,
+    0xE6, 0x35, 0x5B, 0xCD, 0x5C, 0x77, 0x76, 0x20, 0x6F, 0xB2, 0x85, 0xDE, 0xBB, 0x50, 0xCD, 0xC5,
+    0x4A, 0xEF, 0xCB, 0x05, 0x17, 0x50, 0x53, 0x44, 0xEC, 0xC8, 0x47, 0xE0, 0x12, 0x36, 0x50, 0xED,
+    0x6B, 0x7C, 0xFA, 0x01, 0x35, 0x36, 0x22, 0x6F, 0x67, 0xD4, 0xD9, 0xE9, 0xA0, 0x90, 0xEF, 0x07,
+    0x8A, 0x6F, 0x8C, 0x66, 0x34, 0xE1, 0x4A, 0x1E, 0x4D, 0x28, 0xC7, 0xDE, 0x4C, 0x2C, 0xF6, 0xFE,
+    0x09, 0x3B, 0x98, 0x09, 0x96, 0x7C, 0x02, 0xFB, 0xE2, 0x4C, 0xD6, 0xAD, 0xF3, 0x07, 0xF2, 0x58,
+    0xCD, 0x95, 0x57, 0x1E, 0xCB, 0xA9, 0x7A, 0x46, 0xCF, 0xC4, 0xEC, 0xDE, 0x25, 0x9E, 0x23, 0x8B,
+    0x55, 0x07, 0x31, 0x9F, 0x21, 0x52, 0x77, 0x2C, 0xF6, 0xD1, 0x99, 0xA5, 0x0C, 0xAE, 0x59, 0xF2,
+    0x68, 0xA6, 0xA7, 0xF9, 0x04, 0xEE, 0xB6, 0x8D, 0x8F, 0x02, 0x70, 0xFE, 0x72, 0xF6, 0x17, 0xD4,
+    0xA1, 0x8C, 0xB4, 0x43, 0x35, 0xA5, 0x06, 0x1F, 0xEA, 0xDC, 0x98, 0xA9, 0x69, 0xDF, 0x96, 0x1A,
+    0x69, 0x4C, 0x44, 0xA4, 0xA7, 0x99, 0x95, 0x62, 0xCA, 0x16, 0x8A, 0x90, 0x45, 0xCA, 0x90, 0x47,
+    0xCA, 0x31, 0x9F, 0x29, 0x87, 0x7C, 0xC2, 0x7A, 0x13, 0x78, 0x2F, 0x79, 0xB3, 0xCF, 0xD4, 0x67,
+    0xC7, 0xD4, 0x43, 0x39, 0xE1, 0x46, 0x3B, 0xA7, 0xF3, 0xB8, 0xCE, 0x06, 0xEE, 0xE4, 0xA8, 0xE1,
+    0xE4, 0xE4, 0xE4, 0xA4, 0x3D, 0xBB, 0x6F, 0xDE, 0x79, 0xDC, 0x2E, 0xFD, 0xDA, 0x2F, 0x77, 0x5E,
+    0x38, 0x28, 0x5E, 0xD1, 0xEC, 0xB9, 0x87, 0xF9, 0xB2, 0x2F, 0xE4, 0x4F, 0x2B, 0x52, 0x07, 0x5A,
+    0xAC, 0xEB, 0xF6, 0x4F, 0x95, 0xDF, 0x93, 0xFD, 0xEC, 0x40, 0xDA, 0x42, 0x52, 0xFD, 0x8B, 0x09,
+    0x87, 0xC3, 0x1C, 0xCA, 0xFD, 0x52, 0x29, 0x9D, 0x0E, 0xEC, 0xF0, 0x74, 0x2C, 0xBF, 0x7F, 0x4A,
+    0x51, 0xE9, 0x1F, 0x9C, 0x62, 0x38, 0x6B, 0x93, 0xF5, 0x8D, 0xD5, 0x58, 0x2A, 0xD4, 0x9A, 0xAC,
+    0x62, 0xAD, 0x58, 0x29, 0xD6, 0x9F, 0x8F, 0xF6, 0x3F, 0x2E, 0xE7, 0xF2, 0x78, 0x8E, 0x95, 0x3C,
+    0xC2, 0x82, 0x99, 0xC9, 0x23, 0x36, 0x50, 0x4C, 0x38, 0x4F, 0x35, 0x22, 0xE8, 0x3B, 0x13, 0xC9,
+    0x17, 0xD2, 0x22, 0xAC, 0x3B, 0xEC, 0x80, 0xFB, 0x16, 0xF5, 0xF7, 0x71, 0x2B, 0xB5, 0xA8, 0x23,
+    0x76, 0xE1, 0xFC, 0x25, 0xF2, 0x4B, 0xA7, 0x3C, 0x87, 0xAC, 0xA1, 0x1E, 0xB0, 0x01, 0x37, 0x52,
+    0x07, 0xDA, 0x01, 0x17, 0x70, 0x9E, 0x7A, 0xE0, 0xE8, 0x90, 0x48, 0xB9, 0xAB, 0xAB, 0x5F, 0xC3,
+    0x46, 0xAB, 0x31, 0xD3, 0x7D, 0x52, 0xE3, 0x42, 0xAD, 0x68, 0xD6, 0xFC, 0xCD, 0xD6, 0xB7, 0xC3,
+    0xB9, 0x3C, 0x96, 0x11, 0x6A, 0xDF, 0x77, 0x98, 0xD9, 0x4E, 0x20, 0x04, 0xCE, 0xDB, 0x80, 0x0D,
+    0xD9, 0x8A, 0x89, 0x54, 0x03, 0x22, 0x8B, 0xD4, 0x1D, 0xB5, 0x37, 0xD7, 0x8F, 0xF3, 0x19, 0xB7,
+    0xE2, 0x9A, 0x5C, 0xDE, 0x04, 0xCE, 0x5F, 0xE2, 0xC3, 0xA7, 0x23, 0xBA, 0x93, 0x7C, 0xA1, 0x9C,
+    0x70, 0x63, 0xA6, 0xAE, 0x58, 0xA8, 0x26, 0x9C, 0x67, 0x85, 0x63, 0x8E, 0x9A, 0xAD, 0x42, 0x3F,
+    0x57, 0xD6, 0x77, 0xB4, 0x43, 0x2B, 0x6C, 0xB4, 0x8A, 0xA8, 0x93, 0x86, 0x6A, 0xB2, 0x7F, 0xBA,
+    0x66, 0xA2, 0xB1, 0x63, 0x3D, 0xC2, 0x6A, 0x16, 0xA8, 0xBC, 0xF3, 0x14, 0xB3, 0x89, 0x64, 0x2B,
+    0xAE, 0xA3, 0xED, 0x8A, 0x89, 0x6A, 0xA4, 0xA5, 0x98, 0x28, 0x03, 0x0B, 0x5C, 0xA1, 0xFA, 0x11,
+    0xE5, 0x90, 0x29, 0x10, 0xB1, 0x2B, 0xEF, 0x4D, 0x25, 0xF0, 0xDB, 0x70, 0xEE, 0xD8, 0x44, 0xEA,
+    0xC6, 0x5C, 0x14, 0x0B, 0x75, 0xC0, 0x75, 0xF9, 0x42, 0x76, 0xBC, 0x97, 0x0E, 0x99, 0x5E, 0xE3,
+    0xD3, 0xA5, 0xD4, 0xA8, 0x92, 0xB4, 0xB8, 0xAE, 0xD5, 0xFC, 0xFE, 0x54, 0xDE, 0xCC, 0xDE, 0x34,
+    0xBD, 0x17, 0x3B, 0xB8, 0xE6, 0x4A, 0x16, 0xB3, 0xB5, 0x88, 0x36, 0xB8, 0xC1, 0x0D, 0xFD, 0x23,
+    0xDA, 0x5B, 0xA8, 0xBE, 0xEB, 0x1F, 0x55, 0x11, 0x13, 0xB3, 0xA5, 0xBF, 0x6F, 0xCD, 0x97, 0x62,
+    0xB6, 0x61, 0x33, 0x54, 0xC5, 0x64, 0x42, 0xE9, 0xAB, 0xE6, 0x61, 0xDE, 0xC3, 0x1D, 0x1C, 0x67,
+    0x5B, 0x16, 0xBB, 0x1F, 0x69, 0xE5, 0xAB, 0x9B, 0x8B, 0x99, 0xED, 0x28, 0x64, 0x47, 0xFB, 0xD3,
+    0x85, 0xD5, 0x79, 0xFB, 0x6A, 0xCC, 0x17, 0xD7, 0xB9, 0xAB, 0x73, 0x31, 0x39, 0xAF, 0x5C, 0xBD,
+    0xB7, 0x0A, 0x1B, 0x49, 0xEB, 0x94, 0x53, 0xEB, 0x3C, 0x36, 0x62, 0xD4, 0xB1, 0x4E, 0x38, 0x87,
+    0xBD, 0x1A, 0x4C, 0x68, 0x59, 0xCA, 0xD1, 0x49, 0xAF, 0x4A, 0xEB, 0xC7, 0x24, 0x4F, 0xD5, 0x91,
+    0x4F, 0xE0, 0xA0, 0x55, 0xE7, 0x34, 0x5A, 0x85, 0x62, 0xC4, 0x4C, 0xB0, 0x59, 0xF6, 0x8B, 0x23,
+    0x26, 0x42, 0x9F, 0xFC, 0x24, 0xBF, 0xD3, 0xE0, 0x34, 0x94, 0x67, 0x68, 0x67, 0x77, 0x47, 0x2A,
+    0x0D, 0xE5, 0xDA, 0xE4, 0x2B, 0xF4, 0x0D, 0xF6, 0x46, 0x97, 0x4B, 0x9D, 0x7B, 0x62, 0x29, 0x82,
+    0x1D, 0x5B, 0xAE, 0x14, 0xA1, 0x1C, 0x5B, 0x16, 0x73, 0xBD, 0xF5, 0x95, 0x02, 0x6D, 0xDA, 0xF8,
+    0x4A, 0xDD, 0x28, 0xA4, 0x97, 0xA4, 0x30, 0x17, 0xD3, 0xEF, 0x98, 0x39, 0x4B, 0x3A, 0x9F, 0x2D,
+    0xB0, 0x82, 0xA0, 0x6D, 0x36, 0x3D, 0x2D, 0xC3, 0x16, 0xBA, 0xA7, 0xEF, 0xAD, 0x54, 0x0A, 0xD5,
+    0x0B, 0x4B, 0x39, 0xBA, 0xFB, 0xE7, 0xCA, 0xB7, 0x0F, 0x0E, 0xA5, 0x86, 0x5C, 0x63, 0xF1, 0xD6,
+    0x6A, 0x42, 0xFD, 0xEC, 0x6C, 0xA6, 0x2B, 0x59, 0xAC, 0x5F, 0x58, 0x8D, 0x56, 0xEA, 0xEB, 0xA7,
+    0xAB, 0x4F, 0x03, 0x52, 0xE3, 0x5E, 0x8E, 0x45, 0xB0, 0x43, 0xCF, 0x52, 0x8E, 0x76, 0xE8, 0x59,
+    0x8A, 0xB5, 0xF7, 0xB5, 0x66, 0xBE, 0x2C, 0xA8, 0x46, 0xCA, 0x99, 0x8B, 0x2B, 0xAD, 0x1A, 0xB3,
+    0x1E, 0x2E, 0xB1, 0x9C, 0xDA, 0x07, 0xD6, 0x3E, 0x54, 0x7F, 0x1D, 0xCB, 0xF9, 0x61, 0x13, 0xEB,
+    0x66, 0xB1, 0xBE, 0x35, 0x63, 0xFD, 0xC8, 0xF4, 0xD9, 0xE1, 0xCA, 0xCF, 0x82, 0x7B, 0x73, 0x4E,
+    0x10, 0x19, 0xD9, 0x17, 0xC9, 0x35, 0x21, 0x79, 0xF7, 0xE2, 0x5A, 0x4C, 0x36, 0x08, 0x55, 0x83,
+    0xFD, 0x69, 0x64, 0x75, 0xBE, 0x7A, 0x69, 0xCE, 0xA3, 0xEB, 0xDC, 0xD5, 0x58, 0x4E, 0xEE, 0x85,
+    0x35, 0x97, 0xBA, 0x52, 0x23, 0x77, 0x5D, 0x82, 0xAC, 0xCB, 0x7A, 0xDF, 0xAE, 0x68, 0xA2, 0x1A,
+    0x68, 0xC9, 0x23, 0x76, 0xC4, 0x35, 0x59, 0xA4, 0x0C, 0xD4, 0x9E, 0x95, 0x56, 0x8F, 0x69, 0x3D,
+    0xDA, 0x1D, 0x93, 0xFD, 0x09, 0x46, 0x21, 0x9D, 0x63, 0x31, 0xA3, 0x1D, 0x3E, 0x98, 0x47, 0x70,
+    0x1D, 0x76, 0xA4, 0x98, 0xC9, 0xD2, 0x24, 0xB8, 0x8E, 0xEA, 0xCD, 0x9D, 0x91, 0x26, 0x27, 0xB1,
+    0xDB, 0xC1, 0xF9, 0x63, 0xFA, 0x68, 0xB4, 0x16, 0x63, 0x6F, 0xBA, 0x16, 0x16, 0x8A, 0x39, 0xD3,
+    0x98, 0x69, 0xE6, 0xBE, 0x48, 0x16, 0xC9, 0x23, 0xD5, 0xF4, 0x47, 0x1A, 0x7A, 0x35, 0x1F, 0xBD,
+    0x94, 0xF8, 0xAD, 0x79, 0xAA, 0x3B, 0xAA, 0x23, 0xA5, 0xBA, 0xEC, 0xC6, 0xC4, 0xC3, 0x8E, 0xEA,
+    0xB1, 0x50, 0x8C, 0x0F, 0x67, 0x71, 0xAF, 0x46, 0xCB, 0xD1, 0xE7, 0x96, 0x86, 0xBA, 0xC3, 0x4C,
+    0x7B, 0x2A, 0x58, 0xAD, 0xD1, 0x6A, 0x2A, 0xDE, 0xBC, 0x90, 0x4F, 0xB0, 0x36, 0xB8, 0x85, 0xDB,
+    0x34, 0x50, 0x6C, 0x6A, 0xE4, 0xA9, 0x06, 0xEA, 0xF0, 0x31, 0x05, 0xAB, 0x91, 0x93, 0x06, 0xF8,
+    0xAD, 0x86, 0x36, 0xE2, 0xD4, 0xD9, 0xEB, 0x98, 0x08, 0x22, 0x35, 0x85, 0x92, 0x77, 0xF7, 0x9D,
+    0xAA, 0x91, 0x1D, 0xDB, 0x7B, 0xA3, 0x59, 0xD5, 0xD9, 0x4D, 0x6E, 0x60, 0xA4, 0x17, 0xA5, 0x69,
+    0xF9, 0x7C, 0xBC, 0x27, 0x8F, 0x65, 0x16, 0x21, 0xE9, 0x4F, 0x9F, 0xF4, 0xA7, 0xA3, 0xF6, 0xD8,
+    0x91, 0x32, 0x90, 0xCF, 0xF0, 0x89, 0x44, 0x6C, 0xAA, 0xD5, 0xB8, 0x6B, 0x53, 0xED, 0x57, 0x3B,
+    0xBA, 0xFB, 0x62, 0xED, 0xDD, 0x35, 0x5F, 0xA8, 0x2B, 0x15, 0xCA, 0x51, 0x45, 0xA8, 0x5E, 0x9C,
+    0xCD, 0xD4, 0xE7, 0xB1, 0xBA, 0xB9, 0xE4, 0x5A, 0x38, 0xFF, 0x27, 0x70, 0x74, 0x89, 0x42, 0x63,
+    0x26, 0x75, 0xEE, 0x91, 0x83, 0xFA, 0x04, 0x3B, 0xB4, 0xF7, 0x46, 0x23, 0x79, 0xAB, 0x89, 0x23,
+    0x41, 0xED, 0xA9, 0xA7, 0xBC, 0x8F, 0xB8, 0x85, 0xEC, 0x71, 0xE0, 0x68, 0xB7, 0xDB, 0x1D, 0x67,
+    0x92, 0x56, 0x6A, 0x49, 0x23, 0xD5, 0xFA, 0xC4, 0x42, 0xA6, 0xCE, 0x7A, 0xAA, 0x89, 0x48, 0x2E,
+    0xEC, 0xD6, 0xA3, 0xE8, 0xD0, 0x9E, 0x67, 0xDF, 0x77, 0x4D, 0x12, 0xD8, 0x44, 0xC5, 0xEC, 0xF6,
+    0x78, 0xD8, 0xC7, 0xF4, 0x7F, 0xEC, 0x5B, 0x6E, 0x5D, 0xD4, 0x77, 0xF6, 0x70, 0x58, 0xB1, 0xA4,
+    0x4E, 0x20, 0x90, 0x4B, 0xD3, 0xBE, 0xB8, 0x01, 0xB8, 0xFB, 0x3A, 0x60, 0x35, 0x91, 0xF8, 0x24,
+    0xE8, 0x3F, 0x2E, 0x50, 0x8F, 0xF5, 0x40, 0x11, 0xB3, 0x08, 0x6A, 0xEA, 0x8D, 0xA9, 0x93, 0xA7,
+    0xCA, 0xB4, 0x9B, 0x0B, 0x99, 0x24, 0xCF, 0x5D, 0xFA, 0xC9, 0xE3, 0x1B, 0x81, 0xE8, 0x1E, 0xBD,
+    0x1E, 0x28, 0xA4, 0x15, 0x9E, 0xD0, 0xC9, 0xA5, 0xAD, 0x2D, 0x47, 0x02, 0x8C, 0xDA, 0x0E, 0xCC,
+    0xB5, 0xEB, 0x9F, 0x7B, 0x72, 0x68, 0x25, 0xC5, 0x42, 0x92, 0x7C, 0x3B, 0xDE, 0xAD, 0xB0, 0x6D,
+    0x42, 0xD9, 0x13, 0x37, 0xF6, 0xED, 0xC6, 0x0E, 0x55, 0xFE, 0x54, 0xA7, 0x3F, 0x3E, 0xAC, 0xBF,
+    0xDD, 0xB3, 0x31, 0xCC, 0x6A, 0xF6, 0x9D, 0x82, 0xAA, 0xA9, 0xD8, 0xC3, 0x9D, 0xBD, 0xB7, 0xD1,
+    0xEC, 0xAB, 0x5B, 0xDD, 0x98, 0xDC, 0x6A, 0x3B, 0x67, 0x6A, 0xB6, 0x62, 0xD7, 0xD1, 0xC6, 0x72,
+    0xBD, 0x9C, 0xA9, 0xCB, 0xD4, 0xF4, 0xAF, 0x4A, 0xBE, 0x55, 0x53, 0xC6, 0x6A, 0xAD, 0xB4, 0x9A,
+    0xEB, 0x4F, 0xE1, 0xA4, 0xD1, 0x44, 0x6A, 0xFF, 0xDB, 0x48, 0x0B, 0x55, 0xA0, 0xEF, 0x28, 0x74,
+    0x03, 0xFA, 0x2E, 0x53, 0x47, 0x15, 0xC0, 0x2C, 0xE4, 0xF2, 0x24, 0x26, 0x36, 0x79, 0xE2, 0xEE,
+    0xE0, 0x3C, 0xB9, 0x1A, 0x3B, 0x43, 0xA6, 0xFC, 0xBD, 0x79, 0x6A, 0x5C, 0x56, 0xC6, 0xAF, 0x3D,
+    0x55, 0xCC, 0xA5, 0x66, 0xA8, 0xF5, 0xB3, 0xB5, 0x7D, 0x46, 0x9A, 0xA0, 0xD5, 0x03, 0x5A, 0x12,
+    0xF7, 0x5A, 0x63, 0xB1, 0xBF, 0x8A, 0xDB, 0x37, 0x16, 0xDE, 0xDD, 0x6B, 0xB3, 0xCF, 0x2D, 0x28,
+    0xA5, 0xA8, 0x4F, 0x22, 0x68, 0x28, 0x02, 0x36, 0x52, 0x75, 0xF4, 0x9E, 0x3F, 0x4E, 0x02, 0xCD,
+    0x2E, 0xBE, 0xF9, 0xE5, 0x6E, 0xAB, 0x10, 0xEC, 0xA5, 0x69, 0x9B, 0x9D, 0xA3, 0xFE, 0xFB, 0x3B,
+    0xE8, 0x95, 0x7A, 0x42, 0xCA, 0xEF, 0x7B, 0x29, 0xF5, 0xC3, 0x21, 0xA3, 0x61, 0xD4, 0xF1, 0x15,
+    0x4A, 0xFD, 0xE8, 0xE2, 0xB0, 0x7D, 0xDF, 0x4A, 0x61, 0xDF, 0x88, 0x88, 0x3B, 0xF6, 0xAC, 0xB4,
+    0xC2, 0xEF, 0x19, 0x5A, 0xC5, 0xB2, 0x2F, 0x79, 0x2B, 0x66, 0xB2, 0xDD, 0xFD, 0x92, 0x74, 0x43,
+    0x4A, 0x81, 0xBC, 0xF4, 0xF5, 0xEB, 0xBB, 0xDD, 0xAE, 0x69, 0xBB, 0x43, 0x8F, 0xCA, 0xDE, 0x03,
+    0xA5, 0x07, 0xE8, 0x00, 0xCA, 0x06, 0xFA, 0x8E, 0x52, 0x1D, 0xBD, 0xBA, 0x52, 0xEA, 0xFA, 0xB6,
+    0xFD, 0xC6, 0x14, 0xDB, 0x6F, 0x3E, 0x16, 0x9E, 0x7A, 0x4F, 0xE5, 0x3B, 0xDA, 0xE4, 0x28, 0x15,
+    0x53, 0x2A, 0xA6, 0x6B, 0x9B, 0x04, 0x1A, 0xBC, 0xF3, 0xAF, 0xDB, 0xF8, 0x6C, 0xB3, 0x4F, 0x2D,
+    0x6D, 0x94, 0xE4, 0xE9, 0x68, 0x07, 0xFD, 0x67, 0x24, 0xE9, 0xA7, 0x92, 0xB4, 0xF6, 0x92, 0xB4,
+    0xDB, 0xED, 0x76, 0x7D, 0xB3, 0x05, 0xF6, 0xA9, 0x8E, 0x27, 0x61, 0xC2, 0xDD, 0x36, 0xBE, 0x7F,
+    0xF8, 0x84, 0x6D, 0x93, 0x46, 0x17, 0x78, 0x4F, 0xE5, 0xBB, 0xBF, 0x72, 0xE5, 0x37, 0xA6, 0xD8,
+    0x7E, 0xF3, 0xE7, 0x3F, 0x8F, 0x56, 0xF2, 0x56, 0x11, 0xAB, 0x8E, 0x72, 0x86, 0x72, 0xCF, 0x2B,
+    0x2B, 0x31, 0x1D, 0x65, 0x30, 0x33, 0x65, 0x44, 0x5D, 0x39, 0x53, 0xCE, 0xE5, 0x04, 0xED, 0x03,
+    0x92, 0xF4, 0x73, 0x49, 0x52, 0x2F, 0x49, 0xDF, 0x78, 0x73, 0xB7, 0x6B, 0xBB, 0xBE, 0xA1, 0xED,
+    0xCA, 0x99, 0xBE, 0x43, 0xB8, 0x0E, 0x7B, 0x6B, 0xF5, 0xB4, 0xDB, 0x4A, 0xBE, 0x84, 0x49, 0xB4,
+    0x69, 0xB3, 0x44, 0x95, 0x57, 0xDF, 0x98, 0xDF, 0x6B, 0x9F, 0xED, 0xF6, 0xE0, 0x89, 0x09, 0xC9,
+    0x1F, 0x75, 0x70, 0x29, 0x7E, 0xA0, 0xBC, 0x1A, 0x66, 0xF7, 0xFC, 0xF3, 0xA1, 0xED, 0x7B, 0x9C,
+    0x02, 0x4E, 0x5B, 0xFB, 0x8D, 0xAD, 0x3C, 0xE4, 0x7C, 0x03, 0x6D, 0x73, 0x76, 0x4A, 0xD4, 0xB6,
+    0x57, 0xA7, 0xD8, 0x9A, 0xC7, 0xC2, 0x77, 0xF7, 0xC7, 0x21, 0x92, 0x99, 0x70, 0x7B, 0x65, 0xAF,
+    0x0E, 0x72, 0xEE, 0x19, 0x69, 0xC9, 0xA4, 0x21, 0x53, 0xE2, 0x4B, 0x11, 0x71, 0x1B, 0xE0, 0xB4,
+    0x81, 0x4F, 0x1D, 0xE4, 0x8F, 0xBF, 0x9B, 0x04, 0x59, 0x78, 0x8F, 0x99, 0x78, 0xCA, 0x0E, 0x65,
+    0x74, 0x4D, 0xEF, 0x97, 0x62, 0x36, 0x53, 0xFB, 0xAD, 0x07, 0x5F, 0x96, 0x74, 0x31, 0xB1, 0x49,
+    0x42, 0xDB, 0x25, 0x43, 0xD1, 0x0E, 0x29, 0xAF, 0xF4, 0xB5, 0x44, 0x4F, 0xFD, 0x72, 0x72, 0xC9,
+    0xCB, 0x5F, 0x98, 0x0E, 0x2A, 0x0F, 0x6D, 0xD6, 0x65, 0xB1, 0xEA, 0x8A, 0xA0, 0xAE, 0xF2, 0x6A,
+    0x5A, 0xFA, 0x7B, 0x97, 0x5D, 0xFF, 0x80, 0xA4, 0x0D, 0x6A, 0x0A, 0xD0, 0x6F, 0x3D, 0x45, 0x9A,
+    0xD4, 0x71, 0xB4, 0xD9, 0x13, 0x2F, 0x8B, 0x19, 0xA8, 0x46, 0xC0, 0x35, 0x45, 0xC7, 0x82, 0xEB,
+    0xCC, 0x64, 0x16, 0xEC, 0xE0, 0x7C, 0x62, 0xBD, 0x2E, 0x4E, 0xD2, 0x5B, 0x92, 0xF4, 0xB2, 0x24,
+    0x7D, 0xE6, 0xFA, 0x6E, 0x77, 0xA1, 0x9C, 0x48, 0x5D, 0x77, 0x53, 0x12, 0xC8, 0x0E, 0x6C, 0xB8,
+    0xC8, 0x99, 0xC7, 0x77, 0x0F, 0xCE, 0xFE, 0xA9, 0xF2, 0xB5, 0xCD, 0xEE, 0x3F, 0x5C, 0x6A, 0x25,
+    0xCD, 0xAD, 0xA4, 0xB5, 0xDD, 0xED, 0x76, 0xBB, 0x8B, 0x0D, 0x50, 0xBC, 0xB9, 0xDB, 0xED, 0x8E,
+    0x7B, 0x49, 0x6B, 0x29, 0x49, 0x5D, 0xFF, 0xAD, 0x2F, 0x9F, 0x8C, 0xC9, 0x57, 0xE8, 0x4F, 0x33,
+    0x6B, 0xE1, 0x6C, 0x42, 0x71, 0x6B, 0x7A, 0xD2, 0x4E, 0x50, 0xFC, 0x7C, 0x82, 0xFE, 0x81, 0x99,
+    0x72, 0xA9, 0x66, 0xFA, 0xA9, 0x9D, 0xCB, 0x9B, 0x2F, 0xDC, 0x9C, 0xDD, 0x83, 0x0F, 0xBC, 0x1C,
+    0xFE, 0xDD, 0x43, 0xD5, 0x03, 0x64, 0xD3, 0x43, 0x50, 0xBC, 0x30, 0x41, 0xF5, 0xC0, 0x00, 0x0F,
+    0x55, 0x0D, 0xF9, 0xF4, 0x10, 0x94, 0x2F, 0xCC, 0x50, 0x3F, 0x30, 0xC2, 0xD3, 0x55, 0x47, 0x3E,
+    0x3D, 0x7C, 0xF6, 0x2D, 0x0E, 0x40, 0xD2, 0x16, 0xF2, 0x24, 0x20, 0xA2, 0xED, 0xEE, 0xFA, 0xD6,
+    0x85, 0x62, 0x2A, 0x25, 0xE9, 0x3E, 0x49, 0x9A, 0x76, 0xBB, 0xDD, 0xAE, 0x6D, 0x80, 0xE2, 0x95,
+    0xDD, 0x6E, 0xF7, 0xF9, 0xB7, 0x24, 0x69, 0xEE, 0x25, 0xCD, 0x9F, 0x3C, 0xF9, 0xF3, 0x2F, 0xCC,
+    0xFB, 0x70, 0xE8, 0xF4, 0xE9, 0xB4, 0x3A, 0xEA, 0xAE, 0xFC, 0xD2, 0x3B, 0x9E, 0x3B, 0xBD, 0xF5,
+    0x0B, 0x83, 0xCE, 0xA6, 0x87, 0x30, 0xC5, 0x0B, 0xD3, 0x57, 0x5C, 0xF5, 0xC0, 0x4B, 0x41, 0x0F,
+    0x55, 0xAD, 0xEF, 0xA7, 0x76, 0xA6, 0x7F, 0x41, 0x1D, 0xFD, 0x03, 0x33, 0xF4, 0x6D, 0xB7, 0xE5,
+    0x9F, 0xFB, 0x0E, 0xF8, 0xEA, 0x69, 0x5A, 0xFC, 0xFD, 0x90, 0x47, 0x3B, 0x92, 0x2F, 0xD9, 0x4A,
+    0xBE, 0x50, 0x8D, 0xB9, 0xB4, 0xD5, 0x71, 0xBC, 0xB0, 0xEC, 0x76, 0xBB, 0x65, 0x01, 0xAA, 0x6B,
+    0xDF, 0xDF, 0xED, 0x1E, 0xFC, 0xA1, 0x24, 0x8D, 0xB5, 0xA4, 0x31, 0x5F, 0xA8, 0x46, 0x9C, 0xB7,
+    0x23, 0x26, 0xDA, 0x00, 0xBF, 0x93, 0x05, 0xC8, 0xB8, 0x1D, 0x52, 0x03, 0x5B, 0x8D, 0xE0, 0xAE,
+    0xCA, 0x93, 0xAF, 0xA5, 0xC0, 0x4E, 0x76, 0x81, 0xD6, 0xBB, 0x48, 0xBE, 0xD0, 0xDE, 0x38, 0x79,
+    0x32, 0x20, 0x49, 0x5D, 0xAE, 0x3D, 0x6D, 0x28, 0x60, 0x17, 0xFA, 0x86, 0x3A, 0x9A, 0x08, 0x2E,
+    0xD8, 0x11, 0x34, 0xF4, 0x90, 0xE9, 0xEA, 0x0C, 0x46, 0x95, 0x87, 0x72, 0xE9, 0x81, 0x4A, 0x13,
+    0x89, 0x7D, 0x0C, 0x7D, 0x0A, 0x48, 0xC3, 0x81, 0x21, 0x90, 0x8C, 0xED, 0x7B, 0x01, 0xB2, 0x2B,
+    0x4D, 0x6A, 0x16, 0xD1, 0x6B, 0xC1, 0x7E, 0xBF, 0x0F, 0x5C, 0xCA, 0xF7, 0xE9, 0x48, 0x7A, 0xBF,
+    0x6F, 0xA6, 0x32, 0x50, 0xDF, 0x5C, 0xA8, 0xA4, 0xA1, 0x94, 0x96, 0x5C, 0x8D, 0xBC, 0x1B, 0x8A,
+    0x58, 0x26, 0xEE, 0x54, 0x19, 0xAB, 0x80, 0x1E, 0x5D, 0xB1, 0xC1, 0x8D, 0x99, 0xCC, 0x8A, 0x1B,
+    0xDD, 0x68, 0x52, 0x07, 0xAF, 0x7A, 0xDA, 0xCA, 0x9F, 0xCB, 0x94, 0x86, 0x6E, 0x52, 0x4C, 0xE8,
+    0xA4, 0xD5, 0x4A, 0x7A, 0x49, 0xD2, 0xA4, 0x9F, 0x3C, 0xB9, 0x6C, 0x8C, 0x5D, 0x0D, 0x89, 0x39,
+    0x6C, 0x17, 0x30, 0xFA, 0xDD, 0x5D, 0xA3, 0x17, 0x25, 0x4D, 0xBD, 0xB4, 0x6C, 0x64, 0xF7, 0x5B,
+    0x3F, 0xB1, 0x7F, 0xE3, 0xCD, 0x9F, 0x9C, 0x3C, 0xB8, 0xB4, 0x69, 0xED, 0xEA, 0xE5, 0x7D, 0x81,
+    0x4E, 0x22, 0x37, 0x35, 0x79, 0xC7, 0xDD, 0xD2, 0x7D, 0x33, 0x4E, 0xBA, 0x11, 0x71, 0x92, 0x22,
+    0x6E, 0xA5, 0x8F, 0xB8, 0x19, 0xA3, 0xA6, 0x9A, 0xC9, 0x14, 0x6C, 0x24, 0xD3, 0x52, 0x2C, 0x64,
+    0x51, 0x8F, 0x8A, 0x2C, 0xD6, 0x41, 0x3E, 0x5B, 0xCA, 0xE8, 0x46, 0x96, 0x5C, 0x76, 0x66, 0xA1,
+    0xBF, 0xBA, 0xB2, 0x50, 0x07, 0x75, 0x0B, 0x36, 0xBA, 0x71, 0xC1, 0xAC, 0x65, 0x5C, 0xC9, 0x74,
+    0xAF, 0x56, 0x90, 0x77, 0x2B, 0xF4, 0xC3, 0x96, 0x9D, 0xD6, 0x94, 0x6D, 0x59, 0xC9, 0x89, 0x3E,
+    0x65, 0x28, 0x0B, 0x69, 0xC0, 0x72, 0xFE, 0xCF, 0xCF, 0x2E, 0xFA, 0xE3, 0x43, 0x4F, 0xA5, 0x8D,
+    0x06, 0xE6, 0x01, 0x2D, 0x6C, 0xC4, 0x68, 0x73, 0x53, 0x40, 0xEB, 0x26, 0x28, 0xDF, 0x90, 0x87,
+    0xC5, 0x46, 0xA8, 0xBD, 0x46, 0xCC, 0x5C, 0x08, 0xDA, 0xC6, 0x4D, 0xD8, 0x60, 0xD4, 0xB1, 0x52,
+    0x45, 0x6A, 0x8F, 0x06, 0x13, 0xB1, 0x2B, 0x6D, 0x47, 0x1B, 0x6C, 0xC0, 0xE8, 0x5E, 0x81, 0x8B,
+    0x6E, 0x20, 0x35, 0x64, 0xDD, 0x36, 0xE1, 0xBF, 0x93, 0xA4, 0xD5, 0x49, 0x52, 0x7B, 0xC8, 0x4E,
+    0x5C, 0xD7, 0x8F, 0x76, 0x9F, 0x5F, 0xDC, 0x4C, 0xA6, 0x52, 0xD0, 0xDF, 0x2B, 0x8F, 0xF3, 0x6E,
+    0xA6, 0x1A, 0x4B, 0x61, 0x43, 0x26, 0x6F, 0x22, 0x6E, 0xCE, 0x13, 0xF3, 0x6C, 0x6B, 0x49, 0xE0,
+    0xE6, 0xDA, 0x53, 0xC8, 0x8E, 0xA0, 0xEF, 0x4D, 0x50, 0xDF, 0x88, 0x50, 0x68, 0x21, 0xF5, 0x8E,
+    0xA6, 0x56, 0xB7, 0xA7, 0xAA, 0x68, 0xDC, 0x13, 0xB8, 0x13, 0x0E, 0xF3, 0x47, 0xDA, 0xAA, 0x9F,
+    0x86, 0x42, 0x92, 0x9A, 0x56, 0xD2, 0x52, 0xE8, 0xD2, 0x9E, 0x47, 0x9E, 0x3C, 0x90, 0x2D, 0x1D,
+    0x9B, 0xAA, 0x89, 0xFE, 0xD7, 0xDD, 0x6E, 0xF7, 0x80, 0xB4, 0x4D, 0xB9, 0x96, 0x56, 0x92, 0xDE,
+    0xD4, 0xB7, 0x76, 0xBB, 0xDD, 0xFD, 0xEB, 0x29, 0x41, 0x21, 0x05, 0xAD, 0xA9, 0x61, 0x49, 0x0A,
+    0x0C, 0x7B, 0x49, 0xCB, 0x36, 0x29, 0xB5, 0xA4, 0x81, 0xF3, 0xFB, 0x32, 0x8A, 0x2F, 0x9F, 0x16,
+    0xDC, 0xD9, 0x00, 0x77, 0x6D, 0x9C, 0x3F, 0x4D, 0x99, 0x52, 0x0B, 0x5B, 0x49, 0xF7, 0xEA, 0x35,
+    0x13, 0xB1, 0x0B, 0x55, 0x6A, 0x86, 0xD3, 0x18, 0x61, 0x22, 0x76, 0xA6, 0x1A, 0x69, 0x5F, 0xD9,
+    0xE9, 0x5B, 0xBF, 0xA7, 0x83, 0xD9, 0xDF, 0x8F, 0xED, 0x47, 0x5F, 0x58, 0x76, 0xC7, 0xEA, 0xEA,
+    0x01, 0x23, 0x44, 0x6A, 0x4A, 0x8A, 0x5D, 0xEA, 0x01, 0xAA, 0x55, 0xFB, 0xA6, 0x7E, 0x4D, 0x7D,
+    0x28, 0xA9, 0x9A, 0xB6, 0xC6, 0xE8, 0xCE, 0x1F, 0x30, 0xA5, 0x54, 0x6C, 0x92, 0xF5, 0x7B, 0x6D,
+    0xDA, 0x8F, 0x47, 0xD2, 0x62, 0xD5, 0xEC, 0x7B, 0x1B, 0x6E, 0xF4, 0x8C, 0xF9, 0xCE, 0xDD, 0xEE,
+    0xC2, 0x26, 0x94, 0x33, 0xE3, 0xB9, 0xBE, 0xDB, 0xED, 0x2E, 0xA4, 0x8C, 0x76, 0x3F, 0xB2, 0x9F,
+    0x8A, 0x4C, 0x4A, 0xBB, 0xF4, 0xD6, 0xB5, 0x5B, 0x03, 0x1F, 0xDB, 0x0B, 0x85, 0x56, 0x7A, 0x9C,
+    0x6C, 0x6B, 0x06, 0x23, 0xA9, 0xA9, 0xF6, 0x7D, 0x50, 0xEF, 0x4E, 0xD9, 0x4B, 0x71, 0x20, 0xBC,
+    0x6C, 0x42, 0x0F, 0xBB, 0xDD, 0xEE, 0x42, 0xFF, 0xF2, 0xDB, 0xA7, 0x67, 0xDA, 0xED, 0x76, 0xBB,
+    0x7E, 0x38, 0xB0, 0x94, 0xCE, 0x70, 0x48, 0xD2, 0x41, 0xFA, 0xA9, 0x92, 0xA4, 0xAE, 0x95, 0x34,
+    0x1F, 0x4E, 0xB9, 0x36, 0xFB, 0x16, 0x0F, 0x5B, 0x9B, 0x29, 0x9F, 0x5C, 0xFC, 0xBF, 0x4F, 0x5D,
+    0x1E, 0xBA, 0x34, 0x3B, 0x45, 0x1A, 0xB7, 0x0D, 0xE7, 0x35, 0x50, 0x0F, 0x99, 0x3C, 0x6D, 0x97,
+    0xAB, 0x41, 0x18, 0x91, 0x2F, 0x94, 0xF1, 0xCE, 0x2F, 0x2C, 0xBB, 0xFA, 0xCD, 0x5F, 0x98, 0x9E,
+    0x3B, 0x77, 0xFA, 0xD6, 0xC5, 0x89, 0x6C, 0xA5, 0xF7, 0x5B, 0xC3, 0x88, 0x72, 0xAA, 0x66, 0xA8,
+    0x5E, 0x91, 0x07, 0x77, 0x6D, 0x29, 0x24, 0x69, 0xAC, 0x24, 0xAD, 0xB4, 0x4A, 0x04, 0xFF, 0x94,
+    0xDB, 0x4D, 0x23, 0x4A, 0xA5, 0x84, 0x6D, 0x43, 0x2B, 0x5D, 0x4F, 0xD2, 0x4C, 0xED, 0xC7, 0xD2,
+    0x1C, 0xA5, 0x0E, 0x19, 0x3E, 0xF5, 0xAD, 0x07, 0x8C, 0x8E, 0x76, 0xBB, 0x5D, 0x19, 0x7F, 0x61,
+    0x7A, 0x7E, 0x77, 0xB7, 0xDB, 0x7D, 0xE1, 0x94, 0x39, 0x94, 0x3E, 0x5D, 0xC7, 0x74, 0x90, 0xF6,
+    0x30, 0x47, 0xBE, 0x90, 0x74, 0x79, 0x1F, 0xBF, 0x48, 0x92, 0x7E, 0x20, 0x49, 0x5A, 0xD2, 0x2F,
+    0x8D, 0xBB, 0xBE, 0xFB, 0xBC, 0x3A, 0xA3, 0x06, 0x37, 0xE1, 0x26, 0x8C, 0x9A, 0x7F, 0xC5, 0x5F,
+    0x32, 0xA9, 0xAB, 0x34, 0xF7, 0x5A, 0x4A, 0xE9, 0x07, 0xD2, 0xA0, 0x7D, 0xFF, 0x55, 0x2A, 0x29,
+    0x35, 0xED, 0x55, 0x8A, 0xEC, 0xF4, 0xE6, 0xEE, 0xC1, 0x50, 0x2D, 0x64, 0x31, 0x97, 0xC7, 0xE1,
+    0x66, 0x4A, 0x9F, 0x32, 0xFC, 0x7D, 0xD8, 0xF7, 0xEC, 0xCC, 0x34, 0x6C, 0xED, 0x3A, 0xB7, 0x1D,
+    0xAD, 0x0D, 0x87, 0x32, 0x94, 0xB8, 0x57, 0xC5, 0x62, 0xDD, 0xAF, 0x05, 0xA3, 0x4D, 0xE1, 0xEE,
+    0xC9, 0xD4, 0x50, 0x79, 0x75, 0xD8, 0x20, 0x4F, 0x11, 0xFB, 0x83, 0xED, 0xFB, 0x4C, 0x3A, 0xFB,
+    0x7E, 0xE3, 0xB8, 0x9D, 0xCD, 0xDD, 0xBE, 0x26, 0xE9, 0x5B, 0xBB, 0x54, 0x0E, 0xB2, 0x1E, 0xBC,
+    0xB2, 0xB6, 0xDB, 0x6B, 0x61, 0x3D, 0xEE, 0x75, 0xA0, 0x9C, 0xF6, 0xAE, 0x4E, 0x8A, 0xB3, 0x4E,
+    0x61, 0xE0, 0xB7, 0x7D, 0xA5, 0xFA, 0xA5, 0xBF, 0xE2, 0x6F, 0xF9, 0xCA, 0xD1, 0xF1, 0xFE, 0x2F,
+    0xAD, 0x4F, 0x21, 0x72, 0x1D, 0xD2, 0x81, 0xCA, 0x39, 0x1D, 0x21, 0x35, 0x20, 0xDA, 0x02, 0x95,
+    0xC3, 0x87, 0xC6, 0xD3, 0x0F, 0x15, 0x31, 0xD1, 0x1D, 0x0E, 0x1F, 0xEA, 0xBB, 0x74, 0x86, 0x7A,
+    0x4C, 0xE6, 0xD8, 0x4E, 0xE9, 0x43, 0xD9, 0x05, 0x8A, 0xC0, 0xFE, 0x7F, 0x6B, 0xC2, 0x1F, 0xD7,
+    0x2F, 0xBD, 0x1A, 0x9D, 0xB6, 0x66, 0x10, 0xED, 0x0A, 0xBD, 0x9A, 0x52, 0x9A, 0xDC, 0x4D, 0x2D,
+    0xD5, 0xD5, 0x57, 0xE2, 0xFB, 0x8A, 0xF0, 0xEF, 0x0E, 0xDF, 0xC9, 0x8E, 0xE1, 0xCB, 0x4D, 0x96,
+    0xFC, 0x7E, 0x7D, 0x21, 0xB6, 0xF4, 0xB5, 0xAF, 0x9E, 0x0B, 0xE6, 0xA7, 0x31, 0x8F, 0xEE, 0xFF,
+    0x5D, 0x4B, 0x09, 0x89, 0xF3, 0xD7, 0xB9, 0xEB, 0x11, 0x3D, 0xA7, 0x3A, 0xB6, 0x63, 0x02, 0x76,
+    0x6E, 0xEB, 0x0E, 0x75, 0xFB, 0xCE, 0x1F, 0xDA, 0x44, 0xB5, 0xBC, 0xAD, 0xEB, 0xA8, 0x3F, 0xFD,
+    0x54, 0x77, 0xF8, 0x54, 0xBA, 0xE5, 0xC4, 0x58, 0x68, 0x60, 0xA1, 0x5D, 0xA9, 0x7C, 0xA1, 0x90,
+    0xCF, 0xFC, 0x96, 0x70, 0x0D, 0x76, 0x2A, 0x02, 0xF4, 0x5D, 0x0F, 0x45, 0xB4, 0x03, 0x38, 0x1F,
+    0xC1, 0x2C, 0x95, 0x87, 0xEA, 0xD5, 0x19, 0x90, 0x03, 0xEC, 0xCF, 0xC3, 0xDE, 0x65, 0x32, 0x89,
+    0x6D, 0x1D, 0x0F, 0xEB, 0xB0, 0x3A, 0x3D, 0xCD, 0xED, 0x64, 0x68, 0x28, 0xBC, 0x96, 0x32, 0x48,
+    0xCF, 0xCD, 0xEE, 0x51, 0x85, 0xCA, 0xBB, 0x50, 0x8E, 0x66, 0xCE, 0x63, 0xAE, 0xA6, 0xBD, 0x4F,
+    0x93, 0x55, 0xD4, 0xA3, 0x8A, 0x36, 0xD4, 0x33, 0x91, 0x63, 0xCE, 0xC3, 0xED, 0x64, 0x4D, 0x26,
+    0x5F, 0x2E, 0x99, 0xA2, 0xD5, 0x20, 0x3D, 0xAF, 0xD8, 0xDE, 0xAF, 0xB1, 0xAF, 0xBD, 0x1B, 0xED,
+    0x73, 0x63, 0x19, 0xCC, 0x4F, 0x67, 0x23, 0x62, 0x6B, 0x34, 0xF6, 0x56, 0xD7, 0xA5, 0x47, 0x35,
+    0x57, 0xF2, 0xF5, 0x9C, 0xC9, 0x27, 0x32, 0x46, 0xDB, 0xED, 0x35, 0xA2, 0x98, 0x0F, 0x5A, 0xF3,
+    0x2B, 0x7E, 0xF3, 0xD4, 0x64, 0x3F, 0x78, 0x30, 0x4E, 0xD3, 0xC1, 0x6B, 0xDC, 0x28, 0x4E, 0x09,
+    0x41, 0xD9, 0x37, 0x96, 0x6B, 0x0E, 0x72, 0xCA, 0xB6, 0x67, 0x7F, 0x5A, 0xB7, 0x9E, 0xC0, 0x98,
+    0xD4, 0x8E, 0xA5, 0x1D, 0xD9, 0x2F, 0xD9, 0x8D, 0x5A, 0x95, 0x9E, 0xD3, 0x4E, 0x5D, 0xCD, 0x1C,
+    0x5A, 0xA8, 0xA6, 0xED, 0xC1, 0xEA, 0x10, 0xDF, 0xE8, 0xEB, 0x3A, 0xF8, 0x2C, 0x9A, 0xBF, 0xEC,
+    0x7E, 0xF0, 0xF3, 0x45, 0xED, 0x3F, 0xFC, 0xB4, 0x6B, 0xFE, 0x65, 0x58, 0x16, 0x9B, 0x08, 0x13,
+    0x8E, 0x61, 0xB6, 0x36, 0x80, 0x00, 0x8A, 0x87, 0x16, 0x49, 0xEE, 0x5A, 0x00, 0xE4, 0x06, 0x28,
+    0xE7, 0xB4, 0x46, 0xD5, 0x90, 0x29, 0x5F, 0xC1, 0xCE, 0x26, 0x82, 0xF3, 0x76, 0x22, 0x17, 0x55,
+    0xC0, 0x4E, 0xB8, 0x81, 0xD6, 0xD3, 0x77, 0x66, 0x25, 0x13, 0x36, 0x60, 0xD6, 0xD4, 0xFC, 0xD2,
+    0x2C, 0x60, 0xA7, 0x2A, 0xEC, 0x6B, 0x36, 0xDA, 0xEF, 0x2D, 0x80, 0xBA, 0xD6, 0x83, 0x9D, 0xD5,
+    0x41, 0xFB, 0xAC, 0x20, 0x57, 0xFA, 0x60, 0x19, 0xA1, 0xF5, 0x55, 0xC0, 0xAC, 0xB8, 0x11, 0x1B,
+    0x68, 0x3D, 0xBD, 0x47, 0x8D, 0x59, 0xC8, 0x57, 0xAA, 0x40, 0x91, 0x9A, 0x71, 0xCC, 0x26, 0x42,
+    0x15, 0xEA, 0x71, 0x1B, 0x1B, 0xFD, 0xD7, 0x23, 0xA0, 0x7A, 0x04, 0xB3, 0xEA, 0x70, 0x25, 0x36,
+    0x59, 0x61, 0x9D, 0xFA, 0x57, 0x3A, 0xF5, 0x55, 0xB2, 0xFF, 0x11, 0x32, 0x69, 0xC0, 0xED, 0x7B,
+    0x28, 0xD7, 0xEB, 0xE7, 0x34, 0xAA, 0xA3, 0xFF, 0x5E, 0x04, 0x3D, 0x38, 0x92, 0x2F, 0x7D, 0x43,
+    0x71, 0x63, 0x81, 0xEA, 0xF5, 0x09, 0xDA, 0x27, 0x07, 0xB2, 0xF5, 0x37, 0xE2, 0xAD, 0xB6, 0xA3,
+    0x7C, 0x53, 0xE0, 0x5E, 0x5A, 0xC9, 0x55, 0xEA, 0x5B, 0x7D, 0xEA, 0x2B, 0xBF, 0x2F, 0xE0, 0x68,
+    0xE0, 0xF7, 0x1B, 0x20, 0xFF, 0x6B, 0x52, 0x55, 0x49, 0x29, 0x81, 0xBB, 0x19, 0xC9, 0x55, 0x0C,
+    0xD8, 0x78, 0x2E, 0xE9, 0x74, 0x26, 0xBF, 0x39, 0x36, 0x55, 0xDC, 0x54, 0xFE, 0x57, 0xFB, 0x56,
+    0xC7, 0xB9, 0x62, 0x81, 0x58, 0x87, 0x74, 0x07, 0x8B, 0x5A, 0x5B, 0xCD, 0x29, 0x77, 0x3D, 0x7E,
+    0x26, 0xBC, 0xE8, 0xBB, 0x03, 0x4D, 0xAE, 0x3A, 0x43, 0x4B, 0xEE, 0x1B, 0xFE, 0x91, 0x8F, 0x2F,
+    0x41, 0xF6, 0x17, 0xE5, 0x0A, 0xD5, 0xEC, 0x22, 0x28, 0x28, 0x60, 0xF4, 0xAC, 0x1A, 0x8A, 0x35,
+    0x3B, 0x3E, 0xAD, 0x36, 0x71, 0x03, 0xE8, 0x7E, 0x79, 0x4A, 0xD9, 0x14, 0x75, 0xA4, 0xDA, 0xAF,
+    0xEE, 0x70, 0x6F, 0x9A, 0x7F, 0xC4, 0xE3, 0x3B, 0x67, 0x3C, 0xC5, 0xE9, 0xB0, 0xFB, 0x27, 0xB3,
+    0x93, 0x1D, 0x03, 0x7F, 0x65, 0xD6, 0x42, 0xC5, 0x6A, 0xE6, 0x5B, 0x9B, 0x1A, 0x64, 0x54, 0x83,
+    0x0B, 0xED, 0xD8, 0xFA, 0x4F, 0xF2, 0x2B, 0x1F, 0xD6, 0x2F, 0x29, 0x89, 0x7F, 0x20, 0xB1, 0xF7,
+    0xE5, 0x86, 0x3B, 0x8C, 0x66, 0x1E, 0xB2, 0xD2, 0x9F, 0xAE, 0xF5, 0x8F, 0xA5, 0x58, 0x37, 0x95,
+    0xC2, 0x6D, 0x64, 0x57, 0xCE, 0x5C, 0xCB, 0x9D, 0xBB, 0xDD, 0xEE, 0x42, 0xAD, 0x2D, 0x06, 0x5E,
+    0x2A, 0x9D, 0xFA, 0x4F, 0x5B, 0x0E, 0xE0, 0xED, 0x7F, 0xCD, 0x1E, 0xE7, 0x0E, 0xA3, 0xC1, 0x5E,
+    0xD5, 0x5A, 0xBE, 0x21, 0x29, 0xF6, 0x46, 0x8B, 0x6D, 0xAA, 0x85, 0x86, 0x0B, 0x94, 0x23, 0x7F,
+    0x60, 0xD5, 0x39, 0xAB, 0xA5, 0xFE, 0xDE, 0x2A, 0xFD, 0x74, 0x2E, 0x15, 0x3E, 0xBE, 0x99, 0xE4,
+    0xF4, 0x78, 0x0D, 0xCE, 0x5F, 0x95, 0x24, 0x2B, 0x29, 0xA6, 0x36, 0x04, 0x47, 0x17, 0xCE, 0x4A,
+    0xE0, 0xCB, 0x27, 0x8F, 0xD3, 0x4B, 0x7A, 0x4C, 0x92, 0xEC, 0x8D, 0xDD, 0x1F, 0xC5, 0xDF, 0x06,
+    0x7E, 0x1B, 0xDE, 0x93, 0x5A, 0x39, 0x9A, 0xF0, 0xD1, 0x93, 0xFE, 0xEF, 0x37, 0x84, 0xEF, 0x27,
+    0x27, 0x3A, 0x69, 0x4C, 0x80, 0xBA, 0xCB, 0x4F, 0xD6, 0x93, 0x6F, 0x27, 0x18, 0x73, 0x7D, 0xE2,
+    0xC6, 0xC9, 0xE3, 0x75, 0x97, 0xFA, 0xED, 0x1E, 0xC3, 0x6E, 0xB7, 0xDB, 0xFD, 0x7B, 0x49, 0xFA,
+    0x5B, 0x49, 0xFA, 0x0F, 0x67, 0x79, 0x6A, 0x1C, 0xED, 0x39, 0x76, 0x4B, 0xBF, 0xF7, 0x99, 0x87,
+    0x5B, 0x04, 0x74, 0xFA, 0xC5, 0x07, 0x37, 0xF9, 0x34, 0x50, 0x75, 0x94, 0x22, 0xD7, 0x44, 0x7F,
+    0x9D, 0x7A, 0xA5, 0xDC, 0x4A, 0x44, 0xFB, 0x39, 0x75, 0x89, 0xA8, 0xD4, 0x51, 0x68, 0x24, 0xD3,
+    0x94, 0x3C, 0xA6, 0x4F, 0xEC, 0x3B, 0x62, 0x6C, 0xBE, 0x5F, 0xBF, 0x55, 0x98, 0x8F, 0xDB, 0x7D,
+    0x88, 0x7E, 0xE1, 0x3B, 0x0B, 0xD4, 0x33, 0xB9, 0x86, 0xAC, 0x9F, 0xB7, 0x56, 0x8B, 0xB9, 0x06,
+    0xCC, 0xB4, 0xDF, 0x2B, 0x0F, 0x34, 0xBB, 0x3E, 0x81, 0x9E, 0x73, 0x1A, 0xD9, 0x31, 0x54, 0x1D,
+    0x95, 0xA7, 0x10, 0x85, 0x9A, 0x4C, 0x53, 0xA6, 0x99, 0x76, 0xD9, 0x8E, 0x51, 0xA9, 0x29, 0x74,
+    0xA9, 0x50, 0xCA, 0xA6, 0x4F, 0xD0, 0xCF, 0xFB, 0x41, 0x6F, 0xE3, 0xDE, 0x86, 0xB1, 0x8D, 0x24,
+    0xD3, 0x04, 0xBD, 0xA7, 0xF5, 0xF0, 0x49, 0xD8, 0xD7, 0x6A, 0xDC, 0x91, 0x00, 0xCB, 0x05, 0x16,
+    0x28, 0x92, 0x3F, 0x5E, 0x6A, 0x28, 0x34, 0x1C, 0xBE, 0x94, 0x4E, 0x49, 0xA5, 0xE6, 0x6E, 0x35,
+    0x14, 0x6B, 0x62, 0xD6, 0xCF, 0xF4, 0x33, 0xB5, 0xA8, 0xD5, 0x94, 0x4A, 0xF9, 0xCF, 0x29, 0xD7,
+    0xB4, 0xFF, 0xB4, 0x1A, 0xD4, 0x90, 0x0F, 0xE4, 0xE3, 0x99, 0xAA, 0x8A, 0x5F, 0x2E, 0xF4, 0xE1,
+    0x00, 0x41, 0xA5, 0x66, 0x91, 0xA9, 0xEC, 0x37, 0x45, 0x92, 0xCB, 0xDB, 0xAA, 0x28, 0xFE, 0x81,
+    0xD0, 0x87, 0x7D, 0x73, 0x88, 0xD3, 0x98, 0x7D, 0xB3, 0x76, 0x26, 0xC2, 0xF9, 0x3E, 0x35, 0x57,
+    0x3B, 0xC5, 0x13, 0x24, 0x4D, 0x6E, 0xA1, 0x6F, 0x72, 0x75, 0x26, 0x62, 0x23, 0xD5, 0x88, 0x1B,
+    0x10, 0x99, 0x30, 0x91, 0x22, 0x52, 0x0F, 0x54, 0x01, 0x41, 0x3B, 0x14, 0x11, 0xD4, 0xD5, 0x03,
+    0xB9, 0x1A, 0x81, 0xD1, 0xD7, 0x67, 0x28, 0xA5, 0x1B, 0x27, 0x8F, 0x97, 0xA7, 0x11, 0x67, 0x93,
+    0xF5, 0xD2, 0xB2, 0xF9, 0xED, 0xA9, 0x15, 0x55, 0x8A, 0xD9, 0x75, 0xB6, 0x37, 0xD5, 0x47, 0x9B,
+    0xB7, 0xB5, 0x4A, 0x6E, 0xBB, 0x44, 0x3D, 0xCE, 0x24, 0x4D, 0x14, 0x92, 0xD6, 0x74, 0xDB, 0x8D,
+    0xA6, 0xDD, 0xA2, 0xEB, 0xFE, 0xDB, 0x02, 0x13, 0xCB, 0x15, 0xAA, 0xD1, 0x46, 0xE8, 0x9B, 0x2A,
+    0x60, 0x22, 0x6E, 0xA0, 0x1A, 0xD3, 0x14, 0x98, 0x05, 0x13, 0xA9, 0x26, 0xAA, 0x11, 0x79, 0x44,
+    0xB1, 0x62, 0x22, 0x7D, 0xF8, 0x72, 0x7F, 0xA3, 0x4F, 0xD0, 0xC0, 0x7C, 0x1A, 0xB3, 0x5F, 0xDA,
+    0x46, 0x99, 0x00, 0xD9, 0x4D, 0xEE, 0x1B, 0x21, 0x1D, 0x92, 0xC0, 0x7C, 0x2D, 0x29, 0xB4, 0x87,
+    0x0A, 0x4D, 0xB7, 0xEC, 0x9D, 0xB2, 0xED, 0x06, 0x6C, 0x87, 0x66, 0x90, 0x6E, 0xDC, 0xDB, 0xE5,
+    0x34, 0x57, 0x2E, 0xD5, 0x23, 0xAD, 0x27, 0x27, 0x97, 0x5B, 0x49, 0xD1, 0x48, 0xA9, 0x8F, 0xEA,
+    0x99, 0x36, 0x4C, 0x48, 0x92, 0x9C, 0xB6, 0x12, 0x55, 0xFD, 0x4C, 0x92, 0xA2, 0xA4, 0xC7, 0x71,
+    0x92, 0x46, 0x2B, 0x29, 0xF5, 0x9F, 0x4D, 0x77, 0xC0, 0x38, 0xBD, 0x61, 0xC1, 0x7C, 0x38, 0x79,
+    0xEF, 0xF7, 0x5D, 0x85, 0xED, 0xBC, 0x0F, 0xF6, 0x4A, 0x7D, 0xF4, 0xE4, 0x44, 0xFA, 0xEC, 0xE1,
+    0xEB, 0xEC, 0xE3, 0xF3, 0x33, 0xEB, 0x59, 0xF1, 0x6D, 0x67, 0x3F, 0xD8, 0xBB, 0x8B, 0x7A, 0x2D,
+    0x05, 0xD2, 0x1D, 0x99, 0xBE, 0xFD, 0xB7, 0x0B, 0xD9, 0x6A, 0x42, 0x3D, 0xB0, 0x10, 0xB3, 0xC8,
+    0x82, 0xA3, 0xF2, 0x0F, 0x63, 0x7D, 0x3E, 0xD5, 0x98, 0xC0, 0x3D, 0xB6, 0x23, 0x62, 0xAF, 0x8E,
+    0x38, 0xF2, 0x37, 0xD6, 0x93, 0x27, 0x7F, 0x72, 0x92, 0x9C, 0xE5, 0xE4, 0x2D, 0xEB, 0xA5, 0x01,
+    0x47, 0x16, 0x66, 0xAC, 0xE7, 0x29, 0x87, 0x09, 0xB8, 0x62, 0x20, 0x52, 0x35, 0x11, 0x87, 0xF5,
+    0x95, 0xB7, 0xDE, 0x0E, 0x79, 0x34, 0xC1, 0x8E, 0xD4, 0xAF, 0xC5, 0x8B, 0xE3, 0x3E, 0x77, 0x59,
+    0xA6, 0x5B, 0x4C, 0x1C, 0xFD, 0xC9, 0x99, 0xA1, 0xDF, 0x32, 0xB8, 0x4B, 0x77, 0x2F, 0x64, 0x0B,
+    0x54, 0x03, 0x11, 0x88, 0x5B, 0x8B, 0xB7, 0x87, 0x81, 0x7C, 0xAA, 0x01, 0xEE, 0x49, 0xE4, 0xA2,
+    0xAB, 0x23, 0x90, 0xBF, 0xB1, 0x9E, 0x9C, 0x9C, 0xFC, 0xC2, 0xE0, 0x20, 0x0B, 0x33, 0xC0, 0x53,
+    0x0E, 0xC0, 0x15, 0x03, 0x50, 0x35, 0x11, 0xB0, 0xBE, 0xF2, 0x60, 0x87, 0x3C, 0x82, 0x1D, 0xA9,
+    0x5F, 0xE3, 0x1F, 0x3B, 0xB8, 0x95, 0x44, 0xD6, 0xA1, 0x88, 0x28, 0x50, 0xC8, 0x3F, 0xDC, 0x53,
+    0xBC, 0x35, 0xD5, 0x65, 0x28, 0xA6, 0x7B, 0xAC, 0xEF, 0x8B, 0xC9, 0x5E, 0x1D, 0xCB, 0x9F, 0x4F,
+    0xF9, 0x1B, 0x13, 0xFD, 0xC4, 0x43, 0x0F, 0x51, 0xCE, 0x54, 0x0F, 0x36, 0x85, 0x28, 0x5E, 0x1A,
+    0x0A, 0x85, 0x2C, 0xCC, 0xC5, 0xD4, 0xF3, 0x94, 0x2B, 0xA6, 0x32, 0xB8, 0xE2, 0xE5, 0x89, 0xBE,
+    0x6A, 0x34, 0x51, 0xCA, 0x57, 0x13, 0xF4, 0xFF, 0x8C, 0xC1, 0x25, 0xC9, 0x2D, 0x50, 0xC4, 0x64,
+    0x11, 0xFD, 0xC3, 0x50, 0xBC, 0x35, 0xD5, 0x50, 0x4C, 0xF7, 0x58, 0x4F, 0x31, 0xD9, 0xAB, 0x23,
+    0xC5, 0x94, 0xBF, 0x31, 0x51, 0x4C, 0x3C, 0xF4, 0x10, 0xC5, 0x44, 0xF5, 0x60, 0x53, 0x4C, 0x14,
+    0x2F, 0x0D, 0xC5, 0x44, 0x16, 0xE6, 0x62, 0x82, 0xA7, 0x5C, 0x31, 0x81, 0x2B, 0x5E, 0x9E, 0xA0,
+    0x6A, 0x34, 0x81, 0xF5, 0xD5, 0xF4, 0x4B, 0x49, 0x2E, 0x5B, 0xF6, 0x59, 0xA0, 0x7A, 0xDC, 0xCC,
+    0x55, 0xBE, 0xFE, 0x2A, 0xDE, 0x7A, 0x07, 0xB2, 0xB9, 0x3F, 0x13, 0x5F, 0xDF, 0x76, 0x89, 0x8F,
+    0x36, 0x7C, 0x27, 0x95, 0xB8, 0xE9, 0x7B, 0x6A, 0xAA, 0x85, 0xF6, 0x4D, 0x0D, 0x85, 0x9A, 0x6A,
+    0x71, 0x01, 0x79, 0xA3, 0xEC, 0x38, 0x11, 0xA8, 0x36, 0x0F, 0xEA, 0xAF, 0x1B, 0x20, 0xEB, 0xE7,
+    0x36, 0x2D, 0xF0, 0x8D, 0xB8, 0x6E, 0x24, 0xBD, 0x9C, 0xEE, 0xBB, 0x55, 0xAE, 0x66, 0x48, 0x25,
+    0xC2, 0xA9, 0xDD, 0xFB, 0x9C, 0x56, 0x27, 0xAD, 0x4F, 0x6C, 0x83, 0x5C, 0xC9, 0x76, 0x64, 0xFD,
+    0xB6, 0xDE, 0xEA, 0xD4, 0x9A, 0x7F, 0x33, 0x04, 0x31, 0x6D, 0x05, 0xA9, 0x1E, 0xB1, 0x0E, 0x69,
+    0x13, 0x40, 0x5D, 0xDA, 0x1E, 0xCC, 0xB2, 0x25, 0xA1, 0xAB, 0x69, 0x6B, 0x3F, 0x7B, 0xE6, 0xB0,
+    0x69, 0xEF, 0xB0, 0x73, 0x42, 0x49, 0x70, 0x43, 0x42, 0x14, 0xB3, 0x94, 0x4F, 0x4F, 0x87, 0x4D,
+    0x85, 0x38, 0x21, 0x7B, 0xB7, 0xC3, 0x86, 0xED, 0xB0, 0xBD, 0x3F, 0xFC, 0xC5, 0x8D, 0x40, 0xA8,
+    0x96, 0x5C, 0x40, 0x79, 0x63, 0x33, 0x12, 0xFB, 0x2B, 0xA7, 0xD7, 0x83, 0xC9, 0xED, 0xB8, 0x78,
+    0x29, 0x3B, 0xD3, 0x7A, 0xE8, 0x3B, 0x4D, 0x0A, 0x9A, 0x7D, 0xFA, 0x6C, 0x07, 0x46, 0x7F, 0x26,
+    0xC0, 0x8D, 0x66, 0x86, 0x4C, 0x98, 0x6E, 0x33, 0x57, 0x1B, 0xAC, 0x43, 0x2E, 0x7E, 0xAB, 0x49,
+    0x72, 0x69, 0x48, 0xB0, 0x2F, 0x5B, 0x94, 0x5D, 0xC4, 0x84, 0xC9, 0x84, 0xAD, 0x6D, 0x9F, 0xDD,
+    0x6A, 0x6B, 0x3C, 0x54, 0xA9, 0xFF, 0x49, 0xEB, 0xCB, 0x39, 0xD5, 0x7E, 0x0D, 0x60, 0x67, 0x52,
+    0x5B, 0x97, 0x22, 0x42, 0xA6, 0xA6, 0x7E, 0xC5, 0x53, 0x44, 0x74, 0xAD, 0xA1, 0x0E, 0x26, 0xDD,
+    0xDA, 0xD0, 0x6A, 0x20, 0x75, 0x5E, 0xA1, 0x0A, 0x9C, 0xDB, 0x5B, 0xD1, 0x8D, 0x13, 0x12, 0xAA,
+    0x90, 0xAE, 0x36, 0xCD, 0xF2, 0x86, 0x92, 0x77, 0xE9, 0x3A, 0xCF, 0xAC, 0xA7, 0x3B, 0x00, 0xDA,
+    0xF5, 0xCA, 0xA6, 0x03, 0xA7, 0x0D, 0x78, 0x5C, 0x28, 0x16, 0x48, 0x4C, 0xCC, 0xBD, 0xA0, 0x33,
+    0x91, 0x6E, 0xCB, 0x89, 0x9D, 0xE1, 0xA2, 0x56, 0x3B, 0x91, 0x4B, 0x4B, 0x15, 0x30, 0xD2, 0x5C,
+    0x87, 0xC3, 0xD4, 0x97, 0x71, 0x7F, 0x1D, 0xCE, 0x83, 0x9D, 0x68, 0x3D, 0x54, 0x13, 0x7D, 0x77,
+    0x98, 0xA3, 0x4D, 0x37, 0xDC, 0x98, 0xE9, 0x74, 0xB2, 0xDB, 0xC1, 0xAC, 0x1F, 0x80, 0xD6, 0x1B,
+    0x3D, 0x05, 0xBD, 0xDF, 0xAE, 0xD5, 0x28, 0x80, 0x9A, 0x5C, 0x1D, 0x99, 0xE0, 0xF6, 0x3D, 0xD8,
+    0xBC, 0x5D, 0xEC, 0xA7, 0x37, 0xAE, 0xC1, 0x93, 0xA9, 0x4F, 0x7E, 0x6A, 0x9B, 0xB4, 0x5D, 0xED,
+    0xDD, 0xB7, 0xF4, 0xD6, 0x4E, 0x31, 0xD4, 0x79, 0xBD, 0x96, 0xBA, 0xF1, 0x18, 0x6D, 0x3D, 0x56,
+    0x91, 0xB4, 0x3E, 0x99, 0x8A, 0xF5, 0x4A, 0x51, 0xF9, 0xFD, 0x25, 0x7C, 0xF7, 0x8C, 0x96, 0x9D,
+    0x6A, 0x57, 0x92, 0xC0, 0x1F, 0xC2, 0x79, 0x6D, 0xF7, 0xD7, 0xCA, 0x0F, 0x45, 0x20, 0x6E, 0xFF,
+    0x56, 0x92, 0x85, 0x39, 0x48, 0xD1, 0xF9, 0x4D, 0xB9, 0x8B, 0x08, 0xA8, 0x29, 0x63, 0x12, 0xC7,
+    0x94, 0x58, 0xB9, 0x64, 0xDA, 0xCF, 0x7B, 0x1D, 0x48, 0x4D, 0x9A, 0xCD, 0x4A, 0x15, 0xCC, 0xBA,
+    0x97, 0x8F, 0x1B, 0xA0, 0x58, 0x70, 0x63, 0x11, 0x3F, 0x4C, 0xEA, 0xB9, 0xDA, 0x5E, 0xEB, 0x28,
+    0x23, 0xED, 0x50, 0x6A, 0xDA, 0x46, 0xDA, 0xAF, 0x60, 0x27, 0x7A, 0x6F, 0xD6, 0x66, 0x3B, 0xE8,
+    0xD1, 0xB6, 0x68, 0x38, 0xBB, 0x24, 0x8C, 0x6F, 0xA7, 0x72, 0x13, 0xDC, 0xB6, 0x16, 0xEC, 0x5E,
+    0x1C, 0xA7, 0xAB, 0x22, 0xBB, 0xD2, 0x1C, 0xBD, 0x2D, 0x50, 0x3A, 0x06, 0xB2, 0xFE, 0x7A, 0xA9,
+    0x27, 0xFD, 0xA1, 0x1E, 0xA6, 0xD9, 0x0B, 0x73, 0x33, 0x22, 0xEA, 0xDA, 0xB0, 0x97, 0x53, 0xDF,
+    0x6D, 0x66, 0xC4, 0x2C, 0xFB, 0x05, 0x6F, 0x0F, 0x7F, 0x6C, 0xFD, 0x66, 0x49, 0x9E, 0xD5, 0xDE,
+    0x94, 0xD8, 0x79, 0xB3, 0x25, 0x93, 0x1B, 0x36, 0x29, 0x66, 0x07, 0xB1, 0x94, 0x71, 0x3F, 0x23,
+    0x6E, 0xDC, 0x2F, 0x7C, 0x35, 0x9B, 0x18, 0xB7, 0xFB, 0x44, 0x98, 0x35, 0xB5, 0xEA, 0x15, 0x76,
+    0xDA, 0x9F, 0xBD, 0x4D, 0x67, 0x77, 0xC3, 0x66, 0x68, 0x92, 0x55, 0x69, 0xAF, 0x6E, 0x66, 0x25,
+    0xD7, 0x95, 0xCD, 0xAE, 0x9C, 0x0A, 0xB2, 0x56, 0xB7, 0x9D, 0xC0, 0x8D, 0xFB, 0xC9, 0xBF, 0xE3,
+    0x8C, 0x6D, 0x39, 0x48, 0xF2, 0x60, 0x5D, 0x4E, 0xCD, 0xCB, 0xA9, 0x7D, 0x39, 0x15, 0xE5, 0xAD,
+    0x16, 0x86, 0x8F, 0x5D, 0xDA, 0x38, 0x8D, 0x5B, 0x37, 0xEE, 0xAD, 0x30, 0x6F, 0x69, 0xB7, 0xC0,
+    0xF6, 0xBF, 0xD9, 0x34, 0xAD, 0x08, 0xC9, 0xAF, 0x76, 0x1D, 0x24, 0x7A, 0xF4, 0xC1, 0x5A, 0xEE,
+    0x6D, 0xF0, 0xDE, 0x04, 0xEF, 0x67, 0x60, 0x6F, 0x29, 0xF7, 0x86, 0x52, 0x5D, 0xF2, 0xF4, 0x36,
+    0x33, 0xB9, 0x37, 0xBE, 0x9B, 0x4C, 0x12, 0x30, 0x75, 0x6A, 0xEA, 0xDD, 0x60, 0x44, 0x97, 0x24,
+    0x54, 0x76, 0x14, 0x11, 0x77, 0x73, 0x4D, 0xE2, 0x57, 0x48, 0xCB, 0x31, 0x55, 0x7F, 0x1A, 0x5D,
+    0x4A, 0x18, 0x73, 0x73, 0xB0, 0x3E, 0xFB, 0x92, 0xC5, 0x64, 0x7F, 0xF6, 0x06, 0x68, 0x6F, 0x81,
+    0xF6, 0x8B, 0xF2, 0x56, 0x1B, 0x94, 0x62, 0xFC, 0x8B, 0x4A, 0x45, 0x9A, 0xDB, 0xFD, 0xF9, 0x4E,
+    0x52, 0x0B, 0xF6, 0x84, 0xCD, 0x3E, 0x8D, 0xF3, 0x70, 0xD4, 0x37, 0x55, 0x80, 0x4A, 0xC3, 0x45,
+    0x45, 0x9C, 0xE6, 0x5E, 0xA2, 0xFE, 0xC9, 0x52, 0x4B, 0x4D, 0x15, 0x6E, 0xDB, 0xDF, 0x40, 0xC6,
+    0x8D, 0x64, 0xF2, 0xD8, 0x09, 0xDC, 0x42, 0xB1, 0x40, 0xA1, 0xCD, 0xBA, 0x2C, 0xF4, 0x1E, 0x8C,
+    0xBC, 0x1B, 0x01, 0x37, 0xDB, 0x09, 0x82, 0x59, 0x8B, 0x48, 0xD3, 0xD3, 0x3F, 0xAA, 0x3C, 0xB8,
+    0xE0, 0x7C, 0xFF, 0x7A, 0xB4, 0xD2, 0x58, 0x6B, 0xCD, 0xA4, 0xB1, 0xD0, 0x42, 0xA9, 0x81, 0x7E,
+    0x82, 0xA3, 0xD3, 0x9B, 0x32, 0x6C, 0x8F, 0xFF, 0xE2, 0xD6, 0x7E, 0xB4, 0x76, 0x7B, 0xDD, 0x6E,
+    0x4A, 0x67, 0xAF, 0xA5, 0xD7, 0x90, 0xA8, 0xDF, 0x76, 0xBB, 0x0D, 0x4D, 0x4C, 0xAF, 0xF6, 0xFA,
+    0x95, 0x26, 0x26, 0xDB, 0xF3, 0x48, 0x4C, 0x8B, 0xEF, 0xFE, 0x98, 0x4C, 0x91, 0x8D, 0x58, 0x49,
+    0xB1, 0x8E, 0x29, 0x75, 0x97, 0xEE, 0xC3, 0xF3, 0x9A, 0x51, 0x6C, 0xB7, 0x5E, 0x62, 0xED, 0x76,
+    0x63, 0x84, 0x56, 0x33, 0xAD, 0x26, 0x5A, 0x8D, 0xB5, 0xD4, 0xD0, 0xEA, 0xD9, 0x8D, 0x5D, 0x96,
+    0x50, 0xAD, 0x76, 0x6D, 0x35, 0x6D, 0x9D, 0xD4, 0x1B, 0xA0, 0x9D, 0xDA, 0x04, 0xC0, 0x77, 0x69,
+    0x0B, 0x7D, 0x78, 0xBB, 0x6D, 0xC3, 0x43, 0xF5, 0x96, 0x19, 0x9C, 0x6E, 0x69, 0xFD, 0x7C, 0x4A,
+    0x9B, 0x00, 0xFE, 0x7F,
 };
 
 static const EpdGlyph bookerly_16_bolditalicGlyphs[] = {
@@ -2396,7 +2476,7 @@ static const EpdGlyph bookerly_16_bolditalicGlyphs[] = {
     { 11, 30, 10, -1, 26, 83, 10313 }, // |
     { 15, 33, 14, -2, 27, 124, 10396 }, // }
     { 17, 8, 21, 2, 15, 34, 10520 }, // ~
-    { 0, 0, 7, 0, 0, 0, 0 }, //  
+    { 0, 0, 7, 0, 0, 0, 10554 }, //  
     { 11, 26, 11, -1, 18, 72, 0 }, // ¡
     { 17, 33, 21, 2, 26, 141, 72 }, // ¢
     { 22, 24, 21, -1, 23, 132, 213 }, // £
@@ -2407,642 +2487,649 @@ static const EpdGlyph bookerly_16_bolditalicGlyphs[] = {
     { 12, 6, 20, 4, 26, 18, 756 }, // ¨
     { 25, 25, 26, 0, 24, 157, 774 }, // ©
     { 14, 17, 15, 1, 24, 60, 931 }, // ª
-    { 19, 13, 20, 1, 15, 62, 991 }, // «
-    { 15, 9, 21, 3, 16, 34, 1053 }, // ¬
-    { 11, 5, 13, 1, 11, 14, 1087 }, // ­
-    { 19, 18, 19, 0, 26, 86, 1101 }, // ®
-    { 12, 4, 20, 4, 24, 12, 1187 }, // ¯
-    { 13, 12, 17, 2, 23, 39, 1199 }, // °
-    { 15, 21, 21, 3, 20, 79, 1238 }, // ±
-    { 14, 16, 15, 0, 28, 56, 1317 }, // ²
-    { 12, 17, 15, 1, 28, 51, 1373 }, // ³
-    { 7, 10, 20, 7, 29, 18, 1424 }, // ´
-    { 22, 26, 20, -2, 18, 143, 1442 }, // µ
-    { 22, 28, 20, -1, 23, 154, 1585 }, // ¶
-    { 6, 6, 10, 2, 12, 9, 1739 }, // ·
-    { 8, 8, 20, 6, -1, 16, 1748 }, // ¸
-    { 11, 16, 15, 1, 28, 44, 1764 }, // ¹
-    { 13, 17, 15, 1, 24, 56, 1808 }, // º
-    { 19, 13, 20, 0, 15, 62, 1864 }, // »
-    { 34, 28, 36, 1, 25, 238, 1926 }, // ¼
-    { 34, 28, 36, 1, 25, 238, 2164 }, // ½
-    { 34, 28, 36, 1, 25, 238, 2402 }, // ¾
-    { 11, 25, 13, 0, 18, 69, 2640 }, // ¿
-    { 26, 33, 24, -2, 33, 215, 2709 }, // À
-    { 26, 33, 24, -2, 33, 215, 2924 }, // Á
-    { 26, 32, 24, -2, 32, 208, 3139 }, // Â
-    { 26, 32, 24, -2, 32, 208, 3347 }, // Ã
-    { 26, 31, 24, -2, 31, 202, 3555 }, // Ä
-    { 26, 33, 24, -2, 33, 215, 3757 }, // Å
-    { 34, 23, 31, -3, 23, 196, 3972 }, // Æ
-    { 21, 33, 22, 1, 24, 174, 4168 }, // Ç
-    { 23, 33, 21, -2, 33, 190, 4342 }, // È
-    { 23, 33, 21, -2, 33, 190, 4532 }, // É
-    { 23, 32, 21, -2, 32, 184, 4722 }, // Ê
-    { 23, 31, 21, -2, 31, 179, 4906 }, // Ë
-    { 17, 33, 13, -2, 33, 141, 5085 }, // Ì
-    { 17, 33, 13, -2, 33, 141, 5226 }, // Í
-    { 18, 32, 13, -2, 32, 144, 5367 }, // Î
-    { 18, 31, 13, -2, 31, 140, 5511 }, // Ï
-    { 26, 25, 24, -2, 24, 163, 5651 }, // Ð
-    { 29, 33, 26, -1, 32, 240, 5814 }, // Ñ
-    { 24, 34, 24, 0, 33, 204, 6054 }, // Ò
-    { 24, 34, 24, 0, 33, 204, 6258 }, // Ó
-    { 24, 33, 24, 0, 32, 198, 6462 }, // Ô
-    { 24, 33, 24, 0, 32, 198, 6660 }, // Õ
-    { 24, 32, 24, 0, 31, 192, 6858 }, // Ö
-    { 15, 15, 21, 3, 19, 57, 7050 }, // ×
-    { 27, 25, 24, -1, 24, 169, 7107 }, // Ø
-    { 26, 34, 26, 2, 33, 221, 7276 }, // Ù
-    { 26, 34, 26, 2, 33, 221, 7497 }, // Ú
-    { 26, 33, 26, 2, 32, 215, 7718 }, // Û
-    { 26, 32, 26, 2, 31, 208, 7933 }, // Ü
-    { 23, 33, 22, 1, 33, 190, 8141 }, // Ý
-    { 22, 23, 20, -2, 23, 127, 8331 }, // Þ
-    { 27, 34, 21, -6, 26, 230, 8458 }, // ß
-    { 20, 29, 20, 0, 28, 145, 8688 }, // à
-    { 20, 30, 20, 0, 29, 150, 8833 }, // á
-    { 20, 29, 20, 0, 28, 145, 8983 }, // â
-    { 20, 27, 20, 0, 26, 135, 9128 }, // ã
-    { 20, 27, 20, 0, 26, 135, 9263 }, // ä
-    { 20, 29, 20, 0, 28, 145, 9398 }, // å
-    { 26, 19, 26, 0, 18, 124, 9543 }, // æ
-    { 15, 27, 15, 0, 18, 102, 9667 }, // ç
-    { 15, 29, 16, 0, 28, 109, 9769 }, // è
-    { 17, 30, 16, 0, 29, 128, 9878 }, // é
-    { 16, 29, 16, 0, 28, 116, 10006 }, // ê
-    { 17, 27, 16, 0, 26, 115, 10122 }, // ë
-    { 9, 29, 11, 1, 28, 66, 10237 }, // ì
-    { 13, 30, 11, 1, 29, 98, 10303 }, // í
-    { 12, 29, 11, 1, 28, 87, 10401 }, // î
-    { 13, 27, 11, 1, 26, 88, 10488 }, // ï
-    { 18, 28, 18, 0, 27, 126, 10576 }, // ð
-    { 19, 27, 20, 1, 26, 129, 10702 }, // ñ
-    { 17, 29, 18, 0, 28, 124, 10831 }, // ò
-    { 18, 30, 18, 0, 29, 135, 10955 }, // ó
-    { 18, 29, 18, 0, 28, 131, 11090 }, // ô
-    { 18, 27, 18, 0, 26, 122, 11221 }, // õ
-    { 18, 27, 18, 0, 26, 122, 11343 }, // ö
-    { 15, 16, 21, 3, 19, 60, 11465 }, // ÷
-    { 22, 19, 18, -2, 18, 105, 11525 }, // ø
-    { 20, 29, 20, 0, 28, 145, 11630 }, // ù
-    { 20, 30, 20, 0, 29, 150, 11775 }, // ú
-    { 20, 29, 20, 0, 28, 145, 11925 }, // û
-    { 20, 27, 20, 0, 26, 135, 12070 }, // ü
-    { 22, 37, 17, -5, 29, 204, 12205 }, // ý
-    { 22, 34, 18, -4, 26, 187, 12409 }, // þ
-    { 22, 34, 17, -5, 26, 187, 12596 }, // ÿ
-    { 26, 30, 24, -2, 30, 195, 0 }, // Ā
-    { 20, 25, 20, 0, 24, 125, 195 }, // ā
-    { 26, 32, 24, -2, 32, 208, 320 }, // Ă
-    { 20, 27, 20, 0, 26, 135, 528 }, // ă
-    { 26, 31, 24, -2, 24, 202, 663 }, // Ą
-    { 20, 25, 20, 0, 18, 125, 865 }, // ą
-    { 21, 34, 22, 1, 33, 179, 990 }, // Ć
-    { 17, 30, 15, 0, 29, 128, 1169 }, // ć
-    { 21, 33, 22, 1, 32, 174, 1297 }, // Ĉ
-    { 16, 29, 15, 0, 28, 116, 1471 }, // ĉ
-    { 21, 33, 22, 1, 32, 174, 1587 }, // Ċ
-    { 15, 27, 15, 0, 26, 102, 1761 }, // ċ
-    { 21, 33, 22, 1, 32, 174, 1863 }, // Č
-    { 18, 29, 15, 0, 28, 131, 2037 }, // č
-    { 26, 33, 24, -2, 32, 215, 2168 }, // Ď
-    { 25, 27, 20, 0, 26, 169, 2383 }, // ď
-    { 26, 25, 24, -2, 24, 163, 2552 }, // Đ
-    { 22, 27, 20, 0, 26, 149, 2715 }, // đ
-    { 23, 30, 21, -2, 30, 173, 2864 }, // Ē
-    { 17, 25, 16, 0, 24, 107, 3037 }, // ē
-    { 23, 32, 21, -2, 32, 184, 3144 }, // Ĕ
-    { 17, 27, 16, 0, 26, 115, 3328 }, // ĕ
-    { 23, 32, 21, -2, 32, 184, 3443 }, // Ė
-    { 15, 27, 16, 0, 26, 102, 3627 }, // ė
-    { 23, 30, 21, -2, 23, 173, 3729 }, // Ę
-    { 15, 25, 16, 0, 18, 94, 3902 }, // ę
-    { 23, 32, 21, -2, 32, 184, 3996 }, // Ě
-    { 18, 29, 16, 0, 28, 131, 4180 }, // ě
-    { 22, 33, 24, 1, 32, 182, 4311 }, // Ĝ
-    { 23, 36, 17, -3, 28, 207, 4493 }, // ĝ
-    { 22, 33, 24, 1, 32, 182, 4700 }, // Ğ
-    { 23, 34, 17, -3, 26, 196, 4882 }, // ğ
-    { 22, 33, 24, 1, 32, 182, 5078 }, // Ġ
-    { 23, 34, 17, -3, 26, 196, 5260 }, // ġ
-    { 22, 33, 24, 1, 24, 182, 5456 }, // Ģ
-    { 23, 37, 17, -3, 29, 213, 5638 }, // ģ
-    { 30, 32, 26, -2, 32, 240, 5851 }, // Ĥ
-    { 19, 35, 20, 0, 34, 167, 6091 }, // ĥ
-    { 30, 23, 26, -2, 23, 173, 6258 }, // Ħ
-    { 19, 27, 20, 0, 26, 129, 6431 }, // ħ
-    { 18, 32, 13, -2, 32, 144, 6560 }, // Ĩ
-    { 13, 27, 11, 1, 26, 88, 6704 }, // ĩ
-    { 18, 30, 13, -2, 30, 135, 6792 }, // Ī
-    { 13, 25, 11, 1, 24, 82, 6927 }, // ī
-    { 17, 32, 13, -2, 32, 136, 7009 }, // Ĭ
-    { 13, 27, 11, 1, 26, 88, 7145 }, // ĭ
-    { 17, 30, 13, -2, 23, 128, 7233 }, // Į
-    { 10, 33, 11, 1, 26, 83, 7361 }, // į
-    { 17, 32, 13, -2, 32, 136, 7444 }, // İ
-    { 9, 19, 11, 1, 18, 43, 7580 }, // ı
-    { 30, 30, 26, -2, 23, 225, 7623 }, // Ĳ
-    { 22, 34, 21, 1, 26, 187, 7848 }, // ĳ
-    { 22, 39, 13, -6, 32, 215, 8035 }, // Ĵ
-    { 21, 36, 10, -7, 28, 189, 8250 }, // ĵ
-    { 27, 32, 24, -2, 23, 216, 8439 }, // Ķ
-    { 17, 35, 18, 0, 26, 149, 8655 }, // ķ
-    { 18, 19, 19, 1, 18, 86, 8804 }, // ĸ
-    { 20, 33, 19, -2, 33, 165, 8890 }, // Ĺ
-    { 12, 35, 11, 1, 34, 105, 9055 }, // ĺ
-    { 20, 32, 19, -2, 23, 160, 9160 }, // Ļ
-    { 12, 35, 11, -1, 26, 105, 9320 }, // ļ
-    { 22, 26, 19, -2, 26, 143, 9425 }, // Ľ
-    { 15, 27, 12, 1, 26, 102, 9568 }, // ľ
-    { 21, 23, 19, -2, 23, 121, 9670 }, // Ŀ
-    { 14, 27, 14, 1, 26, 95, 9791 }, // ŀ
-    { 20, 23, 19, -2, 23, 115, 9886 }, // Ł
-    { 13, 27, 10, -1, 26, 88, 10001 }, // ł
-    { 29, 34, 26, -1, 33, 247, 10089 }, // Ń
-    { 19, 30, 20, 1, 29, 143, 10336 }, // ń
-    { 29, 32, 26, -1, 23, 232, 10479 }, // Ņ
-    { 19, 27, 20, 1, 18, 129, 10711 }, // ņ
-    { 29, 33, 26, -1, 32, 240, 10840 }, // Ň
-    { 19, 29, 20, 1, 28, 138, 11080 }, // ň
-    { 25, 26, 27, 2, 25, 163, 11218 }, // ŉ
-    { 29, 30, 26, -1, 23, 218, 11381 }, // Ŋ
-    { 18, 26, 19, 1, 18, 117, 11599 }, // ŋ
-    { 24, 31, 24, 0, 30, 186, 11716 }, // Ō
-    { 18, 25, 18, 0, 24, 113, 11902 }, // ō
-    { 24, 33, 24, 0, 32, 198, 12015 }, // Ŏ
-    { 18, 27, 18, 0, 26, 122, 12213 }, // ŏ
-    { 25, 34, 24, 0, 33, 213, 12335 }, // Ő
-    { 20, 29, 18, 0, 28, 145, 12548 }, // ő
-    { 33, 25, 33, 0, 24, 207, 12693 }, // Œ
-    { 27, 19, 27, 0, 18, 129, 12900 }, // œ
-    { 24, 34, 22, -2, 33, 204, 13029 }, // Ŕ
-    { 16, 29, 16, 1, 29, 116, 13233 }, // ŕ
-    { 24, 33, 22, -2, 24, 198, 13349 }, // Ŗ
-    { 18, 27, 16, -1, 18, 122, 13547 }, // ŗ
-    { 24, 33, 22, -2, 32, 198, 13669 }, // Ř
-    { 17, 28, 16, 1, 28, 119, 13867 }, // ř
-    { 19, 34, 18, -1, 33, 162, 13986 }, // Ś
-    { 17, 30, 14, -1, 29, 128, 14148 }, // ś
-    { 19, 33, 18, -1, 32, 157, 14276 }, // Ŝ
-    { 16, 29, 14, -1, 28, 116, 14433 }, // ŝ
-    { 19, 33, 18, -1, 24, 157, 14549 }, // Ş
-    { 15, 27, 14, -1, 18, 102, 14706 }, // ş
-    { 20, 33, 18, -1, 32, 165, 14808 }, // Š
-    { 18, 29, 14, -1, 28, 131, 14973 }, // š
-    { 22, 32, 22, 2, 23, 176, 15104 }, // Ţ
-    { 15, 31, 14, 0, 22, 117, 15280 }, // ţ
-    { 22, 32, 22, 2, 32, 176, 15397 }, // Ť
-    { 17, 28, 14, 0, 27, 119, 15573 }, // ť
-    { 22, 23, 22, 2, 23, 127, 15692 }, // Ŧ
-    { 15, 23, 14, 0, 22, 87, 15819 }, // ŧ
-    { 26, 33, 26, 2, 32, 215, 15906 }, // Ũ
-    { 20, 27, 20, 0, 26, 135, 16121 }, // ũ
-    { 26, 31, 26, 2, 30, 202, 16256 }, // Ū
-    { 20, 25, 20, 0, 24, 125, 16458 }, // ū
-    { 26, 33, 26, 2, 32, 215, 16583 }, // Ŭ
-    { 20, 27, 20, 0, 26, 135, 16798 }, // ŭ
-    { 26, 34, 26, 2, 33, 221, 16933 }, // Ů
-    { 20, 29, 20, 0, 28, 145, 17154 }, // ů
-    { 26, 34, 26, 2, 33, 221, 17299 }, // Ű
-    { 20, 29, 20, 0, 28, 145, 17520 }, // ű
-    { 26, 30, 26, 2, 23, 195, 17665 }, // Ų
-    { 20, 25, 20, 0, 18, 125, 17860 }, // ų
-    { 33, 33, 33, 2, 32, 273, 17985 }, // Ŵ
-    { 25, 29, 25, 0, 28, 182, 18258 }, // ŵ
-    { 23, 32, 22, 1, 32, 184, 18440 }, // Ŷ
-    { 22, 36, 17, -5, 28, 198, 18624 }, // ŷ
-    { 23, 31, 22, 1, 31, 179, 18822 }, // Ÿ
-    { 21, 34, 20, -1, 33, 179, 19001 }, // Ź
-    { 17, 30, 16, -1, 29, 128, 19180 }, // ź
-    { 21, 33, 20, -1, 32, 174, 19308 }, // Ż
-    { 17, 27, 16, -1, 26, 115, 19482 }, // ż
-    { 21, 33, 20, -1, 32, 174, 19597 }, // Ž
-    { 17, 29, 16, -1, 28, 124, 19771 }, // ž
-    { 24, 34, 14, -6, 26, 204, 19895 }, // ſ
-    { 7, 9, 0, -5, 28, 16, 0 }, // ̀
-    { 7, 10, 0, -2, 29, 18, 16 }, // ́
-    { 12, 9, 0, -7, 28, 27, 34 }, // ̂
-    { 12, 6, 0, -6, 26, 18, 61 }, // ̃
-    { 12, 4, 0, -6, 24, 12, 79 }, // ̄
-    { 12, 6, 0, -6, 26, 18, 91 }, // ̆
-    { 6, 6, 0, -3, 26, 9, 109 }, // ̇
-    { 12, 6, 0, -6, 26, 18, 118 }, // ̈
-    { 9, 10, 0, -4, 29, 23, 136 }, // ̉
-    { 10, 9, 0, -5, 28, 23, 159 }, // ̊
-    { 13, 9, 0, -6, 28, 30, 182 }, // ̋
-    { 12, 8, 0, -5, 28, 24, 212 }, // ̌
-    { 11, 9, 0, -7, 28, 25, 236 }, // ̏
-    { 11, 7, 0, -6, 26, 20, 261 }, // ̑
-    { 7, 10, 0, -3, 29, 18, 281 }, // ̒
-    { 7, 9, 0, -3, 29, 16, 299 }, // ̓
-    { 6, 9, 0, -4, 29, 14, 315 }, // ̔
-    { 6, 9, 0, -3, 29, 14, 329 }, // ̕
-    { 6, 8, 0, -3, 21, 12, 343 }, // ̛
-    { 6, 6, 0, -3, -2, 9, 355 }, // ̣
-    { 12, 5, 0, -6, -3, 15, 364 }, // ̤
-    { 8, 8, 0, -4, -1, 16, 379 }, // ̥
-    { 7, 8, 0, -4, -1, 14, 395 }, // ̦
-    { 8, 8, 0, -4, -1, 16, 409 }, // ̧
-    { 8, 8, 0, -4, 1, 16, 425 }, // ̨
-    { 6, 9, 9, -1, -1, 14, 441 }, // ̩
-    { 13, 8, 0, -7, -1, 26, 455 }, // ̭
-    { 12, 6, 0, -6, -2, 18, 481 }, // ̮
-    { 12, 7, 0, -6, -2, 21, 499 }, // ̰
-    { 12, 4, 0, -6, -3, 12, 520 }, // ̱
-    { 12, 7, 0, -6, 26, 21, 532 }, // ͂
-    { 13, 14, 0, -7, 34, 46, 553 }, // ̈́
-    { 6, 7, 0, -2, -2, 11, 599 }, // ͅ
-    { 23, 33, 21, -2, 33, 190, 0 }, // Ѐ
-    { 23, 31, 21, -2, 31, 179, 190 }, // Ё
-    { 22, 30, 25, 2, 23, 165, 369 }, // Ђ
-    { 23, 33, 19, -2, 33, 190, 534 }, // Ѓ
-    { 22, 25, 21, 0, 24, 138, 724 }, // Є
-    { 19, 25, 18, -1, 24, 119, 862 }, // Ѕ
-    { 17, 23, 13, -2, 23, 98, 981 }, // І
-    { 18, 31, 13, -2, 31, 140, 1079 }, // Ї
-    { 21, 30, 13, -6, 23, 158, 1219 }, // Ј
-    { 32, 24, 31, -2, 23, 192, 1377 }, // Љ
-    { 33, 24, 32, -2, 23, 198, 1569 }, // Њ
-    { 24, 23, 28, 2, 23, 138, 1767 }, // Ћ
-    { 27, 34, 23, -2, 33, 230, 1905 }, // Ќ
-    { 30, 33, 27, -2, 33, 248, 2135 }, // Ѝ
-    { 24, 34, 22, 1, 33, 204, 2383 }, // Ў
-    { 29, 31, 25, -2, 23, 225, 2587 }, // Џ
-    { 26, 24, 24, -2, 24, 156, 2812 }, // А
-    { 22, 24, 21, -2, 23, 132, 2968 }, // Б
-    { 22, 25, 21, -2, 24, 138, 3100 }, // В
-    { 23, 23, 19, -2, 23, 133, 3238 }, // Г
-    { 28, 30, 25, -2, 23, 210, 3371 }, // Д
-    { 23, 23, 21, -2, 23, 133, 3581 }, // Е
-    { 37, 25, 32, -3, 24, 232, 3714 }, // Ж
-    { 19, 25, 19, -1, 24, 119, 3946 }, // З
-    { 30, 23, 27, -2, 23, 173, 4065 }, // И
-    { 30, 33, 27, -2, 33, 248, 4238 }, // Й
-    { 27, 25, 23, -2, 24, 169, 4486 }, // К
-    { 28, 24, 24, -2, 23, 168, 4655 }, // Л
-    { 33, 23, 30, -3, 23, 190, 4823 }, // М
-    { 30, 23, 26, -2, 23, 173, 5013 }, // Н
-    { 24, 25, 24, 0, 24, 150, 5186 }, // О
-    { 29, 23, 26, -2, 23, 167, 5336 }, // П
-    { 23, 24, 20, -2, 24, 138, 5503 }, // Р
-    { 21, 25, 22, 1, 24, 132, 5641 }, // С
-    { 22, 23, 22, 2, 23, 127, 5773 }, // Т
-    { 24, 24, 22, 1, 23, 144, 5900 }, // У
-    { 24, 25, 25, 0, 24, 150, 6044 }, // Ф
-    { 27, 23, 22, -3, 23, 156, 6194 }, // Х
-    { 29, 30, 26, -2, 23, 218, 6350 }, // Ц
-    { 23, 23, 24, 2, 23, 133, 6568 }, // Ч
-    { 37, 23, 33, -2, 23, 213, 6701 }, // Ш
-    { 37, 30, 34, -2, 23, 278, 6914 }, // Щ
-    { 21, 24, 24, 2, 23, 126, 7192 }, // Ъ
-    { 35, 24, 31, -2, 23, 210, 7318 }, // Ы
-    { 21, 24, 20, -2, 23, 126, 7528 }, // Ь
-    { 21, 25, 21, -1, 24, 132, 7654 }, // Э
-    { 36, 25, 34, -2, 24, 225, 7786 }, // Ю
-    { 26, 24, 22, -2, 23, 156, 8011 }, // Я
-    { 20, 19, 20, 0, 18, 95, 8167 }, // а
-    { 19, 28, 18, 1, 27, 133, 8262 }, // б
-    { 17, 19, 17, 0, 18, 81, 8395 }, // в
-    { 15, 19, 15, 0, 18, 72, 8476 }, // г
-    { 18, 27, 18, 0, 26, 122, 8548 }, // д
-    { 15, 19, 16, 0, 18, 72, 8670 }, // е
-    { 30, 19, 30, 0, 18, 143, 8742 }, // ж
-    { 16, 19, 15, -1, 18, 76, 8885 }, // з
-    { 20, 19, 20, 0, 18, 95, 8961 }, // и
-    { 20, 28, 20, 0, 27, 140, 9056 }, // й
-    { 18, 19, 19, 1, 18, 86, 9196 }, // к
-    { 21, 19, 21, -1, 18, 100, 9282 }, // л
-    { 27, 19, 26, -1, 18, 129, 9382 }, // м
-    { 19, 19, 21, 1, 18, 91, 9511 }, // н
-    { 17, 19, 18, 0, 18, 81, 9602 }, // о
-    { 19, 19, 20, 1, 18, 91, 9683 }, // п
-    { 21, 26, 19, -3, 18, 137, 9774 }, // р
-    { 15, 19, 15, 0, 18, 72, 9911 }, // с
-    { 27, 19, 29, 1, 18, 129, 9983 }, // т
-    { 22, 26, 17, -5, 18, 143, 10112 }, // у
-    { 23, 34, 24, 0, 26, 196, 10255 }, // ф
-    { 21, 19, 19, -1, 18, 100, 10451 }, // х
-    { 20, 25, 21, 0, 18, 125, 10551 }, // ц
-    { 18, 19, 20, 1, 18, 86, 10676 }, // ч
-    { 27, 19, 28, 0, 18, 129, 10762 }, // ш
-    { 28, 25, 28, 0, 18, 175, 10891 }, // щ
-    { 18, 19, 18, 0, 18, 86, 11066 }, // ъ
-    { 26, 19, 26, 0, 18, 124, 11152 }, // ы
-    { 16, 19, 17, 0, 18, 76, 11276 }, // ь
-    { 16, 19, 16, -1, 18, 76, 11352 }, // э
-    { 25, 19, 26, 1, 18, 119, 11428 }, // ю
-    { 19, 19, 20, 0, 18, 91, 11547 }, // я
-    { 15, 29, 16, 0, 28, 109, 11638 }, // ѐ
-    { 17, 27, 16, 0, 26, 115, 11747 }, // ё
-    { 18, 34, 19, 0, 26, 153, 11862 }, // ђ
-    { 16, 30, 15, 0, 29, 120, 12015 }, // ѓ
-    { 16, 19, 16, 0, 18, 76, 12135 }, // є
-    { 15, 19, 14, -1, 18, 72, 12211 }, // ѕ
-    { 10, 27, 11, 1, 26, 68, 12283 }, // і
-    { 13, 27, 11, 1, 26, 88, 12351 }, // ї
-    { 19, 34, 10, -7, 26, 162, 12439 }, // ј
-    { 27, 19, 26, -1, 18, 129, 12601 }, // љ
-    { 24, 19, 26, 1, 18, 114, 12730 }, // њ
-    { 19, 27, 20, 0, 26, 129, 12844 }, // ћ
-    { 18, 30, 19, 1, 29, 135, 12973 }, // ќ
-    { 20, 29, 20, 0, 28, 145, 13108 }, // ѝ
-    { 22, 35, 17, -5, 27, 193, 13253 }, // ў
-    { 20, 25, 20, 0, 18, 125, 13446 }, // џ
-    { 21, 27, 23, 2, 26, 142, 13571 }, // Ѣ
-    { 24, 19, 26, 1, 18, 114, 13713 }, // ѣ
-    { 24, 25, 24, 0, 24, 150, 13827 }, // Ѳ
-    { 17, 19, 18, 0, 18, 81, 13977 }, // ѳ
-    { 25, 25, 25, 2, 24, 157, 14058 }, // Ѵ
-    { 21, 19, 19, -1, 18, 100, 14215 }, // ѵ
-    { 30, 40, 27, -2, 33, 300, 14315 }, // Ҋ
-    { 20, 34, 20, 0, 27, 170, 14615 }, // ҋ
-    { 21, 24, 20, -2, 23, 126, 14785 }, // Ҍ
-    { 15, 25, 17, 1, 24, 94, 14911 }, // ҍ
-    { 23, 24, 20, -2, 24, 138, 15005 }, // Ҏ
-    { 21, 26, 19, -3, 18, 137, 15143 }, // ҏ
-    { 23, 28, 19, -2, 28, 161, 15280 }, // Ґ
-    { 17, 23, 16, 0, 22, 98, 15441 }, // ґ
-    { 23, 23, 19, -2, 23, 133, 15539 }, // Ғ
-    { 15, 19, 15, 0, 18, 72, 15672 }, // ғ
-    { 22, 30, 22, -2, 23, 165, 15744 }, // Ҕ
-    { 16, 26, 18, 1, 18, 104, 15909 }, // ҕ
-    { 37, 31, 32, -3, 24, 287, 16013 }, // Җ
-    { 30, 25, 30, 0, 18, 188, 16300 }, // җ
-    { 19, 31, 19, -1, 24, 148, 16488 }, // Ҙ
-    { 16, 25, 15, -1, 18, 100, 16636 }, // ҙ
-    { 27, 31, 23, -2, 24, 210, 16736 }, // Қ
-    { 18, 25, 19, 1, 18, 113, 16946 }, // қ
-    { 28, 25, 24, -2, 24, 175, 17059 }, // Ҝ
-    { 20, 19, 21, 1, 18, 95, 17234 }, // ҝ
-    { 27, 25, 23, -2, 24, 169, 17329 }, // Ҟ
-    { 18, 25, 18, 0, 24, 113, 17498 }, // ҟ
-    { 27, 25, 27, 2, 24, 169, 17611 }, // Ҡ
-    { 21, 19, 22, 0, 18, 100, 17780 }, // ҡ
-    { 30, 30, 27, -2, 23, 225, 17880 }, // Ң
-    { 20, 25, 21, 1, 18, 125, 18105 }, // ң
-    { 35, 23, 31, -2, 23, 202, 18230 }, // Ҥ
-    { 25, 19, 25, 1, 18, 119, 18432 }, // ҥ
-    { 34, 30, 34, -2, 23, 255, 18551 }, // Ҧ
-    { 26, 26, 28, 1, 18, 169, 18806 }, // ҧ
-    { 26, 25, 27, 1, 24, 163, 18975 }, // Ҩ
-    { 21, 19, 21, 0, 18, 100, 19138 }, // ҩ
-    { 21, 31, 22, 1, 24, 163, 19238 }, // Ҫ
-    { 15, 25, 15, 0, 18, 94, 19401 }, // ҫ
-    { 22, 30, 22, 2, 23, 165, 19495 }, // Ҭ
-    { 28, 25, 29, 1, 18, 175, 19660 }, // ҭ
-    { 23, 23, 22, 1, 23, 133, 19835 }, // Ү
-    { 17, 26, 17, 0, 18, 111, 19968 }, // ү
-    { 23, 23, 22, 1, 23, 133, 20079 }, // Ұ
-    { 17, 26, 17, 0, 18, 111, 20212 }, // ұ
-    { 27, 30, 22, -3, 23, 203, 20323 }, // Ҳ
-    { 21, 25, 19, -1, 18, 132, 20526 }, // ҳ
-    { 30, 30, 30, 2, 23, 225, 20658 }, // Ҵ
-    { 20, 31, 21, 0, 24, 155, 20883 }, // ҵ
-    { 23, 30, 24, 2, 23, 173, 21038 }, // Ҷ
-    { 19, 25, 20, 1, 18, 119, 21211 }, // ҷ
-    { 24, 23, 24, 2, 23, 138, 21330 }, // Ҹ
-    { 19, 19, 20, 1, 18, 91, 21468 }, // ҹ
-    { 24, 23, 24, -2, 23, 138, 21559 }, // Һ
-    { 19, 27, 20, 0, 26, 129, 21697 }, // һ
-    { 26, 25, 27, 1, 24, 163, 21826 }, // Ҽ
-    { 19, 19, 20, 0, 18, 91, 21989 }, // ҽ
-    { 26, 32, 27, 1, 24, 208, 22080 }, // Ҿ
-    { 19, 25, 20, 0, 18, 119, 22288 }, // ҿ
-    { 17, 23, 13, -2, 23, 98, 22407 }, // Ӏ
-    { 37, 34, 32, -3, 33, 315, 22505 }, // Ӂ
-    { 30, 28, 30, 0, 27, 210, 22820 }, // ӂ
-    { 27, 31, 24, -2, 24, 210, 23030 }, // Ӄ
-    { 18, 26, 19, 1, 18, 117, 23240 }, // ӄ
-    { 28, 30, 24, -2, 23, 210, 23357 }, // Ӆ
-    { 22, 25, 21, -1, 18, 138, 23567 }, // ӆ
-    { 30, 30, 26, -2, 23, 225, 23705 }, // Ӈ
-    { 18, 26, 19, 1, 18, 117, 23930 }, // ӈ
-    { 30, 30, 27, -2, 23, 225, 24047 }, // Ӊ
-    { 20, 25, 21, 1, 18, 125, 24272 }, // ӊ
-    { 23, 30, 24, 2, 23, 173, 24397 }, // Ӌ
-    { 18, 25, 19, 1, 18, 113, 24570 }, // ӌ
-    { 33, 30, 30, -3, 23, 248, 24683 }, // Ӎ
-    { 27, 25, 26, -1, 18, 169, 24931 }, // ӎ
-    { 17, 26, 13, -2, 26, 111, 25100 }, // ӏ
-    { 26, 33, 24, -2, 33, 215, 25211 }, // Ӑ
-    { 20, 28, 20, 0, 27, 140, 25426 }, // ӑ
-    { 26, 31, 24, -2, 31, 202, 25566 }, // Ӓ
-    { 20, 27, 20, 0, 26, 135, 25768 }, // ӓ
-    { 34, 23, 31, -3, 23, 196, 25903 }, // Ӕ
-    { 26, 19, 26, 0, 18, 124, 26099 }, // ӕ
-    { 23, 33, 21, -2, 33, 190, 26223 }, // Ӗ
-    { 17, 28, 16, 0, 27, 119, 26413 }, // ӗ
-    { 21, 25, 22, 0, 24, 132, 26532 }, // Ә
-    { 16, 19, 16, 0, 18, 76, 26664 }, // ә
-    { 21, 32, 22, 0, 31, 168, 26740 }, // Ӛ
-    { 16, 27, 16, 0, 26, 108, 26908 }, // ӛ
-    { 37, 32, 32, -3, 31, 296, 27016 }, // Ӝ
-    { 30, 27, 30, 0, 26, 203, 27312 }, // ӝ
-    { 19, 32, 19, -1, 31, 152, 27515 }, // Ӟ
-    { 17, 27, 15, -1, 26, 115, 27667 }, // ӟ
-    { 21, 24, 19, -1, 23, 126, 27782 }, // Ӡ
-    { 20, 26, 18, -2, 18, 130, 27908 }, // ӡ
-    { 30, 30, 27, -2, 30, 225, 28038 }, // Ӣ
-    { 20, 25, 20, 0, 24, 125, 28263 }, // ӣ
-    { 30, 31, 27, -2, 31, 233, 28388 }, // Ӥ
-    { 20, 27, 20, 0, 26, 135, 28621 }, // ӥ
-    { 24, 32, 24, 0, 31, 192, 28756 }, // Ӧ
-    { 18, 27, 18, 0, 26, 122, 28948 }, // ӧ
-    { 24, 25, 24, 0, 24, 150, 29070 }, // Ө
-    { 17, 19, 18, 0, 18, 81, 29220 }, // ө
-    { 24, 32, 24, 0, 31, 192, 29301 }, // Ӫ
-    { 18, 27, 18, 0, 26, 122, 29493 }, // ӫ
-    { 21, 32, 21, -1, 31, 168, 29615 }, // Ӭ
-    { 16, 27, 16, -1, 26, 108, 29783 }, // ӭ
-    { 24, 31, 22, 1, 30, 186, 29891 }, // Ӯ
-    { 22, 32, 17, -5, 24, 176, 30077 }, // ӯ
-    { 24, 32, 22, 1, 31, 192, 30253 }, // Ӱ
-    { 22, 34, 17, -5, 26, 187, 30445 }, // ӱ
-    { 24, 34, 22, 1, 33, 204, 30632 }, // Ӳ
-    { 22, 36, 17, -5, 28, 198, 30836 }, // ӳ
-    { 23, 31, 24, 2, 31, 179, 31034 }, // Ӵ
-    { 18, 27, 20, 1, 26, 122, 31213 }, // ӵ
-    { 23, 30, 19, -2, 23, 173, 31335 }, // Ӷ
-    { 15, 25, 15, 0, 18, 94, 31508 }, // ӷ
-    { 35, 32, 31, -2, 31, 280, 31602 }, // Ӹ
-    { 26, 27, 26, 0, 26, 176, 31882 }, // ӹ
-    { 23, 30, 19, -2, 23, 173, 32058 }, // Ӻ
-    { 15, 25, 15, 0, 18, 94, 32231 }, // ӻ
-    { 27, 30, 22, -3, 23, 203, 32325 }, // Ӽ
-    { 21, 26, 19, -1, 18, 137, 32528 }, // ӽ
-    { 27, 23, 22, -3, 23, 156, 32665 }, // Ӿ
-    { 21, 19, 19, -1, 18, 100, 32821 }, // ӿ
-    { 0, 0, 17, 0, 0, 0, 0 }, //  
-    { 0, 0, 33, 0, 0, 0, 0 }, //  
-    { 0, 0, 17, 0, 0, 0, 0 }, //  
-    { 0, 0, 33, 0, 0, 0, 0 }, //  
-    { 0, 0, 11, 0, 0, 0, 0 }, //  
-    { 0, 0, 8, 0, 0, 0, 0 }, //  
-    { 0, 0, 5, 0, 0, 0, 0 }, //  
-    { 0, 0, 21, 0, 0, 0, 0 }, //  
-    { 0, 0, 10, 0, 0, 0, 0 }, //  
-    { 0, 0, 7, 0, 0, 0, 0 }, //  
-    { 0, 0, 2, 0, 0, 0, 0 }, //  
-    { 0, 0, 0, 0, 0, 0, 0 }, // ​
-    { 2, 28, 0, -1, 20, 14, 0 }, // ‌
-    { 8, 30, 0, -4, 22, 60, 14 }, // ‍
-    { 12, 31, 0, -6, 23, 93, 74 }, // ‎
-    { 12, 31, 0, -6, 23, 93, 167 }, // ‏
-    { 11, 5, 13, 1, 11, 14, 260 }, // ‐
-    { 11, 5, 13, 1, 11, 14, 274 }, // ‑
-    { 17, 4, 21, 2, 13, 17, 288 }, // ‒
-    { 17, 5, 17, 0, 11, 22, 305 }, // –
-    { 33, 5, 33, 0, 11, 42, 327 }, // —
-    { 33, 5, 33, 0, 11, 42, 369 }, // ―
-    { 12, 34, 17, 2, 26, 102, 411 }, // ‖
-    { 17, 9, 17, 0, -1, 39, 513 }, // ‗
-    { 8, 11, 10, 2, 25, 22, 552 }, // ‘
-    { 8, 11, 10, 2, 25, 22, 574 }, // ’
-    { 8, 11, 10, 0, 5, 22, 596 }, // ‚
-    { 8, 12, 10, 1, 25, 24, 618 }, // ‛
-    { 15, 11, 17, 2, 25, 42, 642 }, // “
-    { 15, 12, 17, 2, 25, 45, 684 }, // ”
-    { 14, 11, 17, 0, 5, 39, 729 }, // „
-    { 15, 12, 17, 1, 25, 45, 768 }, // ‟
-    { 15, 22, 15, 1, 24, 83, 813 }, // †
-    { 17, 26, 15, -1, 24, 111, 896 }, // ‡
-    { 8, 8, 10, 1, 13, 16, 1007 }, // •
-    { 12, 12, 21, 4, 17, 36, 1023 }, // ‣
-    { 7, 6, 10, 1, 5, 11, 1059 }, // ․
-    { 15, 6, 17, 1, 5, 23, 1070 }, // ‥
-    { 29, 6, 33, 2, 5, 44, 1093 }, // …
-    { 7, 6, 10, 1, 12, 11, 1137 }, // ‧
-    { 0, 0, 0, 0, 0, 0, 1148 }, //  
-    { 0, 0, 0, 0, 0, 0, 1148 }, //  
-    { 12, 31, 0, -6, 23, 93, 1148 }, // ‪
-    { 12, 31, 0, -6, 23, 93, 1241 }, // ‫
-    { 10, 31, 0, -5, 23, 78, 1334 }, // ‬
-    { 14, 31, 0, -7, 23, 109, 1412 }, // ‭
-    { 14, 31, 0, -7, 23, 109, 1521 }, // ‮
-    { 0, 0, 4, 0, 0, 0, 1630 }, //  
-    { 44, 28, 46, 1, 25, 308, 1630 }, // ‰
-    { 8, 11, 8, 0, 23, 22, 1938 }, // ′
-    { 15, 11, 15, 0, 23, 42, 1960 }, // ″
-    { 23, 11, 23, 0, 23, 64, 2002 }, // ‴
-    { 8, 11, 8, 0, 23, 22, 2066 }, // ‵
-    { 15, 11, 16, 0, 23, 42, 2088 }, // ‶
-    { 22, 11, 23, 0, 23, 61, 2130 }, // ‷
-    { 14, 7, 16, 1, 0, 25, 2191 }, // ‸
-    { 10, 13, 12, 1, 15, 33, 2216 }, // ‹
-    { 11, 13, 12, 0, 15, 36, 2249 }, // ›
-    { 21, 23, 21, 0, 22, 121, 2285 }, // ※
-    { 20, 26, 20, 1, 25, 130, 2406 }, // ‼
-    { 17, 4, 17, 0, 28, 17, 2536 }, // ‾
-    { 8, 5, 10, 1, 11, 10, 2553 }, // ⁃
-    { 21, 28, 9, -6, 25, 147, 2563 }, // ⁄
-    { 24, 25, 26, 2, 24, 150, 2710 }, // ⁇
-    { 22, 26, 23, 2, 25, 143, 2860 }, // ⁈
-    { 22, 26, 23, 1, 25, 143, 3003 }, // ⁉
-    { 20, 7, 33, 6, 13, 35, 3146 }, // ⁓
-    { 30, 11, 30, 0, 23, 83, 3181 }, // ⁗
-    { 0, 0, 7, 0, 0, 0, 3264 }, //  
-    { 0, 0, 0, 0, 0, 0, 3264 }, // ⁠
-    { 0, 0, 0, 0, 0, 0, 3264 }, // ⁡
-    { 0, 0, 0, 0, 0, 0, 3264 }, // ⁢
-    { 0, 0, 0, 0, 0, 0, 3264 }, // ⁣
-    { 0, 0, 0, 0, 0, 0, 3264 }, // ⁤
-    { 14, 17, 15, 0, 28, 60, 0 }, // ⁰
-    { 14, 16, 15, 0, 28, 56, 60 }, // ⁴
-    { 13, 16, 15, 1, 27, 52, 116 }, // ⁵
-    { 14, 17, 15, 1, 28, 60, 168 }, // ⁶
-    { 13, 16, 15, 2, 27, 52, 228 }, // ⁷
-    { 13, 17, 15, 1, 28, 56, 280 }, // ⁸
-    { 14, 17, 15, 0, 28, 60, 336 }, // ⁹
-    { 13, 13, 19, 3, 24, 43, 396 }, // ⁿ
-    { 14, 16, 15, 0, 11, 56, 439 }, // ₀
-    { 11, 16, 15, 1, 11, 44, 495 }, // ₁
-    { 14, 16, 15, 0, 11, 56, 539 }, // ₂
-    { 12, 16, 15, 1, 11, 48, 595 }, // ₃
-    { 14, 16, 15, 0, 11, 56, 643 }, // ₄
-    { 13, 16, 15, 1, 11, 52, 699 }, // ₅
-    { 14, 16, 15, 1, 11, 56, 751 }, // ₆
-    { 13, 16, 15, 2, 11, 52, 807 }, // ₇
-    { 13, 16, 15, 1, 11, 52, 859 }, // ₈
-    { 14, 16, 15, 0, 11, 56, 911 }, // ₉
-    { 22, 23, 21, -1, 23, 127, 0 }, // ₣
-    { 22, 24, 21, -1, 23, 132, 127 }, // ₤
-    { 43, 24, 44, 0, 23, 258, 259 }, // ₧
-    { 23, 24, 21, -1, 23, 138, 517 }, // €
-    { 21, 15, 33, 6, 19, 79, 0 }, // ←
-    { 15, 21, 33, 9, 22, 79, 79 }, // ↑
-    { 21, 15, 33, 6, 19, 79, 158 }, // →
-    { 15, 21, 33, 9, 22, 79, 237 }, // ↓
-    { 21, 15, 33, 6, 19, 79, 316 }, // ↔
-    { 15, 23, 33, 9, 23, 87, 395 }, // ↕
-    { 15, 23, 33, 9, 23, 87, 482 }, // ↨
-    { 15, 23, 33, 9, 23, 87, 569 }, // ↲
-    { 15, 23, 33, 9, 23, 87, 656 }, // ↳
-    { 19, 18, 33, 7, 20, 86, 743 }, // ↵
-    { 21, 19, 33, 6, 21, 100, 829 }, // ⇐
-    { 19, 21, 33, 7, 22, 100, 929 }, // ⇑
-    { 21, 19, 33, 6, 21, 100, 1029 }, // ⇒
-    { 19, 21, 33, 7, 22, 100, 1129 }, // ⇓
-    { 21, 17, 33, 6, 20, 90, 1229 }, // ⇔
-    { 23, 24, 33, 5, 23, 138, 0 }, // ∀
-    { 18, 27, 21, 1, 26, 122, 138 }, // ∂
-    { 17, 23, 33, 8, 23, 98, 260 }, // ∃
-    { 25, 27, 33, 4, 25, 169, 358 }, // ∅
-    { 22, 24, 23, 0, 24, 132, 527 }, // ∆
-    { 21, 24, 33, 6, 23, 126, 659 }, // ∇
-    { 23, 23, 33, 5, 23, 133, 785 }, // ∈
-    { 23, 29, 33, 5, 26, 167, 918 }, // ∉
-    { 23, 20, 33, 5, 21, 115, 1085 }, // ∊
-    { 23, 23, 33, 5, 23, 133, 1200 }, // ∋
-    { 23, 29, 33, 5, 26, 167, 1333 }, // ∌
-    { 23, 20, 33, 5, 21, 115, 1500 }, // ∍
-    { 26, 29, 28, 1, 23, 189, 1615 }, // ∏
-    { 21, 29, 22, 1, 23, 153, 1804 }, // ∑
-    { 15, 4, 21, 3, 13, 15, 1957 }, // −
-    { 21, 26, 17, -2, 24, 137, 1972 }, // ∕
-    { 16, 26, 17, 1, 24, 104, 2109 }, // ∖
-    { 16, 16, 21, 2, 19, 64, 2213 }, // ∗
-    { 13, 12, 21, 4, 17, 39, 2277 }, // ∘
-    { 7, 6, 21, 7, 12, 11, 2316 }, // ∙
-    { 22, 31, 21, -1, 27, 171, 2327 }, // √
-    { 17, 13, 21, 2, 17, 56, 2498 }, // ∝
-    { 21, 13, 21, 0, 17, 69, 2554 }, // ∞
-    { 21, 23, 33, 6, 23, 121, 2623 }, // ∟
-    { 25, 23, 33, 4, 23, 144, 2744 }, // ∠
-    { 5, 34, 17, 6, 26, 43, 2888 }, // ∣
-    { 12, 34, 17, 2, 26, 102, 2931 }, // ∥
-    { 23, 23, 33, 5, 23, 133, 3033 }, // ∧
-    { 23, 23, 33, 5, 23, 133, 3166 }, // ∨
-    { 19, 24, 33, 7, 24, 114, 3299 }, // ∩
-    { 19, 24, 33, 7, 23, 114, 3413 }, // ∪
-    { 19, 34, 21, 1, 26, 162, 3527 }, // ∫
-    { 23, 20, 33, 5, 19, 115, 3689 }, // ∴
-    { 23, 20, 33, 5, 19, 115, 3804 }, // ∵
-    { 8, 18, 10, 1, 20, 36, 3919 }, // ∶
-    { 23, 20, 33, 5, 19, 115, 3955 }, // ∷
-    { 20, 7, 33, 6, 13, 35, 4070 }, // ∼
-    { 20, 18, 33, 6, 20, 90, 4105 }, // ≅
-    { 17, 14, 21, 2, 18, 60, 4195 }, // ≈
-    { 19, 13, 33, 7, 16, 62, 4255 }, // ≍
-    { 15, 16, 21, 3, 19, 60, 4317 }, // ≠
-    { 19, 16, 33, 7, 18, 76, 4377 }, // ≡
-    { 15, 20, 21, 3, 20, 75, 4453 }, // ≤
-    { 15, 21, 21, 3, 21, 79, 4528 }, // ≥
-    { 27, 16, 33, 3, 19, 108, 4607 }, // ≪
-    { 27, 16, 33, 3, 19, 108, 4715 }, // ≫
-    { 23, 20, 33, 5, 21, 115, 4823 }, // ⊃
-    { 23, 29, 33, 5, 26, 167, 4938 }, // ⊄
-    { 23, 29, 33, 5, 26, 167, 5105 }, // ⊅
-    { 21, 23, 33, 6, 23, 121, 5272 }, // ⊆
-    { 21, 23, 33, 6, 23, 121, 5393 }, // ⊇
-    { 25, 25, 33, 4, 24, 157, 5514 }, // ⊕
-    { 25, 25, 33, 4, 24, 157, 5671 }, // ⊖
-    { 25, 25, 33, 4, 24, 157, 5828 }, // ⊗
-    { 25, 25, 33, 4, 24, 157, 5985 }, // ⊘
-    { 19, 23, 33, 7, 23, 110, 6142 }, // ⊥
-    { 7, 6, 21, 7, 12, 11, 6252 }, // ⋅
-    { 29, 6, 33, 2, 12, 44, 6263 }, // ⋯
-    { 31, 32, 33, 1, 28, 248, 0 }, // �
+    { 19, 13, 20, 1, 15, 62, 10554 }, // «
+    { 15, 9, 21, 3, 16, 34, 991 }, // ¬
+    { 11, 5, 13, 1, 11, 14, 1025 }, // ­
+    { 19, 18, 19, 0, 26, 86, 1039 }, // ®
+    { 12, 4, 20, 4, 24, 12, 1125 }, // ¯
+    { 13, 12, 17, 2, 23, 39, 1137 }, // °
+    { 15, 21, 21, 3, 20, 79, 1176 }, // ±
+    { 14, 16, 15, 0, 28, 56, 1255 }, // ²
+    { 12, 17, 15, 1, 28, 51, 1311 }, // ³
+    { 7, 10, 20, 7, 29, 18, 1362 }, // ´
+    { 22, 26, 20, -2, 18, 143, 1380 }, // µ
+    { 22, 28, 20, -1, 23, 154, 1523 }, // ¶
+    { 6, 6, 10, 2, 12, 9, 1677 }, // ·
+    { 8, 8, 20, 6, -1, 16, 1686 }, // ¸
+    { 11, 16, 15, 1, 28, 44, 1702 }, // ¹
+    { 13, 17, 15, 1, 24, 56, 1746 }, // º
+    { 19, 13, 20, 0, 15, 62, 10616 }, // »
+    { 34, 28, 36, 1, 25, 238, 1802 }, // ¼
+    { 34, 28, 36, 1, 25, 238, 2040 }, // ½
+    { 34, 28, 36, 1, 25, 238, 2278 }, // ¾
+    { 11, 25, 13, 0, 18, 69, 2516 }, // ¿
+    { 26, 33, 24, -2, 33, 215, 10678 }, // À
+    { 26, 33, 24, -2, 33, 215, 10893 }, // Á
+    { 26, 32, 24, -2, 32, 208, 11108 }, // Â
+    { 26, 32, 24, -2, 32, 208, 2585 }, // Ã
+    { 26, 31, 24, -2, 31, 202, 11316 }, // Ä
+    { 26, 33, 24, -2, 33, 215, 2793 }, // Å
+    { 34, 23, 31, -3, 23, 196, 3008 }, // Æ
+    { 21, 33, 22, 1, 24, 174, 11518 }, // Ç
+    { 23, 33, 21, -2, 33, 190, 11692 }, // È
+    { 23, 33, 21, -2, 33, 190, 11882 }, // É
+    { 23, 32, 21, -2, 32, 184, 12072 }, // Ê
+    { 23, 31, 21, -2, 31, 179, 12256 }, // Ë
+    { 17, 33, 13, -2, 33, 141, 12435 }, // Ì
+    { 17, 33, 13, -2, 33, 141, 12576 }, // Í
+    { 18, 32, 13, -2, 32, 144, 12717 }, // Î
+    { 18, 31, 13, -2, 31, 140, 12861 }, // Ï
+    { 26, 25, 24, -2, 24, 163, 3204 }, // Ð
+    { 29, 33, 26, -1, 32, 240, 13001 }, // Ñ
+    { 24, 34, 24, 0, 33, 204, 13241 }, // Ò
+    { 24, 34, 24, 0, 33, 204, 13445 }, // Ó
+    { 24, 33, 24, 0, 32, 198, 13649 }, // Ô
+    { 24, 33, 24, 0, 32, 198, 3367 }, // Õ
+    { 24, 32, 24, 0, 31, 192, 13847 }, // Ö
+    { 15, 15, 21, 3, 19, 57, 3565 }, // ×
+    { 27, 25, 24, -1, 24, 169, 3622 }, // Ø
+    { 26, 34, 26, 2, 33, 221, 14039 }, // Ù
+    { 26, 34, 26, 2, 33, 221, 14260 }, // Ú
+    { 26, 33, 26, 2, 32, 215, 14481 }, // Û
+    { 26, 32, 26, 2, 31, 208, 14696 }, // Ü
+    { 23, 33, 22, 1, 33, 190, 3791 }, // Ý
+    { 22, 23, 20, -2, 23, 127, 3981 }, // Þ
+    { 27, 34, 21, -6, 26, 230, 4108 }, // ß
+    { 20, 29, 20, 0, 28, 145, 14904 }, // à
+    { 20, 30, 20, 0, 29, 150, 15049 }, // á
+    { 20, 29, 20, 0, 28, 145, 15199 }, // â
+    { 20, 27, 20, 0, 26, 135, 4338 }, // ã
+    { 20, 27, 20, 0, 26, 135, 15344 }, // ä
+    { 20, 29, 20, 0, 28, 145, 4473 }, // å
+    { 26, 19, 26, 0, 18, 124, 4618 }, // æ
+    { 15, 27, 15, 0, 18, 102, 15479 }, // ç
+    { 15, 29, 16, 0, 28, 109, 15581 }, // è
+    { 17, 30, 16, 0, 29, 128, 15690 }, // é
+    { 16, 29, 16, 0, 28, 116, 15818 }, // ê
+    { 17, 27, 16, 0, 26, 115, 15934 }, // ë
+    { 9, 29, 11, 1, 28, 66, 16049 }, // ì
+    { 13, 30, 11, 1, 29, 98, 16115 }, // í
+    { 12, 29, 11, 1, 28, 87, 16213 }, // î
+    { 13, 27, 11, 1, 26, 88, 16300 }, // ï
+    { 18, 28, 18, 0, 27, 126, 4742 }, // ð
+    { 19, 27, 20, 1, 26, 129, 16388 }, // ñ
+    { 17, 29, 18, 0, 28, 124, 16517 }, // ò
+    { 18, 30, 18, 0, 29, 135, 16641 }, // ó
+    { 18, 29, 18, 0, 28, 131, 16776 }, // ô
+    { 18, 27, 18, 0, 26, 122, 4868 }, // õ
+    { 18, 27, 18, 0, 26, 122, 16907 }, // ö
+    { 15, 16, 21, 3, 19, 60, 4990 }, // ÷
+    { 22, 19, 18, -2, 18, 105, 5050 }, // ø
+    { 20, 29, 20, 0, 28, 145, 17029 }, // ù
+    { 20, 30, 20, 0, 29, 150, 17174 }, // ú
+    { 20, 29, 20, 0, 28, 145, 17324 }, // û
+    { 20, 27, 20, 0, 26, 135, 17469 }, // ü
+    { 22, 37, 17, -5, 29, 204, 5155 }, // ý
+    { 22, 34, 18, -4, 26, 187, 5359 }, // þ
+    { 22, 34, 17, -5, 26, 187, 5546 }, // ÿ
+    { 26, 30, 24, -2, 30, 195, 5733 }, // Ā
+    { 20, 25, 20, 0, 24, 125, 5928 }, // ā
+    { 26, 32, 24, -2, 32, 208, 6053 }, // Ă
+    { 20, 27, 20, 0, 26, 135, 6261 }, // ă
+    { 26, 31, 24, -2, 24, 202, 6396 }, // Ą
+    { 20, 25, 20, 0, 18, 125, 6598 }, // ą
+    { 21, 34, 22, 1, 33, 179, 6723 }, // Ć
+    { 17, 30, 15, 0, 29, 128, 6902 }, // ć
+    { 21, 33, 22, 1, 32, 174, 7030 }, // Ĉ
+    { 16, 29, 15, 0, 28, 116, 7204 }, // ĉ
+    { 21, 33, 22, 1, 32, 174, 7320 }, // Ċ
+    { 15, 27, 15, 0, 26, 102, 7494 }, // ċ
+    { 21, 33, 22, 1, 32, 174, 7596 }, // Č
+    { 18, 29, 15, 0, 28, 131, 7770 }, // č
+    { 26, 33, 24, -2, 32, 215, 7901 }, // Ď
+    { 25, 27, 20, 0, 26, 169, 8116 }, // ď
+    { 26, 25, 24, -2, 24, 163, 8285 }, // Đ
+    { 22, 27, 20, 0, 26, 149, 8448 }, // đ
+    { 23, 30, 21, -2, 30, 173, 8597 }, // Ē
+    { 17, 25, 16, 0, 24, 107, 8770 }, // ē
+    { 23, 32, 21, -2, 32, 184, 8877 }, // Ĕ
+    { 17, 27, 16, 0, 26, 115, 9061 }, // ĕ
+    { 23, 32, 21, -2, 32, 184, 9176 }, // Ė
+    { 15, 27, 16, 0, 26, 102, 9360 }, // ė
+    { 23, 30, 21, -2, 23, 173, 9462 }, // Ę
+    { 15, 25, 16, 0, 18, 94, 9635 }, // ę
+    { 23, 32, 21, -2, 32, 184, 9729 }, // Ě
+    { 18, 29, 16, 0, 28, 131, 9913 }, // ě
+    { 22, 33, 24, 1, 32, 182, 10044 }, // Ĝ
+    { 23, 36, 17, -3, 28, 207, 10226 }, // ĝ
+    { 22, 33, 24, 1, 32, 182, 10433 }, // Ğ
+    { 23, 34, 17, -3, 26, 196, 10615 }, // ğ
+    { 22, 33, 24, 1, 32, 182, 10811 }, // Ġ
+    { 23, 34, 17, -3, 26, 196, 10993 }, // ġ
+    { 22, 33, 24, 1, 24, 182, 11189 }, // Ģ
+    { 23, 37, 17, -3, 29, 213, 11371 }, // ģ
+    { 30, 32, 26, -2, 32, 240, 11584 }, // Ĥ
+    { 19, 35, 20, 0, 34, 167, 11824 }, // ĥ
+    { 30, 23, 26, -2, 23, 173, 11991 }, // Ħ
+    { 19, 27, 20, 0, 26, 129, 12164 }, // ħ
+    { 18, 32, 13, -2, 32, 144, 12293 }, // Ĩ
+    { 13, 27, 11, 1, 26, 88, 12437 }, // ĩ
+    { 18, 30, 13, -2, 30, 135, 12525 }, // Ī
+    { 13, 25, 11, 1, 24, 82, 12660 }, // ī
+    { 17, 32, 13, -2, 32, 136, 12742 }, // Ĭ
+    { 13, 27, 11, 1, 26, 88, 12878 }, // ĭ
+    { 17, 30, 13, -2, 23, 128, 12966 }, // Į
+    { 10, 33, 11, 1, 26, 83, 13094 }, // į
+    { 17, 32, 13, -2, 32, 136, 13177 }, // İ
+    { 9, 19, 11, 1, 18, 43, 13313 }, // ı
+    { 30, 30, 26, -2, 23, 225, 13356 }, // Ĳ
+    { 22, 34, 21, 1, 26, 187, 13581 }, // ĳ
+    { 22, 39, 13, -6, 32, 215, 13768 }, // Ĵ
+    { 21, 36, 10, -7, 28, 189, 13983 }, // ĵ
+    { 27, 32, 24, -2, 23, 216, 14172 }, // Ķ
+    { 17, 35, 18, 0, 26, 149, 14388 }, // ķ
+    { 18, 19, 19, 1, 18, 86, 14537 }, // ĸ
+    { 20, 33, 19, -2, 33, 165, 14623 }, // Ĺ
+    { 12, 35, 11, 1, 34, 105, 14788 }, // ĺ
+    { 20, 32, 19, -2, 23, 160, 14893 }, // Ļ
+    { 12, 35, 11, -1, 26, 105, 15053 }, // ļ
+    { 22, 26, 19, -2, 26, 143, 15158 }, // Ľ
+    { 15, 27, 12, 1, 26, 102, 15301 }, // ľ
+    { 21, 23, 19, -2, 23, 121, 15403 }, // Ŀ
+    { 14, 27, 14, 1, 26, 95, 15524 }, // ŀ
+    { 20, 23, 19, -2, 23, 115, 15619 }, // Ł
+    { 13, 27, 10, -1, 26, 88, 15734 }, // ł
+    { 29, 34, 26, -1, 33, 247, 15822 }, // Ń
+    { 19, 30, 20, 1, 29, 143, 16069 }, // ń
+    { 29, 32, 26, -1, 23, 232, 16212 }, // Ņ
+    { 19, 27, 20, 1, 18, 129, 16444 }, // ņ
+    { 29, 33, 26, -1, 32, 240, 16573 }, // Ň
+    { 19, 29, 20, 1, 28, 138, 16813 }, // ň
+    { 25, 26, 27, 2, 25, 163, 16951 }, // ŉ
+    { 29, 30, 26, -1, 23, 218, 17114 }, // Ŋ
+    { 18, 26, 19, 1, 18, 117, 17332 }, // ŋ
+    { 24, 31, 24, 0, 30, 186, 17449 }, // Ō
+    { 18, 25, 18, 0, 24, 113, 17635 }, // ō
+    { 24, 33, 24, 0, 32, 198, 17748 }, // Ŏ
+    { 18, 27, 18, 0, 26, 122, 17946 }, // ŏ
+    { 25, 34, 24, 0, 33, 213, 18068 }, // Ő
+    { 20, 29, 18, 0, 28, 145, 18281 }, // ő
+    { 33, 25, 33, 0, 24, 207, 17604 }, // Œ
+    { 27, 19, 27, 0, 18, 129, 17811 }, // œ
+    { 24, 34, 22, -2, 33, 204, 18426 }, // Ŕ
+    { 16, 29, 16, 1, 29, 116, 18630 }, // ŕ
+    { 24, 33, 22, -2, 24, 198, 18746 }, // Ŗ
+    { 18, 27, 16, -1, 18, 122, 18944 }, // ŗ
+    { 24, 33, 22, -2, 32, 198, 19066 }, // Ř
+    { 17, 28, 16, 1, 28, 119, 19264 }, // ř
+    { 19, 34, 18, -1, 33, 162, 19383 }, // Ś
+    { 17, 30, 14, -1, 29, 128, 19545 }, // ś
+    { 19, 33, 18, -1, 32, 157, 19673 }, // Ŝ
+    { 16, 29, 14, -1, 28, 116, 19830 }, // ŝ
+    { 19, 33, 18, -1, 24, 157, 19946 }, // Ş
+    { 15, 27, 14, -1, 18, 102, 20103 }, // ş
+    { 20, 33, 18, -1, 32, 165, 20205 }, // Š
+    { 18, 29, 14, -1, 28, 131, 20370 }, // š
+    { 22, 32, 22, 2, 23, 176, 20501 }, // Ţ
+    { 15, 31, 14, 0, 22, 117, 20677 }, // ţ
+    { 22, 32, 22, 2, 32, 176, 20794 }, // Ť
+    { 17, 28, 14, 0, 27, 119, 20970 }, // ť
+    { 22, 23, 22, 2, 23, 127, 21089 }, // Ŧ
+    { 15, 23, 14, 0, 22, 87, 21216 }, // ŧ
+    { 26, 33, 26, 2, 32, 215, 21303 }, // Ũ
+    { 20, 27, 20, 0, 26, 135, 21518 }, // ũ
+    { 26, 31, 26, 2, 30, 202, 21653 }, // Ū
+    { 20, 25, 20, 0, 24, 125, 21855 }, // ū
+    { 26, 33, 26, 2, 32, 215, 21980 }, // Ŭ
+    { 20, 27, 20, 0, 26, 135, 22195 }, // ŭ
+    { 26, 34, 26, 2, 33, 221, 22330 }, // Ů
+    { 20, 29, 20, 0, 28, 145, 22551 }, // ů
+    { 26, 34, 26, 2, 33, 221, 22696 }, // Ű
+    { 20, 29, 20, 0, 28, 145, 22917 }, // ű
+    { 26, 30, 26, 2, 23, 195, 23062 }, // Ų
+    { 20, 25, 20, 0, 18, 125, 23257 }, // ų
+    { 33, 33, 33, 2, 32, 273, 23382 }, // Ŵ
+    { 25, 29, 25, 0, 28, 182, 23655 }, // ŵ
+    { 23, 32, 22, 1, 32, 184, 23837 }, // Ŷ
+    { 22, 36, 17, -5, 28, 198, 24021 }, // ŷ
+    { 23, 31, 22, 1, 31, 179, 24219 }, // Ÿ
+    { 21, 34, 20, -1, 33, 179, 24398 }, // Ź
+    { 17, 30, 16, -1, 29, 128, 24577 }, // ź
+    { 21, 33, 20, -1, 32, 174, 24705 }, // Ż
+    { 17, 27, 16, -1, 26, 115, 24879 }, // ż
+    { 21, 33, 20, -1, 32, 174, 24994 }, // Ž
+    { 17, 29, 16, -1, 28, 124, 25168 }, // ž
+    { 24, 34, 14, -6, 26, 204, 25292 }, // ſ
+    { 7, 9, 0, -5, 28, 16, 25496 }, // ̀
+    { 7, 10, 0, -2, 29, 18, 25512 }, // ́
+    { 12, 9, 0, -7, 28, 27, 25530 }, // ̂
+    { 12, 6, 0, -6, 26, 18, 25557 }, // ̃
+    { 12, 4, 0, -6, 24, 12, 25575 }, // ̄
+    { 12, 6, 0, -6, 26, 18, 25587 }, // ̆
+    { 6, 6, 0, -3, 26, 9, 25605 }, // ̇
+    { 12, 6, 0, -6, 26, 18, 25614 }, // ̈
+    { 9, 10, 0, -4, 29, 23, 25632 }, // ̉
+    { 10, 9, 0, -5, 28, 23, 25655 }, // ̊
+    { 13, 9, 0, -6, 28, 30, 25678 }, // ̋
+    { 12, 8, 0, -5, 28, 24, 25708 }, // ̌
+    { 11, 9, 0, -7, 28, 25, 25732 }, // ̏
+    { 11, 7, 0, -6, 26, 20, 25757 }, // ̑
+    { 7, 10, 0, -3, 29, 18, 25777 }, // ̒
+    { 7, 9, 0, -3, 29, 16, 25795 }, // ̓
+    { 6, 9, 0, -4, 29, 14, 25811 }, // ̔
+    { 6, 9, 0, -3, 29, 14, 25825 }, // ̕
+    { 6, 8, 0, -3, 21, 12, 25839 }, // ̛
+    { 6, 6, 0, -3, -2, 9, 25851 }, // ̣
+    { 12, 5, 0, -6, -3, 15, 25860 }, // ̤
+    { 8, 8, 0, -4, -1, 16, 25875 }, // ̥
+    { 7, 8, 0, -4, -1, 14, 25891 }, // ̦
+    { 8, 8, 0, -4, -1, 16, 25905 }, // ̧
+    { 8, 8, 0, -4, 1, 16, 25921 }, // ̨
+    { 6, 9, 9, -1, -1, 14, 25937 }, // ̩
+    { 13, 8, 0, -7, -1, 26, 25951 }, // ̭
+    { 12, 6, 0, -6, -2, 18, 25977 }, // ̮
+    { 12, 7, 0, -6, -2, 21, 25995 }, // ̰
+    { 12, 4, 0, -6, -3, 12, 26016 }, // ̱
+    { 12, 7, 0, -6, 26, 21, 26028 }, // ͂
+    { 13, 14, 0, -7, 34, 46, 26049 }, // ̈́
+    { 6, 7, 0, -2, -2, 11, 26095 }, // ͅ
+    { 23, 33, 21, -2, 33, 190, 26106 }, // Ѐ
+    { 23, 31, 21, -2, 31, 179, 0 }, // Ё
+    { 22, 30, 25, 2, 23, 165, 26296 }, // Ђ
+    { 23, 33, 19, -2, 33, 190, 26461 }, // Ѓ
+    { 22, 25, 21, 0, 24, 138, 26651 }, // Є
+    { 19, 25, 18, -1, 24, 119, 26789 }, // Ѕ
+    { 17, 23, 13, -2, 23, 98, 26908 }, // І
+    { 18, 31, 13, -2, 31, 140, 27006 }, // Ї
+    { 21, 30, 13, -6, 23, 158, 27146 }, // Ј
+    { 32, 24, 31, -2, 23, 192, 27304 }, // Љ
+    { 33, 24, 32, -2, 23, 198, 27496 }, // Њ
+    { 24, 23, 28, 2, 23, 138, 27694 }, // Ћ
+    { 27, 34, 23, -2, 33, 230, 27832 }, // Ќ
+    { 30, 33, 27, -2, 33, 248, 28062 }, // Ѝ
+    { 24, 34, 22, 1, 33, 204, 28310 }, // Ў
+    { 29, 31, 25, -2, 23, 225, 28514 }, // Џ
+    { 26, 24, 24, -2, 24, 156, 179 }, // А
+    { 22, 24, 21, -2, 23, 132, 335 }, // Б
+    { 22, 25, 21, -2, 24, 138, 467 }, // В
+    { 23, 23, 19, -2, 23, 133, 605 }, // Г
+    { 28, 30, 25, -2, 23, 210, 738 }, // Д
+    { 23, 23, 21, -2, 23, 133, 948 }, // Е
+    { 37, 25, 32, -3, 24, 232, 1081 }, // Ж
+    { 19, 25, 19, -1, 24, 119, 1313 }, // З
+    { 30, 23, 27, -2, 23, 173, 1432 }, // И
+    { 30, 33, 27, -2, 33, 248, 1605 }, // Й
+    { 27, 25, 23, -2, 24, 169, 1853 }, // К
+    { 28, 24, 24, -2, 23, 168, 2022 }, // Л
+    { 33, 23, 30, -3, 23, 190, 2190 }, // М
+    { 30, 23, 26, -2, 23, 173, 2380 }, // Н
+    { 24, 25, 24, 0, 24, 150, 2553 }, // О
+    { 29, 23, 26, -2, 23, 167, 2703 }, // П
+    { 23, 24, 20, -2, 24, 138, 2870 }, // Р
+    { 21, 25, 22, 1, 24, 132, 3008 }, // С
+    { 22, 23, 22, 2, 23, 127, 3140 }, // Т
+    { 24, 24, 22, 1, 23, 144, 3267 }, // У
+    { 24, 25, 25, 0, 24, 150, 3411 }, // Ф
+    { 27, 23, 22, -3, 23, 156, 3561 }, // Х
+    { 29, 30, 26, -2, 23, 218, 3717 }, // Ц
+    { 23, 23, 24, 2, 23, 133, 3935 }, // Ч
+    { 37, 23, 33, -2, 23, 213, 4068 }, // Ш
+    { 37, 30, 34, -2, 23, 278, 4281 }, // Щ
+    { 21, 24, 24, 2, 23, 126, 4559 }, // Ъ
+    { 35, 24, 31, -2, 23, 210, 4685 }, // Ы
+    { 21, 24, 20, -2, 23, 126, 4895 }, // Ь
+    { 21, 25, 21, -1, 24, 132, 5021 }, // Э
+    { 36, 25, 34, -2, 24, 225, 5153 }, // Ю
+    { 26, 24, 22, -2, 23, 156, 5378 }, // Я
+    { 20, 19, 20, 0, 18, 95, 5534 }, // а
+    { 19, 28, 18, 1, 27, 133, 5629 }, // б
+    { 17, 19, 17, 0, 18, 81, 5762 }, // в
+    { 15, 19, 15, 0, 18, 72, 5843 }, // г
+    { 18, 27, 18, 0, 26, 122, 5915 }, // д
+    { 15, 19, 16, 0, 18, 72, 6037 }, // е
+    { 30, 19, 30, 0, 18, 143, 6109 }, // ж
+    { 16, 19, 15, -1, 18, 76, 6252 }, // з
+    { 20, 19, 20, 0, 18, 95, 6328 }, // и
+    { 20, 28, 20, 0, 27, 140, 6423 }, // й
+    { 18, 19, 19, 1, 18, 86, 6563 }, // к
+    { 21, 19, 21, -1, 18, 100, 6649 }, // л
+    { 27, 19, 26, -1, 18, 129, 6749 }, // м
+    { 19, 19, 21, 1, 18, 91, 6878 }, // н
+    { 17, 19, 18, 0, 18, 81, 6969 }, // о
+    { 19, 19, 20, 1, 18, 91, 7050 }, // п
+    { 21, 26, 19, -3, 18, 137, 7141 }, // р
+    { 15, 19, 15, 0, 18, 72, 7278 }, // с
+    { 27, 19, 29, 1, 18, 129, 7350 }, // т
+    { 22, 26, 17, -5, 18, 143, 7479 }, // у
+    { 23, 34, 24, 0, 26, 196, 7622 }, // ф
+    { 21, 19, 19, -1, 18, 100, 7818 }, // х
+    { 20, 25, 21, 0, 18, 125, 7918 }, // ц
+    { 18, 19, 20, 1, 18, 86, 8043 }, // ч
+    { 27, 19, 28, 0, 18, 129, 8129 }, // ш
+    { 28, 25, 28, 0, 18, 175, 8258 }, // щ
+    { 18, 19, 18, 0, 18, 86, 8433 }, // ъ
+    { 26, 19, 26, 0, 18, 124, 8519 }, // ы
+    { 16, 19, 17, 0, 18, 76, 8643 }, // ь
+    { 16, 19, 16, -1, 18, 76, 8719 }, // э
+    { 25, 19, 26, 1, 18, 119, 8795 }, // ю
+    { 19, 19, 20, 0, 18, 91, 8914 }, // я
+    { 15, 29, 16, 0, 28, 109, 28739 }, // ѐ
+    { 17, 27, 16, 0, 26, 115, 9005 }, // ё
+    { 18, 34, 19, 0, 26, 153, 28848 }, // ђ
+    { 16, 30, 15, 0, 29, 120, 29001 }, // ѓ
+    { 16, 19, 16, 0, 18, 76, 29121 }, // є
+    { 15, 19, 14, -1, 18, 72, 29197 }, // ѕ
+    { 10, 27, 11, 1, 26, 68, 29269 }, // і
+    { 13, 27, 11, 1, 26, 88, 29337 }, // ї
+    { 19, 34, 10, -7, 26, 162, 29425 }, // ј
+    { 27, 19, 26, -1, 18, 129, 29587 }, // љ
+    { 24, 19, 26, 1, 18, 114, 29716 }, // њ
+    { 19, 27, 20, 0, 26, 129, 29830 }, // ћ
+    { 18, 30, 19, 1, 29, 135, 29959 }, // ќ
+    { 20, 29, 20, 0, 28, 145, 30094 }, // ѝ
+    { 22, 35, 17, -5, 27, 193, 30239 }, // ў
+    { 20, 25, 20, 0, 18, 125, 30432 }, // џ
+    { 21, 27, 23, 2, 26, 142, 30557 }, // Ѣ
+    { 24, 19, 26, 1, 18, 114, 30699 }, // ѣ
+    { 24, 25, 24, 0, 24, 150, 30813 }, // Ѳ
+    { 17, 19, 18, 0, 18, 81, 30963 }, // ѳ
+    { 25, 25, 25, 2, 24, 157, 31044 }, // Ѵ
+    { 21, 19, 19, -1, 18, 100, 31201 }, // ѵ
+    { 30, 40, 27, -2, 33, 300, 31301 }, // Ҋ
+    { 20, 34, 20, 0, 27, 170, 31601 }, // ҋ
+    { 21, 24, 20, -2, 23, 126, 31771 }, // Ҍ
+    { 15, 25, 17, 1, 24, 94, 31897 }, // ҍ
+    { 23, 24, 20, -2, 24, 138, 31991 }, // Ҏ
+    { 21, 26, 19, -3, 18, 137, 32129 }, // ҏ
+    { 23, 28, 19, -2, 28, 161, 32266 }, // Ґ
+    { 17, 23, 16, 0, 22, 98, 32427 }, // ґ
+    { 23, 23, 19, -2, 23, 133, 32525 }, // Ғ
+    { 15, 19, 15, 0, 18, 72, 32658 }, // ғ
+    { 22, 30, 22, -2, 23, 165, 32730 }, // Ҕ
+    { 16, 26, 18, 1, 18, 104, 0 }, // ҕ
+    { 37, 31, 32, -3, 24, 287, 104 }, // Җ
+    { 30, 25, 30, 0, 18, 188, 391 }, // җ
+    { 19, 31, 19, -1, 24, 148, 579 }, // Ҙ
+    { 16, 25, 15, -1, 18, 100, 727 }, // ҙ
+    { 27, 31, 23, -2, 24, 210, 827 }, // Қ
+    { 18, 25, 19, 1, 18, 113, 1037 }, // қ
+    { 28, 25, 24, -2, 24, 175, 1150 }, // Ҝ
+    { 20, 19, 21, 1, 18, 95, 1325 }, // ҝ
+    { 27, 25, 23, -2, 24, 169, 1420 }, // Ҟ
+    { 18, 25, 18, 0, 24, 113, 1589 }, // ҟ
+    { 27, 25, 27, 2, 24, 169, 1702 }, // Ҡ
+    { 21, 19, 22, 0, 18, 100, 1871 }, // ҡ
+    { 30, 30, 27, -2, 23, 225, 1971 }, // Ң
+    { 20, 25, 21, 1, 18, 125, 2196 }, // ң
+    { 35, 23, 31, -2, 23, 202, 2321 }, // Ҥ
+    { 25, 19, 25, 1, 18, 119, 2523 }, // ҥ
+    { 34, 30, 34, -2, 23, 255, 2642 }, // Ҧ
+    { 26, 26, 28, 1, 18, 169, 2897 }, // ҧ
+    { 26, 25, 27, 1, 24, 163, 3066 }, // Ҩ
+    { 21, 19, 21, 0, 18, 100, 3229 }, // ҩ
+    { 21, 31, 22, 1, 24, 163, 3329 }, // Ҫ
+    { 15, 25, 15, 0, 18, 94, 3492 }, // ҫ
+    { 22, 30, 22, 2, 23, 165, 3586 }, // Ҭ
+    { 28, 25, 29, 1, 18, 175, 3751 }, // ҭ
+    { 23, 23, 22, 1, 23, 133, 3926 }, // Ү
+    { 17, 26, 17, 0, 18, 111, 4059 }, // ү
+    { 23, 23, 22, 1, 23, 133, 4170 }, // Ұ
+    { 17, 26, 17, 0, 18, 111, 4303 }, // ұ
+    { 27, 30, 22, -3, 23, 203, 4414 }, // Ҳ
+    { 21, 25, 19, -1, 18, 132, 4617 }, // ҳ
+    { 30, 30, 30, 2, 23, 225, 4749 }, // Ҵ
+    { 20, 31, 21, 0, 24, 155, 4974 }, // ҵ
+    { 23, 30, 24, 2, 23, 173, 5129 }, // Ҷ
+    { 19, 25, 20, 1, 18, 119, 5302 }, // ҷ
+    { 24, 23, 24, 2, 23, 138, 5421 }, // Ҹ
+    { 19, 19, 20, 1, 18, 91, 5559 }, // ҹ
+    { 24, 23, 24, -2, 23, 138, 5650 }, // Һ
+    { 19, 27, 20, 0, 26, 129, 5788 }, // һ
+    { 26, 25, 27, 1, 24, 163, 5917 }, // Ҽ
+    { 19, 19, 20, 0, 18, 91, 6080 }, // ҽ
+    { 26, 32, 27, 1, 24, 208, 6171 }, // Ҿ
+    { 19, 25, 20, 0, 18, 119, 6379 }, // ҿ
+    { 17, 23, 13, -2, 23, 98, 6498 }, // Ӏ
+    { 37, 34, 32, -3, 33, 315, 6596 }, // Ӂ
+    { 30, 28, 30, 0, 27, 210, 6911 }, // ӂ
+    { 27, 31, 24, -2, 24, 210, 7121 }, // Ӄ
+    { 18, 26, 19, 1, 18, 117, 7331 }, // ӄ
+    { 28, 30, 24, -2, 23, 210, 7448 }, // Ӆ
+    { 22, 25, 21, -1, 18, 138, 7658 }, // ӆ
+    { 30, 30, 26, -2, 23, 225, 7796 }, // Ӈ
+    { 18, 26, 19, 1, 18, 117, 8021 }, // ӈ
+    { 30, 30, 27, -2, 23, 225, 8138 }, // Ӊ
+    { 20, 25, 21, 1, 18, 125, 8363 }, // ӊ
+    { 23, 30, 24, 2, 23, 173, 8488 }, // Ӌ
+    { 18, 25, 19, 1, 18, 113, 8661 }, // ӌ
+    { 33, 30, 30, -3, 23, 248, 8774 }, // Ӎ
+    { 27, 25, 26, -1, 18, 169, 9022 }, // ӎ
+    { 17, 26, 13, -2, 26, 111, 9191 }, // ӏ
+    { 26, 33, 24, -2, 33, 215, 9302 }, // Ӑ
+    { 20, 28, 20, 0, 27, 140, 9517 }, // ӑ
+    { 26, 31, 24, -2, 31, 202, 9657 }, // Ӓ
+    { 20, 27, 20, 0, 26, 135, 9859 }, // ӓ
+    { 34, 23, 31, -3, 23, 196, 9994 }, // Ӕ
+    { 26, 19, 26, 0, 18, 124, 10190 }, // ӕ
+    { 23, 33, 21, -2, 33, 190, 10314 }, // Ӗ
+    { 17, 28, 16, 0, 27, 119, 10504 }, // ӗ
+    { 21, 25, 22, 0, 24, 132, 10623 }, // Ә
+    { 16, 19, 16, 0, 18, 76, 10755 }, // ә
+    { 21, 32, 22, 0, 31, 168, 10831 }, // Ӛ
+    { 16, 27, 16, 0, 26, 108, 10999 }, // ӛ
+    { 37, 32, 32, -3, 31, 296, 11107 }, // Ӝ
+    { 30, 27, 30, 0, 26, 203, 11403 }, // ӝ
+    { 19, 32, 19, -1, 31, 152, 11606 }, // Ӟ
+    { 17, 27, 15, -1, 26, 115, 11758 }, // ӟ
+    { 21, 24, 19, -1, 23, 126, 11873 }, // Ӡ
+    { 20, 26, 18, -2, 18, 130, 11999 }, // ӡ
+    { 30, 30, 27, -2, 30, 225, 12129 }, // Ӣ
+    { 20, 25, 20, 0, 24, 125, 12354 }, // ӣ
+    { 30, 31, 27, -2, 31, 233, 12479 }, // Ӥ
+    { 20, 27, 20, 0, 26, 135, 12712 }, // ӥ
+    { 24, 32, 24, 0, 31, 192, 12847 }, // Ӧ
+    { 18, 27, 18, 0, 26, 122, 13039 }, // ӧ
+    { 24, 25, 24, 0, 24, 150, 13161 }, // Ө
+    { 17, 19, 18, 0, 18, 81, 13311 }, // ө
+    { 24, 32, 24, 0, 31, 192, 13392 }, // Ӫ
+    { 18, 27, 18, 0, 26, 122, 13584 }, // ӫ
+    { 21, 32, 21, -1, 31, 168, 13706 }, // Ӭ
+    { 16, 27, 16, -1, 26, 108, 13874 }, // ӭ
+    { 24, 31, 22, 1, 30, 186, 13982 }, // Ӯ
+    { 22, 32, 17, -5, 24, 176, 14168 }, // ӯ
+    { 24, 32, 22, 1, 31, 192, 14344 }, // Ӱ
+    { 22, 34, 17, -5, 26, 187, 14536 }, // ӱ
+    { 24, 34, 22, 1, 33, 204, 14723 }, // Ӳ
+    { 22, 36, 17, -5, 28, 198, 14927 }, // ӳ
+    { 23, 31, 24, 2, 31, 179, 15125 }, // Ӵ
+    { 18, 27, 20, 1, 26, 122, 15304 }, // ӵ
+    { 23, 30, 19, -2, 23, 173, 15426 }, // Ӷ
+    { 15, 25, 15, 0, 18, 94, 15599 }, // ӷ
+    { 35, 32, 31, -2, 31, 280, 15693 }, // Ӹ
+    { 26, 27, 26, 0, 26, 176, 15973 }, // ӹ
+    { 23, 30, 19, -2, 23, 173, 16149 }, // Ӻ
+    { 15, 25, 15, 0, 18, 94, 16322 }, // ӻ
+    { 27, 30, 22, -3, 23, 203, 16416 }, // Ӽ
+    { 21, 26, 19, -1, 18, 137, 16619 }, // ӽ
+    { 27, 23, 22, -3, 23, 156, 16756 }, // Ӿ
+    { 21, 19, 19, -1, 18, 100, 16912 }, // ӿ
+    { 0, 0, 17, 0, 0, 0, 17012 }, //  
+    { 0, 0, 33, 0, 0, 0, 17012 }, //  
+    { 0, 0, 17, 0, 0, 0, 17012 }, //  
+    { 0, 0, 33, 0, 0, 0, 17012 }, //  
+    { 0, 0, 11, 0, 0, 0, 17012 }, //  
+    { 0, 0, 8, 0, 0, 0, 17012 }, //  
+    { 0, 0, 5, 0, 0, 0, 17012 }, //  
+    { 0, 0, 21, 0, 0, 0, 17012 }, //  
+    { 0, 0, 10, 0, 0, 0, 17012 }, //  
+    { 0, 0, 7, 0, 0, 0, 17012 }, //  
+    { 0, 0, 2, 0, 0, 0, 17012 }, //  
+    { 0, 0, 0, 0, 0, 0, 17012 }, // ​
+    { 2, 28, 0, -1, 20, 14, 17012 }, // ‌
+    { 8, 30, 0, -4, 22, 60, 17026 }, // ‍
+    { 12, 31, 0, -6, 23, 93, 17086 }, // ‎
+    { 12, 31, 0, -6, 23, 93, 17179 }, // ‏
+    { 11, 5, 13, 1, 11, 14, 17272 }, // ‐
+    { 11, 5, 13, 1, 11, 14, 17286 }, // ‑
+    { 17, 4, 21, 2, 13, 17, 17300 }, // ‒
+    { 17, 5, 17, 0, 11, 22, 17940 }, // –
+    { 33, 5, 33, 0, 11, 42, 17962 }, // —
+    { 33, 5, 33, 0, 11, 42, 17317 }, // ―
+    { 12, 34, 17, 2, 26, 102, 17359 }, // ‖
+    { 17, 9, 17, 0, -1, 39, 17461 }, // ‗
+    { 8, 11, 10, 2, 25, 22, 18004 }, // ‘
+    { 8, 11, 10, 2, 25, 22, 18026 }, // ’
+    { 8, 11, 10, 0, 5, 22, 17500 }, // ‚
+    { 8, 12, 10, 1, 25, 24, 17522 }, // ‛
+    { 15, 11, 17, 2, 25, 42, 18048 }, // “
+    { 15, 12, 17, 2, 25, 45, 18090 }, // ”
+    { 14, 11, 17, 0, 5, 39, 17546 }, // „
+    { 15, 12, 17, 1, 25, 45, 17585 }, // ‟
+    { 15, 22, 15, 1, 24, 83, 17630 }, // †
+    { 17, 26, 15, -1, 24, 111, 17713 }, // ‡
+    { 8, 8, 10, 1, 13, 16, 17824 }, // •
+    { 12, 12, 21, 4, 17, 36, 17840 }, // ‣
+    { 7, 6, 10, 1, 5, 11, 17876 }, // ․
+    { 15, 6, 17, 1, 5, 23, 17887 }, // ‥
+    { 29, 6, 33, 2, 5, 44, 18135 }, // …
+    { 7, 6, 10, 1, 12, 11, 17910 }, // ‧
+    { 0, 0, 0, 0, 0, 0, 17921 }, //  
+    { 0, 0, 0, 0, 0, 0, 17921 }, //  
+    { 12, 31, 0, -6, 23, 93, 17921 }, // ‪
+    { 12, 31, 0, -6, 23, 93, 18014 }, // ‫
+    { 10, 31, 0, -5, 23, 78, 18107 }, // ‬
+    { 14, 31, 0, -7, 23, 109, 18185 }, // ‭
+    { 14, 31, 0, -7, 23, 109, 18294 }, // ‮
+    { 0, 0, 4, 0, 0, 0, 18403 }, //  
+    { 44, 28, 46, 1, 25, 308, 18403 }, // ‰
+    { 8, 11, 8, 0, 23, 22, 18711 }, // ′
+    { 15, 11, 15, 0, 23, 42, 18733 }, // ″
+    { 23, 11, 23, 0, 23, 64, 18775 }, // ‴
+    { 8, 11, 8, 0, 23, 22, 18839 }, // ‵
+    { 15, 11, 16, 0, 23, 42, 18861 }, // ‶
+    { 22, 11, 23, 0, 23, 61, 18903 }, // ‷
+    { 14, 7, 16, 1, 0, 25, 18964 }, // ‸
+    { 10, 13, 12, 1, 15, 33, 18989 }, // ‹
+    { 11, 13, 12, 0, 15, 36, 19022 }, // ›
+    { 21, 23, 21, 0, 22, 121, 19058 }, // ※
+    { 20, 26, 20, 1, 25, 130, 19179 }, // ‼
+    { 17, 4, 17, 0, 28, 17, 19309 }, // ‾
+    { 8, 5, 10, 1, 11, 10, 19326 }, // ⁃
+    { 21, 28, 9, -6, 25, 147, 19336 }, // ⁄
+    { 24, 25, 26, 2, 24, 150, 19483 }, // ⁇
+    { 22, 26, 23, 2, 25, 143, 19633 }, // ⁈
+    { 22, 26, 23, 1, 25, 143, 19776 }, // ⁉
+    { 20, 7, 33, 6, 13, 35, 19919 }, // ⁓
+    { 30, 11, 30, 0, 23, 83, 19954 }, // ⁗
+    { 0, 0, 7, 0, 0, 0, 20037 }, //  
+    { 0, 0, 0, 0, 0, 0, 20037 }, // ⁠
+    { 0, 0, 0, 0, 0, 0, 20037 }, // ⁡
+    { 0, 0, 0, 0, 0, 0, 20037 }, // ⁢
+    { 0, 0, 0, 0, 0, 0, 20037 }, // ⁣
+    { 0, 0, 0, 0, 0, 0, 20037 }, // ⁤
+    { 14, 17, 15, 0, 28, 60, 20037 }, // ⁰
+    { 14, 16, 15, 0, 28, 56, 20097 }, // ⁴
+    { 13, 16, 15, 1, 27, 52, 20153 }, // ⁵
+    { 14, 17, 15, 1, 28, 60, 20205 }, // ⁶
+    { 13, 16, 15, 2, 27, 52, 20265 }, // ⁷
+    { 13, 17, 15, 1, 28, 56, 20317 }, // ⁸
+    { 14, 17, 15, 0, 28, 60, 20373 }, // ⁹
+    { 13, 13, 19, 3, 24, 43, 20433 }, // ⁿ
+    { 14, 16, 15, 0, 11, 56, 20476 }, // ₀
+    { 11, 16, 15, 1, 11, 44, 20532 }, // ₁
+    { 14, 16, 15, 0, 11, 56, 20576 }, // ₂
+    { 12, 16, 15, 1, 11, 48, 20632 }, // ₃
+    { 14, 16, 15, 0, 11, 56, 20680 }, // ₄
+    { 13, 16, 15, 1, 11, 52, 20736 }, // ₅
+    { 14, 16, 15, 1, 11, 56, 20788 }, // ₆
+    { 13, 16, 15, 2, 11, 52, 20844 }, // ₇
+    { 13, 16, 15, 1, 11, 52, 20896 }, // ₈
+    { 14, 16, 15, 0, 11, 56, 20948 }, // ₉
+    { 22, 23, 21, -1, 23, 127, 21004 }, // ₣
+    { 22, 24, 21, -1, 23, 132, 21131 }, // ₤
+    { 43, 24, 44, 0, 23, 258, 21263 }, // ₧
+    { 23, 24, 21, -1, 23, 138, 21521 }, // €
+    { 21, 15, 33, 6, 19, 79, 21659 }, // ←
+    { 15, 21, 33, 9, 22, 79, 21738 }, // ↑
+    { 21, 15, 33, 6, 19, 79, 21817 }, // →
+    { 15, 21, 33, 9, 22, 79, 21896 }, // ↓
+    { 21, 15, 33, 6, 19, 79, 21975 }, // ↔
+    { 15, 23, 33, 9, 23, 87, 22054 }, // ↕
+    { 15, 23, 33, 9, 23, 87, 22141 }, // ↨
+    { 15, 23, 33, 9, 23, 87, 22228 }, // ↲
+    { 15, 23, 33, 9, 23, 87, 22315 }, // ↳
+    { 19, 18, 33, 7, 20, 86, 22402 }, // ↵
+    { 21, 19, 33, 6, 21, 100, 22488 }, // ⇐
+    { 19, 21, 33, 7, 22, 100, 22588 }, // ⇑
+    { 21, 19, 33, 6, 21, 100, 22688 }, // ⇒
+    { 19, 21, 33, 7, 22, 100, 22788 }, // ⇓
+    { 21, 17, 33, 6, 20, 90, 22888 }, // ⇔
+    { 23, 24, 33, 5, 23, 138, 22978 }, // ∀
+    { 18, 27, 21, 1, 26, 122, 23116 }, // ∂
+    { 17, 23, 33, 8, 23, 98, 23238 }, // ∃
+    { 25, 27, 33, 4, 25, 169, 23336 }, // ∅
+    { 22, 24, 23, 0, 24, 132, 23505 }, // ∆
+    { 21, 24, 33, 6, 23, 126, 23637 }, // ∇
+    { 23, 23, 33, 5, 23, 133, 23763 }, // ∈
+    { 23, 29, 33, 5, 26, 167, 23896 }, // ∉
+    { 23, 20, 33, 5, 21, 115, 24063 }, // ∊
+    { 23, 23, 33, 5, 23, 133, 24178 }, // ∋
+    { 23, 29, 33, 5, 26, 167, 24311 }, // ∌
+    { 23, 20, 33, 5, 21, 115, 24478 }, // ∍
+    { 26, 29, 28, 1, 23, 189, 24593 }, // ∏
+    { 21, 29, 22, 1, 23, 153, 24782 }, // ∑
+    { 15, 4, 21, 3, 13, 15, 24935 }, // −
+    { 21, 26, 17, -2, 24, 137, 24950 }, // ∕
+    { 16, 26, 17, 1, 24, 104, 25087 }, // ∖
+    { 16, 16, 21, 2, 19, 64, 25191 }, // ∗
+    { 13, 12, 21, 4, 17, 39, 25255 }, // ∘
+    { 7, 6, 21, 7, 12, 11, 25294 }, // ∙
+    { 22, 31, 21, -1, 27, 171, 25305 }, // √
+    { 17, 13, 21, 2, 17, 56, 25476 }, // ∝
+    { 21, 13, 21, 0, 17, 69, 25532 }, // ∞
+    { 21, 23, 33, 6, 23, 121, 25601 }, // ∟
+    { 25, 23, 33, 4, 23, 144, 25722 }, // ∠
+    { 5, 34, 17, 6, 26, 43, 25866 }, // ∣
+    { 12, 34, 17, 2, 26, 102, 25909 }, // ∥
+    { 23, 23, 33, 5, 23, 133, 26011 }, // ∧
+    { 23, 23, 33, 5, 23, 133, 26144 }, // ∨
+    { 19, 24, 33, 7, 24, 114, 26277 }, // ∩
+    { 19, 24, 33, 7, 23, 114, 26391 }, // ∪
+    { 19, 34, 21, 1, 26, 162, 26505 }, // ∫
+    { 23, 20, 33, 5, 19, 115, 26667 }, // ∴
+    { 23, 20, 33, 5, 19, 115, 26782 }, // ∵
+    { 8, 18, 10, 1, 20, 36, 26897 }, // ∶
+    { 23, 20, 33, 5, 19, 115, 26933 }, // ∷
+    { 20, 7, 33, 6, 13, 35, 27048 }, // ∼
+    { 20, 18, 33, 6, 20, 90, 27083 }, // ≅
+    { 17, 14, 21, 2, 18, 60, 27173 }, // ≈
+    { 19, 13, 33, 7, 16, 62, 27233 }, // ≍
+    { 15, 16, 21, 3, 19, 60, 27295 }, // ≠
+    { 19, 16, 33, 7, 18, 76, 27355 }, // ≡
+    { 15, 20, 21, 3, 20, 75, 27431 }, // ≤
+    { 15, 21, 21, 3, 21, 79, 27506 }, // ≥
+    { 27, 16, 33, 3, 19, 108, 27585 }, // ≪
+    { 27, 16, 33, 3, 19, 108, 27693 }, // ≫
+    { 23, 20, 33, 5, 21, 115, 27801 }, // ⊃
+    { 23, 29, 33, 5, 26, 167, 27916 }, // ⊄
+    { 23, 29, 33, 5, 26, 167, 28083 }, // ⊅
+    { 21, 23, 33, 6, 23, 121, 28250 }, // ⊆
+    { 21, 23, 33, 6, 23, 121, 28371 }, // ⊇
+    { 25, 25, 33, 4, 24, 157, 28492 }, // ⊕
+    { 25, 25, 33, 4, 24, 157, 28649 }, // ⊖
+    { 25, 25, 33, 4, 24, 157, 28806 }, // ⊗
+    { 25, 25, 33, 4, 24, 157, 28963 }, // ⊘
+    { 19, 23, 33, 7, 23, 110, 29120 }, // ⊥
+    { 7, 6, 21, 7, 12, 11, 29230 }, // ⋅
+    { 29, 6, 33, 2, 12, 44, 29241 }, // ⋯
+    { 35, 34, 24, -6, 26, 298, 29285 }, // ﬀ
+    { 27, 34, 21, -6, 26, 230, 29583 }, // ﬁ
+    { 28, 34, 22, -6, 26, 238, 29813 }, // ﬂ
+    { 38, 34, 32, -6, 26, 323, 30051 }, // ﬃ
+    { 39, 34, 33, -6, 26, 332, 30374 }, // ﬄ
+    { 31, 34, 25, -6, 26, 264, 30706 }, // ﬅ
+    { 29, 25, 27, -1, 24, 182, 30970 }, // ﬆ
+    { 31, 32, 33, 1, 28, 248, 31152 }, // �
 };
 
 static const EpdUnicodeInterval bookerly_16_bolditalicIntervals[] = {
@@ -3109,32 +3196,338 @@ static const EpdUnicodeInterval bookerly_16_bolditalicIntervals[] = {
     { 0x22A5, 0x22A5, 0x2E7 },
     { 0x22C5, 0x22C5, 0x2E8 },
     { 0x22EF, 0x22EF, 0x2E9 },
-    { 0xFFFD, 0xFFFD, 0x2EA },
+    { 0xFB00, 0xFB06, 0x2EA },
+    { 0xFFFD, 0xFFFD, 0x2F1 },
 };
 
 static const EpdFontGroup bookerly_16_bolditalicGroups[] = {
-    { 0, 5278, 10554, 100, 0 },
-    { 5278, 5181, 12783, 96, 100 },
-    { 10459, 7500, 20099, 128, 196 },
-    { 17959, 479, 610, 33, 324 },
-    { 18438, 11937, 32921, 220, 357 },
-    { 30375, 1602, 3264, 74, 577 },
-    { 31977, 630, 967, 18, 651 },
-    { 32607, 415, 655, 4, 669 },
-    { 33022, 709, 1319, 15, 673 },
-    { 33731, 2677, 6307, 58, 688 },
-    { 36408, 130, 248, 1, 746 },
+    { 0, 7316, 18179, 151, 5 },
+    { 7316, 4303, 9120, 66, 358 },
+    { 11619, 12737, 32895, 260, 0 },
+    { 24356, 13456, 31400, 277, 470 },
+};
+
+static const uint8_t bookerly_16_bolditalicGlyphGroups[754] = {
+    2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0,
+    2, 2, 2, 2, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0,
+    0, 2, 2, 2, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0,
+    0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 3, 3, 3, 0, 0, 3, 3, 0, 0, 3,
+    3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+};
+
+static const uint8_t bookerly_16_bolditalicKernLeftClasses[754] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 0, 126,
+    0, 1, 103, 1, 31, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 127,
+    127, 0, 0, 0, 0, 0, 4, 102, 114, 11, 64, 66, 56, 21, 21, 43,
+    58, 40, 115, 25, 11, 61, 52, 26, 67, 19, 5, 17, 17, 79, 12, 84,
+    82, 33, 0, 0, 0, 0, 30, 22, 94, 86, 63, 35, 18, 29, 86, 111,
+    129, 112, 29, 29, 22, 22, 100, 38, 80, 95, 30, 44, 44, 128, 44, 71,
+    62, 0, 0, 0, 0, 78, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 103, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 89,
+    0, 0, 0, 60, 4, 4, 4, 4, 4, 4, 64, 114, 64, 64, 64, 64,
+    21, 21, 21, 21, 11, 25, 11, 11, 11, 11, 11, 0, 11, 5, 5, 5,
+    5, 12, 73, 141, 30, 30, 30, 30, 30, 30, 63, 138, 63, 63, 63, 63,
+    86, 132, 28, 28, 22, 29, 22, 22, 22, 22, 22, 0, 99, 30, 30, 30,
+    30, 44, 22, 44, 4, 30, 4, 30, 48, 65, 114, 94, 114, 94, 114, 94,
+    114, 94, 11, 27, 11, 86, 64, 63, 64, 63, 64, 63, 107, 124, 64, 63,
+    56, 18, 56, 18, 56, 18, 56, 18, 21, 29, 97, 29, 21, 28, 21, 28,
+    21, 28, 76, 106, 21, 30, 43, 111, 43, 116, 58, 129, 137, 40, 112, 40,
+    136, 0, 27, 0, 0, 40, 120, 25, 29, 25, 29, 25, 29, 29, 25, 111,
+    11, 22, 11, 22, 11, 22, 64, 63, 26, 38, 26, 38, 26, 38, 67, 80,
+    67, 80, 67, 125, 67, 80, 19, 135, 19, 0, 19, 95, 5, 30, 5, 30,
+    5, 30, 5, 30, 5, 30, 5, 65, 17, 44, 12, 44, 12, 84, 71, 84,
+    71, 84, 71, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 96, 96, 88, 0, 142, 121, 2, 2, 49, 20, 20,
+    53, 7, 2, 3, 2, 14, 139, 39, 13, 24, 96, 7, 39, 2, 2, 7,
+    2, 92, 2, 10, 2, 32, 113, 13, 3, 69, 41, 24, 2, 2, 24, 20,
+    2, 20, 10, 10, 2, 15, 101, 85, 118, 74, 91, 109, 85, 15, 15, 68,
+    15, 15, 15, 16, 55, 16, 108, 55, 42, 74, 83, 9, 15, 15, 9, 104,
+    15, 34, 16, 16, 15, 91, 91, 105, 118, 108, 122, 140, 98, 119, 34, 34,
+    55, 68, 15, 42, 15, 110, 34, 10, 16, 47, 90, 24, 9, 20, 34, 32,
+    16, 45, 77, 37, 118, 0, 0, 87, 59, 39, 85, 72, 59, 7, 68, 7,
+    68, 7, 68, 24, 9, 0, 0, 0, 0, 81, 134, 113, 108, 13, 9, 23,
+    70, 23, 70, 46, 75, 24, 9, 24, 9, 2, 15, 57, 55, 130, 91, 130,
+    91, 2, 7, 109, 51, 133, 24, 9, 49, 119, 24, 9, 2, 0, 24, 9,
+    123, 14, 15, 14, 15, 96, 91, 96, 91, 10, 16, 10, 16, 7, 109, 39,
+    85, 131, 117, 2, 15, 2, 15, 10, 16, 10, 16, 10, 16, 10, 16, 3,
+    42, 3, 42, 3, 42, 2, 15, 13, 118, 2, 15, 37, 118, 50, 93, 41,
+    83, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 103, 103, 0, 103, 103, 103, 0, 0, 8, 6, 36, 8, 8, 6, 1,
+    0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 89, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 35, 86, 112, 86, 112, 95,
+    95, 0,
+};
+
+static const uint8_t bookerly_16_bolditalicKernRightClasses[754] = {
+    0, 0, 0, 0, 0, 0, 92, 97, 0, 0, 0, 0, 97, 0, 83, 36,
+    0, 23, 52, 2, 39, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 41,
+    40, 0, 0, 0, 70, 0, 4, 38, 6, 38, 5, 5, 6, 5, 5, 57,
+    5, 5, 93, 5, 6, 38, 6, 38, 92, 31, 10, 28, 28, 76, 22, 105,
+    0, 11, 95, 0, 0, 0, 1, 8, 1, 1, 1, 13, 16, 8, 62, 61,
+    8, 8, 18, 18, 1, 18, 1, 18, 26, 55, 25, 17, 17, 90, 65, 89,
+    0, 0, 91, 0, 0, 108, 0, 0, 0, 0, 0, 0, 0, 0, 0, 44,
+    0, 52, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 63,
+    0, 0, 0, 104, 4, 4, 4, 4, 4, 4, 49, 6, 5, 5, 5, 5,
+    5, 5, 5, 5, 38, 5, 6, 6, 6, 6, 6, 0, 6, 10, 10, 10,
+    10, 22, 5, 72, 1, 1, 1, 1, 53, 1, 1, 1, 1, 1, 1, 1,
+    94, 62, 42, 42, 1, 18, 1, 1, 1, 1, 1, 0, 69, 25, 25, 25,
+    25, 17, 66, 17, 4, 1, 4, 1, 4, 1, 6, 1, 6, 1, 6, 1,
+    6, 53, 38, 1, 38, 1, 5, 1, 5, 1, 5, 1, 5, 1, 5, 1,
+    6, 16, 6, 16, 6, 16, 6, 16, 5, 8, 5, 8, 5, 42, 5, 42,
+    5, 42, 5, 62, 5, 18, 5, 62, 57, 106, 5, 8, 18, 5, 8, 5,
+    8, 5, 8, 5, 8, 5, 60, 5, 18, 5, 18, 5, 18, 18, 5, 18,
+    6, 1, 6, 1, 6, 1, 6, 1, 38, 18, 38, 18, 38, 18, 92, 26,
+    92, 26, 92, 26, 92, 75, 31, 55, 31, 55, 31, 55, 10, 25, 10, 25,
+    10, 25, 10, 25, 10, 25, 10, 25, 28, 17, 22, 17, 22, 105, 89, 105,
+    89, 105, 99, 72, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 7, 7, 20, 7, 29, 107, 7, 7, 68, 37, 7,
+    20, 7, 7, 47, 7, 24, 7, 74, 7, 59, 7, 45, 98, 7, 7, 7,
+    37, 85, 7, 29, 7, 74, 29, 20, 47, 77, 33, 7, 27, 7, 7, 20,
+    7, 7, 101, 7, 71, 3, 87, 3, 78, 79, 3, 35, 34, 21, 21, 12,
+    19, 51, 12, 3, 12, 88, 3, 12, 9, 3, 81, 21, 15, 21, 21, 80,
+    21, 21, 34, 12, 73, 3, 3, 82, 78, 3, 84, 102, 96, 48, 19, 12,
+    58, 12, 21, 9, 21, 20, 12, 29, 3, 64, 46, 7, 12, 110, 100, 74,
+    12, 7, 86, 7, 78, 7, 12, 45, 35, 98, 34, 7, 12, 7, 12, 0,
+    0, 20, 0, 7, 12, 7, 12, 7, 12, 29, 3, 29, 3, 20, 12, 43,
+    9, 43, 9, 33, 81, 0, 0, 27, 15, 27, 15, 7, 58, 50, 32, 50,
+    32, 7, 45, 35, 7, 12, 37, 19, 7, 12, 7, 12, 27, 15, 0, 51,
+    103, 24, 3, 24, 3, 54, 3, 7, 3, 109, 67, 0, 67, 45, 35, 98,
+    34, 111, 56, 7, 21, 7, 21, 29, 3, 29, 3, 29, 3, 0, 34, 47,
+    9, 47, 9, 47, 9, 0, 15, 7, 78, 7, 21, 7, 78, 33, 81, 33,
+    81, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 52, 52, 0, 52, 52, 52, 0, 0, 14, 30, 2, 14, 14, 30, 2,
+    0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 44, 63, 0, 92, 0, 0, 0,
+    70, 70, 92, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 13, 13, 13, 13, 13,
+    26, 0,
+};
+
+static const int8_t bookerly_16_bolditalicKernMatrix[16016] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, -1, 1, 0, -2, -1, 0, 0, 1, -3, -2, 1, -2, 0, 0, -2, -1, -2, 0, 1, -1, 0, -3, -3, -1, -3, -2, -1, 1, 0, 0, 0, 1, 1, 0, 0, 0, 0, -2, -1, 1, -2, 0, 4, 1, -4, 0, 0, 0, 1, -1, 0, 4, 0, 1, 0, 4, -1, 0, -3, -2, 0, 0, 4, 0, 0, 2, 0, 0, 1, 0, 1, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -4, -2, 0, 0, 0, 0, 0, 0, 0, 2, -1, 0, 0, -1, 0, 0, 0, -5, 1, -1, 0, -4, -4, 0, 0, 1, 0, 0, 2, 0, -3, 1, -2, -2, 3, -3, 0, -3, -2, -2, 0, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -6, 0, -1, 0, 2, -3, 0, 0, 0, -1, 1, 0, 0, -1, 0, 0, 0, -2, 0, -3, 1, 0, 0, -1, 0, 0, -1, -1, 2, 0, -2, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, -1, 0, 0, 0, -2, -5, 0, 0, -3, 0, 1, -2, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, -4, 0, -3, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, 0, 0, 1, -1, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -3, 0, -2, 0, -1, 0, 1, 0, 0, 1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -3, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, -1, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -3, -6, -3, -5, -2, -2, -2, -1, 0, -2, 0, -1, -2, 0, 0, -4, 0, -1, -6, -1, -1, -1, -6, -5, -1, -3, 0, -1, -2, 0, -1, -2, -1, -2, -2, 0, -4, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, -5, 0, -3, 0, -3, -5, 0, 0, -1, -1, -4, -1, 0, -1, 0, -1, 0, -1, 0, -1, -3, -1, -3, 0, -4, 0, -3, -1, -2, -1, -3, 0, -1, -1, 0, -3, -2, -2, -2, -1, -1, -1, 0, -1, -2, -1, 0, 0, 0, -3, -1, 0, -1, -1, -1, 0, -1, 0, -1, 0, 0, 0, -1,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 1, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, -1, 0, 0, -3, 2, -1, 0, 1, 1, 0, 0, 0, 0, 0, 0, -1, 1, -1, 0, 0, 0, 0, 0, -1, 0, 1, 0, -1, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 1, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, 1, 0, -1, 1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -3, -3, -3, -4, -1, -1, -1, 0, 0, -1, 0, 0, -1, 0, 0, -3, 0, 0, -5, 0, 0, 0, -3, -4, 0, -2, 0, -1, -1, 0, 0, 0, 0, -1, -1, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, -2, 0, -3, -4, 0, 0, 0, 0, -3, 0, 0, 0, 0, -1, 0, 0, -1, 0, -3, 0, -2, 0, -2, 0, -2, 0, 0, 0, -3, 0, -1, 0, 0, -2, -1, -2, -1, 0, -1, -1, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -3, 0, 0, -1, -2, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, -3, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 4, 0, 6, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -2, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, -1, -1, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, -1, 0, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -3, 0, -3, 0, -1, 0, 2, 0, 0, 2, 0, -1, 0, 0, -2, 0, -1, 0, 0, 0, 1, -3, 0, -1, -2, 0, 1, 0, 0, 1, 0, 0, 0, 0, 2, 0, 1, -2, -2, -2, 2, 0, -1, 0, 0, 0, 0, -3, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 2, 0, 0, -1, 0, 0, 2, 0, 0, -1, 0, 0, 0, 0, 0, -2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -3, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, -4, 0, 0, 0, -3, -3, 0, 0, 0, 0, 0, 1, 0, -3, 0, -1, -1, 3, -2, 0, -2, -2, -2, 0, 1, -1, 0, 1, 0, 0, 0, 0, -1, 0, 0, -3, 0, -1, 0, 1, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -2, 1, 0, 0, 0, -1, -1, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, -2, 0, -5, -1, 0, -3, -3, 0, 0, 0, 0, -2, 0, 0, 0, 1, 0, 0, -4, 0, -1, -3, 0, -2, 2, 0, 0, -2, 1, 0, 0, 0, 0, 0, -3, -1, 2, -2, -1, 0, 0, -4, 0, 0, 0, 2, 0, -1, 0, 0, 1, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, -1, 1, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, 0, 0, 0, 1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, -4, 0, -4, 0, -1, 0, 2, 0, 0, 2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 1, -4, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, -3, -2, -2, 1, 0, -1, 0, 0, 0, 0, -5, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 2, 0, 0, -1, 0, 0, 2, 0, 0, -2, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 2, 0, 1, 2, 1, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 4, 1, 0, 0, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -3, 0, -3, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, -1, 1, 0, 0, 0, 0, 1, -3, 0, 0, -1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 3, 0, 1, -2, -2, -2, 0, 0, -1, 0, 0, 0, 0, -3, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 1, 0, 0, -1, 0, 0, 0, 0, 0, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -3, 0, 0, -2, -1, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -3, 0, 0, -2, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -2, 0, 0, -1, -1, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 1, 0, 0, -1, 0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -3, -1, 0, 0, 0, 0, 0, 0, 0, 2, -1, 0, 0, -1, 0, 0, 0, -3, 1, -1, 0, -3, -3, 0, 0, 1, 0, -1, 0, 0, -3, 2, -1, -1, 2, -2, 0, -2, -1, -1, 0, 1, -1, 0, 0, 1, 0, 0, 0, -2, -1, 0, -3, 0, -1, 0, 2, -2, 0, 0, 0, -1, 1, 0, 0, -2, 0, 0, 0, -1, 0, -3, 1, 0, 0, -1, -1, 0, -1, -1, 1, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -2, 0, -1, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 2, 1, -1, 0, 0, 0, -2, -3, 0, -1, -2, 0, 0, -1, 0, 0, 0, 0, -2, 0, 0, -1, 0, 0, -2, 0, -1, -2, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 4, 0, 1, 2, 0, 1, 2, 2, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 4, 2, 2, 0, 0, 2, 4, 0, 0, 0, 3, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 1, 1, 3, 0, 0, 2, 2, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 3, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -3, 0, -3, -3, 0, -1, 0, 1, 0, 0, 0, -1, -2, 0, 0, -3, 0, -1, -4, 0, -1, 0, 0, -3, -1, -3, 0, 0, -1, 0, 0, -2, 0, -2, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, -2, 0, -3, -4, -1, -2, 0, 1, -2, 1, 0, 0, 0, 0, 0, 1, -2, 0, -3, 0, -1, 0, -3, 0, -3, 0, -1, -1, -1, -1, -2, 1, 0, -3, -2, -2, -1, -1, -2, -2, 0, 0, -2, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -3, -1, 0, 0, 0, -1, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0, -3, -3, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -2, 0, -2, -2, -2, 0, -1, 0, -1, 1, -1, 0, 0, 0, -1, 0, 0, -5, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 2, 1, -1, 1, 1, -2, -2, 0, 0, 2, 0, -2, 3, -2, 0, 0, -2, 0, -3, 0, 2, 0, 0, -3, -3, -1, 0, -2, 0, 2, 0, 0, 0, 2, 1, 0, 0, 0, 0, -3, 0, 2, -2, 0, 1, 1, -2, 0, 0, 0, 1, 0, 0, 4, 1, 3, 1, 1, 0, 0, -3, -2, 1, 0, 4, 0, 0, 2, 0, 0, 1, 0, 2, -1, 0, 0, -1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 1, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, -4, 0, 0, -2, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -2, 0, 0, 0, 0, 0, 3, 0, 0, 4, 0, 0, 1, 0, -1, 1, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 3, 0, 0, -1, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 1, 3, 0, 0, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, -1, 1, 0, 0, -1, 0, 0, 2, -3, -2, 1, -2, 0, 0, -2, -1, -2, 0, 1, -1, 0, -3, -3, -1, -3, -2, -1, 1, 0, 0, 0, 1, 1, 0, 0, 0, 0, -2, -1, 1, 0, 0, 4, 1, -4, 0, 0, 0, 1, -1, 0, 4, 0, 1, 0, 4, -1, 0, -3, 1, 0, 0, 4, 0, 0, 2, 0, 0, 1, 0, 1, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, -2, -3, 0, 0, 0, 0, 0, 2, 0, -2, 0, 0, 0, 0, -1, 0, -2, -1, -1, 0, 0, -1, 0, 2, 0, 0, 0, 0, -1, 0, 0, -3, 0, 0, 0, 1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -3, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 1, 1, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, 0, -2, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -2, 0, -1, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, -1, 1, 0, 0, 1, 0, -1, 0, 0, -2, 2, 0, 0, 1, 1, 0, 0, -1, -1, 0, 1, -1, 1, 0, 0, 0, 0, -1, 0, 0, 0, 1, 0, -1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, -1, 0, -1, 0, 0, 1, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, -1, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 1, -1, -2, -2, 1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -3, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -4, 0, -1, 0, -3, -3, 0, 0, 1, 0, 0, 1, 0, -3, 0, -3, -3, 1, -2, 0, -2, -1, -1, 0, 0, -2, 0, 0, 1, 0, 0, 0, -2, 0, 0, -4, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, -1, 0, 0, 0, -2, -1, 0, -2, 0, 0, 0, -1, 0, -2, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -1, 0, 0, 0, 2, 0, 3, 0, 1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 2, 0, 0, 1, 0, -1, 0, 0, -2, 3, 0, 0, 1, 2, 0, 0, 0, -1, 0, 1, -1, 3, 3, 0, 5, 0, -1, 0, 0, 0, 2, 0, 1, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 2, 0, 0, 1, 0, 0, -1, 0, -1, 0, 0, 1, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, -3, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0, -3, -4, 0, 0, 0, 0, -1, 0, 0, -3, 1, -1, -1, 0, -2, 0, -3, -2, -2, 0, 0, -1, 0, 0, 1, 0, 0, 0, -2, 0, 0, -5, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -3, 0, 0, 0, -1, -1, -2, 0, -1, 0, 0, -2, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, -1, 0, 0, 0, -2, -5, 0, 4, -3, 0, 2, -2, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, -4, 0, -3, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, -1, 0, 5, 0, 0, 0, 5, -1, 0, 0, -2, 0, 0, 0, 1, -1, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, -1, 1, -1, -1, 2, -1, 0, -1, -2, -2, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 1, -2, 0, 0, -1, 0, 0, 0, -1, 0, -1, 0, -1, -1, 0, 0, 1, 0, -1, 0, 0, -2, 2, -2, 0, 1, -1, 0, 0, -1, -1, 0, 1, -1, 1, 0, 0, 2, 0, -1, -2, 0, 0, 1, 0, -1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, -2, 3, 0, 0, -1, 0, -2, 1, 0, 0, -1, -2, -2, 0, 0, 1, 0, -1, 2, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, -2, 0, 0, 0, -1, 0, -1, 0, 0, -2, 0, 0, -2, 0, 0, 0, -1, 0, -1, 0, -2, 0, 0, 0, 0, 0, -2, 0, 0, -2, -1, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, -1, 0, -2, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0, -2, -1, -2, -1, -1, 0, -1, -2, 0, -2, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, -2, 0, -1,
+    0, 0, -2, 0, -1, 0, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -1, 6, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 6, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, -2, 0, -3, -1, 0, -3, -3, 0, 0, 0, 0, -4, -1, 0, 0, 0, 0, 0, -4, 0, -1, -2, 0, -2, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -3, 0, 0, -2, -1, 0, 0, -3, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, -1, 0, 0, -1, 0, 2, 3, 0, 0, 0, 5, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 5, 0, 0, 0, 0, -1, 0, 0, 0, 3, 2, 1, 2, 5, 0, 0, 0, 3, 2, 0, 3, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -3, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -4, -1, 0, 0, -2, 0, 0, 0, 0, -4, -1, 0, 0, 0, 0, 0, -4, 0, -1, -2, 0, -1, 1, 0, 0, -4, 0, 0, 0, 0, 0, 0, -3, 0, 0, -1, -2, 0, 0, -3, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, 1, 0, -1, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, -1, 1, 0, 0, -1, 0, 0, 0, 0, 0, -1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 4, 0, 6, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, 0, 4, 0, 0, 1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 4, 0, 0, 0, 0, -1, 0, 0, 0, 4, -1, 0, -1, 4, 0, 0, -1, 0, -1, 0, 4, -1, 0, 0, 4, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -3, 0, -4, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, 1, 0, 0, 0, 0, -1, -3, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, -2, 0, 0, 0, 0, 0, 0, 0, -5, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, -1, 0, 0, 0, 0, 2, 1, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 4, 0, 0, 0, 0, -1, 0, 0, 0, 2, 2, 0, 2, 4, 0, 0, 0, 1, 2, 0, 2, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 5, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -3, 0, -3, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -3, 0, 0, -1, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, -2, 1, 0, -1, 0, 0, 0, 0, -3, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -2, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, -1, 0, -1, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 1, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 4, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 1, 0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, -3, 0, -2, -1, 0, 0, 0, 0, -1, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -3, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, -2, 1, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 2, 0, 6, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 4, 0, 0, 1, 4, 0, -1, 0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 2, 0, -1, 0, -1, -1, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 3, -1, 0, -1, 2, 0, 0, -2, 0, -1, 0, 3, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -1, 0, 1, 0, -1, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, -1, -1, 1, 0, -1, 0, 0, 0, 0, 1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 2, 0, 0, -1, 0, 0, 0, 0, 0, 2, 0, 0, 0, 2, 0, 0, 0, 0, 0, -2, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 2, 3, 0, 0, 0, 2, 2, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -2, 1, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 1, 0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 1, 0, 0, -2, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, -1, 0, 1, -1, -1, 2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, -2, 0, 0, 0, 2, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0,
+    0, 0, -2, -1, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 1, 0, 0, -1, 0, 0, 0, 0, -1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, -1, 2, 0, 0, 0, 0, -1, 0, 0, 0, 1, 0, -1, 0, 0, 1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 1, 0, -2, 1, 0, 0, 1, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 4, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0, 2, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -1, 0, 0, 1, 1, 0, 0, 0, 0, -2, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 3, 0, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -2, -1, 0, 0, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -3, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 4, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 2, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 3, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 2, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 1, -1, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 3, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t bookerly_16_bolditalicGlyphLookup[368] = {
+    0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0001, 0x0002, 0xFFFF, 0xFFFF, 0xFFFF, 0x0003, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0004, 0xFFFF, 0xFFFF,
+    0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, 0x0010, 0x0011, 0x0012, 0x0013, 0x0014,
+    0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, 0x0020, 0x0021, 0x0022, 0x0023, 0x0024,
+    0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, 0x0030, 0x0031, 0x0032, 0x0033, 0x0034,
+    0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, 0x0040, 0x0041, 0x0042, 0x0043, 0x0044,
+    0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051, 0x0052, 0x0053, 0x0054,
+    0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, 0x0060, 0x0061, 0x0062, 0x0063, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x0072, 0x0073,
+    0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, 0x0080, 0x0081, 0x0082, 0x0083,
+    0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F, 0x0090, 0x0091, 0x0092, 0x0093,
+    0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F, 0x00A0, 0x00A1, 0x00A2, 0x00A3,
+    0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF, 0x00B0, 0x00B1, 0x00B2, 0x00B3,
+    0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF, 0x00C0, 0x00C1, 0x00C2, 0x00C3,
+    0x0241, 0x0242, 0x0243, 0x0244, 0x0245, 0x0246, 0x0247, 0x0248, 0x0249, 0x024A, 0x024B, 0x024C, 0x024D, 0x024E, 0x024F, 0x0250,
+    0x0251, 0x0252, 0x0253, 0x0254, 0x0255, 0x0256, 0x0257, 0x0258, 0x0259, 0x025A, 0x025B, 0x025C, 0x025D, 0x025E, 0x025F, 0x0260,
+    0x0261, 0x0262, 0x0263, 0x0264, 0x0265, 0x0266, 0x0267, 0x0268, 0x0269, 0x026A, 0x026B, 0x026C, 0x026D, 0x026E, 0x026F, 0x0270,
+    0x0271, 0xFFFF, 0x0272, 0x0273, 0x0274, 0x0275, 0x0276, 0x0277, 0x0278, 0x0279, 0x027A, 0x027B, 0x027C, 0xFFFF, 0x027D, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x027E, 0x027F, 0xFFFF, 0xFFFF, 0x0280, 0x0281, 0x0282, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x0283, 0xFFFF, 0xFFFF, 0xFFFF, 0x0284, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0285,
+    0x0286, 0x0287, 0x0288, 0x0289, 0x028A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
 };
 
 static const EpdFontData bookerly_16_bolditalic = {
     bookerly_16_bolditalicBitmaps,
     bookerly_16_bolditalicGlyphs,
     bookerly_16_bolditalicIntervals,
-    64,
+    65,
     44,
     36,
     -9,
     true,
     bookerly_16_bolditalicGroups,
-    11,
+    4,
+    bookerly_16_bolditalicKernLeftClasses,
+    bookerly_16_bolditalicKernRightClasses,
+    bookerly_16_bolditalicKernMatrix,
+    112,
+    nullptr,
+    0,
+    0,
+    bookerly_16_bolditalicGlyphLookup,
+    bookerly_16_bolditalicGlyphGroups,
+    false,
+    nullptr,
 };
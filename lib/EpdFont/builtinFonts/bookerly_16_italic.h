@@ -3,2166 +3,2230 @@
  * name: bookerly_16_italic
  * size: 16
  * mode: 2-bit  compressed: true
- * Command used: fontconvert.py bookerly_16_italic 16 ../builtinFonts/source/Bookerly/Bookerly-Italic.ttf --2bit --compress
+ * Command used: fontconvert.py bookerly_16_italic 16 ../builtinFonts/source/Bookerly/Bookerly-Italic.ttf --2bit --compress --frequency-corpus ../../../test/hyphenation_eval/resources/english_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/french_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/german_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/italian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/russian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/spanish_hyphenation_tests.txt
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t bookerly_16_italicBitmaps[34457] = {
-    0x9D, 0x5A, 0x3F, 0x8C, 0xE4, 0xD6, 0x79, 0x7F, 0x24, 0x6F, 0x8F, 0x87, 0x23, 0x12, 0x5E, 0x71,
-    0x52, 0x8C, 0x1C, 0x62, 0xBA, 0x4C, 0x8C, 0xE8, 0x5E, 0x93, 0x42, 0x08, 0x76, 0xE7, 0x51, 0x52,
-    0xA1, 0x42, 0x85, 0x2F, 0x81, 0x47, 0x02, 0x72, 0x85, 0x52, 0xA4, 0x11, 0x82, 0x60, 0x1B, 0x15,
-    0x2E, 0x76, 0x87, 0x3C, 0xBB, 0x50, 0x61, 0x20, 0xB9, 0x26, 0x69, 0xDC, 0x1A, 0x86, 0xB1, 0x2A,
-    0x2E, 0x85, 0x8A, 0x03, 0x3C, 0x33, 0x64, 0x74, 0x08, 0x5C, 0x1C, 0x90, 0xA3, 0x65, 0x04, 0x02,
-    0xA2, 0x42, 0x94, 0x2D, 0x41, 0xB0, 0xF2, 0x67, 0x69, 0x89, 0x67, 0x71, 0x6F, 0x49, 0xBE, 0xFC,
-    0x7E, 0xDF, 0xE3, 0xCC, 0xEE, 0x4A, 0x0A, 0x9C, 0x64, 0xEE, 0x96, 0x33, 0xC3, 0x3F, 0xDF, 0xFB,
-    0xFE, 0x7F, 0xBF, 0xEF, 0x7B, 0xA3, 0xBC, 0x54, 0xF5, 0xCA, 0xE4, 0x41, 0xA3, 0x32, 0x15, 0xD5,
-    0xF8, 0x1C, 0x97, 0xAA, 0x53, 0x49, 0xEA, 0x37, 0x4A, 0xAB, 0xA0, 0x56, 0x7B, 0x2A, 0x28, 0xD5,
-    0x81, 0x0A, 0x73, 0xF5, 0xBA, 0xBA, 0xAA, 0xDC, 0xEB, 0xAF, 0x94, 0x2E, 0x03, 0x3C, 0x95, 0xAA,
-    0x54, 0xA9, 0xFC, 0x6B, 0x61, 0xB9, 0x8C, 0xCB, 0x2E, 0xBE, 0xD3, 0x26, 0xCF, 0x37, 0x89, 0xDF,
-    0xE8, 0xA0, 0xBE, 0x19, 0x94, 0x7B, 0x41, 0xB9, 0x8B, 0x87, 0xF8, 0xBA, 0x85, 0x35, 0xD4, 0xAE,
-    0x6A, 0x94, 0x4A, 0xD4, 0x77, 0x94, 0x8A, 0xF2, 0x67, 0x94, 0x0A, 0xAA, 0x58, 0xA9, 0xF9, 0xE3,
-    0x57, 0xFE, 0x35, 0x2D, 0xAC, 0xB5, 0xCD, 0x37, 0x8B, 0xA3, 0xF1, 0x87, 0x2A, 0x4E, 0xF7, 0x70,
-    0xA5, 0xC4, 0x15, 0xAF, 0x09, 0x4B, 0xA5, 0xEE, 0xFB, 0xB5, 0x02, 0x03, 0xAD, 0x8A, 0x71, 0xCF,
-    0x10, 0xE2, 0x60, 0x95, 0xDF, 0x44, 0xA0, 0xFA, 0x56, 0x50, 0xF1, 0x0A, 0x48, 0xC6, 0x60, 0x4E,
-    0x85, 0xE5, 0x4D, 0xAC, 0x93, 0x7A, 0x6A, 0xFB, 0x02, 0x0D, 0x10, 0xC1, 0x01, 0x6B, 0x51, 0x02,
-    0x75, 0xC3, 0xA6, 0x24, 0x93, 0x06, 0x27, 0x3F, 0x19, 0xD4, 0x2A, 0x7E, 0xA9, 0x89, 0xCB, 0xC6,
-    0x78, 0xDD, 0xD7, 0x83, 0x3A, 0x79, 0xBB, 0xBA, 0xA6, 0x86, 0x3F, 0xC6, 0x33, 0xA7, 0xB8, 0xCF,
-    0xF4, 0x78, 0xC0, 0xE2, 0x49, 0xDF, 0x62, 0x89, 0xD8, 0xE6, 0xCA, 0xFB, 0xB8, 0x57, 0xE9, 0x33,
-    0x71, 0x7D, 0x10, 0x94, 0x36, 0x2A, 0x77, 0xA3, 0x7A, 0x08, 0xF3, 0x31, 0x6A, 0xDE, 0x4A, 0xCA,
-    0xEC, 0xF8, 0x76, 0xEB, 0x81, 0x33, 0xDC, 0x3B, 0xE2, 0x01, 0x30, 0x0B, 0x9E, 0xDC, 0x72, 0xE4,
-    0x4A, 0x91, 0x53, 0x70, 0x7F, 0xEE, 0x75, 0x5D, 0x29, 0x7D, 0x97, 0x77, 0x79, 0xB6, 0x53, 0x50,
-    0x76, 0x58, 0x2F, 0x21, 0x91, 0x8A, 0xF3, 0x3D, 0x15, 0x56, 0x50, 0xF8, 0x0C, 0x1F, 0x71, 0x75,
-    0x86, 0x8F, 0xA0, 0x30, 0x23, 0x95, 0xA5, 0x68, 0x00, 0x6F, 0x07, 0xB0, 0x06, 0xDE, 0xBA, 0xA8,
-    0xDC, 0x49, 0x97, 0x5E, 0x93, 0xA8, 0xA2, 0x59, 0x84, 0xD5, 0x5E, 0xF0, 0xA4, 0xD7, 0x36, 0xBD,
-    0x1F, 0x97, 0x87, 0x51, 0xC7, 0xB3, 0x33, 0x2A, 0x77, 0xC6, 0x37, 0x52, 0xC5, 0x9B, 0x06, 0x95,
-    0x3D, 0x92, 0x23, 0x25, 0x90, 0x5A, 0xE2, 0x1F, 0xCC, 0xBD, 0xC4, 0xC7, 0x08, 0xA6, 0xC5, 0xC7,
-    0x24, 0x55, 0xE6, 0x5E, 0xC9, 0x7B, 0x93, 0x51, 0x38, 0xF7, 0x6E, 0x9D, 0xB1, 0xEC, 0x0F, 0x3C,
-    0x7A, 0x56, 0xE4, 0x58, 0x27, 0x94, 0x2D, 0x4E, 0x97, 0xBC, 0xD0, 0x44, 0xFC, 0x32, 0x83, 0xBB,
-    0xC0, 0x02, 0x95, 0xE6, 0x75, 0x38, 0x82, 0xBA, 0xA4, 0xA2, 0xF7, 0xC0, 0x69, 0xAD, 0x8A, 0x96,
-    0x8B, 0x27, 0xB5, 0xF2, 0x8A, 0x2A, 0x1A, 0x55, 0x64, 0x9B, 0xE0, 0xF3, 0x26, 0xB2, 0x77, 0x55,
-    0x67, 0xFC, 0xB1, 0x56, 0xDA, 0xEB, 0x9E, 0xB9, 0x49, 0x47, 0xA8, 0x60, 0xCC, 0x03, 0xB8, 0xDF,
-    0x01, 0xF8, 0x09, 0x3A, 0x28, 0x60, 0xA9, 0xE2, 0x5F, 0x34, 0x64, 0x2E, 0xC3, 0xDA, 0x19, 0xD6,
-    0xCE, 0x55, 0x30, 0xCE, 0x8B, 0x91, 0xF6, 0xB0, 0xC7, 0x78, 0xD3, 0xB6, 0xD6, 0xA0, 0xB3, 0xC3,
-    0x4F, 0xC2, 0xE4, 0xD3, 0xA9, 0xCA, 0x0F, 0xE0, 0x84, 0xC9, 0x73, 0x8D, 0xF6, 0xEB, 0x3D, 0xB1,
-    0x80, 0xBC, 0xE8, 0x46, 0x6B, 0x3C, 0x57, 0x29, 0x0F, 0x86, 0x4D, 0x72, 0x2A, 0x9D, 0x2E, 0x8E,
-    0x35, 0xA8, 0x71, 0x65, 0x20, 0x5A, 0xEB, 0xCE, 0xCC, 0x28, 0xD2, 0xF6, 0x23, 0xA5, 0xA2, 0xC2,
-    0xA1, 0x1B, 0xB5, 0x38, 0xFB, 0xCA, 0xAB, 0x94, 0xF4, 0x50, 0x09, 0x25, 0x3E, 0x0B, 0x05, 0xCA,
-    0x25, 0x92, 0x8B, 0xF8, 0x97, 0x9E, 0x29, 0xEF, 0x0F, 0xA6, 0x5B, 0x57, 0x4A, 0x56, 0x3C, 0xFF,
-    0x08, 0x95, 0x07, 0x59, 0xC9, 0x01, 0x4F, 0x73, 0x69, 0x3E, 0xCD, 0xF5, 0x56, 0xD3, 0xD7, 0xD2,
-    0x5D, 0xED, 0xB6, 0xAC, 0xAA, 0x89, 0xD5, 0x43, 0x47, 0x02, 0x8C, 0xF8, 0xD4, 0x71, 0x2A, 0x6F,
-    0x08, 0xC7, 0xB0, 0x71, 0xBC, 0xCB, 0x2B, 0x4A, 0xAF, 0xC4, 0xA5, 0x8E, 0x53, 0xF3, 0x2F, 0x2A,
-    0x1C, 0x56, 0xAA, 0x18, 0xA2, 0xFF, 0xFC, 0x1B, 0xF3, 0xB7, 0x2A, 0x89, 0xD5, 0x25, 0xAC, 0x8B,
-    0x58, 0xF6, 0xD4, 0x05, 0x49, 0xC9, 0xCC, 0x4C, 0x79, 0xF3, 0x93, 0xB9, 0xB6, 0xB6, 0x47, 0x58,
-    0x36, 0x5F, 0xBE, 0xBA, 0x71, 0xE7, 0xDE, 0x1B, 0xD4, 0x00, 0xB6, 0x7B, 0xBF, 0x09, 0xEB, 0x24,
-    0x5F, 0xA9, 0x6B, 0x2A, 0xB3, 0xBF, 0xB0, 0xF6, 0xA7, 0x0C, 0x84, 0xE8, 0xE1, 0xE7, 0xC3, 0xB8,
-    0x23, 0xBE, 0xC3, 0x90, 0xA0, 0x44, 0xE2, 0x23, 0x93, 0xBB, 0x38, 0xE1, 0xDC, 0xE9, 0xFE, 0xFF,
-    0x7C, 0x3A, 0xFC, 0x2D, 0xA7, 0xD5, 0xE4, 0xBA, 0x97, 0xC1, 0x88, 0x2A, 0x10, 0xC3, 0x81, 0x85,
-    0xEB, 0xC6, 0x75, 0xC8, 0x2C, 0xE7, 0xF7, 0x74, 0x86, 0x81, 0xAE, 0x30, 0x04, 0x90, 0x64, 0xA4,
-    0xC2, 0x06, 0xA4, 0x3D, 0x35, 0xC0, 0x43, 0x54, 0x0F, 0xEF, 0xF6, 0x7A, 0x5D, 0x2A, 0xBF, 0x37,
-    0x70, 0xB9, 0x96, 0x87, 0x06, 0x6A, 0x8D, 0x6A, 0x7C, 0x8A, 0x4B, 0x1C, 0x74, 0x6E, 0xE0, 0x95,
-    0x4A, 0x57, 0x88, 0x8A, 0xF8, 0x64, 0xBF, 0x55, 0x48, 0x4A, 0x78, 0xC6, 0x32, 0x46, 0x76, 0xDC,
-    0xBA, 0xA9, 0xDA, 0xAF, 0x43, 0xDB, 0x06, 0xB6, 0x57, 0x3B, 0x19, 0x38, 0x2C, 0x99, 0x56, 0xB9,
-    0x58, 0x4F, 0x5F, 0xA6, 0x0B, 0x5E, 0xF8, 0xAE, 0x73, 0x3A, 0x27, 0xAD, 0xE9, 0xBE, 0x67, 0x15,
-    0x48, 0x3E, 0xB0, 0x16, 0x3C, 0xDD, 0x80, 0xD2, 0x22, 0x2A, 0xD4, 0xE2, 0x10, 0xB7, 0xC8, 0xB8,
-    0x85, 0x0A, 0x5B, 0xC6, 0x6B, 0x15, 0xA6, 0x2A, 0x83, 0xE8, 0x3E, 0x45, 0x8F, 0xA9, 0x64, 0x86,
-    0x41, 0x44, 0x8D, 0x14, 0x38, 0x1D, 0xB5, 0xD3, 0x87, 0xB8, 0x99, 0x2E, 0x21, 0x08, 0x5D, 0x20,
-    0x83, 0x7D, 0x15, 0xD2, 0x18, 0x19, 0x92, 0xE9, 0xF3, 0xF8, 0xEB, 0x99, 0x56, 0x21, 0xBB, 0xAC,
-    0xA6, 0xA1, 0xAA, 0x04, 0x12, 0x05, 0x9D, 0x37, 0xC2, 0xEB, 0xA3, 0x06, 0x19, 0x7C, 0x0D, 0xDB,
-    0x52, 0x39, 0x54, 0x1A, 0x18, 0xC0, 0x93, 0x20, 0x91, 0xD5, 0xE4, 0x2A, 0x75, 0xEC, 0xA9, 0x84,
-    0xCB, 0x90, 0x1F, 0x8A, 0x45, 0x21, 0x64, 0xE1, 0x60, 0x60, 0x12, 0x4D, 0xD5, 0x6D, 0x5B, 0x05,
-    0x94, 0x47, 0x73, 0x99, 0xEB, 0x53, 0x52, 0xA9, 0x27, 0x5E, 0x02, 0x3E, 0x6F, 0xE8, 0x63, 0xA7,
-    0x74, 0xF1, 0x8C, 0x34, 0xB0, 0x90, 0x79, 0x91, 0x3A, 0x82, 0x63, 0x9B, 0xB4, 0x57, 0x41, 0x07,
-    0x99, 0x75, 0x1E, 0x97, 0x7E, 0x07, 0xA6, 0x74, 0xEE, 0xB7, 0x3E, 0xCB, 0x14, 0x18, 0xB5, 0x23,
-    0xAB, 0x47, 0x37, 0x9F, 0xBF, 0xFA, 0x51, 0x2A, 0x01, 0x30, 0x39, 0x03, 0xF9, 0xD1, 0xF9, 0x14,
-    0x77, 0xDE, 0x7C, 0x7E, 0x0B, 0x9E, 0x30, 0x32, 0x79, 0x54, 0x22, 0x85, 0x4E, 0x5D, 0xFC, 0x48,
-    0x48, 0x85, 0x64, 0xA5, 0xE8, 0x98, 0x5B, 0x70, 0x78, 0x9A, 0x8A, 0xF7, 0xC0, 0xB5, 0xD3, 0x12,
-    0x59, 0x14, 0x25, 0x93, 0x9A, 0x48, 0x47, 0x0D, 0x68, 0xC6, 0x69, 0xA7, 0xBC, 0x7D, 0x26, 0x35,
-    0xA8, 0x37, 0x1B, 0xCF, 0xFC, 0xEE, 0x46, 0x4B, 0xA9, 0xF1, 0x88, 0x1E, 0x41, 0x84, 0x22, 0x87,
-    0xC3, 0x46, 0x45, 0xA4, 0x26, 0xE6, 0x10, 0x92, 0x50, 0xCA, 0x5D, 0x3E, 0xDF, 0xA9, 0xF8, 0xA3,
-    0x1B, 0x03, 0x1D, 0xC5, 0x72, 0x99, 0x8C, 0x72, 0x98, 0xED, 0x41, 0xBE, 0xAE, 0x79, 0x81, 0xB7,
-    0xC0, 0x07, 0xE2, 0x16, 0xB4, 0x02, 0xBA, 0x1D, 0x42, 0x9A, 0xE2, 0x61, 0x99, 0x9D, 0xF9, 0x7C,
-    0x8E, 0x53, 0xF6, 0x03, 0x6A, 0x63, 0x35, 0x7F, 0xB9, 0x47, 0x24, 0xF4, 0x28, 0x81, 0xA8, 0x54,
-    0x8A, 0xF7, 0xAC, 0x27, 0xB3, 0xF0, 0x8F, 0x5A, 0x82, 0x27, 0xA3, 0x84, 0x8B, 0x73, 0x8A, 0xFB,
-    0xD0, 0x73, 0x42, 0xE6, 0x25, 0xE6, 0xA7, 0x61, 0x62, 0x92, 0x06, 0xE5, 0x4D, 0xCC, 0x3D, 0x93,
-    0x74, 0x1B, 0x1F, 0x89, 0x4F, 0x8A, 0x2A, 0xE8, 0xD4, 0x08, 0xC2, 0x61, 0x03, 0xE7, 0x58, 0x60,
-    0x95, 0xA8, 0x8A, 0x6B, 0x68, 0xB7, 0x48, 0x33, 0x18, 0x15, 0x3E, 0x12, 0x53, 0x76, 0xEA, 0x35,
-    0x2B, 0x60, 0xBD, 0xB2, 0x28, 0xA3, 0xDA, 0x67, 0xE4, 0xC5, 0x8C, 0xA8, 0x02, 0xEA, 0x8F, 0x1A,
-    0xB0, 0x33, 0x82, 0x8C, 0x2E, 0x75, 0x9B, 0xB4, 0xF0, 0xA7, 0x1E, 0x9A, 0x1B, 0x36, 0x8B, 0xE9,
-    0x0F, 0xE9, 0xFD, 0x60, 0xC8, 0xBE, 0xC9, 0x87, 0xC0, 0x5A, 0x86, 0xC5, 0x60, 0x83, 0xB8, 0x42,
-    0x0A, 0x34, 0x29, 0x1F, 0x86, 0x1E, 0x83, 0x16, 0xCC, 0xC7, 0x55, 0x52, 0x51, 0x53, 0x15, 0x4E,
-    0x64, 0x74, 0xE7, 0x8C, 0x66, 0x79, 0xFA, 0x95, 0xF6, 0x82, 0x09, 0x2B, 0xE7, 0x93, 0xAA, 0xC0,
-    0x87, 0xFD, 0x1E, 0x55, 0x09, 0x66, 0x0E, 0xC9, 0xA5, 0x2B, 0x77, 0xD7, 0xBD, 0x21, 0x18, 0x82,
-    0x5E, 0xF2, 0xCA, 0x85, 0x97, 0x86, 0x50, 0x36, 0x1D, 0xC5, 0x77, 0x6F, 0x21, 0xF8, 0x14, 0x50,
-    0x44, 0x2F, 0xC9, 0xFA, 0xAB, 0x5E, 0x12, 0x9F, 0xD4, 0x72, 0xCF, 0x8F, 0x5A, 0x79, 0x40, 0x53,
-    0x70, 0x59, 0x35, 0x81, 0x93, 0x54, 0x92, 0x56, 0x68, 0xE1, 0x64, 0x60, 0x13, 0xE1, 0x36, 0xE0,
-    0x4B, 0x2A, 0xCC, 0x31, 0xA8, 0x12, 0xC6, 0x3C, 0xC1, 0x04, 0x6A, 0x9E, 0x2A, 0x6A, 0xC7, 0x3E,
-    0xAB, 0x88, 0x7A, 0x6A, 0x3E, 0xFF, 0x73, 0x98, 0xF7, 0x21, 0x41, 0xD0, 0xD9, 0x8B, 0x96, 0x67,
-    0xBA, 0x86, 0xC0, 0xCD, 0x35, 0x97, 0x9E, 0xE9, 0x6F, 0x24, 0xC9, 0x05, 0x84, 0xA6, 0x26, 0xCD,
-    0x5E, 0x7C, 0x30, 0x1C, 0xA5, 0x9A, 0x82, 0x30, 0x4F, 0x72, 0x9D, 0x7C, 0x22, 0xF4, 0x1A, 0x9E,
-    0x29, 0x63, 0xDB, 0xC4, 0xFF, 0xDE, 0x5D, 0x61, 0x10, 0x2D, 0xE5, 0x7F, 0x47, 0x19, 0x22, 0x11,
-    0x67, 0xE0, 0x47, 0x68, 0x3E, 0x01, 0xA1, 0x1F, 0x93, 0x4F, 0xA6, 0x4D, 0x79, 0x5D, 0x4D, 0xE9,
-    0x27, 0xF0, 0x29, 0xDC, 0x35, 0xC5, 0xF7, 0x5C, 0x34, 0x7A, 0x99, 0xCE, 0x4D, 0x2B, 0x32, 0x05,
-    0x63, 0xED, 0x94, 0xEC, 0xF8, 0xA3, 0xF3, 0x2D, 0x4A, 0xE1, 0xF5, 0xE2, 0x8A, 0xC8, 0xF5, 0x20,
-    0xF6, 0xDA, 0x8E, 0x5A, 0x40, 0x59, 0x66, 0x6C, 0x82, 0xDA, 0xA8, 0xF8, 0x63, 0xAB, 0x66, 0x61,
-    0x15, 0x34, 0x51, 0x1D, 0xD4, 0x3D, 0x02, 0x79, 0x57, 0xCD, 0xE2, 0x3C, 0xCE, 0xC3, 0x32, 0xF8,
-    0x59, 0x83, 0x1A, 0x7A, 0x5F, 0x1D, 0x68, 0x44, 0x48, 0x9C, 0xC6, 0x0F, 0x9A, 0xA0, 0x81, 0xD1,
-    0x5A, 0x83, 0xFC, 0x0F, 0x1F, 0x08, 0xF0, 0x78, 0xDC, 0x44, 0x15, 0xA2, 0x27, 0x78, 0xDF, 0x47,
-    0xBA, 0x0C, 0xC6, 0x5F, 0x9F, 0x0E, 0xB8, 0x55, 0xF7, 0xB1, 0x65, 0xA1, 0x7C, 0x4D, 0xFD, 0x91,
-    0xF3, 0x7C, 0xBE, 0x86, 0x09, 0x26, 0x4C, 0x28, 0x4D, 0x43, 0xA6, 0xAF, 0xD3, 0x45, 0x4E, 0xE6,
-    0xF4, 0x12, 0x80, 0x3B, 0xE6, 0x03, 0xBA, 0xCA, 0xDD, 0x8B, 0x56, 0xBE, 0xE6, 0xCA, 0xA0, 0x1C,
-    0x9D, 0x3D, 0x32, 0xF1, 0x07, 0x23, 0x84, 0xF4, 0x42, 0x30, 0xE8, 0xB7, 0xB8, 0x48, 0xF4, 0x80,
-    0x0E, 0x15, 0x54, 0x12, 0xF2, 0x35, 0x53, 0x8F, 0xD7, 0x88, 0xEA, 0x3A, 0xC9, 0x45, 0x4B, 0x49,
-    0x42, 0x33, 0x07, 0x2C, 0x8E, 0xDE, 0x6C, 0x05, 0xE3, 0x10, 0xE9, 0x7C, 0x72, 0x54, 0x94, 0x8C,
-    0x3D, 0x24, 0x33, 0x57, 0x1D, 0xA6, 0x1A, 0xDF, 0x4B, 0xC8, 0xAE, 0x18, 0xAC, 0x3E, 0xD4, 0x7A,
-    0xC3, 0x7E, 0x2A, 0xA9, 0xAD, 0x9F, 0xD2, 0x8F, 0xA5, 0x79, 0x59, 0xBB, 0x7F, 0xD4, 0x45, 0x8C,
-    0x0E, 0x67, 0xB7, 0xB5, 0x3B, 0x84, 0x7C, 0x10, 0xE6, 0x44, 0x40, 0x55, 0x3E, 0x23, 0x09, 0x8C,
-    0x10, 0x14, 0x33, 0xE9, 0x03, 0x7E, 0xA6, 0x88, 0x42, 0xC3, 0x60, 0x31, 0x5C, 0x2F, 0xE3, 0x61,
-    0xC1, 0xC3, 0x8A, 0x86, 0x12, 0x62, 0x70, 0xFB, 0xC6, 0x1B, 0xFE, 0x2C, 0x2B, 0x35, 0x99, 0x2C,
-    0xEC, 0x17, 0xD4, 0xB2, 0x6F, 0x3F, 0x84, 0xE7, 0xE2, 0x4A, 0xF2, 0xE4, 0xF6, 0xA8, 0xB2, 0x5C,
-    0x1D, 0x32, 0x9B, 0x1C, 0x30, 0x71, 0x1E, 0x50, 0xE6, 0xD7, 0x29, 0xA5, 0xCB, 0xCC, 0x92, 0xAC,
-    0x8D, 0x9A, 0x92, 0x92, 0x3B, 0x14, 0xDB, 0xC3, 0xD9, 0x39, 0xF1, 0x0F, 0x03, 0xDD, 0xD6, 0x74,
-    0xB9, 0x2A, 0xB2, 0x47, 0x36, 0xF7, 0x89, 0xB9, 0xB1, 0xD8, 0x59, 0x62, 0x9A, 0x44, 0xAF, 0x59,
-    0xF2, 0xA9, 0xBD, 0x1F, 0x75, 0x97, 0x91, 0x20, 0x21, 0xA2, 0x16, 0xED, 0x85, 0xE2, 0xC7, 0x10,
-    0x0C, 0xCA, 0x04, 0x47, 0x64, 0x65, 0x94, 0xA2, 0x36, 0x8A, 0xDE, 0x37, 0x47, 0xC2, 0xC3, 0x41,
-    0xD8, 0x1B, 0xC8, 0x9F, 0x27, 0x8A, 0x40, 0x82, 0xCA, 0x24, 0xAA, 0x17, 0x1B, 0xC5, 0xC3, 0xD9,
-    0x07, 0xE1, 0xB3, 0x67, 0x3E, 0xF1, 0x06, 0x2F, 0x43, 0x9C, 0x5B, 0xAA, 0xF1, 0x82, 0x42, 0x0C,
-    0x4E, 0xE5, 0xB1, 0x78, 0xD0, 0xFE, 0x27, 0x30, 0x2C, 0xF4, 0xBE, 0x27, 0x31, 0x24, 0x0F, 0xE6,
-    0x4E, 0x3C, 0xD1, 0x05, 0x39, 0x71, 0x05, 0x49, 0x8D, 0x6F, 0x32, 0x63, 0x52, 0x3C, 0xFD, 0xC9,
-    0xD1, 0xF9, 0x2B, 0xE2, 0x2C, 0xE4, 0xE1, 0x1A, 0x9F, 0xD9, 0xE5, 0x95, 0x44, 0xA8, 0xE5, 0xDE,
-    0xF0, 0x17, 0xF7, 0x2A, 0xC6, 0x58, 0xC3, 0x43, 0x27, 0x0B, 0x8F, 0xEE, 0x70, 0x79, 0x3C, 0x1A,
-    0xA8, 0x85, 0x5D, 0xDE, 0x29, 0x87, 0x3F, 0x71, 0xC5, 0x51, 0x1C, 0x50, 0x88, 0x8B, 0x45, 0xE2,
-    0x7F, 0xC3, 0x5A, 0x09, 0x13, 0x8B, 0xAC, 0xFA, 0x05, 0xDB, 0x88, 0x33, 0xAF, 0xB7, 0xD1, 0xD2,
-    0x6F, 0xB8, 0xD1, 0x6C, 0x93, 0x0A, 0xDB, 0x9C, 0xB3, 0xC0, 0x89, 0xAC, 0xDE, 0xAA, 0xEC, 0x57,
-    0x7F, 0x3D, 0xD0, 0xFE, 0x9A, 0x91, 0x1E, 0x95, 0x20, 0xE8, 0xD7, 0x14, 0xB5, 0x91, 0xE5, 0x64,
-    0x75, 0xA9, 0xA6, 0x2E, 0x82, 0x64, 0x15, 0x44, 0x64, 0x62, 0xDF, 0x43, 0xB6, 0xB1, 0xBF, 0xE9,
-    0x59, 0x46, 0x79, 0x92, 0x80, 0x0C, 0x61, 0xDC, 0x11, 0x36, 0x11, 0x6D, 0x54, 0x31, 0x0D, 0xE9,
-    0xD9, 0x5F, 0xDD, 0xEB, 0xC9, 0xEE, 0xC8, 0xE5, 0x3F, 0x54, 0x13, 0xAA, 0x30, 0xB6, 0x86, 0x63,
-    0xC0, 0x9F, 0x59, 0x4A, 0x72, 0xB5, 0x5F, 0x09, 0xE2, 0x61, 0x9A, 0x5E, 0xBB, 0xD5, 0x28, 0xD6,
-    0x84, 0xFE, 0xB3, 0x09, 0x40, 0xE7, 0x4C, 0xCF, 0xA2, 0x88, 0xB5, 0x3B, 0xC3, 0x7B, 0xD8, 0x67,
-    0x96, 0x0E, 0x21, 0xF1, 0x9E, 0xBF, 0x9F, 0xBF, 0x3C, 0xDD, 0xB3, 0xDA, 0xDE, 0xE3, 0x4D, 0x74,
-    0x16, 0x0E, 0x6C, 0x80, 0x8E, 0x3F, 0xDD, 0x33, 0x4C, 0xF7, 0x38, 0x1D, 0xA1, 0x12, 0x44, 0xE0,
-    0xA7, 0xB0, 0x39, 0x4B, 0x59, 0x46, 0x8F, 0x35, 0x20, 0x4A, 0x5F, 0xD9, 0x9F, 0x08, 0xB6, 0x5B,
-    0x8E, 0x36, 0x24, 0xA6, 0x8E, 0x60, 0x22, 0xBC, 0xA1, 0x98, 0xB8, 0xE5, 0xCE, 0xDD, 0xC4, 0x05,
-    0x50, 0xC3, 0x22, 0xA9, 0x99, 0x2E, 0x05, 0x08, 0x86, 0xF1, 0x08, 0xFD, 0xFE, 0x47, 0xAB, 0x91,
-    0x80, 0xE4, 0x12, 0x67, 0x01, 0x71, 0xAE, 0xAF, 0xF4, 0x89, 0x52, 0x4D, 0x69, 0xF2, 0xAB, 0xE2,
-    0x75, 0xBD, 0xA5, 0x09, 0x72, 0x7F, 0x48, 0x22, 0x19, 0x13, 0x66, 0xC6, 0xB2, 0xC5, 0xD2, 0xB2,
-    0x8D, 0x81, 0xDA, 0xB0, 0xAC, 0xB4, 0x09, 0x44, 0xDF, 0x67, 0xE5, 0xA4, 0x41, 0x46, 0x59, 0x7B,
-    0x14, 0x0A, 0x64, 0x2E, 0x13, 0xCC, 0xA1, 0xEF, 0x08, 0x9A, 0x7D, 0x87, 0x4F, 0x07, 0x9F, 0x0A,
-    0x0D, 0xD7, 0x74, 0x66, 0x22, 0x80, 0xBE, 0x27, 0x5C, 0xFD, 0x5C, 0x2E, 0x37, 0x04, 0x27, 0x5E,
-    0x2F, 0x88, 0x77, 0x21, 0x09, 0x58, 0xE7, 0xC4, 0xB8, 0x48, 0x6B, 0xA3, 0xC8, 0x64, 0x6A, 0x4A,
-    0x1B, 0x58, 0x81, 0x10, 0xA6, 0x25, 0x4C, 0xF3, 0x5D, 0x9E, 0xDE, 0x71, 0x26, 0x10, 0x1F, 0x11,
-    0x23, 0x08, 0x48, 0x14, 0x5D, 0x88, 0xC8, 0xD9, 0x46, 0x47, 0xA2, 0x0A, 0xA3, 0xBE, 0x84, 0x29,
-    0x87, 0x8D, 0xD6, 0x44, 0x39, 0x50, 0xF3, 0xB3, 0xB8, 0xDD, 0xAF, 0x71, 0x3B, 0x7A, 0x2D, 0x24,
-    0x74, 0xC4, 0xE3, 0x9B, 0x35, 0x71, 0xE9, 0x4B, 0x84, 0xD7, 0xC4, 0x79, 0x8D, 0x40, 0x35, 0xBE,
-    0x4B, 0xDB, 0x8F, 0x1A, 0x11, 0x70, 0x71, 0xD3, 0x4A, 0x9D, 0x56, 0x0B, 0x20, 0x40, 0x9A, 0x6C,
-    0x05, 0xA4, 0x20, 0xFD, 0x5E, 0xAF, 0x66, 0xD2, 0x97, 0xF6, 0x6A, 0x69, 0xD8, 0xE8, 0xF4, 0x2C,
-    0x6E, 0x58, 0x73, 0xE5, 0x37, 0x7C, 0xAF, 0x57, 0x01, 0xAA, 0x1B, 0x5A, 0x9E, 0x45, 0x54, 0x32,
-    0x29, 0x95, 0x26, 0x96, 0xE4, 0x94, 0x9B, 0x19, 0xDF, 0x93, 0xD4, 0x1C, 0xD0, 0x3E, 0x5A, 0xE9,
-    0x96, 0xB2, 0x19, 0x26, 0xC1, 0x15, 0x9B, 0x46, 0x78, 0xE3, 0x8A, 0x15, 0x07, 0x72, 0xF6, 0x94,
-    0x4A, 0x32, 0x91, 0xD7, 0x39, 0x1F, 0xD1, 0xF4, 0x79, 0x98, 0x29, 0xE3, 0xBB, 0x81, 0xB9, 0x84,
-    0xCD, 0x9E, 0xE0, 0x3C, 0x00, 0xD7, 0x61, 0x2F, 0xB8, 0x99, 0x78, 0x9D, 0x3C, 0x58, 0xE9, 0xB6,
-    0x28, 0x06, 0xDE, 0xC2, 0xE3, 0x92, 0x2D, 0x69, 0xF4, 0xA8, 0x22, 0x66, 0x88, 0x1F, 0x36, 0x12,
-    0x66, 0xDF, 0x6B, 0xD9, 0xF5, 0x25, 0xCF, 0x77, 0x04, 0x25, 0x09, 0x5A, 0x46, 0x19, 0x07, 0xAC,
-    0x7D, 0x89, 0x0E, 0x13, 0x48, 0xAB, 0x6A, 0xBE, 0x57, 0x0B, 0x63, 0x0F, 0x2A, 0xE1, 0xEB, 0xDD,
-    0x52, 0x86, 0x22, 0xA7, 0xF2, 0x16, 0x90, 0x91, 0x4E, 0xF0, 0x0A, 0x1F, 0x25, 0x48, 0x62, 0x6D,
-    0xA3, 0xCF, 0xE7, 0xCE, 0x2E, 0x9B, 0x32, 0x2C, 0x2F, 0xA2, 0x39, 0xA6, 0x61, 0x14, 0xCD, 0x71,
-    0x8E, 0x23, 0xB2, 0x4F, 0x96, 0xB3, 0xAE, 0x17, 0x52, 0x43, 0x88, 0x15, 0x51, 0x01, 0x68, 0xE2,
-    0xA8, 0x61, 0x8D, 0x49, 0x1E, 0x48, 0xB3, 0xC2, 0x13, 0x5E, 0x4F, 0xA3, 0x47, 0x9F, 0xD2, 0xCE,
-    0xE6, 0xFB, 0x34, 0xED, 0x20, 0xC0, 0x57, 0xEE, 0x33, 0x74, 0x4B, 0xAF, 0x97, 0x38, 0xAD, 0xD8,
-    0xD7, 0x8C, 0xEC, 0xA6, 0x80, 0xA5, 0x74, 0xFB, 0x7B, 0x32, 0x8A, 0x60, 0x50, 0x27, 0xCE, 0x53,
-    0x2F, 0x14, 0x23, 0xA9, 0xC3, 0x2D, 0x4A, 0x51, 0x28, 0xB5, 0x7B, 0x54, 0x32, 0x63, 0x93, 0x43,
-    0x38, 0x4D, 0xDB, 0x16, 0x74, 0x32, 0x74, 0x92, 0xEC, 0x6C, 0xE2, 0x12, 0xDE, 0x9C, 0xFC, 0x33,
-    0x8A, 0xBE, 0x66, 0x40, 0x1B, 0x56, 0x92, 0xFF, 0x47, 0x0E, 0xE6, 0x29, 0xD6, 0x20, 0xDF, 0x61,
-    0xAF, 0xE4, 0xE4, 0x15, 0xC1, 0xF2, 0x54, 0x86, 0xF2, 0x46, 0x29, 0x5E, 0x81, 0x4B, 0x21, 0x0C,
-    0x9E, 0xB8, 0x11, 0x37, 0x8F, 0x1A, 0x87, 0xF4, 0x1B, 0x09, 0x73, 0xBE, 0xB9, 0x76, 0x32, 0x73,
-    0x69, 0xA1, 0x70, 0xD1, 0xB0, 0x76, 0x21, 0xC2, 0x37, 0xDC, 0x5D, 0xB8, 0xA4, 0x90, 0xB9, 0x92,
-    0x3D, 0xE5, 0x44, 0xA0, 0x55, 0xF6, 0x4D, 0xA8, 0x93, 0x8C, 0xC6, 0x68, 0xB8, 0x4C, 0xA3, 0xF8,
-    0xD6, 0xA1, 0x13, 0x49, 0x0E, 0xB8, 0xE8, 0xD2, 0x83, 0xE7, 0xBE, 0x29, 0xED, 0x20, 0x58, 0x60,
-    0x1F, 0x4F, 0xDC, 0x8F, 0x3F, 0x3E, 0x63, 0x1F, 0x7A, 0xAC, 0x2F, 0x20, 0x0C, 0x4F, 0x12, 0xBE,
-    0x00, 0x9C, 0xAB, 0xFB, 0x79, 0xC1, 0x2E, 0x5D, 0xD6, 0x9D, 0x9A, 0xE8, 0x95, 0x72, 0x3A, 0x95,
-    0x49, 0xA6, 0xAB, 0xE5, 0xA2, 0x57, 0xD5, 0x13, 0x15, 0x27, 0x32, 0xA6, 0x93, 0x96, 0xD5, 0xFC,
-    0x80, 0xDD, 0x00, 0xC3, 0x49, 0x65, 0x34, 0x6D, 0x58, 0x33, 0x9A, 0x57, 0x4C, 0x25, 0x71, 0x19,
-    0xC8, 0x6C, 0x8E, 0x56, 0x86, 0x98, 0xB9, 0x66, 0x5D, 0x79, 0x09, 0x4F, 0x85, 0xBD, 0xDA, 0xB6,
-    0xF9, 0xE0, 0x61, 0x4C, 0xC9, 0x24, 0x7A, 0x1A, 0x76, 0x35, 0x49, 0xBA, 0x42, 0x40, 0x1A, 0xE5,
-    0x31, 0x0F, 0xFC, 0x65, 0x20, 0xBD, 0x32, 0xE4, 0x8B, 0xA5, 0x99, 0xA2, 0x2A, 0xA8, 0x88, 0xAC,
-    0x75, 0x1D, 0x31, 0xBC, 0xE7, 0x6B, 0xF4, 0x45, 0xB0, 0x11, 0xA2, 0x51, 0x7A, 0x1B, 0x79, 0xA0,
-    0x26, 0x42, 0xD3, 0x1F, 0x86, 0x5D, 0x48, 0xC1, 0x13, 0x3E, 0xC2, 0x85, 0xD8, 0xE3, 0x5A, 0x62,
-    0x0B, 0x6B, 0x8E, 0x8A, 0xA3, 0xF5, 0x0C, 0xCA, 0xDF, 0xDB, 0x25, 0x18, 0xDE, 0x85, 0x70, 0xBB,
-    0xCF, 0x82, 0xCB, 0xD7, 0xCF, 0x65, 0xF5, 0xB3, 0x84, 0xFE, 0x5B, 0xB2, 0x7A, 0x7E, 0x21, 0xAB,
-    0x33, 0x97, 0x4A, 0xA7, 0xA5, 0x79, 0x40, 0xFC, 0x07, 0x1C, 0xFF, 0xE4, 0x88, 0x7A, 0x86, 0x4F,
-    0x96, 0xBA, 0x7A, 0xE6, 0x66, 0x4B, 0x91, 0xC4, 0x2B, 0xE9, 0x1D, 0x4E, 0x63, 0xB4, 0x44, 0x82,
-    0x95, 0x24, 0x3B, 0x26, 0x08, 0x84, 0x2A, 0x7D, 0x41, 0x5C, 0xC8, 0x6F, 0xCE, 0xA0, 0x53, 0x50,
-    0xD3, 0x71, 0x42, 0xF1, 0xA2, 0x48, 0x9C, 0x28, 0x96, 0x60, 0x36, 0xE2, 0x9C, 0x74, 0xF8, 0x93,
-    0x7D, 0x69, 0xC2, 0x19, 0x4E, 0xCE, 0x46, 0x4E, 0xD5, 0x28, 0x21, 0x21, 0xFB, 0x9B, 0x32, 0xB2,
-    0x5D, 0x74, 0x22, 0xFC, 0xB4, 0xB4, 0xB2, 0x1B, 0xA1, 0xE0, 0xC8, 0xEC, 0xEB, 0xF0, 0x1D, 0x01,
-    0x22, 0xD5, 0x11, 0x0B, 0x4B, 0x5A, 0xCA, 0xBD, 0x2B, 0xA6, 0x9C, 0xBD, 0xAD, 0x24, 0xD3, 0xAD,
-    0x44, 0x35, 0x0B, 0xE9, 0xFA, 0x17, 0xA2, 0x0D, 0x23, 0x43, 0x24, 0x23, 0xB1, 0x66, 0x0E, 0xC5,
-    0x07, 0xC5, 0xD0, 0xD2, 0xB2, 0x8B, 0x1F, 0x4F, 0x6A, 0xDB, 0x84, 0x57, 0xC3, 0x01, 0xB8, 0xFD,
-    0x25, 0x61, 0x37, 0x94, 0x34, 0xC0, 0xB3, 0x90, 0x5B, 0x7C, 0x71, 0x36, 0xF8, 0xBF, 0x4E, 0x7D,
-    0xC9, 0x96, 0x81, 0xC4, 0x14, 0x12, 0x91, 0xA0, 0xE7, 0x44, 0xB8, 0x42, 0x03, 0x6F, 0x4B, 0x68,
-    0x08, 0x27, 0x0E, 0x57, 0x64, 0x2D, 0x29, 0xE3, 0x87, 0x15, 0x1B, 0x6C, 0x64, 0xC7, 0x43, 0x07,
-    0x4E, 0x4C, 0x58, 0xC7, 0xE4, 0x3C, 0xAC, 0x16, 0x6E, 0x1C, 0xD9, 0x07, 0xF5, 0x9E, 0x60, 0xA1,
-    0xD4, 0xC8, 0xCC, 0x90, 0xFD, 0x0E, 0x0D, 0xBD, 0x3C, 0x04, 0xEB, 0xB4, 0xF0, 0xA3, 0x32, 0xF8,
-    0x8C, 0x5C, 0xAE, 0xB1, 0x22, 0x05, 0x45, 0x93, 0x27, 0xED, 0x23, 0x27, 0x35, 0x22, 0x04, 0x42,
-    0xD2, 0x13, 0x85, 0x9A, 0xB3, 0xC6, 0x67, 0x1A, 0x93, 0xDB, 0x0E, 0x3D, 0x1F, 0x6D, 0x6E, 0xF0,
-    0x44, 0xD2, 0xCA, 0x34, 0x40, 0x97, 0x52, 0x12, 0x4D, 0x2A, 0xBE, 0x53, 0xB8, 0xDC, 0xD3, 0x73,
-    0x08, 0x08, 0x15, 0x8B, 0x9A, 0x82, 0xCF, 0x44, 0x37, 0x91, 0xAB, 0xA8, 0xB1, 0xCB, 0x3E, 0x32,
-    0xDD, 0x40, 0x1C, 0xCB, 0xF8, 0xD3, 0x48, 0xD6, 0xF2, 0x1B, 0x57, 0xBA, 0x9F, 0x13, 0x17, 0x6D,
-    0xC5, 0x3F, 0x93, 0x9C, 0x9E, 0x44, 0x2B, 0x55, 0xCA, 0xE9, 0x44, 0x46, 0x0E, 0x86, 0xE9, 0x32,
-    0x45, 0x1E, 0x0D, 0x91, 0xFD, 0x98, 0xC5, 0x0B, 0xF2, 0xF4, 0xBE, 0xED, 0xE0, 0x86, 0xE0, 0x0B,
-    0x22, 0x14, 0x93, 0xD5, 0xF1, 0x8C, 0xE6, 0x7E, 0x85, 0xC7, 0xC6, 0x84, 0xAD, 0x3F, 0x44, 0x5D,
-    0xCB, 0x10, 0xB6, 0xA1, 0xF4, 0xE6, 0x55, 0x42, 0x03, 0x49, 0x1B, 0x71, 0xBF, 0x6D, 0x28, 0x5C,
-    0xB3, 0xBA, 0x52, 0x9B, 0x60, 0x70, 0xC0, 0x53, 0x94, 0x21, 0xA1, 0xE3, 0xFA, 0x8C, 0xC2, 0xE5,
-    0xF2, 0x61, 0x82, 0xEF, 0x83, 0x60, 0x40, 0xB5, 0x3E, 0x3A, 0x1A, 0xD9, 0x09, 0xB3, 0x90, 0x21,
-    0x97, 0x88, 0x5D, 0xEF, 0x4A, 0xE2, 0x13, 0xDC, 0xE2, 0xA0, 0xC3, 0x66, 0xA0, 0x25, 0xCB, 0x49,
-    0x48, 0x4A, 0x4F, 0xE9, 0x40, 0x44, 0xEE, 0xBA, 0xC4, 0x7F, 0x64, 0x0D, 0x6A, 0x20, 0xBE, 0xDF,
-    0x24, 0x4C, 0x57, 0xE6, 0x93, 0xA3, 0x7B, 0x15, 0x97, 0x28, 0xA5, 0x57, 0x98, 0x6C, 0x02, 0x1E,
-    0xE0, 0x2D, 0xAE, 0x4C, 0xCA, 0xE8, 0x75, 0xCF, 0x8D, 0x37, 0x97, 0x6E, 0x08, 0xDB, 0xC9, 0x00,
-    0xE1, 0xDC, 0xE5, 0x43, 0x37, 0x2B, 0x9D, 0x2E, 0x4B, 0xAD, 0x95, 0xCB, 0xB2, 0x11, 0xB0, 0xBD,
-    0xDC, 0xCB, 0x65, 0x57, 0x83, 0xC5, 0x3D, 0x8C, 0x4B, 0xC3, 0xDF, 0x11, 0x72, 0x6E, 0x6B, 0x01,
-    0x00, 0x46, 0x32, 0xC7, 0x81, 0xDC, 0x4B, 0x1A, 0x87, 0xDB, 0x4F, 0x7B, 0xEE, 0x79, 0xF7, 0x09,
-    0x04, 0x3D, 0xB7, 0x02, 0x49, 0xB7, 0xF2, 0x29, 0x74, 0x9F, 0xB4, 0x9B, 0x48, 0x39, 0x21, 0xE4,
-    0x72, 0x27, 0x74, 0xA7, 0x95, 0x5D, 0xD9, 0x97, 0x99, 0xD2, 0xC1, 0x85, 0xCB, 0x6E, 0x9C, 0x4D,
-    0x3E, 0xA6, 0xCB, 0x4B, 0x17, 0x75, 0x67, 0xE2, 0xEA, 0x2F, 0x68, 0xE3, 0x9C, 0x10, 0x92, 0x9C,
-    0x38, 0xF5, 0x64, 0x6D, 0x61, 0x0C, 0xCC, 0x40, 0xE4, 0x90, 0x60, 0x0C, 0xCF, 0x76, 0x71, 0xCE,
-    0xAD, 0x0A, 0xCE, 0x05, 0x38, 0x4F, 0x88, 0x11, 0x80, 0x90, 0xA4, 0x07, 0xB9, 0xE5, 0x4D, 0x90,
-    0x9B, 0xE3, 0x45, 0xF5, 0x1F, 0xCB, 0x94, 0xC2, 0x6B, 0xE2, 0x4A, 0x97, 0xF8, 0x97, 0x27, 0xEA,
-    0x92, 0xA3, 0x9D, 0xD5, 0xF7, 0x11, 0xEE, 0xC7, 0x2A, 0x7E, 0x5C, 0x34, 0x3E, 0x87, 0x5E, 0x28,
-    0xDD, 0x25, 0x21, 0x14, 0xF2, 0x49, 0x9C, 0x6B, 0x48, 0x46, 0xBC, 0x09, 0xDF, 0x0C, 0x1B, 0x64,
-    0x95, 0x11, 0x4E, 0xA6, 0xEB, 0xA8, 0x0E, 0x57, 0x57, 0x0A, 0xFF, 0xB3, 0x77, 0xDE, 0x1D, 0xFB,
-    0x59, 0x6F, 0x6C, 0x60, 0x51, 0xEE, 0x4C, 0xEE, 0xC9, 0x8E, 0xD9, 0x0E, 0xFE, 0xB8, 0x37, 0x62,
-    0x86, 0x09, 0x60, 0x52, 0x4E, 0x8A, 0xE6, 0xB5, 0xD3, 0x36, 0x81, 0x9C, 0xBC, 0x63, 0xD3, 0xF0,
-    0x67, 0xB6, 0xF1, 0x3F, 0x7D, 0x32, 0xAA, 0xA1, 0xD1, 0xE5, 0x0C, 0x9E, 0x13, 0x37, 0x5E, 0x8F,
-    0x50, 0xC8, 0x7C, 0x66, 0x5C, 0xCE, 0xDC, 0x0C, 0x34, 0x8A, 0x00, 0xE8, 0x91, 0xF8, 0x56, 0x02,
-    0x2D, 0x3A, 0x3C, 0x5C, 0xDC, 0xCD, 0x52, 0x88, 0x94, 0xC6, 0xF7, 0x46, 0xB5, 0x1D, 0xB9, 0x7A,
-    0x1C, 0xC3, 0xF6, 0xC1, 0x09, 0x42, 0xC5, 0xA3, 0x3A, 0x3B, 0x59, 0xCA, 0x48, 0x35, 0x00, 0xDF,
-    0x8C, 0x82, 0xB5, 0xC4, 0xFE, 0x1B, 0x8D, 0xD7, 0xD8, 0x1F, 0xB4, 0xC8, 0x73, 0xDC, 0x02, 0x73,
-    0xE5, 0x8E, 0x2C, 0x73, 0x6F, 0x28, 0x90, 0xB8, 0x5A, 0x6D, 0x32, 0xA2, 0x00, 0xF6, 0xDC, 0x35,
-    0x01, 0xCC, 0xB7, 0xD9, 0x2F, 0xA5, 0x13, 0x56, 0xD1, 0xE3, 0xA2, 0xC6, 0x39, 0x4E, 0x5D, 0x9C,
-    0xAA, 0xD4, 0x05, 0x55, 0xCD, 0xFE, 0xD7, 0xAA, 0x12, 0xFD, 0xA3, 0xA2, 0xA0, 0x87, 0x28, 0x57,
-    0xB4, 0xDF, 0x52, 0xAD, 0xE2, 0x3C, 0x79, 0xBB, 0x89, 0x1A, 0x13, 0xF6, 0xE1, 0xE9, 0xC8, 0xE6,
-    0x80, 0x86, 0x5F, 0x49, 0xA7, 0xF7, 0x8D, 0x4C, 0x25, 0x2F, 0x8C, 0xFB, 0xB5, 0x46, 0x0D, 0xE5,
-    0xE8, 0x71, 0xC2, 0x63, 0xDE, 0x86, 0xCE, 0x34, 0x9A, 0xC5, 0xAD, 0x4B, 0xE1, 0xFC, 0x9A, 0x72,
-    0xBB, 0x39, 0x13, 0xD2, 0x72, 0x99, 0xCE, 0x65, 0x89, 0xAB, 0xD6, 0x6D, 0x20, 0xF0, 0xF8, 0xF2,
-    0xC9, 0xB7, 0xD5, 0x64, 0x1D, 0xB7, 0xED, 0x30, 0x35, 0xEB, 0xEE, 0x28, 0xA5, 0x64, 0x1A, 0x07,
-    0xBA, 0x3A, 0x31, 0x1D, 0x25, 0xA0, 0xA5, 0xD6, 0x4A, 0x2D, 0xDA, 0x2C, 0xF2, 0xA5, 0xA5, 0xA6,
-    0x31, 0x92, 0x1C, 0x65, 0x91, 0x3D, 0x21, 0x9C, 0x1D, 0x4B, 0x75, 0x92, 0x1C, 0x7B, 0xF5, 0x87,
-    0xE7, 0x31, 0x90, 0xE0, 0x29, 0xC9, 0x18, 0x26, 0x1D, 0xEE, 0x72, 0x2A, 0x22, 0x81, 0x72, 0xC0,
-    0x50, 0xC1, 0x47, 0x5F, 0xF0, 0xB7, 0x4E, 0x59, 0x8D, 0xE9, 0x18, 0xD2, 0x12, 0x4F, 0x6D, 0x99,
-    0x13, 0x62, 0x79, 0x96, 0x07, 0x65, 0x88, 0x22, 0xA3, 0x94, 0xEC, 0x63, 0x64, 0x5D, 0x5D, 0xA1,
-    0x4D, 0x0A, 0x65, 0x62, 0xB2, 0x22, 0xF3, 0xC8, 0x9B, 0xC0, 0xAE, 0x40, 0x08, 0x05, 0x6C, 0xFF,
-    0x09, 0x6E, 0x88, 0x64, 0xCA, 0x72, 0xF9, 0x88, 0xAA, 0x7D, 0x4A, 0x39, 0x47, 0x8E, 0xED, 0x97,
-    0x06, 0xEA, 0x5F, 0x70, 0x91, 0x0C, 0x41, 0x67, 0x46, 0xA5, 0xE3, 0xE3, 0x06, 0xB5, 0x0A, 0x1E,
-    0x70, 0x1F, 0xC6, 0x3C, 0x46, 0x7A, 0x29, 0x4A, 0x38, 0x08, 0xE7, 0x4A, 0x68, 0xDC, 0x73, 0x86,
-    0x26, 0x52, 0x27, 0x1A, 0x17, 0x60, 0x0E, 0xD0, 0x9B, 0x5D, 0x01, 0xEC, 0x78, 0xE7, 0x5D, 0x00,
-    0xD0, 0x7E, 0x85, 0x85, 0x63, 0x01, 0xF5, 0x32, 0x42, 0xF5, 0xA4, 0xC0, 0x57, 0x41, 0x3F, 0x69,
-    0x76, 0xC2, 0x86, 0xA5, 0x19, 0xBC, 0x57, 0x4B, 0x81, 0x23, 0x3E, 0x47, 0x59, 0x02, 0x3D, 0x64,
-    0xDE, 0x95, 0x00, 0x62, 0x7F, 0xC3, 0x7C, 0x0B, 0xFE, 0x6B, 0xBA, 0x60, 0x98, 0x42, 0xFB, 0xD2,
-    0x54, 0x02, 0x64, 0xB7, 0xA2, 0x3F, 0x9B, 0x06, 0x5E, 0x78, 0xDD, 0x90, 0xB6, 0x1A, 0xD4, 0x5F,
-    0x2D, 0x9D, 0x90, 0xE2, 0xEC, 0x87, 0x93, 0xE7, 0xC4, 0xE7, 0x4F, 0xAE, 0xCE, 0xC5, 0x33, 0xB5,
-    0x20, 0x5D, 0x76, 0x3F, 0x6D, 0x4C, 0x91, 0xD1, 0xE9, 0xC2, 0x25, 0x8E, 0xA4, 0xFE, 0xA1, 0x95,
-    0xBE, 0x4A, 0xFC, 0xF4, 0xB2, 0x4C, 0x8D, 0x9E, 0xE2, 0xDC, 0x96, 0x1A, 0xCE, 0x9D, 0xDB, 0xF0,
-    0x09, 0x33, 0x91, 0x5C, 0x4C, 0x56, 0x5B, 0x26, 0x9D, 0xEA, 0xD0, 0x4C, 0x9E, 0xD6, 0x2B, 0xCF,
-    0xA6, 0x87, 0x40, 0x1D, 0xCB, 0xA0, 0xF3, 0xBA, 0x00, 0xB9, 0x21, 0xAC, 0xB2, 0x9C, 0xB3, 0x00,
-    0x0E, 0xDE, 0xE3, 0x47, 0xC0, 0x95, 0x6F, 0x00, 0xC0, 0xBE, 0x00, 0x50, 0x86, 0xDA, 0x8F, 0x9C,
-    0x80, 0x54, 0xA1, 0xED, 0xA1, 0xDB, 0x8D, 0xB8, 0xA5, 0x9E, 0x42, 0x6C, 0xDB, 0x56, 0xA6, 0x8F,
-    0x71, 0x19, 0xD6, 0x7E, 0x2B, 0x50, 0x09, 0xF6, 0x46, 0x86, 0xC4, 0xC7, 0x99, 0x78, 0x92, 0x7C,
-    0x5C, 0x80, 0x8F, 0xF8, 0x9F, 0x5E, 0xF8, 0xF5, 0x07, 0xB6, 0xCD, 0x5A, 0x68, 0x6A, 0xAB, 0xEF,
-    0x1B, 0xC0, 0xBE, 0x80, 0x18, 0x59, 0x97, 0x58, 0x10, 0x7B, 0xAA, 0xCB, 0x8A, 0xF8, 0xB8, 0xF6,
-    0x1E, 0xB7, 0x66, 0x16, 0xD6, 0xDE, 0xE7, 0xD5, 0xEC, 0x7E, 0x54, 0xF9, 0xA7, 0xA9, 0x61, 0xEA,
-    0x45, 0x98, 0x22, 0x80, 0xB9, 0x81, 0x95, 0xC6, 0xEC, 0xC9, 0x2C, 0xC9, 0x37, 0xC4, 0xE7, 0xF0,
-    0x42, 0x19, 0xB3, 0xA1, 0x05, 0x6A, 0xB9, 0x2A, 0x0B, 0xFB, 0xE1, 0x15, 0xDA, 0x5F, 0x2D, 0x77,
-    0x35, 0x95, 0x35, 0x02, 0x72, 0xC0, 0x84, 0xB6, 0x96, 0x19, 0x69, 0x91, 0x9E, 0xEF, 0xFB, 0xF6,
-    0xEB, 0x08, 0x80, 0xF9, 0x8E, 0x6D, 0x77, 0x16, 0x89, 0xAC, 0xAD, 0xD3, 0xF0, 0x7D, 0x20, 0x71,
-    0xFD, 0x16, 0x9E, 0xB7, 0xB9, 0x2C, 0xB9, 0x40, 0xDB, 0x0B, 0xDA, 0x05, 0x71, 0x7D, 0x2B, 0x2B,
-    0x79, 0x9D, 0x78, 0xC5, 0x77, 0xF1, 0x2D, 0x41, 0xB8, 0x70, 0x01, 0x34, 0xB2, 0x9D, 0xDB, 0x36,
-    0xBB, 0xB4, 0xD9, 0x38, 0x66, 0x74, 0x01, 0x1A, 0x8D, 0x2F, 0xB2, 0xF5, 0xE3, 0x1E, 0xE1, 0x00,
-    0x57, 0x59, 0xC3, 0x26, 0x6B, 0xD8, 0x63, 0x85, 0xEA, 0x3F, 0x70, 0x36, 0xBA, 0x86, 0xE5, 0x01,
-    0xDD, 0xDB, 0x35, 0x10, 0x06, 0x92, 0x4F, 0x69, 0xCA, 0x02, 0x00, 0xA2, 0x77, 0xFB, 0x0A, 0xD7,
-    0xB7, 0x73, 0xD1, 0x2A, 0x69, 0x00, 0x49, 0x70, 0xFE, 0x95, 0x9F, 0x9F, 0xE2, 0xE2, 0x7B, 0xC8,
-    0xDD, 0xE1, 0x7F, 0x21, 0xDF, 0x46, 0xDC, 0x90, 0x8C, 0xD9, 0xB7, 0x00, 0x40, 0xC8, 0x1E, 0x50,
-    0x4F, 0x18, 0xC9, 0x18, 0xD8, 0x38, 0xF0, 0x8C, 0xD2, 0x1F, 0x4A, 0x2B, 0x72, 0xB7, 0x50, 0xB2,
-    0x4B, 0xA2, 0x9E, 0x80, 0xBA, 0xD7, 0x5E, 0xDF, 0xCC, 0x71, 0xB6, 0x88, 0x5F, 0x30, 0x5A, 0x72,
-    0x92, 0x4E, 0x48, 0x66, 0x3E, 0x4F, 0xB7, 0x29, 0xE3, 0xBB, 0x75, 0x60, 0xC7, 0x26, 0x38, 0xD9,
-    0x87, 0x38, 0xDE, 0x08, 0x15, 0x68, 0xF9, 0xAD, 0xC7, 0xA1, 0xE2, 0xB0, 0x1D, 0x15, 0x11, 0x2B,
-    0x43, 0xD9, 0x19, 0x07, 0xF0, 0x39, 0x14, 0x58, 0xA1, 0x00, 0xB6, 0x51, 0x93, 0x1C, 0x78, 0x63,
-    0xA6, 0xA1, 0x08, 0x98, 0x6D, 0x04, 0xF5, 0xEB, 0xDB, 0x12, 0x75, 0xDE, 0xF9, 0xA3, 0x31, 0x15,
-    0x58, 0xBC, 0x33, 0xFF, 0xB6, 0x8B, 0xC3, 0x7C, 0xC8, 0x7A, 0xF3, 0xC1, 0xAB, 0x7F, 0x37, 0xA8,
-    0xC7, 0x8F, 0xF3, 0xE4, 0x40, 0x79, 0xA7, 0x29, 0x47, 0xEB, 0x8C, 0x31, 0x60, 0x21, 0x16, 0xEB,
-    0xB5, 0x9A, 0x50, 0x3A, 0x3D, 0x5D, 0x26, 0xDB, 0x9B, 0x74, 0xCA, 0x1C, 0x5D, 0x86, 0xE8, 0x3D,
-    0x3E, 0x5A, 0xA0, 0x52, 0xF1, 0x0E, 0xEE, 0xC0, 0x22, 0x48, 0x10, 0x1A, 0x04, 0x74, 0x9C, 0x8A,
-    0xE3, 0xFE, 0xF5, 0xEF, 0xA8, 0xE4, 0xFB, 0x65, 0xF8, 0xF6, 0xF8, 0x62, 0x9D, 0xB1, 0x43, 0xA8,
-    0x24, 0xCB, 0x7B, 0x82, 0x7E, 0x66, 0x12, 0x9F, 0x4B, 0xF5, 0xFB, 0xD6, 0x22, 0x81, 0x23, 0x7B,
-    0x63, 0x81, 0xC0, 0x0D, 0x82, 0x6B, 0x62, 0x0B, 0x18, 0x3D, 0x96, 0xFF, 0x58, 0x5B, 0xA7, 0xCF,
-    0xEA, 0xE7, 0x3A, 0x7D, 0xDC, 0x68, 0xD4, 0x98, 0x41, 0x6D, 0xDC, 0x7B, 0x1F, 0x85, 0x0C, 0xC1,
-    0xE8, 0xF5, 0x3B, 0x19, 0x1F, 0x62, 0x9E, 0x99, 0xDE, 0x24, 0x28, 0xC4, 0x4F, 0x57, 0xDB, 0x37,
-    0x46, 0x0A, 0x87, 0xC8, 0xF0, 0xA0, 0x85, 0xFA, 0x49, 0x75, 0xA7, 0x8B, 0x1E, 0xC5, 0xE1, 0xE3,
-    0x7E, 0x01, 0x70, 0x5D, 0xDA, 0x52, 0x77, 0x80, 0x8E, 0x97, 0x36, 0x1B, 0x40, 0x97, 0xE1, 0xEE,
-    0x6F, 0x58, 0xB8, 0xFF, 0x6D, 0xD0, 0x13, 0xDF, 0xA7, 0x4F, 0x22, 0xEE, 0x10, 0x84, 0x3E, 0xF3,
-    0x15, 0x4B, 0xE5, 0x01, 0x98, 0xE5, 0x1E, 0x1E, 0xB4, 0xAC, 0x01, 0x61, 0xA2, 0x47, 0x39, 0xB5,
-    0xE2, 0xF6, 0x5E, 0x99, 0xB1, 0xC2, 0xFC, 0x5C, 0x86, 0xBA, 0x74, 0x99, 0xC3, 0xFA, 0xE4, 0xA7,
-    0x28, 0xF8, 0x55, 0xD0, 0xDD, 0xAE, 0x65, 0x67, 0x8E, 0x9B, 0xC5, 0x3A, 0x47, 0x48, 0x83, 0x34,
-    0xFE, 0x35, 0x7E, 0xE3, 0x31, 0xF1, 0x71, 0x3D, 0x9B, 0xEE, 0x61, 0xC5, 0xA2, 0x86, 0x8F, 0x35,
-    0x7B, 0x1D, 0xC0, 0xD7, 0x52, 0x6B, 0xA8, 0x24, 0x89, 0xA3, 0x07, 0x95, 0x0A, 0x1F, 0xDE, 0x41,
-    0x33, 0xE1, 0x9D, 0x96, 0x0B, 0xCE, 0xF4, 0xCA, 0x44, 0x26, 0x8F, 0xB4, 0x58, 0x50, 0xAA, 0x2F,
-    0xEC, 0x8C, 0x65, 0xA9, 0x37, 0xA0, 0x9F, 0x89, 0x86, 0xE0, 0xB8, 0xD6, 0xFF, 0x01, 0xB3, 0xF2,
-    0x67, 0x09, 0x2D, 0x07, 0x90, 0x4F, 0x64, 0xDF, 0xB9, 0x9C, 0x76, 0xA1, 0xDD, 0x04, 0xC3, 0x4D,
-    0x02, 0xC0, 0x77, 0xF8, 0x88, 0x29, 0xF7, 0x25, 0xF8, 0xE7, 0x0C, 0x74, 0xFF, 0xB4, 0x0F, 0x9E,
-    0xB4, 0x06, 0x50, 0xA3, 0x01, 0x7A, 0x1E, 0xD3, 0x4B, 0xE7, 0x36, 0x13, 0xA0, 0x7D, 0xFE, 0x12,
-    0x67, 0x54, 0xB7, 0x65, 0x03, 0x83, 0xBA, 0x65, 0xE3, 0x44, 0xAF, 0x39, 0x98, 0x9A, 0xBA, 0x43,
-    0x42, 0xCE, 0x85, 0x60, 0x51, 0x81, 0x8E, 0x44, 0x86, 0x46, 0x7E, 0x55, 0xC1, 0xCE, 0xE8, 0x26,
-    0xFB, 0xA6, 0x9B, 0xF7, 0x99, 0x42, 0xB7, 0xDB, 0xAF, 0x66, 0x3B, 0x1B, 0xED, 0xA6, 0x5A, 0xF5,
-    0x3A, 0xFB, 0xDF, 0x62, 0xD3, 0xA8, 0xAB, 0x6F, 0x6E, 0x7F, 0xF8, 0x32, 0xA6, 0x07, 0x91, 0x6D,
-    0x7B, 0xB4, 0xA4, 0x5D, 0x0C, 0x14, 0xF8, 0xBB, 0x50, 0xDA, 0xA5, 0xCD, 0x70, 0x36, 0x98, 0x7E,
-    0x29, 0x62, 0x5C, 0xDA, 0xA7, 0x07, 0x23, 0x4C, 0x6F, 0xE9, 0x4A, 0x35, 0x99, 0x3D, 0x6D, 0x06,
-    0x6B, 0x9B, 0xFB, 0x37, 0xA8, 0x81, 0x29, 0x07, 0x40, 0x8F, 0xEC, 0xAE, 0x72, 0xFA, 0x1E, 0x38,
-    0x25, 0xC7, 0x4B, 0x09, 0x22, 0x57, 0xAF, 0xF9, 0x65, 0x26, 0x48, 0x17, 0x2E, 0x69, 0xE4, 0x27,
-    0x01, 0x12, 0x1B, 0x82, 0x75, 0x27, 0xB4, 0x76, 0x28, 0xAB, 0x81, 0xC4, 0xD9, 0xA9, 0x99, 0x30,
-    0xE1, 0x8F, 0xB9, 0xCC, 0x3B, 0x27, 0xB4, 0xB3, 0xE4, 0x3D, 0x58, 0x2B, 0xF5, 0xB6, 0x3F, 0xE1,
-    0x0A, 0x4B, 0xF9, 0x71, 0x0D, 0x5D, 0xCB, 0x9D, 0xF5, 0x99, 0x57, 0xE4, 0x67, 0x37, 0xEE, 0x2C,
-    0x1F, 0x48, 0xB6, 0x67, 0xF7, 0xDC, 0xCF, 0x29, 0x94, 0xEC, 0xD5, 0x51, 0x29, 0xFD, 0x86, 0x55,
-    0x2A, 0xB9, 0x15, 0xE8, 0x6E, 0x04, 0xB6, 0xF3, 0x94, 0x63, 0xC5, 0xB8, 0x5D, 0xE4, 0x41, 0x76,
-    0x15, 0x7B, 0xE1, 0x76, 0x7A, 0xE4, 0x8C, 0xD5, 0x7C, 0xF3, 0xFC, 0x92, 0x26, 0xB8, 0x6C, 0x65,
-    0x9A, 0x28, 0xD0, 0xEA, 0xBE, 0xBA, 0x12, 0xDB, 0xFC, 0xA6, 0xB6, 0xED, 0x7A, 0x86, 0x6E, 0x7F,
-    0x57, 0x65, 0x0D, 0x41, 0xE7, 0x7F, 0x03, 0xD5, 0x5A, 0x3D, 0x8C, 0xDC, 0x66, 0x7A, 0x7E, 0x49,
-    0x6A, 0x45, 0x5F, 0x88, 0x3B, 0xAA, 0x90, 0x90, 0xC4, 0xC2, 0x99, 0x2E, 0xAE, 0x38, 0x04, 0x92,
-    0xD8, 0x1A, 0x87, 0xDD, 0x25, 0x2D, 0x17, 0x2E, 0xAE, 0xF0, 0x16, 0xD9, 0x1C, 0x12, 0x17, 0x4E,
-    0x91, 0xE6, 0xD2, 0x6C, 0xE3, 0x42, 0x40, 0x76, 0x87, 0xB4, 0x0C, 0x5C, 0x0A, 0x17, 0x56, 0x73,
-    0x49, 0x91, 0xC6, 0xC5, 0x25, 0x30, 0xD6, 0xC5, 0x5E, 0x21, 0x20, 0x1B, 0x60, 0x67, 0x86, 0xF2,
-    0x16, 0x29, 0x5C, 0x98, 0xB6, 0x13, 0xB8, 0x70, 0x71, 0xF4, 0x9D, 0x13, 0x23, 0x72, 0x21, 0xCA,
-    0x47, 0x27, 0xD4, 0x8A, 0xE4, 0x97, 0xE7, 0x79, 0x3F, 0xCE, 0xEC, 0x68, 0xE5, 0x34, 0x81, 0x7D,
-    0xD0, 0xAD, 0xB4, 0x9C, 0x59, 0xFE, 0x7C, 0xEF, 0xFF, 0xF3, 0xFE, 0x7C, 0x14, 0x47, 0x9C, 0x4E,
-    0x92, 0xC2, 0x6B, 0xE5, 0xFB, 0x62, 0x7F, 0x6E, 0xE1, 0x9B, 0x5B, 0xCA, 0x86, 0x78, 0x85, 0xEC,
-    0x4A, 0x50, 0x48, 0x2B, 0x61, 0xEE, 0x34, 0x12, 0x8B, 0x57, 0x4B, 0x22, 0x41, 0x25, 0xBD, 0x84,
-    0x85, 0x8B, 0xA7, 0xC4, 0x4D, 0xC7, 0x67, 0xA4, 0xC1, 0xEF, 0x3A, 0x7E, 0x23, 0xFC, 0x06, 0xB9,
-    0x88, 0x57, 0xE2, 0x4B, 0x2D, 0xE2, 0x9A, 0x52, 0x02, 0x63, 0x24, 0x32, 0xA6, 0x88, 0x3E, 0xBA,
-    0x53, 0x85, 0x45, 0x8D, 0x87, 0x6F, 0x88, 0x5F, 0x5D, 0x15, 0xB7, 0x0E, 0x44, 0x3A, 0x50, 0x49,
-    0xA4, 0xD2, 0x93, 0x5E, 0x7D, 0x15, 0x27, 0x42, 0x91, 0xE4, 0xF5, 0x62, 0xDD, 0x7F, 0x50, 0x4D,
-    0xC4, 0x98, 0x41, 0x42, 0xD3, 0x8B, 0x64, 0x9F, 0x89, 0xF8, 0x58, 0xD7, 0xAD, 0xFE, 0x2F, 0x62,
-    0xE3, 0xCF, 0xE5, 0x16, 0x87, 0xC4, 0x14, 0x38, 0xBC, 0x83, 0xAF, 0x89, 0x64, 0xB8, 0x2F, 0x0D,
-    0x0B, 0x10, 0xC0, 0x6D, 0x7E, 0x29, 0x29, 0xC5, 0xC0, 0x4F, 0xC7, 0xC3, 0x84, 0x87, 0x04, 0x52,
-    0x78, 0xA4, 0xE4, 0x18, 0x63, 0x52, 0x71, 0xB9, 0x02, 0x64, 0xE4, 0x15, 0x1E, 0xA2, 0x9C, 0x64,
-    0x48, 0x42, 0x1F, 0x84, 0x26, 0x24, 0x4D, 0x86, 0xFD, 0x83, 0x26, 0xC4, 0xED, 0x9D, 0xD7, 0x3D,
-    0x0D, 0xFE, 0x7E, 0xA1, 0xB4, 0xB1, 0xCE, 0x39, 0x69, 0x9C, 0xAD, 0xA0, 0x88, 0x03, 0xF3, 0x66,
-    0xE1, 0xE2, 0x7A, 0x2E, 0x71, 0x8E, 0xF5, 0xC3, 0xDC, 0xAB, 0xAC, 0x2A, 0xF1, 0xB9, 0x49, 0x09,
-    0xA2, 0x14, 0x1A, 0xC6, 0x99, 0x30, 0xC7, 0xD2, 0x7E, 0x7B, 0x19, 0x6A, 0x31, 0xD4, 0xD3, 0x4D,
-    0x73, 0xB3, 0xF6, 0xB0, 0xD0, 0x73, 0x56, 0x9C, 0x4B, 0xDB, 0x5B, 0x97, 0xB6, 0x5F, 0x34, 0xBD,
-    0x67, 0xBA, 0x78, 0x90, 0xCB, 0x03, 0x59, 0x4A, 0x04, 0xD6, 0xC2, 0x53, 0x51, 0xE1, 0xB4, 0x94,
-    0x03, 0xA7, 0x02, 0x28, 0x16, 0x17, 0x5C, 0xF0, 0xE6, 0x35, 0x10, 0x2A, 0x34, 0x6F, 0x42, 0x05,
-    0x66, 0x30, 0x38, 0x11, 0xA8, 0x28, 0x59, 0xCE, 0xB3, 0x10, 0x12, 0x3A, 0xA5, 0x76, 0x02, 0x2A,
-    0x52, 0xA6, 0x3C, 0xF0, 0xD1, 0x51, 0x1F, 0x31, 0xBF, 0xEE, 0x98, 0x8A, 0xF7, 0x0E, 0xA3, 0x46,
-    0x8F, 0xC0, 0x23, 0x18, 0x0E, 0xC5, 0xA9, 0xE9, 0x03, 0x15, 0xF8, 0xF6, 0x47, 0xCF, 0xD8, 0x92,
-    0xD5, 0x1F, 0x37, 0x3F, 0xF5, 0x17, 0x4A, 0x08, 0x03, 0x43, 0x56, 0xAF, 0xB4, 0x0F, 0x88, 0xFC,
-    0x39, 0x74, 0x69, 0x72, 0xEF, 0xC4, 0xA4, 0x1B, 0x32, 0x83, 0x2E, 0x9B, 0xB8, 0xF0, 0x8A, 0x87,
-    0xB9, 0xF8, 0x6F, 0xA6, 0x72, 0x15, 0x5A, 0xBE, 0x1D, 0xE5, 0x6E, 0x19, 0x15, 0x7E, 0x11, 0xEA,
-    0xBF, 0xA8, 0x08, 0xF3, 0xA8, 0x8C, 0x24, 0x2A, 0xD7, 0x25, 0x2C, 0x6B, 0x09, 0x8E, 0xA1, 0xAD,
-    0xF7, 0xC1, 0xD9, 0xE1, 0xBA, 0xC4, 0xC7, 0xB5, 0x0C, 0x61, 0xE9, 0xD7, 0xF1, 0x7F, 0xCC, 0x61,
-    0xED, 0x4A, 0x9E, 0x86, 0x7F, 0xAC, 0xC9, 0xC5, 0xB8, 0xE8, 0x93, 0x77, 0xFB, 0xE4, 0xF9, 0xEE,
-    0xDC, 0x29, 0x6F, 0x91, 0xC1, 0x35, 0x99, 0xDF, 0x9D, 0xC3, 0x84, 0x90, 0x69, 0xA6, 0xA2, 0x42,
-    0x0C, 0x9A, 0x79, 0x13, 0x1C, 0x67, 0x8D, 0x57, 0x6C, 0x40, 0x57, 0x72, 0x18, 0x49, 0xEB, 0xE5,
-    0x61, 0x90, 0xEE, 0x4A, 0xE5, 0x7E, 0x54, 0x5C, 0x93, 0x0B, 0x72, 0xA3, 0x0E, 0x61, 0x8B, 0x67,
-    0xD6, 0xE9, 0x61, 0xFE, 0xFB, 0x74, 0x3C, 0xE7, 0x37, 0x05, 0xEC, 0x27, 0x37, 0x6E, 0x43, 0x50,
-    0xB9, 0xFA, 0x8C, 0xD3, 0x4B, 0x1A, 0x7A, 0x45, 0x6C, 0x6A, 0xBF, 0x38, 0x74, 0x4C, 0xE3, 0x95,
-    0x7C, 0x00, 0x82, 0x37, 0x7A, 0x84, 0x54, 0x3E, 0x9C, 0xC6, 0xFC, 0x7C, 0x07, 0x2A, 0xF5, 0xE9,
-    0x0E, 0x60, 0xF3, 0x1F, 0x47, 0xC6, 0xC2, 0xFF, 0x29, 0x22, 0x53, 0x86, 0xCF, 0xD7, 0x41, 0x7E,
-    0x08, 0x16, 0x9C, 0x3A, 0x94, 0xC3, 0xA0, 0xB8, 0xE6, 0x7F, 0x1A, 0x7C, 0xF2, 0x2F, 0x77, 0xCC,
-    0x9B, 0x55, 0xFC, 0x82, 0xDA, 0x48, 0x1C, 0x38, 0xE7, 0xBB, 0x06, 0x81, 0xE4, 0xC8, 0x45, 0xF8,
-    0xCD, 0x11, 0x95, 0xE7, 0xB5, 0x50, 0x4F, 0x95, 0x49, 0x72, 0xB3, 0x93, 0xB9, 0xD7, 0xE0, 0xB7,
-    0x15, 0x88, 0x0D, 0x5B, 0x4E, 0x20, 0x1B, 0x9C, 0xAB, 0x81, 0xCA, 0x2F, 0x38, 0xE9, 0xDC, 0x98,
-    0x2F, 0x61, 0xF0, 0x3B, 0xDB, 0xDB, 0x3B, 0x58, 0x69, 0x57, 0x68, 0x44, 0xB5, 0x46, 0xA4, 0x4E,
-    0x61, 0x7E, 0x6D, 0xCC, 0xBF, 0xD2, 0xD2, 0xCE, 0x36, 0x75, 0x04, 0xFE, 0xC2, 0x5B, 0xF0, 0xAC,
-    0x06, 0xB1, 0x1F, 0x9C, 0x7F, 0xDB, 0x2B, 0x6E, 0xC4, 0x53, 0xFF, 0x7A, 0xF1, 0xDC, 0x8D, 0x30,
-    0x94, 0x4F, 0xAB, 0x2B, 0xEB, 0xDE, 0x3D, 0xF9, 0x65, 0x15, 0xD6, 0xEE, 0x71, 0xF1, 0x5C, 0x1D,
-    0x04, 0xF2, 0x69, 0xBD, 0xFE, 0xFD, 0xF0, 0xD3, 0xFB, 0xD5, 0xFA, 0xA5, 0xE7, 0x5F, 0x62, 0x40,
-    0xDE, 0x96, 0x3D, 0xFA, 0x75, 0x4C, 0xAF, 0x3B, 0xFF, 0x36, 0x9D, 0xF7, 0xBA, 0x31, 0xEF, 0xC1,
-    0xAB, 0xB1, 0xFE, 0x2C, 0x0D, 0x4D, 0x95, 0xBC, 0xD8, 0xEC, 0x4A, 0x77, 0x24, 0xBB, 0xFA, 0xFF,
-    0x68, 0x22, 0x6D, 0xF2, 0x45, 0x1D, 0xC0, 0x1D, 0xFF, 0xCA, 0x6A, 0x84, 0x9A, 0x6D, 0xD5, 0x38,
-    0x74, 0x21, 0xFC, 0xE9, 0x6C, 0x3F, 0xD8, 0x8E, 0x11, 0x65, 0x10, 0xA3, 0x7E, 0xFC, 0xAA, 0x45,
-    0x02, 0xFB, 0xB3, 0xBD, 0xBD, 0xFD, 0x63, 0x08, 0xCA, 0x9B, 0xF9, 0x27, 0x9C, 0x9E, 0xBA, 0xFD,
-    0xA0, 0x0B, 0xF2, 0xD8, 0x81, 0x33, 0x31, 0xF2, 0xF1, 0x20, 0x8C, 0xE1, 0x57, 0xF4, 0xFD, 0xB0,
-    0xA4, 0xDB, 0x47, 0x77, 0xF7, 0x11, 0x13, 0xF9, 0xFE, 0x7E, 0xAE, 0xCE, 0x5F, 0x3B, 0x88, 0xE7,
-    0xEA, 0xC8, 0x83, 0x03, 0xC0, 0xEB, 0x61, 0xBE, 0x9D, 0xC2, 0x81, 0x6F, 0xFD, 0x7D, 0xCD, 0xA0,
-    0xC7, 0x7F, 0xF8, 0x6C, 0x5C, 0x66, 0x26, 0x25, 0x18, 0x11, 0x28, 0x83, 0x22, 0xF3, 0x9A, 0xE4,
-    0x3A, 0xEC, 0xB6, 0xF8, 0x01, 0x95, 0x3D, 0x3E, 0x98, 0xD0, 0xC9, 0x40, 0x60, 0x93, 0xE4, 0xE0,
-    0xD6, 0x0D, 0xAF, 0x1C, 0x9D, 0x5E, 0xC9, 0xED, 0x95, 0x70, 0xBC, 0xD2, 0x09, 0x3E, 0x33, 0xBA,
-    0x67, 0x02, 0x34, 0x2C, 0xAE, 0xD5, 0x17, 0xC2, 0x3E, 0x4B, 0xA6, 0x70, 0x98, 0x70, 0x70, 0x3F,
-    0x1F, 0xE0, 0x64, 0xED, 0x45, 0x40, 0xCB, 0xA6, 0x7A, 0x4D, 0x6E, 0xE9, 0x08, 0x9F, 0x59, 0xC4,
-    0xAD, 0x02, 0xD5, 0xF7, 0x46, 0x34, 0x3E, 0x4F, 0x14, 0x8B, 0x19, 0xE5, 0x99, 0x99, 0xA4, 0x38,
-    0xBC, 0x44, 0x44, 0x44, 0xF4, 0xC4, 0xE6, 0x3E, 0x68, 0x9A, 0xEE, 0x36, 0x5C, 0x71, 0xD8, 0x00,
-    0x36, 0xF3, 0xCA, 0x7C, 0x79, 0xC5, 0xE7, 0x15, 0xE1, 0x15, 0xDC, 0x84, 0x2B, 0xF2, 0xCF, 0xC7,
-    0x0C, 0xDB, 0xFB, 0xF4, 0xC2, 0x75, 0x5C, 0x91, 0x67, 0x36, 0xA8, 0x59, 0x5E, 0xF1, 0x4E, 0xAF,
-    0xDC, 0x20, 0x17, 0x57, 0x77, 0xC9, 0x19, 0x2E, 0x83, 0x71, 0x91, 0x6B, 0xAF, 0xC0, 0x4C, 0x81,
-    0x3A, 0xFB, 0x4F, 0xD5, 0x81, 0x9D, 0x2E, 0x39, 0xEE, 0xC8, 0xE3, 0x96, 0xD7, 0x9D, 0xEF, 0xE1,
-    0x86, 0x9D, 0x57, 0xC7, 0xC5, 0x1F, 0xEB, 0xB5, 0x23, 0xD7, 0x14, 0x09, 0xF1, 0x50, 0x95, 0xB3,
-    0x80, 0x97, 0x23, 0x6A, 0xAF, 0x85, 0xEA, 0x62, 0x73, 0x7D, 0xFF, 0x2D, 0x55, 0xED, 0x00, 0x06,
-    0x2B, 0xBF, 0x3C, 0x82, 0x7B, 0x3B, 0x88, 0xB6, 0x23, 0xB7, 0x8E, 0xA5, 0x0B, 0x8A, 0x3D, 0xB7,
-    0x9E, 0x40, 0x3C, 0xF1, 0x7B, 0x2B, 0xBD, 0x03, 0xB1, 0x0A, 0x44, 0x8B, 0x03, 0x85, 0x79, 0x80,
-    0x0F, 0xA7, 0x41, 0xA4, 0x4E, 0x99, 0xBA, 0xAE, 0x77, 0xC0, 0xB7, 0x01, 0xB0, 0x39, 0x68, 0xD8,
-    0xF4, 0x41, 0xED, 0x35, 0x88, 0x22, 0x44, 0xCC, 0x26, 0x8C, 0x7B, 0x51, 0x16, 0xC9, 0xEC, 0x2F,
-    0x6D, 0xAA, 0x01, 0x79, 0x67, 0x5E, 0x28, 0xEA, 0xFB, 0x94, 0x85, 0x3A, 0x87, 0x77, 0xAB, 0x01,
-    0xE2, 0x51, 0xE7, 0xB1, 0xE2, 0xA3, 0xFA, 0x22, 0xF3, 0x02, 0x78, 0x57, 0xF7, 0x84, 0x13, 0x10,
-    0x08, 0xAF, 0xF0, 0x5A, 0xC4, 0x5C, 0xD2, 0xF1, 0x92, 0xD7, 0xD1, 0x7D, 0x81, 0x8E, 0x1D, 0xFC,
-    0x16, 0xD2, 0x6E, 0x1C, 0x46, 0x26, 0x85, 0xAC, 0x6D, 0x93, 0x98, 0x34, 0x4C, 0xBD, 0xAA, 0xD1,
-    0x95, 0xC2, 0xD7, 0x6A, 0x5D, 0x75, 0x13, 0xB7, 0x70, 0xD5, 0xFE, 0x27, 0x5F, 0x71, 0x55, 0x26,
-    0x27, 0xC5, 0xEA, 0xBF, 0x7E, 0xE7, 0xBF, 0x2C, 0x61, 0x86, 0xF1, 0x9E, 0x28, 0x25, 0xF5, 0x02,
-    0x32, 0x56, 0x8F, 0x32, 0x5C, 0x58, 0x81, 0xE5, 0xD4, 0xCA, 0x03, 0xFE, 0x55, 0x1E, 0x06, 0x03,
-    0xE5, 0x21, 0xFF, 0x94, 0x67, 0x6F, 0x94, 0xA3, 0xB5, 0x9F, 0x9A, 0xE4, 0x36, 0xED, 0xAA, 0x94,
-    0x87, 0xB7, 0xF0, 0x9E, 0x4D, 0xB9, 0xFC, 0x16, 0xE5, 0x39, 0x42, 0x90, 0x80, 0x1C, 0x4C, 0xF0,
-    0x60, 0x60, 0x3E, 0x2B, 0xC3, 0x3C, 0x61, 0x7A, 0xC8, 0x03, 0xD9, 0x84, 0x3C, 0x5C, 0x69, 0x0F,
-    0xF2, 0xEC, 0x8E, 0x2B, 0x36, 0x76, 0x45, 0x6A, 0x85, 0x89, 0x94, 0xAB, 0xCE, 0x2C, 0x61, 0xD7,
-    0x8A, 0x6B, 0xD3, 0x0F, 0xF8, 0xCF, 0xB6, 0xB7, 0xA8, 0x15, 0xE4, 0xA7, 0x56, 0x75, 0x3D, 0x47,
-    0xC8, 0x6B, 0xDE, 0x38, 0xFB, 0xF3, 0x2C, 0x5C, 0xBC, 0xB1, 0xCC, 0x86, 0x14, 0x04, 0xEB, 0x86,
-    0x1F, 0xD7, 0xBA, 0x90, 0x97, 0xEF, 0x8E, 0x9C, 0x47, 0x63, 0x90, 0x80, 0x90, 0x5A, 0x64, 0xC7,
-    0xE6, 0x7D, 0x07, 0x30, 0x4A, 0x22, 0xF2, 0xA3, 0x8E, 0xBC, 0xB9, 0x05, 0x6F, 0x80, 0x14, 0x63,
-    0x80, 0xC2, 0x44, 0xB8, 0x6B, 0x17, 0xE5, 0x80, 0xF8, 0x0D, 0x4D, 0xF6, 0xC9, 0xCF, 0xE6, 0x2D,
-    0x93, 0xD8, 0x6F, 0x3E, 0x00, 0x10, 0x30, 0xFB, 0x35, 0x97, 0xB8, 0xB6, 0x57, 0xA9, 0xC3, 0x23,
-    0xAB, 0xC7, 0x9A, 0x40, 0xBD, 0xAF, 0x5E, 0xF9, 0x37, 0x12, 0xB6, 0x46, 0xC2, 0x52, 0x4F, 0xEF,
-    0x9F, 0x8C, 0x84, 0x77, 0x47, 0x95, 0xC6, 0x63, 0xC0, 0xD2, 0x4A, 0x87, 0xA3, 0x24, 0xE7, 0x64,
-    0x69, 0x2E, 0x20, 0x13, 0x62, 0xBF, 0x17, 0xF7, 0xD6, 0x68, 0x35, 0xFC, 0x5D, 0xCB, 0x01, 0x42,
-    0x53, 0x1C, 0xC6, 0x01, 0x0E, 0x71, 0xAE, 0xDF, 0xA0, 0x2B, 0xA4, 0x23, 0xB0, 0x3D, 0x91, 0x0B,
-    0xE6, 0xE0, 0x8E, 0x19, 0x1C, 0x28, 0xEA, 0xA7, 0xA7, 0xEA, 0xF9, 0x9E, 0x1E, 0x6D, 0x7E, 0x77,
-    0x8D, 0x58, 0x64, 0xD3, 0x8F, 0xB9, 0x0D, 0x90, 0x74, 0x45, 0x97, 0xD6, 0x4F, 0x14, 0x43, 0xC4,
-    0xDE, 0x9B, 0x69, 0x31, 0x95, 0x28, 0xB6, 0xC4, 0x5A, 0x1F, 0x85, 0x2F, 0x51, 0xA1, 0xC1, 0x31,
-    0x17, 0xF1, 0x4A, 0xDE, 0x0B, 0xB1, 0x53, 0xA6, 0x12, 0x25, 0xD2, 0x3A, 0x9D, 0xFA, 0x6B, 0x62,
-    0xBD, 0x17, 0xF7, 0xC6, 0xFB, 0xEF, 0x34, 0x8B, 0x6A, 0x23, 0xBC, 0xBB, 0x3F, 0x57, 0xF4, 0x85,
-    0x80, 0xD4, 0x83, 0x42, 0x1D, 0x4B, 0x2E, 0x3C, 0x14, 0x56, 0x2C, 0x40, 0xBC, 0xCE, 0x45, 0xC2,
-    0xB8, 0x8C, 0x3C, 0xC5, 0x5A, 0xAF, 0x5B, 0x54, 0x52, 0xC2, 0x7C, 0x42, 0x76, 0xB5, 0x0E, 0xF1,
-    0x0C, 0x4F, 0x05, 0x7A, 0xF4, 0x1F, 0xAC, 0xDC, 0xF3, 0x64, 0xCB, 0x21, 0x4B, 0x70, 0xA6, 0x35,
-    0xB5, 0x32, 0x55, 0xDE, 0x94, 0x60, 0xA6, 0xD0, 0x71, 0x4D, 0xBE, 0xF3, 0xA4, 0xCB, 0x11, 0xE5,
-    0x74, 0xCA, 0xB8, 0x55, 0x9F, 0xD7, 0xBA, 0xD0, 0x3F, 0x56, 0xE6, 0xCA, 0xC9, 0xE3, 0xD1, 0xA9,
-    0x66, 0xB1, 0x25, 0xB6, 0xA7, 0x72, 0x38, 0x6A, 0x34, 0x31, 0x2A, 0xC7, 0x54, 0x8B, 0xEB, 0x0D,
-    0x55, 0x49, 0xAC, 0x91, 0x1F, 0xBE, 0x50, 0x6B, 0x54, 0x4C, 0x15, 0xD1, 0x62, 0x96, 0xF3, 0x15,
-    0x6B, 0x26, 0x04, 0x40, 0xA7, 0x18, 0xC2, 0x7B, 0x67, 0xFB, 0x07, 0x25, 0x95, 0x67, 0x58, 0xD2,
-    0xEF, 0xEF, 0x1B, 0x8D, 0xEB, 0xA8, 0xD0, 0x90, 0xAF, 0xB5, 0x38, 0xEF, 0x95, 0x66, 0xC2, 0x84,
-    0x2A, 0x21, 0x6A, 0x8A, 0x12, 0x65, 0xEC, 0x7B, 0xB8, 0x3D, 0x31, 0xF5, 0x8A, 0x21, 0xB8, 0x62,
-    0x5C, 0x92, 0xF7, 0xB0, 0x46, 0xB8, 0xD9, 0xE4, 0xF0, 0xFB, 0x21, 0xC1, 0x96, 0x8D, 0x67, 0x72,
-    0xE2, 0x9C, 0xA8, 0x37, 0xD4, 0xD7, 0x78, 0x5C, 0xD7, 0x5C, 0x15, 0xBA, 0xDA, 0xA0, 0xFC, 0x77,
-    0x7D, 0xEA, 0x6A, 0xCE, 0xD6, 0x0A, 0xC6, 0x8C, 0x3E, 0xA8, 0xC2, 0x46, 0xFA, 0x74, 0xA8, 0xF9,
-    0x32, 0xF8, 0x15, 0x9F, 0xF6, 0x3E, 0xAA, 0x15, 0x72, 0x54, 0xDA, 0x46, 0xEF, 0x6D, 0xB5, 0xE3,
-    0xD9, 0x75, 0x6D, 0x95, 0x9C, 0x29, 0x80, 0x51, 0x5A, 0x60, 0x1E, 0xEE, 0x0D, 0xEE, 0xEE, 0xF7,
-    0xDA, 0x34, 0x01, 0x7F, 0xBD, 0x93, 0xFD, 0x03, 0x5B, 0x21, 0x75, 0xEA, 0xB9, 0x89, 0xB6, 0x15,
-    0x28, 0xB0, 0xF0, 0x05, 0x55, 0x29, 0x3D, 0xD3, 0xC8, 0xBC, 0x47, 0x59, 0x82, 0x32, 0x2E, 0xF7,
-    0xB4, 0x1C, 0x64, 0xED, 0x61, 0xBF, 0xCC, 0x6D, 0x3B, 0x82, 0x13, 0x77, 0xDF, 0xA9, 0x47, 0x2D,
-    0x2B, 0x3C, 0x3E, 0xAC, 0xE5, 0xAA, 0xC6, 0x42, 0x27, 0x81, 0xB6, 0x21, 0xA3, 0xAF, 0xED, 0xC5,
-    0xB9, 0xAD, 0x15, 0x43, 0xDB, 0xF5, 0x25, 0xD6, 0x52, 0x60, 0x6F, 0x50, 0x45, 0x45, 0x69, 0x66,
-    0x9D, 0x36, 0x8D, 0xF7, 0xDF, 0xA6, 0x9C, 0x77, 0x0F, 0xF4, 0xC6, 0xD0, 0x58, 0x3D, 0x82, 0xF5,
-    0x6E, 0x2C, 0xD5, 0x66, 0xB4, 0x35, 0x40, 0x1A, 0x2C, 0xBE, 0x4A, 0xE5, 0x43, 0xBE, 0x0D, 0x5A,
-    0x8D, 0x75, 0x1E, 0xDB, 0x40, 0xB7, 0xDF, 0x3E, 0x28, 0x7C, 0x53, 0xA2, 0x81, 0x35, 0xA5, 0x67,
-    0x1A, 0x7E, 0x2E, 0xBD, 0x69, 0x07, 0x6D, 0x85, 0xCB, 0x90, 0x8A, 0x4E, 0x5E, 0x1E, 0xD8, 0x5E,
-    0xED, 0xA1, 0x4C, 0x93, 0x5D, 0x64, 0x12, 0xD9, 0x65, 0x1C, 0xBE, 0xAA, 0xBE, 0xA1, 0xCC, 0xB2,
-    0xC1, 0xB4, 0x16, 0xC8, 0x96, 0x87, 0xF9, 0xF2, 0x70, 0x7A, 0x2E, 0xD1, 0x9B, 0xC1, 0x6D, 0x15,
-    0xB1, 0xC1, 0x0B, 0xCC, 0xBE, 0xC9, 0x41, 0xA2, 0x27, 0xB1, 0x72, 0xE1, 0x02, 0x5B, 0x0B, 0xB7,
-    0x74, 0x87, 0x45, 0xC9, 0xAC, 0x38, 0xA2, 0xC9, 0x25, 0xE2, 0x6D, 0xAB, 0x78, 0x52, 0x2D, 0x17,
-    0x8F, 0xEA, 0xA5, 0xFF, 0x04, 0x2A, 0xC4, 0xC5, 0x55, 0x9F, 0x67, 0xF3, 0x59, 0xD1, 0x9E, 0xAD,
-    0x5C, 0x3E, 0x81, 0x6D, 0xB1, 0x5A, 0x48, 0x4C, 0xD0, 0xEE, 0x1C, 0xAB, 0x44, 0xC5, 0x22, 0xA7,
-    0x78, 0x2B, 0x55, 0xE7, 0xFE, 0xC0, 0xF6, 0x0A, 0x6B, 0x06, 0x27, 0x28, 0xA1, 0x57, 0xAE, 0x64,
-    0x63, 0xE3, 0x7C, 0x4E, 0x6B, 0x6D, 0x4D, 0xAF, 0x05, 0x57, 0xAB, 0x24, 0xFB, 0xB3, 0x77, 0x1A,
-    0x1A, 0xBF, 0xE3, 0x61, 0x38, 0x65, 0x20, 0x20, 0x63, 0x11, 0x09, 0xC4, 0x5C, 0x26, 0xE3, 0x21,
-    0xB9, 0xB5, 0x9A, 0x23, 0x9F, 0x08, 0x3E, 0xD5, 0xD9, 0x3C, 0xA3, 0x07, 0x96, 0x35, 0x0D, 0x7C,
-    0xC8, 0xAF, 0x01, 0x22, 0x6E, 0x25, 0x6F, 0x3D, 0x39, 0x7C, 0xBA, 0x0D, 0xBC, 0xCF, 0x19, 0x02,
-    0xAC, 0x30, 0x7F, 0xA1, 0x63, 0x30, 0xEC, 0x3D, 0x06, 0x73, 0x09, 0xA3, 0x57, 0xF9, 0x94, 0x9D,
-    0xBB, 0x48, 0x10, 0x81, 0xCE, 0x7C, 0x10, 0x05, 0xA4, 0xE9, 0xE5, 0x96, 0xA6, 0xFA, 0x6F, 0xB8,
-    0x1C, 0x7E, 0xC8, 0xC0, 0xA1, 0x4A, 0x46, 0x97, 0x8C, 0xEF, 0xEE, 0xAF, 0x5E, 0x71, 0x16, 0xF3,
-    0x94, 0x0B, 0x7C, 0x86, 0x1D, 0x3B, 0xCB, 0xA4, 0x9A, 0xA3, 0xA3, 0xFE, 0x2F, 0x0E, 0x34, 0x84,
-    0xEA, 0x40, 0xF5, 0xB1, 0x2C, 0x52, 0x66, 0xB6, 0x3E, 0xA1, 0x36, 0x9D, 0xD9, 0x23, 0x35, 0x2B,
-    0x20, 0xC1, 0x03, 0x0D, 0x67, 0x6E, 0xAB, 0x44, 0x52, 0x49, 0x2C, 0x09, 0xAA, 0x8C, 0xE1, 0xD4,
-    0x59, 0xB2, 0x91, 0x2D, 0x27, 0xA9, 0x29, 0x86, 0x1B, 0x58, 0xE6, 0x48, 0x64, 0xE5, 0x26, 0xE0,
-    0xB0, 0x8B, 0x95, 0xB4, 0x25, 0xB5, 0xBE, 0x74, 0x05, 0xF7, 0x80, 0x7D, 0x14, 0xE1, 0x32, 0x6F,
-    0x6C, 0x75, 0x91, 0xAE, 0x2A, 0x05, 0x75, 0x17, 0x82, 0x0D, 0x5D, 0x8A, 0xD8, 0x69, 0x8A, 0x25,
-    0x44, 0x3C, 0xE7, 0xB2, 0x64, 0x25, 0xB4, 0x45, 0xB4, 0x12, 0xA7, 0x7E, 0x48, 0x2A, 0x19, 0x8D,
-    0x34, 0xB1, 0x72, 0xE9, 0xF8, 0xA8, 0xB3, 0x2C, 0xC7, 0x58, 0x6E, 0x6E, 0x16, 0x23, 0x2A, 0x3E,
-    0x94, 0x01, 0x2E, 0x59, 0xE4, 0xD6, 0x68, 0x52, 0x8B, 0x04, 0x30, 0xF7, 0xDD, 0xDF, 0x19, 0x7D,
-    0xAF, 0x0E, 0x0B, 0xB7, 0x0F, 0x6B, 0x31, 0xC0, 0x90, 0x28, 0x3D, 0x3C, 0xEB, 0x12, 0x1C, 0x43,
-    0x81, 0xE4, 0x4E, 0x69, 0x47, 0x5E, 0xEA, 0x82, 0xDD, 0xB8, 0x36, 0x69, 0x91, 0xBE, 0xDA, 0xFB,
-    0xEB, 0x4E, 0xAA, 0x0F, 0x4C, 0xBE, 0xE6, 0x64, 0x80, 0x35, 0x03, 0xD3, 0x9F, 0x0E, 0xE9, 0xE8,
-    0x74, 0x84, 0x7E, 0x68, 0xFF, 0x9F, 0xDA, 0xF3, 0x48, 0x00, 0x90, 0x35, 0x56, 0xE0, 0xF5, 0x5B,
-    0x1E, 0xDD, 0x8E, 0x12, 0xC3, 0x4E, 0x94, 0x79, 0xD0, 0xB5, 0x06, 0x95, 0x79, 0x58, 0xDB, 0xF9,
-    0xF7, 0x2D, 0x19, 0x14, 0xCC, 0xFB, 0x3F, 0x98, 0xDF, 0x7D, 0x0B, 0x92, 0x42, 0x7E, 0xA7, 0x1B,
-    0xB3, 0x4D, 0xA6, 0x44, 0x27, 0x5A, 0xCB, 0xCC, 0x74, 0x9E, 0xD5, 0x2B, 0xCC, 0xC2, 0xA3, 0xE1,
-    0x4F, 0xBD, 0x03, 0xD5, 0xC7, 0x3A, 0xE5, 0x03, 0xF1, 0x5B, 0x2B, 0x92, 0xC7, 0xA9, 0xA6, 0x46,
-    0xF3, 0x6E, 0x65, 0x93, 0x93, 0xF6, 0xD7, 0x1F, 0x68, 0x0B, 0xEB, 0x14, 0x5F, 0x53, 0xE5, 0x8C,
-    0xFA, 0x6A, 0xE0, 0xBD, 0x20, 0x0D, 0x9E, 0x69, 0x4F, 0x2A, 0x1B, 0x09, 0x65, 0x50, 0x73, 0xD0,
-    0xAD, 0x37, 0xF9, 0xC1, 0x5E, 0x5F, 0xFC, 0x7B, 0x85, 0x36, 0x85, 0xEF, 0xB3, 0xCB, 0x90, 0xF0,
-    0x3D, 0x2D, 0x0D, 0xC2, 0xD7, 0x1B, 0xF6, 0x48, 0xD1, 0xF5, 0x96, 0x6D, 0x52, 0x24, 0x1D, 0x7B,
-    0xC8, 0x58, 0x66, 0x6C, 0x50, 0x12, 0x9B, 0xD8, 0x36, 0x25, 0x79, 0xBD, 0x62, 0xFF, 0x15, 0x1D,
-    0x97, 0x3A, 0x8A, 0xFB, 0x58, 0x9B, 0x3D, 0xFF, 0xA1, 0x7E, 0x78, 0x4C, 0x9D, 0x68, 0x53, 0x41,
-    0x83, 0x8F, 0x6A, 0xDB, 0x9F, 0x53, 0x5C, 0x4E, 0x72, 0x92, 0xC7, 0x3A, 0x41, 0x9D, 0x29, 0xDA,
-    0x40, 0xF5, 0x17, 0x53, 0x12, 0xCA, 0x69, 0xCB, 0xCD, 0xAD, 0x33, 0xC2, 0xCD, 0x99, 0x2B, 0x74,
-    0x8C, 0xE0, 0x0F, 0xDB, 0x1C, 0x26, 0x00, 0x12, 0x72, 0x9F, 0x88, 0xA2, 0x89, 0x6A, 0xE0, 0x63,
-    0x6E, 0x47, 0xA3, 0x04, 0x35, 0x13, 0x59, 0x74, 0xAC, 0xC0, 0xCD, 0x13, 0x4E, 0x47, 0xD7, 0x08,
-    0xBE, 0xE4, 0xC2, 0xC9, 0x1B, 0x74, 0x97, 0x9E, 0x93, 0x45, 0x5F, 0xEF, 0x4B, 0x5E, 0x53, 0xC7,
-    0xD4, 0x98, 0x2D, 0xE1, 0x89, 0xB0, 0x2C, 0x70, 0x1F, 0xE9, 0x29, 0x6E, 0xFE, 0x70, 0x50, 0x8A,
-    0x6C, 0xB4, 0x6D, 0xC0, 0x3E, 0xC2, 0x93, 0x5B, 0x2D, 0x06, 0x99, 0x96, 0x71, 0x47, 0xAD, 0x14,
-    0x7E, 0x76, 0x46, 0xCA, 0x27, 0x94, 0x7B, 0x55, 0x75, 0xA8, 0xAA, 0x1E, 0xB4, 0x5B, 0xFF, 0xB0,
-    0xE5, 0x42, 0xB4, 0x75, 0x90, 0xBB, 0xF9, 0x93, 0xCA, 0xBD, 0x5F, 0xFD, 0x90, 0x2B, 0x57, 0xB5,
-    0x96, 0x7B, 0x44, 0x1E, 0x95, 0xE1, 0x07, 0xE1, 0xD7, 0x75, 0xE6, 0x8A, 0x35, 0x9C, 0xF7, 0x13,
-    0xE0, 0x7E, 0x8E, 0x58, 0xE3, 0xE2, 0x15, 0xE1, 0x36, 0x2E, 0x42, 0x82, 0x72, 0x4E, 0x26, 0xE6,
-    0x74, 0x6C, 0xB7, 0xB3, 0x5C, 0xF5, 0xCA, 0x3D, 0xD9, 0xCC, 0x88, 0x67, 0x6E, 0xC7, 0x3B, 0xC2,
-    0x5F, 0x2B, 0xF7, 0x3F, 0x56, 0xF8, 0xE0, 0x7D, 0x1C, 0x75, 0x12, 0x6F, 0x58, 0x74, 0x36, 0xAC,
-    0x7E, 0x92, 0xDC, 0xD7, 0x80, 0x0B, 0xFA, 0x35, 0xB8, 0x3A, 0x28, 0x36, 0x9C, 0xAF, 0xF6, 0x67,
-    0xEB, 0x9A, 0x29, 0xD5, 0xEB, 0xB7, 0x71, 0xB9, 0x28, 0xFB, 0xF7, 0x9C, 0xE6, 0x49, 0xE6, 0xFB,
-    0x9C, 0x7A, 0xF9, 0x7A, 0x94, 0x87, 0xC5, 0xCC, 0xAB, 0xDD, 0x16, 0x37, 0x1A, 0x45, 0x31, 0x82,
-    0xCA, 0xD0, 0x48, 0x12, 0x94, 0x61, 0x19, 0xBF, 0xD0, 0xC8, 0xF4, 0xBB, 0xF2, 0xA8, 0xCF, 0x40,
-    0x82, 0x2B, 0x6A, 0xC0, 0xF7, 0x0A, 0x89, 0x1E, 0xFC, 0xC4, 0x28, 0x92, 0x82, 0x10, 0x13, 0x1C,
-    0x87, 0x8A, 0xB9, 0x84, 0x03, 0x0B, 0x3F, 0xEF, 0xA1, 0x42, 0x0F, 0x9C, 0x04, 0xAB, 0x6E, 0xFA,
-    0xB5, 0xC7, 0xD1, 0x4D, 0x06, 0x16, 0xD9, 0xB3, 0xF8, 0x35, 0xD2, 0xE7, 0x1C, 0xFF, 0x26, 0xE0,
-    0x3C, 0xA8, 0x51, 0x70, 0xF4, 0x32, 0xF7, 0xB9, 0xD3, 0x10, 0xDC, 0x6F, 0x14, 0x5E, 0xA7, 0x94,
-    0xC6, 0x87, 0x77, 0xB2, 0xBE, 0x2F, 0x79, 0xCA, 0xE5, 0xBE, 0x09, 0x94, 0xA3, 0x02, 0xC5, 0xEA,
-    0x41, 0x5E, 0x91, 0xD9, 0x7C, 0xB3, 0xB6, 0xCA, 0xE1, 0x15, 0x59, 0x56, 0x32, 0x63, 0x53, 0xAB,
-    0x95, 0xDE, 0x02, 0x7E, 0x1E, 0xAD, 0xF3, 0x50, 0x63, 0xA0, 0x04, 0xB0, 0x0D, 0x43, 0x4B, 0xC7,
-    0xCF, 0x52, 0xED, 0x8E, 0x34, 0x11, 0x6E, 0x6A, 0x5A, 0xD8, 0xD3, 0xB4, 0xB0, 0xA7, 0x69, 0xE1,
-    0x48, 0x93, 0x61, 0xA7, 0x23, 0x26, 0x6D, 0x39, 0x60, 0x66, 0xA6, 0x05, 0x9D, 0xB7, 0xC2, 0x07,
-    0x96, 0x69, 0xC1, 0xD3, 0xB4, 0x60, 0x6B, 0x7F, 0x54, 0x6D, 0x33, 0x9D, 0xC7, 0xCC, 0x15, 0xB0,
-    0x33, 0x4A, 0x2B, 0xC9, 0x83, 0x9D, 0x56, 0xCB, 0xB7, 0x92, 0x79, 0x60, 0x78, 0x4C, 0x0A, 0x71,
-    0x14, 0x85, 0x42, 0xAD, 0x86, 0xE6, 0xFC, 0xAE, 0xC3, 0xB4, 0x11, 0x86, 0xD6, 0xE4, 0xF7, 0x44,
-    0x8A, 0xFE, 0x74, 0xA8, 0x12, 0xDE, 0x63, 0x28, 0x27, 0x2F, 0x2A, 0x54, 0x70, 0x7B, 0xC0, 0x79,
-    0xB4, 0x94, 0x7D, 0x72, 0xA5, 0x98, 0xB2, 0x42, 0x72, 0x06, 0x9F, 0x40, 0xDA, 0xB3, 0xD6, 0x95,
-    0xD6, 0x2F, 0xBF, 0x26, 0xBA, 0x9F, 0x58, 0x2B, 0xEC, 0x2E, 0xF7, 0xDC, 0x62, 0xD6, 0xC5, 0x21,
-    0x6F, 0xF1, 0x1E, 0x03, 0x31, 0x22, 0x53, 0x87, 0x7A, 0x18, 0xE5, 0x7A, 0x62, 0x5E, 0x83, 0xCD,
-    0xB2, 0x3C, 0xD0, 0x7D, 0x0C, 0x9D, 0xDA, 0xB8, 0x3A, 0x5F, 0x40, 0x84, 0x72, 0x84, 0x60, 0xAB,
-    0x5F, 0x66, 0xFE, 0x84, 0x83, 0x0D, 0xEF, 0x2B, 0x6D, 0x0A, 0x95, 0xB2, 0x76, 0xD9, 0xB6, 0xF3,
-    0x9B, 0xC9, 0x62, 0x47, 0x73, 0xCC, 0x4A, 0xC5, 0xB2, 0x2E, 0xD0, 0x7A, 0xDF, 0x6B, 0x95, 0x66,
-    0xCF, 0x14, 0xAB, 0x81, 0xCC, 0x1D, 0x36, 0x1C, 0x70, 0xED, 0x7C, 0xBB, 0x68, 0x35, 0xBD, 0x93,
-    0x2D, 0x4D, 0x09, 0xB9, 0xF8, 0x27, 0x73, 0x4E, 0x30, 0x7C, 0xEE, 0x78, 0x38, 0xBA, 0xED, 0xD1,
-    0xDB, 0x83, 0xCE, 0x2A, 0xE3, 0x54, 0xB7, 0x28, 0xF1, 0x4C, 0x42, 0xF2, 0x80, 0x1A, 0xA4, 0xB3,
-    0xF9, 0xC0, 0x1C, 0x87, 0x45, 0xFB, 0x3F, 0x1D, 0x6B, 0x49, 0x25, 0x1F, 0x93, 0xC9, 0xB9, 0x19,
-    0x53, 0xCB, 0xD3, 0x36, 0xDF, 0x6B, 0x78, 0xCD, 0x0F, 0x1A, 0xAD, 0x2D, 0x67, 0xDA, 0x49, 0xEB,
-    0x50, 0x2B, 0xD5, 0x8D, 0xA0, 0x82, 0x80, 0x0E, 0x5D, 0x1C, 0x2A, 0x5B, 0xEB, 0xBA, 0xDA, 0x86,
-    0xDE, 0xB4, 0xA1, 0x43, 0x99, 0x6B, 0x9A, 0xC3, 0x74, 0x53, 0xAE, 0x51, 0xE7, 0xE8, 0x94, 0x52,
-    0xA2, 0xB3, 0x90, 0x28, 0x27, 0x26, 0x43, 0x13, 0x80, 0x47, 0x58, 0x96, 0xBE, 0xD1, 0xA9, 0x7A,
-    0x54, 0xA3, 0xE4, 0x9F, 0xDB, 0xB6, 0x1F, 0x94, 0x0E, 0x4B, 0xD3, 0x81, 0x94, 0x3A, 0xED, 0x24,
-    0x26, 0x2E, 0x79, 0x8F, 0x53, 0x8E, 0x52, 0x6D, 0x22, 0xB4, 0xDD, 0x91, 0x26, 0x17, 0x3F, 0xB5,
-    0xDD, 0xB9, 0xAA, 0x76, 0xAE, 0xC7, 0xF3, 0xBF, 0x58, 0x19, 0x2D, 0x5D, 0x5D, 0xDC, 0xAE, 0xD3,
-    0x98, 0x7E, 0xF1, 0x17, 0x37, 0xB2, 0x1F, 0x29, 0x63, 0xFC, 0x01, 0x75, 0x81, 0x19, 0x50, 0xAA,
-    0xBF, 0x6C, 0x60, 0x97, 0x90, 0x33, 0xA5, 0x23, 0xDD, 0x56, 0x02, 0x5F, 0x2D, 0x37, 0x17, 0xD3,
-    0x04, 0x8F, 0x42, 0xF6, 0xCC, 0xE2, 0x75, 0x09, 0x28, 0x9E, 0xC9, 0xDF, 0x94, 0x6F, 0xD4, 0xF1,
-    0xC6, 0xD5, 0xEC, 0xDE, 0xF1, 0xBD, 0x63, 0x53, 0x27, 0x75, 0xD4, 0xC2, 0x9C, 0x17, 0x2D, 0xBC,
-    0xFE, 0x70, 0xB1, 0x75, 0xD4, 0x8F, 0x53, 0x09, 0xFA, 0xBE, 0x32, 0x7D, 0xF5, 0x6C, 0xCC, 0x7C,
-    0xF3, 0xD4, 0x75, 0xEE, 0x3C, 0x8C, 0xB0, 0x1F, 0x00, 0x74, 0x9C, 0x06, 0xA5, 0xF0, 0xC4, 0xAB,
-    0xAC, 0x95, 0xB6, 0x56, 0xDB, 0xB0, 0x6F, 0x9E, 0xFA, 0x05, 0x9D, 0xFC, 0xFD, 0x12, 0x68, 0xFD,
-    0x92, 0xC8, 0x03, 0xF6, 0x39, 0x2C, 0x81, 0x2F, 0x7C, 0xE7, 0x31, 0xAC, 0xA8, 0x0E, 0xE1, 0x86,
-    0xF7, 0x24, 0xFC, 0x6A, 0x8E, 0xFC, 0x0B, 0x7E, 0x33, 0xC4, 0x36, 0x6C, 0xDC, 0x39, 0xDC, 0xD6,
-    0x8E, 0xC1, 0xB4, 0xBE, 0x05, 0x31, 0x01, 0x78, 0x80, 0xFA, 0x20, 0x53, 0x89, 0xAB, 0xA0, 0xF2,
-    0xA7, 0x4F, 0xCD, 0xDD, 0xDF, 0x7E, 0xF8, 0xF1, 0xD0, 0x6D, 0x76, 0x89, 0xF1, 0x0C, 0x2A, 0xF2,
-    0x24, 0x87, 0xC0, 0x9C, 0xCA, 0xA6, 0x6B, 0xA2, 0x5B, 0xB4, 0x61, 0x9D, 0xA5, 0xD2, 0xB3, 0xAD,
-    0x39, 0x13, 0xDD, 0xDF, 0x8A, 0xA9, 0x17, 0x03, 0xA2, 0x39, 0x1B, 0x0C, 0x9F, 0xF3, 0x09, 0xC4,
-    0xC6, 0x86, 0x87, 0x2F, 0xF5, 0x21, 0x4B, 0xBC, 0x45, 0x25, 0xFD, 0xAD, 0xC9, 0x3D, 0xF2, 0x60,
-    0xF2, 0xAC, 0x01, 0xB9, 0x87, 0x68, 0x93, 0xE6, 0x7F, 0x67, 0xF2, 0x29, 0xB2, 0xFD, 0x44, 0xF6,
-    0x3C, 0x16, 0x21, 0x1D, 0x83, 0xD7, 0xE9, 0x10, 0x84, 0x75, 0x50, 0xF3, 0xED, 0x92, 0x0C, 0xCD,
-    0x70, 0xF0, 0x45, 0x4F, 0x11, 0x01, 0x3B, 0x13, 0x75, 0x94, 0x29, 0xF1, 0x02, 0xB2, 0xE2, 0xC4,
-    0xB3, 0x73, 0xEF, 0x93, 0xDA, 0x69, 0xB2, 0x83, 0xD7, 0xFB, 0x9D, 0x2A, 0x19, 0xD0, 0xA5, 0xA5,
-    0x51, 0x43, 0x01, 0x9D, 0x25, 0xAE, 0x3A, 0x9C, 0xD3, 0x75, 0xDE, 0x03, 0x14, 0x4F, 0x0E, 0x4B,
-    0xBF, 0x56, 0x67, 0x63, 0x89, 0xCE, 0x4E, 0xC0, 0x36, 0xA7, 0x99, 0xB6, 0x2B, 0xFC, 0xDB, 0xDA,
-    0xA9, 0xCD, 0x3F, 0x34, 0xB1, 0xA9, 0xF9, 0x86, 0xCA, 0x9A, 0x86, 0xA6, 0x8B, 0xA8, 0x38, 0x28,
-    0x18, 0xF2, 0x88, 0x77, 0x47, 0x37, 0x85, 0x84, 0x3D, 0xA2, 0x63, 0x5F, 0x65, 0x61, 0x56, 0xE8,
-    0x6D, 0x27, 0xCE, 0xAF, 0x84, 0x97, 0xA5, 0x02, 0x51, 0x11, 0xB1, 0x11, 0xEC, 0x82, 0x72, 0x53,
-    0xF6, 0x02, 0x60, 0x71, 0x8B, 0xFA, 0x8F, 0x05, 0x63, 0x56, 0x64, 0xF3, 0xCA, 0x67, 0x07, 0x9E,
-    0x2A, 0xE2, 0x4E, 0xC5, 0x45, 0x91, 0xD5, 0x24, 0xFF, 0x49, 0xF6, 0x73, 0xEE, 0x91, 0x5A, 0xCE,
-    0x4B, 0xBB, 0x6D, 0x65, 0x73, 0x0B, 0x43, 0x93, 0xDC, 0x87, 0x67, 0x5C, 0x13, 0x3E, 0x04, 0xC7,
-    0x05, 0x91, 0x30, 0xE7, 0x6B, 0x00, 0x53, 0x96, 0x6C, 0xA0, 0x22, 0x5D, 0x54, 0xFB, 0x0F, 0x51,
-    0xC9, 0xB3, 0xAD, 0xB5, 0x13, 0x13, 0x90, 0x7A, 0x36, 0x2A, 0xFC, 0x12, 0x74, 0x14, 0x67, 0xE9,
-    0x05, 0x17, 0xC7, 0xFC, 0xB3, 0x98, 0x7E, 0xA0, 0x9C, 0xE4, 0x1E, 0xC2, 0xD4, 0xC7, 0x7D, 0xA1,
-    0x3C, 0xB5, 0xE2, 0x94, 0xDF, 0x00, 0xA1, 0x35, 0x1C, 0xD9, 0x6C, 0x64, 0x37, 0xF1, 0xEB, 0xB6,
-    0x2B, 0xBB, 0xAB, 0x4B, 0x85, 0xE9, 0x5B, 0x3A, 0xA0, 0x81, 0xC5, 0x4B, 0xAA, 0x0C, 0xB4, 0x0A,
-    0x12, 0x49, 0x10, 0x98, 0x50, 0x9A, 0x64, 0xEC, 0xDC, 0x53, 0xFB, 0x8E, 0x0A, 0xD4, 0x06, 0xDD,
-    0x20, 0x0A, 0x40, 0x26, 0x46, 0xAB, 0xAD, 0x9B, 0xCB, 0x5B, 0x6A, 0xB5, 0xDB, 0xCC, 0x07, 0xB5,
-    0x1D, 0x0F, 0x1C, 0x5A, 0xDF, 0x77, 0xE6, 0x85, 0x69, 0x2E, 0x31, 0xEB, 0x44, 0x39, 0xD6, 0xA7,
-    0xAF, 0xC1, 0x99, 0xD2, 0xB0, 0xF0, 0xE1, 0xDA, 0xCF, 0xF6, 0xEB, 0xC9, 0x10, 0x0E, 0x48, 0xB3,
-    0x17, 0x2C, 0x22, 0xEE, 0xE9, 0xE8, 0xBD, 0x25, 0x16, 0x46, 0xE9, 0x2A, 0x10, 0x5E, 0xC6, 0x0A,
-    0xBD, 0x5C, 0xD2, 0xA9, 0x36, 0xDC, 0xC1, 0xD5, 0x17, 0x00, 0x3C, 0xFB, 0x06, 0x81, 0x7D, 0x7D,
-    0xA0, 0x90, 0xF8, 0xA6, 0x24, 0x2F, 0x49, 0x32, 0x70, 0x06, 0x80, 0x7A, 0xF8, 0x9C, 0x05, 0xF9,
-    0x90, 0x0D, 0x95, 0x4C, 0xD0, 0xCF, 0x1F, 0x79, 0xD5, 0x26, 0xE0, 0x6D, 0x6D, 0x11, 0x94, 0xFF,
-    0xBF, 0x35, 0x81, 0x21, 0xE8, 0xF6, 0x4A, 0xE3, 0x37, 0xC9, 0xF3, 0xDD, 0x23, 0xF0, 0x81, 0xF5,
-    0x42, 0x93, 0x3A, 0xAF, 0xE8, 0x2E, 0x02, 0xB3, 0xFF, 0x54, 0xDD, 0x9D, 0x7B, 0xBC, 0x95, 0x1A,
-    0xA8, 0x53, 0xA7, 0xC2, 0x92, 0xE1, 0x47, 0x28, 0x82, 0x2A, 0xC1, 0xFF, 0xA4, 0x54, 0x97, 0x1E,
-    0xAB, 0xD9, 0xA7, 0x20, 0x3B, 0x54, 0xC0, 0xB4, 0xC6, 0x84, 0xC4, 0xCD, 0xA1, 0xCF, 0xC1, 0xCC,
-    0xF5, 0x7A, 0x7C, 0xBD, 0xE2, 0x48, 0x2E, 0x0F, 0xBB, 0xB0, 0x6D, 0xEF, 0xF6, 0x7E, 0x1F, 0xD4,
-    0xCE, 0x80, 0xB5, 0x07, 0x24, 0xF5, 0x19, 0xE7, 0xFC, 0xA8, 0x82, 0xA6, 0x08, 0xA8, 0x23, 0x50,
-    0xED, 0x7A, 0x60, 0x44, 0x0F, 0xBF, 0xED, 0x41, 0x7A, 0xCE, 0xC1, 0x16, 0x9A, 0xA6, 0x08, 0x41,
-    0x41, 0xEF, 0xB7, 0x2C, 0x53, 0xE1, 0x41, 0x73, 0x85, 0x0E, 0x06, 0xA1, 0x3F, 0x87, 0xF9, 0x15,
-    0x84, 0xCF, 0xB9, 0xE9, 0x19, 0x3C, 0xDC, 0xA9, 0x82, 0xD6, 0x47, 0xA9, 0xD3, 0xAC, 0x4D, 0xA2,
-    0x7B, 0x95, 0xF3, 0x55, 0x13, 0xA7, 0xFE, 0xAF, 0x52, 0x40, 0xCE, 0x6D, 0x48, 0x69, 0xD0, 0x1C,
-    0x79, 0xB4, 0x68, 0x54, 0x42, 0xC0, 0x39, 0x77, 0x5F, 0x1B, 0xAD, 0x09, 0x20, 0xFE, 0x04, 0x5A,
-    0xBC, 0x89, 0xBF, 0x22, 0x04, 0xD3, 0xD0, 0x26, 0x9C, 0xBE, 0xC0, 0xB0, 0xCD, 0xA2, 0xBD, 0x60,
-    0x15, 0x30, 0x8E, 0xA5, 0x74, 0x84, 0x3E, 0x8C, 0x73, 0x79, 0xE6, 0x5E, 0x67, 0xD5, 0x39, 0x73,
-    0x1D, 0x85, 0x0D, 0x2F, 0xB2, 0x53, 0xEE, 0xF9, 0xC6, 0x1B, 0xCC, 0x32, 0x5B, 0x08, 0x0D, 0x7D,
-    0xF6, 0x10, 0xBC, 0x9B, 0x41, 0xE1, 0x33, 0x1D, 0x01, 0x07, 0x68, 0xF3, 0x20, 0x70, 0x71, 0x56,
-    0x60, 0x4D, 0xB8, 0x7B, 0x36, 0xDF, 0x7A, 0xE3, 0x60, 0x92, 0xFB, 0xE9, 0x67, 0xB2, 0xED, 0x37,
-    0x47, 0x2F, 0xB5, 0x9D, 0x09, 0x81, 0x73, 0xD2, 0x69, 0x82, 0x85, 0xFF, 0x69, 0x7E, 0x5D, 0x5B,
-    0x69, 0xB0, 0xBE, 0x31, 0x7A, 0x34, 0x68, 0xF6, 0x1A, 0xEA, 0xB9, 0x06, 0x3A, 0x4F, 0xE0, 0x8A,
-    0xD4, 0x6A, 0xFA, 0x83, 0x47, 0xA5, 0xE3, 0x2B, 0x34, 0xDC, 0xF5, 0xF1, 0x1E, 0x44, 0xEC, 0x36,
-    0x7B, 0xD7, 0xBE, 0xA9, 0x14, 0x54, 0x08, 0xEA, 0x96, 0xF4, 0x40, 0x3B, 0x79, 0x11, 0x55, 0xC0,
-    0xBB, 0x68, 0x58, 0x2B, 0x12, 0x8C, 0x73, 0xB7, 0x05, 0x4A, 0x76, 0x62, 0x90, 0x2D, 0x48, 0xD1,
-    0xA1, 0x77, 0x6A, 0xFD, 0xC0, 0x6C, 0xCA, 0x50, 0x10, 0xC4, 0x82, 0x2E, 0xF3, 0x58, 0x32, 0xA5,
-    0x70, 0xDC, 0xB6, 0x0C, 0x3F, 0xCB, 0x8A, 0xB0, 0xF4, 0x1A, 0x4A, 0x07, 0xCC, 0x8E, 0xE1, 0x16,
-    0x41, 0xC5, 0xDD, 0x4E, 0x8A, 0x87, 0x74, 0x90, 0x30, 0xDE, 0x6F, 0x22, 0xB9, 0x95, 0x94, 0x0F,
-    0x18, 0x56, 0x7B, 0x1D, 0xEB, 0x53, 0x76, 0xCE, 0x14, 0x50, 0x71, 0xF9, 0x7C, 0xAA, 0xD3, 0x43,
-    0x77, 0xC4, 0x7D, 0xEB, 0x23, 0xCE, 0xF6, 0xF6, 0xE9, 0x4B, 0x49, 0x0B, 0x21, 0x6F, 0xD9, 0x42,
-    0x1E, 0x80, 0xE5, 0xB4, 0x8F, 0xB2, 0xF3, 0x5A, 0xC9, 0x4D, 0xD3, 0x86, 0x0C, 0xA1, 0xEA, 0x00,
-    0x47, 0x20, 0x07, 0xF4, 0x01, 0x3D, 0x93, 0xBB, 0x8D, 0xF7, 0x45, 0x25, 0x9D, 0xFF, 0x61, 0x23,
-    0x99, 0x5F, 0xA2, 0x62, 0x7E, 0x43, 0x53, 0x20, 0xD2, 0x3E, 0x12, 0x27, 0xA4, 0x9C, 0xB3, 0xD2,
-    0x27, 0x6F, 0x12, 0xB5, 0x70, 0xE3, 0x78, 0xAE, 0x85, 0x8B, 0xD6, 0xE4, 0x6B, 0xCB, 0x82, 0xD2,
-    0x5F, 0xEE, 0x31, 0xE9, 0x7E, 0xD2, 0xB0, 0x7C, 0xB1, 0xEF, 0xE8, 0xCC, 0x10, 0x8A, 0xAF, 0x7F,
-    0x1C, 0x21, 0xF5, 0xFB, 0xF5, 0x25, 0xB6, 0x37, 0x08, 0x83, 0xE9, 0xE2, 0x03, 0x41, 0xC4, 0x9E,
-    0x26, 0x2C, 0x10, 0x52, 0xE3, 0x47, 0xC6, 0x93, 0x6C, 0x2E, 0xE2, 0xD2, 0x69, 0xDD, 0x7B, 0xD7,
-    0xFD, 0x2A, 0x5E, 0x5F, 0x8F, 0x3E, 0xBE, 0xFF, 0xB0, 0x62, 0xA6, 0x47, 0xEF, 0x1B, 0x56, 0x70,
-    0x00, 0xF5, 0xAA, 0x3F, 0x92, 0xF1, 0x6D, 0x0F, 0xDD, 0x0F, 0x98, 0x69, 0xC9, 0x3D, 0xEE, 0x4D,
-    0xD9, 0x76, 0x59, 0x7E, 0x07, 0x4C, 0xA4, 0x63, 0x2F, 0xE5, 0xE8, 0x3B, 0x21, 0x54, 0x05, 0x71,
-    0x2D, 0x2C, 0xF8, 0x8E, 0x24, 0x13, 0x7A, 0xEA, 0x7C, 0xFB, 0x4C, 0x6C, 0xAD, 0xB1, 0x38, 0x80,
-    0x02, 0x0C, 0x27, 0x23, 0x2D, 0x37, 0x61, 0xCE, 0x0E, 0x36, 0x08, 0xD9, 0xC1, 0x1D, 0xD8, 0x31,
-    0x03, 0x6A, 0x3B, 0x5C, 0x35, 0x28, 0xC7, 0x0F, 0x6D, 0x94, 0xA0, 0x39, 0x36, 0x4D, 0x8B, 0x0F,
-    0x26, 0xAF, 0x04, 0x9C, 0xB9, 0x6C, 0xA7, 0xAE, 0x35, 0xCF, 0x4E, 0xDC, 0xDF, 0x1E, 0xDF, 0xE9,
-    0xB3, 0x68, 0xE6, 0xB1, 0xE2, 0x0B, 0x06, 0x98, 0xDB, 0x19, 0x77, 0x30, 0x14, 0x46, 0xB5, 0xBC,
-    0xD7, 0x9E, 0x44, 0x3D, 0x62, 0xBA, 0xE8, 0x4A, 0xDC, 0xC7, 0x1B, 0xE3, 0x1D, 0x76, 0x6B, 0x84,
-    0x01, 0x79, 0xB9, 0x16, 0xC6, 0x1D, 0xE4, 0xC5, 0x99, 0x3D, 0x26, 0x8D, 0x5D, 0x1E, 0x8E, 0x08,
-    0x5E, 0x84, 0x12, 0x4E, 0x05, 0x36, 0xD9, 0x6E, 0x6D, 0xF2, 0x85, 0x9C, 0x84, 0xAF, 0xB0, 0x24,
-    0x7C, 0x81, 0xF0, 0x1A, 0x8B, 0xA0, 0x6B, 0x87, 0x8B, 0x2D, 0xE7, 0x64, 0x49, 0x76, 0xB2, 0x70,
-    0x08, 0xFA, 0xC1, 0xAB, 0x59, 0x3A, 0x36, 0x42, 0xEC, 0x9A, 0xE4, 0x4F, 0xC6, 0x37, 0x5B, 0x17,
-    0xEF, 0x73, 0x84, 0x66, 0xB9, 0x3D, 0x9A, 0x2C, 0xDF, 0xC9, 0x3D, 0xF5, 0x5F, 0x6D, 0x4B, 0xDB,
-    0x88, 0x2F, 0xE0, 0xCD, 0x11, 0xBE, 0x5F, 0x9E, 0x0C, 0x48, 0x1D, 0x40, 0x22, 0xEF, 0x1E, 0x27,
-    0x51, 0x1D, 0xEB, 0x54, 0x8E, 0xFD, 0x03, 0x35, 0x5A, 0xA9, 0x06, 0xD4, 0xE6, 0x1D, 0x92, 0xC4,
-    0xB6, 0xEB, 0x64, 0xA7, 0xCC, 0xB3, 0x59, 0x99, 0x71, 0xEE, 0x0F, 0x46, 0x7A, 0x32, 0xD2, 0x9D,
-    0x1B, 0x79, 0xB4, 0xFA, 0xA9, 0x97, 0x8D, 0xD8, 0x49, 0x3A, 0x76, 0xBC, 0x97, 0xB6, 0x53, 0xDB,
-    0x8B, 0x6F, 0xD9, 0x0A, 0x5E, 0x41, 0x47, 0xD1, 0x84, 0xAF, 0x56, 0x3E, 0x49, 0xEA, 0xFC, 0x5F,
-    0xD5, 0x5C, 0x3D, 0x90, 0xDD, 0xD6, 0x75, 0xBE, 0x00, 0x76, 0x09, 0x99, 0xB0, 0x05, 0x66, 0x46,
-    0x4C, 0x3C, 0x66, 0x2C, 0xA8, 0x70, 0xA1, 0x68, 0x22, 0x21, 0x85, 0x0B, 0x15, 0xE4, 0x02, 0x96,
-    0x0A, 0x15, 0x2E, 0xC4, 0x42, 0x34, 0x3D, 0x66, 0x41, 0x15, 0x2E, 0x32, 0x6E, 0xB6, 0x51, 0xE1,
-    0x99, 0x70, 0x1F, 0x40, 0xA9, 0x70, 0xA1, 0xC2, 0xEB, 0x99, 0x24, 0x8D, 0x1B, 0x15, 0x76, 0x26,
-    0xB3, 0x2A, 0xD6, 0x85, 0x0A, 0xCE, 0xE4, 0xBD, 0x07, 0x58, 0x2C, 0x54, 0xB8, 0x10, 0x2C, 0x8F,
-    0xA2, 0xC9, 0xB8, 0x30, 0x9C, 0x91, 0x9C, 0x31, 0x5D, 0x2C, 0x2C, 0x83, 0x31, 0xC8, 0x05, 0x70,
-    0xF3, 0x7D, 0xE7, 0x02, 0xEF, 0x6F, 0x69, 0x47, 0xB6, 0x65, 0x8A, 0xDE, 0x11, 0xB1, 0xE4, 0x7B,
-    0x17, 0xB8, 0xE7, 0xFF, 0x7C, 0xE7, 0x9C, 0x0B, 0x29, 0x35, 0xFC, 0x44, 0xBA, 0xC1, 0xD5, 0xD7,
-    0x1D, 0xAE, 0xD6, 0xA5, 0x4B, 0x6A, 0xF3, 0xC7, 0x92, 0xAB, 0x9F, 0xCB, 0xB5, 0xE2, 0xD5, 0xE5,
-    0x52, 0xE5, 0xE8, 0x18, 0x57, 0xFB, 0xB7, 0x25, 0xFF, 0x51, 0xB7, 0xBC, 0x4E, 0x23, 0x5E, 0x2F,
-    0xC8, 0xDA, 0x1D, 0xBB, 0xC6, 0x35, 0x50, 0x73, 0xDE, 0x96, 0x06, 0xF8, 0xC8, 0xCB, 0x1D, 0xDC,
-    0xEE, 0x94, 0x0A, 0x6B, 0xED, 0xBB, 0x07, 0x19, 0x6E, 0xD7, 0x5A, 0xE3, 0xF6, 0xFE, 0xE0, 0x75,
-    0x7C, 0xB4, 0xA7, 0x54, 0x02, 0x6A, 0x64, 0xAB, 0x30, 0x56, 0x4E, 0x2D, 0x7B, 0xF6, 0xCA, 0x2B,
-    0xF0, 0x69, 0x1E, 0xEA, 0xD8, 0xCA, 0x74, 0x88, 0xE5, 0x5A, 0xE7, 0x86, 0xCE, 0x4C, 0x57, 0xCA,
-    0xD3, 0x5A, 0xDD, 0xE3, 0x27, 0x29, 0x6F, 0xA8, 0x50, 0x1F, 0x29, 0xFF, 0x76, 0x56, 0xD9, 0x0D,
-    0x1E, 0x92, 0x60, 0x77, 0x3C, 0xAE, 0xB5, 0x1A, 0x10, 0x13, 0x2A, 0xAB, 0x06, 0x29, 0x91, 0x9A,
-    0x28, 0xB7, 0x72, 0x4B, 0x7C, 0x3D, 0x53, 0x61, 0xE9, 0x95, 0xEE, 0xEC, 0xA1, 0xCC, 0xFE, 0xCD,
-    0x3B, 0xEF, 0xF5, 0xED, 0x4E, 0x1B, 0x69, 0x47, 0x5B, 0x3A, 0x8D, 0x52, 0x2B, 0x56, 0xF1, 0xF2,
-    0xC1, 0x7F, 0xAB, 0x3E, 0x2D, 0xFC, 0xF8, 0x14, 0xC0, 0x9D, 0x5D, 0x7E, 0x93, 0x88, 0x1C, 0x5C,
-    0xB9, 0xAA, 0xAD, 0x55, 0x2A, 0xCE, 0xC8, 0x55, 0x24, 0xA3, 0x0C, 0x99, 0x49, 0x21, 0x12, 0xA7,
-    0x64, 0x54, 0x38, 0x11, 0x89, 0x3E, 0x4F, 0x61, 0x79, 0x37, 0x29, 0x58, 0xA7, 0xE0, 0x5A, 0xA7,
-    0x04, 0xF7, 0xCA, 0xAA, 0x3C, 0x0A, 0xB6, 0xB1, 0xF8, 0xD1, 0x94, 0x62, 0x51, 0x3B, 0x22, 0x90,
-    0xF0, 0xE0, 0xF5, 0x9A, 0xEA, 0xD2, 0x3D, 0xAE, 0xB7, 0x0E, 0xB2, 0x5C, 0xB9, 0x05, 0xD8, 0x50,
-    0x94, 0x6D, 0xAB, 0x28, 0xF4, 0x28, 0xE6, 0x9E, 0x7E, 0x09, 0xAE, 0x94, 0xD3, 0xDA, 0xBA, 0x56,
-    0xE7, 0xF4, 0x87, 0x58, 0xEE, 0x6B, 0x43, 0x8A, 0x7A, 0x5A, 0x7D, 0x01, 0x52, 0x05, 0x0B, 0xC9,
-    0x51, 0x09, 0x35, 0x42, 0xFD, 0xEE, 0x9D, 0xFB, 0x21, 0xC1, 0x07, 0x53, 0x1E, 0xB6, 0x18, 0xB0,
-    0x23, 0x94, 0x38, 0xF2, 0x77, 0x55, 0x1B, 0xC7, 0xF8, 0x67, 0x21, 0xC8, 0x50, 0x3A, 0xFF, 0xD8,
-    0xE5, 0x92, 0x43, 0x2E, 0xE4, 0xF2, 0x3C, 0xF9, 0x4D, 0x87, 0x5D, 0x7D, 0x92, 0x01, 0xBB, 0x56,
-    0x76, 0xB3, 0xD4, 0xC5, 0x37, 0x49, 0x19, 0x69, 0x0D, 0xF1, 0xA1, 0x45, 0x8F, 0x71, 0xA8, 0x2F,
-    0x2B, 0x5E, 0xD3, 0xD8, 0xAE, 0x7E, 0x5F, 0xD9, 0x14, 0x43, 0x70, 0xF7, 0x0A, 0xC8, 0x4A, 0xD5,
-    0x9E, 0x05, 0x3F, 0xBD, 0x06, 0x3F, 0x52, 0xD7, 0x28, 0xBB, 0x97, 0xC4, 0x2D, 0x43, 0xEE, 0x14,
-    0xF1, 0x4E, 0xF1, 0xD5, 0x64, 0x71, 0xC9, 0x16, 0x97, 0xE5, 0x67, 0x91, 0x2C, 0x06, 0x49, 0x65,
-    0xD0, 0xC0, 0x62, 0x3C, 0x7D, 0xA0, 0x53, 0x6C, 0xD1, 0x71, 0x33, 0x12, 0x7A, 0x51, 0x36, 0x2E,
-    0xE8, 0xDA, 0x72, 0x07, 0x65, 0x8E, 0x67, 0xDB, 0xF8, 0xE5, 0x6F, 0x98, 0x13, 0xBC, 0x19, 0x6C,
-    0xF5, 0xBB, 0xA9, 0x9F, 0x6F, 0x41, 0x7F, 0x22, 0xE9, 0xD0, 0x58, 0x03, 0xE4, 0xA4, 0x82, 0x54,
-    0x44, 0x4C, 0xAE, 0xBD, 0x4A, 0x3D, 0x16, 0xE4, 0x6E, 0x1E, 0xFD, 0xA2, 0x83, 0x8B, 0xE7, 0x2A,
-    0x03, 0x03, 0x8F, 0x2C, 0x9F, 0x24, 0xB4, 0x73, 0x77, 0xE7, 0x98, 0xDB, 0xFC, 0xB8, 0xE5, 0x47,
-    0x7B, 0x14, 0xD2, 0xE3, 0x0F, 0x82, 0x34, 0xB6, 0xA1, 0x17, 0x7C, 0xE2, 0x83, 0xAC, 0xBE, 0x16,
-    0x3B, 0x9E, 0xB9, 0xB9, 0x0B, 0x67, 0x7B, 0x68, 0x85, 0x89, 0x8F, 0x45, 0x1A, 0x9F, 0x13, 0x12,
-    0xE3, 0xD1, 0x97, 0xE4, 0xF2, 0xF5, 0x93, 0xA1, 0xF0, 0x93, 0x12, 0xC4, 0x93, 0x8C, 0xDA, 0x4C,
-    0x18, 0xDC, 0xE9, 0xCC, 0x0A, 0x41, 0x88, 0x94, 0x60, 0xDE, 0xFF, 0x45, 0x03, 0xDE, 0x61, 0x37,
-    0x60, 0xDD, 0x16, 0x57, 0x85, 0xCF, 0x90, 0x71, 0xD0, 0x44, 0xBE, 0x33, 0x65, 0x83, 0xED, 0x9B,
-    0xFD, 0x6E, 0x01, 0xAE, 0x3D, 0x04, 0x57, 0x61, 0xFA, 0xB3, 0xEA, 0xF4, 0x90, 0x4D, 0x9C, 0x9A,
-    0x29, 0x25, 0x21, 0xDD, 0x9E, 0x26, 0x3D, 0x72, 0xF1, 0xD3, 0x35, 0xDE, 0xCF, 0x69, 0xF8, 0x49,
-    0xC8, 0x1C, 0x93, 0xFC, 0x72, 0xB7, 0x11, 0xE6, 0x55, 0x12, 0x23, 0x29, 0x81, 0x53, 0x37, 0xC7,
-    0xBD, 0x56, 0x21, 0xDC, 0x4B, 0x68, 0x71, 0xEA, 0x45, 0x74, 0x12, 0x2E, 0x03, 0xF9, 0x86, 0x1E,
-    0x6A, 0x6F, 0x7C, 0xE8, 0x88, 0x6F, 0x82, 0x26, 0x27, 0x15, 0x01, 0xD8, 0xFA, 0x56, 0x56, 0x72,
-    0x9F, 0x42, 0x21, 0x47, 0xC5, 0xA3, 0x04, 0xB6, 0x40, 0xEE, 0x53, 0xD0, 0x6E, 0x80, 0x20, 0xE4,
-    0xBF, 0x5A, 0x28, 0xEF, 0x08, 0x77, 0x20, 0x4A, 0x59, 0xCD, 0xBA, 0x86, 0x98, 0x3A, 0x22, 0xA8,
-    0x16, 0xE6, 0xE0, 0x54, 0x96, 0xF8, 0x12, 0xF9, 0x08, 0x07, 0x65, 0x4C, 0x86, 0x3F, 0xF3, 0xE1,
-    0x0F, 0x24, 0x03, 0x5A, 0xC0, 0x03, 0x2C, 0x22, 0x94, 0x14, 0x18, 0x0F, 0x1B, 0xDA, 0xB1, 0x45,
-    0x71, 0xE4, 0x0C, 0x22, 0x6E, 0x49, 0x6D, 0x3A, 0x8D, 0x90, 0xAE, 0x25, 0x6D, 0x27, 0x92, 0xC2,
-    0x83, 0x0D, 0xFB, 0x38, 0x27, 0x29, 0x38, 0x93, 0xF8, 0xF9, 0x6F, 0xCD, 0x29, 0xD0, 0x01, 0x72,
-    0x43, 0x89, 0x9F, 0x6E, 0xC3, 0x2B, 0xB8, 0x47, 0x38, 0x85, 0xD1, 0x50, 0x4A, 0xBD, 0x44, 0xA8,
-    0x7E, 0x48, 0xCD, 0xE6, 0x4A, 0x6B, 0xED, 0xC4, 0x82, 0x3A, 0x0A, 0x16, 0x11, 0x3A, 0x12, 0x19,
-    0x99, 0x80, 0x30, 0x19, 0x43, 0x6F, 0x98, 0xE3, 0x7B, 0x9A, 0x52, 0xAB, 0x9C, 0x0E, 0xCF, 0xB3,
-    0x92, 0x8A, 0x32, 0x03, 0xF5, 0xD8, 0x7C, 0x5F, 0x9D, 0x4C, 0x9C, 0x17, 0xE4, 0xBA, 0x47, 0xA7,
-    0x8A, 0xA7, 0x12, 0xF8, 0x1A, 0xA2, 0x8E, 0x92, 0x7A, 0xF2, 0x0A, 0xB2, 0xE4, 0xFF, 0xB0, 0x10,
-    0x68, 0x12, 0x2F, 0x54, 0x1F, 0xC8, 0x95, 0x09, 0xC3, 0xED, 0x29, 0xBC, 0x50, 0xF0, 0x41, 0x76,
-    0xC5, 0x88, 0xBD, 0x13, 0x8A, 0xA6, 0x02, 0x31, 0x5A, 0xB9, 0xA5, 0xA1, 0x9C, 0x2D, 0x26, 0x09,
-    0x09, 0x5E, 0x3B, 0x64, 0x15, 0x24, 0x83, 0x62, 0x89, 0xDC, 0x94, 0xF8, 0x3F, 0x15, 0xA9, 0x62,
-    0xF0, 0x2E, 0x90, 0x2E, 0x6F, 0x1E, 0xE5, 0x8A, 0xF1, 0x1B, 0x1B, 0x35, 0xB4, 0x82, 0x35, 0x70,
-    0xF0, 0x27, 0x48, 0x72, 0x7B, 0xF7, 0xDD, 0x8B, 0xAA, 0x47, 0x12, 0xAB, 0x54, 0x77, 0x3A, 0xBB,
-    0xF5, 0xDA, 0xEF, 0x91, 0xE4, 0xFC, 0x0F, 0x90, 0xE4, 0x76, 0x3C, 0xE6, 0x0B, 0x5E, 0x04, 0x49,
-    0xC9, 0x7E, 0xA7, 0x0F, 0x7F, 0x49, 0xD1, 0xB4, 0xA3, 0xC0, 0x20, 0x2F, 0xEB, 0x06, 0xB6, 0x0A,
-    0x74, 0x46, 0x50, 0xD0, 0x63, 0x67, 0xBB, 0xE3, 0x96, 0x2D, 0xEF, 0x69, 0x8D, 0xA0, 0x44, 0x4E,
-    0x22, 0x26, 0x91, 0xD2, 0xC4, 0xA8, 0x35, 0x2C, 0x8D, 0x88, 0x44, 0x42, 0x22, 0x20, 0x91, 0x8F,
-    0x88, 0x67, 0x55, 0x3A, 0x0E, 0x61, 0x9B, 0x12, 0x09, 0x9D, 0xBD, 0x74, 0xF1, 0x44, 0x94, 0xD2,
-    0x94, 0x5A, 0x84, 0x6B, 0x6A, 0x65, 0x07, 0x87, 0x05, 0x29, 0x12, 0xFC, 0x77, 0x9E, 0xFB, 0x3D,
-    0xAC, 0x24, 0xEB, 0x9B, 0x1C, 0x2C, 0x41, 0x4A, 0xBC, 0xD6, 0xB9, 0x7B, 0x58, 0x82, 0x3D, 0xE4,
-    0x73, 0x95, 0x1D, 0xFC, 0xFB, 0xEA, 0x37, 0x54, 0xA2, 0xB8, 0x59, 0xCC, 0x7B, 0x2A, 0x7E, 0x73,
-    0x8D, 0xDF, 0x80, 0xF0, 0xDB, 0xDF, 0xC8, 0x62, 0xCA, 0x2A, 0x0F, 0x0D, 0xF6, 0xDC, 0x06, 0x31,
-    0x10, 0x3B, 0xC8, 0x4B, 0x37, 0x71, 0x2F, 0xDC, 0x19, 0x6E, 0xE9, 0x54, 0x61, 0xBC, 0xA3, 0xF6,
-    0xEC, 0xCA, 0xAE, 0x19, 0x78, 0xA6, 0x76, 0xEB, 0x54, 0x49, 0x1E, 0x1C, 0x41, 0x2B, 0x9D, 0x82,
-    0x94, 0x44, 0xAA, 0x20, 0x37, 0x85, 0x4F, 0xC6, 0xFA, 0xBB, 0x0D, 0x02, 0x21, 0x82, 0x61, 0x39,
-    0x26, 0x47, 0x79, 0x52, 0xA1, 0x52, 0x2A, 0x8B, 0xD9, 0xF1, 0x3F, 0x6B, 0x3A, 0x7C, 0x63, 0x92,
-    0x80, 0x52, 0x6A, 0x2D, 0x87, 0xFB, 0xA4, 0x09, 0xA4, 0xE0, 0xFB, 0x73, 0x77, 0x0F, 0x3A, 0xDA,
-    0x8F, 0x4F, 0xF0, 0xE2, 0xE4, 0x34, 0x84, 0x72, 0x08, 0x49, 0x1B, 0xC1, 0x2A, 0x3A, 0xE8, 0xA9,
-    0x39, 0x68, 0xDF, 0xBB, 0x7B, 0x90, 0x9E, 0x0C, 0x63, 0x29, 0x02, 0x11, 0xEE, 0xF1, 0xF9, 0x8D,
-    0x4B, 0xBB, 0x47, 0xC4, 0x4D, 0xBE, 0xF2, 0x7A, 0x0D, 0x42, 0x75, 0x6B, 0x8B, 0xE0, 0xE5, 0xE7,
-    0xF3, 0x80, 0xB6, 0x11, 0xE4, 0x14, 0xFE, 0x8A, 0xD9, 0xA9, 0x50, 0x76, 0x7F, 0xEF, 0x30, 0xD5,
-    0x7A, 0x85, 0x53, 0xBA, 0x85, 0x97, 0x03, 0x42, 0x42, 0x20, 0x21, 0x0C, 0x31, 0x72, 0x5B, 0x95,
-    0x20, 0x04, 0x26, 0x9D, 0xC9, 0x48, 0xF0, 0x76, 0xFC, 0x91, 0x30, 0x15, 0x47, 0xBF, 0xE8, 0x61,
-    0x6A, 0x8D, 0x89, 0xD2, 0x46, 0x26, 0xA7, 0xE3, 0xB1, 0x94, 0x70, 0x49, 0xA7, 0x25, 0x1B, 0xFD,
-    0xDD, 0xC9, 0xD4, 0x25, 0xF6, 0x20, 0x32, 0x51, 0xBB, 0xB7, 0x80, 0xF2, 0x20, 0xE9, 0x0B, 0xB4,
-    0x07, 0x5F, 0x2C, 0x3F, 0x35, 0xFC, 0x49, 0xE6, 0x12, 0xD8, 0xE4, 0x48, 0x94, 0xEB, 0x5F, 0x6F,
-    0x88, 0xC9, 0x41, 0x49, 0x78, 0xEB, 0x60, 0xF5, 0x1B, 0x63, 0x43, 0x13, 0x46, 0x17, 0xDC, 0x73,
-    0x9E, 0xDF, 0x04, 0xF2, 0xB4, 0xD4, 0xEA, 0xBE, 0x76, 0x88, 0x2C, 0x06, 0x33, 0xF0, 0x44, 0xF6,
-    0x92, 0xBC, 0x48, 0x9F, 0x36, 0xF7, 0x9F, 0xD9, 0x10, 0x83, 0x03, 0xCF, 0x81, 0x14, 0x60, 0x15,
-    0x14, 0x02, 0x20, 0x29, 0x64, 0x40, 0xA3, 0x80, 0x08, 0x5C, 0x08, 0x0E, 0x12, 0xA0, 0x4D, 0x40,
-    0x00, 0x6E, 0x65, 0xD5, 0xE0, 0x9F, 0x26, 0x41, 0xF6, 0xB7, 0x3F, 0x51, 0x9E, 0x0C, 0xAA, 0x95,
-    0xE7, 0x35, 0x8B, 0xF0, 0xEA, 0x7F, 0x20, 0xBE, 0xB9, 0x80, 0x00, 0xC6, 0x2E, 0xA1, 0x66, 0x3F,
-    0x9F, 0x51, 0xCB, 0x53, 0x35, 0x83, 0x92, 0xDF, 0xAC, 0xBC, 0x0A, 0x3A, 0x76, 0x8F, 0x7B, 0xAA,
-    0xD8, 0xAB, 0x45, 0xC3, 0xA0, 0xFC, 0x31, 0x28, 0xF8, 0xD9, 0x7E, 0xB7, 0xA4, 0x7E, 0x33, 0x50,
-    0x77, 0x35, 0x16, 0x34, 0x7D, 0xDE, 0x00, 0xC2, 0x99, 0xB1, 0x99, 0x80, 0xD4, 0x9E, 0x56, 0xA7,
-    0x10, 0x63, 0x6A, 0x66, 0x76, 0x3F, 0x97, 0x2C, 0xC6, 0x18, 0xED, 0x08, 0x5C, 0xF0, 0xEB, 0x65,
-    0xB4, 0x5F, 0x09, 0x17, 0x78, 0xA6, 0x08, 0xCB, 0xC8, 0xC9, 0xB8, 0x42, 0x44, 0x06, 0x24, 0x22,
-    0x18, 0x41, 0x89, 0x2F, 0xA8, 0x6E, 0x59, 0xA0, 0x8A, 0xA4, 0xC4, 0x19, 0xEC, 0xFE, 0xE0, 0xB5,
-    0x21, 0x26, 0x18, 0x21, 0xCA, 0x0D, 0x40, 0x57, 0x96, 0x32, 0x41, 0x41, 0x64, 0x65, 0xDC, 0x21,
-    0x78, 0xF7, 0xA0, 0x93, 0x08, 0x9A, 0x0F, 0xC2, 0xFA, 0x43, 0x53, 0xF7, 0x9F, 0xEE, 0x13, 0x6A,
-    0x91, 0xBD, 0x02, 0xEE, 0x11, 0xF0, 0x9B, 0xF0, 0x95, 0x8A, 0x6A, 0xD9, 0x01, 0x73, 0xB1, 0x73,
-    0x12, 0xD8, 0x24, 0x4C, 0x17, 0xD9, 0x2F, 0x77, 0x5B, 0x3E, 0x3F, 0x62, 0x3E, 0xF0, 0x53, 0x66,
-    0x8A, 0x82, 0x4C, 0x97, 0x12, 0x2B, 0x36, 0x2D, 0x65, 0x3E, 0x58, 0x57, 0xA8, 0x7F, 0x8A, 0x88,
-    0xA0, 0x7F, 0x83, 0xAD, 0xAE, 0xD4, 0x44, 0x77, 0x2D, 0x72, 0x8A, 0x9A, 0xB8, 0x4C, 0x87, 0x31,
-    0xAD, 0x3E, 0x0F, 0x6A, 0xDC, 0x67, 0xEB, 0x0F, 0x0E, 0x5B, 0x0A, 0x86, 0x3C, 0x00, 0x47, 0x2A,
-    0xF5, 0xC2, 0x10, 0xD1, 0x24, 0x6C, 0x89, 0xDF, 0x46, 0x7C, 0xBA, 0x77, 0x04, 0x72, 0x6D, 0x69,
-    0x02, 0xEC, 0xA1, 0xFC, 0x02, 0x8B, 0x54, 0xE7, 0xFE, 0x7A, 0x74, 0xA3, 0x5E, 0x72, 0xC6, 0x38,
-    0x24, 0xC3, 0xDA, 0xFF, 0x2F, 0x8A, 0x83, 0xA9, 0x38, 0x45, 0x50, 0x42, 0x66, 0x99, 0x32, 0x13,
-    0xFB, 0xCC, 0x99, 0xAC, 0xD9, 0x82, 0x7C, 0x26, 0x59, 0x01, 0x0F, 0xB0, 0x25, 0x32, 0x07, 0x7C,
-    0x94, 0x97, 0x2F, 0xD5, 0xCD, 0xEB, 0x29, 0x12, 0xE6, 0xF6, 0x49, 0xCB, 0x40, 0x8C, 0x4C, 0x0B,
-    0xEE, 0x93, 0x14, 0x76, 0x09, 0x35, 0x31, 0x4D, 0xC6, 0x6E, 0x4D, 0x00, 0x17, 0xF5, 0x60, 0x02,
-    0xF4, 0x93, 0xDC, 0x6F, 0x7C, 0x7F, 0x49, 0x8E, 0x07, 0x6D, 0xA0, 0x58, 0x74, 0x01, 0x03, 0xFB,
-    0xAB, 0xB9, 0x12, 0x45, 0x0E, 0xBB, 0x6D, 0xA9, 0x07, 0x4A, 0xDC, 0x43, 0x15, 0xF8, 0x45, 0x4A,
-    0x80, 0xF8, 0x2D, 0x3B, 0x64, 0xFD, 0xA3, 0x05, 0x08, 0x35, 0xF7, 0x68, 0x7F, 0x20, 0x29, 0xB6,
-    0x92, 0x53, 0x53, 0x38, 0x40, 0xB7, 0x4F, 0x8C, 0x9E, 0xD3, 0xEB, 0xAF, 0x51, 0x8E, 0xF8, 0xAB,
-    0xCD, 0xCC, 0x8E, 0xAD, 0x99, 0xF7, 0x5B, 0xC6, 0x2A, 0x5F, 0x9E, 0xC5, 0xF2, 0x52, 0xC0, 0x10,
-    0x2B, 0xEC, 0x91, 0x1D, 0xA9, 0xB5, 0x0C, 0xB0, 0x4F, 0xFE, 0x07, 0x12, 0x0A, 0x01, 0x77, 0x99,
-    0x60, 0x41, 0xFC, 0x8C, 0x16, 0x4B, 0xBC, 0x5E, 0x13, 0x55, 0x67, 0xA0, 0xE8, 0x16, 0x16, 0x78,
-    0x92, 0x57, 0x4F, 0x1D, 0x18, 0xBB, 0xFE, 0x47, 0x71, 0x3D, 0x01, 0x19, 0xE5, 0xA2, 0x81, 0xF4,
-    0x9A, 0xBA, 0x77, 0x9D, 0x62, 0xD1, 0x05, 0x6D, 0xFD, 0x7D, 0x94, 0xD6, 0x10, 0x41, 0x4B, 0xDC,
-    0xBD, 0x43, 0x49, 0xFA, 0x31, 0x91, 0x5B, 0x9A, 0xAC, 0xE7, 0x7F, 0xC9, 0xF2, 0xA6, 0x4E, 0x9E,
-    0x53, 0x60, 0xBB, 0xE0, 0x56, 0xBF, 0x0D, 0x07, 0xDF, 0x7D, 0xA7, 0xA5, 0x1A, 0x32, 0xFA, 0x6B,
-    0x40, 0x24, 0xC7, 0xE2, 0x39, 0x62, 0xB3, 0xC1, 0x87, 0x83, 0xFF, 0x6B, 0x56, 0x11, 0x27, 0xD5,
-    0xAC, 0x8A, 0x00, 0x96, 0x2C, 0x43, 0xA7, 0x54, 0xE0, 0x06, 0xE8, 0x47, 0xF9, 0x22, 0xC1, 0x6E,
-    0xDD, 0xAB, 0xB9, 0xF4, 0x80, 0x99, 0xF1, 0x03, 0x60, 0x9C, 0xA2, 0x13, 0x6F, 0xA9, 0x8E, 0xE9,
-    0x90, 0x95, 0x86, 0xA8, 0xFE, 0xD9, 0x71, 0xDD, 0x6B, 0x23, 0xA0, 0x37, 0x68, 0xDD, 0x16, 0x63,
-    0xD8, 0x51, 0x23, 0x34, 0x35, 0x01, 0xC5, 0x5B, 0x7E, 0xFA, 0x40, 0x5A, 0xF4, 0xC2, 0x0C, 0x72,
-    0xF3, 0xAB, 0x1D, 0x8C, 0xC2, 0xD4, 0x1F, 0x37, 0x6B, 0xF3, 0x5D, 0x64, 0x8C, 0xCA, 0x89, 0x37,
-    0xAD, 0xC7, 0x67, 0xAE, 0x04, 0xAC, 0x84, 0x1C, 0x23, 0x3C, 0xF6, 0x5C, 0x2D, 0xE9, 0x81, 0xC6,
-    0x62, 0x2A, 0x28, 0xA1, 0x31, 0x32, 0x9A, 0xE2, 0x16, 0xAD, 0xC9, 0x72, 0x13, 0x63, 0x92, 0xA1,
-    0x00, 0x49, 0xB3, 0x86, 0xC9, 0x5D, 0xAC, 0x91, 0xA2, 0xF1, 0x3E, 0xB8, 0x74, 0x69, 0x3E, 0xAC,
-    0x89, 0x17, 0x6B, 0x86, 0x9E, 0x0C, 0xF2, 0x8A, 0x35, 0x3C, 0x67, 0x58, 0x13, 0x0D, 0x6B, 0x4C,
-    0xDF, 0xC6, 0xA5, 0x33, 0x30, 0x03, 0x96, 0xF0, 0x09, 0x3C, 0x11, 0x0B, 0xAC, 0x17, 0x07, 0xBF,
-    0x0D, 0xA0, 0x14, 0xF7, 0xB7, 0x2C, 0x5E, 0xF0, 0x94, 0x39, 0x04, 0x6E, 0x0D, 0x1D, 0x61, 0x00,
-    0x79, 0x86, 0x22, 0x69, 0xBE, 0xC5, 0x83, 0x65, 0x45, 0x26, 0xC5, 0x9A, 0x6C, 0x27, 0x4E, 0xDA,
-    0x8A, 0xB2, 0x93, 0x1C, 0x40, 0x08, 0x39, 0xCF, 0x3F, 0xAA, 0x9C, 0xDF, 0x94, 0x91, 0xDA, 0xB9,
-    0x81, 0x74, 0x79, 0x04, 0x53, 0xC8, 0x72, 0x94, 0xAB, 0x35, 0x56, 0x69, 0x36, 0x55, 0xB1, 0x0A,
-    0x74, 0x86, 0xE0, 0xC0, 0xA9, 0x58, 0x67, 0x3C, 0x14, 0x29, 0xF7, 0x9D, 0xF7, 0x4A, 0x95, 0xB5,
-    0x33, 0x28, 0x01, 0xCF, 0x93, 0x40, 0x12, 0x93, 0x77, 0xA1, 0x94, 0x4A, 0x16, 0x84, 0x50, 0x2C,
-    0x90, 0xF8, 0x7C, 0xD1, 0x85, 0x82, 0x4B, 0xB0, 0x26, 0x0A, 0xE5, 0x57, 0x41, 0xC9, 0x31, 0x7B,
-    0xFB, 0x6B, 0x6B, 0x68, 0x51, 0x8C, 0xFA, 0x89, 0x91, 0x65, 0xF8, 0x2F, 0x97, 0xBE, 0x32, 0xAC,
-    0x99, 0x2D, 0xD6, 0x58, 0x83, 0x9C, 0x26, 0x26, 0xE2, 0xE0, 0x39, 0xF6, 0xB0, 0xA6, 0x1B, 0xD6,
-    0x18, 0x8F, 0x02, 0xCE, 0xF1, 0x40, 0x4F, 0x46, 0xAC, 0x87, 0xD4, 0x4F, 0xF3, 0xBA, 0xA7, 0x80,
-    0xEC, 0xC3, 0xBB, 0xFB, 0x60, 0xA0, 0x5B, 0x13, 0xD0, 0x13, 0xB1, 0x55, 0x07, 0xD0, 0x80, 0x87,
-    0x52, 0xE4, 0xC3, 0x3A, 0x51, 0x3B, 0x53, 0x77, 0x21, 0xA0, 0xC2, 0x6F, 0x46, 0x01, 0x15, 0x1F,
-    0x55, 0x40, 0x76, 0xFD, 0x19, 0xE5, 0x75, 0x8F, 0x42, 0x97, 0xBD, 0x7A, 0xD4, 0x6F, 0xD5, 0xA7,
-    0xDD, 0x72, 0x03, 0x5A, 0x23, 0xA0, 0x80, 0xC4, 0x53, 0x9D, 0x12, 0xDB, 0xA3, 0x4D, 0x90, 0x40,
-    0x72, 0x48, 0x33, 0x21, 0x7B, 0x24, 0x8F, 0x7F, 0x68, 0x85, 0xB4, 0x3B, 0xCA, 0x2B, 0x1A, 0x80,
-    0xD4, 0xD8, 0x90, 0xE8, 0x0C, 0x07, 0xE4, 0x3F, 0x24, 0xF4, 0xD5, 0x06, 0x2E, 0x27, 0xD7, 0xF3,
-    0xA4, 0xAE, 0xA3, 0xA8, 0xF5, 0x11, 0x7A, 0xE3, 0x2F, 0x2C, 0xF7, 0x3D, 0xA5, 0x05, 0xF4, 0x5D,
-    0x5E, 0x74, 0x7C, 0x60, 0xAC, 0xD8, 0x03, 0x5B, 0x53, 0x39, 0x33, 0xD9, 0x00, 0xFB, 0x79, 0x65,
-    0xEA, 0xD4, 0x95, 0x22, 0x04, 0x6C, 0x04, 0x1F, 0xC6, 0x0B, 0xEF, 0xE9, 0xC1, 0x53, 0x87, 0xB2,
-    0xED, 0x85, 0xFB, 0xC5, 0x8F, 0x75, 0xE9, 0x12, 0x6C, 0x2D, 0xCF, 0x4C, 0x13, 0x65, 0x99, 0xAF,
-    0xB0, 0x21, 0xE8, 0x48, 0xE4, 0x99, 0xAE, 0x84, 0x0C, 0xD5, 0x1A, 0xFA, 0x53, 0x5A, 0x22, 0x59,
-    0xC2, 0xBF, 0xE7, 0x0F, 0xA9, 0xE8, 0x79, 0x90, 0x9D, 0x3A, 0xB0, 0x53, 0x98, 0xC1, 0xD6, 0x12,
-    0x7D, 0x38, 0xD0, 0xE8, 0xC3, 0x40, 0xE0, 0x33, 0xB1, 0x1B, 0x9B, 0x76, 0x78, 0xE6, 0xFE, 0x68,
-    0x48, 0xEA, 0x80, 0xFD, 0x3D, 0xF5, 0x46, 0x70, 0x8C, 0x7A, 0xB5, 0x51, 0xC1, 0xFB, 0x1F, 0x8F,
-    0x86, 0x48, 0x33, 0x93, 0xDD, 0xEE, 0xE0, 0x40, 0xF5, 0x22, 0xC2, 0x8C, 0x2E, 0x13, 0x0D, 0x4D,
-    0xCE, 0x6A, 0x11, 0xEE, 0xC6, 0x38, 0x37, 0x59, 0x5B, 0x64, 0x49, 0xAA, 0x8B, 0x3D, 0xC9, 0x8C,
-    0x58, 0x78, 0x43, 0xB1, 0x08, 0x96, 0x9E, 0x58, 0x06, 0xCD, 0x23, 0x70, 0x4A, 0xD5, 0x68, 0xF1,
-    0x69, 0x61, 0x01, 0x23, 0x0B, 0x97, 0x81, 0xD6, 0xCA, 0xF2, 0xA8, 0xB3, 0xAE, 0xB2, 0xD4, 0x0D,
-    0x52, 0x7B, 0xE8, 0x59, 0x4C, 0x4C, 0x27, 0x23, 0xC8, 0xED, 0xE6, 0xB1, 0xE8, 0x79, 0x47, 0x97,
-    0x51, 0x03, 0x40, 0xEF, 0xA5, 0x56, 0x89, 0x72, 0x05, 0xA9, 0x7B, 0xC2, 0x79, 0xD6, 0x50, 0xAA,
-    0x48, 0xE1, 0xE7, 0x51, 0x60, 0xC5, 0x66, 0x5D, 0xFA, 0xE7, 0xE1, 0x90, 0x52, 0x87, 0xD0, 0x2F,
-    0x33, 0x89, 0x4D, 0xC0, 0x8A, 0x9F, 0x3B, 0x95, 0xC5, 0x6C, 0x14, 0xE1, 0x46, 0xAF, 0x7C, 0xA5,
-    0xAE, 0x74, 0x13, 0x35, 0x90, 0xB2, 0x84, 0xBE, 0x2A, 0x94, 0xB0, 0x17, 0x33, 0x72, 0x81, 0x0E,
-    0x41, 0x38, 0x26, 0x65, 0xD4, 0x63, 0xB0, 0xA2, 0x81, 0x24, 0xA6, 0x17, 0xDF, 0x8C, 0xC9, 0x60,
-    0x08, 0x55, 0x43, 0x4E, 0x99, 0x0B, 0x89, 0x43, 0x4A, 0x21, 0x0B, 0xDD, 0x98, 0x2D, 0xA8, 0xE6,
-    0x20, 0x1F, 0x93, 0xCE, 0xDA, 0x23, 0x5C, 0xF3, 0x88, 0xD0, 0xA4, 0x13, 0x01, 0x02, 0x08, 0x44,
-    0x8A, 0x3C, 0x0C, 0xD9, 0x70, 0x66, 0xAA, 0x37, 0x41, 0x19, 0xB9, 0xF4, 0x89, 0xFD, 0x63, 0x03,
-    0xAA, 0xA4, 0xC6, 0x1C, 0x9A, 0x1E, 0xCB, 0xC9, 0xE2, 0x16, 0xF7, 0xCE, 0x28, 0x68, 0x0D, 0xDC,
-    0x05, 0x9D, 0x86, 0xF1, 0x30, 0x20, 0xDA, 0x6C, 0x53, 0xB6, 0x6A, 0xB7, 0x84, 0x5A, 0x75, 0x75,
-    0xB6, 0x55, 0x97, 0x39, 0x43, 0x74, 0x0B, 0x4B, 0x9A, 0xAF, 0xEC, 0x13, 0xB1, 0xE4, 0x95, 0x4B,
-    0x0A, 0x4F, 0x04, 0x20, 0x28, 0x0C, 0x08, 0xA3, 0xF8, 0x70, 0x09, 0x5F, 0x06, 0x27, 0xF0, 0x42,
-    0xC8, 0xB3, 0xC7, 0x8D, 0x11, 0xC3, 0x69, 0xC4, 0x1B, 0xB7, 0x0C, 0xA5, 0xCE, 0xD8, 0x1C, 0x3B,
-    0x43, 0x41, 0xDC, 0xA0, 0xF7, 0x88, 0x56, 0x04, 0x42, 0x3C, 0xB1, 0x9A, 0xC1, 0x25, 0xAB, 0xFB,
-    0x32, 0x95, 0x92, 0x70, 0xD0, 0x51, 0xC5, 0x09, 0xB1, 0x85, 0x97, 0xDA, 0xE9, 0x46, 0x47, 0x2B,
-    0x37, 0xC9, 0x5E, 0x49, 0x8E, 0x1F, 0xF0, 0xD0, 0x66, 0xC1, 0x6A, 0xA0, 0x98, 0x94, 0xDE, 0x32,
-    0x2F, 0x3D, 0x51, 0xB0, 0x9E, 0xA8, 0x70, 0xDB, 0x05, 0xF6, 0x30, 0x58, 0xEB, 0xDE, 0x37, 0xB4,
-    0x63, 0x39, 0xF9, 0xB8, 0xC4, 0x8C, 0xE3, 0x4E, 0x06, 0x95, 0xE9, 0x08, 0x43, 0x97, 0x1D, 0xC2,
-    0x11, 0x76, 0x09, 0x53, 0x73, 0x0E, 0x1C, 0x7E, 0x52, 0x99, 0x22, 0x0E, 0xE5, 0x6C, 0xAC, 0x3E,
-    0xB5, 0x06, 0x81, 0x4F, 0xB1, 0x99, 0x1A, 0x71, 0xE5, 0xE5, 0x6A, 0x24, 0x68, 0x32, 0x22, 0x2C,
-    0x41, 0xB5, 0xD1, 0xB8, 0xB9, 0xE4, 0x1B, 0x71, 0xCA, 0x76, 0xA4, 0x4F, 0xAA, 0xDB, 0xD9, 0xF8,
-    0x2F, 0x7F, 0xED, 0x5F, 0x44, 0x28, 0x5C, 0xF9, 0xE8, 0x15, 0xA8, 0x81, 0x10, 0x57, 0x5A, 0x68,
-    0xD6, 0xF7, 0x06, 0xA7, 0x2B, 0xD9, 0x91, 0xD0, 0x75, 0x80, 0xC0, 0x04, 0x8B, 0xD7, 0xD2, 0x60,
-    0xE9, 0xC5, 0xE0, 0x7B, 0xD9, 0x41, 0xD8, 0xE3, 0x5C, 0x43, 0x85, 0xD7, 0x25, 0xA1, 0xBE, 0x43,
-    0xD9, 0x38, 0x1F, 0x9A, 0x46, 0xBD, 0x08, 0x36, 0x11, 0x19, 0x86, 0x87, 0x02, 0x85, 0x7F, 0x22,
-    0x5F, 0x57, 0x09, 0xFB, 0xA3, 0xAD, 0x00, 0xCE, 0x89, 0x0C, 0x50, 0xC2, 0x34, 0x90, 0xD0, 0xCA,
-    0xDE, 0x17, 0xE7, 0x78, 0x25, 0x15, 0xE4, 0x68, 0xC5, 0x8C, 0x1E, 0xD5, 0x1C, 0x36, 0xDB, 0x7A,
-    0x21, 0x37, 0x6B, 0x69, 0xEB, 0x83, 0x86, 0x8C, 0x32, 0x06, 0x45, 0x19, 0x94, 0xEF, 0xE6, 0xCB,
-    0x7A, 0xF9, 0x2C, 0x1B, 0x06, 0xB9, 0xA9, 0xFA, 0x29, 0x8C, 0x70, 0x08, 0xD7, 0x63, 0x97, 0x9F,
-    0x10, 0x75, 0x8A, 0xF2, 0xBF, 0xC9, 0x3A, 0x75, 0x5C, 0xCE, 0x2C, 0x1D, 0xEF, 0x01, 0xD6, 0x4C,
-    0x9D, 0xC6, 0x6A, 0x9C, 0xCA, 0xAD, 0xDC, 0x02, 0x55, 0x01, 0x0C, 0x93, 0xCD, 0x39, 0xFF, 0x6D,
-    0x94, 0x20, 0xDF, 0x82, 0xAD, 0x3F, 0xDB, 0xA8, 0x10, 0x6E, 0x03, 0xC8, 0x5F, 0xC0, 0xD0, 0xF5,
-    0x9E, 0x19, 0xCE, 0x5F, 0x14, 0xE2, 0x68, 0x56, 0xB4, 0x14, 0xEE, 0xC5, 0xC2, 0x63, 0x67, 0x68,
-    0xFD, 0x0C, 0x2D, 0xE2, 0x53, 0xB8, 0xED, 0x2D, 0x9D, 0x26, 0xD5, 0xE5, 0x32, 0x69, 0xAD, 0x1A,
-    0x14, 0x5C, 0x03, 0x36, 0x0F, 0x01, 0xD9, 0x7D, 0x86, 0x36, 0x6D, 0x5A, 0xA0, 0x62, 0x14, 0x11,
-    0x02, 0xAF, 0x7F, 0xB3, 0x84, 0x56, 0x3B, 0xF5, 0x4C, 0x1D, 0xE4, 0xE5, 0xD4, 0xE9, 0xEB, 0x08,
-    0x9E, 0x04, 0x87, 0x6B, 0xC6, 0x86, 0xBD, 0x58, 0xCA, 0x0F, 0x94, 0x20, 0x21, 0xB9, 0x5D, 0xB0,
-    0x8F, 0x7C, 0xBF, 0x75, 0xC2, 0x35, 0x1C, 0x2A, 0xD9, 0xCA, 0xE2, 0xC1, 0xEE, 0x05, 0x98, 0x47,
-    0xA3, 0x43, 0x88, 0x0D, 0x47, 0xEB, 0xC6, 0x93, 0x0F, 0xF9, 0x4C, 0x0A, 0x33, 0x91, 0x70, 0x32,
-    0x34, 0x79, 0x4B, 0x2C, 0xF7, 0x52, 0x2C, 0xBF, 0xC0, 0x81, 0x6F, 0xE5, 0xDE, 0xFE, 0xC6, 0xE1,
-    0xCB, 0xC0, 0x73, 0x5D, 0x68, 0x40, 0x1D, 0x7E, 0xFE, 0x5E, 0x0A, 0x2B, 0x04, 0x8F, 0xDA, 0x59,
-    0x0C, 0xBA, 0xCF, 0x72, 0x70, 0x42, 0x60, 0x16, 0xCA, 0xC6, 0x91, 0xA8, 0x60, 0x26, 0x3B, 0xB6,
-    0x7C, 0xAC, 0xCD, 0xA2, 0x47, 0xFE, 0x2B, 0x39, 0x51, 0x86, 0x36, 0x7D, 0xF9, 0x0F, 0xC2, 0x84,
-    0xDE, 0xA2, 0x6D, 0x15, 0x3D, 0x4A, 0x9B, 0x62, 0xB7, 0x2C, 0x17, 0xFE, 0x98, 0x1A, 0x04, 0x8D,
-    0x4A, 0x72, 0x30, 0xA6, 0xBD, 0x46, 0xAB, 0xF8, 0xEB, 0x82, 0x51, 0xE3, 0x25, 0xD5, 0xE8, 0xFD,
-    0xDD, 0x1A, 0xA3, 0x20, 0xE5, 0x69, 0x2C, 0xB7, 0x4B, 0x2C, 0xF7, 0x63, 0x2C, 0x9F, 0x5A, 0xDD,
-    0xD7, 0x5E, 0x2F, 0x51, 0xB6, 0xEA, 0x2F, 0x1B, 0xBC, 0xBF, 0x98, 0x93, 0x78, 0x8B, 0x9B, 0xA2,
-    0xD1, 0x13, 0x65, 0xC7, 0x46, 0x06, 0x42, 0xFC, 0xE8, 0xA2, 0xAD, 0x0B, 0x32, 0x3A, 0x95, 0xCE,
-    0x20, 0x53, 0x9D, 0xC4, 0x4C, 0xAC, 0x97, 0x00, 0xCA, 0xFB, 0x4C, 0x17, 0x6C, 0x73, 0xC9, 0x0F,
-    0xE3, 0xE8, 0x51, 0xC8, 0x8C, 0x03, 0xBB, 0x8A, 0x2C, 0x9E, 0x21, 0xF5, 0xA0, 0x76, 0xC2, 0x72,
-    0x2B, 0x60, 0x87, 0xFE, 0xD4, 0x40, 0xC8, 0x23, 0x8B, 0x5A, 0x6F, 0x8F, 0x72, 0x98, 0xD2, 0x65,
-    0x1B, 0x42, 0x17, 0x69, 0xDC, 0x31, 0xCF, 0x58, 0x92, 0x80, 0x62, 0xC3, 0xB1, 0xE8, 0xD7, 0x1F,
-    0xA7, 0x11, 0xE6, 0x12, 0xFC, 0xAE, 0x31, 0x24, 0x65, 0x41, 0xCD, 0xDF, 0xA0, 0x8C, 0x6A, 0x51,
-    0xB1, 0x08, 0x83, 0xEA, 0x2D, 0x32, 0x83, 0xDF, 0x99, 0x18, 0xE9, 0x69, 0x41, 0xBC, 0x1D, 0x4F,
-    0x3D, 0xFD, 0x2C, 0x32, 0x85, 0x8F, 0x75, 0xDF, 0x04, 0x0F, 0xE0, 0xD3, 0x12, 0x33, 0xF1, 0x56,
-    0x92, 0x73, 0xB9, 0xA8, 0x92, 0x28, 0x73, 0x86, 0xA2, 0x3D, 0x53, 0x8E, 0x92, 0x94, 0x48, 0x2D,
-    0xD7, 0xC3, 0xCF, 0xDB, 0x6F, 0x2A, 0x76, 0x75, 0x81, 0xCE, 0xA5, 0x33, 0x70, 0x66, 0x84, 0x01,
-    0x52, 0xBE, 0x09, 0x3C, 0x33, 0x26, 0x2C, 0xCA, 0x16, 0x15, 0x8E, 0x3C, 0x3E, 0x42, 0x1E, 0x3B,
-    0x66, 0x26, 0xB9, 0x10, 0x7D, 0x40, 0x3F, 0x7F, 0x24, 0x8F, 0x67, 0xC5, 0x9D, 0xA8, 0x47, 0xBB,
-    0x5A, 0x14, 0x88, 0x13, 0x43, 0xA6, 0x49, 0xFA, 0x96, 0x54, 0xEC, 0x67, 0x9C, 0xCA, 0xCF, 0x23,
-    0xA7, 0x75, 0xCA, 0x28, 0xDF, 0xB3, 0x2B, 0x2F, 0x5F, 0xFF, 0x1A, 0xB7, 0x5D, 0xA4, 0xE9, 0x92,
-    0x25, 0xD8, 0x2E, 0x3B, 0x23, 0x5B, 0xEA, 0xA3, 0x5B, 0xEF, 0x8F, 0xC1, 0x72, 0x94, 0xA5, 0x82,
-    0xC0, 0xA4, 0xF7, 0x74, 0x8A, 0xB7, 0x30, 0x5B, 0xDA, 0x3F, 0xF9, 0x03, 0xAC, 0xD7, 0xBA, 0x08,
-    0x77, 0x14, 0x66, 0xBC, 0x7C, 0x38, 0xA9, 0xB1, 0x0E, 0x35, 0xEF, 0x94, 0xE4, 0x16, 0xF1, 0x17,
-    0xB1, 0x24, 0x94, 0xBF, 0x5F, 0x98, 0x8E, 0x87, 0x83, 0x46, 0xB0, 0xFD, 0x08, 0xF9, 0x08, 0x74,
-    0xCC, 0x26, 0xAC, 0x5E, 0xC6, 0x18, 0x93, 0xAF, 0x1D, 0x83, 0x47, 0x42, 0x13, 0x7E, 0x0D, 0xF8,
-    0xF0, 0xCC, 0x44, 0x23, 0x2C, 0x97, 0x36, 0xBB, 0x31, 0x70, 0x80, 0x40, 0xB4, 0x00, 0x04, 0x9E,
-    0x8A, 0x71, 0x5B, 0x23, 0xB0, 0xDE, 0x88, 0x5B, 0x4B, 0x00, 0x25, 0x8C, 0xC7, 0x2F, 0xF7, 0x28,
-    0xA7, 0xC9, 0x78, 0x6F, 0x17, 0xD2, 0xFC, 0xF9, 0x91, 0xB4, 0x1F, 0xFC, 0x57, 0x6A, 0xBA, 0x5D,
-    0xF0, 0x4C, 0xC3, 0x5E, 0x7B, 0xA0, 0x5A, 0x7A, 0x63, 0xA8, 0xE6, 0x46, 0x61, 0x91, 0x19, 0x30,
-    0x46, 0xAF, 0x94, 0xB4, 0xB6, 0xE0, 0x66, 0xC1, 0x80, 0xEF, 0xBF, 0x27, 0xFA, 0x71, 0x8F, 0xE5,
-    0x97, 0x34, 0xE2, 0x1B, 0x90, 0x9B, 0x8A, 0x23, 0x33, 0x38, 0xE1, 0xAF, 0x19, 0x71, 0x56, 0x6A,
-    0xAC, 0x65, 0x2C, 0x11, 0xBE, 0xB0, 0xE6, 0xEB, 0xDD, 0xD8, 0x41, 0x61, 0x6F, 0xC5, 0x2E, 0x36,
-    0xBB, 0x81, 0x59, 0x1A, 0x96, 0x41, 0x0F, 0x8D, 0x9F, 0x6D, 0x92, 0x2C, 0x75, 0xDF, 0x2B, 0x66,
-    0x2A, 0xD8, 0x83, 0x08, 0xE7, 0x05, 0xAC, 0x92, 0xB9, 0xC3, 0x27, 0xDA, 0x4C, 0x00, 0x9B, 0x6C,
-    0x4E, 0x1C, 0x7D, 0x02, 0x65, 0x14, 0x96, 0x25, 0x3E, 0x0C, 0x9F, 0x21, 0x6C, 0xBE, 0x16, 0x2A,
-    0xE7, 0xB8, 0x6C, 0x95, 0xDF, 0x23, 0x4C, 0x10, 0x14, 0x93, 0x8A, 0xBF, 0x18, 0x61, 0x0D, 0xED,
-    0x0A, 0x93, 0x95, 0x65, 0xB4, 0xBB, 0xE8, 0x04, 0x8D, 0x1F, 0x0E, 0xD5, 0xC3, 0x9E, 0x59, 0xB9,
-    0xEC, 0xF3, 0xEC, 0x96, 0x5E, 0xE3, 0xEA, 0xEB, 0xBA, 0xDE, 0x9E, 0x04, 0x47, 0xA5, 0x75, 0xBB,
-    0x0E, 0x63, 0xF7, 0x67, 0xF1, 0x4C, 0x85, 0x6F, 0x80, 0x3E, 0x9D, 0x8A, 0x53, 0x4F, 0x60, 0xA3,
-    0x10, 0x66, 0x46, 0x17, 0x67, 0xB1, 0xE1, 0xE7, 0x90, 0x1B, 0xCB, 0x8D, 0x97, 0xF1, 0xAF, 0x00,
-    0xF6, 0xDD, 0x37, 0x11, 0x25, 0xD1, 0xC8, 0xE0, 0x44, 0xCC, 0x74, 0xD1, 0xC2, 0x94, 0x30, 0xB0,
-    0x04, 0x41, 0xF1, 0xA0, 0xD4, 0xED, 0x61, 0xFB, 0x54, 0x3A, 0x66, 0x28, 0xF5, 0x6B, 0x71, 0x40,
-    0x43, 0x6C, 0x97, 0x98, 0x31, 0xCD, 0xD0, 0x77, 0x32, 0x19, 0xCE, 0x80, 0x8D, 0xBF, 0x48, 0x63,
-    0xB6, 0xE2, 0x53, 0x3C, 0x92, 0x01, 0x02, 0x2E, 0x30, 0x2E, 0xB7, 0x88, 0x03, 0xD6, 0x71, 0xA9,
-    0x0C, 0xD2, 0x72, 0xAA, 0xFB, 0x63, 0xCC, 0xA2, 0x7F, 0xCB, 0x80, 0x38, 0xE9, 0xA1, 0x0C, 0x06,
-    0x62, 0xF6, 0x1F, 0xC6, 0x3E, 0xD2, 0x42, 0x1C, 0x3A, 0x93, 0x21, 0xB0, 0x0B, 0x08, 0xB1, 0x74,
-    0x99, 0x74, 0x96, 0x22, 0x2D, 0x78, 0xC4, 0xDE, 0x9E, 0x0C, 0x83, 0x49, 0x0E, 0x3B, 0xBB, 0x4C,
-    0x2F, 0xBD, 0xB0, 0xAA, 0x05, 0x83, 0x91, 0x28, 0x86, 0x24, 0xC9, 0x39, 0xC5, 0x90, 0x7D, 0xF6,
-    0xE4, 0xF1, 0xA1, 0x4D, 0x3B, 0xF0, 0xDF, 0x62, 0x56, 0x06, 0x75, 0xB4, 0x0E, 0x4D, 0xB8, 0x25,
-    0xC7, 0x6C, 0x8C, 0x09, 0xFF, 0xD1, 0xFA, 0x7C, 0xEB, 0xA3, 0xEB, 0x33, 0x34, 0xFA, 0xF4, 0x3F,
-    0xBA, 0x3E, 0x13, 0xA3, 0xCF, 0xA1, 0x5D, 0x3B, 0x0C, 0xF1, 0x44, 0x50, 0xA7, 0x4D, 0xDF, 0xD5,
-    0x3F, 0x2A, 0x4D, 0xE3, 0x46, 0xA4, 0xEA, 0x75, 0xEB, 0xEA, 0x04, 0x06, 0xCD, 0xBE, 0x45, 0x07,
-    0xBB, 0xFC, 0xF3, 0xBE, 0x17, 0xFF, 0xDA, 0xAB, 0xBD, 0x82, 0xEE, 0xC5, 0xA6, 0x17, 0xBD, 0x0B,
-    0x4A, 0x09, 0x63, 0x3A, 0x57, 0x14, 0x33, 0xB3, 0x59, 0x0D, 0x84, 0x32, 0x93, 0xAA, 0x7E, 0xCA,
-    0x0F, 0x21, 0x23, 0x3F, 0x95, 0xFC, 0xDB, 0x0E, 0x28, 0x3A, 0x34, 0xC5, 0xC5, 0x93, 0x01, 0x9B,
-    0xF4, 0xB9, 0x21, 0x7B, 0xB5, 0x88, 0x13, 0x50, 0x68, 0xE6, 0xFD, 0xD6, 0x46, 0x17, 0x69, 0x6C,
-    0xCD, 0xB0, 0x62, 0xB0, 0x25, 0x51, 0x25, 0x1F, 0x5C, 0x6D, 0x09, 0x61, 0x5D, 0x9A, 0x14, 0xB0,
-    0x16, 0x0F, 0x7D, 0xF8, 0x25, 0xB3, 0x4A, 0x98, 0x73, 0xC3, 0x8C, 0xF0, 0xCB, 0x6A, 0xE9, 0xC7,
-    0x6E, 0x25, 0xE7, 0x29, 0xDE, 0xAA, 0x64, 0xBA, 0x99, 0xF3, 0xE0, 0x46, 0x26, 0xA5, 0x08, 0x3F,
-    0x4E, 0xB8, 0xCE, 0x69, 0x04, 0x8D, 0xE7, 0x5C, 0xDD, 0xC9, 0x70, 0xB9, 0x04, 0x74, 0xB7, 0x58,
-    0x54, 0x7C, 0x29, 0x29, 0x95, 0x39, 0x42, 0x65, 0xC9, 0xB4, 0x60, 0x08, 0x01, 0x3C, 0xE7, 0xCA,
-    0xE6, 0x93, 0xDA, 0xEC, 0x3E, 0x19, 0xDF, 0xEF, 0x87, 0x36, 0xD1, 0x77, 0x50, 0x3C, 0xC7, 0x7E,
-    0x11, 0xA6, 0x72, 0x2A, 0x6A, 0xCE, 0xF2, 0xF7, 0x15, 0x94, 0xE5, 0x3F, 0x86, 0xD2, 0x08, 0xEB,
-    0x5B, 0x62, 0x36, 0xE0, 0x91, 0x08, 0xBA, 0x0F, 0x79, 0x4E, 0x21, 0xF7, 0xAB, 0x30, 0xB7, 0xF8,
-    0xDC, 0x80, 0x9B, 0xAD, 0x66, 0xC2, 0x97, 0xD4, 0x63, 0x12, 0x71, 0x58, 0xBC, 0xDE, 0x9E, 0x4B,
-    0x63, 0x9B, 0xFA, 0x0B, 0xBA, 0x95, 0x48, 0xBA, 0xFC, 0x91, 0xD3, 0x4E, 0x21, 0x1F, 0xE4, 0xF6,
-    0x97, 0xB4, 0xB4, 0x1F, 0x93, 0xD4, 0x65, 0x4B, 0x5B, 0x0E, 0x89, 0xF5, 0x1C, 0xA8, 0xD8, 0x2D,
-    0xE3, 0x96, 0xC7, 0x71, 0xCC, 0xD0, 0x1E, 0x4F, 0xF8, 0x81, 0xD5, 0x32, 0x8E, 0x79, 0x1F, 0x52,
-    0x3A, 0xD1, 0xAB, 0xA6, 0x98, 0xCE, 0x29, 0x45, 0xAE, 0x8B, 0xAE, 0x4B, 0xCB, 0x4A, 0xDA, 0x2B,
-    0x05, 0x67, 0x46, 0x3D, 0xDB, 0x1C, 0x88, 0x75, 0x61, 0xFD, 0x37, 0xBD, 0x32, 0x47, 0xAD, 0x4C,
-    0x9F, 0x7A, 0x35, 0x5A, 0x57, 0xA8, 0x6C, 0xF6, 0xD4, 0x1B, 0x2A, 0x38, 0x06, 0xF8, 0x60, 0xE5,
-    0xBD, 0xDA, 0xD7, 0x32, 0x38, 0x80, 0xE7, 0x5D, 0xB5, 0x72, 0xEE, 0x04, 0x8C, 0xA9, 0x1D, 0x40,
-    0x4A, 0xF4, 0xA5, 0x16, 0x50, 0x6D, 0x86, 0xE8, 0x0A, 0x37, 0x9A, 0xB1, 0x5D, 0xF0, 0x1C, 0xBC,
-    0xEF, 0x4D, 0x68, 0xBC, 0x9C, 0x43, 0x7A, 0x61, 0x6A, 0x37, 0x6E, 0x85, 0xA2, 0x44, 0x83, 0x95,
-    0x00, 0x16, 0x61, 0x49, 0x73, 0x7C, 0xB5, 0x27, 0xF0, 0x69, 0x99, 0x6F, 0x4C, 0x18, 0xC6, 0x6D,
-    0xED, 0xB0, 0x0D, 0xDD, 0x72, 0x84, 0x1B, 0x95, 0x89, 0x9C, 0xEF, 0xE9, 0x64, 0xEE, 0xB1, 0xBF,
-    0x21, 0x38, 0xB6, 0xE2, 0x06, 0x13, 0x0B, 0xEE, 0x5C, 0xD6, 0xCA, 0x48, 0x8E, 0x01, 0x08, 0xE1,
-    0x41, 0x6C, 0x8C, 0x06, 0xE3, 0x55, 0x46, 0x74, 0x46, 0x30, 0xC6, 0xC8, 0xA4, 0xC5, 0x5E, 0x89,
-    0xEC, 0x44, 0x54, 0x7E, 0x29, 0xD7, 0x42, 0xC4, 0x9B, 0x8B, 0xF0, 0x64, 0x50, 0x96, 0x28, 0x63,
-    0x66, 0xC0, 0xAC, 0x78, 0xA0, 0x91, 0x9E, 0xD7, 0x6D, 0xC3, 0xEC, 0x8D, 0x9D, 0x99, 0x0E, 0xF5,
-    0x28, 0xBE, 0x2D, 0x46, 0xC0, 0x29, 0xDC, 0x46, 0xE4, 0x1F, 0x3D, 0x8B, 0x58, 0xD3, 0x40, 0x83,
-    0x21, 0x72, 0x98, 0xAA, 0xFD, 0x18, 0x9A, 0x5F, 0x3B, 0x04, 0x91, 0x90, 0x44, 0x12, 0xDF, 0x3F,
-    0x87, 0x40, 0x5A, 0x40, 0x96, 0x73, 0xFC, 0x02, 0xEE, 0x0D, 0xD3, 0x90, 0x67, 0x6E, 0x78, 0xF0,
-    0xD6, 0xE5, 0x88, 0x3D, 0x60, 0xA8, 0x9F, 0x23, 0xC2, 0x41, 0xD4, 0x7E, 0xE1, 0xF1, 0xB0, 0x50,
-    0x90, 0xE3, 0x9B, 0x88, 0x94, 0x26, 0x34, 0x6A, 0xA9, 0xCB, 0xB7, 0xC7, 0x03, 0x54, 0x9C, 0xCB,
-    0xB9, 0x43, 0xC7, 0x3E, 0xBB, 0x7B, 0xE5, 0xEE, 0x01, 0x3C, 0xBF, 0x61, 0x34, 0xBC, 0x46, 0x7F,
-    0x49, 0x94, 0x55, 0xFA, 0xD2, 0xA1, 0x72, 0x19, 0x78, 0x18, 0x4D, 0xC7, 0x61, 0xC6, 0xD0, 0xD6,
-    0xA2, 0xB8, 0x09, 0xBF, 0x19, 0xCE, 0xC2, 0x5B, 0x99, 0x7C, 0x9C, 0x81, 0xD0, 0x8C, 0xC7, 0x85,
-    0x0E, 0xF6, 0xED, 0xA1, 0x97, 0x4F, 0xE1, 0x26, 0x06, 0x1E, 0x0A, 0xAE, 0xCD, 0x24, 0x20, 0x6F,
-    0x51, 0xFE, 0x90, 0xEF, 0xD3, 0x8E, 0x14, 0x81, 0x76, 0x89, 0x20, 0x6B, 0xFA, 0x49, 0xBD, 0x4A,
-    0xDE, 0x3D, 0x68, 0x39, 0x08, 0x92, 0x93, 0x1B, 0x86, 0x42, 0xEC, 0x7A, 0x36, 0x5E, 0xB7, 0x2E,
-    0x9B, 0x7D, 0x5E, 0xED, 0xEA, 0x06, 0x16, 0xF6, 0xAB, 0x22, 0x01, 0x71, 0x3A, 0xA7, 0x31, 0x45,
-    0x85, 0xFB, 0xF3, 0x96, 0xE1, 0xA3, 0xA6, 0xA5, 0x39, 0xB4, 0xB5, 0xA9, 0x47, 0x5F, 0x8D, 0x92,
-    0xD2, 0xE5, 0xF4, 0x0D, 0x66, 0x26, 0x87, 0xB0, 0xE7, 0x72, 0xB8, 0x10, 0x56, 0xA7, 0x95, 0xF5,
-    0x5C, 0x85, 0xFA, 0xDB, 0xAE, 0xB4, 0xAD, 0xFB, 0xDD, 0x0A, 0xB6, 0x07, 0x57, 0x97, 0x6A, 0xAC,
-    0xA0, 0xFD, 0xAD, 0x56, 0xD4, 0xC1, 0x62, 0x6C, 0xE6, 0x4A, 0xCE, 0x34, 0xE7, 0x21, 0xE3, 0x15,
-    0x20, 0xB1, 0x48, 0x9E, 0x1C, 0xDC, 0x65, 0x8C, 0x80, 0xA7, 0x77, 0xD3, 0x8C, 0x87, 0x85, 0x2C,
-    0xE9, 0x59, 0x9B, 0xF6, 0xE0, 0x4C, 0x8E, 0xBE, 0x15, 0x2C, 0x5D, 0xDA, 0xE1, 0x48, 0x9F, 0x9F,
-    0xF3, 0xB9, 0x2D, 0x9B, 0x0A, 0x81, 0x69, 0xCB, 0x10, 0x43, 0x47, 0xDF, 0xA5, 0xE4, 0xC5, 0x14,
-    0xC9, 0x23, 0x84, 0x14, 0xC8, 0x79, 0x0F, 0x99, 0x16, 0x3A, 0xD2, 0x2E, 0x0C, 0xE4, 0xB4, 0x12,
-    0x92, 0x35, 0x85, 0xF2, 0x65, 0xDC, 0x25, 0x47, 0x7D, 0x4C, 0xDF, 0x24, 0x95, 0x64, 0x05, 0x20,
-    0x46, 0x75, 0x24, 0xA6, 0xFE, 0x5A, 0x1D, 0x4F, 0x9C, 0x6B, 0xFC, 0xF7, 0xF4, 0xCD, 0xFE, 0x6C,
-    0x83, 0xBA, 0xF5, 0xEA, 0x57, 0xAD, 0xDF, 0x22, 0x4C, 0xBD, 0x21, 0xC7, 0x91, 0x8C, 0x2D, 0x8B,
-    0xEA, 0xCB, 0x13, 0x65, 0x8D, 0x1A, 0x41, 0xC5, 0x03, 0xC3, 0x68, 0xBC, 0xA8, 0xEF, 0xCC, 0x34,
-    0x39, 0x5A, 0x22, 0x0A, 0xC9, 0x90, 0xA1, 0x5A, 0x3D, 0xC5, 0x0D, 0x64, 0xD3, 0xB9, 0x60, 0xDB,
-    0xBA, 0xFA, 0x6D, 0x94, 0x46, 0x57, 0xBF, 0xAA, 0x02, 0x0E, 0x37, 0xDF, 0x30, 0xF5, 0x0A, 0x2B,
-    0xCF, 0x28, 0x35, 0x4F, 0x9B, 0x0F, 0xC9, 0xAE, 0x35, 0xC0, 0xC4, 0x1E, 0x06, 0x03, 0xAB, 0x50,
-    0x89, 0xE0, 0x85, 0x22, 0xF2, 0x86, 0x21, 0x01, 0x91, 0x25, 0xC1, 0xED, 0x8B, 0xF2, 0xED, 0x8B,
-    0x3C, 0x2A, 0x6D, 0xDE, 0xC9, 0xE8, 0xC4, 0x59, 0x6E, 0xB7, 0x43, 0x36, 0x81, 0xCC, 0xD2, 0xC5,
-    0x91, 0xF8, 0x07, 0x4B, 0x9A, 0x0F, 0xA1, 0xE6, 0x61, 0x83, 0x87, 0x48, 0x25, 0x78, 0x3E, 0x97,
-    0x73, 0xF9, 0xFC, 0xD2, 0xA9, 0xD7, 0xFB, 0xC4, 0x8D, 0x5F, 0x24, 0x6D, 0x54, 0xD2, 0x78, 0xD4,
-    0xED, 0xDB, 0x29, 0xAD, 0xC7, 0x3A, 0x8E, 0xC5, 0x7C, 0xE8, 0xD6, 0xDC, 0x66, 0x31, 0x42, 0x19,
-    0xC7, 0x27, 0x1B, 0xBD, 0xB8, 0x21, 0xD3, 0xD9, 0xB9, 0x4C, 0x46, 0xA5, 0x35, 0x1A, 0x92, 0x93,
-    0x72, 0x23, 0x03, 0x66, 0x7D, 0x8C, 0x58, 0xDA, 0xD8, 0x9D, 0xD5, 0x41, 0x1E, 0x01, 0xEA, 0x02,
-    0x17, 0x80, 0xC4, 0x62, 0xD9, 0xFB, 0xA2, 0x9C, 0xD7, 0xA7, 0x30, 0x65, 0xC2, 0x2F, 0xD5, 0x32,
-    0x3D, 0x32, 0x11, 0x64, 0xC1, 0x78, 0x55, 0x7D, 0x96, 0x99, 0x11, 0x1B, 0xBA, 0xE0, 0xE5, 0xCD,
-    0xDA, 0xE4, 0x9B, 0x2A, 0x7C, 0xDF, 0x45, 0xC1, 0xC1, 0x91, 0x8C, 0x1C, 0x4E, 0x34, 0xFB, 0x0C,
-    0x64, 0x66, 0x6A, 0x6C, 0xC0, 0x53, 0xD5, 0x0F, 0x6F, 0x64, 0xE2, 0x8A, 0xB7, 0x58, 0x77, 0xAE,
-    0xCA, 0x91, 0xF2, 0xC8, 0x44, 0x42, 0x61, 0x5A, 0x9B, 0x3F, 0x84, 0xD3, 0x8C, 0x6F, 0x08, 0x3F,
-    0xB1, 0x5B, 0x86, 0x08, 0x1A, 0xD9, 0x77, 0x1A, 0x8B, 0x07, 0x2E, 0x99, 0xD1, 0x16, 0xE1, 0x84,
-    0x8A, 0x65, 0xB9, 0x6C, 0x81, 0x06, 0xE2, 0x1A, 0x24, 0xE1, 0x0A, 0x29, 0xF5, 0x8B, 0xF7, 0x9D,
-    0xEB, 0x6D, 0x43, 0x0B, 0x85, 0x0F, 0x02, 0xD9, 0x7C, 0x9C, 0x7A, 0x1C, 0x16, 0x23, 0xDB, 0x9E,
-    0xF9, 0xD8, 0xB9, 0xBE, 0x2F, 0x3C, 0xD1, 0xD3, 0x17, 0x0F, 0xE3, 0xCC, 0x81, 0xD0, 0x9B, 0xDE,
-    0x4B, 0x23, 0x5B, 0x20, 0x04, 0x5B, 0xE7, 0xC8, 0x1F, 0xEE, 0x07, 0x13, 0x9E, 0x05, 0x97, 0x97,
-    0x1B, 0xA4, 0xCF, 0xC2, 0x23, 0x27, 0x9C, 0x18, 0xE5, 0xB2, 0x7A, 0xFE, 0x19, 0x15, 0xBC, 0x9A,
-    0xBB, 0x6F, 0xF6, 0xCF, 0x95, 0x89, 0x96, 0x43, 0x87, 0x96, 0xC4, 0x1B, 0xC2, 0x8F, 0xC3, 0x94,
-    0x0F, 0xB7, 0x24, 0x4D, 0xD2, 0x39, 0xF6, 0xCD, 0xC9, 0xF0, 0x7D, 0xC4, 0x9C, 0x99, 0x41, 0x11,
-    0xD1, 0xB7, 0x0B, 0x73, 0x26, 0x5C, 0x9C, 0x2B, 0x58, 0xC7, 0x25, 0xFB, 0x44, 0x57, 0xA9, 0x57,
-    0xBB, 0xB5, 0x48, 0x22, 0x8C, 0x2D, 0x4E, 0x9A, 0x1F, 0x05, 0x1D, 0x56, 0x6A, 0x5E, 0x42, 0x29,
-    0xC7, 0x17, 0x30, 0x74, 0x3A, 0xC8, 0x42, 0xD0, 0x61, 0x28, 0xD0, 0x2E, 0xA7, 0x30, 0x1C, 0x76,
-    0x4A, 0x11, 0xBD, 0x78, 0x12, 0x23, 0x48, 0x29, 0x0D, 0xEF, 0x0E, 0x90, 0x6E, 0x42, 0xD0, 0x2D,
-    0x53, 0x88, 0x6D, 0x83, 0x39, 0x1E, 0x57, 0x4F, 0x71, 0x7E, 0x47, 0x8F, 0x7E, 0x15, 0xB7, 0x1C,
-    0x19, 0x06, 0xEC, 0x66, 0x13, 0x8E, 0xCB, 0xEC, 0x82, 0x5A, 0xA6, 0x4C, 0x24, 0xD6, 0xD5, 0x46,
-    0xCD, 0x14, 0x8B, 0x9C, 0x40, 0xE3, 0xB4, 0x4E, 0xCA, 0xB7, 0x39, 0x4C, 0x75, 0x02, 0x56, 0xAF,
-    0x51, 0xD1, 0xB8, 0xAD, 0x34, 0x10, 0xF7, 0x8C, 0x39, 0x28, 0xA1, 0xE5, 0x34, 0x40, 0x74, 0x90,
-    0x1D, 0xCC, 0x77, 0xB0, 0xF4, 0xC2, 0x79, 0x88, 0xE4, 0xFC, 0x79, 0x18, 0xCD, 0xF9, 0xA7, 0x41,
-    0xC8, 0x4B, 0xA6, 0xFB, 0x2C, 0xFB, 0x2F, 0xBB, 0x79, 0x6B, 0x2D, 0xBD, 0x93, 0x6D, 0xCB, 0x74,
-    0xAD, 0x6D, 0xC9, 0x89, 0x02, 0x87, 0x05, 0xC3, 0xE9, 0xEA, 0x45, 0x91, 0x2B, 0xC4, 0x9A, 0xD9,
-    0x41, 0x34, 0x0E, 0x83, 0x96, 0xAD, 0xEE, 0x4F, 0x8D, 0x9D, 0x2B, 0x68, 0x8D, 0x45, 0xDA, 0x9E,
-    0x9C, 0x4A, 0x3F, 0xD4, 0x1F, 0xC2, 0x7E, 0xBE, 0x72, 0xE7, 0x85, 0x61, 0xBC, 0x67, 0x5A, 0x5F,
-    0xAC, 0xAA, 0xD6, 0x5B, 0x61, 0x4E, 0x3A, 0x83, 0x69, 0x1F, 0x55, 0x1E, 0x67, 0x93, 0x62, 0x09,
-    0x96, 0xA8, 0xD6, 0xCA, 0xA4, 0x29, 0x0A, 0x63, 0xE0, 0x8C, 0x0E, 0x77, 0xEE, 0x9B, 0xE4, 0xFB,
-    0x1A, 0x3E, 0x92, 0xD9, 0x1F, 0x22, 0xAD, 0xC5, 0x72, 0x5B, 0x65, 0xCD, 0xA8, 0x57, 0x2F, 0x5D,
-    0x3F, 0xE8, 0xF4, 0xC9, 0x48, 0xEC, 0x9A, 0x69, 0x68, 0xC8, 0xC9, 0x2F, 0xF5, 0x57, 0xB0, 0x8E,
-    0x27, 0x95, 0xF3, 0xDF, 0xA6, 0xA6, 0xCD, 0xD5, 0xE7, 0xB4, 0xE6, 0x81, 0x1C, 0xCA, 0x65, 0x99,
-    0xF7, 0x5D, 0xA9, 0x5B, 0xD5, 0x66, 0xB7, 0xF3, 0x69, 0xBB, 0x0E, 0x52, 0x88, 0xC6, 0xC6, 0xB3,
-    0xE9, 0xBE, 0x5B, 0xBF, 0x97, 0xA9, 0xF6, 0x77, 0x30, 0x75, 0xF9, 0x4E, 0x4C, 0xD0, 0x0C, 0xD1,
-    0x1E, 0xDE, 0x4D, 0x4F, 0x30, 0x15, 0x7C, 0x04, 0xA6, 0xFE, 0x7F, 0xCD, 0x5E, 0xB9, 0xFD, 0x42,
-    0xA6, 0xFB, 0xB3, 0xFD, 0xA5, 0xDF, 0xAF, 0x59, 0xEE, 0x24, 0x27, 0x73, 0xAA, 0x6A, 0x2C, 0x65,
-    0x55, 0x25, 0x40, 0xFE, 0xB5, 0x30, 0xBE, 0xD7, 0x8B, 0x90, 0x3C, 0x69, 0xD4, 0x66, 0x84, 0xA5,
-    0x0D, 0x03, 0x47, 0x12, 0x1B, 0x81, 0xB9, 0x52, 0xEE, 0x7B, 0xA6, 0xDA, 0x2F, 0xE4, 0x9A, 0xD3,
-    0xAE, 0x0C, 0x8C, 0x26, 0x37, 0x8D, 0xBC, 0x15, 0x50, 0xCB, 0x09, 0x98, 0x4A, 0xCE, 0xAD, 0x54,
-    0xCB, 0xF7, 0x10, 0x1C, 0x79, 0x0F, 0xC1, 0x2D, 0x78, 0x85, 0xCC, 0xE7, 0x82, 0xE1, 0x32, 0xE1,
-    0x05, 0x85, 0x0C, 0x51, 0xF4, 0x9D, 0x5D, 0x29, 0x11, 0x4C, 0x99, 0xD3, 0xAB, 0x25, 0x16, 0x65,
-    0xB1, 0xE9, 0x36, 0x9F, 0xC7, 0x92, 0xA6, 0x56, 0xF6, 0xFF, 0x72, 0x1E, 0xF6, 0x2C, 0x35, 0x63,
-    0x6D, 0x9E, 0xBF, 0xDF, 0x45, 0x35, 0xE1, 0xEA, 0xDC, 0x6A, 0xB7, 0x13, 0x4A, 0x83, 0x23, 0xFE,
-    0xE1, 0x97, 0xBC, 0x98, 0x10, 0xA4, 0x02, 0x3D, 0xC6, 0x5F, 0x6C, 0xAA, 0xF0, 0x65, 0x0A, 0xAF,
-    0x06, 0x7D, 0xFF, 0x51, 0x5C, 0x6F, 0xBC, 0xB7, 0x7D, 0xF7, 0x76, 0x3B, 0x69, 0x7C, 0x9D, 0xEB,
-    0x3C, 0xE4, 0xEB, 0x08, 0x5B, 0xAB, 0xD9, 0xDB, 0x14, 0xD4, 0x46, 0x80, 0x67, 0x2F, 0xFD, 0x45,
-    0x88, 0x4E, 0x5E, 0x7A, 0xE5, 0xE1, 0x17, 0x53, 0x38, 0x9D, 0xF8, 0x39, 0xA5, 0xB1, 0x51, 0xC2,
-    0x29, 0xC3, 0x65, 0x79, 0x3D, 0x23, 0xB7, 0xEB, 0xF1, 0xD7, 0xD0, 0x95, 0x8C, 0x00, 0x08, 0xC7,
-    0x5F, 0xD2, 0x1C, 0xA3, 0x3C, 0x33, 0x88, 0xD5, 0x9B, 0x3D, 0x14, 0xA4, 0xD3, 0xAA, 0x4A, 0xAE,
-    0xBE, 0x75, 0x94, 0xEA, 0xD6, 0x6F, 0x6D, 0xBE, 0xB8, 0x09, 0xB3, 0x5D, 0xA6, 0xDA, 0xA7, 0xA5,
-    0xE7, 0x3C, 0x95, 0x01, 0x5F, 0x76, 0x45, 0x06, 0x74, 0xE6, 0x44, 0x63, 0xA7, 0x4E, 0xBC, 0xC7,
-    0xF0, 0x20, 0xDA, 0x9D, 0xC0, 0x62, 0x0E, 0xAC, 0x26, 0x80, 0x33, 0x4A, 0x1F, 0xA2, 0xF2, 0x93,
-    0x49, 0x44, 0x16, 0xDF, 0x2F, 0xBB, 0x93, 0x5E, 0x93, 0x2B, 0x34, 0xF9, 0x87, 0x14, 0xDD, 0x53,
-    0x32, 0x1C, 0x3E, 0x2F, 0xA3, 0x8A, 0x0B, 0xF2, 0xF7, 0xF0, 0x30, 0x1E, 0x0F, 0x85, 0x8E, 0x07,
-    0x53, 0x1F, 0x58, 0x61, 0xCA, 0xFB, 0x64, 0x9C, 0x67, 0xAB, 0x0B, 0x6C, 0x10, 0x54, 0x17, 0x98,
-    0x3D, 0xD8, 0x5A, 0x24, 0x27, 0x51, 0x37, 0xBC, 0x22, 0x78, 0x7F, 0x8C, 0x13, 0xB6, 0xF9, 0x0F,
-    0xAC, 0x88, 0x98, 0x1C, 0xDD, 0x96, 0x78, 0x29, 0xAC, 0x09, 0x0B, 0xF4, 0x75, 0xCE, 0xCB, 0x1A,
-    0x46, 0x71, 0x2B, 0xB5, 0xE3, 0x07, 0xDC, 0x44, 0xA5, 0x09, 0x73, 0x4D, 0x26, 0x62, 0x3C, 0xBC,
-    0xF3, 0x4A, 0x03, 0x28, 0x05, 0x46, 0x83, 0xEB, 0x58, 0x7F, 0x83, 0x45, 0x72, 0xBC, 0xB5, 0x5A,
-    0x94, 0xE5, 0x6A, 0x1A, 0xF0, 0xE0, 0xEA, 0xD9, 0x4D, 0xA3, 0x94, 0xA3, 0x30, 0xEB, 0x32, 0x4E,
-    0x4C, 0x85, 0x15, 0xA9, 0x10, 0x32, 0xB6, 0x8F, 0x9E, 0x41, 0x5A, 0x39, 0x7F, 0x3E, 0x78, 0xEF,
-    0xD7, 0xC7, 0xA5, 0xBC, 0xAE, 0x95, 0x95, 0x90, 0xF6, 0x19, 0x10, 0xF0, 0x09, 0x0A, 0xA5, 0xDE,
-    0x10, 0x8A, 0x00, 0x88, 0x61, 0xB0, 0x61, 0xDE, 0x26, 0x0E, 0xCD, 0xF5, 0x5D, 0xF9, 0xC4, 0xAC,
-    0x69, 0xFE, 0x4C, 0x5E, 0xDB, 0x42, 0x16, 0xC6, 0x3B, 0xC7, 0x77, 0xC3, 0xFD, 0xC5, 0x19, 0x1E,
-    0x39, 0x99, 0xB2, 0xFE, 0x72, 0x94, 0x35, 0x42, 0x97, 0xA4, 0x52, 0xAB, 0xC7, 0x81, 0xC1, 0x84,
-    0x09, 0x8F, 0xC0, 0xC4, 0xA6, 0xA6, 0x7E, 0x52, 0x7D, 0xE6, 0x1E, 0xA1, 0x9B, 0x87, 0x59, 0x4F,
-    0xA1, 0x04, 0xE9, 0x39, 0x53, 0xE6, 0x7B, 0x2F, 0x45, 0x52, 0xB0, 0x39, 0x15, 0x16, 0x40, 0x21,
-    0x8E, 0xBC, 0xC6, 0x0E, 0x70, 0x91, 0x70, 0x3A, 0x60, 0xB7, 0x2C, 0x04, 0x08, 0xAC, 0x73, 0xD6,
-    0x69, 0xAD, 0xBC, 0x25, 0x48, 0xA4, 0xCE, 0xC6, 0xDA, 0x4F, 0x0B, 0x73, 0xEC, 0xB0, 0x9D, 0x11,
-    0x69, 0xF8, 0x79, 0xF0, 0x9C, 0xBC, 0xE0, 0x8A, 0x1A, 0x6E, 0xA2, 0xE4, 0xA8, 0xDA, 0x1E, 0x8B,
-    0x20, 0x7C, 0xE0, 0xE7, 0x3B, 0xE4, 0xCA, 0xFF, 0x61, 0xED, 0x54, 0xEC, 0x45, 0xB4, 0x91, 0x8A,
-    0x7C, 0x82, 0x96, 0xB7, 0x0A, 0xE7, 0xD7, 0xE4, 0x61, 0x8A, 0xA7, 0xEE, 0xC8, 0x9B, 0x1D, 0xCA,
-    0x3E, 0x96, 0x19, 0x70, 0x69, 0x4E, 0x53, 0x13, 0x58, 0xEA, 0x61, 0x4C, 0x12, 0x94, 0x06, 0xED,
-    0x59, 0x9B, 0x47, 0xB6, 0xB6, 0x57, 0x66, 0x6C, 0x72, 0xB2, 0xC8, 0xBC, 0x21, 0x62, 0x0E, 0x17,
-    0xC1, 0x0E, 0xF6, 0xE4, 0xCA, 0x0D, 0x37, 0x5F, 0x12, 0xB1, 0x2C, 0x36, 0xED, 0xDC, 0x5F, 0x6B,
-    0x36, 0x15, 0xFB, 0xBF, 0xE6, 0x1B, 0xF6, 0x51, 0x0A, 0xB3, 0xCD, 0xBD, 0xD2, 0xCF, 0xDD, 0x8A,
-    0xC7, 0xEA, 0x21, 0x81, 0x29, 0xCF, 0xEB, 0xC4, 0x0C, 0x1C, 0x11, 0x9E, 0x82, 0x62, 0xAB, 0x81,
-    0x9D, 0x4C, 0xFD, 0x09, 0x78, 0x0A, 0xBD, 0x1F, 0xBD, 0x59, 0x29, 0xF7, 0xE6, 0x9B, 0x55, 0xAD,
-    0xAC, 0x0F, 0xCB, 0x6B, 0xA0, 0x79, 0x52, 0x05, 0x53, 0xD6, 0x69, 0xAE, 0x9C, 0xCB, 0x13, 0x62,
-    0x2B, 0x51, 0xEC, 0x7A, 0x4B, 0x36, 0x1D, 0xE7, 0x13, 0xF6, 0x31, 0x51, 0xDF, 0x9C, 0xB6, 0x2D,
-    0xAF, 0x96, 0xBB, 0xF9, 0x1A, 0x38, 0x01, 0xB0, 0x73, 0x74, 0x87, 0x5A, 0x26, 0x92, 0xF0, 0x92,
-    0xA4, 0x5E, 0x25, 0x93, 0x1A, 0x9E, 0x5C, 0x63, 0x47, 0x99, 0x90, 0x90, 0x8D, 0x97, 0x4E, 0x4E,
-    0x11, 0x94, 0xD2, 0x55, 0xA0, 0x19, 0x3B, 0xB7, 0xEB, 0x45, 0x9B, 0x45, 0x2F, 0x5E, 0x2E, 0x36,
-    0xE7, 0xF0, 0xCD, 0xF9, 0xF7, 0x7B, 0x9E, 0x0B, 0x93, 0xB7, 0x8D, 0xBD, 0x61, 0x34, 0x50, 0x2C,
-    0x47, 0xD7, 0x8B, 0x8A, 0x42, 0x44, 0xCB, 0x96, 0x88, 0x22, 0xFF, 0xAA, 0xB1, 0xE5, 0xE5, 0xC3,
-    0x55, 0xA9, 0xEE, 0xE6, 0xEC, 0x60, 0xD3, 0xE4, 0xAF, 0x54, 0x6C, 0x31, 0xD2, 0xEA, 0xF1, 0xC9,
-    0x1E, 0x7D, 0x97, 0x65, 0x1A, 0x0B, 0x8A, 0x3D, 0x1A, 0xC8, 0x84, 0x30, 0x75, 0x87, 0xA6, 0xBA,
-    0x23, 0x51, 0x9C, 0x41, 0x27, 0x62, 0x81, 0xF8, 0x14, 0x27, 0x3B, 0x4F, 0xDD, 0x18, 0xDF, 0xF7,
-    0x89, 0x16, 0xC3, 0xCB, 0xC9, 0xF8, 0x3E, 0x19, 0x11, 0xF8, 0x4B, 0xC4, 0xBD, 0xD9, 0x58, 0x26,
-    0xAB, 0x27, 0x56, 0x6B, 0x89, 0x54, 0xFE, 0xEF, 0x0B, 0xB4, 0x98, 0xE4, 0x3A, 0x0F, 0x45, 0x96,
-    0x7E, 0xAA, 0x4E, 0x8E, 0x13, 0xF2, 0x48, 0xFF, 0x4C, 0x37, 0x08, 0x3E, 0x41, 0x4D, 0xE7, 0xCE,
-    0xB8, 0x81, 0xF9, 0x3F, 0x81, 0x84, 0xA9, 0x31, 0xB4, 0x99, 0x32, 0x6D, 0x65, 0x35, 0x37, 0x4D,
-    0x2F, 0x5A, 0x6F, 0x74, 0x75, 0x7C, 0xD1, 0x75, 0xB0, 0xB6, 0x6C, 0x79, 0x12, 0x6E, 0xB6, 0xB4,
-    0xC4, 0x13, 0x47, 0xE7, 0x52, 0xD9, 0xB3, 0x18, 0x50, 0xD5, 0xD2, 0x1B, 0xB9, 0x5A, 0x6C, 0x3B,
-    0x2B, 0x86, 0xFF, 0xB3, 0x87, 0xFF, 0xFE, 0x89, 0x53, 0x4C, 0x11, 0xDB, 0xE8, 0x3C, 0x38, 0xAE,
-    0xE6, 0x07, 0x07, 0x3D, 0x64, 0xE0, 0x70, 0xB2, 0x06, 0x9D, 0x56, 0xF4, 0xDC, 0x7D, 0x73, 0x3C,
-    0xA9, 0x5B, 0x9C, 0xA3, 0x28, 0x47, 0xB1, 0x65, 0xA3, 0x7A, 0xDD, 0xE5, 0xC1, 0xA7, 0xD4, 0x9C,
-    0x39, 0xFD, 0x01, 0x1B, 0xA2, 0x15, 0x02, 0x9F, 0x5D, 0x05, 0x6C, 0xAD, 0x45, 0xB7, 0x0E, 0x0E,
-    0x0B, 0x6E, 0x91, 0x9B, 0x37, 0xE1, 0xD4, 0xA2, 0x1F, 0xE4, 0x54, 0xC6, 0x7C, 0x82, 0x7C, 0x71,
-    0xA8, 0x45, 0xAD, 0x63, 0x42, 0xBB, 0x8F, 0xAF, 0x79, 0xBA, 0x6E, 0xF9, 0xA2, 0x8A, 0x0F, 0xEF,
-    0x7D, 0x58, 0x8D, 0x2D, 0x92, 0xF1, 0xD4, 0xCB, 0x70, 0xEB, 0xCC, 0x34, 0x21, 0x60, 0x81, 0x17,
-    0xC3, 0x42, 0x55, 0x89, 0x3E, 0xAE, 0x60, 0xDC, 0xD5, 0x8D, 0x73, 0xB4, 0x51, 0xB1, 0xB4, 0xEF,
-    0x8D, 0xFF, 0xFF, 0x09, 0xE9, 0x17, 0x48, 0xCC, 0xB5, 0xF7, 0xEF, 0xF5, 0xB6, 0xE6, 0x27, 0x23,
-    0x8F, 0x27, 0xCD, 0x62, 0x46, 0x25, 0x79, 0xCE, 0xC5, 0x3F, 0x93, 0x1C, 0xF6, 0xD5, 0xD7, 0x87,
-    0x57, 0x18, 0x5B, 0x9A, 0x56, 0x26, 0xA7, 0xAD, 0xBB, 0xF1, 0x05, 0x46, 0xA7, 0x78, 0x10, 0x84,
-    0xB1, 0xDA, 0x53, 0xF1, 0x5F, 0xCD, 0xCD, 0x8B, 0x8B, 0x27, 0x7B, 0x2A, 0x1F, 0xA3, 0x71, 0x0C,
-    0xE0, 0x56, 0x0E, 0xF6, 0x0A, 0xA2, 0xC6, 0xE2, 0xA9, 0x8C, 0x60, 0xCF, 0x2C, 0x52, 0xB6, 0x69,
-    0xAA, 0x4E, 0x56, 0x4E, 0x08, 0xB7, 0x2B, 0xD7, 0x66, 0x39, 0x62, 0x37, 0x67, 0x60, 0x4D, 0x27,
-    0xDB, 0x5C, 0xCD, 0x7B, 0x0B, 0x26, 0x3C, 0x0E, 0x58, 0x60, 0xE5, 0xBA, 0x7C, 0xDD, 0x7F, 0xDC,
-    0x24, 0x5A, 0x99, 0xD1, 0xEF, 0x6D, 0x6E, 0x25, 0x13, 0xE9, 0x0B, 0xF2, 0xE0, 0xE4, 0x48, 0x64,
-    0x2B, 0x53, 0x92, 0xD3, 0x72, 0xCC, 0xF4, 0xFF, 0x00, 0x6D, 0x51, 0xB1, 0x6E, 0x14, 0x31, 0x10,
-    0x7D, 0x3E, 0x6F, 0x76, 0x91, 0x2C, 0xE1, 0x2B, 0x12, 0x44, 0xE7, 0x82, 0x06, 0x21, 0x22, 0x37,
-    0x94, 0xEC, 0xDA, 0xBA, 0x26, 0xA2, 0x4A, 0x0A, 0xAE, 0x46, 0xFC, 0x01, 0x05, 0xC5, 0x15, 0x7B,
-    0xDA, 0x65, 0x53, 0x50, 0x92, 0x4F, 0x48, 0xC1, 0x47, 0x50, 0x5C, 0x0E, 0xA3, 0x2B, 0x28, 0xD2,
-    0x58, 0x50, 0xA4, 0x75, 0x43, 0x45, 0xE3, 0x48, 0x2B, 0x61, 0x90, 0xF7, 0x16, 0x2F, 0x94, 0x30,
-    0x9A, 0x66, 0xEC, 0x99, 0xF7, 0xDE, 0xCC, 0xCB, 0xE0, 0x0B, 0xCF, 0x9D, 0xB0, 0xDC, 0x70, 0x7D,
-    0x07, 0x17, 0xCC, 0x34, 0xB4, 0x57, 0x8B, 0x9E, 0x23, 0xC5, 0x01, 0xB0, 0x07, 0x8F, 0xD8, 0x06,
-    0xF6, 0xD5, 0xAF, 0x8B, 0x1B, 0xCB, 0x9F, 0x21, 0x83, 0x06, 0xEB, 0x1F, 0xCB, 0x58, 0x57, 0x4D,
-    0x78, 0x2A, 0x3C, 0x72, 0x7D, 0xB4, 0x3C, 0x1D, 0x53, 0xB8, 0x69, 0x84, 0x38, 0x5C, 0x1B, 0x21,
-    0xBF, 0xF7, 0x6A, 0xD4, 0xD2, 0x81, 0x75, 0x51, 0xED, 0xFA, 0x2C, 0x21, 0x1D, 0xCA, 0x36, 0xAA,
-    0x54, 0xCD, 0x42, 0x86, 0x33, 0xF2, 0x9C, 0x8E, 0xE7, 0x3F, 0x6E, 0x7D, 0xFD, 0x44, 0x42, 0x6A,
-    0xA5, 0x15, 0x12, 0x9F, 0x4E, 0xE3, 0x2C, 0xA8, 0x61, 0x23, 0x7B, 0xD1, 0x8B, 0x50, 0x36, 0x51,
-    0x4E, 0x90, 0xF3, 0x03, 0x54, 0xD4, 0xCA, 0x2E, 0x88, 0x4F, 0x91, 0xDB, 0x21, 0x25, 0x35, 0x35,
-    0x74, 0x86, 0x43, 0xBC, 0xF4, 0xEC, 0xC6, 0x5E, 0xF1, 0xCF, 0x56, 0x6C, 0xA1, 0x1C, 0x9A, 0x49,
-    0x40, 0x46, 0x66, 0xEE, 0x83, 0xE2, 0x3B, 0x1F, 0xC5, 0x89, 0x0D, 0x15, 0x35, 0x7E, 0x9E, 0xE1,
-    0x08, 0x6C, 0x6C, 0xC7, 0xF1, 0xD4, 0x6E, 0x5F, 0x23, 0x68, 0xD2, 0x4E, 0x8D, 0x97, 0x6B, 0xDE,
-    0xF9, 0x92, 0xD9, 0x3D, 0xF3, 0x15, 0xC8, 0x85, 0x34, 0xAA, 0x1D, 0xA8, 0xE7, 0xED, 0xA6, 0xB0,
-    0x65, 0xFA, 0xCE, 0x17, 0x83, 0x7A, 0xEB, 0xD6, 0x85, 0x29, 0x67, 0x6E, 0x3A, 0x06, 0x75, 0xB1,
-    0x14, 0xEC, 0xDC, 0xB8, 0x39, 0x72, 0xB3, 0x65, 0x2E, 0xAA, 0x13, 0x73, 0x39, 0xE1, 0xA4, 0x05,
-    0xA3, 0x4A, 0xCA, 0xF5, 0x4A, 0xBD, 0x19, 0x9A, 0x45, 0xAC, 0x48, 0x3F, 0x3D, 0x6B, 0x1E, 0xAA,
-    0x7A, 0x75, 0xBC, 0x3A, 0xAE, 0x6B, 0xD9, 0xE7, 0x3A, 0xD5, 0x46, 0xE9, 0x48, 0x9D, 0x9C, 0xF9,
-    0x74, 0x56, 0x5D, 0x84, 0x3C, 0x62, 0x83, 0x40, 0xBD, 0x6C, 0xEF, 0x03, 0x67, 0x77, 0xE1, 0x99,
-    0x2E, 0xF1, 0x93, 0x8E, 0x5D, 0x00, 0xF5, 0x21, 0x71, 0xED, 0xFC, 0x7B, 0xDC, 0x03, 0x19, 0x21,
-    0xF6, 0x64, 0x18, 0x84, 0xF9, 0x15, 0xC8, 0x2D, 0xC8, 0x84, 0xFD, 0x0A, 0x0F, 0x2C, 0x7D, 0xF7,
-    0xED, 0x4A, 0x8E, 0x56, 0x0E, 0x93, 0x4B, 0xE4, 0x1F, 0x4F, 0x96, 0xCB, 0x17, 0x7F, 0x3D, 0xF9,
-    0xDF, 0xEA, 0x48, 0x8C, 0x49, 0xF2, 0x47, 0x90, 0x98, 0xB8, 0xC0, 0x0C, 0xFE, 0xD8, 0x9D, 0xE3,
-    0xA1, 0x32, 0x43, 0xD3, 0x0D, 0x8A, 0xC4, 0x64, 0xD2, 0x23, 0x6A, 0xD7, 0xCC, 0x35, 0x5F, 0xFA,
-    0xDF, 0xE5, 0x7D, 0x4D, 0xAC, 0xDD, 0xD6, 0x9D, 0xDF, 0x21, 0xA9, 0x27, 0xBA, 0x66, 0x6D, 0xAA,
-    0xAD, 0xD5, 0x04, 0x56, 0x62, 0x7A, 0x31, 0x8B, 0x20, 0x13, 0x9B, 0x9B, 0x2E, 0x8C, 0x81, 0x74,
-    0x49, 0xC9, 0x68, 0xBD, 0xF0, 0xC2, 0x1A, 0x20, 0x2F, 0x02, 0xAA, 0x85, 0x66, 0x3B, 0x46, 0xD1,
-    0xB7, 0x71, 0x81, 0x00, 0x7D, 0xEF, 0x92, 0x96, 0x50, 0x78, 0xE1, 0x45, 0xDC, 0x85, 0xB3, 0x09,
-    0xDA, 0x09, 0xD0, 0xB4, 0xC8, 0x3C, 0x01, 0x55, 0x16, 0x6A, 0xA1, 0xCE, 0xBC, 0x7B, 0x49, 0x59,
-    0x18, 0x78, 0x61, 0xA0, 0xA1, 0xED, 0x66, 0xB2, 0x30, 0x50, 0x33, 0x8E, 0x1C, 0x63, 0xE4, 0x69,
-    0x44, 0xC9, 0x74, 0x4C, 0x49, 0xFC, 0xE8, 0xEF, 0xF7, 0x3F, 0x87, 0xF7, 0xDE, 0xF7, 0x24, 0xC5,
-    0x76, 0xFC, 0x99, 0xCC, 0xB3, 0xC5, 0x27, 0xDD, 0xCB, 0xCB, 0x73, 0xCE, 0xFF, 0xFC, 0x3F, 0x7E,
-    0xFF, 0xAF, 0x73, 0x95, 0xD2, 0x3F, 0x25, 0x2F, 0x09, 0x2F, 0x41, 0x85, 0x8B, 0x3D, 0xC4, 0xB8,
-    0x7A, 0xFC, 0xAB, 0x7A, 0x40, 0xAD, 0xFC, 0xF8, 0xC3, 0x30, 0x94, 0x0E, 0x2E, 0x8D, 0x3A, 0x74,
-    0x73, 0xBB, 0x53, 0x76, 0xAD, 0xFC, 0x58, 0xB5, 0xCA, 0xC9, 0x55, 0xC4, 0xA7, 0x04, 0x39, 0x3F,
-    0xC7, 0xA7, 0x39, 0x35, 0xEF, 0x6F, 0x79, 0x89, 0xB6, 0x7B, 0x3C, 0x77, 0xC0, 0x33, 0xBD, 0x9B,
-    0xDB, 0xE9, 0xEA, 0x3B, 0x7A, 0xC4, 0x54, 0xED, 0xE3, 0x67, 0x7C, 0xBE, 0xE3, 0xE6, 0x7C, 0x5A,
-    0xA9, 0x92, 0xEF, 0x9C, 0xAD, 0x6D, 0x8C, 0xD3, 0xF2, 0xD2, 0x8F, 0xC3, 0xDB, 0xB5, 0x9F, 0x2B,
-    0xAB, 0xF7, 0xF0, 0x84, 0xEC, 0x71, 0x3C, 0x21, 0x88, 0xB7, 0xD4, 0xDE, 0x9F, 0x08, 0x1F, 0x48,
-    0x65, 0x9E, 0x6A, 0xE3, 0xCA, 0xD9, 0x5A, 0x79, 0x85, 0x3A, 0xA2, 0x9C, 0x0A, 0x8F, 0xE7, 0x93,
-    0x53, 0x3D, 0x66, 0x98, 0x72, 0x31, 0x05, 0xE7, 0x29, 0x8B, 0xEC, 0xCF, 0x36, 0x98, 0xCD, 0xD0,
-    0xE1, 0x9D, 0x2B, 0xDB, 0xAB, 0xEF, 0x58, 0x32, 0xCF, 0xA9, 0x52, 0x07, 0xF8, 0x99, 0xC3, 0x7C,
-    0x27, 0x90, 0xA7, 0xA5, 0x56, 0xF7, 0xAF, 0xCF, 0x15, 0x1E, 0xC6, 0xA9, 0x3C, 0xA1, 0x07, 0x16,
-    0x38, 0x0C, 0xFC, 0xEB, 0x70, 0xE9, 0xE6, 0xB9, 0x9B, 0x67, 0xCB, 0x1A, 0xAB, 0xA9, 0x0F, 0x63,
-    0xCC, 0xC3, 0x3E, 0xC6, 0xBC, 0xDF, 0x8A, 0x83, 0xD4, 0x52, 0x9C, 0xCD, 0x82, 0x36, 0x6B, 0x20,
-    0x72, 0x92, 0x0C, 0x18, 0x13, 0x0F, 0x51, 0xDE, 0x0D, 0x77, 0xE0, 0x3B, 0xA1, 0x50, 0xA0, 0xE6,
-    0x3C, 0x7B, 0x8E, 0x19, 0xA5, 0x18, 0xD3, 0x2F, 0x31, 0x26, 0x5E, 0xC4, 0x6C, 0x3A, 0x95, 0x61,
-    0x91, 0xEE, 0xD0, 0xAA, 0xE0, 0xD2, 0x30, 0x98, 0x07, 0xCA, 0xA6, 0xF1, 0xA9, 0x36, 0xEE, 0x78,
-    0xC4, 0x6D, 0xB9, 0x53, 0xB8, 0x38, 0x03, 0x5F, 0x7B, 0xF0, 0x85, 0x15, 0xF2, 0x78, 0xDC, 0xD9,
-    0x80, 0x3B, 0x14, 0xF1, 0xBD, 0x84, 0x97, 0x88, 0x37, 0xEC, 0x53, 0x1F, 0xB2, 0xD1, 0x21, 0x09,
-    0xE8, 0x71, 0xA3, 0xED, 0x8A, 0x1B, 0x7D, 0x9E, 0x9B, 0xF6, 0xC0, 0xAE, 0x8D, 0x96, 0xED, 0xBC,
-    0x13, 0x0B, 0x8C, 0x1B, 0x7D, 0xE7, 0x77, 0xB0, 0xC7, 0x72, 0x49, 0x17, 0xC3, 0x87, 0xD8, 0x3D,
-    0x9B, 0x1B, 0x1F, 0xDC, 0x3C, 0xD9, 0xAB, 0x24, 0x55, 0x5B, 0x16, 0xF6, 0x66, 0x93, 0x9F, 0xDB,
-    0xE4, 0x13, 0x9E, 0xF1, 0xF3, 0x71, 0x17, 0x23, 0x2E, 0x28, 0x3A, 0x37, 0xE4, 0xD8, 0x3F, 0x5E,
-    0xB6, 0xB1, 0x7F, 0x19, 0x9F, 0x91, 0x2D, 0x06, 0xE6, 0x25, 0x8E, 0x52, 0x65, 0x17, 0x51, 0x01,
-    0x5A, 0x05, 0x35, 0x08, 0xE0, 0x0D, 0xDF, 0x1F, 0x72, 0x32, 0x97, 0x52, 0x1B, 0xC3, 0x65, 0xDC,
-    0xF0, 0xED, 0x71, 0xEC, 0xAC, 0x8F, 0xF1, 0x7A, 0x63, 0x77, 0x56, 0x87, 0xDD, 0x0F, 0xE2, 0x19,
-    0x98, 0x32, 0x52, 0x56, 0x89, 0x6D, 0xF8, 0x33, 0x87, 0x73, 0xCE, 0x30, 0xAC, 0x8F, 0xE9, 0x28,
-    0x4C, 0x52, 0x79, 0x14, 0x15, 0x52, 0x51, 0x64, 0x26, 0xA8, 0xBE, 0x8A, 0x2D, 0xF0, 0xB9, 0x41,
-    0xB9, 0xF2, 0x5F, 0x02, 0x3F, 0x97, 0x73, 0x8C, 0x18, 0x5E, 0x76, 0x1B, 0x57, 0x33, 0x09, 0x3E,
-    0xB2, 0xA6, 0xD9, 0xB4, 0x52, 0x14, 0x89, 0x0D, 0xEC, 0xDF, 0x4C, 0x53, 0x84, 0x6B, 0xC2, 0x54,
-    0xED, 0x46, 0x33, 0x60, 0xA4, 0x49, 0xE4, 0x56, 0x7A, 0xA1, 0x9D, 0xDE, 0x66, 0x92, 0x77, 0xBA,
-    0xEB, 0x26, 0xB2, 0x68, 0x36, 0xC4, 0x1E, 0xB9, 0x57, 0x7E, 0x9C, 0xCA, 0xCF, 0xED, 0xCE, 0xC7,
-    0xF3, 0x1D, 0xCE, 0xFF, 0xC2, 0x5E, 0xF9, 0x00, 0xF7, 0x92, 0x2F, 0x38, 0x32, 0xB9, 0x47, 0x36,
-    0xA3, 0x35, 0x64, 0xE2, 0x48, 0x7C, 0xAE, 0x70, 0xD4, 0x9D, 0x5E, 0x14, 0x81, 0x98, 0xDE, 0xE1,
-    0x45, 0x0F, 0xCF, 0x34, 0x73, 0x10, 0xDE, 0xF3, 0xB1, 0x5C, 0x65, 0x65, 0xB1, 0xB9, 0x5D, 0xCD,
-    0x79, 0xE9, 0xC6, 0x7D, 0x97, 0xC7, 0x70, 0x11, 0x9A, 0x6D, 0x65, 0x0E, 0x32, 0x26, 0x97, 0xAB,
-    0x99, 0x44, 0x84, 0x50, 0xF6, 0x59, 0x2E, 0xC1, 0x9E, 0x1D, 0x5F, 0xEC, 0xEE, 0x7C, 0xF1, 0x4C,
-    0x3C, 0xEE, 0x1B, 0x7C, 0x48, 0x92, 0x15, 0x94, 0x66, 0xDC, 0x1B, 0x36, 0xBB, 0x15, 0x03, 0x1F,
-    0x39, 0xC8, 0xA6, 0x63, 0xFD, 0x2F, 0xCA, 0xE4, 0xD4, 0x8E, 0x66, 0x44, 0xBB, 0x72, 0x45, 0x0B,
-    0xFA, 0x69, 0x28, 0x2F, 0x6F, 0x8E, 0x2F, 0x6B, 0x0D, 0xE1, 0xA7, 0x32, 0x0B, 0xE8, 0x92, 0xE9,
-    0x71, 0x79, 0x59, 0xF3, 0xAB, 0x4F, 0x55, 0x83, 0xA7, 0x6E, 0x61, 0x42, 0x49, 0x81, 0x97, 0xB1,
-    0x30, 0x70, 0x9A, 0x1F, 0x63, 0x09, 0x09, 0x9F, 0x1D, 0xC6, 0x5A, 0xA1, 0xB5, 0x5C, 0x59, 0xC4,
-    0x35, 0x86, 0x29, 0x96, 0x8C, 0xD5, 0x74, 0xF7, 0x41, 0xD4, 0xE7, 0x58, 0x6B, 0x82, 0x1B, 0x6E,
-    0x7C, 0x67, 0xB0, 0x87, 0xDC, 0xA2, 0xD4, 0x41, 0x7A, 0xF1, 0xCC, 0xCB, 0xCA, 0x5A, 0x4E, 0xBC,
-    0x0C, 0xB0, 0x69, 0x98, 0x38, 0xF6, 0x39, 0x95, 0x8D, 0x0B, 0xB9, 0x90, 0x99, 0xFC, 0x4F, 0xDA,
-    0xC9, 0x14, 0x31, 0x3F, 0x99, 0x62, 0xA2, 0x89, 0x03, 0xE2, 0x92, 0x20, 0x24, 0xA3, 0xE8, 0x88,
-    0xC8, 0x10, 0x8E, 0xCB, 0x1F, 0x5E, 0x50, 0xAE, 0xFC, 0xC6, 0x6C, 0x5E, 0x5C, 0xDF, 0x48, 0x37,
-    0x2A, 0xEE, 0xCC, 0x4C, 0x05, 0x05, 0xD5, 0x0C, 0xE6, 0x19, 0x07, 0xF2, 0xB0, 0x39, 0xB7, 0x6E,
-    0x8A, 0x11, 0xF0, 0x30, 0xFC, 0xEF, 0xE7, 0x54, 0x45, 0x05, 0x46, 0xE0, 0xC3, 0x94, 0x5B, 0x63,
-    0xB1, 0x56, 0xB7, 0x9E, 0xC5, 0x19, 0x67, 0x46, 0x45, 0xD8, 0x3A, 0xE4, 0xF2, 0xF1, 0x47, 0x54,
-    0xA2, 0x2D, 0xE3, 0x44, 0xDB, 0xC3, 0xF6, 0xDC, 0x29, 0xFC, 0xC2, 0x29, 0x44, 0x27, 0x3A, 0x79,
-    0x90, 0x3B, 0xF9, 0x03, 0x98, 0xE1, 0x01, 0xB3, 0xAB, 0x5A, 0x27, 0x44, 0xFB, 0x6F, 0x80, 0x07,
-    0x6E, 0x0D, 0xC2, 0xD3, 0xD4, 0x8A, 0x0D, 0xE5, 0xB8, 0xE3, 0xBB, 0x98, 0x4F, 0x14, 0x63, 0x44,
-    0x21, 0x21, 0x49, 0x49, 0xE9, 0xE2, 0x4C, 0x66, 0xA2, 0x90, 0x0B, 0xB9, 0x11, 0x14, 0xB4, 0x86,
-    0x16, 0x3C, 0x1E, 0x0D, 0xB2, 0x5D, 0x4A, 0xF6, 0x52, 0xC9, 0x16, 0xDA, 0xB2, 0xA1, 0xAE, 0x6C,
-    0xBE, 0xA7, 0xAF, 0x32, 0x57, 0x2B, 0xDE, 0x25, 0x20, 0x0F, 0x08, 0xEB, 0x66, 0xB9, 0x03, 0x66,
-    0xC6, 0x0C, 0x0E, 0xD5, 0x0A, 0xFF, 0xC4, 0x96, 0xF5, 0xFB, 0x38, 0x91, 0x99, 0x90, 0x72, 0x4B,
-    0x18, 0x72, 0x22, 0xAC, 0x3A, 0x91, 0xC9, 0x87, 0xC2, 0x85, 0xBE, 0xAC, 0x81, 0x0A, 0x42, 0xC9,
-    0x96, 0xE1, 0xED, 0x4E, 0xDE, 0x16, 0xEE, 0x6D, 0x65, 0x8D, 0x89, 0x70, 0x6C, 0x40, 0xB5, 0x8E,
-    0xB7, 0x39, 0x29, 0x6A, 0xFB, 0x98, 0x3C, 0xEC, 0x93, 0x79, 0x95, 0x35, 0x88, 0x46, 0x0C, 0xC9,
-    0x62, 0xB9, 0xAD, 0x8D, 0xDF, 0x2E, 0xED, 0x7C, 0xBF, 0xFE, 0x25, 0xA2, 0xA2, 0x78, 0xBB, 0xD6,
-    0x99, 0xB5, 0xD1, 0x5F, 0xFA, 0xD7, 0x9E, 0x55, 0x69, 0xB9, 0xC4, 0xBA, 0x06, 0x59, 0x18, 0x78,
-    0x8A, 0x2B, 0x53, 0x10, 0x01, 0x0A, 0xA0, 0x51, 0x30, 0xA1, 0xD6, 0x28, 0xA1, 0xD6, 0x33, 0x61,
-    0x2B, 0x92, 0x18, 0xCD, 0x65, 0x86, 0x11, 0xEF, 0x69, 0xD5, 0x44, 0x6B, 0x9D, 0x89, 0xD6, 0x45,
-    0x13, 0x91, 0x7C, 0x90, 0x40, 0xEE, 0xD9, 0x22, 0xB7, 0xAB, 0x76, 0x4B, 0x44, 0x37, 0xD9, 0xD2,
-    0xFA, 0xAA, 0xD3, 0xDA, 0xA1, 0x15, 0x41, 0xA5, 0xFE, 0x8C, 0x64, 0xA9, 0xA3, 0xB6, 0x73, 0x6B,
-    0x2C, 0xB6, 0xA3, 0xC2, 0xE7, 0x9A, 0x83, 0xA1, 0x5E, 0x4E, 0xD7, 0xC2, 0x1D, 0x01, 0xED, 0x36,
-    0x6E, 0xFF, 0x2E, 0x9F, 0x0F, 0xE3, 0x63, 0x54, 0x8C, 0xB7, 0x62, 0x2B, 0x16, 0x3F, 0x0E, 0xEC,
-    0x45, 0x36, 0x3C, 0x35, 0xD4, 0xCE, 0xD0, 0xBA, 0x9D, 0x12, 0xD9, 0xE2, 0x1C, 0xB8, 0x94, 0x98,
-    0xEB, 0x6A, 0xB8, 0x48, 0x8C, 0x0B, 0x56, 0xDE, 0x22, 0xF9, 0x20, 0x96, 0xF8, 0x27, 0x77, 0x2E,
-    0x3C, 0xCA, 0x71, 0xA7, 0x3E, 0x9F, 0xDA, 0x6E, 0xF2, 0x59, 0xEF, 0x51, 0x66, 0xBC, 0x7E, 0x01,
-    0x89, 0xB4, 0xF0, 0x28, 0x61, 0x18, 0xCE, 0x43, 0x15, 0x3B, 0x32, 0x0F, 0x11, 0x2D, 0x51, 0x6B,
-    0x89, 0x30, 0xDC, 0x81, 0x15, 0x99, 0xAD, 0xA9, 0xE1, 0x13, 0x30, 0x22, 0x24, 0x96, 0x26, 0x77,
-    0x26, 0xD4, 0x05, 0x2D, 0x2D, 0xBD, 0x7E, 0xAA, 0xB9, 0x44, 0x9E, 0x4C, 0x4D, 0xD8, 0x8A, 0xAC,
-    0x92, 0x66, 0x91, 0xB6, 0x95, 0x9A, 0x64, 0xAE, 0x18, 0x7E, 0xEE, 0x10, 0x29, 0xD6, 0xC9, 0x27,
-    0x70, 0x13, 0x3F, 0x81, 0x85, 0x51, 0xB4, 0xA7, 0xF2, 0x09, 0x6E, 0xA3, 0x7E, 0x84, 0xAB, 0x1F,
-    0x81, 0x4F, 0x58, 0xFD, 0xFA, 0x77, 0x7A, 0x91, 0x24, 0x70, 0x92, 0x60, 0x13, 0xF2, 0x8A, 0x5F,
-    0xAA, 0x85, 0xB5, 0x36, 0x56, 0x98, 0x1A, 0x4A, 0x38, 0x44, 0xBF, 0x76, 0x58, 0xFF, 0x2A, 0xF6,
-    0x10, 0xF8, 0xC0, 0xCA, 0x07, 0x34, 0xD3, 0x25, 0x72, 0x8B, 0x20, 0x09, 0x15, 0x8A, 0x9A, 0xF7,
-    0x9F, 0x12, 0xFB, 0x7F, 0x89, 0x34, 0x73, 0x8A, 0x56, 0x1E, 0x4D, 0xAE, 0xB0, 0x2A, 0x51, 0xEA,
-    0x8D, 0x28, 0xFE, 0x1D, 0x19, 0x7C, 0x22, 0x2B, 0x0A, 0xB7, 0xCF, 0xD6, 0x82, 0x37, 0x30, 0x51,
-    0xFF, 0xCA, 0x76, 0x96, 0x2B, 0x57, 0x96, 0x40, 0x42, 0xB4, 0xB2, 0xAA, 0x28, 0x96, 0x85, 0x95,
-    0x62, 0x27, 0x01, 0x08, 0x6B, 0x75, 0x68, 0xB8, 0x8E, 0xDB, 0x69, 0x66, 0xA8, 0xD4, 0x05, 0xAC,
-    0xE4, 0x44, 0x7B, 0x15, 0xE9, 0xD1, 0xF0, 0xA3, 0x47, 0x44, 0x9C, 0x44, 0x9A, 0x76, 0xA1, 0xBD,
-    0xF7, 0xB5, 0x0A, 0xBC, 0x4C, 0xFB, 0x00, 0x1E, 0x0A, 0x53, 0x80, 0x01, 0x51, 0x1D, 0x54, 0x21,
-    0xB9, 0xD6, 0x2E, 0x53, 0x7E, 0x36, 0x24, 0x52, 0xC4, 0x3B, 0x51, 0x4C, 0x7D, 0x93, 0x53, 0xCD,
-    0x09, 0x05, 0x53, 0x5C, 0x6E, 0xEC, 0xA2, 0xCA, 0x21, 0x3E, 0x48, 0x94, 0xD5, 0x7F, 0x6B, 0x3C,
-    0x81, 0x6E, 0x1D, 0x9F, 0x32, 0xD7, 0x17, 0x97, 0xD3, 0xC6, 0xAC, 0x30, 0x9B, 0x82, 0x68, 0xB9,
-    0x20, 0xD2, 0xA5, 0xE1, 0x0F, 0x68, 0x37, 0xC2, 0x18, 0xE3, 0x47, 0xD4, 0x4C, 0x11, 0x07, 0x4D,
-    0x78, 0x91, 0xE1, 0x67, 0xE4, 0x91, 0x56, 0x43, 0x3E, 0xAF, 0xB2, 0xBA, 0x3F, 0x4D, 0xF2, 0x70,
-    0x10, 0xFE, 0x1E, 0x5E, 0xB8, 0x3B, 0xD0, 0xDD, 0x11, 0xE5, 0x68, 0x70, 0x5A, 0x02, 0xBC, 0xC3,
-    0x65, 0x1C, 0x5F, 0x05, 0xBA, 0x4B, 0x34, 0xB6, 0x07, 0x02, 0x2F, 0x80, 0xEE, 0x9D, 0xDF, 0xF1,
-    0x06, 0x31, 0xF1, 0xFD, 0x42, 0xAF, 0x57, 0x9A, 0xAD, 0x70, 0x6B, 0xF0, 0x36, 0x91, 0x04, 0x0D,
-    0x23, 0x6F, 0xAE, 0xC4, 0x9E, 0x7B, 0xB9, 0xD8, 0x9C, 0x89, 0x66, 0x32, 0xC1, 0xAD, 0x78, 0x4D,
-    0x0C, 0xEC, 0x44, 0x69, 0x76, 0x90, 0xD7, 0xFC, 0x54, 0x86, 0xD8, 0x12, 0x4E, 0xD0, 0xA4, 0x07,
-    0x62, 0xB1, 0x35, 0x22, 0xE1, 0x6B, 0xE0, 0x05, 0xCD, 0x2A, 0xB4, 0x65, 0xB6, 0xEC, 0x2F, 0x65,
-    0x03, 0x8F, 0xD8, 0x0F, 0xDE, 0xEE, 0x8C, 0x39, 0x2B, 0xB4, 0x35, 0x8B, 0x39, 0x73, 0xAB, 0x15,
-    0x1D, 0xED, 0x96, 0x76, 0x25, 0x0F, 0x13, 0x61, 0xDD, 0x51, 0x8F, 0xD2, 0x00, 0x94, 0x00, 0xAD,
-    0x18, 0x34, 0xB6, 0xB9, 0xC2, 0xAF, 0x7E, 0x81, 0xCE, 0xC2, 0xA8, 0x9D, 0xB1, 0x37, 0x0D, 0x91,
-    0x0A, 0xF8, 0x06, 0x88, 0x12, 0x28, 0x2E, 0xA2, 0xF1, 0xA7, 0x52, 0x04, 0xBD, 0xF7, 0x05, 0xA9,
-    0x5B, 0x3A, 0xCD, 0x01, 0x4D, 0x4E, 0x0D, 0xF4, 0x0B, 0x3F, 0x0F, 0x62, 0xC1, 0x1F, 0xBE, 0x98,
-    0x1F, 0x98, 0x36, 0x3F, 0xD5, 0x16, 0xF7, 0x42, 0x70, 0x5A, 0x1B, 0x84, 0xCD, 0xF0, 0x71, 0x6D,
-    0xFB, 0x06, 0x03, 0xA9, 0x6D, 0x91, 0x0F, 0x12, 0xA5, 0x9E, 0xCA, 0x6C, 0x31, 0xB3, 0x2D, 0x6D,
-    0x3D, 0xA2, 0x7C, 0xA6, 0x0D, 0xEF, 0xA0, 0x5A, 0xB1, 0x8F, 0x76, 0x87, 0x95, 0x8B, 0x8A, 0x6D,
-    0x2C, 0xB1, 0xBD, 0x2A, 0x2C, 0x6D, 0x6D, 0x9F, 0xB2, 0x1C, 0x24, 0x8D, 0xA0, 0x3E, 0x07, 0x59,
-    0x14, 0xFE, 0x07, 0xC7, 0x02, 0x78, 0x42, 0x58, 0x4A, 0x82, 0x13, 0x98, 0x2A, 0x6B, 0x55, 0x51,
-    0xA8, 0xFD, 0x58, 0x29, 0x88, 0x9B, 0x3B, 0x37, 0x4E, 0xB6, 0x8A, 0x1E, 0xCD, 0x26, 0x06, 0x7E,
-    0x08, 0x32, 0xED, 0xC4, 0x0B, 0x6C, 0x49, 0xB5, 0x0A, 0x7C, 0x1F, 0x41, 0x22, 0x7C, 0xEC, 0x82,
-    0x75, 0x92, 0x2C, 0x46, 0x3B, 0xE4, 0x34, 0x06, 0xDB, 0x85, 0x67, 0x80, 0x45, 0x5E, 0xAB, 0xA0,
-    0x13, 0x7A, 0x2C, 0x20, 0xAC, 0x4F, 0x35, 0x00, 0x19, 0xB5, 0xB8, 0x08, 0xDA, 0x39, 0x8D, 0xB4,
-    0xED, 0xF0, 0x45, 0xDF, 0xA6, 0x54, 0xB6, 0x58, 0x84, 0x70, 0x8A, 0xB6, 0x5C, 0x34, 0x72, 0x1C,
-    0x2F, 0xD3, 0x16, 0x27, 0xD3, 0x80, 0xBA, 0xD7, 0x08, 0xBA, 0x9D, 0xCB, 0xE6, 0x35, 0xDA, 0x2A,
-    0x35, 0xDA, 0x2A, 0x35, 0x1A, 0x74, 0x37, 0x82, 0xB2, 0x5F, 0xAD, 0x45, 0xF1, 0x5C, 0xAB, 0x39,
-    0x57, 0xAB, 0xAB, 0xB5, 0xE5, 0xAA, 0x35, 0x30, 0xD7, 0x8A, 0x98, 0x76, 0xDB, 0xE0, 0x73, 0x03,
-    0xC8, 0x83, 0x42, 0x00, 0x71, 0x46, 0x7D, 0x41, 0x2A, 0xED, 0x56, 0xA5, 0xF7, 0xC9, 0x1E, 0xC4,
-    0x6E, 0x2A, 0x8C, 0xEA, 0xE4, 0xC2, 0x3B, 0x5A, 0x05, 0xD3, 0x30, 0x8B, 0x2D, 0x2B, 0xD4, 0x5D,
-    0x7E, 0x68, 0xE6, 0x42, 0xED, 0x3D, 0xD0, 0xA0, 0xEF, 0x37, 0x76, 0x7B, 0xA6, 0x61, 0x33, 0xE6,
-    0xE8, 0x69, 0x5F, 0xC2, 0xD3, 0xCE, 0x03, 0x91, 0x0E, 0xB1, 0xDB, 0x55, 0x31, 0xF1, 0xFE, 0x2B,
-    0xBC, 0x47, 0xF9, 0x67, 0xE4, 0x1E, 0x3F, 0x95, 0x7B, 0xFC, 0x54, 0xDC, 0x0E, 0x20, 0x5F, 0xDE,
-    0x03, 0x91, 0xA1, 0x89, 0x0F, 0x62, 0x92, 0x2E, 0x78, 0x53, 0xB6, 0xCA, 0xC5, 0xF6, 0xF0, 0x9E,
-    0x41, 0x4B, 0xC3, 0xB0, 0x70, 0x3E, 0x8C, 0x4B, 0x42, 0xEF, 0x4C, 0x7C, 0x10, 0x01, 0x18, 0xEE,
-    0xC2, 0x15, 0xF9, 0xF2, 0x62, 0x29, 0xED, 0x0D, 0xD0, 0xC3, 0xC5, 0x87, 0xF6, 0xDF, 0x38, 0x49,
-    0x6E, 0x0B, 0x45, 0xD7, 0x38, 0x95, 0x88, 0x86, 0x60, 0x1A, 0xB8, 0x7E, 0x22, 0x30, 0x3B, 0x46,
-    0x5B, 0x71, 0xEB, 0xAD, 0xDA, 0xD2, 0x37, 0x93, 0x12, 0x4E, 0x29, 0xF3, 0xD8, 0x92, 0x4F, 0xFA,
-    0xB9, 0x7C, 0xB2, 0xD6, 0x6C, 0xAB, 0x9D, 0xAB, 0x52, 0x84, 0x49, 0x2B, 0xB3, 0x50, 0xE0, 0xEB,
-    0x13, 0x82, 0x5F, 0x09, 0xFA, 0x1B, 0x6E, 0x0E, 0x3D, 0x79, 0x40, 0x07, 0x4A, 0x68, 0x3C, 0x6E,
-    0x30, 0x95, 0x6B, 0x27, 0xBF, 0x2D, 0x2A, 0x0B, 0xD8, 0x57, 0x87, 0x92, 0x8C, 0xDF, 0xDC, 0x08,
-    0x35, 0xC5, 0x76, 0x92, 0xA7, 0x67, 0x70, 0x28, 0x39, 0x6E, 0x03, 0x58, 0x46, 0xBE, 0xAB, 0x5B,
-    0xB5, 0x43, 0x24, 0x50, 0x41, 0xDA, 0x64, 0x6F, 0x66, 0x76, 0xC5, 0xDF, 0xE5, 0xCC, 0x29, 0x22,
-    0xAE, 0x65, 0xEA, 0xE5, 0x53, 0x4E, 0x33, 0xF2, 0xA9, 0xA5, 0xFC, 0x34, 0x9A, 0xF0, 0x77, 0x10,
-    0x47, 0x9B, 0x9C, 0x72, 0x48, 0x08, 0x29, 0x18, 0x05, 0x6C, 0x3D, 0xE3, 0xA2, 0xC0, 0xC5, 0x33,
-    0x2E, 0xDE, 0x67, 0x4C, 0x42, 0x1B, 0xD4, 0x56, 0x7B, 0x15, 0x8A, 0x90, 0x8D, 0xF8, 0x6C, 0x28,
-    0x08, 0x70, 0x40, 0xCE, 0xE2, 0xC3, 0xE5, 0x70, 0x37, 0xF2, 0x73, 0xB4, 0x1C, 0x5A, 0xC6, 0x93,
-    0x9D, 0x1B, 0xF9, 0x89, 0xB5, 0x4E, 0xCF, 0xC5, 0x42, 0x93, 0x12, 0xF0, 0x50, 0xBE, 0x63, 0xEE,
-    0x99, 0x2D, 0xEE, 0x31, 0x08, 0x8A, 0xD3, 0x37, 0x0E, 0xF2, 0xE8, 0x11, 0x7F, 0x54, 0x39, 0xCC,
-    0x48, 0xC9, 0x90, 0x03, 0xB9, 0xFD, 0x3A, 0x03, 0x07, 0xD8, 0x93, 0xD4, 0xA5, 0xB6, 0xA0, 0x03,
-    0xA7, 0x7A, 0x32, 0x13, 0x5C, 0x79, 0x42, 0xCE, 0x8A, 0x6A, 0x30, 0xB8, 0x24, 0x0C, 0x27, 0x1C,
-    0xD0, 0x52, 0x73, 0x79, 0xD7, 0xC9, 0x13, 0xD1, 0xF3, 0xDC, 0xF2, 0x2E, 0xA4, 0xAD, 0x92, 0xFB,
-    0xA2, 0x67, 0x5B, 0x91, 0x66, 0x0A, 0x58, 0x41, 0x26, 0xEC, 0x89, 0xFD, 0x80, 0x21, 0xC3, 0xFA,
-    0x2B, 0xBD, 0x8C, 0x48, 0x13, 0xA6, 0x71, 0xEE, 0xF1, 0x91, 0x13, 0xB1, 0xCB, 0xC3, 0x60, 0x50,
-    0xCC, 0x76, 0x76, 0x07, 0xA8, 0xE8, 0x6A, 0xA8, 0x68, 0xD6, 0xD9, 0xED, 0x82, 0x8A, 0xF9, 0x0A,
-    0x54, 0xB4, 0x77, 0x41, 0x45, 0x2D, 0xA0, 0x42, 0x07, 0x8D, 0x36, 0xA7, 0x77, 0x41, 0x9B, 0xB9,
-    0xDC, 0x34, 0x17, 0xAA, 0x24, 0x84, 0x8A, 0x74, 0xE4, 0xF6, 0x02, 0x9C, 0x1A, 0x00, 0xC7, 0x15,
-    0x48, 0xD6, 0xF3, 0x83, 0x89, 0xBE, 0xB8, 0xBC, 0xE0, 0xD9, 0x53, 0x3E, 0x8F, 0xF0, 0x5A, 0x1C,
-    0x45, 0x0F, 0xB0, 0xFB, 0x6F, 0xA0, 0x70, 0x43, 0xAA, 0x82, 0x88, 0x98, 0x65, 0xE9, 0xB0, 0xDF,
-    0x2D, 0x1C, 0x10, 0x6A, 0x50, 0x51, 0x2D, 0xB6, 0x88, 0x81, 0x99, 0x8F, 0x15, 0x05, 0xDA, 0x15,
-    0xF1, 0xB9, 0x53, 0x14, 0x48, 0xB6, 0x56, 0x45, 0xD8, 0x81, 0x32, 0x80, 0xF4, 0xC1, 0x24, 0x6F,
-    0x0F, 0x29, 0x86, 0xE8, 0x38, 0x58, 0xA1, 0x77, 0x44, 0xBC, 0xD6, 0x90, 0x97, 0x68, 0x3B, 0xDB,
-    0x9E, 0x53, 0x0F, 0x1C, 0x39, 0x8C, 0x0D, 0x39, 0x7C, 0x18, 0xF3, 0x3D, 0xFC, 0x18, 0xE6, 0xFB,
-    0xCC, 0x4A, 0xF8, 0x62, 0x19, 0xB9, 0xF8, 0x90, 0xF0, 0x45, 0xBA, 0x6B, 0xAA, 0xD4, 0x51, 0x82,
-    0xA9, 0x42, 0x5E, 0x20, 0x39, 0xE0, 0x52, 0x28, 0x74, 0x78, 0xAD, 0x80, 0xD4, 0xF8, 0xFC, 0x9C,
-    0xAB, 0xB1, 0x84, 0xD8, 0x02, 0x20, 0xC4, 0x54, 0xF1, 0x01, 0x2E, 0x5D, 0x2B, 0x45, 0x3D, 0xD9,
-    0x12, 0xE0, 0xD8, 0x35, 0xE1, 0x80, 0x5B, 0x8A, 0xA7, 0xFF, 0x32, 0x07, 0x8A, 0x8E, 0xC8, 0xB2,
-    0xCB, 0x85, 0x67, 0xA8, 0xED, 0xBB, 0xB8, 0x36, 0x8A, 0x3E, 0xCB, 0x7D, 0x82, 0x88, 0xB2, 0x6E,
-    0x61, 0x65, 0x5C, 0x81, 0x2D, 0x63, 0xB8, 0xE1, 0xDE, 0xED, 0x1F, 0x8B, 0xAB, 0x58, 0x2D, 0x76,
-    0x49, 0xF4, 0xB4, 0x7A, 0xB0, 0xFF, 0x11, 0xA7, 0x4C, 0xE8, 0x9A, 0xFC, 0xAA, 0xCB, 0x4A, 0xAB,
-    0xB7, 0x6A, 0xAF, 0x76, 0x2B, 0xBB, 0x82, 0xE5, 0x28, 0x9C, 0xCA, 0x6A, 0xE1, 0xD1, 0x03, 0xD5,
-    0x85, 0x31, 0x78, 0xB5, 0x8D, 0x62, 0xB7, 0xB0, 0xDA, 0x08, 0xC8, 0xC5, 0x86, 0x69, 0xF5, 0x73,
-    0xA7, 0x8E, 0xA0, 0x3C, 0xBD, 0x32, 0xCC, 0x83, 0x34, 0xCC, 0xFD, 0x3A, 0x38, 0x36, 0x28, 0x1D,
-    0x5E, 0x84, 0x50, 0xF6, 0xF1, 0xB8, 0x3D, 0x9A, 0x37, 0xAC, 0x79, 0xBC, 0x50, 0xFA, 0x0F, 0x6E,
-    0xBF, 0xA0, 0x3D, 0x57, 0xCE, 0x08, 0xAC, 0x19, 0x81, 0x17, 0x89, 0xD9, 0xB1, 0x3E, 0xC8, 0x9C,
-    0x58, 0x90, 0x58, 0xE8, 0x9D, 0xE9, 0xCF, 0x6A, 0x33, 0x8A, 0x41, 0x65, 0xE9, 0xEF, 0x55, 0x4B,
-    0x67, 0x5F, 0x2C, 0x82, 0x40, 0x1E, 0xAD, 0x64, 0x45, 0xDB, 0x46, 0x89, 0x0E, 0xF2, 0x08, 0x27,
-    0x86, 0x47, 0x65, 0x5B, 0x6B, 0xA1, 0x18, 0xC0, 0x97, 0x8E, 0x6C, 0x71, 0x23, 0xB1, 0x85, 0xC6,
-    0xCA, 0x45, 0x14, 0x85, 0x18, 0xF2, 0x4B, 0x23, 0x37, 0x68, 0xD5, 0xF7, 0xA5, 0x71, 0xF5, 0x62,
-    0xED, 0xEA, 0x95, 0xDA, 0xD5, 0xD3, 0x2E, 0x72, 0x67, 0x62, 0x82, 0x6A, 0xC9, 0x05, 0x4A, 0x47,
-    0xCD, 0x2D, 0xFD, 0x9A, 0xAB, 0x5F, 0xBB, 0x87, 0x3B, 0x91, 0x27, 0xC3, 0x2B, 0x43, 0x0D, 0x33,
-    0x0E, 0x45, 0x08, 0x18, 0x31, 0x35, 0x4E, 0xB4, 0x48, 0xB6, 0x36, 0x62, 0x62, 0x0A, 0x18, 0x17,
-    0x85, 0x6C, 0xA7, 0x96, 0x78, 0x28, 0xBE, 0x44, 0x61, 0xB2, 0x2B, 0x00, 0x56, 0x8E, 0xB8, 0x71,
-    0xDE, 0xF0, 0x83, 0x72, 0x31, 0xB4, 0x9F, 0x2F, 0x90, 0xB1, 0xB0, 0xBF, 0x5D, 0x2F, 0x9C, 0x4F,
-    0x57, 0x5C, 0x05, 0xF2, 0x80, 0x4D, 0xB6, 0x02, 0x25, 0xF3, 0xA1, 0x13, 0xF3, 0xD1, 0xBB, 0x8C,
-    0xE0, 0xC0, 0x86, 0xE4, 0x30, 0x21, 0x81, 0x68, 0x7E, 0x1D, 0xEB, 0xA1, 0x7F, 0x13, 0x8B, 0xC9,
-    0xE0, 0x3C, 0x3C, 0x11, 0x06, 0x09, 0x58, 0x91, 0x4A, 0x41, 0x6E, 0xC8, 0x32, 0x37, 0x84, 0x61,
-    0xA0, 0x2D, 0x35, 0x13, 0x9F, 0x29, 0xFD, 0x08, 0x6D, 0x76, 0xAC, 0xC6, 0xD0, 0x58, 0xC7, 0xE9,
-    0xE4, 0x11, 0x86, 0xCE, 0x7A, 0xC7, 0xA7, 0xF2, 0x9A, 0x32, 0x8F, 0xD0, 0x9B, 0x28, 0x93, 0xD0,
-    0x91, 0x27, 0x52, 0xBC, 0x5B, 0x3F, 0xF5, 0xB3, 0xF5, 0xD1, 0xBD, 0x5E, 0x38, 0xD8, 0xE2, 0x23,
-    0xFD, 0x3E, 0xAD, 0x24, 0xBE, 0x6D, 0x25, 0x86, 0x7F, 0x96, 0x01, 0xF9, 0x65, 0x64, 0x79, 0x8C,
-    0xEC, 0x8D, 0xEF, 0x6C, 0x8E, 0xB1, 0x9A, 0x6A, 0x35, 0xBF, 0xA0, 0xB4, 0x7B, 0x15, 0x10, 0x5C,
-    0x85, 0x34, 0x1C, 0xD1, 0x36, 0xF6, 0x77, 0xC2, 0x99, 0x33, 0xFA, 0xA7, 0x2F, 0x8F, 0xED, 0x8D,
-    0x01, 0xD3, 0x37, 0x77, 0x38, 0xA8, 0xCB, 0x8F, 0x78, 0x12, 0x08, 0x2D, 0x60, 0x6B, 0x24, 0x10,
-    0xE9, 0xD3, 0xA1, 0xC5, 0xB0, 0x73, 0x4E, 0x78, 0xA6, 0x63, 0x02, 0x11, 0x21, 0x54, 0xB2, 0xBE,
-    0x21, 0xF3, 0x8D, 0x43, 0x71, 0xEB, 0x17, 0x31, 0x6E, 0xC2, 0x64, 0xA2, 0x12, 0xE2, 0x2B, 0x62,
-    0x64, 0xDA, 0x0F, 0x19, 0x27, 0x32, 0x2A, 0xD1, 0xA0, 0xD7, 0x11, 0x42, 0x50, 0x00, 0x45, 0x91,
-    0x74, 0x46, 0x77, 0x93, 0x52, 0xFF, 0x47, 0xB3, 0xAE, 0x0F, 0x59, 0x17, 0x9A, 0x12, 0x44, 0x8A,
-    0x84, 0x86, 0x95, 0x06, 0x34, 0x6E, 0xAD, 0xA5, 0xD8, 0xA9, 0x5D, 0xC1, 0x9B, 0x76, 0xA3, 0xCD,
-    0xAC, 0x53, 0x6B, 0x4C, 0xC3, 0x58, 0x3C, 0x1F, 0xE9, 0xCA, 0x6F, 0x88, 0x4D, 0x21, 0x7A, 0x64,
-    0x3D, 0xA3, 0xAF, 0x8A, 0x19, 0xB7, 0x9C, 0x5E, 0x26, 0x4E, 0x68, 0xBB, 0x3B, 0x46, 0x2F, 0x93,
-    0xD7, 0x33, 0xFF, 0x90, 0x10, 0xF9, 0xCF, 0x44, 0x41, 0xF6, 0x12, 0x52, 0x28, 0x75, 0x48, 0x03,
-    0x2C, 0x70, 0x5B, 0x48, 0x61, 0xCE, 0xA5, 0x74, 0xCB, 0x90, 0xC2, 0x7A, 0x76, 0x5B, 0x48, 0xC1,
-    0x98, 0xFB, 0x46, 0x38, 0x21, 0x56, 0x4C, 0x91, 0x28, 0x30, 0x63, 0x85, 0xDD, 0x75, 0x6B, 0x5C,
-    0x40, 0xEE, 0x42, 0x87, 0x51, 0xAD, 0xD5, 0xCB, 0xFE, 0xED, 0xB3, 0x2D, 0x4D, 0x03, 0xFE, 0xF6,
-    0x5F, 0x4F, 0x2C, 0x8C, 0xA2, 0x4C, 0x53, 0x62, 0x4D, 0x41, 0x7E, 0x98, 0x8A, 0x73, 0x87, 0x8E,
-    0x43, 0x4F, 0x73, 0x93, 0xBD, 0x9A, 0x54, 0xC4, 0x3D, 0xB1, 0x96, 0xFE, 0xBD, 0x39, 0xC6, 0x16,
-    0x73, 0x28, 0x95, 0x0E, 0x53, 0x42, 0x75, 0xC3, 0x6B, 0x48, 0xDE, 0xCE, 0x04, 0xDB, 0x24, 0x31,
-    0x31, 0x7C, 0xC7, 0xED, 0x8F, 0x98, 0x89, 0xC2, 0x6F, 0x97, 0xC1, 0x74, 0xF2, 0x63, 0x0F, 0x9A,
-    0x08, 0xCA, 0x4E, 0x1D, 0xD9, 0x14, 0x50, 0xA8, 0x25, 0xE5, 0xB0, 0x71, 0x91, 0x38, 0x24, 0x73,
-    0x12, 0x88, 0x6A, 0x28, 0xF6, 0xDE, 0x3E, 0x45, 0x5C, 0x57, 0xE8, 0x1B, 0x69, 0xB5, 0xB8, 0xDB,
-    0x90, 0x24, 0x89, 0x6C, 0x33, 0x10, 0x9E, 0x6A, 0xFF, 0xC6, 0x2B, 0x75, 0xC4, 0x12, 0x0B, 0x02,
-    0xE0, 0x0E, 0x29, 0x3E, 0x7E, 0xAD, 0x63, 0x43, 0xF6, 0xF0, 0x62, 0x96, 0xEA, 0xD0, 0xE5, 0xC0,
-    0x84, 0x51, 0x6C, 0x2D, 0xF2, 0x94, 0xC7, 0x47, 0xF8, 0x22, 0x31, 0x13, 0x5E, 0x93, 0x9B, 0x99,
-    0xCC, 0x10, 0xBC, 0x0B, 0x1A, 0x6A, 0xCE, 0x8B, 0x44, 0x8C, 0xA7, 0x82, 0x90, 0xB7, 0xE4, 0xEF,
-    0x3B, 0x66, 0x2E, 0xF4, 0xA4, 0x5B, 0xF1, 0xDF, 0xC5, 0xD1, 0x10, 0xAC, 0x18, 0x9D, 0x90, 0x40,
-    0x89, 0xCE, 0xCB, 0xD0, 0xC6, 0x39, 0x92, 0xAF, 0xF0, 0x4A, 0x6A, 0x0E, 0x58, 0xD4, 0x9C, 0x16,
-    0x10, 0xD7, 0x73, 0x1D, 0x25, 0x3F, 0xAB, 0x6D, 0x71, 0x2B, 0x08, 0x31, 0x56, 0x43, 0xC7, 0x49,
-    0x79, 0x01, 0xCF, 0xBB, 0xAA, 0xFC, 0xF7, 0x33, 0x98, 0x6D, 0x4C, 0x08, 0xD0, 0x8D, 0x9F, 0x6D,
-    0xA9, 0x45, 0xD2, 0x10, 0x2E, 0x84, 0x4C, 0x6C, 0x8A, 0xCD, 0xC3, 0xD3, 0x7B, 0x50, 0x22, 0x2C,
-    0x21, 0x88, 0xB3, 0x7B, 0x32, 0xFB, 0xBD, 0xD7, 0x7E, 0xDE, 0xB7, 0x93, 0x36, 0x1A, 0x9C, 0xC1,
-    0x1A, 0xD2, 0x28, 0xB5, 0x62, 0x15, 0xEF, 0x0A, 0xD5, 0x0A, 0xD4, 0xCA, 0x5A, 0x31, 0x23, 0x58,
-    0x36, 0xD0, 0x02, 0xCD, 0xB8, 0x84, 0x2D, 0xB6, 0xC6, 0x08, 0xA3, 0x78, 0x76, 0x0D, 0x36, 0xDF,
-    0x7B, 0x13, 0x2C, 0x1E, 0xDD, 0x00, 0x6B, 0xC1, 0x98, 0xE6, 0x1E, 0x39, 0x16, 0x1B, 0xDA, 0x29,
-    0x66, 0x1A, 0x25, 0x9A, 0x1F, 0xE4, 0x32, 0x0F, 0x4B, 0x66, 0x56, 0x08, 0xD2, 0x84, 0x7B, 0x05,
-    0xDA, 0x17, 0xD8, 0x88, 0x88, 0x24, 0x09, 0x49, 0xEE, 0xB5, 0x45, 0x5E, 0x53, 0x36, 0x01, 0x8F,
-    0x99, 0x03, 0x8A, 0xC0, 0x83, 0xF4, 0xF2, 0x46, 0xC1, 0xDD, 0xF1, 0xAA, 0xE8, 0xE4, 0x40, 0x6C,
-    0xFD, 0x04, 0x76, 0x90, 0xB9, 0x98, 0x99, 0x72, 0xAE, 0x83, 0x63, 0x9E, 0x03, 0x9D, 0xFD, 0x32,
-    0x28, 0x42, 0xD1, 0x50, 0xF1, 0x22, 0x5A, 0x6E, 0x8B, 0x0F, 0x93, 0x4E, 0x8F, 0xB5, 0x9E, 0x48,
-    0x57, 0xAB, 0xCD, 0xB1, 0x24, 0x22, 0xDC, 0x46, 0x1C, 0x9A, 0x5E, 0x5E, 0x02, 0x47, 0x7C, 0x03,
-    0xC8, 0xE3, 0x4C, 0xF7, 0x95, 0x2A, 0x00, 0x13, 0x24, 0xBD, 0xE6, 0x62, 0xEB, 0xDB, 0x4A, 0x9E,
-    0x07, 0x49, 0xB4, 0x0A, 0xDA, 0x37, 0x91, 0x96, 0xD6, 0x80, 0xA8, 0xA9, 0xFC, 0xB1, 0xFB, 0x84,
-    0x4C, 0xA3, 0xFA, 0x13, 0x03, 0x9E, 0x32, 0x07, 0x85, 0xA6, 0xE0, 0xDF, 0x19, 0x68, 0x33, 0xA3,
-    0xC8, 0x52, 0x58, 0x21, 0xAB, 0x35, 0x95, 0xC7, 0x5C, 0x12, 0x88, 0x7E, 0x8E, 0x0F, 0x80, 0x3E,
-    0x73, 0xF1, 0x1B, 0x5C, 0xAA, 0xE5, 0x03, 0xE3, 0x86, 0xD6, 0xB4, 0x35, 0x7E, 0x3E, 0x73, 0x4A,
-    0xB7, 0xD8, 0x51, 0x33, 0x3F, 0x0D, 0x5E, 0xAA, 0xB0, 0x68, 0xB7, 0x75, 0x6F, 0x61, 0x77, 0x3B,
-    0x09, 0x06, 0xCC, 0x64, 0x1B, 0x1E, 0x86, 0xFE, 0x7C, 0xBC, 0xDF, 0x28, 0x43, 0x7A, 0xE4, 0xCD,
-    0x82, 0x4B, 0x85, 0x78, 0xB5, 0x3A, 0x0F, 0xCA, 0x06, 0x03, 0x34, 0x73, 0xD4, 0xFA, 0xE7, 0x4A,
-    0x78, 0xC2, 0x73, 0x2F, 0x86, 0xF7, 0x73, 0x04, 0x94, 0x09, 0xFD, 0x92, 0xD1, 0x33, 0xF7, 0x15,
-    0x71, 0xCC, 0xAD, 0xF7, 0x76, 0x24, 0x02, 0xF5, 0xD7, 0x7F, 0xA1, 0x33, 0x72, 0xAF, 0x7C, 0x4F,
-    0x34, 0xD1, 0xEB, 0x6F, 0x32, 0xCF, 0xE8, 0x16, 0xC3, 0x11, 0xD9, 0xEB, 0xE4, 0xA9, 0x94, 0xB0,
-    0x2A, 0x3C, 0x53, 0x5A, 0xB0, 0x0D, 0x7E, 0xDE, 0xDA, 0xAF, 0x5D, 0xA9, 0x9D, 0x22, 0xFC, 0x41,
-    0x35, 0x40, 0x91, 0x38, 0x43, 0x09, 0x17, 0xF3, 0x02, 0xC3, 0xC7, 0xF1, 0x12, 0x7A, 0x82, 0xF6,
-    0x16, 0x14, 0x6C, 0x74, 0xB4, 0x73, 0x81, 0x21, 0x0F, 0x90, 0x6B, 0x18, 0xAC, 0xAF, 0xD5, 0x1F,
-    0x03, 0x66, 0x40, 0x21, 0x1C, 0x84, 0x06, 0x17, 0x6D, 0x7C, 0x09, 0x7E, 0xF4, 0x8E, 0x8A, 0xBE,
-    0x57, 0x06, 0x55, 0x36, 0x34, 0x36, 0xE3, 0xB1, 0xE3, 0x62, 0x36, 0x60, 0x55, 0xDD, 0x21, 0xB7,
-    0xDA, 0xB5, 0x84, 0x12, 0x85, 0xCD, 0x8D, 0xCD, 0x2F, 0x91, 0xAC, 0x80, 0xF1, 0xC6, 0xD9, 0xE2,
-    0x17, 0x01, 0x2B, 0xED, 0x8B, 0x40, 0x9D, 0xBF, 0x2E, 0x9E, 0x6D, 0xBC, 0x9F, 0xFA, 0xEE, 0xFB,
-    0xED, 0x14, 0x60, 0x33, 0x1F, 0xF2, 0xB0, 0x81, 0xAC, 0xEE, 0x5B, 0xE6, 0xE1, 0x30, 0x43, 0xA5,
-    0xBE, 0x85, 0xFF, 0x00, 0xBC, 0x19, 0x89, 0xF4, 0xA1, 0x71, 0x7F, 0xD5, 0xE8, 0xFD, 0x56, 0x6B,
-    0x2B, 0xE4, 0xB4, 0xE0, 0xF8, 0xEC, 0x80, 0x98, 0x6E, 0x75, 0x70, 0xEF, 0x90, 0x7E, 0x2E, 0x51,
-    0x4E, 0x9F, 0x66, 0xC4, 0xFC, 0x22, 0x63, 0x8B, 0x52, 0x08, 0x0B, 0xAB, 0xB1, 0xAF, 0x1E, 0x73,
-    0xCB, 0xF0, 0xF0, 0xE1, 0xE0, 0xE7, 0xD7, 0x6E, 0x95, 0x94, 0x35, 0x20, 0x79, 0xE8, 0xD0, 0x03,
-    0x46, 0x8A, 0xF7, 0x43, 0x85, 0xBC, 0x0C, 0xE9, 0xAB, 0x4F, 0x94, 0x51, 0x6B, 0xD5, 0xD1, 0x51,
-    0xB5, 0x89, 0x3D, 0x09, 0x03, 0x10, 0xE5, 0x7B, 0x20, 0xFB, 0x9B, 0x20, 0xD0, 0x2D, 0x3A, 0x51,
-    0x84, 0x9F, 0xD8, 0x01, 0xFF, 0x25, 0x28, 0xEE, 0x72, 0xAA, 0x8E, 0xC1, 0x1A, 0x95, 0x3B, 0x56,
-    0x5F, 0x43, 0x63, 0x36, 0x7E, 0x2A, 0xA1, 0xB5, 0x03, 0x8B, 0xD9, 0x6A, 0x35, 0x45, 0xF3, 0x76,
-    0x06, 0x9F, 0x3D, 0x42, 0x15, 0xB3, 0x43, 0x69, 0xAD, 0xE1, 0x6B, 0x58, 0x15, 0x38, 0xC7, 0xA6,
-    0x5E, 0x65, 0xE8, 0x51, 0xB9, 0xD4, 0xB4, 0x5E, 0x0E, 0x41, 0xF2, 0xE3, 0x50, 0x02, 0x26, 0x6B,
-    0x7F, 0x34, 0x55, 0x93, 0x47, 0x23, 0x28, 0x9B, 0x36, 0xC2, 0x5A, 0x6A, 0xF8, 0x56, 0x51, 0xBA,
-    0xB6, 0x92, 0xB0, 0x3A, 0xC4, 0xC8, 0x5B, 0x0C, 0x82, 0x32, 0xFE, 0x06, 0xD3, 0x94, 0x94, 0xCA,
-    0xCD, 0xD4, 0x04, 0x6E, 0xE9, 0xBB, 0xF9, 0x43, 0x80, 0x0F, 0xFF, 0xA3, 0xF2, 0xF1, 0xA4, 0xC3,
-    0x47, 0x3C, 0xCE, 0xD7, 0x3F, 0x73, 0x09, 0x16, 0xFB, 0xD2, 0x5B, 0xAF, 0xE2, 0xED, 0xB2, 0xA9,
-    0xF0, 0xF6, 0xF9, 0xF0, 0x3C, 0xDF, 0xF6, 0xE8, 0x89, 0x3F, 0x64, 0x77, 0x4E, 0xF9, 0xA7, 0x7E,
-    0x9C, 0xA9, 0xE6, 0xAF, 0x86, 0x3C, 0x00, 0xAB, 0x0E, 0x85, 0x9B, 0xFA, 0x2D, 0x08, 0x17, 0x63,
-    0x4D, 0xF1, 0x72, 0x55, 0x60, 0x83, 0x89, 0x4B, 0xE3, 0x25, 0x6C, 0x00, 0x15, 0x02, 0x36, 0xA0,
-    0x03, 0x15, 0x6A, 0x05, 0x0B, 0x12, 0xB0, 0xA8, 0x21, 0x20, 0xCE, 0x98, 0xAF, 0x9F, 0xCA, 0x45,
-    0xE9, 0xF9, 0x39, 0xEE, 0x9B, 0x60, 0x5F, 0x9F, 0x85, 0x96, 0xF1, 0xE1, 0x24, 0xF5, 0x70, 0x22,
-    0x9C, 0x21, 0x6D, 0x44, 0x86, 0x16, 0x0B, 0xA2, 0xF8, 0xD1, 0x3E, 0xF7, 0x4F, 0xD0, 0xC7, 0xEF,
-    0x60, 0x65, 0x3A, 0x08, 0xC2, 0x1C, 0x24, 0x99, 0x33, 0x17, 0x09, 0x7B, 0xDB, 0x19, 0x09, 0x6E,
-    0x20, 0xC1, 0xB5, 0x24, 0x78, 0xC1, 0x69, 0x51, 0x9E, 0x61, 0xBC, 0x16, 0x1F, 0x2F, 0x96, 0xF6,
-    0x0E, 0xC8, 0xA5, 0x71, 0x87, 0x67, 0x87, 0x7A, 0x6D, 0x1A, 0x5C, 0x2D, 0xAD, 0xF7, 0x6B, 0x4C,
-    0xF3, 0xCD, 0x18, 0x4A, 0xF7, 0x3C, 0x66, 0x04, 0x4C, 0x90, 0x3B, 0xB4, 0xDD, 0x01, 0x13, 0x07,
-    0x54, 0xEE, 0xCC, 0xC2, 0xE9, 0x69, 0x4E, 0x31, 0xCD, 0xD3, 0xF8, 0x57, 0x70, 0xD7, 0x69, 0xC2,
-    0x11, 0xA1, 0x72, 0x2D, 0x31, 0xE4, 0x89, 0xD7, 0x6F, 0x61, 0xDC, 0x37, 0x52, 0xA0, 0x90, 0x5F,
-    0x13, 0xCF, 0x13, 0x0A, 0xF8, 0xC2, 0x8C, 0x0C, 0x4E, 0x09, 0x4E, 0x14, 0xCB, 0x16, 0x52, 0xD6,
-    0x04, 0x56, 0x4E, 0xB4, 0x4D, 0xA2, 0x21, 0x79, 0x21, 0xA3, 0x1D, 0xC2, 0x1E, 0xDE, 0xC4, 0xC4,
-    0xAD, 0xFA, 0x81, 0x11, 0x8D, 0x2C, 0x3C, 0x5E, 0xD1, 0xEB, 0xC1, 0x0D, 0xC6, 0x87, 0xB9, 0xB4,
-    0xF5, 0xF5, 0x78, 0x64, 0xAB, 0xC2, 0x19, 0x5A, 0xE7, 0x06, 0xF5, 0x31, 0x3D, 0xD5, 0x46, 0xBC,
-    0x4F, 0xED, 0xEF, 0x40, 0x24, 0x09, 0xA7, 0xE6, 0xE2, 0xC3, 0x3D, 0x07, 0x78, 0x31, 0xFC, 0xA0,
-    0x86, 0xF7, 0x6F, 0xE3, 0x01, 0x6B, 0x4B, 0x1C, 0xD2, 0x40, 0xDB, 0x26, 0x79, 0xD2, 0x04, 0x03,
-    0xDE, 0x38, 0xD8, 0x24, 0x99, 0x2F, 0x34, 0x8A, 0x26, 0xD8, 0xD1, 0x0F, 0x8A, 0xC9, 0x05, 0xAF,
-    0xB0, 0x6F, 0xC5, 0x51, 0xE5, 0xE5, 0x0E, 0x34, 0x5D, 0x2E, 0xC4, 0x02, 0xA3, 0x31, 0x86, 0x33,
-    0x30, 0xEE, 0xCF, 0x9C, 0x76, 0x08, 0x25, 0xCE, 0x8C, 0xBC, 0x96, 0xB4, 0x89, 0x96, 0xC2, 0xAD,
-    0x7B, 0x44, 0x1B, 0xEC, 0x1C, 0x0E, 0x39, 0x11, 0x92, 0x0F, 0xAB, 0x1D, 0x4A, 0x49, 0x47, 0xE9,
-    0x92, 0x80, 0x85, 0x70, 0x6C, 0x30, 0x25, 0xC4, 0xCD, 0x56, 0x27, 0x25, 0xA3, 0x53, 0x8B, 0x49,
-    0xA2, 0x66, 0x6A, 0x09, 0x7D, 0x5B, 0x2E, 0x69, 0x4B, 0x81, 0x20, 0x53, 0x02, 0xE0, 0x09, 0x69,
-    0x31, 0x71, 0xE9, 0x13, 0xD2, 0xD1, 0x8A, 0x20, 0x96, 0xEA, 0x51, 0xEA, 0xC3, 0x47, 0xA9, 0x1B,
-    0xA3, 0x6A, 0x74, 0x3E, 0xA3, 0x45, 0x51, 0x44, 0x23, 0x01, 0x60, 0xA5, 0x9E, 0x91, 0xF8, 0xFA,
-    0x58, 0x53, 0xA2, 0xBE, 0xB9, 0x9A, 0x71, 0xB3, 0xE9, 0x64, 0x4A, 0x25, 0x8F, 0x5D, 0x1D, 0x1E,
-    0x91, 0x76, 0xA3, 0x6B, 0x11, 0x24, 0xC3, 0x31, 0x66, 0x24, 0x37, 0x80, 0xE3, 0x58, 0x41, 0xA0,
-    0x9C, 0x7E, 0xBA, 0x51, 0x39, 0x8D, 0x1F, 0xF7, 0x80, 0xA5, 0x85, 0x7F, 0xB1, 0x61, 0x56, 0x86,
-    0x73, 0x9D, 0x4D, 0xA9, 0x66, 0x4E, 0x81, 0x48, 0xDE, 0x1B, 0x85, 0x53, 0xD2, 0x12, 0xD6, 0x64,
-    0xD5, 0x2D, 0x35, 0x0B, 0xF2, 0x50, 0xCD, 0x9D, 0xC6, 0x03, 0x9B, 0x26, 0xAF, 0xFF, 0x86, 0x61,
-    0x49, 0x62, 0xA6, 0x43, 0x02, 0xA9, 0x65, 0x08, 0x2E, 0x4B, 0x49, 0x4E, 0x85, 0xEB, 0xB5, 0x89,
-    0xE6, 0xAC, 0x7E, 0x67, 0xCC, 0x7E, 0xDA, 0x3F, 0x5A, 0x01, 0x19, 0xB1, 0xD5, 0x39, 0x70, 0x87,
-    0x3A, 0xE7, 0x6A, 0x19, 0xFE, 0x3D, 0xB4, 0xE0, 0x16, 0x11, 0x21, 0x93, 0x1E, 0x37, 0xF9, 0x71,
-    0x49, 0x45, 0x64, 0x0B, 0x97, 0x9F, 0xCA, 0xD3, 0xA6, 0x49, 0x73, 0x7F, 0x8A, 0x37, 0xFC, 0x27,
-    0x0B, 0x92, 0xB0, 0x52, 0x7F, 0xD2, 0x3A, 0x37, 0xEB, 0x08, 0x2C, 0x51, 0x81, 0x64, 0x7D, 0xBC,
-    0x04, 0x31, 0x9F, 0x44, 0xC3, 0x5F, 0xBC, 0xD8, 0x78, 0x6F, 0x06, 0xD0, 0xF0, 0x09, 0x34, 0xFC,
-    0xC5, 0xBE, 0x80, 0x86, 0x7F, 0x83, 0x8F, 0x3E, 0x32, 0x92, 0x54, 0x98, 0xD9, 0x8F, 0x0D, 0xB4,
-    0x0D, 0x96, 0x49, 0x66, 0x1B, 0xF8, 0xAE, 0x86, 0xD5, 0x8C, 0xAC, 0x53, 0x18, 0xCE, 0xAA, 0x41,
-    0x32, 0x62, 0x0C, 0x19, 0x32, 0x92, 0x61, 0x80, 0x0E, 0xA2, 0x77, 0x89, 0x02, 0xA1, 0x80, 0xED,
-    0x1F, 0x47, 0xE3, 0xC3, 0xA6, 0xF0, 0xAB, 0xBD, 0xD7, 0xB1, 0xB2, 0x5E, 0xFC, 0x08, 0x53, 0x3E,
-    0x64, 0xAD, 0x98, 0x0A, 0xD0, 0xF4, 0x42, 0xC2, 0xA7, 0x84, 0xCF, 0x9E, 0xCA, 0xDD, 0x52, 0xF0,
-    0xF9, 0x8C, 0x0F, 0x85, 0xFC, 0xBB, 0xCC, 0xBD, 0xB4, 0x12, 0x5E, 0x0E, 0x52, 0x0E, 0xB7, 0xEB,
-    0x9F, 0xE6, 0xDD, 0x4E, 0x3C, 0x23, 0x60, 0x40, 0x00, 0x1F, 0xB7, 0xB5, 0xAF, 0x5A, 0xE1, 0xD1,
-    0x5B, 0xF9, 0xFF, 0xBC, 0x76, 0xBD, 0xDB, 0x99, 0x4F, 0xC3, 0x59, 0x30, 0xB8, 0xC3, 0x4B, 0x43,
-    0x9C, 0xA5, 0x11, 0xE0, 0x0E, 0x74, 0xE4, 0x01, 0xF5, 0x59, 0x8E, 0x7D, 0xAF, 0x1E, 0xFB, 0xAD,
-    0xD5, 0xB1, 0x73, 0x8E, 0xED, 0x1F, 0x96, 0xB1, 0x9D, 0x7C, 0xC5, 0x6D, 0x74, 0xF5, 0x3F, 0x76,
-    0x74, 0xF9, 0x82, 0x48, 0x9E, 0x57, 0xEC, 0x2E, 0x42, 0x83, 0xEF, 0x3C, 0x54, 0xFF, 0x6B, 0x7D,
-    0x23, 0x65, 0xCA, 0x9E, 0x11, 0xAF, 0xC7, 0xC8, 0xEA, 0xC1, 0xBA, 0xF6, 0x91, 0xFA, 0xB3, 0xCC,
-    0x2B, 0xF1, 0xE5, 0x19, 0x05, 0x9A, 0xBB, 0x01, 0x6D, 0xD3, 0xD8, 0xCC, 0xDF, 0x30, 0x36, 0x43,
-    0xD6, 0x5C, 0xD4, 0x41, 0xB0, 0x28, 0x28, 0x90, 0xC2, 0x81, 0x76, 0x4D, 0x02, 0xC9, 0x64, 0x66,
-    0x1D, 0xD2, 0xDF, 0x22, 0x07, 0xD8, 0xB5, 0x75, 0x6D, 0x9B, 0xAC, 0xC2, 0x38, 0x9C, 0x8A, 0x7E,
-    0x35, 0x40, 0xCF, 0x52, 0xC1, 0x17, 0x2E, 0xF4, 0x6F, 0x28, 0xF1, 0x7C, 0xCA, 0x50, 0xE4, 0x54,
-    0xA7, 0x31, 0x46, 0xF0, 0xFC, 0x13, 0x65, 0x90, 0x27, 0xAD, 0xCF, 0x12, 0xC5, 0xDC, 0x1F, 0x62,
-    0xEC, 0x3F, 0x86, 0xB2, 0x16, 0x4C, 0xCA, 0xD8, 0xDA, 0xDA, 0x86, 0x06, 0x7F, 0xE4, 0x04, 0x0A,
-    0xD1, 0xCE, 0xD3, 0x29, 0x1C, 0xDC, 0xC2, 0xFF, 0xBB, 0x24, 0x07, 0x1D, 0x8F, 0x41, 0x15, 0x41,
-    0x9B, 0xD7, 0x8C, 0x92, 0x61, 0x0F, 0x38, 0x6B, 0x48, 0x1D, 0x24, 0xAF, 0x5C, 0xE2, 0x99, 0xA4,
-    0x11, 0x7F, 0xA8, 0x73, 0x1B, 0x37, 0x75, 0xAB, 0x7B, 0x4C, 0x1A, 0x81, 0x90, 0xEE, 0xC1, 0xB3,
-    0x8C, 0x39, 0x15, 0xD6, 0x7A, 0x62, 0xEA, 0xC4, 0xCA, 0x1F, 0xB2, 0xEA, 0xCC, 0x6E, 0xC2, 0x22,
-    0xCC, 0x93, 0x81, 0x69, 0xC5, 0x78, 0x05, 0xBB, 0x1C, 0x6A, 0xD4, 0xFE, 0x01, 0xF3, 0x65, 0x94,
-    0xF5, 0x60, 0xA3, 0x86, 0x27, 0x00, 0xAC, 0x61, 0x33, 0xE1, 0x21, 0xD1, 0x82, 0x89, 0x9B, 0x0A,
-    0x1A, 0xC2, 0x0E, 0xCC, 0x9C, 0x9B, 0x50, 0xF9, 0x33, 0xCE, 0x44, 0xB5, 0xDE, 0x95, 0x39, 0x33,
-    0x31, 0x39, 0xB4, 0x5E, 0xC3, 0xAB, 0x53, 0x05, 0x29, 0xA3, 0xBD, 0x41, 0x4C, 0xA6, 0x87, 0xF9,
-    0x87, 0xBA, 0x88, 0xC4, 0xAE, 0x4D, 0xB4, 0x65, 0x5B, 0xF1, 0xE5, 0xF6, 0x0F, 0x84, 0x6D, 0x03,
-    0x51, 0x7D, 0xC3, 0x8A, 0xA2, 0x58, 0x28, 0x4E, 0x0D, 0x24, 0x95, 0x17, 0x51, 0xBA, 0x45, 0x6D,
-    0x05, 0x60, 0x41, 0xEB, 0x32, 0x61, 0x88, 0x33, 0xAF, 0x19, 0xCF, 0xB4, 0x54, 0x62, 0x5F, 0x7B,
-    0xEF, 0x5C, 0x1E, 0xCD, 0x92, 0xDA, 0x19, 0x1E, 0xC7, 0x8C, 0xF3, 0x7D, 0x52, 0xC7, 0x63, 0xE9,
-    0x42, 0x9E, 0x40, 0xC7, 0xC6, 0x5C, 0xF3, 0x57, 0xCA, 0xEE, 0x42, 0x4E, 0xDD, 0x21, 0xE6, 0xE3,
-    0x5A, 0xAF, 0x98, 0xA8, 0x2D, 0x66, 0x4D, 0x1B, 0xAB, 0x0D, 0x55, 0xE6, 0x54, 0xB0, 0x23, 0x59,
-    0xC9, 0x19, 0x42, 0xF1, 0x78, 0x12, 0x85, 0xB1, 0x5D, 0xB0, 0x6C, 0xF4, 0xAB, 0xDE, 0x96, 0x9C,
-    0x7E, 0x2A, 0x86, 0x67, 0x0D, 0xB3, 0x67, 0xFC, 0x3E, 0x39, 0x8D, 0x3F, 0xB0, 0x50, 0x0F, 0xA8,
-    0xDD, 0x45, 0x34, 0xCC, 0xBE, 0xB0, 0xB0, 0x08, 0xCF, 0x27, 0xDE, 0xE6, 0x00, 0x00, 0xDC, 0xA0,
-    0x03, 0xA8, 0x00, 0xB7, 0x16, 0x43, 0x10, 0x72, 0x8B, 0x72, 0x9B, 0x09, 0xE4, 0xB7, 0x29, 0x1E,
-    0x31, 0x46, 0x51, 0x44, 0xDD, 0xC2, 0x7C, 0xDC, 0xD9, 0x83, 0xBA, 0x6E, 0xD0, 0x97, 0xA0, 0x97,
-    0x0E, 0x45, 0xDC, 0x9B, 0x01, 0x75, 0x33, 0x37, 0xD0, 0x19, 0x7F, 0x81, 0xFA, 0xB2, 0xDE, 0x5F,
-    0xDA, 0x55, 0xD2, 0x3A, 0xD7, 0x60, 0x48, 0xDF, 0x29, 0x3B, 0xF7, 0x6A, 0x3C, 0xA3, 0xF5, 0x86,
-    0x0B, 0x3A, 0xA7, 0x01, 0x67, 0x7A, 0x86, 0x85, 0x64, 0xF4, 0x6B, 0xE8, 0x39, 0x44, 0xD8, 0x25,
-    0xB8, 0x17, 0x35, 0x0B, 0xA2, 0x5A, 0xB1, 0x2B, 0x9E, 0x8E, 0x5D, 0x8A, 0xDF, 0x05, 0xA7, 0xEE,
-    0x28, 0xA0, 0xCF, 0xBB, 0x2C, 0xFF, 0x4B, 0xA1, 0xA2, 0x44, 0x05, 0xA4, 0x4C, 0x74, 0x11, 0x08,
-    0xD0, 0x1E, 0x4B, 0x4E, 0x08, 0xC0, 0x6B, 0x75, 0xC9, 0x21, 0x1D, 0xDC, 0xC6, 0xBD, 0xBC, 0x91,
-    0xFF, 0xC4, 0xC4, 0x8E, 0x78, 0xE7, 0x20, 0x6A, 0x0C, 0x78, 0x3C, 0x2C, 0xC6, 0x0F, 0x47, 0xCA,
-    0x7E, 0xBC, 0x56, 0x17, 0xA2, 0x57, 0x33, 0x4B, 0x12, 0xF2, 0xE5, 0x42, 0xF2, 0xC0, 0xC3, 0xE1,
-    0x50, 0xFA, 0x7F, 0x47, 0x19, 0xA5, 0xD9, 0x80, 0x7E, 0xB5, 0x25, 0xBE, 0x51, 0x83, 0xC9, 0xE2,
-    0xE9, 0xFA, 0x71, 0x6F, 0x91, 0xBE, 0xFC, 0x06, 0xC8, 0x75, 0xA6, 0xDF, 0xA8, 0xF6, 0xF8, 0x28,
-    0x36, 0x73, 0x8A, 0x8D, 0xFB, 0xF6, 0x14, 0xD2, 0xAD, 0x74, 0x09, 0x11, 0x4B, 0xB7, 0xB0, 0x13,
-    0xBE, 0xCE, 0xEB, 0xD2, 0xD3, 0x9A, 0xDF, 0xA7, 0x82, 0xE7, 0x73, 0xF7, 0xA5, 0xFE, 0x89, 0x32,
-    0x19, 0x64, 0xAF, 0x2D, 0xED, 0x5B, 0x80, 0x83, 0x0A, 0xA7, 0x35, 0x0A, 0x66, 0xD4, 0x7C, 0x51,
-    0x67, 0x9D, 0xCA, 0xC5, 0x5E, 0x8C, 0xA0, 0x67, 0xAA, 0xCB, 0x34, 0x02, 0x88, 0xD0, 0xC3, 0xD1,
-    0x53, 0x70, 0x38, 0xA2, 0xC6, 0xE9, 0x88, 0xA7, 0xAC, 0x78, 0xCD, 0x6E, 0xFD, 0x62, 0x70, 0x81,
-    0xB7, 0x5B, 0x6B, 0x35, 0x58, 0x71, 0x88, 0xD9, 0xFA, 0x98, 0x0F, 0x62, 0x9A, 0xA5, 0x19, 0xC3,
-    0xBE, 0x3A, 0x5F, 0x63, 0xA2, 0xB4, 0xCC, 0xDA, 0x9C, 0x86, 0x7F, 0x94, 0xD3, 0x85, 0xC1, 0xFF,
-    0x51, 0x31, 0x4A, 0xE5, 0x3E, 0x53, 0xD5, 0xC8, 0xB8, 0xB4, 0x14, 0x96, 0x76, 0x77, 0xC8, 0xF6,
-    0x1E, 0x32, 0x66, 0x83, 0x83, 0xE8, 0x5A, 0xCB, 0xC6, 0x38, 0xD4, 0xA1, 0x09, 0xAE, 0x2E, 0x5E,
-    0x9C, 0x99, 0xB8, 0xAA, 0xD4, 0x4D, 0x94, 0x06, 0xA8, 0xB5, 0x92, 0xCA, 0xD4, 0x4A, 0xC3, 0xBC,
-    0xB1, 0x0F, 0x9F, 0x70, 0xBF, 0xCF, 0x9C, 0x22, 0x03, 0x3D, 0xF8, 0xB3, 0x7F, 0x57, 0xFC, 0x27,
-    0x19, 0x16, 0xE9, 0x31, 0x7A, 0xD0, 0xC4, 0x19, 0xDA, 0x77, 0xB7, 0x6A, 0x31, 0x8E, 0x3B, 0xA2,
-    0xB9, 0xA3, 0x7D, 0xAC, 0xA7, 0x90, 0x22, 0x4F, 0x6E, 0x63, 0xAA, 0x36, 0x6D, 0xE6, 0x4D, 0x43,
-    0x09, 0xA5, 0xF8, 0x50, 0x0F, 0x34, 0x8F, 0xD0, 0xAE, 0x2F, 0x3D, 0x51, 0x3A, 0x10, 0x77, 0x28,
-    0x6B, 0x28, 0x19, 0x78, 0x08, 0xF0, 0x60, 0xC1, 0xBE, 0x00, 0xA6, 0xDC, 0xDB, 0x91, 0x43, 0xB0,
-    0x1F, 0x30, 0x0C, 0x09, 0xAD, 0x0B, 0xD6, 0x89, 0x31, 0xB1, 0x1E, 0x29, 0xEF, 0x06, 0x3B, 0xDA,
-    0x15, 0xC7, 0xE5, 0xF3, 0x94, 0x73, 0xF3, 0xEC, 0xD0, 0x4B, 0x5A, 0xB0, 0xF5, 0xDE, 0x3E, 0x59,
-    0xFA, 0x05, 0x3F, 0x30, 0x83, 0xC6, 0xCE, 0xDD, 0xA2, 0x81, 0x6A, 0xDE, 0x61, 0xEA, 0x9A, 0x3E,
-    0xCF, 0xD4, 0xAE, 0x89, 0x89, 0xE1, 0x2D, 0x68, 0x19, 0x13, 0xE1, 0x3E, 0xC8, 0x55, 0x49, 0xA9,
-    0x51, 0x6C, 0xA0, 0x2B, 0x89, 0x75, 0xF6, 0x66, 0xAF, 0x73, 0x72, 0x63, 0xCC, 0x4F, 0x62, 0xE4,
-    0x56, 0x6D, 0x5F, 0x56, 0x21, 0x60, 0xA7, 0x53, 0x61, 0xC4, 0x49, 0xE4, 0x96, 0xC0, 0xCF, 0x53,
-    0x35, 0x83, 0x37, 0xE4, 0x73, 0x81, 0x43, 0xEC, 0xE7, 0x01, 0x60, 0x80, 0xD5, 0x4A, 0x1E, 0xD8,
-    0x61, 0x91, 0xE8, 0xE4, 0x1E, 0x68, 0xB6, 0xD7, 0x7E, 0x5E, 0xAA, 0xAC, 0x9D, 0x41, 0xBC, 0x7D,
-    0x49, 0x29, 0x9A, 0x02, 0xC4, 0x3F, 0x33, 0xA3, 0x31, 0xFD, 0xC4, 0x54, 0xA1, 0x6C, 0x3B, 0xD3,
-    0xC7, 0xBB, 0xCB, 0xD8, 0xAC, 0x2C, 0xF5, 0xAE, 0x41, 0x54, 0xBA, 0x83, 0xC0, 0x27, 0x30, 0x0E,
-    0x45, 0x4C, 0x80, 0xEF, 0xBD, 0x0C, 0xFE, 0xFA, 0x25, 0x3E, 0xF1, 0x01, 0x43, 0x8B, 0x8C, 0x48,
-    0x5C, 0x85, 0xEE, 0x78, 0x9D, 0xB5, 0x6D, 0x3B, 0xA0, 0x54, 0x90, 0x1E, 0x98, 0x39, 0xF5, 0x63,
-    0xA1, 0x4A, 0x40, 0x0A, 0xBF, 0x77, 0x18, 0xB7, 0xD1, 0xCC, 0x15, 0x8F, 0xD1, 0x7D, 0x01, 0x9C,
-    0x92, 0x09, 0xEB, 0x17, 0xF9, 0x9C, 0x9D, 0x95, 0x48, 0xD5, 0x67, 0xEB, 0xB4, 0x9A, 0x4A, 0x00,
-    0xF5, 0x0D, 0xF5, 0x98, 0x92, 0xEC, 0x99, 0x6A, 0x09, 0x62, 0xB3, 0xBF, 0x60, 0xE4, 0x8A, 0xCC,
-    0x66, 0x1D, 0x5F, 0x25, 0xC2, 0x17, 0x8D, 0xB9, 0x3F, 0xE5, 0x18, 0xC2, 0x7F, 0x69, 0x20, 0x70,
-    0x47, 0xF1, 0xD8, 0xAF, 0xF3, 0xD9, 0xE7, 0xA5, 0x88, 0xC7, 0x60, 0x5F, 0xB7, 0x5C, 0xD6, 0xBB,
-    0x4B, 0x7D, 0xAF, 0xE1, 0x0E, 0x99, 0x27, 0xA5, 0x97, 0x31, 0xF8, 0xC7, 0xF1, 0xA7, 0x0B, 0x8E,
-    0x02, 0xE4, 0x6C, 0x82, 0x0B, 0x5F, 0x2A, 0xC2, 0xF4, 0x11, 0x17, 0x9A, 0xE2, 0xF8, 0xA2, 0xE8,
-    0x97, 0x12, 0x2B, 0x79, 0x52, 0xC8, 0xDD, 0xDB, 0x27, 0x4D, 0x54, 0xBC, 0xD5, 0x11, 0xBC, 0x80,
-    0xAE, 0x7A, 0xC2, 0xA8, 0x5A, 0x23, 0x05, 0x6E, 0xB8, 0xBD, 0x57, 0xD9, 0x3A, 0x83, 0x40, 0x43,
-    0xC7, 0xD4, 0xEA, 0x2E, 0xFB, 0x06, 0x77, 0x14, 0x9A, 0x01, 0xFE, 0x68, 0xA9, 0xE0, 0x90, 0x42,
-    0xC1, 0x5B, 0xEF, 0x57, 0x8C, 0x8E, 0xBF, 0x49, 0x09, 0x0C, 0xA5, 0xFC, 0x72, 0x48, 0x27, 0xFB,
-    0xA8, 0xAC, 0x30, 0xD7, 0x80, 0x55, 0x57, 0x69, 0x06, 0x01, 0x48, 0x04, 0x37, 0xB6, 0x64, 0x13,
-    0x1B, 0x1F, 0xA0, 0xD4, 0x53, 0xA7, 0x4E, 0xF0, 0x01, 0x0A, 0x3D, 0xCD, 0x7C, 0xDC, 0x88, 0xCC,
-    0xEF, 0x8E, 0xF5, 0xDE, 0x35, 0x05, 0x9F, 0xC8, 0x76, 0xAD, 0xA4, 0xE0, 0xDD, 0x6A, 0xBE, 0x4C,
-    0xC1, 0x07, 0x57, 0xB6, 0xB7, 0xCF, 0xB6, 0x54, 0x03, 0xC3, 0xF5, 0x6E, 0x7D, 0x7D, 0x3D, 0x79,
-    0x5E, 0xC2, 0xF6, 0xCC, 0x2E, 0xE9, 0x14, 0x7C, 0xA8, 0x53, 0xF0, 0xEE, 0x1D, 0x52, 0xF0, 0xEE,
-    0x1D, 0x53, 0xF0, 0x1A, 0xAE, 0x14, 0x12, 0x6A, 0xC5, 0xA8, 0x26, 0x2A, 0x47, 0x86, 0x8A, 0xA0,
-    0x76, 0xA2, 0x68, 0x7B, 0x3B, 0xC3, 0x70, 0xFD, 0x74, 0x7D, 0x7D, 0x06, 0xE6, 0x6B, 0x29, 0x75,
-    0xB4, 0xB1, 0x2C, 0x10, 0x8C, 0xD2, 0x24, 0x66, 0x00, 0xD0, 0x5D, 0x94, 0x23, 0xF1, 0xA1, 0x92,
-    0x80, 0x68, 0x59, 0xCB, 0x13, 0x74, 0x2C, 0x45, 0x8D, 0x5A, 0xC6, 0x5C, 0xFA, 0xAF, 0xEA, 0xA2,
-    0x6C, 0xBB, 0x35, 0x69, 0x79, 0xB7, 0x18, 0x4B, 0x43, 0x5A, 0xC1, 0x87, 0x9D, 0x09, 0x3F, 0x6F,
-    0x49, 0xB4, 0x5A, 0x57, 0xDA, 0x4B, 0xF0, 0x57, 0xFC, 0xAE, 0x48, 0x18, 0x27, 0x12, 0x95, 0x1C,
-    0xD1, 0x49, 0x81, 0x2B, 0x27, 0x1E, 0xA0, 0xA4, 0xF3, 0x02, 0xC9, 0x1F, 0xF8, 0xF5, 0x32, 0xD3,
-    0xE9, 0xEF, 0x29, 0x21, 0x62, 0x7C, 0xA0, 0x83, 0x92, 0x75, 0xFB, 0x7F, 0x2E, 0xE5, 0x66, 0xAD,
-    0xCE, 0xA2, 0xCC, 0x38, 0x7A, 0x6D, 0xA2, 0xCA, 0x3B, 0x94, 0xA4, 0x1D, 0x96, 0xDE, 0xEC, 0x30,
-    0xE6, 0xB7, 0x49, 0xA0, 0xBE, 0x29, 0x59, 0x92, 0x72, 0x2C, 0x71, 0x4D, 0x16, 0xA9, 0xF6, 0xC3,
-    0x77, 0x2A, 0x4F, 0xFA, 0x83, 0xAF, 0x6D, 0x32, 0x51, 0xFE, 0xC4, 0x48, 0xAE, 0xD6, 0xE0, 0x81,
-    0x76, 0x65, 0x74, 0x8F, 0xC0, 0xE8, 0xC5, 0x38, 0x66, 0x9D, 0xE9, 0xE7, 0x1B, 0x41, 0xFC, 0x57,
-    0x54, 0xC6, 0x47, 0xA8, 0x8C, 0x2B, 0x2A, 0xE3, 0x1C, 0xCA, 0xB8, 0x83, 0x32, 0x5E, 0x93, 0xB4,
-    0x51, 0x6A, 0xBC, 0x2F, 0x99, 0xDB, 0x43, 0x1C, 0xEB, 0x87, 0x1F, 0x96, 0x74, 0x62, 0x94, 0xCC,
-    0xE2, 0xE5, 0xB3, 0x49, 0x3A, 0x1D, 0x14, 0x84, 0x48, 0x6C, 0x2C, 0x6A, 0x46, 0x7B, 0x4B, 0x5B,
-    0xD2, 0x0F, 0x14, 0xB1, 0x80, 0x30, 0x96, 0x90, 0xC7, 0xF8, 0xFA, 0xD3, 0x2F, 0xC0, 0x3F, 0x4B,
-    0x87, 0xEF, 0x77, 0x3E, 0xFC, 0xA1, 0x5A, 0xB6, 0xF2, 0x5A, 0xAD, 0x26, 0xD8, 0xD8, 0x8B, 0xF0,
-    0x65, 0x7C, 0xF2, 0x4F, 0xBF, 0xA2, 0x64, 0x3E, 0x52, 0xED, 0x4A, 0x0C, 0x3A, 0xBE, 0x5A, 0x80,
-    0x81, 0x2E, 0x5E, 0xA7, 0x34, 0x0E, 0xAC, 0x5D, 0x19, 0x58, 0xBB, 0xD2, 0x93, 0x20, 0xE7, 0x84,
-    0xA9, 0xC8, 0x23, 0xE0, 0xE9, 0x29, 0x77, 0xF0, 0x23, 0xD4, 0xAE, 0xDC, 0x31, 0xFA, 0xF6, 0x7F,
-    0xEF, 0x1A, 0x7D, 0x23, 0x8E, 0x70, 0x8E, 0x61, 0x39, 0x2C, 0x9C, 0x9E, 0x38, 0xAF, 0x14, 0x6A,
-    0x8B, 0x61, 0x9F, 0xEC, 0x3F, 0x0E, 0x8B, 0xE8, 0x5B, 0xCB, 0xE8, 0xDB, 0x11, 0xC9, 0xE2, 0x72,
-    0xF2, 0xF7, 0xFC, 0xF6, 0xE8, 0x9B, 0xFE, 0xF9, 0xDA, 0x92, 0x0B, 0x37, 0x75, 0xE1, 0xBA, 0xAE,
-    0xB9, 0x88, 0xA4, 0x8C, 0x63, 0xE3, 0xCA, 0xF6, 0x0F, 0x57, 0xD3, 0xF1, 0x3A, 0xBB, 0x2B, 0x7C,
-    0xED, 0xED, 0xC9, 0xDF, 0xEB, 0xBA, 0x61, 0x61, 0x72, 0x49, 0xD8, 0x6A, 0x73, 0xBA, 0xF2, 0x01,
-    0x6D, 0xCA, 0xE6, 0x4B, 0xB5, 0xB3, 0xFC, 0x80, 0x90, 0xC6, 0x1B, 0xCB, 0x89, 0xF6, 0x8D, 0x78,
-    0x94, 0x6F, 0xD3, 0x4C, 0x63, 0xE2, 0x6C, 0xF2, 0x2B, 0xAD, 0x53, 0x3F, 0xD3, 0x71, 0x2C, 0xDF,
-    0x60, 0x23, 0xFE, 0xA1, 0x52, 0x0C, 0xCC, 0xDD, 0x91, 0xF9, 0xE4, 0x11, 0x0D, 0x5E, 0xFE, 0x5D,
-    0xAB, 0x4B, 0x39, 0x59, 0x82, 0xBE, 0xEF, 0x77, 0xAD, 0x87, 0xFE, 0x4E, 0x27, 0x91, 0x04, 0x90,
-    0xFA, 0xDE, 0xEC, 0xCA, 0x0F, 0x7F, 0xD7, 0x7A, 0xE8, 0x3B, 0xA5, 0x8D, 0x62, 0x88, 0xC4, 0x53,
-    0x15, 0x39, 0x9B, 0x6C, 0x87, 0x39, 0xF5, 0x7E, 0x1C, 0xDC, 0x35, 0x6D, 0xF4, 0x71, 0xCB, 0xD8,
-    0x2B, 0x82, 0xD9, 0x8E, 0x11, 0xBA, 0x44, 0xCA, 0xC8, 0x2F, 0x07, 0x92, 0x2B, 0xCF, 0x88, 0x50,
-    0xFC, 0xD2, 0x92, 0xDA, 0x42, 0x29, 0xDE, 0x08, 0x99, 0xB5, 0x64, 0x0B, 0x90, 0x6E, 0x20, 0xE4,
-    0xDC, 0x5B, 0x16, 0xC4, 0x25, 0xEC, 0xA3, 0xD0, 0x0F, 0x5C, 0xF4, 0xEB, 0xB1, 0xDF, 0xF3, 0x7C,
-    0x50, 0x19, 0x4D, 0xE0, 0x89, 0xB2, 0x7E, 0x3A, 0x96, 0xAC, 0x77, 0xCD, 0x16, 0xC5, 0xFD, 0xDD,
-    0x09, 0x06, 0x57, 0x4A, 0xBB, 0xB6, 0x72, 0x93, 0x37, 0x15, 0xFE, 0x73, 0xDF, 0x91, 0xDA, 0x87,
-    0xCA, 0xEF, 0x37, 0x60, 0xAC, 0x61, 0xB0, 0x53, 0x28, 0xDA, 0x54, 0xDC, 0xD2, 0x0E, 0x9B, 0xD6,
-    0x4D, 0x34, 0x37, 0xB4, 0x5A, 0xA7, 0x48, 0x6A, 0xB6, 0xB0, 0x73, 0xA0, 0x66, 0x40, 0x6F, 0x89,
-    0x6B, 0x6E, 0xC7, 0x7F, 0x58, 0x05, 0xD1, 0xFD, 0x58, 0x10, 0x3D, 0xA4, 0xC6, 0xD5, 0x8B, 0x46,
-    0x13, 0x10, 0xA9, 0xBD, 0x7F, 0x59, 0x74, 0xB0, 0x8E, 0xA5, 0x14, 0xEC, 0x75, 0xD1, 0x3F, 0x0F,
-    0x7F, 0x2E, 0x09, 0x3A, 0x27, 0x96, 0x04, 0x9D, 0xB3, 0x3B, 0x41, 0xD7, 0xE8, 0x04, 0xDD, 0x7F,
-    0xD6, 0x09, 0x3A, 0x4F, 0xCF, 0xDF, 0x36, 0xFA, 0x4D, 0x47, 0xEC, 0xD4, 0x64, 0xD7, 0x52, 0xA2,
-    0xDD, 0xB1, 0x92, 0xCF, 0xBE, 0xF8, 0xFB, 0x2B, 0xDC, 0xB9, 0x0B, 0x7A, 0x1E, 0xFB, 0xA0, 0xA0,
-    0x99, 0xF0, 0xB1, 0xB8, 0xAF, 0x0F, 0xC6, 0x9F, 0x3C, 0xA1, 0x78, 0x4A, 0x07, 0x9B, 0x20, 0x7B,
-    0x7F, 0x5B, 0x0A, 0xB6, 0x1A, 0xE2, 0xCF, 0xA7, 0x45, 0xAC, 0x5A, 0x2D, 0x6B, 0xCE, 0x3F, 0xA4,
-    0xAC, 0xB9, 0x96, 0xB2, 0x66, 0xCD, 0xD4, 0x41, 0xB1, 0x54, 0xE2, 0xBA, 0x46, 0xD7, 0xF0, 0x56,
-    0xB8, 0x52, 0x98, 0x63, 0xA5, 0x1F, 0x2B, 0x8F, 0xB8, 0x63, 0xF2, 0x88, 0x97, 0x74, 0x1E, 0xF1,
-    0xB5, 0xDA, 0x2F, 0x9A, 0x1D, 0xBB, 0x6F, 0x23, 0xEC, 0x19, 0x0C, 0xF0, 0x07, 0x98, 0xDF, 0x81,
-    0xCA, 0xF0, 0x6E, 0x60, 0xF2, 0x10, 0x5E, 0xB9, 0x3B, 0x8C, 0x6B, 0xC5, 0x44, 0x75, 0x76, 0x2F,
-    0x91, 0x33, 0xAC, 0x78, 0x03, 0x1B, 0xDE, 0x4B, 0xE7, 0x78, 0x11, 0xEB, 0xCA, 0x26, 0x4E, 0x9A,
-    0x53, 0x9D, 0x1E, 0x26, 0xAA, 0xF5, 0x5E, 0x3F, 0x23, 0x78, 0xFE, 0x19, 0x72, 0x99, 0xFF, 0xCA,
-    0x53, 0xE2, 0xB6, 0x0A, 0x64, 0x0C, 0x44, 0xDF, 0xDA, 0xF5, 0x2F, 0x05, 0x0D, 0x3F, 0xC4, 0xF0,
-    0xBC, 0x73, 0x4D, 0x7A, 0x8C, 0x92, 0x6F, 0x71, 0x54, 0xF7, 0xAD, 0x54, 0xE3, 0x67, 0x5B, 0x97,
-    0x55, 0x99, 0x04, 0xFE, 0x20, 0x86, 0xC8, 0x69, 0xC4, 0x12, 0x85, 0xA5, 0x68, 0x6D, 0xB3, 0x9B,
-    0xF1, 0xE8, 0xF8, 0xA8, 0xE0, 0x65, 0x16, 0x82, 0xFE, 0xCB, 0xA9, 0x0A, 0x41, 0x0F, 0xAB, 0x3E,
-    0xE0, 0xFE, 0x0D, 0xE6, 0x12, 0x3E, 0x86, 0xC9, 0xDD, 0xF8, 0x39, 0xD4, 0xF6, 0xBB, 0x3B, 0x66,
-    0xBB, 0x76, 0x3E, 0x28, 0x94, 0xF3, 0xDE, 0xF7, 0xF0, 0xF0, 0xFF, 0x04, 0xFD, 0x36, 0x3D, 0x10,
-    0xA9, 0xD3, 0xB5, 0x9A, 0x79, 0x26, 0x0F, 0x07, 0xA3, 0xDD, 0xE8, 0x58, 0x8E, 0xF5, 0x51, 0x59,
-    0x05, 0x7E, 0xC8, 0x96, 0xD8, 0x93, 0xCF, 0xB9, 0x02, 0xFE, 0xA0, 0xC9, 0x2C, 0xC9, 0x83, 0x77,
-    0x8C, 0x34, 0x93, 0xFE, 0x74, 0x4A, 0xB2, 0xE1, 0x28, 0xBC, 0x97, 0x8B, 0x43, 0x3C, 0x61, 0x70,
-    0xFB, 0x28, 0xC8, 0x71, 0xB1, 0x52, 0xF6, 0x35, 0xA6, 0xF1, 0x98, 0x22, 0x66, 0xAE, 0x18, 0x9A,
-    0xD0, 0xBB, 0x55, 0xE8, 0xC4, 0x4E, 0x8B, 0xF9, 0x4E, 0xDD, 0x72, 0x5F, 0x18, 0x77, 0xF7, 0x7B,
-    0x79, 0x70, 0xF5, 0xF1, 0x4A, 0x12, 0x92, 0xD1, 0x4A, 0xA6, 0x63, 0xCD, 0x92, 0xE6, 0xA9, 0x96,
-    0xE5, 0x60, 0x0E, 0x5B, 0xE4, 0x49, 0x88, 0x09, 0x3D, 0x9E, 0xA3, 0x0E, 0xDC, 0x52, 0x30, 0xCC,
-    0x61, 0x05, 0xCA, 0x2B, 0x27, 0xD5, 0x42, 0x43, 0xC8, 0xCE, 0xD5, 0x1F, 0xD3, 0x89, 0xC6, 0xCD,
-    0x25, 0x29, 0x5C, 0x5D, 0x29, 0x35, 0xD7, 0xB5, 0xB5, 0x85, 0x6E, 0xFF, 0x15, 0xB6, 0x87, 0xB7,
-    0x9B, 0x0A, 0x40, 0x11, 0x44, 0x16, 0x4B, 0x5C, 0x4D, 0x13, 0x23, 0x92, 0x4D, 0x61, 0x51, 0x72,
-    0x25, 0xA6, 0x9B, 0x95, 0x3B, 0x0B, 0x6A, 0x58, 0x0B, 0x00, 0x1C, 0x07, 0xAF, 0x0F, 0xAD, 0x35,
-    0xFC, 0xF7, 0x63, 0x55, 0xD8, 0x35, 0xFE, 0xB3, 0xCD, 0x3F, 0xAB, 0x8E, 0x00, 0x5F, 0x3E, 0x5B,
-    0x11, 0xFA, 0xFE, 0x14, 0x8F, 0x99, 0x90, 0x4E, 0xB7, 0xC8, 0xB0, 0xB7, 0x18, 0xD1, 0x7F, 0x9E,
-    0xBE, 0x12, 0x74, 0x2D, 0x7D, 0xDC, 0xD4, 0x4F, 0xE7, 0x1E, 0xB8, 0x18, 0xEA, 0xA3, 0xB6, 0x58,
-    0x91, 0x61, 0xB7, 0xCB, 0xF6, 0xDD, 0x2F, 0x6F, 0x59, 0x7C, 0xA1, 0xCB, 0xE2, 0x75, 0xD7, 0xA5,
-    0x65, 0xA6, 0x3C, 0x55, 0x2B, 0x19, 0x19, 0x9D, 0x5B, 0x5C, 0x74, 0x08, 0xAA, 0x6A, 0x51, 0xDE,
-    0xF7, 0xC9, 0x33, 0xED, 0xAF, 0x32, 0xD3, 0xFE, 0x24, 0x44, 0xA7, 0x65, 0xB8, 0xAE, 0x84, 0x17,
-    0xF0, 0x0E, 0x36, 0x70, 0x5F, 0x38, 0xDA, 0x18, 0xB1, 0x37, 0xBA, 0x29, 0x73, 0xC5, 0x9F, 0xD5,
-    0x04, 0x1D, 0x29, 0xAA, 0x6B, 0x6E, 0xED, 0x5E, 0xA3, 0x26, 0xD0, 0x6B, 0xC7, 0x10, 0x75, 0x62,
-    0xA8, 0xEA, 0x1B, 0xB2, 0x3A, 0xA9, 0xD0, 0x75, 0x7C, 0xD2, 0x5C, 0x2D, 0x29, 0x3B, 0x92, 0x76,
-    0xA4, 0xED, 0x48, 0xDC, 0x91, 0xBA, 0x8B, 0x1B, 0x47, 0xFA, 0x2E, 0x8A, 0x06, 0x0D, 0x85, 0x47,
-    0x12, 0x8F, 0x34, 0x1E, 0x89, 0x3C, 0x36, 0x1F, 0xA8, 0x3D, 0xDD, 0x07, 0x1B, 0x2C, 0x7F, 0x7B,
-    0x8E, 0xFA, 0x70, 0xF8, 0x0F, 0xA0, 0xDB, 0xDB, 0xFF, 0x56, 0x08, 0xC7, 0x82, 0x8B, 0x96, 0x0D,
-    0xA9, 0x4E, 0x75, 0x44, 0x68, 0xA7, 0x84, 0x78, 0x9A, 0x7A, 0x42, 0x3E, 0x53, 0x37, 0x26, 0x04,
-    0x14, 0x0A, 0xA6, 0x16, 0x49, 0xA8, 0x44, 0xFD, 0x28, 0xA9, 0x03, 0x50, 0xA6, 0x10, 0x60, 0x09,
-    0x8A, 0xB9, 0x22, 0x67, 0xAC, 0x4C, 0x75, 0xFB, 0xED, 0xB3, 0x9D, 0x31, 0xD7, 0xA2, 0x46, 0x4C,
-    0x81, 0xF1, 0xB2, 0x41, 0xDC, 0xF4, 0x5E, 0x2A, 0x5D, 0x83, 0xAE, 0xD7, 0xA6, 0xE1, 0x3D, 0xD6,
-    0x34, 0x63, 0x81, 0x13, 0x55, 0xEB, 0xDF, 0x0E, 0xBA, 0xBF, 0x7C, 0xD0, 0xEE, 0x1F, 0x7C, 0x90,
-    0xFD, 0x03, 0xBD, 0x6A, 0xBB, 0x35, 0x15, 0x6E, 0x44, 0x9E, 0xB9, 0x7E, 0x96, 0xD5, 0x9A, 0xC2,
-    0xE5, 0x80, 0x72, 0xEE, 0x4A, 0x63, 0xA7, 0xF4, 0xE7, 0xE2, 0x05, 0xAD, 0xA6, 0x2D, 0xC1, 0x5A,
-    0xF4, 0xF6, 0x4F, 0x33, 0x2E, 0x05, 0x5C, 0x58, 0x67, 0xAC, 0xF5, 0x2E, 0x17, 0x38, 0xC9, 0x33,
-    0xEC, 0x67, 0x2D, 0xC4, 0x4A, 0x73, 0x67, 0x19, 0x16, 0x26, 0x82, 0x56, 0x2F, 0xAB, 0x59, 0xC4,
-    0xC4, 0xFD, 0x68, 0x25, 0xAA, 0x1A, 0xB2, 0xFC, 0xBA, 0x09, 0x98, 0x11, 0x3B, 0xF5, 0xDC, 0x2D,
-    0xA6, 0x56, 0x58, 0x6B, 0xC1, 0xD0, 0x89, 0x54, 0x08, 0xDE, 0x8A, 0x25, 0x38, 0x5B, 0x3A, 0xD7,
-    0xE6, 0x54, 0x14, 0x09, 0xA3, 0xCC, 0xB1, 0x3B, 0x64, 0xB5, 0xC7, 0x08, 0x64, 0x94, 0xB3, 0xAD,
-    0xC1, 0xEA, 0xA4, 0x50, 0xD7, 0xFF, 0x45, 0x23, 0x65, 0xA8, 0x21, 0xBB, 0x14, 0xBD, 0xB7, 0xC4,
-    0xBD, 0x98, 0x4B, 0xFE, 0xC0, 0x7B, 0xBD, 0x54, 0x93, 0xB1, 0x3D, 0x56, 0x7B, 0x4D, 0x56, 0xBD,
-    0x02, 0x90, 0xC4, 0x26, 0x3E, 0xA2, 0x9B, 0x06, 0x6E, 0xF6, 0x46, 0xE1, 0x28, 0x83, 0xB1, 0x4D,
-    0x20, 0xEA, 0x90, 0x78, 0x49, 0x89, 0x34, 0x98, 0x66, 0xF9, 0x7E, 0x31, 0x54, 0x1E, 0xF6, 0x2F,
-    0x03, 0xAA, 0xCF, 0x30, 0x27, 0xBF, 0x60, 0xC4, 0xC9, 0x2D, 0xED, 0x46, 0xE2, 0x8E, 0x73, 0xC1,
-    0xFA, 0xE1, 0x19, 0x76, 0x1C, 0x79, 0xBF, 0x68, 0xA5, 0x50, 0x51, 0xAA, 0x00, 0xBB, 0x90, 0x6F,
-    0x27, 0x1E, 0x45, 0x30, 0x3C, 0xAD, 0x0B, 0x20, 0x32, 0x69, 0x3E, 0x0D, 0x0A, 0x86, 0x02, 0xB9,
-    0x48, 0xA9, 0x69, 0xF4, 0x5F, 0x07, 0x4A, 0xAB, 0xD9, 0x65, 0x64, 0x0D, 0x2F, 0x44, 0xBA, 0xC4,
-    0x75, 0xD8, 0x66, 0xA5, 0xFD, 0x0F, 0x74, 0x40, 0xEB, 0xA0, 0x71, 0xD1, 0x05, 0x03, 0xB9, 0x37,
-    0xF6, 0x5F, 0x86, 0x30, 0x0D, 0xB5, 0x5B, 0xF9, 0x67, 0xA0, 0xF4, 0x5A, 0xF7, 0x35, 0xF0, 0x6C,
-    0xF0, 0x3D, 0xB0, 0xEC, 0x74, 0x02, 0xF5, 0xFD, 0x7E, 0xE3, 0x94, 0xDE, 0x2B, 0x85, 0x9F, 0x46,
-    0x61, 0x3A, 0x61, 0x05, 0x5B, 0xEB, 0x5F, 0x84, 0x6A, 0xDE, 0x71, 0x6A, 0xF7, 0xDD, 0xC2, 0xAB,
-    0x81, 0xE8, 0xE1, 0x27, 0xBC, 0xFF, 0x6F, 0xDC, 0xE1, 0x16, 0x58, 0xFF, 0xF8, 0x32, 0xF6, 0xF6,
-    0xB1, 0x8F, 0xFB, 0xF8, 0x64, 0x8D, 0x1E, 0xE5, 0x58, 0x40, 0x71, 0x61, 0xBC, 0xC4, 0x12, 0xE7,
-    0x90, 0xEA, 0x04, 0xEE, 0xD2, 0x9F, 0xAB, 0x8F, 0x5D, 0xC3, 0x62, 0xAF, 0xD6, 0xB0, 0x54, 0x12,
-    0x1B, 0xF3, 0x95, 0xF3, 0x64, 0x4A, 0x40, 0x1A, 0x15, 0xCB, 0xE3, 0x10, 0x3E, 0xF3, 0xC6, 0x92,
-    0x17, 0x8C, 0x5F, 0x1A, 0x6A, 0xE7, 0x74, 0x11, 0xA6, 0xD0, 0x97, 0x7A, 0xAC, 0xD5, 0xD6, 0x59,
-    0xBE, 0xF4, 0x73, 0xA8, 0xB6, 0xB9, 0x4F, 0x57, 0xDB, 0x1C, 0xD1, 0xD5, 0x36, 0xAD, 0xAE, 0xB6,
-    0x69, 0xA4, 0xDA, 0x66, 0xAE, 0x5D, 0x9D, 0x03, 0x17, 0x76, 0xB9, 0x15, 0xE6, 0x57, 0xB3, 0xAB,
-    0x71, 0x21, 0x5F, 0xC4, 0x8C, 0xA1, 0x16, 0xDE, 0x1C, 0xE0, 0x06, 0x34, 0x41, 0xCD, 0x92, 0xCC,
-    0x4C, 0x97, 0x5B, 0xF3, 0x0E, 0x26, 0x62, 0x4C, 0xFF, 0xAF, 0x5F, 0x90, 0x2E, 0x73, 0xED, 0xA6,
-    0x4A, 0x95, 0xCA, 0x29, 0xAA, 0x6F, 0xD9, 0x7A, 0xBF, 0x5D, 0xF0, 0x8B, 0xD6, 0x2A, 0xB3, 0x3B,
-    0x85, 0x2D, 0x8C, 0x52, 0x4C, 0x95, 0x09, 0xAD, 0x04, 0x8B, 0xA6, 0xC6, 0xFD, 0x58, 0xE2, 0x73,
-    0x90, 0xCB, 0xEA, 0x54, 0x09, 0x9E, 0xE7, 0x7A, 0x23, 0x39, 0x1A, 0xC3, 0x81, 0x58, 0x4A, 0x86,
-    0x9B, 0xB5, 0xB4, 0x9B, 0x18, 0x77, 0xA2, 0x91, 0x51, 0x04, 0x88, 0xE0, 0xFD, 0x34, 0xD5, 0x70,
-    0x8B, 0x4D, 0xA8, 0x61, 0x6E, 0x4E, 0x5E, 0xA9, 0x56, 0x12, 0x74, 0xF4, 0xD9, 0x68, 0x6A, 0xDD,
-    0x1B, 0xD2, 0x55, 0xA7, 0xD6, 0xD6, 0x8F, 0xFF, 0x6E, 0xAB, 0x15, 0xF0, 0xB3, 0xB1, 0x7B, 0xB5,
-    0x4F, 0x0F, 0x57, 0x24, 0x06, 0x83, 0x1B, 0x0E, 0xF6, 0xDF, 0xBE, 0x7B, 0x54, 0xE7, 0xB7, 0xAD,
-    0xF6, 0xE4, 0xEA, 0x6A, 0xBD, 0xBB, 0xAE, 0x36, 0x5C, 0x5D, 0x6D, 0x92, 0xAB, 0xFD, 0xD9, 0x15,
-    0x5D, 0x06, 0x70, 0xE2, 0xFD, 0xE3, 0x1F, 0xB2, 0xDA, 0x2F, 0x61, 0x9B, 0x4F, 0xA3, 0xDB, 0x7C,
-    0xCA, 0x55, 0x93, 0xA3, 0x35, 0xBC, 0x49, 0xDE, 0x04, 0xAB, 0xCE, 0xBB, 0xAD, 0x05, 0x7D, 0xFF,
-    0x5D, 0x2B, 0xA1, 0xA6, 0x1F, 0xAB, 0x12, 0xEA, 0xBB, 0x80, 0x56, 0xD7, 0xEB, 0x3F, 0x69, 0x9D,
-    0xA1, 0x1A, 0x2B, 0xA1, 0xBA, 0x0A, 0x66, 0xFD, 0x9F, 0x54, 0x0B, 0x29, 0xAE, 0x46, 0x94, 0x24,
-    0xD6, 0xC5, 0x20, 0x36, 0x76, 0xC3, 0x9F, 0x1E, 0x7A, 0x76, 0x45, 0x9C, 0x19, 0x5A, 0xFF, 0x4A,
-    0x7F, 0x2E, 0x4E, 0x52, 0xFF, 0x58, 0xC3, 0xB4, 0xAC, 0x6F, 0xD7, 0x01, 0x77, 0xD0, 0xA9, 0x1E,
-    0x02, 0x25, 0xEF, 0x73, 0xAA, 0xAF, 0x99, 0x7E, 0x12, 0x65, 0x40, 0xA9, 0x41, 0x38, 0xFA, 0x97,
-    0xE9, 0x4F, 0xA1, 0x91, 0x64, 0xF0, 0xAA, 0x92, 0x21, 0x0C, 0xC6, 0x31, 0xBF, 0x5C, 0xDD, 0x56,
-    0x68, 0xBA, 0x93, 0xF8, 0xD1, 0xD9, 0xE2, 0x09, 0x81, 0xF4, 0x25, 0xAD, 0x43, 0x27, 0x85, 0xFA,
-    0xF0, 0x89, 0x64, 0x3C, 0x83, 0x62, 0x99, 0xED, 0x6E, 0x77, 0xFD, 0xAA, 0x57, 0xBB, 0x49, 0xC6,
-    0x4A, 0x04, 0xBA, 0x11, 0xEB, 0xEB, 0x86, 0x29, 0x93, 0x95, 0x06, 0xC1, 0xD5, 0x68, 0x83, 0x62,
-    0xA5, 0x04, 0xB6, 0xEF, 0xC4, 0xDE, 0xE8, 0xB8, 0xC1, 0x9B, 0xD4, 0x3B, 0xE3, 0x2F, 0xD1, 0x51,
-    0x4C, 0xE9, 0x65, 0xB1, 0x5B, 0x7A, 0x3B, 0x5F, 0x0B, 0xD2, 0xD9, 0xB5, 0x2A, 0x39, 0x05, 0x17,
-    0x70, 0x68, 0x83, 0xFF, 0x87, 0x3D, 0x38, 0x72, 0x1E, 0xAE, 0xA1, 0x04, 0x4E, 0x05, 0x7D, 0x4E,
-    0xC6, 0xA9, 0x51, 0x56, 0x8C, 0x6F, 0xFD, 0x69, 0x76, 0x4B, 0x15, 0x1F, 0xA3, 0x5B, 0xAA, 0x93,
-    0xF0, 0x55, 0xB1, 0xB8, 0x2D, 0x58, 0xDE, 0x16, 0x2E, 0x71, 0xFA, 0xE1, 0x15, 0x67, 0xFF, 0x77,
-    0xAF, 0x5D, 0xBB, 0x4F, 0x09, 0xAA, 0x31, 0xB5, 0x6B, 0xD4, 0x5E, 0xE0, 0x73, 0xCB, 0xCD, 0x8D,
-    0x92, 0x16, 0xCF, 0xA0, 0x1D, 0x8B, 0x0B, 0x8A, 0x8F, 0x45, 0x95, 0x7B, 0x85, 0x2A, 0x15, 0xA9,
-    0xF2, 0x10, 0xA9, 0xF2, 0x16, 0x3B, 0x94, 0xB3, 0x7E, 0x4F, 0x0F, 0x99, 0x9B, 0x92, 0x2A, 0xE7,
-    0x25, 0x0E, 0x22, 0x52, 0xFB, 0x93, 0x0F, 0xEB, 0x21, 0xFB, 0x6D, 0xEB, 0x8D, 0xB1, 0xDE, 0xAF,
-    0x63, 0xBD, 0xD7, 0x5F, 0x96, 0x10, 0xB8, 0x5E, 0xAF, 0x75, 0x81, 0x4C, 0xFC, 0x38, 0x06, 0xFB,
-    0xC9, 0xF4, 0x1E, 0x75, 0xEF, 0x9D, 0x6B, 0xF5, 0x24, 0x22, 0x2A, 0xA7, 0x66, 0xC9, 0xB1, 0x59,
-    0x2B, 0xA7, 0xAE, 0xDD, 0x7E, 0xA2, 0x06, 0x18, 0xD5, 0xF9, 0x0D, 0x51, 0xA8, 0xF8, 0x14, 0xC9,
-    0xE5, 0x40, 0x1A, 0x46, 0x7A, 0x39, 0x4C, 0x24, 0x95, 0xDE, 0x86, 0x3B, 0x1C, 0x33, 0x22, 0xCA,
-    0x5C, 0x38, 0xD3, 0x01, 0xE9, 0x2A, 0x7F, 0x78, 0x63, 0x68, 0x09, 0xFC, 0xEE, 0x5C, 0xB4, 0x20,
-    0xBA, 0x67, 0x36, 0xB2, 0x8B, 0x2E, 0x5A, 0x48, 0x58, 0x49, 0xD6, 0xC3, 0x19, 0xB8, 0x5A, 0x39,
-    0xEF, 0x95, 0x91, 0x9A, 0x5C, 0x70, 0x4A, 0xF7, 0x2A, 0xD6, 0x9E, 0xE5, 0x5E, 0xEE, 0x33, 0xFF,
-    0x32, 0x48, 0xB5, 0xDB, 0x58, 0xB4, 0x10, 0x7F, 0x68, 0xD1, 0xC2, 0x98, 0x41, 0x49, 0x4D, 0x0E,
-    0x48, 0xB9, 0xDD, 0x49, 0xED, 0xD6, 0xF4, 0x7E, 0xCC, 0x83, 0x14, 0x22, 0x39, 0x55, 0x61, 0x8B,
-    0xB6, 0x23, 0x93, 0xCE, 0x94, 0xF9, 0x94, 0x3A, 0xBA, 0x8B, 0xAE, 0xBE, 0xBD, 0xBE, 0xDE, 0x32,
-    0x9C, 0x0D, 0x6F, 0x9A, 0x3D, 0x65, 0xB5, 0x49, 0x93, 0xE9, 0x30, 0xA8, 0x56, 0xA3, 0xE6, 0x9A,
-    0x8E, 0xBA, 0xFA, 0x61, 0x06, 0xFE, 0x20, 0xF8, 0x98, 0xAA, 0x78, 0xA7, 0x67, 0xB1, 0x62, 0x49,
-    0x6A, 0x9B, 0xA3, 0xBC, 0x56, 0x0F, 0x34, 0xE2, 0xB9, 0x3C, 0xD2, 0x6E, 0x13, 0xC6, 0xAD, 0xF4,
-    0xAC, 0x3C, 0x80, 0x95, 0x5D, 0x2A, 0x76, 0x54, 0xE7, 0x3B, 0xA5, 0x5F, 0x6E, 0x85, 0xC7, 0x7A,
-    0xD5, 0x75, 0x19, 0xCF, 0xD3, 0xBA, 0x0C, 0xF8, 0x7F, 0x79, 0x64, 0x16, 0xDC, 0x4C, 0x11, 0xDC,
-    0x51, 0xDE, 0x8D, 0xAC, 0xD0, 0xC7, 0x94, 0xD1, 0x27, 0x58, 0x2D, 0xF1, 0xDF, 0xBD, 0xE0, 0x5E,
-    0x2F, 0xD8, 0xD2, 0x0B, 0x1E, 0x56, 0x16, 0x3C, 0xFF, 0xEC, 0x17, 0x2C, 0x41, 0x50, 0xC3, 0x65,
-    0xE6, 0xAA, 0xF3, 0xA7, 0xF9, 0xCA, 0x75, 0xEF, 0x29, 0x4F, 0x9F, 0x22, 0x69, 0x96, 0x3C, 0x27,
-    0x4A, 0xF0, 0xC8, 0xE8, 0xFD, 0xCB, 0xC8, 0xF7, 0x8F, 0xE5, 0xC9, 0x9F, 0xE1, 0x41, 0x76, 0x7B,
-    0x92, 0xCA, 0x9C, 0xC2, 0xD7, 0xC7, 0xA0, 0xF9, 0xE1, 0xF1, 0xB0, 0xAB, 0x66, 0x11, 0x14, 0x18,
-    0x8B, 0x46, 0xE3, 0x3B, 0xA6, 0x96, 0xFF, 0x41, 0x9C, 0xB8, 0xB2, 0xCC, 0x32, 0xE3, 0x92, 0xDB,
-    0xDA, 0xBF, 0xD7, 0x66, 0xB4, 0xD5, 0x46, 0x35, 0x7C, 0xA7, 0xD6, 0x13, 0xD4, 0x33, 0x5F, 0xBB,
-    0x9D, 0x58, 0x98, 0xCF, 0x23, 0x50, 0xDC, 0xEE, 0x90, 0xFB, 0xA0, 0x8C, 0xF3, 0x6E, 0x03, 0xF5,
-    0x71, 0xF5, 0x74, 0x11, 0x39, 0x95, 0x1F, 0xAB, 0xE3, 0xDE, 0xA5, 0x86, 0xC9, 0x00, 0xEB, 0x7A,
-    0x27, 0xDA, 0x7F, 0xF3, 0x2A, 0xC3, 0x85, 0xEA, 0xD1, 0x77, 0x5E, 0x16, 0x10, 0x72, 0xFD, 0x97,
-    0xDA, 0x75, 0xF9, 0xE0, 0xD7, 0xE2, 0xFD, 0x46, 0x0C, 0x9A, 0xA9, 0x26, 0xA0, 0x0D, 0x51, 0x3B,
-    0x5E, 0xC9, 0x1E, 0x8D, 0x4D, 0x46, 0xCB, 0xCE, 0xFF, 0xD5, 0x4C, 0xD5, 0xDE, 0xAF, 0xDA, 0xA8,
-    0x03, 0x72, 0x1A, 0x78, 0x6C, 0xD2, 0xA3, 0x84, 0x7B, 0x07, 0x56, 0x62, 0xB2, 0xBF, 0x3D, 0x70,
-    0x3A, 0x17, 0xBE, 0x9D, 0xAE, 0xC4, 0xD8, 0xA3, 0x65, 0xE0, 0xB4, 0x93, 0x0D, 0xD3, 0x4D, 0x7F,
-    0x92, 0x9E, 0x66, 0x9B, 0x5C, 0xAF, 0x4F, 0x31, 0x13, 0x60, 0x42, 0xC9, 0x4A, 0xC4, 0x05, 0x80,
-    0xF5, 0xD4, 0x47, 0x23, 0xE8, 0xDE, 0x6B, 0xC9, 0x8F, 0xC9, 0x7B, 0x2C, 0xDB, 0xE3, 0xF9, 0x90,
-    0x0C, 0xAA, 0x32, 0x8B, 0x51, 0xAD, 0x04, 0x1F, 0x34, 0x7F, 0x72, 0x0A, 0xFE, 0xD1, 0x41, 0x40,
-    0xA6, 0x40, 0x1A, 0xCD, 0xB7, 0xF7, 0x8E, 0x71, 0x07, 0xC6, 0xD8, 0x9F, 0x1B, 0xD2, 0xB0, 0x3A,
-    0x51, 0x32, 0xA6, 0x8C, 0x39, 0x6D, 0x32, 0xA4, 0xCC, 0x83, 0x21, 0xCF, 0x14, 0xCA, 0xF9, 0x05,
-    0x4C, 0xCF, 0x2D, 0x16, 0xA4, 0xB2, 0xCD, 0x31, 0x8E, 0x72, 0xB6, 0xE5, 0x40, 0xAF, 0x27, 0x0C,
-    0x8C, 0xE7, 0x3B, 0x12, 0x53, 0x54, 0x4C, 0xA5, 0x8D, 0x68, 0x59, 0x4A, 0xFD, 0xA4, 0xEF, 0x4F,
-    0x3D, 0xC6, 0xB6, 0xDD, 0xAB, 0xEC, 0x04, 0xC3, 0xAC, 0x9E, 0x4E, 0x3F, 0xDF, 0xE3, 0x4C, 0xDA,
-    0x8F, 0x73, 0x9C, 0x89, 0x56, 0x61, 0xA6, 0x56, 0x42, 0x0B, 0x82, 0xB6, 0xDD, 0x26, 0x77, 0x64,
-    0xFA, 0xD1, 0x97, 0xF5, 0x87, 0x7B, 0x9A, 0x91, 0xE4, 0x98, 0xB9, 0xCD, 0xDF, 0xDA, 0x8C, 0x94,
-    0xAE, 0x34, 0x23, 0xDD, 0xFF, 0x47, 0x13, 0x15, 0x85, 0x6C, 0x46, 0x9A, 0xB3, 0x19, 0xA9, 0x63,
-    0x33, 0xD2, 0x0E, 0x9B, 0x91, 0x2E, 0x8C, 0x00, 0xCE, 0x2E, 0x47, 0x05, 0x26, 0x05, 0x34, 0xF7,
-    0x7D, 0xB2, 0x18, 0x6D, 0xFB, 0x59, 0xC6, 0x68, 0x59, 0xE6, 0x32, 0xC8, 0x19, 0x87, 0x0C, 0x1E,
-    0x3A, 0xF5, 0x2E, 0x9C, 0x3C, 0x5D, 0x4D, 0xBD, 0x55, 0xDA, 0xA8, 0x24, 0x26, 0x0F, 0x64, 0xDA,
-    0xB6, 0xFF, 0x72, 0x05, 0x1B, 0x3B, 0xEF, 0xB0, 0x6A, 0x99, 0xD0, 0x58, 0x02, 0x8D, 0x5B, 0xEC,
-    0xE1, 0xD2, 0xBD, 0xC9, 0x8D, 0x73, 0x73, 0x7B, 0xC6, 0xD8, 0x7C, 0xCC, 0xF8, 0x62, 0x34, 0xBE,
-    0x58, 0xAA, 0x2D, 0x46, 0x16, 0xE5, 0xEC, 0x17, 0xBC, 0x58, 0x62, 0xA3, 0x6A, 0xE3, 0xE6, 0x84,
-    0x7A, 0xDF, 0xF6, 0x41, 0xFE, 0xDD, 0xE7, 0x4A, 0x73, 0x5A, 0x0D, 0xFE, 0xDC, 0xFB, 0xC2, 0x97,
-    0x3D, 0xD8, 0x6D, 0xCE, 0x80, 0x29, 0x57, 0x4F, 0x4F, 0x34, 0x1C, 0x6A, 0xED, 0x76, 0x43, 0x66,
-    0xA3, 0xBD, 0x19, 0x8F, 0x46, 0xF8, 0xC4, 0xC1, 0x6E, 0xF7, 0xD5, 0x8B, 0x26, 0xD8, 0x3D, 0x6F,
-    0x99, 0x27, 0xAA, 0x1A, 0xE5, 0xB2, 0x6C, 0x49, 0x0C, 0x99, 0x70, 0xA5, 0x3F, 0xF2, 0xA8, 0x94,
-    0x4E, 0x7D, 0xEB, 0x53, 0x77, 0x32, 0x3E, 0xFA, 0x91, 0x0C, 0xD2, 0x01, 0xEE, 0x08, 0x9C, 0x5E,
-    0x29, 0xEE, 0xD8, 0x5A, 0xB6, 0x6C, 0x88, 0x38, 0xB9, 0xBB, 0x72, 0xD4, 0x5E, 0xA7, 0xDC, 0x37,
-    0x06, 0xA0, 0xD8, 0x13, 0xF0, 0xB2, 0x04, 0x73, 0xEF, 0x88, 0x02, 0x62, 0xCD, 0xA1, 0x5B, 0x89,
-    0x8B, 0x31, 0xB0, 0x37, 0x79, 0x80, 0xD2, 0xDD, 0x1E, 0x75, 0x99, 0xC4, 0x47, 0xC7, 0xB2, 0xE5,
-    0xC4, 0x24, 0xA3, 0x68, 0xF8, 0xC6, 0xF0, 0x80, 0x10, 0xE6, 0xFC, 0x6A, 0xA9, 0xD9, 0xEF, 0xD7,
-    0xE1, 0x48, 0x95, 0x39, 0x1C, 0x69, 0xC4, 0x26, 0xC5, 0xAE, 0xA2, 0xB1, 0x45, 0x70, 0xDB, 0x00,
-    0x1E, 0x13, 0x2E, 0x5E, 0xD4, 0x8D, 0xD9, 0xEA, 0xB3, 0x6A, 0xA2, 0xFC, 0x85, 0x34, 0x51, 0x4E,
-    0xA5, 0x89, 0x72, 0x2E, 0x4D, 0x94, 0xC3, 0x46, 0x61, 0xC5, 0xF6, 0xAD, 0x9C, 0x5A, 0xF1, 0x9F,
-    0x96, 0x2B, 0xBE, 0xF8, 0x85, 0x95, 0x13, 0x21, 0x8F, 0xAC, 0x82, 0xB1, 0x71, 0x3F, 0x06, 0x2C,
-    0x36, 0x35, 0x2D, 0xD1, 0x63, 0x5C, 0x60, 0xAA, 0x43, 0x6B, 0xBB, 0x22, 0x01, 0x14, 0xCE, 0x65,
-    0xF4, 0x80, 0x3C, 0x35, 0x5F, 0x8D, 0x38, 0x90, 0x72, 0x72, 0x26, 0x42, 0xBE, 0xEB, 0x28, 0x04,
-    0xA5, 0xFE, 0xB1, 0xAE, 0x27, 0x94, 0x5E, 0x72, 0x6A, 0x6E, 0xBB, 0x11, 0x7E, 0x4C, 0xAE, 0x96,
-    0x12, 0xEA, 0xB8, 0xBD, 0x96, 0x70, 0xDF, 0x0A, 0x6D, 0x75, 0x14, 0x28, 0xD0, 0x55, 0x91, 0x42,
-    0x66, 0xEF, 0x4D, 0xC1, 0xD6, 0xAF, 0xEB, 0xC8, 0x89, 0x0E, 0x8A, 0xCA, 0xBD, 0x8D, 0xE0, 0xBD,
-    0x4D, 0x89, 0x84, 0x4D, 0xF4, 0xB9, 0xC7, 0xA6, 0x16, 0x49, 0x4A, 0x56, 0xAE, 0x30, 0x13, 0xE3,
-    0x08, 0xC0, 0x83, 0x94, 0x9F, 0xAB, 0xB8, 0x5B, 0x06, 0x2E, 0x44, 0x7A, 0xA5, 0x72, 0x54, 0x21,
-    0xD3, 0xCC, 0x54, 0x5F, 0xE4, 0xD1, 0xFD, 0x43, 0x0B, 0xA5, 0xB3, 0x72, 0x92, 0x12, 0x34, 0x09,
-    0x50, 0x59, 0x2A, 0xE7, 0x99, 0x02, 0x56, 0xEA, 0x1A, 0x68, 0x81, 0x62, 0xBB, 0x4A, 0xA0, 0xDD,
-    0xDE, 0x4B, 0xED, 0xA1, 0x07, 0xAE, 0x3E, 0x39, 0xB0, 0x7C, 0xA7, 0x84, 0xAE, 0xDA, 0x11, 0x59,
-    0x07, 0x19, 0x19, 0x74, 0x63, 0xFB, 0x8D, 0xF4, 0xFF, 0x27, 0x0C, 0x72, 0x94, 0x5E, 0x01, 0x20,
-    0x38, 0x57, 0xFF, 0xBE, 0x78, 0xBE, 0x0A, 0x8F, 0x3C, 0x92, 0x5C, 0xBD, 0x74, 0xF5, 0x12, 0x23,
-    0x46, 0x01, 0x1B, 0x7C, 0x1E, 0x58, 0x2D, 0xC2, 0x8E, 0xB4, 0xB7, 0x5E, 0xC8, 0x29, 0xA0, 0x0C,
-    0x27, 0x61, 0x11, 0x5E, 0x7E, 0x1B, 0x01, 0xE3, 0x15, 0x8F, 0x43, 0x9F, 0x0D, 0xA4, 0x31, 0xB5,
-    0xA6, 0xF5, 0x4C, 0xF7, 0x1E, 0x0A, 0xCD, 0x42, 0x1D, 0x87, 0x7E, 0x5C, 0x3B, 0x09, 0x72, 0xEE,
-    0x62, 0xAE, 0x71, 0x04, 0xD5, 0xAB, 0x5D, 0x99, 0x4E, 0x16, 0xDE, 0x3B, 0xDF, 0x3E, 0x57, 0x08,
-    0x4E, 0xA1, 0xCC, 0x6E, 0x6F, 0x0F, 0x22, 0xE4, 0xFA, 0x98, 0x61, 0x47, 0xA7, 0xEE, 0x3A, 0xCD,
-    0x1B, 0x6C, 0xC8, 0xC0, 0xEC, 0x78, 0xB4, 0xEA, 0x06, 0x54, 0x5F, 0x23, 0x1E, 0x86, 0x15, 0xC3,
-    0x8C, 0x67, 0xD4, 0x6C, 0x15, 0xF4, 0x43, 0x87, 0xA7, 0x5B, 0xBB, 0x4F, 0x8D, 0xF8, 0x6C, 0xC8,
-    0x66, 0x8F, 0xE1, 0xAA, 0xCC, 0x00, 0x7A, 0x7B, 0x60, 0x79, 0x96, 0xA6, 0x85, 0x48, 0xC6, 0xAD,
-    0x0A, 0x68, 0x99, 0x86, 0xA3, 0x55, 0x9E, 0x04, 0xAF, 0x8D, 0x65, 0xDE, 0x32, 0x32, 0x3E, 0x31,
-    0x32, 0x1F, 0x99, 0x40, 0x76, 0xA8, 0xFA, 0x41, 0x1F, 0x4C, 0x99, 0x08, 0x9B, 0x07, 0x71, 0xA8,
-    0x0F, 0x5C, 0xBA, 0x72, 0xAE, 0x18, 0x7B, 0xDE, 0x84, 0x4D, 0xAF, 0x6C, 0xEB, 0xE3, 0x8A, 0x79,
-    0x06, 0x0C, 0x83, 0x51, 0x25, 0xF9, 0xEA, 0x19, 0x7D, 0x4E, 0x29, 0x04, 0xD1, 0xAE, 0x74, 0x6D,
-    0x1B, 0x4F, 0x66, 0xEE, 0xD6, 0xCF, 0xE5, 0xEE, 0x20, 0xE7, 0x4B, 0x16, 0x0E, 0x6D, 0xC5, 0xB0,
-    0x8C, 0x91, 0xD9, 0x43, 0x9A, 0xB0, 0xEB, 0x82, 0x47, 0x2A, 0x67, 0xDF, 0x1F, 0xD2, 0x99, 0xCD,
-    0x64, 0xDC, 0x96, 0x3E, 0xF3, 0x42, 0x47, 0x03, 0x18, 0xA6, 0xF7, 0x2A, 0xDA, 0xB0, 0x04, 0xB6,
-    0xDE, 0x7B, 0xB7, 0x23, 0x75, 0xB0, 0xBE, 0xA9, 0x1C, 0x29, 0x3C, 0x13, 0xC5, 0x3C, 0xE7, 0x82,
-    0x1F, 0xCE, 0x9C, 0x37, 0x2A, 0xAB, 0x4E, 0xCE, 0x9D, 0xE9, 0x36, 0xCA, 0x88, 0x9D, 0x53, 0x3C,
-    0xBE, 0x34, 0x6B, 0xE8, 0x84, 0xAC, 0xAD, 0xEE, 0x44, 0x41, 0xE5, 0xF1, 0x8C, 0x71, 0xD3, 0x04,
-    0xA0, 0x3B, 0xFA, 0x58, 0x9C, 0xEE, 0x0E, 0x15, 0xBF, 0xE6, 0xF0, 0xB3, 0x1E, 0x80, 0x79, 0x3B,
-    0xE3, 0xD9, 0x2E, 0x8E, 0x08, 0x92, 0xAC, 0xF3, 0x31, 0x6D, 0xA6, 0xED, 0x66, 0xA1, 0x25, 0x75,
-    0x46, 0xF2, 0x4A, 0x26, 0xA7, 0xC4, 0x30, 0xEF, 0xBB, 0xFD, 0xC3, 0xD5, 0x77, 0x24, 0x98, 0x8D,
-    0x1D, 0xB6, 0xF8, 0x19, 0x87, 0xBD, 0x67, 0x56, 0xA5, 0x8F, 0xFE, 0x0D, 0x7E, 0xB6, 0xDD, 0xC9,
-    0x36, 0x8E, 0xE7, 0x96, 0x8E, 0x12, 0xF9, 0x20, 0x14, 0xDA, 0x04, 0xF6, 0x36, 0xC1, 0x86, 0x46,
-    0xA6, 0x3B, 0xCA, 0xFA, 0xF6, 0xA7, 0xDF, 0xF4, 0x65, 0xB6, 0x43, 0xCA, 0x7D, 0x79, 0x42, 0xC4,
-    0x8B, 0x99, 0x1C, 0x08, 0x5B, 0xD9, 0xB9, 0x06, 0x21, 0xF6, 0x32, 0x4B, 0xD3, 0xED, 0xB9, 0x30,
-    0xA0, 0x2B, 0xE1, 0x85, 0x16, 0x40, 0xE8, 0x44, 0x2B, 0x27, 0xD8, 0x50, 0x87, 0x32, 0x9E, 0xEC,
-    0x17, 0x53, 0xBA, 0x2A, 0x53, 0xA9, 0x9A, 0x27, 0xDA, 0x8A, 0x8A, 0x80, 0x8B, 0x60, 0x8F, 0x97,
-    0x9C, 0x1F, 0xB2, 0xB6, 0xD2, 0xCA, 0x45, 0xDF, 0x3A, 0x3B, 0xD1, 0x3A, 0x85, 0x53, 0xDD, 0x23,
-    0x32, 0xC7, 0x83, 0x54, 0x3B, 0xC5, 0x33, 0x75, 0xB3, 0x37, 0xF3, 0xB0, 0x8C, 0xEC, 0xD6, 0x6A,
-    0x20, 0x3A, 0x39, 0x98, 0x84, 0x8E, 0x83, 0x5F, 0x64, 0xBA, 0x6A, 0xA6, 0x5B, 0x3D, 0x82, 0xDA,
-    0xA2, 0x06, 0x76, 0x5A, 0x9F, 0x07, 0xC2, 0x04, 0x25, 0x11, 0xF9, 0x6D, 0xA7, 0x31, 0x7F, 0x51,
-    0xEB, 0x5C, 0x03, 0xA9, 0xA3, 0xA3, 0xAD, 0x7C, 0x3D, 0xC4, 0x1C, 0xEA, 0x62, 0x6F, 0x07, 0x1F,
-    0xDB, 0xEE, 0xB2, 0xA1, 0xB0, 0xBB, 0x53, 0x15, 0x89, 0x60, 0x0B, 0xF6, 0xE1, 0x9F, 0x43, 0xB5,
-    0x50, 0x21, 0xFC, 0xA0, 0xB2, 0x7B, 0x8A, 0x83, 0x5B, 0x92, 0x0C, 0xEC, 0x75, 0x8D, 0x38, 0xE0,
-    0x31, 0x69, 0x9C, 0xD4, 0xA7, 0xFD, 0xEF, 0x75, 0x99, 0x19, 0x69, 0xD1, 0x60, 0xED, 0xB4, 0xE1,
-    0x6F, 0xF9, 0x72, 0x0A, 0xD1, 0x02, 0x56, 0xFD, 0x0F, 0x35, 0x18, 0xF1, 0x80, 0x66, 0xFA, 0x30,
-    0xD7, 0x90, 0xB3, 0x92, 0xB6, 0x01, 0x53, 0xBA, 0xA4, 0x0E, 0x58, 0xF1, 0xDD, 0x5A, 0x00, 0xC2,
-    0xC2, 0x66, 0x21, 0x2B, 0x1C, 0x4A, 0x28, 0xF2, 0x6A, 0x92, 0xA5, 0x3B, 0xAA, 0x6F, 0x1E, 0xA1,
-    0x3B, 0x5C, 0x63, 0x77, 0x77, 0xA2, 0x94, 0x6A, 0x37, 0x08, 0xE5, 0xF8, 0x6D, 0xF7, 0x7F, 0xB3,
-    0xB7, 0x5C, 0xD9, 0xBF, 0xDE, 0xD4, 0x79, 0xE0, 0x47, 0x75, 0xD6, 0xF7, 0x29, 0x69, 0x56, 0x08,
-    0x1E, 0x6F, 0xA5, 0x61, 0xED, 0xD9, 0x4E, 0x02, 0x04, 0xF9, 0xDC, 0x4F, 0xF7, 0xB1, 0x71, 0x0D,
-    0xBB, 0xFB, 0xE4, 0xD9, 0xC2, 0x8F, 0xE7, 0x1B, 0x97, 0x80, 0x7C, 0x80, 0x36, 0x52, 0xAC, 0xAC,
-    0x84, 0x89, 0xB3, 0x56, 0x0F, 0x5A, 0xB7, 0x08, 0x07, 0x06, 0xA0, 0x56, 0x6E, 0xAA, 0x9F, 0x1E,
-    0xD9, 0xD3, 0x95, 0xC7, 0xCA, 0x04, 0xFA, 0x39, 0x6F, 0x6F, 0x80, 0x8F, 0x2C, 0xC6, 0x56, 0xA2,
-    0xF8, 0xBB, 0x90, 0xA8, 0xFB, 0x96, 0x5F, 0x92, 0xC0, 0xDE, 0xE3, 0x5E, 0x47, 0x05, 0x98, 0xCD,
-    0x5A, 0xDB, 0x68, 0x4C, 0xB6, 0x87, 0x49, 0x2D, 0xD1, 0x68, 0x73, 0x7E, 0x51, 0x04, 0x3C, 0x82,
-    0xE0, 0x12, 0xD4, 0x53, 0x91, 0xBD, 0x9A, 0x94, 0xF2, 0x65, 0x02, 0xD9, 0xA8, 0x31, 0xC8, 0xCC,
-    0xAD, 0xC7, 0xE3, 0x5C, 0x60, 0x54, 0xBB, 0xBD, 0xBC, 0x1C, 0xF6, 0x54, 0x81, 0xE0, 0xF6, 0xCE,
-    0x22, 0xE4, 0x96, 0xBA, 0x2D, 0x7D, 0xCC, 0xD7, 0xBD, 0x30, 0x59, 0x11, 0x86, 0xE6, 0x91, 0x5E,
-    0x9C, 0x8A, 0x53, 0xFD, 0x0B, 0x15, 0xBC, 0x54, 0xA9, 0xDE, 0x2F, 0x83, 0x2A, 0x94, 0x16, 0x8B,
-    0x17, 0x34, 0x0B, 0x06, 0x83, 0xFC, 0x8B, 0x8F, 0xD9, 0x86, 0x7A, 0x9C, 0x10, 0xC3, 0xC9, 0xB9,
-    0xC5, 0xDF, 0xA5, 0x83, 0xF5, 0xB0, 0x2E, 0x69, 0xA9, 0x47, 0xE4, 0x2A, 0xD4, 0x4D, 0x38, 0xF3,
-    0x3F, 0xD6, 0x46, 0x51, 0x52, 0xCF, 0x8B, 0x2F, 0x67, 0x30, 0x97, 0xFB, 0x89, 0xE3, 0x22, 0xE2,
-    0xF8, 0x28, 0x05, 0x01, 0xA2, 0xCB, 0xA7, 0xA4, 0x10, 0x94, 0x40, 0x67, 0x71, 0x62, 0x0F, 0x8F,
-    0xCB, 0xA6, 0xE6, 0xCF, 0x83, 0x17, 0xD7, 0x3B, 0xE8, 0x5D, 0x9F, 0x8D, 0x22, 0x73, 0xF5, 0x8F,
-    0x74, 0x42, 0x76, 0x3E, 0xBA, 0x67, 0xC9, 0x88, 0x43, 0x22, 0xBE, 0x2C, 0x52, 0x7E, 0xAA, 0x36,
-    0x95, 0xCA, 0x66, 0x4A, 0xB1, 0x5A, 0x56, 0xE8, 0xC0, 0x62, 0xDC, 0xA7, 0x2B, 0x80, 0xDC, 0x0A,
-    0x8C, 0x9C, 0xC5, 0x52, 0x2B, 0xAA, 0x4D, 0xCF, 0x9F, 0xC7, 0xBB, 0xBF, 0x04, 0x43, 0x77, 0xCB,
-    0xE8, 0x1C, 0xB9, 0x24, 0x97, 0xEE, 0xF2, 0x33, 0x68, 0xAF, 0x31, 0xA2, 0x65, 0xED, 0xE5, 0xFB,
-    0x2C, 0x58, 0x5D, 0x13, 0xC6, 0xA3, 0xAF, 0x69, 0x6B, 0x5F, 0x93, 0xDD, 0x23, 0x3C, 0xAE, 0x71,
-    0x10, 0x5B, 0x29, 0xE5, 0x61, 0x51, 0xEC, 0x5C, 0x97, 0xF4, 0x99, 0x53, 0xCA, 0x3D, 0x4E, 0x19,
-    0xE9, 0x56, 0x18, 0xD2, 0x69, 0xEE, 0x94, 0xD2, 0xD1, 0xF2, 0x44, 0x21, 0x68, 0xE7, 0x65, 0xF1,
-    0xE6, 0xDC, 0x0F, 0xC4, 0xF2, 0x59, 0xA0, 0x55, 0xA0, 0x53, 0xC5, 0x72, 0x4F, 0xBE, 0x08, 0xAA,
-    0x9A, 0x28, 0x2A, 0x44, 0x29, 0x84, 0x0E, 0xD3, 0xBD, 0x32, 0x96, 0xF8, 0x69, 0x9F, 0x65, 0x7E,
-    0x6C, 0x76, 0x4F, 0x90, 0xEE, 0x54, 0xCC, 0x8F, 0x5D, 0x4D, 0xA1, 0x9E, 0x5B, 0x9B, 0xC7, 0x3F,
-    0xED, 0x3A, 0x49, 0x60, 0xA1, 0x03, 0x83, 0x52, 0xD2, 0x99, 0x5E, 0x2D, 0xB8, 0xDB, 0xAA, 0xDD,
-    0xBB, 0x76, 0xFA, 0xFC, 0xBE, 0x1C, 0xDA, 0x7C, 0x7C, 0x8D, 0x3C, 0x8D, 0xF1, 0x06, 0x87, 0xDF,
-    0x81, 0x41, 0x47, 0x65, 0xCF, 0x57, 0xE5, 0x88, 0x77, 0xE6, 0x5D, 0x64, 0xDE, 0xDA, 0x3A, 0xB5,
-    0x87, 0x92, 0x92, 0x61, 0xDB, 0xDD, 0x43, 0xE8, 0x4A, 0xDA, 0x0D, 0x90, 0x8B, 0xE7, 0x01, 0xA6,
-    0x8F, 0xD6, 0x0F, 0x4F, 0xED, 0xF7, 0x2E, 0x5D, 0xEC, 0x92, 0x60, 0x2E, 0x69, 0x5E, 0xAF, 0x57,
-    0xA2, 0x47, 0x97, 0xEC, 0x3A, 0x63, 0x7E, 0xD7, 0x6D, 0x58, 0xE7, 0xA4, 0x91, 0xFB, 0x5D, 0x8C,
-    0x4A, 0x38, 0x14, 0x26, 0xC7, 0x6F, 0x0D, 0x2F, 0x26, 0x95, 0xB4, 0xBC, 0x95, 0xCC, 0x65, 0x87,
-    0x39, 0x35, 0x4E, 0x94, 0xCA, 0xF9, 0x5C, 0x5C, 0xAE, 0xDD, 0xEA, 0xE3, 0x6A, 0x25, 0x3E, 0x2A,
-    0x27, 0xF5, 0x27, 0xE4, 0x37, 0xBB, 0xE5, 0x1D, 0xFE, 0x5B, 0x72, 0xAC, 0xED, 0x93, 0xA2, 0xC6,
-    0x78, 0x9F, 0x5F, 0x26, 0x22, 0x8A, 0xA4, 0x55, 0x2D, 0xC7, 0xA1, 0xA5, 0xAE, 0x74, 0x35, 0x78,
-    0xDD, 0x9A, 0x54, 0xB6, 0x49, 0xA6, 0x44, 0x07, 0x3F, 0x1F, 0xD0, 0xC6, 0x6D, 0x8D, 0x6D, 0x7B,
-    0x54, 0x9F, 0xB5, 0x18, 0xE3, 0xDB, 0xA0, 0x3A, 0xCF, 0xD0, 0xA1, 0x97, 0xE7, 0x5F, 0x4E, 0x58,
-    0x37, 0x21, 0x47, 0x10, 0xB0, 0x79, 0xF8, 0x34, 0x8F, 0xFD, 0x63, 0x97, 0x0E, 0x4F, 0xD1, 0x01,
-    0x68, 0x8F, 0xF0, 0x46, 0x70, 0xBA, 0x91, 0x2A, 0x4F, 0x0F, 0x72, 0xE3, 0x56, 0x0E, 0xF4, 0xA1,
-    0xB0, 0xB8, 0x38, 0x7E, 0xAB, 0xA0, 0xF3, 0x0F, 0xB6, 0x99, 0xF0, 0xD3, 0x60, 0x81, 0x40, 0xE2,
-    0xBE, 0x2B, 0x2C, 0x80, 0xAD, 0x4D, 0x17, 0x2C, 0xF0, 0xF2, 0xCD, 0x6D, 0x38, 0x64, 0x52, 0x9E,
-    0xD4, 0x66, 0xA0, 0xC1, 0xA9, 0xB7, 0x1A, 0x61, 0x81, 0x72, 0x64, 0x01, 0x4F, 0xB3, 0x80, 0x75,
-    0x07, 0x16, 0xB0, 0xEE, 0xC8, 0x02, 0x14, 0x1B, 0xAB, 0xC5, 0xEE, 0x51, 0x6A, 0x22, 0x66, 0xA2,
-    0xF6, 0x0A, 0x0D, 0x29, 0x44, 0x34, 0xEA, 0x97, 0x60, 0xCF, 0xC2, 0xA6, 0xB5, 0x8D, 0xD8, 0xAE,
-    0xFD, 0x12, 0xFD, 0x9A, 0x7E, 0x7B, 0x9B, 0x5B, 0xD2, 0xC3, 0x3A, 0x6C, 0x3C, 0x99, 0x9B, 0x63,
-    0xAC, 0x48, 0xA4, 0x20, 0xC7, 0xF8, 0x8C, 0x84, 0x25, 0x72, 0x10, 0x5A, 0xB9, 0xCA, 0x02, 0x76,
-    0xCD, 0xE2, 0x42, 0x12, 0xC9, 0xAB, 0x31, 0x69, 0xE8, 0xD9, 0xDB, 0x30, 0xC6, 0x17, 0x75, 0xB4,
-    0x21, 0x0C, 0x39, 0xA9, 0x01, 0x97, 0x3B, 0x0D, 0xD3, 0x16, 0x8A, 0x73, 0xD7, 0xCC, 0x82, 0x5E,
-    0xA2, 0x28, 0xD1, 0xD1, 0xDE, 0x2A, 0xAD, 0xD6, 0x36, 0x1D, 0x32, 0xD4, 0xA9, 0xFB, 0xB7, 0x3B,
-    0x39, 0xEB, 0x8E, 0x95, 0x9F, 0xA2, 0xA4, 0x9A, 0x6F, 0x28, 0xFF, 0x62, 0x05, 0x86, 0xAA, 0xBD,
-    0x8A, 0xD5, 0xF0, 0x2C, 0x9D, 0x59, 0x79, 0x98, 0xAB, 0xCF, 0x37, 0x14, 0xE3, 0x76, 0x70, 0xFD,
-    0xF8, 0xED, 0x0C, 0xE2, 0xB3, 0xBB, 0xA1, 0x83, 0x31, 0xF3, 0x07, 0x7E, 0x0D, 0x16, 0xD4, 0xA0,
-    0x3E, 0x6C, 0x36, 0x51, 0xBA, 0x0D, 0x14, 0x3B, 0x20, 0x87, 0x4C, 0x61, 0xC7, 0xC9, 0x61, 0x60,
-    0x1B, 0x46, 0xD6, 0x24, 0xD9, 0x3F, 0xA3, 0x2E, 0xB7, 0x1A, 0xA9, 0x4F, 0xBF, 0x26, 0xEB, 0x97,
-    0xE4, 0x8E, 0xFE, 0x86, 0x25, 0xFD, 0xDD, 0x27, 0xDD, 0x32, 0x47, 0xC9, 0x20, 0xB1, 0x23, 0xB5,
-    0xDB, 0xD2, 0xDB, 0xA8, 0x44, 0x3E, 0xCC, 0x37, 0xD5, 0x8C, 0xF3, 0x3D, 0xA8, 0x2B, 0x9C, 0xF6,
-    0x1C, 0xFA, 0xFC, 0xA5, 0x6A, 0x05, 0xE7, 0x56, 0xB3, 0xC0, 0x22, 0xCA, 0x39, 0xF5, 0xDE, 0x6D,
-    0xD4, 0x1D, 0xBD, 0x9D, 0x2F, 0xD7, 0x09, 0xCE, 0x82, 0xBC, 0x19, 0x2B, 0x11, 0x05, 0x2C, 0x9A,
-    0xF5, 0x4E, 0x80, 0xFB, 0x4B, 0x40, 0x5C, 0x65, 0xA5, 0xF6, 0x98, 0xA8, 0x72, 0x3A, 0xAE, 0x22,
-    0x29, 0x89, 0x7A, 0x5A, 0x9F, 0x09, 0xBA, 0x98, 0xE0, 0xEC, 0x05, 0x3B, 0xDD, 0xDB, 0x20, 0xFC,
-    0x65, 0xF9, 0x8E, 0x1F, 0x70, 0xF2, 0x3E, 0xF2, 0xFB, 0xC4, 0x1C, 0x11, 0xEF, 0xBF, 0x4A, 0xA8,
-    0xCF, 0xEE, 0xE3, 0x19, 0xB5, 0x6D, 0xCD, 0x0C, 0x53, 0xBC, 0xEF, 0x4B, 0x46, 0x72, 0x01, 0x6A,
-    0xDA, 0x94, 0x88, 0x97, 0xEA, 0x16, 0xB7, 0xAB, 0xC9, 0x2F, 0xFC, 0x20, 0x68, 0x8B, 0x64, 0x23,
-    0xDF, 0x06, 0xB0, 0x76, 0x16, 0xA1, 0xC4, 0xDA, 0x9E, 0x0C, 0x37, 0x43, 0x53, 0xC1, 0x93, 0xCC,
-    0x37, 0x1C, 0xE4, 0xEC, 0x82, 0xD8, 0x2D, 0xEC, 0x4A, 0xBE, 0x57, 0x88, 0xFD, 0xD1, 0x02, 0x60,
-    0x93, 0xD4, 0xE9, 0xB3, 0x5A, 0x67, 0x1C, 0xBE, 0x79, 0xA6, 0x32, 0x39, 0x47, 0xB7, 0xC4, 0xD8,
-    0x33, 0x56, 0xE7, 0x5E, 0x35, 0xF9, 0x06, 0xCF, 0x9C, 0x86, 0xF8, 0xB9, 0x7D, 0x9F, 0x8E, 0xFE,
-    0x02, 0x2B, 0x21, 0xCF, 0xB0, 0xE8, 0xC0, 0xD4, 0x6F, 0x35, 0x8B, 0x5A, 0xC2, 0x70, 0xD1, 0xB3,
-    0x65, 0xA5, 0xEA, 0xE3, 0x9F, 0x4D, 0xFA, 0x93, 0x28, 0x0E, 0x9C, 0xEE, 0x50, 0x19, 0x0C, 0x7F,
-    0xAF, 0xB2, 0xDF, 0xE4, 0xEA, 0xF8, 0x11, 0x9D, 0x56, 0x38, 0x22, 0x11, 0x45, 0xAB, 0x59, 0x64,
-    0x10, 0x57, 0x42, 0x23, 0x85, 0x2E, 0x1F, 0x0C, 0xCA, 0xC4, 0xF4, 0x93, 0xE9, 0xC3, 0xF0, 0xFC,
-    0x74, 0x4B, 0xDD, 0xFD, 0xE7, 0xF7, 0xFD, 0xA8, 0x65, 0x71, 0xB2, 0x35, 0x56, 0x61, 0x48, 0x9C,
-    0x27, 0x70, 0xF0, 0xE0, 0x80, 0xBD, 0x36, 0x7A, 0xC1, 0x74, 0xCA, 0x7D, 0x89, 0x32, 0x15, 0x59,
-    0x1B, 0xB1, 0x11, 0x58, 0xA7, 0x94, 0x72, 0x96, 0xD8, 0x97, 0x00, 0xE0, 0xE6, 0xD3, 0x84, 0xF6,
-    0x3C, 0xE4, 0x2B, 0xF7, 0x6F, 0x64, 0xF9, 0x14, 0x14, 0x8F, 0x8E, 0xD5, 0x16, 0x7B, 0xC4, 0x72,
-    0x2F, 0xE7, 0xB9, 0x34, 0xCC, 0x2A, 0xB4, 0x0F, 0xEF, 0xA8, 0xA9, 0xFB, 0xD6, 0xAB, 0xF0, 0x59,
-    0x82, 0x81, 0xC6, 0x3F, 0x83, 0x3B, 0x5C, 0x30, 0x5C, 0x70, 0x5C, 0xEC, 0xE3, 0xE7, 0xDC, 0xCB,
-    0xDC, 0x09, 0x2F, 0xE6, 0x8B, 0xA4, 0xCF, 0xE1, 0xB1, 0xB2, 0x55, 0x1A, 0x3F, 0x2D, 0x51, 0x80,
-    0x3C, 0x3E, 0x4D, 0xDD, 0x9B, 0xFE, 0x0E, 0x0D, 0xCF, 0x07, 0xB0, 0x77, 0x8F, 0x77, 0x6E, 0x83,
-    0x2D, 0x4D, 0x93, 0xEE, 0x82, 0x7A, 0x80, 0x0F, 0x3D, 0xCF, 0x84, 0xA7, 0xF5, 0x04, 0x50, 0x5F,
-    0x03, 0xD5, 0xBF, 0x40, 0x27, 0x5F, 0x74, 0xF9, 0x6F, 0x68, 0xCA, 0x7F, 0xB5, 0x3F, 0xD1, 0x09,
-    0xA8, 0x35, 0x15, 0x0B, 0xA6, 0xA7, 0x31, 0x5C, 0x49, 0x14, 0x1F, 0x96, 0xD7, 0xCC, 0xC1, 0xCF,
-    0x26, 0x15, 0xB5, 0x72, 0x12, 0xE2, 0x27, 0x2C, 0xFF, 0x5D, 0x1C, 0x84, 0x08, 0x40, 0xC9, 0xD3,
-    0x9A, 0x23, 0x5A, 0x8F, 0x7D, 0xAB, 0xD5, 0xFC, 0xAD, 0x51, 0xFA, 0xEE, 0x51, 0x96, 0x27, 0xBE,
-    0x4B, 0x16, 0xE6, 0x03, 0xEC, 0x1F, 0x7F, 0x4A, 0xC4, 0xFC, 0xE6, 0xB9, 0x9B, 0x7F, 0xA9, 0xE4,
-    0x4C, 0x49, 0x90, 0xC0, 0x3A, 0x39, 0xBC, 0x18, 0xAB, 0x4F, 0xE5, 0x2B, 0x13, 0x3E, 0xEA, 0x31,
-    0x91, 0xEB, 0xC3, 0x8B, 0x26, 0x8C, 0x29, 0x7F, 0xFB, 0x88, 0xC7, 0x44, 0xFE, 0x7F, 0xB5, 0x56,
-    0x3D, 0x8C, 0xDC, 0x44, 0x18, 0x7D, 0x63, 0xE7, 0xCE, 0x68, 0xAD, 0xBB, 0xB9, 0xE2, 0x90, 0x02,
-    0x4A, 0xE2, 0x86, 0x22, 0x45, 0x12, 0x77, 0xE8, 0x8A, 0xDB, 0x9B, 0x81, 0x14, 0x14, 0x14, 0x9C,
-    0x04, 0x57, 0x21, 0x50, 0x0A, 0x0A, 0x28, 0x10, 0x57, 0x04, 0x29, 0xC5, 0xE6, 0xD6, 0x4A, 0x93,
-    0x92, 0x6B, 0xE8, 0x28, 0x56, 0x28, 0x45, 0x44, 0x43, 0x8A, 0x14, 0x57, 0x6C, 0xD8, 0x41, 0x14,
-    0x91, 0x48, 0x63, 0xA0, 0xA4, 0x31, 0x3F, 0x91, 0x20, 0x29, 0x30, 0x68, 0x0B, 0x27, 0xF2, 0xEE,
-    0xF0, 0xBE, 0xF1, 0x5E, 0x7E, 0x24, 0x90, 0x50, 0x12, 0x66, 0xD7, 0xE3, 0xB1, 0x67, 0xE6, 0xFB,
-    0xDE, 0xF7, 0xF7, 0xC6, 0xBD, 0x2F, 0x1E, 0x69, 0x23, 0x60, 0xE3, 0xD4, 0x89, 0xEB, 0x49, 0x99,
-    0x96, 0xF9, 0xF4, 0xE5, 0xCF, 0xA2, 0xE2, 0xBF, 0xFF, 0x00, 0x1C, 0x03, 0x52, 0x8B, 0xA8, 0x04,
-    0xCE, 0x1B, 0xDF, 0x7E, 0xBC, 0x73, 0xB0, 0x8B, 0x6A, 0x37, 0x2E, 0x76, 0x57, 0xB1, 0xBB, 0x8E,
-    0x5D, 0x3C, 0xF9, 0x5F, 0xDA, 0x06, 0x50, 0x21, 0x29, 0x70, 0x02, 0xA0, 0xF0, 0x33, 0x3B, 0xEF,
-    0xA4, 0x58, 0x89, 0xDC, 0x0A, 0xAE, 0xAD, 0x60, 0x7D, 0x05, 0x78, 0x9A, 0x3F, 0x86, 0xFE, 0x67,
-    0xEF, 0x6F, 0xFA, 0xF9, 0xC3, 0xC1, 0xF3, 0x3B, 0x3B, 0x3B, 0x43, 0xEF, 0xBD, 0x5C, 0xE2, 0x18,
-    0xB9, 0xDF, 0xE1, 0xFD, 0xCA, 0xA1, 0xA7, 0x26, 0xBE, 0x6B, 0xF7, 0x17, 0xCF, 0x57, 0xFF, 0x75,
-    0xE2, 0x7D, 0xF5, 0xF9, 0x54, 0xDF, 0x2A, 0x4D, 0x6E, 0xDB, 0x1B, 0xF1, 0x5F, 0xCF, 0x72, 0xF8,
-    0xE7, 0xF6, 0x92, 0x25, 0xCE, 0x1D, 0x43, 0x75, 0x7F, 0xF0, 0x9A, 0x62, 0xD1, 0x0E, 0x5F, 0x34,
-    0xE1, 0x69, 0x2D, 0x71, 0xFD, 0xB8, 0xE6, 0x8E, 0xB4, 0x32, 0x85, 0x8F, 0x5A, 0x65, 0xA1, 0xAA,
-    0xBC, 0x1C, 0x16, 0xB3, 0xB8, 0xCE, 0x6C, 0x9B, 0x94, 0x7D, 0xC5, 0x90, 0x61, 0xB9, 0xE6, 0x3B,
-    0x3E, 0xD6, 0x39, 0x9A, 0xD4, 0x0D, 0x54, 0x81, 0xA5, 0xB8, 0x1D, 0x5E, 0xAE, 0x87, 0xDC, 0x8B,
-    0x69, 0xEA, 0xFA, 0xB0, 0x58, 0x53, 0x18, 0x44, 0x55, 0x3F, 0xAA, 0x8D, 0x9A, 0x52, 0xA0, 0x76,
-    0x7B, 0x94, 0x79, 0xB6, 0xC9, 0x4A, 0x9F, 0x34, 0xB9, 0x9B, 0x2B, 0x7B, 0x04, 0xB0, 0x0A, 0xC3,
-    0xB3, 0x6D, 0xD2, 0x18, 0x67, 0x5E, 0x6D, 0xB9, 0xB7, 0xD8, 0x8B, 0xB8, 0x7B, 0x4B, 0x84, 0x52,
-    0x4E, 0xC2, 0x11, 0xA5, 0x50, 0x5B, 0x66, 0x27, 0x5C, 0x36, 0xE5, 0xB2, 0x88, 0x4A, 0x8D, 0x1D,
-    0xC7, 0xB5, 0x2E, 0x2E, 0x46, 0xEC, 0x06, 0x51, 0xBD, 0x8C, 0x93, 0x58, 0xC2, 0x9A, 0xAE, 0xCD,
-    0x6B, 0x4D, 0xFE, 0x5D, 0xAB, 0xAB, 0x61, 0x3C, 0xD5, 0xEE, 0x2B, 0x99, 0xA5, 0x76, 0x11, 0x47,
-    0x49, 0x47, 0xB0, 0x16, 0x0C, 0xD4, 0x84, 0x6F, 0x78, 0x6F, 0x81, 0xB8, 0xE2, 0xA3, 0x85, 0x1D,
-    0x2C, 0x69, 0xEF, 0x5B, 0xFA, 0xA1, 0xBE, 0xDD, 0x7F, 0xD1, 0xA2, 0xE6, 0x8C, 0x03, 0x32, 0x2E,
-    0x1A, 0x3F, 0x58, 0x84, 0x8B, 0x40, 0xC4, 0x19, 0xCD, 0x99, 0x2D, 0x0E, 0xE9, 0xAD, 0xE5, 0xE2,
-    0xD0, 0x85, 0xB3, 0x4E, 0x5E, 0xB8, 0xC4, 0x8D, 0x53, 0x28, 0x55, 0xAF, 0x8B, 0x50, 0xB9, 0x56,
-    0xDF, 0xFC, 0xEE, 0x0A, 0x62, 0xAA, 0x4D, 0xCB, 0x4E, 0xBD, 0xC8, 0x90, 0x2B, 0xA3, 0x8F, 0x32,
-    0xD8, 0xC9, 0x64, 0xE2, 0xE8, 0x7F, 0xF7, 0x7B, 0xFF, 0xED, 0x02, 0x7D, 0x6E, 0x1F, 0x74, 0x9A,
-    0x45, 0x9C, 0x12, 0x91, 0x57, 0xA8, 0x6F, 0x3F, 0x6B, 0x4D, 0xF7, 0x9B, 0xA6, 0xFB, 0x27, 0x69,
-    0x42, 0x01, 0xD3, 0x30, 0x76, 0x85, 0xF1, 0x8D, 0xF1, 0x73, 0xE3, 0x67, 0xC6, 0x97, 0x66, 0x06,
-    0x53, 0xE2, 0x74, 0xC0, 0x94, 0xE7, 0x7E, 0x3E, 0x5B, 0x0F, 0xC3, 0x16, 0x63, 0xE3, 0xF2, 0x1F,
-    0xDA, 0xB8, 0x35, 0xD6, 0x14, 0x34, 0x78, 0x01, 0x7B, 0x2C, 0x16, 0xA5, 0xB7, 0xA6, 0xC8, 0x4B,
-    0x4C, 0x86, 0x25, 0xBC, 0x8D, 0x67, 0x73, 0xC4, 0x0D, 0xD2, 0x6A, 0x1B, 0x0C, 0xFC, 0x12, 0x21,
-    0xFE, 0x38, 0xF7, 0xC3, 0xC7, 0xAB, 0x75, 0x23, 0x6B, 0xCF, 0x2F, 0xFD, 0x6F, 0xD5, 0x3A, 0x3D,
-    0x76, 0x66, 0x7B, 0xE5, 0x19, 0x56, 0x2B, 0xB6, 0xE9, 0xE6, 0xA4, 0xC5, 0x9D, 0xDD, 0x8D, 0xCF,
-    0xBF, 0xED, 0xF5, 0xEC, 0x68, 0xAD, 0x07, 0x8C, 0xF0, 0x44, 0x1D, 0xDB, 0xA8, 0x44, 0x7C, 0xB3,
-    0x80, 0x5E, 0x05, 0x36, 0x37, 0x26, 0xBE, 0xBE, 0xBB, 0xF3, 0xE1, 0xA9, 0x51, 0xF2, 0x7A, 0x4F,
-    0x7D, 0xEF, 0x46, 0xE7, 0xAF, 0xF5, 0x8E, 0x1C, 0xE1, 0xCA, 0xB0, 0xF4, 0x29, 0x6F, 0xA1, 0xED,
-    0x8E, 0x70, 0x7A, 0x13, 0xE9, 0x1B, 0x88, 0xBE, 0x71, 0xB8, 0xE6, 0xFD, 0x2F, 0x97, 0x3F, 0x7D,
-    0x77, 0xF5, 0x38, 0x46, 0x1B, 0xE7, 0x7B, 0xF8, 0xA9, 0x1C, 0x29, 0xF5, 0x0C, 0x14, 0x3D, 0xAA,
-    0x0F, 0x5D, 0xBA, 0xA4, 0xBF, 0x76, 0x19, 0xCF, 0xE8, 0xFB, 0x22, 0x24, 0x2A, 0x47, 0x97, 0x98,
-    0x29, 0x61, 0xC4, 0x9A, 0x42, 0x52, 0x86, 0x75, 0x4E, 0x17, 0x52, 0x1D, 0xAC, 0x91, 0x32, 0xAE,
-    0xA4, 0x38, 0x98, 0xAF, 0x35, 0x1A, 0x55, 0x2F, 0xB2, 0xAB, 0x8F, 0x8E, 0x64, 0x72, 0xD6, 0x52,
-    0xC7, 0x2E, 0xB2, 0x65, 0x8C, 0xB7, 0x80, 0xE7, 0xA3, 0x3A, 0x71, 0x83, 0xC8, 0x3B, 0x4C, 0xEA,
-    0x3D, 0x92, 0x4A, 0x7C, 0xBF, 0xC5, 0x7C, 0x92, 0xFA, 0xF2, 0x8C, 0xD0, 0xCC, 0x38, 0x29, 0x27,
-    0x45, 0xA6, 0xEA, 0xB8, 0x1A, 0xC8, 0x46, 0x6D, 0x1B, 0x34, 0x5B, 0x52, 0x76, 0xA2, 0x7C, 0x4B,
-    0x5B, 0x5D, 0x50, 0x52, 0x06, 0xFD, 0x9A, 0xA3, 0xFE, 0xC4, 0xA5, 0x2E, 0xFE, 0xBE, 0xA6, 0xAE,
-    0xB8, 0x8C, 0xEA, 0xA8, 0x1E, 0x53, 0x73, 0x5C, 0xB3, 0x9B, 0xE6, 0x44, 0x40, 0x58, 0x19, 0x48,
-    0x5B, 0x06, 0x8A, 0x0B, 0x82, 0x96, 0x50, 0xA3, 0xC3, 0x06, 0xD9, 0x3C, 0x94, 0x9A, 0xDA, 0x86,
-    0x20, 0x7A, 0xA4, 0xED, 0xA7, 0xA5, 0x79, 0x65, 0x41, 0x23, 0xC5, 0x58, 0x05, 0xB3, 0xF7, 0x7B,
-    0xB8, 0x11, 0x57, 0x24, 0xA9, 0xCC, 0xCD, 0x39, 0x43, 0x0E, 0x3A, 0x3B, 0xCD, 0x5C, 0xA3, 0xDD,
-    0x38, 0x2E, 0x8F, 0xA1, 0xC2, 0x62, 0xCD, 0xB9, 0x48, 0xB6, 0xC4, 0xD3, 0xDC, 0xCD, 0xB8, 0xE4,
-    0x52, 0x27, 0x24, 0x0B, 0x0F, 0x94, 0x58, 0x6E, 0xD1, 0x3A, 0x4E, 0x97, 0x39, 0x58, 0x3C, 0xC7,
-    0x3A, 0x6D, 0x47, 0xC9, 0x53, 0x55, 0xE6, 0x4C, 0x31, 0x24, 0x8F, 0xB4, 0xAA, 0x8E, 0xA8, 0xEF,
-    0x28, 0xCE, 0xD1, 0x40, 0x3B, 0x17, 0xB2, 0xCB, 0x4A, 0x53, 0xCC, 0x15, 0xC9, 0x51, 0x97, 0x79,
-    0x61, 0x64, 0x45, 0x5C, 0xA6, 0x08, 0x9B, 0xB9, 0x4C, 0x15, 0x39, 0x2E, 0xAA, 0x46, 0x57, 0xB9,
-    0x1B, 0x2A, 0x32, 0xA4, 0x96, 0xD5, 0xB2, 0x4D, 0x3B, 0x63, 0x67, 0x51, 0x13, 0x06, 0x18, 0xCB,
-    0x26, 0x5D, 0x9C, 0x62, 0xC5, 0x95, 0x9D, 0xD6, 0x65, 0x1A, 0x2E, 0x6E, 0xA8, 0x90, 0x7D, 0x52,
-    0x24, 0xD5, 0x16, 0x1F, 0x9A, 0x33, 0xC2, 0x52, 0x8A, 0xD1, 0x4D, 0x2B, 0x1D, 0x7E, 0x69, 0x1D,
-    0xB5, 0x30, 0x96, 0xDE, 0xDC, 0x92, 0xA9, 0x35, 0x4E, 0xD2, 0xA5, 0x74, 0x24, 0x99, 0xCC, 0x58,
-    0xCE, 0x65, 0x8E, 0x6C, 0x41, 0xD2, 0xB1, 0x5A, 0x22, 0xB1, 0xBE, 0xF0, 0x9F, 0x60, 0x93, 0x94,
-    0xB5, 0x51, 0xB5, 0x89, 0x26, 0xAA, 0x62, 0x42, 0xAB, 0x30, 0x48, 0x5F, 0xA9, 0x19, 0x2C, 0xC9,
-    0x8E, 0x0B, 0xC2, 0xB1, 0x49, 0xC1, 0xCE, 0x1E, 0xB0, 0x6B, 0x53, 0xC6, 0xDC, 0x90, 0xF3, 0xAB,
-    0xB4, 0xF0, 0x96, 0x2F, 0xAE, 0x4B, 0xDE, 0x5C, 0xD7, 0xEC, 0x0E, 0x64, 0xE5, 0x01, 0x38, 0xBC,
-    0xA0, 0x39, 0x73, 0x81, 0xEE, 0x60, 0xCC, 0x98, 0x62, 0x9B, 0x9C, 0x3C, 0x21, 0x8A, 0xBA, 0xF0,
-    0x40, 0xF8, 0x6A, 0x9B, 0xC4, 0xAE, 0x05, 0xD1, 0x5C, 0x6E, 0x53, 0x0C, 0x89, 0x8F, 0x44, 0xFD,
-    0x55, 0xF7, 0x24, 0x73, 0x8C, 0xFC, 0x16, 0xED, 0xA3, 0x05, 0xB9, 0xA4, 0xF3, 0x98, 0x37, 0xE2,
-    0x6E, 0x98, 0x61, 0x34, 0x6F, 0x93, 0x6A, 0x88, 0x6E, 0x40, 0x64, 0x84, 0x7B, 0x5C, 0x18, 0x69,
-    0x44, 0x17, 0x3F, 0x6C, 0x2F, 0x60, 0x59, 0x8C, 0x9E, 0x40, 0xD7, 0xB1, 0xF8, 0x45, 0x8B, 0x4B,
-    0x78, 0x88, 0xF9, 0xC5, 0xD9, 0x7F, 0x9B, 0xC7, 0xEB, 0xF6, 0xF0, 0xDE, 0x64, 0x3E, 0x94, 0x03,
-    0x01, 0x2F, 0x49, 0x77, 0x11, 0x8B, 0x73, 0x21, 0xD4, 0x47, 0x28, 0x1C, 0x2D, 0xE7, 0x86, 0xC1,
-    0x82, 0xE4, 0x95, 0xD8, 0x1A, 0xCA, 0x28, 0xD4, 0x97, 0x9C, 0x3A, 0xE1, 0x10, 0x08, 0x15, 0xD3,
-    0x6D, 0x92, 0xF7, 0xA1, 0x20, 0xFF, 0x61, 0x53, 0x28, 0xCF, 0x5C, 0x26, 0xF7, 0xB0, 0x38, 0x3A,
-    0x16, 0xED, 0x03, 0xE0, 0x45, 0xAB, 0x7C, 0x0D, 0xA2, 0xF1, 0x9E, 0x47, 0x85, 0x33, 0x5F, 0x56,
-    0xFA, 0x6E, 0xFB, 0x1C, 0xDA, 0x88, 0xDE, 0xA6, 0xE9, 0x22, 0x99, 0x4A, 0x69, 0xB3, 0x88, 0x6A,
-    0xA4, 0x6A, 0xE4, 0x4C, 0xA0, 0xEC, 0x1B, 0x88, 0x1F, 0xF4, 0xB3, 0xF0, 0xBE, 0xEB, 0x6F, 0xC8,
-    0x62, 0x81, 0xB7, 0x37, 0x42, 0xF6, 0x1B, 0x32, 0xEE, 0xF1, 0xE1, 0x2C, 0xDC, 0x7B, 0xAC, 0x80,
-    0xD0, 0xE3, 0x57, 0xC3, 0x3E, 0xD2, 0x1A, 0x74, 0x17, 0xE3, 0x01, 0x1F, 0xCE, 0x48, 0x63, 0x25,
-    0x45, 0x14, 0x0E, 0x03, 0xB6, 0xBC, 0x4F, 0xD7, 0x24, 0xE4, 0x80, 0xBC, 0x20, 0x40, 0x16, 0xDB,
-    0xDD, 0x86, 0x31, 0x2B, 0xB4, 0x4B, 0x2B, 0x01, 0x32, 0x0B, 0x7C, 0xE1, 0x04, 0x59, 0x23, 0xB6,
-    0xF3, 0xB8, 0x4C, 0x59, 0xE1, 0x02, 0x2A, 0x0F, 0x80, 0x2A, 0x71, 0x48, 0x5F, 0x5C, 0x10, 0x87,
-    0xB4, 0xDA, 0x44, 0x76, 0x55, 0x82, 0x47, 0xD6, 0xBA, 0xC0, 0x33, 0x4C, 0x72, 0xFC, 0x91, 0xC6,
-    0x53, 0xF4, 0x3D, 0xE4, 0x54, 0x26, 0x19, 0x12, 0xE2, 0xC7, 0x3F, 0xB3, 0x46, 0x8E, 0x43, 0x15,
-    0xE8, 0xCE, 0x80, 0x88, 0xE2, 0x46, 0x7C, 0xA6, 0x9D, 0x16, 0xCF, 0x81, 0x2E, 0xA3, 0x79, 0x84,
-    0x24, 0x38, 0xF2, 0x10, 0x80, 0xB1, 0xA0, 0x89, 0xAB, 0x24, 0x7C, 0x47, 0x10, 0x08, 0xFD, 0x35,
-    0x16, 0xDB, 0x08, 0x87, 0xC8, 0x18, 0x27, 0x23, 0x48, 0xE8, 0x2D, 0x25, 0xD4, 0x23, 0x59, 0x44,
-    0x67, 0x1D, 0x87, 0xA0, 0x1A, 0x05, 0x5F, 0x3D, 0x96, 0x51, 0x84, 0x45, 0x1F, 0xD1, 0x53, 0xBA,
-    0x0E, 0x67, 0xBA, 0x15, 0xB3, 0xD7, 0x16, 0x80, 0xA4, 0x4E, 0xEF, 0x41, 0xD1, 0x3B, 0x36, 0x4B,
-    0x6F, 0xFB, 0xBB, 0xCD, 0x26, 0x3E, 0xF2, 0xC5, 0x36, 0x96, 0x47, 0x0B, 0xB2, 0xB1, 0xB9, 0xE5,
-    0x97, 0xD2, 0x5E, 0xE0, 0x9B, 0x94, 0x54, 0xC3, 0xEF, 0xAA, 0x59, 0xA0, 0x9C, 0xFC, 0x6B, 0xB2,
-    0x0D, 0xEF, 0x81, 0x75, 0xF6, 0x48, 0x5C, 0xAA, 0xA3, 0xAA, 0x5C, 0x4D, 0x13, 0x6C, 0x28, 0xB7,
-    0x7A, 0x88, 0xE0, 0x6F, 0x4D, 0x53, 0x3D, 0x6F, 0x14, 0x31, 0x14, 0x1C, 0xDB, 0x24, 0x96, 0xD8,
-    0xC2, 0x34, 0x48, 0x88, 0x14, 0x5B, 0xF3, 0x21, 0x96, 0x1F, 0x90, 0xBB, 0x35, 0x50, 0xD2, 0xA4,
-    0x39, 0x85, 0xBF, 0x40, 0x95, 0x86, 0x82, 0xE2, 0x2E, 0xB1, 0x48, 0x41, 0x41, 0x73, 0x1D, 0x25,
-    0xA9, 0x69, 0xF8, 0x03, 0x87, 0xD6, 0x4A, 0xFE, 0xC0, 0x26, 0x2D, 0x05, 0x2E, 0x90, 0x90, 0xA0,
-    0x88, 0x05, 0x0E, 0xDA, 0xA0, 0xCD, 0x3D, 0x9E, 0xF7, 0x20, 0x61, 0xE5, 0x66, 0xED, 0xF7, 0x3C,
-    0x33, 0x6F, 0xC6, 0x00, 0x50, 0x5C, 0xC0, 0x50, 0x6B, 0x8E, 0xFB, 0xC2, 0x57, 0xAA, 0xD5, 0x87,
-    0x51, 0xC4, 0x0E, 0x8B, 0x11, 0xAA, 0x12, 0xE6, 0xB5, 0xD7, 0x27, 0x51, 0xC5, 0x99, 0x48, 0xE6,
-    0xA4, 0x93, 0xD4, 0xA1, 0x4A, 0xB8, 0xFA, 0x3A, 0xA0, 0x76, 0x30, 0x09, 0xEA, 0x14, 0x38, 0x8B,
-    0x18, 0x3D, 0x80, 0xD9, 0x6F, 0x55, 0x18, 0xA1, 0xD3, 0xBE, 0x7E, 0xBF, 0xDC, 0x27, 0xEA, 0xD7,
-    0x26, 0xE7, 0x80, 0x01, 0x44, 0x04, 0x6E, 0x73, 0x3D, 0xD9, 0x92, 0x7C, 0xF1, 0xED, 0x40, 0xB5,
-    0xC3, 0x56, 0xD3, 0xE2, 0xDE, 0x92, 0x0B, 0xDA, 0xE1, 0xB6, 0x31, 0x50, 0x5A, 0x18, 0x8F, 0x1D,
-    0x5F, 0x92, 0x53, 0x4B, 0x7B, 0x09, 0xD5, 0x78, 0x49, 0x07, 0xAA, 0x83, 0x62, 0xB0, 0x08, 0xF1,
-    0x6B, 0x0E, 0x22, 0xCC, 0xB6, 0x63, 0x85, 0x59, 0xE1, 0xCC, 0x93, 0xA0, 0xDA, 0x85, 0x8C, 0xE5,
-    0xAB, 0x34, 0x70, 0xFC, 0x32, 0xB4, 0x94, 0xD4, 0xD5, 0xD4, 0x8F, 0x26, 0xDD, 0x4B, 0x19, 0x1F,
-    0x6A, 0x0F, 0x63, 0xF3, 0xFD, 0x8B, 0x0C, 0xAB, 0x02, 0x0A, 0xDE, 0x70, 0xA8, 0x06, 0xCC, 0xFB,
-    0x97, 0x30, 0x7A, 0x09, 0x73, 0x1A, 0x8C, 0x5B, 0x28, 0x5F, 0x21, 0x19, 0x57, 0x1B, 0xAF, 0xC8,
-    0x09, 0xF2, 0x32, 0xF4, 0x32, 0x1A, 0x97, 0x54, 0x64, 0x71, 0x7C, 0x2E, 0xE9, 0x02, 0x65, 0x77,
-    0xD5, 0x47, 0x28, 0x28, 0xEA, 0xB0, 0xAB, 0x42, 0xE1, 0x93, 0xE0, 0xA2, 0x85, 0x71, 0x95, 0x3C,
-    0xDF, 0x71, 0x15, 0x79, 0x6C, 0x87, 0x4C, 0x5A, 0x47, 0x6C, 0x44, 0xD9, 0x04, 0x34, 0x6E, 0xE8,
-    0xD9, 0xF0, 0x7D, 0x71, 0x46, 0x76, 0xF4, 0xB5, 0x35, 0x6D, 0xD2, 0x61, 0x2A, 0x59, 0x4C, 0x67,
-    0xEC, 0xA6, 0xF2, 0xA5, 0xF8, 0xF9, 0xD4, 0xED, 0x1D, 0xB5, 0xE5, 0x50, 0xB8, 0x3E, 0x67, 0x29,
-    0x28, 0x4F, 0x43, 0xE9, 0x7A, 0xE3, 0x2B, 0xDD, 0xEA, 0xA3, 0x95, 0x45, 0x33, 0xD4, 0x6C, 0xD1,
-    0x1B, 0xCF, 0x96, 0xA9, 0xB0, 0xCB, 0xF4, 0xBE, 0x27, 0x41, 0x09, 0xD7, 0xE7, 0x3C, 0x6D, 0xBB,
-    0xDE, 0x6B, 0x72, 0xB7, 0x13, 0x4A, 0xC8, 0x88, 0x3A, 0x2B, 0x9E, 0x65, 0xCD, 0x8B, 0xAC, 0x3A,
-    0xA1, 0x09, 0x35, 0x3D, 0x9A, 0x6C, 0x61, 0x7D, 0x0B, 0x15, 0xA1, 0xE6, 0xBB, 0x6D, 0x5F, 0xD8,
-    0x0A, 0x96, 0x4F, 0xB9, 0xAA, 0x68, 0xF3, 0x62, 0x53, 0xD8, 0x0A, 0x26, 0x51, 0x59, 0xAE, 0xA2,
-    0x82, 0xC8, 0x4D, 0x26, 0xCC, 0xC7, 0xA2, 0x49, 0xF2, 0x77, 0xAF, 0xFC, 0x54, 0x62, 0x9A, 0x7D,
-    0xD3, 0xAC, 0xC9, 0x0B, 0x8A, 0x90, 0x09, 0x22, 0x65, 0x40, 0x1D, 0x6E, 0x36, 0x7E, 0x6F, 0x89,
-    0xBB, 0xCC, 0x05, 0x02, 0x90, 0x3C, 0xAA, 0xC6, 0xA2, 0xE4, 0x93, 0xCF, 0x10, 0x3F, 0x22, 0xA6,
-    0x63, 0x94, 0x1C, 0x36, 0xBF, 0x29, 0x12, 0x47, 0x85, 0xE8, 0x90, 0xD8, 0x38, 0x26, 0xF6, 0x2F,
-    0x2A, 0xD7, 0xFE, 0x5A, 0xD8, 0xF2, 0x58, 0x99, 0x3B, 0x78, 0x6B, 0x06, 0x54, 0x1D, 0xC4, 0x9E,
-    0xCF, 0x30, 0xD9, 0x36, 0x36, 0x34, 0x73, 0x0D, 0x6B, 0x1F, 0x82, 0xA6, 0x16, 0xCF, 0x73, 0xC7,
-    0x33, 0x48, 0xF2, 0xFA, 0x02, 0x45, 0xE6, 0x00, 0x0E, 0x99, 0xE4, 0x89, 0x30, 0xF1, 0x61, 0xBA,
-    0x23, 0xE3, 0xCC, 0xE3, 0xA8, 0xFD, 0x42, 0x45, 0xF3, 0x29, 0x66, 0xC2, 0xEB, 0x99, 0x1F, 0x8B,
-    0xEB, 0x39, 0x29, 0x9B, 0x48, 0x2F, 0x54, 0xB8, 0x51, 0x0C, 0xA9, 0x98, 0x65, 0x5D, 0x59, 0xC8,
-    0x6A, 0x06, 0x96, 0x47, 0x88, 0x11, 0x70, 0xEB, 0xCA, 0x8F, 0xB7, 0xD1, 0xD8, 0x55, 0x4C, 0x4A,
-    0x5B, 0xBD, 0xB3, 0x8A, 0xF8, 0x15, 0x70, 0x0C, 0x3F, 0xAA, 0x60, 0x7C, 0x5C, 0xC5, 0xE4, 0xB8,
-    0x17, 0xAC, 0x2A, 0x63, 0x88, 0x39, 0xE7, 0xC3, 0xB1, 0x41, 0x85, 0x1F, 0xFF, 0x17, 0x11, 0x3F,
-    0x16, 0x34, 0x3C, 0x88, 0x8C, 0xC3, 0x7C, 0x8B, 0x80, 0x9D, 0xA0, 0xF8, 0xF7, 0x0E, 0xF0, 0x07,
-    0x55, 0x52, 0x31, 0x4E, 0xC3, 0x40, 0x10, 0x9C, 0xB3, 0x01, 0x4B, 0xB8, 0x70, 0x03, 0x55, 0x84,
-    0xC2, 0x0F, 0xFC, 0x82, 0x60, 0x7F, 0x00, 0x89, 0x02, 0xA7, 0xA0, 0xA1, 0x43, 0x74, 0xFC, 0x80,
-    0xF8, 0x09, 0x3C, 0x22, 0x55, 0x28, 0xF2, 0x82, 0xC4, 0x7E, 0x82, 0x9F, 0x90, 0x82, 0x8A, 0xEA,
-    0x0A, 0x17, 0x8E, 0x65, 0x7B, 0x99, 0xBD, 0x83, 0x48, 0x5C, 0x71, 0x1E, 0xEF, 0xDD, 0xCE, 0xEE,
-    0xCE, 0x1C, 0xAE, 0x8B, 0xA2, 0x40, 0x22, 0x22, 0xB5, 0xA9, 0x44, 0x2C, 0x22, 0x8B, 0x0E, 0x41,
-    0x87, 0x05, 0xB0, 0x43, 0x02, 0x64, 0x30, 0x40, 0x52, 0x03, 0x88, 0x0E, 0xDC, 0x78, 0xC2, 0x25,
-    0x32, 0xF0, 0x44, 0xC6, 0x7F, 0x27, 0x2D, 0xB7, 0xB3, 0xF1, 0x11, 0xCA, 0x06, 0x98, 0xED, 0x77,
-    0x0E, 0xC4, 0xA7, 0x13, 0xF0, 0x32, 0x62, 0x4D, 0x89, 0x44, 0x72, 0x0D, 0x60, 0xA6, 0x5C, 0xA9,
-    0x90, 0x21, 0xFB, 0xEC, 0xB4, 0xD2, 0x8A, 0xBF, 0x39, 0x19, 0x93, 0x3A, 0x6C, 0x10, 0x37, 0xC8,
-    0x11, 0x5A, 0xBD, 0x38, 0x28, 0xF3, 0x1E, 0x0F, 0xCC, 0x67, 0xE1, 0x40, 0x64, 0x82, 0xF6, 0x09,
-    0xBC, 0x8C, 0xCB, 0x92, 0x7D, 0xB0, 0xED, 0xCB, 0x6A, 0xB3, 0x06, 0xE6, 0xA5, 0x16, 0x69, 0xB8,
-    0xB9, 0x44, 0xC3, 0xC2, 0x79, 0x36, 0x6D, 0xAA, 0x56, 0x07, 0x1C, 0xC2, 0xF1, 0x89, 0xF5, 0xD7,
-    0xAE, 0xF6, 0xC5, 0xF6, 0x08, 0xBF, 0x56, 0x22, 0x07, 0x8F, 0xE4, 0xF8, 0xDC, 0x79, 0x14, 0xB4,
-    0x66, 0xF0, 0x88, 0x3C, 0xD3, 0x09, 0xED, 0x3D, 0xE2, 0xB8, 0x7B, 0xB8, 0xC6, 0x38, 0xDE, 0x2E,
-    0x70, 0x28, 0x69, 0x30, 0x84, 0x8E, 0x27, 0xA9, 0x83, 0x6E, 0xD6, 0x97, 0xF1, 0x40, 0x14, 0x5B,
-    0x91, 0x66, 0x35, 0xB1, 0xAF, 0xAA, 0xA6, 0x1E, 0xED, 0x0D, 0xC7, 0x9D, 0x18, 0x37, 0x56, 0xE5,
-    0xFB, 0x40, 0x52, 0xAA, 0x36, 0x99, 0x66, 0xE5, 0x2A, 0x10, 0x05, 0xC0, 0x9C, 0x9F, 0xD2, 0x95,
-    0x4A, 0xF9, 0x63, 0xE9, 0x82, 0xBB, 0x11, 0xB6, 0x4E, 0x86, 0x3B, 0xBA, 0xD1, 0x39, 0xB4, 0x88,
-    0xEE, 0xD1, 0x05, 0x8A, 0xDE, 0xDF, 0xD2, 0xDC, 0xA6, 0xA2, 0x9C, 0xE3, 0x5C, 0x9A, 0x4A, 0x51,
-    0x7A, 0x88, 0x7E, 0xFB, 0xFE, 0x5B, 0xB3, 0x5E, 0xFD, 0xA0, 0xCF, 0x30, 0xD2, 0xD3, 0xA0, 0xF9,
-    0x17, 0x69, 0xCC, 0x08, 0x4A, 0xAD, 0x92, 0x3B, 0x83, 0x6E, 0xBD, 0x95, 0x74, 0x41, 0x1B, 0x71,
-    0x2E, 0xBB, 0x47, 0xE1, 0x03, 0xE7, 0x53, 0xF1, 0xFA, 0x1B, 0x08, 0xB6, 0xFD, 0x86, 0xA1, 0xCC,
-    0x19, 0xE9, 0x64, 0xF1, 0x82, 0x85, 0x4E, 0xC0, 0x98, 0x2F, 0x88, 0x94, 0xD3, 0x52, 0xDC, 0x63,
-    0xB0, 0xEA, 0xB9, 0xDA, 0x8F, 0x2B, 0xE0, 0x07, 0x8D, 0x53, 0xB1, 0x8E, 0xD3, 0x40, 0x10, 0x9D,
-    0xB3, 0x41, 0x3E, 0xC9, 0x20, 0x53, 0x50, 0x50, 0x80, 0x7C, 0x05, 0x2D, 0xF6, 0x17, 0x24, 0x67,
-    0x1D, 0x12, 0x11, 0xA2, 0xA0, 0xC1, 0x50, 0x5C, 0xC3, 0x0F, 0xA0, 0x93, 0x50, 0xCA, 0x38, 0x59,
-    0xC4, 0x07, 0xA4, 0xA2, 0xBE, 0x8A, 0x82, 0x4D, 0x71, 0x0D, 0x45, 0x90, 0xE2, 0xD8, 0xA2, 0x4D,
-    0xE3, 0xD0, 0x50, 0x5C, 0x11, 0x53, 0xD0, 0x50, 0x10, 0x17, 0x96, 0xCE, 0x17, 0x92, 0x2C, 0x6F,
-    0x36, 0xF1, 0x9D, 0x28, 0x38, 0x18, 0x7B, 0xC7, 0x3B, 0xE3, 0x9D, 0x99, 0xB7, 0x6F, 0x76, 0xE9,
-    0x16, 0x11, 0xED, 0x14, 0x50, 0x6E, 0x80, 0x49, 0x59, 0x4F, 0xCE, 0x9F, 0x4B, 0x79, 0xA2, 0x20,
-    0x33, 0x29, 0x07, 0x6B, 0x76, 0x91, 0x7F, 0xA9, 0x30, 0xE8, 0x3E, 0xAB, 0x7B, 0x58, 0x9E, 0x91,
-    0xBB, 0x22, 0x57, 0x65, 0xEE, 0xAB, 0xC8, 0x7F, 0xD2, 0xFA, 0x7A, 0x90, 0xB7, 0x69, 0x48, 0xE4,
-    0x11, 0xD9, 0x82, 0x8C, 0x9C, 0xAE, 0x30, 0x2A, 0x6D, 0x40, 0x18, 0x84, 0x99, 0x41, 0x59, 0x97,
-    0xEA, 0x8B, 0x94, 0xEF, 0x0F, 0x67, 0x0C, 0x61, 0xBE, 0x90, 0x32, 0xAE, 0xFD, 0x5D, 0x9E, 0x20,
-    0x96, 0x9A, 0x1C, 0xF8, 0x52, 0x67, 0x70, 0xFE, 0x55, 0xA8, 0x36, 0xCC, 0x83, 0xFC, 0x75, 0xF9,
-    0xB1, 0xEB, 0x3F, 0xE8, 0x1A, 0xBF, 0xC6, 0xE4, 0xAF, 0xC9, 0x58, 0xE9, 0x3D, 0xD0, 0x2E, 0x1E,
-    0xA4, 0xC1, 0x72, 0x3B, 0x05, 0x2C, 0x28, 0x18, 0x29, 0x10, 0xDA, 0xDF, 0xC3, 0xF0, 0xE8, 0x2D,
-    0xA3, 0x28, 0xD6, 0x52, 0xCA, 0xCA, 0x81, 0x73, 0x89, 0x07, 0x2F, 0xA6, 0x4B, 0xDE, 0xC3, 0x68,
-    0x1B, 0xCE, 0xC2, 0x09, 0x10, 0xAE, 0x84, 0xFD, 0xB3, 0x72, 0x26, 0xFD, 0xC9, 0xE7, 0xBC, 0x4A,
-    0x87, 0x37, 0xFE, 0x02, 0x4B, 0x0C, 0x77, 0x47, 0x9E, 0xD3, 0x9F, 0xF4, 0xD3, 0xF5, 0x3C, 0x75,
-    0x54, 0x4A, 0x78, 0x39, 0x3F, 0x28, 0xB6, 0x30, 0x12, 0xC1, 0x89, 0x68, 0x3C, 0x17, 0xF6, 0xE9,
-    0xB1, 0x88, 0x3D, 0x57, 0x64, 0xC3, 0xBB, 0x3A, 0x09, 0xC2, 0x35, 0x71, 0x48, 0x06, 0xF3, 0xA6,
-    0xFD, 0x26, 0xE5, 0xBF, 0xF1, 0xA7, 0x8A, 0x12, 0x04, 0xF4, 0xD0, 0xC4, 0x5E, 0xC0, 0x7F, 0x5D,
-    0xA5, 0x56, 0x3D, 0xA5, 0xCA, 0x0B, 0x6C, 0x66, 0xC1, 0xC0, 0x69, 0x9F, 0xB8, 0xCE, 0xD6, 0xF0,
-    0x68, 0xCF, 0x16, 0xBE, 0x91, 0xFB, 0xC1, 0xD0, 0x0F, 0x3C, 0x37, 0xB0, 0x8F, 0xDF, 0xBD, 0x98,
-    0x2B, 0x75, 0xBE, 0x90, 0x1F, 0xD0, 0x6C, 0xA3, 0xD4, 0x3D, 0x37, 0xB0, 0x76, 0x4F, 0x17, 0xFC,
-    0x23, 0xB6, 0xA9, 0xB9, 0x37, 0xB9, 0x95, 0x06, 0x79, 0x66, 0x6E, 0x8B, 0xAE, 0x91, 0x5B, 0xD9,
-    0x90, 0x22, 0x3F, 0x3C, 0x3C, 0x45, 0x75, 0x29, 0x41, 0x70, 0xA4, 0xBB, 0xD6, 0xD5, 0xCB, 0x0D,
-    0x0D, 0x85, 0xD3, 0x31, 0xC9, 0x02, 0x47, 0x09, 0x9F, 0x11, 0xC5, 0x70, 0xD9, 0x19, 0xE6, 0x20,
-    0xD3, 0xB7, 0xC0, 0xF9, 0x68, 0x9F, 0x29, 0x1F, 0x83, 0xF2, 0x60, 0xC4, 0x11, 0x5A, 0x2D, 0x2F,
-    0x94, 0xA0, 0x5A, 0xDA, 0xF5, 0xC1, 0x88, 0x78, 0xB2, 0x50, 0x6A, 0x89, 0x1D, 0xAB, 0xB3, 0x1F,
-    0x88, 0x64, 0x0F, 0x45, 0x61, 0x18, 0x3E, 0x63, 0x57, 0x91, 0x40, 0xA5, 0x3A, 0x0F, 0x1F, 0x26,
-    0xDE, 0x8B, 0xA6, 0x7A, 0x43, 0x36, 0x08, 0xB3, 0xE6, 0x01, 0x45, 0x6E, 0x60, 0x95, 0xBD, 0xA0,
-    0x37, 0x55, 0xAD, 0x59, 0x6B, 0xF6, 0xB8, 0xE1, 0xDE, 0xA1, 0xB2, 0x43, 0xE6, 0xB4, 0x20, 0xA7,
-    0x95, 0x52, 0xC3, 0xA5, 0x2B, 0xCC, 0xAD, 0x70, 0x36, 0x7D, 0x87, 0xA0, 0x94, 0x5A, 0x27, 0x0F,
-    0xF9, 0xF0, 0x3C, 0x02, 0x9C, 0x13, 0xED, 0x03, 0x9C, 0xF0, 0x8C, 0x5D, 0x4F, 0x31, 0x70, 0x01,
-    0x98, 0x40, 0xDA, 0xA9, 0x36, 0xFD, 0x21, 0xBA, 0x46, 0xF4, 0xDF, 0x15, 0xAF, 0x37, 0xDC, 0xDB,
-    0x9D, 0xB2, 0x53, 0x26, 0x53, 0x25, 0x92, 0x56, 0x45, 0xB1, 0x2B, 0x28, 0xAE, 0x36, 0xCD, 0x6F,
-    0xD7, 0x70, 0xCC, 0xD4, 0x81, 0x2A, 0xD0, 0x30, 0xB4, 0xC9, 0x27, 0x73, 0x21, 0x07, 0x85, 0xC9,
-    0xF5, 0x0D, 0xDC, 0xAA, 0xC1, 0x37, 0x6E, 0x44, 0xA3, 0x09, 0x4C, 0x47, 0xDA, 0x49, 0x4C, 0xFB,
-    0x66, 0x25, 0xBA, 0xE5, 0x6F, 0xC3, 0xB5, 0xFC, 0x06, 0xCD, 0x58, 0xBF, 0x6F, 0xDD, 0xD6, 0x15,
-    0x3E, 0x24, 0xAD, 0xD0, 0x28, 0x07, 0x7A, 0x88, 0x81, 0xC2, 0x45, 0xCD, 0x8E, 0x4D, 0x01, 0x87,
-    0x7B, 0x21, 0x3D, 0xD2, 0x31, 0x8A, 0x0E, 0x19, 0x2A, 0x14, 0x7E, 0x01, 0x5A, 0x03, 0xF5, 0x5F,
-    0xD0, 0x6A, 0xF1, 0x90, 0xC1, 0xD2, 0x63, 0x9A, 0x3F, 0x20, 0x06, 0x12, 0x4F, 0x1E, 0x92, 0x21,
-    0x40, 0x61, 0x6A, 0xD0, 0x54, 0x20, 0x29, 0xF4, 0xF4, 0x18, 0x7B, 0xF0, 0xD0, 0x21, 0x4C, 0x3C,
-    0x64, 0xC8, 0x50, 0xBA, 0x4E, 0x10, 0xC0, 0x1E, 0x4C, 0x3B, 0x74, 0x43, 0x49, 0x7C, 0xBC, 0xFD,
-    0xBE, 0xC3, 0x47, 0x4A, 0x32, 0xDC, 0xBA, 0x46, 0x1D, 0xB4, 0x0F, 0xD4, 0x15, 0xDF, 0xFD, 0x79,
-    0xCE, 0x77, 0xBF, 0x7B, 0xEE, 0x77, 0x5E, 0x94, 0x88, 0x38, 0xE5, 0x4C, 0x44, 0xC2, 0xB7, 0xE6,
-    0x28, 0x1B, 0xA7, 0x11, 0x71, 0x4B, 0xAF, 0x44, 0x45, 0xEC, 0x17, 0xA8, 0x90, 0x30, 0x13, 0xB7,
-    0x90, 0x49, 0x9A, 0xA2, 0x97, 0x31, 0xA6, 0x16, 0xDB, 0xA4, 0x5B, 0xB9, 0x38, 0x95, 0x44, 0x22,
-    0x7E, 0x69, 0x55, 0x22, 0x41, 0xE6, 0x67, 0x22, 0x51, 0x32, 0xC2, 0x0C, 0x33, 0x1B, 0x63, 0x65,
-    0xCE, 0x0A, 0xA7, 0x5E, 0xC7, 0xAB, 0xFB, 0x88, 0x15, 0xFE, 0xDF, 0x12, 0x2E, 0x82, 0xD9, 0x45,
-    0x26, 0x05, 0x4B, 0x13, 0xA3, 0xB0, 0x2B, 0xBE, 0x5A, 0x5A, 0x9C, 0x17, 0xF1, 0x4C, 0x21, 0xBE,
-    0x31, 0xE2, 0x26, 0x01, 0xFA, 0x58, 0xEC, 0x1D, 0xA1, 0x9B, 0x3B, 0x7C, 0x11, 0xD9, 0x7A, 0x3F,
-    0xB3, 0x8D, 0x29, 0x9D, 0xF9, 0xC5, 0x06, 0x26, 0xCC, 0x30, 0x81, 0x9F, 0x35, 0xE8, 0x31, 0x15,
-    0xAB, 0x42, 0xF3, 0x14, 0x0B, 0x47, 0x6E, 0x29, 0xFE, 0x5B, 0xB5, 0x78, 0xF9, 0x06, 0x9C, 0x0B,
-    0x32, 0xBB, 0x74, 0x4A, 0xAB, 0x16, 0xF3, 0x5A, 0x8D, 0xC9, 0x6B, 0xAC, 0x8C, 0x45, 0x2D, 0x4C,
-    0x3B, 0x31, 0xE6, 0x21, 0x3C, 0xFA, 0xC6, 0xDC, 0x9B, 0xC1, 0x5A, 0xB8, 0x67, 0x63, 0x0D, 0x75,
-    0xFD, 0xD0, 0xD7, 0x6F, 0x8D, 0x99, 0x7D, 0x8A, 0x5E, 0x3F, 0x4F, 0x37, 0x9F, 0xD2, 0xDA, 0x7F,
-    0xFD, 0x4B, 0xFA, 0x27, 0xF4, 0x31, 0x0F, 0xF0, 0x27, 0x87, 0x3E, 0x76, 0x22, 0xAE, 0xD9, 0x85,
-    0x8D, 0x21, 0x96, 0xAA, 0x25, 0xDA, 0xBB, 0x80, 0xF5, 0x23, 0xF8, 0x08, 0x58, 0x73, 0xB1, 0x8C,
-    0xF8, 0x2C, 0x0B, 0x0F, 0xFE, 0xCD, 0x1B, 0x07, 0x93, 0x35, 0xD1, 0x59, 0x4C, 0xDB, 0x78, 0xC5,
-    0x0E, 0x4A, 0xAB, 0x0E, 0x63, 0x6C, 0xC0, 0x86, 0x97, 0xA3, 0x0C, 0xDE, 0xAE, 0xA4, 0xF3, 0x73,
-    0x2E, 0x76, 0x1D, 0x26, 0xD8, 0xAD, 0xB9, 0x5B, 0x4E, 0x89, 0x49, 0x33, 0xA5, 0x15, 0x21, 0x6A,
-    0xFC, 0xDC, 0x69, 0xB9, 0x29, 0x32, 0x4B, 0x24, 0x28, 0x65, 0xD2, 0x9E, 0x9D, 0x94, 0xB2, 0x01,
-    0x3F, 0x51, 0x02, 0xB5, 0x2B, 0xF2, 0x03, 0xB1, 0xC6, 0xF2, 0xC4, 0x27, 0x64, 0x31, 0xE3, 0x6E,
-    0x18, 0xEC, 0x91, 0x6D, 0xB8, 0x73, 0x0F, 0x72, 0xA0, 0xFE, 0x25, 0x0C, 0xF2, 0x6F, 0xB2, 0x38,
-    0x07, 0xD4, 0x42, 0x3A, 0x3C, 0x82, 0x0D, 0xB2, 0x2E, 0x2D, 0x89, 0x31, 0x11, 0x81, 0x33, 0x31,
-    0xF6, 0x3B, 0x4A, 0x60, 0x7B, 0x90, 0xB9, 0x39, 0x0C, 0x00, 0xFE, 0x7E, 0x19, 0xC0, 0xEF, 0x12,
-    0xC6, 0x3B, 0x75, 0x44, 0xA0, 0x66, 0x57, 0xC7, 0x17, 0x1A, 0xE2, 0xD3, 0x6A, 0x11, 0xB1, 0x0C,
-    0x58, 0x7C, 0xD1, 0xA6, 0xBF, 0xDD, 0x2C, 0x0D, 0x77, 0x97, 0x30, 0x4E, 0x9D, 0x9A, 0xFE, 0x00,
-    0xDC, 0x20, 0x09, 0x30, 0x59, 0x86, 0xEF, 0x4E, 0x81, 0xEF, 0xDC, 0x65, 0x82, 0x00, 0x76, 0x82,
-    0x52, 0x13, 0x9A, 0xEC, 0x17, 0x7E, 0x82, 0xA9, 0x3D, 0x12, 0xEF, 0x1C, 0x6D, 0xBC, 0xC3, 0x5D,
-    0x6D, 0xB6, 0xC9, 0x92, 0x0D, 0x21, 0x95, 0xC8, 0x29, 0x7A, 0x24, 0x51, 0xCE, 0xEF, 0x2C, 0x84,
-    0x5E, 0xCA, 0x9A, 0x31, 0x89, 0x8B, 0xD5, 0x4B, 0x8F, 0x7C, 0xF6, 0x6B, 0xB6, 0x92, 0x87, 0x2E,
-    0x89, 0x4A, 0x13, 0xE8, 0x1D, 0x3E, 0x1B, 0x8A, 0x0E, 0x67, 0xF0, 0xF6, 0xD2, 0xD4, 0xEC, 0xAB,
-    0xF1, 0xB3, 0x19, 0xCA, 0x2D, 0xCE, 0xE3, 0x16, 0x43, 0xCF, 0x28, 0xEE, 0x87, 0xD3, 0x78, 0x18,
-    0xA3, 0x93, 0x18, 0x8C, 0xEA, 0x16, 0x92, 0x1F, 0x19, 0xD3, 0x0C, 0x80, 0xD3, 0x46, 0x20, 0x29,
-    0xD6, 0xCC, 0xB4, 0x42, 0x1C, 0x32, 0xD0, 0xC3, 0x14, 0xE0, 0x45, 0x45, 0x5A, 0x6C, 0x03, 0x4A,
-    0xA0, 0x80, 0xD3, 0xE7, 0xC7, 0xC0, 0xD5, 0xCB, 0xC0, 0x5D, 0xFC, 0xDF, 0x21, 0xDC, 0xE1, 0xBD,
-    0xD4, 0xCC, 0xC8, 0x32, 0xB3, 0x47, 0x2C, 0xDB, 0xA9, 0xB8, 0x19, 0xC0, 0x42, 0x33, 0x1E, 0x2C,
-    0x3A, 0x97, 0xCB, 0x3C, 0x8E, 0x40, 0xDD, 0x69, 0x80, 0x8F, 0x44, 0xF7, 0xE1, 0xB6, 0x43, 0x43,
-    0xBA, 0x85, 0x64, 0x46, 0x6B, 0x74, 0xC7, 0xD9, 0x2C, 0xAE, 0xA2, 0x22, 0x27, 0xC7, 0xE3, 0x98,
-    0x60, 0x94, 0xEC, 0xD4, 0x84, 0xBB, 0xE3, 0xF1, 0x79, 0x1E, 0x40, 0xDA, 0xB0, 0xF0, 0xCB, 0x56,
-    0x8F, 0xE8, 0xBB, 0xD1, 0xED, 0xFB, 0x2B, 0xA6, 0xDC, 0xFC, 0xBB, 0x56, 0x4E, 0xA4, 0xEF, 0x69,
-    0xB5, 0x8A, 0x18, 0x86, 0x8F, 0x2D, 0x76, 0xCA, 0x3A, 0xE7, 0x65, 0x3C, 0x5E, 0x85, 0xAB, 0xB1,
-    0x70, 0xA4, 0xAE, 0xD3, 0x4D, 0x96, 0x71, 0xF2, 0x7A, 0xC0, 0xCF, 0x2B, 0x07, 0x3C, 0x43, 0xFD,
-    0x7E, 0xDF, 0xDC, 0x4B, 0x37, 0xF7, 0x38, 0x91, 0xE1, 0xC2, 0x33, 0xDD, 0x89, 0x62, 0x88, 0x1A,
-    0xCD, 0xB0, 0xB8, 0x0E, 0x8F, 0x12, 0x9D, 0x13, 0x66, 0x99, 0x4C, 0x17, 0x42, 0x20, 0xD9, 0xED,
-    0x21, 0xAF, 0x7B, 0xA2, 0xDB, 0x5A, 0x89, 0xE6, 0xB9, 0x28, 0xE8, 0xC0, 0xCF, 0x36, 0x6C, 0x87,
-    0xBF, 0x11, 0xF1, 0x03, 0x9E, 0xA0, 0xA2, 0x22, 0xCE, 0x70, 0x02, 0xF8, 0x25, 0xDC, 0xDA, 0x6F,
-    0xD3, 0xAD, 0xFB, 0x3D, 0x81, 0x5B, 0x78, 0x59, 0x01, 0x74, 0xB4, 0x83, 0x54, 0x5E, 0xC6, 0x73,
-    0x5B, 0x31, 0x3C, 0x45, 0x18, 0x8E, 0xEF, 0xA4, 0xF3, 0x9E, 0xB1, 0x11, 0x30, 0x4D, 0xB7, 0x50,
-    0xB4, 0x70, 0x98, 0xE1, 0x91, 0xF3, 0xA1, 0xBD, 0x22, 0x28, 0x38, 0x89, 0x34, 0x34, 0xF1, 0xB5,
-    0x17, 0xBE, 0xCF, 0xD4, 0xB9, 0xB9, 0xDA, 0xCA, 0x6E, 0x8E, 0xFA, 0xB9, 0xA3, 0x80, 0xBF, 0xC3,
-    0xE2, 0x11, 0x51, 0xD7, 0xB9, 0x76, 0x06, 0xBF, 0xB5, 0x67, 0xF8, 0x99, 0x0E, 0x67, 0x9F, 0x5C,
-    0x9D, 0xB7, 0xB0, 0xA3, 0x1A, 0xE1, 0xF0, 0x59, 0xD3, 0xF2, 0x93, 0xC9, 0x5E, 0xBA, 0xD9, 0x2A,
-    0xCA, 0x38, 0xB4, 0x0D, 0x83, 0x05, 0xC9, 0x8A, 0x35, 0x38, 0xC3, 0xFC, 0x7F, 0xD2, 0xE0, 0x56,
-    0xB6, 0x1E, 0x81, 0x47, 0xE0, 0x8A, 0x6F, 0xE6, 0x8B, 0xCD, 0x22, 0x1E, 0x8D, 0x32, 0x31, 0x80,
-    0xBF, 0x8D, 0x07, 0x87, 0xB7, 0x1D, 0x34, 0x5E, 0x16, 0x40, 0xBB, 0x2C, 0x93, 0x4C, 0x7E, 0x28,
-    0xA1, 0xD2, 0x93, 0xF8, 0xF0, 0xC6, 0x5A, 0x30, 0x4F, 0x83, 0x58, 0x44, 0x3C, 0x82, 0x6C, 0x60,
-    0x84, 0x2C, 0xEE, 0x0E, 0x05, 0x53, 0x69, 0xAA, 0x88, 0x81, 0x38, 0xC7, 0xB8, 0x5F, 0xA7, 0x79,
-    0xE0, 0x47, 0x34, 0x6C, 0xC4, 0x41, 0x53, 0xA2, 0xD7, 0x68, 0x11, 0xF6, 0x44, 0x3D, 0x81, 0xE3,
-    0xF1, 0x6B, 0x72, 0x7E, 0x11, 0xDD, 0x6D, 0x4E, 0x12, 0xC4, 0x0B, 0x5A, 0xE9, 0x86, 0x72, 0x6B,
-    0xF5, 0xE2, 0xD3, 0xEA, 0xE6, 0xB9, 0xAB, 0xDD, 0x67, 0x54, 0xCB, 0x2A, 0x8B, 0x37, 0xE1, 0x40,
-    0xCC, 0x88, 0xC8, 0x10, 0xC2, 0xB7, 0x92, 0xA0, 0xF0, 0x24, 0x73, 0xD8, 0xFA, 0xF0, 0xB6, 0x82,
-    0xB7, 0x4C, 0xAC, 0x52, 0xC7, 0x62, 0x45, 0xD2, 0xAD, 0x7B, 0x93, 0xEE, 0xCD, 0xED, 0xDE, 0x42,
-    0xBD, 0x07, 0xBD, 0x58, 0x47, 0xA0, 0xE2, 0xB8, 0x93, 0xBF, 0xBC, 0xE1, 0x9D, 0x2B, 0xCD, 0xEF,
-    0x67, 0xC9, 0x04, 0x67, 0x23, 0x80, 0x7F, 0x33, 0x5E, 0x5E, 0x73, 0xB7, 0xFE, 0xB3, 0xF1, 0xCF,
-    0xE5, 0x1F, 0x9D, 0xF0, 0x87, 0xCE, 0x7A, 0x85, 0x32, 0xC4, 0xE6, 0x9E, 0xA9, 0x82, 0xB8, 0x19,
-    0xC9, 0xCA, 0x8A, 0x8C, 0xF0, 0xE0, 0x25, 0x8C, 0x1B, 0xDF, 0x60, 0x6F, 0x13, 0xED, 0xD1, 0x44,
-    0x77, 0x5B, 0xC5, 0x5C, 0xE4, 0x94, 0xEE, 0x6F, 0xD6, 0x47, 0xCF, 0x43, 0x07, 0x39, 0x92, 0xDE,
-    0x71, 0x6D, 0xA6, 0x6B, 0x62, 0xD5, 0x43, 0xB8, 0xEC, 0x9A, 0x93, 0x08, 0x04, 0xCE, 0x7D, 0x83,
-    0x33, 0x67, 0x6F, 0x2E, 0x02, 0xDE, 0x3A, 0x63, 0x74, 0xC4, 0x30, 0xC5, 0x88, 0xD6, 0x30, 0xA2,
-    0x85, 0xAF, 0x95, 0x5C, 0x80, 0xF3, 0x36, 0x34, 0x36, 0x5A, 0xE3, 0x82, 0x0F, 0x38, 0xAF, 0xE1,
-    0xB2, 0x11, 0x27, 0xF7, 0x74, 0xD9, 0xF6, 0x20, 0x7C, 0xAB, 0xB1, 0x62, 0x59, 0x1F, 0x4B, 0xE8,
-    0x9B, 0x64, 0x27, 0xBC, 0x76, 0xA7, 0x5A, 0xB1, 0xF6, 0xB3, 0xCB, 0x32, 0x89, 0xB7, 0x01, 0xDA,
-    0x36, 0x6C, 0x58, 0x97, 0xFD, 0x2C, 0xBA, 0xF6, 0x79, 0x15, 0x98, 0xB8, 0x45, 0x44, 0x7C, 0x55,
-    0x07, 0x7C, 0x8C, 0xA0, 0x64, 0x9B, 0x22, 0x30, 0xF6, 0xEE, 0x4E, 0xF0, 0x7E, 0x51, 0xBB, 0x0F,
-    0x64, 0x7B, 0x19, 0xBC, 0x0B, 0x02, 0xEC, 0x87, 0x73, 0x2B, 0x73, 0x2B, 0xAB, 0xAC, 0x58, 0x19,
-    0x5D, 0xBB, 0xBD, 0x3B, 0x75, 0x4C, 0x1E, 0xB6, 0xB0, 0xD8, 0x9A, 0x22, 0xB8, 0x0C, 0xA1, 0x2E,
-    0x1F, 0xC0, 0xF8, 0x3E, 0x2A, 0x35, 0x6C, 0x87, 0x66, 0x41, 0x61, 0xA3, 0x71, 0xF6, 0xB8, 0x0C,
-    0xD0, 0xFB, 0x07, 0x17, 0x97, 0xAB, 0xFD, 0xF5, 0xE0, 0x38, 0xCD, 0x10, 0x87, 0xAC, 0xF9, 0x10,
-    0xE2, 0x45, 0x4F, 0x40, 0x17, 0xAA, 0x27, 0xF1, 0x41, 0x00, 0xCF, 0x0E, 0x46, 0xE4, 0x4F, 0x1D,
-    0xC1, 0x85, 0x6B, 0x8D, 0x47, 0x77, 0x35, 0x1C, 0x25, 0xAF, 0x8C, 0x9E, 0xF1, 0x39, 0xF9, 0x8A,
-    0xFD, 0x6E, 0xB9, 0x11, 0xB9, 0x77, 0x5F, 0x5C, 0x71, 0x67, 0xF5, 0x64, 0x4F, 0xA5, 0xA2, 0xA7,
-    0x80, 0x43, 0x21, 0x6A, 0x7D, 0x47, 0x8F, 0x54, 0x3D, 0x8C, 0x10, 0xD9, 0x25, 0x24, 0xFF, 0xFC,
-    0x6C, 0x4A, 0x1A, 0xE9, 0xA1, 0x52, 0x71, 0x46, 0x74, 0xA7, 0xE4, 0x67, 0x44, 0x7E, 0xA2, 0xDF,
-    0x06, 0x51, 0xF6, 0x79, 0x03, 0xD8, 0x15, 0xC9, 0xBA, 0x41, 0x40, 0x7D, 0x5E, 0xBF, 0x36, 0xB5,
-    0x9B, 0x44, 0xE4, 0xB2, 0xFF, 0x05, 0xE5, 0x6B, 0x4D, 0x35, 0x11, 0xBC, 0x83, 0xEF, 0xDE, 0xE7,
-    0x15, 0xF9, 0x3D, 0x61, 0x25, 0xDB, 0x1B, 0x4B, 0x55, 0x4F, 0xC4, 0x7D, 0xC3, 0x11, 0xF5, 0x79,
-    0xDF, 0xBB, 0xBC, 0x8D, 0xB0, 0x79, 0x2A, 0xFD, 0xC0, 0xF3, 0xF5, 0x45, 0x0F, 0x37, 0x57, 0x92,
-    0x73, 0x6F, 0xD5, 0x44, 0xF7, 0x4E, 0xDD, 0xDB, 0x1D, 0x4C, 0x7A, 0x67, 0xBA, 0x9B, 0x55, 0x3D,
-    0xD4, 0xA0, 0x47, 0xC9, 0x87, 0xFB, 0x38, 0xE7, 0x8D, 0x57, 0x38, 0xE6, 0xEA, 0xAC, 0x84, 0xB8,
-    0x0A, 0x72, 0x6C, 0x51, 0x70, 0x8B, 0x01, 0x99, 0x0E, 0x4F, 0xA7, 0xBC, 0xB5, 0xD0, 0xDB, 0xA5,
-    0x62, 0x08, 0x28, 0x70, 0x36, 0xFE, 0x2F, 0xAA, 0x00, 0x9B, 0xFD, 0x98, 0xA8, 0xDE, 0x46, 0xFD,
-    0x04, 0xC4, 0x73, 0x6A, 0x7F, 0xF7, 0x17, 0x33, 0x5C, 0x17, 0x50, 0x54, 0xD0, 0x17, 0xE8, 0xF3,
-    0x1B, 0xFA, 0x6C, 0x5D, 0x27, 0xD5, 0x78, 0x0B, 0xF3, 0x52, 0x2F, 0x00, 0xD8, 0x1C, 0x01, 0x8A,
-    0xF8, 0x6A, 0xF4, 0x0F, 0xBE, 0xD7, 0x17, 0xAA, 0xA3, 0x04, 0x51, 0x84, 0x99, 0x87, 0xC3, 0x7B,
-    0x2C, 0xA0, 0x5D, 0xA7, 0x34, 0x40, 0x2E, 0x0D, 0x74, 0xF3, 0xD9, 0xDD, 0x6E, 0x07, 0x29, 0xF0,
-    0x5C, 0x1F, 0x92, 0xC4, 0x2D, 0x70, 0x96, 0x9C, 0xF9, 0x04, 0xE0, 0x98, 0x5F, 0x71, 0xE7, 0xB2,
-    0x55, 0x86, 0x61, 0xAE, 0xF0, 0x32, 0x0F, 0x71, 0x74, 0x8B, 0x39, 0xC0, 0x63, 0xED, 0x44, 0xFA,
-    0xAD, 0x3F, 0xF7, 0x2A, 0x7A, 0xFD, 0xD8, 0x7A, 0x62, 0x4D, 0x36, 0x1C, 0x66, 0xFA, 0xF1, 0xA1,
-    0x5F, 0x4E, 0x3E, 0x99, 0xDB, 0x57, 0x8E, 0xF6, 0xDF, 0x71, 0x9B, 0xA0, 0x98, 0x2C, 0xBC, 0x7C,
-    0x21, 0x36, 0xFC, 0x1B, 0x3F, 0xB5, 0xFD, 0xA5, 0x5D, 0xB1, 0x12, 0x6C, 0x7B, 0xE0, 0x7D, 0x6D,
-    0xEE, 0xD7, 0xCB, 0x10, 0xF3, 0xC9, 0xAA, 0xBC, 0xF4, 0x41, 0x37, 0xD8, 0xDB, 0x45, 0xCA, 0x85,
-    0xD8, 0x12, 0xF8, 0x9F, 0xCD, 0xF6, 0xAB, 0x65, 0x10, 0x3E, 0x5E, 0x95, 0xA5, 0x27, 0x6C, 0xA6,
-    0x28, 0x33, 0x37, 0x59, 0x2C, 0x41, 0x34, 0x9D, 0x3F, 0xDA, 0xE6, 0xF7, 0xD7, 0x7F, 0xD9, 0x59,
-    0xF3, 0xA1, 0x1C, 0xF3, 0x4C, 0xFC, 0x6A, 0x68, 0x2A, 0x84, 0x0F, 0xD3, 0x20, 0xAE, 0x57, 0xC7,
-    0x64, 0x29, 0xC6, 0x86, 0x1F, 0xC7, 0x25, 0x31, 0x8A, 0xCC, 0xEE, 0xCE, 0xC8, 0x66, 0x3D, 0x93,
-    0x5A, 0xAB, 0x9B, 0x63, 0x37, 0x96, 0x0B, 0x3A, 0xBF, 0xAD, 0x0A, 0xF3, 0x68, 0xC6, 0x75, 0x2A,
-    0xBD, 0xDE, 0x29, 0x4F, 0x88, 0x5B, 0x73, 0x03, 0x3E, 0xBD, 0xB4, 0x68, 0xF8, 0x29, 0xC6, 0x97,
-    0x4B, 0xE3, 0x8B, 0xEF, 0x21, 0x5A, 0x3F, 0x52, 0xAD, 0xBE, 0xD2, 0x49, 0x8D, 0x00, 0x5A, 0x71,
-    0x77, 0xFC, 0x7A, 0x97, 0x33, 0x35, 0x0E, 0x40, 0x39, 0x8D, 0xEE, 0x3F, 0xC1, 0xDF, 0xCF, 0xD2,
-    0x34, 0xFD, 0x80, 0x0B, 0xDD, 0xC0, 0x4B, 0x7A, 0xD4, 0x11, 0x87, 0xF5, 0xEA, 0x0D, 0xD4, 0xCB,
-    0x78, 0xF5, 0x68, 0xA3, 0x3A, 0xA8, 0x0A, 0xBD, 0xAF, 0x89, 0xF5, 0xF2, 0x75, 0x0D, 0xD3, 0x51,
-    0x99, 0x40, 0xDE, 0x42, 0x09, 0x83, 0xC3, 0xDC, 0x7F, 0x7A, 0x16, 0x62, 0x57, 0xBC, 0x96, 0xD4,
-    0x40, 0xAC, 0xA0, 0x4C, 0x65, 0xC0, 0xFF, 0x71, 0x3F, 0x18, 0x0B, 0xBC, 0xDE, 0xDD, 0x30, 0x7A,
-    0x03, 0xF0, 0x00, 0x83, 0x04, 0x1C, 0x6F, 0x71, 0x85, 0x59, 0x3F, 0x01, 0x5A, 0x91, 0x95, 0xBA,
-    0xAD, 0xE6, 0x65, 0xA8, 0x65, 0x65, 0xAB, 0x59, 0xB2, 0xFC, 0x8B, 0xA9, 0xBA, 0x5D, 0x4D, 0xF8,
-    0x80, 0x95, 0x24, 0x26, 0x86, 0x75, 0x23, 0xF1, 0x78, 0x73, 0x3E, 0xB6, 0x89, 0xF1, 0xF0, 0x88,
-    0xF1, 0x94, 0x45, 0x15, 0x1F, 0xDA, 0x1F, 0x74, 0x36, 0xD0, 0x0C, 0x98, 0x6D, 0x2F, 0x2C, 0x51,
-    0x63, 0x54, 0xE3, 0x23, 0x19, 0xE6, 0x73, 0xF8, 0xF3, 0x91, 0x3E, 0xC8, 0xA1, 0x9D, 0xCE, 0xD7,
-    0xDE, 0x5D, 0x0E, 0x82, 0x18, 0xA2, 0x1E, 0x82, 0xF5, 0x6E, 0xAB, 0x2A, 0x9D, 0x42, 0x1D, 0xE9,
-    0x35, 0x9E, 0x6E, 0xB1, 0x6E, 0x2D, 0xE8, 0x21, 0x61, 0xA8, 0xAD, 0x7B, 0xEF, 0x3A, 0x07, 0x0F,
-    0xFB, 0xB8, 0xD8, 0x81, 0x36, 0x56, 0xE1, 0x0F, 0xA5, 0xFE, 0xC6, 0x2C, 0x7F, 0xAA, 0xF0, 0xEF,
-    0x34, 0x4F, 0x9F, 0x82, 0x59, 0x4F, 0x15, 0xFE, 0xF9, 0x51, 0xE1, 0x9F, 0x2C, 0xF5, 0x94, 0xEE,
-    0xCE, 0x4B, 0x75, 0x54, 0x41, 0x69, 0xD2, 0xE7, 0xF1, 0x47, 0x07, 0x00, 0xCC, 0xEC, 0xCC, 0xB8,
-    0xED, 0xD5, 0x9D, 0xF1, 0x2F, 0x6B, 0x5E, 0x69, 0x35, 0x9A, 0x11, 0xD2, 0xA0, 0xA0, 0x76, 0x18,
-    0x08, 0x70, 0x7A, 0x6B, 0xEA, 0xF4, 0x75, 0x5E, 0x44, 0x21, 0x57, 0xC6, 0x68, 0xCD, 0xF2, 0x9D,
-    0x9A, 0x71, 0x62, 0x92, 0x28, 0x29, 0x76, 0x90, 0xC7, 0x50, 0x60, 0x94, 0x64, 0x3B, 0x46, 0x7F,
-    0x8D, 0xEF, 0xF6, 0x41, 0x2A, 0xB7, 0x32, 0xFC, 0xC4, 0xE0, 0x2D, 0x20, 0x58, 0x3D, 0x5A, 0xDD,
-    0xC9, 0xBD, 0xA2, 0x0B, 0x3E, 0x44, 0xE4, 0x8A, 0x52, 0x37, 0x1E, 0x8F, 0xD7, 0xB6, 0x2A, 0x36,
-    0x1B, 0x4A, 0x5E, 0x04, 0x7E, 0xE8, 0xD9, 0xB9, 0xFE, 0x20, 0x95, 0x20, 0x7C, 0xE2, 0x82, 0x0C,
-    0x62, 0x18, 0x8B, 0x0B, 0x73, 0x83, 0xA3, 0x21, 0xA8, 0xF4, 0x37, 0x82, 0x6D, 0x6A, 0x93, 0x11,
-    0xF2, 0xF9, 0x93, 0x17, 0xAF, 0xAE, 0xD5, 0x44, 0xA4, 0xE2, 0x9C, 0x85, 0xF5, 0xC6, 0xEE, 0xF8,
-    0xA8, 0x96, 0x8C, 0x7B, 0x35, 0xAE, 0x72, 0x1E, 0xE7, 0x90, 0xE8, 0xF1, 0x64, 0x96, 0x1C, 0x55,
-    0xEB, 0x8F, 0x06, 0x0A, 0xB1, 0x9F, 0x0F, 0x49, 0xB0, 0xA2, 0x39, 0x3F, 0xC8, 0x58, 0x8B, 0x3E,
-    0xB9, 0x38, 0x9C, 0xC1, 0xAA, 0xEA, 0xE5, 0xA2, 0xAD, 0xE6, 0x5F, 0x99, 0x95, 0x1A, 0x53, 0x1C,
-    0xEC, 0x3C, 0x0F, 0x6D, 0xAA, 0xD9, 0xDC, 0xB7, 0x2C, 0x1A, 0x60, 0xF7, 0x95, 0x1E, 0xC8, 0x42,
-    0x35, 0x92, 0xDA, 0x56, 0x0E, 0xD2, 0x34, 0x78, 0x92, 0x0E, 0x07, 0xDA, 0xB9, 0x1E, 0x8C, 0x99,
-    0x0C, 0xA2, 0x6D, 0x76, 0x43, 0x4F, 0xB5, 0x02, 0x18, 0x9A, 0xF6, 0xFA, 0x61, 0xCA, 0x71, 0xDD,
-    0x54, 0x73, 0xC9, 0x4F, 0x07, 0x15, 0xD8, 0xFD, 0x1C, 0xF2, 0x55, 0xA7, 0x11, 0x13, 0xC8, 0x36,
-    0xF7, 0xEC, 0x1C, 0xE9, 0x82, 0x95, 0x83, 0x23, 0x95, 0x5C, 0x42, 0x76, 0x51, 0xE1, 0x98, 0x7B,
-    0x10, 0xC1, 0x6E, 0x2C, 0xD5, 0x19, 0xB1, 0x72, 0x39, 0xED, 0x0B, 0x1A, 0x9C, 0x9B, 0x19, 0xCF,
-    0xFF, 0xC3, 0xC7, 0xE3, 0x0B, 0x57, 0xC7, 0xEB, 0x5D, 0x9E, 0x79, 0x31, 0x4D, 0xDB, 0x74, 0xF3,
-    0xB6, 0x36, 0x94, 0x25, 0x47, 0x2C, 0xAF, 0x70, 0x44, 0x00, 0x69, 0x7D, 0x09, 0xF9, 0x0A, 0xA7,
-    0x72, 0xB3, 0x00, 0x0D, 0x4E, 0x6E, 0x97, 0x56, 0xAE, 0xDB, 0x76, 0x09, 0x20, 0x5A, 0xED, 0x1F,
-    0xD6, 0x72, 0xD5, 0x88, 0xF4, 0x61, 0xE9, 0xBD, 0x43, 0x46, 0x2F, 0x8C, 0xBB, 0xA7, 0xC6, 0xE9,
-    0x53, 0x2B, 0x81, 0x89, 0xC8, 0xE5, 0x45, 0xFE, 0x75, 0x59, 0x89, 0x7E, 0x86, 0x25, 0x8D, 0x13,
-    0x35, 0x4E, 0xD4, 0x38, 0x7C, 0x0E, 0x8C, 0x4B, 0xD5, 0x38, 0x51, 0xE3, 0xF0, 0x59, 0x56, 0x0E,
-    0x06, 0xAA, 0xFB, 0xBD, 0x58, 0x7F, 0x00, 0x82, 0x71, 0x18, 0x9D, 0x93, 0xBE, 0x6A, 0x9C, 0xA8,
-    0x71, 0xE3, 0xFF, 0xDC, 0xB8, 0x4A, 0x8D, 0x6B, 0x55, 0x0B, 0xEF, 0x17, 0xE2, 0x20, 0x7D, 0x18,
-    0x41, 0xEB, 0x55, 0x67, 0x9C, 0xC2, 0x29, 0x61, 0xDC, 0xC8, 0x29, 0x61, 0x9C, 0x73, 0xB7, 0x94,
-    0x87, 0x05, 0xD3, 0x90, 0x33, 0x6F, 0x92, 0x59, 0xDE, 0xEF, 0x18, 0x70, 0xEC, 0xDB, 0x99, 0xF3,
-    0x5D, 0x01, 0xE3, 0x9C, 0x72, 0x04, 0xE3, 0xD0, 0xB3, 0x08, 0xDC, 0xB7, 0xC1, 0x66, 0x2F, 0x86,
-    0x3A, 0x75, 0xBE, 0xC9, 0x48, 0x8B, 0x28, 0x27, 0x09, 0xDD, 0xFF, 0xC2, 0xB8, 0x4A, 0x7F, 0xBA,
-    0x64, 0xC9, 0xDC, 0x06, 0x87, 0x8E, 0xC8, 0xD9, 0x34, 0x8E, 0x32, 0x17, 0xC8, 0xD9, 0x6A, 0x9C,
-    0xAD, 0xC6, 0xD9, 0x6A, 0x1C, 0x4A, 0x18, 0x47, 0x54, 0xCA, 0x92, 0xE5, 0xF2, 0x0A, 0xCB, 0xC0,
-    0xFD, 0x63, 0x49, 0xE4, 0xFE, 0x51, 0x2A, 0x72, 0xA5, 0x22, 0x57, 0x3D, 0x0B, 0xB9, 0xA6, 0x4F,
-    0xEE, 0xF4, 0xDC, 0x47, 0x2F, 0xB6, 0xCA, 0x1C, 0xF9, 0x64, 0x7D, 0xEA, 0xD9, 0xDF, 0x7E, 0x53,
-    0xF6, 0xF6, 0xBE, 0x44, 0x08, 0x29, 0xC1, 0xF7, 0x12, 0x12, 0xC7, 0x31, 0x93, 0x18, 0xD0, 0xB8,
-    0xD5, 0x09, 0x5E, 0x81, 0x96, 0xFC, 0x13, 0x45, 0xCF, 0x3B, 0x0A, 0x42, 0x31, 0x10, 0x85, 0xE1,
-    0xA3, 0xB7, 0xB0, 0x11, 0xB2, 0x94, 0x6C, 0xE1, 0x82, 0x5B, 0xB2, 0xD5, 0xF1, 0xEE, 0x4B, 0x2C,
-    0x5C, 0x81, 0x4B, 0xB0, 0xB0, 0xD7, 0x22, 0x85, 0xC2, 0x90, 0xE3, 0x3C, 0x82, 0x06, 0xC2, 0xCF,
-    0x97, 0x09, 0x81, 0x00, 0xBF, 0xB5, 0x1D, 0xD5, 0x4C, 0x19, 0x65, 0xB6, 0x3C, 0xB3, 0xAF, 0x55,
-    0xB4, 0x00, 0xE7, 0x71, 0xD9, 0x5B, 0x3E, 0x97, 0xD9, 0xCF, 0x49, 0x2E, 0xD6, 0x62, 0xDD, 0x69,
-    0xB0, 0xDB, 0x3B, 0x4E, 0xAD, 0xEA, 0xE4, 0x8D, 0xEA, 0x7C, 0x4C, 0x54, 0x31, 0xA1, 0xB2, 0x09,
-    0x3B, 0xD6, 0xE4, 0x2C, 0x7C, 0x43, 0xD8, 0x6C, 0xDF, 0xAB, 0xD1, 0x7A, 0xA5, 0xD1, 0xBA, 0x71,
-    0x42, 0xBA, 0x4F, 0xDD, 0x41, 0x48, 0x13, 0x27, 0xE4, 0x14, 0xC4, 0x71, 0x0A, 0xE2, 0x50, 0x83,
-    0xC8, 0xA9, 0x35, 0x89, 0xFD, 0xFF, 0xAF, 0xF8, 0x02,
+static const uint8_t bookerly_16_italicBitmaps[35486] = {
+    0xD5, 0x9B, 0x3F, 0xAC, 0x24, 0xC7, 0x9D, 0xDF, 0x3F, 0xD5, 0xB5, 0x8F, 0x4D, 0xB3, 0x70, 0x57,
+    0x1B, 0x90, 0xB2, 0xE0, 0xC5, 0x5D, 0x2B, 0x94, 0x0F, 0x22, 0x3B, 0x71, 0x20, 0x18, 0xFB, 0xA6,
+    0x4A, 0x62, 0xA0, 0x40, 0x81, 0xD6, 0x86, 0x9E, 0x04, 0x1C, 0x03, 0x3A, 0xB8, 0x44, 0x30, 0x8C,
+    0x4D, 0x14, 0x1C, 0xE0, 0xF7, 0xA6, 0x9B, 0xBC, 0x40, 0x81, 0x00, 0x7B, 0x93, 0x73, 0x72, 0x89,
+    0x03, 0x41, 0x10, 0x9E, 0x02, 0x3A, 0x50, 0x40, 0xE0, 0x66, 0x5E, 0x97, 0x48, 0x18, 0x17, 0x10,
+    0xB0, 0x5A, 0x12, 0x0E, 0x02, 0xAC, 0x40, 0x2D, 0x1D, 0x25, 0xE1, 0x78, 0x67, 0x6F, 0x49, 0x6A,
+    0x5A, 0xBD, 0xDC, 0xEA, 0xFE, 0x39, 0xA8, 0x9E, 0xD9, 0xB7, 0x4B, 0xD9, 0x67, 0x9F, 0x25, 0x1F,
+    0xD5, 0x41, 0xCF, 0x4C, 0x77, 0x4F, 0xFD, 0xFD, 0xFD, 0xFD, 0x7E, 0x7F, 0x8D, 0xF2, 0x24, 0x5C,
+    0xAB, 0x23, 0x0D, 0x66, 0x20, 0x61, 0x03, 0x13, 0x95, 0x2F, 0x22, 0x35, 0x7A, 0xE0, 0x14, 0x1D,
+    0x38, 0xA7, 0x6C, 0xF9, 0x22, 0xCF, 0x90, 0x8F, 0x3F, 0xA2, 0x0E, 0x3A, 0xE1, 0x3C, 0x1E, 0xDA,
+    0x0F, 0x97, 0x61, 0x67, 0xC3, 0x64, 0x5F, 0x19, 0xAB, 0x4F, 0xC6, 0xAA, 0x88, 0xB5, 0x1E, 0x5E,
+    0xD0, 0xE1, 0x54, 0x87, 0xDB, 0x65, 0x0B, 0xC0, 0x1D, 0xE5, 0xE1, 0x36, 0x11, 0x2A, 0xFE, 0x18,
+    0x4C, 0xFB, 0x3C, 0xE8, 0xDE, 0xC2, 0xD9, 0xBB, 0x9F, 0xFF, 0x4B, 0xDF, 0x89, 0x48, 0xFC, 0x83,
+    0xEE, 0x72, 0xF9, 0x0A, 0xD6, 0x9F, 0x82, 0x0E, 0x16, 0x54, 0x2C, 0x03, 0xBC, 0x5E, 0x0C, 0x70,
+    0xCA, 0x88, 0x15, 0x91, 0xB9, 0x14, 0x11, 0xA1, 0x88, 0xA6, 0x85, 0x6F, 0xE8, 0x1E, 0x4E, 0x89,
+    0x60, 0x39, 0x87, 0x32, 0xBC, 0x00, 0x78, 0xC5, 0xF1, 0xB0, 0x80, 0x8A, 0xC0, 0xF3, 0x80, 0x0E,
+    0x70, 0x4B, 0x3C, 0x56, 0xC4, 0xEB, 0x07, 0x7F, 0x3E, 0xB3, 0xB7, 0x9F, 0x8E, 0x36, 0x44, 0xA7,
+    0xA6, 0xDF, 0xD7, 0x43, 0xF5, 0x46, 0x7F, 0x93, 0xF9, 0x63, 0x60, 0x1F, 0x06, 0x70, 0x09, 0x90,
+    0x08, 0x85, 0xF4, 0x60, 0xA5, 0x45, 0xFD, 0x34, 0xE1, 0x9F, 0xB7, 0xC3, 0xB9, 0x0E, 0x62, 0xC2,
+    0x6D, 0x33, 0xCC, 0x65, 0xBB, 0x98, 0xF8, 0x8D, 0x2A, 0x34, 0xF7, 0x5F, 0x1A, 0x95, 0xC8, 0x4C,
+    0x21, 0x0B, 0x14, 0x03, 0x70, 0xBA, 0x76, 0xC7, 0x39, 0x60, 0x5A, 0x60, 0xE4, 0xDA, 0xF1, 0x2C,
+    0xD4, 0xF7, 0xE0, 0x14, 0x25, 0x13, 0x24, 0xCA, 0x61, 0x47, 0x11, 0xB1, 0xED, 0x29, 0x65, 0x4F,
+    0xCD, 0x06, 0xDB, 0x72, 0xCA, 0x86, 0x1A, 0xCE, 0xD9, 0x70, 0x0E, 0x3B, 0x4E, 0x19, 0x61, 0xC7,
+    0xB9, 0x1E, 0x60, 0xC7, 0x64, 0xC2, 0x89, 0xDF, 0xA9, 0x58, 0xD1, 0xC5, 0x6D, 0xD9, 0x9F, 0xEA,
+    0xF7, 0x52, 0x2D, 0xFE, 0x75, 0x1B, 0x2E, 0xCC, 0xA4, 0x62, 0xC5, 0x06, 0x74, 0xBF, 0x61, 0x03,
+    0xB6, 0x3D, 0x65, 0x03, 0x35, 0xE7, 0x9C, 0xC2, 0x39, 0x3B, 0x4E, 0x61, 0x64, 0xC7, 0x0E, 0x1D,
+    0xD9, 0x31, 0x62, 0x02, 0xE7, 0x3A, 0x52, 0x79, 0xDC, 0x6B, 0x81, 0x0D, 0x54, 0x0B, 0x9C, 0x83,
+    0xBA, 0xF3, 0x68, 0xC8, 0xC5, 0x0C, 0xA0, 0x64, 0x04, 0xB8, 0xAA, 0x02, 0x60, 0xFD, 0x0E, 0x28,
+    0xA2, 0x09, 0xC0, 0x86, 0x09, 0x28, 0xFB, 0x1A, 0x60, 0x67, 0x03, 0x37, 0x30, 0xDF, 0x1F, 0x60,
+    0xA0, 0x1B, 0xA1, 0xA6, 0x1A, 0x50, 0x5D, 0x6F, 0x16, 0x8C, 0x44, 0xFD, 0xCB, 0x68, 0xE4, 0x1E,
+    0x93, 0x2B, 0x96, 0x81, 0x5A, 0x4D, 0xCF, 0xBF, 0x80, 0xEE, 0x6D, 0xAF, 0x7B, 0xCE, 0x69, 0x38,
+    0xC7, 0x04, 0x3D, 0xD9, 0x96, 0x1D, 0xF6, 0x47, 0x11, 0x13, 0x68, 0x66, 0x68, 0x50, 0xD2, 0xA2,
+    0x97, 0xB3, 0x6E, 0x01, 0x2B, 0x72, 0x7F, 0x81, 0x5A, 0x86, 0x5A, 0xEE, 0x71, 0x02, 0xB5, 0x00,
+    0xF0, 0x21, 0x4F, 0x7B, 0x6E, 0xC3, 0x54, 0x7D, 0x22, 0xD6, 0xC5, 0x70, 0xAA, 0xC3, 0x61, 0xF4,
+    0x65, 0x80, 0x2B, 0xB0, 0x3D, 0x2A, 0x41, 0xD5, 0x42, 0x02, 0x1B, 0x60, 0x07, 0x65, 0x0F, 0x0E,
+    0xD4, 0x98, 0xAF, 0x6C, 0xA0, 0x88, 0xC7, 0xAF, 0x4C, 0xA0, 0x07, 0xA8, 0x3C, 0x6C, 0x1F, 0xFD,
+    0xB4, 0x01, 0x6A, 0xE0, 0x02, 0x48, 0xF9, 0xBF, 0x3A, 0xE6, 0x5B, 0x65, 0x0F, 0xA6, 0x07, 0xE3,
+    0x1F, 0x2D, 0xDE, 0xEF, 0xAD, 0x8F, 0xEE, 0x81, 0xDD, 0xE3, 0x7F, 0x31, 0x01, 0x6C, 0x0B, 0x2E,
+    0x5F, 0x2E, 0x62, 0xFE, 0x77, 0xE5, 0x61, 0xBF, 0xFE, 0x0C, 0xF9, 0xEE, 0x74, 0x1C, 0x2A, 0xEB,
+    0x50, 0x2F, 0x72, 0x13, 0x35, 0x14, 0x23, 0xD4, 0x9E, 0x62, 0x04, 0xE7, 0x29, 0x63, 0x1E, 0x3B,
+    0x00, 0xC6, 0x3F, 0x6D, 0x43, 0x6D, 0xBD, 0xFB, 0x2F, 0x94, 0xF3, 0x9E, 0x6E, 0x36, 0xFF, 0xED,
+    0xDF, 0xB8, 0x7F, 0x47, 0x65, 0xB9, 0x61, 0x5B, 0x9E, 0x01, 0xC5, 0x63, 0x33, 0xB5, 0x2D, 0x6C,
+    0x50, 0x67, 0x0F, 0xCE, 0x6A, 0x91, 0xD4, 0x89, 0xC4, 0xF7, 0xDF, 0x3D, 0x88, 0x73, 0x52, 0x33,
+    0x33, 0x89, 0x54, 0xC4, 0x72, 0xA8, 0xDA, 0x3D, 0x37, 0x69, 0xE4, 0x47, 0x22, 0x7F, 0x21, 0x0B,
+    0x98, 0xB7, 0x7E, 0x39, 0x2F, 0x27, 0xB0, 0xAA, 0x44, 0xE5, 0x73, 0x2B, 0xAC, 0xE2, 0x92, 0x27,
+    0x97, 0x2F, 0xA7, 0xFF, 0xEB, 0xCB, 0xE5, 0xDF, 0x71, 0x99, 0x55, 0x74, 0x9F, 0x5A, 0x80, 0x4E,
+    0x7A, 0xB4, 0xC8, 0x88, 0x1D, 0xCA, 0x84, 0x6B, 0x8B, 0xC4, 0x15, 0xCC, 0x2A, 0xC1, 0xAC, 0x47,
+    0x58, 0xCA, 0x08, 0xB3, 0x19, 0x60, 0xB6, 0x3D, 0xA4, 0x2A, 0xA0, 0x52, 0x1D, 0x28, 0x92, 0x6B,
+    0xD1, 0xA3, 0x6B, 0xD1, 0xD1, 0x79, 0xCC, 0xE0, 0x5A, 0x6C, 0x70, 0x2D, 0x75, 0xEB, 0x02, 0x0D,
+    0x75, 0x5F, 0xCC, 0xD8, 0x07, 0x77, 0x47, 0x4A, 0x91, 0x80, 0x92, 0x19, 0x38, 0xC9, 0xFD, 0x7A,
+    0xEE, 0x0E, 0xA5, 0x8C, 0x5A, 0x12, 0x27, 0x0D, 0x54, 0x01, 0x33, 0xA0, 0x47, 0x48, 0xD0, 0x40,
+    0xD5, 0x3E, 0xFE, 0xBB, 0x6E, 0xB1, 0x3D, 0x3A, 0x1E, 0x7E, 0x37, 0x7D, 0x29, 0xF2, 0xA6, 0xC8,
+    0x00, 0xB7, 0x26, 0x30, 0xB2, 0x80, 0xC8, 0x82, 0x1D, 0x75, 0xA2, 0xA3, 0x1C, 0x75, 0xA4, 0xEA,
+    0x4B, 0x4F, 0xE3, 0xA1, 0x48, 0x80, 0x1D, 0x00, 0x01, 0x4C, 0x04, 0x3A, 0x0F, 0x66, 0x5C, 0xBF,
+    0xD8, 0xB8, 0xDE, 0xAA, 0x86, 0x55, 0x91, 0x5D, 0x80, 0x72, 0x02, 0x1A, 0x11, 0xF9, 0xA4, 0x88,
+    0xA4, 0x52, 0x44, 0x7A, 0x72, 0x6F, 0xB5, 0x8C, 0x54, 0x22, 0x41, 0x4F, 0x6A, 0x61, 0x8B, 0x89,
+    0x65, 0xCB, 0x15, 0x37, 0xB1, 0x3D, 0xA8, 0x04, 0x74, 0x40, 0x13, 0xA0, 0x19, 0x40, 0xC4, 0xE7,
+    0xE1, 0x51, 0x45, 0xA0, 0xF1, 0xA0, 0x47, 0xA0, 0x21, 0x77, 0xAC, 0x67, 0x28, 0xC4, 0xF3, 0x92,
+    0xF4, 0x5A, 0x64, 0xA0, 0x96, 0x1E, 0x9E, 0x5D, 0x8D, 0xCA, 0xB0, 0x8E, 0x45, 0x2F, 0x80, 0x9B,
+    0x40, 0x3F, 0xEC, 0xC1, 0x35, 0xA0, 0xC7, 0x04, 0xEE, 0x53, 0x03, 0x7A, 0xAC, 0x3D, 0xCE, 0x27,
+    0xF4, 0xA4, 0x23, 0x75, 0x6B, 0x43, 0x31, 0xB1, 0xA5, 0x6E, 0x8B, 0xB1, 0x48, 0xD8, 0x50, 0x89,
+    0xC8, 0xD2, 0x89, 0xC8, 0x74, 0x76, 0xF6, 0xF2, 0x8F, 0x3D, 0xB8, 0xA3, 0x30, 0x44, 0xA0, 0x6E,
+    0x57, 0xBD, 0x53, 0x67, 0x67, 0x77, 0xE8, 0x64, 0xC1, 0x8A, 0xF4, 0x2A, 0x01, 0xB5, 0xCF, 0xFA,
+    0x83, 0x03, 0xCA, 0x01, 0xE8, 0x26, 0xB0, 0x32, 0xC1, 0x87, 0x64, 0x00, 0x25, 0x7E, 0x5D, 0x25,
+    0x17, 0xD6, 0x45, 0xAE, 0xDB, 0x75, 0x76, 0x1D, 0x50, 0xF7, 0x50, 0x4D, 0xA8, 0xBB, 0x0B, 0x46,
+    0x04, 0x9A, 0xE5, 0x91, 0xDC, 0xDD, 0x1A, 0xA1, 0x90, 0x04, 0xF5, 0xE2, 0x41, 0x7A, 0x28, 0xE7,
+    0xC3, 0x12, 0xB9, 0xB0, 0x6E, 0x47, 0x91, 0x00, 0x2D, 0x72, 0x0F, 0x23, 0x32, 0x61, 0x7F, 0x7C,
+    0x6B, 0xA6, 0x0A, 0x08, 0x75, 0x4B, 0x83, 0xF3, 0xB8, 0xE3, 0xA9, 0xC1, 0x79, 0xAE, 0xA8, 0x5B,
+    0x66, 0xAA, 0xA0, 0x13, 0x76, 0xAC, 0x22, 0x5A, 0x24, 0x40, 0x37, 0x03, 0xCA, 0xC3, 0xC9, 0xD9,
+    0xD9, 0x99, 0x16, 0x91, 0x1F, 0x8A, 0xC8, 0xB4, 0x3F, 0xFB, 0x5C, 0xDA, 0x40, 0xB2, 0x30, 0x97,
+    0x2D, 0x33, 0x70, 0xB5, 0x6E, 0x4B, 0x43, 0x5E, 0x25, 0xD7, 0x42, 0x1D, 0xA0, 0x0A, 0x59, 0x7C,
+    0x4C, 0x84, 0x72, 0x04, 0x9D, 0x40, 0xCD, 0xEB, 0x20, 0x1B, 0x9F, 0x1F, 0x2A, 0xFB, 0xE3, 0xEC,
+    0x0E, 0x32, 0x62, 0x1F, 0x74, 0xBD, 0x9E, 0x58, 0xB8, 0xA2, 0x8C, 0xB6, 0x67, 0xCB, 0x8C, 0xE9,
+    0xED, 0xA0, 0x12, 0x9D, 0x6F, 0xD0, 0x4B, 0x13, 0xB0, 0xD2, 0xE7, 0x75, 0x6D, 0xBA, 0x48, 0x1D,
+    0xBA, 0x60, 0x86, 0x62, 0x56, 0x09, 0x1B, 0x9D, 0xA7, 0xD3, 0x11, 0x13, 0x1B, 0x58, 0xF4, 0x44,
+    0x1D, 0xEA, 0xB1, 0x1A, 0x11, 0x49, 0x14, 0x32, 0x1F, 0x3A, 0xAB, 0xDF, 0x06, 0x23, 0x09, 0xE4,
+    0xEB, 0x09, 0x1B, 0x75, 0xA2, 0xA1, 0x8C, 0x7A, 0xC4, 0xF6, 0x36, 0xE0, 0x7C, 0x03, 0x4B, 0x91,
+    0xD0, 0xA3, 0x89, 0xD8, 0xBE, 0xEA, 0x69, 0x70, 0x7D, 0x91, 0x68, 0x44, 0x7A, 0x1A, 0x11, 0xF8,
+    0xD0, 0xE7, 0xC7, 0xC7, 0xB6, 0xB0, 0xCF, 0x32, 0x49, 0xD7, 0xC3, 0xDD, 0x84, 0xEA, 0xC4, 0x53,
+    0x4A, 0x7F, 0x70, 0x77, 0xCF, 0xAA, 0x59, 0xCF, 0x3A, 0x15, 0x91, 0x27, 0x8E, 0x9A, 0xCE, 0x8B,
+    0x5F, 0x78, 0x16, 0xB8, 0x43, 0xD5, 0x23, 0x5E, 0x27, 0x4C, 0xCF, 0xAF, 0x3C, 0x74, 0xA4, 0xEA,
+    0x71, 0x9E, 0x84, 0x8E, 0xD4, 0xA8, 0x89, 0xAA, 0x2D, 0x46, 0xD6, 0xE0, 0xC4, 0x43, 0xE5, 0x29,
+    0x05, 0x25, 0x3D, 0xCD, 0x48, 0x35, 0x53, 0x8A, 0xA7, 0xEE, 0xB3, 0x52, 0x55, 0x13, 0x98, 0x05,
+    0x0A, 0x69, 0xA1, 0x1B, 0xF2, 0xF0, 0x7F, 0x0F, 0xE0, 0xB9, 0xB3, 0xB3, 0x7F, 0x29, 0x22, 0x6F,
+    0x89, 0xC8, 0xB5, 0xDE, 0x4E, 0xCE, 0xCE, 0xCE, 0x6A, 0x91, 0xD4, 0x88, 0xC4, 0x9B, 0xD9, 0x3C,
+    0x97, 0x33, 0x94, 0xE2, 0x51, 0xB2, 0xB6, 0x59, 0x4F, 0x60, 0x12, 0x54, 0x91, 0x72, 0x41, 0x49,
+    0x4B, 0x37, 0x50, 0x4F, 0xB0, 0x40, 0xD1, 0xAE, 0x0D, 0x7D, 0x81, 0x52, 0x82, 0x95, 0x68, 0xFF,
+    0x66, 0x7A, 0x9A, 0x04, 0x3B, 0xD8, 0xC1, 0x84, 0x8E, 0x98, 0x1E, 0xE7, 0x99, 0xD1, 0x11, 0x1B,
+    0xA8, 0xA0, 0xFA, 0x1A, 0xD5, 0x84, 0x19, 0xD6, 0xBF, 0x3E, 0xE3, 0xA9, 0x03, 0xAE, 0xC5, 0xF9,
+    0x83, 0x7E, 0x9F, 0xDD, 0x01, 0x78, 0x4A, 0x64, 0x02, 0x8C, 0x88, 0x8C, 0x50, 0x2E, 0x9E, 0x66,
+    0xA0, 0x58, 0xB2, 0x6C, 0x09, 0xA0, 0x12, 0xAE, 0x05, 0x4C, 0x30, 0x03, 0x5F, 0x38, 0x61, 0xAB,
+    0x26, 0xDC, 0x12, 0xF5, 0xE0, 0xB0, 0x3F, 0x15, 0x36, 0x65, 0xAF, 0xA3, 0x19, 0xF4, 0x90, 0xD8,
+    0x73, 0x9B, 0x8D, 0x6D, 0x6D, 0x5B, 0x06, 0xFD, 0xED, 0xA8, 0x46, 0x5E, 0xE7, 0xBC, 0xC6, 0x61,
+    0xBD, 0x7D, 0x33, 0xEA, 0x58, 0x44, 0x46, 0xC7, 0x86, 0x06, 0xA7, 0xA3, 0x1E, 0x6C, 0x34, 0xBD,
+    0xC3, 0xE9, 0x1F, 0x14, 0xA3, 0x8E, 0x7A, 0xF9, 0xD9, 0xC3, 0x19, 0x47, 0x9D, 0xAC, 0x50, 0x8C,
+    0x7C, 0x81, 0x7F, 0x9A, 0x25, 0x1F, 0x60, 0x5E, 0xC3, 0x84, 0x35, 0x4A, 0xAB, 0x07, 0xF8, 0x7D,
+    0xA0, 0x7B, 0x70, 0xD6, 0xF5, 0xA0, 0x44, 0x64, 0x00, 0x54, 0x27, 0xF7, 0x1E, 0xDF, 0xE5, 0x9B,
+    0xD9, 0x0D, 0xC2, 0xAA, 0x2C, 0xD0, 0xF4, 0x00, 0x6E, 0x04, 0xA8, 0xB7, 0x00, 0xF6, 0x33, 0x01,
+    0x30, 0x6F, 0x46, 0x40, 0xF7, 0x09, 0xD0, 0x43, 0xED, 0x41, 0x45, 0x33, 0x00, 0x93, 0x4A, 0xC0,
+    0x0E, 0x07, 0x6C, 0x72, 0x60, 0x71, 0xF9, 0xF5, 0x11, 0xAC, 0xC8, 0x02, 0xF6, 0x9D, 0xCB, 0x2E,
+    0x50, 0xF6, 0x94, 0x71, 0xF5, 0x0E, 0xAB, 0x8F, 0x4F, 0x60, 0x07, 0xF6, 0xA0, 0x53, 0x21, 0x23,
+    0xB7, 0xE4, 0xE7, 0xB2, 0x60, 0x25, 0xAD, 0xE6, 0x47, 0xA4, 0xA5, 0x13, 0x89, 0x7C, 0x75, 0x32,
+    0x09, 0x3D, 0xE6, 0x7D, 0xBB, 0xCA, 0xA7, 0x72, 0x60, 0x8F, 0xE9, 0x49, 0xD8, 0xBE, 0x18, 0xB1,
+    0xBD, 0x19, 0xB0, 0x22, 0x9E, 0x4A, 0xA4, 0xA7, 0xF6, 0xD5, 0x88, 0xA3, 0x48, 0x38, 0x48, 0x34,
+    0x90, 0xD8, 0x42, 0x62, 0x8F, 0x4A, 0x24, 0xF4, 0x48, 0xC2, 0x44, 0x35, 0xFF, 0x8B, 0x26, 0xD4,
+    0x22, 0x0B, 0x9D, 0x3C, 0xB1, 0x2C, 0x77, 0xE5, 0x6D, 0x0A, 0x91, 0x85, 0xEA, 0xBD, 0x97, 0x16,
+    0x9A, 0x96, 0x0B, 0x35, 0xC3, 0xB9, 0x1E, 0xE1, 0xDC, 0x0C, 0xF0, 0x45, 0x1B, 0x0E, 0x96, 0xD9,
+    0xF9, 0xD5, 0xFE, 0xD2, 0x1C, 0x4F, 0xDD, 0xF1, 0xF4, 0xE8, 0x9A, 0x6B, 0x01, 0xD7, 0xC3, 0x50,
+    0x4D, 0x98, 0xDE, 0xC8, 0xA5, 0xB4, 0x85, 0xC8, 0x0C, 0x77, 0xE5, 0x91, 0x61, 0x5A, 0xA7, 0x3E,
+    0x40, 0x27, 0xB2, 0xC0, 0x57, 0xA7, 0xA7, 0x24, 0x50, 0x8C, 0xD4, 0x11, 0x1D, 0x29, 0x27, 0x74,
+    0xA4, 0x48, 0x94, 0x11, 0x35, 0x63, 0x06, 0x58, 0xB0, 0x3D, 0x2C, 0xD8, 0xF0, 0xE8, 0x5C, 0xB5,
+    0x30, 0x53, 0xB7, 0x30, 0xE3, 0x3C, 0x2A, 0xE1, 0x40, 0x4F, 0x34, 0xA0, 0x23, 0xDB, 0xC3, 0xC2,
+    0xD7, 0x81, 0x19, 0x3A, 0x48, 0xE8, 0x19, 0x35, 0xAB, 0x26, 0x52, 0x8B, 0x88, 0x7F, 0x7C, 0x41,
+    0x9C, 0x88, 0xB4, 0x56, 0x44, 0x06, 0xEE, 0xBE, 0xF3, 0xF5, 0x11, 0xD3, 0x73, 0x8A, 0x8E, 0x58,
+    0x48, 0xE8, 0x36, 0x4F, 0xAF, 0x6E, 0x01, 0xDB, 0xB3, 0x3A, 0x24, 0x96, 0xAF, 0x4F, 0xD0, 0xC8,
+    0x0C, 0xF5, 0x3B, 0x97, 0xD7, 0xEF, 0xA8, 0x04, 0xB0, 0x85, 0x9B, 0xD4, 0x2D, 0xB7, 0xB1, 0x3D,
+    0x15, 0x3A, 0x62, 0x5B, 0x35, 0xFF, 0xE1, 0x6B, 0xBD, 0x11, 0x91, 0x68, 0x44, 0x64, 0x02, 0x27,
+    0xB2, 0xE4, 0xD3, 0x53, 0xCB, 0xE5, 0x4C, 0x31, 0x72, 0x1B, 0x1D, 0xF3, 0xE9, 0x9F, 0x65, 0xE7,
+    0x68, 0x86, 0x43, 0xB7, 0x36, 0x00, 0xF6, 0xBF, 0x5E, 0x42, 0x25, 0xB2, 0xF6, 0xFA, 0xC4, 0xDE,
+    0x6C, 0x59, 0x5D, 0x48, 0xD6, 0x96, 0x74, 0x18, 0x4D, 0x2D, 0x11, 0x3A, 0x89, 0xD7, 0x76, 0xE0,
+    0x01, 0x38, 0x91, 0x91, 0xE6, 0xAF, 0xFF, 0xF5, 0x4C, 0xD3, 0x52, 0xD3, 0x78, 0x4C, 0x70, 0x9E,
+    0x62, 0xA8, 0x5B, 0x88, 0x36, 0x1C, 0x7A, 0xD7, 0xE3, 0x51, 0x83, 0x1A, 0x80, 0x2A, 0x50, 0xC9,
+    0xF7, 0x23, 0x46, 0xFE, 0x47, 0x82, 0x5B, 0x63, 0x43, 0x0E, 0xC8, 0x70, 0x7A, 0x82, 0xAA, 0x15,
+    0x8F, 0xE9, 0xED, 0x84, 0x8E, 0x4A, 0xFE, 0xFA, 0xB5, 0x44, 0x25, 0xB2, 0x40, 0x27, 0x6F, 0xB3,
+    0x46, 0x15, 0x4E, 0x86, 0x42, 0x04, 0x2B, 0x23, 0x22, 0x2D, 0x77, 0x7B, 0x8A, 0x39, 0xC7, 0xD4,
+    0x57, 0xB9, 0x37, 0xE7, 0x8F, 0xD1, 0x7F, 0xB3, 0x06, 0xD0, 0x2D, 0x6A, 0xCA, 0x0B, 0x71, 0x95,
+    0xAF, 0x38, 0x0F, 0x22, 0x22, 0x21, 0x47, 0x48, 0x11, 0xEA, 0x3F, 0x3D, 0xFB, 0xDC, 0xFA, 0xCC,
+    0xFE, 0xF8, 0x8C, 0x5A, 0xDB, 0xD9, 0xE6, 0x60, 0xA3, 0x6E, 0x29, 0xD6, 0x67, 0xE6, 0xF5, 0x99,
+    0xBC, 0x46, 0x55, 0x8F, 0x91, 0x91, 0x4E, 0x5A, 0x23, 0x89, 0x46, 0x7A, 0x70, 0x12, 0x11, 0xF1,
+    0xDC, 0x5D, 0x1B, 0x1C, 0x8F, 0x23, 0x3A, 0x34, 0xB1, 0x66, 0x04, 0x6B, 0xC3, 0x87, 0x16, 0xAB,
+    0xDC, 0xDD, 0xB5, 0x87, 0x54, 0x82, 0x4E, 0xBC, 0x91, 0x19, 0xC8, 0x26, 0xC0, 0xCA, 0x04, 0xAA,
+    0xF3, 0xFF, 0x9B, 0x5D, 0x2B, 0x26, 0x72, 0xDA, 0x90, 0x77, 0x40, 0xC7, 0x43, 0xC0, 0xF4, 0xA4,
+    0x4C, 0x04, 0x56, 0x33, 0xF9, 0xAB, 0xF4, 0xF5, 0xEA, 0xD8, 0xE6, 0x04, 0x1F, 0xD5, 0x11, 0x9A,
+    0xAE, 0x87, 0x46, 0xDA, 0xEC, 0x6F, 0x8E, 0x3A, 0x30, 0x38, 0x09, 0x56, 0xC6, 0x4A, 0x7A, 0xEE,
+    0xF6, 0x88, 0xC7, 0xF4, 0x2C, 0xA0, 0x47, 0x16, 0x20, 0x31, 0x03, 0x8D, 0x9A, 0x81, 0xFA, 0x95,
+    0x04, 0xD8, 0xEF, 0x4C, 0x80, 0xFE, 0xF9, 0x04, 0x90, 0x93, 0xCE, 0x66, 0x06, 0xA8, 0x5F, 0x0B,
+    0x80, 0xFD, 0xEE, 0x04, 0xE8, 0xD8, 0x78, 0x50, 0xC9, 0x44, 0x60, 0x8B, 0x00, 0x75, 0x5B, 0x0D,
+    0x60, 0xFB, 0x62, 0x01, 0x1D, 0x71, 0x03, 0x2A, 0xA1, 0x05, 0x23, 0x09, 0x37, 0x1A, 0x11, 0x8A,
+    0x6C, 0xA7, 0x4F, 0xF2, 0x16, 0x20, 0xD2, 0xC2, 0xDD, 0x7E, 0x0D, 0x12, 0xF5, 0x78, 0x98, 0x72,
+    0x73, 0x58, 0x23, 0xDB, 0x1F, 0x66, 0xFC, 0x78, 0x4C, 0x39, 0x1F, 0x56, 0xAD, 0x0A, 0x79, 0x99,
+    0x3F, 0x5E, 0x4C, 0x14, 0x83, 0xED, 0xB1, 0xDE, 0xC1, 0x4E, 0xCD, 0x7F, 0xF8, 0xF5, 0xA1, 0x13,
+    0x91, 0x4F, 0x8B, 0x48, 0x02, 0x2D, 0x11, 0xBA, 0x19, 0x2D, 0x31, 0xA7, 0xFD, 0x6E, 0x44, 0x4B,
+    0x0B, 0x6E, 0xA4, 0x14, 0x0F, 0xDB, 0x09, 0xDB, 0x79, 0xD8, 0x4F, 0x54, 0x0E, 0x98, 0x12, 0x1B,
+    0x07, 0x6A, 0x4C, 0xEC, 0x1C, 0x14, 0x31, 0x31, 0x3A, 0xD0, 0x71, 0x5F, 0x44, 0x07, 0x7A, 0xD8,
+    0xEB, 0xDE, 0x41, 0x19, 0xB6, 0x26, 0x6C, 0xC1, 0x06, 0x67, 0xD9, 0x82, 0x6D, 0xDD, 0x86, 0x2D,
+    0x54, 0xDE, 0x9D, 0x73, 0x05, 0x35, 0xF5, 0xC8, 0x1E, 0x1C, 0x75, 0x64, 0x0F, 0x17, 0x54, 0x3D,
+    0x7B, 0xD8, 0x61, 0x03, 0x09, 0x52, 0xB6, 0x44, 0x6A, 0xCA, 0x32, 0x52, 0x4B, 0x80, 0x4A, 0xFA,
+    0x46, 0x02, 0x38, 0xE9, 0xF3, 0x30, 0x13, 0x6E, 0x42, 0xCB, 0x44, 0x99, 0xA0, 0xF6, 0xE8, 0x05,
+    0x1C, 0x68, 0x81, 0x0D, 0x68, 0x69, 0xD9, 0x40, 0x79, 0x3F, 0x70, 0x01, 0xE6, 0x5B, 0x3D, 0x3B,
+    0xB0, 0x6F, 0x45, 0x12, 0xD8, 0x3F, 0x19, 0x99, 0xA0, 0xFA, 0xE4, 0xC4, 0x08, 0x15, 0x49, 0x8D,
+    0x50, 0x73, 0x55, 0x44, 0x70, 0x38, 0x1D, 0x61, 0x83, 0xFB, 0x93, 0x01, 0x2E, 0xA8, 0xDE, 0xEC,
+    0x61, 0x87, 0xFD, 0x5E, 0x80, 0x44, 0xF9, 0x30, 0x40, 0x42, 0x4B, 0x80, 0x09, 0x25, 0x2D, 0x6A,
+    0x04, 0xF1, 0xD4, 0xD2, 0xD2, 0x41, 0x27, 0x6D, 0xDE, 0x97, 0x83, 0x1B, 0x06, 0xA0, 0x13, 0x0F,
+    0xB5, 0x48, 0xA0, 0x5C, 0xCE, 0x24, 0xD0, 0xB4, 0x34, 0x6D, 0x39, 0x42, 0x87, 0x6B, 0x73, 0xAC,
+    0x48, 0x91, 0x6C, 0x00, 0x13, 0x3B, 0xA0, 0x7A, 0x73, 0x04, 0x1A, 0x1B, 0x40, 0xA5, 0x06, 0x30,
+    0x3F, 0x4F, 0x80, 0xFB, 0x72, 0x04, 0xE6, 0x3A, 0x40, 0x19, 0x3B, 0xC0, 0xBD, 0x92, 0x40, 0x25,
+    0x3D, 0x82, 0xED, 0x6D, 0x84, 0x85, 0x6A, 0xA0, 0x8A, 0xD4, 0xE3, 0x3F, 0x5E, 0xA0, 0x16, 0xE9,
+    0xA1, 0xCA, 0x92, 0xFA, 0x98, 0x33, 0x6A, 0xE9, 0x44, 0x46, 0xBE, 0x3A, 0x95, 0x89, 0x62, 0x64,
+    0x41, 0x47, 0x9A, 0x7C, 0x2A, 0x57, 0xB4, 0x6D, 0x8B, 0xED, 0x99, 0xB1, 0xA1, 0x98, 0xB0, 0xC1,
+    0x44, 0xAA, 0xFF, 0xDC, 0x05, 0x6A, 0x99, 0xC1, 0xC9, 0xBD, 0xBF, 0x97, 0x0D, 0x86, 0x5A, 0xEE,
+    0x01, 0x45, 0x8E, 0xBD, 0xAA, 0x07, 0x9F, 0x17, 0xC8, 0x8B, 0x81, 0x5A, 0xA0, 0x0E, 0xE8, 0x6C,
+    0x42, 0x4C, 0x04, 0x1B, 0xB1, 0x3D, 0x98, 0x98, 0x23, 0xFD, 0x88, 0xF3, 0xF9, 0x23, 0xA7, 0x93,
+    0x4D, 0x36, 0x0B, 0x5D, 0xD6, 0x86, 0xAB, 0xAC, 0x22, 0x57, 0x40, 0x1D, 0xE8, 0xB2, 0x51, 0x68,
+    0xB2, 0xCB, 0x5E, 0x6D, 0xA2, 0x0B, 0x94, 0x13, 0xD8, 0x81, 0x6A, 0x00, 0x33, 0x3F, 0x25, 0x1E,
+    0x0A, 0xC9, 0xD1, 0x49, 0x23, 0x2D, 0x80, 0xCD, 0xE6, 0x41, 0xE5, 0x5F, 0xD4, 0x39, 0x04, 0xD3,
+    0xF2, 0xEE, 0x3A, 0xFA, 0xE5, 0x6B, 0x8F, 0x86, 0xCF, 0x2D, 0x19, 0x1E, 0x8B, 0x30, 0x54, 0x27,
+    0x6F, 0x93, 0x03, 0x9C, 0x67, 0xEE, 0xB6, 0x5D, 0x8B, 0x1E, 0x55, 0x02, 0xB7, 0x26, 0xD1, 0x7B,
+    0xF2, 0x9A, 0x9A, 0x81, 0xB4, 0xFA, 0x72, 0x1B, 0x4C, 0x84, 0x54, 0xCE, 0x50, 0xC9, 0x42, 0xC6,
+    0xEA, 0x70, 0x7F, 0xD6, 0x83, 0x8E, 0x0E, 0x68, 0xF4, 0x08, 0xE5, 0x50, 0x05, 0xD8, 0x23, 0x60,
+    0x83, 0x9E, 0x20, 0x51, 0x0D, 0x54, 0x81, 0xAE, 0xAD, 0x65, 0x28, 0xE4, 0xD3, 0xB2, 0x50, 0x26,
+    0x8E, 0x69, 0x3E, 0x74, 0x8B, 0x2F, 0x44, 0xA6, 0x62, 0x56, 0xB3, 0x4A, 0x54, 0x7E, 0x4F, 0x19,
+    0x1C, 0x6A, 0xB0, 0x3D, 0xFF, 0x4A, 0x27, 0xA0, 0x6B, 0xC1, 0xCE, 0x80, 0x0C, 0x60, 0xC4, 0x43,
+    0x33, 0xE6, 0x8C, 0x98, 0x2A, 0x7E, 0x98, 0x22, 0x59, 0x70, 0x65, 0xC0, 0xBE, 0x31, 0x52, 0x0E,
+    0x57, 0xE8, 0x58, 0xBF, 0x5D, 0x4E, 0xA5, 0xC8, 0x44, 0x25, 0x43, 0xEE, 0xA8, 0x12, 0x11, 0xA9,
+    0x45, 0x44, 0xDC, 0x65, 0x77, 0x79, 0xB5, 0xE1, 0x8A, 0xD3, 0xDB, 0xEC, 0xB9, 0x7D, 0x9B, 0x99,
+    0xDB, 0x1F, 0x27, 0xF1, 0xC5, 0x6B, 0x56, 0xFD, 0x91, 0x41, 0xFF, 0x3B, 0xAC, 0x7A, 0xFB, 0x98,
+    0x55, 0x6F, 0xFC, 0x9A, 0x69, 0xD5, 0x92, 0xA0, 0x91, 0xA0, 0x25, 0x75, 0xD2, 0x6A, 0x99, 0xCA,
+    0x11, 0x1A, 0x9F, 0xFD, 0x59, 0xC6, 0x96, 0xCC, 0x00, 0x17, 0xD8, 0x1E, 0x2E, 0x56, 0x18, 0xAD,
+    0x0A, 0x90, 0xA8, 0x5A, 0x98, 0xA8, 0x3D, 0x6A, 0xC4, 0x79, 0x54, 0xC4, 0x41, 0x11, 0x1F, 0x85,
+    0x4E, 0x7A, 0xE0, 0x0A, 0xCA, 0x9E, 0x2B, 0x30, 0x81, 0x2B, 0xB0, 0x2D, 0x1D, 0x38, 0x68, 0x5A,
+    0x66, 0x70, 0x0F, 0xEE, 0x4E, 0x60, 0x45, 0xFA, 0xC3, 0x1E, 0xE5, 0xA5, 0x76, 0x32, 0x94, 0x92,
+    0x1A, 0x09, 0x46, 0x26, 0xF3, 0x00, 0x1A, 0xAF, 0x47, 0xD8, 0xAE, 0x10, 0x8A, 0x1E, 0x29, 0x26,
+    0x8A, 0x1C, 0xDF, 0x4D, 0x98, 0x1E, 0x95, 0xB0, 0x01, 0x12, 0xB5, 0x87, 0xB4, 0x3A, 0xD3, 0x1D,
+    0xB0, 0x57, 0x13, 0xB0, 0xD7, 0x11, 0xD8, 0x96, 0x03, 0xB0, 0xB5, 0x01, 0x70, 0x95, 0x07, 0x9C,
+    0x03, 0x70, 0x17, 0x00, 0x75, 0xE2, 0x90, 0xB2, 0x53, 0x0D, 0x1C, 0x96, 0xED, 0xA0, 0x5E, 0x91,
+    0x3F, 0xA2, 0x96, 0xBF, 0x92, 0x05, 0xDB, 0x6A, 0x99, 0xCB, 0x99, 0x22, 0x51, 0xCC, 0xD4, 0x2D,
+    0x2E, 0x50, 0xFB, 0x62, 0xA2, 0xCC, 0xC9, 0x5F, 0x40, 0x42, 0x8E, 0x9E, 0xAB, 0x84, 0x0D, 0x54,
+    0x41, 0x4B, 0x50, 0x23, 0x2A, 0x71, 0xB1, 0xC7, 0x41, 0x15, 0xEC, 0x5B, 0x7D, 0xD9, 0x43, 0x52,
+    0xE3, 0x45, 0x0E, 0x4E, 0x5C, 0x39, 0x58, 0x0F, 0xA9, 0xEC, 0xB7, 0x19, 0x8E, 0x4C, 0x7A, 0x38,
+    0x05, 0x52, 0xE5, 0x9D, 0x09, 0x60, 0xDF, 0x8C, 0x3A, 0x8E, 0xC0, 0xEE, 0x02, 0x57, 0x01, 0xE6,
+    0x5B, 0x41, 0xFF, 0x62, 0x00, 0xAE, 0x22, 0xF5, 0x0E, 0x28, 0x97, 0x9C, 0x3E, 0xD2, 0x84, 0x3C,
+    0x89, 0x72, 0x42, 0x2D, 0x64, 0x6F, 0x56, 0x85, 0xEB, 0xEA, 0x64, 0x65, 0xB2, 0x12, 0x69, 0x24,
+    0x38, 0x69, 0xA9, 0x46, 0xEC, 0x00, 0x75, 0x60, 0x0F, 0x38, 0x6F, 0x06, 0xA0, 0xCB, 0xB6, 0x27,
+    0xE9, 0x01, 0x28, 0x26, 0x07, 0xA0, 0x7F, 0x11, 0x01, 0x4C, 0xF6, 0xA8, 0x36, 0x5B, 0x1F, 0x17,
+    0xB2, 0x1E, 0x7B, 0xC8, 0x48, 0x0E, 0x14, 0x31, 0xBB, 0xEE, 0x4F, 0x24, 0xA0, 0x18, 0xF5, 0x08,
+    0x54, 0x6D, 0x19, 0x41, 0x25, 0x6C, 0x4F, 0x5E, 0x13, 0xD4, 0x0C, 0xAE, 0xA5, 0x13, 0x5F, 0xC9,
+    0x58, 0xCA, 0x8C, 0x48, 0xA0, 0x93, 0xE0, 0xE4, 0x07, 0x32, 0x69, 0x99, 0xAA, 0x91, 0x72, 0xA2,
+    0x5B, 0x77, 0xDD, 0x06, 0xEA, 0x56, 0x47, 0x54, 0x62, 0x0F, 0xB6, 0xAF, 0x5A, 0xB8, 0xD2, 0x11,
+    0x74, 0xDC, 0x01, 0xEE, 0x65, 0x0F, 0x4A, 0x06, 0xC0, 0xA6, 0x63, 0x42, 0x91, 0x93, 0xD5, 0x3D,
+    0x07, 0x65, 0xC8, 0x81, 0x67, 0x15, 0x0E, 0xAA, 0x93, 0xF3, 0x8C, 0x2E, 0xDB, 0xF2, 0x79, 0x0D,
+    0xDF, 0x67, 0x1A, 0x11, 0xE1, 0xEA, 0xF2, 0x72, 0x61, 0x42, 0x4F, 0x8C, 0x98, 0x48, 0xA4, 0x0E,
+    0xDC, 0xA3, 0x61, 0xC5, 0x4A, 0x72, 0xE8, 0x70, 0x00, 0xB4, 0xE8, 0x0E, 0xA6, 0xB9, 0x1C, 0x8F,
+    0x41, 0x44, 0x9B, 0xB3, 0xC4, 0xFF, 0x54, 0x24, 0x88, 0x65, 0xA4, 0x88, 0x55, 0x8F, 0x8E, 0xEE,
+    0x9D, 0xCB, 0xD7, 0xFA, 0x46, 0x44, 0x82, 0x13, 0x91, 0x43, 0x26, 0x2E, 0x3D, 0x55, 0x22, 0xBB,
+    0x49, 0xF4, 0x00, 0xA7, 0x19, 0xDE, 0xDC, 0x65, 0x10, 0x76, 0x82, 0xCA, 0x5F, 0xBF, 0x7D, 0x91,
+    0xB1, 0xD2, 0xF5, 0xF6, 0x08, 0x55, 0x06, 0x47, 0x37, 0xA0, 0xFB, 0xE3, 0xED, 0x04, 0x36, 0x3B,
+    0xD2, 0x3A, 0xA3, 0x0B, 0x2E, 0x9B, 0xE1, 0x3F, 0x86, 0xCA, 0x93, 0xA9, 0x05, 0xAC, 0x47, 0x47,
+    0x38, 0x07, 0xDB, 0x52, 0x44, 0xB8, 0x38, 0x7E, 0x3B, 0xCD, 0xFF, 0xCF, 0xDF, 0x4C, 0x40, 0xE5,
+    0x1E, 0x4C, 0x80, 0x11, 0x36, 0x79, 0x88, 0xB9, 0x75, 0xE5, 0x0F, 0x93, 0xC0, 0x04, 0x98, 0xC0,
+    0xFA, 0x43, 0xCF, 0xD9, 0xED, 0x53, 0xF6, 0x70, 0xFE, 0xD8, 0xED, 0x0C, 0x67, 0xEB, 0xE1, 0x78,
+    0x7B, 0x97, 0xB5, 0xEE, 0xD1, 0x74, 0xEB, 0x27, 0x56, 0xE3, 0xDA, 0x24, 0x28, 0x63, 0x46, 0x3D,
+    0xED, 0x04, 0xF5, 0x0E, 0x36, 0x1B, 0xB8, 0x70, 0xB0, 0xAB, 0x3C, 0x93, 0x6D, 0x8B, 0x68, 0x82,
+    0x8E, 0x7A, 0x28, 0x7B, 0x1D, 0x6D, 0x50, 0xA3, 0x6D, 0x49, 0x35, 0xEC, 0x5E, 0x80, 0xD3, 0xB3,
+    0xB3, 0xB3, 0x33, 0x27, 0x22, 0xF7, 0x45, 0x64, 0x44, 0x45, 0xDB, 0xD7, 0xA1, 0x0E, 0x75, 0x5B,
+    0x71, 0x23, 0xB7, 0xDD, 0x0C, 0xAF, 0x53, 0xCB, 0x7D, 0xEC, 0xBB, 0x5D, 0x2C, 0x26, 0x16, 0x1A,
+    0x4C, 0xB0, 0x81, 0xA4, 0x26, 0x6C, 0x5B, 0xA3, 0x46, 0x1D, 0x71, 0x6C, 0x29, 0x63, 0x39, 0xB0,
+    0xB0, 0xA7, 0x1E, 0xCC, 0x50, 0xEE, 0x9F, 0xEE, 0x8A, 0x5F, 0x7C, 0xE7, 0x7B, 0x4B, 0xDA, 0x24,
+    0x27, 0x5A, 0x94, 0xB4, 0xAE, 0x55, 0x1E, 0x0F, 0x27, 0x1E, 0xBA, 0x11, 0xDC, 0xBC, 0x06, 0x98,
+    0x36, 0xE4, 0xA9, 0xA9, 0x71, 0xA5, 0x09, 0x1C, 0x60, 0x5F, 0x11, 0x5F, 0x7E, 0x5B, 0x62, 0xF1,
+    0xF3, 0xF7, 0x16, 0xE6, 0x58, 0x87, 0x4D, 0x2C, 0xA3, 0x8D, 0x2A, 0x95, 0x13, 0x4D, 0x91, 0xA8,
+    0xDA, 0x19, 0xD3, 0x3B, 0x74, 0xAC, 0x5A, 0x92, 0xE9, 0xD9, 0xEB, 0x48, 0xC3, 0x84, 0xA3, 0xBB,
+    0xD7, 0x78, 0x27, 0xE2, 0xED, 0x6B, 0x0B, 0x47, 0xC8, 0x55, 0x49, 0xAF, 0x25, 0xE9, 0x07, 0x57,
+    0x3A, 0xAA, 0x22, 0xC2, 0x04, 0xBB, 0x6C, 0x11, 0x5A, 0xCA, 0x81, 0x62, 0x82, 0x2B, 0xA8, 0x03,
+    0x5F, 0x8A, 0x2A, 0xCA, 0x9F, 0x8D, 0xB5, 0xC4, 0x42, 0xFA, 0xD5, 0xDD, 0x9D, 0xF8, 0xCC, 0x0D,
+    0x69, 0x19, 0x56, 0x35, 0xB2, 0x61, 0x55, 0x22, 0xDB, 0xE6, 0x24, 0x80, 0xDA, 0xD3, 0xFC, 0x55,
+    0xA4, 0x16, 0xC1, 0xBC, 0xDB, 0x0D, 0x6A, 0x62, 0xC6, 0xAD, 0x4B, 0xC5, 0x63, 0x4B, 0xB5, 0xF9,
+    0x3F, 0x5E, 0x2A, 0x80, 0x66, 0xC4, 0x49, 0xB0, 0x61, 0xAF, 0x87, 0xB2, 0xDF, 0xB1, 0xB7, 0x6D,
+    0xF5, 0x46, 0x34, 0xD1, 0x95, 0xA9, 0x7C, 0xB8, 0xD0, 0xCC, 0x98, 0x11, 0xF6, 0x60, 0x7A, 0x3E,
+    0xD2, 0x50, 0xBD, 0xB8, 0xDC, 0x1D, 0x6A, 0x99, 0xE8, 0xA6, 0x63, 0x3C, 0xA6, 0x0E, 0xED, 0xAC,
+    0xD0, 0x2C, 0xA6, 0xDF, 0x01, 0xB6, 0xBD, 0x49, 0x66, 0x73, 0xD6, 0x48, 0x2B, 0x5B, 0xBA, 0x6C,
+    0x25, 0x9E, 0x91, 0x4C, 0x20, 0x2C, 0xC0, 0xE7, 0x1E, 0x7C, 0x96, 0x75, 0x77, 0x32, 0xED, 0xB0,
+    0x26, 0xEB, 0xF9, 0x5C, 0x0E, 0xC0, 0x0A, 0x07, 0x66, 0x3F, 0xB1, 0x9E, 0x5B, 0x0E, 0xBE, 0x96,
+    0xDA, 0x3F, 0xEA, 0xE4, 0x7D, 0x5D, 0xAD, 0x30, 0x52, 0xE2, 0xD0, 0xC9, 0xA9, 0x8E, 0x40, 0x73,
+    0x3F, 0x00, 0x4E, 0x00, 0x9E, 0xF9, 0xCA, 0xF5, 0x18, 0x48, 0x24, 0x81, 0x88, 0xB4, 0x38, 0x3F,
+    0xDF, 0xC3, 0xF4, 0x59, 0x8F, 0xCE, 0xA1, 0xF2, 0x26, 0x50, 0x44, 0x12, 0xD4, 0xBE, 0xF6, 0xA8,
+    0x64, 0x7A, 0xB0, 0x32, 0xB2, 0xA6, 0x65, 0x79, 0x12, 0xBB, 0x47, 0x76, 0x50, 0x7A, 0x56, 0x28,
+    0xA5, 0xF9, 0xA9, 0x04, 0xEA, 0xBE, 0x10, 0xCA, 0x48, 0x39, 0xB1, 0x87, 0xAA, 0x35, 0x03, 0xC5,
+    0x48, 0xE3, 0xE9, 0xD0, 0xF2, 0x8E, 0x04, 0x8C, 0xC8, 0x00, 0x4F, 0x5D, 0xDE, 0x01, 0x9E, 0x23,
+    0x0B, 0xB2, 0x95, 0xF7, 0x01, 0xEA, 0x4F, 0x88, 0x48, 0x13, 0xD4, 0xE8, 0x16, 0x6A, 0x7B, 0x3F,
+    0xEA, 0x5F, 0x0C, 0x8E, 0xCD, 0xEB, 0x7A, 0x28, 0xEF, 0x73, 0x41, 0x17, 0x4C, 0xB0, 0x23, 0x09,
+    0xC1, 0xB6, 0x36, 0xA8, 0x51, 0x25, 0x6A, 0x6A, 0xAF, 0xA3, 0x8E, 0x6C, 0x9E, 0x76, 0x94, 0xDF,
+    0xF9, 0xDE, 0x40, 0x97, 0xF6, 0x18, 0xB1, 0x81, 0xA6, 0xCD, 0x10, 0xAA, 0x82, 0x44, 0xDD, 0xEB,
+    0xB4, 0xAE, 0xEC, 0x1A, 0x1B, 0x06, 0x37, 0xAB, 0x97, 0x03, 0x29, 0x23, 0xAE, 0x2E, 0x87, 0x1E,
+    0xA6, 0x27, 0x51, 0x85, 0x62, 0xFA, 0x88, 0xFB, 0x8C, 0x96, 0xC1, 0x4D, 0x7A, 0x5E, 0x55, 0xFB,
+    0xC6, 0xEA, 0x02, 0x6C, 0xCC, 0xD0, 0xF7, 0x01, 0x0D, 0x7C, 0xEC, 0xB8, 0x95, 0xC0, 0x0A, 0xA8,
+    0x97, 0x43, 0x9E, 0xA4, 0x9A, 0x56, 0x52, 0xAF, 0x3E, 0xA8, 0xEE, 0xE1, 0xE2, 0xFE, 0x9A, 0x3E,
+    0x97, 0xC3, 0x9A, 0x65, 0xA7, 0x95, 0x98, 0xAA, 0xFD, 0xF1, 0xC6, 0x0D, 0x1D, 0x29, 0xFF, 0xC3,
+    0x88, 0x96, 0x29, 0x43, 0xE4, 0x4F, 0xDD, 0x23, 0x2F, 0x67, 0x29, 0x01, 0x23, 0x6D, 0x16, 0x9B,
+    0xDA, 0xE7, 0xE6, 0xDC, 0x2A, 0x2E, 0x3B, 0x60, 0x57, 0x4D, 0x4C, 0xDD, 0xCC, 0xC3, 0x61, 0xAF,
+    0xC4, 0x5F, 0x14, 0x33, 0x3B, 0x3D, 0xA9, 0x49, 0xC7, 0x32, 0x96, 0x7D, 0xD3, 0x1A, 0x99, 0xB1,
+    0xD2, 0x63, 0xBF, 0x15, 0xB0, 0x5F, 0x1A, 0xA8, 0x5E, 0x9C, 0xA8, 0xD5, 0x82, 0xA3, 0xEB, 0x1D,
+    0xB5, 0x5C, 0x64, 0x36, 0xE2, 0x0E, 0xCF, 0x15, 0xD2, 0xCB, 0xC8, 0x0E, 0x87, 0x0D, 0xE5, 0x50,
+    0x8C, 0x24, 0x1C, 0x55, 0x6B, 0x7A, 0x1D, 0x49, 0x6C, 0xA8, 0xBC, 0x09, 0x3A, 0x92, 0xD8, 0x52,
+    0x7B, 0xFB, 0xCD, 0x17, 0x7F, 0xF6, 0x43, 0x19, 0x9B, 0xD1, 0x46, 0x8E, 0xEB, 0x7D, 0x6B, 0x2A,
+    0x66, 0x9A, 0xD0, 0x4C, 0x95, 0x14, 0xD2, 0x3F, 0x37, 0x35, 0x9D, 0xBD, 0x3F, 0xA8, 0x77, 0x47,
+    0xB7, 0x29, 0x07, 0xF5, 0xCB, 0x7E, 0xF3, 0xBA, 0xE9, 0x8B, 0x87, 0xDE, 0x45, 0x13, 0xF4, 0x42,
+    0x13, 0x6C, 0xD0, 0x89, 0xCE, 0xDB, 0xB6, 0x1C, 0x11, 0x2A, 0x6F, 0x22, 0x33, 0x35, 0xB6, 0x57,
+    0x09, 0x87, 0x0D, 0xC5, 0xC8, 0x86, 0xAA, 0xD5, 0x91, 0x8B, 0xA7, 0x6B, 0xAF, 0x23, 0xBB, 0xDB,
+    0x35, 0xE5, 0xC0, 0x32, 0x39, 0x4C, 0x8F, 0x0C, 0x1B, 0x6C, 0xA0, 0xF3, 0xD7, 0xF3, 0xBE, 0xBB,
+    0x83, 0x99, 0x4A, 0x79, 0x45, 0xC6, 0x93, 0x6D, 0x75, 0x7F, 0x50, 0xEF, 0x8E, 0xB5, 0x2F, 0x7F,
+    0xE0, 0xF7, 0xD4, 0xDF, 0xD0, 0x11, 0x69, 0x6D, 0xD0, 0x89, 0x2D, 0x55, 0x5F, 0x8C, 0x74, 0xD8,
+    0xA0, 0x47, 0x1C, 0x36, 0xA8, 0x89, 0x2D, 0xA6, 0x7F, 0x75, 0xC4, 0x55, 0x26, 0xB0, 0x4C, 0x0E,
+    0x2D, 0xED, 0x94, 0x69, 0xB3, 0x1B, 0x07, 0xE2, 0x58, 0x5A, 0x9C, 0x44, 0x96, 0x4F, 0x25, 0x3D,
+    0x32, 0x9B, 0x81, 0xB9, 0x0A, 0x5C, 0xD5, 0x9E, 0x2B, 0x07, 0xFB, 0x06, 0xE6, 0x2D, 0xA4, 0x2B,
+    0xD4, 0x74, 0x85, 0x1E, 0xAF, 0x30, 0x43, 0x43, 0x15, 0x5C, 0xE8, 0xA8, 0x24, 0x65, 0x5E, 0xE1,
+    0xD9, 0x23, 0x2E, 0xDA, 0x57, 0x51, 0xC9, 0x20, 0x89, 0xCF, 0x7F, 0xF7, 0x61, 0xA2, 0xFC, 0x7E,
+    0x3B, 0x53, 0xFE, 0x77, 0xAE, 0x30, 0x89, 0x2B, 0x6C, 0x64, 0x8F, 0x1D, 0x98, 0xA9, 0x02, 0x89,
+    0xBA, 0x25, 0x51, 0x73, 0x10, 0xE0, 0x0D, 0xA6, 0xE7, 0x82, 0x2A, 0xD0, 0xDD, 0xEB, 0x40, 0x24,
+    0xC1, 0x7B, 0xD2, 0xA3, 0xC6, 0x67, 0x0F, 0x38, 0xCE, 0x31, 0xE2, 0xD7, 0x03, 0x50, 0x3D, 0xF0,
+    0x6B, 0x24, 0x73, 0x76, 0xE6, 0x8F, 0x26, 0xE3, 0xD5, 0x41, 0xCB, 0x12, 0xF5, 0x83, 0xBB, 0x49,
+    0x8F, 0x6A, 0x51, 0x13, 0x35, 0x09, 0x1B, 0x2E, 0xD0, 0x83, 0x43, 0x8D, 0x36, 0x90, 0xCA, 0x81,
+    0x46, 0x4D, 0xB8, 0x76, 0x4F, 0xDD, 0xD7, 0x6D, 0x35, 0x9A, 0x58, 0x9D, 0xAB, 0xA5, 0xA9, 0x71,
+    0x62, 0xDB, 0x72, 0xD1, 0x03, 0xCF, 0x1E, 0x5D, 0xD4, 0x75, 0xE1, 0x37, 0x8B, 0xA7, 0x96, 0xC8,
+    0xC9, 0xD9, 0x67, 0xB3, 0x1E, 0xB6, 0x73, 0x93, 0xDC, 0x0F, 0x5F, 0xFE, 0xF7, 0x33, 0xEF, 0xBE,
+    0xDB, 0x56, 0xE7, 0xA8, 0x87, 0x9E, 0x7A, 0x40, 0x27, 0x70, 0x2D, 0x65, 0xCC, 0x9C, 0x7C, 0x8E,
+    0x4A, 0xAA, 0x36, 0x23, 0xDB, 0x07, 0x73, 0x0A, 0x85, 0x84, 0x52, 0xA6, 0xF2, 0xC7, 0x5B, 0x1D,
+    0x15, 0x09, 0x9C, 0xC7, 0x4C, 0x20, 0x01, 0x9B, 0xA0, 0x0B, 0x94, 0x23, 0x5C, 0xFD, 0x0E, 0xD5,
+    0x97, 0x43, 0xF9, 0xC6, 0xF2, 0xA9, 0xA1, 0x91, 0xA1, 0x94, 0x1E, 0x95, 0x2D, 0x7D, 0x05, 0x1B,
+    0xB8, 0x80, 0x1D, 0xFF, 0x44, 0xA4, 0x93, 0xE5, 0x73, 0x0F, 0x3E, 0x5B, 0x8C, 0xE8, 0x0C, 0x04,
+    0x0F, 0x94, 0x3D, 0x26, 0x60, 0x03, 0x36, 0x50, 0xB5, 0xD4, 0xFE, 0xE3, 0xF5, 0x27, 0xA6, 0xFA,
+    0x7E, 0xAC, 0x25, 0xD8, 0x99, 0x83, 0x78, 0xDF, 0x8D, 0xD4, 0xA5, 0x04, 0x95, 0x4E, 0x1A, 0xCA,
+    0x81, 0x44, 0xED, 0xD7, 0x0F, 0x1D, 0x49, 0x59, 0x4E, 0xF7, 0xC7, 0x8F, 0xA0, 0x23, 0x0B, 0x36,
+    0x98, 0x91, 0x2D, 0x7F, 0xDE, 0xBF, 0x32, 0x99, 0x6F, 0xD9, 0xF2, 0xDD, 0xB4, 0x9D, 0xAC, 0x04,
+    0x09, 0xF5, 0xA4, 0x27, 0x6E, 0x1C, 0x08, 0xA0, 0xA7, 0x12, 0xEE, 0x4B, 0xE2, 0x4D, 0x7C, 0x69,
+    0x20, 0xA9, 0x84, 0xC3, 0x61, 0x83, 0xE9, 0xF5, 0x50, 0x8C, 0x45, 0x64, 0xCB, 0x84, 0x6D, 0xCF,
+    0xD1, 0x71, 0x03, 0xA9, 0x86, 0xBA, 0xF2, 0x98, 0x6F, 0xB5, 0x14, 0x12, 0x32, 0xF7, 0x5A, 0x05,
+    0x28, 0xDB, 0x6B, 0x16, 0xEA, 0xC6, 0x53, 0x89, 0x86, 0xEA, 0x2F, 0xC4, 0xDB, 0x5E, 0x4F, 0x2F,
+    0x0D, 0x7A, 0x62, 0x21, 0xD1, 0x51, 0xB7, 0x8E, 0x2A, 0x98, 0xDE, 0xF4, 0x26, 0x16, 0x51, 0x4D,
+    0x7A, 0x26, 0xE1, 0x10, 0x7F, 0x8A, 0x0D, 0xDD, 0x50, 0x53, 0xC4, 0xD3, 0xC9, 0x7A, 0x76, 0x75,
+    0x6D, 0x02, 0x95, 0x35, 0x6F, 0xF6, 0x94, 0x6F, 0xBD, 0xF2, 0x8B, 0x01, 0xF5, 0x30, 0x6C, 0x23,
+    0x34, 0xA1, 0x8A, 0x50, 0x85, 0x32, 0x82, 0x0E, 0x3C, 0xC1, 0x8C, 0x35, 0x5E, 0xCD, 0x5A, 0x82,
+    0x99, 0xF5, 0xFD, 0xA1, 0xFE, 0x5B, 0xCA, 0x78, 0x01, 0x7A, 0x9C, 0x40, 0xBD, 0x17, 0x01, 0x09,
+    0x2B, 0x0B, 0x9D, 0x11, 0x8C, 0x8C, 0x04, 0xB4, 0x50, 0x7E, 0x2B, 0x80, 0xFD, 0x74, 0x0F, 0x9B,
+    0x32, 0xF2, 0xCF, 0x93, 0x7E, 0x6F, 0x74, 0xB1, 0x90, 0xE8, 0x02, 0x8B, 0xBF, 0x71, 0x8D, 0x4C,
+    0x08, 0x2A, 0x21, 0x91, 0x85, 0x97, 0x22, 0x57, 0xE8, 0x91, 0x2D, 0x2A, 0x71, 0x01, 0x89, 0xF3,
+    0x35, 0xA9, 0xBB, 0x60, 0x84, 0xAD, 0x8A, 0xB0, 0xD1, 0x03, 0x6C, 0xCA, 0x00, 0xCE, 0xB6, 0xE4,
+    0xCC, 0xE8, 0x85, 0x53, 0xE0, 0x85, 0xD7, 0x01, 0x77, 0xA4, 0x5F, 0xDD, 0x11, 0x1B, 0x9D, 0x56,
+    0x5F, 0xF5, 0xC5, 0xC6, 0xAF, 0x54, 0xAA, 0x0C, 0xC0, 0x1F, 0x1C, 0x0B, 0x5F, 0x16, 0x7F, 0x6E,
+    0x64, 0x4C, 0x56, 0x64, 0xB2, 0x34, 0xC3, 0xEF, 0x62, 0xC3, 0x8D, 0x03, 0x38, 0xAB, 0xD7, 0x4A,
+    0x11, 0x97, 0xCD, 0x7E, 0x31, 0x82, 0xE9, 0xB9, 0x53, 0xF7, 0xC4, 0x46, 0x1E, 0xC6, 0x59, 0x24,
+    0xBE, 0x7E, 0x4B, 0xC2, 0xD1, 0x06, 0x54, 0x91, 0x6A, 0xC4, 0xB6, 0x98, 0x80, 0x1E, 0x50, 0x11,
+    0x76, 0x50, 0x43, 0xF6, 0xD7, 0xEC, 0x60, 0x03, 0x95, 0xA7, 0x6A, 0x71, 0x2D, 0xB6, 0xCF, 0xBA,
+    0x01, 0x65, 0xBE, 0x3F, 0xC1, 0x05, 0x38, 0xB0, 0xED, 0xB5, 0x4B, 0x1B, 0xB0, 0x81, 0x62, 0x69,
+    0x71, 0xC3, 0xB1, 0x68, 0x67, 0x87, 0x6D, 0x19, 0xB1, 0x5E, 0x1D, 0x4B, 0xB8, 0xCA, 0xC0, 0x39,
+    0x26, 0x30, 0x1D, 0xAE, 0x16, 0x91, 0x0D, 0xBA, 0x3F, 0x5E, 0x6D, 0x19, 0xA9, 0x8E, 0x57, 0x4F,
+    0x73, 0x39, 0x05, 0x14, 0x4B, 0x5E, 0x94, 0x74, 0x18, 0xAA, 0x1E, 0x60, 0x84, 0xF3, 0x3C, 0x14,
+    0x8F, 0x09, 0xE8, 0x3C, 0x14, 0x97, 0x59, 0xE4, 0x19, 0x16, 0x48, 0x70, 0x71, 0xFC, 0xCB, 0xA3,
+    0xA1, 0xB6, 0x87, 0xFF, 0xEF, 0x60, 0xCB, 0x53, 0x82, 0x5E, 0xE0, 0xB3, 0x80, 0x7A, 0x9D, 0xA7,
+    0xAD, 0xB4, 0x2F, 0xD4, 0x32, 0x5E, 0x6D, 0x4A, 0x49, 0xB7, 0x69, 0x22, 0x9C, 0x78, 0x14, 0xCF,
+    0x52, 0xF9, 0x1D, 0x57, 0x3A, 0xEA, 0xA9, 0x0A, 0x76, 0x68, 0x70, 0xAF, 0x26, 0x3A, 0x3D, 0xD2,
+    0xE9, 0x09, 0xF7, 0x89, 0x84, 0x0D, 0x5B, 0xF4, 0x50, 0x79, 0xC6, 0x32, 0x70, 0x53, 0x79, 0xC5,
+    0x0D, 0x74, 0x5F, 0xA1, 0x46, 0x13, 0xD8, 0xEB, 0x88, 0xFB, 0x64, 0xA2, 0x0E, 0x0B, 0x55, 0x58,
+    0x70, 0xAF, 0x26, 0x66, 0x13, 0xF5, 0x58, 0x05, 0x1B, 0xB6, 0x6C, 0xD4, 0xC8, 0xB3, 0x5C, 0xAB,
+    0xD7, 0xF9, 0x5D, 0x1E, 0x25, 0x8B, 0x2B, 0x5E, 0x5C, 0x67, 0xA9, 0xEF, 0xB2, 0x1D, 0xF5, 0x1F,
+    0x7C, 0x0E, 0x30, 0x0F, 0xF1, 0x1B, 0xC0, 0x9A, 0xF5, 0xE7, 0x94, 0xDC, 0x88, 0x07, 0xCA, 0x07,
+    0xD7, 0x9E, 0xF9, 0x80, 0x73, 0x99, 0xD7, 0x42, 0xE6, 0xC8, 0x31, 0x14, 0x6E, 0xCC, 0x00, 0x34,
+    0xEC, 0x80, 0x17, 0xF8, 0x47, 0xBF, 0x1D, 0xF3, 0x70, 0xE4, 0x0A, 0x04, 0x01, 0x6C, 0x74, 0x81,
+    0x2C, 0x9E, 0x4F, 0x1E, 0xFE, 0x5A, 0x6E, 0x91, 0xD3, 0x81, 0x8C, 0xA6, 0x48, 0x0F, 0xB0, 0x9F,
+    0x00, 0x4E, 0x1D, 0x40, 0x9D, 0xD1, 0xBC, 0x17, 0x23, 0x60, 0xDB, 0x3D, 0x50, 0x86, 0xBA, 0x05,
+    0x3D, 0x94, 0x91, 0x35, 0x03, 0x60, 0xC2, 0x01, 0x57, 0x97, 0xAF, 0xF5, 0xE0, 0x32, 0x35, 0x78,
+    0x79, 0x29, 0xD9, 0xCC, 0x04, 0x6C, 0x58, 0xC9, 0xFD, 0x4C, 0x11, 0xE3, 0xDA, 0x62, 0x04, 0x1B,
+    0x8D, 0xF4, 0xDC, 0x95, 0xB7, 0x64, 0xCA, 0x3C, 0xC9, 0x3F, 0x28, 0xB1, 0x7B, 0xE7, 0xB0, 0x12,
+    0xC5, 0xC2, 0xA1, 0xC0, 0x6B, 0x77, 0xE0, 0xAF, 0xAA, 0x1E, 0x1E, 0x13, 0x80, 0xE1, 0x11, 0x99,
+    0x18, 0x59, 0xA1, 0xD6, 0x5C, 0x15, 0xF5, 0x28, 0x14, 0xCB, 0xA8, 0x97, 0xC8, 0xA0, 0x45, 0x64,
+    0xE2, 0xD6, 0x7B, 0x99, 0x21, 0xB5, 0x9E, 0x84, 0x0E, 0x38, 0x18, 0x32, 0x2C, 0xF4, 0x24, 0x49,
+    0xE9, 0x2E, 0x17, 0xA8, 0x44, 0x3C, 0xE6, 0xBD, 0xCB, 0xF6, 0xFD, 0xF4, 0x65, 0xCB, 0x0D, 0xCC,
+    0x80, 0x45, 0x8F, 0x94, 0x81, 0x84, 0x1E, 0x68, 0x3E, 0xF7, 0xF5, 0xB1, 0x10, 0x91, 0x54, 0x88,
+    0x64, 0x48, 0xF3, 0x50, 0x9A, 0x77, 0x40, 0x16, 0xEB, 0xF1, 0x90, 0x99, 0xBA, 0x7B, 0xD7, 0xA2,
+    0xCF, 0x0F, 0xC6, 0x38, 0x73, 0x4C, 0x29, 0xAC, 0x1C, 0x96, 0x1E, 0xAF, 0xA0, 0x8C, 0x26, 0x50,
+    0x0C, 0xFC, 0xC7, 0x0F, 0xCE, 0x38, 0x8B, 0xD1, 0x06, 0xD4, 0x62, 0x46, 0xE8, 0x5E, 0x4C, 0x50,
+    0xF9, 0x8B, 0xF7, 0x69, 0xD6, 0x3F, 0x18, 0x19, 0x7F, 0xF0, 0x2A, 0x57, 0xD9, 0xA1, 0x68, 0x01,
+    0x75, 0xF5, 0x18, 0x73, 0x25, 0x12, 0xB4, 0xCC, 0xA8, 0x2E, 0x97, 0x71, 0x5E, 0x23, 0x77, 0xCD,
+    0x70, 0x24, 0xAD, 0x0F, 0x0C, 0xF0, 0xD5, 0x63, 0x8C, 0xB1, 0x9A, 0x1E, 0x7B, 0xA8, 0x8C, 0x14,
+    0x32, 0x53, 0x67, 0x32, 0xEA, 0x06, 0xF0, 0xB1, 0x8C, 0x51, 0xDA, 0x04, 0xDD, 0x98, 0xDD, 0x81,
+    0xBF, 0xBE, 0x28, 0x11, 0x27, 0x3D, 0x4F, 0xCD, 0x59, 0xA3, 0xF4, 0x5A, 0x9A, 0x5A, 0xC6, 0xDC,
+    0xEC, 0x8A, 0xD0, 0x62, 0xD7, 0xA8, 0xB3, 0x6E, 0xD7, 0xF2, 0xB1, 0x75, 0x93, 0xB6, 0x2B, 0x27,
+    0x35, 0xAF, 0x95, 0xAD, 0x09, 0x6A, 0xE9, 0x73, 0xEE, 0xC1, 0x01, 0x5F, 0x6D, 0x32, 0xEB, 0x59,
+    0xC6, 0x99, 0x2A, 0x38, 0x9E, 0xE7, 0x77, 0xFE, 0xBF, 0xF5, 0xAF, 0xA3, 0x0D, 0xC5, 0x6C, 0x23,
+    0xA2, 0x13, 0x95, 0x7F, 0xFD, 0x49, 0x91, 0x88, 0x19, 0x19, 0xB9, 0xBB, 0x16, 0xEE, 0xEA, 0x43,
+    0xBA, 0xDE, 0xAC, 0xB2, 0x60, 0xFB, 0x75, 0xBF, 0x7F, 0xD5, 0x45, 0x95, 0xD6, 0x11, 0x3C, 0x79,
+    0xD1, 0xC8, 0xC8, 0xCA, 0xC9, 0x53, 0xFB, 0x00, 0x20, 0x6F, 0x0C, 0x99, 0xD3, 0xEA, 0x81, 0xE2,
+    0xDB, 0xD2, 0x02, 0x2A, 0x6C, 0xF9, 0x5F, 0x1C, 0xBF, 0x65, 0xCC, 0xEB, 0xC7, 0x39, 0xAA, 0x44,
+    0xA6, 0xC8, 0xCC, 0xCC, 0xA1, 0xC8, 0xF1, 0x3A, 0x27, 0xFA, 0x41, 0xE4, 0x69, 0x0F, 0xB5, 0xA8,
+    0x19, 0x59, 0x32, 0x73, 0x06, 0x4A, 0x01, 0xFB, 0xF6, 0x13, 0xB3, 0xFC, 0x80, 0x8E, 0x3E, 0xD7,
+    0x7E, 0x24, 0x80, 0xE5, 0x58, 0x3F, 0xA1, 0x52, 0x11, 0xC1, 0xB4, 0x45, 0xFB, 0xC1, 0x1E, 0xFD,
+    0xBE, 0x88, 0x50, 0x4E, 0x75, 0x7F, 0x88, 0x8D, 0x2E, 0xD4, 0xF8, 0xAB, 0x14, 0xA2, 0x96, 0x1E,
+    0x8C, 0x48, 0x44, 0xC9, 0x9F, 0x36, 0x91, 0x6A, 0xA0, 0x1A, 0xD4, 0x0C, 0x75, 0xB0, 0x03, 0xB8,
+    0xB6, 0x03, 0x3A, 0x1D, 0xA1, 0x48, 0x79, 0x54, 0x33, 0x50, 0xBD, 0x19, 0x81, 0xA6, 0x0A, 0x50,
+    0xA4, 0x0E, 0xB0, 0x3F, 0x4A, 0x80, 0xFB, 0x74, 0x24, 0x97, 0x79, 0x63, 0x87, 0x5C, 0x15, 0x3B,
+    0x83, 0x1E, 0x33, 0x3A, 0x51, 0x4E, 0x94, 0x09, 0x33, 0x9F, 0x48, 0x8B, 0xC9, 0x75, 0x8B, 0x59,
+    0x97, 0xAF, 0x47, 0x10, 0x1F, 0xE3, 0xE8, 0xA7, 0xD6, 0x18, 0xB3, 0x1E, 0xAF, 0x89, 0xFC, 0x8D,
+    0x27, 0xF2, 0xE4, 0x0F, 0x18, 0xA3, 0xFA, 0x08, 0x30, 0x1D, 0x1E, 0xD1, 0x77, 0xDD, 0xB0, 0x82,
+    0x5E, 0x07, 0xD1, 0x3F, 0xE1, 0xB7, 0x64, 0x16, 0xF3, 0xA3, 0x1C, 0xC7, 0x66, 0xC8, 0xFC, 0x53,
+    0x11, 0x98, 0x55, 0x04, 0xF5, 0x78, 0xA0, 0xF2, 0xC1, 0x9D, 0xC5, 0xBE, 0x18, 0x41, 0x2D, 0xE5,
+    0x04, 0x6A, 0x36, 0x23, 0x30, 0x95, 0xBF, 0xAA, 0xC0, 0xF8, 0x83, 0x37, 0x7E, 0x7F, 0x78, 0xC9,
+    0xEA, 0x08, 0xB1, 0x1C, 0x0B, 0xA4, 0x4C, 0xFB, 0x84, 0x09, 0x2D, 0x17, 0xD3, 0x16, 0xB2, 0x44,
+    0xE4, 0x25, 0xA1, 0x6E, 0xED, 0x50, 0x46, 0x76, 0x24, 0x6C, 0xA8, 0x5A, 0xA6, 0x22, 0x52, 0x79,
+    0x87, 0x8E, 0xE5, 0x40, 0xC3, 0x16, 0x3B, 0x98, 0xBE, 0x58, 0xB8, 0xE2, 0xDF, 0xF6, 0x5F, 0x8E,
+    0xF5, 0xE9, 0xF3, 0xCD, 0xFD, 0x37, 0xEF, 0xBF, 0x29, 0xD1, 0xC5, 0x6A, 0xD2, 0x13, 0xCF, 0x66,
+    0x35, 0xFB, 0x28, 0x6B, 0x85, 0xFA, 0xBC, 0xE6, 0x1E, 0xE6, 0x40, 0xA4, 0x3D, 0xFF, 0xE4, 0xDA,
+    0xFD, 0xFA, 0x7B, 0x57, 0x1E, 0x58, 0x56, 0xF5, 0x37, 0xF7, 0x03, 0x6A, 0xDC, 0xC1, 0x56, 0x0F,
+    0xD8, 0xF6, 0x05, 0xB8, 0x73, 0x3D, 0xD8, 0xFA, 0xB5, 0xF7, 0xAE, 0xFC, 0x09, 0x74, 0x7A, 0xC4,
+    0xC6, 0xC6, 0x33, 0x97, 0x11, 0xF5, 0x78, 0x9A, 0xF3, 0x9B, 0x59, 0xF0, 0xFF, 0x17, 0x22, 0xD1,
+    0x53, 0xCC, 0xF0, 0xDA, 0x01, 0x02, 0x53, 0x13, 0x7A, 0x84, 0x7B, 0x2B, 0x45, 0xB7, 0x86, 0xB8,
+    0x73, 0x0E, 0x00, 0xAB, 0x90, 0xDF, 0xA6, 0x3B, 0xBA, 0xB0, 0x52, 0xBC, 0x96, 0x44, 0x32, 0xFD,
+    0x86, 0x0B, 0x13, 0x4C, 0x3F, 0xA9, 0x54, 0xD3, 0xE9, 0xD8, 0x84, 0xA6, 0x1B, 0x4A, 0xE9, 0xE9,
+    0x3C, 0xA6, 0x87, 0x3D, 0x45, 0x19, 0xD5, 0xE8, 0x7E, 0xB2, 0x14, 0x22, 0xAD, 0x91, 0x76, 0x15,
+    0xD5, 0x3E, 0x13, 0xCE, 0xCD, 0xB1, 0x8A, 0xB3, 0x88, 0xF9, 0x45, 0xC1, 0xEB, 0xFA, 0x35, 0x62,
+    0x25, 0x92, 0x4C, 0x6F, 0xDB, 0xCA, 0xEF, 0xD8, 0xEB, 0xA1, 0x8C, 0x35, 0x1D, 0xA9, 0x8A, 0xE5,
+    0xC3, 0x85, 0x4A, 0x3C, 0x6B, 0xA0, 0x6E, 0x7A, 0x3E, 0x52, 0x85, 0xB2, 0x77, 0x3F, 0x59, 0xE8,
+    0x64, 0xA0, 0x9B, 0x56, 0x27, 0x71, 0xF2, 0x28, 0xE8, 0x5E, 0x46, 0xCC, 0x9B, 0x91, 0x7D, 0x19,
+    0xCA, 0xDE, 0xF2, 0xF4, 0xB5, 0xFD, 0xF9, 0x35, 0x74, 0x74, 0xC2, 0xB3, 0xB8, 0x57, 0x12, 0xCD,
+    0xAB, 0x89, 0xA6, 0x98, 0x1E, 0x47, 0xB2, 0xF2, 0x82, 0xE1, 0x24, 0x90, 0x4C, 0xAF, 0x87, 0xB2,
+    0x37, 0xC1, 0xF4, 0xB6, 0xAD, 0x42, 0x4D, 0x87, 0x2B, 0x13, 0x4D, 0x37, 0xD0, 0xCC, 0x19, 0xA2,
+    0xDD, 0x03, 0x7B, 0x0A, 0x1A, 0x2A, 0xEF, 0x7E, 0xB2, 0x50, 0xCB, 0x94, 0x79, 0xA8, 0x3B, 0x80,
+    0xE7, 0x1B, 0x38, 0x6C, 0x86, 0xB8, 0x79, 0x3D, 0x8B, 0x81, 0xEA, 0x82, 0x8C, 0xCF, 0x3D, 0x46,
+    0x1A, 0x6D, 0xA9, 0xBD, 0x0D, 0x65, 0x2C, 0xA6, 0x8F, 0xCC, 0xB7, 0xDD, 0x62, 0x17, 0x3D, 0x73,
+    0x33, 0xAB, 0xE8, 0x05, 0xCC, 0xE8, 0x09, 0x33, 0x50, 0xF9, 0xEB, 0x9A, 0x79, 0x2B, 0xE1, 0x66,
+    0x9E, 0x4B, 0x6B, 0x25, 0xE2, 0x75, 0xA0, 0xDE, 0xF4, 0x6B, 0x79, 0x48, 0xFD, 0x2A, 0xEE, 0x33,
+    0xB8, 0x05, 0x37, 0xE1, 0xFA, 0xDC, 0xBD, 0xC7, 0x46, 0xEA, 0x91, 0x6D, 0x52, 0xE3, 0x4E, 0x0F,
+    0x1B, 0xDB, 0xBE, 0x70, 0x72, 0xF0, 0xBB, 0x7F, 0xBF, 0x36, 0x95, 0x3F, 0x29, 0x92, 0xED, 0xA5,
+    0x1C, 0xDD, 0x27, 0xD2, 0x63, 0x9A, 0x74, 0x2B, 0x61, 0xC5, 0xAB, 0x97, 0x03, 0x3A, 0xA2, 0x26,
+    0x72, 0x51, 0x25, 0x36, 0x50, 0x0E, 0x14, 0x8F, 0xDE, 0xE4, 0x7A, 0x15, 0xFB, 0xDD, 0xA0, 0x65,
+    0x40, 0x06, 0x5C, 0xBF, 0xE2, 0xFD, 0x37, 0x01, 0x33, 0x7E, 0x0C, 0x9A, 0x31, 0xA2, 0x7F, 0x2A,
+    0x01, 0x5B, 0x26, 0xB8, 0x51, 0xF8, 0x27, 0x54, 0xF5, 0x37, 0xC5, 0x65, 0x79, 0x28, 0xD6, 0xEC,
+    0x44, 0xA7, 0xD5, 0x5C, 0xB9, 0xD5, 0x38, 0xAB, 0xEB, 0xC2, 0xF2, 0xEB, 0xE2, 0xBB, 0x3E, 0xBA,
+    0xD2, 0xA3, 0x33, 0xE8, 0x35, 0x3F, 0xAD, 0xFC, 0xFB, 0xCC, 0xF1, 0xAF, 0xAF, 0xBF, 0xF5, 0x3D,
+    0xB7, 0x7A, 0x84, 0x6D, 0x42, 0x8D, 0x3B, 0xF4, 0xB0, 0xC1, 0xB6, 0x2F, 0x70, 0x72, 0x2D, 0x12,
+    0xFB, 0x75, 0xF5, 0xA7, 0xFC, 0x09, 0x45, 0xB2, 0x3D, 0x52, 0x8E, 0xB8, 0x4F, 0xA4, 0xF7, 0x1B,
+    0xDD, 0x52, 0x5A, 0xAC, 0x24, 0xEC, 0xDB, 0x4D, 0xB0, 0xBD, 0x1E, 0xCD, 0xC0, 0x5C, 0x46, 0xEA,
+    0x57, 0x47, 0xCC, 0x90, 0x28, 0xC6, 0x06, 0xE6, 0xAA, 0xC5, 0x99, 0x81, 0xEA, 0xD5, 0x09, 0xDB,
+    0x5F, 0x61, 0x86, 0x2A, 0x94, 0x51, 0x27, 0x13, 0x69, 0x24, 0xE6, 0xDE, 0x4E, 0x8E, 0xEE, 0xB5,
+    0x3C, 0xE2, 0x6A, 0x1D, 0xEB, 0x0E, 0xE6, 0xCA, 0x81, 0xDD, 0x13, 0x01, 0xB5, 0xEA, 0x02, 0xBB,
+    0x4A, 0x28, 0xE3, 0x73, 0x4F, 0x72, 0x54, 0x36, 0xE8, 0xC8, 0x36, 0xF3, 0xAC, 0xEB, 0x47, 0x93,
+    0x4B, 0x1D, 0x1D, 0x75, 0xAF, 0xA6, 0xE2, 0xFE, 0x27, 0xCB, 0xA1, 0xBE, 0x7D, 0xBB, 0xFA, 0xDE,
+    0xCF, 0x1E, 0x0E, 0x4E, 0xB4, 0xD0, 0x0D, 0x76, 0xE0, 0x66, 0x5E, 0xC2, 0x0F, 0x1F, 0x08, 0x13,
+    0xDB, 0xAF, 0x39, 0x77, 0x39, 0xAC, 0x78, 0x9C, 0x1A, 0x9E, 0x10, 0xE4, 0xDF, 0xD8, 0x20, 0x7C,
+    0x2E, 0x3C, 0xCD, 0x95, 0xA3, 0x55, 0x07, 0x4C, 0x17, 0x60, 0xC3, 0x04, 0x49, 0x45, 0xD4, 0xF5,
+    0xF7, 0xBF, 0x7F, 0x53, 0x83, 0xB8, 0x73, 0x02, 0x55, 0xB8, 0x02, 0xD1, 0x13, 0xC5, 0x64, 0x03,
+    0xEA, 0xC9, 0x70, 0x9F, 0x5B, 0x09, 0xF3, 0x4D, 0x89, 0x34, 0xEA, 0xE5, 0xA0, 0x26, 0x1C, 0xA6,
+    0x5F, 0x3F, 0x48, 0xB8, 0x27, 0xE8, 0xC4, 0x32, 0xAE, 0xEF, 0xDF, 0x17, 0x33, 0x55, 0xFB, 0xC2,
+    0xF8, 0x91, 0x6D, 0xF1, 0x8B, 0x37, 0xBF, 0x39, 0x37, 0xD5, 0x95, 0x96, 0xE8, 0xA2, 0x59, 0x58,
+    0x50, 0x79, 0xEE, 0xB7, 0x44, 0x44, 0x46, 0x4A, 0x11, 0x11, 0xE9, 0xE9, 0xDE, 0x7B, 0xE9, 0xBD,
+    0xCB, 0x0E, 0x3B, 0x61, 0x03, 0xE7, 0x08, 0x34, 0xA8, 0xC1, 0x46, 0xD4, 0x44, 0x49, 0xF3, 0x08,
+    0xD3, 0x70, 0x9E, 0x35, 0x0E, 0x3C, 0x3A, 0x57, 0x1D, 0xA1, 0x7E, 0xA7, 0xA3, 0x0A, 0xD0, 0x49,
+    0xA2, 0x03, 0xFD, 0xDE, 0xE5, 0xBD, 0x62, 0x7D, 0xAD, 0xC1, 0xC4, 0x15, 0xEF, 0x08, 0xB9, 0x3A,
+    0xAE, 0x03, 0xDB, 0x73, 0x43, 0xCD, 0xE0, 0xE0, 0xE3, 0x3A, 0x41, 0xA2, 0x18, 0xCA, 0x44, 0x39,
+    0x50, 0x79, 0xB3, 0xD0, 0xFC, 0xE5, 0x65, 0xC2, 0x88, 0x88, 0xC8, 0xB0, 0x8E, 0xD0, 0xC3, 0x73,
+    0xFE, 0xB1, 0xB2, 0x95, 0xA1, 0x90, 0x56, 0x8B, 0x94, 0x32, 0xE9, 0x07, 0xD5, 0xDF, 0xF4, 0x8D,
+    0x1E, 0x91, 0x60, 0xDF, 0x98, 0x70, 0x7D, 0xF9, 0xC3, 0x84, 0x89, 0x7A, 0xDC, 0x53, 0x4C, 0x7A,
+    0x72, 0xB0, 0x33, 0x63, 0x15, 0x70, 0xCD, 0x50, 0x0E, 0x58, 0x69, 0x8B, 0x89, 0xF2, 0x01, 0x5C,
+    0xA1, 0x27, 0xA8, 0xDB, 0x42, 0x50, 0x9F, 0x8A, 0x4A, 0xFA, 0x22, 0x4A, 0x21, 0xCB, 0xDD, 0x58,
+    0x49, 0x72, 0x12, 0x95, 0x8C, 0xA5, 0xF4, 0x28, 0xCF, 0x0D, 0xB8, 0xBC, 0xBC, 0xBC, 0x6C, 0x44,
+    0xE4, 0x9D, 0xCB, 0xCB, 0xCB, 0xAF, 0x5C, 0xAE, 0x47, 0x27, 0xF9, 0x78, 0x6F, 0xFD, 0xFD, 0x35,
+    0x6E, 0x96, 0xE1, 0x54, 0xC7, 0xDA, 0x27, 0x33, 0xB8, 0x56, 0x8A, 0xA4, 0x3C, 0x6A, 0xA8, 0xFB,
+    0xA6, 0x9D, 0x75, 0xAC, 0x7C, 0x2A, 0xFB, 0x53, 0xD5, 0x03, 0xDC, 0x54, 0x9C, 0x17, 0xC3, 0x69,
+    0x11, 0x9D, 0x1A, 0x6B, 0x9F, 0x6C, 0xD8, 0x9A, 0xC1, 0xBD, 0x38, 0x55, 0xBD, 0x94, 0x53, 0x1D,
+    0x16, 0xE5, 0x6F, 0x80, 0x57, 0x34, 0x2F, 0xA6, 0x72, 0x72, 0xC1, 0x7D, 0x32, 0xE9, 0x58, 0xB7,
+    0xDB, 0x62, 0x34, 0x61, 0xC3, 0x64, 0x42, 0xCD, 0x58, 0x86, 0x0D, 0x37, 0x1F, 0xC9, 0xE8, 0x8E,
+    0x22, 0x62, 0xDE, 0x1A, 0xA9, 0x7B, 0xBA, 0xA6, 0x47, 0xBC, 0x9E, 0x97, 0xEC, 0x24, 0xEF, 0xA0,
+    0x3C, 0x27, 0xFC, 0x4F, 0xD5, 0x99, 0x31, 0xAC, 0x2D, 0xC5, 0x79, 0xC7, 0x7F, 0xBB, 0xC3, 0x7B,
+    0x83, 0x3C, 0xB2, 0x86, 0x02, 0x64, 0xCB, 0x4F, 0xF2, 0xA6, 0x48, 0x11, 0x25, 0x16, 0xD3, 0x5A,
+    0xD1, 0x7B, 0x77, 0x06, 0x28, 0x28, 0x52, 0x60, 0x4B, 0xB9, 0x46, 0x0A, 0x05, 0x7D, 0x9A, 0xDB,
+    0xB8, 0x7C, 0xF7, 0xEC, 0x02, 0x85, 0x0B, 0x17, 0xA6, 0x71, 0x1A, 0x17, 0x49, 0xE1, 0x58, 0xD6,
+    0xA3, 0xA0, 0x21, 0x11, 0x89, 0xEF, 0x39, 0x3B, 0x18, 0x45, 0x2E, 0x28, 0xBC, 0x36, 0xB1, 0x5C,
+    0xB8, 0x60, 0x64, 0x61, 0xA4, 0xE0, 0x28, 0x0C, 0x30, 0x24, 0x0B, 0xCC, 0x9E, 0x2F, 0xC5, 0x9E,
+    0x73, 0xEF, 0x05, 0x63, 0x25, 0x52, 0x14, 0x45, 0xD9, 0x62, 0x8F, 0xCE, 0xD9, 0x3D, 0x3B, 0x33,
+    0xDF, 0xFC, 0xFF, 0xFF, 0xEF, 0xFF, 0x7D, 0x0B, 0x00, 0xB4, 0xC5, 0x46, 0x9A, 0xBD, 0x29, 0x30,
+    0x3E, 0x56, 0xA1, 0x0B, 0xE7, 0x7C, 0xFA, 0xF0, 0x22, 0x32, 0x58, 0x11, 0x49, 0x9C, 0xBD, 0xFD,
+    0x42, 0xC1, 0x4C, 0xDC, 0x41, 0x65, 0x2C, 0x54, 0xD4, 0x40, 0x0F, 0xE0, 0x06, 0xC0, 0x4E, 0x80,
+    0xCA, 0x00, 0xFB, 0x17, 0x66, 0xE8, 0x65, 0x01, 0xF7, 0xF6, 0xBD, 0xEB, 0x57, 0x9A, 0x0A, 0xB0,
+    0x81, 0x07, 0x70, 0x03, 0xB7, 0xB1, 0x13, 0x1D, 0x2A, 0x63, 0x87, 0x66, 0xF9, 0x8B, 0x17, 0x27,
+    0x23, 0x22, 0xD9, 0x88, 0xC8, 0x0C, 0xC0, 0x03, 0x00, 0x54, 0x00, 0x04, 0x80, 0x7E, 0x02, 0xF0,
+    0x05, 0xC0, 0x6D, 0x00, 0xEC, 0x13, 0x11, 0x30, 0xAF, 0x66, 0x40, 0x4D, 0x15, 0x50, 0xC9, 0x05,
+    0x68, 0xB2, 0x49, 0xC0, 0xDC, 0x54, 0xE0, 0x02, 0x0F, 0x9C, 0x60, 0x23, 0xB8, 0x7B, 0x2F, 0x14,
+    0xB0, 0x22, 0x7B, 0xB0, 0x6F, 0xDF, 0x1B, 0x23, 0x7A, 0x42, 0x67, 0x54, 0x86, 0x4A, 0x5B, 0xC0,
+    0x07, 0x2A, 0xD8, 0xC4, 0x16, 0x54, 0x6D, 0xA5, 0x70, 0x4B, 0xDE, 0x93, 0x3D, 0x56, 0x2A, 0x5E,
+    0x44, 0xB0, 0x22, 0x12, 0x39, 0x7B, 0xFB, 0x85, 0x8C, 0x99, 0x98, 0x51, 0x99, 0x3B, 0x50, 0xB1,
+    0xD0, 0xD3, 0x7C, 0x22, 0x1C, 0x1F, 0x04, 0x40, 0xE4, 0x4D, 0xE8, 0x45, 0x06, 0xDC, 0xD0, 0x15,
+    0xEC, 0xC4, 0x88, 0xCA, 0xD8, 0xD8, 0x54, 0x54, 0x66, 0x03, 0x15, 0x37, 0xD0, 0x63, 0x27, 0x7C,
+    0x50, 0x19, 0x17, 0x9B, 0xE5, 0x74, 0x8C, 0x46, 0x44, 0x06, 0x23, 0xF2, 0xE1, 0x27, 0x76, 0xE4,
+    0x96, 0xC8, 0xC0, 0x28, 0x92, 0xF9, 0xC1, 0x6C, 0x2A, 0xAA, 0xB0, 0xA0, 0x32, 0xBB, 0xF5, 0xA4,
+    0x13, 0x5B, 0xCC, 0x44, 0xC5, 0x4E, 0x6D, 0xC1, 0x4E, 0x26, 0x61, 0x45, 0x02, 0x9D, 0xC8, 0x84,
+    0x0B, 0x5D, 0xC1, 0xD3, 0x56, 0x3C, 0x54, 0x7A, 0xA8, 0xEB, 0xF0, 0x5B, 0x9A, 0x4A, 0x45, 0x15,
+    0x2A, 0x26, 0x37, 0xCB, 0xD7, 0xFB, 0xE8, 0x44, 0xF6, 0x8C, 0x22, 0xCF, 0xFF, 0x7E, 0x24, 0x5C,
+    0xA0, 0x32, 0x0E, 0x2A, 0x26, 0xD2, 0xD3, 0x4E, 0xB8, 0x81, 0xAF, 0x5D, 0x47, 0x42, 0x05, 0x3E,
+    0x13, 0x23, 0x97, 0x48, 0xF8, 0xEC, 0x2B, 0x46, 0x2A, 0x18, 0xD9, 0x03, 0xD0, 0x89, 0x48, 0x86,
+    0x51, 0x44, 0x06, 0xE8, 0x7E, 0x73, 0x36, 0x01, 0x77, 0xD8, 0x00, 0x4D, 0x6E, 0x0B, 0x60, 0xA2,
+    0x99, 0x80, 0x13, 0x3C, 0x40, 0xA1, 0x02, 0x26, 0xEA, 0x04, 0x9C, 0xB0, 0xC2, 0x81, 0x0A, 0xD8,
+    0x41, 0x65, 0xE0, 0x1C, 0x1B, 0x39, 0x84, 0x9E, 0x2E, 0xB4, 0x05, 0xA8, 0xD8, 0x08, 0x7A, 0x3A,
+    0x40, 0xA5, 0x99, 0xA1, 0xCD, 0x98, 0x09, 0xBA, 0x01, 0x17, 0xB8, 0xB9, 0x3F, 0xFD, 0xC6, 0x02,
+    0x22, 0x22, 0x32, 0x69, 0x11, 0x11, 0x09, 0x6E, 0x80, 0xA6, 0xB2, 0x05, 0x74, 0x6A, 0x33, 0xD0,
+    0x05, 0x13, 0x81, 0x0B, 0x1E, 0x06, 0xDA, 0xC4, 0x4B, 0x80, 0x0D, 0xED, 0x00, 0x7C, 0xF1, 0xFF,
+    0x92, 0x4D, 0x4D, 0x00, 0xE0, 0x6B, 0xD8, 0x99, 0x5E, 0x06, 0x53, 0xB1, 0x0B, 0xA3, 0x04, 0x5F,
+    0xB1, 0x82, 0x2E, 0x48, 0xE5, 0xBE, 0x6E, 0xD0, 0x49, 0xCD, 0x0F, 0xAC, 0xE1, 0x34, 0x13, 0xA0,
+    0x26, 0x1B, 0xBB, 0x00, 0xB4, 0xD9, 0xC6, 0x13, 0x00, 0xB2, 0x1D, 0x56, 0x76, 0xBE, 0xDC, 0x3D,
+    0x9B, 0x01, 0xB8, 0xEB, 0x1E, 0x8B, 0x2B, 0x47, 0x45, 0x06, 0x80, 0x56, 0x44, 0x22, 0x80, 0x2E,
+    0x1B, 0x3B, 0x01, 0xD8, 0xE9, 0x5C, 0x67, 0x00, 0x1F, 0xB7, 0xAA, 0xAC, 0x7C, 0xAE, 0x6D, 0x05,
+    0xDA, 0x85, 0xCA, 0x02, 0x98, 0xB9, 0x99, 0x19, 0x01, 0x97, 0xDA, 0x42, 0x1F, 0x60, 0x8C, 0x6D,
+    0xC6, 0x47, 0x5A, 0x41, 0x65, 0x6C, 0xC6, 0x56, 0x7A, 0x09, 0xA6, 0xE2, 0x12, 0x22, 0xB4, 0x7B,
+    0x1A, 0xAE, 0x09, 0x05, 0x37, 0x65, 0xC6, 0x8A, 0x44, 0xF5, 0xE1, 0x53, 0x95, 0x42, 0xCF, 0x5D,
+    0xEC, 0xF4, 0x65, 0xDA, 0xA2, 0x02, 0xF5, 0x80, 0x43, 0x1F, 0xA0, 0x1F, 0xF0, 0x12, 0xB0, 0x92,
+    0x68, 0x9E, 0xDA, 0x03, 0x6E, 0x02, 0x35, 0x03, 0x3B, 0xC0, 0x3D, 0x17, 0xB1, 0x3F, 0xCF, 0xE8,
+    0xBC, 0x47, 0x17, 0x57, 0x9E, 0x9E, 0x95, 0x48, 0xC1, 0x49, 0x82, 0x07, 0x57, 0x22, 0xA4, 0x56,
+    0x04, 0x2B, 0x05, 0x91, 0x81, 0xB3, 0x89, 0x76, 0x01, 0x33, 0xC1, 0x0E, 0x54, 0x81, 0x31, 0x40,
+    0x85, 0x31, 0x42, 0x0F, 0x63, 0x06, 0x37, 0xB0, 0x9F, 0xC1, 0x4E, 0xD4, 0x1D, 0xA8, 0xCC, 0xEC,
+    0x03, 0x54, 0x66, 0x1B, 0xA1, 0x67, 0xD6, 0x19, 0xDC, 0x30, 0xB7, 0x33, 0xD8, 0x9F, 0x15, 0xB6,
+    0xA0, 0xDE, 0x2D, 0xF8, 0x40, 0xB3, 0x14, 0x6C, 0x84, 0xBE, 0xA0, 0x33, 0xB8, 0x4C, 0x3B, 0x83,
+    0xCD, 0xB0, 0xAC, 0x20, 0xF0, 0x2B, 0x0C, 0xBA, 0x09, 0x23, 0x85, 0x51, 0x06, 0x23, 0x95, 0x5E,
+    0xA6, 0x4F, 0x48, 0xC6, 0xE7, 0x01, 0x6C, 0xD0, 0x03, 0xA0, 0x93, 0x8A, 0x40, 0x53, 0x55, 0x3A,
+    0x2C, 0x06, 0x40, 0x7D, 0xEA, 0x1F, 0xD7, 0x0E, 0x25, 0x7B, 0x9C, 0x64, 0x44, 0x82, 0x95, 0x99,
+    0x9B, 0xCB, 0x1A, 0xAF, 0x2D, 0x98, 0x04, 0x3E, 0x60, 0x0A, 0xD8, 0x88, 0xA9, 0xA0, 0x33, 0x46,
+    0xA0, 0x9D, 0xB1, 0xEF, 0x0C, 0xB0, 0x60, 0x5F, 0x4B, 0xE0, 0xB1, 0xCF, 0x15, 0xB0, 0xD1, 0x0E,
+    0x15, 0x74, 0xB6, 0x43, 0x0F, 0xED, 0x6C, 0x07, 0x37, 0xC0, 0xD2, 0x05, 0x33, 0x81, 0xEF, 0x82,
+    0x2A, 0xD0, 0xBD, 0x11, 0xA8, 0xA0, 0x25, 0xD0, 0x43, 0x2B, 0x2B, 0x1B, 0x64, 0x45, 0xBD, 0x5F,
+    0x97, 0xDC, 0x45, 0x9A, 0x05, 0x46, 0x09, 0x46, 0x66, 0x46, 0x89, 0x5A, 0x96, 0xC3, 0x5C, 0x1F,
+    0xC4, 0xCA, 0xCC, 0x18, 0x95, 0x2C, 0x48, 0xE6, 0x56, 0x41, 0x66, 0xDA, 0xC2, 0xFE, 0x3E, 0x58,
+    0xD8, 0x02, 0x9E, 0x73, 0xA0, 0x8B, 0x27, 0x80, 0x49, 0x27, 0x80, 0x2A, 0x0E, 0xA0, 0x5A, 0x00,
+    0x3F, 0x0E, 0x40, 0x27, 0x19, 0x30, 0x69, 0x01, 0x54, 0xE9, 0x22, 0x50, 0x55, 0x01, 0x7A, 0x76,
+    0x40, 0x37, 0xD8, 0x09, 0x4C, 0x6A, 0x2B, 0xA8, 0x15, 0xAB, 0x15, 0x9B, 0xA1, 0xA7, 0x11, 0x5A,
+    0x11, 0x5C, 0x6E, 0x45, 0x62, 0xBB, 0xCA, 0xD7, 0x7D, 0x47, 0xF5, 0x9C, 0x50, 0x22, 0x52, 0xE1,
+    0xE6, 0x87, 0x4F, 0xCD, 0x80, 0xC3, 0x03, 0x2A, 0xEB, 0x0C, 0x9C, 0xB0, 0x03, 0x74, 0xB4, 0x13,
+    0x70, 0x71, 0x50, 0x2B, 0x1B, 0xA1, 0x29, 0xCD, 0x7A, 0xB3, 0x1B, 0x40, 0x25, 0x55, 0x80, 0x73,
+    0x3C, 0x60, 0xA3, 0xCE, 0x40, 0x59, 0x61, 0x8B, 0x99, 0x40, 0x25, 0x96, 0x4B, 0x31, 0x73, 0xA1,
+    0xA9, 0xA8, 0xC7, 0x33, 0x6E, 0xA0, 0xAF, 0xA8, 0x19, 0x23, 0x68, 0xA9, 0xF4, 0x11, 0x91, 0x48,
+    0x38, 0x6E, 0x70, 0x86, 0x71, 0x41, 0x49, 0xA6, 0x91, 0x19, 0x7C, 0x41, 0xC9, 0x00, 0xBE, 0xA0,
+    0x25, 0xC0, 0x66, 0xC6, 0x8E, 0x01, 0xB6, 0x33, 0x9D, 0x07, 0xE6, 0xCA, 0x89, 0x87, 0xA6, 0x54,
+    0x2E, 0x3C, 0xB4, 0xB9, 0x52, 0x3C, 0xA8, 0xBC, 0x6D, 0xB3, 0x07, 0x95, 0xB6, 0x6A, 0xF2, 0xA0,
+    0xE3, 0xC6, 0xC4, 0x0D, 0xD8, 0xE8, 0x2D, 0x1B, 0xB0, 0x83, 0x3F, 0x61, 0x03, 0x5D, 0xF0, 0x77,
+    0xD9, 0x81, 0xC3, 0x15, 0xB6, 0xE0, 0x71, 0x99, 0x2D, 0x9C, 0xD3, 0x4D, 0x6C, 0xE1, 0x02, 0x1B,
+    0xA9, 0x87, 0x84, 0x5A, 0x69, 0x66, 0x80, 0x05, 0x27, 0x11, 0x3A, 0x99, 0x7A, 0x89, 0xE0, 0x65,
+    0xFA, 0xAF, 0x79, 0xB8, 0x72, 0x6C, 0xE5, 0xCF, 0x0A, 0x1D, 0x37, 0xD0, 0xAC, 0x3C, 0x64, 0x77,
+    0xE0, 0x4F, 0x58, 0x35, 0x3D, 0x42, 0xBF, 0xA6, 0x19, 0xF7, 0xDD, 0xD3, 0x6F, 0x1C, 0xEE, 0xD9,
+    0x5E, 0xDE, 0xD3, 0x1C, 0x9E, 0xB3, 0x61, 0xE5, 0xE1, 0xB0, 0xF2, 0x70, 0xFA, 0xEF, 0xF3, 0x70,
+    0x94, 0x00, 0x4E, 0x24, 0xA2, 0xF7, 0xA7, 0x12, 0xE9, 0x07, 0xFA, 0x41, 0x17, 0x18, 0xF1, 0x03,
+    0xEC, 0xDB, 0x0A, 0x6D, 0xB5, 0x11, 0x4C, 0x1E, 0x81, 0xEE, 0xD5, 0x02, 0xF4, 0x36, 0x42, 0x53,
+    0x7B, 0xC0, 0xBC, 0x57, 0x01, 0xFF, 0xED, 0x0C, 0x2C, 0x2E, 0x82, 0xCE, 0x23, 0xE0, 0x9F, 0xA9,
+    0xD0, 0x54, 0x55, 0xC0, 0x4E, 0x36, 0xC3, 0x9E, 0x2E, 0xD1, 0x65, 0x5C, 0xF9, 0xC2, 0x1E, 0x9C,
+    0xC8, 0x04, 0x9D, 0x94, 0x55, 0xFE, 0x0F, 0x48, 0x94, 0x79, 0x4D, 0x64, 0x91, 0xB3, 0xB7, 0xEF,
+    0x8D, 0x89, 0x75, 0x1B, 0x50, 0xE5, 0xB8, 0x50, 0x9D, 0xA0, 0xBF, 0x5C, 0xE7, 0x02, 0x76, 0x3A,
+    0x2E, 0xB3, 0x8B, 0x50, 0x61, 0x07, 0x3A, 0xD3, 0x16, 0x70, 0x03, 0x36, 0xC2, 0x72, 0x24, 0x68,
+    0x53, 0xA1, 0x8B, 0x98, 0x04, 0x1B, 0xF0, 0x81, 0x76, 0x5E, 0xF7, 0xE1, 0xFA, 0x23, 0x9A, 0xF5,
+    0x11, 0xA3, 0x84, 0x5E, 0xA2, 0x91, 0xAA, 0x44, 0x3E, 0x6D, 0x70, 0x0A, 0x3F, 0x98, 0x75, 0xA5,
+    0x2D, 0xEC, 0x51, 0x99, 0x7E, 0x3D, 0xE9, 0x4C, 0x8F, 0x49, 0x6C, 0xB0, 0x13, 0x0B, 0x36, 0xB6,
+    0x33, 0x36, 0x9A, 0x4C, 0xF7, 0x4F, 0x63, 0xC4, 0xC9, 0x02, 0x5E, 0x9E, 0x67, 0x75, 0x02, 0xFD,
+    0xA5, 0xC9, 0xD8, 0xAD, 0x20, 0x3A, 0x58, 0x92, 0xA6, 0x02, 0x6E, 0x35, 0x15, 0xF9, 0x72, 0x8B,
+    0xCE, 0xE4, 0x4D, 0x5A, 0x91, 0x3D, 0xDD, 0x47, 0x4F, 0xED, 0xE9, 0x07, 0xCE, 0x9B, 0x05, 0xEE,
+    0xAA, 0x02, 0x77, 0x4D, 0x82, 0x6F, 0xDA, 0x78, 0x4C, 0xCF, 0x3E, 0x70, 0x7D, 0x88, 0x1E, 0x60,
+    0xBC, 0x3C, 0x5D, 0xFD, 0xE6, 0x07, 0xC0, 0x4F, 0x90, 0xBA, 0x19, 0x33, 0x19, 0xB9, 0x27, 0x43,
+    0x2B, 0xB2, 0xC0, 0x99, 0x4C, 0xEB, 0x8E, 0x74, 0x22, 0x22, 0x4E, 0x44, 0xC4, 0xDF, 0x1B, 0xEF,
+    0xED, 0x4E, 0xD8, 0x71, 0xE7, 0x36, 0x5B, 0x6E, 0xDF, 0x66, 0xE1, 0xF6, 0x57, 0xA9, 0x7C, 0x73,
+    0x9D, 0x6F, 0x3B, 0xB3, 0xE2, 0x7A, 0xCD, 0xFE, 0x2A, 0xB3, 0x82, 0x11, 0x93, 0x8E, 0x86, 0xC1,
+    0xC6, 0xE3, 0xA9, 0x1B, 0x3E, 0x31, 0xD5, 0x3E, 0x1C, 0x3C, 0x95, 0x93, 0x0A, 0x5E, 0x92, 0x91,
+    0x22, 0x12, 0xBC, 0xC4, 0x7E, 0xC2, 0x24, 0x76, 0xE0, 0x69, 0x2A, 0x6D, 0x59, 0x0D, 0x04, 0x76,
+    0xA2, 0x82, 0x1B, 0xF4, 0x04, 0x3D, 0x27, 0x40, 0x6D, 0x33, 0xB4, 0xA5, 0x0B, 0xA0, 0xD3, 0x0C,
+    0xD8, 0x9F, 0x44, 0xC0, 0xDF, 0x01, 0x18, 0x13, 0xD0, 0x08, 0xC7, 0x19, 0x62, 0x07, 0x80, 0x0B,
+    0xE0, 0xF3, 0x26, 0x02, 0xE3, 0x72, 0x99, 0x65, 0x74, 0x05, 0x8E, 0xA9, 0x9B, 0xCF, 0xDD, 0xFB,
+    0x21, 0x60, 0xD7, 0x6D, 0xD8, 0x01, 0xB0, 0x05, 0xF8, 0xD2, 0xFE, 0xFB, 0x60, 0x44, 0x24, 0xD0,
+    0xBF, 0xB5, 0x8C, 0xA9, 0xD9, 0x37, 0xC5, 0x14, 0x9D, 0xDB, 0xDC, 0xCE, 0x76, 0x52, 0xB9, 0xA9,
+    0x5D, 0x54, 0x99, 0xEA, 0x82, 0x4E, 0x54, 0x1F, 0xF4, 0xD4, 0x54, 0x8F, 0x89, 0xED, 0xEC, 0x83,
+    0x8D, 0xAA, 0xF8, 0xC1, 0x46, 0x93, 0x5C, 0xEC, 0x06, 0x17, 0x6D, 0xE9, 0x1E, 0x15, 0xD4, 0x6A,
+    0x85, 0x7A, 0xD9, 0x87, 0xE3, 0xF6, 0xAC, 0xD8, 0x68, 0x76, 0xE1, 0x52, 0xF4, 0xBF, 0x74, 0xEF,
+    0x79, 0xC0, 0xCA, 0x6C, 0x25, 0xD3, 0x4B, 0xF4, 0x32, 0xD0, 0x15, 0x6C, 0x02, 0x17, 0xD7, 0x0C,
+    0x12, 0x4C, 0x02, 0xC6, 0xF5, 0xBF, 0x6B, 0x1A, 0x6D, 0x67, 0x0F, 0xA0, 0xDE, 0xCF, 0x00, 0x66,
+    0x85, 0xB2, 0x5D, 0x91, 0xE5, 0xE3, 0x2A, 0xB2, 0x01, 0xC0, 0xF7, 0x00, 0x6D, 0x5E, 0x00, 0xDC,
+    0x23, 0x15, 0x68, 0x8B, 0x2A, 0x40, 0x37, 0xE8, 0x0C, 0x4D, 0xC5, 0x4E, 0x60, 0xE3, 0x31, 0xCB,
+    0xF9, 0x81, 0x51, 0x42, 0x27, 0x45, 0xCB, 0x82, 0xAC, 0xD2, 0x97, 0x3A, 0x29, 0x88, 0x84, 0x5E,
+    0x22, 0x67, 0x13, 0xDD, 0x67, 0xF0, 0xD7, 0xAC, 0xFC, 0xFD, 0x4C, 0xF2, 0x0D, 0xD7, 0xF8, 0xAB,
+    0x3E, 0xC1, 0xDF, 0x55, 0x25, 0xDB, 0x79, 0xE5, 0xEF, 0xB4, 0xF2, 0x17, 0xDA, 0x72, 0x7C, 0x84,
+    0x5E, 0x1F, 0xE1, 0x06, 0x9A, 0xFD, 0xE9, 0x37, 0xF6, 0x81, 0x51, 0x44, 0x24, 0x19, 0x91, 0xA3,
+    0xF7, 0x5B, 0x39, 0x76, 0x70, 0xAE, 0x07, 0x14, 0xB0, 0x96, 0x95, 0xCD, 0xFA, 0x9B, 0x5E, 0x7F,
+    0xBB, 0x1F, 0x7A, 0x89, 0xBD, 0xBC, 0x26, 0xC5, 0xC8, 0xAC, 0x0B, 0xA6, 0xB0, 0x81, 0x1D, 0x26,
+    0xAD, 0xCC, 0x5E, 0x93, 0x98, 0x8D, 0x54, 0x9A, 0x4A, 0x17, 0x71, 0x43, 0x53, 0x51, 0x05, 0x9B,
+    0xF0, 0x30, 0xBE, 0x3D, 0x66, 0x94, 0xC8, 0x1E, 0x8C, 0x7C, 0x2F, 0x5D, 0x0E, 0x6D, 0xE3, 0xA5,
+    0x33, 0x76, 0x03, 0xEB, 0xE4, 0x0F, 0x54, 0xD5, 0x05, 0x30, 0x32, 0x43, 0x2B, 0x12, 0xC0, 0x4B,
+    0x94, 0xC5, 0x4A, 0x41, 0xF6, 0x5A, 0xB2, 0x97, 0x81, 0xB3, 0xD8, 0x2E, 0x74, 0x13, 0x6C, 0xD1,
+    0xE9, 0x20, 0x67, 0x2E, 0x34, 0x33, 0xEB, 0x3C, 0xCC, 0xC4, 0x2A, 0x43, 0x6B, 0x5C, 0xBB, 0x78,
+    0x08, 0xCB, 0xEE, 0x10, 0x98, 0xB6, 0x1C, 0xA2, 0x6B, 0x23, 0x5B, 0xD6, 0x47, 0xAC, 0x69, 0xA7,
+    0x99, 0x0F, 0x31, 0x36, 0xE9, 0x10, 0x65, 0x1F, 0x0E, 0x71, 0x5E, 0x77, 0x7C, 0x83, 0xCA, 0x87,
+    0x58, 0x77, 0xC3, 0x21, 0x6B, 0x6D, 0xD1, 0x09, 0x3C, 0xAA, 0xE0, 0x06, 0x9A, 0xE5, 0xF4, 0xE9,
+    0x5F, 0x9C, 0xEE, 0xD7, 0x3A, 0x48, 0x44, 0xE2, 0x1A, 0x75, 0xD9, 0xF3, 0xFF, 0x6B, 0x25, 0xE1,
+    0x77, 0x56, 0x72, 0xC0, 0xCF, 0x11, 0x41, 0x47, 0x0C, 0x5D, 0xA2, 0xE8, 0xA0, 0x66, 0x00, 0x77,
+    0x0F, 0x9F, 0xCD, 0xF1, 0x8A, 0x39, 0x98, 0x18, 0xBE, 0x08, 0x9D, 0x48, 0xC5, 0x89, 0x14, 0xFC,
+    0x3D, 0x09, 0x9C, 0xB0, 0x85, 0xDB, 0xD4, 0xC3, 0xE9, 0xAB, 0x57, 0x22, 0xDA, 0x96, 0x63, 0x6D,
+    0xAE, 0x44, 0x06, 0xB4, 0x48, 0xC1, 0x24, 0x5D, 0xB1, 0x13, 0x7B, 0x6C, 0x64, 0x87, 0x8D, 0xF4,
+    0x74, 0x03, 0x3B, 0x5C, 0x60, 0xBB, 0xF6, 0x04, 0x3C, 0x6A, 0xA6, 0x3F, 0x3D, 0x4B, 0x46, 0x44,
+    0x82, 0x13, 0x79, 0xF3, 0xB2, 0x34, 0xCE, 0x28, 0xD9, 0xE3, 0x65, 0x42, 0x4B, 0xE5, 0xE6, 0x02,
+    0xF4, 0xC3, 0x3A, 0x8E, 0x3F, 0x48, 0xE2, 0xC1, 0xBD, 0x1E, 0x2D, 0x04, 0xBB, 0x83, 0x70, 0x2F,
+    0x07, 0xED, 0xAE, 0x60, 0xFF, 0x79, 0x85, 0xAE, 0x95, 0x65, 0x65, 0xA1, 0x48, 0x5C, 0x33, 0xAC,
+    0xCB, 0xAB, 0xA1, 0xD1, 0x65, 0x65, 0xB1, 0x2A, 0x3A, 0x43, 0x4F, 0x3B, 0xAF, 0x69, 0x56, 0x95,
+    0xD5, 0xD3, 0xA8, 0xBC, 0x6E, 0x8E, 0xCE, 0x36, 0x42, 0xA5, 0x9B, 0xBA, 0x48, 0xB3, 0x9C, 0x8E,
+    0xC1, 0x0D, 0x38, 0x91, 0xAA, 0xA5, 0x32, 0x8A, 0x0C, 0x56, 0xEA, 0xF5, 0x26, 0x4F, 0x5E, 0x2D,
+    0xD5, 0x3A, 0xF3, 0x35, 0x3C, 0xE5, 0xF7, 0xE5, 0x98, 0x5F, 0x00, 0x56, 0xF6, 0x81, 0x4E, 0x24,
+    0xAD, 0x2D, 0x0D, 0x1F, 0x7E, 0xB7, 0xA5, 0xB0, 0xA3, 0xA9, 0x2C, 0x57, 0x2D, 0x85, 0xD3, 0xF1,
+    0x77, 0x5A, 0x0A, 0x87, 0x74, 0x3F, 0xC3, 0x28, 0x12, 0x90, 0xBF, 0x92, 0xC8, 0x4C, 0x97, 0x9B,
+    0x8C, 0x2E, 0x4D, 0x46, 0xCD, 0x4C, 0xB4, 0x97, 0x09, 0xFB, 0x78, 0xBA, 0x79, 0xEF, 0x85, 0x8A,
+    0x11, 0xA9, 0xDC, 0xFC, 0xDB, 0x27, 0x2F, 0x93, 0xA2, 0xCE, 0x80, 0x4D, 0x40, 0x17, 0x6F, 0x83,
+    0x1F, 0x2E, 0x40, 0xD8, 0xA3, 0x2B, 0xE3, 0xCF, 0xFA, 0x8C, 0x17, 0x09, 0x2B, 0xFB, 0xD7, 0x32,
+    0xEE, 0x78, 0x58, 0xA9, 0xDC, 0x92, 0x84, 0x92, 0x05, 0x2F, 0x02, 0xB7, 0x0A, 0xFD, 0x6F, 0xC6,
+    0x4C, 0x5B, 0xE8, 0x43, 0xBB, 0x87, 0x05, 0x1F, 0xF0, 0x11, 0x8F, 0x0F, 0xE8, 0x42, 0x17, 0xBB,
+    0x01, 0xF6, 0x98, 0x64, 0x23, 0xB8, 0x41, 0x15, 0x95, 0xC1, 0x24, 0x6A, 0x5B, 0xA0, 0x9D, 0xF1,
+    0xB2, 0x00, 0x3B, 0x3A, 0x11, 0xC0, 0x05, 0xF3, 0x9B, 0xA7, 0x23, 0x98, 0x69, 0xBD, 0x51, 0x65,
+    0x2A, 0x15, 0x9A, 0x99, 0x1E, 0x0F, 0x6C, 0x0F, 0x15, 0x85, 0xC7, 0x24, 0x55, 0xC1, 0x07, 0x55,
+    0x18, 0x03, 0x6E, 0xA0, 0x62, 0xCB, 0xDA, 0x1B, 0x6A, 0xE5, 0xBB, 0xE3, 0xD0, 0xCA, 0x82, 0x13,
+    0x09, 0xAD, 0x48, 0x68, 0x0E, 0xDD, 0x91, 0x83, 0xAD, 0x83, 0xB3, 0xB5, 0x67, 0x22, 0x15, 0xFA,
+    0x8F, 0xC6, 0x01, 0xF6, 0xB8, 0x80, 0x9A, 0x0F, 0xC8, 0xF3, 0xA0, 0x13, 0x1B, 0x30, 0x13, 0xE7,
+    0xA0, 0x13, 0x17, 0x87, 0xB9, 0xD0, 0xEE, 0xA9, 0xC0, 0xDA, 0x77, 0x73, 0x52, 0x00, 0xFF, 0x64,
+    0x06, 0xCE, 0x55, 0x3E, 0xE6, 0x38, 0x95, 0x75, 0x02, 0x93, 0xCC, 0x04, 0x2E, 0xDA, 0x08, 0x23,
+    0x36, 0xF2, 0xE2, 0x42, 0x17, 0x19, 0x4B, 0x2B, 0x95, 0x3E, 0x1A, 0xA9, 0x6B, 0xB9, 0x73, 0x38,
+    0xFA, 0xF4, 0x32, 0x4E, 0xDE, 0xC1, 0x7E, 0x30, 0xE6, 0x76, 0x66, 0x4F, 0x8F, 0x89, 0x36, 0x52,
+    0x9B, 0x19, 0x3B, 0x38, 0x9A, 0xA2, 0x32, 0x9E, 0x0D, 0x3A, 0xEB, 0xC4, 0x9E, 0x2D, 0x2E, 0x99,
+    0xA4, 0xB7, 0xF7, 0x8F, 0xED, 0xFB, 0x3F, 0xFF, 0xE5, 0xBE, 0x9E, 0x54, 0x2F, 0x4A, 0x1A, 0x19,
+    0xFC, 0xD0, 0x84, 0x63, 0xBD, 0x02, 0x34, 0xF1, 0x60, 0xB5, 0xC6, 0x0A, 0xBD, 0x44, 0x8C, 0x7C,
+    0x1F, 0x76, 0x61, 0xB5, 0xFF, 0x9C, 0x03, 0x2A, 0x01, 0x0E, 0x60, 0xEE, 0x33, 0xE6, 0x0D, 0xC9,
+    0xF8, 0x0F, 0xBB, 0xDC, 0x48, 0xE8, 0xA2, 0x29, 0xF8, 0xE0, 0x23, 0x0B, 0x0B, 0x6D, 0x51, 0x19,
+    0x3B, 0x75, 0x11, 0xCF, 0x86, 0xA6, 0x36, 0x33, 0x76, 0x52, 0x99, 0x1E, 0x1B, 0x75, 0xC1, 0x4D,
+    0x63, 0xC0, 0x4B, 0x01, 0xB7, 0x07, 0x6E, 0x1C, 0x67, 0x60, 0x24, 0xB4, 0x22, 0xF8, 0xB0, 0x53,
+    0xB9, 0x29, 0x0E, 0x13, 0x67, 0x36, 0x26, 0x9A, 0xEC, 0x9F, 0x12, 0x44, 0xE4, 0xF1, 0xC2, 0xE8,
+    0x02, 0x75, 0x8B, 0x7A, 0xAF, 0xD0, 0x7D, 0x2B, 0x53, 0x6D, 0xEA, 0x26, 0x27, 0x15, 0x27, 0xE1,
+    0xD8, 0x8F, 0xA1, 0x95, 0xD4, 0x8A, 0x0C, 0x9B, 0x47, 0xAB, 0xC1, 0x4E, 0xAC, 0x9E, 0x0B, 0x9B,
+    0x31, 0x33, 0x7A, 0xA6, 0x5D, 0x60, 0x0F, 0x6E, 0x40, 0x15, 0xFE, 0xC8, 0x07, 0xF3, 0xDC, 0xF2,
+    0x85, 0xDC, 0xC9, 0x42, 0xBF, 0x5F, 0x51, 0xDC, 0xFC, 0x39, 0x38, 0x09, 0x88, 0xA4, 0x66, 0xD2,
+    0x85, 0x95, 0x2D, 0xF5, 0x60, 0xA2, 0x36, 0xC0, 0x86, 0x76, 0xDF, 0xE3, 0x44, 0xD8, 0x3F, 0x29,
+    0xAA, 0xB0, 0x33, 0x13, 0x9B, 0x6E, 0x60, 0xEB, 0x60, 0xEB, 0xA1, 0x6E, 0xA0, 0xEE, 0x68, 0xCA,
+    0x0E, 0x95, 0x77, 0xE8, 0xB4, 0xC3, 0xC6, 0x1E, 0x17, 0x7C, 0xDC, 0xD1, 0x49, 0x41, 0xCB, 0x70,
+    0xD9, 0x61, 0xA1, 0x2F, 0x78, 0x89, 0x36, 0x6E, 0x55, 0xD2, 0xD3, 0x05, 0x5B, 0x3B, 0x74, 0x3F,
+    0xCE, 0x26, 0x7B, 0x5D, 0xF5, 0xC7, 0x7B, 0xFA, 0x05, 0x53, 0xD6, 0xD6, 0xC0, 0xC4, 0x1F, 0xF4,
+    0x74, 0x8F, 0xED, 0xCF, 0x92, 0x93, 0x99, 0x71, 0xBE, 0x44, 0x29, 0x80, 0x29, 0xBC, 0x84, 0x9B,
+    0x3A, 0xE1, 0x36, 0xBE, 0xDA, 0x17, 0x93, 0xC3, 0xEF, 0x4C, 0xA8, 0x36, 0xDE, 0xA1, 0x09, 0xCE,
+    0xA6, 0x87, 0x01, 0xFD, 0x5A, 0x71, 0x40, 0xF3, 0xFE, 0x45, 0x17, 0x80, 0x1F, 0xFD, 0x75, 0x17,
+    0x01, 0xF7, 0xDA, 0x77, 0x12, 0x60, 0x5F, 0x7F, 0xE3, 0x65, 0x40, 0x4F, 0x72, 0x07, 0x50, 0xA9,
+    0x7F, 0x62, 0x80, 0x36, 0xBB, 0xE7, 0x52, 0x43, 0x93, 0x6D, 0xAC, 0xED, 0xCF, 0xDF, 0x2E, 0x6A,
+    0x72, 0xDF, 0xCB, 0x52, 0x9A, 0xAC, 0x24, 0xB9, 0xCC, 0xCB, 0xF4, 0x13, 0xE1, 0xCA, 0x7A, 0xB6,
+    0x92, 0x1A, 0x91, 0xE8, 0x1F, 0x59, 0x74, 0xD0, 0xE9, 0x01, 0xCE, 0xC1, 0x46, 0xDA, 0xC2, 0x9F,
+    0x54, 0x94, 0x24, 0x1E, 0xEA, 0x87, 0x55, 0x8D, 0x5F, 0x0D, 0x4D, 0xBD, 0xC0, 0x7F, 0x27, 0x75,
+    0x79, 0x94, 0xB9, 0x95, 0x0F, 0xAF, 0x16, 0x73, 0x96, 0x71, 0x5A, 0x62, 0x53, 0x6F, 0xF4, 0xE8,
+    0x44, 0x65, 0xB5, 0xA3, 0xB8, 0xA0, 0x32, 0x95, 0x6E, 0x50, 0x99, 0xED, 0xE5, 0x47, 0x54, 0x99,
+    0x3D, 0x36, 0x9A, 0xC2, 0x86, 0x1F, 0x4D, 0xCF, 0xCC, 0xE6, 0xA7, 0x56, 0x7F, 0x50, 0x37, 0xB3,
+    0x95, 0x28, 0xD1, 0xCD, 0x6A, 0xE6, 0xBE, 0x4B, 0x63, 0x0C, 0xB4, 0xF0, 0x15, 0xBE, 0x42, 0x9B,
+    0xC9, 0x98, 0xC9, 0x06, 0xBA, 0xB7, 0xE6, 0x75, 0xBF, 0xB9, 0x71, 0x2D, 0x9C, 0xCD, 0x18, 0xB9,
+    0xE8, 0x04, 0x9D, 0x1F, 0xFA, 0xF4, 0x90, 0x36, 0xAA, 0xCC, 0x06, 0x1B, 0xDB, 0x72, 0xFC, 0xE8,
+    0xB1, 0x51, 0xCD, 0x78, 0xDC, 0xD4, 0xCC, 0xED, 0x3B, 0x8F, 0xEA, 0xE4, 0x6E, 0xDF, 0xEE, 0x7E,
+    0xF9, 0xEE, 0xC7, 0xC9, 0x8B, 0x12, 0xC6, 0x64, 0x13, 0x0F, 0x1C, 0x58, 0x7C, 0x73, 0x8F, 0xFB,
+    0x89, 0x0C, 0xBE, 0x3C, 0x99, 0x7C, 0x6D, 0x8A, 0x7F, 0x84, 0xBB, 0x0E, 0x5C, 0x07, 0xF6, 0x3B,
+    0xA0, 0xDE, 0x18, 0x68, 0x3E, 0xCE, 0x30, 0x6E, 0xC1, 0x3F, 0x31, 0x60, 0x7F, 0x9C, 0xD1, 0x69,
+    0xC3, 0xA3, 0xC5, 0x4E, 0xE9, 0xA2, 0xD9, 0x17, 0x8F, 0x9F, 0xED, 0xA0, 0xE6, 0xAB, 0x1E, 0x1D,
+    0x34, 0xAB, 0x4C, 0xCD, 0xD0, 0x3D, 0x97, 0xE1, 0x8E, 0xCA, 0x70, 0xA1, 0x12, 0x14, 0x3D, 0xD1,
+    0x64, 0x33, 0xD1, 0x26, 0x1B, 0x51, 0x93, 0x8D, 0xE8, 0xD8, 0x0D, 0x98, 0xE8, 0x02, 0x36, 0x38,
+    0x70, 0xF8, 0x1B, 0x7F, 0xB8, 0xE1, 0xE4, 0x61, 0x5F, 0xE9, 0xAB, 0x2F, 0xF4, 0xC5, 0x4F, 0xF8,
+    0xE1, 0x06, 0x57, 0xAA, 0x73, 0xAB, 0xC2, 0x18, 0xAC, 0x44, 0xC6, 0x48, 0x57, 0xE8, 0x13, 0x7A,
+    0xE4, 0x24, 0xD3, 0xFC, 0x36, 0x7E, 0xF9, 0x2E, 0xFC, 0x5D, 0xB6, 0x0E, 0x6E, 0xDF, 0x31, 0x4F,
+    0x0C, 0x58, 0xFB, 0xDC, 0xAB, 0x13, 0xFA, 0xD5, 0x5F, 0xFF, 0x2C, 0xD3, 0xA4, 0x39, 0xDF, 0x85,
+    0x97, 0xDC, 0x4B, 0x0E, 0x6E, 0x9B, 0x6A, 0x23, 0x5F, 0x6E, 0x17, 0x95, 0xBE, 0x6E, 0xC3, 0xC8,
+    0xFC, 0x8F, 0x12, 0x3B, 0x7C, 0x95, 0x49, 0x0F, 0xB6, 0xBA, 0xA9, 0x09, 0x6A, 0x26, 0x5C, 0xAD,
+    0xEA, 0x2C, 0x73, 0xA2, 0x25, 0x32, 0xDF, 0xE8, 0xD1, 0xA9, 0x99, 0x71, 0x41, 0x4F, 0x54, 0xDC,
+    0x2A, 0xB0, 0x76, 0x50, 0x1F, 0xDD, 0x5B, 0xE8, 0x44, 0x0A, 0xBB, 0xD3, 0xA7, 0xA3, 0xCA, 0x78,
+    0x6C, 0x6C, 0x66, 0x4E, 0x30, 0xD3, 0x33, 0x05, 0x67, 0x4D, 0x64, 0x3F, 0x7B, 0x94, 0x0C, 0x33,
+    0xA6, 0x70, 0xB5, 0x20, 0x2D, 0x03, 0x5E, 0x32, 0xFB, 0xC7, 0xAB, 0x2A, 0x2C, 0x26, 0xB1, 0x74,
+    0x91, 0x9D, 0x0B, 0xEC, 0x3C, 0x6C, 0x7B, 0x58, 0x0E, 0x0C, 0x9E, 0x77, 0xA8, 0xB2, 0xC3, 0xA4,
+    0x9E, 0x2E, 0xFA, 0x38, 0xD2, 0x49, 0x45, 0xCB, 0x74, 0x95, 0xEF, 0xCE, 0x92, 0x99, 0xB5, 0x3C,
+    0x23, 0xE5, 0xC6, 0xA6, 0x7B, 0x27, 0x35, 0x1F, 0x14, 0x17, 0xF4, 0x1B, 0x61, 0x8B, 0x7B, 0x49,
+    0x65, 0x64, 0xB0, 0x51, 0x55, 0x36, 0x74, 0x53, 0x5B, 0x18, 0xB1, 0x51, 0x95, 0xE3, 0x34, 0x37,
+    0x98, 0xE9, 0xD9, 0x82, 0xEF, 0x7E, 0xEF, 0x34, 0x39, 0x9B, 0xBA, 0xDC, 0x48, 0x92, 0xCA, 0x93,
+    0xAF, 0x7F, 0x5C, 0xD1, 0xBF, 0x1A, 0x16, 0xF4, 0xBF, 0xB1, 0xC3, 0x54, 0x76, 0xD8, 0xCC, 0x16,
+    0x9B, 0x58, 0x56, 0x9F, 0xE8, 0x06, 0x2A, 0x8E, 0xB6, 0xAC, 0xB6, 0xF2, 0x64, 0xCD, 0x49, 0x5D,
+    0x64, 0x7C, 0x7E, 0x04, 0x91, 0x0A, 0x1F, 0xC9, 0x44, 0x53, 0x1E, 0x3C, 0xBA, 0x91, 0xCB, 0x8A,
+    0x57, 0x25, 0xA0, 0xFB, 0x30, 0xC0, 0x28, 0x13, 0x9C, 0x9E, 0x86, 0x23, 0xAC, 0x26, 0x25, 0x55,
+    0x7D, 0xB8, 0x53, 0xB9, 0x69, 0x33, 0xCC, 0x70, 0x71, 0xAC, 0x77, 0x74, 0xA2, 0x9D, 0x61, 0x07,
+    0x2E, 0xF2, 0xAD, 0xDC, 0x64, 0xF9, 0x5E, 0x71, 0x92, 0x5B, 0x99, 0xAE, 0x04, 0x9D, 0x5B, 0x73,
+    0xBB, 0xD0, 0xC7, 0x7E, 0xEE, 0xA4, 0x95, 0xE9, 0xA1, 0xB9, 0x1F, 0xED, 0x3B, 0xA9, 0xF9, 0xA0,
+    0xF8, 0x13, 0x9D, 0x9A, 0xFF, 0x98, 0x4E, 0x5E, 0x36, 0x53, 0xFB, 0x71, 0xF0, 0xD9, 0x44, 0xB5,
+    0xA7, 0x8F, 0x36, 0xAA, 0xCA, 0x18, 0xEC, 0xA0, 0x0B, 0x42, 0x17, 0x4C, 0x66, 0xC1, 0x61, 0xA7,
+    0xA6, 0xE2, 0x57, 0xA6, 0x9D, 0xAC, 0x2C, 0x3C, 0xBF, 0xDF, 0x05, 0x95, 0xB9, 0xB8, 0xED, 0xD0,
+    0x89, 0xFD, 0xEC, 0x31, 0x13, 0x92, 0x4E, 0xB0, 0x91, 0x31, 0x5C, 0x6F, 0x60, 0x73, 0x16, 0x9B,
+    0x8A, 0x64, 0xF6, 0x3C, 0x95, 0xD9, 0xA1, 0x0A, 0x1B, 0x9A, 0xCA, 0x39, 0x54, 0xEE, 0x42, 0xE5,
+    0x02, 0xCE, 0x29, 0xB0, 0x69, 0x32, 0x9C, 0xA8, 0x04, 0x27, 0x3A, 0x82, 0xB7, 0x03, 0xF8, 0x0E,
+    0x78, 0xF8, 0x0E, 0xF0, 0xF0, 0xCB, 0x80, 0xCF, 0xC7, 0xE2, 0xD3, 0x87, 0x63, 0xA5, 0x3B, 0x03,
+    0x3A, 0xC1, 0x37, 0xFB, 0x70, 0x28, 0xC9, 0x25, 0x01, 0x7F, 0x7C, 0x8C, 0xC1, 0x03, 0x40, 0x2B,
+    0x11, 0x94, 0x14, 0x68, 0xF3, 0xED, 0xA3, 0xD3, 0x9E, 0x01, 0xEE, 0x00, 0x74, 0x01, 0x30, 0x11,
+    0x38, 0x93, 0xE7, 0x69, 0x44, 0x04, 0xB5, 0xDF, 0x9C, 0x65, 0x35, 0xDB, 0xB0, 0x57, 0x45, 0x4F,
+    0xF6, 0x95, 0xB9, 0xC9, 0x6D, 0xA9, 0x5C, 0xB0, 0xDD, 0xE0, 0x71, 0x4F, 0x07, 0x3B, 0x98, 0x5F,
+    0x4D, 0x2A, 0xA9, 0xF7, 0x0A, 0x85, 0xBA, 0xE3, 0x9C, 0x6D, 0x17, 0x1D, 0x3B, 0x35, 0x9B, 0x38,
+    0xD2, 0xBF, 0xFE, 0xEF, 0x82, 0x16, 0x59, 0xE0, 0x96, 0xBC, 0x79, 0x1C, 0x42, 0x47, 0xA0, 0xCD,
+    0xEB, 0xFB, 0x1C, 0xDA, 0xE1, 0x02, 0x9A, 0xFD, 0x05, 0xE0, 0x17, 0xA0, 0xFD, 0xFE, 0x35, 0x93,
+    0x11, 0x9A, 0x45, 0x49, 0x34, 0x8B, 0x7A, 0x27, 0xB9, 0x7F, 0x45, 0xE7, 0x73, 0x50, 0x65, 0x86,
+    0xE6, 0xA3, 0x0C, 0x48, 0x64, 0x6D, 0xC9, 0xAF, 0x25, 0xBF, 0x04, 0x68, 0x65, 0x00, 0xFD, 0xD3,
+    0x08, 0xF6, 0xCF, 0x26, 0x38, 0xD1, 0x99, 0x3F, 0xAD, 0xEA, 0xA3, 0xE2, 0x73, 0x2B, 0xD9, 0x47,
+    0xF6, 0xE1, 0xCA, 0xC4, 0xFC, 0x4F, 0x14, 0xFE, 0x95, 0x57, 0x66, 0xF3, 0x46, 0xA7, 0x3F, 0xA8,
+    0xFD, 0x6C, 0xE5, 0x95, 0xFD, 0xE4, 0x66, 0xF5, 0xAB, 0x70, 0xDF, 0x21, 0x90, 0xF3, 0x11, 0xCC,
+    0x36, 0x1C, 0xAC, 0xED, 0x65, 0x95, 0x03, 0xAD, 0x84, 0xA6, 0x8C, 0x33, 0xBE, 0x79, 0x3A, 0xE8,
+    0xD4, 0x14, 0xCE, 0x71, 0x98, 0xA8, 0x32, 0x15, 0x4F, 0x17, 0x55, 0xD6, 0x33, 0xFE, 0xB7, 0x12,
+    0x1A, 0xF9, 0x38, 0xD3, 0xFE, 0xD0, 0x1F, 0x1F, 0xB6, 0xB9, 0x1F, 0xCC, 0xEB, 0x11, 0xF6, 0x15,
+    0xAC, 0x00, 0xE3, 0x70, 0xD5, 0x6C, 0xA1, 0x19, 0x63, 0x9B, 0x79, 0xB9, 0xAF, 0x78, 0xDC, 0x33,
+    0x4F, 0x47, 0x9D, 0x54, 0xA1, 0xB2, 0xC5, 0xD3, 0x0D, 0x36, 0xEA, 0xD4, 0x16, 0x2A, 0xE7, 0x78,
+    0xBA, 0xC1, 0x44, 0x95, 0x3F, 0xF1, 0xF5, 0x70, 0x75, 0xA1, 0xA7, 0x1B, 0x5C, 0xB4, 0xB9, 0x29,
+    0xBA, 0xB6, 0xEF, 0x34, 0xEE, 0x91, 0x8F, 0xE3, 0xDF, 0xBF, 0xFB, 0xDE, 0x72, 0xB1, 0xDB, 0xB8,
+    0x6D, 0x27, 0x5A, 0x7E, 0x2C, 0x61, 0x1C, 0x7C, 0xEA, 0x26, 0xC2, 0x95, 0xEE, 0xFF, 0xAF, 0x8C,
+    0xFD, 0xB9, 0x75, 0xEC, 0x5F, 0x5F, 0x1F, 0x3B, 0x8E, 0x83, 0x4F, 0xF6, 0x36, 0x81, 0x07, 0x50,
+    0xF1, 0x5A, 0xD9, 0xA8, 0xD7, 0x2F, 0x17, 0x00, 0xB8, 0x00, 0x07, 0xBB, 0x78, 0x55, 0x09, 0x48,
+    0xF6, 0x22, 0xF9, 0x1F, 0x4E, 0xCF, 0x86, 0x99, 0x73, 0x6A, 0x9B, 0xF9, 0xAA, 0x89, 0xD0, 0x9D,
+    0xAE, 0x35, 0xD2, 0xFE, 0x85, 0x4A, 0xA1, 0xB6, 0x99, 0xAD, 0xCA, 0x5C, 0xA8, 0x4C, 0x55, 0xB9,
+    0x99, 0xDB, 0x59, 0x67, 0x44, 0x22, 0x7E, 0xB9, 0x7C, 0xD3, 0x06, 0xE3, 0x04, 0x9D, 0x91, 0x01,
+    0xEA, 0x8D, 0x2D, 0xA8, 0xDC, 0xE6, 0x63, 0x4B, 0xFF, 0x9C, 0x3B, 0xD0, 0x96, 0xE6, 0xDD, 0x7B,
+    0xD8, 0x68, 0x44, 0x82, 0xC7, 0xBF, 0x25, 0xCD, 0x4C, 0x61, 0x31, 0x93, 0x9E, 0xDA, 0xE2, 0x70,
+    0x98, 0xA9, 0x72, 0x81, 0x57, 0xF9, 0xD9, 0xDC, 0xCC, 0xDD, 0xB7, 0x1F, 0x4F, 0x5D, 0xEC, 0xAB,
+    0x95, 0xDA, 0x4A, 0xB4, 0x12, 0xF4, 0x4C, 0x13, 0x8E, 0x1B, 0x7B, 0x96, 0x51, 0x32, 0x71, 0xE3,
+    0x6C, 0x35, 0x7F, 0x2A, 0xAD, 0x24, 0xBA, 0xF8, 0xCB, 0x41, 0x89, 0x4C, 0xF6, 0x5F, 0xFA, 0x78,
+    0x8E, 0x7F, 0x34, 0x73, 0x6E, 0x63, 0x53, 0x3C, 0x26, 0x56, 0x7C, 0x3B, 0xEB, 0xAC, 0x45, 0xD0,
+    0x92, 0xAE, 0xFC, 0x4C, 0x3F, 0x63, 0xA5, 0xB2, 0xE8, 0x59, 0x0F, 0x3A, 0xDF, 0x7F, 0x78, 0x8D,
+    0x00, 0x5B, 0xBE, 0xF4, 0x42, 0x41, 0x64, 0x6A, 0x4E, 0xFB, 0x75, 0x0C, 0x9D, 0xFE, 0x06, 0xAF,
+    0x63, 0x3B, 0xBB, 0xC9, 0xC5, 0x5E, 0x66, 0x7A, 0x09, 0xD7, 0xBC, 0xCB, 0xAD, 0x99, 0x9B, 0x12,
+    0xFB, 0x8A, 0x93, 0xFC, 0xD0, 0x8C, 0x3C, 0x5E, 0x9B, 0x59, 0xCD, 0xD4, 0xB6, 0x98, 0xC4, 0xA2,
+    0xB2, 0x8D, 0x6C, 0x55, 0x76, 0x03, 0x5B, 0xF5, 0xD1, 0x08, 0x5B, 0x2D, 0x02, 0xD5, 0xBC, 0xBD,
+    0x83, 0x6A, 0xE3, 0x86, 0x66, 0xB6, 0x71, 0x83, 0xCA, 0xDD, 0xD0, 0x63, 0x52, 0x17, 0x3C, 0x5D,
+    0x74, 0xF8, 0x38, 0xE2, 0xE9, 0xA4, 0x72, 0xB2, 0x66, 0xB6, 0x6B, 0xB5, 0xDC, 0x4D, 0xA9, 0x28,
+    0x91, 0xC8, 0xC2, 0x8C, 0x0F, 0x5D, 0x50, 0xB9, 0xCD, 0x6C, 0xF0, 0xE8, 0xAC, 0x12, 0x7E, 0x38,
+    0xA7, 0x11, 0x89, 0x28, 0xA9, 0x70, 0x62, 0x07, 0x6C, 0x2C, 0xB4, 0xA5, 0x6B, 0xE8, 0xDB, 0x77,
+    0xDF, 0x7F, 0x31, 0xFA, 0x6D, 0x5F, 0x94, 0x3C, 0x56, 0x71, 0xF1, 0x3E, 0x08, 0x70, 0x83, 0x07,
+    0xF1, 0xCF, 0x54, 0xFA, 0x67, 0x2B, 0x7D, 0x3B, 0xF3, 0xE0, 0xB5, 0x02, 0x64, 0xCD, 0xCC, 0x01,
+    0x2F, 0x91, 0x6A, 0x26, 0x95, 0xF4, 0x64, 0xA2, 0x99, 0xEC, 0xD0, 0x45, 0xC7, 0x88, 0xD7, 0x95,
+    0x7E, 0x4C, 0xF4, 0xCB, 0x2A, 0x3D, 0x5B, 0x60, 0x4B, 0x4B, 0x4F, 0x17, 0xFC, 0x5B, 0x7B, 0x9C,
+    0xCC, 0x18, 0x19, 0xE0, 0x6B, 0xF0, 0x9F, 0xD5, 0xBD, 0x4D, 0x8C, 0x25, 0xC7, 0x95, 0xEF, 0xF7,
+    0xCB, 0x8C, 0xEA, 0x4E, 0x0D, 0x73, 0xA4, 0x68, 0x03, 0xEC, 0x79, 0xB4, 0xF8, 0xC4, 0x14, 0x60,
+    0x2D, 0xF4, 0x06, 0x22, 0xD3, 0x8B, 0x59, 0x10, 0x46, 0x57, 0x45, 0x92, 0x04, 0x2C, 0x18, 0xB3,
+    0x60, 0x2F, 0x54, 0xE2, 0x7B, 0xA3, 0x05, 0x65, 0xE0, 0x2D, 0x9E, 0xB5, 0x29, 0x2F, 0x64, 0x80,
+    0x80, 0xAB, 0x6E, 0x26, 0x49, 0xC0, 0xB3, 0xD0, 0x42, 0x3D, 0x80, 0x25, 0x2F, 0xDE, 0xC2, 0x04,
+    0xAC, 0x79, 0x10, 0x8A, 0x8B, 0xD6, 0x82, 0x80, 0xDB, 0xF0, 0xBD, 0x95, 0x41, 0x36, 0x0C, 0x2D,
+    0xB4, 0x50, 0x4A, 0xB4, 0x4C, 0x18, 0x02, 0xAC, 0xD0, 0x0C, 0x29, 0x41, 0xD4, 0xA2, 0x83, 0x54,
+    0xF0, 0x29, 0xBB, 0x3B, 0xF2, 0x1E, 0x2F, 0x22, 0xEF, 0xAD, 0xAA, 0xEE, 0xE6, 0x8C, 0x66, 0xF4,
+    0xC5, 0x97, 0x40, 0xDF, 0xEE, 0xAE, 0x7B, 0xEB, 0xDE, 0x8C, 0x13, 0x27, 0xCE, 0xC7, 0xFF, 0xFC,
+    0xCF, 0xB9, 0x64, 0x64, 0x11, 0x63, 0xD5, 0xC8, 0xA7, 0x48, 0xD7, 0x35, 0x3E, 0x45, 0x3E, 0xB0,
+    0x8B, 0xB2, 0x1C, 0x52, 0x5A, 0x46, 0x74, 0x97, 0x05, 0x6A, 0x94, 0xC7, 0x50, 0x3A, 0x26, 0xB4,
+    0xCD, 0x23, 0x86, 0xBC, 0x99, 0x7F, 0x87, 0x00, 0x5C, 0x01, 0x2A, 0xA0, 0xEC, 0x40, 0x0D, 0x80,
+    0x87, 0x5C, 0x06, 0x4A, 0x11, 0x2A, 0x11, 0x5B, 0xBD, 0xF9, 0xBA, 0xD3, 0xD6, 0xA3, 0xED, 0x0B,
+    0x14, 0xEE, 0x71, 0x72, 0x5F, 0x42, 0x54, 0x16, 0x83, 0x43, 0xDB, 0x17, 0x50, 0xFE, 0x71, 0x88,
+    0x1A, 0xCC, 0xCB, 0xF6, 0x4A, 0x71, 0xDB, 0x2D, 0x10, 0x59, 0xA3, 0x65, 0x82, 0xF6, 0x6D, 0x28,
+    0x3A, 0xC8, 0xDD, 0x87, 0x7D, 0xD8, 0x7C, 0x3D, 0x3A, 0x02, 0x46, 0x2C, 0x98, 0x57, 0x47, 0x30,
+    0xB4, 0x50, 0x35, 0xDA, 0xA2, 0xAD, 0x1A, 0x28, 0x06, 0x1A, 0x94, 0x07, 0x88, 0x00, 0x0B, 0x00,
+    0xD3, 0x80, 0x12, 0x59, 0x93, 0x89, 0x48, 0x43, 0x3E, 0x02, 0x4C, 0x00, 0x06, 0xA0, 0xEA, 0x80,
+    0x72, 0x80, 0xF4, 0x8B, 0x59, 0x80, 0xC6, 0xAC, 0x8F, 0xAF, 0x07, 0x2D, 0x22, 0x51, 0xC5, 0x4F,
+    0xCA, 0xC4, 0xB7, 0x00, 0x68, 0x60, 0x87, 0x90, 0x5D, 0x2D, 0x6D, 0x5D, 0xCA, 0xD7, 0x6D, 0x2E,
+    0x22, 0x1D, 0x75, 0x67, 0x1A, 0x74, 0xA7, 0x5C, 0x12, 0xA5, 0x72, 0xEC, 0x41, 0xA0, 0x6A, 0xD8,
+    0xA5, 0xB4, 0xE8, 0xAE, 0x1C, 0x28, 0xC6, 0x47, 0x3D, 0x5A, 0x44, 0xA8, 0x5E, 0x92, 0x97, 0xBC,
+    0x6A, 0xE0, 0xC9, 0xB4, 0x9C, 0xCB, 0xFB, 0x57, 0x2F, 0xEF, 0x7F, 0x5E, 0x26, 0x25, 0xB1, 0x5E,
+    0xF3, 0xE8, 0x1A, 0x03, 0x06, 0x35, 0x52, 0x0E, 0x54, 0x36, 0x1B, 0x21, 0x62, 0xA0, 0x74, 0xDA,
+    0x82, 0xC9, 0x03, 0xA8, 0xB0, 0x00, 0x2D, 0x5F, 0x17, 0x8B, 0xAC, 0x25, 0x40, 0x39, 0x01, 0xB4,
+    0x1D, 0x68, 0x91, 0x35, 0x88, 0x88, 0x85, 0xD2, 0x01, 0xAC, 0x00, 0xB4, 0xDD, 0xCA, 0xA3, 0xB6,
+    0xC0, 0x81, 0x38, 0xD0, 0xB2, 0x9E, 0x25, 0xBA, 0x44, 0x77, 0x04, 0x34, 0x99, 0xA7, 0x46, 0x39,
+    0x76, 0x29, 0x66, 0xCD, 0xB8, 0xCA, 0xD9, 0x2B, 0xEF, 0x4E, 0xF5, 0x85, 0x40, 0x45, 0xEE, 0xD9,
+    0x43, 0x0D, 0xE9, 0x17, 0xE0, 0xDF, 0x40, 0x25, 0x9D, 0xBA, 0x23, 0xCD, 0x2E, 0x27, 0xCA, 0x13,
+    0x6A, 0xAB, 0xEC, 0xDD, 0x8E, 0xE2, 0xEB, 0x0D, 0x8F, 0x57, 0x1D, 0xAF, 0x55, 0x5D, 0x3E, 0x54,
+    0xB6, 0xB0, 0xDA, 0x6A, 0xAB, 0x6D, 0x65, 0x75, 0x57, 0x0D, 0x15, 0xD5, 0x70, 0x05, 0x3D, 0x78,
+    0xCA, 0x9B, 0x16, 0xFD, 0x7D, 0xD0, 0x37, 0xAE, 0x50, 0xDF, 0xF4, 0xAC, 0xF5, 0x50, 0xF8, 0xFA,
+    0x9D, 0x1E, 0x23, 0x8E, 0x4F, 0xBE, 0x0D, 0x17, 0x78, 0xB8, 0xB6, 0x93, 0x79, 0x63, 0x32, 0x4F,
+    0xC5, 0x9D, 0xD3, 0x7B, 0xAB, 0xE4, 0x6D, 0xA0, 0x7F, 0xB7, 0x1F, 0x60, 0x0D, 0x27, 0x10, 0x41,
+    0x39, 0x46, 0x60, 0x8F, 0x43, 0xDA, 0xA0, 0xEC, 0x2E, 0xB2, 0xE6, 0x46, 0xC5, 0xA8, 0x3A, 0x5D,
+    0x36, 0x87, 0xB8, 0xFC, 0x4D, 0xFB, 0x04, 0x97, 0x78, 0xC1, 0xEB, 0x06, 0x1E, 0xBB, 0xA2, 0x06,
+    0x28, 0xBE, 0x4F, 0x80, 0xEC, 0xEF, 0xED, 0x1E, 0xF0, 0xC2, 0x6B, 0xA5, 0x85, 0xC7, 0x1F, 0xCB,
+    0x26, 0x1A, 0xAD, 0x6C, 0x2D, 0xBE, 0xB0, 0x37, 0x32, 0x09, 0x6A, 0xD0, 0x0D, 0xE4, 0x9E, 0x00,
+    0xB9, 0xA7, 0xEA, 0x28, 0x3C, 0xC8, 0x37, 0x0E, 0x1C, 0x14, 0x22, 0x1D, 0x70, 0xE1, 0x6F, 0xE7,
+    0x1B, 0xD3, 0xBF, 0xB6, 0x95, 0x0C, 0xFA, 0x29, 0x5F, 0x76, 0x37, 0x94, 0xDD, 0xCD, 0xBC, 0xE6,
+    0x46, 0x69, 0x9F, 0x28, 0x7E, 0x5A, 0xFE, 0xF8, 0xFF, 0x78, 0x5D, 0xBE, 0xEE, 0xEA, 0x67, 0x1C,
+    0x00, 0x99, 0x12, 0x79, 0x43, 0x64, 0xE8, 0x45, 0xDE, 0x17, 0x91, 0xD7, 0xF7, 0xF7, 0x0F, 0x80,
+    0x43, 0xC8, 0x3C, 0x14, 0x36, 0x9D, 0x03, 0x5A, 0xF9, 0x3B, 0x91, 0xEF, 0xCA, 0x1A, 0xB2, 0x7D,
+    0xA0, 0x97, 0x0E, 0x7D, 0xAD, 0x1C, 0x08, 0x28, 0x5B, 0x5E, 0xFC, 0xB6, 0xB2, 0x2F, 0xD4, 0xAB,
+    0xE2, 0x69, 0xFB, 0xE4, 0x0B, 0x5A, 0xF3, 0x53, 0xF7, 0xB9, 0x2B, 0xEA, 0x16, 0xDF, 0x71, 0xDA,
+    0xE7, 0x37, 0xED, 0x93, 0xBE, 0x2C, 0xF9, 0xA9, 0xBF, 0xF2, 0x29, 0xFD, 0xD3, 0xF7, 0xDC, 0x95,
+    0xCB, 0x4F, 0x3D, 0xCB, 0x15, 0x78, 0x8D, 0x23, 0xAA, 0x86, 0x5A, 0x02, 0x5C, 0xFC, 0x36, 0x5C,
+    0xDE, 0x7F, 0x5A, 0xE4, 0x7B, 0x22, 0x40, 0x76, 0xD2, 0x68, 0x71, 0xE6, 0xF3, 0xE1, 0x90, 0xB8,
+    0xE4, 0x70, 0xC9, 0xE1, 0x92, 0xE5, 0x82, 0xD1, 0xFC, 0xD2, 0x97, 0x62, 0xF9, 0xB7, 0x69, 0x75,
+    0x7B, 0xC0, 0x08, 0xCA, 0x81, 0xEE, 0x60, 0x8F, 0x6C, 0xFF, 0xF6, 0x7E, 0x2D, 0x12, 0x7B, 0x11,
+    0x7F, 0xFF, 0xB3, 0xE9, 0x54, 0xA7, 0x6B, 0x7F, 0x7F, 0xFF, 0x2F, 0x45, 0xA4, 0x16, 0x89, 0x00,
+    0xE5, 0x44, 0x25, 0x83, 0xFE, 0x41, 0x2C, 0xBB, 0x3A, 0xB3, 0xDA, 0x52, 0x0C, 0x28, 0x47, 0xE1,
+    0x29, 0x1C, 0xA5, 0x43, 0x0F, 0x68, 0x4B, 0xF5, 0xEE, 0xB1, 0x16, 0xE9, 0x8E, 0x8F, 0x3B, 0x80,
+    0xDA, 0x67, 0x12, 0x95, 0x5B, 0xAA, 0xE6, 0x10, 0x96, 0xE4, 0x9E, 0x03, 0x9B, 0x89, 0xE3, 0x7F,
+    0xF1, 0x64, 0x81, 0x2C, 0xA0, 0x3C, 0xF5, 0xD0, 0x4A, 0xD3, 0xBE, 0x9D, 0x8C, 0x5E, 0x69, 0x5B,
+    0x15, 0xCC, 0xD3, 0x5E, 0x6F, 0xEF, 0xA2, 0x18, 0x38, 0x22, 0xF7, 0x18, 0x88, 0x68, 0xCB, 0x1E,
+    0x85, 0xA3, 0xEA, 0xF2, 0x40, 0x31, 0xA4, 0xB7, 0x4C, 0xCF, 0x74, 0xE9, 0x19, 0x3D, 0x3F, 0x13,
+    0xC9, 0x03, 0x2D, 0xAC, 0x31, 0x16, 0x63, 0x9F, 0xF0, 0x97, 0xF4, 0xD4, 0x9A, 0x55, 0x21, 0xA2,
+    0xD7, 0xF9, 0xCF, 0xD7, 0xD9, 0xC4, 0xF8, 0x30, 0x3B, 0xEC, 0x41, 0x5A, 0x3A, 0xC5, 0x00, 0xE4,
+    0x61, 0x7B, 0x06, 0x0D, 0xC0, 0x27, 0x66, 0xCB, 0x7A, 0x51, 0xA4, 0xA1, 0x16, 0xB1, 0xB4, 0xB2,
+    0x68, 0x68, 0xE5, 0x59, 0x30, 0x72, 0xD3, 0x52, 0xCB, 0x7B, 0x0E, 0x2D, 0xF1, 0x35, 0x0A, 0x59,
+    0xEF, 0x92, 0x8B, 0x3C, 0x0B, 0xFD, 0xF6, 0x99, 0x42, 0xE2, 0x6B, 0x20, 0xEB, 0x5D, 0xD0, 0xF2,
+    0x2C, 0xF0, 0xBF, 0xDF, 0xB4, 0xC0, 0x7B, 0x0E, 0xB8, 0xF2, 0x1A, 0xF0, 0xD8, 0x2E, 0x50, 0x3E,
+    0x0B, 0xA8, 0xD3, 0x67, 0x5E, 0x08, 0xC0, 0xE3, 0x87, 0x80, 0xDE, 0x85, 0x4B, 0x7A, 0x82, 0x27,
+    0x9E, 0x1F, 0xA1, 0x94, 0x0E, 0xF8, 0xEF, 0x00, 0xB2, 0x2C, 0x9A, 0x9B, 0xD1, 0x00, 0x57, 0x55,
+    0xBC, 0x38, 0x71, 0x48, 0x54, 0xBE, 0xB6, 0xFF, 0x39, 0x40, 0xB6, 0xCC, 0xC5, 0x9A, 0x40, 0xD5,
+    0xE4, 0x1E, 0xB3, 0x35, 0x15, 0x4B, 0xB4, 0x65, 0xA4, 0xEA, 0x6A, 0x79, 0xFA, 0xF8, 0x15, 0x80,
+    0x62, 0x4D, 0x21, 0xAE, 0x18, 0x96, 0xCA, 0x55, 0x99, 0x2F, 0xEC, 0x32, 0xF7, 0x35, 0xB1, 0xB4,
+    0x47, 0xB9, 0x5F, 0x60, 0x84, 0x62, 0x4A, 0xAB, 0xCF, 0x72, 0x11, 0x2B, 0x32, 0x9B, 0xF7, 0x2F,
+    0x27, 0x17, 0xC0, 0x48, 0xD6, 0x5B, 0x50, 0x9E, 0x42, 0xBA, 0x24, 0xBF, 0xAA, 0x49, 0xC2, 0xAC,
+    0x67, 0xF9, 0xD5, 0xC0, 0x32, 0x29, 0x61, 0x16, 0x80, 0xDD, 0xA4, 0x6A, 0x1C, 0x41, 0x69, 0xF9,
+    0x1C, 0x4B, 0xA8, 0x60, 0x22, 0xC2, 0x2E, 0x2A, 0x32, 0xC2, 0x88, 0x8E, 0x04, 0x72, 0xCF, 0xEE,
+    0x8D, 0x4A, 0x9A, 0xC2, 0x32, 0x06, 0x23, 0x8D, 0x6E, 0x94, 0x0B, 0xC0, 0x1E, 0xFA, 0x45, 0x0F,
+    0x2C, 0xD9, 0xCB, 0x3D, 0x64, 0x81, 0xE9, 0xB9, 0x0F, 0x40, 0xB9, 0x4C, 0x44, 0x40, 0x5B, 0xBE,
+    0xF2, 0xEA, 0x2F, 0xD2, 0x07, 0x17, 0x16, 0x8E, 0x80, 0xD2, 0xA6, 0x1D, 0xD5, 0x1D, 0xF8, 0x59,
+    0xA9, 0x2E, 0x9D, 0x31, 0x97, 0x4D, 0x5A, 0x4F, 0x31, 0xA4, 0xF5, 0x68, 0x9B, 0xD6, 0x63, 0x48,
+    0xEB, 0x39, 0x9A, 0xD7, 0x31, 0xA6, 0xBF, 0x95, 0x4F, 0xEB, 0x29, 0x6D, 0x5A, 0x4F, 0xD5, 0xA4,
+    0xF5, 0xEC, 0xF1, 0xE8, 0x2B, 0x2C, 0x61, 0x99, 0x49, 0x24, 0x92, 0xF9, 0xE2, 0xF6, 0x9A, 0x11,
+    0x35, 0xE8, 0xCE, 0x10, 0xD0, 0x5D, 0xC9, 0x5E, 0x25, 0x4D, 0x0D, 0x1C, 0x19, 0x69, 0x0E, 0xE7,
+    0x77, 0x0C, 0xE9, 0x1D, 0x95, 0x4B, 0x0E, 0xAE, 0xB4, 0x70, 0x92, 0x3E, 0x38, 0x4F, 0xCB, 0x4D,
+    0x6E, 0x21, 0x42, 0xBB, 0x7F, 0x95, 0xDC, 0x83, 0xC8, 0x48, 0x31, 0x40, 0x2F, 0x3E, 0xD9, 0xF3,
+    0x7B, 0xAF, 0x4F, 0xC3, 0xC5, 0x90, 0x6E, 0x56, 0x4B, 0x07, 0x55, 0x87, 0x7E, 0xCB, 0x83, 0xB6,
+    0xA8, 0xEE, 0x70, 0xBE, 0xF3, 0x6A, 0x56, 0xF8, 0xAA, 0x49, 0x3B, 0x72, 0x90, 0xFC, 0x71, 0x26,
+    0x03, 0xB9, 0x07, 0xFE, 0xAB, 0x08, 0x81, 0xDC, 0x52, 0x35, 0x8C, 0xA8, 0xF9, 0xB0, 0xA9, 0x88,
+    0xF2, 0x1C, 0xA2, 0x84, 0x22, 0xB0, 0x8B, 0xFA, 0xF1, 0xFF, 0xD4, 0x8F, 0xEC, 0xA1, 0xFE, 0xFE,
+    0x07, 0xE2, 0xA8, 0x51, 0x2E, 0x5C, 0x86, 0x0A, 0xE5, 0x0E, 0x01, 0xDD, 0x29, 0x57, 0x03, 0xDA,
+    0xAA, 0x0F, 0x9E, 0xFF, 0xBF, 0xA1, 0xB4, 0x69, 0x93, 0x8A, 0x81, 0x4F, 0x1E, 0xDF, 0x99, 0x3F,
+    0xF8, 0x70, 0x16, 0x69, 0x3D, 0x1F, 0x3E, 0xDD, 0xC1, 0x8D, 0x79, 0x25, 0x3B, 0x6C, 0xB7, 0xAB,
+    0xF0, 0x18, 0xCB, 0x44, 0x7E, 0x6D, 0xDE, 0x35, 0x8F, 0xF1, 0x5C, 0xB7, 0xD4, 0x64, 0x23, 0x55,
+    0x97, 0x8D, 0xD4, 0x5D, 0x36, 0x52, 0x75, 0x44, 0xD4, 0x40, 0xD5, 0xB0, 0xE0, 0x92, 0x5C, 0x7F,
+    0x5D, 0xD6, 0x99, 0xF8, 0x74, 0x66, 0xAA, 0xEE, 0x1A, 0x50, 0x8F, 0x87, 0x6C, 0xFC, 0x6A, 0x71,
+    0x53, 0x00, 0x86, 0xC5, 0xFD, 0x52, 0x6C, 0xD8, 0x44, 0x1A, 0xA8, 0x08, 0x90, 0x49, 0x03, 0x90,
+    0x4E, 0xC1, 0x6A, 0x04, 0xD8, 0x35, 0x00, 0xB5, 0xB6, 0x80, 0x7E, 0xC6, 0x03, 0xBA, 0x5B, 0x01,
+    0x85, 0xAD, 0x3B, 0x50, 0xAE, 0xF0, 0x90, 0x7B, 0x22, 0x30, 0x62, 0x80, 0x93, 0xE3, 0xEB, 0x03,
+    0x18, 0x91, 0x11, 0xCC, 0xF1, 0xB1, 0x40, 0xD5, 0x50, 0x59, 0xB4, 0x45, 0x79, 0xCA, 0x01, 0x26,
+    0x94, 0x07, 0xD3, 0xE5, 0x01, 0xB4, 0x2F, 0x65, 0xE0, 0x40, 0xBE, 0x27, 0x23, 0x46, 0x3C, 0x90,
+    0xBC, 0x69, 0x2E, 0x0D, 0x90, 0xDD, 0x09, 0x00, 0xFE, 0x09, 0x80, 0x2B, 0x45, 0x07, 0xE8, 0x7C,
+    0x00, 0xD4, 0x7F, 0xF4, 0x00, 0xC6, 0x03, 0x64, 0x57, 0xCF, 0x48, 0xD2, 0xA4, 0x47, 0x0B, 0x50,
+    0x05, 0x00, 0x3D, 0x01, 0x94, 0x3F, 0xE9, 0x00, 0xF5, 0xA6, 0x07, 0x72, 0x1F, 0x01, 0x82, 0x01,
+    0x18, 0xCB, 0x01, 0x38, 0xCC, 0x93, 0x8F, 0x6E, 0x81, 0x1A, 0x6D, 0x41, 0x77, 0xCA, 0x43, 0xF9,
+    0xEE, 0xF1, 0x04, 0x4A, 0x44, 0x3A, 0xD4, 0x9D, 0xE3, 0xEB, 0xC9, 0xA6, 0x47, 0x88, 0x60, 0x60,
+    0x05, 0x7A, 0xC0, 0x80, 0x1A, 0xA9, 0x1B, 0x10, 0xFA, 0x89, 0x8B, 0x12, 0x7B, 0xE9, 0x94, 0x48,
+    0x5A, 0x88, 0xA4, 0x7F, 0xF4, 0x29, 0x18, 0x22, 0x97, 0x77, 0x5F, 0xF5, 0xB3, 0x94, 0x6F, 0x00,
+    0xDC, 0xF5, 0x3C, 0x0E, 0x10, 0x23, 0x25, 0xC0, 0x72, 0xDE, 0xA9, 0xA3, 0xBA, 0x4B, 0xDE, 0x4D,
+    0x27, 0xA3, 0x64, 0xD2, 0x4E, 0x51, 0xB3, 0x16, 0x0F, 0x54, 0x4D, 0x2B, 0x11, 0xA8, 0x9A, 0xFA,
+    0xF8, 0xDB, 0x80, 0x7E, 0xF7, 0xFA, 0x00, 0xA0, 0x25, 0xC9, 0xB1, 0x7C, 0xF7, 0x38, 0xCE, 0xCE,
+    0xE5, 0x04, 0x1A, 0x94, 0xA3, 0x6E, 0xF8, 0x2A, 0xCA, 0xA3, 0x2D, 0xBB, 0xE4, 0x1E, 0xE5, 0xA9,
+    0xC9, 0x47, 0xF2, 0x69, 0xFF, 0xBA, 0x2D, 0x64, 0x28, 0x45, 0x64, 0x50, 0x12, 0x4A, 0x99, 0xDF,
+    0x03, 0xE0, 0x51, 0x11, 0x07, 0xBD, 0xC8, 0x1A, 0xFE, 0xC3, 0x78, 0x51, 0x2C, 0x79, 0xA0, 0xF6,
+    0x28, 0x4F, 0x31, 0xA2, 0x3C, 0x79, 0xA4, 0xF0, 0x64, 0x13, 0xA5, 0x83, 0x35, 0x7A, 0x80, 0x35,
+    0xDA, 0xC2, 0xFA, 0xC2, 0xC1, 0x8F, 0xAE, 0xB2, 0xD6, 0x22, 0x9E, 0xE9, 0xA1, 0xFE, 0xDD, 0x57,
+    0x98, 0x30, 0x0D, 0x59, 0x9C, 0x25, 0xD6, 0x82, 0xF2, 0x2C, 0x40, 0x3B, 0x4E, 0xA0, 0xB6, 0x4C,
+    0xD0, 0x43, 0x44, 0x4D, 0x64, 0x53, 0xD6, 0x7A, 0x6A, 0x11, 0x69, 0xE8, 0x45, 0xAE, 0x9D, 0xAA,
+    0x6D, 0xE1, 0x3E, 0x0B, 0xB4, 0xCE, 0x83, 0x12, 0xB1, 0xA0, 0x75, 0x04, 0x3E, 0xA3, 0x1F, 0x64,
+    0x29, 0xA8, 0x65, 0x80, 0x52, 0xC4, 0x93, 0xC9, 0x37, 0x5A, 0x4F, 0xE5, 0xA8, 0x5C, 0x36, 0x41,
+    0x6D, 0xB5, 0x03, 0xD3, 0xF5, 0x40, 0xAF, 0x3C, 0xE4, 0xB1, 0xB6, 0x50, 0xF8, 0x09, 0xA8, 0x6E,
+    0x7A, 0xA0, 0xAD, 0x2C, 0xE4, 0xB1, 0x07, 0xF4, 0xDF, 0x45, 0xC0, 0xFC, 0xA5, 0x87, 0x2C, 0xD6,
+    0x16, 0xB4, 0x6B, 0x81, 0x96, 0x09, 0x54, 0x50, 0x11, 0x4C, 0x57, 0x8C, 0x14, 0x91, 0x72, 0xBA,
+    0x20, 0x1D, 0xA5, 0x48, 0x80, 0x42, 0x26, 0x80, 0x87, 0x93, 0x7A, 0xE6, 0x8E, 0x2B, 0x55, 0xA7,
+    0xED, 0x89, 0xF2, 0xF9, 0x18, 0x29, 0x05, 0x6A, 0x8B, 0x5A, 0xC3, 0x3A, 0x60, 0xCA, 0x41, 0x0F,
+    0xF5, 0x33, 0x81, 0xD5, 0xC7, 0xC9, 0xBB, 0x7B, 0x56, 0xF0, 0x39, 0xA8, 0x45, 0xBE, 0x67, 0xA9,
+    0x6E, 0x3F, 0x27, 0x9E, 0xF4, 0x41, 0xD9, 0x1A, 0x8C, 0xC5, 0x74, 0xE8, 0x35, 0xA5, 0x47, 0xDD,
+    0xF5, 0x44, 0x88, 0x2D, 0xB5, 0x65, 0xAF, 0xF0, 0x2A, 0xA0, 0xBB, 0x96, 0x16, 0xE5, 0x0A, 0x5F,
+    0xF8, 0x6C, 0xA4, 0xA7, 0x67, 0x81, 0x76, 0xA5, 0xAF, 0x3A, 0x26, 0xFA, 0x62, 0xA0, 0xB2, 0xE5,
+    0x7B, 0x01, 0x35, 0xD2, 0xAE, 0xA0, 0xA5, 0x90, 0x06, 0x3D, 0x60, 0x06, 0xD4, 0x48, 0xBE, 0x26,
+    0x13, 0xE8, 0xA7, 0x0B, 0xD2, 0x51, 0xD7, 0x22, 0x03, 0xCA, 0xB6, 0xC9, 0x3A, 0x5C, 0x38, 0x27,
+    0xE4, 0xC3, 0x6D, 0x44, 0x5F, 0x8F, 0x80, 0x5E, 0x03, 0x6A, 0xBB, 0xF4, 0xD3, 0xAB, 0x94, 0xA8,
+    0x64, 0x12, 0xE9, 0x8C, 0xBC, 0x28, 0x0D, 0x6D, 0x57, 0x7A, 0x0A, 0x87, 0x69, 0x88, 0xE4, 0x23,
+    0x06, 0x2A, 0x5B, 0x0E, 0x30, 0x65, 0x23, 0x94, 0xCE, 0x00, 0xA6, 0xB4, 0xA0, 0x3E, 0x08, 0x40,
+    0xB5, 0x06, 0x10, 0x0B, 0x94, 0x1E, 0x92, 0x1B, 0x49, 0xF9, 0x52, 0x4A, 0xA2, 0xB4, 0x05, 0xB2,
+    0x94, 0x5E, 0x74, 0x80, 0x1A, 0x81, 0x52, 0x26, 0xC8, 0x92, 0x6B, 0x37, 0xE2, 0xC0, 0x48, 0x07,
+    0x17, 0xC7, 0x4D, 0x28, 0xA4, 0xEE, 0x5C, 0x05, 0x25, 0xD2, 0x51, 0xDC, 0xE9, 0x3D, 0xE5, 0x50,
+    0x44, 0xB4, 0xCD, 0x22, 0xDA, 0x32, 0xA5, 0x87, 0xAA, 0x23, 0x52, 0x37, 0x44, 0x0C, 0x79, 0xC0,
+    0x50, 0x7A, 0x5A, 0x5A, 0x4B, 0xDB, 0xAF, 0xA1, 0x17, 0x07, 0xD3, 0x17, 0xE6, 0xA0, 0x2A, 0x8B,
+    0x40, 0x2D, 0x16, 0x7A, 0x99, 0x15, 0xF2, 0x93, 0x2E, 0x45, 0xCD, 0x1D, 0xD0, 0x5F, 0x0F, 0xC0,
+    0x82, 0x13, 0xC0, 0xA0, 0x2D, 0xD4, 0x8D, 0x72, 0xA0, 0x6D, 0x16, 0xA0, 0x70, 0xDC, 0x80, 0x3C,
+    0x70, 0x05, 0x88, 0xEC, 0x02, 0x86, 0x5D, 0x40, 0x77, 0x4F, 0x00, 0x85, 0xD3, 0x0D, 0xE4, 0xA1,
+    0x18, 0x80, 0x98, 0x45, 0xC0, 0x60, 0x2C, 0x54, 0x9D, 0x8A, 0x50, 0x0E, 0x98, 0x8E, 0xDC, 0x53,
+    0x04, 0x88, 0x70, 0x42, 0x92, 0x28, 0x55, 0x87, 0x72, 0x94, 0x3F, 0x18, 0x32, 0x8F, 0xF2, 0xEB,
+    0x2C, 0x40, 0xAC, 0x25, 0xC0, 0x22, 0x17, 0x07, 0x75, 0x93, 0x35, 0x9B, 0xDC, 0x2C, 0x19, 0x99,
+    0x2C, 0x00, 0x45, 0x13, 0x81, 0x7C, 0x3D, 0x01, 0xF4, 0x13, 0xC0, 0xC5, 0x6F, 0x9D, 0x09, 0x2E,
+    0xEA, 0xE1, 0x3B, 0x14, 0xF2, 0x2C, 0xDC, 0x16, 0x8F, 0x2E, 0x22, 0x5C, 0xFA, 0x93, 0x7B, 0x4F,
+    0x5F, 0xEB, 0x6E, 0x50, 0xCB, 0x2D, 0xF4, 0x07, 0xBD, 0xCF, 0x47, 0xD6, 0xB4, 0x94, 0x56, 0x5B,
+    0x62, 0x36, 0xA2, 0xBB, 0x9A, 0x2C, 0x28, 0x8F, 0x61, 0x41, 0xE1, 0x0B, 0xC7, 0x9A, 0x15, 0xB5,
+    0x2B, 0x5D, 0xB1, 0xFA, 0x58, 0x9F, 0xFF, 0xEA, 0x87, 0x6F, 0xAD, 0xE3, 0x5E, 0x34, 0xA2, 0x24,
+    0x93, 0xCE, 0x74, 0x59, 0xC3, 0x06, 0x03, 0xC8, 0xD7, 0x40, 0x3F, 0x42, 0x55, 0x58, 0x72, 0x77,
+    0x05, 0x76, 0x95, 0x25, 0xF7, 0x37, 0xA0, 0x92, 0x39, 0x03, 0xFD, 0x3D, 0xDF, 0x02, 0xB9, 0x74,
+    0x6D, 0xA0, 0x92, 0xBB, 0x12, 0xE9, 0xBF, 0x29, 0xDD, 0x2A, 0x8F, 0x2C, 0x38, 0x52, 0x9E, 0x48,
+    0xD4, 0x36, 0x0B, 0x59, 0xAC, 0x3A, 0xE5, 0x4B, 0x5F, 0xA3, 0x7C, 0x6B, 0x0D, 0xE5, 0x2F, 0x27,
+    0x16, 0x68, 0x19, 0x58, 0x50, 0x07, 0x58, 0xD1, 0x5A, 0x38, 0x41, 0x06, 0x3E, 0xDD, 0xAB, 0x1F,
+    0xFB, 0x2C, 0xB4, 0xD7, 0x5F, 0x9E, 0x0E, 0x9C, 0x59, 0xE7, 0x22, 0x4D, 0x15, 0xE8, 0x47, 0xB2,
+    0xD3, 0x83, 0x96, 0xB9, 0x8F, 0xA1, 0xC6, 0x23, 0x90, 0x90, 0xFC, 0x5B, 0x6F, 0x29, 0x7E, 0xEE,
+    0x28, 0x9F, 0xF6, 0x73, 0x46, 0xB3, 0xE4, 0xD1, 0xF5, 0x21, 0xBD, 0x4C, 0xF9, 0x54, 0x4C, 0xA5,
+    0xCF, 0xD6, 0xDA, 0xB2, 0xAE, 0x1B, 0x4E, 0x0C, 0xAC, 0x16, 0xB0, 0x3A, 0x81, 0xE5, 0x0A, 0xE2,
+    0x44, 0x16, 0x26, 0x72, 0x3F, 0x51, 0xB8, 0x9E, 0xCA, 0x9A, 0xAE, 0xA7, 0x92, 0x48, 0x21, 0xC3,
+    0x7C, 0x60, 0x2F, 0x01, 0xED, 0x8B, 0x96, 0x36, 0x04, 0x8C, 0x89, 0x68, 0x15, 0xA1, 0xF9, 0xCC,
+    0xF9, 0xBD, 0xCD, 0xC4, 0xA1, 0x44, 0x50, 0xB7, 0x2B, 0xAF, 0x02, 0x53, 0x3E, 0x62, 0x9E, 0x8A,
+    0x94, 0x6E, 0x45, 0x3E, 0x1A, 0x58, 0x55, 0x16, 0xF3, 0x79, 0x87, 0x7E, 0x63, 0xA4, 0x70, 0x27,
+    0xA8, 0x50, 0x77, 0xF9, 0x58, 0xF8, 0x2C, 0x22, 0x79, 0xA4, 0x92, 0x48, 0x26, 0x01, 0xB2, 0x06,
+    0xB8, 0xD8, 0x40, 0x0F, 0xF9, 0x04, 0x85, 0x87, 0x2C, 0x7D, 0xC2, 0xFE, 0xFE, 0x69, 0x1E, 0xB7,
+    0xF9, 0xD4, 0x6B, 0xC9, 0xD2, 0xF4, 0x0D, 0xD9, 0x78, 0xF6, 0x76, 0x0A, 0x79, 0x71, 0x40, 0xCB,
+    0x3A, 0xA0, 0xDF, 0x6E, 0x3D, 0x7A, 0x50, 0x81, 0xD2, 0xA9, 0x89, 0xC2, 0x2B, 0xE9, 0xF2, 0xA0,
+    0x7E, 0xE9, 0x88, 0xC5, 0x0F, 0x03, 0x6D, 0x31, 0x4C, 0x54, 0x5F, 0xB3, 0x86, 0xF2, 0x97, 0xB6,
+    0xEA, 0x72, 0xE9, 0xF4, 0x40, 0xDF, 0x95, 0x9E, 0xCA, 0x16, 0x9E, 0x6A, 0x2C, 0x03, 0x75, 0x2F,
+    0x1E, 0x5D, 0xC8, 0x70, 0x6A, 0xEA, 0xF2, 0x66, 0x93, 0x41, 0x69, 0x3B, 0x43, 0x39, 0xAC, 0x36,
+    0x67, 0x25, 0x1F, 0xEE, 0x73, 0x3C, 0x07, 0x36, 0x8B, 0x88, 0x67, 0xCD, 0x97, 0x3C, 0x27, 0xA8,
+    0xC0, 0x82, 0x2C, 0x72, 0x04, 0x91, 0x43, 0x88, 0x2C, 0xE1, 0x88, 0x00, 0x8B, 0xCC, 0xC3, 0x9E,
+    0x72, 0xB0, 0x57, 0x58, 0x30, 0xBA, 0x03, 0x53, 0x01, 0x4F, 0xEC, 0x02, 0x4F, 0xDC, 0xD8, 0x04,
+    0x3A, 0x66, 0xFB, 0xB1, 0x0B, 0xE6, 0xD0, 0xBA, 0x70, 0xF0, 0xD5, 0xB6, 0x99, 0x8F, 0xA7, 0x38,
+    0xE0, 0xCF, 0x67, 0x34, 0x07, 0x28, 0xA5, 0x01, 0x2D, 0xCD, 0x26, 0x2C, 0x32, 0x5B, 0x1C, 0x6A,
+    0xC5, 0x9C, 0xB5, 0xA4, 0x3C, 0x70, 0xAC, 0x02, 0x59, 0xE8, 0x23, 0xF9, 0xFB, 0x77, 0xD6, 0xA8,
+    0x9F, 0xDB, 0x1E, 0x75, 0x8B, 0x96, 0x22, 0xD2, 0x52, 0x8E, 0xB4, 0x94, 0x9E, 0x05, 0x7A, 0x60,
+    0x85, 0xB6, 0x44, 0xAA, 0x2E, 0x8B, 0xD4, 0xC9, 0x16, 0x16, 0x2E, 0x19, 0xB2, 0x76, 0x68, 0x1B,
+    0x7A, 0x99, 0x60, 0x12, 0x07, 0x71, 0x67, 0xBE, 0xC7, 0x24, 0x1F, 0xBF, 0xB1, 0x2D, 0xE5, 0x9D,
+    0x66, 0xB6, 0xC3, 0x97, 0xF7, 0x9B, 0xE4, 0x21, 0xAE, 0x42, 0xAF, 0x02, 0x48, 0x11, 0x60, 0x2A,
+    0x3C, 0x5C, 0xCA, 0x9A, 0x8F, 0x96, 0x38, 0xE7, 0xCB, 0xC8, 0x08, 0x09, 0x26, 0x24, 0xDB, 0xDF,
+    0xBF, 0x6F, 0xCF, 0x93, 0xDA, 0x26, 0x4B, 0xAA, 0x3D, 0x30, 0xE7, 0x97, 0x4A, 0x1A, 0x20, 0xFF,
+    0xB5, 0x03, 0x08, 0x11, 0x60, 0x69, 0x00, 0x76, 0xB5, 0x05, 0xF6, 0xF2, 0x00, 0x54, 0x9C, 0x00,
+    0xBA, 0xAB, 0x2C, 0x94, 0x76, 0x4E, 0x99, 0x22, 0xE4, 0x77, 0x8E, 0xFB, 0x06, 0x44, 0xC4, 0xC1,
+    0xFA, 0xF8, 0xD5, 0x08, 0x47, 0xD0, 0x82, 0x01, 0x6D, 0xA9, 0x1B, 0x54, 0x48, 0xF1, 0x16, 0xE5,
+    0x00, 0xC6, 0xD6, 0xD2, 0x64, 0xBD, 0xD4, 0xE2, 0x10, 0xB1, 0xE9, 0x3E, 0x7B, 0xF1, 0x94, 0x29,
+    0x10, 0xFD, 0xC3, 0x98, 0x68, 0xE0, 0x5F, 0xF2, 0xA7, 0x80, 0xEE, 0x34, 0xA0, 0x6E, 0x1F, 0x34,
+    0x40, 0x2B, 0x0D, 0x50, 0xA4, 0x34, 0x63, 0xE7, 0xEC, 0x5D, 0xA4, 0x6C, 0x35, 0x02, 0x90, 0x6E,
+    0xB3, 0x1D, 0x00, 0x4C, 0x00, 0xA8, 0x17, 0x00, 0xFA, 0x59, 0x0B, 0x94, 0x37, 0x3D, 0xA0, 0x86,
+    0x08, 0x28, 0x57, 0x37, 0x90, 0xF9, 0xD2, 0x01, 0x63, 0x16, 0x81, 0x25, 0x26, 0xE5, 0xD0, 0x16,
+    0xEA, 0xE3, 0x57, 0xC3, 0x06, 0x8B, 0xD4, 0xEF, 0x1E, 0xF7, 0x96, 0x62, 0xA0, 0xF0, 0x28, 0x4F,
+    0x02, 0x4F, 0x52, 0xE4, 0x81, 0x76, 0xAC, 0x40, 0xC5, 0x5C, 0x02, 0x8F, 0xCA, 0xFB, 0xB2, 0x46,
+    0x27, 0x3C, 0x08, 0x9E, 0xE4, 0x33, 0x94, 0x83, 0x86, 0xF6, 0x96, 0x43, 0xC9, 0x08, 0xC5, 0xED,
+    0x3F, 0x84, 0x04, 0x3F, 0x9A, 0xF2, 0xC8, 0x1D, 0x6C, 0x40, 0x70, 0xE5, 0xB6, 0x70, 0x3C, 0x98,
+    0xFF, 0x39, 0xA5, 0x1E, 0x6C, 0xC3, 0xB2, 0xDF, 0xA9, 0x5C, 0x6C, 0xD6, 0xE0, 0x67, 0x28, 0xBE,
+    0xEC, 0xE6, 0x4F, 0xD5, 0x03, 0x20, 0x9E, 0x19, 0x46, 0x4F, 0xD7, 0x0B, 0x9B, 0x64, 0xB6, 0x1E,
+    0x93, 0x87, 0x42, 0xDD, 0x66, 0xF6, 0x31, 0x67, 0x8C, 0x89, 0xBC, 0x4D, 0x2E, 0xB2, 0xA6, 0xBA,
+    0xF3, 0xA5, 0x35, 0x6D, 0xC7, 0x51, 0x36, 0xC1, 0xA1, 0x0A, 0x70, 0x58, 0x3A, 0xF8, 0xAA, 0xB6,
+    0x9B, 0x18, 0xD2, 0x6C, 0xCD, 0x67, 0xBB, 0x7D, 0xE8, 0xB7, 0x0F, 0xA7, 0x3F, 0x33, 0x1D, 0x60,
+    0x06, 0x70, 0xD5, 0x48, 0x39, 0x94, 0x72, 0x2C, 0x5D, 0x2E, 0x32, 0xC1, 0x81, 0x0C, 0x9B, 0xB4,
+    0x96, 0x21, 0x61, 0x13, 0x29, 0xF3, 0xC1, 0x34, 0xE4, 0x1E, 0xF4, 0x3D, 0xEA, 0x14, 0xD0, 0xE2,
+    0x59, 0x1F, 0x74, 0xDA, 0xEE, 0xB0, 0x4C, 0x92, 0xAE, 0x93, 0x36, 0x14, 0x33, 0x88, 0x72, 0x92,
+    0x56, 0x5D, 0x7A, 0x3E, 0x5D, 0xD9, 0xC2, 0x9A, 0x9F, 0x4D, 0xF4, 0x62, 0xE9, 0xC3, 0xB9, 0x88,
+    0xDB, 0x34, 0x73, 0x36, 0xAF, 0xEE, 0x7A, 0xD0, 0x3F, 0x88, 0x60, 0x9A, 0x23, 0x78, 0x81, 0xCF,
+    0x7E, 0x14, 0xA4, 0x71, 0x01, 0xB2, 0x09, 0x74, 0x84, 0x75, 0xA0, 0xBC, 0xE9, 0x59, 0x15, 0xB6,
+    0x18, 0x34, 0x1F, 0x3B, 0xB3, 0x88, 0xDF, 0x89, 0x34, 0x3E, 0x09, 0xD0, 0x37, 0x9B, 0xB3, 0x24,
+    0xC0, 0x06, 0x3C, 0xFE, 0x28, 0x08, 0xE2, 0x71, 0x30, 0x16, 0xED, 0x51, 0xE1, 0x1C, 0x6E, 0x47,
+    0x21, 0x8D, 0x16, 0xAF, 0x7F, 0x36, 0x6A, 0xBB, 0x53, 0x5A, 0x94, 0x23, 0xF7, 0x10, 0x61, 0x01,
+    0x55, 0x47, 0xE9, 0xC8, 0x47, 0xE8, 0xC9, 0x2B, 0x5B, 0xDC, 0x5C, 0x1F, 0x0C, 0xBD, 0xD8, 0x52,
+    0x9A, 0xB4, 0xE8, 0x47, 0x78, 0x68, 0xF6, 0x26, 0x2A, 0x54, 0x16, 0xDA, 0xBA, 0xDB, 0xC0, 0xAB,
+    0xD2, 0x6D, 0x10, 0xE1, 0x33, 0xD5, 0x2C, 0xB9, 0x0D, 0xB5, 0x88, 0xA3, 0xFD, 0xC5, 0xC1, 0x48,
+    0xDB, 0x71, 0x44, 0xDB, 0x50, 0x61, 0x9A, 0x04, 0xF6, 0x64, 0x83, 0xB6, 0xCC, 0xD5, 0x1C, 0x75,
+    0x8A, 0x21, 0xB7, 0x00, 0xD5, 0x36, 0x27, 0xCB, 0xEF, 0xF9, 0xA1, 0x1A, 0x01, 0xA4, 0x41, 0x75,
+    0xD5, 0x48, 0x39, 0xE4, 0xF2, 0x6E, 0xEF, 0xA8, 0x45, 0x06, 0xB2, 0x5E, 0x9A, 0x8D, 0x04, 0x76,
+    0x78, 0x84, 0x27, 0x58, 0x52, 0xE5, 0x01, 0xFD, 0xB5, 0x81, 0xF2, 0x56, 0x83, 0x5A, 0x73, 0x4F,
+    0x88, 0x97, 0x5C, 0x87, 0x11, 0xCB, 0xFA, 0xA0, 0x53, 0x3E, 0xA3, 0xB4, 0xE7, 0xC1, 0xD8, 0xC5,
+    0xFC, 0xE7, 0x64, 0xFE, 0xD3, 0x93, 0xD3, 0x52, 0x61, 0x7E, 0x36, 0x51, 0x8B, 0x4F, 0x11, 0x51,
+    0x02, 0x98, 0x9A, 0xAC, 0x83, 0xD2, 0xEA, 0x01, 0x0A, 0x67, 0x1A, 0x50, 0x63, 0x64, 0x36, 0x28,
+    0xD0, 0x26, 0x00, 0xE9, 0x1E, 0xFD, 0xF8, 0x2D, 0xA0, 0x90, 0xF9, 0xB1, 0xEA, 0x60, 0xA2, 0xEE,
+    0xF8, 0x07, 0xA0, 0x90, 0xD5, 0x6F, 0x0E, 0x85, 0x6C, 0x1D, 0xC5, 0x6E, 0x82, 0x8C, 0x80, 0x0B,
+    0xCD, 0x12, 0x32, 0x71, 0x23, 0x28, 0x71, 0x01, 0x28, 0x07, 0x0F, 0xE8, 0xD7, 0x53, 0xE8, 0xDA,
+    0x6C, 0xB7, 0xBE, 0x4A, 0xE5, 0x8B, 0x06, 0x8A, 0xB5, 0x01, 0x6A, 0x11, 0xA0, 0xFF, 0x52, 0x12,
+    0xFB, 0x04, 0xCA, 0xB3, 0x24, 0x05, 0x7C, 0xE8, 0x8E, 0x11, 0x6A, 0xB2, 0x00, 0x06, 0xE5, 0x61,
+    0x8F, 0xC2, 0xC3, 0x02, 0xED, 0x60, 0x45, 0xED, 0xE0, 0x84, 0xFF, 0x71, 0xE8, 0xE8, 0xF3, 0x5F,
+    0xFD, 0x70, 0xA0, 0xBD, 0x75, 0xF3, 0x96, 0xC5, 0x88, 0x12, 0xA8, 0x46, 0x35, 0xC2, 0xB9, 0xE0,
+    0xE0, 0x23, 0x07, 0x2A, 0x71, 0xA1, 0xD9, 0xF8, 0x0B, 0x71, 0x1B, 0x54, 0x41, 0x5B, 0x78, 0xE8,
+    0xFA, 0x2F, 0xA0, 0x4E, 0x48, 0x5B, 0x97, 0xE4, 0x95, 0xDD, 0x30, 0x50, 0x49, 0x0F, 0xED, 0xAD,
+    0x35, 0x59, 0xCC, 0x27, 0x94, 0x27, 0x52, 0x0E, 0xA9, 0x48, 0x33, 0x26, 0x39, 0x19, 0x94, 0x4F,
+    0x52, 0x5A, 0xA4, 0x6D, 0xAD, 0x5D, 0x12, 0x51, 0x9F, 0xFF, 0xEA, 0x87, 0x43, 0x7B, 0xEB, 0xE6,
+    0x2D, 0x6B, 0x44, 0x49, 0x12, 0xCF, 0x59, 0xE9, 0x24, 0x54, 0x4B, 0x52, 0x8C, 0x7C, 0xF5, 0x3E,
+    0x2B, 0x25, 0x22, 0x6B, 0x8C, 0x88, 0x74, 0x59, 0x7F, 0x7C, 0x7D, 0xA0, 0x6E, 0x08, 0x68, 0xCB,
+    0x15, 0x94, 0xE7, 0x13, 0x33, 0xFE, 0x71, 0xB2, 0xB5, 0xFF, 0xDA, 0x02, 0xEA, 0xCE, 0x75, 0x47,
+    0x26, 0x12, 0xA0, 0x3F, 0xFE, 0xF6, 0xD9, 0x67, 0x0A, 0x4F, 0x3A, 0x66, 0x0D, 0x27, 0xE0, 0x31,
+    0x0D, 0x87, 0x73, 0x0D, 0xEA, 0x83, 0xAF, 0xF4, 0x4D, 0x2D, 0x22, 0xB6, 0x4E, 0xB1, 0xE7, 0x85,
+    0xFD, 0xAB, 0x88, 0x78, 0x95, 0x8A, 0x8B, 0xE7, 0x53, 0xC1, 0x01, 0x23, 0x56, 0xF9, 0xBA, 0xD9,
+    0xE3, 0x28, 0xF7, 0x79, 0xD0, 0x5D, 0x65, 0x97, 0x79, 0x54, 0xBE, 0xB5, 0xD5, 0xAD, 0x91, 0x76,
+    0x22, 0x9F, 0x92, 0x54, 0xEB, 0x86, 0xAE, 0xA5, 0x6A, 0xE4, 0xDF, 0x8F, 0xB9, 0x48, 0x97, 0x8B,
+    0xE3, 0x4C, 0x75, 0x37, 0x1B, 0xE8, 0x20, 0xE2, 0xC1, 0xFC, 0x3F, 0x01, 0x0A, 0x19, 0x93, 0x13,
+    0xD8, 0xE0, 0xD5, 0x9B, 0x4B, 0x8B, 0x88, 0x53, 0x22, 0x32, 0xF2, 0xE8, 0x9D, 0xE3, 0x89, 0x3C,
+    0xA0, 0x1B, 0x22, 0xCA, 0x62, 0xC0, 0xCD, 0x26, 0xE9, 0x1E, 0x63, 0x65, 0x8E, 0xD7, 0x50, 0x89,
+    0x34, 0x94, 0x77, 0x8E, 0xBB, 0xFB, 0xCD, 0x58, 0xC7, 0x0E, 0xA5, 0x43, 0xA3, 0x02, 0x85, 0x25,
+    0xA2, 0x1C, 0xED, 0x17, 0x5F, 0x0D, 0xB9, 0x88, 0xC4, 0x5C, 0x64, 0x53, 0xA9, 0xFE, 0x14, 0x7F,
+    0x8A, 0xE1, 0x90, 0xFA, 0x97, 0x01, 0x2D, 0x43, 0x02, 0x24, 0x1E, 0x60, 0xA6, 0x62, 0x39, 0x28,
+    0x57, 0x0C, 0xA5, 0x2D, 0x07, 0xDD, 0x55, 0xB6, 0xA6, 0xC7, 0x14, 0x91, 0xB6, 0x77, 0xB4, 0x53,
+    0xF2, 0x48, 0x2B, 0x60, 0x95, 0xCC, 0x54, 0x63, 0x7E, 0xB6, 0xA6, 0x96, 0x31, 0x59, 0xE9, 0x24,
+    0x93, 0x87, 0x9A, 0x4D, 0x2A, 0x51, 0x44, 0x20, 0x5B, 0x03, 0xFC, 0xAB, 0xFB, 0x5D, 0x97, 0x11,
+    0x91, 0x4E, 0x8B, 0x88, 0xE3, 0xE0, 0xDD, 0x57, 0x03, 0xE5, 0xC0, 0x2E, 0xCA, 0xA3, 0x21, 0xA2,
+    0xBA, 0xB4, 0xBE, 0xBA, 0xDB, 0x84, 0x4D, 0x09, 0xE6, 0x59, 0xBF, 0x3A, 0x42, 0x2B, 0x13, 0xD4,
+    0xEF, 0x1E, 0x9F, 0x7D, 0x26, 0xDB, 0x50, 0x16, 0x2E, 0x51, 0x77, 0x5C, 0x41, 0x0F, 0x54, 0x28,
+    0x8F, 0xEE, 0xB2, 0xE9, 0xAF, 0xAE, 0x0F, 0xA5, 0x88, 0xF8, 0x52, 0x44, 0xC6, 0xE4, 0xBC, 0xB4,
+    0x07, 0x49, 0xBF, 0x7F, 0xE9, 0x1E, 0x31, 0x28, 0x89, 0xC4, 0x72, 0xD8, 0xE3, 0xA8, 0xB4, 0xE5,
+    0x30, 0x66, 0xB1, 0xA6, 0x57, 0xBE, 0xB5, 0x6D, 0xEF, 0x0A, 0x19, 0xE8, 0x1B, 0xCA, 0x01, 0x56,
+    0xE4, 0x85, 0xCF, 0x82, 0xF9, 0xD9, 0x3A, 0x17, 0xE9, 0x4A, 0xE9, 0xB8, 0xF0, 0x47, 0x5D, 0x53,
+    0x8A, 0x6A, 0xFD, 0x26, 0x2F, 0x4C, 0xE6, 0x55, 0xBF, 0x03, 0x28, 0xD9, 0x86, 0x00, 0x49, 0x2F,
+    0x8D, 0x58, 0x6D, 0x57, 0xCA, 0x15, 0xC3, 0x92, 0x95, 0xEE, 0xAA, 0x37, 0x7C, 0xE9, 0x4D, 0x11,
+    0x8B, 0xBB, 0x6B, 0xDA, 0x89, 0x32, 0xC0, 0x0A, 0xCA, 0x81, 0x4F, 0xB7, 0x54, 0xCF, 0xAC, 0x0F,
+    0x5C, 0x2D, 0x23, 0xFD, 0x04, 0xCF, 0x37, 0xE4, 0x0E, 0xAE, 0xA4, 0x80, 0x70, 0x95, 0x74, 0xA6,
+    0x1A, 0x80, 0x87, 0xB8, 0xD8, 0x90, 0x85, 0x7C, 0x04, 0x6D, 0x4F, 0x80, 0xBE, 0x6E, 0x40, 0xC9,
+    0x00, 0xE8, 0x70, 0x6A, 0xED, 0xCF, 0x98, 0x0B, 0x19, 0x93, 0xB0, 0x92, 0x9C, 0xD2, 0x51, 0x30,
+    0xE0, 0x93, 0x45, 0x48, 0x82, 0x4A, 0x34, 0x8C, 0x53, 0x9C, 0x34, 0x49, 0xAA, 0x12, 0x69, 0xC8,
+    0xD7, 0xC7, 0xAF, 0xCC, 0x36, 0x21, 0x09, 0xB1, 0x4D, 0x38, 0x3B, 0x19, 0xC9, 0x28, 0xE8, 0x81,
+    0x8A, 0x74, 0x1C, 0xAA, 0x1F, 0x1D, 0x4F, 0xD4, 0x22, 0x62, 0x67, 0x61, 0xFD, 0x53, 0x5D, 0xF7,
+    0x6F, 0x7F, 0x26, 0xD8, 0x7A, 0xAF, 0x6A, 0x04, 0x2A, 0xE9, 0xA0, 0x7E, 0xD9, 0x43, 0xDD, 0xED,
+    0x81, 0x6E, 0xD4, 0xFD, 0x81, 0x4D, 0x2B, 0xE2, 0xE9, 0x7F, 0x71, 0x10, 0xE9, 0x1B, 0x0C, 0x3D,
+    0xE8, 0xAE, 0x05, 0x35, 0x98, 0x06, 0x5C, 0x65, 0xB9, 0x5F, 0x53, 0x4E, 0x66, 0xED, 0xAA, 0xE5,
+    0xC7, 0x0E, 0x2D, 0xBF, 0x1A, 0xE1, 0x4B, 0xA1, 0x07, 0x62, 0x6D, 0x61, 0x51, 0x8C, 0x50, 0x37,
+    0x02, 0xDA, 0x56, 0x01, 0xE5, 0x73, 0x79, 0xE7, 0x7A, 0xA4, 0x16, 0x99, 0xA0, 0x97, 0xB7, 0x81,
+    0x2F, 0xCC, 0x16, 0xAD, 0x01, 0x58, 0x6F, 0xEB, 0x55, 0xE5, 0xAD, 0x0E, 0xF2, 0x10, 0x81, 0xA3,
+    0x54, 0x50, 0xDE, 0x05, 0xAE, 0x9D, 0xB7, 0x6E, 0x54, 0x22, 0x16, 0x2D, 0x32, 0xA2, 0x82, 0xFE,
+    0x7F, 0x61, 0xC5, 0x12, 0x74, 0x57, 0x58, 0xB2, 0xC0, 0x72, 0x2E, 0x52, 0xE5, 0x21, 0x0F, 0x50,
+    0xD9, 0x15, 0x20, 0xD2, 0x40, 0x2E, 0xDD, 0x5C, 0xD2, 0x4D, 0x25, 0xD0, 0x79, 0xBB, 0x27, 0xE0,
+    0xA2, 0x4C, 0x50, 0xAC, 0xDB, 0x48, 0x3E, 0x51, 0x7B, 0x5A, 0x68, 0xBB, 0x72, 0x20, 0x1B, 0x39,
+    0x81, 0xBA, 0x29, 0x02, 0xA5, 0xC7, 0xAC, 0xAF, 0x47, 0xE8, 0x65, 0x0D, 0x7C, 0xE5, 0x6F, 0xCF,
+    0x00, 0xF7, 0xE4, 0x50, 0x0C, 0x45, 0x47, 0xB6, 0x7E, 0xDE, 0xCE, 0xB4, 0xA7, 0xF4, 0x69, 0x3B,
+    0x7C, 0xA4, 0xC4, 0x3D, 0x67, 0x81, 0x7F, 0x01, 0xA5, 0xAD, 0x80, 0xFE, 0xFA, 0x00, 0x4A, 0x02,
+    0x50, 0x8E, 0x0F, 0x80, 0x3F, 0x32, 0x91, 0x08, 0x22, 0xD2, 0x61, 0x9A, 0xE9, 0x1A, 0xE5, 0x50,
+    0x5A, 0x18, 0x39, 0x84, 0xAA, 0x29, 0xED, 0x5C, 0xDC, 0xAC, 0x9B, 0xBA, 0x21, 0x8B, 0xE5, 0x00,
+    0x5A, 0xC2, 0xA6, 0xCE, 0x91, 0x85, 0x2D, 0x8E, 0x96, 0x8A, 0x74, 0x32, 0x30, 0x07, 0xF6, 0xED,
+    0xCF, 0xC5, 0x52, 0x0F, 0xB9, 0x50, 0x78, 0x8A, 0x91, 0x15, 0x54, 0x5D, 0xE9, 0xC8, 0x03, 0x6D,
+    0x43, 0x8F, 0x92, 0x77, 0xC5, 0x52, 0x8A, 0x38, 0xB8, 0x78, 0x9C, 0xF4, 0xFA, 0xDF, 0x6D, 0xD8,
+    0x53, 0xD4, 0x6E, 0x0B, 0x20, 0xBD, 0xC2, 0x83, 0xF3, 0x94, 0x4C, 0x44, 0x6C, 0x2E, 0x7F, 0xDB,
+    0xFB, 0x7C, 0x82, 0x98, 0x47, 0xD8, 0xCB, 0x22, 0xE8, 0x66, 0x02, 0xD5, 0xB5, 0xE7, 0xFD, 0x7F,
+    0xE1, 0xD9, 0xE4, 0xC9, 0x27, 0xD0, 0xCB, 0x41, 0x87, 0x91, 0xEF, 0x3B, 0xB2, 0x83, 0x1F, 0x46,
+    0x50, 0xBE, 0x87, 0x6C, 0xAC, 0x1C, 0xAC, 0x54, 0x04, 0x43, 0x3B, 0xA0, 0x6D, 0x29, 0xDF, 0xEC,
+    0x3D, 0xBD, 0x48, 0x20, 0x17, 0xB9, 0xB6, 0xAD, 0xB4, 0x96, 0xDD, 0x36, 0xD0, 0x37, 0x76, 0xEB,
+    0x60, 0x77, 0x1E, 0x04, 0x2E, 0x7D, 0xC4, 0xD4, 0xF8, 0x23, 0xA0, 0x9C, 0xA6, 0xD9, 0xA6, 0x4A,
+    0xE3, 0x56, 0x7B, 0x16, 0x5B, 0xAB, 0xFE, 0xC8, 0xE6, 0x75, 0xAF, 0x6C, 0x02, 0xFA, 0x14, 0xAD,
+    0xE7, 0x7E, 0xC3, 0x74, 0x9A, 0x0B, 0x5E, 0x6B, 0xB6, 0x65, 0xB0, 0xBD, 0x8F, 0xAC, 0x46, 0x6F,
+    0xD5, 0x20, 0x55, 0xC2, 0xAA, 0x38, 0x2B, 0x45, 0xCA, 0x3F, 0x6E, 0x86, 0xF4, 0x9C, 0x49, 0x4A,
+    0xA5, 0xEE, 0xC3, 0x7C, 0xB5, 0x8C, 0xF4, 0x62, 0x95, 0x4C, 0x18, 0x71, 0x3C, 0x1A, 0xA0, 0x4F,
+    0xAC, 0x91, 0x94, 0x41, 0xA1, 0x07, 0x30, 0x69, 0xA7, 0xAA, 0x44, 0x81, 0x29, 0x1D, 0x2C, 0x92,
+    0x4A, 0xD6, 0x1D, 0xC4, 0xF9, 0x35, 0xA9, 0xA0, 0x5D, 0x89, 0x48, 0x84, 0xF2, 0x9D, 0xFD, 0xFD,
+    0x93, 0xF9, 0x35, 0xCD, 0xF6, 0x35, 0x33, 0x26, 0x53, 0x75, 0x64, 0xF3, 0xFB, 0xCC, 0xAF, 0x31,
+    0xF3, 0x6B, 0x12, 0x6E, 0x53, 0x04, 0x72, 0x99, 0xA8, 0xC5, 0xE5, 0x22, 0x54, 0x12, 0x20, 0xFB,
+    0xF2, 0x7C, 0x6E, 0xAB, 0x35, 0x14, 0xBF, 0xF6, 0xE4, 0xB1, 0xEA, 0x38, 0xE1, 0x90, 0x6C, 0x46,
+    0x84, 0x13, 0x1E, 0xDF, 0x87, 0x19, 0x8E, 0x57, 0x7E, 0xCE, 0x57, 0x0B, 0x37, 0x83, 0xF1, 0x1B,
+    0x06, 0x0C, 0xBA, 0x6B, 0x6D, 0x16, 0xCC, 0x9A, 0x5A, 0xDF, 0xF2, 0xEA, 0x57, 0xCE, 0xB0, 0x77,
+    0x43, 0xB9, 0xE2, 0x16, 0x47, 0xF4, 0xB6, 0xB4, 0x3A, 0x10, 0x11, 0x74, 0x97, 0x2A, 0x4C, 0xD4,
+    0xD4, 0x8D, 0xF2, 0xCA, 0xB3, 0xF7, 0x31, 0x43, 0xF1, 0xC3, 0xB7, 0x1C, 0x7D, 0x5C, 0x51, 0x8A,
+    0xB6, 0xC9, 0x90, 0x24, 0xAC, 0x3D, 0x17, 0x41, 0x4B, 0x40, 0xA4, 0xE3, 0x60, 0xD8, 0x46, 0xE2,
+    0x27, 0x5B, 0x14, 0xAA, 0x15, 0x11, 0x91, 0xA6, 0x16, 0x11, 0x91, 0x81, 0xBA, 0x23, 0x1B, 0x93,
+    0x54, 0x4E, 0x5F, 0x83, 0x24, 0x06, 0x43, 0x9B, 0x64, 0x59, 0x7F, 0x63, 0xFF, 0x8B, 0xF3, 0x6B,
+    0x56, 0xDB, 0xD7, 0x64, 0xB3, 0x9C, 0x16, 0xC9, 0xE2, 0xD4, 0x1D, 0xF9, 0xFC, 0x9A, 0x69, 0x7E,
+    0x4D, 0x3A, 0x51, 0xD5, 0x40, 0x29, 0x81, 0x5E, 0xBA, 0x52, 0x22, 0xAD, 0x0C, 0x1F, 0x22, 0xA0,
+    0xFC, 0xFA, 0x9D, 0x6B, 0x18, 0x99, 0xCE, 0x09, 0xE8, 0xCF, 0x9B, 0x2C, 0x54, 0x13, 0x75, 0x29,
+    0x5E, 0xBD, 0x1F, 0x5A, 0xF6, 0x96, 0xC5, 0x56, 0x40, 0x83, 0x1E, 0x37, 0x02, 0x1A, 0x7E, 0x53,
+    0x01, 0xE5, 0xE1, 0xE3, 0x94, 0xD3, 0x63, 0x54, 0xB2, 0xE6, 0x31, 0x1D, 0xF9, 0xD3, 0xC2, 0xDD,
+    0x13, 0x5A, 0x7B, 0x8C, 0x0C, 0x5C, 0x9C, 0x52, 0xC5, 0x58, 0xCD, 0x84, 0xA6, 0xC2, 0x27, 0x35,
+    0xD1, 0x43, 0xBA, 0x3D, 0x6D, 0x93, 0x16, 0xD6, 0x5D, 0x92, 0x97, 0x99, 0x03, 0xA9, 0x0D, 0x20,
+    0x31, 0xA5, 0x15, 0x64, 0x31, 0x91, 0x12, 0x7A, 0x49, 0xE1, 0x72, 0xFB, 0xA2, 0x6D, 0x43, 0x30,
+    0x26, 0x6A, 0x15, 0xCF, 0xD5, 0xD8, 0x2E, 0x0A, 0x4A, 0x06, 0x9E, 0xDB, 0x22, 0x3E, 0x75, 0x33,
+    0xB3, 0x68, 0xB2, 0x11, 0x56, 0x9B, 0xE2, 0x6E, 0xE9, 0x3A, 0x15, 0x3C, 0x32, 0x62, 0x46, 0x74,
+    0x38, 0x4D, 0x93, 0xB4, 0xAC, 0xA9, 0x64, 0xE2, 0xC2, 0xFE, 0x17, 0xFE, 0x50, 0xEB, 0xC9, 0xF6,
+    0xF7, 0x73, 0x11, 0xDB, 0x9F, 0x96, 0xEB, 0x92, 0xBF, 0xF2, 0x98, 0x89, 0x0B, 0x6D, 0x62, 0x9E,
+    0x39, 0xF2, 0xB0, 0x21, 0xD0, 0x54, 0x1D, 0xE5, 0x80, 0xF2, 0x64, 0x11, 0x4E, 0x3E, 0x86, 0x79,
+    0x16, 0x2D, 0x9D, 0x92, 0x0E, 0x69, 0x4E, 0x3D, 0x4A, 0x89, 0x42, 0x77, 0x9F, 0x40, 0xBF, 0xB3,
+    0xA2, 0x94, 0x40, 0x2E, 0xF6, 0x5C, 0xA6, 0xF1, 0xFB, 0xDC, 0x21, 0xC0, 0x73, 0xED, 0x88, 0xD7,
+    0xAA, 0xBB, 0x63, 0x2E, 0x23, 0xD5, 0xDB, 0xBF, 0x9B, 0x1D, 0x32, 0xE2, 0x11, 0x69, 0x38, 0x98,
+    0x0F, 0x50, 0xD8, 0x5A, 0x98, 0xCD, 0x91, 0x31, 0x33, 0xC8, 0xE9, 0xB7, 0xE6, 0x6E, 0x63, 0xE7,
+    0x16, 0xE7, 0x5E, 0x94, 0x45, 0xE8, 0xA5, 0x29, 0x65, 0x4A, 0x2C, 0xBF, 0x1B, 0xA0, 0x6C, 0xC2,
+    0xC4, 0xFA, 0x2F, 0x80, 0xB8, 0x94, 0x35, 0x66, 0x10, 0xA9, 0x07, 0x15, 0xA9, 0x4F, 0x0D, 0x6D,
+    0xD6, 0x5B, 0x33, 0x65, 0xCF, 0xA7, 0x9A, 0x5E, 0x3E, 0x63, 0x16, 0x8B, 0x84, 0x64, 0x54, 0x36,
+    0x1F, 0x3F, 0x6D, 0x9E, 0x55, 0xE2, 0xCC, 0xA8, 0xD6, 0x94, 0x5D, 0xE6, 0xB8, 0x42, 0x61, 0x59,
+    0xA0, 0xA4, 0x99, 0x53, 0x15, 0x10, 0x28, 0x23, 0xD4, 0xC3, 0xBD, 0x79, 0xE9, 0xEF, 0x67, 0x85,
+    0x70, 0x51, 0x94, 0x0C, 0xCF, 0x79, 0x22, 0x0B, 0xEA, 0x46, 0x5B, 0xE5, 0xB3, 0x91, 0x15, 0x86,
+    0xCA, 0x96, 0xEE, 0xE5, 0xE0, 0x65, 0x34, 0xA3, 0x0E, 0xC9, 0xF4, 0xF9, 0x5A, 0x02, 0x22, 0x8D,
+    0x88, 0xE5, 0x60, 0xA0, 0x72, 0x9B, 0x6D, 0x51, 0x61, 0x63, 0xAC, 0x4A, 0x97, 0x8A, 0x69, 0x89,
+    0x8E, 0x9F, 0x9C, 0xC1, 0x6C, 0xAA, 0x66, 0x9F, 0x72, 0x02, 0x85, 0xDF, 0xB8, 0x14, 0x6D, 0x61,
+    0xDA, 0x78, 0x8B, 0x6C, 0x9C, 0x37, 0x18, 0x16, 0xF7, 0xBC, 0x45, 0x91, 0xDE, 0xA2, 0x4E, 0xEE,
+    0x64, 0x82, 0x5E, 0x1A, 0xE5, 0x29, 0x65, 0xDA, 0x78, 0xC3, 0x15, 0x5B, 0xC2, 0x45, 0x66, 0x4D,
+    0x07, 0xE8, 0xBB, 0x29, 0xA8, 0x4A, 0xC4, 0x91, 0x36, 0x9C, 0xAF, 0x2C, 0xEE, 0xA0, 0x2D, 0x3D,
+    0xF5, 0x80, 0x60, 0x6C, 0xB6, 0x4E, 0x8C, 0x94, 0x07, 0x5C, 0x8F, 0x46, 0x0E, 0x9C, 0x99, 0x32,
+    0xF1, 0x97, 0x23, 0xCF, 0x39, 0x22, 0xC5, 0x90, 0x8D, 0x94, 0x43, 0x1E, 0xD0, 0x56, 0xF9, 0xF9,
+    0xA1, 0x2B, 0x1C, 0x55, 0x53, 0x0E, 0x29, 0x08, 0x33, 0x54, 0x16, 0x43, 0xFD, 0x12, 0x0B, 0xCC,
+    0xB3, 0xAC, 0x30, 0x6B, 0x22, 0x66, 0x24, 0x62, 0x86, 0x3C, 0xB0, 0x93, 0xEE, 0x54, 0x6D, 0xC0,
+    0xB1, 0x4B, 0xDA, 0xC2, 0x8D, 0x16, 0x90, 0x89, 0xC4, 0x4A, 0xE0, 0xCF, 0xCF, 0x7A, 0x70, 0x03,
+    0x09, 0xDB, 0x47, 0x89, 0x07, 0xA6, 0xBA, 0x83, 0x96, 0x25, 0x94, 0xDD, 0x79, 0x82, 0x13, 0x89,
+    0xC5, 0x25, 0x23, 0xF0, 0x68, 0xD8, 0xC6, 0x43, 0xF7, 0x26, 0xAC, 0x67, 0x88, 0x3D, 0x89, 0xC3,
+    0x7C, 0x6F, 0xC2, 0x7A, 0x5F, 0x86, 0x1B, 0xB7, 0xB1, 0x47, 0x8A, 0xB5, 0x1E, 0xFC, 0x0B, 0x71,
+    0x93, 0x4E, 0x7E, 0x56, 0x79, 0x28, 0xEE, 0x4E, 0x1B, 0xB2, 0x4E, 0x7E, 0x1E, 0xE7, 0xBA, 0xB0,
+    0x09, 0xBB, 0x74, 0x04, 0x4E, 0x46, 0x28, 0xDF, 0xF4, 0x29, 0x89, 0x2B, 0x86, 0xB2, 0xE1, 0x4F,
+    0xCE, 0x85, 0xC0, 0x17, 0x05, 0x30, 0x11, 0x78, 0xCE, 0x6F, 0x6E, 0x68, 0xB1, 0x89, 0xB0, 0x4A,
+    0xBB, 0x11, 0x50, 0xDC, 0x44, 0x01, 0x75, 0x33, 0xFF, 0x4F, 0xF9, 0x4D, 0x76, 0xBB, 0xDA, 0xFC,
+    0x4F, 0x9F, 0xFB, 0x5F, 0xD5, 0x91, 0x11, 0xE1, 0xB1, 0x2F, 0x0D, 0x20, 0x6B, 0xC8, 0xC5, 0x41,
+    0xF6, 0xAD, 0xF9, 0xD0, 0x39, 0x23, 0x56, 0x4B, 0xA8, 0x64, 0xE0, 0x60, 0x40, 0x1A, 0xCA, 0x81,
+    0x35, 0xA8, 0xC0, 0x1A, 0x88, 0x4C, 0x40, 0x9B, 0x4D, 0x40, 0xFD, 0x62, 0x04, 0xF4, 0x0F, 0x47,
+    0x40, 0xBD, 0x9F, 0x80, 0xFA, 0x00, 0xD0, 0x4E, 0x00, 0xF5, 0x75, 0x0B, 0xE8, 0x37, 0x47, 0x40,
+    0xF9, 0xB6, 0x81, 0x2C, 0x96, 0x1E, 0x58, 0x20, 0x40, 0xDD, 0x55, 0x0E, 0xF4, 0x90, 0xAF, 0x41,
+    0x79, 0x8C, 0x23, 0x8B, 0x28, 0xA1, 0x94, 0x88, 0x09, 0xA5, 0x08, 0xB9, 0x6C, 0xE5, 0x96, 0x9D,
+    0xEA, 0xFA, 0xBC, 0x43, 0x69, 0x33, 0xE6, 0x8D, 0x4A, 0x51, 0x7E, 0xA2, 0xFA, 0xA6, 0x7C, 0xF9,
+    0x32, 0x14, 0x62, 0x53, 0xD6, 0x5F, 0x75, 0x49, 0x3C, 0xE6, 0x0C, 0xCA, 0xBF, 0x04, 0x96, 0xD5,
+    0xC8, 0xD8, 0x4F, 0xDC, 0x75, 0xAB, 0x4C, 0x9A, 0xA3, 0x7C, 0x62, 0xA9, 0xC6, 0x6C, 0x54, 0xBE,
+    0xF0, 0xC5, 0xD0, 0x76, 0xA5, 0x4C, 0x68, 0x19, 0xD0, 0xDF, 0xB7, 0xE8, 0xBF, 0x76, 0x54, 0xCF,
+    0x8C, 0xD4, 0xD9, 0x1A, 0x43, 0x3F, 0x18, 0x6A, 0x39, 0x4A, 0xC5, 0xF9, 0xAB, 0x64, 0xB3, 0x5A,
+    0x55, 0x36, 0x7D, 0x56, 0xD5, 0x6C, 0x7B, 0x0A, 0x98, 0x21, 0xE2, 0x8B, 0x6B, 0xCC, 0x77, 0xA5,
+    0x6B, 0xFD, 0x73, 0xAE, 0x8D, 0x59, 0x58, 0xC0, 0xE1, 0x11, 0xD4, 0xBB, 0xA0, 0x57, 0xA0, 0x24,
+    0x41, 0xA0, 0x9C, 0x8C, 0x60, 0x6A, 0xD0, 0x37, 0x1D, 0x85, 0x9B, 0x78, 0x3A, 0x54, 0xD6, 0x2D,
+    0xD5, 0x3A, 0x18, 0xCC, 0xA8, 0xBB, 0x62, 0xDC, 0x00, 0xF6, 0x3B, 0x00, 0xDF, 0x01, 0xAA, 0x21,
+    0xFD, 0x3A, 0x7D, 0x80, 0x62, 0xBC, 0x2F, 0x8F, 0x12, 0xB1, 0x28, 0x59, 0x43, 0xD6, 0x37, 0x1B,
+    0xFA, 0xF0, 0x30, 0xCB, 0x21, 0x8B, 0x1B, 0x1D, 0x36, 0xE7, 0x95, 0xC7, 0xCE, 0xFE, 0x4C, 0x85,
+    0x8D, 0x84, 0xDB, 0x19, 0xE4, 0x75, 0xA5, 0xA3, 0xEC, 0x4C, 0xC3, 0x2E, 0x91, 0xDC, 0x17, 0x1F,
+    0x7C, 0xE5, 0xFA, 0x4B, 0x22, 0x32, 0xD5, 0x5B, 0xC6, 0xE7, 0xE7, 0xC8, 0x27, 0xEA, 0x29, 0x93,
+    0xA0, 0xB6, 0x85, 0xEE, 0xCB, 0x94, 0xD2, 0x68, 0x69, 0xA8, 0x49, 0x5D, 0x41, 0x2C, 0x60, 0x05,
+    0x11, 0x22, 0xD9, 0x48, 0x1E, 0x50, 0x1E, 0xE5, 0x51, 0x8E, 0x62, 0xA0, 0xB4, 0x68, 0x8B, 0xB6,
+    0x54, 0x1D, 0x75, 0x83, 0xB9, 0x80, 0x79, 0x8C, 0x76, 0xA2, 0x0D, 0x18, 0xCB, 0xCE, 0xEC, 0x1A,
+    0x10, 0xE9, 0xE0, 0x60, 0xD8, 0xA8, 0xF6, 0xB9, 0x7B, 0xCD, 0xC7, 0xB3, 0x0B, 0x4D, 0xA7, 0xC4,
+    0x6F, 0x4E, 0xFF, 0x74, 0x6E, 0xA1, 0x0B, 0x78, 0x32, 0x1F, 0xC9, 0x9D, 0x1E, 0xD0, 0x8D, 0x81,
+    0x65, 0x36, 0xFD, 0xD5, 0xAB, 0xAE, 0x17, 0x91, 0xBF, 0x14, 0xD9, 0xD4, 0xF1, 0xB9, 0xB4, 0x49,
+    0x97, 0xAA, 0xCD, 0xD9, 0xCB, 0xB6, 0x9F, 0x38, 0x6E, 0xE8, 0x3D, 0xD9, 0xD5, 0x5C, 0x06, 0x2D,
+    0x0D, 0xCB, 0x99, 0x26, 0xBB, 0x20, 0x0F, 0xC9, 0x3A, 0x66, 0x23, 0xE5, 0x90, 0xFA, 0x30, 0x94,
+    0xA3, 0xBA, 0xF7, 0x25, 0xAF, 0x37, 0xE6, 0xB1, 0x4C, 0x42, 0x21, 0x8D, 0xF6, 0xEC, 0xC0, 0x25,
+    0xF4, 0x40, 0xDD, 0xB1, 0x20, 0xF7, 0x54, 0x0D, 0x81, 0x8B, 0xF3, 0x8D, 0x3C, 0xBC, 0xCD, 0xF5,
+    0x8E, 0x30, 0xE2, 0x97, 0x18, 0x71, 0x23, 0x17, 0x27, 0x02, 0x79, 0xC0, 0xA3, 0x42, 0x36, 0xA0,
+    0x3C, 0x4D, 0x5A, 0x71, 0xE9, 0x36, 0x92, 0x48, 0x1C, 0x6C, 0xBB, 0x59, 0xC2, 0x83, 0xCA, 0x90,
+    0x0B, 0x78, 0x92, 0x13, 0xB8, 0xC1, 0x04, 0x81, 0x48, 0xEE, 0xB3, 0xE9, 0xAF, 0x5E, 0x75, 0xB5,
+    0xA4, 0xA6, 0x1E, 0xB1, 0x29, 0xE4, 0x2D, 0x2C, 0x54, 0xCD, 0x85, 0x66, 0x59, 0xCA, 0x33, 0xCE,
+    0x4C, 0x9A, 0xDC, 0xBF, 0x80, 0x7E, 0xDD, 0x62, 0x32, 0xB2, 0x31, 0x19, 0x78, 0x73, 0x5A, 0x63,
+    0x9D, 0xB3, 0x24, 0xE5, 0x93, 0x29, 0x3A, 0x4A, 0xE9, 0xA8, 0xB6, 0xC9, 0x39, 0x6F, 0x5E, 0x7F,
+    0x01, 0xE2, 0x0B, 0x14, 0x32, 0x50, 0x4D, 0x09, 0x19, 0xB8, 0xB4, 0x09, 0x03, 0x12, 0xE1, 0xE7,
+    0xE2, 0xB4, 0xE5, 0x5C, 0x86, 0xCD, 0x16, 0x6E, 0xD6, 0xF8, 0x30, 0x7A, 0x60, 0x42, 0x5B, 0x35,
+    0xA1, 0xAD, 0x8A, 0x54, 0x36, 0x0B, 0xFF, 0xDC, 0x35, 0x5E, 0x86, 0x3E, 0xA0, 0x25, 0x95, 0xD7,
+    0xE7, 0x04, 0x71, 0x91, 0x6E, 0x33, 0x39, 0xFD, 0x6C, 0x84, 0xBA, 0xB9, 0xA4, 0xBC, 0xB6, 0x46,
+    0x45, 0xE5, 0x8C, 0x3D, 0xCA, 0xFD, 0xDC, 0x45, 0xB1, 0x7D, 0x1A, 0xE5, 0xAF, 0x62, 0x1E, 0xA3,
+    0x90, 0x81, 0x36, 0xA0, 0xE2, 0x7C, 0x38, 0x7F, 0x43, 0xED, 0xFD, 0x81, 0x03, 0xD3, 0x77, 0x89,
+    0x48, 0x54, 0x8E, 0x70, 0x51, 0xBA, 0xE4, 0x2D, 0xF3, 0x37, 0xFF, 0x09, 0xDA, 0x9B, 0x5D, 0xA5,
+    0x9E, 0xD0, 0xD2, 0x50, 0xDA, 0x99, 0xA9, 0x71, 0x3E, 0xD4, 0xBC, 0xED, 0xE8, 0x03, 0xC6, 0x51,
+    0x0D, 0xD4, 0x8E, 0x3E, 0xB0, 0xBB, 0xDC, 0x90, 0x83, 0x36, 0xC1, 0xF6, 0xC3, 0x98, 0xC7, 0xA8,
+    0xA4, 0x29, 0xA4, 0x41, 0x4E, 0x6D, 0x4C, 0xF2, 0xD7, 0x2A, 0xC5, 0x23, 0x75, 0x32, 0xBF, 0x29,
+    0xF8, 0x28, 0x53, 0x45, 0xA3, 0x76, 0xDC, 0xCF, 0xE2, 0x65, 0x26, 0xA2, 0x28, 0x89, 0x98, 0x11,
+    0x25, 0x23, 0x45, 0x4C, 0x02, 0x5B, 0x27, 0x71, 0x0B, 0xEC, 0x81, 0x92, 0x8E, 0x3D, 0x28, 0x6E,
+    0x59, 0x8E, 0xA0, 0xFC, 0xFE, 0xC0, 0x12, 0xF4, 0xF7, 0x3C, 0x11, 0xF4, 0xCB, 0x81, 0x11, 0xAA,
+    0xA7, 0x47, 0x02, 0x54, 0xC4, 0x2C, 0x40, 0xCD, 0x49, 0xDA, 0x30, 0x93, 0x0A, 0x8C, 0xE6, 0x65,
+    0x07, 0x47, 0x54, 0x37, 0x07, 0x58, 0xA2, 0xDF, 0xB2, 0x10, 0x29, 0xEE, 0x5A, 0x88, 0x09, 0x88,
+    0x1F, 0xC9, 0xA4, 0x23, 0x0B, 0x20, 0x0D, 0xB5, 0x74, 0xF4, 0xA9, 0x1D, 0xCD, 0x9C, 0xAD, 0x8D,
+    0x7E, 0xE6, 0xDC, 0x59, 0x9F, 0x36, 0x08, 0xCA, 0xD1, 0x83, 0x68, 0x7B, 0x59, 0xDF, 0xD5, 0xAE,
+    0x5A, 0x17, 0x32, 0x5C, 0x1E, 0xDB, 0xBE, 0x2B, 0xDE, 0x1A, 0x56, 0x54, 0x47, 0x79, 0xE0, 0x64,
+    0xD0, 0x56, 0xAD, 0x31, 0x68, 0x9F, 0x8D, 0xB4, 0x4D, 0x39, 0xE4, 0x11, 0x83, 0x1E, 0x88, 0x18,
+    0x0A, 0x97, 0x8D, 0xD4, 0x4F, 0x97, 0x03, 0xF1, 0xB0, 0x46, 0xDD, 0x75, 0x11, 0xBD, 0x56, 0x8E,
+    0x7A, 0x48, 0x77, 0xF1, 0x9F, 0x8C, 0xB0, 0x66, 0xB8, 0x62, 0xA6, 0xD2, 0xEB, 0xB4, 0xFB, 0x73,
+    0x03, 0xC2, 0xFC, 0xC3, 0x39, 0x7B, 0x38, 0x4A, 0xAF, 0x3C, 0xC5, 0x79, 0x0E, 0x5C, 0x39, 0x16,
+    0xF2, 0xA2, 0x84, 0x0B, 0x8B, 0xEA, 0x96, 0xCB, 0x3E, 0x08, 0x75, 0x53, 0xFC, 0xA4, 0x59, 0x51,
+    0xBF, 0xA6, 0x3C, 0xD2, 0x69, 0xAB, 0x22, 0x0B, 0xAA, 0x21, 0x0F, 0xF4, 0x68, 0xAB, 0x02, 0x06,
+    0x6D, 0xB3, 0x91, 0x05, 0xE5, 0xF0, 0x52, 0xC0, 0x54, 0xA5, 0x65, 0x3D, 0x1A, 0x94, 0x74, 0x23,
+    0x65, 0x98, 0x5D, 0x61, 0x73, 0x1F, 0xE1, 0x32, 0x99, 0xFE, 0x66, 0xDE, 0xD4, 0x0D, 0x3F, 0xB6,
+    0xE3, 0x15, 0x40, 0x79, 0x15, 0x80, 0x7C, 0x4C, 0x37, 0x3B, 0xB5, 0xA9, 0x4C, 0x33, 0xE3, 0x4E,
+    0xC9, 0xC3, 0x95, 0xF6, 0x3F, 0x59, 0x65, 0xCE, 0x9A, 0x8B, 0x0D, 0x15, 0x47, 0xB0, 0x5B, 0x38,
+    0x88, 0x0B, 0xC8, 0xEE, 0x3A, 0x52, 0xA4, 0xA5, 0xFC, 0x1F, 0x46, 0x99, 0x1B, 0x48, 0xC4, 0x9D,
+    0x2D, 0xD3, 0x3A, 0x29, 0xC8, 0x4C, 0x1D, 0x1F, 0xD9, 0x42, 0x88, 0x33, 0x32, 0x59, 0x67, 0x7D,
+    0x53, 0xBB, 0x2A, 0x13, 0xD7, 0x4E, 0x19, 0x97, 0xC7, 0xB6, 0x6F, 0xE0, 0xE8, 0xA8, 0x1C, 0xA0,
+    0x3E, 0xCA, 0x03, 0xE8, 0x89, 0x08, 0x6A, 0x8D, 0x01, 0x84, 0xAA, 0x83, 0xB6, 0x29, 0x07, 0xA8,
+    0xAD, 0xF2, 0xA4, 0xFB, 0x42, 0x79, 0x8E, 0x20, 0x1B, 0xA9, 0x73, 0x58, 0xA1, 0xBF, 0x6B, 0x31,
+    0xA8, 0xBB, 0x0E, 0x6D, 0x11, 0x47, 0xE1, 0x30, 0xC3, 0x46, 0x85, 0xFF, 0xD9, 0xFB, 0xF9, 0xDD,
+    0xDF, 0x7C, 0x3F, 0xEB, 0xB4, 0x9F, 0xFA, 0x37, 0xDF, 0xCF, 0x36, 0xED, 0xE7, 0x0C, 0xD7, 0xEE,
+    0x72, 0x2A, 0xA8, 0x87, 0x12, 0xEE, 0xAA, 0x6F, 0xB9, 0x04, 0xDC, 0x74, 0x73, 0x33, 0xEA, 0xB9,
+    0xEB, 0xE2, 0x9A, 0xFE, 0xAF, 0xE5, 0x45, 0x09, 0xCF, 0xFD, 0x74, 0xBD, 0xCE, 0x3E, 0x08, 0x75,
+    0x73, 0x14, 0xCA, 0xA1, 0x7E, 0x4D, 0x79, 0x3D, 0x12, 0x55, 0x64, 0x91, 0x4D, 0xD4, 0x4D, 0x8F,
+    0xB6, 0xA6, 0x51, 0x5E, 0xDB, 0x6C, 0x2C, 0x1C, 0xAB, 0x3C, 0x60, 0x58, 0xA2, 0xAD, 0xA1, 0x70,
+    0xBA, 0xCB, 0xC3, 0x1C, 0x4F, 0x2D, 0xE6, 0xA6, 0x3F, 0xDD, 0xF1, 0x78, 0x65, 0xD1, 0x62, 0xD3,
+    0x6D, 0x9F, 0x4D, 0xE2, 0x44, 0xFC, 0xDC, 0x1B, 0x41, 0x76, 0x0F, 0x8A, 0xB4, 0xED, 0xE8, 0x08,
+    0x90, 0x8B, 0x44, 0x68, 0xDF, 0x79, 0x3E, 0x52, 0x8C, 0x14, 0x23, 0x6D, 0x43, 0xE9, 0xD5, 0x08,
+    0xDA, 0xD5, 0x16, 0x6A, 0x1B, 0x81, 0xBE, 0xF4, 0x90, 0x45, 0xD3, 0x40, 0xE1, 0x23, 0x50, 0x7D,
+    0xD7, 0x03, 0x7D, 0x6D, 0x41, 0x8D, 0x3D, 0xA0, 0x7F, 0x18, 0x81, 0xB6, 0xF4, 0xA0, 0xC6, 0xCA,
+    0x42, 0x65, 0x4D, 0x03, 0x13, 0x02, 0xDA, 0x65, 0x6B, 0x32, 0x21, 0x97, 0xA7, 0x5A, 0x47, 0xA2,
+    0x50, 0x65, 0x22, 0xCD, 0xD6, 0x04, 0x64, 0xFB, 0xFB, 0xE4, 0x22, 0x96, 0x7B, 0xD1, 0xA7, 0x74,
+    0xF6, 0xD7, 0x33, 0x4C, 0xF4, 0x37, 0x82, 0x69, 0xF4, 0x50, 0x77, 0x2A, 0x54, 0x96, 0x93, 0x72,
+    0xA0, 0x7E, 0xD9, 0x53, 0xFE, 0x20, 0xA6, 0x76, 0xF6, 0x58, 0x77, 0x2C, 0x4A, 0x87, 0x79, 0x7A,
+    0xA4, 0xEE, 0x5A, 0x2A, 0xAB, 0x7D, 0x6D, 0x33, 0x11, 0x4B, 0x25, 0xCD, 0x79, 0x4F, 0xF8, 0x55,
+    0x3E, 0x0D, 0xCA, 0x2B, 0x0B, 0xFA, 0x83, 0x13, 0xA0, 0x12, 0x07, 0x54, 0xD3, 0x19, 0x4B, 0x7A,
+    0x7A, 0xF5, 0xD2, 0x90, 0xFA, 0x6B, 0x8B, 0xF5, 0xBE, 0x58, 0xDA, 0x8E, 0xB6, 0x2B, 0x02, 0xF4,
+    0x98, 0x0E, 0xD6, 0x79, 0x84, 0x3C, 0x6A, 0x0B, 0xA5, 0xEF, 0xB7, 0xF0, 0x78, 0xAB, 0x2D, 0x64,
+    0xB1, 0x05, 0xCA, 0xF7, 0x23, 0x60, 0xBE, 0x96, 0x92, 0x69, 0x0B, 0x85, 0xEF, 0x01, 0xF3, 0x62,
+    0x84, 0x2C, 0xAA, 0x00, 0x7A, 0xD0, 0x1E, 0xD6, 0x54, 0x8E, 0xCA, 0x53, 0x87, 0x7F, 0xB1, 0x26,
+    0x51, 0xAD, 0x12, 0x4E, 0x7D, 0xD6, 0x5A, 0x7B, 0xAE, 0x71, 0xC4, 0x6B, 0x54, 0x77, 0x47, 0x72,
+    0x19, 0x39, 0x87, 0x6B, 0xFD, 0xCE, 0xD9, 0xFD, 0x9B, 0xEB, 0x4F, 0x79, 0x04, 0x58, 0xB0, 0x82,
+    0x5C, 0xD4, 0x04, 0x65, 0xAC, 0x46, 0x30, 0xAE, 0x1D, 0x60, 0xCD, 0x04, 0xBC, 0xC2, 0xB5, 0x07,
+    0x75, 0x70, 0x25, 0x15, 0xAB, 0x6E, 0x3F, 0x27, 0x24, 0xC9, 0xA5, 0x16, 0xAE, 0xA4, 0x63, 0xA5,
+    0x87, 0xD2, 0x27, 0xD1, 0x25, 0xC1, 0x24, 0x25, 0x33, 0x40, 0xE1, 0x5B, 0x36, 0x22, 0xD5, 0xAE,
+    0x07, 0xF4, 0xD0, 0x03, 0x95, 0xED, 0x01, 0xD3, 0xA5, 0x2E, 0xAE, 0xA4, 0x66, 0xC6, 0xA2, 0xC6,
+    0x59, 0x7A, 0xA9, 0x8D, 0x2B, 0xE9, 0x19, 0x73, 0xD3, 0xD3, 0xA6, 0xD1, 0xB0, 0x81, 0xA5, 0xEE,
+    0x92, 0xFC, 0xCD, 0x33, 0x01, 0x35, 0x9A, 0x8E, 0xFA, 0xA5, 0x00, 0x41, 0x37, 0x64, 0xE7, 0x49,
+    0x10, 0xED, 0x48, 0xA2, 0xCF, 0xAE, 0x3F, 0x1F, 0x53, 0x57, 0xC2, 0x09, 0x7A, 0x28, 0x3C, 0x75,
+    0x57, 0x37, 0x9C, 0x10, 0xC9, 0x43, 0xE1, 0xD1, 0x43, 0xD5, 0x61, 0x38, 0x21, 0x1B, 0xF3, 0x11,
+    0x3D, 0x94, 0x8E, 0x93, 0xD4, 0x90, 0x60, 0x6C, 0x0F, 0xAD, 0xF8, 0x39, 0x2F, 0x3F, 0xD7, 0x79,
+    0x55, 0x6D, 0xAB, 0x40, 0x85, 0x90, 0x8C, 0x1A, 0x9C, 0x39, 0x14, 0x67, 0x7C, 0x81, 0xBC, 0x0D,
+    0xBD, 0x88, 0xE7, 0xA1, 0x83, 0xAE, 0xEF, 0x50, 0x21, 0x8B, 0x24, 0xA3, 0xAF, 0x3C, 0x2B, 0x12,
+    0xBF, 0xBF, 0x74, 0xC4, 0x99, 0xA1, 0xA6, 0x6D, 0xE9, 0x21, 0x16, 0x13, 0x54, 0x09, 0x65, 0x58,
+    0x03, 0xE6, 0xDF, 0x0F, 0xA0, 0xBC, 0x01, 0x5A, 0x15, 0xA0, 0x70, 0x95, 0x85, 0x15, 0x02, 0xDA,
+    0xAA, 0x11, 0x22, 0x95, 0xA3, 0xB2, 0xF4, 0x5D, 0x2D, 0x2E, 0x97, 0xBF, 0x94, 0x75, 0x62, 0xAE,
+    0x24, 0x18, 0x20, 0x35, 0xE0, 0x6B, 0x47, 0x1E, 0xA1, 0x4D, 0xE9, 0xC4, 0x59, 0xB4, 0xFD, 0xD1,
+    0x51, 0xBF, 0x25, 0x37, 0xD7, 0x97, 0x47, 0x19, 0xF4, 0xF3, 0xFF, 0x3A, 0xFB, 0xB5, 0xA5, 0x7A,
+    0x8D, 0x3C, 0x35, 0xBA, 0xA9, 0x11, 0xDA, 0x94, 0x10, 0xDD, 0x13, 0xA5, 0x6F, 0xDA, 0x3E, 0x3F,
+    0x3A, 0x0B, 0x6D, 0xB6, 0xE9, 0x4A, 0x2A, 0x8E, 0x9A, 0x53, 0x07, 0xB9, 0x64, 0x36, 0xBC, 0xA7,
+    0x47, 0x23, 0xEB, 0xBB, 0xA9, 0x90, 0x9B, 0xEB, 0xEC, 0xF9, 0xAF, 0x4F, 0xE8, 0xE7, 0xFF, 0x35,
+    0xD5, 0x21, 0x54, 0xAF, 0xA5, 0xF0, 0xDB, 0xD8, 0xC4, 0x22, 0x6D, 0xE7, 0xA4, 0x3E, 0xCE, 0x20,
+    0xF5, 0x38, 0x63, 0xDD, 0xFE, 0xBC, 0xE7, 0xD7, 0x43, 0x12, 0x51, 0x39, 0x63, 0xDE, 0x9B, 0xFE,
+    0xEE, 0x2F, 0xCF, 0x8D, 0xED, 0x9F, 0xDD, 0xB4, 0x18, 0x4C, 0x85, 0x07, 0xF5, 0x41, 0xDC, 0x36,
+    0xD6, 0xF5, 0xDD, 0x96, 0xE1, 0xFD, 0xD1, 0x92, 0xE6, 0xC7, 0xF8, 0x0C, 0xBB, 0x44, 0x8C, 0xF2,
+    0x54, 0xCF, 0x5A, 0xB4, 0x24, 0x36, 0x94, 0x0A, 0xE7, 0x61, 0xCF, 0x51, 0x0F, 0x6D, 0x34, 0xEE,
+    0xF2, 0x28, 0x03, 0x1F, 0x7C, 0xD0, 0x65, 0xBF, 0xB6, 0x64, 0x77, 0x1B, 0xF2, 0x75, 0xA2, 0x84,
+    0xAB, 0xF1, 0x4C, 0x45, 0x60, 0x53, 0x0D, 0xB8, 0x07, 0x5A, 0x9A, 0x0D, 0x77, 0x6E, 0xA1, 0x08,
+    0x09, 0xE9, 0xAB, 0x27, 0xA8, 0xDC, 0x3D, 0x06, 0xBD, 0x5F, 0x37, 0xB9, 0xC8, 0x98, 0x4F, 0xD9,
+    0x94, 0x45, 0xAA, 0x66, 0x45, 0x61, 0x0D, 0x99, 0xD3, 0x03, 0x5F, 0x56, 0x71, 0x16, 0xA6, 0xDE,
+    0x74, 0x91, 0x94, 0xD2, 0x24, 0x38, 0x37, 0x97, 0x06, 0x2A, 0xFF, 0x08, 0x79, 0xD4, 0x60, 0x0A,
+    0x8B, 0x7E, 0x23, 0x24, 0xF3, 0xE9, 0xEB, 0xB7, 0x8B, 0xB1, 0x10, 0x19, 0x93, 0x17, 0x99, 0x8F,
+    0xEF, 0x7C, 0x9B, 0x3D, 0x1B, 0x3C, 0x59, 0x79, 0xF8, 0xC4, 0x3D, 0x8E, 0xC5, 0x53, 0x89, 0xCB,
+    0x6E, 0x3F, 0xDF, 0x69, 0xBB, 0x83, 0x49, 0x39, 0x4E, 0xBE, 0x4E, 0x91, 0x8E, 0x92, 0x14, 0x1D,
+    0x66, 0x13, 0xE4, 0xA3, 0x6A, 0x0A, 0x57, 0x53, 0xD1, 0xFF, 0xCD, 0x98, 0x89, 0x74, 0x99, 0x84,
+    0x33, 0x78, 0x53, 0x16, 0x53, 0xF6, 0x97, 0xC9, 0x48, 0x16, 0x4D, 0x93, 0x45, 0xE5, 0x79, 0x8D,
+    0xBF, 0xF8, 0x83, 0xAF, 0xFA, 0x42, 0xBA, 0x17, 0x1D, 0x41, 0x02, 0xFA, 0xA6, 0x63, 0x59, 0xDA,
+    0xD2, 0x6A, 0x1E, 0x39, 0x63, 0x59, 0x7F, 0x57, 0xAB, 0xFE, 0x83, 0xAC, 0x29, 0x6B, 0xE6, 0xAE,
+    0x84, 0xBE, 0x4B, 0x10, 0x7A, 0xEE, 0xD3, 0xE9, 0x2D, 0xC2, 0x29, 0xC6, 0x48, 0x2E, 0xB6, 0x90,
+    0xB1, 0x78, 0x67, 0xA1, 0x7C, 0x46, 0x04, 0xD3, 0x50, 0x8E, 0x20, 0x16, 0x1D, 0x53, 0xBF, 0x5F,
+    0x80, 0x93, 0x8F, 0x53, 0x7D, 0xCD, 0x16, 0x6F, 0xAC, 0x3F, 0xEF, 0x5A, 0x71, 0x85, 0x0C, 0x64,
+    0x40, 0x83, 0x9A, 0xE0, 0x7A, 0x87, 0x72, 0x64, 0x9E, 0x6C, 0x44, 0x85, 0xF4, 0xC6, 0x79, 0x93,
+    0x5D, 0x63, 0xC9, 0x2A, 0x39, 0x45, 0xF3, 0xF5, 0x21, 0x51, 0x9C, 0x8B, 0x78, 0x2F, 0xBF, 0xB9,
+    0x96, 0x6B, 0xD4, 0x22, 0x5D, 0x19, 0x8A, 0x90, 0x45, 0xAA, 0xA6, 0x6E, 0x32, 0xAF, 0x3C, 0x8F,
+    0x61, 0x9A, 0xAC, 0x4B, 0x3D, 0x15, 0x6E, 0xD3, 0x4F, 0x20, 0xDD, 0x2C, 0x8B, 0x6A, 0x02, 0xEA,
+    0x00, 0xB4, 0xF6, 0x11, 0xF2, 0xA8, 0x2C, 0xDA, 0x1E, 0x42, 0x2C, 0x07, 0xAA, 0xEE, 0x04, 0xE5,
+    0xCB, 0xDB, 0xD9, 0x9A, 0x56, 0xA4, 0x4B, 0xA0, 0xFA, 0x85, 0xE4, 0x42, 0x3F, 0xCB, 0x13, 0x44,
+    0x6A, 0xE5, 0xA9, 0xBE, 0x66, 0xD1, 0xB7, 0xD2, 0x02, 0xF2, 0xF1, 0xDE, 0xE8, 0x12, 0x5A, 0xE9,
+    0xB2, 0xDB, 0xCF, 0x77, 0xCA, 0x67, 0xC9, 0xD6, 0x85, 0xB9, 0xFF, 0x53, 0x6C, 0x22, 0x54, 0x95,
+    0x71, 0xCE, 0x46, 0x4E, 0xF8, 0x0B, 0x16, 0x2C, 0x39, 0xA4, 0xFF, 0x9B, 0x91, 0x56, 0x5C, 0x8A,
+    0xD8, 0x2E, 0xA5, 0xBA, 0xBF, 0xD4, 0x22, 0x22, 0xE6, 0xB8, 0x3F, 0x3E, 0xD9, 0xE3, 0x84, 0xDD,
+    0x2B, 0xAC, 0xB8, 0x72, 0x85, 0x89, 0x2B, 0x4F, 0x12, 0xF9, 0x6A, 0x02, 0x53, 0xF3, 0xF1, 0x1C,
+    0x38, 0x75, 0x0E, 0xA1, 0xBA, 0x1F, 0x85, 0xEB, 0xCE, 0xA1, 0x70, 0x6D, 0x03, 0xA5, 0xC4, 0x0D,
+    0x59, 0x78, 0x9B, 0xB3, 0xE5, 0x6B, 0xE6, 0x04, 0xED, 0xB4, 0x01, 0xEF, 0x14, 0xB9, 0xFD, 0x93,
+    0x0D, 0x10, 0x93, 0x79, 0x18, 0xE1, 0x08, 0x6A, 0xB2, 0xEB, 0xF2, 0xBE, 0xC8, 0xF8, 0xC5, 0xDB,
+    0x5F, 0x98, 0xAB, 0x55, 0x09, 0xC9, 0xC9, 0x02, 0x9C, 0x47, 0x76, 0x54, 0xB7, 0x2A, 0x5C, 0x7D,
+    0xCB, 0x97, 0xE2, 0x49, 0x9A, 0x90, 0x41, 0x11, 0xC9, 0x7A, 0x28, 0x2C, 0xCA, 0xA1, 0x3C, 0xA5,
+    0x23, 0xBB, 0x96, 0x9C, 0xEF, 0x2B, 0x69, 0x62, 0x83, 0x0A, 0x95, 0x25, 0x8B, 0x8B, 0xB9, 0x8B,
+    0x36, 0xED, 0x6B, 0xD9, 0x9D, 0xE7, 0xED, 0xFC, 0x71, 0x24, 0x76, 0xB8, 0x1D, 0x66, 0xA2, 0x1B,
+    0xFE, 0x33, 0x4F, 0xF5, 0x38, 0xEA, 0xEF, 0xEC, 0x3C, 0x4D, 0xE5, 0x93, 0x22, 0xA5, 0x88, 0xFB,
+    0xE2, 0xED, 0x2F, 0x9C, 0xF1, 0xFB, 0x85, 0xDB, 0x0C, 0x5B, 0x39, 0x17, 0x16, 0x3C, 0x99, 0x87,
+    0xAA, 0xAB, 0x6F, 0xF9, 0x5C, 0x22, 0x7A, 0x82, 0x9D, 0x7F, 0x70, 0x51, 0xF1, 0x43, 0x16, 0xF5,
+    0xDC, 0xED, 0x86, 0x5C, 0x64, 0x20, 0xBB, 0x7E, 0xA7, 0xBB, 0x6F, 0x51, 0xD5, 0x6F, 0xB0, 0xA8,
+    0x7F, 0x7C, 0x67, 0xBF, 0xF4, 0xC1, 0x17, 0x7A, 0x59, 0x5F, 0x5E, 0xEF, 0xFF, 0xC3, 0x3B, 0x0B,
+    0x55, 0xF7, 0x65, 0xA0, 0xF5, 0x7E, 0x93, 0x99, 0xE1, 0x65, 0x00, 0x5E, 0xA9, 0x9B, 0x07, 0xF5,
+    0xF5, 0x89, 0x55, 0xF3, 0x24, 0x8A, 0xB1, 0x08, 0xD0, 0x36, 0x49, 0x60, 0x85, 0x87, 0x3D, 0xCA,
+    0x94, 0xBC, 0x0E, 0x70, 0x84, 0xB6, 0xB0, 0x9C, 0x8B, 0x9D, 0x55, 0x07, 0x23, 0x75, 0x43, 0x16,
+    0x30, 0x0D, 0x99, 0xC7, 0x40, 0xEE, 0x4F, 0x69, 0xF5, 0xCA, 0x71, 0xB2, 0x19, 0x2A, 0x51, 0x5A,
+    0x4E, 0x40, 0x77, 0xF4, 0x60, 0xA0, 0xED, 0x98, 0xC0, 0xDC, 0x3E, 0x18, 0x41, 0x4B, 0x8A, 0xDA,
+    0xD7, 0x67, 0x86, 0x05, 0x3C, 0x0C, 0x14, 0xE3, 0xA7, 0xC0, 0x8C, 0x81, 0xFC, 0x3F, 0x8A, 0xA5,
+    0x7C, 0x66, 0x82, 0x9D, 0xEC, 0x5E, 0x3A, 0xF9, 0x81, 0xA7, 0x2E, 0xC4, 0x66, 0xF1, 0x42, 0x4B,
+    0xE1, 0x88, 0xD4, 0xCD, 0xFC, 0x97, 0xF2, 0x44, 0xAA, 0x4E, 0x79, 0x56, 0xDB, 0xBF, 0xAC, 0xF2,
+    0xAC, 0xD1, 0xB6, 0x0C, 0x2C, 0xF8, 0x3F, 0x87, 0x17, 0xC7, 0xF2, 0xFB, 0xBA, 0xF8, 0x20, 0x2E,
+    0x46, 0x2D, 0x56, 0x6C, 0x3D, 0xAA, 0x91, 0x9D, 0xB3, 0xDE, 0x3B, 0xE5, 0x87, 0x49, 0x80, 0x73,
+    0x0F, 0xEA, 0x47, 0x5D, 0x74, 0xD9, 0xFE, 0x3E, 0x54, 0x32, 0xCD, 0x79, 0xC0, 0x7D, 0xD7, 0x45,
+    0x21, 0xF7, 0x6D, 0xA4, 0xB2, 0xCF, 0x79, 0x16, 0x68, 0x9B, 0x87, 0xCD, 0x5F, 0x33, 0xC8, 0x66,
+    0x28, 0x87, 0xCD, 0x5F, 0x11, 0x83, 0x76, 0x44, 0xFA, 0xA6, 0x70, 0xE5, 0xEA, 0x63, 0x55, 0xB7,
+    0xF4, 0xBE, 0x7D, 0xFE, 0xBB, 0xB7, 0x3A, 0x89, 0x3A, 0xE6, 0xD2, 0x99, 0x8E, 0xE6, 0x8C, 0xAB,
+    0x7D, 0x92, 0xCF, 0x00, 0x4B, 0xBE, 0x03, 0xF4, 0x5F, 0x72, 0xCC, 0x23, 0x14, 0xE6, 0x44, 0xF7,
+    0x1E, 0xE2, 0xEA, 0x47, 0x50, 0xEF, 0x00, 0x34, 0x17, 0x61, 0xC1, 0x6B, 0x20, 0xD7, 0x2D, 0xB9,
+    0xC4, 0xB9, 0xA2, 0xF6, 0x87, 0xD1, 0xBB, 0x2F, 0xCC, 0xA3, 0xA8, 0x00, 0x7D, 0xBD, 0x03, 0x9E,
+    0x28, 0x2C, 0x70, 0x45, 0x59, 0x60, 0xB7, 0xB0, 0x40, 0x7D, 0xBD, 0xD9, 0x0E, 0xAB, 0xC9, 0xAE,
+    0x7E, 0xB4, 0x85, 0x49, 0x6B, 0x53, 0x79, 0x96, 0x5D, 0xDD, 0x90, 0xF9, 0x5D, 0x28, 0xBB, 0x90,
+    0xC6, 0x31, 0x60, 0xA6, 0xB9, 0xE3, 0xED, 0x0F, 0xA3, 0x9C, 0x7C, 0x86, 0xFF, 0x12, 0x12, 0x44,
+    0x57, 0xC4, 0x72, 0x84, 0x3A, 0x18, 0x0F, 0xF2, 0xA2, 0x34, 0xE4, 0xA3, 0x0A, 0x90, 0x75, 0x79,
+    0xF3, 0x11, 0x57, 0xD1, 0x1D, 0x1A, 0x38, 0x2C, 0x2D, 0xCA, 0xB7, 0x60, 0x5E, 0x1E, 0xC9, 0xA3,
+    0xE9, 0xA8, 0x5E, 0x1C, 0xE1, 0x86, 0xEE, 0xA0, 0xD9, 0x39, 0x9B, 0x94, 0x59, 0x96, 0x95, 0x50,
+    0xF8, 0xCB, 0xF7, 0x2A, 0xA5, 0xB6, 0xEA, 0x5E, 0x19, 0xB7, 0x29, 0xC3, 0x32, 0xD4, 0x43, 0x36,
+    0xE6, 0xB7, 0x9E, 0x2E, 0x5C, 0x7D, 0xE5, 0x4A, 0xF5, 0xD6, 0x7B, 0x77, 0x9D, 0x11, 0x25, 0xF4,
+    0x4E, 0x3B, 0x2E, 0xB1, 0xF3, 0xC7, 0x14, 0x4A, 0xB8, 0x47, 0x28, 0x85, 0x3F, 0xC5, 0xE9, 0x35,
+    0xDB, 0x7C, 0x99, 0xFA, 0x47, 0x6C, 0xA6, 0xCB, 0xA4, 0x5A, 0xF9, 0xEF, 0xE3, 0xD4, 0x46, 0x76,
+    0x12, 0x13, 0xE1, 0xCA, 0xA6, 0xD5, 0x59, 0x6F, 0x29, 0x29, 0xE2, 0x36, 0x2D, 0x38, 0x9C, 0xCD,
+    0x9A, 0x92, 0x52, 0x79, 0xCE, 0xB2, 0x5B, 0xE7, 0x41, 0x42, 0x90, 0xC7, 0xB9, 0x53, 0xFA, 0x71,
+    0x3E, 0xFE, 0x00, 0xD3, 0x9D, 0x8B, 0x70, 0xB1, 0xC9, 0x65, 0x6D, 0xC4, 0x31, 0x62, 0x64, 0x68,
+    0x07, 0x6A, 0x4B, 0x3D, 0xE4, 0x23, 0x2A, 0x92, 0x07, 0xEA, 0x8E, 0xD6, 0x62, 0xC8, 0x23, 0x3A,
+    0xCE, 0xE3, 0x38, 0xC5, 0x12, 0xC9, 0x22, 0x26, 0xA6, 0xF9, 0x5A, 0xC5, 0x8F, 0x87, 0xC4, 0xA2,
+    0x8B, 0x2B, 0x8E, 0x40, 0xDB, 0xEA, 0xF3, 0x83, 0xB6, 0x10, 0x95, 0x5F, 0x10, 0x40, 0xDB, 0xA3,
+    0xC2, 0xD5, 0x40, 0xD4, 0x76, 0x4F, 0x0D, 0xA0, 0x5F, 0x0F, 0xCA, 0x2F, 0x81, 0x68, 0x30, 0xBA,
+    0x81, 0xF2, 0xBB, 0x83, 0x7A, 0xCF, 0x03, 0xCB, 0x88, 0xD9, 0x03, 0xCA, 0x5B, 0xE4, 0x77, 0x2D,
+    0xD0, 0xBA, 0x44, 0x0E, 0x2E, 0x22, 0x99, 0xCC, 0xA8, 0x7F, 0xE5, 0x52, 0xB4, 0x97, 0xDD, 0xCB,
+    0x40, 0xBA, 0x70, 0xA6, 0x64, 0xA4, 0xD3, 0x50, 0xC5, 0x5B, 0x1D, 0x33, 0x57, 0x86, 0x62, 0x38,
+    0x02, 0x8A, 0x41, 0x37, 0xF7, 0xF7, 0x3C, 0x64, 0x59, 0x4F, 0x65, 0x8B, 0xF7, 0x64, 0x50, 0x81,
+    0xF5, 0x9F, 0x8D, 0xAC, 0x31, 0x9D, 0xA1, 0xB6, 0xA5, 0xD3, 0xB6, 0xF0, 0x79, 0xC8, 0x43, 0x1E,
+    0x59, 0xB2, 0x40, 0x1A, 0x83, 0xB6, 0x66, 0xD0, 0x8D, 0xF2, 0xF5, 0x58, 0x5A, 0x96, 0x7A, 0xA1,
+    0x06, 0xEA, 0xF2, 0x7B, 0x6F, 0x78, 0x8A, 0x9B, 0x6F, 0xF8, 0x40, 0xF6, 0xBE, 0x3B, 0x1C, 0x61,
+    0xE1, 0xAB, 0x25, 0x54, 0xBE, 0x88, 0x50, 0xF8, 0x2C, 0x02, 0x9E, 0x2B, 0xF7, 0xCD, 0x88, 0xEA,
+    0x36, 0x70, 0x7B, 0x7E, 0x37, 0x00, 0x27, 0x95, 0x9D, 0x3B, 0xA5, 0x0B, 0x7B, 0x2E, 0x38, 0xF9,
+    0x63, 0xCF, 0x2F, 0x9A, 0xF1, 0xE7, 0x6D, 0x46, 0x51, 0xDE, 0xEA, 0xA0, 0x7A, 0xD6, 0xC2, 0x42,
+    0x0D, 0x30, 0xE6, 0x0E, 0xAE, 0x9E, 0x93, 0xEA, 0x47, 0x60, 0x6C, 0x46, 0xD5, 0xAD, 0x40, 0xC5,
+    0xCA, 0x41, 0xFB, 0xE2, 0x04, 0xCA, 0xE9, 0x8E, 0xFB, 0xD1, 0x71, 0x6B, 0xE4, 0x27, 0x32, 0x2A,
+    0x19, 0xAB, 0x40, 0x31, 0xD2, 0xC3, 0x62, 0x1E, 0x6C, 0x51, 0x77, 0x49, 0xD1, 0x56, 0x24, 0x94,
+    0x94, 0x93, 0x04, 0x7A, 0x2D, 0x01, 0xF3, 0xFC, 0xA6, 0x6F, 0x73, 0xD6, 0xB6, 0xFE, 0x94, 0xD8,
+    0xB5, 0x3A, 0xD5, 0xC4, 0xFB, 0x98, 0x60, 0x1D, 0x24, 0x7E, 0x67, 0x25, 0x67, 0xCB, 0x2C, 0xF9,
+    0x40, 0x42, 0x7B, 0xE8, 0x87, 0x79, 0x50, 0x85, 0x7E, 0xFB, 0x3E, 0x52, 0x8E, 0x11, 0x99, 0x68,
+    0x45, 0x84, 0x93, 0xE3, 0xE3, 0x35, 0x23, 0x6A, 0x24, 0x50, 0x7A, 0x3C, 0xB5, 0xE5, 0x5A, 0x62,
+    0xDB, 0x4C, 0x5B, 0x5A, 0x80, 0xDB, 0x88, 0xAD, 0xDF, 0x6C, 0x6F, 0x71, 0xCA, 0xE3, 0xE9, 0x12,
+    0x85, 0xF2, 0x3B, 0x79, 0x04, 0x5F, 0x78, 0x72, 0x5F, 0x0D, 0x28, 0x6F, 0xDE, 0x3D, 0xBE, 0x3E,
+    0xB4, 0x22, 0x62, 0x53, 0x63, 0x17, 0x5B, 0x3C, 0x48, 0xF9, 0xA4, 0x3E, 0x95, 0xDD, 0x72, 0x34,
+    0x38, 0x1F, 0x13, 0xE6, 0xEB, 0xE6, 0xB0, 0x94, 0x10, 0xB5, 0xC8, 0xA8, 0x69, 0xDD, 0x27, 0xD8,
+    0x40, 0x24, 0x1B, 0x12, 0xC7, 0xFC, 0xAB, 0xAB, 0x04, 0x42, 0x94, 0x03, 0x57, 0xEB, 0x01, 0xDF,
+    0xCA, 0x5D, 0x3F, 0x89, 0xF8, 0x1B, 0x8F, 0x8A, 0x9D, 0x35, 0xED, 0x5B, 0x9B, 0x71, 0x0A, 0x45,
+    0xDC, 0xD8, 0xDC, 0xFC, 0xDA, 0x83, 0x9A, 0x0F, 0xFF, 0x38, 0xF2, 0x78, 0x3C, 0xBD, 0x38, 0x93,
+    0xF9, 0x7D, 0xAE, 0xFE, 0x9E, 0xE4, 0x70, 0x8D, 0x7F, 0x3B, 0x77, 0xE4, 0xC5, 0xD2, 0x41, 0x6F,
+    0x9A, 0x39, 0xCE, 0xD1, 0x81, 0xF3, 0x43, 0xA1, 0xFF, 0x78, 0xC2, 0x38, 0x8B, 0xA9, 0xE8, 0xAF,
+    0xD9, 0xD4, 0x87, 0x77, 0x3F, 0xA6, 0xF2, 0x3B, 0x54, 0x8E, 0x39, 0xB8, 0x6D, 0x03, 0xA4, 0x88,
+    0x9A, 0x72, 0x58, 0x02, 0xBA, 0xBB, 0xB4, 0x75, 0xD9, 0x09, 0x54, 0x5D, 0x9C, 0x21, 0xBC, 0xC6,
+    0x33, 0x8F, 0xE3, 0x69, 0xC5, 0x38, 0x51, 0x3A, 0xE7, 0x69, 0x94, 0x9E, 0x0D, 0x2D, 0x72, 0x36,
+    0x8F, 0x73, 0x2C, 0x70, 0xE6, 0xF1, 0xB4, 0x7B, 0x7D, 0x3B, 0xF4, 0xF1, 0x4C, 0xC9, 0xF9, 0xE8,
+    0xDE, 0x8F, 0x4A, 0xB3, 0x59, 0x95, 0x07, 0xDA, 0x5B, 0x69, 0x14, 0x5C, 0x03, 0x3C, 0xF4, 0xAD,
+    0x24, 0x3A, 0x5F, 0x78, 0xED, 0xAA, 0x41, 0x5B, 0xDD, 0x7C, 0x6C, 0x3B, 0xA1, 0x37, 0xE8, 0xD9,
+    0xA1, 0xAD, 0xD1, 0x91, 0x93, 0xB1, 0x7C, 0xD3, 0x1F, 0x15, 0x6F, 0x0D, 0xFA, 0xBF, 0x61, 0x87,
+    0x86, 0x32, 0x7C, 0xAE, 0x8E, 0x87, 0x7B, 0xED, 0x78, 0xA5, 0xF2, 0x5C, 0x6C, 0x2E, 0xEF, 0x3F,
+    0x2B, 0xA9, 0x4D, 0x1A, 0x32, 0xC7, 0xF7, 0x6C, 0x55, 0xFF, 0x32, 0x18, 0x69, 0x6A, 0x47, 0xF9,
+    0x52, 0x34, 0x37, 0xC3, 0x0E, 0x17, 0x78, 0xB8, 0xEE, 0xA2, 0x79, 0x29, 0x9A, 0x7C, 0xDC, 0xE1,
+    0x6A, 0xF6, 0x05, 0x25, 0x2F, 0xFF, 0xFA, 0x3D, 0x7F, 0xF8, 0x17, 0x35, 0x75, 0x63, 0x1A, 0x83,
+    0x4E, 0xC9, 0x54, 0x39, 0x9A, 0x69, 0x59, 0x87, 0x2A, 0x54, 0xE3, 0x6E, 0x1B, 0x6B, 0x07, 0x5C,
+    0xBA, 0xC0, 0x9E, 0x1A, 0xEA, 0x97, 0xC6, 0xEA, 0xF5, 0xA8, 0x87, 0x49, 0x0F, 0x93, 0xB2, 0x87,
+    0x34, 0x3B, 0x3C, 0xCC, 0x7F, 0xEB, 0xCB, 0xB7, 0x86, 0x95, 0xFE, 0xEE, 0x50, 0x9D, 0x60, 0x5C,
+    0x2A, 0x3A, 0xEC, 0x64, 0xB9, 0xBB, 0x61, 0xF4, 0x4D, 0x1F, 0xAB, 0xCF, 0x0F, 0xE3, 0x9E, 0xB2,
+    0xFE, 0xD2, 0x0E, 0x97, 0x29, 0xA5, 0x13, 0x79, 0x76, 0x38, 0xF9, 0x2A, 0x63, 0x93, 0xFC, 0xDA,
+    0x2B, 0x47, 0xFA, 0x25, 0xBF, 0x5B, 0x0E, 0xEB, 0xD2, 0xEF, 0x91, 0x5D, 0xAB, 0xAD, 0xE9, 0x26,
+    0xE5, 0x75, 0xB7, 0x2C, 0x86, 0x5D, 0xE0, 0xE2, 0xD3, 0x93, 0xF9, 0x6B, 0x77, 0x54, 0xD8, 0xDD,
+    0xDC, 0x69, 0x40, 0xB9, 0xB8, 0x5B, 0x95, 0x2F, 0x5B, 0x77, 0x89, 0x8B, 0xF6, 0xA4, 0x74, 0xD1,
+    0x7C, 0xDE, 0xBE, 0x02, 0x30, 0x4F, 0xEA, 0x2D, 0x9B, 0x17, 0xCC, 0x8B, 0x53, 0xFB, 0x74, 0xDC,
+    0x4B, 0x05, 0xED, 0x46, 0x8F, 0x7B, 0x87, 0x2F, 0x3C, 0xFE, 0xC2, 0xE3, 0x87, 0x87, 0x75, 0xB8,
+    0xD8, 0xD0, 0x68, 0x6B, 0x9A, 0xA8, 0x5C, 0x9D, 0xFB, 0x0B, 0xD0, 0x14, 0xE3, 0xC5, 0xC8, 0x92,
+    0x51, 0xF9, 0xBA, 0x7B, 0x04, 0xAE, 0x7E, 0x02, 0x5F, 0x36, 0xBB, 0xDC, 0x56, 0xF2, 0xD2, 0x88,
+    0xF2, 0xE3, 0x6E, 0x55, 0xDE, 0xF4, 0xDF, 0xE2, 0xCF, 0xC8, 0x84, 0x6A, 0x9D, 0x4D, 0x53, 0x65,
+    0xEF, 0x8C, 0xD9, 0x7B, 0x49, 0xEF, 0xFE, 0x7B, 0xFE, 0x8B, 0x41, 0x7D, 0xFD, 0x9D, 0x55, 0x2D,
+    0x43, 0x3D, 0x71, 0x01, 0xB2, 0xFB, 0xF6, 0x64, 0x7F, 0xFF, 0xF9, 0xB4, 0x27, 0x0F, 0x5A, 0x3A,
+    0x8F, 0x80, 0x81, 0x9E, 0x2C, 0xA2, 0x3C, 0xA5, 0x4D, 0x71, 0xDE, 0x45, 0x3E, 0x6B, 0xEC, 0xD4,
+    0xBE, 0x34, 0x99, 0x2C, 0xEE, 0x70, 0xF5, 0xCF, 0xD5, 0x70, 0x54, 0xBA, 0xF6, 0x87, 0xDB, 0x52,
+    0x83, 0x3B, 0xED, 0x16, 0xF7, 0x6C, 0x06, 0x95, 0x26, 0x77, 0xFE, 0xF0, 0x47, 0xA1, 0x3F, 0xBD,
+    0x12, 0x11, 0x29, 0x45, 0x44, 0x6E, 0xDE, 0xB9, 0x7E, 0xE7, 0x55, 0x17, 0x54, 0x20, 0x5C, 0x21,
+    0x72, 0x45, 0xD3, 0xF2, 0x89, 0xAC, 0xA9, 0xBA, 0x6C, 0x33, 0x64, 0x3E, 0xBD, 0xFD, 0x85, 0x06,
+    0xDA, 0x56, 0xA0, 0x16, 0xF1, 0x94, 0xB7, 0x0B, 0x41, 0x05, 0x6A, 0x4B, 0x44, 0xCD, 0xF3, 0xA5,
+    0xEB, 0x0E, 0xD3, 0xE9, 0x01, 0xED, 0x94, 0x47, 0x85, 0x54, 0xEC, 0xE9, 0xC1, 0x14, 0x12, 0xA9,
+    0x6E, 0x8A, 0x9C, 0x99, 0x5A, 0x9F, 0x87, 0xB9, 0x3B, 0xF0, 0xF1, 0x22, 0xCE, 0x95, 0xCF, 0xD4,
+    0x7E, 0xF9, 0xC9, 0xB3, 0x8E, 0xA3, 0x6C, 0x36, 0x8E, 0xD6, 0x84, 0x8D, 0x0D, 0x31, 0xD7, 0xEE,
+    0xF3, 0xB4, 0x0F, 0x90, 0x62, 0x0D, 0x91, 0xD2, 0x62, 0xC8, 0x3D, 0x95, 0xE5, 0xB5, 0x44, 0x1F,
+    0x54, 0xF7, 0x8C, 0xB5, 0xAE, 0x3E, 0x7C, 0x58, 0x49, 0xF7, 0x21, 0xCF, 0xE4, 0x22, 0x90, 0x9F,
+    0x9D, 0x6E, 0x50, 0x8B, 0xFB, 0xA7, 0x0D, 0x84, 0xB9, 0x2E, 0x96, 0x56, 0xC4, 0xD2, 0x1E, 0x1F,
+    0x3F, 0x70, 0x20, 0x4C, 0x63, 0x3A, 0xF2, 0xC1, 0x0C, 0x28, 0x5F, 0x05, 0x2A, 0x57, 0xCA, 0x37,
+    0xC5, 0xE6, 0x22, 0x92, 0xBA, 0x3A, 0xCF, 0x74, 0x0A, 0xFE, 0x61, 0x8A, 0x2D, 0xBF, 0xAF, 0x26,
+    0x0D, 0x40, 0x79, 0x6D, 0xF3, 0x49, 0x7B, 0x44, 0x45, 0xAA, 0xE6, 0x06, 0xF7, 0x75, 0x87, 0x68,
+    0x09, 0x89, 0x43, 0x59, 0x0E, 0xF3, 0x66, 0xC4, 0x59, 0x4C, 0x75, 0x97, 0xDE, 0x57, 0xF9, 0x0F,
+    0xF9, 0x61, 0xB6, 0xA5, 0xB0, 0xDC, 0xF3, 0xC3, 0x52, 0x02, 0xF3, 0x3D, 0x68, 0x89, 0x73, 0x5B,
+    0x41, 0x82, 0x7A, 0x16, 0xDB, 0x98, 0x7B, 0xDA, 0xEC, 0xFB, 0x29, 0xDC, 0xFB, 0x21, 0xBC, 0xD4,
+    0xDF, 0x9C, 0x7B, 0x7B, 0xB2, 0x7D, 0xCF, 0x71, 0x6E, 0x25, 0x68, 0xFB, 0x61, 0xEE, 0x24, 0xA8,
+    0xC7, 0xF3, 0x93, 0x1A, 0x86, 0x34, 0xC6, 0x43, 0x00, 0x0E, 0xBE, 0x91, 0x70, 0xA8, 0x65, 0x52,
+    0xC4, 0xDC, 0x27, 0xBF, 0xA7, 0xBB, 0xE4, 0xDB, 0x0E, 0x37, 0x3F, 0x4E, 0x4E, 0x51, 0x77, 0xC9,
+    0xFD, 0xED, 0xB2, 0xB8, 0x0A, 0xE4, 0x3E, 0xE9, 0xAB, 0xEE, 0x52, 0x02, 0x7D, 0x94, 0x7A, 0x77,
+    0x73, 0x9F, 0x45, 0x4C, 0x87, 0x6E, 0x4A, 0x47, 0x0B, 0xCB, 0xD4, 0x2B, 0xA2, 0x1C, 0x91, 0xC2,
+    0xA7, 0x2E, 0x9F, 0xBA, 0xCB, 0x03, 0x95, 0x65, 0xFA, 0x78, 0x6D, 0x39, 0xA1, 0x74, 0x6D, 0x44,
+    0xDD, 0xFE, 0xA2, 0xE4, 0x62, 0x33, 0x11, 0x71, 0x45, 0x44, 0x8B, 0xBC, 0x7D, 0x8A, 0x9C, 0x1A,
+    0x71, 0x55, 0x62, 0xBE, 0xD2, 0xCF, 0xE4, 0xD7, 0x7A, 0xE6, 0xBF, 0xCE, 0x14, 0x58, 0x35, 0x77,
+    0x3A, 0x6C, 0x88, 0xB0, 0x26, 0x09, 0x37, 0x9B, 0xC9, 0xDC, 0xE5, 0xCC, 0xE7, 0x4E, 0x63, 0xA9,
+    0x44, 0x44, 0xAE, 0x51, 0x88, 0x88, 0x88, 0xA7, 0xFE, 0xC6, 0xFE, 0x41, 0x77, 0xE0, 0x99, 0x60,
+    0x45, 0x35, 0x24, 0x3A, 0xB9, 0x69, 0xD2, 0xE0, 0xE8, 0x13, 0x16, 0x29, 0x1B, 0xC8, 0x47, 0xF2,
+    0x11, 0x6D, 0xF5, 0x80, 0x1E, 0x68, 0x13, 0x19, 0xBD, 0x08, 0x59, 0x24, 0x9B, 0xF6, 0xFB, 0xA6,
+    0x17, 0x7A, 0x11, 0x5F, 0x4A, 0x54, 0xF3, 0x1C, 0x87, 0xD3, 0x62, 0x46, 0x2E, 0x22, 0xE2, 0xCD,
+    0xB1, 0x1C, 0x9F, 0xA8, 0x41, 0x0F, 0x6A, 0xB8, 0x42, 0xE4, 0x8A, 0xB2, 0x95, 0x55, 0xF6, 0xE1,
+    0x6C, 0xE4, 0xD2, 0x26, 0xE7, 0x4A, 0xF5, 0xFA, 0x8B, 0xB7, 0xA1, 0xB8, 0x2B, 0x71, 0x2E, 0x7E,
+    0x97, 0x23, 0x3D, 0x4C, 0x73, 0x42, 0x62, 0x9A, 0xE4, 0x33, 0xEA, 0x0E, 0x83, 0x0A, 0x69, 0x04,
+    0x22, 0x2B, 0x94, 0x47, 0x0F, 0xF4, 0x30, 0x65, 0x22, 0x99, 0x44, 0x23, 0x7E, 0xEE, 0xE5, 0x99,
+    0x73, 0x32, 0xCF, 0xB6, 0x73, 0xBA, 0x90, 0x4D, 0x81, 0x6B, 0xD3, 0x98, 0x7E, 0xCF, 0x8C, 0xB2,
+    0x87, 0x53, 0xFB, 0xAB, 0x55, 0x32, 0x21, 0x9E, 0x47, 0x03, 0x32, 0x92, 0x07, 0xD6, 0x3B, 0x30,
+    0xB1, 0x02, 0x0C, 0x47, 0x40, 0x65, 0xF7, 0x80, 0xD2, 0xED, 0x01, 0x2A, 0xD4, 0x90, 0xBE, 0xD8,
+    0x64, 0xE6, 0x1E, 0x53, 0x49, 0xD2, 0xE4, 0x14, 0x71, 0x56, 0x16, 0x88, 0x2A, 0x00, 0x6D, 0x9A,
+    0xC2, 0xDE, 0x25, 0xC2, 0x40, 0x9E, 0xEA, 0xE9, 0x6D, 0x03, 0x11, 0xED, 0xA1, 0x4D, 0x64, 0x2B,
+    0xA1, 0xF6, 0xB9, 0x88, 0x9D, 0x27, 0x9C, 0x9C, 0xB3, 0xCE, 0x73, 0x1D, 0x3A, 0xA1, 0x35, 0x33,
+    0x34, 0x30, 0x17, 0x03, 0x37, 0x76, 0xEF, 0xBE, 0x55, 0xFD, 0x46, 0x6D, 0xBD, 0x75, 0xB2, 0x28,
+    0x75, 0xB2, 0x33, 0x75, 0x6A, 0xC7, 0x35, 0xA9, 0x1D, 0xD7, 0xA4, 0xB6, 0xDE, 0xBD, 0x64, 0x75,
+    0xF6, 0x92, 0x2D, 0xDA, 0x4B, 0x2D, 0xBB, 0x7B, 0xA9, 0x65, 0xF7, 0x28, 0x11, 0xD6, 0x13, 0x5C,
+    0xD5, 0x1E, 0x25, 0x7B, 0x35, 0x25, 0xEB, 0x90, 0xDA, 0xB9, 0x54, 0xFC, 0x0D, 0xDA, 0x7A, 0xB7,
+    0xB8, 0x84, 0x85, 0x0A, 0x0D, 0x44, 0x5E, 0x00, 0x15, 0x4A, 0x3B, 0x67, 0xE5, 0xF3, 0x38, 0xAD,
+    0x7B, 0x2E, 0x25, 0x6B, 0x7A, 0x79, 0x56, 0x82, 0x92, 0x58, 0x4C, 0x70, 0x42, 0xE9, 0x50, 0x9E,
+    0xCA, 0x52, 0x37, 0x18, 0x18, 0x49, 0x83, 0x85, 0xF3, 0x91, 0x23, 0x28, 0x7C, 0x9A, 0xFF, 0x5B,
+    0x03, 0xF5, 0x53, 0x01, 0x58, 0xE8, 0x0E, 0x88, 0x87, 0x80, 0xFA, 0xD5, 0xB0, 0x25, 0x63, 0x27,
+    0xFA, 0x6A, 0x6A, 0x9B, 0x19, 0xB7, 0x41, 0xF1, 0xB0, 0x04, 0xCA, 0x34, 0xDD, 0x78, 0x3A, 0x1D,
+    0x5D, 0x75, 0xE9, 0xCC, 0x99, 0x0D, 0x88, 0x34, 0xED, 0x3F, 0xAF, 0x03, 0xAE, 0xFB, 0x47, 0x3A,
+    0xE0, 0xF2, 0xB9, 0x03, 0x6E, 0x48, 0x1D, 0x70, 0x6C, 0x7A, 0x3B, 0xCF, 0x77, 0xC0, 0xAD, 0xF7,
+    0xBF, 0xB8, 0x4E, 0x23, 0xD0, 0xD3, 0xD8, 0x10, 0x91, 0x53, 0x76, 0xF1, 0x4C, 0xBB, 0x48, 0xB1,
+    0xFA, 0x0C, 0x95, 0xCD, 0x13, 0xF1, 0x66, 0xA0, 0xE6, 0x5C, 0x7A, 0x95, 0xA5, 0x63, 0x54, 0xA5,
+    0x9B, 0x28, 0xE6, 0x7F, 0xEE, 0x02, 0xDD, 0xEF, 0x68, 0xEC, 0xCC, 0xE5, 0xE4, 0x4D, 0xB5, 0x9C,
+    0xF2, 0x42, 0x1E, 0xEA, 0xAF, 0xBB, 0x5A, 0x64, 0xD8, 0x74, 0x88, 0x32, 0x42, 0x16, 0x2E, 0xBA,
+    0xDC, 0xB7, 0x51, 0xBD, 0x27, 0x51, 0xFD, 0xDC, 0x4D, 0xC5, 0xAD, 0x66, 0x55, 0x46, 0x4E, 0x74,
+    0xE0, 0x44, 0x7B, 0x56, 0xD5, 0xC0, 0xAA, 0xB2, 0x4C, 0x75, 0x43, 0x34, 0x10, 0x0D, 0xD9, 0xB8,
+    0x20, 0x0F, 0x2B, 0x94, 0x8F, 0x14, 0x67, 0x28, 0x3A, 0x35, 0xB0, 0xA0, 0x78, 0x2A, 0xA2, 0x7F,
+    0xE9, 0xD1, 0xD2, 0x91, 0x7F, 0x9B, 0xF3, 0x6C, 0xA9, 0x11, 0x16, 0xA0, 0x3B, 0xB2, 0x73, 0xFC,
+    0x9C, 0x7A, 0xA2, 0x96, 0xB1, 0x78, 0xFB, 0xC0, 0x7E, 0x67, 0xD6, 0xE5, 0x7C, 0x04, 0x81, 0xBE,
+    0xA3, 0xED, 0xA8, 0x87, 0xCD, 0x2F, 0x1B, 0xF2, 0x67, 0x02, 0x37, 0xCC, 0x0F, 0xFA, 0x4C, 0x64,
+    0x28, 0xC4, 0x6D, 0xCF, 0x65, 0x3B, 0x52, 0x8B, 0xD3, 0xBF, 0x58, 0x29, 0x4F, 0xB7, 0x04, 0x3D,
+    0x37, 0x4D, 0x48, 0x28, 0x44, 0x9A, 0xC5, 0xFE, 0xD5, 0x24, 0x28, 0x4A, 0xC7, 0x67, 0x5B, 0xAA,
+    0x97, 0xD7, 0x07, 0xBE, 0x96, 0x91, 0x7E, 0xDC, 0x66, 0xDB, 0xBF, 0x05, 0x6D, 0xE1, 0xB7, 0xEB,
+    0x49, 0x9D, 0xD8, 0x81, 0xAC, 0xB9, 0x90, 0x47, 0x3D, 0x48, 0x11, 0xCC, 0x53, 0x31, 0x3B, 0x1B,
+    0x83, 0x3F, 0x1A, 0xD1, 0xD2, 0x64, 0xCF, 0xDF, 0xD3, 0x90, 0x7B, 0xAE, 0x05, 0xB9, 0x85, 0xFA,
+    0x25, 0xF4, 0x9B, 0x56, 0x89, 0x43, 0x1C, 0x66, 0xD8, 0xF8, 0xBB, 0x9D, 0xD9, 0xD7, 0x6B, 0x3F,
+    0x23, 0x20, 0xD3, 0x83, 0x3B, 0x2D, 0xD1, 0x02, 0xD9, 0xF3, 0x33, 0x30, 0x93, 0x8D, 0x9C, 0x7E,
+    0x9D, 0x86, 0x3E, 0xFB, 0xC3, 0xD5, 0xAC, 0xEA, 0xDA, 0xA6, 0xCC, 0x76, 0xCB, 0xC3, 0xDD, 0x9B,
+    0xD3, 0xD8, 0xF9, 0x89, 0x1D, 0xE5, 0x29, 0xBE, 0x19, 0xD2, 0xAC, 0xD1, 0x7E, 0x84, 0x8B, 0xD7,
+    0xCE, 0x97, 0x2E, 0xB6, 0x5C, 0x52, 0x16, 0xE9, 0x0B, 0x3A, 0x94, 0x03, 0xEA, 0xD4, 0xE1, 0xD0,
+    0x2C, 0x81, 0xC2, 0x9A, 0x1D, 0xC8, 0x9D, 0x96, 0x11, 0x42, 0x21, 0xD2, 0x71, 0x98, 0xFB, 0xC2,
+    0x53, 0x13, 0x89, 0xE8, 0xC6, 0x50, 0x53, 0x5A, 0xDD, 0xE9, 0x37, 0x3E, 0xEF, 0x94, 0x57, 0x4E,
+    0x3C, 0x93, 0xF2, 0x26, 0x50, 0x49, 0xD0, 0x81, 0x4C, 0x1C, 0x57, 0x4F, 0x2D, 0x77, 0xD6, 0x5B,
+    0x65, 0x69, 0x23, 0x47, 0x64, 0xCF, 0xDB, 0xD2, 0x92, 0x8D, 0x44, 0xA8, 0x1A, 0xDD, 0x91, 0xFB,
+    0x34, 0x10, 0xAE, 0x06, 0x75, 0xE7, 0x55, 0x59, 0xD3, 0x8A, 0x48, 0x2C, 0xDF, 0xF9, 0x92, 0xD3,
+    0x43, 0xE4, 0x88, 0x95, 0xB6, 0xA5, 0x2D, 0x86, 0x91, 0x25, 0xCB, 0xAA, 0x29, 0x07, 0xFD, 0x86,
+    0x67, 0x91, 0x07, 0x83, 0x92, 0x49, 0xB9, 0x79, 0x38, 0xF1, 0x85, 0x0F, 0x9D, 0x8F, 0xF0, 0xEA,
+    0x9D, 0x75, 0x22, 0xB0, 0xEA, 0x81, 0xD3, 0x6F, 0x38, 0xC9, 0x42, 0xFE, 0x36, 0x75, 0x2E, 0x83,
+    0xF2, 0xB2, 0x66, 0xCF, 0x14, 0xAE, 0xF8, 0x71, 0xB7, 0x60, 0xE5, 0xCB, 0x41, 0x47, 0x22, 0xD2,
+    0x68, 0x5B, 0xB9, 0x4D, 0xFB, 0x7F, 0xF7, 0x8F, 0xB4, 0xFF, 0x27, 0x6A, 0x9C, 0x99, 0xE1, 0x96,
+    0x7A, 0x6E, 0x11, 0xD7, 0x1D, 0xA8, 0xEE, 0x5E, 0x3A, 0x7D, 0xF9, 0x9E, 0x38, 0x3D, 0x5D, 0x1E,
+    0xB5, 0x70, 0xA4, 0x87, 0xA6, 0x2A, 0x2D, 0xE5, 0x77, 0x2D, 0xEA, 0xEF, 0x2D, 0xFC, 0xDA, 0xC1,
+    0x22, 0x42, 0x7D, 0xAB, 0x41, 0xBF, 0xE9, 0x50, 0x7E, 0x49, 0x36, 0x56, 0xDD, 0xA5, 0x95, 0x0A,
+    0x4F, 0xD6, 0xB4, 0x2B, 0x6D, 0xF5, 0x5A, 0x39, 0xD6, 0x67, 0x1A, 0x1B, 0x8A, 0x6D, 0x1C, 0xD9,
+    0x6F, 0x67, 0x7A, 0x9C, 0xCE, 0x66, 0xBE, 0xFA, 0xFB, 0x2E, 0xF9, 0x9C, 0x89, 0x35, 0xF8, 0x2C,
+    0x4F, 0x42, 0xE4, 0xAB, 0x10, 0x33, 0x0F, 0xFD, 0xFF, 0x3A, 0x40, 0x2D, 0xE7, 0x8A, 0x91, 0x1F,
+    0x09, 0x3C, 0xF9, 0x77, 0x5B, 0xED, 0xF9, 0xDF, 0x46, 0x76, 0xD4, 0x53, 0x90, 0xBE, 0x92, 0xEE,
+    0xB5, 0x0D, 0x98, 0xD7, 0x6E, 0xE1, 0xA7, 0x94, 0x05, 0x6E, 0xFA, 0xBD, 0xEA, 0x4D, 0x17, 0x6F,
+    0x1E, 0x52, 0x04, 0xFB, 0x8C, 0x88, 0x4C, 0xD5, 0x53, 0x31, 0xF7, 0x87, 0x85, 0x2B, 0xDE, 0x18,
+    0xEA, 0xEE, 0xF1, 0x82, 0x89, 0xAB, 0xDB, 0x50, 0x18, 0xDA, 0x34, 0x54, 0x34, 0xA2, 0xDF, 0xF9,
+    0x52, 0x4C, 0xDF, 0xA8, 0x16, 0xD3, 0xC4, 0xDB, 0xCA, 0xD6, 0x0D, 0x2D, 0x13, 0xF9, 0xA8, 0x3C,
+    0xDA, 0x6A, 0xCB, 0x9A, 0x7E, 0xFF, 0xC0, 0xD5, 0x22, 0x53, 0x2E, 0xB2, 0x3E, 0x17, 0x3A, 0x1D,
+    0xB8, 0xD2, 0x53, 0xC8, 0x8B, 0xE2, 0xB8, 0xB0, 0xA8, 0xFA, 0x8E, 0xEC, 0x03, 0xBF, 0x80, 0xE2,
+    0x27, 0x59, 0x80, 0x3A, 0x94, 0x16, 0xA4, 0xDB, 0xDB, 0x41, 0x45, 0x44, 0xBA, 0x6A, 0x28, 0x44,
+    0xBA, 0x9E, 0x9A, 0x56, 0x85, 0x34, 0x92, 0x5E, 0xF9, 0xDC, 0x2F, 0xD0, 0x9D, 0x7E, 0x23, 0x60,
+    0xD8, 0x2B, 0x2D, 0x93, 0xF2, 0x86, 0x4C, 0xA4, 0x19, 0x67, 0x08, 0xFD, 0xAC, 0xF9, 0xFC, 0x50,
+    0xBE, 0x7A, 0x62, 0x4B, 0x9F, 0xE1, 0xAB, 0x17, 0xFE, 0xE4, 0x94, 0xAF, 0x5E, 0xBD, 0x7B, 0x7C,
+    0xFC, 0x6A, 0x6C, 0x45, 0x44, 0xDE, 0x9F, 0xF6, 0xF7, 0xF7, 0xDB, 0xAF, 0xB9, 0x4D, 0xF3, 0x77,
+    0xE2, 0xAB, 0xD7, 0x89, 0xAF, 0x5E, 0x3C, 0x80, 0xAF, 0x5E, 0x7C, 0x28, 0x5F, 0xFD, 0xA2, 0x0C,
+    0xD4, 0x12, 0x58, 0xE7, 0x51, 0x05, 0x4E, 0xCA, 0x01, 0xA3, 0x3B, 0x4C, 0x0D, 0xC6, 0x1C, 0x1F,
+    0xF7, 0xAD, 0xC8, 0x7A, 0xB1, 0xBF, 0xBF, 0x5A, 0x42, 0x5C, 0x92, 0x8D, 0x2B, 0x94, 0x6F, 0xD1,
+    0x83, 0xE9, 0xDA, 0xA6, 0x92, 0x89, 0x42, 0xDC, 0xE9, 0xDA, 0xAE, 0x1A, 0xF1, 0xA8, 0x68, 0xC4,
+    0x51, 0x4D, 0xC5, 0x04, 0x26, 0xAA, 0x11, 0xD6, 0x8F, 0xA4, 0x54, 0x25, 0x8F, 0x73, 0x5D, 0xAB,
+    0x18, 0xE6, 0xAF, 0xE3, 0x22, 0x52, 0x25, 0x7E, 0x38, 0xB0, 0xE2, 0x08, 0x38, 0x99, 0x5B, 0x28,
+    0x02, 0x60, 0x72, 0x0F, 0x18, 0x35, 0x6C, 0xAA, 0x3D, 0xA9, 0x9E, 0x46, 0xFD, 0x3C, 0x40, 0x75,
+    0x74, 0x3A, 0xF9, 0x26, 0x4D, 0x6F, 0x4B, 0x73, 0x9D, 0xF4, 0x3D, 0xAD, 0x67, 0x65, 0x80, 0xA9,
+    0x8D, 0x14, 0xEB, 0x3F, 0x8B, 0xA9, 0x21, 0xC6, 0x34, 0xC4, 0xD4, 0x65, 0x1B, 0x20, 0x2A, 0x07,
+    0xCB, 0xC2, 0xC2, 0x52, 0x03, 0xCB, 0x27, 0x80, 0xC3, 0x43, 0xE0, 0xD0, 0x03, 0x0B, 0xB7, 0x09,
+    0xFC, 0xDA, 0x6D, 0x52, 0x7A, 0xE5, 0x41, 0xED, 0x1A, 0x1F, 0x07, 0xD0, 0x4D, 0xD1, 0x01, 0x85,
+    0x53, 0xA9, 0xDE, 0x94, 0x82, 0x2E, 0x93, 0x34, 0x40, 0xC9, 0xC0, 0x87, 0x5C, 0x4A, 0xD6, 0xD4,
+    0x09, 0x2F, 0xD0, 0x32, 0x72, 0x71, 0x8E, 0xD4, 0x53, 0x70, 0x80, 0x69, 0x28, 0x13, 0x7A, 0x50,
+    0x26, 0xB8, 0xA0, 0x14, 0xC8, 0x47, 0xF4, 0xAD, 0x0E, 0x26, 0xF4, 0xF7, 0x1C, 0x18, 0xF4, 0xCB,
+    0x01, 0xB4, 0xD5, 0x5D, 0x84, 0xC2, 0xEB, 0xAE, 0x85, 0x7C, 0xD4, 0x5D, 0xDD, 0xC1, 0x54, 0x35,
+    0xE5, 0x00, 0xA6, 0x6A, 0x54, 0x80, 0xEA, 0x27, 0x0D, 0x31, 0x95, 0x60, 0xDA, 0x54, 0xED, 0xAA,
+    0xBB, 0xED, 0x94, 0xC1, 0xD3, 0x99, 0x3F, 0xD9, 0x34, 0xA3, 0x0E, 0x23, 0xBD, 0xD8, 0x62, 0x33,
+    0xA0, 0xB1, 0x3D, 0x53, 0xD8, 0xDB, 0x8E, 0x1F, 0x9A, 0x1B, 0xD8, 0x12, 0xA2, 0xBC, 0x45, 0xED,
+    0xCF, 0x18, 0xF9, 0x1C, 0x3E, 0xC7, 0xE7, 0xC8, 0x3D, 0x9E, 0x72, 0xD0, 0x0D, 0xD5, 0xCF, 0x46,
+    0xA8, 0xA5, 0x81, 0x0B, 0xBF, 0x2B, 0x63, 0xFC, 0x5F, 0x17, 0xAE, 0xBE, 0xB2, 0x5B, 0xBD, 0xF5,
+    0xDE, 0x5D, 0x6F, 0x44, 0x89, 0xED, 0x9D, 0x9E, 0xB8, 0xC4, 0x05, 0xBF, 0xA1, 0xE0, 0x1D, 0x6E,
+    0xEE, 0xED, 0xB1, 0xB3, 0xE3, 0xBF, 0xE6, 0x2E, 0xDA, 0xE1, 0xBE, 0x2E, 0x5A, 0x91, 0x30, 0x0F,
+    0xF6, 0x3C, 0x83, 0x56, 0xFC, 0x28, 0x8D, 0x7F, 0x69, 0xA8, 0x44, 0x1C, 0x75, 0x57, 0x05, 0x4C,
+    0x93, 0xC7, 0xD4, 0xBE, 0xDC, 0x42, 0x64, 0x01, 0x91, 0x13, 0xB2, 0x98, 0x92, 0xDA, 0x48, 0xE9,
+    0xB3, 0x69, 0xBF, 0xB7, 0xB5, 0xC8, 0xFA, 0xEC, 0x68, 0xD4, 0xCB, 0xD0, 0xA6, 0xE1, 0x7B, 0xA9,
+    0x07, 0x0A, 0xE5, 0xE0, 0x88, 0x5C, 0xA4, 0x33, 0x32, 0xA2, 0x13, 0xBD, 0x6D, 0xF3, 0xF3, 0xAF,
+    0x5C, 0x2B, 0x45, 0x3A, 0xF9, 0xE6, 0xA4, 0xBB, 0xC2, 0x07, 0x4C, 0xD5, 0xA8, 0xF7, 0x02, 0x7B,
+    0x55, 0x53, 0xBE, 0x1E, 0xF3, 0xA0, 0x65, 0x4D, 0xBD, 0x3E, 0x63, 0x64, 0x1E, 0x15, 0xE9, 0xD2,
+    0x7C, 0xB1, 0xFF, 0x30, 0x16, 0x91, 0x3C, 0xB0, 0x46, 0x79, 0xDA, 0xF4, 0x50, 0x78, 0x5A, 0x4A,
+    0xD7, 0x2C, 0xD0, 0x3F, 0x18, 0x26, 0xF4, 0xEB, 0xEF, 0x47, 0xB4, 0x15, 0x4F, 0xF5, 0x7F, 0x89,
+    0xA5, 0x96, 0x35, 0x18, 0xB9, 0x0E, 0x06, 0xDD, 0xD0, 0x52, 0x74, 0x2C, 0xC8, 0x1F, 0x08, 0xF0,
+    0xD4, 0xE2, 0x39, 0xDB, 0x16, 0x74, 0x30, 0x54, 0x3E, 0x13, 0x27, 0x91, 0xE7, 0xDE, 0xBC, 0x1B,
+    0x29, 0x7E, 0xDC, 0x4D, 0x14, 0xFF, 0x1F, 0x27, 0x94, 0x91, 0x13, 0xB4, 0x67, 0x85, 0x76, 0x4C,
+    0x54, 0x96, 0x48, 0xDD, 0x65, 0x91, 0x5A, 0x3D, 0x1D, 0x30, 0xE5, 0x4D, 0xCF, 0x9E, 0xFA, 0xDE,
+    0xC0, 0x51, 0x2E, 0x96, 0xFE, 0x6F, 0x04, 0x44, 0x22, 0xDC, 0x91, 0x48, 0x16, 0x1E, 0xDE, 0x25,
+    0x0F, 0x69, 0xA6, 0xE4, 0xC7, 0xCE, 0x0C, 0xCB, 0xA8, 0x6E, 0x37, 0x73, 0xA9, 0x71, 0xFF, 0x3C,
+    0xD9, 0xEC, 0x5F, 0x9E, 0x6A, 0xE1, 0x61, 0x4A, 0xE7, 0x4E, 0x27, 0x39, 0x36, 0x1C, 0xBC, 0x7B,
+    0xFC, 0xCA, 0x66, 0xCE, 0x05, 0xBF, 0xE5, 0x9C, 0x8B, 0xE4, 0xCA, 0x4E, 0x1E, 0x54, 0x0E, 0xAD,
+    0xC5, 0x73, 0xFA, 0xCD, 0x00, 0x3B, 0x9B, 0x78, 0x74, 0x26, 0x07, 0x3F, 0x41, 0x2F, 0x31, 0x17,
+    0x71, 0xD9, 0xF3, 0x3F, 0x4A, 0xF9, 0xA6, 0x9E, 0x63, 0x23, 0x3D, 0xCF, 0x49, 0xA8, 0x38, 0x9D,
+    0xBE, 0xBC, 0x37, 0x77, 0xB5, 0x2D, 0xE1, 0x7F, 0x88, 0xD0, 0xFB, 0x34, 0xB4, 0x7E, 0x67, 0x83,
+    0x7A, 0xDD, 0x33, 0xCB, 0x73, 0x99, 0xBE, 0x7F, 0x2A, 0xA1, 0xB9, 0x2D, 0xF9, 0x40, 0xDD, 0x71,
+    0xF5, 0xCC, 0xEC, 0xB5, 0x2F, 0x4E, 0xFB, 0x60, 0x44, 0x2C, 0x0F, 0xF5, 0xEF, 0xBE, 0xF2, 0xC0,
+    0x59, 0x9E, 0xF7, 0xCD, 0xFF, 0x4C, 0xCC, 0x5A, 0x89, 0x50, 0x6E, 0xBF, 0x56, 0x34, 0x17, 0x97,
+    0x8B, 0x74, 0x8B, 0xA7, 0x63, 0x89, 0x1E, 0x20, 0xD2, 0xD4, 0x5D, 0xF5, 0xAC, 0xA7, 0x1D, 0x29,
+    0x22, 0xB9, 0x38, 0xD6, 0xBA, 0xA9, 0x3A, 0x54, 0xE0, 0xB3, 0xA6, 0x29, 0x5F, 0x9E, 0xFE, 0x85,
+    0xAF, 0x64, 0xA2, 0x9D, 0x75, 0xD5, 0x88, 0x08, 0x5A, 0x44, 0x2C, 0x07, 0xEF, 0xBE, 0xEA, 0x29,
+    0x07, 0x46, 0x94, 0x67, 0x17, 0x22, 0x1A, 0x5A, 0xB2, 0xF3, 0xF7, 0x71, 0x19, 0x98, 0x12, 0x5B,
+    0x4F, 0x06, 0xEA, 0xB7, 0xAB, 0x88, 0x1E, 0xE8, 0x1B, 0xE5, 0xD1, 0x2E, 0x8B, 0xA8, 0x91, 0x05,
+    0x9C, 0x50, 0x37, 0xD4, 0x9D, 0x1E, 0x28, 0x13, 0xAC, 0x9E, 0x45, 0x88, 0xA5, 0x04, 0xDA, 0x52,
+    0xA6, 0xF9, 0x0D, 0xB7, 0x28, 0x76, 0xE9, 0xE1, 0xB5, 0xCA, 0xCF, 0x96, 0xA0, 0x14, 0x07, 0x7C,
+    0xA5, 0x81, 0x4A, 0x24, 0xD4, 0x22, 0xFE, 0xE2, 0xF4, 0x9C, 0xCF, 0xC6, 0xDC, 0xE5, 0x21, 0xB3,
+    0x9B, 0x9E, 0x10, 0xE5, 0xA0, 0xF8, 0xB9, 0xD8, 0x52, 0xC4, 0xEB, 0xF5, 0x41, 0xD4, 0x36, 0x8F,
+    0xBA, 0x63, 0xAA, 0x3A, 0xA6, 0xBA, 0x61, 0x32, 0x30, 0xED, 0x6D, 0x3B, 0x4A, 0x36, 0xDD, 0x24,
+    0xE5, 0x90, 0xDB, 0xBA, 0x53, 0x77, 0xD6, 0x09, 0xB7, 0x3F, 0x6E, 0xB6, 0xA9, 0xC0, 0x55, 0xF4,
+    0x48, 0x2B, 0x5D, 0x19, 0xD1, 0x13, 0xBD, 0x34, 0x26, 0xA2, 0x85, 0x22, 0x20, 0x91, 0x9D, 0xAA,
+    0x2B, 0x9C, 0x1A, 0x2F, 0x41, 0x69, 0xCB, 0x21, 0xD5, 0x03, 0x06, 0x6D, 0xAB, 0x06, 0xC8, 0xBD,
+    0xB6, 0xA9, 0x30, 0xE7, 0x75, 0x97, 0x80, 0xB9, 0x1B, 0xD5, 0x4B, 0xE9, 0x3C, 0x1E, 0xD6, 0xCF,
+    0xD8, 0xB9, 0xD9, 0x30, 0xA1, 0x29, 0xF9, 0x3C, 0xA7, 0x80, 0x22, 0x2C, 0x66, 0x1E, 0xC9, 0x70,
+    0x94, 0x40, 0x26, 0x63, 0x57, 0x09, 0x9F, 0x93, 0x34, 0xF1, 0x90, 0x7C, 0x9A, 0x27, 0x9A, 0x94,
+    0x63, 0x36, 0xD2, 0x03, 0xB5, 0x4B, 0x03, 0xE9, 0xE8, 0x6D, 0xEE, 0x31, 0x96, 0x5C, 0x50, 0x1E,
+    0xED, 0xD1, 0x91, 0x56, 0x9A, 0x72, 0x4D, 0xED, 0x10, 0x21, 0x97, 0x6E, 0x4E, 0xF5, 0x4C, 0x77,
+    0x76, 0x64, 0xCD, 0xB9, 0x7F, 0x1C, 0x9D, 0xE1, 0x25, 0x6F, 0x46, 0x4B, 0xCE, 0xD7, 0xA7, 0xF9,
+    0xFF, 0x01, 0xE5, 0xBD, 0x5F, 0xAC, 0x1D, 0xC7, 0x9D, 0xE7, 0xF7, 0xE9, 0x2E, 0x92, 0xAD, 0xB0,
+    0x47, 0x2E, 0x26, 0x91, 0x90, 0x89, 0x65, 0xA9, 0xFD, 0xB0, 0x0F, 0x33, 0x1E, 0x8B, 0x9D, 0x87,
+    0x20, 0x10, 0x06, 0xBC, 0xA7, 0x9A, 0x12, 0x36, 0x42, 0x20, 0x04, 0x26, 0xB2, 0x3A, 0x56, 0xB2,
+    0x42, 0x86, 0xF3, 0x10, 0x04, 0x3B, 0x83, 0xCC, 0xD2, 0x08, 0x14, 0x40, 0x40, 0xEE, 0xBD, 0xDD,
+    0x96, 0x10, 0xF8, 0x61, 0x1E, 0x44, 0x20, 0xAB, 0xC9, 0x83, 0x93, 0x58, 0x58, 0x78, 0x91, 0xF1,
+    0x21, 0x10, 0xFA, 0x41, 0x0B, 0x70, 0x36, 0xE7, 0xDE, 0x2E, 0x89, 0x08, 0x04, 0xAC, 0x80, 0x75,
+    0x4B, 0xCA, 0xEE, 0x3C, 0xF8, 0x41, 0x6D, 0x5B, 0x5E, 0x27, 0xD4, 0x66, 0x58, 0x92, 0x4B, 0xA3,
+    0x26, 0x59, 0x7D, 0x7E, 0x79, 0xA8, 0xEE, 0x73, 0x2F, 0x29, 0x69, 0xEC, 0x99, 0x91, 0x31, 0x03,
+    0xE4, 0x90, 0x38, 0x7D, 0xFE, 0xF4, 0xE9, 0xAE, 0xFA, 0xD5, 0xAF, 0x7E, 0x7F, 0xBE, 0xBF, 0x3F,
+    0x17, 0xE2, 0x23, 0xF7, 0xBC, 0x4A, 0xD9, 0x15, 0xC2, 0x39, 0x4C, 0xD0, 0x57, 0xFB, 0x12, 0x73,
+    0x98, 0x57, 0x41, 0xDB, 0x1D, 0x92, 0xAA, 0xD4, 0xFD, 0x59, 0x20, 0x7B, 0xD3, 0x97, 0x40, 0xF2,
+    0xF3, 0x75, 0x51, 0x01, 0xFF, 0xC7, 0x77, 0x0A, 0x0B, 0x94, 0x6F, 0xBE, 0xD4, 0x03, 0xFA, 0x9D,
+    0x77, 0xAF, 0x01, 0x59, 0x27, 0x3B, 0x80, 0xEA, 0xEB, 0xAF, 0x35, 0x90, 0xBA, 0xF2, 0xC5, 0x5E,
+    0x55, 0x89, 0xD3, 0x36, 0xA8, 0xB7, 0x6F, 0x78, 0xD5, 0x95, 0xDF, 0x76, 0xE2, 0x13, 0xA7, 0x64,
+    0x28, 0x1D, 0xD7, 0xA8, 0xFF, 0x57, 0x2A, 0x20, 0xC9, 0x1B, 0x00, 0x52, 0x17, 0x87, 0xB3, 0x8E,
+    0x87, 0x45, 0x3C, 0x98, 0xE9, 0x50, 0x71, 0xFC, 0x71, 0x4A, 0x06, 0xB4, 0x88, 0x55, 0xB7, 0x9E,
+    0x0D, 0x78, 0x6A, 0x76, 0xD1, 0xDD, 0x23, 0xA4, 0x5E, 0x55, 0x04, 0xA0, 0x9E, 0x7E, 0x52, 0x37,
+    0x18, 0xA9, 0xD0, 0xD2, 0x93, 0x3C, 0xBB, 0x01, 0xCA, 0x0E, 0xD4, 0x00, 0x1C, 0x02, 0xE5, 0x8B,
+    0x16, 0xFD, 0xB6, 0x23, 0x73, 0x1B, 0x32, 0x5F, 0xFA, 0x8B, 0x83, 0x12, 0xF1, 0x94, 0xD2, 0xC3,
+    0xBF, 0xD7, 0x01, 0xD7, 0xE2, 0x38, 0x4E, 0xE8, 0x8A, 0x4C, 0x2C, 0x89, 0x58, 0xF8, 0xE2, 0x34,
+    0x92, 0x54, 0xFA, 0x44, 0xC4, 0x9A, 0xF3, 0x63, 0x56, 0x65, 0xFD, 0x19, 0xF6, 0x40, 0x5B, 0x52,
+    0xCF, 0x6F, 0x05, 0x94, 0xF4, 0x3C, 0x58, 0x37, 0x24, 0x01, 0xF4, 0xF5, 0x2A, 0x09, 0x6B, 0xCC,
+    0x4B, 0x7D, 0xE1, 0x5A, 0x19, 0x52, 0xB9, 0x05, 0x17, 0x01, 0x07, 0x1A, 0xFE, 0x55, 0x4F, 0x11,
+    0x40, 0x8E, 0x4D, 0xEF, 0x01, 0xB4, 0x0C, 0xB4, 0x56, 0xC9, 0x88, 0x38, 0x1E, 0xF2, 0xC8, 0x40,
+    0xEA, 0xD9, 0x9C, 0x80, 0x91, 0x03, 0xC0, 0xB0, 0x07, 0x14, 0x76, 0x01, 0xE4, 0xFD, 0x02, 0x50,
+    0xBE, 0x04, 0x08, 0x1A, 0xC0, 0xB4, 0x0D, 0x50, 0x88, 0x03, 0xF2, 0x7E, 0x04, 0x94, 0x2F, 0x2C,
+    0x10, 0x94, 0x03, 0x6A, 0x0E, 0x81, 0xA2, 0xD1, 0x16, 0xF2, 0x3E, 0x0D, 0xA0, 0x3C, 0x75, 0x05,
+    0x01, 0xED, 0xA0, 0x26, 0x11, 0x52, 0x11, 0x4A, 0x9F, 0x8A, 0xD8, 0x54, 0x1A, 0x80, 0xA2, 0x03,
+    0x50, 0x0E, 0x20, 0x19, 0x00, 0xD8, 0x03, 0xA0, 0x8C, 0x2C, 0x54, 0x01, 0x24, 0x71, 0x21, 0x4F,
+    0x6D, 0x28, 0xDF, 0x90, 0xC6, 0xF8, 0x67, 0x7A, 0x13, 0x12, 0x6F, 0xCE, 0xB3, 0x5B, 0x42, 0x59,
+    0x80, 0x7E, 0x09, 0xD4, 0xBB, 0x0D, 0xC9, 0x1D, 0x07, 0xED, 0x1A, 0xCC, 0xD7, 0x1A, 0xF4, 0x75,
+    0x47, 0xD6, 0xEF, 0xF3, 0xB6, 0xD7, 0xDD, 0xB0, 0x4E, 0x37, 0xC1, 0x60, 0x44, 0x37, 0xD9, 0xC7,
+    0x16, 0xCE, 0x38, 0x60, 0x17, 0x28, 0x80, 0xDC, 0x42, 0xDE, 0x43, 0xDE, 0x1D, 0x11, 0x2B, 0xA9,
+    0x94, 0x6C, 0x48, 0x37, 0x18, 0xB1, 0x88, 0xE3, 0x52, 0x83, 0xD9, 0x90, 0x7A, 0x74, 0x57, 0x61,
+    0x48, 0x3D, 0x28, 0xC7, 0x1E, 0xB0, 0x7F, 0x4E, 0x57, 0x90, 0xBF, 0xF3, 0x62, 0x0F, 0x8C, 0xCF,
+    0xAD, 0x01, 0xFD, 0xE6, 0xD7, 0x00, 0x36, 0xD2, 0x01, 0x85, 0x6C, 0x80, 0xD4, 0xFF, 0xC4, 0x01,
+    0xE6, 0x91, 0xA2, 0x01, 0xF5, 0x41, 0x17, 0x80, 0xFA, 0xAB, 0x79, 0x0F, 0xD9, 0x8F, 0x1B, 0x03,
+    0x1C, 0x90, 0x0E, 0xA0, 0x2D, 0xBA, 0x83, 0x00, 0x02, 0x85, 0x45, 0x0D, 0x94, 0xE2, 0x28, 0xFB,
+    0x5C, 0x36, 0xDB, 0xD5, 0x9C, 0xD6, 0xF4, 0x52, 0x4F, 0xF1, 0x86, 0x34, 0xA9, 0xFC, 0xDD, 0x7D,
+    0xCA, 0x90, 0xF8, 0xC4, 0x9F, 0xC9, 0xFE, 0x4F, 0x5D, 0x51, 0x3E, 0xE6, 0xE1, 0xD6, 0x9F, 0x36,
+    0xA8, 0xF7, 0xD7, 0xD3, 0x72, 0xAD, 0x3F, 0xEE, 0x50, 0x3F, 0x7F, 0xC9, 0xA2, 0xFF, 0x97, 0xB2,
+    0x62, 0xFF, 0x8C, 0xE1, 0x05, 0xCF, 0x41, 0x9E, 0x5B, 0x36, 0x83, 0x21, 0x15, 0x3B, 0xA0, 0x02,
+    0x90, 0xFC, 0xB2, 0xAC, 0x52, 0x88, 0xDF, 0x83, 0x5C, 0xC2, 0x5F, 0x9E, 0x55, 0xFC, 0x71, 0x56,
+    0xE9, 0x7E, 0x01, 0xAB, 0xB8, 0x54, 0xC4, 0xA6, 0x1B, 0x00, 0x4E, 0x00, 0x0F, 0x42, 0x2A, 0x16,
+    0xC4, 0x4D, 0x1B, 0x7A, 0x01, 0xE8, 0x0A, 0xB2, 0x0E, 0x5A, 0x39, 0x1F, 0x8C, 0xBC, 0x26, 0xD5,
+    0x22, 0x15, 0xAB, 0xCF, 0xFB, 0x33, 0xD9, 0x6B, 0x8E, 0xF4, 0x03, 0x07, 0x83, 0x83, 0x9D, 0x01,
+    0x8A, 0x16, 0xF2, 0x3B, 0x1D, 0xCA, 0x0F, 0x10, 0x4A, 0xD8, 0xCF, 0xFA, 0x13, 0x65, 0x35, 0x7E,
+    0x21, 0xB7, 0xC5, 0xCD, 0x27, 0x9C, 0x92, 0x66, 0xC0, 0x34, 0x47, 0x74, 0x38, 0x99, 0x88, 0x48,
+    0x93, 0x87, 0x52, 0xC4, 0x2B, 0xB9, 0x7E, 0xFB, 0xAA, 0x47, 0x86, 0x05, 0x23, 0xE6, 0xBC, 0xB2,
+    0xDA, 0xE6, 0x1D, 0xE7, 0x08, 0x89, 0x47, 0x35, 0x71, 0xD3, 0xA4, 0x83, 0x6E, 0x00, 0xF3, 0xB8,
+    0x03, 0x94, 0xDB, 0x3D, 0x22, 0x45, 0x26, 0x01, 0xE0, 0x50, 0x5B, 0x40, 0x77, 0x87, 0x6C, 0xB7,
+    0x4D, 0x61, 0xCB, 0x06, 0xD2, 0x81, 0x00, 0x94, 0x95, 0x76, 0x5B, 0x62, 0x18, 0x54, 0x80, 0xDC,
+    0x51, 0x38, 0x72, 0x09, 0xB4, 0xCD, 0x31, 0x6A, 0xCC, 0x43, 0x34, 0x52, 0x15, 0xEF, 0x48, 0x48,
+    0xE4, 0x7F, 0x7F, 0xDC, 0x95, 0xE3, 0xA0, 0xBF, 0x39, 0xFC, 0xBB, 0x6E, 0xA7, 0xA8, 0xD4, 0x37,
+    0x9D, 0x87, 0xFC, 0x07, 0x15, 0x2C, 0xD6, 0xC0, 0x1D, 0x0F, 0xEA, 0x4E, 0x0F, 0xC5, 0x1F, 0x5A,
+    0x58, 0x17, 0x15, 0xCA, 0x19, 0x1A, 0xDD, 0x1C, 0xE6, 0xEC, 0x21, 0x43, 0xEA, 0x13, 0xB1, 0xDA,
+    0xA6, 0x61, 0x7B, 0xD9, 0x3E, 0x15, 0x41, 0x8B, 0x47, 0xA4, 0xE1, 0x52, 0x47, 0x3A, 0xC6, 0x1D,
+    0x72, 0x08, 0xCA, 0x47, 0x29, 0x18, 0x40, 0x5B, 0xA8, 0xE3, 0x06, 0x2E, 0x1B, 0x92, 0x01, 0xF4,
+    0x74, 0x8E, 0x8B, 0xE7, 0x88, 0x88, 0x58, 0xA8, 0x45, 0xC4, 0x41, 0xF9, 0xF2, 0xF2, 0xEB, 0xD3,
+    0x39, 0x07, 0xDB, 0x73, 0x92, 0xE9, 0x3A, 0xFB, 0x90, 0xC5, 0xEB, 0xA4, 0xD3, 0x39, 0xE3, 0x74,
+    0x0E, 0x24, 0x01, 0x8A, 0x8E, 0x5C, 0x3C, 0xAD, 0x74, 0xB9, 0x04, 0x6A, 0xF1, 0x91, 0x10, 0xD3,
+    0x90, 0xF7, 0xE3, 0xA1, 0x8C, 0xBB, 0x23, 0xB7, 0x00, 0xA8, 0x3E, 0x7E, 0x3A, 0xA9, 0x80, 0x5F,
+    0x9F, 0x66, 0x77, 0xC9, 0xB1, 0xC8, 0xC4, 0x32, 0x9C, 0xAC, 0xC9, 0xFA, 0x64, 0xA0, 0xAC, 0xB2,
+    0x8E, 0x40, 0x89, 0x72, 0x04, 0x74, 0xA3, 0x6E, 0xAF, 0x46, 0x0A, 0x11, 0xCF, 0xE1, 0xF2, 0xA2,
+    0x55, 0x0E, 0x83, 0xB6, 0xC9, 0xC0, 0x82, 0xBC, 0x7B, 0xCB, 0x53, 0xEA, 0xA7, 0x2C, 0x9B, 0x60,
+    0x50, 0xD2, 0x0F, 0xE4, 0x3F, 0x6B, 0xE0, 0x44, 0x39, 0xEB, 0x98, 0xD4, 0x01, 0xBA, 0x01, 0x02,
+    0x71, 0x1A, 0x47, 0x04, 0x9D, 0x29, 0x2A, 0x96, 0x4B, 0x1D, 0xE9, 0xE6, 0x8A, 0x9B, 0x68, 0xBA,
+    0x9E, 0x88, 0xBA, 0x98, 0xA8, 0xAA, 0x27, 0xB2, 0xAA, 0x86, 0x32, 0xCA, 0xFB, 0x99, 0xB0, 0x5B,
+    0xCA, 0xCE, 0xA4, 0x9D, 0x69, 0x3B, 0x13, 0x77, 0xA6, 0xEE, 0xF6, 0xC4, 0x99, 0xBE, 0x33, 0x81,
+    0x67, 0x0A, 0xCF, 0x24, 0x9E, 0x69, 0x3C, 0x13, 0x79, 0xA2, 0x72, 0x43, 0x24, 0xF3, 0x56, 0x2A,
+    0x5E, 0x72, 0x18, 0xF9, 0x96, 0x58, 0x44, 0xFE, 0x87, 0x9A, 0xEC, 0xA7, 0xFF, 0x30, 0x19, 0x28,
+    0x2B, 0x9F, 0x75, 0x04, 0x6D, 0x4B, 0x94, 0xDB, 0x21, 0xA0, 0x1B, 0xD4, 0xED, 0xD5, 0x48, 0xA4,
+    0x1E, 0x87, 0xCB, 0x8B, 0x16, 0xE5, 0x30, 0x44, 0x02, 0xB2, 0x20, 0xEF, 0x9A, 0xC4, 0x53, 0x6A,
+    0x72, 0xCB, 0x66, 0xC0, 0xA0, 0xA4, 0x61, 0x20, 0xF7, 0xF3, 0x26, 0xC7, 0x48, 0x9C, 0x91, 0x12,
+    0x11, 0xD9, 0x00, 0xD9, 0x66, 0x75, 0x65, 0x9C, 0xD4, 0x75, 0x61, 0xE3, 0x88, 0xD3, 0x61, 0x52,
+    0xE3, 0xA6, 0x02, 0x32, 0x37, 0x29, 0x91, 0xC3, 0x49, 0xB5, 0xEB, 0x8E, 0xAC, 0x27, 0x2E, 0xC2,
+    0x41, 0xF2, 0x74, 0x14, 0xAD, 0xFF, 0x4A, 0x06, 0x92, 0x01, 0x44, 0xA4, 0xA7, 0x6C, 0x28, 0x6E,
+    0x9D, 0x92, 0x4A, 0x79, 0xD2, 0x80, 0x1A, 0x30, 0x50, 0x56, 0x94, 0x36, 0x5E, 0x2B, 0x09, 0xEC,
+    0x83, 0x81, 0xC2, 0xE6, 0x1D, 0x99, 0x83, 0xC0, 0x08, 0x87, 0x50, 0xD8, 0x28, 0xA6, 0x93, 0x90,
+    0x06, 0x18, 0xA1, 0x7C, 0x41, 0xC6, 0x54, 0x36, 0x28, 0xDF, 0x8A, 0x35, 0xD2, 0xCF, 0xC6, 0x05,
+    0xF9, 0xC4, 0x7E, 0xC9, 0x76, 0x5B, 0x45, 0xEE, 0xEC, 0xCB, 0x48, 0xD4, 0x72, 0xE6, 0x61, 0x99,
+    0x4E, 0x38, 0xF5, 0xDD, 0xAD, 0x02, 0x6A, 0x9B, 0xB2, 0x87, 0x7A, 0x28, 0xA4, 0x22, 0xB9, 0xF8,
+    0xAD, 0x3B, 0x03, 0x24, 0x1F, 0xF9, 0xB2, 0x82, 0x62, 0x2F, 0xF5, 0x90, 0xDE, 0xA9, 0x0C, 0x60,
+    0x7A, 0xF5, 0xC1, 0x21, 0x2A, 0x50, 0xCB, 0x86, 0xBA, 0xCA, 0xA4, 0xF5, 0xB9, 0xE3, 0x10, 0x63,
+    0x47, 0xB4, 0x4D, 0x46, 0x6D, 0x09, 0xE8, 0x1F, 0x0D, 0x14, 0x0D, 0x87, 0x65, 0x95, 0x7A, 0xF2,
+    0x1F, 0x3B, 0x4A, 0x38, 0x34, 0x28, 0x47, 0xFE, 0x4E, 0x4F, 0xE4, 0x39, 0x26, 0x26, 0x21, 0xF1,
+    0xC7, 0x0C, 0xA4, 0xBC, 0x03, 0x1E, 0x4D, 0x07, 0x40, 0xDD, 0xDE, 0x4C, 0x02, 0x07, 0xE0, 0xF7,
+    0x2B, 0x80, 0x0B, 0x00, 0x0F, 0x09, 0x40, 0x7D, 0x0B, 0xA0, 0xB5, 0xA7, 0x36, 0x20, 0x55, 0x2E,
+    0x8E, 0x16, 0xDD, 0xB7, 0xD4, 0x95, 0xEE, 0x74, 0x67, 0x9A, 0xAC, 0x4F, 0x87, 0xC2, 0x2A, 0xC7,
+    0xA1, 0xEE, 0x93, 0x40, 0xF9, 0xA2, 0xE7, 0x90, 0xFC, 0x47, 0x01, 0x53, 0x29, 0xDF, 0xA2, 0x2D,
+    0x63, 0x69, 0x95, 0xA3, 0xCE, 0x1D, 0x81, 0xF2, 0x85, 0x80, 0x41, 0xDB, 0x16, 0xDD, 0xE5, 0x7D,
+    0xD1, 0xA5, 0x83, 0x72, 0x2A, 0x50, 0x2B, 0x4F, 0x5B, 0xE9, 0x77, 0x06, 0xB4, 0x4F, 0x64, 0x20,
+    0x91, 0xCB, 0x66, 0x80, 0x42, 0x44, 0x56, 0x8E, 0x5A, 0xBE, 0x2D, 0x3D, 0x3C, 0xC0, 0x83, 0x44,
+    0x5D, 0x41, 0x11, 0x20, 0xBB, 0x75, 0xEA, 0x3D, 0x6A, 0xC4, 0x67, 0x4E, 0xBF, 0xE8, 0x0C, 0x21,
+    0x7B, 0xDB, 0x67, 0x5D, 0xF1, 0x92, 0x2D, 0xD9, 0x5F, 0x10, 0x92, 0x8F, 0x06, 0xD5, 0xE7, 0x6F,
+    0x76, 0xBA, 0x31, 0x65, 0xB3, 0x48, 0xFC, 0x21, 0x41, 0xBF, 0x16, 0x94, 0x5B, 0x2B, 0x9F, 0xBD,
+    0xDF, 0xE5, 0x5E, 0x8F, 0xE4, 0x22, 0x1F, 0xFD, 0x37, 0x99, 0xDC, 0x11, 0xCB, 0x85, 0x38, 0xE5,
+    0xB8, 0x78, 0x3D, 0xA9, 0xC8, 0x86, 0xE2, 0xF6, 0xB3, 0x1B, 0xEA, 0x86, 0xBD, 0x64, 0x84, 0x5D,
+    0xE5, 0x61, 0x37, 0xEF, 0xE1, 0x39, 0x6D, 0xE3, 0x5E, 0x9B, 0x96, 0xDD, 0x30, 0x19, 0x90, 0xF1,
+    0xA9, 0xDD, 0x3E, 0x1D, 0x7D, 0x66, 0x1A, 0xC0, 0x74, 0xD0, 0x17, 0x03, 0x79, 0x97, 0xCB, 0x4A,
+    0x9A, 0x54, 0x64, 0x84, 0x4B, 0xD2, 0x03, 0x03, 0x93, 0xF1, 0xC8, 0x35, 0xA0, 0xF2, 0x4C, 0x9A,
+    0x50, 0x3A, 0xE0, 0xF7, 0x66, 0xCE, 0x91, 0x4E, 0x49, 0x50, 0xB7, 0x0E, 0x95, 0x4B, 0x52, 0x07,
+    0x03, 0xAC, 0x23, 0x23, 0x37, 0x64, 0x3D, 0xE9, 0x00, 0x87, 0x50, 0x5A, 0xBE, 0xE5, 0x52, 0x27,
+    0xDF, 0xF6, 0xA5, 0xB8, 0x54, 0x3A, 0x4E, 0x3A, 0x38, 0x07, 0x1A, 0xF5, 0x54, 0x93, 0x88, 0xC5,
+    0x44, 0x16, 0x2D, 0x44, 0x44, 0x4A, 0x11, 0x11, 0xB3, 0x6A, 0x57, 0x87, 0x0B, 0x0E, 0xD9, 0x39,
+    0xC7, 0x01, 0xE7, 0xCE, 0x31, 0x72, 0xEE, 0x31, 0x02, 0xCF, 0x45, 0xF6, 0x8E, 0x3C, 0xE2, 0x67,
+    0x6B, 0x4E, 0x39, 0x26, 0x69, 0x93, 0xF7, 0xB3, 0x18, 0x8C, 0xCA, 0xCF, 0x02, 0x45, 0x73, 0x17,
+    0x69, 0xEA, 0xCB, 0x90, 0xCB, 0x06, 0x4A, 0xD9, 0x40, 0x14, 0x4A, 0x91, 0x27, 0x03, 0x80, 0x07,
+    0x12, 0x07, 0x24, 0x3D, 0x40, 0xB3, 0xB5, 0xD2, 0x1E, 0x1A, 0xD2, 0x91, 0xDA, 0xD6, 0x43, 0x21,
+    0xA9, 0x74, 0x0F, 0x0E, 0x75, 0xAB, 0x6F, 0xF6, 0xC9, 0x47, 0xDE, 0x2C, 0xB2, 0x3E, 0xF9, 0xB8,
+    0x5B, 0x5C, 0xCB, 0xBB, 0xF4, 0x4E, 0x65, 0x5C, 0x6E, 0xD5, 0x86, 0xDA, 0x6A, 0xAB, 0x02, 0x6D,
+    0xA5, 0x9B, 0xCC, 0x23, 0x14, 0x55, 0xEE, 0x18, 0x29, 0xD1, 0x5D, 0x12, 0x99, 0x2D, 0xF5, 0x2C,
+    0x28, 0x1A, 0xE5, 0xD8, 0xBB, 0xBF, 0xAC, 0x94, 0x63, 0xBD, 0x53, 0x92, 0xF5, 0x6C, 0x82, 0x21,
+    0xEF, 0x90, 0x61, 0x81, 0xB6, 0x1C, 0x3E, 0x0F, 0xC0, 0x99, 0x6B, 0x77, 0xB9, 0x15, 0xD3, 0x21,
+    0x9A, 0xB0, 0x51, 0x14, 0x4D, 0xFB, 0x09, 0x68, 0xC5, 0x1A, 0x79, 0x57, 0x06, 0x25, 0x43, 0xE1,
+    0xC9, 0x06, 0x5A, 0xD8, 0x47, 0x79, 0xB4, 0xA5, 0x6C, 0xA2, 0xB0, 0x39, 0x00, 0xDD, 0x15, 0x0D,
+    0x1C, 0x2A, 0x07, 0xCA, 0xAD, 0x01, 0x73, 0xB1, 0x82, 0x44, 0x7A, 0x40, 0x87, 0x2D, 0xBF, 0x44,
+    0xA9, 0x72, 0xC0, 0x56, 0xBB, 0x04, 0x20, 0xCA, 0xC5, 0x49, 0x28, 0x36, 0x40, 0x2B, 0x1D, 0x14,
+    0x32, 0xCE, 0x9E, 0x4D, 0xC0, 0x7C, 0x4B, 0xAA, 0xDC, 0x5D, 0xEC, 0x09, 0x49, 0xC0, 0x60, 0xD0,
+    0x56, 0x77, 0xAA, 0x4F, 0x87, 0xD4, 0xB1, 0xCF, 0x80, 0x6E, 0x76, 0x51, 0x6E, 0x11, 0x2D, 0x23,
+    0x53, 0x54, 0xE4, 0x3F, 0x68, 0xA2, 0xB9, 0xD5, 0x5A, 0x28, 0x6D, 0x94, 0x06, 0xCA, 0x4D, 0x77,
+    0x5C, 0x00, 0x45, 0x15, 0x55, 0x6D, 0x76, 0x0B, 0x0A, 0xE9, 0x38, 0xB9, 0xBC, 0xF0, 0x57, 0x9B,
+    0x6D, 0x00, 0xCA, 0x4B, 0x77, 0xCF, 0xF6, 0xF7, 0xE5, 0x06, 0xE4, 0x22, 0x0E, 0x1E, 0xDC, 0x3C,
+    0xBD, 0xA5, 0xE7, 0x5F, 0x6A, 0xB6, 0xCF, 0x1E, 0x9F, 0x6D, 0xFE, 0x99, 0xB3, 0x2D, 0x8F, 0xCF,
+    0xB6, 0xB6, 0x9C, 0x6A, 0x6F, 0xA0, 0x44, 0x2C, 0xCF, 0x7C, 0x74, 0xE1, 0x17, 0xCC, 0x16, 0x2D,
+    0x83, 0x16, 0x47, 0x2D, 0xD6, 0x48, 0x43, 0xE1, 0xD1, 0x3D, 0x94, 0x36, 0x7A, 0x54, 0x55, 0xDE,
+    0x03, 0x6D, 0xB4, 0x4E, 0x82, 0xEA, 0x81, 0x74, 0x30, 0x00, 0xEA, 0xE7, 0x0E, 0x20, 0x97, 0xC8,
+    0x2A, 0x91, 0x63, 0x8C, 0x05, 0x50, 0x51, 0xC4, 0x9A, 0x3A, 0xBA, 0xAF, 0x23, 0x40, 0x79, 0x3E,
+    0x00, 0xA9, 0x57, 0x1E, 0x28, 0x9A, 0xCC, 0x41, 0x12, 0xD0, 0x1D, 0x68, 0x4B, 0x61, 0x49, 0x46,
+    0x30, 0x0D, 0xAD, 0x54, 0x85, 0x0C, 0x99, 0x8C, 0x88, 0xF4, 0xC7, 0x55, 0x4E, 0x94, 0xF0, 0x51,
+    0x25, 0x52, 0x44, 0x2A, 0xED, 0x46, 0x87, 0x33, 0x6E, 0xF4, 0x53, 0xF3, 0xA6, 0xAA, 0xAB, 0x64,
+    0x54, 0x62, 0xF3, 0x51, 0xDD, 0xEC, 0xCB, 0x7F, 0x43, 0xE6, 0xF6, 0x89, 0x06, 0x73, 0x72, 0xDB,
+    0x01, 0x62, 0x81, 0xB6, 0x9A, 0x45, 0x96, 0x54, 0x90, 0x4A, 0x03, 0xD9, 0x0F, 0x2C, 0xE8, 0xA7,
+    0xBA, 0xE7, 0x59, 0x64, 0x1F, 0xFA, 0xDF, 0x0E, 0x4A, 0x9C, 0x71, 0xA9, 0x38, 0x63, 0x19, 0xDD,
+    0x09, 0xF8, 0xB7, 0xDD, 0x76, 0x17, 0xBB, 0xD9, 0x4A, 0xCA, 0xBB, 0x23, 0x8B, 0x2D, 0x13, 0x91,
+    0x17, 0x64, 0x93, 0x8B, 0xC8, 0x8B, 0x12, 0xF4, 0x8D, 0xCD, 0xD5, 0xAA, 0x6E, 0xF4, 0xE3, 0x83,
+    0xAE, 0x0C, 0x3A, 0xF5, 0x05, 0x06, 0xAD, 0xDC, 0x23, 0xEC, 0x73, 0xBF, 0x72, 0x5F, 0xE2, 0x20,
+    0x4E, 0x66, 0x32, 0x4A, 0x27, 0x0B, 0x27, 0x1E, 0x92, 0x61, 0x76, 0x99, 0x29, 0x9A, 0x68, 0x9A,
+    0x56, 0xB3, 0x8D, 0x33, 0x1D, 0xB2, 0x1E, 0xF6, 0xE3, 0x4F, 0xF7, 0xE3, 0x4F, 0x0F, 0xB6, 0x57,
+    0x28, 0x1A, 0x92, 0xCD, 0x72, 0x59, 0x5F, 0xA6, 0x14, 0x11, 0x11, 0xEA, 0x78, 0x60, 0x2B, 0x99,
+    0x66, 0x6A, 0xCE, 0x87, 0x49, 0x89, 0xC7, 0x25, 0x4C, 0x26, 0x9D, 0xDF, 0x40, 0xB2, 0x5C, 0x4E,
+    0x4C, 0x59, 0x8B, 0xE3, 0x93, 0x8F, 0x53, 0x42, 0xEA, 0xEA, 0x40, 0x61, 0x9F, 0x71, 0xEC, 0x47,
+    0x01, 0x34, 0x1D, 0x26, 0x7B, 0xD3, 0x90, 0x77, 0xF3, 0x21, 0x60, 0xD0, 0x3D, 0x81, 0xB6, 0xCA,
+    0xFA, 0x7C, 0xFD, 0xA5, 0xA2, 0x39, 0xF8, 0xC0, 0xD5, 0x17, 0xDF, 0x90, 0x46, 0x42, 0xF1, 0xFF,
+    0xA6, 0xD2, 0xEC, 0xBC, 0x4A, 0x85, 0xEA, 0x66, 0xEB, 0x73, 0x31, 0x0F, 0xAD, 0xB0, 0x5B, 0xDF,
+    0x9A, 0x5A, 0x6C, 0x2D, 0x6F, 0x8A, 0xCF, 0x65, 0xC8, 0x3C, 0xB9, 0x67, 0x1F, 0x0E, 0xC9, 0x7B,
+    0x74, 0xC7, 0x08, 0x01, 0x6D, 0xD1, 0x96, 0x40, 0x12, 0x28, 0x2C, 0x65, 0x93, 0x04, 0x94, 0x47,
+    0xF7, 0x18, 0x68, 0x6F, 0xB4, 0x0E, 0x25, 0xB2, 0x81, 0x5C, 0xBE, 0xDD, 0x6D, 0xE9, 0xA1, 0xED,
+    0xD6, 0xC6, 0x29, 0x1B, 0x20, 0xF5, 0x5B, 0x03, 0x22, 0xF3, 0x40, 0x2E, 0x23, 0xA4, 0x22, 0xDD,
+    0xF6, 0xB4, 0xE2, 0xE8, 0xB4, 0xF2, 0xC8, 0x4E, 0x3F, 0x77, 0xCC, 0xD9, 0x4F, 0xA5, 0x4A, 0x7C,
+    0x3B, 0x60, 0x92, 0x8B, 0x55, 0xD6, 0x27, 0x9E, 0x3D, 0x4A, 0x72, 0xAB, 0x1C, 0x01, 0x43, 0x61,
+    0x95, 0xCB, 0x06, 0xCC, 0xFB, 0x52, 0x25, 0x72, 0xC7, 0x91, 0xFE, 0xB1, 0x99, 0xAF, 0xB2, 0x7F,
+    0x3F, 0xE4, 0xEF, 0xF4, 0xB0, 0x09, 0xA0, 0xC5, 0x42, 0xBB, 0x0B, 0x49, 0x66, 0x27, 0x21, 0x9D,
+    0xDB, 0x69, 0xE1, 0xCA, 0x6A, 0x6B, 0x9D, 0xFF, 0xB2, 0x54, 0x39, 0x9D, 0x04, 0x0A, 0xEB, 0xCA,
+    0x26, 0x09, 0x8F, 0x28, 0x8F, 0xFE, 0x71, 0x67, 0xA0, 0xDD, 0x1C, 0xA7, 0x4A, 0x0F, 0x59, 0x33,
+    0x02, 0xAF, 0x6A, 0x0B, 0xF9, 0xF9, 0x00, 0x7C, 0xFF, 0x33, 0xA8, 0x32, 0x40, 0x2A, 0x93, 0x53,
+    0xFF, 0x99, 0xF3, 0xAD, 0x02, 0xE6, 0xE1, 0xC2, 0xAA, 0x0F, 0xDF, 0x18, 0x30, 0x32, 0xCD, 0x37,
+    0xB9, 0x66, 0x20, 0x7B, 0xA2, 0x87, 0xEF, 0xEF, 0xDF, 0xC7, 0xE9, 0xFC, 0x1D, 0x3B, 0xCF, 0x17,
+    0x68, 0x27, 0x0F, 0xD6, 0x88, 0x03, 0x2D, 0x1E, 0xB8, 0xD4, 0xCD, 0xBB, 0x2D, 0xAA, 0xA6, 0xB0,
+    0x35, 0x39, 0xCA, 0x06, 0xD0, 0xDD, 0x12, 0xD4, 0x9F, 0x4B, 0x20, 0xFA, 0x26, 0xF5, 0x7B, 0x85,
+    0xA7, 0x6C, 0xD8, 0xA0, 0x3B, 0x4C, 0xA3, 0x5C, 0xD4, 0x91, 0xCA, 0xB1, 0x0F, 0x81, 0xB2, 0xA1,
+    0x46, 0x77, 0x51, 0x98, 0xE7, 0x5D, 0x12, 0x50, 0x3E, 0x17, 0xA7, 0xE5, 0x87, 0x12, 0x72, 0x71,
+    0x3C, 0x08, 0xB4, 0x1E, 0xB4, 0x54, 0xD3, 0x0D, 0xCD, 0x2C, 0x7B, 0x0E, 0x66, 0x76, 0x09, 0x80,
+    0x6E, 0x6A, 0x9B, 0x78, 0xB3, 0xA1, 0xD4, 0x37, 0x9D, 0xFA, 0x79, 0x6F, 0x58, 0x5C, 0x53, 0x7D,
+    0x76, 0x93, 0x3D, 0x5A, 0x9B, 0x5B, 0xED, 0x09, 0x08, 0xBA, 0xD1, 0x36, 0xF1, 0x49, 0xA0, 0xA4,
+    0xAC, 0x94, 0x53, 0x8E, 0xC5, 0x7D, 0x86, 0xEC, 0xED, 0x3F, 0xED, 0x69, 0xC3, 0x01, 0xB9, 0x68,
+    0x4B, 0xDD, 0x1C, 0xE1, 0x22, 0xD1, 0x24, 0x6D, 0x00, 0x11, 0x0F, 0xD9, 0xF8, 0x6C, 0x74, 0x6B,
+    0x36, 0xBA, 0xAA, 0xA1, 0x35, 0x04, 0x68, 0xF7, 0xD2, 0x01, 0xDA, 0x3D, 0xE5, 0xE0, 0x70, 0x3F,
+    0xEF, 0x61, 0x34, 0x37, 0x7F, 0xBA, 0x5C, 0x06, 0x2D, 0x22, 0x12, 0x92, 0x56, 0x44, 0x7C, 0xA4,
+    0x4D, 0xD4, 0x2F, 0x93, 0x18, 0x9D, 0x9E, 0x9B, 0x59, 0x56, 0x7F, 0x99, 0xB2, 0x23, 0x71, 0x68,
+    0x1F, 0xBD, 0xD3, 0x2B, 0x52, 0x91, 0x8A, 0x04, 0xA0, 0x96, 0x06, 0x48, 0x8E, 0x06, 0x95, 0x6F,
+    0x20, 0x91, 0x0D, 0x94, 0x55, 0x20, 0xF1, 0xCA, 0x3D, 0xA0, 0x1B, 0x7D, 0xBD, 0x5B, 0x33, 0x6A,
+    0xD5, 0xEB, 0x7E, 0xAF, 0x7C, 0x7C, 0xC3, 0x38, 0xB6, 0x36, 0x11, 0x79, 0x8F, 0xA4, 0x7D, 0x6F,
+    0x66, 0x96, 0x40, 0x82, 0xF2, 0xAC, 0xC9, 0x6F, 0xB5, 0x1D, 0x5A, 0x02, 0x14, 0x52, 0x1D, 0x21,
+    0x00, 0x9F, 0x98, 0xF0, 0x26, 0x4E, 0x38, 0x89, 0x13, 0x96, 0x63, 0x13, 0x3E, 0xFC, 0xD5, 0x4F,
+    0x58, 0x0D, 0x47, 0x06, 0xD0, 0xF4, 0xDC, 0x03, 0x28, 0x7B, 0xEC, 0xB9, 0xBA, 0x47, 0x10, 0x7E,
+    0x8E, 0xA4, 0x39, 0xE2, 0x39, 0xDD, 0x00, 0x3B, 0xB3, 0xF7, 0xAF, 0x2C, 0xF0, 0x05, 0x80, 0x33,
+    0xD3, 0xD6, 0x10, 0xA9, 0xB8, 0x34, 0x01, 0x11, 0x7E, 0x8B, 0x64, 0xCC, 0xD0, 0x83, 0x89, 0x3C,
+    0x3A, 0x01, 0x12, 0x33, 0x12, 0x51, 0x44, 0x98, 0xE2, 0xD8, 0x49, 0x49, 0x80, 0x56, 0xAA, 0x7C,
+    0x6B, 0x7A, 0x1C, 0x3D, 0xEE, 0x8F, 0x87, 0x1D, 0x1E, 0x66, 0x02, 0x36, 0xCF, 0x4D, 0xE6, 0xE0,
+    0x64, 0x26, 0x62, 0x26, 0x1D, 0x1D, 0x47, 0xFD, 0x29, 0x8F, 0x89, 0x7D, 0x2E, 0xA0, 0x07, 0x6A,
+    0x69, 0xF2, 0x80, 0x1E, 0x69, 0xA5, 0x32, 0x01, 0x2D, 0x64, 0x1E, 0x09, 0x9C, 0x28, 0x9A, 0xAC,
+    0x57, 0xC3, 0x19, 0xC8, 0x6D, 0xDE, 0xC5, 0x4D, 0xDE, 0x69, 0x5B, 0x54, 0x40, 0xEA, 0xB4, 0x8D,
+    0x80, 0xB7, 0xD3, 0x4D, 0xBC, 0xE9, 0xB5, 0xE2, 0x85, 0xA8, 0x8B, 0x76, 0xCB, 0x27, 0xA2, 0x7D,
+    0x2A, 0x12, 0xB1, 0xD8, 0x74, 0xC2, 0x13, 0xC8, 0xFC, 0x7E, 0x14, 0x8C, 0xBA, 0xDB, 0xCB, 0x5C,
+    0x5C, 0xFA, 0x03, 0xE5, 0x01, 0x84, 0x90, 0x06, 0x20, 0x1D, 0xA3, 0x3B, 0x4C, 0x3E, 0x24, 0x03,
+    0x2D, 0x50, 0xF6, 0x69, 0x84, 0xAD, 0x5A, 0x9B, 0x3A, 0x8C, 0x25, 0x15, 0x94, 0x43, 0x3B, 0x74,
+    0xA0, 0x96, 0x2A, 0x0F, 0x94, 0x3D, 0x22, 0xA4, 0x9B, 0x99, 0x75, 0xCF, 0xDC, 0x35, 0xD7, 0x14,
+    0x20, 0xB5, 0x69, 0xF4, 0xEF, 0xA3, 0x1A, 0x0D, 0x51, 0xA9, 0x96, 0x3F, 0xF3, 0x71, 0x80, 0x71,
+    0xE4, 0x27, 0x3F, 0x49, 0xAC, 0x74, 0xE4, 0x51, 0x72, 0x9F, 0x89, 0xD5, 0x68, 0x51, 0xEF, 0x0F,
+    0xB9, 0xD5, 0x37, 0x5F, 0xE8, 0x8C, 0x72, 0xBA, 0xE2, 0x42, 0x7E, 0x7D, 0xC8, 0x1B, 0x48, 0x3E,
+    0x1C, 0x73, 0x0B, 0xEC, 0xDE, 0xCC, 0x3A, 0xE0, 0xEC, 0xCF, 0xDE, 0x70, 0x40, 0xFE, 0xE1, 0x4F,
+    0xA2, 0xEB, 0xF2, 0xF1, 0x9F, 0x01, 0x89, 0x37, 0x3F, 0xA8, 0x80, 0xA1, 0x78, 0xA7, 0x07, 0xD6,
+    0x79, 0x3F, 0x50, 0xB1, 0xAB, 0x9C, 0xE1, 0xD5, 0x7F, 0x76, 0x80, 0xCF, 0xFF, 0x75, 0x30, 0x23,
+    0xBB, 0xC8, 0x90, 0x07, 0xCE, 0x52, 0xF8, 0x38, 0x8B, 0xEA, 0x97, 0x01, 0x4E, 0x0F, 0x01, 0xC3,
+    0xFE, 0x31, 0x8C, 0xDD, 0x1C, 0x01, 0xA7, 0x63, 0x51, 0x01, 0x46, 0xC6, 0xE8, 0x74, 0xF5, 0x90,
+    0xF7, 0xF9, 0x06, 0x94, 0xC7, 0x58, 0x08, 0xA8, 0x01, 0x6A, 0x68, 0xA1, 0x68, 0x28, 0x2C, 0x79,
+    0x4F, 0xE6, 0x50, 0x9E, 0x24, 0x40, 0x80, 0x1A, 0x6A, 0x28, 0x6D, 0x2A, 0x42, 0xDE, 0xA7, 0x22,
+    0x76, 0x82, 0xD5, 0xC3, 0x31, 0xCB, 0xE5, 0x10, 0xD0, 0xE7, 0x05, 0x50, 0xD1, 0xA4, 0x89, 0x7C,
+    0x7B, 0x7A, 0xC6, 0x1D, 0x4E, 0x6D, 0x28, 0xBF, 0x25, 0x4D, 0xE9, 0x9E, 0xE9, 0xCB, 0x90, 0xF8,
+    0xA2, 0x62, 0x57, 0x57, 0x94, 0x99, 0x45, 0xBF, 0xD8, 0xA1, 0x7E, 0xE4, 0x48, 0xEE, 0x48, 0x47,
+    0x2B, 0x23, 0xA6, 0x32, 0x56, 0x37, 0x6A, 0xC8, 0x7A, 0xEA, 0xD4, 0xA3, 0xED, 0x1A, 0xE5, 0x0C,
+    0x04, 0xDD, 0x6C, 0xAD, 0x65, 0x6D, 0xE3, 0xFE, 0x57, 0x8E, 0xC7, 0x94, 0xA7, 0xBC, 0xE9, 0xC9,
+    0xC4, 0xC1, 0xEF, 0x37, 0x33, 0xCE, 0xD3, 0xA1, 0x44, 0x24, 0xC0, 0xA9, 0x5B, 0xCF, 0x0E, 0x40,
+    0x89, 0x01, 0x94, 0xCB, 0x1C, 0xB0, 0xE0, 0x10, 0xC8, 0xAC, 0xEE, 0x80, 0xF5, 0xA4, 0x33, 0xB4,
+    0x85, 0xC4, 0x27, 0xF1, 0xE4, 0xB2, 0x01, 0xD5, 0x2B, 0x0F, 0xEC, 0x61, 0x00, 0x6D, 0x33, 0x07,
+    0xF8, 0x18, 0x88, 0x89, 0x1E, 0x4B, 0x4F, 0x60, 0xD2, 0xE2, 0x94, 0x55, 0x12, 0x50, 0x4F, 0x3A,
+    0xCA, 0x86, 0x3A, 0xA0, 0x06, 0x72, 0x21, 0x93, 0x40, 0x6D, 0x11, 0xB1, 0x54, 0xB3, 0x08, 0x8B,
+    0xEA, 0x71, 0xB2, 0x10, 0xA2, 0xEE, 0x9E, 0x62, 0x47, 0x3A, 0x5A, 0x28, 0x97, 0x8F, 0x76, 0xA9,
+    0x84, 0x49, 0x9D, 0x17, 0x2F, 0x3A, 0x58, 0x28, 0x07, 0xBB, 0xAA, 0x07, 0x9F, 0x75, 0x24, 0x2E,
+    0xEF, 0x48, 0x7B, 0x6D, 0x51, 0x9D, 0xB6, 0x64, 0xB6, 0x68, 0xC8, 0x9B, 0xB2, 0x42, 0x57, 0x25,
+    0x94, 0x98, 0x2F, 0xFC, 0x9D, 0x05, 0xA6, 0x34, 0x81, 0xFA, 0xD0, 0x78, 0xEA, 0xD1, 0x74, 0x98,
+    0xF5, 0x49, 0x38, 0x71, 0x6D, 0x36, 0xE0, 0xD2, 0x7E, 0x16, 0x60, 0xBA, 0x3A, 0x92, 0x2B, 0x7F,
+    0x55, 0x8C, 0x36, 0xFC, 0x2A, 0x31, 0x5A, 0x6D, 0xC9, 0xC5, 0x93, 0xF5, 0xE4, 0x12, 0x22, 0x1C,
+    0x70, 0x64, 0x27, 0xEF, 0x1F, 0x0F, 0xBD, 0xB9, 0xA8, 0x54, 0xEA, 0x29, 0x0E, 0x14, 0x0F, 0x7C,
+    0xEF, 0x98, 0x6D, 0xAC, 0x7E, 0x26, 0x96, 0xF0, 0x8C, 0x63, 0x3F, 0x19, 0x28, 0xAB, 0x3D, 0x72,
+    0x5B, 0xA2, 0x9C, 0xB6, 0x0C, 0xEA, 0xF6, 0xEA, 0x20, 0x11, 0x91, 0xEA, 0x70, 0x79, 0xD1, 0x9A,
+    0xF9, 0xC3, 0x9E, 0xBD, 0xC4, 0x53, 0xB2, 0x46, 0x5B, 0x83, 0xEA, 0x75, 0x83, 0x9F, 0xDC, 0x9C,
+    0x32, 0xAE, 0xDB, 0x89, 0xDC, 0x92, 0x7D, 0xAB, 0x47, 0x89, 0x83, 0xD6, 0xC1, 0xE9, 0xCB, 0x7F,
+    0xDB, 0xC1, 0xEE, 0x26, 0xA2, 0xB0, 0x51, 0x51, 0x44, 0x69, 0x3C, 0x73, 0x68, 0x72, 0xB7, 0x1B,
+    0x72, 0x30, 0xEB, 0x1B, 0x00, 0xEE, 0xE3, 0xAF, 0x0F, 0x76, 0x67, 0x6F, 0xBD, 0x36, 0x81, 0xDD,
+    0x87, 0xC1, 0x90, 0x8A, 0x1B, 0xC8, 0x6E, 0x36, 0x93, 0xA5, 0x9E, 0xF6, 0x80, 0x9E, 0x79, 0x34,
+    0x6B, 0x80, 0xAF, 0x7E, 0xEE, 0x4E, 0x46, 0xFF, 0x4B, 0x3B, 0x19, 0x0F, 0xC9, 0x00, 0x4A, 0xA4,
+    0x9A, 0x76, 0x6E, 0x74, 0x75, 0xF7, 0x00, 0x32, 0xBB, 0xC5, 0xCD, 0x32, 0x00, 0xBE, 0x3C, 0xDB,
+    0x1D, 0x23, 0xD9, 0x0F, 0xA5, 0x51, 0xEE, 0x99, 0x2E, 0x19, 0x12, 0xCF, 0x1E, 0x6B, 0xCA, 0x08,
+    0x8C, 0xD8, 0xCC, 0x29, 0x97, 0x0D, 0xC8, 0xD5, 0x91, 0x42, 0x5A, 0x58, 0xCD, 0xB2, 0x2C, 0xF1,
+    0x13, 0xAD, 0x0D, 0x50, 0x4F, 0xC1, 0xA8, 0xBA, 0x3A, 0x82, 0x07, 0xD2, 0x1E, 0x78, 0x75, 0xF6,
+    0x67, 0xA2, 0x43, 0xEF, 0xA0, 0x1D, 0x51, 0xE2, 0x48, 0x64, 0x00, 0xE3, 0x51, 0xD2, 0x80, 0xF1,
+    0x64, 0x52, 0xC1, 0xFE, 0x80, 0x6E, 0x2B, 0x38, 0x18, 0x28, 0x0C, 0x30, 0x04, 0x16, 0x06, 0x12,
+    0x1F, 0x58, 0x1B, 0x48, 0x5D, 0xC0, 0x1B, 0x50, 0xEE, 0x20, 0x75, 0x06, 0x54, 0x7F, 0xA0, 0x3A,
+    0x03, 0x99, 0xDD, 0xCF, 0xED, 0x3E, 0x68, 0x6B, 0x34, 0xFB, 0xA0, 0x1B, 0xB3, 0x60, 0x1F, 0x8A,
+    0xCA, 0xEC, 0x72, 0x08, 0x25, 0xA5, 0xE7, 0x00, 0x0C, 0xA5, 0xE3, 0x00, 0xF6, 0x28, 0x3A, 0x0E,
+    0x60, 0x1D, 0xC9, 0x4F, 0x40, 0x43, 0x98, 0x9C, 0xC3, 0x91, 0x52, 0x2C, 0x14, 0xE2, 0x6A, 0xB1,
+    0xC7, 0x6D, 0x93, 0x29, 0x00, 0x50, 0x36, 0x77, 0x45, 0xCE, 0x67, 0x57, 0x78, 0x82, 0x8B, 0xA3,
+    0xE3, 0x39, 0xAB, 0xF1, 0x68, 0x93, 0x06, 0x68, 0x2B, 0x2D, 0x96, 0xD6, 0x52, 0x78, 0xEA, 0x9E,
+    0xAC, 0x65, 0xE1, 0x48, 0xDE, 0xB7, 0x8F, 0xEC, 0xC2, 0x3F, 0x75, 0xBA, 0x84, 0x73, 0x3B, 0xF9,
+    0xD7, 0x1A, 0xB4, 0x7E, 0xF1, 0x7A, 0x47, 0x76, 0xFD, 0xC7, 0x6F, 0x39, 0x92, 0x7E, 0x70, 0xBB,
+    0xF0, 0x6A, 0xF9, 0x6A, 0x09, 0xE7, 0xF2, 0xA0, 0x2D, 0x8F, 0xA4, 0xA3, 0xEA, 0x7F, 0xA4, 0xAB,
+    0x96, 0x61, 0x5F, 0x6C, 0x81, 0x39, 0x94, 0x2E, 0x6B, 0xB4, 0x5C, 0xEA, 0x92, 0x2A, 0xBD, 0x63,
+    0x2B, 0xE0, 0xDF, 0xE9, 0x8F, 0xF9, 0xE2, 0x11, 0x9B, 0x3B, 0x77, 0x6C, 0x3F, 0xDC, 0x7F, 0xDC,
+    0x5A, 0x50, 0x22, 0x94, 0xD2, 0x50, 0x36, 0x71, 0x7B, 0xC7, 0x9D, 0xB7, 0x1F, 0xA1, 0xB5, 0xBB,
+    0x90, 0x80, 0x74, 0x38, 0x8E, 0x1E, 0x64, 0x3D, 0x1C, 0x1E, 0x47, 0x1C, 0x92, 0x01, 0xCA, 0x86,
+    0x52, 0xAC, 0x9E, 0x21, 0xFC, 0xF8, 0xF8, 0x35, 0x40, 0x57, 0x59, 0x05, 0x79, 0xA7, 0x2C, 0xA4,
+    0x43, 0xD6, 0x03, 0xF5, 0xCD, 0x1E, 0xC8, 0xA4, 0xFB, 0x84, 0x01, 0x73, 0xE2, 0x18, 0x6D, 0x23,
+    0x0A, 0x54, 0x78, 0x00, 0x3D, 0x02, 0xE4, 0xEF, 0x36, 0x80, 0x7A, 0x27, 0x22, 0x27, 0x11, 0x14,
+    0x35, 0x00, 0x43, 0xDE, 0x01, 0xBB, 0xE9, 0x00, 0x2C, 0xA8, 0x81, 0x12, 0x6D, 0x41, 0x37, 0xCA,
+    0x41, 0x7E, 0x63, 0x35, 0xC6, 0x30, 0x4A, 0x83, 0xBA, 0xBD, 0xBA, 0xEA, 0x48, 0xB6, 0xE6, 0x82,
+    0x89, 0x33, 0xED, 0x30, 0xA0, 0x06, 0xCA, 0x0A, 0x84, 0x76, 0xE4, 0x94, 0x84, 0x56, 0x1A, 0x35,
+    0x03, 0x1E, 0xC0, 0x7D, 0xA4, 0x36, 0x6D, 0x08, 0x3C, 0x8F, 0xB6, 0x05, 0xB4, 0xDF, 0xE9, 0xA2,
+    0x29, 0x96, 0x5C, 0x38, 0x36, 0x81, 0x6C, 0x93, 0x37, 0xA9, 0x6C, 0x1C, 0xF2, 0xAC, 0x50, 0x36,
+    0xBA, 0xCF, 0x1C, 0x6B, 0x02, 0xDA, 0x16, 0x0D, 0x43, 0xEA, 0x28, 0x2A, 0x83, 0x72, 0x59, 0x4F,
+    0xCD, 0x3E, 0xBA, 0xCF, 0xBB, 0x74, 0xC3, 0x21, 0xFF, 0x7D, 0xF7, 0x87, 0xAE, 0xDC, 0x79, 0xB4,
+    0xBE, 0x79, 0xFD, 0xE6, 0x75, 0x71, 0xC6, 0x15, 0x83, 0x1A, 0x78, 0x60, 0x22, 0xC7, 0x44, 0x93,
+    0x00, 0x94, 0x9D, 0x00, 0xDA, 0x19, 0x0B, 0x89, 0xCF, 0xED, 0x27, 0x08, 0x58, 0x1D, 0xF3, 0x38,
+    0x42, 0xD4, 0xCA, 0x15, 0x33, 0x36, 0xCE, 0xC1, 0x00, 0xB0, 0x63, 0x00, 0xCA, 0x88, 0x43, 0x3F,
+    0x11, 0x9D, 0x84, 0x03, 0x20, 0xB3, 0xD1, 0x8E, 0xC8, 0x1C, 0xA4, 0x8E, 0x00, 0x0C, 0x18, 0xE0,
+    0x70, 0x75, 0xB5, 0x03, 0x23, 0x32, 0x80, 0x59, 0xAD, 0x04, 0x8A, 0x8A, 0xC2, 0xA2, 0x2D, 0x2A,
+    0x86, 0xEE, 0xC6, 0xC8, 0x1B, 0x4D, 0xEA, 0x41, 0xBB, 0x5C, 0x3A, 0x2E, 0xC9, 0x9B, 0x32, 0x60,
+    0xC4, 0x91, 0x54, 0x27, 0xA1, 0x55, 0x1E, 0xED, 0xEA, 0x8A, 0x31, 0x73, 0x24, 0x3C, 0x70, 0xCF,
+    0xB0, 0x7F, 0x05, 0x64, 0x4B, 0x67, 0xB8, 0xAA, 0x9D, 0x0C, 0xFA, 0x54, 0x6E, 0x5C, 0x71, 0x13,
+    0x2D, 0xAE, 0x01, 0xDC, 0x71, 0x3C, 0x0A, 0x10, 0x02, 0x39, 0xC0, 0x7A, 0xD2, 0xCC, 0x7B, 0xD3,
+    0x1E, 0x5F, 0x4C, 0x7B, 0xDE, 0x4C, 0x40, 0x76, 0xC9, 0x46, 0x1C, 0x50, 0x54, 0xB5, 0x04, 0xA0,
+    0xA8, 0xCA, 0xD5, 0x1F, 0x03, 0xFA, 0xC6, 0xD5, 0xE8, 0x27, 0xC4, 0x00, 0x24, 0xF9, 0x8D, 0x55,
+    0x00, 0xC8, 0x3A, 0x0E, 0xA1, 0x42, 0xF5, 0x94, 0x15, 0xCF, 0xA1, 0x1C, 0xDA, 0xB2, 0x43, 0xEA,
+    0x50, 0x8E, 0x92, 0x74, 0x20, 0x1D, 0x97, 0x57, 0x6D, 0x26, 0x5D, 0x2E, 0x22, 0x9D, 0x12, 0x9F,
+    0x4F, 0x41, 0xCC, 0x09, 0x0C, 0x69, 0x6A, 0x4F, 0x21, 0x77, 0x24, 0xD0, 0xFE, 0x91, 0x34, 0x07,
+    0x69, 0x60, 0x9F, 0x3D, 0xE5, 0x08, 0x84, 0x88, 0x06, 0x14, 0x8D, 0x72, 0xB9, 0x2B, 0x51, 0xAE,
+    0xB6, 0x86, 0xFC, 0xFD, 0x91, 0x7D, 0xB4, 0x74, 0xEC, 0x53, 0x7A, 0x38, 0xA0, 0xB6, 0x70, 0x88,
+    0x74, 0x7C, 0xB9, 0x55, 0x3F, 0x74, 0x89, 0xAF, 0xAF, 0xBE, 0x38, 0x5E, 0xEA, 0xCD, 0x26, 0x15,
+    0xA9, 0x0A, 0x4F, 0x3B, 0x90, 0xC0, 0xC9, 0xE3, 0x2B, 0xD1, 0x81, 0xE7, 0xB9, 0xC9, 0x4D, 0x2B,
+    0xEC, 0x02, 0x94, 0x6C, 0x00, 0xF3, 0x49, 0xCF, 0x4E, 0x89, 0xC8, 0x80, 0x88, 0x6C, 0x38, 0xB5,
+    0x59, 0xB5, 0x15, 0x07, 0xA8, 0x0E, 0x03, 0x0E, 0x6D, 0x79, 0x2C, 0xAA, 0xE9, 0x74, 0xD8, 0x4A,
+    0xC9, 0x18, 0x91, 0xBC, 0xD1, 0x36, 0x64, 0x22, 0x1D, 0xE9, 0x66, 0xF5, 0xCA, 0xF1, 0x6F, 0x0A,
+    0x1B, 0xF5, 0x55, 0x42, 0x3A, 0xA0, 0x2C, 0x23, 0x89, 0xC3, 0xC0, 0x40, 0xF1, 0x2F, 0x57, 0x23,
+    0xAD, 0x88, 0xD0, 0xCE, 0x5E, 0x5A, 0xDC, 0x91, 0x5F, 0xE4, 0x7E, 0x16, 0x7C, 0x95, 0x9A, 0x6B,
+    0x98, 0xF7, 0x1D, 0x5A, 0x1A, 0x92, 0xA7, 0x8F, 0xB1, 0x95, 0x54, 0x18, 0xB1, 0x84, 0xBC, 0x53,
+    0x7D, 0xD6, 0xE5, 0x36, 0xEF, 0x74, 0x53, 0xD8, 0x92, 0x16, 0x93, 0x05, 0xEA, 0xB6, 0xA7, 0x1E,
+    0x23, 0x8E, 0x7B, 0x10, 0xB3, 0x4F, 0xA8, 0x29, 0x2A, 0xF3, 0xAF, 0x37, 0x94, 0x32, 0x90, 0x4B,
+    0xC3, 0x51, 0xA4, 0x2B, 0x95, 0x01, 0x4A, 0x91, 0x0A, 0x79, 0xB9, 0xED, 0x52, 0x8F, 0x76, 0xA9,
+    0x8D, 0x46, 0x48, 0x7A, 0x14, 0xA5, 0x19, 0xEF, 0x79, 0xCA, 0x44, 0x24, 0x68, 0x11, 0x09, 0xE5,
+    0xCB, 0xCB, 0x67, 0x82, 0x01, 0xE5, 0x0D, 0x11, 0x4F, 0xD6, 0xDD, 0x3E, 0x94, 0x76, 0x1F, 0x6A,
+    0x0C, 0xE9, 0x88, 0xE9, 0x0A, 0x87, 0x16, 0x69, 0xE2, 0xCD, 0x8E, 0x56, 0xA6, 0x1C, 0xC9, 0x65,
+    0xA4, 0x7D, 0x26, 0xA8, 0x4E, 0xB9, 0xFB, 0xC8, 0x3B, 0x28, 0x2B, 0x4E, 0x8D, 0xA4, 0xE2, 0x69,
+    0xDF, 0xB5, 0x65, 0x6F, 0xD2, 0x90, 0x0C, 0x65, 0xA3, 0x6D, 0x60, 0x5F, 0xB9, 0xCC, 0xE9, 0xAE,
+    0x8D, 0x59, 0x33, 0x23, 0xC7, 0xE4, 0x48, 0x32, 0x64, 0x3D, 0x2A, 0x68, 0x87, 0x1A, 0x8A, 0x9E,
+    0xB4, 0xD7, 0xCD, 0x27, 0x9C, 0xC8, 0xBF, 0xA1, 0x79, 0x9E, 0xE4, 0x02, 0xE6, 0x7C, 0xA0, 0x7D,
+    0x22, 0x70, 0xA8, 0x3C, 0x0F, 0x70, 0xB7, 0x83, 0x9B, 0x4B, 0x45, 0x2B, 0x5D, 0x3A, 0x5E, 0x74,
+    0xAA, 0x53, 0x2E, 0x25, 0xF5, 0xD1, 0xFE, 0x79, 0xC8, 0x93, 0x8A, 0xA7, 0xFC, 0xD8, 0xA5, 0x1B,
+    0xE5, 0x72, 0x97, 0xF5, 0x65, 0xA3, 0xAD, 0xA1, 0x68, 0x0C, 0x35, 0xE6, 0xF1, 0x40, 0x29, 0x8E,
+    0x5C, 0x2A, 0xB8, 0xD7, 0x65, 0x2E, 0xAB, 0x49, 0x5F, 0xD5, 0x2F, 0x4C, 0xFC, 0xDD, 0x3E, 0x31,
+    0x7D, 0xB2, 0x37, 0xAB, 0xF4, 0xFF, 0xFF, 0x81, 0x11, 0x0F, 0x44, 0xA6, 0x2F, 0x6D, 0x34, 0x39,
+    0x5D, 0x5D, 0x1D, 0xA5, 0x2E, 0x71, 0x26, 0xF9, 0x74, 0x90, 0x06, 0x28, 0xBB, 0xB4, 0xA3, 0xAD,
+    0xEA, 0x80, 0x43, 0xDC, 0xA2, 0x6D, 0xD6, 0x6C, 0x86, 0x47, 0x95, 0x33, 0x78, 0x4E, 0xB2, 0x36,
+    0xCD, 0x35, 0xA0, 0x28, 0xBB, 0x35, 0x90, 0xFD, 0x0B, 0xB7, 0x07, 0xA4, 0x7F, 0xB6, 0x1B, 0xE3,
+    0xC0, 0x67, 0x63, 0xD4, 0xF7, 0x6B, 0xFB, 0x3D, 0x50, 0x3C, 0x11, 0x3C, 0xA0, 0xBF, 0x39, 0x2E,
+    0x80, 0xDC, 0x1E, 0xEA, 0xE6, 0x04, 0x99, 0x35, 0xCA, 0xE5, 0x4F, 0x5D, 0xE9, 0x74, 0x75, 0x78,
+    0xE9, 0xBA, 0x74, 0x99, 0xD5, 0xD2, 0xB4, 0x36, 0xED, 0x13, 0xA9, 0x92, 0x23, 0xE3, 0x01, 0x92,
+    0x21, 0xEF, 0x90, 0x6C, 0xA0, 0x7E, 0x61, 0x44, 0x37, 0x3B, 0x77, 0x0F, 0xF2, 0x21, 0xE9, 0x31,
+    0x22, 0xE8, 0x9F, 0x5E, 0x72, 0xAA, 0x4B, 0x42, 0xE2, 0x30, 0xD5, 0xF3, 0xE4, 0xDD, 0xFD, 0x28,
+    0x37, 0xD9, 0xD6, 0x23, 0x24, 0x9B, 0x88, 0x0A, 0x18, 0x69, 0x38, 0x79, 0x69, 0x98, 0xA2, 0x3D,
+    0xBA, 0x9F, 0x24, 0xDA, 0xA1, 0x06, 0xF3, 0x94, 0xA5, 0xB8, 0x3E, 0x50, 0x74, 0xED, 0x5B, 0x75,
+    0xAF, 0x45, 0x3A, 0xDA, 0x59, 0x62, 0x9C, 0xE4, 0x02, 0x21, 0x77, 0xB9, 0x33, 0xB6, 0x6C, 0xC6,
+    0x7B, 0x79, 0xB9, 0xDC, 0x90, 0x89, 0x60, 0xCE, 0x8F, 0x49, 0x97, 0x0C, 0x09, 0x59, 0x44, 0xD1,
+    0x52, 0xCF, 0x69, 0x01, 0xB3, 0x81, 0xE5, 0x26, 0x0E, 0x45, 0xB9, 0xFF, 0x90, 0xE2, 0x75, 0xC7,
+    0x46, 0xF7, 0x85, 0x2B, 0x65, 0x43, 0x29, 0x97, 0x23, 0x0B, 0x16, 0x22, 0x1B, 0x4A, 0x11, 0xC1,
+    0xAC, 0x56, 0x23, 0x0B, 0x94, 0xE7, 0x1C, 0xBA, 0xE3, 0x79, 0x4C, 0xC5, 0x97, 0x63, 0x4A, 0x8B,
+    0x9F, 0x2D, 0x57, 0xD3, 0x00, 0xF5, 0x00, 0xFC, 0x56, 0x54, 0x8A, 0x0D, 0x31, 0x98, 0x19, 0xC5,
+    0xEE, 0xF4, 0xF4, 0x05, 0x28, 0x1B, 0x03, 0x75, 0x65, 0x9A, 0x64, 0x83, 0x79, 0xEF, 0xE2, 0x80,
+    0x16, 0xE9, 0x48, 0x65, 0x33, 0x6F, 0xD3, 0x56, 0xC4, 0x29, 0x11, 0xB1, 0xC5, 0xCB, 0xCB, 0x91,
+    0x6B, 0xE8, 0x5E, 0x59, 0x0E, 0xF9, 0xB7, 0x62, 0x40, 0xF6, 0x70, 0x76, 0xCF, 0xEA, 0xD9, 0x0E,
+    0x31, 0x3D, 0x20, 0x03, 0x70, 0xD1, 0x03, 0xB9, 0xDB, 0x0E, 0xA9, 0xE2, 0x28, 0x43, 0x07, 0x6D,
+    0xEF, 0x8F, 0x19, 0x40, 0x99, 0x4B, 0x47, 0xDA, 0x4A, 0x89, 0xF8, 0x49, 0xF5, 0xFC, 0xDE, 0x5D,
+    0xB4, 0x33, 0xD1, 0xC4, 0xD4, 0x31, 0x46, 0x9E, 0x2C, 0x97, 0x9F, 0xC5, 0x8D, 0x48, 0xF4, 0x1A,
+    0x8D, 0x74, 0x4A, 0x36, 0x24, 0x6D, 0x45, 0xEE, 0xA1, 0xAC, 0x66, 0x5F, 0x33, 0x8D, 0xBE, 0x66,
+    0x2A, 0x90, 0x84, 0x18, 0xF4, 0x3C, 0x8C, 0xE9, 0x61, 0xA6, 0x52, 0x1F, 0x0E, 0xA0, 0xAD, 0xEA,
+    0x47, 0x50, 0x4E, 0xF5, 0x06, 0x92, 0xA0, 0xFA, 0xC2, 0xC2, 0xA1, 0xEA, 0xF3, 0x1E, 0xCC, 0x93,
+    0x5D, 0xEA, 0x41, 0xBF, 0xD1, 0x31, 0x42, 0xF6, 0x71, 0x87, 0x81, 0x44, 0x3A, 0x8A, 0x18, 0x2A,
+    0xCE, 0x7B, 0x30, 0x76, 0x0B, 0xAA, 0x4E, 0x28, 0x6A, 0x5D, 0x51, 0x4A, 0x97, 0xCA, 0x86, 0x52,
+    0x5C, 0x22, 0x52, 0xFD, 0x6A, 0xE3, 0x63, 0x07, 0xF7, 0x15, 0xCD, 0xDA, 0xB9, 0xFA, 0xE2, 0x1B,
+    0x37, 0x1B, 0x09, 0x3A, 0xA4, 0xD2, 0x98, 0x86, 0xEA, 0x2E, 0xCC, 0x71, 0x92, 0x81, 0x45, 0xDF,
+    0x56, 0x40, 0xEE, 0x8D, 0x05, 0x12, 0x9F, 0x75, 0x9F, 0x45, 0xD7, 0x5F, 0x08, 0x14, 0xB4, 0x11,
+    0x28, 0x68, 0x23, 0x50, 0xD0, 0x46, 0x07, 0x7F, 0x13, 0x89, 0x1E, 0x22, 0x50, 0x30, 0x44, 0x30,
+    0x61, 0x88, 0x60, 0xC2, 0x10, 0x41, 0x80, 0x21, 0x1D, 0x40, 0xBF, 0xE5, 0x39, 0x00, 0xF5, 0x81,
+    0xC7, 0x54, 0x24, 0xA3, 0x8F, 0x80, 0x83, 0x8F, 0x40, 0x41, 0xCC, 0x78, 0xD2, 0xEE, 0x17, 0x01,
+    0x05, 0x1D, 0x70, 0xE1, 0x24, 0x14, 0xF6, 0x10, 0x44, 0x0D, 0xA4, 0x83, 0xB6, 0x24, 0xC7, 0x2D,
+    0xEA, 0xD9, 0x3B, 0xCB, 0x5F, 0x13, 0x47, 0x9D, 0x5C, 0xBC, 0x87, 0x92, 0x04, 0x0C, 0x59, 0x4F,
+    0xA0, 0xAC, 0xE6, 0x83, 0x23, 0x60, 0x1A, 0xE5, 0xD2, 0x91, 0xA2, 0x39, 0xEB, 0xBF, 0xBC, 0x9F,
+    0xFE, 0xFC, 0xFA, 0x6B, 0x63, 0x5D, 0x1C, 0x2A, 0x71, 0xC6, 0xE5, 0x1B, 0x36, 0x24, 0xC7, 0x95,
+    0xCC, 0x41, 0xEA, 0x20, 0x1B, 0xCA, 0x6E, 0xB6, 0xDC, 0x3F, 0x43, 0xA9, 0x94, 0xD2, 0x4D, 0x31,
+    0xFE, 0x44, 0x5E, 0xAE, 0x1D, 0x45, 0x4F, 0xD1, 0x27, 0x23, 0x94, 0x56, 0xF7, 0x60, 0x9A, 0x16,
+    0x68, 0x95, 0x83, 0x34, 0x94, 0x16, 0x32, 0x37, 0x02, 0xC5, 0x75, 0x07, 0xD4, 0x85, 0x85, 0x34,
+    0xB4, 0x80, 0xFE, 0x71, 0x00, 0xCC, 0x53, 0x0E, 0x92, 0x50, 0x5A, 0xD0, 0x7D, 0x0D, 0xD4, 0x8C,
+    0xA0, 0xBC, 0x0A, 0x60, 0x9A, 0x6C, 0x20, 0x0B, 0xE4, 0xE3, 0x49, 0x69, 0xC8, 0x63, 0xA4, 0x24,
+    0x82, 0x9F, 0x0F, 0x44, 0xE5, 0x76, 0x92, 0x34, 0xE8, 0x0E, 0xC9, 0x3C, 0xE6, 0x7C, 0xF8, 0xA4,
+    0xA9, 0x9E, 0x49, 0x83, 0x96, 0x80, 0x7E, 0xAF, 0xB6, 0xBA, 0x53, 0x3E, 0xEF, 0x19, 0x33, 0x47,
+    0xF9, 0x82, 0x27, 0xEF, 0x03, 0xA9, 0xAF, 0x61, 0x2C, 0x1A, 0x4C, 0xDE, 0x53, 0xBC, 0x30, 0xA0,
+    0xBB, 0x43, 0xF2, 0xBE, 0xB0, 0x99, 0x53, 0x21, 0x77, 0xD4, 0xE2, 0xA2, 0xE3, 0x77, 0xDC, 0xE8,
+    0x6C, 0xA5, 0x82, 0x52, 0xC4, 0x92, 0x6D, 0x96, 0x62, 0xA9, 0x1B, 0xEA, 0x26, 0xF3, 0x50, 0x63,
+    0x2A, 0xD8, 0xA4, 0x01, 0xD2, 0xA0, 0x2D, 0x64, 0xEE, 0x10, 0x28, 0xAE, 0x7B, 0xA0, 0x2E, 0x6E,
+    0xAC, 0x56, 0x57, 0x42, 0x2D, 0x22, 0xF2, 0xE1, 0xB8, 0x5C, 0x2E, 0xEB, 0x3F, 0xEC, 0x81, 0xB1,
+    0x6C, 0x20, 0x73, 0x2D, 0x50, 0x7E, 0x33, 0x40, 0x12, 0x32, 0x0F, 0xBA, 0xD3, 0x0E, 0x36, 0x14,
+    0x3D, 0x85, 0xA3, 0xF4, 0xD9, 0x06, 0x4A, 0x89, 0xE9, 0x12, 0x7E, 0x9B, 0xC3, 0x15, 0xB7, 0x5B,
+    0x47, 0x29, 0x9E, 0x4D, 0x1A, 0x94, 0xE7, 0x30, 0xEF, 0x30, 0xBA, 0xC1, 0x94, 0x60, 0xCC, 0x6A,
+    0xD5, 0xD6, 0x22, 0x9B, 0xFD, 0xE5, 0xF2, 0x60, 0x0D, 0x61, 0x4D, 0x32, 0x1C, 0xA0, 0x5C, 0x8D,
+    0xEE, 0x4C, 0x53, 0x57, 0x85, 0x8C, 0x64, 0x31, 0xF7, 0xEA, 0xF3, 0x63, 0x81, 0xC2, 0xEA, 0xEE,
+    0x2E, 0x16, 0x48, 0x42, 0x9C, 0xE1, 0x08, 0x14, 0x6F, 0xDC, 0x5E, 0xAD, 0x56, 0x52, 0x88, 0x88,
+    0x84, 0x76, 0xB9, 0x5C, 0x5E, 0xFC, 0xF1, 0x00, 0x98, 0xA7, 0xFA, 0x99, 0x05, 0xF2, 0xC8, 0x02,
+    0xC9, 0xA7, 0xB0, 0x40, 0xF2, 0xA9, 0x2C, 0xC0, 0x85, 0x93, 0x24, 0x21, 0xEF, 0x11, 0x35, 0x60,
+    0xAA, 0xF0, 0xC9, 0x4D, 0x73, 0x4A, 0x3A, 0x72, 0x19, 0xD1, 0x7D, 0x69, 0x75, 0x97, 0x0E, 0x79,
+    0x87, 0x51, 0x3D, 0xFA, 0x75, 0x87, 0x72, 0x9B, 0xD5, 0x2A, 0xD4, 0x22, 0x9B, 0xE2, 0xE5, 0xE5,
+    0xA5, 0xA7, 0x2C, 0xFA, 0x75, 0x47, 0xD6, 0x1F, 0xA0, 0x5C, 0x61, 0x95, 0x57, 0x43, 0xE6, 0xA9,
+    0xC5, 0x47, 0x2A, 0x1D, 0xB1, 0x40, 0xEA, 0xF3, 0x2E, 0x12, 0x29, 0xF7, 0xA5, 0x45, 0xF5, 0xC5,
+    0x27, 0x6C, 0x8C, 0x87, 0x64, 0x80, 0x56, 0xA4, 0x42, 0xFE, 0x48, 0x2C, 0x03, 0x85, 0x4B, 0x1C,
+    0x99, 0x4F, 0x1C, 0x6A, 0xA0, 0x8B, 0xA6, 0x69, 0x72, 0xFC, 0xE9, 0xD4, 0xEA, 0x4A, 0x20, 0x17,
+    0x09, 0x9C, 0xFA, 0x27, 0xCF, 0x6C, 0xD3, 0xB2, 0x32, 0x47, 0x54, 0xE3, 0x14, 0xF6, 0x1C, 0x98,
+    0x66, 0x0D, 0xC2, 0x86, 0x2C, 0xD0, 0xBE, 0x55, 0x3B, 0x8C, 0x48, 0x15, 0x51, 0xEC, 0x48, 0x8E,
+    0x93, 0x5C, 0x48, 0x42, 0xDE, 0x6B, 0x67, 0x9A, 0xB2, 0x09, 0x9C, 0xB9, 0x5B, 0x91, 0x17, 0x1B,
+    0x94, 0x08, 0xE6, 0xFC, 0x26, 0xE9, 0x93, 0x90, 0xA2, 0x1C, 0x93, 0x6D, 0x7E, 0x6A, 0x35, 0x62,
+    0xC4, 0xB3, 0xBC, 0x68, 0xA3, 0x90, 0x1A, 0x7E, 0x03, 0xFD, 0x9A, 0xE3, 0x30, 0xF7, 0xB9, 0x2B,
+    0x64, 0x43, 0x21, 0xDD, 0x71, 0x51, 0x91, 0x89, 0x00, 0xA5, 0x04, 0xE0, 0xC1, 0xE5, 0x85, 0x4F,
+    0x32, 0x88, 0x96, 0x21, 0x95, 0xD1, 0x48, 0xA7, 0xC5, 0x15, 0x9E, 0x74, 0xA0, 0x6C, 0xD0, 0x96,
+    0x1A, 0x0E, 0x20, 0xA0, 0x7A, 0x94, 0xC7, 0x40, 0xDE, 0x27, 0x1E, 0x0A, 0xAB, 0x1B, 0x30, 0xAC,
+    0x81, 0x83, 0xAC, 0x83, 0x64, 0x58, 0x00, 0xEA, 0x03, 0x07, 0xE8, 0x1F, 0x54, 0x40, 0x39, 0x30,
+    0x61, 0x77, 0x93, 0x11, 0x1F, 0x63, 0x94, 0x25, 0xA0, 0x1E, 0x77, 0x40, 0x29, 0x15, 0x20, 0x1E,
+    0x48, 0xE4, 0x78, 0xD2, 0x7D, 0x1C, 0x61, 0x2B, 0x6E, 0x7A, 0xFA, 0x94, 0xC7, 0x25, 0x9B, 0x04,
+    0xC4, 0xB1, 0xE1, 0x59, 0xC7, 0x21, 0xCA, 0xB3, 0x4F, 0x12, 0xD8, 0x83, 0xC0, 0x2E, 0x04, 0xD6,
+    0xB0, 0x87, 0x87, 0xFD, 0xC4, 0xC1, 0x42, 0xF5, 0xB0, 0xC8, 0x2C, 0x18, 0xDD, 0x80, 0x29, 0x80,
+    0xB3, 0x3B, 0xC0, 0xD9, 0x6B, 0x80, 0x71, 0x33, 0x1C, 0x64, 0xAA, 0x19, 0x40, 0x1F, 0x26, 0x70,
+    0xF3, 0xB9, 0xBA, 0x82, 0x76, 0x04, 0xA4, 0x07, 0xBE, 0x72, 0x5C, 0x54, 0xB9, 0xA2, 0x01, 0x63,
+    0x05, 0xD8, 0x64, 0x03, 0x9F, 0xEA, 0xED, 0x80, 0x91, 0x3E, 0x17, 0x2F, 0x52, 0x19, 0xB1, 0x75,
+    0x47, 0xDE, 0xC7, 0xEC, 0xD9, 0x24, 0x90, 0x7A, 0x94, 0x43, 0x37, 0xE8, 0x8E, 0x00, 0x65, 0x93,
+    0x75, 0x50, 0xB3, 0x00, 0x42, 0xEA, 0x20, 0xF5, 0x45, 0x05, 0x59, 0x3F, 0x00, 0xFA, 0x0D, 0x0B,
+    0x98, 0x1D, 0x80, 0xB6, 0xDF, 0x52, 0x2C, 0x9A, 0xE8, 0xF1, 0xB6, 0x6B, 0xE0, 0xFE, 0xDC, 0x32,
+    0x8D, 0x57, 0x49, 0x07, 0x64, 0x81, 0xBB, 0x4A, 0x0E, 0x2E, 0x44, 0xAC, 0x04, 0xC9, 0x3C, 0x8C,
+    0x99, 0xFB, 0x54, 0x83, 0xFB, 0x6F, 0x01, 0x71, 0x49, 0x9A, 0x74, 0x0E, 0x54, 0xA9, 0x31, 0x0B,
+    0x50, 0xF7, 0xAD, 0x25, 0x0F, 0x7A, 0x80, 0xBA, 0xDA, 0x00, 0x97, 0xD3, 0xE6, 0x6E, 0xB8, 0x60,
+    0x43, 0x2B, 0x5F, 0x13, 0xAF, 0x24, 0x64, 0xE3, 0x84, 0x85, 0x2B, 0x47, 0x61, 0x29, 0xAB, 0xE8,
+    0xE8, 0x33, 0xA2, 0x2D, 0xE9, 0xC0, 0x1E, 0x64, 0x4E, 0xF5, 0xA0, 0x6D, 0x09, 0x94, 0xE7, 0x3D,
+    0xB0, 0x1F, 0xD3, 0xC9, 0x77, 0x01, 0xF5, 0xF3, 0x6E, 0x0A, 0x98, 0x43, 0xE1, 0x8E, 0x42, 0xF4,
+    0xC3, 0x36, 0xEB, 0xBD, 0x5B, 0x03, 0xB9, 0x74, 0x5B, 0xE8, 0x22, 0xF2, 0xF9, 0xD6, 0xF0, 0xA9,
+    0x4E, 0x80, 0xEA, 0x17, 0x90, 0xBB, 0x16, 0xF4, 0x5B, 0x23, 0x98, 0x17, 0x3D, 0x1C, 0xE8, 0x0E,
+    0xBC, 0xAE, 0xE2, 0x19, 0x7F, 0xAB, 0x48, 0x5E, 0x56, 0x61, 0x56, 0x25, 0xED, 0x13, 0x01, 0xB2,
+    0xEE, 0x93, 0x62, 0xF2, 0x6F, 0x26, 0xEA, 0x70, 0x2C, 0x89, 0x27, 0xA9, 0x4E, 0x44, 0xBE, 0x2D,
+    0x3A, 0x21, 0x09, 0xBA, 0xE3, 0xE4, 0x3D, 0x11, 0x6E, 0x4A, 0x4F, 0xF1, 0x94, 0x34, 0xCA, 0x3D,
+    0xE8, 0xD9, 0xA7, 0xA8, 0xB2, 0x2E, 0x75, 0xAC, 0x31, 0x68, 0xAB, 0x5C, 0x12, 0x30, 0xD4, 0x8D,
+    0xDA, 0xB4, 0x3E, 0x46, 0x1C, 0xBE, 0xF2, 0xA2, 0x9B, 0x62, 0x8E, 0x59, 0xDF, 0xC0, 0xC1, 0x39,
+    0xD0, 0x37, 0xA7, 0x78, 0x43, 0x3E, 0xC4, 0x25, 0x35, 0x22, 0xD2, 0x68, 0x11, 0xE9, 0xB9, 0x74,
+    0xE3, 0x8A, 0x27, 0xEF, 0x58, 0x47, 0x8C, 0x8D, 0x40, 0x6E, 0xA9, 0x49, 0x3B, 0xCA, 0x86, 0x0B,
+    0xD1, 0xF3, 0xF8, 0x8C, 0xEC, 0x9F, 0xF9, 0x9B, 0x38, 0xD1, 0xFD, 0x4F, 0xFB, 0x66, 0x64, 0x4A,
+    0xD1, 0xCD, 0xA3, 0x83, 0xAE, 0xED, 0xF6, 0xAB, 0x61, 0x9B, 0x4B, 0x58, 0x6E, 0x6B, 0xB6, 0x92,
+    0x66, 0x8B, 0xA9, 0xF4, 0xA9, 0x48, 0xB3, 0xFF, 0x78, 0xC8, 0xE7, 0xD2, 0xA6, 0xB2, 0x41, 0x3B,
+    0xF2, 0x81, 0x6C, 0x20, 0x1D, 0x61, 0xC3, 0x04, 0xC4, 0x7F, 0xDF, 0x54, 0x85, 0x1A, 0x1F, 0xEA,
+    0x0B, 0xF9, 0x37, 0xB4, 0x7F, 0x6E, 0xB9, 0xB0, 0x13, 0xC3, 0x0A, 0x3B, 0x90, 0x75, 0x24, 0xC3,
+    0x36, 0x82, 0x78, 0x0C, 0x1A, 0xE9, 0x62, 0xFA, 0x60, 0xD1, 0xD7, 0x53, 0x3D, 0x59, 0x5B, 0x45,
+    0xB9, 0xB3, 0xC7, 0x67, 0x3F, 0x8C, 0x38, 0x94, 0x6C, 0x30, 0xD2, 0x91, 0x49, 0xE0, 0xD4, 0x08,
+    0xD4, 0x4D, 0x5C, 0x5D, 0x33, 0xC9, 0xAE, 0x29, 0x2A, 0xB0, 0xAD, 0x9A, 0x38, 0x9C, 0x32, 0x6F,
+    0xC7, 0x89, 0x2E, 0x01, 0xF4, 0xFF, 0x35, 0x45, 0x3D, 0x65, 0x24, 0x8D, 0x79, 0xE8, 0x36, 0xF5,
+    0x50, 0x36, 0xA5, 0x8B, 0x71, 0xC3, 0xCC, 0x47, 0x53, 0x5D, 0xF9, 0xCC, 0x41, 0x4D, 0x3A, 0xE4,
+    0x7D, 0xCC, 0x86, 0x8D, 0xA1, 0x43, 0xE5, 0xB4, 0x85, 0x91, 0xCC, 0x45, 0x57, 0xA9, 0xE8, 0x0A,
+    0x4B, 0x32, 0x2E, 0xDB, 0xAA, 0x6C, 0x28, 0x45, 0x42, 0x26, 0x81, 0x56, 0xA4, 0xB9, 0x3B, 0xBE,
+    0x70, 0x92, 0x0B, 0x44, 0x5B, 0x05, 0xED, 0x4C, 0x03, 0x65, 0x13, 0xE0, 0x5E, 0x1D, 0xBD, 0x65,
+    0x3A, 0xB2, 0xD7, 0xA5, 0x07, 0x93, 0x5C, 0xAA, 0xA6, 0x0D, 0xAB, 0x7A, 0xE5, 0xA0, 0xA8, 0x74,
+    0x05, 0x07, 0xEC, 0xFE, 0x7E, 0xA3, 0x5C, 0x2A, 0xD2, 0x69, 0xAB, 0x6F, 0xB5, 0x76, 0x9F, 0x1D,
+    0xCC, 0xE3, 0x3E, 0xF1, 0x1C, 0xE4, 0x36, 0xB7, 0xA9, 0x37, 0x94, 0x68, 0x1B, 0xBE, 0xBC, 0x66,
+    0x3F, 0xFB, 0xF1, 0x5B, 0x43, 0xE6, 0x0A, 0x51, 0x22, 0xB4, 0x4E, 0x49, 0x97, 0x6C, 0xE0, 0x02,
+    0x54, 0x7F, 0x35, 0x5E, 0xFC, 0xFA, 0xB8, 0x04, 0x23, 0x62, 0x39, 0xDD, 0xDE, 0x78, 0xE5, 0x97,
+    0xE4, 0xC5, 0x30, 0xE7, 0x14, 0xE6, 0x13, 0x46, 0xE4, 0xB7, 0xD1, 0x9E, 0x62, 0x2E, 0xFC, 0x4C,
+    0xA4, 0x03, 0xDA, 0x0E, 0x38, 0xFD, 0xD9, 0xBC, 0x58, 0x95, 0x4D, 0xF1, 0x35, 0x47, 0x3D, 0x90,
+    0x05, 0x52, 0xE9, 0xD9, 0xE8, 0xAA, 0x68, 0x50, 0x9E, 0x33, 0xA6, 0xCA, 0x9E, 0x18, 0xB3, 0xA1,
+    0x10, 0x69, 0xEA, 0xF1, 0x1A, 0x0F, 0xE4, 0x0D, 0xBC, 0x0A, 0x9A, 0xE4, 0xC9, 0x0E, 0x33, 0xA0,
+    0xC6, 0xAD, 0x75, 0xF2, 0x37, 0x9D, 0xFE, 0x5B, 0x4E, 0xE9, 0xBF, 0xD1, 0x9F, 0x18, 0xC9, 0x64,
+    0x9C, 0x33, 0x16, 0xA6, 0x9A, 0xC6, 0xF2, 0x58, 0xA0, 0xF8, 0x5C, 0xDE, 0x31, 0xA5, 0x5B, 0x6D,
+    0x43, 0x51, 0xE9, 0x77, 0xF9, 0x9C, 0xD2, 0x7F, 0x61, 0x91, 0x39, 0x7E, 0x3B, 0x28, 0x87, 0x71,
+    0xE9, 0x80, 0xB1, 0x49, 0xE0, 0xC4, 0xF1, 0x6C, 0xFE, 0x30, 0x09, 0xFD, 0xEC, 0xBC, 0x03, 0xFD,
+    0x7E, 0x0F, 0x5A, 0x1A, 0x48, 0xFF, 0xF8, 0x73, 0x22, 0xE6, 0x57, 0xAE, 0xDE, 0xFE, 0x1E, 0x24,
+    0x22, 0xE2, 0x21, 0x79, 0x56, 0x5E, 0xAE, 0xFE, 0x3A, 0xB9, 0xD4, 0x3E, 0xE6, 0x52, 0xDB, 0xCF,
+    0xA2, 0xCE, 0xDE, 0x27, 0xA8, 0xB3, 0x94, 0x97, 0x27, 0x18, 0x73, 0x29, 0x2F, 0x7F, 0x16, 0x75,
+    0x6E, 0xFB, 0x39, 0x39, 0x7A, 0x13, 0xB5, 0xED, 0xE9, 0xD5, 0xB1, 0xC7, 0x2B, 0xF0, 0xD8, 0x57,
+    0x1F, 0x79, 0x35, 0xEB, 0xF2, 0xAE, 0xF4, 0xFF, 0xD1, 0xFF, 0x9C, 0x36, 0xBF, 0xFC, 0x3F, 0xE0,
+    0x4B, 0x90, 0x57, 0xA4, 0x1D, 0x3C, 0x67, 0x24, 0xFC, 0x77, 0xCB, 0x6B, 0xDF, 0xA0, 0xFF, 0x86,
+    0x6A, 0xBE, 0xF1, 0x05, 0xBE, 0xF1, 0x00, 0xDF, 0xE0, 0xAF, 0xFE, 0x1F, 0xE0, 0x31, 0xE8, 0xC9,
+    0x1A, 0x1E, 0x01, 0x23, 0xE1, 0xEC, 0xF2, 0xBF, 0xCC, 0xB9, 0x3F, 0xB5, 0xF7, 0xF3, 0xFD, 0xFB,
+    0x79, 0xE0, 0x7E, 0xF8, 0xEB, 0xFC, 0xA7, 0x96, 0x1F, 0x8B, 0xBC, 0x21, 0x9B, 0xA3, 0x17, 0x0F,
+    0x2E, 0x97, 0xCB, 0x5A, 0x44, 0x6A, 0x11, 0x99, 0x89, 0xD3, 0x4A, 0x7C, 0xDC, 0x9E, 0xDE, 0xFF,
+    0xF1, 0x3F, 0x48, 0xFE, 0xB1, 0xD7, 0x6F, 0x76, 0xA6, 0xAC, 0xC2, 0x81, 0xFA, 0xF0, 0xF3, 0x7C,
+    0xF9, 0xC1, 0x85, 0x93, 0xD5, 0x72, 0xB9, 0x5C, 0x1A, 0x11, 0xB9, 0x19, 0x19, 0x6A, 0x56, 0x20,
+    0xF1, 0x83, 0x01, 0xE0, 0x94, 0x2B, 0xBB, 0xBA, 0x0A, 0x99, 0x2B, 0x19, 0x72, 0xBB, 0x9B, 0x34,
+    0x9C, 0x54, 0xA1, 0xFE, 0x96, 0xAB, 0x95, 0x2B, 0xF1, 0xB9, 0xDD, 0xA1, 0x3A, 0xE5, 0x8A, 0xAA,
+    0x7D, 0x22, 0x64, 0xDE, 0x58, 0x93, 0x86, 0xCC, 0x99, 0x6A, 0xAD, 0x9C, 0x6E, 0xF6, 0x52, 0xA7,
+    0x9B, 0xDD, 0xD4, 0x9D, 0xE2, 0x37, 0x38, 0xC9, 0x19, 0xED, 0xCC, 0x93, 0x43, 0xF9, 0x56, 0xD0,
+    0x7D, 0xAD, 0xBC, 0xB6, 0x87, 0xA9, 0xD3, 0xCD, 0x4E, 0xEA, 0x72, 0xBB, 0xC0, 0x67, 0xF6, 0xC4,
+    0x64, 0x4D, 0x1C, 0xCB, 0x4E, 0x54, 0x3D, 0xE8, 0x8A, 0x6A, 0xF7, 0xA4, 0x16, 0x09, 0x46, 0xC4,
+    0xFD, 0x74, 0xE7, 0x8B, 0x15, 0x2E, 0x66, 0x0B, 0x15, 0xD1, 0xF2, 0x9E, 0x4E, 0x62, 0x2F, 0x26,
+    0xDD, 0x6B, 0x0B, 0x8B, 0x88, 0xE5, 0x9E, 0xDA, 0x5A, 0xA9, 0xE3, 0xB4, 0x2F, 0xC3, 0x64, 0x8F,
+    0x79, 0x92, 0xC4, 0x3D, 0xA0, 0x63, 0x60, 0x23, 0x7C, 0xE1, 0xEF, 0xBD, 0xF5, 0x5D, 0x54, 0x17,
+    0xA5, 0xC9, 0xB4, 0x4D, 0xD0, 0x16, 0x8A, 0x8A, 0x33, 0x05, 0x55, 0xDB, 0xB6, 0x56, 0x44, 0xEC,
+    0xFF, 0xB3, 0xF3, 0x6C, 0xC3, 0xCE, 0x64, 0x0C, 0xAC, 0xE3, 0xE5, 0x92, 0x00, 0x7C, 0x17, 0xD2,
+    0xCB, 0x45, 0x30, 0xF1, 0x9F, 0xCF, 0x2F, 0xFF, 0x06, 0x98, 0x06, 0x33, 0x60, 0xA4, 0x31, 0x32,
+    0x18, 0xD9, 0x18, 0x19, 0x8D, 0x74, 0x66, 0xC4, 0x74, 0x31, 0x36, 0x49, 0x59, 0xCA, 0x66, 0x7C,
+    0x60, 0x92, 0x5B, 0x6B, 0x63, 0xCB, 0x77, 0x82, 0x0A, 0xA6, 0x32, 0x4D, 0x45, 0x45, 0xF1, 0xC3,
+    0x8D, 0xD4, 0x77, 0xF3, 0xFA, 0x63, 0x45, 0x78, 0xEE, 0xE4, 0xAF, 0x8C, 0xD7, 0xFD, 0x97, 0xCE,
+    0x5E, 0xB8, 0xFF, 0x73, 0xE4, 0x75, 0x2E, 0x50, 0x54, 0x59, 0xE0, 0xC6, 0x37, 0x1E, 0xFB, 0xC7,
+    0xFF, 0xFC, 0xF4, 0xE9, 0xEA, 0x95, 0x33, 0xA7, 0xE1, 0x15, 0xFE, 0x4A, 0x4F, 0xC0, 0x2B, 0x1D,
+    0xEA, 0x8D, 0x06, 0xFD, 0x05, 0x38, 0xF7, 0x58, 0x2B, 0xEE, 0xFD, 0xE5, 0x1F, 0x7C, 0xF5, 0x95,
+    0xEC, 0xA9, 0xD3, 0xC9, 0xDB, 0xF6, 0x95, 0xE7, 0xBE, 0x7F, 0xFA, 0xC4, 0x09, 0x5E, 0x81, 0xD3,
+    0xF0, 0xD7, 0x3D, 0x00, 0xF0, 0x8D, 0x57, 0x78, 0xF4, 0x1C, 0xF9, 0xD7, 0x48, 0xAF, 0x5B, 0xBE,
+    0x2F, 0xF2, 0x93, 0x6F, 0xBD, 0xFC, 0x3B, 0x5F, 0x78, 0x98, 0x57, 0x1E, 0x7B, 0xEE, 0x34, 0x3F,
+    0xEA, 0x5E, 0x49, 0x92, 0xCF, 0xE1, 0x46, 0xC7, 0xEF, 0x37, 0xC1, 0x33, 0xF9, 0x7B, 0x53, 0x02,
+    0x1C, 0x85, 0x34, 0x53, 0x31, 0x50, 0xF1, 0x82, 0x9B, 0x6A, 0x7D, 0x75, 0xB3, 0x43, 0x44, 0x6E,
+    0x73, 0xAB, 0x9B, 0x29, 0xE9, 0xB8, 0x53, 0x7D, 0x6C, 0xFF, 0x90, 0x38, 0x86, 0xA9, 0x40, 0x63,
+    0xCD, 0xCE, 0x94, 0x25, 0x52, 0x52, 0x4C, 0x99, 0xB8, 0xB9, 0xD5, 0xCD, 0x9A, 0xA7, 0xE1, 0xC1,
+    0xD4, 0x65, 0x76, 0x37, 0x15, 0x4B, 0xEB, 0xF6, 0xB3, 0x6E, 0x47, 0xDD, 0x0E, 0x6C, 0xDA, 0x5C,
+    0xBA, 0xB3, 0xCA, 0x15, 0xD5, 0x3A, 0xEB, 0xDA, 0xA6, 0x48, 0x9C, 0xEA, 0x77, 0x19, 0x40, 0x57,
+    0x03, 0xC3, 0x82, 0x45, 0xBC, 0xF9, 0x42, 0x57, 0xBA, 0x21, 0xB7, 0x05, 0xFA, 0x49, 0xAB, 0x7A,
+    0x32, 0x9B, 0x5B, 0xF5, 0xB6, 0xC3, 0xA3, 0xBA, 0xD4, 0xA5, 0x6E, 0x1D, 0xAD, 0xA1, 0x35, 0xBE,
+    0x8C, 0xA1, 0xF0, 0x82, 0x90, 0x75, 0x86, 0xC4, 0x13, 0xEF, 0x02, 0x03, 0xD4, 0x03, 0xC5, 0x06,
+    0x76, 0x63, 0x76, 0xC5, 0xD3, 0x77, 0x59, 0x72, 0x97, 0xF3, 0xCE, 0x9C, 0x9F, 0xA4, 0x43, 0xB3,
+    0x4E, 0x2C, 0xC0, 0xE5, 0xD3, 0x1C, 0xA8, 0xDE, 0x3C, 0x1E, 0x0A, 0xBB, 0xD1, 0x7D, 0x9D, 0x39,
+    0xF3, 0x84, 0x2F, 0xEC, 0xA0, 0xED, 0x5A, 0x75, 0x5F, 0x22, 0xE6, 0xC4, 0x5C, 0x3E, 0xCD, 0xEF,
+    0xA6, 0x5E, 0x37, 0x6B, 0xE5, 0x4B, 0x3B, 0x66, 0xCE, 0xBC, 0x10, 0x2F, 0x52, 0xD8, 0x31, 0x73,
+    0xE6, 0x7C, 0xD0, 0xDD, 0x42, 0xB9, 0xA2, 0x59, 0xAB, 0xAE, 0xE4, 0x1B, 0xAA, 0xF9, 0xD2, 0x54,
+    0x2C, 0x9D, 0x3A, 0xDD, 0x17, 0xD6, 0x34, 0x35, 0x23, 0x21, 0x71, 0xA9, 0x85, 0x5F, 0xE7, 0x77,
+    0x73, 0x5B, 0x54, 0x9B, 0x34, 0x64, 0xAE, 0xE8, 0x4C, 0xB3, 0x49, 0x82, 0x72, 0xBA, 0x2B, 0x1B,
+    0x43, 0x48, 0x9C, 0xEA, 0x72, 0xBE, 0x14, 0xEB, 0xAC, 0x7F, 0x37, 0x69, 0x4A, 0xF6, 0x92, 0x41,
+    0xF7, 0xA5, 0xAD, 0x93, 0x90, 0x79, 0xDD, 0x99, 0x66, 0x93, 0x86, 0xCC, 0x69, 0x6B, 0xAA, 0x31,
+    0x1D, 0x32, 0xA7, 0xAD, 0x61, 0x9D, 0x38, 0xD5, 0xE9, 0xE6, 0xAB, 0x7C, 0x83, 0x09, 0x74, 0x3F,
+    0x15, 0x1D, 0x8A, 0xBA, 0xA7, 0x78, 0xA9, 0xC9, 0xFA, 0x45, 0x32, 0x30, 0x9C, 0x45, 0x75, 0x24,
+    0x64, 0x5D, 0xDE, 0xEB, 0x5E, 0xF7, 0xBA, 0xCF, 0x5D, 0x1A, 0x30, 0x95, 0x72, 0x2C, 0x50, 0x1D,
+    0x67, 0x48, 0x60, 0x87, 0xC4, 0x93, 0x77, 0x98, 0x2A, 0x0D, 0x14, 0x56, 0x0D, 0x8C, 0x98, 0x4A,
+    0x5B, 0xD5, 0x6F, 0x41, 0xC9, 0x2F, 0x01, 0xE9, 0x75, 0x4B, 0x95, 0xF6, 0xE7, 0x18, 0xD2, 0x5E,
+    0xD9, 0x3A, 0xE9, 0xD9, 0xCD, 0xCF, 0x3B, 0x32, 0x9B, 0x38, 0x78, 0x1E, 0x07, 0x59, 0xE3, 0xA0,
+    0xBA, 0xE6, 0x20, 0xE4, 0xAE, 0xA8, 0x0C, 0x43, 0xDE, 0xE7, 0x8D, 0x54, 0x0E, 0x5E, 0xF5, 0xC0,
+    0xAB, 0x1A, 0xB8, 0x86, 0x83, 0x6B, 0x68, 0x78, 0x5E, 0x57, 0x8E, 0xE7, 0x33, 0x57, 0xB0, 0xCB,
+    0x90, 0xB8, 0x73, 0xC0, 0x23, 0x5F, 0x02, 0x12, 0xBB, 0x8D, 0x9A, 0x5E, 0x88, 0x1E, 0xDE, 0xC0,
+    0x06, 0x6D, 0x95, 0xA7, 0xA6, 0xB0, 0xE9, 0xC0, 0x61, 0x7C, 0x67, 0xD0, 0x96, 0x81, 0x05, 0x59,
+    0x97, 0x78, 0x4A, 0x72, 0xCB, 0x9A, 0x12, 0xD5, 0x33, 0xA0, 0x2B, 0xD5, 0x71, 0x0E, 0x4D, 0xE2,
+    0xD8, 0x25, 0x6B, 0x92, 0x9E, 0x87, 0xC9, 0x1A, 0x5E, 0xD9, 0x96, 0xB2, 0x03, 0xFC, 0xFB, 0x9C,
+    0xAA, 0xD2, 0x40, 0x8B, 0x76, 0x2A, 0x60, 0x2A, 0xDD, 0x71, 0x86, 0x13, 0x31, 0x1D, 0xB1, 0x16,
+    0x91, 0x9F, 0x2E, 0x97, 0xCB, 0x0B, 0xF5, 0xAD, 0x76, 0x53, 0x8F, 0x00, 0x7F, 0x67, 0x9B, 0x18,
+    0x17, 0xE6, 0x42, 0xAC, 0x6C, 0x5B, 0x35, 0x64, 0x66, 0xBC, 0x26, 0xF1, 0x33, 0x2E, 0x96, 0xDB,
+    0xB9, 0x64, 0x6C, 0x67, 0xF6, 0xD7, 0xE3, 0x8F, 0xB6, 0x19, 0xA9, 0x9F, 0xF2, 0xA3, 0x58, 0xFC,
+    0xBA, 0x75, 0xF2, 0x77, 0x8F, 0x46, 0xFB, 0x7B, 0xF0, 0xC5, 0x2A, 0x11, 0x47, 0x3D, 0x22, 0x82,
+    0x11, 0x6B, 0xAE, 0xF6, 0xFA, 0xFD, 0x70, 0x1F, 0x21, 0xAD, 0x0C, 0x94, 0x90, 0x59, 0x72, 0x4B,
+    0xE2, 0x50, 0x3D, 0x0C, 0x28, 0x07, 0x6B, 0x52, 0x0F, 0x07, 0xA8, 0xED, 0x73, 0xCC, 0xBC, 0x89,
+    0xCF, 0x07, 0x24, 0x0E, 0x76, 0x60, 0xFF, 0x15, 0x8A, 0xFF, 0x9B, 0x62, 0x40, 0x09, 0xE9, 0x27,
+    0x1D, 0xC6, 0xD3, 0x15, 0xC9, 0x65, 0x72, 0x37, 0x55, 0x7C, 0x23, 0x30, 0x82, 0xA9, 0x78, 0xE0,
+    0x08, 0x89, 0x4A, 0xAA, 0x53, 0x97, 0x21, 0x64, 0x62, 0x29, 0x1B, 0x11, 0x94, 0xD7, 0xEF, 0x0F,
+    0xD4, 0x34, 0xDA, 0xE6, 0x3D, 0xAC, 0x19, 0x21, 0xB7, 0xDA, 0xC2, 0xC0, 0x00, 0x86, 0xA2, 0x22,
+    0xEF, 0x52, 0x87, 0xF2, 0x94, 0x30, 0xA2, 0x7A, 0x0C, 0xEC, 0xA0, 0x2D, 0xCA, 0x26, 0x0E, 0xCE,
+    0x51, 0xFC, 0x31, 0x59, 0x93, 0x48, 0xC3, 0xF3, 0xE4, 0xFD, 0x51, 0xA9, 0x1D, 0x44, 0xE5, 0xF8,
+    0x5F, 0x51, 0x5A, 0x4A, 0xAB, 0x06, 0x54, 0xC0, 0x54, 0x98, 0x2A, 0x89, 0x21, 0xFB, 0x08, 0x80,
+    0x19, 0x4E, 0x5D, 0x46, 0x0D, 0x89, 0x38, 0xB4, 0xD5, 0xE2, 0xA8, 0x31, 0x57, 0xFB, 0x74, 0xA0,
+    0xD1, 0x56, 0xDB, 0x39, 0x67, 0x7A, 0xCD, 0x00, 0xAA, 0x8F, 0x11, 0xD5, 0x12, 0x52, 0xCF, 0x1A,
+    0x4C, 0x15, 0xE1, 0x51, 0x5D, 0x61, 0xE0, 0x1C, 0xCA, 0x91, 0x38, 0x0A, 0xC8, 0x1A, 0xF6, 0x5F,
+    0xE1, 0x61, 0x12, 0x69, 0x78, 0x65, 0x4A, 0x56, 0x39, 0xC6, 0x51, 0x7C, 0x97, 0x34, 0x90, 0x3B,
+    0xB4, 0xC3, 0x34, 0x98, 0x8A, 0x11, 0xCE, 0x1C, 0xD5, 0xB3, 0x9C, 0xBA, 0x45, 0xD2, 0x88, 0x54,
+    0x45, 0xFE, 0x53, 0x79, 0x7F, 0x38, 0xC7, 0x25, 0x69, 0x2E, 0x70, 0xEA, 0x95, 0x49, 0xD8, 0x54,
+    0x65, 0x35, 0xE4, 0x76, 0x5F, 0xF9, 0xD2, 0x8E, 0x79, 0x5F, 0xAB, 0xA1, 0xB4, 0xA3, 0xEE, 0x6B,
+    0xE5, 0xCB, 0xD7, 0x82, 0xEE, 0x6A, 0xE5, 0xCD, 0xF9, 0xA0, 0xBB, 0x7D, 0xD5, 0x9B, 0x24, 0x8A,
+    0xAA, 0x32, 0xF1, 0x19, 0x8F, 0x25, 0xF6, 0x0B, 0x77, 0x39, 0xF7, 0x23, 0x5A, 0x3A, 0xFD, 0x56,
+    0xC8, 0x6D, 0xA9, 0xBA, 0xEC, 0x75, 0x97, 0xB8, 0x81, 0xF5, 0x0E, 0x65, 0x81, 0xFE, 0x96, 0xCD,
+    0xDE, 0x76, 0xCA, 0xED, 0x25, 0x5E, 0xBF, 0x3D, 0xA4, 0x32, 0x50, 0x1E, 0x0F, 0x2E, 0x0C, 0x60,
+    0x1A, 0xB4, 0x47, 0xDD, 0x84, 0x8F, 0x1C, 0x3B, 0x67, 0xD1, 0x2F, 0x76, 0xAA, 0xDF, 0x61, 0xC8,
+    0xAC, 0x59, 0x6D, 0x5E, 0x14, 0x09, 0x27, 0x97, 0xB7, 0x40, 0xC7, 0xBA, 0xBD, 0x2F, 0xC6, 0x46,
+    0x1A, 0x62, 0xF3, 0x1B, 0xAF, 0xA8, 0x8E, 0xC4, 0x41, 0xDB, 0xF1, 0x5B, 0x9B, 0x68, 0xEE, 0x0C,
+    0xB0, 0x80, 0xA2, 0x42, 0x5B, 0x2E, 0xD9, 0x42, 0x1A, 0xB5, 0x39, 0xF2, 0xB3, 0x5B, 0x9B, 0xCA,
+    0x2B, 0x6A, 0x40, 0x79, 0x94, 0x23, 0xF9, 0xF3, 0xCB, 0x88, 0xB0, 0xF7, 0x8C, 0x2B, 0xD9, 0xCB,
+    0x1B, 0xFD, 0x44, 0xAF, 0xBA, 0x75, 0xEA, 0x8A, 0x17, 0x7C, 0x2A, 0x03, 0xE5, 0x7B, 0x53, 0x4D,
+    0xF5, 0x60, 0x24, 0xEC, 0x2C, 0x87, 0xE7, 0x53, 0xF7, 0x1F, 0x64, 0x16, 0x5D, 0xB1, 0x80, 0xF5,
+    0xC4, 0xF0, 0xB9, 0x45, 0x37, 0x94, 0xB0, 0xD8, 0x26, 0xD4, 0x02, 0xD9, 0x06, 0x7D, 0xB3, 0xD7,
+    0xCD, 0x5A, 0xD9, 0x12, 0xAF, 0x1B, 0xA3, 0xAD, 0x92, 0x26, 0x11, 0x9B, 0xF6, 0x21, 0x75, 0xBA,
+    0xF1, 0xCA, 0xED, 0x30, 0xE8, 0x66, 0x9D, 0xCA, 0x48, 0x31, 0x1C, 0x43, 0xD7, 0xC9, 0xC5, 0x65,
+    0xFD, 0xBE, 0xEA, 0x73, 0xEB, 0x13, 0xB7, 0xC3, 0x5A, 0x37, 0x65, 0x7A, 0xEB, 0x52, 0x53, 0x8A,
+    0xE5, 0x99, 0x1E, 0xE5, 0xC8, 0x1C, 0x0F, 0xB9, 0xB4, 0xED, 0x63, 0x6C, 0x1C, 0x1E, 0xB2, 0x21,
+    0xFF, 0x48, 0xAA, 0x9D, 0x9F, 0x75, 0xBA, 0xF3, 0x59, 0xBF, 0x9B, 0xBA, 0x92, 0x41, 0x57, 0xE7,
+    0x94, 0x2D, 0x92, 0x9F, 0x3F, 0xD5, 0xD4, 0xD7, 0xBB, 0xA2, 0x01, 0x38, 0x75, 0x99, 0x42, 0x28,
+    0x6E, 0xF6, 0x45, 0x13, 0xB4, 0x2D, 0xB3, 0x2E, 0xBB, 0x1E, 0x97, 0x68, 0x0F, 0x53, 0xA0, 0xFF,
+    0xD0, 0x66, 0xAF, 0x3B, 0xD5, 0xEF, 0xA7, 0x4E, 0xBF, 0xEF, 0x13, 0xF1, 0x9C, 0xBE, 0x0C, 0x49,
+    0x75, 0x2A, 0x64, 0xD2, 0x7C, 0xD1, 0x53, 0x90, 0x3A, 0x0C, 0xAA, 0x67, 0x2F, 0xCA, 0x3C, 0xDD,
+    0xE0, 0x69, 0x7B, 0x23, 0xE7, 0x97, 0x17, 0x38, 0x75, 0x81, 0x52, 0x30, 0x37, 0xFB, 0xA2, 0x0A,
+    0x79, 0x55, 0x12, 0x75, 0x2B, 0x79, 0x47, 0xDE, 0xA1, 0x3B, 0xB4, 0xA5, 0x68, 0x28, 0x2B, 0x4A,
+    0x91, 0x5C, 0xA4, 0x59, 0x2E, 0xE1, 0x54, 0x45, 0xEB, 0xD3, 0xDB, 0x41, 0xD9, 0xDD, 0x94, 0x5D,
+    0x18, 0xC8, 0x7A, 0x5A, 0x9B, 0x88, 0x23, 0xF5, 0x24, 0x9E, 0xD4, 0x91, 0xF5, 0x0F, 0xB6, 0xB6,
+    0xDE, 0xF0, 0x95, 0xCB, 0x11, 0x7C, 0x4E, 0x07, 0x68, 0x2B, 0x0A, 0x47, 0xF6, 0x2E, 0xC9, 0x87,
+    0x8E, 0xDD, 0x05, 0x85, 0xEA, 0x32, 0x7B, 0x2E, 0xF1, 0x99, 0x35, 0x22, 0xAF, 0x8B, 0x0C, 0xE0,
+    0xB7, 0xAC, 0x72, 0x62, 0x5A, 0xC2, 0x2E, 0x17, 0xA7, 0x7A, 0x70, 0xB0, 0x07, 0xE5, 0x40, 0x52,
+    0xC7, 0x9A, 0xD3, 0x05, 0xE8, 0x8A, 0xDC, 0x92, 0xF7, 0x27, 0xAF, 0xF6, 0x99, 0x74, 0xB1, 0x32,
+    0xFF, 0x3F, 0x27, 0x15, 0x9B, 0x8D, 0xE4, 0x8E, 0xAC, 0x47, 0x75, 0xA4, 0x31, 0x8A, 0xBC, 0x9B,
+    0xBA, 0x92, 0x1D, 0xDD, 0xE8, 0xC7, 0x5D, 0x66, 0xD7, 0xCA, 0xE9, 0x1F, 0xBA, 0x44, 0x1C, 0xA7,
+    0x2E, 0xC7, 0xD8, 0x58, 0x30, 0x12, 0xCE, 0xE1, 0x9F, 0x53, 0xFD, 0x99, 0xBC, 0xA1, 0x84, 0x3D,
+    0x18, 0x48, 0x1D, 0x59, 0xA4, 0x41, 0x15, 0x65, 0x0D, 0xBF, 0x7E, 0xB4, 0x1E, 0xFF, 0x93, 0xD3,
+    0x55, 0x64, 0x93, 0xA2, 0x2A, 0xBF, 0x53, 0x29, 0x41, 0xDD, 0xEC, 0x55, 0x77, 0xA0, 0x7A, 0x6D,
+    0x5D, 0x64, 0x93, 0xB7, 0x42, 0x22, 0x03, 0xA7, 0x2E, 0x43, 0x72, 0x99, 0x5C, 0x1A, 0xFD, 0xBE,
+    0xCF, 0xED, 0xE2, 0x18, 0x8B, 0xD8, 0x45, 0x22, 0x52, 0x15, 0x62, 0xC9, 0x3A, 0xB2, 0x9E, 0xBC,
+    0xE7, 0x52, 0xAF, 0xC4, 0xF2, 0x9B, 0xC0, 0x83, 0xCB, 0xE5, 0x12, 0x2D, 0x22, 0x36, 0x69, 0x45,
+    0x1C, 0x99, 0x63, 0x20, 0x1D, 0xD8, 0x81, 0x03, 0x34, 0x18, 0x92, 0x49, 0x01, 0x64, 0xFD, 0x36,
+    0x11, 0x4E, 0x24, 0x4C, 0xE5, 0x2D, 0xC7, 0xBE, 0xF1, 0xC0, 0x89, 0xF1, 0x69, 0xD0, 0x22, 0x90,
+    0x5C, 0xBD, 0x51, 0x4D, 0x20, 0x5B, 0x84, 0x2F, 0xC6, 0x19, 0xE8, 0xC9, 0xE6, 0x32, 0xC9, 0x87,
+    0x06, 0x88, 0x79, 0xCA, 0xE6, 0xCA, 0x00, 0x86, 0x1A, 0xCA, 0x4A, 0x5B, 0xB4, 0x55, 0x1D, 0x79,
+    0x47, 0x75, 0x0C, 0xE3, 0x3C, 0x71, 0xC8, 0x85, 0x18, 0x07, 0x4B, 0x45, 0x36, 0x13, 0x8C, 0xF7,
+    0x5F, 0x8F, 0x5F, 0x6F, 0x30, 0x22, 0x8E, 0xD3, 0xED, 0xEA, 0xBB, 0x53, 0x29, 0xEA, 0x51, 0x69,
+    0x64, 0xE2, 0xA1, 0x32, 0x9B, 0x55, 0xEB, 0xB5, 0x88, 0x04, 0x35, 0xFE, 0x7D, 0x19, 0x89, 0xE8,
+    0xC8, 0xA9, 0xAB, 0xB7, 0xB6, 0x50, 0xF3, 0x9C, 0x1C, 0x2D, 0xB7, 0x2E, 0x0E, 0x73, 0x24, 0x6F,
+    0x4E, 0xC7, 0x57, 0x8E, 0xCD, 0xF6, 0xD5, 0x21, 0x73, 0xE1, 0xF5, 0x61, 0xEC, 0x42, 0x93, 0xF7,
+    0x31, 0x32, 0x1A, 0x73, 0x02, 0xA2, 0x9D, 0xAA, 0x6D, 0x3A, 0x3C, 0x74, 0xBB, 0xC9, 0x03, 0xDA,
+    0xE6, 0x4E, 0xA4, 0xAB, 0x37, 0x14, 0x4D, 0x6B, 0xAF, 0xDE, 0xA8, 0xFC, 0xC3, 0x94, 0xB2, 0x41,
+    0xDB, 0xC4, 0x81, 0x91, 0xCB, 0xE8, 0x26, 0x8D, 0x29, 0xCB, 0xE8, 0x8A, 0x31, 0xC2, 0x30, 0x05,
+    0xD4, 0xCD, 0x54, 0xF1, 0x42, 0xE1, 0xE6, 0xEC, 0x74, 0xE5, 0x63, 0xE9, 0x7A, 0x02, 0xB1, 0xBD,
+    0xD0, 0x4E, 0xF6, 0x9F, 0x32, 0xA4, 0x01, 0xD8, 0xBF, 0x54, 0x56, 0xAE, 0x14, 0x07, 0x66, 0x2C,
+    0xA4, 0x6B, 0xC5, 0x41, 0xD9, 0x67, 0x9B, 0x7B, 0x42, 0x8F, 0xB7, 0xAB, 0x09, 0x64, 0x4B, 0xE4,
+    0xB6, 0x40, 0xF1, 0x1E, 0x81, 0x64, 0x44, 0x75, 0x68, 0x8B, 0x86, 0x11, 0xBE, 0x3C, 0x65, 0xDA,
+    0x97, 0x53, 0x6A, 0x4E, 0x88, 0x89, 0x32, 0xD3, 0x07, 0x27, 0x37, 0xCB, 0x7F, 0x30, 0x7D, 0x90,
+    0x5E, 0xBD, 0xBD, 0xAA, 0xE6, 0x70, 0xC5, 0xE1, 0x51, 0xFD, 0x42, 0x2C, 0x66, 0xC8, 0x07, 0x52,
+    0x8B, 0xDE, 0x7C, 0x5D, 0xE6, 0x74, 0xD2, 0x63, 0xA1, 0xD9, 0x33, 0x73, 0x79, 0x75, 0x51, 0x4D,
+    0x36, 0x46, 0x51, 0x41, 0x72, 0xEB, 0xEB, 0xAB, 0xD5, 0x55, 0x11, 0x91, 0x77, 0x57, 0xAB, 0x2B,
+    0x9B, 0xA2, 0x9A, 0x47, 0x11, 0x9F, 0xB6, 0xA6, 0xCE, 0xC3, 0x50, 0x74, 0x14, 0x23, 0x85, 0x74,
+    0xC5, 0x1F, 0xEC, 0x95, 0x4F, 0x3D, 0xF9, 0xA7, 0x8F, 0xF7, 0xCF, 0x71, 0x0D, 0xCE, 0x42, 0xDE,
+    0x90, 0xF6, 0xFC, 0x05, 0x6F, 0x06, 0x38, 0xBB, 0x4D, 0x10, 0x53, 0xDD, 0x6C, 0x2C, 0xC5, 0xA7,
+    0xB7, 0x57, 0xAB, 0x7F, 0xF2, 0xEC, 0xBB, 0x22, 0x22, 0x37, 0x6F, 0xAF, 0x56, 0x07, 0xF3, 0xE7,
+    0xFB, 0x33, 0x83, 0x2F, 0x00, 0x7E, 0x17, 0xCE, 0x82, 0xFE, 0x45, 0x37, 0x9A, 0xDF, 0xA8, 0xC7,
+    0xFB, 0xFF, 0xD6, 0xBF, 0xBA, 0x5F, 0x3E, 0xBA, 0x9F, 0xDE, 0x39, 0xA4, 0xDC, 0x90, 0x8E, 0xF0,
+    0x30, 0x70, 0x1F, 0xF7, 0x81, 0x6E, 0xF2, 0x86, 0xDC, 0x32, 0x44, 0x3D, 0x91, 0x5B, 0x18, 0xF2,
+    0x9F, 0x2E, 0x97, 0x97, 0x5E, 0x14, 0x11, 0x71, 0x9B, 0xD5, 0x6A, 0x35, 0x44, 0x28, 0x39, 0x4C,
+    0x31, 0x8F, 0x00, 0x03, 0xEB, 0xE9, 0xE7, 0x00, 0x79, 0x43, 0x3E, 0x90, 0x4B, 0x93, 0xFF, 0xD9,
+    0xA0, 0xDF, 0x7C, 0xE9, 0xCD, 0xD7, 0xFB, 0xC1, 0x5E, 0xFB, 0xB5, 0xCF, 0x18, 0x56, 0x73, 0xED,
+    0xBE, 0xF5, 0x59, 0xFD, 0xD2, 0x9B, 0x2F, 0xD9, 0xCD, 0x4D, 0xAB, 0xC5, 0x22, 0x16, 0x6D, 0xA1,
+    0x82, 0xAC, 0x82, 0xB6, 0x21, 0x97, 0x86, 0xC3, 0x9B, 0x4D, 0xFE, 0xC3, 0xEF, 0x34, 0x07, 0x67,
+    0x8B, 0xA6, 0xBB, 0xF6, 0x25, 0xD2, 0x1E, 0xF2, 0x26, 0x12, 0xEE, 0x1A, 0xA4, 0x3D, 0xF7, 0xE7,
+    0xDF, 0xB4, 0x07, 0x67, 0x8B, 0xE6, 0xE0, 0x4F, 0x06, 0x5A, 0x69, 0xA8, 0x7D, 0xAC, 0x99, 0xB8,
+    0x46, 0x21, 0x32, 0xD6, 0x5B, 0x68, 0x25, 0x8F, 0x05, 0xFB, 0x31, 0x3F, 0x3D, 0x66, 0x59, 0x13,
+    0xE0, 0x2C, 0x5F, 0xCE, 0x9B, 0x32, 0xED, 0xCB, 0xEA, 0x5A, 0x59, 0x9D, 0x2D, 0xAA, 0xFC, 0x3B,
+    0x2F, 0x3F, 0x73, 0x53, 0xE4, 0xD6, 0xED, 0xD5, 0xF7, 0xCA, 0x8A, 0x74, 0x4A, 0x6E, 0x72, 0xF0,
+    0x65, 0xB8, 0x76, 0xCF, 0x6F, 0x17, 0xA0, 0x9B, 0x68, 0x49, 0xA6, 0x9C, 0x55, 0x7D, 0xDE, 0xEC,
+    0xA7, 0x7D, 0xD6, 0x5D, 0x63, 0xAF, 0x5C, 0x3E, 0xFB, 0x43, 0x91, 0x71, 0xB5, 0x1A, 0x61, 0x0F,
+    0xF6, 0x61, 0x3F, 0x62, 0x23, 0x47, 0x7D, 0x03, 0x73, 0x4B, 0x33, 0xDB, 0xE4, 0x07, 0xA4, 0x2E,
+    0xEF, 0xC8, 0xED, 0x1A, 0xCA, 0xEC, 0xA7, 0xCB, 0xE5, 0xDA, 0x88, 0x88, 0x3B, 0x5C, 0xAD, 0x56,
+    0xD5, 0x7A, 0xDB, 0x03, 0xE4, 0x08, 0xE3, 0x3C, 0x8A, 0x01, 0x3E, 0x37, 0x33, 0xC6, 0x1E, 0x90,
+    0xDD, 0x16, 0x09, 0xB5, 0x88, 0x7C, 0x7C, 0x63, 0xB5, 0x5A, 0xED, 0x01, 0xEC, 0x2D, 0x97, 0xCB,
+    0xA7, 0x6B, 0x11, 0x71, 0xAD, 0x88, 0xD8, 0xF5, 0xB6, 0x9A, 0xE7, 0xDA, 0x36, 0xF4, 0x9C, 0x55,
+    0x50, 0x57, 0x64, 0x37, 0x2B, 0xF6, 0x8A, 0x2A, 0xF3, 0x75, 0x55, 0xBF, 0x25, 0x4F, 0xBE, 0xFB,
+    0xE4, 0xBB, 0xFF, 0xC9, 0x4E, 0xF1, 0xEB, 0xF8, 0x5D, 0xD4, 0x5B, 0x0E, 0xFD, 0xA4, 0x65, 0xA7,
+    0xE0, 0x2F, 0x78, 0x3B, 0x5B, 0x05, 0xD5, 0xB4, 0x87, 0x28, 0x2A, 0x91, 0x4D, 0xFB, 0x84, 0x88,
+    0xC8, 0x7F, 0xBC, 0x5A, 0xAD, 0xAE, 0x56, 0x40, 0xB1, 0x5C, 0x2E, 0x97, 0x1F, 0x8B, 0x88, 0x7C,
+    0x6D, 0xC2, 0xB8, 0x74, 0x33, 0xC5, 0x79, 0xF2, 0x66, 0x4A, 0x37, 0xFC, 0x65, 0xEF, 0x78, 0x72,
+    0xA7, 0x78, 0x60, 0xD7, 0xEF, 0xFA, 0xF6, 0x2D, 0x69, 0xDA, 0x27, 0x07, 0x0E, 0x8A, 0x86, 0x83,
+    0x21, 0x2E, 0xFE, 0x73, 0xDB, 0x00, 0xA9, 0xD5, 0xA0, 0x9C, 0x72, 0xA8, 0x9E, 0x12, 0x75, 0x7B,
+    0x75, 0xC5, 0x29, 0x11, 0x91, 0xF4, 0xF6, 0x6A, 0x75, 0xE5, 0x47, 0x0E, 0xD8, 0x59, 0x2C, 0x97,
+    0xCB, 0x4B, 0x4A, 0x44, 0x04, 0x23, 0x22, 0xF1, 0x4C, 0x16, 0x94, 0xD3, 0xCF, 0x99, 0x0B, 0x95,
+    0xD5, 0x94, 0x01, 0x33, 0x02, 0x41, 0x05, 0xC8, 0x5C, 0xEE, 0xA0, 0xAC, 0x74, 0x0F, 0x81, 0xD2,
+    0x92, 0xF5, 0xD4, 0xAB, 0x55, 0x0B, 0x22, 0x32, 0x90, 0xCA, 0xEA, 0x6A, 0x37, 0x65, 0x10, 0x68,
+    0x37, 0x65, 0x10, 0x58, 0x30, 0xCD, 0x02, 0x68, 0x53, 0x07, 0x8C, 0xDA, 0x82, 0x1A, 0xF6, 0x80,
+    0xEC, 0x43, 0x07, 0xE8, 0x77, 0x1B, 0xA0, 0x8C, 0x91, 0xB4, 0x7E, 0x46, 0xC2, 0x27, 0xB5, 0x95,
+    0x00, 0x24, 0x4F, 0x43, 0x2E, 0x3D, 0x5A, 0x84, 0xAC, 0x29, 0xFA, 0x49, 0xDC, 0x99, 0x2A, 0x8A,
+    0x86, 0xF8, 0x06, 0xAE, 0x7E, 0xC7, 0xA6, 0x22, 0x4E, 0x8D, 0x17, 0x83, 0xF2, 0xB4, 0xA9, 0x47,
+    0xDB, 0x40, 0xD6, 0x1F, 0x90, 0x78, 0x03, 0x07, 0xDA, 0x62, 0x32, 0x87, 0xFE, 0xE6, 0x40, 0xDE,
+    0xED, 0xA3, 0x5C, 0x61, 0x53, 0xA7, 0x5C, 0x32, 0x20, 0x8F, 0x0F, 0x68, 0x19, 0x62, 0x9A, 0x42,
+    0x52, 0x41, 0x2D, 0xF2, 0x81, 0x88, 0xFC, 0x4C, 0x6E, 0xB4, 0x16, 0xDA, 0x98, 0xB4, 0x9C, 0xBB,
+    0x98, 0xED, 0x38, 0xBF, 0xFD, 0xB9, 0x48, 0xFB, 0x03, 0x11, 0xF9, 0xED, 0xD5, 0x95, 0x4F, 0xF9,
+    0x76, 0x7E, 0xFB, 0xCF, 0x56, 0xFF, 0x9B, 0x4C, 0x10, 0xE7, 0x5D, 0x09, 0xD2, 0x0D, 0x99, 0xDC,
+    0x4A, 0x3D, 0xA5, 0xC8, 0x07, 0x03, 0xE6, 0xF6, 0xB3, 0x32, 0x60, 0x7A, 0x74, 0xA0, 0xEC, 0x48,
+    0x04, 0xDD, 0x91, 0x48, 0x9F, 0xF7, 0x30, 0x06, 0xE5, 0x20, 0x98, 0xF3, 0x01, 0x42, 0xDE, 0x1F,
+    0x42, 0x48, 0x86, 0xB2, 0x22, 0xB0, 0x9F, 0x77, 0x04, 0x8A, 0x17, 0x3D, 0x71, 0x9E, 0x23, 0xE9,
+    0x50, 0x36, 0x23, 0x8C, 0x99, 0x3B, 0x00, 0x43, 0x38, 0x80, 0xD2, 0x96, 0x23, 0xE8, 0x4E, 0x6D,
+    0x40, 0x3B, 0xDA, 0x86, 0xC2, 0x51, 0x6F, 0xCE, 0xD7, 0x8E, 0xFD, 0x5A, 0xC4, 0xB1, 0x9F, 0x8A,
+    0x5C, 0xE6, 0x34, 0xC9, 0x27, 0xB2, 0x20, 0x4B, 0xE6, 0x08, 0x85, 0x34, 0x53, 0xBB, 0x40, 0x75,
+    0xB3, 0x83, 0xEC, 0x87, 0x0E, 0xF4, 0x75, 0x07, 0xFA, 0x89, 0x01, 0xCA, 0x34, 0xC0, 0x82, 0x00,
+    0x7B, 0x6C, 0x20, 0x50, 0xC3, 0x80, 0xA9, 0x52, 0x17, 0x3B, 0x1E, 0x14, 0x36, 0xEB, 0xD0, 0x9D,
+    0xB6, 0x68, 0x57, 0x34, 0x64, 0xAE, 0xAC, 0x50, 0x83, 0x81, 0x34, 0xB4, 0x2F, 0x2F, 0x9F, 0x0D,
+    0x22, 0x22, 0x1B, 0x11, 0x91, 0x8D, 0x11, 0x91, 0x98, 0x88, 0xF4, 0xA7, 0x9B, 0xD5, 0xDF, 0xBF,
+    0xE2, 0x64, 0xCE, 0x40, 0x3A, 0x50, 0x03, 0x98, 0x58, 0xB1, 0x5B, 0x74, 0x11, 0x02, 0x50, 0x3D,
+    0x6D, 0xEC, 0x23, 0x49, 0x40, 0x05, 0xF6, 0xA0, 0xA6, 0x04, 0xDD, 0xEB, 0x86, 0x34, 0xE4, 0x16,
+    0xCC, 0x13, 0x0E, 0xF4, 0x8F, 0x3C, 0x24, 0x61, 0x0D, 0x98, 0xFD, 0x39, 0xB6, 0x91, 0xC8, 0xDC,
+    0x20, 0x6A, 0x0A, 0xEC, 0x54, 0x00, 0x97, 0x44, 0x9A, 0x4C, 0x44, 0x5C, 0x2E, 0x22, 0x83, 0x1E,
+    0x62, 0xEB, 0xD5, 0xC9, 0xDC, 0x89, 0xDA, 0xF5, 0x9E, 0x58, 0x5A, 0x7E, 0x7B, 0xB5, 0x92, 0x3B,
+    0x22, 0x22, 0x9B, 0xB6, 0x15, 0x91, 0xAB, 0xD5, 0xB6, 0x60, 0x2E, 0x6C, 0x53, 0x0A, 0x62, 0xB2,
+    0x75, 0x0B, 0xA0, 0xA3, 0x05, 0x77, 0x7B, 0xB5, 0x8A, 0x37, 0xE2, 0x21, 0x39, 0x16, 0x8E, 0x5C,
+    0x4F, 0xA5, 0xB1, 0x49, 0x2B, 0x1B, 0x0A, 0x11, 0xB1, 0xA5, 0x88, 0xF4, 0xA6, 0xC7, 0x53, 0x76,
+    0xAC, 0x29, 0x6C, 0x4C, 0xCD, 0xD4, 0x95, 0x72, 0xE4, 0x36, 0x19, 0x26, 0xC3, 0x68, 0xA0, 0xBC,
+    0xB1, 0x92, 0xF6, 0xA6, 0x88, 0xC8, 0xED, 0x8D, 0x88, 0x6C, 0x0E, 0xC8, 0x6C, 0xEC, 0xC0, 0xA4,
+    0x5C, 0xCC, 0x8A, 0xD8, 0x85, 0xC2, 0x1A, 0x50, 0x41, 0x37, 0x60, 0xDE, 0xEF, 0x40, 0xC9, 0xED,
+    0xD5, 0x2A, 0xDE, 0x28, 0x5A, 0x16, 0xE5, 0x36, 0xD3, 0x64, 0x4A, 0xDD, 0x7C, 0x70, 0xB9, 0xAC,
+    0x72, 0x11, 0x71, 0x85, 0x88, 0x84, 0xF2, 0xD6, 0x72, 0xF9, 0x74, 0xD1, 0xCF, 0xD9, 0x4F, 0xC7,
+    0x8A, 0x33, 0x5A, 0x11, 0x11, 0x23, 0x22, 0xF2, 0xE6, 0xED, 0xD5, 0xEA, 0xCA, 0x8F, 0x87, 0x6D,
+    0x60, 0x5C, 0xF7, 0xC4, 0x4C, 0x68, 0x28, 0x6F, 0x2D, 0x97, 0xCB, 0x44, 0x44, 0xC4, 0xC6, 0xC9,
+    0xB3, 0x5C, 0x5E, 0x68, 0x65, 0x53, 0x61, 0x44, 0xA4, 0xCA, 0xE7, 0x30, 0x40, 0x6B, 0x81, 0x6C,
+    0xD8, 0xD2, 0x2F, 0x3F, 0x8A, 0xB5, 0x97, 0x15, 0x90, 0xBF, 0x2F, 0x37, 0x56, 0x57, 0x6E, 0x8B,
+    0x88, 0x48, 0x2B, 0x22, 0x6D, 0xC3, 0x5D, 0xC6, 0xEE, 0x51, 0x54, 0x3E, 0xB6, 0x0B, 0x6B, 0x80,
+    0xD6, 0xAE, 0x56, 0x57, 0xC4, 0x1A, 0x11, 0xA9, 0xB4, 0xC8, 0xAD, 0x63, 0xFE, 0x6D, 0x64, 0xF4,
+    0x54, 0xE4, 0x16, 0x88, 0xC8, 0x48, 0x29, 0x22, 0x3D, 0x99, 0x4D, 0x05, 0x06, 0x8A, 0x1E, 0x03,
+    0x23, 0x99, 0xA5, 0xB4, 0x11, 0x43, 0x31, 0x70, 0x40, 0x6E, 0x29, 0xAF, 0xDE, 0xD9, 0xAC, 0xAE,
+    0xBE, 0x3F, 0x33, 0xF0, 0x66, 0x03, 0x9E, 0xA2, 0x89, 0xB9, 0x9F, 0xB9, 0x55, 0x0E, 0x7C, 0x12,
+    0xC0, 0x44, 0xA4, 0x43, 0x20, 0xB9, 0x2D, 0xE9, 0x6A, 0xD5, 0x4A, 0xBC, 0x91, 0x99, 0x26, 0xBC,
+    0xD8, 0xA6, 0x9C, 0x24, 0x1E, 0x96, 0xCB, 0xE5, 0xB1, 0x10, 0xF0, 0xC8, 0x72, 0xB9, 0x6C, 0xFB,
+    0x98, 0x9C, 0x3F, 0x27, 0x5C, 0xC7, 0x94, 0xA0, 0x43, 0x23, 0x22, 0xF2, 0x92, 0x88, 0xC8, 0x87,
+    0xB7, 0x57, 0xAB, 0x2B, 0xC3, 0xD6, 0x1E, 0x34, 0xD5, 0x7C, 0x66, 0xF9, 0xD6, 0x72, 0xB9, 0x6C,
+    0x7B, 0x11, 0x91, 0xCE, 0x88, 0x48, 0x95, 0x2C, 0x97, 0x51, 0xC2, 0x89, 0xC8, 0x25, 0x11, 0x11,
+    0x79, 0xAD, 0xBE, 0xBD, 0xBA, 0xB2, 0x21, 0x77, 0x44, 0xC8, 0x0F, 0xDD, 0xD1, 0x82, 0xF2, 0x94,
+    0x16, 0xC6, 0xBF, 0x91, 0x2F, 0x32, 0x9F, 0xCA, 0x86, 0x42, 0x3E, 0x14, 0xB1, 0x7A, 0xDB, 0x11,
+    0x42, 0x8B, 0x48, 0x28, 0x44, 0x24, 0x14, 0xB7, 0x57, 0xAB, 0x90, 0x0F, 0xB0, 0x56, 0x23, 0xEC,
+    0x22, 0x70, 0x8E, 0xDA, 0xF2, 0xEB, 0x94, 0x3D, 0xA0, 0xFD, 0x5C, 0xBC, 0x16, 0x39, 0xAF, 0xAD,
+    0xE6, 0x98, 0x70, 0x61, 0xB7, 0x1C, 0x31, 0xDB, 0xCD, 0x31, 0xC3, 0xBD, 0x9F, 0x29, 0x56, 0xC3,
+    0x09, 0x46, 0x78, 0x44, 0x0D, 0xB0, 0xC8, 0x1D, 0x2C, 0x0A, 0x0B, 0x07, 0x46, 0x62, 0x64, 0x48,
+    0x42, 0x39, 0x33, 0xEA, 0x99, 0x07, 0x97, 0xCB, 0xFF, 0x4C, 0x44, 0xDE, 0x9C, 0xA4, 0x7B, 0xDA,
+    0xCF, 0xC6, 0xC0, 0x30, 0x2F, 0xE8, 0x62, 0xB6, 0x7F, 0x8A, 0x6A, 0xE2, 0xCC, 0xBF, 0xDC, 0xC7,
+    0xD9, 0x2F, 0xF8, 0x38, 0x26, 0x9D, 0x3E, 0x0F, 0xBA, 0x42, 0xF5, 0xB0, 0x8E, 0xAF, 0x1C, 0xEC,
+    0x46, 0x4B, 0x39, 0x7A, 0xD5, 0xD3, 0xAB, 0x9D, 0x58, 0x6B, 0xE9, 0x60, 0x01, 0xB9, 0x25, 0xF1,
+    0xF3, 0x2B, 0xE2, 0xAB, 0x2C, 0xBE, 0x2A, 0x21, 0xA9, 0xC8, 0xAB, 0x08, 0x54, 0x7A, 0xEE, 0x53,
+    0xDD, 0x03, 0xFB, 0xF9, 0x13, 0x4E, 0xFE, 0xA0, 0x6D, 0x6A, 0xE9, 0x29, 0x06, 0x68, 0x3D, 0xA5,
+    0x8C, 0xD9, 0xF0, 0x4F, 0x45, 0x3F, 0xD1, 0x5D, 0x3B, 0xA3, 0xB7, 0x27, 0x4F, 0xD0, 0x56, 0x22,
+    0x5D, 0x2E, 0xBE, 0xA8, 0xC2, 0x82, 0x9D, 0x1D, 0x16, 0x3B, 0x2C, 0x16, 0xEC, 0x94, 0x55, 0xD0,
+    0xE2, 0xA7, 0x96, 0xC5, 0x49, 0x30, 0x3F, 0xD9, 0x94, 0xD1, 0x94, 0xFA, 0xE2, 0x36, 0x47, 0x28,
+    0xBB, 0x67, 0x23, 0xC7, 0xC2, 0xAE, 0xEA, 0x53, 0x32, 0x65, 0xD6, 0x47, 0x5F, 0x37, 0x66, 0x43,
+    0xDE, 0x69, 0xB1, 0xCA, 0xA5, 0x57, 0x26, 0x81, 0xB7, 0x37, 0x55, 0x22, 0x64, 0x4E, 0x37, 0x10,
+    0xB2, 0x0E, 0xCA, 0xC7, 0x1D, 0x64, 0x7D, 0x00, 0xC2, 0x0E, 0x60, 0x2E, 0x01, 0xD9, 0x4D, 0x3B,
+    0xA7, 0x4A, 0x19, 0x07, 0xE4, 0x01, 0x88, 0x8E, 0x67, 0x14, 0xDF, 0xD1, 0xFC, 0x4C, 0x92, 0x3F,
+    0xA1, 0xD4, 0xD2, 0x1C, 0x96, 0xDF, 0xFE, 0x91, 0xDF, 0x49, 0xEE, 0xD8, 0x5D, 0xEA, 0x6A, 0xCD,
+    0x82, 0x35, 0x86, 0x3D, 0xEE, 0x58, 0xF3, 0xED, 0xB7, 0x7D, 0x21, 0xD5, 0x26, 0x1D, 0xA2, 0x9F,
+    0x93, 0xFC, 0x09, 0x79, 0x9F, 0x4A, 0x5F, 0x48, 0x7A, 0xEB, 0xB0, 0xF8, 0x4E, 0x3F, 0x64, 0x37,
+    0x59, 0x9F, 0xA3, 0xA5, 0x28, 0xD0, 0x8D, 0x7A, 0xC3, 0x66, 0x3E, 0x71, 0x3E, 0xBB, 0xC9, 0xDA,
+    0x7C, 0xFB, 0x9D, 0x5B, 0x07, 0x4A, 0xBA, 0x72, 0x43, 0xD9, 0x24, 0x07, 0xD1, 0x62, 0x8D, 0xA2,
+    0xAE, 0xDB, 0x12, 0xE3, 0x57, 0xF1, 0x61, 0xBB, 0xED, 0x49, 0xF8, 0xA6, 0xCC, 0x65, 0x83, 0xF7,
+    0x1D, 0x25, 0x38, 0xE8, 0x23, 0xC5, 0x95, 0xF9, 0x6D, 0xFB, 0x9A, 0x58, 0x14, 0x5A, 0xDA, 0x39,
+    0x99, 0x29, 0xEE, 0x1D, 0x84, 0xAD, 0xA8, 0xAE, 0xAB, 0x23, 0x01, 0x6E, 0x8F, 0x7E, 0xD1, 0x7D,
+    0xEA, 0x2F, 0x44, 0x44, 0x86, 0x5A, 0x44, 0xE4, 0x27, 0x22, 0x22, 0xD2, 0xFC, 0xE6, 0xE2, 0x17,
+    0x3C, 0x1E, 0xFC, 0xCD, 0xF4, 0x7F, 0x74, 0xFB, 0x26, 0xFB, 0xC9, 0xE7, 0xF7, 0xF4, 0xA3, 0x0B,
+    0x0F, 0xCE, 0xAC, 0xD4, 0xCF, 0x2C, 0xA0, 0xA4, 0x82, 0xE4, 0x63, 0x07, 0x84, 0x35, 0xB0, 0x28,
+    0x1A, 0x28, 0x95, 0x03, 0x6D, 0x0F, 0x20, 0xEB, 0x75, 0x43, 0xEA, 0xA2, 0x6F, 0x74, 0x00, 0x07,
+    0x68, 0x8B, 0x41, 0x39, 0x8A, 0x86, 0x7D, 0xF2, 0x0E, 0x6D, 0x95, 0x23, 0xF5, 0x31, 0xDD, 0x2A,
+    0x80, 0xB6, 0x06, 0xD2, 0xA1, 0xAC, 0xC0, 0x68, 0x0B, 0xFA, 0x4F, 0x7B, 0x48, 0x86, 0x7D, 0xA0,
+    0x78, 0xC9, 0x42, 0xFE, 0xB6, 0x07, 0xE5, 0x6A, 0x48, 0xA2, 0xE7, 0x99, 0x0C, 0x60, 0x62, 0x37,
+    0xD5, 0xDC, 0xC6, 0x3A, 0x8D, 0xAC, 0x8F, 0x4D, 0xB3, 0xF3, 0x2E, 0xBA, 0xA3, 0x7B, 0xD3, 0x19,
+    0x59, 0xA7, 0x1B, 0x08, 0x79, 0x37, 0x0D, 0x31, 0xFB, 0xD1, 0x30, 0x8F, 0xBB, 0xA8, 0xB7, 0xA9,
+    0x30, 0xAD, 0x9D, 0x67, 0xA8, 0x3C, 0x90, 0x2C, 0x21, 0x11, 0xE9, 0x28, 0x45, 0x7A, 0x25, 0x2F,
+    0xB7, 0xAE, 0xE8, 0x28, 0xBA, 0x11, 0x8A, 0x37, 0x1C, 0x98, 0xA2, 0x81, 0x83, 0x03, 0x48, 0x6E,
+    0x7B, 0xC8, 0xDE, 0xEF, 0xA0, 0xB8, 0x5A, 0xC1, 0xFE, 0xDF, 0x8A, 0x8F, 0xF6, 0x21, 0xFD, 0x28,
+    0x80, 0x7E, 0xC7, 0x43, 0x9D, 0x3B, 0xD4, 0xA0, 0x6F, 0xFD, 0xDD, 0xD6, 0x6A, 0x91, 0x30, 0xC1,
+    0x5C, 0xFF, 0x45, 0x05, 0x24, 0xDF, 0x03, 0x22, 0x64, 0xD6, 0x93, 0xF5, 0x7B, 0x30, 0x26, 0x15,
+    0xDA, 0x4E, 0xD2, 0xBF, 0xF8, 0x95, 0xBE, 0x48, 0x07, 0x68, 0x4C, 0x85, 0xC9, 0x1C, 0x4A, 0xC6,
+    0xA9, 0xE1, 0x54, 0xEC, 0x50, 0x7F, 0x72, 0xCB, 0x6E, 0x3A, 0x00, 0xB1, 0x1D, 0xF5, 0x82, 0xBF,
+    0xEC, 0x23, 0x19, 0x20, 0xEB, 0x05, 0xD4, 0x58, 0x77, 0x20, 0x5F, 0x73, 0x60, 0xEC, 0x85, 0x58,
+    0x88, 0x01, 0x0F, 0x68, 0x07, 0xE6, 0x8D, 0x11, 0xF4, 0x47, 0x02, 0x6A, 0x2C, 0xAB, 0xB9, 0x33,
+    0xFC, 0x5F, 0xE6, 0x91, 0x3A, 0x20, 0x8D, 0x8D, 0x6E, 0xEC, 0x76, 0x33, 0x57, 0xC0, 0x77, 0xB5,
+    0xAB, 0x5F, 0x1B, 0xD3, 0xCB, 0x77, 0x9F, 0x7F, 0x98, 0x85, 0xA2, 0xAF, 0xA7, 0x59, 0x7E, 0x2E,
+    0x63, 0xF8, 0x0B, 0xE6, 0xF9, 0x17, 0xC7, 0x51, 0x00, 0xF2, 0x5B, 0xA4, 0x8D, 0x48, 0x53, 0xE8,
+    0xB7, 0xDA, 0x3B, 0xFE, 0x1C, 0xA5, 0x54, 0x17, 0x38, 0x79, 0xF9, 0x13, 0xD5, 0x5E, 0x22, 0xD7,
+    0x45, 0x44, 0x4E, 0x2E, 0x97, 0xCB, 0xA7, 0xEF, 0xCD, 0x9D, 0x9F, 0xD4, 0xFF, 0xD4, 0x9C, 0xF0,
+    0xBB, 0x9C, 0xC8, 0xA5, 0x3A, 0x5B, 0x8A, 0xDF, 0x37, 0x99, 0x84, 0x73, 0xB4, 0xFE, 0x04, 0x27,
+    0xAB, 0x74, 0xE0, 0x3E, 0x2D, 0xCD, 0xC2, 0xC8, 0xAD, 0xC3, 0x45, 0x2A, 0xE1, 0x1C, 0x75, 0xBF,
+    0x8D, 0x88, 0xDD, 0xAA, 0x78, 0xF6, 0xBA, 0x88, 0x48, 0x2A, 0x22, 0xFD, 0x3D, 0x1E, 0xD7, 0x17,
+    0x57, 0xDF, 0x8B, 0x96, 0xA7, 0xDC, 0x58, 0xC9, 0xEB, 0xD5, 0x51, 0x1F, 0xC9, 0xDF, 0x80, 0xC4,
+    0x9D, 0x5C, 0x5E, 0xFC, 0x47, 0xAD, 0xC8, 0x87, 0x22, 0x62, 0xD9, 0x89, 0xA6, 0x46, 0x01, 0xCB,
+    0x5B, 0xCB, 0xA7, 0xA2, 0xCF, 0x14, 0x54, 0x07, 0x8F, 0x4C, 0x2D, 0x39, 0xBE, 0xB2, 0x5A, 0xAD,
+    0x5E, 0x11, 0x11, 0x79, 0x7D, 0xB5, 0x5A, 0xAD, 0x3E, 0x59, 0x72, 0x2D, 0x5A, 0x44, 0xC2, 0x83,
+    0xCB, 0xE5, 0xBD, 0x55, 0x02, 0x46, 0x44, 0xDC, 0xDC, 0x0E, 0x7B, 0x4E, 0xD7, 0x2F, 0x2A, 0x32,
+    0x21, 0x91, 0x9E, 0xDA, 0x53, 0x8C, 0x64, 0x52, 0x51, 0x76, 0xD1, 0x5D, 0x2F, 0x87, 0x98, 0x43,
+    0x9D, 0x4A, 0x13, 0x93, 0xD6, 0x8D, 0x65, 0x6E, 0xD3, 0x05, 0xCB, 0xE5, 0xF2, 0xA9, 0xA8, 0x61,
+    0xE6, 0xF6, 0xB3, 0xD9, 0x18, 0x4B, 0xAA, 0x13, 0xB1, 0xF1, 0xFC, 0x72, 0x88, 0xE2, 0xB6, 0x70,
+    0x64, 0x1B, 0x12, 0x69, 0x68, 0x7B, 0xCA, 0x01, 0x36, 0x70, 0x3C, 0xF9, 0xFB, 0x9E, 0x4B, 0x6D,
+    0xF1, 0xB7, 0x86, 0x54, 0x48, 0x05, 0xDA, 0x7E, 0xFA, 0x65, 0x39, 0x90, 0x8F, 0xE4, 0x23, 0xA9,
+    0x54, 0xA9, 0x54, 0xB1, 0x0C, 0x06, 0x8C, 0xC7, 0x78, 0x28, 0x46, 0x8A, 0x38, 0x86, 0x4C, 0x2A,
+    0x52, 0x69, 0xD2, 0x69, 0x24, 0x6D, 0x4C, 0x90, 0x2B, 0x2D, 0x9C, 0x3E, 0x9E, 0x32, 0x31, 0xB7,
+    0xC1, 0xB8, 0x06, 0x6A, 0x83, 0x8A, 0x73, 0x9D, 0xA7, 0xDB, 0xF6, 0x50, 0x0C, 0x14, 0x03, 0x64,
+    0x1B, 0xB2, 0x0D, 0xA4, 0x23, 0xE9, 0x08, 0xB5, 0xA3, 0x76, 0xD3, 0xCD, 0xE2, 0xBD, 0x12, 0xE9,
+    0x90, 0x6E, 0x1A, 0x20, 0x9B, 0x79, 0x82, 0x69, 0xF3, 0x89, 0x15, 0xD8, 0x54, 0x5A, 0x44, 0xC6,
+    0x64, 0xB9, 0xFC, 0x7A, 0xDB, 0x7D, 0xAA, 0xE1, 0xBF, 0xED, 0xFC, 0x98, 0x1D, 0x59, 0x43, 0xF7,
+    0x1A, 0xFE, 0xDD, 0xDD, 0x86, 0x7F, 0x73, 0x72, 0x66, 0xE9, 0xB8, 0x5F, 0xFC, 0xDD, 0x16, 0x94,
+    0x9E, 0xC0, 0xFB, 0x44, 0x44, 0x42, 0x26, 0x22, 0x92, 0x6D, 0x5E, 0x3E, 0x5C, 0x3E, 0x39, 0x60,
+    0x50, 0x03, 0xBA, 0x49, 0x42, 0x6C, 0x46, 0x90, 0x3A, 0xCA, 0x8A, 0x01, 0xDD, 0xB1, 0x47, 0xEA,
+    0x29, 0xE1, 0x10, 0xDD, 0x44, 0x2F, 0x5F, 0x0D, 0xA9, 0x83, 0xBA, 0x19, 0x20, 0xDF, 0x1C, 0x2E,
+    0x97, 0xB4, 0x22, 0xE2, 0x52, 0x11, 0x09, 0x64, 0x3F, 0x5D, 0x2E, 0xA7, 0x3F, 0x21, 0x12, 0xB6,
+    0x21, 0xF0, 0x92, 0x19, 0x0A, 0x9B, 0x4D, 0xD9, 0xA3, 0x8F, 0xA3, 0xB9, 0xD7, 0x47, 0xE1, 0xA3,
+    0x45, 0xE4, 0xB2, 0x12, 0x11, 0xA9, 0x96, 0xCB, 0x4B, 0x57, 0x3D, 0x68, 0x2B, 0x15, 0xAA, 0xCF,
+    0x1D, 0x89, 0x8B, 0x69, 0xE9, 0x65, 0xC3, 0x82, 0xAC, 0xA7, 0xA8, 0x92, 0x40, 0x6E, 0xD9, 0x47,
+    0xF5, 0x94, 0x4D, 0xE2, 0xD1, 0x1D, 0x6B, 0x72, 0xC7, 0x82, 0xDC, 0x3F, 0x78, 0xF1, 0xE5, 0x4B,
+    0x83, 0x11, 0x11, 0xAF, 0x45, 0xA4, 0x4F, 0xBE, 0x7E, 0x6B, 0x79, 0xB7, 0x2D, 0x59, 0xCD, 0xD6,
+    0x78, 0xDA, 0x4F, 0xB5, 0x4A, 0x22, 0x4D, 0x29, 0x22, 0xCE, 0x88, 0xC8, 0x60, 0xBA, 0x99, 0xC4,
+    0xBA, 0xDB, 0x3A, 0xC1, 0xFE, 0xA8, 0x43, 0x41, 0x35, 0x3B, 0xA3, 0x49, 0xB8, 0xC7, 0x83, 0x8D,
+    0xE9, 0xDE, 0x22, 0xB2, 0xA1, 0x16, 0x11, 0x9B, 0xAC, 0xB6, 0xD1, 0x0F, 0xA6, 0x4D, 0xBB, 0x7A,
+    0x49, 0x44, 0xE4, 0xE7, 0xB1, 0x16, 0x4B, 0xE4, 0x3D, 0x8C, 0x88, 0xF4, 0xF9, 0xDC, 0x87, 0x22,
+    0xD6, 0x29, 0x6C, 0xB6, 0xAD, 0x0E, 0x8E, 0xB3, 0xC3, 0x3D, 0x51, 0xA2, 0xF1, 0xC8, 0x09, 0x6E,
+    0x80, 0xF6, 0x75, 0x11, 0x11, 0x2B, 0x22, 0x52, 0x95, 0xB2, 0xF9, 0xDE, 0x71, 0x96, 0x5B, 0xAD,
+    0x56, 0xAB, 0x95, 0x11, 0x11, 0xF9, 0x81, 0x1C, 0x6F, 0x1E, 0x71, 0x49, 0xDE, 0x8B, 0x36, 0x62,
+    0x43, 0x32, 0x66, 0xE7, 0x47, 0x12, 0x9F, 0x74, 0x79, 0x87, 0xE7, 0x39, 0x76, 0xF1, 0x3C, 0x4C,
+    0x6E, 0x77, 0xC9, 0x2A, 0xFC, 0xA3, 0x24, 0x1D, 0x8F, 0x68, 0x78, 0x0E, 0x75, 0xDD, 0xF2, 0x30,
+    0x7C, 0xF0, 0xD1, 0xF2, 0xD9, 0x97, 0x97, 0x7B, 0xD1, 0xCF, 0xBC, 0xB8, 0x5A, 0x6D, 0x56, 0x57,
+    0xDE, 0xB1, 0x3C, 0x0C, 0xCE, 0x91, 0x55, 0x9C, 0xDB, 0x21, 0xE9, 0x28, 0xB2, 0x86, 0xE7, 0xD0,
+    0x95, 0xE7, 0x61, 0x32, 0x5B, 0x90, 0x55, 0xAA, 0x4B, 0x5D, 0xD2, 0xA9, 0x9E, 0xB2, 0x79, 0x2E,
+    0xEF, 0x49, 0x36, 0xFF, 0xF0, 0x52, 0xB7, 0xCD, 0x94, 0x3F, 0xF9, 0x8F, 0x8E, 0x17, 0x53, 0xC4,
+    0xC1, 0xDD, 0x90, 0x86, 0x64, 0x24, 0x19, 0x49, 0x06, 0xC8, 0xBB, 0xA9, 0x4F, 0x55, 0xF4, 0xBF,
+    0x76, 0x01, 0xFC, 0xA3, 0x00, 0x8F, 0x68, 0x00, 0x75, 0xDD, 0x02, 0x7C, 0xF0, 0xD1, 0x72, 0xB9,
+    0x3C, 0x36, 0xB8, 0xD5, 0xEA, 0xCA, 0x3B, 0x16, 0xC0, 0x39, 0x80, 0x73, 0x3B, 0x00, 0x45, 0xD6,
+    0x00, 0x79, 0xE5, 0x81, 0xCC, 0x16, 0x80, 0xEA, 0x52, 0x47, 0xE4, 0x29, 0xF2, 0x9E, 0x64, 0xB3,
+    0xFC, 0xE5, 0x07, 0xE7, 0x21, 0xEF, 0xD8, 0x80, 0x0A, 0xDC, 0xE9, 0x51, 0x77, 0xEC, 0xEE, 0x02,
+    0xE5, 0xFC, 0xA3, 0xAA, 0x57, 0xEE, 0x11, 0xCD, 0x42, 0x39, 0x75, 0xDD, 0xAA, 0x9F, 0x38, 0x3E,
+    0xE8, 0x31, 0x8E, 0x47, 0x9F, 0x27, 0x73, 0xE4, 0xBF, 0x83, 0xDA, 0x90, 0xBE, 0x63, 0xD5, 0xC7,
+    0x3D, 0xCE, 0x29, 0xB7, 0xE0, 0xDC, 0x8E, 0x72, 0xAA, 0x2F, 0xB2, 0x17, 0x1D, 0x8B, 0xBC, 0xFA,
+    0xD8, 0xA1, 0x7E, 0x66, 0x0B, 0x07, 0xA6, 0x4B, 0x3D, 0x64, 0x7F, 0x8D, 0xC1, 0x79, 0x48, 0x03,
+    0x1E, 0xD2, 0x3B, 0x76, 0x17, 0x52, 0xE7, 0x1F, 0x85, 0xD4, 0x3D, 0xA2, 0x21, 0x75, 0xEA, 0xBA,
+    0x25, 0x75, 0x7C, 0xD0, 0x93, 0x3A, 0x1E, 0x7D, 0x9E, 0xD4, 0x91, 0xFF, 0x0E, 0xA9, 0x23, 0x7D,
+    0xC7, 0xA6, 0x0E, 0x9C, 0x4B, 0x1D, 0x9C, 0xDB, 0x49, 0x1D, 0x14, 0xD9, 0x0B, 0x0E, 0xF2, 0xEA,
+    0xCF, 0x1D, 0x64, 0xB6, 0x70, 0xA0, 0xBA, 0xD4, 0xFF, 0x22, 0xCA, 0x85, 0xA3, 0x32, 0xEE, 0xA3,
+    0xAE, 0x94, 0x9F, 0xD7, 0x47, 0x72, 0xD7, 0xC3, 0xCE, 0xAE, 0xE7, 0xAC, 0xFD, 0x0E, 0x50, 0x8E,
+    0xFC, 0x87, 0x81, 0xD2, 0xD1, 0x8A, 0x43, 0xAC, 0x92, 0xBA, 0x4A, 0x46, 0x32, 0x7F, 0x06, 0xAA,
+    0xA3, 0x0E, 0xA1, 0x31, 0x66, 0xDD, 0x5E, 0x8E, 0x78, 0x75, 0x2B, 0xEF, 0x46, 0xB7, 0xF1, 0x8F,
+    0xC4, 0xEF, 0xC7, 0xE8, 0xE3, 0x48, 0x0C, 0xAC, 0xC5, 0xA4, 0x3A, 0x33, 0xC9, 0xE6, 0xAC, 0x9F,
+    0x9A, 0x33, 0x1F, 0x4C, 0x41, 0xD5, 0xAB, 0x12, 0xDB, 0x33, 0xB4, 0x12, 0x93, 0x61, 0x4F, 0x5E,
+    0xFA, 0x97, 0xCB, 0xC3, 0x65, 0x04, 0x80, 0x62, 0x16, 0x5E, 0x39, 0x89, 0xC9, 0xD8, 0xF1, 0xE5,
+    0x2F, 0xBA, 0x56, 0x6E, 0xA7, 0x6E, 0x47, 0x61, 0xAA, 0xBE, 0xD3, 0x4D, 0x34, 0xAE, 0x92, 0x61,
+    0x02, 0x37, 0xCB, 0xEA, 0x17, 0x5F, 0x6B, 0x8A, 0xA4, 0x1E, 0x5D, 0x2B, 0x22, 0x80, 0x85, 0x8D,
+    0xF1, 0x4E, 0x25, 0x55, 0x59, 0x41, 0xB6, 0x91, 0xD8, 0x7D, 0xD8, 0x48, 0x16, 0x65, 0xD7, 0xAA,
+    0xFA, 0x44, 0x6D, 0x59, 0xB9, 0xA9, 0xA2, 0x63, 0x57, 0x01, 0x63, 0x3A, 0xC2, 0x14, 0x75, 0x65,
+    0x8F, 0x64, 0x5B, 0x3B, 0x13, 0x15, 0xD8, 0xDC, 0x6C, 0xED, 0xB7, 0x44, 0x24, 0x3A, 0x83, 0x01,
+    0x1E, 0x3C, 0x5C, 0x3E, 0xE3, 0x22, 0x19, 0x1B, 0xC8, 0x2D, 0x7B, 0x10, 0x5D, 0xAB, 0xB9, 0xF9,
+    0x60, 0xD6, 0xB3, 0x0F, 0x94, 0x55, 0xEA, 0xB7, 0x9F, 0x45, 0x60, 0x0E, 0xDD, 0x24, 0x03, 0xB0,
+    0x8F, 0xEE, 0x1A, 0x52, 0x8F, 0x29, 0x40, 0x5B, 0x36, 0x1E, 0x4C, 0x34, 0x3D, 0x06, 0x74, 0xAC,
+    0xB1, 0x3C, 0x71, 0xD4, 0x84, 0x6B, 0xEA, 0xEA, 0x1D, 0xDB, 0x6C, 0x44, 0x3D, 0x70, 0x27, 0x16,
+    0x85, 0x45, 0xDC, 0xFE, 0x2B, 0x97, 0xEF, 0x6D, 0x31, 0x95, 0xCB, 0x61, 0xE4, 0x81, 0x0D, 0xA0,
+    0xFC, 0xA9, 0x38, 0x4D, 0x62, 0x57, 0x1F, 0xC2, 0x11, 0x95, 0xF7, 0xE7, 0x46, 0x67, 0xA9, 0x83,
+    0xD3, 0xB2, 0x51, 0x0E, 0xDA, 0x78, 0xF8, 0xFA, 0xAD, 0xA7, 0xB3, 0xD8, 0x08, 0x2D, 0xEF, 0xA2,
+    0x9A, 0xB3, 0xDB, 0x55, 0x8A, 0x8E, 0xE4, 0xBC, 0x44, 0x79, 0x37, 0x35, 0x65, 0x9C, 0x0F, 0x8B,
+    0xA3, 0x85, 0x2E, 0x1A, 0xD6, 0x27, 0xE2, 0x2A, 0xEF, 0x82, 0x61, 0x9A, 0x2B, 0xD2, 0xC1, 0x7E,
+    0x8C, 0xA7, 0x1C, 0xC4, 0xA8, 0xEB, 0x5D, 0x6D, 0xEE, 0x62, 0x11, 0xF1, 0x4E, 0x5C, 0x8D, 0xFA,
+    0xA6, 0x3D, 0x36, 0xDB, 0xD3, 0xDF, 0xFD, 0x14, 0x03, 0xFC, 0xF0, 0xF2, 0xA9, 0xB8, 0xE4, 0xAD,
+    0x5C, 0x8F, 0x06, 0xA2, 0xF9, 0x23, 0x99, 0x97, 0x37, 0xDD, 0x90, 0xDB, 0x99, 0xF3, 0xCF, 0x44,
+    0xBA, 0x0E, 0xDC, 0xC5, 0x63, 0x5B, 0x86, 0x8D, 0xDC, 0x2F, 0xFD, 0xC4, 0xFE, 0x22, 0x33, 0xFF,
+    0x3F, 0xD3, 0xCF, 0x1B, 0x60, 0x7F, 0xDE, 0x01, 0x53, 0xA3, 0xFC, 0x89, 0xB0, 0x86, 0x64, 0xA0,
+    0xB0, 0xD3, 0x45, 0x53, 0x3F, 0x5F, 0xD4, 0xCC, 0xDB, 0x60, 0x62, 0x11, 0x15, 0xD9, 0x43, 0x37,
+    0xEC, 0x91, 0x77, 0xF3, 0x4E, 0x08, 0x0F, 0x4C, 0x5B, 0x41, 0xBF, 0xD1, 0xC4, 0x8B, 0x26, 0xE2,
+    0xE6, 0x8B, 0x8E, 0xF3, 0x48, 0x37, 0xF3, 0x5A, 0x25, 0xC7, 0xF7, 0xC3, 0x76, 0x43, 0xCC, 0x3B,
+    0x62, 0xBB, 0x25, 0x8E, 0xF6, 0xC4, 0xD1, 0xA6, 0xF8, 0x94, 0x5D, 0x71, 0x06, 0xA0, 0xFC, 0x6E,
+    0xD2, 0xDE, 0xE9, 0x80, 0x5C, 0x82, 0x89, 0xFB, 0x63, 0xF3, 0xAC, 0xF8, 0x53, 0x61, 0xA6, 0xA1,
+    0x8A, 0xBB, 0x24, 0x96, 0x8C, 0x4E, 0x87, 0x69, 0x89, 0x0F, 0x38, 0x9A, 0xAF, 0xB6, 0x71, 0xC7,
+    0x48, 0x6F, 0x26, 0x04, 0x45, 0xCE, 0x0F, 0xF0, 0x60, 0xBB, 0xFC, 0xFA, 0xAD, 0xA7, 0xF3, 0x6E,
+    0xA6, 0xE2, 0x96, 0x2C, 0x13, 0xF1, 0x08, 0xD1, 0x42, 0x08, 0xF3, 0xA2, 0xC4, 0x43, 0x98, 0x45,
+    0x84, 0x72, 0x10, 0x73, 0x6B, 0xEF, 0xBE, 0xBB, 0x6E, 0xA2, 0xAD, 0x07, 0xFB, 0xA4, 0x1E, 0xFD,
+    0x5A, 0x45, 0xEA, 0xD1, 0x16, 0xF3, 0xC8, 0x44, 0xA2, 0x23, 0x42, 0x4E, 0x3B, 0x2C, 0xEF, 0xD0,
+    0x3D, 0xE4, 0x1D, 0x25, 0xF3, 0x3E, 0x0B, 0xF7, 0x50, 0x32, 0x8B, 0x0B, 0x87, 0xEA, 0x8C, 0x8F,
+    0x16, 0x54, 0x71, 0x47, 0xA6, 0xFC, 0x94, 0x23, 0x52, 0x7E, 0xE5, 0x32, 0xC7, 0x9C, 0x94, 0x49,
+    0x12, 0x27, 0x53, 0xE3, 0xB7, 0x32, 0x3A, 0x2A, 0x69, 0xEC, 0xFC, 0x8A, 0x6E, 0xCE, 0x9C, 0x89,
+    0x76, 0xAD, 0x9A, 0xB0, 0xC2, 0x72, 0x92, 0x34, 0x43, 0x64, 0xC0, 0xAC, 0x9F, 0x64, 0x8D, 0xD8,
+    0x89, 0x6E, 0x51, 0xDA, 0x7C, 0x74, 0x01, 0x12, 0x3F, 0xA5, 0xB0, 0x44, 0x79, 0x83, 0xD9, 0x5A,
+    0xAB, 0x33, 0x2E, 0x19, 0x9B, 0x9E, 0x55, 0xC9, 0x14, 0x09, 0x9A, 0x73, 0x5D, 0x66, 0x03, 0x7A,
+    0x8A, 0x0D, 0x29, 0x97, 0x43, 0xEA, 0x29, 0x6C, 0x6C, 0x6D, 0x57, 0x5F, 0x8D, 0x75, 0x06, 0x32,
+    0x42, 0x32, 0x44, 0x4F, 0x29, 0x9F, 0x0A, 0xB7, 0xE7, 0x16, 0x80, 0x13, 0x69, 0x22, 0x61, 0x26,
+    0x01, 0x34, 0x4B, 0xA0, 0x79, 0x53, 0xDE, 0x2D, 0x83, 0xA2, 0xCF, 0x28, 0x2E, 0xD6, 0x7D, 0x37,
+    0xC0, 0x7E, 0xB5, 0xB7, 0x35, 0x52, 0x28, 0xE2, 0xA0, 0xD7, 0x2C, 0x20, 0x15, 0x97, 0xCB, 0x48,
+    0x2D, 0xAF, 0x8B, 0xB8, 0xEC, 0xBD, 0x4B, 0x27, 0xEB, 0x65, 0x35, 0xD5, 0x3D, 0x04, 0xC8, 0x7A,
+    0x54, 0x0C, 0xFB, 0xE7, 0xF1, 0x0F, 0x9C, 0xE8, 0xC8, 0x08, 0x3A, 0xCE, 0x3B, 0x0F, 0x31, 0x09,
+    0x23, 0xAE, 0x50, 0xDE, 0x6B, 0xCB, 0xFD, 0x14, 0x8D, 0xE1, 0x1B, 0x07, 0xEC, 0x12, 0xF2, 0xD7,
+    0x37, 0x4F, 0xF6, 0xEA, 0xF6, 0x98, 0xC9, 0x06, 0x2D, 0x5D, 0x26, 0x1D, 0xC5, 0x00, 0x67, 0xB8,
+    0xA7, 0xE2, 0xFF, 0xD7, 0xEE, 0x9E, 0xA8, 0x9E, 0x8E, 0x93, 0x33, 0xA7, 0x6F, 0xC6, 0xA3, 0x8B,
+    0x36, 0xB3, 0x3E, 0xCA, 0x00, 0x58, 0x03, 0xFA, 0xD6, 0x61, 0x15, 0xA2, 0x7B, 0xFE, 0xCD, 0x10,
+    0x2D, 0xE8, 0x27, 0x62, 0x83, 0xF5, 0x8D, 0x0E, 0xD1, 0x31, 0x2F, 0x03, 0x22, 0x22, 0x5D, 0xEC,
+    0x1F, 0xF5, 0x9E, 0x92, 0x50, 0x47, 0x5C, 0xCB, 0xD7, 0xB2, 0x21, 0x15, 0xA9, 0x6A, 0x19, 0xA8,
+    0xC5, 0x53, 0x4B, 0x5F, 0x8A, 0x54, 0x91, 0x1A, 0x1E, 0x6A, 0x89, 0x58, 0x51, 0xBD, 0x89, 0x7F,
+    0x07, 0xAB, 0x9E, 0x38, 0xB0, 0xF6, 0xB5, 0x07, 0xA8, 0x9B, 0xC8, 0x90, 0xFB, 0x53, 0x0B, 0xD6,
+    0xBD, 0x49, 0x98, 0xD5, 0x7E, 0xAE, 0x63, 0x3A, 0xCA, 0x4C, 0x98, 0x1F, 0xFF, 0x1F,
 };
 
 static const EpdGlyph bookerly_16_italicGlyphs[] = {
@@ -2266,7 +2330,7 @@ static const EpdGlyph bookerly_16_italicGlyphs[] = {
     { 10, 30, 10, 0, 26, 75, 9679 }, // |
     { 13, 33, 13, -1, 27, 108, 9754 }, // }
     { 16, 6, 21, 2, 14, 24, 9862 }, // ~
-    { 0, 0, 7, 0, 0, 0, 0 }, //  
+    { 0, 0, 7, 0, 0, 0, 9886 }, //  
     { 10, 26, 10, -1, 18, 65, 0 }, // ¡
     { 17, 33, 21, 2, 26, 141, 65 }, // ¢
     { 21, 24, 21, -1, 23, 126, 206 }, // £
@@ -2277,642 +2341,649 @@ static const EpdGlyph bookerly_16_italicGlyphs[] = {
     { 12, 5, 20, 4, 25, 15, 716 }, // ¨
     { 25, 25, 26, 0, 24, 157, 731 }, // ©
     { 13, 16, 14, 1, 24, 52, 888 }, // ª
-    { 16, 13, 17, 1, 15, 52, 940 }, // «
-    { 15, 8, 21, 3, 15, 30, 992 }, // ¬
-    { 11, 3, 12, 1, 10, 9, 1022 }, // ­
-    { 19, 18, 19, 0, 26, 86, 1031 }, // ®
-    { 11, 4, 20, 5, 24, 11, 1117 }, // ¯
-    { 12, 11, 17, 3, 23, 33, 1128 }, // °
-    { 15, 20, 21, 3, 20, 75, 1161 }, // ±
-    { 13, 16, 15, 1, 28, 52, 1236 }, // ²
-    { 12, 17, 15, 1, 28, 51, 1288 }, // ³
-    { 7, 8, 20, 7, 27, 14, 1339 }, // ´
-    { 21, 26, 20, -1, 18, 137, 1353 }, // µ
-    { 21, 28, 19, -1, 23, 147, 1490 }, // ¶
-    { 6, 6, 10, 2, 12, 9, 1637 }, // ·
-    { 8, 8, 20, 6, -1, 16, 1646 }, // ¸
-    { 10, 16, 15, 2, 28, 40, 1662 }, // ¹
-    { 13, 16, 15, 1, 24, 52, 1702 }, // º
-    { 16, 13, 17, 0, 15, 52, 1754 }, // »
-    { 32, 26, 36, 2, 24, 208, 1806 }, // ¼
-    { 32, 26, 36, 2, 24, 208, 2014 }, // ½
-    { 33, 26, 36, 1, 24, 215, 2222 }, // ¾
-    { 11, 25, 14, 0, 18, 69, 2437 }, // ¿
-    { 25, 32, 24, -2, 32, 200, 2506 }, // À
-    { 25, 32, 24, -2, 32, 200, 2706 }, // Á
-    { 25, 32, 24, -2, 32, 200, 2906 }, // Â
-    { 25, 31, 24, -2, 31, 194, 3106 }, // Ã
-    { 25, 31, 24, -2, 31, 194, 3300 }, // Ä
-    { 25, 33, 24, -2, 33, 207, 3494 }, // Å
-    { 33, 23, 30, -3, 23, 190, 3701 }, // Æ
-    { 20, 33, 21, 1, 24, 165, 3891 }, // Ç
-    { 21, 32, 20, -1, 32, 168, 4056 }, // È
-    { 21, 32, 20, -1, 32, 168, 4224 }, // É
-    { 21, 32, 20, -1, 32, 168, 4392 }, // Ê
-    { 21, 31, 20, -1, 31, 163, 4560 }, // Ë
-    { 15, 32, 12, -1, 32, 120, 4723 }, // Ì
-    { 16, 32, 12, -1, 32, 128, 4843 }, // Í
-    { 16, 32, 12, -1, 32, 128, 4971 }, // Î
-    { 17, 31, 12, -1, 31, 132, 5099 }, // Ï
-    { 24, 25, 24, -1, 24, 150, 5231 }, // Ð
-    { 28, 32, 25, -1, 31, 224, 5381 }, // Ñ
-    { 23, 33, 24, 1, 32, 190, 5605 }, // Ò
-    { 23, 33, 24, 1, 32, 190, 5795 }, // Ó
-    { 23, 33, 24, 1, 32, 190, 5985 }, // Ô
-    { 23, 32, 24, 1, 31, 184, 6175 }, // Õ
-    { 23, 32, 24, 1, 31, 184, 6359 }, // Ö
-    { 14, 14, 21, 3, 18, 49, 6543 }, // ×
-    { 26, 25, 24, -1, 24, 163, 6592 }, // Ø
-    { 24, 33, 25, 3, 32, 198, 6755 }, // Ù
-    { 24, 33, 25, 3, 32, 198, 6953 }, // Ú
-    { 24, 33, 25, 3, 32, 198, 7151 }, // Û
-    { 24, 32, 25, 3, 31, 192, 7349 }, // Ü
-    { 22, 32, 21, 2, 32, 176, 7541 }, // Ý
-    { 20, 23, 20, -1, 23, 115, 7717 }, // Þ
-    { 25, 34, 21, -5, 26, 213, 7832 }, // ß
-    { 18, 28, 19, 1, 27, 126, 8045 }, // à
-    { 18, 28, 19, 1, 27, 126, 8171 }, // á
-    { 18, 28, 19, 1, 27, 126, 8297 }, // â
-    { 18, 27, 19, 1, 26, 122, 8423 }, // ã
-    { 18, 26, 19, 1, 25, 117, 8545 }, // ä
-    { 18, 29, 19, 1, 28, 131, 8662 }, // å
-    { 24, 19, 25, 1, 18, 114, 8793 }, // æ
-    { 13, 27, 15, 1, 18, 88, 8907 }, // ç
-    { 14, 28, 16, 1, 27, 98, 8995 }, // è
-    { 15, 28, 16, 1, 27, 105, 9093 }, // é
-    { 15, 28, 16, 1, 27, 105, 9198 }, // ê
-    { 16, 26, 16, 1, 25, 104, 9303 }, // ë
-    { 9, 28, 11, 1, 27, 63, 9407 }, // ì
-    { 12, 28, 11, 1, 27, 84, 9470 }, // í
-    { 12, 28, 11, 1, 27, 84, 9554 }, // î
-    { 13, 26, 11, 1, 25, 85, 9638 }, // ï
-    { 16, 28, 18, 1, 27, 112, 9723 }, // ð
-    { 19, 27, 20, 1, 26, 129, 9835 }, // ñ
-    { 16, 28, 18, 1, 27, 112, 9964 }, // ò
-    { 16, 28, 18, 1, 27, 112, 10076 }, // ó
-    { 16, 28, 18, 1, 27, 112, 10188 }, // ô
-    { 17, 27, 18, 1, 26, 115, 10300 }, // õ
-    { 17, 26, 18, 1, 25, 111, 10415 }, // ö
-    { 15, 16, 21, 3, 19, 60, 10526 }, // ÷
-    { 21, 19, 18, -2, 18, 100, 10586 }, // ø
-    { 19, 28, 20, 1, 27, 133, 10686 }, // ù
-    { 19, 28, 20, 1, 27, 133, 10819 }, // ú
-    { 19, 28, 20, 1, 27, 133, 10952 }, // û
-    { 19, 26, 20, 1, 25, 124, 11085 }, // ü
-    { 20, 35, 18, -3, 27, 175, 11209 }, // ý
-    { 20, 34, 18, -3, 26, 170, 11384 }, // þ
-    { 20, 33, 18, -3, 25, 165, 11554 }, // ÿ
-    { 25, 30, 24, -2, 30, 188, 0 }, // Ā
-    { 18, 25, 19, 1, 24, 113, 188 }, // ā
-    { 25, 32, 24, -2, 32, 200, 301 }, // Ă
-    { 18, 27, 19, 1, 26, 122, 501 }, // ă
-    { 25, 31, 24, -2, 24, 194, 623 }, // Ą
-    { 18, 25, 19, 1, 18, 113, 817 }, // ą
-    { 20, 33, 21, 1, 32, 165, 930 }, // Ć
-    { 15, 28, 15, 1, 27, 105, 1095 }, // ć
-    { 20, 33, 21, 1, 32, 165, 1200 }, // Ĉ
-    { 15, 28, 15, 1, 27, 105, 1365 }, // ĉ
-    { 20, 32, 21, 1, 31, 160, 1470 }, // Ċ
-    { 13, 26, 15, 1, 25, 85, 1630 }, // ċ
-    { 21, 33, 21, 1, 32, 174, 1715 }, // Č
-    { 16, 28, 15, 1, 27, 112, 1889 }, // č
-    { 24, 33, 24, -1, 32, 198, 2001 }, // Ď
-    { 24, 30, 20, 1, 29, 180, 2199 }, // ď
-    { 24, 25, 24, -1, 24, 150, 2379 }, // Đ
-    { 20, 27, 19, 1, 26, 135, 2529 }, // đ
-    { 21, 30, 20, -1, 30, 158, 2664 }, // Ē
-    { 15, 25, 16, 1, 24, 94, 2822 }, // ē
-    { 21, 32, 20, -1, 32, 168, 2916 }, // Ĕ
-    { 16, 27, 16, 1, 26, 108, 3084 }, // ĕ
-    { 21, 31, 20, -1, 31, 163, 3192 }, // Ė
-    { 14, 26, 16, 1, 25, 91, 3355 }, // ė
-    { 21, 30, 20, -1, 23, 158, 3446 }, // Ę
-    { 14, 25, 16, 1, 18, 88, 3604 }, // ę
-    { 22, 32, 20, -1, 32, 176, 3692 }, // Ě
-    { 16, 28, 16, 1, 27, 112, 3868 }, // ě
-    { 21, 33, 23, 2, 32, 174, 3980 }, // Ĝ
-    { 22, 35, 16, -3, 27, 193, 4154 }, // ĝ
-    { 21, 33, 23, 2, 32, 174, 4347 }, // Ğ
-    { 22, 34, 16, -3, 26, 187, 4521 }, // ğ
-    { 21, 32, 23, 2, 31, 168, 4708 }, // Ġ
-    { 22, 33, 16, -3, 25, 182, 4876 }, // ġ
-    { 21, 33, 23, 2, 24, 174, 5058 }, // Ģ
-    { 22, 36, 16, -3, 28, 198, 5232 }, // ģ
-    { 29, 32, 26, -1, 32, 232, 5430 }, // Ĥ
-    { 18, 35, 20, 1, 34, 158, 5662 }, // ĥ
-    { 29, 23, 26, -1, 23, 167, 5820 }, // Ħ
-    { 18, 27, 20, 1, 26, 122, 5987 }, // ħ
-    { 16, 31, 12, -1, 31, 124, 6109 }, // Ĩ
-    { 13, 27, 11, 1, 26, 88, 6233 }, // ĩ
-    { 16, 30, 12, -1, 30, 120, 6321 }, // Ī
-    { 13, 25, 11, 1, 24, 82, 6441 }, // ī
-    { 16, 32, 12, -1, 32, 128, 6523 }, // Ĭ
-    { 13, 27, 11, 1, 26, 88, 6651 }, // ĭ
-    { 15, 30, 12, -1, 23, 113, 6739 }, // Į
-    { 10, 33, 11, 1, 26, 83, 6852 }, // į
-    { 15, 31, 12, -1, 31, 117, 6935 }, // İ
-    { 9, 19, 11, 1, 18, 43, 7052 }, // ı
-    { 27, 30, 24, -1, 23, 203, 7095 }, // Ĳ
-    { 20, 34, 20, 1, 26, 170, 7298 }, // ĳ
-    { 22, 39, 12, -6, 32, 215, 7468 }, // Ĵ
-    { 19, 35, 9, -6, 27, 167, 7683 }, // ĵ
-    { 25, 32, 23, -1, 23, 200, 7850 }, // Ķ
-    { 16, 35, 17, 1, 26, 140, 8050 }, // ķ
-    { 17, 19, 18, 1, 18, 81, 8190 }, // ĸ
-    { 19, 32, 19, -1, 32, 152, 8271 }, // Ĺ
-    { 12, 35, 10, 1, 34, 105, 8423 }, // ĺ
-    { 19, 32, 19, -1, 23, 152, 8528 }, // Ļ
-    { 11, 35, 10, -1, 26, 97, 8680 }, // ļ
-    { 20, 26, 19, -1, 26, 130, 8777 }, // Ľ
-    { 15, 30, 11, 1, 29, 113, 8907 }, // ľ
-    { 20, 23, 19, -1, 23, 115, 9020 }, // Ŀ
-    { 14, 27, 13, 1, 26, 95, 9135 }, // ŀ
-    { 19, 23, 19, -1, 23, 110, 9230 }, // Ł
-    { 13, 27, 10, -1, 26, 88, 9340 }, // ł
-    { 28, 33, 25, -1, 32, 231, 9428 }, // Ń
-    { 19, 28, 20, 1, 27, 133, 9659 }, // ń
-    { 28, 32, 25, -1, 23, 224, 9792 }, // Ņ
-    { 19, 27, 20, 1, 18, 129, 10016 }, // ņ
-    { 28, 33, 25, -1, 32, 231, 10145 }, // Ň
-    { 19, 28, 20, 1, 27, 133, 10376 }, // ň
-    { 25, 26, 27, 2, 25, 163, 10509 }, // ŉ
-    { 28, 30, 25, -1, 23, 210, 10672 }, // Ŋ
-    { 17, 26, 19, 1, 18, 111, 10882 }, // ŋ
-    { 23, 31, 24, 1, 30, 179, 10993 }, // Ō
-    { 17, 25, 18, 1, 24, 107, 11172 }, // ō
-    { 23, 33, 24, 1, 32, 190, 11279 }, // Ŏ
-    { 17, 27, 18, 1, 26, 115, 11469 }, // ŏ
-    { 24, 34, 24, 1, 33, 204, 11584 }, // Ő
-    { 19, 28, 18, 1, 27, 133, 11788 }, // ő
-    { 31, 24, 32, 1, 23, 186, 11921 }, // Œ
-    { 25, 19, 27, 1, 18, 119, 12107 }, // œ
-    { 22, 33, 21, -1, 32, 182, 12226 }, // Ŕ
-    { 14, 27, 14, 1, 27, 95, 12408 }, // ŕ
-    { 22, 33, 21, -1, 24, 182, 12503 }, // Ŗ
-    { 16, 27, 14, -1, 18, 108, 12685 }, // ŗ
-    { 22, 33, 21, -1, 32, 182, 12793 }, // Ř
-    { 16, 27, 14, 1, 27, 108, 12975 }, // ř
-    { 17, 33, 18, 0, 32, 141, 13083 }, // Ś
-    { 15, 28, 14, 0, 27, 105, 13224 }, // ś
-    { 17, 33, 18, 0, 32, 141, 13329 }, // Ŝ
-    { 15, 28, 14, 0, 27, 105, 13470 }, // ŝ
-    { 17, 33, 18, 0, 24, 141, 13575 }, // Ş
-    { 13, 27, 14, 0, 18, 88, 13716 }, // ş
-    { 18, 33, 18, 0, 32, 149, 13804 }, // Š
-    { 16, 28, 14, 0, 27, 112, 13953 }, // š
-    { 20, 32, 21, 2, 23, 160, 14065 }, // Ţ
-    { 13, 31, 13, 0, 22, 101, 14225 }, // ţ
-    { 20, 32, 21, 2, 32, 160, 14326 }, // Ť
-    { 14, 28, 13, 1, 27, 98, 14486 }, // ť
-    { 20, 23, 21, 2, 23, 115, 14584 }, // Ŧ
-    { 13, 23, 13, 0, 22, 75, 14699 }, // ŧ
-    { 24, 32, 25, 3, 31, 192, 14774 }, // Ũ
-    { 19, 27, 20, 1, 26, 129, 14966 }, // ũ
-    { 24, 31, 25, 3, 30, 186, 15095 }, // Ū
-    { 19, 25, 20, 1, 24, 119, 15281 }, // ū
-    { 24, 33, 25, 3, 32, 198, 15400 }, // Ŭ
-    { 19, 27, 20, 1, 26, 129, 15598 }, // ŭ
-    { 24, 34, 25, 3, 33, 204, 15727 }, // Ů
-    { 19, 29, 20, 1, 28, 138, 15931 }, // ů
-    { 24, 34, 25, 3, 33, 204, 16069 }, // Ű
-    { 19, 28, 20, 1, 27, 133, 16273 }, // ű
-    { 24, 30, 25, 3, 23, 180, 16406 }, // Ų
-    { 19, 25, 20, 1, 18, 119, 16586 }, // ų
-    { 34, 33, 34, 2, 32, 281, 16705 }, // Ŵ
-    { 25, 28, 26, 0, 27, 175, 16986 }, // ŵ
-    { 22, 32, 21, 2, 32, 176, 17161 }, // Ŷ
-    { 20, 35, 18, -3, 27, 175, 17337 }, // ŷ
-    { 22, 31, 21, 2, 31, 171, 17512 }, // Ÿ
-    { 20, 33, 19, -1, 32, 165, 17683 }, // Ź
-    { 16, 28, 16, 0, 27, 112, 17848 }, // ź
-    { 20, 32, 19, -1, 31, 160, 17960 }, // Ż
-    { 16, 26, 16, 0, 25, 104, 18120 }, // ż
-    { 20, 33, 19, -1, 32, 165, 18224 }, // Ž
-    { 16, 28, 16, 0, 27, 112, 18389 }, // ž
-    { 24, 34, 14, -6, 26, 204, 18501 }, // ſ
-    { 7, 8, 0, -5, 27, 14, 0 }, // ̀
-    { 7, 8, 0, -2, 27, 14, 14 }, // ́
-    { 11, 8, 0, -6, 27, 22, 28 }, // ̂
-    { 12, 6, 0, -6, 26, 18, 50 }, // ̃
-    { 10, 4, 0, -5, 24, 10, 68 }, // ̄
-    { 11, 6, 0, -5, 26, 17, 78 }, // ̆
-    { 6, 5, 0, -3, 25, 8, 95 }, // ̇
-    { 12, 5, 0, -6, 25, 15, 103 }, // ̈
-    { 9, 10, 0, -4, 29, 23, 118 }, // ̉
-    { 8, 10, 0, -4, 28, 20, 141 }, // ̊
-    { 13, 8, 0, -6, 27, 26, 161 }, // ̋
-    { 11, 8, 0, -5, 27, 22, 187 }, // ̌
-    { 10, 8, 0, -7, 27, 20, 209 }, // ̏
-    { 11, 7, 0, -6, 26, 20, 229 }, // ̑
-    { 6, 9, 0, -3, 28, 14, 249 }, // ̒
-    { 7, 10, 0, -3, 29, 18, 263 }, // ̓
-    { 6, 10, 0, -4, 29, 15, 281 }, // ̔
-    { 5, 9, 0, -3, 29, 12, 296 }, // ̕
-    { 6, 8, 0, -3, 21, 12, 308 }, // ̛
-    { 6, 6, 0, -3, -2, 9, 320 }, // ̣
-    { 12, 5, 0, -6, -3, 15, 329 }, // ̤
-    { 8, 8, 0, -4, -1, 16, 344 }, // ̥
-    { 7, 8, 0, -4, -1, 14, 360 }, // ̦
-    { 8, 8, 0, -4, -1, 16, 374 }, // ̧
-    { 7, 8, 0, -4, 1, 14, 390 }, // ̨
-    { 5, 8, 9, -1, -1, 10, 404 }, // ̩
-    { 11, 7, 0, -6, -2, 20, 414 }, // ̭
-    { 11, 7, 0, -6, -1, 20, 434 }, // ̮
-    { 12, 6, 0, -6, -2, 18, 454 }, // ̰
-    { 10, 3, 0, -5, -3, 8, 472 }, // ̱
-    { 11, 7, 0, -6, 26, 20, 480 }, // ͂
-    { 12, 13, 0, -7, 33, 39, 500 }, // ̈́
-    { 6, 6, 0, -2, -2, 9, 539 }, // ͅ
-    { 21, 32, 20, -1, 32, 168, 0 }, // Ѐ
-    { 21, 31, 20, -1, 31, 163, 168 }, // Ё
-    { 21, 30, 25, 2, 23, 158, 331 }, // Ђ
-    { 21, 32, 19, -1, 32, 168, 489 }, // Ѓ
-    { 20, 25, 21, 1, 24, 125, 657 }, // Є
-    { 17, 25, 18, 0, 24, 107, 782 }, // Ѕ
-    { 15, 23, 12, -1, 23, 87, 889 }, // І
-    { 17, 31, 12, -1, 31, 132, 976 }, // Ї
-    { 20, 30, 12, -6, 23, 150, 1108 }, // Ј
-    { 31, 24, 29, -2, 23, 186, 1258 }, // Љ
-    { 31, 24, 31, -1, 23, 186, 1444 }, // Њ
-    { 22, 23, 26, 2, 23, 127, 1630 }, // Ћ
-    { 25, 33, 22, -1, 32, 207, 1757 }, // Ќ
-    { 29, 32, 26, -1, 32, 232, 1964 }, // Ѝ
-    { 23, 34, 21, 1, 33, 196, 2196 }, // Ў
-    { 27, 31, 25, -1, 23, 210, 2392 }, // Џ
-    { 25, 24, 24, -2, 24, 150, 2602 }, // А
-    { 21, 24, 20, -1, 23, 126, 2752 }, // Б
-    { 20, 25, 20, -1, 24, 125, 2878 }, // В
-    { 21, 23, 19, -1, 23, 121, 3003 }, // Г
-    { 27, 30, 24, -2, 23, 203, 3124 }, // Д
-    { 21, 23, 20, -1, 23, 121, 3327 }, // Е
-    { 36, 25, 31, -3, 24, 225, 3448 }, // Ж
-    { 17, 25, 18, 0, 24, 107, 3673 }, // З
-    { 29, 23, 26, -1, 23, 167, 3780 }, // И
-    { 29, 33, 26, -1, 33, 240, 3947 }, // Й
-    { 25, 25, 22, -1, 24, 157, 4187 }, // К
-    { 26, 24, 23, -2, 23, 156, 4344 }, // Л
-    { 32, 23, 30, -2, 23, 184, 4500 }, // М
-    { 29, 23, 26, -1, 23, 167, 4684 }, // Н
-    { 23, 25, 24, 1, 24, 144, 4851 }, // О
-    { 27, 23, 25, -1, 23, 156, 4995 }, // П
-    { 20, 24, 20, -1, 24, 120, 5151 }, // Р
-    { 20, 25, 21, 1, 24, 125, 5271 }, // С
-    { 20, 23, 21, 2, 23, 115, 5396 }, // Т
-    { 23, 24, 21, 1, 23, 138, 5511 }, // У
-    { 24, 25, 24, 0, 24, 150, 5649 }, // Ф
-    { 27, 23, 22, -3, 23, 156, 5799 }, // Х
-    { 27, 30, 25, -1, 23, 203, 5955 }, // Ц
-    { 22, 23, 22, 2, 23, 127, 6158 }, // Ч
-    { 35, 23, 33, -1, 23, 202, 6285 }, // Ш
-    { 35, 30, 33, -1, 23, 263, 6487 }, // Щ
-    { 20, 24, 23, 2, 23, 120, 6750 }, // Ъ
-    { 32, 24, 30, -1, 23, 192, 6870 }, // Ы
-    { 20, 24, 19, -1, 23, 120, 7062 }, // Ь
-    { 20, 25, 20, 0, 24, 125, 7182 }, // Э
-    { 33, 25, 33, -1, 24, 207, 7307 }, // Ю
-    { 24, 24, 21, -2, 23, 144, 7514 }, // Я
-    { 18, 19, 19, 1, 18, 86, 7658 }, // а
-    { 19, 28, 18, 1, 27, 133, 7744 }, // б
-    { 15, 19, 17, 1, 18, 72, 7877 }, // в
-    { 14, 19, 14, 0, 18, 67, 7949 }, // г
-    { 16, 27, 18, 1, 26, 108, 8016 }, // д
-    { 14, 19, 16, 1, 18, 67, 8124 }, // е
-    { 29, 19, 29, 0, 18, 138, 8191 }, // ж
-    { 14, 19, 15, 0, 18, 67, 8329 }, // з
-    { 19, 19, 20, 1, 18, 91, 8396 }, // и
-    { 19, 28, 20, 1, 27, 133, 8487 }, // й
-    { 17, 19, 18, 1, 18, 81, 8620 }, // к
-    { 20, 19, 20, -1, 18, 95, 8701 }, // л
-    { 25, 19, 25, 0, 18, 119, 8796 }, // м
-    { 19, 19, 20, 1, 18, 91, 8915 }, // н
-    { 16, 19, 18, 1, 18, 76, 9006 }, // о
-    { 19, 19, 20, 1, 18, 91, 9082 }, // п
-    { 20, 26, 19, -2, 18, 130, 9173 }, // р
-    { 13, 19, 15, 1, 18, 62, 9303 }, // с
-    { 28, 19, 29, 1, 18, 133, 9365 }, // т
-    { 20, 26, 18, -3, 18, 130, 9498 }, // у
-    { 21, 34, 23, 1, 26, 179, 9628 }, // ф
-    { 20, 19, 18, -1, 18, 95, 9807 }, // х
-    { 19, 25, 20, 1, 18, 119, 9902 }, // ц
-    { 18, 19, 19, 1, 18, 86, 10021 }, // ч
-    { 26, 19, 28, 1, 18, 124, 10107 }, // ш
-    { 26, 25, 28, 1, 18, 163, 10231 }, // щ
-    { 16, 19, 17, 1, 18, 76, 10394 }, // ъ
-    { 23, 19, 25, 1, 18, 110, 10470 }, // ы
-    { 15, 19, 16, 0, 18, 72, 10580 }, // ь
-    { 15, 19, 16, 0, 18, 72, 10652 }, // э
-    { 24, 19, 26, 1, 18, 114, 10724 }, // ю
-    { 18, 19, 18, -1, 18, 86, 10838 }, // я
-    { 14, 28, 16, 1, 27, 98, 10924 }, // ѐ
-    { 16, 26, 16, 1, 25, 104, 11022 }, // ё
-    { 16, 34, 19, 1, 26, 136, 11126 }, // ђ
-    { 14, 28, 14, 0, 27, 98, 11262 }, // ѓ
-    { 14, 19, 16, 1, 18, 67, 11360 }, // є
-    { 13, 19, 14, 0, 18, 62, 11427 }, // ѕ
-    { 10, 27, 11, 1, 26, 68, 11489 }, // і
-    { 13, 26, 11, 1, 25, 85, 11557 }, // ї
-    { 17, 34, 9, -6, 26, 145, 11642 }, // ј
-    { 25, 19, 24, -1, 18, 119, 11787 }, // љ
-    { 22, 19, 24, 1, 18, 105, 11906 }, // њ
-    { 18, 27, 20, 1, 26, 122, 12011 }, // ћ
-    { 17, 28, 18, 1, 27, 119, 12133 }, // ќ
-    { 19, 28, 20, 1, 27, 133, 12252 }, // ѝ
-    { 20, 35, 18, -3, 27, 175, 12385 }, // ў
-    { 19, 25, 20, 1, 18, 119, 12560 }, // џ
-    { 19, 27, 22, 2, 26, 129, 12679 }, // Ѣ
-    { 23, 19, 24, 1, 18, 110, 12808 }, // ѣ
-    { 23, 25, 24, 1, 24, 144, 12918 }, // Ѳ
-    { 16, 19, 18, 1, 18, 76, 13062 }, // ѳ
-    { 24, 25, 24, 2, 24, 150, 13138 }, // Ѵ
-    { 20, 19, 18, 0, 18, 95, 13288 }, // ѵ
-    { 29, 40, 26, -1, 33, 290, 13383 }, // Ҋ
-    { 19, 34, 20, 1, 27, 162, 13673 }, // ҋ
-    { 20, 24, 19, -1, 23, 120, 13835 }, // Ҍ
-    { 14, 25, 16, 1, 24, 88, 13955 }, // ҍ
-    { 20, 24, 20, -1, 24, 120, 14043 }, // Ҏ
-    { 20, 26, 19, -2, 18, 130, 14163 }, // ҏ
-    { 22, 28, 18, -1, 28, 154, 14293 }, // Ґ
-    { 16, 23, 15, 0, 22, 92, 14447 }, // ґ
-    { 21, 23, 19, -1, 23, 121, 14539 }, // Ғ
-    { 14, 19, 14, 0, 18, 67, 14660 }, // ғ
-    { 21, 30, 20, -1, 23, 158, 14727 }, // Ҕ
-    { 16, 25, 18, 1, 17, 100, 14885 }, // ҕ
-    { 36, 31, 31, -3, 24, 279, 14985 }, // Җ
-    { 29, 25, 29, 0, 18, 182, 15264 }, // җ
-    { 17, 31, 18, 0, 24, 132, 15446 }, // Ҙ
-    { 14, 25, 15, 0, 18, 88, 15578 }, // ҙ
-    { 25, 31, 22, -1, 24, 194, 15666 }, // Қ
-    { 17, 25, 18, 1, 18, 107, 15860 }, // қ
-    { 26, 25, 24, -1, 24, 163, 15967 }, // Ҝ
-    { 19, 19, 20, 1, 18, 91, 16130 }, // ҝ
-    { 25, 25, 22, -1, 24, 157, 16221 }, // Ҟ
-    { 17, 25, 18, 1, 24, 107, 16378 }, // ҟ
-    { 26, 25, 26, 2, 24, 163, 16485 }, // Ҡ
-    { 19, 19, 20, 1, 18, 91, 16648 }, // ҡ
-    { 29, 30, 26, -1, 23, 218, 16739 }, // Ң
-    { 19, 25, 21, 1, 18, 119, 16957 }, // ң
-    { 33, 23, 30, -1, 23, 190, 17076 }, // Ҥ
-    { 23, 19, 24, 1, 18, 110, 17266 }, // ҥ
-    { 34, 30, 34, -1, 23, 255, 17376 }, // Ҧ
-    { 26, 26, 28, 1, 18, 169, 17631 }, // ҧ
-    { 25, 25, 26, 1, 24, 157, 17800 }, // Ҩ
-    { 19, 19, 21, 1, 18, 91, 17957 }, // ҩ
-    { 20, 31, 21, 1, 24, 155, 18048 }, // Ҫ
-    { 13, 25, 15, 1, 18, 82, 18203 }, // ҫ
-    { 20, 30, 21, 2, 23, 150, 18285 }, // Ҭ
-    { 28, 25, 30, 1, 18, 175, 18435 }, // ҭ
-    { 22, 23, 21, 2, 23, 127, 18610 }, // Ү
-    { 17, 26, 17, 0, 18, 111, 18737 }, // ү
-    { 22, 23, 21, 2, 23, 127, 18848 }, // Ұ
-    { 17, 26, 17, 0, 18, 111, 18975 }, // ұ
-    { 27, 30, 22, -3, 23, 203, 19086 }, // Ҳ
-    { 20, 25, 18, -1, 18, 125, 19289 }, // ҳ
-    { 28, 30, 28, 1, 23, 210, 19414 }, // Ҵ
-    { 19, 31, 20, 1, 24, 148, 19624 }, // ҵ
-    { 22, 30, 22, 2, 23, 165, 19772 }, // Ҷ
-    { 18, 25, 20, 1, 18, 113, 19937 }, // ҷ
-    { 22, 23, 22, 2, 23, 127, 20050 }, // Ҹ
-    { 18, 19, 19, 1, 18, 86, 20177 }, // ҹ
-    { 21, 23, 22, -1, 23, 121, 20263 }, // Һ
-    { 18, 27, 20, 1, 26, 122, 20384 }, // һ
-    { 24, 25, 26, 1, 24, 150, 20506 }, // Ҽ
-    { 19, 19, 19, 0, 18, 91, 20656 }, // ҽ
-    { 24, 32, 26, 1, 24, 192, 20747 }, // Ҿ
-    { 19, 25, 19, 0, 18, 119, 20939 }, // ҿ
-    { 15, 23, 12, -1, 23, 87, 21058 }, // Ӏ
-    { 36, 34, 31, -3, 33, 306, 21145 }, // Ӂ
-    { 29, 28, 29, 0, 27, 203, 21451 }, // ӂ
-    { 25, 31, 22, -1, 24, 194, 21654 }, // Ӄ
-    { 17, 26, 18, 1, 18, 111, 21848 }, // ӄ
-    { 26, 30, 23, -2, 23, 195, 21959 }, // Ӆ
-    { 20, 25, 20, -1, 18, 125, 22154 }, // ӆ
-    { 29, 30, 26, -1, 23, 218, 22279 }, // Ӈ
-    { 17, 26, 19, 1, 18, 111, 22497 }, // ӈ
-    { 29, 30, 26, -1, 23, 218, 22608 }, // Ӊ
-    { 19, 25, 21, 1, 18, 119, 22826 }, // ӊ
-    { 22, 30, 22, 2, 23, 165, 22945 }, // Ӌ
-    { 17, 25, 18, 1, 18, 107, 23110 }, // ӌ
-    { 32, 30, 30, -2, 23, 240, 23217 }, // Ӎ
-    { 25, 25, 25, 0, 18, 157, 23457 }, // ӎ
-    { 14, 26, 10, -1, 26, 91, 23614 }, // ӏ
-    { 25, 33, 24, -2, 33, 207, 23705 }, // Ӑ
-    { 18, 28, 19, 1, 27, 126, 23912 }, // ӑ
-    { 25, 31, 24, -2, 31, 194, 24038 }, // Ӓ
-    { 18, 26, 19, 1, 25, 117, 24232 }, // ӓ
-    { 33, 23, 30, -3, 23, 190, 24349 }, // Ӕ
-    { 24, 19, 25, 1, 18, 114, 24539 }, // ӕ
-    { 21, 33, 20, -1, 33, 174, 24653 }, // Ӗ
-    { 16, 28, 16, 1, 27, 112, 24827 }, // ӗ
-    { 20, 25, 21, 0, 24, 125, 24939 }, // Ә
-    { 15, 19, 16, 0, 18, 72, 25064 }, // ә
-    { 20, 32, 21, 0, 31, 160, 25136 }, // Ӛ
-    { 16, 26, 16, 0, 25, 104, 25296 }, // ӛ
-    { 36, 32, 31, -3, 31, 288, 25400 }, // Ӝ
-    { 29, 26, 29, 0, 25, 189, 25688 }, // ӝ
-    { 17, 32, 18, 0, 31, 136, 25877 }, // Ӟ
-    { 15, 26, 15, 0, 25, 98, 26013 }, // ӟ
-    { 20, 24, 19, -1, 23, 120, 26111 }, // Ӡ
-    { 19, 25, 17, -2, 17, 119, 26231 }, // ӡ
-    { 29, 30, 26, -1, 30, 218, 26350 }, // Ӣ
-    { 19, 25, 20, 1, 24, 119, 26568 }, // ӣ
-    { 29, 31, 26, -1, 31, 225, 26687 }, // Ӥ
-    { 19, 26, 20, 1, 25, 124, 26912 }, // ӥ
-    { 23, 32, 24, 1, 31, 184, 27036 }, // Ӧ
-    { 17, 26, 18, 1, 25, 111, 27220 }, // ӧ
-    { 23, 25, 24, 1, 24, 144, 27331 }, // Ө
-    { 16, 19, 18, 1, 18, 76, 27475 }, // ө
-    { 23, 32, 24, 1, 31, 184, 27551 }, // Ӫ
-    { 17, 26, 18, 1, 25, 111, 27735 }, // ӫ
-    { 20, 32, 20, 0, 31, 160, 27846 }, // Ӭ
-    { 15, 26, 16, 0, 25, 98, 28006 }, // ӭ
-    { 23, 31, 21, 1, 30, 179, 28104 }, // Ӯ
-    { 20, 32, 18, -3, 24, 160, 28283 }, // ӯ
-    { 23, 32, 21, 1, 31, 184, 28443 }, // Ӱ
-    { 20, 33, 18, -3, 25, 165, 28627 }, // ӱ
-    { 23, 34, 21, 1, 33, 196, 28792 }, // Ӳ
-    { 20, 35, 18, -3, 27, 175, 28988 }, // ӳ
-    { 22, 31, 22, 2, 31, 171, 29163 }, // Ӵ
-    { 18, 26, 19, 1, 25, 117, 29334 }, // ӵ
-    { 21, 30, 19, -1, 23, 158, 29451 }, // Ӷ
-    { 14, 25, 14, 0, 18, 88, 29609 }, // ӷ
-    { 32, 32, 30, -1, 31, 256, 29697 }, // Ӹ
-    { 23, 26, 25, 1, 25, 150, 29953 }, // ӹ
-    { 21, 30, 19, -1, 23, 158, 30103 }, // Ӻ
-    { 14, 25, 14, 0, 18, 88, 30261 }, // ӻ
-    { 27, 30, 22, -3, 23, 203, 30349 }, // Ӽ
-    { 20, 26, 18, -1, 18, 130, 30552 }, // ӽ
-    { 27, 23, 22, -3, 23, 156, 30682 }, // Ӿ
-    { 20, 19, 18, -1, 18, 95, 30838 }, // ӿ
-    { 0, 0, 17, 0, 0, 0, 0 }, //  
-    { 0, 0, 33, 0, 0, 0, 0 }, //  
-    { 0, 0, 17, 0, 0, 0, 0 }, //  
-    { 0, 0, 33, 0, 0, 0, 0 }, //  
-    { 0, 0, 11, 0, 0, 0, 0 }, //  
-    { 0, 0, 8, 0, 0, 0, 0 }, //  
-    { 0, 0, 5, 0, 0, 0, 0 }, //  
-    { 0, 0, 21, 0, 0, 0, 0 }, //  
-    { 0, 0, 9, 0, 0, 0, 0 }, //  
-    { 0, 0, 7, 0, 0, 0, 0 }, //  
-    { 0, 0, 2, 0, 0, 0, 0 }, //  
-    { 0, 0, 0, 0, 0, 0, 0 }, // ​
-    { 2, 28, 0, -1, 20, 14, 0 }, // ‌
-    { 8, 30, 0, -4, 22, 60, 14 }, // ‍
-    { 12, 31, 0, -6, 23, 93, 74 }, // ‎
-    { 12, 31, 0, -6, 23, 93, 167 }, // ‏
-    { 11, 3, 12, 1, 10, 9, 260 }, // ‐
-    { 11, 3, 12, 1, 10, 9, 269 }, // ‑
-    { 16, 3, 21, 2, 13, 12, 278 }, // ‒
-    { 17, 3, 17, 0, 10, 13, 290 }, // –
-    { 33, 3, 33, 0, 10, 25, 303 }, // —
-    { 33, 3, 33, 0, 10, 25, 328 }, // ―
-    { 11, 34, 17, 3, 26, 94, 353 }, // ‖
-    { 17, 8, 17, 0, -1, 34, 447 }, // ‗
-    { 7, 11, 10, 3, 25, 20, 481 }, // ‘
-    { 7, 11, 10, 2, 25, 20, 501 }, // ’
-    { 7, 10, 10, 1, 4, 18, 521 }, // ‚
-    { 6, 11, 8, 1, 25, 17, 539 }, // ‛
-    { 13, 11, 17, 3, 25, 36, 556 }, // “
-    { 14, 11, 17, 2, 25, 39, 592 }, // ”
-    { 14, 10, 17, 1, 4, 35, 631 }, // „
-    { 13, 11, 14, 1, 25, 36, 666 }, // ‟
-    { 15, 22, 15, 1, 24, 83, 702 }, // †
-    { 16, 26, 15, 0, 24, 104, 785 }, // ‡
-    { 8, 7, 10, 1, 12, 14, 889 }, // •
-    { 12, 12, 21, 4, 17, 36, 903 }, // ‣
-    { 5, 5, 9, 2, 4, 7, 939 }, // ․
-    { 14, 6, 17, 1, 5, 21, 946 }, // ‥
-    { 27, 6, 33, 3, 5, 41, 967 }, // …
-    { 5, 6, 9, 2, 12, 8, 1008 }, // ‧
-    { 0, 0, 0, 0, 0, 0, 1016 }, //  
-    { 0, 0, 0, 0, 0, 0, 1016 }, //  
-    { 12, 31, 0, -6, 23, 93, 1016 }, // ‪
-    { 12, 31, 0, -6, 23, 93, 1109 }, // ‫
-    { 10, 31, 0, -5, 23, 78, 1202 }, // ‬
-    { 14, 31, 0, -7, 23, 109, 1280 }, // ‭
-    { 14, 31, 0, -7, 23, 109, 1389 }, // ‮
-    { 0, 0, 4, 0, 0, 0, 1498 }, //  
-    { 41, 26, 45, 2, 24, 267, 1498 }, // ‰
-    { 7, 11, 9, 1, 23, 20, 1765 }, // ′
-    { 13, 11, 15, 1, 23, 36, 1785 }, // ″
-    { 20, 11, 22, 1, 23, 55, 1821 }, // ‴
-    { 7, 11, 9, 1, 23, 20, 1876 }, // ‵
-    { 14, 11, 16, 1, 23, 39, 1896 }, // ‶
-    { 21, 11, 23, 1, 23, 58, 1935 }, // ‷
-    { 14, 7, 16, 1, 0, 25, 1993 }, // ‸
-    { 9, 13, 10, 1, 15, 30, 2018 }, // ‹
-    { 10, 13, 10, 0, 15, 33, 2048 }, // ›
-    { 21, 23, 21, 0, 22, 121, 2081 }, // ※
-    { 19, 26, 19, 1, 25, 124, 2202 }, // ‼
-    { 17, 3, 17, 0, 27, 13, 2326 }, // ‾
-    { 8, 3, 10, 1, 10, 6, 2339 }, // ⁃
-    { 20, 26, 8, -6, 24, 130, 2345 }, // ⁄
-    { 25, 25, 27, 2, 24, 157, 2475 }, // ⁇
-    { 22, 26, 23, 2, 25, 143, 2632 }, // ⁈
-    { 23, 26, 24, 1, 25, 150, 2775 }, // ⁉
-    { 19, 6, 33, 7, 13, 29, 2925 }, // ⁓
-    { 26, 11, 28, 1, 23, 72, 2954 }, // ⁗
-    { 0, 0, 7, 0, 0, 0, 3026 }, //  
-    { 0, 0, 0, 0, 0, 0, 3026 }, // ⁠
-    { 0, 0, 0, 0, 0, 0, 3026 }, // ⁡
-    { 0, 0, 0, 0, 0, 0, 3026 }, // ⁢
-    { 0, 0, 0, 0, 0, 0, 3026 }, // ⁣
-    { 0, 0, 0, 0, 0, 0, 3026 }, // ⁤
-    { 13, 17, 15, 1, 28, 56, 0 }, // ⁰
-    { 14, 16, 15, 0, 28, 56, 56 }, // ⁴
-    { 13, 16, 15, 1, 27, 52, 112 }, // ⁵
-    { 13, 17, 15, 2, 28, 56, 164 }, // ⁶
-    { 12, 16, 15, 3, 27, 48, 220 }, // ⁷
-    { 13, 17, 15, 1, 28, 56, 268 }, // ⁸
-    { 13, 17, 15, 0, 28, 56, 324 }, // ⁹
-    { 13, 12, 19, 3, 23, 39, 380 }, // ⁿ
-    { 13, 16, 15, 1, 11, 52, 419 }, // ₀
-    { 10, 16, 15, 2, 11, 40, 471 }, // ₁
-    { 13, 16, 15, 1, 11, 52, 511 }, // ₂
-    { 12, 16, 15, 1, 11, 48, 563 }, // ₃
-    { 14, 16, 15, 0, 11, 56, 611 }, // ₄
-    { 13, 16, 15, 1, 11, 52, 667 }, // ₅
-    { 13, 16, 15, 2, 11, 52, 719 }, // ₆
-    { 12, 16, 15, 3, 11, 48, 771 }, // ₇
-    { 13, 16, 15, 1, 11, 52, 819 }, // ₈
-    { 13, 16, 15, 0, 11, 52, 871 }, // ₉
-    { 21, 23, 21, 0, 23, 121, 0 }, // ₣
-    { 21, 24, 21, -1, 23, 126, 121 }, // ₤
-    { 40, 24, 41, 0, 23, 240, 247 }, // ₧
-    { 23, 24, 21, -1, 23, 138, 487 }, // €
-    { 19, 13, 33, 7, 18, 62, 0 }, // ←
-    { 13, 21, 33, 10, 22, 69, 62 }, // ↑
-    { 19, 13, 33, 7, 18, 62, 131 }, // →
-    { 13, 21, 33, 10, 22, 69, 193 }, // ↓
-    { 21, 13, 33, 6, 18, 69, 262 }, // ↔
-    { 13, 23, 33, 10, 23, 75, 331 }, // ↕
-    { 15, 22, 33, 9, 22, 83, 406 }, // ↨
-    { 13, 21, 33, 10, 22, 69, 489 }, // ↲
-    { 13, 21, 33, 10, 22, 69, 558 }, // ↳
-    { 19, 15, 33, 7, 19, 72, 627 }, // ↵
-    { 19, 15, 33, 7, 19, 72, 699 }, // ⇐
-    { 15, 19, 33, 9, 21, 72, 771 }, // ⇑
-    { 19, 15, 33, 7, 19, 72, 843 }, // ⇒
-    { 15, 19, 33, 9, 21, 72, 915 }, // ⇓
-    { 21, 15, 33, 6, 19, 79, 987 }, // ⇔
-    { 23, 24, 33, 5, 23, 138, 0 }, // ∀
-    { 17, 27, 21, 2, 26, 115, 138 }, // ∂
-    { 15, 23, 33, 9, 23, 87, 253 }, // ∃
-    { 25, 27, 33, 4, 25, 169, 340 }, // ∅
-    { 20, 24, 22, 1, 24, 120, 509 }, // ∆
-    { 21, 24, 33, 6, 23, 126, 629 }, // ∇
-    { 21, 23, 33, 6, 23, 121, 755 }, // ∈
-    { 21, 29, 33, 6, 26, 153, 876 }, // ∉
-    { 21, 19, 33, 6, 21, 100, 1029 }, // ∊
-    { 21, 23, 33, 6, 23, 121, 1129 }, // ∋
-    { 21, 29, 33, 6, 26, 153, 1250 }, // ∌
-    { 21, 19, 33, 6, 21, 100, 1403 }, // ∍
-    { 25, 29, 27, 1, 23, 182, 1503 }, // ∏
-    { 20, 29, 20, 0, 23, 145, 1685 }, // ∑
-    { 15, 3, 21, 3, 13, 12, 1830 }, // −
-    { 19, 26, 16, -1, 24, 124, 1842 }, // ∕
-    { 13, 26, 16, 2, 24, 85, 1966 }, // ∖
-    { 15, 16, 21, 3, 19, 60, 2051 }, // ∗
-    { 12, 12, 21, 4, 17, 36, 2111 }, // ∘
-    { 6, 6, 21, 7, 12, 9, 2147 }, // ∙
-    { 21, 31, 21, 0, 27, 163, 2156 }, // √
-    { 16, 13, 21, 2, 17, 52, 2319 }, // ∝
-    { 21, 11, 21, 0, 16, 58, 2371 }, // ∞
-    { 21, 23, 33, 6, 23, 121, 2429 }, // ∟
-    { 23, 23, 33, 4, 23, 133, 2550 }, // ∠
-    { 4, 34, 17, 6, 26, 34, 2683 }, // ∣
-    { 10, 34, 17, 3, 26, 85, 2717 }, // ∥
-    { 21, 23, 33, 6, 23, 121, 2802 }, // ∧
-    { 21, 23, 33, 6, 23, 121, 2923 }, // ∨
-    { 19, 24, 33, 7, 24, 114, 3044 }, // ∩
-    { 19, 24, 33, 7, 23, 114, 3158 }, // ∪
-    { 18, 34, 21, 1, 26, 153, 3272 }, // ∫
-    { 21, 19, 33, 6, 18, 100, 3425 }, // ∴
-    { 21, 19, 33, 6, 18, 100, 3525 }, // ∵
-    { 7, 18, 10, 1, 20, 32, 3625 }, // ∶
-    { 21, 19, 33, 6, 18, 100, 3657 }, // ∷
-    { 19, 6, 33, 7, 13, 29, 3757 }, // ∼
-    { 19, 18, 33, 7, 20, 86, 3786 }, // ≅
-    { 16, 12, 21, 2, 17, 48, 3872 }, // ≈
-    { 19, 11, 33, 7, 15, 53, 3920 }, // ≍
-    { 15, 15, 21, 3, 19, 57, 3973 }, // ≠
-    { 19, 15, 33, 7, 17, 72, 4030 }, // ≡
-    { 15, 20, 21, 3, 20, 75, 4102 }, // ≤
-    { 15, 20, 21, 3, 20, 75, 4177 }, // ≥
-    { 27, 16, 33, 3, 19, 108, 4252 }, // ≪
-    { 27, 16, 33, 3, 19, 108, 4360 }, // ≫
-    { 21, 19, 33, 6, 21, 100, 4468 }, // ⊃
-    { 21, 29, 33, 6, 26, 153, 4568 }, // ⊄
-    { 21, 29, 33, 6, 26, 153, 4721 }, // ⊅
-    { 21, 23, 33, 6, 23, 121, 4874 }, // ⊆
-    { 21, 23, 33, 6, 23, 121, 4995 }, // ⊇
-    { 25, 25, 33, 4, 24, 157, 5116 }, // ⊕
-    { 25, 25, 33, 4, 24, 157, 5273 }, // ⊖
-    { 25, 25, 33, 4, 24, 157, 5430 }, // ⊗
-    { 25, 25, 33, 4, 24, 157, 5587 }, // ⊘
-    { 19, 23, 33, 7, 23, 110, 5744 }, // ⊥
-    { 6, 6, 21, 7, 12, 9, 5854 }, // ⋅
-    { 27, 6, 33, 3, 12, 41, 5863 }, // ⋯
-    { 31, 32, 33, 1, 28, 248, 0 }, // �
+    { 16, 13, 17, 1, 15, 52, 9886 }, // «
+    { 15, 8, 21, 3, 15, 30, 940 }, // ¬
+    { 11, 3, 12, 1, 10, 9, 970 }, // ­
+    { 19, 18, 19, 0, 26, 86, 979 }, // ®
+    { 11, 4, 20, 5, 24, 11, 1065 }, // ¯
+    { 12, 11, 17, 3, 23, 33, 1076 }, // °
+    { 15, 20, 21, 3, 20, 75, 1109 }, // ±
+    { 13, 16, 15, 1, 28, 52, 1184 }, // ²
+    { 12, 17, 15, 1, 28, 51, 1236 }, // ³
+    { 7, 8, 20, 7, 27, 14, 1287 }, // ´
+    { 21, 26, 20, -1, 18, 137, 1301 }, // µ
+    { 21, 28, 19, -1, 23, 147, 1438 }, // ¶
+    { 6, 6, 10, 2, 12, 9, 1585 }, // ·
+    { 8, 8, 20, 6, -1, 16, 1594 }, // ¸
+    { 10, 16, 15, 2, 28, 40, 1610 }, // ¹
+    { 13, 16, 15, 1, 24, 52, 1650 }, // º
+    { 16, 13, 17, 0, 15, 52, 9938 }, // »
+    { 32, 26, 36, 2, 24, 208, 1702 }, // ¼
+    { 32, 26, 36, 2, 24, 208, 1910 }, // ½
+    { 33, 26, 36, 1, 24, 215, 2118 }, // ¾
+    { 11, 25, 14, 0, 18, 69, 2333 }, // ¿
+    { 25, 32, 24, -2, 32, 200, 9990 }, // À
+    { 25, 32, 24, -2, 32, 200, 10190 }, // Á
+    { 25, 32, 24, -2, 32, 200, 10390 }, // Â
+    { 25, 31, 24, -2, 31, 194, 2402 }, // Ã
+    { 25, 31, 24, -2, 31, 194, 10590 }, // Ä
+    { 25, 33, 24, -2, 33, 207, 2596 }, // Å
+    { 33, 23, 30, -3, 23, 190, 2803 }, // Æ
+    { 20, 33, 21, 1, 24, 165, 10784 }, // Ç
+    { 21, 32, 20, -1, 32, 168, 10949 }, // È
+    { 21, 32, 20, -1, 32, 168, 11117 }, // É
+    { 21, 32, 20, -1, 32, 168, 11285 }, // Ê
+    { 21, 31, 20, -1, 31, 163, 11453 }, // Ë
+    { 15, 32, 12, -1, 32, 120, 11616 }, // Ì
+    { 16, 32, 12, -1, 32, 128, 11736 }, // Í
+    { 16, 32, 12, -1, 32, 128, 11864 }, // Î
+    { 17, 31, 12, -1, 31, 132, 11992 }, // Ï
+    { 24, 25, 24, -1, 24, 150, 2993 }, // Ð
+    { 28, 32, 25, -1, 31, 224, 12124 }, // Ñ
+    { 23, 33, 24, 1, 32, 190, 12348 }, // Ò
+    { 23, 33, 24, 1, 32, 190, 12538 }, // Ó
+    { 23, 33, 24, 1, 32, 190, 12728 }, // Ô
+    { 23, 32, 24, 1, 31, 184, 3143 }, // Õ
+    { 23, 32, 24, 1, 31, 184, 12918 }, // Ö
+    { 14, 14, 21, 3, 18, 49, 3327 }, // ×
+    { 26, 25, 24, -1, 24, 163, 3376 }, // Ø
+    { 24, 33, 25, 3, 32, 198, 13102 }, // Ù
+    { 24, 33, 25, 3, 32, 198, 13300 }, // Ú
+    { 24, 33, 25, 3, 32, 198, 13498 }, // Û
+    { 24, 32, 25, 3, 31, 192, 13696 }, // Ü
+    { 22, 32, 21, 2, 32, 176, 3539 }, // Ý
+    { 20, 23, 20, -1, 23, 115, 3715 }, // Þ
+    { 25, 34, 21, -5, 26, 213, 3830 }, // ß
+    { 18, 28, 19, 1, 27, 126, 13888 }, // à
+    { 18, 28, 19, 1, 27, 126, 14014 }, // á
+    { 18, 28, 19, 1, 27, 126, 14140 }, // â
+    { 18, 27, 19, 1, 26, 122, 4043 }, // ã
+    { 18, 26, 19, 1, 25, 117, 14266 }, // ä
+    { 18, 29, 19, 1, 28, 131, 4165 }, // å
+    { 24, 19, 25, 1, 18, 114, 4296 }, // æ
+    { 13, 27, 15, 1, 18, 88, 14383 }, // ç
+    { 14, 28, 16, 1, 27, 98, 14471 }, // è
+    { 15, 28, 16, 1, 27, 105, 14569 }, // é
+    { 15, 28, 16, 1, 27, 105, 14674 }, // ê
+    { 16, 26, 16, 1, 25, 104, 14779 }, // ë
+    { 9, 28, 11, 1, 27, 63, 14883 }, // ì
+    { 12, 28, 11, 1, 27, 84, 14946 }, // í
+    { 12, 28, 11, 1, 27, 84, 15030 }, // î
+    { 13, 26, 11, 1, 25, 85, 15114 }, // ï
+    { 16, 28, 18, 1, 27, 112, 4410 }, // ð
+    { 19, 27, 20, 1, 26, 129, 15199 }, // ñ
+    { 16, 28, 18, 1, 27, 112, 15328 }, // ò
+    { 16, 28, 18, 1, 27, 112, 15440 }, // ó
+    { 16, 28, 18, 1, 27, 112, 15552 }, // ô
+    { 17, 27, 18, 1, 26, 115, 4522 }, // õ
+    { 17, 26, 18, 1, 25, 111, 15664 }, // ö
+    { 15, 16, 21, 3, 19, 60, 4637 }, // ÷
+    { 21, 19, 18, -2, 18, 100, 4697 }, // ø
+    { 19, 28, 20, 1, 27, 133, 15775 }, // ù
+    { 19, 28, 20, 1, 27, 133, 15908 }, // ú
+    { 19, 28, 20, 1, 27, 133, 16041 }, // û
+    { 19, 26, 20, 1, 25, 124, 16174 }, // ü
+    { 20, 35, 18, -3, 27, 175, 4797 }, // ý
+    { 20, 34, 18, -3, 26, 170, 4972 }, // þ
+    { 20, 33, 18, -3, 25, 165, 5142 }, // ÿ
+    { 25, 30, 24, -2, 30, 188, 5307 }, // Ā
+    { 18, 25, 19, 1, 24, 113, 5495 }, // ā
+    { 25, 32, 24, -2, 32, 200, 5608 }, // Ă
+    { 18, 27, 19, 1, 26, 122, 5808 }, // ă
+    { 25, 31, 24, -2, 24, 194, 5930 }, // Ą
+    { 18, 25, 19, 1, 18, 113, 6124 }, // ą
+    { 20, 33, 21, 1, 32, 165, 6237 }, // Ć
+    { 15, 28, 15, 1, 27, 105, 6402 }, // ć
+    { 20, 33, 21, 1, 32, 165, 6507 }, // Ĉ
+    { 15, 28, 15, 1, 27, 105, 6672 }, // ĉ
+    { 20, 32, 21, 1, 31, 160, 6777 }, // Ċ
+    { 13, 26, 15, 1, 25, 85, 6937 }, // ċ
+    { 21, 33, 21, 1, 32, 174, 7022 }, // Č
+    { 16, 28, 15, 1, 27, 112, 7196 }, // č
+    { 24, 33, 24, -1, 32, 198, 7308 }, // Ď
+    { 24, 30, 20, 1, 29, 180, 7506 }, // ď
+    { 24, 25, 24, -1, 24, 150, 7686 }, // Đ
+    { 20, 27, 19, 1, 26, 135, 7836 }, // đ
+    { 21, 30, 20, -1, 30, 158, 7971 }, // Ē
+    { 15, 25, 16, 1, 24, 94, 8129 }, // ē
+    { 21, 32, 20, -1, 32, 168, 8223 }, // Ĕ
+    { 16, 27, 16, 1, 26, 108, 8391 }, // ĕ
+    { 21, 31, 20, -1, 31, 163, 8499 }, // Ė
+    { 14, 26, 16, 1, 25, 91, 8662 }, // ė
+    { 21, 30, 20, -1, 23, 158, 8753 }, // Ę
+    { 14, 25, 16, 1, 18, 88, 8911 }, // ę
+    { 22, 32, 20, -1, 32, 176, 8999 }, // Ě
+    { 16, 28, 16, 1, 27, 112, 9175 }, // ě
+    { 21, 33, 23, 2, 32, 174, 9287 }, // Ĝ
+    { 22, 35, 16, -3, 27, 193, 9461 }, // ĝ
+    { 21, 33, 23, 2, 32, 174, 9654 }, // Ğ
+    { 22, 34, 16, -3, 26, 187, 9828 }, // ğ
+    { 21, 32, 23, 2, 31, 168, 10015 }, // Ġ
+    { 22, 33, 16, -3, 25, 182, 10183 }, // ġ
+    { 21, 33, 23, 2, 24, 174, 10365 }, // Ģ
+    { 22, 36, 16, -3, 28, 198, 10539 }, // ģ
+    { 29, 32, 26, -1, 32, 232, 10737 }, // Ĥ
+    { 18, 35, 20, 1, 34, 158, 10969 }, // ĥ
+    { 29, 23, 26, -1, 23, 167, 11127 }, // Ħ
+    { 18, 27, 20, 1, 26, 122, 11294 }, // ħ
+    { 16, 31, 12, -1, 31, 124, 11416 }, // Ĩ
+    { 13, 27, 11, 1, 26, 88, 11540 }, // ĩ
+    { 16, 30, 12, -1, 30, 120, 11628 }, // Ī
+    { 13, 25, 11, 1, 24, 82, 11748 }, // ī
+    { 16, 32, 12, -1, 32, 128, 11830 }, // Ĭ
+    { 13, 27, 11, 1, 26, 88, 11958 }, // ĭ
+    { 15, 30, 12, -1, 23, 113, 12046 }, // Į
+    { 10, 33, 11, 1, 26, 83, 12159 }, // į
+    { 15, 31, 12, -1, 31, 117, 12242 }, // İ
+    { 9, 19, 11, 1, 18, 43, 12359 }, // ı
+    { 27, 30, 24, -1, 23, 203, 12402 }, // Ĳ
+    { 20, 34, 20, 1, 26, 170, 12605 }, // ĳ
+    { 22, 39, 12, -6, 32, 215, 12775 }, // Ĵ
+    { 19, 35, 9, -6, 27, 167, 12990 }, // ĵ
+    { 25, 32, 23, -1, 23, 200, 13157 }, // Ķ
+    { 16, 35, 17, 1, 26, 140, 13357 }, // ķ
+    { 17, 19, 18, 1, 18, 81, 13497 }, // ĸ
+    { 19, 32, 19, -1, 32, 152, 13578 }, // Ĺ
+    { 12, 35, 10, 1, 34, 105, 13730 }, // ĺ
+    { 19, 32, 19, -1, 23, 152, 13835 }, // Ļ
+    { 11, 35, 10, -1, 26, 97, 13987 }, // ļ
+    { 20, 26, 19, -1, 26, 130, 14084 }, // Ľ
+    { 15, 30, 11, 1, 29, 113, 14214 }, // ľ
+    { 20, 23, 19, -1, 23, 115, 14327 }, // Ŀ
+    { 14, 27, 13, 1, 26, 95, 14442 }, // ŀ
+    { 19, 23, 19, -1, 23, 110, 14537 }, // Ł
+    { 13, 27, 10, -1, 26, 88, 14647 }, // ł
+    { 28, 33, 25, -1, 32, 231, 14735 }, // Ń
+    { 19, 28, 20, 1, 27, 133, 14966 }, // ń
+    { 28, 32, 25, -1, 23, 224, 15099 }, // Ņ
+    { 19, 27, 20, 1, 18, 129, 15323 }, // ņ
+    { 28, 33, 25, -1, 32, 231, 15452 }, // Ň
+    { 19, 28, 20, 1, 27, 133, 15683 }, // ň
+    { 25, 26, 27, 2, 25, 163, 15816 }, // ŉ
+    { 28, 30, 25, -1, 23, 210, 15979 }, // Ŋ
+    { 17, 26, 19, 1, 18, 111, 16189 }, // ŋ
+    { 23, 31, 24, 1, 30, 179, 16300 }, // Ō
+    { 17, 25, 18, 1, 24, 107, 16479 }, // ō
+    { 23, 33, 24, 1, 32, 190, 16586 }, // Ŏ
+    { 17, 27, 18, 1, 26, 115, 16776 }, // ŏ
+    { 24, 34, 24, 1, 33, 204, 16891 }, // Ő
+    { 19, 28, 18, 1, 27, 133, 17095 }, // ő
+    { 31, 24, 32, 1, 23, 186, 16298 }, // Œ
+    { 25, 19, 27, 1, 18, 119, 16484 }, // œ
+    { 22, 33, 21, -1, 32, 182, 17228 }, // Ŕ
+    { 14, 27, 14, 1, 27, 95, 17410 }, // ŕ
+    { 22, 33, 21, -1, 24, 182, 17505 }, // Ŗ
+    { 16, 27, 14, -1, 18, 108, 17687 }, // ŗ
+    { 22, 33, 21, -1, 32, 182, 17795 }, // Ř
+    { 16, 27, 14, 1, 27, 108, 17977 }, // ř
+    { 17, 33, 18, 0, 32, 141, 18085 }, // Ś
+    { 15, 28, 14, 0, 27, 105, 18226 }, // ś
+    { 17, 33, 18, 0, 32, 141, 18331 }, // Ŝ
+    { 15, 28, 14, 0, 27, 105, 18472 }, // ŝ
+    { 17, 33, 18, 0, 24, 141, 18577 }, // Ş
+    { 13, 27, 14, 0, 18, 88, 18718 }, // ş
+    { 18, 33, 18, 0, 32, 149, 18806 }, // Š
+    { 16, 28, 14, 0, 27, 112, 18955 }, // š
+    { 20, 32, 21, 2, 23, 160, 19067 }, // Ţ
+    { 13, 31, 13, 0, 22, 101, 19227 }, // ţ
+    { 20, 32, 21, 2, 32, 160, 19328 }, // Ť
+    { 14, 28, 13, 1, 27, 98, 19488 }, // ť
+    { 20, 23, 21, 2, 23, 115, 19586 }, // Ŧ
+    { 13, 23, 13, 0, 22, 75, 19701 }, // ŧ
+    { 24, 32, 25, 3, 31, 192, 19776 }, // Ũ
+    { 19, 27, 20, 1, 26, 129, 19968 }, // ũ
+    { 24, 31, 25, 3, 30, 186, 20097 }, // Ū
+    { 19, 25, 20, 1, 24, 119, 20283 }, // ū
+    { 24, 33, 25, 3, 32, 198, 20402 }, // Ŭ
+    { 19, 27, 20, 1, 26, 129, 20600 }, // ŭ
+    { 24, 34, 25, 3, 33, 204, 20729 }, // Ů
+    { 19, 29, 20, 1, 28, 138, 20933 }, // ů
+    { 24, 34, 25, 3, 33, 204, 21071 }, // Ű
+    { 19, 28, 20, 1, 27, 133, 21275 }, // ű
+    { 24, 30, 25, 3, 23, 180, 21408 }, // Ų
+    { 19, 25, 20, 1, 18, 119, 21588 }, // ų
+    { 34, 33, 34, 2, 32, 281, 21707 }, // Ŵ
+    { 25, 28, 26, 0, 27, 175, 21988 }, // ŵ
+    { 22, 32, 21, 2, 32, 176, 22163 }, // Ŷ
+    { 20, 35, 18, -3, 27, 175, 22339 }, // ŷ
+    { 22, 31, 21, 2, 31, 171, 22514 }, // Ÿ
+    { 20, 33, 19, -1, 32, 165, 22685 }, // Ź
+    { 16, 28, 16, 0, 27, 112, 22850 }, // ź
+    { 20, 32, 19, -1, 31, 160, 22962 }, // Ż
+    { 16, 26, 16, 0, 25, 104, 23122 }, // ż
+    { 20, 33, 19, -1, 32, 165, 23226 }, // Ž
+    { 16, 28, 16, 0, 27, 112, 23391 }, // ž
+    { 24, 34, 14, -6, 26, 204, 23503 }, // ſ
+    { 7, 8, 0, -5, 27, 14, 23707 }, // ̀
+    { 7, 8, 0, -2, 27, 14, 23721 }, // ́
+    { 11, 8, 0, -6, 27, 22, 23735 }, // ̂
+    { 12, 6, 0, -6, 26, 18, 23757 }, // ̃
+    { 10, 4, 0, -5, 24, 10, 23775 }, // ̄
+    { 11, 6, 0, -5, 26, 17, 23785 }, // ̆
+    { 6, 5, 0, -3, 25, 8, 23802 }, // ̇
+    { 12, 5, 0, -6, 25, 15, 23810 }, // ̈
+    { 9, 10, 0, -4, 29, 23, 23825 }, // ̉
+    { 8, 10, 0, -4, 28, 20, 23848 }, // ̊
+    { 13, 8, 0, -6, 27, 26, 23868 }, // ̋
+    { 11, 8, 0, -5, 27, 22, 23894 }, // ̌
+    { 10, 8, 0, -7, 27, 20, 23916 }, // ̏
+    { 11, 7, 0, -6, 26, 20, 23936 }, // ̑
+    { 6, 9, 0, -3, 28, 14, 23956 }, // ̒
+    { 7, 10, 0, -3, 29, 18, 23970 }, // ̓
+    { 6, 10, 0, -4, 29, 15, 23988 }, // ̔
+    { 5, 9, 0, -3, 29, 12, 24003 }, // ̕
+    { 6, 8, 0, -3, 21, 12, 24015 }, // ̛
+    { 6, 6, 0, -3, -2, 9, 24027 }, // ̣
+    { 12, 5, 0, -6, -3, 15, 24036 }, // ̤
+    { 8, 8, 0, -4, -1, 16, 24051 }, // ̥
+    { 7, 8, 0, -4, -1, 14, 24067 }, // ̦
+    { 8, 8, 0, -4, -1, 16, 24081 }, // ̧
+    { 7, 8, 0, -4, 1, 14, 24097 }, // ̨
+    { 5, 8, 9, -1, -1, 10, 24111 }, // ̩
+    { 11, 7, 0, -6, -2, 20, 24121 }, // ̭
+    { 11, 7, 0, -6, -1, 20, 24141 }, // ̮
+    { 12, 6, 0, -6, -2, 18, 24161 }, // ̰
+    { 10, 3, 0, -5, -3, 8, 24179 }, // ̱
+    { 11, 7, 0, -6, 26, 20, 24187 }, // ͂
+    { 12, 13, 0, -7, 33, 39, 24207 }, // ̈́
+    { 6, 6, 0, -2, -2, 9, 24246 }, // ͅ
+    { 21, 32, 20, -1, 32, 168, 24255 }, // Ѐ
+    { 21, 31, 20, -1, 31, 163, 0 }, // Ё
+    { 21, 30, 25, 2, 23, 158, 24423 }, // Ђ
+    { 21, 32, 19, -1, 32, 168, 24581 }, // Ѓ
+    { 20, 25, 21, 1, 24, 125, 24749 }, // Є
+    { 17, 25, 18, 0, 24, 107, 24874 }, // Ѕ
+    { 15, 23, 12, -1, 23, 87, 24981 }, // І
+    { 17, 31, 12, -1, 31, 132, 25068 }, // Ї
+    { 20, 30, 12, -6, 23, 150, 25200 }, // Ј
+    { 31, 24, 29, -2, 23, 186, 25350 }, // Љ
+    { 31, 24, 31, -1, 23, 186, 25536 }, // Њ
+    { 22, 23, 26, 2, 23, 127, 25722 }, // Ћ
+    { 25, 33, 22, -1, 32, 207, 25849 }, // Ќ
+    { 29, 32, 26, -1, 32, 232, 26056 }, // Ѝ
+    { 23, 34, 21, 1, 33, 196, 26288 }, // Ў
+    { 27, 31, 25, -1, 23, 210, 26484 }, // Џ
+    { 25, 24, 24, -2, 24, 150, 163 }, // А
+    { 21, 24, 20, -1, 23, 126, 313 }, // Б
+    { 20, 25, 20, -1, 24, 125, 439 }, // В
+    { 21, 23, 19, -1, 23, 121, 564 }, // Г
+    { 27, 30, 24, -2, 23, 203, 685 }, // Д
+    { 21, 23, 20, -1, 23, 121, 888 }, // Е
+    { 36, 25, 31, -3, 24, 225, 1009 }, // Ж
+    { 17, 25, 18, 0, 24, 107, 1234 }, // З
+    { 29, 23, 26, -1, 23, 167, 1341 }, // И
+    { 29, 33, 26, -1, 33, 240, 1508 }, // Й
+    { 25, 25, 22, -1, 24, 157, 1748 }, // К
+    { 26, 24, 23, -2, 23, 156, 1905 }, // Л
+    { 32, 23, 30, -2, 23, 184, 2061 }, // М
+    { 29, 23, 26, -1, 23, 167, 2245 }, // Н
+    { 23, 25, 24, 1, 24, 144, 2412 }, // О
+    { 27, 23, 25, -1, 23, 156, 2556 }, // П
+    { 20, 24, 20, -1, 24, 120, 2712 }, // Р
+    { 20, 25, 21, 1, 24, 125, 2832 }, // С
+    { 20, 23, 21, 2, 23, 115, 2957 }, // Т
+    { 23, 24, 21, 1, 23, 138, 3072 }, // У
+    { 24, 25, 24, 0, 24, 150, 3210 }, // Ф
+    { 27, 23, 22, -3, 23, 156, 3360 }, // Х
+    { 27, 30, 25, -1, 23, 203, 3516 }, // Ц
+    { 22, 23, 22, 2, 23, 127, 3719 }, // Ч
+    { 35, 23, 33, -1, 23, 202, 3846 }, // Ш
+    { 35, 30, 33, -1, 23, 263, 4048 }, // Щ
+    { 20, 24, 23, 2, 23, 120, 4311 }, // Ъ
+    { 32, 24, 30, -1, 23, 192, 4431 }, // Ы
+    { 20, 24, 19, -1, 23, 120, 4623 }, // Ь
+    { 20, 25, 20, 0, 24, 125, 4743 }, // Э
+    { 33, 25, 33, -1, 24, 207, 4868 }, // Ю
+    { 24, 24, 21, -2, 23, 144, 5075 }, // Я
+    { 18, 19, 19, 1, 18, 86, 5219 }, // а
+    { 19, 28, 18, 1, 27, 133, 5305 }, // б
+    { 15, 19, 17, 1, 18, 72, 5438 }, // в
+    { 14, 19, 14, 0, 18, 67, 5510 }, // г
+    { 16, 27, 18, 1, 26, 108, 5577 }, // д
+    { 14, 19, 16, 1, 18, 67, 5685 }, // е
+    { 29, 19, 29, 0, 18, 138, 5752 }, // ж
+    { 14, 19, 15, 0, 18, 67, 5890 }, // з
+    { 19, 19, 20, 1, 18, 91, 5957 }, // и
+    { 19, 28, 20, 1, 27, 133, 6048 }, // й
+    { 17, 19, 18, 1, 18, 81, 6181 }, // к
+    { 20, 19, 20, -1, 18, 95, 6262 }, // л
+    { 25, 19, 25, 0, 18, 119, 6357 }, // м
+    { 19, 19, 20, 1, 18, 91, 6476 }, // н
+    { 16, 19, 18, 1, 18, 76, 6567 }, // о
+    { 19, 19, 20, 1, 18, 91, 6643 }, // п
+    { 20, 26, 19, -2, 18, 130, 6734 }, // р
+    { 13, 19, 15, 1, 18, 62, 6864 }, // с
+    { 28, 19, 29, 1, 18, 133, 6926 }, // т
+    { 20, 26, 18, -3, 18, 130, 7059 }, // у
+    { 21, 34, 23, 1, 26, 179, 7189 }, // ф
+    { 20, 19, 18, -1, 18, 95, 7368 }, // х
+    { 19, 25, 20, 1, 18, 119, 7463 }, // ц
+    { 18, 19, 19, 1, 18, 86, 7582 }, // ч
+    { 26, 19, 28, 1, 18, 124, 7668 }, // ш
+    { 26, 25, 28, 1, 18, 163, 7792 }, // щ
+    { 16, 19, 17, 1, 18, 76, 7955 }, // ъ
+    { 23, 19, 25, 1, 18, 110, 8031 }, // ы
+    { 15, 19, 16, 0, 18, 72, 8141 }, // ь
+    { 15, 19, 16, 0, 18, 72, 8213 }, // э
+    { 24, 19, 26, 1, 18, 114, 8285 }, // ю
+    { 18, 19, 18, -1, 18, 86, 8399 }, // я
+    { 14, 28, 16, 1, 27, 98, 26694 }, // ѐ
+    { 16, 26, 16, 1, 25, 104, 8485 }, // ё
+    { 16, 34, 19, 1, 26, 136, 26792 }, // ђ
+    { 14, 28, 14, 0, 27, 98, 26928 }, // ѓ
+    { 14, 19, 16, 1, 18, 67, 27026 }, // є
+    { 13, 19, 14, 0, 18, 62, 27093 }, // ѕ
+    { 10, 27, 11, 1, 26, 68, 27155 }, // і
+    { 13, 26, 11, 1, 25, 85, 27223 }, // ї
+    { 17, 34, 9, -6, 26, 145, 27308 }, // ј
+    { 25, 19, 24, -1, 18, 119, 27453 }, // љ
+    { 22, 19, 24, 1, 18, 105, 27572 }, // њ
+    { 18, 27, 20, 1, 26, 122, 27677 }, // ћ
+    { 17, 28, 18, 1, 27, 119, 27799 }, // ќ
+    { 19, 28, 20, 1, 27, 133, 27918 }, // ѝ
+    { 20, 35, 18, -3, 27, 175, 28051 }, // ў
+    { 19, 25, 20, 1, 18, 119, 28226 }, // џ
+    { 19, 27, 22, 2, 26, 129, 28345 }, // Ѣ
+    { 23, 19, 24, 1, 18, 110, 28474 }, // ѣ
+    { 23, 25, 24, 1, 24, 144, 28584 }, // Ѳ
+    { 16, 19, 18, 1, 18, 76, 28728 }, // ѳ
+    { 24, 25, 24, 2, 24, 150, 28804 }, // Ѵ
+    { 20, 19, 18, 0, 18, 95, 28954 }, // ѵ
+    { 29, 40, 26, -1, 33, 290, 29049 }, // Ҋ
+    { 19, 34, 20, 1, 27, 162, 29339 }, // ҋ
+    { 20, 24, 19, -1, 23, 120, 29501 }, // Ҍ
+    { 14, 25, 16, 1, 24, 88, 29621 }, // ҍ
+    { 20, 24, 20, -1, 24, 120, 29709 }, // Ҏ
+    { 20, 26, 19, -2, 18, 130, 29829 }, // ҏ
+    { 22, 28, 18, -1, 28, 154, 29959 }, // Ґ
+    { 16, 23, 15, 0, 22, 92, 30113 }, // ґ
+    { 21, 23, 19, -1, 23, 121, 30205 }, // Ғ
+    { 14, 19, 14, 0, 18, 67, 30326 }, // ғ
+    { 21, 30, 20, -1, 23, 158, 30393 }, // Ҕ
+    { 16, 25, 18, 1, 17, 100, 30551 }, // ҕ
+    { 36, 31, 31, -3, 24, 279, 30651 }, // Җ
+    { 29, 25, 29, 0, 18, 182, 0 }, // җ
+    { 17, 31, 18, 0, 24, 132, 182 }, // Ҙ
+    { 14, 25, 15, 0, 18, 88, 314 }, // ҙ
+    { 25, 31, 22, -1, 24, 194, 402 }, // Қ
+    { 17, 25, 18, 1, 18, 107, 596 }, // қ
+    { 26, 25, 24, -1, 24, 163, 703 }, // Ҝ
+    { 19, 19, 20, 1, 18, 91, 866 }, // ҝ
+    { 25, 25, 22, -1, 24, 157, 957 }, // Ҟ
+    { 17, 25, 18, 1, 24, 107, 1114 }, // ҟ
+    { 26, 25, 26, 2, 24, 163, 1221 }, // Ҡ
+    { 19, 19, 20, 1, 18, 91, 1384 }, // ҡ
+    { 29, 30, 26, -1, 23, 218, 1475 }, // Ң
+    { 19, 25, 21, 1, 18, 119, 1693 }, // ң
+    { 33, 23, 30, -1, 23, 190, 1812 }, // Ҥ
+    { 23, 19, 24, 1, 18, 110, 2002 }, // ҥ
+    { 34, 30, 34, -1, 23, 255, 2112 }, // Ҧ
+    { 26, 26, 28, 1, 18, 169, 2367 }, // ҧ
+    { 25, 25, 26, 1, 24, 157, 2536 }, // Ҩ
+    { 19, 19, 21, 1, 18, 91, 2693 }, // ҩ
+    { 20, 31, 21, 1, 24, 155, 2784 }, // Ҫ
+    { 13, 25, 15, 1, 18, 82, 2939 }, // ҫ
+    { 20, 30, 21, 2, 23, 150, 3021 }, // Ҭ
+    { 28, 25, 30, 1, 18, 175, 3171 }, // ҭ
+    { 22, 23, 21, 2, 23, 127, 3346 }, // Ү
+    { 17, 26, 17, 0, 18, 111, 3473 }, // ү
+    { 22, 23, 21, 2, 23, 127, 3584 }, // Ұ
+    { 17, 26, 17, 0, 18, 111, 3711 }, // ұ
+    { 27, 30, 22, -3, 23, 203, 3822 }, // Ҳ
+    { 20, 25, 18, -1, 18, 125, 4025 }, // ҳ
+    { 28, 30, 28, 1, 23, 210, 4150 }, // Ҵ
+    { 19, 31, 20, 1, 24, 148, 4360 }, // ҵ
+    { 22, 30, 22, 2, 23, 165, 4508 }, // Ҷ
+    { 18, 25, 20, 1, 18, 113, 4673 }, // ҷ
+    { 22, 23, 22, 2, 23, 127, 4786 }, // Ҹ
+    { 18, 19, 19, 1, 18, 86, 4913 }, // ҹ
+    { 21, 23, 22, -1, 23, 121, 4999 }, // Һ
+    { 18, 27, 20, 1, 26, 122, 5120 }, // һ
+    { 24, 25, 26, 1, 24, 150, 5242 }, // Ҽ
+    { 19, 19, 19, 0, 18, 91, 5392 }, // ҽ
+    { 24, 32, 26, 1, 24, 192, 5483 }, // Ҿ
+    { 19, 25, 19, 0, 18, 119, 5675 }, // ҿ
+    { 15, 23, 12, -1, 23, 87, 5794 }, // Ӏ
+    { 36, 34, 31, -3, 33, 306, 5881 }, // Ӂ
+    { 29, 28, 29, 0, 27, 203, 6187 }, // ӂ
+    { 25, 31, 22, -1, 24, 194, 6390 }, // Ӄ
+    { 17, 26, 18, 1, 18, 111, 6584 }, // ӄ
+    { 26, 30, 23, -2, 23, 195, 6695 }, // Ӆ
+    { 20, 25, 20, -1, 18, 125, 6890 }, // ӆ
+    { 29, 30, 26, -1, 23, 218, 7015 }, // Ӈ
+    { 17, 26, 19, 1, 18, 111, 7233 }, // ӈ
+    { 29, 30, 26, -1, 23, 218, 7344 }, // Ӊ
+    { 19, 25, 21, 1, 18, 119, 7562 }, // ӊ
+    { 22, 30, 22, 2, 23, 165, 7681 }, // Ӌ
+    { 17, 25, 18, 1, 18, 107, 7846 }, // ӌ
+    { 32, 30, 30, -2, 23, 240, 7953 }, // Ӎ
+    { 25, 25, 25, 0, 18, 157, 8193 }, // ӎ
+    { 14, 26, 10, -1, 26, 91, 8350 }, // ӏ
+    { 25, 33, 24, -2, 33, 207, 8441 }, // Ӑ
+    { 18, 28, 19, 1, 27, 126, 8648 }, // ӑ
+    { 25, 31, 24, -2, 31, 194, 8774 }, // Ӓ
+    { 18, 26, 19, 1, 25, 117, 8968 }, // ӓ
+    { 33, 23, 30, -3, 23, 190, 9085 }, // Ӕ
+    { 24, 19, 25, 1, 18, 114, 9275 }, // ӕ
+    { 21, 33, 20, -1, 33, 174, 9389 }, // Ӗ
+    { 16, 28, 16, 1, 27, 112, 9563 }, // ӗ
+    { 20, 25, 21, 0, 24, 125, 9675 }, // Ә
+    { 15, 19, 16, 0, 18, 72, 9800 }, // ә
+    { 20, 32, 21, 0, 31, 160, 9872 }, // Ӛ
+    { 16, 26, 16, 0, 25, 104, 10032 }, // ӛ
+    { 36, 32, 31, -3, 31, 288, 10136 }, // Ӝ
+    { 29, 26, 29, 0, 25, 189, 10424 }, // ӝ
+    { 17, 32, 18, 0, 31, 136, 10613 }, // Ӟ
+    { 15, 26, 15, 0, 25, 98, 10749 }, // ӟ
+    { 20, 24, 19, -1, 23, 120, 10847 }, // Ӡ
+    { 19, 25, 17, -2, 17, 119, 10967 }, // ӡ
+    { 29, 30, 26, -1, 30, 218, 11086 }, // Ӣ
+    { 19, 25, 20, 1, 24, 119, 11304 }, // ӣ
+    { 29, 31, 26, -1, 31, 225, 11423 }, // Ӥ
+    { 19, 26, 20, 1, 25, 124, 11648 }, // ӥ
+    { 23, 32, 24, 1, 31, 184, 11772 }, // Ӧ
+    { 17, 26, 18, 1, 25, 111, 11956 }, // ӧ
+    { 23, 25, 24, 1, 24, 144, 12067 }, // Ө
+    { 16, 19, 18, 1, 18, 76, 12211 }, // ө
+    { 23, 32, 24, 1, 31, 184, 12287 }, // Ӫ
+    { 17, 26, 18, 1, 25, 111, 12471 }, // ӫ
+    { 20, 32, 20, 0, 31, 160, 12582 }, // Ӭ
+    { 15, 26, 16, 0, 25, 98, 12742 }, // ӭ
+    { 23, 31, 21, 1, 30, 179, 12840 }, // Ӯ
+    { 20, 32, 18, -3, 24, 160, 13019 }, // ӯ
+    { 23, 32, 21, 1, 31, 184, 13179 }, // Ӱ
+    { 20, 33, 18, -3, 25, 165, 13363 }, // ӱ
+    { 23, 34, 21, 1, 33, 196, 13528 }, // Ӳ
+    { 20, 35, 18, -3, 27, 175, 13724 }, // ӳ
+    { 22, 31, 22, 2, 31, 171, 13899 }, // Ӵ
+    { 18, 26, 19, 1, 25, 117, 14070 }, // ӵ
+    { 21, 30, 19, -1, 23, 158, 14187 }, // Ӷ
+    { 14, 25, 14, 0, 18, 88, 14345 }, // ӷ
+    { 32, 32, 30, -1, 31, 256, 14433 }, // Ӹ
+    { 23, 26, 25, 1, 25, 150, 14689 }, // ӹ
+    { 21, 30, 19, -1, 23, 158, 14839 }, // Ӻ
+    { 14, 25, 14, 0, 18, 88, 14997 }, // ӻ
+    { 27, 30, 22, -3, 23, 203, 15085 }, // Ӽ
+    { 20, 26, 18, -1, 18, 130, 15288 }, // ӽ
+    { 27, 23, 22, -3, 23, 156, 15418 }, // Ӿ
+    { 20, 19, 18, -1, 18, 95, 15574 }, // ӿ
+    { 0, 0, 17, 0, 0, 0, 15669 }, //  
+    { 0, 0, 33, 0, 0, 0, 15669 }, //  
+    { 0, 0, 17, 0, 0, 0, 15669 }, //  
+    { 0, 0, 33, 0, 0, 0, 15669 }, //  
+    { 0, 0, 11, 0, 0, 0, 15669 }, //  
+    { 0, 0, 8, 0, 0, 0, 15669 }, //  
+    { 0, 0, 5, 0, 0, 0, 15669 }, //  
+    { 0, 0, 21, 0, 0, 0, 15669 }, //  
+    { 0, 0, 9, 0, 0, 0, 15669 }, //  
+    { 0, 0, 7, 0, 0, 0, 15669 }, //  
+    { 0, 0, 2, 0, 0, 0, 15669 }, //  
+    { 0, 0, 0, 0, 0, 0, 15669 }, // ​
+    { 2, 28, 0, -1, 20, 14, 15669 }, // ‌
+    { 8, 30, 0, -4, 22, 60, 15683 }, // ‍
+    { 12, 31, 0, -6, 23, 93, 15743 }, // ‎
+    { 12, 31, 0, -6, 23, 93, 15836 }, // ‏
+    { 11, 3, 12, 1, 10, 9, 15929 }, // ‐
+    { 11, 3, 12, 1, 10, 9, 15938 }, // ‑
+    { 16, 3, 21, 2, 13, 12, 15947 }, // ‒
+    { 17, 3, 17, 0, 10, 13, 16603 }, // –
+    { 33, 3, 33, 0, 10, 25, 16616 }, // —
+    { 33, 3, 33, 0, 10, 25, 15959 }, // ―
+    { 11, 34, 17, 3, 26, 94, 15984 }, // ‖
+    { 17, 8, 17, 0, -1, 34, 16078 }, // ‗
+    { 7, 11, 10, 3, 25, 20, 16641 }, // ‘
+    { 7, 11, 10, 2, 25, 20, 16661 }, // ’
+    { 7, 10, 10, 1, 4, 18, 16112 }, // ‚
+    { 6, 11, 8, 1, 25, 17, 16130 }, // ‛
+    { 13, 11, 17, 3, 25, 36, 16681 }, // “
+    { 14, 11, 17, 2, 25, 39, 16717 }, // ”
+    { 14, 10, 17, 1, 4, 35, 16147 }, // „
+    { 13, 11, 14, 1, 25, 36, 16182 }, // ‟
+    { 15, 22, 15, 1, 24, 83, 16218 }, // †
+    { 16, 26, 15, 0, 24, 104, 16301 }, // ‡
+    { 8, 7, 10, 1, 12, 14, 16405 }, // •
+    { 12, 12, 21, 4, 17, 36, 16419 }, // ‣
+    { 5, 5, 9, 2, 4, 7, 16455 }, // ․
+    { 14, 6, 17, 1, 5, 21, 16462 }, // ‥
+    { 27, 6, 33, 3, 5, 41, 16756 }, // …
+    { 5, 6, 9, 2, 12, 8, 16483 }, // ‧
+    { 0, 0, 0, 0, 0, 0, 16491 }, //  
+    { 0, 0, 0, 0, 0, 0, 16491 }, //  
+    { 12, 31, 0, -6, 23, 93, 16491 }, // ‪
+    { 12, 31, 0, -6, 23, 93, 16584 }, // ‫
+    { 10, 31, 0, -5, 23, 78, 16677 }, // ‬
+    { 14, 31, 0, -7, 23, 109, 16755 }, // ‭
+    { 14, 31, 0, -7, 23, 109, 16864 }, // ‮
+    { 0, 0, 4, 0, 0, 0, 16973 }, //  
+    { 41, 26, 45, 2, 24, 267, 16973 }, // ‰
+    { 7, 11, 9, 1, 23, 20, 17240 }, // ′
+    { 13, 11, 15, 1, 23, 36, 17260 }, // ″
+    { 20, 11, 22, 1, 23, 55, 17296 }, // ‴
+    { 7, 11, 9, 1, 23, 20, 17351 }, // ‵
+    { 14, 11, 16, 1, 23, 39, 17371 }, // ‶
+    { 21, 11, 23, 1, 23, 58, 17410 }, // ‷
+    { 14, 7, 16, 1, 0, 25, 17468 }, // ‸
+    { 9, 13, 10, 1, 15, 30, 17493 }, // ‹
+    { 10, 13, 10, 0, 15, 33, 17523 }, // ›
+    { 21, 23, 21, 0, 22, 121, 17556 }, // ※
+    { 19, 26, 19, 1, 25, 124, 17677 }, // ‼
+    { 17, 3, 17, 0, 27, 13, 17801 }, // ‾
+    { 8, 3, 10, 1, 10, 6, 17814 }, // ⁃
+    { 20, 26, 8, -6, 24, 130, 17820 }, // ⁄
+    { 25, 25, 27, 2, 24, 157, 17950 }, // ⁇
+    { 22, 26, 23, 2, 25, 143, 18107 }, // ⁈
+    { 23, 26, 24, 1, 25, 150, 18250 }, // ⁉
+    { 19, 6, 33, 7, 13, 29, 18400 }, // ⁓
+    { 26, 11, 28, 1, 23, 72, 18429 }, // ⁗
+    { 0, 0, 7, 0, 0, 0, 18501 }, //  
+    { 0, 0, 0, 0, 0, 0, 18501 }, // ⁠
+    { 0, 0, 0, 0, 0, 0, 18501 }, // ⁡
+    { 0, 0, 0, 0, 0, 0, 18501 }, // ⁢
+    { 0, 0, 0, 0, 0, 0, 18501 }, // ⁣
+    { 0, 0, 0, 0, 0, 0, 18501 }, // ⁤
+    { 13, 17, 15, 1, 28, 56, 18501 }, // ⁰
+    { 14, 16, 15, 0, 28, 56, 18557 }, // ⁴
+    { 13, 16, 15, 1, 27, 52, 18613 }, // ⁵
+    { 13, 17, 15, 2, 28, 56, 18665 }, // ⁶
+    { 12, 16, 15, 3, 27, 48, 18721 }, // ⁷
+    { 13, 17, 15, 1, 28, 56, 18769 }, // ⁸
+    { 13, 17, 15, 0, 28, 56, 18825 }, // ⁹
+    { 13, 12, 19, 3, 23, 39, 18881 }, // ⁿ
+    { 13, 16, 15, 1, 11, 52, 18920 }, // ₀
+    { 10, 16, 15, 2, 11, 40, 18972 }, // ₁
+    { 13, 16, 15, 1, 11, 52, 19012 }, // ₂
+    { 12, 16, 15, 1, 11, 48, 19064 }, // ₃
+    { 14, 16, 15, 0, 11, 56, 19112 }, // ₄
+    { 13, 16, 15, 1, 11, 52, 19168 }, // ₅
+    { 13, 16, 15, 2, 11, 52, 19220 }, // ₆
+    { 12, 16, 15, 3, 11, 48, 19272 }, // ₇
+    { 13, 16, 15, 1, 11, 52, 19320 }, // ₈
+    { 13, 16, 15, 0, 11, 52, 19372 }, // ₉
+    { 21, 23, 21, 0, 23, 121, 19424 }, // ₣
+    { 21, 24, 21, -1, 23, 126, 19545 }, // ₤
+    { 40, 24, 41, 0, 23, 240, 19671 }, // ₧
+    { 23, 24, 21, -1, 23, 138, 19911 }, // €
+    { 19, 13, 33, 7, 18, 62, 20049 }, // ←
+    { 13, 21, 33, 10, 22, 69, 20111 }, // ↑
+    { 19, 13, 33, 7, 18, 62, 20180 }, // →
+    { 13, 21, 33, 10, 22, 69, 20242 }, // ↓
+    { 21, 13, 33, 6, 18, 69, 20311 }, // ↔
+    { 13, 23, 33, 10, 23, 75, 20380 }, // ↕
+    { 15, 22, 33, 9, 22, 83, 20455 }, // ↨
+    { 13, 21, 33, 10, 22, 69, 20538 }, // ↲
+    { 13, 21, 33, 10, 22, 69, 20607 }, // ↳
+    { 19, 15, 33, 7, 19, 72, 20676 }, // ↵
+    { 19, 15, 33, 7, 19, 72, 20748 }, // ⇐
+    { 15, 19, 33, 9, 21, 72, 20820 }, // ⇑
+    { 19, 15, 33, 7, 19, 72, 20892 }, // ⇒
+    { 15, 19, 33, 9, 21, 72, 20964 }, // ⇓
+    { 21, 15, 33, 6, 19, 79, 21036 }, // ⇔
+    { 23, 24, 33, 5, 23, 138, 21115 }, // ∀
+    { 17, 27, 21, 2, 26, 115, 21253 }, // ∂
+    { 15, 23, 33, 9, 23, 87, 21368 }, // ∃
+    { 25, 27, 33, 4, 25, 169, 21455 }, // ∅
+    { 20, 24, 22, 1, 24, 120, 21624 }, // ∆
+    { 21, 24, 33, 6, 23, 126, 21744 }, // ∇
+    { 21, 23, 33, 6, 23, 121, 21870 }, // ∈
+    { 21, 29, 33, 6, 26, 153, 21991 }, // ∉
+    { 21, 19, 33, 6, 21, 100, 22144 }, // ∊
+    { 21, 23, 33, 6, 23, 121, 22244 }, // ∋
+    { 21, 29, 33, 6, 26, 153, 22365 }, // ∌
+    { 21, 19, 33, 6, 21, 100, 22518 }, // ∍
+    { 25, 29, 27, 1, 23, 182, 22618 }, // ∏
+    { 20, 29, 20, 0, 23, 145, 22800 }, // ∑
+    { 15, 3, 21, 3, 13, 12, 22945 }, // −
+    { 19, 26, 16, -1, 24, 124, 22957 }, // ∕
+    { 13, 26, 16, 2, 24, 85, 23081 }, // ∖
+    { 15, 16, 21, 3, 19, 60, 23166 }, // ∗
+    { 12, 12, 21, 4, 17, 36, 23226 }, // ∘
+    { 6, 6, 21, 7, 12, 9, 23262 }, // ∙
+    { 21, 31, 21, 0, 27, 163, 23271 }, // √
+    { 16, 13, 21, 2, 17, 52, 23434 }, // ∝
+    { 21, 11, 21, 0, 16, 58, 23486 }, // ∞
+    { 21, 23, 33, 6, 23, 121, 23544 }, // ∟
+    { 23, 23, 33, 4, 23, 133, 23665 }, // ∠
+    { 4, 34, 17, 6, 26, 34, 23798 }, // ∣
+    { 10, 34, 17, 3, 26, 85, 23832 }, // ∥
+    { 21, 23, 33, 6, 23, 121, 23917 }, // ∧
+    { 21, 23, 33, 6, 23, 121, 24038 }, // ∨
+    { 19, 24, 33, 7, 24, 114, 24159 }, // ∩
+    { 19, 24, 33, 7, 23, 114, 24273 }, // ∪
+    { 18, 34, 21, 1, 26, 153, 24387 }, // ∫
+    { 21, 19, 33, 6, 18, 100, 24540 }, // ∴
+    { 21, 19, 33, 6, 18, 100, 24640 }, // ∵
+    { 7, 18, 10, 1, 20, 32, 24740 }, // ∶
+    { 21, 19, 33, 6, 18, 100, 24772 }, // ∷
+    { 19, 6, 33, 7, 13, 29, 24872 }, // ∼
+    { 19, 18, 33, 7, 20, 86, 24901 }, // ≅
+    { 16, 12, 21, 2, 17, 48, 24987 }, // ≈
+    { 19, 11, 33, 7, 15, 53, 25035 }, // ≍
+    { 15, 15, 21, 3, 19, 57, 25088 }, // ≠
+    { 19, 15, 33, 7, 17, 72, 25145 }, // ≡
+    { 15, 20, 21, 3, 20, 75, 25217 }, // ≤
+    { 15, 20, 21, 3, 20, 75, 25292 }, // ≥
+    { 27, 16, 33, 3, 19, 108, 25367 }, // ≪
+    { 27, 16, 33, 3, 19, 108, 25475 }, // ≫
+    { 21, 19, 33, 6, 21, 100, 25583 }, // ⊃
+    { 21, 29, 33, 6, 26, 153, 25683 }, // ⊄
+    { 21, 29, 33, 6, 26, 153, 25836 }, // ⊅
+    { 21, 23, 33, 6, 23, 121, 25989 }, // ⊆
+    { 21, 23, 33, 6, 23, 121, 26110 }, // ⊇
+    { 25, 25, 33, 4, 24, 157, 26231 }, // ⊕
+    { 25, 25, 33, 4, 24, 157, 26388 }, // ⊖
+    { 25, 25, 33, 4, 24, 157, 26545 }, // ⊗
+    { 25, 25, 33, 4, 24, 157, 26702 }, // ⊘
+    { 19, 23, 33, 7, 23, 110, 26859 }, // ⊥
+    { 6, 6, 21, 7, 12, 9, 26969 }, // ⋅
+    { 27, 6, 33, 3, 12, 41, 26978 }, // ⋯
+    { 34, 34, 24, -6, 26, 289, 27019 }, // ﬀ
+    { 27, 34, 22, -6, 26, 230, 27308 }, // ﬁ
+    { 28, 34, 22, -6, 26, 238, 27538 }, // ﬂ
+    { 38, 34, 32, -6, 26, 323, 27776 }, // ﬃ
+    { 39, 34, 33, -6, 26, 332, 28099 }, // ﬄ
+    { 31, 34, 24, -6, 26, 264, 28431 }, // ﬅ
+    { 27, 25, 26, 0, 24, 169, 28695 }, // ﬆ
+    { 31, 32, 33, 1, 28, 248, 28864 }, // �
 };
 
 static const EpdUnicodeInterval bookerly_16_italicIntervals[] = {
@@ -2979,32 +3050,328 @@ static const EpdUnicodeInterval bookerly_16_italicIntervals[] = {
     { 0x22A5, 0x22A5, 0x2E7 },
     { 0x22C5, 0x22C5, 0x2E8 },
     { 0x22EF, 0x22EF, 0x2E9 },
-    { 0xFFFD, 0xFFFD, 0x2EA },
+    { 0xFB00, 0xFB06, 0x2EA },
+    { 0xFFFD, 0xFFFD, 0x2F1 },
 };
 
 static const EpdFontGroup bookerly_16_italicGroups[] = {
-    { 0, 5063, 9886, 100, 0 },
-    { 5063, 4793, 11719, 96, 100 },
-    { 9856, 6825, 18705, 128, 196 },
-    { 16681, 424, 548, 33, 324 },
-    { 17105, 11549, 30933, 220, 357 },
-    { 28654, 1494, 3026, 74, 577 },
-    { 30148, 620, 923, 18, 651 },
-    { 30768, 376, 625, 4, 669 },
-    { 31144, 593, 1066, 15, 673 },
-    { 31737, 2590, 5904, 58, 688 },
-    { 34327, 130, 248, 1, 746 },
+    { 0, 6724, 16797, 151, 5 },
+    { 6724, 4179, 8589, 66, 358 },
+    { 10903, 11835, 30930, 262, 0 },
+    { 22738, 12748, 29112, 275, 472 },
+};
+
+static const uint8_t bookerly_16_italicGlyphGroups[754] = {
+    2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0,
+    2, 2, 2, 2, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0,
+    0, 2, 2, 2, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0,
+    0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 3, 3, 3, 0, 0, 3, 3, 0, 0, 3,
+    3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+};
+
+static const uint8_t bookerly_16_italicKernLeftClasses[754] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 92,
+    0, 3, 67, 3, 29, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 2, 85, 80, 9, 39, 71, 49, 14, 14, 59,
+    54, 34, 111, 26, 9, 55, 52, 21, 58, 20, 6, 19, 19, 81, 10, 83,
+    88, 43, 0, 0, 0, 0, 30, 15, 68, 0, 40, 36, 22, 35, 0, 125,
+    96, 0, 35, 35, 15, 15, 91, 41, 78, 106, 30, 47, 47, 122, 47, 69,
+    77, 0, 0, 0, 0, 73, 0, 0, 0, 0, 0, 0, 0, 0, 0, 107,
+    0, 67, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 76,
+    0, 0, 0, 62, 2, 2, 2, 2, 2, 2, 39, 80, 39, 39, 39, 39,
+    14, 14, 14, 14, 9, 26, 9, 9, 9, 9, 9, 0, 9, 6, 6, 6,
+    6, 10, 63, 128, 30, 30, 30, 30, 30, 30, 40, 121, 40, 40, 40, 40,
+    0, 0, 33, 33, 15, 35, 15, 15, 15, 15, 15, 0, 84, 30, 30, 30,
+    30, 47, 15, 47, 2, 30, 2, 30, 45, 86, 80, 68, 80, 68, 80, 68,
+    80, 68, 9, 24, 9, 0, 39, 40, 39, 40, 39, 40, 89, 97, 39, 40,
+    49, 22, 49, 22, 49, 22, 49, 22, 14, 35, 14, 35, 14, 33, 14, 33,
+    14, 33, 75, 113, 14, 30, 59, 125, 59, 99, 54, 96, 68, 34, 0, 34,
+    126, 0, 24, 0, 0, 34, 104, 26, 35, 26, 35, 26, 35, 35, 26, 120,
+    9, 15, 9, 15, 9, 15, 39, 40, 21, 41, 21, 41, 21, 41, 58, 78,
+    58, 78, 58, 108, 58, 78, 20, 124, 20, 0, 20, 106, 6, 30, 6, 30,
+    6, 30, 6, 30, 6, 30, 6, 90, 19, 47, 10, 47, 10, 83, 69, 83,
+    69, 83, 69, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 65, 65, 82, 0, 132, 109, 1, 1, 56, 27, 27,
+    60, 8, 1, 4, 1, 11, 131, 38, 16, 44, 65, 8, 38, 1, 1, 8,
+    1, 102, 1, 13, 1, 25, 100, 50, 4, 66, 48, 44, 1, 1, 44, 27,
+    1, 27, 13, 13, 1, 23, 94, 72, 0, 12, 70, 103, 72, 23, 23, 68,
+    23, 23, 23, 12, 61, 12, 68, 61, 32, 12, 115, 18, 23, 23, 18, 28,
+    23, 28, 12, 12, 23, 70, 70, 101, 0, 68, 114, 0, 95, 116, 28, 28,
+    61, 68, 23, 32, 23, 118, 28, 13, 12, 51, 129, 44, 18, 27, 28, 25,
+    12, 42, 79, 37, 0, 0, 0, 74, 93, 38, 72, 74, 93, 8, 68, 8,
+    68, 8, 68, 44, 18, 0, 0, 0, 0, 98, 112, 100, 68, 16, 18, 17,
+    32, 17, 32, 57, 87, 44, 18, 44, 18, 1, 23, 64, 61, 119, 70, 119,
+    70, 1, 8, 103, 127, 123, 44, 18, 56, 116, 44, 18, 1, 0, 44, 18,
+    130, 11, 23, 11, 23, 65, 70, 65, 70, 13, 12, 13, 12, 8, 103, 38,
+    72, 110, 117, 1, 23, 1, 23, 13, 12, 13, 12, 13, 12, 13, 12, 4,
+    32, 4, 32, 4, 32, 1, 23, 16, 0, 1, 23, 37, 0, 53, 105, 48,
+    115, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 67, 67, 0, 67, 67, 67, 0, 0, 7, 5, 31, 7, 7, 5, 3,
+    0, 0, 0, 0, 0, 0, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 107, 76, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 36, 0, 0, 0, 0, 106,
+    106, 0,
+};
+
+static const uint8_t bookerly_16_italicKernRightClasses[754] = {
+    0, 0, 0, 0, 0, 0, 91, 0, 0, 0, 0, 0, 0, 0, 77, 33,
+    0, 19, 24, 2, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 35,
+    34, 0, 0, 0, 64, 0, 4, 70, 5, 70, 28, 28, 5, 28, 28, 53,
+    28, 28, 92, 28, 5, 70, 5, 70, 89, 29, 6, 25, 25, 84, 21, 102,
+    0, 10, 81, 0, 0, 0, 1, 23, 1, 1, 1, 11, 16, 23, 71, 62,
+    23, 23, 20, 20, 1, 88, 1, 20, 32, 45, 13, 22, 22, 87, 68, 85,
+    0, 0, 81, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 43,
+    0, 24, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 59,
+    0, 0, 0, 101, 4, 4, 4, 4, 4, 4, 50, 5, 28, 28, 28, 28,
+    28, 28, 28, 28, 70, 28, 5, 5, 5, 5, 5, 0, 5, 6, 6, 6,
+    6, 21, 28, 67, 1, 1, 1, 1, 38, 1, 1, 1, 1, 1, 1, 1,
+    95, 71, 47, 47, 1, 20, 1, 1, 1, 1, 1, 0, 56, 13, 13, 13,
+    13, 22, 83, 22, 4, 1, 4, 1, 4, 1, 5, 1, 5, 1, 5, 1,
+    5, 38, 70, 1, 70, 1, 28, 1, 28, 1, 28, 1, 28, 1, 28, 1,
+    5, 16, 5, 16, 5, 16, 5, 16, 28, 23, 28, 82, 28, 47, 28, 47,
+    28, 47, 28, 71, 28, 20, 28, 71, 53, 106, 28, 23, 20, 28, 23, 28,
+    23, 28, 23, 28, 23, 28, 76, 28, 20, 28, 20, 28, 20, 20, 28, 20,
+    5, 1, 5, 1, 5, 1, 5, 1, 70, 20, 70, 20, 70, 20, 89, 32,
+    89, 32, 89, 32, 89, 75, 29, 45, 29, 45, 29, 45, 6, 13, 6, 13,
+    6, 13, 6, 13, 6, 13, 6, 13, 25, 22, 21, 22, 21, 102, 85, 102,
+    85, 102, 98, 67, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 8, 8, 18, 8, 30, 89, 8, 8, 61, 37, 8,
+    18, 8, 8, 40, 8, 26, 8, 97, 8, 55, 8, 58, 96, 8, 8, 8,
+    37, 93, 8, 30, 8, 97, 30, 18, 40, 69, 48, 8, 27, 8, 8, 18,
+    8, 8, 99, 8, 79, 3, 73, 3, 63, 60, 3, 36, 41, 12, 12, 15,
+    17, 44, 15, 3, 15, 15, 3, 15, 14, 3, 74, 12, 9, 12, 12, 65,
+    12, 12, 41, 15, 72, 3, 3, 90, 63, 3, 86, 103, 94, 52, 17, 15,
+    78, 15, 12, 14, 12, 18, 15, 30, 3, 57, 14, 8, 15, 0, 100, 97,
+    15, 8, 80, 8, 63, 8, 15, 58, 36, 96, 41, 8, 15, 8, 15, 0,
+    0, 18, 0, 8, 15, 8, 15, 8, 15, 30, 3, 30, 3, 18, 15, 42,
+    14, 42, 14, 48, 74, 0, 0, 27, 9, 27, 9, 8, 78, 46, 39, 46,
+    39, 8, 58, 36, 8, 15, 37, 17, 8, 15, 8, 15, 27, 9, 0, 44,
+    105, 26, 3, 26, 3, 51, 3, 8, 3, 107, 54, 0, 54, 58, 36, 96,
+    41, 104, 66, 8, 12, 8, 12, 30, 3, 30, 3, 30, 3, 0, 41, 40,
+    14, 40, 14, 40, 14, 0, 9, 8, 63, 8, 12, 8, 63, 48, 74, 48,
+    74, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 24, 24, 0, 24, 24, 24, 0, 0, 7, 31, 2, 7, 7, 31, 2,
+    0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 43, 59, 0, 91, 0, 0, 0,
+    64, 64, 91, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11, 11, 11, 11, 11, 11,
+    32, 0,
+};
+
+static const int8_t bookerly_16_italicKernMatrix[14364] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, -1, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, -1, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, 1, -1, -2, -3, 0, 0, -5, 0, 0, -1, 0, 0, 1, 0, 0, 0, -1, -3, -2, 0, -1, -4, 0, 0, 0, -2, 0, -3, 0, -3, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, -1, 1, -1, -2, -3, 0, -4, 0, 1, -1, -1, -2, -1, 1, 0, -2, 0, -1, -2, -2, 0, 0, -3, 1, -3, 0, -2, -1, -3, 0, 0, 0, 0, 0, 1, -1, -1, 0, 0, -2, 0, 0, -1, -4, 0, 1, 0, 1, 1, 3, 2, 0, 1, -1, -3, 1, 0, -1, 2, 3, 0, 0, -2, 0, 0, -2, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -4, -2, 0, 0, 0, 0, 1, 0, 2, 0, 0, 0, 0, 0, 0, -4, 1, -4, 0, 0, 0, 0, 0, 0, -4, 2, 0, 0, 0, 2, 0, 3, 0, 0, -1, -3, 0, -1, 2, -1, 2, 0, -2, 0, 0, 0, 1, -3, 0, -4, 0, 0, -1, -3, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, -1, 0, 0, 0, 2, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 2, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -3, -5, -3, -5, -2, -2, 0, -2, 0, 0, -2, -1, -1, 0, -1, -4, -6, -1, -5, -1, -1, 0, -1, 0, -1, -5, 0, -2, -1, -2, 0, -3, 0, 0, 0, -2, -4, -3, -3, 0, -2, -1, 0, -3, 0, 0, 0, -1, 0, -5, -5, 0, -2, 0, -4, -3, -1, -1, 0, -3, -2, 0, -2, -1, 0, 0, 0, 0, -2, -1, -1, -4, -2, -1, -3, -1, 0, -1, -3, -3, 0, -1, -1, -1, -1, -3, -1, -1, -1, -1, -2, -2, -2, 0, -1, -2, -1, -1, -1, 0, 0, -1, -1, -2, -1, 0, 0,
+    0, -1, -3, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -3, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -3, -3, -3, -4, -1, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, -3, -5, 0, -3, 0, 0, 0, 0, 0, -1, -4, 0, -1, 0, -1, 0, -2, 0, 0, 0, -2, -3, -3, 0, 0, -2, 0, 0, -2, 0, 0, 0, 0, 0, -4, -4, 0, 0, -1, -3, -3, -1, 0, 0, -3, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -2, -1, -1, -2, 0, 0, 0, -2, -2, 0, 0, 0, 0, -1, -2, -1, 0, -1, 0, -1, -1, -1, 0, 0, 0, -1, -1, 0, 0, -3, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -1, 0, 0, 0, 0, 0, -2, 0, 0, -1, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 1, -1, -1, -1, 0, 0, -3, 0, -1, 0, -1, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, -1, 1, 0, 0, 0, 0, -1, 0, 0, 0, 0, -2, -1, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, -1, 0, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, -3, 0, -4, -1, 0, 0, 0, 0, 1, -1, 0, -1, 0, 0, -2, 0, 0, -3, 0, 1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 1, -2, 2, -2, -2, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 1, 0, -3, -3, 0, 0, 0, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, -3, 0, -3, -5, 0, -1, 0, -2, -1, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, 1, -4, 0, 0, -1, -3, 0, -3, 0, 0, 0, 1, 0, -2, -2, 0, -3, -1, 0, 0, -4, 0, 1, 0, 0, 1, 0, 0, 0, 1, 0, -4, 1, 0, -1, 0, 0, 0, -1, -2, -1, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, -1, 0, 0, -3, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, -1, -2, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, -1, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -3, -1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, -3, 0, 0, 0, 0, 0, 0, -3, 1, 0, 0, 0, 2, 0, 2, -2, -2, -1, -2, 0, -3, 1, -1, 0, -1, -2, 0, 0, 0, 0, -2, 0, -3, 0, 0, -1, -2, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -3, -2, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, -4, 0, -3, 0, 0, 0, 0, -2, 0, -3, 1, 0, 0, -1, 1, 0, 2, -2, -2, -2, -2, 0, -2, 1, -1, 1, -1, -3, 0, 0, 0, 0, -3, 0, -3, 0, 0, -2, -2, 0, 0, 0, -1, -1, 0, 0, -1, 0, -1, -1, 0, 0, -1, 0, 0, -3, -1, -1, 0, 0, 0, 1, -1, -2, 0, 0, 0, 0, 0, -2, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -3, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, -4, 0, -4, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -2, 0, 0, -4, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 1, -2, 1, -2, -2, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 1, 0, -3, -4, 0, 0, 0, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -3, 0, -3, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, -1, 2, -2, -2, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -2, -3, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, -1, -2, -2, 0, 0, -3, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, -3, -1, 0, -1, -3, 0, 0, 0, -2, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 2, 0, 0, 0, 3, 0, 1, 0, 0, 1, 0, 0, 0, 1, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 3, 1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 2, 4, 0, 0, 0, 0, 0, 0, 0, 3, 0, 4, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, 0, 0, 0, 2, 0, 0, 2, 0, 0, 0, 1, 4, 4, 0, 0, 0, 2, 4, 4, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 2, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -4, -1, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, -4, 0, -4, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, -2, -2, -1, -3, 0, 0, 0, -1, -1, 0, -2, 0, 0, 0, -1, -2, 0, -4, 0, 0, -1, -3, 0, -1, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -2, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -2, 0, -1, -3, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, -2, 0, -2, -4, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0,
+    0, -3, 0, -3, -3, -1, 0, 0, 0, 0, 0, -2, -1, -1, 0, -1, -3, -4, 0, 0, -1, 0, 0, 0, 0, 0, -3, 0, 0, 0, -1, 0, -3, 0, 0, 0, -2, -1, -3, -2, 0, -2, 0, 0, -2, -1, 0, 0, 0, 0, -4, -4, 0, 0, -2, -2, -3, 0, 0, 0, -2, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, -3, -1, -2, -3, 0, 0, 0, -1, -2, 0, 0, 0, 0, -2, -3, -2, -1, 0, 0, 0, -2, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, -1, 1, -1, -2, -3, 0, -4, 0, 2, -1, -1, -2, -1, 1, 0, -2, 0, -1, -2, -2, 0, 0, -3, 1, -3, 0, -2, -1, -3, 0, 0, 0, 0, 0, 1, -1, -1, 0, 0, -2, 0, 0, -1, -4, 0, 1, 0, 1, 1, 3, 2, 0, 1, -1, -3, 1, 0, -1, 2, 3, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 1, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, -2, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, 0, 0, -2, 0, 0, 0, -2, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -2, 0, 0, 0, 0, 1, 0, 0, 2, 0, 0, 0, 0, 0, -1, 0, 0, -2, -1, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 2, 1, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, -3, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, -3, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 1, 0, 0, -2, -2, 0, -1, 0, 0, 1, 0, 0, -1, -1, 0, 0, 0, 0, -2, 0, -3, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -3, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -3, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -3, -2, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, -4, 0, -3, 0, 0, 0, 0, 0, 0, -4, 1, 0, 0, 0, 1, 0, 1, 0, 0, -3, -2, 0, -3, 1, -3, 0, 0, -2, 0, 0, 0, 0, 0, 0, -4, 0, 0, -2, -2, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2, -2, 0, 0, -2, 0, 0, -2, -1, 0, 0, 0, 2, 0, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, -1, -2, 0, 0, -2, 0, 0, 0, 0, -2, 0, 3, 0, -2, 0, 0, -3, -2, 0, 0, -3, 1, -3, 0, -2, -1, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, -3, 0, 0, 0, -2, 0, 2, 0, 1, 1, 0, 0, 0, 3, 0, -3, 2, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 1, 0, 1, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, 1, -1, -2, -3, 0, 0, -5, 4, 0, -1, 0, 0, 2, 0, 0, 0, -1, -3, -2, 0, -1, -4, 0, 0, 0, -2, 0, -3, 0, -3, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 1, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, -1, 0, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, -2, 0, -1, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 2, -1, 0, 0, 0, 1, 0, 2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -2, 0, 2, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 3, 0, 1, -2, 0, 0, 0, -2, 3, 5, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -1, 0, 0, 0, 0, 0, -2, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0, 1, 0, -2, 0, 0, 0, -1, 0, 0, -1, 0, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 1, 0, -1, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, -1, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -3, -1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, -3, 0, 0, 0, 0, 0, 0, -3, 1, 0, 0, 0, 2, 0, 2, -2, -2, -1, -2, 0, -3, 1, -1, 0, -1, -2, 0, 0, 0, 0, -2, 0, -3, 0, 0, -1, -2, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -3, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -5, 0, -3, 0, 0, 0, 0, -1, 0, -4, 0, 0, 0, -1, 0, 0, 0, -2, -2, -1, -3, 0, -1, 1, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, -4, 0, 0, -1, -3, 0, 0, 0, 0, -2, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, -1, 0, 0, 0, -2, 2, 0, 0, 0, 0, 3, 0, 0, 6, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 6, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 7, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -2, 0, 0, 0, 0, 0, -2, 0, 0, -1, 0, -1, -2, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0, -1, 0, -2, 0, -2, 0, -1, -2, 0, -1, 0, 1, 0, 0, 0, 0, 0, -2, 1, 0, 0, 1, 0, -2, 0, 0, -2, 0, -1, -1, 0, 0, -1, 0, 0, -2, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, 1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 1, -1, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -4, 0, -3, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -4, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, -2, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -4, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 1, -1, -1, -1, -1, 0, 0, 1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -1, 0, 0, 0, 0, 0, -2, 0, 0, -1, 0, 1, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0, 1, 0, -2, 0, 0, 0, -1, 0, 0, -1, 0, 1, 0, 0, 2, 3, 0, 0, 1, 0, 0, 1, 0, -1, 4, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -3, 0, -2, -3, 0, 0, 0, -2, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, -1, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, -2, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 2, 0, 0, 0, 0, 1, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 0, 0, -1, -1, 0, 0, -1, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -4, 0, -2, 0, -1, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, -2, 0, 0, 0, -2, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -1, 0, -2, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, -1, -2, 0, -4, 0, 0, 0, 0, 0, 0, -1, 0, -3, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, -1, -1, -2, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, -1, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -3, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, 0, -2, -2, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 1, 0, -2, -3, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 3, 0, 0, 0, -2, 0, 0, 0, 3, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 1, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -2, 0, 0, 0, 0, -1, 0, 0, 0, 3, 0, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, -1, 0, 0, -1, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 2, 1, 0, 0, -1, 0, 0, 0, -1, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, -1, 0, 0, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -1, 0, 1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, -2, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, -1, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 4, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 0, 0, -1, 0, 0, 0, -1, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, -1, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 4, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -2, 2, 0, 0, 0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t bookerly_16_italicGlyphLookup[368] = {
+    0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0001, 0x0002, 0xFFFF, 0xFFFF, 0xFFFF, 0x0003, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0004, 0xFFFF, 0xFFFF,
+    0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, 0x0010, 0x0011, 0x0012, 0x0013, 0x0014,
+    0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, 0x0020, 0x0021, 0x0022, 0x0023, 0x0024,
+    0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, 0x0030, 0x0031, 0x0032, 0x0033, 0x0034,
+    0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, 0x0040, 0x0041, 0x0042, 0x0043, 0x0044,
+    0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051, 0x0052, 0x0053, 0x0054,
+    0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, 0x0060, 0x0061, 0x0062, 0x0063, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x0072, 0x0073,
+    0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, 0x0080, 0x0081, 0x0082, 0x0083,
+    0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F, 0x0090, 0x0091, 0x0092, 0x0093,
+    0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F, 0x00A0, 0x00A1, 0x00A2, 0x00A3,
+    0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF, 0x00B0, 0x00B1, 0x00B2, 0x00B3,
+    0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF, 0x00C0, 0x00C1, 0x00C2, 0x00C3,
+    0x0241, 0x0242, 0x0243, 0x0244, 0x0245, 0x0246, 0x0247, 0x0248, 0x0249, 0x024A, 0x024B, 0x024C, 0x024D, 0x024E, 0x024F, 0x0250,
+    0x0251, 0x0252, 0x0253, 0x0254, 0x0255, 0x0256, 0x0257, 0x0258, 0x0259, 0x025A, 0x025B, 0x025C, 0x025D, 0x025E, 0x025F, 0x0260,
+    0x0261, 0x0262, 0x0263, 0x0264, 0x0265, 0x0266, 0x0267, 0x0268, 0x0269, 0x026A, 0x026B, 0x026C, 0x026D, 0x026E, 0x026F, 0x0270,
+    0x0271, 0xFFFF, 0x0272, 0x0273, 0x0274, 0x0275, 0x0276, 0x0277, 0x0278, 0x0279, 0x027A, 0x027B, 0x027C, 0xFFFF, 0x027D, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x027E, 0x027F, 0xFFFF, 0xFFFF, 0x0280, 0x0281, 0x0282, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x0283, 0xFFFF, 0xFFFF, 0xFFFF, 0x0284, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0285,
+    0x0286, 0x0287, 0x0288, 0x0289, 0x028A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
 };
 
 static const EpdFontData bookerly_16_italic = {
     bookerly_16_italicBitmaps,
     bookerly_16_italicGlyphs,
     bookerly_16_italicIntervals,
-    64,
+    65,
     44,
     36,
     -9,
     true,
     bookerly_16_italicGroups,
-    11,
+    4,
+    bookerly_16_italicKernLeftClasses,
+    bookerly_16_italicKernRightClasses,
+    bookerly_16_italicKernMatrix,
+    108,
+    nullptr,
+    0,
+    0,
+    bookerly_16_italicGlyphLookup,
+    bookerly_16_italicGlyphGroups,
+    false,
+    nullptr,
 };
@@ -3,1991 +3,2060 @@
  * name: bookerly_16_regular
  * size: 16
  * mode: 2-bit  compressed: true
- * Command used: fontconvert.py bookerly_16_regular 16 ../builtinFonts/source/Bookerly/Bookerly-Regular.ttf --2bit --compress
+ * Command used: fontconvert.py bookerly_16_regular 16 ../builtinFonts/source/Bookerly/Bookerly-Regular.ttf --2bit --compress --frequency-corpus ../../../test/hyphenation_eval/resources/english_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/french_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/german_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/italian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/russian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/spanish_hyphenation_tests.txt
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t bookerly_16_regularBitmaps[31658] = {
-    0x9D, 0x5A, 0xBF, 0x8F, 0xDD, 0x56, 0x76, 0x3E, 0x24, 0x3D, 0xA2, 0x63, 0x22, 0xA1, 0x0B, 0x0B,
-    0xBB, 0xD8, 0x71, 0xC2, 0x2D, 0xD2, 0x24, 0x80, 0x75, 0xFF, 0x01, 0xCD, 0x23, 0x37, 0x46, 0xB0,
-    0x65, 0x84, 0x40, 0x4F, 0x0B, 0xAC, 0x0A, 0x35, 0x6E, 0x62, 0x24, 0x99, 0x14, 0x29, 0xB6, 0x90,
-    0x86, 0x5C, 0x6F, 0x61, 0x20, 0x01, 0x62, 0x01, 0x59, 0x27, 0xE5, 0x6E, 0xE1, 0x22, 0xFB, 0x5C,
-    0xCC, 0x16, 0x5B, 0x08, 0xC1, 0xCC, 0x23, 0xE5, 0x29, 0x5C, 0xA8, 0x10, 0x03, 0xC7, 0x50, 0x61,
-    0x20, 0xE6, 0xDA, 0x72, 0x16, 0xB0, 0x03, 0x88, 0x92, 0x29, 0x9B, 0x23, 0x91, 0xBC, 0xF9, 0xBE,
-    0x73, 0xDF, 0x9B, 0x91, 0x56, 0x03, 0x58, 0xF2, 0x93, 0xC8, 0x47, 0xDE, 0x47, 0xDE, 0x1F, 0xE7,
-    0x7C, 0xE7, 0x3B, 0x3F, 0xEE, 0xBC, 0xF0, 0xB3, 0x3E, 0xFD, 0x61, 0x97, 0x87, 0x2D, 0xFE, 0xA7,
-    0xC1, 0xF1, 0x7F, 0xE3, 0xB7, 0xCF, 0x89, 0x88, 0xF7, 0x4E, 0x7A, 0x30, 0xA4, 0xD5, 0xB9, 0x0D,
-    0xEF, 0x5F, 0x9B, 0x2B, 0x3B, 0xD1, 0xAD, 0x66, 0x7F, 0x27, 0x3A, 0xA8, 0xF7, 0xB6, 0x70, 0xBA,
-    0xBC, 0x15, 0x1E, 0x54, 0x97, 0x85, 0x9F, 0x73, 0x5E, 0x26, 0x72, 0x56, 0x5A, 0x91, 0x44, 0x7E,
-    0x22, 0x12, 0x15, 0xAF, 0x88, 0x04, 0x75, 0x2C, 0x32, 0xBF, 0xFF, 0xA3, 0x0F, 0xB3, 0xD2, 0x5A,
-    0xDB, 0xFE, 0x79, 0xB9, 0x98, 0xDE, 0x91, 0x38, 0xDB, 0xC2, 0x2F, 0x15, 0x7E, 0xF1, 0xDA, 0xB0,
-    0x12, 0xB9, 0xE6, 0x37, 0x22, 0x5B, 0xD2, 0x49, 0x8C, 0x67, 0xC6, 0x10, 0x27, 0x2B, 0x7E, 0x1B,
-    0x15, 0x22, 0xBF, 0x09, 0x6A, 0xFE, 0x82, 0x2E, 0x63, 0xC1, 0x20, 0x61, 0x75, 0x06, 0xE3, 0x64,
-    0x9E, 0xAC, 0x3F, 0xDD, 0xEA, 0x68, 0xDD, 0xB1, 0x71, 0x28, 0x92, 0xDB, 0xD6, 0xB3, 0x0F, 0x87,
-    0xA0, 0x6D, 0xA7, 0xA8, 0x6A, 0x67, 0x71, 0xD5, 0x6E, 0xE1, 0xF8, 0xD3, 0xB8, 0x6E, 0x25, 0xEA,
-    0x5A, 0x09, 0x2C, 0xC6, 0x2A, 0xF1, 0x5C, 0x62, 0x2B, 0xF1, 0x6C, 0x27, 0xDE, 0xA7, 0x83, 0x78,
-    0xF5, 0xF8, 0x47, 0x5E, 0xBD, 0x93, 0xFA, 0x7A, 0xEC, 0xA7, 0x6F, 0xD4, 0x83, 0xF9, 0xEA, 0x56,
-    0x17, 0x59, 0x5B, 0x7B, 0xE5, 0xC4, 0xB9, 0x9E, 0x7C, 0xAC, 0x3F, 0xDF, 0x17, 0xD9, 0xBC, 0x2D,
-    0x62, 0xF0, 0xDF, 0x16, 0x92, 0x64, 0x62, 0xDE, 0xC4, 0x62, 0x0A, 0xFC, 0x4F, 0x31, 0x67, 0x89,
-    0xAA, 0xA8, 0x0A, 0x1A, 0x09, 0x5A, 0xBF, 0xF5, 0x30, 0xCB, 0x41, 0xAE, 0x70, 0xD2, 0x33, 0x3C,
-    0x78, 0x0D, 0x0B, 0xC3, 0x8F, 0x67, 0x45, 0x7F, 0x7C, 0x45, 0x5E, 0x93, 0x7D, 0xE9, 0x13, 0xDF,
-    0x36, 0x71, 0x35, 0xC4, 0xFE, 0x03, 0xEB, 0x43, 0x1C, 0x3F, 0xED, 0xA2, 0x3A, 0x19, 0x82, 0x6A,
-    0x90, 0x5E, 0xC4, 0x6F, 0x66, 0x92, 0x52, 0x6E, 0x49, 0x16, 0x63, 0x02, 0x5D, 0x58, 0xFB, 0xE8,
-    0x71, 0xCF, 0xEB, 0xD0, 0x2B, 0x04, 0x35, 0xC3, 0x3F, 0xFC, 0x8F, 0x2B, 0xCC, 0x21, 0x11, 0xBF,
-    0xC3, 0x33, 0x98, 0x46, 0xBA, 0x5B, 0x63, 0x0E, 0x58, 0x7A, 0x2D, 0x3E, 0xE4, 0x79, 0x1A, 0x6A,
-    0x7A, 0x71, 0x35, 0xF3, 0xBC, 0xA6, 0x7A, 0x21, 0x6F, 0x7C, 0xC6, 0x4B, 0xBC, 0x19, 0x3C, 0x0C,
-    0x83, 0x31, 0xD0, 0x91, 0x24, 0x05, 0xDE, 0x96, 0xB0, 0xA1, 0x92, 0xBC, 0x1E, 0x4B, 0xC0, 0x0B,
-    0x1C, 0x0F, 0x03, 0xF0, 0x3A, 0xE0, 0x93, 0xE8, 0x16, 0xAB, 0xAE, 0x20, 0xD7, 0xD8, 0xB6, 0x41,
-    0x37, 0x8A, 0xC9, 0xFC, 0x3E, 0xA9, 0xC2, 0x5A, 0x06, 0x7F, 0xC0, 0x3A, 0x53, 0x49, 0xAB, 0x2D,
-    0xBC, 0x10, 0x8C, 0x49, 0x16, 0xB4, 0x92, 0x7E, 0x51, 0xC9, 0x24, 0x58, 0xA1, 0x98, 0x5A, 0x92,
-    0x51, 0x82, 0x49, 0x22, 0x68, 0x21, 0xB5, 0xF6, 0xA1, 0xED, 0x7D, 0x6B, 0x1B, 0xB4, 0x79, 0x73,
-    0x91, 0x97, 0x64, 0x63, 0xB6, 0xB3, 0xB3, 0xB3, 0x85, 0xCF, 0x59, 0x9D, 0x69, 0x98, 0xC9, 0x0E,
-    0xA6, 0x82, 0xFE, 0xD0, 0x4B, 0x52, 0x60, 0xBD, 0x18, 0x02, 0xA2, 0xE8, 0x25, 0xD2, 0x6F, 0xDC,
-    0x6B, 0xFB, 0x0E, 0x66, 0xAA, 0x97, 0x15, 0x5B, 0x47, 0xF1, 0xF5, 0x2E, 0xAE, 0xC5, 0xA0, 0x21,
-    0x93, 0x5C, 0x04, 0x8B, 0x9D, 0xF4, 0x3F, 0x44, 0x06, 0x51, 0xC8, 0x35, 0x2E, 0xC4, 0xFD, 0x0F,
-    0x3B, 0x89, 0x1E, 0x79, 0x78, 0x29, 0xDE, 0xC0, 0xE1, 0xD0, 0x80, 0xBB, 0x7D, 0x08, 0x94, 0x83,
-    0x99, 0x4C, 0x5C, 0x6B, 0x05, 0x45, 0xF2, 0xBB, 0x90, 0x3D, 0x09, 0x38, 0x33, 0xFC, 0xAE, 0x33,
-    0x83, 0xB0, 0x69, 0x36, 0x71, 0xF6, 0x7C, 0x5C, 0x99, 0x38, 0x4B, 0xFF, 0x47, 0xC2, 0x71, 0x4F,
-    0xCA, 0x31, 0xFA, 0xBF, 0xBF, 0x4D, 0xFF, 0x45, 0xFE, 0x24, 0x96, 0xE7, 0xF0, 0xCE, 0x0B, 0x90,
-    0xA9, 0x88, 0xCA, 0x19, 0x72, 0xA4, 0x70, 0x29, 0xEC, 0x19, 0x56, 0x7F, 0x38, 0x37, 0xD6, 0x0E,
-    0x30, 0x98, 0xF6, 0xC9, 0x5F, 0x15, 0xEF, 0xD0, 0x05, 0x84, 0xEB, 0x0D, 0x7E, 0x1F, 0xB4, 0x61,
-    0x43, 0x6D, 0xBF, 0x42, 0xD5, 0xD8, 0x4F, 0xAC, 0x7D, 0xDF, 0x4E, 0x62, 0xCC, 0x9D, 0x69, 0x7C,
-    0x49, 0x88, 0x16, 0xC1, 0x14, 0x39, 0x51, 0x76, 0x62, 0x5C, 0x3F, 0xFB, 0xDA, 0x00, 0xC4, 0x50,
-    0x3E, 0x10, 0x28, 0x26, 0xCF, 0xBE, 0xA9, 0x57, 0x36, 0xD4, 0x2A, 0x17, 0xE0, 0x07, 0x2B, 0xE3,
-    0x78, 0x91, 0x7B, 0x79, 0xD5, 0x80, 0xDE, 0x36, 0x28, 0xB3, 0x53, 0x4B, 0x9C, 0x61, 0x1E, 0x30,
-    0x23, 0xA8, 0xD2, 0x02, 0x47, 0x90, 0x5B, 0x5A, 0x41, 0x4A, 0x25, 0xB4, 0x2E, 0x53, 0x0C, 0xB8,
-    0xF7, 0xB8, 0x8B, 0xEE, 0xE2, 0xCE, 0xBC, 0x8F, 0x37, 0x4B, 0x28, 0xC4, 0x1B, 0x4A, 0x79, 0xAC,
-    0xA9, 0xE6, 0x53, 0xB0, 0x93, 0xDA, 0x12, 0x59, 0x40, 0x03, 0x16, 0x06, 0xD9, 0x87, 0x63, 0x38,
-    0x0A, 0xAD, 0x4F, 0x42, 0x4B, 0x8C, 0xCD, 0xB9, 0x96, 0x4C, 0x36, 0x61, 0xD9, 0x7D, 0x80, 0x05,
-    0xE6, 0xB0, 0x32, 0x1D, 0x41, 0xD5, 0x98, 0x3E, 0xD5, 0x8D, 0x57, 0x7E, 0x06, 0x7A, 0xB9, 0x65,
-    0x01, 0xB6, 0x4D, 0x98, 0x7F, 0x09, 0xE1, 0xDA, 0x2F, 0xAC, 0x94, 0x92, 0x36, 0x80, 0xD4, 0x00,
-    0xBD, 0x59, 0x08, 0xC3, 0x54, 0xAF, 0x49, 0xDC, 0x3A, 0x68, 0x43, 0xF7, 0xDA, 0x0B, 0x01, 0x83,
-    0xE7, 0x56, 0x47, 0xF6, 0xC8, 0xF5, 0x23, 0x47, 0x0E, 0xD2, 0x22, 0x7D, 0x1D, 0x58, 0x4E, 0x1B,
-    0x23, 0x00, 0xCB, 0x45, 0x3C, 0x95, 0x4D, 0x5A, 0xC5, 0x2D, 0x31, 0xFB, 0xB2, 0x04, 0x10, 0x39,
-    0xA0, 0x28, 0x11, 0x64, 0x6E, 0x48, 0x3E, 0x22, 0xDB, 0x23, 0xA5, 0x58, 0xC9, 0x7F, 0x96, 0x68,
-    0x0F, 0xA9, 0x68, 0x8C, 0xE9, 0xAF, 0x0E, 0xCE, 0x21, 0xA2, 0x9A, 0x1A, 0x88, 0xA1, 0x4A, 0xA9,
-    0x58, 0xC8, 0xDA, 0x3B, 0x4F, 0x6B, 0xF0, 0x7E, 0xBD, 0x9A, 0x57, 0xCA, 0x0E, 0x2D, 0x6D, 0x98,
-    0xFA, 0xA3, 0x78, 0x3F, 0x6D, 0x31, 0x73, 0x68, 0x32, 0x55, 0xE0, 0x02, 0x94, 0x00, 0x09, 0x60,
-    0x9F, 0xD2, 0x06, 0x5B, 0x9F, 0x06, 0x99, 0x63, 0x1A, 0x11, 0x59, 0x96, 0x93, 0xBE, 0xBB, 0x58,
-    0x94, 0x0B, 0x51, 0xE5, 0x52, 0xFF, 0xBF, 0x77, 0xF1, 0x67, 0x10, 0xFE, 0xFC, 0x3C, 0x08, 0x62,
-    0xE0, 0xE1, 0x93, 0x81, 0x3A, 0xF7, 0xD3, 0xD1, 0x81, 0x39, 0x51, 0x27, 0x01, 0xD7, 0x71, 0x8A,
-    0xB3, 0x48, 0xBA, 0xE3, 0xB5, 0x04, 0xAB, 0x75, 0xC0, 0xB0, 0x54, 0xAE, 0x39, 0x55, 0x9A, 0xE5,
-    0x76, 0x84, 0xC5, 0xD7, 0xB2, 0xA1, 0x6B, 0x89, 0x7A, 0x8A, 0xAF, 0x52, 0x56, 0x46, 0xA3, 0x40,
-    0xB9, 0x2A, 0xE6, 0x1C, 0x47, 0x0A, 0xF4, 0x01, 0x38, 0x04, 0x43, 0x81, 0x11, 0x46, 0x99, 0xE6,
-    0x65, 0x9D, 0x53, 0x5F, 0x95, 0xE4, 0x6F, 0x62, 0x81, 0x00, 0x93, 0x3F, 0xE0, 0xC9, 0x12, 0x8A,
-    0x36, 0x07, 0x03, 0xF4, 0x9D, 0x17, 0x61, 0x1B, 0x8F, 0xE8, 0xD4, 0x02, 0x3B, 0xE4, 0x16, 0x12,
-    0xDE, 0x69, 0xAC, 0x02, 0xAB, 0x9D, 0x78, 0x2C, 0x17, 0x0B, 0x58, 0x63, 0xD0, 0xEF, 0x41, 0x0C,
-    0xD7, 0x20, 0xA2, 0x17, 0xC5, 0x60, 0xC4, 0x9C, 0x0C, 0xE8, 0x94, 0xBE, 0x56, 0x14, 0xCC, 0x5E,
-    0x07, 0x07, 0x8C, 0x54, 0x22, 0xE5, 0x0A, 0x0F, 0xAB, 0xC7, 0x14, 0x1F, 0x84, 0x27, 0x4D, 0x2D,
-    0x7A, 0x40, 0xF2, 0xEF, 0x25, 0xFD, 0xDC, 0x66, 0x06, 0x2A, 0x87, 0x89, 0x8D, 0xE8, 0x23, 0xFD,
-    0x01, 0xA6, 0x04, 0xB3, 0x80, 0xC0, 0x7B, 0xDC, 0xDA, 0x8F, 0xC0, 0x20, 0xF4, 0x40, 0x58, 0x89,
-    0x37, 0xD9, 0xC6, 0x1F, 0xC2, 0x09, 0xDD, 0xA4, 0x35, 0xA0, 0x3F, 0xE4, 0xCE, 0x48, 0x12, 0x98,
-    0x46, 0xD4, 0x42, 0xA0, 0x9D, 0xE9, 0xA2, 0x01, 0x30, 0x1A, 0x60, 0x64, 0x6E, 0x15, 0x62, 0x6E,
-    0x13, 0x57, 0x19, 0x80, 0xD6, 0x98, 0x3A, 0xE9, 0xD2, 0x8C, 0x6F, 0xF9, 0xB4, 0xAA, 0x11, 0xC7,
-    0xC4, 0x03, 0xBD, 0x4C, 0x90, 0xDA, 0x64, 0x5A, 0x58, 0xA1, 0xBD, 0x33, 0x6A, 0x07, 0xDF, 0x7B,
-    0x77, 0xB5, 0x2C, 0xEA, 0x00, 0xC4, 0x2B, 0x65, 0x41, 0xE6, 0x95, 0xED, 0x5E, 0xB6, 0x21, 0xF2,
-    0x7C, 0x74, 0x66, 0xFD, 0x5C, 0xF2, 0xB1, 0x9D, 0xD2, 0x63, 0xBF, 0x16, 0xDD, 0x78, 0x68, 0xCB,
-    0xBF, 0x84, 0x67, 0x0F, 0x06, 0x98, 0xE4, 0x40, 0xD5, 0x3F, 0xFE, 0x39, 0x99, 0x88, 0x44, 0x79,
-    0x15, 0x8C, 0x11, 0x5A, 0xE0, 0x12, 0xDD, 0x77, 0x64, 0x7A, 0xE8, 0x5D, 0x87, 0xCE, 0xB1, 0xFC,
-    0x84, 0xD0, 0xC6, 0xF8, 0xBE, 0xEA, 0xBA, 0x71, 0x7A, 0xFE, 0x63, 0xBE, 0x08, 0x45, 0xFD, 0x35,
-    0x50, 0x79, 0xC3, 0x3A, 0x9F, 0xB4, 0xFA, 0x6C, 0xCC, 0xE7, 0xCA, 0x89, 0x50, 0x5F, 0xFB, 0xA2,
-    0xE3, 0x40, 0x30, 0x84, 0x76, 0xC9, 0x01, 0xB4, 0x4F, 0xC3, 0x3E, 0x49, 0x5D, 0xAD, 0x84, 0x30,
-    0x77, 0xF4, 0x8C, 0x8E, 0x8D, 0x23, 0x02, 0xBF, 0x70, 0xFD, 0xC0, 0x4B, 0xA7, 0x84, 0x5F, 0x3D,
-    0xDB, 0x6D, 0xD5, 0xC6, 0xF6, 0x95, 0xE3, 0xCE, 0xA8, 0x7E, 0x97, 0xB2, 0x89, 0xE0, 0xA3, 0x8F,
-    0xE1, 0xC9, 0x46, 0xF2, 0x3C, 0xBC, 0x1E, 0x9C, 0xFC, 0x51, 0xB0, 0xE1, 0xFD, 0x92, 0xA8, 0xC6,
-    0x08, 0x38, 0x7B, 0xE7, 0x74, 0x56, 0x0A, 0x5F, 0x08, 0xF8, 0x50, 0x14, 0xA1, 0x0A, 0xFE, 0x43,
-    0x18, 0x01, 0x16, 0xDA, 0xA8, 0xED, 0x9A, 0x4A, 0x61, 0xA3, 0x5F, 0x11, 0xE4, 0x23, 0xAF, 0xC3,
-    0x77, 0xC4, 0xB5, 0x0F, 0xA0, 0x98, 0x57, 0xDB, 0xE0, 0x30, 0xCF, 0xC2, 0x4F, 0x7A, 0xAF, 0x03,
-    0xF1, 0x0C, 0x03, 0x42, 0x27, 0xC0, 0x27, 0x55, 0x97, 0x10, 0x7F, 0x8C, 0x37, 0x2E, 0x15, 0xC1,
-    0xD7, 0x8D, 0x6C, 0x02, 0x2E, 0x87, 0x78, 0xFC, 0x7F, 0x7B, 0xB9, 0xB2, 0x03, 0xA1, 0xCE, 0xC4,
-    0x24, 0x55, 0x5C, 0xC5, 0x45, 0xF2, 0xB3, 0x36, 0x68, 0xA3, 0x36, 0x41, 0x60, 0x50, 0x5E, 0x82,
-    0xF1, 0x19, 0xC0, 0xE2, 0x2D, 0x0B, 0xF0, 0xCB, 0x32, 0xFB, 0x1B, 0x07, 0x54, 0xBA, 0xF0, 0x5A,
-    0xBF, 0xFC, 0xD5, 0xAD, 0xA1, 0xE4, 0xC8, 0x3D, 0x87, 0xF3, 0xB2, 0x75, 0x93, 0xA6, 0x27, 0xDF,
-    0xB4, 0x53, 0x26, 0x4F, 0x7C, 0x5C, 0x58, 0x97, 0xAB, 0xEC, 0xC8, 0x33, 0x42, 0x35, 0x72, 0x25,
-    0x77, 0xD8, 0x14, 0xFC, 0x8E, 0x4D, 0x7E, 0xAB, 0x4D, 0xBD, 0x2E, 0xF1, 0x4A, 0xE8, 0xC8, 0x83,
-    0x83, 0xC5, 0x05, 0x9B, 0x10, 0xF8, 0x38, 0xBE, 0x40, 0x93, 0x37, 0x2D, 0xCA, 0x8A, 0x7C, 0x47,
-    0x34, 0xE7, 0x8B, 0x05, 0x9A, 0xE0, 0x4A, 0xF1, 0x14, 0xE4, 0x12, 0xA8, 0x67, 0x05, 0xA3, 0x91,
-    0x52, 0x92, 0x8A, 0xA6, 0x15, 0xF6, 0x21, 0x1E, 0x34, 0xF6, 0x4B, 0xD8, 0x4A, 0x02, 0x0C, 0x23,
-    0x66, 0xF1, 0xE0, 0x13, 0x0B, 0xCE, 0xB9, 0xDE, 0x00, 0x73, 0x57, 0x50, 0x60, 0x5E, 0xC0, 0xEF,
-    0x2C, 0xD1, 0x09, 0xDE, 0x28, 0xE1, 0xCD, 0xD0, 0x64, 0x32, 0x34, 0xD1, 0x8B, 0xA0, 0xC3, 0x92,
-    0x91, 0x24, 0x9E, 0x47, 0xD3, 0x05, 0xDA, 0xA5, 0x90, 0xF0, 0x3D, 0x06, 0x26, 0x41, 0xA7, 0x8E,
-    0x9E, 0x7E, 0x1E, 0x4D, 0x3E, 0x9B, 0x4C, 0x13, 0xDD, 0xBF, 0x68, 0x19, 0x7E, 0x36, 0xC6, 0xAA,
-    0xDF, 0x39, 0xFA, 0x9C, 0x82, 0x7C, 0x40, 0x80, 0x13, 0xD4, 0x7B, 0x71, 0xF0, 0x60, 0x9B, 0x2D,
-    0xB8, 0x21, 0xAE, 0xB0, 0x82, 0x19, 0x97, 0xFC, 0x1B, 0x5D, 0x3D, 0x57, 0xCD, 0xD5, 0x3A, 0x99,
-    0x93, 0x4F, 0x94, 0x21, 0xC2, 0xA3, 0x26, 0xF2, 0x88, 0x92, 0xB6, 0x6A, 0x83, 0xF6, 0x07, 0x05,
-    0x64, 0xF2, 0x52, 0x64, 0x1F, 0xEC, 0x36, 0x91, 0x75, 0x73, 0x85, 0x3A, 0x4E, 0x13, 0x5D, 0x80,
-    0x39, 0x97, 0x7B, 0x5B, 0x75, 0x34, 0xCA, 0x86, 0xDD, 0xD8, 0x9D, 0x08, 0x59, 0x98, 0x0D, 0x66,
-    0x1E, 0x8C, 0x14, 0x5C, 0xC0, 0x45, 0x03, 0x67, 0x44, 0x72, 0xDC, 0x44, 0xF4, 0x00, 0x15, 0xA7,
-    0x52, 0xB2, 0x59, 0xD7, 0x84, 0x67, 0xD9, 0x6C, 0x8E, 0x9B, 0x83, 0x5E, 0x9F, 0xA6, 0xBF, 0x76,
-    0xC8, 0x04, 0x3D, 0x97, 0x7C, 0x11, 0xCD, 0x21, 0xBA, 0xBF, 0x7F, 0xC1, 0x56, 0xA1, 0xEA, 0xC8,
-    0x38, 0x60, 0x3B, 0x10, 0xA0, 0xE5, 0x13, 0xBA, 0x8C, 0x9F, 0xE6, 0x9F, 0x2F, 0x28, 0x44, 0x8D,
-    0xEE, 0x7C, 0x8E, 0x19, 0x66, 0x2B, 0x94, 0x3B, 0xAF, 0xC5, 0xD9, 0x91, 0x0A, 0x61, 0x0C, 0xD4,
-    0x96, 0x3F, 0x2D, 0x7E, 0xB5, 0x6A, 0x7A, 0xF4, 0xA9, 0x17, 0xD1, 0xE4, 0x53, 0xFA, 0x71, 0x81,
-    0xA6, 0x2B, 0xFE, 0xF8, 0xE3, 0x77, 0xEF, 0xDB, 0x95, 0xDD, 0x5B, 0x1D, 0x6D, 0x17, 0xC7, 0x6F,
-    0xF3, 0xCF, 0x77, 0x7B, 0x3C, 0x39, 0xE3, 0xBA, 0xF1, 0xA0, 0x57, 0x2B, 0xA6, 0xDA, 0xD5, 0x48,
-    0xEC, 0xCC, 0x7C, 0xF8, 0x3A, 0x11, 0xD1, 0x2A, 0xCD, 0x95, 0xAB, 0x61, 0x1E, 0x7F, 0x62, 0xDD,
-    0x30, 0x32, 0xE8, 0x9F, 0xD4, 0x95, 0x88, 0x13, 0xB0, 0xBB, 0x8E, 0xAC, 0xBA, 0xAF, 0xB7, 0xB7,
-    0x1B, 0xCF, 0x32, 0xC8, 0x84, 0x9A, 0x02, 0x15, 0xE6, 0x8C, 0x4C, 0xEF, 0xAB, 0xE8, 0x56, 0xB1,
-    0x6E, 0x9A, 0xAD, 0x15, 0xAA, 0xFA, 0xA5, 0x97, 0x88, 0xEC, 0x48, 0xF7, 0x63, 0x6F, 0x21, 0x95,
-    0xD8, 0xED, 0xD5, 0x55, 0xBC, 0xAA, 0x64, 0x4B, 0x0A, 0x48, 0x33, 0xF4, 0x08, 0xA8, 0x31, 0x16,
-    0xC9, 0x0C, 0x86, 0xE8, 0x28, 0x14, 0x2B, 0x2A, 0x1A, 0x28, 0xFA, 0x3C, 0x25, 0x8B, 0xF8, 0x09,
-    0xEB, 0x26, 0xC8, 0xFB, 0xEF, 0x60, 0xC0, 0x4D, 0x47, 0x1B, 0xB9, 0xAE, 0x00, 0x03, 0x7C, 0xE3,
-    0x8D, 0x55, 0xE6, 0x31, 0x2E, 0x6D, 0x9A, 0x16, 0x8B, 0x77, 0xDB, 0x67, 0xEC, 0x60, 0x24, 0x86,
-    0xA0, 0x73, 0xAC, 0x05, 0x51, 0x27, 0x82, 0x2C, 0x5B, 0xE5, 0xF6, 0x1E, 0x75, 0x5D, 0xAB, 0x6D,
-    0x50, 0x7C, 0x78, 0xF4, 0x69, 0x2E, 0x47, 0x4F, 0x75, 0xC8, 0x49, 0x21, 0x62, 0xE9, 0xE5, 0x52,
-    0xA7, 0x4A, 0x70, 0x60, 0xFB, 0xD6, 0x5F, 0xF0, 0xED, 0x54, 0x45, 0xA2, 0x60, 0xA5, 0x05, 0x95,
-    0x08, 0xC8, 0x21, 0xEF, 0x77, 0x34, 0xDD, 0x4B, 0x38, 0xD7, 0x22, 0xD7, 0xE9, 0x26, 0x0D, 0x0D,
-    0x5C, 0x0D, 0x05, 0x26, 0x17, 0xB5, 0x5C, 0xDB, 0x0A, 0xFC, 0x2E, 0xAC, 0x52, 0x34, 0x7C, 0xD9,
-    0x8B, 0x4B, 0xD5, 0xD0, 0x3C, 0xA9, 0x3D, 0xAA, 0x2D, 0x7E, 0xC9, 0xB3, 0x39, 0xE0, 0xB9, 0xA4,
-    0x75, 0xFA, 0x03, 0xCF, 0x51, 0xCB, 0xB3, 0xA9, 0x78, 0x2E, 0x99, 0xED, 0x30, 0x4E, 0xB5, 0x3F,
-    0xB0, 0xCC, 0x79, 0x3E, 0xD2, 0xA5, 0x16, 0x9A, 0x22, 0x63, 0x26, 0x1A, 0xF4, 0x89, 0xA7, 0x49,
-    0xD5, 0xEF, 0xD9, 0x43, 0xF5, 0xCC, 0x4D, 0xFF, 0x48, 0x33, 0x6F, 0x68, 0x22, 0x19, 0x9A, 0xF6,
-    0x69, 0x22, 0x77, 0xD7, 0x26, 0x42, 0x14, 0x53, 0x34, 0x23, 0x80, 0x04, 0xF1, 0x20, 0x78, 0x82,
-    0x8F, 0xA5, 0x27, 0x0C, 0x30, 0x7E, 0x8A, 0xD5, 0xCD, 0xC0, 0x70, 0x77, 0x20, 0xAE, 0x9B, 0xB5,
-    0x5C, 0x46, 0x5F, 0x97, 0x97, 0x12, 0xBF, 0x55, 0x49, 0x88, 0xD0, 0xA2, 0xC3, 0xED, 0x5E, 0x2A,
-    0x06, 0xA4, 0x1B, 0xBD, 0x87, 0x9C, 0x0E, 0x02, 0xDA, 0x4B, 0xAA, 0xB3, 0x20, 0xCB, 0xB8, 0x18,
-    0xA2, 0x0A, 0x0E, 0xB1, 0x8F, 0xEA, 0x1E, 0x31, 0x2A, 0x92, 0xD7, 0x18, 0xD6, 0x20, 0x5D, 0x70,
-    0x0F, 0xBE, 0x1D, 0xB3, 0x30, 0x57, 0x00, 0x16, 0xE4, 0x0D, 0x58, 0x38, 0xD2, 0xAB, 0x2C, 0xEE,
-    0x99, 0xF1, 0x20, 0xB4, 0x64, 0x5A, 0x67, 0x48, 0xDC, 0x29, 0xE9, 0xEF, 0x0C, 0x74, 0x14, 0x92,
-    0xAE, 0x43, 0x82, 0x49, 0xF9, 0xBE, 0xCA, 0x07, 0x7E, 0xBD, 0x0F, 0xA4, 0xC7, 0xB6, 0xA7, 0xD3,
-    0xFE, 0x0E, 0x30, 0xCE, 0x2C, 0x40, 0x13, 0x41, 0xF4, 0x61, 0x10, 0xEF, 0xE1, 0xE6, 0xDE, 0xA0,
-    0x37, 0x31, 0xFB, 0xF3, 0xDB, 0x3C, 0xE3, 0x0D, 0x89, 0x19, 0x37, 0x71, 0xCB, 0x1B, 0xF0, 0x3D,
-    0x6F, 0xFC, 0x51, 0x6F, 0xE2, 0x96, 0x37, 0x92, 0xBE, 0xC1, 0x1B, 0x6F, 0xD4, 0x9B, 0xF8, 0x1E,
-    0x6F, 0x90, 0xF2, 0xF2, 0x86, 0x41, 0xB1, 0xD1, 0xF8, 0x98, 0xA1, 0x4B, 0xDA, 0x86, 0x0C, 0xBB,
-    0xC0, 0x5E, 0xB6, 0x76, 0xF2, 0x76, 0x24, 0xB0, 0x71, 0xCE, 0x79, 0xF1, 0xAB, 0xE4, 0x07, 0xCE,
-    0xBC, 0xBC, 0xBD, 0x69, 0x95, 0xA3, 0xC1, 0x84, 0x3D, 0xE3, 0x6F, 0x46, 0x4D, 0x71, 0x4B, 0x0E,
-    0x8F, 0x3A, 0x46, 0x2A, 0xA1, 0xDA, 0x79, 0x30, 0x90, 0x0E, 0x02, 0x46, 0x9F, 0x2E, 0x06, 0x7D,
-    0xEC, 0x8C, 0x76, 0x3E, 0xD3, 0xF3, 0xF9, 0xA0, 0x4B, 0xF9, 0x6E, 0x9B, 0xB0, 0x9F, 0x26, 0xEE,
-    0x44, 0x73, 0x1C, 0x46, 0xB9, 0xBE, 0xAD, 0x11, 0xAC, 0x90, 0xF0, 0x3A, 0x59, 0x33, 0xD3, 0x8F,
-    0xAF, 0xAE, 0x9D, 0x0E, 0xBC, 0x0E, 0xE9, 0xC2, 0xCB, 0xAB, 0x6D, 0xD2, 0x6D, 0x4A, 0xFA, 0x9B,
-    0x7C, 0x06, 0xB9, 0xB8, 0x58, 0xAE, 0x2F, 0x46, 0x82, 0x1D, 0x18, 0x0F, 0x3B, 0x7F, 0xBC, 0xC8,
-    0x24, 0xC1, 0xA2, 0xDB, 0x49, 0x3D, 0xAB, 0xC3, 0xD6, 0x09, 0x17, 0x8C, 0x99, 0x2C, 0x63, 0x51,
-    0x7B, 0xEC, 0xF7, 0x37, 0xD5, 0xE7, 0x25, 0xEA, 0xFA, 0xA2, 0xE9, 0x02, 0xE1, 0xCC, 0x38, 0xAA,
-    0x62, 0x04, 0x00, 0xF0, 0x53, 0x08, 0x49, 0xEB, 0x8D, 0x9A, 0x04, 0x19, 0x95, 0x82, 0x92, 0x22,
-    0xB2, 0x3E, 0x15, 0x86, 0xD2, 0xA2, 0xA9, 0x9C, 0x04, 0x1E, 0xB9, 0xC1, 0x2F, 0xFA, 0x58, 0xE1,
-    0x24, 0x11, 0x68, 0x07, 0xE2, 0x44, 0x21, 0xA4, 0xC7, 0x81, 0xF1, 0x1A, 0xAF, 0x92, 0xD1, 0x2B,
-    0x75, 0x62, 0xC4, 0x36, 0xBE, 0x6E, 0x6B, 0xC4, 0xD2, 0x1C, 0x17, 0x2A, 0x5C, 0x7E, 0xC0, 0x64,
-    0xE7, 0xF0, 0xBC, 0xD3, 0x59, 0xA5, 0x5F, 0x2E, 0x2E, 0x7D, 0xCD, 0xC5, 0x9D, 0x14, 0x9B, 0x12,
-    0x2C, 0x26, 0x0F, 0xC1, 0xF5, 0x5C, 0x31, 0x86, 0x46, 0x88, 0x30, 0x8A, 0x8A, 0x8C, 0x62, 0x50,
-    0x86, 0xD0, 0x3C, 0xDF, 0x1B, 0xF4, 0x81, 0x82, 0x34, 0x01, 0x2C, 0x4E, 0xEC, 0x8C, 0x81, 0x3C,
-    0xCC, 0x9C, 0x0A, 0x34, 0xD7, 0xE9, 0x03, 0x06, 0xE7, 0x44, 0xD1, 0x0D, 0xA2, 0x5D, 0xCB, 0xCB,
-    0xC8, 0xBD, 0xD6, 0x52, 0x94, 0xB6, 0x86, 0xED, 0x07, 0xF6, 0x9F, 0xC9, 0xA0, 0x1A, 0x67, 0xBD,
-    0xE0, 0x84, 0x6A, 0x6C, 0x4D, 0xB7, 0x14, 0x8E, 0x17, 0x11, 0xF3, 0x09, 0x53, 0x96, 0x01, 0x99,
-    0x06, 0x43, 0xA5, 0x5F, 0x73, 0x55, 0x71, 0xEF, 0xFC, 0xBF, 0xCE, 0x3F, 0xB7, 0x0C, 0x97, 0xD1,
-    0x9A, 0x6B, 0x18, 0xFB, 0x1C, 0x86, 0x3F, 0x0B, 0xD2, 0x43, 0xBE, 0x3D, 0xEE, 0x20, 0x8E, 0x60,
-    0xCA, 0x93, 0xD7, 0x49, 0x0B, 0xD9, 0xD4, 0x74, 0x62, 0x04, 0x09, 0xBD, 0xA4, 0x55, 0xDA, 0xBF,
-    0xF1, 0x60, 0xF7, 0xC1, 0xEE, 0xBD, 0x16, 0x13, 0xDA, 0xDB, 0xA3, 0x53, 0x3F, 0x43, 0x7C, 0xBD,
-    0x8F, 0xA0, 0xC7, 0xAB, 0x9D, 0xBE, 0x95, 0x54, 0x56, 0x61, 0x68, 0xBB, 0xA6, 0x9C, 0x67, 0x68,
-    0x24, 0x4A, 0x14, 0x2B, 0x21, 0xB3, 0xDB, 0x54, 0x7D, 0xFB, 0xC7, 0xCC, 0x76, 0x6C, 0xB3, 0x5D,
-    0x23, 0x4E, 0xC9, 0x34, 0x5D, 0xD2, 0xB0, 0x4D, 0x93, 0x4D, 0xD6, 0x10, 0x34, 0x73, 0x92, 0x6F,
-    0xFB, 0x03, 0xF9, 0x9E, 0xF9, 0x53, 0xC1, 0x02, 0x0E, 0xA1, 0xA7, 0x96, 0x4B, 0xEE, 0x4F, 0x0F,
-    0x2F, 0x58, 0xA6, 0x9D, 0x0A, 0x5D, 0x63, 0x55, 0xE0, 0x8C, 0x98, 0x80, 0x67, 0xE4, 0xA1, 0x25,
-    0x35, 0x31, 0x51, 0x0D, 0x49, 0xCD, 0xB9, 0x23, 0x96, 0x54, 0xE7, 0xAB, 0x6F, 0xEA, 0xEA, 0x76,
-    0xF4, 0x76, 0xD4, 0x9C, 0xC3, 0x3D, 0xD0, 0x33, 0x1E, 0x0A, 0x34, 0x33, 0xE7, 0x39, 0x6C, 0x59,
-    0x04, 0x09, 0x58, 0x3C, 0xC3, 0xE0, 0x2C, 0xBB, 0x40, 0x77, 0xD4, 0xE8, 0xA8, 0xA9, 0xD1, 0xCE,
-    0x4C, 0x23, 0x81, 0x3D, 0x3D, 0xAB, 0x74, 0x12, 0x8D, 0x0D, 0x62, 0x65, 0x94, 0x15, 0xAF, 0xF0,
-    0x37, 0x52, 0x09, 0xE7, 0x99, 0xB2, 0xBE, 0xC5, 0x1C, 0x99, 0xCC, 0x97, 0x6A, 0x2C, 0x38, 0x69,
-    0x58, 0x9D, 0x54, 0xEA, 0xCB, 0x2A, 0xE6, 0x9F, 0x25, 0xD9, 0x46, 0x0B, 0x54, 0x19, 0x79, 0x9C,
-    0xF9, 0x7B, 0xE1, 0x3F, 0x6C, 0x39, 0x5B, 0xB8, 0x9E, 0xAF, 0x5B, 0x66, 0x2A, 0x49, 0x15, 0x7C,
-    0xA0, 0x85, 0xBE, 0xB8, 0x0E, 0xDF, 0xEB, 0x39, 0x6D, 0xE4, 0x14, 0xD7, 0x35, 0x2D, 0x43, 0xCA,
-    0x5B, 0x8C, 0x9A, 0x8E, 0x77, 0x89, 0x2C, 0x59, 0xE6, 0xF1, 0x7B, 0xB0, 0x25, 0x17, 0xE2, 0x0D,
-    0x33, 0x49, 0x59, 0xC5, 0x91, 0xE1, 0x8A, 0x98, 0xBF, 0xE2, 0x05, 0xD2, 0xDF, 0xE4, 0x26, 0x57,
-    0xB4, 0x03, 0xD9, 0x7E, 0xAC, 0x93, 0xED, 0xB4, 0x8A, 0xA0, 0x71, 0x7E, 0xA8, 0x22, 0x85, 0x27,
-    0x0D, 0x74, 0x75, 0xF1, 0x1A, 0x43, 0xAB, 0x8F, 0xB1, 0x43, 0x60, 0x07, 0xC3, 0x4A, 0x4C, 0xCF,
-    0x54, 0x87, 0xD1, 0x4F, 0x81, 0x18, 0x1C, 0xF4, 0x44, 0x6D, 0xC6, 0xAD, 0xCA, 0x90, 0x88, 0x07,
-    0x86, 0x0D, 0x47, 0xB1, 0x3B, 0xC7, 0xB2, 0x32, 0x2A, 0x9F, 0xB8, 0x3B, 0x6E, 0x59, 0x5A, 0x4D,
-    0x24, 0x99, 0xF1, 0x07, 0x2D, 0x39, 0x02, 0xC9, 0x0D, 0xAD, 0xAD, 0x20, 0x6D, 0xE4, 0x8C, 0x74,
-    0xB9, 0x64, 0xAB, 0x25, 0x05, 0xE4, 0xFE, 0xB6, 0x8A, 0xA8, 0xE5, 0x2A, 0x56, 0x5D, 0xC7, 0xEA,
-    0xFB, 0x53, 0x7B, 0x1D, 0xC4, 0x81, 0x7C, 0x2B, 0x57, 0x01, 0x5B, 0x96, 0x00, 0x61, 0xED, 0x31,
-    0xCD, 0x95, 0x25, 0xAB, 0xA0, 0x57, 0xED, 0xB6, 0xD4, 0x62, 0xDC, 0x70, 0xD4, 0xE4, 0x06, 0xE5,
-    0x60, 0x96, 0xC7, 0xA9, 0x0D, 0xC7, 0x77, 0x01, 0xBB, 0x22, 0xD0, 0x65, 0xFE, 0xAB, 0x30, 0xEF,
-    0xB1, 0xE6, 0xFF, 0x76, 0x24, 0xC9, 0x75, 0x51, 0xC3, 0x34, 0xC0, 0x57, 0x71, 0x0C, 0xE9, 0x83,
-    0x85, 0x3D, 0x60, 0xEA, 0xBE, 0x85, 0xB1, 0x91, 0x38, 0xA6, 0xC5, 0x77, 0x15, 0x13, 0x0C, 0x41,
-    0x34, 0xF4, 0x8F, 0xD7, 0x51, 0x29, 0x59, 0xF1, 0xF1, 0x9B, 0x46, 0x2B, 0x25, 0x5E, 0x85, 0x49,
-    0x6C, 0x51, 0xF0, 0x1F, 0x30, 0x35, 0x2D, 0x17, 0x8B, 0x5D, 0x3A, 0x7B, 0x66, 0xBD, 0x2E, 0x64,
-    0x2D, 0xBF, 0xB2, 0x1F, 0xD5, 0x46, 0xF6, 0xFC, 0x36, 0xAA, 0x9E, 0xF2, 0x0B, 0x21, 0x4A, 0xC6,
-    0x44, 0x8E, 0x90, 0x60, 0xE1, 0xB8, 0x73, 0xE5, 0xC0, 0x2B, 0xAE, 0xC5, 0xB8, 0x0A, 0xC6, 0xBA,
-    0xA5, 0xD5, 0xAC, 0x9D, 0xE2, 0x26, 0x5E, 0x66, 0xA2, 0x45, 0xC1, 0xA4, 0xD0, 0x16, 0x42, 0x29,
-    0x75, 0xE5, 0x1F, 0x9A, 0xC4, 0x9E, 0xEB, 0xE0, 0x74, 0xDA, 0x23, 0x5D, 0x2E, 0x66, 0x82, 0x48,
-    0xE2, 0x69, 0xBF, 0xEC, 0xEF, 0xB8, 0x1A, 0xAD, 0x84, 0x75, 0x8E, 0x05, 0x0D, 0x7A, 0x9B, 0x61,
-    0xB8, 0x2B, 0x29, 0x83, 0x91, 0x4C, 0x60, 0x74, 0x9C, 0x7F, 0xD0, 0x06, 0x4D, 0x08, 0xC3, 0x04,
-    0x4D, 0x74, 0x18, 0x73, 0xC0, 0x6C, 0xF7, 0x90, 0xAA, 0x6F, 0xCD, 0xF1, 0x49, 0x21, 0x93, 0x3B,
-    0x2E, 0x95, 0x7C, 0x99, 0x25, 0xAD, 0x22, 0x45, 0x46, 0xE3, 0x31, 0x89, 0x76, 0x0E, 0x9D, 0x55,
-    0x16, 0x90, 0x15, 0x48, 0x5F, 0xD9, 0x1D, 0x39, 0x77, 0x07, 0x8C, 0x6E, 0x68, 0xF1, 0x8D, 0x60,
-    0xF5, 0x2E, 0x31, 0xB5, 0x86, 0x57, 0xB3, 0x77, 0x1A, 0x40, 0x6C, 0x89, 0x3E, 0xA2, 0x86, 0xB9,
-    0x33, 0x34, 0x1E, 0xA3, 0x25, 0xB4, 0x3F, 0x37, 0xF6, 0x6B, 0x5B, 0x95, 0x23, 0x3C, 0xD5, 0x79,
-    0xC6, 0x09, 0xF4, 0x38, 0xC9, 0xB0, 0x86, 0xED, 0x86, 0x42, 0xE2, 0xC4, 0x13, 0x8B, 0x03, 0xB0,
-    0x0F, 0x70, 0x0C, 0xC9, 0xD2, 0x1E, 0x22, 0xD1, 0x46, 0x02, 0xDA, 0x0B, 0x6B, 0x3C, 0x78, 0xC4,
-    0xE3, 0x09, 0x37, 0x8F, 0x9D, 0x8E, 0x7E, 0xF0, 0x79, 0x0A, 0x68, 0xE5, 0x11, 0x93, 0xE6, 0xBC,
-    0xF2, 0x94, 0xE8, 0x4A, 0x7A, 0x24, 0x6F, 0x0E, 0xE5, 0xB0, 0xFE, 0x87, 0xA0, 0x15, 0x08, 0xF4,
-    0x46, 0x58, 0x19, 0xF2, 0xEB, 0x7D, 0x89, 0x80, 0xBB, 0x97, 0x88, 0xD7, 0x25, 0xED, 0xDE, 0x91,
-    0x90, 0xC6, 0xF6, 0x99, 0x32, 0x26, 0x23, 0xD7, 0xD0, 0xBE, 0xFD, 0xF7, 0x90, 0x47, 0xC7, 0xF2,
-    0x91, 0xCC, 0xD5, 0x3F, 0x9D, 0x16, 0x57, 0x3A, 0x44, 0x5F, 0xC4, 0x78, 0x79, 0x04, 0xF7, 0xC7,
-    0x4E, 0xDE, 0xF9, 0x5C, 0x41, 0xAE, 0x79, 0x86, 0x84, 0x87, 0x60, 0x61, 0x98, 0x76, 0x4E, 0xCE,
-    0x62, 0x51, 0x11, 0xA7, 0x9C, 0xA7, 0xF2, 0x84, 0x93, 0xFE, 0x90, 0xEA, 0x73, 0x90, 0x03, 0x72,
-    0xE7, 0x4D, 0xA6, 0x18, 0x36, 0x47, 0x92, 0x30, 0x22, 0xFC, 0x3B, 0x9D, 0x6D, 0x08, 0x2B, 0x29,
-    0x9E, 0x56, 0x03, 0x47, 0xD6, 0x7E, 0x93, 0x22, 0x40, 0x7C, 0xCA, 0x12, 0x66, 0xF2, 0x8B, 0x0F,
-    0xE7, 0x4B, 0x38, 0xF1, 0x07, 0x18, 0xF5, 0x23, 0x22, 0xF5, 0xB8, 0x44, 0x17, 0x68, 0xE5, 0xE7,
-    0xED, 0xBF, 0x63, 0xDA, 0x17, 0x1E, 0x2D, 0xE7, 0x7B, 0x57, 0x31, 0x43, 0xF8, 0xF4, 0x87, 0x16,
-    0xCF, 0x72, 0x93, 0xE4, 0x79, 0x72, 0x27, 0x69, 0x93, 0xEF, 0xF0, 0x88, 0x34, 0xAF, 0xB1, 0xD5,
-    0xEB, 0xD3, 0x22, 0x5B, 0xB7, 0x3D, 0xED, 0xC1, 0x02, 0x84, 0x12, 0x3A, 0xC4, 0x7F, 0x8E, 0xC1,
-    0x45, 0xC3, 0x62, 0x6F, 0x31, 0x49, 0xF9, 0x07, 0x01, 0x41, 0x93, 0x14, 0xD0, 0xDE, 0x92, 0xBB,
-    0x38, 0x3D, 0x88, 0x43, 0x71, 0x14, 0x6B, 0x85, 0x81, 0xF3, 0x63, 0x8A, 0xA7, 0x9B, 0x27, 0xEA,
-    0x45, 0x96, 0x1A, 0xB2, 0x2C, 0x16, 0x19, 0x5D, 0x58, 0xC5, 0xEC, 0xBE, 0x80, 0x6F, 0x2B, 0x59,
-    0xFE, 0x60, 0xD9, 0x36, 0x68, 0x49, 0x2A, 0xAF, 0x0E, 0x5A, 0xFF, 0xF8, 0xC2, 0x16, 0x21, 0x4B,
-    0x02, 0xDE, 0x02, 0xA9, 0x8E, 0xB8, 0x98, 0x87, 0xB4, 0x94, 0x2B, 0xD2, 0xB6, 0xAB, 0x23, 0x6E,
-    0x4A, 0x9E, 0xB8, 0x24, 0x4E, 0x92, 0xF7, 0xB8, 0xC1, 0x35, 0x32, 0x4C, 0x4A, 0xEC, 0x8F, 0x18,
-    0xCC, 0x65, 0xB1, 0xEE, 0x8C, 0xE4, 0xBA, 0xB1, 0xD1, 0xE9, 0x26, 0x49, 0xF6, 0x2C, 0x97, 0x89,
-    0xAD, 0x8C, 0x3D, 0x50, 0x0F, 0x00, 0x9B, 0x40, 0x94, 0x97, 0x22, 0x86, 0x2B, 0xBC, 0x47, 0xFD,
-    0x83, 0x6C, 0xC3, 0x0F, 0xD7, 0xF4, 0x0C, 0x23, 0x5F, 0x73, 0x7B, 0x27, 0x27, 0x5E, 0x26, 0xB6,
-    0xE5, 0xD4, 0x36, 0x68, 0x17, 0x79, 0x15, 0x0E, 0xAE, 0x40, 0xB2, 0x8E, 0x46, 0xFB, 0xC8, 0x16,
-    0x9B, 0x3D, 0x94, 0xE9, 0x7F, 0xF3, 0x09, 0x81, 0x68, 0x9A, 0x31, 0xDB, 0xF3, 0x6C, 0x51, 0xD6,
-    0xFE, 0x55, 0x27, 0x2B, 0x33, 0xAC, 0x45, 0x75, 0x6A, 0x58, 0x8B, 0xE7, 0xE4, 0x13, 0x72, 0x95,
-    0xD5, 0x09, 0xBE, 0x4C, 0xEB, 0x43, 0x1E, 0x43, 0x3E, 0x6F, 0xC0, 0x8C, 0xBC, 0x81, 0xF5, 0x5E,
-    0xD5, 0xFD, 0xA8, 0x95, 0x5F, 0x90, 0x34, 0x7E, 0xE0, 0x6E, 0x46, 0xCC, 0x47, 0x48, 0xDC, 0x08,
-    0x0A, 0x29, 0xA5, 0xBC, 0x81, 0x7C, 0x92, 0x3E, 0x45, 0xDE, 0xA0, 0x3E, 0xF4, 0x3C, 0xFE, 0x95,
-    0xC0, 0x68, 0xE5, 0xB1, 0xEA, 0xB4, 0xDA, 0x95, 0xCA, 0x9F, 0xE5, 0x32, 0x33, 0xF6, 0xAE, 0x46,
-    0xB9, 0x50, 0x27, 0x68, 0xCD, 0x9F, 0x22, 0x5B, 0x83, 0x5A, 0x02, 0x7B, 0x13, 0x0E, 0x07, 0xCA,
-    0xDD, 0xB5, 0x9F, 0x59, 0xFB, 0xEF, 0x0C, 0x8C, 0xB2, 0x78, 0x64, 0x44, 0x03, 0x6D, 0x7D, 0x93,
-    0xD8, 0xBF, 0xC5, 0x65, 0x03, 0xD5, 0x24, 0x2C, 0x8B, 0x15, 0xA5, 0x8D, 0xB5, 0x44, 0x9A, 0xAE,
-    0x26, 0x25, 0xE5, 0x1B, 0x8C, 0x03, 0x07, 0xA0, 0xD4, 0x2F, 0xED, 0xBF, 0x71, 0x26, 0x45, 0xE8,
-    0x5E, 0x2E, 0xF8, 0x72, 0xAF, 0x51, 0x76, 0xE1, 0x36, 0xE2, 0x9E, 0xEE, 0x12, 0x03, 0x25, 0xF6,
-    0x03, 0x3B, 0x05, 0xCC, 0xD6, 0xCE, 0x13, 0xF2, 0x8C, 0xFD, 0x58, 0xDE, 0xC9, 0x72, 0xD6, 0x50,
-    0xED, 0x5F, 0x70, 0xAF, 0x2E, 0x75, 0x9B, 0x48, 0xBA, 0xA5, 0x94, 0xDC, 0xE0, 0xB6, 0x2A, 0x0B,
-    0x05, 0x37, 0xD8, 0x02, 0xDA, 0x4B, 0x0E, 0x7A, 0x97, 0x75, 0xE5, 0x98, 0x8F, 0xA9, 0xC9, 0x7C,
-    0xCC, 0x3D, 0x81, 0x84, 0x9F, 0xAB, 0x43, 0x3F, 0x27, 0xDB, 0xD7, 0x2D, 0x10, 0xB6, 0x6D, 0x87,
-    0x4D, 0x7B, 0xB8, 0xDD, 0xFB, 0x60, 0x35, 0x56, 0xCA, 0x92, 0x1A, 0x53, 0x49, 0x8B, 0x25, 0xEB,
-    0x05, 0xCC, 0x1C, 0xE0, 0x2E, 0xA2, 0x16, 0x4D, 0x86, 0x4D, 0x93, 0xCF, 0x4E, 0xD1, 0x84, 0x6C,
-    0x8B, 0x13, 0x2E, 0xAF, 0x6E, 0x37, 0xBE, 0x5D, 0x97, 0x94, 0xC8, 0x50, 0xCE, 0xB8, 0x7B, 0x71,
-    0x9B, 0x3C, 0xDA, 0xE4, 0x33, 0x8D, 0x61, 0x6D, 0xC0, 0x9B, 0x2B, 0x4F, 0x71, 0x73, 0x13, 0x04,
-    0x72, 0x5B, 0x4B, 0x64, 0xFE, 0x94, 0xE5, 0x95, 0xD2, 0x29, 0xB7, 0x1A, 0xC1, 0x24, 0x61, 0xCB,
-    0x1D, 0x80, 0x8A, 0xF4, 0xB9, 0x06, 0x61, 0xD8, 0x1A, 0x36, 0x29, 0x99, 0x4E, 0x30, 0x15, 0x96,
-    0xFE, 0xDA, 0x70, 0xBA, 0xA8, 0x65, 0xBA, 0x1C, 0x4C, 0xF8, 0xDB, 0x61, 0x1D, 0x9C, 0xA8, 0xE9,
-    0x1F, 0x17, 0x1E, 0x5B, 0xB2, 0x3A, 0x13, 0x58, 0x7A, 0x49, 0x1D, 0xDD, 0x3B, 0x67, 0x9A, 0xFC,
-    0x53, 0x64, 0xE2, 0xFF, 0x04, 0x16, 0x46, 0xDE, 0xF2, 0x7D, 0x72, 0x29, 0x23, 0x35, 0x66, 0xB2,
-    0xE3, 0x6A, 0x8B, 0xE0, 0xC4, 0xDB, 0x04, 0x4A, 0x50, 0x6F, 0x0B, 0x14, 0x26, 0x96, 0xD5, 0xA2,
-    0x02, 0x11, 0x68, 0x92, 0x45, 0x6F, 0x74, 0xF2, 0x0F, 0xCC, 0x8C, 0x99, 0x53, 0xEB, 0x7E, 0x20,
-    0x54, 0xC8, 0x5C, 0x6E, 0x78, 0x19, 0x4A, 0x40, 0x84, 0x3D, 0x93, 0xF8, 0xA0, 0xF3, 0xFB, 0xF4,
-    0xA1, 0xF5, 0x28, 0xA5, 0xB9, 0xDB, 0x7C, 0x9E, 0x69, 0x5C, 0x01, 0x21, 0x41, 0x58, 0x48, 0xD8,
-    0x6E, 0x5A, 0xFB, 0xD5, 0xEE, 0x83, 0xFF, 0xA0, 0xE4, 0x96, 0x2A, 0x36, 0xF7, 0xCB, 0x93, 0x37,
-    0x95, 0x44, 0x87, 0x17, 0x58, 0x52, 0x30, 0xC0, 0xDF, 0xDC, 0x31, 0x85, 0x5F, 0x16, 0x70, 0x63,
-    0x65, 0x8F, 0x6C, 0xDF, 0x2B, 0x8B, 0x53, 0x13, 0x41, 0x17, 0x11, 0xB1, 0x24, 0xE4, 0xA7, 0xBB,
-    0x34, 0xBC, 0xD4, 0x12, 0xB0, 0x24, 0x5D, 0xA2, 0xF5, 0x39, 0xF8, 0x7E, 0xDF, 0xF6, 0xF0, 0xF5,
-    0xCA, 0xF8, 0x39, 0x90, 0x3F, 0xF1, 0x34, 0x22, 0x66, 0x09, 0x5B, 0x2D, 0x57, 0x13, 0xDB, 0x4C,
-    0x60, 0x12, 0x62, 0x41, 0x73, 0x0B, 0xA6, 0x16, 0x8C, 0x8C, 0x4C, 0xC1, 0x40, 0xF8, 0x3A, 0xA5,
-    0xF7, 0x01, 0x83, 0xE1, 0x4F, 0x99, 0x4F, 0x3C, 0xAC, 0x56, 0xFB, 0x1D, 0x5A, 0x02, 0x56, 0xA4,
-    0xB8, 0xCA, 0x6A, 0x11, 0x43, 0x6A, 0x6F, 0xD9, 0x3A, 0x04, 0x4C, 0x9B, 0x32, 0xA3, 0x19, 0x10,
-    0x13, 0x70, 0xB6, 0x0D, 0x86, 0xC8, 0x19, 0xB9, 0xE4, 0xDC, 0xC8, 0xE0, 0x4E, 0x52, 0x5C, 0x42,
-    0x74, 0x41, 0x1F, 0xDE, 0x44, 0x18, 0x08, 0x88, 0xDC, 0xED, 0xB9, 0xC3, 0x5F, 0x75, 0x69, 0x80,
-    0x20, 0xBD, 0xBB, 0x1C, 0xFD, 0x17, 0x46, 0xDB, 0x39, 0xE3, 0xF5, 0x8C, 0xE9, 0x6E, 0x66, 0xE9,
-    0x16, 0x46, 0x7C, 0x58, 0x45, 0x77, 0x18, 0xB4, 0x34, 0xDC, 0x11, 0x61, 0xE0, 0xCD, 0x52, 0x84,
-    0x2B, 0xD9, 0x1D, 0x67, 0x2A, 0x05, 0xD9, 0xA4, 0xB0, 0x3D, 0x38, 0x18, 0xA2, 0x98, 0xD4, 0xAF,
-    0x67, 0x4C, 0x8E, 0xDE, 0x63, 0x94, 0xF6, 0xB5, 0xCE, 0x3C, 0x5B, 0xCD, 0x5C, 0xFB, 0x09, 0xEE,
-    0xA0, 0x97, 0xF8, 0x4D, 0x56, 0x55, 0x7C, 0x0D, 0x5F, 0xB4, 0xC4, 0x92, 0x16, 0x66, 0xF2, 0x58,
-    0xF6, 0x09, 0x18, 0xB4, 0x7E, 0xB3, 0xC4, 0xF2, 0x47, 0x24, 0xD6, 0x9F, 0x2C, 0x31, 0xEF, 0x68,
-    0x5C, 0x27, 0x31, 0xE5, 0xEB, 0x7E, 0xBD, 0x3D, 0x89, 0x58, 0x59, 0x2B, 0x14, 0x5A, 0x06, 0x93,
-    0x72, 0x70, 0x71, 0x00, 0x57, 0x64, 0x1B, 0x6E, 0xC6, 0x7E, 0x36, 0x9F, 0x12, 0x18, 0xF6, 0x4F,
-    0xA0, 0x9B, 0xAB, 0x2C, 0x49, 0x00, 0xC8, 0xAC, 0x59, 0x18, 0x4D, 0x0C, 0xB4, 0x28, 0x3F, 0xC9,
-    0x1F, 0x82, 0xDD, 0xAE, 0x95, 0x12, 0xDC, 0xBA, 0x3F, 0xCF, 0xF3, 0xF5, 0xBE, 0xBB, 0xFB, 0x84,
-    0x03, 0xDC, 0x6D, 0x9E, 0xC1, 0x35, 0x6B, 0x32, 0xB1, 0xCF, 0x3D, 0x8A, 0x9D, 0x55, 0xA5, 0x8B,
-    0xA7, 0x88, 0x29, 0x37, 0x53, 0x73, 0x4A, 0x33, 0x3D, 0xFA, 0x61, 0x87, 0xCF, 0xED, 0xF3, 0x8D,
-    0x81, 0x57, 0x78, 0xC0, 0xFE, 0x12, 0x08, 0xDD, 0x50, 0x8F, 0xFF, 0xE4, 0x87, 0x4C, 0xC1, 0xDD,
-    0xCD, 0xE3, 0xBF, 0x3A, 0xF0, 0xFB, 0x47, 0xFF, 0xCE, 0x60, 0xFD, 0x47, 0x0D, 0x01, 0xFF, 0x82,
-    0x85, 0x23, 0xE5, 0x95, 0x73, 0xC7, 0xEB, 0xD6, 0x58, 0xFF, 0xD4, 0xC1, 0xFD, 0x79, 0x02, 0xB0,
-    0x0C, 0x4F, 0xE4, 0x95, 0x75, 0x34, 0x72, 0x4B, 0xCF, 0xBB, 0x26, 0xCF, 0xC7, 0xB6, 0x38, 0x63,
-    0x6C, 0xB7, 0x9C, 0xC1, 0xC1, 0x9D, 0x95, 0x9C, 0x7F, 0x27, 0x93, 0xFD, 0x3F, 0xD5, 0x5A, 0x3B,
-    0x8C, 0xDD, 0x56, 0x7A, 0xFE, 0x49, 0xCE, 0x0C, 0x37, 0x60, 0x36, 0x9C, 0x42, 0x93, 0x18, 0x12,
-    0x6C, 0x36, 0x5B, 0x18, 0xFB, 0x10, 0x53, 0xBA, 0x90, 0x86, 0x94, 0x54, 0x38, 0x80, 0x0B, 0x4D,
-    0x00, 0x5D, 0x17, 0xEB, 0x22, 0x5B, 0xA4, 0x48, 0x52, 0x64, 0xB6, 0xD8, 0x42, 0x85, 0x2C, 0x52,
-    0x52, 0x91, 0x62, 0x8B, 0x15, 0x90, 0xDD, 0x34, 0x29, 0x92, 0x42, 0x0B, 0x38, 0xA3, 0x42, 0x5B,
-    0xA8, 0x50, 0x80, 0x99, 0x21, 0xB5, 0x83, 0xC0, 0x85, 0x0A, 0x53, 0x30, 0x82, 0x2D, 0x4D, 0xCB,
-    0x5E, 0x18, 0xB0, 0x0B, 0xD1, 0x32, 0xB5, 0xE1, 0x48, 0xE4, 0x3D, 0xF9, 0xBE, 0xFF, 0xF0, 0xDE,
-    0x19, 0x8D, 0x46, 0x58, 0x3B, 0xB1, 0xD6, 0x5A, 0xCE, 0xDC, 0x43, 0xF2, 0xF0, 0xF0, 0x9C, 0xFF,
-    0xFD, 0x3A, 0x5C, 0xF4, 0xFA, 0x64, 0xA7, 0x3F, 0x9A, 0x0A, 0x8E, 0x30, 0xEF, 0xC2, 0xB2, 0xDF,
-    0xFB, 0xAF, 0x06, 0xFC, 0x47, 0x77, 0xFB, 0xF8, 0xD7, 0xB5, 0xE8, 0xD1, 0x1C, 0xFE, 0x3B, 0x66,
-    0x72, 0x31, 0xA6, 0xF5, 0x1F, 0x7D, 0xD2, 0x87, 0xB7, 0xEB, 0x3E, 0x3E, 0x55, 0xDF, 0x4A, 0x9C,
-    0xEA, 0x47, 0x17, 0x9D, 0x4A, 0xB6, 0xC6, 0xDF, 0xC0, 0xB3, 0x5B, 0xC9, 0xB6, 0x5B, 0x4A, 0x86,
-    0x5F, 0x72, 0x19, 0xBF, 0x7B, 0xE5, 0x4B, 0xA1, 0xF9, 0xAC, 0xF7, 0x8C, 0xE9, 0x64, 0x1D, 0x73,
-    0x78, 0xA5, 0x3C, 0xF3, 0xA7, 0xC7, 0xD2, 0xAE, 0x88, 0x63, 0x8C, 0x48, 0xF4, 0x68, 0x2A, 0x98,
-    0xB3, 0x17, 0xBF, 0x76, 0x1B, 0x49, 0x24, 0xC8, 0xA5, 0x97, 0x05, 0xDC, 0x61, 0x50, 0x9C, 0xA3,
-    0xD9, 0xC2, 0xCF, 0x6B, 0x9D, 0xD4, 0x37, 0x18, 0x1E, 0x71, 0x01, 0x0C, 0x10, 0xF1, 0x09, 0x71,
-    0x34, 0x1F, 0xC0, 0xBB, 0x90, 0x93, 0xBF, 0x8D, 0xDF, 0xF7, 0x1E, 0x6D, 0x6C, 0xDC, 0xC5, 0x70,
-    0x73, 0x66, 0x5A, 0x98, 0xDE, 0xCF, 0x65, 0x25, 0x3D, 0x82, 0xEE, 0xBC, 0x75, 0xD6, 0xC2, 0xCB,
-    0x0F, 0xCD, 0xD0, 0x63, 0x65, 0x93, 0x3B, 0x3D, 0x56, 0x0D, 0x4A, 0xAC, 0xBA, 0x2A, 0x5E, 0x25,
-    0x1D, 0x88, 0xE6, 0xD5, 0x72, 0x12, 0xD3, 0x38, 0xAD, 0xC4, 0x29, 0x66, 0x2B, 0x2E, 0x19, 0x09,
-    0x30, 0x34, 0xED, 0xE3, 0x2E, 0xBE, 0x82, 0xD9, 0x5F, 0x56, 0xD8, 0x57, 0x26, 0xA9, 0x33, 0x79,
-    0x1D, 0x80, 0x64, 0x43, 0x3C, 0x88, 0x53, 0xA4, 0x49, 0x2E, 0x41, 0xE5, 0x0E, 0xC2, 0x39, 0x1A,
-    0x89, 0x45, 0xB2, 0x14, 0x33, 0xB9, 0x3D, 0x01, 0x0D, 0xAB, 0x08, 0x1C, 0xC9, 0x08, 0xA0, 0x69,
-    0xB3, 0x0E, 0xF3, 0xBD, 0x67, 0xD0, 0x51, 0x10, 0x60, 0x0F, 0xA8, 0x4B, 0x66, 0x4C, 0x23, 0x20,
-    0x1C, 0xAF, 0x23, 0x62, 0xE0, 0x10, 0xBD, 0xFD, 0x97, 0x71, 0x85, 0xA6, 0xC0, 0x28, 0x09, 0x49,
-    0x31, 0xCF, 0x8C, 0xC7, 0x39, 0xD2, 0x31, 0x1B, 0x6F, 0x6A, 0x59, 0xBA, 0x06, 0x8A, 0xF6, 0x12,
-    0x5F, 0xEF, 0xDD, 0xD6, 0x6B, 0xC2, 0xDC, 0xCF, 0xB7, 0x65, 0xC1, 0xC3, 0x0C, 0x11, 0x7E, 0xFF,
-    0x39, 0x15, 0xF7, 0x9E, 0x49, 0x83, 0xDB, 0xA6, 0x8C, 0x24, 0x2B, 0x13, 0x89, 0xCB, 0x0C, 0xE4,
-    0x2B, 0xF2, 0x58, 0x8A, 0xEA, 0x84, 0x64, 0x35, 0x50, 0xFE, 0xA2, 0x92, 0xF0, 0xBE, 0x48, 0xD0,
-    0xBF, 0x24, 0x61, 0xDD, 0x49, 0xE2, 0x37, 0x4E, 0x17, 0xB6, 0x51, 0x1E, 0x01, 0xD5, 0x00, 0xE0,
-    0x2D, 0xCA, 0x91, 0x2C, 0x1D, 0x8A, 0x4B, 0x53, 0xB4, 0x0B, 0xB2, 0x3C, 0x72, 0x12, 0x3C, 0xF9,
-    0x98, 0xF0, 0x7D, 0x5A, 0x00, 0x4C, 0x8C, 0xDA, 0x56, 0xFE, 0x00, 0x7F, 0x30, 0x0A, 0x94, 0xBD,
-    0x20, 0x59, 0xEB, 0x95, 0x27, 0x05, 0xF8, 0xDD, 0x8A, 0xA4, 0xF3, 0xF2, 0x30, 0x48, 0x2F, 0x48,
-    0xED, 0xBE, 0x5F, 0x1E, 0xC7, 0x14, 0xE7, 0x9B, 0x10, 0xC4, 0x78, 0xE5, 0x04, 0xE8, 0x2F, 0xFE,
-    0x7B, 0xD2, 0x02, 0xE5, 0x8F, 0xCA, 0x55, 0xBC, 0x78, 0xFE, 0x66, 0x00, 0x02, 0xFC, 0xE0, 0x15,
-    0x67, 0x90, 0x34, 0xF4, 0xCA, 0xD8, 0x34, 0x7E, 0x79, 0xCB, 0x31, 0xAD, 0x57, 0xF1, 0x05, 0xF0,
-    0xAC, 0xD5, 0x16, 0x02, 0x40, 0x41, 0x30, 0xBF, 0x58, 0x87, 0xBC, 0x40, 0x42, 0x28, 0x0F, 0x8B,
-    0xBF, 0xB4, 0x70, 0xC5, 0x9D, 0xF7, 0xBB, 0x36, 0xF2, 0xEA, 0x57, 0xC3, 0xDC, 0xB9, 0xE8, 0x98,
-    0x2E, 0xFA, 0xE7, 0xBA, 0x0F, 0xAF, 0x34, 0x09, 0x86, 0xBD, 0xDB, 0xDE, 0xD2, 0x21, 0x6F, 0x18,
-    0x93, 0x98, 0x16, 0xE2, 0xB6, 0x00, 0xE6, 0x07, 0x65, 0x88, 0xBF, 0xA8, 0x04, 0xC7, 0xAA, 0xA8,
-    0x8E, 0xEB, 0xA8, 0x0E, 0x9B, 0xA0, 0x71, 0x7B, 0x80, 0x10, 0x97, 0x51, 0xA5, 0xE2, 0x12, 0xE5,
-    0x10, 0x8B, 0x4E, 0x36, 0x41, 0x8B, 0x45, 0xB0, 0xC4, 0x3C, 0x00, 0xE5, 0x6F, 0x4F, 0x26, 0xEB,
-    0x98, 0xEB, 0x02, 0x60, 0x07, 0x28, 0x3E, 0xC0, 0x8E, 0x44, 0xF9, 0x7A, 0x0F, 0x0B, 0x91, 0xAD,
-    0xCE, 0x44, 0xF9, 0x97, 0x4B, 0x78, 0x35, 0xA8, 0x00, 0xB8, 0x57, 0x06, 0x4B, 0xEF, 0x78, 0xE5,
-    0xF9, 0x78, 0xCB, 0x3F, 0x5D, 0xBE, 0x76, 0x3E, 0x0C, 0xE5, 0xC3, 0xFA, 0xFB, 0x27, 0xBC, 0xFB,
-    0xF2, 0x2B, 0xAC, 0xE8, 0xEE, 0x94, 0xAF, 0x35, 0x41, 0x20, 0x1F, 0x36, 0x27, 0x5E, 0x0E, 0x3F,
-    0xFC, 0xBC, 0x3E, 0xB1, 0x72, 0xEA, 0xAC, 0x9C, 0x10, 0xB9, 0x09, 0xC9, 0x86, 0x24, 0xC5, 0x00,
-    0x57, 0x96, 0xDE, 0x11, 0x39, 0xBA, 0x71, 0x2D, 0x31, 0x43, 0x62, 0x28, 0x21, 0xCE, 0x76, 0x1A,
-    0x9A, 0x3A, 0x79, 0xBD, 0xBD, 0x20, 0xFD, 0xA6, 0x5C, 0xD0, 0xFF, 0xCD, 0x8B, 0xD2, 0x25, 0x9F,
-    0x35, 0x81, 0x29, 0xE5, 0x6F, 0x2D, 0x3D, 0x48, 0xD6, 0x4E, 0x39, 0x03, 0x64, 0x79, 0xEB, 0x4C,
-    0x76, 0x27, 0xB1, 0x31, 0x7D, 0x41, 0x09, 0x7C, 0xEA, 0xA9, 0x90, 0xC4, 0xE3, 0x31, 0x99, 0x4C,
-    0x40, 0x2A, 0xC3, 0xC1, 0xB8, 0x73, 0x4D, 0x1E, 0x9B, 0x3A, 0xF3, 0x9B, 0x4D, 0xB7, 0xBD, 0xE0,
-    0xB6, 0x54, 0x3E, 0xA8, 0x2B, 0x04, 0x36, 0x13, 0xD5, 0x63, 0xEA, 0x6D, 0xC1, 0x69, 0xFB, 0xEF,
-    0x6E, 0x5C, 0x23, 0x23, 0x06, 0xCF, 0x0C, 0xF1, 0xA9, 0xEE, 0x27, 0x18, 0x18, 0xA5, 0xA0, 0x63,
-    0x51, 0x02, 0xAC, 0x95, 0xF5, 0x92, 0xAA, 0xB2, 0x89, 0xD7, 0x9D, 0xE2, 0x0D, 0xD3, 0x46, 0x53,
-    0x5D, 0x0A, 0x04, 0x2E, 0xBC, 0x2E, 0xB9, 0xDC, 0x05, 0xE9, 0xB8, 0x38, 0x68, 0x16, 0xA7, 0x5E,
-    0x0B, 0x4D, 0x92, 0x01, 0x96, 0x00, 0x36, 0x02, 0x67, 0xB0, 0x21, 0x49, 0x31, 0x1F, 0x3A, 0xFB,
-    0xC3, 0x3B, 0x7D, 0x74, 0xA6, 0x50, 0xCA, 0xB0, 0x16, 0x93, 0x7B, 0x83, 0x64, 0x8D, 0x98, 0xBA,
-    0xC8, 0x16, 0x12, 0x63, 0x42, 0x13, 0xAD, 0x1B, 0xD7, 0xBC, 0x5E, 0x9F, 0x93, 0x15, 0xA7, 0x53,
-    0x66, 0xCD, 0x55, 0x4E, 0xED, 0x8A, 0xD5, 0xBB, 0x42, 0x95, 0x7D, 0xB4, 0x57, 0x90, 0x2D, 0xBC,
-    0x59, 0x65, 0x06, 0xEA, 0x6E, 0xEE, 0x80, 0x00, 0x0F, 0xEA, 0xD0, 0xF4, 0xB7, 0xA0, 0x8C, 0xC7,
-    0x61, 0x4D, 0xEE, 0xE4, 0xD9, 0xBE, 0x0E, 0xF0, 0xFE, 0x4E, 0x1E, 0xA0, 0x43, 0x8A, 0xFE, 0x96,
-    0x2C, 0x7D, 0x70, 0x1C, 0xD3, 0xDE, 0xC9, 0xC5, 0x41, 0x87, 0x5C, 0x80, 0xE4, 0x45, 0x87, 0x77,
-    0xA4, 0xE8, 0x28, 0x55, 0x90, 0x54, 0x82, 0x5C, 0x9E, 0x3F, 0x30, 0x53, 0xC0, 0xB6, 0xE0, 0xF7,
-    0x19, 0x04, 0xB7, 0xEE, 0x33, 0x97, 0x54, 0x59, 0x2A, 0x8F, 0x81, 0xA4, 0xE5, 0x22, 0xCD, 0x17,
-    0x08, 0x78, 0xA0, 0x81, 0xFC, 0x42, 0x2E, 0x49, 0x4D, 0xDF, 0xE4, 0xD1, 0xFD, 0x66, 0xD5, 0xED,
-    0x36, 0xA5, 0x87, 0x31, 0x82, 0xDC, 0xF6, 0xBC, 0xE8, 0x32, 0xB7, 0x89, 0x4D, 0xE5, 0x5B, 0x82,
-    0xCB, 0x32, 0x94, 0x2B, 0x31, 0xD5, 0x32, 0x95, 0x20, 0x05, 0xEF, 0x3B, 0x10, 0x0F, 0x5A, 0x50,
-    0xCE, 0x25, 0xDF, 0x6B, 0xBD, 0xCE, 0xEB, 0xDD, 0xC1, 0x1D, 0x1C, 0x1A, 0xEA, 0x41, 0x68, 0xD8,
-    0x38, 0xEA, 0x88, 0x1C, 0x19, 0x79, 0xF4, 0x2D, 0xFC, 0x5E, 0xB2, 0x70, 0x2F, 0x0D, 0x56, 0xD6,
-    0x12, 0xD2, 0x70, 0x13, 0x82, 0xDA, 0x8F, 0xA2, 0xB4, 0xA9, 0x1A, 0xAB, 0x67, 0xAA, 0x3B, 0xCF,
-    0x41, 0x6E, 0xCF, 0xA1, 0xD8, 0xF3, 0x71, 0x71, 0xAE, 0xF2, 0x7C, 0x81, 0x2C, 0xDC, 0xE4, 0x6B,
-    0x31, 0xCF, 0xD0, 0xAB, 0x8C, 0x67, 0x78, 0x8F, 0xC7, 0xD5, 0x31, 0x53, 0x07, 0xB9, 0xF7, 0x45,
-    0x95, 0x98, 0x26, 0x94, 0x60, 0x87, 0x33, 0x1D, 0x97, 0xE8, 0x4C, 0xA5, 0x2A, 0xB8, 0xAA, 0x33,
-    0x03, 0x36, 0xBF, 0x52, 0x75, 0x34, 0x6A, 0x30, 0x2B, 0xAA, 0xAA, 0x90, 0x3A, 0xBA, 0x32, 0x2D,
-    0x08, 0xCF, 0x89, 0xD8, 0x33, 0x09, 0xEE, 0xA4, 0x16, 0x81, 0x03, 0xC7, 0x91, 0x11, 0xAF, 0xD5,
-    0x11, 0xAF, 0xCD, 0x11, 0xAF, 0xD6, 0xE2, 0xF5, 0x2C, 0x7C, 0xA2, 0x11, 0x9F, 0xD5, 0xF1, 0x7C,
-    0x41, 0xD6, 0x73, 0xC5, 0xC7, 0x87, 0xFA, 0x12, 0x9F, 0xE8, 0x37, 0xBD, 0xE2, 0x93, 0x08, 0xCF,
-    0x41, 0xBE, 0x2A, 0x3D, 0xF0, 0x0A, 0x61, 0x54, 0x7A, 0xE0, 0x05, 0x69, 0x70, 0x5A, 0x6B, 0x52,
-    0xD4, 0xB1, 0xB5, 0xD6, 0xB7, 0xD1, 0xBC, 0x64, 0x16, 0x66, 0x15, 0x50, 0xE0, 0x13, 0xD0, 0x4D,
-    0x02, 0x9F, 0xF8, 0xBF, 0x27, 0x96, 0xE8, 0xC4, 0x13, 0xAF, 0xC5, 0x46, 0xBD, 0x91, 0x3D, 0xFE,
-    0xF2, 0x69, 0xBC, 0xBE, 0x45, 0xA3, 0x91, 0xAB, 0xB5, 0x72, 0x8D, 0x35, 0xD7, 0xEE, 0x2E, 0xD4,
-    0x96, 0x08, 0x9D, 0xE7, 0x9A, 0x58, 0x72, 0x81, 0x13, 0x6C, 0x72, 0x34, 0x06, 0x9C, 0xA4, 0xD8,
-    0xF5, 0x24, 0x35, 0xD6, 0xA5, 0x29, 0x23, 0xCD, 0xAE, 0x77, 0xC4, 0xF8, 0xEF, 0x48, 0x49, 0x4C,
-    0xB4, 0x4D, 0x88, 0x00, 0x5B, 0x96, 0x53, 0xA5, 0xE1, 0xCB, 0x6B, 0xEA, 0x20, 0xCE, 0xDD, 0x52,
-    0xD1, 0xC9, 0x2D, 0x89, 0x57, 0x5D, 0x60, 0x7F, 0x42, 0xA2, 0xB3, 0xF9, 0x4A, 0x8A, 0x89, 0xC2,
-    0x2B, 0xB5, 0x4A, 0x4C, 0x58, 0x76, 0x1A, 0xB1, 0x04, 0x15, 0x19, 0xE2, 0x97, 0xD0, 0xA0, 0x41,
-    0x91, 0xCC, 0x88, 0x8C, 0x92, 0xB8, 0x1B, 0x45, 0x68, 0xD5, 0x02, 0xA3, 0x16, 0x4A, 0xB9, 0xB6,
-    0x06, 0xA8, 0x0E, 0xA0, 0x06, 0x4E, 0xD2, 0xE9, 0xE1, 0xD5, 0xA4, 0x94, 0xA5, 0xAB, 0xF3, 0xFE,
-    0x54, 0xE9, 0x07, 0x4B, 0x0A, 0x2B, 0x5A, 0xD4, 0xAE, 0xE9, 0x3C, 0xD3, 0xBB, 0xE6, 0x2A, 0xC4,
-    0x99, 0xC8, 0x81, 0x86, 0x34, 0x7D, 0x94, 0xC5, 0x0A, 0x24, 0xF9, 0x57, 0x7A, 0x1C, 0x52, 0x26,
-    0xE8, 0xE6, 0x13, 0x58, 0x97, 0x91, 0x68, 0x04, 0x13, 0x58, 0xDD, 0x51, 0x2F, 0x2E, 0xCE, 0x74,
-    0xB6, 0xF0, 0xC1, 0xE3, 0x82, 0xB6, 0x59, 0xAE, 0x2F, 0xEA, 0xD8, 0x68, 0xD0, 0xD7, 0xEF, 0xB3,
-    0xCB, 0xFB, 0x84, 0x5D, 0x6E, 0xA3, 0x5D, 0x5D, 0xAC, 0xD1, 0x8B, 0x9A, 0x9F, 0x84, 0x7E, 0x14,
-    0x48, 0xB2, 0x0B, 0x24, 0x6D, 0x55, 0x0C, 0xE8, 0x48, 0xA6, 0x1B, 0x05, 0xBA, 0x20, 0xD4, 0xE8,
-    0xCA, 0x36, 0x36, 0xD0, 0x15, 0x83, 0xF7, 0x25, 0xA5, 0x03, 0xA3, 0x60, 0x28, 0x81, 0x36, 0xB9,
-    0x17, 0x95, 0x14, 0x10, 0xBF, 0xA3, 0xB8, 0xC5, 0xE6, 0x0B, 0xD0, 0x33, 0xB2, 0x8E, 0x42, 0xE1,
-    0xB1, 0x41, 0x98, 0xAF, 0x98, 0x85, 0xC3, 0x1E, 0x54, 0xE1, 0xC7, 0xCF, 0x40, 0xE3, 0x85, 0xC3,
-    0x43, 0x0F, 0x57, 0x11, 0x70, 0x8C, 0x06, 0x4A, 0xB6, 0xBB, 0xD7, 0x88, 0x11, 0xF1, 0x0F, 0xDA,
-    0xD7, 0xE4, 0xD5, 0x17, 0x1D, 0x8F, 0xC1, 0x23, 0xAD, 0xCD, 0xDD, 0x46, 0xC3, 0x05, 0x62, 0x10,
-    0x85, 0x5C, 0xC9, 0x45, 0xE4, 0x76, 0xF8, 0xE1, 0xEC, 0x17, 0x38, 0xC5, 0x1C, 0xE1, 0x95, 0x06,
-    0x3B, 0xFA, 0x46, 0xF8, 0x6F, 0xEC, 0x0A, 0x76, 0xD8, 0xE5, 0xD5, 0xF4, 0x5F, 0x4E, 0xAB, 0x5E,
-    0xAD, 0xF7, 0x6C, 0x34, 0xC6, 0xAE, 0x98, 0x22, 0x0E, 0x10, 0xD9, 0xE5, 0x3F, 0xDA, 0x18, 0x23,
-    0xCA, 0x8A, 0xD8, 0x40, 0xA1, 0x19, 0x4E, 0x17, 0x6A, 0x1B, 0x43, 0xFA, 0x5D, 0xEA, 0x12, 0x6D,
-    0x4F, 0xA6, 0x8E, 0x31, 0xAA, 0x23, 0x43, 0x63, 0xFA, 0x1E, 0xF0, 0xC8, 0x4C, 0x33, 0x03, 0xAA,
-    0x53, 0x2B, 0x65, 0x4E, 0x13, 0xAC, 0xA4, 0x2A, 0x80, 0x94, 0x5F, 0x87, 0xF9, 0x1F, 0x07, 0x06,
-    0x56, 0xDC, 0xAD, 0x3E, 0x07, 0x9F, 0x55, 0xAA, 0x1E, 0x9B, 0x0A, 0xA7, 0x1A, 0xF1, 0x93, 0x74,
-    0x1A, 0x12, 0xEA, 0x03, 0xC4, 0x0F, 0x6C, 0x17, 0xF7, 0x2B, 0x48, 0x64, 0x5B, 0x7D, 0x10, 0xAA,
-    0x0C, 0xFA, 0x0C, 0xEF, 0xC5, 0x7D, 0xAC, 0x5D, 0xBB, 0xDA, 0xB5, 0x99, 0xB0, 0x6B, 0x35, 0xD0,
-    0x94, 0xE5, 0x94, 0x1A, 0xB0, 0x12, 0x39, 0x03, 0x10, 0x64, 0x17, 0x2C, 0xDC, 0xA0, 0x76, 0x8D,
-    0x5D, 0xD9, 0xC6, 0x8D, 0x46, 0xCD, 0x38, 0xBA, 0xA2, 0x4F, 0x37, 0x0A, 0x66, 0x16, 0x82, 0x51,
-    0xA4, 0xF0, 0x20, 0x14, 0x6C, 0x18, 0xA0, 0x5E, 0xC3, 0x94, 0x8C, 0x64, 0x74, 0x30, 0x30, 0x30,
-    0x3D, 0x72, 0x14, 0x9F, 0xD6, 0x52, 0x85, 0x11, 0x08, 0xDA, 0x24, 0x21, 0xA7, 0x62, 0x3C, 0xA2,
-    0x58, 0x42, 0xC2, 0x4B, 0xB5, 0xA2, 0x6F, 0x17, 0xE2, 0x02, 0x32, 0xEF, 0x01, 0x02, 0x24, 0x00,
-    0x15, 0x05, 0x96, 0x89, 0x56, 0xDA, 0x21, 0xDC, 0x85, 0x0D, 0x15, 0x5D, 0x85, 0xDB, 0x45, 0xF8,
-    0x48, 0x9C, 0xA3, 0x34, 0xD6, 0xC9, 0x7A, 0x29, 0x36, 0xDE, 0x21, 0xC9, 0xAF, 0xEB, 0xE3, 0xC4,
-    0xA8, 0x08, 0xB8, 0x8F, 0x54, 0x0B, 0x68, 0x94, 0xF1, 0xF6, 0x32, 0x46, 0xE1, 0x6D, 0xB7, 0x42,
-    0x1C, 0x88, 0xC9, 0xC3, 0x14, 0x7C, 0xC0, 0xE4, 0x6F, 0x53, 0x5B, 0xCD, 0x9B, 0xD7, 0x9B, 0xC2,
-    0xA4, 0x4C, 0x59, 0x76, 0xCC, 0xE0, 0x1A, 0x9B, 0xF4, 0xD8, 0xF0, 0x6A, 0x9A, 0x3A, 0xBC, 0x8D,
-    0x76, 0xDF, 0xEA, 0x21, 0x1C, 0xC8, 0x5F, 0x90, 0x8C, 0x94, 0x78, 0xBC, 0x4A, 0xAE, 0xDD, 0x54,
-    0xF0, 0xA6, 0x9A, 0x09, 0x92, 0x86, 0xD5, 0x18, 0xB2, 0xA9, 0x1B, 0xF4, 0xE7, 0x5D, 0x24, 0x20,
-    0x0D, 0xBF, 0xB8, 0xD3, 0x59, 0x76, 0x15, 0x80, 0x1B, 0x47, 0x02, 0xF3, 0xE8, 0x46, 0xCD, 0x44,
-    0x0E, 0x96, 0x9D, 0xF8, 0xAC, 0xAC, 0x31, 0xEC, 0xE1, 0xAB, 0xAA, 0x73, 0x4F, 0xA4, 0x93, 0x3A,
-    0xA5, 0xCE, 0xF6, 0x9D, 0x19, 0x8F, 0xDB, 0x99, 0xB5, 0x54, 0x06, 0x5B, 0x0D, 0x55, 0x02, 0x2C,
-    0xEF, 0x13, 0x6B, 0xD2, 0xFB, 0xA7, 0xC4, 0x68, 0xD1, 0x6C, 0x20, 0x03, 0x43, 0x50, 0x8A, 0xE4,
-    0x01, 0xEE, 0x11, 0x90, 0xBF, 0xAC, 0x42, 0xAB, 0xAF, 0x28, 0xB9, 0x15, 0x19, 0x44, 0x24, 0xA5,
-    0x4B, 0x8C, 0x83, 0x47, 0x08, 0x92, 0x6D, 0xD7, 0xFE, 0x51, 0x29, 0xBA, 0x82, 0xB4, 0xB0, 0xBC,
-    0x70, 0xDA, 0xE0, 0xE1, 0x3F, 0xDC, 0xF8, 0x8D, 0xB1, 0x31, 0xF8, 0xDC, 0x04, 0xFA, 0xB3, 0xB7,
-    0x88, 0x82, 0x4B, 0x0E, 0xA9, 0x20, 0x2E, 0xCB, 0x37, 0x0B, 0x97, 0xF2, 0x28, 0x66, 0x82, 0x46,
-    0xBB, 0x18, 0x5F, 0x69, 0x61, 0xAA, 0x3D, 0xAE, 0xE9, 0xE6, 0xDF, 0x24, 0x5C, 0x6E, 0xCB, 0x2C,
-    0xA5, 0x81, 0xFE, 0x64, 0x25, 0x84, 0x64, 0xCB, 0x69, 0x0F, 0x98, 0x26, 0xCA, 0xE5, 0x3D, 0xBE,
-    0x73, 0x29, 0xFB, 0x14, 0x46, 0xA5, 0xA0, 0x27, 0x81, 0x24, 0x53, 0x49, 0xFD, 0xF4, 0xE9, 0x15,
-    0x61, 0xC9, 0x21, 0xFF, 0x80, 0x2B, 0x77, 0xA7, 0x1B, 0xFF, 0xB1, 0x1F, 0xD4, 0x71, 0xD4, 0x32,
-    0xBA, 0xDC, 0x8A, 0xEE, 0x20, 0x47, 0xD7, 0xDB, 0xEE, 0xF0, 0xC3, 0xEB, 0x0F, 0x39, 0xFD, 0x1D,
-    0x36, 0xE4, 0x12, 0xF0, 0x6D, 0xC9, 0x3B, 0x38, 0x21, 0xC6, 0x56, 0x6B, 0x33, 0xCA, 0xDC, 0x21,
-    0x55, 0x52, 0x4C, 0x81, 0x09, 0xF0, 0x7A, 0x21, 0x5F, 0xEA, 0x12, 0xC1, 0x25, 0xB0, 0x55, 0x5C,
-    0x11, 0x95, 0x19, 0x4C, 0xEC, 0x21, 0x51, 0xAB, 0x66, 0xE2, 0xF0, 0x75, 0xCC, 0x0B, 0x5D, 0x36,
-    0x95, 0xF7, 0xB8, 0x0D, 0xEF, 0xC2, 0xD3, 0x5E, 0xFC, 0x81, 0x7C, 0x7B, 0x56, 0x01, 0xE8, 0x63,
-    0xD3, 0x61, 0x6A, 0xA2, 0xFE, 0x95, 0xFF, 0x53, 0x7D, 0x9D, 0xF3, 0x27, 0xE9, 0x56, 0x76, 0xC9,
-    0xE0, 0x3F, 0xD6, 0xA2, 0xCE, 0xD7, 0x3A, 0xF9, 0x82, 0xB0, 0xBA, 0x05, 0x33, 0x43, 0xB6, 0x41,
-    0x2E, 0x17, 0xCD, 0xE2, 0x8D, 0x29, 0xC7, 0x50, 0x6F, 0xE8, 0x2E, 0x2A, 0xB6, 0x61, 0xC3, 0x16,
-    0x5C, 0x41, 0x0B, 0xEF, 0xC2, 0xB6, 0x67, 0xEB, 0xF6, 0x2B, 0x66, 0x02, 0xCA, 0x31, 0x05, 0x74,
-    0xFB, 0xEF, 0x9A, 0x8D, 0xDC, 0x1D, 0xFB, 0xF7, 0x8D, 0xD4, 0xB7, 0x02, 0x9D, 0x01, 0x49, 0x67,
-    0xA1, 0xA6, 0xBA, 0x00, 0xDD, 0xB1, 0xCA, 0x64, 0xBD, 0x67, 0xED, 0x0A, 0x96, 0x19, 0xAB, 0xEF,
-    0xEE, 0x89, 0xDC, 0x96, 0xAA, 0x44, 0xD2, 0x9D, 0x10, 0x35, 0xD9, 0x94, 0x9E, 0x13, 0xB1, 0xE6,
-    0xD8, 0xF9, 0xC5, 0xC3, 0xFD, 0x67, 0xC6, 0xD8, 0xD6, 0xBC, 0x0B, 0x33, 0x16, 0x9A, 0x8E, 0xBE,
-    0xE6, 0x2F, 0x10, 0x52, 0xF4, 0xF4, 0x89, 0x2E, 0xFA, 0xE0, 0x4B, 0x62, 0xF8, 0x5F, 0xDC, 0xC0,
-    0xC0, 0xF3, 0x46, 0xEB, 0x51, 0x6E, 0x93, 0xA5, 0xBC, 0x01, 0xB4, 0xBC, 0x09, 0x1B, 0xDE, 0x20,
-    0x0C, 0xE2, 0x0D, 0xD2, 0x3A, 0xDE, 0x84, 0x0D, 0x6F, 0x24, 0xB9, 0xCC, 0x1B, 0x67, 0xD0, 0x9B,
-    0xF0, 0x81, 0x16, 0xB3, 0x92, 0x1B, 0xBC, 0x71, 0x8C, 0xDE, 0x04, 0xC6, 0x3A, 0xA1, 0xC6, 0x87,
-    0xE3, 0x01, 0x6A, 0x85, 0xA9, 0x64, 0xF4, 0x21, 0x73, 0xB3, 0xE3, 0xAA, 0xEB, 0xF3, 0xAC, 0x0B,
-    0xD1, 0x92, 0xCC, 0x18, 0x28, 0xDB, 0x90, 0x73, 0x9E, 0x34, 0xD2, 0x97, 0xAE, 0xE9, 0x18, 0x84,
-    0xE1, 0x24, 0x0F, 0xDE, 0x28, 0x3E, 0x3E, 0x66, 0xD4, 0x7C, 0x9B, 0x92, 0xA3, 0x93, 0x3A, 0x64,
-    0xD9, 0xAB, 0xA1, 0x41, 0x0E, 0x5A, 0xC6, 0xDE, 0x7E, 0xA7, 0x9E, 0xB3, 0xA7, 0x4B, 0xF5, 0xFA,
-    0x8C, 0xC5, 0xA0, 0xA7, 0x5A, 0xF4, 0x73, 0x4C, 0xC7, 0xF1, 0x5E, 0x9B, 0xF0, 0xDD, 0x26, 0xE2,
-    0x3C, 0x75, 0x48, 0x83, 0x54, 0xFA, 0x03, 0x25, 0xC3, 0xB5, 0x29, 0x70, 0xA6, 0xD1, 0x5B, 0x60,
-    0x6B, 0x47, 0x3F, 0xB4, 0xF9, 0x82, 0x8D, 0x93, 0xC3, 0x74, 0x1E, 0x2D, 0xBA, 0xEA, 0xD4, 0x6D,
-    0xB0, 0x98, 0x5C, 0x3D, 0x80, 0xC4, 0x8B, 0x8A, 0x85, 0xAD, 0x9E, 0x28, 0x33, 0xA2, 0xD1, 0x61,
-    0xDB, 0x20, 0x99, 0x13, 0x36, 0x8C, 0x4E, 0xBD, 0xD2, 0xC9, 0x5F, 0x70, 0x2C, 0x34, 0x46, 0xF6,
-    0xCC, 0x3F, 0x95, 0x5A, 0xDF, 0x63, 0xBB, 0xC3, 0xA7, 0x87, 0x84, 0xC8, 0x2F, 0x30, 0x17, 0xFC,
-    0x86, 0x11, 0x68, 0xD8, 0xC6, 0xB5, 0xB6, 0xD5, 0xA1, 0x01, 0xF2, 0x8B, 0x08, 0xFF, 0x82, 0x6A,
-    0xF3, 0x09, 0x96, 0x3D, 0xB7, 0xBD, 0xC6, 0xED, 0x7A, 0x1A, 0x00, 0xBA, 0x06, 0x06, 0x57, 0xD3,
-    0x56, 0x92, 0xA0, 0x0A, 0xAB, 0xF8, 0x4C, 0x2B, 0x5B, 0xDF, 0x96, 0xD1, 0xBB, 0x3B, 0xE7, 0x34,
-    0x9A, 0x37, 0xDC, 0x27, 0xC0, 0x7C, 0x9F, 0xB7, 0x8A, 0x07, 0xDA, 0x5C, 0x92, 0x56, 0x8B, 0x03,
-    0x53, 0x1A, 0x46, 0xD7, 0x94, 0x11, 0x33, 0xED, 0x16, 0x48, 0xB9, 0x0F, 0xA7, 0x30, 0xA1, 0x2E,
-    0x70, 0x62, 0x88, 0x1B, 0xD2, 0x5A, 0xB5, 0x5E, 0x1F, 0x55, 0xB0, 0x34, 0x85, 0xDF, 0xA2, 0x8D,
-    0x6F, 0x4F, 0xD1, 0xE2, 0xC1, 0xE5, 0x16, 0xA8, 0x84, 0x0F, 0x5A, 0xCA, 0x05, 0x96, 0x87, 0x79,
-    0x65, 0xF2, 0x90, 0xE4, 0x61, 0x47, 0xA8, 0xA8, 0xA5, 0x71, 0xE5, 0xC2, 0x32, 0x65, 0xB5, 0xFB,
-    0x50, 0xCD, 0x6D, 0xAB, 0xC8, 0x2C, 0xC8, 0x9F, 0x5F, 0xDB, 0x67, 0xA3, 0x5E, 0xB1, 0x9A, 0xD1,
-    0xEE, 0x33, 0x50, 0x56, 0x41, 0x64, 0xDD, 0xEE, 0x4F, 0xAC, 0x3D, 0xC9, 0x99, 0x90, 0x65, 0x75,
-    0xF3, 0x3F, 0x08, 0x3E, 0x60, 0x73, 0x8F, 0xE1, 0xB5, 0xF5, 0x8A, 0x61, 0xA2, 0xA7, 0x31, 0xB8,
-    0x56, 0xCB, 0xB4, 0x04, 0x42, 0xAA, 0x96, 0xFF, 0xE7, 0x07, 0x60, 0x22, 0xAE, 0xE0, 0x38, 0x64,
-    0x5B, 0x6D, 0x27, 0xEE, 0xB3, 0x92, 0x94, 0x0A, 0xA7, 0x93, 0x31, 0xCB, 0xAC, 0xE6, 0xBC, 0x59,
-    0x3C, 0x37, 0xAF, 0x6A, 0xF0, 0xB8, 0xB9, 0x97, 0x53, 0x59, 0x7C, 0x3C, 0xB5, 0x57, 0xDE, 0xEE,
-    0x61, 0xD8, 0xBC, 0xC8, 0xE8, 0xC8, 0xBC, 0x18, 0x3B, 0xE6, 0xE7, 0xD6, 0x64, 0x25, 0x6F, 0x68,
-    0x1A, 0x9E, 0xD2, 0x27, 0x06, 0x9A, 0xB8, 0xFC, 0xF1, 0xA0, 0x93, 0x68, 0x76, 0x17, 0xD7, 0x54,
-    0xC3, 0xA0, 0xD5, 0x00, 0xBD, 0x73, 0x9B, 0xC3, 0x5C, 0x7B, 0xA2, 0xE1, 0xE4, 0x07, 0xA6, 0xC3,
-    0x55, 0xBD, 0x5E, 0x71, 0x67, 0xE9, 0xFF, 0x09, 0xF5, 0xD3, 0x0F, 0x08, 0x0C, 0xAE, 0x60, 0x37,
-    0x5C, 0xDD, 0xAC, 0x12, 0xF5, 0xE2, 0x5A, 0x2D, 0xDB, 0x7D, 0x73, 0x4C, 0xA4, 0x53, 0xAA, 0xAF,
-    0x0A, 0xD3, 0x8A, 0x15, 0x9D, 0x85, 0x3D, 0x21, 0x8B, 0x9A, 0xB9, 0x8C, 0x25, 0xDD, 0x5C, 0xC4,
-    0x16, 0x9F, 0x44, 0x04, 0x46, 0xAC, 0x4C, 0x18, 0x6D, 0x82, 0x2C, 0x4B, 0xAA, 0x93, 0xCE, 0x40,
-    0x40, 0x3C, 0xDD, 0x1D, 0xF0, 0xB5, 0x5A, 0x1F, 0x34, 0x8C, 0xBF, 0x61, 0x85, 0x4A, 0x6A, 0x2E,
-    0x77, 0xED, 0x92, 0x2B, 0x5A, 0x07, 0x89, 0x39, 0xC3, 0x76, 0x37, 0x2F, 0x0F, 0xB8, 0x83, 0xCC,
-    0xF2, 0x33, 0x5B, 0xA1, 0xB7, 0xF2, 0x61, 0x4B, 0xF4, 0x4F, 0x74, 0xAF, 0xCD, 0xCA, 0x28, 0x1E,
-    0x03, 0xF3, 0x0C, 0xE1, 0x90, 0xCF, 0x58, 0x6B, 0xA9, 0x1B, 0xB7, 0x12, 0xDD, 0xE1, 0x97, 0x1A,
-    0xB4, 0xE7, 0xAE, 0x41, 0x16, 0x1A, 0xE7, 0x7E, 0x0F, 0x1A, 0x44, 0x35, 0x77, 0x2B, 0x70, 0xE1,
-    0x37, 0xB8, 0xC8, 0x70, 0x11, 0xF0, 0x62, 0x8A, 0x8B, 0xB8, 0x8C, 0xF3, 0xA0, 0x75, 0xA7, 0x37,
-    0x06, 0xA5, 0x87, 0x3B, 0x9C, 0x1B, 0xE7, 0xE9, 0x88, 0xE2, 0x74, 0xDC, 0x93, 0x13, 0x39, 0x7A,
-    0x4D, 0x17, 0x06, 0xFF, 0x8B, 0xFB, 0x03, 0xC1, 0x83, 0x58, 0x28, 0xBD, 0x23, 0xEE, 0x65, 0x22,
-    0x91, 0x4D, 0xC8, 0x8B, 0xA8, 0xB4, 0xAC, 0x48, 0xD8, 0x1D, 0x96, 0x21, 0xAB, 0xA4, 0x44, 0xBE,
-    0x67, 0x6A, 0xAF, 0x42, 0x12, 0x96, 0x49, 0x8D, 0x4E, 0x1A, 0xE2, 0x9E, 0xDB, 0x15, 0x78, 0xCD,
-    0xE8, 0x9E, 0x46, 0x8D, 0x21, 0x9E, 0xEE, 0x26, 0x26, 0x92, 0x2C, 0xF2, 0xE5, 0x9D, 0x12, 0xE3,
-    0x9A, 0xDE, 0x6D, 0xA3, 0x3E, 0x79, 0xDC, 0x85, 0xC6, 0xA3, 0xDD, 0x96, 0x95, 0x51, 0x31, 0xFE,
-    0x74, 0xB6, 0x23, 0x4A, 0xF7, 0xA0, 0xB9, 0xB0, 0xDA, 0x3A, 0x25, 0xD3, 0xF7, 0x0F, 0xBA, 0x9C,
-    0x40, 0xE9, 0x64, 0x4A, 0x67, 0x70, 0x59, 0x82, 0x08, 0x69, 0x75, 0xB7, 0xC1, 0x51, 0x0D, 0x1C,
-    0xE0, 0x64, 0x9D, 0xBF, 0xA9, 0x11, 0x38, 0x53, 0xB9, 0xEE, 0xD7, 0xDE, 0x80, 0x9E, 0x04, 0x8F,
-    0x80, 0xDC, 0x36, 0x10, 0x0D, 0xD1, 0xE3, 0x9B, 0x9F, 0x53, 0xFB, 0xCA, 0x62, 0x80, 0x6C, 0x9C,
-    0x53, 0x0B, 0xFB, 0xAA, 0xD8, 0x8D, 0x24, 0xCD, 0xC5, 0x35, 0xDA, 0xE0, 0xF2, 0xE4, 0x63, 0xF8,
-    0x84, 0x9C, 0xE8, 0xBE, 0xD8, 0xD4, 0x32, 0x2D, 0x42, 0xA2, 0x04, 0x27, 0x00, 0x52, 0xA7, 0x58,
-    0x79, 0x8D, 0x2B, 0x2B, 0x08, 0x2B, 0x53, 0xE8, 0x01, 0x40, 0x34, 0x53, 0xB8, 0x8D, 0x2A, 0x20,
-    0x29, 0xB8, 0xB2, 0x82, 0xC0, 0x9E, 0x6C, 0xF7, 0xB4, 0x31, 0x59, 0x1F, 0x98, 0xBB, 0x46, 0x16,
-    0x53, 0x67, 0x34, 0x89, 0x5C, 0x0B, 0xDE, 0x06, 0x88, 0x91, 0xC2, 0x98, 0x2B, 0x06, 0x56, 0x7E,
-    0x05, 0xA2, 0x7F, 0x67, 0x1E, 0xA7, 0x3E, 0x97, 0xD5, 0x97, 0xB5, 0x04, 0xF6, 0x13, 0x50, 0xF5,
-    0x6C, 0x2E, 0x43, 0x01, 0x69, 0x3A, 0x0D, 0x22, 0x2C, 0x2F, 0xE5, 0xCF, 0x9B, 0xEA, 0x4E, 0x0A,
-    0x25, 0x34, 0xAC, 0x75, 0x31, 0xC3, 0xA5, 0x3F, 0xD5, 0x9E, 0xE7, 0x4D, 0x6C, 0xD5, 0x76, 0x72,
-    0x9A, 0xFB, 0xCC, 0x3E, 0x1C, 0x7A, 0xBD, 0x2A, 0x72, 0x1C, 0xCC, 0x77, 0x5A, 0x56, 0xD5, 0x69,
-    0x28, 0x92, 0xFA, 0xB9, 0x4A, 0x1B, 0x66, 0x5D, 0xA1, 0x5A, 0x9F, 0x02, 0x08, 0x99, 0xF9, 0x1C,
-    0x73, 0x67, 0x69, 0xD1, 0x31, 0x34, 0x0A, 0xD1, 0xA1, 0xFB, 0xF2, 0x61, 0xB5, 0x86, 0x48, 0x81,
-    0x42, 0x18, 0xFF, 0xD7, 0x75, 0xE4, 0xDA, 0x05, 0x8D, 0x1C, 0x62, 0x93, 0x4F, 0xCF, 0x89, 0xF9,
-    0xED, 0xB6, 0xCA, 0x29, 0xF5, 0xDA, 0xDA, 0xC8, 0x68, 0x66, 0x23, 0x33, 0x96, 0x6F, 0x4F, 0x19,
-    0x33, 0xD9, 0x44, 0x30, 0x83, 0xD1, 0xBA, 0x65, 0x30, 0xE5, 0x7A, 0xB4, 0xEF, 0x0C, 0x73, 0x40,
-    0x4E, 0x44, 0x6A, 0xCE, 0xE0, 0xF7, 0x61, 0xE9, 0xB5, 0x5B, 0x12, 0xEC, 0x34, 0x72, 0x84, 0x5A,
-    0xB6, 0x6D, 0x8D, 0x04, 0x13, 0x23, 0x8A, 0x3F, 0xE3, 0x30, 0x63, 0x0B, 0x52, 0xBE, 0xF9, 0xC5,
-    0x3F, 0x02, 0xFF, 0xD6, 0xA5, 0x99, 0x9D, 0xA4, 0xEA, 0x9C, 0x35, 0x78, 0x69, 0x75, 0xA3, 0x93,
-    0x96, 0x51, 0xF3, 0x2B, 0x3C, 0xF9, 0xD1, 0x98, 0xB7, 0x97, 0xB6, 0x30, 0x55, 0xD8, 0x49, 0xF4,
-    0x57, 0xCC, 0x6B, 0xD9, 0x32, 0xEE, 0x51, 0x46, 0xC8, 0xCB, 0xE1, 0x82, 0x92, 0x3C, 0xB9, 0x0D,
-    0xF7, 0x71, 0xB6, 0x94, 0xED, 0x44, 0x9C, 0xDD, 0x61, 0xF2, 0xD6, 0x67, 0xC0, 0xF5, 0x86, 0x31,
-    0xC3, 0x08, 0x92, 0x7A, 0x81, 0x4A, 0xD3, 0x5D, 0xC9, 0x76, 0xDF, 0xAC, 0xB8, 0x31, 0x96, 0x31,
-    0x1D, 0xA6, 0xCB, 0xFA, 0x13, 0xFB, 0x35, 0x85, 0x67, 0xAB, 0x8C, 0x2C, 0x61, 0xD0, 0x40, 0xBD,
-    0xB6, 0x4F, 0x72, 0x53, 0x61, 0x09, 0x1B, 0xF0, 0xC3, 0x70, 0x37, 0x17, 0x25, 0x7C, 0x1F, 0x49,
-    0xE1, 0xCF, 0x4A, 0xB9, 0x98, 0x4D, 0xDE, 0x7C, 0x84, 0x85, 0xB8, 0xD8, 0x7A, 0x6E, 0x19, 0xD9,
-    0xDB, 0x89, 0x18, 0x65, 0x46, 0xD3, 0xC9, 0x4D, 0xD8, 0xDD, 0x32, 0x62, 0xCE, 0x38, 0xB1, 0x2A,
-    0x4A, 0x32, 0x41, 0x39, 0x29, 0x21, 0x17, 0xB9, 0x69, 0x0B, 0xCB, 0x26, 0x27, 0x81, 0xF3, 0xDA,
-    0xD7, 0xB9, 0xD0, 0x9A, 0x93, 0x86, 0xA0, 0x49, 0x76, 0x69, 0xEA, 0x0C, 0x18, 0x33, 0x93, 0x58,
-    0x1E, 0xE7, 0xA8, 0x09, 0x69, 0x08, 0x36, 0xC0, 0x4B, 0xC1, 0x2B, 0x0D, 0x89, 0x30, 0xBC, 0xF5,
-    0x3F, 0x79, 0x38, 0x59, 0x07, 0xBD, 0xA6, 0x20, 0xCC, 0xEF, 0x3A, 0xAB, 0x15, 0xEA, 0x3F, 0x49,
-    0x7D, 0xC4, 0x00, 0xE6, 0xB7, 0x6F, 0x41, 0x05, 0xF8, 0x01, 0x49, 0x35, 0x7A, 0xC7, 0x1F, 0xAB,
-    0x71, 0xAF, 0xB9, 0x53, 0x89, 0x7F, 0x8C, 0xDD, 0xB3, 0x71, 0xF0, 0x7D, 0xC9, 0x20, 0xEB, 0xBA,
-    0x75, 0x8D, 0x09, 0x74, 0xF7, 0xFA, 0xD0, 0x4B, 0x87, 0x7B, 0xD2, 0x48, 0xD8, 0x53, 0x72, 0x7A,
-    0x4A, 0xB9, 0xC9, 0x38, 0xEB, 0xDE, 0x4C, 0x4E, 0x51, 0x85, 0x26, 0x3D, 0xF6, 0xEC, 0x19, 0xE6,
-    0x97, 0x99, 0xD9, 0x61, 0x21, 0x78, 0x41, 0xDD, 0x6C, 0xE3, 0x9A, 0x26, 0xBC, 0x53, 0xF7, 0xC1,
-    0x9D, 0x2A, 0xFC, 0xAB, 0xD1, 0x8D, 0x7F, 0xD5, 0xA9, 0x16, 0xE5, 0x48, 0x92, 0x9B, 0xAC, 0x34,
-    0x49, 0x3E, 0x5D, 0xDC, 0x97, 0xF6, 0x2E, 0x91, 0x7A, 0x29, 0xDD, 0x7B, 0xF2, 0xFB, 0xFF, 0x7D,
-    0xD3, 0x87, 0x63, 0x19, 0xCE, 0x2B, 0x8F, 0x83, 0xF4, 0x3F, 0xAB, 0x6C, 0x39, 0x9D, 0xB1, 0x14,
-    0x4B, 0x0B, 0xB2, 0x05, 0x0D, 0xF4, 0xD5, 0x10, 0xCD, 0xBE, 0xE5, 0x89, 0x87, 0x2D, 0x88, 0xF5,
-    0xE3, 0xC6, 0xDF, 0x7D, 0xCB, 0x70, 0x73, 0xBF, 0xC5, 0x08, 0xC6, 0x08, 0xC8, 0x6B, 0xC0, 0x93,
-    0x3B, 0x18, 0xD5, 0xB3, 0xD2, 0x32, 0xBF, 0x78, 0xB7, 0x15, 0x87, 0x09, 0x51, 0x02, 0xBB, 0x81,
-    0x84, 0xAB, 0x73, 0x69, 0x0F, 0x00, 0x9E, 0xC6, 0x64, 0x7F, 0x9F, 0xCE, 0x02, 0xE1, 0xA4, 0xFC,
-    0x15, 0xCD, 0xD0, 0x59, 0x74, 0x0C, 0xF4, 0x9A, 0xA1, 0x47, 0x8D, 0x5A, 0x5E, 0x3A, 0xB0, 0xED,
-    0xA5, 0xFA, 0x7D, 0x99, 0xB1, 0x58, 0x6F, 0x4C, 0xED, 0x16, 0xE6, 0x5F, 0x18, 0x26, 0xE5, 0xBE,
-    0x25, 0x4F, 0x4E, 0x4A, 0x75, 0xBA, 0xC1, 0xC0, 0x4B, 0xF7, 0xCB, 0x5E, 0x46, 0xA6, 0x8E, 0xCC,
-    0xFB, 0x66, 0xEA, 0x99, 0xC1, 0x12, 0x63, 0xF6, 0x01, 0x53, 0xA8, 0xB1, 0x4F, 0x39, 0x46, 0xF1,
-    0xEA, 0x2F, 0xFD, 0xFC, 0x00, 0x38, 0xAE, 0x96, 0x5C, 0x40, 0xC6, 0x22, 0xCD, 0x18, 0x37, 0x99,
-    0xD3, 0x1D, 0x13, 0x3B, 0x18, 0x8F, 0x77, 0x1B, 0xA8, 0x41, 0x71, 0x80, 0x2A, 0x0E, 0xF3, 0xBF,
-    0x68, 0xA7, 0xB3, 0x69, 0x5F, 0x26, 0x2C, 0x06, 0xD2, 0xF4, 0x30, 0x4C, 0x06, 0xFB, 0x7E, 0x2E,
-    0xE3, 0x37, 0x06, 0xBA, 0xA3, 0xAA, 0x5E, 0xBA, 0x1B, 0x8B, 0xEC, 0x1A, 0xE4, 0x54, 0xFB, 0xA9,
-    0xB1, 0xA2, 0x31, 0x61, 0x45, 0x73, 0x57, 0x06, 0x2D, 0x22, 0x94, 0xFE, 0x10, 0x7E, 0x38, 0x4F,
-    0xF0, 0x23, 0x22, 0x3F, 0x7A, 0xF2, 0xE3, 0xCC, 0xC8, 0x8F, 0xE1, 0x20, 0x3F, 0x96, 0xC7, 0xFD,
-    0x54, 0xFD, 0x12, 0x41, 0x6B, 0xC5, 0x30, 0x5C, 0x7E, 0x8D, 0x28, 0xBF, 0x73, 0x1A, 0x08, 0xDE,
-    0xC2, 0xF3, 0x5C, 0x9D, 0x93, 0x07, 0xDD, 0x9F, 0x61, 0xE1, 0x7B, 0xD0, 0xDF, 0x75, 0x23, 0x4E,
-    0x0D, 0x8B, 0xBF, 0x28, 0xD7, 0x9E, 0x3B, 0xD5, 0x61, 0x95, 0xF4, 0xF3, 0x2B, 0x6F, 0x40, 0x58,
-    0xC6, 0x0B, 0xED, 0x79, 0xCE, 0xC4, 0xA6, 0x7C, 0x17, 0x36, 0x9A, 0xA6, 0x0F, 0xB0, 0x96, 0xD0,
-    0x99, 0x4C, 0xF6, 0xBE, 0x00, 0x9A, 0xE1, 0x7C, 0xD5, 0x4A, 0x43, 0x91, 0x8E, 0x31, 0xF6, 0x18,
-    0x3B, 0xC4, 0xE6, 0x2E, 0x11, 0x31, 0x29, 0xE8, 0xD0, 0x32, 0x23, 0xAA, 0xE2, 0x14, 0x89, 0x00,
-    0x73, 0x2F, 0xBF, 0x71, 0x1F, 0xF6, 0x71, 0x1E, 0x9F, 0x69, 0xB7, 0x91, 0xBE, 0xFF, 0xBA, 0x8B,
-    0xD3, 0x24, 0x40, 0x8E, 0xDE, 0x47, 0xF7, 0x91, 0xC0, 0x24, 0xFC, 0x98, 0xCE, 0xA4, 0x4E, 0x8F,
-    0xEC, 0x1C, 0x71, 0x07, 0x77, 0xB6, 0x5A, 0x85, 0xEA, 0xE8, 0x5E, 0x5E, 0xFA, 0x63, 0x99, 0x7D,
-    0xCC, 0x67, 0xA3, 0xFD, 0xB0, 0xDD, 0xDB, 0x6A, 0x2F, 0xE6, 0xDF, 0x2B, 0x1E, 0x38, 0xDC, 0x22,
-    0x0F, 0x8C, 0x14, 0x1D, 0xCC, 0x87, 0x53, 0xE4, 0x4B, 0x53, 0xCA, 0x2F, 0xCC, 0x35, 0x88, 0xB0,
-    0xFD, 0x65, 0x2F, 0x63, 0x5E, 0xB2, 0x2A, 0x5A, 0x4B, 0xD4, 0x46, 0x2C, 0xD4, 0x32, 0xB6, 0x80,
-    0xA3, 0x4F, 0x7A, 0xF2, 0x5E, 0x01, 0xD4, 0x2A, 0x4E, 0xAC, 0xE9, 0xB4, 0x4D, 0x4A, 0x64, 0x56,
-    0xE7, 0x57, 0x43, 0xB5, 0xDF, 0x3D, 0xCE, 0x8F, 0xEF, 0x75, 0x52, 0x34, 0x81, 0x81, 0xBA, 0xCB,
-    0xB1, 0x4E, 0xD6, 0xBF, 0x1A, 0x50, 0x7A, 0xE9, 0x5A, 0xF8, 0x4A, 0x44, 0xEF, 0x0E, 0x82, 0x90,
-    0x86, 0xA9, 0x65, 0x46, 0x5A, 0x5F, 0x81, 0xD3, 0x5C, 0xD1, 0xC8, 0x6E, 0x61, 0x2F, 0x01, 0xD2,
-    0x44, 0x29, 0xD6, 0x4F, 0x7E, 0x3E, 0x22, 0xE9, 0x7A, 0xCD, 0xAA, 0xF8, 0x5D, 0x83, 0x93, 0x3F,
-    0xB9, 0x9F, 0xFF, 0x87, 0x80, 0x4C, 0xBD, 0x84, 0xD7, 0x31, 0x59, 0x86, 0xE7, 0xA5, 0x35, 0x63,
-    0xC4, 0xB1, 0xF0, 0xC4, 0xBE, 0xD4, 0x1F, 0x92, 0x50, 0x5A, 0xE3, 0xB4, 0x5E, 0xA5, 0x99, 0x7D,
-    0x4E, 0x99, 0xCC, 0xB2, 0x84, 0x43, 0x24, 0x2B, 0x33, 0x79, 0x31, 0x65, 0x43, 0xFD, 0xF4, 0x1B,
-    0xDD, 0xC9, 0xA7, 0xB1, 0x2F, 0xF5, 0x03, 0x40, 0xBC, 0x95, 0x30, 0xC9, 0xBB, 0xC8, 0x60, 0x6D,
-    0x93, 0xC6, 0x12, 0x62, 0x11, 0xDE, 0xA6, 0x27, 0x79, 0x9F, 0xDF, 0xFF, 0x7D, 0xC4, 0xBA, 0xEA,
-    0x63, 0x5A, 0x72, 0xAD, 0xC1, 0xA8, 0xB8, 0x6C, 0xCF, 0xCC, 0xAC, 0x7E, 0x6D, 0xA6, 0xA0, 0xB0,
-    0x10, 0xA0, 0xDF, 0x2E, 0x14, 0x1A, 0xD0, 0xF1, 0xE1, 0xD1, 0xAB, 0x63, 0x60, 0xA2, 0x05, 0x7D,
-    0xAD, 0xF4, 0xEB, 0xBE, 0x90, 0xD5, 0xC3, 0xA7, 0x1A, 0x67, 0x8D, 0x2A, 0x0F, 0xBB, 0x35, 0x30,
-    0x9E, 0x36, 0xBB, 0x45, 0x83, 0x15, 0xC3, 0x16, 0x4F, 0xBD, 0xCE, 0xE1, 0x26, 0x2C, 0x1A, 0xE7,
-    0x90, 0x46, 0x1F, 0xE8, 0x10, 0xAF, 0xD1, 0x9A, 0x86, 0x33, 0xFD, 0xEB, 0xA2, 0xE4, 0x86, 0x1C,
-    0xED, 0x5C, 0xFB, 0x8C, 0xD5, 0x74, 0x67, 0xFB, 0xDF, 0x59, 0xA4, 0x68, 0xF9, 0x05, 0xEC, 0x9A,
-    0x96, 0xC0, 0xD7, 0x6C, 0xCA, 0x61, 0x9B, 0x29, 0x9B, 0x23, 0x4F, 0x55, 0x9B, 0xBE, 0x59, 0x72,
-    0xFE, 0x2F, 0xD5, 0x5C, 0x3D, 0x90, 0xDD, 0x54, 0x96, 0xBE, 0x92, 0xDC, 0xAD, 0x01, 0xED, 0x96,
-    0x1C, 0xE0, 0x81, 0xC5, 0x30, 0x22, 0x20, 0xA0, 0x60, 0x67, 0xB4, 0xC1, 0x04, 0x1B, 0xB8, 0x5B,
-    0xC2, 0xD4, 0xEE, 0x86, 0x38, 0xF0, 0xF3, 0x54, 0xE1, 0xC0, 0x93, 0x2E, 0x5B, 0x5B, 0xBD, 0x01,
-    0xC1, 0x04, 0x63, 0x4B, 0x86, 0x60, 0xAB, 0x96, 0x00, 0x07, 0x30, 0xE9, 0x4E, 0xE0, 0x00, 0x9E,
-    0xB7, 0xAA, 0x37, 0x20, 0xA0, 0xB6, 0xEC, 0x96, 0xB0, 0x03, 0x07, 0x0E, 0xD0, 0xE0, 0xA5, 0x08,
-    0x08, 0x10, 0x30, 0xD4, 0x54, 0x41, 0x80, 0xC0, 0xF2, 0x58, 0xDD, 0x96, 0x74, 0xF7, 0xFB, 0xCE,
-    0x95, 0x5E, 0xBF, 0xD7, 0x6E, 0xC0, 0x36, 0x3D, 0xC6, 0xDB, 0xD5, 0xAD, 0x27, 0xDD, 0x27, 0xDD,
-    0x9F, 0xF3, 0xFB, 0x9D, 0x73, 0x8F, 0x5A, 0x59, 0x93, 0x49, 0xAC, 0x94, 0xD2, 0xBA, 0xC2, 0x31,
-    0xD1, 0x2D, 0x8E, 0x4B, 0x93, 0xA3, 0x6A, 0xF7, 0x1F, 0x37, 0x97, 0x63, 0xC3, 0xA3, 0xA3, 0x79,
-    0xB4, 0x74, 0xC1, 0x8F, 0x0D, 0x69, 0x5A, 0x4D, 0x78, 0x0C, 0x7D, 0x36, 0xF9, 0x2F, 0xB3, 0x2B,
-    0xB7, 0x60, 0x93, 0x53, 0xF9, 0x25, 0x3E, 0x1A, 0x9B, 0x4D, 0xE7, 0x55, 0x84, 0x01, 0x23, 0xC5,
-    0xA6, 0xE0, 0x8B, 0x73, 0x68, 0xF2, 0xB5, 0xD6, 0xB1, 0x72, 0xB7, 0xA6, 0xEB, 0xA5, 0xB2, 0x6B,
-    0xC5, 0xBB, 0xF0, 0x8B, 0xBB, 0x2E, 0xE0, 0xBB, 0x0A, 0xB7, 0x2A, 0xAB, 0x55, 0x01, 0x86, 0x4E,
-    0xD2, 0x44, 0xC7, 0xB6, 0xD6, 0x91, 0x2E, 0x2C, 0xAD, 0x73, 0x7B, 0xFA, 0x56, 0xAC, 0x32, 0xDD,
-    0xB0, 0x83, 0x78, 0xC7, 0x4C, 0x97, 0x8E, 0x28, 0xE5, 0xE9, 0x52, 0xB9, 0xB8, 0xCF, 0xEA, 0xD0,
-    0x65, 0x94, 0xFA, 0x05, 0x3A, 0xDF, 0x50, 0x4B, 0xCA, 0xE3, 0x64, 0x36, 0xD0, 0xEB, 0x89, 0x52,
-    0x1D, 0xD4, 0x3D, 0x1E, 0xFF, 0xAA, 0x74, 0x3A, 0xB4, 0x44, 0xF8, 0xCA, 0xAD, 0x70, 0x92, 0x60,
-    0x76, 0x4E, 0xE7, 0xEA, 0xD7, 0x43, 0x7D, 0x43, 0xE7, 0x59, 0x17, 0x54, 0xEA, 0xA8, 0xDA, 0x3F,
-    0xEB, 0xFC, 0x8C, 0xFA, 0x3B, 0x1C, 0x4F, 0xAA, 0x43, 0x38, 0x06, 0x9F, 0x73, 0x85, 0x98, 0x14,
-    0xBF, 0x08, 0x7A, 0xF9, 0x7E, 0xFF, 0xAD, 0x94, 0xFB, 0xAD, 0x1C, 0x93, 0x94, 0xC7, 0xA8, 0x92,
-    0x7B, 0x3B, 0x1E, 0xBD, 0xAF, 0xD8, 0xE4, 0xFC, 0x89, 0x4D, 0x76, 0x25, 0x4D, 0x4D, 0x48, 0x2A,
-    0x9F, 0x74, 0xD9, 0x14, 0x29, 0xF6, 0xE8, 0xA7, 0x6C, 0xF2, 0x72, 0xA7, 0x26, 0x2D, 0xD9, 0x64,
-    0xF5, 0xD3, 0x2C, 0x27, 0xD7, 0x34, 0x9A, 0x92, 0xE9, 0x14, 0x4D, 0x61, 0xAC, 0x70, 0x97, 0x9F,
-    0x2B, 0xDC, 0xE5, 0x81, 0x03, 0x9A, 0xB7, 0x82, 0x6C, 0xA0, 0x1D, 0x38, 0xE6, 0xE2, 0xC6, 0x50,
-    0x5F, 0xD3, 0x9D, 0x0A, 0x84, 0xC7, 0x4A, 0xBD, 0xA4, 0x9E, 0x52, 0x7E, 0xE1, 0xA5, 0x2A, 0xF9,
-    0xB2, 0xC2, 0xFC, 0x31, 0xF4, 0x72, 0x7F, 0xCF, 0x28, 0x78, 0xFF, 0xD1, 0x23, 0x48, 0xB7, 0x8F,
-    0xBE, 0x88, 0xB9, 0x23, 0xD3, 0x52, 0xFA, 0x75, 0x11, 0x6A, 0x23, 0xED, 0xFD, 0x1E, 0xD3, 0xA5,
-    0x15, 0xBA, 0x50, 0x79, 0x56, 0xB9, 0x78, 0x8E, 0xCB, 0xD9, 0x78, 0xD7, 0xA9, 0x22, 0x3C, 0xCB,
-    0x66, 0x82, 0xFD, 0x8E, 0x12, 0x6D, 0x80, 0xC6, 0xE1, 0xAE, 0x08, 0x8F, 0xD8, 0xA4, 0x8E, 0xB5,
-    0x20, 0x65, 0xCB, 0xBA, 0x8F, 0xA1, 0x19, 0xBD, 0x0A, 0x36, 0x8F, 0xB7, 0x98, 0x2C, 0x14, 0xAF,
-    0xC0, 0x6A, 0x30, 0xEB, 0x55, 0x92, 0xEF, 0x6D, 0xA1, 0x24, 0x29, 0x48, 0xCA, 0xA9, 0x80, 0x7A,
-    0x4A, 0xE9, 0xB5, 0x44, 0x55, 0x67, 0x4D, 0x11, 0x89, 0xC0, 0xF5, 0xDA, 0x72, 0x2B, 0x0F, 0x1E,
-    0x14, 0xEC, 0x21, 0x4F, 0x6F, 0xAD, 0x97, 0x1E, 0x68, 0x4C, 0x71, 0xC7, 0x4A, 0x0F, 0x80, 0x12,
-    0xEA, 0x01, 0xD1, 0x04, 0xE5, 0x60, 0x42, 0x51, 0x2E, 0x3D, 0x91, 0x7A, 0x87, 0x16, 0xE4, 0xC8,
-    0x86, 0x8E, 0xC2, 0xB4, 0xB8, 0x75, 0x50, 0x41, 0xEF, 0xDF, 0x07, 0xE5, 0x71, 0xCF, 0x11, 0x8C,
-    0x6C, 0xE3, 0x29, 0xD2, 0x8C, 0xF3, 0xCA, 0x30, 0x0F, 0xAC, 0xC8, 0x61, 0x0F, 0x0D, 0x55, 0x69,
-    0xF2, 0x4E, 0xA0, 0x75, 0xE1, 0x81, 0x45, 0xD6, 0x64, 0xEC, 0x2C, 0x12, 0xC3, 0x43, 0xE2, 0x80,
-    0x30, 0x4E, 0x8D, 0x2E, 0xC2, 0xF4, 0x14, 0x16, 0xA6, 0x7E, 0xF9, 0xE3, 0x52, 0x21, 0x56, 0x62,
-    0xA0, 0xC0, 0x1A, 0x0F, 0x7F, 0xA7, 0xC2, 0xD4, 0xC1, 0x4A, 0x43, 0xB5, 0xA2, 0x7E, 0x3D, 0x08,
-    0xFD, 0x5E, 0x51, 0xE1, 0x41, 0x31, 0xD6, 0x38, 0x38, 0xE4, 0xBE, 0x5F, 0x8F, 0x4D, 0x0B, 0x3F,
-    0x56, 0xA6, 0xCF, 0x60, 0x28, 0x9D, 0xBA, 0xFD, 0x31, 0x4D, 0x25, 0x6B, 0xB1, 0x52, 0xCC, 0x28,
-    0x55, 0xFE, 0x69, 0x74, 0xFC, 0x73, 0xAF, 0x1A, 0xD7, 0xD7, 0xCD, 0x96, 0x9C, 0x8F, 0x54, 0x98,
-    0x35, 0x89, 0xCD, 0x8E, 0xD8, 0x9E, 0x09, 0x29, 0x52, 0x9A, 0xB9, 0x42, 0x2D, 0xD9, 0xBA, 0x3F,
-    0xD7, 0x60, 0xED, 0x58, 0x28, 0x8D, 0xAF, 0x5A, 0x82, 0xB7, 0x70, 0x70, 0x6F, 0x54, 0xC8, 0xCC,
-    0x68, 0xBE, 0xAD, 0xB9, 0x29, 0x4D, 0xA8, 0x3C, 0x29, 0xB5, 0x25, 0x79, 0x56, 0x43, 0xA7, 0xBA,
-    0x30, 0xB6, 0xAB, 0x56, 0x2D, 0x91, 0x15, 0x61, 0x2A, 0xEA, 0xC2, 0x47, 0x38, 0x27, 0xD2, 0x9D,
-    0x03, 0x62, 0x28, 0x4B, 0x7F, 0x7E, 0xFC, 0xB4, 0xC6, 0xAA, 0x33, 0x0C, 0x49, 0x12, 0xEF, 0xA3,
-    0xA8, 0x9F, 0xC7, 0x14, 0xAD, 0x16, 0x4F, 0xDA, 0x1D, 0xE9, 0x46, 0x9F, 0x65, 0x93, 0x45, 0x56,
-    0xFD, 0xA3, 0x6A, 0x81, 0x15, 0x5B, 0xA9, 0x1F, 0x87, 0x71, 0xF4, 0x6C, 0xA3, 0x22, 0x30, 0x35,
-    0x41, 0x4F, 0x49, 0x21, 0x4B, 0xDB, 0x63, 0x2D, 0xD8, 0x0F, 0x3A, 0x80, 0xD8, 0x62, 0xC3, 0x2A,
-    0xF2, 0xCC, 0xFB, 0x5A, 0xEC, 0x05, 0x6D, 0x82, 0xF2, 0xDA, 0x6D, 0x1F, 0xAD, 0x46, 0x47, 0x04,
-    0x59, 0xD0, 0x7F, 0x54, 0x9C, 0x6F, 0xA7, 0x96, 0xF4, 0xD2, 0x7A, 0x4F, 0x6A, 0x7B, 0x3D, 0xE9,
-    0x0D, 0x11, 0xC2, 0x90, 0x18, 0x0A, 0x83, 0x7A, 0x35, 0x99, 0xE0, 0x97, 0x64, 0x43, 0x94, 0x9B,
-    0x99, 0x64, 0xE4, 0x8C, 0xE1, 0x0D, 0x9B, 0xC3, 0xED, 0x66, 0x47, 0x5C, 0x39, 0xBC, 0x47, 0xC5,
-    0x06, 0x76, 0xD2, 0xB0, 0x39, 0xCA, 0xD1, 0xEC, 0xA2, 0xFB, 0xEB, 0xC7, 0x74, 0xEE, 0x8A, 0x31,
-    0x0E, 0xB5, 0xDE, 0x9C, 0x63, 0xCD, 0x01, 0x4A, 0x46, 0xD8, 0x7A, 0x64, 0x70, 0x45, 0x65, 0x5E,
-    0xCB, 0x39, 0xE9, 0x84, 0xF2, 0x63, 0xB5, 0x3E, 0xA7, 0x5F, 0xFD, 0x46, 0xC4, 0x11, 0xB6, 0xE4,
-    0x68, 0x02, 0x96, 0x67, 0x34, 0xCF, 0x21, 0xE1, 0x89, 0xD5, 0xC7, 0x09, 0x0C, 0x7A, 0x41, 0x66,
-    0x6D, 0x90, 0x5B, 0x10, 0x26, 0xF0, 0x13, 0x54, 0xC0, 0x6F, 0x46, 0x1E, 0x62, 0x74, 0x34, 0x7B,
-    0xD2, 0x1C, 0x4A, 0x73, 0x22, 0xAC, 0xED, 0xE5, 0xEE, 0x8E, 0xE6, 0xD3, 0xED, 0xFF, 0x51, 0x94,
-    0x54, 0x27, 0x1D, 0x2C, 0x78, 0x9D, 0xA1, 0xDB, 0xA3, 0x8A, 0x1A, 0x4C, 0xC2, 0xC2, 0x66, 0x43,
-    0x74, 0x38, 0x1A, 0x66, 0x6E, 0x88, 0x85, 0x8E, 0x6D, 0x88, 0x63, 0x26, 0xE2, 0x9D, 0x89, 0x05,
-    0x16, 0x6A, 0x19, 0x2A, 0xC8, 0xB1, 0x35, 0x84, 0x3A, 0xA0, 0x27, 0xB1, 0xDD, 0x46, 0x60, 0x96,
-    0xDD, 0x3E, 0xAD, 0xA7, 0xA9, 0x3D, 0xB4, 0xCF, 0xDD, 0x29, 0x4F, 0x79, 0xD2, 0x03, 0x94, 0x4B,
-    0x08, 0x86, 0xA3, 0x05, 0x21, 0xCB, 0x26, 0x6B, 0x80, 0x38, 0x18, 0xB7, 0xB8, 0x85, 0x62, 0xC2,
-    0x5E, 0x92, 0x44, 0x3C, 0x50, 0xA6, 0x06, 0x69, 0x7D, 0x51, 0xBF, 0xA9, 0x8C, 0xFE, 0xCD, 0xDA,
-    0x96, 0xFF, 0x27, 0x63, 0x13, 0x1C, 0x1D, 0xA5, 0xD3, 0xE7, 0x68, 0x42, 0x02, 0x20, 0xA9, 0x84,
-    0x96, 0x33, 0x31, 0xE4, 0xC8, 0x16, 0x0F, 0xD2, 0x06, 0x1B, 0x91, 0x70, 0x36, 0x1A, 0x3A, 0x73,
-    0x50, 0x1B, 0xFA, 0x58, 0xBA, 0x0B, 0x5B, 0x75, 0x20, 0x5E, 0xC2, 0x24, 0x26, 0x47, 0x8C, 0xB4,
-    0x0B, 0xD2, 0x3A, 0x70, 0x0B, 0x3E, 0xE4, 0xCC, 0x1B, 0x8C, 0xAC, 0xCB, 0x13, 0x5B, 0x70, 0xC4,
-    0xA0, 0x7D, 0xC4, 0xCE, 0xDF, 0x21, 0x43, 0x44, 0x48, 0x44, 0xB6, 0x65, 0xA2, 0xB6, 0x91, 0x57,
-    0x70, 0x35, 0x64, 0x87, 0xD9, 0x74, 0x1A, 0x9B, 0xA6, 0xF9, 0xBB, 0xF6, 0xB1, 0xE9, 0x6D, 0x8A,
-    0x68, 0x49, 0x3E, 0xC6, 0xD9, 0xB1, 0x69, 0x07, 0x7B, 0xA6, 0xBF, 0xD1, 0x34, 0x3B, 0x16, 0x9E,
-    0xE1, 0x44, 0xA2, 0x01, 0xC9, 0xCC, 0x91, 0x2A, 0xD0, 0x05, 0x16, 0x5F, 0x44, 0x69, 0xF4, 0x2E,
-    0x54, 0xF1, 0xF9, 0x5C, 0x6D, 0x44, 0xCA, 0xDA, 0xEC, 0x26, 0xC7, 0xBF, 0xC4, 0x83, 0xEB, 0xD0,
-    0x81, 0x0D, 0xA3, 0x6E, 0xB4, 0x03, 0x84, 0xA9, 0xB4, 0x59, 0xC9, 0xE6, 0xB1, 0x82, 0x54, 0x4B,
-    0xC8, 0xF4, 0x61, 0x65, 0x16, 0x34, 0x13, 0x26, 0xC3, 0x4D, 0x55, 0xF4, 0x39, 0x50, 0x68, 0x44,
-    0x45, 0x0F, 0x77, 0xFA, 0x5B, 0x8B, 0xB3, 0x79, 0x15, 0x7F, 0xFD, 0x92, 0x9E, 0x9E, 0xA3, 0xA6,
-    0x38, 0x54, 0x14, 0x8F, 0xE8, 0xE4, 0xF1, 0xB9, 0xC5, 0x6E, 0xAF, 0x8C, 0xA0, 0x95, 0x86, 0xC9,
-    0xDB, 0x9A, 0x9E, 0xDD, 0x49, 0x12, 0xDC, 0x15, 0xA3, 0xC9, 0x8B, 0xD1, 0xB4, 0x4A, 0xC2, 0xD5,
-    0xDE, 0xF5, 0x17, 0xD7, 0x3F, 0xE4, 0x18, 0x14, 0x48, 0x59, 0xAA, 0xAF, 0x1C, 0x50, 0xF6, 0x90,
-    0xD2, 0xE7, 0x2A, 0x45, 0xC4, 0x99, 0x14, 0xDB, 0x93, 0x81, 0x19, 0x82, 0x8A, 0x47, 0xBA, 0x73,
-    0x1A, 0xA7, 0x0D, 0x52, 0xA7, 0x86, 0x26, 0x7C, 0x06, 0xF5, 0xF8, 0xCF, 0x0F, 0x26, 0x1B, 0x18,
-    0x78, 0x0B, 0x7D, 0x7C, 0x54, 0x1A, 0x93, 0x9B, 0x18, 0xCB, 0x4F, 0x17, 0xE2, 0xEA, 0x37, 0xFE,
-    0x15, 0xDC, 0xA8, 0x5C, 0x32, 0x56, 0x22, 0x81, 0x37, 0x39, 0x19, 0x8A, 0x55, 0x54, 0x8E, 0xF8,
-    0xE3, 0xEC, 0x4E, 0x07, 0x43, 0x5E, 0x7C, 0xCA, 0x99, 0x9D, 0x4E, 0xBE, 0x98, 0x6A, 0x2E, 0x82,
-    0xAB, 0xB7, 0x69, 0x3D, 0xDC, 0xF8, 0xD6, 0x75, 0x19, 0xFD, 0xC5, 0x24, 0x52, 0xBB, 0x9F, 0xBE,
-    0xA5, 0x6E, 0x15, 0x88, 0xFD, 0x68, 0xB2, 0x0B, 0xC2, 0xB5, 0x14, 0x4D, 0x27, 0xED, 0xEE, 0x85,
-    0x73, 0xD7, 0xD9, 0xFD, 0x15, 0x1E, 0x30, 0xC9, 0x72, 0xF0, 0x0B, 0xB1, 0x18, 0xC6, 0x79, 0xEF,
-    0x72, 0x94, 0x93, 0x11, 0x69, 0xE8, 0x95, 0xC6, 0x7D, 0x5D, 0x04, 0xFE, 0xC2, 0x08, 0xFD, 0xE9,
-    0xFA, 0x64, 0x0D, 0xFC, 0xEE, 0x31, 0xE8, 0x9F, 0x07, 0xF3, 0x4A, 0x73, 0xC9, 0xD0, 0x03, 0xBD,
-    0xD0, 0xBB, 0x1C, 0x06, 0x4D, 0x2D, 0x6D, 0xBC, 0xCB, 0x3D, 0x5E, 0x0F, 0xB1, 0xA9, 0x81, 0x97,
-    0x41, 0x6C, 0x00, 0x23, 0x9C, 0xCC, 0x11, 0x22, 0x9B, 0xC2, 0xC0, 0xBA, 0xBD, 0x60, 0xE6, 0x71,
-    0x9A, 0x6C, 0xC2, 0x67, 0x43, 0xBF, 0xE0, 0x73, 0xAC, 0x1E, 0xF7, 0x04, 0x25, 0xC0, 0xCA, 0x43,
-    0xF0, 0x12, 0x18, 0xDF, 0x2F, 0x40, 0x8F, 0xE0, 0x6A, 0x4D, 0xBD, 0x21, 0x82, 0x11, 0xAF, 0x9F,
-    0xFE, 0x58, 0x02, 0x3E, 0x78, 0x51, 0x15, 0x01, 0x4C, 0x47, 0x00, 0xE2, 0xF4, 0xA2, 0x04, 0xF5,
-    0xF3, 0x5E, 0x34, 0xA6, 0xD1, 0x86, 0xE8, 0xD7, 0x7E, 0xE9, 0x57, 0xA7, 0x94, 0x7F, 0x15, 0x86,
-    0xFE, 0x35, 0x00, 0xAE, 0x64, 0x72, 0x8C, 0x34, 0xA1, 0x96, 0xAF, 0x19, 0x4C, 0x41, 0x17, 0x49,
-    0xFF, 0x4E, 0x88, 0x04, 0x2F, 0xFA, 0x36, 0x86, 0xC8, 0x83, 0x05, 0x2C, 0x29, 0x94, 0x53, 0x7E,
-    0x2B, 0x90, 0x92, 0x4B, 0xE8, 0x42, 0x91, 0x10, 0xE0, 0x49, 0xBB, 0xB0, 0x8A, 0x79, 0x27, 0x4A,
-    0x83, 0x95, 0xF2, 0x00, 0x30, 0xA1, 0xDF, 0x58, 0x2B, 0x2D, 0x90, 0xEB, 0x14, 0x11, 0x82, 0x23,
-    0x0E, 0x73, 0x95, 0x0C, 0xB0, 0xC5, 0x3D, 0x0A, 0x10, 0x36, 0x72, 0x66, 0xB0, 0x84, 0x19, 0x05,
-    0xF6, 0x06, 0x2E, 0x3C, 0x61, 0xB8, 0xFA, 0x61, 0xAD, 0xAC, 0xF5, 0x86, 0xE8, 0x22, 0x7A, 0x4E,
-    0xE6, 0x18, 0x52, 0xBA, 0x63, 0xCA, 0x76, 0x0D, 0xBF, 0x8C, 0xD3, 0x10, 0x43, 0xD4, 0xA4, 0xA5,
-    0x16, 0x8A, 0xE2, 0xCE, 0x03, 0x47, 0xC7, 0x89, 0x98, 0x28, 0xA8, 0x1A, 0xC0, 0x4F, 0xF0, 0x2A,
-    0xA6, 0xD9, 0x02, 0x46, 0x78, 0xB9, 0x1F, 0xAB, 0x47, 0xC0, 0xD7, 0x11, 0x6D, 0x58, 0x8C, 0x93,
-    0x75, 0x0A, 0x77, 0xD4, 0xD3, 0x59, 0x3F, 0xE9, 0xE7, 0x30, 0x7B, 0xA7, 0xF0, 0x38, 0x3E, 0xFC,
-    0x1C, 0xEA, 0x90, 0x40, 0x1F, 0x70, 0x1E, 0x51, 0x4A, 0x23, 0xD2, 0x85, 0x03, 0x09, 0xF3, 0x4F,
-    0x2A, 0x63, 0x23, 0x81, 0x12, 0x20, 0xDC, 0x0C, 0xCE, 0x29, 0xEF, 0x3D, 0x88, 0xB9, 0xDC, 0x42,
-    0x70, 0x9D, 0x8A, 0xAE, 0xFF, 0x12, 0x46, 0xBF, 0x00, 0x67, 0x18, 0x94, 0x81, 0x86, 0x9B, 0x0C,
-    0xF8, 0xF4, 0xF2, 0xF4, 0xCC, 0x8C, 0x68, 0x4F, 0xA9, 0x9F, 0x30, 0xFA, 0xB7, 0x69, 0x63, 0x3F,
-    0x68, 0x25, 0x40, 0x8E, 0x29, 0xA0, 0x1C, 0x60, 0x5E, 0x7F, 0xEF, 0x1B, 0xE2, 0x72, 0xD1, 0xB9,
-    0x22, 0x4E, 0x04, 0x25, 0xC3, 0x2D, 0x26, 0x20, 0x08, 0xAA, 0x0E, 0x2E, 0x20, 0x4B, 0xC1, 0x0A,
-    0x78, 0xAA, 0x24, 0x55, 0xD2, 0x5E, 0x65, 0x0F, 0x38, 0x0C, 0xEA, 0x82, 0x14, 0xD2, 0xB6, 0x01,
-    0xCA, 0x80, 0x6C, 0x41, 0x2E, 0x71, 0x9E, 0x5F, 0x63, 0xEE, 0xE2, 0x2D, 0x13, 0xF8, 0x0E, 0xC2,
-    0x9B, 0x39, 0x5D, 0xD7, 0x70, 0x60, 0xF4, 0xD1, 0x39, 0x61, 0x59, 0x0A, 0xDA, 0x67, 0x0C, 0x50,
-    0xDB, 0x48, 0x19, 0xE2, 0x86, 0x98, 0x3A, 0x23, 0xD4, 0x2F, 0x05, 0x36, 0x97, 0xCA, 0x9A, 0x8A,
-    0x01, 0xB6, 0x85, 0xBA, 0x82, 0x02, 0x04, 0xF7, 0x9B, 0xD3, 0xE5, 0x33, 0x3B, 0xC1, 0xBF, 0xC0,
-    0x04, 0x02, 0x03, 0x4E, 0x54, 0x45, 0x9B, 0xC7, 0x7A, 0x6A, 0xB6, 0x5B, 0x92, 0x78, 0xAB, 0x82,
-    0x43, 0x4A, 0xBA, 0xBE, 0xBF, 0x15, 0xAD, 0x34, 0x30, 0xD7, 0x31, 0xC4, 0x8C, 0x47, 0x01, 0x23,
-    0x5D, 0x85, 0x98, 0x86, 0xAE, 0x8F, 0xEA, 0x57, 0x1A, 0xDE, 0x44, 0x1B, 0x1C, 0x1D, 0xEE, 0x79,
-    0xCA, 0x19, 0x44, 0x71, 0x86, 0xA5, 0xD5, 0xB6, 0xDE, 0x3C, 0xA6, 0x63, 0x2E, 0x85, 0x7C, 0xE0,
-    0xC0, 0x96, 0x38, 0x92, 0x66, 0x9C, 0x28, 0x9D, 0xAC, 0x01, 0x29, 0x47, 0x16, 0x66, 0x3A, 0x81,
-    0xBC, 0x42, 0xB2, 0x1A, 0x92, 0xA2, 0x8C, 0xD2, 0xF0, 0x62, 0x0C, 0x50, 0x90, 0xBA, 0x94, 0x4D,
-    0x18, 0x36, 0x52, 0xD4, 0xAD, 0x2C, 0x36, 0x39, 0x0C, 0xB3, 0xE9, 0xD7, 0x21, 0x67, 0x8D, 0xE9,
-    0xD8, 0x65, 0x9F, 0x34, 0x7F, 0x2A, 0xFB, 0x02, 0x62, 0xC7, 0xC1, 0x6D, 0xE9, 0x26, 0x56, 0x6B,
-    0x17, 0x39, 0x37, 0x46, 0xA1, 0xA4, 0xA8, 0x57, 0x68, 0x20, 0x47, 0x0B, 0x26, 0x13, 0x82, 0xC5,
-    0xA7, 0x5F, 0x7C, 0xEB, 0xFE, 0x12, 0xBC, 0x7D, 0x6A, 0xC6, 0x00, 0x09, 0xB6, 0xAC, 0xED, 0x74,
-    0x84, 0xC9, 0x40, 0x9C, 0x14, 0x36, 0xCB, 0xA4, 0x1F, 0x91, 0xAC, 0xC8, 0x28, 0x4B, 0xED, 0x78,
-    0x8B, 0x09, 0xDE, 0xE2, 0x41, 0x24, 0xAC, 0x66, 0x06, 0x88, 0x80, 0xDD, 0x64, 0x79, 0x84, 0x67,
-    0xC4, 0xF6, 0x67, 0x98, 0x87, 0xB0, 0x28, 0xA4, 0xB0, 0x00, 0x08, 0x50, 0x29, 0xB7, 0x09, 0x9D,
-    0xA3, 0xA6, 0x51, 0x26, 0xEA, 0x75, 0x75, 0x6F, 0x72, 0x11, 0x12, 0x52, 0x49, 0x3E, 0x23, 0xA4,
-    0x2D, 0x8F, 0x88, 0x40, 0x32, 0x76, 0x53, 0xA8, 0x83, 0xD5, 0x85, 0xC1, 0x02, 0x90, 0xCA, 0x36,
-    0xC5, 0x22, 0x49, 0x93, 0x3E, 0x63, 0x78, 0x83, 0xA7, 0x1F, 0x9D, 0xCE, 0xE9, 0xB7, 0xB0, 0x08,
-    0xBD, 0x1A, 0x77, 0x22, 0x4B, 0x4B, 0xA4, 0x57, 0x3F, 0xA7, 0x13, 0xB4, 0x4A, 0xF5, 0xFB, 0x1D,
-    0x29, 0x46, 0x49, 0x9B, 0xB4, 0x99, 0xA4, 0xF8, 0x4E, 0x03, 0xE0, 0x58, 0x99, 0x00, 0x44, 0x03,
-    0xE9, 0x0D, 0xC8, 0xFF, 0x9E, 0x0B, 0x3D, 0x04, 0x67, 0x14, 0xC8, 0xF0, 0x8B, 0xE9, 0x34, 0x53,
-    0x77, 0xD8, 0x41, 0x41, 0xDC, 0x93, 0x88, 0x8B, 0x87, 0xC7, 0x96, 0x0C, 0xD1, 0x01, 0xE1, 0x52,
-    0xB7, 0x9D, 0xA8, 0xEA, 0xB8, 0x16, 0xFF, 0x5D, 0x1E, 0x5B, 0x8B, 0x69, 0x99, 0xD8, 0x5A, 0x04,
-    0xED, 0x08, 0x73, 0x64, 0xCD, 0xC2, 0xC3, 0xB5, 0x7C, 0x26, 0x34, 0x86, 0xBF, 0x46, 0xCD, 0x82,
-    0xA1, 0x79, 0xC2, 0xE6, 0x90, 0x49, 0xD0, 0x1B, 0x14, 0x8F, 0x40, 0xFF, 0xAA, 0x27, 0xB8, 0x73,
-    0x24, 0x9E, 0x71, 0x25, 0x9E, 0x01, 0xDD, 0x71, 0xB7, 0x40, 0x79, 0xC8, 0x25, 0xE3, 0x99, 0xFA,
-    0x36, 0x9A, 0x5D, 0x5D, 0x79, 0x08, 0xB4, 0x74, 0x1E, 0xD1, 0xFB, 0xC1, 0xDC, 0xEB, 0xCA, 0x50,
-    0x36, 0x3D, 0x01, 0xFE, 0xAE, 0x15, 0xC3, 0xC2, 0x25, 0xEC, 0x6C, 0x29, 0x26, 0xF8, 0xF9, 0xCC,
-    0x7C, 0xA4, 0x0B, 0x5F, 0x0D, 0xA4, 0xF1, 0x04, 0x80, 0x0F, 0x24, 0x26, 0x78, 0x9F, 0x6E, 0x7F,
-    0x25, 0xD9, 0x35, 0xB5, 0xEB, 0x53, 0x8B, 0x5F, 0xC5, 0xC4, 0x38, 0x86, 0xBC, 0x17, 0xB5, 0x04,
-    0x8A, 0x82, 0xE3, 0xC0, 0x32, 0x91, 0xE3, 0x76, 0x46, 0x19, 0x21, 0x95, 0x9D, 0x7D, 0x41, 0xAD,
-    0x12, 0xD9, 0x09, 0xE6, 0x14, 0x24, 0x5F, 0x3B, 0x83, 0xD3, 0x0C, 0x8A, 0x14, 0x68, 0xF1, 0x5F,
-    0x45, 0x48, 0x77, 0xC4, 0x80, 0x4A, 0x42, 0x43, 0x59, 0xBF, 0x21, 0xC8, 0xED, 0x9D, 0x06, 0x3A,
-    0x0F, 0xF5, 0x25, 0xDD, 0x3A, 0xBA, 0xF5, 0xCA, 0xA7, 0xC2, 0x76, 0x05, 0x6E, 0x71, 0x25, 0x68,
-    0x1F, 0x73, 0xEB, 0xB9, 0x38, 0x07, 0x5C, 0x6A, 0x96, 0xC0, 0xA8, 0x4C, 0xDD, 0xF9, 0x6F, 0x2C,
-    0x8F, 0xB7, 0x90, 0x13, 0x7D, 0xF8, 0x8A, 0x7E, 0x3E, 0x4B, 0xBA, 0xB7, 0xA3, 0x2A, 0xFE, 0x9B,
-    0x59, 0xEF, 0x6B, 0x35, 0x00, 0xE0, 0x32, 0x3A, 0xEF, 0x38, 0x27, 0xB0, 0x30, 0xFA, 0x96, 0xD3,
-    0x40, 0x57, 0xA0, 0xDB, 0xD2, 0xE4, 0x28, 0x66, 0x08, 0xC2, 0xCC, 0xC7, 0x63, 0x7B, 0x32, 0xC3,
-    0xA7, 0xA7, 0xBF, 0xD3, 0xFA, 0xAB, 0x85, 0xA4, 0x3A, 0xA6, 0x05, 0xF4, 0xB8, 0xF6, 0x9D, 0xD3,
-    0x92, 0x53, 0xC8, 0x96, 0x2F, 0xBC, 0x7A, 0x44, 0x3D, 0xB0, 0xAA, 0x1E, 0x8F, 0x3E, 0x38, 0x0F,
-    0xB9, 0x63, 0xDE, 0x68, 0xDF, 0x5E, 0xCE, 0x90, 0x10, 0x4D, 0x7D, 0x5C, 0x78, 0x6B, 0x5B, 0x88,
-    0xB8, 0x8B, 0x83, 0xCD, 0xDD, 0xD2, 0x30, 0x61, 0x48, 0x49, 0x2B, 0x23, 0x36, 0xC2, 0x13, 0x43,
-    0x70, 0x3B, 0xA7, 0x08, 0x8E, 0xC5, 0x34, 0xAC, 0xD2, 0x11, 0x45, 0x34, 0xC5, 0x4E, 0x7F, 0xC4,
-    0xD3, 0xF9, 0x72, 0x43, 0xCF, 0x02, 0x89, 0x41, 0xF0, 0xA4, 0x53, 0x6B, 0x21, 0x3E, 0xBD, 0xC3,
-    0xA9, 0x01, 0x4B, 0x84, 0xF4, 0x75, 0xF0, 0x87, 0xC0, 0xEE, 0x20, 0x3E, 0x64, 0xFB, 0x2C, 0x1D,
-    0x2A, 0xDC, 0x29, 0x3A, 0x39, 0x3B, 0x17, 0x8C, 0xFD, 0xB0, 0x35, 0xDC, 0x0D, 0xD5, 0x70, 0xBC,
-    0xA9, 0x7B, 0x5F, 0xF7, 0x0F, 0x77, 0xEA, 0x61, 0x49, 0x23, 0x45, 0x4C, 0x78, 0xC0, 0x4D, 0xFE,
-    0x05, 0x4E, 0x31, 0x7C, 0x43, 0x23, 0x11, 0xA5, 0x99, 0xAE, 0x06, 0x4F, 0xA9, 0xC6, 0xB8, 0x43,
-    0x52, 0x98, 0xC6, 0x73, 0x86, 0xE2, 0x0B, 0x85, 0xE6, 0x6F, 0x89, 0x87, 0xB7, 0x54, 0x50, 0x58,
-    0x9D, 0xD3, 0x83, 0x1B, 0x51, 0xE9, 0xF4, 0xC3, 0x2E, 0xD2, 0x2D, 0xC9, 0xD2, 0xC2, 0xEB, 0xA2,
-    0xCE, 0xD1, 0x7F, 0xC8, 0x8A, 0x83, 0x1D, 0xBA, 0xF3, 0x0B, 0x2C, 0xF5, 0xCE, 0x4E, 0x40, 0x16,
-    0xFF, 0x2A, 0x66, 0xD8, 0x8D, 0x9B, 0x07, 0xA3, 0xB1, 0x12, 0xDC, 0x40, 0x12, 0x33, 0x90, 0x21,
-    0x6C, 0xB7, 0xCE, 0xCE, 0x62, 0x0F, 0x44, 0x1E, 0xCE, 0xCD, 0x0A, 0x0F, 0xE7, 0x88, 0x39, 0xE6,
-    0x22, 0x8E, 0x90, 0x26, 0x48, 0xA7, 0xD4, 0x10, 0x93, 0x5F, 0xFB, 0x41, 0x1F, 0xBD, 0x24, 0x3A,
-    0x28, 0x89, 0x4C, 0xFF, 0xC2, 0x16, 0x77, 0x92, 0x40, 0x7F, 0x34, 0x36, 0x50, 0x51, 0x52, 0x62,
-    0x0C, 0x3C, 0xED, 0xBA, 0xB5, 0x9A, 0x20, 0x6D, 0xAC, 0xEA, 0xA1, 0xD9, 0x3E, 0x0D, 0xF4, 0x2A,
-    0xEC, 0x41, 0xA0, 0x94, 0x40, 0x80, 0x21, 0xC1, 0x86, 0x38, 0xF4, 0xDB, 0xB9, 0xE0, 0x60, 0x05,
-    0x27, 0xE0, 0xC1, 0xBA, 0xA2, 0x9B, 0x5A, 0xE0, 0x2B, 0x04, 0x27, 0xA0, 0xB4, 0xA6, 0x89, 0x08,
-    0xAC, 0xB1, 0xD6, 0x92, 0x91, 0x0C, 0x78, 0x33, 0x43, 0xDF, 0x21, 0xCB, 0x48, 0xCF, 0x61, 0xB7,
-    0xB2, 0xCD, 0x73, 0xAD, 0x11, 0xA2, 0x08, 0xD6, 0xEB, 0x25, 0x54, 0x96, 0x5C, 0xEC, 0x35, 0x1E,
-    0xC3, 0x4B, 0x3C, 0x66, 0xCC, 0xCE, 0xDA, 0x2D, 0x8F, 0x5E, 0xC5, 0x63, 0x98, 0x3B, 0x92, 0xBA,
-    0x73, 0x34, 0x5D, 0x8D, 0xA3, 0x9F, 0x85, 0xD0, 0x3A, 0xFA, 0x23, 0x81, 0x05, 0x12, 0x81, 0xCC,
-    0xB4, 0x47, 0xE0, 0xAF, 0x01, 0xA7, 0xC2, 0xB4, 0x01, 0x73, 0x09, 0xBE, 0x12, 0xA0, 0xA9, 0xEC,
-    0xD8, 0xA4, 0x19, 0x8C, 0x3F, 0x17, 0xEF, 0xB4, 0xDC, 0x8E, 0x6E, 0x68, 0xF7, 0x83, 0x0B, 0x23,
-    0x6F, 0x0E, 0x2A, 0x83, 0x11, 0x90, 0xB4, 0x24, 0x48, 0x61, 0xB5, 0x18, 0xCD, 0x6A, 0xBB, 0x01,
-    0x09, 0x59, 0x1D, 0xCF, 0x5A, 0xB8, 0x43, 0x7C, 0xC1, 0xAD, 0x13, 0x9F, 0xB7, 0x88, 0xCF, 0x07,
-    0x12, 0x25, 0x32, 0x43, 0x6C, 0x95, 0x07, 0x0D, 0x5C, 0xB7, 0xDB, 0x0F, 0xB9, 0x8E, 0xED, 0x39,
-    0x0B, 0x2C, 0xF5, 0x67, 0x07, 0x99, 0x30, 0x71, 0x9B, 0x7A, 0x72, 0x66, 0xB1, 0xE1, 0xCF, 0x9F,
-    0x13, 0xCF, 0xBF, 0x56, 0xA9, 0x3E, 0xC6, 0xF2, 0x88, 0x43, 0x29, 0xA3, 0x7E, 0xCE, 0x84, 0xC1,
-    0xD7, 0x94, 0xD6, 0x9E, 0x87, 0x88, 0x96, 0xDE, 0xBF, 0x22, 0xBB, 0x69, 0x3C, 0x6D, 0x05, 0xDD,
-    0x13, 0x0E, 0xFB, 0x39, 0x42, 0x07, 0x1A, 0xF5, 0xF4, 0xA0, 0x2E, 0x82, 0xD6, 0x07, 0x84, 0x10,
-    0x27, 0x8D, 0x40, 0x9C, 0x7B, 0x1E, 0xCA, 0x1B, 0x93, 0xE4, 0x21, 0x03, 0x04, 0xD2, 0x96, 0xE0,
-    0x69, 0x11, 0xE7, 0x73, 0xAB, 0x16, 0xC0, 0x81, 0x5B, 0x67, 0xEC, 0xFC, 0xD6, 0x6C, 0xDF, 0x1D,
-    0x36, 0x59, 0xB3, 0xC4, 0xCA, 0x0A, 0x93, 0x34, 0x92, 0x45, 0xB8, 0x3C, 0x66, 0x11, 0x84, 0x65,
-    0x1E, 0xB9, 0x9E, 0xD5, 0x81, 0x8E, 0x37, 0xE2, 0x59, 0x9E, 0x28, 0xAB, 0x5C, 0x9D, 0x5B, 0xD9,
-    0x80, 0xA8, 0x24, 0x31, 0x7A, 0x07, 0xA7, 0x80, 0xEF, 0x5F, 0x1B, 0xCB, 0x47, 0x64, 0x09, 0x36,
-    0x26, 0xC5, 0x5D, 0x4D, 0x7E, 0x47, 0xD3, 0x4B, 0x63, 0x8E, 0xD3, 0x27, 0x00, 0xBF, 0xC0, 0x44,
-    0xD1, 0xD7, 0x63, 0xA2, 0x68, 0xDC, 0x8D, 0x8D, 0xC7, 0xBD, 0x98, 0x30, 0x9F, 0xDF, 0xA9, 0x60,
-    0xC8, 0x68, 0x38, 0x7E, 0x66, 0xEF, 0xD6, 0x27, 0xF1, 0x88, 0xC1, 0x44, 0xD0, 0x65, 0x20, 0x74,
-    0x66, 0x0B, 0x06, 0x91, 0x7A, 0x68, 0x54, 0x09, 0x07, 0x4A, 0xDC, 0xFA, 0x79, 0xA6, 0xCB, 0x15,
-    0x75, 0xA2, 0xB6, 0xE8, 0x4F, 0x5C, 0xA6, 0xC8, 0x1F, 0xE3, 0x92, 0xF6, 0xDF, 0x0D, 0x2D, 0x1E,
-    0x67, 0x53, 0x43, 0x5A, 0x90, 0xB7, 0x21, 0xF3, 0xBD, 0xED, 0x2C, 0xDF, 0x9B, 0xAA, 0xA3, 0x16,
-    0xA0, 0xE1, 0xF9, 0xA4, 0xF5, 0xF2, 0xB5, 0x1C, 0x4A, 0xE5, 0xA7, 0x41, 0x5E, 0x73, 0xB7, 0x20,
-    0xC8, 0x0B, 0xAB, 0xDD, 0xC7, 0xF9, 0x93, 0x22, 0x77, 0xF0, 0xC1, 0x2C, 0x3B, 0xB3, 0x64, 0xEA,
-    0x76, 0xF8, 0x69, 0x31, 0xFE, 0x88, 0x72, 0xAF, 0xB2, 0x34, 0x57, 0xCA, 0x84, 0xBE, 0x57, 0xDC,
-    0x1D, 0x3F, 0x8F, 0x1A, 0x2B, 0x42, 0x23, 0x42, 0x1B, 0x62, 0x7D, 0xF7, 0xDF, 0x7E, 0x9A, 0x0E,
-    0x5A, 0x04, 0xF3, 0x67, 0xD5, 0xDF, 0x79, 0x3F, 0x6D, 0x27, 0x56, 0xC3, 0x15, 0x09, 0xA2, 0x96,
-    0x65, 0xD1, 0x39, 0x8F, 0xF6, 0x4D, 0x26, 0x2A, 0x53, 0x36, 0x91, 0x7F, 0x46, 0xC9, 0x0A, 0x2F,
-    0xA2, 0xC1, 0xBB, 0xC9, 0xED, 0x64, 0xE6, 0xB8, 0x2D, 0x3E, 0xE3, 0x52, 0x0E, 0x7C, 0xD9, 0x5C,
-    0x7B, 0xBF, 0x9D, 0x7F, 0xDC, 0x8D, 0x65, 0x79, 0x7C, 0x5C, 0xB6, 0x32, 0x2E, 0xA8, 0xF0, 0x83,
-    0x69, 0x26, 0x59, 0xC2, 0x5C, 0xB2, 0xFF, 0x08, 0x7C, 0xC0, 0x29, 0xC6, 0x3C, 0x5C, 0x5E, 0x22,
-    0x04, 0x77, 0x2B, 0x99, 0x1F, 0x2F, 0x2E, 0xC6, 0xEE, 0xB5, 0x8A, 0xDF, 0x26, 0xA5, 0xF0, 0xA0,
-    0xE2, 0x1E, 0x77, 0x94, 0xA8, 0x07, 0x17, 0x6F, 0x33, 0x17, 0x1D, 0x6C, 0x46, 0xEB, 0x1A, 0x7C,
-    0x32, 0x84, 0x56, 0x6F, 0xCF, 0x15, 0x0D, 0x84, 0xA2, 0xE9, 0xBE, 0x2C, 0xCF, 0xD9, 0xDC, 0x16,
-    0xD0, 0xC5, 0x58, 0x32, 0x67, 0x2C, 0x99, 0xF4, 0x8C, 0x6D, 0xD3, 0x04, 0x21, 0x7A, 0x12, 0x33,
-    0xC8, 0x40, 0x08, 0x1D, 0xD2, 0x4B, 0x28, 0xFB, 0x66, 0x2D, 0x17, 0x14, 0x3A, 0x9C, 0x68, 0xB9,
-    0x00, 0x7A, 0xE3, 0x45, 0x98, 0xF3, 0x02, 0xC6, 0x8D, 0x17, 0x6E, 0x23, 0x17, 0x61, 0xC1, 0x0B,
-    0xA5, 0xE5, 0xC2, 0x69, 0xE4, 0x22, 0x78, 0x9F, 0x17, 0x4A, 0xCB, 0x85, 0xB3, 0x25, 0x17, 0x81,
-    0xF4, 0x04, 0x95, 0xA4, 0x0A, 0x39, 0x14, 0x33, 0x38, 0xBB, 0x8A, 0x9B, 0x78, 0x83, 0xAB, 0x31,
-    0x0B, 0x12, 0xBD, 0x62, 0x72, 0xD6, 0x6C, 0x47, 0x1A, 0x14, 0x63, 0x22, 0xC3, 0x21, 0xDD, 0xBF,
-    0xE3, 0xE7, 0x00, 0x20, 0x41, 0x03, 0x57, 0xE8, 0xE8, 0xF7, 0x20, 0x4E, 0xCF, 0xE8, 0x4D, 0x58,
-    0x76, 0xBF, 0x61, 0xE8, 0x4F, 0x8C, 0x24, 0x10, 0x2D, 0xC5, 0xA9, 0x2D, 0xA7, 0xE1, 0x6D, 0x9E,
-    0x5A, 0xBA, 0xB7, 0x18, 0x47, 0x94, 0x40, 0xD2, 0x94, 0x4C, 0xAD, 0x2F, 0xCB, 0x4E, 0x0F, 0x30,
-    0x57, 0xAC, 0x1E, 0xAE, 0x45, 0x62, 0x43, 0x11, 0x0F, 0x2E, 0x1B, 0xEE, 0x0A, 0x17, 0xDF, 0xB4,
-    0x72, 0xE1, 0x57, 0x42, 0x1D, 0x50, 0x15, 0x27, 0x10, 0x0B, 0x5E, 0xF8, 0x95, 0x50, 0x27, 0x49,
-    0x79, 0x61, 0x77, 0x72, 0xE1, 0x57, 0x42, 0x9D, 0xE8, 0x65, 0x5E, 0x58, 0x9D, 0x5C, 0xF8, 0xDF,
-    0x08, 0xA9, 0xA2, 0x75, 0x5E, 0x50, 0x28, 0x42, 0xD9, 0xE8, 0xB2, 0xE9, 0x7A, 0xA0, 0x9B, 0x8C,
-    0xE8, 0x64, 0xF3, 0xD7, 0xA0, 0x3C, 0x83, 0x49, 0x8C, 0x35, 0x97, 0x34, 0x8C, 0xEC, 0x04, 0xCC,
-    0x42, 0xE8, 0x21, 0xE7, 0x11, 0x1A, 0xB6, 0x1B, 0x24, 0xF5, 0xEB, 0x31, 0x65, 0xA7, 0xB2, 0x97,
-    0x19, 0xFA, 0xB6, 0x10, 0x50, 0x3B, 0xD3, 0xBF, 0xD3, 0xDC, 0x60, 0x76, 0xEB, 0x19, 0xB5, 0x9C,
-    0x3B, 0xA2, 0x96, 0x39, 0x0D, 0x34, 0x7C, 0xF3, 0x55, 0xDD, 0x3B, 0xBA, 0x9B, 0xCF, 0x64, 0x1A,
-    0x1D, 0x93, 0x2D, 0x74, 0xD9, 0x5E, 0x1A, 0xF9, 0x28, 0xC9, 0x9C, 0x72, 0xC6, 0x72, 0xCB, 0xAC,
-    0x84, 0x09, 0x59, 0x6A, 0xA4, 0x3C, 0x14, 0x5E, 0x91, 0x75, 0x66, 0xF2, 0x80, 0x6C, 0x6A, 0x0F,
-    0xF5, 0x20, 0xFF, 0x7F, 0x04, 0x7A, 0x49, 0xB2, 0x54, 0x35, 0x39, 0xE8, 0x15, 0x5C, 0x9A, 0x24,
-    0xE1, 0x4C, 0x06, 0xC4, 0xED, 0xB6, 0xB3, 0x41, 0xF7, 0x52, 0xA0, 0x97, 0xCC, 0x38, 0xE2, 0x3F,
-    0x67, 0x32, 0x63, 0x12, 0x31, 0x63, 0x9D, 0xCF, 0x58, 0xE8, 0x33, 0x16, 0x11, 0x9C, 0x37, 0xF3,
-    0x5A, 0x01, 0x71, 0xB2, 0x4E, 0xFD, 0x42, 0x25, 0x9B, 0x5A, 0x17, 0x16, 0x33, 0x7D, 0x27, 0x04,
-    0xD6, 0x8B, 0xE9, 0x93, 0x24, 0x4B, 0xAE, 0x06, 0x5F, 0xA9, 0x4C, 0xFA, 0x45, 0x0D, 0xB9, 0x98,
-    0x21, 0x03, 0x73, 0x9B, 0x5F, 0xC6, 0x52, 0xC0, 0xA4, 0x3B, 0x5B, 0x8B, 0xF2, 0xC5, 0x74, 0x4B,
-    0x8B, 0x6A, 0xA8, 0x76, 0x51, 0x43, 0xB9, 0xB8, 0x36, 0xA8, 0x61, 0xB9, 0x8B, 0x1A, 0x96, 0x46,
-    0x0D, 0x63, 0x51, 0xC3, 0xD6, 0xA8, 0x61, 0x69, 0xD4, 0xF0, 0xB0, 0xA8, 0x61, 0x6B, 0xD4, 0xF0,
-    0x53, 0xA3, 0x86, 0x6B, 0xB7, 0xA7, 0x86, 0x02, 0x38, 0xF6, 0x8B, 0x86, 0xB9, 0xA9, 0x50, 0x53,
-    0xAF, 0x93, 0xA9, 0xBE, 0xC9, 0x73, 0x45, 0xAD, 0x9A, 0x21, 0x55, 0x68, 0x5E, 0x58, 0x66, 0xBD,
-    0xB0, 0xF6, 0x41, 0xDD, 0x1F, 0x6F, 0x45, 0xED, 0x18, 0x49, 0x96, 0xC2, 0x57, 0xD0, 0x62, 0x43,
-    0xF8, 0x25, 0x60, 0x43, 0xD8, 0xF7, 0x2D, 0x4D, 0x07, 0xA1, 0xB8, 0x0D, 0x04, 0xDE, 0xA4, 0x23,
-    0xC7, 0xBA, 0x15, 0x67, 0xF4, 0xBE, 0xE2, 0xCE, 0x32, 0x4C, 0xC9, 0xEB, 0x86, 0x72, 0x18, 0x53,
-    0xD4, 0xE8, 0x08, 0xA0, 0x71, 0xE5, 0x88, 0x16, 0xB5, 0x4B, 0x89, 0x20, 0xBD, 0xE4, 0x19, 0xD9,
-    0xBF, 0xE6, 0x66, 0xD3, 0x1F, 0x0F, 0x6A, 0xA9, 0xF6, 0x00, 0xE0, 0x66, 0x39, 0x53, 0xC9, 0x72,
-    0x2B, 0xBF, 0x62, 0x35, 0x88, 0x27, 0xB9, 0x6F, 0x57, 0x12, 0xBC, 0x4E, 0x4B, 0x2E, 0x3A, 0x6D,
-    0x22, 0x60, 0x76, 0xE7, 0x11, 0xED, 0xBC, 0xA7, 0xE1, 0xFD, 0x4E, 0xCD, 0xD4, 0xB7, 0x57, 0x05,
-    0xEC, 0xA7, 0x24, 0xA8, 0x06, 0x7E, 0xA0, 0xCA, 0x40, 0x69, 0x0B, 0x62, 0xFA, 0x44, 0xEA, 0xD5,
-    0x24, 0x0D, 0xAD, 0xD4, 0x0B, 0xC4, 0x71, 0x2F, 0x4E, 0xCF, 0x70, 0x36, 0x04, 0xCD, 0xE5, 0xCE,
-    0x40, 0xF5, 0xA8, 0x92, 0x3A, 0x3D, 0x4B, 0x52, 0xB1, 0x71, 0x52, 0x42, 0xFE, 0xF4, 0xE1, 0x86,
-    0x63, 0xA1, 0xE3, 0xCB, 0xF4, 0x9F, 0x90, 0x8A, 0x80, 0x76, 0x84, 0x27, 0xFE, 0x15, 0xB6, 0x60,
-    0x4A, 0xC1, 0xA5, 0xC6, 0xCC, 0x24, 0x01, 0x03, 0xC2, 0xC2, 0xE5, 0x98, 0x04, 0xF2, 0x6A, 0xF9,
-    0xF5, 0x59, 0xDF, 0x08, 0x72, 0xB8, 0xBE, 0xC2, 0xE1, 0x71, 0xF3, 0x44, 0x3E, 0xAB, 0x68, 0x4C,
-    0x1A, 0xB5, 0x63, 0xD7, 0xFB, 0xBE, 0x24, 0x9B, 0xF1, 0x96, 0x2E, 0xFC, 0x00, 0xE0, 0xA8, 0xBF,
-    0x25, 0xF7, 0xA4, 0x43, 0xE1, 0xD2, 0xBD, 0xA0, 0x9F, 0xB2, 0x52, 0x47, 0x7C, 0x39, 0x6D, 0x42,
-    0x58, 0x72, 0x15, 0xD9, 0x69, 0x82, 0xB0, 0xCE, 0x95, 0xFD, 0x57, 0x2A, 0xBC, 0x1D, 0x3F, 0x70,
-    0x9F, 0x53, 0xD1, 0x8A, 0xE1, 0xC4, 0x56, 0x9D, 0x02, 0x26, 0x0A, 0x21, 0x7C, 0x87, 0xB5, 0x04,
-    0x2F, 0xB3, 0x70, 0x0C, 0xB6, 0xFC, 0x10, 0x10, 0xBE, 0x35, 0x4B, 0x0C, 0x1C, 0x20, 0x72, 0x94,
-    0xED, 0x18, 0x9D, 0x7B, 0x35, 0x3A, 0x6B, 0x95, 0x5F, 0x43, 0x31, 0xA3, 0x57, 0x2A, 0xCE, 0xC4,
-    0x50, 0xD1, 0x1A, 0xA9, 0x28, 0xE4, 0x0C, 0x2E, 0xD7, 0x26, 0x00, 0x8E, 0x9E, 0xEB, 0xD0, 0xBF,
-    0xDF, 0x48, 0x0E, 0x18, 0x08, 0x43, 0xC6, 0xFF, 0x67, 0xFA, 0xC3, 0x35, 0x83, 0xF6, 0x89, 0x24,
-    0x41, 0x91, 0x68, 0xEB, 0x38, 0x8B, 0x3A, 0x61, 0x6E, 0xB1, 0xE2, 0xF3, 0x8E, 0xC9, 0x6C, 0xE7,
-    0x5A, 0xDC, 0xFF, 0xDF, 0x83, 0x2C, 0x34, 0x9E, 0xB6, 0xA9, 0x13, 0x96, 0x3D, 0x9B, 0xDA, 0xEC,
-    0xA2, 0xF0, 0x32, 0xA1, 0x8F, 0xD2, 0xAC, 0x13, 0xE3, 0xBE, 0x45, 0xCE, 0xCB, 0x7E, 0x7A, 0xD6,
-    0xAD, 0x17, 0x6F, 0x1E, 0x9E, 0x0D, 0xA5, 0x42, 0x54, 0xA5, 0xA6, 0xE7, 0x9F, 0x79, 0x64, 0x36,
-    0x9C, 0x75, 0x54, 0xF1, 0x72, 0x55, 0xE9, 0xEB, 0xCE, 0xE6, 0x0B, 0xEB, 0x85, 0x6C, 0x27, 0x60,
-    0x56, 0xE6, 0x33, 0x1F, 0xCA, 0xFE, 0x28, 0x53, 0x96, 0x94, 0x20, 0xA4, 0x70, 0x62, 0xF8, 0xAE,
-    0xC2, 0xAF, 0x57, 0x1F, 0xBC, 0xD9, 0xB8, 0x6D, 0x00, 0x1C, 0x5C, 0x2A, 0xB2, 0x2B, 0xCB, 0x59,
-    0x96, 0x40, 0x74, 0xB7, 0x91, 0x70, 0x3B, 0x74, 0xD2, 0x67, 0x52, 0x42, 0xD0, 0x99, 0x0F, 0x52,
-    0x87, 0x46, 0x2D, 0x9B, 0xED, 0xE7, 0xCB, 0x3E, 0x5B, 0x4A, 0x94, 0x2C, 0x35, 0x39, 0xDC, 0xC1,
-    0xAE, 0x21, 0x76, 0x6F, 0xFC, 0x17, 0x98, 0xF5, 0x89, 0x29, 0x5B, 0x88, 0xB9, 0xAD, 0xF8, 0xD3,
-    0x33, 0xC3, 0x76, 0xB6, 0x00, 0x22, 0xA9, 0xB9, 0x0C, 0xCA, 0x11, 0x15, 0xBB, 0x92, 0xBE, 0xED,
-    0x63, 0x71, 0xCC, 0xDB, 0x3F, 0x31, 0x33, 0x03, 0x8C, 0x45, 0x32, 0x1E, 0xAD, 0x24, 0x5F, 0x6B,
-    0x94, 0xC4, 0x37, 0x20, 0x04, 0x80, 0x0B, 0x4E, 0xE9, 0x4D, 0x72, 0x25, 0x59, 0x19, 0x5A, 0xE0,
-    0xDC, 0xE4, 0xF1, 0x31, 0x9F, 0x30, 0x0F, 0xE1, 0x7C, 0x7A, 0xCE, 0x27, 0xD4, 0x52, 0x80, 0x4A,
-    0x69, 0x0B, 0xDF, 0xE5, 0x36, 0x59, 0x6B, 0x2A, 0xC4, 0xD0, 0x0D, 0x42, 0x16, 0xCD, 0x53, 0xCF,
-    0x3C, 0x26, 0xDB, 0x29, 0x00, 0x96, 0xBA, 0x72, 0x58, 0x4A, 0xC0, 0xD2, 0xB3, 0xC1, 0x48, 0x3F,
-    0x62, 0xE0, 0x11, 0xE5, 0x9C, 0x1C, 0xAA, 0x4D, 0x59, 0x44, 0x35, 0x6F, 0x6A, 0x62, 0x28, 0xD1,
-    0x6B, 0x3A, 0xE8, 0x9F, 0xE9, 0x74, 0xED, 0xE8, 0x38, 0xF5, 0x07, 0x16, 0x76, 0xC3, 0xDE, 0x7E,
-    0xF1, 0x6D, 0x97, 0x09, 0xEF, 0x97, 0xD2, 0xF4, 0xFB, 0x67, 0xBD, 0xDF, 0x01, 0x10, 0xE7, 0x76,
-    0xFB, 0x9E, 0x1C, 0xAA, 0x79, 0xC2, 0x32, 0xF9, 0x0C, 0x08, 0xE0, 0x3F, 0x58, 0xA8, 0xA6, 0x8B,
-    0x27, 0xB8, 0xF5, 0xF4, 0xED, 0xCB, 0x9D, 0xBB, 0x64, 0x8D, 0x83, 0x28, 0xF6, 0xB0, 0xB5, 0xD8,
-    0x99, 0x24, 0x24, 0x75, 0x81, 0xA3, 0xB4, 0x06, 0x55, 0x3E, 0x64, 0x44, 0xE1, 0x08, 0x1D, 0x3A,
-    0x84, 0xCE, 0x6E, 0xE8, 0x5A, 0xFD, 0x4F, 0xA5, 0xEC, 0x47, 0x26, 0x2C, 0xA9, 0x00, 0xBB, 0xBA,
-    0xFF, 0xE4, 0xC6, 0x86, 0x1D, 0x8D, 0x00, 0x9C, 0x4F, 0xB1, 0x94, 0x14, 0x5A, 0xD5, 0xD7, 0xA6,
-    0x5E, 0xB4, 0xDD, 0x63, 0xB9, 0x19, 0x4B, 0x29, 0x99, 0x99, 0x63, 0xFE, 0xAA, 0x37, 0x65, 0xA1,
-    0xFB, 0xE6, 0x86, 0x81, 0x05, 0xB4, 0x69, 0x66, 0xBA, 0xE3, 0x2D, 0xBA, 0x80, 0xC2, 0xAB, 0x16,
-    0xB4, 0x64, 0xB9, 0xFA, 0x7F, 0x73, 0xF7, 0x97, 0xF5, 0x9B, 0xAC, 0x18, 0xB5, 0xA5, 0x26, 0x9D,
-    0x9B, 0x7B, 0x74, 0xE9, 0x74, 0xA8, 0x5E, 0xBB, 0x0F, 0x44, 0x80, 0xBE, 0x76, 0x27, 0xF1, 0x77,
-    0x8A, 0x6E, 0x86, 0xA6, 0xBB, 0x08, 0x2A, 0x58, 0xC4, 0x22, 0x20, 0x95, 0xC5, 0x1E, 0xFF, 0x52,
-    0xB2, 0x3C, 0x94, 0x16, 0xCC, 0x82, 0x99, 0x2F, 0x3C, 0xFB, 0xB3, 0xF9, 0xFD, 0x73, 0x63, 0x08,
-    0x1A, 0x3F, 0x0D, 0x4E, 0xD7, 0xEA, 0x9D, 0x30, 0x76, 0x79, 0x2F, 0xB5, 0x3F, 0xEB, 0xA4, 0x80,
-    0x88, 0x43, 0x5B, 0xFA, 0x5D, 0xB0, 0xE2, 0x90, 0xF2, 0x2F, 0x89, 0x35, 0x0A, 0x5F, 0xD1, 0x59,
-    0xC5, 0xAD, 0xC0, 0xB1, 0xD4, 0x4D, 0x28, 0x20, 0xC9, 0x03, 0x20, 0xAD, 0xA0, 0x00, 0xF6, 0xAA,
-    0xEC, 0x42, 0x15, 0xF7, 0x6C, 0x95, 0xD6, 0x60, 0xC6, 0x59, 0x2E, 0x91, 0xDA, 0x4D, 0x07, 0x07,
-    0x54, 0xF9, 0x79, 0x80, 0xF0, 0xED, 0xC8, 0x1E, 0xAE, 0xF2, 0x2F, 0xBE, 0x8A, 0xD8, 0x14, 0x3B,
-    0x48, 0x0D, 0xEE, 0xF0, 0x37, 0xCA, 0xD6, 0x92, 0xF1, 0xF7, 0x81, 0xA6, 0x11, 0x4F, 0x1B, 0xAB,
-    0x09, 0x62, 0x0F, 0x7E, 0xF5, 0xDF, 0x28, 0x4F, 0x44, 0xD6, 0xE2, 0x48, 0x0B, 0x61, 0x40, 0xD0,
-    0x3E, 0x06, 0xBC, 0x81, 0xC9, 0xAD, 0x62, 0x25, 0xB5, 0xDD, 0x44, 0x37, 0xB5, 0x14, 0xE6, 0x4C,
-    0x4C, 0xBE, 0x35, 0xC9, 0x65, 0x2B, 0x9D, 0x96, 0xE2, 0x94, 0x84, 0x2F, 0x54, 0xEB, 0x27, 0x85,
-    0x86, 0x47, 0xBC, 0xDC, 0xA9, 0x48, 0x39, 0xAB, 0xE3, 0x6E, 0x70, 0x67, 0xCA, 0xB9, 0x9C, 0xE2,
-    0x9E, 0x89, 0xEB, 0x92, 0x7A, 0xC0, 0x92, 0x09, 0x5C, 0x50, 0x49, 0x90, 0xB2, 0x3C, 0x89, 0xB4,
-    0x08, 0xE3, 0xBD, 0x13, 0xD7, 0x64, 0x4C, 0xF2, 0xEA, 0x2B, 0x5B, 0xEB, 0x5B, 0xEB, 0xDF, 0x20,
-    0xAC, 0x51, 0xE7, 0xCF, 0xB3, 0x00, 0xF9, 0x17, 0xC4, 0x36, 0x97, 0x63, 0xAF, 0xB2, 0x8A, 0x59,
-    0x72, 0x6B, 0xD7, 0x8C, 0xD7, 0xED, 0x36, 0xD2, 0x77, 0x7A, 0xF2, 0x56, 0xD2, 0xB6, 0x35, 0x30,
-    0x46, 0x53, 0xF2, 0x84, 0x66, 0x93, 0x29, 0x9A, 0xE5, 0x1F, 0x4C, 0x0A, 0xBE, 0x18, 0x77, 0x0B,
-    0xF6, 0x4B, 0x9C, 0x14, 0x8C, 0xFB, 0x21, 0xB0, 0x9B, 0xEF, 0x69, 0xFD, 0xE7, 0xF5, 0xAD, 0x37,
-    0xBF, 0x7F, 0x0F, 0x05, 0x7A, 0xBE, 0x79, 0x0C, 0x06, 0x3C, 0x0F, 0x61, 0x74, 0x26, 0x62, 0x6F,
-    0x42, 0xD9, 0xA2, 0x11, 0x6E, 0x97, 0x43, 0xCD, 0x33, 0x53, 0xBE, 0x52, 0x0A, 0x1E, 0x99, 0x6C,
-    0x19, 0x27, 0x91, 0x49, 0x39, 0xB8, 0xD8, 0xED, 0x2C, 0xDF, 0xCE, 0x82, 0xCC, 0x55, 0xE8, 0x9A,
-    0xF2, 0xC3, 0x6F, 0xFA, 0x73, 0xFD, 0xB9, 0x56, 0xC8, 0x16, 0xD2, 0xDC, 0x5E, 0x49, 0x41, 0xB6,
-    0xAF, 0x99, 0xD0, 0x7C, 0xE9, 0x07, 0x93, 0x4D, 0x1A, 0x09, 0x3B, 0x6D, 0x92, 0xCD, 0x1A, 0xFD,
-    0x90, 0xF2, 0x63, 0x91, 0x59, 0xAC, 0x71, 0x45, 0xED, 0x0B, 0x94, 0xFF, 0xEF, 0xA9, 0xFB, 0x49,
-    0x6E, 0x96, 0x6C, 0x65, 0xFA, 0x1A, 0xA0, 0xD0, 0xB9, 0x7E, 0xFA, 0xFD, 0xBB, 0x4B, 0x00, 0x97,
-    0xFD, 0x24, 0x8D, 0xA4, 0xA6, 0x01, 0x18, 0xF4, 0xAE, 0xE4, 0xC1, 0x3A, 0xC1, 0x77, 0x6B, 0x64,
-    0x66, 0x4F, 0xB3, 0x84, 0xFA, 0xAE, 0xE4, 0xE1, 0xF6, 0x18, 0xFC, 0x2F, 0xFD, 0x9B, 0x98, 0xDD,
-    0x3F, 0x24, 0x6F, 0xC4, 0xDF, 0xC1, 0x60, 0x68, 0x08, 0x2B, 0x60, 0xA2, 0xE6, 0x90, 0x44, 0xD1,
-    0x0C, 0xBA, 0x9C, 0x8B, 0xC2, 0xC5, 0xDF, 0x07, 0xE9, 0x6E, 0xEF, 0xE0, 0x45, 0x52, 0x38, 0xF1,
-    0xB1, 0x14, 0x73, 0x94, 0x6B, 0x52, 0x1F, 0x23, 0xD5, 0xCC, 0xF2, 0x62, 0x13, 0xA8, 0x9C, 0x88,
-    0xF1, 0x91, 0x62, 0x57, 0x75, 0xB7, 0x5F, 0xD0, 0x15, 0xE2, 0x2C, 0x4A, 0x25, 0xB1, 0x52, 0x49,
-    0x69, 0x89, 0x96, 0x8D, 0x9E, 0x68, 0xF3, 0x98, 0x96, 0xC8, 0x5A, 0x4B, 0x08, 0x20, 0x4E, 0x59,
-    0xA0, 0xB0, 0x29, 0xEA, 0xD3, 0x36, 0x7B, 0x69, 0x57, 0xF8, 0x0A, 0x17, 0x17, 0x71, 0x88, 0x56,
-    0x45, 0xCD, 0xD5, 0x38, 0x6C, 0x47, 0x9C, 0x59, 0xEA, 0x69, 0x95, 0x35, 0x96, 0xAE, 0xAC, 0x2C,
-    0x5D, 0xEE, 0x89, 0x52, 0x58, 0x94, 0x94, 0xB2, 0x90, 0xEE, 0xF6, 0x4E, 0x43, 0x9E, 0x32, 0xDD,
-    0x51, 0xC2, 0xD6, 0x05, 0x52, 0x56, 0x75, 0x83, 0xF5, 0xA7, 0x4D, 0xD4, 0x8E, 0x55, 0xFD, 0x93,
-    0xC9, 0x11, 0x21, 0x59, 0x67, 0x54, 0x40, 0x8D, 0xA9, 0x81, 0x5B, 0x7F, 0x4C, 0xE5, 0x2A, 0x51,
-    0xB5, 0xD6, 0xA7, 0xB3, 0x58, 0x2D, 0x77, 0x3F, 0x90, 0x86, 0xBB, 0x7C, 0x41, 0x87, 0x10, 0x10,
-    0x22, 0xC9, 0x42, 0x24, 0xEE, 0x70, 0x5B, 0x09, 0x44, 0xF4, 0xE7, 0xC7, 0xCD, 0x8B, 0x90, 0xDD,
-    0x58, 0xBC, 0xA7, 0x4C, 0x35, 0xF6, 0xA3, 0xAC, 0xFD, 0x33, 0x90, 0x64, 0x67, 0xB9, 0xFB, 0xBD,
-    0xA6, 0xE5, 0x58, 0xD8, 0xF9, 0x57, 0xB2, 0xDD, 0xE8, 0xC9, 0x3B, 0x48, 0x27, 0x4C, 0xD5, 0xAF,
-    0xA4, 0x83, 0x24, 0x8E, 0x5C, 0x88, 0x35, 0x44, 0xF5, 0xA5, 0xD2, 0xFF, 0x86, 0x54, 0x75, 0x35,
-    0x07, 0xA5, 0xE8, 0x68, 0x0F, 0x05, 0x75, 0xF8, 0x22, 0xE2, 0x1E, 0xAA, 0x24, 0xF9, 0x36, 0xC6,
-    0xB8, 0x0E, 0xAE, 0x12, 0x14, 0xF6, 0xFB, 0xC9, 0xF0, 0x5E, 0x60, 0x31, 0x0B, 0x75, 0x97, 0xB6,
-    0xAB, 0x65, 0x20, 0xAD, 0xD2, 0x19, 0xE5, 0x55, 0xAF, 0x8F, 0xBB, 0x1E, 0xA6, 0x10, 0xFA, 0xC7,
-    0xA1, 0xF1, 0x51, 0x35, 0x2B, 0x84, 0xB2, 0xB7, 0x44, 0x0C, 0xEA, 0x40, 0x82, 0x3B, 0x47, 0xFC,
-    0xCC, 0xB3, 0xD5, 0xF6, 0x17, 0x51, 0x33, 0xD4, 0xFD, 0x0F, 0x3F, 0x0E, 0x51, 0xB2, 0xEE, 0x34,
-    0xB3, 0xA9, 0x3D, 0xC4, 0x97, 0xB5, 0xAB, 0x7B, 0x48, 0x63, 0xF3, 0x05, 0xF1, 0x4C, 0x22, 0x11,
-    0x05, 0x56, 0xA3, 0x05, 0xDF, 0x04, 0x15, 0x4D, 0x04, 0x2B, 0x28, 0x4D, 0xBC, 0x5D, 0xAB, 0xE1,
-    0xCD, 0xA8, 0xF9, 0x5A, 0x6B, 0x81, 0x17, 0xB8, 0x89, 0xCD, 0xEF, 0x84, 0xE2, 0x12, 0x48, 0xE4,
-    0xDA, 0x97, 0x2A, 0x3A, 0x79, 0xF7, 0x58, 0x5E, 0xAF, 0x58, 0x7C, 0x91, 0xF7, 0x5E, 0x0A, 0x36,
-    0xE4, 0xFA, 0x49, 0x09, 0xC5, 0x22, 0x09, 0xA3, 0x19, 0x83, 0x07, 0x15, 0x7D, 0x99, 0x49, 0xE7,
-    0xB0, 0x4A, 0x83, 0xEE, 0xFD, 0xC1, 0x45, 0xB1, 0xB8, 0x6F, 0x89, 0xFE, 0x84, 0x25, 0x01, 0x0C,
-    0xA9, 0xDE, 0xB1, 0xE3, 0xF0, 0x12, 0x77, 0xE8, 0x2B, 0x76, 0x78, 0x81, 0x70, 0xC5, 0x8F, 0x49,
-    0xF4, 0xFD, 0xFB, 0x16, 0x56, 0xF3, 0x4C, 0xA3, 0x32, 0x38, 0xD7, 0x14, 0x74, 0x3A, 0xD8, 0xA8,
-    0xB5, 0x3B, 0xA3, 0xB4, 0x9C, 0xDA, 0x86, 0xE8, 0xB9, 0x8D, 0x18, 0x51, 0x3F, 0x6B, 0x2A, 0x82,
-    0x13, 0x5A, 0x80, 0x57, 0x20, 0xD3, 0xAC, 0x47, 0xBD, 0xFF, 0xDC, 0xD7, 0x4F, 0xDB, 0xED, 0xEA,
-    0x0F, 0xBE, 0x72, 0x3E, 0xDB, 0x61, 0xF2, 0x36, 0xE3, 0xED, 0x0A, 0x4E, 0xAF, 0xBE, 0x07, 0x32,
-    0x19, 0x8A, 0x4C, 0x5E, 0x98, 0x6D, 0x65, 0x19, 0xF8, 0x7E, 0x4A, 0x62, 0x51, 0x99, 0x8C, 0xC9,
-    0xAF, 0x67, 0x8B, 0x1E, 0x2C, 0x99, 0xF9, 0xB0, 0x7C, 0x14, 0xCA, 0x21, 0x70, 0xF7, 0xDF, 0x1F,
-    0x5C, 0x86, 0xBC, 0xD5, 0xC0, 0x9F, 0x9F, 0xAB, 0xC7, 0xD5, 0xEE, 0xA8, 0xC2, 0xBC, 0x07, 0xA1,
-    0x23, 0x88, 0x12, 0x3C, 0x95, 0xEE, 0x99, 0x3F, 0x8A, 0x04, 0xD5, 0xF6, 0xB2, 0xE7, 0x1A, 0xF0,
-    0xED, 0x30, 0x42, 0xCB, 0x50, 0x5E, 0x87, 0xD3, 0xA6, 0xEA, 0x34, 0xE6, 0x3F, 0x00, 0x60, 0x72,
-    0x2B, 0xB5, 0x6F, 0x56, 0x9C, 0x69, 0x98, 0x3B, 0x37, 0x2A, 0x2E, 0x21, 0xC8, 0x9D, 0xAB, 0xB5,
-    0x24, 0x78, 0x0A, 0xF7, 0x62, 0x63, 0xC9, 0x4B, 0x38, 0xFE, 0xBB, 0x2D, 0x37, 0x16, 0xDC, 0xCA,
-    0x4F, 0x3B, 0x02, 0x42, 0x07, 0xC6, 0x6D, 0x83, 0x1B, 0x63, 0x76, 0x13, 0xAA, 0xC4, 0x95, 0x5D,
-    0x91, 0x55, 0x15, 0x99, 0xF7, 0xA0, 0x4F, 0xAA, 0xF0, 0x79, 0x9E, 0x74, 0xE7, 0x55, 0xF0, 0x1E,
-    0x57, 0x7C, 0x0A, 0xCC, 0xFC, 0x58, 0x26, 0x5B, 0x9B, 0x57, 0xE2, 0x18, 0x34, 0x9A, 0xD2, 0x98,
-    0xA0, 0x1C, 0xF6, 0x76, 0xFC, 0x11, 0xF0, 0xED, 0x28, 0x88, 0x1F, 0xE0, 0xF9, 0xF0, 0xBE, 0xC7,
-    0x08, 0x94, 0x95, 0xF3, 0x8D, 0xF9, 0x5F, 0x06, 0xF2, 0x2E, 0xA2, 0xB2, 0x6B, 0x43, 0xF0, 0x27,
-    0x6E, 0x7D, 0x83, 0xDF, 0x85, 0xC0, 0x56, 0x96, 0x6E, 0xE0, 0xA0, 0x4F, 0xAA, 0xA4, 0x87, 0x34,
-    0x48, 0x89, 0xBA, 0xBC, 0x53, 0xC8, 0x9A, 0x71, 0xB7, 0x03, 0x90, 0x73, 0x2B, 0x5B, 0xA7, 0x10,
-    0xBF, 0x56, 0xDD, 0xAC, 0x1C, 0x72, 0xFC, 0xB7, 0xDC, 0xFE, 0x74, 0xAB, 0x30, 0xE0, 0x56, 0x49,
-    0xEB, 0x3F, 0x57, 0xC1, 0xD1, 0x84, 0xFF, 0x94, 0x5F, 0x80, 0x49, 0x77, 0x3F, 0x2D, 0x83, 0xD7,
-    0x98, 0x90, 0xA9, 0x9D, 0x6B, 0x34, 0x32, 0xE7, 0xD5, 0x46, 0x25, 0xAF, 0x99, 0x06, 0x52, 0x32,
-    0x16, 0x4B, 0xAD, 0xB1, 0x14, 0xEA, 0xDD, 0xF2, 0xF2, 0xD5, 0xF6, 0x7F, 0x5F, 0x88, 0x04, 0x2E,
-    0xF2, 0x35, 0xE8, 0x81, 0xC3, 0x6F, 0x13, 0xC4, 0xCF, 0xD9, 0x4F, 0xCD, 0xFA, 0x9F, 0x2B, 0x52,
-    0x01, 0xCE, 0xF2, 0xBE, 0xB0, 0x60, 0xC4, 0x25, 0x90, 0x03, 0xB1, 0x04, 0xCB, 0x14, 0x89, 0x72,
-    0xB9, 0xF1, 0xE5, 0x9B, 0xCC, 0x75, 0xCE, 0x62, 0x73, 0x66, 0x71, 0x31, 0x4C, 0xB8, 0xFD, 0x8F,
-    0x1D, 0x8C, 0x3F, 0xEA, 0x6E, 0x2D, 0x5C, 0xDE, 0xBD, 0x9E, 0xF9, 0xC8, 0xF8, 0xAF, 0x24, 0x1C,
-    0xF3, 0x6F, 0x25, 0xF6, 0x8D, 0x75, 0x7A, 0xB6, 0x79, 0x09, 0x84, 0xE6, 0xE7, 0x32, 0xF3, 0x3E,
-    0x87, 0x6B, 0x96, 0xB7, 0x37, 0x8C, 0x61, 0xF7, 0x2F, 0xBC, 0x5E, 0x96, 0x66, 0x3D, 0x0F, 0x9D,
-    0xC7, 0x6A, 0x66, 0x79, 0x81, 0x9F, 0xBB, 0x81, 0xD4, 0xF8, 0x80, 0x7B, 0x7C, 0xF2, 0x32, 0xE3,
-    0x29, 0x2A, 0xFC, 0x79, 0xDA, 0xC4, 0x86, 0x3E, 0x84, 0x8B, 0xB8, 0x8A, 0x4E, 0xDD, 0xCF, 0x40,
-    0x4E, 0xE7, 0x66, 0x3E, 0x3A, 0x13, 0x21, 0xD4, 0xC6, 0xA8, 0xE1, 0x56, 0x33, 0x2B, 0x9A, 0x2F,
-    0x87, 0x77, 0xE9, 0x33, 0x3D, 0xEE, 0xBB, 0x3E, 0x3A, 0xF7, 0x2E, 0x85, 0x14, 0x4A, 0xD9, 0xBD,
-    0xCB, 0x84, 0x59, 0xC3, 0x7B, 0xFD, 0x34, 0xDC, 0x45, 0x6F, 0x32, 0x5D, 0xF9, 0x52, 0xD1, 0x16,
-    0xE9, 0x77, 0xB3, 0x82, 0x56, 0x22, 0x11, 0xB5, 0xD1, 0x1C, 0x09, 0xC4, 0x66, 0x81, 0x7C, 0x6B,
-    0x5E, 0x90, 0xE7, 0xA8, 0x5E, 0xC5, 0x42, 0x2D, 0xBF, 0x94, 0x8D, 0xC4, 0x2B, 0xB2, 0xEF, 0xBB,
-    0xB1, 0xFD, 0x2F, 0x10, 0x44, 0xAF, 0x77, 0xAB, 0x0F, 0xDF, 0xD9, 0xFC, 0xBF, 0x33, 0x38, 0x3B,
-    0xBC, 0x18, 0x28, 0x19, 0xE0, 0x43, 0x83, 0x94, 0xFB, 0xDD, 0x90, 0xFD, 0x65, 0xF2, 0x77, 0x69,
-    0x51, 0x1C, 0x74, 0x0D, 0x67, 0xA1, 0x2F, 0xE9, 0xE9, 0x3A, 0x5F, 0x8E, 0xC8, 0x20, 0xEF, 0x41,
-    0x71, 0x08, 0x93, 0xB3, 0x52, 0x53, 0xC6, 0x55, 0xCC, 0xD5, 0x2C, 0x32, 0x08, 0x92, 0xE2, 0xE7,
-    0x85, 0x8B, 0xDE, 0x14, 0x2A, 0x3C, 0x86, 0xA5, 0x3A, 0x7F, 0xC0, 0xC5, 0x0A, 0x73, 0x53, 0x1F,
-    0x6D, 0x4D, 0xA7, 0x2D, 0x13, 0xF7, 0x97, 0xC7, 0x1A, 0x2C, 0x81, 0x8A, 0x12, 0xF2, 0xF9, 0xA6,
-    0x18, 0x71, 0x4C, 0xCE, 0x57, 0x3B, 0xDC, 0x67, 0x0F, 0xD4, 0xDB, 0xAE, 0x4E, 0x4E, 0x7C, 0x52,
-    0x29, 0xED, 0x22, 0x16, 0x7D, 0x60, 0xCC, 0x06, 0xD3, 0x7C, 0xB7, 0x32, 0xB0, 0xA4, 0x09, 0x4A,
-    0x55, 0xF4, 0xCA, 0x7B, 0xB5, 0x52, 0x2B, 0xC9, 0xE4, 0x57, 0x37, 0x86, 0x68, 0xD6, 0x28, 0x38,
-    0x03, 0xA8, 0x84, 0xF3, 0x6B, 0x87, 0x13, 0x6B, 0xC7, 0x4B, 0x05, 0x52, 0xB0, 0xFE, 0x1C, 0x13,
-    0xF8, 0xD1, 0xD6, 0x54, 0x5F, 0x62, 0x45, 0xFA, 0x0A, 0x7A, 0x75, 0x58, 0x5E, 0xFA, 0x88, 0x4C,
-    0x50, 0x84, 0x9B, 0x1B, 0x2C, 0x72, 0xD1, 0x0E, 0xEF, 0x53, 0x2C, 0x5E, 0x94, 0xB2, 0x69, 0x60,
-    0xE5, 0x60, 0xD3, 0x0A, 0x0D, 0xCE, 0x55, 0x7C, 0x73, 0x21, 0x9B, 0x4E, 0xD7, 0x39, 0x13, 0xA9,
-    0x57, 0x32, 0x01, 0x9B, 0x67, 0x76, 0x9E, 0xB8, 0x99, 0x43, 0x8A, 0x59, 0x3B, 0x0C, 0xAD, 0x2E,
-    0xC9, 0x81, 0xCF, 0x27, 0x3D, 0x02, 0xE1, 0xEA, 0x37, 0x20, 0xCD, 0x99, 0x61, 0x67, 0x42, 0x1C,
-    0xBC, 0xC8, 0x8B, 0xB0, 0xB1, 0x57, 0x7F, 0x8D, 0x21, 0xDF, 0xC9, 0x94, 0xF3, 0xE1, 0xF5, 0x49,
-    0x92, 0x70, 0xA3, 0x40, 0x0F, 0x86, 0x9D, 0x99, 0xDB, 0x15, 0x18, 0x1C, 0x87, 0x79, 0x5B, 0x49,
-    0xDB, 0x4A, 0xD6, 0x56, 0x5E, 0xD1, 0xAF, 0x7E, 0x24, 0x7E, 0xDB, 0x6A, 0x39, 0x5E, 0x85, 0x52,
-    0x5E, 0xD8, 0x4E, 0xCC, 0x5A, 0x3B, 0x13, 0xB3, 0x7B, 0xC3, 0x6F, 0xEA, 0x29, 0x37, 0xCB, 0xFD,
-    0x9B, 0x1A, 0xCA, 0x0F, 0x7F, 0xA1, 0x7E, 0x22, 0x0A, 0x7E, 0x61, 0xB0, 0x32, 0x3F, 0xF0, 0x8F,
-    0xAF, 0x7B, 0xD0, 0x1D, 0xFE, 0x1F, 0x65, 0x91, 0xB1, 0x6E, 0x14, 0x31, 0x10, 0x86, 0xFF, 0xF5,
-    0x1E, 0x31, 0x92, 0x91, 0xF6, 0x8A, 0x8D, 0xC4, 0xD1, 0x2C, 0x45, 0xCA, 0xE8, 0xDC, 0x52, 0xEC,
-    0xDD, 0x6C, 0x72, 0x12, 0x79, 0x81, 0xD0, 0x53, 0x50, 0x40, 0x47, 0x49, 0x71, 0x89, 0x57, 0xE4,
-    0x05, 0x52, 0xF0, 0x00, 0x14, 0x54, 0x34, 0xB4, 0x57, 0x2C, 0x3A, 0x1F, 0x57, 0xA4, 0xB5, 0xC4,
-    0x0B, 0x58, 0x94, 0xA9, 0x5C, 0xAC, 0x14, 0x17, 0xDE, 0x33, 0xBE, 0x13, 0x48, 0x48, 0x4C, 0x37,
-    0x9E, 0x7F, 0x3C, 0x33, 0xDF, 0x0F, 0x7C, 0xE6, 0x56, 0x1A, 0xD2, 0xA4, 0x65, 0x5B, 0x01, 0x30,
-    0xC2, 0xA8, 0x85, 0x97, 0x1B, 0xCF, 0xDB, 0x94, 0x8D, 0x80, 0x35, 0x10, 0x75, 0x1E, 0xAD, 0xF8,
-    0xD9, 0x17, 0x6D, 0x20, 0x2C, 0x9F, 0xA2, 0xCC, 0x80, 0xCA, 0xD5, 0x14, 0x96, 0x73, 0x15, 0xEA,
-    0xCA, 0x8F, 0xD8, 0xED, 0xB3, 0xAF, 0x5F, 0x28, 0x06, 0x15, 0x03, 0x0E, 0x51, 0xE3, 0x09, 0xA1,
-    0xA6, 0x7B, 0x5F, 0x44, 0x97, 0xC5, 0xA6, 0x5A, 0x04, 0xDA, 0x86, 0x47, 0x38, 0x46, 0xA9, 0xCE,
-    0x86, 0xF5, 0xC7, 0x9D, 0xCA, 0x86, 0x11, 0xC6, 0xD9, 0x25, 0x62, 0x4F, 0xDF, 0xB6, 0xE6, 0x7B,
-    0xCD, 0x0D, 0x02, 0x14, 0xA8, 0xC9, 0xEC, 0x7E, 0x28, 0xA0, 0x6C, 0x15, 0x6F, 0x6C, 0x57, 0xF3,
-    0xAD, 0xA9, 0x49, 0x6C, 0x62, 0x2F, 0x86, 0xFD, 0x73, 0x5B, 0x32, 0x37, 0xCF, 0x9D, 0x12, 0x76,
-    0x28, 0x7E, 0x78, 0x99, 0xBB, 0x9A, 0x6B, 0x64, 0x28, 0x71, 0xB2, 0x44, 0x20, 0xD6, 0x57, 0x77,
-    0x56, 0x44, 0xCD, 0x22, 0x70, 0x90, 0x97, 0x0C, 0x5D, 0xD1, 0x0E, 0x85, 0x4E, 0x0D, 0xF2, 0xC6,
-    0x15, 0xDA, 0xE7, 0xA6, 0x46, 0x93, 0x0A, 0x60, 0xD1, 0x54, 0xD1, 0xD3, 0xCB, 0xF0, 0x02, 0xDD,
-    0x73, 0x9C, 0xB0, 0xB6, 0xAB, 0x16, 0xEE, 0x5A, 0xD8, 0x35, 0x0F, 0x55, 0x3B, 0xE1, 0x9E, 0x74,
-    0x48, 0x72, 0x99, 0xDB, 0x15, 0x70, 0x74, 0x3E, 0xD0, 0xD6, 0x11, 0x73, 0x45, 0xDB, 0x31, 0x0B,
-    0xCC, 0x88, 0x66, 0xCB, 0x0F, 0xEF, 0xC7, 0xA2, 0x09, 0x85, 0x09, 0x74, 0x61, 0x5E, 0xA7, 0x59,
-    0xCC, 0xA7, 0x1B, 0x65, 0x8B, 0x29, 0x56, 0xEB, 0xB3, 0xDD, 0xFA, 0x7C, 0x47, 0x38, 0xD0, 0x68,
-    0xAA, 0x7E, 0xDE, 0xAD, 0xA6, 0xAB, 0xE9, 0xD5, 0x95, 0xF4, 0x47, 0x0D, 0x72, 0x2F, 0xD3, 0xD7,
-    0x9B, 0x7E, 0xCE, 0x9A, 0x11, 0x0F, 0xCA, 0x11, 0xB7, 0x41, 0xB1, 0x06, 0x63, 0xAE, 0x25, 0xE6,
-    0xB8, 0x86, 0xFA, 0x44, 0x03, 0xF7, 0x79, 0x4C, 0x71, 0x8F, 0x49, 0xC2, 0xDF, 0x64, 0xD1, 0xE4,
-    0x0F, 0x69, 0xFB, 0x3D, 0xFE, 0xC4, 0xAD, 0xC4, 0xE3, 0x19, 0x4E, 0xA9, 0xED, 0x64, 0xC2, 0x12,
-    0x0D, 0xDE, 0x21, 0x6B, 0xFE, 0x31, 0xA4, 0xF0, 0xA3, 0xEC, 0xF6, 0xF8, 0xD5, 0x25, 0xC5, 0xE1,
-    0x8F, 0x21, 0xFF, 0x5D, 0x0B, 0x68, 0x30, 0x87, 0xDC, 0x41, 0x58, 0x14, 0x1A, 0x12, 0x38, 0xDD,
-    0x0B, 0x27, 0x78, 0xB3, 0xDF, 0xFD, 0xAF, 0x41, 0x6F, 0x85, 0xEE, 0x84, 0x55, 0xBF, 0xFC, 0x6F,
-    0xE5, 0x7D, 0x3F, 0xB0, 0xDD, 0xD6, 0x99, 0xDF, 0xC1, 0x85, 0x49, 0xAC, 0x8D, 0xF1, 0x42, 0x85,
-    0xB8, 0xF2, 0x9A, 0x6B, 0xC3, 0x85, 0x8A, 0x8C, 0x62, 0x11, 0x5B, 0xB8, 0x50, 0x21, 0x12, 0x90,
-    0x34, 0x1E, 0x17, 0x5B, 0xF8, 0x15, 0xBA, 0xD2, 0xC4, 0x2C, 0x98, 0x22, 0x29, 0x56, 0x3B, 0x09,
-    0xB7, 0x70, 0xA1, 0xCC, 0x90, 0x04, 0x64, 0x65, 0xE2, 0xC2, 0x33, 0x59, 0x16, 0xE2, 0xEE, 0x4C,
-    0x1A, 0x37, 0xF6, 0xC4, 0xBE, 0x9C, 0xE4, 0x39, 0x19, 0x17, 0x4A, 0x86, 0x7C, 0x80, 0xA8, 0x71,
-    0x54, 0xB0, 0x30, 0x24, 0xC7, 0xE3, 0x62, 0x0B, 0xC3, 0xBB, 0xF2, 0x7A, 0x2C, 0x17, 0x84, 0xE5,
-    0x4B, 0x1B, 0xEF, 0x09, 0xC0, 0xC9, 0xEF, 0xF7, 0x3B, 0xB8, 0xF7, 0x5D, 0x3E, 0x92, 0x12, 0x25,
-    0x53, 0x22, 0xBD, 0xB9, 0xE4, 0x3B, 0xEF, 0xE2, 0xE0, 0xDF, 0x39, 0xDF, 0xF9, 0xCE, 0xF7, 0xFD,
-    0xBE, 0x3F, 0xE7, 0x3C, 0x63, 0xF8, 0x59, 0xE2, 0x27, 0xE8, 0x50, 0x44, 0x3D, 0x8B, 0x11, 0xC5,
-    0x8C, 0xDF, 0xCC, 0x03, 0x66, 0xFD, 0xF1, 0x2C, 0x3E, 0xDF, 0xC0, 0xCF, 0x78, 0xC8, 0x2E, 0x2E,
-    0xF6, 0x38, 0xEF, 0xB7, 0x61, 0x6B, 0xC2, 0x22, 0xA9, 0xCC, 0x67, 0x4C, 0xB9, 0xBA, 0x05, 0x55,
-    0xC6, 0xA0, 0xCA, 0x98, 0xD2, 0xDA, 0x6A, 0x86, 0xCB, 0x4D, 0xB8, 0xB7, 0xF8, 0xD6, 0x54, 0xB5,
-    0x79, 0x55, 0x86, 0xAA, 0x30, 0x43, 0xD5, 0x09, 0x54, 0x79, 0xCB, 0xF0, 0xFA, 0x73, 0xDB, 0x3F,
-    0xE1, 0x3B, 0x12, 0xFC, 0xE8, 0xE5, 0x66, 0xB6, 0x0C, 0x1A, 0x13, 0xB7, 0x69, 0x65, 0xF2, 0xCA,
-    0x1A, 0x73, 0xD9, 0x5B, 0x9A, 0x1B, 0x3F, 0x39, 0x2E, 0xFD, 0x07, 0xDE, 0xF3, 0x42, 0xFE, 0xD6,
-    0xC2, 0xF2, 0xF1, 0x6C, 0xD7, 0xAC, 0xC1, 0xE3, 0x83, 0xEC, 0xE6, 0x37, 0x1A, 0x3C, 0xBA, 0x65,
-    0xBB, 0x8A, 0xD9, 0xB8, 0xF8, 0xEE, 0x66, 0x53, 0xA7, 0xAB, 0x1E, 0x40, 0xD5, 0xAC, 0x46, 0x55,
-    0x54, 0xA0, 0xEA, 0xEC, 0x6C, 0xF8, 0xCA, 0xC5, 0xEB, 0x7C, 0xFC, 0x55, 0x16, 0x7A, 0x9B, 0xE5,
-    0x33, 0xD0, 0xB1, 0x70, 0x6F, 0x7B, 0x6F, 0xBB, 0x9D, 0xB5, 0xFE, 0xD2, 0x74, 0xE6, 0x92, 0x19,
-    0xCC, 0x09, 0x73, 0xCC, 0xA4, 0x59, 0x94, 0x05, 0x59, 0x54, 0x7B, 0x99, 0x31, 0xBE, 0x6B, 0xEB,
-    0xA0, 0x32, 0xFD, 0xE2, 0xD3, 0xA4, 0xAB, 0xB5, 0x6F, 0xE2, 0x04, 0x6E, 0x2F, 0x8C, 0x19, 0x9F,
-    0x28, 0x41, 0xF0, 0x34, 0xF3, 0x6C, 0x66, 0xA2, 0xDA, 0xC4, 0x0D, 0xEF, 0xF0, 0x7B, 0xDD, 0x91,
-    0xF3, 0x84, 0x89, 0x6B, 0x9E, 0x60, 0x2D, 0x1E, 0x05, 0x0A, 0x8D, 0x19, 0x4E, 0x84, 0x76, 0x30,
-    0x71, 0x15, 0x58, 0x9B, 0x85, 0x0D, 0x9F, 0xEC, 0x5E, 0xE3, 0x06, 0xCB, 0xD3, 0xCB, 0x66, 0x1C,
-    0x3D, 0xEF, 0x24, 0x4B, 0x63, 0x55, 0x73, 0xF8, 0x5B, 0x6A, 0x04, 0x1A, 0x65, 0x5A, 0x77, 0x95,
-    0x8F, 0x97, 0x06, 0xF8, 0xF1, 0x77, 0x51, 0xB7, 0xB5, 0x4F, 0xCF, 0x18, 0x6D, 0x7B, 0x87, 0xE4,
-    0x3F, 0xB5, 0xB7, 0x6D, 0xF1, 0xD0, 0x18, 0x64, 0xF0, 0x1B, 0xD0, 0x63, 0x09, 0xC2, 0x1C, 0x47,
-    0xC5, 0x61, 0x91, 0x8A, 0x34, 0x23, 0xF1, 0xF4, 0xDA, 0x3B, 0xA8, 0xE0, 0xCB, 0x40, 0x73, 0x6B,
-    0x9B, 0xE9, 0x3D, 0xF8, 0x9A, 0xF1, 0x65, 0x4B, 0x53, 0xFE, 0xFC, 0xF4, 0x72, 0x36, 0x70, 0xA4,
-    0x97, 0xE0, 0x81, 0x08, 0x17, 0x2C, 0x63, 0xDC, 0xDB, 0x26, 0x20, 0xD1, 0x56, 0xCA, 0x26, 0xAB,
-    0xC8, 0x17, 0x65, 0x4D, 0xFA, 0xAB, 0x28, 0x48, 0x20, 0xD4, 0xE9, 0x6C, 0xC1, 0x82, 0x63, 0x98,
-    0xD4, 0xC6, 0x3C, 0x16, 0xE3, 0x9D, 0x67, 0x43, 0x10, 0x6B, 0xF0, 0xED, 0xF9, 0xA3, 0x3D, 0xC7,
-    0x7A, 0xC9, 0x17, 0xE1, 0xAA, 0xF9, 0xD4, 0xCF, 0xC4, 0xD6, 0x78, 0x7D, 0x1F, 0x0C, 0x27, 0x7B,
-    0x90, 0xB7, 0xC7, 0xDB, 0x7A, 0xBC, 0xAC, 0x43, 0x8B, 0xBF, 0x97, 0xE0, 0xF5, 0x11, 0x46, 0x25,
-    0x44, 0xEB, 0x66, 0xB8, 0x11, 0x2F, 0x63, 0xD3, 0x51, 0x9B, 0xB3, 0xB6, 0xFF, 0x98, 0x99, 0x0D,
-    0x8F, 0x63, 0x84, 0xCE, 0xE2, 0xE7, 0x9C, 0xF1, 0xFA, 0x1C, 0x03, 0x96, 0xD7, 0x71, 0xCB, 0x86,
-    0xC5, 0x60, 0x74, 0xF3, 0x95, 0xF3, 0xB8, 0xE5, 0x6D, 0xB2, 0x63, 0x0D, 0x32, 0xA0, 0xF3, 0xA0,
-    0x01, 0x1E, 0x7C, 0x27, 0x5F, 0x07, 0x4F, 0x6C, 0x26, 0x6E, 0xC9, 0x2E, 0xE7, 0x2F, 0x58, 0xFC,
-    0x4F, 0xCC, 0xE5, 0x8D, 0xA1, 0xE9, 0x13, 0xDB, 0x1D, 0x42, 0x83, 0x4A, 0xF3, 0xFE, 0xFF, 0x67,
-    0xBA, 0xBD, 0x47, 0xC7, 0xAB, 0xD4, 0x76, 0xE6, 0xD4, 0x52, 0xD5, 0x1C, 0xA1, 0xDF, 0xE3, 0x17,
-    0x47, 0x0B, 0xCC, 0x04, 0x0A, 0xFA, 0x20, 0x0F, 0x9A, 0x8E, 0x31, 0x4A, 0x31, 0x8C, 0xDF, 0x72,
-    0x33, 0xCD, 0x52, 0xA0, 0x70, 0xB2, 0x60, 0x60, 0x0C, 0x18, 0x4A, 0x9C, 0x9A, 0x18, 0x8E, 0xAC,
-    0xC1, 0x94, 0xD9, 0x11, 0x23, 0xB4, 0x33, 0x5E, 0x65, 0xC2, 0xCA, 0xB1, 0x73, 0x3A, 0x9D, 0xEE,
-    0xDC, 0x69, 0xBF, 0x99, 0x8D, 0x17, 0x38, 0x73, 0x8A, 0x50, 0xCC, 0x73, 0xD6, 0xCD, 0x60, 0xAF,
-    0xC5, 0xE9, 0xD3, 0x90, 0x3D, 0x15, 0xEE, 0xC6, 0x34, 0x49, 0x0D, 0xEE, 0x4E, 0x2B, 0x88, 0x07,
-    0xDC, 0x5D, 0xA2, 0x1A, 0xA7, 0x41, 0xDB, 0xD4, 0xE0, 0x74, 0xD8, 0xCE, 0x96, 0x3A, 0xFD, 0x9F,
-    0x41, 0xE7, 0xA4, 0xC0, 0x80, 0x81, 0x25, 0xED, 0xBC, 0x7C, 0x03, 0xCD, 0x02, 0x77, 0x0C, 0xC1,
-    0xC0, 0x19, 0x39, 0x66, 0x87, 0xB3, 0x95, 0x48, 0x69, 0x22, 0x0E, 0x65, 0x69, 0xEB, 0x88, 0xD3,
-    0xE7, 0xA1, 0xC1, 0x78, 0x79, 0xE1, 0x38, 0x99, 0xAC, 0xF8, 0xBE, 0x7F, 0x93, 0x02, 0x76, 0x77,
-    0xFA, 0x0D, 0xDE, 0x1B, 0xE6, 0xF3, 0xFC, 0x6F, 0xCB, 0xCE, 0x9D, 0xF7, 0xFB, 0xE9, 0xBA, 0x61,
-    0xFA, 0x3D, 0xDE, 0xFA, 0xB7, 0x37, 0x9D, 0x0F, 0x7A, 0x4C, 0x16, 0x93, 0x5E, 0xC8, 0xC1, 0x73,
-    0x6D, 0x40, 0x41, 0x54, 0xDA, 0x36, 0xE2, 0xF3, 0x37, 0x45, 0xA2, 0x75, 0x6F, 0x03, 0x77, 0x49,
-    0x4A, 0x81, 0xE8, 0x90, 0x4C, 0xC5, 0x24, 0xA6, 0x66, 0x0D, 0x64, 0xC6, 0xD2, 0xAC, 0xE4, 0x94,
-    0x9B, 0x5F, 0x2B, 0x41, 0xE5, 0x2F, 0x0F, 0x6D, 0x39, 0x49, 0xC5, 0x89, 0x9B, 0x5A, 0x09, 0x10,
-    0xFB, 0x12, 0x66, 0x12, 0x25, 0x0D, 0xE6, 0x28, 0x45, 0x12, 0xC7, 0x1D, 0x77, 0x71, 0xEA, 0x0D,
-    0x62, 0x04, 0x9C, 0x62, 0xF3, 0x70, 0x8A, 0x9C, 0x81, 0x53, 0x20, 0xB5, 0x07, 0x1A, 0x92, 0x59,
-    0x6D, 0x85, 0x09, 0x87, 0x96, 0x7A, 0x9C, 0xF2, 0xAB, 0xCF, 0xE3, 0x1A, 0x73, 0x31, 0x84, 0xE5,
-    0xDC, 0x8D, 0xF5, 0x76, 0x89, 0x2C, 0xEF, 0x46, 0x09, 0x8F, 0xDB, 0x2A, 0xBF, 0x0B, 0x31, 0x22,
-    0x69, 0x0B, 0xE6, 0x9F, 0x41, 0xA5, 0x40, 0x2C, 0xFD, 0x98, 0x2F, 0xEA, 0x29, 0x66, 0x82, 0x9A,
-    0x2D, 0x38, 0x41, 0x7A, 0x83, 0x2B, 0x50, 0x8D, 0x7E, 0xA2, 0xFA, 0x92, 0xF4, 0x4F, 0x2D, 0xF2,
-    0x4B, 0x14, 0xA5, 0xAA, 0xCE, 0x25, 0x9E, 0xAC, 0xAE, 0x1E, 0x58, 0x3D, 0xD3, 0x43, 0x28, 0x76,
-    0xC1, 0x36, 0x1D, 0x7B, 0x11, 0x2D, 0xD9, 0xB0, 0x68, 0x89, 0x26, 0x9B, 0x78, 0x89, 0x39, 0x63,
-    0x62, 0x71, 0xE8, 0xE1, 0x75, 0xEB, 0x43, 0xF7, 0x4D, 0x53, 0xD5, 0x44, 0x8E, 0x6E, 0x49, 0xE7,
-    0x26, 0xA9, 0x13, 0x70, 0x1F, 0x3B, 0xA0, 0xA6, 0x02, 0x34, 0x1F, 0x13, 0x10, 0x0D, 0xF2, 0x9C,
-    0x6C, 0xF0, 0xCA, 0x8C, 0x6F, 0x0E, 0x34, 0xF9, 0xF1, 0x24, 0x0D, 0xAE, 0x0E, 0x22, 0x1D, 0xF8,
-    0xEF, 0xE8, 0x60, 0xC8, 0xC5, 0xC6, 0x5F, 0xE2, 0x41, 0x54, 0xF3, 0xC0, 0x5F, 0xEA, 0x9E, 0xC1,
-    0xF0, 0x00, 0xEC, 0x80, 0x83, 0x1F, 0xD6, 0x3C, 0x80, 0xB4, 0xE2, 0xC1, 0x68, 0x74, 0x50, 0xE8,
-    0xA0, 0xD1, 0xC1, 0xF4, 0x1E, 0xD2, 0x29, 0x03, 0x73, 0x83, 0x2C, 0x57, 0x5D, 0x73, 0xCC, 0xAC,
-    0xF2, 0x70, 0x49, 0x58, 0x63, 0x82, 0x80, 0x14, 0xB8, 0x08, 0x33, 0xA1, 0x6C, 0x44, 0xB9, 0x6C,
-    0xA5, 0x30, 0x6E, 0x50, 0xB6, 0xAD, 0x6F, 0xC7, 0x92, 0xE5, 0x10, 0x0E, 0x14, 0xB8, 0xE4, 0xC5,
-    0x24, 0xE3, 0xB8, 0xA5, 0x52, 0x5A, 0x97, 0x25, 0x8F, 0x7B, 0x8A, 0x04, 0xAA, 0xEA, 0xA8, 0xF1,
-    0x5B, 0xBE, 0x9C, 0x63, 0xE4, 0x77, 0x11, 0x7A, 0xEA, 0xF5, 0x31, 0x1F, 0x3A, 0x26, 0x7A, 0xDE,
-    0x59, 0xCD, 0x78, 0xA9, 0xAE, 0x48, 0xBC, 0x20, 0x85, 0x6C, 0x78, 0x39, 0x6A, 0xC8, 0x17, 0x7F,
-    0xAE, 0x0B, 0xCF, 0x49, 0x16, 0x94, 0x22, 0x71, 0x2E, 0x0A, 0x7F, 0x7A, 0x9A, 0xA9, 0x01, 0xD1,
-    0xC2, 0x72, 0xE6, 0x88, 0x8A, 0x99, 0xEA, 0x04, 0x93, 0x1B, 0xD4, 0x49, 0x50, 0xE1, 0x8B, 0x13,
-    0xB3, 0x77, 0xF9, 0xC4, 0x78, 0xE1, 0x99, 0xB2, 0x8E, 0xED, 0x1A, 0x1D, 0xD8, 0x76, 0xD2, 0x43,
-    0xC6, 0x49, 0x32, 0xCF, 0x71, 0xC4, 0x59, 0xC7, 0x25, 0x22, 0xA5, 0xAF, 0xD3, 0xE6, 0x7B, 0xE6,
-    0xA6, 0xCF, 0x19, 0x47, 0x60, 0x89, 0xBE, 0x54, 0x44, 0x70, 0x33, 0x22, 0xBC, 0xC6, 0x2A, 0xFF,
-    0x17, 0xAD, 0x44, 0xA5, 0xAA, 0x3A, 0x01, 0x96, 0xB3, 0x1C, 0x2D, 0x50, 0x7D, 0x94, 0x70, 0x94,
-    0xB6, 0xAD, 0x08, 0x05, 0x40, 0x70, 0x54, 0x79, 0xE3, 0xA2, 0xAC, 0x24, 0x7B, 0xA9, 0xC3, 0x16,
-    0x8B, 0x51, 0xC3, 0x44, 0xEE, 0xAA, 0x38, 0x57, 0xC3, 0x9A, 0x3C, 0xC7, 0xB1, 0xC1, 0x38, 0x91,
-    0x3D, 0xBA, 0x00, 0x17, 0x26, 0xF6, 0x37, 0xC4, 0x16, 0xB6, 0xA7, 0x04, 0xB9, 0xC2, 0x1E, 0x79,
-    0xF9, 0x5B, 0xDB, 0x9D, 0x21, 0x02, 0xE0, 0xBC, 0xC8, 0xD0, 0xF1, 0xCF, 0x1F, 0x84, 0x71, 0xD7,
-    0xB7, 0x24, 0xEA, 0xCF, 0x53, 0x94, 0xE2, 0x2A, 0xAF, 0x6C, 0x44, 0x27, 0x5C, 0x95, 0x12, 0x41,
-    0x51, 0x7A, 0xCD, 0x3A, 0x54, 0x45, 0x04, 0x11, 0x39, 0xC0, 0x1E, 0x05, 0xD8, 0xDC, 0xBE, 0x42,
-    0xE9, 0x14, 0x12, 0x1B, 0x4E, 0x9F, 0x07, 0x30, 0x25, 0xA0, 0xA5, 0x43, 0x4A, 0xC8, 0x43, 0x00,
-    0x72, 0x9C, 0xE5, 0x79, 0x11, 0x52, 0xCE, 0x27, 0x6C, 0x23, 0x6E, 0x64, 0x23, 0x92, 0x4C, 0xF3,
-    0x3E, 0xA9, 0x42, 0x09, 0x6F, 0x89, 0x39, 0x54, 0x3D, 0x63, 0x09, 0xF6, 0x88, 0xFF, 0x3C, 0xE1,
-    0x52, 0xA2, 0x95, 0x88, 0x30, 0x2E, 0xD5, 0x10, 0xF2, 0xC6, 0x26, 0xBC, 0x7E, 0xD2, 0x52, 0x60,
-    0x36, 0x89, 0x53, 0x4C, 0x93, 0xA8, 0xBC, 0x86, 0x9F, 0x5F, 0xE7, 0x6F, 0x95, 0x3D, 0x6E, 0x39,
-    0xC7, 0x6E, 0x12, 0xF1, 0xD4, 0x13, 0xE2, 0xF9, 0xD4, 0x9D, 0x02, 0x9C, 0xCD, 0x0A, 0x6A, 0x44,
-    0x82, 0x5E, 0x81, 0x0E, 0x87, 0x65, 0x9D, 0x32, 0x3C, 0x54, 0x2E, 0x58, 0x75, 0x46, 0xE8, 0xC5,
-    0x95, 0x97, 0x36, 0xCA, 0x5E, 0x65, 0xA7, 0x72, 0xC9, 0xD2, 0x53, 0x39, 0x6B, 0x59, 0xFA, 0xAE,
-    0x6C, 0x58, 0x06, 0x9C, 0xF0, 0x54, 0x72, 0x39, 0xC7, 0x9E, 0x65, 0x9C, 0x09, 0x32, 0x6A, 0x0E,
-    0xEE, 0xB0, 0x3C, 0x3C, 0xCE, 0xBF, 0x52, 0x6E, 0xA5, 0x1C, 0xC4, 0x41, 0xE5, 0x28, 0x29, 0x3F,
-    0x4C, 0x25, 0x3B, 0xDF, 0x6B, 0x6A, 0x5D, 0x52, 0x79, 0xE6, 0xB3, 0x2C, 0x1F, 0xFB, 0x23, 0x96,
-    0x0F, 0x7F, 0xB4, 0x98, 0x7A, 0xFD, 0x19, 0xF0, 0xA0, 0x25, 0xCA, 0x1C, 0x6A, 0xB7, 0x87, 0x56,
-    0x88, 0x7B, 0x4A, 0xD3, 0xB2, 0x99, 0x9D, 0x2E, 0xC0, 0xB2, 0xF9, 0xD3, 0x80, 0x88, 0x38, 0x9B,
-    0x8A, 0xEB, 0xD3, 0x8C, 0x62, 0xC4, 0xAF, 0xA3, 0x9A, 0xD2, 0xDE, 0x5C, 0xC2, 0x80, 0x57, 0x9A,
-    0x65, 0x83, 0x4F, 0xD9, 0xE1, 0xB5, 0xE9, 0x93, 0x9A, 0x44, 0xA9, 0x26, 0x80, 0x83, 0xB5, 0x9A,
-    0x86, 0xF5, 0x10, 0xD5, 0x9A, 0xA1, 0xE9, 0x13, 0x6C, 0x7F, 0xD0, 0x46, 0x35, 0x15, 0x83, 0xDF,
-    0xF9, 0xC4, 0x9F, 0x6C, 0xEE, 0xC0, 0x76, 0x43, 0x77, 0x41, 0x61, 0xB6, 0x9C, 0x25, 0x51, 0x3D,
-    0x93, 0x22, 0x43, 0x1B, 0xD2, 0xDA, 0x60, 0xFC, 0xC6, 0x0C, 0x88, 0x01, 0xF8, 0x1F, 0x73, 0xA5,
-    0xAC, 0xA1, 0x9B, 0xC0, 0x80, 0xC1, 0xF8, 0x69, 0x27, 0x2A, 0xFF, 0xD4, 0x98, 0x43, 0x4F, 0x4B,
-    0x50, 0xD2, 0x58, 0xCA, 0xF2, 0xF3, 0x49, 0x9B, 0x64, 0xDE, 0x88, 0xC6, 0xA5, 0x5F, 0x03, 0x5A,
-    0x69, 0x9E, 0x17, 0x50, 0x92, 0xAA, 0x25, 0x75, 0x72, 0x4A, 0x5A, 0xB6, 0x0E, 0x98, 0xE9, 0x22,
-    0x45, 0x2E, 0xD1, 0x2B, 0xF5, 0xA6, 0x54, 0x6B, 0xF4, 0x36, 0x26, 0xEB, 0x2E, 0x4E, 0x0D, 0xB8,
-    0xC6, 0x26, 0x4B, 0xCF, 0x3E, 0xC5, 0x87, 0x0A, 0x67, 0x7E, 0xFA, 0x25, 0x89, 0x3F, 0x41, 0x46,
-    0xCE, 0xD9, 0x0E, 0xB2, 0xCF, 0x1C, 0x5D, 0x8A, 0xF0, 0x4E, 0xE4, 0x47, 0x12, 0x57, 0xBE, 0x53,
-    0x2D, 0x56, 0x07, 0xA9, 0xC4, 0x59, 0xF4, 0x13, 0x1E, 0xF8, 0x4B, 0x5D, 0x36, 0x48, 0x9B, 0xA4,
-    0x19, 0x0F, 0xA2, 0x9A, 0x07, 0xAF, 0x2E, 0xF5, 0x80, 0x41, 0x3A, 0xC3, 0x66, 0xD2, 0x26, 0x8D,
-    0x0E, 0x3A, 0x3D, 0x7A, 0x5C, 0x6B, 0xAD, 0x5C, 0xAC, 0x1E, 0x2E, 0x03, 0x31, 0x3B, 0x94, 0x1B,
-    0x9B, 0x03, 0x09, 0x59, 0xD3, 0xC8, 0x30, 0xE7, 0x60, 0x3B, 0x10, 0x18, 0xA8, 0xC3, 0xC9, 0x3B,
-    0xD6, 0xCD, 0xB7, 0xE2, 0x56, 0xDA, 0xF1, 0x7E, 0xED, 0xC9, 0xFD, 0x06, 0x3F, 0x9C, 0x2C, 0x49,
-    0x9D, 0x2C, 0xB1, 0x92, 0x25, 0x97, 0x6E, 0x92, 0x22, 0x37, 0xCB, 0x92, 0x8D, 0xD2, 0x49, 0x14,
-    0xAF, 0x3D, 0x28, 0x57, 0x6E, 0x90, 0x28, 0x2A, 0x13, 0xD2, 0xEB, 0xB1, 0x92, 0xB4, 0x21, 0x5E,
-    0x2E, 0xB3, 0x72, 0x29, 0xD5, 0x00, 0xAC, 0x6D, 0xFB, 0x3F, 0x75, 0x30, 0x88, 0x1A, 0xAF, 0x1C,
-    0xC4, 0xC2, 0x11, 0x7A, 0x99, 0x83, 0x55, 0xD1, 0x65, 0x1F, 0xED, 0x4A, 0xD1, 0xE4, 0x13, 0x90,
-    0xC3, 0xD7, 0x30, 0x6E, 0x80, 0x27, 0x67, 0xF0, 0x84, 0x33, 0x3B, 0x26, 0xFA, 0x9B, 0xCA, 0x04,
-    0xAF, 0xB5, 0x66, 0x89, 0xC3, 0x4B, 0x00, 0xFA, 0x78, 0x53, 0x78, 0xA5, 0xF3, 0x1B, 0x50, 0xE2,
-    0x52, 0x5C, 0x3D, 0x0E, 0x91, 0x1E, 0x15, 0x7D, 0x58, 0x01, 0x44, 0x74, 0x61, 0xDD, 0x41, 0x8B,
-    0x46, 0x45, 0x1A, 0x81, 0x91, 0xCC, 0xD2, 0x7F, 0xBB, 0x0D, 0x70, 0x98, 0x25, 0x67, 0xD1, 0x1E,
-    0x74, 0x02, 0x63, 0xD2, 0x42, 0xE8, 0xC1, 0x54, 0x4B, 0xD5, 0x8F, 0xCC, 0x27, 0xC6, 0x45, 0x91,
-    0x52, 0xBD, 0x1D, 0xC3, 0x2C, 0x0B, 0x88, 0x5F, 0x03, 0x8E, 0xA5, 0xF4, 0x60, 0x45, 0xE0, 0x73,
-    0x7B, 0x16, 0xDB, 0xE7, 0x83, 0xDB, 0x1F, 0x38, 0x15, 0x9F, 0x38, 0x74, 0x3D, 0x2E, 0x16, 0x17,
-    0xDB, 0xF7, 0xF9, 0x80, 0x89, 0xC5, 0xAC, 0x63, 0xB1, 0xD6, 0xB1, 0x98, 0xD0, 0xF6, 0x8C, 0x0A,
-    0x94, 0x42, 0x8A, 0x94, 0x7E, 0xF3, 0xA8, 0x15, 0x6F, 0xDA, 0x8A, 0x0E, 0x99, 0xB4, 0xA1, 0x18,
-    0x8A, 0x5A, 0x18, 0x39, 0xB8, 0x9B, 0xF8, 0x22, 0xE8, 0x24, 0xB1, 0x7A, 0x8A, 0x72, 0x18, 0x33,
-    0xB2, 0x34, 0x0E, 0x96, 0xA8, 0x97, 0x54, 0xE3, 0xF5, 0xFE, 0x32, 0xE5, 0xBD, 0x2D, 0x65, 0x4B,
-    0xD4, 0x10, 0x67, 0x81, 0x6B, 0x09, 0xDB, 0xC1, 0xCC, 0x75, 0x30, 0x4A, 0x0B, 0x12, 0xFF, 0x49,
-    0x5D, 0xD1, 0x80, 0x75, 0x16, 0x84, 0x3D, 0xAD, 0xF2, 0x95, 0x7C, 0x6F, 0x71, 0x71, 0x9C, 0x60,
-    0xFD, 0x84, 0xF1, 0x1D, 0xE0, 0x67, 0xAF, 0x86, 0x0F, 0xE1, 0x04, 0xD5, 0xE7, 0x9B, 0x44, 0xA7,
-    0xA5, 0xCC, 0xE1, 0xD4, 0x4A, 0x92, 0x1F, 0xA6, 0x89, 0x56, 0x0A, 0x93, 0x54, 0xA7, 0xA9, 0x8F,
-    0x52, 0x6A, 0x14, 0xC2, 0x0B, 0x21, 0x8B, 0x9D, 0xD5, 0x17, 0x9A, 0x49, 0x31, 0xE0, 0x47, 0xB0,
-    0x9C, 0x0D, 0x27, 0x47, 0x0E, 0x17, 0xBA, 0x39, 0x0A, 0xFB, 0x38, 0x95, 0x75, 0x8B, 0x2F, 0x35,
-    0xBB, 0xBC, 0x24, 0x05, 0x56, 0x80, 0xF7, 0x30, 0x6E, 0xF1, 0x88, 0x4E, 0xE2, 0xDD, 0x93, 0x3D,
-    0x04, 0xB2, 0xDF, 0xD2, 0xEA, 0xA9, 0x40, 0xAC, 0x13, 0xC4, 0x5D, 0xDF, 0x97, 0x7E, 0x1B, 0x57,
-    0xDE, 0x17, 0x8E, 0x8D, 0xE6, 0x98, 0x27, 0x9D, 0xB2, 0xAE, 0x92, 0x6B, 0xC2, 0xAE, 0x3C, 0x32,
-    0xFE, 0x68, 0x9C, 0x63, 0xE1, 0xC1, 0xD0, 0xEE, 0x6D, 0x37, 0xE1, 0x64, 0xA5, 0x01, 0x2B, 0x1E,
-    0xD9, 0x72, 0x24, 0x17, 0x6F, 0x5D, 0xA5, 0xC5, 0xF6, 0x36, 0x05, 0xC3, 0xA5, 0x4B, 0x20, 0x4F,
-    0x72, 0x8C, 0xC3, 0xF5, 0x1A, 0x30, 0x8E, 0x57, 0x4F, 0x5E, 0x9E, 0xD2, 0xAC, 0x34, 0xAC, 0x74,
-    0xED, 0xFB, 0xAD, 0x64, 0x27, 0xD5, 0xD5, 0xC0, 0x79, 0x53, 0xEE, 0x2F, 0x4C, 0x6F, 0xCC, 0x62,
-    0x51, 0x48, 0xEC, 0x92, 0x78, 0x27, 0xF5, 0x84, 0x40, 0xA7, 0x4F, 0x5E, 0x77, 0x58, 0x83, 0x96,
-    0xF4, 0xB5, 0x77, 0xA0, 0x80, 0xBB, 0xA0, 0x89, 0xDB, 0xA4, 0x0E, 0x1A, 0xCC, 0x85, 0x22, 0x68,
-    0x3C, 0x18, 0x4B, 0xB8, 0x72, 0x24, 0x52, 0x34, 0x76, 0xA3, 0x1C, 0xF3, 0x0C, 0xE5, 0x90, 0x56,
-    0xBC, 0x32, 0x86, 0x20, 0x09, 0x97, 0xE1, 0x18, 0x34, 0x79, 0xED, 0x39, 0x00, 0x72, 0xD4, 0xB9,
-    0xA5, 0x1C, 0x6A, 0x77, 0xEF, 0x8A, 0x77, 0xDD, 0xAC, 0x64, 0x4B, 0x16, 0x0B, 0xBE, 0xB6, 0xF7,
-    0xE5, 0x7E, 0xF1, 0x6D, 0x77, 0x98, 0xAA, 0x04, 0x76, 0x6D, 0x41, 0xA4, 0x95, 0xD6, 0x9E, 0x34,
-    0x94, 0x68, 0x42, 0x77, 0x12, 0xA6, 0x79, 0x42, 0x6A, 0xD8, 0x73, 0xFB, 0x74, 0x48, 0xDA, 0x7D,
-    0x6A, 0xB8, 0x9A, 0x1D, 0x2B, 0x03, 0xA1, 0xE4, 0x54, 0xA5, 0x77, 0x13, 0x84, 0xE1, 0x34, 0x4F,
-    0x8A, 0x40, 0xAA, 0xC9, 0x1F, 0x28, 0xC1, 0xC1, 0x3A, 0x3C, 0x2C, 0xEB, 0x9C, 0x68, 0x03, 0x63,
-    0x54, 0x45, 0x76, 0xBC, 0x6F, 0x6C, 0x9E, 0xBF, 0x57, 0xB9, 0xDC, 0x77, 0x3B, 0x0A, 0x9A, 0x4D,
-    0x43, 0x2C, 0xDB, 0x02, 0x9F, 0x97, 0x55, 0x7E, 0xD6, 0xB9, 0xFC, 0x32, 0x4C, 0x65, 0xFC, 0x07,
-    0x55, 0xF1, 0xFF, 0x74, 0x6D, 0x4E, 0x4B, 0xE9, 0xE4, 0x9C, 0x35, 0xF8, 0x8F, 0x79, 0x85, 0xFF,
-    0x71, 0xC5, 0xFF, 0xAA, 0x86, 0x44, 0x40, 0x35, 0xE0, 0x03, 0xAA, 0x41, 0x3B, 0x9E, 0xD9, 0x9D,
-    0x5B, 0xB1, 0x40, 0x2F, 0x61, 0xC9, 0x57, 0x64, 0xB1, 0x5E, 0x27, 0x77, 0xA0, 0x66, 0x9F, 0x09,
-    0x9C, 0xF5, 0xB4, 0x5F, 0x4D, 0x7E, 0x9E, 0xD4, 0x70, 0x24, 0x1F, 0x6E, 0x0D, 0x4A, 0x5A, 0xBB,
-    0xCD, 0xC6, 0x34, 0xB9, 0x7D, 0x3D, 0xAF, 0xBC, 0xB2, 0xF0, 0xE4, 0x4E, 0x8D, 0xE8, 0x20, 0x9A,
-    0x75, 0x6C, 0x3D, 0x8E, 0x76, 0x38, 0x08, 0x38, 0x4A, 0x0A, 0x76, 0x6D, 0xC7, 0x7C, 0x94, 0x17,
-    0x8C, 0xDF, 0x7E, 0x76, 0xF7, 0x99, 0xED, 0xA5, 0x23, 0xB5, 0xB5, 0xBF, 0x9A, 0x7E, 0x77, 0xAB,
-    0xD6, 0x7F, 0xC3, 0xF6, 0x91, 0xED, 0x00, 0x1C, 0x1F, 0xEA, 0xCD, 0xD1, 0x0E, 0x40, 0x61, 0xFD,
-    0x88, 0xF5, 0xB3, 0xEF, 0x75, 0xC5, 0xD4, 0x85, 0x60, 0x6A, 0x7A, 0x5F, 0x4E, 0x5F, 0xAA, 0xC9,
-    0xAF, 0xD3, 0xAF, 0xFC, 0x9A, 0x53, 0x85, 0x59, 0x55, 0x08, 0xD2, 0x3B, 0x1F, 0xE0, 0x0D, 0xFE,
-    0x16, 0x63, 0x3E, 0x97, 0x3B, 0x15, 0x29, 0x03, 0x0E, 0xC6, 0x54, 0x46, 0xB8, 0x53, 0x9A, 0x55,
-    0xF9, 0xB2, 0xCA, 0xAF, 0x3A, 0xB1, 0x77, 0x63, 0xF9, 0xED, 0x4C, 0x80, 0x6C, 0x74, 0x51, 0x09,
-    0x61, 0xB6, 0x44, 0x2C, 0x4D, 0x78, 0xEA, 0x38, 0xBE, 0x54, 0x93, 0x4A, 0xB5, 0x63, 0xF5, 0x7D,
-    0x02, 0x66, 0x74, 0x96, 0xCE, 0xCB, 0x86, 0xFC, 0x63, 0x05, 0xC3, 0xDE, 0xDC, 0xF7, 0x88, 0x90,
-    0xB5, 0xB6, 0xD9, 0x1E, 0x0B, 0x56, 0xC2, 0x83, 0x0F, 0xD1, 0x1E, 0x95, 0xF0, 0x97, 0xB8, 0x8D,
-    0x1A, 0x35, 0x01, 0xAF, 0x99, 0x74, 0xC6, 0xC1, 0x93, 0x68, 0x19, 0x4F, 0x52, 0xD6, 0xC8, 0x66,
-    0x1C, 0xDC, 0xC9, 0xB2, 0xD2, 0x9D, 0x30, 0x4C, 0x3A, 0x37, 0x17, 0x75, 0x67, 0x5C, 0xE9, 0x24,
-    0xCC, 0x96, 0x46, 0x6D, 0x74, 0x27, 0x47, 0x77, 0xB2, 0xCC, 0x70, 0x72, 0x78, 0xC6, 0x16, 0x91,
-    0xF8, 0x26, 0xCB, 0xC9, 0x36, 0xBB, 0x26, 0x5D, 0x59, 0xBB, 0xAB, 0xD6, 0x16, 0xC6, 0x63, 0x43,
-    0x6F, 0x19, 0xB1, 0x59, 0x57, 0xED, 0xCD, 0x35, 0xD3, 0x64, 0x65, 0x53, 0x19, 0xE5, 0x1F, 0xD0,
-    0xAE, 0xE7, 0x48, 0x97, 0x40, 0x37, 0x11, 0x7B, 0x06, 0x6D, 0x0A, 0xFB, 0x05, 0x16, 0x6B, 0x0D,
-    0x8D, 0x11, 0xB7, 0x31, 0x21, 0x4D, 0x64, 0x44, 0x65, 0xF7, 0x5A, 0x49, 0x12, 0x8F, 0x18, 0x0D,
-    0x57, 0x47, 0x7C, 0xCC, 0x27, 0x16, 0x8B, 0x61, 0x7D, 0x62, 0x7D, 0x9D, 0xDF, 0x7D, 0x46, 0xA0,
-    0x9A, 0x24, 0x04, 0xD2, 0xC9, 0xAB, 0x74, 0x79, 0xD8, 0x3A, 0xC9, 0x70, 0x58, 0x58, 0xEA, 0xC8,
-    0xD3, 0x9B, 0x31, 0x0D, 0x00, 0x6B, 0x3C, 0x2F, 0xD4, 0x0F, 0x44, 0xD6, 0x29, 0xE0, 0xEB, 0x01,
-    0x2D, 0x71, 0x68, 0x1B, 0x7C, 0xA0, 0x21, 0x9E, 0x59, 0x22, 0x71, 0x42, 0xAE, 0xCA, 0xE1, 0xF2,
-    0x80, 0x2E, 0xDA, 0x51, 0x2A, 0xBC, 0x94, 0x93, 0x94, 0xDD, 0x8F, 0x85, 0xE6, 0x43, 0x49, 0x1F,
-    0x6F, 0x98, 0x39, 0x37, 0x29, 0xFA, 0xBF, 0xB0, 0x62, 0x65, 0x51, 0x08, 0xE3, 0x13, 0xB6, 0xCE,
-    0x9C, 0x9C, 0xF5, 0x32, 0xE7, 0x46, 0x3E, 0x81, 0x28, 0x10, 0xF6, 0x33, 0xB9, 0x89, 0xAF, 0x20,
-    0x32, 0x88, 0x6B, 0xBA, 0x26, 0x5A, 0x19, 0xBA, 0x99, 0x6F, 0xCF, 0x9F, 0x6E, 0x68, 0x82, 0xA4,
-    0x74, 0xA5, 0x60, 0x9C, 0x26, 0x25, 0x88, 0x17, 0xCD, 0xF5, 0x4B, 0x8A, 0x2A, 0x11, 0x69, 0xC6,
-    0x67, 0x07, 0x0A, 0x36, 0x4E, 0xB6, 0x6C, 0x26, 0x11, 0x29, 0xC7, 0xB7, 0xDC, 0xDD, 0xEB, 0xAF,
-    0xBE, 0xA4, 0x42, 0xD2, 0xD0, 0xC3, 0x5E, 0xEE, 0x41, 0x61, 0x79, 0x9A, 0x38, 0x0E, 0xE9, 0x0D,
-    0x33, 0x75, 0x15, 0x17, 0x00, 0x2A, 0xC9, 0x7B, 0xCF, 0x87, 0xD1, 0x9F, 0x1E, 0x52, 0x1E, 0x81,
-    0x1A, 0xD0, 0x42, 0x65, 0x85, 0xF6, 0xA4, 0x44, 0xCE, 0x3F, 0x3B, 0xAF, 0x26, 0x10, 0xAE, 0x86,
-    0xB4, 0xA2, 0x30, 0x8F, 0xE5, 0x92, 0x4E, 0x8B, 0x88, 0xEE, 0xC3, 0x1D, 0x73, 0xC8, 0x29, 0x50,
-    0x48, 0x34, 0xEF, 0x54, 0x83, 0xA6, 0x8E, 0x18, 0xBF, 0x6B, 0x0D, 0x9E, 0xB1, 0x23, 0xEF, 0x7C,
-    0x40, 0x4F, 0x4E, 0x4E, 0xF4, 0x30, 0x04, 0xF6, 0xA5, 0xC4, 0xFE, 0xCE, 0x56, 0xE5, 0x00, 0x48,
-    0xFA, 0xB4, 0x8B, 0x30, 0xD2, 0xE9, 0xFB, 0x2C, 0x99, 0x8D, 0xB0, 0x18, 0x34, 0x3B, 0xD9, 0x49,
-    0x1C, 0x5C, 0x9E, 0xD4, 0x0A, 0x4D, 0x49, 0x5A, 0xF8, 0x7E, 0x0B, 0xC0, 0x30, 0x82, 0x2D, 0xF3,
-    0xDD, 0x93, 0x43, 0xD2, 0x98, 0xFC, 0x2A, 0xB4, 0xC6, 0x6F, 0xD1, 0xFA, 0x11, 0xEF, 0x4D, 0x60,
-    0x6D, 0x84, 0xBF, 0x03, 0x8B, 0x0F, 0x9C, 0xB5, 0xF4, 0x4F, 0xFF, 0x0D, 0xF8, 0xF3, 0x75, 0x2A,
-    0xC8, 0x14, 0xDC, 0xEB, 0x5B, 0xF9, 0xB8, 0xD0, 0xC8, 0xE7, 0x9C, 0x3C, 0x29, 0x1D, 0xA2, 0x44,
-    0xD3, 0xC2, 0xCE, 0x6F, 0x31, 0x99, 0x60, 0xD2, 0xE1, 0x87, 0xDF, 0x71, 0xF1, 0x3B, 0x0D, 0x6E,
-    0x80, 0x5E, 0x7F, 0x88, 0x75, 0x23, 0x7E, 0xCE, 0x4D, 0x3F, 0x83, 0xDF, 0x06, 0x3D, 0x7D, 0x1E,
-    0xE5, 0x34, 0x3C, 0xF8, 0xFD, 0x36, 0xE5, 0x5A, 0x7E, 0xA1, 0x84, 0xCE, 0xBA, 0xE4, 0x2F, 0x3D,
-    0xA0, 0x45, 0xBF, 0x48, 0xB3, 0x3F, 0xA2, 0xA1, 0xEF, 0x3B, 0x97, 0xB9, 0x18, 0x68, 0xF3, 0xB0,
-    0xA0, 0x19, 0xC0, 0x0E, 0xCB, 0x4D, 0x37, 0xC8, 0xAC, 0x33, 0xDE, 0xCE, 0x33, 0x84, 0x13, 0xB4,
-    0x79, 0x82, 0x0A, 0x9D, 0xF6, 0x68, 0xF6, 0x98, 0x33, 0x74, 0x25, 0x1E, 0x63, 0x65, 0xC4, 0xD9,
-    0xE3, 0xD3, 0xBA, 0xF5, 0x5A, 0xCE, 0x86, 0x97, 0xA9, 0xE2, 0x8E, 0x53, 0x84, 0x26, 0xE2, 0x81,
-    0xF3, 0x87, 0x07, 0x05, 0x5C, 0x7A, 0xF9, 0x7C, 0xA8, 0x8A, 0xA3, 0x57, 0xE9, 0xD5, 0x6D, 0x49,
-    0xCC, 0xFE, 0x18, 0x8A, 0x63, 0x01, 0xDA, 0x11, 0x3C, 0xC1, 0xC9, 0x5E, 0x1B, 0x6F, 0x0B, 0x2C,
-    0xC1, 0x57, 0x0F, 0x90, 0x33, 0x7D, 0x5C, 0xF8, 0xB0, 0xCC, 0xC2, 0x7F, 0x04, 0x3B, 0x7E, 0xF3,
-    0xC7, 0xF3, 0x1D, 0x74, 0x6B, 0x8F, 0x7A, 0xBE, 0x31, 0x0A, 0xC9, 0xE4, 0xCE, 0x6F, 0x41, 0x68,
-    0x12, 0xD8, 0x0B, 0xFF, 0x8E, 0x33, 0x80, 0x41, 0x48, 0x33, 0xCF, 0x30, 0xF4, 0xE4, 0x0C, 0x30,
-    0x77, 0x8E, 0x99, 0xE2, 0xD9, 0x27, 0x6C, 0x17, 0xF6, 0x1E, 0xEC, 0x46, 0x73, 0x6E, 0x0B, 0x96,
-    0x31, 0x0C, 0x3C, 0x74, 0xC1, 0x6F, 0x88, 0xFA, 0x5E, 0x8E, 0x0A, 0x22, 0x86, 0xF6, 0x04, 0x07,
-    0x73, 0xB6, 0x37, 0x5E, 0x76, 0xA1, 0x06, 0x0A, 0xA8, 0x9D, 0xD8, 0xB5, 0x54, 0x00, 0x3B, 0xCD,
-    0x3A, 0x10, 0x09, 0x43, 0xD2, 0xA0, 0x6B, 0x74, 0xF2, 0x80, 0x5C, 0x16, 0xCF, 0xA2, 0x53, 0x26,
-    0xB4, 0x45, 0x5E, 0x58, 0x5A, 0x9D, 0xE5, 0x0B, 0x8A, 0xE8, 0x3D, 0x88, 0xE9, 0x0E, 0x48, 0xC6,
-    0x38, 0x83, 0xF5, 0x9B, 0xB0, 0xFB, 0x02, 0xDB, 0x4B, 0x92, 0x25, 0x82, 0x73, 0x65, 0x2F, 0x4B,
-    0xD5, 0xA3, 0x43, 0x94, 0xC4, 0x7D, 0x23, 0x33, 0xC3, 0x25, 0x13, 0xFD, 0xB0, 0x09, 0xA0, 0x4D,
-    0x47, 0x45, 0x25, 0xE6, 0xF2, 0x78, 0x97, 0x30, 0x79, 0xF0, 0x8C, 0x2A, 0xA7, 0xE9, 0x4B, 0x35,
-    0x4C, 0x23, 0x33, 0x91, 0xBB, 0x91, 0xA1, 0xA4, 0x84, 0x95, 0x69, 0x8C, 0xCA, 0x14, 0x4D, 0xEC,
-    0x53, 0xD0, 0x3F, 0x3D, 0xC7, 0x2B, 0x61, 0x25, 0x54, 0x00, 0xF7, 0x01, 0x3D, 0xAF, 0xAC, 0x24,
-    0xAD, 0x60, 0x16, 0xDB, 0x41, 0xCF, 0xCC, 0xCC, 0xA3, 0x18, 0x3B, 0x70, 0x30, 0x5D, 0xAF, 0xC2,
-    0x89, 0xF6, 0x59, 0x4D, 0x42, 0x76, 0xFA, 0xC8, 0xD6, 0xA6, 0x1B, 0xE4, 0x43, 0x6C, 0x03, 0xC6,
-    0x87, 0x22, 0x70, 0x04, 0x25, 0x22, 0xBA, 0x1E, 0x76, 0xB6, 0x7C, 0x22, 0xF8, 0xA8, 0x3A, 0x01,
-    0x62, 0xD3, 0x71, 0xD1, 0x47, 0xD0, 0x43, 0x7B, 0xA4, 0x8F, 0xFC, 0xD8, 0x5F, 0x52, 0x55, 0x4D,
-    0xC3, 0x87, 0x4E, 0x63, 0x79, 0x52, 0x65, 0x05, 0x40, 0x82, 0xE1, 0x89, 0x4F, 0xD2, 0xF9, 0x55,
-    0x88, 0xF6, 0x04, 0xD1, 0xBD, 0x27, 0x9F, 0xC4, 0xD1, 0x1F, 0x43, 0x16, 0x07, 0x15, 0x38, 0x7D,
-    0xBF, 0x08, 0x31, 0x0F, 0x68, 0xC7, 0xA3, 0xC8, 0x58, 0x28, 0xAE, 0xAD, 0x08, 0x11, 0x8B, 0xE3,
-    0x28, 0x3E, 0x77, 0x09, 0x45, 0xBE, 0xC4, 0xE3, 0xF3, 0x76, 0x66, 0xFB, 0x1C, 0x58, 0xB7, 0x3F,
-    0xB2, 0x82, 0xCA, 0x79, 0x97, 0xD2, 0x14, 0x5E, 0xFA, 0x98, 0x1B, 0xB6, 0xF0, 0xAF, 0x65, 0xFC,
-    0xFF, 0xD3, 0x2A, 0xF8, 0x69, 0xE6, 0xFF, 0xA4, 0x8E, 0x4E, 0x65, 0xFE, 0x8F, 0xDA, 0x28, 0xCE,
-    0xFC, 0x37, 0x96, 0x8F, 0xA2, 0xAC, 0xBB, 0xC7, 0x59, 0x5E, 0xFA, 0x3E, 0xCB, 0xB4, 0x65, 0x99,
-    0x34, 0x2C, 0xE3, 0x8A, 0x65, 0x54, 0xA0, 0x6C, 0x0E, 0x61, 0x28, 0x12, 0x3E, 0x0D, 0x80, 0xC4,
-    0xF8, 0x2C, 0x41, 0xA0, 0x6D, 0x5B, 0xA7, 0x10, 0x2A, 0x85, 0x57, 0x2A, 0x14, 0x4F, 0x4F, 0x3A,
-    0x48, 0x29, 0x00, 0x9A, 0x6A, 0x24, 0xF6, 0x16, 0x25, 0x3D, 0x7D, 0xA0, 0xCD, 0x38, 0x7F, 0x66,
-    0x55, 0x79, 0xF0, 0x4A, 0x8A, 0xDD, 0x12, 0x1C, 0x05, 0xA8, 0x5E, 0x94, 0x54, 0xB3, 0x4F, 0x1B,
-    0x29, 0x1E, 0x8A, 0x34, 0xC6, 0x5E, 0x1A, 0xD0, 0xD2, 0x3E, 0xD9, 0xD1, 0x2E, 0x07, 0x73, 0xBE,
-    0x06, 0x9E, 0xEC, 0xA1, 0x4A, 0xE3, 0xAB, 0xA4, 0x35, 0xA3, 0xA9, 0x57, 0x59, 0x83, 0x91, 0x8F,
-    0x5F, 0xED, 0x9C, 0xD5, 0x9E, 0x1B, 0x5B, 0x24, 0x8C, 0x9D, 0x41, 0x61, 0x91, 0x5F, 0x0E, 0xBF,
-    0x24, 0x69, 0x33, 0xD9, 0xE6, 0x45, 0x7E, 0x61, 0x3E, 0xB2, 0x15, 0x09, 0x1D, 0xA4, 0x90, 0xBE,
-    0x03, 0x85, 0x3E, 0x9A, 0xB6, 0x73, 0x87, 0x95, 0x44, 0x1C, 0x6C, 0x2F, 0x68, 0x50, 0xC8, 0xF6,
-    0x85, 0x3C, 0x38, 0xFD, 0x0A, 0x66, 0x2F, 0x9E, 0xDF, 0x1F, 0xB5, 0xBB, 0xA7, 0x3B, 0x68, 0x81,
-    0x88, 0x39, 0x1E, 0x71, 0x4D, 0xE5, 0x50, 0x40, 0xC8, 0x96, 0x33, 0x7A, 0xA9, 0xF0, 0x88, 0x90,
-    0x11, 0xFA, 0x84, 0x55, 0xA3, 0x54, 0x0D, 0xAA, 0x62, 0x6A, 0x13, 0x30, 0x06, 0xD4, 0x98, 0x4B,
-    0xFB, 0xA0, 0x80, 0x54, 0x38, 0x97, 0xB6, 0x9E, 0xE2, 0xBC, 0xD2, 0x11, 0xAC, 0x9A, 0x11, 0x43,
-    0x11, 0x90, 0x78, 0xF3, 0x39, 0xD9, 0x93, 0xB4, 0x2A, 0x19, 0x95, 0xB2, 0xDE, 0x00, 0x43, 0x0A,
-    0x74, 0xBD, 0x6C, 0x42, 0x48, 0x84, 0x07, 0xA9, 0x70, 0x77, 0xDC, 0xDD, 0xC4, 0x29, 0xF2, 0xA5,
-    0x64, 0x32, 0xAB, 0x69, 0x50, 0x43, 0x14, 0xFD, 0x7B, 0xD2, 0x67, 0x36, 0x89, 0xA2, 0x72, 0x32,
-    0xA3, 0xAF, 0xFE, 0xB2, 0x7C, 0xEE, 0x37, 0x10, 0x1E, 0x67, 0x3A, 0x60, 0xA5, 0x47, 0x21, 0x48,
-    0xFE, 0x0F, 0x88, 0x79, 0x5E, 0x58, 0x93, 0xF2, 0x45, 0x48, 0x22, 0x9F, 0xC0, 0xE7, 0xBA, 0xA2,
-    0x94, 0x9B, 0x81, 0xD1, 0xE0, 0x8A, 0xAE, 0xCA, 0x72, 0x64, 0x31, 0x84, 0x1C, 0x61, 0x05, 0x4D,
-    0x00, 0x0E, 0x22, 0xC6, 0x22, 0xE2, 0xC2, 0x39, 0xA2, 0x73, 0x8A, 0xE4, 0x14, 0xE0, 0x13, 0x3D,
-    0x42, 0xF3, 0xA2, 0x57, 0x28, 0xDB, 0x7F, 0x44, 0x4B, 0xF0, 0x1F, 0x69, 0x1C, 0xBF, 0x43, 0xDB,
-    0x58, 0x73, 0x4F, 0xCE, 0xCF, 0x9D, 0x15, 0xC6, 0x55, 0x12, 0x0B, 0x05, 0xC1, 0x03, 0x14, 0xD0,
-    0xFF, 0x8B, 0x46, 0xA0, 0x8B, 0xB2, 0x12, 0x86, 0x3D, 0xE2, 0x74, 0xD3, 0x21, 0xFE, 0x0A, 0x85,
-    0xA2, 0xF2, 0x6E, 0xDF, 0x2E, 0x75, 0xD0, 0xF8, 0xC4, 0x3E, 0x3A, 0xF6, 0x9B, 0x35, 0x84, 0x3E,
-    0x4D, 0xD0, 0x45, 0x84, 0x0A, 0xDC, 0xF0, 0x77, 0xFF, 0x04, 0x63, 0xB1, 0x89, 0x8A, 0xBC, 0xDA,
-    0xC1, 0xD5, 0xF9, 0x53, 0xD0, 0x6A, 0x66, 0x04, 0xB3, 0x36, 0xB3, 0x1E, 0x7C, 0x50, 0x04, 0x6F,
-    0x77, 0xA8, 0x8E, 0xAF, 0x36, 0xF4, 0x0A, 0xB2, 0x9A, 0x99, 0x0C, 0x51, 0x11, 0x36, 0x94, 0xB1,
-    0x39, 0x10, 0x4B, 0x07, 0x4C, 0x60, 0xFF, 0xEE, 0x67, 0x82, 0x20, 0x2E, 0x0D, 0x62, 0x8D, 0xBF,
-    0xA6, 0x57, 0xDE, 0xD4, 0x92, 0x78, 0x4F, 0x71, 0x4E, 0x76, 0xF5, 0xD0, 0xFC, 0x69, 0xBA, 0xDE,
-    0x0B, 0xAA, 0xA1, 0xC2, 0x76, 0x41, 0xCF, 0x11, 0x1F, 0x45, 0xB1, 0x8C, 0xA6, 0xDB, 0x15, 0x3A,
-    0x4A, 0x7F, 0x47, 0x0D, 0xB0, 0xA6, 0x8E, 0x47, 0x55, 0xEA, 0x5F, 0x03, 0xD9, 0xA2, 0xAF, 0x13,
-    0x1F, 0x11, 0x7F, 0xF5, 0x8C, 0x8B, 0x52, 0x2E, 0x24, 0x8E, 0x47, 0xDD, 0x64, 0xE5, 0xF8, 0xC2,
-    0x22, 0x86, 0x0E, 0xF0, 0xC4, 0xFC, 0x29, 0x3D, 0xF3, 0xF8, 0x3D, 0x50, 0xB5, 0x32, 0x8E, 0x7E,
-    0x87, 0x95, 0xE7, 0x0F, 0x39, 0x7F, 0xD2, 0xA8, 0x09, 0x55, 0xAC, 0x78, 0xD3, 0x65, 0x18, 0xC9,
-    0x89, 0x11, 0xED, 0x87, 0xEC, 0xBE, 0xC7, 0xB7, 0xEF, 0xD9, 0x2E, 0xB2, 0xAF, 0x97, 0x74, 0xF0,
-    0x00, 0x38, 0x56, 0xF2, 0x36, 0x62, 0x04, 0x29, 0x6D, 0x15, 0x75, 0x03, 0x6F, 0xD8, 0xBF, 0x2D,
-    0x8D, 0xC3, 0x84, 0xDB, 0xFF, 0xB5, 0x5D, 0x19, 0xC3, 0xE9, 0x6A, 0xE0, 0x05, 0x09, 0x39, 0x4A,
-    0x8A, 0xB1, 0x85, 0xF6, 0x8A, 0xDD, 0xB5, 0x90, 0x6F, 0x11, 0xFA, 0x93, 0xC5, 0xB5, 0x1E, 0x9B,
-    0xBA, 0x07, 0xFF, 0xFE, 0x5F, 0xB2, 0xA8, 0x0A, 0x96, 0xA1, 0x0C, 0x2E, 0xD7, 0xC3, 0xD5, 0x2B,
-    0xBB, 0x1C, 0x2F, 0x7C, 0xD1, 0x2E, 0x83, 0x25, 0xD4, 0x80, 0x1C, 0xA7, 0x53, 0x07, 0xEE, 0xC6,
-    0xAF, 0xE5, 0xA4, 0x21, 0x14, 0x77, 0x72, 0xAF, 0x1D, 0xCC, 0x46, 0x76, 0x01, 0xE7, 0xCA, 0xC6,
-    0xAF, 0x33, 0x1B, 0xC9, 0x00, 0xC6, 0x3C, 0x56, 0xBA, 0x1C, 0x21, 0x00, 0xB6, 0x5F, 0x32, 0x29,
-    0x8C, 0xEC, 0x86, 0xE9, 0x6B, 0x66, 0x90, 0xDF, 0x00, 0x88, 0x39, 0x94, 0xBC, 0x47, 0x09, 0x1C,
-    0x8C, 0x25, 0x2D, 0xA1, 0xA8, 0x91, 0x8A, 0x94, 0xB6, 0xA3, 0x32, 0x64, 0x56, 0x14, 0xAB, 0x4A,
-    0x97, 0x57, 0xB4, 0xB6, 0x41, 0x60, 0x2F, 0x7B, 0x94, 0x98, 0x0D, 0x21, 0x42, 0xCE, 0x67, 0x68,
-    0x58, 0x20, 0x0A, 0x5B, 0x8D, 0x79, 0x2F, 0xE1, 0x92, 0x7E, 0x51, 0x22, 0x12, 0x62, 0x04, 0x27,
-    0x70, 0xBF, 0x4E, 0x50, 0xD8, 0x91, 0xA4, 0x38, 0x51, 0xCD, 0x96, 0xBA, 0xE3, 0x92, 0x4E, 0xA4,
-    0x3A, 0x91, 0xC3, 0x12, 0x42, 0x9B, 0x5F, 0x60, 0x57, 0xC7, 0x6C, 0xED, 0x3D, 0xA4, 0xCB, 0x99,
-    0xE2, 0x3F, 0x70, 0xE1, 0xD8, 0xFD, 0x9F, 0xEB, 0x73, 0xCA, 0x16, 0xE0, 0xCA, 0xED, 0x15, 0xDE,
-    0xBC, 0x3C, 0x61, 0xCA, 0xB3, 0x0E, 0x7B, 0x06, 0x9D, 0xC3, 0x95, 0xA3, 0x7B, 0xD2, 0x11, 0xA6,
-    0x48, 0x51, 0xB4, 0x75, 0x50, 0x5D, 0xCB, 0x2F, 0x30, 0x10, 0xA2, 0xA9, 0xEE, 0xA0, 0x64, 0x69,
-    0x3B, 0xBA, 0x0F, 0x67, 0xF3, 0x7C, 0x42, 0x96, 0x2D, 0xE4, 0xDB, 0xD5, 0xCA, 0x0C, 0x69, 0x1D,
-    0x37, 0xB9, 0xF3, 0x74, 0x38, 0xF7, 0x32, 0x3E, 0x73, 0x08, 0xE3, 0xA5, 0x30, 0x93, 0xD5, 0x64,
-    0xCE, 0x8B, 0xA8, 0x89, 0x21, 0xD5, 0xA4, 0x06, 0xD2, 0x2C, 0x75, 0x99, 0x05, 0xF4, 0x3E, 0xA4,
-    0x19, 0x40, 0xD9, 0xE0, 0xEF, 0x6D, 0x33, 0xF9, 0x2C, 0xE5, 0xF0, 0xAD, 0x0F, 0xB2, 0x91, 0x07,
-    0xCB, 0xD0, 0x5D, 0x46, 0xC7, 0x8D, 0xC2, 0x3B, 0xB8, 0x3D, 0x4B, 0x9A, 0xA8, 0x4D, 0xA8, 0x45,
-    0x60, 0xFC, 0x75, 0x33, 0x47, 0x7A, 0xEF, 0xBB, 0xCE, 0x6F, 0x4B, 0x20, 0x0D, 0xE8, 0xF1, 0x04,
-    0xCD, 0x15, 0x0A, 0xF6, 0x89, 0x3D, 0x67, 0x84, 0xF8, 0x31, 0x75, 0x62, 0xCE, 0x09, 0x43, 0xA1,
-    0x1B, 0x55, 0xB4, 0x2A, 0x23, 0x82, 0x8D, 0x9E, 0xB0, 0xAF, 0x72, 0xF1, 0x38, 0x68, 0xD4, 0xA4,
-    0x06, 0x72, 0x5F, 0x81, 0x25, 0xAF, 0x72, 0x16, 0x41, 0xE9, 0xF4, 0x80, 0x7E, 0xCA, 0x7D, 0x76,
-    0x12, 0xE9, 0x38, 0xC9, 0x6A, 0xBC, 0xB8, 0x46, 0xF7, 0x5E, 0x41, 0x1B, 0xBF, 0x5C, 0x99, 0x9D,
-    0xD4, 0x78, 0xBB, 0xC3, 0xFC, 0x24, 0x9D, 0x29, 0xDB, 0x68, 0xD2, 0xA4, 0x55, 0x28, 0xFE, 0x85,
-    0xC8, 0xE9, 0x06, 0xDE, 0x7D, 0xA6, 0x2E, 0x45, 0xBA, 0xA5, 0x02, 0x79, 0x5B, 0x5E, 0xC6, 0x00,
-    0x61, 0xFE, 0xC2, 0xE8, 0xA1, 0xE3, 0x26, 0xDB, 0xC8, 0x4D, 0x51, 0x98, 0x2F, 0x23, 0xC3, 0x8C,
-    0xC6, 0xCA, 0xBF, 0x88, 0xA7, 0xC1, 0x34, 0xFF, 0xC5, 0xF5, 0xF9, 0xE9, 0x6D, 0x37, 0xE9, 0x68,
-    0x98, 0x50, 0xA8, 0xAC, 0xC6, 0xCC, 0x92, 0xF9, 0x7E, 0x7E, 0xF2, 0x49, 0x07, 0x98, 0x6A, 0xA1,
-    0x3F, 0xDA, 0xA9, 0x25, 0x55, 0x86, 0xFC, 0x22, 0x6B, 0x27, 0xF2, 0xF6, 0xDE, 0x22, 0xF3, 0xC5,
-    0xC2, 0xFB, 0x7E, 0x65, 0x0A, 0x94, 0xF8, 0x95, 0xFF, 0x0E, 0xE8, 0x91, 0x2A, 0x8F, 0xC4, 0x56,
-    0xC1, 0xF8, 0x84, 0x2D, 0xE2, 0x1A, 0x04, 0xE0, 0x60, 0xD0, 0x5B, 0xC6, 0xEC, 0x90, 0x88, 0xA0,
-    0x19, 0x8D, 0x86, 0x66, 0x96, 0x03, 0x6D, 0x5D, 0x95, 0xD1, 0xA9, 0x16, 0x33, 0x76, 0x62, 0xDD,
-    0x1C, 0xD0, 0xC3, 0x99, 0xFC, 0xE1, 0x8E, 0x76, 0x26, 0x5F, 0x00, 0x73, 0xCC, 0x18, 0xCD, 0x31,
-    0xE6, 0xBB, 0x0A, 0x08, 0x3B, 0xA9, 0xC8, 0xA4, 0x1F, 0xEB, 0x2E, 0xA0, 0x44, 0x6B, 0x36, 0x91,
-    0x6B, 0xE8, 0xD4, 0x6E, 0x1F, 0xEC, 0x9E, 0x84, 0xED, 0x13, 0x82, 0x3B, 0x62, 0x0C, 0xDC, 0x63,
-    0x20, 0x59, 0x71, 0x2B, 0xDB, 0x67, 0x3A, 0xEC, 0x34, 0x57, 0x42, 0xE9, 0x0C, 0xEA, 0x7F, 0x4E,
-    0x3E, 0x4B, 0x80, 0x64, 0x31, 0xBA, 0x3D, 0x58, 0x81, 0xBA, 0x94, 0x03, 0xBD, 0xF3, 0xDC, 0x77,
-    0xC0, 0xEA, 0x6D, 0xB8, 0xB7, 0x28, 0x0E, 0x98, 0x22, 0xFE, 0x01, 0xFD, 0x4F, 0x86, 0xC7, 0x9C,
-    0x61, 0xB6, 0x61, 0xE7, 0x75, 0x71, 0x16, 0x7E, 0x6D, 0x69, 0xFE, 0x9A, 0xCE, 0x78, 0x90, 0x3B,
-    0xC4, 0x0F, 0x98, 0x42, 0xB1, 0xC0, 0xB8, 0xFF, 0x33, 0xC0, 0x2C, 0x08, 0xEF, 0x13, 0xB0, 0x90,
-    0x30, 0x0B, 0xD2, 0x77, 0xAC, 0xAC, 0x6D, 0x3E, 0xE2, 0x01, 0xCE, 0x5C, 0x1A, 0xBD, 0xC5, 0xDA,
-    0x47, 0xA5, 0xCF, 0x69, 0xA0, 0xD0, 0x9A, 0xDE, 0x5F, 0x29, 0x10, 0x29, 0x94, 0x5B, 0x7F, 0x8D,
-    0xE9, 0xE4, 0xAC, 0x0E, 0x99, 0x07, 0xD3, 0xC2, 0xE6, 0x95, 0x4D, 0x8B, 0xF1, 0x10, 0x8D, 0x94,
-    0x75, 0x6C, 0x01, 0x5C, 0x93, 0xF1, 0x39, 0xE9, 0x7B, 0xFF, 0x0F, 0xE8, 0xE7, 0xEB, 0x61, 0x5C,
-    0xF9, 0x10, 0xAC, 0x55, 0xD0, 0xBB, 0x98, 0xC2, 0xF4, 0x39, 0x0A, 0xA4, 0x56, 0x1C, 0xED, 0x9C,
-    0x43, 0xF1, 0xBD, 0x0A, 0x4D, 0xD4, 0xB0, 0x65, 0x9A, 0x61, 0x51, 0xD6, 0xB3, 0xF3, 0x0E, 0xB8,
-    0xBB, 0xD0, 0x38, 0x9E, 0x09, 0xEC, 0x4E, 0xA1, 0x73, 0x46, 0x8E, 0x5B, 0x20, 0x77, 0xB3, 0x3E,
-    0x00, 0x82, 0x27, 0x55, 0x3A, 0x4E, 0x26, 0x82, 0xF8, 0x77, 0xD0, 0x72, 0xD8, 0x31, 0x8C, 0xB3,
-    0x48, 0x38, 0xCE, 0x5A, 0x49, 0xFF, 0xE3, 0x3C, 0xB8, 0x12, 0x4A, 0xFD, 0x10, 0xCD, 0x67, 0xF9,
-    0x97, 0xE4, 0x91, 0x69, 0x08, 0xE8, 0x6D, 0xE3, 0x6D, 0x4D, 0xB2, 0xF1, 0x09, 0x01, 0xC3, 0x96,
-    0x03, 0x01, 0x32, 0xC7, 0x8E, 0x1D, 0x5C, 0x76, 0x59, 0x54, 0x1D, 0x3C, 0x58, 0x2C, 0xAC, 0x66,
-    0x31, 0x99, 0x3D, 0xBD, 0xF0, 0x4C, 0xEF, 0x8D, 0x3A, 0x13, 0xB4, 0xBA, 0x2C, 0xD5, 0x81, 0xEF,
-    0x0E, 0xCE, 0xE9, 0x20, 0xB9, 0x42, 0xF8, 0x6A, 0x97, 0x25, 0xA4, 0xF2, 0xDA, 0xEF, 0xA5, 0x49,
-    0x36, 0x73, 0x13, 0xAC, 0x5F, 0xE3, 0x25, 0xE7, 0x4D, 0x2A, 0xDF, 0xFA, 0xAE, 0xD2, 0x04, 0x9A,
-    0xCD, 0xDA, 0xD5, 0xD7, 0xC3, 0xBB, 0x84, 0xE7, 0x78, 0x8E, 0xA7, 0x24, 0xC6, 0x18, 0xB4, 0x63,
-    0x78, 0x5E, 0x8E, 0x38, 0x74, 0x57, 0x13, 0x4E, 0x5F, 0xB3, 0xF7, 0xFC, 0x1A, 0xD3, 0xAC, 0x7B,
-    0x55, 0x61, 0x04, 0xBA, 0xC2, 0x8D, 0x72, 0x36, 0x5C, 0x0C, 0x89, 0x62, 0x5D, 0x3C, 0x2D, 0x72,
-    0x47, 0x07, 0x62, 0xE3, 0x0F, 0x42, 0x70, 0xFB, 0xD0, 0x0B, 0x55, 0xDA, 0x02, 0x94, 0xED, 0x42,
-    0x70, 0xE2, 0xC6, 0x94, 0x98, 0xAB, 0x0F, 0x68, 0x51, 0x1E, 0xC7, 0x2D, 0xBF, 0xE2, 0x9C, 0x64,
-    0xFF, 0x06, 0xA6, 0x62, 0x92, 0x1E, 0x11, 0x47, 0x30, 0x75, 0xDE, 0x4C, 0x86, 0xAF, 0xA0, 0xEB,
-    0xCB, 0x61, 0x36, 0xE0, 0x59, 0x8A, 0x45, 0xAD, 0x53, 0x7E, 0xAB, 0xB5, 0xE3, 0x55, 0x8C, 0x15,
-    0x8A, 0x64, 0x94, 0xAB, 0x93, 0x1F, 0xFD, 0xF3, 0x37, 0x65, 0x2A, 0xC1, 0xA0, 0x99, 0x51, 0xE1,
-    0x61, 0x28, 0xBD, 0x61, 0xB2, 0x35, 0x4B, 0x8E, 0x56, 0xC9, 0xA1, 0x2F, 0xC9, 0x0A, 0x97, 0x59,
-    0x49, 0x44, 0x59, 0xF5, 0x34, 0x55, 0x7B, 0x1A, 0x48, 0x1D, 0xAF, 0x64, 0x0C, 0x3A, 0xEA, 0x68,
-    0x35, 0x75, 0x4E, 0x65, 0x7B, 0xFD, 0x8C, 0xB6, 0xDD, 0x6F, 0xF5, 0x4C, 0xF3, 0x7D, 0xF3, 0xBC,
-    0x51, 0x32, 0x35, 0xCE, 0xD0, 0x85, 0x43, 0x3B, 0x59, 0x0E, 0x9B, 0xC9, 0xFF, 0xB5, 0x76, 0x63,
-    0xDE, 0x43, 0x68, 0x7E, 0x77, 0x11, 0xA8, 0xEC, 0x15, 0xE7, 0x19, 0x9F, 0x98, 0xCE, 0xE1, 0x7C,
-    0x0D, 0xC3, 0xF1, 0x75, 0xE2, 0xD8, 0xAC, 0x5A, 0xA5, 0xE2, 0x27, 0x8A, 0xB8, 0x38, 0xBC, 0xAA,
-    0x18, 0xE3, 0x14, 0x75, 0x19, 0xA6, 0x4C, 0xDB, 0x4E, 0x93, 0x05, 0x46, 0x2F, 0x33, 0x64, 0xCE,
-    0x68, 0x5A, 0x72, 0x7A, 0xB6, 0x33, 0xF0, 0x8D, 0xB7, 0xBE, 0xDA, 0xE1, 0x78, 0x39, 0x4A, 0x9D,
-    0xF7, 0x25, 0xBD, 0xB0, 0x2D, 0xC0, 0x0D, 0x82, 0xE2, 0x6A, 0x30, 0xA4, 0x5C, 0x0F, 0x6E, 0x68,
-    0x19, 0xA1, 0xE8, 0x55, 0xAD, 0xE0, 0x04, 0x1A, 0x9A, 0xCE, 0x4F, 0x2F, 0x15, 0x08, 0xCF, 0xF8,
-    0xCE, 0xF3, 0x9B, 0x63, 0x73, 0xD8, 0xAE, 0x26, 0xD9, 0x5F, 0xDD, 0x84, 0x7F, 0x79, 0x07, 0x6F,
-    0xE8, 0xFD, 0x26, 0xF7, 0xDA, 0x30, 0xEB, 0xFD, 0xEA, 0xCF, 0xFC, 0xF6, 0x93, 0x9B, 0x57, 0x71,
-    0x1E, 0xD2, 0xED, 0x86, 0xAA, 0xF8, 0x46, 0x78, 0x3D, 0x21, 0xEE, 0x1C, 0xF0, 0x32, 0x66, 0x93,
-    0x37, 0x5C, 0xCC, 0xEF, 0x1A, 0x42, 0x5F, 0x2A, 0x84, 0xDE, 0x28, 0x84, 0x5E, 0xAD, 0x42, 0xE8,
-    0x30, 0xC0, 0x37, 0x83, 0xE7, 0x8B, 0xC5, 0xE2, 0xA2, 0x92, 0xDE, 0x80, 0x91, 0x2F, 0xCC, 0xE7,
-    0xCF, 0x6E, 0x06, 0xD2, 0x5D, 0xB0, 0x5D, 0x77, 0x85, 0x2D, 0xB3, 0x3B, 0x6F, 0x0A, 0xA1, 0x87,
-    0x37, 0x85, 0xD0, 0xB7, 0x26, 0x7D, 0x76, 0xD0, 0xF6, 0x2F, 0x9F, 0x5C, 0x3A, 0xDB, 0x3F, 0x7E,
-    0xAD, 0xA1, 0xC9, 0xBF, 0x58, 0x6C, 0x5F, 0xD5, 0xF8, 0xCF, 0xE7, 0xA7, 0xE4, 0x04, 0x60, 0x26,
-    0x17, 0x6C, 0xFF, 0x19, 0x5F, 0x07, 0xDB, 0x3F, 0x3B, 0x68, 0xFB, 0x3B, 0x81, 0x10, 0x93, 0x25,
-    0x4B, 0xA5, 0x8A, 0x97, 0x4B, 0xE5, 0xB2, 0xB8, 0x1C, 0xE2, 0xFF, 0xC4, 0xFC, 0x41, 0xBA, 0x6B,
-    0x14, 0x87, 0x71, 0x63, 0xE6, 0x84, 0x10, 0xAB, 0x2E, 0x9B, 0x69, 0xB2, 0x0A, 0x7C, 0x11, 0x98,
-    0x30, 0x24, 0x2B, 0x14, 0x2A, 0x7F, 0x9B, 0x0C, 0xA0, 0xB3, 0xFB, 0x89, 0x61, 0xE9, 0x97, 0xD9,
-    0x17, 0x4D, 0x17, 0x88, 0x29, 0x97, 0x4D, 0xE5, 0x2C, 0xD1, 0x61, 0x23, 0xFB, 0x35, 0x29, 0x6E,
-    0x14, 0x56, 0x31, 0x61, 0xF6, 0x6B, 0x68, 0x6F, 0xDA, 0x26, 0xD0, 0xB4, 0x3D, 0xF9, 0xFD, 0x3F,
-    0x32, 0x3C, 0xC1, 0xB8, 0x9E, 0xCF, 0x25, 0x0E, 0x74, 0x36, 0xED, 0x70, 0x62, 0x46, 0xD5, 0x71,
-    0x52, 0x36, 0x66, 0x2C, 0x98, 0xD6, 0x64, 0xF4, 0x2A, 0xA3, 0xA7, 0xBF, 0xE5, 0x9B, 0x4E, 0x2C,
-    0x57, 0x2B, 0x51, 0xE4, 0x3D, 0x5F, 0x65, 0x28, 0x73, 0x98, 0xFF, 0x39, 0x25, 0x17, 0xB9, 0x78,
-    0xFC, 0xD4, 0xBB, 0x29, 0x62, 0x7A, 0x76, 0x33, 0x04, 0xE6, 0xAA, 0x3E, 0x6E, 0xEE, 0xA9, 0x0B,
-    0x71, 0xD4, 0x33, 0xA5, 0x1D, 0xEA, 0x55, 0x3B, 0x9D, 0x95, 0x7C, 0x69, 0x6D, 0xBC, 0xFD, 0xB1,
-    0xD2, 0x89, 0x41, 0x88, 0x6E, 0x42, 0x8F, 0x2E, 0xEE, 0x56, 0xBA, 0x14, 0xBC, 0xA9, 0xD8, 0xAF,
-    0x33, 0xE5, 0xB7, 0xB7, 0xE4, 0xC9, 0x92, 0xC3, 0x86, 0xF1, 0x97, 0xB8, 0x73, 0x51, 0xB8, 0xD2,
-    0xC5, 0x4A, 0x5C, 0xB1, 0xB3, 0xFA, 0x46, 0xED, 0x65, 0x00, 0x7E, 0xCA, 0x79, 0xDE, 0x12, 0xAF,
-    0x54, 0xC9, 0x86, 0x72, 0xC7, 0xD4, 0x90, 0x23, 0x08, 0x2D, 0xFC, 0xAB, 0x66, 0x4A, 0xBB, 0x3D,
-    0x37, 0xC5, 0x0C, 0xF8, 0xF0, 0x94, 0x2D, 0x5B, 0x55, 0x04, 0xAB, 0x2B, 0xF2, 0xB9, 0xD6, 0x9F,
-    0x64, 0x34, 0x26, 0x3D, 0xBE, 0xFC, 0x1C, 0x65, 0x0E, 0x2C, 0x3C, 0x5C, 0xD1, 0x7B, 0x9D, 0x14,
-    0x48, 0xFE, 0x04, 0x65, 0xDC, 0x0D, 0xC1, 0xAC, 0xF7, 0x4E, 0x43, 0xF9, 0x18, 0xBE, 0xBC, 0x5A,
-    0x0F, 0xB3, 0x3E, 0x61, 0x34, 0x08, 0xFA, 0xB6, 0x3F, 0xBA, 0x4E, 0x43, 0xB9, 0xC4, 0xC1, 0x68,
-    0x84, 0x9C, 0x70, 0xF1, 0xD6, 0xBB, 0xA6, 0xA1, 0x7C, 0x10, 0x5F, 0x9C, 0x5F, 0x8D, 0x30, 0x9F,
-    0x5E, 0x84, 0x85, 0x16, 0x9D, 0xAA, 0x92, 0x22, 0xA6, 0x2F, 0x2E, 0x5F, 0xFB, 0xE2, 0xE4, 0x86,
-    0xD1, 0xBA, 0x0A, 0xAE, 0xB9, 0xF0, 0x6E, 0xEF, 0x8B, 0x9B, 0xA6, 0x5A, 0x35, 0x29, 0x22, 0x3A,
-    0x79, 0xE2, 0x6F, 0x4E, 0x51, 0xE8, 0xE5, 0xA9, 0xBD, 0xC5, 0x7F, 0xFB, 0x20, 0x59, 0xB1, 0x77,
-    0xB2, 0x30, 0x08, 0x14, 0x88, 0x95, 0x98, 0x66, 0xD2, 0x5C, 0xAF, 0x1B, 0x83, 0xDD, 0xF9, 0x79,
-    0xCC, 0x0F, 0x5A, 0x0E, 0xEF, 0xF5, 0x4B, 0x2B, 0x2C, 0x30, 0x36, 0x5A, 0xEE, 0xA3, 0x88, 0x8C,
-    0x65, 0x92, 0x1C, 0x49, 0x76, 0x4E, 0x39, 0xCC, 0x5C, 0xC1, 0xC4, 0x2F, 0x35, 0x13, 0x7B, 0xD5,
-    0x16, 0xB6, 0xE3, 0x88, 0x9D, 0xD3, 0xD2, 0xEA, 0xCD, 0x23, 0x76, 0x51, 0xB8, 0x50, 0xE8, 0xEA,
-    0xD4, 0xAD, 0xBE, 0xC8, 0x07, 0xC1, 0x28, 0xDC, 0xF8, 0x6E, 0x81, 0x9F, 0x4F, 0x8F, 0xDF, 0x01,
-    0xEF, 0x2D, 0xBD, 0x53, 0x3F, 0xCF, 0xDE, 0x25, 0xF0, 0x93, 0xBB, 0xE5, 0x1B, 0x28, 0x1E, 0x1A,
-    0x17, 0xB6, 0x50, 0xF2, 0xB1, 0x12, 0xAD, 0x59, 0x90, 0x40, 0x87, 0x1C, 0x95, 0xA6, 0xE2, 0x08,
-    0xD7, 0x24, 0x41, 0x8C, 0x31, 0x13, 0xAD, 0x9A, 0x0D, 0x87, 0x4A, 0x62, 0xF0, 0x88, 0x41, 0x4A,
-    0x2D, 0x22, 0x71, 0x2B, 0x44, 0xC6, 0x83, 0x05, 0x5E, 0x3D, 0x72, 0x6C, 0x07, 0xBE, 0x71, 0x3F,
-    0x80, 0xBA, 0x5C, 0x03, 0x4F, 0x8C, 0xC7, 0x49, 0x4B, 0x38, 0xC4, 0xB1, 0x7E, 0x4E, 0x33, 0x92,
-    0x11, 0x5C, 0xE8, 0xCE, 0x5D, 0x79, 0xBA, 0x03, 0xFA, 0x8C, 0xBF, 0xA0, 0x6E, 0xE8, 0xAE, 0xB4,
-    0x1C, 0x8D, 0x2C, 0xFA, 0xF4, 0x7C, 0x42, 0xF0, 0x45, 0xFF, 0xC1, 0x4C, 0x82, 0xBE, 0x26, 0xCE,
-    0x21, 0x12, 0x7B, 0x03, 0xCF, 0xC2, 0xFB, 0x64, 0xFB, 0xE9, 0x9D, 0x54, 0xBD, 0xF2, 0xFF, 0xA6,
-    0x2E, 0xEA, 0xCD, 0x9C, 0x05, 0xAD, 0x55, 0x30, 0x0B, 0xF3, 0x07, 0x9D, 0x01, 0x9C, 0x1F, 0xCC,
-    0x00, 0x4E, 0xA7, 0x6C, 0x06, 0x07, 0x9F, 0xD7, 0xAB, 0x00, 0x26, 0x34, 0xB7, 0x5E, 0x09, 0xB0,
-    0x5E, 0x0B, 0x60, 0xCC, 0xE7, 0x3E, 0xF2, 0xF0, 0x59, 0x39, 0x85, 0xCF, 0x5E, 0xD9, 0xDA, 0x07,
-    0x90, 0x53, 0xF6, 0xC5, 0xCC, 0x35, 0x3B, 0x2C, 0x36, 0x12, 0x77, 0x30, 0xF8, 0x1F, 0x51, 0x52,
-    0xB3, 0x58, 0x45, 0xF6, 0xA7, 0x31, 0x1C, 0xBE, 0x92, 0x3A, 0x85, 0xF6, 0xD2, 0xB7, 0xCC, 0xEF,
-    0x1D, 0xE3, 0x3B, 0x55, 0x28, 0x1D, 0x09, 0x3D, 0xFB, 0xB7, 0x94, 0xB1, 0xAB, 0xC5, 0x16, 0xF7,
-    0x74, 0x91, 0x51, 0x7C, 0x53, 0x96, 0x6F, 0xB8, 0x91, 0xBD, 0xB4, 0xE9, 0xE6, 0xAF, 0xF7, 0xF3,
-    0x60, 0x94, 0xA4, 0x7F, 0xF7, 0xA3, 0x79, 0x2B, 0x77, 0x90, 0x18, 0x41, 0x3E, 0x7E, 0x31, 0xC1,
-    0xA3, 0xAC, 0xFA, 0xF3, 0xFD, 0xFC, 0x91, 0xB4, 0x28, 0x99, 0x49, 0x5B, 0x3D, 0x44, 0x39, 0x44,
-    0x2A, 0xF9, 0xD7, 0x29, 0xAE, 0x42, 0x65, 0x89, 0xE1, 0xAD, 0xB3, 0xFE, 0xF9, 0x84, 0x1D, 0x7F,
-    0x5E, 0xC4, 0x7A, 0xFE, 0x8C, 0xCA, 0x4E, 0x14, 0x92, 0xF7, 0x9B, 0xCC, 0x3A, 0xEB, 0xFF, 0x43,
-    0xAF, 0xFA, 0x52, 0x65, 0xEA, 0xEE, 0xE2, 0x13, 0x1E, 0x8E, 0x04, 0x5C, 0x43, 0x2D, 0x27, 0xF3,
-    0x65, 0x78, 0x80, 0x73, 0x28, 0xC3, 0x60, 0x6E, 0xE1, 0xBD, 0x69, 0xC3, 0xB7, 0x47, 0xA2, 0x89,
-    0x47, 0xC3, 0xC3, 0x7B, 0x12, 0xA4, 0xCB, 0xFF, 0xC2, 0xB6, 0xFE, 0x00, 0xCC, 0x92, 0x6C, 0xD1,
-    0xD6, 0x31, 0xD1, 0x0F, 0xD0, 0xF4, 0xF4, 0xF3, 0x40, 0x26, 0xFD, 0xFF, 0x04, 0xE4, 0xFC, 0xDD,
-    0x35, 0xD8, 0xC3, 0xE4, 0xAF, 0xF4, 0x51, 0x1A, 0x39, 0xFF, 0xA3, 0x33, 0xFE, 0xDB, 0x80, 0x6F,
-    0xD1, 0x2B, 0x81, 0x4C, 0x0C, 0xFA, 0x73, 0xA1, 0x53, 0xAD, 0x49, 0xAF, 0x30, 0xBB, 0xBA, 0x76,
-    0xDE, 0xC3, 0xF7, 0xE4, 0x0A, 0xCC, 0xBB, 0x80, 0xBE, 0xA4, 0xEE, 0xA3, 0x5B, 0x7A, 0x76, 0xBA,
-    0x99, 0x70, 0xCE, 0xE1, 0x9D, 0x95, 0x64, 0x91, 0xB9, 0x08, 0x60, 0xF3, 0x40, 0x64, 0x97, 0x21,
-    0x13, 0xDA, 0xCA, 0x2A, 0x68, 0x82, 0x7F, 0x42, 0x15, 0x9A, 0x75, 0x0E, 0xB3, 0xD9, 0xEB, 0x62,
-    0x5E, 0x85, 0x6B, 0xE3, 0x6B, 0x95, 0x5B, 0xCF, 0xCA, 0x60, 0x0F, 0xAA, 0x76, 0x78, 0xE3, 0x60,
-    0xB4, 0xE8, 0xC5, 0xEB, 0x64, 0x91, 0x07, 0x98, 0x8E, 0x5D, 0xB8, 0x04, 0xD3, 0xC8, 0x11, 0xE0,
-    0x65, 0xFB, 0x0B, 0xBF, 0x45, 0x08, 0x51, 0x22, 0x79, 0xAB, 0x84, 0xC2, 0xAE, 0xB8, 0x96, 0x30,
-    0xFE, 0xB1, 0xD6, 0x3F, 0x63, 0xC0, 0x20, 0xEA, 0x41, 0x8D, 0xCF, 0xD0, 0x17, 0x2C, 0x49, 0x4E,
-    0x7A, 0x40, 0x5D, 0x48, 0x36, 0x47, 0xF5, 0x25, 0x27, 0x89, 0x1B, 0x67, 0xE2, 0x55, 0x3A, 0x95,
-    0xBA, 0x53, 0xB9, 0x43, 0xC0, 0xD6, 0xC9, 0xFF, 0x41, 0xA7, 0x5C, 0x6E, 0x54, 0xAD, 0xB4, 0xA0,
-    0x34, 0x0B, 0x9D, 0x70, 0xA1, 0xD5, 0x15, 0x90, 0x38, 0x24, 0x2B, 0x13, 0xDE, 0xE2, 0x35, 0x79,
-    0x26, 0xFA, 0x3C, 0x48, 0x94, 0x05, 0x5E, 0x80, 0x42, 0x7E, 0x63, 0x2F, 0xCF, 0xD2, 0x7F, 0xDD,
-    0x81, 0xD5, 0xCD, 0x09, 0xBF, 0x8D, 0x33, 0x18, 0x9B, 0x51, 0xE1, 0x15, 0x29, 0x05, 0x4B, 0xF4,
-    0x2B, 0x7A, 0x00, 0x94, 0xB7, 0xA3, 0xE5, 0x30, 0xA9, 0x1C, 0xC0, 0xD5, 0x8E, 0x71, 0x59, 0xBE,
-    0xC6, 0x19, 0x53, 0x14, 0xE4, 0xE5, 0xE0, 0x53, 0x51, 0x67, 0xB9, 0xBC, 0x41, 0x5B, 0xF7, 0x49,
-    0x0A, 0xF9, 0x75, 0x97, 0x42, 0x3E, 0xB8, 0x5C, 0x99, 0x66, 0x23, 0xBA, 0x22, 0xC5, 0xB6, 0x0A,
-    0xAE, 0x84, 0xD5, 0x46, 0x88, 0x65, 0x52, 0x36, 0x0F, 0x0B, 0xCA, 0x7F, 0xC3, 0x62, 0x84, 0x97,
-    0x41, 0x67, 0x8E, 0xB6, 0x2E, 0x90, 0xED, 0x62, 0xD8, 0x9B, 0x5F, 0xB9, 0xEE, 0xC7, 0x85, 0xBB,
-    0xD3, 0x0B, 0xF3, 0xF2, 0x16, 0x17, 0xE8, 0x6B, 0x07, 0x6E, 0x9D, 0xD9, 0x4E, 0x59, 0xF6, 0x45,
-    0x69, 0xF7, 0x7D, 0x49, 0xD1, 0xFE, 0x57, 0xA7, 0x49, 0x9E, 0x57, 0x23, 0x32, 0x47, 0x41, 0x00,
-    0x3B, 0x65, 0x78, 0x8D, 0xA2, 0xE1, 0xDE, 0x76, 0xE3, 0x3A, 0x77, 0xC2, 0x75, 0x55, 0x6B, 0xAF,
-    0x70, 0x78, 0x7C, 0x3A, 0x2C, 0xDC, 0xE1, 0x8A, 0x10, 0x66, 0x75, 0x38, 0xAD, 0xB8, 0x73, 0xC4,
-    0x5C, 0x51, 0xD3, 0xDC, 0xE6, 0xE2, 0x77, 0x3F, 0x94, 0x79, 0x66, 0xA6, 0xCC, 0x7C, 0xB3, 0x4A,
-    0xCD, 0x17, 0xAD, 0x46, 0xF9, 0x7B, 0x46, 0x12, 0x6B, 0x6F, 0x47, 0x7D, 0x3F, 0xB6, 0x51, 0x3E,
-    0xAA, 0xF2, 0x53, 0xFE, 0xB8, 0xD8, 0x6E, 0x27, 0x7A, 0xF9, 0xBB, 0xF3, 0x93, 0xED, 0x44, 0xA5,
-    0x5B, 0x94, 0x2E, 0x3F, 0x8B, 0xC2, 0xAC, 0x70, 0x49, 0x02, 0xCE, 0xED, 0x30, 0xF5, 0x83, 0x2B,
-    0xF7, 0xF2, 0xBD, 0x85, 0x16, 0x4A, 0x87, 0xED, 0x7E, 0xBE, 0x5B, 0x3E, 0x19, 0x4E, 0xD2, 0x0B,
-    0x68, 0xB5, 0xC0, 0xC5, 0x2D, 0x2F, 0xF8, 0xC1, 0xD3, 0xEE, 0x02, 0xA6, 0x28, 0xF2, 0x02, 0x3A,
-    0x77, 0x75, 0xC1, 0x17, 0xCB, 0xCE, 0x3D, 0xC1, 0xB3, 0xD3, 0x13, 0xE2, 0xC6, 0x3D, 0xC1, 0xAD,
-    0x40, 0xA6, 0xD6, 0x9E, 0x5E, 0x11, 0xD7, 0xEE, 0x02, 0xAD, 0xA2, 0xE3, 0x2B, 0xB4, 0xE4, 0x18,
-    0xC8, 0x37, 0x8F, 0xB5, 0x80, 0x9C, 0x2E, 0x51, 0x7A, 0xCB, 0xA7, 0x15, 0xDB, 0xEB, 0x9D, 0x0E,
-    0x56, 0xF6, 0xEC, 0x2A, 0x1F, 0xD8, 0xA5, 0xBD, 0xAF, 0xB7, 0x22, 0x58, 0x6D, 0x46, 0xE0, 0xB6,
-    0x23, 0x90, 0xCF, 0x2B, 0x53, 0xE0, 0x80, 0x3C, 0x0C, 0x9C, 0x7F, 0xAA, 0x71, 0xB6, 0xF0, 0x8E,
-    0x7B, 0x62, 0x78, 0xE0, 0xF0, 0x67, 0x65, 0xA1, 0x43, 0x74, 0xC8, 0x97, 0x91, 0x44, 0x80, 0x66,
-    0xCA, 0x22, 0x6E, 0xDD, 0xC5, 0x79, 0xA1, 0x8B, 0xFD, 0xDE, 0x1D, 0xC6, 0x95, 0x0E, 0x95, 0x22,
-    0x49, 0xC7, 0xD5, 0x15, 0xF2, 0x69, 0xEB, 0xB9, 0x54, 0x87, 0x55, 0xCE, 0xE9, 0xCA, 0xBF, 0x3F,
-    0x79, 0x31, 0x26, 0x13, 0xDC, 0xB9, 0x03, 0xA7, 0x8C, 0x48, 0xA3, 0xA5, 0xF2, 0x6C, 0x8A, 0x6B,
-    0xBC, 0x82, 0x5A, 0x93, 0xFF, 0x34, 0xB4, 0x2E, 0x4A, 0xCF, 0x92, 0xC9, 0x72, 0x0D, 0xAD, 0x55,
-    0xFA, 0x61, 0xD3, 0x22, 0x7A, 0x7D, 0xD4, 0xC2, 0x73, 0xE6, 0x8B, 0x69, 0x4D, 0x3B, 0x30, 0x44,
-    0xA3, 0xC6, 0x5C, 0x56, 0xD3, 0xB8, 0xF1, 0xC0, 0x14, 0x47, 0x96, 0x91, 0x2E, 0x1F, 0x29, 0xCE,
-    0xE4, 0x5C, 0x94, 0xDD, 0x05, 0x4C, 0xA8, 0x4B, 0xB2, 0xB4, 0x08, 0x61, 0xED, 0xFB, 0xB4, 0xC5,
-    0x53, 0x0C, 0xD7, 0xAC, 0x83, 0x01, 0x6E, 0xB3, 0xE8, 0x95, 0x8E, 0x6F, 0xCB, 0xE9, 0x2C, 0xDA,
-    0x95, 0x57, 0x1B, 0x18, 0x77, 0xFC, 0x2F, 0x95, 0x39, 0x8D, 0x89, 0xB5, 0x64, 0xEA, 0x80, 0x7C,
-    0xED, 0x5B, 0xAB, 0x45, 0xC9, 0x03, 0xD0, 0x13, 0x80, 0x20, 0x23, 0x3E, 0x67, 0x61, 0x92, 0x66,
-    0x78, 0x4A, 0xEA, 0x2D, 0xFD, 0xE6, 0x1C, 0x1D, 0xF7, 0xE7, 0xE8, 0x4F, 0xB8, 0xCC, 0x62, 0x07,
-    0x45, 0xB3, 0x33, 0x5B, 0x06, 0x75, 0xEE, 0x75, 0x61, 0x95, 0x02, 0x30, 0x14, 0x49, 0x71, 0x39,
-    0x01, 0xF5, 0xD2, 0xCB, 0xC6, 0x1F, 0xB7, 0x77, 0xFF, 0x95, 0x4C, 0x03, 0x73, 0xE8, 0xA5, 0xC3,
-    0x5B, 0xF7, 0x62, 0x95, 0x44, 0x72, 0x7E, 0x85, 0xA2, 0xD1, 0x2B, 0x8F, 0x88, 0x2C, 0x96, 0xB3,
-    0x91, 0x0F, 0x7A, 0xCE, 0x7C, 0xF0, 0x14, 0x92, 0x1B, 0x42, 0x48, 0xA7, 0x33, 0x79, 0x34, 0xA0,
-    0xBE, 0xFC, 0x53, 0x95, 0xD6, 0xE0, 0xA6, 0xF5, 0xFE, 0xAA, 0xFA, 0x8F, 0x68, 0x81, 0xC6, 0xD6,
-    0xFE, 0x02, 0x8D, 0x66, 0x3D, 0xBD, 0x86, 0x35, 0x56, 0x97, 0x64, 0x97, 0x82, 0x75, 0x72, 0xF5,
-    0xE3, 0xE6, 0xF7, 0x4C, 0x7B, 0xC9, 0xE8, 0xD6, 0xA0, 0x11, 0xDC, 0x4C, 0x2F, 0xBB, 0xBC, 0x81,
-    0xC3, 0xE5, 0x84, 0xFA, 0x17, 0x46, 0xBB, 0x0C, 0xC0, 0xDA, 0x2D, 0x52, 0xFB, 0x4A, 0x59, 0x53,
-    0x5E, 0xE6, 0x0C, 0x43, 0x80, 0x88, 0xC0, 0x21, 0x98, 0xF0, 0x91, 0x00, 0xE0, 0x59, 0x19, 0x52,
-    0xC2, 0x42, 0x34, 0xCF, 0xA2, 0x46, 0x88, 0xFE, 0xAA, 0xC4, 0xD6, 0xCE, 0xFE, 0xDA, 0x66, 0x05,
-    0x18, 0x6E, 0x93, 0xAE, 0x7F, 0x43, 0xF5, 0xFF, 0x75, 0x96, 0x9B, 0x60, 0x43, 0x7F, 0xD7, 0x3C,
-    0xFF, 0xB3, 0x03, 0x9E, 0xFF, 0xDB, 0x15, 0x33, 0xE7, 0x52, 0x66, 0x44, 0x74, 0xBE, 0xF5, 0x3E,
-    0x28, 0xB0, 0xDC, 0xA0, 0x40, 0x2D, 0x0A, 0xBC, 0x26, 0x0A, 0x68, 0x49, 0x48, 0xDE, 0x3A, 0x57,
-    0x7D, 0x25, 0x85, 0xF1, 0x5E, 0x14, 0x48, 0xEE, 0x80, 0x02, 0xB3, 0x15, 0x05, 0xB2, 0x15, 0x05,
-    0x4E, 0xAC, 0x28, 0x90, 0x89, 0x02, 0x6C, 0xCD, 0x95, 0x9B, 0x63, 0x1F, 0x8F, 0xD8, 0xEF, 0x4C,
-    0x99, 0x3D, 0x47, 0x76, 0x9E, 0xBE, 0x13, 0x0A, 0xDC, 0x37, 0xAB, 0x60, 0x9C, 0xEF, 0x79, 0xDC,
-    0x10, 0xD6, 0x97, 0x37, 0xC0, 0xCE, 0xE3, 0x1B, 0xE5, 0xA7, 0x3E, 0x78, 0x1A, 0x52, 0x7B, 0xDB,
-    0x34, 0xA4, 0x61, 0x8D, 0x6E, 0xFA, 0x35, 0xDE, 0x7A, 0x79, 0x3D, 0x1D, 0xBF, 0x00, 0x51, 0x31,
-    0xF8, 0x76, 0xE4, 0x7C, 0x84, 0xAE, 0xF9, 0x8B, 0x5F, 0xDA, 0x93, 0x75, 0x30, 0xCC, 0x60, 0x05,
-    0x2C, 0xF1, 0xF6, 0x97, 0xA3, 0xE6, 0x38, 0x9E, 0x75, 0xCC, 0xEF, 0x22, 0x4C, 0x8F, 0x20, 0x1B,
-    0xFD, 0x4C, 0x39, 0xE7, 0x85, 0xFA, 0xA3, 0x8D, 0x35, 0x0A, 0xD9, 0xD3, 0x91, 0xB4, 0x89, 0xB9,
-    0x3B, 0x27, 0xF7, 0xE6, 0xCF, 0xB8, 0xED, 0x73, 0x14, 0x48, 0x5D, 0xED, 0x56, 0xB0, 0xA1, 0xB2,
-    0xF3, 0x29, 0x55, 0x7E, 0x52, 0x84, 0x93, 0x62, 0x9F, 0xF4, 0xFA, 0x14, 0x04, 0x9C, 0x69, 0x8D,
-    0xBF, 0xD6, 0x93, 0xC3, 0xAA, 0x8E, 0x5E, 0xEC, 0x60, 0x39, 0xF8, 0xF5, 0x10, 0x65, 0x3B, 0xA6,
-    0x4D, 0x9F, 0xAC, 0x93, 0xE2, 0xF3, 0x51, 0xFD, 0xBD, 0x50, 0xDB, 0x18, 0x51, 0xD4, 0x0E, 0x1A,
-    0x1B, 0x66, 0x7A, 0x16, 0xDA, 0x18, 0xE4, 0xDD, 0x4E, 0xEC, 0x6A, 0x1D, 0x93, 0x9D, 0x16, 0x0F,
-    0xAC, 0x96, 0x85, 0xC7, 0x9B, 0x4B, 0x89, 0x1C, 0xD2, 0x3F, 0xB1, 0xB9, 0x20, 0xA4, 0xBA, 0x57,
-    0x0B, 0x8A, 0xDC, 0xAE, 0x2E, 0xB5, 0x9C, 0x2F, 0xC5, 0x5A, 0x38, 0x3B, 0x39, 0xED, 0xB0, 0x6F,
-    0xB2, 0xC1, 0x8F, 0x8D, 0x5B, 0xFD, 0x44, 0xCE, 0xE9, 0xCA, 0xD1, 0xB7, 0xCB, 0xA3, 0xD3, 0x8A,
-    0xD5, 0xD4, 0x1C, 0x2C, 0x98, 0x55, 0xA4, 0x24, 0x32, 0x6D, 0x6E, 0x60, 0x3E, 0xB1, 0x97, 0xAF,
-    0xA5, 0xFE, 0x7E, 0x91, 0x6B, 0x01, 0x9F, 0x76, 0x19, 0x18, 0xD6, 0x2F, 0xBF, 0xB4, 0x2E, 0xCE,
-    0xAC, 0xB9, 0xFF, 0xB1, 0xF7, 0x4B, 0x9F, 0xE0, 0x05, 0xD2, 0xE7, 0xB3, 0xA2, 0xCF, 0xF3, 0x3C,
-    0x33, 0x5E, 0x3F, 0x48, 0x9F, 0x4B, 0x24, 0x84, 0xD7, 0xB0, 0x5D, 0xBC, 0xDA, 0x98, 0xCF, 0xBE,
-    0xD7, 0x82, 0xAB, 0x77, 0x4F, 0x9D, 0x0B, 0x9E, 0x6A, 0xCD, 0xF8, 0x19, 0xA6, 0xCE, 0xFD, 0xEF,
-    0x75, 0xEA, 0x1C, 0x77, 0xBB, 0xF8, 0x0C, 0xE9, 0xF8, 0x55, 0xF6, 0x37, 0xBB, 0x39, 0x75, 0x8E,
-    0x13, 0x57, 0x5E, 0xF9, 0x87, 0x86, 0xB5, 0x02, 0x75, 0x9C, 0x7C, 0xF3, 0xD7, 0x23, 0x2F, 0xA9,
-    0x07, 0x9D, 0x2C, 0x06, 0x60, 0xEF, 0x37, 0x3D, 0x2D, 0xFC, 0xF0, 0xB9, 0x89, 0x04, 0xFE, 0xCF,
-    0x44, 0x8B, 0x84, 0x54, 0xB8, 0xCD, 0x57, 0x70, 0xCD, 0x10, 0x58, 0x97, 0xD6, 0xDB, 0xD0, 0x88,
-    0x3D, 0x98, 0x4D, 0x70, 0xFA, 0xA6, 0xBC, 0x81, 0x8D, 0xAF, 0x04, 0x25, 0xF1, 0x15, 0x2B, 0x87,
-    0x17, 0xEE, 0x89, 0xED, 0xB3, 0x23, 0xA5, 0x6F, 0xD4, 0x3A, 0xB2, 0xBF, 0x9F, 0x14, 0x82, 0xDB,
-    0x65, 0x13, 0x08, 0xF8, 0x4C, 0x2C, 0xC1, 0x49, 0x24, 0x6F, 0xCB, 0x13, 0x44, 0xA3, 0x90, 0xAC,
-    0x56, 0xDB, 0x88, 0xF9, 0x7D, 0x48, 0x71, 0x90, 0x5C, 0x69, 0x98, 0x00, 0x37, 0x9C, 0x20, 0xDA,
-    0x88, 0x7F, 0xD4, 0xD0, 0xDE, 0x18, 0xD2, 0x6F, 0x5E, 0x9F, 0xCF, 0x4F, 0xFF, 0xC8, 0x6E, 0xCC,
-    0xBE, 0x6A, 0x92, 0xAD, 0x51, 0xB3, 0x21, 0x68, 0x23, 0x37, 0x0F, 0x4B, 0x17, 0xAD, 0x9A, 0x42,
-    0x57, 0xEE, 0x02, 0x4C, 0x05, 0x8F, 0x70, 0x65, 0x6F, 0xBB, 0x5B, 0x7B, 0x5A, 0x13, 0x17, 0xC6,
-    0x38, 0x34, 0x5F, 0x41, 0x33, 0x9A, 0x3D, 0x2E, 0x81, 0xCF, 0x87, 0xF1, 0xF9, 0x49, 0xE0, 0xDC,
-    0xFE, 0x38, 0x06, 0x79, 0x38, 0xCE, 0xA4, 0xE1, 0x34, 0xBF, 0x30, 0xD7, 0x46, 0x15, 0x43, 0xE8,
-    0x16, 0xB9, 0xAF, 0x03, 0x63, 0x82, 0x87, 0x1A, 0x4B, 0x35, 0x20, 0x1C, 0xE7, 0x97, 0x8C, 0x3F,
-    0xE9, 0xC2, 0x75, 0x6A, 0xC0, 0x7D, 0x49, 0x81, 0xD8, 0x51, 0x20, 0xBC, 0xBE, 0x21, 0x61, 0x27,
-    0x61, 0xE6, 0xC4, 0x98, 0xF3, 0xEA, 0x39, 0x17, 0x9B, 0x31, 0xC5, 0x87, 0x4B, 0x28, 0xF9, 0x68,
-    0xE5, 0xDE, 0xF5, 0xD6, 0x85, 0xD9, 0x2F, 0x1E, 0xB8, 0x0B, 0xFB, 0x96, 0xCD, 0x6A, 0xB3, 0xDA,
-    0xF9, 0xE6, 0xDC, 0x14, 0xD9, 0x74, 0xE9, 0x4A, 0xE1, 0x38, 0xAD, 0xFA, 0x9B, 0x62, 0xB4, 0x37,
-    0x6C, 0x2B, 0xB8, 0xFF, 0xF1, 0x99, 0xA1, 0x58, 0xFB, 0x4B, 0xCC, 0x8F, 0x94, 0x0B, 0x92, 0x89,
-    0x95, 0xF2, 0x62, 0x66, 0x8B, 0x8F, 0x33, 0x79, 0xDD, 0x1B, 0xB6, 0x08, 0xF7, 0x96, 0x52, 0xBA,
-    0xF4, 0xD2, 0x9F, 0x95, 0x37, 0x3D, 0xCD, 0x4E, 0xA8, 0x63, 0x51, 0x2D, 0x99, 0x7B, 0xDC, 0x5F,
-    0xCA, 0xC3, 0x1E, 0x54, 0x83, 0xF3, 0x80, 0x4C, 0xDB, 0x8F, 0x99, 0x7C, 0xDA, 0x53, 0x30, 0x7D,
-    0x6A, 0x29, 0x72, 0x25, 0xC5, 0xE0, 0x32, 0xEA, 0x2A, 0xE5, 0x35, 0x32, 0xAE, 0x5F, 0x6B, 0x91,
-    0x7D, 0xEB, 0x1C, 0x50, 0x00, 0x1D, 0x03, 0x9D, 0x40, 0x34, 0xBF, 0xE8, 0x83, 0xF2, 0x95, 0xC1,
-    0x01, 0x98, 0x3C, 0x52, 0x5D, 0xC5, 0x5C, 0x91, 0xA0, 0x55, 0xB8, 0x4F, 0xC1, 0xB0, 0xA2, 0x3F,
-    0xA3, 0xFB, 0x4B, 0xD7, 0x89, 0x7F, 0x03, 0xC3, 0x07, 0xFF, 0xB8, 0xE2, 0xD9, 0x77, 0xCF, 0x97,
-    0x24, 0x48, 0x2F, 0x0C, 0xD3, 0xDE, 0x73, 0x72, 0xDF, 0xEE, 0x2F, 0x4F, 0x93, 0x93, 0xCD, 0xCB,
-    0xE2, 0x9A, 0x73, 0xBA, 0xCA, 0xEB, 0x7C, 0x9C, 0x59, 0x73, 0x0A, 0x37, 0xC5, 0x2F, 0x99, 0xA8,
-    0x38, 0x41, 0xBD, 0x17, 0x9B, 0x8E, 0x7D, 0x39, 0xE6, 0x37, 0x34, 0x7F, 0x1E, 0x8F, 0xBE, 0xC6,
-    0xE7, 0xEE, 0x94, 0xDB, 0x99, 0x92, 0x38, 0xD8, 0xF8, 0xE4, 0xEB, 0x6E, 0x85, 0x4F, 0xF4, 0x82,
-    0x96, 0xD5, 0x9F, 0xA0, 0x2A, 0xCA, 0x95, 0x3C, 0x0B, 0x30, 0xCA, 0xF4, 0x87, 0xB4, 0x8A, 0x0A,
-    0x7A, 0xD4, 0x66, 0xB6, 0x89, 0x9B, 0x94, 0xE1, 0xE1, 0xA4, 0x79, 0xDA, 0xC5, 0x1D, 0x56, 0x9B,
-    0xCB, 0x99, 0xF8, 0x57, 0x78, 0x56, 0xD2, 0x9F, 0x62, 0x6E, 0x07, 0x1D, 0x9D, 0xAF, 0x67, 0xA5,
-    0x8B, 0x1F, 0x73, 0x9F, 0x86, 0x36, 0xA4, 0x75, 0x43, 0x77, 0x63, 0xC9, 0x6E, 0x25, 0x57, 0xBA,
-    0x69, 0xA6, 0x29, 0x1A, 0x65, 0xCA, 0x0B, 0xA5, 0xE4, 0xA5, 0xE5, 0xC2, 0xB6, 0x68, 0xE9, 0xFC,
-    0xB6, 0xA5, 0x16, 0x98, 0xE9, 0xE6, 0xD6, 0xED, 0xC2, 0x43, 0x1F, 0x03, 0xF4, 0xFE, 0x6B, 0xCC,
-    0x3F, 0xFC, 0x07, 0x3A, 0x15, 0x97, 0x6B, 0x71, 0x3D, 0x98, 0x35, 0x06, 0x33, 0x2E, 0x22, 0x45,
-    0x63, 0x6E, 0xBD, 0x77, 0xE1, 0x21, 0x50, 0x2E, 0xFA, 0x15, 0xFD, 0xDD, 0x71, 0x1D, 0xFD, 0xDC,
-    0x6F, 0x61, 0x9A, 0x00, 0x7C, 0x00, 0xA1, 0x31, 0x57, 0x04, 0xDD, 0xDC, 0x1B, 0x99, 0x8C, 0x82,
-    0x11, 0x5B, 0xE0, 0xBA, 0x2A, 0x60, 0x5A, 0x03, 0x51, 0x1E, 0x8C, 0x57, 0x86, 0xEC, 0x21, 0x6A,
-    0x13, 0x9B, 0xC5, 0xD7, 0x2C, 0x63, 0xF7, 0x2E, 0x12, 0x35, 0x4C, 0xEA, 0x34, 0x91, 0x73, 0x56,
-    0xA1, 0x03, 0x9F, 0x5C, 0xCA, 0xC5, 0x61, 0xF7, 0xD5, 0x46, 0x1B, 0x53, 0xD6, 0xFD, 0x72, 0x5F,
-    0x7C, 0xB8, 0xB5, 0xF4, 0xCE, 0xB3, 0x16, 0x4D, 0x29, 0x02, 0x77, 0x79, 0x19, 0xCE, 0xC0, 0xAC,
-    0xBD, 0xE1, 0xC8, 0x66, 0x5A, 0x94, 0x64, 0x87, 0x44, 0x96, 0xBC, 0x89, 0x81, 0xB9, 0x3F, 0xFC,
-    0xA1, 0x41, 0xAB, 0x45, 0x07, 0xB9, 0x22, 0xAA, 0x53, 0xD4, 0x6D, 0x67, 0xC3, 0x1D, 0x3A, 0x21,
-    0x5C, 0x59, 0xDA, 0x47, 0x4A, 0x35, 0xDF, 0x45, 0x04, 0x3F, 0xF1, 0xAD, 0x29, 0x5D, 0xE2, 0x6E,
-    0x2D, 0xFE, 0xC9, 0xE5, 0x7D, 0xA8, 0x4A, 0x5B, 0xC8, 0x77, 0xE5, 0xF6, 0x35, 0xDC, 0x37, 0xDB,
-    0x93, 0x95, 0x7C, 0xF6, 0x4A, 0x39, 0xA0, 0x6B, 0x17, 0x6E, 0x35, 0xF7, 0xEB, 0xCE, 0x24, 0x6B,
-    0xF7, 0x58, 0x72, 0x73, 0x7E, 0xCA, 0xE4, 0x5C, 0x5E, 0xE5, 0xA7, 0x7C, 0x68, 0x6B, 0xA8, 0xAA,
-    0x1B, 0xB2, 0x4E, 0x9C, 0x3D, 0x72, 0x66, 0xAD, 0x33, 0xFF, 0xD8, 0xDC, 0xF3, 0x1D, 0x05, 0x9C,
-    0x69, 0x9E, 0x6F, 0x64, 0xD5, 0xB5, 0xFB, 0x46, 0xC0, 0x31, 0x55, 0x7F, 0x75, 0xA5, 0xDD, 0xEF,
-    0xFA, 0x1A, 0x92, 0xE9, 0xC5, 0xDD, 0xCA, 0x62, 0x93, 0xE2, 0x93, 0x87, 0xEC, 0xAF, 0xFF, 0x30,
-    0x76, 0xE7, 0x19, 0x56, 0xBB, 0xF3, 0xDC, 0x60, 0x8B, 0x4E, 0xD9, 0x5E, 0x2B, 0x6F, 0xEC, 0x59,
-    0xB3, 0x19, 0x92, 0x9E, 0x78, 0x0E, 0x4C, 0xF7, 0x21, 0x2F, 0x0F, 0x1C, 0xB4, 0x3C, 0x70, 0xD8,
-    0x1F, 0x59, 0x17, 0xC9, 0x77, 0x01, 0x72, 0x67, 0x20, 0xBB, 0xA8, 0x8A, 0x9F, 0x29, 0x42, 0xF6,
-    0x9A, 0xDD, 0x75, 0x9C, 0x17, 0xEC, 0x43, 0xFB, 0x3B, 0xFD, 0x9A, 0x25, 0xF6, 0xD7, 0xA4, 0x42,
-    0x58, 0x50, 0xBE, 0xFA, 0x2E, 0x4F, 0x63, 0x90, 0x18, 0x8B, 0xF7, 0xA4, 0x13, 0xCB, 0xD1, 0xDC,
-    0xFA, 0xE3, 0x70, 0x9C, 0x4B, 0x93, 0x73, 0x5B, 0x69, 0x3A, 0x8F, 0xE8, 0xE4, 0x6F, 0x8B, 0xBE,
-    0xA9, 0x29, 0xF4, 0xAA, 0xF2, 0x5A, 0x9B, 0x52, 0xB2, 0x5C, 0x9C, 0xDC, 0xFB, 0x2E, 0xB5, 0x47,
-    0x29, 0x39, 0x12, 0x95, 0x91, 0x16, 0xBF, 0x07, 0x7B, 0x5C, 0xC9, 0xEE, 0x0B, 0x35, 0x79, 0xE3,
-    0xE2, 0x62, 0x27, 0xDF, 0x4A, 0x29, 0x0E, 0xE4, 0x02, 0xC2, 0x8C, 0x80, 0x28, 0x92, 0xD8, 0xE0,
-    0xBC, 0x88, 0x9B, 0x58, 0x7B, 0x04, 0xFC, 0x10, 0x32, 0x15, 0x76, 0x59, 0x98, 0x05, 0x85, 0xD7,
-    0x89, 0xB5, 0x99, 0xEF, 0xF8, 0x6C, 0xE7, 0x78, 0x75, 0x3F, 0x7F, 0x77, 0x3E, 0xA9, 0x75, 0x2E,
-    0xF9, 0x60, 0x9C, 0xC1, 0x27, 0xCA, 0x4A, 0xB8, 0xF7, 0xC6, 0x96, 0x5B, 0x7E, 0xC0, 0xED, 0x70,
-    0x46, 0x6E, 0x19, 0x00, 0xA1, 0x38, 0x8E, 0x26, 0xAD, 0x43, 0xEE, 0x37, 0xC3, 0xA5, 0xE3, 0x5A,
-    0x43, 0xCE, 0x9A, 0x7C, 0xF7, 0x49, 0x6B, 0x73, 0x00, 0xF5, 0xD7, 0x2D, 0x9D, 0xDD, 0x6B, 0x4A,
-    0xC8, 0xF1, 0x68, 0xEC, 0x93, 0x4A, 0x35, 0xA8, 0x89, 0xD2, 0x83, 0x26, 0x2A, 0xFE, 0x10, 0xC8,
-    0xE6, 0x65, 0x80, 0x61, 0x96, 0x57, 0xD0, 0x0D, 0x36, 0xE2, 0x81, 0xAA, 0xD9, 0xFF, 0x7C, 0x48,
-    0x64, 0x9B, 0xF6, 0xE6, 0xF5, 0xA7, 0x15, 0x70, 0x9E, 0xDD, 0x5B, 0xC8, 0xFD, 0x0E, 0xC1, 0xC0,
-    0x6E, 0x9E, 0x85, 0x20, 0xA2, 0xE5, 0xF0, 0x36, 0x18, 0x95, 0x79, 0x1C, 0xE1, 0xE4, 0x89, 0x71,
-    0x81, 0x91, 0xB0, 0x72, 0x7B, 0x6B, 0x9C, 0x70, 0xF3, 0x76, 0xD6, 0xBA, 0x1D, 0x7A, 0xE3, 0x4C,
-    0x7B, 0x59, 0x70, 0xF5, 0xD4, 0xE2, 0x3B, 0x24, 0xCC, 0xC5, 0x7E, 0xCA, 0xC3, 0x91, 0x87, 0x7B,
-    0x4F, 0x1B, 0x53, 0x32, 0xC1, 0xB1, 0xA4, 0x15, 0xA0, 0x10, 0xFF, 0xAC, 0x0E, 0x98, 0xC3, 0x46,
-    0x68, 0x22, 0x0D, 0x79, 0x56, 0xFB, 0x11, 0x3C, 0x73, 0xB1, 0x65, 0xEC, 0x15, 0x4D, 0x7B, 0x95,
-    0xE9, 0xE1, 0x02, 0xBA, 0x87, 0xB6, 0x18, 0x9B, 0x4F, 0xEC, 0x13, 0x8C, 0xFA, 0x6B, 0xCE, 0xE4,
-    0x59, 0xD9, 0x71, 0x47, 0xAC, 0x08, 0x15, 0x21, 0xF7, 0x2E, 0x8A, 0xEA, 0x2D, 0xA3, 0x88, 0xA5,
-    0x49, 0x7E, 0x70, 0x71, 0x30, 0x87, 0x4B, 0xB7, 0x15, 0x86, 0x7D, 0xEB, 0x69, 0x63, 0x7F, 0xBE,
-    0x63, 0xA6, 0x8D, 0x0E, 0xDC, 0x9A, 0x31, 0x4E, 0x3E, 0x41, 0x08, 0xC3, 0x0D, 0x31, 0xF0, 0x54,
-    0x3B, 0xBF, 0x94, 0x00, 0xFB, 0x58, 0x3B, 0xA3, 0x93, 0x73, 0xE4, 0xFB, 0x08, 0xD5, 0x99, 0x98,
-    0xAE, 0x5D, 0x52, 0xE3, 0x8A, 0x59, 0xDC, 0xEF, 0x48, 0xFC, 0xD6, 0x07, 0x36, 0x48, 0xFD, 0x68,
-    0xB7, 0x4D, 0x9C, 0x55, 0x90, 0x5E, 0x19, 0xC3, 0xD6, 0xB9, 0x19, 0x4F, 0x72, 0xB9, 0x5B, 0xC6,
-    0x0C, 0x99, 0xBB, 0xB9, 0x34, 0x49, 0xB3, 0x36, 0xB7, 0x6F, 0x3A, 0x23, 0x23, 0xDE, 0xFD, 0x13,
-    0x4B, 0x24, 0x99, 0xD3, 0x08, 0x89, 0x96, 0x0F, 0xDF, 0xB4, 0x6D, 0x87, 0x33, 0x92, 0xE5, 0xB9,
-    0xB3, 0x8F, 0x2C, 0x16, 0x0B, 0x2B, 0x3F, 0x23, 0x93, 0xAB, 0x2D, 0xD5, 0xD4, 0xA8, 0x55, 0x3B,
-    0x04, 0xC5, 0x7D, 0x3A, 0xE5, 0x55, 0x07, 0xCC, 0x11, 0x8E, 0x9B, 0x68, 0xD7, 0x2B, 0x0B, 0x67,
-    0xC8, 0x90, 0x7F, 0xCD, 0xE1, 0xEF, 0xBA, 0x6C, 0x9F, 0xD0, 0xC2, 0x12, 0xB4, 0xCB, 0xE8, 0xFC,
-    0x6A, 0xED, 0xDB, 0x94, 0x3E, 0xA7, 0x3D, 0x26, 0x86, 0x69, 0xA3, 0xF2, 0x6B, 0x6F, 0x2D, 0x76,
-    0x76, 0xCC, 0x0C, 0xFD, 0x89, 0xA0, 0xBB, 0xF2, 0xA8, 0x0D, 0xB8, 0x1B, 0x72, 0xA6, 0x6C, 0xA0,
-    0xB5, 0x91, 0x75, 0x4E, 0x7E, 0xE4, 0x27, 0x99, 0x46, 0x42, 0xDD, 0x7D, 0xCE, 0x74, 0x37, 0xC8,
-    0x82, 0x7B, 0xD8, 0xCF, 0x43, 0x19, 0x13, 0xBF, 0x86, 0xD9, 0x18, 0x74, 0xC1, 0x32, 0xAE, 0xBD,
-    0x8D, 0xF4, 0x65, 0xF0, 0x1E, 0x93, 0x7C, 0x72, 0x3B, 0xF8, 0x6F, 0x06, 0xC3, 0x27, 0xD5, 0x0C,
-    0x7F, 0x5A, 0x87, 0xA5, 0x55, 0x50, 0x60, 0xB8, 0x91, 0x54, 0xD8, 0x5B, 0x6C, 0x6F, 0x17, 0xE6,
-    0xF2, 0x8E, 0xF1, 0x7F, 0x0D, 0xE9, 0xF0, 0x6A, 0xEF, 0xF5, 0x5C, 0xAA, 0x33, 0xA3, 0x8A, 0xBD,
-    0x61, 0xDD, 0x84, 0x39, 0x37, 0x01, 0xBA, 0xB4, 0x72, 0x4B, 0x15, 0x21, 0x6D, 0x04, 0x91, 0xBD,
-    0x65, 0xD0, 0x98, 0xDB, 0x7F, 0xFE, 0xB9, 0x98, 0xE5, 0x0F, 0x2A, 0x26, 0xEA, 0x77, 0xF2, 0xE9,
-    0xC4, 0xAD, 0xB2, 0x3A, 0xDC, 0x4B, 0x20, 0x88, 0xB6, 0x0E, 0x2A, 0x88, 0xFB, 0xC2, 0x2C, 0xBF,
-    0x0C, 0x65, 0x8A, 0xD1, 0x92, 0x5E, 0x60, 0x68, 0x76, 0x63, 0x81, 0xE3, 0x96, 0xD2, 0x93, 0x00,
-    0xDA, 0x07, 0x6F, 0xCC, 0x4A, 0xC0, 0xB2, 0xA0, 0x03, 0xA5, 0x99, 0x95, 0x97, 0xBC, 0xD0, 0x88,
-    0x49, 0x7C, 0x97, 0xCE, 0x48, 0x9C, 0x31, 0x73, 0x6E, 0xA0, 0xDA, 0x1C, 0xDE, 0x1E, 0xA6, 0x9C,
-    0x4F, 0xFD, 0xB5, 0x07, 0xA9, 0xCA, 0xAB, 0x68, 0xDB, 0x2F, 0x6A, 0x13, 0xFC, 0x8E, 0x5E, 0xD1,
-    0xB2, 0x0E, 0x06, 0xED, 0xD5, 0x93, 0xD3, 0x8B, 0xF6, 0x1C, 0xE4, 0x9F, 0x79, 0xD0, 0xEF, 0x43,
-    0xBC, 0xDF, 0xF2, 0xD7, 0xC6, 0x42, 0x36, 0x4C, 0xAF, 0x40, 0xF9, 0x00, 0x2D, 0xD4, 0xE1, 0x8B,
-    0xDC, 0x85, 0x86, 0xE1, 0x03, 0xE2, 0xA3, 0x73, 0x98, 0xBA, 0x95, 0x80, 0x27, 0xB7, 0x0D, 0xA7,
-    0xD6, 0x1B, 0x1E, 0x36, 0xD1, 0xDF, 0x03, 0xE6, 0x8E, 0x26, 0xFF, 0x3A, 0x97, 0xA7, 0x70, 0x79,
-    0xE5, 0x96, 0xFC, 0x64, 0xF4, 0x62, 0xFD, 0xC8, 0x2E, 0xB6, 0x5B, 0x82, 0xA1, 0x13, 0x80, 0xB7,
-    0x51, 0x06, 0x4E, 0x2B, 0xB4, 0x95, 0xF1, 0xEA, 0x67, 0xCC, 0xB4, 0x4D, 0x89, 0xF9, 0x97, 0xCA,
-    0x14, 0x18, 0xA6, 0x2C, 0x4B, 0x49, 0xCC, 0x61, 0xC2, 0x8B, 0xF1, 0x6B, 0xA8, 0xF8, 0x0D, 0x37,
-    0x28, 0xE7, 0xAE, 0xFF, 0x5A, 0x06, 0xC2, 0x4C, 0x60, 0xEF, 0x39, 0x65, 0x79, 0x73, 0x59, 0x6D,
-    0x9F, 0x5C, 0x38, 0xD9, 0x9D, 0x00, 0x61, 0x1E, 0x07, 0x8F, 0x7D, 0x4A, 0x32, 0x64, 0xB5, 0xF8,
-    0x73, 0x92, 0x81, 0xF9, 0x30, 0x39, 0xA8, 0xB8, 0x1D, 0x1D, 0xE3, 0x54, 0x7E, 0xBF, 0x26, 0xE0,
-    0xF4, 0xF3, 0x31, 0x08, 0xD2, 0xC7, 0x71, 0x13, 0x10, 0x1B, 0x8C, 0x1D, 0x6E, 0x57, 0x3C, 0x4C,
-    0xDB, 0xC9, 0xCC, 0xF5, 0xD7, 0x05, 0x9C, 0x39, 0x30, 0xA5, 0x33, 0x6B, 0x19, 0xFC, 0x2D, 0x3E,
-    0xF7, 0xE9, 0x66, 0xE0, 0x9F, 0x58, 0x7C, 0x7B, 0x5A, 0xC2, 0xE2, 0x4F, 0x73, 0xF3, 0xA3, 0x5C,
-    0xFB, 0xB5, 0xDA, 0xAB, 0xA9, 0xD0, 0x42, 0xB8, 0x5E, 0x61, 0x42, 0x27, 0xA7, 0x6E, 0x2B, 0x9D,
-    0xEE, 0xD3, 0x85, 0x1D, 0x9A, 0x22, 0x02, 0x72, 0xE8, 0x06, 0xD8, 0x8B, 0x70, 0xCE, 0x6C, 0x2E,
-    0x00, 0xFD, 0x48, 0xB6, 0x7B, 0x71, 0x86, 0xAB, 0x76, 0x00, 0x5A, 0xEA, 0xAF, 0x5A, 0x2C, 0x39,
-    0xE6, 0xB7, 0x00, 0xC4, 0xF7, 0xE3, 0x06, 0xA4, 0x5C, 0x77, 0xAD, 0x8C, 0x49, 0x9F, 0x61, 0x6E,
-    0xA5, 0x4E, 0x6E, 0x79, 0x9B, 0x58, 0xEB, 0x48, 0xE6, 0x5C, 0xA9, 0x31, 0xB3, 0x90, 0x96, 0x78,
-    0x06, 0x73, 0x27, 0xB9, 0x2C, 0xE2, 0x45, 0x3A, 0x1A, 0x73, 0xB7, 0xA9, 0x8A, 0xB7, 0xDA, 0x54,
-    0x45, 0xBB, 0xAB, 0xC4, 0xAF, 0x2D, 0xA9, 0x92, 0x71, 0xCD, 0x53, 0x1C, 0xDB, 0xA8, 0x9B, 0x51,
-    0xC6, 0x69, 0x09, 0x1B, 0x5E, 0xFB, 0x97, 0xD9, 0xFF, 0x7F, 0x0B, 0xC9, 0xEE, 0x06, 0x83, 0xDC,
-    0x2B, 0xAA, 0x7C, 0x00, 0x06, 0x09, 0x97, 0xB0, 0xC2, 0xC8, 0x20, 0x5E, 0xCF, 0x9D, 0xB4, 0xAE,
-    0xEE, 0x2D, 0x16, 0x5A, 0x79, 0x79, 0xF5, 0xFA, 0x7C, 0x2E, 0x4E, 0xD1, 0x86, 0x3C, 0x68, 0x4F,
-    0xF2, 0x94, 0x76, 0xD8, 0x5B, 0xDE, 0xCC, 0x20, 0xB2, 0x32, 0xA9, 0xBD, 0x29, 0x9F, 0x54, 0xDC,
-    0x4A, 0x38, 0xDD, 0xAB, 0xFD, 0xEE, 0x28, 0x63, 0x4A, 0x28, 0x05, 0xB4, 0x2B, 0x6C, 0x93, 0x6A,
-    0x53, 0xE4, 0x60, 0x0C, 0x0F, 0x4B, 0xA7, 0x8F, 0xFB, 0x58, 0x72, 0xBD, 0xEF, 0x41, 0xC1, 0xE4,
-    0x7B, 0xAA, 0x7B, 0xA5, 0xE0, 0xD1, 0xDB, 0xD7, 0x3F, 0x0C, 0xA3, 0xAF, 0x35, 0xE9, 0x97, 0x97,
-    0x01, 0x75, 0x69, 0xA5, 0x5C, 0x7E, 0x29, 0x33, 0x2D, 0x10, 0x72, 0xFA, 0xCD, 0x69, 0x89, 0x1B,
-    0x96, 0x0C, 0xDD, 0xBF, 0x7F, 0x2A, 0xC2, 0x3C, 0xB2, 0x90, 0xBB, 0x57, 0xFB, 0x34, 0x2E, 0x6F,
-    0xA3, 0x4E, 0xEE, 0xE9, 0x8E, 0x3F, 0xD3, 0xDF, 0xBB, 0xA2, 0x51, 0x16, 0x48, 0x6F, 0xB8, 0x72,
-    0xD6, 0x86, 0xF5, 0x1F, 0x02, 0x7D, 0x05, 0xAE, 0xE9, 0xC2, 0x70, 0xC5, 0xC8, 0xE2, 0xC1, 0x9B,
-    0x50, 0xF5, 0x7D, 0x41, 0x64, 0x63, 0xCE, 0x7B, 0x94, 0x3A, 0xA2, 0x6C, 0x44, 0xDB, 0x8C, 0xEE,
-    0x22, 0x86, 0x5C, 0xB5, 0xA3, 0x84, 0x86, 0x60, 0x56, 0x1C, 0xBE, 0xCF, 0x09, 0x6E, 0x32, 0x2E,
-    0x04, 0xE1, 0xF2, 0xD9, 0x19, 0xC5, 0xAD, 0xDF, 0x32, 0xAE, 0xC4, 0x6C, 0xB3, 0xE8, 0x6B, 0x78,
-    0xDC, 0x67, 0xE9, 0x48, 0xFC, 0xD8, 0x01, 0xFF, 0xC4, 0xBD, 0x27, 0x7D, 0x92, 0x11, 0x77, 0x8B,
-    0x43, 0x1C, 0x7B, 0x87, 0x55, 0x7C, 0x0B, 0xF1, 0x71, 0x5F, 0x6C, 0x14, 0x2C, 0xF6, 0xC5, 0xC8,
-    0xB5, 0xEE, 0x0F, 0xD0, 0xA5, 0xC5, 0x78, 0x2B, 0x8E, 0xFE, 0x10, 0x36, 0x86, 0xFA, 0xD0, 0xFF,
-    0x26, 0x49, 0x74, 0xDB, 0x3C, 0xCF, 0x4F, 0x7D, 0xD0, 0xDD, 0x2C, 0xCF, 0x4F, 0xA9, 0xF3, 0xCB,
-    0xC9, 0x9C, 0x72, 0xC9, 0x48, 0xF4, 0xB2, 0x06, 0x78, 0xE1, 0x27, 0x37, 0xAD, 0x9F, 0x46, 0x24,
-    0x9F, 0x20, 0xBE, 0xD1, 0x9C, 0xA3, 0xD7, 0xF0, 0xC4, 0xED, 0xDC, 0x0F, 0x7F, 0x58, 0x7B, 0xEC,
-    0xAE, 0x80, 0xC8, 0xE8, 0x56, 0xAF, 0xF0, 0xAF, 0x16, 0x32, 0x08, 0x5D, 0x98, 0x83, 0x08, 0x65,
-    0x83, 0x83, 0x3E, 0xE2, 0xFD, 0xA9, 0x3E, 0xF4, 0xE5, 0xB1, 0xDA, 0x1C, 0xA2, 0x9A, 0x42, 0x75,
-    0xFE, 0xF4, 0xC5, 0xA3, 0xAF, 0x84, 0x62, 0x4C, 0xBB, 0xDA, 0x3D, 0x92, 0xFD, 0x1E, 0xAB, 0x67,
-    0x3B, 0xC7, 0x68, 0xF4, 0x4D, 0x93, 0xBB, 0x8E, 0x19, 0x2E, 0xE9, 0x63, 0x46, 0x56, 0xD0, 0x4D,
-    0x7F, 0xE0, 0xEF, 0xC3, 0xC9, 0x53, 0x2D, 0xEE, 0x20, 0x4F, 0x35, 0x2F, 0x72, 0x2E, 0x00, 0xA8,
-    0x18, 0xD9, 0x72, 0x1B, 0x74, 0x44, 0x9B, 0x65, 0xB5, 0xCE, 0x4C, 0xFB, 0x13, 0xB7, 0x69, 0x81,
-    0xB8, 0xFF, 0xD3, 0xE7, 0xEF, 0xEE, 0x76, 0x79, 0x78, 0x33, 0x8C, 0xF4, 0xB0, 0x5D, 0xE5, 0x0D,
-    0x28, 0x14, 0xAD, 0xF8, 0xD5, 0x6C, 0x25, 0xA9, 0xF7, 0x17, 0x93, 0xCD, 0xBE, 0x73, 0x87, 0x04,
-    0x93, 0x12, 0xBB, 0x99, 0x60, 0x8B, 0x72, 0x5C, 0xB8, 0x50, 0x02, 0xE0, 0x61, 0x3E, 0xD0, 0xE5,
-    0x78, 0x59, 0x7F, 0x81, 0xB2, 0x13, 0xC2, 0x6F, 0x93, 0x9B, 0x08, 0x36, 0xBB, 0xFD, 0xF6, 0xF6,
-    0xEF, 0x41, 0x86, 0xE0, 0x17, 0x13, 0x19, 0xF4, 0x37, 0x34, 0x67, 0x17, 0xED, 0x5B, 0xF8, 0xFA,
-    0x53, 0x92, 0xE1, 0x45, 0xA6, 0xEB, 0x6A, 0xB1, 0x0A, 0x73, 0x92, 0x6E, 0xDC, 0x35, 0xF0, 0xFF,
-    0x01, 0xB5, 0x56, 0x3F, 0x8C, 0x1D, 0x47, 0x19, 0xFF, 0xED, 0x8E, 0xEF, 0x56, 0x7A, 0xA3, 0xF3,
-    0x5C, 0x71, 0x96, 0x22, 0xDB, 0xF1, 0x52, 0x50, 0x00, 0xB2, 0x6F, 0x3B, 0x74, 0xC5, 0xDD, 0x9B,
-    0xB1, 0x2D, 0x25, 0x45, 0x0A, 0xAE, 0xE0, 0xCA, 0xA0, 0x48, 0x50, 0x84, 0x02, 0x72, 0x85, 0x91,
-    0x5C, 0x9C, 0x6F, 0x37, 0x49, 0x91, 0x92, 0x93, 0x10, 0x1D, 0xC5, 0x53, 0x44, 0x81, 0x92, 0xC2,
-    0x2E, 0x5C, 0x5C, 0xF1, 0x9E, 0xDF, 0x18, 0x17, 0x96, 0xA0, 0x60, 0x09, 0x25, 0x05, 0x1B, 0x82,
-    0x1B, 0xA7, 0xF0, 0x26, 0x2C, 0x68, 0x6D, 0xE6, 0xED, 0xE4, 0x37, 0xBB, 0xEF, 0x62, 0x1B, 0x09,
-    0x84, 0x12, 0x33, 0x6F, 0xDF, 0xEE, 0xCC, 0x7E, 0xF3, 0xCD, 0xF7, 0xFF, 0xF7, 0xED, 0xE8, 0x83,
-    0x67, 0xC6, 0x04, 0xD8, 0xBA, 0x78, 0xE1, 0x76, 0x52, 0xCA, 0x32, 0x6B, 0xBE, 0xFB, 0xAB, 0xB8,
-    0xF8, 0xDF, 0x7F, 0x00, 0xCE, 0x03, 0xD2, 0x20, 0x2E, 0x81, 0x6B, 0xDA, 0xBB, 0x9F, 0xED, 0x1D,
-    0xEF, 0xA3, 0xDA, 0x17, 0xC5, 0xFE, 0x69, 0xEC, 0x6F, 0x60, 0x1F, 0x5F, 0xFD, 0x0A, 0x63, 0x0B,
-    0xA8, 0x90, 0x14, 0xB8, 0x00, 0xF0, 0xF0, 0xCD, 0xBD, 0xD7, 0x25, 0xD6, 0x62, 0xBB, 0x86, 0x5B,
-    0x6B, 0xD8, 0x58, 0x03, 0xBE, 0xCE, 0x85, 0xDC, 0xFF, 0xD5, 0xFB, 0xFB, 0xBE, 0x7B, 0x3A, 0x39,
-    0xB3, 0xB7, 0xB7, 0x97, 0x7B, 0xEF, 0xC3, 0x3F, 0x38, 0x26, 0x3C, 0x1F, 0xF2, 0xF9, 0xEB, 0x13,
-    0x4F, 0xCD, 0xFD, 0x30, 0x9E, 0x2C, 0xD7, 0xBF, 0xF9, 0x8F, 0x84, 0x37, 0xA3, 0xF7, 0x1B, 0xF5,
-    0xFB, 0x52, 0x67, 0xC6, 0xCD, 0xC4, 0xE7, 0x2F, 0x72, 0xFA, 0xD9, 0xEE, 0x8A, 0xA1, 0x9E, 0x7B,
-    0x9A, 0xE2, 0x1E, 0xF1, 0xDF, 0x60, 0x39, 0x4E, 0x5E, 0xB4, 0xFD, 0xCA, 0x8C, 0xA5, 0x6D, 0x32,
-    0x51, 0xE7, 0x49, 0x9D, 0xBF, 0xEB, 0x56, 0xB0, 0x22, 0x5A, 0x7D, 0xD7, 0x29, 0xEB, 0xD2, 0x2B,
-    0xF5, 0x8E, 0x2C, 0xD6, 0x91, 0x5D, 0x75, 0x99, 0xE5, 0x8B, 0x36, 0x15, 0xD5, 0xC1, 0x88, 0x74,
-    0x97, 0xBF, 0x57, 0xE7, 0xA2, 0xCE, 0xD0, 0x48, 0xBB, 0x03, 0x03, 0x13, 0xA1, 0x15, 0x76, 0x2A,
-    0xAA, 0x9D, 0x98, 0x2F, 0x5B, 0x65, 0x0F, 0x93, 0x3A, 0xBB, 0xEC, 0x54, 0x95, 0xBF, 0xE3, 0x54,
-    0xAD, 0x8B, 0xDD, 0x08, 0x2B, 0x58, 0xD7, 0x6F, 0x3B, 0x7D, 0xB7, 0x4B, 0xED, 0x5C, 0x85, 0x6B,
-    0x96, 0x9A, 0x29, 0xF7, 0xEE, 0x44, 0xF5, 0xB1, 0x28, 0xD7, 0x23, 0x64, 0xE6, 0x58, 0xFF, 0xB6,
-    0xCB, 0xAC, 0xEF, 0xA9, 0x87, 0xAA, 0x98, 0xA5, 0x70, 0xE3, 0xA8, 0x39, 0x10, 0xD5, 0x44, 0x14,
-    0x64, 0xE7, 0x41, 0xAF, 0xB6, 0xD9, 0x1F, 0xC3, 0xA9, 0xA2, 0x51, 0xF6, 0x4E, 0x5C, 0xAB, 0x82,
-    0xF2, 0xA4, 0x1D, 0xA3, 0x49, 0xEC, 0x29, 0xAC, 0xF7, 0xC6, 0xCC, 0x81, 0xD8, 0x01, 0x49, 0x0D,
-    0xA4, 0xCC, 0xB9, 0x31, 0x56, 0x4C, 0xB3, 0xAA, 0xFF, 0xE5, 0x17, 0x34, 0xF7, 0x9F, 0x0F, 0x76,
-    0xCE, 0x5A, 0xD0, 0x0B, 0x82, 0x29, 0xA8, 0x4C, 0xA0, 0x02, 0xF4, 0x81, 0xA8, 0xB8, 0xEC, 0x37,
-    0x23, 0x3A, 0xE1, 0xB5, 0xC0, 0xB7, 0x97, 0xDE, 0xFA, 0xEF, 0x47, 0x8E, 0x79, 0x64, 0xFB, 0x94,
-    0x29, 0x1F, 0xCE, 0xE0, 0x91, 0xBB, 0xAA, 0xF8, 0xA1, 0x9F, 0xFB, 0xBF, 0x70, 0xD7, 0x4F, 0x7F,
-    0xF1, 0xF1, 0xB4, 0x97, 0x70, 0xF8, 0x54, 0x42, 0x36, 0x48, 0x58, 0x3D, 0xCA, 0x5A, 0xED, 0xF2,
-    0x45, 0xEE, 0x74, 0x2B, 0x8F, 0xBE, 0xC5, 0xD8, 0x14, 0xD0, 0x2D, 0x23, 0x54, 0x68, 0xDF, 0x6A,
-    0xDF, 0x69, 0xBF, 0xD0, 0xBE, 0xD4, 0x0B, 0xE8, 0x12, 0x97, 0x7A, 0x75, 0xB2, 0xCC, 0x77, 0x8B,
-    0x0D, 0xAA, 0xA2, 0xEE, 0x2D, 0x44, 0xA7, 0x4B, 0xFD, 0x89, 0x8B, 0x17, 0x8C, 0x1A, 0x32, 0x60,
-    0x8A, 0xF8, 0xF3, 0x0E, 0xB2, 0x45, 0xF6, 0xC8, 0x41, 0xD7, 0xF0, 0x8F, 0x4A, 0xCC, 0x4D, 0xCC,
-    0xED, 0xD8, 0x45, 0x64, 0x90, 0xFE, 0xB9, 0xF3, 0xF9, 0xF3, 0x95, 0xB8, 0x95, 0xBA, 0x6B, 0x2B,
-    0xFF, 0xB7, 0x4A, 0x6C, 0xCE, 0x6F, 0xEE, 0xAE, 0xBD, 0xC0, 0x4A, 0xA4, 0x19, 0xA9, 0x49, 0x1C,
-    0x1E, 0xEE, 0x6F, 0xBD, 0xFF, 0xBB, 0xD1, 0xC8, 0x4C, 0xD6, 0x47, 0xC0, 0x04, 0x5F, 0xE9, 0xC6,
-    0x31, 0x29, 0x21, 0xEE, 0x17, 0x50, 0xA7, 0x81, 0xED, 0xAD, 0xB9, 0xAF, 0x3F, 0xDD, 0xFB, 0xC9,
-    0xC5, 0x49, 0xF2, 0xDA, 0x28, 0xFA, 0xC8, 0x4E, 0xAE, 0xDD, 0x1A, 0x9D, 0x3A, 0xC5, 0x9D, 0xFD,
-    0xD6, 0xAF, 0xF9, 0xE8, 0xC7, 0xFE, 0x04, 0x97, 0xB6, 0x21, 0xBF, 0x87, 0xF8, 0x9E, 0xC5, 0x2D,
-    0xEF, 0x3F, 0x79, 0xEF, 0x97, 0x3F, 0x38, 0xFD, 0x32, 0x26, 0x5B, 0xD7, 0x46, 0xF8, 0xB8, 0x9C,
-    0x44, 0xD1, 0x0B, 0x10, 0xF4, 0xAC, 0x3C, 0x7C, 0xA3, 0xBF, 0x47, 0x77, 0x18, 0xE9, 0x7A, 0x48,
-    0x1D, 0x5F, 0xD0, 0x7D, 0x61, 0x16, 0xB7, 0xB9, 0xC1, 0x50, 0xFE, 0xAA, 0xD0, 0x48, 0x6C, 0x3F,
-    0x9D, 0xF2, 0x37, 0xEE, 0x67, 0xA2, 0x8E, 0xEB, 0x68, 0x60, 0x52, 0x36, 0x29, 0x55, 0xCF, 0x44,
-    0x5A, 0x6A, 0x8E, 0x87, 0xB3, 0x1D, 0xA6, 0xC2, 0x7E, 0xB9, 0xF5, 0x12, 0x7E, 0x04, 0x9C, 0x35,
-    0xB2, 0x54, 0x6F, 0xD7, 0x59, 0x87, 0xC4, 0x97, 0x84, 0x0F, 0x15, 0x3F, 0xF1, 0xC8, 0x6F, 0x96,
-    0x99, 0x2F, 0xAF, 0xA7, 0x66, 0x26, 0x6A, 0x65, 0x53, 0x27, 0xAC, 0x43, 0x9B, 0x1A, 0xE6, 0x2A,
-    0x36, 0x45, 0x25, 0xEA, 0x29, 0x6E, 0x50, 0xC5, 0x3A, 0x35, 0xEA, 0x5E, 0x1D, 0x35, 0xA1, 0x2C,
-    0x6F, 0x20, 0x0B, 0x22, 0xA9, 0x0D, 0xD7, 0x4E, 0x07, 0x85, 0x45, 0xC9, 0xAD, 0x15, 0x45, 0x06,
-    0x15, 0x78, 0xCA, 0x95, 0x46, 0xD4, 0x64, 0x22, 0x66, 0x38, 0x41, 0xD6, 0x50, 0x5A, 0xFA, 0x66,
-    0x29, 0x9F, 0xB4, 0xC1, 0x04, 0xB0, 0x58, 0x24, 0x0D, 0x0D, 0xD9, 0x7D, 0xC6, 0x20, 0xDA, 0xE5,
-    0xF9, 0x5F, 0xBA, 0x04, 0x47, 0xB2, 0xD4, 0x97, 0x97, 0x18, 0x52, 0x4C, 0xA3, 0xDE, 0x84, 0xA3,
-    0x11, 0x66, 0xA2, 0xD2, 0x57, 0x5C, 0x6A, 0x3B, 0x52, 0x92, 0x5A, 0x5F, 0x6D, 0x52, 0x4B, 0x18,
-    0x9B, 0x8A, 0xF2, 0x3C, 0x73, 0x79, 0xB9, 0xE7, 0x8D, 0x38, 0xB0, 0x88, 0x26, 0xB3, 0x0B, 0x6E,
-    0x79, 0x67, 0x38, 0x24, 0xED, 0x17, 0x3C, 0xB1, 0x1C, 0x53, 0x15, 0x92, 0xCB, 0x0C, 0xAC, 0xA4,
-    0xF3, 0x83, 0xB4, 0x97, 0x08, 0x52, 0x55, 0x6A, 0x75, 0x91, 0x63, 0x06, 0x17, 0xD5, 0x31, 0xE5,
-    0xBD, 0x84, 0x37, 0xA4, 0x4D, 0x4D, 0x17, 0xBB, 0xA4, 0x4E, 0x4B, 0x5D, 0x74, 0x11, 0x8D, 0x60,
-    0x3F, 0x65, 0x18, 0xB8, 0x43, 0x94, 0x12, 0x3D, 0x33, 0xB7, 0x45, 0x45, 0x86, 0x1B, 0x51, 0xAB,
-    0xAA, 0xCC, 0xE6, 0x91, 0x4B, 0x1A, 0x55, 0x71, 0x77, 0x60, 0x53, 0x56, 0x9B, 0x59, 0xDC, 0xF6,
-    0x13, 0xCC, 0x02, 0x93, 0x2A, 0x2E, 0xB2, 0xFC, 0xCA, 0x41, 0xEA, 0x2A, 0x2D, 0xA6, 0x2B, 0xF2,
-    0x0A, 0xE9, 0xCF, 0x8B, 0xA4, 0x1A, 0x73, 0xD1, 0x6E, 0x06, 0xD0, 0x3B, 0x45, 0xF7, 0xF5, 0x52,
-    0xE7, 0x85, 0x27, 0xAC, 0x65, 0x36, 0xA9, 0x49, 0x23, 0xA0, 0xAD, 0x07, 0x38, 0x6C, 0x09, 0x60,
-    0x04, 0xBA, 0xCC, 0x8A, 0x46, 0x10, 0x52, 0x08, 0x54, 0x0C, 0x15, 0x36, 0x96, 0x8E, 0x0B, 0x4A,
-    0x85, 0xC4, 0x35, 0x71, 0xB5, 0x8D, 0x36, 0xAE, 0x04, 0x75, 0xAA, 0x70, 0x20, 0x2F, 0xD7, 0xCC,
-    0x9E, 0x90, 0x2A, 0xD7, 0xC1, 0x5B, 0x52, 0x84, 0xA4, 0x39, 0xE6, 0xCD, 0x49, 0x46, 0x46, 0xA3,
-    0x95, 0x95, 0x2C, 0xBC, 0x61, 0x64, 0x6F, 0x87, 0xF6, 0x73, 0x5B, 0x05, 0x72, 0xD8, 0x79, 0x0C,
-    0x4E, 0xAF, 0x2B, 0x53, 0xE3, 0x3A, 0x35, 0xC2, 0x01, 0xDA, 0xA8, 0xDE, 0x26, 0xF1, 0x42, 0x10,
-    0x34, 0xC4, 0x05, 0xA3, 0x22, 0x9E, 0x74, 0xD0, 0xEF, 0x36, 0x58, 0xA4, 0x65, 0xD2, 0xE4, 0x48,
-    0xEF, 0x3A, 0x30, 0x3E, 0x11, 0x23, 0x45, 0xAF, 0x33, 0x15, 0x88, 0x72, 0x4C, 0x05, 0xF6, 0x26,
-    0xF1, 0xFC, 0x32, 0xF4, 0x21, 0x69, 0xA7, 0xC4, 0x44, 0xB3, 0x6C, 0x0C, 0x1C, 0x3F, 0xC6, 0xE8,
-    0xAA, 0x83, 0x57, 0xB5, 0x70, 0xDA, 0xAA, 0x7A, 0x83, 0x98, 0xE9, 0x97, 0x3D, 0xFC, 0x01, 0xDB,
-    0xE4, 0x6E, 0xFE, 0x78, 0xDE, 0xE5, 0x8B, 0xDE, 0xF7, 0x43, 0x6F, 0x38, 0x18, 0xFA, 0x43, 0xB0,
-    0x2E, 0xB4, 0x0C, 0x69, 0x87, 0xB6, 0x11, 0x92, 0x77, 0xBB, 0xB7, 0x03, 0xC1, 0x92, 0x90, 0x68,
-    0xC9, 0x92, 0x94, 0x3E, 0x4F, 0x0A, 0x9D, 0xA5, 0x27, 0x15, 0x03, 0xD7, 0x4E, 0x5F, 0x64, 0xC0,
-    0x37, 0x97, 0x1A, 0x9D, 0xFB, 0x1B, 0xA2, 0xCE, 0x08, 0x76, 0xE6, 0x9C, 0xA5, 0xE2, 0x4B, 0xE9,
-    0x9D, 0x78, 0xE8, 0x71, 0x78, 0xB3, 0xEE, 0x5B, 0x0E, 0x7B, 0x81, 0x2C, 0x43, 0xAD, 0x05, 0x6D,
-    0xA8, 0x41, 0x5C, 0xF5, 0x33, 0xDD, 0x1F, 0x2C, 0xB9, 0x98, 0xE1, 0xDC, 0x02, 0xB1, 0xB7, 0xB9,
-    0x2F, 0xA4, 0x6F, 0x95, 0xAF, 0xE0, 0x17, 0xF0, 0x25, 0xD4, 0xE2, 0x84, 0x91, 0x26, 0xC8, 0x02,
-    0xA1, 0x54, 0x39, 0x5B, 0x7F, 0xAE, 0x14, 0x06, 0x74, 0x20, 0x62, 0x7C, 0x87, 0xB9, 0x52, 0x84,
-    0xAE, 0x21, 0xC9, 0x30, 0x2F, 0xFA, 0x45, 0xD3, 0x17, 0xCE, 0x32, 0xF8, 0x67, 0x5F, 0x79, 0x4C,
-    0x1B, 0xFE, 0x44, 0x35, 0xE5, 0x67, 0xDE, 0x9B, 0xD8, 0x8D, 0xA9, 0xE0, 0x1C, 0x7D, 0x0A, 0x51,
-    0x50, 0xD0, 0xA4, 0x8D, 0xE9, 0xA8, 0x4D, 0xDC, 0x09, 0x78, 0x91, 0x91, 0xBF, 0xA2, 0xFC, 0xB7,
-    0x9A, 0xA8, 0x49, 0xF8, 0x91, 0x71, 0x43, 0xF0, 0x96, 0x1A, 0xEA, 0xC5, 0xEA, 0xA0, 0x93, 0x9A,
-    0xE0, 0x92, 0x9D, 0xE0, 0x1F, 0x65, 0xFE, 0x5D, 0xA5, 0x37, 0x99, 0xBE, 0x05, 0x15, 0x48, 0xDA,
-    0x8C, 0x3E, 0xF0, 0x49, 0xC8, 0x63, 0xF3, 0x7D, 0xB0, 0xE7, 0x8E, 0xC2, 0x27, 0xA4, 0xAA, 0x08,
-    0x67, 0xA2, 0xA1, 0x99, 0xD1, 0x22, 0x38, 0x2C, 0x87, 0xFA, 0xD0, 0x85, 0xBE, 0x9B, 0xDD, 0x0F,
-    0x91, 0xF8, 0x87, 0x0B, 0x91, 0xA3, 0x7F, 0x20, 0xFF, 0xC0, 0x97, 0xE2, 0xEF, 0xE1, 0x65, 0xCB,
-    0x97, 0xE7, 0x16, 0x1A, 0x91, 0xEF, 0x94, 0x85, 0xEF, 0x98, 0x21, 0x9A, 0xC8, 0x12, 0x3C, 0x94,
-    0x85, 0xD8, 0x32, 0xAC, 0x0C, 0x99, 0x61, 0x75, 0x3C, 0x33, 0x56, 0x8F, 0x70, 0x16, 0xC2, 0x21,
-    0xA5, 0x4B, 0xC1, 0x86, 0xA3, 0x6D, 0xD4, 0x85, 0x0E, 0x7A, 0xE6, 0x84, 0xFE, 0x18, 0x51, 0x41,
-    0x5F, 0xA4, 0xF2, 0x81, 0xFF, 0xB4, 0xDD, 0xC6, 0x5B, 0xBE, 0xD8, 0xC5, 0xEA, 0x64, 0x09, 0x14,
-    0x26, 0x33, 0xAD, 0xB4, 0x87, 0x3D, 0x56, 0x48, 0xC2, 0x44, 0xCB, 0x67, 0x0F, 0x17, 0x19, 0x3F,
-    0xAC, 0x4A, 0x3E, 0x7B, 0xC4, 0x38, 0x24, 0xE8, 0x44, 0x03, 0xCC, 0x64, 0xF4, 0x14, 0xB6, 0x22,
-    0x7B, 0xFA, 0x44, 0xFE, 0x17, 0x6D, 0x52, 0x21, 0x6F, 0x14, 0x41, 0x14, 0xFE, 0x66, 0x97, 0x76,
-    0x13, 0x46, 0xAC, 0x42, 0x90, 0x8A, 0x41, 0x20, 0x08, 0x82, 0x35, 0x08, 0x44, 0x73, 0xB3, 0x29,
-    0x02, 0x81, 0x69, 0x08, 0x45, 0x80, 0x2D, 0x02, 0xD5, 0x5F, 0x70, 0xDD, 0x0B, 0x48, 0x4C, 0x7F,
-    0x02, 0x02, 0x43, 0x49, 0xF0, 0x4D, 0xEE, 0x6E, 0x87, 0x54, 0x20, 0x2A, 0x98, 0x84, 0xA0, 0x4E,
-    0x70, 0x02, 0x48, 0x50, 0x1D, 0x31, 0x85, 0xB9, 0xEB, 0xDC, 0x3E, 0xDE, 0x5C, 0x8F, 0x2A, 0x36,
-    0x2F, 0x93, 0xBC, 0x9D, 0xF7, 0xE6, 0x7B, 0xEF, 0xFB, 0x3E, 0x00, 0x68, 0x02, 0x5A, 0x32, 0xCD,
-    0x83, 0xA0, 0xA1, 0xD5, 0x40, 0x4E, 0xAC, 0xF8, 0xE3, 0xB0, 0x1F, 0xA1, 0x5A, 0x14, 0xA7, 0x26,
-    0xFB, 0xED, 0x11, 0x1B, 0x34, 0xE5, 0xB4, 0x11, 0x44, 0xB5, 0xEC, 0x70, 0xF9, 0x0D, 0x81, 0x96,
-    0xDB, 0x0D, 0xB4, 0x83, 0x1E, 0xA2, 0xAA, 0xA0, 0x1E, 0x9A, 0xF2, 0xA5, 0x2B, 0xCD, 0x50, 0xFE,
-    0x68, 0x1E, 0x11, 0x75, 0xB7, 0xDF, 0xCF, 0xEB, 0x54, 0x56, 0x01, 0xD2, 0xA4, 0x16, 0x49, 0x96,
-    0xBA, 0xF2, 0xF0, 0xC0, 0xA3, 0x84, 0xA0, 0x03, 0x45, 0x83, 0xF5, 0x05, 0x72, 0x6E, 0x4F, 0xC7,
-    0x3E, 0x9A, 0xCF, 0xE4, 0x1A, 0xBF, 0x7A, 0x7E, 0xC3, 0xA1, 0xFD, 0x9E, 0x07, 0x94, 0x16, 0x55,
-    0x0D, 0x7D, 0xC4, 0x53, 0xDA, 0xEE, 0x99, 0x8F, 0x22, 0x46, 0xA4, 0x18, 0xF1, 0x5C, 0x5B, 0xBE,
-    0x22, 0x57, 0x50, 0xCD, 0xE5, 0x15, 0x05, 0x4D, 0xB1, 0x77, 0x18, 0x37, 0x85, 0xBF, 0x9B, 0x4F,
-    0x51, 0x1A, 0xA8, 0x1A, 0x3D, 0xA0, 0x0F, 0x44, 0x08, 0x8F, 0xCC, 0x25, 0x10, 0xBE, 0xC9, 0xED,
-    0x0A, 0x41, 0x76, 0x82, 0xA7, 0x19, 0x0C, 0xFB, 0xC2, 0x87, 0xE2, 0x38, 0xEC, 0xE7, 0x64, 0x0B,
-    0x1A, 0x8C, 0x9A, 0x13, 0x5B, 0x35, 0xE8, 0x45, 0xCC, 0xBD, 0xFC, 0x42, 0x5D, 0x46, 0xAB, 0x7A,
-    0xB5, 0xC8, 0x68, 0xA1, 0x3E, 0xC6, 0xA1, 0x38, 0x77, 0x39, 0x99, 0xF2, 0x74, 0xA0, 0xF5, 0xCF,
-    0xA8, 0x69, 0xBA, 0xD1, 0x42, 0xF0, 0x9C, 0x26, 0x5B, 0xAC, 0x93, 0x2D, 0x43, 0xAA, 0xBD, 0xFA,
-    0x29, 0x08, 0x6A, 0x83, 0x68, 0xEF, 0x3B, 0xE1, 0x0B, 0x53, 0x58, 0x55, 0xAB, 0xBA, 0x0F, 0x46,
-    0xE2, 0xD4, 0xA6, 0xB4, 0xB1, 0xF4, 0x8A, 0x5E, 0x13, 0x70, 0xBD, 0x46, 0xBB, 0x00, 0x91, 0x1D,
-    0x67, 0x31, 0x49, 0x50, 0xCB, 0x89, 0x61, 0x84, 0x7F, 0x12, 0x4C, 0x58, 0x82, 0x00, 0xBE, 0x19,
-    0xCB, 0x39, 0x31, 0x07, 0x58, 0x7F, 0x07, 0x5C, 0xC1, 0x86, 0xD5, 0x31, 0x23, 0xC3, 0xEC, 0xCA,
-    0xFF, 0x1C, 0x7B, 0x33, 0x4D, 0x6E, 0xE7, 0x31, 0x5E, 0x30, 0xE3, 0x46, 0x9F, 0xBA, 0x51, 0xEE,
-    0x87, 0x99, 0xBF, 0x95, 0xF9, 0x44, 0x81, 0x5C, 0x12, 0x3A, 0x06, 0x67, 0xCC, 0xAD, 0x66, 0x78,
-    0x8A, 0x1C, 0xD7, 0x76, 0xB6, 0xC5, 0x2E, 0x9A, 0xAE, 0x98, 0x77, 0x77, 0x10, 0x6F, 0x30, 0x51,
-    0x55, 0x5D, 0x78, 0xDE, 0x9E, 0x45, 0x4B, 0x6C, 0x56, 0x89, 0x47, 0x39, 0x7D, 0x4A, 0x92, 0xA6,
-    0xF2, 0x2D, 0xEF, 0xB8, 0x9D, 0x7E, 0x80, 0x37, 0x68, 0x0D, 0x1A, 0x87, 0xDE, 0x10, 0xBA, 0x42,
-    0x25, 0x8D, 0xDA, 0x72, 0x4C, 0xAA, 0x24, 0x3A, 0x63, 0x0B, 0xAC, 0x3D, 0x39, 0xC3, 0xCA, 0x02,
-    0xC5, 0x80, 0x9B, 0x98, 0x70, 0x9A, 0x2E, 0xE5, 0x9F, 0x41, 0x75, 0xA2, 0x4D, 0x4F, 0x5E, 0xC8,
-    0xDF, 0x43, 0xF9, 0x75, 0x2F, 0xD0, 0x22, 0xFB, 0x05, 0x88, 0x03, 0x54, 0x5E, 0xB0, 0xDD, 0x3C,
-    0x94, 0x49, 0x23, 0x36, 0x54, 0xB7, 0xE4, 0x62, 0x11, 0x2E, 0xB4, 0xE7, 0x18, 0x23, 0xE8, 0x89,
-    0x2F, 0xC9, 0x8A, 0xA3, 0x44, 0x38, 0x6B, 0xCF, 0xB1, 0x89, 0x70, 0x2F, 0x73, 0x37, 0x0B, 0x1E,
-    0x78, 0x90, 0x20, 0x7B, 0x4B, 0xEC, 0x90, 0xE4, 0xBF, 0xD4, 0x5E, 0xB0, 0x13, 0x9F, 0xB3, 0x5D,
-    0xB6, 0x66, 0x6D, 0x59, 0xF7, 0xFB, 0xC2, 0x45, 0xF9, 0x71, 0x11, 0x05, 0x0B, 0x4A, 0x36, 0x56,
-    0x27, 0x46, 0x8D, 0x97, 0xDA, 0xCF, 0xD4, 0x31, 0x45, 0xF1, 0xA1, 0xC6, 0x2E, 0x74, 0x97, 0x77,
-    0x9D, 0xAA, 0x47, 0x11, 0x2C, 0xFC, 0xB9, 0x29, 0xBF, 0x19, 0xCD, 0x6E, 0xAB, 0xC8, 0xAE, 0x35,
-    0xC8, 0x02, 0x2A, 0x23, 0x23, 0xFB, 0x46, 0xBE, 0xC1, 0x5F, 0x4D, 0x51, 0x31, 0x4E, 0xC3, 0x40,
-    0x10, 0x9C, 0x8B, 0x11, 0x96, 0xA0, 0x70, 0x95, 0x34, 0x48, 0x84, 0x1E, 0x09, 0x7F, 0x20, 0xC8,
-    0x27, 0xE5, 0x03, 0x29, 0xE2, 0x8A, 0x82, 0x07, 0xD0, 0xD2, 0x46, 0xF1, 0x13, 0x68, 0xF8, 0x41,
-    0x2A, 0x37, 0xF9, 0x40, 0x12, 0xFB, 0x07, 0x24, 0x3F, 0xB0, 0x10, 0x34, 0xA9, 0x5C, 0xD0, 0x24,
-    0xBA, 0xDC, 0x32, 0xEB, 0x8B, 0x10, 0x96, 0x7C, 0x9A, 0xBB, 0x9D, 0x9B, 0x9D, 0x9D, 0xEB, 0xE7,
-    0x79, 0x3E, 0x16, 0x11, 0x77, 0xC3, 0xA5, 0x4E, 0xB6, 0x58, 0xE1, 0x84, 0x58, 0xC1, 0x88, 0xC0,
-    0x80, 0x00, 0x04, 0x08, 0x40, 0xC4, 0x23, 0x11, 0xD9, 0xC2, 0xE7, 0xD3, 0xBF, 0x92, 0x79, 0xFE,
-    0xB6, 0xC8, 0x84, 0xEC, 0xE5, 0xBE, 0xF8, 0x47, 0xF6, 0x16, 0x3D, 0x6A, 0xB2, 0xE4, 0xB8, 0xC3,
-    0xE5, 0x81, 0x54, 0x11, 0x16, 0x8F, 0x9E, 0x2C, 0xE3, 0x10, 0x37, 0xBD, 0x16, 0xA9, 0xBD, 0x2E,
-    0xE0, 0x70, 0x81, 0xA8, 0x21, 0x69, 0x48, 0x01, 0xAC, 0x31, 0x61, 0x27, 0x29, 0x22, 0xA1, 0x28,
-    0x32, 0x9E, 0xF4, 0x4F, 0xB9, 0xA5, 0x96, 0xE0, 0x6A, 0xB9, 0x5F, 0x28, 0x01, 0x88, 0x5A, 0xED,
-    0x53, 0x73, 0x99, 0xF1, 0xBF, 0x3F, 0x96, 0xE5, 0x8E, 0x04, 0x19, 0xFB, 0x4A, 0x5C, 0x5C, 0xA0,
-    0x6F, 0x07, 0x4B, 0x1A, 0xD0, 0x8F, 0x32, 0xB2, 0xED, 0x50, 0x2C, 0xEF, 0x55, 0xD3, 0x21, 0xBA,
-    0x4C, 0xEB, 0x50, 0xFD, 0x41, 0x56, 0x74, 0x88, 0xA6, 0xAB, 0x50, 0xCC, 0xAC, 0x71, 0x51, 0x1D,
-    0x68, 0x71, 0x33, 0x3C, 0xD3, 0xD2, 0x62, 0x75, 0xA6, 0xB9, 0xF8, 0xB8, 0xE8, 0x79, 0x9B, 0xD9,
-    0xE1, 0xA7, 0x48, 0x33, 0x97, 0xC2, 0x3F, 0xF9, 0xCB, 0xAA, 0x8C, 0x9A, 0x87, 0x48, 0x5B, 0x39,
-    0x0C, 0xF1, 0x9A, 0xC8, 0x97, 0x7A, 0x9C, 0xA9, 0x5A, 0x67, 0xD4, 0x87, 0x68, 0x32, 0x86, 0xB2,
-    0xA5, 0x1A, 0x48, 0x33, 0xD2, 0x6A, 0x52, 0x3A, 0x4A, 0xDA, 0x9C, 0x69, 0x36, 0xA9, 0x03, 0x2D,
-    0x2E, 0xB2, 0x98, 0x91, 0x61, 0x83, 0x5B, 0x1C, 0x34, 0x47, 0x23, 0x6E, 0xB3, 0xFC, 0xD0, 0x04,
-    0x7B, 0xB2, 0x0B, 0x99, 0x02, 0x53, 0xF4, 0xB9, 0x9A, 0xEA, 0x8D, 0x12, 0x7C, 0x9C, 0xEE, 0x85,
-    0xA2, 0x13, 0xDB, 0x26, 0x2D, 0x1E, 0x75, 0xC6, 0x91, 0xF6, 0xBF, 0x0B, 0x93, 0xA9, 0x70, 0x2A,
-    0xC2, 0x89, 0x45, 0x5A, 0x18, 0x95, 0x18, 0x9C, 0xF2, 0x09, 0xE6, 0xEA, 0xFA, 0xC5, 0x97, 0xE7,
-    0xD7, 0x53, 0xAB, 0x08, 0x37, 0xE6, 0x1A, 0x4D, 0xAA, 0x99, 0x25, 0x3E, 0x5F, 0x6B, 0x94, 0xBC,
-    0x34, 0x17, 0x1E, 0x98, 0x1C, 0xBF, 0x8D, 0x53, 0xB1, 0x8E, 0xD3, 0x40, 0x10, 0x9D, 0xB3, 0x41,
-    0x3E, 0xC9, 0x20, 0x53, 0x50, 0x50, 0x80, 0x7C, 0x05, 0x2D, 0xF6, 0x17, 0x24, 0x67, 0x1D, 0x12,
-    0x11, 0xA2, 0xA0, 0xC1, 0x50, 0x5C, 0xC3, 0x0F, 0xA0, 0x93, 0x50, 0xCA, 0x38, 0x59, 0xC4, 0x07,
-    0xA4, 0xA2, 0xBE, 0x8A, 0x82, 0x4D, 0x71, 0x0D, 0x45, 0x90, 0xE2, 0xD8, 0xA2, 0x4D, 0xE3, 0xD0,
-    0x50, 0x5C, 0x11, 0x53, 0xD0, 0x50, 0x10, 0x17, 0x96, 0xCE, 0x17, 0x92, 0x2C, 0x6F, 0x36, 0xF1,
-    0x9D, 0x28, 0x38, 0x18, 0x7B, 0xC7, 0x3B, 0xE3, 0x9D, 0x99, 0xB7, 0x6F, 0x76, 0xE9, 0x16, 0x11,
-    0xED, 0x14, 0x50, 0x6E, 0x80, 0x49, 0x59, 0x4F, 0xCE, 0x9F, 0x4B, 0x79, 0xA2, 0x20, 0x33, 0x29,
-    0x07, 0x6B, 0x76, 0x91, 0x7F, 0xA9, 0x30, 0xE8, 0x3E, 0xAB, 0x7B, 0x58, 0x9E, 0x91, 0xBB, 0x22,
-    0x57, 0x65, 0xEE, 0xAB, 0xC8, 0x7F, 0xD2, 0xFA, 0x7A, 0x90, 0xB7, 0x69, 0x48, 0xE4, 0x11, 0xD9,
-    0x82, 0x8C, 0x9C, 0xAE, 0x30, 0x2A, 0x6D, 0x40, 0x18, 0x84, 0x99, 0x41, 0x59, 0x97, 0xEA, 0x8B,
-    0x94, 0xEF, 0x0F, 0x67, 0x0C, 0x61, 0xBE, 0x90, 0x32, 0xAE, 0xFD, 0x5D, 0x9E, 0x20, 0x96, 0x9A,
-    0x1C, 0xF8, 0x52, 0x67, 0x70, 0xFE, 0x55, 0xA8, 0x36, 0xCC, 0x83, 0xFC, 0x75, 0xF9, 0xB1, 0xEB,
-    0x3F, 0xE8, 0x1A, 0xBF, 0xC6, 0xE4, 0xAF, 0xC9, 0x58, 0xE9, 0x3D, 0xD0, 0x2E, 0x1E, 0xA4, 0xC1,
-    0x72, 0x3B, 0x05, 0x2C, 0x28, 0x18, 0x29, 0x10, 0xDA, 0xDF, 0xC3, 0xF0, 0xE8, 0x2D, 0xA3, 0x28,
-    0xD6, 0x52, 0xCA, 0xCA, 0x81, 0x73, 0x89, 0x07, 0x2F, 0xA6, 0x4B, 0xDE, 0xC3, 0x68, 0x1B, 0xCE,
-    0xC2, 0x09, 0x10, 0xAE, 0x84, 0xFD, 0xB3, 0x72, 0x26, 0xFD, 0xC9, 0xE7, 0xBC, 0x4A, 0x87, 0x37,
-    0xFE, 0x02, 0x4B, 0x0C, 0x77, 0x47, 0x9E, 0xD3, 0x9F, 0xF4, 0xD3, 0xF5, 0x3C, 0x75, 0x54, 0x4A,
-    0x78, 0x39, 0x3F, 0x28, 0xB6, 0x30, 0x12, 0xC1, 0x89, 0x68, 0x3C, 0x17, 0xF6, 0xE9, 0xB1, 0x88,
-    0x3D, 0x57, 0x64, 0xC3, 0xBB, 0x3A, 0x09, 0xC2, 0x35, 0x71, 0x48, 0x06, 0xF3, 0xA6, 0xFD, 0x26,
-    0xE5, 0xBF, 0xF1, 0xA7, 0x8A, 0x12, 0x04, 0xF4, 0xD0, 0xC4, 0x5E, 0xC0, 0x7F, 0x5D, 0xA5, 0x56,
-    0x3D, 0xA5, 0xCA, 0x0B, 0x6C, 0x66, 0xC1, 0xC0, 0x69, 0x9F, 0xB8, 0xCE, 0xD6, 0xF0, 0x68, 0xCF,
-    0x16, 0xBE, 0x91, 0xFB, 0xC1, 0xD0, 0x0F, 0x3C, 0x37, 0xB0, 0x8F, 0xDF, 0xBD, 0x98, 0x2B, 0x75,
-    0xBE, 0x90, 0x1F, 0xD0, 0x6C, 0xA3, 0xD4, 0x3D, 0x37, 0xB0, 0x76, 0x4F, 0x17, 0xFC, 0x23, 0xB6,
-    0xA9, 0xB9, 0x37, 0xB9, 0x95, 0x06, 0x79, 0x66, 0x6E, 0x8B, 0xAE, 0x91, 0x5B, 0xD9, 0x90, 0x22,
-    0x3F, 0x3C, 0x3C, 0x45, 0x75, 0x29, 0x41, 0x70, 0xA4, 0xBB, 0xD6, 0xD5, 0xCB, 0x0D, 0x0D, 0x85,
-    0xD3, 0x31, 0xC9, 0x02, 0x47, 0x09, 0x9F, 0x11, 0xC5, 0x70, 0xD9, 0x19, 0xE6, 0x20, 0xD3, 0xB7,
-    0xC0, 0xF9, 0x68, 0x9F, 0x29, 0x1F, 0x83, 0xF2, 0x60, 0xC4, 0x11, 0x5A, 0x2D, 0x2F, 0x94, 0xA0,
-    0x5A, 0xDA, 0xF5, 0xC1, 0x88, 0x78, 0xB2, 0x50, 0x6A, 0x89, 0x1D, 0xAB, 0xB3, 0x1F, 0x88, 0x64,
-    0x0F, 0x45, 0x61, 0x18, 0x3E, 0x63, 0x57, 0x91, 0x40, 0xA5, 0x3A, 0x0F, 0x1F, 0x26, 0xDE, 0x8B,
-    0xA6, 0x7A, 0x43, 0x36, 0x08, 0xB3, 0xE6, 0x01, 0x45, 0x6E, 0x60, 0x95, 0xBD, 0xA0, 0x37, 0x55,
-    0xAD, 0x59, 0x6B, 0xF6, 0xB8, 0xE1, 0xDE, 0xA1, 0xB2, 0x43, 0xE6, 0xB4, 0x20, 0xA7, 0x95, 0x52,
-    0xC3, 0xA5, 0x2B, 0xCC, 0xAD, 0x70, 0x36, 0x7D, 0x87, 0xA0, 0x94, 0x5A, 0x27, 0x0F, 0xF9, 0xF0,
-    0x3C, 0x02, 0x9C, 0x13, 0xED, 0x03, 0x9C, 0xF0, 0x8C, 0x5D, 0x4F, 0x31, 0x70, 0x01, 0x98, 0x40,
-    0xDA, 0xA9, 0x36, 0xFD, 0x21, 0xBA, 0x46, 0xF4, 0xDF, 0x15, 0xAF, 0x37, 0xDC, 0xDB, 0x9D, 0xB2,
-    0x53, 0x26, 0x53, 0x25, 0x92, 0x56, 0x45, 0xB1, 0x2B, 0x28, 0xAE, 0x36, 0xCD, 0x6F, 0xD7, 0x70,
-    0xCC, 0xD4, 0x81, 0x2A, 0xD0, 0x30, 0xB4, 0xC9, 0x27, 0x73, 0x21, 0x07, 0x85, 0xC9, 0xF5, 0x0D,
-    0xDC, 0xAA, 0xC1, 0x37, 0x6E, 0x44, 0xA3, 0x09, 0x4C, 0x47, 0xDA, 0x49, 0x4C, 0xFB, 0x66, 0x25,
-    0xBA, 0xE5, 0x6F, 0xC3, 0xB5, 0xFC, 0x06, 0xCD, 0x58, 0xBF, 0x8F, 0xDC, 0xD6, 0x11, 0x1E, 0x92,
-    0x3A, 0x53, 0x08, 0x0B, 0xAA, 0xB0, 0x80, 0x40, 0x41, 0xC4, 0x94, 0x71, 0x00, 0x99, 0x7D, 0x70,
-    0xB7, 0xA4, 0x2C, 0x04, 0x29, 0x5C, 0xE4, 0x10, 0x68, 0x0D, 0x24, 0x02, 0xA2, 0xBF, 0x20, 0xB9,
-    0x46, 0x45, 0x0A, 0xDD, 0x2D, 0x1D, 0xFF, 0x01, 0x16, 0x10, 0xAB, 0x52, 0x61, 0x17, 0x01, 0x02,
-    0xF1, 0x8A, 0xAB, 0x02, 0xD8, 0xC1, 0xED, 0x2D, 0x23, 0x15, 0x2A, 0x52, 0x98, 0xB6, 0x0A, 0x17,
-    0x2E, 0x42, 0x45, 0x36, 0x0C, 0x48, 0x85, 0x28, 0x99, 0x8A, 0xB9, 0x77, 0x5C, 0xBE, 0x7C, 0xDF,
-    0x70, 0xC9, 0xBB, 0x13, 0x94, 0x38, 0x46, 0x64, 0x24, 0x04, 0xF5, 0x74, 0x7C, 0xBF, 0x66, 0xE6,
-    0x7B, 0xDF, 0xCC, 0x9B, 0xD9, 0x28, 0x11, 0x71, 0xCA, 0x99, 0x88, 0x84, 0x6F, 0x2E, 0xD0, 0x36,
-    0x4E, 0x23, 0xE2, 0x96, 0x5E, 0x89, 0x8E, 0xD8, 0x2F, 0xD0, 0x21, 0x61, 0x26, 0x6E, 0x21, 0x93,
-    0x34, 0xC5, 0x2C, 0x63, 0x4C, 0x2D, 0xB6, 0x49, 0x77, 0x72, 0x71, 0x2A, 0x89, 0x44, 0xFC, 0xD2,
-    0xAA, 0x44, 0x82, 0xCC, 0xCF, 0x44, 0xA2, 0x64, 0x84, 0x1D, 0x66, 0x36, 0xD6, 0xCA, 0x82, 0x1D,
-    0x4E, 0xBD, 0x89, 0x3F, 0xDD, 0x27, 0xEC, 0xF0, 0xFF, 0x96, 0x50, 0x08, 0x76, 0x17, 0x99, 0x14,
-    0x6C, 0x4D, 0x8C, 0xC6, 0xAE, 0xF8, 0xA7, 0xA5, 0xCD, 0x45, 0x11, 0xCF, 0x14, 0xE2, 0x1B, 0x23,
-    0x6E, 0x12, 0x60, 0x8E, 0xC5, 0xD9, 0x11, 0xA6, 0xB9, 0xC3, 0x87, 0xC8, 0xCE, 0xBB, 0x99, 0x6D,
-    0x4C, 0xE9, 0x2C, 0x2E, 0x37, 0x50, 0x61, 0x86, 0x0D, 0xFC, 0xAC, 0xC1, 0x8C, 0xA9, 0x58, 0x15,
-    0x86, 0xA7, 0x10, 0x1C, 0xB9, 0xA5, 0xF8, 0x6F, 0xD6, 0xE2, 0xE5, 0x5B, 0x30, 0x2E, 0xC8, 0xEC,
-    0xD2, 0x29, 0xAD, 0x5A, 0xCC, 0x6B, 0x35, 0x36, 0xAF, 0x21, 0x19, 0x42, 0x2D, 0x6C, 0x3B, 0x31,
-    0xE6, 0x31, 0x2C, 0xFA, 0xC2, 0x3C, 0x98, 0x41, 0x5B, 0x98, 0x67, 0x43, 0x86, 0x9A, 0x7E, 0xE4,
-    0xF3, 0x4B, 0x63, 0x66, 0x1F, 0x62, 0xD6, 0x8F, 0xD3, 0xED, 0xE7, 0x8C, 0xF6, 0x9F, 0x7F, 0x4E,
-    0xFF, 0x88, 0x39, 0xE6, 0x11, 0xFE, 0xC9, 0x91, 0xC7, 0x4E, 0xC4, 0x35, 0x73, 0xE8, 0x18, 0x42,
-    0x54, 0x2D, 0xD1, 0xFE, 0x25, 0xC8, 0x8F, 0x60, 0x23, 0x60, 0xCD, 0xC5, 0x32, 0xE2, 0xB3, 0x2D,
-    0x3C, 0xD8, 0xB7, 0x68, 0x1C, 0x6C, 0xD6, 0x44, 0xE7, 0xB1, 0x6D, 0xE3, 0x15, 0x7B, 0x68, 0xAD,
-    0x3A, 0x8C, 0x71, 0x00, 0x5B, 0x5E, 0x8E, 0x36, 0x78, 0xAB, 0x92, 0xCE, 0xCE, 0x85, 0xD8, 0x75,
-    0x98, 0xE0, 0xB4, 0x16, 0x6E, 0x39, 0x25, 0x26, 0xCD, 0x94, 0x5A, 0x84, 0xE8, 0xF1, 0x73, 0xA7,
-    0xE5, 0xA1, 0xC8, 0x2C, 0x91, 0xA0, 0x94, 0x49, 0x7B, 0x7E, 0x52, 0xCA, 0x16, 0xEC, 0x44, 0x0B,
-    0xD4, 0xAE, 0xC9, 0x77, 0xC4, 0x1A, 0xCB, 0x33, 0x4F, 0xC8, 0x66, 0xC6, 0xD3, 0x30, 0x38, 0x23,
-    0xDB, 0xF0, 0xE4, 0x1E, 0xE5, 0x40, 0xFD, 0x53, 0x28, 0xE4, 0xDF, 0x66, 0x73, 0x01, 0xA8, 0x85,
-    0x34, 0x78, 0x04, 0x1D, 0x64, 0x53, 0x5A, 0x12, 0x63, 0x22, 0x02, 0x63, 0x62, 0x9C, 0x77, 0x94,
-    0x40, 0xF7, 0x20, 0x73, 0x73, 0x28, 0x00, 0xFC, 0xFD, 0x32, 0x80, 0xDD, 0x25, 0x94, 0x77, 0xEA,
-    0x88, 0x40, 0xCD, 0xAE, 0x8F, 0x2F, 0x35, 0xC4, 0xA7, 0xD5, 0x26, 0x62, 0x1B, 0xB0, 0xF9, 0xA4,
-    0x4D, 0x7F, 0xB9, 0x5D, 0x1A, 0x9E, 0x2E, 0x61, 0x9C, 0x3A, 0x35, 0xED, 0x01, 0xB8, 0x41, 0x12,
-    0x60, 0xB3, 0x0C, 0xDF, 0x4E, 0x81, 0x6F, 0x9E, 0x32, 0x41, 0x00, 0x3B, 0x41, 0xA9, 0x09, 0x55,
-    0xF6, 0x0B, 0x3F, 0xC1, 0xD6, 0x1E, 0x89, 0x77, 0x81, 0x3A, 0xDE, 0xE3, 0xA9, 0x36, 0xBB, 0x64,
-    0xC9, 0x96, 0x90, 0x4A, 0xE4, 0x14, 0x2D, 0x92, 0x28, 0xE7, 0x37, 0x1B, 0xA1, 0x95, 0xB2, 0x61,
-    0x4C, 0xE2, 0x42, 0x7A, 0xE9, 0x91, 0xCF, 0x7E, 0xCD, 0x51, 0xF2, 0xD0, 0x25, 0x51, 0xA9, 0x02,
-    0xAD, 0xC3, 0xB3, 0xA5, 0xE8, 0x70, 0x07, 0x6F, 0x3F, 0x4D, 0xCD, 0x81, 0x2A, 0x3F, 0x9B, 0xA1,
-    0xDD, 0xE1, 0x3E, 0x6E, 0x31, 0xCC, 0x8C, 0xE2, 0x7E, 0x39, 0x95, 0x87, 0x32, 0xBA, 0x89, 0xC1,
-    0xAA, 0x4E, 0x90, 0x7C, 0xCF, 0x98, 0x66, 0x00, 0x9C, 0x3A, 0x02, 0x49, 0xB1, 0x66, 0xA6, 0x15,
-    0xE2, 0x90, 0x81, 0x1E, 0xA6, 0x00, 0x2F, 0x2A, 0xD2, 0x62, 0x17, 0x50, 0x02, 0x05, 0x78, 0x9F,
-    0x1F, 0x03, 0x57, 0x2F, 0x03, 0x77, 0xF1, 0xFF, 0x1E, 0xE1, 0x0E, 0x1F, 0xA4, 0x66, 0x46, 0x96,
-    0x99, 0x7D, 0x62, 0xD9, 0x4E, 0xC5, 0xCD, 0x00, 0x16, 0x86, 0xF1, 0x42, 0xE8, 0x42, 0xAE, 0xD2,
-    0x1D, 0x81, 0xBA, 0xD3, 0x00, 0x1F, 0x89, 0x1E, 0xC2, 0x6C, 0x87, 0x8A, 0x74, 0x82, 0x64, 0x46,
-    0x6D, 0xF4, 0xC4, 0x39, 0x2C, 0xAE, 0xA2, 0x22, 0xA7, 0xC7, 0xE3, 0x98, 0x60, 0x94, 0x9C, 0xD4,
-    0x84, 0xF3, 0xF1, 0xF8, 0x22, 0x1D, 0x90, 0x3A, 0x2C, 0xED, 0xB2, 0xD5, 0x22, 0xDA, 0x6E, 0xF4,
-    0xF8, 0xFE, 0x8A, 0x2D, 0xB7, 0xFF, 0xAE, 0x9D, 0x13, 0xE9, 0x67, 0x5A, 0xAD, 0x22, 0x86, 0xE5,
-    0x63, 0x8B, 0x93, 0xB2, 0xCE, 0x78, 0x19, 0x8F, 0xD7, 0x61, 0x6A, 0x2C, 0x5C, 0xA9, 0x72, 0xBA,
-    0xCD, 0x32, 0x6E, 0x5E, 0x0F, 0xF8, 0x79, 0xE5, 0x80, 0x67, 0xA8, 0xDF, 0x0F, 0xCD, 0x83, 0x74,
-    0x7B, 0x9F, 0x1B, 0x19, 0x0A, 0x9E, 0xE9, 0x49, 0x14, 0x43, 0xD4, 0x68, 0x06, 0xE1, 0xBA, 0x3C,
-    0x4A, 0x74, 0x4F, 0xA8, 0x65, 0x32, 0x15, 0x84, 0x40, 0x32, 0xEF, 0x21, 0xAF, 0x7B, 0xA2, 0xDB,
-    0xDA, 0x89, 0xE1, 0x85, 0x28, 0xE8, 0xC0, 0xCF, 0x36, 0x1C, 0x87, 0xBD, 0x11, 0xF1, 0x03, 0x9E,
-    0xA0, 0xA2, 0x22, 0xCE, 0x70, 0x02, 0xF8, 0x25, 0xDC, 0x39, 0x68, 0xD3, 0x9D, 0x87, 0x3D, 0x81,
-    0x5B, 0x58, 0x59, 0x01, 0x74, 0x8C, 0x83, 0x54, 0x5E, 0x46, 0xBF, 0xAD, 0x18, 0x9E, 0x22, 0x2C,
-    0xC7, 0x37, 0xE9, 0xBC, 0x6F, 0x6C, 0x04, 0x4C, 0xD3, 0x09, 0x8A, 0x96, 0x06, 0x33, 0x3C, 0x72,
-    0x3F, 0x8C, 0x57, 0x04, 0x05, 0x9E, 0x48, 0x45, 0x13, 0x5F, 0x67, 0xE1, 0x7B, 0xA6, 0xC6, 0x2D,
-    0x54, 0x57, 0x4E, 0x73, 0xD4, 0xCE, 0x3D, 0x05, 0xFC, 0x6D, 0x36, 0x4F, 0x88, 0xBA, 0xEE, 0xB5,
-    0x37, 0xD8, 0xAD, 0x33, 0xC3, 0x8F, 0x74, 0x39, 0xE7, 0xE4, 0x6A, 0xBC, 0x85, 0x13, 0xD5, 0x08,
-    0x87, 0x67, 0x43, 0xDB, 0xBF, 0x4C, 0xF6, 0xD3, 0xED, 0x56, 0x51, 0x86, 0xD3, 0x36, 0x0C, 0x16,
-    0x24, 0x2B, 0x64, 0x70, 0x87, 0xC5, 0xFF, 0x64, 0xC0, 0xAD, 0x6C, 0x75, 0x81, 0x27, 0xE0, 0x8A,
-    0x6F, 0x16, 0xCB, 0xC3, 0x22, 0x1E, 0x8D, 0x32, 0x31, 0x80, 0xBD, 0x8D, 0x07, 0x83, 0x77, 0x1D,
-    0x0C, 0x5E, 0x15, 0x40, 0xBB, 0x2A, 0x93, 0x4C, 0xBE, 0x2B, 0xA1, 0xD2, 0x93, 0xF8, 0xF0, 0xC6,
-    0x5A, 0x32, 0x4F, 0x83, 0x58, 0x44, 0x3C, 0x82, 0x6C, 0x60, 0x84, 0x2C, 0xEF, 0x0E, 0x05, 0x53,
-    0x69, 0xAA, 0x88, 0x81, 0x38, 0x27, 0x78, 0x5E, 0x67, 0xE9, 0xF0, 0x23, 0x2A, 0x36, 0xE2, 0xA2,
-    0x29, 0xD1, 0x6B, 0xB4, 0x09, 0x7B, 0xA2, 0x9E, 0x82, 0x7B, 0xFC, 0x9C, 0x9C, 0xEF, 0xA2, 0xBB,
-    0x5D, 0x30, 0x04, 0x0A, 0x6F, 0xB8, 0x5A, 0x49, 0x85, 0x10, 0x05, 0xA2, 0xB0, 0x83, 0xE7, 0x1A,
-    0x75, 0x91, 0x61, 0x57, 0x3D, 0x8C, 0x97, 0x61, 0xD4, 0xB9, 0x19, 0x74, 0x08, 0x62, 0xD2, 0x8A,
-    0x3C, 0xF0, 0xBA, 0xC5, 0xCB, 0x0E, 0xEC, 0xB6, 0x12, 0xEB, 0x7F, 0xEC, 0xE4, 0x1A, 0x6E, 0xC9,
-    0x39, 0x98, 0xC0, 0xF5, 0x3A, 0xD4, 0x3C, 0x33, 0x94, 0x1C, 0x1F, 0xAA, 0x0E, 0x87, 0xFC, 0xE3,
-    0x43, 0xD4, 0x8A, 0x62, 0x20, 0xC3, 0xC3, 0x7E, 0x6B, 0x42, 0xFE, 0x9E, 0x74, 0xF2, 0x97, 0xB7,
-    0xBC, 0x0B, 0xA5, 0xF9, 0xF5, 0x2C, 0x99, 0xC0, 0x0F, 0x02, 0x48, 0x9E, 0xF1, 0xA2, 0x5A, 0xB8,
-    0xF5, 0x9F, 0x8C, 0x7F, 0x21, 0x7F, 0xFF, 0x94, 0x3F, 0x4C, 0xD6, 0xEB, 0x92, 0xE1, 0x34, 0xF7,
-    0x4C, 0x15, 0xC4, 0xCD, 0x48, 0xD6, 0xD6, 0x64, 0x84, 0x17, 0x7F, 0x84, 0x71, 0xE3, 0x1B, 0x9C,
-    0x63, 0xA2, 0x33, 0x9A, 0xE8, 0x7E, 0xAB, 0xF8, 0x8A, 0x9C, 0xD1, 0xB3, 0xCC, 0xFA, 0x48, 0x79,
-    0xC4, 0x69, 0xA9, 0x9B, 0x9A, 0xD6, 0x0D, 0x53, 0x37, 0xB1, 0xEA, 0x21, 0x34, 0x76, 0xC3, 0x49,
-    0x04, 0xB2, 0xE6, 0xBE, 0x81, 0x7F, 0xD9, 0xDB, 0xCB, 0xE0, 0xB6, 0xC9, 0x78, 0x4C, 0x3C, 0x4B,
-    0x9A, 0xD8, 0x10, 0xD6, 0xF0, 0xB5, 0x92, 0x02, 0xB8, 0x6F, 0x43, 0x65, 0xA3, 0x0D, 0x0A, 0x7C,
-    0xC4, 0x7D, 0x0D, 0xC5, 0x46, 0xDC, 0xDC, 0x53, 0xB1, 0xED, 0x61, 0xA8, 0x56, 0x65, 0xC5, 0xB2,
-    0x3E, 0x90, 0xD0, 0x37, 0xC9, 0x5E, 0x78, 0xE3, 0x5E, 0xB5, 0x66, 0x1D, 0x64, 0x57, 0x65, 0x12,
-    0xEF, 0xE2, 0x7C, 0x76, 0xA1, 0xC3, 0xA6, 0x1C, 0x64, 0xD1, 0x8D, 0x8F, 0xAB, 0xC0, 0xC4, 0x2D,
-    0xA2, 0xDF, 0xAB, 0xBA, 0xE0, 0x03, 0x04, 0x20, 0xDB, 0x14, 0x81, 0xB1, 0xE7, 0x7B, 0xC1, 0xBB,
-    0x45, 0xED, 0x3E, 0x92, 0xDD, 0x55, 0x70, 0x2C, 0x08, 0x00, 0xBA, 0x73, 0x27, 0x73, 0x2B, 0xAB,
-    0xAC, 0xD8, 0x19, 0xDD, 0xB8, 0x3B, 0x9F, 0x3A, 0x26, 0x0F, 0x5B, 0x68, 0x6C, 0x4D, 0xC9, 0x8F,
-    0x3E, 0xAC, 0xE5, 0x03, 0x18, 0xDF, 0x46, 0xA7, 0x86, 0xE8, 0xD0, 0x2C, 0xE9, 0x6A, 0x34, 0xA6,
-    0x9E, 0x94, 0x01, 0x7A, 0xFF, 0xF0, 0x92, 0x72, 0x75, 0xBE, 0x3A, 0x89, 0xD3, 0x0C, 0x31, 0xC7,
-    0x5A, 0x0C, 0xE1, 0x5C, 0x34, 0x97, 0xE9, 0xC2, 0xF2, 0x24, 0x3E, 0x0C, 0xD6, 0xD9, 0xE1, 0x8A,
-    0xFC, 0xB9, 0x2B, 0x28, 0xB8, 0xD6, 0xD8, 0x73, 0x5F, 0x43, 0x4F, 0xF2, 0xCA, 0xE8, 0x6B, 0x9E,
-    0xD3, 0xAF, 0xD8, 0xBF, 0x2F, 0xB7, 0x22, 0xF7, 0xFE, 0x8B, 0x6B, 0xEE, 0xAD, 0x9F, 0xEE, 0xA9,
-    0x54, 0xF4, 0x14, 0x70, 0x98, 0x74, 0x5A, 0x5F, 0xD1, 0x22, 0xCD, 0x14, 0x46, 0x74, 0xA2, 0x90,
-    0xFC, 0xF3, 0xB3, 0x29, 0x69, 0xA4, 0x2E, 0xAB, 0x89, 0x18, 0xD1, 0x9D, 0x92, 0x9F, 0x11, 0xF9,
-    0x89, 0x79, 0x5B, 0x44, 0xD9, 0x67, 0xB4, 0xB7, 0x2B, 0x92, 0x75, 0x8B, 0x80, 0xFA, 0xBC, 0x6A,
-    0x6D, 0xE6, 0x69, 0x12, 0x91, 0xCB, 0xFE, 0x27, 0x4C, 0x55, 0x6B, 0x66, 0x0E, 0xC1, 0xDB, 0xF8,
-    0xF6, 0x3E, 0x56, 0xDF, 0x9B, 0xB0, 0x93, 0xE3, 0x8D, 0xA5, 0x19, 0x4E, 0xC4, 0x73, 0x83, 0xA7,
-    0xFA, 0xBC, 0xDB, 0x5D, 0xDE, 0x3C, 0x38, 0x3C, 0x4D, 0xF3, 0xC0, 0xF3, 0xCD, 0xE5, 0x0C, 0x37,
-    0x57, 0x92, 0xF3, 0x6C, 0x55, 0x45, 0xF7, 0x5E, 0xDD, 0xEB, 0x1D, 0x4C, 0x7A, 0x63, 0xBA, 0x5B,
-    0x54, 0x2D, 0xD4, 0x00, 0xC7, 0xF4, 0x0E, 0x77, 0x6F, 0xCE, 0xDB, 0xAD, 0x70, 0xCC, 0xF5, 0x59,
-    0x89, 0x44, 0x2A, 0xC8, 0x71, 0x44, 0xC1, 0x1D, 0xC6, 0x22, 0x1A, 0x3C, 0x9D, 0xF2, 0x86, 0xC2,
-    0x6C, 0x97, 0xD9, 0x41, 0xC0, 0x64, 0x66, 0xEB, 0xFF, 0xA2, 0x0B, 0xB0, 0xD9, 0x4F, 0x89, 0xEA,
-    0x5D, 0xF4, 0x4F, 0x40, 0x3C, 0xA7, 0xF6, 0xE7, 0x3F, 0x99, 0xE1, 0x6A, 0x40, 0xF6, 0x84, 0x5C,
-    0x02, 0x73, 0x7E, 0x41, 0x9B, 0xAD, 0x9B, 0xA4, 0x1A, 0x6F, 0x5C, 0x5E, 0xE0, 0x05, 0x00, 0x5B,
-    0x20, 0x40, 0x11, 0x5F, 0x8D, 0xF4, 0xC1, 0xB7, 0xFA, 0x07, 0x33, 0xA1, 0x04, 0x51, 0x84, 0x55,
-    0x86, 0xC3, 0x3B, 0x2B, 0xA0, 0x5E, 0x67, 0x34, 0x40, 0xAE, 0x0C, 0x74, 0xF3, 0x39, 0xDD, 0x6E,
-    0x87, 0x6B, 0xFF, 0x1B, 0x3D, 0x24, 0x89, 0x5B, 0xC0, 0x97, 0x9C, 0xC5, 0x04, 0xE0, 0x98, 0x9F,
-    0xF1, 0xE4, 0xB2, 0x75, 0x86, 0x61, 0x4A, 0x78, 0x99, 0x4E, 0x1C, 0xDD, 0x61, 0xBE, 0xFF, 0x54,
-    0x27, 0x85, 0xCB, 0xCB, 0xE3, 0x9B, 0x3D, 0x5A, 0xA8, 0xD9, 0xEA, 0xB1, 0x26, 0x1B, 0x9C, 0x19,
-    0x5B, 0xBD, 0x74, 0xA1, 0x89, 0xEE, 0x36, 0x9D, 0x45, 0xBD, 0x46, 0xE8, 0x59, 0xC0, 0xF1, 0x5F,
-    0x98, 0xF8, 0x7F, 0x63, 0xA2, 0x8E, 0xBF, 0x34, 0x17, 0x2B, 0xC1, 0x89, 0x07, 0xDE, 0xE7, 0xE6,
-    0x61, 0xBD, 0x8A, 0x9C, 0x3D, 0x59, 0x97, 0x97, 0xDE, 0xEB, 0x16, 0x7B, 0x73, 0x54, 0x56, 0x08,
-    0x2B, 0x81, 0xFF, 0xD1, 0xEC, 0xA0, 0x5A, 0x05, 0xD7, 0xE3, 0x75, 0x59, 0xB9, 0xF6, 0x8C, 0x08,
-    0x46, 0x9E, 0xDB, 0x6C, 0x56, 0x90, 0x1B, 0x5D, 0x3C, 0x3E, 0xE6, 0xF7, 0xB7, 0x7C, 0xD9, 0x69,
-    0xF3, 0x07, 0x39, 0xE1, 0x99, 0xF8, 0xD5, 0xD0, 0x54, 0x88, 0x1C, 0xA6, 0x41, 0x48, 0x2F, 0x4F,
-    0xE0, 0xBE, 0xC4, 0x59, 0x9F, 0xC4, 0xFD, 0x30, 0x8A, 0xCC, 0x7C, 0x6F, 0x64, 0xB3, 0x9F, 0xB5,
-    0xAB, 0xD5, 0xED, 0x31, 0x8F, 0xE5, 0x92, 0xEE, 0x6F, 0x6B, 0x22, 0x79, 0xBC, 0xB0, 0x3A, 0x93,
-    0xDE, 0xEC, 0x12, 0x4C, 0xE4, 0xB0, 0xE6, 0x16, 0x41, 0x5D, 0x0E, 0xFC, 0x10, 0xEB, 0xCB, 0x95,
-    0xF1, 0xE5, 0x77, 0x10, 0xA8, 0x9F, 0x68, 0x4A, 0xBE, 0xD6, 0xA5, 0x14, 0x01, 0x52, 0xC2, 0xF9,
-    0xF8, 0xF5, 0xAE, 0x34, 0x6A, 0x1C, 0x80, 0x72, 0x16, 0xD3, 0x7F, 0x80, 0x7F, 0x3F, 0x4A, 0xD3,
-    0xF4, 0x3D, 0x0A, 0xBA, 0x85, 0x3F, 0xD2, 0xE3, 0x86, 0x38, 0xEC, 0x57, 0x6B, 0x90, 0xA4, 0x8C,
-    0xD7, 0x8F, 0x0F, 0xAA, 0x81, 0x9A, 0x88, 0xF7, 0x3D, 0xB1, 0xDE, 0xBB, 0xAE, 0x61, 0xD5, 0x29,
-    0x13, 0x64, 0xB1, 0x48, 0x78, 0x41, 0x5F, 0x1E, 0x3D, 0x2D, 0x0B, 0x71, 0x2A, 0x5E, 0x4B, 0x56,
-    0x20, 0x4C, 0x30, 0x1B, 0x65, 0xAC, 0xFF, 0x7E, 0xBF, 0x18, 0x02, 0x5E, 0xEF, 0x2E, 0x17, 0x0D,
-    0xFE, 0xF4, 0x5D, 0x90, 0x80, 0xEB, 0x2D, 0x4A, 0x98, 0xF5, 0x1B, 0x30, 0xD3, 0x29, 0xC5, 0x6D,
-    0xB5, 0xFC, 0x42, 0x2F, 0x3B, 0x5B, 0x2D, 0x86, 0xE5, 0x5F, 0x6C, 0xD5, 0x9D, 0x6A, 0xC2, 0x17,
-    0x84, 0x24, 0x27, 0xB1, 0xAC, 0x5B, 0x89, 0xD7, 0x5B, 0xF0, 0xB5, 0x4D, 0x8C, 0x97, 0xDE, 0x45,
-    0x07, 0x8B, 0x2A, 0xBE, 0xD4, 0x3F, 0xE8, 0x74, 0xA0, 0x1A, 0x50, 0xDB, 0x5E, 0x6A, 0xA2, 0xCA,
-    0x68, 0x2A, 0x8F, 0x9A, 0x97, 0xEF, 0xD1, 0xE7, 0x7D, 0x7D, 0x51, 0x2A, 0x3B, 0x9D, 0xAD, 0xBD,
-    0xB9, 0x5C, 0x84, 0x3C, 0x88, 0xA9, 0x10, 0xB4, 0x77, 0x5B, 0x4D, 0xC6, 0x99, 0x8F, 0xA3, 0x8A,
-    0xC6, 0xDB, 0x09, 0xEB, 0x64, 0x21, 0x15, 0x12, 0x46, 0xD9, 0xBA, 0xB7, 0xAE, 0x33, 0xF0, 0xA8,
-    0x8D, 0xCB, 0x13, 0x68, 0x63, 0xCD, 0xEF, 0x91, 0x90, 0xBF, 0x31, 0xCB, 0x9F, 0x9B, 0xDF, 0x77,
-    0xE9, 0x4E, 0x5F, 0x69, 0x59, 0xCF, 0xCD, 0xEF, 0xF3, 0xE3, 0xF9, 0x7D, 0xB2, 0xD2, 0x53, 0xBA,
-    0xF3, 0x97, 0xEA, 0x78, 0xF2, 0xA4, 0xB5, 0x9D, 0xC7, 0xDF, 0x16, 0x00, 0x30, 0x8B, 0x30, 0xE3,
-    0xB6, 0xD7, 0xF7, 0xC6, 0x3F, 0xAD, 0x79, 0x9B, 0xD5, 0x18, 0x46, 0x34, 0x43, 0xF2, 0xB4, 0xC7,
-    0x18, 0x00, 0xEF, 0xAD, 0x99, 0x8E, 0x6F, 0xF2, 0x0E, 0x0A, 0x29, 0x19, 0xAB, 0xB5, 0x98, 0x77,
-    0x6A, 0x86, 0x88, 0x49, 0xA2, 0xA4, 0xD8, 0x43, 0xB9, 0xC2, 0xDC, 0xA2, 0x24, 0xDB, 0xB1, 0xFA,
-    0x73, 0x7C, 0xDB, 0x87, 0x15, 0xDB, 0xDA, 0xF0, 0x4B, 0x82, 0xB7, 0x84, 0x60, 0xFD, 0x78, 0x77,
-    0x97, 0xE9, 0x15, 0x5D, 0xDC, 0x21, 0x22, 0xD7, 0x94, 0xBA, 0xF1, 0x78, 0xBC, 0xB1, 0x53, 0x71,
-    0x18, 0xE7, 0xE7, 0x14, 0x88, 0xF9, 0x56, 0xC9, 0xB4, 0xBC, 0x61, 0xE1, 0x3D, 0xE2, 0xDD, 0x18,
-    0xC4, 0x50, 0x16, 0x77, 0xE5, 0x16, 0x57, 0x23, 0x97, 0xD2, 0x9F, 0x02, 0x76, 0x99, 0x96, 0x8C,
-    0x50, 0xB6, 0x9F, 0xBE, 0x7C, 0x7D, 0xA3, 0x26, 0x22, 0x15, 0xF7, 0x2C, 0xAC, 0x37, 0xE6, 0xE3,
-    0xE3, 0x69, 0x64, 0xDC, 0xD7, 0x5C, 0x76, 0xD1, 0x05, 0x16, 0xA2, 0x47, 0xCF, 0x2C, 0xB9, 0xAA,
-    0xD6, 0xDF, 0x06, 0x14, 0x62, 0x3F, 0x1F, 0x6A, 0x5D, 0x45, 0x73, 0x71, 0x58, 0x98, 0x16, 0x7D,
-    0x0D, 0x71, 0xB4, 0x50, 0xD5, 0x84, 0x97, 0x42, 0x5B, 0x2D, 0xB3, 0x32, 0x2B, 0x35, 0xA6, 0x38,
-    0x3C, 0x79, 0x3A, 0x6D, 0xAA, 0x45, 0xDB, 0x97, 0x6C, 0x1A, 0x60, 0xF7, 0x99, 0x3A, 0x64, 0xA1,
-    0xE9, 0x91, 0xEA, 0x56, 0x0E, 0x59, 0x69, 0xF0, 0x2C, 0x1D, 0x0E, 0xD3, 0xE6, 0x7A, 0x50, 0x66,
-    0x32, 0xE4, 0x6B, 0xB3, 0x5B, 0xEA, 0xD5, 0x0A, 0x60, 0x68, 0xDA, 0x9B, 0x47, 0x29, 0x47, 0xB9,
-    0xA9, 0x96, 0x8C, 0x1F, 0x0E, 0x09, 0x60, 0xF7, 0xAB, 0xC7, 0x67, 0x5D, 0x7A, 0x98, 0x20, 0x63,
-    0x73, 0xCF, 0x2F, 0x50, 0x16, 0x58, 0x39, 0x38, 0x52, 0xC9, 0x15, 0x54, 0x56, 0x15, 0xDC, 0xDC,
-    0x43, 0xFE, 0xEB, 0xC6, 0x52, 0x9D, 0x13, 0x2B, 0x97, 0xB3, 0xBE, 0x60, 0xC0, 0xB9, 0x9D, 0xD1,
-    0xFF, 0x1F, 0x3F, 0x1D, 0x5F, 0xBA, 0x3E, 0xDE, 0xEC, 0xCA, 0xC9, 0xCB, 0x69, 0xDA, 0xA6, 0xDB,
-    0x77, 0x75, 0xA0, 0x2C, 0xB9, 0x62, 0x75, 0x8D, 0x2B, 0x02, 0x64, 0xD5, 0x57, 0xC4, 0x8F, 0xB9,
-    0x95, 0x9B, 0x05, 0x18, 0x70, 0x72, 0xBB, 0xB4, 0x72, 0x3D, 0xB6, 0x2B, 0x00, 0xD1, 0x6A, 0x7F,
-    0xB3, 0x91, 0x6B, 0x7A, 0x48, 0x1B, 0x56, 0xDE, 0x39, 0xA2, 0xF4, 0x52, 0xB9, 0x07, 0xAA, 0x9C,
-    0xBE, 0xB5, 0x12, 0x98, 0x88, 0x5C, 0xD5, 0xEA, 0x9D, 0xCA, 0x91, 0xE8, 0xE7, 0xD8, 0x52, 0x39,
-    0x51, 0xE5, 0x44, 0x95, 0xC3, 0x73, 0xA8, 0x5C, 0xAA, 0xCA, 0x89, 0x2A, 0x87, 0x67, 0x55, 0x39,
-    0x18, 0x68, 0xCA, 0xEF, 0xC5, 0xFA, 0x3B, 0x0F, 0x94, 0xC3, 0xEA, 0x7C, 0x59, 0x4D, 0x81, 0x68,
-    0xAA, 0xDC, 0xF8, 0x3F, 0x57, 0xAE, 0x52, 0xE5, 0x5A, 0x4D, 0x83, 0x0F, 0x0A, 0x71, 0x50, 0x39,
-    0x8C, 0x90, 0xE6, 0x55, 0xE7, 0x9C, 0xC2, 0x29, 0xA1, 0xDC, 0xC8, 0x29, 0xA1, 0x9C, 0x73, 0xBF,
-    0x94, 0xC7, 0x05, 0x2B, 0x90, 0x73, 0xBF, 0x25, 0xB3, 0xBC, 0x5F, 0x31, 0xE0, 0xD8, 0x77, 0x33,
-    0xE7, 0xAB, 0x02, 0xCA, 0x39, 0xE5, 0x08, 0xCA, 0x61, 0x66, 0x11, 0xB8, 0x6F, 0x81, 0xCD, 0x5E,
-    0x8C, 0xC4, 0xD4, 0xF9, 0x22, 0x23, 0x2D, 0xA2, 0x9C, 0x24, 0x74, 0xFF, 0x0B, 0xE5, 0x2A, 0xFD,
-    0x85, 0x92, 0x2D, 0xCB, 0x1A, 0x38, 0x1D, 0x91, 0xB3, 0xA9, 0x1C, 0x33, 0x5C, 0x20, 0x67, 0xAB,
-    0x72, 0xB6, 0x2A, 0x67, 0xAB, 0x72, 0x68, 0xA1, 0x1C, 0x51, 0x29, 0x4B, 0xB6, 0xAB, 0x6B, 0x6C,
-    0x03, 0xF7, 0x77, 0x25, 0x91, 0xFB, 0x47, 0xA9, 0xC8, 0x95, 0x8A, 0x5C, 0xF5, 0x75, 0xC8, 0x35,
-    0x7D, 0x5D, 0xA7, 0x7E, 0x1F, 0xBD, 0xD8, 0x2E, 0x73, 0xEC, 0xC9, 0xFA, 0xAA, 0xB3, 0xBF, 0xFD,
-    0xA6, 0x9C, 0xED, 0x7D, 0x8A, 0x10, 0x52, 0x82, 0xEF, 0x25, 0xB2, 0x1B, 0xC7, 0x4C, 0x62, 0x40,
-    0xE3, 0x56, 0xA7, 0x78, 0x05, 0x5A, 0xF2, 0x4F, 0x45, 0xCF, 0x3B, 0x0A, 0x42, 0x31, 0x10, 0x85,
-    0xE1, 0xA3, 0xB7, 0xB0, 0x11, 0xB2, 0x94, 0x6C, 0xE1, 0x82, 0x5B, 0xB2, 0xD5, 0xF1, 0xEE, 0x4B,
-    0x2C, 0x5C, 0x81, 0x4B, 0xB0, 0xB0, 0xD7, 0x22, 0x85, 0xC2, 0x90, 0xE3, 0x3C, 0x82, 0x06, 0xC2,
-    0xCF, 0x97, 0x09, 0x81, 0x00, 0xBF, 0xB5, 0x1D, 0xD5, 0x4C, 0x19, 0x65, 0xB6, 0x3C, 0xB3, 0xAF,
-    0x55, 0xB4, 0x00, 0xE7, 0x71, 0xD9, 0x5B, 0x3E, 0x97, 0xD9, 0xCF, 0x49, 0x2E, 0xD6, 0x62, 0xDD,
-    0x69, 0xB0, 0xDB, 0x3B, 0x4E, 0xAD, 0xEA, 0xE4, 0x8D, 0xEA, 0x7C, 0x4C, 0x54, 0x31, 0xA1, 0xB2,
-    0x09, 0x3B, 0xD6, 0xE4, 0x2C, 0x7C, 0x43, 0xD8, 0x6C, 0xDF, 0xAB, 0xD1, 0x7A, 0xA5, 0xD1, 0xBA,
-    0x71, 0x42, 0xBA, 0x4F, 0xDD, 0x41, 0x48, 0x13, 0x27, 0xE4, 0x14, 0xC4, 0x71, 0x0A, 0xE2, 0x50,
-    0x83, 0xC8, 0xA9, 0x35, 0x89, 0xFD, 0xFF, 0xAF, 0xF8, 0x02,
+static const uint8_t bookerly_16_regularBitmaps[32757] = {
+    0xD5, 0x9B, 0x3F, 0xCC, 0xE7, 0xC6, 0x99, 0xDF, 0x3F, 0xC3, 0xD1, 0xBB, 0xF4, 0x99, 0xB9, 0xCC,
+    0x16, 0xDA, 0x5C, 0x70, 0xEB, 0x33, 0xAF, 0x70, 0x71, 0xF9, 0x63, 0x4D, 0xEB, 0x42, 0xFB, 0x0E,
+    0x6D, 0x23, 0x48, 0x80, 0x14, 0x5E, 0x04, 0xFB, 0xEA, 0x00, 0xAB, 0xF0, 0x15, 0x6E, 0xCE, 0x48,
+    0xB2, 0x57, 0xA4, 0xB8, 0x42, 0xFB, 0x92, 0xB2, 0x0A, 0x03, 0x39, 0x20, 0x16, 0x90, 0x73, 0x52,
+    0xDE, 0x15, 0x2A, 0x2E, 0xAF, 0x02, 0xAC, 0x0B, 0x17, 0x42, 0xB0, 0xFB, 0x72, 0xE4, 0x2D, 0x54,
+    0x6C, 0x21, 0x1A, 0x8E, 0xA1, 0xC2, 0x40, 0x4C, 0x5B, 0xF2, 0x19, 0xB0, 0x03, 0x68, 0x24, 0x53,
+    0x16, 0x77, 0x35, 0xE4, 0x37, 0x05, 0x7F, 0xBF, 0x77, 0x77, 0xA5, 0x3D, 0x58, 0x72, 0x2C, 0x5B,
+    0x1E, 0xFC, 0xC8, 0xDF, 0x70, 0x48, 0x0E, 0x67, 0x1E, 0x3E, 0xF3, 0xFC, 0xFB, 0x3E, 0xFC, 0xF8,
+    0x33, 0x73, 0xF8, 0xD7, 0x53, 0x5B, 0xA6, 0xB6, 0x4C, 0xC1, 0xDE, 0xFB, 0xF9, 0x22, 0x3D, 0x02,
+    0x98, 0xE7, 0xC2, 0xAD, 0x1C, 0xE2, 0xE5, 0x03, 0xF3, 0x5F, 0xC7, 0x6B, 0xC7, 0xD5, 0x2B, 0xE3,
+    0xCD, 0xE3, 0xEA, 0xD6, 0x70, 0xE3, 0x52, 0x75, 0x6B, 0x78, 0xEA, 0x52, 0x79, 0x2B, 0x3E, 0x05,
+    0xC0, 0x65, 0xD3, 0xC0, 0xE3, 0x24, 0xA8, 0xF9, 0x4B, 0xA8, 0xBA, 0x4F, 0x83, 0x1D, 0x1C, 0x1C,
+    0xBD, 0xF5, 0xA7, 0xDF, 0x6B, 0x7A, 0x49, 0xE9, 0x9F, 0xF7, 0x27, 0xEB, 0x73, 0xB8, 0xE6, 0x12,
+    0xD8, 0xE8, 0xC0, 0xA4, 0x32, 0xC2, 0x0B, 0xC5, 0x08, 0x97, 0x98, 0x70, 0x92, 0x96, 0x52, 0x92,
+    0x28, 0x52, 0xD5, 0xC1, 0xB7, 0xEC, 0x00, 0x97, 0x48, 0xE0, 0x78, 0x0A, 0xCA, 0xF8, 0x18, 0xD0,
+    0x18, 0xF6, 0x65, 0xDA, 0x6D, 0x69, 0xDB, 0x0E, 0xEE, 0x40, 0xAB, 0x64, 0xF4, 0x4E, 0xB6, 0x29,
+    0xAD, 0x55, 0x4C, 0x87, 0x2E, 0xA6, 0x4B, 0x2E, 0xA6, 0x4F, 0xB9, 0x21, 0x51, 0x4D, 0x09, 0xAB,
+    0x11, 0xFA, 0x3B, 0x50, 0x2B, 0x62, 0x34, 0x61, 0x5E, 0xCD, 0x98, 0x61, 0xF9, 0xC7, 0x66, 0x38,
+    0x0E, 0xC5, 0x70, 0x1C, 0x8A, 0xE1, 0x66, 0xF8, 0xEA, 0x90, 0xFD, 0x2F, 0x5E, 0x99, 0x2A, 0x69,
+    0x30, 0xFD, 0x0A, 0x36, 0x3E, 0x7C, 0xDB, 0x97, 0x3F, 0x86, 0x8B, 0xAF, 0x81, 0x07, 0xAF, 0x8E,
+    0xBA, 0xC1, 0x7F, 0x6D, 0xC2, 0x75, 0xB8, 0x2E, 0x50, 0x46, 0xAA, 0x58, 0x45, 0x3B, 0x62, 0x53,
+    0x91, 0x4C, 0x82, 0xCC, 0x35, 0x26, 0x38, 0xA4, 0x6E, 0x5E, 0x00, 0x17, 0xAB, 0xF8, 0x38, 0xD8,
+    0x54, 0xA4, 0x4F, 0xF3, 0x65, 0x6E, 0x32, 0xD7, 0x85, 0x46, 0x17, 0xB3, 0x2B, 0xEE, 0xAA, 0xD0,
+    0x52, 0x3E, 0x3D, 0x55, 0x43, 0x9D, 0x6D, 0xCC, 0xCC, 0x50, 0x8C, 0x87, 0x04, 0x30, 0xA9, 0x6E,
+    0x5C, 0x84, 0xA9, 0x1C, 0x8A, 0x04, 0x37, 0xCC, 0x44, 0x86, 0x4B, 0x1C, 0x72, 0x08, 0x87, 0xB8,
+    0x58, 0x37, 0xD4, 0x14, 0x93, 0x8B, 0xB8, 0x8E, 0x70, 0x7D, 0xA0, 0x8A, 0x58, 0x0D, 0x14, 0x03,
+    0x5C, 0x68, 0xE0, 0xFC, 0x6E, 0xE4, 0xED, 0x00, 0x18, 0x09, 0x60, 0xF9, 0xD2, 0x00, 0x64, 0x33,
+    0x03, 0x81, 0x43, 0xA0, 0xEE, 0x5C, 0x07, 0xE5, 0x58, 0x46, 0x30, 0xB3, 0x1D, 0x81, 0xB6, 0x48,
+    0x80, 0x8B, 0x23, 0x60, 0x67, 0x00, 0x2B, 0xBC, 0xA2, 0xD5, 0xE8, 0x94, 0xEC, 0xB4, 0xE0, 0x9B,
+    0x62, 0xAE, 0x63, 0x39, 0x90, 0x8B, 0xCC, 0x44, 0x20, 0xC4, 0x4B, 0xB8, 0x68, 0x97, 0xBA, 0xB1,
+    0x89, 0xF0, 0xB3, 0xC8, 0x4A, 0xA1, 0x11, 0x3F, 0x50, 0x2F, 0xD8, 0x95, 0x4A, 0x13, 0x41, 0x7A,
+    0x47, 0x73, 0x21, 0x8D, 0xF5, 0x82, 0x39, 0x82, 0x47, 0x39, 0x38, 0x3C, 0x3E, 0x3E, 0xBE, 0x74,
+    0xE9, 0xD2, 0xA5, 0xC7, 0x01, 0x28, 0x1B, 0x8E, 0x29, 0x47, 0x02, 0x36, 0x51, 0x77, 0x64, 0xCA,
+    0x81, 0x00, 0x33, 0xD5, 0x40, 0x80, 0x4C, 0x99, 0xA8, 0x3B, 0x8E, 0x31, 0x33, 0x65, 0xA2, 0x8E,
+    0x04, 0x58, 0x28, 0x66, 0xCA, 0x84, 0x1B, 0xF0, 0x91, 0xD0, 0xD0, 0x82, 0x60, 0x85, 0x15, 0x32,
+    0x34, 0xC0, 0x0B, 0xD8, 0x79, 0xF7, 0x2B, 0x27, 0xAA, 0xFB, 0x2E, 0x3E, 0xC5, 0x64, 0x6C, 0xC2,
+    0x0D, 0x84, 0x86, 0x9B, 0x14, 0x13, 0xD5, 0x80, 0x6F, 0xD8, 0x5A, 0x23, 0xD7, 0xB0, 0x09, 0xD7,
+    0x71, 0x03, 0x3B, 0x12, 0x28, 0xA6, 0x6D, 0x64, 0x55, 0xE4, 0x11, 0xC0, 0x35, 0x1F, 0x73, 0xD1,
+    0xBB, 0x26, 0xFC, 0x1F, 0xCA, 0xE5, 0x06, 0xFD, 0x52, 0xFD, 0xDF, 0x7F, 0x1F, 0xFE, 0x0B, 0x9F,
+    0x74, 0x3C, 0xE2, 0x3A, 0x3E, 0x0E, 0x06, 0x38, 0x04, 0x66, 0xB0, 0x23, 0xB8, 0x0E, 0x0E, 0x31,
+    0x47, 0x77, 0x8E, 0xBC, 0x94, 0x7B, 0x29, 0xBD, 0xF7, 0x2C, 0x4C, 0x60, 0x66, 0x9B, 0x8B, 0x6C,
+    0x72, 0x31, 0xDB, 0x54, 0x8E, 0x2E, 0xD6, 0xCD, 0xA7, 0x81, 0x56, 0x3F, 0x92, 0x5E, 0xD2, 0x8A,
+    0xF7, 0xAF, 0xAF, 0xCB, 0xA3, 0x40, 0x31, 0xC2, 0x35, 0x70, 0x11, 0x66, 0xF0, 0x5B, 0x3F, 0x37,
+    0xC1, 0x45, 0xCC, 0x04, 0x01, 0xCA, 0x11, 0x6E, 0x80, 0xEB, 0x28, 0xD2, 0xD6, 0x30, 0x40, 0x86,
+    0xBA, 0xC1, 0x26, 0x38, 0x84, 0x6A, 0xBB, 0x79, 0xD7, 0x70, 0x0D, 0x0E, 0x1A, 0xE0, 0xDC, 0x69,
+    0x03, 0xD2, 0x40, 0x2D, 0x8D, 0x88, 0x76, 0xA8, 0x12, 0x21, 0x86, 0x86, 0xBE, 0xC8, 0xB0, 0xBA,
+    0x11, 0x3B, 0x87, 0x86, 0xEA, 0x8D, 0x0C, 0xFE, 0xA5, 0x04, 0x7D, 0x1D, 0x31, 0xB9, 0xE7, 0x81,
+    0xA6, 0x01, 0x3B, 0x87, 0x0E, 0x37, 0x08, 0xDA, 0x62, 0xC1, 0xCE, 0x36, 0xE3, 0x63, 0xB9, 0x94,
+    0x0B, 0x95, 0x34, 0x50, 0x6A, 0x06, 0x8E, 0x80, 0xA2, 0xE1, 0x62, 0x32, 0x9A, 0xAD, 0x56, 0x5A,
+    0x75, 0xB8, 0x11, 0x3B, 0xC3, 0x0A, 0xE1, 0x7D, 0x1D, 0x98, 0xFE, 0xC7, 0x4E, 0x7A, 0x45, 0x9A,
+    0xB8, 0x78, 0x07, 0x7A, 0x25, 0xF4, 0x33, 0xD1, 0x13, 0xC6, 0x80, 0xCD, 0x75, 0x87, 0xCA, 0x11,
+    0x1F, 0xBF, 0x8C, 0x4B, 0x1B, 0x6B, 0x9B, 0x0C, 0xAC, 0x80, 0x80, 0x7E, 0xBF, 0x35, 0xF7, 0xD5,
+    0xEF, 0xDB, 0x5A, 0x49, 0x4E, 0xD2, 0x2D, 0x49, 0x03, 0x17, 0xEF, 0x50, 0x48, 0x9D, 0x5B, 0xFB,
+    0x31, 0x44, 0x97, 0x02, 0x36, 0x7D, 0x02, 0x3B, 0x41, 0x99, 0xA0, 0x1A, 0xC1, 0x47, 0x8C, 0xE0,
+    0xEA, 0x02, 0x52, 0xE4, 0x7F, 0xF5, 0x09, 0xCA, 0x19, 0x6C, 0x86, 0x62, 0xB7, 0xD9, 0x19, 0xAA,
+    0x09, 0xC2, 0x48, 0xA9, 0x18, 0xB4, 0xE2, 0x35, 0x62, 0xAE, 0x00, 0x98, 0x6F, 0xEE, 0xC6, 0x15,
+    0x12, 0x54, 0x02, 0xA3, 0x04, 0xA1, 0x87, 0xEA, 0xD5, 0x84, 0xC9, 0x01, 0x82, 0x4D, 0xB8, 0x21,
+    0x50, 0xCC, 0x36, 0xD1, 0x12, 0x70, 0xD1, 0xA6, 0x62, 0x22, 0xD0, 0x52, 0xA6, 0x4A, 0x92, 0x5A,
+    0x49, 0x6F, 0x9C, 0x9C, 0xF4, 0x27, 0x60, 0x13, 0x10, 0x78, 0x77, 0xE5, 0x9F, 0xC1, 0xD1, 0xD1,
+    0x15, 0x23, 0x65, 0x23, 0xE5, 0x62, 0x86, 0x62, 0xDA, 0x4E, 0x9D, 0x6D, 0x1A, 0xB1, 0x5A, 0xB1,
+    0x52, 0xE4, 0x9C, 0x12, 0xD4, 0xD3, 0xBD, 0xB9, 0xD8, 0xDD, 0x3C, 0xCA, 0x09, 0x5C, 0x82, 0x76,
+    0xA0, 0x54, 0xD3, 0x6A, 0x21, 0x68, 0xE0, 0xE0, 0x0A, 0x40, 0x35, 0x43, 0xAB, 0x48, 0x7F, 0x07,
+    0x34, 0x80, 0xBA, 0x8D, 0xCC, 0x6D, 0x03, 0x21, 0x42, 0x1D, 0xA1, 0x92, 0x3A, 0x2B, 0x2D, 0xAC,
+    0x47, 0xFD, 0xD0, 0x62, 0x73, 0x1D, 0x69, 0xBF, 0x96, 0x70, 0x6F, 0x64, 0x8A, 0xDC, 0x36, 0xF4,
+    0x6E, 0xC4, 0xDF, 0xCA, 0xB8, 0xB1, 0xED, 0xCA, 0xE4, 0x96, 0x6A, 0x46, 0x9A, 0xA9, 0x34, 0xC1,
+    0x85, 0x86, 0x0B, 0x47, 0x47, 0x57, 0x5A, 0x69, 0x6D, 0xA5, 0xF5, 0xF4, 0xE4, 0x64, 0xB9, 0x81,
+    0x9D, 0x6F, 0x50, 0xA6, 0x17, 0x70, 0xC3, 0x79, 0x7C, 0x07, 0x2D, 0xB0, 0x6C, 0x2F, 0x7D, 0xFF,
+    0xA2, 0xDC, 0xB0, 0x3D, 0x3C, 0x74, 0x1B, 0x45, 0xFA, 0x1D, 0x3F, 0xEC, 0x2E, 0x33, 0x79, 0x5B,
+    0x9C, 0x3C, 0x0A, 0x54, 0x77, 0xC1, 0x6B, 0x26, 0xFC, 0x54, 0x8D, 0x8F, 0x2E, 0xB9, 0xC8, 0x52,
+    0x26, 0xC2, 0x67, 0x33, 0x2E, 0x86, 0xA6, 0x4C, 0xD5, 0x5C, 0x26, 0xF4, 0xFD, 0x89, 0x4A, 0x23,
+    0x68, 0xC1, 0xAC, 0x1A, 0x8B, 0x5C, 0xAE, 0x26, 0x13, 0x86, 0x05, 0x9B, 0xDB, 0x6D, 0x91, 0xD4,
+    0x2F, 0x25, 0xAA, 0xB4, 0x62, 0x27, 0x3F, 0x55, 0xB9, 0x90, 0x32, 0xF5, 0x6E, 0x16, 0xF8, 0xD7,
+    0x28, 0xA4, 0xC6, 0x49, 0xA3, 0x1F, 0xEA, 0x29, 0x34, 0x36, 0xB7, 0x14, 0xB9, 0x87, 0xA5, 0x87,
+    0xB5, 0x87, 0xB5, 0x85, 0x35, 0x44, 0x56, 0x9F, 0x58, 0x9D, 0x5E, 0x5F, 0x0A, 0x29, 0xF3, 0x87,
+    0xCF, 0xEF, 0xA6, 0xE5, 0x12, 0xF8, 0x01, 0xFA, 0x0E, 0xBB, 0xC2, 0xD5, 0x99, 0xAB, 0x1A, 0x68,
+    0x97, 0x6D, 0x59, 0x3F, 0x52, 0xFF, 0x40, 0x6B, 0xB8, 0xA7, 0xD7, 0xAA, 0xDB, 0xEF, 0xA8, 0xFF,
+    0x57, 0x70, 0xD9, 0xE6, 0x72, 0x29, 0x73, 0x31, 0xF1, 0xAE, 0xF2, 0x70, 0x41, 0x04, 0x34, 0x50,
+    0x37, 0x94, 0xC2, 0x68, 0xA0, 0x9D, 0xA8, 0x17, 0x4A, 0x35, 0xF8, 0x01, 0xDA, 0x11, 0xEA, 0x19,
+    0xAA, 0x15, 0x0A, 0x75, 0xD0, 0x8F, 0xDB, 0x7B, 0xFE, 0x23, 0x80, 0x0B, 0x47, 0x47, 0xFF, 0x4E,
+    0xD2, 0x6D, 0x6D, 0x3A, 0x69, 0x57, 0x0E, 0x8E, 0x8E, 0x8E, 0xBC, 0x94, 0x5B, 0x29, 0x9D, 0xDF,
+    0x64, 0x60, 0xB9, 0x40, 0xA9, 0x06, 0xA3, 0x5D, 0x9F, 0x7E, 0x86, 0x2A, 0x43, 0x9D, 0x28, 0x57,
+    0x8C, 0x3A, 0xFA, 0x11, 0xBF, 0x09, 0x82, 0xA2, 0xDB, 0xFA, 0xB9, 0xF8, 0x1A, 0x41, 0x4D, 0xAB,
+    0xE1, 0xF0, 0x7A, 0xA2, 0xC8, 0x70, 0x13, 0x0E, 0xE1, 0x31, 0x08, 0x70, 0xCA, 0xC5, 0xA5, 0xD4,
+    0xEC, 0x34, 0xBA, 0x85, 0x6A, 0xA0, 0x8C, 0xD8, 0xC8, 0x99, 0xB1, 0x61, 0xFE, 0x96, 0x72, 0xA6,
+    0xCA, 0x94, 0x33, 0xE6, 0x32, 0xB0, 0x63, 0xDF, 0x42, 0xBA, 0x03, 0x54, 0x92, 0x12, 0xD4, 0x77,
+    0x38, 0xA7, 0x06, 0x3F, 0x42, 0x35, 0xE1, 0x23, 0xD0, 0x6F, 0x7F, 0xD5, 0xE8, 0x22, 0x5F, 0x69,
+    0xC8, 0x6E, 0x28, 0x34, 0xE3, 0x3F, 0x9F, 0xEC, 0x9D, 0xB6, 0x29, 0x7F, 0x34, 0x9B, 0xA9, 0x1C,
+    0xC9, 0x99, 0xC7, 0x99, 0x09, 0x01, 0x38, 0xC4, 0xFD, 0x20, 0xC2, 0x97, 0x3A, 0xFB, 0xF6, 0xC8,
+    0x45, 0x8D, 0xDC, 0x99, 0xF1, 0x7F, 0x3F, 0x73, 0xED, 0x98, 0xBA, 0x39, 0xC4, 0xD7, 0xD1, 0x45,
+    0xD7, 0xD5, 0xCF, 0x24, 0x9B, 0xAA, 0x54, 0xC7, 0x4C, 0xFF, 0x25, 0x29, 0xFA, 0xC6, 0xE9, 0xEB,
+    0xEA, 0xCA, 0xC4, 0x69, 0xF3, 0xE7, 0x1B, 0xA3, 0x02, 0xF5, 0x00, 0x40, 0xB1, 0x3B, 0xF4, 0x13,
+    0x94, 0x11, 0xA3, 0x3B, 0x47, 0x7D, 0xDA, 0x06, 0x3D, 0x02, 0x17, 0xB5, 0x36, 0xBC, 0xA7, 0x6C,
+    0x66, 0x5D, 0xDB, 0xB1, 0x93, 0x33, 0x50, 0x2F, 0x00, 0xD5, 0xEB, 0x1D, 0x60, 0x7F, 0x92, 0x80,
+    0x22, 0x2D, 0x00, 0xB3, 0x8F, 0xC0, 0xB5, 0x72, 0x13, 0x1E, 0x2B, 0xE0, 0x3A, 0x1F, 0xA1, 0x8A,
+    0x76, 0x93, 0x17, 0x2B, 0x98, 0xF5, 0xA4, 0x8F, 0x20, 0x69, 0x82, 0xF6, 0xE4, 0x64, 0x05, 0xDF,
+    0xE0, 0x23, 0x2E, 0x62, 0x27, 0xAA, 0x01, 0x84, 0x4D, 0x50, 0x47, 0x93, 0xA1, 0x9C, 0x4B, 0x4D,
+    0x78, 0xFD, 0x5C, 0x0B, 0xB5, 0x32, 0x9C, 0xC7, 0xF4, 0x52, 0x57, 0x49, 0x1A, 0x0E, 0x44, 0x1F,
+    0x8B, 0x4C, 0xDB, 0x55, 0x89, 0x53, 0x7C, 0x34, 0x99, 0x9E, 0x72, 0x2C, 0x32, 0xBE, 0xA9, 0x12,
+    0x19, 0x1F, 0xAB, 0x81, 0x5E, 0xA2, 0x90, 0xD4, 0x54, 0xE9, 0x09, 0x35, 0x3E, 0x22, 0x7A, 0x4C,
+    0x2E, 0x32, 0x76, 0xAA, 0x12, 0x6E, 0xF0, 0x91, 0x40, 0x4F, 0x91, 0x8B, 0x8C, 0x1F, 0xAB, 0xB7,
+    0x9E, 0x54, 0x29, 0x69, 0xF4, 0xD2, 0x7C, 0x3F, 0x25, 0xCE, 0x69, 0x6D, 0x8C, 0xB4, 0x52, 0xDF,
+    0x79, 0x32, 0x9B, 0x15, 0x9B, 0xDC, 0x80, 0x8B, 0x2B, 0x1C, 0x96, 0x09, 0xBE, 0xE5, 0xE3, 0x4E,
+    0x34, 0xD8, 0x69, 0x4F, 0xF3, 0x96, 0x9D, 0x84, 0x28, 0xCF, 0x9A, 0x42, 0xB7, 0x13, 0xDA, 0xC5,
+    0x0A, 0xD8, 0x15, 0xA8, 0xD4, 0xF0, 0x68, 0xA5, 0xBB, 0xD7, 0xC7, 0x4A, 0xDB, 0x58, 0x47, 0xB8,
+    0x70, 0x19, 0x38, 0x0F, 0xA6, 0x97, 0x5E, 0xA3, 0x92, 0xB4, 0x70, 0xA0, 0x83, 0xEB, 0x2B, 0x45,
+    0xA6, 0x5A, 0xA9, 0x12, 0x76, 0xC1, 0x47, 0x6C, 0xA6, 0x87, 0x6A, 0x2A, 0x32, 0xB8, 0xB1, 0x4A,
+    0x10, 0xA2, 0x8F, 0xD0, 0xD3, 0xB3, 0xCD, 0x89, 0x2A, 0x55, 0x09, 0xFC, 0xBD, 0x66, 0x3B, 0x17,
+    0x19, 0xDC, 0x50, 0xA5, 0x1D, 0x67, 0xDA, 0x99, 0x1E, 0x42, 0x2C, 0x32, 0x65, 0xA6, 0x7A, 0xEB,
+    0x09, 0xC5, 0x52, 0xD2, 0x84, 0xDF, 0x18, 0x7B, 0x63, 0x02, 0x49, 0x3F, 0x92, 0xA4, 0xA7, 0xDB,
+    0x9F, 0x9E, 0x88, 0x1E, 0x72, 0x91, 0x29, 0xC6, 0x2A, 0x51, 0x36, 0x3B, 0x2E, 0xDF, 0xB4, 0x16,
+    0x55, 0x02, 0xBC, 0x94, 0xE8, 0xA5, 0xAE, 0x58, 0x4F, 0xFE, 0xC7, 0xAE, 0xE9, 0xFE, 0xAB, 0xCE,
+    0x57, 0x89, 0x62, 0xF0, 0x11, 0xD7, 0xF5, 0x70, 0xAD, 0x58, 0xBE, 0xF8, 0xFC, 0x5B, 0xDA, 0xAD,
+    0x7B, 0xD1, 0x4A, 0xBA, 0x2E, 0xE9, 0x87, 0xED, 0x4F, 0xAF, 0xCF, 0x55, 0xE2, 0xB0, 0xC8, 0x54,
+    0x5D, 0x8F, 0x19, 0x7C, 0xDC, 0x1E, 0x50, 0xE4, 0x5D, 0x67, 0xFE, 0x7B, 0x5F, 0xE9, 0x2A, 0x29,
+    0x15, 0x52, 0xDE, 0x1A, 0xDE, 0x73, 0xC5, 0xBE, 0x61, 0x81, 0x5A, 0x2B, 0x95, 0xD4, 0xB1, 0x11,
+    0x78, 0xAB, 0x57, 0xD2, 0x8A, 0xD5, 0x37, 0xAE, 0x8E, 0x46, 0x0D, 0xC7, 0x84, 0x0E, 0x3B, 0x56,
+    0x09, 0x0E, 0x59, 0xA0, 0x88, 0x3E, 0x9E, 0xD9, 0xBA, 0xA1, 0xD9, 0xBF, 0x50, 0x5A, 0x80, 0x32,
+    0x51, 0x69, 0x69, 0x1B, 0x7A, 0xBD, 0x32, 0x61, 0xAE, 0xCF, 0xA1, 0x83, 0xF0, 0xF9, 0x0C, 0x76,
+    0xF2, 0x23, 0x84, 0x46, 0x0D, 0x76, 0xAA, 0x56, 0x08, 0x8D, 0xD7, 0x37, 0xAE, 0x4E, 0xF4, 0x92,
+    0xA0, 0x97, 0x3A, 0xB8, 0x70, 0x05, 0x5A, 0x8D, 0x48, 0xB7, 0xB5, 0x50, 0x6B, 0xFE, 0x83, 0x05,
+    0x2E, 0x6E, 0x62, 0xA3, 0xA5, 0xC8, 0x50, 0xA6, 0x5F, 0x7E, 0x20, 0x49, 0x09, 0xBF, 0xB9, 0x4D,
+    0xEB, 0xC9, 0xC9, 0xF3, 0xE9, 0x03, 0x76, 0xB0, 0x40, 0x35, 0x95, 0x12, 0x95, 0x72, 0xAF, 0x64,
+    0xA4, 0xD8, 0xEA, 0x4D, 0xE9, 0xE9, 0x76, 0xA0, 0xA7, 0xC8, 0x54, 0x09, 0x1F, 0xDF, 0x57, 0x75,
+    0x31, 0xD2, 0xED, 0x8D, 0x91, 0x63, 0xD0, 0xCC, 0x97, 0x26, 0xE8, 0x37, 0xFA, 0xFF, 0x7F, 0xFC,
+    0xB9, 0x11, 0x16, 0xA8, 0x23, 0x76, 0x06, 0x41, 0x3F, 0x10, 0x26, 0xCC, 0x73, 0xD0, 0x2A, 0xD5,
+    0x7A, 0x53, 0xEA, 0x5A, 0x3D, 0xDD, 0x0E, 0xD4, 0x23, 0x3D, 0x66, 0xA5, 0xC8, 0xD4, 0x03, 0x55,
+    0x2A, 0x96, 0x33, 0xE6, 0xDF, 0xCC, 0x2A, 0x1F, 0xA1, 0xFA, 0xF9, 0xCC, 0xE6, 0xAA, 0x41, 0xBF,
+    0x02, 0xC5, 0xBA, 0x02, 0xD5, 0xCF, 0x57, 0xC0, 0xDF, 0x5A, 0x81, 0xDE, 0xAE, 0x50, 0x64, 0xBB,
+    0x42, 0x95, 0xEC, 0x0A, 0x3E, 0xDA, 0x15, 0x7A, 0xAC, 0x28, 0x16, 0xAC, 0x3E, 0x2B, 0x45, 0xAB,
+    0xEF, 0x4B, 0x9B, 0x0E, 0xC3, 0x3C, 0xD7, 0x2A, 0x51, 0x48, 0x1D, 0xA6, 0x1D, 0xDE, 0xBB, 0x1E,
+    0xE2, 0x07, 0x6E, 0xFA, 0x4F, 0x55, 0xC2, 0x8E, 0x3E, 0xE2, 0x9A, 0x1E, 0x6E, 0x16, 0xCB, 0x17,
+    0x9F, 0x7F, 0x63, 0xBF, 0x44, 0x56, 0x2A, 0x25, 0xE8, 0x17, 0x7A, 0x81, 0x53, 0xA4, 0x9D, 0x30,
+    0x1A, 0xB0, 0xEA, 0x08, 0x33, 0x1C, 0x66, 0xEC, 0xEB, 0x11, 0xFB, 0xF2, 0xC0, 0x53, 0x19, 0x9E,
+    0x3A, 0xC5, 0x7D, 0x3D, 0x52, 0xBE, 0x94, 0x98, 0x32, 0xDC, 0x08, 0x78, 0x17, 0xA9, 0xBE, 0x3D,
+    0xDB, 0x71, 0x81, 0x1B, 0x75, 0x7C, 0xBC, 0x1A, 0x70, 0x5D, 0xAE, 0xE2, 0x4D, 0x98, 0xAB, 0x61,
+    0xAE, 0x46, 0x5C, 0x17, 0x1C, 0xC7, 0x30, 0xD9, 0x37, 0x53, 0x39, 0xE2, 0x1A, 0x7F, 0x8D, 0x16,
+    0x33, 0xA1, 0x68, 0x13, 0x75, 0xE3, 0x66, 0x02, 0x45, 0xA2, 0x6D, 0x6C, 0xC2, 0x63, 0x13, 0x01,
+    0x3B, 0xF1, 0x18, 0x76, 0x2E, 0x95, 0xA1, 0x54, 0xEE, 0x15, 0x41, 0x8A, 0x6D, 0x06, 0xE9, 0x25,
+    0x8D, 0x38, 0xCD, 0xA5, 0x1A, 0xFE, 0x60, 0xC2, 0x67, 0xF0, 0x14, 0x1A, 0x29, 0x12, 0xBE, 0x6F,
+    0xF0, 0x14, 0x6F, 0x66, 0x8A, 0x84, 0x77, 0x09, 0x4F, 0x91, 0xDA, 0xA6, 0x48, 0xF8, 0x22, 0xE3,
+    0x29, 0x92, 0x4B, 0x45, 0xC2, 0xD3, 0x76, 0x9E, 0x22, 0x15, 0x4B, 0x91, 0xF0, 0xB8, 0xE4, 0x29,
+    0x12, 0xE1, 0xAB, 0x09, 0x8F, 0x59, 0x3C, 0x45, 0xC2, 0xBD, 0x99, 0xF0, 0x10, 0xAE, 0x53, 0x24,
+    0x8C, 0x12, 0x1E, 0x2A, 0x51, 0x4C, 0x10, 0x52, 0xA9, 0x05, 0x23, 0x7A, 0x0D, 0x1B, 0xBD, 0x37,
+    0x21, 0x70, 0x70, 0x79, 0xD3, 0xE2, 0xCF, 0x42, 0x2D, 0x65, 0xE8, 0x5F, 0xBB, 0x28, 0x8A, 0x15,
+    0x14, 0xCB, 0x19, 0xC2, 0xE8, 0x12, 0xB8, 0x54, 0x0F, 0x50, 0x4D, 0x21, 0x42, 0x39, 0x87, 0x0E,
+    0x6C, 0x0E, 0x0D, 0xD8, 0xDC, 0x36, 0x6C, 0x36, 0xE8, 0x03, 0x7B, 0x9B, 0xDB, 0x0E, 0xEC, 0x1C,
+    0x22, 0xD8, 0x29, 0x0C, 0x50, 0xA5, 0x3A, 0x81, 0x1B, 0xDD, 0x04, 0x3E, 0x96, 0x0B, 0xF4, 0x4D,
+    0xA1, 0xA1, 0x5C, 0xA1, 0x95, 0x26, 0xF6, 0x92, 0xE9, 0x8B, 0xCF, 0xEE, 0x95, 0x8E, 0xD6, 0xA6,
+    0x97, 0x64, 0xDA, 0x78, 0x35, 0x17, 0x99, 0x30, 0xF8, 0xC8, 0x5A, 0x64, 0xDC, 0xE8, 0x23, 0xA7,
+    0xFB, 0xCA, 0x52, 0x64, 0xEA, 0xE8, 0x63, 0x39, 0x15, 0xCB, 0x93, 0x2B, 0x5E, 0x6A, 0x0A, 0xAD,
+    0x0D, 0x3E, 0xEE, 0x78, 0xEB, 0x21, 0x95, 0x01, 0x5A, 0x4D, 0x54, 0xD2, 0x3D, 0xBD, 0x7F, 0x51,
+    0x33, 0x50, 0x4B, 0x33, 0x54, 0xEB, 0x13, 0x4A, 0x14, 0x2B, 0x46, 0x91, 0xB6, 0xC3, 0xAE, 0xB8,
+    0x04, 0x75, 0x32, 0x0B, 0xD0, 0x37, 0x3E, 0x42, 0x39, 0xDB, 0x19, 0x08, 0x71, 0x23, 0x46, 0x39,
+    0x01, 0x3E, 0x6E, 0x14, 0xB8, 0xEF, 0xC0, 0xE6, 0x72, 0x06, 0x42, 0xB7, 0x51, 0xC2, 0x2E, 0x40,
+    0xCF, 0x46, 0x0A, 0xD4, 0x60, 0x33, 0xE5, 0x0A, 0x6A, 0xA8, 0x17, 0xD3, 0x0F, 0xD0, 0x4A, 0x09,
+    0x68, 0xF5, 0x1A, 0x80, 0x1F, 0xEF, 0x05, 0x2A, 0x36, 0xFF, 0x00, 0x8C, 0xEE, 0x5C, 0xD9, 0xDE,
+    0x59, 0x04, 0x0A, 0x6D, 0x76, 0xE9, 0x97, 0x37, 0xBB, 0xF3, 0x9C, 0xB4, 0x42, 0x2F, 0xAD, 0x98,
+    0x36, 0x5E, 0x9D, 0x29, 0x32, 0x21, 0xE2, 0xA3, 0x59, 0x28, 0x32, 0x6E, 0xC4, 0x47, 0x56, 0x8A,
+    0xBC, 0xF9, 0xF9, 0x26, 0x53, 0x64, 0x42, 0x87, 0x8F, 0x7E, 0xA4, 0x58, 0x35, 0x6D, 0x86, 0x3C,
+    0xC5, 0xD2, 0x76, 0xE0, 0x5F, 0x5C, 0xA0, 0xC8, 0x9B, 0x12, 0x0D, 0x91, 0x22, 0x1B, 0x81, 0x8F,
+    0xD5, 0x76, 0x5B, 0xC2, 0x0F, 0x68, 0x68, 0x95, 0xAC, 0xFE, 0x4A, 0xA2, 0x5A, 0x01, 0x3E, 0xBE,
+    0x11, 0xD5, 0x6B, 0x28, 0xA4, 0x5C, 0x2E, 0x4F, 0x66, 0x37, 0x90, 0xEB, 0x48, 0xF6, 0x1D, 0xB3,
+    0x8F, 0x7C, 0xD3, 0x8F, 0xE0, 0xE6, 0x4D, 0xFF, 0x17, 0x9A, 0xA0, 0x55, 0x43, 0xA9, 0x11, 0xDA,
+    0x19, 0xAA, 0xFC, 0x08, 0xC5, 0xF2, 0x38, 0x2C, 0xD7, 0x60, 0x39, 0xC6, 0xE4, 0x16, 0x9B, 0xDB,
+    0xA1, 0x4E, 0xAD, 0x34, 0xD4, 0x5A, 0xE1, 0x8B, 0xCF, 0xD2, 0x4A, 0x92, 0x97, 0xA4, 0xDB, 0x77,
+    0xAF, 0xDF, 0xBD, 0xFE, 0x66, 0x2A, 0x32, 0x37, 0x6E, 0xD0, 0xE3, 0x1F, 0xC3, 0xC7, 0xF2, 0xA5,
+    0xA6, 0x4A, 0x66, 0xD8, 0xDE, 0x37, 0x3D, 0x7B, 0xF1, 0x52, 0xA5, 0xBD, 0xC8, 0xF9, 0x00, 0x8D,
+    0x6A, 0xD8, 0x78, 0xA5, 0x94, 0x06, 0x82, 0x12, 0xBD, 0x7E, 0xA0, 0x99, 0xA0, 0xF1, 0xEA, 0x80,
+    0xE9, 0x9B, 0x32, 0x81, 0x8B, 0x26, 0x83, 0x4D, 0xB4, 0x40, 0xDE, 0x3C, 0x27, 0x7E, 0xD5, 0x13,
+    0x2C, 0x50, 0x26, 0x42, 0x47, 0x31, 0xE3, 0x12, 0x2C, 0x18, 0x81, 0x20, 0xDC, 0x79, 0x42, 0x60,
+    0x25, 0x35, 0xE0, 0xB5, 0xC2, 0x66, 0x31, 0xB5, 0x9A, 0xAC, 0xD6, 0x5E, 0xC9, 0x6A, 0xAD, 0x56,
+    0xA8, 0x87, 0x22, 0x43, 0x1D, 0xCD, 0x0A, 0xA1, 0x41, 0x10, 0xA0, 0x87, 0x63, 0x08, 0x0D, 0x0B,
+    0x84, 0xC8, 0x76, 0xC1, 0x0C, 0x6E, 0xB0, 0x09, 0xAA, 0xD1, 0x26, 0x28, 0x53, 0x39, 0x80, 0x9D,
+    0x5C, 0x84, 0x62, 0x76, 0x1D, 0x90, 0xEB, 0x06, 0x58, 0x02, 0xC0, 0xF1, 0x21, 0x40, 0xB8, 0x01,
+    0x10, 0x32, 0x6C, 0xDE, 0xCC, 0xE6, 0x5A, 0xB1, 0x97, 0x2B, 0x40, 0x50, 0x06, 0xAC, 0x14, 0x34,
+    0x11, 0xB0, 0x5A, 0x4B, 0x35, 0x04, 0xA8, 0x07, 0x56, 0x68, 0x3B, 0xEA, 0x88, 0xA0, 0x8F, 0xF8,
+    0x8E, 0x1E, 0xB4, 0x05, 0xA8, 0x1A, 0xA3, 0x81, 0x00, 0xA1, 0x2B, 0xDE, 0x49, 0x1C, 0x83, 0x8F,
+    0xF6, 0xED, 0xC4, 0x4D, 0xA8, 0xA3, 0xFD, 0xEE, 0x44, 0x06, 0x37, 0x94, 0xDF, 0x9E, 0xCD, 0x0C,
+    0xD5, 0xE8, 0x5E, 0xCC, 0xC5, 0x04, 0x65, 0x72, 0xDD, 0x62, 0x13, 0xD8, 0xA9, 0xE6, 0xD4, 0x8E,
+    0x50, 0xCC, 0x9E, 0xB6, 0x1C, 0xC0, 0xE4, 0x43, 0x42, 0x15, 0x81, 0x7C, 0x0D, 0xFF, 0x85, 0x08,
+    0x2C, 0x37, 0xA8, 0x5F, 0x6E, 0x80, 0xE3, 0x19, 0xF7, 0x03, 0x80, 0x30, 0x51, 0x69, 0x67, 0xE7,
+    0x97, 0x2B, 0x40, 0x3D, 0x62, 0x33, 0x80, 0xDB, 0xF3, 0xD0, 0xAE, 0x78, 0x65, 0xAB, 0xEC, 0x35,
+    0x5B, 0xCD, 0xE7, 0xD4, 0xD0, 0x36, 0xF4, 0x1D, 0xA7, 0x10, 0x06, 0x93, 0xC1, 0x25, 0x9B, 0xA0,
+    0xCC, 0x6E, 0x80, 0x62, 0xF1, 0x0D, 0xA0, 0xE3, 0x7B, 0xB4, 0xF2, 0x09, 0xC0, 0x4D, 0xF7, 0x5A,
+    0x4E, 0x05, 0x98, 0xB9, 0x6F, 0xC0, 0xA6, 0x10, 0xC1, 0x45, 0x97, 0xC0, 0x77, 0xE5, 0x0C, 0x2D,
+    0x76, 0x81, 0x0C, 0xA2, 0x9C, 0xA1, 0x1F, 0x5A, 0xC5, 0x4A, 0x6B, 0xAF, 0xE8, 0xB4, 0xF6, 0x4A,
+    0x4E, 0x6F, 0x4A, 0x5D, 0xD0, 0x8B, 0xFD, 0x40, 0x35, 0xD1, 0x36, 0x04, 0x10, 0x66, 0xC6, 0x2C,
+    0xB8, 0x48, 0x91, 0xB9, 0x06, 0x76, 0xB6, 0x09, 0xAA, 0x54, 0x37, 0xE0, 0xC6, 0x0C, 0xD4, 0xB7,
+    0x23, 0xE0, 0x4F, 0xEF, 0xB9, 0x36, 0x7D, 0xB3, 0x37, 0xD8, 0x29, 0x37, 0x5F, 0x27, 0x9E, 0x99,
+    0x79, 0x0F, 0x34, 0xFF, 0xEF, 0x4D, 0x48, 0x02, 0x52, 0x06, 0x2F, 0xE9, 0xF3, 0x92, 0x72, 0xB8,
+    0x7B, 0xA2, 0x5B, 0x89, 0x2A, 0x5D, 0xC2, 0x2C, 0x36, 0x12, 0xBA, 0x7F, 0x8A, 0xDB, 0xD9, 0x9D,
+    0x84, 0x6E, 0x63, 0x90, 0x22, 0xB3, 0x05, 0x36, 0x1E, 0x3C, 0x18, 0xC1, 0x66, 0x4C, 0xEC, 0x1B,
+    0x2E, 0xD5, 0x23, 0xF6, 0xBB, 0x19, 0x6E, 0xF6, 0x27, 0x27, 0xD7, 0x6F, 0x6B, 0xF3, 0x7A, 0x37,
+    0x93, 0xB5, 0xFF, 0x85, 0xBE, 0x3F, 0x78, 0x6E, 0x14, 0xA9, 0x8A, 0xEF, 0xF3, 0x4F, 0xDF, 0x57,
+    0xC3, 0x53, 0x5B, 0xE4, 0x2F, 0x80, 0x99, 0xB6, 0x70, 0xE0, 0xB5, 0xAD, 0xC5, 0x6F, 0x11, 0x8C,
+    0x7D, 0x4B, 0x82, 0xBA, 0x81, 0xBC, 0x45, 0xFD, 0x0E, 0xA1, 0x48, 0x50, 0x77, 0x90, 0xB7, 0xC0,
+    0x60, 0xD8, 0xC2, 0x3F, 0xAE, 0x83, 0x1B, 0x5B, 0x07, 0x17, 0xC2, 0xAC, 0xD1, 0x75, 0x87, 0xCC,
+    0xF6, 0x7D, 0xFF, 0xE9, 0x27, 0xEA, 0x76, 0x91, 0xB0, 0x69, 0x93, 0x82, 0xFE, 0x06, 0x1C, 0x1E,
+    0xC2, 0xB5, 0x00, 0x37, 0xEA, 0x86, 0xD9, 0x75, 0x45, 0xAA, 0xA2, 0x4D, 0x76, 0x2C, 0x07, 0x9B,
+    0x5C, 0x34, 0x93, 0xEB, 0xC8, 0x1E, 0x6E, 0x3C, 0x06, 0x97, 0x8E, 0x8E, 0x8E, 0x8E, 0x82, 0xA4,
+    0xD7, 0x37, 0x57, 0xF2, 0x13, 0x04, 0xDA, 0x2E, 0x0C, 0x55, 0x32, 0x99, 0xC7, 0x77, 0x0A, 0xBD,
+    0xD2, 0x48, 0x29, 0x45, 0xB3, 0x14, 0x99, 0xD0, 0xB9, 0xA1, 0x98, 0x38, 0xE5, 0x80, 0x6A, 0x04,
+    0x4E, 0xC1, 0x7C, 0x69, 0xE4, 0xA2, 0x56, 0x9C, 0x5E, 0x1F, 0xED, 0xC2, 0x29, 0x81, 0x6A, 0x2C,
+    0x13, 0xA7, 0xB4, 0xB8, 0xD1, 0x2E, 0xA5, 0xFE, 0xDA, 0xEB, 0x6D, 0xC5, 0x7E, 0xA9, 0x13, 0x57,
+    0x38, 0x0F, 0x57, 0x80, 0x3A, 0xEF, 0xD9, 0xF6, 0x20, 0x03, 0x3C, 0x74, 0x67, 0x2E, 0x43, 0xF6,
+    0x6A, 0x58, 0xA4, 0x01, 0xDD, 0xE9, 0x13, 0x6A, 0xAA, 0x99, 0x05, 0x9B, 0xC9, 0x98, 0x4C, 0x86,
+    0xE5, 0xC1, 0xDD, 0xD9, 0x89, 0x22, 0x93, 0xB1, 0x13, 0x99, 0x2A, 0xB1, 0xD2, 0x46, 0x23, 0xA9,
+    0xA1, 0xD7, 0x0C, 0xE6, 0xA8, 0x01, 0x73, 0x05, 0xFA, 0x95, 0x5A, 0x32, 0x4B, 0x99, 0x5D, 0xB4,
+    0xD3, 0x4D, 0xAA, 0x5B, 0x89, 0x47, 0xEB, 0x08, 0xA7, 0x50, 0xCC, 0x9B, 0x10, 0xF2, 0x71, 0xE3,
+    0x2D, 0x6D, 0x9E, 0x66, 0xA9, 0x6F, 0xFC, 0xC7, 0x52, 0x9A, 0x0A, 0xA9, 0xE1, 0xA8, 0x01, 0xB8,
+    0xC0, 0x16, 0x3A, 0xA4, 0x16, 0x60, 0xFA, 0x33, 0x76, 0x7F, 0x60, 0x67, 0xAE, 0xB4, 0xE0, 0x77,
+    0x7E, 0x34, 0xE5, 0x1D, 0x23, 0xDC, 0x40, 0x8B, 0xEF, 0x68, 0x09, 0xD0, 0xD2, 0x42, 0x4B, 0xFF,
+    0x90, 0x5D, 0x0B, 0x2D, 0xA1, 0xA3, 0x25, 0x0C, 0x88, 0xFA, 0xCE, 0x45, 0x51, 0x49, 0xED, 0x62,
+    0xB4, 0xF8, 0xCC, 0x85, 0xE6, 0x00, 0xCC, 0x65, 0x8C, 0x16, 0x82, 0x16, 0x3B, 0xDB, 0x5C, 0x77,
+    0x76, 0xCA, 0x54, 0xAF, 0x26, 0xEA, 0xBF, 0xF9, 0xDE, 0xD1, 0x69, 0x2F, 0xDD, 0x95, 0xF4, 0xFD,
+    0x91, 0xFB, 0x43, 0x74, 0x76, 0x81, 0x52, 0xDF, 0xF8, 0x0F, 0x95, 0x94, 0xCA, 0xB3, 0xE9, 0xFC,
+    0xE1, 0xB3, 0x14, 0xCA, 0xB8, 0x77, 0x84, 0xEF, 0x0E, 0x09, 0x7C, 0x8C, 0x63, 0xE0, 0xE6, 0x76,
+    0x0F, 0x0B, 0x54, 0x52, 0x6C, 0xA5, 0xF8, 0x95, 0xF5, 0xA4, 0xD9, 0xB7, 0xBD, 0xDF, 0xAD, 0x56,
+    0xDE, 0x04, 0xBA, 0xB9, 0xC2, 0x65, 0x7A, 0x69, 0x74, 0x92, 0xBA, 0x95, 0xFE, 0xF7, 0x6C, 0xE2,
+    0x94, 0xBA, 0x33, 0x99, 0x53, 0x6C, 0x2A, 0x66, 0xEA, 0x58, 0x26, 0x4E, 0x71, 0x53, 0x95, 0x70,
+    0x52, 0x43, 0xAB, 0x11, 0x3B, 0xB2, 0x2D, 0x2E, 0x4E, 0x81, 0x42, 0x27, 0x27, 0x8D, 0x95, 0x14,
+    0x2B, 0x49, 0xDD, 0x82, 0xE9, 0xAB, 0x01, 0x72, 0x00, 0x9B, 0x32, 0xF8, 0xCF, 0x67, 0xCA, 0xB9,
+    0xD4, 0xCF, 0xD4, 0x95, 0xD2, 0x88, 0x39, 0x79, 0x8E, 0x8D, 0x03, 0x0B, 0x45, 0xA0, 0xCD, 0x00,
+    0x57, 0xE3, 0x99, 0x6C, 0xAA, 0xDF, 0x53, 0x35, 0x57, 0xA0, 0xFE, 0xB6, 0x26, 0xCC, 0x22, 0x45,
+    0x6A, 0xFD, 0xE9, 0x8A, 0x51, 0xE3, 0x12, 0x75, 0xA4, 0xC5, 0x64, 0xEC, 0x44, 0x1D, 0x09, 0xCD,
+    0x07, 0xA9, 0xD6, 0x8A, 0x5E, 0xB7, 0x94, 0xAD, 0x32, 0xE7, 0x29, 0x27, 0xC2, 0x88, 0x3A, 0x73,
+    0xBF, 0x7E, 0xE0, 0xEA, 0x64, 0x35, 0x9C, 0x53, 0xC3, 0x82, 0x9D, 0x76, 0xD8, 0xC9, 0x43, 0xAB,
+    0xB5, 0x92, 0x14, 0x39, 0xC0, 0x66, 0xDA, 0x58, 0xE6, 0x2D, 0x40, 0xB2, 0xB7, 0x46, 0xE7, 0x4A,
+    0xDD, 0xC5, 0x19, 0xDF, 0x15, 0xBF, 0x7C, 0x67, 0x67, 0x42, 0x53, 0xA5, 0x62, 0x31, 0xEA, 0xFA,
+    0xA1, 0x78, 0x76, 0xA3, 0x95, 0xCF, 0x7B, 0x52, 0x9D, 0xCB, 0x7B, 0xF2, 0x3C, 0x7C, 0x57, 0x2A,
+    0xEF, 0x76, 0xF4, 0x9D, 0xC9, 0x45, 0xC6, 0xE4, 0x2A, 0x61, 0x72, 0xE8, 0x30, 0x79, 0x01, 0xA3,
+    0x0C, 0x66, 0x59, 0xC0, 0xE4, 0xBE, 0xC1, 0xE4, 0x10, 0x31, 0xD9, 0x25, 0x4C, 0xB6, 0x19, 0x93,
+    0x8D, 0x1A, 0x93, 0x69, 0xC7, 0x5A, 0xB1, 0x9E, 0x83, 0xE2, 0xA6, 0x43, 0xAF, 0x70, 0x85, 0x3E,
+    0x95, 0x8A, 0xA6, 0xC7, 0xE4, 0x1D, 0x2A, 0xD5, 0x7E, 0x90, 0x6A, 0xE3, 0xF5, 0x86, 0x14, 0xC1,
+    0x5C, 0xE1, 0xE0, 0x32, 0xC5, 0x5A, 0x69, 0xF0, 0x6A, 0xAC, 0x5E, 0x56, 0x0E, 0x9A, 0xB8, 0xAE,
+    0x1F, 0x4B, 0xFF, 0x5D, 0xA0, 0xC6, 0x2D, 0x84, 0x48, 0x68, 0xCC, 0x2F, 0x23, 0xFB, 0xAF, 0x50,
+    0x1D, 0x09, 0x5D, 0xAD, 0xD1, 0xAB, 0xEB, 0xE5, 0x34, 0x3B, 0x8D, 0x61, 0x37, 0x28, 0xFA, 0xAF,
+    0x6A, 0x26, 0x64, 0x69, 0x2C, 0x7A, 0xFD, 0x37, 0x81, 0xBA, 0x72, 0xBB, 0xB9, 0x63, 0xC1, 0xCE,
+    0xB8, 0x01, 0xDF, 0x6D, 0x40, 0xDC, 0xFB, 0xAB, 0xD6, 0x1A, 0x6B, 0x7D, 0x57, 0xAB, 0xD5, 0x82,
+    0xB9, 0x02, 0x85, 0x16, 0x8C, 0x94, 0xE9, 0x9B, 0x76, 0x74, 0x11, 0x7D, 0x6E, 0xC6, 0xCE, 0x61,
+    0x03, 0x91, 0x4C, 0xEE, 0xA1, 0xBE, 0x9D, 0x20, 0xF7, 0xE0, 0x6E, 0x27, 0x4C, 0x6E, 0x1B, 0xEA,
+    0x5B, 0xF3, 0xE6, 0x75, 0xB5, 0xA8, 0xF3, 0x43, 0x29, 0x4D, 0x38, 0xCD, 0x70, 0xEE, 0xAF, 0x01,
+    0xCC, 0x65, 0xAE, 0xBE, 0xA8, 0xB9, 0xD2, 0x55, 0xE5, 0x8B, 0xBA, 0x73, 0x75, 0x2E, 0x84, 0x4B,
+    0x55, 0xA2, 0x1E, 0x7C, 0x47, 0xE8, 0x4E, 0xA1, 0x2F, 0x66, 0x8A, 0x5C, 0x8D, 0x54, 0xC9, 0x77,
+    0xF8, 0xEE, 0x14, 0xD6, 0x62, 0xC6, 0x4E, 0xD5, 0x48, 0x1D, 0x7D, 0xC7, 0x42, 0xFF, 0xEC, 0xD5,
+    0xB1, 0xD0, 0x3E, 0xA4, 0xE4, 0xBB, 0xFD, 0xE2, 0x9E, 0xD9, 0x40, 0x1E, 0x7C, 0x07, 0x85, 0x5E,
+    0x83, 0x56, 0x09, 0x73, 0x74, 0xD4, 0x00, 0xE6, 0x08, 0xE8, 0xF5, 0x1A, 0x5E, 0x4A, 0xC5, 0xDA,
+    0xB4, 0xD1, 0x0D, 0xB4, 0x9C, 0x62, 0xB2, 0x4D, 0x94, 0xA9, 0x8E, 0xD4, 0xB1, 0x87, 0x76, 0xCF,
+    0x84, 0x65, 0xF2, 0x91, 0x3A, 0xB6, 0xD0, 0xB2, 0x62, 0xB3, 0x5D, 0xF0, 0xA9, 0x5C, 0x9F, 0x54,
+    0x2C, 0xA5, 0x96, 0x52, 0x3F, 0xCC, 0x7B, 0xE3, 0xA4, 0x8E, 0x0F, 0x04, 0x1E, 0x13, 0x98, 0x7E,
+    0x86, 0xA0, 0x09, 0x8E, 0x8E, 0x1A, 0x30, 0x97, 0xFD, 0xD8, 0xBE, 0xAA, 0x97, 0xF4, 0x9F, 0xD5,
+    0x2E, 0x68, 0xF8, 0x63, 0xBB, 0x6C, 0x30, 0x47, 0x68, 0x36, 0xD1, 0x3A, 0xFD, 0x43, 0x87, 0xB5,
+    0x16, 0xA4, 0x09, 0x0E, 0x2E, 0x53, 0x6B, 0x2A, 0xA5, 0x6E, 0x36, 0x73, 0xDD, 0x54, 0x5F, 0x9D,
+    0xF8, 0x8B, 0x7A, 0x00, 0x0D, 0x54, 0x1A, 0xA8, 0x35, 0xE0, 0xD5, 0x50, 0xE7, 0x4F, 0x50, 0xDF,
+    0x8A, 0xE4, 0x43, 0xDC, 0xAD, 0xA9, 0x98, 0xC3, 0x3B, 0x32, 0x52, 0xC7, 0xD1, 0x06, 0x3E, 0x1F,
+    0x42, 0xDD, 0x51, 0x8D, 0x14, 0x33, 0xE7, 0xA4, 0x97, 0xA5, 0x5F, 0x5C, 0xBF, 0xFB, 0x77, 0xC5,
+    0x0C, 0xA7, 0xE0, 0xF7, 0x67, 0xDE, 0x7B, 0x10, 0xA9, 0xEE, 0x3C, 0x81, 0x14, 0xBD, 0x22, 0x47,
+    0x9B, 0xA4, 0x28, 0xFA, 0xAE, 0x12, 0xFD, 0x6C, 0x94, 0x4C, 0xDF, 0x9D, 0x5B, 0xB1, 0x33, 0xD5,
+    0x48, 0xE8, 0x38, 0x7D, 0xBF, 0x55, 0xDF, 0x71, 0x4A, 0x91, 0xF1, 0x23, 0xF5, 0x54, 0x0B, 0x7A,
+    0xBD, 0xAD, 0x58, 0x68, 0x0E, 0x79, 0x93, 0xF8, 0xAD, 0xBA, 0x7E, 0x6D, 0xD5, 0xF5, 0x4B, 0x35,
+    0x51, 0x26, 0x3B, 0x51, 0x0D, 0x76, 0xDE, 0x1C, 0x98, 0xBA, 0x63, 0xD9, 0x7C, 0x8B, 0x63, 0x08,
+    0xDC, 0x00, 0xDF, 0x65, 0x70, 0x2F, 0x4E, 0xE0, 0xBE, 0x9B, 0xA0, 0x7C, 0x75, 0x00, 0xFB, 0x4E,
+    0xDC, 0xE1, 0x1D, 0x88, 0x1D, 0xA7, 0x6C, 0x91, 0xD5, 0xCE, 0x51, 0xEB, 0xEB, 0x1A, 0xCA, 0xA1,
+    0xD4, 0xD8, 0x37, 0xC5, 0x8C, 0x8B, 0x6E, 0x40, 0x94, 0xA3, 0x9D, 0x69, 0x87, 0x62, 0xA2, 0xC5,
+    0xCF, 0x64, 0x5C, 0x74, 0x3D, 0x87, 0xD8, 0xB9, 0x7C, 0x79, 0xF0, 0xD0, 0x16, 0x6F, 0xCC, 0x2E,
+    0xE2, 0xE2, 0x14, 0xEC, 0x40, 0x31, 0x3D, 0x55, 0x7D, 0x27, 0xC1, 0xF1, 0x63, 0x66, 0x9E, 0xC1,
+    0xBD, 0xDC, 0x84, 0x4B, 0x50, 0xBC, 0x13, 0xAB, 0xD7, 0x81, 0x30, 0x1A, 0x75, 0xE0, 0x26, 0xC2,
+    0xC0, 0x2E, 0x64, 0x77, 0xCF, 0x53, 0xE9, 0x94, 0x83, 0x3A, 0xCD, 0x65, 0xC6, 0x77, 0xAC, 0x04,
+    0x68, 0x9B, 0x0C, 0xF5, 0xB7, 0x13, 0x54, 0x6F, 0x47, 0x28, 0xD4, 0xEC, 0x46, 0x6E, 0xD4, 0x81,
+    0x7D, 0x7D, 0x00, 0xF7, 0xB5, 0x09, 0x42, 0x91, 0x21, 0x23, 0x8A, 0x89, 0xD0, 0xF9, 0xD5, 0x28,
+    0xF7, 0xB2, 0xCA, 0xEF, 0x87, 0x62, 0xED, 0x7D, 0x14, 0x9B, 0x1F, 0x4E, 0x31, 0x73, 0xF6, 0xDC,
+    0x8D, 0x62, 0x19, 0x30, 0xF3, 0x1E, 0x9E, 0xAC, 0x47, 0x30, 0x8A, 0xD0, 0x0B, 0xE8, 0xF3, 0x66,
+    0x07, 0x40, 0x90, 0x46, 0x49, 0xB7, 0x7E, 0x7C, 0xB4, 0xD6, 0xB8, 0xF4, 0x97, 0xF4, 0x3C, 0x5B,
+    0x4E, 0x10, 0x1A, 0xEC, 0x0C, 0x3E, 0x52, 0xE4, 0x2D, 0x28, 0xBF, 0xF2, 0xFB, 0x6E, 0xE4, 0x85,
+    0x1E, 0xFB, 0xCA, 0x5B, 0x47, 0x6D, 0xBB, 0xC7, 0xDD, 0xB7, 0x52, 0xE6, 0x42, 0xB1, 0x6D, 0xAA,
+    0x81, 0x05, 0x17, 0xB9, 0x49, 0x35, 0x70, 0xBC, 0x8B, 0x74, 0x25, 0x02, 0x55, 0x2A, 0x32, 0x2D,
+    0x36, 0x53, 0x9D, 0xB5, 0xD9, 0xC4, 0x31, 0xD5, 0xC0, 0x4D, 0x5C, 0x24, 0x53, 0x0D, 0xB4, 0x58,
+    0xFD, 0x6D, 0x25, 0x0E, 0x1A, 0xAB, 0x87, 0x95, 0x11, 0x50, 0x67, 0x75, 0x2F, 0xEB, 0xA0, 0x98,
+    0xEF, 0xCF, 0x33, 0xD8, 0x27, 0x35, 0xD8, 0x44, 0x35, 0x51, 0x25, 0xDA, 0xB8, 0xA9, 0xE3, 0x7D,
+    0xAB, 0x8B, 0x04, 0x76, 0xE9, 0x09, 0x23, 0xBE, 0x31, 0xD9, 0xF4, 0x43, 0xB5, 0x70, 0xD0, 0x60,
+    0x5E, 0xE0, 0x63, 0x4E, 0xDD, 0x63, 0x5E, 0xD3, 0xE9, 0x61, 0xA9, 0xFC, 0x38, 0x6D, 0x82, 0x83,
+    0x86, 0x47, 0x78, 0x04, 0xD7, 0x55, 0xD1, 0x45, 0x17, 0xEB, 0xE8, 0x86, 0x7A, 0xA8, 0x47, 0x3F,
+    0xD6, 0xA3, 0x4B, 0x55, 0x2A, 0xB2, 0x59, 0xF0, 0xB1, 0x1E, 0x4C, 0x36, 0x99, 0xBA, 0x73, 0x91,
+    0x99, 0x1B, 0x1C, 0x70, 0xC0, 0x79, 0x1E, 0xC1, 0x35, 0xAE, 0x63, 0x26, 0x53, 0x47, 0x17, 0xCF,
+    0xAE, 0xB5, 0x93, 0x9D, 0x6D, 0x2E, 0x96, 0x62, 0x31, 0x8B, 0xC9, 0x2C, 0x64, 0x32, 0x33, 0x99,
+    0x47, 0x79, 0xF4, 0x9E, 0x56, 0x7F, 0x61, 0x63, 0xB8, 0x08, 0xEC, 0x62, 0x25, 0xF4, 0x09, 0xC0,
+    0x6C, 0x07, 0xA6, 0xF9, 0xA8, 0xA3, 0x50, 0x3B, 0x40, 0x70, 0x4B, 0xFF, 0x29, 0x37, 0xCF, 0x7F,
+    0xB9, 0x37, 0x2A, 0xF7, 0xDA, 0x3F, 0x30, 0x8D, 0x8F, 0xDC, 0x3C, 0x36, 0xD9, 0x39, 0x6F, 0xF1,
+    0xB4, 0xC8, 0xCE, 0xC6, 0x81, 0xEC, 0x3B, 0x60, 0x03, 0x7B, 0x3F, 0xC3, 0x9F, 0xFC, 0x4E, 0xCC,
+    0xC3, 0xCC, 0x36, 0x01, 0xFA, 0xDC, 0x0A, 0x84, 0xA1, 0x6F, 0xA0, 0x1C, 0x5D, 0xC7, 0x43, 0x8B,
+    0xB9, 0x9F, 0xE1, 0xB4, 0x79, 0xF9, 0x13, 0x67, 0xE1, 0x00, 0xF7, 0x37, 0x11, 0xA8, 0x6E, 0x4D,
+    0x80, 0x1D, 0x7B, 0xC0, 0x4C, 0x75, 0x04, 0xB2, 0x9D, 0x81, 0xC3, 0x0D, 0x54, 0xC2, 0x0D, 0xE0,
+    0xA2, 0x9D, 0xA1, 0xBC, 0x7B, 0xB2, 0x0B, 0x48, 0x0D, 0x98, 0xF5, 0xE4, 0xF9, 0x19, 0x6E, 0x42,
+    0x0F, 0x01, 0xDC, 0x80, 0x6F, 0xB0, 0x19, 0x17, 0xA1, 0xA5, 0x4C, 0x50, 0x8F, 0xB5, 0x06, 0x7A,
+    0xBD, 0xAC, 0x89, 0x76, 0x2F, 0x6A, 0x7E, 0x3B, 0x00, 0x23, 0x65, 0xDE, 0x3B, 0xB5, 0x9B, 0xFD,
+    0xD0, 0xED, 0xBA, 0xAC, 0x07, 0xE0, 0x53, 0xF7, 0x67, 0xD9, 0x95, 0x33, 0xE0, 0x32, 0xE0, 0xD6,
+    0xB3, 0xB0, 0xE0, 0xF9, 0xFB, 0x88, 0x2A, 0x49, 0x7F, 0x25, 0x69, 0x3D, 0xD0, 0xC9, 0xF3, 0xB9,
+    0xC8, 0xD8, 0x54, 0x25, 0xAA, 0xCE, 0x47, 0xFE, 0xE8, 0xA1, 0x30, 0x87, 0x14, 0x37, 0xE3, 0xE9,
+    0xEE, 0xC9, 0x73, 0x0F, 0x01, 0x43, 0x1A, 0x1F, 0xA9, 0x9A, 0x1E, 0x0E, 0x8B, 0x8C, 0x99, 0xAA,
+    0xB7, 0xBE, 0x72, 0xFD, 0x95, 0x7D, 0xC0, 0x73, 0xFF, 0xDA, 0xCB, 0xFD, 0x5D, 0x75, 0xDE, 0xE9,
+    0xD6, 0x7A, 0x7C, 0x70, 0x58, 0xBF, 0x95, 0x71, 0xD9, 0x69, 0x87, 0xB4, 0x17, 0x9A, 0xC0, 0x3F,
+    0x33, 0x6D, 0x39, 0x38, 0x55, 0x57, 0x74, 0xBF, 0xCD, 0x71, 0x15, 0x53, 0x39, 0x52, 0xA7, 0x10,
+    0x69, 0xA3, 0xE0, 0xA6, 0x79, 0x77, 0x3A, 0xC7, 0x6F, 0x16, 0xE4, 0x3D, 0x0F, 0x89, 0x6A, 0xA2,
+    0xCE, 0xD4, 0x0B, 0xE7, 0x32, 0x5C, 0xDE, 0x53, 0xE6, 0xB6, 0xD6, 0x03, 0x35, 0x1F, 0x08, 0x78,
+    0xCC, 0x1B, 0x84, 0xE9, 0xB7, 0xB9, 0x56, 0x1D, 0xA2, 0xCE, 0x56, 0x9D, 0x1F, 0xF6, 0xEC, 0xF0,
+    0xEB, 0xE8, 0x37, 0x80, 0x06, 0xFB, 0xCE, 0xE4, 0xBE, 0x93, 0x7D, 0x77, 0xFC, 0x69, 0x7E, 0x7F,
+    0x97, 0x64, 0xA1, 0xEC, 0x35, 0x1F, 0xA8, 0xA1, 0xE7, 0x83, 0xFF, 0x9A, 0x5A, 0x79, 0xEB, 0x3F,
+    0x34, 0x37, 0xDB, 0xA7, 0xD5, 0x3E, 0x2D, 0xCF, 0xCD, 0xB3, 0xB7, 0xF2, 0x6B, 0xEA, 0xFC, 0x66,
+    0xD1, 0x01, 0x61, 0x7E, 0x7C, 0x0B, 0x4A, 0x47, 0xE0, 0x71, 0x9F, 0x81, 0xA2, 0x3B, 0x7E, 0xB8,
+    0x9C, 0xFC, 0x68, 0xA3, 0x76, 0x1B, 0x4B, 0x8F, 0xC0, 0x2E, 0x4E, 0x5D, 0xEC, 0x62, 0xA4, 0xE9,
+    0x9E, 0x62, 0xBE, 0xDF, 0xF2, 0xF8, 0x88, 0xA2, 0x7C, 0x9B, 0x35, 0xE1, 0x9A, 0x33, 0x9D, 0xBA,
+    0x19, 0xDA, 0x9B, 0x4A, 0x0D, 0xCF, 0xBE, 0x6B, 0x12, 0x1F, 0x59, 0xAC, 0x92, 0xBD, 0xCB, 0xBB,
+    0x69, 0x13, 0x82, 0x36, 0x53, 0x22, 0x82, 0x4D, 0xD5, 0x00, 0x36, 0x9A, 0xEE, 0x77, 0x61, 0x16,
+    0x65, 0x72, 0x11, 0xDC, 0xE4, 0x47, 0x70, 0x93, 0x1F, 0x1E, 0x6A, 0x48, 0x7C, 0x34, 0xC7, 0xBF,
+    0xAD, 0x8A, 0x4F, 0x6E, 0xEF, 0x62, 0xBA, 0x6F, 0x49, 0x6C, 0xAF, 0x64, 0x0B, 0x17, 0xEE, 0xA5,
+    0xEC, 0x59, 0x71, 0xCA, 0x78, 0xBD, 0xAD, 0x15, 0xA7, 0xF9, 0xE2, 0x04, 0x57, 0x87, 0x5F, 0x23,
+    0x8C, 0xB7, 0x3B, 0x11, 0x1A, 0x4C, 0xC6, 0x8D, 0x70, 0x8A, 0xCD, 0x10, 0x1A, 0xDA, 0x48, 0x88,
+    0xB8, 0xF5, 0x68, 0x67, 0xFD, 0x0D, 0x67, 0xB3, 0xD9, 0xD2, 0xEA, 0x36, 0x30, 0x17, 0xF8, 0xD6,
+    0x3D, 0x6B, 0x6D, 0x9B, 0x8F, 0x55, 0x03, 0xD8, 0x3B, 0x0F, 0x9B, 0xCD, 0x47, 0x79, 0x3A, 0x9C,
+    0x85, 0xD5, 0x77, 0x76, 0xF3, 0xB6, 0x48, 0xC2, 0xBF, 0x4D, 0x40, 0x68, 0x8E, 0x81, 0x8A, 0xB2,
+    0xF9, 0x5D, 0x9A, 0x4E, 0x60, 0x01, 0xFC, 0xD8, 0x76, 0x50, 0x4D, 0xF5, 0x08, 0xCC, 0x45, 0x7A,
+    0x98, 0x32, 0xF9, 0x68, 0x62, 0xC6, 0x00, 0xFC, 0xA3, 0xB3, 0xAC, 0xE7, 0x6E, 0x67, 0x39, 0x57,
+    0xD3, 0x3E, 0x98, 0xF6, 0x2F, 0xDF, 0xBD, 0xEC, 0x7F, 0xFD, 0xB8, 0x12, 0x7F, 0xC2, 0x86, 0xA5,
+    0xA1, 0x9D, 0x01, 0x65, 0xA7, 0x1D, 0xF0, 0xE0, 0x1E, 0x20, 0xE1, 0xD1, 0x2E, 0x5D, 0xA9, 0x55,
+    0xA6, 0x1E, 0x7C, 0xB4, 0x33, 0x0B, 0xBE, 0xA9, 0x46, 0x2E, 0x73, 0xBA, 0x93, 0xBF, 0x17, 0x56,
+    0x4C, 0xAF, 0x11, 0xAD, 0x2B, 0x61, 0xA8, 0x46, 0xBB, 0x3D, 0xB9, 0x1A, 0xCB, 0xC4, 0x4A, 0x18,
+    0xDA, 0x3B, 0x9F, 0x93, 0xDA, 0x5C, 0xE9, 0x3B, 0xE2, 0xA0, 0x31, 0xBB, 0x45, 0xB6, 0x6C, 0x08,
+    0x30, 0xA5, 0x22, 0xE4, 0x53, 0xF0, 0xC5, 0x44, 0x39, 0xB8, 0x8E, 0x4F, 0x9D, 0xE9, 0xDA, 0x0F,
+    0xE3, 0xE9, 0xA6, 0x39, 0x00, 0xD9, 0x8C, 0x4B, 0x21, 0xB2, 0xDA, 0x79, 0x6B, 0xF9, 0x90, 0xA7,
+    0xFC, 0xEB, 0x42, 0xD0, 0x2E, 0xEF, 0xC0, 0xCB, 0x09, 0xAA, 0x7B, 0xE0, 0x68, 0x68, 0xE0, 0xCF,
+    0x76, 0x16, 0x67, 0xDC, 0x5C, 0xAA, 0x7E, 0xEB, 0xE4, 0xEC, 0x3B, 0x82, 0xA7, 0xEE, 0x4D, 0xF0,
+    0x02, 0xD4, 0x1A, 0xAC, 0x34, 0x84, 0x2E, 0xBC, 0x38, 0x13, 0xBE, 0x10, 0x39, 0x0D, 0x98, 0x3B,
+    0xCB, 0xD1, 0x93, 0x3F, 0xDB, 0xB2, 0x20, 0x97, 0xDD, 0x90, 0xF6, 0x19, 0xE9, 0x61, 0x80, 0xF6,
+    0xCE, 0x13, 0x43, 0x2F, 0xD1, 0x6A, 0xDA, 0x16, 0xE4, 0xEF, 0x6D, 0x50, 0x97, 0x9D, 0x20, 0x6C,
+    0xC1, 0x2D, 0x17, 0xE1, 0x33, 0xF7, 0xF1, 0x6E, 0x43, 0xA9, 0x09, 0x69, 0x72, 0xA3, 0x4B, 0xC7,
+    0xB8, 0xEF, 0x26, 0xFC, 0xD7, 0x23, 0xC7, 0xED, 0xD1, 0x13, 0x77, 0x25, 0xFD, 0x4C, 0xD2, 0xD5,
+    0x6E, 0x63, 0xE1, 0x7D, 0xAE, 0xF8, 0x04, 0xF5, 0x7A, 0xF4, 0x2D, 0x2F, 0xC5, 0x5A, 0xDB, 0x67,
+    0x39, 0x34, 0xDB, 0xC2, 0x50, 0xC4, 0xA9, 0xE3, 0x38, 0x34, 0x36, 0x05, 0x02, 0x97, 0xF8, 0xB3,
+    0x9D, 0x28, 0xFE, 0x35, 0x3D, 0xE8, 0xB2, 0x69, 0xDC, 0x10, 0xBA, 0xF6, 0xE9, 0xD5, 0x2C, 0x76,
+    0xBA, 0xFF, 0x9B, 0x2F, 0xAE, 0x40, 0xAB, 0xC6, 0x49, 0xCD, 0x8A, 0xCA, 0x91, 0x25, 0x50, 0xCC,
+    0x99, 0xF2, 0x27, 0x6F, 0x1D, 0x5D, 0xBD, 0x2E, 0xAD, 0xBD, 0xF4, 0x8B, 0x79, 0xE3, 0x8D, 0x3A,
+    0x6E, 0x2F, 0x44, 0x0D, 0x46, 0x3F, 0x7E, 0xF2, 0x73, 0xDB, 0x77, 0x0C, 0xC3, 0x6E, 0xED, 0xFF,
+    0x05, 0x36, 0x51, 0x8F, 0xF8, 0x01, 0x3F, 0x50, 0xC7, 0xFB, 0xD6, 0xDB, 0x39, 0x35, 0x61, 0xE1,
+    0xEA, 0x2F, 0xC7, 0x46, 0x8C, 0xE4, 0x94, 0x29, 0x1A, 0xEA, 0x8E, 0x95, 0x2A, 0xD1, 0x62, 0xD3,
+    0x7D, 0x3D, 0x99, 0x7E, 0x70, 0x6A, 0x2E, 0xBE, 0x0F, 0xA0, 0xA5, 0xD5, 0x2D, 0x09, 0x1E, 0xA1,
+    0x9C, 0x08, 0xA9, 0x50, 0x72, 0xB7, 0xC7, 0x5C, 0xDD, 0x1E, 0xDC, 0xBF, 0xE1, 0x91, 0x5F, 0xA9,
+    0xAB, 0x03, 0x1E, 0x0D, 0x9D, 0xDA, 0xA8, 0xD0, 0xAD, 0x07, 0xF7, 0x99, 0x91, 0xE7, 0xD4, 0x38,
+    0x35, 0xE7, 0xD4, 0x10, 0x7E, 0xF9, 0xAF, 0x54, 0x76, 0xDA, 0x3B, 0x67, 0x21, 0x7E, 0x13, 0x2A,
+    0x7D, 0xA1, 0x81, 0x45, 0x13, 0x38, 0x2B, 0xE0, 0xFC, 0xB9, 0x77, 0x85, 0xBB, 0x3E, 0x7C, 0x5C,
+    0x08, 0xC0, 0x76, 0x3B, 0x7C, 0xD7, 0x25, 0xA0, 0x8D, 0x3B, 0x2B, 0xC1, 0x4E, 0x40, 0xD9, 0xBD,
+    0x6B, 0x38, 0x1F, 0x02, 0x88, 0x54, 0xEC, 0xE3, 0xD1, 0x3E, 0xEE, 0xF2, 0x83, 0xD7, 0x3D, 0xE6,
+    0x33, 0xDC, 0x4F, 0x8D, 0x0B, 0x0D, 0xF8, 0xED, 0x53, 0xA9, 0x58, 0x4D, 0xE5, 0x4A, 0xC6, 0x4D,
+    0xBE, 0x23, 0x3C, 0x93, 0x28, 0x72, 0xBB, 0x3D, 0xD9, 0xEC, 0x9F, 0x4C, 0xEE, 0xA1, 0x7E, 0x69,
+    0xDA, 0xC0, 0xC7, 0xF0, 0xF9, 0x85, 0x32, 0xB9, 0xB9, 0x58, 0x68, 0xA5, 0x06, 0xA9, 0x83, 0x3F,
+    0x6F, 0x76, 0xD6, 0x5E, 0x88, 0x6C, 0xD9, 0x3A, 0x9A, 0xC0, 0x7F, 0x21, 0x52, 0x8E, 0xC7, 0x30,
+    0x9B, 0xC4, 0xC1, 0x8E, 0x65, 0x3E, 0xA4, 0xA7, 0x5F, 0x36, 0x0D, 0x3E, 0xB6, 0xD8, 0xA5, 0x9A,
+    0xF0, 0xB1, 0xDD, 0x7D, 0xFC, 0xF9, 0x21, 0x4F, 0x99, 0x6D, 0xD1, 0xEE, 0x02, 0x55, 0x5B, 0x62,
+    0xCD, 0x3E, 0x95, 0x28, 0x9E, 0xE5, 0xAE, 0xF1, 0x10, 0xFB, 0xE3, 0x37, 0x01, 0x11, 0x01, 0xCF,
+    0x02, 0xF8, 0xE6, 0x2C, 0x5D, 0x5C, 0x67, 0xB9, 0x74, 0x36, 0xC1, 0x03, 0xF2, 0xF8, 0xAC, 0xFC,
+    0x8B, 0x99, 0x3E, 0x55, 0xEA, 0x6A, 0x71, 0x71, 0xE6, 0xEA, 0x07, 0x1B, 0x54, 0xE8, 0x76, 0x68,
+    0xC1, 0x88, 0x8F, 0xC5, 0x8A, 0xD1, 0x67, 0x95, 0xA8, 0xA4, 0x36, 0xE3, 0xF5, 0x8C, 0xE2, 0x96,
+    0x64, 0xB1, 0x31, 0xC3, 0x96, 0xBF, 0xA4, 0x08, 0xF8, 0x15, 0x28, 0x5F, 0x9D, 0x80, 0xEC, 0x22,
+    0x78, 0x2E, 0x81, 0xE9, 0x1E, 0x0C, 0x5B, 0xFF, 0x26, 0x46, 0x76, 0xC0, 0xA3, 0x60, 0x67, 0x37,
+    0x42, 0xFB, 0xF4, 0x0A, 0x76, 0x72, 0x03, 0x3C, 0xF2, 0x40, 0x08, 0xEF, 0x37, 0x49, 0xA8, 0xAB,
+    0x92, 0xD4, 0xD1, 0x4B, 0x52, 0x26, 0xDC, 0x7D, 0x72, 0x3D, 0xE9, 0x63, 0x3D, 0x11, 0x1A, 0x6E,
+    0xD8, 0x8C, 0x9D, 0x28, 0xA3, 0x20, 0x34, 0x7C, 0xA6, 0x1E, 0xB0, 0xD3, 0x16, 0xE8, 0x0A, 0x0D,
+    0x84, 0x0E, 0x3B, 0xED, 0x34, 0xF0, 0xF6, 0xF1, 0x9A, 0x95, 0x72, 0x99, 0x20, 0x48, 0xB1, 0x6D,
+    0xB0, 0xEB, 0xC9, 0x73, 0x3B, 0x0C, 0xEA, 0xEC, 0xE2, 0xDD, 0xBD, 0x3E, 0x62, 0x27, 0xE8, 0xB6,
+    0x9E, 0x3F, 0x59, 0xCD, 0xD8, 0x09, 0x3B, 0x86, 0x44, 0x68, 0x38, 0x44, 0x6F, 0xD9, 0x3B, 0x5F,
+    0xBC, 0x3E, 0x14, 0xDA, 0x46, 0xB5, 0xFD, 0xC7, 0xBD, 0x05, 0x6B, 0xAE, 0x60, 0xAE, 0x40, 0xAB,
+    0xCE, 0xAB, 0x2B, 0xA4, 0x24, 0xA5, 0x6A, 0xBA, 0xF8, 0xCE, 0x5C, 0xE6, 0x3A, 0x1A, 0x8D, 0xE4,
+    0xD0, 0xD0, 0x47, 0x96, 0x00, 0x21, 0x72, 0xDA, 0x42, 0xF8, 0xDE, 0xD1, 0xDA, 0x83, 0x97, 0x96,
+    0xED, 0x2F, 0xF7, 0x9B, 0xE0, 0xEA, 0xCF, 0x12, 0x6D, 0xC2, 0xF6, 0xDD, 0x5B, 0xBB, 0x7D, 0x9B,
+    0xA5, 0x09, 0xEA, 0xA9, 0x94, 0xBE, 0xF1, 0x3F, 0x2B, 0xE9, 0x87, 0x9B, 0x1A, 0x6D, 0x5A, 0x8D,
+    0xFC, 0x93, 0x67, 0x31, 0x47, 0x9C, 0x9C, 0x9C, 0x9C, 0xB4, 0x92, 0x7E, 0x7A, 0x72, 0x72, 0xF2,
+    0xDC, 0xC9, 0xAE, 0xF4, 0x3B, 0x7C, 0xEB, 0xEE, 0xEE, 0xF8, 0xEF, 0x68, 0x0E, 0xAB, 0x38, 0x79,
+    0x9B, 0xDA, 0x32, 0xB5, 0xCF, 0xE4, 0x03, 0x0E, 0xEC, 0x1C, 0x5E, 0xCC, 0x2E, 0xE6, 0xFA, 0x73,
+    0xE9, 0x52, 0xD5, 0x9D, 0x87, 0xC6, 0x30, 0xDB, 0x78, 0xC3, 0x8E, 0x97, 0x8A, 0xE4, 0x99, 0x5D,
+    0x3C, 0x2E, 0x93, 0xFF, 0x6C, 0x76, 0x63, 0xFB, 0xD5, 0xEC, 0x52, 0xE8, 0x2E, 0x1B, 0x0E, 0x38,
+    0x1F, 0x9E, 0xCE, 0xE1, 0xC5, 0xB5, 0x8E, 0xBD, 0x8B, 0xBD, 0x8B, 0x37, 0xEB, 0xE6, 0x86, 0x67,
+    0xBE, 0x64, 0xD2, 0x0B, 0x76, 0x38, 0x6F, 0xF0, 0x70, 0x83, 0xE2, 0xCD, 0x95, 0x6A, 0xC6, 0xBF,
+    0x9E, 0x09, 0x09, 0xBD, 0x3E, 0xD0, 0x37, 0xC5, 0xF2, 0x28, 0x5C, 0xC6, 0x34, 0xFF, 0x0F, 0xCD,
+    0x99, 0x31, 0xEC, 0x27, 0x47, 0x75, 0xC7, 0x3F, 0xBB, 0x93, 0xBB, 0x45, 0xD9, 0x62, 0x5C, 0x60,
+    0x11, 0xB0, 0xC2, 0x52, 0xA4, 0x8A, 0x82, 0x27, 0x05, 0x05, 0x05, 0xDC, 0x8C, 0x8D, 0xA2, 0xB4,
+    0x57, 0xF8, 0x6F, 0x24, 0xAE, 0xA0, 0x47, 0x4A, 0xAE, 0x49, 0x91, 0xC2, 0xBE, 0x59, 0x27, 0x45,
+    0x8A, 0x14, 0x5C, 0x81, 0x43, 0x99, 0x0A, 0x45, 0xFC, 0x5D, 0x5C, 0x0A, 0x0A, 0x22, 0x9D, 0xFF,
+    0x33, 0x80, 0x14, 0x8A, 0x2B, 0x58, 0x40, 0x88, 0x82, 0x82, 0x25, 0x38, 0x41, 0x40, 0x71, 0x13,
+    0xB3, 0x0E, 0x7B, 0xE7, 0xD9, 0xFD, 0xA6, 0xD8, 0xDF, 0xFF, 0xEE, 0x6C, 0x82, 0x04, 0x49, 0x08,
+    0xF9, 0x49, 0xBF, 0xB7, 0xB3, 0x6F, 0x76, 0xF7, 0xCD, 0xBC, 0x99, 0xF7, 0xDE, 0xF7, 0xBD, 0x01,
+    0xA0, 0x5D, 0xBA, 0x99, 0xA1, 0xF8, 0x4C, 0xCC, 0x82, 0xD7, 0x9B, 0x85, 0x77, 0xFE, 0xA2, 0xA4,
+    0x7F, 0x91, 0xA4, 0x57, 0xE2, 0x4F, 0xCE, 0x45, 0x82, 0xDA, 0x56, 0xDA, 0xB9, 0x2F, 0x74, 0xC1,
+    0x65, 0x20, 0x01, 0x6D, 0x05, 0xFA, 0x02, 0x38, 0xA9, 0x90, 0xA4, 0xB1, 0xDD, 0xCF, 0xBF, 0x78,
+    0x62, 0x3D, 0xF9, 0xD4, 0x53, 0x7D, 0xA1, 0x9D, 0x5C, 0xC6, 0x8E, 0x09, 0x5E, 0x6E, 0xB7, 0x4F,
+    0xBD, 0xF6, 0x96, 0x24, 0xDD, 0x93, 0xA4, 0xC7, 0x62, 0x5F, 0x3A, 0x84, 0x8F, 0x00, 0xBE, 0x00,
+    0x0C, 0x1B, 0x40, 0x7F, 0x7F, 0x04, 0xCC, 0x8F, 0x0A, 0xD0, 0x96, 0x0D, 0x60, 0x75, 0x19, 0x78,
+    0xB9, 0x2B, 0x80, 0x67, 0x07, 0xEC, 0xE8, 0x32, 0xF4, 0xD9, 0x2C, 0x60, 0x0A, 0x3B, 0x34, 0xFB,
+    0x79, 0xCA, 0x20, 0x69, 0x81, 0x78, 0x7E, 0xBE, 0x83, 0x0B, 0xB8, 0x8C, 0xCD, 0x98, 0x85, 0x7E,
+    0x02, 0x61, 0x0A, 0x0C, 0xB9, 0xA9, 0xD0, 0xAD, 0x9D, 0x16, 0x9C, 0x7E, 0xA6, 0x8D, 0x41, 0x35,
+    0x4A, 0xFA, 0xAA, 0x24, 0x35, 0xF1, 0x27, 0x77, 0x56, 0x12, 0x66, 0x6E, 0x2B, 0x36, 0xF4, 0x85,
+    0x3F, 0xE2, 0x5D, 0x3A, 0x78, 0xEB, 0x3A, 0x38, 0xE9, 0x36, 0x49, 0x9A, 0xDB, 0xDA, 0xA4, 0xB9,
+    0x2F, 0xB8, 0xEC, 0x32, 0x7E, 0x4C, 0xB0, 0xB7, 0x95, 0x76, 0xED, 0x0B, 0x76, 0x76, 0x99, 0x18,
+    0x12, 0x5D, 0x6D, 0xB7, 0x33, 0x7D, 0x45, 0x52, 0xED, 0xA5, 0xFD, 0x52, 0x01, 0x4F, 0xD1, 0x24,
+    0x69, 0xEC, 0x25, 0x4D, 0x57, 0x44, 0xCA, 0x6D, 0x25, 0x8E, 0x7D, 0xE1, 0x02, 0x97, 0x9B, 0x4A,
+    0xA2, 0x9B, 0xDB, 0x8A, 0x0B, 0x7D, 0xA1, 0xE2, 0x72, 0x3F, 0x91, 0x24, 0x5A, 0x49, 0xA1, 0x2F,
+    0x2F, 0x2A, 0xB8, 0x8C, 0x48, 0x34, 0xB5, 0xAD, 0x98, 0xA5, 0x2F, 0xD8, 0xC9, 0x65, 0x3C, 0x89,
+    0xB6, 0xB6, 0x15, 0x37, 0xF7, 0x6F, 0xDD, 0x50, 0x27, 0x69, 0x76, 0xD2, 0xFA, 0x78, 0xB1, 0xEF,
+    0x4B, 0xFA, 0xF7, 0xF8, 0x93, 0x54, 0xFB, 0xC2, 0xAD, 0xB6, 0x62, 0xC7, 0x84, 0x99, 0x5C, 0x66,
+    0xE9, 0x0B, 0xBF, 0xD7, 0xD6, 0xD3, 0x6C, 0x5D, 0x3E, 0x16, 0xFC, 0x57, 0x60, 0x6C, 0x30, 0x68,
+    0xA7, 0x97, 0x46, 0x70, 0x92, 0x2A, 0x4E, 0xD2, 0xCA, 0x95, 0x74, 0xAE, 0x11, 0x5E, 0x22, 0x72,
+    0x49, 0xEF, 0x3E, 0x41, 0x2B, 0x11, 0x58, 0x89, 0xC0, 0x42, 0x84, 0x66, 0x21, 0x42, 0x5B, 0x88,
+    0x60, 0x0E, 0x3A, 0x13, 0xA1, 0x9B, 0x88, 0xD0, 0x67, 0x22, 0xD8, 0x91, 0x08, 0x43, 0x20, 0x82,
+    0x87, 0x08, 0x17, 0x10, 0xB9, 0xBA, 0x9F, 0x7D, 0x2A, 0x5D, 0xF7, 0x92, 0xB4, 0x79, 0x49, 0xDA,
+    0x7D, 0x00, 0xB6, 0x13, 0x05, 0xA8, 0x0E, 0xE0, 0xAE, 0x03, 0x78, 0xE9, 0x83, 0x00, 0x1F, 0x7D,
+    0x0F, 0xC0, 0x1F, 0xFC, 0x96, 0x4C, 0x60, 0xC3, 0x69, 0x61, 0x23, 0x4E, 0x56, 0x15, 0xE5, 0xA1,
+    0x32, 0xCC, 0xA4, 0xB9, 0xBD, 0x39, 0x9A, 0x85, 0xF8, 0x02, 0xED, 0xC2, 0x86, 0x07, 0x3C, 0x3E,
+    0x0C, 0x01, 0xCC, 0x64, 0x27, 0x3B, 0x02, 0x77, 0xCD, 0xD2, 0x67, 0xC0, 0x86, 0xCD, 0x4C, 0x40,
+    0x53, 0xFC, 0xF3, 0x05, 0xC0, 0x4B, 0x0B, 0xC0, 0x70, 0x92, 0x64, 0xA7, 0xCD, 0x4E, 0x40, 0x3F,
+    0xFB, 0xE7, 0x2A, 0xD0, 0x15, 0x3B, 0xF9, 0x11, 0xCC, 0x6A, 0x96, 0x6E, 0x81, 0xB6, 0xB2, 0x91,
+    0xA0, 0xD9, 0xF1, 0xC1, 0x16, 0x10, 0x76, 0x6A, 0x77, 0x50, 0x30, 0x0B, 0x7E, 0x42, 0x23, 0x7B,
+    0xE8, 0x36, 0x94, 0x7B, 0x6D, 0xA4, 0x49, 0xD9, 0x48, 0xA1, 0xDB, 0x3F, 0x10, 0x00, 0x78, 0x3F,
+    0x5C, 0x79, 0x01, 0xA2, 0x4A, 0x23, 0x29, 0xC4, 0xDB, 0xAE, 0xB8, 0xD0, 0xEC, 0x7D, 0xC6, 0xFF,
+    0x55, 0xA1, 0x9F, 0xFF, 0x12, 0xB3, 0x02, 0xDB, 0x49, 0x3B, 0x11, 0x92, 0x60, 0xD0, 0x42, 0xF3,
+    0x9A, 0x02, 0x0C, 0x05, 0x9A, 0x1D, 0xF0, 0x23, 0xD8, 0x37, 0x33, 0xE6, 0xC1, 0x42, 0xB3, 0x09,
+    0xE4, 0x96, 0x46, 0x9F, 0x90, 0x14, 0x06, 0xED, 0xF0, 0x81, 0xCF, 0x41, 0xD4, 0xDC, 0x48, 0xF7,
+    0xB4, 0x31, 0x68, 0x7D, 0xDF, 0x06, 0xCF, 0x2C, 0xB8, 0x0C, 0x91, 0xB6, 0x82, 0x2D, 0xB8, 0x8C,
+    0x11, 0x6D, 0x05, 0x15, 0x5C, 0xC6, 0x27, 0xDA, 0x8A, 0xFD, 0x6E, 0xC1, 0x65, 0xB3, 0x44, 0xDA,
+    0xCA, 0xD6, 0x15, 0x5C, 0xF6, 0x21, 0xD2, 0x56, 0x3B, 0x75, 0x05, 0xF7, 0xB5, 0x85, 0x48, 0x5B,
+    0x37, 0xBA, 0x82, 0x53, 0x20, 0xD2, 0x6A, 0xA6, 0x2B, 0xB8, 0x15, 0x22, 0xED, 0x0E, 0x5D, 0xB9,
+    0x94, 0xB3, 0x41, 0xBF, 0x74, 0xDA, 0xE9, 0x55, 0x93, 0xE6, 0x46, 0xCA, 0xB4, 0x13, 0x05, 0xB8,
+    0xC5, 0x30, 0x82, 0x59, 0xCC, 0x0A, 0xB8, 0xB7, 0x75, 0xD8, 0xDB, 0x08, 0xF0, 0x3B, 0xFC, 0x82,
+    0xD3, 0xFD, 0x7F, 0x39, 0x13, 0x80, 0x46, 0xCA, 0x66, 0xED, 0xB5, 0xE3, 0xCB, 0x15, 0x85, 0x56,
+    0xB9, 0xAD, 0x0C, 0xDF, 0xA1, 0x2F, 0x54, 0x70, 0xB9, 0x9B, 0x20, 0x71, 0x0D, 0xDA, 0xDA, 0x14,
+    0xE8, 0x8B, 0x1D, 0xC1, 0xE5, 0xBB, 0x40, 0xD2, 0x04, 0xAD, 0x94, 0xA1, 0x2F, 0x7E, 0x04, 0x97,
+    0x23, 0x90, 0x10, 0xB4, 0xB5, 0xD9, 0xA0, 0x2F, 0x6D, 0x05, 0x97, 0x4D, 0x85, 0x44, 0xBF, 0xD2,
+    0x56, 0xEC, 0x42, 0xBF, 0x60, 0x97, 0x4E, 0x62, 0x58, 0x9C, 0x2A, 0xC3, 0x0A, 0x70, 0x35, 0x9C,
+    0x7C, 0x89, 0x3F, 0x7C, 0x89, 0xCE, 0x35, 0xBE, 0xD3, 0x7F, 0xFC, 0x32, 0x5F, 0xF2, 0x04, 0x3D,
+    0x3C, 0x4A, 0x53, 0xDE, 0xED, 0x57, 0xDE, 0xE1, 0x51, 0x32, 0x11, 0x5C, 0x20, 0xF2, 0xD1, 0x04,
+    0x91, 0x58, 0x21, 0x85, 0xB4, 0x30, 0xA8, 0xC6, 0x09, 0xAF, 0xFA, 0x7E, 0x00, 0x7A, 0x15, 0x48,
+    0x1B, 0x49, 0x60, 0x95, 0x89, 0x0B, 0x8D, 0x26, 0x8C, 0x46, 0xFC, 0x0A, 0xD7, 0x2A, 0xE6, 0x7E,
+    0xC6, 0x7C, 0x63, 0xE2, 0xA5, 0x0A, 0x2F, 0x5D, 0x60, 0x3F, 0x9B, 0xE9, 0xBE, 0x5E, 0x58, 0x2A,
+    0xDC, 0xF5, 0x38, 0x9B, 0xE9, 0xBF, 0xBA, 0x9A, 0x79, 0x83, 0xBB, 0x43, 0xFE, 0x58, 0x3F, 0x61,
+    0xC7, 0xDA, 0xE7, 0xD7, 0x61, 0xED, 0xA7, 0xB5, 0x9F, 0xB1, 0xA3, 0xB7, 0xDC, 0x82, 0xC5, 0xBC,
+    0x59, 0xBA, 0x19, 0x1B, 0xDC, 0xCB, 0x44, 0x9A, 0x05, 0x65, 0x53, 0x18, 0x82, 0x5D, 0xF1, 0xB4,
+    0x85, 0x18, 0x4C, 0xC1, 0x61, 0x0A, 0x1E, 0xB3, 0xF0, 0x2C, 0x66, 0xED, 0x54, 0xA1, 0x53, 0x4D,
+    0xCA, 0x20, 0xE5, 0xA8, 0x99, 0x5F, 0xBE, 0xC5, 0x1E, 0xEF, 0x83, 0x5F, 0x7E, 0x23, 0x49, 0x05,
+    0x27, 0x49, 0xB4, 0xFB, 0xF9, 0xF9, 0x6B, 0xE5, 0xD7, 0xFC, 0xC0, 0x69, 0x8B, 0xE9, 0xD8, 0x62,
+    0xE5, 0xD8, 0x62, 0x57, 0xAE, 0x03, 0xAD, 0x74, 0x1B, 0x06, 0xA9, 0x42, 0x7A, 0xE3, 0x19, 0xD1,
+    0xEE, 0xA0, 0xDC, 0xAD, 0xE0, 0x67, 0x5B, 0xC0, 0x96, 0x61, 0x82, 0x7E, 0xF1, 0x19, 0xBA, 0xD5,
+    0x8F, 0x60, 0xAA, 0x0F, 0x60, 0x6A, 0x0C, 0xD0, 0xFE, 0x02, 0x35, 0x35, 0x8E, 0x60, 0x56, 0x9F,
+    0xC1, 0x2C, 0x7E, 0x82, 0xBE, 0x0C, 0x05, 0xEC, 0x6C, 0x17, 0x70, 0xB9, 0xDB, 0x20, 0x85, 0x56,
+    0x53, 0xB7, 0x43, 0x94, 0x16, 0x4E, 0xE1, 0x8A, 0x4F, 0xDD, 0x3E, 0xC2, 0xA2, 0x74, 0x53, 0x92,
+    0xF4, 0x95, 0xF8, 0xF0, 0xFC, 0xB5, 0x9D, 0xBE, 0x80, 0x0F, 0x6D, 0x05, 0x3B, 0x91, 0xC0, 0x1C,
+    0xDA, 0xDB, 0x7E, 0x03, 0x1D, 0x1B, 0x0C, 0x6F, 0x0C, 0xAA, 0x24, 0xDD, 0x93, 0xF0, 0x2A, 0x00,
+    0x57, 0xA5, 0x3D, 0x24, 0x49, 0x4D, 0xCC, 0x37, 0x6B, 0x5B, 0xF1, 0x93, 0xCB, 0xEC, 0x6D, 0x3D,
+    0x90, 0xC5, 0xC5, 0x65, 0x63, 0x6B, 0x2B, 0x43, 0x76, 0xB9, 0x5B, 0xDA, 0xED, 0xC6, 0x8E, 0x93,
+    0x42, 0xAB, 0x3D, 0xE0, 0xF2, 0x29, 0x64, 0xFD, 0x17, 0x8D, 0x09, 0xA2, 0x16, 0x7A, 0x29, 0x9C,
+    0x1C, 0xD2, 0x55, 0xED, 0xA1, 0x91, 0x76, 0x86, 0x07, 0x37, 0x6A, 0xB3, 0x63, 0x8A, 0x9D, 0xB0,
+    0x79, 0x87, 0x6B, 0x5D, 0x81, 0x2F, 0xB9, 0x0C, 0xEC, 0x80, 0x59, 0x80, 0x61, 0x3A, 0x7C, 0x39,
+    0x4D, 0x05, 0xBA, 0x47, 0x2C, 0x3F, 0x02, 0x02, 0xDA, 0x1D, 0x30, 0x3B, 0xD0, 0x2B, 0xF0, 0xDE,
+    0x5E, 0x0F, 0xEF, 0xCC, 0xBD, 0x0E, 0xF8, 0x32, 0xC3, 0xD3, 0xD7, 0x0F, 0x95, 0x3B, 0x49, 0xBA,
+    0xF7, 0xF0, 0xCE, 0xC3, 0x3B, 0x6F, 0x96, 0xB6, 0x72, 0xF7, 0x2E, 0x09, 0xF7, 0x2C, 0x2E, 0x77,
+    0x5F, 0x0F, 0x7D, 0x69, 0xA6, 0x63, 0xB8, 0x24, 0x2E, 0x23, 0x6C, 0x5F, 0x2E, 0x03, 0xF1, 0xAF,
+    0xC1, 0x54, 0xE0, 0x98, 0x6A, 0x27, 0x4D, 0x44, 0x15, 0xA3, 0x3D, 0xA9, 0x18, 0x6D, 0xFD, 0x06,
+    0x6E, 0x6A, 0x37, 0x70, 0x81, 0xFD, 0x12, 0x4F, 0xBC, 0x0E, 0x7E, 0xA4, 0xC2, 0x90, 0x9B, 0x05,
+    0xEC, 0x6C, 0x0A, 0x74, 0xA5, 0x9B, 0xC0, 0xAC, 0x36, 0x43, 0x53, 0x87, 0x00, 0xEC, 0x0E, 0x20,
+    0xBE, 0x0C, 0xE0, 0x2B, 0x80, 0x5D, 0xB8, 0x14, 0x4D, 0x37, 0x01, 0xD8, 0x0C, 0xFC, 0xB1, 0x03,
+    0xB8, 0x75, 0x01, 0x90, 0x56, 0x80, 0x38, 0x03, 0x7C, 0xE0, 0xD0, 0xFD, 0xF9, 0xF9, 0x08, 0xCD,
+    0xB1, 0x1B, 0x6F, 0x2C, 0x00, 0xDD, 0x0C, 0x70, 0xE3, 0xAD, 0x03, 0x6B, 0x3C, 0xA0, 0xD5, 0xFD,
+    0xB7, 0x95, 0xFB, 0xB5, 0x9B, 0x87, 0xE2, 0xA6, 0x6E, 0x36, 0xD5, 0x8F, 0xDD, 0xDC, 0x6C, 0x91,
+    0x6E, 0x66, 0x4F, 0x74, 0x33, 0x7A, 0x82, 0xEE, 0x31, 0x74, 0x33, 0x9B, 0xCF, 0xDD, 0x6C, 0xEA,
+    0x50, 0xBA, 0xB9, 0x5F, 0xFA, 0xBD, 0x9B, 0xE3, 0xD4, 0x1C, 0x00, 0xE4, 0x19, 0x69, 0x06, 0xFA,
+    0xF9, 0xB1, 0xAC, 0xE1, 0xC1, 0x61, 0x95, 0x23, 0x34, 0xE7, 0xE7, 0xE0, 0x54, 0x8D, 0xAA, 0xD3,
+    0x6A, 0xB4, 0x5E, 0x55, 0x20, 0x06, 0xD2, 0xC8, 0x05, 0xF8, 0xA9, 0xA9, 0x60, 0x8B, 0x29, 0xD0,
+    0x55, 0x3B, 0x41, 0xBB, 0xB9, 0x00, 0xE8, 0xD6, 0x63, 0x3D, 0xB8, 0xF2, 0x58, 0x1B, 0x07, 0xE7,
+    0x42, 0x40, 0xB3, 0xA6, 0x00, 0xA6, 0xF8, 0x0C, 0x36, 0xDB, 0x02, 0x6E, 0xEC, 0x56, 0x88, 0x98,
+    0x0D, 0x2A, 0x88, 0x6E, 0x85, 0x34, 0x45, 0xE5, 0x5E, 0x7B, 0x52, 0xB6, 0xDA, 0xA3, 0xE6, 0x4E,
+    0x72, 0x5A, 0x5A, 0xE9, 0x95, 0x38, 0xF1, 0xBE, 0xC3, 0x6E, 0x12, 0x47, 0x24, 0x21, 0x41, 0x5F,
+    0x70, 0x99, 0xB6, 0xFE, 0x06, 0x3A, 0xF6, 0x57, 0x5F, 0x4C, 0xD3, 0x20, 0x49, 0xFA, 0x9E, 0xA4,
+    0x13, 0xBA, 0x6A, 0x36, 0x00, 0x3C, 0x8F, 0x96, 0x18, 0x53, 0x00, 0xF8, 0x32, 0x00, 0x1F, 0x04,
+    0xA0, 0x0D, 0x5E, 0xC5, 0xAB, 0x48, 0xA3, 0x34, 0xDE, 0x9C, 0xB8, 0x39, 0x11, 0x21, 0xD2, 0x54,
+    0x9A, 0x4A, 0x57, 0xE8, 0x0A, 0x43, 0x66, 0xC8, 0x07, 0x9B, 0x8D, 0xA6, 0x62, 0x56, 0xBA, 0x82,
+    0x5D, 0x18, 0x32, 0xC3, 0x83, 0x33, 0x81, 0x93, 0x2A, 0x0C, 0x52, 0x01, 0xC2, 0x90, 0x39, 0x19,
+    0xDF, 0x61, 0x7D, 0x74, 0x47, 0xF6, 0xF4, 0x98, 0xDD, 0x6E, 0x5C, 0x86, 0x61, 0x2B, 0x11, 0x35,
+    0x25, 0x65, 0xE9, 0x8E, 0x8A, 0xD7, 0x1C, 0xF5, 0xCD, 0x98, 0x9B, 0x34, 0x36, 0x0A, 0xFD, 0x8C,
+    0xCD, 0xB8, 0xB1, 0x5D, 0x31, 0x85, 0x7E, 0xE6, 0x02, 0x2A, 0xED, 0x8A, 0x1B, 0xF1, 0x70, 0xC1,
+    0xFF, 0xE5, 0x03, 0xFB, 0x17, 0x3E, 0xF9, 0xE0, 0xC5, 0x3B, 0xCB, 0xA1, 0x6A, 0xE9, 0xA7, 0xA7,
+    0xEB, 0x7A, 0x39, 0xFA, 0xBF, 0x55, 0xB5, 0x5A, 0x07, 0x2D, 0xEF, 0xAB, 0x3C, 0xB3, 0x32, 0x2C,
+    0x8F, 0x3E, 0xF1, 0xE8, 0xDB, 0xBF, 0x6D, 0xC6, 0x69, 0x0A, 0xDD, 0x69, 0xE8, 0x35, 0x9D, 0x1A,
+    0x07, 0xAE, 0x3A, 0xAD, 0xD6, 0xA3, 0xA5, 0x02, 0x2E, 0x19, 0x76, 0x3C, 0x35, 0x4E, 0x59, 0x1A,
+    0xFD, 0xA5, 0x5B, 0xFE, 0x50, 0x3C, 0x42, 0xA4, 0xB4, 0x42, 0x3A, 0x57, 0x80, 0xBB, 0x24, 0x2E,
+    0xE9, 0x97, 0x49, 0xC0, 0x5F, 0x1C, 0x6E, 0xEF, 0x9D, 0xF4, 0x0B, 0x01, 0x48, 0xDA, 0x81, 0x24,
+    0x4D, 0x90, 0x70, 0x05, 0x12, 0x66, 0xBD, 0xDC, 0xF1, 0x89, 0xA6, 0x42, 0x82, 0x27, 0xDA, 0x27,
+    0x60, 0xB6, 0x40, 0x3A, 0x4B, 0x33, 0x56, 0x52, 0xC0, 0x49, 0x6F, 0x3C, 0x02, 0xAE, 0x85, 0x56,
+    0xBA, 0xA3, 0x15, 0xA4, 0x6F, 0xC6, 0x09, 0xAE, 0x28, 0xF4, 0x05, 0xF0, 0x63, 0x5B, 0x01, 0x3B,
+    0x93, 0x00, 0xB3, 0x72, 0x8A, 0x19, 0xEF, 0xEE, 0xFC, 0x42, 0xC0, 0xAC, 0x38, 0x69, 0x64, 0xA7,
+    0x97, 0xB6, 0xA3, 0x33, 0x65, 0x3B, 0x93, 0x30, 0xEB, 0xF1, 0x66, 0x3A, 0xDE, 0x1C, 0xB2, 0x1F,
+    0xDB, 0x4A, 0x57, 0xEC, 0x4C, 0xA2, 0xA9, 0x47, 0xE7, 0x7E, 0x74, 0xA6, 0xE0, 0xC7, 0x76, 0x7B,
+    0x51, 0xA3, 0x5D, 0x06, 0x49, 0x21, 0xEA, 0xA7, 0xD2, 0x03, 0xFC, 0x65, 0xB6, 0x7B, 0x39, 0xDA,
+    0x91, 0x26, 0x4E, 0xBF, 0x98, 0xC5, 0xBD, 0x33, 0xB1, 0x7B, 0x78, 0x06, 0x4E, 0x9A, 0x48, 0x52,
+    0x69, 0x2B, 0xF1, 0xBF, 0x99, 0xD7, 0x03, 0x4D, 0xD2, 0x6D, 0xAC, 0xB4, 0x31, 0x3C, 0xB8, 0xA1,
+    0x30, 0x8C, 0xC4, 0x69, 0x08, 0x0C, 0x65, 0x80, 0x7E, 0xB1, 0x60, 0xEA, 0xA5, 0xD8, 0x66, 0x3B,
+    0xC8, 0x20, 0x6D, 0x58, 0x69, 0xE7, 0x77, 0xCF, 0xCF, 0xB7, 0x47, 0x1D, 0x8F, 0x9E, 0x33, 0xEB,
+    0xEF, 0x43, 0x5F, 0x3C, 0xD8, 0x39, 0x8E, 0xC4, 0xEC, 0x97, 0xAB, 0x3A, 0x3C, 0xC3, 0x55, 0xE9,
+    0x36, 0x3C, 0xFD, 0xC2, 0x63, 0xF9, 0x83, 0x56, 0x5A, 0x6D, 0xF4, 0xDA, 0xE8, 0xA5, 0x85, 0x4F,
+    0x2F, 0xD8, 0xED, 0x86, 0xC2, 0x81, 0xB6, 0x5D, 0x39, 0x96, 0xB8, 0x15, 0x2E, 0x9B, 0x15, 0x7C,
+    0x3E, 0x70, 0x79, 0xB7, 0xB6, 0x95, 0x1D, 0x10, 0x09, 0x1F, 0xC0, 0x65, 0x97, 0x87, 0x0C, 0x7D,
+    0xE9, 0xA5, 0x02, 0xCD, 0xD6, 0x4A, 0x15, 0x88, 0x21, 0x9D, 0x0B, 0x18, 0xB2, 0xCB, 0x2E, 0x43,
+    0x57, 0xFA, 0x72, 0xA4, 0x93, 0x6D, 0x6D, 0x76, 0x60, 0x27, 0xE1, 0x33, 0xC4, 0xE0, 0x72, 0xBF,
+    0x1C, 0x22, 0x10, 0x0C, 0x53, 0x5B, 0x71, 0x85, 0x61, 0x26, 0x05, 0xA3, 0xDB, 0x37, 0xE7, 0x4E,
+    0x3B, 0x5E, 0x9A, 0x5B, 0x69, 0x3C, 0x05, 0x41, 0x68, 0xCE, 0x80, 0x53, 0xA0, 0x72, 0xD2, 0x86,
+    0xDD, 0x3F, 0xB9, 0xD1, 0x6E, 0xB8, 0x11, 0x1F, 0xDA, 0x95, 0xAE, 0xE0, 0x46, 0x12, 0xED, 0x4A,
+    0xFF, 0xB8, 0x69, 0x16, 0xDC, 0x88, 0x9B, 0xDB, 0x15, 0xD2, 0xC3, 0x34, 0xD2, 0x48, 0xEB, 0x25,
+    0xD2, 0xDB, 0xDA, 0x15, 0x7C, 0x76, 0x23, 0xDD, 0xD2, 0xAE, 0x20, 0xDC, 0x88, 0xCF, 0xED, 0x4A,
+    0xBF, 0xE2, 0xC6, 0x56, 0x98, 0x8D, 0x94, 0x3B, 0xED, 0x7E, 0x46, 0xFA, 0xC1, 0x6D, 0xE0, 0x80,
+    0xAB, 0xBD, 0x66, 0x3A, 0x29, 0x37, 0x5B, 0x5B, 0xF1, 0xA3, 0x9D, 0xDA, 0x85, 0x0B, 0xAE, 0x1C,
+    0x01, 0xF4, 0x02, 0x9A, 0x4F, 0xCF, 0x3C, 0xA3, 0x1D, 0xAB, 0xFB, 0xB3, 0xD9, 0xB8, 0xC0, 0xD3,
+    0xCF, 0x5D, 0xE1, 0x82, 0x88, 0x9D, 0xCD, 0xD6, 0xE9, 0x73, 0x4E, 0x3F, 0x57, 0x4E, 0xDB, 0x50,
+    0x78, 0x81, 0xA7, 0x00, 0x1A, 0xE0, 0x93, 0x13, 0x07, 0x2C, 0xAE, 0xCD, 0x7E, 0x63, 0xA5, 0x02,
+    0xAF, 0x9F, 0xC2, 0xCA, 0x30, 0x42, 0x9F, 0xC1, 0x94, 0xB4, 0xB2, 0x4B, 0x53, 0x7C, 0x70, 0x63,
+    0x73, 0x33, 0xF1, 0x5E, 0xA1, 0xFB, 0x8F, 0x15, 0xF6, 0x0B, 0x70, 0xF7, 0x33, 0xFD, 0xCF, 0x0B,
+    0xED, 0x56, 0x21, 0xF9, 0x80, 0xFF, 0x6C, 0xC1, 0x7E, 0x73, 0xA3, 0x2F, 0x7E, 0xEE, 0x8B, 0x91,
+    0x16, 0x9C, 0x66, 0xF8, 0xCC, 0xE1, 0x4F, 0xD2, 0x81, 0x28, 0xE7, 0xAE, 0xF4, 0xAB, 0x29, 0x4D,
+    0x35, 0x85, 0x6A, 0x0A, 0xAB, 0x29, 0x4D, 0x31, 0x7A, 0x7B, 0x36, 0x52, 0x31, 0xE5, 0x7D, 0xD5,
+    0x14, 0x76, 0x53, 0xB8, 0x75, 0xFA, 0x6F, 0xA6, 0x74, 0xD5, 0x49, 0x25, 0x9D, 0x96, 0x27, 0x49,
+    0x6F, 0x4A, 0xCA, 0xF1, 0xD5, 0xC4, 0xC6, 0x5D, 0xB3, 0x34, 0xC5, 0x4E, 0x66, 0xF4, 0xE1, 0x3D,
+    0x6C, 0x07, 0x42, 0xB4, 0x13, 0xF8, 0xC0, 0x3B, 0x6E, 0x47, 0x7A, 0x55, 0x92, 0x0A, 0x48, 0xDA,
+    0xF0, 0x92, 0x68, 0x2E, 0x5E, 0xAC, 0x60, 0xB9, 0x05, 0x5D, 0x1E, 0x46, 0x9A, 0xD2, 0xCD, 0xF0,
+    0x52, 0xB3, 0xC2, 0xB3, 0xDC, 0x02, 0x1B, 0x86, 0x11, 0x33, 0x75, 0x85, 0xA6, 0x34, 0x15, 0xBE,
+    0x4C, 0x84, 0x8F, 0x33, 0x64, 0x1C, 0x5D, 0xC1, 0xDD, 0xBE, 0xBA, 0x21, 0x49, 0xD5, 0x4B, 0x92,
+    0xCD, 0x60, 0xBF, 0x56, 0xC0, 0x94, 0x0A, 0xD4, 0x67, 0x81, 0x67, 0xBB, 0x00, 0xDD, 0x73, 0x19,
+    0x98, 0x68, 0xAE, 0xD3, 0x68, 0xC3, 0x6B, 0x33, 0xAB, 0xA9, 0xC3, 0x68, 0x96, 0x4A, 0xFF, 0xC3,
+    0xC2, 0xF0, 0xF7, 0xDF, 0x39, 0xBB, 0x48, 0xD2, 0x43, 0x49, 0xDF, 0x9B, 0xC1, 0x8D, 0x47, 0x2C,
+    0xDD, 0xC0, 0x6C, 0xD0, 0xE9, 0xD5, 0x3F, 0xEB, 0xA5, 0xD2, 0x49, 0x81, 0xB3, 0xC0, 0x15, 0x80,
+    0x2B, 0xC4, 0x10, 0x45, 0x6A, 0xF4, 0x9C, 0xD6, 0xBE, 0x36, 0x91, 0xC8, 0xAD, 0xEB, 0x5C, 0x63,
+    0x35, 0x33, 0xBC, 0x64, 0x66, 0x07, 0x7C, 0xD9, 0x8E, 0x0B, 0x50, 0xAE, 0xF5, 0x19, 0xDA, 0x87,
+    0xFB, 0xEB, 0x80, 0x3D, 0xCA, 0x71, 0x17, 0xC3, 0x31, 0xD2, 0x6B, 0x5D, 0x01, 0x1F, 0x56, 0x3B,
+    0xD1, 0x54, 0x33, 0x0F, 0x19, 0x3B, 0xD9, 0xD1, 0x8F, 0x88, 0x6B, 0xF8, 0x60, 0x4B, 0xAF, 0x31,
+    0x8E, 0x22, 0x89, 0xF4, 0xCA, 0x75, 0x80, 0xF7, 0xC2, 0xD3, 0x81, 0xA8, 0xEC, 0x24, 0x33, 0xF7,
+    0xEB, 0x47, 0x70, 0x23, 0xCD, 0x0A, 0x0E, 0xBA, 0x99, 0x54, 0xE9, 0x55, 0x68, 0x52, 0x86, 0x0A,
+    0xF6, 0x5B, 0x81, 0xED, 0x2E, 0xF6, 0x1B, 0x73, 0xB7, 0x46, 0xED, 0x8D, 0x14, 0x38, 0x83, 0xA4,
+    0x90, 0x74, 0x53, 0xD9, 0x29, 0xC7, 0x40, 0xC4, 0x66, 0x5C, 0x36, 0x05, 0x57, 0xA8, 0xB8, 0x8A,
+    0xC7, 0x45, 0x6C, 0xF6, 0x43, 0x36, 0xC5, 0x77, 0x85, 0xEA, 0x9B, 0x8A, 0xBF, 0x45, 0xC4, 0xEE,
+    0x0C, 0xD9, 0xEC, 0x74, 0x85, 0x9D, 0xA6, 0x1E, 0xA8, 0x39, 0x6D, 0x68, 0x4B, 0x0A, 0x49, 0x81,
+    0x0F, 0xF3, 0x2C, 0x0C, 0xA3, 0xCD, 0x98, 0x62, 0x0A, 0xE8, 0x93, 0x2B, 0xF4, 0x5A, 0x81, 0xA7,
+    0xAF, 0x3F, 0x59, 0x06, 0xF9, 0x0D, 0x8E, 0x01, 0xAE, 0xB4, 0xDA, 0xD8, 0x7B, 0x15, 0x5B, 0x9B,
+    0x8D, 0x8B, 0xEB, 0xA6, 0x74, 0x13, 0x36, 0x5F, 0x03, 0xDF, 0x14, 0xA8, 0x36, 0x60, 0x1E, 0x56,
+    0xB0, 0x2A, 0xE0, 0xFF, 0xB4, 0x40, 0xB5, 0x13, 0xA6, 0xD8, 0x8C, 0xCD, 0x2E, 0xE3, 0x8F, 0x2C,
+    0x20, 0x06, 0xA7, 0x90, 0x9E, 0xD7, 0x46, 0x1A, 0x81, 0xF7, 0xD2, 0x48, 0xAA, 0x8D, 0xA4, 0x95,
+    0x67, 0xBE, 0x13, 0x47, 0xBA, 0xEC, 0xC3, 0x13, 0xA4, 0x1F, 0x7D, 0xC0, 0x8E, 0x3E, 0x60, 0x83,
+    0x0F, 0x58, 0x7C, 0x60, 0xC0, 0x07, 0x1C, 0x3E, 0xF0, 0x71, 0x7C, 0xF8, 0xD0, 0x5D, 0x7C, 0x88,
+    0x0B, 0x7E, 0x8C, 0xA5, 0x55, 0x8D, 0xB9, 0x57, 0x7D, 0xFA, 0x12, 0x2A, 0xC7, 0xD5, 0xEF, 0xA0,
+    0xC5, 0x88, 0x46, 0xA3, 0xB9, 0x1F, 0xCC, 0xFD, 0x60, 0xBE, 0x9F, 0xBB, 0xEF, 0x07, 0xF3, 0xDD,
+    0xC9, 0x7E, 0x3A, 0x98, 0x6F, 0x17, 0x3B, 0x04, 0xF3, 0xAD, 0xE5, 0xC3, 0x43, 0x30, 0xD3, 0xFA,
+    0xB1, 0x21, 0x98, 0xE9, 0xEE, 0x97, 0x86, 0x60, 0x26, 0x5F, 0x86, 0x60, 0x26, 0x37, 0x0F, 0xC1,
+    0x4C, 0x43, 0x1E, 0x82, 0x99, 0xEC, 0x38, 0x04, 0x33, 0x5F, 0x61, 0x18, 0x9D, 0x68, 0x54, 0x93,
+    0x30, 0xAA, 0x49, 0x21, 0xE9, 0x8E, 0x26, 0xAF, 0x29, 0x8E, 0x4D, 0xC2, 0x4E, 0x0C, 0xD9, 0x2C,
+    0x74, 0xE5, 0x00, 0xA0, 0x3E, 0x10, 0xB1, 0x0F, 0xCF, 0x53, 0x36, 0x92, 0x0A, 0xFB, 0xD9, 0x8B,
+    0x97, 0xCC, 0x77, 0x3F, 0x39, 0x92, 0x48, 0x7B, 0xA3, 0x3D, 0x69, 0x4C, 0x1A, 0x69, 0x5E, 0x80,
+    0x56, 0x1B, 0x8D, 0x54, 0x49, 0x21, 0xCE, 0x36, 0xA3, 0xE7, 0x57, 0xCC, 0xEA, 0xC1, 0x7D, 0xBD,
+    0xD0, 0xD4, 0x04, 0xC3, 0xBD, 0x02, 0x35, 0x81, 0xBD, 0x57, 0x68, 0x6A, 0x0C, 0x0C, 0x5F, 0x5B,
+    0x8F, 0xAC, 0x3D, 0xA2, 0xD1, 0x4D, 0x9D, 0xB4, 0x60, 0xB5, 0xC2, 0xD5, 0xCF, 0x41, 0x7A, 0x94,
+    0x9B, 0x8F, 0xF1, 0xD5, 0xB3, 0x1D, 0x3B, 0xE1, 0x46, 0xB3, 0xD0, 0xCF, 0x6C, 0xB4, 0x2B, 0x3E,
+    0x70, 0xF1, 0x2B, 0x32, 0x47, 0x76, 0xD2, 0xDE, 0xA8, 0x26, 0x8D, 0x52, 0x80, 0xE6, 0x3A, 0x37,
+    0xBF, 0xA2, 0xB5, 0xD7, 0x4D, 0xD5, 0x67, 0xF4, 0xE0, 0xE6, 0xDA, 0x0A, 0x5B, 0xFA, 0xC2, 0x30,
+    0xB9, 0x11, 0x3F, 0x5E, 0x40, 0x6A, 0x57, 0xDA, 0xDA, 0xCF, 0xF4, 0xC5, 0x8D, 0xB8, 0xF1, 0x02,
+    0xF6, 0x76, 0xC5, 0x2C, 0xFD, 0xCC, 0x90, 0xDD, 0xC8, 0x46, 0xBA, 0x7D, 0x73, 0x6E, 0x75, 0x59,
+    0x01, 0x77, 0xE3, 0x11, 0x15, 0x68, 0xD7, 0xCB, 0x24, 0xCB, 0x8D, 0xD0, 0xEA, 0x8D, 0x03, 0x90,
+    0x34, 0x67, 0x67, 0x01, 0x68, 0x5E, 0x80, 0xB4, 0x33, 0x48, 0xCD, 0xD6, 0x55, 0x9B, 0xCD, 0xF2,
+    0x3A, 0xFD, 0xD7, 0x0A, 0xEF, 0x1D, 0x32, 0x5C, 0x1C, 0x6F, 0xF7, 0xE5, 0x80, 0x29, 0x31, 0x80,
+    0x8E, 0x84, 0xBA, 0xD3, 0xAB, 0x7F, 0xDE, 0x49, 0x4B, 0x7B, 0x72, 0x45, 0xE9, 0x94, 0x46, 0xDF,
+    0xFB, 0x71, 0xFA, 0xCC, 0xCF, 0xE6, 0x21, 0xBF, 0xB4, 0x76, 0xC5, 0x7E, 0xB8, 0xA9, 0xE6, 0x9F,
+    0x89, 0xDC, 0x66, 0xC8, 0x47, 0x82, 0xD0, 0xD4, 0x53, 0x76, 0xF0, 0x0E, 0x46, 0x82, 0xAB, 0x12,
+    0x46, 0xCA, 0x44, 0x8D, 0x69, 0x8F, 0x1A, 0xD3, 0xD6, 0x2F, 0x74, 0xC5, 0x2C, 0xF4, 0x93, 0x59,
+    0xB1, 0xB9, 0xA9, 0x0C, 0xE3, 0x51, 0x88, 0x8E, 0xDC, 0x02, 0xCF, 0x5D, 0x70, 0xE3, 0x0A, 0xF6,
+    0x2B, 0x0B, 0xD8, 0x6F, 0x17, 0xE8, 0x7E, 0x38, 0x81, 0x79, 0x3B, 0x43, 0xA3, 0x70, 0xAA, 0x01,
+    0x70, 0x71, 0x89, 0x71, 0x9B, 0xE5, 0x94, 0x20, 0x3D, 0x65, 0x33, 0xFC, 0x53, 0x0A, 0xA0, 0x0D,
+    0x50, 0x01, 0xFE, 0xF0, 0x88, 0x4D, 0x57, 0x02, 0xD0, 0xEF, 0x00, 0x71, 0x7D, 0x9C, 0x97, 0x1E,
+    0xD0, 0xF8, 0xDA, 0x63, 0x74, 0x6C, 0xE6, 0x47, 0x10, 0xFA, 0xA6, 0x76, 0xB0, 0x92, 0xC6, 0x46,
+    0x9F, 0xFF, 0x37, 0x65, 0x3B, 0xDB, 0x31, 0xE6, 0x0B, 0xAE, 0x11, 0x3F, 0x51, 0x58, 0xD9, 0x87,
+    0x6C, 0xE6, 0xB6, 0x5E, 0x60, 0xC7, 0xEE, 0xCD, 0x95, 0x6B, 0x0C, 0xF7, 0x66, 0x56, 0xE2, 0x90,
+    0xCD, 0xDC, 0xD4, 0x88, 0x1D, 0xFB, 0x59, 0x5C, 0x23, 0x36, 0x3B, 0x6B, 0xB7, 0xB4, 0xFA, 0xFC,
+    0x0F, 0x34, 0x36, 0xA7, 0x23, 0x24, 0x3D, 0xC2, 0x5F, 0x27, 0x91, 0xBF, 0x30, 0x92, 0xE1, 0x21,
+    0xD0, 0x49, 0xC0, 0x95, 0xB3, 0x17, 0xC0, 0x6B, 0x54, 0xF5, 0x1A, 0xB5, 0x76, 0x15, 0x37, 0xB2,
+    0xE3, 0x21, 0x86, 0x0A, 0xC3, 0x57, 0x0B, 0xF4, 0x3F, 0xCF, 0xD0, 0x3E, 0xD2, 0x4E, 0xA3, 0x11,
+    0xCC, 0xFD, 0x09, 0xEC, 0xDF, 0x2C, 0xE0, 0xDB, 0x0A, 0x15, 0xD1, 0x2E, 0xF8, 0xD1, 0x1D, 0x7B,
+    0xF4, 0x30, 0x56, 0xC9, 0x69, 0x8A, 0x1A, 0xE3, 0xD8, 0xEC, 0xD8, 0x09, 0x1F, 0xCC, 0x82, 0x9D,
+    0xD8, 0x30, 0x0B, 0x3E, 0xB0, 0xFD, 0x8A, 0xCC, 0xDB, 0x57, 0x8E, 0x7A, 0xD2, 0x9E, 0xA4, 0x23,
+    0x90, 0xF7, 0xF3, 0xE5, 0xE2, 0xF0, 0x32, 0x80, 0x05, 0x30, 0x19, 0xE0, 0x1F, 0x93, 0x8C, 0x1E,
+    0x6A, 0xB5, 0xFA, 0x66, 0xA2, 0x5B, 0xA8, 0xD8, 0x6C, 0x0A, 0x1E, 0x9B, 0xA9, 0xF8, 0xE3, 0xD4,
+    0xCD, 0xE6, 0x46, 0x7F, 0x97, 0x38, 0x30, 0xE1, 0x9D, 0x7F, 0x28, 0x97, 0xC9, 0xB0, 0xBF, 0x5C,
+    0xF8, 0x6E, 0x81, 0x56, 0x3B, 0xC7, 0x19, 0x5B, 0xAF, 0xAF, 0xEA, 0x81, 0x56, 0xBF, 0x5B, 0x4D,
+    0x31, 0x0C, 0x53, 0xB7, 0x50, 0xF1, 0xC7, 0x87, 0xFF, 0xE7, 0x8D, 0x60, 0x73, 0xB7, 0xF4, 0xD2,
+    0xA3, 0x19, 0x5E, 0x8A, 0x5C, 0xE3, 0x6E, 0xF5, 0xD7, 0x5A, 0xBA, 0xA5, 0xD9, 0x8E, 0xC2, 0xE9,
+    0x69, 0x02, 0xFF, 0x1B, 0x97, 0xE5, 0x14, 0x21, 0x24, 0x69, 0x3B, 0xC4, 0x6E, 0x97, 0xA7, 0x3B,
+    0x00, 0xDC, 0x7D, 0xC7, 0xE5, 0x38, 0xF5, 0xE4, 0x63, 0xC7, 0xE5, 0xA3, 0x49, 0x1A, 0x5B, 0x69,
+    0xA3, 0xFF, 0x71, 0x82, 0x6B, 0x4D, 0x85, 0xB5, 0x2B, 0xB4, 0xD3, 0x90, 0x69, 0x88, 0x4F, 0x07,
+    0x1A, 0xA9, 0xD0, 0xED, 0xA9, 0x30, 0x64, 0x3B, 0x13, 0x0F, 0x7B, 0xF4, 0x74, 0x85, 0xCA, 0x90,
+    0xBB, 0x99, 0x48, 0x62, 0x90, 0x16, 0x1E, 0xE5, 0x20, 0x49, 0xB9, 0x91, 0x6E, 0x6A, 0x26, 0x2A,
+    0xC7, 0x40, 0x23, 0x6C, 0x06, 0x37, 0x9A, 0x02, 0xFD, 0x4C, 0x85, 0x76, 0xC5, 0xFF, 0x49, 0xE0,
+    0x02, 0x2B, 0x05, 0x37, 0x1A, 0x69, 0xE9, 0x67, 0x2A, 0xA9, 0x5D, 0xF1, 0xD8, 0x7C, 0x81, 0xCD,
+    0xED, 0xE2, 0x46, 0x53, 0xB8, 0xDB, 0xCF, 0x54, 0x7C, 0xBB, 0xE2, 0x89, 0x63, 0x22, 0x49, 0xAF,
+    0x68, 0x4B, 0xDA, 0xC3, 0xA3, 0xEA, 0x61, 0x52, 0x26, 0x69, 0xA4, 0x3B, 0x8E, 0x63, 0x1F, 0xFF,
+    0xDF, 0x3A, 0xC3, 0x48, 0xB3, 0xD1, 0x9D, 0x4B, 0xBC, 0xF9, 0xFA, 0x09, 0x53, 0xBE, 0x7C, 0x60,
+    0xCF, 0x6E, 0x3D, 0x70, 0xE5, 0x7E, 0x7C, 0xE9, 0xE9, 0xC0, 0xA0, 0xA5, 0x95, 0x56, 0x3B, 0x0E,
+    0xCB, 0x47, 0xB0, 0xE5, 0x30, 0xF5, 0x03, 0x4A, 0x26, 0xAD, 0xAD, 0x34, 0xB7, 0x67, 0xF1, 0x84,
+    0x2C, 0xCB, 0x6D, 0x86, 0x7B, 0x99, 0xCD, 0x4F, 0xC3, 0x1C, 0x8F, 0x4A, 0xC7, 0x51, 0x5E, 0x06,
+    0xCE, 0xE8, 0xB5, 0x90, 0x44, 0x12, 0x51, 0x1B, 0x71, 0xB4, 0xF3, 0x50, 0xCC, 0xD2, 0xAE, 0xF8,
+    0xD1, 0x07, 0x4F, 0x5B, 0xCD, 0xD2, 0xCD, 0xD8, 0xEC, 0xC3, 0xEB, 0xB0, 0x99, 0x87, 0x77, 0x26,
+    0xEC, 0xE4, 0xB5, 0x3D, 0x71, 0x13, 0x76, 0xD8, 0xCC, 0xD2, 0x1F, 0x8F, 0x45, 0x9A, 0x6A, 0x16,
+    0xB3, 0xE2, 0x83, 0x0F, 0x6E, 0xB6, 0xC5, 0x69, 0x94, 0x6A, 0xAF, 0xB5, 0x3D, 0x54, 0xDF, 0x7C,
+    0xF1, 0xA8, 0xDB, 0xCE, 0x46, 0xDA, 0xD8, 0x9F, 0xDB, 0x70, 0xA3, 0xCD, 0x66, 0x39, 0x6D, 0xCF,
+    0x76, 0xA5, 0x32, 0xCC, 0x36, 0x13, 0x55, 0x41, 0xCA, 0xD8, 0x5C, 0x69, 0x57, 0x9B, 0xF1, 0x54,
+    0xEC, 0x64, 0xF3, 0x71, 0x1E, 0xD7, 0x68, 0x77, 0x93, 0xD3, 0x7C, 0x1D, 0xE0, 0x7A, 0x13, 0xEC,
+    0xE4, 0xC7, 0xF8, 0xCA, 0xDE, 0x6C, 0x66, 0x21, 0x34, 0x8F, 0xF1, 0xD3, 0x0B, 0x10, 0x15, 0xAC,
+    0x14, 0x76, 0xD4, 0xCD, 0x6C, 0x9E, 0x76, 0xAD, 0x74, 0x3F, 0x7A, 0xEB, 0xEC, 0xE6, 0x9D, 0xC3,
+    0x0E, 0xFE, 0x63, 0x3D, 0xEC, 0xFC, 0x52, 0x8D, 0x0A, 0x34, 0xFA, 0xD7, 0x1B, 0xCF, 0x1F, 0x18,
+    0x66, 0xE2, 0xE9, 0xEB, 0xFC, 0x27, 0xD5, 0xBD, 0x3F, 0x8C, 0x1F, 0xD7, 0x95, 0xE7, 0xFB, 0xA9,
+    0x7B, 0xD9, 0x5D, 0xB6, 0x6B, 0x66, 0x2F, 0x03, 0x72, 0xED, 0x11, 0xED, 0xA9, 0x09, 0x1C, 0x18,
+    0x1E, 0x8F, 0xEE, 0x04, 0x13, 0x38, 0x20, 0x79, 0xAF, 0x24, 0xEC, 0x3A, 0x98, 0xC0, 0x7C, 0x00,
+    0x5B, 0x06, 0x46, 0x81, 0x1C, 0x6C, 0xB0, 0xEB, 0xC1, 0x7B, 0xDC, 0xC0, 0x81, 0x03, 0x92, 0x55,
+    0x92, 0x16, 0x6F, 0x81, 0x37, 0xC0, 0x1B, 0x02, 0xCF, 0x9A, 0xE4, 0x05, 0xE3, 0x40, 0x03, 0xC8,
+    0x2D, 0xBC, 0xC7, 0x09, 0x14, 0x68, 0x1F, 0x9A, 0x5D, 0x57, 0x22, 0x1E, 0x14, 0x30, 0x70, 0xD9,
+    0x5A, 0xC3, 0xC1, 0x04, 0x2E, 0xFF, 0x11, 0x06, 0x90, 0x02, 0x5F, 0xCB, 0x25, 0xBB, 0x48, 0xDD,
+    0xAA, 0xB3, 0xC1, 0xAD, 0xDF, 0x8F, 0xDD, 0x24, 0x2D, 0x4B, 0xB6, 0x2C, 0x6B, 0x7F, 0xE8, 0xAE,
+    0xAA, 0x5F, 0xD5, 0xAF, 0xFB, 0x57, 0xF7, 0xDC, 0x3F, 0xE7, 0x9C, 0xEF, 0xF9, 0x9E, 0x53, 0x3B,
+    0x3A, 0xB9, 0x9B, 0xE9, 0x21, 0x0F, 0x60, 0xDA, 0xC9, 0x84, 0x74, 0xF7, 0xA7, 0x9F, 0x4D, 0x3F,
+    0xD7, 0xDF, 0x4D, 0xF6, 0x95, 0x01, 0x00, 0xE2, 0x83, 0x7F, 0xCF, 0x48, 0x8B, 0xC8, 0x58, 0xDE,
+    0xF9, 0xD7, 0x64, 0x5E, 0x1E, 0x92, 0x7D, 0x64, 0x78, 0xC9, 0x15, 0xFD, 0x57, 0xAF, 0x16, 0x3D,
+    0x37, 0xD6, 0xDF, 0xB9, 0xE8, 0xB9, 0xA1, 0x7A, 0x0E, 0x55, 0xA0, 0x51, 0x01, 0xF7, 0x74, 0xC0,
+    0xFD, 0x38, 0x7C, 0xCA, 0xC8, 0x9B, 0x49, 0x8B, 0x4C, 0x5C, 0x92, 0x16, 0x1D, 0xF8, 0xB5, 0xBF,
+    0x00, 0xEC, 0xDE, 0x86, 0x42, 0x04, 0xEA, 0x3B, 0x0B, 0xCC, 0x45, 0xA2, 0x1C, 0x54, 0xC4, 0x51,
+    0xB5, 0x24, 0x4E, 0x50, 0x0E, 0x80, 0x6D, 0x81, 0x1B, 0x80, 0x1E, 0x0B, 0x5F, 0x8A, 0x08, 0xB5,
+    0xC8, 0x04, 0x09, 0x28, 0x23, 0x50, 0x6F, 0x3F, 0x10, 0x01, 0x13, 0x80, 0x2B, 0xC0, 0x9F, 0xDF,
+    0xD9, 0xDF, 0xFF, 0xAE, 0x88, 0xC8, 0x63, 0x4B, 0x27, 0xA9, 0x6C, 0x39, 0xED, 0x4F, 0x01, 0xED,
+    0x58, 0x5C, 0x30, 0x4F, 0xBF, 0x2D, 0x73, 0x2A, 0x44, 0xA4, 0x2D, 0x52, 0x91, 0xA8, 0x82, 0x8A,
+    0x9C, 0x47, 0xF7, 0x4C, 0x98, 0x56, 0x0F, 0x9C, 0xC3, 0x84, 0x62, 0xC4, 0x7A, 0x13, 0xE8, 0x9E,
+    0x12, 0x2A, 0x11, 0xF1, 0xC9, 0x4E, 0xF6, 0x99, 0x00, 0x9F, 0x01, 0xE0, 0xF4, 0x9E, 0x2F, 0xF6,
+    0xBE, 0x24, 0x13, 0xCD, 0x6C, 0x67, 0x8A, 0xCE, 0xBB, 0x96, 0xAA, 0x57, 0x33, 0x4C, 0x98, 0x88,
+    0x85, 0xC6, 0xEB, 0x01, 0x95, 0x48, 0x60, 0xFA, 0xDA, 0x43, 0xA3, 0x23, 0xC8, 0xD8, 0x4C, 0x54,
+    0xF2, 0x1D, 0xF1, 0xD0, 0x45, 0x40, 0x2F, 0x40, 0x23, 0x12, 0xD1, 0x22, 0x0B, 0x50, 0x07, 0xA0,
+    0x48, 0x1C, 0x3F, 0xB4, 0x3D, 0xD0, 0x49, 0x04, 0x23, 0x02, 0x5A, 0xD6, 0xD7, 0x45, 0x60, 0xB7,
+    0x59, 0xDF, 0x0C, 0xEC, 0x3E, 0x47, 0x21, 0x09, 0xFB, 0x42, 0x52, 0xA3, 0x8E, 0xA6, 0x2D, 0xDB,
+    0x43, 0x4E, 0xE8, 0x04, 0x75, 0x82, 0xFF, 0xB6, 0xA0, 0x7E, 0x2C, 0xBE, 0x7A, 0x59, 0x42, 0x4D,
+    0x13, 0x1C, 0x36, 0x34, 0xD4, 0x6D, 0xD7, 0x5A, 0xBA, 0xFE, 0x2C, 0xCD, 0x30, 0x62, 0x7F, 0xD1,
+    0x63, 0x7E, 0x06, 0x55, 0xFA, 0x14, 0x66, 0x98, 0x70, 0x65, 0x2C, 0x26, 0x33, 0xD6, 0x6D, 0x2D,
+    0x13, 0xD5, 0x02, 0x3B, 0x9C, 0x6A, 0xFC, 0xDC, 0x3D, 0xB5, 0x34, 0x7E, 0x3E, 0xC1, 0xC9, 0xB5,
+    0x27, 0xA9, 0xE5, 0xA7, 0x40, 0xF7, 0x46, 0xD7, 0xC3, 0x02, 0x87, 0x90, 0x40, 0x0F, 0x4C, 0xC0,
+    0x79, 0x2E, 0xD3, 0x8C, 0x3A, 0x9C, 0x43, 0x16, 0x5E, 0xAA, 0x99, 0x74, 0x6B, 0x2A, 0x7F, 0x99,
+    0x41, 0xBD, 0x16, 0x1E, 0xE6, 0x24, 0xDF, 0x88, 0xC6, 0xC3, 0x9F, 0x9E, 0xD5, 0x3D, 0x94, 0xDF,
+    0x61, 0x84, 0xE2, 0x27, 0xE1, 0x3C, 0xF0, 0x8D, 0x17, 0xAB, 0x00, 0x7F, 0xF1, 0xA7, 0xC5, 0x8C,
+    0x37, 0x3A, 0x58, 0x89, 0x65, 0x78, 0xA9, 0x90, 0x51, 0xF7, 0xC6, 0x83, 0x8A, 0x8C, 0xA0, 0x22,
+    0x75, 0x4B, 0x19, 0x41, 0x9E, 0xBD, 0x34, 0x40, 0x29, 0xD2, 0x02, 0x3B, 0xFF, 0x94, 0xEF, 0xCB,
+    0x4E, 0xFA, 0x97, 0x63, 0xAD, 0x87, 0xCF, 0x99, 0xB6, 0xB8, 0x5A, 0xC8, 0x54, 0xFF, 0x5F, 0x43,
+    0x32, 0xCF, 0x44, 0x57, 0x8A, 0xBC, 0x3A, 0xBE, 0x04, 0xC0, 0x5F, 0x8B, 0x38, 0x19, 0x3B, 0x91,
+    0xB7, 0x44, 0xE4, 0xE5, 0xBD, 0xBD, 0x4B, 0xC0, 0x65, 0x28, 0x22, 0x94, 0x01, 0x6A, 0x80, 0x46,
+    0x7E, 0x2C, 0xF2, 0xAA, 0x2C, 0x50, 0xEC, 0x01, 0x9D, 0xB4, 0x98, 0x6B, 0x55, 0xCF, 0x88, 0x0E,
+    0xD5, 0xEE, 0xF3, 0x3A, 0x7C, 0xC3, 0xDE, 0x28, 0x1F, 0x0D, 0x5F, 0xFC, 0x86, 0x31, 0xFC, 0x68,
+    0xF8, 0xC2, 0x59, 0xFD, 0x33, 0xFE, 0x79, 0x30, 0x51, 0xDD, 0x0C, 0x5F, 0x8C, 0x55, 0xC5, 0x8F,
+    0xE2, 0xD9, 0xCF, 0x98, 0x1F, 0xFD, 0x7C, 0x38, 0x7B, 0xFA, 0x91, 0x2F, 0x73, 0x16, 0x5E, 0xE4,
+    0x0A, 0xB5, 0xC7, 0xCA, 0x08, 0xBB, 0xCF, 0xC3, 0x43, 0xFB, 0xCF, 0x39, 0x99, 0x9D, 0x24, 0xA0,
+    0x38, 0xF4, 0x46, 0x06, 0xF7, 0xA5, 0xF1, 0x32, 0xE9, 0x80, 0xCB, 0x07, 0x5C, 0x3E, 0xE0, 0xE0,
+    0x2A, 0x93, 0x7B, 0x33, 0x56, 0x12, 0xF8, 0x0F, 0xB9, 0x5D, 0xE7, 0x81, 0x09, 0xF4, 0x00, 0xA6,
+    0x85, 0xF3, 0x14, 0x7B, 0xB7, 0xF7, 0xAC, 0x48, 0xEA, 0x44, 0xE2, 0xFD, 0x57, 0x61, 0xDC, 0xF4,
+    0x14, 0x7B, 0x7B, 0x7B, 0x7F, 0x2D, 0x22, 0x56, 0x24, 0x01, 0x4A, 0x5A, 0x2B, 0x43, 0x53, 0xC6,
+    0x03, 0x35, 0x5E, 0x56, 0x23, 0x3A, 0x52, 0x0E, 0xD4, 0x81, 0x86, 0x22, 0x51, 0x0E, 0xD8, 0x96,
+    0x4E, 0x52, 0x27, 0xE9, 0xF3, 0xFB, 0xCF, 0x01, 0x76, 0xD6, 0x32, 0xDB, 0x47, 0xA6, 0xAF, 0xEB,
+    0x48, 0xED, 0x8B, 0x54, 0x74, 0xA1, 0x92, 0x70, 0xFA, 0x52, 0xC0, 0xC2, 0x01, 0x3A, 0x16, 0xDD,
+    0x5F, 0xCB, 0x58, 0x2F, 0x00, 0xB4, 0x26, 0x74, 0x7A, 0x72, 0x4F, 0x4F, 0x95, 0x5F, 0xBF, 0xBC,
+    0xEA, 0xB1, 0x5E, 0x8F, 0x98, 0x9E, 0x19, 0x3D, 0xE2, 0x60, 0xC6, 0x04, 0x9C, 0xD7, 0x11, 0xD3,
+    0x93, 0x1E, 0x7C, 0xB2, 0x1C, 0x71, 0x5E, 0xCD, 0x98, 0x01, 0x69, 0xF5, 0x4C, 0x13, 0x91, 0xA1,
+    0x6B, 0x4E, 0x38, 0x11, 0x23, 0xF5, 0x25, 0x51, 0xF2, 0xA5, 0xE1, 0x22, 0xA7, 0x8B, 0x09, 0xA0,
+    0xD9, 0x4E, 0x9D, 0x32, 0x6E, 0xE7, 0x4F, 0x07, 0x70, 0x7A, 0x5D, 0x77, 0x44, 0x5A, 0x27, 0xD2,
+    0x37, 0xD2, 0x79, 0x27, 0xB7, 0x5A, 0x2B, 0x6F, 0x0D, 0x46, 0xD2, 0x4B, 0x5A, 0xE4, 0xE1, 0x42,
+    0xE4, 0x56, 0xDB, 0x1C, 0x39, 0x41, 0x23, 0xB7, 0xDA, 0x4A, 0xDE, 0x1A, 0xE8, 0xD2, 0x4B, 0xEC,
+    0xFE, 0xF0, 0x61, 0x28, 0x6F, 0xB5, 0x14, 0x6F, 0x0D, 0x70, 0xF9, 0x25, 0xA8, 0x1F, 0x7C, 0xC2,
+    0x53, 0xBC, 0x15, 0xE0, 0x32, 0x79, 0x04, 0x29, 0xA0, 0xFE, 0xA1, 0x2C, 0x0D, 0x9C, 0x28, 0x53,
+    0x13, 0x5D, 0x39, 0xA4, 0x46, 0x79, 0x60, 0x37, 0x9C, 0x99, 0xB5, 0x84, 0x9D, 0x44, 0x15, 0x38,
+    0xB8, 0x77, 0x63, 0xFA, 0x5A, 0xDE, 0x92, 0x05, 0x28, 0xA5, 0xAD, 0x7F, 0x16, 0xCF, 0xAB, 0xE9,
+    0x80, 0x94, 0x48, 0x13, 0x07, 0x89, 0x94, 0x98, 0x1A, 0x15, 0xAD, 0xF4, 0x65, 0x16, 0x38, 0x27,
+    0xAD, 0x44, 0x27, 0x3D, 0x00, 0x1F, 0x03, 0x3E, 0x95, 0xBF, 0x7F, 0x77, 0xCE, 0x63, 0xC6, 0x25,
+    0xE0, 0x00, 0x1E, 0x4A, 0xEB, 0x90, 0x38, 0x00, 0x15, 0xF3, 0x5E, 0xF7, 0x79, 0x5F, 0xB5, 0x79,
+    0x6F, 0xC8, 0xFB, 0x87, 0x29, 0xAE, 0x71, 0x00, 0x97, 0x31, 0x3D, 0x07, 0x30, 0x62, 0x7B, 0x0E,
+    0x28, 0x22, 0x4D, 0xCF, 0x01, 0x3A, 0xF0, 0x4E, 0x7F, 0x46, 0x86, 0xAA, 0xD5, 0xBF, 0xE8, 0x9D,
+    0x44, 0x43, 0x75, 0xB3, 0x07, 0x1E, 0xA6, 0x7E, 0xAC, 0x07, 0x2E, 0x73, 0x5E, 0xF7, 0xC0, 0x44,
+    0x2A, 0x7B, 0x28, 0x22, 0x22, 0x02, 0xBA, 0xA7, 0x13, 0x81, 0x2A, 0xE4, 0x6F, 0x36, 0x3E, 0xEF,
+    0x1D, 0x79, 0x7F, 0x19, 0x28, 0x7C, 0x6E, 0xC0, 0x3D, 0xAF, 0x53, 0x6B, 0xBB, 0xCE, 0xAF, 0xED,
+    0x3A, 0x58, 0xDB, 0x35, 0xE6, 0x76, 0xFD, 0xBA, 0xF6, 0xD4, 0x6B, 0x7B, 0xCE, 0xAF, 0xFB, 0xCB,
+    0x5C, 0x6A, 0x39, 0x80, 0xB1, 0x94, 0x91, 0x03, 0x8A, 0x58, 0xFF, 0x20, 0x71, 0x80, 0x0E, 0x8E,
+    0xC4, 0x01, 0x55, 0x7B, 0x9E, 0x74, 0x46, 0x06, 0xC3, 0x0E, 0xC9, 0x49, 0x7C, 0x18, 0x8A, 0x31,
+    0x2F, 0x0D, 0x3A, 0xE6, 0x6F, 0x33, 0x21, 0x2F, 0x13, 0x4D, 0xBE, 0xE7, 0x22, 0x01, 0x55, 0xA0,
+    0x1A, 0x00, 0xE3, 0xB1, 0xDF, 0xDF, 0xCB, 0x42, 0x17, 0x81, 0xCB, 0x60, 0x65, 0x86, 0x69, 0x6D,
+    0xC4, 0x5F, 0xDE, 0xDF, 0xAE, 0x8F, 0x41, 0x71, 0xD8, 0x42, 0x19, 0x50, 0x92, 0x97, 0x4F, 0x75,
+    0xDB, 0xB6, 0xA8, 0x08, 0xDF, 0xD0, 0x11, 0x46, 0x38, 0xC1, 0x04, 0x07, 0x00, 0x09, 0xCE, 0x01,
+    0xBB, 0x09, 0x1E, 0x06, 0x2A, 0x69, 0x31, 0x40, 0xF1, 0xC2, 0x44, 0xD5, 0xF2, 0x1F, 0xC1, 0x51,
+    0x06, 0x0E, 0xA1, 0x0A, 0xBA, 0xA7, 0x69, 0xD1, 0xB1, 0x88, 0xB8, 0x81, 0x72, 0x24, 0xE2, 0xA6,
+    0xDD, 0x6E, 0xE2, 0x25, 0xEC, 0x79, 0x25, 0x23, 0x67, 0xA9, 0xBF, 0xDC, 0x9E, 0xF6, 0x3C, 0x8C,
+    0x79, 0x66, 0x00, 0x6A, 0x4C, 0x98, 0x00, 0xD3, 0x56, 0xBD, 0x03, 0xCA, 0xA0, 0x45, 0x66, 0xD0,
+    0x3D, 0x8D, 0xC8, 0x2A, 0xE2, 0x69, 0x1D, 0x42, 0xE7, 0xF3, 0xCD, 0x60, 0xDA, 0xB5, 0xD7, 0x2E,
+    0xC0, 0xEE, 0x3D, 0x4D, 0x2B, 0x3C, 0x3A, 0x81, 0x80, 0x0B, 0xEC, 0x5E, 0xDB, 0x9E, 0xF7, 0x14,
+    0x11, 0xCE, 0x42, 0xED, 0xE9, 0x06, 0x25, 0x93, 0x96, 0xA4, 0xE4, 0x1A, 0x33, 0x9C, 0x03, 0xE3,
+    0xD1, 0x43, 0x1E, 0x8B, 0x3D, 0x4A, 0xFE, 0xEF, 0x60, 0x25, 0x2A, 0x49, 0x54, 0x13, 0x30, 0x6B,
+    0x0F, 0xC8, 0x77, 0x23, 0xD0, 0x48, 0x02, 0x6A, 0xB3, 0x00, 0xAA, 0x3D, 0xE4, 0xC1, 0xAF, 0x22,
+    0x02, 0x14, 0x79, 0xA6, 0x48, 0x00, 0x68, 0x46, 0x00, 0x7B, 0x08, 0x60, 0xFE, 0x31, 0x00, 0xD5,
+    0xCD, 0x11, 0xD0, 0x43, 0x07, 0x14, 0x63, 0x1D, 0x80, 0xA4, 0xB3, 0x16, 0xEB, 0x00, 0x8B, 0xE9,
+    0xC1, 0x04, 0x3D, 0x41, 0x79, 0x67, 0x7F, 0xD5, 0xC4, 0x3D, 0xC5, 0xB2, 0xFF, 0xC2, 0x04, 0x37,
+    0xA0, 0x03, 0x07, 0xA6, 0xC7, 0x7A, 0x74, 0xC2, 0x04, 0x68, 0x28, 0x23, 0xD4, 0x43, 0x2D, 0x3D,
+    0x9D, 0x7C, 0x47, 0x46, 0x1A, 0x89, 0x79, 0x78, 0x43, 0xB5, 0x00, 0x54, 0x6F, 0xF6, 0x80, 0x0E,
+    0x07, 0x40, 0x11, 0x6B, 0x80, 0x73, 0x55, 0x00, 0xCC, 0x9B, 0x3D, 0x80, 0x0C, 0x00, 0x3B, 0xFE,
+    0x48, 0x73, 0xEA, 0xBC, 0x1D, 0x00, 0x4C, 0x02, 0x28, 0xC5, 0x03, 0xEA, 0x9D, 0x01, 0xE0, 0x76,
+    0x02, 0x38, 0x70, 0x1E, 0x38, 0x5F, 0x45, 0xA0, 0x7E, 0x24, 0x01, 0x26, 0xB8, 0x16, 0xF4, 0x50,
+    0x45, 0x50, 0x91, 0x19, 0x48, 0xB8, 0x16, 0x9A, 0xFD, 0xEB, 0x11, 0x9C, 0xC8, 0x0C, 0xF5, 0x1B,
+    0xFB, 0x5D, 0x4B, 0xD5, 0x53, 0x45, 0x74, 0x84, 0x19, 0x35, 0x82, 0x0B, 0x24, 0x28, 0x23, 0x0D,
+    0x14, 0x4B, 0x21, 0x33, 0x95, 0x24, 0x11, 0x5F, 0x8A, 0x00, 0x88, 0x88, 0xF4, 0xAB, 0x69, 0xD2,
+    0x42, 0x21, 0x77, 0xF6, 0x17, 0xA0, 0xFA, 0x59, 0x60, 0x02, 0xAE, 0x74, 0xA8, 0x01, 0xF4, 0x5B,
+    0x89, 0xD2, 0x43, 0x5D, 0x45, 0x00, 0x26, 0x1B, 0x00, 0xAA, 0xD0, 0x65, 0xC5, 0xA6, 0x12, 0x80,
+    0x8A, 0x95, 0xC8, 0x00, 0xB5, 0xB7, 0x22, 0x2D, 0x24, 0xBA, 0xFD, 0xE7, 0xA1, 0xBC, 0xF3, 0x42,
+    0x02, 0x70, 0x22, 0x11, 0x50, 0x77, 0xF6, 0xBB, 0x90, 0x87, 0x5E, 0x07, 0x27, 0x49, 0xA8, 0x84,
+    0xEA, 0xCB, 0x81, 0x2A, 0x62, 0xBC, 0x03, 0x1B, 0xB8, 0xA2, 0x26, 0x90, 0xC7, 0x5F, 0x88, 0x9D,
+    0xF8, 0x46, 0x44, 0x6E, 0xCA, 0xAC, 0x24, 0x9B, 0x5A, 0x27, 0x80, 0x33, 0x22, 0x8B, 0xC7, 0x8A,
+    0xC8, 0xC8, 0x8E, 0xEC, 0x5C, 0x5F, 0xA0, 0x43, 0x49, 0x4B, 0x07, 0xAE, 0xA7, 0x03, 0x13, 0xE9,
+    0xA0, 0x1A, 0xE9, 0x40, 0x4F, 0x74, 0xA0, 0x13, 0x1D, 0xA8, 0x74, 0x5A, 0xF6, 0xBC, 0x4A, 0x4E,
+    0xA4, 0x57, 0xE9, 0xF3, 0xB2, 0xDF, 0xAA, 0xF5, 0xFC, 0x91, 0x4F, 0x8E, 0x74, 0x50, 0x45, 0x3A,
+    0x30, 0x03, 0x1D, 0xB8, 0x40, 0x47, 0x21, 0xD0, 0xED, 0x5D, 0x4A, 0xD4, 0x22, 0xD2, 0x63, 0x45,
+    0x6E, 0xDF, 0xED, 0xD8, 0x59, 0x7B, 0xD0, 0xF2, 0x5F, 0x03, 0x94, 0x22, 0x01, 0xCA, 0x9B, 0xD2,
+    0x3E, 0x70, 0x60, 0xEF, 0x5C, 0x00, 0x94, 0xC8, 0x35, 0xA8, 0x45, 0x12, 0x74, 0x3F, 0x3D, 0x23,
+    0xA8, 0x05, 0x24, 0x94, 0x13, 0xB8, 0xC1, 0x44, 0x30, 0xB1, 0xEE, 0xA1, 0x1A, 0x5D, 0x80, 0x72,
+    0x72, 0x2D, 0xE8, 0xE4, 0x3C, 0xE8, 0xD4, 0x78, 0x50, 0xF7, 0x6D, 0x75, 0x6A, 0x5A, 0xD0, 0x93,
+    0x0B, 0xA0, 0x47, 0xD7, 0x43, 0x15, 0xEB, 0x08, 0x66, 0x30, 0x23, 0xD8, 0x50, 0xCE, 0xD0, 0x79,
+    0x95, 0x95, 0x4E, 0x23, 0x32, 0x42, 0x95, 0xAD, 0xAE, 0xBF, 0xB9, 0x06, 0x27, 0x40, 0x0D, 0x9C,
+    0xAD, 0x5B, 0x13, 0x0E, 0x75, 0x54, 0x53, 0xA2, 0x12, 0xB0, 0x01, 0xBD, 0xC0, 0x32, 0xE2, 0xAA,
+    0xDE, 0xF4, 0xF6, 0xB1, 0x91, 0x1B, 0x7F, 0x8C, 0x6A, 0xF3, 0xC4, 0xBC, 0x08, 0x60, 0x65, 0x2E,
+    0x7A, 0x1A, 0x91, 0x9F, 0x8F, 0x74, 0x3F, 0x3D, 0x23, 0x23, 0x5D, 0x8B, 0x1B, 0x69, 0x5A, 0xF4,
+    0x82, 0x0B, 0x28, 0x09, 0x75, 0x8F, 0x92, 0xD1, 0x44, 0xD4, 0xDB, 0x8B, 0x9E, 0x50, 0xA3, 0x0B,
+    0x33, 0x6A, 0x34, 0xB1, 0xF1, 0x6A, 0xD4, 0xA9, 0xEE, 0xD5, 0x48, 0x57, 0x8E, 0x6A, 0xC4, 0xBE,
+    0xBC, 0xA8, 0x11, 0x13, 0x9B, 0xA7, 0x47, 0xF4, 0x64, 0xDE, 0x1A, 0x61, 0xD6, 0xCB, 0x08, 0x1D,
+    0xCD, 0x08, 0xAE, 0x35, 0x13, 0xD8, 0xA0, 0xC4, 0x63, 0x7B, 0x25, 0x33, 0xCD, 0xA0, 0xDE, 0x16,
+    0x91, 0x9E, 0xB1, 0x12, 0x69, 0x39, 0xC1, 0xBF, 0x7D, 0x2E, 0x0B, 0xF9, 0x04, 0x00, 0x2F, 0x02,
+    0xD4, 0x31, 0x5B, 0x4C, 0x80, 0x9B, 0x00, 0x7D, 0x1B, 0x60, 0xE7, 0x78, 0xA7, 0x28, 0x91, 0xE0,
+    0xE4, 0x96, 0x2C, 0x88, 0xEC, 0x8A, 0xC7, 0xF6, 0xC5, 0x0C, 0x09, 0x9D, 0x28, 0x07, 0xCA, 0x11,
+    0x07, 0x55, 0x2C, 0x46, 0x30, 0x83, 0x09, 0x60, 0xC3, 0x15, 0xC0, 0x3D, 0x13, 0x81, 0xC6, 0x02,
+    0x1C, 0x4E, 0xDB, 0x15, 0x4A, 0xCD, 0x6C, 0xEC, 0x98, 0x6C, 0xD2, 0x64, 0xEB, 0x26, 0xDB, 0x34,
+    0xC7, 0x4E, 0x5F, 0xD8, 0xAC, 0x83, 0x5A, 0x24, 0xD2, 0xC8, 0x40, 0x29, 0xB7, 0x61, 0x77, 0x5A,
+    0x7D, 0x28, 0x35, 0xFF, 0x13, 0x58, 0x91, 0x56, 0x49, 0x27, 0xDE, 0xB6, 0x65, 0x52, 0x13, 0xF5,
+    0x60, 0x5B, 0x3A, 0x35, 0x51, 0x46, 0xDB, 0xD2, 0xA8, 0x89, 0x2A, 0xDA, 0x96, 0x45, 0x4D, 0xD8,
+    0x60, 0xDB, 0x6A, 0x54, 0xCB, 0xF5, 0x19, 0x2B, 0x0B, 0x6A, 0xBE, 0xB8, 0xFE, 0x9F, 0x09, 0x94,
+    0x2C, 0xAB, 0x33, 0x02, 0x0F, 0x3D, 0x07, 0x34, 0xD2, 0x43, 0xF7, 0xB3, 0x19, 0x1A, 0x5C, 0xC0,
+    0x51, 0x46, 0xEA, 0x96, 0x84, 0xE9, 0x71, 0xE8, 0x48, 0x1D, 0x48, 0xD4, 0x01, 0x47, 0xDD, 0x62,
+    0x82, 0x69, 0xD1, 0xD1, 0x04, 0x48, 0x3A, 0x82, 0x63, 0x06, 0x13, 0xDC, 0x80, 0x8E, 0xE5, 0x02,
+    0x89, 0x26, 0xE2, 0xD0, 0x82, 0x09, 0xB8, 0x41, 0x47, 0x74, 0x22, 0x81, 0xC3, 0xED, 0x60, 0x82,
+    0xB9, 0x19, 0x74, 0x2C, 0x63, 0x52, 0x63, 0x9D, 0xDC, 0x3B, 0x93, 0x11, 0x2D, 0x23, 0x70, 0xDA,
+    0xC3, 0x49, 0xC0, 0xF5, 0x5F, 0xA7, 0x92, 0x2F, 0xB7, 0xCC, 0xDD, 0x44, 0xF5, 0xA8, 0xC0, 0xC9,
+    0xDD, 0xF6, 0x9E, 0x49, 0x53, 0xC9, 0x40, 0x29, 0x12, 0x8A, 0x59, 0x25, 0x5C, 0x6B, 0x7A, 0x35,
+    0x72, 0xC8, 0x4E, 0x56, 0xDD, 0x87, 0x50, 0x3C, 0x39, 0x70, 0x46, 0x16, 0x8C, 0xFC, 0x6C, 0xD0,
+    0x33, 0x87, 0x38, 0xAA, 0xA1, 0x8C, 0x1C, 0xD2, 0x60, 0x06, 0x3D, 0x97, 0xF2, 0x4D, 0x2B, 0xBF,
+    0x92, 0xD0, 0xCD, 0x75, 0xE4, 0xE2, 0xC6, 0x0D, 0x52, 0x02, 0x48, 0x82, 0xBA, 0xEC, 0x51, 0xC3,
+    0x79, 0x78, 0x58, 0x0F, 0x14, 0xE3, 0x39, 0x30, 0xD2, 0x82, 0x1B, 0x7E, 0xAF, 0xB7, 0xB0, 0x73,
+    0x81, 0xD3, 0x60, 0xE5, 0x11, 0x49, 0x34, 0xF2, 0x73, 0x91, 0xD0, 0xF8, 0x6E, 0x2A, 0x27, 0xD7,
+    0x9A, 0x44, 0x53, 0xF5, 0x6A, 0xC6, 0xF4, 0x17, 0xE8, 0xD0, 0x23, 0xD8, 0xFF, 0xFF, 0x85, 0x99,
+    0xDD, 0x4E, 0x44, 0x7C, 0x23, 0xF2, 0xC6, 0x45, 0xE4, 0xF5, 0x43, 0x40, 0xB0, 0x2D, 0xB9, 0xFF,
+    0xA8, 0x03, 0x73, 0x5E, 0xEE, 0x7B, 0x90, 0x47, 0x44, 0xF6, 0x0E, 0xAC, 0xCC, 0x8D, 0x88, 0x92,
+    0x49, 0xCB, 0xC2, 0xCE, 0x05, 0x76, 0x2E, 0xE6, 0x06, 0xE9, 0xF0, 0x30, 0x34, 0x7F, 0xDF, 0x67,
+    0x45, 0xA5, 0x13, 0x14, 0x12, 0xE1, 0x86, 0x6D, 0x29, 0x39, 0x3C, 0xE2, 0x9B, 0xDB, 0xF9, 0x06,
+    0xB5, 0xBC, 0x13, 0xCB, 0xDB, 0x4F, 0x08, 0x33, 0x66, 0xB4, 0x2D, 0xEE, 0x99, 0x88, 0x4A, 0x0D,
+    0xD4, 0xB7, 0x22, 0xA4, 0x0E, 0xCC, 0xF6, 0xE0, 0xD5, 0x91, 0x62, 0x72, 0x2D, 0x4E, 0xCF, 0x94,
+    0xD1, 0x4C, 0x2A, 0xD1, 0x88, 0x78, 0x44, 0x5A, 0xF8, 0x4F, 0x3E, 0xCF, 0xCE, 0x6A, 0xFA, 0x37,
+    0x20, 0x3F, 0x8E, 0xD4, 0x97, 0x84, 0x62, 0x68, 0x7A, 0x76, 0x78, 0xEE, 0xA8, 0xE2, 0xBF, 0x08,
+    0x4A, 0x66, 0x0A, 0x91, 0x44, 0xE7, 0x9B, 0xC1, 0x04, 0xE4, 0xD1, 0x09, 0x3D, 0x39, 0xB0, 0xAF,
+    0x46, 0x8A, 0xD4, 0xDD, 0xF3, 0xED, 0x45, 0x6A, 0x3C, 0xF5, 0xCD, 0x29, 0x2F, 0x80, 0x0D, 0xD2,
+    0xDA, 0xBE, 0x14, 0x19, 0x31, 0x32, 0xC1, 0xEE, 0x37, 0x81, 0x5D, 0x0F, 0x5D, 0x9E, 0xA1, 0x65,
+    0x84, 0x22, 0x7F, 0xD5, 0xDE, 0xDE, 0x5D, 0x37, 0x6C, 0xF3, 0xF5, 0xD7, 0xC0, 0x06, 0xE8, 0xFC,
+    0x3A, 0x6F, 0x81, 0x3D, 0xC0, 0xCA, 0x77, 0xFB, 0x52, 0x44, 0x7C, 0xE7, 0x9B, 0x51, 0x47, 0x5C,
+    0x6F, 0xBD, 0x92, 0x36, 0x61, 0xA5, 0x8C, 0xEA, 0xED, 0x64, 0x5B, 0xFB, 0xD8, 0x78, 0xA8, 0x46,
+    0xF3, 0xCA, 0x64, 0xBD, 0xAB, 0xDE, 0x1A, 0x49, 0xF5, 0xCF, 0x7C, 0x19, 0xDD, 0x88, 0xF5, 0xE2,
+    0x8B, 0xA4, 0xC4, 0xD7, 0xBD, 0x15, 0x99, 0x19, 0x45, 0x5A, 0x78, 0xE8, 0x02, 0x40, 0xD1, 0x6E,
+    0xE5, 0x1D, 0x37, 0xC0, 0x81, 0xF3, 0xC0, 0xBC, 0xC1, 0x7C, 0x8E, 0xBF, 0x1A, 0x69, 0xBB, 0xA5,
+    0x91, 0xB6, 0x9B, 0xAB, 0x91, 0x32, 0xEA, 0x91, 0xAA, 0xD7, 0x13, 0x26, 0x14, 0x89, 0xBA, 0x65,
+    0xC6, 0x41, 0xC3, 0x55, 0x70, 0x1C, 0x80, 0x6D, 0x27, 0x30, 0x2F, 0x8F, 0x60, 0x5E, 0x8B, 0x50,
+    0xFE, 0xA4, 0x07, 0xFD, 0x4E, 0x80, 0x42, 0x3C, 0x20, 0xE4, 0xD1, 0x9B, 0x4D, 0xC2, 0x62, 0xDA,
+    0xDC, 0x4A, 0x3D, 0x40, 0x21, 0x01, 0x3A, 0x01, 0xBA, 0x04, 0x3C, 0x74, 0x0D, 0xE0, 0x22, 0x60,
+    0x13, 0xD0, 0xA4, 0xD5, 0x9A, 0xCD, 0x42, 0xBA, 0x6F, 0x53, 0x5C, 0xA0, 0x48, 0x4E, 0x28, 0x66,
+    0x91, 0x50, 0xC8, 0xED, 0x2E, 0x16, 0xE2, 0xCD, 0x58, 0x24, 0xF4, 0x54, 0x24, 0x54, 0x2A, 0x12,
+    0xC5, 0x03, 0x36, 0x2A, 0x6D, 0x3E, 0xA2, 0x63, 0x91, 0x30, 0x43, 0xB1, 0xFC, 0x2F, 0x5D, 0x28,
+    0x44, 0x84, 0x42, 0x64, 0xFC, 0x35, 0xDF, 0x06, 0x94, 0xF2, 0x2D, 0x70, 0x32, 0xC2, 0xE9, 0xBD,
+    0x0B, 0xC0, 0x29, 0x2E, 0x80, 0xE8, 0xB4, 0x6E, 0x16, 0x9D, 0xD6, 0x73, 0x1F, 0x25, 0x71, 0x16,
+    0x7B, 0x7B, 0x1E, 0xC8, 0xA3, 0x2F, 0x9B, 0xC5, 0x3B, 0x7B, 0x17, 0x7F, 0x8D, 0x41, 0x5C, 0x06,
+    0x80, 0x72, 0x02, 0xD0, 0x02, 0x50, 0x64, 0xD7, 0x31, 0x2B, 0xA0, 0xF3, 0x0D, 0x80, 0x35, 0x3D,
+    0x60, 0x9E, 0x4E, 0x40, 0xD9, 0x37, 0x80, 0x8E, 0x66, 0x00, 0x26, 0x95, 0x9D, 0x49, 0xE7, 0xC1,
+    0x61, 0x06, 0xA8, 0xDF, 0x78, 0x21, 0x81, 0x11, 0x11, 0x4F, 0x79, 0x67, 0xFF, 0xFA, 0x80, 0x1A,
+    0x51, 0x09, 0x12, 0x38, 0xCF, 0x0D, 0x30, 0x11, 0x07, 0x45, 0xA2, 0x0E, 0xD0, 0xB4, 0x8D, 0x78,
+    0x25, 0xE2, 0xA4, 0x2F, 0x44, 0x82, 0xDA, 0xFF, 0xB6, 0xA7, 0x93, 0x09, 0x23, 0xE2, 0x1F, 0x60,
+    0xE8, 0xFC, 0x7E, 0xD6, 0x6C, 0xE0, 0x1A, 0x7F, 0x09, 0x5C, 0xE1, 0x2C, 0x50, 0xBF, 0xDE, 0x64,
+    0x15, 0x0E, 0xB0, 0xA2, 0x18, 0x27, 0xEF, 0x97, 0xDC, 0xE5, 0xDC, 0xD5, 0x2D, 0x80, 0xCB, 0x5A,
+    0x78, 0x06, 0xA8, 0x7E, 0xD6, 0x02, 0xFA, 0x5F, 0x23, 0xA0, 0xE2, 0x7C, 0xD7, 0xBE, 0xBD, 0x52,
+    0x46, 0xC0, 0xB1, 0x00, 0xA6, 0xB5, 0x01, 0xAA, 0xA0, 0x47, 0xD0, 0x91, 0x05, 0x8A, 0x65, 0xBF,
+    0x0B, 0x20, 0x22, 0x23, 0x34, 0xFB, 0xFB, 0x0B, 0x58, 0x8F, 0x0D, 0x98, 0x80, 0x1E, 0xA9, 0x7A,
+    0x10, 0x74, 0x84, 0x3A, 0x14, 0x09, 0xCA, 0xA9, 0x94, 0x11, 0x2B, 0xBF, 0x90, 0x99, 0x5A, 0xF2,
+    0x92, 0xF2, 0x75, 0x3E, 0x87, 0xE9, 0xAB, 0x96, 0xE6, 0xCD, 0x88, 0x92, 0x19, 0x76, 0x97, 0x0F,
+    0x4D, 0x82, 0x1F, 0x3D, 0x79, 0xD4, 0xED, 0xDD, 0xAD, 0x09, 0x6C, 0xE6, 0x0D, 0xC8, 0x37, 0xB3,
+    0xAD, 0xB9, 0x71, 0x05, 0x3F, 0x50, 0xB9, 0xA4, 0x3A, 0x72, 0x71, 0xC5, 0x3C, 0x33, 0xB4, 0x41,
+    0x02, 0xAA, 0xB7, 0xFD, 0x0A, 0x51, 0x74, 0xDB, 0x81, 0xFD, 0xD2, 0xBA, 0x3E, 0x17, 0x12, 0xB2,
+    0x31, 0xA9, 0x66, 0x36, 0x4A, 0x64, 0xF3, 0xDA, 0x95, 0xC5, 0x17, 0x22, 0x0B, 0xF5, 0xED, 0x27,
+    0x52, 0xB1, 0xA0, 0xA3, 0xE9, 0x31, 0x61, 0x81, 0xF3, 0x65, 0x84, 0x17, 0x6D, 0x00, 0x16, 0x40,
+    0x8F, 0x40, 0xDD, 0xAF, 0xD6, 0x61, 0x5E, 0xBD, 0xB6, 0xA7, 0x5C, 0xBB, 0x2E, 0x24, 0x6A, 0xD9,
+    0xC0, 0xCD, 0x95, 0x78, 0x4E, 0x55, 0x72, 0xE7, 0xFA, 0x50, 0x89, 0x08, 0x4A, 0x64, 0x80, 0xD3,
+    0x17, 0x80, 0x8F, 0x67, 0xF4, 0x5C, 0x4F, 0xE0, 0x02, 0x45, 0xCA, 0xD2, 0x3B, 0x7B, 0x6C, 0x1C,
+    0x29, 0x99, 0x68, 0x24, 0x95, 0x63, 0x1D, 0x1D, 0xE6, 0x7B, 0x23, 0xD6, 0x04, 0x2E, 0x34, 0xD9,
+    0x34, 0xAC, 0x86, 0x55, 0xD9, 0x41, 0x31, 0x67, 0x53, 0xC0, 0x4C, 0x50, 0x2F, 0x7B, 0x2F, 0xD5,
+    0x22, 0x7D, 0x25, 0x73, 0x86, 0x50, 0x81, 0x15, 0xEC, 0x11, 0x0F, 0xAE, 0xF3, 0xE8, 0xB1, 0x01,
+    0xDB, 0x5E, 0x85, 0x17, 0xF9, 0xAB, 0x3F, 0xAC, 0x14, 0x7C, 0xB6, 0xAA, 0x25, 0x50, 0x49, 0xE0,
+    0xAA, 0x6D, 0x75, 0x74, 0x58, 0xCE, 0xF1, 0xD5, 0x75, 0xD0, 0x7F, 0x50, 0x52, 0xF8, 0x84, 0x07,
+    0xC4, 0x83, 0x9E, 0x01, 0x33, 0x6E, 0x4E, 0x1D, 0xC7, 0x2D, 0x3A, 0xB9, 0x46, 0x23, 0xD2, 0x96,
+    0xCB, 0xE3, 0x42, 0xD3, 0x92, 0xF4, 0x88, 0x8E, 0xAE, 0xC5, 0x3C, 0x95, 0xE0, 0x2F, 0xAA, 0xB8,
+    0x69, 0xDF, 0xBC, 0x6D, 0x72, 0xD8, 0x48, 0x61, 0x7B, 0xCA, 0x0C, 0x80, 0x0B, 0x40, 0xD7, 0x02,
+    0xD2, 0x82, 0x92, 0x9E, 0x1D, 0x25, 0xCB, 0x0B, 0x93, 0x12, 0x91, 0x40, 0x27, 0x13, 0xEC, 0x5C,
+    0xCC, 0xC0, 0xB1, 0xEB, 0x41, 0x3C, 0x2A, 0x6D, 0x80, 0x8A, 0xAD, 0xE1, 0x62, 0xA5, 0x2D, 0x45,
+    0x42, 0xF3, 0x88, 0xE8, 0xC8, 0x6C, 0xBD, 0x8A, 0x89, 0x9D, 0x32, 0x66, 0xF7, 0xE0, 0x10, 0x54,
+    0x82, 0x2A, 0x66, 0xB9, 0xBB, 0x00, 0xD2, 0x52, 0xC8, 0xEB, 0x4F, 0x3C, 0x25, 0x32, 0xD3, 0x49,
+    0xCF, 0xE9, 0x0B, 0x70, 0x82, 0x02, 0x0E, 0x68, 0x28, 0x52, 0x19, 0x51, 0x73, 0x03, 0x4A, 0xE2,
+    0x6A, 0x42, 0x17, 0xE3, 0x1F, 0x74, 0x16, 0x14, 0xBE, 0x68, 0x8D, 0xB7, 0xDE, 0x3D, 0x32, 0xE1,
+    0x4C, 0xA0, 0x49, 0xD0, 0xF4, 0xAB, 0x1E, 0xFE, 0x40, 0x67, 0xC1, 0x49, 0x4E, 0x80, 0x1E, 0x8A,
+    0x04, 0x65, 0xAC, 0x03, 0x54, 0x3F, 0x4F, 0x40, 0x25, 0x01, 0xA8, 0xD2, 0x5D, 0x1D, 0xCD, 0x46,
+    0x11, 0x15, 0x9D, 0xC8, 0x4F, 0xA9, 0x44, 0x64, 0x5E, 0xD1, 0x0A, 0x95, 0xA8, 0x16, 0xAA, 0x88,
+    0x9E, 0xB1, 0x61, 0x85, 0x26, 0xAA, 0x51, 0x25, 0x30, 0x43, 0x15, 0xC1, 0x85, 0x7C, 0x27, 0x1D,
+    0xA8, 0x94, 0xFB, 0xA6, 0x8A, 0x60, 0xEF, 0x9E, 0xD6, 0x93, 0x4A, 0x60, 0xFA, 0x2A, 0x42, 0x87,
+    0x0D, 0x2B, 0x76, 0xE1, 0x82, 0x4A, 0x94, 0x89, 0xEA, 0xED, 0xC7, 0x25, 0x94, 0x22, 0x32, 0xDE,
+    0x03, 0x54, 0x70, 0xBA, 0xF0, 0x60, 0x53, 0xD5, 0x52, 0x48, 0x74, 0xC0, 0xA5, 0x90, 0x80, 0x46,
+    0x0F, 0x50, 0x24, 0x03, 0x94, 0xF1, 0x1B, 0x40, 0x1D, 0x02, 0xC5, 0xC5, 0xA6, 0x80, 0x4E, 0x12,
+    0x58, 0x91, 0x48, 0xB1, 0xF8, 0x26, 0x60, 0x7A, 0x1A, 0x38, 0xA4, 0x48, 0xE8, 0x48, 0x19, 0xA9,
+    0x03, 0x75, 0xA0, 0x83, 0x06, 0x95, 0x28, 0x12, 0x55, 0xA4, 0x8C, 0xD8, 0x90, 0x63, 0x12, 0x34,
+    0xB0, 0x50, 0x24, 0xF4, 0x8C, 0x89, 0x94, 0xCB, 0xBF, 0x97, 0x40, 0x25, 0xD2, 0xCC, 0x94, 0x32,
+    0x76, 0x91, 0xE2, 0x62, 0x36, 0xC9, 0x3E, 0x9A, 0xD0, 0x0E, 0xA7, 0x81, 0x4A, 0x80, 0x5A, 0xB6,
+    0x51, 0x89, 0x06, 0xF8, 0x9A, 0x3C, 0x4F, 0x9E, 0x7F, 0xDB, 0x73, 0xBB, 0xFF, 0x5F, 0x07, 0x9D,
+    0x08, 0x5A, 0x44, 0x30, 0x23, 0x5D, 0x16, 0x81, 0xF3, 0x34, 0xD9, 0x88, 0x6C, 0xA0, 0xC9, 0xA2,
+    0xBA, 0xBB, 0x69, 0xA0, 0xA1, 0x69, 0xB3, 0x1F, 0x2E, 0xD4, 0xB7, 0xCF, 0x48, 0x96, 0x4F, 0x21,
+    0xB3, 0x4D, 0x9C, 0xF6, 0x3B, 0xD9, 0x9E, 0x55, 0x22, 0x43, 0xB6, 0xB4, 0x4E, 0xDF, 0x67, 0x1F,
+    0xD6, 0x22, 0x32, 0x75, 0x22, 0x32, 0x3C, 0x79, 0x67, 0xBF, 0x0B, 0x36, 0xE0, 0xE8, 0xE0, 0x25,
+    0x95, 0x28, 0xFA, 0x2A, 0x92, 0xC7, 0x36, 0x1D, 0x79, 0xAE, 0x53, 0x89, 0x24, 0xAC, 0xC8, 0x40,
+    0xB7, 0xBF, 0xEF, 0xF3, 0xA9, 0xA3, 0x9F, 0x3A, 0xA1, 0x12, 0xBC, 0x58, 0x45, 0xF4, 0x60, 0x03,
+    0xB5, 0xEF, 0x1E, 0xDF, 0x9F, 0x1B, 0xC9, 0x01, 0x37, 0x09, 0xC5, 0xFE, 0xBE, 0x37, 0x22, 0xDE,
+    0x49, 0x3A, 0x76, 0x17, 0xA7, 0xA1, 0x96, 0x5E, 0x8B, 0xF4, 0xAE, 0x75, 0x2F, 0x4F, 0xB8, 0x2F,
+    0x07, 0x0E, 0x1D, 0xC5, 0xED, 0x79, 0xEF, 0x89, 0x37, 0x45, 0xE4, 0xBA, 0xC8, 0x7C, 0x98, 0xA7,
+    0x5B, 0x19, 0xC1, 0xF4, 0x79, 0xCD, 0x6A, 0x6E, 0x3F, 0xDE, 0x77, 0x22, 0x34, 0x32, 0x6E, 0xDD,
+    0xD3, 0x22, 0x70, 0x01, 0x13, 0xCA, 0x16, 0xF7, 0xFA, 0x0D, 0x70, 0x32, 0x80, 0xBD, 0x57, 0xDF,
+    0x16, 0x22, 0x22, 0x7F, 0x27, 0x22, 0xCB, 0x8E, 0xEC, 0xBF, 0x90, 0x54, 0x42, 0xC7, 0x2A, 0x52,
+    0xB5, 0x36, 0xF0, 0x99, 0x23, 0x8D, 0xBD, 0xDB, 0x32, 0x91, 0xA0, 0x44, 0x16, 0xAA, 0x3B, 0xFB,
+    0xCF, 0xDD, 0x2B, 0x92, 0x08, 0xDE, 0x06, 0x2A, 0xDF, 0x65, 0x4C, 0xB3, 0x18, 0xAB, 0xB7, 0xBF,
+    0x76, 0xFD, 0x07, 0x92, 0x23, 0x6F, 0xB9, 0xA9, 0x06, 0x8D, 0xE3, 0x2C, 0xF2, 0x42, 0x44, 0x24,
+    0x2F, 0x32, 0x9B, 0x9B, 0xB9, 0x40, 0x21, 0x33, 0x4E, 0x66, 0x3D, 0xE9, 0x54, 0xB7, 0x7A, 0x4C,
+    0x54, 0x3F, 0x89, 0xD4, 0xFF, 0xF8, 0xFD, 0xBD, 0xC3, 0x4E, 0xE4, 0x8E, 0x88, 0xFC, 0xCB, 0x90,
+    0x97, 0xDC, 0x26, 0xAF, 0xFC, 0x7A, 0x86, 0x52, 0x9E, 0xFD, 0x5F, 0x2B, 0x91, 0x58, 0x8A, 0x78,
+    0xF6, 0x3C, 0xF0, 0x3C, 0x64, 0xBC, 0xDC, 0x0D, 0x1B, 0xFB, 0xE3, 0xB9, 0xFB, 0x5D, 0x16, 0x91,
+    0x1F, 0x8B, 0x88, 0x3C, 0xD5, 0xBC, 0xB1, 0x2F, 0x74, 0x90, 0x54, 0x42, 0x0D, 0x55, 0xA4, 0xF4,
+    0xF7, 0xB7, 0x2B, 0xCF, 0xDF, 0x4E, 0xA4, 0x55, 0xCB, 0xFE, 0xB7, 0xB9, 0x7F, 0x40, 0x9C, 0xAC,
+    0x22, 0xAA, 0xB7, 0x01, 0xD3, 0x76, 0x70, 0x45, 0xCD, 0x7F, 0xF3, 0xC2, 0xDB, 0x22, 0x22, 0xB7,
+    0x44, 0x44, 0xA0, 0x1C, 0x56, 0xBD, 0x90, 0x83, 0x02, 0x47, 0xB5, 0xCB, 0x45, 0x68, 0xC4, 0x1B,
+    0x11, 0xBF, 0x20, 0xE5, 0xC0, 0xEC, 0x50, 0x53, 0xA2, 0xFC, 0xD7, 0xB7, 0xF7, 0x2E, 0x5D, 0x17,
+    0x59, 0x3A, 0x91, 0x5F, 0xAE, 0xCB, 0x6B, 0x1D, 0xB2, 0x5B, 0x2B, 0x9E, 0x42, 0x5E, 0x7F, 0xE2,
+    0x51, 0x91, 0x54, 0x48, 0xD6, 0x2E, 0x1F, 0x72, 0x7B, 0xB0, 0x7E, 0xE3, 0x96, 0xF9, 0xD5, 0x5D,
+    0x53, 0xCB, 0x05, 0xD0, 0xD2, 0x67, 0xB3, 0xEE, 0x83, 0xE8, 0xCC, 0x27, 0x22, 0xD8, 0x1C, 0x75,
+    0x29, 0x07, 0xA8, 0x5F, 0x07, 0x37, 0x43, 0x3D, 0xE0, 0x39, 0x45, 0x19, 0x74, 0xC4, 0xF4, 0xCE,
+    0x53, 0xBF, 0x36, 0x42, 0x2D, 0x1E, 0xEA, 0x71, 0x0D, 0xCA, 0xFC, 0x61, 0x06, 0xF8, 0xAA, 0x45,
+    0x71, 0x6A, 0xC4, 0xD5, 0x2D, 0x4D, 0x82, 0x2E, 0x1C, 0xD7, 0xA2, 0x9E, 0x52, 0x46, 0x44, 0x46,
+    0x33, 0x98, 0x78, 0x15, 0xF3, 0x5A, 0xC4, 0xFE, 0x7D, 0xE0, 0x6A, 0xB3, 0xF7, 0xF8, 0x1D, 0x11,
+    0x79, 0x53, 0x44, 0x2E, 0x65, 0x9B, 0xA2, 0x48, 0x59, 0xBF, 0x9B, 0x11, 0xEA, 0x65, 0xEF, 0x45,
+    0x2B, 0x12, 0xEA, 0x63, 0xB6, 0x64, 0x06, 0x46, 0x4D, 0x02, 0xB4, 0x44, 0x60, 0xB6, 0x01, 0x9C,
+    0xBF, 0x0A, 0xAA, 0x2F, 0xFA, 0xA3, 0x4A, 0x34, 0xC3, 0xD5, 0x95, 0xC8, 0x82, 0x96, 0x67, 0x2F,
+    0x0D, 0x85, 0x78, 0xAE, 0xE2, 0xDA, 0x35, 0x2A, 0x72, 0x9E, 0x19, 0x54, 0xB0, 0x81, 0x6C, 0x08,
+    0xAF, 0xF0, 0x49, 0x39, 0x6E, 0xBF, 0xA5, 0x8C, 0x54, 0x32, 0x37, 0x9E, 0x4E, 0x7E, 0x30, 0x52,
+    0x5C, 0x9F, 0x5C, 0x0B, 0xEE, 0xB1, 0x04, 0x7A, 0xB4, 0x03, 0x38, 0x2F, 0x1E, 0x3D, 0x56, 0x0B,
+    0x38, 0x6F, 0xE5, 0xD9, 0x4B, 0x23, 0x9D, 0x88, 0x40, 0x27, 0xD2, 0xC2, 0xE9, 0x8B, 0x9B, 0x1B,
+    0xC9, 0x5E, 0x50, 0x5C, 0x8D, 0x9F, 0xFA, 0xEF, 0x7A, 0x48, 0x26, 0x50, 0x05, 0xE3, 0xF9, 0x14,
+    0xA7, 0xB6, 0xD6, 0x46, 0xE1, 0x95, 0xE4, 0xA0, 0xF5, 0xA2, 0x27, 0x95, 0x3E, 0x6B, 0x82, 0x9A,
+    0xB8, 0x4A, 0x19, 0xD5, 0x84, 0x09, 0xD5, 0x40, 0x43, 0x1D, 0xD4, 0x84, 0xEB, 0x6D, 0xC0, 0x65,
+    0xA8, 0xAB, 0xCD, 0x9D, 0x7F, 0x85, 0xBC, 0x46, 0x52, 0x2D, 0xFB, 0xDF, 0xC6, 0x88, 0x08, 0x56,
+    0x64, 0xD1, 0x23, 0xBB, 0xC9, 0x7A, 0x74, 0x4C, 0x60, 0x6E, 0x46, 0xB8, 0x61, 0x22, 0xF5, 0x50,
+    0xCB, 0xF5, 0x85, 0x5A, 0xA4, 0x65, 0x77, 0xFF, 0x6E, 0x9C, 0xEE, 0x73, 0x7C, 0x0C, 0xCA, 0x5E,
+    0xF5, 0xE0, 0xBE, 0x9F, 0x40, 0x89, 0x78, 0x28, 0xA5, 0xE5, 0xF8, 0xFC, 0xFD, 0xC8, 0x08, 0x17,
+    0x50, 0x81, 0x1E, 0x13, 0x8C, 0xC7, 0xDE, 0x49, 0xE0, 0x24, 0xC0, 0x99, 0x63, 0x96, 0x65, 0x71,
+    0x91, 0x0B, 0x74, 0x22, 0x83, 0x11, 0x91, 0x76, 0xA1, 0xFB, 0xB8, 0x8E, 0x1C, 0x52, 0xB7, 0x45,
+    0xE2, 0x10, 0x1D, 0xD5, 0x44, 0x1D, 0xCA, 0xC8, 0x21, 0x66, 0xAC, 0x62, 0xD6, 0x96, 0x8D, 0x0C,
+    0xE8, 0xE1, 0xD8, 0x5C, 0x97, 0xFD, 0x7D, 0xAF, 0x45, 0x24, 0x54, 0x22, 0xD2, 0xCE, 0x14, 0x5D,
+    0xD5, 0x43, 0x72, 0x64, 0xE1, 0xDA, 0xC7, 0x12, 0xE5, 0x54, 0xCA, 0x9B, 0xD2, 0x96, 0x22, 0x03,
+    0xC5, 0xFE, 0x73, 0x00, 0xEA, 0x1A, 0x1B, 0x80, 0xC7, 0x8C, 0xDB, 0xC3, 0x23, 0xB1, 0xD1, 0xF5,
+    0x1E, 0x61, 0x35, 0x0C, 0x3A, 0x91, 0x01, 0x77, 0xFB, 0xF1, 0x85, 0x7A, 0xA4, 0x1C, 0xF4, 0xB4,
+    0xC6, 0x24, 0xF5, 0x60, 0x7A, 0xF8, 0x42, 0x8E, 0x9B, 0xB9, 0x76, 0x63, 0x08, 0xD3, 0xF8, 0x6D,
+    0x88, 0xA0, 0x21, 0x0B, 0x33, 0xCB, 0xF5, 0x21, 0x79, 0x66, 0x02, 0x3D, 0xBA, 0x00, 0xEE, 0xD1,
+    0x05, 0xF4, 0x68, 0x46, 0x70, 0xBE, 0x1B, 0xD0, 0xA3, 0x92, 0xDB, 0x8F, 0x8B, 0xAF, 0x44, 0x24,
+    0x52, 0x89, 0x4C, 0x50, 0xEC, 0xF9, 0x35, 0xDC, 0x6B, 0x46, 0xB2, 0x92, 0xCD, 0x46, 0xCA, 0x71,
+    0xEC, 0x6B, 0x8F, 0x53, 0x58, 0x91, 0x49, 0x8B, 0xC8, 0xE0, 0x5A, 0xFB, 0x8A, 0x4F, 0xD8, 0xB6,
+    0x1C, 0x68, 0xB0, 0x2D, 0x89, 0x43, 0xCA, 0x58, 0x24, 0x6C, 0xAB, 0x67, 0x95, 0xD0, 0x22, 0x3D,
+    0xB5, 0x4C, 0xF9, 0x1F, 0x97, 0xFD, 0x86, 0xE9, 0xD5, 0xBD, 0xB1, 0x7F, 0x0D, 0x11, 0x89, 0x4A,
+    0x44, 0x06, 0xE7, 0xB9, 0xF4, 0xCA, 0x08, 0xCE, 0x84, 0x2C, 0xD1, 0xAA, 0x17, 0x8A, 0xA5, 0x90,
+    0x3B, 0x32, 0x14, 0x22, 0x13, 0x7C, 0xED, 0xDB, 0x1F, 0xAD, 0x81, 0x77, 0x82, 0x6D, 0x07, 0xB8,
+    0x23, 0x44, 0xAE, 0x2D, 0x26, 0xCB, 0x15, 0xD8, 0xC4, 0xC7, 0x3F, 0xC5, 0x1A, 0x4A, 0xAF, 0xFD,
+    0x8A, 0x14, 0x64, 0x2D, 0x12, 0x36, 0xBD, 0x27, 0x1B, 0xD0, 0x2F, 0x1B, 0x44, 0x7E, 0x27, 0x37,
+    0x4F, 0x44, 0x26, 0x33, 0x54, 0xF1, 0x9A, 0xA3, 0x1A, 0x8A, 0x89, 0x3A, 0x54, 0x03, 0x0E, 0xDB,
+    0x16, 0x89, 0x86, 0x6A, 0x40, 0x7C, 0x07, 0x22, 0x23, 0xA5, 0x2C, 0x19, 0x8B, 0x28, 0x46, 0xB2,
+    0xDA, 0xC4, 0xDE, 0xD9, 0x7F, 0x0E, 0x27, 0x92, 0xE8, 0x44, 0x26, 0xD3, 0x73, 0x26, 0xDE, 0x58,
+    0x57, 0x00, 0x67, 0x02, 0x6A, 0x74, 0x81, 0xA6, 0x6D, 0x96, 0x6E, 0xA2, 0x91, 0x05, 0x1E, 0xDA,
+    0x3F, 0x32, 0xBF, 0x6D, 0x9B, 0xE3, 0xCC, 0x59, 0x9D, 0x24, 0x80, 0x26, 0xD3, 0x1D, 0x82, 0xF5,
+    0x50, 0x0C, 0x7C, 0xEB, 0x1E, 0x88, 0x51, 0x16, 0x8C, 0xA4, 0x4E, 0xFA, 0x42, 0xE4, 0xA9, 0xA6,
+    0xA7, 0xE8, 0xBC, 0xCA, 0x41, 0x64, 0x1B, 0x56, 0x23, 0xFF, 0x37, 0xBC, 0x91, 0xD5, 0x39, 0x13,
+    0x89, 0xD8, 0x37, 0xF6, 0xF7, 0x3B, 0xDE, 0xE7, 0x3F, 0xE8, 0xA1, 0xF3, 0x8D, 0x44, 0x3A, 0xB9,
+    0x25, 0x42, 0x2D, 0x29, 0x13, 0x81, 0xF4, 0x7C, 0x17, 0xA8, 0x9A, 0x13, 0x60, 0x5E, 0x4E, 0x40,
+    0x2A, 0x22, 0x14, 0xBE, 0x38, 0x6E, 0xB4, 0x67, 0x90, 0xBA, 0xC8, 0xA8, 0xFE, 0xA5, 0x77, 0x8D,
+    0xC4, 0xB1, 0x07, 0x45, 0xB2, 0xE2, 0x29, 0x7F, 0x25, 0x02, 0xB5, 0x7C, 0x65, 0x81, 0xA6, 0xD7,
+    0x89, 0x22, 0x51, 0x46, 0xCA, 0x88, 0xE9, 0xA9, 0x43, 0x36, 0xE5, 0x99, 0x29, 0x12, 0x7A, 0x7C,
+    0x0F, 0xA7, 0x4B, 0x89, 0x95, 0x44, 0x27, 0xC1, 0x49, 0xA8, 0x65, 0xC2, 0x49, 0xCC, 0x92, 0x6D,
+    0x9F, 0x1C, 0xE1, 0x52, 0xBF, 0x36, 0x9C, 0x0E, 0x8A, 0x44, 0xE6, 0x04, 0xFE, 0x24, 0xEF, 0xDA,
+    0x63, 0x97, 0x56, 0xD1, 0x54, 0x22, 0x22, 0x61, 0x15, 0x31, 0xDD, 0xFE, 0xFE, 0xFE, 0xDD, 0x4B,
+    0x39, 0x00, 0xF4, 0xC0, 0xBF, 0x3A, 0x7E, 0xC9, 0xA3, 0x66, 0xB2, 0x78, 0x5F, 0x11, 0x09, 0xA5,
+    0x48, 0x46, 0xF5, 0x95, 0x84, 0x0D, 0xAC, 0x7F, 0x84, 0xC8, 0xA8, 0xBA, 0x37, 0x5A, 0xC8, 0xB6,
+    0xFE, 0x31, 0xA6, 0xE3, 0xA5, 0x6B, 0x14, 0xA9, 0x93, 0x96, 0x5A, 0x64, 0xA6, 0x90, 0xDE, 0x46,
+    0xEA, 0x81, 0x6E, 0x75, 0x0D, 0xEB, 0x80, 0xF3, 0x59, 0x20, 0xEF, 0xED, 0xB0, 0x96, 0x60, 0xE5,
+    0xA6, 0x24, 0x2D, 0xA9, 0x1A, 0x3E, 0x67, 0xD3, 0x39, 0x27, 0xF3, 0xB9, 0x3A, 0x7D, 0xBA, 0x1C,
+    0x8F, 0xF8, 0x39, 0xC9, 0xCA, 0xB4, 0x23, 0x9E, 0x8E, 0xF7, 0xFF, 0xE3, 0x6B, 0x49, 0x56, 0x52,
+    0x01, 0xF2, 0xE8, 0x2D, 0xF9, 0x72, 0xD7, 0xCC, 0x2F, 0xBA, 0xE8, 0xFF, 0x64, 0xFB, 0xDF, 0x2F,
+    0x8D, 0x5A, 0xFA, 0x5D, 0xF1, 0x99, 0xE8, 0x66, 0x7A, 0xDC, 0xAF, 0x39, 0xAC, 0x25, 0x8A, 0x84,
+    0x9D, 0xBD, 0x8B, 0x99, 0x03, 0x78, 0xD4, 0x1F, 0xFB, 0x40, 0xEE, 0xF0, 0xF3, 0xFB, 0xFF, 0x20,
+    0xF2, 0xB3, 0x63, 0xA0, 0xFA, 0xAE, 0x78, 0x37, 0x73, 0xE9, 0x5D, 0x6F, 0x8B, 0x19, 0x3D, 0x16,
+    0x22, 0x46, 0x12, 0xF0, 0x29, 0x3E, 0x7E, 0x9E, 0xCF, 0xB8, 0xEF, 0x1F, 0xD4, 0x32, 0x29, 0xE9,
+    0xD7, 0xA8, 0xF8, 0x07, 0x74, 0x87, 0xA0, 0x7A, 0x7E, 0xD8, 0x57, 0x97, 0xEE, 0x24, 0x27, 0xFD,
+    0x99, 0xE9, 0xB7, 0x95, 0x61, 0x23, 0x6F, 0xE5, 0x55, 0xA6, 0x43, 0x25, 0xAA, 0x88, 0x0D, 0xEF,
+    0xE9, 0x70, 0x2E, 0x44, 0x6E, 0x89, 0x70, 0x9E, 0xB2, 0xC7, 0x41, 0x42, 0x2F, 0x17, 0x2A, 0x09,
+    0xBB, 0x13, 0x9C, 0xA4, 0x1C, 0x71, 0x03, 0xD2, 0x16, 0xC7, 0xFC, 0xD3, 0xF7, 0x79, 0x6B, 0x6A,
+    0xC2, 0xC2, 0x44, 0x39, 0x50, 0xBF, 0x8E, 0x9B, 0xA9, 0x07, 0x9E, 0xC3, 0x8C, 0xB8, 0x1E, 0xF1,
+    0x47, 0x7C, 0xB2, 0xDF, 0xB5, 0x0D, 0xBF, 0x8D, 0xD4, 0xA2, 0xC8, 0x3B, 0xB2, 0x18, 0x59, 0x3E,
+    0x39, 0xF3, 0xC9, 0x19, 0x1B, 0x70, 0xAD, 0x4A, 0xE8, 0xE9, 0xF7, 0x71, 0x38, 0xA3, 0xA7, 0x52,
+    0x04, 0xD7, 0x76, 0x12, 0x57, 0x4D, 0xC9, 0xC6, 0xEF, 0xC8, 0x41, 0x4A, 0x17, 0x00, 0x1B, 0xC9,
+    0xB4, 0x65, 0xF8, 0x36, 0x70, 0x92, 0x82, 0xBA, 0x2F, 0x66, 0xBD, 0xE0, 0x06, 0x37, 0xE8, 0x65,
+    0x8D, 0x22, 0xDD, 0x07, 0x96, 0xF6, 0xD5, 0xEC, 0x66, 0x2D, 0xDF, 0xED, 0xFA, 0x33, 0x33, 0x33,
+    0xA6, 0x37, 0x3D, 0xEF, 0xEF, 0xA0, 0x96, 0x68, 0x5E, 0x13, 0x61, 0xDE, 0x04, 0x0F, 0x36, 0x8B,
+    0x95, 0x9E, 0x56, 0xA5, 0xDC, 0x85, 0x6C, 0xB6, 0x17, 0xCF, 0x6D, 0x7D, 0x0F, 0x93, 0xD0, 0xEF,
+    0x44, 0xE6, 0x3A, 0x38, 0x7F, 0xF5, 0x88, 0xC7, 0x61, 0x25, 0x69, 0x91, 0x76, 0x47, 0x3C, 0x19,
+    0x5F, 0xFB, 0x9D, 0x76, 0x0B, 0x98, 0xCC, 0x34, 0x74, 0x2D, 0x26, 0x52, 0xCD, 0x68, 0xF1, 0x3C,
+    0xE4, 0xB3, 0xA9, 0x68, 0x22, 0xE5, 0x82, 0x96, 0x5E, 0x8D, 0xA9, 0x98, 0xEA, 0x76, 0x2A, 0xE2,
+    0xA9, 0x6D, 0x9C, 0xE6, 0xCC, 0x84, 0x5D, 0x28, 0xBA, 0x96, 0x6A, 0x40, 0x4D, 0x70, 0x08, 0xF6,
+    0xBD, 0xBD, 0x71, 0x2D, 0xA6, 0xA7, 0x8A, 0x54, 0x23, 0xF5, 0x84, 0x1D, 0x51, 0xD7, 0xA0, 0x91,
+    0x58, 0xCB, 0x5B, 0x22, 0x6D, 0x23, 0x4F, 0x35, 0xFD, 0xBA, 0x5A, 0x2F, 0xA8, 0x44, 0xDD, 0x53,
+    0x45, 0x35, 0x6F, 0x51, 0x46, 0x95, 0x40, 0x25, 0x1B, 0xA0, 0xFA, 0xC5, 0x04, 0x58, 0x69, 0x81,
+    0x6E, 0x01, 0xD4, 0xB2, 0x00, 0xD5, 0x2F, 0x16, 0xC0, 0xDE, 0x5C, 0x80, 0x4E, 0x2F, 0xA0, 0x92,
+    0x5E, 0xA0, 0x8A, 0x7A, 0x01, 0x1B, 0xF4, 0x02, 0x1D, 0x5A, 0x50, 0x33, 0x5A, 0x1E, 0x11, 0x09,
+    0x5A, 0xFE, 0x45, 0x64, 0xE5, 0xE2, 0x14, 0xDB, 0xD9, 0xE3, 0xDA, 0x2D, 0xAA, 0x46, 0xBA, 0x1B,
+    0xF5, 0xA9, 0x3D, 0xAB, 0x05, 0x8B, 0xF2, 0xEF, 0x27, 0xE8, 0x0C, 0x14, 0xA9, 0x94, 0xB4, 0x6E,
+    0xE8, 0xDA, 0x22, 0xA9, 0x44, 0x91, 0xAA, 0x48, 0x91, 0x5C, 0x4B, 0x91, 0xE6, 0xD5, 0x12, 0x2A,
+    0xE6, 0x19, 0x8A, 0xD4, 0x79, 0x8A, 0xE4, 0x02, 0x45, 0x32, 0x91, 0x22, 0xE9, 0x44, 0x91, 0x0A,
+    0xF1, 0x45, 0xA2, 0x19, 0x6A, 0x09, 0xF5, 0xE4, 0x24, 0x64, 0xB2, 0xEE, 0xC5, 0xA3, 0xF7, 0x6C,
+    0xC3, 0x66, 0xAC, 0x99, 0xB0, 0xB9, 0xE1, 0xF3, 0x00, 0x9F, 0xDD, 0xAE, 0xD8, 0x88, 0x3C, 0x26,
+    0xC1, 0x49, 0xB8, 0x14, 0x59, 0x3C, 0x89, 0x65, 0xCB, 0x9C, 0x99, 0x41, 0xFF, 0x7C, 0x06, 0x96,
+    0x19, 0x70, 0xE2, 0xC1, 0xDC, 0x1A, 0x41, 0x47, 0xF1, 0x90, 0xCC, 0x08, 0xAE, 0x10, 0x8F, 0x09,
+    0xF5, 0x88, 0x1E, 0x0B, 0x69, 0xCF, 0x48, 0x5F, 0x27, 0x23, 0x53, 0x66, 0x19, 0xED, 0x78, 0xF0,
+    0xAC, 0x54, 0x59, 0x01, 0xEC, 0x04, 0x5A, 0xDA, 0x95, 0x3D, 0x70, 0xCC, 0xCE, 0x2F, 0x44, 0x02,
+    0x95, 0x2C, 0xB0, 0x23, 0xFE, 0x7E, 0xC8, 0x80, 0xF7, 0x7B, 0xAA, 0xD8, 0x02, 0x2B, 0xE7, 0x54,
+    0x42, 0x8D, 0xD5, 0xDB, 0x5F, 0xBB, 0xFE, 0xEA, 0x06, 0x45, 0x98, 0x00, 0x2A, 0xD4, 0x4C, 0x37,
+    0xD6, 0xE2, 0x0F, 0xFD, 0x16, 0x27, 0xEA, 0x62, 0x29, 0xA1, 0xE8, 0x56, 0x8B, 0x6A, 0xCB, 0x57,
+    0x7F, 0x8F, 0x87, 0xDE, 0x66, 0x7E, 0x8C, 0x44, 0x94, 0x48, 0x4B, 0xD1, 0xF4, 0xBF, 0xD5, 0xCD,
+    0xDF, 0x73, 0xEA, 0xEB, 0x1B, 0x8C, 0xD3, 0xF8, 0x0E, 0x6E, 0xA8, 0xF9, 0x6F, 0x5E, 0xF8, 0xF9,
+    0x06, 0x28, 0x5A, 0xB6, 0x94, 0xD7, 0x35, 0x16, 0x63, 0xC3, 0xD1, 0x48, 0x45, 0xD5, 0x6F, 0x7A,
+    0xFC, 0xDA, 0x07, 0xD7, 0x3E, 0xE0, 0xC4, 0x6A, 0x45, 0x56, 0x03, 0xD6, 0x33, 0x61, 0xC2, 0x3A,
+    0xA4, 0x4E, 0x6D, 0xA6, 0x84, 0x8E, 0xB5, 0x24, 0x13, 0x3A, 0x19, 0xCE, 0xF1, 0xE4, 0x58, 0x44,
+    0x6C, 0x28, 0x5B, 0x3A, 0x3E, 0x8D, 0x4A, 0x9C, 0xFC, 0x6D, 0x64, 0xF1, 0x19, 0x95, 0x60, 0xAA,
+    0x22, 0xBA, 0xB7, 0x01, 0xEB, 0xBB, 0xC7, 0xF7, 0xD3, 0x16, 0xEF, 0x6D, 0xB9, 0x58, 0x28, 0x09,
+    0x07, 0x4D, 0xAA, 0xC2, 0xA5, 0x90, 0x8A, 0x64, 0xDA, 0x3A, 0x8C, 0x45, 0x32, 0xD4, 0xA1, 0x2F,
+    0xD2, 0x09, 0xEA, 0x1C, 0x77, 0x7C, 0x1F, 0xBB, 0x1E, 0x2B, 0xB1, 0x14, 0xE1, 0xBD, 0xF4, 0x67,
+    0xE1, 0x55, 0xC2, 0x85, 0x2A, 0x16, 0x82, 0x0D, 0x65, 0xA2, 0xA3, 0xEA, 0x7F, 0xBB, 0xFE, 0xBC,
+    0x98, 0x57, 0x91, 0x26, 0xE5, 0x35, 0xA4, 0x78, 0xF7, 0xDF, 0x93, 0x45, 0x52, 0xA9, 0x48, 0x7A,
+    0xFD, 0x2D, 0xC6, 0x77, 0xFD, 0xFC, 0x0C, 0x56, 0x22, 0x8D, 0x44, 0x4A, 0x11, 0x72, 0xB3, 0xF8,
+    0xE4, 0xBC, 0x5D, 0xDF, 0x6C, 0xD8, 0xDC, 0xB2, 0x5A, 0x13, 0x1C, 0x3C, 0xD8, 0x57, 0x22, 0x54,
+    0xEF, 0x4C, 0xA0, 0x64, 0x80, 0x42, 0x5A, 0x28, 0x25, 0x80, 0x91, 0x08, 0xEA, 0x7B, 0xE9, 0xE8,
+    0x9F, 0x97, 0xBE, 0x8A, 0xE8, 0x41, 0x25, 0x18, 0xE9, 0xE0, 0x06, 0xF6, 0xFB, 0xFB, 0x5D, 0x21,
+    0x22, 0x12, 0x3A, 0x11, 0x19, 0x38, 0x8D, 0x92, 0x50, 0x48, 0x64, 0x37, 0x41, 0x03, 0x75, 0xA0,
+    0x8C, 0x14, 0xEB, 0x9B, 0x57, 0x7C, 0xF9, 0x8B, 0x58, 0x48, 0xA4, 0x19, 0xA8, 0x7B, 0x6C, 0xC4,
+    0x25, 0x5C, 0xC3, 0x27, 0x8E, 0x7F, 0x2C, 0xBF, 0x99, 0xA9, 0x24, 0xAD, 0x44, 0xE1, 0xD5, 0xB5,
+    0x7A, 0xF1, 0x08, 0x69, 0xC0, 0x4E, 0x00, 0x66, 0x66, 0xCB, 0xAA, 0xDC, 0xA2, 0x5F, 0x47, 0x7C,
+    0xC9, 0x80, 0x91, 0xD4, 0x2C, 0x20, 0xD2, 0x36, 0x23, 0x45, 0xE3, 0x95, 0x04, 0x54, 0xC4, 0x2E,
+    0x60, 0x51, 0xEF, 0x8C, 0xA8, 0x88, 0xB5, 0x01, 0x8B, 0x8A, 0x82, 0x8A, 0xD8, 0x72, 0xC4, 0xA2,
+    0xA2, 0x0D, 0x2A, 0x62, 0x11, 0x2C, 0x2A, 0x96, 0x93, 0x8A, 0x58, 0x6C, 0x6F, 0x51, 0x11, 0x51,
+    0x11, 0x8B, 0x9E, 0x2C, 0x2A, 0x52, 0x7F, 0x2F, 0x62, 0x41, 0x2C, 0x2A, 0xA2, 0xEF, 0x44, 0x2C,
+    0xD4, 0x82, 0x8A, 0xD0, 0x45, 0xAC, 0x47, 0x0B, 0x8D, 0xF4, 0xD4, 0xB1, 0x92, 0x79, 0xA3, 0x6A,
+    0x72, 0x83, 0x3E, 0x0B, 0x19, 0x9C, 0xCD, 0xE1, 0xC8, 0x6C, 0xC5, 0x64, 0xCF, 0x70, 0x85, 0xFB,
+    0xEF, 0x79, 0x9D, 0xF6, 0x54, 0x93, 0x95, 0x56, 0xCB, 0x77, 0x64, 0xE1, 0xCF, 0xE5, 0xF6, 0xA5,
+    0x88, 0x99, 0x68, 0x3C, 0x33, 0x7A, 0xC2, 0xF4, 0xB8, 0x96, 0x19, 0x35, 0x61, 0x7A, 0xEC, 0x7B,
+    0x3C, 0x2C, 0x64, 0x29, 0x64, 0x76, 0x32, 0x38, 0xE9, 0x9B, 0x04, 0x22, 0xAF, 0xCA, 0x80, 0x91,
+    0xA9, 0x14, 0xCF, 0x27, 0x47, 0x6C, 0x02, 0x8B, 0x92, 0x01, 0x15, 0xB1, 0x9D, 0xC7, 0xA2, 0xDE,
+    0x4A, 0xA8, 0x88, 0x35, 0x11, 0x8B, 0x8A, 0x8D, 0x57, 0x11, 0xAB, 0x12, 0x16, 0x15, 0x4D, 0x54,
+    0x11, 0x4B, 0xD3, 0x5A, 0x54, 0x54, 0xB3, 0x8A, 0x58, 0x4C, 0xB4, 0xA8, 0x88, 0x7B, 0x3A, 0x62,
+    0x29, 0x66, 0x8B, 0x8A, 0x98, 0xB7, 0x22, 0x16, 0xDC, 0x75, 0x54, 0xA4, 0x90, 0x88, 0x85, 0x4A,
+    0x32, 0x6D, 0x3C, 0x96, 0x32, 0x53, 0x08, 0x9D, 0xF4, 0xAB, 0x95, 0x97, 0x6D, 0x92, 0xBC, 0x9A,
+    0x3B, 0x0F, 0x39, 0x44, 0xBA, 0x75, 0xA1, 0x57, 0xCC, 0xC3, 0xE6, 0x6E, 0xCF, 0x96, 0xD4, 0x57,
+    0xB7, 0x54, 0xBE, 0xEE, 0x69, 0x99, 0x70, 0x49, 0x64, 0x50, 0x9D, 0xFC, 0x83, 0x80, 0xB4, 0xE5,
+    0xB8, 0x95, 0x96, 0x7E, 0x5F, 0xD2, 0xCA, 0x87, 0xB5, 0x0C, 0xB5, 0xBC, 0x26, 0x8B, 0x96, 0xF9,
+    0x28, 0x92, 0x99, 0xE7, 0x58, 0x31, 0x43, 0x0E, 0x2F, 0x6D, 0xFA, 0xB1, 0x25, 0x87, 0xC8, 0xD7,
+    0x2E, 0x2F, 0x72, 0x4B, 0x26, 0xAE, 0x02, 0x55, 0xB4, 0x01, 0xB0, 0xB7, 0x22, 0x1B, 0x66, 0x56,
+    0x0E, 0x6A, 0xAF, 0x7C, 0x90, 0xFF, 0x79, 0x06, 0xF4, 0x0E, 0xBB, 0xC0, 0xA8, 0x46, 0xA8, 0xFA,
+    0xAB, 0xAC, 0x20, 0x5C, 0x46, 0x40, 0xCA, 0xF9, 0x2E, 0x1A, 0xF4, 0x61, 0x0E, 0xE8, 0x95, 0x6A,
+    0x6D, 0x32, 0x91, 0x76, 0x1D, 0x33, 0x19, 0x88, 0xD9, 0xF0, 0x7C, 0x36, 0x44, 0x9F, 0x0D, 0x89,
+    0xE0, 0x20, 0xDF, 0xD7, 0x39, 0x6C, 0xDF, 0xCD, 0x3C, 0x4C, 0x73, 0x5B, 0xA4, 0x2F, 0xA8, 0x64,
+    0x7E, 0x32, 0x01, 0xF5, 0x48, 0x97, 0xA7, 0xA9, 0x09, 0xAC, 0xBA, 0x92, 0x0C, 0xBF, 0xB0, 0x62,
+    0x31, 0x2B, 0x02, 0xF3, 0x1E, 0x2F, 0x7A, 0x16, 0x28, 0x64, 0x56, 0x92, 0x40, 0xC4, 0x8B, 0x70,
+    0xCF, 0x34, 0xE4, 0x01, 0xD3, 0x10, 0x2C, 0xEA, 0x17, 0xEB, 0x34, 0x1C, 0x1E, 0x30, 0x0D, 0x87,
+    0x3C, 0x0D, 0xBD, 0x45, 0x45, 0x95, 0xF2, 0x34, 0x1C, 0xF2, 0x34, 0x7C, 0x34, 0x62, 0x29, 0x52,
+    0x9E, 0x86, 0x3F, 0xCE, 0xD3, 0xF0, 0xD2, 0x7B, 0x9B, 0x86, 0xE7, 0x01, 0x4E, 0x96, 0x3D, 0x50,
+    0xB6, 0x09, 0x40, 0xAE, 0xB7, 0xAC, 0xEA, 0x62, 0xE5, 0x2C, 0xAD, 0x96, 0x6A, 0x71, 0x11, 0x3B,
+    0x74, 0x8B, 0x96, 0xEF, 0xC8, 0xF2, 0x09, 0x59, 0x9E, 0x48, 0x48, 0x5B, 0x8E, 0x7A, 0xC4, 0x0C,
+    0xA6, 0xC7, 0xB5, 0xCE, 0x73, 0xC8, 0x8C, 0x9A, 0xF4, 0x48, 0x35, 0x98, 0x1E, 0xFB, 0xEB, 0x4E,
+    0x9D, 0x91, 0x41, 0x4D, 0x22, 0x6D, 0xB5, 0x4D, 0xEF, 0x9D, 0x37, 0xDD, 0x66, 0xC3, 0xAA, 0xCE,
+    0xBA, 0x1E, 0xAA, 0x79, 0xA5, 0xC3, 0x64, 0x52, 0xA3, 0xCE, 0xB9, 0x10, 0x22, 0x01, 0x8A, 0xBD,
+    0xBD, 0xFF, 0x19, 0x72, 0x21, 0xF8, 0xDA, 0xFE, 0x35, 0xEA, 0xCC, 0x34, 0x1D, 0xEE, 0x75, 0x54,
+    0x7F, 0x2F, 0xA4, 0xE4, 0x35, 0xF4, 0xE1, 0x09, 0x50, 0xF6, 0x3A, 0x40, 0x79, 0xFB, 0xC9, 0xB0,
+    0x65, 0x34, 0x36, 0x13, 0xF7, 0x44, 0xBD, 0x3F, 0x92, 0x62, 0xCB, 0xDA, 0xB2, 0xA4, 0x98, 0x8A,
+    0x88, 0xB9, 0xB3, 0x40, 0x23, 0xED, 0x4A, 0x5C, 0xFA, 0x30, 0xE4, 0x47, 0xD1, 0x6A, 0xA0, 0xCC,
+    0xF9, 0x19, 0x83, 0x0B, 0xD0, 0x3D, 0x25, 0xA0, 0xE6, 0x72, 0x82, 0x72, 0x30, 0x3D, 0x28, 0xFF,
+    0xF1, 0x8F, 0xB8, 0x14, 0x0B, 0x7F, 0x12, 0xCE, 0xEB, 0x9E, 0x32, 0x1E, 0xC2, 0x6C, 0x02, 0xF5,
+    0xD3, 0x23, 0x3A, 0x5E, 0x85, 0xB3, 0x65, 0x4B, 0xB1, 0x05, 0x06, 0x4E, 0x7B, 0xB0, 0xD2, 0x53,
+    0x8B, 0x84, 0x6A, 0x2C, 0x17, 0xD2, 0x03, 0x88, 0xF9, 0xC5, 0x31, 0x62, 0x7E, 0xFD, 0xEA, 0x98,
+    0x1D, 0x60, 0xF7, 0xD8, 0x4A, 0xCC, 0x9F, 0xEF, 0x21, 0xE6, 0xAF, 0xEA, 0xFD, 0xEC, 0x36, 0x49,
+    0xCD, 0xCC, 0xDB, 0x14, 0xB5, 0xC5, 0xDF, 0x93, 0x36, 0xE3, 0x61, 0x57, 0x72, 0x52, 0x89, 0x2C,
+    0x14, 0x4D, 0xB8, 0x34, 0xA1, 0x12, 0x2E, 0x60, 0x43, 0x31, 0xA3, 0x12, 0x66, 0xC0, 0x06, 0x16,
+    0x54, 0xC2, 0xF4, 0xD8, 0x90, 0xE1, 0x68, 0xD7, 0x62, 0x83, 0x1D, 0x50, 0x8B, 0x8C, 0x60, 0x65,
+    0x02, 0x35, 0x37, 0x2D, 0xD8, 0x97, 0x67, 0x50, 0x29, 0x13, 0x9D, 0x5C, 0x40, 0xA5, 0x42, 0xC0,
+    0x86, 0x2A, 0xFF, 0x59, 0xC4, 0xF6, 0x48, 0xDF, 0x48, 0xD4, 0xF2, 0x77, 0x22, 0x6B, 0x12, 0xDE,
+    0x27, 0xD6, 0x7C, 0xD3, 0x94, 0xA9, 0x99, 0x8D, 0xCF, 0x99, 0x12, 0xFE, 0x38, 0x6B, 0x7E, 0xC7,
+    0x77, 0x4F, 0xC9, 0xDF, 0x4B, 0xBD, 0xFC, 0xF9, 0x2C, 0xA3, 0x16, 0xDF, 0xE6, 0xE0, 0x59, 0x0E,
+    0xDB, 0x8F, 0x2B, 0x11, 0xE5, 0x81, 0x6F, 0x1B, 0x19, 0xB5, 0x48, 0xFF, 0x91, 0x6A, 0xEF, 0xBB,
+    0xD8, 0x39, 0x47, 0x82, 0x56, 0x9F, 0x5D, 0x49, 0x29, 0x76, 0x68, 0x7E, 0x22, 0xAF, 0xCA, 0xFF,
+    0x21, 0xCD, 0x8C, 0xF4, 0x7F, 0xA6, 0xE7, 0x77, 0x6B, 0xEE, 0x91, 0xB7, 0xB5, 0xCC, 0x88, 0x8C,
+    0xDB, 0x7C, 0xAA, 0x39, 0x63, 0x69, 0x65, 0xCC, 0xDF, 0x92, 0xB2, 0x71, 0x74, 0x2A, 0x0F, 0x85,
+    0x0B, 0x70, 0x1E, 0xDB, 0xA2, 0xA6, 0x6A, 0x00, 0xF3, 0xE3, 0x09, 0x70, 0xCB, 0xDD, 0x94, 0xA8,
+    0xF8, 0xD1, 0x1B, 0x37, 0x0A, 0xE5, 0x1D, 0x57, 0xB9, 0xAA, 0x23, 0xB3, 0x83, 0x65, 0xCC, 0xB4,
+    0xC7, 0xF4, 0x01, 0x8F, 0x9B, 0x0D, 0x23, 0xD0, 0x05, 0x0A, 0x09, 0x54, 0x4B, 0x66, 0x37, 0x9E,
+    0x38, 0xF2, 0x35, 0x56, 0x7A, 0x25, 0x92, 0xCA, 0xF9, 0x89, 0x64, 0x7A, 0x52, 0x1D, 0x48, 0xB6,
+    0x65, 0xB2, 0x81, 0x7F, 0xB6, 0x43, 0xA6, 0x21, 0x56, 0xE2, 0x51, 0x32, 0x42, 0x23, 0x9E, 0x52,
+    0x86, 0xAC, 0x17, 0xAA, 0x74, 0x02, 0x35, 0x9F, 0x85, 0xF9, 0x0A, 0xCC, 0x57, 0x29, 0x52, 0x83,
+    0x4E, 0x4D, 0x5F, 0xC7, 0x46, 0xA4, 0xAF, 0x65, 0x59, 0x97, 0x95, 0xBF, 0x82, 0xAA, 0xA7, 0x98,
+    0xC1, 0x05, 0xAA, 0x48, 0x31, 0xC1, 0x9F, 0x1E, 0x0D, 0x03, 0x17, 0x22, 0xBE, 0x91, 0xC9, 0xB4,
+    0xF5, 0x53, 0x23, 0x2F, 0x59, 0x5F, 0x16, 0x73, 0x9E, 0xFD, 0xDD, 0x4C, 0x21, 0x33, 0x4A, 0x46,
+    0x0A, 0x79, 0x39, 0x14, 0xE9, 0x2C, 0xE6, 0xE6, 0x40, 0x72, 0xDE, 0x3E, 0x23, 0x5D, 0xAC, 0x65,
+    0xBA, 0x9B, 0x50, 0x34, 0xE6, 0x3F, 0xB1, 0xE2, 0x39, 0xAC, 0x7B, 0x35, 0xE9, 0xA8, 0x7A, 0xFA,
+    0x0F, 0xAD, 0x95, 0x45, 0xB6, 0x43, 0x5C, 0xC4, 0x48, 0xAB, 0xA6, 0x99, 0xF3, 0x3A, 0x9A, 0x50,
+    0xF3, 0xD5, 0x15, 0x0C, 0xFB, 0x60, 0x5A, 0xF9, 0x7B, 0x6F, 0x85, 0xCF, 0x31, 0xFB, 0x2A, 0xAD,
+    0x73, 0x3A, 0xDD, 0x1D, 0x5B, 0x3B, 0x59, 0x6D, 0xD5, 0x32, 0x96, 0x22, 0xED, 0x54, 0x4C, 0xB5,
+    0xAF, 0x9E, 0x1E, 0xF9, 0xCF, 0x75, 0x0F, 0xD2, 0x53, 0x49, 0x4F, 0x2D, 0x3D, 0x56, 0x3C, 0x75,
+    0xFA, 0x34, 0xF5, 0xCD, 0x40, 0x3A, 0x8F, 0xB9, 0x39, 0xAA, 0xC9, 0xBD, 0x23, 0x85, 0x48, 0xCB,
+    0x5E, 0x86, 0x0D, 0x9B, 0x40, 0x29, 0x79, 0xA5, 0xB8, 0x0A, 0x26, 0x50, 0x46, 0xF8, 0x2C, 0x14,
+    0x70, 0xA1, 0x0A, 0x3A, 0xEA, 0x68, 0x42, 0x31, 0x3B, 0x4F, 0x33, 0x67, 0x56, 0x92, 0xEE, 0x3F,
+    0xB4, 0xE1, 0xBA, 0xC3, 0xC7, 0x8B, 0xA8, 0xA3, 0x09, 0x37, 0x68, 0xEA, 0x56, 0x49, 0xA4, 0x4A,
+    0x79, 0x49, 0xFF, 0xA0, 0x86, 0x6B, 0xB3, 0xC1, 0x2A, 0xE5, 0xD6, 0x9D, 0xEB, 0x77, 0xAE, 0xBF,
+    0x15, 0x55, 0xE2, 0xE0, 0x80, 0x0E, 0xFB, 0x30, 0x36, 0x94, 0xAF, 0xFA, 0x2A, 0x16, 0xFD, 0x16,
+    0xA3, 0x79, 0x20, 0x70, 0xF3, 0x5E, 0x4F, 0x8A, 0x87, 0x4A, 0xC4, 0x53, 0xDE, 0x5D, 0x0D, 0xF2,
+    0xA2, 0xD9, 0xF4, 0xDB, 0x58, 0x89, 0xDB, 0xBA, 0xD1, 0x19, 0x49, 0xEE, 0x37, 0xA0, 0xF7, 0x49,
+    0x38, 0x0F, 0xF5, 0x06, 0xD6, 0xDF, 0x15, 0xF9, 0x8E, 0xC8, 0x2F, 0xAF, 0xDF, 0x79, 0xFE, 0x37,
+    0x87, 0x02, 0x02, 0xD5, 0xED, 0xC7, 0x11, 0x09, 0x56, 0x02, 0x7B, 0x70, 0x02, 0x6C, 0xA4, 0x5C,
+    0x72, 0x6F, 0x0F, 0x2B, 0x75, 0x97, 0x6B, 0x2B, 0xA3, 0xD9, 0x65, 0xD0, 0xA7, 0x0E, 0xD0, 0xD5,
+    0x61, 0xC3, 0x67, 0xEE, 0xC2, 0x5D, 0x67, 0xFE, 0x08, 0xD1, 0x34, 0xB3, 0xE8, 0xDE, 0x5A, 0x5E,
+    0x58, 0x5E, 0x48, 0x07, 0x74, 0x58, 0x8B, 0x0D, 0xD5, 0xAD, 0xB6, 0x8A, 0xC5, 0xCF, 0x7B, 0x95,
+    0xF8, 0xFA, 0xEF, 0x2C, 0xB6, 0x8E, 0x95, 0xB5, 0xA2, 0x44, 0xFA, 0x9C, 0xF4, 0x95, 0x2D, 0x4C,
+    0x8F, 0x8E, 0x30, 0xC1, 0x39, 0x4E, 0xD4, 0x98, 0xFF, 0xDA, 0x96, 0x3F, 0x0A, 0xB9, 0xC9, 0x45,
+    0x27, 0xBF, 0x10, 0x99, 0x5F, 0x58, 0xF6, 0x7F, 0x73, 0x90, 0x24, 0xA2, 0x96, 0xBD, 0xD6, 0x49,
+    0xAC, 0x24, 0x72, 0xDA, 0xFF, 0x56, 0xE3, 0xA1, 0x78, 0xF2, 0x6D, 0x9F, 0x19, 0x1B, 0x7C, 0x5E,
+    0x9E, 0xFF, 0x2D, 0xC7, 0xC3, 0x7B, 0xEB, 0xE0, 0xBF, 0x5D, 0x9E, 0xB7, 0x22, 0xFF, 0xAE, 0x79,
+    0xD6, 0xBF, 0x4B, 0x07, 0x63, 0xFD, 0xB7, 0x00, 0x37, 0x9D, 0x65, 0x2D, 0x38, 0x84, 0x7E, 0x45,
+    0x02, 0xF0, 0xAD, 0xBA, 0x7D, 0x50, 0x2A, 0x99, 0x93, 0x48, 0x27, 0x3F, 0x94, 0x09, 0x27, 0xC3,
+    0xA5, 0x9E, 0xA2, 0xF3, 0x65, 0x24, 0x67, 0xBD, 0xA1, 0x23, 0x0D, 0xE4, 0x04, 0xE0, 0x35, 0xB7,
+    0xF4, 0xB7, 0xB9, 0xB0, 0x66, 0xA3, 0xBA, 0x16, 0x35, 0x61, 0x22, 0xCC, 0x14, 0x92, 0x8B, 0x4A,
+    0xDC, 0x7E, 0x7C, 0xAD, 0xC4, 0xE0, 0xC1, 0x66, 0xA8, 0xFD, 0xF4, 0x85, 0x2D, 0x37, 0x4D, 0x54,
+    0x00, 0x97, 0xCE, 0x81, 0xFE, 0x57, 0x09, 0x70, 0xD6, 0x4C, 0xC0, 0x91, 0x50, 0xFD, 0x5D, 0xC7,
+    0xA9, 0x6B, 0x2B, 0xA1, 0x9B, 0x0A, 0x89, 0x45, 0xD7, 0xEE, 0x2E, 0xE8, 0x89, 0x6A, 0xC0, 0xB5,
+    0x1C, 0xBE, 0xD7, 0x43, 0xDB, 0x72, 0x88, 0x4A, 0xD8, 0x81, 0x7A, 0xAC, 0x05, 0x3A, 0xF9, 0x95,
+    0x04, 0x25, 0x93, 0x4B, 0x1B, 0x72, 0xFA, 0xDE, 0xDE, 0x05, 0xC0, 0xC9, 0x9C, 0xA7, 0xC0, 0xDD,
+    0xB4, 0xBD, 0xFB, 0x5E, 0x99, 0x80, 0xD9, 0xC8, 0x80, 0xC8, 0x53, 0x9D, 0x67, 0x77, 0xFE, 0x1D,
+    0x65, 0xF8, 0x80, 0x0B, 0x7A, 0x84, 0x3A, 0xB0, 0x40, 0x35, 0xE0, 0x02, 0x7A, 0xA4, 0x4C, 0xB9,
+    0x5C, 0xC7, 0xEB, 0x4F, 0xE4, 0x7C, 0xBE, 0x79, 0xC3, 0x41, 0x23, 0x93, 0x8A, 0x1F, 0xDA, 0x7F,
+    0x8E, 0xCC, 0xE0, 0xE2, 0x5E, 0xD6, 0xF6, 0x87, 0x2D, 0xCB, 0x0D, 0x3F, 0xF1, 0x8F, 0x80, 0xDA,
+    0x57, 0x1E, 0xF4, 0xFC, 0x64, 0x26, 0xAF, 0xF6, 0x6C, 0x28, 0x8A, 0xF7, 0xA6, 0xE8, 0x63, 0x24,
+    0x61, 0xE5, 0x57, 0xB2, 0x60, 0x64, 0x3A, 0x33, 0xC2, 0xA5, 0xFE, 0x03, 0x1C, 0xA8, 0xEB, 0x05,
+    0xE7, 0x29, 0x12, 0x66, 0x80, 0x43, 0x74, 0x4E, 0x81, 0x6C, 0x02, 0x2E, 0x60, 0x96, 0xBD, 0x35,
+    0xBD, 0xAD, 0xDF, 0x7A, 0x6C, 0x3B, 0x77, 0x49, 0x1F, 0x2A, 0x10, 0xC0, 0x71, 0x0E, 0xB4, 0x5C,
+    0xDF, 0x80, 0xF7, 0x99, 0xCF, 0xFB, 0x87, 0x91, 0xF1, 0x45, 0xB6, 0x7C, 0x1E, 0x75, 0x67, 0x02,
+    0x18, 0x6B, 0x80, 0xB3, 0x3A, 0x00, 0xE6, 0x91, 0x78, 0xF7, 0x82, 0x9B, 0x56, 0xFA, 0xFA, 0xFA,
+    0xD2, 0x22, 0x54, 0x32, 0x8B, 0xB4, 0x5A, 0x96, 0xDD, 0x19, 0xCE, 0x8C, 0x1F, 0xA4, 0x8C, 0xF3,
+    0x05, 0xD3, 0x43, 0x83, 0x9E, 0xC0, 0xB6, 0x08, 0x98, 0x9E, 0x3A, 0x62, 0x22, 0x5A, 0x9E, 0xBD,
+    0x94, 0x8B, 0x9A, 0x8C, 0xAC, 0x09, 0x3E, 0x47, 0x29, 0xC3, 0x98, 0x09, 0xD0, 0x32, 0x00, 0x2F,
+    0x59, 0xC0, 0xF8, 0x11, 0x18, 0x0D, 0x60, 0x5E, 0x8E, 0x40, 0x33, 0xB3, 0xC9, 0xC5, 0xFD, 0x83,
+    0x0C, 0x6C, 0xFE, 0x88, 0xCF, 0x02, 0x75, 0xEB, 0x80, 0x7A, 0x70, 0x01, 0xEA, 0xE8, 0xFA, 0x0D,
+    0x2A, 0x51, 0x07, 0xE7, 0x41, 0xF9, 0x4F, 0x1C, 0x1F, 0x16, 0x1F, 0x59, 0xA1, 0xFF, 0x59, 0x01,
+    0x94, 0x61, 0x02, 0xE6, 0x3A, 0x80, 0xBD, 0x39, 0x81, 0x8E, 0x0D, 0x70, 0xC3, 0x04, 0x30, 0x3E,
+    0x02, 0x27, 0x4F, 0x1C, 0x6B, 0xCD, 0x9F, 0x4F, 0x74, 0xB1, 0x92, 0xB6, 0x16, 0xCE, 0x4C, 0x5C,
+    0x7A, 0x7F, 0x92, 0x76, 0x2D, 0x87, 0xA8, 0x2C, 0xF4, 0xA0, 0x16, 0x0A, 0x79, 0x24, 0x13, 0x5B,
+    0x9B, 0x84, 0x95, 0x67, 0x24, 0x70, 0xDA, 0xEF, 0x7C, 0x04, 0xD5, 0xD7, 0xBF, 0x4D, 0x77, 0x49,
+    0x0C, 0xDC, 0x38, 0x12, 0x28, 0xA9, 0x6E, 0xFB, 0xBB, 0x44, 0xC4, 0x6A, 0xFC, 0x10, 0xC6, 0xA4,
+    0x4D, 0x14, 0x17, 0xF3, 0x3D, 0x58, 0xD8, 0x98, 0xEF, 0x57, 0x01, 0xCA, 0xDB, 0x7E, 0x0B, 0x13,
+    0x77, 0xC7, 0x35, 0x58, 0xB3, 0xD5, 0x61, 0x61, 0x33, 0x28, 0x57, 0xC7, 0xDD, 0x7C, 0x6F, 0x55,
+    0x19, 0xCE, 0x5F, 0xCD, 0x07, 0x7F, 0xB1, 0x16, 0x55, 0xBC, 0xDF, 0xAA, 0xC8, 0x74, 0x7E, 0x71,
+    0x32, 0xE2, 0xD0, 0xB2, 0x94, 0xE2, 0x71, 0x50, 0xF7, 0x2C, 0xD0, 0xB4, 0xD4, 0x01, 0x81, 0x2E,
+    0x60, 0x5B, 0x3A, 0x90, 0x4C, 0x9E, 0xF4, 0x85, 0xF4, 0x38, 0x70, 0xAD, 0x7A, 0x27, 0x72, 0x15,
+    0x6C, 0xD0, 0xBF, 0x8A, 0xDC, 0x80, 0x3A, 0xE8, 0xD7, 0xC6, 0x5C, 0x92, 0xB1, 0x7C, 0x65, 0x2A,
+    0x26, 0xA8, 0x06, 0xF3, 0x72, 0x52, 0x23, 0x94, 0xD1, 0xB4, 0xB3, 0x8E, 0xA0, 0xC7, 0x9A, 0x43,
+    0x3D, 0x80, 0x9A, 0x2C, 0x4D, 0xD9, 0x43, 0x91, 0xCE, 0xE3, 0x72, 0x3A, 0xEF, 0x15, 0xEC, 0x97,
+    0x03, 0x30, 0x1F, 0x50, 0x7F, 0xC7, 0x03, 0x57, 0x27, 0xCC, 0x0F, 0x01, 0xDC, 0x98, 0x33, 0xBB,
+    0x70, 0xD9, 0x34, 0x86, 0x7A, 0x58, 0x43, 0x14, 0x66, 0x63, 0xF0, 0xDD, 0xC3, 0xEB, 0x5E, 0xCD,
+    0xF3, 0x4D, 0xFD, 0xA6, 0xD5, 0x50, 0x46, 0xBF, 0x95, 0x53, 0xF2, 0xA3, 0x03, 0x50, 0x63, 0x16,
+    0xF8, 0x9F, 0xDD, 0x9F, 0x88, 0x5E, 0xCA, 0x44, 0x2C, 0x64, 0x92, 0x99, 0x2B, 0x34, 0x4B, 0x35,
+    0x66, 0xA6, 0xF5, 0x8C, 0x89, 0x5C, 0xC5, 0xB5, 0xE5, 0x8C, 0xF5, 0x65, 0x54, 0xD2, 0x9A, 0x40,
+    0xE2, 0x9D, 0xA8, 0x07, 0x5C, 0x7B, 0x79, 0x56, 0x91, 0x32, 0xDA, 0xBA, 0x4D, 0x90, 0xCC, 0x63,
+    0xF1, 0x1C, 0xD8, 0x2F, 0x85, 0x1B, 0x35, 0x94, 0x3F, 0x1E, 0xEA, 0xBF, 0x6F, 0x21, 0x8D, 0xFA,
+    0x17, 0x3D, 0xD8, 0x03, 0x0E, 0x23, 0xE8, 0x85, 0x7A, 0x02, 0xC4, 0xEB, 0x39, 0x9B, 0xA1, 0xDD,
+    0xFD, 0x55, 0x24, 0xEE, 0x16, 0x11, 0x70, 0x02, 0x39, 0x9B, 0x77, 0xED, 0xE1, 0x17, 0xF9, 0xFA,
+    0x47, 0xAE, 0x40, 0xCE, 0x0A, 0x9A, 0xCC, 0x80, 0xCA, 0xB9, 0x0C, 0x01, 0xCC, 0xAB, 0x11, 0xEC,
+    0xA3, 0x23, 0x5C, 0x61, 0x82, 0xCF, 0x1E, 0x93, 0xF8, 0x1F, 0xB6, 0xB0, 0xC3, 0x26, 0x61, 0x7A,
+    0x06, 0xB5, 0x94, 0x09, 0xAA, 0xA9, 0x1E, 0xC0, 0xB4, 0xF6, 0x01, 0xF3, 0xA6, 0x93, 0x68, 0xE4,
+    0x2D, 0x91, 0xD6, 0xC9, 0xCB, 0x5D, 0x4F, 0x35, 0xD2, 0x78, 0x1C, 0x08, 0xC5, 0x44, 0x31, 0x63,
+    0x02, 0x2A, 0xE5, 0x3C, 0x6F, 0x1D, 0xA1, 0x8A, 0xB5, 0x07, 0x33, 0x24, 0xA0, 0xBE, 0x15, 0xB6,
+    0x15, 0xD1, 0x72, 0x26, 0x7F, 0xE7, 0x7F, 0x0D, 0xCD, 0xF9, 0xDE, 0xD3, 0xFF, 0x7D, 0x6B, 0xCE,
+    0xAE, 0xF9, 0x6D, 0xF8, 0x15, 0x00, 0xAE, 0xFB, 0xEC, 0x51, 0x97, 0xE2, 0x33, 0xF8, 0xBB, 0x73,
+    0x7C, 0x38, 0xC8, 0xE8, 0x44, 0xE4, 0xA6, 0xEC, 0x5F, 0x4F, 0x0E, 0x3A, 0xDD, 0x53, 0xF7, 0x67,
+    0xD1, 0x53, 0xD1, 0x66, 0x36, 0x52, 0x7F, 0x84, 0x7A, 0x67, 0xC3, 0x4A, 0xDA, 0x3F, 0xF6, 0x66,
+    0xC9, 0xF1, 0xF6, 0x4F, 0x57, 0x23, 0xFA, 0xBB, 0x0B, 0x9C, 0x73, 0x81, 0xEA, 0x5F, 0xEE, 0xEC,
+    0xEF, 0xA7, 0x4E, 0x44, 0x5E, 0xDD, 0x50, 0x89, 0x80, 0xCF, 0x65, 0xDA, 0x8B, 0xC9, 0x9C, 0x3A,
+    0xBD, 0x62, 0x70, 0xF1, 0x1E, 0xF5, 0xB9, 0x18, 0x91, 0x74, 0x7E, 0xEF, 0xC9, 0x1F, 0x45, 0xA4,
+    0x6C, 0xAB, 0xF8, 0xF1, 0x0D, 0x1A, 0xEC, 0x5A, 0x54, 0x02, 0x1B, 0x28, 0x66, 0x30, 0x03, 0xFD,
+    0x42, 0xF5, 0x77, 0x91, 0x73, 0xCD, 0xDE, 0x57, 0x7E, 0xB5, 0x7A, 0xB3, 0x79, 0x82, 0x7F, 0x0B,
+    0x68, 0x02, 0x94, 0x69, 0x3D, 0x28, 0xEE, 0xE1, 0xC6, 0x63, 0x45, 0xE4, 0x31, 0x11, 0x49, 0xEE,
+    0xCE, 0xBE, 0xDC, 0x8C, 0x54, 0xF1, 0x1C, 0xC5, 0xAC, 0x03, 0xAE, 0xFD, 0x14, 0x26, 0xAE, 0x83,
+    0xDB, 0xB5, 0xF9, 0x6E, 0x55, 0x5A, 0xD3, 0x02, 0x8E, 0xBF, 0xC9, 0xF5, 0x76, 0x8A, 0xD0, 0x79,
+    0xCE, 0xD5, 0x03, 0xFA, 0xB5, 0x04, 0x37, 0xBA, 0xFD, 0xFD, 0xEB, 0xB7, 0x44, 0x24, 0x35, 0xB9,
+    0x16, 0xDB, 0xCA, 0xED, 0xEA, 0x5A, 0xD4, 0x92, 0x25, 0x56, 0xDC, 0xB3, 0xD0, 0xCA, 0x20, 0x22,
+    0x37, 0x5F, 0xDF, 0x5B, 0x6A, 0x4C, 0xFC, 0x06, 0x1D, 0xD7, 0xCA, 0x2C, 0x1A, 0x3D, 0x81, 0x0D,
+    0xA8, 0x4C, 0xB4, 0x61, 0xE1, 0x8F, 0xCD, 0xC0, 0x4B, 0x1D, 0xFA, 0x07, 0x6F, 0xEF, 0x35, 0xCD,
+    0xD1, 0x52, 0x37, 0x9E, 0x0B, 0x9C, 0xC3, 0x7A, 0x3D, 0x55, 0x43, 0x86, 0x6D, 0xDD, 0xB2, 0xC9,
+    0x34, 0x8F, 0x7F, 0xA0, 0xFE, 0x56, 0xEC, 0xFA, 0xF3, 0x5C, 0xE5, 0xC6, 0x5D, 0x60, 0xB6, 0xB8,
+    0x17, 0x98, 0xFD, 0x60, 0xFA, 0x9B, 0x87, 0xAE, 0xA1, 0x24, 0x61, 0xDE, 0x11, 0x6C, 0x7B, 0x1E,
+    0xC7, 0xC7, 0x38, 0x5C, 0x75, 0xF7, 0xFC, 0xBB, 0xFF, 0xD6, 0x92, 0x56, 0x75, 0xF8, 0xAD, 0x72,
+    0xB0, 0xBD, 0x0B, 0x2E, 0xD8, 0xB6, 0x06, 0xFA, 0xAA, 0x6F, 0x1E, 0x9B, 0xEC, 0xCB, 0x53, 0xD9,
+    0xE6, 0x45, 0xAD, 0x03, 0x09, 0x5A, 0x86, 0xEA, 0xB5, 0xD1, 0xB4, 0xC9, 0x71, 0xF9, 0x53, 0x9C,
+    0x2A, 0xA0, 0x8E, 0x67, 0x5D, 0xBA, 0x7C, 0xBE, 0x49, 0x67, 0xEB, 0xE9, 0x84, 0xBA, 0xF6, 0xD0,
+    0xFE, 0x73, 0x4E, 0x52, 0xB3, 0xF1, 0xDE, 0xCE, 0xF2, 0x47, 0x8E, 0xB3, 0xEE, 0x8D, 0xC9, 0x48,
+    0x2C, 0xC4, 0xD7, 0x8F, 0x25, 0x77, 0x33, 0xED, 0x70, 0x9A, 0x53, 0xCD, 0x23, 0x73, 0xF7, 0xF4,
+    0xD2, 0x14, 0xF3, 0x09, 0x4E, 0x16, 0x17, 0x91, 0xD1, 0x5D, 0xBF, 0xD9, 0xDF, 0x38, 0x5B, 0xF6,
+    0x24, 0x1A, 0x9C, 0x2F, 0x86, 0xBC, 0x92, 0x36, 0x43, 0x2D, 0xCF, 0x0C, 0x07, 0x67, 0xCB, 0x9B,
+    0xFD, 0x59, 0x57, 0xBD, 0x2C, 0x63, 0x35, 0x03, 0xB4, 0xA7, 0x54, 0x3C, 0xAF, 0x63, 0x53, 0x0D,
+    0xB3, 0x79, 0x65, 0xB2, 0x3A, 0x9E, 0x2D, 0x03, 0x05, 0xA7, 0xF8, 0xEC, 0x65, 0x92, 0x53, 0x63,
+    0xFD, 0xEA, 0x50, 0x49, 0x50, 0xB2, 0x32, 0x7F, 0x4F, 0x29, 0x0E, 0x4C, 0x3B, 0x9B, 0xD0, 0x54,
+    0x83, 0x7D, 0x26, 0x9A, 0x30, 0xE9, 0xFE, 0x2C, 0x1E, 0x4E, 0xA1, 0xA4, 0xAF, 0x65, 0x72, 0xFF,
+    0x3E, 0x7D, 0x91, 0x83, 0x3F, 0xE3, 0xB3, 0xAA, 0x3D, 0xA8, 0x1F, 0x8B, 0x57, 0xAB, 0xA1, 0x2B,
+    0x53, 0xDD, 0xFE, 0x49, 0x39, 0xB9, 0x90, 0x4C, 0x98, 0xAC, 0x1E, 0x5E, 0x82, 0xDD, 0x47, 0x67,
+    0x77, 0x33, 0x3A, 0x15, 0x4D, 0x7B, 0xA0, 0x06, 0x38, 0xE7, 0xDC, 0xB9, 0xCB, 0xDF, 0xF8, 0xCF,
+    0x27, 0x2B, 0x9F, 0x4C, 0x9F, 0xDC, 0x97, 0xFA, 0xAF, 0x02, 0x6A, 0x72, 0x37, 0x93, 0x6D, 0x79,
+    0x98, 0x97, 0xBA, 0x47, 0x96, 0xEE, 0xD1, 0xC5, 0x65, 0x73, 0xCB, 0xD7, 0xE3, 0xF9, 0x83, 0x97,
+    0x1E, 0x7E, 0xE9, 0xE1, 0x2B, 0x57, 0xEC, 0xB4, 0xEB, 0xD1, 0x93, 0x0D, 0xC9, 0xBC, 0x3C, 0x9E,
+    0x57, 0xFE, 0x58, 0xED, 0xD6, 0x93, 0x65, 0xB0, 0x9C, 0xE7, 0x2A, 0xCD, 0x37, 0xDD, 0x5C, 0x4E,
+    0x5A, 0x44, 0xE4, 0x0D, 0xFE, 0x04, 0xC4, 0x17, 0xD2, 0xEB, 0x5F, 0x45, 0x13, 0x92, 0xE3, 0xF2,
+    0x09, 0x4E, 0x9E, 0xE2, 0x63, 0xE7, 0xF8, 0x82, 0x6B, 0x0F, 0xAC, 0x8C, 0x95, 0xF4, 0xFC, 0x27,
+    0x0A, 0x7F, 0xA4, 0x43, 0xCC, 0x74, 0xA2, 0xB8, 0x76, 0x7A, 0xEF, 0xA2, 0x93, 0x79, 0xED, 0x90,
+    0xFB, 0x5A, 0x0B, 0x01, 0x15, 0xD1, 0x91, 0x6A, 0xC0, 0x04, 0x2C, 0x7C, 0x01, 0xE0, 0x4F, 0xF8,
+    0x0F, 0xDD, 0x23, 0xCB, 0xB6, 0x83, 0xFE, 0x63, 0x15, 0x0E, 0xAA, 0xA1, 0xF9, 0xF1, 0xBA, 0xD8,
+    0x8D, 0x9B, 0xF2, 0x3E, 0x26, 0x01, 0xB9, 0x3C, 0x66, 0xBA, 0xA7, 0xA4, 0xCD, 0x87, 0x9B, 0x15,
+    0xDA, 0xC8, 0x9A, 0x80, 0x28, 0x12, 0xAA, 0x3B, 0xD7, 0xEF, 0x5C, 0x8F, 0x2A, 0xEA, 0x91, 0x89,
+    0x03, 0x66, 0xCE, 0xF3, 0x30, 0xCE, 0x1B, 0x5F, 0x7A, 0xD3, 0x17, 0x7E, 0x93, 0x46, 0x95, 0x07,
+    0x06, 0xEE, 0xDF, 0x5D, 0xCC, 0x58, 0xD4, 0x4F, 0xB3, 0xA9, 0xDC, 0xC2, 0xF2, 0x48, 0x37, 0x81,
+    0xF3, 0x85, 0x78, 0x4C, 0x4F, 0x3D, 0xA0, 0x47, 0x74, 0xCA, 0x31, 0x93, 0x1C, 0x77, 0xEA, 0x31,
+    0x3D, 0x7A, 0x44, 0x8F, 0x90, 0x28, 0x16, 0x4F, 0x43, 0x25, 0x33, 0x75, 0x28, 0x45, 0x7C, 0x35,
+    0xDC, 0xCD, 0xD6, 0xCA, 0x82, 0xC9, 0x41, 0x30, 0xB5, 0x00, 0xC5, 0x13, 0x39, 0xE6, 0x34, 0x03,
+    0xEC, 0x3E, 0xB7, 0x55, 0x68, 0x71, 0xAD, 0xE9, 0x20, 0x9E, 0x52, 0x7C, 0x66, 0xAB, 0x5D, 0x38,
+    0x8E, 0x69, 0xBE, 0x23, 0x22, 0xE9, 0xC9, 0x3B, 0xD7, 0x45, 0x25, 0xEA, 0xB6, 0xCB, 0x1C, 0xC2,
+    0xB1, 0x8A, 0x9C, 0x53, 0x89, 0xDD, 0x5C, 0x48, 0x34, 0x64, 0x69, 0x65, 0xB6, 0xC3, 0x6F, 0x3E,
+    0xE1, 0x29, 0x45, 0x5A, 0x75, 0x97, 0x47, 0xA0, 0x44, 0x3C, 0xB5, 0xC8, 0x48, 0xF7, 0xFA, 0xA5,
+    0x51, 0xCD, 0xA8, 0xB1, 0x1C, 0x29, 0x46, 0x33, 0xC0, 0x58, 0x07, 0x88, 0xB6, 0x85, 0x0B, 0xCE,
+    0x6F, 0x3C, 0x87, 0x66, 0xBF, 0xEB, 0x69, 0x44, 0x7A, 0x1A, 0x91, 0x36, 0xEB, 0xEF, 0xC6, 0x6F,
+    0x08, 0xC8, 0x99, 0x72, 0xDF, 0xC3, 0x17, 0xEB, 0x08, 0x57, 0xAA, 0x44, 0x31, 0x6B, 0xB9, 0x76,
+    0x26, 0xD1, 0x89, 0x8C, 0x39, 0x23, 0x94, 0xBD, 0x0B, 0x1F, 0x0A, 0x68, 0xFF, 0x01, 0xA4, 0x40,
+    0x38, 0x7F, 0xA3, 0x79, 0x4A, 0x9A, 0xA7, 0xC4, 0xAE, 0xCE, 0xD3, 0x07, 0x96, 0xAB, 0x92, 0xAD,
+    0xD7, 0x89, 0x27, 0xC7, 0xDF, 0x99, 0xCC, 0x9F, 0x0B, 0x47, 0x30, 0x43, 0x1D, 0xD0, 0x13, 0x08,
+    0x74, 0x3D, 0x6E, 0xCC, 0x8C, 0xF6, 0x0D, 0x01, 0x7A, 0xAD, 0xAB, 0xCA, 0x93, 0x77, 0xAE, 0xE7,
+    0x72, 0xB5, 0x2B, 0xF1, 0xEA, 0x20, 0x1B, 0x90, 0x2A, 0xAA, 0x4C, 0x93, 0x0E, 0x79, 0x38, 0xBB,
+    0xF5, 0xF2, 0x94, 0x2F, 0xEB, 0x41, 0x2D, 0xCF, 0xE6, 0x5A, 0xBE, 0x22, 0x03, 0x5C, 0x59, 0xCB,
+    0x6F, 0x44, 0x0E, 0xB9, 0x14, 0xA9, 0x82, 0x9A, 0xA8, 0x7B, 0x5C, 0x46, 0xFF, 0x8A, 0x31, 0x7B,
+    0x52, 0x55, 0xC8, 0xCE, 0xA0, 0x43, 0x4D, 0x54, 0x51, 0x8D, 0x54, 0x03, 0xEE, 0xFF, 0xB4, 0x01,
+    0xDB, 0xEA, 0xD4, 0x24, 0x90, 0xBD, 0xEE, 0x7B, 0xD2, 0xD3, 0x89, 0xCC, 0xE5, 0x8C, 0x16, 0x59,
+    0xFC, 0xAE, 0xDF, 0x58, 0xCA, 0x83, 0xC9, 0x41, 0xD9, 0xDE, 0xC8, 0x0C, 0x9F, 0x9C, 0x29, 0x9A,
+    0x76, 0x8D, 0xA8, 0xF9, 0xDF, 0x62, 0x2F, 0x22, 0x22, 0xB7, 0xD7, 0xBD, 0xF4, 0x6A, 0xDE, 0xDB,
+    0x6B, 0xFE, 0xA1, 0x9B, 0xF2, 0x75, 0x9D, 0xD6, 0xCF, 0xCD, 0xEB, 0x7E, 0x79, 0xF0, 0xBE, 0x58,
+    0xAF, 0x97, 0x49, 0xCD, 0xE0, 0x9E, 0x6D, 0x62, 0x23, 0xB1, 0xCC, 0x64, 0xD7, 0x68, 0x8E, 0x96,
+    0xE9, 0x68, 0xEE, 0xA6, 0x1C, 0x26, 0xF2, 0x2A, 0x85, 0xC5, 0x79, 0xD3, 0xAE, 0xCB, 0x94, 0x1A,
+    0xF4, 0xC8, 0xC8, 0x66, 0x9D, 0x5A, 0x3D, 0xF3, 0x75, 0xA1, 0xD2, 0xE3, 0xCE, 0x85, 0xBC, 0x52,
+    0x25, 0x36, 0xF5, 0x74, 0x91, 0x6F, 0x9E, 0xC9, 0xB1, 0xB7, 0x32, 0x87, 0xDF, 0xCC, 0x00, 0xCE,
+    0xE3, 0x5A, 0x98, 0x37, 0x86, 0x68, 0x2E, 0xC2, 0x42, 0x15, 0xC1, 0x79, 0x6C, 0xA0, 0x58, 0x40,
+    0x3C, 0x9D, 0x04, 0x2B, 0x7D, 0x29, 0x52, 0x1C, 0xCD, 0xE1, 0x3A, 0x7B, 0xD7, 0xFF, 0x97, 0xB0,
+    0xCD, 0x63, 0x5C, 0xB8, 0xAF, 0x8A, 0x14, 0x85, 0x48, 0xD0, 0x53, 0x25, 0x0B, 0x2E, 0xEE, 0x88,
+    0x57, 0x12, 0x54, 0xA2, 0xFE, 0x3E, 0x55, 0x24, 0x81, 0x0D, 0x65, 0x0F, 0x1D, 0xE7, 0x41, 0xA5,
+    0x22, 0x42, 0x15, 0x4D, 0x0B, 0x36, 0x1C, 0x6C, 0x40, 0x54, 0x25, 0x12, 0xA0, 0x8A, 0xAE, 0x05,
+    0x1B, 0x1A, 0xA0, 0x43, 0x40, 0xA5, 0x62, 0x86, 0x2A, 0x66, 0xF3, 0x48, 0x27, 0xE8, 0xA8, 0x26,
+    0x54, 0xC2, 0x8C, 0x54, 0x23, 0x66, 0x2C, 0x45, 0xA8, 0x47, 0x2B, 0x29, 0xBB, 0x8F, 0xEC, 0x6E,
+    0xEF, 0x7E, 0xAD, 0x07, 0x9F, 0x2D, 0xA7, 0xCC, 0xFA, 0x5D, 0x29, 0xC0, 0x6B, 0x41, 0x63, 0x4E,
+    0x70, 0x7F, 0x22, 0x69, 0xFD, 0xEB, 0x13, 0x49, 0x65, 0x13, 0xAE, 0xB5, 0x01, 0x23, 0xA8, 0x9C,
+    0x8C, 0x63, 0x03, 0x73, 0x83, 0x4A, 0xB8, 0x2F, 0x45, 0x6C, 0x30, 0x7D, 0x83, 0x4A, 0x7A, 0x2C,
+    0x23, 0x36, 0xCC, 0x34, 0xA8, 0xE4, 0x7C, 0x19, 0xB1, 0xDF, 0xE9, 0x69, 0x50, 0x32, 0x52, 0x66,
+    0xE6, 0x65, 0x83, 0x92, 0x96, 0x32, 0x62, 0x87, 0x07, 0x24, 0x92, 0x0E, 0x74, 0x72, 0x2B, 0xDF,
+    0x0E, 0x2A, 0x14, 0x03, 0x54, 0xBD, 0x1A, 0xA1, 0x8A, 0x65, 0x04, 0x2D, 0xDD, 0x00, 0x74, 0x72,
+    0x97, 0x03, 0x73, 0xD4, 0x87, 0x8C, 0x5A, 0x96, 0x4E, 0xA2, 0x96, 0xB9, 0x9A, 0xC1, 0xF6, 0x6A,
+    0x06, 0xEB, 0x73, 0x2E, 0x07, 0x0D, 0xDC, 0x00, 0xD7, 0x92, 0xA0, 0x0E, 0xD9, 0x03, 0xD6, 0x11,
+    0xCA, 0x58, 0xF6, 0xA0, 0xA7, 0x4C, 0x51, 0xAC, 0x3D, 0xB0, 0x58, 0x80, 0xE6, 0xCA, 0x5D, 0x9A,
+    0x5E, 0xCE, 0x22, 0xCF, 0xC4, 0xBE, 0x1C, 0x66, 0x33, 0x01, 0xF8, 0x4B, 0x0B, 0x70, 0xF5, 0x10,
+    0xA0, 0xCB, 0xF5, 0xF1, 0x07, 0x80, 0x87, 0xD6, 0x99, 0x5A, 0x8A, 0x58, 0x19, 0x55, 0x16, 0xEA,
+    0x27, 0xE7, 0x75, 0x61, 0x5A, 0x6D, 0xDE, 0xBC, 0x50, 0x65, 0xF3, 0xFF, 0x83, 0xBF, 0xB0, 0x3C,
+    0xFB, 0x78, 0xD7, 0xD7, 0xB2, 0x0D, 0x02, 0x4A, 0x5C, 0xF5, 0x50, 0xCE, 0x54, 0xDE, 0xD0, 0x80,
+    0xAF, 0x6C, 0xA2, 0x75, 0x6C, 0x9F, 0x1D, 0xF2, 0xCF, 0xC7, 0x07, 0x78, 0xC8, 0x34, 0x92, 0xCE,
+    0xE7, 0x21, 0x25, 0xAB, 0x06, 0xBD, 0xFC, 0x81, 0x17, 0x93, 0xB9, 0x48, 0x7E, 0x6A, 0x47, 0x29,
+    0xC7, 0x92, 0x37, 0xAE, 0xDF, 0xD9, 0xF7, 0xF9, 0xE9, 0x1D, 0x77, 0x2B, 0x4F, 0x45, 0xA0, 0x7E,
+    0xF9, 0xFF, 0xF5, 0x34, 0xB9, 0xBE, 0xA1, 0x84, 0x72, 0x79, 0x44, 0xDA, 0xBA, 0x47, 0x68, 0x72,
+    0x69, 0x4A, 0x3D, 0x96, 0x11, 0x33, 0xD4, 0x01, 0xD7, 0x36, 0xB0, 0x14, 0x09, 0x3D, 0x6D, 0x4F,
+    0xF9, 0x06, 0xE6, 0x5A, 0x82, 0x8E, 0x22, 0xB9, 0x2B, 0x1B, 0x40, 0x8D, 0x9B, 0x8E, 0x3D, 0x5C,
+    0x7B, 0x7B, 0x47, 0xFC, 0x5A, 0xC8, 0xFC, 0xDB, 0x2B, 0x55, 0x27, 0x0F, 0x1C, 0x90, 0xFC, 0x01,
+    0x07, 0x1C, 0x63, 0x1F, 0x56, 0xEB, 0xE3, 0x1F, 0xCA, 0xDB, 0x4F, 0x44, 0xD3, 0x57, 0xC1, 0xF9,
+    0x9A, 0x99, 0x2F, 0xEA, 0x91, 0xF6, 0x5D, 0xD8, 0x3C, 0x13, 0x74, 0x12, 0xAA, 0x1C, 0xAF, 0xBA,
+    0x08, 0x22, 0xDE, 0x8A, 0x3C, 0x3A, 0x21, 0x75, 0x4B, 0x4A, 0xA8, 0xD7, 0x56, 0x36, 0xCF, 0xE1,
+    0xD7, 0x9E, 0x57, 0x22, 0xB1, 0xBA, 0xB3, 0xDF, 0xDE, 0x53, 0xD1, 0x44, 0xCB, 0xB3, 0xFF, 0x5B,
+    0x29, 0x32, 0xAA, 0x4D, 0x79, 0x9A, 0x0F, 0x80, 0x80, 0xF0, 0x01, 0xE5, 0x67, 0xEE, 0x70, 0xCA,
+    0xB5, 0xD2, 0x04, 0x71, 0xED, 0xB2, 0x73, 0x24, 0xF7, 0x60, 0x57, 0xBC, 0x11, 0xBF, 0x2B, 0x1E,
+    0xF7, 0x9B, 0x7F, 0x4A, 0x49, 0x46, 0x12, 0x3B, 0xE8, 0x44, 0x13, 0xCA, 0xB4, 0xE6, 0xA3, 0x6D,
+    0xD2, 0xEF, 0x2A, 0x69, 0xCF, 0x4C, 0xD8, 0x56, 0xFD, 0xE6, 0x8D, 0x9E, 0x70, 0xBE, 0x8A, 0x6A,
+    0x2E, 0xA4, 0xED, 0x7A, 0x75, 0x8D, 0x22, 0x17, 0x0D, 0xAA, 0xB3, 0xE5, 0x7B, 0xE6, 0xFB, 0x8D,
+    0x07, 0x2E, 0xEB, 0x08, 0x94, 0xC1, 0xB1, 0x7D, 0x53, 0xB5, 0x6E, 0xCF, 0xC3, 0xA4, 0x45, 0x7A,
+    0x8C, 0x77, 0xEF, 0x88, 0x27, 0xEA, 0xA8, 0x12, 0x35, 0x0E, 0x13, 0x54, 0xD4, 0x91, 0xC4, 0x39,
+    0x1C, 0xE6, 0x95, 0x2A, 0xE8, 0x48, 0x6A, 0x46, 0x9C, 0x6F, 0xBE, 0x24, 0x58, 0x91, 0xA1, 0x09,
+    0x95, 0xC8, 0xB0, 0xC6, 0x6F, 0x3A, 0x79, 0x44, 0x16, 0x2A, 0x89, 0xB5, 0xF4, 0x94, 0x63, 0xAE,
+    0xE8, 0xE6, 0x57, 0x16, 0x89, 0x09, 0xF7, 0xBE, 0xD9, 0xDF, 0x17, 0xE9, 0xF3, 0x93, 0x69, 0x82,
+    0x7B, 0xF6, 0xF1, 0x54, 0x2C, 0x7A, 0xC4, 0x84, 0x32, 0x3A, 0x4F, 0xC2, 0xE9, 0x11, 0x13, 0x74,
+    0x7E, 0x73, 0x55, 0x8F, 0x98, 0x60, 0x5F, 0x91, 0xA9, 0x12, 0x19, 0x3B, 0x79, 0xEA, 0x2E, 0x40,
+    0xF3, 0xEE, 0xC9, 0xE3, 0xDF, 0xCE, 0x60, 0xC5, 0x83, 0x1E, 0x93, 0xB3, 0x7B, 0x1B, 0xEA, 0x5B,
+    0x32, 0x51, 0x88, 0x48, 0x4F, 0x3D, 0x17, 0x42, 0xB1, 0x50, 0xE5, 0xE4, 0x71, 0x7E, 0xCB, 0xE4,
+    0xF1, 0x95, 0x3D, 0x91, 0x17, 0xDD, 0x4D, 0x51, 0xDD, 0x66, 0x5B, 0x62, 0xF7, 0xDE, 0x67, 0x53,
+    0x54, 0x32, 0xEA, 0xC9, 0x4A, 0x70, 0xB1, 0x1C, 0xD5, 0x6D, 0x6F, 0x42, 0xED, 0x71, 0x4C, 0x90,
+    0xCA, 0x80, 0x8E, 0xE7, 0xC0, 0xBC, 0x19, 0xD7, 0x6A, 0x24, 0x73, 0x1D, 0xD0, 0xD1, 0x79, 0x4C,
+    0x70, 0xE4, 0x1A, 0x5B, 0x89, 0x05, 0x1D, 0x8B, 0x99, 0x6E, 0x56, 0x73, 0x25, 0xA3, 0x5A, 0x8E,
+    0x16, 0xDA, 0x08, 0xDB, 0x90, 0x80, 0x6B, 0x37, 0x75, 0x9D, 0x32, 0x3E, 0x97, 0x21, 0xB8, 0x2F,
+    0xDC, 0x1F, 0x20, 0x94, 0x59, 0xC9, 0xDC, 0x09, 0x9D, 0x14, 0x33, 0x45, 0xC2, 0x41, 0x87, 0x09,
+    0x74, 0x41, 0x47, 0xBA, 0x48, 0xE2, 0x46, 0xC2, 0x91, 0x1A, 0x4C, 0x48, 0x75, 0xD0, 0x31, 0x95,
+    0x91, 0x79, 0x2A, 0x12, 0x6E, 0xA2, 0xC1, 0x4C, 0xD4, 0x41, 0x4F, 0x94, 0x91, 0x44, 0x91, 0x94,
+    0x8C, 0x5A, 0x7E, 0x29, 0xB3, 0x92, 0x99, 0x17, 0xF9, 0x06, 0x4C, 0x1C, 0x40, 0x22, 0x41, 0xF7,
+    0x95, 0x09, 0xAC, 0x0C, 0xC7, 0x03, 0x6C, 0xBF, 0x5F, 0xD8, 0x74, 0x5C, 0xBB, 0xE1, 0xA4, 0x09,
+    0xF0, 0xDF, 0x3A, 0xBF, 0x7A, 0x6B, 0x12, 0x81, 0xCF, 0xFB, 0xAC, 0x85, 0x45, 0xAC, 0xF4, 0x8D,
+    0xB4, 0x4D, 0x5B, 0x2C, 0x79, 0xC2, 0x1F, 0x7D, 0xFC, 0x8C, 0x67, 0x7E, 0x8F, 0x27, 0xAF, 0xED,
+    0x2C, 0x74, 0x92, 0xF1, 0x2E, 0x91, 0xCD, 0x03, 0x66, 0x86, 0x6D, 0x62, 0xE9, 0xB9, 0xAD, 0x92,
+    0x52, 0x61, 0xE3, 0x62, 0x5B, 0x19, 0x21, 0x53, 0x62, 0x57, 0xA4, 0xDF, 0x6D, 0x0D, 0x45, 0x91,
+    0xB5, 0x56, 0x8A, 0x0C, 0xB5, 0x77, 0xBE, 0xF6, 0x97, 0x49, 0x9C, 0x23, 0xEA, 0x48, 0x54, 0xDE,
+    0x84, 0x62, 0xFB, 0xE9, 0xB4, 0x62, 0x54, 0xD7, 0xC0, 0x88, 0x4C, 0xE0, 0x9E, 0xBD, 0x9E, 0x20,
+    0x51, 0x8D, 0xE8, 0x88, 0x89, 0x98, 0x80, 0x0D, 0xB9, 0x6B, 0xF3, 0x33, 0x10, 0x74, 0xC4, 0x0C,
+    0x98, 0x80, 0x80, 0xDB, 0xBB, 0x34, 0x62, 0x25, 0x93, 0x73, 0xE5, 0xDA, 0xF1, 0xD2, 0x8A, 0x9B,
+    0x49, 0xF6, 0xB7, 0x71, 0xA3, 0x56, 0xDC, 0xFA, 0x95, 0x56, 0x44, 0x10, 0x91, 0xA4, 0x87, 0xA6,
+    0x88, 0x95, 0x4F, 0x3A, 0x7C, 0x5A, 0xC7, 0x3F, 0x3E, 0xFA, 0x29, 0x91, 0x21, 0x83, 0xE9, 0x26,
+    0xD4, 0x11, 0x87, 0x09, 0xA4, 0x5C, 0xEE, 0x3D, 0x61, 0x82, 0x8E, 0x34, 0x34, 0xBE, 0x16, 0x99,
+    0xB8, 0x9B, 0xFE, 0xF8, 0xEE, 0x54, 0xE9, 0x11, 0xDC, 0x60, 0x06, 0x30, 0xB9, 0x1C, 0xE2, 0xE8,
+    0x02, 0xE8, 0xE9, 0x18, 0x49, 0x7A, 0x7F, 0x7F, 0xFF, 0x85, 0x8C, 0x23, 0xA4, 0xE6, 0xD9, 0xBD,
+    0xBD, 0xAF, 0x1C, 0x25, 0x4C, 0x67, 0x52, 0xF5, 0xE8, 0x02, 0x54, 0xB1, 0x1E, 0x1E, 0x40, 0x95,
+    0xAE, 0xEE, 0xA3, 0x4A, 0x5F, 0xF8, 0x35, 0x64, 0xF2, 0xEE, 0xD1, 0x31, 0x93, 0xC9, 0xEB, 0x57,
+    0x07, 0x48, 0x5B, 0x48, 0xB5, 0xDB, 0xDB, 0x7B, 0xF2, 0x56, 0x84, 0xD4, 0x40, 0x7D, 0x73, 0x5A,
+    0x2B, 0xA6, 0x20, 0xFE, 0x81, 0x64, 0xF2, 0x53, 0xB5, 0xCC, 0xD0, 0xDD, 0x12, 0x81, 0x6E, 0xB4,
+    0x13, 0x34, 0xD9, 0x5F, 0xF9, 0xDF, 0x69, 0x5A, 0x4C, 0xC0, 0x44, 0xAA, 0x61, 0xED, 0xB3, 0xBC,
+    0x08, 0x61, 0x22, 0x37, 0x58, 0x27, 0x2B, 0xCE, 0x9B, 0x00, 0xD5, 0x90, 0xE3, 0x50, 0x3A, 0x02,
+    0xCE, 0x4F, 0x40, 0x35, 0x5C, 0x01, 0x48, 0x16, 0xC0, 0x7D, 0xB9, 0x65, 0x9D, 0x2E, 0xB0, 0xC4,
+    0xBB, 0x91, 0xF8, 0x9C, 0xA9, 0xB3, 0x5A, 0xDA, 0xF7, 0x24, 0xEC, 0x9C, 0xAA, 0x65, 0xA0, 0x79,
+    0x55, 0x26, 0x5C, 0xB4, 0x3D, 0x36, 0xE9, 0x11, 0xF3, 0x5F, 0x58, 0xA8, 0x02, 0x75, 0xD0, 0x03,
+    0x7A, 0x2C, 0x22, 0x1C, 0x72, 0x00, 0x26, 0x9C, 0xCB, 0x91, 0x31, 0xB8, 0x6A, 0x5A, 0x30, 0x37,
+    0x7B, 0x50, 0xBF, 0x8C, 0xC0, 0xF9, 0x71, 0x83, 0x30, 0xE5, 0x67, 0xAB, 0xB8, 0xAD, 0xD1, 0xAB,
+    0x7A, 0x22, 0x70, 0x95, 0xBA, 0x05, 0x3D, 0xEA, 0x09, 0xB0, 0xEF, 0xC8, 0xBA, 0x2C, 0x3C, 0xC8,
+    0xCC, 0xA7, 0x91, 0xA1, 0x10, 0xB9, 0x25, 0x33, 0xB5, 0x4C, 0x9F, 0xCC, 0xA1, 0xEB, 0xBB, 0xE5,
+    0x5C, 0x4C, 0xC4, 0x06, 0x74, 0xB6, 0xF6, 0x25, 0x62, 0x03, 0xAE, 0x43, 0x25, 0xCC, 0x0F, 0x22,
+    0x36, 0xE8, 0xB1, 0x41, 0x25, 0xE6, 0x32, 0x62, 0x83, 0xF3, 0x0D, 0x2A, 0x99, 0xBE, 0x8C, 0xD8,
+    0x9B, 0x23, 0x0D, 0x2A, 0xCD, 0xB9, 0xA0, 0x8C, 0xA7, 0x41, 0xC9, 0x40, 0x19, 0xB1, 0x13, 0x34,
+    0x19, 0x14, 0xDF, 0x96, 0x8D, 0x99, 0xA1, 0x1A, 0x4B, 0x59, 0xA8, 0x24, 0x75, 0x32, 0x14, 0x39,
+    0x91, 0x76, 0x13, 0xC1, 0x5B, 0xD3, 0xD5, 0xE2, 0x51, 0xD3, 0x34, 0x8B, 0x35, 0x9F, 0xFA, 0x38,
+    0xFC, 0x05, 0x0F, 0x43, 0xDD, 0x9A, 0x80, 0x8E, 0x3A, 0x82, 0x7C, 0x65, 0x82, 0x4A, 0xA6, 0x0D,
+    0x2B, 0xE9, 0x48, 0x9C, 0xC6, 0x77, 0x72, 0x49, 0x82, 0x95, 0xD0, 0x78, 0x9A, 0x3C, 0x8F, 0x75,
+    0xC4, 0x46, 0x12, 0x36, 0xE1, 0xB0, 0x0D, 0x26, 0xB8, 0x3A, 0xE8, 0xE8, 0xCA, 0x48, 0x72, 0x45,
+    0xC2, 0x5D, 0xA5, 0xC1, 0x2C, 0xD4, 0x41, 0x2F, 0x94, 0x31, 0x97, 0xC3, 0x74, 0xD0, 0xD0, 0xCD,
+    0xC8, 0xD2, 0x89, 0xEF, 0xA4, 0xDD, 0x64, 0x14, 0xEB, 0xB8, 0x4D, 0x85, 0x3A, 0xD8, 0x7A, 0x8D,
+    0xFF, 0x26, 0x57, 0x49, 0xB6, 0x32, 0xAD, 0xD6, 0x63, 0x8E, 0xE7, 0x75, 0xAC, 0xCF, 0x2A, 0x72,
+    0x22, 0x47, 0xCF, 0xD1, 0xFD, 0xD3, 0x05, 0xE8, 0x44, 0x3C, 0x9D, 0x48, 0xA4, 0xA3, 0x9E, 0xB2,
+    0x5D, 0xDF, 0xC1, 0xB2, 0xDD, 0x1C, 0x6E, 0x8E, 0x8A, 0x99, 0x8E, 0x32, 0xD1, 0xED, 0x35, 0xB1,
+    0x16, 0x91, 0x60, 0x8F, 0x28, 0xF7, 0x5C, 0x97, 0xBA, 0x94, 0x16, 0xFE, 0x76, 0x58, 0x4D, 0xFC,
+    0xAB, 0x2B, 0xD9, 0x5C, 0x24, 0x66, 0x8C, 0x7B, 0x73, 0xA2, 0xDC, 0x7C, 0xA2, 0xD9, 0xF3, 0xD4,
+    0x22, 0xBE, 0x5C, 0xBA, 0x58, 0x4C, 0x74, 0x5C, 0xC5, 0x84, 0xBA, 0xD5, 0xB1, 0x1C, 0x48, 0xC5,
+    0x44, 0xC3, 0x55, 0x9A, 0x47, 0x44, 0xC4, 0x1F, 0x59, 0x69, 0x32, 0x37, 0xDC, 0x77, 0x22, 0x52,
+    0x34, 0xE1, 0x52, 0x52, 0x29, 0xD7, 0x47, 0x5B, 0x54, 0xC2, 0x0C, 0x36, 0x70, 0xA8, 0xD2, 0x09,
+    0x33, 0xD8, 0x9B, 0xFD, 0xAC, 0x92, 0xAD, 0x83, 0x0D, 0x32, 0xAA, 0x74, 0x66, 0xC1, 0x8A, 0x78,
+    0x25, 0xCB, 0x01, 0x36, 0xE8, 0x41, 0x25, 0x6A, 0x6C, 0xE0, 0x82, 0x4A, 0x47, 0x13, 0x94, 0x6C,
+    0x0F, 0x8D, 0x8C, 0x99, 0x7F, 0x07, 0xC5, 0x05, 0x2E, 0xBD, 0x2C, 0x53, 0x25, 0x97, 0x24, 0x9D,
+    0x91, 0xDB, 0x97, 0x26, 0x25, 0x98, 0x58, 0x45, 0xEA, 0xDE, 0xB6, 0xB8, 0xF6, 0x10, 0x3A, 0x35,
+    0xA1, 0x52, 0x35, 0xE4, 0x47, 0x6C, 0xD8, 0xF6, 0x50, 0x87, 0x45, 0x4D, 0xE6, 0x99, 0xB1, 0x1A,
+    0xCC, 0x93, 0xC1, 0xB6, 0xF5, 0x4C, 0x77, 0xAD, 0x19, 0x32, 0xB4, 0x2A, 0x92, 0xB0, 0x6D, 0xC6,
+    0x70, 0xA2, 0x9A, 0x28, 0xD8, 0x66, 0x4B, 0x29, 0xF9, 0x29, 0x34, 0x12, 0x8F, 0x93, 0xC6, 0x54,
+    0x58, 0x15, 0xD1, 0x79, 0xA0, 0xFE, 0xC7, 0xB5, 0x7A, 0xDE, 0xF8, 0xE4, 0x9D, 0xFD, 0xFF, 0xE7,
+    0xBD, 0x42, 0x8C, 0xEF, 0x17, 0x84, 0xEC, 0xA1, 0xCE, 0xA1, 0x1D, 0xD7, 0x88, 0xBC, 0x29, 0xB2,
+    0x94, 0xB7, 0xF7, 0xAE, 0x39, 0xBF, 0x09, 0xAA, 0xBD, 0xEB, 0xEE, 0x36, 0x4A, 0xC4, 0x77, 0x19,
+    0x5A, 0xCC, 0x99, 0xE1, 0x3B, 0xB2, 0x2F, 0xB1, 0x8A, 0x5C, 0xA5, 0xCB, 0x35, 0xBB, 0xCE, 0xD1,
+    0xA1, 0xFB, 0x2A, 0xF2, 0x29, 0xBA, 0xD5, 0xD9, 0x39, 0x2D, 0x7B, 0x5E, 0x8B, 0x24, 0x3E, 0x2F,
+    0xFB, 0x6D, 0x76, 0x76, 0x37, 0x97, 0x1E, 0x74, 0xE0, 0x73, 0xE6, 0x95, 0x5D, 0x53, 0x04, 0xDE,
+    0x12, 0x91, 0xD0, 0x3C, 0xDB, 0x31, 0x73, 0xA0, 0xC7, 0x22, 0x9A, 0x5E, 0xB7, 0xCE, 0x7F, 0xEC,
+    0xA1, 0xE5, 0x79, 0x44, 0xC6, 0xE2, 0xC9, 0xD7, 0xFD, 0x7D, 0xCE, 0x4F, 0x4B, 0x25, 0x89, 0x4E,
+    0x22, 0xCD, 0x26, 0x2F, 0x3A, 0x7C, 0x72, 0xD9, 0x97, 0x56, 0x25, 0x4C, 0xAB, 0x12, 0xC6, 0xAB,
+    0x84, 0x41, 0x25, 0x76, 0xB2, 0x94, 0xD6, 0xCD, 0x69, 0x8F, 0x12, 0x99, 0x51, 0x22, 0x12, 0xD4,
+    0xBC, 0xD3, 0x45, 0x95, 0x30, 0x93, 0x4A, 0xE8, 0xA4, 0x12, 0x19, 0x8D, 0x5A, 0xEE, 0xDD, 0xCC,
+    0xB0, 0x34, 0x12, 0x99, 0x3B, 0x89, 0x6C, 0xFF, 0x9B, 0x1E, 0xB7, 0x86, 0x67, 0x80, 0x27, 0x04,
+    0x0A, 0x99, 0x80, 0xAF, 0x79, 0x3A, 0x91, 0x54, 0x89, 0x48, 0x28, 0x6F, 0x3F, 0x9E, 0x70, 0xBE,
+    0x6C, 0xF5, 0xC8, 0x5F, 0xE1, 0x36, 0xF0, 0xB9, 0xEB, 0x16, 0xB4, 0xC8, 0x8C, 0xBB, 0x66, 0xA3,
+    0x1E, 0x71, 0xAD, 0xF3, 0x2A, 0xE9, 0x31, 0x57, 0x8B, 0x9C, 0xF5, 0x84, 0xF9, 0x9E, 0x4C, 0xCC,
+    0x9D, 0xB4, 0xA6, 0x3F, 0x52, 0xEA, 0x44, 0x4D, 0xAB, 0x96, 0x37, 0x03, 0x9C, 0x99, 0xC0, 0x2E,
+    0xC0, 0x3E, 0xFC, 0x0F, 0xDD, 0xBD, 0x4F, 0x8C, 0xE5, 0xC6, 0x99, 0xE0, 0xF9, 0x23, 0x43, 0x59,
+    0x74, 0x17, 0xC7, 0x0E, 0x1D, 0x54, 0x6D, 0x8D, 0x64, 0x89, 0x3E, 0xF8, 0xD0, 0xED, 0xB1, 0x8A,
+    0x73, 0x30, 0x16, 0xC2, 0xA2, 0x2A, 0x23, 0x24, 0xA1, 0xC7, 0x58, 0xF8, 0xE0, 0xC4, 0xA0, 0x9E,
+    0x1B, 0x63, 0x61, 0x5B, 0x06, 0xA6, 0x1B, 0x98, 0xF6, 0xA0, 0xBB, 0x84, 0x85, 0x16, 0xD0, 0x02,
+    0x95, 0x49, 0xCA, 0x3A, 0xF8, 0x30, 0x07, 0x17, 0x30, 0xD6, 0x1C, 0xB6, 0x17, 0xB0, 0x30, 0x50,
+    0x63, 0xEC, 0x57, 0xC0, 0x56, 0xEF, 0xC2, 0x0B, 0x94, 0x07, 0x99, 0xC9, 0x90, 0x0A, 0xBD, 0x02,
+    0xB6, 0x0E, 0xA2, 0xAC, 0x6D, 0xF8, 0xA0, 0x83, 0x68, 0x5B, 0x1A, 0xA3, 0x25, 0x60, 0x2B, 0x24,
+    0x53, 0x36, 0x33, 0x2B, 0xC8, 0x6F, 0x0F, 0xC1, 0xF7, 0x32, 0xAB, 0x54, 0x92, 0x65, 0x5B, 0x5E,
+    0x7B, 0x96, 0x2A, 0xF1, 0x91, 0x8C, 0x20, 0x23, 0xE2, 0x8B, 0x2F, 0xBE, 0xF8, 0xFE, 0x27, 0xCC,
+    0xC7, 0x48, 0x29, 0x3D, 0x23, 0x55, 0xAB, 0x25, 0x20, 0xAE, 0x08, 0x14, 0x1D, 0x4D, 0x97, 0x9E,
+    0xAF, 0x55, 0x4F, 0x75, 0x8E, 0xB4, 0x67, 0xC4, 0x00, 0x06, 0x63, 0x0B, 0x0B, 0xAA, 0xD5, 0xAD,
+    0xAE, 0x81, 0x5D, 0xD5, 0xE7, 0x0E, 0xD0, 0x76, 0x54, 0x2D, 0x90, 0x78, 0xF3, 0xB0, 0x07, 0x30,
+    0x22, 0x3D, 0x40, 0x21, 0x22, 0x00, 0xBA, 0x1D, 0x75, 0x0B, 0xE4, 0x9D, 0x79, 0x28, 0x00, 0x99,
+    0xD7, 0xAD, 0xA9, 0x41, 0x0D, 0xAA, 0xCF, 0x7A, 0x48, 0x03, 0x23, 0x0D, 0x24, 0x13, 0xC6, 0x6A,
+    0x0F, 0x82, 0x6E, 0xD3, 0x09, 0xC4, 0xAA, 0x1E, 0xD3, 0x22, 0x35, 0x93, 0xCD, 0x46, 0xC4, 0xE5,
+    0x32, 0x52, 0xB5, 0xE2, 0x94, 0x88, 0xCD, 0xA6, 0x7B, 0x2C, 0x00, 0xC6, 0xC5, 0xB1, 0x64, 0x3E,
+    0xFE, 0x26, 0xC3, 0x3C, 0xB8, 0xB3, 0xF3, 0xAF, 0x8E, 0xF5, 0x50, 0x73, 0x45, 0x3E, 0xBD, 0x01,
+    0xB0, 0x41, 0x65, 0x2B, 0xA1, 0x49, 0xE4, 0x21, 0x19, 0xF2, 0x90, 0x54, 0x54, 0xEC, 0x6C, 0xB1,
+    0xC9, 0xA0, 0x3A, 0xB8, 0xA0, 0xBA, 0x12, 0xB8, 0xA2, 0xEB, 0x1E, 0xF0, 0x9B, 0xB9, 0x83, 0xF4,
+    0x70, 0xDA, 0x03, 0xB4, 0xC8, 0x00, 0xEC, 0x17, 0x57, 0x3D, 0x28, 0xBF, 0x99, 0x79, 0x30, 0x76,
+    0xD0, 0x2D, 0x49, 0x50, 0x5D, 0xE1, 0xD0, 0xAD, 0xAE, 0x4D, 0x8D, 0xB0, 0x89, 0xB1, 0xDA, 0xE7,
+    0x52, 0x37, 0xB5, 0xD0, 0x08, 0xCD, 0xF3, 0x5B, 0x00, 0x26, 0x76, 0x23, 0x00, 0x90, 0xC6, 0x6E,
+    0xE7, 0x35, 0x00, 0xF7, 0xC7, 0xA2, 0xCF, 0xB3, 0x71, 0x0E, 0x2A, 0xF1, 0x89, 0x88, 0xD8, 0xEA,
+    0x62, 0xE9, 0x4B, 0x9B, 0x4C, 0xB9, 0xC3, 0x7C, 0xDD, 0x93, 0x77, 0x4F, 0xA2, 0x06, 0x60, 0x04,
+    0x1A, 0xA0, 0x82, 0x46, 0xA0, 0x90, 0x9E, 0xE4, 0x92, 0x58, 0x28, 0x3C, 0x24, 0x13, 0x60, 0x6A,
+    0xD0, 0xEF, 0x38, 0xD4, 0x41, 0x4F, 0x32, 0x0A, 0x48, 0xD9, 0x27, 0xF2, 0x88, 0x88, 0xD8, 0x42,
+    0x26, 0xB8, 0x27, 0x00, 0x05, 0x90, 0x39, 0x78, 0xD8, 0x43, 0x13, 0xA0, 0x0C, 0x90, 0x3E, 0x07,
+    0x9C, 0xB2, 0x54, 0xE2, 0x4A, 0x11, 0xD5, 0xE5, 0xC3, 0xE7, 0x29, 0x6B, 0x92, 0x01, 0x4A, 0xC8,
+    0x3A, 0x9A, 0x40, 0x2E, 0x9E, 0xA4, 0x71, 0x10, 0x40, 0xFF, 0xC0, 0x32, 0xEE, 0xA2, 0x5F, 0xEA,
+    0xB2, 0xA1, 0x92, 0x29, 0x11, 0xB1, 0x3C, 0x56, 0xC3, 0x15, 0xC8, 0x6B, 0xFE, 0xA2, 0x27, 0x17,
+    0xA8, 0x6A, 0xD6, 0x47, 0x22, 0xE2, 0xD4, 0x90, 0xCB, 0x84, 0xF1, 0x1B, 0x62, 0x53, 0x71, 0x69,
+    0xA0, 0xF8, 0x07, 0x72, 0x4F, 0x80, 0xD2, 0x65, 0x2D, 0x34, 0x6C, 0x42, 0x1A, 0x12, 0x0F, 0xB9,
+    0xD7, 0x35, 0x94, 0x6E, 0x17, 0x68, 0xA4, 0x85, 0x54, 0xC4, 0x41, 0xEE, 0x4D, 0x0D, 0xA5, 0xAB,
+    0x80, 0x06, 0x81, 0x34, 0x24, 0x23, 0xE4, 0x3E, 0x0D, 0x50, 0x3A, 0x15, 0xA0, 0x21, 0x1F, 0x48,
+    0x03, 0xBA, 0x27, 0xEF, 0x29, 0xFA, 0x4C, 0x84, 0xA2, 0x2F, 0x25, 0x50, 0x0C, 0x00, 0xB9, 0x07,
+    0x28, 0x1C, 0xC0, 0x26, 0x00, 0x03, 0x80, 0x6A, 0x01, 0x72, 0x0B, 0xF0, 0x31, 0x80, 0x8D, 0x54,
+    0x46, 0xA6, 0x5C, 0xBC, 0x0E, 0xC9, 0xC8, 0xFE, 0x96, 0xF2, 0x59, 0x8B, 0x76, 0x9B, 0x60, 0x12,
+    0x0F, 0x41, 0x5B, 0xD4, 0x61, 0x00, 0x2D, 0x1E, 0xCC, 0x17, 0x3C, 0x04, 0xDD, 0xA2, 0xBC, 0x76,
+    0x68, 0x57, 0x3A, 0x0C, 0xA6, 0x26, 0x50, 0xD9, 0x52, 0x6C, 0xF3, 0xB0, 0x8C, 0x34, 0x2E, 0x4E,
+    0x5D, 0x44, 0x04, 0xD5, 0xAD, 0x90, 0xE0, 0x01, 0x80, 0x7F, 0x1E, 0xA1, 0x54, 0x89, 0xC7, 0xD4,
+    0x8D, 0x74, 0x88, 0xFB, 0xE4, 0x48, 0x84, 0x92, 0x7A, 0xD7, 0xA6, 0x81, 0xDC, 0x91, 0x06, 0xB4,
+    0x25, 0x0D, 0x4F, 0x96, 0x90, 0x86, 0x27, 0x37, 0x21, 0x0D, 0x4F, 0x5E, 0x80, 0x34, 0x3C, 0x39,
+    0x40, 0x2A, 0xD2, 0x43, 0x2A, 0x32, 0x40, 0x1A, 0xFE, 0xA7, 0x00, 0x69, 0x78, 0xB2, 0x81, 0x34,
+    0x3C, 0x69, 0xE2, 0x5B, 0x8E, 0x34, 0x7C, 0x46, 0x77, 0xA4, 0x81, 0xBC, 0x27, 0x0D, 0xA8, 0x40,
+    0x1A, 0x48, 0x26, 0xD2, 0x11, 0xA4, 0xAE, 0xA4, 0xC3, 0x74, 0x8D, 0x74, 0xE8, 0x01, 0x20, 0xB9,
+    0x08, 0x24, 0x0F, 0x4B, 0xA0, 0xFA, 0xA2, 0x78, 0x35, 0x26, 0x81, 0x72, 0x4B, 0x79, 0x3C, 0xFA,
+    0xEF, 0xF3, 0x1A, 0xF3, 0xB9, 0x33, 0x10, 0xFE, 0xF7, 0x0E, 0xF5, 0x8B, 0xEB, 0x16, 0x2D, 0x13,
+    0x98, 0x07, 0x02, 0x84, 0xFF, 0x6D, 0x40, 0xBD, 0x73, 0xB5, 0x47, 0x3F, 0x9F, 0x79, 0x0C, 0xBA,
+    0x23, 0x50, 0xB4, 0xA5, 0x60, 0x5E, 0x90, 0x80, 0x69, 0x81, 0x53, 0x1F, 0x02, 0x2B, 0xB4, 0x48,
+    0xD6, 0x52, 0xCA, 0xF0, 0x91, 0x63, 0x85, 0x7E, 0x0F, 0x56, 0x9C, 0x88, 0x34, 0xE3, 0x7C, 0x07,
+    0x99, 0xD4, 0x70, 0x62, 0x7F, 0x45, 0x59, 0xB2, 0x0E, 0x28, 0x6A, 0xEE, 0xD4, 0xD2, 0xE7, 0xDE,
+    0x48, 0xD7, 0xB8, 0xAC, 0xCB, 0xFE, 0x0B, 0x45, 0xBD, 0x09, 0x3B, 0xA9, 0x27, 0x19, 0x0A, 0xC8,
+    0xBA, 0x01, 0x8A, 0xEB, 0x0E, 0x2A, 0xB1, 0x24, 0xA1, 0x82, 0xAC, 0xDB, 0x87, 0xA2, 0x1E, 0x61,
+    0x27, 0x0D, 0x24, 0x83, 0x1A, 0xC8, 0x7C, 0xD6, 0x27, 0x32, 0xE4, 0xBD, 0x16, 0x9F, 0x0F, 0x40,
+    0x62, 0xD7, 0x70, 0x88, 0x80, 0x90, 0x09, 0xE3, 0xCB, 0x37, 0x9B, 0x3A, 0x15, 0xB7, 0xCB, 0x48,
+    0xF1, 0x0F, 0xA9, 0x57, 0x3D, 0x81, 0xBC, 0xD6, 0x6D, 0xD6, 0x72, 0x1F, 0xC6, 0x1A, 0x80, 0x31,
+    0xF1, 0x80, 0xEA, 0x75, 0x0D, 0xE8, 0x76, 0x37, 0x52, 0xE2, 0x0E, 0x40, 0xC4, 0x01, 0xAA, 0x37,
+    0xB1, 0xA8, 0x02, 0x30, 0x56, 0x22, 0xFD, 0x1F, 0x01, 0xD5, 0xA7, 0x01, 0xD0, 0xAD, 0x0A, 0x80,
+    0xB1, 0x79, 0x24, 0x2E, 0xBA, 0x87, 0xAC, 0x47, 0xF7, 0xA4, 0x22, 0x14, 0x3D, 0xC5, 0x1A, 0x3C,
+    0x33, 0x7C, 0xEE, 0x2A, 0x45, 0x6C, 0xF5, 0x45, 0x11, 0x57, 0xFD, 0xE0, 0xB0, 0xB2, 0xE6, 0xAB,
+    0x83, 0x76, 0x25, 0x9B, 0xCA, 0x17, 0x36, 0xB7, 0x41, 0xD7, 0x49, 0x6D, 0x32, 0x07, 0xFA, 0xAD,
+    0x16, 0x94, 0x04, 0x60, 0x34, 0x16, 0x4C, 0xE6, 0x41, 0xBB, 0x7D, 0x50, 0x5E, 0xB7, 0x10, 0xD2,
+    0x00, 0x06, 0xE3, 0x68, 0x46, 0x15, 0x68, 0xC4, 0x56, 0x0E, 0x48, 0xB6, 0x2A, 0xE9, 0x10, 0xB9,
+    0x26, 0x23, 0x85, 0x0C, 0x9F, 0x1C, 0xE1, 0xDE, 0x9E, 0xD2, 0x41, 0x45, 0x1A, 0x20, 0xF3, 0xBF,
+    0xFC, 0x46, 0x44, 0xC4, 0x53, 0x8A, 0x88, 0x90, 0x4E, 0xCB, 0xE5, 0x25, 0xFF, 0x2B, 0x7E, 0x60,
+    0x84, 0xFC, 0xDD, 0x4C, 0x84, 0x5C, 0xC6, 0x46, 0x7C, 0x22, 0x11, 0xA6, 0x8C, 0x71, 0x6B, 0x69,
+    0x01, 0xD8, 0x8D, 0x24, 0x3C, 0xEE, 0x2F, 0x17, 0x8E, 0x6F, 0x36, 0x9F, 0x69, 0xC4, 0x36, 0xF2,
+    0xEF, 0xA4, 0xD7, 0xD2, 0x67, 0x03, 0xF7, 0x7A, 0x8C, 0xA5, 0x42, 0xF5, 0x64, 0x37, 0x5F, 0xBE,
+    0xB9, 0x14, 0x94, 0x88, 0x78, 0xCC, 0x33, 0x8B, 0xE6, 0x36, 0x15, 0x2C, 0x15, 0x6A, 0x20, 0xEF,
+    0x53, 0x19, 0x32, 0x09, 0x8D, 0xD4, 0x8D, 0xB8, 0xF5, 0x36, 0xA2, 0x8F, 0x2E, 0xE3, 0x4E, 0xF2,
+    0x24, 0x80, 0xB2, 0x11, 0x82, 0xF2, 0x96, 0x8C, 0x14, 0x22, 0xD3, 0x27, 0x47, 0xB8, 0xF7, 0xF0,
+    0x72, 0x17, 0x07, 0xB7, 0x19, 0x87, 0xAA, 0xDA, 0x78, 0x7B, 0x76, 0xBE, 0xAD, 0xE3, 0xED, 0x0A,
+    0x10, 0xAC, 0x6E, 0x23, 0x2C, 0x67, 0x60, 0xAE, 0xA0, 0xC9, 0xFB, 0x54, 0xFE, 0xE0, 0xDB, 0x11,
+    0xF2, 0x9E, 0x08, 0xD6, 0x40, 0x84, 0xAB, 0xA3, 0x11, 0xDB, 0xC8, 0xD4, 0x88, 0x15, 0x99, 0xB2,
+    0x81, 0x7B, 0x0F, 0xF7, 0x55, 0x4F, 0xE6, 0x4F, 0x1F, 0x3B, 0x3F, 0xA0, 0x7A, 0x32, 0x7F, 0xB7,
+    0x9A, 0x96, 0x97, 0xFD, 0x0C, 0x2F, 0x75, 0xB0, 0x78, 0xD4, 0xCF, 0x50, 0xBA, 0xCD, 0x79, 0x20,
+    0xF7, 0x94, 0x52, 0x57, 0x52, 0x37, 0x52, 0x37, 0x52, 0x57, 0x22, 0x22, 0x61, 0x1E, 0xC7, 0x04,
+    0x49, 0x75, 0xB8, 0xBC, 0xDC, 0xC7, 0x9D, 0x20, 0x09, 0xC4, 0xCE, 0x56, 0xC4, 0xBD, 0xB5, 0x70,
+    0x40, 0xE9, 0x22, 0x73, 0x71, 0xDB, 0x0A, 0x7F, 0x7F, 0x2E, 0x56, 0x10, 0x79, 0x9D, 0xDC, 0x93,
+    0x88, 0x48, 0x9D, 0x06, 0xA8, 0xFE, 0xA4, 0x19, 0xE2, 0x17, 0x12, 0x99, 0xBF, 0x50, 0x74, 0xF1,
+    0x0B, 0x2A, 0xCC, 0x5F, 0x68, 0xE6, 0x26, 0x8A, 0x36, 0x56, 0x50, 0xFD, 0xDC, 0x44, 0x48, 0x47,
+    0x68, 0x2C, 0x55, 0x21, 0x21, 0x15, 0xA1, 0xB8, 0x26, 0x92, 0x88, 0xB8, 0xBC, 0x9B, 0x59, 0x99,
+    0x3E, 0xFE, 0xA6, 0x61, 0xA6, 0x17, 0xE3, 0x7C, 0x3F, 0xC5, 0xDB, 0x47, 0xE3, 0x2F, 0x32, 0x3F,
+    0x3F, 0xF1, 0x1C, 0x34, 0x22, 0x22, 0x96, 0x5C, 0x44, 0xA4, 0x83, 0xEC, 0x60, 0xF1, 0x58, 0x07,
+    0x18, 0xCB, 0x7E, 0xFC, 0x62, 0x7E, 0xCB, 0xED, 0x8F, 0x9A, 0x1A, 0x63, 0xD9, 0x17, 0xA9, 0x55,
+    0x4F, 0xA4, 0x45, 0x96, 0xA6, 0x2E, 0x7C, 0xAC, 0x5C, 0xD5, 0xC6, 0xB2, 0x8F, 0x0A, 0xF1, 0xB6,
+    0x70, 0xC6, 0xB2, 0x4F, 0x12, 0xD4, 0x80, 0xEE, 0xD0, 0x2F, 0xC8, 0x90, 0x89, 0x4F, 0x42, 0x23,
+    0xB5, 0xC8, 0xBC, 0xC1, 0x46, 0xF8, 0x01, 0x65, 0x64, 0x05, 0xD4, 0xCC, 0xB3, 0xED, 0xCF, 0x4F,
+    0x63, 0xA5, 0xC7, 0xE2, 0xE8, 0x4C, 0xEC, 0x7C, 0xF2, 0x5D, 0x00, 0xB6, 0x00, 0x72, 0xB1, 0x40,
+    0x3E, 0x59, 0x40, 0x8D, 0x34, 0x1D, 0x4C, 0x18, 0x71, 0x98, 0x5A, 0xBF, 0x3C, 0x91, 0xFB, 0xB4,
+    0x57, 0x9E, 0x11, 0x43, 0x59, 0x97, 0x2E, 0xEB, 0x92, 0xA0, 0x06, 0xF6, 0x28, 0x9C, 0xB1, 0xBA,
+    0x25, 0x64, 0x3D, 0x01, 0xED, 0x2A, 0xB4, 0x23, 0x64, 0x9E, 0x91, 0xC2, 0x55, 0x56, 0xB7, 0xC9,
+    0x90, 0xF5, 0xEC, 0x53, 0x5A, 0x53, 0xE7, 0x5E, 0x79, 0x15, 0x30, 0x18, 0x8A, 0x2E, 0x1D, 0xF2,
+    0x16, 0xB1, 0xFA, 0xF9, 0x01, 0x35, 0x52, 0x55, 0x50, 0x1C, 0xA4, 0xE2, 0xC0, 0x88, 0x4C, 0xFF,
+    0xB3, 0xE3, 0xBC, 0xBC, 0x25, 0x3D, 0x6C, 0xD8, 0x64, 0x6B, 0xEE, 0x61, 0x39, 0x00, 0x63, 0xFA,
+    0x1C, 0xAA, 0x2B, 0x04, 0xED, 0xB6, 0x0B, 0x57, 0xDA, 0x21, 0x6F, 0x4D, 0xD2, 0xAB, 0x6E, 0x27,
+    0xF5, 0xCA, 0xEF, 0x28, 0xAF, 0xFC, 0x9E, 0xF2, 0xCA, 0xEF, 0x2B, 0xAF, 0xBA, 0xFD, 0xB4, 0xCF,
+    0xDA, 0x2A, 0x19, 0x72, 0x67, 0x08, 0xBA, 0x2E, 0xEB, 0xBD, 0x12, 0xDD, 0x99, 0x3D, 0xD4, 0x74,
+    0xF9, 0xE0, 0x5F, 0xD1, 0x88, 0x04, 0x36, 0xBE, 0x75, 0x62, 0x6B, 0x9E, 0x47, 0x99, 0x6C, 0x22,
+    0x32, 0x51, 0x1C, 0x3C, 0x1A, 0x92, 0x29, 0xD2, 0x4F, 0xED, 0x26, 0xD8, 0xCC, 0x3C, 0x7C, 0xAF,
+    0x74, 0xC0, 0xB4, 0x42, 0x90, 0xA2, 0x9D, 0x39, 0x8C, 0x24, 0x00, 0xD9, 0xFA, 0x91, 0xA9, 0x01,
+    0x59, 0xA1, 0x8B, 0x9A, 0x66, 0xC0, 0xDE, 0x95, 0xCB, 0xE1, 0xE5, 0x2E, 0x17, 0x11, 0x52, 0x91,
+    0x0E, 0xCA, 0x8B, 0x2B, 0x2E, 0x7A, 0x80, 0x24, 0x6B, 0xA1, 0x10, 0xA0, 0xEA, 0x81, 0xAF, 0x01,
+    0x24, 0xE7, 0xA0, 0x99, 0x28, 0x44, 0x92, 0x31, 0x0B, 0xDA, 0xA9, 0x7E, 0x8F, 0xFC, 0xAA, 0xE7,
+    0xAE, 0xC2, 0xC1, 0x3E, 0xA4, 0x43, 0xE4, 0xAF, 0x4A, 0x07, 0x95, 0x05, 0x89, 0xAD, 0x29, 0x79,
+    0xE6, 0xAF, 0x33, 0x91, 0x3E, 0x15, 0xB1, 0x9C, 0xB7, 0x70, 0x06, 0x12, 0x8F, 0x7A, 0xCC, 0x51,
+    0x8C, 0x44, 0x86, 0x00, 0x2A, 0x11, 0x91, 0x52, 0x44, 0xE4, 0xDA, 0xE1, 0xE5, 0xC3, 0xCB, 0xEF,
+    0xF8, 0x34, 0xB0, 0xBB, 0x4B, 0x43, 0x79, 0x9A, 0xD2, 0x65, 0x2F, 0xDA, 0xDC, 0x27, 0xED, 0xBC,
+    0x02, 0x9A, 0x35, 0xF6, 0xE4, 0x7E, 0xBD, 0x2C, 0x3E, 0xFC, 0x43, 0xD9, 0x82, 0x5C, 0xC4, 0x92,
+    0x45, 0xF2, 0x1E, 0x97, 0xD7, 0xB8, 0xE6, 0xD5, 0x73, 0x07, 0x24, 0x7E, 0x4D, 0x57, 0xFF, 0x20,
+    0xAE, 0xA6, 0x52, 0x44, 0xAE, 0xFD, 0x63, 0xF3, 0xB5, 0x9F, 0x75, 0x85, 0xBB, 0x30, 0x64, 0x5E,
+    0x3F, 0x90, 0x04, 0xF5, 0x7F, 0x52, 0x71, 0x91, 0xC2, 0x45, 0x82, 0x97, 0x84, 0x79, 0x0A, 0x6E,
+    0x7A, 0xD0, 0x58, 0x4E, 0x88, 0x58, 0x25, 0xD2, 0xCD, 0x8D, 0xED, 0x1D, 0xE3, 0xC3, 0xF1, 0xC0,
+    0x1F, 0xD1, 0x88, 0xD7, 0xF2, 0x8E, 0x48, 0x6D, 0xE4, 0xF9, 0xA6, 0x25, 0xEF, 0xA9, 0x2C, 0x06,
+    0x84, 0x64, 0x20, 0x19, 0xD1, 0x8E, 0x34, 0xB0, 0x0D, 0x6A, 0x50, 0x1E, 0x72, 0x5F, 0x58, 0xD0,
+    0x5D, 0x00, 0x8A, 0x6B, 0x0E, 0x28, 0xF7, 0x01, 0x8C, 0x27, 0xB6, 0xB8, 0x5A, 0x7C, 0xD9, 0x31,
+    0x86, 0xB7, 0xE2, 0xD6, 0xC7, 0xFF, 0x77, 0x94, 0xDC, 0x00, 0x91, 0x00, 0x95, 0xD4, 0xCD, 0x54,
+    0x49, 0xDD, 0x8C, 0x79, 0x4F, 0xE6, 0x55, 0x4F, 0xDE, 0xAA, 0x01, 0xED, 0x92, 0x40, 0x51, 0x47,
+    0xD9, 0xB0, 0x62, 0x07, 0x0C, 0xBB, 0x50, 0xD6, 0x03, 0xE8, 0xE7, 0x7B, 0xD0, 0xAF, 0x78, 0xC8,
+    0x7E, 0xD2, 0x82, 0xBA, 0xE1, 0x20, 0x15, 0x3B, 0xA3, 0x5C, 0x5C, 0xEA, 0xEF, 0x77, 0x4A, 0xE5,
+    0x22, 0x14, 0xE2, 0x61, 0x63, 0xB1, 0xF5, 0x2B, 0x40, 0xA0, 0x3F, 0x06, 0x81, 0x36, 0x00, 0xC5,
+    0x8B, 0x0E, 0x28, 0x77, 0x00, 0x2A, 0x0F, 0x88, 0x88, 0x43, 0x45, 0x91, 0xF4, 0x03, 0x21, 0x50,
+    0x7E, 0x08, 0x08, 0xA4, 0x2B, 0x08, 0xD8, 0x15, 0x04, 0x36, 0x57, 0x10, 0xB0, 0x03, 0xE8, 0xE7,
+    0x3D, 0xE4, 0x2F, 0xDC, 0x04, 0x81, 0x44, 0x2C, 0x7C, 0x56, 0xBE, 0x03, 0x95, 0x8C, 0x70, 0x6A,
+    0xFF, 0xDC, 0x87, 0x81, 0x40, 0x29, 0x41, 0x49, 0x28, 0x65, 0x50, 0x32, 0x9C, 0x10, 0x4B, 0x65,
+    0x69, 0x6A, 0xF6, 0xC1, 0xB4, 0x49, 0x00, 0xED, 0x95, 0x87, 0x2C, 0xE8, 0x16, 0xD2, 0xB1, 0xB4,
+    0x80, 0xEC, 0x00, 0x98, 0x00, 0x50, 0x7A, 0x00, 0xDD, 0x1F, 0x3D, 0xD9, 0x17, 0x20, 0x19, 0x1A,
+    0x0B, 0xCA, 0x1B, 0x07, 0xDA, 0x69, 0x0F, 0x65, 0x9D, 0x0D, 0x50, 0xA1, 0x46, 0x08, 0x20, 0x64,
+    0x03, 0x34, 0x6D, 0x25, 0x2E, 0x97, 0xA9, 0x11, 0xA7, 0xA3, 0x24, 0xCF, 0x74, 0x8C, 0x58, 0xEF,
+    0x1D, 0x63, 0x76, 0xCE, 0x1C, 0x3B, 0xDF, 0x6D, 0xA4, 0x96, 0x60, 0xA4, 0x96, 0x21, 0x0B, 0x94,
+    0x35, 0x13, 0x06, 0x2A, 0x1B, 0xA0, 0x78, 0xC1, 0x43, 0xFE, 0x8B, 0x9B, 0xF0, 0x21, 0x91, 0x1A,
+    0xD4, 0xF5, 0x16, 0xF4, 0x37, 0x3C, 0x98, 0x34, 0x40, 0x40, 0x48, 0x7B, 0x4C, 0x5D, 0x4E, 0x89,
+    0x84, 0x46, 0x54, 0xDC, 0xC6, 0xC2, 0xFA, 0xB4, 0x0B, 0x70, 0x65, 0xBD, 0x1C, 0x3F, 0x5F, 0x89,
+    0x8C, 0x4A, 0xA6, 0x52, 0x44, 0x6A, 0x91, 0x2F, 0xFE, 0xA3, 0x3C, 0xDA, 0x66, 0x63, 0xEA, 0x4D,
+    0xDD, 0x33, 0x71, 0x45, 0x77, 0x67, 0x31, 0xF5, 0x69, 0x35, 0x68, 0x74, 0x97, 0xD9, 0x49, 0x59,
+    0x35, 0x44, 0x22, 0x38, 0x81, 0xEE, 0xC0, 0xD4, 0xA8, 0x21, 0x5E, 0x4E, 0xF0, 0xD1, 0x14, 0x1E,
+    0x2E, 0xBE, 0xDC, 0xB4, 0x91, 0x86, 0x89, 0x33, 0x32, 0xF3, 0x4E, 0xC7, 0xB6, 0xEC, 0x2A, 0xFE,
+    0x14, 0xF3, 0x46, 0x38, 0x6F, 0xEC, 0xF3, 0xBE, 0xFE, 0xB9, 0x79, 0x3B, 0xA7, 0x11, 0xE9, 0x64,
+    0x34, 0x22, 0x43, 0x25, 0xFA, 0xE9, 0x61, 0x27, 0x0D, 0xAA, 0x1D, 0xB5, 0xDD, 0xC7, 0x9B, 0x87,
+    0xDB, 0xB2, 0xFE, 0x9C, 0x6E, 0xFF, 0x2E, 0xEF, 0x50, 0x3D, 0xE9, 0x00, 0x23, 0xEC, 0x83, 0xB1,
+    0x94, 0x35, 0xBA, 0xE5, 0x03, 0x0B, 0x0E, 0xF8, 0xE4, 0x18, 0x79, 0x81, 0x90, 0x8B, 0xCC, 0xAA,
+    0x9A, 0x79, 0x4D, 0xCC, 0xBB, 0x72, 0xE4, 0xF4, 0xA3, 0x4C, 0x1C, 0x05, 0x61, 0x9C, 0x11, 0x6F,
+    0xC4, 0x8B, 0xD4, 0x22, 0xF5, 0xF9, 0x96, 0xF3, 0x2D, 0x15, 0x54, 0x24, 0x81, 0x24, 0x90, 0x79,
+    0x32, 0x4F, 0xE1, 0x28, 0x5C, 0x7C, 0xCC, 0x48, 0x12, 0x50, 0x03, 0x99, 0x47, 0xF7, 0x14, 0x8E,
+    0xE2, 0x60, 0x21, 0x50, 0x8A, 0x04, 0x28, 0x22, 0x48, 0xEC, 0xFB, 0x91, 0xA2, 0xA3, 0xC7, 0xE9,
+    0x68, 0x21, 0x15, 0x69, 0x41, 0x8B, 0xD4, 0x6B, 0xE2, 0x1C, 0xE9, 0x74, 0xE4, 0x7D, 0xCB, 0x63,
+    0xF8, 0xD8, 0x01, 0xA4, 0xB6, 0x11, 0x25, 0x43, 0x33, 0x29, 0xE9, 0xEF, 0xF5, 0x54, 0x56, 0x79,
+    0x0C, 0xB7, 0x9E, 0x06, 0x0C, 0x89, 0xFC, 0x87, 0x06, 0x1A, 0x11, 0x38, 0x79, 0x58, 0xAD, 0xA9,
+    0xFE, 0xD1, 0xA9, 0xB2, 0x90, 0xCB, 0x08, 0x45, 0xC4, 0xC4, 0x71, 0x8D, 0x84, 0xBB, 0xEB, 0x46,
+    0xCF, 0x00, 0x3C, 0xF8, 0xAB, 0xC2, 0x27, 0x7B, 0x2A, 0xA0, 0x86, 0xFB, 0x33, 0x8F, 0xEE, 0x9F,
+    0x2C, 0x1C, 0xC5, 0xF4, 0xEE, 0xAD, 0xF0, 0xD9, 0x2D, 0x1C, 0x24, 0x5D, 0x05, 0x64, 0x4F, 0x05,
+    0xE0, 0xFE, 0xDB, 0xC0, 0x87, 0x95, 0xEC, 0xAB, 0x45, 0x68, 0x44, 0xC9, 0xA1, 0x0C, 0x5A, 0x5E,
+    0x6E, 0x98, 0x59, 0x1E, 0xE5, 0x31, 0x68, 0x47, 0xC0, 0x64, 0x8F, 0x78, 0xA6, 0xFB, 0xB4, 0x4B,
+    0xE4, 0x3F, 0x37, 0xA4, 0x22, 0x01, 0x2E, 0xFF, 0xD4, 0xC3, 0x7D, 0xDA, 0xC1, 0x13, 0x06, 0xB0,
+    0x2B, 0x76, 0x21, 0x95, 0x09, 0x0A, 0x09, 0x95, 0x78, 0xC8, 0x65, 0x02, 0x3E, 0x39, 0xAE, 0x37,
+    0xD0, 0x88, 0xC9, 0xEF, 0xBD, 0x3C, 0xF5, 0x2D, 0x28, 0x45, 0x06, 0xD2, 0x28, 0x7C, 0xBD, 0x9E,
+    0x88, 0x8D, 0xCA, 0x85, 0xD2, 0x51, 0xBA, 0x34, 0x90, 0x04, 0x4A, 0x47, 0xF1, 0x7E, 0x97, 0x23,
+    0xC9, 0x98, 0xC9, 0x94, 0xC8, 0xD4, 0x48, 0x67, 0xA4, 0xE3, 0x1C, 0x90, 0x8A, 0x03, 0xAA, 0x00,
+    0x70, 0xDE, 0xAD, 0x71, 0xA5, 0x78, 0xCF, 0x65, 0x72, 0x0E, 0x8A, 0x17, 0xA4, 0x27, 0x19, 0x45,
+    0x1C, 0x85, 0xFC, 0xE9, 0x44, 0x22, 0x56, 0xFB, 0x08, 0xF6, 0x24, 0xA0, 0x7A, 0x0A, 0x87, 0xB1,
+    0xBF, 0xCA, 0x65, 0x21, 0xAE, 0x94, 0xAB, 0x12, 0xA2, 0x18, 0x9B, 0x9C, 0x8B, 0xDC, 0xE8, 0x08,
+    0xE4, 0x51, 0xC3, 0x22, 0x0F, 0x35, 0x1D, 0x34, 0x16, 0xB1, 0x14, 0x2D, 0x2A, 0xE4, 0x6A, 0x80,
+    0xF2, 0x85, 0xAE, 0xB2, 0x24, 0xE3, 0x66, 0xEE, 0xA1, 0x78, 0xA5, 0x9B, 0x20, 0x19, 0xCD, 0xB7,
+    0xDF, 0x5D, 0x2C, 0xCE, 0xBF, 0x22, 0xC7, 0x56, 0x9F, 0x9B, 0x69, 0xAB, 0xEE, 0x8E, 0x11, 0x5A,
+    0x1D, 0xD7, 0x61, 0x63, 0x01, 0x54, 0xA4, 0x1B, 0x26, 0x56, 0x90, 0x96, 0xC4, 0x92, 0xC9, 0xE1,
+    0xE5, 0x61, 0xAD, 0x69, 0x2D, 0x45, 0x2C, 0xB0, 0xB1, 0x58, 0xB1, 0x66, 0x94, 0x52, 0x93, 0x88,
+    0x78, 0x54, 0x9F, 0x0D, 0x1F, 0xD7, 0x6D, 0x12, 0xCE, 0x6A, 0xC7, 0x78, 0xB6, 0xAC, 0x19, 0x4D,
+    0xF5, 0xCC, 0x62, 0x34, 0x22, 0x32, 0xE6, 0x22, 0x12, 0x66, 0x6C, 0xB7, 0x2B, 0xF6, 0xB0, 0x74,
+    0xAB, 0x0E, 0xE4, 0xD3, 0x62, 0x17, 0x35, 0xEF, 0x85, 0x1D, 0x24, 0x47, 0xDF, 0xFF, 0x7D, 0x83,
+    0x40, 0x11, 0x21, 0x90, 0xBF, 0x7B, 0x8C, 0xC2, 0xCE, 0xC4, 0x2C, 0x92, 0xB1, 0xA8, 0xD5, 0x8B,
+    0x2A, 0x36, 0xA8, 0x7F, 0xBB, 0x80, 0x52, 0xC3, 0x4A, 0xBD, 0x9B, 0xAC, 0x4F, 0x1C, 0x9D, 0xEE,
+    0xA4, 0x92, 0x77, 0x44, 0x9E, 0xAA, 0x5A, 0x1A, 0xD2, 0x40, 0xEE, 0x29, 0xDD, 0x87, 0xBA, 0x1C,
+    0x13, 0x91, 0x6B, 0x22, 0x40, 0xDA, 0x46, 0x5A, 0x97, 0x0C, 0xEC, 0x44, 0xE0, 0x58, 0x53, 0x03,
+    0xE4, 0x53, 0x54, 0x0E, 0x50, 0xC9, 0xAC, 0x74, 0xBD, 0x93, 0xDB, 0x1C, 0xAA, 0xA7, 0x91, 0x56,
+    0xF5, 0x89, 0x58, 0x23, 0x5E, 0x09, 0x95, 0xA7, 0xAA, 0x53, 0xA9, 0xFF, 0x60, 0x1F, 0xDD, 0x26,
+    0xE3, 0x16, 0x79, 0xAB, 0x7A, 0x02, 0x10, 0x18, 0xD9, 0x06, 0xB4, 0x35, 0x76, 0x13, 0x48, 0xBD,
+    0x6E, 0x4B, 0x80, 0xB3, 0xAA, 0xD7, 0x16, 0xC8, 0xDC, 0x18, 0x35, 0x20, 0x22, 0xD2, 0xCE, 0x0C,
+    0x7C, 0x00, 0x30, 0x8F, 0xF4, 0xC6, 0x02, 0x65, 0x3D, 0x66, 0x1E, 0x28, 0x9C, 0xB1, 0x13, 0xA0,
+    0x3B, 0xDD, 0x16, 0x2D, 0xE4, 0x3E, 0x2A, 0xA0, 0xB2, 0x81, 0x11, 0xE3, 0x50, 0x21, 0xEA, 0xA0,
+    0xD4, 0x88, 0x6E, 0x11, 0xAB, 0x26, 0xD4, 0x01, 0x45, 0xAF, 0x84, 0x52, 0xFA, 0x54, 0x1E, 0x11,
+    0xB4, 0x8C, 0x14, 0xC3, 0x5F, 0xC6, 0x41, 0xFC, 0x39, 0x7C, 0x8F, 0xEF, 0x01, 0x59, 0xAB, 0xE2,
+    0xF7, 0x0B, 0x07, 0x98, 0x67, 0x22, 0xA9, 0x8A, 0x9D, 0xD9, 0x38, 0x77, 0xA4, 0x7A, 0xB6, 0x40,
+    0x62, 0x8B, 0xB6, 0x10, 0x57, 0xBA, 0xAA, 0xAD, 0xA6, 0x54, 0x78, 0xCC, 0x15, 0xAE, 0xF8, 0x16,
+    0xBA, 0xDE, 0x64, 0x80, 0x82, 0x21, 0x77, 0x70, 0x5A, 0x75, 0x67, 0x81, 0x33, 0xFA, 0xEB, 0x1E,
+    0xD8, 0x6F, 0x2E, 0x5B, 0x50, 0x22, 0x13, 0x50, 0x7E, 0xC3, 0x07, 0x20, 0xE8, 0xA7, 0x02, 0xE8,
+    0x76, 0x53, 0xF5, 0x50, 0x31, 0x64, 0x1E, 0xD5, 0xAB, 0x4E, 0x77, 0x18, 0xA7, 0x6B, 0xDD, 0xAA,
+    0x90, 0x4A, 0x57, 0x74, 0xC6, 0x95, 0xE2, 0xCA, 0xEE, 0x5C, 0xB4, 0x3B, 0xC4, 0xAD, 0x56, 0x02,
+    0xC5, 0x5B, 0x32, 0x51, 0x86, 0xC7, 0x7A, 0x4A, 0x49, 0x03, 0xC5, 0xCB, 0xB6, 0x41, 0x3B, 0x4A,
+    0xA7, 0x1D, 0xB9, 0xCF, 0x5B, 0xD2, 0x90, 0x75, 0xD0, 0x28, 0x0F, 0xE5, 0x0B, 0xC3, 0xBC, 0xD2,
+    0x52, 0x11, 0x71, 0x34, 0xCF, 0x34, 0x81, 0xD2, 0x21, 0x2E, 0xF7, 0xE8, 0x3E, 0xEA, 0x6D, 0x1B,
+    0x30, 0xAE, 0x74, 0xE4, 0x3E, 0xF7, 0xA4, 0x21, 0x0D, 0xD0, 0xD0, 0x58, 0xCA, 0x17, 0x45, 0xD0,
+    0x3F, 0x16, 0x71, 0xAA, 0x5F, 0x93, 0xEB, 0x91, 0x35, 0x0F, 0x06, 0x3C, 0x2A, 0x40, 0x33, 0xCD,
+    0xCA, 0x02, 0x60, 0xA3, 0x94, 0x56, 0xBF, 0x25, 0x5E, 0x87, 0xA2, 0xD5, 0x6F, 0x28, 0x9F, 0x39,
+    0x82, 0x6A, 0x31, 0xA9, 0x47, 0x3B, 0x8F, 0x3A, 0x9C, 0x2C, 0x22, 0x23, 0x66, 0x29, 0xAD, 0x76,
+    0x59, 0x50, 0x9E, 0xCA, 0x06, 0x74, 0x67, 0x48, 0x83, 0x76, 0x54, 0xA5, 0xD8, 0xE2, 0xBA, 0xB4,
+    0x99, 0x8F, 0x82, 0x20, 0xE3, 0xBC, 0x9D, 0x96, 0x35, 0x94, 0x8E, 0xA4, 0x71, 0x28, 0x71, 0xF0,
+    0x35, 0x1B, 0x95, 0x31, 0x01, 0x23, 0x22, 0x03, 0x1B, 0xB2, 0x94, 0x1A, 0x76, 0xA9, 0xB8, 0xDD,
+    0x39, 0x50, 0x01, 0xC3, 0xAD, 0xE7, 0xA4, 0xA7, 0x82, 0xC4, 0x53, 0x41, 0xEA, 0xA9, 0x40, 0x79,
+    0x2A, 0xC8, 0x5A, 0x2A, 0xC8, 0x1D, 0x15, 0x68, 0x47, 0x05, 0xA5, 0xA5, 0xE2, 0xC1, 0x06, 0x2A,
+    0xAA, 0x00, 0x8D, 0x6D, 0x7A, 0x0A, 0x09, 0x55, 0x8B, 0x91, 0xF0, 0x4F, 0xD7, 0xDB, 0x49, 0x64,
+    0x2E, 0x22, 0xF9, 0xC8, 0xDA, 0x23, 0xCD, 0x9A, 0x26, 0x8A, 0x80, 0x89, 0x88, 0x84, 0x44, 0x44,
+    0x06, 0xEE, 0xFD, 0x87, 0xAA, 0x26, 0x73, 0xC6, 0x1E, 0x3B, 0xE5, 0xB5, 0xB1, 0xE8, 0xDA, 0x58,
+    0xB4, 0x35, 0x16, 0x8D, 0xB1, 0x14, 0x18, 0x4B, 0x89, 0xB1, 0x9C, 0xC5, 0xD8, 0x4F, 0xEF, 0x62,
+    0x6C, 0xD5, 0x63, 0xEA, 0xCA, 0xA7, 0x32, 0x56, 0x2E, 0x97, 0xF1, 0xD4, 0xCC, 0xE2, 0x26, 0xFD,
+    0x8A, 0x76, 0xA8, 0x76, 0xA5, 0x4D, 0xCC, 0xF8, 0xFD, 0xD0, 0x87, 0x66, 0x3E, 0x13, 0x81, 0x8A,
+    0x46, 0xFC, 0xCA, 0xEA, 0xB6, 0x7F, 0x4C, 0x1D, 0x3A, 0x73, 0xB8, 0x0D, 0xC0, 0xA9, 0xA6, 0x05,
+    0x54, 0xB4, 0x08, 0x9E, 0x7C, 0x8E, 0xA8, 0xE3, 0xBB, 0x2C, 0xAD, 0x91, 0xB6, 0xAA, 0x93, 0x06,
+    0xDD, 0x52, 0xB8, 0xA8, 0xAA, 0x1B, 0x49, 0x42, 0xD4, 0x73, 0xEA, 0xC3, 0x65, 0xE3, 0xA2, 0x76,
+    0x6F, 0x5A, 0x7C, 0x79, 0xF5, 0xF0, 0xD6, 0x9A, 0x35, 0x15, 0xCD, 0x44, 0xE1, 0x1A, 0xA9, 0xF3,
+    0x8E, 0x19, 0xCB, 0x8E, 0x89, 0xED, 0xE5, 0x8A, 0x3E, 0x27, 0x4D, 0x0B, 0x4A, 0x5A, 0x22, 0xB2,
+    0xFD, 0x9E, 0xA8, 0x95, 0xFB, 0x59, 0xFF, 0xB9, 0x52, 0x7F, 0x1E, 0xA9, 0xC7, 0x4A, 0x7B, 0x6C,
+    0xE7, 0xDA, 0x3E, 0xAE, 0x5C, 0xF6, 0x33, 0xF2, 0x7D, 0xA4, 0x60, 0x6C, 0x68, 0x22, 0xB3, 0x35,
+    0xAB, 0x94, 0xF3, 0x76, 0xDD, 0x7A, 0xBF, 0xE6, 0x6F, 0x1F, 0x00, 0xF8, 0x04, 0xBF, 0x2B, 0x01,
+    0x60, 0xCD, 0xE0, 0x46, 0xD1, 0xBC, 0x3A, 0xB2, 0xA0, 0xC6, 0x8E, 0x46, 0x21, 0xE0, 0x34, 0x00,
+    0x4F, 0xAC, 0x76, 0xF7, 0x0F, 0x66, 0x84, 0x51, 0x9E, 0x09, 0xED, 0x12, 0xF9, 0x0F, 0x6B, 0x46,
+    0xF8, 0x3F, 0xF9, 0xD5, 0xB7, 0xCC, 0xAA, 0x81, 0xE3, 0x8C, 0xF0, 0xDC, 0xF0, 0xB0, 0x92, 0xD8,
+    0xB4, 0x5D, 0x69, 0xC8, 0x1E, 0x87, 0x5C, 0x3C, 0x34, 0x23, 0x8D, 0x80, 0x16, 0x47, 0xD5, 0x93,
+    0x48, 0x8B, 0x92, 0x1A, 0x33, 0xC0, 0x66, 0x40, 0x5D, 0x77, 0xA8, 0x97, 0x5A, 0x2E, 0x04, 0xB8,
+    0xB0, 0x8F, 0xFE, 0xA6, 0x23, 0x7B, 0xD1, 0xD3, 0x07, 0xD8, 0x35, 0x94, 0xDA, 0x91, 0xBF, 0x30,
+    0xA8, 0x6E, 0x84, 0xDD, 0xC2, 0x9D, 0xC9, 0x5B, 0x74, 0x1D, 0x72, 0xB7, 0x07, 0x43, 0xDE, 0x0E,
+    0x79, 0x87, 0xAE, 0x8D, 0x66, 0x07, 0x7A, 0xF5, 0x8E, 0xCF, 0x3A, 0xB4, 0x2D, 0xB7, 0xA9, 0x48,
+    0x7A, 0xC4, 0x29, 0x4F, 0x61, 0xF5, 0x80, 0x21, 0x9D, 0x65, 0x9D, 0x72, 0x96, 0x70, 0x7A, 0x4E,
+    0xA3, 0x86, 0x4C, 0x02, 0x64, 0x32, 0x36, 0xE2, 0x56, 0x16, 0xA1, 0x23, 0x59, 0xD4, 0xD8, 0x9B,
+    0xB4, 0xB1, 0x11, 0xE3, 0x56, 0x26, 0xE9, 0x19, 0xE7, 0xF8, 0x03, 0x4C, 0x80, 0x6A, 0x30, 0x13,
+    0x48, 0xAF, 0x84, 0x44, 0x6A, 0x75, 0xDD, 0xAA, 0xEB, 0x56, 0xBD, 0xE6, 0xB2, 0xD7, 0xAC, 0xFA,
+    0x61, 0xAB, 0x1F, 0xB3, 0xEA, 0x15, 0xAF, 0x0B, 0xAB, 0x7E, 0xD0, 0x3F, 0x50, 0x58, 0xD5, 0x0E,
+    0x67, 0x0A, 0xAB, 0xDA, 0xDD, 0xEF, 0x15, 0x56, 0xB5, 0xC6, 0x17, 0x56, 0xB5, 0x65, 0x57, 0x58,
+    0xD5, 0x16, 0xAE, 0xB0, 0xAA, 0xD5, 0x75, 0x61, 0x55, 0xB7, 0x41, 0x51, 0x97, 0x42, 0x22, 0x63,
+    0x23, 0xCC, 0xA2, 0x7E, 0x9C, 0xD9, 0x68, 0xC9, 0x8F, 0x06, 0xF2, 0x28, 0x20, 0x47, 0xAB, 0x8A,
+    0xB2, 0x90, 0x88, 0xBC, 0x28, 0x07, 0x11, 0xF3, 0xB2, 0x23, 0xD6, 0xFE, 0xC3, 0x5E, 0xDA, 0x52,
+    0xDE, 0x16, 0x71, 0xE4, 0xB5, 0x6A, 0x41, 0x79, 0x02, 0x30, 0xB2, 0x0F, 0x14, 0x87, 0x02, 0x24,
+    0xCD, 0xC4, 0xED, 0x8F, 0xC8, 0xC7, 0x25, 0xB1, 0x38, 0x02, 0xB2, 0xEA, 0x59, 0xEB, 0xDB, 0xF4,
+    0xB7, 0x1D, 0x90, 0x5F, 0xED, 0x01, 0xD5, 0x35, 0x40, 0xD2, 0x17, 0x0E, 0x08, 0x6A, 0x00, 0x36,
+    0x69, 0x80, 0x12, 0xDD, 0x82, 0x76, 0x6A, 0x80, 0xEC, 0x70, 0x29, 0xA0, 0x44, 0xA4, 0x25, 0x99,
+    0x96, 0x97, 0x06, 0xD8, 0x83, 0x06, 0x0C, 0xE8, 0x96, 0xD2, 0xA2, 0x02, 0xDA, 0x41, 0x45, 0xE6,
+    0xA1, 0xE8, 0x0A, 0x69, 0x69, 0xE4, 0x25, 0xE9, 0xA9, 0xC4, 0xE7, 0x36, 0xAB, 0x93, 0x81, 0x80,
+    0x76, 0xDA, 0xD1, 0xFC, 0xE9, 0x10, 0x71, 0x35, 0x32, 0xE9, 0x00, 0x8B, 0x79, 0x5B, 0xAF, 0x24,
+    0x50, 0xB4, 0xA5, 0x53, 0x03, 0x23, 0xA5, 0xCD, 0x3B, 0xB6, 0xD8, 0x07, 0xF2, 0x0E, 0x4E, 0x4D,
+    0x24, 0x8D, 0x74, 0xC8, 0x34, 0x61, 0xDA, 0xBC, 0x53, 0x9E, 0x7D, 0x2A, 0xF2, 0x2E, 0xF3, 0x4C,
+    0x98, 0xB6, 0x3A, 0x78, 0x58, 0xA4, 0x0A, 0xB9, 0xBC, 0x2C, 0x6C, 0xD8, 0x64, 0x0D, 0x89, 0x41,
+    0x79, 0x40, 0x1E, 0x9E, 0x00, 0xD3, 0x36, 0x16, 0xB2, 0x4E, 0xD7, 0xFF, 0x35, 0x80, 0x2D, 0xB1,
+    0x1B, 0x20, 0x2A, 0xA0, 0xBD, 0x71, 0x4C, 0x6A, 0x20, 0xB1, 0x1B, 0xC7, 0xBB, 0xFB, 0x5B, 0x02,
+    0x9B, 0x44, 0xE6, 0x58, 0x89, 0x88, 0xD4, 0x90, 0xC8, 0xE1, 0x72, 0x02, 0xF2, 0xEB, 0x8E, 0x01,
+    0xD8, 0x6E, 0x48, 0x3B, 0x50, 0xEF, 0x04, 0x32, 0x0B, 0x45, 0x3E, 0x6B, 0x62, 0xA2, 0x61, 0x24,
+    0x77, 0x4D, 0x94, 0x65, 0xE2, 0xBA, 0x4D, 0x7D, 0x2E, 0xD2, 0x41, 0x61, 0x4B, 0x91, 0x1A, 0x02,
+    0xCD, 0xF2, 0x3B, 0x90, 0x1D, 0x5E, 0x0A, 0xB3, 0x1F, 0x8E, 0x07, 0xD2, 0xC3, 0x65, 0xE3, 0x00,
+    0x5D, 0xD3, 0xC0, 0x9D, 0x04, 0xD2, 0x40, 0xDA, 0x66, 0x1D, 0xB9, 0x47, 0x5B, 0x03, 0xA5, 0x63,
+    0x3B, 0x1D, 0x40, 0xBE, 0x7C, 0xC9, 0x37, 0x62, 0x2B, 0x11, 0xB9, 0x2A, 0x63, 0x1A, 0xAD, 0x63,
+    0x1B, 0x5B, 0x9C, 0x82, 0x52, 0x1E, 0x92, 0x40, 0x25, 0x6F, 0x8B, 0xB8, 0xCA, 0x36, 0x43, 0x36,
+    0x98, 0x5A, 0x07, 0xAA, 0xBC, 0x4D, 0x47, 0x74, 0xBB, 0x45, 0x83, 0xEA, 0xA1, 0xFC, 0xFB, 0x4B,
+    0x23, 0x27, 0x1A, 0x11, 0xB1, 0x95, 0xC8, 0x9B, 0xE7, 0x90, 0x37, 0xF6, 0x01, 0xA1, 0xAC, 0xC1,
+    0xC4, 0x79, 0x70, 0x8C, 0x90, 0x79, 0xAA, 0x16, 0xE4, 0x21, 0x91, 0xC5, 0x6E, 0x29, 0x63, 0x25,
+    0x92, 0xCA, 0xA0, 0x64, 0x62, 0x63, 0x8B, 0x8D, 0x73, 0xF0, 0x3D, 0x9E, 0x24, 0x6F, 0xD3, 0x9E,
+    0xC2, 0xE9, 0x16, 0x73, 0x63, 0x82, 0x42, 0x5A, 0xC0, 0x1E, 0x9B, 0xA3, 0x4A, 0x44, 0x7E, 0x2C,
+    0x22, 0xF2, 0x54, 0xF5, 0xE6, 0x52, 0x68, 0xA2, 0x25, 0x39, 0xED, 0x72, 0x4F, 0x66, 0x4B, 0x37,
+    0xF3, 0x20, 0x69, 0x58, 0x29, 0xFB, 0x4B, 0x11, 0x4F, 0x23, 0x52, 0xA7, 0xD3, 0xF2, 0xBB, 0xF3,
+    0xA3, 0xE3, 0xB5, 0xEE, 0xCC, 0x3D, 0x69, 0x5B, 0x3A, 0x74, 0xDD, 0xC0, 0x76, 0x3A, 0x7E, 0xE5,
+    0xD2, 0xBB, 0x22, 0x22, 0xD7, 0xE2, 0x3E, 0xEF, 0x54, 0x5B, 0x5A, 0xED, 0xF6, 0xA9, 0x98, 0x1E,
+    0xED, 0x11, 0xB1, 0x9C, 0x9A, 0xBB, 0x73, 0x0E, 0x2A, 0xB1, 0x5A, 0xC4, 0x4E, 0x48, 0xD6, 0x31,
+    0x1A, 0xD2, 0x21, 0x90, 0xFD, 0xF4, 0xDD, 0xC5, 0xF9, 0xCB, 0x22, 0x53, 0x23, 0xF2, 0xF3, 0x21,
+    0x22, 0x4D, 0xE1, 0x22, 0xBD, 0x15, 0x4B, 0x22, 0x6F, 0x3C, 0xFA, 0x70, 0x64, 0x22, 0x5B, 0x4E,
+    0x6D, 0xCD, 0xAB, 0xB6, 0x92, 0xD7, 0xA3, 0x90, 0x51, 0x1C, 0xFC, 0xA1, 0x38, 0x63, 0xA9, 0xBA,
+    0xB3, 0xA0, 0xFB, 0xCF, 0xCC, 0x12, 0x70, 0x1A, 0xD6, 0x06, 0xBF, 0x69, 0xC5, 0xC1, 0x23, 0x9F,
+    0x5D, 0x2E, 0x97, 0x62, 0x44, 0x44, 0xAA, 0xE5, 0x72, 0x29, 0x15, 0x30, 0x55, 0xC0, 0x58, 0x41,
+    0x12, 0x0C, 0xA8, 0xC1, 0xD4, 0x64, 0xBE, 0x6C, 0x29, 0x3A, 0x7D, 0x90, 0x34, 0x75, 0x14, 0x64,
+    0x1A, 0xE9, 0xE0, 0xC4, 0x77, 0xA3, 0xB7, 0x4F, 0x2E, 0x7D, 0x22, 0xD2, 0xEB, 0x8B, 0x45, 0xFF,
+    0x79, 0xB4, 0x8F, 0x0C, 0x9D, 0xA9, 0x61, 0x1F, 0x92, 0x51, 0x44, 0x6E, 0x88, 0xC8, 0xF5, 0x37,
+    0x97, 0xFB, 0xFB, 0xA4, 0x3F, 0x1F, 0xD0, 0x2F, 0x7A, 0x2A, 0xED, 0x33, 0xAF, 0x45, 0x6C, 0x2E,
+    0x7E, 0x56, 0x0A, 0x00, 0xEC, 0x10, 0x40, 0x1E, 0x1E, 0x41, 0xD2, 0x11, 0x76, 0x18, 0x6E, 0xA2,
+    0x05, 0xBF, 0xC3, 0x71, 0x6E, 0xD8, 0x0D, 0x2A, 0x3B, 0xA6, 0x53, 0x36, 0x64, 0x7D, 0xD1, 0x26,
+    0xDC, 0xB1, 0xEE, 0xD6, 0xC6, 0x16, 0xA9, 0x8C, 0x54, 0x32, 0xAA, 0xD7, 0xB3, 0xF1, 0xE3, 0xA8,
+    0x10, 0xA5, 0x00, 0xDD, 0x45, 0x5E, 0xB2, 0xAA, 0x44, 0x26, 0x11, 0xB9, 0x71, 0xB8, 0xBC, 0x7C,
+    0xB9, 0x66, 0x6F, 0x1F, 0xF5, 0x76, 0xA0, 0xB8, 0x1A, 0x92, 0xA0, 0x44, 0xDA, 0x54, 0x42, 0xA4,
+    0x1B, 0x47, 0xC7, 0xCE, 0xCC, 0xD0, 0x19, 0x27, 0x36, 0xEA, 0x33, 0xA2, 0x71, 0x2B, 0xE9, 0xB3,
+    0x8E, 0xF7, 0x3F, 0xFE, 0xFF, 0x22, 0x96, 0xDF, 0xC5, 0x16, 0xA0, 0x06, 0xDD, 0x01, 0x85, 0xAF,
+    0x1C, 0x10, 0x1B, 0xE1, 0x4E, 0xB6, 0x6E, 0xDD, 0x20, 0x7E, 0x2F, 0xC4, 0xF2, 0xBD, 0x64, 0xC0,
+    0x38, 0x41, 0x7B, 0xE3, 0xD2, 0x3E, 0xCA, 0x7D, 0xF1, 0x38, 0xB5, 0x45, 0x22, 0xE2, 0x32, 0x91,
+    0x31, 0x99, 0x6C, 0xE3, 0xF6, 0xC8, 0x86, 0x12, 0xA6, 0xDC, 0x51, 0x3E, 0xD5, 0xA1, 0x67, 0x53,
+    0x5E, 0x1A, 0x20, 0x09, 0xA4, 0x51, 0x0D, 0xD4, 0x72, 0xE2, 0xF2, 0x08, 0x54, 0x0E, 0xB2, 0x61,
+    0x46, 0x65, 0x73, 0x0D, 0xF4, 0x4F, 0x5B, 0xB2, 0x5F, 0x04, 0x54, 0x68, 0xDA, 0x6C, 0xD4, 0x22,
+    0x23, 0x95, 0x0C, 0xF0, 0xB5, 0x2D, 0x36, 0xB8, 0x4B, 0x85, 0xDC, 0x1B, 0x27, 0x2A, 0xE4, 0x7E,
+    0x83, 0xBB, 0xD6, 0x10, 0x3A, 0x47, 0x26, 0x21, 0x15, 0xF1, 0x9B, 0x34, 0x4F, 0xDB, 0x74, 0x80,
+    0xA2, 0x26, 0xF5, 0xB0, 0x43, 0x2E, 0x8E, 0x46, 0xE0, 0xDE, 0x10, 0xF9, 0xD7, 0xF1, 0x33, 0xE8,
+    0x57, 0x1D, 0x61, 0xA2, 0xFA, 0x86, 0x48, 0x57, 0x48, 0xCF, 0xC6, 0x16, 0x85, 0x88, 0xE4, 0x22,
+    0xF2, 0x8A, 0x2C, 0x2F, 0xFB, 0x40, 0xE6, 0x37, 0xC9, 0x7A, 0x6D, 0x55, 0x9F, 0xD4, 0xAA, 0x8F,
+    0xFD, 0x57, 0x3D, 0xA8, 0xC9, 0x92, 0xC8, 0x08, 0xFF, 0x4C, 0x3A, 0xC8, 0xC6, 0xD9, 0xCB, 0x32,
+    0xF7, 0x2B, 0x29, 0xDE, 0x42, 0xF1, 0x22, 0xE4, 0x3F, 0xEB, 0xC9, 0x7A, 0xB9, 0x78, 0x6F, 0x28,
+    0x44, 0x02, 0x8D, 0xF4, 0x24, 0x5F, 0xB3, 0x14, 0x22, 0x43, 0x29, 0x12, 0xCA, 0x67, 0x1E, 0x1D,
+    0x36, 0xD1, 0xDD, 0x19, 0xCA, 0xFA, 0x6E, 0xF6, 0x23, 0x43, 0x17, 0x7D, 0x7F, 0xE2, 0x37, 0xAA,
+    0x71, 0x56, 0x50, 0x55, 0x5D, 0xB4, 0x53, 0xA9, 0xB0, 0x06, 0xE0, 0xFC, 0xFF, 0x1D, 0xA4, 0xC3,
+    0x19, 0x32, 0x5F, 0xD9, 0xB2, 0x35, 0x22, 0x75, 0x2E, 0x63, 0x14, 0xE2, 0x58, 0x2C, 0xB6, 0xD6,
+    0x96, 0xBA, 0x68, 0xAF, 0x66, 0x63, 0x71, 0xEE, 0xB6, 0xEB, 0x29, 0x93, 0x89, 0x42, 0x42, 0x23,
+    0x6D, 0x12, 0x15, 0x6E, 0x49, 0x63, 0x8F, 0xC9, 0x63, 0x42, 0x1A, 0xC0, 0x78, 0x4A, 0x87, 0x16,
+    0xD2, 0x80, 0xBA, 0xE1, 0x29, 0x1D, 0x63, 0x45, 0x1A, 0x30, 0x5F, 0xF0, 0x94, 0x4E, 0xB7, 0x15,
+    0x69, 0x50, 0x7D, 0xE6, 0x29, 0xDD, 0x48, 0x45, 0x1A, 0x8C, 0xCD, 0x3C, 0xE5, 0x4B, 0x2D, 0x15,
+    0xA9, 0xF4, 0x64, 0x9E, 0x72, 0x8A, 0xE2, 0x61, 0x4D, 0xE6, 0x29, 0xBB, 0xE3, 0x72, 0x5F, 0x0B,
+    0x8D, 0xAD, 0xA4, 0xA3, 0x91, 0x6B, 0xB1, 0x3B, 0x9C, 0x5C, 0xFE, 0x2D, 0xE4, 0x22, 0x35, 0x6A,
+    0x5E, 0x9B, 0xEF, 0x39, 0x52, 0x19, 0x53, 0x19, 0x1B, 0xA1, 0x91, 0x24, 0x8A, 0x6B, 0xD0, 0xA0,
+    0x1D, 0x8D, 0x53, 0x9E, 0xC6, 0x13, 0xD8, 0x0B, 0x18, 0x42, 0x85, 0x76, 0xA1, 0x70, 0xCA, 0x87,
+    0xCC, 0x33, 0x0E, 0x49, 0xC0, 0x0C, 0x54, 0xE8, 0x81, 0xC2, 0x45, 0xF9, 0x2B, 0x90, 0x84, 0x54,
+    0x7A, 0x25, 0x3F, 0x97, 0x31, 0x5D, 0x39, 0x86, 0x40, 0x51, 0x57, 0x80, 0x0A, 0xBA, 0x5F, 0xD3,
+    0xA9, 0xF7, 0xA5, 0x4E, 0x95, 0x74, 0xC9, 0xFB, 0x0B, 0xCE, 0xDA, 0x53, 0x3A, 0x54, 0x84, 0xA6,
+    0x78, 0x4A, 0x87, 0x69, 0x48, 0x03, 0xFA, 0x87, 0x9E, 0xD2, 0xA9, 0xBE, 0x22, 0x0D, 0x8C, 0x99,
+    0xA7, 0x74, 0xC6, 0x56, 0xA4, 0x41, 0xB7, 0x99, 0xA7, 0xBC, 0xDA, 0x53, 0x91, 0x86, 0x91, 0xCC,
+    0x53, 0x8A, 0xA5, 0x22, 0x95, 0x8E, 0xCC, 0x53, 0x0E, 0x50, 0x91, 0x4E, 0xB7, 0x11, 0x9C, 0xA7,
+    0x28, 0x38, 0x77, 0x89, 0x88, 0x63, 0x83, 0xBB, 0x88, 0x8C, 0x9C, 0x0A, 0xDA, 0xC3, 0xA4, 0x06,
+    0x38, 0xB6, 0x6E, 0xD6, 0x47, 0x23, 0xB6, 0x91, 0xF3, 0xE2, 0x4A, 0x71, 0x95, 0xA5, 0x8A, 0xBA,
+    0x36, 0xE5, 0x29, 0x3D, 0x81, 0x32, 0x60, 0x28, 0x2B, 0xB4, 0x33, 0x85, 0x53, 0xDE, 0x64, 0x9E,
+    0x60, 0x92, 0x80, 0xD9, 0xA1, 0x42, 0x4F, 0x14, 0x4E, 0x4D, 0x64, 0x9E, 0x69, 0x9E, 0x86, 0x8A,
+    0x66, 0x44, 0xC6, 0x46, 0x6C, 0x23, 0x2B, 0xAE, 0x24, 0xF3, 0xDA, 0x81, 0xEE, 0xCB, 0x0E, 0x74,
+    0x5F, 0xB6, 0xB7, 0x65, 0x88, 0x37, 0xB6, 0x22, 0xC6, 0x5E, 0x84, 0x42, 0x24, 0x40, 0xF3, 0xFA,
+    0xBD, 0x42, 0x3A, 0x81, 0xB8, 0x6C, 0x00, 0xD3, 0x69, 0x0F, 0xDA, 0x17, 0x2D, 0xE4, 0xBD, 0x71,
+    0x90, 0x0D, 0xA6, 0x06, 0x15, 0x8C, 0x05, 0x15, 0x2A, 0x0B, 0xE9, 0x7B, 0xCE, 0x2A, 0x54, 0x35,
+    0xA8, 0xC1, 0x38, 0x50, 0xBD, 0x69, 0x21, 0xF7, 0x85, 0x07, 0xDD, 0xE9, 0x1E, 0x4A, 0x97, 0x8D,
+    0xD0, 0xD8, 0x54, 0xDA, 0x6C, 0x82, 0x4A, 0xA4, 0x9F, 0x51, 0x0F, 0xBE, 0x72, 0x11, 0xD8, 0x4A,
+    0x2C, 0xA5, 0xAB, 0x50, 0x63, 0xDE, 0x47, 0xD7, 0xC9, 0xAD, 0xE4, 0x38, 0xAF, 0x75, 0xCA, 0x46,
+    0x55, 0x6A, 0x21, 0xE2, 0xF2, 0x3E, 0x9B, 0x08, 0xE8, 0xBE, 0xAC, 0x31, 0x4F, 0x7B, 0xD2, 0x50,
+    0x41, 0x71, 0xCD, 0x93, 0x84, 0x06, 0xF4, 0x35, 0x0F, 0xA1, 0x81, 0xE2, 0xC5, 0x9E, 0x24, 0x98,
+    0x1A, 0xF3, 0xC8, 0x48, 0xE6, 0xF5, 0x90, 0x8E, 0x54, 0x22, 0x16, 0x91, 0x1A, 0xFE, 0xD2, 0xFE,
+    0x32, 0x50, 0xF4, 0x60, 0x3A, 0xDD, 0x81, 0xF6, 0x85, 0x5B, 0x81, 0x42, 0x0D, 0x37, 0x01, 0x61,
+    0xB9, 0x5C, 0x5E, 0x0A, 0xD1, 0xA3, 0xAB, 0x7A, 0x66, 0xB1, 0xF8, 0xD3, 0xE3, 0x00, 0x89, 0x40,
+    0xEB, 0x23, 0xE5, 0x2A, 0xBA, 0xDB, 0x80, 0x22, 0x7F, 0x0F, 0x28, 0xB6, 0x66, 0x8B, 0x40, 0x2A,
+    0x23, 0x89, 0x48, 0xA0, 0xB1, 0x55, 0xA7, 0x1D, 0xCD, 0xC3, 0x3D, 0x6A, 0x30, 0x50, 0xBC, 0xD8,
+    0x41, 0x68, 0x96, 0xCB, 0xCB, 0xD7, 0x44, 0x24, 0x34, 0x8B, 0xC5, 0x63, 0xD7, 0x3C, 0x84, 0x0A,
+    0x8A, 0xAB, 0x03, 0x69, 0x6F, 0x1C, 0x15, 0x62, 0xCB, 0x36, 0x13, 0xE9, 0xD1, 0x32, 0xC0, 0x89,
+    0x6F, 0x1D, 0x51, 0xA2, 0xDF, 0x18, 0x41, 0x7E, 0x57, 0x50, 0xF9, 0x35, 0x10, 0x24, 0xEF, 0x4B,
+    0x8B, 0x79, 0xDA, 0x93, 0x84, 0x1D, 0xD0, 0xD7, 0x0E, 0x97, 0xCB, 0xD0, 0x88, 0xC8, 0xB5, 0x77,
+    0x17, 0x8B, 0xD0, 0x80, 0x7E, 0xD1, 0x47, 0x04, 0x29, 0x1F, 0x09, 0x64, 0x5E, 0xF7, 0xEF, 0x45,
+    0x10, 0x20, 0x19, 0x32, 0x1F, 0xE9, 0x93, 0x0A, 0xBA, 0xBF, 0x2D, 0x71, 0x4A, 0x1A, 0xB9, 0x88,
+    0x16, 0x19, 0x29, 0x0E, 0x1E, 0x15, 0x5B, 0xD4, 0x54, 0x6D, 0x61, 0x29, 0x7C, 0x01, 0x79, 0xAF,
+    0xDF, 0xC3, 0x50, 0x26, 0x23, 0x85, 0xC8, 0x88, 0x16, 0x99, 0x38, 0xB9, 0x5C, 0x8E, 0xEB, 0x82,
+    0x75, 0x3D, 0x35, 0xDC, 0x07, 0xB9, 0x37, 0xA0, 0xBB, 0xAA, 0xA6, 0x72, 0xA6, 0x3F, 0x21, 0x51,
+    0x6F, 0x75, 0x42, 0xE4, 0x22, 0x9C, 0x3A, 0x17, 0x69, 0x4C, 0x93, 0x06, 0x15, 0x74, 0x9F, 0xFB,
+    0xD2, 0x1D, 0x27, 0x39, 0x1B, 0x5B, 0x9C, 0x90, 0x91, 0x4A, 0xA6, 0x23, 0x5E, 0x32, 0x5B, 0x73,
+    0xD4, 0x85, 0x4C, 0x54, 0x32, 0xB0, 0x78, 0xAC, 0x8B, 0xDA, 0xBE, 0xF0, 0x19, 0xD4, 0x3B, 0x1E,
+    0xF3, 0xA5, 0x3E, 0x0B, 0x85, 0x88, 0x2B, 0xA4, 0x9F, 0xB9, 0xE9, 0xC5, 0xC2, 0xAE, 0xF6, 0xB7,
+    0xB8, 0x4B, 0x24, 0x8B, 0x85, 0xBD, 0x2D, 0x6D, 0xF6, 0x4A, 0xA6, 0x46, 0xBC, 0x92, 0x31, 0x1F,
+    0xA1, 0x6C, 0xD3, 0x11, 0x4A, 0xCB, 0x44, 0xA4, 0x56, 0xEC, 0x11, 0x5D, 0xD0, 0x29, 0x5C, 0xD2,
+    0x83, 0xEE, 0x94, 0x87, 0xCC, 0x67, 0x2D, 0xA8, 0x41, 0x3B, 0x48, 0x42, 0x61, 0x81, 0xA9, 0x04,
+    0xA8, 0xB6, 0x8F, 0xDC, 0x46, 0xA2, 0x0B, 0x49, 0x7E, 0x4C, 0x15, 0xAE, 0x1D, 0xF0, 0xCF, 0x4B,
+    0x80, 0x9D, 0x7D, 0x80, 0x66, 0x80, 0xB8, 0x8F, 0xC3, 0x3D, 0x00, 0x7C, 0x76, 0xF9, 0x1C, 0x34,
+    0x32, 0xC0, 0x1C, 0x10, 0x72, 0x9B, 0x2E, 0x7F, 0x24, 0xCE, 0x45, 0xC9, 0x2D, 0xCE, 0x45, 0x6B,
+    0xFD, 0xB9, 0xF2, 0x70, 0xA7, 0x76, 0xF0, 0xFD, 0xC6, 0xCE, 0xBE, 0x90, 0xE2, 0x81, 0xCF, 0x1E,
+    0x83, 0x5F, 0xDA, 0xE7, 0x1D, 0x64, 0x41, 0xFB, 0xD5, 0x39, 0xF5, 0x79, 0xFB, 0x5F, 0x03, 0x7C,
+    0xEF, 0x62, 0x2B, 0xAA, 0x30, 0xE2, 0x69, 0x52, 0x61, 0xC5, 0x70, 0xFF, 0xDE, 0x01, 0x19, 0x2E,
+    0x26, 0x35, 0x28, 0x9F, 0xB7, 0xA0, 0x7D, 0xD9, 0x82, 0x69, 0x9B, 0x9A, 0x44, 0xD4, 0x08, 0xAA,
+    0xCF, 0x3B, 0x48, 0xEB, 0x13, 0xBF, 0xE7, 0x00, 0xC7, 0x7E, 0x0C, 0xE8, 0x0B, 0x48, 0x07, 0x63,
+    0x51, 0xBE, 0x82, 0xBC, 0x0D, 0xA0, 0xBF, 0xDE, 0xC3, 0xFD, 0xAA, 0x85, 0x3B, 0x6E, 0xD1, 0x4F,
+    0xFC, 0xEE, 0x41, 0x5F, 0xDA, 0x7D, 0x48, 0x44, 0x85, 0x15, 0x7A, 0xE7, 0xAE, 0xB8, 0x0D, 0xF9,
+    0xF8, 0x9D, 0xAB, 0xF5, 0xB5, 0x48, 0x44, 0x5F, 0x35, 0x68, 0x4F, 0xE1, 0x8D, 0xC3, 0xD4, 0xD3,
+    0xED, 0x30, 0xFA, 0x23, 0x57, 0xEA, 0x57, 0x22, 0x72, 0x5D, 0x44, 0xDE, 0xAE, 0xDE, 0x6C, 0x42,
+    0xEE, 0xD9, 0x49, 0x03, 0xBA, 0x6E, 0x50, 0x6D, 0xE9, 0xE8, 0x73, 0xCF, 0xDD, 0x69, 0x98, 0xB5,
+    0x44, 0xE5, 0x2C, 0x05, 0x7D, 0x88, 0x07, 0x23, 0x14, 0x32, 0xCD, 0x5B, 0xA8, 0x7E, 0x5F, 0x3F,
+    0xCF, 0xBB, 0xA1, 0x11, 0x79, 0x47, 0x44, 0x5C, 0xF5, 0x4C, 0xC3, 0xC8, 0xAE, 0xEA, 0x13, 0xAF,
+    0x5B, 0x55, 0x1B, 0xFB, 0x31, 0xC6, 0x59, 0x01, 0xD1, 0x46, 0x79, 0xE9, 0xF8, 0xED, 0xC5, 0xD9,
+    0x75, 0xBE, 0x9F, 0xC5, 0xA9, 0xE8, 0x8C, 0x94, 0x78, 0xC8, 0x6A, 0xF8, 0xF8, 0x71, 0xE9, 0xA7,
+    0x2B, 0xDC, 0x11, 0x8B, 0x8F, 0xA8, 0x11, 0xA0, 0xB0, 0x9B, 0xEF, 0xA7, 0x7E, 0xA8, 0xC4, 0x93,
+    0x8A, 0x5C, 0x8E, 0xB4, 0xFB, 0xE5, 0xAA, 0x85, 0x0D, 0xB1, 0xB9, 0x07, 0x4C, 0x1D, 0x43, 0x45,
+    0x3A, 0x1A, 0x40, 0x0D, 0xCC, 0x1E, 0xC7, 0xB7, 0x16, 0xFE, 0xAD, 0x45, 0x0D, 0x94, 0x22, 0x35,
+    0x13, 0xB9, 0xC8, 0x18, 0x0B, 0x1B, 0xA7, 0x3B, 0x1A, 0xD4, 0x10, 0xDF, 0x6C, 0xE2, 0x9B, 0x85,
+    0x33, 0x75, 0x1A, 0xC8, 0xBC, 0xEE, 0x68, 0xA2, 0x03, 0x79, 0xE9, 0x98, 0x62, 0x61, 0x63, 0x4D,
+    0x9D, 0x8E, 0x5F, 0x96, 0x5A, 0xF7, 0x45, 0x54, 0x2C, 0xBE, 0x25, 0x72, 0x80, 0x91, 0x23, 0x8D,
+    0x52, 0x64, 0x44, 0xA6, 0x18, 0xBD, 0xE2, 0x04, 0xD0, 0x9D, 0xA9, 0xB9, 0x95, 0x43, 0x39, 0x86,
+    0x41, 0x2E, 0x11, 0x39, 0x2F, 0x1D, 0x95, 0xB8, 0xCA, 0x92, 0x08, 0xDA, 0x41, 0x59, 0x2B, 0x0F,
+    0x79, 0x47, 0x80, 0x74, 0xC0, 0xFC, 0x89, 0x65, 0x1F, 0x2D, 0x62, 0xCB, 0x5A, 0x89, 0xF4, 0x79,
+    0x47, 0xA0, 0x49, 0x07, 0x0C, 0xDA, 0xED, 0xA3, 0x5D, 0xDA, 0x97, 0xB5, 0xF2, 0xEC, 0xE6, 0x1D,
+    0x01, 0x93, 0x0E, 0x18, 0xAA, 0xBA, 0xA1, 0x11, 0x79, 0x4A, 0xC6, 0x46, 0x26, 0x2B, 0x2B, 0xB9,
+    0xA0, 0x90, 0x38, 0xC5, 0xB2, 0x21, 0x4B, 0xF1, 0xB9, 0x67, 0x87, 0x06, 0xD5, 0xE5, 0x9E, 0xB3,
+    0x34, 0xA8, 0x36, 0xF7, 0xDC, 0x4D, 0x33, 0x53, 0xA4, 0x53, 0xB2, 0xB0, 0x4A, 0x24, 0xF0, 0x59,
+    0x59, 0xD6, 0x11, 0xB0, 0xAB, 0xA2, 0xDB, 0x5D, 0x58, 0x12, 0x91, 0x9E, 0x32, 0xDA, 0x74, 0x2E,
+    0xAC, 0x8C, 0x24, 0x17, 0x20, 0xC9, 0x5D, 0x24, 0x63, 0xF9, 0x14, 0x89, 0xC2, 0xFB, 0x23, 0xDA,
+    0x3D, 0xD3, 0x77, 0x10, 0xE9, 0x93, 0xC7, 0xDE, 0xB0, 0xEF, 0x41, 0xB4, 0x9A, 0x5C, 0x86, 0x88,
+    0x68, 0x69, 0x17, 0xB1, 0xEB, 0x34, 0xFC, 0x45, 0x4F, 0x2A, 0x2E, 0xEA, 0x34, 0xF8, 0xAD, 0xF9,
+    0xA9, 0xD6, 0x1F, 0xC2, 0x4F, 0xB5, 0xAA, 0x2B, 0x71, 0x18, 0xD7, 0x88, 0x8B, 0xEE, 0xED, 0xB3,
+    0x19, 0x5A, 0xB7, 0xC7, 0x9C, 0x03, 0x1D, 0xF0, 0x87, 0x02, 0x51, 0xE7, 0x00, 0xF7, 0x5C, 0xE4,
+    0xD7, 0xF7, 0x53, 0xED, 0xDF, 0xEB, 0xA7, 0x4A, 0xD1, 0x36, 0x12, 0x67, 0x24, 0x7A, 0x58, 0x0C,
+    0x2B, 0xFB, 0x55, 0xBA, 0xA2, 0xD4, 0x47, 0xC1, 0x64, 0xE9, 0x77, 0x3E, 0x24, 0xC0, 0x06, 0xED,
+    0x6E, 0x07, 0xB0, 0x65, 0x33, 0x2D, 0xA3, 0x29, 0x01, 0x16, 0xD5, 0xB8, 0x00, 0xF6, 0x26, 0x20,
+    0x19, 0x2A, 0x0B, 0xCA, 0x97, 0xEF, 0x01, 0x58, 0xFA, 0xBE, 0x8E, 0xBD, 0xD3, 0x2F, 0x01, 0x43,
+    0xF6, 0xD3, 0x19, 0x0C, 0x4A, 0x44, 0xEA, 0xF4, 0x92, 0xBC, 0x69, 0x51, 0xAF, 0xB5, 0xA0, 0x9F,
+    0xF6, 0x60, 0x92, 0x00, 0x81, 0xE6, 0x16, 0x77, 0xDD, 0x70, 0x72, 0x79, 0xEC, 0x78, 0x16, 0x1E,
+    0xFC, 0xDC, 0xFD, 0xDF, 0xCB, 0xDA, 0xBC, 0x2D, 0xFB, 0xFF, 0xE6, 0x7F, 0x49, 0xEB, 0x0F, 0xFF,
+    0x1F, 0xF0, 0x29, 0xC8, 0x2D, 0x69, 0x0B, 0x4F, 0x18, 0x09, 0xFF, 0xE3, 0xE2, 0xCA, 0xE3, 0x74,
+    0x8F, 0xAB, 0xFA, 0xF1, 0x4F, 0xF0, 0xF8, 0x5D, 0x3C, 0xCE, 0xAF, 0xFF, 0x0F, 0xE0, 0x41, 0xE8,
+    0xC8, 0x6A, 0xEE, 0x07, 0x23, 0xE1, 0xF4, 0xE2, 0xBF, 0xCF, 0xF9, 0x78, 0xEA, 0x3E, 0xCE, 0xDF,
+    0x7D, 0x9C, 0xBB, 0x3E, 0x0E, 0xBF, 0xC9, 0x3F, 0x2A, 0xF9, 0xB1, 0xC8, 0x8B, 0x32, 0x1D, 0x5D,
+    0x9C, 0x5A, 0x2C, 0x16, 0x95, 0x88, 0x54, 0x22, 0xB2, 0x02, 0x4E, 0x23, 0xF1, 0x38, 0x9C, 0xEF,
+    0xBF, 0xF3, 0x6F, 0x92, 0xFF, 0xD8, 0xEB, 0x6B, 0xAD, 0x29, 0x6D, 0xD8, 0x53, 0xEF, 0x7C, 0x94,
+    0x97, 0x6F, 0x6F, 0x6D, 0xD8, 0xC5, 0x62, 0xB1, 0x30, 0xF3, 0x7E, 0xD7, 0x1F, 0x6D, 0xFE, 0xF1,
+    0xC1, 0x00, 0x50, 0x3E, 0x12, 0x4A, 0x17, 0xB4, 0x1B, 0x0A, 0xD5, 0x5D, 0x38, 0xC9, 0x86, 0x0A,
+    0xD5, 0x37, 0x7C, 0xA5, 0x7C, 0x49, 0x9F, 0xBB, 0xB3, 0xD8, 0xD2, 0x5E, 0x31, 0x2F, 0x4C, 0xA5,
+    0x13, 0xED, 0x1A, 0xED, 0x76, 0x74, 0xBD, 0x57, 0x10, 0x36, 0x93, 0xFE, 0x82, 0xEA, 0x9E, 0x55,
+    0xF5, 0x06, 0x77, 0x6A, 0x6F, 0xBE, 0x30, 0x94, 0x2F, 0x07, 0xDD, 0x55, 0xAA, 0xD7, 0x6E, 0x3F,
+    0xF5, 0xBA, 0x3E, 0x9B, 0xFA, 0xDC, 0x6D, 0xD2, 0x67, 0xEE, 0x8E, 0xD9, 0x11, 0xAD, 0x39, 0x0A,
+    0x0A, 0x2B, 0x6A, 0xD8, 0x64, 0xC3, 0xF6, 0x27, 0xCC, 0x0D, 0x19, 0x45, 0xE4, 0xE7, 0x6F, 0x9C,
+    0xBD, 0xC7, 0xD1, 0x47, 0xDF, 0x17, 0x6D, 0xA3, 0xF3, 0xDE, 0x10, 0x6D, 0xC0, 0xBA, 0x86, 0xCD,
+    0xC8, 0x50, 0xCC, 0xE6, 0x24, 0xFE, 0x78, 0x45, 0xD6, 0x3F, 0xF0, 0x93, 0x9B, 0xF7, 0x38, 0x86,
+    0xA3, 0x97, 0xAA, 0xF8, 0x0D, 0xD5, 0xB1, 0xA5, 0xEB, 0x7F, 0x2D, 0x8D, 0xBC, 0x26, 0x22, 0x7F,
+    0xFD, 0xEF, 0x7F, 0xB4, 0x8B, 0xAE, 0x61, 0xE7, 0xA8, 0x85, 0x32, 0xB6, 0x70, 0xE2, 0x62, 0x39,
+    0x98, 0x50, 0x8D, 0x55, 0x30, 0x43, 0x7E, 0xF1, 0x8F, 0xC0, 0xD4, 0x98, 0x01, 0x23, 0xB5, 0x91,
+    0xC1, 0xC8, 0x64, 0x64, 0x34, 0xD2, 0x9A, 0x11, 0xD3, 0xCE, 0xEE, 0x85, 0x65, 0x29, 0xD3, 0x78,
+    0x17, 0x45, 0xAD, 0xAF, 0x8E, 0x6A, 0x32, 0xAD, 0xF9, 0x49, 0x48, 0xC7, 0x0D, 0x36, 0xA0, 0x78,
+    0x75, 0x92, 0xEA, 0x66, 0xD4, 0x7E, 0xB0, 0x08, 0x4F, 0x6C, 0xFC, 0xD6, 0x50, 0xBB, 0xFF, 0xD4,
+    0xE9, 0xAD, 0x8F, 0x7F, 0x84, 0xA8, 0xCD, 0x16, 0x85, 0xCD, 0x02, 0x6F, 0x3E, 0xFE, 0xE0, 0x7F,
+    0xFC, 0xBF, 0x4E, 0x9E, 0xB4, 0xCF, 0xDE, 0x79, 0x12, 0x9E, 0xE5, 0xD7, 0x3A, 0x01, 0xCF, 0xB6,
+    0xA8, 0x17, 0x6B, 0xF4, 0x27, 0xE0, 0xCC, 0x83, 0x8D, 0xF8, 0xB7, 0x16, 0x7F, 0xF5, 0xB9, 0x67,
+    0xB3, 0x2F, 0x9E, 0x4C, 0x7E, 0xE0, 0x9E, 0x7D, 0xE2, 0xEF, 0x4E, 0xDE, 0x71, 0x07, 0xCF, 0xC2,
+    0x49, 0xF8, 0x4D, 0x7F, 0x00, 0x78, 0xFC, 0x59, 0x1E, 0x38, 0x43, 0xFE, 0x25, 0xD2, 0xAB, 0x8E,
+    0xBF, 0x13, 0xF9, 0xC9, 0x37, 0x9E, 0xF9, 0xB3, 0x4F, 0xDC, 0xC7, 0xB3, 0x0F, 0x3E, 0x71, 0x92,
+    0x1F, 0xB5, 0xCF, 0x26, 0xC9, 0x47, 0xD0, 0xD0, 0xF1, 0xF6, 0xF8, 0x74, 0x54, 0x51, 0xEC, 0xDB,
+    0x55, 0xA8, 0x7F, 0x29, 0x35, 0x91, 0x07, 0x4F, 0x87, 0xCA, 0xCE, 0x96, 0x31, 0x5D, 0x9B, 0xC8,
+    0x14, 0xC2, 0x2E, 0xBB, 0x2B, 0x77, 0x55, 0x9F, 0xFA, 0x68, 0x37, 0x47, 0xBB, 0xAC, 0x9D, 0x13,
+    0x19, 0x6C, 0x52, 0xD8, 0x2B, 0xAB, 0x14, 0x02, 0xBB, 0x73, 0xA0, 0xA9, 0xF2, 0xA9, 0x7F, 0x80,
+    0x3F, 0x87, 0x7B, 0x6C, 0xDE, 0xEA, 0xA7, 0x7C, 0x39, 0x91, 0x49, 0xAB, 0x5D, 0xD0, 0xE9, 0xA1,
+    0x50, 0x5D, 0x6E, 0x4B, 0x69, 0x9F, 0x2C, 0xEC, 0x9E, 0xF2, 0xDA, 0x15, 0x41, 0xB9, 0xC0, 0x50,
+    0xD8, 0x12, 0x38, 0xAD, 0x3A, 0xE5, 0x77, 0xD9, 0x86, 0xC4, 0x17, 0x56, 0x5F, 0xF5, 0x49, 0x0F,
+    0xDA, 0x6E, 0x53, 0x6A, 0x97, 0xB5, 0xB0, 0x9B, 0xF4, 0x04, 0x43, 0x61, 0x51, 0xAD, 0xEA, 0x54,
+    0x17, 0xD8, 0x85, 0x4D, 0xB4, 0x2B, 0x1E, 0xEE, 0x95, 0x27, 0xF1, 0x94, 0x36, 0x28, 0x5F, 0x58,
+    0x74, 0x8D, 0xB9, 0xDC, 0xE6, 0x87, 0x03, 0xEC, 0x82, 0x19, 0xC9, 0xA5, 0x26, 0x6D, 0xE1, 0x94,
+    0x25, 0xD9, 0x82, 0xE4, 0x98, 0x38, 0x98, 0xB7, 0xE6, 0xA1, 0x99, 0x42, 0xD4, 0xBB, 0x89, 0x03,
+    0xB8, 0x78, 0x92, 0x3D, 0xD5, 0x99, 0x87, 0x43, 0xE1, 0x26, 0xDD, 0x55, 0x99, 0x37, 0x8F, 0xF4,
+    0x85, 0x1B, 0xB4, 0xDB, 0x55, 0xED, 0xA7, 0xA2, 0x9B, 0x2B, 0x17, 0x4F, 0xF2, 0xD5, 0xB4, 0xD7,
+    0xF5, 0xAE, 0xEA, 0x4B, 0x37, 0x66, 0xDE, 0x7C, 0x3D, 0x7E, 0xA4, 0x70, 0x63, 0xE6, 0xCD, 0x43,
+    0x41, 0xB7, 0x9B, 0xCA, 0x17, 0xF5, 0xAE, 0x6A, 0x4B, 0x1E, 0x57, 0xF5, 0xA7, 0x62, 0x6B, 0x77,
+    0xA7, 0x5E, 0x77, 0x85, 0x33, 0x75, 0xC5, 0x1E, 0x21, 0xF1, 0xA9, 0x83, 0xBB, 0xF9, 0x6A, 0xEE,
+    0x0A, 0x3B, 0xA5, 0x21, 0xF3, 0x45, 0x6B, 0xEA, 0x29, 0x09, 0xCA, 0xE7, 0x6D, 0x59, 0x1B, 0x42,
+    0xE2, 0x55, 0x9B, 0xF3, 0x29, 0x80, 0xBB, 0xF9, 0x6A, 0x52, 0x97, 0x6C, 0x27, 0x83, 0xEE, 0x4A,
+    0x57, 0x25, 0x21, 0xEB, 0x75, 0x67, 0xEA, 0x29, 0x0D, 0x99, 0xD7, 0xCE, 0xD8, 0xBD, 0x74, 0xC8,
+    0xBC, 0x76, 0x86, 0xBD, 0xC4, 0xAB, 0x56, 0xD7, 0x9F, 0xE3, 0x71, 0x66, 0xED, 0xC1, 0x89, 0xC8,
+    0x00, 0x54, 0x1D, 0xC5, 0x37, 0xEB, 0xAC, 0xDB, 0x4C, 0x06, 0x86, 0xD3, 0xA8, 0x96, 0x3B, 0xD8,
+    0x24, 0x64, 0xBE, 0x68, 0x9B, 0x5A, 0x68, 0x28, 0x5D, 0xE6, 0x93, 0x81, 0x4D, 0x36, 0xEE, 0x44,
+    0x5B, 0x86, 0xE8, 0x0C, 0x5F, 0x3A, 0xD5, 0xAB, 0x90, 0x8E, 0x49, 0x20, 0x30, 0xAC, 0x15, 0x4B,
+    0x9F, 0x02, 0xD2, 0xAB, 0x0E, 0x9B, 0x76, 0x67, 0x18, 0xD2, 0x4E, 0xB9, 0x2A, 0xE9, 0xB8, 0x90,
+    0x3F, 0xE4, 0xC9, 0x5C, 0xE2, 0xE1, 0x49, 0x3C, 0x64, 0xB5, 0x07, 0xAE, 0x78, 0x08, 0xB9, 0x2F,
+    0xAC, 0x61, 0xC8, 0xBB, 0xBC, 0x16, 0xDB, 0xC3, 0xF7, 0x7A, 0xE0, 0x7B, 0x1A, 0xB8, 0x82, 0x87,
+    0x2B, 0x68, 0x78, 0x52, 0x5B, 0xCF, 0x93, 0x99, 0x2F, 0xB8, 0xC0, 0x90, 0xF8, 0x33, 0xC0, 0xFD,
+    0x9F, 0x02, 0xE2, 0xBC, 0x70, 0xB2, 0x4E, 0x9F, 0x9D, 0x30, 0x4F, 0xF7, 0x8C, 0x45, 0x9B, 0xF5,
+    0x15, 0xC5, 0xF3, 0x81, 0x2A, 0xF3, 0x49, 0x28, 0x5C, 0xE6, 0x0D, 0xDA, 0x05, 0x8C, 0xF2, 0x04,
+    0xED, 0xD4, 0xCD, 0xB7, 0xA9, 0x2F, 0xC9, 0xDD, 0x2E, 0x25, 0xF6, 0xC8, 0xFF, 0xF8, 0x2F, 0x39,
+    0xF9, 0x48, 0x40, 0xB4, 0x57, 0xC1, 0x38, 0xED, 0xEF, 0x62, 0x03, 0x99, 0x37, 0xC5, 0x37, 0x16,
+    0x8B, 0xC5, 0x56, 0x75, 0xD0, 0x4C, 0xD5, 0x18, 0x45, 0x23, 0x36, 0x67, 0x9E, 0x76, 0x88, 0xA2,
+    0x8D, 0x6A, 0xA3, 0x27, 0x9C, 0xB6, 0x31, 0xE0, 0xE3, 0xCC, 0x1C, 0x07, 0xE4, 0x21, 0x6D, 0xA3,
+    0x54, 0xA5, 0x6D, 0x94, 0xB0, 0x8E, 0x15, 0xA9, 0x6E, 0x2E, 0xAA, 0xE3, 0x5B, 0x67, 0xE7, 0xC0,
+    0x8D, 0xCF, 0xCC, 0x3D, 0xBA, 0xF7, 0x75, 0x92, 0xC9, 0x2A, 0xE9, 0xA9, 0x84, 0x4A, 0xDA, 0x5C,
+    0x82, 0x7A, 0x53, 0xD8, 0xB9, 0xEC, 0xA3, 0x61, 0xA8, 0x26, 0x6F, 0x21, 0xC0, 0x26, 0xA8, 0x96,
+    0xB4, 0x23, 0xC6, 0x7B, 0xA1, 0x3A, 0xF2, 0x0E, 0xF6, 0xB8, 0x77, 0x24, 0x15, 0x57, 0x49, 0x9D,
+    0xCB, 0xA0, 0xA5, 0x43, 0x46, 0xA4, 0x45, 0x8F, 0xAB, 0x17, 0x2F, 0x40, 0x5E, 0xA3, 0x1C, 0x5C,
+    0x80, 0x3B, 0x6F, 0x5A, 0x0A, 0x91, 0x3A, 0x3C, 0x0B, 0x9F, 0x85, 0xAA, 0x26, 0x1F, 0xC8, 0x03,
+    0x34, 0x35, 0x55, 0x4D, 0xDE, 0x93, 0x6C, 0xB1, 0x9A, 0xFC, 0x7B, 0xFE, 0xC5, 0x01, 0xE8, 0x57,
+    0xA4, 0x27, 0x7F, 0x5B, 0xC4, 0xA6, 0x61, 0xF3, 0xB2, 0xA7, 0x81, 0x86, 0xD2, 0x91, 0xB7, 0x79,
+    0x07, 0x43, 0x3A, 0xC0, 0x69, 0xF6, 0x41, 0xBB, 0xB2, 0x26, 0xEF, 0xF2, 0x96, 0xF3, 0x7D, 0xD2,
+    0x67, 0x32, 0xB0, 0xAD, 0x64, 0xA0, 0xB0, 0xD2, 0xA2, 0xDA, 0xD2, 0x42, 0x9F, 0x39, 0x38, 0x8B,
+    0x07, 0x6D, 0x6F, 0xED, 0xD2, 0xBF, 0x81, 0x13, 0x75, 0x55, 0x93, 0x0D, 0xA5, 0x27, 0x95, 0x6C,
+    0x80, 0xCA, 0x9E, 0x83, 0x0D, 0x7B, 0xB2, 0x06, 0x74, 0x97, 0xEC, 0x5B, 0xD5, 0x23, 0x63, 0x32,
+    0x52, 0x49, 0x5B, 0xA1, 0x2F, 0x85, 0xC2, 0x41, 0xF9, 0xA2, 0x87, 0xF4, 0xDD, 0x00, 0x6C, 0x1A,
+    0x20, 0x7F, 0xC9, 0x81, 0xFA, 0x99, 0x87, 0x74, 0x08, 0x70, 0xEF, 0x68, 0x48, 0x64, 0xD2, 0x0E,
+    0x99, 0x94, 0xC7, 0xF4, 0x04, 0xF2, 0x96, 0x92, 0xC4, 0x93, 0x3B, 0xCE, 0x80, 0x3D, 0x66, 0x8E,
+    0x07, 0x4E, 0x5C, 0xE4, 0x1E, 0x54, 0xA0, 0xE8, 0x10, 0xB2, 0x80, 0x71, 0xC9, 0x44, 0x62, 0x57,
+    0xE9, 0x22, 0x38, 0x71, 0x40, 0x52, 0x8B, 0xD8, 0x22, 0x7F, 0x43, 0xDE, 0x1A, 0xCE, 0x70, 0x5E,
+    0xEA, 0x2D, 0x4E, 0x3C, 0x3B, 0x13, 0x0A, 0x5B, 0xDA, 0x21, 0x77, 0x3B, 0xAA, 0x2F, 0xDD, 0x98,
+    0x77, 0x95, 0x1A, 0x4A, 0x37, 0xEA, 0xAE, 0x52, 0x7D, 0xF9, 0x7C, 0xD0, 0x6D, 0xA5, 0x7A, 0xF3,
+    0x50, 0xD0, 0xED, 0x8E, 0xEA, 0x4C, 0x12, 0xC9, 0x4C, 0x99, 0xF4, 0x19, 0x0F, 0x26, 0xEE, 0x13,
+    0x37, 0x49, 0xC3, 0x03, 0x8D, 0xB8, 0xEA, 0x0B, 0x83, 0xC1, 0x14, 0x75, 0xFE, 0x6A, 0x9B, 0xFC,
+    0xC2, 0xB3, 0x13, 0x28, 0x1A, 0xB2, 0xEB, 0x2E, 0xFD, 0x79, 0x4F, 0xA8, 0xA8, 0x74, 0x57, 0x25,
+    0x22, 0x36, 0x3F, 0xE6, 0x35, 0xB6, 0x0B, 0x0D, 0x54, 0x0E, 0xE3, 0x31, 0xBB, 0x94, 0x25, 0xC5,
+    0x17, 0x9D, 0xFE, 0xBA, 0xD7, 0x6E, 0x37, 0x7F, 0xA3, 0xFA, 0x97, 0x22, 0xD3, 0x67, 0x2F, 0x1D,
+    0x5A, 0x76, 0xA1, 0x5C, 0xF9, 0x77, 0xE6, 0xD2, 0xCA, 0xA4, 0x97, 0x17, 0x7B, 0x34, 0x89, 0x5C,
+    0x2C, 0xA4, 0x3E, 0x31, 0xAE, 0xA3, 0x95, 0x76, 0xA8, 0x5E, 0x12, 0x5F, 0xAD, 0xD8, 0xB6, 0x7B,
+    0x3D, 0xCD, 0xEB, 0x6A, 0x98, 0x9D, 0x9D, 0xCC, 0xF7, 0x69, 0xA4, 0x9D, 0x1E, 0xED, 0x43, 0x12,
+    0x02, 0x21, 0x10, 0xF6, 0x08, 0xD5, 0xC3, 0x7D, 0x29, 0x3E, 0x13, 0x0B, 0x94, 0x32, 0x18, 0x09,
+    0x9B, 0xCB, 0x70, 0x26, 0xE9, 0x3F, 0xAF, 0x3A, 0xB4, 0xA3, 0xB0, 0x6C, 0xC2, 0x36, 0x04, 0x92,
+    0x9E, 0xD4, 0xA3, 0x3C, 0xAA, 0x5B, 0x05, 0x49, 0x40, 0x3E, 0x25, 0x32, 0xE9, 0x7A, 0x77, 0x3B,
+    0xE9, 0x87, 0xEC, 0xEA, 0xB0, 0xA3, 0xA4, 0xCD, 0xA4, 0xDE, 0xAB, 0xAE, 0xB5, 0x65, 0xC5, 0x66,
+    0xE0, 0xB0, 0xCF, 0x5F, 0x91, 0x29, 0x5D, 0x99, 0x2E, 0x8B, 0x31, 0x95, 0xB1, 0x78, 0x3E, 0xEC,
+    0x26, 0x37, 0xBC, 0x12, 0xA7, 0xAF, 0xD7, 0xC6, 0xFC, 0x97, 0x60, 0xA4, 0xBB, 0xB7, 0x21, 0x19,
+    0xD0, 0x2E, 0x1D, 0x4F, 0x48, 0x1B, 0x53, 0x89, 0x9C, 0x7C, 0x71, 0x48, 0xA4, 0x19, 0x92, 0xE6,
+    0x11, 0x9F, 0xF4, 0x99, 0xCB, 0xDA, 0xC2, 0x16, 0x76, 0x9B, 0xED, 0xA4, 0x4F, 0xFA, 0xAC, 0xCD,
+    0xDA, 0xC2, 0x56, 0xAD, 0x3C, 0x2D, 0xFF, 0x4E, 0xE0, 0x9F, 0x5A, 0x9A, 0x11, 0x91, 0x76, 0x3F,
+    0x0D, 0x06, 0x53, 0xD8, 0xFC, 0x55, 0x97, 0xDC, 0x58, 0x4F, 0xC1, 0xAB, 0x2E, 0xFD, 0xF9, 0x40,
+    0x30, 0xEC, 0xE7, 0x87, 0x42, 0x23, 0x9C, 0xF8, 0x2E, 0xDC, 0xC1, 0xBD, 0xAD, 0x09, 0xA9, 0x38,
+    0x76, 0xC9, 0x6F, 0x73, 0x3A, 0x7F, 0x60, 0xC4, 0x2F, 0xCE, 0xF1, 0x97, 0xE4, 0xE2, 0xCC, 0x75,
+    0xBF, 0xA7, 0xFA, 0xDD, 0xB4, 0xFF, 0xA3, 0xB4, 0x47, 0x79, 0xF2, 0x96, 0xD2, 0xB2, 0x4F, 0xDA,
+    0xA3, 0x5B, 0x8C, 0xA5, 0x91, 0xD0, 0x48, 0x38, 0xB5, 0xD8, 0x4A, 0xFE, 0x9C, 0x6A, 0xCA, 0x0E,
+    0xA7, 0xD3, 0x84, 0x4F, 0xAB, 0x8E, 0xD2, 0x66, 0x7D, 0x2A, 0x6D, 0x2E, 0x2D, 0xDA, 0x51, 0x42,
+    0x20, 0xEF, 0xBE, 0x22, 0xB9, 0x74, 0xF9, 0x73, 0x31, 0x1E, 0x3C, 0x80, 0x40, 0xE3, 0xA8, 0x3C,
+    0x9B, 0xBB, 0x98, 0x92, 0x32, 0x77, 0xC5, 0xC3, 0x5E, 0xD7, 0xBB, 0xB9, 0xC8, 0xBB, 0x22, 0xD3,
+    0xC6, 0x97, 0xDF, 0x65, 0x46, 0x81, 0xAC, 0x06, 0x64, 0xD2, 0xD2, 0xF5, 0x68, 0x92, 0x03, 0x8A,
+    0x29, 0x69, 0x02, 0x79, 0x17, 0xA7, 0x7F, 0x13, 0xFD, 0x0F, 0xE7, 0x07, 0x19, 0xD3, 0x7F, 0x84,
+    0xE4, 0x22, 0x65, 0x9F, 0x88, 0xCD, 0xE7, 0xE8, 0x24, 0x2A, 0xB1, 0x8D, 0xF8, 0x90, 0x0D, 0x71,
+    0xEE, 0x03, 0x61, 0x9F, 0xC1, 0xBC, 0xDA, 0x6B, 0x69, 0x93, 0xEF, 0x47, 0x1E, 0x3F, 0x18, 0x09,
+    0x67, 0x18, 0x1E, 0x4C, 0xFD, 0x67, 0xB2, 0x16, 0x5D, 0x53, 0xC2, 0x26, 0xEC, 0xC2, 0x40, 0xD2,
+    0x1F, 0xCD, 0x7D, 0xE2, 0xE0, 0x2F, 0x28, 0xE5, 0xE1, 0x83, 0x46, 0xDB, 0xED, 0xED, 0xC4, 0x87,
+    0xFC, 0xF9, 0x31, 0x24, 0xE2, 0xB4, 0xB4, 0xA1, 0xBC, 0xE6, 0x8A, 0x7D, 0x36, 0x03, 0x87, 0x07,
+    0xC5, 0x55, 0x09, 0xC9, 0xFF, 0x6A, 0xF9, 0x73, 0xCC, 0xA4, 0xA6, 0xA9, 0xB0, 0x7B, 0x81, 0x1B,
+    0x5E, 0xDD, 0x70, 0xFA, 0x35, 0x67, 0x4A, 0x19, 0x4A, 0x69, 0x37, 0x2A, 0xD2, 0x81, 0xD2, 0xE5,
+    0x21, 0x93, 0x3A, 0x7F, 0x96, 0x53, 0x8B, 0xC5, 0xE2, 0x11, 0x11, 0x09, 0xF7, 0x8A, 0x88, 0xD3,
+    0x2D, 0xBB, 0x8C, 0x64, 0x4E, 0xB7, 0x9C, 0x61, 0x24, 0x89, 0x22, 0xFB, 0xB8, 0x92, 0xDD, 0x45,
+    0x26, 0xB4, 0x48, 0xCB, 0xB4, 0x38, 0xB7, 0x2E, 0x8A, 0x2A, 0x0A, 0x19, 0x49, 0x2E, 0xBF, 0x59,
+    0x1F, 0xAB, 0x3C, 0xD9, 0xA8, 0x48, 0x34, 0xD1, 0xB9, 0xE5, 0xC4, 0x01, 0x24, 0x22, 0xA0, 0x0F,
+    0x27, 0x18, 0x93, 0x40, 0xD6, 0xA5, 0x9E, 0xD2, 0xE6, 0x35, 0x81, 0x3B, 0xA2, 0x3B, 0x69, 0x51,
+    0x03, 0x7B, 0x6C, 0x21, 0x22, 0xB5, 0x12, 0x19, 0xA3, 0x1A, 0xED, 0xD4, 0xB8, 0xB0, 0xA9, 0x88,
+    0x70, 0xF2, 0xF2, 0x9B, 0xCF, 0x45, 0x95, 0x9D, 0x5A, 0x6B, 0x10, 0xB7, 0x81, 0x7F, 0x76, 0xB8,
+    0x5C, 0xBE, 0x2C, 0x22, 0xF2, 0xC8, 0xD4, 0x48, 0xC8, 0x6A, 0x4E, 0xD9, 0x3F, 0xBC, 0x3C, 0xCD,
+    0x3E, 0xB4, 0x2B, 0x37, 0x1B, 0x32, 0x79, 0xA6, 0xE9, 0xD6, 0x69, 0xB6, 0xDC, 0xCA, 0xB1, 0x27,
+    0xC6, 0xE7, 0xA0, 0xDB, 0xE8, 0x20, 0x0F, 0xC6, 0x26, 0x21, 0x32, 0x71, 0x23, 0x59, 0x57, 0xCC,
+    0xD5, 0xCA, 0x7A, 0x77, 0xAE, 0x16, 0xB2, 0xC3, 0xE7, 0xD2, 0xC9, 0x1A, 0x5B, 0xFC, 0x58, 0xA4,
+    0xAB, 0xA4, 0x9E, 0x1E, 0x9D, 0x4E, 0x34, 0x4B, 0xD5, 0x9D, 0x56, 0x22, 0x2D, 0x81, 0x82, 0x27,
+    0xB4, 0xBC, 0x8E, 0xF2, 0x6C, 0x47, 0x35, 0xA1, 0x76, 0x4C, 0xAB, 0x70, 0x8B, 0x54, 0x5A, 0xD5,
+    0x03, 0x81, 0x44, 0xBC, 0x8E, 0xBE, 0xAE, 0x94, 0xDD, 0x5C, 0xCD, 0x6A, 0x17, 0xAB, 0x65, 0xB5,
+    0xC9, 0x0E, 0x80, 0x7D, 0xEE, 0xE7, 0x40, 0xC4, 0x91, 0x48, 0xD8, 0xBF, 0xFC, 0x92, 0x08, 0xA4,
+    0xF2, 0xB2, 0x84, 0x95, 0x9B, 0xDB, 0x29, 0x20, 0x69, 0x2E, 0x42, 0x29, 0x53, 0x9C, 0x21, 0x35,
+    0xB2, 0x8D, 0xF6, 0x9C, 0xA5, 0x74, 0x9C, 0xC1, 0x58, 0x3E, 0x1D, 0x47, 0x36, 0x46, 0x8F, 0xBB,
+    0x3E, 0x3A, 0x22, 0x26, 0x01, 0xF8, 0xC3, 0x71, 0xB1, 0x45, 0x25, 0xD2, 0xF2, 0x6F, 0xA7, 0xE5,
+    0x3C, 0x7B, 0xD1, 0xB9, 0xAB, 0x81, 0x39, 0x3F, 0x54, 0xD9, 0x01, 0x7A, 0x5A, 0xEC, 0xDD, 0x1A,
+    0x73, 0x76, 0xE7, 0xCA, 0x89, 0xB4, 0xB0, 0xB3, 0xFE, 0xBB, 0xB0, 0x90, 0x1C, 0x7C, 0x79, 0xB9,
+    0xBC, 0x2C, 0x22, 0xF2, 0xDA, 0x72, 0x79, 0x69, 0x2A, 0xEC, 0xCA, 0x7D, 0x3E, 0x9E, 0x58, 0x6D,
+    0xF3, 0xF7, 0x41, 0xD1, 0x52, 0x8C, 0x14, 0xD2, 0x16, 0x7F, 0xB5, 0x5D, 0x7E, 0xF1, 0x0B, 0x3F,
+    0x7C, 0xB8, 0x7B, 0x82, 0x2B, 0x70, 0x1A, 0xF2, 0x9A, 0xB4, 0xE3, 0x03, 0x6E, 0x86, 0x95, 0x6B,
+    0xF9, 0x9D, 0xAB, 0x88, 0x8C, 0xEC, 0xE8, 0xF4, 0x83, 0xE5, 0xF2, 0x6F, 0x1F, 0x7D, 0x4D, 0x44,
+    0xE4, 0xFA, 0xE1, 0x72, 0xB9, 0xB7, 0x7A, 0xBE, 0xB3, 0x4A, 0x16, 0xB4, 0x09, 0xF0, 0x55, 0x38,
+    0x0D, 0xFA, 0x97, 0x35, 0xB4, 0xBA, 0x51, 0x0F, 0x77, 0xFF, 0x43, 0xFF, 0xBD, 0x9D, 0xF2, 0x81,
+    0x9D, 0xF4, 0xC6, 0x3E, 0x65, 0xCC, 0xC8, 0x74, 0x1F, 0xF0, 0x31, 0x3E, 0x06, 0xBA, 0xCE, 0x6B,
+    0x72, 0xC7, 0x40, 0xEE, 0xD0, 0x75, 0xEE, 0x60, 0xC8, 0xDF, 0x58, 0x2C, 0xCE, 0x3F, 0x2D, 0x22,
+    0xE2, 0xA7, 0xE5, 0x72, 0x39, 0x68, 0x07, 0x81, 0x00, 0x21, 0x6A, 0xC6, 0x19, 0xD8, 0x9D, 0x5F,
+    0x9F, 0x9D, 0xBB, 0xF3, 0x81, 0x5C, 0xEA, 0xFC, 0xFF, 0x19, 0xF4, 0xB5, 0x6F, 0x5E, 0x7B, 0xA1,
+    0x1B, 0xDC, 0x95, 0x7F, 0xF2, 0x3E, 0xDD, 0xAA, 0xAF, 0x7C, 0x6C, 0xF7, 0xB4, 0xFE, 0xE6, 0xB5,
+    0x6F, 0xBA, 0xE9, 0xBA, 0xD3, 0xE2, 0x10, 0x87, 0x76, 0x60, 0x21, 0xB3, 0xD0, 0xD4, 0xE4, 0x52,
+    0xB3, 0x7F, 0xBD, 0xCE, 0x5F, 0xFD, 0x76, 0xBD, 0x77, 0xBA, 0xA8, 0xDB, 0x2B, 0x9F, 0x22, 0xED,
+    0xA2, 0x0B, 0xF9, 0xE9, 0xC8, 0x88, 0xA5, 0x1D, 0x1F, 0xCF, 0x9F, 0x72, 0x7B, 0xA7, 0x8B, 0x7A,
+    0xEF, 0xFB, 0x03, 0x8D, 0xD4, 0x54, 0x7D, 0x0C, 0xAD, 0xBD, 0x42, 0x21, 0x32, 0x56, 0x6B, 0x8D,
+    0x44, 0x5E, 0xA3, 0x3C, 0x84, 0xE8, 0xCB, 0xEB, 0x56, 0x37, 0xA7, 0xF9, 0x74, 0x5E, 0x97, 0x69,
+    0x57, 0xDA, 0x2B, 0xA5, 0x3D, 0x5D, 0xD8, 0xFC, 0xDB, 0xCF, 0xFC, 0xE9, 0x75, 0x91, 0x83, 0xC3,
+    0xE5, 0x77, 0x4B, 0x4B, 0xDA, 0x43, 0x19, 0x65, 0xAC, 0x4F, 0xC3, 0x95, 0x5B, 0xDE, 0xDD, 0x04,
+    0x5D, 0xA3, 0x3A, 0x18, 0x52, 0x4E, 0xAB, 0x2E, 0xAF, 0x77, 0xD2, 0x2E, 0x6B, 0xAF, 0xB0, 0x5D,
+    0x2E, 0x1E, 0x7D, 0x55, 0x64, 0x5C, 0x2E, 0x47, 0xD8, 0x86, 0x1D, 0xD8, 0x81, 0x4D, 0x48, 0x8F,
+    0xB2, 0xB3, 0xE5, 0x8E, 0x9A, 0x32, 0xEE, 0x1C, 0x7B, 0xD1, 0x3E, 0x98, 0xBB, 0x5D, 0x28, 0xB3,
+    0x37, 0x16, 0x8B, 0x5D, 0x23, 0x22, 0x7E, 0x7F, 0xB9, 0x5C, 0xDA, 0xA3, 0x88, 0xE0, 0xA3, 0x50,
+    0xF5, 0x23, 0xDB, 0xFE, 0x13, 0x2B, 0xC4, 0xD8, 0x06, 0xB2, 0x43, 0x89, 0x86, 0x87, 0x5F, 0xBC,
+    0xB9, 0x5C, 0x2E, 0xB7, 0x01, 0xB6, 0x17, 0x8B, 0xC5, 0xB9, 0x4A, 0x44, 0x7C, 0x23, 0x22, 0x6E,
+    0x77, 0x1D, 0x64, 0x7F, 0x85, 0x95, 0xDF, 0x6B, 0x66, 0xA1, 0xB2, 0x64, 0xD7, 0x2D, 0xDB, 0x85,
+    0xCD, 0xFA, 0xCA, 0x56, 0x2F, 0xCB, 0x17, 0x5E, 0xFB, 0xC2, 0x6B, 0xFF, 0xDD, 0xD9, 0xE2, 0x6E,
+    0xFA, 0x0B, 0xA8, 0x97, 0x3D, 0xFA, 0x0B, 0x8E, 0xB3, 0x05, 0x1F, 0x70, 0xBB, 0xB2, 0x0B, 0xD8,
+    0x79, 0x0D, 0x51, 0x58, 0x91, 0xA9, 0x79, 0x44, 0x44, 0xE4, 0x5F, 0x2C, 0x97, 0xCB, 0xCB, 0x16,
+    0x28, 0x16, 0x8B, 0xC5, 0xE2, 0x17, 0x22, 0x22, 0x5F, 0x9A, 0x55, 0x43, 0xBA, 0x9E, 0x55, 0x9A,
+    0x79, 0x0D, 0xDC, 0x01, 0x1F, 0xBA, 0xC5, 0x8D, 0xB3, 0xC5, 0x5D, 0x17, 0xFA, 0x0B, 0x7D, 0xF3,
+    0xB2, 0xD4, 0xCD, 0x17, 0x06, 0xF6, 0x8A, 0x9A, 0xBD, 0x21, 0x4E, 0xFE, 0x13, 0x6B, 0xA7, 0x47,
+    0xA7, 0x41, 0xF9, 0xB8, 0x0F, 0x95, 0xA8, 0xC3, 0xE5, 0x25, 0xAF, 0x44, 0x44, 0xD2, 0xC3, 0xE5,
+    0xF2, 0xD2, 0x8F, 0x3C, 0x70, 0x76, 0x73, 0xB1, 0x58, 0x9C, 0x57, 0x22, 0x22, 0x18, 0x11, 0x89,
+    0x35, 0xD9, 0xA4, 0x9C, 0x5F, 0x8F, 0x04, 0xB5, 0x06, 0xE5, 0x1B, 0xA0, 0x7C, 0x6A, 0x04, 0x42,
+    0xB4, 0xBD, 0xE7, 0x1E, 0x4A, 0xAB, 0x3B, 0x08, 0x94, 0x8E, 0xAC, 0xA3, 0x5A, 0x2E, 0x1B, 0x90,
+    0x18, 0x53, 0xB7, 0xBC, 0xDC, 0xA2, 0x7A, 0x0C, 0x68, 0x9F, 0xF4, 0x50, 0x38, 0xED, 0xC0, 0xD4,
+    0x9B, 0x40, 0x93, 0x7A, 0x60, 0xD4, 0x0E, 0xD4, 0xB0, 0x0D, 0x64, 0xEF, 0x78, 0x40, 0xBF, 0x56,
+    0x13, 0xD3, 0xE5, 0xAD, 0x0C, 0x85, 0x62, 0x57, 0x1A, 0xDF, 0xC8, 0x4F, 0x27, 0xE7, 0x20, 0x97,
+    0x0E, 0x2D, 0x42, 0x56, 0x17, 0xDD, 0x6C, 0x09, 0x33, 0x36, 0x92, 0x86, 0x78, 0x03, 0x97, 0xBF,
+    0xED, 0x52, 0x11, 0xAF, 0xC6, 0xC7, 0x82, 0xEA, 0x69, 0xD2, 0x1E, 0xED, 0x02, 0x59, 0xB7, 0x47,
+    0xD2, 0x1B, 0xD8, 0xD3, 0x0E, 0x93, 0x79, 0xF4, 0x53, 0x03, 0x79, 0xBB, 0x83, 0xF2, 0x85, 0x4B,
+    0xBD, 0xF2, 0xC9, 0x80, 0x3C, 0x3C, 0x44, 0x1F, 0x13, 0xE9, 0xA3, 0x07, 0x65, 0x25, 0xF2, 0xB6,
+    0x88, 0xFC, 0x54, 0xDE, 0x6C, 0xDC, 0x5A, 0x25, 0xB6, 0xCA, 0xC1, 0xB2, 0xBA, 0xFD, 0x99, 0x48,
+    0xF3, 0x92, 0x88, 0xFC, 0xB7, 0xCB, 0x4B, 0xB7, 0x29, 0x5D, 0xDD, 0xFE, 0xE7, 0xE5, 0x7F, 0x92,
+    0x59, 0x33, 0x78, 0x93, 0x4B, 0x5A, 0x4D, 0x26, 0x07, 0x69, 0x4F, 0x29, 0xF2, 0xF6, 0x80, 0x39,
+    0x7C, 0x54, 0x06, 0x4C, 0x87, 0x0E, 0x94, 0x2D, 0x89, 0xA0, 0x5B, 0x12, 0xE9, 0xF2, 0x0E, 0xC6,
+    0xA0, 0x3C, 0x04, 0xF3, 0x50, 0x80, 0x90, 0x77, 0xFB, 0x10, 0x92, 0xA1, 0xB4, 0x04, 0x76, 0xF2,
+    0x96, 0x40, 0xF1, 0x74, 0x4F, 0x1C, 0xE7, 0x48, 0x3A, 0x94, 0xF5, 0x08, 0x63, 0xE6, 0xF7, 0xC0,
+    0x10, 0xF6, 0xA0, 0x74, 0xE5, 0x08, 0xBA, 0x55, 0x13, 0x68, 0x4F, 0x53, 0x53, 0x78, 0xAA, 0xE9,
+    0xA1, 0xCA, 0xB3, 0x53, 0x89, 0x78, 0x76, 0x52, 0x91, 0x8B, 0x9C, 0x3C, 0x16, 0xED, 0xB0, 0x36,
+    0x7B, 0xAE, 0xC3, 0x86, 0xA5, 0x9E, 0x63, 0xC7, 0xD5, 0xF5, 0x16, 0xB2, 0x57, 0x3D, 0xE8, 0xAB,
+    0x1E, 0xF4, 0x23, 0x03, 0x94, 0x69, 0x80, 0x4D, 0x02, 0x6C, 0x33, 0xCD, 0xA1, 0x85, 0x03, 0xC6,
+    0xA6, 0x1E, 0x53, 0x2B, 0x4F, 0xE1, 0xB2, 0x16, 0xDD, 0x6A, 0x87, 0xF6, 0x45, 0x4D, 0xE6, 0x4B,
+    0x1B, 0xDD, 0x80, 0xD2, 0xD0, 0x3C, 0xB3, 0x78, 0x34, 0x88, 0x44, 0x8F, 0x60, 0x99, 0x8C, 0x88,
+    0x48, 0x21, 0x22, 0xF2, 0xC3, 0x69, 0xF9, 0x95, 0x4B, 0x5E, 0x20, 0x09, 0xA5, 0x83, 0x3D, 0x35,
+    0x80, 0xA1, 0x81, 0xA2, 0x2E, 0xDA, 0x18, 0xBC, 0xA0, 0xBA, 0xA8, 0x32, 0xD7, 0x2D, 0x01, 0x15,
+    0xD8, 0x86, 0x8A, 0x12, 0x74, 0xA7, 0x6B, 0xD2, 0x90, 0x3B, 0x30, 0x8F, 0x78, 0xD0, 0x3F, 0xEA,
+    0x21, 0x09, 0xBB, 0x80, 0xD9, 0x01, 0xF2, 0xB5, 0x25, 0x22, 0x26, 0xC9, 0x89, 0x8E, 0x0A, 0x16,
+    0xE0, 0xBC, 0x48, 0x9D, 0x89, 0x88, 0xCF, 0x45, 0x64, 0xD0, 0x03, 0x90, 0xF7, 0x2B, 0x9B, 0xAB,
+    0x1A, 0xD6, 0xF4, 0x68, 0x67, 0x1D, 0x18, 0x97, 0x1F, 0x2E, 0x97, 0x72, 0x43, 0x44, 0x64, 0x6A,
+    0x1A, 0x11, 0xB9, 0x6C, 0x57, 0x1B, 0x56, 0xAC, 0x69, 0xEC, 0xDA, 0x64, 0xDB, 0x00, 0x73, 0x0E,
+    0x40, 0x39, 0x5C, 0x2E, 0x63, 0x43, 0xDC, 0x2B, 0x2B, 0xBE, 0x60, 0x45, 0xF6, 0x36, 0x21, 0x69,
+    0x64, 0xA2, 0x10, 0x11, 0x57, 0x8A, 0x48, 0x67, 0x3A, 0x7A, 0xCA, 0x96, 0x5D, 0x0A, 0x17, 0x53,
+    0xFF, 0x69, 0xAB, 0x3C, 0xB9, 0x4B, 0x06, 0x94, 0x67, 0x1F, 0x06, 0xCA, 0x37, 0x97, 0xD2, 0x5C,
+    0x17, 0x11, 0x39, 0x9C, 0x44, 0x64, 0xDA, 0x23, 0x73, 0x14, 0xB5, 0xF2, 0x28, 0xCF, 0x00, 0x23,
+    0x17, 0xA0, 0x70, 0x06, 0x54, 0xD0, 0x35, 0x98, 0x98, 0x4E, 0xEE, 0x70, 0xB9, 0x8C, 0x0D, 0xD1,
+    0x88, 0xF8, 0x38, 0xE3, 0xBA, 0x5E, 0x1B, 0xF4, 0x39, 0xB5, 0x58, 0xD8, 0x5C, 0x44, 0x7C, 0x21,
+    0x22, 0xA1, 0x3C, 0x58, 0x2C, 0xCE, 0x15, 0xDD, 0x2A, 0xC0, 0x3C, 0xF3, 0xEB, 0x78, 0xC1, 0x46,
+    0x44, 0xA2, 0x47, 0xF9, 0xB5, 0xC3, 0xE5, 0xF2, 0xD2, 0x8F, 0x87, 0xB5, 0x79, 0x5A, 0x77, 0xEB,
+    0x88, 0x95, 0xF2, 0x60, 0xB1, 0x58, 0x24, 0x22, 0xD1, 0x01, 0x58, 0x3C, 0x2C, 0x16, 0x5B, 0x8D,
+    0x4C, 0x16, 0x23, 0x22, 0x36, 0x5F, 0x69, 0xCF, 0x1B, 0xC7, 0xEC, 0xE8, 0x1B, 0xE1, 0x17, 0x5D,
+    0x0C, 0xC2, 0x3A, 0xA8, 0x2F, 0x7F, 0x4B, 0xDE, 0x5C, 0x5E, 0x3A, 0x14, 0x11, 0x91, 0x46, 0x44,
+    0x9A, 0x7A, 0x8E, 0x25, 0x99, 0xA9, 0x46, 0x58, 0x37, 0x7E, 0x14, 0x61, 0xDE, 0xB8, 0xE5, 0xF2,
+    0x52, 0x4C, 0x22, 0x62, 0xB5, 0xC8, 0xC1, 0x0A, 0xE4, 0xC3, 0x0A, 0xD1, 0x53, 0x91, 0x03, 0x10,
+    0x91, 0x91, 0x52, 0x44, 0x3A, 0x32, 0x97, 0x0A, 0x0C, 0x14, 0x1D, 0x06, 0x46, 0x32, 0x47, 0xE9,
+    0x18, 0xA2, 0x24, 0xC9, 0x1E, 0xB9, 0xA3, 0xBC, 0x7C, 0x63, 0x5A, 0x5E, 0x7E, 0x6B, 0x85, 0xC0,
+    0xD3, 0x04, 0x3D, 0x45, 0x8D, 0x21, 0x6F, 0xC9, 0x9D, 0xF2, 0xD0, 0x27, 0x01, 0x0C, 0x23, 0xE4,
+    0x4E, 0x20, 0x39, 0x94, 0x74, 0xB9, 0x6C, 0x24, 0x36, 0x64, 0xE6, 0x01, 0x6F, 0x1E, 0xE5, 0x47,
+    0xEA, 0x61, 0xB1, 0x58, 0x44, 0x73, 0x42, 0xAD, 0x45, 0x64, 0x64, 0xB1, 0x58, 0x34, 0xDD, 0xCA,
+    0xD0, 0x1F, 0x99, 0xE0, 0x18, 0x56, 0xBB, 0x6F, 0x44, 0x44, 0xBE, 0x29, 0x22, 0xF2, 0xCE, 0xE1,
+    0x72, 0x79, 0x69, 0x58, 0x7B, 0x37, 0x44, 0x9F, 0x74, 0x07, 0x94, 0x2F, 0x2F, 0x16, 0x8B, 0xA6,
+    0x13, 0x11, 0x69, 0x8D, 0x88, 0xD8, 0xE8, 0xF9, 0x14, 0x73, 0xAA, 0x9C, 0x17, 0x11, 0x91, 0xE7,
+    0xAB, 0xC3, 0xE5, 0xA5, 0x68, 0x7D, 0x36, 0x36, 0x0D, 0x2B, 0xB6, 0x5A, 0x45, 0xB7, 0xD4, 0xF1,
+    0x77, 0x52, 0x90, 0xF5, 0xA9, 0x4C, 0x14, 0xF2, 0x8E, 0x88, 0xD3, 0x6B, 0x3F, 0x5B, 0x2D, 0x22,
+    0xA1, 0x10, 0x91, 0x50, 0x1C, 0x2E, 0x97, 0x21, 0x1F, 0x60, 0x57, 0x8D, 0x70, 0x01, 0x81, 0x33,
+    0x54, 0x8E, 0xBB, 0x67, 0xD6, 0xB7, 0x5F, 0xA5, 0x3A, 0x88, 0x98, 0xD7, 0xD8, 0x55, 0x8E, 0xDB,
+    0x18, 0xD5, 0x5E, 0xCF, 0xEB, 0x31, 0x09, 0x2B, 0x60, 0xEA, 0x6E, 0x05, 0xB1, 0x0A, 0xEE, 0x60,
+    0x84, 0xFB, 0xD5, 0x00, 0x9B, 0xB9, 0x87, 0xCD, 0xC2, 0xC1, 0x9E, 0x11, 0x91, 0x60, 0x44, 0x24,
+    0x94, 0x2B, 0x44, 0xBD, 0xF3, 0xD4, 0x62, 0xF1, 0x2F, 0xE7, 0xD8, 0x16, 0xA2, 0x65, 0x77, 0x3B,
+    0x8A, 0x38, 0x31, 0xC5, 0xAB, 0xEA, 0x60, 0x0F, 0xB4, 0x23, 0xE9, 0xC1, 0x44, 0xCA, 0xB0, 0x1B,
+    0x39, 0x58, 0x1F, 0x1F, 0x44, 0xD5, 0x56, 0x61, 0x51, 0x1E, 0x36, 0x23, 0x16, 0x0C, 0xEB, 0x07,
+    0xDB, 0xB0, 0x61, 0x23, 0xB3, 0x33, 0x44, 0x3E, 0x4A, 0x75, 0xB1, 0x4E, 0x61, 0xA3, 0x9C, 0xB5,
+    0x1D, 0xF1, 0xFD, 0xA6, 0xA2, 0xFA, 0xE6, 0xA2, 0xFE, 0xA8, 0x48, 0xDF, 0x5C, 0x94, 0xF4, 0x51,
+    0x94, 0xD9, 0xB0, 0xE4, 0x36, 0xAA, 0xF4, 0x7A, 0x3E, 0xA6, 0xDA, 0xBB, 0x76, 0xF2, 0x47, 0xBC,
+    0xFC, 0x55, 0x53, 0x57, 0xD2, 0x51, 0x0C, 0xD0, 0xF4, 0x94, 0x32, 0x66, 0xC3, 0xFF, 0x21, 0xFA,
+    0x91, 0xF6, 0xCA, 0x9D, 0x7A, 0x5D, 0x79, 0x4E, 0xB6, 0x99, 0x48, 0x9B, 0x4B, 0x5F, 0xD8, 0xB0,
+    0xC9, 0xD9, 0xB3, 0x6C, 0x9E, 0x65, 0x73, 0x93, 0xB3, 0xA5, 0x0D, 0x5A, 0xFA, 0x34, 0xE6, 0x4E,
+    0x48, 0x82, 0xF9, 0xC9, 0x34, 0x0B, 0x70, 0xF7, 0xAC, 0x6D, 0xCA, 0xD9, 0x2D, 0x8B, 0xD6, 0xB0,
+    0xE2, 0xA6, 0xB4, 0x5B, 0x49, 0x8C, 0x31, 0x80, 0x71, 0xF7, 0xA8, 0xB8, 0x36, 0x13, 0x79, 0xAB,
+    0xC5, 0x29, 0x9F, 0x5E, 0x9A, 0x89, 0xDB, 0x36, 0x94, 0xB5, 0x81, 0xCC, 0xEB, 0x1A, 0x42, 0xD6,
+    0x42, 0xF9, 0xB0, 0x87, 0xAC, 0x0B, 0x40, 0x38, 0x0B, 0x98, 0xF3, 0x40, 0x76, 0xDD, 0x01, 0xD2,
+    0xAD, 0x72, 0x7A, 0xE5, 0x61, 0x2D, 0x3D, 0x45, 0x52, 0x1D, 0x59, 0xCD, 0x24, 0xF9, 0x3E, 0xA5,
+    0x96, 0x7A, 0xBF, 0xFC, 0x9B, 0x1F, 0xF5, 0x67, 0x93, 0x1B, 0xEE, 0x02, 0x95, 0xDD, 0x65, 0x93,
+    0x5D, 0x0C, 0xDB, 0xDC, 0x70, 0xE6, 0x6F, 0x7E, 0xD0, 0x17, 0x62, 0xA7, 0x74, 0x88, 0x32, 0x4D,
+    0xF2, 0x7D, 0xF2, 0x2E, 0x95, 0xAE, 0x90, 0xF4, 0x60, 0xBF, 0xF8, 0x76, 0x37, 0x64, 0xD7, 0xD9,
+    0x3D, 0x43, 0x43, 0x51, 0xA0, 0x6B, 0xF5, 0xA2, 0xCB, 0xFA, 0xC4, 0xF7, 0xD9, 0x75, 0x76, 0xCD,
+    0xDF, 0xBC, 0x72, 0xB0, 0xA7, 0xA4, 0x2D, 0x27, 0xCA, 0x3A, 0xD9, 0x8B, 0xDC, 0x69, 0x24, 0x6B,
+    0xED, 0x1A, 0x18, 0xBF, 0x8D, 0x87, 0xCD, 0x51, 0x2A, 0xB8, 0x75, 0x22, 0xA5, 0x8F, 0x1D, 0xC5,
+    0x89, 0xEA, 0xA3, 0x4D, 0x2A, 0xEB, 0x57, 0x1C, 0xE0, 0x9C, 0x2E, 0xA4, 0x74, 0xEB, 0x28, 0xA2,
+    0x98, 0x59, 0x44, 0x8E, 0x3C, 0xBF, 0x2A, 0x7B, 0x44, 0xAC, 0xDD, 0xD1, 0x1B, 0xED, 0x6D, 0xDF,
+    0x10, 0x11, 0x19, 0x2A, 0x11, 0x91, 0x9F, 0x88, 0x88, 0x48, 0xFD, 0xC7, 0x9B, 0xBF, 0xE4, 0x38,
+    0xF5, 0xC7, 0xE9, 0xBF, 0xF7, 0x3B, 0x26, 0xFB, 0xC9, 0x47, 0x77, 0xFA, 0xD1, 0xD6, 0xA9, 0x15,
+    0x2A, 0x75, 0x2B, 0x14, 0x50, 0x62, 0x21, 0xF9, 0x85, 0x07, 0xC2, 0x2E, 0xB0, 0x59, 0xD4, 0x50,
+    0x2A, 0x0F, 0xDA, 0xED, 0xCD, 0xFE, 0xC5, 0xA9, 0x8F, 0x72, 0xD0, 0x1E, 0xEC, 0xA1, 0x5D, 0x54,
+    0x28, 0x15, 0x35, 0x3B, 0xE4, 0x6D, 0xF4, 0x9F, 0x4A, 0xFB, 0x64, 0x98, 0xC3, 0xB6, 0xB4, 0x33,
+    0x90, 0x0E, 0xA5, 0x05, 0xA3, 0x1D, 0xE8, 0x1F, 0x76, 0x90, 0x0C, 0x3B, 0x40, 0xF1, 0x4D, 0x07,
+    0xF9, 0x0F, 0x7A, 0xA2, 0xF7, 0x5B, 0x12, 0xA5, 0xCC, 0x64, 0x00, 0x83, 0x81, 0xD2, 0xE6, 0x0E,
+    0xED, 0x92, 0x81, 0xAC, 0xC3, 0x90, 0xF6, 0xE4, 0x6D, 0x14, 0x3D, 0xB7, 0xE7, 0x1A, 0x59, 0xAB,
+    0x6B, 0x08, 0x79, 0x3B, 0x77, 0x31, 0xFB, 0xD1, 0xB0, 0xEA, 0x77, 0x51, 0xAD, 0x06, 0x13, 0x77,
+    0xD1, 0x62, 0x9D, 0x89, 0x2F, 0x59, 0x40, 0x22, 0xD2, 0x52, 0x8A, 0x74, 0x4A, 0x9E, 0x69, 0x7C,
+    0xD1, 0x52, 0xB4, 0x23, 0x14, 0x2F, 0x7A, 0x30, 0x45, 0x0D, 0x7B, 0x7B, 0x90, 0x1C, 0xF6, 0x90,
+    0xBD, 0xD5, 0x42, 0x71, 0xD9, 0xC2, 0xCE, 0xEF, 0xC5, 0xA3, 0x9D, 0x59, 0x21, 0xAE, 0x5F, 0xE9,
+    0xA1, 0xCA, 0x3D, 0x6A, 0xD0, 0x07, 0x7F, 0xD2, 0x38, 0x2D, 0x12, 0xC8, 0x44, 0x2C, 0xFC, 0x2B,
+    0xBB, 0x4A, 0x73, 0x29, 0x21, 0x66, 0xED, 0xCD, 0xBA, 0x6D, 0x18, 0x13, 0x4B, 0xF4, 0x62, 0x9C,
+    0x89, 0xFF, 0x6F, 0xEF, 0x22, 0x1D, 0xA0, 0x36, 0x16, 0x93, 0xF9, 0x18, 0x82, 0x5D, 0x88, 0x85,
+    0x98, 0x60, 0x7D, 0x63, 0x8D, 0x6E, 0x3A, 0xAC, 0x53, 0x8C, 0x6E, 0xF2, 0xAB, 0x1E, 0xC9, 0x00,
+    0x59, 0x27, 0xA0, 0xC6, 0xAA, 0x05, 0xF9, 0x92, 0x07, 0xE3, 0xB6, 0x98, 0x03, 0x6F, 0xEF, 0xD2,
+    0x1E, 0xCC, 0x8B, 0x23, 0xE8, 0x77, 0x05, 0xD4, 0x58, 0xDA, 0x75, 0x20, 0xFA, 0xAF, 0x70, 0xA4,
+    0x1E, 0x48, 0x65, 0x1D, 0x63, 0x1C, 0x17, 0xB3, 0x85, 0x13, 0x8F, 0x04, 0xF3, 0x4A, 0xB8, 0xE7,
+    0xB8, 0x3F, 0x58, 0x12, 0xCC, 0x2B, 0xA3, 0x71, 0x7C, 0x64, 0xCD, 0x7F, 0xC0, 0x10, 0x3F, 0xD8,
+    0x5A, 0x01, 0x90, 0x1F, 0x90, 0xD6, 0x22, 0x75, 0xA1, 0x5F, 0x6E, 0x6E, 0xF4, 0x67, 0x28, 0xC5,
+    0x6E, 0xB1, 0x71, 0xF1, 0x96, 0x26, 0x44, 0x44, 0xAE, 0x8A, 0x88, 0x6C, 0x2C, 0x16, 0xB7, 0x06,
+    0x3B, 0xE9, 0xD5, 0x2E, 0x1F, 0x2D, 0xC6, 0xC9, 0x73, 0xDC, 0x91, 0x8B, 0x3D, 0x5D, 0x4A, 0xBF,
+    0x63, 0x32, 0x09, 0x67, 0x68, 0xFC, 0x1D, 0x6C, 0xD8, 0x74, 0xE0, 0x63, 0x5A, 0xEA, 0x4D, 0x23,
+    0x07, 0xFB, 0x9B, 0xA9, 0x84, 0x33, 0x54, 0xDD, 0xDA, 0xFC, 0x73, 0x60, 0x79, 0xF4, 0xAA, 0x88,
+    0x48, 0x2A, 0x22, 0xDD, 0x2D, 0x82, 0xD5, 0x3D, 0xCB, 0xEF, 0x46, 0x06, 0x53, 0xDE, 0x5C, 0xCA,
+    0x0B, 0x16, 0x56, 0x1E, 0xBB, 0x7F, 0x04, 0x89, 0xDF, 0x58, 0x3C, 0xF6, 0xAD, 0x95, 0x87, 0x19,
+    0x67, 0x23, 0x4B, 0x51, 0xC0, 0xE2, 0x60, 0xF1, 0xC5, 0x28, 0x1A, 0x05, 0xD5, 0xC6, 0x04, 0xF7,
+    0x9F, 0x06, 0x3E, 0xBB, 0x5C, 0x2E, 0x9F, 0x15, 0x11, 0x79, 0x61, 0xB9, 0x5C, 0x2E, 0x6F, 0x09,
+    0x7F, 0x14, 0x11, 0xD1, 0x22, 0x12, 0x4E, 0x2D, 0x62, 0x94, 0xD7, 0x4D, 0x9E, 0xAA, 0x22, 0x3E,
+    0x26, 0x8C, 0x9A, 0x0F, 0x0B, 0x85, 0x25, 0x13, 0x12, 0xE9, 0xA8, 0x7A, 0x8A, 0x91, 0x4C, 0x2C,
+    0x65, 0x1B, 0xA5, 0xF2, 0x72, 0xF6, 0x80, 0x4B, 0xA5, 0x86, 0xA6, 0x8B, 0xB4, 0xFE, 0xBE, 0x75,
+    0x9C, 0xF7, 0x62, 0xF1, 0xC5, 0xB8, 0xB9, 0x84, 0x39, 0xDF, 0x45, 0x36, 0x42, 0x26, 0x96, 0x44,
+    0x5C, 0xAC, 0x5F, 0x0E, 0x91, 0xD2, 0x16, 0x9E, 0x6C, 0x22, 0x91, 0x9A, 0xA6, 0xA3, 0x1C, 0x60,
+    0x82, 0xF4, 0x58, 0xEC, 0xC6, 0x2D, 0x9F, 0x5A, 0xAB, 0xD9, 0x6A, 0x52, 0x21, 0x15, 0x68, 0xBA,
+    0xF9, 0xCD, 0x72, 0x20, 0x1F, 0xC9, 0x47, 0x52, 0xB1, 0xA9, 0x58, 0x8A, 0x8E, 0xA2, 0x03, 0xD3,
+    0x63, 0x7A, 0x28, 0x46, 0x8A, 0xD8, 0x87, 0x4C, 0x2C, 0xA9, 0xD4, 0xE9, 0xDC, 0x93, 0xA6, 0x23,
+    0xA6, 0x50, 0x83, 0x93, 0xC7, 0x3D, 0x0C, 0x98, 0xB5, 0x44, 0x57, 0x40, 0x4D, 0xA8, 0x38, 0xD6,
+    0xD5, 0x70, 0x9B, 0x0E, 0x8A, 0x81, 0x62, 0x80, 0x6C, 0x22, 0x9B, 0x20, 0x1D, 0x49, 0x47, 0xA8,
+    0x3C, 0x95, 0x9F, 0x1B, 0x8B, 0x6D, 0x25, 0xD2, 0x22, 0xED, 0xDC, 0x41, 0xA6, 0xD5, 0x00, 0xD3,
+    0xFA, 0x3D, 0x33, 0x30, 0x59, 0x2D, 0x22, 0x63, 0xB2, 0x58, 0x7C, 0xB9, 0x69, 0x6F, 0xCB, 0xDF,
+    0xAF, 0x73, 0x1B, 0x66, 0x47, 0x8C, 0xD0, 0xAD, 0xFC, 0x7D, 0x7B, 0x33, 0x7F, 0x5F, 0x6F, 0xAC,
+    0x50, 0x3A, 0xAE, 0x97, 0xFE, 0x66, 0xE6, 0x49, 0xD7, 0x91, 0x29, 0x48, 0x44, 0x24, 0x64, 0x22,
+    0x22, 0xD9, 0xF4, 0xCC, 0xFE, 0xE2, 0x0B, 0x43, 0x4C, 0xE3, 0xA7, 0xEB, 0x24, 0x90, 0xB5, 0xEC,
+    0x93, 0x7A, 0x4A, 0xCB, 0x80, 0x6E, 0xD9, 0x26, 0xED, 0x29, 0x61, 0x1F, 0x5D, 0x47, 0x61, 0x5E,
+    0x0D, 0xA9, 0x87, 0xAA, 0x1E, 0x20, 0x9F, 0xF6, 0x17, 0x0B, 0x1A, 0x11, 0xF1, 0xA9, 0x88, 0x04,
+    0xB2, 0x37, 0x16, 0x8B, 0xD9, 0x49, 0x23, 0xAC, 0xFF, 0x80, 0x44, 0x79, 0x3C, 0x15, 0xC6, 0xD6,
+    0xCD, 0x8F, 0x23, 0xA7, 0xD7, 0x45, 0xBA, 0xA3, 0x45, 0xE4, 0xA2, 0x12, 0x11, 0xB1, 0x8B, 0xC5,
+    0xF9, 0xCB, 0x3D, 0x68, 0x27, 0x36, 0xBA, 0x79, 0x26, 0x9E, 0x11, 0x02, 0x65, 0xCD, 0x26, 0x59,
+    0x47, 0x61, 0x93, 0x40, 0xEE, 0xD8, 0x41, 0x75, 0x94, 0x75, 0xD2, 0xA3, 0x5B, 0x76, 0xC9, 0x3D,
+    0x9B, 0xE4, 0xFD, 0xA9, 0xC7, 0x9E, 0x39, 0x3F, 0x18, 0x11, 0xE9, 0xB5, 0x88, 0x74, 0xC9, 0x97,
+    0x0F, 0x16, 0x37, 0xB3, 0x91, 0x76, 0x25, 0x73, 0xA5, 0xDD, 0x9C, 0x16, 0x58, 0xA4, 0x2E, 0x45,
+    0xC4, 0x1B, 0x11, 0x19, 0x4C, 0xBB, 0xCE, 0x4B, 0xD6, 0xAE, 0x65, 0xDD, 0x63, 0x29, 0x6D, 0xED,
+    0x4A, 0xE6, 0x4C, 0xC2, 0x2D, 0x82, 0xAA, 0xD4, 0x33, 0x1D, 0x99, 0xA8, 0x44, 0xC4, 0x25, 0xCB,
+    0x55, 0xBE, 0xF3, 0x39, 0xA4, 0x63, 0xB9, 0x5C, 0x7E, 0x53, 0x44, 0xE4, 0x67, 0x22, 0x22, 0xA1,
+    0x11, 0x79, 0x1D, 0x23, 0x22, 0x5D, 0xBE, 0x4A, 0x21, 0x59, 0xF8, 0x35, 0x57, 0x5A, 0xDC, 0x8A,
+    0x0E, 0x47, 0x6C, 0xF3, 0x51, 0xA2, 0x9E, 0x6A, 0xCD, 0xAF, 0x35, 0x2F, 0x88, 0x88, 0x38, 0x11,
+    0x11, 0x5B, 0xCA, 0xF4, 0xDD, 0xE3, 0x28, 0xB7, 0x5C, 0x2E, 0x97, 0x4B, 0x23, 0x22, 0xF2, 0xD2,
+    0x51, 0x26, 0x4D, 0xE0, 0xBC, 0xBC, 0x1E, 0xD9, 0xC3, 0x9A, 0x64, 0xCC, 0x1E, 0x1A, 0x49, 0xFA,
+    0xA4, 0xCD, 0x5B, 0x7A, 0x9E, 0xE0, 0x02, 0x3D, 0xF7, 0x91, 0xBB, 0x0B, 0x64, 0x96, 0xFE, 0x01,
+    0x92, 0x96, 0xFB, 0x35, 0x3C, 0x81, 0xBA, 0xEA, 0xB8, 0x0F, 0xDE, 0x7E, 0x77, 0xF1, 0xE8, 0x33,
+    0x8B, 0xED, 0x28, 0x4E, 0x3E, 0xB6, 0x5C, 0x4E, 0xCB, 0x4B, 0xAF, 0x38, 0xEE, 0x03, 0xEF, 0xC9,
+    0x2C, 0x67, 0xCE, 0x92, 0xB4, 0x14, 0x59, 0xCD, 0x13, 0x68, 0xDB, 0x73, 0x1F, 0x99, 0x2B, 0xC8,
+    0xAC, 0x6A, 0x53, 0x9F, 0xB4, 0xAA, 0xA3, 0xAC, 0x9F, 0xC8, 0x3B, 0x92, 0xE9, 0xAF, 0xCF, 0xB7,
+    0xEB, 0x48, 0xA9, 0x8D, 0x6F, 0x1D, 0xEB, 0xF4, 0xDC, 0xB9, 0x37, 0xA5, 0x26, 0x19, 0x49, 0x46,
+    0x92, 0x01, 0xF2, 0x96, 0x1E, 0xB8, 0xC0, 0x00, 0xE4, 0xEE, 0x02, 0x40, 0xFF, 0x00, 0xC0, 0xFD,
+    0x1A, 0x40, 0x5D, 0x75, 0x00, 0x6F, 0xBF, 0xBB, 0x58, 0x2C, 0x8E, 0x75, 0x6E, 0xB9, 0xBC, 0xF4,
+    0x8A, 0x03, 0xF0, 0x1E, 0xE0, 0xCC, 0x59, 0x80, 0x22, 0xAB, 0x81, 0xDC, 0xF6, 0x40, 0xE6, 0x0A,
+    0x40, 0xB5, 0xB3, 0x34, 0x55, 0xD6, 0xE4, 0x1D, 0xC9, 0xB4, 0xF8, 0xF0, 0x9D, 0xEB, 0x21, 0x6F,
+    0x99, 0x40, 0x05, 0x6E, 0x74, 0xA8, 0x1B, 0xEE, 0xC2, 0x26, 0xCA, 0xF7, 0x0F, 0xA8, 0x4E, 0xF9,
+    0xFB, 0x35, 0x9B, 0xCA, 0xAB, 0xAB, 0x4E, 0xFD, 0xC4, 0xF3, 0x76, 0x87, 0xF1, 0x3C, 0xF0, 0x24,
+    0x99, 0x27, 0xFF, 0x33, 0xD4, 0x44, 0xFA, 0x8A, 0x53, 0xBF, 0xE8, 0xF0, 0x5E, 0xF9, 0x4D, 0xCE,
+    0x9C, 0x55, 0x5E, 0x75, 0x45, 0xF6, 0xB4, 0x67, 0x33, 0xB7, 0xBF, 0xF0, 0xA8, 0x9F, 0xBA, 0xC2,
+    0x83, 0x69, 0xD3, 0x1E, 0xB2, 0xDF, 0xA0, 0x73, 0x31, 0xBC, 0xBA, 0x87, 0xF4, 0x86, 0xBB, 0x00,
+    0xA9, 0xEF, 0x1F, 0x80, 0xD4, 0xDF, 0xAF, 0x21, 0xF5, 0xEA, 0xAA, 0x23, 0xF5, 0xBC, 0xDD, 0x91,
+    0x7A, 0x1E, 0x78, 0x92, 0xD4, 0x93, 0xFF, 0x19, 0xA9, 0x27, 0x7D, 0xC5, 0xA5, 0x1E, 0xBC, 0x4F,
+    0x3D, 0x9C, 0x39, 0x9B, 0x7A, 0x28, 0xB2, 0xAF, 0x7B, 0xC8, 0xED, 0xCF, 0x3D, 0x64, 0xAE, 0xF0,
+    0xA0, 0xDA, 0x59, 0xD8, 0xFC, 0x80, 0xCE, 0x85, 0x9B, 0x2C, 0x81, 0xE6, 0xA3, 0x7D, 0x24, 0x37,
+    0x1D, 0x6E, 0x25, 0x75, 0xAE, 0x76, 0xBF, 0x3D, 0x94, 0x27, 0x7F, 0x35, 0x50, 0x7A, 0x1A, 0xF1,
+    0x88, 0x53, 0x52, 0xD9, 0x64, 0x24, 0xEB, 0xEF, 0x04, 0xBB, 0xDA, 0xBF, 0xBF, 0x66, 0xA1, 0x19,
+    0x8A, 0xC8, 0x2B, 0x4F, 0xE2, 0xD4, 0xF4, 0xA8, 0xB8, 0x4D, 0xCA, 0x3A, 0x0D, 0x7C, 0x9A, 0x40,
+    0x16, 0x3D, 0xDC, 0xCB, 0x1A, 0x8C, 0x65, 0x0F, 0x18, 0x63, 0xE6, 0x0E, 0x59, 0x53, 0x55, 0xF1,
+    0xF7, 0x34, 0xCB, 0xA5, 0x2C, 0xEB, 0xB9, 0x48, 0xF5, 0x31, 0xEB, 0x4A, 0x8B, 0xB1, 0x60, 0x2C,
+    0xE3, 0xFA, 0xAD, 0x5F, 0xA5, 0x68, 0x82, 0x42, 0x7C, 0x29, 0x1E, 0x91, 0x17, 0xE2, 0xEE, 0x7D,
+    0xF2, 0xBB, 0xCC, 0x29, 0x55, 0xB3, 0x29, 0x9A, 0x08, 0x2B, 0x1B, 0x13, 0x18, 0x65, 0x1D, 0x7F,
+    0x30, 0xCB, 0x82, 0xD1, 0x8D, 0x7B, 0x5C, 0x89, 0x81, 0xB6, 0x12, 0x91, 0xFE, 0xC4, 0xE5, 0x37,
+    0x97, 0x8D, 0x8D, 0x4D, 0xC5, 0x26, 0x7E, 0xAD, 0xCB, 0xBA, 0x10, 0x5F, 0xCA, 0x2B, 0x22, 0xB9,
+    0x8C, 0x70, 0xE2, 0xBB, 0xAB, 0x34, 0xE0, 0x4A, 0x9A, 0x1E, 0xA6, 0x98, 0x31, 0x57, 0xF5, 0x28,
+    0x1F, 0xF3, 0xE2, 0xDF, 0xFC, 0x85, 0x46, 0xBC, 0xB1, 0x95, 0x88, 0xEA, 0x4F, 0x5C, 0x7E, 0xF3,
+    0xA2, 0xF9, 0xA8, 0xBB, 0x03, 0xDC, 0xF3, 0x1C, 0x90, 0x4B, 0x2D, 0xD2, 0x42, 0x29, 0x93, 0x34,
+    0x01, 0xCC, 0x1B, 0xCD, 0x48, 0x65, 0x29, 0xEB, 0x74, 0x24, 0x73, 0x51, 0x9C, 0xE3, 0xE2, 0x6A,
+    0x5A, 0x51, 0xFD, 0xAC, 0x17, 0x1E, 0x67, 0x57, 0xF4, 0x88, 0x51, 0x43, 0x9C, 0x5C, 0x99, 0x92,
+    0x4B, 0x87, 0xCB, 0xCB, 0x87, 0xCB, 0x66, 0x9E, 0xDF, 0xBC, 0x8B, 0x7D, 0x48, 0x87, 0xB9, 0x3B,
+    0xAB, 0x61, 0x96, 0xBF, 0x61, 0x85, 0x6E, 0x35, 0x20, 0xD7, 0xC8, 0x97, 0x24, 0x94, 0xE2, 0xAB,
+    0x79, 0x2F, 0xB9, 0xE7, 0x6F, 0xB7, 0x20, 0x97, 0xBA, 0x92, 0x01, 0x4A, 0x99, 0x9A, 0xEB, 0x13,
+    0x98, 0x37, 0x1A, 0xC1, 0xD4, 0x94, 0x75, 0x2A, 0xE4, 0x1D, 0xDA, 0x61, 0x6C, 0x3A, 0xC4, 0xBF,
+    0x2C, 0x10, 0x3F, 0x19, 0x47, 0x38, 0xB7, 0x19, 0x87, 0x95, 0xCE, 0xC3, 0x72, 0xFB, 0x71, 0x58,
+    0xCF, 0x96, 0xFF, 0x5F, 0x0E, 0xEB, 0x9B, 0x47, 0xC3, 0xFA, 0x9A, 0x65, 0x96, 0xDF, 0x40, 0x1A,
+    0x0B, 0xEC, 0xA9, 0xB8, 0xB2, 0xB7, 0xEE, 0x84, 0xB2, 0xE6, 0xEC, 0x3A, 0x2D, 0x51, 0x9C, 0x9F,
+    0x11, 0xD5, 0xCF, 0x73, 0xF3, 0xA2, 0x88, 0x88, 0xBC, 0x7D, 0xE9, 0x70, 0x79, 0xF9, 0xF0, 0x3B,
+    0xF3, 0xB4, 0xC5, 0xC5, 0x14, 0x1B, 0x9E, 0xD7, 0xD2, 0x87, 0x2E, 0xA8, 0x51, 0x3D, 0xF9, 0xC1,
+    0x97, 0x0B, 0xF1, 0x89, 0xC8, 0x4B, 0x12, 0x28, 0x23, 0xB7, 0xBC, 0x00, 0x92, 0x65, 0xCC, 0x44,
+    0x12, 0xD5, 0x80, 0x46, 0xE6, 0xB8, 0xB2, 0xC6, 0x02, 0x73, 0x38, 0x4F, 0x1F, 0x89, 0x92, 0x8F,
+    0x6B, 0x2F, 0xB6, 0xB1, 0x11, 0xA2, 0x5D, 0x47, 0xEC, 0x79, 0x09, 0x99, 0xC8, 0xD3, 0x22, 0x41,
+    0xD7, 0xC5, 0xD7, 0x2F, 0x1F, 0x3E, 0x57, 0xD8, 0xBC, 0xD6, 0x2D, 0xA5, 0xCD, 0xD0, 0x2D, 0x45,
+    0x5C, 0xF5, 0x3A, 0xF6, 0x25, 0x97, 0x36, 0xBE, 0x37, 0xA2, 0x5B, 0x28, 0xC5, 0xEA, 0x16, 0x12,
+    0x71, 0xBA, 0xE5, 0x53, 0x31, 0xB9, 0xCF, 0x19, 0xB4, 0xD3, 0x2D, 0x9B, 0x68, 0xA7, 0x3B, 0x8C,
+    0x2D, 0xEB, 0xFC, 0xE0, 0x2B, 0xE6, 0x86, 0x90, 0xC9, 0x54, 0xC8, 0x40, 0x2A, 0x03, 0x0B, 0xCB,
+    0x3A, 0xD7, 0x0E, 0x00, 0xFF, 0x04, 0x8E, 0xF4, 0x3F, 0xB3, 0x64, 0xBA, 0x86, 0x3F, 0xFA, 0x7A,
+    0xFC, 0xF5, 0x91, 0xC1, 0xD1, 0x47, 0x56, 0xD9, 0x5D, 0x40, 0x1F, 0xEC, 0xDB, 0x10, 0x65, 0xA9,
+    0xA7, 0x42, 0x64, 0x77, 0x1E, 0x09, 0x20, 0x22, 0x93, 0x0E, 0x51, 0x8A, 0x2A, 0x43, 0xCC, 0xD4,
+    0x24, 0x41, 0x8B, 0xC8, 0xEB, 0x4A, 0x42, 0x15, 0xF5, 0x0F, 0x7D, 0x25, 0x13, 0xA9, 0x88, 0xAD,
+    0x64, 0xA0, 0x92, 0x9E, 0x4A, 0xBA, 0x52, 0xC4, 0x52, 0xC9, 0x0B, 0x22, 0x3D, 0x54, 0x12, 0x65,
+    0xFA, 0x6A, 0xAA, 0xA4, 0x9F, 0x73, 0x14, 0x59, 0xA0, 0xEA, 0xA3, 0xE3, 0x56, 0x55, 0xC7, 0xA0,
+    0xA0, 0x9D, 0xF9, 0x4F, 0x78, 0x6C, 0xC7, 0x5C, 0x7F, 0xAC, 0xDC, 0xBA, 0x2A, 0xCB, 0xB1, 0x1C,
+    0x76, 0xF1, 0xF8, 0x7F, 0x01,
 };
 
 static const EpdGlyph bookerly_16_regularGlyphs[] = {
@@ -2091,7 +2160,7 @@ static const EpdGlyph bookerly_16_regularGlyphs[] = {
     { 3, 30, 9, 3, 26, 23, 9063 }, // |
     { 11, 33, 13, 0, 27, 91, 9086 }, // }
     { 16, 6, 21, 2, 14, 24, 9177 }, // ~
-    { 0, 0, 7, 0, 0, 0, 0 }, //  
+    { 0, 0, 7, 0, 0, 0, 9201 }, //  
     { 6, 26, 9, 1, 18, 39, 0 }, // ¡
     { 16, 33, 21, 2, 26, 132, 39 }, // ¢
     { 19, 24, 21, 1, 23, 114, 171 }, // £
@@ -2102,642 +2171,649 @@ static const EpdGlyph bookerly_16_regularGlyphs[] = {
     { 12, 5, 22, 5, 25, 15, 609 }, // ¨
     { 25, 25, 26, 0, 24, 157, 624 }, // ©
     { 11, 16, 15, 2, 24, 44, 781 }, // ª
-    { 17, 13, 17, 1, 15, 56, 825 }, // «
-    { 15, 8, 21, 3, 15, 30, 881 }, // ¬
-    { 11, 3, 12, 1, 10, 9, 911 }, // ­
-    { 19, 18, 19, 0, 26, 86, 920 }, // ®
-    { 12, 4, 22, 5, 24, 12, 1006 }, // ¯
-    { 12, 11, 17, 3, 23, 33, 1018 }, // °
-    { 15, 20, 21, 3, 20, 75, 1051 }, // ±
-    { 12, 16, 15, 2, 28, 48, 1126 }, // ²
-    { 11, 17, 15, 2, 28, 47, 1174 }, // ³
-    { 7, 8, 22, 8, 27, 14, 1221 }, // ´
-    { 21, 26, 22, 2, 18, 137, 1235 }, // µ
-    { 17, 28, 18, 0, 23, 119, 1372 }, // ¶
-    { 5, 6, 9, 2, 12, 8, 1491 }, // ·
-    { 6, 8, 22, 8, -1, 12, 1499 }, // ¸
-    { 10, 16, 15, 2, 28, 40, 1511 }, // ¹
-    { 12, 16, 15, 2, 24, 48, 1551 }, // º
-    { 17, 13, 17, 1, 15, 56, 1599 }, // »
-    { 32, 27, 36, 2, 24, 216, 1655 }, // ¼
-    { 32, 27, 36, 2, 24, 216, 1871 }, // ½
-    { 33, 27, 36, 2, 24, 223, 2087 }, // ¾
-    { 13, 25, 16, 1, 18, 82, 2310 }, // ¿
-    { 25, 32, 24, 0, 32, 200, 2392 }, // À
-    { 25, 32, 24, 0, 32, 200, 2592 }, // Á
-    { 25, 32, 24, 0, 32, 200, 2792 }, // Â
-    { 25, 31, 24, 0, 31, 194, 2992 }, // Ã
-    { 25, 31, 24, 0, 31, 194, 3186 }, // Ä
-    { 25, 33, 24, 0, 33, 207, 3380 }, // Å
-    { 31, 23, 31, -1, 23, 179, 3587 }, // Æ
-    { 19, 33, 21, 1, 24, 157, 3766 }, // Ç
-    { 19, 32, 21, 1, 32, 152, 3923 }, // È
-    { 19, 32, 21, 1, 32, 152, 4075 }, // É
-    { 19, 32, 21, 1, 32, 152, 4227 }, // Ê
-    { 19, 31, 21, 1, 31, 148, 4379 }, // Ë
-    { 11, 32, 12, 1, 32, 88, 4527 }, // Ì
-    { 11, 32, 12, 1, 32, 88, 4615 }, // Í
-    { 12, 32, 12, 0, 32, 96, 4703 }, // Î
-    { 12, 31, 12, 0, 31, 93, 4799 }, // Ï
-    { 24, 25, 25, 0, 24, 150, 4892 }, // Ð
-    { 26, 32, 27, 1, 31, 208, 5042 }, // Ñ
-    { 24, 33, 26, 1, 32, 198, 5250 }, // Ò
-    { 24, 33, 26, 1, 32, 198, 5448 }, // Ó
-    { 24, 33, 26, 1, 32, 198, 5646 }, // Ô
-    { 24, 32, 26, 1, 31, 192, 5844 }, // Õ
-    { 24, 32, 26, 1, 31, 192, 6036 }, // Ö
-    { 14, 14, 21, 3, 18, 49, 6228 }, // ×
-    { 25, 25, 26, 0, 24, 157, 6277 }, // Ø
-    { 25, 33, 26, 0, 32, 207, 6434 }, // Ù
-    { 25, 33, 26, 0, 32, 207, 6641 }, // Ú
-    { 25, 33, 26, 0, 32, 207, 6848 }, // Û
-    { 25, 32, 26, 0, 31, 200, 7055 }, // Ü
-    { 23, 32, 23, 0, 32, 184, 7255 }, // Ý
-    { 18, 23, 21, 1, 23, 104, 7439 }, // Þ
-    { 21, 27, 21, 0, 26, 142, 7543 }, // ß
-    { 18, 29, 18, 1, 28, 131, 7685 }, // à
-    { 18, 28, 18, 1, 27, 126, 7816 }, // á
-    { 18, 28, 18, 1, 27, 126, 7942 }, // â
-    { 18, 27, 18, 1, 26, 122, 8068 }, // ã
-    { 18, 26, 18, 1, 25, 117, 8190 }, // ä
-    { 18, 29, 18, 1, 28, 131, 8307 }, // å
-    { 25, 19, 27, 1, 18, 119, 8438 }, // æ
-    { 15, 27, 17, 1, 18, 102, 8557 }, // ç
-    { 15, 29, 17, 1, 28, 109, 8659 }, // è
-    { 15, 28, 17, 1, 27, 105, 8768 }, // é
-    { 15, 28, 17, 1, 27, 105, 8873 }, // ê
-    { 15, 26, 17, 1, 25, 98, 8978 }, // ë
-    { 11, 28, 11, 0, 28, 77, 9076 }, // ì
-    { 11, 27, 11, 0, 27, 75, 9153 }, // í
-    { 11, 27, 11, 0, 27, 75, 9228 }, // î
-    { 12, 25, 11, -1, 25, 75, 9303 }, // ï
-    { 18, 28, 20, 1, 27, 126, 9378 }, // ð
-    { 22, 26, 22, 0, 26, 143, 9504 }, // ñ
-    { 18, 29, 20, 1, 28, 131, 9647 }, // ò
-    { 18, 28, 20, 1, 27, 126, 9778 }, // ó
-    { 18, 28, 20, 1, 27, 126, 9904 }, // ô
-    { 18, 27, 20, 1, 26, 122, 10030 }, // õ
-    { 18, 26, 20, 1, 25, 117, 10152 }, // ö
-    { 15, 16, 21, 3, 19, 60, 10269 }, // ÷
-    { 19, 19, 20, 0, 18, 91, 10329 }, // ø
-    { 22, 29, 21, 0, 28, 160, 10420 }, // ù
-    { 22, 28, 21, 0, 27, 154, 10580 }, // ú
-    { 22, 28, 21, 0, 27, 154, 10734 }, // û
-    { 22, 26, 21, 0, 25, 143, 10888 }, // ü
-    { 20, 35, 20, 0, 27, 175, 11031 }, // ý
-    { 20, 34, 21, 0, 26, 170, 11206 }, // þ
-    { 20, 33, 20, 0, 25, 165, 11376 }, // ÿ
-    { 25, 30, 24, 0, 30, 188, 0 }, // Ā
-    { 18, 25, 18, 1, 24, 113, 188 }, // ā
-    { 25, 32, 24, 0, 32, 200, 301 }, // Ă
-    { 18, 27, 18, 1, 26, 122, 501 }, // ă
-    { 25, 31, 24, 0, 24, 194, 623 }, // Ą
-    { 18, 25, 18, 1, 18, 113, 817 }, // ą
-    { 19, 33, 21, 1, 32, 157, 930 }, // Ć
-    { 15, 28, 17, 1, 27, 105, 1087 }, // ć
-    { 19, 33, 21, 1, 32, 157, 1192 }, // Ĉ
-    { 15, 28, 17, 1, 27, 105, 1349 }, // ĉ
-    { 19, 32, 21, 1, 31, 152, 1454 }, // Ċ
-    { 15, 26, 17, 1, 25, 98, 1606 }, // ċ
-    { 19, 33, 21, 1, 32, 157, 1704 }, // Č
-    { 15, 28, 17, 1, 27, 105, 1861 }, // č
-    { 23, 33, 25, 1, 32, 190, 1966 }, // Ď
-    { 23, 27, 21, 1, 26, 156, 2156 }, // ď
-    { 24, 25, 25, 0, 24, 150, 2312 }, // Đ
-    { 20, 27, 21, 1, 26, 135, 2462 }, // đ
-    { 19, 30, 21, 1, 30, 143, 2597 }, // Ē
-    { 15, 25, 17, 1, 24, 94, 2740 }, // ē
-    { 19, 32, 21, 1, 32, 152, 2834 }, // Ĕ
-    { 15, 27, 17, 1, 26, 102, 2986 }, // ĕ
-    { 19, 31, 21, 1, 31, 148, 3088 }, // Ė
-    { 15, 26, 17, 1, 25, 98, 3236 }, // ė
-    { 19, 30, 21, 1, 23, 143, 3334 }, // Ę
-    { 15, 25, 17, 1, 18, 94, 3477 }, // ę
-    { 19, 32, 21, 1, 32, 152, 3571 }, // Ě
-    { 15, 28, 17, 1, 27, 105, 3723 }, // ě
-    { 22, 33, 24, 1, 32, 182, 3828 }, // Ĝ
-    { 19, 35, 19, 0, 27, 167, 4010 }, // ĝ
-    { 22, 33, 24, 1, 32, 182, 4177 }, // Ğ
-    { 19, 34, 19, 0, 26, 162, 4359 }, // ğ
-    { 22, 32, 24, 1, 31, 176, 4521 }, // Ġ
-    { 19, 33, 19, 0, 25, 157, 4697 }, // ġ
-    { 22, 33, 24, 1, 24, 182, 4854 }, // Ģ
-    { 19, 36, 19, 0, 28, 171, 5036 }, // ģ
-    { 26, 32, 28, 1, 32, 208, 5207 }, // Ĥ
-    { 23, 34, 22, -1, 34, 196, 5415 }, // ĥ
-    { 27, 23, 28, 0, 23, 156, 5611 }, // Ħ
-    { 22, 26, 22, 0, 26, 143, 5767 }, // ħ
-    { 12, 31, 12, 0, 31, 93, 5910 }, // Ĩ
-    { 11, 26, 11, 0, 26, 72, 6003 }, // ĩ
-    { 12, 30, 12, 0, 30, 90, 6075 }, // Ī
-    { 11, 24, 11, 0, 24, 66, 6165 }, // ī
-    { 12, 32, 12, 0, 32, 96, 6231 }, // Ĭ
-    { 11, 26, 11, 0, 26, 72, 6327 }, // ĭ
-    { 11, 30, 12, 1, 23, 83, 6399 }, // Į
-    { 11, 33, 11, 0, 26, 91, 6482 }, // į
-    { 11, 31, 12, 1, 31, 86, 6573 }, // İ
-    { 11, 18, 11, 0, 18, 50, 6659 }, // ı
-    { 22, 30, 24, 1, 23, 165, 6709 }, // Ĳ
-    { 18, 34, 20, 0, 26, 153, 6874 }, // ĳ
-    { 14, 39, 12, -2, 32, 137, 7027 }, // Ĵ
-    { 13, 35, 9, -2, 27, 114, 7164 }, // ĵ
-    { 23, 32, 24, 1, 23, 184, 7278 }, // Ķ
-    { 20, 35, 20, 0, 26, 175, 7462 }, // ķ
-    { 21, 19, 20, 0, 18, 100, 7637 }, // ĸ
-    { 19, 32, 20, 1, 32, 152, 7737 }, // Ĺ
-    { 11, 34, 11, 0, 34, 94, 7889 }, // ĺ
-    { 19, 32, 20, 1, 23, 152, 7983 }, // Ļ
-    { 11, 35, 11, 0, 26, 97, 8135 }, // ļ
-    { 19, 26, 20, 1, 26, 124, 8232 }, // Ľ
-    { 14, 26, 11, 0, 26, 91, 8356 }, // ľ
-    { 19, 23, 20, 1, 23, 110, 8447 }, // Ŀ
-    { 16, 26, 15, 0, 26, 104, 8557 }, // ŀ
-    { 21, 23, 20, -1, 23, 121, 8661 }, // Ł
-    { 13, 26, 11, -1, 26, 85, 8782 }, // ł
-    { 26, 33, 27, 1, 32, 215, 8867 }, // Ń
-    { 22, 27, 22, 0, 27, 149, 9082 }, // ń
-    { 26, 32, 27, 1, 23, 208, 9231 }, // Ņ
-    { 22, 27, 22, 0, 18, 149, 9439 }, // ņ
-    { 26, 33, 27, 1, 32, 215, 9588 }, // Ň
-    { 22, 27, 22, 0, 27, 149, 9803 }, // ň
-    { 29, 25, 30, 1, 25, 182, 9952 }, // ŉ
-    { 26, 30, 27, 1, 23, 195, 10134 }, // Ŋ
-    { 19, 26, 21, 0, 18, 124, 10329 }, // ŋ
-    { 24, 31, 26, 1, 30, 186, 10453 }, // Ō
-    { 18, 25, 20, 1, 24, 113, 10639 }, // ō
-    { 24, 33, 26, 1, 32, 198, 10752 }, // Ŏ
-    { 18, 27, 20, 1, 26, 122, 10950 }, // ŏ
-    { 24, 34, 26, 1, 33, 204, 11072 }, // Ő
-    { 18, 28, 20, 1, 27, 126, 11276 }, // ő
-    { 30, 24, 32, 1, 23, 180, 11402 }, // Œ
-    { 28, 19, 30, 1, 18, 133, 11582 }, // œ
-    { 22, 33, 22, 1, 32, 182, 11715 }, // Ŕ
-    { 15, 27, 15, 0, 27, 102, 11897 }, // ŕ
-    { 22, 33, 22, 1, 24, 182, 11999 }, // Ŗ
-    { 15, 27, 15, 0, 18, 102, 12181 }, // ŗ
-    { 22, 33, 22, 1, 32, 182, 12283 }, // Ř
-    { 15, 27, 15, 0, 27, 102, 12465 }, // ř
-    { 16, 33, 18, 1, 32, 132, 12567 }, // Ś
-    { 14, 28, 16, 1, 27, 98, 12699 }, // ś
-    { 16, 33, 18, 1, 32, 132, 12797 }, // Ŝ
-    { 14, 28, 16, 1, 27, 98, 12929 }, // ŝ
-    { 16, 33, 18, 1, 24, 132, 13027 }, // Ş
-    { 14, 27, 16, 1, 18, 95, 13159 }, // ş
-    { 16, 33, 18, 1, 32, 132, 13254 }, // Š
-    { 14, 28, 16, 1, 27, 98, 13386 }, // š
-    { 21, 32, 23, 1, 23, 168, 13484 }, // Ţ
-    { 13, 31, 14, 0, 22, 101, 13652 }, // ţ
-    { 21, 32, 23, 1, 32, 168, 13753 }, // Ť
-    { 13, 28, 14, 0, 27, 91, 13921 }, // ť
-    { 21, 23, 23, 1, 23, 121, 14012 }, // Ŧ
-    { 13, 23, 14, 0, 22, 75, 14133 }, // ŧ
-    { 25, 32, 26, 0, 31, 200, 14208 }, // Ũ
-    { 22, 27, 21, 0, 26, 149, 14408 }, // ũ
-    { 25, 31, 26, 0, 30, 194, 14557 }, // Ū
-    { 22, 25, 21, 0, 24, 138, 14751 }, // ū
-    { 25, 33, 26, 0, 32, 207, 14889 }, // Ŭ
-    { 22, 27, 21, 0, 26, 149, 15096 }, // ŭ
-    { 25, 34, 26, 0, 33, 213, 15245 }, // Ů
-    { 22, 29, 21, 0, 28, 160, 15458 }, // ů
-    { 25, 34, 26, 0, 33, 213, 15618 }, // Ű
-    { 22, 28, 21, 0, 27, 154, 15831 }, // ű
-    { 25, 30, 26, 0, 23, 188, 15985 }, // Ų
-    { 22, 25, 21, 0, 18, 138, 16173 }, // ų
-    { 36, 33, 37, 0, 32, 297, 16311 }, // Ŵ
-    { 29, 28, 29, 0, 27, 203, 16608 }, // ŵ
-    { 23, 32, 23, 0, 32, 184, 16811 }, // Ŷ
-    { 20, 35, 20, 0, 27, 175, 16995 }, // ŷ
-    { 23, 31, 23, 0, 31, 179, 17170 }, // Ÿ
-    { 18, 33, 20, 1, 32, 149, 17349 }, // Ź
-    { 15, 28, 17, 1, 27, 105, 17498 }, // ź
-    { 18, 32, 20, 1, 31, 144, 17603 }, // Ż
-    { 15, 26, 17, 1, 25, 98, 17747 }, // ż
-    { 18, 33, 20, 1, 32, 149, 17845 }, // Ž
-    { 15, 28, 17, 1, 27, 105, 17994 }, // ž
-    { 16, 26, 13, 0, 26, 104, 18099 }, // ſ
-    { 7, 9, 0, -5, 28, 16, 0 }, // ̀
-    { 7, 8, 0, -2, 27, 14, 16 }, // ́
-    { 12, 8, 0, -6, 27, 24, 30 }, // ̂
-    { 12, 6, 0, -6, 26, 18, 54 }, // ̃
-    { 12, 4, 0, -6, 24, 12, 72 }, // ̄
-    { 12, 6, 0, -6, 26, 18, 84 }, // ̆
-    { 6, 5, 0, -3, 25, 8, 102 }, // ̇
-    { 12, 5, 0, -6, 25, 15, 110 }, // ̈
-    { 10, 10, 0, -5, 29, 25, 125 }, // ̉
-    { 10, 10, 0, -5, 28, 25, 150 }, // ̊
-    { 12, 8, 0, -5, 27, 24, 175 }, // ̋
-    { 12, 8, 0, -6, 27, 24, 199 }, // ̌
-    { 12, 8, 0, -7, 27, 24, 223 }, // ̏
-    { 12, 6, 0, -6, 26, 18, 247 }, // ̑
-    { 6, 9, 0, -3, 28, 14, 265 }, // ̒
-    { 6, 10, 0, -2, 29, 15, 279 }, // ̓
-    { 6, 10, 0, -4, 29, 15, 294 }, // ̔
-    { 4, 9, 0, -2, 29, 9, 309 }, // ̕
-    { 6, 8, 0, -3, 21, 12, 318 }, // ̛
-    { 6, 6, 0, -3, -2, 9, 330 }, // ̣
-    { 12, 5, 0, -6, -3, 15, 339 }, // ̤
-    { 8, 8, 0, -4, -1, 16, 354 }, // ̥
-    { 6, 8, 0, -3, -1, 12, 370 }, // ̦
-    { 6, 8, 0, -3, -1, 12, 382 }, // ̧
-    { 8, 8, 0, -4, 1, 16, 394 }, // ̨
-    { 3, 8, 9, 3, -1, 6, 410 }, // ̩
-    { 12, 7, 0, -6, -2, 21, 416 }, // ̭
-    { 12, 6, 0, -6, -2, 18, 437 }, // ̮
-    { 12, 6, 0, -6, -2, 18, 455 }, // ̰
-    { 12, 4, 0, -6, -3, 12, 473 }, // ̱
-    { 12, 6, 0, -6, 26, 18, 485 }, // ͂
-    { 12, 13, 0, -6, 33, 39, 503 }, // ̈́
-    { 6, 6, 0, -2, -2, 9, 542 }, // ͅ
-    { 19, 32, 21, 1, 32, 152, 0 }, // Ѐ
-    { 19, 31, 21, 1, 31, 148, 152 }, // Ё
-    { 25, 30, 27, 1, 23, 188, 300 }, // Ђ
-    { 17, 32, 19, 1, 32, 136, 488 }, // Ѓ
-    { 20, 25, 22, 1, 24, 125, 624 }, // Є
-    { 16, 25, 18, 1, 24, 100, 749 }, // Ѕ
-    { 11, 23, 12, 1, 23, 64, 849 }, // І
-    { 12, 31, 12, 0, 31, 93, 913 }, // Ї
-    { 14, 30, 12, -2, 23, 105, 1006 }, // Ј
-    { 31, 24, 32, 0, 23, 186, 1111 }, // Љ
-    { 32, 24, 34, 1, 23, 192, 1297 }, // Њ
-    { 27, 23, 28, 1, 23, 156, 1489 }, // Ћ
-    { 23, 33, 24, 1, 32, 190, 1645 }, // Ќ
-    { 26, 32, 27, 1, 32, 208, 1835 }, // Ѝ
-    { 24, 32, 24, 0, 31, 192, 2043 }, // Ў
-    { 25, 31, 26, 1, 23, 194, 2235 }, // Џ
-    { 25, 24, 24, 0, 24, 150, 2429 }, // А
-    { 19, 24, 21, 1, 23, 114, 2579 }, // Б
-    { 19, 25, 20, 1, 24, 119, 2693 }, // В
-    { 17, 23, 19, 1, 23, 98, 2812 }, // Г
-    { 24, 30, 25, 0, 23, 180, 2910 }, // Д
-    { 19, 23, 21, 1, 23, 110, 3090 }, // Е
-    { 33, 25, 33, 0, 24, 207, 3200 }, // Ж
-    { 17, 25, 19, 1, 24, 107, 3407 }, // З
-    { 26, 23, 27, 1, 23, 150, 3514 }, // И
-    { 26, 31, 27, 1, 31, 202, 3664 }, // Й
-    { 23, 25, 24, 1, 24, 144, 3866 }, // К
-    { 24, 24, 24, 0, 23, 144, 4010 }, // Л
-    { 30, 23, 30, 0, 23, 173, 4154 }, // М
-    { 26, 23, 28, 1, 23, 150, 4327 }, // Н
-    { 24, 25, 26, 1, 24, 150, 4477 }, // О
-    { 25, 23, 27, 1, 23, 144, 4627 }, // П
-    { 18, 24, 20, 1, 24, 108, 4771 }, // Р
-    { 19, 25, 21, 1, 24, 119, 4879 }, // С
-    { 21, 23, 23, 1, 23, 121, 4998 }, // Т
-    { 24, 24, 24, 0, 23, 144, 5119 }, // У
-    { 24, 25, 26, 1, 24, 150, 5263 }, // Ф
-    { 24, 23, 24, 0, 23, 138, 5413 }, // Х
-    { 25, 30, 26, 1, 23, 188, 5551 }, // Ц
-    { 23, 23, 24, 0, 23, 133, 5739 }, // Ч
-    { 33, 23, 35, 1, 23, 190, 5872 }, // Ш
-    { 34, 30, 35, 1, 23, 255, 6062 }, // Щ
-    { 24, 24, 25, 1, 23, 144, 6317 }, // Ъ
-    { 29, 24, 31, 1, 23, 174, 6461 }, // Ы
-    { 19, 24, 21, 1, 23, 114, 6635 }, // Ь
-    { 20, 25, 22, 1, 24, 125, 6749 }, // Э
-    { 33, 25, 35, 1, 24, 207, 6874 }, // Ю
-    { 22, 24, 22, -1, 23, 132, 7081 }, // Я
-    { 18, 19, 18, 1, 18, 86, 7213 }, // а
-    { 17, 27, 19, 1, 26, 115, 7299 }, // б
-    { 16, 19, 18, 1, 18, 76, 7414 }, // в
-    { 15, 17, 16, 1, 17, 64, 7490 }, // г
-    { 21, 23, 21, 0, 17, 121, 7554 }, // д
-    { 15, 19, 17, 1, 18, 72, 7675 }, // е
-    { 27, 19, 27, 0, 18, 129, 7747 }, // ж
-    { 14, 19, 16, 1, 18, 67, 7876 }, // з
-    { 21, 17, 23, 1, 17, 90, 7943 }, // и
-    { 21, 25, 23, 1, 25, 132, 8033 }, // й
-    { 19, 19, 19, 1, 18, 91, 8165 }, // к
-    { 20, 18, 20, 0, 17, 90, 8256 }, // л
-    { 24, 17, 26, 1, 17, 102, 8346 }, // м
-    { 21, 17, 23, 1, 17, 90, 8448 }, // н
-    { 18, 19, 20, 1, 18, 86, 8538 }, // о
-    { 21, 17, 23, 1, 17, 90, 8624 }, // п
-    { 19, 26, 20, 0, 18, 124, 8714 }, // р
-    { 15, 19, 17, 1, 18, 72, 8838 }, // с
-    { 17, 17, 19, 1, 17, 73, 8910 }, // т
-    { 20, 25, 20, 0, 17, 125, 8983 }, // у
-    { 23, 34, 24, 1, 26, 196, 9108 }, // ф
-    { 20, 17, 20, 0, 17, 85, 9304 }, // х
-    { 21, 23, 23, 1, 17, 121, 9389 }, // ц
-    { 19, 17, 20, 0, 17, 81, 9510 }, // ч
-    { 27, 17, 29, 1, 17, 115, 9591 }, // ш
-    { 28, 23, 29, 1, 17, 161, 9706 }, // щ
-    { 19, 18, 21, 1, 17, 86, 9867 }, // ъ
-    { 25, 18, 27, 1, 17, 113, 9953 }, // ы
-    { 16, 18, 18, 1, 17, 72, 10066 }, // ь
-    { 15, 19, 17, 1, 18, 72, 10138 }, // э
-    { 26, 19, 28, 1, 18, 124, 10210 }, // ю
-    { 18, 18, 19, 0, 17, 81, 10334 }, // я
-    { 15, 29, 17, 1, 28, 109, 10415 }, // ѐ
-    { 15, 26, 17, 1, 25, 98, 10524 }, // ё
-    { 19, 34, 21, 0, 26, 162, 10622 }, // ђ
-    { 15, 27, 16, 1, 27, 102, 10784 }, // ѓ
-    { 15, 19, 17, 1, 18, 72, 10886 }, // є
-    { 14, 19, 16, 1, 18, 67, 10958 }, // ѕ
-    { 11, 26, 11, 0, 26, 72, 11025 }, // і
-    { 12, 25, 11, -1, 25, 75, 11097 }, // ї
-    { 10, 34, 9, -2, 26, 85, 11172 }, // ј
-    { 26, 18, 26, 0, 17, 117, 11257 }, // љ
-    { 26, 18, 28, 1, 17, 117, 11374 }, // њ
-    { 22, 26, 22, 0, 26, 143, 11491 }, // ћ
-    { 19, 28, 19, 1, 27, 133, 11634 }, // ќ
-    { 21, 28, 23, 1, 28, 147, 11767 }, // ѝ
-    { 20, 33, 20, 0, 25, 165, 11914 }, // ў
-    { 21, 24, 22, 1, 17, 126, 12079 }, // џ
-    { 23, 27, 24, 0, 26, 156, 12205 }, // Ѣ
-    { 19, 25, 20, 1, 24, 119, 12361 }, // ѣ
-    { 24, 25, 26, 1, 24, 150, 12480 }, // Ѳ
-    { 18, 19, 20, 1, 18, 86, 12630 }, // ѳ
-    { 25, 25, 25, 0, 24, 157, 12716 }, // Ѵ
-    { 21, 19, 20, 0, 18, 100, 12873 }, // ѵ
-    { 26, 38, 27, 1, 31, 247, 12973 }, // Ҋ
-    { 21, 31, 23, 1, 25, 163, 13220 }, // ҋ
-    { 20, 24, 21, 0, 23, 120, 13383 }, // Ҍ
-    { 17, 25, 17, 0, 24, 107, 13503 }, // ҍ
-    { 18, 24, 20, 1, 24, 108, 13610 }, // Ҏ
-    { 19, 26, 20, 0, 18, 124, 13718 }, // ҏ
-    { 17, 28, 19, 1, 28, 119, 13842 }, // Ґ
-    { 14, 21, 16, 1, 21, 74, 13961 }, // ґ
-    { 18, 23, 19, 0, 23, 104, 14035 }, // Ғ
-    { 15, 17, 16, 1, 17, 64, 14139 }, // ғ
-    { 20, 30, 22, 1, 23, 150, 14203 }, // Ҕ
-    { 18, 25, 20, 1, 17, 113, 14353 }, // ҕ
-    { 33, 31, 33, 0, 24, 256, 14466 }, // Җ
-    { 27, 24, 27, 0, 18, 162, 14722 }, // җ
-    { 17, 31, 19, 1, 24, 132, 14884 }, // Ҙ
-    { 14, 25, 16, 1, 18, 88, 15016 }, // ҙ
-    { 23, 31, 24, 1, 24, 179, 15104 }, // Қ
-    { 19, 24, 19, 1, 18, 114, 15283 }, // қ
-    { 24, 25, 25, 1, 24, 150, 15397 }, // Ҝ
-    { 19, 19, 20, 1, 18, 91, 15547 }, // ҝ
-    { 23, 25, 24, 1, 24, 144, 15638 }, // Ҟ
-    { 19, 25, 19, 0, 24, 119, 15782 }, // ҟ
-    { 27, 25, 28, 1, 24, 169, 15901 }, // Ҡ
-    { 21, 19, 22, 1, 18, 100, 16070 }, // ҡ
-    { 26, 30, 28, 1, 23, 195, 16170 }, // Ң
-    { 22, 23, 23, 1, 17, 127, 16365 }, // ң
-    { 30, 23, 32, 1, 23, 173, 16492 }, // Ҥ
-    { 24, 17, 26, 1, 17, 102, 16665 }, // ҥ
-    { 33, 30, 35, 1, 23, 248, 16767 }, // Ҧ
-    { 30, 25, 32, 1, 17, 188, 17015 }, // ҧ
-    { 26, 25, 27, 1, 24, 163, 17203 }, // Ҩ
-    { 20, 19, 21, 1, 18, 95, 17366 }, // ҩ
-    { 19, 31, 21, 1, 24, 148, 17461 }, // Ҫ
-    { 15, 25, 17, 1, 18, 94, 17609 }, // ҫ
-    { 21, 30, 23, 1, 23, 158, 17703 }, // Ҭ
-    { 17, 23, 18, 1, 17, 98, 17861 }, // ҭ
-    { 23, 23, 23, 0, 23, 133, 17959 }, // Ү
-    { 20, 25, 20, 0, 17, 125, 18092 }, // ү
-    { 23, 23, 23, 0, 23, 133, 18217 }, // Ұ
-    { 20, 25, 20, 0, 17, 125, 18350 }, // ұ
-    { 24, 30, 24, 0, 23, 180, 18475 }, // Ҳ
-    { 20, 23, 20, 0, 17, 115, 18655 }, // ҳ
-    { 29, 30, 30, 1, 23, 218, 18770 }, // Ҵ
-    { 25, 23, 26, 1, 17, 144, 18988 }, // ҵ
-    { 23, 30, 24, 0, 23, 173, 19132 }, // Ҷ
-    { 20, 23, 20, 0, 17, 115, 19305 }, // ҷ
-    { 23, 23, 24, 0, 23, 133, 19420 }, // Ҹ
-    { 19, 17, 20, 0, 17, 81, 19553 }, // ҹ
-    { 22, 23, 24, 1, 23, 127, 19634 }, // Һ
-    { 22, 26, 22, 0, 26, 143, 19761 }, // һ
-    { 26, 25, 27, 0, 24, 163, 19904 }, // Ҽ
-    { 20, 19, 21, 0, 18, 95, 20067 }, // ҽ
-    { 26, 31, 27, 0, 24, 202, 20162 }, // Ҿ
-    { 20, 25, 21, 0, 18, 125, 20364 }, // ҿ
-    { 11, 23, 12, 1, 23, 64, 20489 }, // Ӏ
-    { 33, 32, 33, 0, 31, 264, 20553 }, // Ӂ
-    { 27, 26, 27, 0, 25, 176, 20817 }, // ӂ
-    { 21, 31, 23, 1, 24, 163, 20993 }, // Ӄ
-    { 17, 26, 20, 1, 18, 111, 21156 }, // ӄ
-    { 24, 30, 24, 0, 23, 180, 21267 }, // Ӆ
-    { 20, 23, 20, 0, 17, 115, 21447 }, // ӆ
-    { 26, 30, 27, 1, 23, 195, 21562 }, // Ӈ
-    { 21, 25, 23, 1, 17, 132, 21757 }, // ӈ
-    { 26, 30, 28, 1, 23, 195, 21889 }, // Ӊ
-    { 21, 23, 23, 1, 17, 121, 22084 }, // ӊ
-    { 23, 30, 24, 0, 23, 173, 22205 }, // Ӌ
-    { 19, 23, 20, 0, 17, 110, 22378 }, // ӌ
-    { 30, 30, 30, 0, 23, 225, 22488 }, // Ӎ
-    { 24, 23, 26, 1, 17, 138, 22713 }, // ӎ
-    { 11, 26, 11, 0, 26, 72, 22851 }, // ӏ
-    { 25, 31, 24, 0, 31, 194, 22923 }, // Ӑ
-    { 18, 26, 18, 1, 25, 117, 23117 }, // ӑ
-    { 25, 31, 24, 0, 31, 194, 23234 }, // Ӓ
-    { 18, 26, 18, 1, 25, 117, 23428 }, // ӓ
-    { 31, 23, 31, -1, 23, 179, 23545 }, // Ӕ
-    { 25, 19, 27, 1, 18, 119, 23724 }, // ӕ
-    { 19, 31, 21, 1, 31, 148, 23843 }, // Ӗ
-    { 15, 26, 17, 1, 25, 98, 23991 }, // ӗ
-    { 20, 25, 23, 1, 24, 125, 24089 }, // Ә
-    { 15, 19, 17, 1, 18, 72, 24214 }, // ә
-    { 20, 32, 23, 1, 31, 160, 24286 }, // Ӛ
-    { 15, 26, 17, 1, 25, 98, 24446 }, // ӛ
-    { 33, 32, 33, 0, 31, 264, 24544 }, // Ӝ
-    { 27, 26, 27, 0, 25, 176, 24808 }, // ӝ
-    { 17, 32, 19, 1, 31, 136, 24984 }, // Ӟ
-    { 14, 26, 16, 1, 25, 91, 25120 }, // ӟ
-    { 17, 24, 19, 1, 23, 102, 25211 }, // Ӡ
-    { 16, 25, 17, 0, 17, 100, 25313 }, // ӡ
-    { 26, 30, 27, 1, 30, 195, 25413 }, // Ӣ
-    { 21, 24, 23, 1, 24, 126, 25608 }, // ӣ
-    { 26, 31, 27, 1, 31, 202, 25734 }, // Ӥ
-    { 21, 25, 23, 1, 25, 132, 25936 }, // ӥ
-    { 24, 32, 26, 1, 31, 192, 26068 }, // Ӧ
-    { 18, 26, 20, 1, 25, 117, 26260 }, // ӧ
-    { 24, 25, 26, 1, 24, 150, 26377 }, // Ө
-    { 18, 19, 20, 1, 18, 86, 26527 }, // ө
-    { 24, 32, 27, 1, 31, 192, 26613 }, // Ӫ
-    { 18, 26, 20, 1, 25, 117, 26805 }, // ӫ
-    { 20, 32, 22, 1, 31, 160, 26922 }, // Ӭ
-    { 15, 26, 17, 1, 25, 98, 27082 }, // ӭ
-    { 24, 31, 24, 0, 30, 186, 27180 }, // Ӯ
-    { 20, 32, 20, 0, 24, 160, 27366 }, // ӯ
-    { 24, 32, 24, 0, 31, 192, 27526 }, // Ӱ
-    { 20, 33, 20, 0, 25, 165, 27718 }, // ӱ
-    { 24, 34, 24, 0, 33, 204, 27883 }, // Ӳ
-    { 20, 35, 20, 0, 27, 175, 28087 }, // ӳ
-    { 23, 31, 24, 0, 31, 179, 28262 }, // Ӵ
-    { 19, 25, 21, 0, 25, 119, 28441 }, // ӵ
-    { 17, 30, 19, 1, 23, 128, 28560 }, // Ӷ
-    { 15, 23, 16, 1, 17, 87, 28688 }, // ӷ
-    { 29, 32, 32, 1, 31, 232, 28775 }, // Ӹ
-    { 25, 26, 27, 1, 25, 163, 29007 }, // ӹ
-    { 18, 30, 19, 0, 23, 135, 29170 }, // Ӻ
-    { 15, 24, 16, 1, 17, 90, 29305 }, // ӻ
-    { 24, 30, 23, 0, 23, 180, 29395 }, // Ӽ
-    { 20, 25, 19, 0, 17, 125, 29575 }, // ӽ
-    { 24, 23, 24, 0, 23, 138, 29700 }, // Ӿ
-    { 20, 17, 20, 0, 17, 85, 29838 }, // ӿ
-    { 0, 0, 17, 0, 0, 0, 0 }, //  
-    { 0, 0, 33, 0, 0, 0, 0 }, //  
-    { 0, 0, 17, 0, 0, 0, 0 }, //  
-    { 0, 0, 33, 0, 0, 0, 0 }, //  
-    { 0, 0, 11, 0, 0, 0, 0 }, //  
-    { 0, 0, 8, 0, 0, 0, 0 }, //  
-    { 0, 0, 5, 0, 0, 0, 0 }, //  
-    { 0, 0, 21, 0, 0, 0, 0 }, //  
-    { 0, 0, 9, 0, 0, 0, 0 }, //  
-    { 0, 0, 7, 0, 0, 0, 0 }, //  
-    { 0, 0, 2, 0, 0, 0, 0 }, //  
-    { 0, 0, 0, 0, 0, 0, 0 }, // ​
-    { 2, 28, 0, -1, 20, 14, 0 }, // ‌
-    { 8, 30, 0, -4, 22, 60, 14 }, // ‍
-    { 12, 31, 0, -6, 23, 93, 74 }, // ‎
-    { 12, 31, 0, -6, 23, 93, 167 }, // ‏
-    { 11, 3, 12, 1, 10, 9, 260 }, // ‐
-    { 11, 3, 12, 1, 10, 9, 269 }, // ‑
-    { 16, 3, 21, 2, 13, 12, 278 }, // ‒
-    { 17, 3, 17, 0, 10, 13, 290 }, // –
-    { 33, 3, 33, 0, 10, 25, 303 }, // —
-    { 33, 3, 33, 0, 10, 25, 328 }, // ―
-    { 11, 34, 17, 3, 26, 94, 353 }, // ‖
-    { 17, 8, 17, 0, -1, 34, 447 }, // ‗
-    { 6, 11, 8, 1, 25, 17, 481 }, // ‘
-    { 6, 11, 8, 1, 25, 17, 498 }, // ’
-    { 6, 10, 8, 1, 4, 15, 515 }, // ‚
-    { 6, 11, 8, 1, 25, 17, 530 }, // ‛
-    { 13, 11, 14, 1, 25, 36, 547 }, // “
-    { 12, 11, 14, 1, 25, 33, 583 }, // ”
-    { 12, 10, 14, 1, 4, 30, 616 }, // „
-    { 13, 11, 14, 1, 25, 36, 646 }, // ‟
-    { 15, 22, 17, 1, 24, 83, 682 }, // †
-    { 15, 26, 17, 1, 24, 98, 765 }, // ‡
-    { 8, 7, 10, 1, 12, 14, 863 }, // •
-    { 12, 12, 21, 4, 17, 36, 877 }, // ‣
-    { 5, 5, 9, 2, 4, 7, 913 }, // ․
-    { 14, 5, 17, 1, 4, 18, 920 }, // ‥
-    { 27, 5, 33, 3, 4, 34, 938 }, // …
-    { 5, 6, 9, 2, 12, 8, 972 }, // ‧
-    { 0, 0, 0, 0, 0, 0, 980 }, //  
-    { 0, 0, 0, 0, 0, 0, 980 }, //  
-    { 12, 31, 0, -6, 23, 93, 980 }, // ‪
-    { 12, 31, 0, -6, 23, 93, 1073 }, // ‫
-    { 10, 31, 0, -5, 23, 78, 1166 }, // ‬
-    { 14, 31, 0, -7, 23, 109, 1244 }, // ‭
-    { 14, 31, 0, -7, 23, 109, 1353 }, // ‮
-    { 0, 0, 4, 0, 0, 0, 1462 }, //  
-    { 43, 26, 45, 1, 24, 280, 1462 }, // ‰
-    { 7, 11, 9, 1, 23, 20, 1742 }, // ′
-    { 13, 11, 15, 1, 23, 36, 1762 }, // ″
-    { 20, 11, 22, 1, 23, 55, 1798 }, // ‴
-    { 7, 11, 9, 1, 23, 20, 1853 }, // ‵
-    { 14, 11, 16, 1, 23, 39, 1873 }, // ‶
-    { 21, 11, 23, 1, 23, 58, 1912 }, // ‷
-    { 14, 7, 16, 1, 0, 25, 1970 }, // ‸
-    { 8, 13, 11, 1, 15, 26, 1995 }, // ‹
-    { 9, 13, 11, 1, 15, 30, 2021 }, // ›
-    { 21, 23, 21, 0, 22, 121, 2051 }, // ※
-    { 15, 26, 18, 2, 25, 98, 2172 }, // ‼
-    { 17, 3, 17, 0, 27, 13, 2270 }, // ‾
-    { 8, 3, 10, 1, 10, 6, 2283 }, // ⁃
-    { 16, 27, 6, -5, 24, 108, 2289 }, // ⁄
-    { 26, 25, 29, 2, 24, 163, 2397 }, // ⁇
-    { 21, 26, 25, 2, 25, 137, 2560 }, // ⁈
-    { 21, 26, 25, 2, 25, 137, 2697 }, // ⁉
-    { 19, 6, 33, 7, 13, 29, 2834 }, // ⁓
-    { 26, 11, 28, 1, 23, 72, 2863 }, // ⁗
-    { 0, 0, 7, 0, 0, 0, 2935 }, //  
-    { 0, 0, 0, 0, 0, 0, 2935 }, // ⁠
-    { 0, 0, 0, 0, 0, 0, 2935 }, // ⁡
-    { 0, 0, 0, 0, 0, 0, 2935 }, // ⁢
-    { 0, 0, 0, 0, 0, 0, 2935 }, // ⁣
-    { 0, 0, 0, 0, 0, 0, 2935 }, // ⁤
-    { 13, 17, 15, 1, 28, 56, 0 }, // ⁰
-    { 13, 17, 15, 1, 28, 56, 56 }, // ⁴
-    { 10, 16, 15, 2, 27, 40, 112 }, // ⁵
-    { 12, 17, 15, 2, 28, 51, 152 }, // ⁶
-    { 12, 16, 15, 2, 27, 48, 203 }, // ⁷
-    { 11, 17, 15, 2, 28, 47, 251 }, // ⁸
-    { 11, 17, 15, 2, 28, 47, 298 }, // ⁹
-    { 15, 11, 19, 2, 23, 42, 345 }, // ⁿ
-    { 13, 16, 15, 1, 11, 52, 387 }, // ₀
-    { 10, 16, 15, 2, 11, 40, 439 }, // ₁
-    { 12, 16, 15, 2, 11, 48, 479 }, // ₂
-    { 11, 16, 15, 2, 11, 44, 527 }, // ₃
-    { 13, 16, 15, 1, 11, 52, 571 }, // ₄
-    { 10, 16, 15, 2, 11, 40, 623 }, // ₅
-    { 12, 16, 15, 2, 11, 48, 663 }, // ₆
-    { 12, 16, 15, 2, 11, 48, 711 }, // ₇
-    { 11, 16, 15, 2, 11, 44, 759 }, // ₈
-    { 11, 16, 15, 2, 11, 44, 803 }, // ₉
-    { 18, 23, 21, 1, 23, 104, 0 }, // ₣
-    { 19, 24, 21, 1, 23, 114, 104 }, // ₤
-    { 39, 24, 41, 1, 23, 234, 218 }, // ₧
-    { 20, 24, 21, 0, 23, 120, 452 }, // €
-    { 19, 13, 33, 7, 18, 62, 0 }, // ←
-    { 13, 21, 33, 10, 22, 69, 62 }, // ↑
-    { 19, 13, 33, 7, 18, 62, 131 }, // →
-    { 13, 21, 33, 10, 22, 69, 193 }, // ↓
-    { 21, 13, 33, 6, 18, 69, 262 }, // ↔
-    { 13, 23, 33, 10, 23, 75, 331 }, // ↕
-    { 15, 22, 33, 9, 22, 83, 406 }, // ↨
-    { 13, 21, 33, 10, 22, 69, 489 }, // ↲
-    { 13, 21, 33, 10, 22, 69, 558 }, // ↳
-    { 19, 15, 33, 7, 19, 72, 627 }, // ↵
-    { 19, 15, 33, 7, 19, 72, 699 }, // ⇐
-    { 15, 19, 33, 9, 21, 72, 771 }, // ⇑
-    { 19, 15, 33, 7, 19, 72, 843 }, // ⇒
-    { 15, 19, 33, 9, 21, 72, 915 }, // ⇓
-    { 21, 15, 33, 6, 19, 79, 987 }, // ⇔
-    { 23, 24, 33, 5, 23, 138, 0 }, // ∀
-    { 17, 27, 21, 2, 26, 115, 138 }, // ∂
-    { 15, 23, 33, 9, 23, 87, 253 }, // ∃
-    { 25, 27, 33, 4, 25, 169, 340 }, // ∅
-    { 20, 24, 22, 1, 24, 120, 509 }, // ∆
-    { 21, 24, 33, 6, 23, 126, 629 }, // ∇
-    { 21, 23, 33, 6, 23, 121, 755 }, // ∈
-    { 21, 29, 33, 6, 26, 153, 876 }, // ∉
-    { 21, 19, 33, 6, 21, 100, 1029 }, // ∊
-    { 21, 23, 33, 6, 23, 121, 1129 }, // ∋
-    { 21, 29, 33, 6, 26, 153, 1250 }, // ∌
-    { 21, 19, 33, 6, 21, 100, 1403 }, // ∍
-    { 25, 29, 27, 1, 23, 182, 1503 }, // ∏
-    { 20, 29, 20, 0, 23, 145, 1685 }, // ∑
-    { 15, 3, 21, 3, 13, 12, 1830 }, // −
-    { 14, 26, 16, 1, 24, 91, 1842 }, // ∕
-    { 15, 26, 17, 2, 24, 98, 1933 }, // ∖
-    { 15, 16, 21, 3, 19, 60, 2031 }, // ∗
-    { 12, 12, 21, 4, 17, 36, 2091 }, // ∘
-    { 6, 6, 21, 7, 12, 9, 2127 }, // ∙
-    { 21, 31, 21, 0, 27, 163, 2136 }, // √
-    { 16, 13, 21, 2, 17, 52, 2299 }, // ∝
-    { 21, 11, 21, 0, 16, 58, 2351 }, // ∞
-    { 21, 23, 33, 6, 23, 121, 2409 }, // ∟
-    { 23, 23, 33, 4, 23, 133, 2530 }, // ∠
-    { 4, 34, 17, 6, 26, 34, 2663 }, // ∣
-    { 10, 34, 17, 3, 26, 85, 2697 }, // ∥
-    { 21, 23, 33, 6, 23, 121, 2782 }, // ∧
-    { 21, 23, 33, 6, 23, 121, 2903 }, // ∨
-    { 19, 24, 33, 7, 24, 114, 3024 }, // ∩
-    { 19, 24, 33, 7, 23, 114, 3138 }, // ∪
-    { 18, 34, 21, 1, 26, 153, 3252 }, // ∫
-    { 21, 19, 33, 6, 18, 100, 3405 }, // ∴
-    { 21, 19, 33, 6, 18, 100, 3505 }, // ∵
-    { 6, 18, 10, 2, 20, 27, 3605 }, // ∶
-    { 21, 19, 33, 6, 18, 100, 3632 }, // ∷
-    { 19, 6, 33, 7, 13, 29, 3732 }, // ∼
-    { 19, 18, 33, 7, 20, 86, 3761 }, // ≅
-    { 16, 12, 21, 2, 17, 48, 3847 }, // ≈
-    { 19, 11, 33, 7, 15, 53, 3895 }, // ≍
-    { 15, 15, 21, 3, 19, 57, 3948 }, // ≠
-    { 19, 15, 33, 7, 17, 72, 4005 }, // ≡
-    { 15, 20, 21, 3, 20, 75, 4077 }, // ≤
-    { 15, 20, 21, 3, 20, 75, 4152 }, // ≥
-    { 27, 16, 33, 3, 19, 108, 4227 }, // ≪
-    { 27, 16, 33, 3, 19, 108, 4335 }, // ≫
-    { 21, 19, 33, 6, 21, 100, 4443 }, // ⊃
-    { 21, 29, 33, 6, 26, 153, 4543 }, // ⊄
-    { 21, 29, 33, 6, 26, 153, 4696 }, // ⊅
-    { 21, 23, 33, 6, 23, 121, 4849 }, // ⊆
-    { 21, 23, 33, 6, 23, 121, 4970 }, // ⊇
-    { 25, 25, 33, 4, 24, 157, 5091 }, // ⊕
-    { 25, 25, 33, 4, 24, 157, 5248 }, // ⊖
-    { 25, 25, 33, 4, 24, 157, 5405 }, // ⊗
-    { 25, 25, 33, 4, 24, 157, 5562 }, // ⊘
-    { 19, 23, 33, 7, 23, 110, 5719 }, // ⊥
-    { 6, 6, 21, 7, 12, 9, 5829 }, // ⋅
-    { 27, 6, 33, 3, 12, 41, 5838 }, // ⋯
-    { 31, 32, 33, 1, 28, 248, 0 }, // �
+    { 17, 13, 17, 1, 15, 56, 9201 }, // «
+    { 15, 8, 21, 3, 15, 30, 825 }, // ¬
+    { 11, 3, 12, 1, 10, 9, 855 }, // ­
+    { 19, 18, 19, 0, 26, 86, 864 }, // ®
+    { 12, 4, 22, 5, 24, 12, 950 }, // ¯
+    { 12, 11, 17, 3, 23, 33, 962 }, // °
+    { 15, 20, 21, 3, 20, 75, 995 }, // ±
+    { 12, 16, 15, 2, 28, 48, 1070 }, // ²
+    { 11, 17, 15, 2, 28, 47, 1118 }, // ³
+    { 7, 8, 22, 8, 27, 14, 1165 }, // ´
+    { 21, 26, 22, 2, 18, 137, 1179 }, // µ
+    { 17, 28, 18, 0, 23, 119, 1316 }, // ¶
+    { 5, 6, 9, 2, 12, 8, 1435 }, // ·
+    { 6, 8, 22, 8, -1, 12, 1443 }, // ¸
+    { 10, 16, 15, 2, 28, 40, 1455 }, // ¹
+    { 12, 16, 15, 2, 24, 48, 1495 }, // º
+    { 17, 13, 17, 1, 15, 56, 9257 }, // »
+    { 32, 27, 36, 2, 24, 216, 1543 }, // ¼
+    { 32, 27, 36, 2, 24, 216, 1759 }, // ½
+    { 33, 27, 36, 2, 24, 223, 1975 }, // ¾
+    { 13, 25, 16, 1, 18, 82, 2198 }, // ¿
+    { 25, 32, 24, 0, 32, 200, 9313 }, // À
+    { 25, 32, 24, 0, 32, 200, 9513 }, // Á
+    { 25, 32, 24, 0, 32, 200, 9713 }, // Â
+    { 25, 31, 24, 0, 31, 194, 2280 }, // Ã
+    { 25, 31, 24, 0, 31, 194, 9913 }, // Ä
+    { 25, 33, 24, 0, 33, 207, 2474 }, // Å
+    { 31, 23, 31, -1, 23, 179, 2681 }, // Æ
+    { 19, 33, 21, 1, 24, 157, 10107 }, // Ç
+    { 19, 32, 21, 1, 32, 152, 10264 }, // È
+    { 19, 32, 21, 1, 32, 152, 10416 }, // É
+    { 19, 32, 21, 1, 32, 152, 10568 }, // Ê
+    { 19, 31, 21, 1, 31, 148, 10720 }, // Ë
+    { 11, 32, 12, 1, 32, 88, 10868 }, // Ì
+    { 11, 32, 12, 1, 32, 88, 10956 }, // Í
+    { 12, 32, 12, 0, 32, 96, 11044 }, // Î
+    { 12, 31, 12, 0, 31, 93, 11140 }, // Ï
+    { 24, 25, 25, 0, 24, 150, 2860 }, // Ð
+    { 26, 32, 27, 1, 31, 208, 11233 }, // Ñ
+    { 24, 33, 26, 1, 32, 198, 11441 }, // Ò
+    { 24, 33, 26, 1, 32, 198, 11639 }, // Ó
+    { 24, 33, 26, 1, 32, 198, 11837 }, // Ô
+    { 24, 32, 26, 1, 31, 192, 3010 }, // Õ
+    { 24, 32, 26, 1, 31, 192, 12035 }, // Ö
+    { 14, 14, 21, 3, 18, 49, 3202 }, // ×
+    { 25, 25, 26, 0, 24, 157, 3251 }, // Ø
+    { 25, 33, 26, 0, 32, 207, 12227 }, // Ù
+    { 25, 33, 26, 0, 32, 207, 12434 }, // Ú
+    { 25, 33, 26, 0, 32, 207, 12641 }, // Û
+    { 25, 32, 26, 0, 31, 200, 12848 }, // Ü
+    { 23, 32, 23, 0, 32, 184, 3408 }, // Ý
+    { 18, 23, 21, 1, 23, 104, 3592 }, // Þ
+    { 21, 27, 21, 0, 26, 142, 3696 }, // ß
+    { 18, 29, 18, 1, 28, 131, 13048 }, // à
+    { 18, 28, 18, 1, 27, 126, 13179 }, // á
+    { 18, 28, 18, 1, 27, 126, 13305 }, // â
+    { 18, 27, 18, 1, 26, 122, 3838 }, // ã
+    { 18, 26, 18, 1, 25, 117, 13431 }, // ä
+    { 18, 29, 18, 1, 28, 131, 3960 }, // å
+    { 25, 19, 27, 1, 18, 119, 4091 }, // æ
+    { 15, 27, 17, 1, 18, 102, 13548 }, // ç
+    { 15, 29, 17, 1, 28, 109, 13650 }, // è
+    { 15, 28, 17, 1, 27, 105, 13759 }, // é
+    { 15, 28, 17, 1, 27, 105, 13864 }, // ê
+    { 15, 26, 17, 1, 25, 98, 13969 }, // ë
+    { 11, 28, 11, 0, 28, 77, 14067 }, // ì
+    { 11, 27, 11, 0, 27, 75, 14144 }, // í
+    { 11, 27, 11, 0, 27, 75, 14219 }, // î
+    { 12, 25, 11, -1, 25, 75, 14294 }, // ï
+    { 18, 28, 20, 1, 27, 126, 4210 }, // ð
+    { 22, 26, 22, 0, 26, 143, 14369 }, // ñ
+    { 18, 29, 20, 1, 28, 131, 14512 }, // ò
+    { 18, 28, 20, 1, 27, 126, 14643 }, // ó
+    { 18, 28, 20, 1, 27, 126, 14769 }, // ô
+    { 18, 27, 20, 1, 26, 122, 4336 }, // õ
+    { 18, 26, 20, 1, 25, 117, 14895 }, // ö
+    { 15, 16, 21, 3, 19, 60, 4458 }, // ÷
+    { 19, 19, 20, 0, 18, 91, 4518 }, // ø
+    { 22, 29, 21, 0, 28, 160, 15012 }, // ù
+    { 22, 28, 21, 0, 27, 154, 15172 }, // ú
+    { 22, 28, 21, 0, 27, 154, 15326 }, // û
+    { 22, 26, 21, 0, 25, 143, 15480 }, // ü
+    { 20, 35, 20, 0, 27, 175, 4609 }, // ý
+    { 20, 34, 21, 0, 26, 170, 4784 }, // þ
+    { 20, 33, 20, 0, 25, 165, 4954 }, // ÿ
+    { 25, 30, 24, 0, 30, 188, 5119 }, // Ā
+    { 18, 25, 18, 1, 24, 113, 5307 }, // ā
+    { 25, 32, 24, 0, 32, 200, 5420 }, // Ă
+    { 18, 27, 18, 1, 26, 122, 5620 }, // ă
+    { 25, 31, 24, 0, 24, 194, 5742 }, // Ą
+    { 18, 25, 18, 1, 18, 113, 5936 }, // ą
+    { 19, 33, 21, 1, 32, 157, 6049 }, // Ć
+    { 15, 28, 17, 1, 27, 105, 6206 }, // ć
+    { 19, 33, 21, 1, 32, 157, 6311 }, // Ĉ
+    { 15, 28, 17, 1, 27, 105, 6468 }, // ĉ
+    { 19, 32, 21, 1, 31, 152, 6573 }, // Ċ
+    { 15, 26, 17, 1, 25, 98, 6725 }, // ċ
+    { 19, 33, 21, 1, 32, 157, 6823 }, // Č
+    { 15, 28, 17, 1, 27, 105, 6980 }, // č
+    { 23, 33, 25, 1, 32, 190, 7085 }, // Ď
+    { 23, 27, 21, 1, 26, 156, 7275 }, // ď
+    { 24, 25, 25, 0, 24, 150, 7431 }, // Đ
+    { 20, 27, 21, 1, 26, 135, 7581 }, // đ
+    { 19, 30, 21, 1, 30, 143, 7716 }, // Ē
+    { 15, 25, 17, 1, 24, 94, 7859 }, // ē
+    { 19, 32, 21, 1, 32, 152, 7953 }, // Ĕ
+    { 15, 27, 17, 1, 26, 102, 8105 }, // ĕ
+    { 19, 31, 21, 1, 31, 148, 8207 }, // Ė
+    { 15, 26, 17, 1, 25, 98, 8355 }, // ė
+    { 19, 30, 21, 1, 23, 143, 8453 }, // Ę
+    { 15, 25, 17, 1, 18, 94, 8596 }, // ę
+    { 19, 32, 21, 1, 32, 152, 8690 }, // Ě
+    { 15, 28, 17, 1, 27, 105, 8842 }, // ě
+    { 22, 33, 24, 1, 32, 182, 8947 }, // Ĝ
+    { 19, 35, 19, 0, 27, 167, 9129 }, // ĝ
+    { 22, 33, 24, 1, 32, 182, 9296 }, // Ğ
+    { 19, 34, 19, 0, 26, 162, 9478 }, // ğ
+    { 22, 32, 24, 1, 31, 176, 9640 }, // Ġ
+    { 19, 33, 19, 0, 25, 157, 9816 }, // ġ
+    { 22, 33, 24, 1, 24, 182, 9973 }, // Ģ
+    { 19, 36, 19, 0, 28, 171, 10155 }, // ģ
+    { 26, 32, 28, 1, 32, 208, 10326 }, // Ĥ
+    { 23, 34, 22, -1, 34, 196, 10534 }, // ĥ
+    { 27, 23, 28, 0, 23, 156, 10730 }, // Ħ
+    { 22, 26, 22, 0, 26, 143, 10886 }, // ħ
+    { 12, 31, 12, 0, 31, 93, 11029 }, // Ĩ
+    { 11, 26, 11, 0, 26, 72, 11122 }, // ĩ
+    { 12, 30, 12, 0, 30, 90, 11194 }, // Ī
+    { 11, 24, 11, 0, 24, 66, 11284 }, // ī
+    { 12, 32, 12, 0, 32, 96, 11350 }, // Ĭ
+    { 11, 26, 11, 0, 26, 72, 11446 }, // ĭ
+    { 11, 30, 12, 1, 23, 83, 11518 }, // Į
+    { 11, 33, 11, 0, 26, 91, 11601 }, // į
+    { 11, 31, 12, 1, 31, 86, 11692 }, // İ
+    { 11, 18, 11, 0, 18, 50, 11778 }, // ı
+    { 22, 30, 24, 1, 23, 165, 11828 }, // Ĳ
+    { 18, 34, 20, 0, 26, 153, 11993 }, // ĳ
+    { 14, 39, 12, -2, 32, 137, 12146 }, // Ĵ
+    { 13, 35, 9, -2, 27, 114, 12283 }, // ĵ
+    { 23, 32, 24, 1, 23, 184, 12397 }, // Ķ
+    { 20, 35, 20, 0, 26, 175, 12581 }, // ķ
+    { 21, 19, 20, 0, 18, 100, 12756 }, // ĸ
+    { 19, 32, 20, 1, 32, 152, 12856 }, // Ĺ
+    { 11, 34, 11, 0, 34, 94, 13008 }, // ĺ
+    { 19, 32, 20, 1, 23, 152, 13102 }, // Ļ
+    { 11, 35, 11, 0, 26, 97, 13254 }, // ļ
+    { 19, 26, 20, 1, 26, 124, 13351 }, // Ľ
+    { 14, 26, 11, 0, 26, 91, 13475 }, // ľ
+    { 19, 23, 20, 1, 23, 110, 13566 }, // Ŀ
+    { 16, 26, 15, 0, 26, 104, 13676 }, // ŀ
+    { 21, 23, 20, -1, 23, 121, 13780 }, // Ł
+    { 13, 26, 11, -1, 26, 85, 13901 }, // ł
+    { 26, 33, 27, 1, 32, 215, 13986 }, // Ń
+    { 22, 27, 22, 0, 27, 149, 14201 }, // ń
+    { 26, 32, 27, 1, 23, 208, 14350 }, // Ņ
+    { 22, 27, 22, 0, 18, 149, 14558 }, // ņ
+    { 26, 33, 27, 1, 32, 215, 14707 }, // Ň
+    { 22, 27, 22, 0, 27, 149, 14922 }, // ň
+    { 29, 25, 30, 1, 25, 182, 15071 }, // ŉ
+    { 26, 30, 27, 1, 23, 195, 15253 }, // Ŋ
+    { 19, 26, 21, 0, 18, 124, 15448 }, // ŋ
+    { 24, 31, 26, 1, 30, 186, 15572 }, // Ō
+    { 18, 25, 20, 1, 24, 113, 15758 }, // ō
+    { 24, 33, 26, 1, 32, 198, 15871 }, // Ŏ
+    { 18, 27, 20, 1, 26, 122, 16069 }, // ŏ
+    { 24, 34, 26, 1, 33, 204, 16191 }, // Ő
+    { 18, 28, 20, 1, 27, 126, 16395 }, // ő
+    { 30, 24, 32, 1, 23, 180, 15623 }, // Œ
+    { 28, 19, 30, 1, 18, 133, 15803 }, // œ
+    { 22, 33, 22, 1, 32, 182, 16521 }, // Ŕ
+    { 15, 27, 15, 0, 27, 102, 16703 }, // ŕ
+    { 22, 33, 22, 1, 24, 182, 16805 }, // Ŗ
+    { 15, 27, 15, 0, 18, 102, 16987 }, // ŗ
+    { 22, 33, 22, 1, 32, 182, 17089 }, // Ř
+    { 15, 27, 15, 0, 27, 102, 17271 }, // ř
+    { 16, 33, 18, 1, 32, 132, 17373 }, // Ś
+    { 14, 28, 16, 1, 27, 98, 17505 }, // ś
+    { 16, 33, 18, 1, 32, 132, 17603 }, // Ŝ
+    { 14, 28, 16, 1, 27, 98, 17735 }, // ŝ
+    { 16, 33, 18, 1, 24, 132, 17833 }, // Ş
+    { 14, 27, 16, 1, 18, 95, 17965 }, // ş
+    { 16, 33, 18, 1, 32, 132, 18060 }, // Š
+    { 14, 28, 16, 1, 27, 98, 18192 }, // š
+    { 21, 32, 23, 1, 23, 168, 18290 }, // Ţ
+    { 13, 31, 14, 0, 22, 101, 18458 }, // ţ
+    { 21, 32, 23, 1, 32, 168, 18559 }, // Ť
+    { 13, 28, 14, 0, 27, 91, 18727 }, // ť
+    { 21, 23, 23, 1, 23, 121, 18818 }, // Ŧ
+    { 13, 23, 14, 0, 22, 75, 18939 }, // ŧ
+    { 25, 32, 26, 0, 31, 200, 19014 }, // Ũ
+    { 22, 27, 21, 0, 26, 149, 19214 }, // ũ
+    { 25, 31, 26, 0, 30, 194, 19363 }, // Ū
+    { 22, 25, 21, 0, 24, 138, 19557 }, // ū
+    { 25, 33, 26, 0, 32, 207, 19695 }, // Ŭ
+    { 22, 27, 21, 0, 26, 149, 19902 }, // ŭ
+    { 25, 34, 26, 0, 33, 213, 20051 }, // Ů
+    { 22, 29, 21, 0, 28, 160, 20264 }, // ů
+    { 25, 34, 26, 0, 33, 213, 20424 }, // Ű
+    { 22, 28, 21, 0, 27, 154, 20637 }, // ű
+    { 25, 30, 26, 0, 23, 188, 20791 }, // Ų
+    { 22, 25, 21, 0, 18, 138, 20979 }, // ų
+    { 36, 33, 37, 0, 32, 297, 21117 }, // Ŵ
+    { 29, 28, 29, 0, 27, 203, 21414 }, // ŵ
+    { 23, 32, 23, 0, 32, 184, 21617 }, // Ŷ
+    { 20, 35, 20, 0, 27, 175, 21801 }, // ŷ
+    { 23, 31, 23, 0, 31, 179, 21976 }, // Ÿ
+    { 18, 33, 20, 1, 32, 149, 22155 }, // Ź
+    { 15, 28, 17, 1, 27, 105, 22304 }, // ź
+    { 18, 32, 20, 1, 31, 144, 22409 }, // Ż
+    { 15, 26, 17, 1, 25, 98, 22553 }, // ż
+    { 18, 33, 20, 1, 32, 149, 22651 }, // Ž
+    { 15, 28, 17, 1, 27, 105, 22800 }, // ž
+    { 16, 26, 13, 0, 26, 104, 22905 }, // ſ
+    { 7, 9, 0, -5, 28, 16, 23009 }, // ̀
+    { 7, 8, 0, -2, 27, 14, 23025 }, // ́
+    { 12, 8, 0, -6, 27, 24, 23039 }, // ̂
+    { 12, 6, 0, -6, 26, 18, 23063 }, // ̃
+    { 12, 4, 0, -6, 24, 12, 23081 }, // ̄
+    { 12, 6, 0, -6, 26, 18, 23093 }, // ̆
+    { 6, 5, 0, -3, 25, 8, 23111 }, // ̇
+    { 12, 5, 0, -6, 25, 15, 23119 }, // ̈
+    { 10, 10, 0, -5, 29, 25, 23134 }, // ̉
+    { 10, 10, 0, -5, 28, 25, 23159 }, // ̊
+    { 12, 8, 0, -5, 27, 24, 23184 }, // ̋
+    { 12, 8, 0, -6, 27, 24, 23208 }, // ̌
+    { 12, 8, 0, -7, 27, 24, 23232 }, // ̏
+    { 12, 6, 0, -6, 26, 18, 23256 }, // ̑
+    { 6, 9, 0, -3, 28, 14, 23274 }, // ̒
+    { 6, 10, 0, -2, 29, 15, 23288 }, // ̓
+    { 6, 10, 0, -4, 29, 15, 23303 }, // ̔
+    { 4, 9, 0, -2, 29, 9, 23318 }, // ̕
+    { 6, 8, 0, -3, 21, 12, 23327 }, // ̛
+    { 6, 6, 0, -3, -2, 9, 23339 }, // ̣
+    { 12, 5, 0, -6, -3, 15, 23348 }, // ̤
+    { 8, 8, 0, -4, -1, 16, 23363 }, // ̥
+    { 6, 8, 0, -3, -1, 12, 23379 }, // ̦
+    { 6, 8, 0, -3, -1, 12, 23391 }, // ̧
+    { 8, 8, 0, -4, 1, 16, 23403 }, // ̨
+    { 3, 8, 9, 3, -1, 6, 23419 }, // ̩
+    { 12, 7, 0, -6, -2, 21, 23425 }, // ̭
+    { 12, 6, 0, -6, -2, 18, 23446 }, // ̮
+    { 12, 6, 0, -6, -2, 18, 23464 }, // ̰
+    { 12, 4, 0, -6, -3, 12, 23482 }, // ̱
+    { 12, 6, 0, -6, 26, 18, 23494 }, // ͂
+    { 12, 13, 0, -6, 33, 39, 23512 }, // ̈́
+    { 6, 6, 0, -2, -2, 9, 23551 }, // ͅ
+    { 19, 32, 21, 1, 32, 152, 23560 }, // Ѐ
+    { 19, 31, 21, 1, 31, 148, 0 }, // Ё
+    { 25, 30, 27, 1, 23, 188, 23712 }, // Ђ
+    { 17, 32, 19, 1, 32, 136, 23900 }, // Ѓ
+    { 20, 25, 22, 1, 24, 125, 24036 }, // Є
+    { 16, 25, 18, 1, 24, 100, 24161 }, // Ѕ
+    { 11, 23, 12, 1, 23, 64, 24261 }, // І
+    { 12, 31, 12, 0, 31, 93, 24325 }, // Ї
+    { 14, 30, 12, -2, 23, 105, 24418 }, // Ј
+    { 31, 24, 32, 0, 23, 186, 24523 }, // Љ
+    { 32, 24, 34, 1, 23, 192, 24709 }, // Њ
+    { 27, 23, 28, 1, 23, 156, 24901 }, // Ћ
+    { 23, 33, 24, 1, 32, 190, 25057 }, // Ќ
+    { 26, 32, 27, 1, 32, 208, 25247 }, // Ѝ
+    { 24, 32, 24, 0, 31, 192, 25455 }, // Ў
+    { 25, 31, 26, 1, 23, 194, 25647 }, // Џ
+    { 25, 24, 24, 0, 24, 150, 148 }, // А
+    { 19, 24, 21, 1, 23, 114, 298 }, // Б
+    { 19, 25, 20, 1, 24, 119, 412 }, // В
+    { 17, 23, 19, 1, 23, 98, 531 }, // Г
+    { 24, 30, 25, 0, 23, 180, 629 }, // Д
+    { 19, 23, 21, 1, 23, 110, 809 }, // Е
+    { 33, 25, 33, 0, 24, 207, 919 }, // Ж
+    { 17, 25, 19, 1, 24, 107, 1126 }, // З
+    { 26, 23, 27, 1, 23, 150, 1233 }, // И
+    { 26, 31, 27, 1, 31, 202, 1383 }, // Й
+    { 23, 25, 24, 1, 24, 144, 1585 }, // К
+    { 24, 24, 24, 0, 23, 144, 1729 }, // Л
+    { 30, 23, 30, 0, 23, 173, 1873 }, // М
+    { 26, 23, 28, 1, 23, 150, 2046 }, // Н
+    { 24, 25, 26, 1, 24, 150, 2196 }, // О
+    { 25, 23, 27, 1, 23, 144, 2346 }, // П
+    { 18, 24, 20, 1, 24, 108, 2490 }, // Р
+    { 19, 25, 21, 1, 24, 119, 2598 }, // С
+    { 21, 23, 23, 1, 23, 121, 2717 }, // Т
+    { 24, 24, 24, 0, 23, 144, 2838 }, // У
+    { 24, 25, 26, 1, 24, 150, 2982 }, // Ф
+    { 24, 23, 24, 0, 23, 138, 3132 }, // Х
+    { 25, 30, 26, 1, 23, 188, 3270 }, // Ц
+    { 23, 23, 24, 0, 23, 133, 3458 }, // Ч
+    { 33, 23, 35, 1, 23, 190, 3591 }, // Ш
+    { 34, 30, 35, 1, 23, 255, 3781 }, // Щ
+    { 24, 24, 25, 1, 23, 144, 4036 }, // Ъ
+    { 29, 24, 31, 1, 23, 174, 4180 }, // Ы
+    { 19, 24, 21, 1, 23, 114, 4354 }, // Ь
+    { 20, 25, 22, 1, 24, 125, 4468 }, // Э
+    { 33, 25, 35, 1, 24, 207, 4593 }, // Ю
+    { 22, 24, 22, -1, 23, 132, 4800 }, // Я
+    { 18, 19, 18, 1, 18, 86, 4932 }, // а
+    { 17, 27, 19, 1, 26, 115, 5018 }, // б
+    { 16, 19, 18, 1, 18, 76, 5133 }, // в
+    { 15, 17, 16, 1, 17, 64, 5209 }, // г
+    { 21, 23, 21, 0, 17, 121, 5273 }, // д
+    { 15, 19, 17, 1, 18, 72, 5394 }, // е
+    { 27, 19, 27, 0, 18, 129, 5466 }, // ж
+    { 14, 19, 16, 1, 18, 67, 5595 }, // з
+    { 21, 17, 23, 1, 17, 90, 5662 }, // и
+    { 21, 25, 23, 1, 25, 132, 5752 }, // й
+    { 19, 19, 19, 1, 18, 91, 5884 }, // к
+    { 20, 18, 20, 0, 17, 90, 5975 }, // л
+    { 24, 17, 26, 1, 17, 102, 6065 }, // м
+    { 21, 17, 23, 1, 17, 90, 6167 }, // н
+    { 18, 19, 20, 1, 18, 86, 6257 }, // о
+    { 21, 17, 23, 1, 17, 90, 6343 }, // п
+    { 19, 26, 20, 0, 18, 124, 6433 }, // р
+    { 15, 19, 17, 1, 18, 72, 6557 }, // с
+    { 17, 17, 19, 1, 17, 73, 6629 }, // т
+    { 20, 25, 20, 0, 17, 125, 6702 }, // у
+    { 23, 34, 24, 1, 26, 196, 6827 }, // ф
+    { 20, 17, 20, 0, 17, 85, 7023 }, // х
+    { 21, 23, 23, 1, 17, 121, 7108 }, // ц
+    { 19, 17, 20, 0, 17, 81, 7229 }, // ч
+    { 27, 17, 29, 1, 17, 115, 7310 }, // ш
+    { 28, 23, 29, 1, 17, 161, 7425 }, // щ
+    { 19, 18, 21, 1, 17, 86, 7586 }, // ъ
+    { 25, 18, 27, 1, 17, 113, 7672 }, // ы
+    { 16, 18, 18, 1, 17, 72, 7785 }, // ь
+    { 15, 19, 17, 1, 18, 72, 7857 }, // э
+    { 26, 19, 28, 1, 18, 124, 7929 }, // ю
+    { 18, 18, 19, 0, 17, 81, 8053 }, // я
+    { 15, 29, 17, 1, 28, 109, 25841 }, // ѐ
+    { 15, 26, 17, 1, 25, 98, 8134 }, // ё
+    { 19, 34, 21, 0, 26, 162, 25950 }, // ђ
+    { 15, 27, 16, 1, 27, 102, 26112 }, // ѓ
+    { 15, 19, 17, 1, 18, 72, 26214 }, // є
+    { 14, 19, 16, 1, 18, 67, 26286 }, // ѕ
+    { 11, 26, 11, 0, 26, 72, 26353 }, // і
+    { 12, 25, 11, -1, 25, 75, 26425 }, // ї
+    { 10, 34, 9, -2, 26, 85, 26500 }, // ј
+    { 26, 18, 26, 0, 17, 117, 26585 }, // љ
+    { 26, 18, 28, 1, 17, 117, 26702 }, // њ
+    { 22, 26, 22, 0, 26, 143, 26819 }, // ћ
+    { 19, 28, 19, 1, 27, 133, 26962 }, // ќ
+    { 21, 28, 23, 1, 28, 147, 27095 }, // ѝ
+    { 20, 33, 20, 0, 25, 165, 27242 }, // ў
+    { 21, 24, 22, 1, 17, 126, 27407 }, // џ
+    { 23, 27, 24, 0, 26, 156, 27533 }, // Ѣ
+    { 19, 25, 20, 1, 24, 119, 27689 }, // ѣ
+    { 24, 25, 26, 1, 24, 150, 27808 }, // Ѳ
+    { 18, 19, 20, 1, 18, 86, 27958 }, // ѳ
+    { 25, 25, 25, 0, 24, 157, 28044 }, // Ѵ
+    { 21, 19, 20, 0, 18, 100, 28201 }, // ѵ
+    { 26, 38, 27, 1, 31, 247, 28301 }, // Ҋ
+    { 21, 31, 23, 1, 25, 163, 28548 }, // ҋ
+    { 20, 24, 21, 0, 23, 120, 28711 }, // Ҍ
+    { 17, 25, 17, 0, 24, 107, 28831 }, // ҍ
+    { 18, 24, 20, 1, 24, 108, 28938 }, // Ҏ
+    { 19, 26, 20, 0, 18, 124, 29046 }, // ҏ
+    { 17, 28, 19, 1, 28, 119, 29170 }, // Ґ
+    { 14, 21, 16, 1, 21, 74, 29289 }, // ґ
+    { 18, 23, 19, 0, 23, 104, 29363 }, // Ғ
+    { 15, 17, 16, 1, 17, 64, 29467 }, // ғ
+    { 20, 30, 22, 1, 23, 150, 29531 }, // Ҕ
+    { 18, 25, 20, 1, 17, 113, 29681 }, // ҕ
+    { 33, 31, 33, 0, 24, 256, 0 }, // Җ
+    { 27, 24, 27, 0, 18, 162, 256 }, // җ
+    { 17, 31, 19, 1, 24, 132, 418 }, // Ҙ
+    { 14, 25, 16, 1, 18, 88, 550 }, // ҙ
+    { 23, 31, 24, 1, 24, 179, 638 }, // Қ
+    { 19, 24, 19, 1, 18, 114, 817 }, // қ
+    { 24, 25, 25, 1, 24, 150, 931 }, // Ҝ
+    { 19, 19, 20, 1, 18, 91, 1081 }, // ҝ
+    { 23, 25, 24, 1, 24, 144, 1172 }, // Ҟ
+    { 19, 25, 19, 0, 24, 119, 1316 }, // ҟ
+    { 27, 25, 28, 1, 24, 169, 1435 }, // Ҡ
+    { 21, 19, 22, 1, 18, 100, 1604 }, // ҡ
+    { 26, 30, 28, 1, 23, 195, 1704 }, // Ң
+    { 22, 23, 23, 1, 17, 127, 1899 }, // ң
+    { 30, 23, 32, 1, 23, 173, 2026 }, // Ҥ
+    { 24, 17, 26, 1, 17, 102, 2199 }, // ҥ
+    { 33, 30, 35, 1, 23, 248, 2301 }, // Ҧ
+    { 30, 25, 32, 1, 17, 188, 2549 }, // ҧ
+    { 26, 25, 27, 1, 24, 163, 2737 }, // Ҩ
+    { 20, 19, 21, 1, 18, 95, 2900 }, // ҩ
+    { 19, 31, 21, 1, 24, 148, 2995 }, // Ҫ
+    { 15, 25, 17, 1, 18, 94, 3143 }, // ҫ
+    { 21, 30, 23, 1, 23, 158, 3237 }, // Ҭ
+    { 17, 23, 18, 1, 17, 98, 3395 }, // ҭ
+    { 23, 23, 23, 0, 23, 133, 3493 }, // Ү
+    { 20, 25, 20, 0, 17, 125, 3626 }, // ү
+    { 23, 23, 23, 0, 23, 133, 3751 }, // Ұ
+    { 20, 25, 20, 0, 17, 125, 3884 }, // ұ
+    { 24, 30, 24, 0, 23, 180, 4009 }, // Ҳ
+    { 20, 23, 20, 0, 17, 115, 4189 }, // ҳ
+    { 29, 30, 30, 1, 23, 218, 4304 }, // Ҵ
+    { 25, 23, 26, 1, 17, 144, 4522 }, // ҵ
+    { 23, 30, 24, 0, 23, 173, 4666 }, // Ҷ
+    { 20, 23, 20, 0, 17, 115, 4839 }, // ҷ
+    { 23, 23, 24, 0, 23, 133, 4954 }, // Ҹ
+    { 19, 17, 20, 0, 17, 81, 5087 }, // ҹ
+    { 22, 23, 24, 1, 23, 127, 5168 }, // Һ
+    { 22, 26, 22, 0, 26, 143, 5295 }, // һ
+    { 26, 25, 27, 0, 24, 163, 5438 }, // Ҽ
+    { 20, 19, 21, 0, 18, 95, 5601 }, // ҽ
+    { 26, 31, 27, 0, 24, 202, 5696 }, // Ҿ
+    { 20, 25, 21, 0, 18, 125, 5898 }, // ҿ
+    { 11, 23, 12, 1, 23, 64, 6023 }, // Ӏ
+    { 33, 32, 33, 0, 31, 264, 6087 }, // Ӂ
+    { 27, 26, 27, 0, 25, 176, 6351 }, // ӂ
+    { 21, 31, 23, 1, 24, 163, 6527 }, // Ӄ
+    { 17, 26, 20, 1, 18, 111, 6690 }, // ӄ
+    { 24, 30, 24, 0, 23, 180, 6801 }, // Ӆ
+    { 20, 23, 20, 0, 17, 115, 6981 }, // ӆ
+    { 26, 30, 27, 1, 23, 195, 7096 }, // Ӈ
+    { 21, 25, 23, 1, 17, 132, 7291 }, // ӈ
+    { 26, 30, 28, 1, 23, 195, 7423 }, // Ӊ
+    { 21, 23, 23, 1, 17, 121, 7618 }, // ӊ
+    { 23, 30, 24, 0, 23, 173, 7739 }, // Ӌ
+    { 19, 23, 20, 0, 17, 110, 7912 }, // ӌ
+    { 30, 30, 30, 0, 23, 225, 8022 }, // Ӎ
+    { 24, 23, 26, 1, 17, 138, 8247 }, // ӎ
+    { 11, 26, 11, 0, 26, 72, 8385 }, // ӏ
+    { 25, 31, 24, 0, 31, 194, 8457 }, // Ӑ
+    { 18, 26, 18, 1, 25, 117, 8651 }, // ӑ
+    { 25, 31, 24, 0, 31, 194, 8768 }, // Ӓ
+    { 18, 26, 18, 1, 25, 117, 8962 }, // ӓ
+    { 31, 23, 31, -1, 23, 179, 9079 }, // Ӕ
+    { 25, 19, 27, 1, 18, 119, 9258 }, // ӕ
+    { 19, 31, 21, 1, 31, 148, 9377 }, // Ӗ
+    { 15, 26, 17, 1, 25, 98, 9525 }, // ӗ
+    { 20, 25, 23, 1, 24, 125, 9623 }, // Ә
+    { 15, 19, 17, 1, 18, 72, 9748 }, // ә
+    { 20, 32, 23, 1, 31, 160, 9820 }, // Ӛ
+    { 15, 26, 17, 1, 25, 98, 9980 }, // ӛ
+    { 33, 32, 33, 0, 31, 264, 10078 }, // Ӝ
+    { 27, 26, 27, 0, 25, 176, 10342 }, // ӝ
+    { 17, 32, 19, 1, 31, 136, 10518 }, // Ӟ
+    { 14, 26, 16, 1, 25, 91, 10654 }, // ӟ
+    { 17, 24, 19, 1, 23, 102, 10745 }, // Ӡ
+    { 16, 25, 17, 0, 17, 100, 10847 }, // ӡ
+    { 26, 30, 27, 1, 30, 195, 10947 }, // Ӣ
+    { 21, 24, 23, 1, 24, 126, 11142 }, // ӣ
+    { 26, 31, 27, 1, 31, 202, 11268 }, // Ӥ
+    { 21, 25, 23, 1, 25, 132, 11470 }, // ӥ
+    { 24, 32, 26, 1, 31, 192, 11602 }, // Ӧ
+    { 18, 26, 20, 1, 25, 117, 11794 }, // ӧ
+    { 24, 25, 26, 1, 24, 150, 11911 }, // Ө
+    { 18, 19, 20, 1, 18, 86, 12061 }, // ө
+    { 24, 32, 27, 1, 31, 192, 12147 }, // Ӫ
+    { 18, 26, 20, 1, 25, 117, 12339 }, // ӫ
+    { 20, 32, 22, 1, 31, 160, 12456 }, // Ӭ
+    { 15, 26, 17, 1, 25, 98, 12616 }, // ӭ
+    { 24, 31, 24, 0, 30, 186, 12714 }, // Ӯ
+    { 20, 32, 20, 0, 24, 160, 12900 }, // ӯ
+    { 24, 32, 24, 0, 31, 192, 13060 }, // Ӱ
+    { 20, 33, 20, 0, 25, 165, 13252 }, // ӱ
+    { 24, 34, 24, 0, 33, 204, 13417 }, // Ӳ
+    { 20, 35, 20, 0, 27, 175, 13621 }, // ӳ
+    { 23, 31, 24, 0, 31, 179, 13796 }, // Ӵ
+    { 19, 25, 21, 0, 25, 119, 13975 }, // ӵ
+    { 17, 30, 19, 1, 23, 128, 14094 }, // Ӷ
+    { 15, 23, 16, 1, 17, 87, 14222 }, // ӷ
+    { 29, 32, 32, 1, 31, 232, 14309 }, // Ӹ
+    { 25, 26, 27, 1, 25, 163, 14541 }, // ӹ
+    { 18, 30, 19, 0, 23, 135, 14704 }, // Ӻ
+    { 15, 24, 16, 1, 17, 90, 14839 }, // ӻ
+    { 24, 30, 23, 0, 23, 180, 14929 }, // Ӽ
+    { 20, 25, 19, 0, 17, 125, 15109 }, // ӽ
+    { 24, 23, 24, 0, 23, 138, 15234 }, // Ӿ
+    { 20, 17, 20, 0, 17, 85, 15372 }, // ӿ
+    { 0, 0, 17, 0, 0, 0, 15457 }, //  
+    { 0, 0, 33, 0, 0, 0, 15457 }, //  
+    { 0, 0, 17, 0, 0, 0, 15457 }, //  
+    { 0, 0, 33, 0, 0, 0, 15457 }, //  
+    { 0, 0, 11, 0, 0, 0, 15457 }, //  
+    { 0, 0, 8, 0, 0, 0, 15457 }, //  
+    { 0, 0, 5, 0, 0, 0, 15457 }, //  
+    { 0, 0, 21, 0, 0, 0, 15457 }, //  
+    { 0, 0, 9, 0, 0, 0, 15457 }, //  
+    { 0, 0, 7, 0, 0, 0, 15457 }, //  
+    { 0, 0, 2, 0, 0, 0, 15457 }, //  
+    { 0, 0, 0, 0, 0, 0, 15457 }, // ​
+    { 2, 28, 0, -1, 20, 14, 15457 }, // ‌
+    { 8, 30, 0, -4, 22, 60, 15471 }, // ‍
+    { 12, 31, 0, -6, 23, 93, 15531 }, // ‎
+    { 12, 31, 0, -6, 23, 93, 15624 }, // ‏
+    { 11, 3, 12, 1, 10, 9, 15717 }, // ‐
+    { 11, 3, 12, 1, 10, 9, 15726 }, // ‑
+    { 16, 3, 21, 2, 13, 12, 15735 }, // ‒
+    { 17, 3, 17, 0, 10, 13, 15936 }, // –
+    { 33, 3, 33, 0, 10, 25, 15949 }, // —
+    { 33, 3, 33, 0, 10, 25, 15747 }, // ―
+    { 11, 34, 17, 3, 26, 94, 15772 }, // ‖
+    { 17, 8, 17, 0, -1, 34, 15866 }, // ‗
+    { 6, 11, 8, 1, 25, 17, 15974 }, // ‘
+    { 6, 11, 8, 1, 25, 17, 15991 }, // ’
+    { 6, 10, 8, 1, 4, 15, 15900 }, // ‚
+    { 6, 11, 8, 1, 25, 17, 15915 }, // ‛
+    { 13, 11, 14, 1, 25, 36, 16008 }, // “
+    { 12, 11, 14, 1, 25, 33, 16044 }, // ”
+    { 12, 10, 14, 1, 4, 30, 15932 }, // „
+    { 13, 11, 14, 1, 25, 36, 15962 }, // ‟
+    { 15, 22, 17, 1, 24, 83, 15998 }, // †
+    { 15, 26, 17, 1, 24, 98, 16081 }, // ‡
+    { 8, 7, 10, 1, 12, 14, 16179 }, // •
+    { 12, 12, 21, 4, 17, 36, 16193 }, // ‣
+    { 5, 5, 9, 2, 4, 7, 16229 }, // ․
+    { 14, 5, 17, 1, 4, 18, 16236 }, // ‥
+    { 27, 5, 33, 3, 4, 34, 16077 }, // …
+    { 5, 6, 9, 2, 12, 8, 16254 }, // ‧
+    { 0, 0, 0, 0, 0, 0, 16262 }, //  
+    { 0, 0, 0, 0, 0, 0, 16262 }, //  
+    { 12, 31, 0, -6, 23, 93, 16262 }, // ‪
+    { 12, 31, 0, -6, 23, 93, 16355 }, // ‫
+    { 10, 31, 0, -5, 23, 78, 16448 }, // ‬
+    { 14, 31, 0, -7, 23, 109, 16526 }, // ‭
+    { 14, 31, 0, -7, 23, 109, 16635 }, // ‮
+    { 0, 0, 4, 0, 0, 0, 16744 }, //  
+    { 43, 26, 45, 1, 24, 280, 16744 }, // ‰
+    { 7, 11, 9, 1, 23, 20, 17024 }, // ′
+    { 13, 11, 15, 1, 23, 36, 17044 }, // ″
+    { 20, 11, 22, 1, 23, 55, 17080 }, // ‴
+    { 7, 11, 9, 1, 23, 20, 17135 }, // ‵
+    { 14, 11, 16, 1, 23, 39, 17155 }, // ‶
+    { 21, 11, 23, 1, 23, 58, 17194 }, // ‷
+    { 14, 7, 16, 1, 0, 25, 17252 }, // ‸
+    { 8, 13, 11, 1, 15, 26, 17277 }, // ‹
+    { 9, 13, 11, 1, 15, 30, 17303 }, // ›
+    { 21, 23, 21, 0, 22, 121, 17333 }, // ※
+    { 15, 26, 18, 2, 25, 98, 17454 }, // ‼
+    { 17, 3, 17, 0, 27, 13, 17552 }, // ‾
+    { 8, 3, 10, 1, 10, 6, 17565 }, // ⁃
+    { 16, 27, 6, -5, 24, 108, 17571 }, // ⁄
+    { 26, 25, 29, 2, 24, 163, 17679 }, // ⁇
+    { 21, 26, 25, 2, 25, 137, 17842 }, // ⁈
+    { 21, 26, 25, 2, 25, 137, 17979 }, // ⁉
+    { 19, 6, 33, 7, 13, 29, 18116 }, // ⁓
+    { 26, 11, 28, 1, 23, 72, 18145 }, // ⁗
+    { 0, 0, 7, 0, 0, 0, 18217 }, //  
+    { 0, 0, 0, 0, 0, 0, 18217 }, // ⁠
+    { 0, 0, 0, 0, 0, 0, 18217 }, // ⁡
+    { 0, 0, 0, 0, 0, 0, 18217 }, // ⁢
+    { 0, 0, 0, 0, 0, 0, 18217 }, // ⁣
+    { 0, 0, 0, 0, 0, 0, 18217 }, // ⁤
+    { 13, 17, 15, 1, 28, 56, 18217 }, // ⁰
+    { 13, 17, 15, 1, 28, 56, 18273 }, // ⁴
+    { 10, 16, 15, 2, 27, 40, 18329 }, // ⁵
+    { 12, 17, 15, 2, 28, 51, 18369 }, // ⁶
+    { 12, 16, 15, 2, 27, 48, 18420 }, // ⁷
+    { 11, 17, 15, 2, 28, 47, 18468 }, // ⁸
+    { 11, 17, 15, 2, 28, 47, 18515 }, // ⁹
+    { 15, 11, 19, 2, 23, 42, 18562 }, // ⁿ
+    { 13, 16, 15, 1, 11, 52, 18604 }, // ₀
+    { 10, 16, 15, 2, 11, 40, 18656 }, // ₁
+    { 12, 16, 15, 2, 11, 48, 18696 }, // ₂
+    { 11, 16, 15, 2, 11, 44, 18744 }, // ₃
+    { 13, 16, 15, 1, 11, 52, 18788 }, // ₄
+    { 10, 16, 15, 2, 11, 40, 18840 }, // ₅
+    { 12, 16, 15, 2, 11, 48, 18880 }, // ₆
+    { 12, 16, 15, 2, 11, 48, 18928 }, // ₇
+    { 11, 16, 15, 2, 11, 44, 18976 }, // ₈
+    { 11, 16, 15, 2, 11, 44, 19020 }, // ₉
+    { 18, 23, 21, 1, 23, 104, 19064 }, // ₣
+    { 19, 24, 21, 1, 23, 114, 19168 }, // ₤
+    { 39, 24, 41, 1, 23, 234, 19282 }, // ₧
+    { 20, 24, 21, 0, 23, 120, 19516 }, // €
+    { 19, 13, 33, 7, 18, 62, 19636 }, // ←
+    { 13, 21, 33, 10, 22, 69, 19698 }, // ↑
+    { 19, 13, 33, 7, 18, 62, 19767 }, // →
+    { 13, 21, 33, 10, 22, 69, 19829 }, // ↓
+    { 21, 13, 33, 6, 18, 69, 19898 }, // ↔
+    { 13, 23, 33, 10, 23, 75, 19967 }, // ↕
+    { 15, 22, 33, 9, 22, 83, 20042 }, // ↨
+    { 13, 21, 33, 10, 22, 69, 20125 }, // ↲
+    { 13, 21, 33, 10, 22, 69, 20194 }, // ↳
+    { 19, 15, 33, 7, 19, 72, 20263 }, // ↵
+    { 19, 15, 33, 7, 19, 72, 20335 }, // ⇐
+    { 15, 19, 33, 9, 21, 72, 20407 }, // ⇑
+    { 19, 15, 33, 7, 19, 72, 20479 }, // ⇒
+    { 15, 19, 33, 9, 21, 72, 20551 }, // ⇓
+    { 21, 15, 33, 6, 19, 79, 20623 }, // ⇔
+    { 23, 24, 33, 5, 23, 138, 20702 }, // ∀
+    { 17, 27, 21, 2, 26, 115, 20840 }, // ∂
+    { 15, 23, 33, 9, 23, 87, 20955 }, // ∃
+    { 25, 27, 33, 4, 25, 169, 21042 }, // ∅
+    { 20, 24, 22, 1, 24, 120, 21211 }, // ∆
+    { 21, 24, 33, 6, 23, 126, 21331 }, // ∇
+    { 21, 23, 33, 6, 23, 121, 21457 }, // ∈
+    { 21, 29, 33, 6, 26, 153, 21578 }, // ∉
+    { 21, 19, 33, 6, 21, 100, 21731 }, // ∊
+    { 21, 23, 33, 6, 23, 121, 21831 }, // ∋
+    { 21, 29, 33, 6, 26, 153, 21952 }, // ∌
+    { 21, 19, 33, 6, 21, 100, 22105 }, // ∍
+    { 25, 29, 27, 1, 23, 182, 22205 }, // ∏
+    { 20, 29, 20, 0, 23, 145, 22387 }, // ∑
+    { 15, 3, 21, 3, 13, 12, 22532 }, // −
+    { 14, 26, 16, 1, 24, 91, 22544 }, // ∕
+    { 15, 26, 17, 2, 24, 98, 22635 }, // ∖
+    { 15, 16, 21, 3, 19, 60, 22733 }, // ∗
+    { 12, 12, 21, 4, 17, 36, 22793 }, // ∘
+    { 6, 6, 21, 7, 12, 9, 22829 }, // ∙
+    { 21, 31, 21, 0, 27, 163, 22838 }, // √
+    { 16, 13, 21, 2, 17, 52, 23001 }, // ∝
+    { 21, 11, 21, 0, 16, 58, 23053 }, // ∞
+    { 21, 23, 33, 6, 23, 121, 23111 }, // ∟
+    { 23, 23, 33, 4, 23, 133, 23232 }, // ∠
+    { 4, 34, 17, 6, 26, 34, 23365 }, // ∣
+    { 10, 34, 17, 3, 26, 85, 23399 }, // ∥
+    { 21, 23, 33, 6, 23, 121, 23484 }, // ∧
+    { 21, 23, 33, 6, 23, 121, 23605 }, // ∨
+    { 19, 24, 33, 7, 24, 114, 23726 }, // ∩
+    { 19, 24, 33, 7, 23, 114, 23840 }, // ∪
+    { 18, 34, 21, 1, 26, 153, 23954 }, // ∫
+    { 21, 19, 33, 6, 18, 100, 24107 }, // ∴
+    { 21, 19, 33, 6, 18, 100, 24207 }, // ∵
+    { 6, 18, 10, 2, 20, 27, 24307 }, // ∶
+    { 21, 19, 33, 6, 18, 100, 24334 }, // ∷
+    { 19, 6, 33, 7, 13, 29, 24434 }, // ∼
+    { 19, 18, 33, 7, 20, 86, 24463 }, // ≅
+    { 16, 12, 21, 2, 17, 48, 24549 }, // ≈
+    { 19, 11, 33, 7, 15, 53, 24597 }, // ≍
+    { 15, 15, 21, 3, 19, 57, 24650 }, // ≠
+    { 19, 15, 33, 7, 17, 72, 24707 }, // ≡
+    { 15, 20, 21, 3, 20, 75, 24779 }, // ≤
+    { 15, 20, 21, 3, 20, 75, 24854 }, // ≥
+    { 27, 16, 33, 3, 19, 108, 24929 }, // ≪
+    { 27, 16, 33, 3, 19, 108, 25037 }, // ≫
+    { 21, 19, 33, 6, 21, 100, 25145 }, // ⊃
+    { 21, 29, 33, 6, 26, 153, 25245 }, // ⊄
+    { 21, 29, 33, 6, 26, 153, 25398 }, // ⊅
+    { 21, 23, 33, 6, 23, 121, 25551 }, // ⊆
+    { 21, 23, 33, 6, 23, 121, 25672 }, // ⊇
+    { 25, 25, 33, 4, 24, 157, 25793 }, // ⊕
+    { 25, 25, 33, 4, 24, 157, 25950 }, // ⊖
+    { 25, 25, 33, 4, 24, 157, 26107 }, // ⊗
+    { 25, 25, 33, 4, 24, 157, 26264 }, // ⊘
+    { 19, 23, 33, 7, 23, 110, 26421 }, // ⊥
+    { 6, 6, 21, 7, 12, 9, 26531 }, // ⋅
+    { 27, 6, 33, 3, 12, 41, 26540 }, // ⋯
+    { 27, 26, 25, 0, 26, 176, 26581 }, // ﬀ
+    { 22, 26, 22, 0, 26, 143, 26757 }, // ﬁ
+    { 22, 26, 22, 0, 26, 143, 26900 }, // ﬂ
+    { 33, 26, 33, 0, 26, 215, 27043 }, // ﬃ
+    { 33, 26, 33, 0, 26, 215, 27258 }, // ﬄ
+    { 25, 27, 25, 0, 26, 169, 27473 }, // ﬅ
+    { 28, 27, 29, 1, 26, 189, 27642 }, // ﬆ
+    { 31, 32, 33, 1, 28, 248, 27831 }, // �
 };
 
 static const EpdUnicodeInterval bookerly_16_regularIntervals[] = {
@@ -2804,32 +2880,331 @@ static const EpdUnicodeInterval bookerly_16_regularIntervals[] = {
     { 0x22A5, 0x22A5, 0x2E7 },
     { 0x22C5, 0x22C5, 0x2E8 },
     { 0x22EF, 0x22EF, 0x2E9 },
-    { 0xFFFD, 0xFFFD, 0x2EA },
+    { 0xFB00, 0xFB06, 0x2EA },
+    { 0xFFFD, 0xFFFD, 0x2F1 },
 };
 
 static const EpdFontGroup bookerly_16_regularGroups[] = {
-    { 0, 4605, 9201, 100, 0 },
-    { 4605, 4421, 11541, 96, 100 },
-    { 9026, 6356, 18203, 128, 196 },
-    { 15382, 426, 551, 33, 324 },
-    { 15808, 10081, 29923, 220, 357 },
-    { 25889, 1492, 2935, 74, 577 },
-    { 27381, 597, 847, 18, 651 },
-    { 27978, 364, 572, 4, 669 },
-    { 28342, 593, 1066, 15, 673 },
-    { 28935, 2593, 5879, 58, 688 },
-    { 31528, 130, 248, 1, 746 },
+    { 0, 6111, 16111, 151, 5 },
+    { 6111, 3751, 8232, 66, 358 },
+    { 9862, 11054, 29794, 261, 0 },
+    { 20916, 11841, 28079, 276, 471 },
+};
+
+static const uint8_t bookerly_16_regularGlyphGroups[754] = {
+    2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0,
+    2, 2, 2, 2, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0,
+    0, 2, 2, 2, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0,
+    0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 3, 3, 3, 0, 0, 3, 3, 0, 0, 3,
+    3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+};
+
+static const uint8_t bookerly_16_regularKernLeftClasses[754] = {
+    0, 0, 0, 0, 0, 0, 0, 92, 0, 0, 0, 0, 92, 69, 0, 72,
+    0, 3, 21, 3, 27, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 131, 2, 107, 67, 15, 0, 57, 77, 39, 39, 38,
+    61, 37, 108, 28, 15, 62, 63, 32, 53, 8, 5, 9, 9, 76, 4, 97,
+    95, 51, 0, 0, 0, 0, 34, 23, 68, 75, 50, 24, 60, 22, 75, 118,
+    91, 73, 22, 22, 23, 23, 104, 31, 74, 68, 35, 11, 11, 121, 11, 113,
+    79, 0, 0, 0, 0, 111, 0, 0, 0, 0, 0, 0, 0, 0, 0, 83,
+    0, 21, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48,
+    0, 0, 0, 47, 2, 2, 2, 2, 2, 2, 0, 67, 0, 0, 0, 0,
+    39, 39, 39, 39, 15, 28, 15, 15, 15, 15, 15, 0, 98, 5, 5, 5,
+    5, 4, 52, 100, 34, 34, 34, 34, 34, 34, 50, 68, 50, 50, 50, 50,
+    75, 75, 30, 30, 105, 22, 23, 23, 23, 23, 23, 0, 23, 35, 35, 35,
+    35, 11, 23, 11, 2, 34, 2, 34, 49, 86, 67, 68, 67, 68, 67, 68,
+    67, 68, 15, 26, 15, 75, 0, 50, 0, 50, 0, 50, 135, 120, 0, 50,
+    77, 60, 77, 60, 77, 60, 77, 60, 39, 22, 39, 22, 39, 30, 39, 30,
+    39, 30, 117, 116, 39, 75, 38, 118, 38, 103, 61, 91, 91, 37, 73, 37,
+    73, 0, 26, 0, 0, 37, 78, 28, 22, 28, 22, 28, 22, 22, 28, 22,
+    15, 23, 15, 23, 15, 23, 0, 50, 32, 31, 32, 31, 32, 31, 53, 74,
+    53, 74, 53, 74, 53, 74, 8, 126, 8, 0, 8, 68, 5, 35, 5, 35,
+    5, 35, 5, 35, 5, 35, 5, 94, 9, 11, 4, 11, 4, 97, 113, 97,
+    113, 97, 113, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 124, 124, 82, 0, 128, 99, 13, 13, 45, 16, 16,
+    59, 10, 13, 1, 13, 17, 106, 54, 7, 25, 124, 10, 54, 13, 13, 10,
+    13, 93, 13, 12, 13, 36, 110, 7, 1, 66, 46, 25, 13, 13, 25, 16,
+    13, 16, 12, 12, 13, 56, 19, 127, 29, 55, 71, 44, 84, 80, 80, 44,
+    80, 80, 80, 19, 80, 19, 112, 29, 14, 19, 81, 55, 80, 80, 55, 33,
+    80, 33, 19, 19, 80, 71, 71, 85, 29, 134, 119, 123, 102, 129, 33, 33,
+    70, 44, 80, 14, 80, 96, 114, 12, 19, 42, 90, 25, 55, 16, 33, 36,
+    19, 40, 87, 41, 29, 0, 0, 43, 89, 54, 84, 43, 89, 10, 44, 10,
+    44, 10, 44, 25, 55, 0, 0, 0, 0, 101, 115, 110, 112, 7, 29, 20,
+    14, 20, 14, 58, 109, 25, 55, 25, 55, 13, 80, 64, 70, 122, 71, 122,
+    71, 13, 10, 44, 132, 130, 25, 55, 45, 88, 25, 55, 13, 80, 25, 55,
+    125, 17, 56, 17, 56, 124, 71, 124, 71, 12, 19, 12, 19, 10, 44, 54,
+    84, 133, 80, 13, 80, 13, 80, 12, 19, 12, 19, 12, 19, 12, 19, 1,
+    14, 1, 14, 1, 14, 13, 80, 7, 29, 13, 80, 41, 29, 65, 81, 46,
+    81, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 21, 21, 0, 21, 21, 21, 0, 0, 6, 18, 3, 6, 6, 18, 3,
+    6, 0, 0, 0, 0, 0, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 83, 48, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24, 75, 73, 75, 73, 68,
+    68, 0,
+};
+
+static const uint8_t bookerly_16_regularKernRightClasses[754] = {
+    0, 0, 0, 0, 0, 0, 101, 63, 0, 0, 0, 0, 63, 0, 67, 42,
+    0, 37, 11, 4, 35, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 94,
+    93, 0, 0, 0, 32, 0, 2, 38, 6, 38, 38, 38, 6, 38, 38, 65,
+    38, 38, 92, 38, 6, 38, 6, 38, 76, 33, 20, 24, 24, 89, 13, 110,
+    0, 23, 99, 0, 0, 0, 29, 87, 1, 1, 1, 51, 19, 26, 91, 86,
+    26, 26, 52, 52, 1, 98, 1, 52, 25, 45, 16, 21, 21, 83, 12, 62,
+    0, 0, 97, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40,
+    0, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 66,
+    0, 0, 0, 103, 2, 2, 2, 2, 2, 2, 43, 6, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 6, 6, 6, 6, 6, 0, 88, 20, 20, 20,
+    20, 13, 38, 77, 29, 29, 29, 78, 79, 29, 29, 1, 1, 1, 1, 71,
+    107, 91, 60, 30, 1, 52, 1, 1, 1, 1, 1, 0, 74, 16, 16, 16,
+    16, 12, 26, 12, 2, 84, 2, 80, 2, 29, 6, 1, 6, 1, 6, 1,
+    6, 1, 38, 1, 38, 1, 38, 1, 38, 1, 38, 1, 38, 1, 38, 1,
+    6, 19, 6, 19, 6, 19, 6, 19, 38, 26, 38, 85, 38, 30, 38, 30,
+    38, 30, 38, 91, 38, 91, 38, 91, 65, 58, 38, 26, 52, 38, 26, 38,
+    26, 38, 26, 38, 26, 38, 64, 38, 52, 38, 52, 38, 52, 52, 38, 52,
+    6, 1, 6, 1, 6, 1, 6, 1, 38, 52, 38, 52, 38, 102, 76, 25,
+    76, 25, 76, 25, 76, 61, 33, 45, 33, 45, 33, 45, 20, 16, 20, 16,
+    20, 16, 20, 16, 20, 16, 20, 16, 24, 21, 13, 12, 13, 110, 62, 110,
+    62, 110, 90, 77, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 44, 44, 15, 44, 14, 106, 44, 44, 81, 41, 44,
+    15, 44, 44, 28, 44, 22, 44, 44, 44, 56, 44, 46, 104, 44, 44, 44,
+    41, 100, 44, 14, 44, 44, 14, 15, 28, 57, 59, 44, 27, 44, 44, 15,
+    44, 44, 109, 44, 70, 36, 96, 8, 8, 50, 3, 54, 49, 8, 8, 8,
+    31, 8, 8, 3, 8, 68, 3, 10, 7, 3, 53, 8, 9, 8, 8, 10,
+    8, 8, 49, 8, 47, 3, 3, 75, 8, 3, 72, 108, 69, 82, 31, 8,
+    75, 8, 8, 7, 8, 15, 10, 14, 3, 55, 7, 44, 8, 111, 112, 44,
+    68, 44, 8, 44, 8, 44, 8, 46, 54, 104, 49, 44, 8, 44, 8, 0,
+    0, 15, 10, 44, 8, 44, 8, 44, 8, 14, 3, 14, 3, 15, 10, 39,
+    7, 39, 7, 59, 53, 0, 10, 27, 9, 27, 9, 44, 75, 34, 18, 34,
+    18, 44, 46, 54, 44, 8, 41, 31, 44, 8, 44, 8, 27, 9, 0, 8,
+    75, 22, 36, 22, 36, 48, 36, 44, 3, 105, 73, 0, 73, 46, 54, 104,
+    49, 0, 95, 44, 8, 44, 8, 14, 3, 14, 3, 14, 3, 0, 49, 28,
+    7, 28, 7, 28, 7, 0, 9, 44, 8, 44, 8, 44, 8, 59, 53, 59,
+    53, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 11, 11, 0, 11, 11, 11, 0, 0, 5, 17, 4, 5, 5, 17, 4,
+    5, 0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 66, 0, 101, 0, 0, 0,
+    32, 32, 101, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 51, 51, 51, 51, 51, 51,
+    25, 0,
+};
+
+static const int8_t bookerly_16_regularKernMatrix[15368] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -4, -4, 0, 0, -1, -3, -2, -2, -2, 0, 0, -3, 0, 0, 1, -4, 0, 0, 0, -5, 0, 0, 0, 0, 0, 1, 0, 0, -3, 0, 0, -1, -4, -3, -4, 0, 1, -3, -3, 0, 0, 0, 0, -1, -5, -6, -3, -4, 0, 0, -1, -2, 1, -4, -2, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, 2, -3, 0, -3, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, -1, 0, 0, -1, 0, 0, 0,
+    0, 0, 1, 0, 0, -3, -1, 0, 0, 0, 0, -1, -2, -4, 0, 0, -1, -2, 0, 0, -2, -2, 0, -3, -4, 0, 0, 0, 0, 0, 0, 0, -2, -3, 0, 1, 0, 0, 0, 0, -1, 0, -3, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, -3, -1, -1, 0, -2, -2, 0, -2, -3, -1, -2, -1, -1, -1, 0, -1, -2, 1, 0, -3, 0, 0, -3, -2, 0, 0, 0, 0, -2, -2, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, -3, 1, -1, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -3, -3, 0, -3, 0, -2, 0, 0, 0, 0, -2, -1, 1, 0, 0, -1, 1, 0, -2, 0, -1, 0, 0, 1, -3, 1, 0, 0, -2, 2, 0, 0, 0, 0, -4, 0, -3, 0, 0, -2, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 2, 0, 1, -3, -1, 0, 1, 0, -1, 0, 0, 0, 0, -3, 0, 0, -3, 0, -1, 0, -2, -1, -1, 0, 0, -1, -1, 1, 0, 1, -2, 0, -1, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 1, 0, 0, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -2, -1, -3, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, -1, 0, 0, -2, 0, 1, -1, 1, 0, 1, 0, 2, -1, 0, 1, 0, 0, 0, -3, 0, 1, 0, -2, 0, -4, 0, 0, 0, -2, -4, 0, -1, 0, 0, 0, 0, 1, -2, 0, 2, 0, 2, -1, 0, 0, 1, 0, 0, 0, 0, 2, -1, -1, -1, 0, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, -2, -3, 1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 1, -3, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, -1, -4, -2, -3, 0, 0, -2, -3, 0, 0, 0, 0, -1, -4, -3, -1, -3, 0, 0, 0, 0, 0, -3, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, -2, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, -4, 0, -3, 1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 1, 0, -2, 0, 0, 0, 0, 0, -2, 0, 0, 0, -2, 1, 0, 0, 0, 0, -4, 0, -3, 0, 0, -2, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -2, -1, 0, 0, 0, -1, 0, 0, 0, 0, -2, 0, 0, -2, 0, 0, 0, -2, -2, -2, 0, 0, 0, -2, 0, 0, 0, -1, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, -4, 0, -3, 0, -1, 0, 0, 0, 0, -2, -1, 1, 0, 0, -1, 1, 0, -3, 0, -1, 0, 0, 1, -2, 1, 0, 0, -2, 2, 0, 0, 0, 0, -4, 0, -3, 0, 0, -1, 0, 1, -5, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 2, 0, 2, -2, -1, 0, 1, 0, -1, 0, 0, 0, 0, -2, 0, 0, -2, 0, -1, 0, -1, -1, -2, 0, 0, -1, -1, 1, 0, 1, -1, 0, -1, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, -1, 0, -2, 0, -3, -2, 0, 0, 0, -1, -1, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, -3, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 0, -2, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -3, 0, 0, 0, 0, 2, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, -2, 0, -1, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, -3, 1, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -2, -1, -3, 0, 0, 0, 0, 2, 0, 0, 0, 0, -2, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -2, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, -1, 0, -1, 0, -1, -1, 1, 0, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0, -3, -2, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, -3, 0, 0, -2, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, -1, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -3, 0, -1, 0, -2, -2, -1, 0, 0, -1, -3, 0, -2, -2, 0, 0, 0, 1, -3, 0, 0, 0, -4, -2, 0, 0, 1, -2, 0, -3, 1, 0, 0, 0, -3, -1, 1, -3, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, -4, 1, -2, 0, 1, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, -3, -2, -3, 0, -1, 0, 0, 0, 0, 0, 0, 1, -1, 0, 0, 0, -2, -3, 0, 0, -3, 0, 1, -3, 0, 0, 0, -1, 1, -2, 0, 0, 0, 0, -1, -3, 0, 1, 0, -2, 0, -6, 0, 0, -1, -3, -6, 0, -2, 0, 0, 0, 0, 1, -2, 0, 1, 0, 1, -3, -1, 0, 0, 0, 0, 0, 0, 1, -1, -2, -3, 0, -2, 0, -1, 0, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, -3, 0, 0, -1, -1, -1, -2, -2, 0, 0, -2, 0, 0, 1, -2, 0, 0, 0, -3, 0, 0, 0, 0, 0, 1, 0, 0, -2, 0, 0, -2, -4, -2, -3, 0, 1, -2, -2, 0, 0, 0, 0, -1, -3, -3, -2, -2, 0, 0, -1, -2, 1, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 2, -2, 0, -2, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -2, -1, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 3, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 3, 0, 0, 0, 1, 0, 3, 0, -1, 0, 0, 0, 0, 4, 0, 2, 0, 0, -1, 0, -1, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 3, 1, 0, 3, 0, 0, 0, 3, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 2, 1, 0, 0, 0, 1, 3, 1, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 3, 0, 3, 0, 2, 1, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 3, 0, 0, 0, 1, 0, 2, 0, 0, 4, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 3, 0, 0, 2, 0, 0, 4, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 4, 2, 4, 0, 0, 1, 1, 0, 0, 0, 0, 0, 3, 0, 2, 0, 1, 2, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, -3, -3, -3, 0, 0, -1, -1, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, -3, 0, -1, -3, 0, 0, -3, 0, 0, 0, -3, 1, -2, 0, 0, 0, 0, -3, 0, 0, 0, 0, -2, 0, -5, 0, 0, 0, -3, -5, -2, -4, -1, -2, -1, -2, 0, -2, -1, 0, 0, 1, -3, -1, 0, 0, 0, 0, 0, -2, 1, 0, -3, -3, 0, -3, 0, -1, 0, -3, -3, -3, 0, 0, -1, -3, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, -2, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0,
+    0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 1, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 2, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 2, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, -2, 1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, -2, 0, -2, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, -2, -1, 0, 0, 0, 0, -1, -1, -2, 0, 0, -1, -1, 0, 0, -1, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, -2, 0, -2, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -3, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -3, 0, -3, 0, 0, 0, -3, 1, 0, 0, 0, -1, -2, -4, 0, -2, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -3, 0, 0, 0, -1, 0, 0, -1, -1, 0, -4, -3, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -1, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 1, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, -1, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, -2, 1, 0, -1, -2, -2, -2, -1, 0, 0, -1, 0, 0, 0, -4, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -3, -4, -3, -2, 0, 0, 0, -2, 1, 0, 0, 0, -1, -3, -4, -2, -3, 0, 0, -1, -2, 0, -3, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2, 0, -3, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, -2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -1, -3, -1, -2, 0, 0, 0, -2, 1, 0, 0, 0, 0, -2, -4, 0, -2, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -3, -2, 1, 0, 0, -1, -1, -1, -2, 0, 0, -1, 0, 0, 1, -3, 0, 0, 0, -4, 0, 0, 0, 0, 0, 1, 0, 0, -3, 0, 0, -2, 0, -2, -2, 0, 1, -1, -3, 0, 0, 0, 0, -1, -4, -5, -2, -3, 0, 0, -1, -2, 0, -3, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, -1, 0, 1, 0, -3, -2, 0, 0, 0, -1, -1, 0, 0, -3, 0, 0, 0, 1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, -2, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, -1, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -2, -1, -1, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -2, 0, -2, -2, 0, 0, 0, -1, 0, 0, 0, -2, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 1, 0, 0, 1, -2, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, -1, -2, -1, -1, -1, 0, 0, 0, -1, -1, 0, 0, -2, -1, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, -2, 0, 0, 0, 0, 0, -1, -1, 0, -1, 1, 0, 0, 0, 0, 0, -1, -1, 0, -1, -1, 0, -1, -1, -1, -1, 1, 0, -1, -1, -1, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, -2, 0, 0, 0, -2, -1, 0, -1, 0, -2, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, -3, -1, 0, 0, 0, 0, -1, -2, -4, 0, 0, -1, -2, 0, 0, -2, -2, 0, -3, -4, 0, 0, 0, 0, 0, 0, 0, -2, -3, 0, 1, 0, 0, 0, 0, -1, 0, -3, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, -2, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, -1, 0, 0, -1, -1, 0, -1, -1, 0, -1, -3, -1, -3, -1, 0, 0, 1, -2, -1, 0, 0, -3, 0, 0, -3, -1, 0, 0, 0, 0, -3, -2, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -3, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1, -1, 0, 0, -3, -2, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, -3, 0, -3, -2, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -2, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -3, 0, -3, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 1, 0, 0, 0, 0, -3, 0, -3, 0, 0, 0, 0, 1, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 2, 0, -2, -2, 0, 0, 0, -1, 0, 0, 0, -2, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 1, 0, 1, 0, 0, 1, 1, 0, 1, -2, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1,
+    0, 0, 0, 0, 0, -1, 0, -2, 0, -2, -1, 0, 0, 0, -1, -2, 0, -2, -2, 0, 0, 0, 0, -4, 0, 0, 0, -4, -2, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -2, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 1, 0, 0, 0, -1, 0, 0, 0, 0, -1, -2, 0, 0, 0, -1, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -3, 0, -3, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, -1, 0, 1, 0, 0, 0, -1, 0, 0, 0, 0, 1, 0, 0, 1, 0, -3, 0, -3, 0, 0, 0, 0, 1, -4, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 1, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 2, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, -2, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 3, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, -1, 0, 0, 0, 1, 0, 0, 0, 2, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -2, 0, -2, -2, 0, 0, 0, -1, -3, 0, 0, -1, 0, 0, 0, 0, -4, 0, 0, 0, -4, -3, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, -1, 0, -2, -2, 0, 0, 0, -1, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, -1, 1, 0, 0, 1, 0, 0, 1, -2, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, -1, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, -2, 0, -2, 0, -1, 0, -1, 0, 0, -1, 0, -2, -1, -2, 0, -1, 0, 0, 0, 0, -1, -3, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, -1, 0, 0, -1, 1, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, -1, 1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 1, 0, 0, 0, 0, 2, 0, 0, 0, 1, 0, -1, 0, 0, -1, 0, 0, 0, -1, -1, -1, 2, 2, 0, -1, 0, 2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -2, 0, -2, 0, -2, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -3, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -3, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, -4, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, -2, 0, 0, 0, 0, 1, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 1, -1, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 2, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 1, 0, 0, 0, 0, 2, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0, -2, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -2, 0, -2, 0, -2, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 1, 0, 0, 0, 0, -2, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, 1, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -2, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 2, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t bookerly_16_regularGlyphLookup[368] = {
+    0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0001, 0x0002, 0xFFFF, 0xFFFF, 0xFFFF, 0x0003, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0004, 0xFFFF, 0xFFFF,
+    0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, 0x0010, 0x0011, 0x0012, 0x0013, 0x0014,
+    0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, 0x0020, 0x0021, 0x0022, 0x0023, 0x0024,
+    0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, 0x0030, 0x0031, 0x0032, 0x0033, 0x0034,
+    0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, 0x0040, 0x0041, 0x0042, 0x0043, 0x0044,
+    0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051, 0x0052, 0x0053, 0x0054,
+    0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, 0x0060, 0x0061, 0x0062, 0x0063, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x0072, 0x0073,
+    0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, 0x0080, 0x0081, 0x0082, 0x0083,
+    0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F, 0x0090, 0x0091, 0x0092, 0x0093,
+    0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F, 0x00A0, 0x00A1, 0x00A2, 0x00A3,
+    0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF, 0x00B0, 0x00B1, 0x00B2, 0x00B3,
+    0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF, 0x00C0, 0x00C1, 0x00C2, 0x00C3,
+    0x0241, 0x0242, 0x0243, 0x0244, 0x0245, 0x0246, 0x0247, 0x0248, 0x0249, 0x024A, 0x024B, 0x024C, 0x024D, 0x024E, 0x024F, 0x0250,
+    0x0251, 0x0252, 0x0253, 0x0254, 0x0255, 0x0256, 0x0257, 0x0258, 0x0259, 0x025A, 0x025B, 0x025C, 0x025D, 0x025E, 0x025F, 0x0260,
+    0x0261, 0x0262, 0x0263, 0x0264, 0x0265, 0x0266, 0x0267, 0x0268, 0x0269, 0x026A, 0x026B, 0x026C, 0x026D, 0x026E, 0x026F, 0x0270,
+    0x0271, 0xFFFF, 0x0272, 0x0273, 0x0274, 0x0275, 0x0276, 0x0277, 0x0278, 0x0279, 0x027A, 0x027B, 0x027C, 0xFFFF, 0x027D, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x027E, 0x027F, 0xFFFF, 0xFFFF, 0x0280, 0x0281, 0x0282, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x0283, 0xFFFF, 0xFFFF, 0xFFFF, 0x0284, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0285,
+    0x0286, 0x0287, 0x0288, 0x0289, 0x028A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
 };
 
 static const EpdFontData bookerly_16_regular = {
     bookerly_16_regularBitmaps,
     bookerly_16_regularGlyphs,
     bookerly_16_regularIntervals,
-    64,
+    65,
     44,
     36,
     -9,
     true,
     bookerly_16_regularGroups,
-    11,
+    4,
+    bookerly_16_regularKernLeftClasses,
+    bookerly_16_regularKernRightClasses,
+    bookerly_16_regularKernMatrix,
+    113,
+    nullptr,
+    0,
+    0,
+    bookerly_16_regularGlyphLookup,
+    bookerly_16_regularGlyphGroups,
+    false,
+    nullptr,
 };
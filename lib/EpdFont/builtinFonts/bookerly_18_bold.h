@@ -3,2541 +3,2658 @@
  * name: bookerly_18_bold
  * size: 18
  * mode: 2-bit  compressed: true
- * Command used: fontconvert.py bookerly_18_bold 18 ../builtinFonts/source/Bookerly/Bookerly-Bold.ttf --2bit --compress
+ * Command used: fontconvert.py bookerly_18_bold 18 ../builtinFonts/source/Bookerly/Bookerly-Bold.ttf --2bit --compress --frequency-corpus ../../../test/hyphenation_eval/resources/english_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/french_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/german_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/italian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/russian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/spanish_hyphenation_tests.txt
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t bookerly_18_boldBitmaps[40459] = {
-    0xB5, 0x5A, 0x3D, 0x8F, 0xE5, 0xD6, 0x79, 0x3E, 0xBC, 0x37, 0x33, 0x44, 0x7C, 0x0B, 0xBA, 0xD0,
-    0xB8, 0xD8, 0x05, 0xC2, 0x94, 0x81, 0x02, 0x98, 0xFF, 0xC0, 0xA4, 0xA4, 0xC2, 0x85, 0x0A, 0x4D,
-    0x82, 0x1D, 0x09, 0x90, 0x0A, 0xA5, 0x48, 0x0A, 0xC9, 0x40, 0x26, 0x6D, 0x8A, 0x80, 0xD7, 0xDE,
-    0x22, 0x85, 0x0B, 0x4F, 0x02, 0x2B, 0x01, 0x92, 0xC2, 0x2E, 0x6C, 0x60, 0x77, 0x5C, 0x6C, 0x8A,
-    0xB4, 0x32, 0xE9, 0x5D, 0x20, 0x2A, 0xB6, 0x58, 0xAE, 0x14, 0x43, 0x85, 0x0A, 0x31, 0xD6, 0x0A,
-    0x4A, 0x76, 0x0B, 0x51, 0x0A, 0x17, 0xE2, 0x68, 0x49, 0x1E, 0x3F, 0xCF, 0xF3, 0x1E, 0xCE, 0xCC,
-    0xAE, 0x57, 0x5F, 0x91, 0x73, 0x67, 0xEE, 0xB9, 0xE4, 0xE1, 0xE1, 0x39, 0xEF, 0x79, 0xBF, 0x3F,
-    0x4E, 0x74, 0x29, 0x1D, 0xF3, 0x21, 0x1F, 0xCA, 0x1E, 0x7F, 0x9D, 0xFD, 0xE5, 0xE7, 0xFE, 0x32,
-    0xFC, 0xA5, 0xF8, 0x4B, 0xBA, 0x3F, 0x74, 0xFC, 0x6C, 0x86, 0x6C, 0xCA, 0xF1, 0x97, 0x8D, 0xBB,
-    0x47, 0xD1, 0x7E, 0xF4, 0x94, 0x8F, 0xC7, 0xBC, 0xF3, 0x6F, 0xF8, 0x64, 0x2C, 0xF1, 0x33, 0x27,
-    0x63, 0xDE, 0xFA, 0x1B, 0xFC, 0x69, 0xFC, 0xE5, 0x29, 0x19, 0xF2, 0xA6, 0xBA, 0x3C, 0x6D, 0xFA,
-    0x6F, 0x17, 0x7F, 0xAB, 0xB7, 0xDD, 0xAB, 0xC5, 0x93, 0x85, 0x73, 0xBE, 0xA8, 0xB6, 0x68, 0xF1,
-    0xEB, 0x22, 0xB4, 0xCE, 0xAD, 0x66, 0xFC, 0xBA, 0xF5, 0xB4, 0x9A, 0xDD, 0xDA, 0xE3, 0x33, 0x6D,
-    0xD8, 0x8E, 0x89, 0xDA, 0x9D, 0x97, 0x4F, 0x5E, 0x3A, 0xB9, 0xE4, 0x92, 0x6E, 0xD3, 0x3B, 0x47,
-    0x48, 0x9C, 0xCB, 0x5A, 0xB6, 0x79, 0x93, 0xB6, 0x6E, 0xAF, 0xFC, 0x75, 0xF9, 0x7E, 0x51, 0x72,
-    0x64, 0x53, 0xB1, 0xAD, 0xD5, 0x6E, 0x31, 0x6D, 0x75, 0x36, 0xBD, 0xD3, 0xF4, 0xD1, 0x8C, 0x76,
-    0x5C, 0x4D, 0xE8, 0xB9, 0x12, 0x5D, 0x71, 0xCB, 0x27, 0x2F, 0x1E, 0xDF, 0xC4, 0x1E, 0xE3, 0x31,
-    0x73, 0x13, 0x61, 0xC2, 0x6E, 0xED, 0xCB, 0xC3, 0x61, 0x33, 0xE6, 0x9B, 0x31, 0xE9, 0xF3, 0xF5,
-    0xC0, 0xA6, 0xC3, 0x06, 0xA3, 0x22, 0x99, 0x72, 0xE0, 0x85, 0x63, 0x01, 0x3B, 0x97, 0xF4, 0xBD,
-    0x5E, 0x2B, 0xD0, 0xE9, 0x1B, 0xE7, 0x2A, 0xDF, 0xF1, 0x7E, 0xD8, 0x2D, 0xFE, 0x2E, 0x1B, 0xD3,
-    0xED, 0xEB, 0x40, 0xCE, 0xF6, 0x75, 0x4C, 0x54, 0xBF, 0x8E, 0xD7, 0xDB, 0xD7, 0xD3, 0x3E, 0x3F,
-    0x99, 0xAA, 0x2E, 0x25, 0xE8, 0x31, 0x1A, 0xBE, 0x70, 0xC7, 0xB9, 0x68, 0x22, 0x68, 0xE3, 0x43,
-    0x4D, 0xF4, 0x70, 0x73, 0xFA, 0x59, 0x11, 0xE2, 0x57, 0x8F, 0x9C, 0x4B, 0x6A, 0x60, 0x88, 0xCB,
-    0x61, 0xFF, 0x80, 0xA3, 0x73, 0x31, 0xC6, 0x25, 0x27, 0x65, 0x0B, 0x5C, 0x61, 0xDE, 0x6D, 0x55,
-    0x0B, 0xCF, 0x23, 0xD0, 0x41, 0x04, 0x26, 0xDD, 0x7A, 0x72, 0x25, 0x48, 0x51, 0xD6, 0x49, 0x8F,
-    0x5E, 0xA2, 0x2B, 0x6F, 0x32, 0x0C, 0xC5, 0x7B, 0xBE, 0xC0, 0x50, 0xE0, 0x7B, 0x3D, 0x12, 0xEF,
-    0x44, 0x76, 0x97, 0x6F, 0x2F, 0x1C, 0x61, 0x6A, 0xFF, 0xF4, 0x18, 0xFB, 0x3E, 0xF2, 0x1F, 0x8E,
-    0x69, 0x8B, 0x7D, 0xAD, 0x00, 0xB8, 0x8F, 0xE7, 0xC3, 0x2E, 0xF2, 0x43, 0xDC, 0xE7, 0x4D, 0xDE,
-    0xBA, 0x03, 0x97, 0xD7, 0x1E, 0xB3, 0x02, 0xB4, 0x89, 0x53, 0x39, 0xAE, 0x95, 0xB5, 0x5C, 0x82,
-    0x74, 0xD9, 0x72, 0xF1, 0x78, 0x00, 0x59, 0x72, 0x0C, 0xC9, 0xEB, 0xCD, 0x18, 0x19, 0x95, 0xD2,
-    0x6E, 0x33, 0x70, 0x28, 0x56, 0x33, 0x80, 0x5D, 0xF5, 0x81, 0x17, 0x34, 0x8E, 0xBB, 0xB1, 0x5D,
-    0x00, 0xD1, 0x2E, 0xC3, 0xF7, 0x02, 0x77, 0xFD, 0xC4, 0x82, 0x83, 0xDD, 0xAB, 0xFA, 0xC9, 0x38,
-    0x0C, 0x03, 0x89, 0x47, 0xFC, 0xCC, 0xBE, 0x65, 0x67, 0x9F, 0x70, 0xE5, 0x44, 0xCB, 0xB8, 0x78,
-    0x16, 0x64, 0x91, 0xDF, 0x66, 0x7C, 0x58, 0x8A, 0x97, 0x5C, 0x6A, 0xDB, 0x5C, 0x7B, 0xFD, 0x38,
-    0x7F, 0x5B, 0x3F, 0xB9, 0xE1, 0x39, 0xF7, 0x45, 0x02, 0x02, 0x97, 0xBE, 0x03, 0x85, 0xB6, 0x98,
-    0x1C, 0xC8, 0x6D, 0xF2, 0xDE, 0xB7, 0xC0, 0x5F, 0x32, 0x66, 0x13, 0x58, 0x6D, 0x33, 0xAF, 0x3D,
-    0x50, 0xB7, 0xF2, 0x45, 0x3E, 0x63, 0x0A, 0xDF, 0xAC, 0xFD, 0x7B, 0x93, 0xCB, 0x06, 0x81, 0xB2,
-    0xF1, 0xE4, 0x0D, 0xF0, 0x24, 0x76, 0x06, 0xEE, 0xC8, 0x7C, 0x81, 0x79, 0xEE, 0x88, 0xD5, 0xBD,
-    0x6F, 0x73, 0xFD, 0xF4, 0x51, 0xE5, 0xE7, 0xA7, 0x3D, 0x16, 0x7C, 0xF1, 0xC7, 0x6E, 0xE7, 0x67,
-    0x2E, 0xDA, 0x2F, 0x6F, 0xF8, 0x74, 0x2C, 0x3F, 0xF2, 0x97, 0x67, 0x0A, 0x92, 0x7F, 0x66, 0x4A,
-    0x20, 0x48, 0x61, 0xBB, 0x40, 0x40, 0xD6, 0xB9, 0x6C, 0x04, 0xDC, 0x80, 0xC0, 0x6D, 0x26, 0x6E,
-    0x6B, 0xED, 0xB9, 0x2B, 0x57, 0xD5, 0x2E, 0xEF, 0x5C, 0xDA, 0xBB, 0xCD, 0xC8, 0x2E, 0xE7, 0x71,
-    0xDF, 0xBA, 0x74, 0xE0, 0x10, 0x3E, 0x2F, 0x75, 0xB3, 0x3C, 0xE9, 0xF8, 0x72, 0x64, 0x57, 0x18,
-    0xC0, 0xBE, 0x8C, 0x4F, 0x0B, 0x57, 0x76, 0x04, 0xDC, 0x55, 0x1D, 0x27, 0x72, 0xAF, 0x3B, 0xF7,
-    0x07, 0x5C, 0xF9, 0xDB, 0x8E, 0x0B, 0x54, 0x5A, 0x3C, 0x09, 0x6B, 0xD6, 0xD8, 0x2F, 0x87, 0xE7,
-    0x3D, 0x67, 0x4E, 0xCE, 0x81, 0x64, 0x50, 0x85, 0x7F, 0xDD, 0xC6, 0x13, 0x1F, 0x6D, 0x34, 0x06,
-    0x83, 0xB1, 0x0B, 0x00, 0x57, 0x35, 0xE0, 0x2B, 0x0C, 0xD9, 0xCC, 0xDC, 0x10, 0x66, 0xC2, 0x12,
-    0x99, 0x2D, 0xB8, 0x6A, 0xDD, 0x1F, 0xE7, 0x75, 0x72, 0x19, 0x72, 0x9B, 0xBB, 0xFC, 0x01, 0xD6,
-    0x99, 0x3D, 0x29, 0x71, 0x38, 0xFB, 0xFC, 0xC1, 0xAF, 0xFE, 0x71, 0xCE, 0x5D, 0x72, 0xB9, 0xE7,
-    0x10, 0xB7, 0x6E, 0x17, 0x81, 0xAE, 0xC5, 0xE4, 0xBF, 0x7B, 0xB1, 0x7B, 0x5C, 0xDD, 0xBD, 0x42,
-    0xFD, 0x70, 0x93, 0x8A, 0x85, 0x4A, 0xA3, 0xFE, 0xEC, 0xC1, 0xCE, 0x3D, 0xB9, 0x25, 0x83, 0x65,
-    0xFD, 0xCA, 0xD7, 0x80, 0xCA, 0xD7, 0x64, 0xA0, 0x22, 0xA3, 0xD0, 0x54, 0x35, 0x64, 0x67, 0x74,
-    0x7F, 0x44, 0xD6, 0x98, 0x53, 0xCD, 0xF7, 0x31, 0x66, 0xDC, 0x3B, 0xB8, 0xE4, 0xA2, 0xC2, 0xBF,
-    0x23, 0x1D, 0xE6, 0x6F, 0xFF, 0x8C, 0xC0, 0xEC, 0xED, 0x3B, 0x6E, 0x58, 0x88, 0xE5, 0x86, 0x85,
-    0x78, 0xD2, 0xE0, 0xAC, 0x37, 0xEB, 0xCF, 0xF5, 0x26, 0x92, 0x43, 0xAC, 0x0C, 0x7A, 0x58, 0x2F,
-    0x90, 0x13, 0x7A, 0x0B, 0xEB, 0x25, 0x99, 0xF4, 0x62, 0x82, 0xE9, 0x56, 0x4B, 0xEF, 0xE3, 0x17,
-    0xD9, 0x35, 0x3D, 0x17, 0x99, 0x70, 0xB4, 0x6C, 0x40, 0x2B, 0x6A, 0xD6, 0x82, 0xFC, 0x87, 0xAD,
-    0x8C, 0x6B, 0xDF, 0x25, 0x50, 0x08, 0xFE, 0x29, 0x3C, 0xA8, 0x86, 0x9C, 0x4C, 0x73, 0x03, 0x00,
-    0xE4, 0x63, 0xD9, 0xE3, 0xF2, 0x1D, 0xCC, 0x9F, 0x4D, 0x55, 0x8F, 0x85, 0xDE, 0xC1, 0xA4, 0xD9,
-    0x04, 0x26, 0x5E, 0xF9, 0x77, 0x75, 0xA9, 0xDE, 0x9B, 0x18, 0x80, 0xB1, 0xE4, 0x99, 0x37, 0xC8,
-    0x5D, 0x9C, 0x61, 0xE3, 0x9F, 0xC6, 0x5A, 0x1E, 0x5A, 0xAD, 0xC8, 0xB1, 0x84, 0xBF, 0x46, 0xEA,
-    0x52, 0x84, 0xB1, 0xF0, 0x40, 0x1D, 0x45, 0x58, 0x77, 0x7E, 0x4C, 0xA0, 0x48, 0xE3, 0x94, 0x3A,
-    0x68, 0x70, 0x17, 0x21, 0x63, 0x10, 0x86, 0x2D, 0x06, 0x41, 0x90, 0x20, 0x28, 0x7B, 0x87, 0x13,
-    0xD5, 0x30, 0x95, 0x2A, 0x70, 0x50, 0x52, 0xFF, 0x7F, 0xC5, 0x8E, 0xC1, 0xED, 0x62, 0xC5, 0x34,
-    0x90, 0xFC, 0x63, 0x2F, 0xE5, 0xFC, 0x84, 0x70, 0x41, 0xD8, 0xBD, 0x17, 0x2A, 0x6A, 0x8A, 0x60,
-    0x5B, 0x8E, 0x2B, 0xDF, 0x81, 0xB1, 0x7D, 0x4F, 0xD8, 0xFB, 0x8A, 0x0D, 0x34, 0x8E, 0xEF, 0xA2,
-    0x82, 0x92, 0x8B, 0xE1, 0x2D, 0xA7, 0x26, 0xDE, 0x85, 0x73, 0xE1, 0x5B, 0xB8, 0x6E, 0x1F, 0xEA,
-    0x12, 0x35, 0x39, 0x6A, 0x96, 0x0A, 0x3A, 0x3E, 0xBE, 0x4A, 0x7E, 0x98, 0xC9, 0x77, 0x33, 0x79,
-    0x6E, 0xCA, 0x0C, 0x8C, 0x3D, 0x90, 0xA5, 0xC2, 0xBB, 0xE8, 0xA3, 0x5E, 0xF1, 0x5D, 0x0E, 0x3C,
-    0x35, 0xBE, 0x89, 0xFD, 0x0D, 0x48, 0x87, 0x8F, 0x1B, 0xA0, 0x75, 0x17, 0xF3, 0x91, 0x55, 0xC4,
-    0x07, 0x3D, 0xC1, 0x2E, 0xDC, 0xA1, 0x27, 0xAE, 0x81, 0xC2, 0x98, 0x4D, 0x72, 0xEC, 0xC7, 0x00,
-    0x48, 0xC4, 0xA1, 0x6B, 0xF2, 0x4E, 0x3A, 0x07, 0x40, 0x12, 0x00, 0xB2, 0xF2, 0xD3, 0xCE, 0x8B,
-    0xDC, 0x1F, 0xD6, 0x77, 0xDE, 0xEC, 0x19, 0x2C, 0xCC, 0x8B, 0xFB, 0x26, 0x2D, 0xDF, 0x24, 0x7B,
-    0x90, 0xC7, 0x6C, 0x0F, 0x4E, 0xB4, 0xD9, 0xF0, 0x65, 0x40, 0xD6, 0x04, 0xAB, 0x86, 0x85, 0x27,
-    0x17, 0x6C, 0x5B, 0x32, 0xB2, 0x1B, 0x3C, 0x02, 0x0B, 0x37, 0x25, 0x13, 0xF9, 0x2C, 0x27, 0xA7,
-    0x50, 0x09, 0xE4, 0xB0, 0x93, 0x05, 0x18, 0x15, 0xDD, 0x60, 0x4E, 0x74, 0x4B, 0xB7, 0xFD, 0xAF,
-    0xDA, 0x9B, 0x6A, 0x83, 0x51, 0x3F, 0x38, 0xF0, 0xEF, 0xEF, 0x3B, 0xE9, 0x19, 0xCC, 0x28, 0x63,
-    0x97, 0x9B, 0xE6, 0x6D, 0xDC, 0xD2, 0xFD, 0x8D, 0xAB, 0x22, 0x51, 0xB7, 0x59, 0x48, 0xC4, 0xD9,
-    0xC0, 0xAE, 0xAF, 0x1D, 0xEC, 0x4B, 0xA1, 0x93, 0xEB, 0xC5, 0xF1, 0xB1, 0x3F, 0x22, 0x53, 0x99,
-    0xB9, 0xDE, 0xF2, 0x9D, 0x7A, 0x57, 0xC2, 0x0D, 0xFC, 0x52, 0x92, 0x24, 0x0C, 0xC2, 0x52, 0xB7,
-    0xD0, 0x46, 0x08, 0x1D, 0xB8, 0xD1, 0x06, 0xDB, 0x9A, 0x77, 0x9E, 0x87, 0x99, 0x26, 0x5D, 0x64,
-    0xF0, 0xC1, 0xB1, 0x80, 0xE5, 0xC2, 0x25, 0x43, 0xD0, 0x8E, 0xF0, 0xD1, 0xD1, 0x30, 0x8F, 0x86,
-    0x73, 0x2C, 0x05, 0xF5, 0x28, 0x23, 0x3B, 0x06, 0xFA, 0x6F, 0xB8, 0x90, 0x66, 0xCD, 0xE6, 0x83,
-    0x82, 0x6C, 0x3C, 0x71, 0x2A, 0xBF, 0x65, 0xD3, 0x56, 0xFD, 0x2E, 0xB8, 0x0A, 0x6A, 0x6D, 0xA4,
-    0x09, 0x60, 0x93, 0x8D, 0x54, 0xA1, 0x94, 0xA0, 0x74, 0x02, 0x97, 0x66, 0x23, 0x78, 0x27, 0x1F,
-    0x33, 0x58, 0xC7, 0x21, 0xF1, 0x0F, 0x8C, 0x21, 0xE4, 0x78, 0x40, 0xFA, 0x44, 0xDB, 0x57, 0x24,
-    0xBA, 0x7E, 0x20, 0x1E, 0x26, 0x36, 0xB3, 0x9A, 0xF2, 0xEE, 0x71, 0x35, 0xC2, 0x9E, 0xE5, 0x3D,
-    0x0C, 0x79, 0xD5, 0xE6, 0x40, 0x7E, 0x7D, 0xD1, 0xF0, 0xB7, 0x99, 0x65, 0xD7, 0x88, 0xA8, 0xC1,
-    0x49, 0x8F, 0x1B, 0x76, 0xD7, 0x86, 0xB2, 0x05, 0x5E, 0xF1, 0x4A, 0x36, 0x2D, 0xD6, 0xAE, 0x1C,
-    0x02, 0xAB, 0x09, 0x59, 0xD6, 0x54, 0x6D, 0xD0, 0x26, 0x6E, 0x77, 0x2B, 0x9D, 0x86, 0xEF, 0x45,
-    0x42, 0x55, 0x05, 0x35, 0xD2, 0x24, 0xFE, 0x9F, 0x20, 0xED, 0xD8, 0xF2, 0x00, 0xB3, 0x90, 0x0F,
-    0xB4, 0x7B, 0x76, 0x85, 0xD9, 0x2B, 0xA8, 0x97, 0xEF, 0x93, 0xAD, 0x3D, 0x59, 0x83, 0x18, 0xCB,
-    0xBD, 0x2C, 0x3A, 0xDF, 0xBD, 0xE6, 0xDB, 0x64, 0x5A, 0x43, 0xD0, 0x7A, 0x20, 0x87, 0x26, 0x04,
-    0xBE, 0x10, 0x50, 0xE2, 0x43, 0x03, 0x34, 0x0D, 0x20, 0x5D, 0xEE, 0xFF, 0xD9, 0xF7, 0xDC, 0x7E,
-    0xBB, 0x11, 0x4A, 0x2A, 0x2E, 0xBE, 0xF3, 0x73, 0x17, 0x3C, 0x80, 0x14, 0x14, 0x88, 0xC8, 0xDD,
-    0x5C, 0xA3, 0x4E, 0x64, 0x54, 0x27, 0x08, 0x33, 0xF6, 0x5D, 0xC1, 0xB5, 0xC5, 0xC6, 0xAA, 0xCE,
-    0x9A, 0x33, 0x8C, 0xA7, 0x33, 0xB6, 0x9B, 0x02, 0x93, 0x45, 0x3A, 0xF1, 0x8D, 0x91, 0xEF, 0x8E,
-    0xDC, 0x11, 0x74, 0xC6, 0xB1, 0xEF, 0x4F, 0xB9, 0xA5, 0x31, 0x29, 0x02, 0x35, 0xA9, 0x02, 0xC8,
-    0xEE, 0x78, 0x58, 0x91, 0xBB, 0x4A, 0x72, 0x9C, 0x94, 0x6A, 0x44, 0x50, 0xBE, 0xF1, 0x0F, 0x50,
-    0x8B, 0xDE, 0x57, 0x03, 0x47, 0x9F, 0xFF, 0x3C, 0x91, 0x4C, 0x72, 0x4A, 0xDF, 0x9D, 0xE0, 0xB3,
-    0x1C, 0x03, 0x10, 0x28, 0x91, 0x72, 0x42, 0x93, 0xF5, 0xEE, 0x71, 0x1F, 0xDA, 0x9C, 0xF5, 0x62,
-    0x73, 0x06, 0x48, 0x53, 0x2E, 0x9B, 0xB3, 0xA5, 0x33, 0x46, 0xFB, 0x1B, 0xF4, 0xF9, 0x4A, 0x3A,
-    0x69, 0x8B, 0xEF, 0x28, 0xC0, 0x56, 0x80, 0x7C, 0xF9, 0x8A, 0x82, 0xE4, 0x6D, 0xC0, 0xF7, 0xB8,
-    0xA6, 0x0E, 0x4C, 0x51, 0x72, 0x32, 0x29, 0x02, 0x22, 0x76, 0x3C, 0xB5, 0x8D, 0xAF, 0x1E, 0x1F,
-    0x1F, 0x6F, 0x1F, 0x02, 0xEA, 0xF4, 0x11, 0x2F, 0xFE, 0x03, 0x8F, 0xAF, 0x50, 0x73, 0x47, 0x7D,
-    0x10, 0xDC, 0x98, 0xC8, 0x22, 0x1D, 0x1E, 0x6D, 0x2E, 0xCA, 0xC2, 0x8D, 0xBC, 0xAB, 0xF1, 0x6D,
-    0x04, 0x41, 0x06, 0xB0, 0xF9, 0x95, 0xB2, 0xCA, 0xB8, 0xD0, 0x36, 0xF8, 0x70, 0x90, 0x18, 0x10,
-    0xA2, 0x4E, 0x4D, 0xE2, 0xEB, 0x93, 0x97, 0xB4, 0x41, 0x3A, 0x92, 0xA0, 0x05, 0x9D, 0x43, 0x4C,
-    0x09, 0x4E, 0xBF, 0x38, 0x63, 0xE2, 0x1E, 0x30, 0xD7, 0xA5, 0x87, 0x55, 0x26, 0x27, 0x1D, 0xC9,
-    0xA7, 0xCD, 0x31, 0x51, 0x85, 0xB9, 0x8E, 0xCE, 0x20, 0x2F, 0x1B, 0xB1, 0x7C, 0xEA, 0x4D, 0x09,
-    0x10, 0xA8, 0x57, 0x82, 0x64, 0x07, 0x15, 0x78, 0x48, 0xE7, 0xCC, 0x7E, 0xE5, 0x30, 0x2A, 0xFC,
-    0x90, 0x42, 0xF5, 0x9F, 0x52, 0xE8, 0x01, 0xEB, 0x11, 0x6E, 0x06, 0x33, 0x01, 0x14, 0x91, 0x54,
-    0x1A, 0x0B, 0xFC, 0x2A, 0x75, 0x05, 0xD9, 0xA0, 0x4F, 0x43, 0x3F, 0xA8, 0x2E, 0x5B, 0x3A, 0xC4,
-    0x11, 0x0C, 0x20, 0xBC, 0x15, 0x98, 0xBD, 0x99, 0x5E, 0x03, 0x76, 0x90, 0x0C, 0x65, 0x13, 0x93,
-    0x80, 0xD9, 0x6F, 0xBC, 0x8B, 0xE1, 0x70, 0xBB, 0xEA, 0x96, 0x64, 0xB3, 0x59, 0xCD, 0x50, 0x64,
-    0xD0, 0x54, 0xC5, 0x66, 0xA0, 0xFD, 0x04, 0x25, 0xF3, 0xB7, 0x66, 0x48, 0xEF, 0x4F, 0xA0, 0x3D,
-    0xA1, 0x44, 0xCB, 0x3A, 0x6F, 0x10, 0x2E, 0x74, 0x2B, 0x06, 0x4C, 0xF0, 0x03, 0xE1, 0x86, 0x6C,
-    0xE6, 0xD8, 0x43, 0xDF, 0x52, 0x20, 0xA0, 0x1D, 0xA9, 0x68, 0xC0, 0x78, 0xF2, 0x9C, 0x26, 0x62,
-    0x18, 0xF4, 0x78, 0xB2, 0xD8, 0x3D, 0x0A, 0x22, 0xEF, 0x16, 0x29, 0x26, 0xB9, 0xC4, 0xD7, 0x11,
-    0x51, 0x7A, 0x62, 0xD4, 0xC7, 0x16, 0x5F, 0xDB, 0xAB, 0xE4, 0x5D, 0x28, 0x86, 0x92, 0xD6, 0x97,
-    0x90, 0x92, 0x74, 0x64, 0x70, 0x7E, 0x0E, 0x2E, 0x3D, 0xC2, 0xA2, 0xBF, 0x0C, 0xA8, 0xB5, 0x79,
-    0xCD, 0x70, 0x98, 0x36, 0x94, 0xBB, 0x2C, 0x01, 0x88, 0xC3, 0xDB, 0x95, 0xAD, 0x9E, 0x3C, 0xD0,
-    0xA8, 0xD5, 0x2C, 0x0D, 0xE3, 0xF2, 0x1B, 0x1A, 0x15, 0x8F, 0x52, 0x3D, 0x0E, 0xDE, 0x87, 0xDC,
-    0xF0, 0x4E, 0x3A, 0x09, 0xB1, 0x00, 0x95, 0x33, 0x90, 0x23, 0x7B, 0x0B, 0x6F, 0xD1, 0x4C, 0xAB,
-    0xD1, 0x87, 0xE6, 0xDC, 0x3B, 0x0B, 0x15, 0xB1, 0x9F, 0xFC, 0xD3, 0x63, 0xF8, 0x17, 0x72, 0x52,
-    0x45, 0xDF, 0xAD, 0x84, 0x36, 0x95, 0xB5, 0x94, 0x26, 0xC4, 0x66, 0xD7, 0x66, 0x17, 0x46, 0x52,
-    0x13, 0xFB, 0xBB, 0x05, 0x12, 0x81, 0xC8, 0x63, 0xF4, 0xAA, 0xFF, 0x1F, 0xDB, 0xF9, 0x56, 0x34,
-    0xAF, 0x35, 0x35, 0xA8, 0xD7, 0xA6, 0x64, 0xA9, 0x2D, 0x4C, 0x38, 0xFE, 0x73, 0x6A, 0x33, 0x2A,
-    0x41, 0x0F, 0xDA, 0x6E, 0xD9, 0x2D, 0xD7, 0x97, 0x61, 0xD5, 0xFC, 0x0B, 0x2F, 0xB0, 0x7A, 0x41,
-    0x33, 0xC8, 0x9B, 0xA0, 0xDA, 0xDB, 0xC5, 0xB5, 0x6F, 0x23, 0x86, 0x8D, 0x78, 0xA1, 0xC6, 0xE8,
-    0x0D, 0x88, 0x37, 0x50, 0xCF, 0x62, 0x07, 0xD5, 0x59, 0x77, 0x09, 0xC1, 0x9E, 0xAF, 0x99, 0xED,
-    0xF1, 0x2B, 0xBF, 0xA8, 0xB8, 0x3B, 0x8F, 0xE0, 0xFB, 0x90, 0x3D, 0x29, 0xE9, 0xB1, 0xB6, 0x15,
-    0x2C, 0x24, 0xED, 0x77, 0x20, 0x26, 0x33, 0x36, 0x48, 0xD3, 0x1F, 0x0F, 0xC4, 0x5D, 0xDA, 0x10,
-    0xBF, 0xDF, 0x59, 0x79, 0xB3, 0xE8, 0xA7, 0x51, 0x4C, 0x24, 0xFC, 0x0A, 0x9D, 0x12, 0x85, 0x60,
-    0x11, 0x97, 0x6E, 0x1B, 0x5D, 0x5B, 0xB0, 0x23, 0xA2, 0x89, 0x2A, 0xB4, 0x71, 0x80, 0xEA, 0xE4,
-    0xF9, 0xC9, 0xB0, 0xAD, 0xB6, 0x5E, 0xC9, 0x73, 0xA4, 0x4A, 0x80, 0xD8, 0xEC, 0xBC, 0x52, 0xB8,
-    0x9D, 0x57, 0xFD, 0xA7, 0x85, 0x21, 0x72, 0x30, 0xE9, 0x99, 0x8D, 0x4A, 0xD4, 0xF8, 0xB4, 0x65,
-    0x94, 0xC0, 0x48, 0xDE, 0x16, 0x26, 0x9D, 0x05, 0x11, 0x76, 0x81, 0xB5, 0x23, 0xCE, 0x59, 0xD3,
-    0x86, 0xF2, 0x51, 0x82, 0xE8, 0x4A, 0xE2, 0x26, 0x8E, 0x2D, 0x47, 0x3E, 0x8A, 0xE4, 0x9E, 0x12,
-    0x72, 0x3E, 0x82, 0x3D, 0x91, 0x29, 0x1E, 0xEC, 0xAD, 0xC6, 0xDE, 0xD2, 0x84, 0xE0, 0x18, 0x86,
-    0xBC, 0xBE, 0xE6, 0x23, 0xE0, 0x15, 0xDD, 0x17, 0x65, 0xCB, 0x09, 0x4D, 0x76, 0x0A, 0x38, 0x68,
-    0xF5, 0x30, 0x86, 0xF7, 0x0E, 0xF0, 0x79, 0x5A, 0xD0, 0xFE, 0x50, 0xAD, 0x20, 0x87, 0xD4, 0x7E,
-    0x7A, 0x4C, 0x42, 0x31, 0x44, 0xE0, 0x2A, 0x82, 0x7A, 0xDD, 0x73, 0x8D, 0xDD, 0x42, 0x36, 0xF4,
-    0x14, 0xBD, 0xD1, 0x81, 0x98, 0x60, 0x74, 0xA7, 0x4E, 0x2E, 0xDF, 0x9A, 0x8F, 0xAF, 0x06, 0xC9,
-    0x7B, 0x78, 0xB4, 0x73, 0x02, 0x74, 0x73, 0x36, 0x37, 0x44, 0x9B, 0x50, 0x8E, 0x02, 0xF2, 0xE3,
-    0x33, 0x48, 0x26, 0x83, 0x2D, 0x3B, 0xF5, 0x9E, 0x3E, 0x3A, 0x85, 0x4C, 0x5B, 0xD6, 0xCB, 0x9A,
-    0x27, 0x12, 0x32, 0xFF, 0xC4, 0x48, 0xAD, 0x85, 0x6C, 0x4D, 0x8C, 0xFC, 0x77, 0x32, 0xCB, 0x7C,
-    0xE6, 0xF2, 0x43, 0x49, 0xDD, 0xA7, 0x87, 0xF2, 0xE8, 0xC8, 0x6E, 0xE1, 0x14, 0x75, 0x6E, 0xFC,
-    0x7F, 0xCA, 0xE1, 0x68, 0xD9, 0x88, 0xA6, 0xF3, 0x43, 0xEC, 0x78, 0x62, 0x26, 0x61, 0x36, 0xC3,
-    0xD0, 0x89, 0x21, 0x49, 0xDE, 0x1E, 0x3A, 0x61, 0x25, 0x71, 0x10, 0x7F, 0x65, 0x2D, 0x75, 0x43,
-    0x34, 0x89, 0xCD, 0x92, 0xDA, 0x64, 0xDD, 0x16, 0x0C, 0xC1, 0xB5, 0x71, 0xA4, 0x31, 0xA3, 0x6E,
-    0x9E, 0x3C, 0xBE, 0x5A, 0xCA, 0xCF, 0xFA, 0x00, 0x37, 0x95, 0x9F, 0x40, 0x49, 0x28, 0xC7, 0x1B,
-    0x14, 0xFC, 0x7C, 0xC8, 0x25, 0xF7, 0x3F, 0x90, 0x13, 0x01, 0x76, 0x6F, 0x69, 0x41, 0x98, 0x2F,
-    0x29, 0x07, 0x8B, 0xA6, 0xB7, 0x89, 0xF1, 0x60, 0x26, 0xA2, 0x93, 0x07, 0x09, 0xE8, 0xCE, 0x2B,
-    0xFB, 0x22, 0x73, 0x01, 0xB7, 0xF3, 0xCF, 0x89, 0x87, 0x4A, 0xF8, 0x1C, 0x57, 0x46, 0xEC, 0x23,
-    0x2C, 0xD6, 0x46, 0xC6, 0x71, 0x06, 0x9C, 0x88, 0x68, 0x80, 0x12, 0x4A, 0x71, 0x6D, 0x27, 0x88,
-    0x1F, 0xF7, 0x38, 0x35, 0x1D, 0xB0, 0x30, 0xC0, 0xC2, 0x02, 0x81, 0x09, 0xA0, 0x9C, 0x3E, 0xF7,
-    0xED, 0xCF, 0x99, 0xBC, 0x9A, 0xE9, 0xFD, 0x1D, 0x65, 0xA6, 0xAD, 0x3E, 0x0E, 0x90, 0xBF, 0x13,
-    0x20, 0xE7, 0x8E, 0x9E, 0x05, 0x93, 0xA0, 0xEB, 0x6D, 0xF0, 0x73, 0x14, 0x5E, 0xFC, 0x1A, 0x3F,
-    0xA9, 0xD6, 0x7A, 0xC7, 0x82, 0x95, 0x26, 0x02, 0xEB, 0x29, 0x5E, 0x00, 0x6D, 0x69, 0x6A, 0xEF,
-    0xC8, 0xC2, 0x29, 0xC8, 0xA0, 0x8A, 0xA1, 0xDF, 0x18, 0xCB, 0x07, 0xFE, 0xFA, 0x1D, 0xD2, 0x56,
-    0x95, 0x21, 0x01, 0x0E, 0xB4, 0xA1, 0x34, 0x93, 0x35, 0x24, 0x0F, 0xD4, 0x54, 0x0C, 0x66, 0x74,
-    0x48, 0x45, 0x84, 0xD9, 0xF4, 0xBF, 0xCC, 0x17, 0xC1, 0xCF, 0x50, 0xCA, 0x27, 0x3F, 0x22, 0x06,
-    0xC8, 0x61, 0x74, 0xB4, 0x99, 0x04, 0x03, 0x23, 0x0A, 0x9F, 0x8A, 0x9E, 0xA0, 0x62, 0x2D, 0x02,
-    0x30, 0x3F, 0xF8, 0x63, 0x63, 0xFA, 0x07, 0xB3, 0xA9, 0xB9, 0xD1, 0x7E, 0xC2, 0x9D, 0xBC, 0x01,
-    0xFF, 0x89, 0x94, 0x22, 0x46, 0x9A, 0x2F, 0x68, 0x61, 0x56, 0x97, 0xDB, 0x64, 0xE9, 0x32, 0xB5,
-    0x16, 0x5A, 0xCB, 0xA1, 0x85, 0x37, 0xE0, 0x8B, 0x95, 0xBF, 0x0F, 0x61, 0x68, 0x33, 0x39, 0xA2,
-    0x02, 0x70, 0x2D, 0x12, 0xD5, 0x66, 0xD1, 0x10, 0x56, 0x1C, 0x71, 0x0F, 0x8A, 0x6C, 0x94, 0x22,
-    0x14, 0x03, 0x31, 0x80, 0x89, 0x1E, 0xAB, 0x2B, 0x3E, 0x43, 0x85, 0x7C, 0xD9, 0xEE, 0xEF, 0xB0,
-    0xDB, 0xB4, 0x43, 0xF2, 0x65, 0x14, 0x8E, 0x23, 0x6C, 0xA0, 0x3C, 0xF6, 0x21, 0x65, 0xAA, 0x48,
-    0xBC, 0xB3, 0x54, 0x26, 0xA3, 0xA2, 0x84, 0x50, 0x27, 0xB2, 0x74, 0xF4, 0xC6, 0x00, 0x7D, 0xBA,
-    0x5C, 0xE4, 0x16, 0xDA, 0x43, 0x4F, 0x7E, 0xC8, 0x3D, 0x7D, 0x00, 0x0D, 0x70, 0x8D, 0xE4, 0x7C,
-    0x0F, 0x8B, 0xBD, 0x6C, 0x17, 0x85, 0x67, 0x3C, 0x92, 0xBD, 0xE9, 0xB7, 0x33, 0x2F, 0xF2, 0xDB,
-    0xFE, 0xBA, 0x22, 0x48, 0xB8, 0x35, 0x6F, 0x8D, 0x76, 0x51, 0xBD, 0x37, 0xE8, 0xA2, 0x2E, 0x3F,
-    0xE9, 0x19, 0x41, 0xC3, 0xFD, 0x81, 0x01, 0xD0, 0x05, 0x5C, 0x6D, 0x5E, 0x54, 0xB0, 0xD2, 0xD2,
-    0xFB, 0x15, 0xB6, 0x52, 0x2B, 0x45, 0x85, 0x76, 0xBB, 0x51, 0x42, 0x0B, 0xF6, 0x5E, 0x17, 0xCC,
-    0x26, 0xC5, 0xCA, 0x87, 0x45, 0xB4, 0xBD, 0x47, 0x84, 0xEB, 0xBF, 0x19, 0xC1, 0x29, 0x35, 0xC8,
-    0x30, 0x24, 0x27, 0xB5, 0x23, 0xC5, 0xA2, 0xFB, 0xDC, 0xF1, 0x3E, 0x95, 0x1D, 0xB6, 0xF7, 0x16,
-    0xB7, 0x8A, 0x51, 0xDF, 0x15, 0xCD, 0x3C, 0x43, 0xD8, 0x9A, 0xCE, 0xC5, 0x4A, 0xB1, 0x98, 0x50,
-    0xA1, 0x14, 0x18, 0x70, 0x27, 0xCF, 0xB4, 0xC2, 0x3C, 0xF6, 0x78, 0xD2, 0xE3, 0x89, 0x51, 0x04,
-    0x1E, 0x7F, 0xCC, 0xD4, 0x28, 0x1E, 0xDF, 0x80, 0xF0, 0xF0, 0xF1, 0x1A, 0x1C, 0xC8, 0x54, 0x5A,
-    0x8C, 0x70, 0x10, 0x8F, 0xC1, 0x3A, 0x6F, 0x86, 0x3D, 0xDC, 0xE4, 0x63, 0x60, 0xEE, 0x43, 0x65,
-    0xDA, 0xC8, 0x39, 0x4A, 0x8B, 0x85, 0x75, 0x4A, 0xB9, 0xF7, 0xE6, 0x46, 0x6D, 0x14, 0x37, 0xA1,
-    0xEF, 0x84, 0xBF, 0xE4, 0x9B, 0x82, 0xDE, 0xBF, 0xF9, 0x05, 0x20, 0xAF, 0x14, 0xAF, 0x45, 0x1F,
-    0xBB, 0xFB, 0x67, 0xEA, 0xFA, 0xA2, 0xB4, 0x60, 0x64, 0xFE, 0x5D, 0x62, 0xBE, 0xAD, 0x29, 0x6C,
-    0x44, 0xFB, 0xE8, 0xDE, 0x32, 0x84, 0x4D, 0x19, 0xA2, 0x6D, 0xE9, 0xC8, 0x9B, 0xFA, 0xE9, 0x53,
-    0xE1, 0x67, 0x90, 0xCE, 0x06, 0xBA, 0xC8, 0x5D, 0xD5, 0xF2, 0x23, 0x75, 0x5D, 0x7E, 0xC6, 0xCF,
-    0xA4, 0x1F, 0x79, 0x6C, 0xD5, 0x60, 0xF2, 0xD2, 0x9F, 0x8A, 0x8D, 0x84, 0x3D, 0x01, 0x20, 0x31,
-    0xF3, 0xDD, 0xD4, 0xD4, 0x44, 0xDD, 0x5D, 0xB2, 0x5E, 0xF0, 0xE7, 0x32, 0x13, 0xC0, 0x95, 0xE9,
-    0x6E, 0xF7, 0xAD, 0x63, 0xF8, 0x23, 0x11, 0x1D, 0x8C, 0x58, 0x1A, 0x5E, 0xA1, 0x94, 0x2E, 0x11,
-    0x1A, 0x75, 0x87, 0x62, 0x85, 0x72, 0x96, 0xB4, 0x5B, 0x1E, 0x4B, 0x82, 0x78, 0x7A, 0x19, 0xC9,
-    0xB3, 0xC8, 0x47, 0x75, 0xC1, 0x3C, 0xBC, 0x24, 0x31, 0xF5, 0xCC, 0xB0, 0x90, 0x01, 0xD4, 0x24,
-    0x7E, 0x7F, 0x91, 0x1C, 0x13, 0xA5, 0x47, 0x2F, 0x33, 0x0E, 0x50, 0xE6, 0x6C, 0xB3, 0xD8, 0xBC,
-    0xE6, 0x9C, 0x39, 0xDC, 0x65, 0x3E, 0x40, 0x62, 0x3C, 0x59, 0xF2, 0x59, 0xFA, 0xDC, 0x10, 0x0C,
-    0x77, 0xAA, 0xF4, 0xF4, 0x14, 0x81, 0xCB, 0x49, 0x0A, 0x2F, 0xF5, 0x75, 0xC0, 0xB0, 0x82, 0xF0,
-    0x72, 0x5E, 0x85, 0x18, 0xD3, 0x92, 0x4C, 0x5D, 0x40, 0xB1, 0x9C, 0xB4, 0xD4, 0xC7, 0x16, 0xAD,
-    0xFF, 0x8A, 0x0F, 0xB1, 0xDF, 0x80, 0xE3, 0x94, 0x4E, 0x5A, 0x3A, 0x2B, 0x3A, 0x05, 0xEF, 0x5B,
-    0x1A, 0xA2, 0x0E, 0x48, 0x8E, 0xA9, 0x5E, 0x11, 0x00, 0x2A, 0x21, 0x32, 0x2A, 0x0C, 0xAB, 0xC4,
-    0xA0, 0xF7, 0x08, 0x5F, 0x6E, 0x72, 0xBE, 0x32, 0x36, 0xE0, 0x86, 0xDA, 0x73, 0x3E, 0xBC, 0x12,
-    0x49, 0xEA, 0xBE, 0x13, 0x9C, 0xF7, 0x93, 0x03, 0x19, 0x66, 0x2F, 0xBE, 0xCA, 0xC2, 0xE8, 0xE0,
-    0xD3, 0x47, 0xD5, 0x69, 0x04, 0x1B, 0xBD, 0x5A, 0x2D, 0x2E, 0x60, 0x63, 0x2E, 0x60, 0x67, 0x2E,
-    0x20, 0x43, 0xF3, 0x96, 0x61, 0x09, 0x1D, 0x67, 0x6C, 0x98, 0x3E, 0xB5, 0x57, 0xF8, 0x99, 0x5B,
-    0x34, 0x86, 0x81, 0xE6, 0x0E, 0xF3, 0x11, 0xB9, 0x2D, 0x1F, 0xA4, 0x0A, 0x7D, 0x7B, 0x08, 0x98,
-    0xD6, 0xC6, 0x14, 0x46, 0x2D, 0x02, 0x2F, 0xA5, 0xFC, 0x80, 0xD0, 0xAC, 0xFD, 0xDF, 0x2B, 0x8B,
-    0x31, 0x5B, 0xF2, 0x6D, 0xD0, 0x8F, 0x5C, 0x77, 0x4E, 0xC8, 0x54, 0x19, 0x9D, 0x77, 0xA6, 0x0B,
-    0x10, 0x52, 0xB1, 0x83, 0x18, 0x7A, 0x93, 0x54, 0xC9, 0x65, 0x44, 0x65, 0x69, 0x18, 0xB8, 0x87,
-    0x60, 0x71, 0x45, 0x32, 0xD2, 0xD8, 0x71, 0x17, 0x72, 0x28, 0x06, 0xE0, 0x36, 0x1D, 0xE8, 0xBD,
-    0x0F, 0x88, 0xF8, 0x36, 0x3D, 0x9A, 0xB8, 0xC3, 0x5B, 0xAB, 0x6D, 0x6A, 0xF9, 0x13, 0xA9, 0x3E,
-    0x45, 0x1C, 0xB8, 0x5C, 0xD2, 0x35, 0xF4, 0xC5, 0x05, 0xF4, 0x21, 0xE9, 0x82, 0xD0, 0x7C, 0x03,
-    0x43, 0x36, 0xE5, 0x35, 0xD3, 0x0D, 0x6A, 0x20, 0x6C, 0x23, 0x82, 0x34, 0xB8, 0x33, 0xF3, 0xF3,
-    0xB4, 0x28, 0x66, 0x63, 0xA9, 0xB9, 0x38, 0x21, 0x19, 0x5E, 0x7E, 0x1F, 0xAD, 0x3B, 0x59, 0xD5,
-    0xEA, 0x04, 0xB7, 0xC2, 0xCD, 0xDD, 0x6A, 0x3E, 0xF6, 0xB7, 0xA0, 0x5B, 0x10, 0x15, 0xFA, 0x02,
-    0xF8, 0x2A, 0x7F, 0x08, 0xD6, 0x6F, 0xE2, 0xA1, 0x24, 0xF2, 0x4A, 0xB7, 0x8F, 0x9B, 0xA8, 0x08,
-    0x29, 0x1D, 0xB3, 0xAC, 0xBF, 0xB7, 0x9B, 0x18, 0xC6, 0xCD, 0x05, 0xA3, 0x15, 0xD4, 0x49, 0xAA,
-    0x9B, 0xE0, 0x5C, 0xBD, 0x00, 0x2A, 0xB1, 0x9F, 0x49, 0x34, 0x3C, 0xF8, 0x8D, 0x57, 0xAA, 0xE4,
-    0x8E, 0x52, 0x91, 0x79, 0x1F, 0xFC, 0x1A, 0xCB, 0xA6, 0xFE, 0x3F, 0xDD, 0x2E, 0x0B, 0x15, 0xD4,
-    0xFE, 0x32, 0xB9, 0x55, 0xA7, 0xF0, 0x26, 0x31, 0x59, 0xE4, 0x25, 0x58, 0xFF, 0x43, 0x3F, 0x9A,
-    0x26, 0xF4, 0x41, 0x60, 0x6B, 0x0B, 0x7C, 0xB5, 0xD7, 0x0B, 0xD4, 0x38, 0x61, 0x47, 0xDF, 0xB5,
-    0xA4, 0x29, 0x8B, 0x05, 0x50, 0x34, 0xFE, 0x3A, 0x77, 0x54, 0x2A, 0xF4, 0x52, 0xBA, 0x99, 0x6C,
-    0x20, 0x7B, 0x63, 0xAC, 0x4C, 0x07, 0x89, 0x86, 0xAD, 0x9C, 0x95, 0x99, 0x59, 0x7B, 0xD5, 0x44,
-    0xE8, 0xCD, 0xC4, 0xA6, 0x06, 0x95, 0xCC, 0xDF, 0x30, 0x86, 0xB7, 0xC0, 0x81, 0x5C, 0xC4, 0xC2,
-    0x51, 0x2F, 0x59, 0x5F, 0x07, 0x8D, 0x53, 0x36, 0xC2, 0xF2, 0xB3, 0x32, 0xE8, 0xF9, 0x20, 0x77,
-    0x64, 0xED, 0xDF, 0x95, 0xC8, 0xA5, 0x56, 0xDA, 0x72, 0x01, 0xD6, 0xCD, 0x69, 0xCC, 0xBD, 0x35,
-    0xD7, 0xDA, 0x22, 0x72, 0x8B, 0xF0, 0x42, 0x36, 0x35, 0x7C, 0x76, 0x68, 0xDA, 0x1D, 0x4D, 0xDD,
-    0x33, 0xDC, 0x54, 0xDE, 0x31, 0xD7, 0x40, 0x81, 0x92, 0xCD, 0x84, 0x86, 0xE1, 0xD6, 0xA8, 0x90,
-    0xFB, 0x95, 0x3C, 0x7E, 0x15, 0x82, 0x28, 0xB1, 0x3E, 0xD4, 0x91, 0xA8, 0x33, 0x1B, 0x55, 0x8C,
-    0x2C, 0x98, 0x63, 0x1D, 0x02, 0x5A, 0x9E, 0x35, 0xB7, 0x8A, 0xE2, 0xDD, 0x32, 0x55, 0x9C, 0x58,
-    0xFC, 0x46, 0x67, 0x80, 0x20, 0x29, 0xFA, 0xAB, 0x53, 0x49, 0x70, 0x51, 0x5D, 0x1B, 0x57, 0x96,
-    0x78, 0x4D, 0x3E, 0xF2, 0x2C, 0x14, 0x4A, 0xB1, 0x25, 0x7E, 0x6D, 0xD9, 0xC7, 0xAC, 0xAD, 0x3A,
-    0x15, 0x0D, 0xFD, 0x5B, 0x53, 0xEC, 0x9F, 0x1D, 0x94, 0x9C, 0xCC, 0x6B, 0x20, 0x40, 0x79, 0xE9,
-    0x4F, 0xC0, 0xF3, 0xB7, 0x3A, 0xED, 0xB9, 0x2A, 0xD2, 0x59, 0xB2, 0x5B, 0x4A, 0x9B, 0x5B, 0xCA,
-    0x78, 0x5E, 0x90, 0xC1, 0x0C, 0x53, 0x29, 0x8A, 0x46, 0x02, 0xBD, 0x77, 0x21, 0xB8, 0xCD, 0x0C,
-    0x2B, 0x50, 0x5A, 0xE6, 0x6B, 0x89, 0x2A, 0x96, 0x7C, 0x3E, 0x8F, 0xA5, 0x7D, 0x7C, 0x99, 0xE7,
-    0x4D, 0x84, 0x14, 0x50, 0x85, 0xE1, 0xF9, 0x5C, 0x30, 0xD3, 0x57, 0xCD, 0xCA, 0x59, 0x6D, 0xE8,
-    0x16, 0xD1, 0x01, 0x1C, 0x23, 0xCB, 0x26, 0x6F, 0xBD, 0x4A, 0x8A, 0xBD, 0xF2, 0xE8, 0x99, 0x57,
-    0xAE, 0x74, 0x1D, 0x74, 0x65, 0xBE, 0xAC, 0x65, 0xA4, 0x09, 0x04, 0x2B, 0x43, 0x10, 0x64, 0xFA,
-    0x36, 0x57, 0x92, 0xDD, 0x65, 0xF7, 0x2D, 0x0B, 0x62, 0x56, 0x33, 0x1D, 0xAD, 0xB4, 0x30, 0x31,
-    0x9A, 0x35, 0xBD, 0x59, 0x2F, 0xDC, 0xB6, 0x51, 0x06, 0xAD, 0xC9, 0x2C, 0x24, 0xF8, 0x89, 0x69,
-    0x90, 0x7B, 0x9E, 0x16, 0xD6, 0x0F, 0xE6, 0x24, 0x1F, 0x58, 0x46, 0xE1, 0x13, 0xAB, 0xA4, 0xDF,
-    0x54, 0x8E, 0x03, 0x28, 0xEC, 0xAC, 0x1C, 0xD7, 0xB2, 0xEC, 0x44, 0xE3, 0x42, 0x95, 0x8C, 0x47,
-    0x16, 0x89, 0xB0, 0xC2, 0x9A, 0xCD, 0x22, 0x52, 0x3E, 0x26, 0xAA, 0x01, 0x0C, 0x95, 0x79, 0xC3,
-    0xE3, 0x19, 0xD7, 0xAD, 0x8C, 0x07, 0x03, 0x66, 0x43, 0x04, 0x67, 0xE6, 0x72, 0x29, 0x99, 0xDA,
-    0x66, 0xD7, 0x8F, 0x79, 0xB4, 0x3A, 0x75, 0x46, 0xB6, 0xE7, 0xD5, 0xFA, 0x20, 0xD4, 0x1F, 0x5C,
-    0x52, 0x04, 0x25, 0x9D, 0xE8, 0x9F, 0x91, 0x91, 0xCF, 0xEF, 0xBE, 0x56, 0xFA, 0x35, 0x23, 0xC2,
-    0x26, 0x07, 0x2F, 0x0E, 0x08, 0xC1, 0x81, 0x9D, 0x0B, 0x96, 0xDD, 0x8C, 0x84, 0xBE, 0xDC, 0x22,
-    0xD6, 0x7A, 0x49, 0x70, 0xE9, 0x3E, 0x39, 0x77, 0x3F, 0x2F, 0xF7, 0x0C, 0x4D, 0x93, 0x02, 0xE2,
-    0x19, 0x8D, 0xBC, 0xCF, 0xAF, 0xAB, 0x48, 0x5E, 0xD2, 0xA4, 0xDF, 0x3A, 0xD3, 0xB5, 0xF2, 0x85,
-    0xFB, 0x60, 0xC0, 0xCD, 0xDC, 0xDD, 0xA4, 0x2F, 0x7F, 0x73, 0xBE, 0x02, 0x57, 0x93, 0xEE, 0xDD,
-    0xD7, 0x6D, 0xDE, 0x7F, 0x56, 0xF3, 0xF9, 0x91, 0x22, 0xA9, 0x7A, 0x5E, 0xDE, 0x85, 0x5A, 0x9E,
-    0x54, 0x03, 0xF9, 0x68, 0xBD, 0x74, 0x4B, 0x4B, 0x9C, 0x75, 0xAB, 0xC8, 0xD0, 0x2F, 0x25, 0xC0,
-    0x31, 0xA4, 0xE6, 0xD5, 0xCD, 0xD2, 0x9F, 0xBA, 0x55, 0x0C, 0x3C, 0x9D, 0xF2, 0xB4, 0xFB, 0x33,
-    0x56, 0x5A, 0x5D, 0xCD, 0x11, 0x42, 0x4E, 0xA5, 0x7F, 0xF3, 0x17, 0xE0, 0xB5, 0x26, 0xFE, 0xFA,
-    0xCD, 0x5E, 0xA5, 0xF9, 0xDE, 0xA2, 0xA7, 0x71, 0x49, 0x44, 0x77, 0xA1, 0x34, 0x15, 0x0A, 0x68,
-    0xF2, 0x78, 0x78, 0x94, 0xE3, 0x5D, 0x6A, 0xEC, 0x37, 0x00, 0x60, 0x79, 0x99, 0x3A, 0xF4, 0x19,
-    0xFA, 0x49, 0x91, 0xD7, 0x99, 0x8D, 0x02, 0x54, 0xAF, 0xC8, 0x99, 0x65, 0xCD, 0x62, 0x52, 0x9B,
-    0x22, 0xBC, 0xA3, 0x0F, 0x9D, 0xF6, 0x50, 0x1D, 0x89, 0xF1, 0x19, 0xCD, 0xE4, 0x0B, 0xFE, 0xA1,
-    0x0F, 0xBB, 0x2E, 0xED, 0xB8, 0xB8, 0x5E, 0x53, 0x3A, 0x73, 0x18, 0xF2, 0x22, 0xEB, 0x10, 0x02,
-    0xD9, 0x09, 0x96, 0x3D, 0x71, 0xEC, 0x24, 0x45, 0xAA, 0xE4, 0x06, 0x9D, 0xB2, 0x97, 0x10, 0x47,
-    0xCC, 0x72, 0x16, 0x0B, 0x44, 0x89, 0x99, 0x82, 0x0A, 0x27, 0x09, 0xDF, 0x51, 0xB9, 0x53, 0x02,
-    0xB7, 0x14, 0x0B, 0x21, 0x2D, 0x4A, 0xE0, 0x65, 0x98, 0xBE, 0xC1, 0xC8, 0x52, 0x05, 0x62, 0xFF,
-    0xAF, 0xFE, 0x44, 0x0C, 0xDB, 0x57, 0xFE, 0xBE, 0x1F, 0x37, 0xF2, 0xE3, 0x2E, 0x14, 0xD1, 0x51,
-    0x48, 0xB0, 0xEF, 0x5A, 0x82, 0xE5, 0x5C, 0x7B, 0xD1, 0x64, 0xA4, 0xFA, 0xCC, 0x76, 0x07, 0x34,
-    0xAA, 0x3E, 0xAA, 0x98, 0x69, 0x7B, 0x40, 0x69, 0xA9, 0xE4, 0x4D, 0x59, 0xBE, 0xA5, 0x9A, 0xC8,
-    0xCA, 0x74, 0xF2, 0x06, 0x8E, 0x87, 0x9B, 0xA7, 0x12, 0xC7, 0x17, 0xB7, 0xA5, 0xC6, 0xEB, 0x9F,
-    0x61, 0x78, 0x75, 0xF2, 0x12, 0x75, 0x80, 0x3C, 0x17, 0x73, 0x0C, 0x4B, 0x53, 0x5B, 0xCF, 0xAB,
-    0xBA, 0x42, 0x10, 0x4A, 0xC5, 0xE1, 0x4A, 0x37, 0x23, 0x78, 0xB9, 0x07, 0x3F, 0xB5, 0x4D, 0x47,
-    0xA0, 0x89, 0x55, 0xE2, 0x0D, 0x0B, 0x37, 0x7F, 0xC9, 0x7A, 0x6B, 0xA8, 0x38, 0x14, 0x4B, 0x59,
-    0xAD, 0xB6, 0x9C, 0xCE, 0xDA, 0x5C, 0xE1, 0xC6, 0xFD, 0xD9, 0x72, 0xAE, 0x87, 0x3A, 0x6B, 0xB4,
-    0xDA, 0xC9, 0xB7, 0x7E, 0xEE, 0x96, 0x12, 0x8E, 0xA1, 0xC7, 0x9B, 0x5B, 0xE7, 0xD5, 0x31, 0x9E,
-    0xE2, 0x42, 0x94, 0xB0, 0x22, 0xA8, 0x4A, 0x09, 0xEE, 0x52, 0xA5, 0x72, 0x9C, 0x54, 0xBA, 0xC2,
-    0x30, 0x79, 0x73, 0xFE, 0x58, 0x9E, 0xFF, 0x4A, 0x41, 0xE1, 0x46, 0x4E, 0x3F, 0xC1, 0x64, 0xBE,
-    0x35, 0x66, 0xFA, 0x97, 0xE9, 0x27, 0x74, 0x03, 0xD0, 0x6C, 0x5C, 0xA9, 0x7B, 0xA3, 0xEE, 0x54,
-    0xA3, 0xCB, 0x49, 0x51, 0x02, 0x8B, 0xC0, 0x4A, 0x13, 0x36, 0x76, 0x14, 0x09, 0x86, 0xE0, 0x5D,
-    0x3F, 0x20, 0x52, 0x81, 0xB6, 0x8D, 0xFE, 0xCA, 0xED, 0x15, 0x81, 0x87, 0x32, 0x99, 0x7B, 0x52,
-    0x42, 0xE5, 0xDB, 0x17, 0x7C, 0xCB, 0xDA, 0xE7, 0x75, 0x7A, 0x18, 0x4C, 0x0F, 0x4F, 0x90, 0xB2,
-    0xFC, 0x3E, 0x67, 0xD0, 0x69, 0x80, 0x4C, 0x95, 0x93, 0x2E, 0x6C, 0x45, 0xF8, 0x4A, 0x7C, 0x48,
-    0xB6, 0xFE, 0x45, 0xE9, 0x3F, 0x65, 0x1A, 0xC3, 0x2B, 0x28, 0xEF, 0x0D, 0x35, 0x3B, 0x57, 0xB9,
-    0xD0, 0xEE, 0x71, 0x61, 0xF5, 0x26, 0x45, 0x97, 0x8A, 0x3D, 0xC0, 0xAC, 0xF0, 0x92, 0x47, 0xF0,
-    0x33, 0x30, 0xFF, 0x37, 0x96, 0x81, 0xAF, 0x96, 0x66, 0xD7, 0x5B, 0x09, 0x5D, 0x65, 0x4C, 0x35,
-    0xD3, 0xF9, 0x3A, 0xDE, 0xFF, 0xA1, 0xE9, 0x43, 0x84, 0x90, 0x71, 0xAB, 0x6A, 0xB8, 0x7D, 0xF8,
-    0x97, 0x29, 0x7C, 0xF0, 0x46, 0x88, 0xDA, 0x2A, 0xA2, 0x80, 0x9F, 0x58, 0x7D, 0xF4, 0x6F, 0xB0,
-    0x55, 0x55, 0x4B, 0x0D, 0x43, 0x0F, 0xA1, 0xB6, 0x18, 0x5C, 0xE8, 0xD0, 0xF1, 0x90, 0x29, 0x36,
-    0x56, 0x1A, 0xC5, 0x65, 0xCC, 0x25, 0xC9, 0x81, 0xBE, 0x4F, 0x36, 0x30, 0x27, 0x47, 0x46, 0x3D,
-    0x9D, 0x8F, 0x8F, 0x8B, 0x10, 0x46, 0x89, 0xDB, 0x2D, 0xAA, 0x50, 0xB2, 0xE2, 0x69, 0x8C, 0x4B,
-    0x2D, 0x67, 0xD0, 0xE7, 0x2C, 0xC8, 0xD4, 0xC4, 0x98, 0x65, 0xA7, 0xE9, 0x7F, 0x84, 0x0C, 0x39,
-    0x26, 0xBB, 0x36, 0x53, 0xF4, 0x22, 0xD5, 0x1C, 0x42, 0xA4, 0x33, 0x9B, 0xED, 0xE2, 0x4A, 0xDF,
-    0x33, 0xDB, 0x6C, 0xB5, 0x08, 0x95, 0x40, 0xAD, 0x24, 0x6A, 0xE7, 0x06, 0xE8, 0xDB, 0x45, 0xFB,
-    0x3C, 0x4C, 0x90, 0x2A, 0x52, 0x3D, 0xF4, 0x93, 0x85, 0x36, 0xB5, 0x10, 0x4B, 0xBF, 0xAF, 0x29,
-    0x67, 0x0B, 0x61, 0x59, 0x2D, 0x20, 0xB2, 0x4A, 0x05, 0x34, 0xA9, 0xA2, 0x9B, 0x58, 0xF1, 0xCC,
-    0x57, 0x79, 0x00, 0x22, 0xA7, 0xF4, 0xC6, 0x10, 0xCB, 0xF8, 0x1F, 0xC9, 0xF4, 0x35, 0x2C, 0x3C,
-    0xC3, 0x03, 0x13, 0x77, 0x36, 0x74, 0x58, 0xB8, 0xDF, 0x9F, 0x3D, 0x94, 0x85, 0x75, 0x0A, 0x69,
-    0xBA, 0x5D, 0xB9, 0x66, 0xB2, 0xB6, 0xAA, 0x2F, 0x7F, 0xFE, 0x4D, 0x26, 0xAF, 0xEF, 0x96, 0xC4,
-    0xFC, 0x9B, 0xB2, 0x0B, 0x9E, 0xC7, 0x94, 0xE8, 0x05, 0x90, 0x3B, 0x2F, 0x9C, 0xAB, 0xFB, 0xED,
-    0x56, 0x88, 0x51, 0x27, 0x66, 0x3E, 0xE4, 0x53, 0xB1, 0x74, 0x4A, 0xE6, 0x8D, 0xBE, 0xDC, 0x0D,
-    0x43, 0x07, 0xD3, 0x3B, 0x16, 0xF3, 0x25, 0x8C, 0xC1, 0x00, 0x6F, 0x43, 0xED, 0xF0, 0xCB, 0x22,
-    0x10, 0x47, 0x76, 0x1C, 0x74, 0x3E, 0x6B, 0xBF, 0xA7, 0x36, 0xFA, 0xA2, 0xB6, 0x24, 0x63, 0x34,
-    0x15, 0xC3, 0x35, 0x38, 0x3F, 0xBC, 0x4E, 0x98, 0xF0, 0x69, 0x32, 0x46, 0x62, 0x4D, 0xC5, 0xB8,
-    0xF3, 0xB6, 0x92, 0x8D, 0x6F, 0x87, 0x44, 0x8F, 0x79, 0x1D, 0x6C, 0xDF, 0x51, 0xFF, 0x5B, 0xAA,
-    0xFD, 0xDF, 0x56, 0x15, 0xA2, 0x41, 0x84, 0xCC, 0x79, 0x68, 0x7E, 0x10, 0xBA, 0x6C, 0xA5, 0xDA,
-    0x9B, 0x8B, 0x1E, 0x9C, 0xC5, 0x92, 0xBB, 0x63, 0xB9, 0x7D, 0x0E, 0x1E, 0xCC, 0xCE, 0x11, 0x20,
-    0x5F, 0x55, 0x50, 0x0A, 0x33, 0xB9, 0x89, 0xAC, 0xA4, 0x82, 0x32, 0xA9, 0x1B, 0x7D, 0xAD, 0x9B,
-    0x52, 0x81, 0x06, 0xBD, 0x39, 0xAC, 0x00, 0xEC, 0x90, 0x07, 0x0F, 0x61, 0x4B, 0x1A, 0x86, 0xF4,
-    0x39, 0x7D, 0xB8, 0xCB, 0x4A, 0x28, 0x92, 0xCF, 0x4F, 0xAB, 0x1A, 0x21, 0xE1, 0xDC, 0x96, 0x2C,
-    0x91, 0x5B, 0x1A, 0x72, 0x70, 0x4A, 0xD5, 0xF1, 0x7F, 0x63, 0x41, 0x12, 0x15, 0x7E, 0x6F, 0xF7,
-    0xBF, 0xEF, 0xAE, 0x0D, 0x39, 0x84, 0x98, 0xF8, 0x01, 0x4F, 0x3A, 0x20, 0x7A, 0x61, 0x5E, 0x71,
-    0x86, 0xD6, 0xD8, 0x48, 0xC6, 0x8B, 0x65, 0x13, 0x61, 0x07, 0x06, 0xFE, 0x14, 0xAA, 0x97, 0x06,
-    0xB8, 0x41, 0xDD, 0x9F, 0x87, 0xF7, 0xEB, 0xDC, 0x6C, 0x16, 0x70, 0x0C, 0x16, 0x03, 0x44, 0xB6,
-    0x4C, 0xD2, 0x1F, 0x07, 0x65, 0xEA, 0x5B, 0x9A, 0x33, 0x16, 0x99, 0x52, 0x0C, 0xAE, 0xA1, 0xF8,
-    0x29, 0x23, 0x53, 0xCE, 0xA8, 0xE7, 0x65, 0x46, 0x70, 0xF7, 0x68, 0x74, 0x3F, 0xA5, 0xF6, 0x9B,
-    0x2A, 0x46, 0x44, 0x87, 0x34, 0x35, 0x6F, 0x48, 0x96, 0x7C, 0x6F, 0xD5, 0x08, 0x16, 0xF3, 0x4F,
-    0xA0, 0x0A, 0x54, 0x0B, 0xB1, 0xE4, 0x50, 0x29, 0x6D, 0xA3, 0xE3, 0x35, 0x11, 0x17, 0xFD, 0x53,
-    0xE0, 0x02, 0x2B, 0x9D, 0xF8, 0x50, 0xE5, 0xEB, 0x0E, 0xA5, 0xCE, 0x62, 0x26, 0x89, 0xEB, 0x94,
-    0x44, 0x74, 0x3A, 0xA3, 0x40, 0xC6, 0x66, 0x4E, 0xA8, 0x40, 0x40, 0xC8, 0x6C, 0x83, 0x2F, 0xD0,
-    0x9D, 0x4D, 0xEA, 0xEE, 0xD4, 0x5D, 0xA7, 0xAA, 0x6A, 0xA1, 0xBB, 0x24, 0xD3, 0xAF, 0xA9, 0x7E,
-    0x7E, 0x5D, 0x4D, 0xCA, 0xB3, 0xE8, 0x1C, 0xD1, 0x1C, 0xFC, 0xEA, 0xD8, 0xFF, 0xCB, 0xBE, 0x5B,
-    0x8A, 0xD4, 0xFD, 0xA9, 0xD0, 0xC4, 0x16, 0x64, 0x30, 0xD9, 0x6C, 0x69, 0x9F, 0x5C, 0xCA, 0xF0,
-    0xF8, 0xD8, 0x0E, 0x4F, 0xEE, 0x59, 0xE1, 0x6F, 0xE6, 0xF9, 0x0A, 0xD9, 0x53, 0xD5, 0x1D, 0xEE,
-    0xAA, 0x50, 0x47, 0xEB, 0x49, 0x73, 0xBA, 0x26, 0x9E, 0x6A, 0x56, 0x32, 0x47, 0xB3, 0xA9, 0xB2,
-    0xA6, 0x1B, 0x0A, 0x7B, 0x5D, 0x0D, 0xBA, 0x64, 0x6F, 0x39, 0x6A, 0x40, 0xA3, 0xA4, 0x54, 0x61,
-    0xF5, 0x0A, 0x3B, 0x99, 0xC1, 0x3C, 0xF1, 0xAC, 0xDA, 0x06, 0x2D, 0xF9, 0x25, 0x33, 0xED, 0x32,
-    0xEA, 0xBF, 0x73, 0x49, 0xB7, 0x5C, 0xF5, 0x70, 0xFA, 0x5D, 0x0D, 0xE1, 0xBC, 0x42, 0x8C, 0x92,
-    0x99, 0xC6, 0x1C, 0xDE, 0xC7, 0xDB, 0x70, 0xD7, 0x75, 0x98, 0xAA, 0xD6, 0xB1, 0x32, 0x3F, 0x45,
-    0x66, 0x54, 0x55, 0x6B, 0xFA, 0x52, 0x17, 0x76, 0x46, 0x77, 0x1D, 0xAC, 0x26, 0x51, 0x74, 0xC9,
-    0xEC, 0x44, 0x6A, 0x91, 0xD4, 0xC8, 0xE2, 0x3D, 0x9C, 0xE6, 0xEC, 0xBA, 0xDF, 0xC6, 0x1D, 0xF6,
-    0xF7, 0xD3, 0xD4, 0x4A, 0xBD, 0xC2, 0x76, 0xA1, 0x2C, 0x0F, 0xF3, 0xC0, 0xB8, 0xFB, 0x2F, 0x9E,
-    0x7F, 0x05, 0x79, 0x10, 0xB0, 0xAE, 0xFC, 0x73, 0xF2, 0x8E, 0x60, 0x20, 0x49, 0x98, 0x94, 0x33,
-    0xEF, 0xD1, 0xC6, 0x6D, 0x3A, 0xD5, 0xB2, 0xE5, 0xAB, 0x2B, 0x70, 0xAC, 0x74, 0x34, 0x98, 0x9C,
-    0x0A, 0x8E, 0x52, 0x4E, 0xDA, 0x4F, 0xA7, 0x45, 0xA1, 0xA5, 0x1A, 0xF4, 0x45, 0x1D, 0x43, 0xA4,
-    0x9C, 0x53, 0x2C, 0x1C, 0xC8, 0x12, 0x4C, 0xAC, 0x32, 0x40, 0x79, 0x37, 0xBB, 0xD7, 0xA0, 0xCB,
-    0xFA, 0x84, 0xE5, 0x1B, 0xD8, 0x5E, 0xA6, 0x7A, 0x61, 0x34, 0x48, 0xAA, 0xA0, 0x9A, 0x45, 0x3C,
-    0x67, 0x6E, 0xD1, 0xE6, 0x4B, 0x3C, 0x90, 0xC7, 0x89, 0x5E, 0x3D, 0x80, 0xD4, 0x14, 0x21, 0xDF,
-    0xA7, 0x50, 0x89, 0x10, 0xDC, 0x93, 0x6B, 0x77, 0x9B, 0x10, 0xBC, 0x42, 0x7E, 0xC2, 0x83, 0xA7,
-    0xBC, 0x7F, 0x4E, 0x87, 0xB3, 0xDF, 0x13, 0x2E, 0x54, 0x39, 0xA9, 0x5A, 0xC6, 0xA1, 0xB9, 0x6C,
-    0x43, 0x4A, 0xC9, 0xA2, 0x97, 0xCF, 0x6A, 0xF9, 0x6C, 0x59, 0x11, 0x66, 0x6F, 0x0A, 0xDB, 0xAD,
-    0x22, 0xD2, 0x31, 0xD3, 0x51, 0x9C, 0xE7, 0xC8, 0xCA, 0xD5, 0x07, 0x2A, 0x52, 0x2A, 0xFE, 0x37,
-    0x57, 0x51, 0x1E, 0xEA, 0x52, 0xBE, 0x5E, 0x85, 0x13, 0xC0, 0x67, 0x47, 0x6B, 0xA8, 0xB8, 0x0F,
-    0x80, 0x22, 0xAE, 0x9F, 0xB0, 0x82, 0x9D, 0x31, 0x6C, 0x87, 0x29, 0x6A, 0xE0, 0xF2, 0xF1, 0x90,
-    0x12, 0xEB, 0x22, 0xFC, 0x9F, 0x29, 0x31, 0xF9, 0xC4, 0xE3, 0xC1, 0xDC, 0x4C, 0xBB, 0xA1, 0xD7,
-    0xCF, 0x3C, 0xBB, 0x0E, 0xC3, 0x02, 0x8B, 0x09, 0x63, 0xE7, 0xA7, 0x26, 0xFF, 0xFD, 0x59, 0x30,
-    0xFD, 0x68, 0xCC, 0x74, 0x10, 0xAE, 0xAF, 0x6E, 0x90, 0x20, 0x53, 0x19, 0x4F, 0x3A, 0x4D, 0x7D,
-    0xAF, 0xCD, 0xEF, 0x09, 0xDE, 0xC9, 0xE0, 0xA3, 0x98, 0x5B, 0xB0, 0x3A, 0x5A, 0xF4, 0x9F, 0xF0,
-    0x3C, 0xF1, 0xD6, 0x7C, 0x36, 0x89, 0x67, 0xEC, 0x2D, 0x7E, 0x5B, 0x3E, 0x19, 0x5D, 0x65, 0xA8,
-    0x17, 0x04, 0xA9, 0x43, 0xCA, 0x0A, 0x39, 0xF1, 0xB5, 0x56, 0x42, 0x8B, 0xFC, 0x93, 0x4D, 0x96,
-    0x50, 0xC9, 0xED, 0x78, 0x9E, 0xE2, 0xF3, 0xF9, 0xAC, 0x8A, 0x9A, 0xDB, 0x89, 0x0A, 0x0B, 0xB9,
-    0x2C, 0x48, 0x54, 0xA8, 0xD5, 0xD1, 0xDB, 0xA9, 0x9A, 0x4C, 0xC9, 0x29, 0xC0, 0x90, 0xD2, 0xD2,
-    0x0D, 0xA5, 0xB4, 0x24, 0x5A, 0x2B, 0x8E, 0x18, 0xB9, 0xEA, 0x85, 0x5C, 0xED, 0x97, 0x21, 0x97,
-    0x7B, 0x98, 0x5C, 0xE9, 0x63, 0xC8, 0xB5, 0xF8, 0x5E, 0x8F, 0x92, 0x2B, 0x0A, 0x39, 0x12, 0xCB,
-    0xD1, 0x58, 0x11, 0x78, 0x5A, 0x52, 0x33, 0xC1, 0xE7, 0x7F, 0xB2, 0x52, 0x10, 0xEB, 0x2D, 0x7C,
-    0xB4, 0xED, 0x4A, 0x93, 0xA5, 0x27, 0x6E, 0x39, 0xBA, 0x74, 0xA4, 0x24, 0xDE, 0x92, 0x35, 0x18,
-    0x13, 0x1E, 0x1C, 0xC9, 0x89, 0x89, 0x81, 0xA9, 0x8E, 0x22, 0xF3, 0xA1, 0xBE, 0x96, 0xF8, 0xD3,
-    0x93, 0x91, 0x3C, 0x29, 0x34, 0xBA, 0x9F, 0xD2, 0x89, 0x6B, 0x79, 0xFA, 0xEE, 0x32, 0xBC, 0x2C,
-    0x58, 0xF9, 0xE3, 0x6B, 0x3D, 0xA7, 0xB9, 0xEE, 0x2D, 0xF5, 0x13, 0xF2, 0xE1, 0x96, 0xB9, 0x80,
-    0xBE, 0x85, 0x82, 0x1E, 0x79, 0xD8, 0x88, 0xAE, 0xA0, 0x4E, 0x99, 0x10, 0x5C, 0x1E, 0x97, 0x55,
-    0x48, 0xBA, 0xB2, 0x9A, 0xCD, 0xE9, 0xE1, 0xEB, 0x98, 0xC7, 0x99, 0xE8, 0x4C, 0x58, 0x61, 0x52,
-    0x85, 0x9D, 0x78, 0x5A, 0x86, 0x01, 0xA3, 0x08, 0x6C, 0xD7, 0xB3, 0x8E, 0xF6, 0x86, 0xD9, 0x66,
-    0x25, 0x12, 0x53, 0x26, 0xE1, 0x26, 0xA5, 0xF1, 0xF6, 0x88, 0x91, 0xF2, 0xED, 0xAF, 0xF6, 0xCF,
-    0xA3, 0xCB, 0x14, 0xDC, 0xB5, 0x74, 0xC2, 0x36, 0xAA, 0xBA, 0xF3, 0x70, 0x0E, 0xBC, 0xE1, 0x9A,
-    0x01, 0x86, 0x51, 0x8E, 0x37, 0xF3, 0x21, 0xBD, 0xBC, 0x60, 0x73, 0x46, 0xD2, 0x99, 0xC7, 0x38,
-    0x95, 0xF9, 0xDB, 0x86, 0x61, 0x84, 0xDB, 0xE0, 0xD4, 0x0B, 0x9A, 0x2D, 0xEB, 0x65, 0x16, 0x66,
-    0x9D, 0xEB, 0x98, 0xE4, 0xB2, 0xE8, 0xC3, 0xB3, 0xDE, 0x5B, 0x7A, 0x8E, 0xB0, 0xF9, 0x6F, 0x7A,
-    0x92, 0x67, 0x60, 0x3A, 0xEA, 0x06, 0xF4, 0xE4, 0x18, 0x6D, 0xDD, 0x5F, 0x17, 0xBF, 0x05, 0xE5,
-    0x5B, 0x3F, 0xB0, 0xE5, 0x66, 0x75, 0xFF, 0x74, 0xE5, 0xF7, 0x04, 0xDC, 0x64, 0x44, 0xE1, 0x25,
-    0x78, 0x37, 0x83, 0x28, 0x28, 0x88, 0x99, 0xA0, 0xD4, 0x19, 0xDB, 0x92, 0x71, 0x41, 0xE1, 0xC2,
-    0x2F, 0x33, 0xBB, 0x30, 0x81, 0x62, 0x29, 0x68, 0x1C, 0x26, 0xB3, 0xAD, 0x0B, 0xC7, 0x12, 0x50,
-    0xA4, 0x70, 0xC1, 0x2B, 0x1C, 0x52, 0xA4, 0x88, 0x0B, 0x32, 0x03, 0x8F, 0x62, 0x9B, 0x2D, 0x28,
-    0x76, 0x2D, 0x79, 0xB7, 0xA0, 0xA0, 0x40, 0xD8, 0xC3, 0xB8, 0x70, 0x11, 0xC5, 0xC6, 0x30, 0xE3,
-    0x2D, 0x2C, 0x40, 0x0B, 0x7A, 0x6F, 0x25, 0x7D, 0xF9, 0xFD, 0x7E, 0x47, 0xF7, 0xBE, 0xB7, 0xBB,
-    0xCF, 0xFC, 0x71, 0x20, 0xC0, 0x72, 0xDF, 0xAE, 0xEE, 0xBD, 0x92, 0xEE, 0xF7, 0x9D, 0xEF, 0x9C,
-    0xF3, 0x9D, 0xF3, 0x3B, 0x7F, 0xB4, 0x93, 0x67, 0x43, 0x31, 0xF2, 0x2F, 0xED, 0x1C, 0x5F, 0x1F,
-    0x8C, 0xBB, 0xB8, 0xC7, 0xDF, 0xB0, 0x1E, 0xD6, 0xE3, 0x7A, 0x8C, 0x37, 0x7F, 0x93, 0xFD, 0x25,
-    0xF8, 0x4B, 0xC7, 0x74, 0xCC, 0xFA, 0xB3, 0xFB, 0xCE, 0x5E, 0xEB, 0x1A, 0x87, 0xE4, 0x5D, 0x0F,
-    0xA5, 0x73, 0x2B, 0x3F, 0x3B, 0x97, 0x7A, 0xDF, 0x3A, 0xEF, 0xFD, 0x10, 0x7A, 0x7F, 0x19, 0xE3,
-    0xA5, 0x4F, 0x8E, 0xC9, 0x90, 0x3E, 0x31, 0x66, 0x5D, 0x1A, 0x76, 0x59, 0x9B, 0x06, 0x79, 0xD1,
-    0xA4, 0xCE, 0x55, 0x27, 0x0E, 0x19, 0x0E, 0x2D, 0x0F, 0x1D, 0x0E, 0x05, 0x0F, 0xD9, 0x90, 0xB9,
-    0x07, 0x52, 0x5F, 0x04, 0x57, 0x63, 0x0C, 0x35, 0x46, 0x1C, 0x2F, 0xF0, 0x1C, 0x39, 0xF1, 0x47,
-    0x98, 0xED, 0x39, 0x77, 0xEF, 0xE1, 0xA5, 0x53, 0x0E, 0xF6, 0xDA, 0xE1, 0xA1, 0xF0, 0xA5, 0x88,
-    0xCB, 0xDD, 0x1A, 0x23, 0xBA, 0xC0, 0xFF, 0xC0, 0x37, 0x2E, 0xEB, 0xA3, 0xD9, 0x45, 0xDE, 0x65,
-    0x0D, 0xC8, 0x08, 0x47, 0x17, 0x8F, 0xEE, 0x6F, 0x9C, 0xF3, 0x5A, 0xD0, 0x88, 0x43, 0xA0, 0x8F,
-    0xE9, 0xB0, 0xB3, 0xB7, 0xC2, 0xEC, 0xB3, 0xCB, 0x70, 0x6C, 0xF8, 0x71, 0x00, 0x8D, 0x64, 0x64,
-    0xE8, 0x35, 0x36, 0x3F, 0xAE, 0x67, 0x7E, 0xC4, 0xA0, 0x8E, 0xC3, 0xF0, 0xB7, 0xB9, 0xDB, 0xF9,
-    0x9A, 0x27, 0xFD, 0x3C, 0xF8, 0xEF, 0xE9, 0x63, 0x76, 0x84, 0xA3, 0xC3, 0xCF, 0x3F, 0x93, 0x93,
-    0xAC, 0xF7, 0x85, 0x4D, 0x90, 0xAF, 0x6F, 0x4C, 0xA9, 0x7F, 0x7E, 0x28, 0x78, 0x3D, 0xD4, 0xE0,
-    0xD9, 0x61, 0x05, 0x62, 0xFA, 0x95, 0x77, 0xD1, 0xE8, 0xB2, 0x7A, 0x35, 0xE3, 0x8B, 0xAB, 0xCA,
-    0x70, 0x72, 0x29, 0x98, 0xCB, 0x93, 0x55, 0x8D, 0xA9, 0x8A, 0xD6, 0x55, 0x20, 0x8B, 0x9C, 0xF1,
-    0x9D, 0xBF, 0xEC, 0xDF, 0x9C, 0x93, 0xF2, 0x1F, 0xF3, 0x2C, 0xA0, 0x2C, 0x6C, 0xE9, 0x18, 0x33,
-    0xD0, 0xD4, 0x5D, 0x8A, 0xB9, 0xFD, 0x84, 0x2F, 0x65, 0x31, 0x83, 0xB6, 0x32, 0xF0, 0x9D, 0x83,
-    0x2E, 0xC4, 0xDE, 0x61, 0x54, 0x57, 0x0C, 0x1C, 0x71, 0xE5, 0x6B, 0xCC, 0xE3, 0x62, 0x8C, 0xE8,
-    0x24, 0x8E, 0x86, 0x2B, 0xFC, 0x34, 0xA8, 0x4D, 0xB8, 0x88, 0x12, 0x72, 0x7D, 0xC7, 0xF7, 0x64,
-    0xA0, 0xE7, 0x0D, 0x29, 0x59, 0xBA, 0xF3, 0xB8, 0xEF, 0xCF, 0x38, 0xD2, 0x01, 0xE9, 0x50, 0x50,
-    0x18, 0xED, 0xE1, 0xCB, 0xFE, 0xA0, 0xD4, 0x08, 0x52, 0x1C, 0xF1, 0x68, 0xF9, 0x92, 0xF8, 0x3D,
-    0xB7, 0x28, 0x09, 0xC7, 0x21, 0xCF, 0xF4, 0x4B, 0x17, 0x4D, 0xC5, 0x6B, 0x77, 0xFF, 0x3B, 0x93,
-    0x6F, 0x44, 0x18, 0x9E, 0x72, 0xF5, 0xE1, 0xD2, 0xAE, 0xA5, 0x13, 0x07, 0x04, 0xBF, 0x30, 0x4E,
-    0x38, 0x60, 0x36, 0xEF, 0x92, 0x2E, 0x69, 0xDD, 0x0C, 0xE1, 0xEC, 0xE6, 0x19, 0x64, 0x11, 0x81,
-    0x68, 0x77, 0x8D, 0x94, 0xBF, 0x8A, 0xA9, 0xFE, 0x25, 0xF6, 0x4D, 0xD4, 0x25, 0xBE, 0xCC, 0xCA,
-    0x74, 0x06, 0x8B, 0xB3, 0x2E, 0x9E, 0xC1, 0xDC, 0x62, 0x5A, 0x8D, 0x81, 0x1F, 0xE3, 0x7A, 0xE5,
-    0xFB, 0xAB, 0xF8, 0xC9, 0xEB, 0x35, 0x0E, 0x23, 0xA9, 0x7C, 0xB9, 0xA3, 0x42, 0x82, 0x63, 0xE0,
-    0x7B, 0xD2, 0x56, 0x5D, 0x24, 0x29, 0x61, 0x29, 0xD0, 0x8E, 0x82, 0x02, 0x27, 0x9D, 0xEB, 0x76,
-    0xDD, 0xFA, 0xD6, 0xBF, 0xE9, 0xBF, 0xEA, 0xBF, 0x36, 0xC7, 0x73, 0xD2, 0x82, 0x02, 0xBD, 0x76,
-    0x5F, 0xDA, 0x97, 0x36, 0x68, 0xAD, 0xF1, 0x7C, 0xA1, 0xC2, 0xF9, 0xA2, 0x74, 0x2B, 0xE8, 0x20,
-    0xD5, 0xA4, 0x70, 0x21, 0x6F, 0x8C, 0xEB, 0xB8, 0x0E, 0xAA, 0xFD, 0xB0, 0x4D, 0x30, 0xEE, 0xB0,
-    0xEA, 0x1E, 0x73, 0xC5, 0xCD, 0xC1, 0x0D, 0x8F, 0xBA, 0x19, 0xCA, 0x72, 0xF5, 0x59, 0xDC, 0xDD,
-    0xBB, 0x67, 0xBF, 0x13, 0x0E, 0x6E, 0xCF, 0x3D, 0x3A, 0xE0, 0xCD, 0xB9, 0xC7, 0x86, 0xA8, 0xBF,
-    0xE3, 0x8D, 0x27, 0x1F, 0xFD, 0x4E, 0xC8, 0x41, 0x1F, 0x7D, 0x36, 0xE4, 0x6C, 0xCF, 0x3E, 0x1A,
-    0xF8, 0xB7, 0xAF, 0xBA, 0xAB, 0x19, 0xC4, 0x33, 0xBA, 0x21, 0xC9, 0x53, 0xDF, 0xAF, 0x3A, 0x4C,
-    0xF4, 0xB4, 0x8B, 0x9A, 0xB0, 0xB3, 0x6D, 0x6B, 0x44, 0xB8, 0xAC, 0x74, 0x1C, 0x61, 0x3D, 0x7F,
-    0xBD, 0xA2, 0x0A, 0x57, 0x22, 0xD7, 0xED, 0x1C, 0x2C, 0x22, 0xD8, 0x85, 0xAC, 0x2B, 0x5F, 0x47,
-    0x87, 0x55, 0x9E, 0xD6, 0xB3, 0x7B, 0x88, 0x24, 0x24, 0x54, 0xBF, 0x32, 0x39, 0x9A, 0xC1, 0xEA,
-    0x21, 0xEC, 0xE3, 0x36, 0xBE, 0x55, 0x8D, 0x29, 0x75, 0x6D, 0xA8, 0x36, 0x82, 0xFB, 0xC0, 0xC1,
-    0xE5, 0x1A, 0xCC, 0x02, 0xC3, 0x7A, 0x13, 0x64, 0xED, 0x9E, 0x81, 0x78, 0x56, 0x13, 0xF4, 0x2D,
-    0x86, 0x8D, 0xC8, 0x8B, 0x8E, 0xEA, 0x56, 0x17, 0x10, 0x5C, 0xEE, 0x29, 0x09, 0xDF, 0x62, 0xEB,
-    0x55, 0x3D, 0x14, 0x33, 0x05, 0x9F, 0x4B, 0xCA, 0xB3, 0xC5, 0x0D, 0x59, 0xEF, 0x8A, 0x76, 0x3D,
-    0xB9, 0xB8, 0x0D, 0x26, 0x17, 0xE4, 0xEE, 0x83, 0x17, 0xF0, 0x7A, 0x92, 0x5B, 0xA6, 0x5A, 0x36,
-    0x17, 0x17, 0x92, 0x61, 0xBF, 0x86, 0xF7, 0x7C, 0x58, 0x7D, 0x33, 0xF3, 0x73, 0xA2, 0xBB, 0x7E,
-    0x86, 0xFB, 0xCE, 0x5C, 0x38, 0x8F, 0x0B, 0x0F, 0xE2, 0xFF, 0x39, 0x52, 0x05, 0x91, 0x50, 0x06,
-    0xEB, 0x3A, 0x2E, 0x5D, 0xD0, 0x7D, 0x32, 0xF5, 0xF9, 0x77, 0x1E, 0x49, 0x6E, 0xB6, 0x8F, 0x3C,
-    0x13, 0x5D, 0xEF, 0xFE, 0xF6, 0x0A, 0x0E, 0x71, 0x17, 0x7D, 0xB7, 0xC1, 0xC1, 0xE7, 0x38, 0xBC,
-    0xE3, 0xE2, 0x2B, 0xD1, 0xF7, 0xEB, 0xF8, 0x99, 0xE8, 0x46, 0xF7, 0x91, 0x47, 0xD2, 0x5B, 0xD3,
-    0x23, 0x9F, 0x3C, 0xB3, 0xF7, 0xF1, 0x67, 0xE2, 0x1C, 0xBF, 0xE5, 0x28, 0x8D, 0xC6, 0x83, 0x10,
-    0xB9, 0xDE, 0x0B, 0xE0, 0xE0, 0x85, 0xF3, 0x58, 0xFC, 0x54, 0x68, 0x76, 0x4C, 0x7D, 0x41, 0xF6,
-    0x28, 0xE1, 0xC2, 0xFC, 0x8A, 0x06, 0xE1, 0xAD, 0xEA, 0xB5, 0x61, 0x35, 0x57, 0x2E, 0xBE, 0xDD,
-    0x39, 0x5F, 0xE5, 0xF1, 0xCD, 0x71, 0x35, 0xC1, 0x4A, 0x5C, 0x07, 0xC7, 0xD6, 0xD8, 0x4C, 0xE7,
-    0x20, 0x87, 0x60, 0xEF, 0x5D, 0x97, 0x86, 0x0F, 0xD1, 0x1D, 0x4C, 0xA0, 0x15, 0xA9, 0xDF, 0xFD,
-    0x66, 0x6C, 0x4E, 0x93, 0x68, 0x00, 0xF6, 0x9D, 0xDF, 0xFE, 0xAA, 0xD2, 0xAF, 0x96, 0x17, 0x36,
-    0x00, 0x04, 0x3B, 0x60, 0xDC, 0x3E, 0xEB, 0x8A, 0x16, 0x72, 0xB9, 0x3E, 0x42, 0x9F, 0xF6, 0x92,
-    0x5E, 0xB6, 0x71, 0x8D, 0x51, 0x60, 0x2C, 0x68, 0xE4, 0xF0, 0x2D, 0x19, 0x70, 0xFF, 0xDB, 0x07,
-    0x4F, 0x41, 0xBF, 0x61, 0x1D, 0xFB, 0x82, 0x16, 0xF6, 0x01, 0xA8, 0xFB, 0x84, 0x55, 0xBF, 0x01,
-    0x0F, 0xF0, 0x52, 0xE0, 0x2F, 0x72, 0x72, 0xD8, 0x9A, 0xAC, 0x5B, 0xC1, 0xE8, 0xE0, 0x86, 0xC7,
-    0x60, 0x0B, 0xA8, 0xA0, 0xD0, 0xA9, 0xA2, 0x0D, 0x2A, 0xC8, 0xA4, 0xC7, 0xBF, 0x04, 0x7B, 0x13,
-    0xDC, 0x71, 0xE5, 0xAA, 0x0F, 0xE1, 0x92, 0x92, 0x01, 0x93, 0xD7, 0x85, 0xFB, 0x30, 0x49, 0x7A,
-    0x80, 0xFF, 0xA0, 0x17, 0xE7, 0x60, 0x0E, 0xF5, 0xAF, 0xB0, 0x23, 0x4C, 0xE5, 0xF0, 0xDB, 0x1D,
-    0xEF, 0xFE, 0x37, 0x3A, 0x28, 0x4E, 0x01, 0x15, 0xC4, 0xD1, 0xDF, 0xBC, 0xED, 0xCF, 0x63, 0x05,
-    0x3F, 0x97, 0xBC, 0x5E, 0x01, 0x33, 0xDF, 0xC1, 0xE2, 0xFB, 0xEA, 0x7F, 0xBE, 0xE1, 0x1E, 0xCA,
-    0xAB, 0xF6, 0xD8, 0x8A, 0xDD, 0x71, 0xEC, 0x8F, 0x8F, 0x5E, 0x67, 0xBE, 0xB5, 0xF0, 0x11, 0x2C,
-    0xCE, 0x69, 0x81, 0x27, 0x27, 0xA1, 0xA4, 0x34, 0x74, 0x90, 0xFA, 0xF3, 0xE4, 0xC1, 0x50, 0xD0,
-    0x08, 0xFE, 0x6B, 0x17, 0xEA, 0x63, 0xC1, 0x8F, 0xD1, 0xDD, 0x1F, 0xB3, 0xE3, 0x1B, 0x12, 0x7E,
-    0xB4, 0x9F, 0x85, 0xFA, 0xB8, 0xFE, 0x39, 0x3E, 0x42, 0xAA, 0xF8, 0xE8, 0xC2, 0xF7, 0xF0, 0xB1,
-    0xE5, 0x47, 0x6E, 0x81, 0x8C, 0xEA, 0x20, 0x5B, 0xA0, 0x1D, 0xB1, 0x93, 0xFB, 0xD7, 0x69, 0xDE,
-    0x0F, 0x7D, 0xCD, 0x4D, 0x92, 0xF6, 0xD9, 0xF8, 0x89, 0x69, 0x35, 0x41, 0x20, 0x43, 0xD6, 0x66,
-    0x1B, 0x63, 0xD0, 0xB9, 0x4B, 0x74, 0x25, 0x79, 0xE6, 0xEB, 0xDD, 0xCB, 0x1D, 0xFD, 0x11, 0x3D,
-    0x46, 0x01, 0x6D, 0xB8, 0xFB, 0xCB, 0xE4, 0x2E, 0xD1, 0xF1, 0xF8, 0xA7, 0x16, 0xFD, 0x0A, 0x20,
-    0xE4, 0xCC, 0xF7, 0xE1, 0x5C, 0x75, 0x69, 0x9D, 0xB6, 0x70, 0xA9, 0x37, 0x06, 0xE7, 0x93, 0x36,
-    0x1C, 0x8B, 0x32, 0xEE, 0x60, 0x8C, 0xBF, 0x3A, 0x05, 0x53, 0x34, 0x5F, 0xEA, 0xC0, 0x28, 0x68,
-    0x76, 0xBB, 0xD1, 0xC9, 0x5D, 0xD8, 0x11, 0x0C, 0x03, 0x16, 0x88, 0xD4, 0x8F, 0xB8, 0x55, 0x63,
-    0x0E, 0x72, 0x05, 0x3B, 0x0E, 0x4F, 0x46, 0x53, 0x12, 0xC2, 0x8C, 0xF4, 0x50, 0x8B, 0xC8, 0x97,
-    0xF8, 0x07, 0xE9, 0x1C, 0x9B, 0x92, 0xC2, 0x0E, 0xF0, 0xD1, 0x59, 0xC7, 0x43, 0x0B, 0xC2, 0xE2,
-    0x86, 0x06, 0x98, 0xDA, 0xBA, 0xBC, 0x3E, 0xBC, 0xF5, 0x36, 0x14, 0xE6, 0x39, 0xD2, 0x8B, 0x55,
-    0x60, 0xA9, 0xB4, 0xCF, 0xBD, 0x33, 0x5B, 0x8F, 0x29, 0x21, 0x82, 0xCD, 0x8E, 0x3A, 0x8B, 0x8D,
-    0xE0, 0xD6, 0xB4, 0xBC, 0x11, 0x4F, 0x19, 0x1A, 0xC0, 0xA9, 0xB4, 0x59, 0x4E, 0x69, 0xCB, 0xE9,
-    0x54, 0x95, 0x2F, 0xA7, 0xE2, 0x8E, 0x63, 0xE3, 0x14, 0x8C, 0x3A, 0xF6, 0x12, 0x4F, 0xD1, 0xB9,
-    0xE8, 0xD4, 0xBA, 0xA3, 0x5A, 0x83, 0x38, 0x18, 0xB9, 0xD8, 0xD7, 0xE7, 0xB0, 0xE2, 0xAC, 0x0E,
-    0x67, 0x3A, 0x9C, 0x1E, 0x76, 0xBE, 0x4A, 0x8D, 0x09, 0x2E, 0x79, 0x45, 0xE3, 0xA6, 0x4D, 0x38,
-    0xA4, 0xA4, 0x13, 0xD3, 0xF8, 0x95, 0x4E, 0x79, 0xD8, 0x67, 0x9D, 0x02, 0x4F, 0xBD, 0xB8, 0x85,
-    0x6B, 0x99, 0x39, 0xEC, 0x8A, 0x36, 0x9C, 0xA7, 0x62, 0x32, 0x91, 0x77, 0xAD, 0x68, 0xE5, 0xF5,
-    0xC3, 0xA2, 0x5E, 0x4E, 0xC5, 0x5C, 0x4D, 0xF0, 0x4D, 0x7E, 0xDB, 0x22, 0xA8, 0x0F, 0xBA, 0x13,
-    0xAF, 0x0D, 0x20, 0x04, 0x03, 0x17, 0x36, 0x91, 0x27, 0xC6, 0x26, 0xF2, 0x44, 0x6C, 0x22, 0x4F,
-    0x8C, 0x4D, 0xBC, 0x26, 0x36, 0xFD, 0x2A, 0x9E, 0x24, 0xDD, 0x72, 0xCA, 0xAE, 0xF1, 0x54, 0x01,
-    0xEF, 0xAC, 0x53, 0x31, 0x7C, 0xF5, 0x24, 0xB5, 0x9A, 0x22, 0x52, 0x5F, 0xD0, 0xBC, 0x61, 0x77,
-    0x96, 0x60, 0x53, 0x24, 0x0C, 0x7B, 0x4E, 0x3C, 0xA9, 0x1C, 0x7C, 0xAF, 0xEF, 0xD3, 0x26, 0x80,
-    0xA5, 0xC2, 0x8A, 0xC3, 0x61, 0x83, 0xCF, 0xB4, 0x76, 0xE3, 0x09, 0x55, 0xDA, 0xF8, 0x25, 0x3B,
-    0x26, 0x9E, 0xD8, 0x4D, 0xE0, 0x49, 0x40, 0x40, 0x23, 0x9E, 0x14, 0x47, 0x04, 0x30, 0x9C, 0x5C,
-    0x80, 0x86, 0xD2, 0x27, 0xF4, 0x93, 0x66, 0x47, 0x06, 0xFF, 0x9A, 0x0D, 0x1B, 0xAE, 0x6E, 0x39,
-    0x93, 0x9F, 0x64, 0xD3, 0xC7, 0xDC, 0x62, 0xB8, 0xA3, 0x76, 0x41, 0x20, 0xB4, 0x77, 0xA1, 0xC0,
-    0x0E, 0x97, 0x5B, 0xDD, 0xA4, 0x26, 0x4D, 0x44, 0x0E, 0x34, 0xAC, 0x64, 0xC7, 0x23, 0xA4, 0x54,
-    0xB2, 0x21, 0xCE, 0x0B, 0xE4, 0x81, 0x89, 0x43, 0x33, 0xC9, 0x86, 0x53, 0x0F, 0xC2, 0x9C, 0xD3,
-    0xA2, 0x69, 0x7F, 0x0F, 0xAB, 0x03, 0xAE, 0x52, 0x04, 0xBE, 0x0C, 0xA5, 0x4D, 0x14, 0x5F, 0x95,
-    0x53, 0x9B, 0xB0, 0x98, 0xB8, 0xA5, 0x36, 0x05, 0x55, 0xB7, 0x22, 0x3A, 0xAA, 0x2B, 0x5A, 0xA2,
-    0x12, 0xDA, 0x84, 0x45, 0xC1, 0x95, 0x51, 0x9B, 0x0A, 0x9F, 0x63, 0x1A, 0x6A, 0xD3, 0x79, 0x4E,
-    0xB3, 0x68, 0xD3, 0xBA, 0xDF, 0x6A, 0x93, 0x5B, 0xB4, 0x29, 0x6B, 0x16, 0x6D, 0x8A, 0xB6, 0xDA,
-    0x04, 0x43, 0x6F, 0xDA, 0x94, 0x6E, 0xB4, 0x49, 0xC2, 0xD3, 0x0F, 0xAB, 0x72, 0xA3, 0x4D, 0xDD,
-    0x46, 0x9B, 0x1E, 0xBB, 0x97, 0x4D, 0xE7, 0xB9, 0x18, 0xE0, 0x0E, 0x3A, 0x15, 0x5F, 0xEB, 0x7D,
-    0xE5, 0x4F, 0xB0, 0x30, 0xE0, 0xC4, 0x8B, 0x8D, 0x02, 0x64, 0xDA, 0x15, 0xDE, 0xAA, 0x41, 0x48,
-    0x8D, 0x15, 0x94, 0xA9, 0xFF, 0x11, 0x80, 0xB2, 0x71, 0x07, 0xE8, 0xC5, 0xDE, 0x6B, 0x63, 0x6E,
-    0x3C, 0x3F, 0x7E, 0x05, 0x72, 0x1A, 0xE9, 0x61, 0x05, 0x7E, 0x00, 0xAA, 0xC0, 0x88, 0x7D, 0xB7,
-    0xD9, 0xED, 0x66, 0xF1, 0x18, 0x7D, 0x58, 0x70, 0xE3, 0xCB, 0x05, 0x2F, 0xE7, 0x66, 0xA5, 0x26,
-    0x23, 0xA0, 0x6A, 0xEF, 0x32, 0x0D, 0x77, 0xBC, 0xD6, 0x76, 0x35, 0x5A, 0x68, 0x5E, 0x20, 0x4E,
-    0x62, 0x96, 0xCE, 0xB4, 0x9F, 0x43, 0xB6, 0x36, 0x83, 0xDD, 0xE5, 0xCD, 0x53, 0xA4, 0x3F, 0xD1,
-    0x8C, 0xE1, 0x98, 0xD9, 0x66, 0xB8, 0x6E, 0x81, 0x03, 0x9C, 0xA0, 0xA6, 0x37, 0x4F, 0x92, 0xB6,
-    0xA2, 0x0B, 0x4A, 0x52, 0x88, 0xA9, 0x58, 0x3A, 0xEE, 0x8A, 0x15, 0x8A, 0x38, 0x43, 0xFD, 0x4E,
-    0xD2, 0x00, 0xD5, 0xA1, 0x3F, 0x38, 0xA0, 0x5E, 0x56, 0xC6, 0x47, 0xEE, 0xE2, 0x6C, 0x52, 0x10,
-    0x42, 0xA7, 0x0B, 0xF4, 0x04, 0x05, 0xDA, 0xCF, 0x70, 0x47, 0x2A, 0x97, 0x5F, 0x47, 0x8A, 0x4B,
-    0xC8, 0x1C, 0x23, 0xF7, 0xC1, 0x65, 0x49, 0xCD, 0xC9, 0x25, 0xAD, 0xCC, 0xDA, 0x3A, 0x03, 0x83,
-    0x98, 0x4A, 0x5C, 0x8A, 0xE6, 0x7C, 0xAB, 0xE1, 0xF7, 0x37, 0x57, 0xCE, 0x2E, 0x86, 0xCE, 0xB4,
-    0x21, 0x5C, 0x96, 0x52, 0x89, 0x2A, 0x97, 0xBE, 0x21, 0xDA, 0x19, 0x3E, 0x8B, 0x55, 0xCE, 0xF6,
-    0x4E, 0xE9, 0x5E, 0xBC, 0xBF, 0xB9, 0xB2, 0xDE, 0x7F, 0x9F, 0xAD, 0xE4, 0x2B, 0x9D, 0xE9, 0x46,
-    0x41, 0x75, 0x88, 0x17, 0x84, 0x0F, 0x67, 0xAF, 0xAB, 0x65, 0x55, 0xBB, 0x5F, 0xF1, 0x5A, 0xC2,
-    0xF3, 0xC2, 0xF4, 0x2B, 0xDE, 0x6C, 0xBB, 0x71, 0xD1, 0xB3, 0xDA, 0x66, 0x98, 0x17, 0x7E, 0xEB,
-    0xAE, 0xF8, 0xB6, 0xEE, 0x5A, 0xCD, 0xC5, 0xA0, 0x9B, 0x6E, 0xE8, 0xAE, 0x68, 0x4C, 0x25, 0x1D,
-    0xFF, 0xB8, 0xEE, 0x4A, 0xBA, 0xD8, 0x9B, 0x0D, 0xAF, 0x06, 0x99, 0xAD, 0x48, 0x24, 0x8F, 0x5C,
-    0xA0, 0x6C, 0xB8, 0xCC, 0xAF, 0x05, 0xB0, 0xB4, 0x68, 0x24, 0x3A, 0x3B, 0x3A, 0xB8, 0x0C, 0xDE,
-    0x51, 0x8C, 0xE4, 0x9D, 0xAC, 0x74, 0xE3, 0x12, 0xB1, 0x01, 0x1F, 0xC9, 0x95, 0x43, 0xDC, 0x5B,
-    0xAE, 0x04, 0x94, 0x89, 0x13, 0xFD, 0xF7, 0xC1, 0x89, 0xB5, 0x5F, 0xC8, 0x95, 0xC8, 0xBA, 0x75,
-    0x2F, 0x2D, 0x78, 0x59, 0x54, 0x65, 0x63, 0x3A, 0x4A, 0xAE, 0xD7, 0x2D, 0x99, 0xD0, 0xCB, 0xAB,
-    0x62, 0x93, 0x3D, 0x70, 0x9F, 0x73, 0xE3, 0xCC, 0x71, 0x4C, 0xAE, 0x95, 0x48, 0x27, 0x02, 0x73,
-    0x2B, 0xB0, 0xE3, 0xA3, 0xC1, 0xAB, 0x58, 0x5F, 0xD3, 0x72, 0xB4, 0x75, 0x0A, 0x06, 0x40, 0xEB,
-    0x6D, 0x8B, 0x9C, 0x7B, 0xF1, 0x7E, 0x65, 0x0E, 0x43, 0x56, 0xC5, 0x9E, 0x85, 0x32, 0x42, 0xE5,
-    0x32, 0x3C, 0xE7, 0x09, 0x2A, 0xBF, 0x84, 0xB0, 0xD8, 0x6C, 0x6F, 0x7F, 0xDB, 0x2B, 0xE7, 0xC1,
-    0xCD, 0x28, 0x78, 0x85, 0x8D, 0x1F, 0x93, 0x39, 0x80, 0xD1, 0x6E, 0x45, 0xDA, 0xAB, 0x1B, 0x4B,
-    0xB8, 0x56, 0x34, 0x8B, 0x89, 0xCE, 0x3A, 0xB3, 0x0E, 0xB6, 0x2C, 0xC6, 0x51, 0x0C, 0xAF, 0xBD,
-    0xB0, 0xD8, 0xE8, 0x8C, 0xFA, 0x50, 0x19, 0xAC, 0x51, 0xC6, 0x2A, 0x86, 0x0D, 0x58, 0x0C, 0x83,
-    0x46, 0x5A, 0x2C, 0x84, 0xD1, 0xA6, 0x91, 0xB2, 0x5B, 0x17, 0x2E, 0x82, 0x8E, 0x6B, 0x44, 0x4C,
-    0x21, 0x63, 0xCA, 0x52, 0x21, 0x5F, 0x47, 0x53, 0x43, 0x50, 0x02, 0x9A, 0x06, 0x9A, 0x33, 0xAE,
-    0x61, 0x22, 0x44, 0xD3, 0x12, 0x08, 0xF4, 0x65, 0x66, 0x6E, 0x60, 0x5D, 0xC9, 0x76, 0x54, 0xBE,
-    0x2E, 0xC1, 0x61, 0xF3, 0xEE, 0x59, 0xEC, 0x34, 0x1C, 0x81, 0xF8, 0xA6, 0xDF, 0xC1, 0x2F, 0x66,
-    0xD0, 0xC4, 0xD8, 0x20, 0x1A, 0x28, 0x94, 0xA4, 0xA1, 0xE0, 0x1E, 0x5B, 0x99, 0xA1, 0x93, 0x41,
-    0xC9, 0x2C, 0xA7, 0xD6, 0x89, 0x43, 0xDA, 0x53, 0x06, 0xB6, 0x4F, 0x9E, 0xB6, 0xBB, 0xB5, 0xFF,
-    0x24, 0xFF, 0xCA, 0xD0, 0x1F, 0x18, 0x1D, 0x40, 0x20, 0x87, 0x9F, 0x99, 0x4C, 0x8C, 0x3A, 0xD6,
-    0x2B, 0xCB, 0x55, 0x55, 0x92, 0xC3, 0xCE, 0xD3, 0xC7, 0xD8, 0x4D, 0x3E, 0x5F, 0xD6, 0x53, 0x59,
-    0x0F, 0x99, 0x58, 0x03, 0x45, 0x1B, 0x98, 0x6C, 0xC8, 0x51, 0xD1, 0x90, 0xE5, 0xD9, 0xF4, 0xD1,
-    0xD0, 0xA3, 0x11, 0x17, 0x4B, 0x97, 0xED, 0xB8, 0x32, 0x06, 0x3F, 0x74, 0x87, 0x52, 0x07, 0x52,
-    0x05, 0x86, 0x84, 0x7E, 0x10, 0xDF, 0x7E, 0x2A, 0x4D, 0xA8, 0x13, 0x7F, 0x00, 0xE1, 0x63, 0xB1,
-    0x44, 0xF4, 0x1D, 0xA4, 0x2E, 0xCE, 0xE7, 0xE4, 0xC1, 0x17, 0x8D, 0x07, 0x66, 0xEE, 0x71, 0xFA,
-    0xCC, 0x9E, 0xCC, 0x7B, 0xBD, 0xE0, 0x31, 0xB1, 0x34, 0x44, 0x28, 0xBE, 0x7F, 0x92, 0x63, 0xDB,
-    0xBB, 0x5D, 0x5C, 0xF2, 0x74, 0x75, 0x3C, 0x76, 0xDA, 0x29, 0x91, 0x77, 0x5D, 0x13, 0x9F, 0xA0,
-    0xA4, 0xD9, 0x2E, 0x4B, 0x79, 0xD5, 0xF8, 0x98, 0xC3, 0x29, 0x57, 0x12, 0xD2, 0x73, 0xB8, 0xF8,
-    0x90, 0xD7, 0xFE, 0xC6, 0xFD, 0x09, 0x2D, 0x6A, 0x77, 0x7F, 0x9B, 0xA0, 0x35, 0x53, 0x23, 0x6F,
-    0x1B, 0x8D, 0x84, 0x80, 0x45, 0x0D, 0xC1, 0x02, 0xDA, 0x16, 0xF4, 0x5C, 0xEE, 0x0B, 0x7F, 0x42,
-    0x92, 0x92, 0xC6, 0xE6, 0x40, 0xC7, 0x6B, 0x1F, 0x41, 0xE9, 0xB3, 0x31, 0xA1, 0x52, 0x77, 0x05,
-    0x23, 0x96, 0x9C, 0x1A, 0xB9, 0x77, 0x67, 0xF4, 0x66, 0x46, 0x48, 0xE3, 0xCD, 0x1A, 0x4A, 0x19,
-    0x23, 0xDF, 0x45, 0xA0, 0x87, 0xB8, 0x9A, 0x98, 0x9F, 0x13, 0x0F, 0x5A, 0x54, 0x43, 0x7A, 0x1E,
-    0xBA, 0x8B, 0xCC, 0x9D, 0xF3, 0xCE, 0x82, 0x81, 0x3B, 0x16, 0x75, 0x74, 0xF0, 0x0D, 0x51, 0xEF,
-    0xEE, 0x5E, 0x54, 0x28, 0xCE, 0xA4, 0xC7, 0x63, 0xAF, 0x09, 0xCB, 0xF1, 0xFB, 0x6A, 0x9B, 0x16,
-    0x37, 0x4A, 0x7A, 0x66, 0xC4, 0x07, 0x67, 0xF6, 0xA6, 0x95, 0xB6, 0x71, 0x07, 0x5F, 0xC2, 0x52,
-    0x76, 0x37, 0xD4, 0x9F, 0x51, 0xD2, 0x6F, 0xC2, 0x4F, 0x5F, 0xF3, 0xFE, 0x47, 0x81, 0x88, 0xD0,
-    0x2C, 0xEF, 0xF5, 0x2D, 0xF1, 0xFB, 0x98, 0xFC, 0x75, 0xD0, 0x50, 0x89, 0xA1, 0xA0, 0x61, 0x65,
-    0x91, 0x20, 0xBC, 0x02, 0xC2, 0x81, 0xC4, 0x37, 0x81, 0xDF, 0x77, 0xEF, 0x77, 0xFF, 0x5F, 0x14,
-    0xEC, 0xBC, 0xA8, 0xDA, 0x42, 0x48, 0xE3, 0x0F, 0xF3, 0x38, 0x67, 0x5D, 0xDA, 0xA6, 0x6F, 0xC0,
-    0x72, 0x5F, 0x6F, 0x8E, 0x11, 0xB7, 0x89, 0x70, 0x4A, 0x95, 0x71, 0x9B, 0x73, 0xA1, 0x38, 0x6F,
-    0x3C, 0x27, 0xC7, 0xDF, 0xE3, 0xD7, 0xC0, 0x1F, 0xD2, 0x1E, 0x3E, 0x69, 0x02, 0x91, 0xBD, 0x8B,
-    0xDB, 0x75, 0x97, 0x0D, 0x29, 0xA0, 0x27, 0xFE, 0x06, 0xC0, 0x9A, 0x2E, 0xE9, 0x03, 0xE6, 0x5F,
-    0x37, 0xB5, 0x95, 0x0B, 0x17, 0xF6, 0x78, 0x6F, 0xAA, 0x04, 0x1E, 0x18, 0x55, 0x98, 0x6B, 0xF8,
-    0x9D, 0xFC, 0x2F, 0xE6, 0x7C, 0x6D, 0x63, 0x0F, 0x1C, 0x3F, 0xF8, 0x5C, 0x35, 0xEF, 0x2F, 0x3E,
-    0xB3, 0x74, 0xB6, 0x0F, 0x16, 0x0F, 0x9A, 0x63, 0xDE, 0x40, 0xCA, 0xC8, 0x50, 0x4F, 0x49, 0x14,
-    0xDA, 0x29, 0x2D, 0x71, 0xB4, 0xB1, 0x26, 0x1B, 0x76, 0x3E, 0xF9, 0x96, 0xFA, 0x87, 0xAB, 0xF9,
-    0x00, 0xBF, 0xC8, 0x2C, 0xA1, 0xBF, 0xBC, 0x69, 0x11, 0xC9, 0x72, 0xCB, 0xF2, 0x83, 0x69, 0x43,
-    0x15, 0xDF, 0xAA, 0xC1, 0xD8, 0x65, 0xD9, 0x1A, 0x16, 0x92, 0x46, 0x78, 0x37, 0xC5, 0xC3, 0xF0,
-    0x6E, 0x6B, 0xF3, 0x7A, 0xA9, 0x11, 0xC6, 0xB7, 0xFD, 0x13, 0xFB, 0x6F, 0xB7, 0x35, 0x65, 0xAE,
-    0xFA, 0xCC, 0x90, 0xCB, 0x91, 0xA5, 0x72, 0x16, 0x47, 0xF9, 0x5C, 0x6C, 0x41, 0xD6, 0x15, 0x43,
-    0x8C, 0xA7, 0xBF, 0xCE, 0x5C, 0xC8, 0xC9, 0xF9, 0x27, 0xC8, 0x07, 0x4B, 0xAE, 0xE5, 0x4E, 0x4E,
-    0x98, 0xF9, 0x30, 0xCF, 0x50, 0x5D, 0x51, 0xF9, 0x5A, 0x0E, 0xAE, 0x56, 0x75, 0x84, 0x81, 0x35,
-    0x11, 0xC9, 0x9A, 0x1F, 0x09, 0xED, 0x79, 0x99, 0x89, 0x5E, 0x5C, 0xFE, 0xA5, 0xEF, 0x74, 0xF9,
-    0x7B, 0xBE, 0xD5, 0xE5, 0xD8, 0x37, 0xBC, 0x3C, 0x32, 0x67, 0xC0, 0xCC, 0x6D, 0xE2, 0xBF, 0xC2,
-    0xCB, 0x75, 0xEA, 0x9F, 0xD4, 0x40, 0x99, 0xD7, 0x65, 0x6C, 0x0F, 0x5D, 0xE6, 0xB2, 0x35, 0x8F,
-    0xB7, 0x79, 0x02, 0x2E, 0xC5, 0xE6, 0xD1, 0x65, 0x92, 0x13, 0xC0, 0xF7, 0x87, 0x02, 0x44, 0x13,
-    0xE6, 0x55, 0x56, 0x93, 0xAE, 0x3A, 0xA6, 0xC6, 0xC7, 0x4B, 0x4C, 0xF4, 0x50, 0x7E, 0x9C, 0x6A,
-    0x7A, 0x6E, 0x09, 0x93, 0x0C, 0xE5, 0xF8, 0x61, 0x41, 0x77, 0x06, 0x2E, 0x97, 0x54, 0xE2, 0x12,
-    0x61, 0x04, 0xE5, 0xBD, 0x0C, 0x3A, 0xE7, 0x0F, 0xAD, 0xE8, 0xB2, 0x09, 0x82, 0x86, 0x25, 0xF8,
-    0xC1, 0x58, 0x2A, 0x82, 0x85, 0xAA, 0x25, 0x02, 0xF2, 0x31, 0xFD, 0x20, 0x20, 0x08, 0x20, 0x92,
-    0x28, 0x54, 0x1A, 0x84, 0x12, 0xBD, 0x45, 0x5B, 0xD5, 0xE6, 0x4D, 0x40, 0xA3, 0x78, 0x97, 0xB7,
-    0x49, 0x6F, 0xC2, 0x8D, 0xD5, 0xA0, 0x00, 0xC8, 0xF7, 0xF6, 0xC6, 0x3A, 0x13, 0x18, 0xD1, 0x80,
-    0xA5, 0x84, 0x06, 0x91, 0x82, 0x2A, 0x72, 0xE6, 0x6D, 0x65, 0x71, 0x0C, 0x97, 0xA5, 0x06, 0x06,
-    0x89, 0x51, 0x48, 0xFC, 0x87, 0x36, 0x45, 0x97, 0x85, 0x17, 0x86, 0xEB, 0x22, 0x83, 0xD4, 0xD9,
-    0x7C, 0x22, 0x41, 0x61, 0x69, 0x25, 0xB7, 0xB6, 0x80, 0x7C, 0x95, 0xBB, 0xFB, 0x94, 0x13, 0x9F,
-    0x33, 0x41, 0x6F, 0x82, 0x65, 0xC3, 0xF8, 0x0B, 0x4A, 0x7D, 0xD5, 0x40, 0x5E, 0xA9, 0xE8, 0x77,
-    0x56, 0x26, 0xC8, 0x5D, 0x39, 0x61, 0xAF, 0xEF, 0x2B, 0x4E, 0x9C, 0x2B, 0x1F, 0x3C, 0xB6, 0x1D,
-    0x01, 0x3C, 0x86, 0xF0, 0xA5, 0xD2, 0x05, 0xC1, 0x60, 0xAA, 0xF1, 0xAB, 0x0C, 0xC7, 0xFD, 0xB1,
-    0x2D, 0xA4, 0x0B, 0x88, 0xDA, 0xA4, 0x0B, 0x4F, 0xF0, 0x96, 0xC8, 0x7F, 0xD5, 0xA0, 0xA9, 0xDE,
-    0x18, 0x49, 0x98, 0x29, 0x79, 0xF0, 0x7E, 0x64, 0x01, 0x9C, 0xEF, 0x47, 0x01, 0x51, 0x52, 0x66,
-    0x9C, 0xFA, 0xAA, 0x4B, 0xC6, 0xB5, 0x4F, 0x2C, 0xC9, 0x69, 0xF6, 0x7E, 0xB2, 0xD8, 0x28, 0x11,
-    0xB4, 0x80, 0x3B, 0x9B, 0x70, 0xCF, 0xB4, 0xF6, 0x6B, 0x04, 0x68, 0xCD, 0x35, 0xB7, 0x6E, 0xB0,
-    0x35, 0x9A, 0xBB, 0x70, 0x7B, 0xE5, 0xF7, 0x57, 0xA5, 0x0A, 0x89, 0x9F, 0x1A, 0xC4, 0x94, 0xA3,
-    0x49, 0x6F, 0x9E, 0x6F, 0x4D, 0xA2, 0xB7, 0x92, 0x68, 0x68, 0xE1, 0x4A, 0xA8, 0x4C, 0xED, 0xC4,
-    0x80, 0x0D, 0xA4, 0x95, 0x55, 0xCF, 0x37, 0x06, 0xA0, 0xAB, 0xB1, 0x82, 0xD7, 0xC0, 0x5B, 0x0A,
-    0x34, 0x5A, 0xAF, 0xC6, 0xC8, 0xBF, 0x0C, 0xDF, 0x02, 0xD7, 0xDC, 0x15, 0xE3, 0x8A, 0x55, 0xBB,
-    0x84, 0x89, 0xE5, 0x04, 0x17, 0x5F, 0xA1, 0xE3, 0xAC, 0xFD, 0x6D, 0xBA, 0x89, 0x36, 0xE3, 0x5E,
-    0xF6, 0xBD, 0xB6, 0x74, 0x36, 0x2A, 0xB6, 0x07, 0xAB, 0x19, 0xC4, 0x25, 0xAC, 0x02, 0x0D, 0x16,
-    0x5D, 0xFB, 0xB7, 0x2B, 0x16, 0x79, 0xE4, 0x56, 0x43, 0x95, 0x2C, 0x9D, 0xBB, 0xBA, 0x52, 0x14,
-    0xF7, 0x3E, 0xB7, 0x7B, 0x60, 0x4E, 0x76, 0x69, 0x7C, 0x58, 0x8C, 0x26, 0xCB, 0x93, 0x6E, 0x1B,
-    0xBF, 0x50, 0xE0, 0x8D, 0xDB, 0x76, 0x83, 0x30, 0x24, 0x5D, 0xF6, 0xCA, 0xEE, 0x69, 0x3E, 0xF6,
-    0x42, 0x0E, 0x1F, 0xFB, 0xD9, 0xA5, 0xC1, 0x02, 0x28, 0x19, 0x8C, 0xF0, 0x6F, 0xC8, 0x67, 0xC2,
-    0x99, 0x29, 0x1B, 0xD0, 0x3B, 0xD3, 0x8F, 0x5C, 0xE0, 0xFD, 0xF7, 0xF4, 0x75, 0x33, 0x51, 0xAE,
-    0xE4, 0x21, 0x73, 0x15, 0x55, 0x27, 0xD0, 0x21, 0xD4, 0x46, 0x99, 0x34, 0x64, 0xFF, 0x3B, 0xE4,
-    0x5A, 0xBC, 0xB4, 0x66, 0x64, 0x4B, 0x58, 0x5F, 0x2C, 0x41, 0xC2, 0xD9, 0xCD, 0xDE, 0x59, 0xD8,
-    0xB3, 0xEA, 0xEF, 0xF0, 0xAF, 0xC5, 0x78, 0x32, 0xBF, 0x1B, 0x2F, 0x89, 0x98, 0x05, 0xB6, 0x7C,
-    0xC0, 0xFD, 0x99, 0x30, 0xC7, 0x02, 0x44, 0x8D, 0x2B, 0x23, 0x3B, 0x2D, 0x68, 0xA3, 0xB7, 0x92,
-    0x94, 0x4A, 0x05, 0x81, 0x0F, 0x96, 0x22, 0x5F, 0xA4, 0xCA, 0x46, 0xEB, 0x3E, 0xFE, 0x67, 0xA2,
-    0x39, 0xA6, 0x37, 0x53, 0x30, 0x59, 0xE9, 0x5B, 0xE9, 0xB8, 0xD8, 0xAF, 0x2D, 0xD1, 0xA2, 0x78,
-    0x13, 0x10, 0x25, 0xB4, 0xAE, 0x11, 0x55, 0x6E, 0xEE, 0xC9, 0x0D, 0x9C, 0x67, 0xD8, 0x52, 0x58,
-    0x5A, 0xE8, 0x97, 0x5E, 0xD6, 0x96, 0x71, 0x06, 0x30, 0xFE, 0x9C, 0xC7, 0x4A, 0x4B, 0xFF, 0x5E,
-    0xB9, 0xD1, 0x6D, 0xB9, 0xB1, 0x61, 0x4E, 0xD1, 0xA9, 0xF0, 0xC3, 0x06, 0x25, 0x1A, 0x6A, 0x05,
-    0x43, 0xBD, 0x3E, 0xA6, 0x7E, 0x16, 0x1B, 0x96, 0xFC, 0x55, 0x78, 0x9C, 0x9B, 0xD3, 0xF2, 0x03,
-    0xC4, 0xBA, 0xF6, 0xFA, 0xA8, 0x61, 0x33, 0xDB, 0x30, 0x06, 0x48, 0x2D, 0x31, 0xB5, 0x5A, 0xE0,
-    0x89, 0x6D, 0x29, 0xE3, 0x65, 0xB0, 0x7F, 0x1A, 0x57, 0xF0, 0xFF, 0xA2, 0x1A, 0xB4, 0xA8, 0x29,
-    0xB5, 0x12, 0x87, 0x03, 0x1B, 0x6B, 0x58, 0xF0, 0x43, 0x20, 0xA8, 0xD4, 0x18, 0xE3, 0x1B, 0xE5,
-    0xE9, 0xBD, 0x1A, 0xB5, 0x40, 0x2A, 0x2B, 0x87, 0xB0, 0x9C, 0xA9, 0xA8, 0xAB, 0x29, 0x85, 0xC8,
-    0x3F, 0xAF, 0xCC, 0x8C, 0x2F, 0x2C, 0x08, 0x9F, 0x4C, 0x7B, 0x3B, 0xB7, 0xCD, 0x87, 0x6D, 0xF6,
-    0xB9, 0x9D, 0xB3, 0x60, 0x7D, 0x83, 0xBE, 0xB3, 0x53, 0x2E, 0xA5, 0xB2, 0x00, 0x89, 0x7C, 0xE4,
-    0xD2, 0xA6, 0x15, 0xCA, 0x21, 0x51, 0xC3, 0x85, 0x3B, 0x96, 0x6E, 0x3A, 0xB7, 0x6B, 0xB3, 0x79,
-    0x4B, 0x9D, 0xFD, 0x30, 0x97, 0x3E, 0xCD, 0xA6, 0x4D, 0xA5, 0xB8, 0x58, 0x87, 0x5C, 0x51, 0x19,
-    0xCF, 0xB4, 0xE5, 0x99, 0xE2, 0x27, 0x36, 0x0A, 0xF6, 0x21, 0x93, 0xA5, 0x0D, 0x4E, 0xC7, 0xC7,
-    0xA7, 0xE1, 0x57, 0x70, 0x3A, 0x61, 0x92, 0xF2, 0x33, 0x10, 0x48, 0xE6, 0x2D, 0xBE, 0xC1, 0xFD,
-    0xA1, 0x67, 0x04, 0x18, 0x4B, 0xCB, 0xB2, 0x41, 0xEE, 0x9C, 0xD9, 0xBD, 0x13, 0x94, 0x48, 0x3A,
-    0xFB, 0x56, 0x90, 0xB0, 0x8E, 0xBF, 0xC1, 0xDC, 0x28, 0x7C, 0xC9, 0xCC, 0xF2, 0x06, 0x29, 0xA0,
-    0xAB, 0xE4, 0x9E, 0x60, 0xF5, 0xD1, 0xB3, 0x93, 0xCE, 0x65, 0xAD, 0x63, 0xEF, 0x40, 0xC7, 0x7A,
-    0x6B, 0xD1, 0xF2, 0x72, 0xC1, 0xBD, 0x51, 0xE3, 0xC8, 0x46, 0x38, 0x56, 0x39, 0xC7, 0x58, 0xDD,
-    0x60, 0xA1, 0xDC, 0x76, 0xCD, 0xB9, 0x2A, 0x08, 0xAD, 0x51, 0x9B, 0x12, 0x83, 0x1A, 0xD0, 0xD9,
-    0xAC, 0xB8, 0xCE, 0x91, 0xDB, 0x0C, 0x6B, 0x4D, 0xE9, 0xDB, 0x3A, 0x6A, 0x57, 0x3A, 0xAE, 0xFC,
-    0xCB, 0x1D, 0x26, 0xAC, 0x3A, 0x78, 0x37, 0x5C, 0x28, 0x6A, 0xDF, 0x14, 0x1E, 0x9C, 0x6D, 0x8B,
-    0x25, 0x51, 0xDA, 0xA9, 0x6C, 0xEE, 0x82, 0xA7, 0xD9, 0x15, 0x28, 0xB9, 0x94, 0x4B, 0xDB, 0xC1,
-    0x52, 0x9F, 0xAE, 0x8E, 0x9B, 0x0C, 0x49, 0x94, 0x53, 0x13, 0xD8, 0x3D, 0x85, 0xC9, 0xF3, 0x6E,
-    0xE9, 0x3D, 0x2A, 0xBC, 0x3A, 0xB6, 0xA8, 0xCF, 0x87, 0x97, 0xBC, 0x1A, 0x24, 0x6A, 0x84, 0x10,
-    0x18, 0xA5, 0x72, 0xAA, 0x4D, 0xA8, 0x2D, 0xEF, 0xAF, 0x54, 0x7A, 0xB5, 0x60, 0x75, 0x29, 0xEC,
-    0x66, 0x33, 0xDB, 0x00, 0x01, 0xAF, 0xD8, 0xF0, 0x94, 0x82, 0xDC, 0x86, 0xCC, 0x98, 0x2F, 0xF9,
-    0xB7, 0x64, 0x22, 0x5E, 0x61, 0xDE, 0x03, 0xEB, 0xAE, 0xF1, 0xA3, 0xA7, 0xDD, 0xEE, 0x36, 0x07,
-    0xAA, 0x82, 0xAA, 0xD9, 0x46, 0x29, 0x8F, 0xAC, 0x65, 0xD6, 0x5A, 0x29, 0x7B, 0x53, 0xFE, 0x7A,
-    0xF1, 0x8F, 0x80, 0xDA, 0x7F, 0xDE, 0xEE, 0x47, 0xED, 0x06, 0x15, 0x10, 0xB2, 0xEF, 0xB1, 0x9D,
-    0xAD, 0x61, 0xF5, 0xBD, 0x8D, 0x5B, 0x17, 0x75, 0x41, 0x7F, 0xE7, 0x36, 0xDD, 0x73, 0xD6, 0xD7,
-    0xA0, 0x36, 0x3E, 0x2A, 0x7E, 0x13, 0xF8, 0xB7, 0x2A, 0x08, 0xBA, 0x85, 0xDA, 0x26, 0xFD, 0x8A,
-    0x58, 0xC7, 0x24, 0x24, 0x6A, 0x99, 0x37, 0x4F, 0xBD, 0xF2, 0x57, 0xEA, 0x78, 0x02, 0xB5, 0x9E,
-    0x9D, 0x89, 0xD9, 0x80, 0x3B, 0x93, 0xE9, 0x98, 0xDA, 0xC3, 0xCA, 0xBF, 0x20, 0xF4, 0xF9, 0xA4,
-    0xF7, 0x17, 0x59, 0xA1, 0xC7, 0xBA, 0x83, 0x6F, 0x30, 0x57, 0x9C, 0xE6, 0x1F, 0xE3, 0xA6, 0x4C,
-    0x72, 0x50, 0xF8, 0xDF, 0xAD, 0x95, 0xD7, 0xC2, 0x8E, 0x24, 0x3F, 0x12, 0x8D, 0xA7, 0x78, 0xE4,
-    0x9D, 0x5C, 0xA8, 0x36, 0xB7, 0xF6, 0x04, 0xA6, 0x20, 0x60, 0xDE, 0xBF, 0xCE, 0xC0, 0xBE, 0x64,
-    0xA3, 0x14, 0xD9, 0xB2, 0xEE, 0x2C, 0x15, 0x4D, 0x3A, 0x03, 0x8E, 0x54, 0x59, 0xBE, 0x40, 0x25,
-    0x75, 0x82, 0xBA, 0x36, 0xE5, 0xEE, 0x23, 0x03, 0xFB, 0x63, 0x3A, 0x7F, 0xEC, 0xE7, 0x3D, 0x41,
-    0xC1, 0x94, 0x5D, 0x51, 0x30, 0x6B, 0x58, 0x31, 0x3C, 0xE5, 0x17, 0x5D, 0x40, 0x5F, 0x10, 0xA8,
-    0xE0, 0x55, 0x74, 0x15, 0x77, 0x0E, 0xF6, 0x4E, 0x38, 0x85, 0xD3, 0x69, 0x78, 0x41, 0xC6, 0x53,
-    0xC8, 0x54, 0x99, 0x3D, 0x7C, 0x4C, 0xE6, 0xCF, 0xFB, 0x1A, 0xFA, 0xEC, 0xBB, 0x80, 0xBC, 0x70,
-    0x69, 0x2D, 0x19, 0x8B, 0xC4, 0x1D, 0x70, 0x4D, 0xA5, 0x7B, 0xAE, 0xC3, 0xD2, 0x8C, 0x31, 0x3B,
-    0x7A, 0x68, 0x43, 0x36, 0x32, 0x16, 0x89, 0xFE, 0x3F, 0xFC, 0xE1, 0x13, 0xC2, 0xCA, 0x95, 0xBF,
-    0xE5, 0x81, 0x84, 0x09, 0x42, 0xCF, 0xE6, 0x34, 0xB4, 0xC1, 0xB7, 0x36, 0xB1, 0x62, 0x38, 0x13,
-    0xBD, 0x0F, 0x2C, 0x3A, 0x5D, 0x63, 0x6B, 0x4F, 0x9A, 0x5F, 0x63, 0xC1, 0x2E, 0x53, 0x85, 0x55,
-    0x45, 0x18, 0x6E, 0xB5, 0x97, 0xF2, 0x3F, 0xA8, 0x5A, 0x9E, 0xD1, 0xB4, 0x01, 0x21, 0x03, 0xB9,
-    0x6A, 0xE5, 0x23, 0x65, 0x48, 0x19, 0x29, 0x7C, 0xDE, 0x4F, 0x17, 0xFD, 0xA7, 0x20, 0x4A, 0x26,
-    0x50, 0x53, 0xE9, 0x1B, 0xB4, 0x85, 0x34, 0x24, 0x2A, 0xE7, 0x7C, 0xF9, 0xF3, 0xEC, 0xF8, 0xB0,
-    0xD2, 0x8D, 0x65, 0xC4, 0xD4, 0x6E, 0x76, 0xF4, 0x6F, 0x60, 0xDE, 0x6D, 0x8B, 0x89, 0x1A, 0x75,
-    0x34, 0x67, 0x43, 0x40, 0xDD, 0x67, 0x2F, 0x23, 0x49, 0x2F, 0x06, 0xC7, 0xE9, 0x3E, 0xED, 0x7F,
-    0xCC, 0xA9, 0x06, 0xA9, 0xA2, 0xF7, 0x5F, 0xB6, 0x86, 0xC5, 0x8E, 0x55, 0x35, 0x3A, 0xA3, 0xDD,
-    0x17, 0x10, 0x82, 0xEF, 0x2D, 0x4A, 0x56, 0x28, 0x12, 0xF0, 0x5A, 0x6C, 0xE4, 0x6F, 0x62, 0x0D,
-    0x6D, 0xC2, 0x6A, 0x27, 0xEC, 0x58, 0xB9, 0xEE, 0xE1, 0x61, 0xBF, 0xC8, 0x3C, 0xB4, 0x1A, 0xE2,
-    0x04, 0x0E, 0x08, 0x3B, 0xD8, 0xDD, 0xA1, 0xED, 0x16, 0x5A, 0x15, 0xBA, 0x71, 0xFF, 0x40, 0x8D,
-    0xA2, 0x74, 0x1B, 0x31, 0xAD, 0xA0, 0xB3, 0xF8, 0xD0, 0x7F, 0x2D, 0xFC, 0x67, 0x8B, 0x8E, 0x0A,
-    0x30, 0x9F, 0x98, 0x97, 0xA6, 0x9D, 0x6D, 0x53, 0x09, 0x8D, 0x49, 0xD8, 0x9F, 0x6C, 0xEC, 0x7E,
-    0x76, 0x69, 0xE7, 0x31, 0xA8, 0xCF, 0xE2, 0xB5, 0x1D, 0xD4, 0x95, 0xA2, 0xDE, 0xF4, 0xF7, 0xDF,
-    0xB3, 0x51, 0xD6, 0x7E, 0x30, 0xFD, 0xE2, 0xE4, 0x81, 0xFF, 0xA1, 0x1F, 0x62, 0x26, 0xDA, 0x2B,
-    0xEC, 0xEA, 0x1B, 0xF4, 0x0A, 0x4F, 0xC1, 0xD9, 0x92, 0x03, 0xFE, 0x17, 0xDB, 0x14, 0xB5, 0xC4,
-    0xAD, 0x9D, 0xE3, 0x9B, 0xC5, 0x41, 0x32, 0x98, 0xF8, 0x70, 0x82, 0x20, 0xBC, 0xCB, 0x16, 0x86,
-    0x4F, 0x64, 0x3E, 0xFC, 0xD1, 0x3F, 0xED, 0x6D, 0xD2, 0x31, 0xEC, 0x8B, 0x77, 0xF2, 0xCE, 0x6A,
-    0x8F, 0xEA, 0x96, 0x66, 0x29, 0xD9, 0x75, 0xE5, 0xFF, 0xFE, 0xEE, 0x0F, 0x43, 0xDC, 0x97, 0x36,
-    0xBD, 0x08, 0x4C, 0x1A, 0xAC, 0xD4, 0xE3, 0xF4, 0x26, 0x63, 0xB0, 0x68, 0x60, 0x29, 0xBB, 0x63,
-    0x21, 0xA3, 0xBC, 0xCB, 0x00, 0xAA, 0xBD, 0x9F, 0x26, 0x43, 0x9B, 0xB2, 0xB8, 0x55, 0xB0, 0xC1,
-    0x9A, 0xDA, 0x88, 0xED, 0x4F, 0x27, 0xFA, 0x2A, 0x89, 0xBB, 0xE8, 0x2D, 0x37, 0xCE, 0x46, 0x5B,
-    0x12, 0xB7, 0xB1, 0x88, 0xC2, 0x87, 0x06, 0xA5, 0x7A, 0xB7, 0x1B, 0xE9, 0xD9, 0x00, 0xAA, 0xF6,
-    0x62, 0xA8, 0x08, 0x1C, 0x3E, 0xF7, 0x02, 0x6B, 0xBD, 0x2F, 0xC1, 0xC7, 0xB1, 0x43, 0x6F, 0x84,
-    0x7B, 0xF7, 0x2D, 0xB0, 0x80, 0x35, 0xA3, 0xDF, 0x6B, 0x4E, 0x52, 0xDF, 0xDA, 0xAE, 0xAB, 0xA4,
-    0xA9, 0x9F, 0x45, 0x14, 0xD9, 0xB1, 0xDE, 0x8E, 0xD1, 0x62, 0x72, 0x88, 0xD0, 0xE9, 0x16, 0x89,
-    0x78, 0x7D, 0x53, 0x35, 0x19, 0xAB, 0x6E, 0xB1, 0x2F, 0xD2, 0xD0, 0xD8, 0x2F, 0xC0, 0xE8, 0x0B,
-    0x85, 0x3F, 0x22, 0xF0, 0xC2, 0xAA, 0x6C, 0xAF, 0x73, 0xA1, 0x3B, 0xDF, 0xCA, 0x19, 0x69, 0x07,
-    0x9D, 0x7A, 0xAD, 0x00, 0x09, 0xD8, 0x04, 0x02, 0x9E, 0xAA, 0xF4, 0x7B, 0x67, 0xAE, 0x6D, 0x97,
-    0x69, 0x02, 0xB6, 0xE8, 0xB9, 0x4B, 0xE4, 0x83, 0x92, 0xC2, 0xEC, 0xAB, 0xFF, 0x35, 0x5F, 0x20,
-    0xE3, 0x57, 0xD5, 0x58, 0x31, 0xAB, 0xA7, 0xEE, 0x39, 0xF5, 0x94, 0x25, 0x3D, 0x0B, 0x6E, 0xEB,
-    0x51, 0x9D, 0x61, 0x98, 0xEA, 0x2F, 0xDC, 0xEF, 0x72, 0x9E, 0xB3, 0xB5, 0x84, 0xAE, 0x80, 0xBA,
-    0x09, 0x07, 0x4F, 0x79, 0xA7, 0x4D, 0x7A, 0xA3, 0x77, 0x27, 0x73, 0x46, 0x97, 0xBC, 0x2A, 0x0F,
-    0x98, 0xE7, 0xDC, 0x6F, 0x5B, 0xCF, 0x80, 0x40, 0x9E, 0xF0, 0x6A, 0xF8, 0x2C, 0xD3, 0x32, 0x7D,
-    0x1E, 0x92, 0xF4, 0x1D, 0x26, 0x8E, 0x67, 0x15, 0xD8, 0xEE, 0x78, 0xFD, 0x6E, 0x66, 0x59, 0x06,
-    0xBB, 0xC2, 0xA7, 0x53, 0xAA, 0xFF, 0xEC, 0x37, 0x45, 0x3D, 0x01, 0xD1, 0xCA, 0xEA, 0xF8, 0xB8,
-    0x32, 0x13, 0xDD, 0xFE, 0xA5, 0xA1, 0x5A, 0x19, 0x07, 0x72, 0x21, 0x9D, 0xBD, 0x9E, 0x9F, 0x50,
-    0x75, 0xDC, 0xE7, 0xD5, 0x5C, 0x41, 0x85, 0x98, 0x7C, 0xA0, 0x33, 0xF2, 0x62, 0xDF, 0x6B, 0xC4,
-    0x87, 0xB7, 0xE8, 0xB1, 0xA6, 0x8A, 0x4E, 0xF5, 0x12, 0x9D, 0xFF, 0xEB, 0xF4, 0x09, 0xBF, 0xA0,
-    0xB9, 0x67, 0x96, 0x27, 0xC6, 0x9D, 0x39, 0x13, 0x4F, 0x4C, 0x8A, 0x14, 0xFE, 0xDF, 0x69, 0xE9,
-    0xBD, 0x0D, 0xAC, 0xE7, 0x21, 0x58, 0x5C, 0x96, 0x5D, 0xBB, 0x44, 0x87, 0x0E, 0xAF, 0xB7, 0x56,
-    0xA2, 0xEA, 0x70, 0xB2, 0x58, 0x8B, 0xDB, 0xB5, 0xAB, 0xB8, 0x43, 0x3E, 0x62, 0xFD, 0x7E, 0xA7,
-    0xBC, 0x1E, 0xA4, 0xBE, 0xEF, 0xC2, 0xDE, 0xB3, 0x70, 0x2E, 0xBF, 0x20, 0x3B, 0xAD, 0x07, 0x51,
-    0x94, 0xB7, 0x9A, 0x23, 0xE3, 0x4B, 0x6C, 0x61, 0x4E, 0xD5, 0x1B, 0x93, 0xFE, 0x2F, 0x5F, 0xC0,
-    0x8B, 0x54, 0x55, 0x97, 0x48, 0x75, 0xC7, 0x8E, 0xB3, 0x1A, 0xCE, 0x53, 0x49, 0x7B, 0xDA, 0x82,
-    0xA8, 0x13, 0xCF, 0xC9, 0x58, 0xAE, 0x45, 0xED, 0x1A, 0xD1, 0x29, 0x1B, 0x76, 0x4D, 0x45, 0x4F,
-    0xB8, 0xC1, 0x94, 0xD5, 0x4A, 0xFC, 0x65, 0xA5, 0xD7, 0x8A, 0x99, 0xD0, 0xC4, 0xB3, 0xA1, 0xC1,
-    0xF7, 0xEC, 0x0E, 0x9E, 0x0A, 0xB2, 0xFA, 0x32, 0x59, 0x7D, 0xD3, 0x58, 0x2D, 0xFE, 0x13, 0x0C,
-    0x24, 0x14, 0xCA, 0x0D, 0xCC, 0x0B, 0xCB, 0x30, 0x2A, 0x85, 0xF6, 0x96, 0x1F, 0xEC, 0x79, 0x1C,
-    0x01, 0xFD, 0xC0, 0x7A, 0x29, 0x96, 0x62, 0xBE, 0x94, 0xE3, 0xDA, 0xB6, 0x6A, 0xAF, 0x07, 0x76,
-    0xD8, 0xAA, 0x61, 0x2D, 0xAE, 0xEA, 0xDA, 0x0D, 0x44, 0xF2, 0xC7, 0xFF, 0x08, 0xA8, 0x3D, 0x97,
-    0x2F, 0x8E, 0xCF, 0xE2, 0xC7, 0x98, 0xB6, 0x72, 0xFD, 0xB3, 0x99, 0x3D, 0x9F, 0x69, 0x03, 0x07,
-    0x07, 0xB8, 0x1F, 0x8C, 0xEE, 0xD1, 0x7B, 0xF1, 0x73, 0xCA, 0x00, 0x47, 0xD1, 0x3A, 0x9F, 0x05,
-    0x02, 0x81, 0x95, 0xAF, 0xA9, 0xC6, 0xC3, 0xB1, 0x1A, 0xBF, 0xBA, 0x55, 0xE3, 0xB9, 0xDA, 0x52,
-    0xFB, 0x6B, 0xD4, 0xB8, 0x3D, 0x5D, 0x8D, 0xD7, 0xED, 0xFB, 0x49, 0x5C, 0x08, 0x43, 0xE8, 0x7F,
-    0x39, 0x30, 0x1C, 0x04, 0x89, 0xD7, 0x48, 0xF2, 0x3A, 0xF0, 0xA7, 0xD4, 0x1F, 0x84, 0x9C, 0xA1,
-    0x4C, 0x16, 0xA3, 0xAD, 0xEC, 0x41, 0xAE, 0x23, 0xF6, 0xEB, 0xC2, 0x66, 0xB7, 0x04, 0x52, 0xA3,
-    0x6C, 0xD5, 0x53, 0xF3, 0xB2, 0xDD, 0xAA, 0xA3, 0x63, 0x3A, 0x97, 0xED, 0x06, 0x18, 0xFD, 0x53,
-    0xD9, 0xB4, 0x6C, 0x42, 0xF4, 0xA6, 0xAA, 0x11, 0x70, 0xD2, 0x45, 0xC6, 0x93, 0xD6, 0x6A, 0x83,
-    0x9F, 0x25, 0x6A, 0x00, 0xFA, 0xD0, 0x0B, 0x14, 0x76, 0x5E, 0xE4, 0x6C, 0x87, 0x01, 0x22, 0x9D,
-    0x80, 0x61, 0x23, 0xAF, 0xE4, 0x47, 0x5E, 0xE5, 0xA7, 0x83, 0x66, 0x26, 0x30, 0x2D, 0xB0, 0xD7,
-    0x8A, 0x09, 0x69, 0x60, 0x63, 0x6B, 0xD6, 0xBC, 0x00, 0xB2, 0x3A, 0x4E, 0x3C, 0x65, 0xCC, 0x8A,
-    0x5E, 0xDC, 0xCA, 0xF8, 0xE8, 0x84, 0x45, 0x20, 0x82, 0xFE, 0xAE, 0xEC, 0x2C, 0x23, 0xD5, 0x41,
-    0x00, 0x2D, 0xF2, 0x87, 0xC5, 0x6C, 0xE2, 0xB0, 0x67, 0x9C, 0x0A, 0x45, 0xD0, 0x82, 0x50, 0x6E,
-    0xF3, 0x2C, 0x87, 0x42, 0x39, 0x3D, 0x06, 0xC5, 0x1D, 0xF4, 0xC9, 0x25, 0x05, 0x75, 0x70, 0x70,
-    0xF0, 0xCD, 0xBB, 0x9E, 0xE5, 0xD8, 0xBE, 0xF4, 0xAB, 0x69, 0xF3, 0x2B, 0x7E, 0x48, 0xF3, 0x0D,
-    0x8B, 0xA1, 0x05, 0x7F, 0x4D, 0x75, 0xBD, 0x2D, 0xB9, 0x41, 0xFC, 0x6F, 0x15, 0x3E, 0xA7, 0x0B,
-    0x1D, 0xA4, 0xAF, 0x00, 0x69, 0x70, 0xF2, 0x31, 0x7B, 0x74, 0x7E, 0x00, 0xC8, 0xF5, 0xCE, 0x9C,
-    0x4E, 0xEB, 0x9F, 0xFA, 0x37, 0xFC, 0x2B, 0x63, 0x82, 0x8F, 0x55, 0x40, 0x44, 0x5A, 0x03, 0xC0,
-    0xD3, 0x5B, 0x30, 0xB4, 0xCD, 0xF0, 0xB3, 0x1A, 0x7C, 0x2B, 0xFC, 0xE3, 0xA6, 0x09, 0x83, 0x3D,
-    0x00, 0x97, 0x88, 0xCF, 0xB9, 0x59, 0x34, 0xCB, 0x7D, 0x58, 0x5F, 0xAF, 0xB5, 0x43, 0xAB, 0x57,
-    0x64, 0xD3, 0xF0, 0x92, 0x0E, 0x6E, 0x79, 0x0C, 0x6E, 0xD3, 0x2B, 0xEE, 0xEE, 0xEC, 0xAC, 0x38,
-    0x76, 0x6C, 0x55, 0xB3, 0x7B, 0xB9, 0x49, 0x98, 0x00, 0xE6, 0x33, 0x2F, 0x91, 0x52, 0x43, 0x2C,
-    0xA8, 0x0A, 0xE7, 0x36, 0xC2, 0xDB, 0x3D, 0x71, 0x44, 0xAA, 0x38, 0x7B, 0xFD, 0x1B, 0x5C, 0xE8,
-    0x75, 0x61, 0xB2, 0x0B, 0x10, 0x66, 0x1E, 0x58, 0xC3, 0x84, 0x2C, 0x27, 0x84, 0x4C, 0x29, 0x63,
-    0x75, 0x3F, 0x20, 0xF2, 0x79, 0xDA, 0xD9, 0x83, 0x66, 0x16, 0x4B, 0x5B, 0x6F, 0x9A, 0x3A, 0xAD,
-    0x9D, 0xA5, 0xB3, 0x56, 0xB6, 0x04, 0x73, 0x36, 0xEA, 0x6C, 0x76, 0xA9, 0x8E, 0xAB, 0xF2, 0x8F,
-    0x78, 0x39, 0xC1, 0x15, 0xB7, 0xCD, 0x1D, 0x2C, 0xE9, 0x6F, 0x6B, 0x2B, 0xF5, 0x8A, 0xCA, 0xAB,
-    0x27, 0x14, 0x0E, 0x94, 0xAC, 0x97, 0x25, 0x75, 0xD4, 0x9C, 0xB6, 0x90, 0xB3, 0x3E, 0x3F, 0x5B,
-    0xE5, 0x88, 0x7B, 0x33, 0xC2, 0xF4, 0x1E, 0x2B, 0x8A, 0xA0, 0x5A, 0xD5, 0x6F, 0x4C, 0xF5, 0x29,
-    0x17, 0x9A, 0x13, 0xCB, 0xF1, 0x4C, 0xB5, 0x45, 0x7E, 0x93, 0xDD, 0x91, 0x95, 0xA5, 0x99, 0xC5,
-    0xDA, 0x3E, 0x8D, 0xCD, 0x84, 0x38, 0xF8, 0x02, 0x04, 0xC1, 0xE7, 0x1E, 0x96, 0x4D, 0xBC, 0xB2,
-    0x76, 0xCA, 0x42, 0xC9, 0x47, 0x3E, 0xBE, 0xFA, 0xEE, 0x15, 0xF2, 0xE0, 0x72, 0x1F, 0x7C, 0x1B,
-    0xE4, 0x4E, 0xA1, 0x9F, 0xA0, 0xBA, 0x8F, 0x63, 0x8E, 0x82, 0xCF, 0x53, 0xBC, 0x27, 0xEE, 0x77,
-    0x27, 0xB9, 0x9F, 0xEB, 0x42, 0xC7, 0xDC, 0x69, 0xA1, 0x22, 0x8D, 0x22, 0x3A, 0x3E, 0x9E, 0x7A,
-    0xA4, 0xE6, 0x81, 0x9E, 0x3D, 0xE4, 0x67, 0xF3, 0x9D, 0xBD, 0xE3, 0x16, 0xE9, 0xA4, 0x5C, 0x1E,
-    0x30, 0xD8, 0xF6, 0x8E, 0x85, 0x4B, 0x8E, 0xD0, 0x6D, 0x1E, 0x4F, 0x58, 0xA2, 0x81, 0x7B, 0x1C,
-    0xE7, 0x66, 0xEB, 0x6B, 0x09, 0xEC, 0xAD, 0xAB, 0xFC, 0x9B, 0xCA, 0x17, 0xB5, 0x6C, 0x1D, 0xAE,
-    0x5A, 0x35, 0xEC, 0x0A, 0xEF, 0x25, 0x34, 0x47, 0xE5, 0x5A, 0x6D, 0x09, 0xD4, 0x5B, 0xFA, 0x00,
-    0x21, 0x5D, 0xE5, 0x31, 0xF5, 0x2C, 0x67, 0x32, 0x5A, 0xBA, 0xF0, 0x29, 0x32, 0xAE, 0xFA, 0xC9,
-    0x28, 0x3F, 0x33, 0x5B, 0x09, 0xF1, 0xB8, 0x2A, 0x62, 0x1D, 0x74, 0x81, 0x15, 0x01, 0xB2, 0xFE,
-    0x78, 0x5F, 0x47, 0xD3, 0x71, 0x07, 0xB3, 0x02, 0xDF, 0x87, 0x2B, 0xEE, 0x0C, 0x45, 0x15, 0x8B,
-    0x8F, 0xE0, 0xD3, 0x5D, 0x5C, 0xF0, 0xE1, 0x22, 0x05, 0x39, 0x35, 0xAF, 0xA0, 0xC6, 0x00, 0x0F,
-    0x87, 0xFB, 0x92, 0x80, 0x43, 0x64, 0x77, 0x6A, 0x4C, 0x45, 0x07, 0xC1, 0xE6, 0xF4, 0x19, 0x9E,
-    0xE6, 0xC3, 0xA5, 0xC5, 0x6D, 0x2C, 0xD8, 0x5A, 0x14, 0x4D, 0x4D, 0x10, 0xA9, 0x57, 0x5E, 0x0F,
-    0xAB, 0x32, 0xA4, 0x96, 0x0F, 0x81, 0xD3, 0x6A, 0x12, 0xD6, 0xA7, 0xF2, 0x82, 0x32, 0x0A, 0xA4,
-    0x5E, 0x3A, 0x5D, 0xEB, 0xB4, 0xD2, 0x7A, 0xBC, 0x3B, 0x60, 0x4D, 0x8F, 0x51, 0x6F, 0xA2, 0xA4,
-    0x22, 0x65, 0x57, 0x06, 0x72, 0xC6, 0x91, 0x6C, 0x74, 0x32, 0xD3, 0x11, 0xDF, 0x49, 0xC9, 0x96,
-    0xC0, 0x8A, 0x15, 0xF6, 0x54, 0x4B, 0xD4, 0xCD, 0xAB, 0x03, 0xCB, 0x00, 0xF3, 0xA9, 0x4F, 0xF6,
-    0x87, 0x33, 0x38, 0xA0, 0xF7, 0xE4, 0xF5, 0x86, 0xBF, 0x3E, 0x7E, 0xFE, 0xF3, 0xB4, 0x17, 0xDB,
-    0x1E, 0x0A, 0xA2, 0xF2, 0x0E, 0x76, 0xDB, 0xF3, 0x51, 0xBB, 0x81, 0x10, 0x2E, 0xE5, 0xC2, 0xC8,
-    0x6C, 0x50, 0x19, 0xD1, 0xDB, 0xB4, 0xD4, 0x10, 0x3E, 0xA2, 0x56, 0x6A, 0x25, 0x7C, 0xA8, 0xA3,
-    0x21, 0x8C, 0xC9, 0xC6, 0x58, 0x9B, 0x42, 0xCA, 0xE4, 0x5F, 0x95, 0x2B, 0x38, 0x54, 0xCF, 0xA8,
-    0x49, 0xA1, 0x5A, 0x3A, 0x24, 0xDB, 0xE3, 0x72, 0xB9, 0x75, 0xC2, 0x5A, 0x27, 0xFB, 0xC6, 0x28,
-    0xE4, 0x5B, 0xE8, 0x26, 0x93, 0xFD, 0x81, 0xCB, 0x96, 0x1A, 0x10, 0x2A, 0xD1, 0x51, 0xA1, 0xFA,
-    0xB6, 0xE1, 0xFF, 0x7F, 0x01, 0xE5, 0x5D, 0x3F, 0xB0, 0xE5, 0xD4, 0x79, 0x3F, 0x92, 0x78, 0x4F,
-    0x04, 0xC5, 0x11, 0x05, 0x8B, 0xED, 0xDD, 0xCC, 0x28, 0x85, 0x8B, 0x0C, 0x93, 0x58, 0x29, 0x53,
-    0x24, 0x96, 0x30, 0x85, 0x0B, 0x0A, 0x5E, 0x32, 0xFB, 0xF0, 0x04, 0x17, 0xB8, 0xC0, 0x33, 0x59,
-    0x98, 0xF8, 0xB9, 0x48, 0xE1, 0xC2, 0xB6, 0x64, 0x28, 0x9C, 0x19, 0x0A, 0x6F, 0x81, 0x9D, 0xC2,
-    0x85, 0x29, 0x70, 0xC1, 0x25, 0x33, 0xEB, 0xC2, 0x85, 0x33, 0x63, 0x2C, 0xB1, 0x3B, 0x13, 0x0A,
-    0x8A, 0x15, 0x66, 0x92, 0x2D, 0x5C, 0xEC, 0x8D, 0xBD, 0x0E, 0x63, 0x28, 0x10, 0x1E, 0x61, 0xEB,
-    0xED, 0x4A, 0x3A, 0xF9, 0x7E, 0xBF, 0xEF, 0xE8, 0xDE, 0xFB, 0xDE, 0xBE, 0x85, 0x05, 0x16, 0xD8,
-    0xC5, 0xCF, 0xEC, 0xBD, 0x57, 0x57, 0xBA, 0xD2, 0xF9, 0xFE, 0x9C, 0xEF, 0xFC, 0xBE, 0x7F, 0xC7,
-    0xC6, 0xB8, 0xBF, 0xC8, 0xDA, 0x0E, 0xEF, 0xD6, 0xDA, 0x5C, 0xDE, 0x62, 0x6B, 0x5B, 0x1C, 0x2E,
-    0x16, 0x0B, 0xF3, 0x36, 0x7F, 0xD1, 0x92, 0x6F, 0xA1, 0xD5, 0x43, 0xBD, 0x85, 0x49, 0x6C, 0x8D,
-    0xB7, 0xC0, 0x0E, 0x3C, 0x2C, 0xEC, 0xD2, 0x3D, 0x41, 0x2F, 0xAA, 0x78, 0x55, 0xFA, 0xAA, 0x2D,
-    0x71, 0xD1, 0x90, 0xF1, 0xAA, 0xE2, 0xAC, 0x6D, 0xF0, 0xDC, 0x2E, 0xC1, 0x55, 0x9E, 0x35, 0x7C,
-    0x7E, 0xBA, 0x8C, 0x70, 0x55, 0x30, 0x9A, 0x02, 0x57, 0x55, 0x75, 0x80, 0xAB, 0x64, 0x70, 0x76,
-    0xC2, 0x45, 0x96, 0xA3, 0xCC, 0x2C, 0x07, 0x1D, 0xD8, 0xC5, 0xC2, 0xF6, 0xB8, 0x48, 0xC6, 0x53,
-    0x9B, 0x58, 0x3E, 0x66, 0xA3, 0x5C, 0x94, 0x1B, 0x5F, 0xAE, 0xCA, 0xE4, 0xA1, 0xA9, 0x3D, 0x9D,
-    0xC9, 0x15, 0xA9, 0xB5, 0x2F, 0x59, 0x5B, 0x87, 0xD6, 0x0E, 0xF2, 0x9F, 0xA9, 0xE4, 0xB3, 0xD9,
-    0xDD, 0xDD, 0x31, 0xFA, 0x49, 0xEE, 0xB6, 0xC4, 0x13, 0xE4, 0xFA, 0xDD, 0xDD, 0x93, 0x07, 0xC9,
-    0x3D, 0x49, 0xE2, 0x3A, 0x90, 0x24, 0xC3, 0xAA, 0x70, 0x51, 0xB1, 0xBF, 0x67, 0x4D, 0xDA, 0x07,
-    0x72, 0xBF, 0xD1, 0x54, 0xAD, 0xA9, 0x4C, 0x3A, 0x90, 0x58, 0x79, 0xF9, 0xA4, 0xDC, 0x2E, 0xC2,
-    0x10, 0x53, 0x3C, 0x07, 0xC3, 0x34, 0xD9, 0xE4, 0xDB, 0x3A, 0x9E, 0xE4, 0xCA, 0xD0, 0xE6, 0xE9,
-    0xE0, 0xD9, 0x46, 0xAE, 0x2C, 0xA6, 0x3D, 0xFB, 0x1B, 0x10, 0x65, 0x7F, 0x61, 0xED, 0x05, 0xDB,
-    0xA6, 0xB6, 0x96, 0x1F, 0x9D, 0x32, 0xDB, 0xF9, 0xFA, 0xD1, 0x41, 0x69, 0xFE, 0x06, 0xEF, 0xA3,
-    0x89, 0x29, 0x9F, 0x3E, 0x9C, 0xC5, 0xA5, 0x02, 0x20, 0xF7, 0x64, 0xDC, 0x2A, 0x90, 0xED, 0x9D,
-    0x8F, 0xB7, 0xB8, 0xEE, 0xC4, 0x18, 0xBE, 0x61, 0x82, 0xDC, 0x64, 0x75, 0x20, 0xE2, 0x9A, 0xBE,
-    0xD4, 0xE1, 0xFE, 0x3D, 0x7E, 0xD4, 0xE3, 0xC9, 0xCB, 0x83, 0x84, 0x6F, 0xE5, 0x7C, 0x7E, 0x0E,
-    0x46, 0xF5, 0x20, 0xCD, 0xE6, 0xA1, 0xFD, 0xBE, 0x6D, 0x7D, 0x5B, 0x0A, 0x3D, 0x05, 0x84, 0x10,
-    0xC9, 0x01, 0xF8, 0x20, 0x32, 0x34, 0x1E, 0x86, 0x2F, 0x0F, 0x92, 0xA1, 0xC8, 0xD3, 0x02, 0x8C,
-    0x3B, 0xB0, 0x4B, 0x11, 0xAC, 0x5D, 0x42, 0x5C, 0x9D, 0x5C, 0x99, 0x8C, 0x94, 0xE1, 0xFF, 0xD9,
-    0x69, 0x07, 0xF4, 0x8C, 0xA9, 0x1D, 0x0B, 0xEB, 0xDB, 0x21, 0xB6, 0x66, 0xFB, 0xB4, 0x79, 0x64,
-    0xF3, 0xE1, 0x3F, 0xD7, 0xB7, 0x82, 0x13, 0x4A, 0xB8, 0x41, 0xA9, 0x7A, 0x8E, 0xDB, 0x99, 0x32,
-    0x3F, 0x04, 0x87, 0xF0, 0x74, 0x9D, 0x76, 0xF1, 0x15, 0x5E, 0xE5, 0x4F, 0x45, 0xCF, 0x8B, 0xCE,
-    0xF1, 0xAA, 0x70, 0x48, 0x47, 0x8A, 0xE4, 0x5E, 0x5E, 0x95, 0xB4, 0xB1, 0xE5, 0x45, 0xA6, 0xC2,
-    0x55, 0x59, 0x03, 0x3E, 0x9A, 0x68, 0x00, 0x1F, 0xA9, 0x19, 0x10, 0x64, 0x62, 0xA9, 0x22, 0xA0,
-    0x01, 0xE2, 0xCE, 0x2E, 0x2F, 0xCE, 0x88, 0x88, 0xE4, 0x22, 0x8A, 0x48, 0x3E, 0x42, 0x44, 0x09,
-    0xB9, 0x2D, 0x1F, 0xC1, 0xFC, 0x7D, 0xB9, 0xB6, 0x14, 0xC2, 0x87, 0x4A, 0x86, 0x28, 0x8A, 0x7E,
-    0x5E, 0x58, 0x10, 0xD9, 0x59, 0x39, 0xA8, 0x66, 0x22, 0x68, 0x55, 0xA4, 0xC1, 0x29, 0x52, 0xA9,
-    0xA4, 0x8D, 0xEE, 0x70, 0xA6, 0xA9, 0x77, 0xFA, 0xA5, 0x5F, 0xDF, 0x86, 0x97, 0x63, 0x3C, 0x31,
-    0x72, 0x60, 0x4B, 0xC8, 0x76, 0x34, 0xC9, 0xF4, 0x25, 0x79, 0xC2, 0x24, 0x2A, 0xE4, 0x61, 0x4E,
-    0x98, 0xB4, 0xE6, 0xEC, 0xA1, 0x38, 0xB6, 0x84, 0x52, 0x8C, 0x85, 0x32, 0xA3, 0x26, 0xD5, 0xB1,
-    0x2D, 0x2B, 0x11, 0x47, 0xB9, 0x9A, 0x3D, 0x14, 0x87, 0xFD, 0x81, 0xDD, 0xBF, 0x8F, 0x44, 0x56,
-    0xF6, 0xF7, 0x76, 0x88, 0x6C, 0x2B, 0x82, 0x3D, 0x9E, 0x07, 0x18, 0x02, 0x5F, 0x7C, 0x65, 0x1D,
-    0xD9, 0xB9, 0xA4, 0x1C, 0x2E, 0x41, 0x0A, 0xF8, 0x36, 0x99, 0xD6, 0xC2, 0xFA, 0x0B, 0x8E, 0x9C,
-    0xE4, 0x55, 0xF5, 0x3C, 0x78, 0x9F, 0xD4, 0x67, 0x24, 0xD3, 0x9E, 0x86, 0xF4, 0x4E, 0x1F, 0x9A,
-    0x59, 0x5E, 0x85, 0xEF, 0x0B, 0x68, 0x57, 0x4C, 0x35, 0xB7, 0x3A, 0xD4, 0xE6, 0x93, 0x32, 0x35,
-    0x44, 0xE3, 0x86, 0x50, 0x7E, 0x9C, 0x2C, 0x31, 0x79, 0x8A, 0x7B, 0x21, 0x97, 0x3E, 0xA2, 0x84,
-    0x75, 0x36, 0x51, 0x9C, 0x94, 0x9E, 0x63, 0x16, 0xA7, 0x8F, 0x77, 0xE0, 0x6B, 0x5E, 0xCD, 0x93,
-    0x1C, 0xB3, 0x0E, 0x29, 0x80, 0xDA, 0xDC, 0x26, 0xBC, 0xF9, 0xCD, 0x97, 0x3A, 0x1A, 0x90, 0x86,
-    0xAF, 0xE4, 0x56, 0x07, 0xC6, 0x81, 0xB2, 0x63, 0x3F, 0xC2, 0xAF, 0x7C, 0xDC, 0xE0, 0x5B, 0x20,
-    0xBC, 0xC5, 0xAF, 0x71, 0xB7, 0x96, 0xDA, 0xA2, 0x4C, 0x89, 0xF1, 0x94, 0xAF, 0x1D, 0xB6, 0x76,
-    0x10, 0xA1, 0x4C, 0x99, 0x96, 0xF3, 0xA0, 0x98, 0xAA, 0x21, 0x9E, 0x3C, 0x7B, 0x56, 0x08, 0x1B,
-    0xB2, 0xDE, 0x54, 0xF7, 0xD9, 0x7C, 0x3B, 0x2F, 0x3A, 0xD8, 0x0A, 0xB9, 0x79, 0xC5, 0x0F, 0xC2,
-    0xA2, 0x6A, 0x70, 0xA3, 0xCE, 0xA8, 0x78, 0xA3, 0xD9, 0x82, 0x12, 0x36, 0x32, 0x9F, 0x46, 0xDE,
-    0x27, 0x84, 0xE4, 0xBD, 0x47, 0x69, 0xA2, 0x4E, 0xD1, 0xD4, 0x50, 0x34, 0xD5, 0xB4, 0x9A, 0x07,
-    0xC5, 0x8B, 0x23, 0x94, 0x0B, 0xEA, 0x55, 0xD4, 0xA1, 0x0C, 0xF3, 0xEB, 0x66, 0xFB, 0x56, 0xE3,
-    0xF7, 0x57, 0x71, 0x97, 0x1E, 0x3F, 0x59, 0x62, 0x5A, 0xE7, 0x26, 0x79, 0x75, 0x10, 0xF3, 0x99,
-    0x2C, 0x65, 0x89, 0xA8, 0x4C, 0xDC, 0x04, 0xCB, 0x43, 0xF6, 0xA9, 0x90, 0x11, 0x0B, 0x41, 0x5C,
-    0x2C, 0x42, 0xFB, 0xBA, 0xAC, 0x01, 0xCB, 0x64, 0x80, 0xCD, 0x39, 0x67, 0xCB, 0xA8, 0x13, 0x83,
-    0xF8, 0x48, 0xB8, 0x66, 0x33, 0x3E, 0xF4, 0xF8, 0x50, 0xEB, 0xE0, 0x03, 0xB5, 0xAC, 0x8D, 0xF9,
-    0x07, 0x18, 0x23, 0x0C, 0xA7, 0xE1, 0xA2, 0x53, 0x60, 0x44, 0x77, 0x73, 0x40, 0xFF, 0xC9, 0xB9,
-    0x48, 0xFA, 0x69, 0x2F, 0x38, 0x30, 0xBD, 0x15, 0xAD, 0xEF, 0x11, 0x7F, 0x7B, 0x98, 0x23, 0x09,
-    0xA8, 0x82, 0xFD, 0xD0, 0x25, 0x4C, 0xA6, 0x5E, 0xB7, 0x65, 0xEB, 0x6C, 0x12, 0x72, 0x3D, 0xB9,
-    0x45, 0xD8, 0xC3, 0x0A, 0x25, 0x0D, 0x2C, 0xD5, 0xE7, 0x7C, 0x5D, 0x15, 0x74, 0x96, 0x5D, 0xCD,
-    0xD3, 0xAB, 0x58, 0xAD, 0x57, 0xD7, 0x64, 0x75, 0x4E, 0xF3, 0xA7, 0xF6, 0xA3, 0x34, 0x9E, 0x30,
-    0x73, 0xFF, 0xC1, 0x51, 0xED, 0x16, 0x5F, 0x6B, 0x28, 0xCF, 0x48, 0xBB, 0x2C, 0x4A, 0xB6, 0x75,
-    0x2A, 0x77, 0xEA, 0x93, 0x76, 0xA0, 0x65, 0xC5, 0x07, 0x39, 0x97, 0x2C, 0xAF, 0xA2, 0xE4, 0x43,
-    0xD0, 0xE5, 0xD2, 0x7C, 0x5A, 0x1E, 0x5D, 0xC2, 0xCE, 0x14, 0x25, 0x0C, 0xA4, 0x7D, 0x1C, 0xDA,
-    0x60, 0xDF, 0x58, 0x72, 0xED, 0x59, 0xE9, 0x9D, 0xB1, 0xB7, 0x9C, 0xED, 0x80, 0x9E, 0x94, 0xE1,
-    0xD2, 0x1F, 0xBC, 0x49, 0x56, 0x9D, 0xAC, 0x36, 0xD5, 0xF9, 0x96, 0xDC, 0x90, 0x01, 0x97, 0x6A,
-    0x48, 0xCC, 0xF3, 0x1F, 0x32, 0xBF, 0xB7, 0x8C, 0x79, 0x9A, 0x8B, 0x2B, 0xED, 0x99, 0xAC, 0x1E,
-    0x72, 0x9B, 0x60, 0x8A, 0x3B, 0x45, 0x43, 0xF9, 0x7A, 0xFD, 0x09, 0x1D, 0xBC, 0x19, 0xAE, 0x52,
-    0x8A, 0x07, 0xCF, 0xD8, 0x67, 0xDC, 0x0A, 0x49, 0x34, 0x27, 0xF7, 0x26, 0x48, 0x11, 0xF2, 0x85,
-    0x95, 0x05, 0x60, 0xC8, 0x20, 0x9F, 0x5A, 0xF0, 0x58, 0x90, 0x15, 0x94, 0x2C, 0x86, 0x60, 0xC8,
-    0x52, 0x70, 0x3F, 0x9B, 0xC8, 0x7E, 0x0B, 0xF8, 0x07, 0xD8, 0x82, 0x53, 0xF2, 0x38, 0x9C, 0x4A,
-    0x14, 0x12, 0x15, 0x03, 0x4E, 0xC9, 0x3C, 0xC1, 0xA9, 0x88, 0x68, 0x03, 0xCB, 0x33, 0x7F, 0xD5,
-    0x06, 0xC4, 0x87, 0x25, 0x4E, 0x89, 0xD0, 0xE4, 0x14, 0x26, 0x84, 0xAC, 0x82, 0xD5, 0x48, 0x21,
-    0xD8, 0x25, 0x48, 0x16, 0x59, 0xA5, 0x8A, 0x98, 0x64, 0x84, 0x53, 0x7E, 0x80, 0x80, 0xBB, 0x3C,
-    0x60, 0x3D, 0x01, 0x8C, 0x35, 0x17, 0xDD, 0x8A, 0xEB, 0x3C, 0x08, 0xDD, 0x16, 0x20, 0xD2, 0x12,
-    0xCC, 0x64, 0x39, 0x57, 0x52, 0xC5, 0xA4, 0xB4, 0x39, 0xE9, 0x10, 0x43, 0x40, 0x55, 0xFB, 0x29,
-    0x87, 0x78, 0x79, 0x7F, 0x43, 0xAC, 0x33, 0xE0, 0x60, 0xA1, 0xA3, 0xF3, 0x39, 0x3A, 0x22, 0x59,
-    0x19, 0x1A, 0x50, 0xAD, 0xB0, 0x5E, 0xD0, 0x51, 0x08, 0x74, 0x50, 0x9B, 0x74, 0xE4, 0x29, 0x91,
-    0x9C, 0x9C, 0xF2, 0xF5, 0x54, 0xA4, 0xA7, 0x12, 0xFD, 0x55, 0x31, 0x52, 0x45, 0xED, 0xE0, 0xEB,
-    0x22, 0x0E, 0x8C, 0xCA, 0x99, 0x3C, 0x42, 0x42, 0x17, 0xA9, 0x1E, 0x7D, 0x2A, 0x5F, 0x7A, 0x5F,
-    0x31, 0xC7, 0x00, 0xD0, 0x1E, 0xAA, 0xA6, 0xD3, 0x2B, 0x79, 0x90, 0xE8, 0x5E, 0x8F, 0x84, 0xF8,
-    0x42, 0x56, 0x7B, 0xA0, 0x73, 0x15, 0x88, 0xBC, 0x05, 0x72, 0x52, 0x6F, 0xCF, 0x37, 0xF7, 0x30,
-    0x91, 0xC8, 0xC6, 0x5B, 0x6A, 0xEF, 0xA9, 0xA6, 0x85, 0xFC, 0x82, 0xD8, 0x7B, 0xF5, 0xC6, 0x29,
-    0x92, 0xB8, 0x4B, 0xDC, 0x0F, 0xDC, 0xCF, 0xF5, 0x66, 0x15, 0x6F, 0xED, 0xE9, 0x83, 0x20, 0x14,
-    0x79, 0xDB, 0x53, 0x09, 0xC8, 0xAC, 0x88, 0x14, 0xC8, 0x3A, 0xA9, 0xE0, 0xED, 0x20, 0x1A, 0xB8,
-    0x4B, 0x85, 0x32, 0x03, 0xA1, 0x80, 0x73, 0x7F, 0xBB, 0x52, 0xCB, 0x2B, 0x5F, 0x6F, 0x3F, 0x67,
-    0x5F, 0xE3, 0xEF, 0x64, 0x82, 0x3D, 0x5A, 0x41, 0x05, 0xF9, 0xF5, 0xD6, 0x3F, 0x5A, 0x40, 0x61,
-    0x5C, 0x4D, 0x49, 0x38, 0x5B, 0x30, 0x3D, 0x07, 0xAD, 0x2F, 0x85, 0xA1, 0x2A, 0x05, 0x72, 0x5A,
-    0x65, 0xA0, 0x22, 0xA0, 0x04, 0x54, 0x00, 0xCA, 0x7F, 0x65, 0xBF, 0x32, 0x84, 0xCC, 0x57, 0xDE,
-    0x2B, 0xEB, 0x95, 0xF3, 0xCA, 0x78, 0xC7, 0x77, 0x07, 0x4F, 0x15, 0x94, 0x63, 0x50, 0xEA, 0xFD,
-    0x1C, 0x5F, 0x2C, 0xCA, 0xAB, 0x97, 0x84, 0x63, 0xBB, 0xF2, 0xF7, 0x79, 0x0A, 0xE5, 0x49, 0xBE,
-    0x52, 0x40, 0x22, 0x9C, 0xCB, 0x8B, 0x8A, 0x0A, 0x9D, 0x71, 0x82, 0x90, 0xAB, 0x41, 0x07, 0x45,
-    0xDF, 0xCE, 0x69, 0x9D, 0x57, 0xAB, 0x82, 0xB7, 0xEB, 0x08, 0x24, 0xAE, 0x56, 0x4C, 0x27, 0x02,
-    0x5B, 0x3C, 0xEB, 0x6C, 0xD9, 0xC1, 0xAB, 0xC5, 0xDA, 0xE1, 0xEB, 0x68, 0x7D, 0x6F, 0xC1, 0x2E,
-    0x90, 0xC3, 0x40, 0xFE, 0xFF, 0x6E, 0x3D, 0x92, 0x11, 0x83, 0xDB, 0xC1, 0x5D, 0x47, 0x68, 0x4D,
-    0x07, 0x8A, 0x6A, 0xF9, 0xEA, 0xE4, 0x61, 0x47, 0x20, 0x12, 0xCD, 0xF1, 0xDD, 0xBC, 0x92, 0x81,
-    0xFF, 0xB7, 0xED, 0x63, 0x61, 0x54, 0x5B, 0x35, 0x9E, 0x2C, 0xB5, 0xF2, 0xFB, 0x07, 0x84, 0xF7,
-    0x02, 0xE6, 0xAD, 0xE0, 0x48, 0x4B, 0xDF, 0xC3, 0x5A, 0xFA, 0x74, 0xF4, 0x0C, 0xB0, 0x64, 0x71,
-    0x84, 0x62, 0x9F, 0xCD, 0xA7, 0x12, 0x3B, 0xC9, 0x14, 0x03, 0x05, 0xA9, 0x7B, 0x6C, 0x39, 0x23,
-    0x1B, 0xFC, 0xFD, 0xA5, 0xF1, 0x89, 0x3E, 0x3F, 0x4B, 0x87, 0x8D, 0xDE, 0x89, 0xDA, 0x36, 0x58,
-    0xE1, 0x94, 0x74, 0x1E, 0xF2, 0xD4, 0x3C, 0xB0, 0xF7, 0xA4, 0xEA, 0x3E, 0x2D, 0xD2, 0x9B, 0x24,
-    0x50, 0x64, 0xBA, 0x78, 0x8E, 0x1A, 0x10, 0x0C, 0xB4, 0x46, 0x34, 0x46, 0x59, 0x0E, 0x2E, 0x3D,
-    0xB2, 0xB9, 0x10, 0xC8, 0xD7, 0xC7, 0x76, 0x66, 0x9E, 0xAE, 0x75, 0x29, 0xB0, 0xAF, 0x2D, 0x4E,
-    0x6F, 0xAE, 0xCB, 0x6B, 0x56, 0xC7, 0xB4, 0x3F, 0xD5, 0xFA, 0xDE, 0x69, 0x4B, 0x05, 0x3F, 0xCB,
-    0x07, 0x6F, 0x8C, 0xA4, 0xA1, 0xD7, 0xE5, 0x2F, 0xCD, 0x5F, 0xC9, 0x62, 0xE4, 0xB7, 0xE2, 0xF9,
-    0x0A, 0x40, 0x26, 0xDB, 0xE9, 0x7C, 0xEE, 0x5D, 0xBA, 0xCA, 0x55, 0xAE, 0x74, 0x1A, 0x73, 0xE1,
-    0x16, 0x87, 0xE9, 0x61, 0x5B, 0xC2, 0x7A, 0x0A, 0xDA, 0x4B, 0x86, 0x0C, 0x2E, 0x9E, 0x3C, 0x5D,
-    0xDC, 0x5D, 0xF9, 0xDB, 0xB3, 0x74, 0x37, 0x20, 0xCE, 0xDA, 0xF9, 0xCE, 0xC9, 0x38, 0x0F, 0x55,
-    0x9E, 0xE0, 0x7D, 0xDB, 0x0A, 0x20, 0x22, 0x06, 0xC1, 0xBD, 0x1A, 0x75, 0xF5, 0x14, 0xD6, 0x9C,
-    0x28, 0xB9, 0xDC, 0xD5, 0x2B, 0xD7, 0x2A, 0x23, 0x9A, 0x57, 0xAF, 0xD5, 0x1E, 0xA1, 0xC1, 0x06,
-    0x2C, 0xDE, 0x25, 0x8D, 0x13, 0xC9, 0x1B, 0x0A, 0x4E, 0xE8, 0x50, 0x78, 0xA4, 0xD6, 0x5D, 0x19,
-    0x4D, 0xBD, 0x13, 0x9C, 0x26, 0xB7, 0xFE, 0xF4, 0x21, 0xD6, 0x6D, 0x9D, 0x3C, 0xA8, 0xBC, 0xCA,
-    0xE8, 0xCB, 0x8B, 0x67, 0xAE, 0x52, 0x5E, 0x32, 0x3A, 0xA0, 0xB4, 0xD2, 0xF5, 0xBD, 0x23, 0x92,
-    0x21, 0x2A, 0xB7, 0x52, 0x30, 0x1D, 0x49, 0xA7, 0x88, 0x26, 0x9A, 0x56, 0xB4, 0xB7, 0x4E, 0xDB,
-    0xC2, 0xAB, 0x57, 0xAF, 0x0F, 0x8B, 0xC5, 0x37, 0xF5, 0x8C, 0x77, 0x6E, 0x5D, 0x56, 0xAB, 0x23,
-    0xBC, 0x82, 0xB2, 0x59, 0x37, 0x03, 0x49, 0xF9, 0xF5, 0x44, 0xCC, 0x43, 0x50, 0x78, 0xA7, 0x73,
-    0x41, 0x53, 0x39, 0x64, 0x68, 0xA6, 0xA2, 0xE4, 0xBF, 0x68, 0x97, 0x99, 0x3C, 0xEF, 0x2C, 0xC2,
-    0x02, 0x31, 0xA6, 0x3F, 0x98, 0xF7, 0x16, 0x9E, 0xF1, 0xCB, 0x79, 0x16, 0x0C, 0x55, 0xEB, 0x7C,
-    0x52, 0xC2, 0x70, 0x8E, 0x16, 0xA0, 0xF5, 0xCB, 0x85, 0xBD, 0x2C, 0x58, 0x1D, 0x2A, 0x50, 0x39,
-    0xAB, 0x23, 0x66, 0xE6, 0x0C, 0xE8, 0x2A, 0x66, 0xDF, 0x93, 0x80, 0x14, 0xEE, 0xA4, 0x30, 0xCD,
-    0x05, 0x5A, 0xFC, 0x59, 0x35, 0x6F, 0x37, 0x9E, 0xD8, 0x8C, 0x1E, 0x24, 0x84, 0x7D, 0x00, 0xEB,
-    0xDB, 0x03, 0x3C, 0x26, 0xD3, 0x44, 0xE8, 0xD6, 0xAE, 0x70, 0x5D, 0xDC, 0xDE, 0x3A, 0x96, 0x82,
-    0x0E, 0xE7, 0x52, 0xA8, 0x4A, 0x9A, 0x78, 0x29, 0xA4, 0xE1, 0x77, 0x2F, 0xB5, 0x4E, 0x20, 0x44,
-    0x9F, 0x14, 0xF9, 0xF3, 0xE6, 0xA3, 0xB1, 0xCD, 0xC7, 0xF3, 0xB5, 0xDB, 0xE9, 0x2B, 0x4A, 0xD4,
-    0xA8, 0x57, 0xF2, 0x26, 0x64, 0xAB, 0x9E, 0xA7, 0x27, 0x50, 0x01, 0xD2, 0x2E, 0xCD, 0x97, 0x0F,
-    0xCF, 0xBC, 0x6D, 0x2E, 0xF9, 0x11, 0x23, 0x2C, 0x64, 0x81, 0xE2, 0x1A, 0x20, 0x77, 0x51, 0x20,
-    0x19, 0x7B, 0x2E, 0x98, 0x18, 0xB8, 0x13, 0xB8, 0xB4, 0x83, 0x77, 0x44, 0x11, 0x0E, 0xEA, 0x1E,
-    0x39, 0xBE, 0xAA, 0xD6, 0x2B, 0x5C, 0x9F, 0x41, 0xAA, 0x1C, 0xF8, 0x8B, 0xC5, 0xBF, 0xCB, 0x81,
-    0x38, 0x6E, 0x05, 0xA3, 0x1E, 0x17, 0xE4, 0x37, 0x27, 0xEC, 0x00, 0xAB, 0x16, 0xD8, 0x27, 0xE8,
-    0xE6, 0xF5, 0x58, 0x3A, 0xC4, 0xD3, 0x81, 0x62, 0x67, 0xE2, 0x0C, 0x4C, 0xF2, 0xD0, 0x32, 0x53,
-    0xBC, 0x44, 0x59, 0x94, 0xBE, 0x46, 0x7F, 0x3C, 0x87, 0x4D, 0x1E, 0xFC, 0xDE, 0x86, 0xA5, 0x2C,
-    0x8D, 0x83, 0xED, 0xF4, 0x4A, 0x4D, 0xB8, 0x4F, 0x4D, 0x7E, 0x41, 0xEE, 0xE5, 0x0F, 0xBE, 0x0C,
-    0xE6, 0x90, 0x6B, 0x8A, 0xDF, 0xEC, 0x08, 0xA6, 0x91, 0x7B, 0x09, 0x2E, 0x85, 0x94, 0x7B, 0x12,
-    0xDB, 0xA4, 0xE2, 0x66, 0x9E, 0x30, 0xB6, 0x89, 0xE0, 0x1D, 0x1A, 0x11, 0x93, 0xF8, 0x96, 0x32,
-    0x6D, 0x8A, 0x16, 0xB2, 0xB5, 0x4D, 0x08, 0xA6, 0xC0, 0x2B, 0x0C, 0xA9, 0x62, 0x21, 0xC1, 0x65,
-    0xA2, 0x0A, 0xF0, 0xD0, 0xCE, 0x6A, 0x9E, 0x2E, 0x39, 0xA6, 0xD7, 0x68, 0x3A, 0x67, 0xEF, 0xC3,
-    0x12, 0xF5, 0x11, 0xF0, 0xDB, 0x2E, 0xED, 0x21, 0x58, 0x42, 0xC7, 0xFB, 0x60, 0xEC, 0x86, 0x18,
-    0x3C, 0x6E, 0x32, 0x42, 0xB1, 0x8C, 0x64, 0x66, 0xB4, 0x55, 0x77, 0xD8, 0xDF, 0xAE, 0x87, 0xEC,
-    0x97, 0x8C, 0xE4, 0x08, 0x58, 0x2B, 0xE7, 0xB5, 0x17, 0xD3, 0x33, 0x27, 0x1C, 0x6B, 0x08, 0x86,
-    0xBB, 0x6B, 0x04, 0x4A, 0x6F, 0x49, 0xE1, 0x32, 0xB6, 0x26, 0x86, 0x33, 0x92, 0xA7, 0xF5, 0xE6,
-    0x67, 0xB0, 0x1F, 0x7B, 0x1A, 0x6B, 0xA5, 0x99, 0xC2, 0x14, 0x3E, 0xB1, 0x7F, 0xF5, 0x02, 0xB2,
-    0x05, 0xC5, 0x7F, 0xC3, 0xE6, 0x11, 0xB9, 0x49, 0x7E, 0x47, 0xF6, 0xF3, 0xF6, 0xBF, 0xEA, 0xAC,
-    0x83, 0x81, 0x42, 0xEC, 0x13, 0xD1, 0xE2, 0x95, 0x70, 0xB3, 0x0E, 0x2B, 0xAD, 0xED, 0x04, 0x3C,
-    0x7B, 0xE4, 0x89, 0x47, 0xCB, 0x41, 0xAF, 0xCC, 0x64, 0xFF, 0xF3, 0x14, 0x5C, 0xB0, 0xB5, 0x11,
-    0x2E, 0x2E, 0xD3, 0xC4, 0xCF, 0xBE, 0x3B, 0xBD, 0x37, 0x61, 0x62, 0xC5, 0x10, 0x85, 0x5C, 0x57,
-    0x20, 0xAA, 0x21, 0xAA, 0x42, 0x46, 0x07, 0x58, 0x73, 0xD4, 0x11, 0x2D, 0x63, 0xEB, 0x9C, 0x61,
-    0x28, 0x65, 0x75, 0x59, 0x31, 0xEA, 0x57, 0xF3, 0x75, 0x00, 0xC3, 0x59, 0x73, 0x5D, 0xEA, 0x1D,
-    0xE3, 0xAF, 0x11, 0xC3, 0x60, 0x18, 0x63, 0x5F, 0xC5, 0x3F, 0xF1, 0x15, 0xB0, 0xDE, 0x6A, 0x38,
-    0x51, 0xCC, 0xB5, 0xA0, 0xE3, 0x0E, 0x0A, 0x0C, 0x51, 0xA5, 0x4B, 0x40, 0x08, 0x6F, 0xA4, 0xF7,
-    0x1C, 0xD7, 0x1A, 0x6D, 0x75, 0xA2, 0xCC, 0x0E, 0x89, 0xD2, 0x1D, 0xDC, 0xB3, 0x78, 0xB6, 0x80,
-    0x8F, 0x60, 0x5F, 0x95, 0x83, 0xCA, 0x8E, 0x02, 0xBB, 0xC5, 0x9F, 0x3F, 0x47, 0x7E, 0xF4, 0xEA,
-    0xC4, 0x3E, 0x0E, 0xCD, 0xCF, 0x7A, 0xC4, 0xE6, 0x45, 0xAE, 0x95, 0xBD, 0x64, 0x0A, 0x9D, 0x42,
-    0x4A, 0xA8, 0x86, 0xB8, 0x31, 0x36, 0xD1, 0x7A, 0x0C, 0x74, 0xEB, 0xD4, 0xDA, 0x48, 0xF9, 0x6E,
-    0xBA, 0xAE, 0x1F, 0x4A, 0xCA, 0xBD, 0xE9, 0x68, 0x4A, 0x6F, 0x2D, 0x89, 0xDE, 0xCA, 0xD2, 0x71,
-    0x7F, 0x59, 0x63, 0xE6, 0x6C, 0xCF, 0x0C, 0x3A, 0x7C, 0x3D, 0x48, 0xB9, 0x5C, 0x07, 0xE3, 0x46,
-    0x80, 0x3C, 0xA2, 0x9F, 0xE8, 0x91, 0xF8, 0x0C, 0xDF, 0xF8, 0x1C, 0xA8, 0x86, 0xAB, 0x88, 0x5D,
-    0x35, 0x48, 0x91, 0xB4, 0xAB, 0x50, 0xBB, 0x02, 0xDB, 0x40, 0xB3, 0x01, 0x4F, 0x6F, 0xB8, 0x61,
-    0xB8, 0x4D, 0x62, 0xAF, 0xD8, 0x86, 0x72, 0xA0, 0x81, 0x10, 0x83, 0xD9, 0x54, 0x6F, 0xFE, 0x38,
-    0x1E, 0x91, 0xFE, 0xC8, 0x60, 0x86, 0xBD, 0x0D, 0x71, 0xCB, 0xD7, 0x62, 0x9A, 0xB3, 0x31, 0xD4,
-    0x30, 0xE3, 0x60, 0xD4, 0x3F, 0x52, 0x9C, 0x17, 0xBF, 0xF5, 0xA3, 0x79, 0x94, 0x2A, 0xEE, 0x64,
-    0x5A, 0x2C, 0x72, 0x8D, 0xF7, 0xA9, 0x50, 0x3C, 0xEB, 0x62, 0x8A, 0x56, 0xB4, 0xA9, 0x14, 0xEC,
-    0x88, 0x60, 0x7F, 0xD6, 0x65, 0x58, 0xAE, 0x6B, 0x48, 0x4A, 0x43, 0x75, 0xCB, 0xC0, 0xCE, 0xE1,
-    0x42, 0xB9, 0xD9, 0x99, 0x49, 0x3D, 0xE3, 0x6D, 0xE7, 0x20, 0x3B, 0x64, 0x10, 0xB9, 0x2C, 0x95,
-    0xCB, 0x34, 0x85, 0x43, 0xC5, 0xEF, 0x8B, 0xBA, 0xD0, 0x2C, 0x07, 0x81, 0xD3, 0x91, 0x0B, 0x2F,
-    0x50, 0xCF, 0x49, 0x00, 0xF8, 0x94, 0x7A, 0x4D, 0x44, 0x8B, 0xE5, 0xFD, 0x4D, 0xC8, 0x06, 0xB1,
-    0xCE, 0x44, 0x23, 0x30, 0xD4, 0x07, 0xC2, 0xED, 0xD6, 0x68, 0xB0, 0xA0, 0x36, 0x1A, 0xC5, 0x51,
-    0x8D, 0x39, 0xE2, 0xB4, 0xE7, 0x90, 0xE9, 0x8C, 0x87, 0x1C, 0x22, 0x9A, 0x31, 0xD1, 0xE2, 0xED,
-    0x7F, 0xFD, 0x36, 0x37, 0x8F, 0x44, 0xA5, 0x7C, 0xBB, 0xEF, 0xBB, 0xE4, 0x95, 0x1B, 0xF9, 0xE8,
-    0x46, 0xDE, 0x3A, 0x7D, 0x08, 0x54, 0x6B, 0x8A, 0xD1, 0xCC, 0x39, 0x46, 0xD1, 0x1D, 0x0A, 0x5F,
-    0xF8, 0xAD, 0xA9, 0x35, 0xE0, 0xCF, 0x0E, 0xBE, 0xE4, 0x1A, 0x31, 0xAD, 0x01, 0x8C, 0x4F, 0x86,
-    0xBB, 0xF4, 0x97, 0x77, 0x46, 0x15, 0xAE, 0x70, 0x01, 0xB0, 0x03, 0x07, 0x7C, 0x5C, 0xD1, 0xC9,
-    0xA2, 0x2E, 0x07, 0x5F, 0x60, 0x36, 0xF3, 0xF7, 0x58, 0x13, 0x43, 0xA5, 0xB9, 0xA0, 0x1F, 0x12,
-    0x8A, 0x45, 0x80, 0xA2, 0x0C, 0x86, 0xF3, 0xA7, 0x04, 0x5D, 0x45, 0xAF, 0xE1, 0x90, 0xF7, 0x7A,
-    0x20, 0x0F, 0xB8, 0x57, 0x1E, 0x24, 0x0A, 0x97, 0xD9, 0x49, 0x58, 0x7D, 0x9F, 0x1C, 0x6C, 0xED,
-    0xEE, 0xEE, 0x78, 0x8A, 0x63, 0x29, 0x4F, 0x70, 0x04, 0xEF, 0x91, 0xAE, 0x73, 0x4B, 0x0D, 0xD5,
-    0x68, 0x08, 0x0A, 0x4C, 0x3D, 0x56, 0x8D, 0xBB, 0xBB, 0x7B, 0x76, 0x57, 0x25, 0x64, 0xED, 0xFC,
-    0xBE, 0x62, 0xFA, 0xE6, 0x3B, 0x7F, 0xE7, 0x44, 0x79, 0xCD, 0xF7, 0x23, 0x7E, 0x77, 0x3D, 0xEF,
-    0xD5, 0x84, 0x10, 0xCE, 0xE9, 0x48, 0x03, 0x9C, 0xC3, 0x2C, 0xD5, 0x79, 0xFC, 0x2A, 0x55, 0x15,
-    0x4D, 0xE4, 0x1C, 0x10, 0x8A, 0xE1, 0x84, 0xEA, 0x3C, 0x85, 0xB1, 0x5D, 0xD9, 0x85, 0xC6, 0xDD,
-    0x44, 0xFF, 0x1F, 0xB3, 0x97, 0x9F, 0xA6, 0x60, 0x8C, 0xBA, 0x66, 0x27, 0x67, 0xF1, 0x78, 0xF6,
-    0x22, 0x03, 0x60, 0x9C, 0x8B, 0x89, 0x0B, 0x9F, 0x41, 0x3A, 0x1E, 0x66, 0x65, 0xEB, 0x58, 0x2C,
-    0xF6, 0x3B, 0xB6, 0x8E, 0xD1, 0x08, 0xCB, 0x5F, 0xEF, 0x89, 0x02, 0xB7, 0x1A, 0x55, 0x20, 0xDF,
-    0x55, 0x99, 0x6C, 0x5F, 0xDA, 0x16, 0x4B, 0xF2, 0xB3, 0xCC, 0x9E, 0x79, 0x11, 0xCE, 0x71, 0x6C,
-    0xCF, 0x36, 0xD9, 0xF2, 0xE0, 0x14, 0xAC, 0xE8, 0x18, 0x09, 0x10, 0x9F, 0xF2, 0xC4, 0xAE, 0x94,
-    0xFF, 0x3D, 0xBE, 0x79, 0x9C, 0x1C, 0x98, 0x10, 0xAF, 0x23, 0x40, 0xC5, 0xA7, 0x0F, 0xEE, 0xE9,
-    0xDF, 0x8A, 0xED, 0xE3, 0x4D, 0xBA, 0x3C, 0x8C, 0xD0, 0x5A, 0x04, 0xD5, 0x32, 0x84, 0x4A, 0xDF,
-    0xED, 0xF3, 0x2A, 0xDB, 0x89, 0xE8, 0xCF, 0xD1, 0xEA, 0xC1, 0x4C, 0xC9, 0x83, 0x2C, 0x1E, 0x74,
-    0xCF, 0x81, 0x68, 0x97, 0xF8, 0xBC, 0xF7, 0xEB, 0x90, 0xC4, 0x79, 0xBE, 0xE4, 0xBD, 0x3F, 0xFA,
-    0x0C, 0xE5, 0x76, 0x3A, 0x25, 0xCF, 0xA6, 0x8A, 0x5A, 0x7F, 0x32, 0x20, 0xFB, 0x70, 0xFB, 0x41,
-    0xE6, 0xC0, 0x07, 0x41, 0x9C, 0x27, 0x3E, 0x50, 0x66, 0x82, 0x17, 0x47, 0x1F, 0x34, 0xBE, 0x40,
-    0x3F, 0xB7, 0x37, 0x5B, 0x4F, 0x7D, 0x48, 0x34, 0xDE, 0xA6, 0xB1, 0xA2, 0xA2, 0x8C, 0x5E, 0xB4,
-    0x3F, 0xC0, 0x08, 0x72, 0x44, 0x15, 0xAA, 0xD3, 0x37, 0x9C, 0xD4, 0x0F, 0x98, 0x8E, 0xA8, 0xE3,
-    0xAA, 0x8C, 0x04, 0x5E, 0xC7, 0xE5, 0x18, 0xC6, 0x59, 0xA8, 0x21, 0x04, 0xCD, 0x69, 0x83, 0xA3,
-    0x89, 0xAB, 0x87, 0x78, 0x06, 0x7C, 0xBA, 0xCC, 0xF6, 0x7B, 0xF2, 0x0F, 0x40, 0xA2, 0xC0, 0x57,
-    0x25, 0xC2, 0x00, 0xE2, 0x99, 0x02, 0x5E, 0x20, 0x98, 0x00, 0xD8, 0x92, 0x2A, 0xF0, 0x3D, 0x5E,
-    0xF2, 0xD1, 0xEB, 0xDF, 0x1E, 0x88, 0x19, 0x7D, 0xC0, 0xB3, 0x96, 0x69, 0xAC, 0x01, 0x64, 0xCA,
-    0xB2, 0x76, 0x42, 0x03, 0xE7, 0xB1, 0xE5, 0x72, 0xF8, 0x4E, 0x07, 0x42, 0xA2, 0x1A, 0xF2, 0x52,
-    0x24, 0x99, 0xEF, 0xAA, 0x34, 0x63, 0xBD, 0xB5, 0x2C, 0x16, 0x98, 0x9D, 0x97, 0x22, 0x27, 0x59,
-    0x9F, 0xB5, 0x39, 0x9A, 0xB1, 0x27, 0x56, 0xFD, 0xE8, 0x0E, 0x45, 0x4B, 0x70, 0x28, 0x9A, 0x22,
-    0x10, 0xAC, 0x89, 0x80, 0x7A, 0x04, 0x91, 0x56, 0x0C, 0xB4, 0xD7, 0x66, 0x8D, 0x49, 0x35, 0xAF,
-    0x65, 0x58, 0xD5, 0xB2, 0x4A, 0x73, 0x63, 0x99, 0xE5, 0x45, 0xA9, 0xFB, 0xD6, 0x95, 0x4A, 0xF8,
-    0xBD, 0x5B, 0xD6, 0x65, 0xF9, 0xA8, 0x20, 0x59, 0x1A, 0xF8, 0x01, 0x20, 0xB8, 0x1A, 0xF5, 0x33,
-    0x1C, 0x00, 0x41, 0x5D, 0xA2, 0x61, 0x77, 0x9C, 0x36, 0x47, 0x38, 0xAF, 0xA2, 0x64, 0x32, 0xDB,
-    0xDA, 0xD8, 0xBA, 0x57, 0x11, 0xC6, 0xB6, 0x1D, 0x1C, 0xAF, 0x6F, 0xD0, 0xAB, 0x50, 0x9B, 0x67,
-    0x98, 0xD3, 0x35, 0x5F, 0x4B, 0xA5, 0x34, 0x53, 0x17, 0xA1, 0x9B, 0xF3, 0x1C, 0x64, 0xD3, 0x0C,
-    0xCA, 0x8B, 0x75, 0x28, 0xCE, 0x11, 0x5B, 0x80, 0x2D, 0xFF, 0x84, 0x0F, 0x4B, 0x9C, 0x56, 0x37,
-    0x35, 0x7B, 0x45, 0x9C, 0xFA, 0x06, 0xFF, 0x0B, 0x7A, 0xBF, 0x31, 0x9F, 0xD9, 0xB4, 0xC8, 0x3B,
-    0x50, 0x8A, 0x40, 0xFD, 0x0D, 0x59, 0x7D, 0x2B, 0x4D, 0xE2, 0x10, 0xDE, 0xF0, 0x49, 0x58, 0x53,
-    0x6F, 0xC4, 0x17, 0x70, 0x2C, 0x22, 0x87, 0xE5, 0x7C, 0x3A, 0xDA, 0x2D, 0x57, 0xF2, 0x90, 0x65,
-    0x28, 0x83, 0x8E, 0xDF, 0x95, 0x52, 0xFD, 0x8B, 0x82, 0x73, 0x56, 0x30, 0xC1, 0x04, 0xBC, 0xD4,
-    0x9B, 0xE2, 0xBE, 0x41, 0xA6, 0xEA, 0xE4, 0x0D, 0xE6, 0x9B, 0x07, 0x44, 0xF3, 0x18, 0xCC, 0x03,
-    0xEC, 0x06, 0x13, 0x49, 0x39, 0x91, 0xD8, 0x7B, 0xFD, 0x17, 0xF1, 0x9F, 0x22, 0x11, 0x4C, 0xFA,
-    0x4C, 0x47, 0x15, 0xD1, 0x79, 0x6A, 0x50, 0xCB, 0x63, 0xA2, 0x4B, 0x64, 0x5A, 0x7E, 0x8C, 0xF3,
-    0xBE, 0x76, 0x58, 0x59, 0x0C, 0x49, 0xC1, 0x60, 0xD8, 0x69, 0x5A, 0xAC, 0x51, 0x8D, 0xCC, 0x2A,
-    0xDF, 0x67, 0x80, 0x5E, 0x18, 0xF3, 0x4B, 0x35, 0xFC, 0x4C, 0x39, 0x6A, 0xCC, 0xD8, 0xD8, 0x2B,
-    0x2A, 0x3D, 0x2D, 0x05, 0xB2, 0x4E, 0x96, 0x0A, 0x6B, 0xEC, 0x1F, 0x88, 0xED, 0xE5, 0xCA, 0x8E,
-    0xBF, 0xD3, 0x18, 0x5F, 0x9B, 0xE9, 0xCD, 0x92, 0xF9, 0xD6, 0x2E, 0xED, 0x39, 0xF0, 0xB1, 0x64,
-    0xC6, 0x5B, 0x32, 0xE0, 0x65, 0xCA, 0x7C, 0x37, 0x07, 0x18, 0x28, 0x32, 0xD6, 0x12, 0x05, 0x31,
-    0x6A, 0x1B, 0x3A, 0x5E, 0x95, 0x9B, 0x4E, 0x84, 0x2B, 0xF1, 0x72, 0xC8, 0x24, 0x73, 0x5F, 0xD6,
-    0x1B, 0x1E, 0x98, 0xDF, 0xAD, 0xDC, 0xAD, 0x88, 0x3F, 0xAA, 0x36, 0x5E, 0x1F, 0xB3, 0xEA, 0x5E,
-    0xBD, 0xC3, 0x6B, 0x01, 0x8C, 0xD5, 0x88, 0x89, 0xF2, 0x10, 0x72, 0xC2, 0x67, 0x9A, 0xBE, 0x46,
-    0xA3, 0x52, 0x15, 0x94, 0xE3, 0x65, 0xEA, 0xCE, 0x05, 0xAD, 0x70, 0x1B, 0x8C, 0x73, 0xA0, 0x3D,
-    0x31, 0xB5, 0xF8, 0xFE, 0x15, 0xE4, 0x37, 0xE5, 0x9A, 0x96, 0xD7, 0x23, 0xA9, 0xD8, 0x64, 0x58,
-    0x2E, 0x1A, 0x02, 0x38, 0xB1, 0x1B, 0xCD, 0x09, 0x28, 0x75, 0x8F, 0x48, 0x8D, 0x9D, 0x32, 0x3B,
-    0x39, 0xB3, 0xB1, 0xB5, 0x22, 0x5C, 0x6D, 0x02, 0x73, 0x02, 0xCE, 0x4B, 0x50, 0xFA, 0x34, 0xDC,
-    0xAD, 0x1E, 0x23, 0xD3, 0xDE, 0x8C, 0x75, 0xCD, 0x25, 0x05, 0x32, 0x47, 0x27, 0x24, 0x83, 0x29,
-    0xF3, 0xBA, 0xC2, 0x63, 0x50, 0x72, 0x28, 0x77, 0x87, 0xBE, 0xC6, 0x36, 0x60, 0xB6, 0xEF, 0x2C,
-    0xBC, 0x01, 0x11, 0x5A, 0x8E, 0x58, 0x0A, 0x04, 0xA9, 0x75, 0x9F, 0x81, 0x40, 0x4E, 0x95, 0x66,
-    0x03, 0xDD, 0xCA, 0x98, 0xE8, 0x0F, 0x19, 0x97, 0xAA, 0x55, 0x78, 0x31, 0xFD, 0x1C, 0x8F, 0x2E,
-    0x8D, 0x88, 0xAF, 0x2E, 0x40, 0x04, 0x50, 0x30, 0x12, 0xAA, 0xF8, 0x7B, 0x64, 0x15, 0x94, 0x52,
-    0x97, 0x76, 0x5D, 0x71, 0x52, 0x30, 0xEA, 0x48, 0x3D, 0x49, 0x19, 0x92, 0xFA, 0xCC, 0x51, 0x3E,
-    0x1E, 0x0C, 0x6B, 0xE7, 0x12, 0xD4, 0x9E, 0x7A, 0xDE, 0xC9, 0x51, 0x41, 0x69, 0x73, 0x74, 0xAC,
-    0xFA, 0x7A, 0xBF, 0xD6, 0xD4, 0x4C, 0xB2, 0x91, 0xF6, 0x79, 0xA7, 0xC8, 0xF6, 0x9F, 0xCB, 0xAF,
-    0x65, 0x02, 0xCB, 0x74, 0x19, 0x42, 0x4A, 0xCE, 0x6C, 0x44, 0x33, 0x76, 0xC4, 0xE5, 0x95, 0xD1,
-    0x96, 0xC2, 0x94, 0xE3, 0x48, 0x5E, 0x4F, 0xB0, 0x2C, 0x30, 0x2C, 0xC5, 0xFB, 0x39, 0x48, 0x98,
-    0x73, 0x79, 0x55, 0x18, 0x82, 0x09, 0x4D, 0x87, 0x01, 0xD3, 0xDF, 0x05, 0x54, 0x4F, 0xCF, 0xD5,
-    0x1E, 0x37, 0x80, 0x1D, 0x9B, 0x5F, 0x7F, 0x8E, 0x39, 0x70, 0x4D, 0x22, 0x5C, 0x5F, 0x2E, 0x66,
-    0x23, 0xFC, 0x3A, 0xAD, 0xEB, 0x01, 0xD3, 0x75, 0xA0, 0x57, 0x83, 0x1C, 0xD1, 0xB0, 0x9A, 0xAA,
-    0x5E, 0xAF, 0x53, 0xD4, 0xAF, 0xFA, 0xD0, 0x4E, 0x70, 0x91, 0x1E, 0x7B, 0xBF, 0xCC, 0x5A, 0x1F,
-    0x14, 0xCC, 0xEC, 0xFD, 0x70, 0xCE, 0x47, 0x88, 0xE6, 0xE5, 0x08, 0xD1, 0x84, 0x13, 0x23, 0x1D,
-    0x62, 0x31, 0x92, 0x16, 0xFF, 0x85, 0x8D, 0x13, 0xDD, 0x6A, 0xAE, 0xC5, 0x2D, 0xDC, 0xD2, 0xAC,
-    0xC6, 0x62, 0x8E, 0x41, 0xD9, 0xA0, 0x13, 0xDF, 0xF5, 0x52, 0x5C, 0x63, 0xF9, 0xFD, 0x1C, 0x18,
-    0xE5, 0xA1, 0xFC, 0xA5, 0xF6, 0xF3, 0x1B, 0xC1, 0x6D, 0x4D, 0xAB, 0x14, 0x1B, 0x29, 0x1B, 0x72,
-    0xBB, 0xAA, 0xC9, 0x62, 0xEA, 0x21, 0x13, 0x77, 0xF6, 0x57, 0xAE, 0x14, 0xC2, 0xCB, 0xEF, 0x12,
-    0x7E, 0xC5, 0x17, 0xEC, 0x14, 0x5E, 0xB6, 0xF6, 0xDB, 0x93, 0xB0, 0xAC, 0x10, 0x92, 0xD3, 0x3A,
-    0x99, 0xA2, 0x26, 0xB4, 0x8F, 0x8B, 0x95, 0x5A, 0xFE, 0x54, 0xBE, 0xB8, 0xFD, 0x86, 0x2D, 0x8F,
-    0x85, 0x56, 0x82, 0x42, 0x11, 0x1B, 0xF3, 0x1E, 0x75, 0xD0, 0x47, 0x44, 0xCF, 0x55, 0x5D, 0x54,
-    0x03, 0x8B, 0x3D, 0x41, 0xA7, 0xD8, 0x21, 0x94, 0xCC, 0x5E, 0xBA, 0x41, 0x3A, 0x08, 0x6B, 0x7F,
-    0x07, 0x87, 0xAE, 0x65, 0x77, 0x4B, 0x58, 0xFA, 0xA5, 0x83, 0x22, 0xD7, 0xF7, 0xE2, 0xF7, 0x28,
-    0xD7, 0x91, 0x69, 0xBC, 0x4C, 0xEC, 0xFC, 0x12, 0x8F, 0x38, 0x71, 0xE9, 0x7A, 0xEF, 0x92, 0xB8,
-    0x40, 0x4A, 0xA9, 0x55, 0x15, 0x6A, 0xD0, 0x94, 0x65, 0xAE, 0xE4, 0x46, 0x79, 0xE6, 0x4C, 0x9A,
-    0x03, 0x8C, 0x0A, 0x05, 0x95, 0x0F, 0xB1, 0x3B, 0xF1, 0x42, 0xAF, 0x8B, 0x2B, 0xA3, 0xF8, 0x9A,
-    0x77, 0xEC, 0x89, 0xA9, 0x96, 0xAB, 0xEC, 0x60, 0xE5, 0x8A, 0x53, 0x71, 0x4D, 0xF8, 0xC4, 0xEA,
-    0x56, 0xC1, 0xD2, 0xF1, 0x4E, 0x4D, 0x9B, 0x32, 0x4F, 0x6D, 0x9B, 0x72, 0x8F, 0x81, 0x43, 0xAB,
-    0xAF, 0xE5, 0x6C, 0xDD, 0x76, 0xC0, 0x3D, 0x58, 0x30, 0x04, 0x2D, 0x60, 0xC2, 0x58, 0xE2, 0x87,
-    0x80, 0xDF, 0x44, 0x75, 0xD0, 0xC3, 0x7F, 0x93, 0xC3, 0xDE, 0x70, 0x6D, 0x9C, 0x58, 0x1F, 0xC3,
-    0xE8, 0x31, 0x22, 0xA5, 0x88, 0xFF, 0x95, 0xE1, 0xC5, 0xC9, 0xDC, 0x56, 0x5C, 0xE3, 0xB7, 0x32,
-    0x41, 0x01, 0x08, 0x44, 0x67, 0xB5, 0x4A, 0xCB, 0xAD, 0x12, 0x6E, 0x9D, 0x70, 0x2B, 0xC5, 0xBC,
-    0x56, 0xB8, 0xD5, 0x62, 0x5E, 0x2F, 0xE6, 0x15, 0xE3, 0xEA, 0x35, 0xC3, 0x25, 0xF6, 0x09, 0x79,
-    0x62, 0x20, 0x13, 0x8B, 0xA0, 0xC6, 0x08, 0x0F, 0xBF, 0x2B, 0xB4, 0x7C, 0x58, 0xF4, 0x6C, 0xA0,
-    0xD9, 0x49, 0x59, 0xDE, 0xA6, 0xB5, 0xD6, 0x11, 0x6A, 0x97, 0x94, 0x29, 0x11, 0xC2, 0x4D, 0x3C,
-    0x0D, 0x44, 0x2F, 0xA7, 0x2F, 0xDA, 0x9A, 0xA7, 0x53, 0x5B, 0xE2, 0xB4, 0x20, 0xDD, 0x1C, 0xA7,
-    0x05, 0xD4, 0xF0, 0x74, 0x5D, 0x4C, 0x3C, 0x2D, 0xC8, 0x9C, 0xA7, 0x8D, 0x4C, 0x53, 0x9C, 0x16,
-    0x9E, 0xF0, 0x34, 0x03, 0x7E, 0x3E, 0xB3, 0x47, 0x3C, 0x1D, 0x42, 0xF0, 0xFA, 0x1C, 0x0E, 0x03,
-    0xC3, 0x09, 0x2D, 0x72, 0xAD, 0x08, 0xAE, 0x76, 0xA8, 0x07, 0x89, 0x35, 0x9B, 0xA5, 0xA2, 0x76,
-    0xEE, 0x83, 0xF9, 0xCA, 0x3A, 0xD4, 0x37, 0x33, 0x49, 0x03, 0x22, 0x1A, 0xA9, 0xD5, 0x4C, 0x2A,
-    0x4B, 0xB8, 0x57, 0xE1, 0xE6, 0x4C, 0x57, 0xA4, 0xE6, 0x2A, 0x0E, 0xDD, 0x85, 0xE4, 0xF7, 0xB6,
-    0xE0, 0x01, 0x84, 0x68, 0x59, 0xE0, 0xCD, 0x38, 0x98, 0x06, 0x91, 0xA1, 0x27, 0x53, 0xA8, 0xDE,
-    0x1D, 0x22, 0xED, 0x40, 0x86, 0x1D, 0x0E, 0xA2, 0xF7, 0x75, 0x40, 0x80, 0xD0, 0x0B, 0x57, 0x43,
-    0x2E, 0xA8, 0x6D, 0x85, 0x88, 0xC7, 0x0E, 0x26, 0xC5, 0x8E, 0x6B, 0xB5, 0x78, 0x05, 0xAA, 0x27,
-    0x03, 0xF9, 0x02, 0x81, 0x1F, 0xDD, 0xEB, 0xDA, 0x49, 0x26, 0xDF, 0xE4, 0x58, 0xCA, 0x8A, 0x7C,
-    0x08, 0x6E, 0x72, 0xA7, 0x47, 0x9E, 0x1E, 0x01, 0x43, 0xE4, 0xF4, 0xEF, 0x6C, 0xCF, 0xD3, 0xE7,
-    0x6C, 0xC7, 0xD3, 0x81, 0xC0, 0xD8, 0x96, 0xF5, 0x93, 0x4B, 0x4A, 0x26, 0xB2, 0xBF, 0xE0, 0x8D,
-    0x62, 0xFB, 0x12, 0x25, 0x93, 0xD8, 0x37, 0x28, 0x99, 0xD4, 0x49, 0x26, 0x73, 0xCF, 0x29, 0x54,
-    0x70, 0xB3, 0x82, 0x70, 0x38, 0xC5, 0x3E, 0xDE, 0x31, 0x6F, 0x73, 0x94, 0x4F, 0x6A, 0x90, 0x1B,
-    0x7E, 0x7D, 0x37, 0x4F, 0xDF, 0x43, 0xB9, 0xC4, 0xA2, 0x74, 0x7A, 0x5C, 0x1E, 0xE8, 0xB9, 0x98,
-    0xB3, 0x54, 0x0E, 0xB0, 0x3A, 0xA8, 0xEA, 0x42, 0xFE, 0x5A, 0xA0, 0x0D, 0x2B, 0x86, 0xE8, 0xEC,
-    0xDE, 0x10, 0x51, 0x1D, 0x5E, 0x72, 0x3D, 0x08, 0x56, 0xD3, 0xAF, 0x5A, 0x8C, 0x58, 0xA8, 0x23,
-    0x6E, 0x6F, 0x80, 0x80, 0xF4, 0x20, 0xE2, 0xFA, 0xFB, 0xB8, 0xDC, 0xBE, 0xA0, 0x65, 0x8D, 0x5C,
-    0x15, 0xFF, 0xC6, 0x5F, 0x5A, 0x6F, 0x26, 0x3B, 0x5A, 0x6D, 0x63, 0xD8, 0x18, 0xBE, 0xD3, 0xBE,
-    0x2A, 0xDF, 0x00, 0xA3, 0x77, 0x69, 0xE1, 0x79, 0xD0, 0x2A, 0x43, 0xE2, 0x56, 0xA3, 0x12, 0x49,
-    0x57, 0xA8, 0xFF, 0x7B, 0x65, 0x6E, 0x83, 0x70, 0x8D, 0x05, 0x0E, 0x47, 0x1C, 0x51, 0xC2, 0xFB,
-    0xF1, 0x9E, 0xDF, 0x4A, 0xBD, 0x89, 0x51, 0xC2, 0xD0, 0x13, 0xD4, 0x67, 0x4D, 0xC5, 0xAE, 0x95,
-    0x87, 0xD5, 0x89, 0x1E, 0x34, 0x5C, 0xA0, 0x1C, 0x6E, 0xD6, 0x60, 0xE5, 0x66, 0x9C, 0xDF, 0xC6,
-    0x21, 0xE2, 0x39, 0x02, 0x35, 0x4F, 0x02, 0x0D, 0x0B, 0x40, 0x0D, 0x56, 0x27, 0xCC, 0x81, 0x0E,
-    0x12, 0x2C, 0x51, 0x5B, 0xB0, 0x75, 0x49, 0xAB, 0x54, 0x44, 0x5D, 0x8C, 0x15, 0x7E, 0x19, 0xF4,
-    0x4C, 0x4F, 0x8C, 0xFE, 0xA0, 0x85, 0xBA, 0xF5, 0x5D, 0x33, 0x31, 0xAB, 0xA2, 0x4D, 0x25, 0x6B,
-    0x06, 0x1B, 0xB5, 0x59, 0xB9, 0xB6, 0x73, 0xF9, 0xAA, 0x0E, 0xFB, 0x5D, 0x5F, 0xD0, 0x69, 0xEC,
-    0x1E, 0x58, 0xC2, 0x77, 0xE4, 0x89, 0xF6, 0x09, 0xC1, 0xD3, 0x3B, 0x9B, 0xB1, 0xF2, 0x68, 0x33,
-    0x36, 0x39, 0xFD, 0x1C, 0xDD, 0xE9, 0xC1, 0x99, 0xB1, 0x9E, 0xA7, 0xDF, 0xB4, 0x9D, 0x33, 0x63,
-    0xAD, 0x33, 0x63, 0x4B, 0x67, 0xC6, 0x6A, 0x67, 0xC6, 0xCE, 0x3A, 0x33, 0xF6, 0xA4, 0x33, 0x63,
-    0xA9, 0x33, 0x63, 0xD5, 0x01, 0x33, 0x96, 0xBD, 0xBD, 0x19, 0xF3, 0x9C, 0x19, 0xF3, 0x0F, 0x99,
-    0xB1, 0x50, 0x97, 0x95, 0xD3, 0x29, 0x57, 0x94, 0xB8, 0x76, 0x88, 0xE2, 0x0D, 0x97, 0x6E, 0x55,
-    0x94, 0x32, 0x77, 0x87, 0xCD, 0xA9, 0x3C, 0xEF, 0x99, 0x95, 0xDD, 0x3A, 0x21, 0xD3, 0xA7, 0x57,
-    0xED, 0x8B, 0xB5, 0x82, 0xC3, 0x6A, 0xDB, 0x40, 0x9F, 0xB0, 0xBC, 0x2E, 0x66, 0xED, 0x74, 0x3A,
-    0x2A, 0x73, 0xC9, 0xEA, 0x46, 0x15, 0xEA, 0x7A, 0xBF, 0xAE, 0xD0, 0x86, 0x75, 0x3F, 0xF2, 0x67,
-    0xC8, 0xB7, 0xA8, 0x08, 0xFD, 0x0D, 0xE0, 0xC9, 0x10, 0x94, 0x92, 0xC3, 0x0A, 0x81, 0xC8, 0x15,
-    0xE3, 0x1A, 0xD7, 0x27, 0x61, 0xFC, 0xCD, 0x52, 0x08, 0x6D, 0xA1, 0xF3, 0x0E, 0xBC, 0x99, 0x05,
-    0xF2, 0xDC, 0xD7, 0xF8, 0x3B, 0x41, 0x6F, 0xD4, 0x53, 0xC0, 0xA4, 0x89, 0x6D, 0x97, 0xB2, 0x36,
-    0x76, 0x04, 0x76, 0x0A, 0x18, 0x1E, 0x6C, 0x00, 0x7D, 0x42, 0x2D, 0x0A, 0x0F, 0x98, 0x60, 0x07,
-    0x46, 0xA2, 0x81, 0xB3, 0xDA, 0x45, 0x57, 0xCD, 0x6F, 0x4C, 0x58, 0x17, 0xD7, 0x78, 0x1B, 0xF9,
-    0xC6, 0x9E, 0xAE, 0xAA, 0xD7, 0x80, 0x4A, 0xB7, 0x8A, 0xAB, 0x94, 0x86, 0x6C, 0x42, 0xF6, 0xAE,
-    0x0E, 0x89, 0xC0, 0xA0, 0x4F, 0xAF, 0x69, 0x55, 0x26, 0x3D, 0xE8, 0xD4, 0xBA, 0x2A, 0x38, 0x8E,
-    0xDA, 0xDC, 0xBD, 0xC8, 0x19, 0x4D, 0x53, 0x0F, 0x9B, 0x29, 0xCF, 0xC1, 0x95, 0xFD, 0x1E, 0x3B,
-    0x90, 0x87, 0x70, 0x85, 0x72, 0x91, 0x4B, 0x7D, 0x77, 0x7A, 0xA3, 0xC4, 0x9E, 0x21, 0x45, 0x62,
-    0x1B, 0x21, 0x9B, 0x73, 0xAC, 0x1D, 0x80, 0x51, 0x1B, 0x0B, 0x84, 0x9F, 0xCE, 0x40, 0x9D, 0x5E,
-    0x47, 0x35, 0xFD, 0xEF, 0x11, 0x98, 0x1E, 0x2B, 0x58, 0xE6, 0x04, 0x36, 0xF2, 0x1C, 0x4A, 0xDB,
-    0x97, 0x0C, 0x44, 0x26, 0xF6, 0x37, 0x58, 0xA8, 0x5D, 0x6A, 0x1D, 0xB8, 0x90, 0xC0, 0xF9, 0xD4,
-    0x66, 0xCC, 0xFC, 0x6B, 0x6C, 0xF8, 0x11, 0xF4, 0x9A, 0x90, 0xD5, 0x79, 0xB5, 0x11, 0x72, 0x52,
-    0xC0, 0x2B, 0x83, 0xA2, 0xEA, 0x79, 0x5F, 0xF9, 0x78, 0x8A, 0x88, 0xB0, 0x38, 0xC9, 0xCD, 0x12,
-    0xC1, 0x9D, 0x5E, 0x86, 0xF7, 0xFD, 0xD1, 0x68, 0x71, 0xA1, 0xF6, 0x48, 0xA5, 0xFD, 0x55, 0x45,
-    0x5A, 0xEA, 0xF0, 0x80, 0xEA, 0x9C, 0xEC, 0xF5, 0xEC, 0x65, 0x44, 0x95, 0x5A, 0xE0, 0x9F, 0x56,
-    0x49, 0x89, 0xED, 0x03, 0x58, 0x1A, 0x2E, 0x40, 0x44, 0x97, 0x21, 0xA2, 0xA9, 0x82, 0xDC, 0xF6,
-    0x20, 0xB7, 0x5F, 0xC2, 0x6C, 0xBD, 0xC9, 0x00, 0xAF, 0x90, 0x12, 0x4F, 0xEC, 0x75, 0x90, 0xD5,
-    0xEE, 0x61, 0x59, 0x1F, 0xE7, 0xBA, 0x23, 0x01, 0xF3, 0x7C, 0xFA, 0xDD, 0x4F, 0xB9, 0xF5, 0xE6,
-    0x76, 0xBC, 0xFD, 0xBD, 0x66, 0xA5, 0x2D, 0x97, 0xFE, 0xC0, 0xFA, 0x1A, 0x49, 0x22, 0xE4, 0x49,
-    0x7B, 0x96, 0x99, 0x56, 0x9A, 0x42, 0x9C, 0xE0, 0x83, 0x1B, 0xF3, 0xAF, 0xE6, 0x6F, 0x3F, 0x96,
-    0x32, 0x33, 0x5F, 0x06, 0xD8, 0xC9, 0xEE, 0x85, 0x53, 0xDC, 0xC2, 0x3F, 0xEE, 0x05, 0xE5, 0x04,
-    0x83, 0xC0, 0x75, 0x7F, 0x42, 0xF9, 0xA6, 0x45, 0xD3, 0x6E, 0x86, 0x75, 0x3B, 0xCA, 0xFF, 0xEE,
-    0x26, 0x98, 0x6B, 0xAC, 0x84, 0xDE, 0x51, 0x62, 0x14, 0xCD, 0xB8, 0x0F, 0xC9, 0xFC, 0xA1, 0xB2,
-    0x4F, 0xED, 0xD9, 0xC5, 0x19, 0x66, 0x20, 0x84, 0xD5, 0xC1, 0xE0, 0xBC, 0xBD, 0xA0, 0x07, 0x82,
-    0x90, 0x0F, 0x7E, 0x9B, 0xB8, 0xBC, 0x08, 0xB1, 0x5B, 0x32, 0x97, 0x2E, 0xAF, 0x3F, 0x58, 0xB3,
-    0xEB, 0xB2, 0xF8, 0x42, 0x13, 0x23, 0x0A, 0x9B, 0x1F, 0xDC, 0xA9, 0xC5, 0x62, 0x6E, 0xCA, 0xD8,
-    0xFC, 0xF9, 0x7C, 0xC3, 0xD4, 0x3D, 0xE2, 0x79, 0xF7, 0x50, 0x33, 0x45, 0xB3, 0xD3, 0x19, 0x68,
-    0x98, 0x2D, 0x40, 0xAD, 0xD3, 0x6F, 0xF7, 0x56, 0x45, 0x81, 0x44, 0xCB, 0xD1, 0x4C, 0x05, 0x93,
-    0xE7, 0x1A, 0xB7, 0x9E, 0xDB, 0x01, 0xB6, 0x74, 0xC6, 0x20, 0x23, 0x91, 0xD2, 0x2F, 0x05, 0x8E,
-    0xD4, 0xF2, 0x43, 0x2D, 0x09, 0x7E, 0xDD, 0xDA, 0xB7, 0x50, 0xD4, 0x52, 0x27, 0x96, 0x95, 0xC1,
-    0xB5, 0xC7, 0x7A, 0x24, 0xD7, 0x14, 0x84, 0x1E, 0x26, 0xA6, 0xD5, 0xC1, 0x02, 0x2D, 0x45, 0xD5,
-    0x16, 0xA2, 0xDF, 0x69, 0x57, 0xAB, 0x2C, 0x7F, 0xBD, 0x62, 0x09, 0xAA, 0x4E, 0xAD, 0x69, 0x10,
-    0x0D, 0x8E, 0x77, 0xDA, 0x8B, 0x45, 0x1C, 0xD8, 0x99, 0xAD, 0xD0, 0xEE, 0xCB, 0x93, 0x2F, 0x23,
-    0x48, 0xCB, 0xBF, 0x65, 0xA4, 0x59, 0xE9, 0x16, 0xB9, 0x79, 0xD6, 0x40, 0x98, 0x87, 0x72, 0xB3,
-    0xF5, 0xEC, 0xA6, 0x1B, 0xF8, 0xB3, 0x0D, 0x57, 0xD9, 0xD5, 0xC2, 0x15, 0xAE, 0xE7, 0x49, 0xEB,
-    0x07, 0xF6, 0xAF, 0xE5, 0x25, 0xDF, 0xFD, 0xDC, 0xDC, 0xF3, 0xA4, 0xAD, 0x74, 0xD6, 0x6A, 0x63,
-    0x36, 0x34, 0x6F, 0x62, 0x3B, 0xAC, 0x50, 0x86, 0xA9, 0xA7, 0xA5, 0x02, 0x81, 0x96, 0x71, 0xC4,
-    0x93, 0x16, 0x3F, 0xB8, 0x96, 0x9B, 0xA5, 0xCF, 0x7A, 0xCC, 0x32, 0x61, 0xFA, 0x61, 0x9B, 0x8D,
-    0xC5, 0x1A, 0xDD, 0xD0, 0xA6, 0xE3, 0x40, 0xE3, 0x81, 0xB1, 0x65, 0xD3, 0x4B, 0xD6, 0xB3, 0xDA,
-    0x41, 0x34, 0x92, 0x9D, 0x7A, 0x25, 0xDE, 0x10, 0x5F, 0xC1, 0xAF, 0x7A, 0x28, 0x96, 0x41, 0xD8,
-    0xA0, 0x43, 0x90, 0x3E, 0xA0, 0xB2, 0x0E, 0x81, 0x16, 0x52, 0xB8, 0x5C, 0x80, 0x23, 0xD0, 0x80,
-    0x03, 0x1E, 0x70, 0x62, 0x86, 0xB9, 0xD2, 0x3B, 0xD4, 0x08, 0x98, 0x12, 0x8E, 0xEE, 0x20, 0x6A,
-    0x0E, 0x53, 0x7D, 0xA7, 0xD9, 0x01, 0x92, 0x3C, 0x27, 0x2C, 0x1D, 0x0B, 0x7B, 0x1E, 0x1D, 0xF6,
-    0xC4, 0x3D, 0xA8, 0xEE, 0x6A, 0xEE, 0x64, 0xCC, 0x25, 0xB6, 0x2E, 0xF8, 0xF2, 0x8E, 0x1F, 0x3A,
-    0x05, 0x6D, 0x99, 0xD6, 0x39, 0x8D, 0xC6, 0x7B, 0x14, 0xA5, 0x6C, 0x5A, 0x1A, 0x35, 0xB7, 0x05,
-    0x25, 0x73, 0x75, 0xE6, 0x32, 0x51, 0x26, 0xA1, 0xD6, 0xF6, 0x30, 0xFF, 0x0E, 0xB2, 0x36, 0x25,
-    0xD7, 0x19, 0x40, 0xB3, 0xCB, 0x3D, 0x6D, 0xC3, 0x21, 0x93, 0x74, 0xC1, 0xCB, 0x34, 0x82, 0x69,
-    0xAF, 0x68, 0x37, 0xD1, 0x77, 0x68, 0x5D, 0x27, 0x36, 0x3B, 0x64, 0x9C, 0x86, 0x06, 0xCF, 0xC2,
-    0xAF, 0x4A, 0x14, 0xA7, 0xC6, 0x13, 0xEB, 0xD2, 0x2B, 0x8C, 0x13, 0x86, 0xBB, 0xCE, 0x48, 0xB4,
-    0x1C, 0xFD, 0x92, 0x48, 0x53, 0xE1, 0xDD, 0x46, 0xF2, 0x30, 0xD4, 0x95, 0x44, 0xD3, 0x77, 0x73,
-    0x9B, 0xBA, 0x6B, 0x9A, 0x1B, 0x37, 0x6A, 0xD9, 0x9C, 0xAF, 0xA7, 0xCD, 0xD1, 0x9E, 0xA8, 0xA2,
-    0x38, 0xA8, 0xA2, 0xA8, 0xE7, 0x64, 0x35, 0x19, 0x28, 0x30, 0x3A, 0x38, 0x3D, 0xAC, 0xF5, 0xBB,
-    0xE0, 0x69, 0xAB, 0x7D, 0x1B, 0x91, 0x76, 0x28, 0x4D, 0x33, 0xB5, 0x9B, 0xC9, 0x0F, 0x55, 0x29,
-    0x37, 0x0E, 0x86, 0x96, 0x51, 0xEF, 0xCF, 0x9C, 0x47, 0xEF, 0x7C, 0x4C, 0xEC, 0x3A, 0x20, 0xD3,
-    0x93, 0x5F, 0xD3, 0xEB, 0x48, 0x3A, 0xF6, 0x04, 0x38, 0xFF, 0x32, 0xD5, 0x7B, 0x3A, 0xDA, 0x8F,
-    0x70, 0x2E, 0x6F, 0xF1, 0x69, 0x01, 0xB1, 0xD4, 0xC2, 0x00, 0xB1, 0x82, 0xC2, 0x80, 0x54, 0xDC,
-    0x90, 0x0B, 0xBD, 0x36, 0x9D, 0xB2, 0x43, 0x98, 0x50, 0xFE, 0xE7, 0x1F, 0xDA, 0xB4, 0x60, 0x57,
-    0x83, 0x0B, 0x66, 0x30, 0xC0, 0xC1, 0x30, 0x67, 0xC5, 0x05, 0x1B, 0x1D, 0xD1, 0xE8, 0x62, 0x3C,
-    0xD4, 0x41, 0xEF, 0x23, 0xA3, 0x2B, 0x37, 0xE8, 0xBC, 0xB9, 0xC0, 0xBC, 0x8F, 0x84, 0x91, 0xBD,
-    0x70, 0x38, 0x02, 0x82, 0x88, 0x3A, 0x79, 0x09, 0x5B, 0x11, 0xA0, 0x5F, 0x26, 0x0A, 0x2F, 0x7A,
-    0x4E, 0x10, 0x6C, 0x60, 0xA0, 0xEB, 0x9A, 0xF6, 0xE2, 0xA9, 0x29, 0x47, 0x55, 0x29, 0x9B, 0x2C,
-    0xC6, 0xA8, 0x34, 0xC5, 0x28, 0xAA, 0x90, 0xB8, 0x97, 0x25, 0x6C, 0x77, 0x87, 0xEA, 0xCF, 0xE9,
-    0x41, 0xCB, 0xF6, 0x00, 0x96, 0x92, 0xA3, 0x5E, 0xB6, 0x9F, 0x97, 0xF1, 0xDB, 0x9D, 0x96, 0x07,
-    0x83, 0x1B, 0x3F, 0xD3, 0x97, 0xB5, 0x53, 0x3B, 0xB4, 0x71, 0xD4, 0x87, 0x80, 0x17, 0xCA, 0xEE,
-    0x50, 0x4E, 0x29, 0xFF, 0xDA, 0xAC, 0x0D, 0x07, 0xB1, 0xCC, 0x55, 0x34, 0x99, 0xE4, 0xAC, 0xE8,
-    0x44, 0x59, 0x88, 0x56, 0x60, 0xA4, 0x9E, 0x6B, 0x43, 0x68, 0x88, 0x60, 0xE5, 0xE8, 0x3B, 0x82,
-    0x2D, 0x7E, 0x8D, 0xB1, 0xC8, 0xBA, 0x33, 0xA2, 0xFF, 0x24, 0xB6, 0x6F, 0xA0, 0x02, 0x4B, 0x56,
-    0x47, 0x50, 0xF3, 0xE0, 0x53, 0xAB, 0x32, 0x60, 0x38, 0xFC, 0x2C, 0x26, 0x23, 0xF6, 0x63, 0x97,
-    0x02, 0xAA, 0x25, 0xB5, 0x45, 0xE1, 0x50, 0x73, 0xFC, 0xCD, 0xC4, 0x4A, 0xEF, 0xA7, 0xAE, 0xE3,
-    0x40, 0x75, 0x44, 0x46, 0xFD, 0xC3, 0x96, 0xBD, 0x06, 0x59, 0x9D, 0xD6, 0x07, 0x1B, 0x0D, 0xB6,
-    0x18, 0x1B, 0x67, 0x03, 0x2E, 0xFE, 0x89, 0xDB, 0x99, 0xB4, 0xC5, 0xD2, 0x1F, 0x04, 0xE7, 0x16,
-    0x32, 0xFE, 0x3B, 0xB8, 0x7D, 0x47, 0xC6, 0x78, 0xB3, 0x76, 0xD9, 0xE4, 0x0C, 0xEC, 0x08, 0x43,
-    0x12, 0x61, 0xEA, 0x77, 0x05, 0xF1, 0xFC, 0x5A, 0x8C, 0x5B, 0xC7, 0xFE, 0x62, 0x5B, 0xA1, 0x80,
-    0x64, 0x22, 0xC3, 0xBD, 0x87, 0x76, 0x6E, 0x46, 0x1D, 0x33, 0x73, 0x2F, 0x06, 0x03, 0xDD, 0x1E,
-    0x7D, 0x58, 0x76, 0xF8, 0xD0, 0x38, 0xC1, 0x90, 0xF9, 0x30, 0x1C, 0x1A, 0xE3, 0x39, 0xA9, 0xD8,
-    0x30, 0xD1, 0xC8, 0xF9, 0x10, 0x0F, 0x9E, 0x15, 0x2F, 0x3D, 0x3D, 0x6B, 0xCB, 0xB0, 0x15, 0x9C,
-    0xF1, 0x74, 0x42, 0xF7, 0x1D, 0x89, 0x2F, 0xF6, 0x28, 0x28, 0x80, 0x04, 0x24, 0xF8, 0xDF, 0x56,
-    0xB0, 0x31, 0xB0, 0x7C, 0x26, 0xE6, 0xE2, 0x01, 0xEE, 0x25, 0x70, 0x85, 0x45, 0x35, 0x4B, 0x4D,
-    0xE5, 0xCC, 0xDD, 0xDD, 0x08, 0xE6, 0x61, 0x92, 0xFA, 0x50, 0x34, 0x14, 0x9A, 0x42, 0xF5, 0x61,
-    0xFC, 0xB1, 0xB2, 0x7A, 0xFD, 0x6A, 0x6F, 0x8C, 0xED, 0x5C, 0x0E, 0xD2, 0xC6, 0x9B, 0x90, 0x8C,
-    0x67, 0x7F, 0x7B, 0x76, 0xA5, 0x77, 0x89, 0x08, 0x75, 0xB8, 0xED, 0xCD, 0x3B, 0xAD, 0xE5, 0xEF,
-    0x27, 0x62, 0x93, 0x2A, 0x53, 0x94, 0x68, 0x62, 0xF7, 0x6D, 0x56, 0x33, 0xEE, 0x48, 0x09, 0x64,
-    0xED, 0x5C, 0x30, 0xF0, 0x61, 0x4C, 0x6B, 0xF6, 0xD4, 0xA1, 0xD0, 0xC9, 0x72, 0x57, 0x1B, 0xFC,
-    0x9D, 0x77, 0x07, 0xAF, 0x55, 0xD3, 0xC2, 0x9E, 0xEF, 0x51, 0x53, 0x34, 0xD8, 0x5C, 0xA0, 0x41,
-    0xF1, 0x64, 0x2B, 0x07, 0x61, 0x5F, 0x00, 0x27, 0x14, 0x66, 0x47, 0x0E, 0x90, 0xE5, 0x4A, 0xC7,
-    0x8D, 0xDE, 0x87, 0x1B, 0x74, 0x10, 0xDA, 0xB7, 0x34, 0xB6, 0x33, 0xAC, 0x1C, 0xB1, 0x64, 0xDE,
-    0xF9, 0x65, 0x93, 0x35, 0x1A, 0xAD, 0xD3, 0x60, 0xA4, 0xE7, 0x62, 0x7A, 0x57, 0x07, 0x82, 0x7D,
-    0x4D, 0xDD, 0xA4, 0x5A, 0xFB, 0xEE, 0x36, 0x1B, 0x09, 0xAC, 0x2B, 0x6A, 0xC7, 0xCF, 0x0A, 0x06,
-    0x9C, 0x6D, 0x6B, 0x15, 0xF1, 0x8E, 0xAB, 0xEA, 0xDA, 0xB9, 0xA4, 0xFA, 0x9D, 0xBE, 0xE8, 0x3D,
-    0x2A, 0x47, 0xA8, 0xCD, 0x31, 0x70, 0x6F, 0xC7, 0x75, 0xCD, 0x08, 0x02, 0x59, 0xAC, 0xBA, 0x4A,
-    0xE7, 0x4D, 0x4E, 0x50, 0x74, 0x0F, 0x1B, 0x8E, 0xE9, 0x95, 0xBA, 0x88, 0xA3, 0xAF, 0xB5, 0x0A,
-    0x62, 0x3B, 0x40, 0x6D, 0xAB, 0xB8, 0xF2, 0xEC, 0xC4, 0x58, 0x51, 0xA5, 0x31, 0xA5, 0x8D, 0xBC,
-    0x9C, 0x0B, 0x6E, 0x1F, 0x6E, 0x88, 0xBE, 0xF5, 0x44, 0xC9, 0xD6, 0xB6, 0xCE, 0xF5, 0x4F, 0x56,
-    0x1A, 0xDC, 0xAF, 0x62, 0xD1, 0xE1, 0x73, 0x62, 0xA0, 0xDB, 0x9F, 0xB0, 0xCF, 0x26, 0xD2, 0x46,
-    0x10, 0xC4, 0x76, 0x2D, 0x1C, 0xF2, 0x73, 0x76, 0xAE, 0x6E, 0xBB, 0x0E, 0xD1, 0xAC, 0xBE, 0x28,
-    0xEF, 0xE4, 0x5E, 0x12, 0x85, 0x36, 0x54, 0xD4, 0xEC, 0x16, 0xF6, 0x9E, 0xBD, 0xD1, 0x7C, 0x3B,
-    0x5E, 0xD9, 0x67, 0x75, 0x9B, 0xA3, 0x25, 0x51, 0xD7, 0x46, 0xCF, 0xE7, 0x0D, 0xE2, 0xDB, 0x7B,
-    0xD3, 0x60, 0xAF, 0x18, 0x77, 0x03, 0xAE, 0x67, 0x72, 0xD5, 0x96, 0x7D, 0xEB, 0xE4, 0x75, 0x6B,
-    0xB0, 0xFF, 0x0C, 0x33, 0x27, 0xE2, 0x16, 0x7C, 0x53, 0x33, 0x24, 0x17, 0x97, 0x1A, 0x80, 0x25,
-    0x88, 0xCD, 0x08, 0xEC, 0x8C, 0xB7, 0x4C, 0xBB, 0x6B, 0xC5, 0x29, 0xE7, 0x5E, 0x89, 0x42, 0xCD,
-    0xFD, 0x1F, 0x2C, 0xC3, 0x28, 0xE8, 0x34, 0x46, 0xB2, 0x27, 0x8F, 0xE9, 0x32, 0xE4, 0x2A, 0xA9,
-    0xCE, 0x0D, 0xE9, 0x83, 0x39, 0x74, 0x0F, 0xEA, 0xE8, 0x5D, 0xA0, 0x1E, 0xD2, 0x6D, 0x0F, 0xA1,
-    0x50, 0xBA, 0xE3, 0xC7, 0xD4, 0x4E, 0xCC, 0x38, 0xB9, 0x5D, 0xC2, 0x02, 0xE7, 0xAF, 0x87, 0x0E,
-    0x50, 0x7A, 0x0B, 0x46, 0x98, 0xCD, 0xF3, 0x86, 0xB5, 0x06, 0xCB, 0x6F, 0x32, 0x1E, 0x88, 0x9C,
-    0x92, 0x3A, 0x0C, 0xF1, 0x0B, 0x9C, 0xA6, 0xCB, 0xA4, 0x7D, 0x9B, 0xED, 0xEA, 0x1E, 0x1B, 0xCD,
-    0xA3, 0xE0, 0x41, 0xCE, 0x1A, 0xC2, 0xA6, 0x40, 0x15, 0x56, 0x0B, 0x9C, 0x9E, 0x0E, 0x6E, 0x3F,
-    0x8B, 0x08, 0xB0, 0x02, 0x31, 0x66, 0xEE, 0xE5, 0x76, 0x1D, 0x27, 0x72, 0x9E, 0x68, 0x78, 0x62,
-    0xF0, 0xB8, 0x73, 0x88, 0xD5, 0xBC, 0x94, 0x2A, 0xFD, 0x54, 0x21, 0x82, 0x34, 0xC2, 0x17, 0xDC,
-    0x3E, 0xED, 0x9D, 0xDC, 0x5C, 0x1A, 0x95, 0x30, 0xEE, 0x37, 0xB7, 0xF2, 0x0D, 0xAE, 0xB1, 0xEB,
-    0xC2, 0xCA, 0xD4, 0xE4, 0x5B, 0xBB, 0xBB, 0x5F, 0x54, 0x68, 0x63, 0x45, 0xAE, 0x32, 0x7E, 0x94,
-    0x85, 0x20, 0x09, 0x73, 0x89, 0xFC, 0xFD, 0x80, 0x05, 0x69, 0x56, 0x82, 0x74, 0x72, 0x45, 0x8C,
-    0x0F, 0xA5, 0x7A, 0xDC, 0x17, 0xA4, 0x51, 0x6F, 0x88, 0xFD, 0x99, 0xA0, 0xEF, 0x0D, 0x3B, 0x68,
-    0x24, 0xCF, 0x95, 0x2F, 0xB8, 0x42, 0x50, 0x9D, 0x6E, 0xC7, 0xB9, 0x26, 0x7B, 0x28, 0x26, 0x99,
-    0x37, 0x9B, 0xD1, 0x90, 0x9A, 0xCA, 0xD3, 0x63, 0x60, 0xEA, 0x88, 0x02, 0xD7, 0xAA, 0xD9, 0x3E,
-    0x23, 0x64, 0x77, 0x31, 0x1A, 0x2E, 0xC6, 0x90, 0x3A, 0x8D, 0xCD, 0x39, 0xDE, 0x9D, 0xD8, 0x36,
-    0x4F, 0x74, 0x3C, 0x31, 0xEA, 0x89, 0x3A, 0x61, 0x99, 0xA6, 0x4B, 0xE5, 0xE8, 0xCC, 0x7C, 0x9D,
-    0xE5, 0x2F, 0x2F, 0x43, 0x40, 0xA7, 0x36, 0x76, 0xCC, 0x30, 0xD8, 0x81, 0xE6, 0x4F, 0x35, 0xDF,
-    0x4E, 0x24, 0x1B, 0x4C, 0xDA, 0x97, 0x97, 0xB9, 0xD4, 0xA9, 0xDB, 0x52, 0x71, 0xDE, 0x58, 0xCF,
-    0x7B, 0xEA, 0x8F, 0x42, 0xA4, 0x9A, 0xFC, 0xF3, 0x5A, 0xF3, 0x09, 0xAE, 0xBA, 0x31, 0x44, 0xBA,
-    0xBF, 0xD7, 0xCC, 0x3D, 0x85, 0x5A, 0x94, 0xB3, 0xEE, 0x7F, 0xBF, 0x29, 0xA7, 0xE8, 0x56, 0xEE,
-    0xB2, 0x5B, 0xB9, 0x43, 0xB1, 0x1A, 0x1A, 0x89, 0x34, 0xF7, 0xD5, 0x68, 0x7D, 0xC5, 0xF3, 0x81,
-    0x1E, 0xB6, 0x99, 0x62, 0xE8, 0x37, 0x34, 0x30, 0x32, 0x97, 0x72, 0xEF, 0x7F, 0xCC, 0x2D, 0xF1,
-    0xF6, 0x33, 0x66, 0xB5, 0x7B, 0x57, 0x7C, 0x85, 0x55, 0x49, 0xCB, 0x82, 0x65, 0xB7, 0x48, 0x62,
-    0x9B, 0xE7, 0x89, 0xA6, 0xD3, 0x92, 0x5B, 0x4D, 0x5D, 0x26, 0x03, 0x0B, 0xBE, 0x6E, 0xEF, 0xDF,
-    0x9C, 0x53, 0xDA, 0x37, 0x1E, 0x87, 0xF3, 0x53, 0xF3, 0x0D, 0xC2, 0x81, 0x86, 0xEE, 0x58, 0x38,
-    0x05, 0x9A, 0x17, 0x6C, 0xB4, 0x78, 0xB5, 0x63, 0x98, 0x2C, 0xEE, 0xB9, 0x79, 0x80, 0x37, 0x1A,
-    0x92, 0xF4, 0x67, 0xE8, 0xBB, 0xFE, 0x63, 0x58, 0x7D, 0xFF, 0x84, 0xC1, 0xD5, 0xA0, 0x03, 0x78,
-    0xF6, 0x98, 0xD2, 0x30, 0xF6, 0x0B, 0x4C, 0xA8, 0x9C, 0xE3, 0x96, 0x36, 0x2F, 0x73, 0x2B, 0xC1,
-    0x65, 0xC5, 0x8A, 0x0F, 0xCE, 0x92, 0x1F, 0x87, 0xE5, 0xCD, 0x6A, 0xC6, 0x6F, 0x56, 0xDB, 0x3B,
-    0xAC, 0x6D, 0xEF, 0xB4, 0x69, 0x7B, 0xAD, 0xF3, 0x8D, 0xAD, 0xA6, 0x15, 0xB4, 0xF0, 0x7E, 0xCF,
-    0xD9, 0xDE, 0xAD, 0x33, 0x1A, 0x4B, 0x99, 0xB7, 0x39, 0x53, 0xCB, 0xE5, 0xCA, 0xC2, 0x5C, 0x1B,
-    0xF1, 0xDC, 0x58, 0x0A, 0x31, 0xE7, 0x1B, 0xA9, 0x03, 0x9A, 0xEC, 0x8F, 0x4E, 0x22, 0x8D, 0x4A,
-    0x44, 0x37, 0xB4, 0xD5, 0x57, 0xA5, 0xC2, 0x05, 0x9C, 0x75, 0xCF, 0xD1, 0xC4, 0xFE, 0x78, 0xBD,
-    0x96, 0xA6, 0x07, 0x5A, 0x9B, 0xFE, 0x79, 0x5D, 0x74, 0xB5, 0x42, 0x7F, 0xF1, 0xAA, 0x7A, 0x29,
-    0xB0, 0xAB, 0x98, 0x04, 0x42, 0x20, 0x73, 0xF9, 0x95, 0x2B, 0xC0, 0x42, 0x18, 0x79, 0x6E, 0xA6,
-    0xFF, 0x6B, 0xAD, 0x55, 0x3A, 0xF2, 0x6F, 0x8B, 0x40, 0x05, 0xB3, 0xFA, 0x3E, 0x46, 0xA9, 0x91,
-    0x9D, 0x19, 0x33, 0xFA, 0x43, 0x08, 0x32, 0xBC, 0xC0, 0xA0, 0x14, 0x92, 0x6C, 0x9D, 0xCF, 0x46,
-    0x8C, 0x1A, 0x09, 0x5A, 0x84, 0xFE, 0x99, 0x5E, 0xE7, 0xA6, 0x27, 0xC8, 0x27, 0x66, 0x98, 0x81,
-    0x35, 0x38, 0x0B, 0xEF, 0x34, 0x1B, 0xD9, 0x00, 0x54, 0x31, 0x06, 0x11, 0xA0, 0x84, 0x89, 0x9B,
-    0x96, 0x19, 0x6C, 0x7B, 0xCB, 0xA8, 0x59, 0x8B, 0xA2, 0xA2, 0x84, 0xA9, 0x80, 0xBC, 0x42, 0x16,
-    0x8E, 0xD9, 0xCA, 0xF8, 0x4D, 0xCB, 0x74, 0x6A, 0x28, 0x8F, 0x8D, 0x6D, 0xA0, 0xDB, 0xF8, 0xA4,
-    0xCB, 0xAA, 0xD5, 0xB0, 0xD1, 0x2B, 0x22, 0xBC, 0xFB, 0xB9, 0xED, 0xCC, 0x94, 0xD5, 0x59, 0x4F,
-    0x51, 0xDB, 0x3F, 0x88, 0x3B, 0x75, 0xBE, 0xE5, 0x9A, 0x56, 0xE5, 0xBA, 0xB9, 0x0C, 0x77, 0xB8,
-    0x53, 0xF5, 0x09, 0xB8, 0xAD, 0xD9, 0x2A, 0x54, 0xAE, 0xCD, 0x49, 0x1E, 0x87, 0xDE, 0xCD, 0xDC,
-    0x9C, 0x6B, 0x8F, 0x3A, 0x57, 0xEA, 0x4B, 0x65, 0x8D, 0xC7, 0xAB, 0xEC, 0xDE, 0x7F, 0x6C, 0xC4,
-    0x94, 0xCC, 0x6A, 0xAF, 0x11, 0xDC, 0xCE, 0xF1, 0x39, 0x3B, 0xAF, 0x4A, 0x18, 0xB7, 0x99, 0xB6,
-    0x6B, 0x8C, 0x9E, 0x4B, 0x33, 0x94, 0x51, 0xF9, 0x36, 0xE8, 0x1D, 0x11, 0xAE, 0x2D, 0xF1, 0xFD,
-    0xD8, 0x25, 0x61, 0xF3, 0x0C, 0x85, 0x41, 0x75, 0x22, 0x74, 0x09, 0xBD, 0xB2, 0xBA, 0xA3, 0xD5,
-    0x5D, 0x4B, 0x81, 0xB2, 0xA5, 0x07, 0xB9, 0x34, 0xE1, 0x80, 0x19, 0x24, 0xAB, 0x8E, 0xF8, 0xF1,
-    0x55, 0x2B, 0x7E, 0x7C, 0x8C, 0xC6, 0x66, 0x28, 0x3F, 0x30, 0x4D, 0x97, 0x5C, 0xEC, 0x13, 0xD4,
-    0xF4, 0x9C, 0xED, 0xED, 0x59, 0x74, 0x38, 0x0C, 0xD9, 0xFD, 0x03, 0x46, 0x64, 0x2F, 0xB4, 0xC5,
-    0x05, 0xC4, 0x5A, 0xA7, 0x9F, 0x07, 0x53, 0xA5, 0xC5, 0x69, 0xDC, 0x42, 0xC3, 0xC7, 0x96, 0x34,
-    0xA3, 0xEE, 0x98, 0xAC, 0xFA, 0x85, 0x22, 0x1F, 0x6D, 0xF1, 0x75, 0x8D, 0xD5, 0x68, 0xB1, 0x3F,
-    0xE8, 0x81, 0x9C, 0x32, 0xEB, 0xF6, 0x0D, 0xD7, 0xFC, 0xE5, 0x36, 0xFB, 0x2D, 0x5E, 0xE4, 0x8E,
-    0xA7, 0xDC, 0x6C, 0xC6, 0x64, 0x35, 0x35, 0xFF, 0xEB, 0x07, 0x36, 0x7D, 0x9E, 0xD7, 0x11, 0xF9,
-    0xF7, 0xB0, 0xC5, 0xBE, 0xD0, 0x30, 0x52, 0xDA, 0xCA, 0xD3, 0x63, 0xEB, 0x27, 0x88, 0x04, 0x7B,
-    0x38, 0x4C, 0x8C, 0xB5, 0x14, 0x03, 0xAB, 0x0B, 0xB5, 0x8A, 0x08, 0x7D, 0x36, 0x23, 0x67, 0x78,
-    0xAA, 0xB1, 0x39, 0xED, 0xBA, 0x78, 0x92, 0xAB, 0x97, 0x2D, 0x34, 0xB0, 0x31, 0x6E, 0xB4, 0xA0,
-    0x65, 0xAE, 0x31, 0x5C, 0x67, 0x88, 0x7E, 0xE7, 0x4A, 0x82, 0x62, 0xBB, 0xD9, 0xCF, 0x76, 0xE0,
-    0x54, 0xEA, 0xCA, 0x98, 0xC9, 0x85, 0x55, 0x96, 0x83, 0x12, 0xDF, 0x5E, 0xAE, 0xAB, 0x89, 0x02,
-    0x87, 0xF9, 0xB8, 0x68, 0x4E, 0x7C, 0xBA, 0x65, 0xDA, 0xC9, 0x32, 0xF6, 0x90, 0xE5, 0xF1, 0x91,
-    0x82, 0xE7, 0x7E, 0x75, 0x98, 0x65, 0x3E, 0x9B, 0x93, 0xCB, 0x02, 0xFF, 0x01, 0x3A, 0x62, 0x7E,
-    0x69, 0x03, 0x61, 0x81, 0x1A, 0x06, 0x24, 0x86, 0x42, 0x91, 0x49, 0xCF, 0x29, 0x83, 0xF4, 0xF1,
-    0x18, 0xD8, 0x15, 0xD5, 0x45, 0x0B, 0x7E, 0xC4, 0x63, 0xC6, 0x20, 0xFA, 0x0F, 0x59, 0xF0, 0xE5,
-    0xA4, 0x36, 0xAC, 0xF5, 0x32, 0xB3, 0x1B, 0xBD, 0xF2, 0x6E, 0x2B, 0x97, 0x76, 0x6D, 0x42, 0x93,
-    0xB5, 0xDD, 0x59, 0x90, 0x0C, 0xEE, 0xAC, 0xEA, 0xAA, 0x21, 0x02, 0xE5, 0x64, 0x71, 0x60, 0x0B,
-    0xB4, 0xA8, 0x23, 0x85, 0x45, 0x9B, 0xB1, 0x82, 0xEC, 0x65, 0xB0, 0x20, 0xB2, 0xBA, 0x79, 0x54,
-    0xCF, 0x1E, 0x08, 0xCF, 0x21, 0x8E, 0x83, 0x7B, 0x93, 0x19, 0x2E, 0x49, 0xE8, 0xB1, 0xBB, 0x68,
-    0x19, 0xCA, 0x4C, 0x35, 0x47, 0x0D, 0x9A, 0xB1, 0x8F, 0x03, 0x12, 0xCD, 0x0D, 0xA2, 0xB5, 0xA8,
-    0xFF, 0xCD, 0x48, 0x3B, 0x1B, 0xF3, 0xB8, 0x25, 0x6C, 0xE4, 0xFA, 0xAE, 0xE0, 0x41, 0xD9, 0x5F,
-    0xE9, 0xD8, 0x2E, 0x6A, 0x4D, 0xBD, 0xF6, 0x5E, 0x58, 0x57, 0x5E, 0xDE, 0x6C, 0xEC, 0xCC, 0x9C,
-    0x5D, 0xA7, 0xCC, 0xB1, 0x93, 0x01, 0x31, 0x81, 0xCB, 0x4A, 0xAE, 0x65, 0xEE, 0x12, 0x3E, 0xE1,
-    0x72, 0xCE, 0xF8, 0x78, 0xAE, 0x34, 0x7D, 0xDE, 0xE1, 0x5A, 0x77, 0xB0, 0xF8, 0xF4, 0x55, 0x36,
-    0x95, 0x8D, 0xD0, 0x4A, 0x26, 0x9B, 0xCF, 0xB1, 0x39, 0xC0, 0x6B, 0xDF, 0x2B, 0xB0, 0x89, 0x25,
-    0x36, 0xF9, 0x29, 0xB1, 0xB7, 0x26, 0xF3, 0xE5, 0xC7, 0xB5, 0x87, 0x4B, 0xD1, 0x35, 0x65, 0xC5,
-    0x00, 0x08, 0xD3, 0x65, 0x7A, 0x1C, 0x6F, 0x1C, 0x4F, 0xF3, 0x31, 0xF2, 0x68, 0x71, 0x2E, 0x26,
-    0xC0, 0x1B, 0xD8, 0xB2, 0x74, 0x96, 0x7D, 0xB1, 0x00, 0xA2, 0xD5, 0xF9, 0x75, 0xE4, 0x89, 0xDD,
-    0x03, 0x9D, 0x2B, 0x36, 0x59, 0x85, 0x05, 0x45, 0xDC, 0xB9, 0x0B, 0x1C, 0x92, 0xAD, 0xC5, 0x9C,
-    0x86, 0x4C, 0xE6, 0xCD, 0xBD, 0x0E, 0x6D, 0x98, 0xAC, 0x81, 0x23, 0xEC, 0x5A, 0xAE, 0xF1, 0x1E,
-    0x12, 0x34, 0xC4, 0xD8, 0x97, 0x3B, 0x83, 0xAD, 0xEF, 0x31, 0x0D, 0xF2, 0xD4, 0x3A, 0xF6, 0xAC,
-    0x92, 0x67, 0xB1, 0xDB, 0xF9, 0xF4, 0x69, 0x54, 0x9B, 0x2C, 0xB1, 0x15, 0xE5, 0x13, 0xB6, 0xF1,
-    0xC4, 0xCC, 0x2D, 0xCE, 0x74, 0xAB, 0x36, 0xA4, 0x40, 0xD7, 0x7F, 0xFE, 0x7D, 0x36, 0x9F, 0xBB,
-    0x6B, 0x74, 0x05, 0x4F, 0xA7, 0x55, 0x18, 0xEB, 0xC8, 0x5D, 0x70, 0x10, 0x69, 0xCB, 0xB3, 0xF9,
-    0x2E, 0x8E, 0xD2, 0x27, 0xA6, 0x67, 0xBF, 0x68, 0x61, 0x82, 0x8B, 0x31, 0xE0, 0x52, 0x25, 0x5E,
-    0xAC, 0x6D, 0xBD, 0xA7, 0x91, 0x39, 0x86, 0x6A, 0x94, 0x73, 0xB5, 0x1C, 0xB3, 0x95, 0x89, 0xEE,
-    0x9D, 0x44, 0xC4, 0xB7, 0x71, 0xBC, 0x9C, 0x8F, 0x91, 0x79, 0xEE, 0xD0, 0x96, 0x90, 0xA0, 0x43,
-    0x2C, 0x18, 0x40, 0x65, 0xF1, 0x22, 0xF6, 0x81, 0x19, 0xD6, 0xB1, 0x3D, 0x6D, 0xA2, 0xBA, 0xCF,
-    0x81, 0xCC, 0xB5, 0x7D, 0x24, 0x29, 0xC8, 0x86, 0x92, 0x2F, 0x9C, 0x83, 0xD1, 0xD1, 0xBB, 0xF9,
-    0xC8, 0x0D, 0xF6, 0x09, 0x4E, 0xE3, 0x99, 0x8E, 0x1A, 0x9B, 0xCD, 0x07, 0xAD, 0x98, 0xFB, 0xB8,
-    0x14, 0xB9, 0xDF, 0xC6, 0x88, 0x6F, 0xB2, 0x99, 0x5A, 0xD6, 0x7E, 0x4D, 0x5B, 0xDF, 0x01, 0xE3,
-    0xF6, 0x2D, 0xB9, 0x30, 0xE8, 0x85, 0xC7, 0xC9, 0xAF, 0xED, 0xE5, 0x85, 0x7D, 0x60, 0xEE, 0x23,
-    0xA1, 0x06, 0x96, 0xEB, 0x3C, 0x87, 0xEE, 0xE4, 0xAB, 0x89, 0x8E, 0x18, 0x15, 0x3C, 0x9A, 0xE9,
-    0x98, 0xAB, 0x08, 0x6B, 0x4E, 0xF0, 0x5B, 0x46, 0x9B, 0x31, 0xE6, 0xC6, 0x17, 0x78, 0x52, 0x27,
-    0xB2, 0xBA, 0xD7, 0xA8, 0x9F, 0xFE, 0x6E, 0xEB, 0x60, 0xA0, 0xED, 0x1D, 0x3E, 0xF4, 0x9E, 0xFF,
-    0x68, 0xB4, 0xF9, 0xF8, 0xB3, 0x34, 0x2A, 0xAC, 0x9F, 0x29, 0xB9, 0xCF, 0x7B, 0x36, 0xEE, 0x0D,
-    0xF8, 0xFF, 0x49, 0x68, 0x64, 0xF9, 0xFE, 0x04, 0xCB, 0x39, 0xD9, 0x90, 0x49, 0xDB, 0xC9, 0x30,
-    0xAD, 0x16, 0xE5, 0x36, 0xCE, 0x43, 0x7F, 0xEF, 0x5F, 0x4D, 0x2E, 0x2A, 0x51, 0xE8, 0x8E, 0x87,
-    0x42, 0xC2, 0xFF, 0x03, 0x75, 0x52, 0x31, 0x6F, 0xD5, 0x30, 0x10, 0xBE, 0x24, 0xCD, 0x8B, 0x50,
-    0x40, 0xEE, 0x82, 0x84, 0x10, 0x52, 0x56, 0x10, 0x12, 0x5E, 0x18, 0x18, 0x90, 0xCE, 0x74, 0xE9,
-    0xCA, 0x40, 0xE7, 0x32, 0x22, 0x96, 0xF7, 0x07, 0xA8, 0x92, 0xC2, 0xC0, 0xC0, 0xC0, 0xDB, 0x59,
-    0x3A, 0x30, 0xA0, 0x2E, 0xAC, 0x0C, 0xA8, 0x89, 0xF2, 0x86, 0xAE, 0xA9, 0x3A, 0xBC, 0x81, 0x01,
-    0x4B, 0x74, 0x41, 0x0C, 0x18, 0x14, 0x81, 0x2B, 0x2E, 0x39, 0xCE, 0x79, 0x15, 0x1B, 0x8E, 0xE5,
-    0xC8, 0x77, 0x9F, 0xCF, 0x9F, 0xBF, 0xFB, 0x52, 0xC8, 0x9A, 0x84, 0x22, 0x6E, 0xD0, 0x27, 0x6C,
-    0xB4, 0x8B, 0x08, 0x2E, 0x81, 0x8C, 0x05, 0x50, 0x32, 0x64, 0x83, 0x22, 0xDD, 0x63, 0x87, 0xE6,
-    0x4A, 0x88, 0x5D, 0x6F, 0x20, 0x61, 0x00, 0xF6, 0x50, 0xB0, 0x4D, 0x88, 0x81, 0x33, 0xD2, 0x5D,
-    0xD1, 0xF6, 0xF0, 0x21, 0xA4, 0x67, 0x67, 0xB3, 0x98, 0xBB, 0x8F, 0xC8, 0xEF, 0x8F, 0x99, 0x09,
-    0x15, 0xEF, 0x77, 0xDA, 0x86, 0x44, 0xBA, 0xF3, 0x28, 0x61, 0x1E, 0x4A, 0xE6, 0x95, 0x24, 0xD2,
-    0x9D, 0x1D, 0x23, 0xC1, 0x2D, 0x07, 0x37, 0xCA, 0x2A, 0x3B, 0xE5, 0x37, 0x84, 0xCC, 0x86, 0xB9,
-    0x8B, 0xEA, 0x05, 0xCC, 0x16, 0xDA, 0x23, 0x85, 0xAF, 0x70, 0x00, 0xBA, 0xD2, 0xAF, 0xC6, 0x7C,
-    0x64, 0xC7, 0x7F, 0xE4, 0x87, 0x0D, 0x36, 0xA1, 0xDC, 0x06, 0x64, 0x6C, 0x35, 0x7B, 0x5C, 0x11,
-    0xC6, 0xA4, 0x63, 0x82, 0xCC, 0xC3, 0xDC, 0x46, 0x6C, 0x80, 0x60, 0x4D, 0x05, 0x9E, 0x06, 0x8C,
-    0xFA, 0xDE, 0xEB, 0x2D, 0x42, 0x98, 0xE6, 0x03, 0xAF, 0xBF, 0xF5, 0x4A, 0x6E, 0x39, 0x82, 0xD8,
-    0x5C, 0x8B, 0x48, 0x75, 0xBC, 0x4D, 0xD8, 0x8E, 0xDA, 0xB2, 0x72, 0xF5, 0xCB, 0x1E, 0x5B, 0xAF,
-    0x9A, 0xFB, 0x71, 0x07, 0xEB, 0x11, 0xDB, 0x88, 0x4A, 0x83, 0x4B, 0x52, 0xAE, 0xF8, 0x39, 0x40,
-    0xCD, 0x55, 0xC2, 0x0E, 0xD4, 0x10, 0x48, 0x89, 0x42, 0x8F, 0x8B, 0x66, 0x50, 0x7D, 0xD9, 0x8E,
-    0xCA, 0x49, 0x8D, 0xDC, 0x63, 0xC3, 0x59, 0xAF, 0x9A, 0xA3, 0xC8, 0xAA, 0xE9, 0xF8, 0xFC, 0x0C,
-    0x4A, 0x76, 0x05, 0xF3, 0x72, 0x9C, 0xD3, 0x1E, 0xE0, 0xA9, 0x01, 0xBF, 0x19, 0x12, 0x0F, 0x63,
-    0xCA, 0x7B, 0xE5, 0x74, 0x17, 0x5E, 0x23, 0xCA, 0x3A, 0xED, 0x67, 0x8B, 0xC8, 0xE8, 0x5E, 0x93,
-    0xA2, 0x9C, 0x32, 0xCA, 0x7D, 0xC8, 0x96, 0xD5, 0x2D, 0x88, 0x4C, 0xE1, 0xD1, 0xA3, 0x43, 0x8B,
-    0x22, 0xA4, 0x72, 0x99, 0x8F, 0x07, 0x78, 0x72, 0xB3, 0x38, 0xFE, 0x35, 0xD4, 0xFA, 0xF5, 0xD2,
-    0xF5, 0x1B, 0x52, 0x4F, 0x2E, 0x7E, 0x3E, 0x0A, 0x13, 0x21, 0xDA, 0xDC, 0x95, 0x7D, 0x6E, 0xD7,
-    0xF2, 0xA1, 0xCF, 0x6D, 0x0A, 0xE9, 0xB6, 0xF4, 0x50, 0xE4, 0x63, 0x56, 0x5C, 0x77, 0xF5, 0xC9,
-    0x41, 0xF4, 0x56, 0x30, 0xA5, 0x2D, 0xF8, 0xC5, 0x0F, 0xDA, 0xCB, 0x57, 0xDD, 0x33, 0xDC, 0x6D,
-    0xB9, 0xCF, 0xCE, 0xA7, 0x93, 0xDA, 0x07, 0x0A, 0x81, 0x00, 0x76, 0x77, 0x24, 0x22, 0xAD, 0xA7,
-    0xDB, 0x63, 0x3C, 0x08, 0x65, 0x2F, 0x24, 0xCC, 0xF4, 0x32, 0xDD, 0x29, 0x27, 0x3C, 0xB0, 0x49,
-    0x64, 0x19, 0x5B, 0xA6, 0x4C, 0x74, 0x87, 0xBA, 0xFC, 0xFC, 0x7B, 0xE0, 0x69, 0x31, 0x90, 0x1A,
-    0xC8, 0x46, 0xF1, 0x09, 0x81, 0x66, 0x97, 0x9F, 0xF3, 0x3E, 0x27, 0x03, 0x36, 0xEA, 0x8B, 0x83,
-    0x7B, 0x17, 0xEA, 0x46, 0x16, 0x2E, 0xA3, 0x49, 0x56, 0xE3, 0x56, 0x68, 0x7E, 0xC5, 0x6C, 0x63,
-    0x9E, 0xAC, 0x12, 0x1F, 0xA4, 0xD1, 0xE4, 0xA1, 0xDD, 0x0B, 0x0F, 0xB5, 0x22, 0x11, 0xC0, 0x26,
-    0x08, 0xEC, 0x74, 0xED, 0xA1, 0xF6, 0xF0, 0xF0, 0xDD, 0xFF, 0xF5, 0x15, 0x28, 0xE4, 0xD2, 0x44,
-    0xF1, 0xA9, 0x76, 0x6B, 0x1A, 0x0D, 0x88, 0x97, 0xC4, 0xD7, 0x90, 0x4F, 0x00, 0x11, 0xFD, 0x13,
-    0xFF, 0x33, 0x95, 0x58, 0xAC, 0xBA, 0x0A, 0x58, 0x61, 0x55, 0x56, 0xF8, 0x15, 0x87, 0xC2, 0x03,
-    0xFC, 0x05, 0xED, 0x7D, 0x3D, 0xB0, 0xE4, 0xD6, 0x75, 0xE6, 0x45, 0x37, 0xDF, 0x83, 0x25, 0x54,
-    0x2D, 0x18, 0x90, 0xB2, 0x35, 0xDA, 0x12, 0x14, 0x6C, 0xB2, 0xDA, 0x2A, 0x63, 0xC3, 0x4D, 0x2C,
-    0x80, 0x64, 0xED, 0x2A, 0x60, 0xA0, 0xE7, 0x2D, 0x3E, 0x71, 0x4B, 0x0C, 0x46, 0x81, 0x5C, 0x65,
-    0xD3, 0xC1, 0x4B, 0x36, 0x5C, 0x09, 0x20, 0x19, 0x28, 0x50, 0xE0, 0x09, 0x24, 0xAB, 0xCA, 0x0A,
-    0xC8, 0x80, 0xAA, 0x5A, 0x3E, 0x6E, 0xD5, 0x24, 0x0E, 0x36, 0x90, 0x85, 0x16, 0x27, 0x60, 0xD5,
-    0x2A, 0x60, 0x4B, 0x5C, 0x51, 0x01, 0x03, 0x37, 0xCD, 0x91, 0x65, 0x0F, 0x03, 0x82, 0x24, 0x46,
-    0xC2, 0x7B, 0x04, 0x70, 0xF7, 0x7C, 0xDF, 0x39, 0x17, 0xDD, 0x6F, 0xE6, 0x0D, 0xFF, 0x39, 0xFC,
-    0x59, 0x3D, 0x72, 0x80, 0xEE, 0x06, 0x1A, 0x7D, 0x7F, 0xCE, 0x3D, 0x3F, 0xDF, 0xF9, 0xB9, 0x6E,
-    0xE1, 0xF0, 0x57, 0x94, 0x72, 0x88, 0x7C, 0x2D, 0xC7, 0xD8, 0xAF, 0xE4, 0x98, 0xFA, 0xCD, 0x7C,
-    0x5C, 0xF0, 0x13, 0xF7, 0x79, 0xB7, 0xFB, 0x17, 0x1D, 0xCA, 0xDF, 0x03, 0xB9, 0x97, 0xBF, 0xBE,
-    0xC1, 0xF1, 0x35, 0x1C, 0xFC, 0x2A, 0xF3, 0xC7, 0x4F, 0x7B, 0x57, 0x0C, 0x6E, 0x39, 0x38, 0xDF,
-    0xBA, 0x74, 0xB3, 0x94, 0x6F, 0x17, 0x65, 0xEA, 0x9D, 0xFB, 0x16, 0x3E, 0x96, 0x3F, 0xF9, 0xD8,
-    0x39, 0xF9, 0xF8, 0xEE, 0x03, 0xF9, 0x01, 0x8F, 0xCB, 0x72, 0x94, 0x8F, 0xBD, 0x97, 0x6F, 0xF9,
-    0x6B, 0xC7, 0x97, 0x1C, 0xEE, 0x76, 0x37, 0xDC, 0xED, 0xD2, 0x1A, 0x1F, 0x37, 0xDB, 0x67, 0xE7,
-    0x6D, 0x82, 0x9F, 0x7C, 0x86, 0x3F, 0xBC, 0xD3, 0x92, 0xB5, 0x35, 0xB1, 0x29, 0xAB, 0xDA, 0x25,
-    0x3E, 0xF6, 0xA5, 0x7C, 0x27, 0x1B, 0xE5, 0x83, 0xB6, 0xEA, 0xE4, 0x81, 0x25, 0xFA, 0x79, 0xE0,
-    0xEE, 0x3C, 0xD3, 0x1F, 0x74, 0xE7, 0x90, 0xCF, 0x9B, 0xF8, 0xA8, 0xA1, 0xC2, 0xB1, 0x8D, 0xA5,
-    0x3D, 0x7E, 0x85, 0x1F, 0xD6, 0x4E, 0xF5, 0xEC, 0xD4, 0x1A, 0xED, 0xF9, 0xFC, 0x0D, 0xCD, 0xDC,
-    0x7B, 0x40, 0x9A, 0xE9, 0x71, 0x79, 0xB7, 0x53, 0xA7, 0xC7, 0x4F, 0xB2, 0xF5, 0xEE, 0xC6, 0x4E,
-    0x2D, 0x39, 0x32, 0xF9, 0xF6, 0xD9, 0xC9, 0xB0, 0xE0, 0x4F, 0xB2, 0x0F, 0x3F, 0xDF, 0xB6, 0xA4,
-    0xBB, 0x9B, 0x6D, 0x73, 0x6C, 0x9C, 0xEF, 0x1D, 0x4F, 0xBE, 0x4E, 0xC3, 0xDB, 0x6B, 0xCD, 0x74,
-    0xEC, 0xCB, 0xB4, 0x97, 0xC7, 0xA5, 0x9D, 0xF4, 0x4E, 0x1E, 0xE5, 0x5D, 0xD2, 0xE2, 0x6D, 0xEB,
-    0x0A, 0x3C, 0x79, 0xB4, 0x11, 0xDC, 0xFE, 0xBE, 0xBC, 0xFD, 0xD9, 0x21, 0xDF, 0xE2, 0x51, 0x8E,
-    0x0D, 0xC7, 0x19, 0x6F, 0x27, 0xBC, 0x3D, 0x6D, 0x7C, 0xC7, 0x9B, 0x73, 0xF9, 0x1E, 0xBE, 0xDB,
-    0x8C, 0x7C, 0xBB, 0x14, 0x8A, 0x60, 0xBB, 0x3D, 0xDF, 0x46, 0xE8, 0x08, 0xE6, 0x46, 0xDF, 0xA2,
-    0x5F, 0x89, 0xBF, 0x8A, 0xB7, 0x19, 0x46, 0xC2, 0x6F, 0xD0, 0x25, 0x27, 0x63, 0x2F, 0x0F, 0x6E,
-    0x17, 0x67, 0x9B, 0x90, 0xF8, 0x92, 0x84, 0xC4, 0x09, 0x96, 0xC9, 0xE1, 0xA7, 0x9F, 0xF3, 0xFC,
-    0x34, 0xF6, 0x7A, 0x6F, 0x61, 0x93, 0x79, 0xCC, 0x5B, 0xDD, 0x1E, 0x0E, 0x8B, 0x76, 0xA6, 0xD5,
-    0xA6, 0x97, 0x43, 0x85, 0x6F, 0x64, 0xB8, 0x31, 0xF2, 0x97, 0xE4, 0xFD, 0x67, 0xCE, 0xCC, 0xAB,
-    0xE3, 0xE8, 0xDD, 0x8F, 0xFE, 0x8D, 0x1C, 0xD9, 0x67, 0x39, 0xBB, 0x91, 0x3F, 0x7D, 0x9A, 0xF3,
-    0x9A, 0x90, 0x94, 0x2A, 0xBC, 0x8C, 0xF9, 0xB2, 0x00, 0x99, 0x2D, 0x5B, 0xA5, 0x3B, 0x9D, 0xB3,
-    0xF7, 0xF3, 0x32, 0xF7, 0x07, 0x38, 0xC8, 0xB0, 0x25, 0x1C, 0xDA, 0xC6, 0x73, 0x4D, 0xD9, 0xDF,
-    0x17, 0xFC, 0x09, 0x9A, 0x6D, 0x97, 0x65, 0x36, 0x0B, 0x9D, 0xD3, 0xD1, 0x1D, 0xF5, 0x0B, 0xF9,
-    0x30, 0xED, 0x63, 0xE9, 0x68, 0xDA, 0xE3, 0x81, 0x49, 0x9F, 0xC9, 0xF7, 0xE3, 0x2E, 0x97, 0x99,
-    0x58, 0x5C, 0xD2, 0x41, 0xB4, 0xA3, 0xC7, 0xA8, 0x55, 0xBB, 0xC7, 0xE9, 0xF8, 0x58, 0x46, 0x86,
-    0x57, 0xF5, 0x58, 0x8C, 0x7A, 0xA7, 0x1C, 0xBA, 0x5C, 0xEE, 0x58, 0x0C, 0x19, 0x66, 0x76, 0x4C,
-    0x65, 0x9E, 0xD3, 0x51, 0xE6, 0xFF, 0x07, 0xCD, 0x10, 0xF9, 0xB9, 0x0D, 0x1B, 0x4C, 0xC1, 0x84,
-    0x09, 0x39, 0x3E, 0xB0, 0xB6, 0x2E, 0xFC, 0x54, 0xE2, 0x5A, 0x87, 0xDB, 0x7A, 0x50, 0x4C, 0x9F,
-    0xF8, 0x3A, 0xEB, 0xD3, 0x09, 0x4D, 0x1B, 0x5D, 0xD2, 0xC9, 0x21, 0x6E, 0xF3, 0xC9, 0x2D, 0xEA,
-    0x0C, 0xD3, 0x93, 0xCA, 0xB3, 0xB0, 0x18, 0x6A, 0x90, 0x57, 0xCF, 0x6E, 0x96, 0x3A, 0x14, 0xF2,
-    0x6C, 0xA1, 0xAE, 0x23, 0x59, 0xEF, 0xF2, 0xD4, 0x31, 0xA9, 0x5D, 0x35, 0x16, 0x2B, 0x21, 0x13,
-    0x3D, 0x6C, 0x5C, 0x36, 0x14, 0x9D, 0x2B, 0xFA, 0x62, 0xFA, 0xBA, 0x6F, 0xD1, 0x9A, 0x35, 0x7B,
-    0x98, 0xE0, 0x29, 0xD2, 0xA0, 0x12, 0x73, 0x7A, 0xBF, 0xCE, 0xE7, 0xAF, 0xBD, 0xBF, 0x1A, 0x71,
-    0xCD, 0x71, 0xBC, 0xDF, 0xEB, 0x29, 0xF3, 0x97, 0xA4, 0x61, 0x2F, 0x4A, 0x97, 0x1B, 0xE3, 0x1F,
-    0xE9, 0x26, 0x69, 0x8B, 0x3E, 0x1F, 0x0A, 0xFC, 0xD7, 0x17, 0x43, 0xDE, 0x66, 0x5D, 0xE4, 0xA2,
-    0x32, 0xCC, 0xDC, 0xDE, 0xE1, 0xE1, 0x81, 0x7C, 0xA5, 0xC3, 0x3F, 0xA1, 0xF5, 0x4B, 0x1C, 0xE6,
-    0xE2, 0x03, 0xFA, 0x57, 0x4D, 0xE8, 0x2C, 0x9E, 0xDD, 0xE3, 0xF9, 0xE0, 0xB5, 0xCE, 0x86, 0xA1,
-    0x93, 0x0B, 0x57, 0x85, 0x58, 0x56, 0x32, 0x9E, 0x42, 0x48, 0x95, 0x8C, 0x08, 0xC9, 0x42, 0x46,
-    0xF9, 0x83, 0xF8, 0x60, 0x81, 0xDE, 0x37, 0xAD, 0x36, 0x43, 0xA6, 0x52, 0x46, 0x06, 0xE4, 0x2B,
-    0x33, 0x04, 0x1E, 0xC0, 0x95, 0x2E, 0x33, 0xFB, 0x53, 0x1B, 0x01, 0xB4, 0xCB, 0x19, 0x63, 0xAA,
-    0x31, 0x97, 0xDE, 0x2B, 0x79, 0x57, 0x33, 0x1F, 0x2E, 0xAE, 0x5F, 0xD4, 0x75, 0x9E, 0x76, 0x4B,
-    0xFD, 0x64, 0x39, 0x3A, 0xCC, 0x3E, 0x16, 0x48, 0xA9, 0x54, 0xE9, 0x8A, 0x75, 0x6A, 0x37, 0xB5,
-    0xE1, 0xA6, 0x61, 0xBE, 0x49, 0x68, 0xEE, 0x1A, 0x2E, 0x62, 0x8D, 0x92, 0x3B, 0xE4, 0xED, 0x92,
-    0xB2, 0x42, 0xC8, 0x8E, 0xCC, 0x10, 0x64, 0x2C, 0xF4, 0xBD, 0x00, 0x75, 0x78, 0x69, 0x20, 0x85,
-    0x4D, 0xB5, 0x92, 0x27, 0xA1, 0x37, 0x79, 0x8B, 0x27, 0x09, 0xE3, 0x17, 0xE6, 0x28, 0x3F, 0x07,
-    0x1A, 0x1D, 0x70, 0x53, 0xE2, 0xFF, 0xCB, 0x52, 0x16, 0xBA, 0x17, 0x5E, 0x7E, 0xE5, 0x4D, 0x79,
-    0xAC, 0xEF, 0x62, 0xFF, 0x12, 0x1E, 0x56, 0xF9, 0xCB, 0xBE, 0x95, 0xEE, 0x2A, 0x37, 0xCE, 0xF0,
-    0x14, 0xF4, 0x8A, 0x4C, 0xD0, 0x63, 0x0D, 0x5C, 0x28, 0xB7, 0xAC, 0xA5, 0xC4, 0x3F, 0x76, 0xFC,
-    0x5E, 0x36, 0x4E, 0xC6, 0x62, 0x48, 0xD8, 0x38, 0x10, 0x05, 0x09, 0x83, 0x1C, 0x2E, 0x9A, 0xC5,
-    0xD8, 0x56, 0x18, 0x6C, 0x05, 0xC2, 0x56, 0xD2, 0xDD, 0xFA, 0x36, 0x59, 0xD1, 0xCD, 0x88, 0xE1,
-    0x56, 0xFE, 0x4F, 0x3E, 0xAC, 0x7F, 0x9D, 0x4B, 0xED, 0x55, 0xAF, 0xB7, 0x4D, 0x97, 0x7D, 0x6B,
-    0x4F, 0x8B, 0xB5, 0xE1, 0xF2, 0x6F, 0xA9, 0x62, 0x2C, 0xC5, 0x08, 0x85, 0x1F, 0x2D, 0x86, 0xF0,
-    0xA3, 0xBE, 0xB5, 0xDB, 0x62, 0x5F, 0xDB, 0x6D, 0xD5, 0xE8, 0x1A, 0xE9, 0x2D, 0x9E, 0xB6, 0x11,
-    0x2A, 0x5C, 0x51, 0x18, 0x85, 0x9E, 0xFA, 0x8D, 0xF5, 0x54, 0x88, 0xF1, 0x06, 0x5E, 0x7B, 0xE8,
-    0x66, 0x51, 0x15, 0x64, 0x95, 0x4B, 0xE7, 0x0F, 0x54, 0x5A, 0xB9, 0x20, 0xAE, 0x82, 0xBC, 0x9A,
-    0x05, 0xD6, 0x56, 0x62, 0xCD, 0x22, 0x2B, 0x08, 0x0C, 0xD3, 0x19, 0x38, 0x18, 0x4A, 0x66, 0xCB,
-    0x40, 0x66, 0xE0, 0x0F, 0x5E, 0x3F, 0xB8, 0x8C, 0xC1, 0xC7, 0x4C, 0xA7, 0xF8, 0x3A, 0xB5, 0x8F,
-    0x51, 0x9F, 0x01, 0x86, 0xAA, 0xC2, 0x6B, 0x72, 0x26, 0xBD, 0xEC, 0x83, 0x6C, 0xF7, 0x03, 0x08,
-    0x30, 0x70, 0x6D, 0x48, 0x30, 0xF4, 0x1B, 0x5D, 0x8E, 0x31, 0xA5, 0x85, 0x0A, 0x67, 0x36, 0xEA,
-    0x8F, 0xB4, 0x45, 0x95, 0x71, 0x46, 0x25, 0x5E, 0x3D, 0x35, 0x5E, 0x3F, 0x1B, 0xB4, 0xC9, 0x35,
-    0x85, 0xDC, 0x25, 0x77, 0xE3, 0x1F, 0x09, 0xE7, 0xA7, 0x20, 0x29, 0x8C, 0x39, 0x4E, 0xD2, 0xE0,
-    0x4A, 0x38, 0xBF, 0x48, 0x5C, 0x50, 0x0B, 0x16, 0x1C, 0x26, 0xE6, 0x95, 0x5A, 0x4E, 0x11, 0x1E,
-    0x2D, 0x73, 0x34, 0x91, 0x4C, 0xE2, 0x81, 0x27, 0x0C, 0x9F, 0x9C, 0x72, 0x90, 0x8C, 0xBF, 0x5E,
-    0xAD, 0x94, 0x36, 0xEC, 0xB4, 0xD6, 0x13, 0xAF, 0xB5, 0x58, 0xE1, 0x72, 0xE2, 0x40, 0x80, 0xA4,
-    0xF5, 0xEB, 0x68, 0x1A, 0x28, 0x64, 0xCD, 0x47, 0x07, 0x42, 0x50, 0x29, 0xDE, 0x08, 0x17, 0xF7,
-    0xD7, 0xA5, 0xCB, 0x75, 0x4E, 0xA5, 0x6E, 0x83, 0x06, 0x26, 0x54, 0xB0, 0x64, 0x40, 0x74, 0xD5,
-    0x5E, 0x00, 0x6D, 0x5B, 0x6F, 0x0A, 0xB7, 0x3B, 0x12, 0xE4, 0x4F, 0xF8, 0xCB, 0x4C, 0x7E, 0x87,
-    0xF3, 0xBE, 0x0E, 0x87, 0x73, 0x7F, 0x72, 0xD3, 0x78, 0x40, 0xA3, 0x7C, 0x00, 0x6A, 0x98, 0xFC,
-    0xA0, 0xB4, 0xCD, 0x0F, 0xF8, 0xA9, 0x82, 0x7A, 0x65, 0x2F, 0x83, 0x31, 0x91, 0x13, 0x89, 0xC0,
-    0x21, 0x35, 0x60, 0xC2, 0xD8, 0xE0, 0xDE, 0xD4, 0x8F, 0x8D, 0x72, 0x72, 0xBD, 0x9C, 0x7A, 0xBD,
-    0xEC, 0xF5, 0x72, 0x3A, 0xE9, 0x65, 0x11, 0xFD, 0xB8, 0x9C, 0x0E, 0xFA, 0x6D, 0x19, 0x6D, 0x5C,
-    0x7E, 0x6E, 0x88, 0x78, 0x99, 0xD3, 0x20, 0x1D, 0x1E, 0xF4, 0xE1, 0x60, 0x04, 0xB8, 0xAC, 0x44,
-    0x01, 0x5A, 0x8A, 0x6F, 0xF8, 0x6D, 0xB9, 0x9C, 0x48, 0xB7, 0x16, 0xBE, 0x5B, 0x50, 0xA1, 0xA0,
-    0x0E, 0xBA, 0xDB, 0xF2, 0x76, 0xEE, 0xD9, 0xC0, 0xF1, 0x11, 0x9E, 0x56, 0x41, 0xD7, 0x9A, 0x9C,
-    0x32, 0xCB, 0x1F, 0x72, 0xB0, 0x54, 0xCC, 0xCA, 0xAC, 0x2B, 0xBB, 0x3B, 0x3C, 0x97, 0x50, 0xEE,
-    0x3E, 0x7C, 0x00, 0x0F, 0xAD, 0xF8, 0x6C, 0x21, 0x96, 0xA1, 0x90, 0x6F, 0xE5, 0x58, 0xDB, 0xD0,
-    0xBF, 0x4A, 0xD0, 0x4B, 0x3C, 0x71, 0x38, 0xD2, 0x81, 0x12, 0x3F, 0xED, 0xB9, 0x06, 0x40, 0x1B,
-    0x58, 0xEE, 0x6B, 0x0C, 0x9D, 0x6B, 0xB8, 0x20, 0x6A, 0xFC, 0xEC, 0xC2, 0xFF, 0x4C, 0x75, 0x94,
-    0xE7, 0x39, 0x97, 0xCD, 0xEF, 0x4D, 0x91, 0x68, 0xB5, 0x2D, 0x1B, 0xA5, 0xE7, 0x95, 0xCE, 0x65,
-    0xAD, 0x94, 0xAC, 0x6B, 0x90, 0xAD, 0xFD, 0x8F, 0x24, 0x41, 0x37, 0x64, 0x1D, 0x75, 0x31, 0x33,
-    0x13, 0x78, 0x7F, 0xE4, 0xF5, 0x46, 0xAC, 0x76, 0x23, 0x12, 0xED, 0x83, 0x4C, 0xED, 0x91, 0x30,
-    0x2B, 0x19, 0x98, 0x37, 0x65, 0x8C, 0x64, 0x9C, 0x4E, 0xE4, 0x7F, 0xF9, 0x52, 0x8F, 0xD6, 0x63,
-    0x6D, 0x62, 0x70, 0x9B, 0x8E, 0x13, 0x29, 0x3A, 0x0E, 0xE6, 0x15, 0x2A, 0x22, 0x2F, 0xAE, 0x6F,
-    0xCF, 0xC5, 0x44, 0xD4, 0xF5, 0xC6, 0xAF, 0x73, 0x65, 0x5B, 0xAF, 0xEA, 0xE9, 0x4D, 0x3D, 0x0D,
-    0x10, 0x90, 0x4A, 0xDD, 0x41, 0x8F, 0xD5, 0x09, 0x4E, 0x94, 0x3B, 0x2D, 0x26, 0x63, 0x09, 0x7A,
-    0x4F, 0xAA, 0xF7, 0x2C, 0x5A, 0x77, 0xDE, 0xDF, 0x4F, 0xED, 0x5E, 0xBD, 0x9A, 0x06, 0x4D, 0x58,
-    0x9F, 0x54, 0xE8, 0xF3, 0x63, 0x25, 0x0C, 0xE1, 0x10, 0xBC, 0x2B, 0x7D, 0x93, 0x77, 0x2D, 0x26,
-    0x2E, 0x66, 0x57, 0x5C, 0xE1, 0x5D, 0xF1, 0x90, 0x73, 0x02, 0xFD, 0x3D, 0xBC, 0x2B, 0x6B, 0x29,
-    0x2D, 0xA4, 0x2D, 0x54, 0x8D, 0x8B, 0x35, 0xAD, 0x39, 0x69, 0xA1, 0x2E, 0x7D, 0x95, 0xCE, 0x99,
-    0x32, 0xCB, 0xA5, 0xCA, 0x0E, 0x57, 0x9C, 0x1E, 0x5F, 0x96, 0x29, 0x4E, 0x94, 0x70, 0x1C, 0xD5,
-    0xB5, 0xB5, 0xC3, 0xCC, 0xE6, 0x90, 0x8F, 0x90, 0x6E, 0x27, 0x72, 0x6F, 0xBD, 0x20, 0x65, 0x0F,
-    0x90, 0xED, 0xCF, 0x91, 0x19, 0xF8, 0x81, 0xFC, 0x9E, 0xE2, 0xC0, 0x53, 0xC3, 0x1E, 0xF8, 0xE8,
-    0x56, 0x95, 0xEB, 0x25, 0xF8, 0x18, 0x46, 0x76, 0x49, 0x41, 0x93, 0x6E, 0x68, 0xB3, 0x95, 0x67,
-    0x8C, 0xA1, 0xE9, 0xA9, 0x92, 0xCD, 0xBA, 0xCA, 0xD6, 0xF4, 0x94, 0x13, 0xB8, 0x7B, 0x1F, 0x4A,
-    0xB0, 0x3C, 0x07, 0x42, 0x41, 0xA6, 0x09, 0xCA, 0x39, 0x05, 0x85, 0x48, 0x6F, 0x30, 0xA7, 0x6E,
-    0x96, 0x67, 0xD5, 0x44, 0x01, 0xD5, 0xCE, 0xC2, 0x89, 0x82, 0x69, 0x16, 0x4A, 0xD1, 0xC3, 0xFE,
-    0x5F, 0xA9, 0x78, 0xFA, 0x3A, 0x31, 0xF3, 0x14, 0x47, 0x59, 0xD2, 0x99, 0x97, 0x96, 0xD4, 0xA2,
-    0xBB, 0xCA, 0xFF, 0x45, 0x8F, 0xFF, 0x9B, 0x0D, 0xED, 0x95, 0x1A, 0x1F, 0x0F, 0xF8, 0xB8, 0x12,
-    0x92, 0x9C, 0x9E, 0x56, 0xCB, 0xB4, 0x3B, 0xDB, 0xC0, 0x9E, 0x0D, 0xDC, 0xB0, 0x81, 0x35, 0x59,
-    0x0C, 0x88, 0x4A, 0x1E, 0x22, 0xB3, 0x21, 0x43, 0xDC, 0x6C, 0x3F, 0xA6, 0x14, 0xBD, 0x75, 0x03,
-    0x3F, 0x9E, 0xD6, 0x89, 0xA9, 0x76, 0x91, 0xA9, 0x17, 0x1C, 0x34, 0x6F, 0xD2, 0x5C, 0xD6, 0x73,
-    0xDE, 0xFD, 0x31, 0x26, 0x51, 0xA8, 0x8C, 0x92, 0x39, 0xA7, 0x8A, 0x31, 0xBF, 0x2D, 0xF4, 0x2D,
-    0x74, 0x32, 0xBE, 0x5D, 0xEB, 0xDB, 0x41, 0xDF, 0x42, 0x2F, 0x33, 0x92, 0xC4, 0xDB, 0xA6, 0xE6,
-    0x5B, 0xE8, 0x66, 0x14, 0x6A, 0x2A, 0xF4, 0xB3, 0x96, 0x6F, 0x85, 0xD7, 0xF0, 0x6D, 0xA1, 0xEB,
-    0x34, 0x19, 0xF4, 0xAD, 0xF1, 0xE1, 0x42, 0x4D, 0xCF, 0x23, 0x58, 0xE8, 0xD3, 0x41, 0xA1, 0xAB,
-    0xF4, 0x59, 0x3D, 0x8D, 0x95, 0x9E, 0x9F, 0xE7, 0x9A, 0x11, 0x73, 0x82, 0x4B, 0xC8, 0x5F, 0x61,
-    0xCF, 0xD3, 0x21, 0xD7, 0xB7, 0x8F, 0x70, 0x81, 0x89, 0xDD, 0xB2, 0x56, 0x59, 0xAE, 0x12, 0xBB,
-    0xFD, 0x2C, 0x57, 0xE3, 0x05, 0xB7, 0x43, 0xDD, 0xDF, 0xE3, 0x31, 0x0B, 0x93, 0x73, 0xDC, 0x50,
-    0x5D, 0x2A, 0xA8, 0x51, 0xB1, 0xDB, 0xCB, 0x0E, 0x03, 0xBA, 0x7F, 0x96, 0xBA, 0x87, 0xE8, 0x70,
-    0x86, 0x35, 0x76, 0x80, 0x81, 0xE9, 0xF8, 0xA9, 0x1D, 0x45, 0x6F, 0x57, 0x0F, 0x24, 0xBA, 0x90,
-    0x6C, 0x9F, 0xBD, 0xF0, 0x98, 0x11, 0x3F, 0x90, 0x78, 0x5E, 0xDF, 0xB6, 0x64, 0x04, 0x07, 0xA1,
-    0xBC, 0x4C, 0x36, 0x20, 0x39, 0xE9, 0xFC, 0x9A, 0x4B, 0x02, 0x9A, 0xF1, 0xE0, 0xA8, 0xAB, 0x88,
-    0xE0, 0x86, 0x88, 0x90, 0xCF, 0x47, 0x2E, 0x42, 0xF9, 0xF0, 0x4F, 0x1B, 0x12, 0x4E, 0xF3, 0x26,
-    0x8C, 0x07, 0x68, 0xC9, 0x90, 0x12, 0x4A, 0x63, 0xCA, 0xDD, 0xA1, 0x87, 0xBB, 0x4A, 0xB9, 0x38,
-    0x34, 0x04, 0x72, 0x1A, 0x58, 0x9F, 0x91, 0xF2, 0xF4, 0xEA, 0x57, 0xA2, 0x67, 0xA8, 0x7E, 0x6E,
-    0x2C, 0x31, 0xE8, 0xFA, 0x26, 0x30, 0x4C, 0x0D, 0x03, 0x6B, 0x15, 0x75, 0xC3, 0xCC, 0xCF, 0xD4,
-    0xD3, 0xAA, 0x00, 0x9B, 0xF3, 0xC6, 0x9F, 0x78, 0xA6, 0xC5, 0x5F, 0x8D, 0xFC, 0xF5, 0x0D, 0xC5,
-    0x8D, 0x7C, 0x08, 0xDB, 0x74, 0xA9, 0xEA, 0x2B, 0x9E, 0x2F, 0x7A, 0x08, 0x96, 0x01, 0x38, 0x07,
-    0x96, 0xED, 0x09, 0x3A, 0x96, 0xD0, 0x04, 0x95, 0x79, 0x98, 0xC4, 0x24, 0x45, 0xDF, 0x45, 0x72,
-    0x0F, 0x95, 0xAF, 0xA9, 0xA4, 0x89, 0xA6, 0xF1, 0xB0, 0xE9, 0xE7, 0x17, 0x82, 0xD2, 0x75, 0x44,
-    0xA3, 0x06, 0x3A, 0x51, 0x13, 0x90, 0x13, 0xF9, 0x55, 0x19, 0x19, 0xA8, 0x50, 0x50, 0x0C, 0xA8,
-    0x0E, 0x51, 0x47, 0xF8, 0x76, 0x58, 0x23, 0xD3, 0x0C, 0x7C, 0xC1, 0x1A, 0x6A, 0x68, 0x6E, 0x28,
-    0xBB, 0xC4, 0x73, 0xA2, 0x63, 0xF6, 0x53, 0x39, 0xB6, 0x22, 0x66, 0xC5, 0x18, 0x43, 0x81, 0xFE,
-    0x25, 0x71, 0x12, 0xA1, 0xB7, 0x58, 0x68, 0x51, 0x34, 0xB8, 0xBE, 0xF2, 0x65, 0xE5, 0x39, 0x5C,
-    0xB4, 0x5F, 0x36, 0x58, 0x6E, 0xB2, 0xFA, 0xF7, 0x61, 0x57, 0x43, 0x2C, 0xCA, 0x5A, 0xFB, 0xAF,
-    0x18, 0x35, 0x05, 0x7D, 0x86, 0xA5, 0xD2, 0x19, 0x3A, 0xB3, 0xA1, 0xD1, 0xD0, 0xA8, 0x8A, 0x13,
-    0x99, 0x8A, 0x93, 0x1A, 0xF5, 0x9B, 0x8A, 0x93, 0x9A, 0x06, 0xE4, 0xF5, 0x72, 0x6A, 0x1A, 0x90,
-    0x7F, 0x95, 0x97, 0xD3, 0x81, 0x3A, 0xCC, 0x4A, 0x84, 0x3D, 0x2E, 0xA7, 0x83, 0xEA, 0x30, 0xC2,
-    0x06, 0xA9, 0xE2, 0x0C, 0xAA, 0xE2, 0x90, 0x1F, 0xCA, 0xE5, 0x41, 0x55, 0x1C, 0xD3, 0x87, 0xD1,
-    0xB5, 0xEA, 0xEC, 0x6F, 0xE3, 0x32, 0x70, 0x20, 0x99, 0x23, 0xD5, 0x0A, 0x49, 0x93, 0xBB, 0x2D,
-    0xDF, 0x11, 0x71, 0x83, 0x82, 0x8A, 0x49, 0xE7, 0xF8, 0x69, 0xDE, 0xAA, 0x9C, 0xAC, 0xAE, 0x37,
-    0x1B, 0x95, 0x6A, 0x46, 0x52, 0x06, 0x87, 0xEC, 0x1D, 0xFC, 0xFF, 0xA0, 0x11, 0x7E, 0x2A, 0x94,
-    0xFE, 0xBD, 0x5D, 0x3C, 0x52, 0xCD, 0x64, 0x36, 0x5D, 0xD9, 0x00, 0x0C, 0x7E, 0x80, 0x3F, 0x9D,
-    0x5A, 0x57, 0xA3, 0xD3, 0x76, 0x94, 0x6A, 0x63, 0xAD, 0x63, 0x5E, 0x6C, 0xF5, 0xE2, 0x60, 0x17,
-    0xD5, 0x00, 0xAB, 0x38, 0xDE, 0x42, 0x29, 0x6A, 0x86, 0xF5, 0xBC, 0x28, 0x0F, 0xE0, 0x45, 0xCF,
-    0xD1, 0x96, 0x7B, 0x78, 0x51, 0xBA, 0x8F, 0x8B, 0x32, 0x18, 0x04, 0x2E, 0x48, 0xB9, 0xFB, 0xC2,
-    0xC3, 0xE4, 0xE2, 0x12, 0x7A, 0x52, 0x25, 0x4A, 0x25, 0x65, 0xC3, 0x81, 0x19, 0xF2, 0xC2, 0x16,
-    0x30, 0x1F, 0x57, 0x68, 0xDF, 0xFB, 0x36, 0x98, 0xF0, 0x98, 0x0E, 0xA1, 0xB2, 0x72, 0x81, 0x1E,
-    0xC8, 0x92, 0x5B, 0xF3, 0x45, 0xA2, 0xAC, 0x82, 0x76, 0x75, 0xC9, 0x25, 0x66, 0x50, 0x16, 0xD8,
-    0x8B, 0xBD, 0x28, 0xF0, 0x22, 0x03, 0xFF, 0x79, 0x15, 0x14, 0xF0, 0x5B, 0xE1, 0x9B, 0x97, 0x01,
-    0x99, 0xBC, 0x2C, 0x7C, 0xED, 0xA2, 0xBE, 0x28, 0x7D, 0x86, 0x17, 0xBF, 0xF4, 0xF5, 0x84, 0x17,
-    0xC5, 0x2F, 0xFC, 0x33, 0x63, 0x0A, 0xF6, 0xB0, 0xF6, 0xCF, 0x0F, 0xFA, 0xA2, 0x79, 0xB9, 0xE7,
-    0x8B, 0x55, 0xF5, 0xFB, 0x0E, 0x2C, 0xA7, 0x12, 0x2A, 0x69, 0xF5, 0x85, 0x28, 0xE1, 0x78, 0xD1,
-    0xC8, 0x3C, 0xAC, 0x09, 0x7C, 0x83, 0x54, 0x12, 0xBE, 0x48, 0xC0, 0x03, 0xA1, 0x86, 0x2E, 0x01,
-    0x63, 0x40, 0x20, 0x2E, 0x31, 0x3C, 0x00, 0x45, 0x23, 0x28, 0x22, 0x97, 0xD0, 0xAE, 0x7F, 0x71,
-    0x34, 0x13, 0x3C, 0x35, 0x72, 0xDA, 0x0B, 0x7C, 0xB1, 0xC3, 0x72, 0xCA, 0x46, 0x17, 0xAE, 0x8E,
-    0x8F, 0xBF, 0x34, 0xB3, 0x9C, 0x2A, 0x08, 0x5A, 0xC5, 0xC7, 0x28, 0x8E, 0x06, 0x17, 0xB0, 0x32,
-    0x85, 0x81, 0x6F, 0xBE, 0x9C, 0x05, 0x0D, 0x61, 0x30, 0x64, 0xA2, 0x35, 0x81, 0x40, 0x91, 0x27,
-    0x3A, 0xE6, 0x5B, 0x7E, 0xFB, 0x2D, 0x1E, 0x0E, 0x14, 0x22, 0x27, 0x40, 0x07, 0xA5, 0xF3, 0x75,
-    0x6B, 0xF9, 0x8B, 0xD6, 0xF2, 0x1B, 0xC0, 0x54, 0x2A, 0x2D, 0x6B, 0x95, 0x45, 0xFD, 0x0C, 0x0C,
-    0xF8, 0x51, 0x3E, 0xAE, 0x21, 0x66, 0x64, 0x34, 0x41, 0x48, 0xB1, 0x4A, 0xA2, 0xA5, 0xEF, 0x32,
-    0x0E, 0x4C, 0x4F, 0x35, 0x5A, 0xC6, 0x89, 0x4A, 0x49, 0x38, 0x11, 0x3A, 0xAD, 0x6E, 0x71, 0x1A,
-    0x79, 0xE2, 0xF2, 0x6A, 0x7A, 0x02, 0xAB, 0x30, 0x6E, 0x6C, 0xB1, 0x11, 0x49, 0x4B, 0xA5, 0x21,
-    0x31, 0x56, 0x7A, 0x0F, 0x55, 0x5A, 0x1A, 0x7B, 0x0D, 0x8B, 0xC8, 0xD4, 0xEE, 0x7C, 0xC6, 0xCC,
-    0x4E, 0x08, 0x7C, 0x03, 0xE2, 0x56, 0xFC, 0x44, 0xF5, 0xC1, 0xA0, 0x11, 0x12, 0xE3, 0xC4, 0xDF,
-    0x55, 0x11, 0x7F, 0x87, 0x5F, 0xB7, 0x71, 0x09, 0xC3, 0xF5, 0x11, 0xBE, 0x95, 0x29, 0x31, 0xDC,
-    0x74, 0xA5, 0xD8, 0xE9, 0x18, 0x6B, 0x9B, 0x57, 0x10, 0xB5, 0xA2, 0x79, 0x9F, 0x96, 0x31, 0x35,
-    0x6F, 0x76, 0x83, 0x2F, 0x61, 0xEA, 0x1D, 0x91, 0x9C, 0x45, 0x6F, 0x87, 0x43, 0xA0, 0x55, 0x38,
-    0x8A, 0xF2, 0x3E, 0xBC, 0x94, 0x35, 0xAC, 0x08, 0x15, 0xB9, 0x55, 0xEA, 0x1F, 0x22, 0xDF, 0xF6,
-    0x60, 0xE2, 0xE4, 0xE2, 0x38, 0xA4, 0xD0, 0x5B, 0xDF, 0x89, 0x62, 0xBB, 0xDE, 0x2A, 0xB6, 0xEB,
-    0x2D, 0xA5, 0x1C, 0x41, 0x02, 0x67, 0xB8, 0xA0, 0x48, 0x22, 0xA8, 0x44, 0x98, 0x61, 0xB7, 0x27,
-    0x5C, 0x1A, 0x3C, 0x10, 0x3C, 0x26, 0x26, 0xE8, 0x9E, 0xAD, 0xC1, 0x67, 0xBE, 0x12, 0x14, 0x98,
-    0x19, 0x8D, 0x52, 0x3C, 0x4F, 0x25, 0x3F, 0x59, 0xAB, 0xC2, 0xEC, 0xE1, 0xE3, 0xF5, 0x6C, 0x3E,
-    0x17, 0xD4, 0x40, 0x15, 0x13, 0xC2, 0x84, 0x47, 0x98, 0xF0, 0xAF, 0x8F, 0x6A, 0x7C, 0x2D, 0x67,
-    0x0E, 0x3A, 0xB2, 0x89, 0x42, 0x0F, 0x7B, 0x7F, 0x55, 0x1A, 0x19, 0x28, 0x15, 0x0C, 0x3A, 0xF9,
-    0xCF, 0xD9, 0x1B, 0xC2, 0x67, 0xCF, 0xF5, 0xD2, 0x9E, 0x64, 0x10, 0x29, 0x2C, 0xDC, 0xF5, 0x7B,
-    0x32, 0x8C, 0xEB, 0xB8, 0xAF, 0xA0, 0x07, 0x56, 0xEE, 0x40, 0xDE, 0x00, 0xA4, 0x56, 0xAB, 0x50,
-    0x9B, 0xFD, 0x41, 0xBD, 0x89, 0x45, 0x36, 0x50, 0x0B, 0x1A, 0xE6, 0x55, 0x96, 0xF1, 0xCD, 0xA7,
-    0x01, 0xA1, 0x60, 0x2F, 0xCC, 0x99, 0xA2, 0xAE, 0x4F, 0x6F, 0xDF, 0xBC, 0xAA, 0xB6, 0xB9, 0xDA,
-    0xF3, 0x4D, 0xA7, 0xF4, 0x03, 0xC1, 0x40, 0xF3, 0x68, 0x0A, 0xCC, 0x4E, 0x98, 0x4B, 0xD5, 0x56,
-    0xA2, 0xEA, 0x6E, 0x32, 0x51, 0x85, 0xD6, 0x90, 0xB1, 0xE0, 0x12, 0x22, 0x06, 0x85, 0x71, 0xE7,
-    0x22, 0xE9, 0x64, 0x9E, 0x5E, 0x14, 0x49, 0x27, 0xAF, 0x7E, 0x07, 0x9E, 0x20, 0x83, 0x6A, 0x17,
-    0xB1, 0x1C, 0xE4, 0xEB, 0x8F, 0xEA, 0x37, 0x45, 0x02, 0x7C, 0xD5, 0x13, 0xB6, 0x55, 0x70, 0x33,
-    0x57, 0x16, 0x4A, 0xEC, 0xF9, 0x8C, 0xDB, 0x6C, 0xA5, 0xA7, 0x53, 0xF3, 0x97, 0xF5, 0xAA, 0x95,
-    0xF3, 0x9E, 0xE3, 0x63, 0x70, 0x13, 0xB8, 0x28, 0xE4, 0x1F, 0x56, 0xA5, 0xF4, 0xE6, 0x67, 0xF2,
-    0x98, 0x25, 0x21, 0xCD, 0xA9, 0xC4, 0xF0, 0x35, 0x13, 0xC1, 0xC9, 0x04, 0x32, 0x0F, 0xFC, 0x76,
-    0xE0, 0x13, 0x65, 0xC5, 0xE1, 0x14, 0xF9, 0xAE, 0x59, 0x73, 0x9C, 0x2B, 0xC3, 0x59, 0x37, 0x3B,
-    0xA3, 0x1F, 0x1B, 0xB4, 0x35, 0x1B, 0x00, 0xE6, 0xAB, 0xEB, 0x6D, 0xFC, 0xD0, 0xA2, 0xFC, 0xBA,
-    0x02, 0x12, 0xCA, 0x19, 0xD1, 0x31, 0xA8, 0xF8, 0x23, 0xF4, 0x7D, 0x28, 0xD7, 0x29, 0x61, 0x18,
-    0x3E, 0x02, 0xB3, 0x97, 0x13, 0x74, 0x01, 0x5B, 0x7F, 0x5C, 0xDD, 0x1C, 0xAF, 0x10, 0x7A, 0xF7,
-    0xBD, 0x01, 0x47, 0xF7, 0x6B, 0x1F, 0xA8, 0x47, 0x49, 0x3F, 0xBE, 0x2B, 0xB3, 0x92, 0x98, 0xB4,
-    0x5A, 0x98, 0xA6, 0x07, 0x1A, 0x35, 0x50, 0xE7, 0xA3, 0x7A, 0x9B, 0xC3, 0x14, 0xF5, 0x07, 0x06,
-    0x1F, 0xBD, 0x62, 0xA0, 0xBC, 0x71, 0x71, 0x83, 0x7A, 0x0C, 0x25, 0x52, 0x25, 0xD8, 0xC5, 0xA3,
-    0x01, 0x41, 0x4A, 0x5D, 0x4B, 0x03, 0xBA, 0x0B, 0x03, 0x8F, 0x94, 0x40, 0xDD, 0x67, 0x4B, 0x1B,
-    0x06, 0x19, 0x02, 0x21, 0x31, 0x18, 0xB9, 0x30, 0x09, 0xDB, 0xC6, 0x8F, 0x9C, 0x19, 0xA1, 0x54,
-    0x53, 0x83, 0x83, 0xA6, 0x6E, 0x8A, 0xBB, 0x29, 0xA6, 0xD4, 0x53, 0x47, 0xBB, 0x08, 0xE5, 0x08,
-    0x06, 0x18, 0x2F, 0x56, 0x13, 0xBF, 0x29, 0xEA, 0x31, 0x9E, 0xB3, 0x30, 0x90, 0x3E, 0x57, 0x2F,
-    0x70, 0x04, 0xEC, 0xAB, 0x86, 0x1A, 0x1E, 0x99, 0x92, 0xAE, 0xD0, 0x93, 0x2A, 0x64, 0x6A, 0x0E,
-    0x90, 0x04, 0xCF, 0x5C, 0x24, 0xE7, 0xE5, 0xDA, 0x70, 0x5B, 0xDD, 0xD4, 0x74, 0x5F, 0x51, 0xB5,
-    0x0E, 0xA4, 0x1B, 0x0D, 0xCD, 0xD8, 0xD7, 0x74, 0x6C, 0xFE, 0x46, 0x5F, 0x55, 0x14, 0x1F, 0xC2,
-    0x38, 0xFA, 0x48, 0xA1, 0x40, 0x3C, 0x1D, 0xD6, 0xD2, 0x40, 0xD8, 0xED, 0x13, 0xF3, 0x4A, 0x4C,
-    0xD2, 0x63, 0xE1, 0xD1, 0x5B, 0x14, 0x71, 0x4B, 0x01, 0x67, 0x5E, 0x6D, 0x47, 0x43, 0xEE, 0xFB,
-    0x27, 0x8D, 0x37, 0x10, 0x65, 0xAC, 0x57, 0x5D, 0xEC, 0x35, 0x7A, 0x15, 0xC5, 0xBE, 0x05, 0x8D,
-    0xCF, 0xC3, 0x51, 0xC0, 0xBE, 0x90, 0xA1, 0x5D, 0x83, 0x8C, 0xB0, 0x6A, 0xAB, 0x8E, 0x6B, 0x58,
-    0x2C, 0x54, 0x84, 0x37, 0x6C, 0x5B, 0xF3, 0x31, 0xBB, 0x11, 0xB0, 0x2A, 0xFE, 0x9F, 0x97, 0x86,
-    0x87, 0x9B, 0x26, 0xFC, 0xBD, 0x39, 0xBF, 0x1A, 0x82, 0x7C, 0x0E, 0xAB, 0x04, 0x2C, 0xBB, 0x0E,
-    0x2F, 0xAB, 0x59, 0x80, 0xA7, 0x33, 0xA8, 0xBA, 0x9C, 0xBF, 0xE2, 0xB6, 0x8A, 0x60, 0x3E, 0x7F,
-    0x65, 0x71, 0x09, 0xA2, 0xF4, 0x01, 0xA7, 0x28, 0x8A, 0xAA, 0x5E, 0xFD, 0x8C, 0x83, 0x42, 0x98,
-    0xE2, 0x8B, 0xB5, 0xEA, 0x7E, 0x25, 0x4F, 0x8D, 0x0A, 0xBB, 0x4A, 0x4F, 0x7B, 0x26, 0xFA, 0xE6,
-    0x93, 0xBA, 0x22, 0x73, 0xE5, 0xB3, 0xB9, 0x0A, 0xC1, 0x5C, 0x57, 0x77, 0x3E, 0x12, 0x0E, 0x00,
-    0x1C, 0x33, 0xF2, 0x94, 0xEB, 0x09, 0xAB, 0x65, 0xE7, 0xA4, 0x1F, 0x16, 0x7A, 0x27, 0x8D, 0x6C,
-    0xF8, 0x1B, 0x5D, 0xAC, 0xDC, 0x3E, 0xF5, 0xA6, 0xDF, 0x10, 0x68, 0xDB, 0xF1, 0x14, 0x99, 0x1D,
-    0xDC, 0xB1, 0x2F, 0x2F, 0xB2, 0x37, 0x6A, 0x0A, 0x9F, 0x90, 0xFB, 0x5F, 0xDD, 0x2A, 0x24, 0xB3,
-    0x33, 0x71, 0x56, 0x57, 0xB6, 0x30, 0xD3, 0x8C, 0x3A, 0x9D, 0x77, 0xD3, 0xE9, 0x93, 0x76, 0x93,
-    0xE2, 0xB1, 0x2B, 0x0B, 0x0E, 0x31, 0x3D, 0xBE, 0xB7, 0x27, 0x1D, 0xA9, 0x7F, 0x15, 0xDA, 0xDB,
-    0xC6, 0x9E, 0xA4, 0x6E, 0xC4, 0xD9, 0xB3, 0xB8, 0x75, 0x36, 0xCE, 0x8E, 0xC5, 0x82, 0x96, 0x9E,
-    0xDE, 0xD4, 0xF0, 0x0B, 0x89, 0xF0, 0xC7, 0xC9, 0xD4, 0x7A, 0x79, 0x21, 0x87, 0x23, 0xAA, 0x41,
-    0xDA, 0x3B, 0xBA, 0xE0, 0xB6, 0x0E, 0x14, 0x37, 0x7B, 0x59, 0x4B, 0xB7, 0xF5, 0xAE, 0xBA, 0x1D,
-    0xAF, 0xAA, 0x3B, 0x3F, 0x66, 0x68, 0xFE, 0x98, 0xF3, 0x36, 0xE3, 0xB8, 0xC3, 0x0C, 0x34, 0x63,
-    0xCA, 0x42, 0x2B, 0xDF, 0x0F, 0xD0, 0xBC, 0x6B, 0x82, 0x2C, 0x48, 0x5E, 0x19, 0x7F, 0x81, 0xB7,
-    0xBB, 0x7C, 0x2A, 0x45, 0x48, 0xE6, 0xB0, 0x2C, 0x37, 0x39, 0x64, 0x45, 0x9B, 0x81, 0xFE, 0xFA,
-    0x74, 0x03, 0x2B, 0x63, 0x51, 0xCF, 0x81, 0x1C, 0xA3, 0x1D, 0x23, 0x55, 0x09, 0xBD, 0x69, 0xBC,
-    0x78, 0xFD, 0xF0, 0x71, 0x33, 0xEE, 0xDC, 0x63, 0xD8, 0x5A, 0x5C, 0x43, 0x27, 0xC9, 0x81, 0xD1,
-    0xB4, 0x05, 0x5C, 0xC2, 0x9B, 0x0A, 0xD6, 0xAA, 0xE8, 0x61, 0x3F, 0xF0, 0x9E, 0x13, 0xA8, 0x7D,
-    0xDD, 0xE0, 0x91, 0xA0, 0xD9, 0xFD, 0xE3, 0xF2, 0x26, 0x2F, 0x64, 0x44, 0x3F, 0xAF, 0x67, 0x58,
-    0x8F, 0x8C, 0x50, 0x43, 0x44, 0x08, 0xB7, 0x03, 0x64, 0xA1, 0x99, 0x5F, 0x47, 0x1A, 0x24, 0x51,
-    0x09, 0x89, 0xFA, 0x56, 0xE7, 0x4F, 0xB1, 0xC4, 0x0E, 0x70, 0x87, 0x0B, 0xFE, 0xE6, 0x9E, 0x74,
-    0xB1, 0xA6, 0x5C, 0xD7, 0x99, 0x87, 0xAA, 0x17, 0x5E, 0x8D, 0x44, 0x1E, 0x56, 0xEC, 0x83, 0x69,
-    0x35, 0xB7, 0x7A, 0x75, 0x7A, 0x39, 0xBC, 0xB2, 0x6F, 0x0C, 0x01, 0xB5, 0x28, 0x86, 0x00, 0x18,
-    0x92, 0xA2, 0x08, 0x61, 0x34, 0x1D, 0x7F, 0xB7, 0x33, 0x8A, 0xC3, 0xA4, 0x2E, 0xB4, 0xA5, 0x1E,
-    0xE0, 0x61, 0xAD, 0xA8, 0xC6, 0x69, 0x03, 0x78, 0x51, 0x7D, 0x00, 0x03, 0x7B, 0xB9, 0xE4, 0xC8,
-    0x34, 0xEA, 0xF5, 0x0F, 0x3C, 0x27, 0x3A, 0xBE, 0x14, 0x86, 0xE6, 0xC0, 0xED, 0x73, 0xFE, 0x96,
-    0xCA, 0x31, 0xD4, 0x72, 0x2B, 0xFC, 0x41, 0x03, 0x26, 0x57, 0xC7, 0xEA, 0x46, 0x42, 0x68, 0xC1,
-    0x04, 0xB2, 0x01, 0xA7, 0xAE, 0x88, 0x48, 0xEC, 0x5C, 0xF1, 0x65, 0xCC, 0x78, 0x1C, 0xBC, 0xA1,
-    0xC2, 0x58, 0x72, 0xA9, 0x77, 0xEA, 0x24, 0x97, 0xB9, 0x68, 0x4E, 0xF1, 0x26, 0x1D, 0x63, 0x02,
-    0x9F, 0x2B, 0x44, 0xA8, 0x35, 0x1D, 0xDE, 0x88, 0x59, 0x41, 0x26, 0xBB, 0xE6, 0xD3, 0x06, 0xBC,
-    0x29, 0xD0, 0x1B, 0x98, 0x95, 0xD2, 0x85, 0x37, 0x34, 0x06, 0xA7, 0x22, 0xFA, 0xBB, 0xF9, 0xAB,
-    0x30, 0x9F, 0x64, 0x02, 0x23, 0x17, 0x08, 0xA1, 0x46, 0x30, 0x9E, 0x87, 0xC4, 0x70, 0x9E, 0x14,
-    0x50, 0x12, 0x2E, 0x9D, 0x13, 0x45, 0x50, 0x70, 0x73, 0x8F, 0x9A, 0x0B, 0x95, 0x30, 0xEF, 0x15,
-    0x9F, 0x16, 0x0D, 0x90, 0xEE, 0x8B, 0x5C, 0xD6, 0xC6, 0x3A, 0x41, 0x1B, 0x16, 0x18, 0xB2, 0x1F,
-    0xF9, 0x93, 0xFB, 0xD8, 0xFF, 0xC6, 0x5F, 0x87, 0xE3, 0x1F, 0xE8, 0xEE, 0x85, 0x72, 0xD7, 0xAF,
-    0xBD, 0xA0, 0x22, 0x2A, 0x84, 0x76, 0x99, 0x48, 0x22, 0x47, 0xDE, 0xFC, 0x2E, 0xA2, 0xEE, 0xFE,
-    0x2D, 0xD1, 0x8A, 0x80, 0xA9, 0xD2, 0xAC, 0xA0, 0xF7, 0x2B, 0xEF, 0x8F, 0xAE, 0x2A, 0x85, 0x72,
-    0x90, 0x39, 0x44, 0x1B, 0x2C, 0xB6, 0x81, 0xFE, 0xB8, 0xEF, 0x61, 0x58, 0x5F, 0xA7, 0xA3, 0x8E,
-    0x6E, 0xBA, 0x1C, 0x5A, 0xEB, 0xAF, 0xC9, 0x95, 0x48, 0x87, 0xC4, 0xF6, 0x38, 0x17, 0x8F, 0x90,
-    0xCA, 0x72, 0x69, 0xE8, 0x46, 0xA7, 0xB5, 0x30, 0x95, 0x06, 0x46, 0xD5, 0x8F, 0x83, 0x0C, 0x31,
-    0x16, 0xE3, 0xD7, 0x95, 0x46, 0xF7, 0x95, 0x95, 0x8C, 0xA2, 0x8C, 0x8A, 0x1C, 0x32, 0x1E, 0xF8,
-    0x96, 0x01, 0x26, 0x6B, 0x1C, 0x48, 0x22, 0xC2, 0x05, 0xEE, 0x69, 0x70, 0x15, 0x81, 0x52, 0x65,
-    0x3A, 0xCD, 0x07, 0xBC, 0xAD, 0x88, 0xCE, 0x77, 0x7C, 0x68, 0xD0, 0xD1, 0x15, 0x14, 0x7F, 0x7D,
-    0x76, 0x48, 0x88, 0x96, 0x7E, 0x19, 0xAA, 0x3D, 0xDD, 0x73, 0x55, 0x2D, 0x8D, 0xC6, 0x74, 0x2C,
-    0xC1, 0x5D, 0x3E, 0x4B, 0x6E, 0x6A, 0xDE, 0x8F, 0xD6, 0xB8, 0xD6, 0x39, 0x1F, 0x89, 0xAE, 0xE7,
-    0x18, 0x00, 0x45, 0x6F, 0x0D, 0x9F, 0x3F, 0x29, 0x77, 0x51, 0xCF, 0xD6, 0xDA, 0x65, 0x27, 0x0F,
-    0xC1, 0x28, 0x19, 0xA9, 0xC7, 0x37, 0x1C, 0xDD, 0x7C, 0x05, 0xE0, 0x29, 0x85, 0x29, 0x22, 0xA2,
-    0x92, 0x17, 0x26, 0x5E, 0xA8, 0x6A, 0x42, 0x53, 0x6B, 0x5C, 0x00, 0x18, 0xB7, 0x22, 0x16, 0x27,
-    0xB4, 0x30, 0xC2, 0x40, 0x71, 0x86, 0x26, 0xAD, 0xF7, 0x41, 0x01, 0xF8, 0x7B, 0x79, 0xD7, 0x16,
-    0x85, 0x33, 0x25, 0xF2, 0xCF, 0xD1, 0xB9, 0xF3, 0x4F, 0x13, 0x43, 0x7B, 0xE8, 0xD7, 0x1E, 0xE8,
-    0x47, 0x69, 0x96, 0xD4, 0xFB, 0x57, 0x30, 0x94, 0x16, 0x1B, 0xA5, 0xC8, 0x5C, 0x1D, 0x4C, 0x2D,
-    0x86, 0x5E, 0x1A, 0xF3, 0xA0, 0xDF, 0x14, 0x32, 0xC4, 0xCF, 0x60, 0x6D, 0xC0, 0xD5, 0x36, 0xCA,
-    0x13, 0x8B, 0xEB, 0x78, 0xF4, 0x8B, 0x21, 0x94, 0x73, 0x00, 0xEA, 0x4E, 0x5A, 0xA1, 0xD3, 0x55,
-    0x07, 0x44, 0x5E, 0x7D, 0xB3, 0xF2, 0xA7, 0x34, 0x01, 0xE8, 0x19, 0xE9, 0x74, 0xD9, 0xEE, 0xC1,
-    0x8B, 0xA8, 0xF8, 0xF1, 0x81, 0xA8, 0x09, 0x70, 0x9C, 0xD2, 0x93, 0xD1, 0x10, 0x49, 0xF0, 0x43,
-    0x0C, 0x3D, 0x59, 0x86, 0x7E, 0x93, 0x80, 0xA5, 0xB9, 0xBF, 0x95, 0x39, 0xD8, 0xA4, 0xE3, 0x37,
-    0x5D, 0xD2, 0xC7, 0x13, 0xDD, 0xB6, 0xC5, 0xAA, 0xDA, 0x40, 0xE7, 0x8E, 0xA6, 0x78, 0x4A, 0xD0,
-    0xF0, 0xE4, 0xA4, 0xF9, 0x4D, 0xD0, 0x5F, 0x0D, 0x4F, 0x50, 0xDE, 0x14, 0xFB, 0x87, 0xA6, 0x8B,
-    0x8A, 0xA8, 0x56, 0x9B, 0x86, 0x52, 0x3F, 0x9E, 0x96, 0xF4, 0x99, 0xCA, 0x33, 0x68, 0x0B, 0x74,
-    0xF1, 0xA4, 0xF0, 0x88, 0xFC, 0x4A, 0x02, 0xC8, 0x4A, 0x88, 0x72, 0x5D, 0x88, 0x2E, 0xD7, 0x25,
-    0x7E, 0x8A, 0x7C, 0x5F, 0x4C, 0x68, 0x98, 0x70, 0x35, 0x0D, 0xA8, 0xDD, 0x3F, 0x50, 0xA7, 0x7F,
-    0xA3, 0xEB, 0x15, 0xD0, 0xB1, 0xB4, 0x75, 0xFC, 0xAA, 0x8C, 0x11, 0x3C, 0x94, 0x5F, 0x52, 0x65,
-    0xA8, 0x68, 0x55, 0x17, 0x2A, 0x54, 0x8D, 0x01, 0xC8, 0x8C, 0xA8, 0xA2, 0x87, 0x2C, 0x82, 0xE5,
-    0x2E, 0x69, 0xD8, 0x7D, 0x2D, 0x1C, 0x5D, 0xF0, 0xB2, 0x42, 0x77, 0x7C, 0xD4, 0x1B, 0x24, 0x0F,
-    0x56, 0x2E, 0x5D, 0xFA, 0xDC, 0xF7, 0x41, 0x34, 0x88, 0x1E, 0xCB, 0x69, 0x35, 0x3C, 0x4B, 0xE0,
-    0x7E, 0x93, 0xD1, 0x0A, 0x44, 0x07, 0xC0, 0x2F, 0x69, 0x4A, 0x14, 0x8C, 0x3F, 0x4C, 0x21, 0x93,
-    0xA5, 0x01, 0x8F, 0xE0, 0xC7, 0xFC, 0x4B, 0x1E, 0x01, 0x79, 0x27, 0x3E, 0x85, 0x2F, 0x49, 0xCC,
-    0x48, 0xB9, 0xE0, 0xF9, 0x0D, 0x19, 0x69, 0xB9, 0x30, 0xC1, 0xB2, 0x4B, 0xF1, 0xA8, 0x52, 0x1F,
-    0x95, 0x40, 0x8D, 0x87, 0x92, 0x5F, 0x73, 0x19, 0xAC, 0xD1, 0x6C, 0x0D, 0x15, 0x59, 0xF6, 0x08,
-    0xEE, 0x89, 0x26, 0x86, 0x42, 0x54, 0xAB, 0x7C, 0x43, 0x7F, 0x5C, 0xE7, 0x94, 0x0D, 0x39, 0x05,
-    0x58, 0x9D, 0xFB, 0xC6, 0x0D, 0xEE, 0x80, 0x98, 0xD6, 0xA1, 0x3D, 0xAA, 0xC2, 0x64, 0x4E, 0x54,
-    0x8C, 0xE9, 0xB9, 0xD5, 0x1F, 0x4F, 0xD5, 0xA3, 0xCB, 0x7E, 0xA4, 0xEC, 0x47, 0xC6, 0x7E, 0x64,
-    0x6F, 0xE0, 0xC2, 0xE3, 0x2D, 0x2E, 0x08, 0xDB, 0x02, 0x17, 0x6D, 0xD9, 0x8F, 0x0D, 0x9B, 0xBB,
-    0xB1, 0x9E, 0x33, 0xE2, 0x10, 0x8F, 0x6A, 0x7C, 0x9D, 0x01, 0xF3, 0xEE, 0xD3, 0x30, 0x56, 0xB4,
-    0xC6, 0xEE, 0x88, 0xC0, 0x12, 0x26, 0x19, 0x40, 0xD1, 0x0F, 0x32, 0x60, 0x8F, 0xC2, 0xA5, 0x6B,
-    0x80, 0xB3, 0x32, 0x52, 0x2F, 0xC8, 0x77, 0x01, 0x38, 0x78, 0x90, 0x91, 0x98, 0xF2, 0x50, 0xE1,
-    0xA6, 0x8B, 0xAD, 0x79, 0x8B, 0xD4, 0x0A, 0x5A, 0xFA, 0x1F, 0xC2, 0xD4, 0x9A, 0xB0, 0xE6, 0x0A,
-    0x82, 0x4B, 0xA2, 0x0C, 0x70, 0xF8, 0x0B, 0xBA, 0x9B, 0x1B, 0xC0, 0x99, 0x25, 0x2C, 0x3B, 0x79,
-    0xA0, 0x58, 0xBA, 0x5D, 0xA4, 0x21, 0x21, 0x7F, 0x11, 0xD4, 0x57, 0x3F, 0x1F, 0x45, 0xFC, 0x8C,
-    0x0F, 0x81, 0xE8, 0xC0, 0x94, 0xC2, 0xB1, 0xDF, 0x1E, 0xE3, 0x6E, 0x7B, 0x84, 0x3B, 0xB1, 0x64,
-    0x60, 0x5D, 0x38, 0x66, 0xE8, 0xF8, 0x5D, 0x05, 0xF8, 0xF1, 0x57, 0xC8, 0x95, 0x2B, 0x2C, 0x44,
-    0x31, 0xBD, 0xE4, 0x77, 0xFA, 0x66, 0xC4, 0x44, 0x14, 0xF4, 0x60, 0xEC, 0x97, 0x21, 0x06, 0x97,
-    0x0E, 0x36, 0x68, 0x6F, 0x43, 0x41, 0x7F, 0x70, 0xAF, 0x98, 0xE6, 0x6A, 0x49, 0xF0, 0x4C, 0x4E,
-    0xA0, 0x69, 0xF0, 0x4A, 0x37, 0xC9, 0x69, 0xF4, 0xF7, 0x8E, 0x72, 0x1A, 0x9A, 0x2B, 0xD7, 0x71,
-    0xAA, 0x7E, 0xFE, 0x1A, 0x4E, 0xC5, 0xAB, 0xBF, 0xC0, 0x29, 0xF3, 0x3F, 0xC3, 0x29, 0x15, 0xCA,
-    0x92, 0x53, 0x22, 0xBC, 0x51, 0x4E, 0xCB, 0x89, 0xA7, 0xC5, 0xC0, 0x53, 0x24, 0xC4, 0xB3, 0xCA,
-    0x08, 0x4E, 0xF4, 0x15, 0x39, 0xF9, 0x28, 0xF6, 0x94, 0x90, 0xEF, 0x58, 0x21, 0xE6, 0x54, 0x66,
-    0x65, 0x52, 0x0A, 0x2E, 0x41, 0xC1, 0x7E, 0xA6, 0xE0, 0x8D, 0xDB, 0x92, 0xC4, 0xA4, 0xF4, 0x58,
-    0x23, 0xA0, 0xDC, 0x44, 0x77, 0x6F, 0xE1, 0xCD, 0x29, 0x42, 0xD4, 0xDF, 0xEA, 0x1B, 0xB8, 0x90,
-    0x10, 0x32, 0x9E, 0x29, 0x78, 0xC3, 0x85, 0xB7, 0x47, 0x01, 0x46, 0xF8, 0x58, 0xD9, 0x31, 0xD6,
-    0xF1, 0x2B, 0x9E, 0xAC, 0x5D, 0x56, 0x9C, 0x68, 0x90, 0x94, 0x4A, 0x23, 0x1E, 0xE7, 0x2F, 0xC2,
-    0xFE, 0x79, 0x05, 0x36, 0xD2, 0x29, 0x96, 0xF6, 0x48, 0xA5, 0xE1, 0x08, 0x38, 0x30, 0x1D, 0x83,
-    0x2D, 0x49, 0xB4, 0x80, 0xC6, 0x1C, 0xFB, 0x13, 0x48, 0x3C, 0xAF, 0xDA, 0x16, 0xCC, 0x72, 0x2E,
-    0x02, 0xAC, 0x81, 0x6A, 0x1B, 0xDC, 0x6E, 0xBE, 0x6D, 0xE9, 0x30, 0xE2, 0x35, 0x18, 0x5D, 0xB1,
-    0x36, 0x2D, 0x43, 0x15, 0x56, 0x55, 0x5E, 0xDF, 0xEB, 0x85, 0x84, 0xE6, 0xE6, 0xF7, 0x08, 0x14,
-    0xA1, 0xC3, 0x15, 0x97, 0xAC, 0xF4, 0xF8, 0x3F, 0x08, 0xCD, 0x4B, 0x37, 0x4F, 0xBC, 0x29, 0xBF,
-    0xED, 0x11, 0xE5, 0x4D, 0x8C, 0xA8, 0x40, 0x38, 0x12, 0x73, 0xAF, 0x0F, 0xE4, 0xC3, 0x3B, 0x3E,
-    0x6F, 0x8D, 0x70, 0x60, 0xA1, 0xAB, 0x8E, 0x46, 0xD1, 0x9A, 0xAA, 0x1B, 0x7E, 0x46, 0x7F, 0xB2,
-    0x42, 0x38, 0x66, 0x44, 0x8F, 0x75, 0xEC, 0x7F, 0x25, 0x5A, 0x6D, 0x46, 0x79, 0x5D, 0xA1, 0xEB,
-    0x91, 0xD7, 0xE1, 0xFD, 0x3B, 0xE9, 0x7B, 0x46, 0x4D, 0xB7, 0x52, 0x18, 0x6E, 0xED, 0x42, 0xFC,
-    0x0D, 0x70, 0x67, 0x8C, 0xD3, 0x86, 0xAB, 0xAB, 0x06, 0xDA, 0xF5, 0x94, 0xBA, 0x10, 0x4B, 0x8C,
-    0x17, 0x42, 0x55, 0xA9, 0xE7, 0x0D, 0x98, 0x9A, 0x15, 0x40, 0x35, 0x51, 0x7A, 0xFC, 0x15, 0x91,
-    0x93, 0x9D, 0xAC, 0xF1, 0x6F, 0xF1, 0x21, 0x4D, 0x67, 0x40, 0x1A, 0xC2, 0x64, 0x12, 0x53, 0x53,
-    0xE9, 0x77, 0x26, 0xB9, 0xFF, 0x39, 0x54, 0x6E, 0x4C, 0x2F, 0x8C, 0xF8, 0x41, 0x85, 0xCC, 0xE7,
-    0x7E, 0xCC, 0x65, 0xA8, 0x48, 0xAC, 0x4A, 0xC2, 0xE7, 0xC4, 0x20, 0x78, 0x7A, 0x10, 0x2A, 0xDC,
-    0x14, 0xCF, 0x75, 0xA2, 0x11, 0x0C, 0x1E, 0x0C, 0xE0, 0xD9, 0x56, 0x5E, 0x76, 0x7B, 0xF2, 0xF2,
-    0x8E, 0x60, 0xC9, 0x2A, 0xA2, 0x78, 0xEB, 0x97, 0x84, 0x50, 0x94, 0x4F, 0x57, 0x9E, 0x8E, 0x45,
-    0x25, 0xD6, 0x7B, 0xBC, 0xFF, 0x1A, 0xF1, 0xF4, 0x97, 0x39, 0xEF, 0x1B, 0x84, 0x6C, 0x37, 0x1B,
-    0x80, 0x37, 0x05, 0x95, 0xF0, 0x8C, 0x7A, 0x68, 0xC2, 0x38, 0x7C, 0xC0, 0x9E, 0x98, 0x04, 0x0E,
-    0x93, 0x7A, 0x50, 0x00, 0xAA, 0x66, 0x0C, 0x76, 0x58, 0xFA, 0xAF, 0x61, 0x18, 0x9B, 0xDF, 0x0E,
-    0x34, 0x89, 0xD4, 0xB9, 0xAD, 0xB0, 0x35, 0x0D, 0xEC, 0xD4, 0x80, 0x51, 0x5A, 0x5C, 0x45, 0xA7,
-    0x51, 0x12, 0xE4, 0xBB, 0x38, 0x96, 0x40, 0x6E, 0x5D, 0x47, 0xB5, 0xB1, 0xE2, 0xD7, 0x72, 0xAA,
-    0xAE, 0x89, 0x39, 0xC1, 0xD9, 0x9B, 0x2F, 0x74, 0x73, 0x68, 0xB4, 0x99, 0xCA, 0x75, 0xC0, 0xBC,
-    0xD9, 0x37, 0xBE, 0xFB, 0xEB, 0x80, 0xD4, 0xBE, 0xED, 0xE9, 0x32, 0x22, 0x6D, 0x49, 0x19, 0x21,
-    0x8C, 0x54, 0xAE, 0xBC, 0x29, 0xA6, 0xB2, 0x28, 0xA8, 0xF7, 0xC9, 0x5A, 0x6B, 0x33, 0xE1, 0xCC,
-    0x75, 0xD3, 0x15, 0x3D, 0x19, 0x68, 0xD1, 0x51, 0x65, 0xAD, 0x54, 0x73, 0xA5, 0x02, 0x9B, 0x8D,
-    0x67, 0x4E, 0x43, 0xA5, 0xB7, 0xE8, 0x17, 0xFA, 0x42, 0xBF, 0x9E, 0xC9, 0xC3, 0x1E, 0xC1, 0x6A,
-    0xFF, 0xAD, 0x7F, 0x3C, 0xF8, 0x32, 0x75, 0xD5, 0x75, 0x88, 0x56, 0x64, 0x23, 0xDE, 0x49, 0x73,
-    0x63, 0xB5, 0x04, 0xBD, 0x8D, 0x88, 0x8E, 0x2D, 0x09, 0x33, 0x07, 0x25, 0xC9, 0x3A, 0x17, 0x8E,
-    0x27, 0x02, 0x49, 0xDA, 0x80, 0xF9, 0x03, 0x54, 0xDD, 0xF4, 0x09, 0x41, 0x00, 0x20, 0xD4, 0xA9,
-    0xC7, 0x5C, 0x2D, 0x75, 0x94, 0x74, 0x3C, 0x77, 0xC3, 0xF6, 0x43, 0x6C, 0x2B, 0x54, 0xC3, 0x81,
-    0x58, 0x03, 0xBD, 0xBB, 0xCD, 0x1A, 0xC1, 0xF6, 0x90, 0x79, 0x65, 0x06, 0x9B, 0x40, 0x98, 0x65,
-    0x5B, 0x91, 0x53, 0x37, 0x38, 0xCA, 0xCF, 0x21, 0x83, 0x24, 0x21, 0x5E, 0x7A, 0xAF, 0xC7, 0x1D,
-    0x2A, 0x24, 0x57, 0x0B, 0x75, 0x33, 0x37, 0x24, 0xA2, 0x7C, 0xD0, 0x10, 0x0B, 0xF7, 0x5E, 0x2E,
-    0xFC, 0xEA, 0xC1, 0xA0, 0x22, 0x2A, 0xDC, 0x39, 0xF9, 0x39, 0x06, 0x44, 0x53, 0x34, 0x5C, 0xA1,
-    0x48, 0x7D, 0xB7, 0x03, 0xD7, 0x34, 0x8A, 0x22, 0x52, 0xAC, 0x2E, 0x84, 0xD1, 0x60, 0x74, 0x1A,
-    0xB4, 0x1E, 0x52, 0xAF, 0x00, 0x0F, 0x81, 0x8B, 0x73, 0x49, 0x0B, 0xEB, 0xEC, 0x71, 0x35, 0x1F,
-    0x23, 0x7F, 0x82, 0xC0, 0x72, 0xB5, 0xA8, 0x8A, 0xD9, 0xAE, 0x2A, 0x67, 0x36, 0x71, 0xD3, 0x31,
-    0x6A, 0x40, 0x4A, 0xB1, 0x45, 0xF2, 0xD9, 0x30, 0x3D, 0x06, 0xDC, 0x41, 0x84, 0xDA, 0x6B, 0x74,
-    0xB3, 0xA5, 0x94, 0x37, 0xD9, 0x44, 0xB0, 0x7E, 0x45, 0x9B, 0x00, 0x5D, 0x06, 0xB3, 0x43, 0xA7,
-    0x0B, 0xE0, 0xF5, 0xD2, 0x6D, 0xC0, 0xD8, 0x1F, 0xD4, 0x0D, 0x3F, 0x38, 0x1A, 0x0F, 0x1B, 0x4D,
-    0x64, 0x0A, 0x69, 0x3F, 0xF2, 0xF7, 0x3B, 0x3F, 0xC7, 0x31, 0x69, 0x23, 0xEF, 0x47, 0xE3, 0xA4,
-    0xC9, 0x9D, 0x7C, 0x80, 0xF9, 0x9C, 0xE8, 0xE2, 0x5E, 0x71, 0x0E, 0xEC, 0x37, 0xC2, 0xB3, 0x3F,
-    0xA4, 0x0F, 0xD8, 0xD0, 0x6E, 0xE1, 0xCF, 0xFA, 0x26, 0x67, 0x94, 0x3B, 0x58, 0xCF, 0x8D, 0xA1,
-    0x74, 0x49, 0x40, 0xE6, 0x0C, 0xDA, 0xDE, 0x42, 0x75, 0x85, 0xC1, 0x73, 0x8B, 0xC0, 0x30, 0x52,
-    0xE0, 0xFE, 0xE6, 0x3C, 0x9E, 0x31, 0x8F, 0x57, 0xA8, 0x37, 0xD1, 0x64, 0xD9, 0x3D, 0x7E, 0x27,
-    0xF2, 0xD7, 0x9E, 0xA4, 0x2E, 0xC6, 0xB8, 0x14, 0x2A, 0xC1, 0xFE, 0x1A, 0xB3, 0x4B, 0x56, 0x39,
-    0xF8, 0xE0, 0x2A, 0xD5, 0xE3, 0xB8, 0x7D, 0x9D, 0xF1, 0x58, 0xF5, 0x06, 0xD4, 0x55, 0xFC, 0x6E,
-    0x63, 0x7E, 0x57, 0xB2, 0x34, 0x82, 0x2C, 0xA7, 0x60, 0x35, 0x42, 0x18, 0xBF, 0x37, 0x1C, 0xEE,
-    0x1E, 0x30, 0xE5, 0x18, 0x62, 0xAA, 0xA6, 0xB0, 0x20, 0xA7, 0x06, 0x74, 0xD7, 0xAB, 0x1F, 0xC8,
-    0x9F, 0x3E, 0x05, 0x94, 0x61, 0xA9, 0xA9, 0x29, 0x25, 0x93, 0x13, 0x70, 0x59, 0x84, 0x02, 0x2F,
-    0x6F, 0xB2, 0x91, 0x97, 0x85, 0xD9, 0xE8, 0xB7, 0x9B, 0x0D, 0xBF, 0xBD, 0x00, 0xDF, 0x81, 0x8E,
-    0xAA, 0x97, 0xC5, 0x6E, 0x4D, 0xE8, 0xF9, 0x00, 0xB7, 0xC7, 0x68, 0x76, 0x29, 0x43, 0x4F, 0x47,
-    0x63, 0xB5, 0x73, 0x13, 0x17, 0xD6, 0xBE, 0x75, 0x88, 0x5B, 0xAF, 0x4D, 0x7A, 0xB0, 0x41, 0x68,
-    0xCD, 0x32, 0x44, 0x37, 0xD5, 0x6C, 0x04, 0x02, 0x08, 0xC0, 0xF2, 0x90, 0xA1, 0xD3, 0xB4, 0xFC,
-    0x61, 0xFD, 0xE8, 0x91, 0x86, 0x49, 0x66, 0x08, 0x25, 0xEB, 0x08, 0x11, 0x84, 0x1C, 0x38, 0xBA,
-    0xB6, 0x7A, 0x05, 0xDA, 0xF0, 0x9C, 0x35, 0xB0, 0x83, 0x36, 0xA5, 0x5C, 0x37, 0x83, 0x54, 0x23,
-    0xFE, 0x08, 0x2A, 0x8D, 0x7A, 0x48, 0x70, 0x88, 0x0E, 0x8F, 0xF4, 0x42, 0x84, 0x64, 0xBB, 0x74,
-    0x05, 0xD5, 0x06, 0x71, 0x90, 0xC5, 0xB8, 0x0F, 0xDD, 0x49, 0xDB, 0xC5, 0x3E, 0x20, 0xF6, 0xE9,
-    0xC7, 0x5B, 0xB4, 0x02, 0xAA, 0x8E, 0xF0, 0x47, 0xA8, 0x9E, 0x98, 0x13, 0xD1, 0x45, 0x49, 0x63,
-    0x6B, 0xF2, 0x80, 0xA7, 0xBD, 0x72, 0xF0, 0xC8, 0x2B, 0xEF, 0x76, 0xB0, 0xC2, 0x6B, 0x68, 0xEA,
-    0x38, 0x57, 0x7A, 0xC6, 0x9C, 0xE6, 0xE3, 0xCD, 0xE7, 0x6B, 0xC2, 0xC2, 0x61, 0xD8, 0x63, 0xB4,
-    0x79, 0xAE, 0x7A, 0xFB, 0x1E, 0xD6, 0x21, 0x9E, 0x33, 0x69, 0xA0, 0x66, 0xEE, 0x5F, 0x80, 0xA0,
-    0xEF, 0x52, 0x75, 0x56, 0x03, 0x56, 0x19, 0xAD, 0x3D, 0x16, 0x9B, 0xC4, 0xF6, 0x3E, 0x4C, 0x30,
-    0x5E, 0x61, 0x31, 0x32, 0xD3, 0x3F, 0xA7, 0xEB, 0x2C, 0x43, 0x38, 0x28, 0xD4, 0x56, 0xC8, 0x18,
-    0x4A, 0x60, 0xA8, 0x81, 0x19, 0x46, 0xE8, 0x54, 0x11, 0xB5, 0xC1, 0xA4, 0x7A, 0x3A, 0x1D, 0x81,
-    0x12, 0x7F, 0x06, 0x3C, 0xB4, 0xCB, 0x80, 0xB9, 0xF0, 0xDE, 0x35, 0x56, 0x1A, 0x6C, 0xD4, 0x1C,
-    0x16, 0xD9, 0x1B, 0x50, 0x25, 0xA7, 0xFD, 0x83, 0xAD, 0x24, 0xFD, 0x1F, 0x61, 0xF1, 0x64, 0x7D,
-    0x10, 0xCE, 0x3C, 0xE4, 0x6D, 0x60, 0xA2, 0x67, 0x33, 0xDE, 0xF6, 0x28, 0x99, 0x7B, 0x35, 0xA8,
-    0x72, 0x06, 0x22, 0xFD, 0x4A, 0x8C, 0x19, 0xC0, 0x66, 0xCD, 0x3A, 0x42, 0x0C, 0xA4, 0x68, 0x03,
-    0xB0, 0xBA, 0xAB, 0xC0, 0x68, 0xC8, 0x75, 0xF2, 0xC1, 0x62, 0xDD, 0xA8, 0x6B, 0x19, 0x0C, 0xB1,
-    0x76, 0x7F, 0x22, 0xAD, 0x69, 0x98, 0x84, 0xB5, 0x52, 0x34, 0x89, 0x4E, 0xEC, 0x87, 0x0F, 0x10,
-    0x81, 0xF8, 0x53, 0x97, 0x4C, 0x09, 0xC2, 0x1F, 0x61, 0x32, 0x6E, 0x64, 0x74, 0xA6, 0xC8, 0xDF,
-    0x1C, 0xBE, 0x7E, 0x9B, 0xEC, 0xFF, 0xA8, 0x0C, 0x4A, 0x47, 0x62, 0xE0, 0x7C, 0x4F, 0x40, 0x76,
-    0x13, 0x3C, 0x55, 0xFB, 0x8D, 0x3F, 0xBE, 0x44, 0x1E, 0x50, 0x8A, 0x1E, 0x22, 0xCB, 0xC5, 0x1C,
-    0x58, 0x41, 0xCD, 0x8C, 0x0E, 0xA4, 0xEB, 0xBF, 0x20, 0x76, 0x55, 0x69, 0x47, 0x35, 0xD8, 0x19,
-    0x86, 0xD8, 0x18, 0xD3, 0x62, 0x4F, 0xA8, 0xF0, 0x42, 0x85, 0xED, 0x39, 0xD3, 0x1B, 0x6A, 0xB6,
-    0x35, 0x14, 0x5E, 0xDA, 0x9F, 0xF8, 0x78, 0xDC, 0xF9, 0x58, 0xEF, 0x8E, 0x69, 0x32, 0xC2, 0x1F,
-    0x2E, 0x83, 0x44, 0x4A, 0x9E, 0x7F, 0xB5, 0x69, 0x67, 0x15, 0x82, 0xE3, 0xCF, 0x14, 0x95, 0xCF,
-    0x7A, 0x55, 0xB4, 0xDA, 0x59, 0x17, 0x68, 0xC8, 0x32, 0x17, 0x21, 0xD1, 0x82, 0xA3, 0x4C, 0xFD,
-    0x0C, 0xDC, 0x96, 0xFE, 0x6E, 0xD8, 0xD1, 0x1A, 0x55, 0xFE, 0xC4, 0x8D, 0x13, 0xF0, 0x61, 0x43,
-    0x51, 0xEE, 0xEE, 0x52, 0x47, 0x3B, 0x31, 0x70, 0x6D, 0xA0, 0xEA, 0x2F, 0x73, 0x5A, 0x3D, 0x23,
-    0x3D, 0x43, 0xC8, 0x53, 0x54, 0x2A, 0x66, 0x74, 0xAD, 0x29, 0x79, 0x53, 0x80, 0x99, 0x6B, 0x62,
-    0xC5, 0x1A, 0x12, 0x16, 0x66, 0xF8, 0x4B, 0x95, 0xDC, 0xA6, 0x33, 0xEC, 0x6D, 0x86, 0x4B, 0x5B,
-    0x81, 0x0F, 0xE8, 0xDC, 0x66, 0xEA, 0x1B, 0x1E, 0x52, 0x99, 0x01, 0xD1, 0x4C, 0x73, 0xF9, 0x95,
-    0xB8, 0x15, 0x45, 0xFE, 0x89, 0x4C, 0xE1, 0x7D, 0x9A, 0x12, 0x25, 0x73, 0x0C, 0x73, 0xD5, 0xE6,
-    0x5E, 0x6A, 0x23, 0xDF, 0x03, 0x0B, 0x28, 0x64, 0xBD, 0x7D, 0x8D, 0xD6, 0xC0, 0x9B, 0x7E, 0xAD,
-    0xC6, 0x94, 0xB4, 0xE0, 0xEE, 0x1F, 0xEB, 0x5A, 0xCB, 0x7B, 0x80, 0xAE, 0x09, 0x42, 0xC5, 0x5A,
-    0x70, 0xD5, 0xC5, 0x93, 0x6E, 0x37, 0x66, 0xC4, 0x31, 0x88, 0xAF, 0xDD, 0x27, 0xA4, 0xAE, 0x51,
-    0x97, 0xAD, 0x06, 0x17, 0xBE, 0xC5, 0x1B, 0x51, 0xFF, 0x0A, 0x1A, 0x0D, 0x9B, 0xBC, 0xCE, 0xBF,
-    0x27, 0xCB, 0x05, 0xF2, 0x7B, 0x4A, 0xA7, 0x6A, 0x15, 0x04, 0xE3, 0xCE, 0x0F, 0x14, 0x0C, 0xE0,
-    0x15, 0xA2, 0x7D, 0x97, 0x29, 0x8C, 0x32, 0xA8, 0xF7, 0x31, 0xC8, 0x0B, 0x23, 0x79, 0x27, 0x13,
-    0x14, 0x68, 0x40, 0xC0, 0x9D, 0x8F, 0x45, 0x74, 0xA1, 0xDE, 0xFE, 0xCC, 0x3E, 0xD0, 0x65, 0x18,
-    0xF9, 0x65, 0x0E, 0x9B, 0xBA, 0x63, 0x46, 0x1C, 0xF4, 0xA9, 0x77, 0xF4, 0x06, 0x13, 0xA6, 0x4A,
-    0x20, 0x11, 0x17, 0xFC, 0x40, 0x8E, 0x51, 0x59, 0xC3, 0x88, 0xFA, 0x69, 0xA9, 0x50, 0x45, 0x67,
-    0xA1, 0xC0, 0xDB, 0x94, 0x83, 0xA8, 0x79, 0x41, 0x7D, 0x32, 0x83, 0x9A, 0x3E, 0xC5, 0x4A, 0xF3,
-    0xB7, 0x7A, 0x7B, 0x5B, 0xEB, 0x7A, 0xEC, 0x28, 0x50, 0x5C, 0x55, 0xF2, 0x21, 0x49, 0x8B, 0xE0,
-    0x1F, 0xE9, 0x0A, 0x65, 0xA9, 0x4B, 0x11, 0x18, 0x27, 0x73, 0x33, 0x51, 0xB0, 0xDD, 0x55, 0x20,
-    0xBA, 0xDE, 0x3F, 0xFF, 0xEA, 0x40, 0x51, 0x5A, 0x29, 0x24, 0xFB, 0x73, 0x2C, 0x3C, 0xA0, 0xB1,
-    0x74, 0x26, 0x10, 0xAD, 0xC5, 0x13, 0xF7, 0xCB, 0xB0, 0x14, 0xFA, 0x54, 0xA3, 0x81, 0x44, 0x37,
-    0x26, 0x65, 0x74, 0xC0, 0x88, 0xE0, 0x36, 0x5B, 0x28, 0xD7, 0xAB, 0x23, 0xCD, 0x1A, 0x3B, 0xE7,
-    0x7C, 0xED, 0xC9, 0x90, 0x71, 0xB7, 0xB2, 0x33, 0x61, 0x62, 0xFF, 0x9B, 0x46, 0x24, 0xC6, 0xB5,
-    0xA7, 0xA1, 0x7F, 0xE8, 0xFD, 0x99, 0x9D, 0xD3, 0x1B, 0xDE, 0x87, 0xEB, 0x55, 0x9F, 0x13, 0x88,
-    0xA3, 0x9A, 0x0E, 0x36, 0x23, 0x06, 0x1E, 0xF2, 0x3C, 0x4F, 0x76, 0x22, 0x5F, 0x99, 0xEA, 0x41,
-    0x0E, 0x96, 0x04, 0x6B, 0xAD, 0x9E, 0xD9, 0x99, 0xBA, 0xDA, 0x95, 0x9F, 0x2D, 0x74, 0xBC, 0x95,
-    0xA1, 0x99, 0x0F, 0x3E, 0xB3, 0x70, 0x9D, 0xF2, 0x6E, 0x47, 0x96, 0x86, 0x21, 0xA5, 0x56, 0xA3,
-    0x3C, 0x8D, 0xAE, 0xC6, 0x52, 0x99, 0x1A, 0xCC, 0x8C, 0x8A, 0x01, 0xAE, 0xC4, 0x02, 0x14, 0x56,
-    0x60, 0xA6, 0x06, 0x59, 0xDC, 0xDB, 0x5D, 0xD0, 0x01, 0x14, 0xD6, 0x96, 0xD2, 0x91, 0x7F, 0x9F,
-    0x46, 0x59, 0xFD, 0x3B, 0x76, 0xA1, 0xDF, 0xEA, 0xFD, 0x74, 0xDD, 0x2E, 0x2D, 0x0E, 0x58, 0x33,
-    0x3F, 0x19, 0x69, 0x4F, 0xBD, 0xF0, 0x9C, 0xB8, 0x5F, 0x3C, 0xD7, 0x01, 0xC2, 0x5C, 0x93, 0x7B,
-    0xBA, 0x06, 0x4C, 0x35, 0x26, 0xEB, 0x2C, 0xAE, 0xD7, 0x29, 0xC5, 0x4C, 0xD1, 0xC3, 0x0D, 0xEC,
-    0x37, 0x0D, 0xB0, 0xD7, 0x1F, 0x0E, 0x21, 0x62, 0x47, 0xF3, 0xAE, 0xFC, 0x6F, 0x98, 0x1F, 0xF9,
-    0x08, 0xA5, 0x2E, 0x1D, 0x90, 0xC8, 0x55, 0x26, 0x30, 0xE8, 0x28, 0xF1, 0x85, 0x04, 0xD6, 0x05,
-    0x4C, 0xA3, 0xBA, 0x00, 0xC8, 0xC7, 0xB0, 0x14, 0xE7, 0x3E, 0x2F, 0xCD, 0xFA, 0x12, 0x9B, 0xF0,
-    0x67, 0x3B, 0x71, 0x18, 0x6A, 0x09, 0x9B, 0x27, 0x3A, 0xEF, 0xF5, 0x8D, 0x6A, 0xAE, 0xAA, 0xEC,
-    0x3E, 0x71, 0x6E, 0x8E, 0xCF, 0x47, 0x8B, 0xB6, 0xC2, 0x6C, 0x17, 0x1A, 0x68, 0x17, 0x83, 0x66,
-    0xDC, 0xC2, 0xFD, 0x59, 0xC3, 0xC8, 0xCC, 0xC1, 0x99, 0x41, 0xC9, 0xDD, 0x36, 0xEB, 0xEC, 0x1B,
-    0xE5, 0xD9, 0xA6, 0x2F, 0x19, 0x7E, 0xD0, 0x91, 0x95, 0x4F, 0x05, 0xA0, 0xD6, 0x09, 0x3E, 0xB5,
-    0x64, 0xD2, 0x94, 0x20, 0x47, 0x62, 0xA8, 0x01, 0x9E, 0x34, 0x2B, 0xB0, 0x4C, 0x7A, 0x1E, 0x45,
-    0xA4, 0x40, 0x8C, 0xA6, 0x9C, 0x8A, 0x25, 0x40, 0x5E, 0x91, 0xF0, 0x54, 0x56, 0x88, 0x15, 0x4C,
-    0x16, 0xAB, 0xBC, 0xE1, 0xCF, 0xAA, 0xB3, 0xBA, 0xDF, 0x46, 0x11, 0x69, 0x10, 0xDD, 0x52, 0x83,
-    0x9B, 0x14, 0x71, 0xC5, 0x17, 0xEE, 0x40, 0x16, 0x0E, 0x2C, 0x84, 0x96, 0x46, 0x1B, 0x95, 0x02,
-    0xB6, 0x59, 0xB3, 0xA2, 0x32, 0x3E, 0x2E, 0x6A, 0x4A, 0x5B, 0xDD, 0x50, 0x56, 0x88, 0xA0, 0x56,
-    0xD0, 0x6C, 0x85, 0xC0, 0x57, 0x4C, 0xF0, 0x5D, 0xD1, 0xD4, 0x7A, 0xFF, 0x47, 0xB1, 0x76, 0x35,
-    0x0D, 0xD6, 0xCC, 0x9F, 0xC6, 0x2C, 0x1F, 0x25, 0x8A, 0xAC, 0xDB, 0x52, 0xBC, 0x86, 0x28, 0xE8,
-    0x31, 0xE1, 0x9A, 0x8D, 0x55, 0x97, 0x64, 0x3E, 0x8A, 0xFA, 0x14, 0x34, 0x97, 0x34, 0x32, 0x05,
-    0xFC, 0x48, 0xBB, 0x4E, 0x65, 0xFE, 0xF0, 0xD0, 0xFF, 0xE6, 0xF0, 0x01, 0x35, 0x0A, 0x15, 0x74,
-    0x63, 0x50, 0x25, 0x3C, 0xCF, 0xE0, 0x7E, 0xF1, 0x00, 0x50, 0xB7, 0x4E, 0xDB, 0x1C, 0x3C, 0xB0,
-    0x58, 0x55, 0xF8, 0xD6, 0xE8, 0xBE, 0x85, 0xFC, 0xA5, 0x4B, 0x33, 0x24, 0x21, 0xA4, 0xF3, 0x84,
-    0x86, 0xDE, 0x58, 0xEE, 0x17, 0x0B, 0x3B, 0xBC, 0xE2, 0x35, 0x00, 0x0B, 0xC9, 0x17, 0x48, 0x7A,
-    0x82, 0xCF, 0x74, 0x03, 0x16, 0x4F, 0xC2, 0x2C, 0x71, 0x09, 0xEC, 0xA3, 0xE8, 0xD5, 0xA1, 0x0B,
-    0x0F, 0x86, 0x23, 0xC6, 0xA9, 0xD1, 0x41, 0xEB, 0x00, 0xC9, 0x54, 0x67, 0xF8, 0xD5, 0xDE, 0x65,
-    0x22, 0xA3, 0xD3, 0x0C, 0xE0, 0x17, 0x96, 0x9F, 0x5B, 0xCF, 0x68, 0x57, 0x61, 0x81, 0x45, 0x94,
-    0xBB, 0x64, 0x15, 0x10, 0xE1, 0xD7, 0xAB, 0x93, 0x87, 0x5A, 0x61, 0xFF, 0x9B, 0x6C, 0xF5, 0x0F,
-    0x58, 0xDD, 0x0E, 0x61, 0xD0, 0x4F, 0xD8, 0x30, 0xC8, 0x32, 0x3E, 0x08, 0x41, 0x6D, 0x9A, 0xFB,
-    0x4D, 0xBB, 0x46, 0xC5, 0x01, 0x0D, 0x2B, 0x2E, 0x1C, 0x20, 0xB8, 0x4B, 0xC6, 0xE0, 0x14, 0xEA,
-    0x70, 0xA7, 0x4D, 0xC6, 0xB5, 0x33, 0xDD, 0x40, 0xD8, 0xEF, 0x25, 0x46, 0x78, 0xA1, 0x31, 0xC2,
-    0xEE, 0xDC, 0x18, 0xE1, 0x4A, 0xEB, 0x84, 0xF8, 0x1B, 0x4F, 0xE3, 0xE1, 0xE1, 0xE1, 0x1C, 0x2A,
-    0x4C, 0x10, 0xA7, 0x82, 0xE3, 0x07, 0x86, 0xE3, 0x2D, 0x63, 0x84, 0x33, 0xC6, 0x08, 0x1F, 0xDF,
-    0x10, 0x23, 0xBC, 0x22, 0xC9, 0x93, 0x44, 0x2E, 0xA8, 0xEF, 0xFE, 0x5C, 0x14, 0xBA, 0x84, 0x69,
-    0x24, 0x6F, 0x1E, 0x55, 0xDF, 0x28, 0x0B, 0x29, 0x20, 0xF2, 0xF2, 0xA2, 0xB4, 0x44, 0x8D, 0xF4,
-    0x53, 0x25, 0xDC, 0xEB, 0x87, 0x0F, 0x7A, 0xD8, 0x6A, 0xC2, 0x93, 0x4A, 0x57, 0xB5, 0x80, 0xA6,
-    0x7B, 0x64, 0x4B, 0x8B, 0x05, 0x02, 0x2D, 0xF6, 0x5C, 0x14, 0x7A, 0x37, 0x1F, 0x43, 0x18, 0x48,
-    0xA5, 0xD9, 0x26, 0xCF, 0xE2, 0xE7, 0x97, 0xB0, 0x5B, 0x58, 0x77, 0x62, 0x5D, 0x30, 0x58, 0x5E,
-    0x94, 0x32, 0x58, 0xE3, 0xBF, 0x45, 0xB8, 0x3A, 0xA7, 0xB1, 0x19, 0xC8, 0xFA, 0x29, 0x6C, 0x88,
-    0xAF, 0xBA, 0x64, 0x54, 0xAC, 0x51, 0xF5, 0xCB, 0x92, 0x69, 0x46, 0xF0, 0x7E, 0x94, 0x54, 0x30,
-    0x99, 0xAB, 0x55, 0x8C, 0x4B, 0x05, 0x46, 0xDB, 0x4A, 0x63, 0x69, 0x15, 0x4F, 0x68, 0x3A, 0x52,
-    0xD4, 0xD2, 0xFF, 0x4D, 0x67, 0x79, 0xE0, 0x6E, 0x1B, 0xDE, 0xC9, 0xB8, 0x7C, 0xCD, 0x2D, 0x59,
-    0x29, 0x33, 0xE9, 0xDD, 0x5C, 0xF4, 0x62, 0x5B, 0x68, 0x24, 0x1D, 0x6F, 0xE4, 0xD4, 0x77, 0x91,
-    0x1B, 0xE6, 0x48, 0x4D, 0x15, 0xFD, 0xF4, 0x0A, 0xED, 0xBC, 0x11, 0x41, 0x8E, 0x05, 0x96, 0x3B,
-    0x53, 0x3E, 0x60, 0xBB, 0xFC, 0x52, 0x2E, 0xD6, 0x68, 0x6C, 0x35, 0x44, 0xEA, 0xAC, 0x87, 0x30,
-    0xCB, 0xC6, 0xA5, 0xF9, 0x03, 0x91, 0xD6, 0xE6, 0x13, 0x35, 0xD2, 0xD4, 0xC3, 0xFE, 0xB8, 0x22,
-    0xBC, 0x86, 0xE1, 0xAD, 0xB6, 0x3C, 0xAF, 0xB0, 0x2C, 0xA9, 0xCD, 0xF9, 0x0D, 0x92, 0x4B, 0x83,
-    0xE6, 0x96, 0xA7, 0xAD, 0xE6, 0x95, 0x16, 0x9B, 0xD4, 0x56, 0x84, 0x46, 0xE4, 0xFA, 0x39, 0x39,
-    0x74, 0xFD, 0xE9, 0x4B, 0x9F, 0xB9, 0x1E, 0xD2, 0x67, 0x8E, 0xB4, 0xE5, 0xE3, 0x99, 0x84, 0xEA,
-    0x50, 0x16, 0x20, 0x35, 0x40, 0xA9, 0xDA, 0xB8, 0x1D, 0x91, 0x6C, 0xFC, 0x77, 0x86, 0x99, 0xA2,
-    0x21, 0x84, 0x82, 0x31, 0x59, 0x1D, 0x24, 0xD6, 0xE1, 0x33, 0xA4, 0xC8, 0x22, 0x76, 0x66, 0x05,
-    0x7C, 0x32, 0xEB, 0xCD, 0x03, 0xD9, 0xCF, 0x86, 0xE3, 0xB9, 0x1E, 0x48, 0x46, 0xEA, 0xAD, 0x89,
-    0x56, 0x4A, 0xBB, 0x46, 0x0B, 0xF8, 0x10, 0x99, 0x0C, 0x73, 0x1F, 0x26, 0x23, 0x81, 0x33, 0xA8,
-    0xAC, 0xEB, 0x0C, 0xE4, 0x23, 0x42, 0x14, 0x17, 0xB2, 0xDF, 0xE3, 0xC2, 0xC5, 0x97, 0x34, 0x4F,
-    0xAB, 0x02, 0x5D, 0x6D, 0x08, 0x10, 0xC8, 0xBA, 0x45, 0xC8, 0x0E, 0x74, 0x4C, 0x5D, 0x1D, 0x05,
-    0xF5, 0x6C, 0x7A, 0x20, 0xA5, 0xD3, 0x50, 0x87, 0x1B, 0xF8, 0x31, 0x74, 0x92, 0x35, 0x5B, 0x58,
-    0xA5, 0x8C, 0x2E, 0x87, 0xC5, 0xB8, 0x13, 0xFA, 0xC6, 0x74, 0x2B, 0x97, 0xD4, 0xEF, 0x20, 0x58,
-    0x2A, 0x09, 0xA5, 0x58, 0x34, 0xEC, 0xBC, 0xBB, 0xCD, 0xC1, 0x52, 0xD1, 0xE5, 0x95, 0x65, 0x39,
-    0x73, 0xA5, 0x56, 0x2A, 0x06, 0x57, 0x41, 0xF0, 0xEB, 0x67, 0x8A, 0xD4, 0xB5, 0xEE, 0xCB, 0xFE,
-    0xDA, 0x13, 0x3B, 0x17, 0x76, 0x0F, 0xAF, 0xFC, 0xAB, 0x65, 0x3D, 0xB1, 0xAD, 0xA2, 0x88, 0x4B,
-    0xF3, 0x56, 0x88, 0xAA, 0xA3, 0x69, 0xB0, 0x73, 0x00, 0x82, 0xB4, 0xAA, 0xA8, 0x6B, 0x77, 0x95,
-    0x45, 0x7F, 0x9C, 0xCC, 0x19, 0xC2, 0xEF, 0x31, 0x4F, 0xE1, 0x25, 0x68, 0x93, 0x39, 0xC3, 0x9B,
-    0x08, 0x6F, 0x5D, 0xBC, 0x31, 0x4F, 0x81, 0xB6, 0xD9, 0x41, 0xC6, 0x08, 0xBA, 0xBF, 0x7F, 0x77,
-    0x79, 0x0A, 0x1F, 0xA4, 0xE3, 0xED, 0xDE, 0xFB, 0x30, 0x00, 0x39, 0x1D, 0x6F, 0x5F, 0xA1, 0xE3,
-    0xAD, 0xA1, 0xE3, 0xCD, 0xDF, 0xE4, 0x78, 0x43, 0x14, 0xE2, 0xDF, 0x3D, 0xB8, 0xC1, 0x7C, 0x26,
-    0x0C, 0xDC, 0xFC, 0x37, 0xEF, 0xCC, 0xF1, 0x66, 0xC1, 0x17, 0x24, 0x49, 0x72, 0x6D, 0xB5, 0x58,
-    0x84, 0x0E, 0x1F, 0x44, 0x3D, 0x1D, 0xAF, 0x07, 0x0C, 0xFC, 0x88, 0xE4, 0xD9, 0x9F, 0x38, 0xCB,
-    0x50, 0xFB, 0xE0, 0x0F, 0x08, 0xF4, 0x52, 0x58, 0xA2, 0x99, 0x0F, 0x08, 0xA0, 0x0E, 0x8C, 0x00,
-    0x70, 0xD9, 0x82, 0x30, 0xE6, 0xB3, 0x5E, 0x39, 0x22, 0x51, 0x11, 0x59, 0x62, 0xD7, 0x9E, 0x5E,
-    0x31, 0xE5, 0xD8, 0x82, 0xCD, 0xDE, 0xDD, 0x8B, 0x3C, 0x54, 0x27, 0x62, 0x0E, 0xC7, 0xFB, 0xCF,
-    0xE9, 0x3E, 0xF4, 0xD7, 0x1F, 0xE0, 0x22, 0x25, 0x4E, 0x3D, 0xB8, 0xBD, 0x23, 0x7F, 0x58, 0xBE,
-    0xBF, 0x9C, 0xEE, 0x2C, 0xE4, 0x11, 0x73, 0x15, 0x0C, 0x84, 0x81, 0xB0, 0x92, 0xB7, 0x07, 0xC6,
-    0xEE, 0x31, 0x94, 0xAF, 0xFC, 0xB2, 0x3F, 0xBD, 0xA4, 0xF1, 0x53, 0x7C, 0x75, 0xCB, 0xE1, 0x4E,
-    0x2C, 0xC8, 0xAC, 0xD5, 0xDF, 0x63, 0xC7, 0x55, 0xC9, 0xE3, 0x7A, 0xA7, 0x59, 0x42, 0x74, 0x18,
-    0x7D, 0x2F, 0x19, 0x2A, 0xCA, 0xA0, 0xF9, 0x84, 0xA9, 0xDB, 0x91, 0x66, 0x1D, 0x7E, 0x3B, 0x44,
-    0x33, 0xA6, 0x7E, 0xA7, 0x32, 0x99, 0xEA, 0xAB, 0xC5, 0xB6, 0xBC, 0x4D, 0x6D, 0x45, 0xC9, 0x88,
-    0x22, 0x6A, 0x04, 0xA2, 0xC6, 0x98, 0x76, 0x56, 0xD2, 0x45, 0x03, 0xDD, 0xB5, 0x28, 0x99, 0xC6,
-    0xC0, 0x43, 0x9A, 0x64, 0x70, 0x81, 0x09, 0xB9, 0x5F, 0x66, 0x01, 0x32, 0x06, 0xCE, 0x9A, 0x97,
-    0x93, 0x5C, 0x9E, 0xA8, 0x9B, 0x16, 0x84, 0x61, 0x4D, 0x33, 0x14, 0x20, 0x53, 0xFF, 0x66, 0x08,
-    0xA4, 0x73, 0xEE, 0xCB, 0x97, 0x14, 0x44, 0x53, 0x2F, 0x8D, 0xBE, 0x74, 0xD5, 0xC9, 0x21, 0xB9,
-    0x7D, 0xC2, 0xC8, 0x91, 0x6F, 0xE3, 0xE5, 0xA2, 0x54, 0x60, 0x76, 0xE9, 0xFF, 0xF3, 0x01, 0x9B,
-    0xCE, 0xE4, 0x5A, 0x46, 0x0C, 0x52, 0x27, 0xAD, 0x2B, 0x8F, 0x1B, 0x00, 0x17, 0xC0, 0x89, 0x65,
-    0x30, 0x76, 0xB9, 0x40, 0x05, 0xBB, 0x32, 0x87, 0x07, 0x6C, 0x01, 0x28, 0xB6, 0x34, 0x24, 0x70,
-    0x15, 0x1A, 0xA9, 0x86, 0x33, 0x33, 0x06, 0x10, 0x9C, 0xA5, 0x8E, 0xEB, 0x4A, 0xBD, 0x13, 0xF8,
-    0xBD, 0xEC, 0xAA, 0xFB, 0x43, 0x3E, 0xF8, 0xAD, 0xF3, 0xC1, 0xDB, 0x90, 0x0F, 0x9E, 0x4D, 0x5B,
-    0xDB, 0x7C, 0xAE, 0xC1, 0x16, 0x6F, 0x95, 0xAF, 0x62, 0x75, 0x4E, 0x58, 0x79, 0x3E, 0x7F, 0x18,
-    0xF5, 0xF3, 0x87, 0x9F, 0x2D, 0x3F, 0x79, 0xE1, 0x66, 0x1B, 0x0D, 0x37, 0x4B, 0xC6, 0x1B, 0xC2,
-    0xE9, 0xB7, 0x7E, 0xB9, 0xD5, 0xAC, 0x7A, 0xDA, 0x78, 0x05, 0xD4, 0xF0, 0xEF, 0x3F, 0xCE, 0x79,
-    0xF4, 0x97, 0xDB, 0xD9, 0xA5, 0x1C, 0x63, 0x2C, 0xEB, 0x86, 0x71, 0x03, 0x6D, 0x88, 0x70, 0xC8,
-    0xF4, 0xC7, 0x77, 0x8A, 0xEE, 0x7D, 0x08, 0xD1, 0x76, 0x8F, 0x85, 0x68, 0xBB, 0x5A, 0xE1, 0x89,
-    0x2F, 0xB0, 0x3F, 0xC1, 0x41, 0xB3, 0xF6, 0xA6, 0xF8, 0x67, 0x41, 0x60, 0xD0, 0x2B, 0xF2, 0xF1,
-    0x4C, 0x06, 0x8F, 0xDE, 0x51, 0x32, 0xF8, 0xB4, 0xBB, 0xA2, 0x8C, 0xA6, 0xE2, 0x61, 0x97, 0xA0,
-    0xC2, 0xA9, 0x3F, 0xE3, 0xEC, 0x7D, 0xE2, 0xA3, 0x0A, 0xA5, 0x1B, 0xB6, 0x59, 0x57, 0x0A, 0x3E,
-    0xB2, 0xCD, 0x49, 0xBB, 0x5D, 0xE3, 0xDF, 0x51, 0x5A, 0xE7, 0xAC, 0x7C, 0x61, 0x9D, 0x68, 0x54,
-    0xB4, 0xD3, 0xEE, 0xF6, 0xD4, 0xC1, 0x0B, 0x8D, 0x83, 0x4F, 0x98, 0x10, 0x0E, 0xFD, 0x93, 0x51,
-    0xDE, 0x19, 0x33, 0x18, 0x2F, 0xA8, 0x15, 0xF8, 0x3A, 0xCD, 0x40, 0xD1, 0x0B, 0x75, 0x6A, 0x5E,
-    0x6F, 0xE9, 0xAA, 0xF1, 0xF9, 0xD1, 0xC6, 0x85, 0x40, 0x7E, 0xB2, 0xC5, 0xD6, 0x16, 0x3B, 0x7D,
-    0x5B, 0xB9, 0xFA, 0x57, 0x5E, 0x7F, 0x4D, 0xD9, 0x5E, 0x4E, 0x9E, 0x28, 0xDF, 0x6D, 0x08, 0xA5,
-    0x65, 0x4B, 0x9D, 0x1F, 0xCA, 0xA7, 0x54, 0x73, 0xE6, 0xB4, 0xD0, 0xE6, 0x86, 0xB2, 0xBE, 0xD0,
-    0x6A, 0x0C, 0x11, 0x23, 0x96, 0xD0, 0xE6, 0xDE, 0x42, 0xF9, 0x75, 0xF9, 0x7E, 0xBE, 0x0C, 0x90,
-    0xAA, 0x3C, 0x61, 0xDD, 0x30, 0x88, 0xA3, 0x62, 0xEA, 0x1C, 0x8D, 0x0F, 0x70, 0xFA, 0x78, 0xFC,
-    0xE6, 0xD2, 0x7F, 0x86, 0x42, 0xF9, 0x8B, 0x29, 0x90, 0xA0, 0x2F, 0xE6, 0x18, 0xE3, 0xA3, 0xAA,
-    0x54, 0x97, 0x32, 0x8F, 0xF8, 0x24, 0x23, 0xD0, 0xF7, 0xC5, 0xBC, 0xE3, 0x9D, 0xB0, 0xEB, 0xBF,
-    0x98, 0x60, 0xD8, 0x5D, 0x1C, 0x60, 0xC1, 0x9C, 0x18, 0x31, 0x7F, 0x05, 0x46, 0x92, 0xC5, 0xAF,
-    0xEC, 0x1F, 0xBC, 0x1D, 0xAD, 0x17, 0x16, 0x5F, 0xF2, 0x0A, 0xAE, 0x21, 0xFF, 0x53, 0x4E, 0x57,
-    0x64, 0xEA, 0x9F, 0xF6, 0xA7, 0xDF, 0x3D, 0x43, 0xEB, 0xD9, 0x47, 0x57, 0xF8, 0x80, 0x66, 0x8B,
-    0x55, 0x67, 0x52, 0x88, 0xA1, 0xB2, 0xB0, 0xA9, 0xD5, 0x16, 0xB4, 0x94, 0xE3, 0x1E, 0x3D, 0xF7,
-    0x15, 0x8C, 0x0C, 0xE9, 0x9A, 0xD8, 0x2F, 0x94, 0x5F, 0x2B, 0x66, 0x4C, 0xAC, 0xD2, 0x93, 0x6F,
-    0xC2, 0x48, 0x41, 0xFA, 0x07, 0x3D, 0x40, 0x7E, 0xC5, 0x85, 0xFD, 0x82, 0x9F, 0xA3, 0x87, 0x34,
-    0x2F, 0x5C, 0xF4, 0xF3, 0x35, 0xAF, 0xB6, 0xBC, 0x13, 0x41, 0x50, 0x2B, 0xF4, 0x08, 0xCD, 0x63,
-    0x68, 0x03, 0xA3, 0x54, 0x97, 0x8C, 0xD3, 0x8B, 0x18, 0x3B, 0xE3, 0x9A, 0xED, 0x58, 0x1F, 0x1E,
-    0xE8, 0x60, 0x33, 0x45, 0x87, 0xF2, 0x38, 0x25, 0xEE, 0x86, 0xD4, 0xCF, 0x35, 0x3D, 0xE3, 0xD2,
-    0x0D, 0x7A, 0xC6, 0x45, 0xF8, 0xFB, 0x12, 0xF1, 0x08, 0xB5, 0xF0, 0x50, 0xC4, 0x77, 0x20, 0xF7,
-    0xA9, 0xE9, 0x20, 0x16, 0xF7, 0xE4, 0xAC, 0x22, 0xBF, 0xE9, 0x32, 0xE5, 0xB2, 0x27, 0x2A, 0x35,
-    0x42, 0x15, 0xBC, 0xA0, 0x5F, 0xAB, 0x0D, 0x49, 0x70, 0xCB, 0x60, 0x1A, 0xD5, 0xA8, 0xE4, 0xFB,
-    0xAA, 0xBB, 0x74, 0x5A, 0x10, 0x0E, 0x26, 0xE2, 0x86, 0xE7, 0x85, 0x82, 0xB8, 0x9D, 0xA2, 0xBF,
-    0x0D, 0xDC, 0x7C, 0x18, 0xC8, 0x93, 0x92, 0xE5, 0x47, 0xD8, 0xDE, 0x96, 0x1A, 0x28, 0x74, 0x30,
-    0xAC, 0xFC, 0x28, 0x84, 0x29, 0x5C, 0x08, 0xAE, 0x71, 0x6A, 0xC6, 0xD5, 0x5A, 0xB5, 0xD9, 0x56,
-    0x6B, 0x92, 0xB6, 0x88, 0x1B, 0x91, 0xAF, 0xC2, 0xB3, 0x9E, 0x9D, 0x1C, 0xE0, 0x04, 0x1E, 0x1D,
-    0x71, 0xAC, 0xBF, 0x23, 0x27, 0x4F, 0xEE, 0xF3, 0xC2, 0xB4, 0x8D, 0xD2, 0xD2, 0x88, 0x43, 0x39,
-    0xBD, 0x60, 0x66, 0xA8, 0xA7, 0xAB, 0x92, 0x89, 0x18, 0xF8, 0x3A, 0x93, 0x9D, 0x31, 0xE8, 0x36,
-    0xEA, 0xC0, 0x07, 0x62, 0x46, 0xA3, 0x0E, 0x0B, 0x6A, 0xFC, 0x83, 0x95, 0xAE, 0x75, 0xFB, 0xA5,
-    0x15, 0x57, 0x38, 0x68, 0x34, 0x72, 0x90, 0xD5, 0x02, 0x73, 0xE6, 0x6C, 0x4E, 0x65, 0x66, 0x59,
-    0x34, 0x5A, 0x64, 0xAB, 0x9D, 0xEB, 0xE5, 0xBE, 0xE3, 0x73, 0x35, 0xCC, 0xF5, 0x15, 0x6E, 0x3E,
-    0x9F, 0x1E, 0x1F, 0x37, 0xEF, 0xF1, 0xB9, 0xAC, 0x8C, 0x78, 0x02, 0xD5, 0xEA, 0xC0, 0x4A, 0x2C,
-    0x0C, 0xD6, 0xFE, 0xD1, 0xDA, 0x6F, 0x0A, 0x41, 0x66, 0xE7, 0x00, 0xBC, 0xA4, 0xFD, 0xD9, 0x73,
-    0x62, 0x3C, 0x3E, 0xB6, 0xBC, 0xAD, 0xA5, 0x9D, 0xA3, 0x27, 0x34, 0x6C, 0x37, 0xA1, 0x83, 0x42,
-    0x06, 0xA3, 0x03, 0x9E, 0x54, 0x0D, 0x16, 0x6F, 0x6B, 0x21, 0xB8, 0x37, 0xBF, 0x61, 0xE0, 0x6E,
-    0xB1, 0xCD, 0xB1, 0x46, 0x39, 0xAE, 0xE3, 0xCB, 0x6F, 0xFD, 0x9D, 0x5A, 0x6B, 0x0E, 0x97, 0x8C,
-    0x25, 0x43, 0x04, 0xF7, 0x8B, 0xFC, 0xD1, 0x71, 0xA7, 0x6E, 0x9B, 0x45, 0x26, 0x35, 0x5A, 0x64,
-    0xAD, 0xDF, 0xC1, 0x4E, 0x96, 0xDA, 0x81, 0x2C, 0xD4, 0xE5, 0x61, 0x4A, 0x3B, 0xF3, 0x38, 0xC3,
-    0x48, 0x20, 0x20, 0x8B, 0x53, 0x09, 0x4B, 0x16, 0x73, 0x32, 0x3D, 0x3D, 0xDA, 0x20, 0x6A, 0x4D,
-    0xEA, 0xF3, 0x5F, 0xF4, 0xF6, 0x22, 0x3A, 0x98, 0x47, 0x7E, 0x9E, 0xD2, 0x79, 0x0E, 0xCF, 0x7B,
-    0x61, 0xD3, 0x7A, 0xF6, 0x5B, 0xEF, 0xFA, 0x85, 0x4D, 0x2F, 0x11, 0x9F, 0x55, 0x88, 0xC3, 0x58,
-    0xCF, 0xB9, 0x5E, 0xB9, 0x62, 0x2D, 0x98, 0x22, 0xD8, 0x1F, 0xB5, 0xE2, 0xD8, 0x0C, 0x87, 0x59,
-    0x61, 0x96, 0x3C, 0x02, 0x06, 0x6A, 0x0A, 0x64, 0x0E, 0xF3, 0x32, 0xBC, 0x55, 0x00, 0x7E, 0xD9,
-    0xEA, 0x54, 0xDD, 0xB5, 0xAD, 0x1E, 0x6D, 0x95, 0x60, 0x38, 0x5B, 0x61, 0x86, 0x6C, 0x8A, 0x6E,
-    0xF1, 0x56, 0xE7, 0x0C, 0x16, 0x3B, 0x26, 0xCD, 0x19, 0xA9, 0x84, 0x82, 0x18, 0xCA, 0x62, 0x4C,
-    0x5E, 0x36, 0x73, 0x88, 0xA1, 0x82, 0xED, 0x0A, 0xE8, 0x9F, 0x1C, 0x3E, 0x64, 0x0C, 0xB8, 0x0D,
-    0x08, 0xE1, 0x7B, 0x7C, 0xF5, 0x7F, 0x4E, 0x4B, 0x7B, 0xA5, 0x39, 0x78, 0x6D, 0xA8, 0x8E, 0x1D,
-    0x5E, 0x6D, 0xF4, 0xD5, 0xAF, 0x8E, 0xD4, 0x1A, 0x25, 0x18, 0x36, 0x84, 0xA7, 0x34, 0xF3, 0x2B,
-    0x26, 0xAF, 0xB9, 0xAD, 0x71, 0x7A, 0xF6, 0x55, 0xB6, 0xF3, 0x0A, 0xCC, 0x30, 0x9E, 0x6D, 0xD5,
-    0x86, 0x15, 0xB3, 0x2D, 0xD3, 0xDD, 0xE5, 0x21, 0xE7, 0x7D, 0xAE, 0x82, 0x6A, 0x21, 0xD1, 0x6E,
-    0x36, 0xF8, 0x77, 0x0A, 0x35, 0x38, 0x2D, 0x10, 0xE5, 0xDC, 0x6C, 0xC9, 0x2A, 0x7B, 0xEE, 0x67,
-    0x9F, 0x64, 0xB8, 0xED, 0xC2, 0x93, 0x36, 0x7E, 0x43, 0x28, 0xD7, 0xBA, 0xB2, 0x0F, 0x58, 0x53,
-    0x7B, 0x3A, 0x6E, 0xD4, 0xF4, 0xAC, 0xD5, 0x87, 0xA3, 0x31, 0xF2, 0xB7, 0xFA, 0xE0, 0x71, 0x4D,
-    0x4E, 0x66, 0x18, 0x26, 0x3F, 0xC0, 0xC8, 0xE1, 0x83, 0xE9, 0x41, 0xAB, 0x90, 0x27, 0x46, 0x5A,
-    0xAD, 0x5F, 0x61, 0x08, 0xD6, 0x92, 0x71, 0x09, 0xFA, 0x01, 0x03, 0x79, 0xE9, 0x19, 0xFF, 0x25,
-    0x21, 0xD6, 0x12, 0x9D, 0xEF, 0x0B, 0x80, 0x07, 0x2F, 0xD2, 0x4F, 0x54, 0x06, 0xC6, 0x13, 0x8A,
-    0x30, 0x98, 0xD5, 0x3E, 0xBB, 0x0B, 0xE7, 0x42, 0x8A, 0x33, 0x94, 0x6E, 0x15, 0x21, 0xCC, 0x0D,
-    0xC5, 0x3A, 0x2F, 0xC6, 0xC3, 0xAE, 0x9E, 0xF5, 0x06, 0xB9, 0x9D, 0x4A, 0x8B, 0x91, 0xE5, 0xDC,
-    0x66, 0xBE, 0xDE, 0x7F, 0xD2, 0x69, 0x19, 0x27, 0xAD, 0x80, 0xCC, 0x32, 0x3A, 0xE8, 0xC9, 0xAB,
-    0x20, 0xCD, 0x32, 0x47, 0x25, 0x6E, 0x46, 0x7A, 0x15, 0x22, 0x03, 0x36, 0xD0, 0x12, 0x65, 0xB5,
-    0x94, 0x08, 0x03, 0x83, 0x0B, 0x0A, 0x42, 0xF7, 0x11, 0x86, 0xBC, 0x43, 0x43, 0x45, 0xD0, 0x3B,
-    0x52, 0x51, 0x34, 0x26, 0x10, 0xAE, 0x03, 0xB1, 0x18, 0xEF, 0x61, 0x80, 0x10, 0x7A, 0xBE, 0x66,
-    0x70, 0x5E, 0x0A, 0xCD, 0x55, 0x1D, 0xD3, 0x15, 0x42, 0xC3, 0x0A, 0xB8, 0xB5, 0x44, 0x5B, 0x85,
-    0xE3, 0xFB, 0xD7, 0xF4, 0x4D, 0x2D, 0xD4, 0xAF, 0x8D, 0x18, 0x7D, 0x77, 0x07, 0x39, 0xC4, 0xF4,
-    0xA3, 0x8D, 0xAD, 0x00, 0xD1, 0x57, 0x91, 0x50, 0x4D, 0xCF, 0x61, 0x89, 0x9A, 0x73, 0x1A, 0x38,
-    0x16, 0xD9, 0x14, 0x9E, 0xA8, 0x6D, 0x75, 0xE1, 0x12, 0x26, 0xAB, 0xE1, 0x58, 0x37, 0x2C, 0xF7,
-    0xD0, 0x3C, 0x2F, 0xAB, 0x6C, 0x5D, 0xB4, 0x55, 0x5B, 0xB4, 0x59, 0x97, 0x0E, 0xD9, 0x90, 0x48,
-    0x8B, 0xEE, 0x87, 0xC7, 0x59, 0xE6, 0x62, 0x25, 0x97, 0xBA, 0xA6, 0x2D, 0x78, 0x01, 0xA9, 0x6E,
-    0x68, 0xF6, 0x23, 0xF2, 0x0D, 0xB9, 0x1B, 0x30, 0x6B, 0x3C, 0x55, 0x62, 0xFA, 0xAD, 0x1B, 0x2A,
-    0xC6, 0x8F, 0xFB, 0xCD, 0x5F, 0x2E, 0xD5, 0x1B, 0x9A, 0x29, 0x17, 0xF8, 0xDC, 0xF7, 0xF7, 0xBE,
-    0xFF, 0x89, 0x28, 0xB8, 0xA2, 0xE6, 0xC0, 0x30, 0xFB, 0x6B, 0xEF, 0x84, 0x21, 0xBC, 0x78, 0x53,
-    0x15, 0x77, 0x46, 0xDB, 0x69, 0x7C, 0x56, 0x77, 0x36, 0xC4, 0xEE, 0xC3, 0xCB, 0x34, 0xF8, 0xE3,
-    0xDE, 0x24, 0x12, 0xE4, 0xD1, 0x37, 0x2B, 0x38, 0xD5, 0x30, 0xF5, 0xA3, 0x3D, 0x68, 0x6F, 0x2E,
-    0x14, 0xF4, 0xF1, 0xAD, 0x10, 0xA3, 0xD5, 0x23, 0xD0, 0xEC, 0x2C, 0x94, 0x68, 0xD2, 0x95, 0x98,
-    0x4C, 0x3B, 0xE0, 0x83, 0x19, 0x8C, 0x0A, 0x3C, 0x98, 0xBD, 0x68, 0xC9, 0xFB, 0x4F, 0xBA, 0x0F,
-    0x3F, 0xDB, 0x62, 0xD8, 0x66, 0x5B, 0x0C, 0xB3, 0x7A, 0xA0, 0xCA, 0x0D, 0x67, 0x5C, 0xF5, 0x99,
-    0x6A, 0x1B, 0xAA, 0x92, 0xCD, 0x25, 0xBF, 0xD5, 0xAD, 0xF1, 0x7B, 0xAD, 0x63, 0xFB, 0x73, 0xE6,
-    0x60, 0xF6, 0x0B, 0xF2, 0x73, 0xEE, 0x90, 0x90, 0x77, 0xA4, 0x54, 0x56, 0xD6, 0x40, 0x7A, 0x46,
-    0xA8, 0x70, 0x93, 0x4F, 0x0B, 0x0D, 0xA7, 0xA3, 0x31, 0x53, 0xF5, 0x8C, 0xEB, 0xF3, 0x5A, 0xD9,
-    0x46, 0x8D, 0x18, 0xCB, 0xCA, 0x30, 0x7E, 0xA5, 0xE4, 0x6E, 0xCB, 0x20, 0x08, 0x00, 0xE5, 0xF9,
-    0xCB, 0x73, 0x2E, 0x2D, 0x66, 0xE7, 0x36, 0x03, 0xEA, 0xC8, 0xD5, 0x8A, 0xE0, 0xE2, 0xD6, 0x5C,
-    0x92, 0x75, 0xC8, 0x25, 0x69, 0xDF, 0x49, 0x2E, 0x49, 0x79, 0x36, 0x97, 0x24, 0x0F, 0xB9, 0x24,
-    0xFD, 0x9C, 0x4B, 0x92, 0x4D, 0x93, 0xA2, 0x7F, 0xBB, 0xB9, 0x24, 0xDA, 0x91, 0xDD, 0x5C, 0x92,
-    0x71, 0x37, 0xB8, 0x63, 0x7D, 0xE3, 0x85, 0x84, 0x7C, 0x97, 0x11, 0x59, 0xF4, 0x1B, 0xCA, 0xB7,
-    0x8F, 0x91, 0x84, 0xFD, 0x81, 0x0E, 0x76, 0xA7, 0x83, 0xFD, 0xC6, 0x4D, 0x83, 0xBD, 0x78, 0xDA,
-    0x4F, 0xFF, 0x53, 0x09, 0x55, 0xF3, 0x6F, 0x34, 0x39, 0xF9, 0x43, 0x1D, 0xEC, 0x34, 0x0C, 0xB6,
-    0xBB, 0x21, 0x71, 0x07, 0x8D, 0x14, 0xAA, 0x66, 0xE2, 0x4E, 0xB6, 0x93, 0xB8, 0xF3, 0x32, 0x13,
-    0x77, 0xC6, 0x71, 0x4B, 0x22, 0xC5, 0x76, 0xB0, 0x75, 0x03, 0x09, 0x34, 0xBD, 0x9F, 0xA3, 0xBF,
-    0xDE, 0xF5, 0x60, 0x5B, 0xB5, 0xA0, 0x48, 0x63, 0x33, 0x10, 0x60, 0x89, 0xA8, 0x5F, 0x59, 0x85,
-    0x27, 0xF0, 0x47, 0x86, 0x72, 0x41, 0x50, 0x55, 0x1A, 0x02, 0x1E, 0x4C, 0x2D, 0x16, 0x41, 0xB5,
-    0x54, 0x23, 0x4A, 0xEB, 0x05, 0x25, 0xFE, 0x1F, 0xCD, 0xBF, 0xAD, 0xEB, 0xDC, 0x87, 0x52, 0xC6,
-    0xED, 0xAE, 0x27, 0x3E, 0x36, 0x8B, 0x62, 0xAE, 0x2A, 0xC4, 0xB6, 0x26, 0xA3, 0x71, 0xF4, 0xC7,
-    0x78, 0x77, 0xA5, 0x26, 0xBB, 0x95, 0x0C, 0xA2, 0x8A, 0xD0, 0x12, 0x44, 0x4C, 0xAD, 0x82, 0x7B,
-    0x43, 0xDC, 0x03, 0x91, 0xF3, 0xCF, 0x6A, 0xD0, 0x3C, 0x34, 0xA5, 0xC8, 0x30, 0x81, 0x59, 0x47,
-    0x08, 0x3A, 0x43, 0x30, 0x52, 0x4C, 0x63, 0x08, 0x25, 0x44, 0x9A, 0xB3, 0x26, 0xCB, 0xE7, 0x6F,
-    0x4F, 0xBA, 0x4E, 0xCD, 0x74, 0x9D, 0x81, 0xE9, 0x3A, 0x9A, 0xE2, 0x31, 0x6E, 0x0D, 0xAB, 0x64,
-    0xE7, 0xA8, 0xE6, 0x89, 0x62, 0x68, 0x6A, 0x9D, 0x44, 0x2D, 0x4B, 0x9A, 0xDC, 0x6D, 0x9B, 0xD5,
-    0x5C, 0xF1, 0x34, 0x7D, 0x19, 0xFB, 0x99, 0xDA, 0x6E, 0x38, 0xB5, 0x48, 0xEA, 0xC7, 0x06, 0x96,
-    0xD3, 0xAF, 0xFA, 0x82, 0x21, 0xBE, 0xF2, 0x01, 0x0A, 0xEE, 0x27, 0x22, 0x5C, 0x73, 0x78, 0x6C,
-    0xEF, 0x8A, 0xFD, 0x23, 0x07, 0x5A, 0x94, 0xA1, 0x57, 0x82, 0x8E, 0x15, 0x54, 0xBE, 0x4D, 0x1F,
-    0x44, 0x0D, 0x72, 0x30, 0xA7, 0x83, 0x90, 0x4E, 0xB2, 0xB2, 0xF2, 0xBD, 0x63, 0xD8, 0xD3, 0x60,
-    0x7D, 0xD6, 0xE4, 0x0C, 0x25, 0xB7, 0x67, 0xDB, 0xD3, 0x05, 0x2D, 0x37, 0x18, 0x9D, 0x56, 0x8A,
-    0x7F, 0x6B, 0x75, 0xBA, 0x0B, 0x94, 0x20, 0xF7, 0xEB, 0x2E, 0x3A, 0xCF, 0x33, 0x3E, 0x11, 0x21,
-    0x6D, 0xCF, 0x0F, 0x45, 0x27, 0x02, 0xBB, 0x9C, 0xD2, 0xB1, 0x80, 0x06, 0xF7, 0x98, 0xBF, 0x7F,
-    0x55, 0xB5, 0xC9, 0xDA, 0xFF, 0x12, 0x3E, 0xF9, 0x83, 0xA2, 0xBB, 0x93, 0x49, 0xF1, 0xCC, 0x1F,
-    0xE1, 0x2A, 0x82, 0x6E, 0x09, 0xE5, 0x7C, 0xE0, 0x3A, 0x7A, 0xFB, 0x8B, 0xD3, 0xE1, 0xD7, 0x43,
-    0xD9, 0x2E, 0x6E, 0x9C, 0xE0, 0x6D, 0xA3, 0x84, 0x20, 0x08, 0xA3, 0xA0, 0x9B, 0x6E, 0x76, 0xE3,
-    0x15, 0x02, 0x0C, 0x6F, 0x04, 0x99, 0x59, 0x05, 0xA8, 0x8D, 0x55, 0x7E, 0x5A, 0xAA, 0xE3, 0x0E,
-    0xD5, 0x9F, 0x9E, 0x51, 0x7E, 0xD8, 0xB1, 0xD6, 0xAB, 0x95, 0x7E, 0xB2, 0x9A, 0x4F, 0xA1, 0xD8,
-    0xD3, 0x4D, 0x6F, 0x4B, 0x7D, 0xDB, 0xF1, 0x6D, 0xA2, 0xA1, 0x18, 0xA1, 0xF8, 0xD3, 0x12, 0x41,
-    0x06, 0x21, 0x38, 0xAB, 0x56, 0xB9, 0xDB, 0x6F, 0xAB, 0x3F, 0x89, 0x4A, 0x69, 0x95, 0x9D, 0xAC,
-    0xDE, 0x93, 0x7B, 0xEB, 0xB7, 0xCD, 0x54, 0x1A, 0x5F, 0xB4, 0xC2, 0x4F, 0x83, 0xB9, 0x87, 0x6E,
-    0x58, 0x96, 0x7A, 0x77, 0xD6, 0xBD, 0xE5, 0xB2, 0x34, 0xD4, 0xFE, 0xDF, 0x3B, 0x4D, 0x12, 0xCB,
-    0xFD, 0x94, 0x11, 0x47, 0xA0, 0x55, 0x80, 0xBA, 0x2A, 0x6E, 0x69, 0x75, 0x38, 0x18, 0xC3, 0x26,
-    0xD6, 0x04, 0x6B, 0x6E, 0x38, 0xC6, 0x87, 0xAD, 0xB4, 0xF2, 0xC6, 0x83, 0x56, 0x56, 0xA7, 0x0B,
-    0x00, 0x6C, 0xC8, 0x13, 0x8B, 0x2C, 0xAC, 0xA2, 0xDB, 0x8D, 0x99, 0xAD, 0xB5, 0xBC, 0x5B, 0x6D,
-    0x21, 0x08, 0x56, 0xE1, 0x6E, 0x2E, 0x2E, 0x67, 0xA5, 0xCE, 0x36, 0x5B, 0xD2, 0xB3, 0x00, 0x13,
-    0xDD, 0x00, 0x21, 0xA9, 0x3F, 0x88, 0x4A, 0x5D, 0x7B, 0xF7, 0xF0, 0xE2, 0xBD, 0xAD, 0x56, 0xEA,
-    0xFA, 0x89, 0x56, 0xEA, 0xCA, 0x93, 0xB0, 0x91, 0xC6, 0xAD, 0x2B, 0x75, 0x5D, 0xFC, 0x99, 0x16,
-    0xBA, 0x53, 0x0C, 0xD4, 0xFD, 0x44, 0x01, 0xFA, 0x0B, 0xEF, 0xB2, 0x52, 0x57, 0x85, 0x70, 0x64,
-    0x35, 0xC2, 0x10, 0x85, 0x42, 0xC0, 0x6B, 0x45, 0x7F, 0x62, 0x7D, 0xD3, 0xF1, 0xCA, 0x95, 0x70,
-    0x8C, 0xFC, 0x1B, 0xBF, 0x66, 0x84, 0x4B, 0xD8, 0xFD, 0x0A, 0x9A, 0xD5, 0x9B, 0x0C, 0x9F, 0xBE,
-    0xB2, 0x3D, 0x2E, 0x1E, 0xE3, 0xCF, 0xA8, 0x44, 0x3D, 0xB2, 0x52, 0x82, 0xA3, 0xC6, 0xB8, 0x69,
-    0xA1, 0xA3, 0x10, 0x03, 0x61, 0x20, 0x63, 0xE5, 0x8D, 0xA0, 0xDA, 0x5D, 0x8B, 0xF7, 0xAD, 0x4F,
-    0x47, 0x27, 0x86, 0xA2, 0xAC, 0xCF, 0xD4, 0x7C, 0x82, 0x35, 0x3F, 0xDE, 0xA3, 0xB6, 0x1C, 0xD1,
-    0x74, 0x46, 0x68, 0x94, 0x3B, 0xA7, 0xE4, 0xAD, 0x4F, 0x0B, 0x3A, 0xA3, 0xA1, 0xAA, 0xAF, 0x34,
-    0xFA, 0xF3, 0x99, 0xF9, 0x34, 0xDD, 0x32, 0x66, 0xFB, 0xAF, 0x77, 0x62, 0xB6, 0xCD, 0x63, 0x12,
-    0x5B, 0x52, 0xEC, 0x7A, 0xCE, 0x3C, 0x11, 0xFA, 0xCB, 0x18, 0x09, 0x78, 0xE4, 0xB5, 0xFA, 0x8F,
-    0x16, 0xAA, 0x65, 0xB2, 0xFD, 0xBA, 0x9A, 0x34, 0x44, 0xF0, 0x5D, 0x85, 0x66, 0xBF, 0xCB, 0x98,
-    0xED, 0x6D, 0xC1, 0xAD, 0xD1, 0x6D, 0xF5, 0x9A, 0x9D, 0x08, 0x44, 0xBE, 0xCF, 0xB1, 0xEC, 0x4A,
-    0xA7, 0xD5, 0x80, 0x22, 0x1A, 0x6C, 0xF9, 0x20, 0x26, 0x1B, 0x14, 0xA7, 0xCE, 0x6B, 0xE1, 0xD6,
-    0x97, 0x07, 0xC5, 0x75, 0x1E, 0xEF, 0x59, 0xA2, 0x17, 0x71, 0x1F, 0xA7, 0xC7, 0xC7, 0xAC, 0x6C,
-    0x86, 0xBF, 0x97, 0xEC, 0x5C, 0x36, 0x73, 0xB1, 0xD8, 0xCD, 0x99, 0x3D, 0x43, 0x72, 0x83, 0x2D,
-    0x2A, 0xB3, 0xE5, 0x7D, 0xD8, 0xB1, 0x2C, 0xF0, 0x99, 0x9E, 0x91, 0x5C, 0xA9, 0xD0, 0xC5, 0xE7,
-    0x7E, 0x62, 0x4E, 0x66, 0x33, 0x34, 0x4C, 0x15, 0x33, 0x6F, 0xA2, 0x45, 0x7F, 0x7E, 0x5D, 0xB3,
-    0xCD, 0xA2, 0x83, 0x2D, 0x00, 0xA2, 0xDA, 0x1A, 0x56, 0x52, 0x54, 0xFA, 0xEB, 0xD5, 0x10, 0xAF,
-    0x2B, 0xB1, 0xD9, 0x1F, 0x43, 0x64, 0x74, 0xD3, 0x8E, 0x19, 0x32, 0x5C, 0xAB, 0x17, 0x31, 0x84,
-    0xEA, 0xC1, 0x7E, 0x66, 0x27, 0x10, 0xB7, 0x37, 0x73, 0x62, 0x8B, 0x18, 0xCD, 0xF1, 0x03, 0xE8,
-    0xC8, 0x9E, 0x66, 0x12, 0xEA, 0x42, 0x5D, 0x07, 0xA7, 0x44, 0x62, 0x65, 0xF5, 0x7F, 0x7C, 0x36,
-    0xC6, 0xEF, 0x53, 0x37, 0xD4, 0xE1, 0x39, 0x96, 0x04, 0x1A, 0x19, 0x57, 0x8F, 0x87, 0xB3, 0x75,
-    0xDB, 0x42, 0x06, 0xA8, 0xED, 0x82, 0xE1, 0x9E, 0xBC, 0x4D, 0x13, 0x14, 0xDF, 0x3C, 0x41, 0xD1,
-    0x99, 0x09, 0xD2, 0x6F, 0xDA, 0x26, 0x36, 0x9A, 0x9F, 0xA3, 0x6D, 0x36, 0xE9, 0x6C, 0x5E, 0xCF,
-    0x32, 0xA4, 0x68, 0xDC, 0x86, 0x7D, 0xC8, 0x76, 0xF2, 0x09, 0x42, 0xBA, 0x81, 0x08, 0x9E, 0x39,
-    0xCF, 0xAE, 0x59, 0xE5, 0x36, 0xA8, 0xF1, 0xF4, 0x50, 0x88, 0x6F, 0x28, 0x82, 0xB0, 0xDD, 0x96,
-    0x57, 0xB7, 0x34, 0xAD, 0x5B, 0xFD, 0xFD, 0x21, 0x7A, 0xE4, 0x9D, 0xED, 0x26, 0x50, 0xDA, 0xAE,
-    0x91, 0x45, 0xA9, 0x7B, 0x46, 0xC4, 0x7D, 0x64, 0x80, 0xC6, 0x4A, 0x75, 0x82, 0xE5, 0x94, 0x84,
-    0x4A, 0x81, 0xA1, 0x62, 0x6C, 0x98, 0x81, 0xB3, 0x01, 0xA5, 0x7B, 0x76, 0x8C, 0x91, 0xE7, 0xBB,
-    0x41, 0x86, 0x46, 0x0B, 0xA9, 0x81, 0xAE, 0xAC, 0x18, 0x4B, 0x0D, 0xBB, 0xA2, 0xD9, 0x88, 0xE5,
-    0xF4, 0x99, 0xA3, 0x36, 0xA6, 0x5F, 0xDC, 0x35, 0x75, 0xB5, 0xC9, 0x59, 0x37, 0x3D, 0x9E, 0x34,
-    0x23, 0x74, 0x53, 0x6D, 0x98, 0xFB, 0xD0, 0xFC, 0x88, 0x2E, 0xF2, 0x39, 0xED, 0x6A, 0x11, 0x06,
-    0xB4, 0xBA, 0xDE, 0xFC, 0x46, 0x43, 0xDD, 0xE3, 0x29, 0x61, 0x30, 0xBB, 0xAC, 0xA4, 0x82, 0xDA,
-    0x78, 0x3C, 0x69, 0x09, 0xD3, 0xB2, 0xDA, 0x70, 0xAB, 0x09, 0xFC, 0x4A, 0x33, 0xD0, 0x77, 0x2E,
-    0xCA, 0x8A, 0x68, 0xAE, 0xC2, 0x36, 0x36, 0x08, 0x6D, 0xD8, 0x24, 0x74, 0xD7, 0x58, 0xAD, 0xAF,
-    0xBF, 0xD0, 0xB8, 0x85, 0xEA, 0x7E, 0x8D, 0x09, 0x55, 0x57, 0xEE, 0xAF, 0x49, 0x32, 0x53, 0x44,
-    0xD7, 0xC2, 0x9A, 0x11, 0x92, 0xFF, 0x8B, 0x33, 0x51, 0x3A, 0xA3, 0x01, 0x75, 0xE0, 0x62, 0xF2,
-    0xD4, 0x39, 0x4B, 0x2F, 0xF9, 0xD1, 0xA4, 0x81, 0xA6, 0x41, 0xB1, 0x71, 0x56, 0xE3, 0x46, 0x1A,
-    0x75, 0xA4, 0x82, 0x8B, 0x39, 0x6C, 0x56, 0x58, 0x2E, 0x44, 0x7C, 0x55, 0x01, 0x62, 0xB7, 0x5D,
-    0x27, 0xF5, 0x0D, 0x5D, 0xE1, 0x50, 0xB6, 0x56, 0x4B, 0x56, 0x35, 0x17, 0x65, 0x50, 0xBD, 0xCD,
-    0xE5, 0x96, 0x0D, 0x04, 0x25, 0x6F, 0x35, 0x03, 0x14, 0xDF, 0x20, 0x0F, 0xCE, 0x82, 0x0A, 0x44,
-    0x4D, 0x23, 0x54, 0xC8, 0xBB, 0x03, 0x21, 0xBF, 0xA9, 0x3C, 0x45, 0xAC, 0xC0, 0x67, 0x99, 0x85,
-    0xA4, 0x51, 0x0A, 0xC8, 0x36, 0xF8, 0x6F, 0x08, 0xE7, 0x5A, 0x69, 0x12, 0x92, 0x06, 0x29, 0x14,
-    0x93, 0x6D, 0xC9, 0xA6, 0x3E, 0x2B, 0x69, 0xC5, 0x0B, 0xA0, 0xA7, 0x5E, 0x73, 0x97, 0x63, 0x85,
-    0xBF, 0x87, 0x19, 0xF8, 0xCE, 0xC6, 0x1C, 0x84, 0x07, 0xF7, 0x54, 0xA6, 0x11, 0x0A, 0xAB, 0x6D,
-    0x12, 0x68, 0x1D, 0x6C, 0xF6, 0xC4, 0xCF, 0x7A, 0x02, 0xF0, 0xC3, 0xA5, 0xA1, 0x0C, 0x48, 0x77,
-    0x9D, 0x4A, 0xF7, 0x89, 0xAC, 0xC4, 0x7F, 0x51, 0x2B, 0xF1, 0xBF, 0xAC, 0x0A, 0x4E, 0xC7, 0x4A,
-    0xFC, 0x86, 0x6C, 0x19, 0x7A, 0x1F, 0xFB, 0x33, 0x01, 0xDD, 0xC1, 0x5C, 0x5A, 0x9D, 0xD9, 0x57,
-    0xE9, 0xD2, 0xED, 0xAC, 0x8A, 0x34, 0xB1, 0x2A, 0x92, 0x67, 0x55, 0xA4, 0x09, 0xC9, 0x84, 0x6A,
-    0x86, 0x2A, 0x47, 0x53, 0xD7, 0x78, 0xB6, 0xD9, 0x46, 0x92, 0x28, 0x86, 0x99, 0xB9, 0x4F, 0x68,
-    0xAD, 0xFD, 0x54, 0xCB, 0x24, 0xBA, 0x82, 0xAD, 0x45, 0x59, 0xC3, 0x44, 0xD3, 0x06, 0xCB, 0xDD,
-    0x52, 0xA8, 0x41, 0xDB, 0x9E, 0xED, 0x3E, 0x0E, 0xC9, 0xDE, 0x91, 0x21, 0x4E, 0xC1, 0xE5, 0x6A,
-    0x57, 0x1F, 0xBE, 0x14, 0xD2, 0x2F, 0x91, 0xDE, 0x1D, 0xD3, 0x32, 0xAA, 0xB5, 0x7A, 0xD3, 0x5B,
-    0x6B, 0xB0, 0x73, 0xE1, 0xC5, 0x1B, 0xAB, 0x37, 0xBD, 0xA5, 0xCE, 0x4B, 0x8E, 0x05, 0x87, 0xE6,
-    0x0A, 0xDE, 0x35, 0xFA, 0x62, 0xB6, 0x0A, 0x77, 0xD3, 0x6E, 0x0D, 0xD1, 0xD4, 0x6A, 0x6A, 0x9B,
-    0xDF, 0x67, 0x0B, 0xEA, 0x28, 0x02, 0x7C, 0xE2, 0x9C, 0xFB, 0xC4, 0xEF, 0x98, 0x70, 0x6A, 0x2D,
-    0x7F, 0xD3, 0x5A, 0x5E, 0x9F, 0xF1, 0xA1, 0xCD, 0x1E, 0x32, 0x77, 0xC6, 0x20, 0xD7, 0x94, 0xF3,
-    0x19, 0x96, 0x08, 0xAA, 0xC7, 0x05, 0xE7, 0x3E, 0x0A, 0x67, 0xBE, 0x95, 0x63, 0x53, 0xEF, 0x74,
-    0xBF, 0x83, 0x6F, 0xEA, 0xC6, 0x4E, 0x1A, 0xCC, 0x65, 0x1A, 0x9B, 0x61, 0x79, 0xAA, 0x5C, 0xC6,
-    0x2B, 0xF7, 0x49, 0xAD, 0x9D, 0xBD, 0xDC, 0x86, 0x37, 0xB5, 0x3B, 0xBB, 0x26, 0x4F, 0x67, 0x54,
-    0x6B, 0x4B, 0x22, 0x37, 0xCD, 0x3A, 0xCC, 0xD6, 0x77, 0xE6, 0x30, 0x55, 0xF7, 0x51, 0x55, 0xD7,
-    0x09, 0x14, 0xA5, 0xD5, 0xF8, 0x75, 0x82, 0x34, 0x5D, 0x45, 0xE3, 0x4B, 0x0D, 0x36, 0xF9, 0xDF,
-    0x9F, 0xFE, 0x4D, 0x58, 0xA6, 0xB0, 0x09, 0x8B, 0x0F, 0x9B, 0xB0, 0x04, 0x3D, 0x3D, 0x9F, 0x43,
-    0x6F, 0x83, 0x7F, 0xBE, 0x68, 0x6F, 0x2C, 0x76, 0xDD, 0xAC, 0x6E, 0xAC, 0x6F, 0x3D, 0x07, 0x2C,
-    0xFF, 0x65, 0x28, 0xCD, 0x97, 0x29, 0x03, 0x59, 0x92, 0x59, 0x43, 0x45, 0x41, 0x1C, 0x85, 0xB3,
-    0xDA, 0x7C, 0x60, 0x65, 0x39, 0x35, 0xA9, 0x36, 0x95, 0x51, 0x4A, 0x7F, 0x3F, 0x26, 0x48, 0x47,
-    0xD2, 0xE2, 0x7C, 0xCE, 0x67, 0xAF, 0x0F, 0xC8, 0x3B, 0xBA, 0x32, 0xC1, 0xAA, 0x4A, 0x65, 0x85,
-    0x20, 0x94, 0x4F, 0xAB, 0xF3, 0x39, 0x51, 0xD6, 0x56, 0xB8, 0x28, 0xBA, 0x2D, 0x2F, 0x26, 0x0C,
-    0x19, 0xD4, 0xF2, 0x7C, 0xB1, 0xD2, 0xFC, 0x77, 0x75, 0x3D, 0xBF, 0xAE, 0x3F, 0x7D, 0x86, 0x44,
-    0x97, 0xE7, 0xCA, 0x6F, 0xD5, 0x9B, 0x67, 0xC0, 0x9D, 0x25, 0x1A, 0xAE, 0xE8, 0x9A, 0x2C, 0xDF,
-    0xA7, 0xF1, 0x74, 0xD3, 0xE9, 0x0B, 0xBB, 0x65, 0x11, 0x42, 0x78, 0xC4, 0x8A, 0x38, 0xBA, 0x90,
-    0x22, 0x1B, 0x64, 0xDB, 0x52, 0x21, 0xFA, 0xAB, 0x56, 0xD7, 0xA5, 0x4A, 0x73, 0xB3, 0x80, 0xCF,
-    0x4B, 0xAB, 0x9B, 0x33, 0x7A, 0x83, 0xA2, 0x12, 0x76, 0x2A, 0xCE, 0x42, 0xDA, 0xE1, 0xB0, 0x6B,
-    0x7A, 0x25, 0xC1, 0xFF, 0xA9, 0x5B, 0x47, 0xE4, 0xBF, 0xD5, 0x0C, 0xC6, 0xC1, 0xEC, 0x99, 0x67,
-    0xD4, 0x98, 0xE9, 0x32, 0x1F, 0xEC, 0x24, 0x56, 0xF3, 0x60, 0x00, 0x03, 0x54, 0x36, 0x86, 0xC7,
-    0xAD, 0x96, 0x21, 0x5D, 0xD5, 0x1C, 0xAB, 0xEA, 0x3E, 0xE6, 0x8A, 0x5C, 0x7A, 0x58, 0xFC, 0x24,
-    0x14, 0x28, 0xB6, 0xB6, 0xAD, 0x46, 0xC4, 0x7D, 0x1B, 0x99, 0x50, 0x06, 0x49, 0x50, 0x68, 0xB5,
-    0x8E, 0x9F, 0x53, 0x21, 0x86, 0x3F, 0x75, 0x98, 0x63, 0xF8, 0xB8, 0x81, 0x5D, 0x8D, 0xFD, 0xE6,
-    0x64, 0xCC, 0x3A, 0xEE, 0xB1, 0xF7, 0xD5, 0xC9, 0xEA, 0xBC, 0x69, 0x60, 0xC4, 0xFE, 0xF7, 0xCF,
-    0x38, 0xBE, 0x23, 0xE3, 0x06, 0xBD, 0xA6, 0x91, 0xA1, 0xB4, 0x6F, 0xBB, 0x60, 0xE4, 0x6D, 0x85,
-    0x7A, 0xC1, 0x49, 0xBB, 0x0D, 0xF7, 0x8E, 0xD0, 0x7C, 0xC4, 0xB3, 0x2C, 0x42, 0xD5, 0x04, 0x18,
-    0x67, 0x70, 0x92, 0x6F, 0xE6, 0xCA, 0xC2, 0xA3, 0xDC, 0x19, 0xFB, 0x7F, 0xF6, 0xD3, 0x01, 0x21,
-    0xBA, 0x1C, 0x0E, 0x91, 0x05, 0xDC, 0x2F, 0x6E, 0xFF, 0x92, 0xFB, 0xD6, 0xCE, 0x98, 0xB7, 0xC4,
-    0x5B, 0x17, 0xAC, 0x9F, 0x03, 0x76, 0x98, 0x2B, 0xB0, 0xFC, 0x8C, 0x86, 0x04, 0x58, 0xA4, 0xE2,
-    0x5D, 0xEE, 0x8E, 0x4F, 0xF3, 0x86, 0x9B, 0xD1, 0x18, 0x8D, 0x56, 0x42, 0xA8, 0x6A, 0x51, 0x7B,
-    0x7F, 0x90, 0x85, 0xB9, 0x1C, 0x97, 0xE7, 0x64, 0x90, 0x7E, 0x34, 0xA5, 0xA0, 0x69, 0x90, 0x3C,
-    0x30, 0xC7, 0x66, 0xD5, 0xD6, 0x79, 0xAD, 0x01, 0xE2, 0xB7, 0x78, 0xD1, 0xB5, 0xA7, 0x29, 0xE2,
-    0x46, 0x90, 0x28, 0x41, 0x2F, 0xDD, 0x21, 0x54, 0x46, 0xE3, 0x6B, 0x5E, 0x37, 0x4D, 0x6D, 0xAE,
-    0x18, 0x7D, 0x56, 0xEB, 0xE0, 0x3D, 0x34, 0x0C, 0x40, 0x07, 0xFD, 0x90, 0x0A, 0xF8, 0x52, 0x61,
-    0xB6, 0x64, 0xD0, 0x1C, 0x40, 0x88, 0x1B, 0x75, 0x39, 0x2C, 0xD0, 0x87, 0xE3, 0x63, 0x17, 0xC0,
-    0xD4, 0x9D, 0xE4, 0x0A, 0xB6, 0x4D, 0xDD, 0x75, 0xD7, 0x0F, 0x2F, 0x4A, 0x3B, 0xFE, 0xC1, 0x31,
-    0xA2, 0x79, 0x85, 0x4C, 0x2C, 0x0D, 0x8A, 0x94, 0x05, 0xA8, 0x3B, 0x64, 0xA7, 0x3D, 0x16, 0x39,
-    0x03, 0xFE, 0x32, 0x2B, 0x1D, 0xCD, 0x92, 0x8C, 0x85, 0x39, 0xDF, 0x36, 0x99, 0x3D, 0xF5, 0x6E,
-    0x96, 0xA7, 0x61, 0xA1, 0x04, 0x02, 0xB8, 0x9C, 0x39, 0xC5, 0xDD, 0xDA, 0xCC, 0x3F, 0xE4, 0xC7,
-    0x8B, 0xFE, 0x5E, 0x14, 0x9B, 0x00, 0xE1, 0x62, 0x18, 0xE5, 0xFF, 0x06, 0x02, 0x20, 0x63, 0x5B,
-    0x1F, 0x41, 0xF0, 0x5A, 0xA4, 0xED, 0xD2, 0x01, 0x63, 0xB4, 0xE1, 0xE9, 0x0F, 0xA4, 0x13, 0x6F,
-    0x2A, 0x2A, 0xB8, 0x56, 0x7F, 0x6B, 0x1F, 0x69, 0xC9, 0x1C, 0xAD, 0xD5, 0x53, 0xB1, 0x7A, 0x44,
-    0xF4, 0x55, 0xFF, 0xCF, 0xF4, 0xDA, 0x98, 0x17, 0xED, 0x11, 0xDD, 0x00, 0xB3, 0x8D, 0x59, 0x96,
-    0xB5, 0xE7, 0x02, 0xDE, 0xA2, 0x0F, 0x23, 0xEC, 0x93, 0xB8, 0x87, 0x40, 0xC9, 0x98, 0x48, 0x50,
-    0x5C, 0xD7, 0xD4, 0x8C, 0x39, 0xAD, 0xC8, 0xA0, 0xB8, 0xDD, 0x44, 0x62, 0x99, 0x54, 0x45, 0xD7,
-    0xD8, 0xA5, 0xD7, 0xBC, 0x6D, 0xA6, 0x2A, 0xAA, 0x38, 0xF5, 0x4F, 0xDD, 0x00, 0x40, 0xF7, 0x03,
-    0x60, 0xCB, 0xBE, 0x75, 0x43, 0x25, 0xFE, 0xBB, 0x0F, 0xC2, 0xEE, 0x97, 0xC1, 0xCC, 0x1F, 0xA8,
-    0x14, 0x5E, 0x3A, 0xBF, 0x6E, 0x7F, 0xCA, 0x4D, 0xC8, 0x9B, 0xED, 0xB3, 0x73, 0x4D, 0xBE, 0x7A,
-    0x66, 0x5B, 0x0E, 0x55, 0x5B, 0xB2, 0x76, 0x77, 0xCA, 0x8A, 0x8F, 0x91, 0xD2, 0x9B, 0xAF, 0x85,
-    0x41, 0x34, 0xAB, 0x42, 0xCC, 0xCB, 0x47, 0x59, 0xB2, 0x9D, 0x25, 0xB0, 0xCA, 0xDD, 0xAE, 0x3F,
-    0xC0, 0xD5, 0x5D, 0xBB, 0xB0, 0xAD, 0xB7, 0x70, 0x9F, 0x8B, 0xD8, 0xF0, 0x26, 0xF5, 0xC9, 0xA8,
-    0xBB, 0x84, 0x16, 0x1D, 0xE4, 0x1E, 0x77, 0xDC, 0x3A, 0x0A, 0x19, 0x82, 0xAF, 0x6B, 0xCA, 0x6C,
-    0xC0, 0x0F, 0x34, 0xB4, 0x52, 0x46, 0xFD, 0x11, 0xD4, 0x6B, 0x63, 0x3C, 0x13, 0x2B, 0x96, 0x45,
-    0xD4, 0xFF, 0x3E, 0xB7, 0xC5, 0x78, 0xF7, 0xC9, 0x4F, 0x1A, 0xD3, 0x6A, 0x2C, 0xDD, 0x12, 0x65,
-    0xC7, 0x4A, 0x00, 0x3C, 0x48, 0xCF, 0x6B, 0x73, 0x00, 0xBC, 0xFD, 0x1D, 0x33, 0xF4, 0xAA, 0x00,
-    0x6A, 0xB1, 0x4D, 0x47, 0x93, 0xE3, 0xDD, 0xDC, 0x38, 0x59, 0xA7, 0x56, 0x8F, 0xBA, 0xB6, 0x2A,
-    0x04, 0x87, 0x4E, 0xC0, 0x83, 0xB1, 0x93, 0x10, 0xDA, 0xA5, 0x47, 0xE6, 0xDC, 0x77, 0x9A, 0x07,
-    0x97, 0x59, 0xC1, 0xF8, 0xD3, 0x86, 0x45, 0x44, 0xAC, 0xB4, 0x40, 0x17, 0x0A, 0x78, 0x46, 0x34,
-    0xCB, 0xA2, 0x07, 0x9C, 0x8E, 0x14, 0x30, 0x47, 0xC6, 0x22, 0x15, 0x72, 0xFF, 0x0A, 0x0A, 0xD7,
-    0x3D, 0xEA, 0x4B, 0x54, 0x4D, 0xA5, 0x62, 0x60, 0x34, 0xC7, 0xE6, 0x62, 0x48, 0x6E, 0x7C, 0xDD,
-    0xFF, 0xEA, 0xEB, 0x22, 0x56, 0x5C, 0x0C, 0xED, 0xAA, 0xE8, 0xB8, 0xA3, 0x91, 0xEF, 0x90, 0x6F,
-    0xEB, 0xA9, 0xBB, 0x8F, 0x56, 0xFA, 0xF3, 0xC2, 0x96, 0xA2, 0xB2, 0x0D, 0x16, 0x7A, 0xD1, 0xA1,
-    0x9D, 0x15, 0x03, 0xC6, 0x2B, 0xBE, 0x2E, 0xB0, 0x35, 0x82, 0x8B, 0xE6, 0x2D, 0xC5, 0x3F, 0x61,
-    0xC3, 0xB8, 0xE8, 0x17, 0x3D, 0x7A, 0xD5, 0xB1, 0x14, 0xDA, 0x52, 0x34, 0x8F, 0x32, 0xEE, 0xE3,
-    0xFE, 0xA6, 0xA4, 0xFC, 0xDB, 0x3B, 0xD8, 0xF3, 0x96, 0x28, 0xF9, 0x3A, 0x6C, 0xAD, 0x92, 0xF8,
-    0x39, 0x78, 0x34, 0x84, 0x8F, 0xA2, 0x84, 0xFE, 0x5C, 0xAE, 0xB1, 0x08, 0xAA, 0x67, 0x48, 0x72,
-    0xBB, 0x85, 0x06, 0x64, 0x29, 0x1D, 0x5A, 0x02, 0x91, 0x3B, 0x9A, 0x14, 0x8C, 0x94, 0x84, 0x8A,
-    0xBC, 0x44, 0x84, 0x0E, 0xDA, 0x34, 0x52, 0x47, 0xD5, 0x04, 0x8F, 0xC5, 0x2B, 0x5E, 0xE1, 0xD7,
-    0x9F, 0xD0, 0xCC, 0x04, 0x26, 0x5B, 0x3B, 0xD5, 0xA9, 0x55, 0xF1, 0x25, 0x0A, 0xAA, 0xCE, 0x02,
-    0xB2, 0x78, 0xAB, 0x20, 0x5B, 0x5B, 0xD6, 0x87, 0x8B, 0x65, 0xB5, 0x3E, 0x38, 0x06, 0x88, 0x7B,
-    0x8E, 0x2D, 0x99, 0xAB, 0x4F, 0x6E, 0xF7, 0x59, 0xCA, 0xC7, 0x54, 0x5D, 0x24, 0xD0, 0x89, 0x84,
-    0x3E, 0x54, 0x64, 0x77, 0x69, 0xD0, 0xAF, 0x3C, 0xE1, 0x56, 0x26, 0xD8, 0x41, 0xAF, 0x27, 0xA5,
-    0x30, 0x86, 0x77, 0xA1, 0xA9, 0x69, 0x5A, 0xDA, 0x6A, 0xC5, 0x1C, 0x1B, 0x4D, 0x38, 0x5D, 0x90,
-    0x33, 0x5F, 0x5A, 0x32, 0xE4, 0x1F, 0x11, 0xE0, 0x48, 0x13, 0xE1, 0xFE, 0x66, 0x94, 0xD0, 0xCF,
-    0xB2, 0xA6, 0x02, 0xB3, 0x70, 0xF6, 0xAD, 0x6A, 0x58, 0xF4, 0x94, 0x33, 0xAA, 0xD0, 0xD4, 0xA3,
-    0xC6, 0x50, 0x6D, 0x8B, 0x22, 0x6A, 0xDA, 0xC6, 0x5C, 0x0B, 0x3B, 0xD9, 0x86, 0xE7, 0xFD, 0x7D,
-    0x92, 0x0B, 0xDB, 0x2B, 0xA9, 0x24, 0x90, 0xAE, 0x8F, 0x12, 0xB6, 0x20, 0x58, 0x01, 0x95, 0x2D,
-    0x23, 0x1E, 0x7C, 0xA7, 0x28, 0x6C, 0x37, 0x14, 0x41, 0xFB, 0x98, 0x6E, 0xD5, 0xCB, 0x72, 0x87,
-    0x29, 0x4C, 0xC7, 0xA2, 0x47, 0x71, 0x9C, 0x35, 0x2A, 0x91, 0x45, 0xD3, 0x4D, 0xB3, 0x75, 0x9B,
-    0x4A, 0xF9, 0x03, 0xF9, 0xE5, 0x6E, 0x4A, 0xB0, 0x6E, 0x58, 0x62, 0x4E, 0x0E, 0xBF, 0x39, 0xAC,
-    0x86, 0x02, 0x9A, 0x61, 0xB1, 0x42, 0x64, 0x0B, 0x0C, 0xD2, 0xA4, 0x24, 0x54, 0x49, 0x30, 0x19,
-    0x43, 0x6B, 0x05, 0xF7, 0x26, 0xA7, 0x95, 0x44, 0x63, 0xAB, 0x73, 0x3C, 0x04, 0xA6, 0x49, 0x47,
-    0x59, 0xA6, 0x87, 0x7F, 0x0B, 0x81, 0x57, 0x61, 0xB8, 0x90, 0xEE, 0x32, 0xF8, 0xE9, 0x41, 0xDD,
-    0xE6, 0x82, 0xF5, 0x3C, 0x4B, 0xDD, 0x72, 0xEE, 0xC2, 0x53, 0x2C, 0x32, 0xE1, 0xAF, 0xA6, 0x73,
-    0x6A, 0x39, 0x03, 0xE9, 0x32, 0xD4, 0xB7, 0xCA, 0x44, 0xC8, 0xD6, 0x59, 0x2D, 0xC4, 0xF9, 0x59,
-    0x8D, 0xE4, 0xA1, 0xFA, 0xAD, 0x05, 0xD5, 0x38, 0x71, 0xCC, 0x7E, 0x1B, 0x9D, 0x6E, 0x5B, 0xAC,
-    0x3E, 0x38, 0x4D, 0x69, 0x6E, 0x76, 0x4B, 0x8D, 0xCE, 0x07, 0xD6, 0x20, 0xCD, 0x11, 0x6A, 0x5E,
-    0xA0, 0x0A, 0x5D, 0x71, 0x12, 0x73, 0xAF, 0xB8, 0x6D, 0x6D, 0xD1, 0x0D, 0x1A, 0xB4, 0x3B, 0x1B,
-    0xAA, 0xD4, 0xB8, 0xA5, 0x65, 0x80, 0xA4, 0xC6, 0x1E, 0xBE, 0x7C, 0x7C, 0x5C, 0xDF, 0x72, 0xBD,
-    0x7D, 0x0A, 0x37, 0x65, 0x8E, 0x18, 0x58, 0xB1, 0x9C, 0xBD, 0xAA, 0x75, 0xC8, 0xA6, 0xC4, 0x16,
-    0x64, 0x1F, 0xCB, 0xDA, 0x65, 0x21, 0x0C, 0x88, 0xDE, 0xAD, 0xC4, 0xC7, 0xA6, 0x24, 0x1A, 0x23,
-    0x57, 0xD6, 0x29, 0x36, 0x8C, 0x4A, 0x88, 0x03, 0xF3, 0xCA, 0x9D, 0x5D, 0x88, 0x87, 0x87, 0xE6,
-    0x9F, 0xE5, 0x20, 0x84, 0x22, 0x38, 0x5A, 0xF8, 0x06, 0x53, 0xB9, 0x9A, 0xB7, 0x0E, 0x0C, 0x85,
-    0x68, 0x8A, 0xC9, 0xD2, 0x3D, 0x7A, 0xDB, 0xFE, 0x6A, 0xA3, 0xBE, 0x4E, 0xBD, 0x5C, 0xE8, 0xEC,
-    0x2E, 0xBD, 0x4E, 0x7E, 0xF1, 0x1A, 0x2F, 0x23, 0x2C, 0xBE, 0x26, 0x1B, 0xE1, 0xFC, 0xBC, 0xE1,
-    0x6D, 0xFA, 0x5A, 0x2B, 0x82, 0x63, 0xD3, 0xD7, 0x5A, 0x11, 0x1C, 0x9B, 0xBE, 0xF6, 0xCC, 0xF4,
-    0x59, 0x11, 0x1C, 0xCA, 0x9E, 0x86, 0x46, 0x86, 0xAB, 0xB6, 0xD3, 0x17, 0x5A, 0xEE, 0xE2, 0x36,
-    0x66, 0x15, 0xB4, 0x98, 0x7E, 0x3C, 0xDA, 0xBD, 0x2A, 0x44, 0xD2, 0x36, 0xED, 0x6E, 0x2D, 0x3F,
-    0x32, 0x26, 0x0F, 0xFC, 0x9C, 0xB9, 0x15, 0xAF, 0xD1, 0x74, 0xE9, 0xE3, 0xED, 0xDE, 0x07, 0x9C,
-    0xC5, 0x82, 0x73, 0x52, 0x70, 0x4E, 0x28, 0xAF, 0x37, 0x15, 0xA7, 0xB7, 0x7A, 0x0E, 0x17, 0xAA,
-    0x2B, 0x9C, 0xC5, 0x15, 0x0B, 0xAD, 0xB0, 0x6C, 0x81, 0xAC, 0x38, 0x4C, 0x6F, 0x3D, 0xCF, 0xA2,
-    0x3E, 0x6A, 0xC1, 0xDA, 0xB8, 0xFF, 0xA4, 0xBB, 0x25, 0x68, 0xF9, 0x9A, 0xAD, 0xDE, 0x33, 0x31,
-    0xA8, 0x0B, 0x7A, 0x51, 0x8D, 0x4E, 0x3C, 0xA6, 0x6C, 0xE0, 0x31, 0x35, 0x6E, 0x14, 0xCE, 0xBC,
-    0x49, 0x1A, 0x7C, 0x3A, 0x76, 0xF5, 0x75, 0x55, 0x59, 0x95, 0xB0, 0x5E, 0xB1, 0x57, 0x1E, 0xCB,
-    0x68, 0x62, 0x06, 0x9B, 0xB2, 0x39, 0xC7, 0x21, 0x7F, 0xFB, 0x77, 0x98, 0xF8, 0x43, 0x69, 0xB4,
-    0x0F, 0xA2, 0x34, 0xDA, 0x6D, 0xA5, 0xEF, 0x8F, 0xDB, 0xB0, 0xBF, 0x5F, 0xFA, 0xBE, 0x1D, 0x13,
-    0xF4, 0x53, 0x88, 0x12, 0xD5, 0x42, 0x97, 0xDC, 0x06, 0x5E, 0xD5, 0x50, 0x20, 0xAE, 0xE5, 0x79,
-    0x33, 0xF3, 0x09, 0xD9, 0xC9, 0x8F, 0x80, 0x20, 0x07, 0x3C, 0x86, 0x0D, 0xC7, 0x57, 0xE7, 0xE3,
-    0x81, 0xB7, 0xBD, 0xB8, 0xFB, 0x76, 0x3F, 0x8C, 0xF3, 0xB6, 0xC5, 0xB8, 0xA5, 0xEA, 0xF5, 0x89,
-    0xDF, 0x48, 0x7A, 0x8F, 0xF9, 0xAA, 0x4B, 0x43, 0x21, 0x79, 0x8B, 0x62, 0xED, 0x7B, 0x1A, 0xDE,
-    0x7A, 0xD3, 0xDF, 0x27, 0x76, 0xA3, 0x97, 0xB3, 0x8C, 0xEF, 0xD1, 0x1D, 0x8E, 0xF7, 0xF6, 0x8C,
-    0xEF, 0x53, 0x31, 0xD5, 0x62, 0xDA, 0x72, 0x57, 0xEB, 0x74, 0xD4, 0x2E, 0x23, 0x79, 0x67, 0xCD,
-    0x7D, 0xD1, 0x37, 0xD9, 0xE6, 0xD6, 0x1A, 0x59, 0xCA, 0x0A, 0x74, 0xCF, 0x33, 0x62, 0xB1, 0xF7,
-    0xDC, 0x4C, 0x0B, 0x19, 0x32, 0x79, 0x0F, 0xBB, 0x27, 0x65, 0xD9, 0xF0, 0x18, 0xCB, 0x69, 0xB3,
-    0xB0, 0x68, 0xA7, 0xDA, 0xA2, 0xA8, 0x22, 0x64, 0x6B, 0x86, 0x94, 0xA6, 0x58, 0x6B, 0x62, 0x6A,
-    0x5F, 0xF3, 0x13, 0x73, 0x19, 0xD7, 0x73, 0x71, 0x8A, 0xCC, 0x4A, 0xB0, 0xB6, 0xDB, 0xF4, 0x94,
-    0x90, 0x87, 0xE5, 0x42, 0x11, 0xF9, 0x3B, 0x19, 0x87, 0xFF, 0x67, 0xB4, 0x9E, 0x33, 0x6F, 0xA5,
-    0x01, 0xD7, 0x73, 0xAF, 0x95, 0x66, 0xF6, 0x67, 0x6E, 0x72, 0x87, 0xFB, 0x23, 0x2D, 0x8E, 0xFC,
-    0xA7, 0xEA, 0x91, 0x6C, 0x68, 0x55, 0xDC, 0xA3, 0x45, 0xF7, 0xE9, 0x06, 0xCE, 0x7B, 0x62, 0xA4,
-    0xD5, 0x9A, 0xE1, 0x70, 0x93, 0x66, 0xCF, 0xFD, 0x77, 0xF7, 0x9F, 0x3E, 0x95, 0xD3, 0xEF, 0x3E,
-    0xE3, 0x2E, 0x91, 0x0A, 0x0A, 0xE2, 0x38, 0x39, 0xD3, 0x0A, 0xB5, 0x4E, 0xC9, 0x57, 0x29, 0x67,
-    0xAF, 0x70, 0x6A, 0x56, 0xDC, 0x23, 0x71, 0x8D, 0x04, 0x95, 0x68, 0x93, 0xB8, 0x4F, 0x1F, 0x0B,
-    0x70, 0xF9, 0x9A, 0xE4, 0x9E, 0xD3, 0xA1, 0x1E, 0x48, 0x01, 0xB3, 0xB1, 0xA6, 0x4F, 0x8C, 0xB4,
-    0x20, 0xB2, 0xE3, 0x26, 0xEE, 0x87, 0x9C, 0x33, 0xA1, 0x84, 0xFB, 0x14, 0x35, 0x80, 0x57, 0x21,
-    0x31, 0x57, 0x30, 0xE3, 0x7D, 0xC6, 0xD9, 0x42, 0x3B, 0x27, 0x26, 0x63, 0xD8, 0x8D, 0xC9, 0xA0,
-    0x03, 0x6D, 0x22, 0x6E, 0x80, 0x8B, 0x19, 0x9C, 0x67, 0x9B, 0x39, 0xB3, 0xA5, 0x51, 0xE9, 0x9B,
-    0x98, 0x47, 0x4A, 0x4C, 0x40, 0xCE, 0xED, 0x9C, 0xD8, 0xF2, 0x96, 0x31, 0x19, 0xA1, 0xC6, 0x91,
-    0xFF, 0xBF, 0xE6, 0x3A, 0x0A, 0x59, 0x12, 0xBA, 0x90, 0x07, 0x63, 0x02, 0x44, 0x7E, 0xCF, 0x1C,
-    0x73, 0xC6, 0x6A, 0xDE, 0xE2, 0xEF, 0xA3, 0x0A, 0xCB, 0x78, 0xFF, 0xB5, 0x09, 0xDF, 0xD7, 0xCB,
-    0xDC, 0x7F, 0xDF, 0x69, 0xC1, 0x40, 0x2D, 0x41, 0x6A, 0x85, 0x63, 0xCC, 0xBC, 0x6F, 0xE7, 0x15,
-    0x49, 0x8A, 0xD1, 0x70, 0x11, 0xCD, 0x84, 0x22, 0x81, 0xEE, 0xD7, 0x1F, 0xDE, 0x6E, 0x16, 0x83,
-    0xED, 0x66, 0xC1, 0xE0, 0x4B, 0x16, 0x85, 0x63, 0x4C, 0x0D, 0x83, 0x04, 0xE8, 0x23, 0x65, 0x2E,
-    0xFD, 0xFA, 0x5C, 0xBA, 0x67, 0x64, 0xFE, 0x68, 0xAC, 0xDD, 0xC2, 0xE4, 0x02, 0xF5, 0xCF, 0xF4,
-    0x7F, 0xFE, 0x0A, 0x98, 0x97, 0xC1, 0x1C, 0x4C, 0xCE, 0xF1, 0xF9, 0x1D, 0xF5, 0x06, 0xC3, 0x2B,
-    0xE0, 0xDC, 0x10, 0x6D, 0x74, 0xCE, 0x77, 0x7F, 0xB7, 0xFB, 0x7A, 0xCF, 0x37, 0x4D, 0x4F, 0xB9,
-    0xB0, 0xAF, 0xF7, 0x89, 0x0B, 0xFB, 0x7A, 0x6F, 0xF4, 0x26, 0x0D, 0xAD, 0xC3, 0xA7, 0x5F, 0x60,
-    0xF4, 0x37, 0x3E, 0x6D, 0xFA, 0x77, 0xB0, 0xAF, 0xF7, 0xBC, 0xF9, 0x37, 0x6B, 0x22, 0x68, 0x24,
-    0xAE, 0x63, 0x40, 0xF1, 0x29, 0x53, 0x75, 0xAF, 0xEA, 0xB2, 0x2B, 0x6C, 0x73, 0x97, 0xD2, 0x7A,
-    0x77, 0x62, 0xB5, 0x69, 0x77, 0x5D, 0x0A, 0x1A, 0x56, 0xA1, 0x12, 0x94, 0x96, 0x54, 0xE9, 0x82,
-    0x74, 0x7D, 0x9B, 0xE5, 0x14, 0x74, 0x11, 0xAB, 0xB9, 0xF8, 0x8A, 0xA9, 0xED, 0xFF, 0xA8, 0xEB,
-    0x64, 0x8C, 0xD5, 0x11, 0x7D, 0xF3, 0x16, 0x4E, 0x9C, 0x70, 0xE9, 0xEE, 0xB5, 0x27, 0x5D, 0x62,
-    0x7B, 0x45, 0x68, 0x00, 0xFC, 0xA8, 0x3B, 0x3C, 0x21, 0x18, 0x9A, 0x95, 0x1B, 0x3B, 0xDD, 0xC2,
-    0xC9, 0x9F, 0xDD, 0xC2, 0x29, 0x99, 0x6C, 0x87, 0x27, 0xBD, 0x1C, 0xA3, 0x2C, 0x02, 0x8B, 0x0B,
-    0xC4, 0xBA, 0xC1, 0x3D, 0xD0, 0xC9, 0xC6, 0x6B, 0x80, 0xF9, 0x8E, 0xE4, 0xFB, 0x38, 0x54, 0x07,
-    0xED, 0xB7, 0x4F, 0x18, 0xB7, 0x01, 0x7E, 0xF3, 0xCB, 0xC5, 0xBD, 0x63, 0x08, 0x8C, 0xD0, 0x92,
-    0xD5, 0xEA, 0x4C, 0x3B, 0x76, 0x1F, 0x5E, 0x25, 0xD1, 0x56, 0xB7, 0x85, 0xC9, 0x35, 0xC0, 0x8F,
-    0x39, 0xAF, 0x0C, 0x15, 0xC3, 0xAB, 0xF8, 0x47, 0x9D, 0x65, 0x11, 0xB3, 0xD4, 0xC3, 0x62, 0xDA,
-    0x59, 0x39, 0xF2, 0x4F, 0x1A, 0x82, 0xE2, 0xDD, 0x96, 0xB3, 0x2C, 0xCF, 0xBA, 0xC4, 0x2D, 0xA5,
-    0x34, 0x86, 0x30, 0xD7, 0xF8, 0x2C, 0xCB, 0x58, 0x5E, 0x62, 0xEF, 0xA1, 0x6D, 0xC2, 0x72, 0x33,
-    0x6A, 0xB0, 0xB5, 0xCA, 0x35, 0x2B, 0x20, 0x1E, 0x87, 0xAC, 0xEF, 0x76, 0x27, 0x5B, 0x59, 0x25,
-    0x69, 0x48, 0x56, 0x6E, 0x7E, 0xAD, 0xD5, 0xA2, 0x1E, 0xD5, 0x36, 0x51, 0x31, 0xB0, 0x54, 0xE5,
-    0x82, 0xB8, 0x90, 0x65, 0x2A, 0x43, 0x0C, 0xB1, 0x60, 0x2F, 0x92, 0xC7, 0x10, 0x7F, 0x28, 0xDC,
-    0x1B, 0x20, 0xBA, 0xC6, 0x73, 0x6F, 0xA5, 0x8C, 0x45, 0x80, 0x59, 0x65, 0x17, 0xFE, 0xB0, 0x7A,
-    0x04, 0x82, 0x4E, 0xB7, 0xB4, 0x80, 0xDA, 0x87, 0x2F, 0x59, 0x8A, 0x32, 0xFB, 0xFA, 0x92, 0xD7,
-    0x6D, 0xAC, 0x50, 0xF8, 0xD8, 0x32, 0x94, 0x9B, 0x0E, 0xB1, 0x63, 0xFE, 0x8D, 0x71, 0x4E, 0xB0,
-    0xF6, 0x93, 0x3B, 0x53, 0xFD, 0x59, 0xA7, 0x55, 0xF3, 0x93, 0x8B, 0x37, 0x68, 0xF4, 0x23, 0xEA,
-    0x24, 0xEF, 0xB8, 0xBF, 0x0B, 0xA2, 0xDA, 0x2A, 0xA5, 0x66, 0xCF, 0xAC, 0xB4, 0xC1, 0xE2, 0xD4,
-    0x34, 0x36, 0xCD, 0x12, 0xE7, 0xCB, 0xB9, 0xEC, 0x5F, 0x31, 0xD7, 0xE5, 0xD0, 0xD1, 0xD3, 0x60,
-    0x9A, 0xFC, 0x6A, 0x98, 0x1B, 0x18, 0xFA, 0x29, 0x77, 0x15, 0x85, 0x6B, 0x45, 0x34, 0x5E, 0xD4,
-    0x20, 0xDB, 0x84, 0xC9, 0x49, 0xB8, 0x87, 0x16, 0x30, 0x8C, 0x48, 0x1F, 0x51, 0xEB, 0xB8, 0xB6,
-    0x9C, 0x9D, 0xDC, 0x57, 0x36, 0x04, 0x9B, 0xAD, 0x26, 0xA7, 0x86, 0xB8, 0x4A, 0xF3, 0x15, 0xDD,
-    0x3B, 0xD7, 0x74, 0x9F, 0x83, 0x7E, 0x67, 0x7E, 0xF2, 0xEB, 0x1A, 0x9E, 0xD3, 0xE7, 0xBA, 0x57,
-    0x92, 0xE6, 0x84, 0xE8, 0x04, 0x71, 0xE7, 0x9A, 0x15, 0x3D, 0xFA, 0x0C, 0x77, 0x01, 0x89, 0xAC,
-    0x2D, 0x95, 0xFC, 0x71, 0x5D, 0xB4, 0xAF, 0x68, 0x06, 0x7C, 0xFF, 0xB6, 0xD9, 0xE0, 0x29, 0x69,
-    0xB7, 0x58, 0x9B, 0x53, 0xD7, 0x06, 0xDB, 0xEF, 0xEC, 0x67, 0xE7, 0x42, 0x42, 0x06, 0x94, 0xE4,
-    0x41, 0x43, 0xE6, 0x8B, 0xB7, 0xDB, 0xBC, 0xF1, 0xFF, 0x01, 0xC5, 0x57, 0x3F, 0x6C, 0xDF, 0xC6,
-    0x15, 0x7E, 0x24, 0x65, 0x31, 0x16, 0x01, 0xD1, 0x43, 0x5C, 0x04, 0x8E, 0x63, 0x0E, 0xCD, 0x60,
-    0x14, 0x16, 0xB8, 0x78, 0xE8, 0xE0, 0xE4, 0xCE, 0xD1, 0x90, 0xA1, 0x43, 0x35, 0x48, 0xED, 0x90,
-    0xA5, 0xE8, 0x50, 0x20, 0x06, 0x0A, 0x75, 0xC8, 0x20, 0xA0, 0x03, 0x99, 0x7A, 0x48, 0xB6, 0x6A,
-    0xE9, 0xD4, 0x35, 0x83, 0xA3, 0x0C, 0xD6, 0xE0, 0x21, 0xE8, 0x1F, 0xDF, 0xC5, 0x1E, 0x32, 0x74,
-    0x61, 0x9B, 0xB1, 0x43, 0x6F, 0x08, 0xE0, 0x02, 0x41, 0xE1, 0x43, 0x41, 0x24, 0x54, 0x7A, 0xE4,
-    0xEB, 0xF7, 0x8E, 0x94, 0x2A, 0x25, 0x46, 0x90, 0x00, 0x4E, 0x7A, 0x3F, 0xDE, 0x8F, 0xBC, 0xE3,
-    0xBB, 0x77, 0xEF, 0xBD, 0x7B, 0xEF, 0x7B, 0x8F, 0xEF, 0xFD, 0xF1, 0x4C, 0xA3, 0x0B, 0x2B, 0x6F,
-    0xBC, 0xF0, 0xD2, 0x5E, 0xE9, 0xF2, 0xAE, 0xEA, 0x7F, 0xFD, 0xAF, 0xEF, 0xBF, 0x9D, 0xB5, 0xDF,
-    0xF4, 0x47, 0x44, 0xE7, 0xD0, 0xF7, 0x88, 0x12, 0x47, 0x94, 0x5B, 0xA2, 0x32, 0x3D, 0x38, 0x08,
-    0x8A, 0xF9, 0xA1, 0x26, 0x7F, 0x9D, 0x7E, 0x98, 0xE9, 0x2B, 0x74, 0x3D, 0x6F, 0x33, 0xBD, 0x45,
-    0xD7, 0x89, 0x32, 0x4D, 0x4F, 0xEF, 0x96, 0xD0, 0xBC, 0x7B, 0xDA, 0x11, 0xDD, 0x23, 0x7A, 0x09,
-    0x7B, 0xE3, 0xDD, 0xE7, 0x07, 0x77, 0xB0, 0xBB, 0x3D, 0xA4, 0xCB, 0x69, 0x97, 0xD8, 0x42, 0x5F,
-    0xA6, 0x8D, 0xC4, 0xD2, 0xD6, 0x65, 0xD0, 0x43, 0xBA, 0xA7, 0x7A, 0x5B, 0x51, 0x3C, 0x55, 0xCC,
-    0x7F, 0x61, 0xFE, 0x37, 0x73, 0xB8, 0xB8, 0xB3, 0x4D, 0x5F, 0x9A, 0xB8, 0xB8, 0x83, 0xC6, 0x68,
-    0x9F, 0xC9, 0xDF, 0x3F, 0xE4, 0x4F, 0xA6, 0xB6, 0x0F, 0xD0, 0xDE, 0xE3, 0x33, 0x4D, 0xB4, 0xA1,
-    0x83, 0xE3, 0x76, 0x97, 0xBF, 0xA2, 0xD1, 0x49, 0xFB, 0xA6, 0xF4, 0x3B, 0x7A, 0x67, 0xD7, 0xD7,
-    0xFF, 0x09, 0xC5, 0xC4, 0x29, 0x1B, 0x6B, 0x1E, 0x7F, 0x77, 0x83, 0x4F, 0xEF, 0xAC, 0xDE, 0x11,
-    0x6B, 0xFC, 0xF4, 0xAC, 0x6C, 0x32, 0xB5, 0x7D, 0x22, 0x9F, 0x3A, 0xF3, 0xEE, 0x73, 0xD1, 0x4C,
-    0x7C, 0x6C, 0xC8, 0x42, 0xE9, 0x2B, 0x5F, 0x77, 0xCA, 0x36, 0xD6, 0x74, 0xC6, 0x37, 0xBD, 0xEA,
-    0xD7, 0xE0, 0x06, 0xF5, 0x6D, 0xFE, 0x31, 0x57, 0x41, 0x79, 0xBE, 0x3D, 0x96, 0xDE, 0x6C, 0x86,
-    0xDA, 0x5E, 0xA5, 0xC2, 0xF1, 0x47, 0xFC, 0x16, 0x97, 0x41, 0x39, 0xC6, 0x4C, 0xC7, 0x85, 0x5F,
-    0x03, 0x93, 0xAA, 0x53, 0x43, 0xE3, 0x8D, 0x33, 0x5D, 0x63, 0x55, 0x57, 0xBB, 0xD2, 0xE7, 0x7D,
-    0x1A, 0xE8, 0x67, 0xB2, 0x6F, 0xE6, 0x0A, 0xE1, 0xBD, 0x19, 0xB2, 0x20, 0xDB, 0x18, 0xCD, 0x59,
-    0x28, 0xF0, 0xA8, 0xBC, 0xE9, 0xF8, 0x01, 0x3F, 0xE4, 0x57, 0xF9, 0x47, 0x5C, 0x8E, 0xE5, 0xB0,
-    0xA6, 0x2F, 0x45, 0x41, 0xEB, 0xB6, 0xD9, 0x94, 0x29, 0x4C, 0x56, 0xA1, 0xEE, 0x95, 0x6F, 0x3A,
-    0x6E, 0x79, 0x73, 0xCC, 0x21, 0xE8, 0xF1, 0xFA, 0xBE, 0xB6, 0xAA, 0xBD, 0x4A, 0x2F, 0x42, 0xA0,
-    0xC2, 0xF2, 0xDF, 0xC0, 0xE5, 0x2D, 0xF0, 0x29, 0xC6, 0x32, 0x54, 0xBD, 0x72, 0xAA, 0xE3, 0x9B,
-    0x42, 0x35, 0x88, 0x56, 0x9C, 0x4C, 0x85, 0x2F, 0xDD, 0x1A, 0xCD, 0xDC, 0x1B, 0x7D, 0x3F, 0x03,
-    0x31, 0x14, 0x1B, 0x8C, 0xC3, 0xFE, 0x9B, 0x9C, 0x43, 0x9C, 0xB2, 0x87, 0x6C, 0x4E, 0x59, 0x08,
-    0xDA, 0x36, 0x9A, 0xC9, 0xD0, 0x04, 0xE9, 0xF7, 0x69, 0xED, 0x9F, 0x08, 0x3D, 0x39, 0x64, 0x86,
-    0x53, 0x2A, 0x8F, 0x38, 0x18, 0x10, 0x15, 0x13, 0xAD, 0x6A, 0x73, 0xF3, 0xE7, 0x7C, 0xF7, 0xF1,
-    0x24, 0xB6, 0x34, 0xE8, 0x9F, 0x1C, 0x99, 0xDD, 0x5E, 0x57, 0x76, 0x85, 0x72, 0x50, 0x25, 0x21,
-    0xEE, 0x04, 0x5D, 0x10, 0x40, 0x45, 0x8F, 0x25, 0x23, 0x26, 0x0C, 0xEC, 0xAD, 0xDC, 0xCC, 0x23,
-    0x3B, 0xCD, 0x34, 0x01, 0x65, 0xDC, 0xEA, 0xCC, 0x6C, 0x71, 0xBC, 0x55, 0xA3, 0x7F, 0xC1, 0x77,
-    0x3F, 0x39, 0xB5, 0x55, 0xF3, 0x1A, 0xB6, 0xEA, 0x56, 0x22, 0xE7, 0x6C, 0x3A, 0x5E, 0xE2, 0xE6,
-    0x25, 0xC9, 0x48, 0xC5, 0xC7, 0xEA, 0x7B, 0x12, 0x15, 0x71, 0xC9, 0x5D, 0xDC, 0x1E, 0xED, 0x37,
-    0x37, 0xEF, 0xCD, 0xC2, 0x0C, 0x4F, 0xD8, 0x05, 0xFB, 0xF0, 0x2B, 0xDC, 0xF3, 0xD4, 0x20, 0x8E,
-    0x3E, 0xE3, 0x81, 0x43, 0x9C, 0x5D, 0x81, 0xEE, 0xD8, 0xA1, 0x71, 0x30, 0x81, 0xA3, 0x86, 0x5D,
-    0xCE, 0xEC, 0x1A, 0xE6, 0x0F, 0x11, 0x81, 0x0D, 0x8F, 0x39, 0x8F, 0xD4, 0x8C, 0x94, 0x8F, 0x11,
-    0x20, 0x22, 0x62, 0x68, 0xFE, 0xBB, 0x08, 0x39, 0x72, 0xF7, 0x8E, 0x28, 0xB5, 0x5D, 0x8C, 0x09,
-    0xA8, 0x2D, 0x7F, 0xCA, 0x5E, 0x4D, 0x4D, 0x28, 0xF9, 0xB7, 0x53, 0xCA, 0xF6, 0x75, 0xBA, 0xA4,
-    0x93, 0x2D, 0x22, 0x5C, 0xCF, 0x8A, 0x1C, 0xC6, 0x91, 0xEA, 0xD5, 0x44, 0x25, 0x53, 0x81, 0x93,
-    0x74, 0x09, 0xF7, 0x64, 0x02, 0x26, 0x2A, 0xD6, 0x05, 0x8E, 0xC8, 0x92, 0x6C, 0xDF, 0xAF, 0xEE,
-    0x53, 0xF2, 0x0E, 0xD1, 0x9D, 0x53, 0xDB, 0xD8, 0xED, 0x27, 0x80, 0x64, 0x7B, 0x2B, 0xDC, 0xC8,
-    0xFF, 0x7F, 0x20, 0xB9, 0x7F, 0x55, 0x8D, 0xD9, 0x77, 0x03, 0x92, 0x74, 0x95, 0xE8, 0x3E, 0xCE,
-    0xAE, 0x2D, 0x7E, 0xE9, 0x36, 0xAE, 0xED, 0xBD, 0x71, 0xED, 0x85, 0xAD, 0x6B, 0xE7, 0xE8, 0x1A,
-    0x3D, 0xE5, 0x0B, 0xED, 0xC2, 0x05, 0xA2, 0x1B, 0x1B, 0xD0, 0xB0, 0xD0, 0x94, 0x3D, 0x80, 0xC2,
-    0xFD, 0xBD, 0x5B, 0x07, 0x61, 0xC3, 0x70, 0xD8, 0x38, 0x24, 0x7F, 0xEF, 0x10, 0x73, 0x87, 0x78,
-    0x77, 0x08, 0x9A, 0x43, 0xD0, 0x1E, 0x62, 0xC9, 0xB7, 0xD5, 0x63, 0x5B, 0x81, 0x6F, 0xEE, 0xDD,
-    0xC0, 0xA1, 0x7B, 0xCA, 0x6F, 0x5B, 0xBA, 0x02, 0xCB, 0xEF, 0xA9, 0x83, 0x77, 0xF7, 0x90, 0x25,
-    0xF0, 0xBC, 0x8E, 0xB9, 0x75, 0xBC, 0x5B, 0x07, 0xCD, 0x3A, 0x68, 0xD7, 0xB1, 0xE2, 0xDB, 0xEC,
-    0x73, 0x4B, 0xF5, 0xF2, 0x70, 0x6B, 0x1F, 0x86, 0xB2, 0xF3, 0x73, 0xC5, 0x88, 0x31, 0x6E, 0xE3,
-    0x73, 0xC2, 0x18, 0xE4, 0x61, 0x7E, 0x51, 0x1E, 0x21, 0xAE, 0x54, 0x37, 0x0F, 0x4C, 0x6B, 0x6C,
-    0xB2, 0xE4, 0x92, 0x2C, 0x10, 0x53, 0xE9, 0x17, 0x2A, 0x9F, 0x21, 0xC8, 0xE6, 0xE5, 0xD4, 0xD8,
-    0xB2, 0xCF, 0x96, 0xE5, 0xA0, 0x06, 0xD0, 0x2E, 0xCB, 0xC1, 0x93, 0xF5, 0x71, 0x2A, 0xAA, 0xBC,
-    0xE0, 0xE3, 0x31, 0xE8, 0x77, 0x00, 0xDA, 0xF6, 0x12, 0x04, 0x42, 0x07, 0x8A, 0xBE, 0x12, 0x72,
-    0x04, 0x17, 0x7A, 0xC2, 0x8F, 0x43, 0x85, 0x60, 0x1E, 0xC8, 0xF0, 0x90, 0x22, 0xAB, 0x73, 0x3E,
-    0xED, 0x7A, 0xE9, 0x09, 0x0F, 0x79, 0xAF, 0x3A, 0x41, 0x51, 0x40, 0xCA, 0x0E, 0x01, 0x41, 0xB1,
-    0xB3, 0x74, 0x81, 0x31, 0xD9, 0x2A, 0x0F, 0x51, 0x56, 0xA0, 0xB1, 0xCB, 0x82, 0x74, 0x81, 0x13,
-    0xE8, 0x80, 0x2C, 0xD1, 0x8A, 0xE0, 0xF9, 0x00, 0xD8, 0x52, 0x0F, 0xD0, 0x05, 0x63, 0x6C, 0x01,
-    0xF2, 0x62, 0x90, 0x25, 0x98, 0xAE, 0x7C, 0x31, 0x48, 0x97, 0xE5, 0x90, 0x6E, 0xFE, 0x45, 0x68,
-    0x34, 0x8F, 0xC0, 0xE3, 0xD1, 0x14, 0xB5, 0x21, 0xB1, 0x94, 0xF4, 0x68, 0x21, 0x83, 0x49, 0x16,
-    0x98, 0xAB, 0xD1, 0x2F, 0xE9, 0xB9, 0x03, 0x3A, 0x4E, 0xB7, 0x97, 0xC1, 0xB9, 0x04, 0x24, 0x01,
-    0x5E, 0xB8, 0x33, 0x4E, 0xF9, 0xBA, 0x2F, 0x87, 0x74, 0xA0, 0xE7, 0x4E, 0xDE, 0xD7, 0x1A, 0x14,
-    0x7D, 0x39, 0x16, 0x53, 0xCE, 0x19, 0xE0, 0xEE, 0x03, 0xA1, 0x64, 0x67, 0x5C, 0x83, 0x54, 0xA4,
-    0x7A, 0xA1, 0x2F, 0x87, 0x22, 0xA4, 0x03, 0xC0, 0xFB, 0x39, 0x7A, 0xE6, 0x14, 0x67, 0xAC, 0x9C,
-    0xD7, 0x0E, 0xF3, 0xEA, 0x79, 0xFD, 0x6F, 0x16, 0x0E, 0xC2, 0xC3, 0x2F, 0x5C, 0x84, 0xCF, 0x10,
-    0x39, 0x05, 0xE1, 0x95, 0xCF, 0xDC, 0xC6, 0xC8, 0xEF, 0x7C, 0xE4, 0xF6, 0x67, 0x82, 0xC1, 0x70,
-    0x76, 0xB0, 0x87, 0x2D, 0x27, 0x6A, 0x7C, 0xCA, 0xBA, 0x0C, 0xB0, 0x12, 0xE8, 0xD6, 0xE6, 0xC3,
-    0x74, 0xA9, 0xCF, 0x43, 0x36, 0xA6, 0xFC, 0x26, 0x5B, 0x70, 0x15, 0x91, 0xA3, 0x5A, 0x56, 0x98,
-    0xCB, 0xDE, 0x84, 0x34, 0xEB, 0x84, 0x3F, 0x38, 0xDF, 0x07, 0xDF, 0xF3, 0x8B, 0xA4, 0xC9, 0x40,
-    0x7F, 0xC2, 0x4F, 0x52, 0xB0, 0x72, 0xB3, 0x9A, 0x24, 0x0C, 0xD4, 0xB0, 0xE8, 0x5B, 0x07, 0xC8,
-    0x35, 0x91, 0x18, 0xA8, 0xF1, 0xF2, 0x1A, 0x9B, 0xD7, 0x7D, 0x05, 0x69, 0xE1, 0x1B, 0x06, 0xC9,
-    0x2F, 0xEB, 0xA3, 0xC0, 0xC2, 0x52, 0x84, 0x11, 0xBF, 0x0B, 0x4B, 0xAE, 0x60, 0x39, 0x15, 0x03,
-    0x28, 0x7E, 0x55, 0x9C, 0x0D, 0xA5, 0x82, 0xCE, 0x07, 0xCA, 0x2C, 0x76, 0x83, 0x1C, 0xDC, 0x95,
-    0x53, 0xC2, 0xAE, 0x14, 0xC5, 0xC8, 0x00, 0xBD, 0xBD, 0x5C, 0x8D, 0x97, 0xDC, 0xA1, 0x5A, 0x1C,
-    0xD5, 0x15, 0x2C, 0xD6, 0x00, 0x2A, 0x5C, 0x19, 0x5B, 0x5C, 0x39, 0xB7, 0x90, 0xC4, 0xF4, 0x39,
-    0x78, 0xF5, 0x62, 0x10, 0x07, 0x65, 0x48, 0xC7, 0xA4, 0x03, 0xB8, 0x89, 0x09, 0xE5, 0x7D, 0x43,
-    0x45, 0x97, 0xA2, 0xEE, 0xA8, 0x50, 0x4E, 0x14, 0x28, 0x52, 0xAA, 0x0E, 0xC5, 0x8A, 0x43, 0x5E,
-    0xE5, 0xE4, 0xE6, 0x24, 0xAE, 0x95, 0x89, 0x1F, 0xB9, 0x12, 0xD0, 0x9F, 0x0D, 0xD8, 0x27, 0xD1,
-    0x13, 0x27, 0x1A, 0x14, 0x52, 0x29, 0x08, 0x3D, 0xFE, 0xA1, 0x9F, 0x2F, 0x3B, 0x33, 0x16, 0x8E,
-    0xD2, 0x60, 0x48, 0xD2, 0x71, 0x6D, 0xA5, 0x62, 0x29, 0xBC, 0xA4, 0x68, 0x38, 0x6F, 0x32, 0xA2,
-    0x84, 0x00, 0x03, 0x44, 0x8A, 0x2D, 0x1D, 0xA8, 0x9D, 0x82, 0x1B, 0x67, 0x83, 0xA1, 0xD5, 0x96,
-    0x42, 0xC4, 0xBF, 0x5F, 0x2D, 0x06, 0xDE, 0xA6, 0x73, 0x5B, 0x0D, 0x22, 0xE4, 0x21, 0xA4, 0x67,
-    0xC8, 0x8F, 0xAA, 0x07, 0x91, 0xF4, 0x57, 0xEE, 0x72, 0x54, 0x1F, 0x54, 0x85, 0x2A, 0x40, 0x69,
-    0x21, 0xF8, 0x40, 0x34, 0x84, 0x5A, 0xB0, 0x37, 0x0E, 0x17, 0x8E, 0x41, 0x72, 0x80, 0xD9, 0xA9,
-    0xA9, 0x1A, 0x26, 0xB2, 0xC6, 0xA6, 0x8C, 0xC0, 0xC8, 0xE1, 0x29, 0xE2, 0xBF, 0x88, 0x08, 0xFB,
-    0x22, 0xA1, 0xEC, 0x38, 0x69, 0x08, 0x94, 0xDA, 0x99, 0x3E, 0x45, 0xD5, 0xD5, 0x95, 0xA8, 0xC7,
-    0xB4, 0x1A, 0xEB, 0x00, 0xDB, 0x22, 0x02, 0x5E, 0xA7, 0x27, 0x94, 0xA3, 0x0A, 0xA5, 0x4D, 0x30,
-    0x28, 0x93, 0x87, 0x8B, 0x3B, 0x91, 0x41, 0xE4, 0xA5, 0x24, 0x5E, 0x6A, 0x1F, 0x63, 0x96, 0x96,
-    0x94, 0x1F, 0xA3, 0x36, 0x96, 0x25, 0x14, 0x91, 0xC3, 0x08, 0x8D, 0x04, 0xEC, 0xFC, 0x57, 0xB9,
-    0x63, 0x6A, 0x29, 0x01, 0x66, 0xEA, 0xE4, 0x6B, 0x50, 0x9F, 0xE2, 0x3D, 0xCD, 0x30, 0x25, 0x4B,
-    0x74, 0x44, 0x2F, 0x9A, 0xC3, 0x99, 0xD2, 0x08, 0x6E, 0xF1, 0xA0, 0x57, 0xDF, 0x05, 0xCD, 0x81,
-    0x46, 0x71, 0xEA, 0x90, 0xFE, 0x07, 0x14, 0x19, 0x30, 0x04, 0xAA, 0x6A, 0x54, 0x19, 0x72, 0xB7,
-    0xF2, 0xBD, 0x81, 0xBB, 0x7F, 0xF9, 0x27, 0xF0, 0xAE, 0xDF, 0x99, 0x61, 0x56, 0x03, 0x1E, 0x77,
-    0x52, 0x55, 0x89, 0x0B, 0xA0, 0x58, 0x3B, 0xB9, 0xE7, 0x52, 0x02, 0xE1, 0xBE, 0x8B, 0xFB, 0xF3,
-    0x13, 0x3D, 0x0F, 0xB8, 0x5B, 0x65, 0x04, 0x53, 0x04, 0x14, 0xA0, 0x1F, 0x5B, 0x81, 0x61, 0xA9,
-    0x5D, 0x70, 0xD7, 0x19, 0xA3, 0xA8, 0xE0, 0x8F, 0x69, 0xC1, 0xB0, 0x13, 0x2E, 0xA9, 0x8C, 0xCD,
-    0x62, 0xBF, 0x0B, 0xF4, 0xA5, 0x96, 0x88, 0x4A, 0x4D, 0x87, 0x52, 0x4A, 0x42, 0x03, 0xA8, 0x8E,
-    0x7B, 0x72, 0xEA, 0x9E, 0x09, 0xE4, 0x43, 0x27, 0x9C, 0xD2, 0x02, 0x57, 0x68, 0x17, 0x75, 0xCC,
-    0x0C, 0x41, 0x94, 0x4D, 0xA5, 0x8A, 0xB2, 0xA4, 0x82, 0x68, 0x9A, 0xF1, 0x6D, 0xC8, 0x06, 0x6F,
-    0x12, 0x35, 0x33, 0xB0, 0x4E, 0x11, 0x10, 0xBD, 0xE8, 0x28, 0x03, 0x44, 0x90, 0x14, 0x6A, 0xD9,
-    0x10, 0xEB, 0xB6, 0x26, 0x0E, 0x76, 0x65, 0x90, 0x18, 0x84, 0xAF, 0x17, 0xD5, 0x52, 0x8E, 0x96,
-    0xAB, 0x17, 0xBD, 0x48, 0x1D, 0xCD, 0x79, 0x20, 0x2A, 0x85, 0xC0, 0xC0, 0xD9, 0xA4, 0xF3, 0xE0,
-    0xFC, 0xF2, 0x59, 0xF9, 0x45, 0x5D, 0x4C, 0xAB, 0x40, 0x50, 0x4D, 0xA2, 0x40, 0xCA, 0xBE, 0xC1,
-    0xA0, 0x9E, 0x44, 0x0B, 0xE0, 0x14, 0x0A, 0x2F, 0x5A, 0xDD, 0x4F, 0xB6, 0x67, 0x62, 0x9B, 0xFC,
-    0x41, 0x4B, 0x98, 0x47, 0xEB, 0xB5, 0x35, 0x80, 0x59, 0x02, 0x58, 0x4C, 0xAB, 0x6B, 0xA9, 0x0F,
-    0x3D, 0x1D, 0xBD, 0xC6, 0xB1, 0x66, 0x2E, 0xF1, 0x4D, 0x20, 0x67, 0xFE, 0x21, 0x47, 0x57, 0x13,
-    0xB9, 0xA9, 0xFA, 0xE8, 0x7F, 0x83, 0x84, 0x65, 0x50, 0x30, 0xBE, 0x31, 0xE4, 0xB0, 0x37, 0x19,
-    0x3B, 0xB3, 0xC3, 0x01, 0xD7, 0xEC, 0x52, 0x19, 0x38, 0x28, 0x21, 0xBE, 0x25, 0x5E, 0x34, 0x46,
-    0x07, 0x2B, 0xBB, 0x78, 0x24, 0x5B, 0x5F, 0x38, 0x0E, 0x78, 0x1D, 0xAE, 0x94, 0x3B, 0x80, 0x10,
-    0xA9, 0x11, 0x0C, 0x60, 0xD3, 0x4E, 0x18, 0x20, 0x5A, 0x10, 0x94, 0x72, 0x0C, 0x3F, 0x58, 0x68,
-    0xB5, 0xD0, 0x64, 0xAD, 0xE2, 0x23, 0x52, 0x30, 0x3B, 0xFF, 0x7E, 0xAA, 0x8F, 0x50, 0x56, 0xFB,
-    0xE8, 0x70, 0xA8, 0x30, 0x56, 0xB9, 0x23, 0x7D, 0x86, 0x7B, 0xD9, 0x16, 0x5D, 0xDE, 0x65, 0xA8,
-    0x4B, 0x25, 0xCD, 0x0A, 0x50, 0x02, 0x88, 0x2B, 0x84, 0xF1, 0x9C, 0x08, 0x00, 0xD3, 0xF8, 0x6A,
-    0x8A, 0x38, 0x8B, 0xCF, 0x98, 0xA9, 0x60, 0xC9, 0x42, 0x6F, 0x4A, 0xBC, 0xB3, 0x9B, 0x33, 0x42,
-    0x19, 0x8A, 0x31, 0x9B, 0x04, 0x6E, 0x23, 0xCE, 0x0A, 0x40, 0x17, 0x2E, 0xF7, 0x82, 0xB6, 0x4B,
-    0x6A, 0x58, 0x25, 0xFA, 0x2F, 0x8D, 0x92, 0xB1, 0x4E, 0xDC, 0x40, 0x14, 0x45, 0xDF, 0xD8, 0x61,
-    0x2D, 0xE1, 0x62, 0x1A, 0xA8, 0xDD, 0xA7, 0xF1, 0x27, 0x8C, 0x53, 0x51, 0x86, 0x82, 0xD4, 0x54,
-    0xA9, 0xF9, 0x04, 0x9B, 0xA4, 0xC8, 0x6F, 0xA4, 0x44, 0x4B, 0xC1, 0x27, 0xCC, 0x28, 0x48, 0x49,
-    0xEB, 0xD0, 0xA6, 0x71, 0x41, 0x11, 0x91, 0x66, 0x14, 0xB9, 0x30, 0x68, 0xC6, 0x8F, 0xFB, 0x66,
-    0xBD, 0x68, 0x81, 0x14, 0xF1, 0x6A, 0xA4, 0xB5, 0x3D, 0x73, 0x7D, 0xEF, 0xBB, 0x87, 0x08, 0x57,
-    0xC9, 0x03, 0x55, 0xCC, 0xA4, 0x99, 0xBD, 0x8E, 0x3A, 0x16, 0x91, 0xF8, 0x13, 0x93, 0xF1, 0xDC,
-    0x95, 0xC1, 0x0C, 0x19, 0xEB, 0x91, 0xDA, 0xEB, 0x48, 0xF5, 0xF2, 0x20, 0x9F, 0xCB, 0xA0, 0xF8,
-    0x1D, 0x9F, 0xB3, 0x33, 0xCC, 0x7D, 0x8E, 0x45, 0x35, 0x77, 0x44, 0x07, 0xB4, 0x5C, 0xA5, 0xC7,
-    0x0A, 0xA2, 0x4C, 0x54, 0xB0, 0xA3, 0x9C, 0x3D, 0xE5, 0x73, 0xA0, 0x2C, 0x58, 0x52, 0xB1, 0x76,
-    0x34, 0x63, 0xC7, 0x9C, 0x05, 0xB2, 0x8D, 0x6D, 0xA0, 0xC1, 0x25, 0x96, 0x5B, 0x5F, 0xCE, 0x5F,
-    0x89, 0x2C, 0xCE, 0x63, 0x47, 0xD2, 0xA0, 0x13, 0x1C, 0xE7, 0x0C, 0xEF, 0x60, 0xCD, 0xDC, 0x5D,
-    0x68, 0xC8, 0x40, 0x96, 0x23, 0xB5, 0xEC, 0xF7, 0x61, 0x59, 0xE1, 0xD3, 0x70, 0x97, 0x47, 0xFC,
-    0x6B, 0x32, 0xFE, 0xC1, 0xFC, 0x13, 0x6E, 0x0C, 0x77, 0xEA, 0x64, 0xB1, 0x52, 0x70, 0xA3, 0xB0,
-    0xB1, 0xE2, 0x5B, 0x25, 0x31, 0xE5, 0xB4, 0x13, 0xD1, 0xA6, 0x16, 0xD5, 0x3F, 0xFC, 0x39, 0x4A,
-    0xBE, 0x3C, 0x9A, 0x5E, 0x8F, 0xDC, 0x99, 0x1B, 0xE4, 0x42, 0xA0, 0x09, 0x3B, 0x5C, 0xCE, 0xA3,
-    0x38, 0x20, 0x18, 0xFC, 0xC2, 0x1C, 0x5B, 0xE6, 0x5F, 0x0F, 0x97, 0x48, 0xC0, 0x45, 0x5F, 0xF5,
-    0x6F, 0x92, 0x11, 0xA2, 0x6A, 0x48, 0x96, 0x6C, 0x27, 0x3E, 0x14, 0x1E, 0x98, 0x41, 0xEC, 0x90,
-    0x71, 0x48, 0x4B, 0xB4, 0xD7, 0x24, 0x17, 0x19, 0x4F, 0x90, 0x09, 0xF9, 0x7C, 0x3A, 0x56, 0x43,
-    0x35, 0xB4, 0x5D, 0x7B, 0xCE, 0x59, 0xCC, 0xF9, 0x0C, 0xD3, 0x9D, 0x31, 0x9E, 0x89, 0x2C, 0x87,
-    0x32, 0xD4, 0x93, 0x71, 0x95, 0xC7, 0xE8, 0xAF, 0x31, 0x60, 0x1D, 0xB1, 0x99, 0xB9, 0xD3, 0xB0,
-    0xB1, 0x8D, 0x53, 0x20, 0x43, 0xCB, 0x23, 0xDC, 0xF9, 0xDA, 0xB7, 0x03, 0x37, 0xF6, 0x3A, 0x2A,
-    0xF1, 0x1F, 0x8C, 0xD7, 0xBE, 0x7D, 0x60, 0x67, 0x11, 0xF6, 0x0C, 0x7A, 0x64, 0x1D, 0x95, 0x33,
-    0x1C, 0xF9, 0x3D, 0x0B, 0x41, 0x14, 0x60, 0xE0, 0xEA, 0x50, 0x44, 0x8E, 0x0F, 0xA9, 0x8C, 0x76,
-    0x44, 0x4C, 0x6C, 0x9D, 0xDB, 0x21, 0x0F, 0x48, 0xC0, 0xF8, 0x19, 0x67, 0x9C, 0x86, 0xCE, 0xB3,
-    0x07, 0x36, 0x98, 0xD9, 0x70, 0x25, 0xFD, 0x3E, 0x8D, 0xB4, 0x17, 0x56, 0x64, 0x0D, 0x7A, 0xAE,
-    0xFE, 0x83, 0x17, 0x9D, 0x78, 0xE9, 0x9E, 0xF1, 0xD2, 0x13, 0x7D, 0xD8, 0xE8, 0x65, 0xE8, 0x05,
-    0x29, 0x18, 0x24, 0xB8, 0x95, 0xF5, 0x54, 0x84, 0x34, 0xC8, 0xD6, 0x51, 0xF5, 0xF2, 0x06, 0xA2,
-    0x1C, 0x20, 0xF2, 0x1E, 0xF5, 0x6C, 0xE6, 0x7A, 0x8B, 0x79, 0x48, 0x5B, 0xA3, 0x19, 0x65, 0x1E,
-    0xFC, 0x0D, 0x43, 0xA6, 0x63, 0x38, 0x90, 0x9E, 0x85, 0x41, 0xDB, 0x23, 0x6D, 0xBA, 0xD3, 0x13,
-    0xA4, 0xEE, 0xD6, 0x38, 0x8B, 0x40, 0x3C, 0xA2, 0x4F, 0xC9, 0xA4, 0xEC, 0x3D, 0x00, 0xBB, 0x61,
-    0x0E, 0x56, 0xF1, 0x29, 0x22, 0x37, 0xB5, 0x87, 0xF5, 0x0C, 0x13, 0x4B, 0x96, 0x84, 0x5C, 0x1C,
-    0xEF, 0xA4, 0x58, 0xFB, 0xF7, 0x8A, 0x27, 0xD0, 0x51, 0xA1, 0x86, 0x8F, 0xDB, 0x71, 0xEC, 0x2F,
-    0xB0, 0x17, 0xB0, 0x99, 0x2F, 0xB0, 0x67, 0x2F, 0x61, 0x67, 0x81, 0x9D, 0x76, 0x60, 0x47, 0x4F,
-    0xFE, 0x39, 0xEC, 0xEA, 0x82, 0x56, 0xEB, 0x75, 0x96, 0xDE, 0xED, 0xC2, 0x7E, 0x8F, 0xF6, 0x86,
-    0x92, 0xA5, 0x4B, 0xB7, 0xC0, 0x4E, 0x02, 0xF5, 0x77, 0xFB, 0x04, 0xFB, 0x32, 0x48, 0x5A, 0xC1,
-    0x42, 0x82, 0xFD, 0xB7, 0xC2, 0x60, 0x74, 0x5C, 0x60, 0x9F, 0x05, 0xF6, 0x0E, 0x5F, 0x7D, 0x05,
-    0xBB, 0x02, 0xEC, 0x57, 0x09, 0xF6, 0x42, 0x98, 0x81, 0xCE, 0xDB, 0xF5, 0xFA, 0x68, 0x0B, 0xFB,
-    0x15, 0x12, 0xD8, 0xA3, 0xBE, 0x1A, 0x0E, 0x12, 0xE2, 0xCD, 0x13, 0xEC, 0xEE, 0xDF, 0xB0, 0xAF,
-    0x36, 0xB0, 0x2B, 0x00, 0x6B, 0x78, 0xCA, 0xE7, 0xB3, 0x51, 0xFB, 0x5D, 0xD8, 0x7D, 0x9E, 0x60,
-    0x07, 0x1D, 0x1C, 0x8A, 0x04, 0x7B, 0xBD, 0x81, 0x9D, 0x00, 0x7B, 0x35, 0x09, 0xEC, 0xD5, 0x0E,
-    0xEC, 0x59, 0x82, 0x1D, 0x87, 0x5E, 0xC3, 0x3E, 0x08, 0xEC, 0x36, 0xC1, 0x8E, 0xFA, 0xD1, 0x21,
-    0x62, 0x4A, 0x4B, 0x5E, 0xB5, 0x1B, 0xD8, 0xDB, 0x05, 0xF6, 0x47, 0x4D, 0x52, 0xA1, 0x4E, 0x03,
-    0x41, 0x10, 0x7D, 0x77, 0xC7, 0xA5, 0xA2, 0xE2, 0x14, 0x04, 0x82, 0x38, 0x0F, 0xA2, 0x9F, 0xB0,
-    0x17, 0xBE, 0xA0, 0x09, 0x60, 0x8A, 0x41, 0x63, 0xFA, 0x09, 0xAD, 0xC7, 0x20, 0xF8, 0x04, 0x14,
-    0x06, 0x8B, 0xDB, 0x03, 0x04, 0x92, 0x12, 0x02, 0xBA, 0x02, 0x4C, 0x55, 0xC5, 0x91, 0x14, 0x72,
-    0xDD, 0xE1, 0xCD, 0x5C, 0xAF, 0x74, 0xC5, 0x64, 0x76, 0xDF, 0xEC, 0x9B, 0xB7, 0x6F, 0xD6, 0x09,
-    0xD7, 0x93, 0x86, 0xDA, 0x69, 0x2C, 0x87, 0x9A, 0xC2, 0xCF, 0xE1, 0xCA, 0xAE, 0x20, 0xB6, 0x34,
-    0xD7, 0x14, 0x95, 0xA6, 0x80, 0xA6, 0x80, 0xFF, 0x3E, 0x3D, 0x61, 0xCA, 0x0B, 0xF0, 0x7A, 0x41,
-    0xD3, 0xB1, 0x9E, 0xF6, 0xDB, 0x02, 0xD6, 0x26, 0x3C, 0x2C, 0x40, 0xDE, 0x0A, 0xB1, 0xA5, 0x9B,
-    0x0C, 0xF2, 0x03, 0x44, 0xFF, 0x05, 0x4D, 0x2D, 0x57, 0xAA, 0x61, 0x48, 0x32, 0xF4, 0xF4, 0xA4,
-    0xAB, 0xEC, 0x91, 0x4C, 0x64, 0x0A, 0x57, 0x75, 0x02, 0x3A, 0x02, 0x37, 0x85, 0x9F, 0x26, 0x35,
-    0xB2, 0x25, 0xF6, 0xC8, 0x53, 0xB2, 0x3E, 0xAB, 0x19, 0x2E, 0x64, 0x26, 0x26, 0x64, 0x0E, 0x86,
-    0x25, 0x09, 0x16, 0x50, 0x11, 0xE3, 0x2D, 0xE4, 0xAA, 0x34, 0xB6, 0xA7, 0x1D, 0xC8, 0xEF, 0x6D,
-    0x01, 0x32, 0xA9, 0xC8, 0x49, 0x7B, 0x17, 0x6C, 0x98, 0x5E, 0x9A, 0x0F, 0x5E, 0xE3, 0x73, 0x63,
-    0xC9, 0x2F, 0x37, 0xC5, 0x3D, 0xA2, 0x01, 0xA5, 0x6D, 0xA3, 0x5D, 0x31, 0x4F, 0x3F, 0xDB, 0x8D,
-    0x58, 0xC3, 0x66, 0x65, 0x66, 0xE1, 0x6A, 0xB3, 0x2F, 0xAF, 0x23, 0x69, 0xAB, 0xF2, 0x1A, 0x7C,
-    0x64, 0xB3, 0x22, 0x29, 0x29, 0x2A, 0xEA, 0xB7, 0x80, 0x5B, 0x40, 0x36, 0x80, 0x7C, 0xFE, 0x0F,
-    0x24, 0x1B, 0x40, 0xE1, 0x08, 0xEC, 0x5C, 0x29, 0xE0, 0xE7, 0x1C, 0x53, 0xD9, 0x93, 0x8A, 0x40,
-    0x1E, 0xE8, 0x53, 0xCD, 0xCE, 0xCC, 0xEE, 0xE4, 0x81, 0x02, 0x1E, 0xE5, 0xA8, 0x8E, 0x4C, 0xD5,
-    0x88, 0x63, 0x9C, 0xE6, 0x65, 0xAE, 0x06, 0xD3, 0xB8, 0x24, 0x80, 0x37, 0xE4, 0x06, 0x06, 0x2C,
-    0xAD, 0x07, 0x14, 0x88, 0x25, 0x68, 0x0F, 0x18, 0x90, 0x71, 0xD3, 0x02, 0x9C, 0xC1, 0x62, 0x0D,
-    0xD0, 0xC5, 0x72, 0x0D, 0x9C, 0x67, 0xCB, 0x35, 0xE0, 0x0A, 0x37, 0xE9, 0x85, 0xBE, 0x7A, 0xFD,
-    0x7E, 0x5C, 0x75, 0xF4, 0x27, 0xD1, 0x58, 0x27, 0xC1, 0x7D, 0xC8, 0x8B, 0x4D, 0x82, 0xD6, 0xBF,
-    0x51, 0x50, 0xE3, 0x4E, 0x57, 0x2A, 0xD2, 0xAE, 0xCC, 0x48, 0xFB, 0x48, 0x4F, 0x2C, 0x33, 0x3F,
-    0x3C, 0xE7, 0xDC, 0xCC, 0x1C, 0xA3, 0x66, 0xF2, 0xE1, 0xAC, 0x26, 0x6F, 0xA9, 0xF3, 0x0E, 0x48,
-    0x16, 0xE8, 0x71, 0x5B, 0xF1, 0x2F, 0x20, 0x99, 0x98, 0x28, 0xA4, 0xF2, 0x35, 0x18, 0xEB, 0x67,
-    0x21, 0xB7, 0xB3, 0x6F, 0xB8, 0x23, 0xEF, 0xA7, 0x58, 0x3D, 0xE8, 0x50, 0x66, 0xDE, 0xB8, 0x82,
-    0x92, 0xAB, 0x96, 0x48, 0x5B, 0x70, 0x6E, 0x66, 0xB3, 0xB7, 0xA1, 0x8C, 0xEC, 0x0B, 0x38, 0x5E,
-    0xDD, 0xD5, 0xE7, 0xDF, 0xD5, 0x7C, 0xA2, 0x69, 0x68, 0x66, 0x9B, 0x2B, 0x29, 0x30, 0xB8, 0xC6,
-    0x1F, 0xA5, 0x55, 0x3D, 0x6F, 0xD4, 0x40, 0x10, 0x5D, 0xDB, 0x04, 0x47, 0x58, 0xD1, 0xD2, 0xA4,
-    0x43, 0xF8, 0x0F, 0x20, 0xB9, 0x49, 0xBF, 0x17, 0x51, 0xD2, 0x50, 0x70, 0x14, 0x54, 0xB4, 0xA4,
-    0xCA, 0x0F, 0x40, 0xB1, 0xA5, 0xFC, 0x00, 0x52, 0x53, 0xD1, 0x80, 0x14, 0xA7, 0xA5, 0x4D, 0x76,
-    0x93, 0x14, 0x29, 0x63, 0x44, 0x41, 0x99, 0xAD, 0xA1, 0xC8, 0x8A, 0x58, 0xCA, 0xA1, 0xAC, 0x77,
-    0x98, 0x19, 0xDF, 0x39, 0x97, 0x23, 0xA4, 0x80, 0x95, 0x6E, 0xF4, 0xE4, 0x5B, 0xCF, 0xC7, 0x9B,
-    0x37, 0x63, 0x11, 0x09, 0x3A, 0x69, 0x45, 0x36, 0xB7, 0x64, 0x4B, 0x47, 0x16, 0xE8, 0x49, 0xD2,
-    0x11, 0x94, 0xAD, 0x88, 0xC6, 0x2F, 0x14, 0xE0, 0x09, 0x7A, 0xCE, 0x16, 0x6C, 0xE5, 0x84, 0xEE,
-    0x24, 0xC0, 0x7E, 0xA0, 0x21, 0xAB, 0xD8, 0x83, 0x64, 0x9C, 0x8C, 0xC4, 0xCD, 0x93, 0xE3, 0x83,
-    0x0C, 0xFD, 0xC6, 0x80, 0x2F, 0x6A, 0xB0, 0x02, 0xDD, 0x54, 0xD9, 0x55, 0x08, 0x31, 0xA8, 0xD3,
-    0x89, 0x3A, 0xF6, 0xA5, 0x69, 0xD5, 0x91, 0x8B, 0x13, 0xBF, 0x8C, 0x9E, 0x0C, 0x7A, 0xF0, 0xE2,
-    0x5F, 0x01, 0x1E, 0x0E, 0x9F, 0x34, 0xD3, 0x3A, 0xC8, 0xFA, 0xB9, 0x7C, 0xB5, 0x59, 0x1D, 0x8F,
-    0x44, 0xEE, 0xB8, 0x20, 0x3F, 0x57, 0x5C, 0xC7, 0x96, 0x4B, 0x2B, 0x98, 0x15, 0x30, 0x44, 0x13,
-    0xBF, 0x95, 0xB3, 0x87, 0x8C, 0x8B, 0x8C, 0xCD, 0x8D, 0xE2, 0xFE, 0x2F, 0xDF, 0x4D, 0x65, 0x9A,
-    0x7C, 0xDB, 0x17, 0x4F, 0x3B, 0x75, 0xE2, 0xF3, 0x0B, 0x0F, 0xA3, 0x12, 0xA0, 0x89, 0x00, 0x5A,
-    0x8C, 0x8C, 0x94, 0xE5, 0x80, 0xD5, 0x94, 0x14, 0xD1, 0x0D, 0x11, 0x1F, 0x08, 0xF1, 0x01, 0x73,
-    0xAC, 0x62, 0x62, 0xB3, 0x49, 0x03, 0xF2, 0x5A, 0xC5, 0x30, 0x4A, 0xF1, 0x7A, 0xD9, 0xE4, 0x8E,
-    0xAA, 0x2E, 0xB9, 0x20, 0x98, 0x3B, 0xDC, 0x4B, 0x4F, 0x7C, 0xE4, 0x2E, 0x09, 0x44, 0x43, 0x04,
-    0x86, 0x28, 0x29, 0x1B, 0x7A, 0x31, 0x1F, 0x45, 0xF8, 0xD7, 0x92, 0x10, 0xCF, 0x85, 0x88, 0x30,
-    0xA4, 0x44, 0x37, 0x0A, 0xF3, 0x03, 0x40, 0xDE, 0xC0, 0x48, 0x00, 0xA7, 0xCE, 0x2E, 0xBD, 0x7E,
-    0xF7, 0x33, 0x14, 0xD2, 0x4D, 0x96, 0xA5, 0x7B, 0xCD, 0x77, 0x6E, 0xF9, 0xAD, 0x48, 0xB7, 0xA9,
-    0xA4, 0xF3, 0xFA, 0xF4, 0x22, 0x14, 0xE7, 0x57, 0x93, 0x0C, 0xC0, 0xC6, 0xD8, 0x70, 0xA1, 0x31,
-    0x6C, 0x81, 0x39, 0x67, 0x76, 0x51, 0x1B, 0x61, 0x4E, 0x1B, 0x8A, 0xC2, 0x5D, 0x05, 0x60, 0x6D,
-    0xC8, 0x63, 0xAF, 0xC4, 0x9A, 0x3A, 0xAC, 0xFE, 0xA4, 0x2F, 0xDD, 0xF6, 0x4F, 0x22, 0x64, 0xCD,
-    0x15, 0x17, 0x1D, 0x54, 0x7A, 0x81, 0xB5, 0xFE, 0xCE, 0xEA, 0xCB, 0x5F, 0xE3, 0x67, 0xB3, 0x06,
-    0xFF, 0x20, 0xB0, 0x51, 0xD7, 0xF5, 0x8E, 0xE8, 0x29, 0x4D, 0xFD, 0xDD, 0x00, 0x1D, 0x3C, 0xC2,
-    0x68, 0xA9, 0x53, 0xC8, 0xD5, 0xB6, 0x17, 0xA5, 0x55, 0x26, 0x6F, 0x13, 0x8F, 0x7F, 0xAA, 0x43,
-    0xA8, 0xF7, 0x3C, 0x71, 0x7A, 0x4C, 0xB4, 0xD2, 0x58, 0x18, 0x8D, 0xE3, 0x43, 0xCC, 0x0A, 0x49,
-    0x23, 0xA4, 0x48, 0x79, 0xD4, 0x3C, 0x16, 0xE2, 0x3D, 0x7C, 0xD0, 0x4C, 0x87, 0xEB, 0x16, 0x70,
-    0x53, 0x15, 0x38, 0x3F, 0xCA, 0x74, 0x08, 0x8A, 0x16, 0x01, 0x34, 0x89, 0xC7, 0xEE, 0x2A, 0x93,
-    0x76, 0x49, 0xA8, 0xB5, 0x1B, 0x82, 0x12, 0xA8, 0x7A, 0xAD, 0x66, 0x93, 0x5E, 0xA8, 0x31, 0x49,
-    0x96, 0x14, 0x20, 0xDE, 0xE2, 0x2F, 0x9A, 0x0A, 0xB4, 0x19, 0xC6, 0x1A, 0xE1, 0x1A, 0x41, 0x9C,
-    0x53, 0xD5, 0xA0, 0x53, 0x84, 0x9A, 0x60, 0xE1, 0x30, 0x1A, 0x39, 0x51, 0x47, 0x50, 0x63, 0x61,
-    0x2C, 0x9F, 0x13, 0x98, 0x45, 0x01, 0x43, 0x85, 0xCC, 0x56, 0xC3, 0x64, 0xD8, 0x18, 0x11, 0xCF,
-    0x46, 0xCA, 0xF3, 0xF0, 0x70, 0xAE, 0xA7, 0x9F, 0x79, 0x4C, 0xF8, 0x36, 0x13, 0xD9, 0xA7, 0xD4,
-    0xCB, 0x38, 0x82, 0xF7, 0xB5, 0x0E, 0x29, 0x8F, 0x5D, 0xCE, 0xB6, 0xFC, 0x8E, 0x3D, 0xD9, 0xD5,
-    0xFD, 0x70, 0xF6, 0x19, 0xF7, 0x5B, 0x86, 0x6D, 0xC2, 0x56, 0xC0, 0xFA, 0xF8, 0xD5, 0x6E, 0x5F,
-    0xCA, 0x74, 0xA8, 0xFB, 0x6C, 0xA2, 0x7E, 0xE6, 0x37, 0x17, 0x14, 0x25, 0x48, 0xD3, 0x18, 0x8B,
-    0x6E, 0x96, 0xB4, 0xA1, 0x72, 0x87, 0x25, 0xA4, 0x01, 0xB7, 0x50, 0x04, 0x56, 0xB7, 0xA8, 0xC5,
-    0x0C, 0x6C, 0x71, 0x69, 0xF7, 0xB1, 0xB1, 0x5B, 0xD9, 0x57, 0x2F, 0x53, 0xBB, 0x2F, 0x85, 0xD8,
-    0xCA, 0xF0, 0x2E, 0x42, 0x7C, 0xED, 0x80, 0x60, 0x66, 0x0F, 0x18, 0xDA, 0xBF, 0x41, 0xC9, 0x30,
-    0xD0, 0x66, 0x90, 0x96, 0xB2, 0x7F, 0x73, 0x7F, 0xE7, 0x3A, 0x95, 0xC7, 0x6C, 0xCB, 0x6A, 0x68,
-    0xC3, 0x75, 0xEE, 0x3A, 0xD4, 0x9F, 0x60, 0xC4, 0x2B, 0xA7, 0x61, 0xDB, 0x92, 0x34, 0xF7, 0xB8,
-    0x28, 0x11, 0x7A, 0x3B, 0xB7, 0xA2, 0xFA, 0x75, 0x65, 0x36, 0x3E, 0x8E, 0xD7, 0xE1, 0x56, 0x5E,
-    0x85, 0xE2, 0xB5, 0xB7, 0x32, 0xC4, 0xCE, 0x16, 0x33, 0xBB, 0xA3, 0x8A, 0x19, 0x1C, 0x8A, 0x27,
-    0x1E, 0x96, 0x10, 0x2E, 0x45, 0xED, 0x56, 0xF6, 0xA5, 0x55, 0xDF, 0xEC, 0x7E, 0x79, 0x08, 0x07,
-    0xD9, 0x79, 0x9B, 0x22, 0x7D, 0x28, 0x20, 0xA4, 0x0F, 0x43, 0x5A, 0x8D, 0xA1, 0x81, 0xE6, 0x3E,
-    0x01, 0x4A, 0x48, 0xC2, 0x6C, 0x23, 0xF2, 0x8A, 0x9A, 0x9E, 0xD8, 0x24, 0x15, 0x2D, 0x4F, 0x89,
-    0x91, 0x0A, 0x47, 0xFA, 0xD1, 0x26, 0xA1, 0xAD, 0x35, 0x1E, 0xE3, 0xD6, 0x62, 0x06, 0x58, 0x09,
-    0x2D, 0x29, 0x61, 0xAF, 0xE3, 0xE2, 0x81, 0x3D, 0xCD, 0xB6, 0x16, 0x33, 0xC0, 0x4A, 0xC0, 0x49,
-    0x64, 0xD9, 0x95, 0x86, 0xFA, 0x9F, 0x3B, 0xE2, 0x33, 0xB5, 0xF4, 0xDD, 0x89, 0xAA, 0xE1, 0xBB,
-    0xF3, 0x1B, 0xD5, 0x59, 0x3D, 0x8F, 0xDC, 0xC6, 0x19, 0x1E, 0x92, 0xD6, 0x11, 0x31, 0x11, 0x30,
-    0xCD, 0x35, 0x52, 0xC1, 0x9F, 0xC0, 0x9F, 0x40, 0xC6, 0x42, 0xE0, 0xC2, 0xCD, 0x15, 0xA2, 0x0D,
-    0x44, 0x85, 0xDD, 0xE6, 0x10, 0x44, 0xFF, 0x20, 0xA4, 0xE3, 0x22, 0x85, 0x0A, 0xA9, 0x70, 0xAA,
-    0x14, 0x71, 0x21, 0x04, 0xD2, 0x06, 0x88, 0x5D, 0xA4, 0x8C, 0x8F, 0x94, 0x0D, 0xC4, 0x85, 0x8B,
-    0x30, 0x2A, 0xE2, 0xC2, 0x85, 0x89, 0x20, 0x81, 0x61, 0xB9, 0x10, 0x81, 0x30, 0x36, 0x4F, 0x22,
-    0x39, 0x79, 0x9E, 0xF7, 0x9D, 0xDD, 0xE5, 0x49, 0x67, 0xF8, 0x43, 0xB1, 0x8D, 0x2C, 0x76, 0x87,
-    0xE4, 0x70, 0x66, 0xDE, 0xEF, 0xCF, 0x2D, 0xAE, 0x18, 0x63, 0x0E, 0xAF, 0xDA, 0xC6, 0x98, 0x68,
-    0x29, 0x67, 0x3C, 0xD8, 0x77, 0x6D, 0x67, 0x4C, 0x3C, 0xA6, 0xD6, 0x18, 0xDF, 0xE6, 0x76, 0x30,
-    0x26, 0xEB, 0x63, 0x5B, 0x99, 0x70, 0x36, 0xE5, 0x64, 0x4C, 0xDD, 0x04, 0x16, 0x9F, 0xD1, 0xA4,
-    0xBC, 0x18, 0x8F, 0x63, 0x6F, 0x62, 0x8C, 0xD8, 0x5D, 0x8F, 0x78, 0x6F, 0x02, 0xDB, 0xC4, 0x23,
-    0xB6, 0xCD, 0x06, 0x67, 0x78, 0xB6, 0x4B, 0x79, 0xA0, 0x0D, 0x78, 0x7A, 0x3D, 0x94, 0x00, 0x15,
-    0xDA, 0xEB, 0x38, 0xD6, 0x64, 0x13, 0xDE, 0x03, 0xC8, 0x03, 0xBC, 0x37, 0x89, 0xC5, 0xE1, 0x00,
-    0x0F, 0x48, 0xC0, 0x85, 0x60, 0xB1, 0x80, 0xEF, 0x71, 0x5C, 0xCB, 0x4B, 0x32, 0x72, 0x34, 0xB7,
-    0x64, 0x3C, 0xBE, 0xC9, 0x45, 0x38, 0xB1, 0xE4, 0x06, 0x00, 0x6F, 0xBD, 0xD1, 0x03, 0x1E, 0x95,
-    0x29, 0xE5, 0x64, 0xAE, 0x4D, 0x79, 0x60, 0xC2, 0x21, 0xC6, 0x70, 0x7C, 0x63, 0xC2, 0x0E, 0x00,
-    0xC9, 0x38, 0x60, 0xC7, 0x14, 0xD8, 0x2A, 0x9B, 0xA2, 0x05, 0x6F, 0xF1, 0x3E, 0x19, 0xD3, 0x01,
-    0x43, 0xD6, 0x9B, 0x74, 0xC0, 0x90, 0xF5, 0x65, 0x67, 0xB2, 0xAE, 0xEE, 0x4C, 0xD9, 0x62, 0xB0,
-    0x4D, 0xDD, 0x79, 0xB6, 0xAA, 0xFB, 0xC0, 0x9A, 0xB2, 0x8F, 0x66, 0xD0, 0x56, 0x0A, 0x07, 0x3A,
-    0x52, 0x5E, 0x81, 0x06, 0x02, 0xBC, 0xC0, 0x5F, 0x51, 0x14, 0x47, 0x64, 0xCD, 0xB4, 0x1E, 0xEE,
-    0xD7, 0x93, 0xD0, 0xFB, 0x85, 0xC3, 0x85, 0x22, 0xCF, 0xA6, 0x84, 0x8B, 0x57, 0xC3, 0x66, 0xF3,
-    0x65, 0xDB, 0x0E, 0x39, 0x64, 0x5C, 0x7C, 0x76, 0x10, 0xEE, 0x29, 0x42, 0xA9, 0xFD, 0xA7, 0x37,
-    0x0A, 0x9F, 0x86, 0xAC, 0x12, 0xA1, 0x3D, 0x50, 0x71, 0x81, 0x0B, 0x81, 0x3D, 0xF5, 0x6A, 0x2B,
-    0x62, 0x33, 0xD8, 0x13, 0x2F, 0x94, 0x53, 0xE3, 0x5B, 0x8A, 0x10, 0x34, 0x0E, 0x14, 0x47, 0x17,
-    0x62, 0x41, 0xF6, 0x9E, 0x35, 0xA0, 0x35, 0xEA, 0xA1, 0x0A, 0xB3, 0xF1, 0x67, 0xB0, 0x01, 0x8B,
-    0xEA, 0x3C, 0x1B, 0xC0, 0xBA, 0xB4, 0x0D, 0xA0, 0x27, 0x4D, 0x34, 0x50, 0x51, 0x26, 0x7F, 0x36,
-    0xF2, 0xB6, 0xCC, 0xC1, 0xA9, 0x78, 0x4E, 0xB0, 0x6B, 0x31, 0xF6, 0x63, 0x42, 0x68, 0x23, 0xBB,
-    0x88, 0x44, 0x32, 0xB0, 0x0C, 0xDC, 0xF7, 0x21, 0x30, 0x23, 0xCA, 0x83, 0xB5, 0x33, 0x81, 0xFD,
-    0xBE, 0xC6, 0x1B, 0x12, 0x00, 0x91, 0xC7, 0x9F, 0x0B, 0x21, 0xC1, 0x14, 0x0A, 0x3D, 0x89, 0xF1,
-    0x36, 0x10, 0xBA, 0xC9, 0xCD, 0xD9, 0x4F, 0xDA, 0x70, 0x2C, 0xC7, 0xBD, 0xBE, 0x24, 0xA2, 0x2F,
-    0xB1, 0x88, 0x04, 0xBA, 0x2A, 0x2A, 0x26, 0x53, 0x56, 0x56, 0x95, 0x37, 0x38, 0x95, 0xBD, 0xC3,
-    0xA9, 0xA4, 0x27, 0x23, 0xA3, 0x21, 0xC6, 0x54, 0x30, 0xF9, 0x20, 0xD1, 0x5F, 0x84, 0xB7, 0x36,
-    0x17, 0xA4, 0x1A, 0x4E, 0x65, 0x1D, 0xA7, 0x12, 0xC1, 0x33, 0x9A, 0x70, 0x58, 0x1F, 0x2C, 0xE4,
-    0xBB, 0x6F, 0x09, 0xA5, 0x02, 0x23, 0x30, 0x55, 0xB6, 0x22, 0x8A, 0xD3, 0xA2, 0x78, 0xD9, 0xDE,
-    0x20, 0x01, 0xF6, 0xDF, 0x32, 0x4E, 0x32, 0x5A, 0xAA, 0x45, 0x51, 0xF8, 0x72, 0x3F, 0x0A, 0x81,
-    0xB0, 0x33, 0x79, 0x48, 0xED, 0x6F, 0x8A, 0x97, 0xCE, 0xD8, 0xD9, 0xB2, 0xB3, 0x33, 0x30, 0x01,
-    0x5A, 0xB6, 0xC0, 0x86, 0x0C, 0x95, 0x3B, 0x13, 0x14, 0x82, 0x6F, 0x6C, 0x67, 0x34, 0x6C, 0x2C,
-    0x70, 0x76, 0x46, 0xBE, 0x85, 0x6B, 0x3B, 0xF3, 0xCF, 0xB1, 0x33, 0x73, 0x58, 0x14, 0xB9, 0x39,
-    0x00, 0xA2, 0x0B, 0xAD, 0x07, 0x47, 0x88, 0xF5, 0x2F, 0x46, 0x90, 0xEF, 0x32, 0x67, 0xAD, 0x95,
-    0x1C, 0xD9, 0x99, 0xAD, 0xD5, 0x01, 0x35, 0x91, 0x13, 0x30, 0x16, 0x28, 0x24, 0xFF, 0x4A, 0x2D,
-    0x7B, 0x3E, 0x94, 0x71, 0xD6, 0x87, 0x0F, 0xF4, 0xA1, 0xEC, 0x75, 0x8F, 0x40, 0x14, 0xDB, 0x35,
-    0xBE, 0xE0, 0x67, 0x62, 0x9D, 0xAB, 0x67, 0x9D, 0x5B, 0x70, 0x4E, 0x1E, 0x2B, 0x06, 0xE2, 0x7F,
-    0x3A, 0xB9, 0x40, 0x1C, 0x97, 0xAC, 0x92, 0x67, 0xBC, 0x2B, 0xBA, 0x43, 0xB7, 0x13, 0x19, 0xAF,
-    0xB0, 0xAF, 0x1B, 0x73, 0x4D, 0x16, 0xD4, 0xB2, 0x5A, 0x04, 0xD0, 0xE9, 0x39, 0x01, 0xF4, 0x04,
-    0xF8, 0x83, 0xA3, 0x94, 0xF0, 0x42, 0x2C, 0x08, 0x3B, 0x6B, 0xA9, 0xFF, 0xD1, 0x24, 0x58, 0xE1,
-    0xB9, 0xEC, 0x8B, 0x97, 0x4F, 0x8B, 0x17, 0xD6, 0xC8, 0x3F, 0x46, 0x89, 0x11, 0x59, 0xF4, 0x1E,
-    0x55, 0x09, 0x9E, 0xA5, 0x27, 0x2B, 0x44, 0x16, 0xB6, 0x27, 0x32, 0x91, 0xFD, 0x68, 0x14, 0x56,
-    0x43, 0xDE, 0x57, 0x1C, 0xFB, 0x7C, 0xA5, 0xE4, 0x40, 0x29, 0x89, 0x94, 0x12, 0x65, 0x66, 0xB2,
-    0x66, 0xC9, 0x99, 0x8F, 0x0A, 0x23, 0x91, 0x3D, 0x91, 0x23, 0x41, 0x1E, 0x6A, 0x4B, 0x2E, 0x27,
-    0xCE, 0x67, 0x0A, 0xFD, 0xD9, 0xA0, 0xFC, 0xFF, 0x09, 0xDF, 0x94, 0x5F, 0xCA, 0x7F, 0x81, 0x9C,
-    0x0A, 0xAF, 0x8D, 0x98, 0x0F, 0xB6, 0x2E, 0x9B, 0xCD, 0xE6, 0x66, 0xAA, 0x88, 0x96, 0x8A, 0x68,
-    0xA9, 0x88, 0x5E, 0xE4, 0x1B, 0xD1, 0x0F, 0x41, 0xFD, 0xD4, 0x38, 0xEE, 0x46, 0xEA, 0x5C, 0x6A,
-    0x8D, 0x0C, 0xE2, 0x82, 0x04, 0x19, 0x28, 0xB2, 0x48, 0x66, 0x0D, 0x4C, 0xDC, 0x33, 0x80, 0xDD,
-    0xA5, 0x79, 0xC4, 0x73, 0xB9, 0xC2, 0x6A, 0xD1, 0x87, 0x8F, 0x15, 0x45, 0x5D, 0xD6, 0xEE, 0x84,
-    0xBA, 0x55, 0x10, 0xD5, 0x16, 0x55, 0x93, 0xD0, 0xB6, 0x40, 0xE7, 0xAA, 0x1D, 0x05, 0x03, 0xAB,
-    0x18, 0x54, 0xF2, 0x50, 0xF1, 0x61, 0xC9, 0x77, 0xEA, 0x91, 0x75, 0x7B, 0xF6, 0x7A, 0xD7, 0xFE,
-    0xC3, 0x49, 0xAE, 0xBE, 0xE9, 0x94, 0x5C, 0xB7, 0x36, 0xEE, 0x1C, 0x93, 0xF6, 0xBE, 0x15, 0xA7,
-    0x40, 0x77, 0x10, 0x33, 0x8E, 0xC0, 0x8D, 0x34, 0x84, 0x1D, 0xD0, 0x38, 0x1B, 0xB1, 0xCC, 0xE9,
-    0xF0, 0x45, 0x5B, 0x1C, 0xED, 0x58, 0xBA, 0x42, 0xDE, 0x51, 0x02, 0xE7, 0x02, 0x25, 0x01, 0x25,
-    0xF1, 0x40, 0x8D, 0xC2, 0x8F, 0xB6, 0x12, 0x4E, 0xC2, 0x8A, 0xAC, 0x23, 0xAF, 0x7C, 0x5B, 0x2E,
-    0x5E, 0x51, 0x40, 0x57, 0x1B, 0x65, 0x5F, 0xA4, 0xB1, 0xB6, 0x16, 0xFE, 0x3A, 0x05, 0x21, 0x2B,
-    0x7B, 0xE5, 0x47, 0xBE, 0xE7, 0xC7, 0xFE, 0xB3, 0x12, 0x06, 0x1C, 0x96, 0x4A, 0x4E, 0x1E, 0x26,
-    0x1C, 0x8D, 0xB3, 0x3B, 0xE5, 0x98, 0x1A, 0xA8, 0xEC, 0xF5, 0x94, 0xFF, 0xC9, 0x57, 0xE3, 0xBF,
-    0x5A, 0x78, 0x28, 0x02, 0x84, 0xE7, 0x3B, 0xDE, 0x6C, 0xFE, 0x60, 0x67, 0x65, 0x55, 0x25, 0x70,
-    0xDA, 0x48, 0x3D, 0x38, 0xDE, 0x6C, 0x72, 0x71, 0x21, 0xFC, 0xA8, 0xED, 0x6C, 0x35, 0xCF, 0x01,
-    0x41, 0x70, 0xB2, 0xA7, 0xC5, 0x8B, 0x12, 0x04, 0x54, 0x8C, 0xBB, 0x98, 0xF0, 0x7F, 0xF0, 0x98,
-    0x42, 0x61, 0xF0, 0x83, 0x4D, 0xB7, 0x99, 0x58, 0xD6, 0x1C, 0x2A, 0x81, 0x0D, 0x78, 0xD7, 0x90,
-    0xDB, 0xC5, 0x91, 0x18, 0x6A, 0x9F, 0x9D, 0x19, 0x21, 0x05, 0x71, 0xF5, 0xF1, 0x10, 0x42, 0x11,
-    0xA2, 0x21, 0xC0, 0x59, 0x41, 0x4F, 0x93, 0xF3, 0x6F, 0x8A, 0xF3, 0xA7, 0xCD, 0xEC, 0xA5, 0x14,
-    0x8A, 0xAA, 0xFB, 0x2A, 0x38, 0xF5, 0xD8, 0x6E, 0xD1, 0xB4, 0x37, 0x01, 0x31, 0x2B, 0x4F, 0x56,
-    0xAA, 0xF3, 0x8D, 0x97, 0xFD, 0x12, 0x1A, 0xF8, 0x4D, 0x8A, 0xCF, 0x13, 0x6D, 0x0B, 0x26, 0x6A,
-    0x70, 0x38, 0xD1, 0xFA, 0xE2, 0x29, 0x5B, 0x98, 0x68, 0x88, 0x58, 0x46, 0x91, 0xF9, 0xA0, 0x78,
-    0xA6, 0x3B, 0x03, 0x36, 0x22, 0xCA, 0xEB, 0x54, 0x21, 0x2E, 0x7B, 0x5F, 0xEC, 0x1B, 0x82, 0x3D,
-    0x82, 0xB2, 0x89, 0x87, 0x6B, 0x34, 0x6C, 0x88, 0x3D, 0x21, 0x71, 0xDA, 0xCF, 0x22, 0xA9, 0xDA,
-    0xCF, 0x52, 0x51, 0x3D, 0x51, 0xF6, 0xDE, 0xCD, 0xD6, 0xED, 0x76, 0x36, 0xD7, 0xD9, 0x70, 0x71,
-    0x1B, 0xE9, 0x4C, 0xFD, 0xED, 0xEC, 0xF9, 0x40, 0x0E, 0x6E, 0xE3, 0x86, 0xDE, 0x47, 0x36, 0x65,
-    0xBD, 0xDB, 0x20, 0xE6, 0xC0, 0x83, 0x83, 0xED, 0xB4, 0xC0, 0xDC, 0x4F, 0x73, 0x3F, 0xF1, 0x52,
-    0x38, 0x93, 0x3B, 0x4D, 0xA6, 0x25, 0xF6, 0x49, 0x32, 0x3C, 0xAF, 0x8F, 0xDC, 0x4D, 0x7F, 0x01,
-    0x24, 0xFF, 0x8E, 0xF1, 0x89, 0x0C, 0x12, 0x2C, 0x13, 0x60, 0x6D, 0x95, 0x55, 0xAF, 0xA4, 0x97,
-    0xC7, 0xF4, 0xB2, 0xCD, 0x5E, 0x9E, 0xC8, 0x52, 0x5A, 0x73, 0x0B, 0x23, 0x6C, 0x21, 0xCB, 0x11,
-    0x3F, 0x3B, 0x86, 0xC2, 0xED, 0xCF, 0x1F, 0xDA, 0x77, 0xC7, 0xEC, 0xD7, 0xC3, 0x0F, 0x83, 0x31,
-    0xDA, 0x6F, 0x97, 0x1B, 0x8F, 0x89, 0x4C, 0x85, 0x18, 0xE5, 0x73, 0xE1, 0xBF, 0xEA, 0xF7, 0x07,
-    0x7F, 0xB6, 0x26, 0x79, 0xD0, 0x7B, 0x0B, 0x2E, 0x9F, 0x8E, 0xC1, 0x5C, 0x3E, 0x64, 0x0E, 0x01,
-    0x45, 0x9A, 0xCD, 0xA5, 0xD9, 0x5C, 0x38, 0xCA, 0xC6, 0x72, 0xAA, 0xA7, 0x72, 0xCA, 0x86, 0x0B,
-    0x9A, 0x24, 0x1D, 0xAB, 0xAB, 0x6B, 0xF6, 0xF1, 0x24, 0x12, 0x55, 0x09, 0x9C, 0xD3, 0x55, 0x77,
-    0x2C, 0x7E, 0x38, 0x53, 0xCF, 0xAA, 0xE1, 0x5A, 0x03, 0xF0, 0xBC, 0x5A, 0x54, 0x6A, 0x64, 0x68,
-    0xBD, 0xE2, 0x08, 0x8B, 0x7C, 0x40, 0x0C, 0xE8, 0xE0, 0x2B, 0x6F, 0x86, 0xA2, 0x42, 0x71, 0xCD,
-    0xC1, 0x9B, 0x13, 0x01, 0x41, 0xF3, 0x90, 0xF0, 0x81, 0x9F, 0x51, 0x4F, 0xF6, 0x10, 0x10, 0xF8,
-    0xBA, 0x08, 0x9B, 0x6A, 0x72, 0x6C, 0x24, 0x36, 0x81, 0x8D, 0xA9, 0xCA, 0xF5, 0x7B, 0x14, 0x42,
-    0xF2, 0x19, 0xB1, 0x09, 0x16, 0xD1, 0xD6, 0x5A, 0x34, 0x37, 0x71, 0x5A, 0x2C, 0xD8, 0xD4, 0xC3,
-    0x3E, 0x4E, 0xB8, 0x70, 0x58, 0xEC, 0x5C, 0xDD, 0x89, 0x31, 0x6F, 0xA5, 0x80, 0xF9, 0x8E, 0xB5,
-    0xCF, 0x59, 0x58, 0x5A, 0x32, 0xDA, 0x57, 0x11, 0x0F, 0x27, 0x24, 0x43, 0x31, 0x32, 0x15, 0x30,
-    0x12, 0x11, 0x1C, 0x81, 0x60, 0x0A, 0x96, 0xC8, 0x42, 0xE9, 0xED, 0x8D, 0x05, 0x79, 0x61, 0x3C,
-    0x91, 0xB3, 0xFD, 0xC1, 0x1B, 0x26, 0x14, 0xDE, 0x98, 0x3F, 0xE6, 0xE6, 0x17, 0x79, 0xC8, 0x54,
-    0x17, 0x49, 0xC1, 0x98, 0xD0, 0x00, 0xE0, 0x0A, 0xA7, 0xEC, 0xAE, 0xB5, 0xE1, 0x54, 0x22, 0x33,
-    0xF7, 0xA7, 0x9A, 0x41, 0x00, 0x63, 0x32, 0xF8, 0x98, 0x29, 0x31, 0x53, 0xFE, 0xCD, 0xDA, 0xE7,
-    0x91, 0x6D, 0xC3, 0x24, 0x86, 0x94, 0xD6, 0x02, 0x67, 0x8D, 0x88, 0xD1, 0x98, 0x3B, 0x06, 0xDF,
-    0x43, 0x11, 0x41, 0xD9, 0x7C, 0xAF, 0xE3, 0x7D, 0x58, 0xED, 0x9D, 0x72, 0x1F, 0x8F, 0xCE, 0x8C,
-    0xEB, 0x90, 0xF1, 0x27, 0x19, 0x3D, 0x0D, 0x2E, 0x2E, 0x34, 0xBB, 0xD4, 0x4B, 0x23, 0x84, 0x13,
-    0x83, 0x67, 0xBB, 0x2F, 0x5D, 0xD1, 0x3E, 0xCD, 0x8A, 0x5E, 0x57, 0x3C, 0x04, 0xE2, 0x1B, 0x4D,
-    0x6B, 0x6C, 0xAC, 0x17, 0x4D, 0x9A, 0xAD, 0x8B, 0x1E, 0x85, 0x06, 0xA7, 0xAF, 0xFA, 0xF9, 0xEC,
-    0x56, 0x91, 0xC3, 0xE7, 0x66, 0x8F, 0xA6, 0x78, 0xB1, 0x81, 0xAD, 0x1B, 0x14, 0x41, 0xDF, 0xD9,
-    0xC3, 0x67, 0xB7, 0x9F, 0xBD, 0xF5, 0x58, 0xE2, 0x11, 0x29, 0xD5, 0xEA, 0xCB, 0xB7, 0xEA, 0xAE,
-    0x9E, 0x5A, 0x38, 0x1C, 0x49, 0xD9, 0x62, 0xEC, 0x47, 0x83, 0xF8, 0x2A, 0x2B, 0x46, 0x23, 0x3E,
-    0xA9, 0xEC, 0xC4, 0xBF, 0x4E, 0x62, 0x0A, 0xB6, 0x49, 0x06, 0xF1, 0x65, 0x52, 0xB1, 0x89, 0xD3,
-    0xC2, 0x5B, 0x7C, 0xE3, 0x79, 0x9B, 0xB7, 0xA6, 0x23, 0xBF, 0xB8, 0xE3, 0x33, 0xA6, 0x4B, 0x31,
-    0x4F, 0x66, 0x21, 0x5A, 0xC3, 0xE1, 0x6D, 0x3A, 0x6A, 0xD9, 0x4F, 0x69, 0x68, 0x2A, 0x58, 0xF6,
-    0xA2, 0xBE, 0x87, 0x2F, 0x71, 0x2E, 0x5A, 0x24, 0x8B, 0xB4, 0xF7, 0x28, 0xB0, 0x84, 0xB5, 0x32,
-    0xBD, 0x1F, 0xDD, 0x5E, 0xD6, 0xB3, 0x36, 0x44, 0x79, 0x27, 0x95, 0x62, 0x43, 0x37, 0x0B, 0x3B,
-    0x8D, 0x27, 0xF1, 0x8E, 0x58, 0x00, 0x47, 0x09, 0x20, 0xF4, 0x99, 0xB8, 0x03, 0x2C, 0x2C, 0x88,
-    0x25, 0xE2, 0x88, 0xF7, 0xAC, 0x5B, 0x0D, 0x03, 0xCE, 0xA7, 0x12, 0x17, 0xCF, 0xDE, 0x18, 0x25,
-    0x72, 0x89, 0x1B, 0xA8, 0xC5, 0x01, 0x04, 0xAA, 0xA9, 0x9A, 0x43, 0x7A, 0x76, 0x5C, 0x25, 0x2F,
-    0x2E, 0x93, 0x5C, 0x69, 0xF2, 0x35, 0x04, 0x64, 0xA6, 0xA7, 0xAD, 0x94, 0x05, 0x95, 0x26, 0x4C,
-    0xF6, 0x14, 0xF9, 0x45, 0xCA, 0x4C, 0xFE, 0x35, 0xF2, 0x60, 0x22, 0x0B, 0xEA, 0x0F, 0xB0, 0x2B,
-    0x9C, 0x69, 0x27, 0xD9, 0x87, 0xF4, 0x52, 0x0B, 0x73, 0xF4, 0xEC, 0xD3, 0xFF, 0xFD, 0x2D, 0x39,
-    0x79, 0xF8, 0xC2, 0xB7, 0x0A, 0x42, 0xA8, 0x50, 0x82, 0xC8, 0x52, 0x88, 0x32, 0x87, 0x20, 0x12,
-    0x66, 0xE2, 0xB9, 0xC4, 0xF0, 0x40, 0x02, 0x36, 0x33, 0x91, 0x9C, 0x8C, 0x81, 0x1C, 0x0F, 0xEE,
-    0x08, 0xBF, 0x2E, 0xDE, 0x12, 0xFD, 0xEB, 0x45, 0xE3, 0x58, 0xC7, 0x52, 0x09, 0xB3, 0x11, 0x67,
-    0x47, 0xD6, 0x97, 0x1C, 0xE7, 0x99, 0xAD, 0x89, 0x8A, 0x30, 0xBE, 0x97, 0xDB, 0x6E, 0x97, 0xCC,
-    0xD0, 0x73, 0xF4, 0x0C, 0x05, 0xA8, 0xDE, 0x1B, 0xA3, 0x7D, 0x81, 0x92, 0xFA, 0xE1, 0x93, 0x32,
-    0x54, 0x46, 0x1A, 0xF7, 0xB6, 0xA1, 0xAB, 0x57, 0xEB, 0xCA, 0x45, 0x71, 0x86, 0x95, 0xB7, 0x51,
-    0xF7, 0xF8, 0x8D, 0x3F, 0x87, 0x3C, 0x30, 0x4F, 0x24, 0xB8, 0x5D, 0x26, 0x7A, 0x88, 0xB9, 0x0B,
-    0x59, 0x28, 0xAD, 0xB3, 0x7A, 0x4A, 0xE5, 0x4D, 0xFE, 0x33, 0x16, 0x6B, 0x79, 0x34, 0xD0, 0xB1,
-    0x4A, 0x6D, 0xFD, 0xD8, 0xB2, 0x6C, 0x96, 0xD4, 0x8E, 0xF8, 0xA5, 0xDD, 0x53, 0x21, 0x74, 0x41,
-    0xF3, 0xFE, 0xE5, 0x8C, 0x53, 0x59, 0x93, 0xAD, 0x6F, 0x2E, 0x0A, 0x7B, 0x92, 0x21, 0x9B, 0xCA,
-    0xB9, 0x9C, 0xB3, 0x29, 0x79, 0x02, 0xEA, 0xC1, 0x1B, 0x78, 0xC7, 0xB7, 0x53, 0x3A, 0x78, 0xE6,
-    0xDB, 0x47, 0xFD, 0x6B, 0x71, 0x52, 0x76, 0xE4, 0x0C, 0x41, 0x41, 0x95, 0xA1, 0xC2, 0xC9, 0x5E,
-    0x83, 0x42, 0xFF, 0x76, 0x49, 0x4F, 0x11, 0x13, 0x7A, 0x4B, 0xF5, 0x36, 0x6F, 0x41, 0x07, 0xDA,
-    0x33, 0x2D, 0xA2, 0x9F, 0xE6, 0xC6, 0xC7, 0xAB, 0xCE, 0xA4, 0xD0, 0x91, 0xD9, 0x5F, 0x24, 0x1D,
-    0x1F, 0x6C, 0x05, 0x27, 0xF1, 0x2A, 0x4A, 0x7E, 0x3B, 0x78, 0xF0, 0x4B, 0x77, 0x9E, 0xC4, 0x2C,
-    0x94, 0x18, 0xA9, 0xAB, 0x25, 0xD6, 0xB4, 0x0C, 0x49, 0x9B, 0x27, 0xD6, 0x49, 0xFF, 0xD3, 0x3E,
-    0xBF, 0x5A, 0x2D, 0xE5, 0x4E, 0x6E, 0x9E, 0x51, 0x89, 0x84, 0x0D, 0xEC, 0x2D, 0x43, 0xC6, 0xFC,
-    0x77, 0x9B, 0x3D, 0x42, 0x26, 0x07, 0x76, 0xDA, 0x77, 0x99, 0xEA, 0x7B, 0x95, 0x39, 0xCE, 0xC9,
-    0x00, 0x76, 0x9A, 0xC2, 0x96, 0xAB, 0xFE, 0xCA, 0x6A, 0x2B, 0x43, 0xC1, 0x35, 0x2C, 0x38, 0xF6,
-    0x9D, 0x9E, 0x4D, 0x09, 0x2E, 0xF9, 0x11, 0x01, 0x5D, 0xFE, 0x04, 0x3C, 0xF8, 0x73, 0xB6, 0xEB,
-    0x1C, 0x4D, 0xEC, 0x78, 0x2C, 0xB9, 0x77, 0xBC, 0x79, 0xFD, 0x9C, 0x1E, 0x41, 0x6D, 0x3F, 0xD1,
-    0x06, 0xC9, 0x6B, 0x56, 0x7B, 0x82, 0x0F, 0xB1, 0x0D, 0x0B, 0xBD, 0x9F, 0xEF, 0xD6, 0x48, 0xA6,
-    0x95, 0xBB, 0x6C, 0xB0, 0x36, 0xBB, 0xC4, 0x9E, 0x37, 0x7F, 0xD9, 0xBC, 0xF9, 0xF0, 0xB6, 0xF1,
-    0x27, 0x97, 0x8B, 0x22, 0x2F, 0x8C, 0xCE, 0x24, 0xFF, 0xC7, 0x28, 0x19, 0x2A, 0x49, 0xE5, 0xA8,
-    0x5F, 0xCF, 0x9E, 0xC3, 0xB9, 0x72, 0x57, 0xE3, 0xCD, 0xAC, 0x1D, 0x36, 0xD5, 0xE3, 0x28, 0xAE,
-    0x16, 0xC8, 0xED, 0x3D, 0xAE, 0xBA, 0x7D, 0xBE, 0x18, 0x56, 0x6B, 0x1D, 0x77, 0x55, 0xE7, 0xC3,
-    0x5E, 0xEB, 0x50, 0x4D, 0xAA, 0x47, 0x69, 0x67, 0x6D, 0x7F, 0x92, 0x6D, 0x84, 0x54, 0xA3, 0xE4,
-    0xDC, 0xC1, 0x15, 0x27, 0x26, 0x25, 0x18, 0xE1, 0xF0, 0x01, 0x11, 0x38, 0xC3, 0x06, 0x75, 0x13,
-    0x54, 0xF0, 0xB4, 0x73, 0x7D, 0xE8, 0xF4, 0xDC, 0xA1, 0xD1, 0x42, 0x8B, 0xD9, 0x5F, 0x24, 0x9D,
-    0x9C, 0x4E, 0xC0, 0xF0, 0x17, 0x10, 0x5C, 0xCA, 0x94, 0xA7, 0x5D, 0x13, 0x76, 0x6E, 0x41, 0xE5,
-    0x39, 0x54, 0x12, 0xDC, 0x4A, 0x91, 0x51, 0x49, 0xF0, 0x4E, 0xD9, 0x93, 0x65, 0x54, 0x9D, 0x05,
-    0x1E, 0x2A, 0x4E, 0x1F, 0xEA, 0xEF, 0x4B, 0x0F, 0x9E, 0x2D, 0xDD, 0x4A, 0xDA, 0xCF, 0xE5, 0xA8,
-    0x35, 0x79, 0x39, 0xB3, 0x11, 0x22, 0xA8, 0xF9, 0xEA, 0x1B, 0xE7, 0x1D, 0xAE, 0x8F, 0x4F, 0xC8,
-    0xB9, 0x3B, 0x38, 0x26, 0x53, 0x96, 0x9A, 0x03, 0xFC, 0x5E, 0x79, 0xC6, 0xE9, 0x48, 0x8C, 0x41,
-    0xD3, 0x10, 0x57, 0x90, 0xD9, 0x8A, 0x3D, 0x33, 0x61, 0x78, 0x29, 0x00, 0x6D, 0xC5, 0xFB, 0x1D,
-    0x42, 0x3B, 0x8C, 0xE8, 0x39, 0x52, 0xF1, 0x14, 0xAD, 0xF4, 0x77, 0x65, 0xE1, 0xB0, 0xDB, 0xE8,
-    0xF6, 0x6D, 0x1F, 0xB7, 0xE7, 0x02, 0x13, 0x5F, 0x0A, 0x36, 0x30, 0x95, 0x48, 0xFD, 0xC0, 0xB0,
-    0x76, 0x7D, 0x9A, 0xE6, 0x86, 0xB6, 0x02, 0xD7, 0x2D, 0x8C, 0xAD, 0xAB, 0xEC, 0x9E, 0x78, 0xF3,
-    0x75, 0x9B, 0x1B, 0xAB, 0x96, 0x63, 0xD9, 0xAC, 0xBA, 0x31, 0x8A, 0x81, 0xF6, 0x69, 0xA4, 0x10,
-    0x5D, 0xF7, 0x1F, 0xE5, 0xA0, 0x4E, 0x9B, 0x6A, 0x91, 0x3D, 0x7D, 0xC9, 0x16, 0x3F, 0x06, 0x5F,
-    0xB4, 0xCF, 0x1C, 0x4E, 0x52, 0xBF, 0x4B, 0xCB, 0x91, 0x9D, 0xA2, 0x90, 0xFD, 0x48, 0x10, 0x2C,
-    0x7D, 0x68, 0x3A, 0x94, 0x59, 0xCA, 0xF9, 0x9A, 0xF1, 0x4F, 0x5B, 0x8E, 0xA3, 0x27, 0x7F, 0xD5,
-    0x34, 0x8C, 0xFD, 0xB1, 0xBD, 0xBC, 0x68, 0x2F, 0xEB, 0xFE, 0xE6, 0x8E, 0xB6, 0x9B, 0xBB, 0xD0,
-    0xAE, 0xDA, 0xB7, 0x62, 0x51, 0x3C, 0x42, 0xF9, 0xE0, 0x90, 0x7D, 0xB2, 0xE5, 0x78, 0xE8, 0x68,
-    0xBB, 0x70, 0x65, 0xBD, 0x62, 0xD0, 0xCE, 0xDB, 0x2A, 0x93, 0x0D, 0x27, 0x15, 0x46, 0xAB, 0xE7,
-    0x0F, 0x8E, 0x36, 0xE5, 0x58, 0x73, 0x58, 0x5C, 0x5D, 0xA4, 0x65, 0x55, 0xDF, 0xA5, 0x49, 0xC6,
-    0x63, 0x20, 0x69, 0xA0, 0x78, 0x7C, 0xF0, 0x06, 0xBB, 0xC0, 0x1B, 0x46, 0x27, 0xA0, 0x53, 0x6B,
-    0x6B, 0x4D, 0x3B, 0xA0, 0x78, 0xC3, 0x76, 0xEC, 0xBC, 0x6A, 0xC7, 0x42, 0xBF, 0x81, 0x6E, 0x6A,
-    0x0F, 0x36, 0xF6, 0x3E, 0x2A, 0x69, 0xED, 0x57, 0x44, 0x5A, 0xCA, 0x28, 0x5B, 0x49, 0xDA, 0x2D,
-    0x57, 0xA9, 0x6B, 0x07, 0x61, 0x8F, 0xEC, 0x13, 0xA9, 0xA2, 0x14, 0x92, 0x74, 0x25, 0x97, 0xC4,
-    0xF8, 0x44, 0x18, 0x8D, 0xFE, 0x2F, 0xA2, 0x85, 0x47, 0x53, 0x2F, 0xFB, 0x94, 0xE1, 0x4C, 0xB7,
-    0x71, 0xDB, 0xDC, 0x1E, 0xD6, 0x0F, 0xE7, 0x75, 0xAD, 0x97, 0x23, 0xFD, 0x0B, 0x62, 0xD7, 0x4B,
-    0xD4, 0x24, 0x0C, 0x8B, 0x2E, 0x39, 0x8B, 0x5F, 0xC5, 0x70, 0x69, 0x92, 0xE5, 0xFA, 0xA7, 0x81,
-    0xD6, 0x3C, 0xCD, 0x99, 0x07, 0x78, 0xBE, 0x23, 0x3D, 0x6D, 0xC9, 0xB5, 0x83, 0x5D, 0xE9, 0xD1,
-    0xFA, 0x30, 0xA9, 0x75, 0x74, 0xEB, 0xA2, 0x6A, 0x8D, 0x53, 0xB2, 0x36, 0x86, 0xE4, 0x8B, 0x5A,
-    0xA8, 0x57, 0xD9, 0xD3, 0xDF, 0xF1, 0xC0, 0x75, 0xCA, 0x73, 0x07, 0xF4, 0x6C, 0xE8, 0x16, 0x7C,
-    0x15, 0x03, 0x6D, 0x6C, 0xD9, 0x33, 0x0F, 0x74, 0x23, 0x27, 0x37, 0xB5, 0xA8, 0x5F, 0x9C, 0xE1,
-    0x02, 0xB9, 0xEC, 0xF4, 0xE4, 0x9A, 0xB4, 0x52, 0x4F, 0xA0, 0xB5, 0x08, 0x3D, 0x27, 0x26, 0x6B,
-    0xA2, 0x1E, 0x97, 0xB8, 0x83, 0xC1, 0x9F, 0x98, 0xA0, 0x4F, 0x2B, 0x5C, 0xFC, 0x31, 0x93, 0xEA,
-    0x7E, 0x2A, 0xE5, 0x32, 0x9F, 0xC8, 0xE5, 0xA4, 0xDE, 0x6C, 0xEC, 0x66, 0xB3, 0x68, 0x11, 0xB8,
-    0xBD, 0x9C, 0x14, 0x05, 0xBF, 0x6E, 0x89, 0xDB, 0x20, 0xDB, 0xBD, 0xC9, 0x1D, 0x16, 0xB7, 0xB8,
-    0x84, 0xBD, 0x03, 0xE4, 0xC0, 0x42, 0xCF, 0x4E, 0xA8, 0x1E, 0x0E, 0x25, 0x87, 0xA0, 0x43, 0xD7,
-    0x78, 0x6A, 0xDD, 0xE7, 0xD2, 0x30, 0x8A, 0x9B, 0x80, 0xE0, 0x95, 0x06, 0xA3, 0x34, 0x18, 0xA5,
-    0xC1, 0x28, 0x0D, 0x46, 0x69, 0x30, 0x4A, 0x83, 0x51, 0x1A, 0x8C, 0xD2, 0xB0, 0x39, 0x8F, 0x86,
-    0x42, 0x69, 0x30, 0x4A, 0x03, 0x37, 0x64, 0x92, 0xC2, 0x4D, 0xEE, 0xB0, 0xB8, 0x95, 0x88, 0xE7,
-    0x00, 0x39, 0xB0, 0x46, 0xFE, 0x7C, 0x24, 0x0D, 0xE6, 0x6B, 0xD3, 0x90, 0xEC, 0x69, 0x10, 0x13,
-    0x6D, 0x22, 0x39, 0xAC, 0x8B, 0x1F, 0xC0, 0xD1, 0x3C, 0xEA, 0xD3, 0xEB, 0x20, 0xF3, 0xDE, 0x98,
-    0xF9, 0xF0, 0x57, 0x39, 0x68, 0xA8, 0x7F, 0x35, 0x93, 0x86, 0xF4, 0xD3, 0xC1, 0x9C, 0xBC, 0x8D,
-    0x63, 0x5A, 0xF3, 0xCB, 0xB7, 0x25, 0x22, 0xC8, 0xA5, 0xE2, 0x85, 0xEA, 0x07, 0x1A, 0xD2, 0x0F,
-    0x47, 0xD2, 0x50, 0x3F, 0xB7, 0x80, 0x06, 0x24, 0xE3, 0xF5, 0xAB, 0x53, 0x7A, 0x7D, 0x30, 0xE9,
-    0x3F, 0xC6, 0x98, 0x7E, 0xE2, 0x51, 0x8F, 0xBA, 0x84, 0x80, 0x1C, 0x58, 0x23, 0x4F, 0x4F, 0x4D,
-    0xC3, 0xA4, 0x34, 0x48, 0xDC, 0x14, 0x39, 0x90, 0x06, 0x46, 0xA3, 0x7B, 0x22, 0x07, 0xA1, 0x81,
-    0xA5, 0x01, 0xE5, 0x80, 0xCC, 0x96, 0xBC, 0x4E, 0x85, 0x06, 0xBC, 0x12, 0x1A, 0xE0, 0x1C, 0x48,
-    0x03, 0xAC, 0x9A, 0x34, 0xB4, 0x22, 0x07, 0x36, 0xAD, 0x84, 0x06, 0xCA, 0x81, 0x7F, 0xA6, 0xF9,
-    0x42, 0x03, 0xE5, 0x20, 0x1D, 0x40, 0xA5, 0x21, 0xFB, 0x6A, 0x34, 0x88, 0x4F, 0x0D, 0xC5, 0x07,
-    0x89, 0xFB, 0xFD, 0x8E, 0x6E, 0x8F, 0x37, 0xF6, 0xE1, 0xE6, 0x77, 0xE7, 0xF6, 0x45, 0xFA, 0xB3,
-    0x5D, 0x43, 0x0F, 0x0E, 0x06, 0xFE, 0xFE, 0x0A, 0xBD, 0x04, 0x8A, 0xEB, 0x6C, 0x40, 0x32, 0xCE,
-    0x3F, 0x3D, 0x91, 0x71, 0xF6, 0x2C, 0x25, 0x6A, 0x66, 0xE7, 0x89, 0x05, 0x79, 0x77, 0xB1, 0x82,
-    0x7F, 0x8D, 0x0E, 0xD8, 0xA2, 0xBB, 0xFE, 0x0B, 0x4D, 0x90, 0xB1, 0x11, 0x83, 0x30, 0x10, 0x04,
-    0x0F, 0x12, 0x02, 0x02, 0x27, 0xCE, 0x95, 0x3A, 0xA3, 0x04, 0xA8, 0xC2, 0xDD, 0x78, 0xAC, 0x2E,
-    0x5C, 0x83, 0x9B, 0x30, 0x94, 0x80, 0x3B, 0x50, 0xEE, 0xC4, 0x01, 0x01, 0x01, 0xD2, 0xF9, 0x4F,
-    0x82, 0x19, 0x2B, 0x78, 0xED, 0xCC, 0xAF, 0x4E, 0xD2, 0x03, 0x7F, 0xEB, 0x72, 0xC0, 0x6B, 0xDF,
-    0x6B, 0xFA, 0x02, 0x2D, 0x43, 0x81, 0x8E, 0xEB, 0xAE, 0x5C, 0x53, 0x51, 0x02, 0xBA, 0x2C, 0xB5,
-    0x13, 0x9A, 0x2C, 0x75, 0x13, 0xAA, 0x2C, 0x8D, 0xEF, 0x67, 0x4E, 0xAA, 0x49, 0xCE, 0xBD, 0x57,
-    0x0A, 0xF9, 0xED, 0x82, 0x52, 0xC8, 0xD5, 0x99, 0x34, 0x1A, 0x6C, 0xA7, 0x94, 0x15, 0x03, 0x7A,
-    0x29, 0x5C, 0x1C, 0x83, 0x94, 0x34, 0x38, 0xAE, 0x77, 0x03, 0x8F, 0x9E, 0xD1, 0x51, 0x77, 0x5B,
-    0xB7, 0x11, 0x58, 0x99, 0x2B, 0x81, 0x45, 0x0C, 0xB8, 0x73, 0xB3, 0x93, 0x11, 0x70, 0x4A, 0xE1,
-    0x02, 0xEB, 0x47, 0x83, 0x19, 0xA8, 0x98, 0x9C, 0x14, 0x40, 0x49, 0x51, 0x0F, 0x73, 0xFC, 0x48,
-    0x91, 0x04, 0x29, 0x26, 0x25, 0x64, 0xC5, 0x24, 0xC4, 0xF2, 0x41, 0xF7, 0x58, 0x0A, 0x34, 0x45,
-    0x51, 0xD2, 0xB0, 0xCF, 0xE5, 0x76, 0x0C, 0xEA, 0xAC, 0xF2, 0x03,
+static const uint8_t bookerly_18_boldBitmaps[42323] = {
+    0xE5, 0x9C, 0xBD, 0xB3, 0x25, 0xC7, 0x79, 0xDE, 0x7F, 0x33, 0xC3, 0x7B, 0xC7, 0xE6, 0xB8, 0x6A,
+    0x18, 0x60, 0x65, 0x71, 0x51, 0xA5, 0x51, 0xA0, 0x40, 0xA6, 0xAA, 0xD8, 0xFE, 0x07, 0xAC, 0x1E,
+    0x72, 0x03, 0x06, 0x08, 0xB8, 0x76, 0xED, 0xA1, 0xAA, 0xC8, 0x80, 0x0A, 0xE4, 0x80, 0x60, 0xD9,
+    0xEB, 0xD0, 0xAE, 0xB2, 0xD9, 0x23, 0x22, 0x70, 0xC0, 0x40, 0xD7, 0x2E, 0xCA, 0xAA, 0xB2, 0x03,
+    0x31, 0x00, 0xAB, 0x80, 0xCB, 0x60, 0x1D, 0x30, 0x05, 0xBB, 0x89, 0xAD, 0x32, 0x83, 0x0D, 0x30,
+    0x24, 0xAC, 0x42, 0x80, 0x00, 0x63, 0x12, 0x2C, 0x5A, 0x40, 0xC0, 0x26, 0x3C, 0x10, 0x67, 0x81,
+    0x9E, 0x79, 0x1C, 0xF4, 0x9C, 0xB3, 0x77, 0xC1, 0x05, 0x05, 0x8A, 0x90, 0x28, 0x42, 0x67, 0xEF,
+    0xCE, 0x99, 0x8F, 0x33, 0x33, 0xFD, 0xF1, 0xF6, 0xFB, 0xF1, 0xBC, 0x4F, 0x77, 0x71, 0xAB, 0x4B,
+    0x76, 0xB1, 0x8B, 0x9B, 0xDD, 0xEC, 0x62, 0xFE, 0x67, 0xAF, 0xFC, 0x33, 0xD1, 0xC4, 0x2E, 0x76,
+    0xB1, 0x8D, 0xFF, 0x18, 0x80, 0x66, 0x31, 0xAB, 0x5D, 0xED, 0x6A, 0xD2, 0xF9, 0x45, 0x71, 0xB3,
+    0xF8, 0x84, 0xEA, 0x64, 0xA3, 0xBE, 0xA3, 0x36, 0xB9, 0xA8, 0xEF, 0x6C, 0x6D, 0xB2, 0x93, 0xEE,
+    0x6E, 0x6D, 0xB2, 0xA3, 0x9E, 0x5A, 0xDB, 0xC5, 0x8E, 0xFE, 0xA9, 0xB5, 0x99, 0x3F, 0xDE, 0xFF,
+    0x07, 0x00, 0x78, 0xB2, 0xFF, 0x58, 0x0F, 0xEA, 0xFD, 0x00, 0x42, 0x3D, 0x85, 0x10, 0x94, 0x5B,
+    0x21, 0xA8, 0xD6, 0x72, 0xA3, 0x92, 0xA4, 0xB5, 0x91, 0xA4, 0xD4, 0x4A, 0x52, 0x3A, 0xFB, 0xFC,
+    0xFD, 0xCF, 0xDD, 0xBF, 0x45, 0x1B, 0x9B, 0x19, 0xBA, 0xD8, 0x46, 0x30, 0x53, 0x1B, 0xC1, 0x8E,
+    0xDD, 0xC4, 0x35, 0xF7, 0x17, 0xEE, 0x87, 0xBD, 0x93, 0xA4, 0xD1, 0x4B, 0x52, 0xF0, 0x92, 0x34,
+    0x20, 0xFC, 0x83, 0xC7, 0x23, 0xA8, 0xD6, 0x62, 0x83, 0x2A, 0x95, 0x2B, 0x94, 0xCF, 0x14, 0xCF,
+    0x70, 0xFC, 0xD8, 0xFE, 0xD1, 0x9B, 0x5A, 0x1B, 0x38, 0x69, 0x2C, 0x24, 0xC5, 0x4A, 0xEE, 0xF6,
+    0xD2, 0x24, 0xDB, 0xA4, 0x76, 0xB6, 0xD5, 0xD2, 0xCE, 0xB6, 0x8A, 0xED, 0x62, 0x8B, 0xBE, 0x5D,
+    0x2D, 0x34, 0xDA, 0xA0, 0x92, 0x7A, 0x0A, 0x69, 0x06, 0x27, 0xF5, 0x34, 0xD2, 0x08, 0x5E, 0x11,
+    0x9C, 0x96, 0xF3, 0xFE, 0x3F, 0x99, 0xD4, 0x0D, 0xCF, 0xB5, 0xC9, 0x0E, 0xCF, 0x35, 0xC9, 0x86,
+    0xE7, 0xDA, 0xC5, 0x4E, 0xCF, 0x75, 0xB3, 0xBD, 0xBF, 0xFA, 0xD8, 0x49, 0x0A, 0xB5, 0x24, 0xF0,
+    0x7A, 0x15, 0x8A, 0x15, 0x20, 0x3D, 0xB4, 0x29, 0x1E, 0xDE, 0x9C, 0x3E, 0x65, 0x0F, 0x3C, 0x79,
+    0x01, 0x6D, 0x80, 0x4E, 0x11, 0x34, 0x50, 0x48, 0x91, 0x3A, 0x41, 0x7B, 0xDF, 0x4D, 0xD8, 0x11,
+    0xFC, 0xE0, 0x43, 0x21, 0xA8, 0x12, 0xA2, 0x8D, 0xD0, 0xC6, 0x6A, 0xC5, 0x0D, 0xE0, 0x42, 0x3B,
+    0x57, 0x09, 0x0A, 0x61, 0x47, 0x33, 0x42, 0x9D, 0x50, 0x2F, 0xA0, 0x8B, 0x55, 0x6A, 0x66, 0xC0,
+    0x8E, 0x5D, 0xB4, 0xC3, 0xF5, 0x0B, 0x34, 0xE8, 0x93, 0xA9, 0xD6, 0x5C, 0xE8, 0xC7, 0xA9, 0x9B,
+    0x9C, 0x96, 0x52, 0x0A, 0xAA, 0xB7, 0xDB, 0xB1, 0xD0, 0x52, 0xCF, 0x76, 0xB4, 0x13, 0x07, 0x6C,
+    0x10, 0x2E, 0x40, 0xB9, 0xD6, 0x09, 0x01, 0x6D, 0x34, 0x53, 0x95, 0x00, 0xE1, 0x87, 0x36, 0x42,
+    0xBD, 0x94, 0x1B, 0x36, 0x80, 0x0D, 0x4D, 0x2A, 0x72, 0x2F, 0x75, 0xB1, 0x59, 0xA0, 0x8D, 0xD8,
+    0x31, 0x17, 0x18, 0xFF, 0x23, 0x41, 0x9D, 0x40, 0x8A, 0xE4, 0x5A, 0x6C, 0x80, 0x01, 0xAE, 0xF7,
+    0xC0, 0x63, 0xC7, 0x36, 0x38, 0x7F, 0x16, 0x00, 0xA3, 0x08, 0x60, 0x25, 0x00, 0xBB, 0x69, 0x02,
+    0xCC, 0xDC, 0x26, 0xA0, 0x4D, 0x85, 0x80, 0x7A, 0xC3, 0x05, 0x28, 0x34, 0x98, 0x09, 0x70, 0x53,
+    0x1B, 0x81, 0x2E, 0x57, 0xB3, 0x52, 0x33, 0x03, 0xE8, 0xBB, 0x33, 0x80, 0xCD, 0xED, 0x6C, 0xD5,
+    0xB7, 0xDA, 0x70, 0x8A, 0xB5, 0x34, 0x58, 0xA9, 0x90, 0x46, 0x3B, 0x6B, 0xAA, 0x56, 0xDA, 0x64,
+    0x56, 0x7C, 0xDF, 0x6C, 0x95, 0x46, 0x33, 0x96, 0xEA, 0xED, 0xD6, 0xCC, 0x68, 0xAC, 0xF4, 0x83,
+    0x15, 0xB3, 0x60, 0x25, 0x1A, 0x51, 0x49, 0x03, 0x8A, 0x58, 0xCD, 0x18, 0xF5, 0xB5, 0xF4, 0x6A,
+    0x25, 0x49, 0xD2, 0x64, 0x25, 0x49, 0x73, 0xE1, 0xB5, 0x7D, 0x52, 0x09, 0x3E, 0xFB, 0x55, 0xCE,
+    0x9E, 0xA6, 0xB8, 0xE9, 0xEE, 0xAA, 0x4B, 0xEE, 0x27, 0x7A, 0x6A, 0x6B, 0x17, 0x3B, 0xEA, 0xC6,
+    0xDA, 0xCE, 0x1F, 0xEF, 0xF7, 0xEA, 0x1A, 0x30, 0x11, 0x93, 0xE8, 0x12, 0x6D, 0xA2, 0x59, 0xA9,
+    0x37, 0x2A, 0x51, 0x68, 0xC0, 0x07, 0x6C, 0xA4, 0x9B, 0x69, 0x12, 0x95, 0x40, 0x01, 0x3B, 0xD1,
+    0x2D, 0xD4, 0x1B, 0x85, 0x06, 0xDC, 0x44, 0xB7, 0x9C, 0xAE, 0x44, 0x9A, 0x95, 0x22, 0xEF, 0xD5,
+    0x1B, 0x28, 0x60, 0x16, 0x2A, 0xF5, 0xB8, 0x48, 0x23, 0xF0, 0x91, 0x26, 0xC1, 0x73, 0xF0, 0x21,
+    0x80, 0x8F, 0x83, 0x0F, 0xF8, 0x88, 0x49, 0xB4, 0xFB, 0x3B, 0x03, 0x1A, 0x71, 0x11, 0x3B, 0xD3,
+    0x2D, 0xB4, 0x57, 0x8A, 0x94, 0x4B, 0xB5, 0xFF, 0x6D, 0xD4, 0x1B, 0xF5, 0x4A, 0xB3, 0xD2, 0x24,
+    0xDA, 0x44, 0xB7, 0x60, 0x22, 0x76, 0xC2, 0x8F, 0x68, 0xA8, 0x44, 0xB3, 0xD1, 0x25, 0x5C, 0xC4,
+    0x07, 0x4C, 0x7E, 0x61, 0x39, 0xF1, 0xDB, 0x36, 0xB4, 0x4F, 0xA5, 0x72, 0xB5, 0xD8, 0xB7, 0x47,
+    0xDC, 0x26, 0x9C, 0xE2, 0xED, 0x4D, 0xF6, 0xED, 0x6F, 0xFF, 0xD7, 0xCD, 0xD2, 0x3E, 0x35, 0xF3,
+    0xDB, 0x36, 0x50, 0x4D, 0xC7, 0x01, 0x1D, 0xA0, 0x4A, 0x8F, 0xD8, 0x39, 0xBF, 0xF4, 0xAF, 0x3D,
+    0xE3, 0x25, 0xDD, 0x93, 0x94, 0x9C, 0xA4, 0xF0, 0xEE, 0x3F, 0x86, 0x8F, 0x0D, 0xF0, 0x18, 0x66,
+    0x2E, 0x15, 0xBA, 0x84, 0x42, 0x9B, 0x0A, 0xF5, 0x26, 0x56, 0x2B, 0x3E, 0xB4, 0xB1, 0x4A, 0xFC,
+    0x16, 0x58, 0x6D, 0x9D, 0x74, 0x4F, 0x7A, 0x43, 0x4A, 0xD7, 0x0E, 0xB7, 0x28, 0x7A, 0xBD, 0x2C,
+    0x49, 0xAB, 0xBE, 0xFB, 0x34, 0xC0, 0xB5, 0x9B, 0xD0, 0xAC, 0x80, 0x02, 0x74, 0x0B, 0x54, 0x02,
+    0xDC, 0x74, 0xE5, 0xAC, 0x99, 0xAF, 0x9C, 0x6D, 0x13, 0x14, 0x1A, 0xC0, 0xC6, 0xFD, 0xAC, 0x1F,
+    0x8F, 0x67, 0xFB, 0x7C, 0xB6, 0xDE, 0xF6, 0x1B, 0xDB, 0x05, 0xCA, 0xE3, 0xD9, 0x47, 0xBF, 0xE4,
+    0x3C, 0xEB, 0xB9, 0x22, 0x0F, 0x8E, 0x09, 0x8C, 0x34, 0xD2, 0x4A, 0xEA, 0x2B, 0x49, 0x2B, 0x3E,
+    0x55, 0x8A, 0xAD, 0x68, 0xF5, 0x09, 0x8D, 0xF8, 0xC5, 0x26, 0x2A, 0xDD, 0xD5, 0x80, 0x4D, 0x6E,
+    0xA6, 0xD2, 0xCB, 0xEA, 0x31, 0xAB, 0x9F, 0x29, 0xF5, 0xB2, 0xC0, 0xAC, 0x8A, 0x94, 0x7A, 0x45,
+    0x1C, 0xCF, 0xDE, 0x53, 0x8F, 0x4D, 0x6E, 0xA1, 0xD2, 0x77, 0x34, 0xE0, 0x16, 0x9B, 0x68, 0xF4,
+    0x49, 0x4D, 0x28, 0x76, 0xEA, 0xED, 0x8A, 0xD7, 0x1D, 0x0D, 0x95, 0xA4, 0x48, 0x2B, 0x2D, 0xD0,
+    0x69, 0x05, 0xCE, 0xBE, 0x0A, 0xB9, 0x8F, 0xBB, 0x01, 0xDC, 0xC2, 0xE3, 0xDA, 0xB0, 0xD2, 0xD0,
+    0x4A, 0x63, 0x29, 0xCD, 0x5C, 0xBB, 0xBD, 0x42, 0xAD, 0x9E, 0x42, 0x23, 0xB8, 0x19, 0xBA, 0x5F,
+    0xF0, 0xC4, 0xC2, 0xB9, 0xB4, 0x74, 0x7B, 0x97, 0xBF, 0x21, 0x69, 0xCE, 0x4A, 0xC3, 0x68, 0xA6,
+    0x94, 0x44, 0x2B, 0x29, 0x58, 0x49, 0x93, 0x4B, 0xA5, 0xA2, 0x8F, 0x68, 0xD6, 0x84, 0x66, 0x3F,
+    0xA1, 0xD9, 0x8E, 0x28, 0x16, 0x3D, 0x8A, 0x50, 0x6A, 0x82, 0x5A, 0x01, 0x5A, 0xF5, 0x60, 0x57,
+    0x40, 0x0B, 0x54, 0x9A, 0x1E, 0x3A, 0x35, 0x43, 0xA5, 0x00, 0xED, 0x06, 0xD8, 0xED, 0xF2, 0xF2,
+    0x59, 0x49, 0xDA, 0xBC, 0xA4, 0xCD, 0x49, 0x5A, 0x4D, 0x2E, 0xC6, 0x35, 0x28, 0xBC, 0x26, 0x9C,
+    0x14, 0x6B, 0x49, 0xD1, 0xEA, 0x8E, 0x46, 0x8D, 0xB5, 0xEE, 0x26, 0x5A, 0xD5, 0x23, 0x36, 0x9D,
+    0x83, 0x26, 0x68, 0x04, 0xF8, 0x19, 0x8C, 0x7A, 0x6E, 0x6B, 0xA1, 0x92, 0x56, 0x6A, 0x69, 0xA5,
+    0xBD, 0x54, 0xDA, 0x0B, 0x52, 0x68, 0x82, 0x4A, 0x03, 0x74, 0xDB, 0x5E, 0x90, 0x56, 0x81, 0x52,
+    0xEB, 0xD9, 0x67, 0xA5, 0xC9, 0x49, 0x1B, 0xCA, 0xF6, 0xEC, 0x55, 0xF8, 0xEC, 0xCD, 0x3C, 0x5A,
+    0x3E, 0x02, 0x14, 0x7E, 0x64, 0xAF, 0x03, 0x5A, 0x81, 0x46, 0x33, 0xE0, 0x34, 0xEE, 0x56, 0x0D,
+    0xA3, 0x95, 0xDD, 0xB6, 0xB5, 0x49, 0x23, 0xE8, 0xAE, 0x7A, 0x9A, 0xB5, 0x5D, 0xC1, 0x4D, 0x76,
+    0xA6, 0x12, 0x1A, 0xB1, 0xB1, 0x52, 0x5F, 0xA8, 0x6F, 0x57, 0xDA, 0x05, 0x3B, 0x23, 0x49, 0xFA,
+    0x7F, 0xD2, 0xDE, 0x03, 0xD2, 0x6E, 0xD4, 0x0F, 0x07, 0xFD, 0xF0, 0x26, 0x54, 0xEA, 0x81, 0x76,
+    0x05, 0xB0, 0x59, 0xF3, 0x8E, 0x1C, 0x4F, 0x7F, 0xF8, 0x59, 0x4A, 0x49, 0xB1, 0x39, 0x76, 0x11,
+    0x92, 0x52, 0xA5, 0x3F, 0x3D, 0xDC, 0x6C, 0x13, 0x59, 0xEA, 0x51, 0x80, 0x5A, 0x17, 0xD0, 0xED,
+    0xE6, 0x7A, 0x28, 0x25, 0x85, 0x73, 0x49, 0x81, 0xC2, 0x6B, 0x00, 0x2B, 0xC0, 0x25, 0x40, 0xF1,
+    0xD8, 0x37, 0x02, 0xFC, 0x02, 0x8D, 0x46, 0x0A, 0x6D, 0x67, 0x9F, 0xF1, 0x8A, 0x46, 0x12, 0x4E,
+    0x1A, 0xF1, 0x9A, 0xE1, 0xFA, 0xAD, 0xDC, 0x40, 0x67, 0x40, 0xA3, 0x08, 0x5E, 0x29, 0xB7, 0x79,
+    0xA7, 0xAD, 0xC7, 0x69, 0xA0, 0x50, 0xDA, 0xFB, 0xBF, 0xD1, 0xB0, 0x3F, 0xD5, 0x6C, 0x87, 0x1E,
+    0x2B, 0xAD, 0x38, 0x49, 0x83, 0x93, 0x34, 0xF9, 0xF9, 0x5C, 0xB3, 0x22, 0x3E, 0x29, 0x62, 0x93,
+    0x22, 0x26, 0xF9, 0x98, 0x47, 0x50, 0xB7, 0xBA, 0x05, 0x93, 0xEC, 0x8A, 0x4D, 0x46, 0xF8, 0xA5,
+    0xD5, 0xDB, 0x59, 0x20, 0xC6, 0x42, 0x52, 0x8F, 0xD1, 0x02, 0xC5, 0x17, 0xC0, 0x48, 0x5A, 0xAC,
+    0xA4, 0xD5, 0x4A, 0xDA, 0xAC, 0xA4, 0xCD, 0xBD, 0x76, 0xE9, 0x93, 0x0B, 0xD8, 0xD9, 0x0D, 0xF8,
+    0xC9, 0xF6, 0x85, 0xC2, 0xE3, 0xB9, 0xFD, 0x9A, 0x0D, 0xE8, 0x12, 0x60, 0x17, 0xC0, 0xC7, 0xBD,
+    0x75, 0xAB, 0xDC, 0x64, 0xC7, 0xF2, 0x76, 0x1B, 0x60, 0xD6, 0xA3, 0xB5, 0x73, 0xCB, 0x2E, 0x6A,
+    0x28, 0x1E, 0x37, 0x7E, 0xDA, 0xB5, 0x09, 0xE7, 0x03, 0xC0, 0x35, 0xE0, 0x71, 0x2D, 0xE0, 0x77,
+    0x35, 0x32, 0xB6, 0xFA, 0x6F, 0x8A, 0xDD, 0x8A, 0x5B, 0x4C, 0xC2, 0x2E, 0x66, 0xC1, 0xE6, 0xBD,
+    0x6E, 0xC3, 0xC7, 0x56, 0x7F, 0xAC, 0xB1, 0x96, 0xD4, 0x17, 0x52, 0x02, 0xAB, 0x04, 0x59, 0x05,
+    0xDD, 0xD1, 0xD4, 0xAE, 0x95, 0x66, 0x3B, 0xE3, 0x93, 0x8B, 0xD8, 0xD5, 0x47, 0xBA, 0x55, 0xFB,
+    0xC6, 0x24, 0xBF, 0xE0, 0x92, 0xD5, 0x9F, 0x69, 0x36, 0x92, 0xA6, 0x46, 0x52, 0x8F, 0xD7, 0x02,
+    0x67, 0x5F, 0x67, 0xF7, 0x00, 0x3A, 0x4D, 0x14, 0xD2, 0x46, 0x2D, 0x29, 0xB4, 0x92, 0x26, 0xBB,
+    0x96, 0x8A, 0x76, 0xC1, 0x2F, 0x6E, 0xC6, 0x26, 0x1F, 0xF3, 0xE6, 0x41, 0x8B, 0x77, 0x9B, 0x4D,
+    0x74, 0xAB, 0x55, 0xDF, 0xAD, 0xAD, 0xA4, 0x54, 0x4B, 0x4A, 0x78, 0x69, 0xE1, 0xFC, 0x52, 0xF3,
+    0x49, 0x5A, 0xC6, 0x3C, 0x8A, 0x70, 0x82, 0x52, 0x2B, 0x38, 0xCD, 0x78, 0x29, 0xE0, 0xB4, 0xED,
+    0x4A, 0xB5, 0xF8, 0x3A, 0xF0, 0xE1, 0xFF, 0xA2, 0x57, 0x24, 0xF9, 0x45, 0x81, 0x87, 0x3E, 0x8F,
+    0xB5, 0xAB, 0x97, 0xA4, 0x57, 0xD6, 0xEB, 0x3D, 0x97, 0xD8, 0x54, 0x2B, 0xB8, 0xB5, 0x56, 0x30,
+    0x33, 0x8F, 0xFA, 0x3C, 0x86, 0x99, 0xAB, 0xA3, 0xCD, 0x59, 0x0A, 0xF5, 0x36, 0x56, 0x2B, 0x7E,
+    0xE8, 0x62, 0x95, 0xF8, 0xF8, 0x49, 0x9F, 0x97, 0x11, 0x4A, 0x0D, 0x94, 0x4A, 0x94, 0x5A, 0x29,
+    0xB5, 0x9C, 0xFE, 0xE3, 0xE7, 0x2C, 0xDB, 0x98, 0x47, 0x6E, 0xC2, 0x2E, 0x14, 0x0E, 0xE0, 0x26,
+    0x40, 0x23, 0x29, 0x9D, 0x6C, 0xE3, 0x93, 0x97, 0x97, 0x97, 0xC3, 0x43, 0x85, 0x3A, 0x5D, 0xF2,
+    0x92, 0xFE, 0xD7, 0xE5, 0xE5, 0xE5, 0x33, 0x1F, 0x02, 0x8A, 0x79, 0x1F, 0xB8, 0xB5, 0x62, 0xEE,
+    0x87, 0x77, 0x6E, 0x1E, 0x57, 0x00, 0x93, 0xA0, 0x53, 0xA0, 0xD3, 0x88, 0xD1, 0x88, 0xD1, 0x80,
+    0xD1, 0x90, 0x95, 0x95, 0x19, 0x80, 0x61, 0xF7, 0xE1, 0xA4, 0xA1, 0x96, 0x42, 0x97, 0x47, 0x7C,
+    0xB8, 0xFF, 0x39, 0x0D, 0x94, 0x82, 0x72, 0x85, 0x6A, 0x81, 0x76, 0x02, 0x37, 0xF0, 0xF8, 0xC6,
+    0xE3, 0x9A, 0x1B, 0x29, 0x38, 0xA5, 0x42, 0xEA, 0x2B, 0x5D, 0xD0, 0x46, 0xB0, 0x03, 0x78, 0xE0,
+    0xE2, 0x41, 0xC9, 0xDD, 0x48, 0xA5, 0x40, 0xA7, 0xAC, 0x04, 0x34, 0xC1, 0x17, 0xF6, 0x91, 0xBD,
+    0xAB, 0xC0, 0xDB, 0xD2, 0xB0, 0x7F, 0x6B, 0xDA, 0xDB, 0x22, 0x2B, 0x54, 0xBD, 0xE5, 0x95, 0xC0,
+    0xE8, 0x82, 0x42, 0x4B, 0x36, 0x01, 0xB8, 0x85, 0x6E, 0x05, 0x70, 0x31, 0xAB, 0x2B, 0xDC, 0xD4,
+    0xAC, 0x34, 0x0A, 0x28, 0xB8, 0xA9, 0x94, 0x42, 0xA1, 0x4F, 0x0A, 0xFB, 0xB6, 0x86, 0x6A, 0x6B,
+    0x53, 0xA1, 0x52, 0xB4, 0x8B, 0x1B, 0xEB, 0x58, 0x25, 0xCC, 0xF7, 0x45, 0x1D, 0xDA, 0x19, 0xFF,
+    0x42, 0x02, 0xEC, 0x58, 0x6E, 0x36, 0x52, 0x78, 0xF5, 0xCD, 0xA2, 0x01, 0xA7, 0x15, 0xFB, 0xE2,
+    0x46, 0xB3, 0xFD, 0xF9, 0x8C, 0xDA, 0x05, 0x17, 0xEC, 0xD8, 0x24, 0x1B, 0x4B, 0xA1, 0xDE, 0x8E,
+    0x0A, 0x6D, 0x6A, 0xB6, 0x5A, 0x95, 0x30, 0x92, 0x14, 0x9B, 0x15, 0xA7, 0x57, 0x24, 0xBA, 0x84,
+    0x5B, 0x3B, 0x8D, 0xD8, 0x99, 0x8F, 0xF5, 0xE7, 0x17, 0xFB, 0x90, 0xE7, 0x38, 0x8A, 0x81, 0x42,
+    0x33, 0x50, 0x0C, 0x94, 0xBA, 0x9F, 0x7B, 0xBF, 0x90, 0xFE, 0xF4, 0x9A, 0x4F, 0x50, 0x48, 0x92,
+    0x46, 0xC0, 0x49, 0x4A, 0x00, 0x8F, 0x4B, 0x5B, 0xBE, 0xEF, 0x70, 0xEB, 0x1D, 0x22, 0xFA, 0xAD,
+    0xBD, 0x69, 0xF3, 0x73, 0xB3, 0xE1, 0xC8, 0xDA, 0x10, 0xB0, 0x79, 0x00, 0xD4, 0xFB, 0xDD, 0x3E,
+    0xBF, 0xBD, 0x7D, 0x5B, 0x3D, 0x50, 0x6E, 0x6E, 0x01, 0xB0, 0x77, 0x15, 0x80, 0x3A, 0x99, 0x15,
+    0x40, 0x9F, 0x50, 0x04, 0xBA, 0xD8, 0x0A, 0x28, 0x37, 0xFC, 0x02, 0xD8, 0xB1, 0x56, 0x80, 0x26,
+    0xED, 0xA6, 0x35, 0xF7, 0x4F, 0x27, 0x49, 0xE4, 0x50, 0x71, 0x06, 0xFB, 0xD6, 0xE5, 0x1D, 0x0D,
+    0x34, 0x69, 0xEF, 0xDF, 0x81, 0x4A, 0x23, 0xDD, 0x0C, 0x46, 0x54, 0xEA, 0x29, 0x75, 0xBF, 0xCA,
+    0x76, 0x21, 0x79, 0x25, 0x9C, 0xF4, 0x82, 0x14, 0x1A, 0x29, 0x15, 0x4F, 0xEA, 0x2F, 0x73, 0xCD,
+    0x87, 0x46, 0xCA, 0x72, 0x27, 0x85, 0x42, 0x53, 0xA7, 0xBE, 0xD2, 0xD0, 0x6E, 0xB4, 0x1B, 0x76,
+    0xC1, 0x2E, 0xF8, 0x09, 0x4D, 0xA5, 0x86, 0x4A, 0x43, 0x9B, 0x68, 0x37, 0xDC, 0x84, 0xDD, 0xBE,
+    0x21, 0x90, 0x34, 0x53, 0x49, 0x5A, 0x68, 0x25, 0x25, 0xEC, 0x72, 0xAE, 0x05, 0x4D, 0x85, 0x62,
+    0xA5, 0xA1, 0x52, 0x68, 0x37, 0x1A, 0xF5, 0x76, 0xC1, 0xAC, 0x68, 0xC2, 0x3F, 0x38, 0xED, 0x56,
+    0xFC, 0x76, 0x27, 0xDB, 0x1E, 0x95, 0x3A, 0xAA, 0xB8, 0x57, 0xDF, 0xD1, 0xDE, 0xB7, 0xF5, 0x2A,
+    0x74, 0x52, 0x0E, 0x90, 0x13, 0x36, 0x87, 0xA4, 0xF3, 0x99, 0x82, 0xDD, 0x28, 0x55, 0x68, 0xA2,
+    0x5E, 0x5A, 0x41, 0x37, 0xBA, 0x05, 0x7E, 0xBF, 0x54, 0xB6, 0xE8, 0xA7, 0x28, 0xA6, 0x50, 0x64,
+    0x77, 0x5F, 0xE8, 0xC4, 0xD1, 0x22, 0x1E, 0x4F, 0xE7, 0x5F, 0x87, 0x1C, 0xEC, 0x00, 0x5E, 0x00,
+    0xD2, 0x40, 0x51, 0x4A, 0xF7, 0x3F, 0xB3, 0xE6, 0xD6, 0xAE, 0x24, 0x29, 0x94, 0x92, 0x56, 0xF0,
+    0xD2, 0x00, 0x67, 0x5F, 0xE8, 0x39, 0x7B, 0x52, 0x6F, 0xF5, 0xB9, 0x21, 0x97, 0x3C, 0x7A, 0xB6,
+    0xDC, 0x4B, 0xEA, 0x0B, 0xC5, 0x5A, 0xA2, 0x52, 0x28, 0x24, 0x5A, 0x81, 0x36, 0x6C, 0x02, 0x25,
+    0x14, 0x29, 0x34, 0x57, 0x0A, 0x54, 0x9A, 0x5A, 0x41, 0xAB, 0xC1, 0x26, 0x30, 0x42, 0x11, 0x5C,
+    0xAA, 0x14, 0x28, 0x14, 0x5B, 0x41, 0xAD, 0x60, 0x13, 0x74, 0x1B, 0x8A, 0xE0, 0x97, 0x7C, 0xD7,
+    0x98, 0xEF, 0xC2, 0x26, 0xF0, 0x0B, 0x8A, 0xD4, 0x0A, 0x95, 0x02, 0x6E, 0xA5, 0x15, 0x8F, 0x6B,
+    0xC4, 0x4B, 0xDA, 0xF2, 0x58, 0x09, 0x65, 0x16, 0x99, 0x87, 0x5B, 0xF8, 0xDA, 0xE1, 0x70, 0x38,
+    0x7C, 0x52, 0x92, 0xF4, 0x15, 0x49, 0x52, 0x27, 0x49, 0xA9, 0xD0, 0x5B, 0x97, 0x3E, 0x56, 0x0A,
+    0xD8, 0xD0, 0x0A, 0x36, 0x6C, 0xA2, 0x9A, 0x51, 0xE4, 0xBC, 0xAF, 0x14, 0xAE, 0x34, 0x6F, 0x71,
+    0x00, 0x49, 0x89, 0x93, 0x93, 0xAB, 0x80, 0xDD, 0x2E, 0x9F, 0xDD, 0x47, 0xDE, 0xC3, 0xBF, 0x86,
+    0x05, 0x45, 0x9A, 0x07, 0xCF, 0x2E, 0x85, 0x97, 0x94, 0x8C, 0x76, 0x27, 0x75, 0x2F, 0xC9, 0x9A,
+    0xCB, 0x66, 0x4E, 0xDE, 0xD3, 0x4F, 0x4E, 0x25, 0x13, 0x36, 0xE5, 0x9B, 0x9B, 0x58, 0x29, 0x14,
+    0x09, 0x45, 0x7E, 0x37, 0x77, 0x75, 0xAB, 0xD3, 0x3B, 0xF5, 0xD6, 0xE5, 0x37, 0xB1, 0xD2, 0xF6,
+    0xC0, 0xE5, 0x0F, 0xE8, 0xCD, 0x43, 0xFF, 0xB3, 0xBF, 0x8C, 0x47, 0x49, 0x69, 0x05, 0x34, 0xFA,
+    0xDF, 0x60, 0xA4, 0x09, 0xB3, 0xF7, 0xE9, 0xF6, 0x90, 0x38, 0xDE, 0xCF, 0x26, 0x61, 0xCB, 0x86,
+    0x21, 0x62, 0x95, 0x9D, 0xE9, 0x19, 0x17, 0x4B, 0xCD, 0x54, 0xC2, 0x25, 0x30, 0x53, 0xAB, 0x9E,
+    0x62, 0x2D, 0x14, 0xA1, 0x0D, 0x79, 0xAC, 0xE7, 0x17, 0xEE, 0xC1, 0x75, 0x96, 0xC8, 0x2C, 0x8C,
+    0xD4, 0x0A, 0x7C, 0xEC, 0xF2, 0x59, 0x97, 0xA8, 0xA5, 0x1F, 0x29, 0xE0, 0xB5, 0xBA, 0x95, 0xC2,
+    0xEB, 0xAE, 0x26, 0xB0, 0x8B, 0x15, 0x54, 0xFA, 0xB2, 0x12, 0xD8, 0xA5, 0xD5, 0x44, 0xA5, 0xC1,
+    0xEB, 0x55, 0xDC, 0x92, 0xA3, 0xE9, 0xA1, 0xCD, 0x32, 0x68, 0x24, 0x6D, 0xD0, 0x49, 0xF7, 0x81,
+    0xB3, 0x2F, 0xDC, 0x84, 0x6B, 0x87, 0x43, 0x7F, 0x76, 0x38, 0xFC, 0x2B, 0x49, 0xBD, 0x97, 0xEE,
+    0x49, 0xA9, 0xCC, 0x9D, 0x7D, 0x51, 0x4B, 0x53, 0x91, 0x25, 0x2E, 0x17, 0x4E, 0x91, 0x56, 0xB9,
+    0xA0, 0x36, 0xE5, 0x16, 0x51, 0x04, 0xFB, 0xE8, 0xCB, 0x5D, 0xD6, 0x01, 0x47, 0x01, 0x38, 0x8A,
+    0xC0, 0x2E, 0x04, 0x97, 0x77, 0x7E, 0xFE, 0xDD, 0x3F, 0xE7, 0xE1, 0x7E, 0xEB, 0x31, 0xBA, 0x30,
+    0x59, 0x5B, 0xBD, 0xB1, 0x97, 0xFC, 0xE5, 0xBD, 0xE4, 0x5C, 0x3B, 0x1C, 0x9E, 0x90, 0x56, 0x2F,
+    0xBD, 0x24, 0xBD, 0x5A, 0xEC, 0x37, 0xFE, 0x12, 0x5F, 0x9D, 0x2E, 0x8C, 0xF4, 0x72, 0x0E, 0x56,
+    0xC6, 0xE2, 0x70, 0x38, 0x20, 0x69, 0xB4, 0xD2, 0xDC, 0x48, 0xAF, 0xD2, 0x28, 0xE4, 0x20, 0xC3,
+    0x2D, 0xD9, 0x6F, 0xAC, 0x35, 0xBC, 0x2F, 0x27, 0x4A, 0x8D, 0xD9, 0x5A, 0xD9, 0x04, 0x66, 0xCB,
+    0x4D, 0x6A, 0x34, 0xE0, 0x14, 0xF0, 0x0A, 0xB4, 0x1A, 0xB2, 0xD1, 0xB9, 0x76, 0x38, 0xF4, 0xD7,
+    0x0E, 0xB7, 0xBC, 0x14, 0xB2, 0x2F, 0x12, 0xA4, 0xC5, 0x69, 0xA5, 0xD3, 0x45, 0xA1, 0x88, 0x59,
+    0x41, 0x11, 0x1F, 0x41, 0xB1, 0xCC, 0xED, 0xD9, 0x08, 0x50, 0x34, 0x39, 0x02, 0xC8, 0x7E, 0xF0,
+    0x1B, 0x59, 0xE8, 0xDF, 0xDE, 0xB2, 0x9A, 0x4B, 0xF9, 0x6B, 0x3F, 0xD2, 0x00, 0xE8, 0xA7, 0x1A,
+    0xF3, 0x2F, 0xB3, 0x2F, 0x98, 0xC3, 0xAC, 0x68, 0xF3, 0xC3, 0xBA, 0xE3, 0xA3, 0x23, 0x28, 0x56,
+    0x4A, 0xA0, 0x88, 0xD4, 0x97, 0x7A, 0x13, 0xAB, 0xC9, 0x48, 0xA1, 0xCD, 0x05, 0xAC, 0xB4, 0x7A,
+    0x29, 0x64, 0x8B, 0x06, 0xD7, 0x2F, 0xAE, 0x1D, 0x0E, 0x3D, 0xA5, 0x76, 0x88, 0x30, 0x41, 0x27,
+    0x5D, 0x1C, 0x55, 0xF1, 0x3B, 0x75, 0xC5, 0xBB, 0xA8, 0x90, 0xF7, 0x7A, 0xFA, 0xF7, 0xB1, 0x89,
+    0xAC, 0x1D, 0xDA, 0xF7, 0xA2, 0x70, 0x38, 0x1C, 0x7A, 0x8A, 0xC3, 0xA1, 0x2F, 0xA5, 0x48, 0x9D,
+    0x23, 0xF1, 0x98, 0xA1, 0x4C, 0xAF, 0x99, 0x56, 0xEA, 0x69, 0xB5, 0xD0, 0x6A, 0x81, 0x56, 0x89,
+    0xEE, 0xB8, 0x63, 0x73, 0x68, 0xBF, 0x61, 0x7F, 0x9C, 0xA0, 0xFB, 0x91, 0x70, 0x77, 0x12, 0x98,
+    0x1F, 0x08, 0xFF, 0xF9, 0xBC, 0xD3, 0xAB, 0x4B, 0x60, 0xBE, 0xA7, 0x61, 0xEB, 0x12, 0xD8, 0xEF,
+    0xEA, 0xF9, 0xB5, 0x5D, 0xC1, 0x8E, 0x7A, 0x31, 0xE5, 0x1D, 0xFF, 0x83, 0xA5, 0x5D, 0xC1, 0x06,
+    0xF7, 0xD3, 0xB9, 0xDD, 0xC0, 0x05, 0xAB, 0x98, 0x77, 0x8C, 0xA6, 0x76, 0x03, 0x1F, 0xBA, 0xAC,
+    0xF7, 0x7D, 0x68, 0x15, 0x1A, 0x81, 0x0F, 0x8D, 0x86, 0x46, 0xA0, 0x50, 0xA9, 0x6F, 0x44, 0x46,
+    0x93, 0x6A, 0x51, 0x68, 0x28, 0x36, 0x1A, 0x5D, 0x74, 0xDA, 0xF8, 0xBF, 0x78, 0x25, 0x2B, 0x41,
+    0x21, 0x25, 0xAB, 0x2D, 0xEF, 0x9C, 0x1D, 0x6E, 0x52, 0x1C, 0x0E, 0x37, 0xA5, 0x89, 0x56, 0x7A,
+    0x51, 0x1A, 0xB1, 0xD2, 0xA7, 0xA4, 0x80, 0xD7, 0x8C, 0x14, 0x68, 0x12, 0xA5, 0xD4, 0x63, 0x22,
+    0x8D, 0x04, 0x3E, 0x60, 0x24, 0x4A, 0x81, 0xD7, 0xB6, 0x5F, 0x5E, 0x31, 0x91, 0x66, 0x55, 0xC2,
+    0x07, 0xCC, 0x1B, 0x5A, 0x4A, 0x81, 0xBF, 0xAB, 0xB9, 0x49, 0x94, 0xAA, 0x14, 0x4D, 0xA4, 0x49,
+    0xB5, 0x26, 0x1F, 0x30, 0xB1, 0xD1, 0xF7, 0xF6, 0x3A, 0xDC, 0x4B, 0x94, 0xA2, 0xD3, 0x8F, 0x23,
+    0x4D, 0xC2, 0x48, 0x01, 0x13, 0x33, 0x86, 0xE9, 0x03, 0x4E, 0x69, 0x7F, 0x4F, 0x06, 0xE2, 0xA4,
+    0x80, 0xBB, 0x0F, 0x12, 0x9D, 0xD4, 0x97, 0x4A, 0x64, 0xBF, 0x20, 0x56, 0xD9, 0x0F, 0xC9, 0xD1,
+    0xC7, 0xF9, 0xCD, 0x07, 0xEA, 0xFA, 0x71, 0xDD, 0x27, 0x7B, 0x78, 0x23, 0xB4, 0xD9, 0xB7, 0xCD,
+    0x0A, 0x1B, 0xAD, 0x85, 0x34, 0x54, 0x9A, 0xE8, 0x34, 0xD6, 0x1A, 0xA8, 0xB3, 0xB9, 0xAD, 0x34,
+    0x77, 0x1B, 0x14, 0x5A, 0xCC, 0x0A, 0x28, 0xD9, 0x04, 0xF8, 0xE3, 0x97, 0x4B, 0x80, 0x7B, 0x97,
+    0xAF, 0x15, 0x70, 0xC9, 0xAE, 0x80, 0x5F, 0xF2, 0x78, 0x99, 0x4F, 0xC3, 0x66, 0xA0, 0xD4, 0xD8,
+    0x6A, 0xA4, 0x56, 0xA8, 0xB5, 0x60, 0x44, 0x29, 0xBD, 0xA6, 0x35, 0xEB, 0xD0, 0x39, 0x87, 0xB9,
+    0x03, 0x94, 0x59, 0x77, 0xF3, 0x1B, 0x97, 0x3D, 0x14, 0x4F, 0xEA, 0xAD, 0xBE, 0x96, 0xA4, 0xC1,
+    0x4B, 0x52, 0x2D, 0x49, 0x4B, 0xA1, 0x78, 0x5B, 0x63, 0x2B, 0xDC, 0x86, 0x62, 0xB9, 0xE3, 0x58,
+    0x28, 0xF2, 0x60, 0xB7, 0xD0, 0x94, 0xFD, 0x03, 0xC5, 0x56, 0x43, 0xAB, 0xCF, 0x29, 0x66, 0x5B,
+    0xDD, 0x4A, 0xDB, 0x3E, 0xE6, 0x5B, 0xDD, 0x3C, 0x8E, 0x9C, 0x3C, 0x94, 0xDE, 0xB9, 0x6B, 0x74,
+    0x73, 0x47, 0xCE, 0x9A, 0xA3, 0xCD, 0x1B, 0xAF, 0x98, 0xC3, 0x73, 0x6D, 0x3D, 0xD0, 0x49, 0x6B,
+    0x06, 0x9F, 0x15, 0x4F, 0x0D, 0x6C, 0xD5, 0x3B, 0x4D, 0xD8, 0x8D, 0x42, 0x2B, 0xDD, 0x06, 0x9D,
+    0xC2, 0xDE, 0xC2, 0xB5, 0x06, 0x70, 0x5B, 0xB9, 0xC7, 0x98, 0x19, 0x64, 0x8A, 0x7B, 0x13, 0x77,
+    0x02, 0x3A, 0xD5, 0x39, 0x5A, 0xFF, 0xB6, 0x22, 0x14, 0x8A, 0x7B, 0x1B, 0x77, 0xEA, 0xA1, 0xDB,
+    0x2A, 0x8D, 0xD0, 0x68, 0xC8, 0x30, 0x44, 0xD8, 0x1B, 0xB9, 0xD6, 0x04, 0x7E, 0x46, 0x1B, 0xB8,
+    0x44, 0xA7, 0x09, 0x9F, 0x28, 0xA5, 0xD7, 0xB5, 0xE6, 0x72, 0xAD, 0x50, 0x66, 0x31, 0xA0, 0xC9,
+    0x21, 0xCF, 0xD1, 0x87, 0x47, 0x59, 0x4B, 0x35, 0xBB, 0x83, 0xE4, 0x75, 0xFF, 0x00, 0x39, 0xB0,
+    0x66, 0xF7, 0x08, 0x1E, 0xF8, 0xF4, 0x85, 0x3F, 0x45, 0xB0, 0xC5, 0x93, 0xFE, 0xE8, 0x02, 0x8E,
+    0xD9, 0x05, 0x8C, 0xD9, 0x05, 0x9C, 0x28, 0x34, 0x75, 0x1A, 0xA9, 0x34, 0xB4, 0x1A, 0x68, 0x37,
+    0x5A, 0x81, 0x5D, 0xB2, 0x17, 0x38, 0xA1, 0x48, 0x76, 0x87, 0x69, 0x37, 0xCC, 0x0A, 0x76, 0x29,
+    0x14, 0x41, 0xD3, 0x6D, 0xF5, 0x54, 0x59, 0x28, 0x72, 0x6F, 0x61, 0x73, 0xC3, 0xEB, 0x6D, 0x05,
+    0xA8, 0xF4, 0x9F, 0x35, 0x40, 0xBB, 0x65, 0xF0, 0x6D, 0x69, 0xD5, 0x83, 0xA6, 0x4E, 0x3D, 0x95,
+    0x06, 0xA3, 0x9E, 0x76, 0xC3, 0xAA, 0xC7, 0xAF, 0x58, 0x0D, 0x46, 0x0A, 0x56, 0xDF, 0x93, 0x84,
+    0xD5, 0xCB, 0x52, 0xC2, 0x64, 0x9F, 0xE6, 0xC3, 0x7B, 0xB0, 0x58, 0x6A, 0xEB, 0xB1, 0xD2, 0x5C,
+    0x48, 0x5A, 0x2A, 0x49, 0x4B, 0xA3, 0xA1, 0x5B, 0xDA, 0x8D, 0x66, 0xE9, 0x56, 0x9A, 0xB9, 0x5B,
+    0xA9, 0xA3, 0xD9, 0x28, 0x87, 0x2E, 0xE3, 0x27, 0x0B, 0xB4, 0xD2, 0x40, 0x25, 0x2D, 0x1C, 0xE1,
+    0x1A, 0x4D, 0xD4, 0xD2, 0x0C, 0xB7, 0x95, 0xA0, 0xD4, 0xDA, 0x0C, 0xB8, 0xD5, 0x06, 0xBA, 0x7D,
+    0x33, 0xD1, 0x25, 0x3B, 0x63, 0x17, 0xBB, 0x7D, 0x46, 0xD1, 0xEE, 0x36, 0x56, 0x7D, 0x23, 0x2D,
+    0x59, 0xE0, 0xAF, 0x1D, 0x0E, 0x87, 0xC3, 0xE1, 0x89, 0xEC, 0x55, 0xE4, 0x3C, 0xC1, 0x0B, 0xFB,
+    0xC1, 0x6B, 0x7E, 0xBB, 0xD4, 0x0B, 0x4B, 0xA9, 0xB1, 0x49, 0xEA, 0xCD, 0x8A, 0xFB, 0x4A, 0x2C,
+    0x35, 0xD6, 0x8B, 0xC3, 0xAC, 0x38, 0x6E, 0x96, 0x1A, 0x8B, 0x7E, 0x87, 0x74, 0xB2, 0x65, 0x7D,
+    0xDF, 0x0E, 0x6A, 0xBD, 0x99, 0x45, 0x26, 0x9D, 0xD4, 0x49, 0x27, 0xA5, 0x93, 0x73, 0xF5, 0x07,
+    0xD2, 0x56, 0x48, 0x72, 0xD2, 0xD8, 0x49, 0xDF, 0x97, 0x66, 0xBC, 0x5E, 0x45, 0x33, 0xD8, 0x79,
+    0xF7, 0x6B, 0x32, 0x9A, 0xFA, 0xB7, 0x74, 0x78, 0x7C, 0x51, 0x4F, 0xAD, 0x8C, 0xF0, 0xF9, 0x48,
+    0xAD, 0x31, 0xCB, 0x9C, 0xFA, 0x5A, 0x23, 0xA5, 0xF4, 0x63, 0xA5, 0xAC, 0x09, 0xB5, 0x0F, 0xD8,
+    0x90, 0x03, 0xDF, 0x11, 0xE0, 0xFA, 0x65, 0x7F, 0xAA, 0xD1, 0xA7, 0x32, 0x68, 0x9A, 0x9C, 0x34,
+    0xB6, 0xD2, 0xF3, 0xD2, 0x8C, 0x53, 0xAC, 0x34, 0x83, 0x9B, 0xE9, 0x34, 0xD0, 0x08, 0x94, 0x45,
+    0xB9, 0x51, 0xA0, 0x4B, 0xE0, 0x36, 0x4A, 0x0D, 0x54, 0x8A, 0xD8, 0x19, 0x3A, 0x51, 0x67, 0x35,
+    0x88, 0x1F, 0xA1, 0x51, 0xC8, 0xF8, 0x65, 0x2A, 0x34, 0x40, 0xA5, 0xD1, 0xCC, 0x40, 0xA7, 0x6A,
+    0xD7, 0x38, 0x6E, 0x04, 0x1A, 0x3D, 0x91, 0x00, 0xEC, 0xA2, 0x01, 0xA8, 0xF4, 0x4A, 0x24, 0x2B,
+    0x99, 0x3C, 0x4E, 0x73, 0x59, 0x9B, 0x53, 0xCC, 0x3D, 0x64, 0xD7, 0x3A, 0x47, 0xE4, 0x39, 0xC2,
+    0xDB, 0xD1, 0xD4, 0xFD, 0x73, 0x76, 0x38, 0xF4, 0x40, 0x71, 0x38, 0xDC, 0x90, 0x36, 0x6C, 0xC4,
+    0x69, 0xB5, 0xD2, 0x58, 0xA9, 0x6F, 0xA4, 0x6F, 0x4B, 0x33, 0x6E, 0xC1, 0x68, 0x2E, 0xB5, 0xD0,
+    0xE4, 0x44, 0x50, 0xAB, 0x01, 0xED, 0x79, 0xA4, 0x44, 0xAB, 0x11, 0x1B, 0x69, 0x72, 0x30, 0x57,
+    0x6F, 0x60, 0x57, 0x8C, 0x22, 0x7E, 0xA4, 0xD2, 0x54, 0x49, 0x7D, 0x9B, 0xE3, 0x37, 0xAB, 0x05,
+    0x0D, 0x59, 0x1B, 0x29, 0x74, 0x33, 0xB4, 0xEA, 0xFD, 0x9D, 0x54, 0x66, 0xE0, 0xB5, 0xFD, 0x89,
+    0x46, 0x3B, 0x65, 0xC5, 0xD6, 0xAA, 0xCA, 0xE8, 0xA3, 0x99, 0x7C, 0x74, 0x01, 0x4A, 0xBD, 0xB8,
+    0xD6, 0x7A, 0x62, 0x01, 0xBA, 0xCD, 0x06, 0xBB, 0x64, 0x5C, 0xFA, 0xA7, 0x4B, 0xA9, 0x17, 0x22,
+    0xD0, 0xC8, 0xF7, 0xDD, 0xB6, 0x01, 0x38, 0xC5, 0xBD, 0x25, 0x2A, 0x6D, 0xC7, 0xC6, 0x30, 0x1A,
+    0x71, 0x0A, 0x3B, 0x22, 0x51, 0x69, 0x66, 0x0F, 0x6E, 0x4D, 0x6E, 0x15, 0x3F, 0xEF, 0xBE, 0x16,
+    0xB5, 0x8E, 0xE0, 0xF3, 0xD5, 0x56, 0xBA, 0x79, 0x76, 0x38, 0xD4, 0xD2, 0xDA, 0x4A, 0xDF, 0x96,
+    0x54, 0x49, 0xD1, 0x68, 0xEB, 0x8D, 0x26, 0xFC, 0x46, 0xA5, 0x81, 0x46, 0x63, 0xF6, 0x2D, 0x53,
+    0x91, 0xD1, 0xE4, 0x41, 0x01, 0x0A, 0xCD, 0x7E, 0x04, 0x8C, 0xDC, 0x04, 0x54, 0xBB, 0xAE, 0xB4,
+    0xC7, 0x77, 0xE5, 0xAE, 0xD9, 0x3B, 0xCC, 0xED, 0x41, 0x50, 0xD6, 0xB7, 0x56, 0xEA, 0x01, 0xF3,
+    0x66, 0x46, 0x41, 0xB2, 0xD5, 0xEC, 0x52, 0x4E, 0x2D, 0xAC, 0xB8, 0x95, 0xAC, 0x37, 0xC3, 0x51,
+    0xDA, 0x1A, 0x0D, 0x18, 0x8D, 0x26, 0x87, 0x04, 0x7F, 0x9E, 0x35, 0xC8, 0xEB, 0x52, 0xEC, 0xA4,
+    0x25, 0x3B, 0xC9, 0x87, 0x8C, 0x28, 0xFC, 0x34, 0x67, 0xD2, 0xEF, 0x49, 0x43, 0xA3, 0xA5, 0x54,
+    0xCC, 0xE9, 0xB8, 0x09, 0x33, 0x53, 0x2B, 0xA0, 0x81, 0x56, 0x43, 0x93, 0x23, 0x11, 0x3B, 0x82,
+    0xD9, 0x4A, 0x01, 0x36, 0xB5, 0x33, 0xE0, 0x16, 0x9F, 0xBD, 0xE1, 0xF4, 0x40, 0xEA, 0xCA, 0x2C,
+    0x83, 0x7B, 0xCB, 0xEE, 0x11, 0x5C, 0x36, 0x97, 0xC7, 0x94, 0x69, 0xAE, 0x6C, 0xF5, 0x88, 0x4B,
+    0xE5, 0xC9, 0x19, 0x19, 0xAE, 0xAA, 0xF5, 0x05, 0xCE, 0x0E, 0x87, 0xC3, 0xAD, 0x4A, 0x39, 0x15,
+    0x22, 0xE9, 0x86, 0x24, 0x2D, 0xF6, 0xB5, 0x3F, 0x75, 0xAA, 0x12, 0xB5, 0x46, 0x3B, 0xA0, 0xA5,
+    0x9A, 0xB1, 0xE2, 0x7A, 0x46, 0x37, 0x0B, 0x2D, 0xEC, 0x00, 0x7F, 0xB3, 0x77, 0xC1, 0xF1, 0xB8,
+    0xBD, 0x72, 0xBC, 0x1D, 0x8F, 0x4B, 0xCD, 0xB4, 0xBD, 0xDB, 0x28, 0x52, 0xAB, 0x80, 0x7D, 0x5E,
+    0x91, 0x3A, 0xB9, 0x0D, 0xFC, 0x0B, 0x0F, 0x74, 0xED, 0x57, 0x24, 0x69, 0xDE, 0x0D, 0x78, 0x36,
+    0x77, 0xF7, 0x94, 0xBC, 0xEE, 0x6D, 0xCF, 0xF8, 0xD0, 0x24, 0x7E, 0xF9, 0xCD, 0x0F, 0x9F, 0x50,
+    0xF2, 0xBA, 0xA7, 0x74, 0xE8, 0xF7, 0x7C, 0x9E, 0x8D, 0x7B, 0x2E, 0xAF, 0x4D, 0x7B, 0xCE, 0xAF,
+    0x3A, 0x9E, 0x2E, 0x34, 0x5C, 0x3D, 0x2D, 0x72, 0xCA, 0x30, 0xA7, 0x00, 0xD3, 0x0E, 0xCD, 0x57,
+    0x22, 0xA7, 0xFE, 0x50, 0xD8, 0x93, 0x81, 0xA7, 0x47, 0x9E, 0x4E, 0xBF, 0xCB, 0x9B, 0xCA, 0x67,
+    0xAD, 0x5E, 0xD2, 0xEA, 0xF4, 0xBD, 0x6F, 0xAC, 0xB8, 0xB1, 0xFE, 0xE5, 0x37, 0xD7, 0xFC, 0x4B,
+    0x5A, 0x9D, 0x5E, 0xD4, 0x0A, 0xB7, 0x80, 0x32, 0x03, 0x0D, 0xC3, 0x29, 0x81, 0x36, 0x42, 0xAB,
+    0x08, 0xE6, 0x95, 0x19, 0xEC, 0x77, 0x16, 0x70, 0x4F, 0x25, 0xD0, 0x8D, 0x8D, 0x42, 0x85, 0x28,
+    0x37, 0xD4, 0x57, 0x09, 0x3F, 0x34, 0x09, 0x17, 0xDA, 0x05, 0x3B, 0x75, 0x11, 0x13, 0x4D, 0xA4,
+    0x9B, 0xED, 0x94, 0x0B, 0x0F, 0x87, 0xC3, 0xE1, 0xF0, 0x07, 0x7A, 0xE8, 0x73, 0x38, 0x1C, 0x0E,
+    0xB7, 0xCE, 0xA8, 0x43, 0x95, 0x0A, 0x05, 0xBB, 0x54, 0xEA, 0x4D, 0x2C, 0x12, 0x99, 0xC1, 0x72,
+    0x0D, 0xA8, 0xB5, 0x42, 0xB7, 0x83, 0x1B, 0x2B, 0xDD, 0xF6, 0x39, 0x85, 0x66, 0x43, 0xB1, 0x50,
+    0x6F, 0x12, 0x26, 0x34, 0x02, 0x4A, 0x05, 0x38, 0x53, 0xA4, 0x94, 0x12, 0xCD, 0x29, 0x59, 0xD8,
+    0x6A, 0xF0, 0xB1, 0xD2, 0x60, 0x52, 0xA1, 0xB1, 0x11, 0x6E, 0x2E, 0x15, 0x3A, 0xFD, 0x0F, 0xDD,
+    0xBF, 0x21, 0x49, 0xB3, 0xD7, 0x9B, 0x4A, 0x8D, 0xA2, 0x4D, 0x5C, 0xEF, 0x8B, 0x8B, 0x1D, 0x60,
+    0x3F, 0xCF, 0x00, 0xCB, 0x95, 0xED, 0xE3, 0x79, 0x8C, 0xF8, 0x77, 0xDD, 0x9E, 0xF5, 0xE0, 0x7F,
+    0xE2, 0x57, 0xF0, 0x6F, 0x4B, 0x03, 0x5E, 0xD2, 0xB4, 0xE3, 0x2D, 0x7E, 0x2D, 0x35, 0xE3, 0x67,
+    0xB4, 0xE0, 0x23, 0x2E, 0xE1, 0x23, 0xF6, 0x3D, 0x6C, 0xDD, 0x82, 0x8F, 0xF9, 0xAF, 0xD0, 0x84,
+    0xBF, 0xFF, 0x39, 0x05, 0x24, 0xA9, 0x27, 0x3B, 0x86, 0x2E, 0xAB, 0xAD, 0xCF, 0x7C, 0x1D, 0xE0,
+    0xAC, 0x07, 0xA7, 0x01, 0x27, 0x61, 0xA4, 0x54, 0xEB, 0x75, 0x05, 0x4D, 0x5D, 0x32, 0x09, 0xDD,
+    0xD5, 0xD0, 0xCC, 0x76, 0xE6, 0x8F, 0x6A, 0xF5, 0xC7, 0x8C, 0x43, 0x7F, 0x4C, 0xAB, 0x85, 0x8C,
+    0xE9, 0x54, 0xD9, 0x15, 0x1E, 0xF9, 0x97, 0x47, 0x5E, 0xCF, 0x68, 0xA4, 0x94, 0x73, 0x27, 0xBF,
+    0xF1, 0x75, 0x8E, 0x29, 0x9C, 0xDC, 0x3C, 0xCA, 0x6E, 0x9D, 0x80, 0xF3, 0xAC, 0x27, 0x7D, 0x3C,
+    0xF6, 0x44, 0x4E, 0x82, 0x62, 0x12, 0x70, 0xCB, 0x47, 0x72, 0x0E, 0xC6, 0x48, 0xA2, 0x94, 0x94,
+    0x30, 0xBA, 0x54, 0xCC, 0x51, 0x7F, 0x23, 0x1A, 0x61, 0x13, 0x26, 0x65, 0xBC, 0xB5, 0xD6, 0x50,
+    0x2A, 0x98, 0x95, 0x46, 0xF8, 0x19, 0x93, 0x4A, 0x4D, 0xF8, 0xD8, 0x68, 0x28, 0x15, 0x3A, 0xD1,
+    0x08, 0xB7, 0x62, 0x13, 0x4A, 0xA5, 0x62, 0x29, 0x49, 0x63, 0xA6, 0x22, 0xD5, 0xD2, 0x2B, 0x5A,
+    0x6A, 0x2D, 0x46, 0x63, 0xF1, 0xAF, 0xB9, 0xD6, 0xEF, 0x32, 0x64, 0x34, 0xD1, 0x48, 0x11, 0x2F,
+    0xC5, 0x5A, 0x7F, 0xA0, 0xC9, 0xC6, 0x4A, 0xCF, 0xAB, 0xAF, 0xD5, 0x26, 0xDA, 0xD5, 0x46, 0xEC,
+    0x9B, 0x92, 0x32, 0x1B, 0xC0, 0x48, 0x4A, 0x3E, 0xEE, 0x55, 0xA9, 0xD5, 0xEF, 0x4A, 0xD1, 0xAA,
+    0xE7, 0x0F, 0x9D, 0xDE, 0x52, 0x90, 0x24, 0x7C, 0x76, 0x2F, 0x36, 0x38, 0x7B, 0xB6, 0x07, 0xCE,
+    0x2F, 0xFB, 0x9C, 0x6F, 0x2A, 0xA5, 0x35, 0xC7, 0x1E, 0xDD, 0xF6, 0xB9, 0x0D, 0x93, 0x8A, 0x84,
+    0x9D, 0xF9, 0x77, 0x19, 0x81, 0xF7, 0xC7, 0xCD, 0xB9, 0x72, 0x0A, 0x5D, 0xB8, 0x7D, 0xB3, 0x5E,
+    0xCD, 0xE3, 0xFD, 0x0D, 0x36, 0xF3, 0x1E, 0x21, 0x18, 0x29, 0xE6, 0x0D, 0x5C, 0xA3, 0xE8, 0xE9,
+    0xF4, 0xB6, 0xC6, 0x52, 0xCA, 0x84, 0x18, 0xAD, 0xA5, 0x46, 0xFF, 0x93, 0xFF, 0xD9, 0xAE, 0xF8,
+    0x09, 0x1B, 0x51, 0x28, 0x14, 0x72, 0x0C, 0xDE, 0x26, 0xDA, 0x15, 0x17, 0xB1, 0x6B, 0x9D, 0x45,
+    0x29, 0x81, 0x93, 0x02, 0x85, 0xB4, 0x40, 0xFB, 0xE6, 0xD7, 0x81, 0xEC, 0xE4, 0x6C, 0x00, 0xDD,
+    0x76, 0x79, 0xD9, 0xEF, 0x61, 0x94, 0x97, 0x14, 0x73, 0x54, 0x61, 0x24, 0xE9, 0x93, 0x1A, 0xE8,
+    0x32, 0x66, 0x30, 0xDB, 0x85, 0x52, 0x41, 0x33, 0x2E, 0xA3, 0xD3, 0x53, 0xA5, 0x23, 0x42, 0x3E,
+    0xC0, 0x9D, 0xED, 0x02, 0x28, 0x7A, 0xC8, 0x19, 0xB1, 0xCC, 0xD1, 0xA2, 0xCC, 0xE8, 0xCE, 0x17,
+    0xB3, 0x6D, 0xCE, 0xB9, 0x88, 0x6E, 0xCB, 0x76, 0x6C, 0x80, 0xCC, 0x1B, 0x00, 0x37, 0x17, 0x37,
+    0xA1, 0x5B, 0x3B, 0x8D, 0xD4, 0xBA, 0xAD, 0x35, 0x87, 0x36, 0x01, 0x27, 0x69, 0xA6, 0xD3, 0xE8,
+    0xB6, 0x1C, 0xC2, 0x86, 0x22, 0xC7, 0x30, 0x6E, 0xC1, 0x26, 0xBA, 0x8D, 0x56, 0xD4, 0x1A, 0xAA,
+    0x5F, 0xEC, 0x82, 0xD3, 0xDC, 0x69, 0xB5, 0xDA, 0x5A, 0xE9, 0x4F, 0xA4, 0x1B, 0xD2, 0xC8, 0x19,
+    0x98, 0x85, 0x4E, 0x34, 0x1A, 0x0B, 0x45, 0xEC, 0x42, 0xF9, 0xF4, 0x43, 0x28, 0x2C, 0x52, 0xB0,
+    0x8A, 0xE7, 0x4A, 0xB4, 0xA2, 0x52, 0x40, 0x11, 0xFB, 0xD7, 0x1C, 0x18, 0xAD, 0x56, 0x7A, 0x41,
+    0x9A, 0xE0, 0x23, 0xA0, 0x80, 0x16, 0xAC, 0x68, 0x35, 0x94, 0x0A, 0x5C, 0xBF, 0x92, 0xF7, 0x3B,
+    0xF7, 0x73, 0xAD, 0xB5, 0x94, 0x7A, 0xA3, 0x11, 0x37, 0xD3, 0xAD, 0xD4, 0xEA, 0x8B, 0xF7, 0x76,
+    0x50, 0x6A, 0xDC, 0xF5, 0x4E, 0x8E, 0xF9, 0x5A, 0x0D, 0x46, 0xC1, 0x6A, 0x6C, 0x14, 0xF8, 0x56,
+    0xBF, 0x77, 0x4E, 0xA3, 0x11, 0xF0, 0x57, 0xB6, 0x5F, 0xD4, 0x78, 0xEA, 0x88, 0x9F, 0xB3, 0x75,
+    0x8A, 0x85, 0x46, 0xAF, 0xB9, 0xD0, 0x68, 0x15, 0x0B, 0x8D, 0xAD, 0x28, 0x34, 0x9A, 0x85, 0x42,
+    0xA3, 0x9F, 0x28, 0xF4, 0x5D, 0x0D, 0x14, 0x7A, 0x69, 0x07, 0x7A, 0xB2, 0xD7, 0x01, 0x85, 0x5E,
+    0xD6, 0x40, 0xA1, 0x17, 0x35, 0x52, 0xE8, 0xBB, 0x8A, 0x14, 0x1A, 0x7D, 0xA2, 0xD0, 0x68, 0x37,
+    0x0A, 0x8D, 0x9D, 0x86, 0x42, 0x63, 0xA3, 0xF1, 0x71, 0xAD, 0x95, 0x16, 0x2B, 0xA1, 0xCD, 0xEE,
+    0x79, 0x0B, 0x38, 0xBB, 0xA0, 0xE8, 0x4B, 0xBF, 0xD4, 0xDA, 0x4A, 0x69, 0xF8, 0xA2, 0x26, 0xDC,
+    0x42, 0xB7, 0x51, 0x6B, 0x28, 0x7E, 0xA9, 0x03, 0xA7, 0xE4, 0xB2, 0x37, 0x47, 0xD1, 0x17, 0x3D,
+    0xC5, 0x4D, 0xB8, 0x9D, 0x1A, 0x8D, 0xB5, 0x26, 0xAC, 0xEE, 0x49, 0x4F, 0x49, 0xA1, 0x92, 0xA4,
+    0xED, 0x94, 0xD5, 0xD8, 0x01, 0xE7, 0xC9, 0x69, 0x36, 0x19, 0xC7, 0xD5, 0x82, 0xE6, 0xDC, 0xE2,
+    0x34, 0x39, 0x48, 0xF2, 0x11, 0x3F, 0xE7, 0xE3, 0xF7, 0xFB, 0x54, 0xA3, 0xB5, 0xD4, 0x56, 0x4A,
+    0x5F, 0x96, 0x26, 0xAF, 0xE8, 0x94, 0x8C, 0xB6, 0x46, 0x6A, 0xA4, 0x40, 0xD1, 0x1F, 0x2B, 0xB1,
+    0xD7, 0x20, 0x17, 0x7F, 0xDD, 0xB3, 0x97, 0xB9, 0xE0, 0xB9, 0xD4, 0xF3, 0xD5, 0xF2, 0xFE, 0x32,
+    0x07, 0xCD, 0xB1, 0x38, 0xB9, 0x2C, 0xB9, 0x20, 0x9C, 0xF5, 0xFB, 0xE8, 0xAF, 0x77, 0x65, 0xAA,
+    0xA9, 0xD6, 0xEB, 0x4A, 0x95, 0x42, 0xA7, 0x2F, 0x2B, 0x94, 0x8A, 0x8A, 0xD8, 0xD5, 0x2E, 0xB4,
+    0xFA, 0xFC, 0x46, 0xA9, 0xD7, 0x35, 0xE0, 0xDF, 0xD2, 0x84, 0x59, 0xFD, 0x42, 0xA3, 0xDB, 0xA2,
+    0xD4, 0x77, 0x14, 0x50, 0xD4, 0x9C, 0xB3, 0x11, 0x36, 0xD5, 0xBA, 0xEF, 0xB6, 0x9C, 0x0B, 0xC9,
+    0xE0, 0x90, 0xD3, 0xC2, 0x4E, 0xAF, 0x29, 0x38, 0xEB, 0xF9, 0xBD, 0xAD, 0xD1, 0x54, 0xEB, 0xBE,
+    0xF6, 0x2C, 0x5F, 0xBC, 0x2D, 0x49, 0x63, 0xAD, 0xC9, 0x28, 0x74, 0x1B, 0x46, 0xB8, 0x19, 0x9B,
+    0x0A, 0x8D, 0x68, 0xAE, 0xD5, 0x57, 0x1A, 0xBB, 0x95, 0x46, 0xBD, 0x9B, 0x31, 0x6B, 0xA1, 0x11,
+    0xC5, 0x5A, 0x7D, 0xA5, 0xD0, 0xAD, 0xB4, 0xC2, 0xCD, 0xB8, 0xB9, 0xD0, 0x58, 0x29, 0xD4, 0xFA,
+    0x0B, 0xBF, 0xD2, 0x49, 0x99, 0x47, 0xB4, 0xED, 0x7E, 0x75, 0xAD, 0xFF, 0x7E, 0x93, 0x63, 0x92,
+    0x7A, 0x3E, 0x0D, 0x9A, 0x3A, 0x07, 0x19, 0xBA, 0x38, 0xC2, 0x3E, 0x56, 0x1A, 0xE0, 0xF2, 0x32,
+    0x93, 0x27, 0xAF, 0xE5, 0xC4, 0xDF, 0xD6, 0xE3, 0xB3, 0x3D, 0x95, 0x42, 0xA3, 0xD7, 0x94, 0xB2,
+    0x51, 0x35, 0x09, 0x93, 0x2A, 0x85, 0x52, 0xC1, 0x2E, 0x98, 0x94, 0x6D, 0xAA, 0x9F, 0x31, 0xA9,
+    0x51, 0x5F, 0x2A, 0xF8, 0x05, 0x93, 0xB2, 0x49, 0x75, 0x09, 0x93, 0x6A, 0x8D, 0x95, 0x82, 0x55,
+    0x9F, 0xF3, 0x15, 0x99, 0x99, 0x91, 0xB0, 0xDA, 0x14, 0xF0, 0x9B, 0x49, 0x70, 0x2B, 0x9B, 0x76,
+    0x93, 0x4E, 0x56, 0xFE, 0xCA, 0xAE, 0xDB, 0x00, 0xA7, 0x15, 0x5A, 0x69, 0x84, 0xCB, 0xCB, 0x67,
+    0x28, 0x38, 0xE3, 0x76, 0x6A, 0x92, 0xD5, 0x5D, 0xBD, 0xA4, 0x94, 0xC9, 0x54, 0xA1, 0x95, 0x16,
+    0xB4, 0x16, 0xD9, 0xA8, 0x2A, 0xF2, 0x1E, 0x77, 0x32, 0x47, 0xB7, 0xDA, 0xAD, 0xE6, 0x08, 0xDC,
+    0xCA, 0x76, 0xA2, 0xCB, 0x91, 0x54, 0x6A, 0x53, 0xA1, 0x7A, 0xC3, 0x3C, 0xAF, 0xA1, 0x8E, 0x7E,
+    0xE1, 0x6B, 0x5D, 0x4E, 0xF5, 0x4E, 0x38, 0xA9, 0xAF, 0xA5, 0x19, 0x23, 0x81, 0xD3, 0xFF, 0x89,
+    0x85, 0x96, 0x95, 0x76, 0xB3, 0xA1, 0xD4, 0xA7, 0x13, 0xBA, 0xAB, 0xB7, 0x35, 0x4A, 0x9A, 0x3A,
+    0x69, 0xE4, 0xDA, 0xD7, 0x81, 0x26, 0x42, 0x93, 0xB2, 0xAF, 0x5E, 0x28, 0x64, 0x9B, 0xED, 0xA4,
+    0x2F, 0x4B, 0x8A, 0x92, 0x92, 0x95, 0xD6, 0x53, 0x52, 0xE8, 0x98, 0x0D, 0xFA, 0xEB, 0x4E, 0x2C,
+    0x05, 0x46, 0x9A, 0x6A, 0x69, 0x21, 0x03, 0x9B, 0x2B, 0x5C, 0xBF, 0xE0, 0xDC, 0x8F, 0xE7, 0x77,
+    0xC6, 0x4E, 0x73, 0xAB, 0xB9, 0xD1, 0x5A, 0x6B, 0x2D, 0x24, 0x6E, 0xAB, 0x2F, 0x15, 0x76, 0xD5,
+    0xEC, 0x67, 0x4C, 0x22, 0xBB, 0x45, 0xCD, 0x7B, 0xB8, 0x30, 0xE3, 0x67, 0xCC, 0x9A, 0x2F, 0x84,
+    0x4E, 0xFD, 0x8E, 0xF7, 0x59, 0xE5, 0xD1, 0xA4, 0xD7, 0x95, 0x70, 0xFA, 0xAE, 0x56, 0xF8, 0x02,
+    0xD7, 0x7A, 0xAC, 0xF4, 0x09, 0xE9, 0xD3, 0xD2, 0xE8, 0xF5, 0x03, 0x69, 0xEA, 0x72, 0xE6, 0xC4,
+    0x4F, 0xA5, 0x22, 0x36, 0x62, 0x13, 0xDD, 0x42, 0xA3, 0xA1, 0x49, 0x14, 0x8A, 0xD5, 0x96, 0x51,
+    0x91, 0x9E, 0x5A, 0x7D, 0xAE, 0xAD, 0x1D, 0xC1, 0x24, 0x13, 0xA1, 0xD2, 0xA7, 0x67, 0xC0, 0xFF,
+    0x28, 0x01, 0xED, 0xB6, 0x71, 0x74, 0x15, 0x71, 0x1A, 0x4E, 0xE9, 0xEB, 0x72, 0x67, 0x00, 0x3F,
+    0xA0, 0xD6, 0x58, 0x6D, 0x1C, 0x30, 0xFA, 0x81, 0x34, 0xB5, 0x73, 0x25, 0x19, 0xA5, 0x42, 0x83,
+    0xD1, 0xE8, 0x56, 0x4C, 0xC2, 0xC6, 0x4A, 0xA1, 0x52, 0xA8, 0x36, 0xBA, 0x15, 0xBB, 0xE2, 0x02,
+    0x9A, 0x6A, 0x4D, 0x4D, 0xA2, 0x11, 0x12, 0xEA, 0x71, 0xB1, 0xD5, 0xDC, 0x46, 0x2A, 0x7D, 0x62,
+    0xD5, 0x1F, 0x6F, 0x60, 0x92, 0xF9, 0x93, 0x64, 0x46, 0xD0, 0xDD, 0xD9, 0xDF, 0x4D, 0xD0, 0xAE,
+    0xAE, 0x5E, 0xDD, 0x00, 0xEE, 0xF5, 0xC9, 0xBE, 0x1E, 0xA1, 0xD2, 0x9A, 0xCB, 0x67, 0x14, 0xBA,
+    0x1C, 0xAC, 0xA6, 0x1C, 0xFD, 0xB7, 0xEA, 0x5B, 0x0D, 0xD9, 0x67, 0x73, 0x73, 0xC6, 0x21, 0x2A,
+    0x5D, 0xB1, 0xEC, 0x46, 0x6B, 0xA3, 0xC5, 0x2A, 0xB5, 0x5A, 0x3A, 0xCD, 0x95, 0xA6, 0x52, 0xB1,
+    0x12, 0xF8, 0xA5, 0x49, 0x60, 0xD6, 0x0C, 0xA8, 0xD8, 0x4C, 0xCF, 0x1B, 0x80, 0x9C, 0xBA, 0xCA,
+    0x59, 0x54, 0x9B, 0x19, 0x15, 0x39, 0xE4, 0xCA, 0x41, 0xA2, 0x22, 0x98, 0xE8, 0x16, 0xF0, 0xA3,
+    0xD9, 0x28, 0x35, 0xB4, 0xEA, 0x3B, 0x8D, 0x9D, 0x16, 0xA7, 0xE8, 0x94, 0x9C, 0x62, 0x4E, 0x8E,
+    0xE4, 0xEE, 0x0A, 0xC7, 0xEE, 0x9A, 0xDE, 0x4B, 0x77, 0xF1, 0x70, 0x77, 0x75, 0x8F, 0xE8, 0xAE,
+    0xA3, 0xEF, 0xF5, 0xCE, 0xEE, 0x2A, 0x76, 0x8C, 0x24, 0x63, 0x34, 0x39, 0x09, 0xBC, 0x1E, 0xA1,
+    0x99, 0xDD, 0xE7, 0xFF, 0x98, 0x57, 0x0F, 0x9D, 0x72, 0xF8, 0x98, 0xAB, 0xAB, 0x1E, 0xE8, 0xEE,
+    0x73, 0xA4, 0x2E, 0x5D, 0x58, 0x29, 0x3B, 0xD1, 0x37, 0x24, 0xA5, 0x76, 0xAC, 0x15, 0x2C, 0x76,
+    0x65, 0xA9, 0x34, 0xD1, 0x1B, 0xED, 0xF9, 0xB5, 0x56, 0x27, 0x66, 0xE4, 0x00, 0x3E, 0xF1, 0xB5,
+    0x5A, 0xA1, 0x9E, 0xEC, 0x8A, 0x7D, 0x4A, 0x63, 0xB1, 0x59, 0x5D, 0xDE, 0x99, 0x25, 0xE9, 0x79,
+    0x65, 0xE8, 0x67, 0xC7, 0xC3, 0x33, 0x72, 0x11, 0x6A, 0xCD, 0xB5, 0x52, 0xA5, 0x0B, 0x14, 0x70,
+    0x23, 0xDD, 0x4C, 0xBD, 0x82, 0x06, 0x72, 0x48, 0x5A, 0xE6, 0x9C, 0xCD, 0x89, 0x7C, 0x5D, 0x6B,
+    0xA8, 0x35, 0x14, 0x1A, 0x73, 0x62, 0x32, 0x60, 0x22, 0xF5, 0x7A, 0xFC, 0x99, 0x8D, 0xB4, 0x0B,
+    0xD5, 0x46, 0xA1, 0xFE, 0xF8, 0xB4, 0x0D, 0x34, 0xD1, 0x69, 0x2E, 0xB5, 0xD2, 0x09, 0xAE, 0x41,
+    0xBD, 0xBA, 0x97, 0x7E, 0xB1, 0xBF, 0x8F, 0x0D, 0x40, 0xA3, 0xBE, 0xD2, 0x82, 0x34, 0x14, 0x3E,
+    0x5E, 0x2D, 0xE7, 0x42, 0xBD, 0x52, 0xA8, 0x3F, 0x96, 0x21, 0x51, 0x65, 0xE6, 0xB7, 0x9D, 0xA9,
+    0x35, 0xEC, 0xCE, 0x48, 0xB7, 0xF5, 0xED, 0x9A, 0x91, 0xBF, 0x61, 0xFF, 0x59, 0x29, 0xF6, 0x72,
+    0x56, 0xDB, 0xF1, 0x69, 0x66, 0xC6, 0xA4, 0x4A, 0x1B, 0xDA, 0xB0, 0x2B, 0xC5, 0x31, 0xEF, 0x54,
+    0x6F, 0xD4, 0x83, 0xD4, 0x9B, 0x7B, 0xD2, 0xF7, 0x64, 0x25, 0x2D, 0x2A, 0xA5, 0xBB, 0xB1, 0x50,
+    0x2A, 0x06, 0xFE, 0x6D, 0x4F, 0x15, 0xF8, 0xF7, 0x74, 0xB1, 0x5C, 0xF1, 0xA1, 0x5D, 0x2A, 0xF5,
+    0x2E, 0xB6, 0x5B, 0xA1, 0xE0, 0x96, 0x46, 0xBD, 0x62, 0xBB, 0xA1, 0xA9, 0x4B, 0xF8, 0xB9, 0x15,
+    0x26, 0x55, 0x1A, 0x1A, 0xA1, 0xA9, 0x50, 0xB0, 0x73, 0x66, 0x5C, 0xB5, 0x53, 0xB1, 0x52, 0xF4,
+    0x7C, 0xE4, 0xB7, 0x28, 0x47, 0xDA, 0xB9, 0x14, 0xA5, 0x06, 0x1B, 0x31, 0x4B, 0xA5, 0xBE, 0x52,
+    0x70, 0x33, 0x36, 0xE5, 0x3E, 0xF0, 0xF1, 0xCA, 0xD3, 0x5C, 0xDE, 0x34, 0x1B, 0x36, 0x36, 0x1B,
+    0x76, 0xAA, 0x57, 0xDA, 0xB1, 0x48, 0xD0, 0x67, 0x96, 0xFB, 0x87, 0x72, 0x1D, 0xAA, 0x9D, 0x37,
+    0xE5, 0xC7, 0x5D, 0xD0, 0x86, 0x1D, 0xBB, 0xDB, 0xF9, 0x4E, 0x19, 0x3A, 0x2C, 0xFC, 0xCE, 0x3C,
+    0xFF, 0xCD, 0x47, 0xD2, 0xF9, 0x9A, 0x7C, 0xB5, 0x3E, 0x42, 0xB2, 0xF3, 0x8E, 0xD0, 0x86, 0x8C,
+    0x90, 0x1D, 0xE1, 0xC0, 0x69, 0x17, 0xE5, 0xFC, 0xA3, 0x9C, 0x58, 0x31, 0x3F, 0xCA, 0x61, 0x51,
+    0x4E, 0xBB, 0xE1, 0x9E, 0xCF, 0x3C, 0x9D, 0xB9, 0x13, 0x50, 0x68, 0x4F, 0x4E, 0x4D, 0x8D, 0x06,
+    0xA8, 0xD6, 0x3C, 0xFC, 0x7D, 0xA8, 0x8E, 0x69, 0xBE, 0x6D, 0xA7, 0x75, 0x1D, 0xB3, 0x51, 0x3D,
+    0x95, 0x2E, 0x2F, 0xB5, 0x80, 0x0F, 0xD4, 0x0A, 0xB4, 0x0B, 0xD8, 0x2C, 0x0A, 0xE5, 0x8E, 0x55,
+    0x1B, 0x5D, 0xD8, 0x4C, 0xA0, 0xB8, 0x97, 0x67, 0xA4, 0xA4, 0x9D, 0x16, 0x19, 0x78, 0x30, 0xDF,
+    0xA2, 0x19, 0xAF, 0x56, 0xA9, 0x3C, 0x22, 0x9B, 0xDB, 0x55, 0x28, 0xBA, 0xDE, 0x72, 0x42, 0xE9,
+    0x77, 0xF8, 0xA0, 0xB7, 0xCA, 0xF5, 0x5C, 0x85, 0x1D, 0x48, 0xDE, 0x51, 0xD1, 0x3D, 0x96, 0xC1,
+    0x7C, 0x3F, 0x2B, 0xB2, 0xD4, 0x64, 0xC7, 0x06, 0x13, 0x80, 0x66, 0xE0, 0x6B, 0x1F, 0x74, 0x59,
+    0xC9, 0x15, 0x8A, 0xCD, 0x0C, 0x94, 0xFA, 0x76, 0x26, 0x97, 0x25, 0x93, 0x80, 0x4A, 0xCF, 0x67,
+    0x22, 0xDA, 0xDC, 0x2E, 0x59, 0xAC, 0x3E, 0xF4, 0x48, 0x21, 0xF9, 0x80, 0xD0, 0x0C, 0x7F, 0x4D,
+    0x58, 0x7C, 0x27, 0xAA, 0x6F, 0xCE, 0x5E, 0x8C, 0xC0, 0xF9, 0x8E, 0x89, 0x00, 0xE4, 0x99, 0x51,
+    0x2E, 0x90, 0x9D, 0xD8, 0x7D, 0xA6, 0x5C, 0xF9, 0x60, 0x0E, 0x5D, 0xA1, 0xE1, 0x54, 0xB8, 0x56,
+    0xD3, 0x69, 0x9B, 0xBD, 0x79, 0x3E, 0xFA, 0x50, 0xD7, 0x16, 0x87, 0xC3, 0xE1, 0x70, 0xCB, 0x48,
+    0xD2, 0xE2, 0x4F, 0xDC, 0x36, 0x85, 0x4E, 0x97, 0xDF, 0x10, 0x36, 0x51, 0x65, 0xD2, 0xCA, 0x54,
+    0x29, 0x60, 0xFB, 0x56, 0xF0, 0x47, 0xEF, 0xA0, 0xB8, 0x5C, 0xBB, 0x79, 0xA4, 0xDA, 0x65, 0x2A,
+    0x43, 0x26, 0x60, 0xBD, 0x76, 0x79, 0xF1, 0x68, 0x42, 0x4C, 0x3B, 0xB4, 0x02, 0xFF, 0xE0, 0xD9,
+    0x26, 0x36, 0x27, 0x4B, 0xAF, 0x2B, 0x25, 0x19, 0x4F, 0xD5, 0xFA, 0xD2, 0xC9, 0x2B, 0x29, 0x76,
+    0x1E, 0x40, 0x80, 0x4A, 0x0B, 0xD0, 0xDE, 0x07, 0xF8, 0x67, 0xFC, 0x1A, 0x55, 0xEA, 0xFC, 0xE2,
+    0x94, 0x12, 0x6C, 0x32, 0x91, 0x59, 0x13, 0xD4, 0xC9, 0x8F, 0xE0, 0x82, 0x0B, 0xD4, 0x09, 0x07,
+    0xF5, 0xC0, 0x1F, 0xFE, 0x1A, 0xF5, 0x14, 0x80, 0xEF, 0xDD, 0x40, 0xA3, 0x5A, 0x3D, 0x36, 0x75,
+    0x2B, 0xF8, 0xE8, 0x66, 0x50, 0xAF, 0x01, 0x6E, 0xF2, 0x91, 0x87, 0x3A, 0xE9, 0x70, 0x38, 0x1C,
+    0x0E, 0x99, 0xA4, 0x6A, 0x74, 0x9C, 0x08, 0xA6, 0x58, 0xEB, 0xB5, 0xCB, 0xCC, 0xCC, 0xC8, 0x95,
+    0x5A, 0x50, 0xA4, 0x1D, 0x2B, 0x05, 0x3E, 0xFA, 0x8E, 0x62, 0x9E, 0xDD, 0x7A, 0x98, 0xE9, 0x99,
+    0x2B, 0xF5, 0xD6, 0xE5, 0xD3, 0x8F, 0xE6, 0x63, 0x55, 0x53, 0xA5, 0x80, 0x79, 0xF0, 0xEC, 0x26,
+    0xC7, 0xC3, 0xD1, 0x9F, 0x88, 0x9D, 0xB9, 0x24, 0xF3, 0x19, 0xB0, 0x80, 0x99, 0x73, 0x82, 0x4E,
+    0x01, 0x2F, 0xB8, 0x3D, 0xC3, 0xF9, 0x15, 0xB6, 0xEA, 0xDF, 0x26, 0xE9, 0x0F, 0xCE, 0xA0, 0x8C,
+    0x79, 0x22, 0xE1, 0x82, 0x53, 0xDF, 0x69, 0x2C, 0x74, 0xB1, 0x67, 0x4F, 0xFE, 0x2E, 0x4A, 0x70,
+    0xF6, 0x35, 0xB0, 0x31, 0x27, 0xCF, 0x15, 0xAB, 0xCD, 0x46, 0x33, 0x99, 0xEF, 0x6F, 0xD8, 0xE7,
+    0xC7, 0x07, 0xCE, 0x44, 0xEE, 0xC2, 0xD5, 0x48, 0xB3, 0xD3, 0xD6, 0xD7, 0x0A, 0x39, 0xC3, 0x9F,
+    0x79, 0x78, 0xD5, 0xDF, 0xF0, 0xB0, 0xD0, 0x7D, 0xBC, 0xF4, 0x44, 0xEE, 0x90, 0x1C, 0x93, 0x4C,
+    0x4D, 0xB4, 0x8B, 0x49, 0x36, 0xD9, 0x64, 0x17, 0x9B, 0x4C, 0xEC, 0xE6, 0x22, 0x23, 0x97, 0xA7,
+    0x7C, 0xB1, 0x91, 0x66, 0x23, 0xCD, 0x9D, 0x74, 0x81, 0x4B, 0xF9, 0xC9, 0xEF, 0xC7, 0x7F, 0xB7,
+    0xF5, 0x4D, 0x7E, 0xF6, 0x92, 0xCB, 0x73, 0x3E, 0x9D, 0xEF, 0x29, 0x6C, 0x9B, 0x6D, 0xDF, 0x5B,
+    0x7B, 0xC6, 0x3B, 0x1B, 0xBF, 0x2F, 0xE5, 0xB0, 0x92, 0x6F, 0xB6, 0x0B, 0xEF, 0xFA, 0xB9, 0x76,
+    0xE8, 0x39, 0x3B, 0x1C, 0x6E, 0x48, 0x03, 0x56, 0xFA, 0x74, 0x4E, 0xFD, 0xAC, 0x5D, 0x4E, 0xA4,
+    0x8C, 0x95, 0x44, 0xE6, 0xB9, 0xAD, 0x3B, 0xCF, 0xED, 0xC8, 0x3F, 0x4B, 0x3B, 0xCF, 0x6D, 0xD9,
+    0x69, 0x70, 0x33, 0x3E, 0x60, 0x7E, 0xAA, 0x58, 0x0A, 0xFC, 0x3D, 0x4D, 0x4D, 0xA2, 0x54, 0xAB,
+    0xD1, 0x44, 0x9A, 0xD4, 0x2A, 0xF8, 0x80, 0x89, 0x9D, 0xBE, 0x2C, 0xF0, 0xC1, 0xE8, 0x89, 0x44,
+    0x29, 0xAC, 0x4C, 0xA4, 0x49, 0x38, 0xF9, 0x80, 0x89, 0xF8, 0x9D, 0xE7, 0xA6, 0xFC, 0x9E, 0x42,
+    0x99, 0xE7, 0x56, 0xEE, 0x34, 0xB8, 0x4A, 0xA2, 0xD0, 0xAB, 0x54, 0x4A, 0x38, 0xAD, 0x34, 0x8A,
+    0x55, 0x66, 0xDA, 0x87, 0x56, 0x3B, 0xAF, 0x03, 0xE0, 0xA3, 0xFD, 0x3E, 0x97, 0xED, 0xA8, 0xB6,
+    0x73, 0xC6, 0xF3, 0x01, 0xA3, 0x29, 0xDB, 0xC2, 0xAC, 0xC2, 0xA1, 0xF0, 0xF9, 0x62, 0x31, 0xFC,
+    0x6C, 0x03, 0xFD, 0xFA, 0xD3, 0xE5, 0x78, 0xD0, 0x16, 0xD9, 0xF9, 0xC8, 0x31, 0x75, 0x4E, 0x84,
+    0x1F, 0xE3, 0x96, 0x3A, 0x0B, 0x78, 0x93, 0xFD, 0xF4, 0xB2, 0xE7, 0x03, 0xDA, 0x12, 0x9F, 0xDD,
+    0xA7, 0xBE, 0x84, 0x2B, 0x04, 0x99, 0x36, 0x3B, 0x65, 0xF6, 0xC5, 0xEC, 0x20, 0x0D, 0x1A, 0xA0,
+    0xDA, 0xB0, 0x03, 0xF0, 0xCD, 0x2B, 0xBA, 0xEE, 0x03, 0x26, 0x13, 0x00, 0xC5, 0x86, 0x07, 0x2A,
+    0xDD, 0xC8, 0x78, 0xCA, 0x53, 0xD9, 0xA7, 0x79, 0x2A, 0xD3, 0x23, 0x0A, 0xE5, 0x71, 0xF4, 0xD8,
+    0x07, 0xB3, 0x09, 0x4A, 0xAE, 0x8E, 0x8A, 0x4C, 0x8C, 0x38, 0x3A, 0x77, 0x3B, 0x2D, 0xE1, 0x04,
+    0x50, 0xC1, 0xED, 0x5D, 0x8B, 0x9E, 0x3F, 0x4A, 0x89, 0x7E, 0xD0, 0x08, 0x6F, 0x57, 0x9A, 0xA7,
+    0x9C, 0x1F, 0x52, 0xA0, 0xEE, 0x21, 0x8A, 0x59, 0xF6, 0xE9, 0x41, 0x99, 0x35, 0xF9, 0x61, 0xFE,
+    0x81, 0x34, 0x4E, 0xF6, 0x9E, 0xF7, 0xA9, 0xC9, 0xE0, 0xD7, 0xDD, 0x9C, 0x64, 0x0E, 0x54, 0xF2,
+    0x39, 0x2B, 0x99, 0x43, 0x25, 0x17, 0xEA, 0x08, 0x14, 0x13, 0xBF, 0xFB, 0x0F, 0x44, 0x72, 0xB2,
+    0xDC, 0xAC, 0x79, 0xD9, 0x12, 0x1F, 0x5D, 0x26, 0x50, 0x37, 0x39, 0x0A, 0x8D, 0x19, 0xE4, 0x5E,
+    0x73, 0x7A, 0xFF, 0x2C, 0xAF, 0x46, 0xF0, 0xCE, 0xC0, 0xE9, 0x16, 0x87, 0xC3, 0xC1, 0xE5, 0x7C,
+    0xC9, 0x4F, 0xA5, 0xB5, 0xC8, 0x4E, 0x58, 0xDF, 0x68, 0xEB, 0x5B, 0xF5, 0x7F, 0xDB, 0xAD, 0x11,
+    0x4F, 0xAD, 0x71, 0x6C, 0x1C, 0x17, 0x69, 0x76, 0x7A, 0xA7, 0x5B, 0x77, 0x4F, 0x71, 0xC6, 0xAD,
+    0x60, 0xB4, 0x49, 0x21, 0xAB, 0x9A, 0xC8, 0x1E, 0xCC, 0x93, 0xF3, 0x8A, 0x40, 0x71, 0xF9, 0x34,
+    0xC0, 0x3F, 0x02, 0x68, 0x07, 0xA0, 0xCD, 0x4B, 0x8B, 0x9C, 0xF8, 0x2C, 0xCD, 0xB6, 0xCF, 0x4B,
+    0xCD, 0x73, 0x5A, 0x7F, 0x16, 0x38, 0xBC, 0x05, 0x74, 0xFB, 0x3A, 0x32, 0xC3, 0xCE, 0x0A, 0xB9,
+    0x7F, 0x5B, 0x98, 0xA5, 0x52, 0xA8, 0x57, 0x7C, 0xC4, 0xE7, 0x4C, 0x59, 0x23, 0xE0, 0x9F, 0x2A,
+    0x64, 0x2E, 0x8A, 0x39, 0xA2, 0x0A, 0xD8, 0xAD, 0x54, 0x68, 0x37, 0x7C, 0xAC, 0xD5, 0x9F, 0x98,
+    0x4A, 0xDB, 0x6D, 0xFD, 0xB0, 0x95, 0xA4, 0xEF, 0x49, 0x2F, 0x29, 0x1A, 0x05, 0x45, 0xBE, 0xC0,
+    0xF9, 0x29, 0x90, 0xAF, 0xE2, 0x29, 0xDC, 0x57, 0x38, 0x02, 0x9F, 0x76, 0x02, 0xCC, 0x74, 0x82,
+    0xA7, 0xBE, 0xF6, 0xF7, 0xA0, 0xB4, 0xFF, 0xE6, 0x14, 0xCA, 0xBA, 0x74, 0xC4, 0x82, 0xEC, 0xBD,
+    0x05, 0xBA, 0x51, 0xD0, 0x4E, 0xED, 0x44, 0x1D, 0x8B, 0x87, 0xE7, 0x57, 0x17, 0x37, 0xF7, 0x35,
+    0x0D, 0x0A, 0x69, 0xA3, 0xCC, 0x33, 0xEC, 0x7F, 0xE8, 0x13, 0x7E, 0x6A, 0x45, 0x37, 0x97, 0x0A,
+    0x65, 0xCA, 0x3D, 0x64, 0x12, 0xF0, 0x79, 0x91, 0x67, 0x63, 0x78, 0x1D, 0x27, 0x0D, 0x68, 0x69,
+    0x84, 0x5D, 0x4A, 0x85, 0x6E, 0x7D, 0x50, 0xDA, 0xFB, 0x5E, 0x5F, 0xB5, 0x92, 0xF4, 0x84, 0xF4,
+    0x79, 0x05, 0xAF, 0x4A, 0xA1, 0x78, 0x9A, 0x8F, 0x52, 0xAC, 0xC5, 0x4A, 0xA1, 0x6F, 0x2B, 0xE0,
+    0xA2, 0x8F, 0x74, 0xA9, 0x4B, 0x54, 0x6B, 0xB5, 0x3E, 0x4A, 0x69, 0xFE, 0x0A, 0x88, 0x69, 0x7F,
+    0x27, 0xF4, 0xAE, 0xE3, 0x02, 0x27, 0x23, 0xFC, 0xDE, 0x06, 0x74, 0x13, 0x94, 0x09, 0xF0, 0x43,
+    0x16, 0xAB, 0xEA, 0xD8, 0x4D, 0x67, 0x00, 0xFF, 0x91, 0x7D, 0xF9, 0x95, 0x6E, 0x39, 0x26, 0x86,
+    0xEC, 0x0C, 0x98, 0x08, 0x74, 0x01, 0xDE, 0xE1, 0x9E, 0x9D, 0xF5, 0xD0, 0x68, 0xC9, 0x8D, 0x61,
+    0xA4, 0x54, 0xE8, 0x2F, 0xB4, 0xB4, 0x09, 0x45, 0x3F, 0x16, 0xBA, 0x2B, 0x2A, 0x7D, 0x3A, 0xD1,
+    0xAE, 0x4E, 0xD2, 0x5F, 0x9D, 0x22, 0x6E, 0x93, 0xF6, 0xD1, 0x58, 0x9C, 0xD6, 0x44, 0x68, 0x35,
+    0xF2, 0x9B, 0x9D, 0x36, 0x1F, 0xAD, 0xA4, 0x90, 0xBB, 0x40, 0x1A, 0x28, 0x9E, 0xBC, 0x79, 0xF4,
+    0x90, 0xBB, 0x01, 0x50, 0xBF, 0x7B, 0xD4, 0x99, 0x4A, 0x79, 0x1C, 0xE1, 0x16, 0xE0, 0x9F, 0xFF,
+    0x6A, 0x0A, 0xF7, 0xC5, 0x23, 0x6A, 0x6C, 0xB7, 0x7D, 0x99, 0x82, 0xF6, 0x07, 0x09, 0x54, 0x2F,
+    0x34, 0xB1, 0x89, 0xD8, 0xBE, 0x1D, 0xDE, 0x31, 0x14, 0xCA, 0x7D, 0x26, 0x4B, 0x96, 0x20, 0xF7,
+    0xA6, 0xDB, 0x2A, 0x61, 0x93, 0x99, 0x71, 0x51, 0x01, 0xBD, 0x28, 0x2A, 0x7D, 0x5E, 0x39, 0xD4,
+    0xCF, 0xB3, 0xC4, 0xEE, 0xE9, 0x38, 0x36, 0xDC, 0x83, 0x05, 0x12, 0x66, 0xCE, 0x6B, 0xE9, 0x4E,
+    0x6A, 0x8F, 0x6B, 0x75, 0xF4, 0xB5, 0x34, 0xC1, 0x67, 0xBF, 0x0A, 0xDF, 0xE2, 0x5B, 0x34, 0x5B,
+    0xB3, 0x61, 0x93, 0x5D, 0xD0, 0xA4, 0xA9, 0xD8, 0x0A, 0x3D, 0x52, 0xF6, 0xFF, 0x0E, 0x08, 0x75,
+    0x45, 0x4F, 0x11, 0x41, 0xE0, 0x26, 0xDA, 0x15, 0x34, 0x66, 0x3C, 0xF7, 0xE1, 0xF0, 0xE7, 0x5C,
+    0xB1, 0x55, 0xAA, 0x24, 0x6E, 0xBF, 0x37, 0x46, 0x55, 0x3E, 0x28, 0xA5, 0x17, 0xA5, 0x24, 0x6D,
+    0x70, 0x01, 0x5F, 0x02, 0x3B, 0xD2, 0xCD, 0xB4, 0x89, 0x26, 0x51, 0xAD, 0x90, 0xE0, 0x9F, 0xF0,
+    0x7E, 0xBE, 0xE7, 0x7A, 0xA0, 0x16, 0x68, 0xC1, 0x68, 0xAC, 0x16, 0xA1, 0x7A, 0x31, 0xA3, 0xB9,
+    0x3B, 0xB3, 0x3C, 0xCC, 0x13, 0xB3, 0x8A, 0x95, 0xC4, 0xE3, 0xBF, 0x28, 0x3C, 0xD3, 0x48, 0x37,
+    0x32, 0x2F, 0x61, 0x30, 0x83, 0xF9, 0xCA, 0xD6, 0x6C, 0x8A, 0xD2, 0xD6, 0x6E, 0x2E, 0xB8, 0xF0,
+    0xCE, 0x29, 0xEA, 0xEF, 0xC7, 0x5B, 0xE0, 0x76, 0xFF, 0x3B, 0x40, 0xB7, 0x35, 0x01, 0x2A, 0xDD,
+    0x5F, 0x4F, 0xB3, 0x7E, 0xAA, 0xE8, 0x13, 0xF0, 0x5B, 0xC5, 0xF6, 0x2E, 0xC0, 0xC6, 0x63, 0x5C,
+    0x83, 0x73, 0x05, 0xBF, 0x51, 0x65, 0x0C, 0xDE, 0x4A, 0xDA, 0x59, 0x8A, 0x02, 0x6D, 0x75, 0x7E,
+    0x5F, 0xFB, 0x3E, 0x70, 0x8C, 0xF6, 0x03, 0xAF, 0xC9, 0x68, 0x31, 0x52, 0x2D, 0x3D, 0x2F, 0x45,
+    0xAF, 0xB4, 0x5B, 0xD2, 0x89, 0xBC, 0x6A, 0xC5, 0x6E, 0xA6, 0xBA, 0x74, 0x0A, 0x42, 0x73, 0xD4,
+    0xF1, 0x2D, 0x80, 0xFA, 0x11, 0x03, 0xA1, 0xD9, 0x67, 0x2E, 0xCF, 0x39, 0x86, 0xE9, 0x74, 0x47,
+    0xB1, 0x15, 0x6E, 0x6B, 0x44, 0xA3, 0xBB, 0x0A, 0x79, 0x85, 0x22, 0xBB, 0xBA, 0x85, 0x46, 0x77,
+    0x4E, 0x44, 0xA5, 0xBF, 0xCA, 0x44, 0xA5, 0x44, 0xA3, 0x4E, 0x54, 0xBA, 0xAB, 0x11, 0x4D, 0x4A,
+    0x28, 0x76, 0xFA, 0xA1, 0x96, 0xF2, 0x38, 0x33, 0x7A, 0xA1, 0x90, 0x26, 0x28, 0x76, 0xCC, 0x7F,
+    0x00, 0x78, 0xEE, 0x04, 0xEE, 0xDB, 0x08, 0x74, 0x33, 0x79, 0x7D, 0x29, 0x9A, 0x05, 0x28, 0x16,
+    0xE0, 0x67, 0x9C, 0xD9, 0x5F, 0x45, 0x69, 0x1F, 0xEF, 0x8F, 0xF4, 0xF7, 0x2E, 0xB3, 0xFC, 0x23,
+    0x34, 0x6F, 0x6C, 0x50, 0x2F, 0x66, 0xA4, 0x4A, 0xD5, 0x42, 0x91, 0xF8, 0x17, 0x3F, 0xEB, 0xA1,
+    0x18, 0x2D, 0x1C, 0x57, 0xF7, 0xD1, 0x86, 0xDB, 0xBC, 0x82, 0x4D, 0x85, 0x16, 0x93, 0x30, 0x6A,
+    0x45, 0xA5, 0x17, 0x35, 0xA0, 0x37, 0x35, 0x61, 0x36, 0x7F, 0x2A, 0xED, 0xCB, 0xB9, 0xB4, 0x11,
+    0x93, 0x5C, 0xA2, 0x55, 0xAB, 0xBE, 0xD2, 0x53, 0x8A, 0x95, 0x82, 0xD3, 0x9F, 0xE5, 0xE5, 0x1A,
+    0x26, 0xFC, 0x3E, 0xEB, 0x6B, 0xD8, 0xD7, 0xA5, 0x71, 0xBD, 0xEB, 0xB1, 0xD1, 0x46, 0xBA, 0xB5,
+    0x5B, 0xA9, 0x55, 0x0B, 0x7C, 0xEF, 0x1F, 0x81, 0xB2, 0xFC, 0x0A, 0x78, 0x69, 0xFC, 0x36, 0x00,
+    0xBF, 0x9F, 0xE3, 0xBA, 0xF1, 0x01, 0xF7, 0x62, 0x4F, 0xD5, 0x98, 0x25, 0x87, 0xC5, 0x3D, 0x40,
+    0x9B, 0x83, 0xE2, 0x3F, 0x7C, 0xE4, 0x98, 0xFB, 0xFB, 0x40, 0x32, 0x3A, 0x39, 0xD0, 0x6D, 0x4E,
+    0x08, 0x2E, 0x9C, 0xA8, 0xC4, 0x65, 0xAE, 0x42, 0x8E, 0x5C, 0xFD, 0x00, 0xFB, 0x72, 0x33, 0x94,
+    0xC3, 0xDF, 0xE3, 0xEA, 0x14, 0xDF, 0xE4, 0x14, 0x30, 0xEC, 0xD8, 0x44, 0xCE, 0xF5, 0xCA, 0x4E,
+    0x80, 0xBF, 0x91, 0x00, 0x3B, 0xD8, 0x01, 0xBA, 0x50, 0x8F, 0x8F, 0xAA, 0xC8, 0x75, 0xF5, 0xD7,
+    0x7D, 0xEF, 0x34, 0x5A, 0x8D, 0x46, 0x73, 0xA7, 0xB9, 0x56, 0x2A, 0xFC, 0x7B, 0x2E, 0xF5, 0x23,
+    0x2E, 0x8C, 0x57, 0xAA, 0x23, 0xDC, 0x4A, 0x7D, 0x9A, 0x36, 0x20, 0x0D, 0x9D, 0x74, 0x47, 0xB1,
+    0x90, 0x3E, 0xA5, 0x99, 0xE2, 0x69, 0x0E, 0x50, 0xCF, 0xF5, 0xCC, 0x2E, 0xFA, 0x65, 0xCE, 0xF8,
+    0xBA, 0xE8, 0x22, 0xB4, 0x73, 0x3B, 0xBF, 0x3B, 0x3E, 0x5D, 0xDC, 0x99, 0x8B, 0x6F, 0xCC, 0xB5,
+    0xD6, 0x4A, 0x6B, 0x29, 0x7D, 0x42, 0xEA, 0x9D, 0xC2, 0xE3, 0x7F, 0xB3, 0xD6, 0x8F, 0x57, 0x5B,
+    0xBF, 0x6F, 0xD4, 0x97, 0x8A, 0xB5, 0xC6, 0x9D, 0xC6, 0xDD, 0xEE, 0xD3, 0x88, 0xF5, 0x96, 0x44,
+    0xA7, 0xD9, 0xA9, 0xE7, 0x7A, 0x9F, 0x97, 0x05, 0x3A, 0x1C, 0x0E, 0x87, 0x43, 0x9E, 0xF6, 0xAB,
+    0x8C, 0x4D, 0xEF, 0x3B, 0xDD, 0x71, 0xC7, 0xEB, 0xAB, 0xB7, 0x75, 0x79, 0x27, 0x95, 0x9A, 0xE9,
+    0x36, 0xAA, 0x54, 0x6B, 0xA4, 0xDB, 0xA8, 0x96, 0x56, 0x3D, 0xDD, 0x46, 0x19, 0x3B, 0x5D, 0x59,
+    0x60, 0xAB, 0xDB, 0xF6, 0xAC, 0xD0, 0x83, 0x1D, 0x71, 0xC0, 0xE5, 0x15, 0x00, 0x34, 0xB8, 0xE5,
+    0x1D, 0x3B, 0xFB, 0xA5, 0xCB, 0xCB, 0xBC, 0xF3, 0xF0, 0xED, 0xC7, 0x07, 0x9A, 0xFD, 0x15, 0xCF,
+    0xED, 0x2F, 0x65, 0x6B, 0x72, 0x31, 0x0A, 0x55, 0x5A, 0xE8, 0x36, 0xAA, 0x0D, 0xE9, 0x2F, 0x6F,
+    0xEB, 0x38, 0x39, 0x40, 0x47, 0x3D, 0xA3, 0x23, 0x15, 0x7F, 0x0F, 0x60, 0x0F, 0x0F, 0x56, 0x3C,
+    0x3B, 0x3A, 0x88, 0x66, 0x9F, 0xCC, 0xEA, 0x76, 0x3F, 0x31, 0x3B, 0x67, 0xAF, 0x4B, 0x6F, 0xBA,
+    0xB5, 0x52, 0xE8, 0x14, 0x2B, 0x3D, 0xAF, 0x50, 0x68, 0xC6, 0xC5, 0xEC, 0xA8, 0x74, 0xC9, 0x2E,
+    0x99, 0xEB, 0xDE, 0xE5, 0x28, 0x4B, 0xF7, 0xF6, 0xC9, 0x2B, 0x6F, 0xE4, 0xC0, 0x46, 0xC9, 0x2F,
+    0x39, 0x14, 0x34, 0x3A, 0xFA, 0x6F, 0x21, 0x73, 0x1D, 0x34, 0xE7, 0xC9, 0x5B, 0x56, 0x58, 0xCD,
+    0x9C, 0xD5, 0xBA, 0xEF, 0xA4, 0xB7, 0xF6, 0x55, 0x5D, 0xF3, 0xE2, 0x38, 0xC9, 0x4A, 0x11, 0xA7,
+    0xB9, 0xCC, 0x6E, 0x66, 0xCF, 0xD9, 0xB3, 0x70, 0x79, 0x79, 0x79, 0xF9, 0x8D, 0x87, 0x27, 0x02,
+    0x01, 0xF9, 0xFC, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0x1D, 0xFD, 0x9C, 0xCF, 0x43, 0x02, 0xB8, 0x54,
+    0xA9, 0x8D, 0x5D, 0x34, 0xA3, 0x0D, 0x2E, 0xF8, 0xD1, 0x47, 0x37, 0xDB, 0xF9, 0xC3, 0x3D, 0x98,
+    0xA7, 0xF4, 0x69, 0x75, 0xC9, 0x46, 0x3D, 0xB5, 0xB6, 0xD1, 0xDF, 0x48, 0x26, 0x64, 0x93, 0x58,
+    0x4D, 0xCD, 0x68, 0x83, 0xBB, 0x91, 0xAA, 0xD4, 0x45, 0x33, 0xFA, 0x5E, 0x55, 0x6A, 0x52, 0x17,
+    0x6D, 0xF4, 0xA3, 0x9E, 0xD7, 0x5D, 0x7D, 0x4A, 0x4F, 0xA8, 0x5D, 0xDB, 0xE5, 0xC3, 0x7D, 0x26,
+    0x8B, 0x98, 0xC1, 0xDD, 0xD0, 0x13, 0x6A, 0xD5, 0xAE, 0x5D, 0x32, 0xB3, 0x8D, 0x6E, 0xD4, 0xA0,
+    0x1B, 0x6B, 0x9D, 0xDA, 0xD3, 0xFD, 0xB3, 0x09, 0x76, 0xF8, 0x5D, 0x7E, 0x87, 0xE2, 0x26, 0xDC,
+    0x84, 0xC7, 0x50, 0xC0, 0x4F, 0xD8, 0xD9, 0x6E, 0xD9, 0x09, 0xB9, 0xAB, 0xA9, 0xD0, 0x8C, 0x4F,
+    0x76, 0xA3, 0x53, 0xDF, 0xE8, 0x79, 0x05, 0x34, 0xE1, 0xE6, 0xF3, 0x0B, 0x8A, 0xA7, 0xE1, 0x19,
+    0xFE, 0x3F, 0xD5, 0x9A, 0x3D, 0xB3, 0xE6, 0xC8, 0x55, 0xC7, 0xFF, 0x52, 0x7B, 0x46, 0x55, 0x56,
+    0xD0, 0x04, 0x8C, 0x29, 0x9B, 0x40, 0xE4, 0x54, 0x21, 0x3E, 0x01, 0xAD, 0xB5, 0x03, 0x02, 0x07,
+    0x5C, 0xA8, 0x7D, 0xA0, 0x8A, 0x0D, 0x96, 0x00, 0x02, 0x96, 0x60, 0x3E, 0x01, 0xB4, 0x76, 0x09,
+    0x1C, 0x6C, 0xC0, 0x04, 0x18, 0xAA, 0x20, 0x70, 0x62, 0x07, 0x7B, 0x37, 0x98, 0x6F, 0x60, 0xF5,
+    0xB2, 0xC1, 0x06, 0x0E, 0x56, 0xE0, 0x32, 0x0E, 0x9C, 0x08, 0x3C, 0x94, 0x61, 0x36, 0x70, 0xEF,
+    0x5A, 0x83, 0x35, 0x77, 0x5B, 0xFD, 0x23, 0x68, 0x3D, 0xCF, 0xBD, 0xB3, 0x7E, 0x81, 0xE2, 0xCD,
+    0xF0, 0x04, 0xFD, 0xA2, 0x96, 0x5A, 0xAD, 0xF3, 0x9C, 0x3E, 0xE7, 0x7F, 0xFE, 0xA7, 0x25, 0x49,
+    0xD2, 0x34, 0xF8, 0x51, 0x2D, 0x0D, 0x83, 0x5C, 0xEA, 0x76, 0x69, 0x8A, 0x7E, 0x95, 0x18, 0x18,
+    0xA5, 0x2B, 0xFD, 0x9C, 0xEE, 0xFE, 0x4E, 0xA7, 0xD3, 0xE9, 0xD4, 0x02, 0xE4, 0x1E, 0x20, 0x79,
+    0x80, 0xD8, 0xF0, 0xF4, 0x9A, 0x60, 0x91, 0x90, 0x4B, 0x32, 0x9B, 0x88, 0xB2, 0xB3, 0x21, 0xE8,
+    0xB3, 0xB2, 0x48, 0x92, 0x4B, 0x92, 0x44, 0xBC, 0xF7, 0xB2, 0x0C, 0x10, 0x65, 0x81, 0x20, 0x07,
+    0x48, 0xDC, 0x5C, 0x7F, 0x55, 0x86, 0x20, 0x7D, 0xE2, 0x6E, 0x99, 0xC5, 0x10, 0xD4, 0xDF, 0xCE,
+    0xDD, 0xA6, 0x1A, 0x20, 0x4E, 0x00, 0xDF, 0xB8, 0x5D, 0xC9, 0x7A, 0x67, 0x95, 0x5F, 0x2F, 0x95,
+    0x8F, 0x92, 0x24, 0xCB, 0x20, 0x49, 0x15, 0x49, 0x92, 0xE4, 0x08, 0x92, 0xD4, 0x90, 0xCB, 0xE7,
+    0x13, 0x25, 0xC9, 0x7E, 0xCC, 0x20, 0xA9, 0xCE, 0x7E, 0x93, 0x24, 0xF7, 0x2E, 0x41, 0x52, 0x93,
+    0xFA, 0x5D, 0x92, 0x78, 0x89, 0x28, 0xA9, 0x8B, 0x16, 0x49, 0x75, 0xD6, 0xB4, 0x49, 0x72, 0x73,
+    0x43, 0x90, 0xDA, 0x24, 0xB7, 0x4B, 0x02, 0x58, 0xA4, 0x0E, 0x40, 0x32, 0xC7, 0xA2, 0xDC, 0xCD,
+    0xF5, 0x63, 0x46, 0xB5, 0x49, 0xF2, 0x49, 0x62, 0x94, 0x61, 0x56, 0xB7, 0x4A, 0x3D, 0x32, 0x0C,
+    0xAA, 0x79, 0x6E, 0x60, 0xAC, 0x21, 0x4D, 0x24, 0x79, 0x78, 0x1F, 0x42, 0x0B, 0xE9, 0xC1, 0xE9,
+    0x74, 0x3A, 0x7D, 0x1E, 0x80, 0x2F, 0x02, 0xA4, 0x0E, 0x20, 0x56, 0xDC, 0xBC, 0x4D, 0x30, 0x84,
+    0x0A, 0x59, 0x64, 0x92, 0x5C, 0x92, 0x5D, 0x44, 0x54, 0x3F, 0xBC, 0x20, 0xC4, 0xFC, 0xD6, 0x20,
+    0x01, 0x4F, 0x64, 0x80, 0x4D, 0x16, 0x48, 0x72, 0xE9, 0x3E, 0x9B, 0x88, 0x15, 0xD1, 0x10, 0x6A,
+    0x66, 0x8B, 0x1A, 0x06, 0x97, 0xD4, 0xED, 0x22, 0x6A, 0x5A, 0x0D, 0xC1, 0x10, 0x2C, 0xF2, 0x59,
+    0x53, 0x7E, 0x4C, 0xEC, 0x01, 0x6A, 0x80, 0xA5, 0x05, 0x9E, 0x1C, 0x72, 0xAE, 0x5E, 0xE3, 0x5F,
+    0x54, 0x01, 0x8C, 0x2D, 0x40, 0xE8, 0x00, 0x42, 0xC5, 0xD2, 0x31, 0x18, 0x46, 0x9B, 0x65, 0xB3,
+    0xDC, 0x26, 0xB7, 0x69, 0x5A, 0xC4, 0x52, 0x33, 0x1A, 0x46, 0x9B, 0x64, 0xB3, 0xFC, 0x22, 0x97,
+    0xDF, 0x46, 0x02, 0xD6, 0x17, 0x17, 0xB8, 0xDD, 0x67, 0x13, 0x4B, 0x45, 0x34, 0x8C, 0x86, 0x60,
+    0xB3, 0x5A, 0x06, 0xB7, 0xA9, 0xDF, 0xC5, 0xA2, 0xE9, 0xF6, 0xB2, 0xDF, 0x7F, 0xEA, 0x02, 0x1F,
+    0x9C, 0x4E, 0xA7, 0xD3, 0x17, 0x01, 0xF6, 0x09, 0xE0, 0x3D, 0x80, 0x54, 0x04, 0x68, 0x51, 0x9B,
+    0x44, 0x94, 0x0F, 0x16, 0x35, 0x49, 0x44, 0xB9, 0xD1, 0x22, 0x13, 0x45, 0xBC, 0x08, 0xF1, 0xBF,
+    0xD2, 0xEC, 0xB9, 0x92, 0x7A, 0x58, 0xD4, 0x42, 0x96, 0x26, 0x58, 0x24, 0xDD, 0x3B, 0x9D, 0x4E,
+    0xA7, 0x53, 0x11, 0x1C, 0x6B, 0x51, 0x98, 0x22, 0x07, 0x78, 0x24, 0xF5, 0xEB, 0x2F, 0x10, 0xA4,
+    0x3A, 0x97, 0x5D, 0xD0, 0x2F, 0xE6, 0x6E, 0xD7, 0x95, 0xAE, 0xD9, 0x8F, 0xEE, 0x5C, 0xBA, 0xA9,
+    0x74, 0x7D, 0x30, 0x67, 0x95, 0x4C, 0x92, 0xA6, 0xD1, 0x10, 0x24, 0xBB, 0x96, 0x2E, 0x65, 0x8F,
+    0x75, 0x51, 0x2E, 0x49, 0x26, 0x97, 0xAE, 0x9B, 0xE5, 0x92, 0xD4, 0xA6, 0xD2, 0x65, 0x94, 0x4B,
+    0x92, 0x8B, 0x32, 0x04, 0x3D, 0xE4, 0xE9, 0x35, 0xF9, 0xCA, 0xC1, 0x45, 0x7E, 0xB0, 0xFB, 0x52,
+    0x7F, 0x93, 0x41, 0x52, 0x97, 0x5C, 0x94, 0x24, 0xDE, 0x45, 0x92, 0x6C, 0xEA, 0x4B, 0xF7, 0xF5,
+    0x2C, 0x49, 0xED, 0xDA, 0xCD, 0x92, 0xE4, 0x95, 0x24, 0xC9, 0xC4, 0x4F, 0x0F, 0x92, 0xF4, 0x39,
+    0xDD, 0xD1, 0xEE, 0x37, 0x01, 0xE8, 0xCE, 0x7F, 0xCE, 0xF5, 0x14, 0x0D, 0x41, 0x2E, 0x58, 0xA4,
+    0x2C, 0x97, 0x64, 0x56, 0x11, 0x75, 0xFF, 0x45, 0xED, 0x4E, 0xD5, 0x49, 0x02, 0xD2, 0x8B, 0x06,
+    0x25, 0x5F, 0xBF, 0x75, 0x88, 0xFF, 0x93, 0x06, 0x65, 0x13, 0x51, 0xED, 0xED, 0xDC, 0x35, 0x9A,
+    0x80, 0xD4, 0x03, 0x7C, 0x74, 0xBB, 0x92, 0x5D, 0xFA, 0xBA, 0xAA, 0xD3, 0xE9, 0x65, 0xB5, 0x8B,
+    0xFA, 0x5D, 0x0E, 0x66, 0x43, 0x30, 0x44, 0x03, 0x49, 0x24, 0x39, 0xC6, 0x9E, 0xAC, 0x9E, 0xD9,
+    0xB0, 0xCB, 0x22, 0x43, 0xD2, 0xAF, 0x4C, 0x51, 0x44, 0x4D, 0x1F, 0x07, 0x55, 0x0C, 0x16, 0xD9,
+    0x4D, 0x2A, 0x3A, 0x66, 0xCA, 0x1A, 0x66, 0x8B, 0x7C, 0x90, 0x54, 0x21, 0xA2, 0xDD, 0x24, 0xC9,
+    0x6E, 0x96, 0x8A, 0x62, 0xAF, 0xBE, 0xC5, 0x33, 0x3F, 0x4B, 0x87, 0xF1, 0x28, 0xE6, 0xCA, 0x1F,
+    0x66, 0x45, 0xB2, 0x87, 0x9E, 0x48, 0x35, 0x33, 0xB1, 0x98, 0x48, 0x9F, 0x2C, 0x35, 0x73, 0x31,
+    0x73, 0x1C, 0xF6, 0x89, 0x68, 0xD1, 0x94, 0x24, 0xF9, 0x5D, 0x44, 0xC3, 0x22, 0x59, 0x82, 0x45,
+    0x3D, 0x83, 0x0C, 0x51, 0x44, 0x91, 0xA4, 0x29, 0xCB, 0xA2, 0x96, 0xA8, 0x9E, 0x50, 0xF1, 0x5C,
+    0x8E, 0xB1, 0x65, 0xAD, 0x20, 0x55, 0xE4, 0x9A, 0x2C, 0x07, 0xA1, 0x21, 0x79, 0xC6, 0x06, 0x92,
+    0x3A, 0xE6, 0xD7, 0x86, 0xB2, 0xB7, 0x3E, 0xF7, 0xE8, 0xD8, 0x64, 0x0F, 0x99, 0xA5, 0x09, 0x66,
+    0x4D, 0xC0, 0x68, 0x81, 0x5D, 0xCC, 0x86, 0x68, 0x57, 0x59, 0x84, 0x44, 0xB4, 0x8B, 0x2C, 0xFA,
+    0xE3, 0xF3, 0x1E, 0xC9, 0x92, 0x6A, 0x82, 0xA4, 0x29, 0x4A, 0x13, 0x49, 0x6A, 0x8B, 0xB9, 0x84,
+    0x59, 0xD5, 0x35, 0x5C, 0x2C, 0x76, 0x43, 0x90, 0xE4, 0xF6, 0x26, 0xC8, 0xF0, 0x77, 0xBB, 0xE4,
+    0x92, 0x8B, 0x6A, 0x78, 0x8F, 0x20, 0x36, 0xCF, 0xE0, 0x31, 0x00, 0xC1, 0x02, 0x8B, 0x7A, 0x78,
+    0x22, 0xDD, 0xBF, 0xBE, 0x92, 0x1E, 0x9C, 0x4E, 0xC3, 0xBD, 0xD3, 0xE9, 0xB7, 0x00, 0x15, 0x67,
+    0x91, 0x4C, 0xD1, 0xB3, 0xB1, 0x81, 0xA5, 0x22, 0x4A, 0xD3, 0x26, 0x43, 0x50, 0xC5, 0x22, 0x8B,
+    0x64, 0x0F, 0xED, 0x27, 0x4B, 0x44, 0x59, 0xCA, 0x30, 0x65, 0xD8, 0x52, 0x86, 0xF9, 0x7E, 0x96,
+    0x88, 0x36, 0xF9, 0x4D, 0x86, 0xC0, 0x3B, 0x2C, 0xB2, 0xD8, 0xD4, 0x30, 0xCA, 0x25, 0x42, 0x97,
+    0x25, 0x48, 0xF2, 0x9B, 0x4C, 0xB1, 0x87, 0xB2, 0x24, 0x35, 0x8C, 0x72, 0x04, 0x75, 0x59, 0x22,
+    0xA9, 0x0C, 0xDF, 0xBE, 0xBB, 0x61, 0xD4, 0xB4, 0x4B, 0x3D, 0x43, 0x5F, 0x6C, 0xE9, 0x47, 0x9F,
+    0x58, 0xF9, 0x1D, 0x17, 0x97, 0xE4, 0x06, 0x49, 0xED, 0x2A, 0x24, 0xA9, 0x8F, 0x6D, 0x51, 0x87,
+    0x67, 0xD3, 0x52, 0xBC, 0xDA, 0xA1, 0x52, 0x45, 0x75, 0x74, 0xEF, 0x4A, 0x3F, 0xF2, 0xAB, 0x4E,
+    0xA7, 0x97, 0x75, 0x3A, 0x9D, 0x7A, 0x88, 0x16, 0xD2, 0x04, 0xC1, 0xC1, 0x87, 0xB0, 0xC9, 0x93,
+    0xD5, 0x21, 0xB5, 0x87, 0x3C, 0xBA, 0x22, 0x0F, 0x1D, 0xF2, 0xB0, 0xC7, 0x92, 0x0F, 0x79, 0xD8,
+    0x43, 0x5C, 0x94, 0x61, 0x9B, 0xCB, 0x30, 0xEF, 0x31, 0xCA, 0x25, 0x9B, 0xCA, 0xD3, 0x04, 0xBF,
+    0xC9, 0xF0, 0x7E, 0x2A, 0x1F, 0x4C, 0x28, 0xF2, 0x48, 0x65, 0x72, 0x42, 0x91, 0x47, 0x3A, 0xE4,
+    0x11, 0x8A, 0xB8, 0xEE, 0xBC, 0xDB, 0x6F, 0x6A, 0x99, 0x55, 0xB3, 0xD6, 0x90, 0x2A, 0xE0, 0x13,
+    0x2B, 0x8F, 0x0F, 0x4E, 0xA7, 0x41, 0x5F, 0xD7, 0x54, 0xE6, 0x9E, 0x20, 0x58, 0x82, 0x67, 0x2F,
+    0xDA, 0x1D, 0xE5, 0x09, 0x22, 0x8A, 0x0F, 0x46, 0x11, 0x2B, 0x06, 0x89, 0x68, 0xB2, 0x24, 0x62,
+    0x93, 0x24, 0x11, 0xED, 0x2A, 0x89, 0xD8, 0x47, 0x49, 0x3C, 0xF3, 0xA1, 0xB8, 0xF5, 0xA3, 0x9A,
+    0x4B, 0x15, 0x25, 0x11, 0xFD, 0x26, 0x89, 0x58, 0x3C, 0x7F, 0xEC, 0x28, 0x8F, 0x33, 0x4A, 0xC4,
+    0x86, 0x59, 0x22, 0x1A, 0xA2, 0xCE, 0x3B, 0x8D, 0xA8, 0x29, 0xAB, 0xE6, 0x59, 0xB1, 0x1D, 0x84,
+    0x8E, 0x65, 0x82, 0xD0, 0xB2, 0x4D, 0x10, 0x6A, 0xF6, 0xF3, 0xA6, 0x3A, 0xBC, 0x43, 0x0B, 0x40,
+    0xA8, 0x01, 0x88, 0x17, 0x33, 0xE0, 0x9E, 0xBD, 0xCA, 0x28, 0xD9, 0xB5, 0x62, 0x91, 0xCC, 0xAE,
+    0xB2, 0x8E, 0xA1, 0xCB, 0x07, 0x20, 0x19, 0x25, 0x1B, 0xCB, 0x60, 0x3A, 0x06, 0xD5, 0x65, 0x49,
+    0x3E, 0x34, 0x8C, 0x52, 0x5F, 0x06, 0xDB, 0x4D, 0x7E, 0x93, 0xCC, 0x5E, 0x06, 0x51, 0xC3, 0x28,
+    0xF9, 0x50, 0xB1, 0x48, 0x7D, 0x94, 0xDF, 0x24, 0xBB, 0xAA, 0xCB, 0x52, 0x93, 0xD4, 0x30, 0xDE,
+    0x37, 0xA8, 0x62, 0x31, 0x1F, 0x33, 0xC8, 0x6F, 0x15, 0x04, 0x3D, 0xE4, 0xCA, 0x97, 0x15, 0x76,
+    0xCC, 0x15, 0xF0, 0x2E, 0x41, 0x1E, 0xE2, 0xE7, 0x86, 0x33, 0x5A, 0x1C, 0x54, 0x9D, 0x4E, 0x43,
+    0x0D, 0x51, 0x0D, 0xCC, 0x35, 0x44, 0xB5, 0xC5, 0x54, 0xAC, 0xB2, 0x30, 0xC8, 0xB2, 0xC9, 0xB2,
+    0x49, 0x96, 0xA4, 0xEE, 0xDC, 0x70, 0x6C, 0x52, 0x47, 0x96, 0xFB, 0x7E, 0x92, 0xBA, 0xEF, 0x21,
+    0xFF, 0x38, 0x49, 0xFD, 0x77, 0xD1, 0xF4, 0x6A, 0x69, 0x0C, 0x74, 0x49, 0xEA, 0xFF, 0x8E, 0x31,
+    0x77, 0x49, 0x72, 0x7F, 0xCB, 0xDF, 0xEC, 0x76, 0x97, 0xDC, 0xCC, 0x37, 0x53, 0x69, 0x4C, 0xDF,
+    0xDD, 0xEC, 0x2E, 0xB9, 0xE0, 0x7F, 0xB8, 0xDA, 0x2C, 0xF9, 0xE0, 0x88, 0xA5, 0xD1, 0xB3, 0xD8,
+    0x2C, 0x4D, 0xA1, 0x63, 0xB6, 0x48, 0x53, 0xB0, 0x84, 0x16, 0x69, 0x0A, 0x2D, 0x63, 0x8B, 0x44,
+    0x30, 0x0C, 0x2D, 0x12, 0xA3, 0x41, 0x0D, 0xAA, 0x18, 0xAB, 0xAC, 0x96, 0x47, 0x1D, 0x59, 0xFF,
+    0xAC, 0x89, 0xE4, 0x40, 0xAA, 0x20, 0x39, 0x72, 0x69, 0xDC, 0x31, 0x39, 0xC3, 0x54, 0x36, 0x6E,
+    0x91, 0x0F, 0x8F, 0x2E, 0x26, 0xC7, 0x9F, 0x1D, 0x6D, 0x94, 0xA5, 0x78, 0x29, 0x97, 0x8A, 0x9F,
+    0x22, 0x4A, 0xEE, 0xC7, 0x0F, 0x77, 0x67, 0x84, 0x50, 0xDC, 0xDD, 0xD9, 0xE1, 0x1D, 0x2E, 0xEF,
+    0xFA, 0xF1, 0x4F, 0x7F, 0xFA, 0xA7, 0x4C, 0x3E, 0xE5, 0x41, 0x3D, 0x8F, 0xFA, 0x02, 0x3A, 0x3F,
+    0x3A, 0x56, 0xFE, 0x9D, 0x63, 0xE5, 0xB7, 0xE6, 0xE2, 0x17, 0x79, 0x2E, 0xA9, 0x2A, 0xFB, 0xC0,
+    0x02, 0x9B, 0xE4, 0x0E, 0xE4, 0xB2, 0x57, 0x30, 0x1A, 0x16, 0x75, 0xCC, 0x0D, 0xA3, 0x9A, 0xE2,
+    0x89, 0x0C, 0x6B, 0x97, 0xA5, 0x8A, 0xAD, 0xDF, 0x25, 0x91, 0x0A, 0x28, 0x39, 0x57, 0x3E, 0x49,
+    0xF2, 0x3F, 0xA1, 0xDA, 0x25, 0xF9, 0xE4, 0x76, 0x49, 0xD3, 0xE6, 0x90, 0xC4, 0x5A, 0xAA, 0xD8,
+    0x31, 0xAA, 0x66, 0xB6, 0xCC, 0x6A, 0x08, 0x0D, 0x9B, 0x7A, 0x54, 0xC3, 0x53, 0xF6, 0x22, 0xA3,
+    0x55, 0xEA, 0x81, 0x51, 0xAA, 0xE1, 0xB9, 0x24, 0x7D, 0xE6, 0x7A, 0x38, 0xD0, 0xE0, 0x81, 0x07,
+    0xCF, 0x88, 0x10, 0xBE, 0x5D, 0xAA, 0x27, 0x15, 0xCF, 0x4F, 0xBF, 0x7D, 0xC8, 0xE5, 0x2C, 0xAE,
+    0x9F, 0x61, 0xB7, 0xE7, 0x91, 0xBA, 0xF2, 0xB7, 0xF4, 0xF0, 0x1D, 0xD8, 0x9B, 0xB2, 0xE6, 0x30,
+    0xC1, 0x5C, 0xBD, 0xC6, 0xCD, 0xD0, 0x00, 0x8C, 0x13, 0x40, 0x03, 0xB0, 0x55, 0xC4, 0x87, 0xCC,
+    0x05, 0xB7, 0x13, 0x0B, 0x0C, 0xB0, 0x88, 0xA8, 0xDB, 0x66, 0xC5, 0x62, 0x91, 0x4B, 0xC5, 0x5A,
+    0x59, 0x5E, 0x21, 0x16, 0x10, 0x65, 0x21, 0x4B, 0x90, 0x25, 0xCB, 0xD5, 0x7F, 0x0C, 0xD8, 0xCE,
+    0xB7, 0xC0, 0x76, 0xBE, 0xD5, 0x94, 0x87, 0x3C, 0x91, 0x3A, 0xC8, 0x32, 0x05, 0xCF, 0x03, 0xD1,
+    0xB0, 0xDE, 0x23, 0xB8, 0xAC, 0x9A, 0x8A, 0x45, 0xCD, 0x66, 0x91, 0xBA, 0xD9, 0x6F, 0xD2, 0xAF,
+    0x9D, 0x01, 0xCC, 0x25, 0xF2, 0xAB, 0x88, 0x17, 0xCF, 0xDF, 0x51, 0x70, 0xCE, 0x9D, 0xCB, 0xE5,
+    0xEE, 0x20, 0xC9, 0x31, 0x48, 0x9A, 0xCA, 0xCA, 0x18, 0x55, 0xD5, 0xF0, 0xFC, 0xB7, 0xF7, 0x12,
+    0x7C, 0x99, 0x8B, 0x05, 0xDD, 0xA5, 0x09, 0x46, 0xE9, 0xDE, 0x1F, 0x0E, 0x87, 0x1A, 0x14, 0x2D,
+    0x48, 0xE5, 0xCF, 0x7F, 0xFF, 0xE8, 0x3C, 0x9D, 0xF2, 0x35, 0xEF, 0x6F, 0x35, 0x73, 0x9B, 0x18,
+    0xFA, 0x5D, 0xFE, 0xCD, 0x58, 0x33, 0x37, 0x9B, 0x57, 0xBF, 0xCB, 0xEB, 0xAA, 0x66, 0xAE, 0x06,
+    0xA9, 0x44, 0x85, 0x65, 0xD9, 0xFF, 0x5D, 0x9D, 0x86, 0x67, 0x92, 0x5A, 0x48, 0x97, 0x5D, 0xD6,
+    0x41, 0x2A, 0x30, 0xE6, 0xC1, 0xE9, 0xE5, 0x09, 0x82, 0x27, 0x4D, 0x30, 0x4E, 0xC5, 0xE2, 0xF4,
+    0x2C, 0x86, 0x28, 0xC3, 0x50, 0x11, 0xD5, 0x64, 0x89, 0x4D, 0xB6, 0x04, 0x9A, 0x76, 0x93, 0xDC,
+    0xAE, 0x3E, 0x4A, 0x16, 0xB9, 0x59, 0x6A, 0xD1, 0x14, 0x24, 0xC3, 0xC8, 0x20, 0xD5, 0xBC, 0x53,
+    0x84, 0xF6, 0xCD, 0x5D, 0x92, 0xA6, 0x1F, 0xA6, 0x12, 0x1B, 0x47, 0x49, 0xEA, 0xCF, 0x80, 0x33,
+    0x48, 0x05, 0x03, 0x48, 0x2A, 0x18, 0x56, 0x26, 0x4B, 0xD2, 0xAF, 0x36, 0x49, 0x92, 0x52, 0xB7,
+    0x16, 0x9B, 0xB0, 0x48, 0xAA, 0x8B, 0xA3, 0xAC, 0x0E, 0xA3, 0xC1, 0xF6, 0x02, 0x4C, 0x7C, 0x70,
+    0x3A, 0x95, 0x37, 0xB0, 0x14, 0x2C, 0x7B, 0x3C, 0xF9, 0xA4, 0xC4, 0xE6, 0xA1, 0x04, 0xE3, 0x6B,
+    0xD1, 0x1F, 0x18, 0x4A, 0x78, 0x94, 0xCF, 0xC6, 0xCE, 0xB0, 0xF8, 0xE8, 0xA9, 0x59, 0xBA, 0x64,
+    0x98, 0x89, 0x0D, 0xF2, 0xC9, 0xAF, 0x15, 0xC1, 0xD2, 0x27, 0xF9, 0x58, 0xF3, 0x1D, 0xD4, 0x25,
+    0xF9, 0x7F, 0x25, 0x34, 0xA8, 0xDF, 0x8F, 0x41, 0x8B, 0x7C, 0x34, 0xBC, 0x51, 0x9E, 0x0C, 0x8E,
+    0x5F, 0xA7, 0x61, 0x29, 0xD3, 0xCE, 0xEA, 0x8B, 0x09, 0xD5, 0x44, 0xE1, 0x03, 0xDA, 0x33, 0x59,
+    0x10, 0x4A, 0x75, 0x33, 0x48, 0x6A, 0x60, 0x2B, 0xA8, 0x3C, 0x4B, 0xD2, 0xF5, 0xF5, 0xF5, 0x20,
+    0xDD, 0x3B, 0x9D, 0xAE, 0xEE, 0x9D, 0x4E, 0x0D, 0xEC, 0x16, 0xDE, 0x01, 0x0C, 0xC4, 0x9E, 0x3C,
+    0xF4, 0x2C, 0x9A, 0xB2, 0x0C, 0xA3, 0x5A, 0xE6, 0x9A, 0x20, 0x91, 0x2A, 0x82, 0x64, 0x19, 0x09,
+    0x52, 0xC5, 0x3A, 0xCD, 0x92, 0x7A, 0xFC, 0x52, 0xE6, 0x5D, 0xEE, 0x48, 0xBF, 0x29, 0x95, 0x2E,
+    0x01, 0x40, 0x28, 0x83, 0xDB, 0x21, 0xBF, 0x41, 0x52, 0xFF, 0xAC, 0x10, 0x12, 0xC5, 0x32, 0x76,
+    0xA9, 0x40, 0xFC, 0x5D, 0x7E, 0x97, 0x6C, 0x96, 0x25, 0xA8, 0x45, 0x22, 0xA9, 0x65, 0x54, 0xCF,
+    0xDC, 0x17, 0xB3, 0xFE, 0x15, 0x98, 0x1D, 0x7C, 0x00, 0xB1, 0x83, 0xED, 0xC1, 0xE9, 0x34, 0x94,
+    0xBD, 0xB0, 0x9F, 0x71, 0x14, 0xF0, 0x25, 0x78, 0xD2, 0x1E, 0xDE, 0xAA, 0x3E, 0x90, 0x5E, 0xBF,
+    0x4B, 0x44, 0xD5, 0xCC, 0x3F, 0xB3, 0x6E, 0xCF, 0xD3, 0x6B, 0xB8, 0xEA, 0xCB, 0x96, 0xFD, 0xA0,
+    0x54, 0x1C, 0x56, 0xFC, 0xA0, 0x7A, 0xF2, 0xC1, 0x69, 0x15, 0xD4, 0xDB, 0xEC, 0x07, 0x11, 0x54,
+    0xB4, 0xCB, 0x14, 0x81, 0xCA, 0x95, 0x6E, 0x5D, 0x14, 0x54, 0x9F, 0x1E, 0x0E, 0x31, 0x58, 0x88,
+    0x1E, 0xDE, 0x2B, 0x21, 0x61, 0x9C, 0xD8, 0x0D, 0x2C, 0x62, 0x3D, 0xC3, 0xE0, 0x33, 0x52, 0x3F,
+    0x80, 0xFB, 0x01, 0x4C, 0x1B, 0x46, 0xB9, 0xFD, 0x18, 0x1C, 0xE4, 0x37, 0xD5, 0x44, 0x75, 0x59,
+    0xF2, 0x59, 0x2D, 0xA3, 0x2C, 0x19, 0x16, 0xD5, 0x14, 0xA7, 0xD9, 0xC3, 0x01, 0x17, 0x3E, 0x66,
+    0x94, 0xAA, 0x53, 0x75, 0x80, 0xF4, 0x42, 0x3D, 0x15, 0x40, 0x56, 0xC2, 0x01, 0x49, 0x9F, 0x18,
+    0xEC, 0xB9, 0x3A, 0xBC, 0xB0, 0x6E, 0xB1, 0xE9, 0x81, 0x7D, 0xAB, 0xD3, 0xE9, 0xEA, 0x74, 0x3A,
+    0x4D, 0xF0, 0x26, 0x7C, 0x58, 0x64, 0xF3, 0x67, 0xA5, 0xE5, 0xD9, 0x1B, 0x18, 0x27, 0xB6, 0x8A,
+    0x45, 0xAE, 0xC4, 0x22, 0x2C, 0xEA, 0x93, 0x1A, 0x86, 0xFF, 0x3F, 0xAD, 0x9A, 0x7C, 0x3D, 0xE5,
+    0xEB, 0x89, 0xF9, 0x50, 0x83, 0x5B, 0x0D, 0x78, 0xA1, 0x75, 0x2B, 0x8D, 0x1E, 0xFE, 0xB1, 0xF0,
+    0x94, 0xDF, 0x80, 0xAD, 0x60, 0xB1, 0x0F, 0x61, 0xED, 0xC8, 0x35, 0x2C, 0x77, 0xC4, 0xE1, 0x36,
+    0xB5, 0xA8, 0x62, 0x96, 0xCD, 0xAA, 0x09, 0xF2, 0xAB, 0x0C, 0xA3, 0xA6, 0xA8, 0x6E, 0xD7, 0x9D,
+    0xD5, 0xFC, 0x1F, 0xBB, 0xB1, 0xE5, 0xE6, 0x9A, 0x9B, 0x3B, 0x5B, 0x03, 0x78, 0x7C, 0x69, 0x7D,
+    0x7C, 0x69, 0xA5, 0xB3, 0x7F, 0x3E, 0xEF, 0x12, 0xA9, 0x2E, 0x3A, 0x26, 0x49, 0xFE, 0xE2, 0xC0,
+    0x6D, 0x3C, 0xB7, 0xCC, 0xE5, 0x11, 0xDD, 0x02, 0xC1, 0xFE, 0xF2, 0x48, 0xFD, 0xE8, 0xC1, 0xE9,
+    0x74, 0x7A, 0x59, 0x85, 0x45, 0x29, 0xD0, 0x6B, 0xBB, 0xF0, 0xA0, 0x3C, 0x9D, 0xB2, 0x24, 0xC6,
+    0x82, 0xFD, 0x86, 0x7E, 0x97, 0x34, 0x15, 0x67, 0xE7, 0x4B, 0x75, 0xEF, 0x70, 0x7D, 0x97, 0x8A,
+    0xA7, 0x83, 0xA4, 0xBE, 0xD8, 0xD9, 0xBE, 0x38, 0xC1, 0xBE, 0xEC, 0xEE, 0x7E, 0xAF, 0x48, 0x52,
+    0xBF, 0xCB, 0xED, 0x52, 0xBF, 0xAB, 0x2F, 0x55, 0x97, 0x5F, 0xA8, 0xCA, 0x45, 0x57, 0xEE, 0x24,
+    0x49, 0x9E, 0xC7, 0x25, 0xF8, 0x80, 0x59, 0x96, 0x03, 0xDF, 0xC0, 0x99, 0xBD, 0xD0, 0x83, 0xD3,
+    0x69, 0xD0, 0x11, 0x07, 0xAF, 0xD2, 0x81, 0x7D, 0xA5, 0x12, 0x0A, 0x3F, 0x97, 0x1A, 0x78, 0x72,
+    0x0B, 0x48, 0x2E, 0xCC, 0xF4, 0x05, 0xAE, 0xDC, 0xD2, 0x4C, 0x17, 0xD6, 0xE9, 0xC7, 0xDD, 0x74,
+    0xF3, 0xD5, 0xE3, 0xA6, 0xC2, 0xC7, 0x16, 0xEA, 0x7B, 0xD4, 0x81, 0xE3, 0xB7, 0x63, 0xA6, 0x87,
+    0x0C, 0x65, 0xA6, 0x9A, 0xE5, 0x98, 0xC9, 0xA5, 0x63, 0xA6, 0x82, 0xDB, 0x2E, 0xE4, 0x6C, 0xC1,
+    0x75, 0xC7, 0x4D, 0x7E, 0x3B, 0x6E, 0x9A, 0x92, 0x5C, 0x52, 0xCB, 0x07, 0xE4, 0x03, 0xD6, 0x93,
+    0x05, 0x3C, 0x04, 0xF6, 0xE3, 0xEB, 0x78, 0xA2, 0xFE, 0x6C, 0x32, 0x2F, 0x22, 0xA8, 0x81, 0xE1,
+    0xC0, 0x1F, 0x1D, 0x3C, 0x3A, 0xC3, 0xAD, 0x1F, 0x4B, 0xCB, 0x7F, 0xE2, 0x32, 0x4F, 0x87, 0x3B,
+    0x3C, 0x6E, 0xBA, 0x10, 0xCD, 0x15, 0xE9, 0xB2, 0xCA, 0xFF, 0x0A, 0xD1, 0x7C, 0x37, 0x04, 0xA9,
+    0x81, 0x45, 0x1D, 0x90, 0x8A, 0xF7, 0x56, 0x9F, 0x07, 0x4F, 0xE8, 0xA3, 0x5A, 0x96, 0x3E, 0xAA,
+    0x26, 0x76, 0x8B, 0xC4, 0x66, 0x17, 0x69, 0x4A, 0xF5, 0x78, 0x5E, 0xB7, 0xDB, 0x8F, 0xB2, 0x2A,
+    0x90, 0x90, 0x03, 0xF1, 0xB2, 0x4B, 0xAF, 0x5D, 0x4F, 0xFB, 0x9D, 0x7B, 0x0E, 0x6E, 0xAD, 0x19,
+    0xA5, 0x69, 0xED, 0x83, 0x2A, 0xA2, 0x5B, 0x64, 0x58, 0xFC, 0x26, 0x4B, 0xF0, 0x7C, 0x19, 0xE4,
+    0x2E, 0xDF, 0xBA, 0xA8, 0x2A, 0x3A, 0x7B, 0xFF, 0x7A, 0xB8, 0xBB, 0xE0, 0x07, 0xA7, 0xD3, 0xA0,
+    0x6A, 0xCA, 0x83, 0x26, 0x08, 0xEA, 0x61, 0xD5, 0x04, 0xA1, 0x02, 0xB2, 0x3C, 0xB9, 0x84, 0xF9,
+    0x63, 0x45, 0x54, 0xC7, 0x23, 0xCF, 0x2C, 0x62, 0xF9, 0xFF, 0x0A, 0x97, 0xB8, 0xAA, 0x66, 0x2D,
+    0x22, 0x94, 0xD8, 0x44, 0xAC, 0x99, 0x25, 0xD2, 0xF1, 0xCF, 0xCB, 0xDF, 0xB6, 0x76, 0x11, 0x1B,
+    0x82, 0xE4, 0x76, 0x1D, 0xA8, 0xE6, 0x27, 0xB5, 0x6E, 0x1E, 0x9F, 0x5B, 0xC7, 0x13, 0xE9, 0xCC,
+    0x5A, 0xB8, 0x74, 0x26, 0x0C, 0xFD, 0x76, 0xA6, 0x30, 0xA6, 0x55, 0xC4, 0x9A, 0xF5, 0xD0, 0xB8,
+    0x8A, 0xA4, 0xBA, 0xAC, 0x14, 0xD4, 0x32, 0x16, 0x56, 0xE3, 0x66, 0x42, 0x07, 0x6F, 0x45, 0xD2,
+    0x04, 0xC1, 0x00, 0x4B, 0xF9, 0x72, 0xCF, 0xD9, 0xE6, 0x54, 0xD7, 0x8F, 0xCE, 0xA2, 0xB9, 0xD2,
+    0x7D, 0x80, 0x02, 0xF1, 0x96, 0x23, 0x72, 0x73, 0x5C, 0x4D, 0x9B, 0x5A, 0xC6, 0x86, 0x41, 0x44,
+    0xF9, 0x55, 0x36, 0xAB, 0x61, 0xA8, 0x58, 0xE4, 0x57, 0x75, 0x59, 0x77, 0x46, 0x18, 0x1A, 0x06,
+    0xF9, 0x2C, 0xBF, 0x16, 0xC0, 0x38, 0xA8, 0x29, 0x01, 0x60, 0x0B, 0x0C, 0xD2, 0x74, 0xC3, 0x2A,
+    0xD9, 0xBD, 0x61, 0x90, 0x21, 0xF8, 0x55, 0x9A, 0xD6, 0x86, 0x41, 0x1D, 0xC5, 0xC8, 0xCE, 0x0D,
+    0x83, 0x48, 0xF2, 0xAB, 0x1C, 0x6A, 0x99, 0x2D, 0x73, 0x07, 0x3F, 0x60, 0x33, 0x80, 0xDF, 0xE5,
+    0x60, 0xF9, 0xC3, 0xF3, 0xFF, 0x29, 0xA9, 0x61, 0x97, 0xBA, 0x83, 0x6A, 0xDC, 0xD5, 0xE5, 0x57,
+    0x08, 0x6D, 0x2E, 0x84, 0x52, 0x9F, 0xD4, 0x87, 0x96, 0x33, 0xB9, 0x79, 0x8F, 0xA8, 0x1A, 0x92,
+    0x5A, 0xA0, 0xF0, 0xD3, 0x96, 0x71, 0x8A, 0x86, 0xB1, 0x4F, 0x15, 0x73, 0x8B, 0xFC, 0x5A, 0x13,
+    0x3A, 0xFE, 0x9A, 0xE7, 0x5F, 0x00, 0x58, 0x27, 0x9E, 0x91, 0x5A, 0xA2, 0x4B, 0xFA, 0xDC, 0x50,
+    0x3D, 0xBA, 0x55, 0xA5, 0x7A, 0x90, 0xD4, 0x2C, 0xAA, 0x1E, 0x93, 0xD4, 0x00, 0x6A, 0xCF, 0x79,
+    0x97, 0xD0, 0xF0, 0x17, 0x04, 0x53, 0x60, 0x7D, 0x90, 0xC4, 0x7C, 0xCE, 0x7E, 0xF5, 0xDB, 0xC3,
+    0x27, 0x45, 0x43, 0x0D, 0x40, 0x05, 0xB0, 0xF8, 0xAC, 0x29, 0xF5, 0xBB, 0x5A, 0xDE, 0x64, 0xA8,
+    0xF8, 0x88, 0x59, 0x2E, 0x4D, 0xAB, 0x2C, 0x7D, 0x96, 0xE1, 0xDB, 0x8C, 0x22, 0x12, 0xE5, 0x92,
+    0x4B, 0xB2, 0xB4, 0x8C, 0x0D, 0xAF, 0x13, 0x0D, 0xA1, 0xE7, 0xAF, 0xCB, 0x4C, 0x4B, 0x01, 0xF2,
+    0x75, 0x09, 0xAA, 0xBE, 0x76, 0xF6, 0x21, 0x87, 0x89, 0x61, 0xF6, 0x25, 0x2B, 0x38, 0xF8, 0xCD,
+    0x30, 0xF4, 0xC9, 0x30, 0x74, 0xC9, 0x30, 0x74, 0x9B, 0x61, 0xE8, 0xA3, 0x01, 0x66, 0xC3, 0xA1,
+    0x22, 0xAB, 0xE1, 0xA5, 0x29, 0x19, 0x06, 0xBB, 0x1B, 0x06, 0x9B, 0x2F, 0xC5, 0x6E, 0x18, 0x7C,
+    0xEA, 0x8B, 0x58, 0x60, 0x3E, 0x63, 0xF4, 0x42, 0x8A, 0x7F, 0x74, 0x49, 0x48, 0x54, 0xDC, 0x3C,
+    0x4E, 0x86, 0xD0, 0x45, 0x8B, 0xFC, 0xE8, 0x92, 0xB2, 0x88, 0x66, 0x35, 0x84, 0x4F, 0x0F, 0x96,
+    0xF3, 0x7E, 0x26, 0x1E, 0x56, 0xEB, 0xC7, 0x5C, 0x9A, 0xD8, 0xD5, 0xC2, 0x56, 0xB2, 0x35, 0xF2,
+    0x40, 0x2E, 0xD6, 0xA5, 0x64, 0xB6, 0x66, 0x75, 0xCF, 0x5F, 0x61, 0x50, 0xB5, 0x57, 0x04, 0x69,
+    0x92, 0x8F, 0x52, 0x1F, 0xBA, 0x24, 0xD9, 0xD8, 0x20, 0x99, 0x02, 0xF0, 0xB3, 0x7C, 0x94, 0xFC,
+    0xD8, 0x25, 0xA9, 0x9F, 0x1B, 0x0A, 0x19, 0x17, 0x64, 0x92, 0x7C, 0x54, 0xBD, 0xAB, 0x4B, 0x85,
+    0x6C, 0x53, 0xC5, 0x7C, 0x9F, 0xB9, 0xB0, 0x7C, 0xDF, 0xBD, 0x1B, 0x8B, 0xBA, 0x28, 0x55, 0xBC,
+    0x9F, 0x24, 0xB9, 0x7F, 0xCC, 0x92, 0xEC, 0xEA, 0x47, 0xC9, 0xA4, 0x6E, 0x96, 0x34, 0x99, 0x28,
+    0xA9, 0x0B, 0xAB, 0xA4, 0x7A, 0x29, 0x1A, 0xD9, 0x97, 0x04, 0x53, 0xD4, 0x04, 0xB1, 0xE1, 0x77,
+    0x58, 0x5C, 0x34, 0xFC, 0x0D, 0x43, 0x83, 0x4D, 0xB2, 0xBB, 0x8B, 0x72, 0xCF, 0xA0, 0x98, 0x7E,
+    0x7A, 0x20, 0x4D, 0xF1, 0xD0, 0x95, 0x86, 0xE1, 0x2C, 0x10, 0x06, 0xFD, 0x9E, 0xE7, 0x86, 0x00,
+    0xA0, 0x09, 0xD6, 0xB2, 0x6D, 0xEF, 0xBD, 0x35, 0x48, 0x85, 0x3F, 0xBE, 0x92, 0x9F, 0x1B, 0x72,
+    0xC9, 0x64, 0x4C, 0x2C, 0x16, 0x91, 0x1A, 0x76, 0x43, 0xB4, 0x2C, 0x6D, 0x96, 0x47, 0x7F, 0x81,
+    0xFC, 0x62, 0xF7, 0xDF, 0x53, 0xBB, 0x35, 0xB9, 0xCE, 0x92, 0x5C, 0xF0, 0x8B, 0x0B, 0x52, 0x95,
+    0x9B, 0xDC, 0xAE, 0x92, 0xDA, 0xE7, 0xD3, 0x3F, 0x9D, 0xF1, 0xEB, 0xC1, 0x27, 0x14, 0xDB, 0xD4,
+    0xF0, 0x4A, 0x7E, 0xB5, 0x30, 0xAA, 0x7E, 0x99, 0xA2, 0xD4, 0xEF, 0x4D, 0x36, 0x8C, 0x32, 0x04,
+    0xBF, 0xF4, 0xBB, 0xC4, 0xDA, 0xE4, 0x42, 0x8F, 0xC8, 0x2F, 0x2D, 0xA1, 0x25, 0xF4, 0xCC, 0x2E,
+    0xD7, 0xAC, 0x2D, 0xB9, 0x62, 0x73, 0x59, 0x13, 0x4B, 0x43, 0xF8, 0xAC, 0x24, 0xE9, 0xFE, 0x95,
+    0x74, 0x92, 0x34, 0x95, 0xFD, 0xBA, 0xD6, 0x40, 0xB4, 0xFB, 0xAF, 0xB3, 0xB8, 0xC1, 0x30, 0xFE,
+    0x52, 0x01, 0x43, 0x2E, 0x16, 0x2C, 0xE4, 0x0A, 0x8C, 0x99, 0x55, 0x43, 0x54, 0xF5, 0x0A, 0x8B,
+    0x64, 0x08, 0x3F, 0xAF, 0x86, 0x2F, 0x44, 0x75, 0xC9, 0x2D, 0x22, 0xB2, 0x76, 0xBC, 0xC1, 0x41,
+    0xC9, 0x87, 0x0A, 0x56, 0xE9, 0x33, 0x7F, 0x2E, 0x79, 0xD6, 0x16, 0x7A, 0x76, 0x03, 0xEF, 0x81,
+    0x60, 0xE9, 0xB2, 0x0C, 0xA3, 0x61, 0x14, 0xB3, 0x4A, 0x28, 0xE1, 0x36, 0xB1, 0xCB, 0x66, 0xC1,
+    0x60, 0x78, 0x1D, 0x66, 0xF1, 0x0F, 0xB8, 0x55, 0xEE, 0x39, 0x76, 0x97, 0x05, 0xC3, 0x60, 0x40,
+    0xCC, 0x22, 0xCB, 0xAD, 0x72, 0x59, 0x76, 0x97, 0xCD, 0x32, 0x0C, 0x65, 0xAA, 0x96, 0xAD, 0x82,
+    0x37, 0x61, 0x84, 0x8F, 0x60, 0x76, 0x24, 0x55, 0x05, 0xB1, 0x6D, 0xDA, 0xA5, 0x2A, 0xCB, 0x8F,
+    0x92, 0x0F, 0xFD, 0x22, 0xD9, 0xD4, 0xAF, 0x2A, 0x66, 0x48, 0x85, 0x60, 0x95, 0x7E, 0xF7, 0x13,
+    0xE9, 0x80, 0x06, 0x86, 0xE9, 0x3C, 0x95, 0x27, 0x5A, 0x72, 0xC5, 0x72, 0x64, 0x6E, 0xCB, 0xCB,
+    0x6D, 0xC9, 0xE8, 0x32, 0x8B, 0xC5, 0xB2, 0xCA, 0x6D, 0x1D, 0xBB, 0x6C, 0xEE, 0x7E, 0xC0, 0x60,
+    0xF8, 0x4A, 0x64, 0x16, 0x44, 0xB7, 0xCA, 0x11, 0xED, 0x2E, 0xCB, 0x62, 0x18, 0x0C, 0xCB, 0xF1,
+    0xE5, 0x6E, 0x3D, 0xA6, 0x9A, 0x18, 0x3B, 0xB6, 0x89, 0xCD, 0x9E, 0x65, 0x15, 0x24, 0xE9, 0x53,
+    0x15, 0xCC, 0x26, 0xB7, 0x30, 0xB8, 0xD4, 0x91, 0x6A, 0xD6, 0x86, 0xB1, 0x63, 0xB6, 0x59, 0xFC,
+    0xBD, 0xDC, 0xD6, 0x24, 0x89, 0xC5, 0x05, 0x19, 0xDE, 0xC8, 0x92, 0xCD, 0xAF, 0xC6, 0x23, 0x5B,
+    0x54, 0xA2, 0x20, 0xC3, 0x5F, 0x32, 0xCA, 0xE6, 0x06, 0xC9, 0x6D, 0x16, 0x89, 0xA5, 0xCF, 0x32,
+    0x8C, 0x2E, 0xC9, 0x66, 0x4D, 0xA9, 0x86, 0x81, 0xD4, 0x93, 0x45, 0x9A, 0x58, 0xAB, 0x72, 0x64,
+    0xE0, 0x0F, 0xCE, 0xF0, 0x95, 0x4B, 0xB9, 0xA9, 0xDD, 0x5F, 0x61, 0x94, 0x49, 0x86, 0xE1, 0x5C,
+    0x6E, 0xB7, 0x65, 0xB3, 0xDE, 0x96, 0x6D, 0x34, 0x0C, 0xB2, 0x77, 0xCA, 0x6E, 0x31, 0x0C, 0x3F,
+    0xEF, 0x82, 0x61, 0xF8, 0x35, 0x82, 0x61, 0xF0, 0x0C, 0x0D, 0xE3, 0x84, 0x26, 0xB6, 0x69, 0xAF,
+    0x21, 0xB9, 0xB5, 0x86, 0x74, 0x7F, 0x28, 0xD8, 0x69, 0x56, 0x43, 0xF2, 0x44, 0x59, 0x92, 0x63,
+    0x55, 0xC7, 0x56, 0x38, 0xCD, 0x60, 0x48, 0x72, 0x04, 0x43, 0xD6, 0x44, 0x30, 0xA0, 0x4C, 0x30,
+    0x3B, 0x9F, 0xDF, 0x09, 0x26, 0x4D, 0xEF, 0x3E, 0x23, 0x98, 0xE4, 0xBF, 0xF1, 0x21, 0xC1, 0x24,
+    0xF7, 0xFD, 0xBF, 0x25, 0x98, 0xD4, 0xF1, 0x0E, 0xC1, 0x24, 0xCB, 0xEB, 0x04, 0x93, 0x5A, 0x2A,
+    0x82, 0x49, 0x26, 0x57, 0x04, 0x93, 0xEA, 0x54, 0x11, 0x4C, 0xAA, 0xB6, 0x8A, 0xD0, 0x31, 0xAA,
+    0x65, 0xF3, 0x2C, 0x72, 0xEC, 0x13, 0xB3, 0x3C, 0xBB, 0x67, 0x6B, 0xA1, 0x27, 0x17, 0x0D, 0x1E,
+    0x60, 0xE9, 0xB8, 0x68, 0xF0, 0xA2, 0x5B, 0x95, 0xC8, 0x45, 0x1F, 0x47, 0xC3, 0xD3, 0xEB, 0xC3,
+    0x75, 0x6F, 0x72, 0x40, 0x96, 0xE5, 0xFA, 0xED, 0x9F, 0xFA, 0xC4, 0x28, 0x96, 0x96, 0xFD, 0xAE,
+    0x06, 0x2F, 0x8E, 0x24, 0xDD, 0x1B, 0x54, 0x3C, 0x4A, 0x43, 0x31, 0xC7, 0x2C, 0x0D, 0x1F, 0x90,
+    0x0C, 0xA1, 0xE3, 0x0D, 0x42, 0x5D, 0xBC, 0xD2, 0xEE, 0x36, 0x59, 0x5E, 0xCD, 0xAA, 0xF9, 0x80,
+    0x51, 0xD3, 0x0D, 0x8B, 0xFA, 0x7D, 0xDA, 0xD4, 0xF2, 0x10, 0xD5, 0x25, 0x31, 0x18, 0x59, 0xE5,
+    0x36, 0x87, 0x5C, 0x6A, 0x78, 0xEE, 0x73, 0x21, 0x78, 0x0A, 0x5B, 0xE9, 0xD9, 0x8E, 0x3D, 0x50,
+    0xF2, 0xD8, 0xFD, 0x9D, 0xDC, 0xF6, 0xD2, 0x71, 0xFD, 0x98, 0xD1, 0x10, 0xAA, 0x02, 0x71, 0xFC,
+    0xAA, 0x02, 0x58, 0x0B, 0x78, 0xFD, 0xCF, 0x0E, 0xB4, 0xE4, 0x1A, 0xDE, 0x84, 0x77, 0xCA, 0x07,
+    0x7B, 0x92, 0x2A, 0xDD, 0x1B, 0xF4, 0xCB, 0xB9, 0x65, 0x69, 0x78, 0xCE, 0x01, 0x7E, 0xE3, 0x43,
+    0x80, 0xB9, 0x61, 0xE9, 0x09, 0x5D, 0x56, 0x4F, 0x99, 0xB0, 0x62, 0x16, 0x6B, 0xC3, 0x60, 0x98,
+    0xBB, 0x5D, 0x2D, 0x83, 0x5F, 0xD5, 0xEF, 0xE5, 0x9D, 0xE5, 0x35, 0xE5, 0x95, 0x7E, 0x95, 0x5F,
+    0x2B, 0x66, 0x43, 0x68, 0xF8, 0xD6, 0xB4, 0xAB, 0x03, 0x16, 0x79, 0xC8, 0xAA, 0x28, 0xE2, 0xFD,
+    0xAB, 0x2B, 0xA9, 0xDB, 0x25, 0xC9, 0x17, 0x1A, 0x6E, 0xD6, 0xE1, 0x0A, 0xD4, 0xF3, 0x48, 0x6A,
+    0x4B, 0xAE, 0x09, 0x46, 0xE9, 0xFA, 0xFA, 0xAD, 0x92, 0x42, 0x1C, 0x24, 0xCF, 0x28, 0x0F, 0xEA,
+    0x21, 0x35, 0x7C, 0x40, 0x60, 0xE9, 0x52, 0x9F, 0xC4, 0xBB, 0x8C, 0xED, 0xEA, 0x56, 0xFD, 0x7E,
+    0xC3, 0x50, 0x68, 0xBC, 0x96, 0x41, 0x9A, 0x36, 0xA9, 0x3D, 0x60, 0xAA, 0x0C, 0xB1, 0xA8, 0xFB,
+    0x6F, 0x02, 0x7B, 0x0B, 0xCC, 0x3D, 0xA4, 0xE2, 0x64, 0x3E, 0xF3, 0x35, 0x4D, 0x17, 0x26, 0xB6,
+    0x78, 0xC2, 0xF7, 0xF3, 0x63, 0xDE, 0x4E, 0x0C, 0x2C, 0xEE, 0xFD, 0xD5, 0x66, 0x93, 0x10, 0x8B,
+    0x7B, 0x2F, 0xDA, 0x6C, 0xD6, 0x7B, 0x62, 0xF9, 0xD4, 0x39, 0x92, 0x2D, 0x8C, 0xE2, 0x4F, 0x6E,
+    0x56, 0x2C, 0x52, 0xB1, 0xD3, 0x1E, 0x42, 0xA1, 0xF3, 0x1C, 0xBC, 0x04, 0xBF, 0x01, 0x61, 0xE2,
+    0xBB, 0xB0, 0x74, 0x2C, 0x1D, 0x41, 0xD3, 0x52, 0x13, 0xE5, 0xA2, 0x5C, 0x52, 0xB7, 0xA9, 0x65,
+    0x6C, 0x93, 0xAA, 0x92, 0x26, 0x74, 0xA9, 0x42, 0x6A, 0x18, 0x4A, 0x06, 0xC5, 0xCD, 0x52, 0x97,
+    0xFA, 0x28, 0x19, 0x7E, 0x63, 0x95, 0x34, 0x7D, 0x2F, 0x49, 0x25, 0x19, 0xAA, 0xBA, 0x10, 0x34,
+    0x9E, 0xF1, 0x42, 0xA4, 0x96, 0x70, 0x4A, 0x6E, 0x2D, 0xA7, 0x24, 0x24, 0xA9, 0x49, 0x92, 0x86,
+    0x26, 0x4B, 0x5A, 0x5B, 0x0A, 0xB0, 0x29, 0xEE, 0x70, 0x90, 0xDA, 0x23, 0x09, 0x9E, 0x25, 0xE9,
+    0x17, 0x2F, 0xE7, 0x9B, 0xEE, 0x1D, 0xA1, 0xF2, 0x78, 0xE6, 0xBC, 0xA5, 0xAA, 0x54, 0xFA, 0xA3,
+    0x33, 0x53, 0xFB, 0xEF, 0x56, 0x8F, 0xC9, 0x43, 0x39, 0xAA, 0x74, 0x04, 0xEC, 0xC8, 0xF0, 0x31,
+    0x8F, 0x09, 0x96, 0x2F, 0xF0, 0x06, 0xB1, 0xDB, 0x0D, 0xE3, 0xB4, 0xBA, 0xCD, 0x30, 0xBA, 0xE4,
+    0x56, 0xC3, 0xD8, 0x27, 0x5F, 0x90, 0xEB, 0x14, 0x0D, 0x63, 0xB7, 0xBF, 0x50, 0x25, 0x5F, 0x6E,
+    0x29, 0x0F, 0x6C, 0xAE, 0x3C, 0xDE, 0xF1, 0x05, 0x5E, 0x67, 0x69, 0xF9, 0x1E, 0x5F, 0x39, 0xE7,
+    0x32, 0xCB, 0xAE, 0x5B, 0xA5, 0xFB, 0x90, 0x87, 0xFF, 0xD8, 0x72, 0x9B, 0x12, 0x09, 0x72, 0x48,
+    0xA4, 0xC8, 0xF6, 0xFA, 0xFA, 0x2D, 0xA9, 0x67, 0x6F, 0xD9, 0x1C, 0xC9, 0xB2, 0x75, 0xAC, 0x86,
+    0xA5, 0x2E, 0xC7, 0x2D, 0xA6, 0xAD, 0x4D, 0x52, 0xBF, 0x77, 0xAB, 0x64, 0x71, 0xB3, 0x64, 0x8A,
+    0x94, 0x8A, 0x3C, 0xFD, 0x9D, 0x88, 0x10, 0x0A, 0x09, 0x1B, 0x24, 0x9B, 0x88, 0x52, 0x1F, 0xFD,
+    0x26, 0x4D, 0x73, 0x9F, 0x55, 0x33, 0x5A, 0x86, 0x8E, 0xB9, 0x63, 0xF3, 0x44, 0x4F, 0xF2, 0xC4,
+    0x89, 0xE4, 0xD9, 0x3A, 0x72, 0x0F, 0x2D, 0x7C, 0x09, 0x3E, 0x0F, 0x73, 0x47, 0x71, 0x92, 0xA1,
+    0x2E, 0x69, 0xE6, 0x29, 0xCA, 0x25, 0xF5, 0xA9, 0x1C, 0xB1, 0xD0, 0x7F, 0x66, 0xE0, 0x5B, 0xBF,
+    0x73, 0x86, 0x88, 0x85, 0xEE, 0xCC, 0x5C, 0xCE, 0x80, 0x54, 0x45, 0x32, 0xAE, 0x30, 0xF5, 0xEB,
+    0x1D, 0xBA, 0x66, 0x2A, 0x2C, 0x62, 0x90, 0xA4, 0x7A, 0xF1, 0x6C, 0x8E, 0x34, 0xB1, 0x79, 0xD2,
+    0xC4, 0xEA, 0x58, 0x1B, 0x42, 0xCB, 0x68, 0x18, 0x1B, 0x86, 0x17, 0xCB, 0x70, 0x29, 0x2B, 0x9E,
+    0xBF, 0xCA, 0xA0, 0x12, 0x51, 0xB9, 0x4B, 0x5C, 0x35, 0x5C, 0xCC, 0xC4, 0x8F, 0x94, 0xD5, 0xC4,
+    0x26, 0x35, 0x90, 0x4A, 0xE9, 0x89, 0x13, 0x7F, 0x0A, 0x0F, 0x49, 0x8E, 0x0F, 0xE1, 0xDB, 0x60,
+    0xD9, 0x3C, 0x4B, 0x97, 0xE5, 0x63, 0x4D, 0x30, 0x0C, 0x5D, 0xD2, 0x14, 0xC5, 0xDC, 0xA0, 0x3E,
+    0xC9, 0xAD, 0x15, 0xA1, 0x45, 0x76, 0xFF, 0xEF, 0xBB, 0xE1, 0xCB, 0x0F, 0xF7, 0xD3, 0x14, 0xDB,
+    0x83, 0x01, 0xFB, 0xC6, 0x51, 0xFF, 0x2B, 0x97, 0x73, 0x4C, 0x65, 0x91, 0x5F, 0x04, 0x4B, 0xF2,
+    0xAC, 0x9E, 0x08, 0x5F, 0x22, 0xCB, 0x6F, 0x65, 0xAA, 0xCB, 0x3B, 0xCE, 0x73, 0xFF, 0x0F, 0x5D,
+    0xF8, 0xF2, 0xC3, 0xFD, 0x34, 0xAD, 0x35, 0x2F, 0xE6, 0x26, 0x2F, 0x2C, 0xF7, 0x39, 0x7A, 0x9E,
+    0x0E, 0x96, 0xAE, 0x3D, 0x33, 0x73, 0x07, 0xB5, 0x7D, 0x4B, 0xD5, 0xB9, 0x83, 0x9E, 0xAB, 0xCF,
+    0x06, 0xC3, 0x0E, 0xD3, 0xE5, 0x78, 0xD9, 0x85, 0xF3, 0xF8, 0x80, 0x59, 0xA2, 0x22, 0xBC, 0x58,
+    0xFE, 0x49, 0xC5, 0xD3, 0xAF, 0xEA, 0x53, 0x15, 0x10, 0x54, 0x01, 0x51, 0x15, 0x4F, 0xD9, 0x54,
+    0x11, 0xFA, 0xA4, 0x8A, 0x60, 0x4B, 0xB9, 0xDF, 0xB6, 0xBB, 0xA4, 0x8A, 0xE0, 0xB7, 0x83, 0xA8,
+    0xF3, 0x40, 0xD0, 0x74, 0xE4, 0x5D, 0xA5, 0x62, 0xDE, 0xE1, 0x06, 0x36, 0x35, 0xF0, 0xC3, 0x83,
+    0x87, 0x7B, 0x89, 0x45, 0x6A, 0x98, 0x0D, 0xA3, 0xD4, 0x32, 0xD8, 0x5C, 0x78, 0x40, 0xB7, 0x95,
+    0x3C, 0x10, 0x37, 0x6F, 0xA9, 0x2E, 0x51, 0xE2, 0xD0, 0x32, 0x58, 0x60, 0xE8, 0x77, 0xB9, 0xFC,
+    0x18, 0x4D, 0xAB, 0x58, 0xBA, 0xBD, 0x66, 0x36, 0x8C, 0x6E, 0x2B, 0x4F, 0x4F, 0x4B, 0xBF, 0xCB,
+    0x6D, 0x35, 0xE3, 0xB4, 0x8A, 0xC5, 0x96, 0xE1, 0xD7, 0x89, 0x2D, 0xC3, 0x04, 0xBC, 0x54, 0xA4,
+    0xB9, 0x5A, 0xF8, 0x3E, 0xEC, 0x87, 0xA9, 0xBD, 0x2C, 0xB1, 0x3E, 0xD6, 0x37, 0x17, 0x77, 0x61,
+    0x18, 0x0F, 0xEF, 0xE1, 0x36, 0x49, 0xDC, 0xBC, 0x25, 0x73, 0x3E, 0xDD, 0x34, 0xBA, 0xFC, 0x18,
+    0xB1, 0xD8, 0x6C, 0x18, 0xFB, 0xCD, 0x66, 0x4D, 0xD1, 0x6D, 0x35, 0x63, 0xB9, 0xF4, 0xFA, 0x14,
+    0xA7, 0xE3, 0x28, 0xD9, 0xDA, 0x73, 0x1C, 0xEC, 0x50, 0x09, 0x43, 0x1E, 0xB2, 0x15, 0xA2, 0xCD,
+    0x02, 0x73, 0x97, 0x5F, 0x21, 0xDA, 0x59, 0xAC, 0xCD, 0x11, 0x90, 0x96, 0x13, 0x7F, 0x49, 0x16,
+    0xF6, 0x52, 0xB4, 0xB0, 0xAB, 0x3A, 0x3D, 0x2C, 0x03, 0xD5, 0x20, 0x97, 0x6C, 0x90, 0xDB, 0xDC,
+    0xA2, 0x29, 0xBA, 0xFD, 0x3E, 0x8B, 0x3B, 0xD6, 0x95, 0x55, 0x97, 0xB3, 0x4F, 0x5F, 0xBB, 0x65,
+    0x2B, 0x3C, 0x9B, 0x5A, 0x36, 0x4D, 0x6C, 0x9A, 0x60, 0xF0, 0x25, 0x02, 0x9A, 0x1B, 0x42, 0xCB,
+    0xDB, 0x14, 0x0B, 0x5E, 0x51, 0x6C, 0xB7, 0xA6, 0x64, 0x18, 0xDD, 0x2A, 0x97, 0x0C, 0xA3, 0x2F,
+    0x35, 0x44, 0xF5, 0xFB, 0x8F, 0xD6, 0x4F, 0x59, 0xD5, 0x27, 0xC3, 0x38, 0x1D, 0xB5, 0xDF, 0x8E,
+    0xE7, 0x92, 0xDC, 0x6A, 0x18, 0x5D, 0x2E, 0x07, 0x35, 0x7B, 0xFE, 0x9E, 0xB9, 0x67, 0xB5, 0x25,
+    0x59, 0xBD, 0x99, 0x42, 0x12, 0x6C, 0x9A, 0xCE, 0x67, 0x93, 0xBE, 0x26, 0x49, 0xAF, 0xC1, 0x72,
+    0xA6, 0xC5, 0x60, 0xEE, 0xF8, 0x4D, 0xE6, 0x9A, 0xD0, 0x25, 0xB9, 0xAD, 0x22, 0x18, 0xC6, 0xAE,
+    0x30, 0x8A, 0xA1, 0x26, 0x76, 0x49, 0x96, 0x9B, 0xC2, 0xA8, 0xA5, 0xC3, 0xAB, 0xDB, 0xFC, 0x30,
+    0xA9, 0xE2, 0x1D, 0x82, 0xDC, 0xDA, 0x25, 0xB5, 0x54, 0x84, 0x9A, 0xB9, 0x4B, 0x9A, 0x52, 0xC3,
+    0xDE, 0x23, 0xF8, 0x01, 0xA1, 0x23, 0xDF, 0xBF, 0x3A, 0x8E, 0x09, 0x7F, 0x5D, 0x6D, 0x6E, 0xB3,
+    0x5C, 0x72, 0x9B, 0x58, 0x58, 0xAA, 0x5C, 0xF1, 0x23, 0xE7, 0xA4, 0xFE, 0x97, 0x42, 0xEC, 0x7F,
+    0x03, 0xE5, 0xBD, 0x3D, 0xCC, 0x26, 0x59, 0x95, 0xE7, 0xF9, 0x8B, 0x88, 0xCA, 0x0C, 0x9A, 0x98,
+    0x9E, 0x8B, 0x41, 0x32, 0x74, 0xD5, 0x68, 0xA3, 0x8D, 0x31, 0x66, 0x98, 0x1D, 0x62, 0x8C, 0x35,
+    0x56, 0x2B, 0xE0, 0x06, 0xA0, 0x5D, 0x0C, 0x0C, 0x72, 0x57, 0xF5, 0x80, 0xB6, 0x31, 0x68, 0xA3,
+    0x47, 0x1A, 0x40, 0x3B, 0x39, 0xC6, 0x1A, 0x6D, 0x40, 0x47, 0x00, 0x06, 0x2B, 0x61, 0x90, 0x46,
+    0x7F, 0x48, 0x3B, 0x46, 0x63, 0xD0, 0x52, 0xF3, 0xB2, 0x52, 0x8E, 0x81, 0xC1, 0x4A, 0x50, 0x11,
+    0x64, 0x49, 0x5B, 0x06, 0x06, 0x01, 0xA8, 0xA7, 0x0C, 0x0C, 0xA2, 0x9B, 0x62, 0x5A, 0x53, 0x65,
+    0xD4, 0x85, 0x89, 0x6A, 0x22, 0xB3, 0x6E, 0xC4, 0x7F, 0x8D, 0x73, 0xE3, 0x79, 0xDF, 0xCC, 0xCA,
+    0xE2, 0xAB, 0x0B, 0x1A, 0x98, 0xA7, 0x2A, 0xE3, 0x79, 0x9F, 0xEF, 0x88, 0xFB, 0x71, 0xEE, 0x39,
+    0xFF, 0xF3, 0x3F, 0xFF, 0x7B, 0xAD, 0xF5, 0x6B, 0x17, 0xBB, 0xD8, 0xC5, 0x26, 0x00, 0xF0, 0x06,
+    0x17, 0xDC, 0xE2, 0x16, 0xB7, 0x56, 0x6B, 0x15, 0xAB, 0xE8, 0x8E, 0xFF, 0x36, 0xFB, 0xAF, 0xDE,
+    0xEA, 0xAD, 0x89, 0x4D, 0xF4, 0xCB, 0xE3, 0xB7, 0xB1, 0x5B, 0x35, 0x02, 0xF5, 0xAB, 0x1E, 0x7A,
+    0xC8, 0xB5, 0x43, 0x23, 0xCD, 0x48, 0x5A, 0x0B, 0xE9, 0x4E, 0x74, 0x5B, 0xF3, 0xDE, 0x58, 0xAF,
+    0xCD, 0xBB, 0xA3, 0x0F, 0x4D, 0x11, 0xFC, 0xDC, 0x64, 0x6D, 0x37, 0x35, 0x30, 0x5C, 0x39, 0x78,
+    0x18, 0x66, 0x0F, 0x43, 0xF0, 0xD0, 0x05, 0x0F, 0x7E, 0xF5, 0x3C, 0xD6, 0xA8, 0xCB, 0xBE, 0xE2,
+    0x24, 0xC5, 0x52, 0xD2, 0x9A, 0x49, 0x9A, 0xA9, 0x75, 0x1F, 0xF8, 0x23, 0x5E, 0x79, 0x78, 0xEA,
+    0x11, 0x07, 0xBB, 0x5D, 0x03, 0xE8, 0xD4, 0x43, 0x23, 0xB5, 0x54, 0x52, 0x24, 0xD3, 0x37, 0x35,
+    0xE1, 0x97, 0x72, 0xA7, 0x14, 0x7E, 0x62, 0x98, 0x8A, 0x88, 0x8B, 0xFC, 0x0B, 0xD0, 0x08, 0xD4,
+    0x11, 0xC8, 0x34, 0x02, 0xCD, 0x7A, 0xED, 0x66, 0x2E, 0x69, 0xC7, 0x4B, 0x9A, 0x72, 0x49, 0x2B,
+    0xF8, 0x00, 0x14, 0x02, 0xE8, 0x02, 0x50, 0xED, 0x00, 0x9A, 0x00, 0x67, 0x9F, 0x6D, 0xB9, 0xF6,
+    0x59, 0x49, 0x8A, 0x92, 0xA4, 0xAF, 0x4B, 0x52, 0xF4, 0xF7, 0x25, 0xB1, 0xC2, 0xFB, 0xDB, 0x6B,
+    0xC0, 0xEB, 0x8A, 0x29, 0x6B, 0xAB, 0xA7, 0xB7, 0x46, 0x9F, 0x59, 0x3B, 0x49, 0xB1, 0x90, 0xB4,
+    0xE2, 0xEF, 0x0D, 0x11, 0xB7, 0xE4, 0xA2, 0x8C, 0xF8, 0x31, 0xDF, 0x71, 0x0B, 0x43, 0x5F, 0x6C,
+    0x34, 0x33, 0xA2, 0x8C, 0x0C, 0x23, 0x9A, 0xBA, 0x99, 0x41, 0xDA, 0x33, 0x49, 0x0A, 0xBA, 0xA3,
+    0xEF, 0xED, 0x75, 0xFF, 0xBF, 0xB7, 0x3E, 0xEB, 0x21, 0xB7, 0x4B, 0xEF, 0xA4, 0x4C, 0xFA, 0xBA,
+    0x14, 0x1A, 0x45, 0xAF, 0x2D, 0x93, 0xFA, 0x6E, 0x27, 0x53, 0x9F, 0x29, 0xD0, 0x04, 0x9C, 0x28,
+    0x36, 0xE8, 0x56, 0x86, 0x91, 0x5C, 0xA3, 0x5B, 0xC0, 0xED, 0x99, 0x80, 0x21, 0xF8, 0x09, 0x0A,
+    0xBD, 0x67, 0x85, 0x5A, 0x51, 0xEA, 0x91, 0x5E, 0xD4, 0x42, 0x25, 0x49, 0x40, 0xA3, 0x1E, 0xAE,
+    0xBD, 0x53, 0xCB, 0x0D, 0x18, 0x24, 0xCD, 0x94, 0x92, 0x36, 0x78, 0xCB, 0x1D, 0x5D, 0xF4, 0xC0,
+    0x10, 0x00, 0x2A, 0xC1, 0xF9, 0x41, 0xAD, 0x9B, 0xA4, 0x41, 0x42, 0x25, 0xED, 0x80, 0xA4, 0x19,
+    0xCA, 0xAD, 0x7B, 0xF6, 0xE1, 0xFF, 0x6F, 0xB4, 0x47, 0x17, 0x16, 0x8F, 0x78, 0xF5, 0x2D, 0xBD,
+    0xBD, 0xD6, 0x6C, 0xD0, 0x28, 0xE2, 0xA4, 0xB9, 0x58, 0x2B, 0x21, 0xEA, 0x50, 0xCF, 0xEC, 0x85,
+    0xB8, 0xDE, 0xFA, 0x08, 0xA5, 0x16, 0xF8, 0xAA, 0x16, 0xAA, 0x6F, 0x6B, 0xE6, 0xE3, 0x4E, 0x53,
+    0x19, 0x6A, 0xF5, 0xBE, 0x6F, 0xF6, 0x5C, 0xF8, 0xE0, 0x76, 0x86, 0xBE, 0xDB, 0xF2, 0x98, 0x29,
+    0xBA, 0x31, 0xD7, 0xF2, 0x15, 0x4A, 0x7D, 0x67, 0xA4, 0x54, 0x84, 0x4A, 0x5F, 0x0B, 0xF8, 0xD5,
+    0xF7, 0x99, 0xCA, 0x48, 0x3D, 0x0F, 0xA1, 0x8C, 0x85, 0x24, 0x6A, 0x69, 0xA4, 0xD3, 0x04, 0x37,
+    0x5A, 0xA8, 0xE6, 0x6A, 0xD6, 0xAC, 0xEF, 0xE9, 0x53, 0xFA, 0xEC, 0xEE, 0xF6, 0x7A, 0xAE, 0x67,
+    0x3B, 0xBD, 0xEB, 0x4F, 0xDD, 0x06, 0x32, 0xBB, 0x56, 0xB7, 0x9F, 0x86, 0x19, 0xBA, 0x9E, 0x3C,
+    0x92, 0x45, 0xA0, 0xA3, 0x98, 0x01, 0x37, 0xBA, 0x31, 0x1B, 0x6E, 0x17, 0x73, 0x4D, 0xAD, 0x35,
+    0x0F, 0xEF, 0xA0, 0x7B, 0x61, 0x65, 0x7D, 0x3B, 0x3B, 0x2B, 0x5F, 0xF9, 0x58, 0x1E, 0x59, 0xF8,
+    0xD8, 0x97, 0x8B, 0x95, 0x9B, 0xBC, 0x7D, 0x2D, 0x56, 0xE0, 0x1D, 0x6B, 0xB9, 0x3C, 0x70, 0xB7,
+    0x02, 0x6F, 0xFF, 0x72, 0x11, 0x81, 0xB7, 0x7F, 0xAC, 0xD8, 0x81, 0x8F, 0xBD, 0x3D, 0xD3, 0xF3,
+    0x5F, 0xE1, 0x2B, 0x9E, 0x41, 0x91, 0xB5, 0x6E, 0x1B, 0x2D, 0x79, 0x70, 0x63, 0xF6, 0x61, 0xCA,
+    0xA9, 0x08, 0x36, 0x6D, 0xED, 0x24, 0xF0, 0x3D, 0xE5, 0x0A, 0xD5, 0xFE, 0xA7, 0xC3, 0x04, 0x0C,
+    0xDA, 0x01, 0xAE, 0x5D, 0xA4, 0x2E, 0xB8, 0xAE, 0x9E, 0x41, 0x63, 0x79, 0x6F, 0x68, 0x9B, 0x71,
+    0xE7, 0x77, 0x8A, 0x15, 0xEA, 0x99, 0x41, 0x7D, 0x7D, 0x7F, 0x67, 0x2F, 0xD6, 0x62, 0x71, 0xB3,
+    0x7B, 0x69, 0x88, 0x8D, 0x14, 0x9A, 0x75, 0x38, 0x3A, 0xEE, 0xF5, 0x17, 0x77, 0x46, 0x49, 0x85,
+    0xB4, 0x00, 0x9C, 0x4E, 0xA7, 0xD3, 0x7B, 0x25, 0xC5, 0x21, 0xCD, 0x88, 0x08, 0xF8, 0x11, 0x8A,
+    0x57, 0xFC, 0x91, 0xFF, 0xA5, 0xD7, 0x5E, 0x4B, 0x5F, 0x97, 0x7E, 0x28, 0xC5, 0x1B, 0xA7, 0x27,
+    0x81, 0x37, 0x02, 0x4F, 0x68, 0x81, 0xFD, 0x34, 0x50, 0xCC, 0x54, 0xA3, 0xEB, 0xC9, 0xC2, 0x5B,
+    0x1B, 0xB5, 0x5F, 0x7E, 0x5B, 0xFD, 0xC2, 0xFC, 0xB6, 0x3F, 0x2C, 0xEF, 0x86, 0x7F, 0xF5, 0xA5,
+    0xF2, 0x6E, 0x70, 0xA1, 0x7C, 0x66, 0x72, 0xA1, 0x54, 0xEB, 0x42, 0xF9, 0x22, 0xEE, 0x4B, 0xE5,
+    0x37, 0x46, 0xF7, 0x87, 0xE5, 0xD3, 0xE1, 0xBF, 0x7B, 0x5B, 0xF3, 0xD2, 0xF6, 0xB6, 0xB7, 0xDE,
+    0xB8, 0xF9, 0xCF, 0xFF, 0xD0, 0xB5, 0x64, 0xA1, 0x98, 0xA9, 0x26, 0xF6, 0xD3, 0x00, 0xB5, 0x16,
+    0xE0, 0x04, 0xD7, 0x4E, 0x4F, 0x16, 0xD2, 0xD6, 0x49, 0x5F, 0x97, 0xE2, 0x8D, 0xD3, 0x09, 0xAE,
+    0x41, 0xAD, 0xBE, 0x92, 0x72, 0x29, 0xFA, 0xEF, 0x0F, 0xCF, 0xAE, 0xF9, 0x3E, 0xE0, 0x5E, 0x0E,
+    0x68, 0x68, 0xDD, 0x0B, 0x31, 0xDF, 0xFC, 0x7D, 0xDD, 0x95, 0x96, 0x4A, 0x1B, 0x4F, 0xEC, 0x90,
+    0xDD, 0x7C, 0xD5, 0x4B, 0x2B, 0x22, 0xE5, 0x03, 0x8D, 0xD0, 0x49, 0x1A, 0x5F, 0xFD, 0xCD, 0xF0,
+    0x16, 0xEB, 0x86, 0xEC, 0x74, 0x3A, 0x3D, 0x79, 0xFE, 0xD4, 0x20, 0x69, 0x3C, 0x1A, 0x3A, 0xD7,
+    0xC2, 0xA0, 0xB5, 0x94, 0x16, 0x1F, 0xBA, 0x59, 0xAD, 0xEE, 0xC6, 0x62, 0xE7, 0x66, 0xBD, 0x80,
+    0x46, 0xAA, 0x08, 0xC3, 0x88, 0x8B, 0xA0, 0x91, 0x7A, 0x25, 0xD7, 0xF3, 0x17, 0xEF, 0x93, 0x76,
+    0x2F, 0x2D, 0x9D, 0xD4, 0xF2, 0x18, 0x99, 0xB6, 0x42, 0xFA, 0x1B, 0xDD, 0x89, 0x4F, 0x65, 0xFA,
+    0x10, 0x7E, 0xA4, 0x09, 0xF8, 0x90, 0x2B, 0x20, 0xB5, 0xEF, 0x18, 0x02, 0xC5, 0x0E, 0xEA, 0xE9,
+    0xE6, 0x6C, 0xF8, 0xA1, 0xB4, 0x48, 0x4B, 0xAD, 0x99, 0x13, 0xD0, 0xE7, 0x4B, 0x11, 0xAB, 0x58,
+    0xAF, 0x3E, 0x74, 0x63, 0xC7, 0x9B, 0x01, 0x1E, 0x83, 0xC7, 0xA8, 0x23, 0x4F, 0x44, 0x7C, 0xC4,
+    0x47, 0x3A, 0x3B, 0xAE, 0xF8, 0xF5, 0x67, 0x3B, 0x3E, 0xFC, 0x7F, 0x44, 0x91, 0x6E, 0xCF, 0x14,
+    0xE9, 0xF4, 0xC2, 0xCB, 0x7A, 0xB2, 0x93, 0xFE, 0xAB, 0xB6, 0x4E, 0xFA, 0x96, 0x62, 0xF7, 0xA2,
+    0x5A, 0x2D, 0xC3, 0x5F, 0x7F, 0x9E, 0xDF, 0x69, 0x87, 0xF9, 0xD2, 0xF4, 0x3C, 0x70, 0x5C, 0x2E,
+    0x8F, 0x0A, 0x00, 0x5F, 0x48, 0xED, 0x98, 0x9D, 0x4E, 0x2D, 0x9D, 0xB4, 0xD1, 0x49, 0x1A, 0x1B,
+    0x49, 0x73, 0x25, 0x7D, 0x26, 0x20, 0xAD, 0x1D, 0x8D, 0xF4, 0xE9, 0x50, 0x48, 0x6B, 0x47, 0x27,
+    0x7D, 0x3A, 0x94, 0x0F, 0xFF, 0xE9, 0x2F, 0xDF, 0x50, 0x4B, 0x9F, 0x4E, 0x1F, 0x2B, 0xA4, 0x4F,
+    0x07, 0xAA, 0xFF, 0xBA, 0x76, 0x80, 0xFF, 0x74, 0x80, 0xE2, 0xE7, 0xF8, 0x73, 0x86, 0x62, 0x7D,
+    0x23, 0xE0, 0x5B, 0xA0, 0x08, 0xA4, 0x19, 0x71, 0xAD, 0xD5, 0x77, 0x24, 0xE9, 0x9E, 0xC6, 0x27,
+    0x81, 0x66, 0xF1, 0xF1, 0x5F, 0x6E, 0xF9, 0x56, 0xC4, 0x6A, 0xF5, 0xB3, 0x3F, 0x66, 0x70, 0xE0,
+    0xD6, 0x96, 0x49, 0xAD, 0xD7, 0x78, 0xFD, 0x4E, 0xA0, 0x8C, 0x64, 0x82, 0x6E, 0xA4, 0x7E, 0xF8,
+    0xC1, 0xC6, 0x2D, 0x45, 0x2F, 0xBD, 0x2F, 0x8D, 0xAF, 0x4C, 0x33, 0x5E, 0x4B, 0xB1, 0x0F, 0xA1,
+    0x19, 0x9B, 0x79, 0xC7, 0x3F, 0xBD, 0xA2, 0x7A, 0x2E, 0x62, 0xD7, 0xBB, 0x20, 0xFC, 0xA7, 0xB6,
+    0x6C, 0x2B, 0xF7, 0x5B, 0xA1, 0x92, 0x28, 0x35, 0x1F, 0x63, 0xF2, 0xFA, 0xC5, 0x9D, 0xD1, 0x4B,
+    0xC8, 0x9A, 0xD8, 0x6E, 0x6F, 0x3E, 0xDB, 0xF4, 0x05, 0x78, 0x62, 0x04, 0xBA, 0x11, 0x6E, 0x6D,
+    0x80, 0x5B, 0x30, 0x8B, 0x9A, 0x0B, 0x8A, 0xB3, 0x71, 0x78, 0x7C, 0x18, 0xA1, 0x5A, 0x81, 0x32,
+    0x02, 0xB6, 0xE6, 0x8E, 0xD0, 0x4C, 0xE9, 0xA9, 0x22, 0x1E, 0x4F, 0x0D, 0x6D, 0x7A, 0xCA, 0x05,
+    0x9E, 0x18, 0xE9, 0x46, 0xF2, 0x48, 0x15, 0x29, 0x23, 0xF8, 0x3E, 0xD3, 0x48, 0x37, 0x52, 0x05,
+    0x7C, 0xA4, 0xDC, 0xC8, 0x36, 0x9C, 0xC6, 0x27, 0x24, 0xFC, 0x58, 0xEC, 0xB1, 0x90, 0x96, 0x72,
+    0x61, 0x68, 0xEC, 0xAC, 0xA9, 0xBF, 0x15, 0x01, 0x9A, 0xA9, 0x58, 0x9B, 0x11, 0x28, 0x22, 0xCA,
+    0x23, 0x80, 0xDA, 0x66, 0x6C, 0x46, 0xA0, 0x9E, 0x0B, 0x49, 0x01, 0x8A, 0x88, 0xB7, 0x65, 0x71,
+    0xE8, 0x19, 0xA4, 0x00, 0x2E, 0x00, 0xCD, 0x08, 0xF9, 0x0E, 0xE4, 0x31, 0x9D, 0x22, 0xCD, 0x08,
+    0x6E, 0x05, 0xB2, 0xBF, 0x04, 0x9A, 0x73, 0xCB, 0xBC, 0x81, 0x2B, 0xB7, 0xC3, 0xED, 0xC2, 0x4D,
+    0xA9, 0x99, 0x72, 0x91, 0x9A, 0xC9, 0x8F, 0xA9, 0x99, 0xAA, 0xF5, 0x68, 0x26, 0x91, 0x9A, 0xE9,
+    0xC7, 0xB5, 0x49, 0x1D, 0xD2, 0x53, 0xF6, 0x5A, 0x19, 0xA1, 0xEB, 0x9B, 0x1D, 0xBA, 0x11, 0x17,
+    0x6A, 0x6D, 0x94, 0x91, 0x6C, 0x2B, 0xA5, 0x40, 0x37, 0xE2, 0x47, 0x7D, 0x4B, 0x7D, 0xB9, 0x51,
+    0x2E, 0x6E, 0x71, 0xEB, 0x13, 0x12, 0x62, 0x40, 0x9F, 0x92, 0x96, 0x66, 0xCA, 0x6E, 0xD6, 0x8B,
+    0x97, 0x8A, 0xF5, 0xF0, 0x82, 0x04, 0x0C, 0xD6, 0x26, 0xD0, 0x2C, 0xD6, 0x5E, 0x54, 0x11, 0x6B,
+    0x13, 0x7B, 0x93, 0x0B, 0x64, 0xEA, 0xB1, 0x36, 0xE9, 0xEE, 0x5F, 0xF4, 0xF6, 0xE3, 0xD2, 0x66,
+    0xBD, 0x2F, 0x69, 0x22, 0x13, 0x94, 0xE6, 0x64, 0x4D, 0x47, 0x33, 0x7C, 0xE5, 0xDC, 0x32, 0xED,
+    0xD5, 0x66, 0xFA, 0x67, 0x24, 0x4B, 0x5B, 0xCE, 0x69, 0x9D, 0x47, 0x3D, 0x85, 0x34, 0xDB, 0xE5,
+    0x0E, 0x2F, 0x08, 0x8A, 0x0D, 0xAA, 0xB9, 0x5E, 0xAC, 0x39, 0xDE, 0x86, 0x52, 0xDF, 0xD0, 0xCC,
+    0x64, 0x3B, 0xC9, 0xDB, 0xF3, 0x23, 0xD0, 0x08, 0xCA, 0x15, 0x28, 0xB4, 0xA5, 0x91, 0xF6, 0x3F,
+    0x0D, 0x0B, 0xCD, 0xC4, 0x13, 0x23, 0xA8, 0x2F, 0x22, 0x55, 0x04, 0xB7, 0x32, 0xB4, 0x99, 0x46,
+    0x32, 0xF5, 0x6E, 0xC6, 0x47, 0xB2, 0x21, 0xE4, 0x11, 0xA7, 0x71, 0xD0, 0x46, 0xD7, 0x17, 0x7B,
+    0x74, 0x52, 0xEB, 0x02, 0x43, 0x33, 0x76, 0x6A, 0xB3, 0x9D, 0xFA, 0x5B, 0x91, 0x27, 0xC1, 0x8F,
+    0x69, 0x34, 0x55, 0xCB, 0x79, 0x34, 0x91, 0x46, 0x93, 0x9F, 0xD2, 0x68, 0x2A, 0xCF, 0xA3, 0x49,
+    0x6D, 0x1A, 0x4D, 0xCD, 0x31, 0x9A, 0x8A, 0x78, 0x8C, 0xA6, 0xA1, 0x3F, 0x46, 0x53, 0x38, 0x46,
+    0xD3, 0x3B, 0x5E, 0xD9, 0x4C, 0x4F, 0x42, 0xA1, 0x9E, 0x52, 0x23, 0x95, 0x46, 0x4A, 0x8D, 0x36,
+    0x94, 0x8E, 0x5B, 0x06, 0xF8, 0x64, 0x54, 0xBA, 0x9E, 0xEB, 0x1A, 0xE9, 0x34, 0x16, 0xD2, 0xE8,
+    0xA4, 0xBE, 0xD1, 0x73, 0xF8, 0x7B, 0xD6, 0x3A, 0xBE, 0x4F, 0xF7, 0xA3, 0x35, 0xAE, 0xDB, 0xDF,
+    0xF9, 0xA5, 0x52, 0x8A, 0xB9, 0x14, 0x19, 0x14, 0xA9, 0xB5, 0x92, 0x0D, 0xB7, 0xA1, 0xBA, 0xFD,
+    0x3A, 0x80, 0x52, 0x9F, 0x0C, 0x00, 0xDA, 0xBB, 0x16, 0x70, 0xC9, 0x0B, 0x88, 0x5E, 0x00, 0x65,
+    0x3F, 0x8C, 0xFC, 0x98, 0x5B, 0x72, 0xE1, 0x3B, 0x33, 0x1E, 0x4E, 0xAD, 0xD9, 0xA2, 0x08, 0x80,
+    0x37, 0xD3, 0x54, 0x9A, 0x9F, 0xC2, 0x60, 0x26, 0xC6, 0xBD, 0xAC, 0x16, 0xC8, 0xF7, 0x6E, 0x05,
+    0xF0, 0x4F, 0x6B, 0x04, 0xCA, 0xD8, 0x6C, 0x00, 0x7A, 0xA7, 0x02, 0x50, 0x07, 0x27, 0x1B, 0x81,
+    0xC3, 0x0A, 0xF8, 0xA9, 0xD4, 0x08, 0x55, 0xC4, 0x6F, 0xE6, 0x8E, 0x6A, 0x86, 0xDA, 0x9C, 0xDC,
+    0x42, 0x92, 0x16, 0xF0, 0xF7, 0x2F, 0xEE, 0xA8, 0xA7, 0x8A, 0xD0, 0xC5, 0x34, 0xC6, 0x26, 0xEA,
+    0x05, 0x1A, 0x51, 0xA8, 0x25, 0xD7, 0xBD, 0x42, 0xEA, 0x73, 0x29, 0x0E, 0x8A, 0x74, 0xD2, 0x37,
+    0xA4, 0xB1, 0x32, 0x0F, 0xE7, 0xC6, 0xA5, 0xA7, 0x0A, 0x38, 0x6B, 0x85, 0xCC, 0x86, 0x01, 0xBE,
+    0x8D, 0x66, 0x0E, 0xDD, 0x08, 0xD0, 0xF4, 0xD1, 0xAE, 0x73, 0x68, 0xCD, 0x7B, 0x36, 0x73, 0xFA,
+    0xC4, 0xE7, 0x7E, 0x53, 0x1B, 0xE7, 0x74, 0x3A, 0x9D, 0x4E, 0x4F, 0x5A, 0xB0, 0x22, 0xA9, 0x4F,
+    0x5F, 0xAF, 0x19, 0xB2, 0x41, 0xC9, 0x47, 0x2C, 0xA5, 0xE7, 0xBF, 0x28, 0xA0, 0xD8, 0x14, 0xCC,
+    0x3F, 0x94, 0x8F, 0xB8, 0x19, 0xD0, 0xFB, 0x44, 0x1E, 0x80, 0xE1, 0xE9, 0xE4, 0x0F, 0x75, 0x53,
+    0x5A, 0x71, 0x7C, 0xF0, 0xD6, 0x22, 0x75, 0x70, 0xE2, 0x04, 0xB8, 0xB5, 0x90, 0x34, 0x41, 0x15,
+    0xB1, 0xB3, 0x2F, 0x76, 0xBC, 0x14, 0x21, 0x17, 0x4E, 0x17, 0x17, 0x90, 0xE9, 0xF0, 0xAC, 0xA4,
+    0xB4, 0x76, 0x75, 0xE9, 0x3C, 0xF0, 0x2F, 0x9D, 0x3E, 0x24, 0xF8, 0x2A, 0xCD, 0x42, 0xA1, 0x11,
+    0xDF, 0xBB, 0x08, 0x0A, 0x34, 0x73, 0x15, 0xC1, 0x47, 0xDC, 0x5A, 0xCA, 0xAE, 0x61, 0xAB, 0xB5,
+    0x31, 0x48, 0xB6, 0x92, 0x7A, 0x49, 0x7A, 0x5A, 0x9A, 0x6B, 0x49, 0x0A, 0xD9, 0xEF, 0x0D, 0xFB,
+    0xED, 0x74, 0xAD, 0x3D, 0x8D, 0x24, 0xAD, 0xE9, 0xCA, 0x5B, 0xBA, 0x98, 0x49, 0x23, 0x3E, 0x52,
+    0x2B, 0xE0, 0x23, 0x85, 0x56, 0x7C, 0x04, 0x45, 0x7C, 0x84, 0x6E, 0xC3, 0x47, 0xF0, 0xFB, 0xD5,
+    0xBB, 0x46, 0x6F, 0x19, 0xF6, 0x0B, 0x6A, 0x79, 0x0B, 0x4F, 0xD2, 0x1D, 0x5D, 0x84, 0x3A, 0xBD,
+    0x25, 0x7D, 0x20, 0x7D, 0xDC, 0xBE, 0x6C, 0x58, 0xF1, 0x91, 0xCC, 0x7E, 0xA8, 0xD4, 0x84, 0x8F,
+    0xDC, 0x32, 0xBB, 0xA3, 0xDD, 0xA2, 0xBD, 0x60, 0x27, 0xD8, 0xD2, 0x48, 0xBA, 0x7D, 0x65, 0x18,
+    0x3E, 0xD1, 0xBF, 0xD1, 0x3C, 0x29, 0x0F, 0x64, 0xDA, 0x07, 0x20, 0x37, 0xCB, 0x95, 0xAD, 0x7E,
+    0x07, 0xF8, 0x92, 0x5B, 0x5F, 0x75, 0x8A, 0x3F, 0xA1, 0x7B, 0x16, 0x1C, 0x69, 0x02, 0x97, 0x02,
+    0x6B, 0x1B, 0x5C, 0x16, 0xAC, 0x16, 0x9A, 0xA9, 0x35, 0x95, 0xEA, 0x29, 0x15, 0x9C, 0xA0, 0xD0,
+    0x52, 0xEF, 0x90, 0x69, 0x6D, 0x36, 0x40, 0xD1, 0x47, 0x60, 0x38, 0xEE, 0xBA, 0x08, 0x74, 0xAF,
+    0x72, 0xB7, 0x01, 0x5D, 0xF4, 0x1B, 0x30, 0xAC, 0x5E, 0x80, 0x16, 0xBB, 0x0B, 0xB5, 0x7A, 0x72,
+    0x4D, 0x4E, 0x13, 0xA5, 0xC6, 0x52, 0x2B, 0x8D, 0xC8, 0xA5, 0xE7, 0xB5, 0xD9, 0x30, 0x58, 0xA0,
+    0xB1, 0xE1, 0x99, 0x4B, 0xF7, 0x00, 0xDE, 0x74, 0xD1, 0x42, 0xD6, 0xF2, 0xBB, 0x79, 0xA0, 0xC9,
+    0x45, 0xB3, 0x0C, 0xA1, 0x8E, 0x95, 0x6A, 0x33, 0x86, 0x95, 0x36, 0x18, 0x36, 0xA8, 0x05, 0xB5,
+    0x02, 0xB5, 0x44, 0xBD, 0x0D, 0xA1, 0xDE, 0x2A, 0x55, 0x1B, 0xC3, 0xF4, 0x55, 0xAA, 0xE9, 0xB7,
+    0x60, 0x7A, 0xB0, 0x4D, 0xB2, 0x41, 0xB7, 0xF3, 0x9E, 0x52, 0xD2, 0xBB, 0x56, 0x9C, 0xA4, 0xFB,
+    0x1B, 0x4E, 0x92, 0x36, 0x9C, 0xA6, 0x5A, 0x1B, 0x4E, 0x3D, 0x9D, 0xDA, 0xD4, 0x2A, 0x85, 0x46,
+    0x72, 0x6D, 0x99, 0x66, 0x72, 0xA9, 0x1F, 0x16, 0x72, 0x29, 0xF8, 0x48, 0x1E, 0x87, 0xE8, 0x44,
+    0x1E, 0x1B, 0x95, 0x1A, 0xF3, 0x58, 0xEA, 0x6B, 0x0A, 0x79, 0xCC, 0x14, 0xBA, 0x98, 0x47, 0xBA,
+    0x58, 0x2B, 0x8F, 0xD4, 0x2A, 0xF5, 0xAD, 0x48, 0xA9, 0x51, 0x2F, 0x47, 0x72, 0xCD, 0x5E, 0x11,
+    0xB4, 0x38, 0x45, 0xF0, 0x31, 0x53, 0x84, 0x66, 0xC3, 0xAB, 0xA5, 0x16, 0xA9, 0x65, 0x0A, 0xE9,
+    0xF9, 0x41, 0x6D, 0x61, 0xE3, 0xB5, 0x88, 0x83, 0x24, 0xF8, 0x4A, 0x2E, 0x6D, 0xF0, 0x3A, 0xAE,
+    0x5F, 0x1C, 0x83, 0xE4, 0x77, 0x21, 0xAD, 0xCE, 0x87, 0x7B, 0x40, 0x2D, 0x0B, 0x58, 0x6C, 0x3E,
+    0xA9, 0x3F, 0xE3, 0x26, 0x64, 0xB7, 0x1F, 0x1E, 0x20, 0xD9, 0xE9, 0xF4, 0x64, 0x76, 0x3A, 0x7D,
+    0x48, 0x0A, 0x8D, 0xD4, 0x49, 0xA3, 0x14, 0x07, 0xAD, 0x0C, 0xEA, 0x1B, 0x81, 0x0F, 0xF8, 0x9D,
+    0x5C, 0x2D, 0x5D, 0xC4, 0xAD, 0xA0, 0x95, 0x61, 0x04, 0x85, 0x62, 0x83, 0x5C, 0x73, 0x13, 0xA0,
+    0xD0, 0xA8, 0x16, 0x4A, 0x7D, 0x66, 0x05, 0x9C, 0xBA, 0x11, 0x70, 0xDA, 0x00, 0x1A, 0x9B, 0xDF,
+    0xDE, 0x0C, 0x68, 0x67, 0xD6, 0xC2, 0x9E, 0x2B, 0xCC, 0x06, 0x38, 0x5B, 0x2C, 0xFD, 0x23, 0x5E,
+    0x6A, 0x74, 0x1B, 0xA8, 0xA5, 0xF5, 0x8C, 0x63, 0x14, 0x92, 0x7A, 0x6E, 0x9C, 0x4E, 0x2D, 0xB9,
+    0xCE, 0x70, 0x13, 0xD7, 0xED, 0xD7, 0x34, 0x03, 0x85, 0xFE, 0xAA, 0x05, 0x27, 0xED, 0x36, 0xD8,
+    0x7B, 0x24, 0x69, 0x2C, 0xD4, 0x37, 0xEA, 0xDD, 0x4E, 0x23, 0xFC, 0x8A, 0x8F, 0x68, 0x46, 0x4B,
+    0xA1, 0x3E, 0xD7, 0xE4, 0x76, 0xDC, 0xE5, 0xD3, 0x99, 0xE6, 0x42, 0x7D, 0x2D, 0x9C, 0xDE, 0xAF,
+    0x05, 0x2F, 0xA9, 0xB5, 0xDF, 0x2F, 0xB4, 0xDF, 0x06, 0xB7, 0x03, 0xF8, 0x15, 0x78, 0x42, 0xEA,
+    0xC9, 0xAE, 0x9C, 0x09, 0x90, 0x5D, 0xDC, 0xB6, 0xD5, 0xD8, 0x20, 0xB1, 0xD5, 0x46, 0x76, 0x4B,
+    0xBD, 0xE7, 0x0A, 0xB8, 0x9D, 0x26, 0x52, 0x89, 0x52, 0x14, 0xEA, 0xD1, 0x88, 0x26, 0xFC, 0x4C,
+    0xB7, 0xE0, 0x03, 0x75, 0xA4, 0x9B, 0xA9, 0x44, 0x37, 0x91, 0x6B, 0xEC, 0x26, 0x18, 0x82, 0x0F,
+    0xD0, 0x44, 0x17, 0xA1, 0x52, 0xA1, 0x9E, 0x5C, 0xA3, 0x22, 0x0C, 0xA1, 0xD1, 0x44, 0x13, 0x0B,
+    0x6D, 0x54, 0xC2, 0x6B, 0xCA, 0x35, 0x16, 0x8A, 0x0C, 0x81, 0x46, 0x7D, 0x13, 0xC9, 0x15, 0x2A,
+    0x41, 0x13, 0x73, 0x7D, 0x2D, 0x94, 0x62, 0x08, 0x31, 0x53, 0xDF, 0xC4, 0x6E, 0xD4, 0xD4, 0xA9,
+    0x96, 0xE6, 0x2E, 0xD9, 0xCC, 0xD0, 0x69, 0x02, 0xB2, 0x0F, 0x03, 0x4D, 0xFB, 0xCF, 0xC0, 0xC7,
+    0xBA, 0xC5, 0xEB, 0xBB, 0xB3, 0xF9, 0x15, 0x45, 0xE8, 0x22, 0xBC, 0xAD, 0x8C, 0x8F, 0x30, 0x33,
+    0xD7, 0x5A, 0xC8, 0xA4, 0xD6, 0xBC, 0xCA, 0x4A, 0x52, 0x5B, 0xEA, 0x4F, 0x15, 0x72, 0xF5, 0x3E,
+    0xD2, 0x4D, 0x95, 0xA8, 0x42, 0xAE, 0x31, 0xC5, 0x87, 0x59, 0x17, 0x61, 0x90, 0xC8, 0xAD, 0x5F,
+    0xA4, 0x50, 0x68, 0x6E, 0x22, 0x9A, 0x2B, 0xD1, 0x2D, 0xB9, 0xC6, 0x7A, 0x63, 0x08, 0xA5, 0xFE,
+    0xB3, 0xF6, 0x9B, 0x92, 0xB4, 0x35, 0xDA, 0x3A, 0xE5, 0x8A, 0x4E, 0x5C, 0xBF, 0xCD, 0x1F, 0x40,
+    0xF6, 0x05, 0xA0, 0x50, 0x80, 0x62, 0xDF, 0x21, 0x5B, 0xDD, 0x08, 0x5F, 0x2D, 0x16, 0x68, 0xDA,
+    0xAF, 0x42, 0x15, 0x3C, 0xA0, 0xA1, 0x87, 0x5A, 0x3D, 0xF0, 0xD4, 0xA5, 0x5B, 0xFB, 0x24, 0x09,
+    0x8A, 0xE8, 0xA4, 0x9E, 0x41, 0x5A, 0xE8, 0xEE, 0xDD, 0x12, 0xCD, 0x5A, 0x68, 0x2C, 0x37, 0x86,
+    0xC0, 0x40, 0x13, 0x0F, 0x68, 0xED, 0x9F, 0x68, 0xA4, 0x4A, 0x26, 0x3A, 0xB9, 0x8D, 0x7E, 0xCF,
+    0x35, 0xBA, 0x9D, 0x21, 0x94, 0x6A, 0x9B, 0x98, 0x69, 0xAA, 0x44, 0xB7, 0xDF, 0xD2, 0xF7, 0x9D,
+    0x24, 0x7D, 0x4B, 0x7A, 0x56, 0xA1, 0xD1, 0xA8, 0xC0, 0x87, 0xB9, 0xDE, 0x9A, 0x87, 0xF2, 0x24,
+    0x64, 0xDA, 0x33, 0x6D, 0x64, 0x69, 0x9D, 0x1E, 0x24, 0x49, 0xA1, 0xD6, 0x07, 0xB5, 0x7D, 0x48,
+    0xEF, 0x52, 0xEF, 0x85, 0x8F, 0xCD, 0x92, 0x6B, 0xCC, 0x35, 0x0E, 0x34, 0x91, 0x3A, 0x42, 0xAE,
+    0x4F, 0x7C, 0x50, 0x23, 0x99, 0xAD, 0x91, 0xB6, 0x84, 0x8D, 0x8D, 0xA4, 0xFB, 0x7F, 0x82, 0xD3,
+    0xCB, 0x1A, 0x21, 0xD7, 0x54, 0x47, 0xC0, 0xAF, 0x99, 0x26, 0x28, 0xD5, 0x3A, 0x01, 0xDD, 0x8A,
+    0x36, 0xB2, 0xF7, 0xE8, 0x3F, 0x0F, 0x92, 0x56, 0x2F, 0x49, 0xD2, 0x27, 0x0C, 0x7A, 0x09, 0xA5,
+    0x76, 0x06, 0xAD, 0x5C, 0xFF, 0x63, 0xF8, 0xBD, 0x9B, 0x47, 0xEB, 0x7C, 0xA9, 0x1A, 0x61, 0xF8,
+    0xF3, 0x05, 0x3A, 0xCD, 0xA4, 0x70, 0x73, 0x30, 0xE7, 0x64, 0x84, 0xDD, 0x47, 0xF8, 0x6D, 0x9B,
+    0x9F, 0x7E, 0x01, 0x4A, 0x41, 0xB3, 0x6B, 0x66, 0x90, 0x22, 0x92, 0xD4, 0x0E, 0xFB, 0xA0, 0xD9,
+    0xC7, 0x4C, 0xB1, 0x89, 0x34, 0x72, 0xA2, 0xD0, 0xB3, 0xEA, 0xD1, 0x4B, 0x9A, 0x69, 0xB6, 0x61,
+    0xA5, 0xD2, 0xAD, 0x9D, 0x5C, 0xDF, 0x51, 0xCF, 0xF0, 0x77, 0x0A, 0x34, 0xB1, 0x8B, 0x38, 0x39,
+    0xB5, 0x85, 0x3E, 0xA5, 0x50, 0x68, 0xEC, 0xF4, 0x67, 0x9A, 0x2A, 0xC9, 0xBE, 0x78, 0xA6, 0x94,
+    0x7A, 0xB8, 0xF6, 0x17, 0x40, 0x35, 0xFF, 0x16, 0x38, 0x15, 0x13, 0x95, 0x7E, 0xB4, 0x52, 0x48,
+    0x3B, 0x7C, 0xB5, 0x16, 0x54, 0x99, 0xDA, 0x57, 0x8E, 0xCE, 0xEC, 0x26, 0x30, 0x68, 0xB6, 0x69,
+    0x9A, 0x1B, 0xD8, 0x7D, 0x5F, 0x42, 0xA1, 0xD4, 0x3C, 0x04, 0x5B, 0xDC, 0x9C, 0xDE, 0xB7, 0xA7,
+    0xF3, 0x1C, 0xEE, 0x6B, 0xA6, 0xD9, 0xAF, 0x9E, 0xE7, 0xC8, 0xF0, 0x03, 0x05, 0x7C, 0xF4, 0x1B,
+    0x6E, 0x77, 0x1A, 0x9D, 0x32, 0xED, 0x1F, 0x52, 0xDF, 0xC8, 0x1C, 0x2F, 0xF5, 0xD4, 0xDA, 0x81,
+    0x37, 0xFD, 0x31, 0xC0, 0x01, 0x4E, 0x55, 0x7B, 0xB2, 0x4A, 0x55, 0x04, 0xDE, 0xDA, 0xA6, 0xB8,
+    0xFD, 0xE2, 0xE2, 0x2F, 0x1F, 0x02, 0xA7, 0xCE, 0x37, 0x3F, 0x42, 0xB5, 0x1D, 0x9F, 0xDA, 0x80,
+    0xA6, 0x3D, 0x2E, 0xA2, 0xD1, 0xFA, 0x4F, 0xA9, 0xA5, 0x97, 0xE7, 0x4A, 0x52, 0xCC, 0xF4, 0xFD,
+    0x4E, 0xAD, 0x5F, 0xD1, 0x5A, 0x89, 0x4A, 0xA3, 0xE6, 0x5C, 0x9B, 0xDB, 0x18, 0xF4, 0x4D, 0x4D,
+    0xCD, 0x8B, 0x7B, 0xB3, 0x55, 0x3F, 0xD0, 0xDF, 0xE8, 0x5B, 0xB1, 0xDE, 0x9B, 0x6D, 0xC8, 0xF4,
+    0x2D, 0x69, 0xAC, 0x63, 0xAD, 0x60, 0xF6, 0xC3, 0xAF, 0x95, 0xC6, 0x52, 0x74, 0x7A, 0xA7, 0xE6,
+    0x4A, 0xD2, 0x6A, 0x30, 0x7C, 0x5D, 0x6B, 0x87, 0xF6, 0xDA, 0x5F, 0x9C, 0x43, 0x40, 0x4B, 0x40,
+    0x1C, 0x61, 0x9D, 0xC5, 0x9C, 0x45, 0x5A, 0x66, 0x38, 0x82, 0x53, 0x0B, 0x73, 0xA0, 0x7C, 0xB4,
+    0x2F, 0xE2, 0xA5, 0x77, 0x9A, 0xA7, 0x36, 0xE8, 0x7B, 0xD2, 0x5C, 0x6B, 0xAE, 0x35, 0x32, 0xCC,
+    0xB9, 0x02, 0x3E, 0xE0, 0x23, 0xF5, 0x4A, 0xA5, 0xBE, 0x8A, 0x64, 0x0A, 0xC5, 0x6E, 0xAB, 0x23,
+    0x94, 0x6A, 0x35, 0x82, 0x82, 0x9F, 0xA0, 0x8E, 0xB6, 0xE2, 0xBC, 0x6F, 0x01, 0x86, 0xBF, 0x8D,
+    0x80, 0xD3, 0x6E, 0x5E, 0xD1, 0x39, 0x0F, 0x81, 0xD3, 0x98, 0x70, 0x95, 0x63, 0x98, 0x5A, 0xD2,
+    0x80, 0x72, 0x23, 0x8D, 0xD9, 0x34, 0xBB, 0xDF, 0x32, 0xA8, 0x85, 0x5A, 0xEA, 0x49, 0x63, 0x0C,
+    0xA9, 0x05, 0xEA, 0x7B, 0x69, 0xF4, 0xB4, 0x40, 0xA3, 0x16, 0x73, 0x38, 0xF0, 0x5A, 0x80, 0x8F,
+    0x6A, 0x02, 0x4A, 0x7B, 0xE7, 0x06, 0xD0, 0x2D, 0x40, 0x76, 0x3C, 0x7D, 0x03, 0xEA, 0xAD, 0x51,
+    0x4F, 0xF7, 0xB2, 0x34, 0x9A, 0xC3, 0x5B, 0x4A, 0x52, 0x5B, 0xAB, 0x1F, 0x44, 0xB7, 0x32, 0xC4,
+    0x4C, 0x13, 0x0A, 0xA5, 0xDA, 0x42, 0x53, 0xBD, 0xE1, 0xD4, 0x76, 0x0B, 0xCD, 0x96, 0x69, 0x62,
+    0x58, 0x4A, 0xB5, 0x85, 0xC6, 0x7A, 0xC3, 0x89, 0x6E, 0xC1, 0xC7, 0x4C, 0x53, 0xA6, 0xC9, 0xA6,
+    0x76, 0xAD, 0xF7, 0x6B, 0xA1, 0x93, 0xD4, 0x67, 0x92, 0x56, 0x4A, 0x69, 0x87, 0x7A, 0xFF, 0x70,
+    0xFB, 0xF0, 0x99, 0x9C, 0x4F, 0x70, 0xD8, 0x5B, 0x68, 0xA4, 0x1E, 0xA4, 0x1D, 0xF2, 0x8B, 0x8B,
+    0xCF, 0x83, 0x21, 0xEB, 0xE0, 0x36, 0xB7, 0x41, 0xA1, 0x4F, 0xA9, 0x07, 0x4D, 0x9A, 0xE0, 0x12,
+    0x63, 0x7F, 0xD4, 0xCD, 0x49, 0x53, 0xA7, 0x6F, 0x4B, 0xA1, 0xD1, 0x2A, 0xAD, 0xA5, 0xD6, 0x52,
+    0x81, 0x66, 0x65, 0x88, 0xB8, 0x88, 0x13, 0xE5, 0x4E, 0xAE, 0x39, 0x17, 0x74, 0x11, 0xF5, 0x38,
+    0xD1, 0x8D, 0x64, 0x9A, 0x7C, 0x00, 0x1F, 0xDD, 0x02, 0xA5, 0xAA, 0x08, 0xE8, 0xDB, 0x1B, 0xD0,
+    0xDC, 0x13, 0x50, 0x58, 0x2F, 0x0C, 0x96, 0x26, 0x4A, 0x2B, 0xBA, 0x05, 0x09, 0x2B, 0x80, 0xDB,
+    0x2E, 0x47, 0x9F, 0xCD, 0x77, 0x4B, 0x23, 0xE5, 0x1A, 0xE1, 0xF5, 0x77, 0xCC, 0xFE, 0x69, 0x86,
+    0x4C, 0x9A, 0x01, 0x6F, 0x2D, 0xB1, 0x3F, 0x68, 0x19, 0xAA, 0x14, 0x2B, 0xCB, 0x7A, 0xDB, 0xA5,
+    0x38, 0xE4, 0xE2, 0xE2, 0xE2, 0xC7, 0x85, 0xCC, 0x95, 0x35, 0x48, 0x99, 0xE2, 0x7B, 0xFB, 0x0A,
+    0x6A, 0x9B, 0xBF, 0x45, 0x5A, 0xFE, 0x3B, 0x1B, 0x76, 0x95, 0xD2, 0xD4, 0x30, 0x18, 0xB4, 0xF9,
+    0x5B, 0xF5, 0x40, 0x61, 0x8E, 0x34, 0xDD, 0x5D, 0x4B, 0x65, 0x2D, 0xB5, 0x80, 0x4C, 0xE6, 0xF8,
+    0x34, 0x73, 0xA5, 0x1E, 0x8A, 0xCD, 0x3C, 0xA5, 0x61, 0x2C, 0x0E, 0xC7, 0x7D, 0x4F, 0x61, 0x53,
+    0x48, 0x0E, 0x7C, 0x4B, 0xA1, 0x8B, 0x0B, 0xAD, 0x30, 0x18, 0xE6, 0xE0, 0x56, 0xF0, 0x1B, 0x99,
+    0x5A, 0x72, 0x05, 0xFC, 0x02, 0x8D, 0x6E, 0x7B, 0xAD, 0x34, 0xD2, 0xD7, 0x6D, 0xF8, 0x45, 0x03,
+    0x12, 0x34, 0x72, 0x3A, 0xDD, 0xC4, 0xFE, 0xF2, 0x52, 0x5A, 0xE1, 0xB1, 0x30, 0xF1, 0xCA, 0xED,
+    0x1F, 0x62, 0xA5, 0x3C, 0xD0, 0xCB, 0x9E, 0x7F, 0x0D, 0xB0, 0xE1, 0x5A, 0xC0, 0x59, 0x1A, 0x06,
+    0x0B, 0x7D, 0x28, 0x65, 0x0E, 0xAD, 0x4B, 0xD1, 0xFB, 0xF5, 0x9B, 0xBF, 0xD9, 0xDD, 0xF5, 0x06,
+    0x80, 0x8F, 0x51, 0xB4, 0xF8, 0xB1, 0x98, 0x71, 0xFB, 0x07, 0x17, 0xB2, 0xE4, 0x59, 0xAE, 0xC0,
+    0x30, 0xFF, 0x83, 0x3B, 0x64, 0xBF, 0x89, 0xD0, 0x09, 0x74, 0x16, 0x3C, 0x36, 0x69, 0x20, 0x25,
+    0xE7, 0xD7, 0x62, 0xAA, 0x64, 0x89, 0x92, 0x63, 0x04, 0xA5, 0x56, 0x2E, 0xE3, 0x2F, 0x78, 0x8C,
+    0x04, 0x4D, 0x95, 0xDA, 0xA0, 0x96, 0x66, 0x1A, 0x69, 0xA3, 0xDE, 0x3F, 0xA8, 0xB1, 0xDA, 0x51,
+    0xC8, 0xD4, 0x36, 0x91, 0x66, 0xAC, 0x74, 0xD8, 0xAF, 0x6B, 0x0A, 0xE4, 0x52, 0xA4, 0x92, 0x84,
+    0x93, 0x34, 0x3A, 0xF5, 0x43, 0x28, 0xD4, 0x9F, 0x67, 0xCF, 0x92, 0x6B, 0xAC, 0xF5, 0x1F, 0x74,
+    0xEF, 0xDD, 0x92, 0xB4, 0x0C, 0xFA, 0x3B, 0xC5, 0x4A, 0xC1, 0x47, 0x1E, 0x6F, 0x8B, 0x15, 0x28,
+    0x56, 0x20, 0xDF, 0xCE, 0xEB, 0xB2, 0x9F, 0x01, 0xA7, 0xE7, 0x20, 0xD3, 0x06, 0xD4, 0xFB, 0x65,
+    0x67, 0xFD, 0xEE, 0x65, 0xF8, 0x68, 0xE0, 0xB2, 0xCE, 0xB1, 0xA3, 0x85, 0x8E, 0xBA, 0xFD, 0xA8,
+    0xC0, 0x31, 0x1B, 0x74, 0x1B, 0x3A, 0xC9, 0x22, 0xE8, 0x60, 0x21, 0x96, 0xD3, 0xF4, 0x4F, 0x84,
+    0x56, 0xAA, 0x58, 0xAA, 0xA7, 0x9E, 0x7D, 0x84, 0xEE, 0x9D, 0x9A, 0x61, 0xAD, 0xD4, 0x9E, 0xA3,
+    0x3C, 0x05, 0xA0, 0xD4, 0xF9, 0xF7, 0x6C, 0xFA, 0x64, 0x0F, 0x3C, 0xDD, 0x02, 0x86, 0x63, 0x6A,
+    0x3B, 0x9F, 0x52, 0xA1, 0x1D, 0x1E, 0xAB, 0xA4, 0xEF, 0x7F, 0x70, 0x71, 0x92, 0x34, 0x39, 0x49,
+    0xA2, 0x92, 0xB4, 0x90, 0x5B, 0x12, 0xF8, 0xC6, 0x5F, 0x00, 0xE4, 0x6D, 0x62, 0x2E, 0xB8, 0x90,
+    0xBC, 0x14, 0x1F, 0x92, 0xEB, 0x22, 0xC0, 0x8D, 0xC0, 0xBF, 0x7F, 0xD8, 0xDA, 0x95, 0xB6, 0x94,
+    0x86, 0x5C, 0xD2, 0xD8, 0xED, 0x43, 0x74, 0x7B, 0xA6, 0xBB, 0x1A, 0x5D, 0xF4, 0x2B, 0xC3, 0xBB,
+    0xD5, 0x5E, 0x6F, 0xBB, 0x05, 0x2A, 0xB5, 0x96, 0xDD, 0xAA, 0xD4, 0xC3, 0x10, 0xD3, 0x59, 0x7B,
+    0x19, 0xAE, 0x7D, 0xAD, 0x96, 0x34, 0x0D, 0xD2, 0x96, 0xA7, 0x75, 0x7F, 0x26, 0xFB, 0xC8, 0x4D,
+    0x80, 0x0F, 0x43, 0xF2, 0xEA, 0x18, 0xF6, 0xF3, 0x3C, 0xE8, 0x9E, 0xD9, 0xA0, 0x8C, 0x65, 0x84,
+    0x6E, 0x2C, 0x03, 0xFC, 0x21, 0xD7, 0x7F, 0xDD, 0xDA, 0xFB, 0xDF, 0x01, 0xF5, 0x0A, 0x85, 0x66,
+    0x18, 0xD4, 0x52, 0xFF, 0x6D, 0xA4, 0x88, 0xF5, 0xCC, 0xC0, 0x80, 0x9B, 0x8A, 0xF9, 0x21, 0xFB,
+    0xD4, 0xA9, 0xA7, 0x93, 0x68, 0xA4, 0x58, 0xEA, 0x05, 0x8D, 0x9A, 0xEB, 0xD8, 0x44, 0xF4, 0xB4,
+    0xFA, 0x6A, 0xF1, 0x0B, 0x7F, 0x50, 0x5E, 0x36, 0x73, 0x0B, 0xC3, 0x0A, 0x95, 0x46, 0x3B, 0xF9,
+    0xC2, 0x2C, 0xEB, 0xC4, 0xFF, 0x2A, 0x69, 0xAB, 0x24, 0x4D, 0x8D, 0x14, 0xE9, 0xB4, 0xC3, 0x9B,
+    0xFE, 0x02, 0xE0, 0xFF, 0x3D, 0x12, 0x0F, 0xF6, 0x51, 0x3B, 0x31, 0xFB, 0x2A, 0x5E, 0x05, 0x32,
+    0xBB, 0xA5, 0xE7, 0xA0, 0x96, 0x76, 0x0A, 0x1D, 0x4B, 0x58, 0x28, 0xB4, 0x5C, 0xD3, 0xE8, 0x77,
+    0x72, 0x65, 0x9A, 0x29, 0x57, 0x27, 0xA8, 0xA7, 0x6E, 0x85, 0x77, 0xE4, 0xB6, 0x2A, 0xE8, 0x0C,
+    0x60, 0x64, 0x3F, 0xBE, 0xA9, 0xA7, 0xB3, 0x6F, 0x6A, 0x80, 0xC8, 0x60, 0x0D, 0xAE, 0x9E, 0x2C,
+    0x97, 0xEE, 0xBD, 0x7F, 0x33, 0xBB, 0x55, 0x48, 0xD2, 0x98, 0x1B, 0xDB, 0x63, 0xB0, 0xC8, 0xE7,
+    0xC3, 0x6D, 0x1A, 0x3E, 0xCD, 0x92, 0xF0, 0x11, 0x6B, 0x87, 0xDE, 0x12, 0x42, 0xF0, 0xCB, 0x1E,
+    0xCB, 0x3D, 0xBF, 0x03, 0x75, 0x9F, 0x6F, 0xD0, 0xF5, 0xCD, 0x0C, 0xFA, 0xE4, 0x0E, 0xE8, 0x45,
+    0x73, 0xBD, 0x2E, 0xC1, 0x1C, 0xFD, 0xDA, 0xD9, 0x0E, 0xA0, 0xEA, 0xCB, 0x39, 0x8F, 0xD9, 0x4E,
+    0x1D, 0xFC, 0xC8, 0xF0, 0x8D, 0x60, 0x19, 0x2B, 0xA7, 0x3E, 0x51, 0x93, 0xBE, 0xFA, 0x4B, 0x6E,
+    0xEF, 0x6B, 0xF0, 0x39, 0xE0, 0x29, 0xB3, 0x67, 0x3B, 0x6A, 0xA1, 0xD8, 0x9D, 0x85, 0xE0, 0x6A,
+    0x2F, 0xD7, 0x9F, 0x32, 0xB9, 0x37, 0xAF, 0x04, 0x6A, 0xDE, 0x7F, 0x47, 0x9F, 0x3F, 0x23, 0xE2,
+    0x83, 0x24, 0xCD, 0x99, 0x6C, 0xA1, 0xAC, 0x45, 0x67, 0x00, 0x75, 0xAD, 0x80, 0x02, 0x4E, 0x73,
+    0xA1, 0x11, 0xA7, 0xD1, 0x09, 0x6A, 0xB5, 0x09, 0x08, 0x57, 0x00, 0xAD, 0x06, 0x89, 0x06, 0x27,
+    0x28, 0x35, 0xFA, 0x08, 0xB5, 0xB9, 0x44, 0x5D, 0x2C, 0x34, 0x92, 0x69, 0x76, 0x82, 0x4A, 0x7D,
+    0x42, 0xC3, 0x15, 0xC0, 0x80, 0xD4, 0x4A, 0xBD, 0xB3, 0x80, 0x20, 0x81, 0xE1, 0x0A, 0xD9, 0xB0,
+    0x19, 0x0A, 0x3E, 0xE7, 0x96, 0x8E, 0x48, 0x58, 0xF8, 0x20, 0x3D, 0xE4, 0xB4, 0xBF, 0x31, 0x03,
+    0xAE, 0x2B, 0x34, 0x23, 0x48, 0xE3, 0x00, 0x85, 0x54, 0x44, 0xB8, 0xAE, 0xE8, 0x82, 0x71, 0xAA,
+    0x5A, 0xC8, 0x35, 0x9A, 0x4F, 0x5A, 0xCC, 0x40, 0x13, 0x1D, 0xF0, 0xE4, 0x10, 0xDE, 0x9C, 0x3C,
+    0x5E, 0x1A, 0x49, 0x06, 0xA3, 0x47, 0x68, 0x74, 0x61, 0x67, 0x97, 0x6B, 0xA4, 0x12, 0x95, 0xC0,
+    0x47, 0x9A, 0x08, 0x9A, 0x19, 0x02, 0xA5, 0xFA, 0x5C, 0x23, 0xCD, 0x46, 0x25, 0x18, 0x16, 0x9A,
+    0x48, 0x6E, 0x2F, 0x55, 0xF6, 0x52, 0x6D, 0x9F, 0x4A, 0x49, 0x03, 0xC5, 0xDC, 0x16, 0x71, 0x69,
+    0x32, 0x3F, 0x64, 0xA3, 0x94, 0xBE, 0xAB, 0x95, 0x52, 0x6B, 0xA3, 0x89, 0xEC, 0xDF, 0x70, 0xA3,
+    0x85, 0xDF, 0x8C, 0x0C, 0x85, 0x51, 0x24, 0xAE, 0x2B, 0x1C, 0x8E, 0x50, 0x21, 0x01, 0xD7, 0x87,
+    0x78, 0xD0, 0x41, 0xAE, 0x7F, 0x51, 0xCF, 0xB7, 0x34, 0xD2, 0x0E, 0x1F, 0x19, 0xF4, 0xF9, 0xF4,
+    0xF4, 0xB5, 0xFF, 0x4D, 0x23, 0xA5, 0xE5, 0x22, 0x64, 0xFC, 0x32, 0x05, 0xB4, 0x7F, 0x51, 0x63,
+    0xA9, 0xBE, 0x52, 0xEA, 0x05, 0xCD, 0x0C, 0xC1, 0xFA, 0xC0, 0xBA, 0x60, 0x58, 0x68, 0xA2, 0x75,
+    0x80, 0xB5, 0xBF, 0x35, 0xBF, 0x35, 0x88, 0x62, 0x6E, 0x33, 0x50, 0x93, 0x35, 0xBD, 0xB5, 0xBC,
+    0x35, 0x7C, 0x6A, 0xF7, 0x33, 0x75, 0xAF, 0x4D, 0xD8, 0x91, 0x45, 0x3F, 0x8F, 0x5F, 0x5C, 0xF4,
+    0xAF, 0x5C, 0x12, 0x6E, 0x9C, 0x4E, 0xA7, 0xD3, 0xBB, 0x24, 0x49, 0x9F, 0x91, 0x24, 0xD5, 0x32,
+    0xE8, 0xE5, 0xFE, 0xC5, 0x10, 0x0A, 0x8D, 0xF8, 0xD1, 0x09, 0x76, 0x7C, 0xA4, 0x58, 0x50, 0xE0,
+    0x7A, 0x6B, 0xE8, 0xD8, 0xB1, 0x2A, 0x64, 0xA7, 0x74, 0x81, 0x96, 0x7B, 0x76, 0xC6, 0x45, 0xDA,
+    0x2F, 0xBE, 0x90, 0x6C, 0xD9, 0x83, 0xEF, 0x86, 0x15, 0x05, 0xAA, 0xCB, 0xEF, 0xCE, 0xC5, 0x20,
+    0x29, 0x36, 0x92, 0xF4, 0xC3, 0xCB, 0x33, 0xD9, 0xE0, 0xC6, 0xE9, 0x26, 0x85, 0xB4, 0x51, 0xCB,
+    0xE0, 0x80, 0x91, 0x1B, 0x0F, 0xC6, 0x70, 0xD7, 0x5A, 0xA8, 0xB4, 0x9A, 0x4F, 0xD9, 0x48, 0x31,
+    0xD3, 0x5F, 0x69, 0x75, 0x11, 0x85, 0x61, 0xCA, 0xF4, 0xB4, 0x28, 0xF4, 0xBE, 0x88, 0xDB, 0x3A,
+    0x49, 0x7F, 0x77, 0xE6, 0x51, 0x36, 0xF1, 0x88, 0x0C, 0x34, 0xA5, 0x33, 0x74, 0x9A, 0x78, 0x73,
+    0xAD, 0x7D, 0x08, 0x3E, 0xE1, 0x8F, 0x9B, 0xC1, 0x26, 0xC9, 0xB3, 0x01, 0xF8, 0xE7, 0xE4, 0x50,
+    0xAC, 0xBC, 0x15, 0xDC, 0x5A, 0x1A, 0xEE, 0x3D, 0x82, 0xD7, 0x06, 0x34, 0x1A, 0x5F, 0x19, 0xA9,
+    0x65, 0xA7, 0xD3, 0xE9, 0xF4, 0xA4, 0x8D, 0xFD, 0x41, 0x92, 0x7E, 0x60, 0xF0, 0x66, 0xAD, 0x8B,
+    0x2F, 0x0A, 0x1F, 0x29, 0x22, 0x0A, 0xB8, 0xB9, 0xD0, 0x88, 0x6F, 0x9D, 0xE0, 0x0F, 0xAE, 0x2E,
+    0x04, 0x85, 0xC6, 0x1B, 0x37, 0x8F, 0x36, 0xBD, 0x1C, 0x4B, 0x85, 0x9E, 0xBF, 0xB8, 0x7D, 0x75,
+    0x5D, 0xBE, 0x6C, 0x6A, 0xD7, 0x3B, 0xC1, 0x70, 0xF9, 0xDD, 0x4D, 0xA8, 0x24, 0xE9, 0xAE, 0x24,
+    0xE9, 0xCA, 0x99, 0x4C, 0xBC, 0x01, 0xC8, 0x67, 0xFE, 0x7B, 0xEA, 0x39, 0x0F, 0x74, 0xF7, 0x86,
+    0x11, 0x59, 0xBA, 0x6A, 0x82, 0x5B, 0xCF, 0xBD, 0x22, 0x54, 0x1E, 0x6C, 0x1A, 0x8F, 0xB9, 0xA4,
+    0xB1, 0xDE, 0x3E, 0xA4, 0x5E, 0xA3, 0x53, 0xB5, 0x51, 0x47, 0x1F, 0xF0, 0x8B, 0x46, 0xF4, 0xAC,
+    0x24, 0xDD, 0x3A, 0xE8, 0x65, 0x3F, 0xD4, 0x98, 0x62, 0xE7, 0x7A, 0x3B, 0x4E, 0x55, 0x1B, 0xD9,
+    0x27, 0xA4, 0x17, 0x54, 0xC8, 0x72, 0xFF, 0x9A, 0x2C, 0xD4, 0x33, 0xB7, 0xE6, 0x89, 0xFE, 0x8C,
+    0x78, 0x58, 0x68, 0x65, 0x59, 0xC0, 0xC4, 0xB5, 0x7A, 0xC4, 0x08, 0xB6, 0x04, 0x70, 0x25, 0x49,
+    0x7B, 0xA3, 0x03, 0x71, 0x54, 0x28, 0xF5, 0xFC, 0x85, 0x59, 0x77, 0x6B, 0xE8, 0x15, 0x05, 0xDC,
+    0x54, 0x68, 0xE4, 0x77, 0x1E, 0x6A, 0xBA, 0x6B, 0x4F, 0x3E, 0x38, 0x78, 0xAD, 0xA1, 0xEF, 0x5F,
+    0x7C, 0xFE, 0x15, 0x83, 0x17, 0x14, 0x28, 0xE6, 0x42, 0x23, 0xCD, 0xE5, 0x77, 0x57, 0x31, 0x97,
+    0xA4, 0x30, 0x9C, 0x07, 0x98, 0x9D, 0xC9, 0x62, 0x1E, 0x4D, 0xB5, 0x9F, 0xAF, 0x3D, 0xA4, 0xD1,
+    0xF6, 0xA8, 0x34, 0xC3, 0x2F, 0xA9, 0x89, 0x7F, 0xA5, 0x67, 0x7C, 0x0A, 0xEB, 0xFC, 0x98, 0x28,
+    0x3E, 0x87, 0x2B, 0xEB, 0x97, 0xC3, 0x91, 0x34, 0x9A, 0x38, 0xB9, 0xA1, 0x1A, 0x6F, 0x48, 0x21,
+    0x68, 0xA3, 0xD9, 0xA0, 0x99, 0x41, 0x0A, 0xA5, 0x3E, 0xA0, 0xD9, 0x87, 0x42, 0x77, 0xD5, 0x96,
+    0x72, 0x11, 0xB7, 0xF9, 0x80, 0x7F, 0x49, 0x92, 0x11, 0xDD, 0x1A, 0x49, 0x71, 0x08, 0x29, 0x26,
+    0x2D, 0xD5, 0xA6, 0xB3, 0xF5, 0x6A, 0xF9, 0xFD, 0x4E, 0xF7, 0x35, 0x4A, 0x52, 0x02, 0x84, 0x24,
+    0xB8, 0x76, 0x27, 0x18, 0xCD, 0xD5, 0x62, 0xCF, 0x7A, 0x4E, 0xE1, 0x64, 0xA6, 0xFB, 0x09, 0x68,
+    0xC9, 0x8F, 0xA1, 0xF9, 0x3A, 0xB2, 0x9E, 0x6C, 0xC5, 0x8F, 0x94, 0x6B, 0xB1, 0x83, 0x5B, 0x9B,
+    0x19, 0xEA, 0x7D, 0xC7, 0xD2, 0xB8, 0x87, 0x5F, 0xE7, 0xC2, 0xAF, 0x8F, 0xA5, 0x00, 0xC8, 0xE7,
+    0x6C, 0xA5, 0x9E, 0xDC, 0x8C, 0x1F, 0x05, 0xC3, 0xD7, 0x43, 0xEA, 0x10, 0x23, 0x90, 0x8D, 0xAF,
+    0xF0, 0x19, 0x7F, 0x79, 0xB6, 0xF9, 0xF1, 0xF6, 0x32, 0xEC, 0xCC, 0xCD, 0x4B, 0x34, 0xD4, 0xAB,
+    0xFE, 0x81, 0xDA, 0x23, 0xF2, 0xCC, 0x44, 0x3D, 0x42, 0xD9, 0xF3, 0xFB, 0x0F, 0xCF, 0xBC, 0xEB,
+    0xD2, 0x6D, 0xB0, 0x6C, 0x8C, 0xB1, 0xD3, 0x0B, 0x25, 0xCF, 0xBD, 0x2D, 0x45, 0xA3, 0x16, 0x1F,
+    0x4A, 0x8D, 0xE4, 0x3B, 0x5A, 0xA0, 0x9E, 0x6A, 0x01, 0xD1, 0xC2, 0xA3, 0xD4, 0xAE, 0x29, 0xA7,
+    0x6B, 0x29, 0xE0, 0xF2, 0xFC, 0x20, 0xBF, 0xB8, 0xF8, 0x33, 0x8D, 0x74, 0xDA, 0xBB, 0x48, 0x25,
+    0x3D, 0xAB, 0x89, 0x27, 0x14, 0xFD, 0x6E, 0x68, 0x74, 0x00, 0xBF, 0x36, 0x1A, 0x29, 0xD4, 0x6B,
+    0x07, 0xBF, 0x56, 0xDA, 0xDB, 0x52, 0xBD, 0x37, 0x7F, 0xC9, 0x38, 0x2D, 0xB9, 0xA1, 0x3F, 0x59,
+    0xF2, 0x4D, 0xDE, 0xFF, 0x27, 0x57, 0x2C, 0xA5, 0xE5, 0x03, 0x0C, 0x52, 0x6E, 0xA1, 0xBC, 0x27,
+    0xC0, 0x7F, 0x6D, 0x87, 0x3C, 0xE6, 0x91, 0x87, 0x43, 0x53, 0xCB, 0xB5, 0xBC, 0x91, 0x4C, 0x1A,
+    0x36, 0x9A, 0x54, 0x6A, 0x21, 0x4D, 0xCD, 0x56, 0xE9, 0x09, 0x34, 0x55, 0x3B, 0x85, 0x70, 0x91,
+    0x3A, 0xE2, 0x03, 0x5D, 0xB0, 0x0C, 0x6E, 0x29, 0x0A, 0x4D, 0xDD, 0x4A, 0x29, 0x99, 0x63, 0x13,
+    0x8F, 0xBC, 0x82, 0x7E, 0xEF, 0xE6, 0x79, 0x9E, 0xCE, 0x40, 0xA6, 0xE7, 0x2F, 0x3E, 0x6F, 0x4D,
+    0x98, 0x9A, 0xB3, 0x56, 0x72, 0xF8, 0xB5, 0x34, 0x2B, 0x99, 0x26, 0x4D, 0x14, 0x7A, 0xB7, 0x7A,
+    0x9A, 0xE8, 0xD4, 0x96, 0x9A, 0xFC, 0xB9, 0x40, 0x62, 0xC6, 0x4B, 0x2B, 0xBC, 0x5E, 0xFF, 0xE5,
+    0xF2, 0x94, 0xF3, 0x9E, 0xDF, 0x05, 0x76, 0xAA, 0xFE, 0x58, 0x7B, 0x19, 0xA4, 0x16, 0x0A, 0x1B,
+    0x9F, 0x95, 0x81, 0x9F, 0x8F, 0x00, 0x4A, 0x7F, 0x2D, 0x3B, 0xF7, 0x31, 0x00, 0x56, 0x2A, 0x28,
+    0x57, 0xBE, 0x02, 0xF5, 0x7E, 0xCB, 0xB0, 0x56, 0xC0, 0x2B, 0x00, 0x4F, 0xDC, 0x7B, 0xE5, 0x02,
+    0x72, 0x0D, 0x3A, 0xBD, 0xA8, 0xB6, 0x92, 0xB4, 0x1B, 0xED, 0xA4, 0xD2, 0xBB, 0xF4, 0xFF, 0x8D,
+    0x7E, 0xC9, 0xD5, 0xA3, 0xB1, 0x10, 0xE5, 0x95, 0xCE, 0xF5, 0x4B, 0xA6, 0x11, 0x2D, 0xF5, 0x4E,
+    0x26, 0x29, 0x90, 0x49, 0x3A, 0xF2, 0x0B, 0xFE, 0x3F, 0xFD, 0x31, 0x14, 0x57, 0x8C, 0x70, 0x77,
+    0xFF, 0xE2, 0x0B, 0x06, 0x44, 0x8E, 0xF9, 0x95, 0x8C, 0xCF, 0x20, 0x69, 0xAB, 0x76, 0xE8, 0x16,
+    0xBF, 0x80, 0x26, 0xCD, 0x54, 0x2A, 0x34, 0x65, 0xB2, 0x40, 0xB4, 0x37, 0x66, 0x8E, 0x31, 0x16,
+    0xF2, 0xE1, 0xBE, 0xF9, 0xA8, 0xFF, 0xAE, 0xBD, 0x04, 0x30, 0x92, 0x35, 0xB7, 0xA5, 0x3E, 0x35,
+    0xFC, 0xAB, 0xD3, 0x7E, 0x6E, 0xE9, 0x9E, 0x75, 0xFF, 0x6E, 0x85, 0x23, 0x21, 0x71, 0x7E, 0x9C,
+    0x16, 0xBA, 0x90, 0x6B, 0xA1, 0xB0, 0x98, 0xA0, 0x99, 0x9D, 0x5A, 0xB2, 0x2D, 0x53, 0x00, 0x37,
+    0x36, 0xDB, 0x95, 0xAE, 0xF4, 0x0F, 0x75, 0x65, 0x7A, 0xF0, 0x96, 0x8B, 0x2F, 0x74, 0x91, 0x52,
+    0xFA, 0x5B, 0x8D, 0x0C, 0xDA, 0xBA, 0x8D, 0x6C, 0xD0, 0xD3, 0x9A, 0xC1, 0xAF, 0x16, 0xC4, 0x7E,
+    0x52, 0x11, 0xFC, 0xEA, 0x34, 0x53, 0xA8, 0x1F, 0xF4, 0x1C, 0x9D, 0x4D, 0x21, 0xBB, 0x50, 0x83,
+    0xB8, 0xB5, 0x43, 0x6D, 0x44, 0x9F, 0x6B, 0x1F, 0xBE, 0x34, 0x52, 0x79, 0x9A, 0xAE, 0x97, 0x3F,
+    0xAA, 0x19, 0x12, 0x8B, 0xF4, 0x51, 0x2E, 0xC1, 0xAF, 0x53, 0x8F, 0xFE, 0x3A, 0xF7, 0xCE, 0x91,
+    0xC4, 0x9D, 0xAE, 0x94, 0x1C, 0x99, 0xD3, 0x91, 0x32, 0xC0, 0x56, 0xF8, 0x56, 0x6C, 0x57, 0x00,
+    0xF2, 0xEA, 0xF6, 0x39, 0x81, 0x8A, 0xEF, 0x0F, 0x56, 0x6D, 0x82, 0xAB, 0xD4, 0x9E, 0x41, 0x8A,
+    0xC4, 0x9B, 0x9E, 0xCE, 0x8E, 0x6D, 0x61, 0xD9, 0x80, 0x2B, 0x94, 0xCC, 0x1B, 0x64, 0x2D, 0xB5,
+    0x5E, 0xB6, 0xF2, 0x30, 0x33, 0x10, 0x5B, 0xAE, 0x69, 0xF8, 0xC1, 0x7F, 0x74, 0x1B, 0xC3, 0x8C,
+    0x0F, 0x68, 0xCC, 0xAE, 0x74, 0xB7, 0xDB, 0xE8, 0x02, 0x7E, 0x2B, 0x0D, 0x66, 0x8C, 0x58, 0x7C,
+    0x64, 0x7E, 0x9E, 0x7B, 0xE9, 0x2F, 0x8E, 0xB3, 0xB4, 0xEE, 0xAE, 0xF7, 0x8B, 0x8B, 0xD6, 0xF0,
+    0x3E, 0xEB, 0x94, 0x4C, 0x09, 0x53, 0x94, 0xDE, 0xA5, 0x9E, 0x7A, 0x73, 0x1B, 0xF8, 0xC5, 0xAF,
+    0xE4, 0x1A, 0xB5, 0xD0, 0x19, 0x54, 0x37, 0x17, 0x3A, 0xE0, 0xC2, 0x1E, 0xEE, 0xEC, 0x16, 0x19,
+    0x5F, 0x4F, 0x01, 0x72, 0xF2, 0x0C, 0x0E, 0x8E, 0x69, 0xCA, 0x34, 0x95, 0x71, 0x98, 0x8C, 0x28,
+    0xDE, 0x59, 0x96, 0x83, 0xCE, 0xE8, 0xBA, 0xAF, 0x5C, 0x78, 0xC9, 0x4E, 0xA7, 0x27, 0x39, 0x9D,
+    0x4E, 0x8D, 0xB4, 0x54, 0xE6, 0xD1, 0x8E, 0x8D, 0xF4, 0x03, 0xE9, 0x1E, 0x9D, 0x76, 0x6A, 0x43,
+    0x60, 0xF0, 0xD1, 0x66, 0x8D, 0x02, 0x06, 0x16, 0x8C, 0x18, 0x8A, 0x63, 0x23, 0xE6, 0x11, 0x2F,
+    0x67, 0xC9, 0x33, 0x3D, 0xFC, 0xA1, 0xE4, 0x11, 0x1D, 0x3E, 0xD1, 0xC5, 0x8F, 0xFF, 0xF4, 0x8F,
+    0xF9, 0xF2, 0x4A, 0xCF, 0x91, 0xEB, 0x5E, 0x22, 0x2D, 0x2B, 0x9D, 0xF9, 0x96, 0xCE, 0x3C, 0xA4,
+    0xF1, 0x60, 0xF9, 0x5B, 0xBA, 0x8D, 0x23, 0xC7, 0x48, 0xB1, 0x69, 0x04, 0xF4, 0x2E, 0x59, 0x6A,
+    0x2D, 0x40, 0xBE, 0xF0, 0x56, 0x1E, 0xAA, 0x34, 0x34, 0x07, 0x26, 0xB7, 0x2C, 0xB1, 0xA5, 0xBF,
+    0xB2, 0x3B, 0x36, 0xE0, 0xBA, 0x04, 0x80, 0x3D, 0xF0, 0xC0, 0x88, 0x67, 0x4B, 0x76, 0x13, 0x4A,
+    0xBD, 0x47, 0x0B, 0x74, 0x7F, 0x27, 0x4D, 0x94, 0x76, 0xCD, 0x9D, 0xA4, 0x85, 0x52, 0x4B, 0xAD,
+    0x9E, 0x2E, 0xD2, 0x45, 0x4A, 0xF5, 0x85, 0x46, 0xBA, 0xD5, 0xE0, 0x90, 0x9F, 0xF7, 0x41, 0x29,
+    0xBD, 0x53, 0x9A, 0xA4, 0xD5, 0x6B, 0x77, 0xD2, 0xBB, 0xA5, 0xE9, 0xDA, 0xE9, 0x74, 0x33, 0x33,
+    0x3F, 0x76, 0xA9, 0xCC, 0xC5, 0x0F, 0x95, 0x14, 0x2B, 0x5B, 0xE7, 0x66, 0x83, 0x6A, 0x0C, 0x82,
+    0xC2, 0x89, 0x1B, 0xC3, 0x76, 0x3A, 0xDD, 0xD2, 0x29, 0x51, 0x77, 0x74, 0xDC, 0x9F, 0x1B, 0xFD,
+    0xEA, 0x7D, 0x2D, 0xCE, 0x5D, 0xF9, 0xAA, 0xF7, 0x8F, 0xF8, 0xDC, 0x4F, 0x73, 0x3F, 0xEC, 0x2D,
+    0x8D, 0x6E, 0x57, 0x06, 0x70, 0xC6, 0xA3, 0x57, 0x8F, 0xF3, 0xB7, 0x5E, 0xB5, 0xAE, 0xA9, 0x0E,
+    0x3E, 0x46, 0x0F, 0x3C, 0x61, 0x63, 0xBE, 0x5B, 0x81, 0xEB, 0x83, 0x2E, 0x0C, 0x77, 0x9B, 0xE0,
+    0xA3, 0xBA, 0xFF, 0xB9, 0x83, 0x36, 0x41, 0xBD, 0x19, 0x82, 0xFA, 0x1E, 0x2D, 0x64, 0xFA, 0xAE,
+    0xD4, 0xD2, 0x49, 0xC6, 0xE9, 0xD4, 0x96, 0x7A, 0x27, 0x53, 0xC8, 0x14, 0x52, 0x13, 0xD7, 0x3B,
+    0x4E, 0xA9, 0xA1, 0x33, 0xCD, 0xFC, 0xB4, 0x2F, 0x74, 0x5A, 0x6A, 0x6D, 0xD6, 0x21, 0x9F, 0xB5,
+    0x3E, 0xB9, 0xFE, 0xDC, 0xF5, 0x5C, 0xD3, 0x57, 0xBC, 0xEE, 0x3C, 0x23, 0xC5, 0xCE, 0xE9, 0xEE,
+    0xE4, 0xE7, 0x07, 0xA7, 0xE0, 0x20, 0x7D, 0x47, 0xDA, 0x3A, 0xED, 0x6D, 0xAD, 0xF3, 0xE0, 0xFF,
+    0x39, 0xEF, 0x32, 0xDD, 0xCB, 0x6D, 0x42, 0xBC, 0x20, 0x6D, 0xE5, 0x73, 0xD7, 0x73, 0x4D, 0x31,
+    0xFD, 0xFA, 0x1F, 0x39, 0x7D, 0x72, 0x6A, 0xE6, 0x87, 0x3D, 0xB4, 0x50, 0x48, 0x78, 0x85, 0x6C,
+    0xF8, 0x59, 0x7F, 0x6F, 0xD0, 0xE2, 0xA5, 0xA7, 0x8D, 0x42, 0x59, 0x48, 0xD1, 0x4B, 0xCF, 0x48,
+    0xF1, 0x2D, 0x0F, 0xA0, 0x5D, 0x37, 0x4E, 0xA7, 0xF7, 0xDA, 0x29, 0x3D, 0x2B, 0x3D, 0x97, 0xFD,
+    0xFD, 0xAE, 0x0F, 0x05, 0x6A, 0xDD, 0x6E, 0xA4, 0xEF, 0x48, 0xFB, 0x20, 0x4D, 0x97, 0xF5, 0x7E,
+    0xCF, 0x4A, 0xF1, 0xDA, 0xE9, 0xF4, 0x8B, 0xB8, 0xB8, 0x6C, 0xE2, 0xCD, 0x9E, 0xE2, 0x99, 0x2D,
+    0x8F, 0x5E, 0xFA, 0x9A, 0x14, 0x4A, 0xAD, 0x5C, 0xFB, 0xE3, 0x5F, 0xD2, 0x35, 0x3E, 0x66, 0x58,
+    0x51, 0xD7, 0x57, 0xCF, 0xE8, 0x3F, 0x44, 0x2F, 0xB5, 0xD2, 0x94, 0x0D, 0xB7, 0x5F, 0xF3, 0x4B,
+    0xFD, 0x05, 0x5F, 0x47, 0xB5, 0x50, 0x44, 0x50, 0x4B, 0xBD, 0x90, 0x69, 0xA4, 0xD6, 0x82, 0xD4,
+    0xE6, 0x9A, 0xA1, 0x85, 0x6B, 0x50, 0xED, 0x64, 0x0A, 0x34, 0x6A, 0x33, 0xE3, 0xB3, 0x1E, 0xF5,
+    0x93, 0xAF, 0x6D, 0x8F, 0xEE, 0xD0, 0xF5, 0x56, 0xD1, 0x04, 0x4D, 0x20, 0xD3, 0x7D, 0x9C, 0x66,
+    0x1A, 0x73, 0x7C, 0x1F, 0xEF, 0x71, 0xFB, 0xD5, 0xCF, 0x3E, 0x80, 0x19, 0xFD, 0x82, 0x67, 0x2D,
+    0x90, 0x0D, 0xB1, 0x90, 0x90, 0xC6, 0x27, 0x0C, 0x38, 0x77, 0xA2, 0xD0, 0xC8, 0x4F, 0x7A, 0x30,
+    0x68, 0x31, 0x43, 0xDE, 0xDF, 0x38, 0x9D, 0x5A, 0x2B, 0xD8, 0xDD, 0x9C, 0x7D, 0xF5, 0x24, 0xE9,
+    0x19, 0xE9, 0xB9, 0x2A, 0xF5, 0x6C, 0xAE, 0x19, 0x27, 0xCB, 0xD8, 0x2B, 0x90, 0xFD, 0x03, 0x3E,
+    0xAC, 0x75, 0x9B, 0x7A, 0xA7, 0x91, 0xA6, 0x5C, 0x53, 0x25, 0xED, 0x34, 0x1B, 0x83, 0x34, 0x25,
+    0x97, 0xF4, 0x60, 0x70, 0x57, 0xB6, 0xFC, 0xE6, 0xA9, 0x44, 0x64, 0xD8, 0x93, 0xEF, 0x33, 0x5E,
+    0xA1, 0x83, 0x93, 0xA8, 0x12, 0xF9, 0x9A, 0x96, 0xF5, 0xAC, 0x65, 0x98, 0x69, 0xD6, 0x4C, 0x81,
+    0x2E, 0xE6, 0x5A, 0x18, 0x36, 0xFB, 0x1B, 0xCD, 0xF8, 0x95, 0xB7, 0xB4, 0xBC, 0xFE, 0x36, 0x8F,
+    0x08, 0x5E, 0x43, 0x36, 0x44, 0xAF, 0xE0, 0x94, 0x8E, 0x4F, 0x28, 0x5C, 0x57, 0x4C, 0x6D, 0xFD,
+    0x1A, 0x1D, 0x2B, 0xA9, 0xF5, 0xD1, 0x4B, 0xA3, 0x8F, 0x5E, 0x96, 0xD5, 0x4A, 0xFC, 0xEF, 0xB4,
+    0x80, 0x0D, 0xE1, 0xCC, 0x37, 0x34, 0xA7, 0xBC, 0xBB, 0x84, 0xE2, 0xD2, 0xC5, 0x76, 0x3D, 0xF0,
+    0xBF, 0x03, 0xDD, 0x0C, 0x9D, 0x2C, 0x4C, 0xF5, 0xDF, 0xDE, 0xF1, 0x93, 0x9F, 0xFC, 0x54, 0xAC,
+    0xF9, 0x94, 0xB8, 0x96, 0xC9, 0x5A, 0xDD, 0x74, 0xD2, 0x56, 0x58, 0xBC, 0xB1, 0xB7, 0x0C, 0x96,
+    0xC4, 0xA1, 0x54, 0x6F, 0xBF, 0xD4, 0xAD, 0xAF, 0xCD, 0x13, 0xCD, 0x66, 0x1E, 0xBD, 0x25, 0xF5,
+    0x66, 0x6C, 0xE0, 0xAD, 0x94, 0x8A, 0x54, 0x8A, 0x76, 0xFE, 0x89, 0x4A, 0xF5, 0x7F, 0x98, 0x73,
+    0x5E, 0x6A, 0xC4, 0x29, 0xD0, 0x7C, 0x7D, 0xA5, 0x7B, 0x77, 0x64, 0x67, 0xCF, 0x22, 0x1F, 0x7F,
+    0xA0, 0x6B, 0x3E, 0xAA, 0x36, 0x33, 0xBE, 0x6D, 0xCB, 0xA0, 0x96, 0xF2, 0xEF, 0xF1, 0xAF, 0x52,
+    0x4B, 0x25, 0xF3, 0x44, 0xDC, 0x6E, 0x43, 0x4D, 0x2B, 0x95, 0x02, 0x5E, 0x13, 0x8D, 0xA0, 0x7A,
+    0x0E, 0x6E, 0x9C, 0x4E, 0xED, 0x8D, 0xD3, 0x93, 0xC3, 0x51, 0xC6, 0xA0, 0x51, 0x5A, 0x3B, 0x6D,
+    0xD4, 0xBA, 0x9D, 0x29, 0xD0, 0x6C, 0x66, 0x64, 0xCE, 0xF9, 0x3E, 0x8C, 0x1E, 0x8F, 0x42, 0x63,
+    0xF0, 0xF3, 0x10, 0x00, 0xC3, 0x8C, 0xD1, 0xCB, 0xD6, 0x7B, 0x46, 0x05, 0x52, 0xEA, 0xCB, 0xC4,
+    0x11, 0xFD, 0x91, 0x26, 0x7B, 0xE7, 0x02, 0x28, 0x18, 0xC6, 0x17, 0xCE, 0xC5, 0x2E, 0xE9, 0xAB,
+    0x53, 0xDA, 0xD3, 0x2A, 0x98, 0xA4, 0x36, 0xD7, 0x4B, 0x78, 0xCD, 0x8D, 0x34, 0x3A, 0x3B, 0xC1,
+    0xC2, 0x3C, 0x63, 0xA3, 0x28, 0xC0, 0xE3, 0x57, 0xC6, 0xF8, 0xD0, 0x5F, 0x0D, 0x22, 0x12, 0xC5,
+    0x2B, 0x79, 0x26, 0xA9, 0x70, 0xD3, 0x0A, 0x3E, 0x52, 0x04, 0x96, 0x2F, 0xE7, 0x70, 0xAB, 0x92,
+    0x89, 0x0C, 0x5C, 0x1E, 0x8D, 0xB0, 0x9A, 0xFD, 0xA4, 0x63, 0xA7, 0x90, 0x69, 0x1A, 0xB4, 0x64,
+    0x9A, 0xBC, 0x42, 0xA6, 0xC9, 0x89, 0x4C, 0x93, 0xA1, 0x52, 0xC3, 0x4C, 0xA6, 0x6F, 0xAA, 0x27,
+    0xD3, 0xB3, 0xC6, 0x70, 0x8B, 0xA4, 0x00, 0x3A, 0xD3, 0x77, 0xD4, 0x93, 0xE9, 0xDB, 0x9A, 0xC8,
+    0xF4, 0x4D, 0x05, 0x32, 0x4D, 0x43, 0x24, 0xD3, 0xE4, 0x77, 0x32, 0x4D, 0xB5, 0xFA, 0x4C, 0x53,
+    0xA5, 0xE9, 0x09, 0x6D, 0x85, 0x56, 0x2F, 0xA1, 0xDD, 0x6B, 0x4F, 0x66, 0xE3, 0xDA, 0xF9, 0xC2,
+    0xCD, 0x26, 0x98, 0xDC, 0xC7, 0x55, 0x8E, 0xB1, 0xC1, 0xDD, 0x16, 0x31, 0xBA, 0xC5, 0x72, 0xF4,
+    0x97, 0x94, 0x82, 0x58, 0x69, 0x2F, 0xA4, 0x42, 0x1A, 0xA5, 0x71, 0xD0, 0xF4, 0x84, 0x42, 0xA9,
+    0x16, 0x1F, 0x0B, 0xB5, 0x38, 0x15, 0x6A, 0x29, 0x74, 0x57, 0x2D, 0xE8, 0x87, 0x6A, 0xC1, 0xEF,
+    0xEA, 0x0F, 0xDE, 0x67, 0xA1, 0xEF, 0xCA, 0x7A, 0x73, 0xC2, 0x38, 0xDE, 0x38, 0x95, 0x1A, 0x29,
+    0xAC, 0xCE, 0x42, 0xC1, 0x69, 0x4C, 0xB5, 0x3A, 0x83, 0xE6, 0x46, 0x63, 0xA7, 0xAD, 0x50, 0x6C,
+    0x24, 0x1A, 0xB3, 0x6F, 0x7F, 0x70, 0x06, 0xA5, 0x2C, 0xA4, 0xBD, 0x64, 0x9C, 0x74, 0x56, 0x1B,
+    0xB3, 0x00, 0xCD, 0xBD, 0x4B, 0x42, 0xF5, 0x43, 0x31, 0x1E, 0x8D, 0xB4, 0xA4, 0x04, 0x75, 0x66,
+    0x91, 0x77, 0xFD, 0x28, 0x50, 0x9A, 0x47, 0x63, 0xD5, 0x3F, 0xED, 0xD3, 0x96, 0x9A, 0xA9, 0xAF,
+    0xA4, 0x7D, 0x7E, 0x12, 0xB2, 0xFD, 0x4F, 0xC1, 0xB7, 0x0C, 0x21, 0x57, 0x2C, 0xB5, 0x15, 0x5A,
+    0xB9, 0x82, 0x66, 0xDC, 0xE4, 0xCE, 0x9E, 0x49, 0xFD, 0xA0, 0xF9, 0x71, 0xAD, 0xD4, 0x3B, 0xA5,
+    0xFA, 0x4C, 0x33, 0xDD, 0xDF, 0xE7, 0x41, 0x2D, 0xD5, 0xD2, 0xDF, 0x4A, 0xCB, 0x2B, 0xEA, 0x7C,
+    0x6A, 0xE9, 0xF6, 0xC1, 0xF6, 0x78, 0x0D, 0x9A, 0xE3, 0xEA, 0xD3, 0xEF, 0xC0, 0x47, 0x32, 0x4B,
+    0x22, 0xFC, 0x74, 0xB9, 0x98, 0x2B, 0xF0, 0xEB, 0x7E, 0xC9, 0x07, 0x6C, 0x2E, 0x81, 0x5E, 0x03,
+    0x39, 0x52, 0x89, 0xF6, 0x08, 0x64, 0xAB, 0x4D, 0xD1, 0x7C, 0x58, 0x4B, 0xED, 0xB9, 0xD4, 0x7F,
+    0xF4, 0xEF, 0xDB, 0x58, 0x97, 0x0F, 0x3A, 0xC5, 0x4E, 0xFA, 0xF3, 0x23, 0x1F, 0x01, 0x5D, 0x8B,
+    0x5F, 0x28, 0x4D, 0x54, 0xC2, 0x4F, 0xD4, 0x81, 0x3A, 0x50, 0x4E, 0x1C, 0x15, 0x0A, 0x69, 0xAE,
+    0xB9, 0x70, 0xED, 0x74, 0xBA, 0xE9, 0xC7, 0x41, 0x9A, 0xF6, 0x5C, 0x52, 0xB1, 0x94, 0xD2, 0x73,
+    0x6E, 0xA4, 0x8B, 0xBC, 0x03, 0x14, 0xB2, 0x40, 0xA1, 0x31, 0x6F, 0x5F, 0x8B, 0xD6, 0xB6, 0xB4,
+    0x4A, 0x77, 0x25, 0x65, 0x13, 0x0A, 0x8D, 0x0C, 0x63, 0x23, 0x49, 0x95, 0x8E, 0xC4, 0x9D, 0xFE,
+    0x26, 0x51, 0x21, 0xB2, 0xF6, 0x8D, 0xF9, 0xB0, 0xBA, 0x67, 0xB5, 0x97, 0xF7, 0xA5, 0x4F, 0xEC,
+    0x1F, 0xD5, 0xDC, 0xD1, 0xAD, 0xCD, 0x58, 0xEF, 0xD5, 0x54, 0xEA, 0x93, 0x21, 0xD3, 0xFC, 0x65,
+    0xBA, 0xF5, 0x75, 0xAF, 0xD9, 0xF2, 0xD8, 0x19, 0x13, 0xB4, 0xAF, 0xA5, 0x89, 0x9F, 0x73, 0x0C,
+    0xE6, 0xC2, 0x29, 0xB1, 0x2E, 0x86, 0x88, 0x42, 0xA6, 0x50, 0x68, 0x2C, 0xD4, 0x3A, 0x71, 0xFD,
+    0xB9, 0xD7, 0x68, 0x0C, 0x66, 0x2D, 0xBC, 0x5E, 0x73, 0xC2, 0x96, 0x06, 0xCD, 0xF0, 0x51, 0xE3,
+    0xBE, 0xFF, 0xD4, 0x87, 0x7C, 0xCD, 0x34, 0xBB, 0x3D, 0xD3, 0x5C, 0xEB, 0x38, 0xB8, 0x2D, 0xD3,
+    0x9C, 0x3F, 0xF7, 0xD3, 0x7E, 0x4B, 0x9D, 0x80, 0x94, 0xDE, 0x58, 0x15, 0x66, 0xD0, 0xAC, 0xC9,
+    0x12, 0xE5, 0xC6, 0xDA, 0x2C, 0x99, 0xB4, 0xE4, 0x30, 0xA6, 0xCA, 0xC0, 0x78, 0x59, 0x04, 0x58,
+    0xE8, 0x6B, 0xAB, 0x2D, 0xAE, 0x56, 0x2F, 0xD2, 0x82, 0xD3, 0xCA, 0x51, 0x85, 0x64, 0xD9, 0xC1,
+    0x21, 0x91, 0x53, 0x05, 0x94, 0x9F, 0x3A, 0x7F, 0x55, 0x31, 0xA7, 0xB6, 0x33, 0xD3, 0x66, 0x8D,
+    0x67, 0xB6, 0xCD, 0x5A, 0x2F, 0x97, 0x24, 0xD9, 0xB1, 0x3F, 0xAC, 0xDB, 0x4D, 0x5E, 0xAF, 0x39,
+    0x93, 0xFA, 0x4A, 0x3B, 0x8F, 0x6B, 0x25, 0xD3, 0x4C, 0xA9, 0xDE, 0x86, 0xC1, 0xF1, 0xF0, 0xFF,
+    0xA2, 0xDE, 0x57, 0x3A, 0x85, 0x4C, 0x3B, 0xA5, 0x26, 0xEA, 0x9D, 0x4C, 0x2B, 0x8D, 0xE6, 0x42,
+    0xEA, 0xCB, 0xEF, 0xEE, 0x3C, 0xD6, 0xBD, 0xCA, 0x67, 0xFB, 0x4C, 0x0A, 0x56, 0x68, 0x67, 0x50,
+    0xD4, 0x63, 0x69, 0x76, 0xA6, 0x68, 0xA5, 0xB6, 0x85, 0xBF, 0x38, 0x63, 0x84, 0xAD, 0xC1, 0x56,
+    0xC6, 0x55, 0x6F, 0xEE, 0xC1, 0xA3, 0xD6, 0x8C, 0x94, 0xD8, 0x87, 0x1B, 0xA7, 0x93, 0xD3, 0x0E,
+    0xD2, 0xE6, 0xB5, 0x51, 0x48, 0x4B, 0x67, 0xF4, 0xE1, 0xD6, 0xC9, 0x44, 0x69, 0x1A, 0x2D, 0xE4,
+    0x32, 0xAE, 0x75, 0x15, 0xC9, 0x65, 0x8D, 0x52, 0x49, 0xB3, 0xBD, 0xAC, 0x29, 0x17, 0x0C, 0xDF,
+    0xD5, 0x58, 0x45, 0x72, 0x35, 0xEA, 0x9B, 0x40, 0x15, 0xBD, 0xDA, 0x61, 0xA4, 0x09, 0x5E, 0xB9,
+    0x60, 0x18, 0xBB, 0xBD, 0x8A, 0xE4, 0x62, 0xD8, 0x9A, 0x40, 0x15, 0x51, 0x1C, 0x46, 0x9A, 0x90,
+    0x69, 0x17, 0x0C, 0x63, 0x2E, 0x45, 0x72, 0x51, 0xC8, 0x7E, 0xA7, 0x94, 0xC6, 0xF4, 0x3B, 0xA6,
+    0x8D, 0xA3, 0x48, 0xA9, 0xDB, 0x38, 0x85, 0x4C, 0x5A, 0x68, 0x34, 0x3A, 0xCB, 0x66, 0x59, 0x57,
+    0xA7, 0xF0, 0x81, 0x7F, 0x73, 0x09, 0xF5, 0x1D, 0x8D, 0x64, 0x80, 0x88, 0x21, 0xB5, 0x96, 0x49,
+    0xA5, 0x5E, 0xAE, 0xC0, 0xCD, 0x49, 0x83, 0x65, 0x7A, 0x45, 0x0B, 0xBD, 0x91, 0x1B, 0x70, 0x5D,
+    0xE3, 0xB0, 0x53, 0x18, 0xC1, 0xDB, 0xEB, 0xD0, 0x18, 0x93, 0x40, 0x7B, 0x69, 0xD1, 0x9D, 0x53,
+    0x8B, 0x02, 0xC3, 0x82, 0x13, 0xD5, 0xDF, 0xEB, 0xC1, 0xA0, 0xB9, 0xD1, 0xDA, 0x48, 0xA5, 0x74,
+    0x57, 0x0A, 0x83, 0xE2, 0xB5, 0xD3, 0x4D, 0xB2, 0xD3, 0xE9, 0x66, 0x2A, 0xB5, 0xF8, 0xB6, 0x34,
+    0xE1, 0xA5, 0xF7, 0x48, 0x23, 0x83, 0x16, 0x64, 0x0A, 0x42, 0xB9, 0xD4, 0x5E, 0x6D, 0xB1, 0x46,
+    0x4A, 0x1D, 0xB7, 0xA7, 0x97, 0x37, 0x9A, 0x40, 0xB5, 0x29, 0x32, 0x8C, 0x34, 0x3F, 0xD4, 0x9A,
+    0x0B, 0x86, 0xA7, 0xB5, 0x54, 0x91, 0x5C, 0x85, 0x42, 0x13, 0xA8, 0x62, 0xA9, 0x79, 0x18, 0x69,
+    0x42, 0xA5, 0x6F, 0x09, 0x86, 0xD1, 0xE9, 0xEB, 0x91, 0x5C, 0xD4, 0x7A, 0x31, 0x50, 0x45, 0x63,
+    0xE5, 0x34, 0xC1, 0xE6, 0xD0, 0x30, 0xD2, 0x59, 0xC7, 0x1D, 0x03, 0x04, 0x69, 0xA4, 0xBB, 0x07,
+    0x96, 0x98, 0x6C, 0x73, 0x45, 0x0C, 0xE4, 0x0E, 0x85, 0xB4, 0x1C, 0xD3, 0xF7, 0xA1, 0x5C, 0x62,
+    0xD7, 0xA7, 0x71, 0xDC, 0x3F, 0x50, 0x73, 0x71, 0x64, 0xA9, 0x92, 0xC3, 0x7A, 0x28, 0x63, 0xD4,
+    0x29, 0xB9, 0xFF, 0x47, 0xA9, 0xC6, 0x2A, 0xBB, 0x09, 0xB7, 0x62, 0xA5, 0x19, 0xAF, 0xAF, 0xA7,
+    0x1A, 0x04, 0x59, 0xFA, 0xD5, 0xC8, 0x88, 0x9D, 0x05, 0xE2, 0x7A, 0x0D, 0x3A, 0xC8, 0x1E, 0x54,
+    0xDA, 0x73, 0xE9, 0x93, 0x52, 0xE8, 0x14, 0x1B, 0xA9, 0x7A, 0xA0, 0x0A, 0xCF, 0x86, 0xDD, 0x78,
+    0x35, 0xD9, 0x11, 0xAC, 0x8C, 0xE1, 0xCA, 0xE9, 0xA7, 0xD1, 0x97, 0x84, 0x24, 0xFA, 0x34, 0xE2,
+    0xF2, 0x24, 0x1E, 0xD4, 0xF5, 0x80, 0x0B, 0x86, 0x4A, 0xD4, 0x4B, 0x67, 0xF1, 0xEF, 0xCB, 0x47,
+    0x19, 0xC4, 0x74, 0x55, 0xB2, 0x82, 0x47, 0x56, 0x5A, 0xFD, 0x26, 0xCF, 0x6F, 0xBB, 0x7A, 0xDC,
+    0x04, 0xC5, 0x6A, 0x62, 0x5C, 0xD3, 0xD0, 0x42, 0xA6, 0x0F, 0x59, 0x10, 0x6D, 0xD2, 0x40, 0x49,
+    0xDB, 0x6E, 0xBA, 0x74, 0x56, 0x7E, 0x15, 0xE7, 0xF7, 0x21, 0x06, 0x73, 0x20, 0x50, 0xC7, 0x24,
+    0x48, 0x6A, 0x58, 0x47, 0xF1, 0xE1, 0x39, 0xEB, 0x71, 0x49, 0xD4, 0xF2, 0x23, 0xD7, 0xB8, 0x06,
+    0x75, 0xB0, 0xAB, 0xA8, 0x16, 0xA7, 0x1F, 0x4A, 0x73, 0xB1, 0x96, 0x92, 0xB4, 0xE5, 0xA9, 0x4A,
+    0x78, 0x7C, 0xE3, 0x71, 0x31, 0x67, 0xD2, 0xA6, 0x5D, 0xD6, 0xE1, 0x6C, 0x8C, 0x9C, 0x43, 0xDB,
+    0x83, 0xBE, 0x6A, 0xA7, 0xFD, 0x33, 0xBF, 0x61, 0x31, 0xEC, 0x7E, 0x30, 0xB9, 0x83, 0x30, 0x28,
+    0x82, 0xB4, 0x36, 0xDA, 0x7F, 0xB2, 0x19, 0xEB, 0x1F, 0x6D, 0xC6, 0xF6, 0x34, 0x3E, 0xB7, 0xF4,
+    0x72, 0x4C, 0x66, 0x6C, 0x65, 0x18, 0x69, 0x7E, 0xA0, 0x25, 0x99, 0xB1, 0x90, 0xCC, 0xD8, 0x9C,
+    0xCC, 0xD8, 0x98, 0xCC, 0xD8, 0xDD, 0x64, 0xC6, 0x3E, 0x93, 0xCC, 0x58, 0x93, 0xCC, 0xD8, 0xF0,
+    0x80, 0x19, 0xF3, 0x3F, 0xDE, 0x8C, 0x65, 0xC9, 0x8C, 0xE5, 0x0F, 0x99, 0xB1, 0xD2, 0x96, 0x95,
+    0xDB, 0x8D, 0x95, 0x89, 0x8E, 0xC9, 0xA3, 0x78, 0x31, 0xA5, 0x5B, 0x15, 0xAE, 0x56, 0x87, 0x1D,
+    0xA9, 0xBC, 0xEC, 0xF3, 0x67, 0xBB, 0xF5, 0x84, 0x72, 0xAD, 0x36, 0xFA, 0x9C, 0x31, 0x38, 0x64,
+    0x65, 0x03, 0x6B, 0xAD, 0xD1, 0x86, 0x9E, 0x8F, 0x34, 0x9B, 0x35, 0x6E, 0xA1, 0x31, 0xD7, 0x64,
+    0x03, 0xEA, 0xA7, 0x7D, 0x7A, 0xD0, 0x5C, 0xE9, 0xBD, 0xD2, 0xD8, 0x6C, 0x8D, 0x64, 0x5D, 0x98,
+    0x5F, 0x71, 0x3C, 0xBB, 0xE5, 0xEC, 0x54, 0xF9, 0x1D, 0xA8, 0x12, 0x19, 0xF7, 0x5C, 0x39, 0x99,
+    0x5F, 0xA5, 0x42, 0x24, 0xF5, 0x90, 0x07, 0xEE, 0xB8, 0xB8, 0xF8, 0xC2, 0x6F, 0xB0, 0x88, 0x88,
+    0xB1, 0x62, 0x9B, 0x44, 0xC6, 0x8B, 0x89, 0xF6, 0x7B, 0xE3, 0x81, 0x3C, 0x44, 0x22, 0xCA, 0x55,
+    0x29, 0xF5, 0xBD, 0xD8, 0x17, 0xD5, 0xBA, 0xA3, 0xE0, 0x44, 0xB7, 0x57, 0xA2, 0xD2, 0xD3, 0x1A,
+    0xD1, 0xA2, 0x19, 0xBF, 0x75, 0x2B, 0x95, 0xEE, 0xEC, 0xE4, 0x7A, 0xC1, 0xAA, 0xD8, 0x67, 0x9A,
+    0x6D, 0x88, 0x54, 0xAA, 0x45, 0xA1, 0xA7, 0x35, 0xA1, 0x59, 0x11, 0x85, 0x5A, 0xDF, 0xB7, 0xCA,
+    0xEA, 0xD5, 0xD4, 0x20, 0xAC, 0x2E, 0x35, 0xFB, 0xF0, 0x55, 0xCC, 0xFC, 0xDF, 0x73, 0x1D, 0xC8,
+    0x22, 0xB5, 0x55, 0xB5, 0x0E, 0x57, 0x20, 0x27, 0x73, 0x78, 0x53, 0x29, 0x2C, 0xD9, 0xBF, 0xF9,
+    0xCD, 0xEC, 0xA2, 0xC7, 0x00, 0xEA, 0x96, 0x19, 0xB7, 0xB0, 0x52, 0xE8, 0x4F, 0x37, 0x8C, 0x5C,
+    0x68, 0x35, 0x52, 0xCD, 0xFA, 0x0F, 0x5F, 0xD5, 0xCF, 0x1B, 0x79, 0x1D, 0xC0, 0xDB, 0x2D, 0x2B,
+    0x2D, 0x86, 0x16, 0x0A, 0xE5, 0x86, 0x24, 0x95, 0x02, 0x9A, 0xB5, 0xDE, 0x80, 0xC1, 0x52, 0x88,
+    0x3B, 0x5D, 0x0B, 0xFC, 0x9F, 0xFC, 0x8F, 0xBF, 0x91, 0x7D, 0xC6, 0xEF, 0xE7, 0x2D, 0xF8, 0x77,
+    0x46, 0xA8, 0x83, 0x5A, 0xAA, 0xB5, 0x1B, 0x29, 0x62, 0x33, 0x93, 0xEF, 0x2E, 0x80, 0xCA, 0x05,
+    0x7C, 0xBE, 0x42, 0xD5, 0xBE, 0xED, 0x57, 0x60, 0xAE, 0x5D, 0xBB, 0xAA, 0x75, 0x67, 0x81, 0x57,
+    0x62, 0x56, 0x75, 0xA9, 0x82, 0xC6, 0xB2, 0xD1, 0xF7, 0x5E, 0x2D, 0xE6, 0x7A, 0xD3, 0x17, 0x8F,
+    0x0A, 0x1A, 0x2B, 0xCC, 0x92, 0xAC, 0xCC, 0x77, 0x87, 0x7A, 0xCF, 0xB4, 0x81, 0x5F, 0xD1, 0x0A,
+    0x96, 0x78, 0x2E, 0x8C, 0x14, 0x60, 0xE2, 0x32, 0x49, 0x5D, 0x06, 0xCD, 0xB9, 0x26, 0x4C, 0x5F,
+    0x06, 0xB7, 0x5F, 0xD7, 0x42, 0x52, 0x98, 0xB9, 0x94, 0xB8, 0xD9, 0x00, 0xA7, 0xC1, 0x24, 0x3D,
+    0xBA, 0x15, 0xD0, 0xAC, 0x05, 0x0A, 0xF5, 0x4A, 0x0A, 0xC2, 0x0B, 0xF8, 0x35, 0xD7, 0x02, 0x9A,
+    0x0B, 0x2D, 0x54, 0x9A, 0x0A, 0xAD, 0xB9, 0x14, 0x0B, 0x4B, 0xCB, 0x27, 0x64, 0x39, 0x5D, 0x20,
+    0x5F, 0x00, 0xB2, 0x3E, 0x89, 0x34, 0x54, 0x6B, 0xF2, 0x41, 0x9A, 0x25, 0x69, 0x22, 0xA8, 0x87,
+    0x6A, 0x7A, 0xF8, 0xAA, 0xDF, 0xC0, 0xCD, 0xEB, 0x1A, 0x87, 0xA7, 0x15, 0xFD, 0xD6, 0xE9, 0x1B,
+    0xFA, 0x96, 0x92, 0xC8, 0x47, 0xEF, 0x34, 0xBD, 0x01, 0x85, 0xB4, 0x04, 0xFD, 0x54, 0x7F, 0x2C,
+    0xE6, 0x02, 0x78, 0x63, 0xCD, 0x6C, 0x64, 0x1F, 0x19, 0xEE, 0xB7, 0xD6, 0x7E, 0xD3, 0x51, 0x64,
+    0x52, 0x1F, 0x5C, 0xBF, 0xB9, 0xB6, 0x46, 0x72, 0xEA, 0x5F, 0xD1, 0x7E, 0x0F, 0x36, 0x6D, 0xB3,
+    0x99, 0xEE, 0x49, 0x00, 0xCD, 0xB7, 0xAC, 0xA8, 0x43, 0xCB, 0x21, 0x00, 0x84, 0x37, 0x3C, 0xCC,
+    0x74, 0x52, 0x0A, 0x7D, 0x5A, 0x3D, 0xB8, 0xDD, 0xA9, 0x35, 0x16, 0x54, 0x0B, 0x9A, 0x6B, 0xB5,
+    0x14, 0xEA, 0x1B, 0xB5, 0xB8, 0x1D, 0xAF, 0x96, 0x61, 0xC3, 0xAB, 0x6F, 0xA4, 0xD1, 0xEB, 0x5B,
+    0x92, 0xF0, 0xFA, 0x8E, 0x14, 0x0F, 0xB4, 0xF7, 0x4A, 0x2A, 0xAA, 0x34, 0xBB, 0x64, 0xC9, 0xA0,
+    0xA3, 0xE8, 0x39, 0x95, 0x60, 0x6D, 0x57, 0x98, 0x51, 0x29, 0x72, 0xB0, 0x52, 0xDB, 0x8C, 0x6B,
+    0xDC, 0x8A, 0x55, 0xF4, 0x7A, 0x5A, 0xCF, 0x2A, 0x6A, 0x6B, 0xAC, 0x04, 0x4E, 0x2B, 0xDA, 0xB2,
+    0x9F, 0xA1, 0x4D, 0x83, 0x55, 0x01, 0x54, 0x56, 0xEF, 0xB2, 0x1F, 0x57, 0x7B, 0x15, 0x4A, 0xB7,
+    0x21, 0x95, 0xCE, 0x23, 0xDF, 0x13, 0x7B, 0xDC, 0x2D, 0xC0, 0x9A, 0x22, 0x96, 0x1E, 0x8A, 0x85,
+    0x6E, 0x04, 0xB7, 0x94, 0x11, 0xA8, 0x17, 0x53, 0x6B, 0x7C, 0x39, 0x79, 0xE1, 0x13, 0x70, 0x5C,
+    0xFB, 0x23, 0x42, 0x95, 0x5F, 0xF3, 0x69, 0x01, 0x94, 0x63, 0xB1, 0xB0, 0x23, 0xDC, 0xD2, 0x4C,
+    0xF8, 0x67, 0x57, 0x2B, 0x61, 0xAC, 0x34, 0x26, 0xAD, 0xCD, 0xA7, 0x7E, 0x69, 0xD3, 0x02, 0x6C,
+    0x91, 0xF9, 0xA3, 0x23, 0x5C, 0xAE, 0x95, 0x2A, 0x45, 0x0B, 0xAD, 0x50, 0xEC, 0xED, 0x2B, 0xEA,
+    0xB1, 0x73, 0xED, 0x2D, 0x5E, 0x5A, 0xB2, 0x83, 0xAE, 0xBC, 0x56, 0xEA, 0xEB, 0xD5, 0xED, 0x54,
+    0x6B, 0xBD, 0x51, 0x2D, 0xF5, 0x46, 0x19, 0x9A, 0x9D, 0xBC, 0xAF, 0x6D, 0xB1, 0x5A, 0x93, 0x40,
+    0x55, 0x91, 0xAC, 0xA4, 0x55, 0x76, 0xCD, 0x94, 0xD2, 0x02, 0xB7, 0x8C, 0xB2, 0xBF, 0x55, 0x3D,
+    0xDD, 0xE6, 0x47, 0xEA, 0x74, 0x98, 0xA9, 0xA3, 0x5F, 0xF0, 0xAB, 0xDF, 0xDF, 0xAF, 0xE0, 0x25,
+    0x23, 0x26, 0xB7, 0x95, 0x55, 0x4F, 0x5C, 0xB4, 0xE9, 0xE4, 0xCB, 0xD9, 0x32, 0x35, 0xB9, 0xD2,
+    0x64, 0x50, 0x92, 0xB5, 0x74, 0x23, 0x64, 0xE3, 0x43, 0xCB, 0x78, 0xA3, 0x95, 0x4E, 0x1A, 0x3B,
+    0x29, 0xF8, 0x50, 0xC6, 0x7A, 0x65, 0xA8, 0x76, 0xEA, 0xBB, 0x9A, 0xF3, 0xBE, 0xD3, 0x84, 0x33,
+    0x9D, 0x93, 0x8D, 0x5A, 0x9A, 0x18, 0x14, 0xC9, 0xA4, 0x4F, 0x8F, 0xA5, 0xBE, 0xB7, 0xE0, 0x57,
+    0x51, 0x6D, 0x3E, 0x14, 0x72, 0x7A, 0x51, 0xEF, 0x96, 0xD4, 0x77, 0x52, 0xCB, 0xFB, 0xFF, 0xF8,
+    0x4C, 0x2A, 0x1D, 0xA6, 0x44, 0x4D, 0x2A, 0xB5, 0x27, 0xCE, 0x7B, 0x37, 0x76, 0xA3, 0x11, 0xDE,
+    0x1F, 0x2A, 0xB5, 0xFE, 0x55, 0x6A, 0xCA, 0xEC, 0xCB, 0x89, 0xBF, 0x6E, 0x63, 0xA4, 0xA5, 0xFB,
+    0xF3, 0x80, 0xFF, 0xDA, 0x8E, 0x1F, 0x9B, 0xF1, 0x41, 0xDA, 0xFA, 0xB5, 0x16, 0x06, 0x2B, 0xE7,
+    0xCC, 0x24, 0x8D, 0x1A, 0xEB, 0xD0, 0xCD, 0x79, 0x6C, 0x56, 0xBA, 0x4A, 0xFD, 0xEB, 0x33, 0xA9,
+    0xC5, 0x6B, 0xB7, 0x93, 0xEA, 0xCC, 0x63, 0x0A, 0x94, 0xDA, 0x6B, 0x6A, 0x7D, 0x76, 0x42, 0xDF,
+    0x8B, 0x34, 0x8B, 0x46, 0x17, 0xBD, 0x86, 0xCD, 0x99, 0xEC, 0xFD, 0x46, 0x76, 0x16, 0x86, 0xFA,
+    0x95, 0x1A, 0x63, 0x1C, 0xCC, 0xFE, 0xC2, 0x64, 0x2C, 0xC3, 0x51, 0x2F, 0x52, 0xCF, 0x49, 0x94,
+    0x37, 0x57, 0x7B, 0x20, 0x06, 0x4F, 0x9A, 0xA7, 0x51, 0x1B, 0x0E, 0x1B, 0x5D, 0xCC, 0x54, 0xEE,
+    0x34, 0x77, 0xD5, 0x97, 0x61, 0x58, 0xF9, 0x5C, 0xAD, 0xC5, 0x14, 0x6D, 0x3B, 0xA9, 0x2D, 0x93,
+    0x3B, 0x02, 0x9D, 0xFE, 0x3A, 0x64, 0x5A, 0x37, 0xDC, 0xEE, 0xC7, 0x5C, 0xEF, 0x8B, 0xE8, 0x69,
+    0xBD, 0xAC, 0x49, 0x26, 0x31, 0x39, 0x5D, 0xD6, 0x0A, 0xFB, 0x60, 0x93, 0x34, 0x1F, 0x26, 0xA8,
+    0x4C, 0xAC, 0x98, 0x62, 0xB3, 0x95, 0x35, 0x5B, 0xCF, 0x4A, 0x0B, 0xD7, 0xDB, 0x6C, 0xA5, 0x99,
+    0xB2, 0x9D, 0xA1, 0xB7, 0x6A, 0x69, 0xFF, 0xF2, 0x9A, 0x60, 0x6D, 0x0B, 0xDF, 0xF4, 0xAB, 0x3B,
+    0xAD, 0x81, 0x2F, 0xF1, 0x47, 0x0C, 0x74, 0x7D, 0x1D, 0xFC, 0x98, 0xCB, 0x8F, 0x78, 0x4D, 0xD6,
+    0x03, 0x3E, 0x1C, 0xE9, 0xE7, 0x5F, 0xC6, 0xB4, 0xBE, 0x71, 0x3A, 0x74, 0xEE, 0x8F, 0xCD, 0x1F,
+    0xF4, 0x8D, 0xF4, 0xE0, 0xF9, 0x61, 0xBF, 0xD0, 0x37, 0xD6, 0x5C, 0x53, 0x15, 0xD5, 0x36, 0x1B,
+    0xDD, 0x67, 0x42, 0xAE, 0xA9, 0x5C, 0x3B, 0x9A, 0x8D, 0x8E, 0x9B, 0xB9, 0xA6, 0xAC, 0x3D, 0x70,
+    0xB7, 0xC4, 0xA4, 0x7F, 0x8D, 0x1E, 0x94, 0x7A, 0xC9, 0x90, 0x82, 0x78, 0x76, 0xEB, 0xEB, 0x43,
+    0x47, 0xE4, 0x6A, 0xD3, 0x18, 0xF6, 0x63, 0xD0, 0x56, 0x96, 0x10, 0xA2, 0x57, 0xC2, 0x8A, 0xB9,
+    0x25, 0x02, 0x1A, 0x63, 0x52, 0x27, 0xE9, 0x8A, 0x42, 0x89, 0x22, 0x3D, 0x04, 0xE8, 0xA4, 0x4F,
+    0x4A, 0x0A, 0x32, 0x56, 0xDF, 0x76, 0xE6, 0x6A, 0x1E, 0x04, 0xDD, 0x9F, 0xF4, 0xC4, 0x9A, 0xD1,
+    0x48, 0x73, 0x69, 0xA5, 0x16, 0xD1, 0x24, 0x1B, 0x0F, 0x06, 0x42, 0xB9, 0x27, 0x0E, 0x4F, 0x73,
+    0x48, 0x66, 0x1C, 0xF2, 0xC4, 0xDD, 0x78, 0x9C, 0x16, 0xE4, 0x96, 0xF9, 0x8E, 0x34, 0x13, 0xD4,
+    0xC1, 0xFC, 0xCA, 0xBB, 0x3B, 0x50, 0x68, 0x30, 0x84, 0xE2, 0x4A, 0x96, 0x27, 0x41, 0xA5, 0x0F,
+    0x97, 0xD7, 0xFE, 0xFA, 0x75, 0x65, 0x3D, 0x42, 0xB9, 0xA4, 0x6A, 0xBC, 0xC1, 0xA0, 0xE2, 0xC1,
+    0x4D, 0x0C, 0x4F, 0x07, 0x7C, 0xF8, 0x12, 0x75, 0x34, 0xDC, 0xB8, 0x94, 0xD6, 0x46, 0x92, 0x33,
+    0x69, 0xDA, 0xC4, 0x95, 0xFA, 0x29, 0xBA, 0xE6, 0xFC, 0x44, 0xFF, 0x86, 0x5C, 0xDA, 0xE9, 0x8C,
+    0x9E, 0x3F, 0x22, 0x4D, 0x64, 0x5F, 0x78, 0xAD, 0xDB, 0xED, 0xF1, 0x41, 0x5F, 0x30, 0xD1, 0x9C,
+    0x19, 0xBC, 0xAE, 0x56, 0x10, 0xBE, 0x46, 0xED, 0xF6, 0xF3, 0x8D, 0xE0, 0xAC, 0xDB, 0x4E, 0x85,
+    0xA4, 0x51, 0x52, 0xB8, 0xA6, 0x97, 0x9E, 0xFC, 0xA9, 0x47, 0x70, 0xFE, 0xF9, 0xDC, 0xA4, 0xC1,
+    0xC2, 0xC7, 0x0D, 0x6F, 0xFF, 0xAE, 0x09, 0x89, 0x19, 0xA4, 0xE2, 0x2B, 0x13, 0x88, 0x9B, 0x9B,
+    0xE5, 0xD5, 0x50, 0xAF, 0x83, 0x79, 0xDF, 0x99, 0xB9, 0xFF, 0x91, 0xB4, 0x65, 0x56, 0xB7, 0xDA,
+    0x56, 0xDA, 0x5B, 0xA7, 0x96, 0xC2, 0x30, 0x61, 0xFC, 0x92, 0x4E, 0xE9, 0x17, 0xF3, 0x30, 0xFD,
+    0xD0, 0x02, 0x5D, 0xA0, 0x52, 0x7F, 0x88, 0x0D, 0x98, 0x2B, 0xBD, 0xD0, 0x6D, 0xD0, 0x68, 0x97,
+    0xC6, 0xB3, 0xA0, 0x72, 0x71, 0x29, 0xEB, 0xBC, 0x99, 0x22, 0xE9, 0xE7, 0x01, 0xF8, 0x2A, 0xB7,
+    0x21, 0xD3, 0xFC, 0x71, 0x40, 0xEA, 0xFA, 0x23, 0x3C, 0x72, 0x5F, 0x53, 0x00, 0xE6, 0x3A, 0xFC,
+    0x18, 0xF1, 0xB3, 0x8F, 0x6E, 0x7C, 0x64, 0xCB, 0xA4, 0x56, 0x6A, 0x07, 0x4D, 0x9D, 0xA6, 0x5A,
+    0xE1, 0xBA, 0x16, 0x9A, 0x98, 0xD4, 0x11, 0x2A, 0xB5, 0xB9, 0xC6, 0x5C, 0x13, 0x43, 0x48, 0x4A,
+    0x09, 0x3F, 0xFE, 0x85, 0xB6, 0x52, 0x9B, 0x6B, 0xCA, 0x35, 0x31, 0xC4, 0x4C, 0x4B, 0x8A, 0x21,
+    0x0A, 0x0B, 0x1E, 0x3A, 0xED, 0x83, 0xC6, 0x52, 0x5B, 0xAD, 0x89, 0xEB, 0xB7, 0xB3, 0x27, 0xAF,
+    0x2E, 0x8D, 0x76, 0x61, 0x5E, 0x49, 0x20, 0xCE, 0x1E, 0x3E, 0xBA, 0x86, 0xFF, 0x6C, 0x6A, 0xDA,
+    0x6B, 0xA7, 0xD3, 0x07, 0xD2, 0x8E, 0x3E, 0x9D, 0x34, 0xD5, 0xD2, 0xDF, 0x48, 0x0B, 0x83, 0x9E,
+    0x43, 0xCB, 0x2F, 0xBC, 0x23, 0x39, 0x77, 0x64, 0xEA, 0xD7, 0x52, 0xA6, 0x4D, 0x33, 0x04, 0x4A,
+    0x4D, 0x16, 0x0D, 0xA9, 0x2D, 0x35, 0x91, 0x4B, 0x2F, 0x2A, 0x1A, 0x2E, 0x94, 0x92, 0xE1, 0x89,
+    0x56, 0x68, 0xD3, 0xED, 0xF1, 0x8B, 0xF6, 0xD8, 0x4C, 0xE3, 0x90, 0x2E, 0x31, 0x80, 0xC6, 0xFA,
+    0x33, 0x3B, 0x9D, 0x1E, 0xA9, 0x88, 0x76, 0x7D, 0x98, 0xAE, 0xDF, 0x99, 0x6A, 0x2D, 0x4E, 0x4B,
+    0xA5, 0xAD, 0xD4, 0x96, 0x49, 0xDC, 0xFA, 0x59, 0xBB, 0xED, 0xEA, 0x0B, 0x0B, 0xC3, 0x42, 0xB3,
+    0xD9, 0x0B, 0x63, 0xAD, 0x36, 0x05, 0xF4, 0x5E, 0xB2, 0x99, 0xF9, 0x82, 0x22, 0x9D, 0xBE, 0xA9,
+    0x0D, 0x3E, 0x7C, 0x45, 0x7F, 0x01, 0xF8, 0x1C, 0xFF, 0xC8, 0xB2, 0xB7, 0xC5, 0x0C, 0x14, 0xBB,
+    0x55, 0x79, 0xF9, 0xB3, 0x36, 0xF8, 0x72, 0x55, 0xA6, 0x2D, 0xFB, 0xE3, 0xFF, 0x26, 0xBA, 0xD4,
+    0x52, 0x49, 0x59, 0xE0, 0xB7, 0x01, 0xE1, 0x7A, 0xF0, 0xF7, 0x6E, 0x9D, 0x35, 0x0D, 0x8D, 0xE2,
+    0x71, 0x59, 0x4D, 0xFD, 0x2B, 0x39, 0x45, 0xAF, 0xB5, 0x29, 0x57, 0xD2, 0x26, 0x2F, 0xD6, 0xA0,
+    0x91, 0xCA, 0x32, 0x29, 0x93, 0x65, 0xEB, 0xBF, 0x6A, 0xFB, 0xAB, 0x98, 0x50, 0x2F, 0xF8, 0x17,
+    0x0D, 0x18, 0x39, 0x88, 0xC1, 0xF7, 0x7E, 0xC3, 0x2D, 0xF1, 0xF5, 0xCF, 0x73, 0xD6, 0x82, 0x72,
+    0x2F, 0xAF, 0x40, 0x39, 0x77, 0x40, 0xBE, 0xB8, 0x09, 0xF8, 0x6A, 0xBE, 0x9C, 0xF7, 0x2A, 0x28,
+    0xEE, 0xEF, 0x00, 0xDD, 0x0E, 0x70, 0xFD, 0xDE, 0xAF, 0xE6, 0x94, 0xCE, 0xC9, 0x00, 0xF8, 0x32,
+    0x1F, 0x03, 0x68, 0x26, 0x17, 0x80, 0x72, 0x2F, 0x2C, 0xCB, 0x34, 0x19, 0x15, 0x72, 0xF1, 0x2B,
+    0xE0, 0xD6, 0x6A, 0x03, 0xB2, 0x8D, 0x1D, 0xE0, 0x1F, 0x53, 0xFD, 0xB7, 0xB1, 0xFA, 0xFE, 0x16,
+    0xFF, 0x0C, 0x28, 0x96, 0xA6, 0x87, 0x6C, 0x77, 0x01, 0xD0, 0x7B, 0x22, 0xD0, 0x3D, 0xBD, 0x01,
+    0xCD, 0x37, 0x05, 0xB8, 0x79, 0x00, 0x8A, 0xE0, 0x5B, 0xE0, 0x3F, 0x96, 0xFD, 0xAF, 0xAA, 0x19,
+    0xFF, 0x55, 0xB5, 0xBD, 0xF1, 0xD2, 0xF6, 0xEE, 0x57, 0x6D, 0xAF, 0x52, 0x6C, 0x9C, 0xB6, 0xD6,
+    0x33, 0x1A, 0xF7, 0xAD, 0x64, 0x7B, 0xAF, 0xDD, 0x31, 0x2C, 0xE5, 0x10, 0xCD, 0x4A, 0x32, 0xD2,
+    0x46, 0x32, 0x4A, 0x45, 0xA9, 0x47, 0x99, 0xE2, 0x21, 0x10, 0x7C, 0x38, 0xC8, 0xD0, 0xFE, 0x43,
+    0xF6, 0xC8, 0x64, 0x3D, 0x62, 0xF2, 0xA8, 0x76, 0x2C, 0xE2, 0x15, 0xC0, 0xD9, 0x14, 0x2C, 0x6B,
+    0xFD, 0xC7, 0xCB, 0xB5, 0xB4, 0x79, 0xA0, 0x50, 0xE6, 0xDF, 0x5E, 0x52, 0x78, 0xC2, 0xA5, 0xB8,
+    0xEF, 0x81, 0xD1, 0x15, 0x3A, 0x63, 0x12, 0x7A, 0x5F, 0x3C, 0x57, 0x01, 0x1F, 0x1B, 0x07, 0xB9,
+    0x85, 0xA3, 0x34, 0xFB, 0x5F, 0x19, 0xF3, 0xE5, 0x91, 0xB7, 0x6B, 0xA7, 0x53, 0xF2, 0x57, 0xDE,
+    0x2D, 0xED, 0xF8, 0x40, 0xA7, 0xCD, 0x4B, 0x53, 0xA1, 0xB6, 0x92, 0xBE, 0x26, 0x2D, 0x74, 0x2B,
+    0x8D, 0x96, 0x5C, 0x2B, 0x95, 0x46, 0x9A, 0x15, 0xA7, 0x1E, 0x45, 0x0A, 0x81, 0x22, 0x4E, 0x13,
+    0x3E, 0x50, 0x69, 0xCC, 0x24, 0xCA, 0x1D, 0xFC, 0x46, 0xA3, 0xC0, 0x30, 0x51, 0x68, 0x2E, 0xA4,
+    0xD6, 0x45, 0x68, 0x84, 0xD7, 0x8A, 0x7A, 0x50, 0x28, 0xA5, 0xB1, 0x5E, 0xC0, 0xA9, 0x1D, 0xEE,
+    0xC4, 0x5C, 0xC0, 0xB0, 0xBA, 0x1F, 0x68, 0xF2, 0x33, 0x94, 0xFA, 0x9A, 0x9C, 0x0A, 0x13, 0x85,
+    0x69, 0xE6, 0x21, 0x18, 0x6C, 0xF4, 0xED, 0xAD, 0xD4, 0x7B, 0x57, 0xA0, 0xDE, 0xFD, 0xE8, 0x57,
+    0xB5, 0x80, 0x7E, 0xB4, 0xE6, 0xFA, 0x46, 0x00, 0x2A, 0x0D, 0xAD, 0x49, 0x95, 0xD0, 0x29, 0x98,
+    0x12, 0x10, 0x85, 0x76, 0x2B, 0x94, 0x30, 0xA8, 0xBC, 0x4B, 0xE2, 0xD3, 0x91, 0xC2, 0x06, 0x8C,
+    0xD3, 0x78, 0x66, 0xB2, 0x2C, 0x89, 0x38, 0x4A, 0xA9, 0x4B, 0x01, 0xD1, 0x2B, 0xBD, 0xF1, 0xFF,
+    0x5C, 0xC1, 0x94, 0x38, 0x2B, 0x57, 0x40, 0x96, 0x56, 0x51, 0xFC, 0x37, 0x6C, 0x10, 0xBA, 0xE0,
+    0x8D, 0xFC, 0xBF, 0x65, 0x29, 0xCD, 0xD0, 0x57, 0xFD, 0x8F, 0xF1, 0xDE, 0x0B, 0x69, 0xBE, 0x76,
+    0x33, 0x37, 0xCE, 0xBD, 0x5A, 0xAF, 0x1F, 0x4A, 0x63, 0xBD, 0xE6, 0xDA, 0xCA, 0xB4, 0x6D, 0x40,
+    0x22, 0x96, 0xF8, 0x39, 0xD3, 0x54, 0x68, 0x2A, 0x23, 0x6E, 0xA7, 0xDB, 0x19, 0x46, 0x86, 0xE0,
+    0x14, 0xDC, 0x42, 0x29, 0xA4, 0x56, 0xE0, 0x97, 0xFA, 0xBB, 0x6B, 0x3D, 0x93, 0xEB, 0xEE, 0xAA,
+    0xBB, 0x1B, 0xB8, 0xE8, 0xDF, 0x1B, 0xFD, 0x08, 0x7A, 0x36, 0x74, 0xCF, 0xAE, 0x50, 0xEE, 0x4F,
+    0x15, 0xFB, 0x60, 0x54, 0x27, 0xAF, 0x00, 0xB9, 0x62, 0x92, 0x1F, 0xD5, 0x68, 0xE3, 0x4B, 0x0B,
+    0xA9, 0x60, 0x34, 0x95, 0xE9, 0x76, 0xE1, 0x7C, 0xDD, 0xE9, 0xF6, 0x61, 0x2E, 0x8B, 0x01, 0x52,
+    0x29, 0x51, 0x92, 0x8E, 0xED, 0x9E, 0xD9, 0x39, 0xA4, 0x4B, 0xF0, 0x63, 0xB9, 0x00, 0x7F, 0xF8,
+    0x80, 0x84, 0xF0, 0xAF, 0xF1, 0xFE, 0x16, 0x70, 0x7D, 0xBE, 0xE4, 0xA6, 0x14, 0xC9, 0xE7, 0xDB,
+    0x80, 0x6C, 0xEF, 0x46, 0x40, 0xE5, 0x6A, 0x09, 0x68, 0xC0, 0xB7, 0xEE, 0x91, 0x1D, 0x2F, 0x6D,
+    0xA5, 0x36, 0x2F, 0xE5, 0xD2, 0x67, 0xA5, 0xBE, 0x53, 0xDF, 0x89, 0x5C, 0x7D, 0xA5, 0x11, 0x2B,
+    0x47, 0xEB, 0x66, 0x9A, 0x9D, 0x26, 0x50, 0x6A, 0x74, 0x2B, 0x28, 0x94, 0x11, 0xEA, 0xAD, 0xD0,
+    0xF9, 0xAA, 0xBB, 0x30, 0x8C, 0xE0, 0x36, 0x3F, 0x41, 0xAE, 0x3F, 0x0F, 0x80, 0x4F, 0xBD, 0x16,
+    0x2F, 0xC7, 0x65, 0xDA, 0x71, 0xEA, 0xEA, 0x66, 0x23, 0xD6, 0x93, 0x66, 0x42, 0xEB, 0x4B, 0xBB,
+    0x73, 0xA1, 0x0D, 0x4C, 0xA7, 0x33, 0xE5, 0xD6, 0x0B, 0x6B, 0xC9, 0xEE, 0x01, 0x41, 0xAD, 0x6A,
+    0x29, 0x57, 0xA0, 0x0B, 0x7E, 0x81, 0x5C, 0xDF, 0xB4, 0x0D, 0x4D, 0x4D, 0x8A, 0x68, 0xAD, 0x22,
+    0x90, 0x25, 0x8F, 0xE3, 0x41, 0xA5, 0x2B, 0x4E, 0xA7, 0x0F, 0x58, 0x3D, 0xF5, 0x77, 0xA5, 0xE0,
+    0xA5, 0x46, 0x3B, 0x8D, 0xE6, 0x4A, 0xA3, 0xA9, 0x92, 0xF7, 0x0C, 0x13, 0xB5, 0x28, 0x76, 0xF0,
+    0x3B, 0x8D, 0x21, 0x2D, 0x26, 0x30, 0x5A, 0xA5, 0x2A, 0x9E, 0x09, 0x32, 0xFD, 0x8D, 0x9D, 0xDB,
+    0x77, 0x8D, 0xA1, 0x6D, 0x4C, 0x7E, 0x25, 0xB2, 0xF2, 0x74, 0x45, 0xE7, 0xD7, 0xFF, 0x94, 0x7D,
+    0x5E, 0xE9, 0x39, 0xF3, 0x09, 0x52, 0x56, 0xF2, 0xB2, 0xCF, 0x53, 0xC2, 0xA7, 0x9C, 0x8F, 0x8C,
+    0x4F, 0x96, 0x88, 0xCE, 0x87, 0x5E, 0xB2, 0xE9, 0x21, 0xFC, 0xCE, 0x2B, 0x6C, 0xEA, 0xE9, 0x49,
+    0x93, 0x6A, 0xF1, 0x92, 0xF4, 0x6E, 0x49, 0x5A, 0xFD, 0xF3, 0x7F, 0xD2, 0xA9, 0x88, 0x94, 0x9A,
+    0x7C, 0x8F, 0xD6, 0x62, 0xC1, 0x8B, 0xC7, 0xAD, 0x22, 0xC8, 0xBC, 0x6B, 0x2F, 0x52, 0x66, 0x2B,
+    0xD3, 0x72, 0x3C, 0x76, 0x57, 0x1E, 0xEF, 0xC7, 0xE3, 0x5C, 0x0B, 0xAE, 0xED, 0x76, 0xB2, 0xE8,
+    0x34, 0xE2, 0xEF, 0x2A, 0x50, 0xC6, 0x6E, 0x87, 0xE1, 0x1B, 0x97, 0xC8, 0xD3, 0x67, 0x24, 0x69,
+    0x49, 0xD4, 0x85, 0x33, 0x2C, 0x98, 0xF6, 0x2D, 0xD0, 0x51, 0x00, 0xD1, 0x1D, 0x69, 0xC8, 0xFA,
+    0x90, 0x8A, 0x7A, 0x48, 0x7E, 0xD7, 0x80, 0x23, 0xDD, 0xF6, 0x09, 0xEF, 0xD1, 0xBB, 0x25, 0x45,
+    0x37, 0x95, 0x1A, 0x3D, 0x7E, 0x63, 0x2D, 0x34, 0xD3, 0x36, 0x4A, 0xCD, 0x73, 0x4E, 0x9E, 0xB9,
+    0xA4, 0xA3, 0xF9, 0xB9, 0x52, 0x63, 0x39, 0xFB, 0x0D, 0xFF, 0x29, 0x4D, 0xD9, 0xEE, 0x75, 0x71,
+    0x67, 0x39, 0x17, 0xB5, 0xD8, 0xBE, 0xBF, 0x76, 0x7B, 0x6B, 0x7B, 0xD4, 0x6A, 0xD8, 0x0A, 0xDE,
+    0xEC, 0x67, 0x18, 0xEB, 0x91, 0x9A, 0x2A, 0xA7, 0xD3, 0xE9, 0xD4, 0xFA, 0xE3, 0x5B, 0xD2, 0x95,
+    0x7E, 0x6A, 0xFF, 0xC2, 0x07, 0x14, 0xFC, 0x48, 0xB7, 0x15, 0x2B, 0x4E, 0xBD, 0x6F, 0x0B, 0x85,
+    0xEC, 0x73, 0xB6, 0x55, 0x46, 0x6D, 0xB9, 0x89, 0x80, 0x39, 0x24, 0x26, 0x49, 0x6A, 0x8F, 0x75,
+    0xE5, 0xF1, 0x7C, 0x3C, 0x6E, 0xD4, 0xB2, 0x94, 0x9A, 0xA9, 0x47, 0x45, 0x8A, 0xD8, 0x08, 0xBA,
+    0x67, 0x34, 0x53, 0xC5, 0x4B, 0x6C, 0xCF, 0x4A, 0x72, 0xDE, 0x7D, 0xDE, 0x33, 0xEB, 0xB0, 0x8F,
+    0x6E, 0x4B, 0x05, 0xF6, 0x99, 0x42, 0x9A, 0x83, 0xD5, 0xA3, 0xB5, 0x61, 0x06, 0xE9, 0x5E, 0x21,
+    0x19, 0x51, 0x6D, 0xF1, 0x92, 0xC6, 0x8D, 0x2E, 0x16, 0xA1, 0xD0, 0xE4, 0x7A, 0xBF, 0xF3, 0x58,
+    0xAE, 0x94, 0xCB, 0x38, 0xA7, 0x96, 0xAD, 0xFA, 0x4F, 0xE3, 0xEB, 0xE9, 0x22, 0x7F, 0x54, 0x68,
+    0x2A, 0x56, 0xBF, 0x51, 0x7F, 0x4F, 0xF7, 0x2F, 0xF4, 0xBE, 0xA3, 0x2A, 0x21, 0xF8, 0x64, 0xB6,
+    0x52, 0x9E, 0xC3, 0x74, 0x61, 0x2D, 0xD1, 0xE1, 0x62, 0x33, 0xA7, 0x4C, 0xC7, 0xC1, 0x49, 0x1B,
+    0x81, 0x6A, 0xF9, 0xB5, 0x19, 0xCD, 0x40, 0x31, 0xE5, 0x2B, 0xCD, 0x58, 0x4F, 0x74, 0xE3, 0x0E,
+    0xFA, 0x6C, 0x48, 0x6E, 0xA0, 0xD6, 0xE4, 0x1F, 0x66, 0x5F, 0xFD, 0x87, 0x19, 0xCD, 0x8F, 0x7F,
+    0x21, 0x6D, 0x5C, 0x31, 0x48, 0x7D, 0x25, 0x09, 0xBF, 0xDD, 0x8A, 0xB9, 0x46, 0x37, 0xB9, 0x9D,
+    0xDF, 0xA6, 0x5B, 0x52, 0x79, 0x5F, 0xA9, 0x03, 0xF4, 0x35, 0x8A, 0xE7, 0x94, 0x22, 0xF4, 0x9F,
+    0xFF, 0xA9, 0x3D, 0xA1, 0x12, 0x9D, 0xE9, 0xE7, 0x09, 0xAE, 0x51, 0x8E, 0x45, 0xCC, 0x34, 0xFA,
+    0xB5, 0x50, 0xDB, 0x84, 0x2C, 0xF2, 0x5B, 0x00, 0xB7, 0x89, 0xC5, 0x56, 0x6E, 0x2E, 0x36, 0x8B,
+    0x9F, 0x7C, 0xFB, 0xDB, 0x00, 0x8F, 0x8F, 0xE6, 0xDA, 0xAD, 0xD4, 0x9A, 0x8B, 0x28, 0x54, 0xC6,
+    0x66, 0xAA, 0xEF, 0x2E, 0x7C, 0x19, 0xE0, 0x41, 0x55, 0x06, 0xEF, 0xF4, 0x89, 0xA4, 0x8B, 0xF0,
+    0x0A, 0x31, 0x81, 0x16, 0x78, 0x57, 0xE0, 0x9F, 0x76, 0x7D, 0xF9, 0xED, 0x07, 0x4B, 0xEF, 0xAF,
+    0xDF, 0x6E, 0x56, 0x1F, 0x7D, 0xF4, 0xB1, 0x0E, 0xD0, 0xF4, 0xCD, 0x67, 0xF6, 0x6A, 0x57, 0xD0,
+    0xCB, 0x7B, 0xB5, 0xFB, 0xD1, 0xFC, 0xA7, 0xC7, 0x28, 0x35, 0x37, 0x5A, 0xFD, 0xB3, 0xD1, 0xE7,
+    0xB1, 0xC9, 0x23, 0xE5, 0xCA, 0xAD, 0x39, 0x53, 0x4B, 0xC4, 0x4E, 0x85, 0x8F, 0x50, 0x6A, 0x76,
+    0x2F, 0x2E, 0xCD, 0xBB, 0xA2, 0x27, 0x7A, 0xA2, 0x7F, 0xE7, 0xDA, 0xBC, 0xB0, 0x38, 0x4D, 0xD9,
+    0x53, 0xE4, 0xED, 0x9B, 0xB3, 0xE8, 0x26, 0xBD, 0x27, 0xFA, 0xBB, 0x7B, 0x33, 0xCB, 0x85, 0xE1,
+    0xD3, 0x8B, 0xBF, 0xBB, 0xBA, 0xF1, 0x6D, 0xF9, 0xC1, 0xC5, 0xC8, 0xE7, 0x2C, 0x76, 0xAD, 0x7F,
+    0x3A, 0xBA, 0x50, 0xFF, 0x70, 0x63, 0x50, 0x5F, 0x28, 0xE0, 0x36, 0x68, 0x7A, 0x7E, 0x8B, 0xDF,
+    0xAF, 0xC7, 0xCD, 0x2D, 0xDD, 0xDD, 0xDD, 0x05, 0x7F, 0x77, 0xAF, 0x56, 0x3F, 0xAA, 0x5C, 0xDC,
+    0xF8, 0x54, 0x36, 0x3B, 0x93, 0x0C, 0x7A, 0x8E, 0x4E, 0xA1, 0x96, 0x9E, 0xDE, 0x6F, 0xC5, 0x8F,
+    0xE3, 0xBF, 0xDD, 0xB2, 0xBE, 0x01, 0xE0, 0x66, 0x1E, 0xAB, 0xC5, 0x85, 0x66, 0xF2, 0xA3, 0x1F,
+    0xFD, 0xE4, 0x43, 0xB3, 0x5E, 0xBF, 0x9D, 0xB5, 0xCD, 0xD2, 0x44, 0x17, 0xAB, 0x58, 0xC6, 0x6A,
+    0x75, 0xA1, 0x99, 0xBA, 0xFE, 0x5F, 0x90, 0xB5, 0xF5, 0xEA, 0x57, 0x1F, 0xFC, 0xEC, 0xA7, 0x66,
+    0x76, 0xA1, 0x5C, 0xF3, 0x8D, 0x7F, 0xFB, 0xCF, 0xEB, 0x67, 0xFE, 0x6E, 0x1B, 0x9A, 0xCF, 0x3E,
+    0x1D, 0x96, 0xC7, 0x00, 0x3F, 0xEA, 0x93, 0xBB, 0x5B, 0xBA, 0xA7, 0xA3, 0x1B, 0xFF, 0x07, 0xA0,
+    0x9A, 0xAD, 0xF9, 0xFC, 0x5A, 0xCD, 0xD7, 0xB8, 0xF6, 0x9E, 0xAD, 0xDC, 0x14, 0x24, 0x39, 0x0D,
+    0xD3, 0xF0, 0xCD, 0xCF, 0x65, 0x9F, 0x07, 0xBA, 0xB9, 0xD6, 0xA7, 0x7E, 0x10, 0x3F, 0x5E, 0x3D,
+    0x3B, 0x7D, 0xCC, 0x7F, 0xE8, 0xAE, 0x96, 0xF2, 0x1E, 0x50, 0xCD, 0xCD, 0xEA, 0x62, 0x15, 0xAB,
+    0xD5, 0x05, 0x3F, 0xBD, 0x95, 0xB4, 0x6D, 0xEE, 0x9E, 0x6F, 0xF9, 0xD5, 0x6D, 0x73, 0x9B, 0xC9,
+    0x85, 0x7C, 0xC3, 0x8F, 0xC5, 0x86, 0xDF, 0xEF, 0x2A, 0x9A, 0xE6, 0x77, 0xF7, 0xDD, 0x1F, 0x6D,
+    0xEA, 0xBE, 0xFB, 0xA3, 0x4D, 0x2D, 0xD7, 0x5A, 0x2B, 0x61, 0x8B, 0x34, 0x0A, 0xD5, 0x3D, 0x7D,
+    0x42, 0xC5, 0xE6, 0x47, 0xF7, 0xBD, 0x70, 0x26, 0xD5, 0x65, 0x33, 0xFF, 0xC8, 0xB7, 0xC5, 0xB3,
+    0xFB, 0xBB, 0xA2, 0x97, 0x7A, 0x69, 0x4E, 0xA1, 0x59, 0xFE, 0xB9, 0x6B, 0x99, 0xA6, 0xAF, 0x78,
+    0x7D, 0x28, 0x8D, 0xA1, 0xBB, 0x93, 0x0F, 0xF0, 0x06, 0xBC, 0xF4, 0x6D, 0x1B, 0x43, 0x77, 0x2F,
+    0x2E, 0xFE, 0xF2, 0xD5, 0xDB, 0x97, 0x37, 0x18, 0x2B, 0xCA, 0x04, 0x08, 0xCA, 0xDD, 0x76, 0x77,
+    0x0E, 0x64, 0x91, 0x04, 0x5A, 0xF8, 0xC9, 0x7F, 0x47, 0xE7, 0x41, 0xD5, 0xF4, 0x4D, 0x7F, 0x03,
+    0xDF, 0xFB, 0xBE, 0xEB, 0xFD, 0x7F, 0xF1, 0x5B, 0xBD, 0x1E, 0x8B, 0xA1, 0xD5, 0xA8, 0x58, 0xEE,
+    0xAF, 0x4C, 0xDC, 0xDD, 0xF9, 0x7C, 0x34, 0x36, 0xEF, 0x43, 0x2B, 0xFC, 0xAF, 0xB2, 0xE2, 0xA1,
+    0xE5, 0x9F, 0x8C, 0xB5, 0x75, 0x08, 0xB5, 0x25, 0x01, 0x29, 0xAD, 0x58, 0x0E, 0xAA, 0x75, 0x6B,
+    0xA1, 0xD1, 0x2D, 0xA8, 0xF5, 0x11, 0x99, 0xC2, 0xA5, 0x0B, 0x78, 0x7C, 0x64, 0xBB, 0x74, 0x96,
+    0x0E, 0x37, 0xA9, 0xD0, 0xD7, 0x4E, 0x09, 0x00, 0xB6, 0xE5, 0xF3, 0x8C, 0x68, 0x6B, 0x87, 0x42,
+    0xF7, 0x07, 0x2D, 0xC6, 0x5D, 0xB7, 0xCA, 0x5C, 0x86, 0x2D, 0xE9, 0x11, 0xCD, 0x14, 0x29, 0xC4,
+    0x4A, 0x32, 0xC6, 0x26, 0x5D, 0x9D, 0xEA, 0xC4, 0x03, 0x95, 0x9E, 0xC3, 0x89, 0x5A, 0x0A, 0x98,
+    0xCA, 0x34, 0xF5, 0x86, 0x57, 0x2A, 0x02, 0xBF, 0xAA, 0x5D, 0x90, 0x36, 0xAB, 0x48, 0xDA, 0x05,
+    0x11, 0xE0, 0x4D, 0x87, 0xBC, 0x76, 0x92, 0xDE, 0x4A, 0x0C, 0xAB, 0x8B, 0x2B, 0x9C, 0xC2, 0x3C,
+    0x9C, 0x3B, 0x77, 0x58, 0x0F, 0x3A, 0x61, 0x6D, 0x8B, 0xD4, 0x6D, 0x30, 0x23, 0xF8, 0x50, 0xD6,
+    0xF3, 0xBD, 0x92, 0x89, 0x3E, 0x48, 0xCF, 0x1C, 0x0A, 0xA3, 0x5F, 0xD4, 0xE8, 0x44, 0x15, 0x51,
+    0xA0, 0x1B, 0x9D, 0x28, 0x4D, 0x81, 0xA0, 0x77, 0xA2, 0x08, 0xD6, 0x51, 0xEE, 0x52, 0x5A, 0xFD,
+    0xE7, 0xFC, 0xB3, 0xD1, 0x4D, 0x8C, 0x16, 0x50, 0x1D, 0x2A, 0x64, 0xF3, 0x43, 0xBC, 0xD4, 0xEC,
+    0x2C, 0x07, 0xB8, 0xE2, 0xAD, 0x4F, 0x37, 0x6E, 0xAD, 0xB9, 0x66, 0xDC, 0x5A, 0xAA, 0xC7, 0xAD,
+    0x4E, 0x50, 0xAD, 0xF5, 0x0E, 0xE5, 0xD2, 0x6C, 0x90, 0xDF, 0x4E, 0xB2, 0x08, 0xF1, 0xE8, 0x44,
+    0x13, 0xF1, 0x39, 0x1F, 0xF7, 0x8B, 0x8B, 0x23, 0x42, 0xB2, 0xA3, 0xDF, 0xCE, 0xA1, 0xC3, 0xD2,
+    0xA8, 0x25, 0x8F, 0xB5, 0x46, 0x8A, 0xCD, 0x69, 0xC1, 0x6D, 0x85, 0xF4, 0x27, 0x43, 0xCC, 0x74,
+    0x3E, 0x87, 0xF9, 0x70, 0x9E, 0xDF, 0x74, 0xF1, 0x2B, 0x48, 0x4A, 0xF9, 0x05, 0xCB, 0xB2, 0x00,
+    0xB8, 0xB9, 0x0A, 0x7E, 0x6D, 0x92, 0x45, 0xF6, 0xB1, 0x09, 0xF5, 0x92, 0x25, 0x3D, 0xAD, 0xE4,
+    0x43, 0xDD, 0x6C, 0xAC, 0x00, 0x61, 0xA9, 0xA5, 0xDB, 0x74, 0x26, 0xF1, 0xFD, 0x9A, 0xFC, 0xEB,
+    0xF6, 0xB6, 0xB2, 0xEF, 0x5E, 0x1B, 0x69, 0xC9, 0x4E, 0xA7, 0x13, 0xA9, 0x19, 0x96, 0x4A, 0x7A,
+    0x8E, 0xCA, 0x84, 0xDF, 0x5F, 0x3B, 0x5D, 0x8A, 0xE3, 0x89, 0x5C, 0x93, 0xA5, 0x8B, 0x93, 0x7E,
+    0x39, 0xB5, 0xA0, 0x51, 0x4F, 0xA7, 0x91, 0x41, 0xA3, 0xF9, 0x4C, 0x4F, 0x1D, 0x5E, 0xE4, 0xE9,
+    0x94, 0x7C, 0xAF, 0x83, 0xB0, 0x9C, 0x82, 0xAC, 0xEE, 0x2C, 0xD5, 0xEA, 0x5F, 0xFA, 0x90, 0xCD,
+    0x73, 0xB7, 0x14, 0xF6, 0x4C, 0xB1, 0x1D, 0x9B, 0x03, 0xA9, 0xF5, 0xA9, 0xA6, 0x70, 0x4A, 0x3B,
+    0xD7, 0xB8, 0x70, 0xBC, 0x29, 0x9E, 0xDF, 0x84, 0xD7, 0xF3, 0x2D, 0xD0, 0x8D, 0xCE, 0x28, 0x8A,
+    0x4D, 0x48, 0xA0, 0x6F, 0x65, 0xC6, 0x70, 0xA4, 0xD8, 0xF0, 0x5B, 0xAE, 0x15, 0x84, 0xB3, 0xFD,
+    0xF8, 0xBA, 0xB1, 0xB0, 0x44, 0x4A, 0x13, 0xD0, 0x42, 0xB7, 0xE0, 0x16, 0xFC, 0x46, 0xBD, 0x51,
+    0x46, 0x9C, 0xDA, 0x4A, 0xFF, 0x4B, 0x21, 0x0A, 0x4D, 0x85, 0x9E, 0x7E, 0x59, 0x2D, 0x5A, 0x4A,
+    0xFD, 0xB5, 0x34, 0xD2, 0xE9, 0x8E, 0x42, 0x97, 0x44, 0x08, 0x43, 0x9D, 0x0A, 0x9C, 0xE6, 0x42,
+    0x63, 0x52, 0xC9, 0x7F, 0xBC, 0xBD, 0x92, 0x12, 0x3B, 0x57, 0x2C, 0xBF, 0xEB, 0x5C, 0xB5, 0x7C,
+    0x59, 0xB9, 0x7C, 0x59, 0xBD, 0x7C, 0x59, 0xC1, 0x7C, 0x59, 0x80, 0x7C, 0xB9, 0x2C, 0x5C, 0x2E,
+    0x0D, 0xAF, 0xFE, 0xB6, 0xFD, 0xE2, 0x62, 0xD8, 0x4E, 0x24, 0xE1, 0x38, 0xDB, 0x1F, 0x53, 0x69,
+    0x47, 0x01, 0x97, 0xFE, 0x5A, 0xED, 0x6D, 0xFB, 0x1D, 0xDB, 0x57, 0xC0, 0xE8, 0xF9, 0xE9, 0xDB,
+    0x0A, 0xD3, 0x9F, 0xB6, 0x42, 0xA6, 0x4B, 0x3D, 0xFA, 0xF4, 0xA3, 0xB6, 0x61, 0x40, 0xA1, 0xB1,
+    0xB4, 0x3D, 0x03, 0x9C, 0xE8, 0x36, 0x86, 0xBD, 0x65, 0xD8, 0xEF, 0x98, 0x88, 0x46, 0x73, 0x94,
+    0xF4, 0xBE, 0x4B, 0x92, 0xE6, 0x74, 0xA5, 0x7A, 0xEE, 0x15, 0x0C, 0x13, 0xCE, 0x4B, 0xD5, 0xB1,
+    0x56, 0xE1, 0xCE, 0x4F, 0xD8, 0x6A, 0xC5, 0xB1, 0x5C, 0x1D, 0xEB, 0xD5, 0x79, 0xC1, 0xBA, 0x5C,
+    0xB1, 0xCE, 0x4B, 0xD6, 0xB9, 0x9A, 0xCD, 0x16, 0x59, 0xC0, 0xEF, 0xE7, 0x54, 0xB4, 0x0D, 0xB3,
+    0x23, 0x84, 0x28, 0xA4, 0x3B, 0x56, 0xB2, 0xBC, 0x59, 0x1C, 0x52, 0x68, 0x34, 0xD3, 0xE7, 0x6D,
+    0x23, 0x01, 0x5B, 0xBC, 0x92, 0x06, 0x76, 0x76, 0x3C, 0x51, 0x5F, 0x7D, 0xA2, 0xD2, 0x73, 0x34,
+    0xBA, 0x49, 0x6D, 0x38, 0xD6, 0x98, 0x4B, 0x2A, 0xD3, 0x0E, 0x25, 0x61, 0x48, 0x0B, 0xD3, 0xEB,
+    0x12, 0x8A, 0xCB, 0x15, 0xFA, 0x50, 0x1A, 0xC3, 0xC3, 0xD5, 0x2D, 0x61, 0x53, 0x75, 0xDA, 0x2B,
+    0x37, 0x83, 0xB5, 0x52, 0xF7, 0xA7, 0x18, 0xA4, 0xB1, 0x54, 0x3F, 0x48, 0xA3, 0xD3, 0xD8, 0x69,
+    0xA3, 0xD1, 0x98, 0x29, 0xD0, 0x19, 0x6A, 0xA4, 0x17, 0x7A, 0xDB, 0xBC, 0x08, 0x6C, 0x9F, 0xBE,
+    0x84, 0x1B, 0xA1, 0xE0, 0x4C, 0x0E, 0xA5, 0x09, 0x80, 0x5E, 0x32, 0xA8, 0xCA, 0x4E, 0x2F, 0xB5,
+    0x4A, 0x0A, 0x5E, 0x15, 0x8C, 0xBE, 0x1B, 0x6C, 0xEF, 0xA6, 0x90, 0x42, 0x4E, 0x77, 0xE0, 0xB6,
+    0x93, 0x09, 0xA7, 0xA4, 0x81, 0x60, 0xAB, 0xF8, 0xB0, 0x63, 0xFA, 0x29, 0x7D, 0x23, 0x8D, 0xB5,
+    0xE6, 0x41, 0x1A, 0x2B, 0xAD, 0x46, 0xE7, 0xDD, 0xCE, 0xFA, 0x29, 0x07, 0x2C, 0xE4, 0xB9, 0xDA,
+    0x12, 0x16, 0x23, 0x92, 0x96, 0xE5, 0x2B, 0xF7, 0xD7, 0x8F, 0xC0, 0xF5, 0xCD, 0xFC, 0x38, 0xF9,
+    0xC5, 0xE0, 0x92, 0xA4, 0x8C, 0x97, 0x7E, 0x20, 0xAD, 0x67, 0xF9, 0xC5, 0x4A, 0xBD, 0xA9, 0xEF,
+    0xED, 0x69, 0xBA, 0xAC, 0xC9, 0xFD, 0x30, 0x09, 0x25, 0xD9, 0xCB, 0x56, 0xC4, 0x19, 0x90, 0xBD,
+    0xEC, 0x76, 0x7B, 0x59, 0xCF, 0xA8, 0xC7, 0x47, 0x17, 0xED, 0xD3, 0x1A, 0xBB, 0x95, 0x42, 0xDF,
+    0x88, 0x26, 0xC0, 0xA4, 0xB1, 0x54, 0x8F, 0x57, 0xB4, 0x2F, 0x37, 0x7D, 0xC1, 0x42, 0x31, 0xE9,
+    0x33, 0x8D, 0x94, 0x0F, 0xFD, 0x76, 0xB7, 0x52, 0x69, 0x22, 0xD7, 0x92, 0x4B, 0x31, 0x33, 0xA7,
+    0xED, 0xEA, 0x99, 0x9F, 0x81, 0x83, 0x2C, 0xE2, 0xCD, 0xA6, 0x75, 0x3D, 0x14, 0x3B, 0x66, 0x2C,
+    0xFF, 0xCC, 0xF0, 0x6E, 0x03, 0xF5, 0x9A, 0x64, 0xEE, 0x4E, 0x8F, 0x1C, 0x28, 0x49, 0x68, 0xA7,
+    0x53, 0x1C, 0xA4, 0x7E, 0x50, 0xF4, 0x86, 0xB4, 0x15, 0x0A, 0x14, 0x26, 0x0D, 0x56, 0xEE, 0xA0,
+    0x15, 0x67, 0xBB, 0x6F, 0xA5, 0x2D, 0xCF, 0x1A, 0x0B, 0x77, 0xFD, 0x04, 0x95, 0x18, 0x46, 0xA3,
+    0x6F, 0xB7, 0x90, 0xEB, 0x6B, 0xE6, 0xA3, 0x7C, 0xDB, 0xF6, 0x47, 0xFA, 0x51, 0x72, 0x24, 0x02,
+    0x49, 0xC0, 0xFC, 0x32, 0x31, 0x91, 0x34, 0xA6, 0x52, 0x39, 0xA5, 0x15, 0x86, 0xFF, 0x6B, 0xAB,
+    0xBE, 0x8C, 0xB5, 0x6D, 0x7F, 0x98, 0xFC, 0xEA, 0x84, 0xC5, 0xEB, 0xAA, 0xEA, 0x94, 0x51, 0xDC,
+    0x92, 0xFA, 0xD6, 0x2D, 0x8B, 0xF6, 0x5F, 0x36, 0x54, 0xE4, 0x9E, 0x74, 0x2F, 0x97, 0xD6, 0x43,
+    0x7C, 0xCB, 0x47, 0x52, 0x01, 0x28, 0xCD, 0x86, 0x6D, 0x60, 0xD2, 0xA2, 0x40, 0x6E, 0xBB, 0x64,
+    0xFC, 0xE2, 0x5F, 0xAC, 0x74, 0xFF, 0x62, 0x48, 0x4A, 0xA4, 0xD2, 0x8B, 0x76, 0xF7, 0xB2, 0x92,
+    0x54, 0xE7, 0xA1, 0x6F, 0xC9, 0xE1, 0xC7, 0x5A, 0x07, 0x9B, 0xE4, 0x48, 0x92, 0x25, 0xC1, 0x8A,
+    0x90, 0xD2, 0x9E, 0x57, 0xC9, 0x59, 0x7D, 0x40, 0x52, 0xF3, 0x63, 0x47, 0xD2, 0xA8, 0x5E, 0x0F,
+    0x59, 0x57, 0xBF, 0x1C, 0x95, 0x0B, 0xF5, 0xF8, 0x0A, 0x07, 0xF6, 0x97, 0xA5, 0x5C, 0x9E, 0xB5,
+    0xD8, 0x4A, 0x9F, 0x34, 0x25, 0x4D, 0xED, 0xF3, 0x89, 0x24, 0xB3, 0xD5, 0x9B, 0xA2, 0xE4, 0xED,
+    0xB4, 0xBB, 0xF2, 0x47, 0x75, 0xFF, 0x0B, 0x07, 0x04, 0x7D, 0x6C, 0xC9, 0x99, 0xDD, 0x24, 0xD3,
+    0x37, 0x15, 0x29, 0x65, 0x32, 0x50, 0xB6, 0x47, 0x94, 0xB4, 0x64, 0xDA, 0x4A, 0xCD, 0xA5, 0xC6,
+    0x4A, 0x63, 0x52, 0x86, 0x5C, 0xF1, 0xD1, 0x14, 0x23, 0x4B, 0xF5, 0x85, 0xA6, 0x7A, 0xC7, 0xA9,
+    0xED, 0x56, 0xFC, 0x76, 0xE5, 0x69, 0x7B, 0x77, 0x99, 0x14, 0xC1, 0x76, 0x34, 0x4B, 0x4B, 0x71,
+    0xE5, 0x57, 0x87, 0x70, 0xB6, 0xB1, 0x4D, 0x3C, 0x40, 0xC6, 0xD7, 0x4B, 0x29, 0x65, 0x04, 0xA9,
+    0xAA, 0xAF, 0x3F, 0x03, 0xA5, 0xFE, 0xC8, 0xD6, 0xB9, 0x98, 0xD8, 0xEA, 0xC5, 0x7E, 0xA8, 0x1E,
+    0x3C, 0x65, 0x44, 0x99, 0x87, 0x6E, 0xDD, 0x21, 0x04, 0xF2, 0x8C, 0x24, 0x65, 0xBA, 0x7F, 0x27,
+    0x16, 0x1A, 0xEB, 0xE0, 0x44, 0xD7, 0xFB, 0xC8, 0x8E, 0x42, 0xB1, 0x14, 0x1A, 0x5F, 0x6F, 0x1B,
+    0x01, 0x3F, 0xB8, 0xB9, 0xC2, 0x23, 0x9E, 0x1A, 0xB4, 0x51, 0xA5, 0xAA, 0xA9, 0x19, 0xB8, 0xD1,
+    0x5A, 0x6B, 0x57, 0xD2, 0xC6, 0x20, 0xC5, 0x4A, 0x6D, 0xB7, 0xF8, 0x40, 0x77, 0x57, 0x3D, 0x9B,
+    0xDB, 0xC8, 0x5A, 0x1F, 0x20, 0xD3, 0xF3, 0x43, 0x5B, 0xA5, 0x52, 0xFD, 0x85, 0x41, 0xEA, 0x73,
+    0x03, 0x9B, 0xFA, 0x2B, 0x7B, 0x06, 0xFC, 0x6E, 0xA7, 0xE7, 0x07, 0xDB, 0x33, 0x40, 0xC6, 0x3F,
+    0xDF, 0x5B, 0xDB, 0xCB, 0xF7, 0x17, 0x4B, 0xCE, 0xBE, 0x06, 0xCD, 0x6A, 0xDB, 0xF3, 0x4C, 0x99,
+    0x02, 0x7E, 0x25, 0xFF, 0xFC, 0x03, 0x52, 0xCC, 0x48, 0xA3, 0x37, 0xC5, 0xB8, 0x9F, 0x52, 0xBE,
+    0xCF, 0x89, 0x46, 0x9B, 0x97, 0xBE, 0x21, 0xCD, 0x97, 0x90, 0x92, 0x76, 0xB7, 0x27, 0x41, 0xDF,
+    0x07, 0x7F, 0xC0, 0x9B, 0x1A, 0xE2, 0x13, 0x3F, 0x6B, 0x08, 0x50, 0x49, 0xEF, 0x36, 0x5A, 0x64,
+    0x0F, 0x6F, 0x00, 0x8D, 0x68, 0xC5, 0x0B, 0x67, 0x9B, 0x0E, 0x3D, 0xDE, 0x5F, 0xE5, 0x03, 0x2C,
+    0xA5, 0xB6, 0x5C, 0x6A, 0x1B, 0x4D, 0x74, 0x0B, 0xF5, 0x46, 0xA9, 0x36, 0xFB, 0xE9, 0x1E, 0xA4,
+    0x34, 0xB4, 0x8F, 0xA9, 0x22, 0xC7, 0xA9, 0x6F, 0x34, 0x7A, 0x4D, 0x95, 0x46, 0x9E, 0x32, 0x09,
+    0x97, 0x54, 0x50, 0x25, 0x71, 0xDE, 0x69, 0x31, 0x1B, 0xFE, 0x93, 0x79, 0x86, 0x31, 0x6D, 0x87,
+    0x3E, 0x9A, 0xFF, 0xB3, 0xA6, 0x87, 0xBD, 0xCD, 0xC7, 0xC5, 0x49, 0x1B, 0x74, 0xAD, 0xA4, 0x85,
+    0x2A, 0x38, 0x7D, 0x50, 0x23, 0x42, 0x73, 0xBD, 0xE1, 0x82, 0xDB, 0xD1, 0x94, 0xED, 0x68, 0x76,
+    0xFB, 0x1B, 0xFD, 0xE8, 0x76, 0xF4, 0xED, 0x17, 0x23, 0x9A, 0xDD, 0xD6, 0xA9, 0x75, 0x7B, 0xA1,
+    0xAF, 0x2B, 0x94, 0x92, 0x96, 0x61, 0x43, 0xD2, 0x56, 0xA8, 0x75, 0xD2, 0x76, 0xCE, 0xF4, 0x75,
+    0x5A, 0x9D, 0x05, 0xB1, 0x6B, 0x92, 0xA1, 0x59, 0x6A, 0x6D, 0x50, 0x5A, 0x1A, 0x9D, 0x42, 0x7D,
+    0x66, 0x5E, 0xD7, 0x23, 0xEE, 0x9F, 0xFF, 0xFC, 0xE1, 0xB1, 0x8E, 0xE9, 0x3E, 0x14, 0x92, 0xF4,
+    0xFD, 0x61, 0x2D, 0xF4, 0xFC, 0x17, 0x35, 0x36, 0xD1, 0xDE, 0x5F, 0xA7, 0x7B, 0xF7, 0xD0, 0xE3,
+    0xE3, 0xF5, 0x6E, 0x6D, 0xB4, 0x54, 0xB6, 0xC7, 0x49, 0xAC, 0x25, 0x8D, 0x83, 0xD6, 0x26, 0x15,
+    0x4B, 0xA6, 0x15, 0xF7, 0xA7, 0x54, 0xC8, 0xBD, 0x4D, 0x6E, 0xED, 0x6D, 0x06, 0x2D, 0xE9, 0x18,
+    0xD7, 0x89, 0x5F, 0xDB, 0xDE, 0x80, 0xCC, 0x68, 0x18, 0xDD, 0x8F, 0xA4, 0x29, 0xD9, 0x34, 0xD3,
+    0x25, 0x37, 0xA3, 0x96, 0x54, 0x8C, 0x5F, 0x43, 0x85, 0xDC, 0xA3, 0x2C, 0xD0, 0x6A, 0x19, 0x4C,
+    0x7C, 0xAD, 0x9B, 0xCE, 0x0B, 0xB0, 0x15, 0xB8, 0x29, 0xE9, 0x5E, 0x00, 0xC5, 0x23, 0x3C, 0x29,
+    0x3A, 0x2D, 0xE8, 0x93, 0xD2, 0xE4, 0x54, 0x4A, 0x0C, 0x5B, 0xA6, 0xB9, 0xD4, 0x52, 0xA8, 0xF7,
+    0x2F, 0xF5, 0x6E, 0xCF, 0x04, 0x7E, 0x75, 0x01, 0x34, 0x0F, 0x3D, 0x85, 0xFE, 0x2C, 0x1E, 0x3B,
+    0x33, 0x99, 0xDF, 0xA2, 0xEF, 0x6B, 0xA6, 0xD0, 0x27, 0x34, 0xE2, 0xF6, 0x42, 0x23, 0x7E, 0xAD,
+    0xD4, 0xA3, 0xD9, 0xC9, 0x8A, 0xF7, 0x18, 0x34, 0x79, 0x55, 0x52, 0xEF, 0xD5, 0x68, 0x4B, 0xDA,
+    0xD2, 0xBF, 0xD3, 0xA6, 0x4D, 0x2E, 0x79, 0x3B, 0xE7, 0xAD, 0x53, 0x92, 0x20, 0x43, 0xA2, 0xD1,
+    0x35, 0xEB, 0x15, 0x69, 0x12, 0x37, 0xF1, 0x48, 0x93, 0x9B, 0x06, 0xDB, 0x52, 0x49, 0x8D, 0xB6,
+    0x42, 0x7A, 0x46, 0x42, 0x9A, 0xEB, 0xDD, 0xEA, 0xD9, 0x7A, 0x34, 0xA1, 0x19, 0x2D, 0xF8, 0x15,
+    0x6D, 0xB8, 0x1D, 0xA9, 0x2D, 0xF4, 0x09, 0x69, 0x42, 0x7F, 0x2D, 0xBF, 0xE0, 0xEF, 0xC9, 0x6D,
+    0x38, 0xA9, 0x50, 0x5B, 0x48, 0x68, 0x42, 0x3B, 0x7E, 0xC1, 0xEF, 0xB8, 0x0D, 0xB7, 0x53, 0xA8,
+    0xB5, 0xAF, 0xAA, 0xB4, 0x66, 0xD2, 0x67, 0xA4, 0x5E, 0xFA, 0xA1, 0x34, 0x79, 0xF3, 0xDD, 0x5B,
+    0x28, 0x43, 0x6E, 0xE5, 0x25, 0x6A, 0x41, 0xBD, 0x9F, 0xA0, 0x59, 0xBC, 0xD1, 0x8E, 0x96, 0x4B,
+    0xAF, 0xED, 0xF7, 0xDA, 0x57, 0xE4, 0xFF, 0x97, 0x5A, 0x8B, 0x14, 0x2B, 0xED, 0x5E, 0x7B, 0xA6,
+    0x3D, 0x53, 0xA4, 0xDA, 0x6D, 0x27, 0x54, 0x0A, 0x8D, 0x99, 0x7A, 0x86, 0x95, 0x61, 0xA4, 0x16,
+    0x7E, 0xA6, 0xD0, 0x58, 0x07, 0xE8, 0x16, 0x17, 0xC1, 0xA8, 0x12, 0x99, 0xEE, 0x0A, 0xF0, 0x8B,
+    0x5A, 0xA8, 0x52, 0x2E, 0xDA, 0xB2, 0x68, 0x69, 0x07, 0xBE, 0x95, 0x23, 0xA9, 0x75, 0x56, 0x7B,
+    0x6A, 0x2F, 0x1D, 0x94, 0x6E, 0x84, 0xC7, 0xE8, 0x66, 0x70, 0xED, 0x10, 0xA0, 0x94, 0x51, 0x03,
+    0xB4, 0x70, 0x6C, 0x06, 0x6B, 0x75, 0xEE, 0x99, 0x95, 0x0A, 0x74, 0x5A, 0x6B, 0xED, 0x83, 0x62,
+    0xA3, 0xBD, 0xD3, 0xD2, 0x68, 0x2B, 0x35, 0x16, 0x9A, 0x4C, 0xB1, 0xE2, 0xB5, 0x38, 0xFE, 0xD5,
+    0x07, 0x52, 0x18, 0x69, 0x50, 0x9C, 0x86, 0x54, 0xB8, 0x68, 0x83, 0xC2, 0xD2, 0xD7, 0x36, 0xE2,
+    0x6D, 0x43, 0x9A, 0xB4, 0x05, 0xFA, 0x7C, 0x59, 0xCC, 0x49, 0x6B, 0x49, 0x7C, 0xCB, 0xD9, 0x5A,
+    0xE6, 0xC9, 0xC2, 0x91, 0x5B, 0x76, 0xE9, 0x7E, 0x05, 0x4E, 0x27, 0x7D, 0xFF, 0xF4, 0xA4, 0x45,
+    0xA1, 0xC1, 0xBC, 0xB9, 0xD1, 0x7E, 0x31, 0xDF, 0xD1, 0x5C, 0xC6, 0x2A, 0x14, 0xEA, 0x5D, 0x68,
+    0x46, 0xB7, 0xE3, 0xC7, 0x0E, 0xBF, 0xB2, 0xF1, 0x07, 0x68, 0xCE, 0x6F, 0x9F, 0x63, 0x36, 0x27,
+    0x7D, 0xCE, 0x42, 0xCB, 0xB4, 0xE5, 0xED, 0x0E, 0x85, 0x5E, 0xD0, 0x06, 0x6E, 0x67, 0x88, 0xE0,
+    0x57, 0x86, 0x05, 0x34, 0x67, 0x56, 0x4D, 0x59, 0x58, 0x4D, 0x6B, 0x9D, 0x6A, 0x30, 0x03, 0x58,
+    0x2E, 0xBC, 0xD4, 0x0B, 0x8A, 0xC7, 0x2E, 0x75, 0xB5, 0x05, 0xC2, 0xDD, 0x03, 0xF6, 0xEA, 0xDA,
+    0x9D, 0xF6, 0x20, 0x6F, 0xD6, 0x29, 0xD3, 0x36, 0x9F, 0x3D, 0x9B, 0x64, 0xE3, 0x6D, 0x8B, 0x2F,
+    0xD3, 0xAD, 0x4D, 0x39, 0xBB, 0xE8, 0x5E, 0xEA, 0xEE, 0x7D, 0x30, 0xF8, 0x5E, 0x73, 0x3D, 0x7E,
+    0xB5, 0x50, 0xEF, 0x59, 0xDC, 0xCE, 0xE7, 0x8E, 0x12, 0x59, 0x7D, 0xFF, 0x26, 0x97, 0xFB, 0xAE,
+    0xA9, 0xC5, 0xEF, 0x77, 0x84, 0x2D, 0x07, 0x85, 0x7A, 0xBF, 0xE2, 0x76, 0xD3, 0x7C, 0x2D, 0xD4,
+    0xA2, 0xD9, 0xDB, 0x7E, 0x80, 0x53, 0x21, 0x69, 0xC3, 0xBD, 0x62, 0x4F, 0xC0, 0x9F, 0xAB, 0x90,
+    0x3E, 0xB7, 0x42, 0x7A, 0x1E, 0x59, 0x48, 0xDF, 0xD9, 0x06, 0x59, 0x7A, 0xF8, 0x6E, 0x3B, 0x9D,
+    0x4E, 0xE7, 0x7A, 0x7A, 0x6F, 0x49, 0x57, 0xBF, 0x03, 0xC3, 0xAB, 0x17, 0xD2, 0xD7, 0x22, 0x97,
+    0x2E, 0x1E, 0x2A, 0xA4, 0x1F, 0x2F, 0x09, 0xEC, 0x89, 0xF5, 0x7B, 0xAD, 0x4D, 0xEB, 0x41, 0x29,
+    0xF3, 0xC4, 0x34, 0x97, 0x6A, 0x87, 0x58, 0x88, 0x4A, 0x9F, 0x54, 0x8F, 0x82, 0x46, 0xEA, 0xCD,
+    0x07, 0x0A, 0x7D, 0x68, 0x3B, 0x9D, 0xF4, 0x82, 0x24, 0xDD, 0xB7, 0x81, 0xFB, 0xD2, 0xE9, 0x03,
+    0xBA, 0x15, 0x41, 0xCF, 0xA8, 0xA5, 0x0B, 0x9A, 0x69, 0x56, 0xBF, 0xE1, 0x62, 0xA9, 0xA9, 0xDE,
+    0x6D, 0xAF, 0x09, 0x83, 0x7A, 0x3B, 0xAD, 0xC0, 0xEF, 0xDD, 0x7C, 0x58, 0x7C, 0x72, 0xE9, 0x4C,
+    0xD4, 0xE5, 0x19, 0xE3, 0xF6, 0x6E, 0x8D, 0xE1, 0xB6, 0x93, 0x57, 0x8B, 0x53, 0xCC, 0xB4, 0x92,
+    0xE9, 0x6F, 0x47, 0xA7, 0x11, 0xBF, 0xC2, 0x60, 0xB4, 0xAC, 0x52, 0x33, 0x5D, 0x00, 0x2F, 0xAA,
+    0xCD, 0x40, 0x25, 0xF3, 0x2F, 0x5B, 0xB7, 0x02, 0x43, 0xCC, 0x2D, 0xCF, 0x3D, 0xFA, 0x00, 0xF8,
+    0xAD, 0xD8, 0x0D, 0x5C, 0xEF, 0x26, 0xC0, 0x29, 0x09, 0x23, 0x2E, 0xB6, 0x0F, 0x83, 0x3E, 0xBB,
+    0x24, 0x1C, 0x85, 0xCB, 0x00, 0x0E, 0x97, 0xE8, 0xDF, 0xC3, 0xB1, 0x69, 0x77, 0x2A, 0xB7, 0x16,
+    0x57, 0x81, 0xFA, 0x57, 0x12, 0xA9, 0xDE, 0x58, 0x48, 0x0B, 0xCD, 0xE2, 0xA5, 0xB6, 0xD2, 0xD3,
+    0xD2, 0x9C, 0x69, 0x2B, 0x15, 0xF0, 0x1A, 0x1B, 0x51, 0x98, 0x44, 0xF0, 0xF0, 0xAD, 0xB6, 0x52,
+    0xEF, 0x56, 0xE8, 0x62, 0xA6, 0x96, 0x42, 0x63, 0x13, 0xA0, 0xDE, 0x0A, 0x83, 0x25, 0xBA, 0x11,
+    0x2A, 0x55, 0x16, 0x15, 0xD9, 0xCE, 0xC8, 0x7F, 0x3E, 0x03, 0x6E, 0xB7, 0xDD, 0x95, 0x6D, 0x9B,
+    0x6A, 0x3B, 0x27, 0xAF, 0x2B, 0xA4, 0xC0, 0x57, 0x9E, 0x10, 0xE4, 0x69, 0xA3, 0x07, 0x17, 0x2C,
+    0x2E, 0xF3, 0xB3, 0x4B, 0x33, 0xC2, 0x90, 0x08, 0x9D, 0xF7, 0xC4, 0xB6, 0x25, 0xE8, 0xDA, 0xCD,
+    0xDF, 0x20, 0x40, 0xE2, 0xA5, 0x03, 0x90, 0xB8, 0x65, 0x67, 0xBE, 0x3D, 0x00, 0x48, 0x1C, 0xB0,
+    0xDA, 0xA1, 0x93, 0xD4, 0xCD, 0x0F, 0xA8, 0x85, 0xB9, 0xC4, 0x15, 0xF0, 0xFD, 0x81, 0x5D, 0xD8,
+    0xCB, 0x06, 0xF6, 0xB4, 0x50, 0x2C, 0x59, 0xB4, 0x9D, 0xC1, 0x7B, 0x18, 0x46, 0x3F, 0x43, 0xBD,
+    0x36, 0xA6, 0x64, 0xB4, 0x9E, 0x03, 0xC7, 0xAB, 0xE3, 0x3E, 0x89, 0x94, 0xA9, 0x95, 0xFE, 0xC6,
+    0x96, 0xD7, 0x41, 0xC1, 0x69, 0xCB, 0x34, 0xD3, 0x2D, 0xF8, 0x85, 0x3A, 0xE2, 0x36, 0x6A, 0x51,
+    0xA8, 0xAD, 0x35, 0xA2, 0xA9, 0x56, 0xC0, 0x2F, 0xB5, 0x22, 0x6E, 0xAB, 0x7F, 0x24, 0x0A, 0x7D,
+    0xE8, 0xAF, 0x35, 0x22, 0xCD, 0x5D, 0xC0, 0x6B, 0xAE, 0x23, 0x4E, 0x73, 0x29, 0x0A, 0xCD, 0x99,
+    0x46, 0x6C, 0x76, 0xF8, 0x85, 0x7A, 0x63, 0x50, 0x5F, 0x6B, 0x1B, 0xB4, 0x38, 0x69, 0x50, 0x3C,
+    0x36, 0xB0, 0xEF, 0xAE, 0x90, 0xA4, 0x6C, 0x3A, 0xE4, 0xDB, 0x95, 0x82, 0x40, 0x7F, 0x48, 0x8B,
+    0xFD, 0x64, 0x11, 0xCA, 0xEA, 0x48, 0x65, 0x58, 0x09, 0xFE, 0xF2, 0x90, 0x36, 0xA5, 0x9E, 0xB7,
+    0x42, 0xFA, 0x25, 0xB1, 0x93, 0x9D, 0x6D, 0x70, 0x1C, 0x33, 0x9B, 0x08, 0x0A, 0x67, 0x05, 0xA2,
+    0x52, 0xAD, 0x8F, 0xD4, 0x97, 0x0A, 0x44, 0x86, 0xD2, 0x76, 0x3B, 0xC3, 0x7E, 0x27, 0x2D, 0x5D,
+    0xF9, 0x01, 0xB7, 0x9E, 0xA1, 0xD6, 0xEC, 0xCE, 0x98, 0xC8, 0x4A, 0x83, 0xC6, 0x24, 0xF7, 0x6D,
+    0xBC, 0xD9, 0xF3, 0xA1, 0x93, 0x82, 0x1D, 0xDE, 0xA2, 0xE7, 0x3F, 0x77, 0xE5, 0x85, 0xAB, 0x87,
+    0x17, 0xFE, 0x4B, 0x82, 0x0A, 0x25, 0x2D, 0xE8, 0xFB, 0x43, 0x44, 0x63, 0xB3, 0xA1, 0xD1, 0xED,
+    0x0F, 0x1C, 0xEA, 0x2D, 0xD3, 0xD8, 0xC5, 0x5A, 0xD2, 0xD2, 0x49, 0x9A, 0x2E, 0x57, 0xAF, 0xEC,
+    0x23, 0xBA, 0xDF, 0x96, 0x97, 0x3A, 0x8F, 0xA5, 0x4C, 0x1D, 0x26, 0xDC, 0xD2, 0x64, 0x57, 0xA2,
+    0x60, 0xBB, 0xD7, 0x3A, 0xD9, 0xC5, 0x1F, 0x7F, 0xFE, 0xB5, 0x66, 0xA7, 0xA6, 0x8B, 0x28, 0x48,
+    0xBD, 0xD3, 0x87, 0x6C, 0x77, 0xE2, 0x98, 0xC4, 0x24, 0x92, 0x18, 0xDD, 0xCD, 0xBA, 0x47, 0x81,
+    0x2F, 0xFD, 0x84, 0xF4, 0xDA, 0x74, 0x99, 0x5E, 0x9B, 0x4C, 0xF3, 0xA1, 0xE5, 0x5F, 0xEE, 0x95,
+    0xE6, 0x52, 0xF7, 0x0E, 0x1F, 0x20, 0xDC, 0x92, 0xA4, 0xA9, 0xD4, 0xDC, 0x68, 0xAC, 0x77, 0x1A,
+    0xD1, 0x2D, 0xF8, 0x98, 0x69, 0x42, 0x4B, 0xA9, 0xB6, 0xD0, 0x54, 0x6F, 0x54, 0x6A, 0xBB, 0x85,
+    0x66, 0xCB, 0x34, 0xA1, 0x50, 0xEA, 0x5D, 0xEF, 0xD6, 0x58, 0x6F, 0x8D, 0x13, 0xDD, 0xF2, 0x8E,
+    0x6E, 0xC9, 0x34, 0x0D, 0x1A, 0x4B, 0xFD, 0x55, 0xC2, 0x38, 0x66, 0x3A, 0xE9, 0xD8, 0xE0, 0xA8,
+    0xD4, 0xFF, 0xFD, 0x81, 0x99, 0x7A, 0xA3, 0x1A, 0xE9, 0x16, 0xFE, 0x71, 0x12, 0x7B, 0x36, 0xE0,
+    0xA8, 0x49, 0x7B, 0x7F, 0x59, 0xD9, 0x5F, 0x7F, 0x55, 0x08, 0xEA, 0xE6, 0x59, 0x7F, 0x71, 0x27,
+    0xED, 0xC0, 0x94, 0xEB, 0xC6, 0xE9, 0xF4, 0x81, 0x7D, 0x90, 0x25, 0xA5, 0xB4, 0x77, 0x92, 0xB6,
+    0x4C, 0xF7, 0x2F, 0xBE, 0x42, 0x82, 0x75, 0x5F, 0xFB, 0x43, 0xAE, 0x97, 0x52, 0xB6, 0x72, 0x38,
+    0x1F, 0x80, 0xD7, 0x1F, 0x86, 0xA0, 0x1E, 0xD3, 0xC6, 0x42, 0xFE, 0x99, 0x43, 0x3A, 0xF6, 0x19,
+    0x49, 0xB1, 0xD4, 0xF3, 0x5F, 0x1C, 0x7D, 0x4C, 0xF3, 0xE0, 0x67, 0xFE, 0xA3, 0x39, 0xB2, 0x7B,
+    0x83, 0xD4, 0xBF, 0x06, 0x19, 0xDB, 0x93, 0x5E, 0x7A, 0x92, 0x4A, 0xA6, 0x95, 0xA6, 0xC8, 0xB5,
+    0x5B, 0x3A, 0xB5, 0x7F, 0xBF, 0x8C, 0x6D, 0x7D, 0xD0, 0xAF, 0x62, 0x9D, 0xCE, 0xE6, 0x4E, 0x44,
+    0xA1, 0xB8, 0x3C, 0xAC, 0x28, 0xE4, 0x0B, 0x0A, 0xB4, 0x6F, 0xD1, 0xFD, 0xDB, 0x56, 0x2E, 0xF7,
+    0x16, 0xDD, 0xBF, 0xFD, 0xEA, 0xCD, 0x5D, 0x49, 0xB3, 0x49, 0x65, 0x35, 0xD2, 0x6C, 0x17, 0x6E,
+    0x4E, 0xDE, 0x5C, 0xA5, 0x79, 0x24, 0x69, 0x23, 0xD3, 0xFD, 0x2F, 0x9A, 0xAA, 0x9F, 0x9F, 0x70,
+    0xA2, 0x0A, 0x14, 0x1A, 0x33, 0x83, 0xEA, 0x3F, 0xFE, 0x0A, 0x5D, 0xD7, 0xD3, 0xD9, 0x5F, 0xF5,
+    0x97, 0xE9, 0xA1, 0x3E, 0x25, 0xF5, 0x15, 0x18, 0x6C, 0xA3, 0xD0, 0xB4, 0x21, 0xE9, 0x92, 0x52,
+    0x22, 0x0A, 0x94, 0xEA, 0x2D, 0xA9, 0xEF, 0x04, 0xDD, 0x5A, 0x69, 0xA2, 0xDE, 0x1B, 0x69, 0x2C,
+    0x75, 0x47, 0x0A, 0xB9, 0xE9, 0xB2, 0x24, 0x16, 0xEE, 0x7A, 0x49, 0x6F, 0x6F, 0xF6, 0x73, 0x95,
+    0xF5, 0x9B, 0x0E, 0xCE, 0x3F, 0x50, 0x9A, 0xDB, 0xF5, 0x96, 0xDB, 0x06, 0xA2, 0x19, 0xBF, 0x21,
+    0x6D, 0x36, 0xD3, 0xDD, 0x3B, 0x89, 0x42, 0x6D, 0x35, 0xE3, 0x17, 0x3E, 0x4E, 0xA1, 0x36, 0x6F,
+    0x0D, 0x09, 0x2D, 0xF4, 0x3F, 0xDF, 0x4C, 0xAC, 0x4D, 0x93, 0x97, 0xF1, 0xE6, 0x93, 0xF6, 0x9D,
+    0xF0, 0x0B, 0xC3, 0x5A, 0xA8, 0x2D, 0x34, 0xFA, 0xC5, 0x04, 0xC7, 0x73, 0xDD, 0x95, 0xDA, 0x26,
+    0x0E, 0x5A, 0x73, 0x7D, 0x5D, 0x6A, 0x13, 0x12, 0x38, 0x1E, 0x27, 0x69, 0x81, 0xF3, 0x30, 0x1F,
+    0xDC, 0xD8, 0x4A, 0x6D, 0xD2, 0xF0, 0x35, 0x0D, 0xA2, 0xFA, 0x39, 0xE0, 0x29, 0x5B, 0xEE, 0xAB,
+    0x99, 0x66, 0xC3, 0xD8, 0xF2, 0xA3, 0x89, 0x70, 0x46, 0x14, 0x2D, 0x11, 0xB2, 0xD3, 0x68, 0x2A,
+    0xB4, 0x19, 0x48, 0x15, 0x79, 0xEB, 0x10, 0x50, 0x60, 0x78, 0x79, 0x24, 0x53, 0xEB, 0x64, 0x94,
+    0xC6, 0x2A, 0xA2, 0x60, 0xBF, 0xE9, 0x27, 0x27, 0x3A, 0x43, 0xC5, 0x51, 0x30, 0x17, 0xC4, 0xAD,
+    0x4E, 0x47, 0xBD, 0xC0, 0x5F, 0xE9, 0x25, 0xAB, 0x19, 0x28, 0x12, 0xC4, 0x7C, 0xE4, 0x4E, 0x93,
+    0x3F, 0x76, 0x30, 0xE3, 0x72, 0x4D, 0x0A, 0x3E, 0xA5, 0xF3, 0x9D, 0x12, 0x81, 0x52, 0xAD, 0xF5,
+    0x54, 0xDA, 0x1E, 0x7C, 0x88, 0x40, 0xB7, 0xA1, 0x50, 0x68, 0x26, 0x6D, 0x27, 0xDE, 0xA8, 0xA5,
+    0xB0, 0x74, 0xA0, 0x22, 0x0C, 0xBB, 0xE1, 0x5D, 0xC1, 0xD2, 0x4C, 0xF7, 0xF0, 0xEA, 0x2B, 0x2D,
+    0x99, 0x14, 0x33, 0xED, 0xB9, 0xA9, 0xDA, 0x8C, 0xA5, 0x62, 0xA7, 0xBE, 0x94, 0x22, 0xB5, 0xC2,
+    0x47, 0x52, 0x10, 0x50, 0x5F, 0x6E, 0x0C, 0xD7, 0x9D, 0x39, 0x0C, 0xE5, 0xA5, 0xF3, 0xE5, 0xCF,
+    0x80, 0xDC, 0x95, 0xFD, 0xD0, 0x9B, 0xF3, 0x93, 0xD9, 0x25, 0x4F, 0xF2, 0xF5, 0xAD, 0x59, 0x3C,
+    0x6E, 0xD2, 0x4D, 0xA5, 0x76, 0x6B, 0xA8, 0x41, 0xB3, 0x13, 0x49, 0xFA, 0x3C, 0x38, 0xCD, 0xD5,
+    0x4E, 0x27, 0xFE, 0x54, 0x74, 0xB3, 0xDB, 0x7E, 0x9F, 0x6A, 0x2D, 0xF7, 0xA4, 0xA9, 0xD3, 0xCD,
+    0x7E, 0x84, 0x6C, 0x2F, 0xF7, 0x6A, 0x01, 0xAA, 0x7B, 0xC3, 0xF7, 0x95, 0xF4, 0xF6, 0xD2, 0x1C,
+    0x36, 0xCF, 0xBF, 0xD4, 0x07, 0xF7, 0x0F, 0x25, 0xF7, 0x72, 0x1E, 0x02, 0x34, 0x5B, 0xB9, 0x17,
+    0xEA, 0x29, 0x34, 0x76, 0x73, 0xB3, 0x81, 0x96, 0x72, 0x47, 0x81, 0x46, 0x74, 0x73, 0xA5, 0xB1,
+    0xD2, 0xD8, 0x68, 0xF2, 0x7B, 0xAE, 0xA5, 0xD2, 0x9E, 0x69, 0xF5, 0x3B, 0x83, 0xE6, 0x52, 0xB3,
+    0x11, 0x86, 0xAA, 0xE3, 0x7A, 0xBB, 0xE9, 0xA1, 0x6B, 0x3D, 0x2E, 0x3F, 0x3F, 0x9E, 0xA8, 0x0F,
+    0xD4, 0xF0, 0x4B, 0x67, 0x84, 0x72, 0x4A, 0x2B, 0xD4, 0x70, 0x30, 0x78, 0x36, 0x34, 0x15, 0x0A,
+    0x6E, 0xC1, 0x09, 0x81, 0x82, 0x9B, 0x71, 0xE2, 0xE3, 0x87, 0x5D, 0xDA, 0xCF, 0x63, 0x79, 0x08,
+    0x49, 0x9E, 0xAE, 0x3A, 0x80, 0x9A, 0x89, 0xEC, 0x22, 0x29, 0x0B, 0xC6, 0x33, 0xD5, 0xC9, 0x6F,
+    0xE5, 0x48, 0xA1, 0x6F, 0x6D, 0xE0, 0xA3, 0x0F, 0x94, 0x7A, 0x46, 0x23, 0x5A, 0x3B, 0xB5, 0x9D,
+    0x91, 0x6A, 0x47, 0xA7, 0x64, 0x77, 0x9E, 0x83, 0xEB, 0x77, 0x02, 0xA9, 0xAE, 0xDE, 0x2A, 0x5A,
+    0xFA, 0xA1, 0x4D, 0x32, 0x19, 0xB9, 0x4C, 0x11, 0x67, 0xBC, 0xDC, 0x11, 0x01, 0xF8, 0xFF, 0x01,
+    0xDD, 0xBD, 0x4D, 0xAC, 0x2E, 0xC7, 0x79, 0x26, 0xF6, 0x74, 0xD7, 0x3D, 0xA7, 0x2D, 0x36, 0xEC,
+    0xE2, 0x82, 0x47, 0xB1, 0x2F, 0x3D, 0xEA, 0x00, 0xC9, 0xC2, 0xD1, 0x48, 0xD3, 0x59, 0x78, 0xE1,
+    0x85, 0xE5, 0x6A, 0x8A, 0x08, 0xB8, 0xD0, 0x42, 0x27, 0xC9, 0x6D, 0x2A, 0x10, 0x17, 0x57, 0x08,
+    0x3C, 0x83, 0xD1, 0xCD, 0xCF, 0xF1, 0xC2, 0x0B, 0x01, 0xC9, 0xA8, 0x9A, 0xBC, 0x0B, 0x05, 0xD0,
+    0x42, 0x67, 0x41, 0x79, 0x80, 0x78, 0x61, 0x2D, 0xE8, 0x01, 0xF9, 0x31, 0xC8, 0xD5, 0x42, 0x0B,
+    0x23, 0x11, 0x4F, 0x15, 0x79, 0x81, 0x21, 0x10, 0x2E, 0xD8, 0x22, 0x23, 0x69, 0xA1, 0x85, 0xDA,
+    0x23, 0x6A, 0xE4, 0x21, 0x11, 0xB0, 0x44, 0x35, 0xC5, 0x3E, 0x97, 0xD5, 0xFD, 0x64, 0xF1, 0x56,
+    0x7F, 0xDF, 0x77, 0xEE, 0x3D, 0xA4, 0xFE, 0x28, 0x79, 0xEC, 0x43, 0xDE, 0xFE, 0xEF, 0xFE, 0xAA,
+    0xDE, 0xAA, 0x7A, 0xEB, 0xFD, 0x79, 0xDE, 0xB7, 0x80, 0x16, 0x80, 0xE3, 0x80, 0x9A, 0x1C, 0x73,
+    0x92, 0x41, 0xCF, 0x8F, 0x70, 0x30, 0x8D, 0x62, 0xF7, 0x9F, 0x42, 0x2F, 0x00, 0x4C, 0x00, 0x72,
+    0x76, 0x30, 0x8C, 0x00, 0xD9, 0x23, 0x27, 0x03, 0xB2, 0xC7, 0x38, 0x00, 0x8A, 0xFE, 0x01, 0x14,
+    0x7C, 0x38, 0xA0, 0x8A, 0x66, 0x00, 0x03, 0xC7, 0x8A, 0x37, 0x49, 0x46, 0x45, 0xB2, 0xCB, 0xC9,
+    0x11, 0x78, 0x30, 0x02, 0x28, 0x02, 0x80, 0xCA, 0x03, 0x3D, 0x81, 0x82, 0x13, 0x50, 0xD1, 0x03,
+    0x26, 0x02, 0x38, 0x02, 0x70, 0xD4, 0xB6, 0x0D, 0xCE, 0xE0, 0x48, 0x5F, 0xB0, 0x73, 0xA4, 0xD7,
+    0xF4, 0x96, 0x33, 0x6A, 0xFA, 0x8C, 0x01, 0x96, 0x1E, 0x0C, 0xE0, 0x1B, 0x1D, 0x18, 0x32, 0x36,
+    0x00, 0x83, 0x5A, 0x00, 0x30, 0x14, 0x11, 0x00, 0x83, 0x1E, 0x01, 0x30, 0xD4, 0x01, 0x00, 0xDF,
+    0xB6, 0x1E, 0x00, 0xC9, 0xB4, 0xEB, 0x65, 0x17, 0x00, 0x30, 0xD8, 0x09, 0x00, 0x83, 0x99, 0x01,
+    0x30, 0x54, 0x94, 0xD7, 0xD9, 0x01, 0x0C, 0x05, 0x7B, 0x80, 0x41, 0x31, 0x00, 0x0C, 0x19, 0x23,
+    0xC0, 0x00, 0xB7, 0x20, 0xE7, 0xDB, 0x30, 0xEC, 0x6A, 0xD2, 0x57, 0x1C, 0x1C, 0xE9, 0x4B, 0x4E,
+    0x8E, 0xF4, 0x39, 0x17, 0x00, 0x40, 0x25, 0xBB, 0x72, 0x06, 0x00, 0x14, 0x11, 0x00, 0xA0, 0x2E,
+    0xEE, 0x26, 0x00, 0x40, 0x3E, 0x02, 0x00, 0xF0, 0x35, 0x00, 0xB8, 0x92, 0x91, 0xBD, 0x5A, 0x4A,
+    0xB2, 0x31, 0xB1, 0x62, 0xCC, 0x39, 0x16, 0xEC, 0x2A, 0xF6, 0x7A, 0x01, 0xBF, 0x03, 0x33, 0x15,
+    0x11, 0xE0, 0x60, 0x3C, 0x14, 0x9F, 0x58, 0x00, 0xBD, 0x5C, 0x0F, 0x80, 0x21, 0xFB, 0x54, 0x3F,
+    0xC5, 0x7F, 0xCD, 0x0E, 0x7A, 0x29, 0x08, 0x98, 0x49, 0x13, 0xE0, 0x50, 0x2F, 0x50, 0xEC, 0x4C,
+    0x84, 0x5E, 0xE0, 0x62, 0x4E, 0x36, 0x8C, 0x35, 0x17, 0x30, 0x3A, 0x8E, 0x19, 0x23, 0x00, 0xB8,
+    0x01, 0x00, 0xD8, 0x00, 0x50, 0x33, 0x00, 0x94, 0x01, 0x00, 0x6A, 0x0F, 0x00, 0x5F, 0x04, 0x00,
+    0x7C, 0xE3, 0xA8, 0x6D, 0x1B, 0x3C, 0xD8, 0x97, 0x64, 0x44, 0x49, 0x48, 0x75, 0xA7, 0x82, 0xEC,
+    0x61, 0xD8, 0x65, 0x0C, 0x28, 0x39, 0x41, 0x13, 0xE0, 0x1B, 0x0D, 0x18, 0x50, 0x05, 0x40, 0xF3,
+    0xAA, 0x9A, 0x01, 0xF0, 0xAD, 0x60, 0x3D, 0xA0, 0x59, 0x4B, 0xD3, 0xBC, 0x15, 0x08, 0x40, 0xB3,
+    0x3E, 0x19, 0xA4, 0x35, 0x66, 0x00, 0x7A, 0x6D, 0x15, 0x92, 0x0D, 0xA0, 0x59, 0x9B, 0x08, 0x80,
+    0x6F, 0xFD, 0x98, 0x83, 0xBC, 0x4B, 0x79, 0xD7, 0x45, 0x40, 0xB3, 0x52, 0xD2, 0x3E, 0xA8, 0x09,
+    0xF9, 0x5D, 0x69, 0xA0, 0x92, 0x03, 0x6A, 0x1E, 0xC3, 0xB0, 0xA9, 0x49, 0x9F, 0x71, 0x4E, 0x65,
+    0x9E, 0x1C, 0xE9, 0x51, 0xB3, 0x03, 0x00, 0xFC, 0x5E, 0x03, 0x00, 0x19, 0x2C, 0x03, 0xEA, 0xDE,
+    0x31, 0xC0, 0x05, 0xCB, 0x21, 0x63, 0x28, 0x08, 0xC5, 0xA0, 0x88, 0x62, 0xFE, 0x9C, 0xE2, 0x87,
+    0xCA, 0x00, 0xC5, 0x8F, 0xE8, 0x1E, 0x8A, 0x1F, 0xA9, 0x3D, 0x14, 0x4F, 0x6C, 0x03, 0x45, 0xB2,
+    0x83, 0x4A, 0x54, 0xAF, 0xCC, 0x00, 0xC5, 0x8F, 0xD4, 0x23, 0x14, 0x3F, 0xA2, 0x23, 0x14, 0x3F,
+    0x52, 0x2E, 0x50, 0x44, 0x41, 0x28, 0x42, 0xD1, 0xD7, 0x1C, 0xC0, 0xE0, 0x18, 0xE0, 0xA2, 0x63,
+    0x80, 0x99, 0x01, 0xE0, 0xF0, 0xF8, 0x67, 0xF5, 0x75, 0x23, 0x7D, 0xDD, 0xBD, 0xD1, 0x39, 0xB2,
+    0x63, 0x03, 0x47, 0xDE, 0x5E, 0x80, 0x67, 0x79, 0xE7, 0x4B, 0x17, 0xFA, 0x7A, 0xF5, 0x41, 0xF6,
+    0x75, 0xFC, 0x5C, 0x7D, 0x5D, 0x7A, 0xF7, 0xD5, 0xD3, 0xEC, 0x96, 0x07, 0x60, 0xE8, 0x01, 0x38,
+    0x7A, 0x00, 0x96, 0x1E, 0x40, 0x46, 0x0F, 0x00, 0xDB, 0xED, 0x01, 0x2C, 0x09, 0xDB, 0x5B, 0x32,
+    0x63, 0xF8, 0x28, 0x5F, 0x57, 0x0C, 0xA0, 0x2F, 0x19, 0x40, 0xAF, 0xCF, 0x3F, 0x07, 0xFA, 0x7A,
+    0x00, 0xE8, 0xAD, 0x07, 0xE8, 0xD9, 0x00, 0xFC, 0x0E, 0xA5, 0x06, 0xB2, 0xED, 0x00, 0x7E, 0x9B,
+    0x3D, 0x40, 0xCF, 0x00, 0xD0, 0xDB, 0x09, 0xA0, 0x37, 0x33, 0x40, 0x5F, 0x11, 0x19, 0xBD, 0x66,
+    0x57, 0x71, 0x52, 0x1C, 0x2C, 0x63, 0xC6, 0xC9, 0x32, 0xC2, 0xED, 0x68, 0xDD, 0x1E, 0x0B, 0xB1,
+    0x39, 0x28, 0x7A, 0x92, 0x1C, 0x34, 0x7B, 0x92, 0x4B, 0x53, 0xB3, 0xE7, 0xEB, 0x1C, 0x61, 0xE8,
+    0xD9, 0xB9, 0x11, 0xEE, 0x5D, 0xCF, 0xC6, 0x8D, 0x60, 0x07, 0x07, 0x37, 0xE6, 0x04, 0x2C, 0xDC,
+    0x58, 0xCC, 0xC0, 0x01, 0xDC, 0xA8, 0x27, 0x00, 0x70, 0x63, 0x15, 0x00, 0xC0, 0x9D, 0xDB, 0x1E,
+    0x00, 0x9C, 0x10, 0x1E, 0x8E, 0x1C, 0xD2, 0x7E, 0x94, 0xE7, 0x8C, 0x8C, 0xB3, 0xB1, 0x5E, 0x64,
+    0xAF, 0x29, 0xFB, 0x52, 0xA8, 0x36, 0x2A, 0x0E, 0x00, 0xDC, 0x98, 0x73, 0x04, 0xE0, 0x46, 0x30,
+    0xCA, 0xDE, 0x12, 0xC8, 0x78, 0xDE, 0x18, 0x7A, 0x54, 0xE4, 0xA0, 0x19, 0x60, 0xC8, 0xA1, 0xE0,
+    0x0C, 0x43, 0xF6, 0x59, 0x6A, 0x06, 0x5C, 0x3D, 0x06, 0x00, 0x1C, 0xC0, 0x91, 0x11, 0xB6, 0x27,
+    0x19, 0x33, 0x06, 0x92, 0x93, 0x62, 0xE0, 0x1B, 0xEC, 0x35, 0x03, 0x33, 0xFA, 0xEA, 0xFC, 0x98,
+    0x19, 0xBD, 0x19, 0xC0, 0x8C, 0xDE, 0x7A, 0x7C, 0x31, 0xA3, 0x27, 0x70, 0x25, 0xE3, 0x77, 0x16,
+    0x00, 0x99, 0x90, 0x3B, 0x13, 0x7A, 0x67, 0xFC, 0x0E, 0x3D, 0x90, 0x09, 0xC5, 0x33, 0x7A, 0x3B,
+    0x02, 0x19, 0xBD, 0x89, 0x40, 0x46, 0x5F, 0x11, 0x89, 0xEA, 0xA8, 0x39, 0x15, 0xEC, 0x61, 0x19,
+    0x73, 0x4E, 0x70, 0x8C, 0x70, 0xC2, 0xEA, 0x0E, 0x9B, 0xA3, 0xB6, 0x6D, 0x0E, 0xDA, 0xF6, 0xD8,
+    0x91, 0x7D, 0x4D, 0x06, 0x47, 0xFA, 0x9A, 0x0C, 0x96, 0x4B, 0x53, 0x51, 0xB8, 0x07, 0xAC, 0xF4,
+    0x39, 0x98, 0x5F, 0x70, 0x6F, 0xA3, 0xB0, 0x0C, 0x5E, 0xB6, 0xBF, 0xB3, 0xD9, 0xB8, 0x5F, 0xF2,
+    0xBB, 0x26, 0x22, 0xE7, 0x39, 0xE0, 0x96, 0xE3, 0x9A, 0xF4, 0x25, 0x19, 0x53, 0xF9, 0xE7, 0x54,
+    0x7E, 0xA9, 0x1E, 0xAA, 0xB4, 0xD7, 0xEB, 0x7E, 0xBA, 0xB8, 0x2F, 0x13, 0x8F, 0x2F, 0x82, 0xEC,
+    0x55, 0xDA, 0x67, 0x5F, 0xB3, 0x9C, 0x4A, 0xB2, 0x24, 0x3B, 0x32, 0x58, 0x8E, 0x9A, 0x0B, 0x6C,
+    0x84, 0x5E, 0xA0, 0xD8, 0x81, 0x03, 0xCC, 0x74, 0xC9, 0xC9, 0xEB, 0x1B, 0x0E, 0x30, 0x24, 0x17,
+    0x28, 0x92, 0x1C, 0x60, 0x96, 0xCD, 0xAD, 0xF7, 0x7F, 0xA7, 0x03, 0x87, 0x9C, 0x6C, 0x2C, 0xA3,
+    0xE3, 0xA4, 0xC9, 0xEF, 0x91, 0x1D, 0x53, 0xDF, 0x91, 0x4E, 0x5B, 0x4A, 0xF1, 0x9D, 0x07, 0x80,
+    0x42, 0xCA, 0x6E, 0x1A, 0x00, 0x50, 0x52, 0x81, 0x0A, 0xA9, 0x1D, 0xDB, 0x6B, 0x89, 0x10, 0x5B,
+    0x4A, 0x70, 0x4E, 0x4D, 0xC9, 0x59, 0xDA, 0x72, 0x79, 0x76, 0x4E, 0x44, 0x54, 0xF1, 0xBD, 0x0F,
+    0xA6, 0x74, 0x90, 0x1D, 0x6F, 0x29, 0xBF, 0x6D, 0xD2, 0x6D, 0x1B, 0x5E, 0x76, 0x90, 0x9A, 0xF5,
+    0xE2, 0x5B, 0xBF, 0xF0, 0x41, 0x6A, 0xDE, 0x06, 0xA9, 0x7D, 0x03, 0x52, 0xBD, 0x46, 0xAC, 0x3D,
+    0x14, 0xD2, 0x44, 0x7C, 0x89, 0xEC, 0x48, 0x46, 0xCB, 0x51, 0x93, 0xF4, 0x36, 0x42, 0xF3, 0x56,
+    0x14, 0xC2, 0x1A, 0x6F, 0x26, 0xE8, 0x45, 0xAD, 0xA7, 0x9D, 0x9C, 0x06, 0x69, 0xAA, 0x07, 0x52,
+    0x5B, 0xAD, 0x8D, 0x95, 0x5A, 0x6B, 0x6D, 0xA1, 0xD4, 0x44, 0xEF, 0x71, 0x2A, 0x6D, 0x36, 0x40,
+    0x1A, 0x0D, 0xA9, 0xAB, 0xE0, 0xA8, 0x6D, 0xDB, 0xB6, 0x15, 0x81, 0x8D, 0x69, 0xBE, 0x4C, 0x47,
+    0x00, 0x2C, 0x49, 0xF2, 0x1C, 0x40, 0xC6, 0xF3, 0xF6, 0xB1, 0xC4, 0x80, 0x03, 0xD4, 0xAF, 0x74,
+    0xF4, 0xFF, 0xDC, 0x69, 0xD2, 0x11, 0x39, 0x6F, 0x8F, 0xD8, 0x6D, 0x8F, 0x06, 0x39, 0xFA, 0xF6,
+    0x09, 0xC7, 0xF4, 0x6E, 0xCE, 0xB8, 0x7E, 0xC5, 0x6D, 0x8F, 0xCC, 0xBC, 0x1E, 0xD5, 0xCB, 0xBD,
+    0x47, 0xD5, 0xDE, 0x51, 0xCE, 0x11, 0x05, 0x7B, 0x54, 0x4B, 0x4D, 0x7A, 0x47, 0xA2, 0x9A, 0x1D,
+    0xE9, 0x49, 0xA2, 0x8E, 0xEB, 0x91, 0x49, 0xC3, 0x0E, 0xB0, 0xE3, 0x7A, 0xC4, 0x34, 0xC4, 0x90,
+    0xB3, 0x4F, 0x47, 0x3A, 0xCD, 0xFB, 0xF8, 0x30, 0x99, 0x2E, 0x39, 0x4E, 0xEB, 0x9B, 0xDB, 0xC7,
+    0xAE, 0x3E, 0x95, 0xE8, 0x17, 0x81, 0x92, 0x94, 0xA9, 0xD4, 0x92, 0xE4, 0x04, 0xC0, 0x2E, 0x1B,
+    0x37, 0x01, 0x50, 0xEC, 0x14, 0x3B, 0x00, 0x66, 0x82, 0x79, 0xEF, 0x0B, 0x7F, 0xC5, 0x0E, 0x66,
+    0x82, 0x21, 0xD9, 0x28, 0x76, 0x42, 0x39, 0x33, 0xC1, 0x2C, 0x9F, 0x61, 0x90, 0x57, 0x4A, 0x76,
+    0xF2, 0x8A, 0x89, 0x72, 0x21, 0xA7, 0x97, 0x0B, 0xD5, 0x2C, 0x17, 0x32, 0xBE, 0x42, 0x36, 0x64,
+    0x53, 0xCD, 0x8E, 0x93, 0xE1, 0x94, 0xF1, 0x7B, 0xE4, 0xC3, 0x64, 0xB3, 0x32, 0x9E, 0x34, 0xD1,
+    0x02, 0x75, 0xBA, 0xA0, 0xD8, 0xA4, 0x7A, 0x25, 0x3A, 0xE8, 0x34, 0x49, 0x94, 0x89, 0x08, 0x46,
+    0xE6, 0x27, 0x28, 0x26, 0x92, 0x55, 0xAF, 0x61, 0xEF, 0xEF, 0x41, 0xA1, 0x50, 0x21, 0xE2, 0x6C,
+    0x46, 0x9E, 0x02, 0x40, 0xC5, 0xEE, 0xF0, 0x29, 0x20, 0xE7, 0x98, 0x73, 0x01, 0x2A, 0xC2, 0x90,
+    0x22, 0x35, 0xBC, 0x49, 0x94, 0x6C, 0xEA, 0xA9, 0x5A, 0x60, 0x62, 0x46, 0x6F, 0x62, 0xCE, 0xA1,
+    0x24, 0xDC, 0xA8, 0xD9, 0x98, 0x29, 0xE3, 0x60, 0x22, 0x38, 0x28, 0x3E, 0xCE, 0x50, 0xB0, 0xD1,
+    0x4B, 0x41, 0x5F, 0xCD, 0x30, 0x53, 0x45, 0xB8, 0x11, 0x1C, 0x6C, 0xCC, 0xD8, 0x17, 0x7C, 0x88,
+    0xA1, 0x60, 0x57, 0xCD, 0x8A, 0xBD, 0x5E, 0xE0, 0x82, 0x66, 0x67, 0xA2, 0x62, 0x57, 0x13, 0x76,
+    0xAC, 0x22, 0xCC, 0x02, 0x0E, 0x6E, 0x80, 0x9B, 0x33, 0x7E, 0x97, 0x00, 0xE7, 0x9C, 0x0C, 0x00,
+    0x97, 0x9C, 0xC4, 0x15, 0x90, 0xE4, 0xF2, 0x97, 0x43, 0x1A, 0x01, 0x0D, 0x1E, 0x24, 0x6F, 0x71,
+    0x02, 0xD0, 0x36, 0x59, 0x0B, 0xE0, 0x00, 0x00, 0xB2, 0xD4, 0x84, 0xE7, 0x00, 0x0A, 0xFA, 0xAB,
+    0xA7, 0x50, 0xEC, 0x1C, 0x3B, 0xC5, 0xCE, 0x31, 0x66, 0xF4, 0xEE, 0x55, 0x76, 0xEC, 0x4D, 0xB0,
+    0xC1, 0x84, 0x6A, 0xD4, 0xB1, 0x8A, 0xE5, 0xAC, 0xF8, 0x29, 0x2A, 0x36, 0x7C, 0x85, 0x9E, 0xBD,
+    0x19, 0x5D, 0x30, 0xA3, 0x8E, 0x55, 0xD4, 0xB3, 0x62, 0xC1, 0x87, 0xF8, 0x38, 0x3B, 0x06, 0x13,
+    0xE8, 0xEB, 0xB9, 0x58, 0x6C, 0xAF, 0xD8, 0x3B, 0xF6, 0x30, 0xFC, 0x2B, 0x0E, 0xFF, 0x52, 0x91,
+    0xE4, 0x82, 0x4A, 0xB8, 0xC0, 0x87, 0x9F, 0x3C, 0x78, 0x72, 0x4B, 0xE8, 0x13, 0xBE, 0x06, 0x54,
+    0x2B, 0x27, 0x8F, 0x30, 0x24, 0x83, 0xE2, 0x78, 0x40, 0x6F, 0x16, 0xE4, 0xCC, 0x38, 0xA0, 0x98,
+    0x34, 0x81, 0xAA, 0xB7, 0x13, 0xF0, 0x27, 0xD2, 0x9F, 0x45, 0x7A, 0x30, 0x11, 0x40, 0xC6, 0x20,
+    0xD5, 0x00, 0x50, 0x11, 0x48, 0xCC, 0x73, 0xBD, 0x2C, 0x4F, 0x8B, 0x7C, 0xD6, 0x00, 0x70, 0x04,
+    0x00, 0xB2, 0x43, 0x96, 0x93, 0xE7, 0x8F, 0xCE, 0x8A, 0x24, 0x47, 0x45, 0x92, 0x3E, 0x97, 0x91,
+    0xED, 0xC8, 0x0E, 0x38, 0x10, 0x75, 0x20, 0x02, 0x80, 0x0E, 0x00, 0xEE, 0x37, 0x1E, 0xC8, 0xDF,
+    0x15, 0xC1, 0x7D, 0x04, 0x60, 0xD8, 0x01, 0xA8, 0xC7, 0x5D, 0xBF, 0x39, 0x68, 0x00, 0xCB, 0x0E,
+    0x96, 0x44, 0x4D, 0xC6, 0x82, 0x6F, 0xD0, 0x73, 0xA8, 0x62, 0x1D, 0xC1, 0xDB, 0xEC, 0xCA, 0xD1,
+    0x8C, 0xF8, 0xD3, 0x82, 0x0D, 0xE0, 0x46, 0xA0, 0x64, 0x03, 0xB8, 0x09, 0x28, 0xE9, 0xA5, 0xDC,
+    0x8A, 0x01, 0x30, 0xEC, 0xF1, 0x5F, 0x93, 0x9C, 0x4B, 0x0A, 0x3B, 0x8E, 0xB0, 0x5C, 0x80, 0xFF,
+    0x64, 0x4A, 0x33, 0x92, 0x1A, 0x81, 0xCF, 0xD9, 0x06, 0x9A, 0x01, 0xE0, 0x9C, 0x3E, 0x74, 0xD0,
+    0x20, 0xF1, 0xC5, 0x4F, 0xC9, 0x44, 0x21, 0xFC, 0xF0, 0xE5, 0x74, 0xF2, 0xBA, 0x5B, 0x36, 0x7C,
+    0x79, 0xCA, 0xD9, 0x97, 0x91, 0x4D, 0x3D, 0xC3, 0x7E, 0x39, 0xE4, 0xEC, 0x8B, 0xC9, 0xA2, 0x9E,
+    0x61, 0x71, 0x9C, 0xB3, 0xCF, 0x1A, 0xA0, 0x9E, 0xF7, 0xF8, 0xC6, 0x07, 0x74, 0x52, 0xF0, 0x6D,
+    0x00, 0x25, 0xB9, 0x88, 0x5C, 0x15, 0x80, 0x8A, 0x89, 0x0D, 0xC9, 0x48, 0x2C, 0x45, 0x63, 0x14,
+    0x31, 0x32, 0x29, 0x8C, 0xC6, 0xEF, 0xE9, 0x8B, 0xB5, 0x0C, 0xDC, 0xA7, 0x12, 0x9F, 0x7F, 0x79,
+    0x57, 0xC3, 0x97, 0x97, 0x5B, 0x7C, 0x36, 0xB2, 0xE1, 0x60, 0x5E, 0x1E, 0xF5, 0xA2, 0x22, 0xC1,
+    0xC1, 0xBC, 0x18, 0xF4, 0xA2, 0xC6, 0x03, 0x70, 0xB8, 0x02, 0x51, 0xDE, 0xE5, 0x97, 0xDE, 0xE7,
+    0x30, 0xE3, 0x00, 0x64, 0x64, 0x04, 0x2C, 0xE9, 0x51, 0x24, 0x09, 0x87, 0x7E, 0x2B, 0xDC, 0xB0,
+    0xDB, 0xCA, 0x33, 0xB6, 0xD9, 0x8A, 0x32, 0x95, 0xE8, 0xEC, 0x47, 0x6D, 0x4B, 0x32, 0x27, 0xDF,
+    0x21, 0xA3, 0x96, 0x39, 0xB3, 0xE4, 0x94, 0x33, 0x88, 0x12, 0x34, 0xA0, 0x1E, 0x51, 0xD0, 0x83,
+    0x1D, 0x34, 0xBB, 0x32, 0x02, 0x9A, 0x30, 0x3D, 0x50, 0x2F, 0x39, 0x01, 0x98, 0xA8, 0x47, 0x00,
+    0x76, 0x72, 0x1D, 0x00, 0xBE, 0x23, 0x3F, 0xC9, 0x1E, 0x40, 0x2E, 0xD4, 0x4A, 0xFC, 0x4A, 0xBA,
+    0x7B, 0x1A, 0x06, 0xEB, 0x04, 0x20, 0x3C, 0x5F, 0x5D, 0x72, 0x2B, 0x4F, 0x73, 0x21, 0xD9, 0x01,
+    0x9A, 0x5C, 0x00, 0x18, 0x72, 0x02, 0x0C, 0xF9, 0x10, 0xF9, 0x69, 0xB2, 0x77, 0xFC, 0x01, 0x39,
+    0x54, 0x0C, 0x15, 0x3D, 0xDC, 0x90, 0x33, 0xC0, 0x04, 0x98, 0x88, 0x6A, 0x42, 0xC9, 0xAE, 0x8C,
+    0xC8, 0xC4, 0xCA, 0x60, 0x62, 0xC6, 0x06, 0x05, 0x1B, 0x7A, 0x80, 0xC1, 0xF4, 0x40, 0x1D, 0xEB,
+    0x00, 0x28, 0x7E, 0x7A, 0x02, 0xE0, 0x7E, 0x14, 0x01, 0x54, 0xCB, 0x02, 0x40, 0x49, 0xA9, 0x2D,
+    0x3B, 0x00, 0x3A, 0x55, 0x24, 0x00, 0x80, 0x19, 0x77, 0x6C, 0x39, 0x71, 0x6B, 0xE9, 0x30, 0xFB,
+    0x37, 0x4A, 0x9E, 0x02, 0xA8, 0x28, 0x43, 0x8E, 0x1E, 0xC8, 0x37, 0x9B, 0xD3, 0x0F, 0x98, 0xD8,
+    0xA3, 0x10, 0xFB, 0x27, 0xF7, 0x10, 0x3B, 0x7F, 0x96, 0xCB, 0xD3, 0xD2, 0x51, 0x47, 0x99, 0x02,
+    0xFB, 0x95, 0xBB, 0xFC, 0xDA, 0x88, 0xAD, 0x57, 0x62, 0x63, 0x47, 0x6C, 0xA0, 0x60, 0xE3, 0x3A,
+    0x80, 0x83, 0xE9, 0x81, 0x2A, 0x56, 0x42, 0xEC, 0x11, 0x80, 0xFB, 0x41, 0x04, 0xA0, 0xE7, 0x79,
+    0xD7, 0x45, 0xCC, 0x8E, 0xD8, 0x99, 0xC8, 0x5B, 0x56, 0xE6, 0xEE, 0xEA, 0x97, 0x23, 0xF6, 0x41,
+    0xDB, 0x1E, 0x1F, 0xB4, 0x6D, 0x46, 0xF2, 0x61, 0x32, 0x54, 0x64, 0x30, 0x24, 0x1C, 0xCF, 0xE1,
+    0xD8, 0xC1, 0x89, 0x74, 0x9D, 0x73, 0x84, 0x0B, 0x80, 0xA6, 0xAF, 0x22, 0x00, 0xB3, 0x28, 0x51,
+    0xA2, 0x46, 0xD7, 0x03, 0x28, 0xF9, 0xFD, 0x49, 0x0A, 0x27, 0xE3, 0x3C, 0xE9, 0x89, 0x45, 0x92,
+    0x53, 0xCC, 0x3A, 0xDF, 0x26, 0xE2, 0x0A, 0x4F, 0x30, 0x64, 0x03, 0xA0, 0x9C, 0x13, 0x47, 0xBF,
+    0xC9, 0x00, 0xC0, 0x8A, 0xCA, 0xAE, 0x67, 0xD8, 0x39, 0x89, 0x19, 0x01, 0x70, 0x01, 0x5A, 0xE4,
+    0x28, 0x38, 0x36, 0x35, 0xD9, 0x38, 0xF2, 0x45, 0x72, 0xD4, 0xA2, 0xB6, 0x64, 0xC9, 0x26, 0xB0,
+    0x95, 0x11, 0x56, 0x99, 0x61, 0x55, 0x52, 0x92, 0xC4, 0xA0, 0x93, 0xC0, 0xE0, 0x2E, 0xAA, 0x2C,
+    0xBF, 0x87, 0x9A, 0x73, 0xC9, 0xC9, 0x30, 0x6A, 0x4E, 0x15, 0x47, 0xC5, 0x21, 0x67, 0x50, 0x04,
+    0xDC, 0x54, 0x46, 0xA0, 0x9E, 0xAB, 0x11, 0xD0, 0x34, 0x3D, 0xA0, 0xC8, 0x0E, 0x80, 0x54, 0x55,
+    0xFA, 0x8B, 0x98, 0x3B, 0x48, 0x19, 0x13, 0x1E, 0xD0, 0x91, 0x01, 0xA8, 0x83, 0x9D, 0x00, 0xD7,
+    0xD7, 0x0B, 0x72, 0x76, 0x9A, 0x5D, 0xC5, 0xBE, 0x62, 0xB4, 0x0C, 0x96, 0xB3, 0x65, 0x70, 0xA2,
+    0xA0, 0x08, 0xEF, 0x29, 0xF7, 0xB6, 0xA2, 0x9E, 0x88, 0x0D, 0x4D, 0xB4, 0x93, 0x2C, 0x1C, 0xB5,
+    0x6D, 0x7B, 0xED, 0xA8, 0x6D, 0x4B, 0x92, 0xBC, 0x4D, 0x06, 0x92, 0x8C, 0x86, 0xD4, 0x24, 0xF9,
+    0x02, 0xD9, 0xB1, 0xE0, 0xCD, 0xA8, 0xE8, 0x75, 0xB0, 0x93, 0xE9, 0x4C, 0xC4, 0x52, 0xF0, 0xE6,
+    0xA4, 0xE8, 0xCB, 0xDE, 0x4E, 0x75, 0x63, 0x22, 0x1E, 0x28, 0xF8, 0xF8, 0xB1, 0xA2, 0x07, 0xEC,
+    0x24, 0x1D, 0xBA, 0x60, 0x87, 0xDF, 0xDC, 0x85, 0xCC, 0x71, 0xF3, 0x2C, 0x97, 0xE3, 0x5C, 0xE6,
+    0x2E, 0x7A, 0x23, 0x7B, 0x99, 0xA6, 0xD3, 0x10, 0xDC, 0x53, 0x39, 0xB1, 0x4A, 0x7E, 0x7A, 0x7B,
+    0xA1, 0xBB, 0xA8, 0x74, 0xC2, 0xE2, 0xA2, 0xD6, 0x89, 0xAB, 0x70, 0x24, 0x3F, 0xC5, 0xA5, 0x26,
+    0xF9, 0x2A, 0xF9, 0x15, 0x92, 0x23, 0xF9, 0x6A, 0x34, 0x63, 0x2C, 0xD8, 0x2C, 0x7A, 0x36, 0x19,
+    0xBD, 0xB9, 0xC9, 0x4F, 0x79, 0x1B, 0xCA, 0x9E, 0xAF, 0x0C, 0x55, 0xC4, 0xB1, 0x19, 0xEF, 0x2F,
+    0x08, 0xE8, 0x19, 0x19, 0x3D, 0x14, 0x1B, 0xD8, 0x00, 0xB0, 0x47, 0x15, 0x01, 0x33, 0xE2, 0x67,
+    0xDF, 0x5C, 0xDA, 0x47, 0xD9, 0xA3, 0x26, 0x49, 0x0E, 0xB2, 0x8B, 0xE5, 0x56, 0x67, 0x01, 0xB2,
+    0x55, 0x36, 0x15, 0xD1, 0x54, 0x8F, 0xFB, 0xE6, 0xD2, 0xB5, 0x43, 0x56, 0x52, 0xDF, 0x7C, 0x38,
+    0x6A, 0xDB, 0xA6, 0x6D, 0x5B, 0x45, 0xC6, 0x8A, 0x0C, 0x96, 0x7C, 0x41, 0xF8, 0xE1, 0xA8, 0xC9,
+    0x0E, 0x1C, 0x51, 0xB2, 0x83, 0xA6, 0xD0, 0x98, 0x01, 0xC5, 0x65, 0xA7, 0x8D, 0x9C, 0x8E, 0x28,
+    0xD8, 0xA1, 0xA4, 0x87, 0x9D, 0x00, 0xBB, 0xA0, 0x14, 0xE3, 0x9E, 0xE3, 0x04, 0x29, 0x71, 0x27,
+    0xF3, 0xEE, 0x04, 0x64, 0xE4, 0xBB, 0xEC, 0x00, 0xB4, 0x8D, 0x9D, 0xD2, 0xB0, 0x95, 0x82, 0xBF,
+    0xFF, 0xA9, 0x5B, 0x9A, 0xC4, 0x17, 0x45, 0x1A, 0x63, 0x94, 0xC1, 0x70, 0xF7, 0xB0, 0x94, 0xA7,
+    0xAB, 0xF1, 0x7D, 0x87, 0xA5, 0x90, 0x08, 0xFF, 0x05, 0x2C, 0x27, 0xC3, 0x58, 0x73, 0xA9, 0xC8,
+    0x32, 0x69, 0x05, 0x84, 0xD8, 0x7C, 0x0B, 0x36, 0xE0, 0x90, 0xB1, 0x87, 0x99, 0x60, 0x47, 0x68,
+    0xA2, 0x9A, 0xA1, 0xE8, 0x0B, 0x36, 0xB0, 0xCB, 0x67, 0xD8, 0x43, 0x0B, 0x73, 0x17, 0xB9, 0xAF,
+    0x10, 0x3D, 0x12, 0x99, 0xF4, 0x32, 0xD1, 0xA6, 0xAA, 0x79, 0x57, 0x89, 0x13, 0xB2, 0x03, 0xEC,
+    0x2A, 0xBF, 0x44, 0xE1, 0xA7, 0x7B, 0xFD, 0x50, 0x9A, 0x4E, 0xBA, 0x5E, 0x96, 0x84, 0x18, 0xE9,
+    0x8D, 0x5D, 0x6A, 0x2F, 0x2D, 0x6D, 0xF5, 0x22, 0x19, 0xC5, 0x10, 0x34, 0x2B, 0x72, 0x58, 0x9B,
+    0xCB, 0x44, 0x64, 0x1C, 0xD6, 0x66, 0x4A, 0xEA, 0xE0, 0xDA, 0x5A, 0x66, 0x3E, 0x78, 0x88, 0x03,
+    0x34, 0x3F, 0x19, 0xEC, 0x84, 0x9C, 0xE1, 0x9B, 0xD5, 0x02, 0xD8, 0xA5, 0x96, 0x86, 0x26, 0x45,
+    0x5D, 0xE6, 0xDA, 0x66, 0xCB, 0xAE, 0xAD, 0xB2, 0xEB, 0xCF, 0x73, 0x00, 0x90, 0x8B, 0x0D, 0x14,
+    0xDF, 0x14, 0x03, 0xFD, 0xD5, 0xD4, 0x36, 0x59, 0xD2, 0x86, 0x52, 0x8B, 0xD5, 0x3C, 0xDE, 0x99,
+    0xC1, 0xB0, 0x6B, 0xB0, 0x60, 0x39, 0xD5, 0x14, 0x25, 0x6C, 0x76, 0x1C, 0x6B, 0x4E, 0x05, 0xBD,
+    0xA2, 0x57, 0xEC, 0xEE, 0xD9, 0xDE, 0xBE, 0xBD, 0x6E, 0x33, 0xFE, 0xE4, 0xBB, 0xF4, 0x10, 0x55,
+    0xD2, 0x50, 0x24, 0xAB, 0x77, 0xE9, 0x01, 0x75, 0x7B, 0xB7, 0xCD, 0x6F, 0xD2, 0x6F, 0x67, 0xD4,
+    0x13, 0x46, 0x20, 0x23, 0x67, 0x20, 0x27, 0xE7, 0xA3, 0xB6, 0x15, 0xD9, 0x9D, 0xFD, 0xCE, 0xC8,
+    0x68, 0x99, 0x3A, 0x54, 0xD8, 0xD7, 0x78, 0xDF, 0x7F, 0x77, 0x72, 0x9E, 0xAC, 0x28, 0xE2, 0x30,
+    0xE0, 0x24, 0xBB, 0x19, 0xE0, 0xFC, 0x90, 0xE8, 0x72, 0xA8, 0x65, 0xA7, 0xD9, 0xEC, 0xED, 0xCA,
+    0xF7, 0xDF, 0xE5, 0x1C, 0xA1, 0xD9, 0xD7, 0xA2, 0x91, 0x3B, 0x19, 0x8B, 0xB2, 0x5B, 0x90, 0x35,
+    0x00, 0x72, 0x4E, 0x00, 0x4A, 0x2E, 0x32, 0x51, 0x77, 0x00, 0xFE, 0x07, 0xA1, 0xBA, 0x10, 0x5D,
+    0x1A, 0x44, 0xDA, 0x63, 0xDB, 0xFF, 0xB2, 0x63, 0xA0, 0x9A, 0x2B, 0xF6, 0x28, 0x78, 0xC2, 0x19,
+    0x99, 0xD0, 0xD0, 0x92, 0x1C, 0x51, 0xB1, 0xB7, 0x0B, 0x0A, 0xFA, 0x82, 0x3E, 0x13, 0xDB, 0x83,
+    0x9D, 0x60, 0x22, 0xAA, 0x05, 0x9A, 0x28, 0xD8, 0xA9, 0x5F, 0xEC, 0x86, 0xE5, 0x58, 0x71, 0x36,
+    0x5C, 0x34, 0xF9, 0x15, 0xF2, 0xE1, 0x2D, 0xB3, 0x4D, 0x86, 0x84, 0x19, 0x3B, 0xB9, 0x06, 0xB5,
+    0x74, 0x8B, 0x3C, 0xF1, 0x86, 0x9A, 0x4D, 0xC5, 0x06, 0x19, 0x03, 0x2A, 0x66, 0x93, 0x26, 0x50,
+    0xC7, 0xAA, 0xB7, 0x23, 0x60, 0x47, 0x2A, 0x7A, 0x80, 0x3F, 0x88, 0x62, 0xD7, 0xF9, 0xAB, 0xC9,
+    0x4E, 0x80, 0x5E, 0x2C, 0x79, 0x67, 0xB3, 0xE1, 0x94, 0x38, 0xFB, 0xDF, 0xA6, 0x7D, 0xE3, 0x92,
+    0x99, 0x4B, 0xA5, 0x5E, 0x59, 0xAE, 0x1C, 0x22, 0x99, 0x2D, 0x6C, 0xD2, 0xE5, 0x93, 0xB0, 0xA0,
+    0xB8, 0xF2, 0x99, 0x09, 0xC8, 0x00, 0xCD, 0xA5, 0xF9, 0xF0, 0x37, 0xC5, 0x9B, 0xB2, 0x2A, 0x1A,
+    0x49, 0x14, 0x63, 0x04, 0x50, 0x50, 0x3A, 0x0E, 0x1E, 0xFD, 0x6B, 0xE1, 0x38, 0xC7, 0x3B, 0x03,
+    0x88, 0x48, 0x6B, 0x24, 0x87, 0xAC, 0xE1, 0xDB, 0x36, 0x16, 0xBD, 0x1D, 0x14, 0x6F, 0x8E, 0x26,
+    0xC0, 0x85, 0xB9, 0x8A, 0xA8, 0xA3, 0xFD, 0x1E, 0x51, 0xC8, 0x94, 0xCA, 0x17, 0x48, 0x92, 0xA1,
+    0x96, 0xAE, 0x24, 0xEA, 0xC4, 0xCE, 0x62, 0x04, 0xA0, 0x4E, 0x97, 0x06, 0x1C, 0x00, 0xE4, 0x9D,
+    0x34, 0x50, 0xFB, 0xD5, 0x29, 0x51, 0x8A, 0xA4, 0x73, 0xF0, 0xD7, 0xFB, 0xC6, 0x87, 0x7F, 0x84,
+    0xA4, 0x5E, 0xBF, 0xE3, 0xFA, 0xC4, 0xE4, 0x9B, 0x7D, 0xC7, 0xE0, 0x96, 0xBB, 0x9B, 0x34, 0x77,
+    0x9F, 0x25, 0x42, 0x3C, 0xF5, 0x1B, 0x6A, 0xA0, 0xE2, 0xDE, 0x06, 0xCA, 0x2E, 0x34, 0x90, 0xBC,
+    0x99, 0x4B, 0xB1, 0xAD, 0xDF, 0x95, 0x39, 0xCD, 0xCE, 0xC9, 0xEB, 0x29, 0x1E, 0x35, 0x51, 0xC3,
+    0x3F, 0x25, 0xC6, 0xE1, 0xEF, 0x92, 0xAF, 0x65, 0x0C, 0xE2, 0x9F, 0xFB, 0xE5, 0x77, 0x15, 0x4F,
+    0x6B, 0xF2, 0x7B, 0xE4, 0xE2, 0x2E, 0x0E, 0x4B, 0x00, 0x16, 0xBA, 0x5F, 0x65, 0x9E, 0x6C, 0x6B,
+    0xDA, 0xF3, 0x75, 0x22, 0x6A, 0xB1, 0x3C, 0xB6, 0xA4, 0x8B, 0x66, 0x9D, 0x6C, 0x01, 0x9B, 0x5A,
+    0x1C, 0xC0, 0x51, 0x83, 0xF7, 0xFC, 0x3B, 0x43, 0xD6, 0xB6, 0xD7, 0x50, 0x0E, 0xA8, 0xC5, 0xDD,
+    0xA2, 0xE8, 0x15, 0x83, 0x22, 0x23, 0x18, 0xC5, 0x31, 0xB6, 0xA0, 0x66, 0xAF, 0x38, 0x43, 0x13,
+    0x8A, 0x11, 0xFF, 0xCC, 0x05, 0x30, 0xC0, 0xBD, 0xEB, 0x91, 0xB1, 0xD1, 0x14, 0x11, 0xBB, 0x8C,
+    0x10, 0x79, 0x19, 0x30, 0xBD, 0xA6, 0x50, 0x31, 0x23, 0x18, 0x44, 0x02, 0xD7, 0x93, 0x66, 0x2A,
+    0xBD, 0xFD, 0x36, 0xDF, 0x16, 0x43, 0x80, 0x5A, 0x0D, 0xDE, 0xC9, 0x04, 0x39, 0x20, 0xB9, 0x49,
+    0x65, 0x6A, 0xCA, 0xD9, 0x33, 0x88, 0xD6, 0x65, 0xA3, 0xE6, 0x6A, 0x1B, 0x6A, 0x18, 0x34, 0x45,
+    0xD5, 0xD4, 0x14, 0x27, 0x8C, 0x9D, 0xC1, 0xA0, 0xC4, 0x8D, 0xEA, 0x35, 0x51, 0xB3, 0x81, 0x62,
+    0x58, 0x5D, 0x7D, 0x6E, 0x81, 0x26, 0x4A, 0x06, 0x71, 0x3B, 0x9E, 0xC3, 0xB0, 0x2B, 0x39, 0x66,
+    0x64, 0xCC, 0xB8, 0xE4, 0x5C, 0x60, 0x48, 0x5F, 0x30, 0x5A, 0x76, 0x05, 0x19, 0x51, 0xB1, 0xBF,
+    0x91, 0xC8, 0x76, 0xF5, 0x14, 0x40, 0x83, 0xFB, 0x93, 0xBF, 0xA0, 0x12, 0x0B, 0xC6, 0x94, 0x25,
+    0x83, 0x86, 0x17, 0x99, 0x40, 0x2D, 0xC9, 0x19, 0x5E, 0xAF, 0x6D, 0xE0, 0xD6, 0x16, 0xF8, 0xEC,
+    0xF1, 0x3E, 0xC5, 0x0F, 0xD2, 0xB6, 0x98, 0x61, 0x39, 0xA8, 0x19, 0x0C, 0x25, 0x17, 0x30, 0x68,
+    0x7A, 0xCB, 0xDE, 0x10, 0x5C, 0xE0, 0x86, 0x82, 0xE1, 0x43, 0x27, 0xA1, 0x58, 0xC0, 0xEF, 0x00,
+    0xAE, 0xB3, 0x43, 0x3D, 0x00, 0x2A, 0x16, 0x8B, 0x8A, 0x00, 0xAA, 0xC1, 0x0E, 0xAE, 0x01, 0xE0,
+    0xFE, 0x72, 0xB9, 0x1E, 0x56, 0x9A, 0x21, 0x31, 0x91, 0x08, 0xC0, 0xBE, 0xED, 0x7E, 0xC8, 0x1E,
+    0xD0, 0x2C, 0x96, 0x92, 0x40, 0xCE, 0xDE, 0x0E, 0x66, 0x02, 0x4C, 0x2C, 0x96, 0x9C, 0x3D, 0x34,
+    0x1B, 0x3B, 0x68, 0x22, 0x67, 0x28, 0x16, 0xB8, 0x08, 0x17, 0x73, 0xCE, 0x8A, 0x43, 0xCD, 0xC6,
+    0x71, 0xA8, 0x78, 0x93, 0x43, 0xC9, 0x05, 0x36, 0x66, 0xA7, 0x00, 0x80, 0x7F, 0x2E, 0xB8, 0x05,
+    0xFB, 0x29, 0x32, 0xC2, 0x44, 0x71, 0xE5, 0x7E, 0x97, 0xEC, 0x15, 0x97, 0x8C, 0x01, 0x8E, 0xBD,
+    0x26, 0x34, 0xFF, 0x0F, 0x30, 0x28, 0x36, 0x48, 0x7D, 0x40, 0x1C, 0xB8, 0x9A, 0xB9, 0xB8, 0x63,
+    0x8D, 0x07, 0x34, 0x4F, 0x96, 0x46, 0x66, 0xE6, 0x6E, 0x2D, 0xB9, 0x94, 0x5B, 0xB3, 0x39, 0x91,
+    0x89, 0xCB, 0x50, 0x86, 0xC6, 0x24, 0x33, 0xB0, 0xD7, 0x04, 0xEC, 0x6A, 0x62, 0xD7, 0x04, 0xCC,
+    0x7A, 0x52, 0xF3, 0x18, 0x26, 0xD6, 0xA4, 0x57, 0x7C, 0x89, 0x8C, 0x30, 0x93, 0x78, 0x9B, 0x9B,
+    0x1D, 0x1B, 0x58, 0x85, 0x3C, 0xBF, 0x35, 0x50, 0x7C, 0x96, 0xF3, 0x56, 0x1B, 0x46, 0x12, 0x0B,
+    0x37, 0xA9, 0xC5, 0xAF, 0x14, 0x64, 0xA3, 0x27, 0xC7, 0x51, 0xF1, 0x45, 0x12, 0x6E, 0x16, 0x94,
+    0x82, 0x99, 0x14, 0xFF, 0x3B, 0xC5, 0xCE, 0x7A, 0x98, 0x49, 0x87, 0x04, 0x52, 0x30, 0x0B, 0x07,
+    0x28, 0x71, 0x53, 0x91, 0xF4, 0x8A, 0xDF, 0xE1, 0x02, 0x33, 0x65, 0x1C, 0x15, 0xBB, 0x42, 0xCC,
+    0xDF, 0x71, 0x6B, 0xF8, 0xAE, 0xE6, 0x9A, 0x63, 0xC6, 0xEF, 0x91, 0x5D, 0x25, 0x08, 0x05, 0xBF,
+    0x4A, 0xC7, 0xB9, 0x18, 0xD8, 0x47, 0x00, 0x25, 0xB7, 0x72, 0x82, 0x9B, 0x00, 0x95, 0xAC, 0x0C,
+    0x0D, 0x90, 0x2D, 0x0D, 0x70, 0x20, 0xDE, 0x91, 0x64, 0xBF, 0x17, 0x65, 0x2A, 0x6C, 0x87, 0x90,
+    0x79, 0xFB, 0x3A, 0x3B, 0x40, 0x8F, 0x19, 0x07, 0x40, 0xCD, 0x22, 0x82, 0xB0, 0xA9, 0x16, 0x00,
+    0xA6, 0x2F, 0xD8, 0x01, 0x3A, 0xC8, 0xCD, 0x98, 0x6E, 0x8A, 0x80, 0x62, 0x7D, 0xC1, 0x0E, 0xA8,
+    0xE5, 0x66, 0x39, 0xC1, 0x4E, 0x80, 0x9A, 0xE5, 0x26, 0x45, 0x7C, 0xB1, 0x3E, 0xE3, 0x00, 0xD4,
+    0x01, 0x76, 0x02, 0xF4, 0x88, 0x6A, 0x01, 0x8A, 0x88, 0x82, 0xDD, 0xA1, 0x22, 0x32, 0x0E, 0xEA,
+    0x5D, 0x36, 0xB0, 0x53, 0x46, 0x7A, 0x9C, 0xF0, 0xD8, 0x4A, 0x09, 0xAF, 0xB3, 0xCF, 0x48, 0xFE,
+    0x40, 0x04, 0x9C, 0xF1, 0x6A, 0xB3, 0xB3, 0x6C, 0x25, 0xEB, 0x7D, 0xC1, 0x34, 0x3D, 0x5E, 0xD0,
+    0xF4, 0x4C, 0xD2, 0xE3, 0x93, 0x62, 0x74, 0x2A, 0x8A, 0x4A, 0x4C, 0x3D, 0x46, 0x38, 0x7F, 0x39,
+    0x3F, 0xC6, 0x0E, 0x2A, 0x2A, 0x36, 0xEB, 0x76, 0xDA, 0x6D, 0x8B, 0x71, 0xB7, 0x2D, 0xA5, 0x6F,
+    0xEE, 0x6D, 0xAB, 0x41, 0xB1, 0x79, 0xC0, 0x78, 0xC5, 0xE6, 0x4F, 0xE8, 0x15, 0x1B, 0xCB, 0xA6,
+    0x60, 0xE7, 0x08, 0xC7, 0xC5, 0xCD, 0x39, 0x49, 0x33, 0xE6, 0xE4, 0x72, 0xD8, 0xAC, 0x6A, 0xA8,
+    0x70, 0x34, 0x71, 0x8D, 0x57, 0xC3, 0x0E, 0x49, 0x22, 0x36, 0xCC, 0xAD, 0x1B, 0xF1, 0xBF, 0x49,
+    0x53, 0xF0, 0x4B, 0x64, 0xCC, 0x49, 0x56, 0xE4, 0x69, 0x41, 0x0E, 0xAB, 0x37, 0x58, 0xE6, 0x72,
+    0x99, 0x03, 0x14, 0x3D, 0x4C, 0xC4, 0x3A, 0x1F, 0xC0, 0x5C, 0x7E, 0xBB, 0xE2, 0xD6, 0x4B, 0xA8,
+    0x52, 0xAB, 0xEB, 0xE4, 0xC4, 0x31, 0xCB, 0x66, 0x73, 0xEB, 0xFD, 0xDF, 0x7E, 0x9F, 0x8F, 0xBB,
+    0xA5, 0x81, 0xA6, 0x70, 0x2F, 0x13, 0x73, 0x92, 0x4D, 0xC6, 0xA1, 0x24, 0x23, 0xD2, 0x48, 0x4A,
+    0xA6, 0xDE, 0xAD, 0xB4, 0xBD, 0xD5, 0xFB, 0x22, 0x00, 0x1C, 0x9C, 0x24, 0x8B, 0xD3, 0xEA, 0x72,
+    0x4D, 0x77, 0x6F, 0x9C, 0x02, 0xB0, 0x9C, 0x34, 0x59, 0x93, 0x05, 0xF9, 0x22, 0xD9, 0x91, 0x43,
+    0xF5, 0xB3, 0x24, 0x58, 0xF1, 0xB7, 0x91, 0x9C, 0x92, 0x7B, 0x51, 0x73, 0xF3, 0xEC, 0xCF, 0x94,
+    0x79, 0x4B, 0x2E, 0xB0, 0x53, 0x49, 0xFA, 0x6A, 0xC9, 0xC9, 0x50, 0xEC, 0x2B, 0x7C, 0x2E, 0xEC,
+    0x14, 0x51, 0x99, 0xF1, 0x4B, 0x26, 0xBF, 0xCF, 0xCE, 0xA8, 0x23, 0x16, 0xE0, 0xF3, 0x04, 0xD3,
+    0xFA, 0x07, 0xD8, 0x8A, 0x35, 0x4F, 0x93, 0xBB, 0xF7, 0x4E, 0x2A, 0xF9, 0xBB, 0xA9, 0xE4, 0xDD,
+    0x05, 0x1F, 0xDA, 0xD6, 0x43, 0x86, 0x0B, 0x0A, 0xB9, 0xEB, 0x2E, 0x98, 0x25, 0x56, 0xD1, 0xE3,
+    0x2A, 0xF0, 0xF7, 0xE1, 0xCC, 0x9F, 0xC4, 0x2F, 0x2C, 0xDE, 0xE9, 0x69, 0xCF, 0xBE, 0x69, 0x44,
+    0x3C, 0x9B, 0xB1, 0x93, 0xD8, 0x92, 0x2D, 0x4F, 0x84, 0xCB, 0xC2, 0xE3, 0x83, 0xD0, 0xC8, 0xD3,
+    0xCD, 0x06, 0xA2, 0x91, 0x43, 0x34, 0xF2, 0x64, 0x7A, 0x59, 0xDE, 0x4F, 0x23, 0x6F, 0xEF, 0x52,
+    0xBA, 0x13, 0x64, 0xEE, 0xE7, 0xD0, 0xC8, 0xD5, 0x0E, 0xDE, 0x14, 0x76, 0x3C, 0x32, 0x39, 0x50,
+    0x56, 0xD1, 0xDA, 0xFA, 0x7D, 0xC9, 0x7A, 0x6D, 0x2D, 0x81, 0xB2, 0xE1, 0xBE, 0x06, 0xC9, 0x70,
+    0xE2, 0x38, 0x59, 0x46, 0xC7, 0xD1, 0x70, 0x2C, 0xE8, 0x4B, 0x76, 0x62, 0x37, 0xB9, 0xB8, 0xF5,
+    0xDB, 0x6D, 0xC6, 0xF3, 0xEB, 0x6C, 0x12, 0x42, 0xCD, 0x90, 0x6C, 0xB6, 0x56, 0x93, 0xE2, 0xF2,
+    0x6D, 0xE6, 0x38, 0x21, 0xB9, 0x52, 0x64, 0x2B, 0x3D, 0x4A, 0x2D, 0xBB, 0x06, 0xCA, 0x65, 0x1B,
+    0xF7, 0xCC, 0x26, 0x7F, 0x03, 0xA0, 0x6D, 0x1B, 0x64, 0x6D, 0xDB, 0xE4, 0x64, 0x40, 0x41, 0xF6,
+    0x39, 0x19, 0x50, 0x92, 0x3D, 0x1C, 0x47, 0x68, 0xB2, 0x81, 0xE6, 0x04, 0xCD, 0x09, 0xD0, 0x8C,
+    0xA8, 0xD6, 0x03, 0x23, 0xA0, 0xCA, 0x05, 0xE6, 0xCD, 0x08, 0x54, 0x3F, 0x22, 0xEC, 0xAD, 0x08,
+    0xD4, 0x3F, 0x20, 0xDC, 0x75, 0x39, 0x68, 0x58, 0x45, 0xA0, 0x7E, 0x85, 0xDD, 0x52, 0x45, 0xC0,
+    0x7C, 0x8B, 0x2F, 0xCC, 0x7A, 0x06, 0x4C, 0xCF, 0x57, 0xA3, 0x1C, 0xB8, 0x1F, 0x4C, 0x7A, 0x06,
+    0x8C, 0xB7, 0xEF, 0x8C, 0x7A, 0x01, 0xAC, 0x37, 0x0C, 0x72, 0x50, 0x73, 0xD0, 0x0B, 0xE0, 0x7C,
+    0xC5, 0x5E, 0x13, 0x70, 0x5E, 0xD3, 0x97, 0x04, 0x9C, 0x2F, 0xD9, 0x95, 0x04, 0xE8, 0x15, 0x9B,
+    0x92, 0x00, 0x3B, 0xC1, 0xC1, 0x65, 0xEC, 0xB2, 0x05, 0x25, 0x4F, 0x2B, 0x2E, 0xF8, 0x3B, 0x38,
+    0x2E, 0x86, 0x94, 0x46, 0x35, 0xA9, 0x67, 0xAC, 0x72, 0xFA, 0x3A, 0x04, 0xC5, 0x93, 0xBE, 0xEB,
+    0xCE, 0x5B, 0x07, 0xD9, 0x16, 0xA6, 0x02, 0x60, 0x95, 0xF8, 0x31, 0xAF, 0x07, 0xFF, 0x12, 0x86,
+    0x3D, 0x0A, 0xC6, 0x4A, 0x18, 0x88, 0x22, 0x9B, 0x8C, 0xEC, 0x2A, 0x0E, 0x70, 0x22, 0xA3, 0x1B,
+    0x7A, 0x90, 0x5D, 0xCD, 0x00, 0xC3, 0xA0, 0xDF, 0x8C, 0xD0, 0xEF, 0xCC, 0xE5, 0x3B, 0x84, 0x8A,
+    0xEE, 0xF6, 0xDB, 0xF4, 0x60, 0xF5, 0x56, 0xB4, 0x01, 0xE6, 0xF6, 0x32, 0x57, 0x11, 0x3A, 0x58,
+    0x16, 0x84, 0x8A, 0x9A, 0x8F, 0xD3, 0x83, 0x39, 0xBD, 0x0D, 0x30, 0xDE, 0x0C, 0x55, 0x84, 0x0E,
+    0x65, 0x28, 0x08, 0x15, 0xB3, 0x29, 0xA3, 0x2F, 0xA4, 0xCF, 0x7F, 0x49, 0xC6, 0xF3, 0x5B, 0xF2,
+    0xD3, 0x17, 0xBA, 0xA8, 0xBA, 0x74, 0xFE, 0x16, 0xB9, 0x79, 0x6B, 0x70, 0x1F, 0x51, 0x93, 0xB7,
+    0x65, 0x4C, 0x36, 0xBF, 0xA2, 0xF2, 0x74, 0xCF, 0xEE, 0x41, 0xF2, 0x61, 0x31, 0x8D, 0x77, 0x5B,
+    0xB9, 0x5B, 0x7B, 0x35, 0x4A, 0x57, 0x34, 0x1E, 0x40, 0x1D, 0x4A, 0x71, 0x3A, 0x7C, 0x47, 0x18,
+    0x3E, 0x93, 0xA0, 0x98, 0x34, 0xE0, 0x83, 0xE3, 0x4B, 0xD5, 0xA5, 0x72, 0xD8, 0x17, 0x54, 0x90,
+    0xC0, 0x05, 0x95, 0x48, 0xFC, 0x6A, 0xAB, 0xC9, 0x88, 0x95, 0x70, 0xF5, 0x7F, 0xBA, 0x11, 0x00,
+    0xEA, 0x1F, 0xB1, 0x03, 0xA0, 0x62, 0xD2, 0x67, 0x5E, 0x10, 0x65, 0x66, 0xAC, 0xB8, 0xEA, 0x49,
+    0x00, 0xEA, 0xA1, 0x64, 0x27, 0x22, 0x5B, 0x04, 0xE0, 0xBC, 0x12, 0x19, 0x7E, 0xEB, 0x58, 0x15,
+    0xF7, 0x31, 0xC9, 0x06, 0x8A, 0x9B, 0x0D, 0x27, 0xC0, 0x79, 0x14, 0xF4, 0xD0, 0x13, 0x84, 0x5F,
+    0x35, 0xC8, 0x19, 0x60, 0x46, 0xA0, 0xE6, 0xA9, 0xE1, 0x84, 0x9A, 0x7C, 0x89, 0xF4, 0x05, 0x19,
+    0xC9, 0xB8, 0xC5, 0xF0, 0x01, 0x0B, 0x4C, 0x07, 0xE3, 0x75, 0x80, 0x1E, 0xCB, 0x08, 0xC5, 0x47,
+    0x16, 0xC0, 0x92, 0x2B, 0x30, 0xE2, 0xF0, 0xC9, 0x0B, 0x8E, 0xEF, 0x2C, 0x71, 0x83, 0x09, 0x25,
+    0xC9, 0xA6, 0xE0, 0x5F, 0x30, 0xE4, 0xEC, 0x4C, 0x84, 0xED, 0x4B, 0xA2, 0x0C, 0xB9, 0x60, 0xFD,
+    0x02, 0x90, 0xD9, 0x08, 0x38, 0x12, 0xB9, 0x48, 0xC4, 0x64, 0x50, 0x1C, 0xEA, 0x08, 0x0E, 0x25,
+    0x61, 0xC7, 0x9C, 0xBE, 0x9A, 0xE1, 0x42, 0xC1, 0x7F, 0xCF, 0xE5, 0x98, 0x24, 0xE7, 0x9A, 0xB3,
+    0x65, 0xCE, 0xA8, 0x89, 0xC3, 0x53, 0xFC, 0xE9, 0x1E, 0xCD, 0x43, 0x39, 0x02, 0xC8, 0xF9, 0xBC,
+    0xD8, 0x29, 0x63, 0x2D, 0x86, 0xE5, 0x17, 0x04, 0x12, 0x90, 0x90, 0x8A, 0x0F, 0xE0, 0xCA, 0x7B,
+    0x28, 0xB8, 0xFB, 0x38, 0x11, 0x2D, 0xDC, 0x33, 0xA1, 0x82, 0x13, 0xA4, 0x73, 0x85, 0x81, 0xC0,
+    0x49, 0x1F, 0xD0, 0xEF, 0xB2, 0x01, 0x90, 0x2F, 0xC2, 0x9C, 0xCD, 0x6D, 0x7A, 0x00, 0x45, 0x14,
+    0xF9, 0x87, 0x0F, 0x31, 0x00, 0xA8, 0x92, 0x0A, 0xBA, 0xC0, 0x4D, 0x49, 0xAA, 0xF6, 0x40, 0x19,
+    0xC5, 0x13, 0x94, 0x04, 0xF1, 0x4A, 0x74, 0x1B, 0x81, 0x20, 0x00, 0xE6, 0xCE, 0xE6, 0x16, 0x3B,
+    0x94, 0x31, 0x61, 0xFA, 0x3A, 0x28, 0xF6, 0xA8, 0x46, 0xA0, 0x26, 0x14, 0x1B, 0xE4, 0x3C, 0x57,
+    0x02, 0x25, 0x8F, 0x8E, 0x11, 0x96, 0x7C, 0x39, 0x01, 0xF3, 0xB2, 0x39, 0x9B, 0x91, 0xF1, 0x79,
+    0x7A, 0xD8, 0xE0, 0x02, 0xAA, 0x58, 0x45, 0xA8, 0x59, 0xCD, 0x97, 0x54, 0xF9, 0x08, 0x40, 0xC1,
+    0x19, 0xA8, 0x28, 0x60, 0xF7, 0x19, 0xD5, 0xF2, 0x18, 0x7D, 0xB9, 0x08, 0x9C, 0xBC, 0x8E, 0xA8,
+    0x7D, 0x29, 0xDA, 0xA2, 0x07, 0x0E, 0x18, 0x90, 0x0B, 0x80, 0x98, 0x84, 0x26, 0xE9, 0x35, 0x3B,
+    0x17, 0x14, 0xBB, 0x3A, 0x66, 0xEC, 0xB7, 0x0D, 0xC6, 0xBF, 0xE4, 0xF9, 0xC3, 0x24, 0x39, 0x3A,
+    0xBE, 0xCD, 0x58, 0x32, 0x98, 0x88, 0xAB, 0x8D, 0xA8, 0x87, 0x6D, 0xDB, 0xB6, 0xED, 0xB5, 0x2D,
+    0x36, 0xAB, 0x4B, 0x95, 0xE7, 0x00, 0x64, 0x8E, 0x3B, 0x7B, 0xD1, 0xEB, 0xCF, 0x12, 0x80, 0x9A,
+    0x19, 0x60, 0x3C, 0x90, 0xD3, 0x44, 0xE8, 0x01, 0x00, 0x3F, 0x4D, 0xE4, 0x01, 0x80, 0xBB, 0x9D,
+    0xFA, 0xA7, 0xED, 0x57, 0xEF, 0x61, 0xB2, 0x01, 0x08, 0xD1, 0x5B, 0x00, 0x7A, 0x52, 0x62, 0x66,
+    0x2B, 0x23, 0x84, 0xB6, 0x6A, 0x49, 0x2E, 0x87, 0x9C, 0xD0, 0xDC, 0x6C, 0xB0, 0x1A, 0x53, 0x53,
+    0x6B, 0x84, 0xD5, 0xC6, 0x20, 0xEE, 0xBA, 0xB7, 0xDB, 0xEB, 0x04, 0x9E, 0x43, 0x3D, 0x8A, 0x58,
+    0xD5, 0x69, 0x01, 0x45, 0xD6, 0x43, 0x19, 0x21, 0x8E, 0xDA, 0x82, 0x52, 0x87, 0xB9, 0xE2, 0x2C,
+    0x98, 0x84, 0x4F, 0xAF, 0xFE, 0xAA, 0xDB, 0xE4, 0x50, 0xA5, 0xAF, 0x1E, 0x01, 0xD7, 0x80, 0x8C,
+    0x4B, 0x26, 0x06, 0xDC, 0xE8, 0x64, 0x8C, 0x91, 0x0C, 0x15, 0x1F, 0xE3, 0x7C, 0x9D, 0x9F, 0x64,
+    0x67, 0x08, 0x13, 0xEB, 0x31, 0xA7, 0xCF, 0xE9, 0x1D, 0xEA, 0x88, 0x2A, 0x02, 0x39, 0x1F, 0x7F,
+    0x8C, 0x1E, 0x99, 0x94, 0x4B, 0x08, 0xE6, 0x6B, 0x92, 0x77, 0xBE, 0x0A, 0x2D, 0x26, 0xF4, 0x9C,
+    0xBD, 0xF8, 0x5B, 0xA7, 0x8C, 0x3D, 0x50, 0x08, 0xB3, 0x84, 0x9D, 0xC0, 0x19, 0xD9, 0x23, 0xFC,
+    0xF7, 0x8E, 0xE4, 0x94, 0xBC, 0x68, 0x8F, 0x93, 0xB3, 0x25, 0x43, 0xC1, 0x05, 0x8E, 0x13, 0x0E,
+    0x9F, 0xDC, 0xB7, 0x3E, 0xCC, 0xA8, 0x3B, 0x14, 0x13, 0x08, 0x54, 0xA1, 0x88, 0x80, 0x79, 0xDB,
+    0x05, 0xC0, 0x91, 0xCD, 0xCA, 0xB4, 0xB2, 0x8B, 0x6C, 0x2F, 0x6B, 0xDB, 0xB6, 0xBD, 0x26, 0xD6,
+    0x35, 0x47, 0x92, 0x3F, 0x96, 0x22, 0x56, 0xDC, 0x3C, 0x4B, 0x98, 0x08, 0x41, 0x3A, 0xEA, 0x41,
+    0xD1, 0xC3, 0x34, 0x9A, 0xC0, 0x9F, 0x26, 0x79, 0x85, 0x41, 0x4C, 0x71, 0x47, 0xC7, 0xD2, 0xA5,
+    0x60, 0x56, 0x35, 0x3F, 0x42, 0xF1, 0xF5, 0xCD, 0xE9, 0x3E, 0xC6, 0x67, 0xFB, 0x34, 0x74, 0xA7,
+    0x09, 0xB8, 0xDD, 0xB7, 0xEB, 0x50, 0xEE, 0x0C, 0x7D, 0x7B, 0x25, 0xE9, 0x71, 0x3F, 0xAE, 0xA0,
+    0x18, 0xB3, 0x88, 0xBA, 0x2F, 0x47, 0x38, 0x6F, 0xFA, 0x8C, 0x4F, 0x10, 0x8A, 0x9C, 0x90, 0x93,
+    0xCD, 0x7E, 0xD5, 0xAF, 0x01, 0x70, 0xEC, 0x50, 0x27, 0x6D, 0xD9, 0x57, 0xF3, 0x75, 0x76, 0xF4,
+    0x9A, 0xE5, 0x8C, 0x2A, 0x9A, 0x00, 0x33, 0xD2, 0x83, 0xDF, 0x25, 0xC9, 0x13, 0x8A, 0x4B, 0x99,
+    0x6F, 0xD1, 0x27, 0x15, 0xA1, 0x9A, 0xD7, 0xA2, 0x72, 0x46, 0xF6, 0x38, 0xF9, 0x06, 0x15, 0x93,
+    0x54, 0xDD, 0x67, 0xE4, 0x04, 0x7C, 0x78, 0x67, 0xE3, 0x3D, 0xE4, 0x22, 0x6E, 0x8C, 0x80, 0x82,
+    0xE4, 0x9C, 0xEC, 0xA6, 0x66, 0x69, 0x2C, 0x7B, 0x33, 0xA0, 0x64, 0xA8, 0x1B, 0x64, 0x9C, 0xAE,
+    0x6C, 0x4D, 0xAF, 0x62, 0x40, 0x35, 0xCB, 0xCE, 0x38, 0x5B, 0xF3, 0xA8, 0x6D, 0xDB, 0x13, 0x4A,
+    0xD3, 0xCA, 0x56, 0xC6, 0x96, 0xBD, 0xB3, 0xD9, 0xB8, 0xC5, 0x8E, 0x40, 0x3D, 0xDB, 0x11, 0x30,
+    0x51, 0xB6, 0x66, 0x4A, 0x40, 0xEC, 0x8C, 0xA1, 0x22, 0x4A, 0xF6, 0x9A, 0x77, 0x1C, 0x9B, 0x15,
+    0xCF, 0x48, 0x8E, 0x40, 0x4D, 0x36, 0x40, 0x76, 0xE3, 0x14, 0x40, 0x76, 0x0D, 0x42, 0x29, 0x47,
+    0xF6, 0x25, 0xC9, 0xDE, 0xDC, 0x71, 0xF4, 0x13, 0x34, 0x1F, 0x12, 0x5F, 0xA2, 0x48, 0x2A, 0x36,
+    0x00, 0x99, 0xD0, 0xE6, 0x7A, 0xC2, 0xC4, 0xF2, 0x2D, 0x7E, 0xFB, 0x51, 0xBE, 0x44, 0x14, 0x4B,
+    0x15, 0x61, 0x46, 0x3B, 0x66, 0xF4, 0x1C, 0xAB, 0x39, 0x23, 0x39, 0xE4, 0x94, 0xB1, 0xD0, 0x6D,
+    0x51, 0xDB, 0xA2, 0x29, 0xEB, 0x01, 0x30, 0xA3, 0x99, 0x00, 0x3B, 0x9A, 0x08, 0xD8, 0xD1, 0x4C,
+    0x80, 0x19, 0xEA, 0x00, 0x64, 0xC8, 0xEE, 0xE2, 0x63, 0xFF, 0x40, 0xC8, 0x98, 0x4F, 0xF9, 0x04,
+    0x33, 0x9A, 0x11, 0x1C, 0x38, 0x28, 0x3E, 0xCC, 0xA6, 0x98, 0x8A, 0xE9, 0x6E, 0xAE, 0xFC, 0x1B,
+    0x26, 0xF6, 0x2A, 0x69, 0x76, 0x75, 0x12, 0x28, 0xF5, 0x52, 0x72, 0x0B, 0x1E, 0x5D, 0xE1, 0xA3,
+    0x9A, 0xDB, 0x8B, 0xD6, 0x9B, 0x55, 0xF4, 0x6C, 0x70, 0xFC, 0x9E, 0x06, 0xE3, 0x72, 0x58, 0xC3,
+    0x97, 0x72, 0xF6, 0x8A, 0x9C, 0x61, 0x22, 0x0C, 0x61, 0x24, 0xB2, 0x43, 0x71, 0xCA, 0xC9, 0x21,
+    0xE7, 0x0C, 0xC3, 0x5E, 0x0C, 0x79, 0x3E, 0x7F, 0x83, 0x62, 0x7E, 0xFD, 0x26, 0x50, 0x8D, 0x60,
+    0x10, 0xD1, 0xD0, 0x79, 0x4D, 0x11, 0x7C, 0xD5, 0xBC, 0x86, 0x36, 0x09, 0x8B, 0x17, 0xB1, 0x8D,
+    0x5D, 0x8A, 0xFA, 0x40, 0x31, 0x5F, 0xE7, 0x67, 0xE6, 0xD5, 0xC4, 0xBD, 0xC5, 0x96, 0x90, 0x5B,
+    0xB4, 0xC9, 0xCA, 0xE1, 0xEB, 0x59, 0x8B, 0x8B, 0x04, 0x05, 0x3D, 0x43, 0x9A, 0xB2, 0x47, 0xBD,
+    0xCA, 0x57, 0x04, 0x43, 0x49, 0x0F, 0x14, 0xEC, 0x35, 0xA5, 0xA7, 0x30, 0x82, 0x21, 0xE7, 0x88,
+    0x64, 0x74, 0xD4, 0xF4, 0x28, 0xC5, 0xC6, 0xE0, 0x88, 0x9C, 0x11, 0x15, 0x4F, 0x15, 0x27, 0x38,
+    0x36, 0x95, 0x84, 0x89, 0xD4, 0x1C, 0x94, 0xC0, 0xF6, 0x5E, 0xE4, 0x04, 0x2B, 0x51, 0x38, 0x87,
+    0x4F, 0xA5, 0x96, 0x7E, 0x06, 0xA9, 0x57, 0x48, 0xE8, 0x91, 0x4B, 0x56, 0xED, 0x84, 0x22, 0x72,
+    0xC1, 0x25, 0xD7, 0x82, 0x8A, 0x78, 0xBF, 0xBF, 0xE3, 0xB4, 0xB5, 0x7D, 0xC1, 0x45, 0x8C, 0xEA,
+    0x8E, 0x83, 0x26, 0x18, 0x0B, 0xCE, 0x8A, 0x41, 0x73, 0x28, 0x17, 0x58, 0xE2, 0x2F, 0x08, 0x3B,
+    0xE8, 0xF9, 0x73, 0x28, 0xA7, 0x62, 0xC9, 0x17, 0x00, 0xC6, 0xDB, 0xC1, 0x78, 0x20, 0x5B, 0x8A,
+    0xA5, 0x1C, 0x01, 0x94, 0xE7, 0xEE, 0x87, 0xDC, 0x9F, 0x0C, 0xEB, 0x44, 0xC8, 0x82, 0x8F, 0x2D,
+    0xD7, 0x25, 0x62, 0xC6, 0x0E, 0x2E, 0x00, 0xF5, 0x5C, 0x2C, 0x4A, 0xE0, 0x1A, 0x76, 0xA8, 0x67,
+    0x80, 0x63, 0xB1, 0x24, 0xC7, 0xA9, 0x1D, 0x4A, 0xFA, 0x92, 0xBE, 0x66, 0x6F, 0x96, 0x9C, 0x63,
+    0xC9, 0x25, 0xE3, 0x64, 0x16, 0x38, 0x0E, 0x05, 0xFD, 0xEF, 0xC9, 0xB8, 0x3D, 0x5E, 0xBB, 0x4A,
+    0x39, 0x42, 0xF1, 0x09, 0x7A, 0x98, 0x68, 0x62, 0x12, 0xD9, 0xAA, 0xA0, 0x47, 0xE0, 0x7E, 0x3C,
+    0x70, 0xB1, 0xB2, 0x27, 0xEC, 0x93, 0x03, 0xD8, 0x91, 0xEC, 0x34, 0xC9, 0x19, 0xEC, 0x15, 0x83,
+    0x1E, 0xA1, 0x09, 0x02, 0x0C, 0x7A, 0x80, 0x26, 0xFE, 0x55, 0x9A, 0x2F, 0xF4, 0xB2, 0x8A, 0x30,
+    0x90, 0x79, 0x4C, 0x10, 0xCD, 0x63, 0x8A, 0x18, 0xCB, 0x36, 0x29, 0xCC, 0x23, 0x6E, 0x4D, 0xBF,
+    0x66, 0x2E, 0x3C, 0x14, 0x5F, 0x99, 0x01, 0x13, 0x4D, 0x40, 0xC1, 0x17, 0xE9, 0xC1, 0xC9, 0xB2,
+    0xB1, 0x14, 0x88, 0xA8, 0x66, 0x12, 0x9A, 0x5E, 0x03, 0x0E, 0x37, 0xC7, 0x00, 0xCE, 0x70, 0x06,
+    0x3D, 0xEB, 0x19, 0x66, 0x32, 0x13, 0xD8, 0xB3, 0xCF, 0x96, 0x6C, 0xB9, 0xA7, 0xB5, 0x7E, 0x0D,
+    0xC1, 0x85, 0x4F, 0xAC, 0xC1, 0x85, 0x3E, 0x23, 0x47, 0xE0, 0xC3, 0x4F, 0x8A, 0xE5, 0xF7, 0xB8,
+    0x4E, 0xC0, 0x1F, 0xCE, 0xB2, 0xF9, 0x61, 0x6B, 0xA3, 0xF1, 0xB0, 0xC1, 0xF8, 0x8C, 0xDE, 0x74,
+    0x8A, 0x28, 0x1B, 0x1D, 0x57, 0x63, 0x32, 0xFB, 0x04, 0xD7, 0x2C, 0xB8, 0x00, 0x05, 0xD9, 0xA3,
+    0x20, 0x47, 0xE0, 0x90, 0x71, 0x65, 0x9A, 0xF5, 0xB2, 0xDA, 0x28, 0xAA, 0xE5, 0xF7, 0x81, 0x6A,
+    0xB6, 0x80, 0x99, 0xD9, 0xC3, 0x46, 0x2E, 0x9F, 0xE1, 0xE8, 0x48, 0x0E, 0x46, 0xE4, 0x7E, 0x4E,
+    0xC0, 0xD5, 0x67, 0x1A, 0x94, 0x24, 0x5F, 0xD3, 0x14, 0x84, 0x8A, 0x6C, 0xC6, 0xAA, 0x07, 0x87,
+    0xCA, 0xE7, 0xEC, 0xAA, 0xAE, 0x5C, 0x70, 0x9F, 0x20, 0x79, 0x6C, 0x48, 0x10, 0x0A, 0x45, 0x00,
+    0x7A, 0x69, 0x00, 0xCD, 0x19, 0xD0, 0x64, 0x97, 0x7C, 0x70, 0x85, 0x04, 0x06, 0xC5, 0x75, 0xA2,
+    0xAD, 0xF7, 0x36, 0x05, 0x60, 0x62, 0xDD, 0xC1, 0x4C, 0xA6, 0x87, 0x0B, 0xE6, 0xBC, 0x60, 0x6F,
+    0x52, 0x37, 0x59, 0x90, 0x93, 0x03, 0x70, 0xF5, 0x99, 0xFD, 0xD6, 0x10, 0xA1, 0x06, 0x2A, 0x45,
+    0x80, 0xE8, 0xC4, 0x1E, 0x3E, 0xBA, 0xD9, 0x74, 0xEF, 0x39, 0xDE, 0xF6, 0xEC, 0x7D, 0x90, 0x88,
+    0x88, 0xA8, 0xC4, 0xDE, 0xD7, 0x6D, 0xED, 0x7D, 0x4E, 0x6C, 0x44, 0xAB, 0xC9, 0x48, 0x8B, 0x05,
+    0x09, 0x5C, 0x92, 0xEA, 0x29, 0xB7, 0x29, 0xB7, 0x35, 0xE5, 0x36, 0xDF, 0x5C, 0x00, 0x06, 0x1D,
+    0xC5, 0xC2, 0xC4, 0xE7, 0x39, 0x40, 0x53, 0xC7, 0x82, 0x1D, 0x4C, 0xA4, 0xAF, 0x16, 0x80, 0x8C,
+    0x62, 0x80, 0x12, 0xFB, 0xA6, 0x66, 0x14, 0x0B, 0xD4, 0x6A, 0x90, 0x8A, 0x5B, 0xFB, 0xD4, 0xFA,
+    0xDB, 0x05, 0x3B, 0xB8, 0x19, 0xA8, 0x25, 0x0C, 0xB0, 0x22, 0xDF, 0xBA, 0xAB, 0xE4, 0x40, 0xD6,
+    0xB6, 0x0D, 0xA0, 0xB6, 0x5E, 0xD5, 0x6E, 0x8D, 0xA6, 0xCC, 0xDA, 0xF6, 0x52, 0x1E, 0x6F, 0x39,
+    0x96, 0x64, 0xCD, 0x59, 0x91, 0x2F, 0x92, 0x20, 0x87, 0x6A, 0x59, 0xC1, 0xFF, 0xEC, 0x21, 0x86,
+    0x33, 0x33, 0x81, 0x33, 0xF4, 0x02, 0xB2, 0x51, 0x7C, 0x9C, 0xEC, 0xC1, 0xBF, 0xA5, 0x19, 0x61,
+    0xCE, 0xA9, 0x67, 0x68, 0x52, 0xB1, 0x51, 0x24, 0xD8, 0x83, 0x0B, 0xCC, 0x08, 0xB3, 0x40, 0xCF,
+    0x62, 0xDC, 0x6B, 0xE4, 0x53, 0x25, 0xA7, 0x8C, 0xFC, 0x32, 0xD9, 0x91, 0x6F, 0x91, 0xBD, 0xE1,
+    0x1E, 0x37, 0x74, 0x70, 0x0D, 0x80, 0x92, 0x45, 0x12, 0x12, 0x13, 0x23, 0x17, 0xD6, 0x99, 0xB1,
+    0x91, 0x19, 0xE2, 0x38, 0x79, 0xE5, 0x2E, 0x0E, 0xC4, 0xB6, 0x4D, 0xFE, 0xD9, 0xA8, 0x44, 0x66,
+    0x0C, 0x9A, 0x8C, 0x56, 0x10, 0xEA, 0x5D, 0x41, 0x8F, 0x7C, 0x8F, 0x84, 0x26, 0x8A, 0xC0, 0xC0,
+    0x00, 0x95, 0x9A, 0xCF, 0xC8, 0x6D, 0x95, 0x9A, 0xCF, 0x48, 0xEB, 0x2A, 0x4A, 0xE3, 0x9B, 0x1F,
+    0x73, 0x80, 0xA6, 0xA2, 0xBC, 0x6D, 0x42, 0xB5, 0x00, 0xFC, 0x09, 0x53, 0xF3, 0x05, 0x69, 0x1F,
+    0xA6, 0xE6, 0x13, 0x93, 0x21, 0x57, 0xF3, 0x62, 0xB8, 0xD0, 0x7C, 0x26, 0x02, 0xD5, 0x82, 0x9C,
+    0x23, 0xE0, 0x66, 0x38, 0x12, 0x76, 0xD7, 0x7C, 0x6B, 0xC9, 0x51, 0x84, 0x22, 0x00, 0x05, 0x0B,
+    0x02, 0xB9, 0xE8, 0xBD, 0x32, 0x89, 0xE8, 0xA0, 0xC7, 0xF7, 0x9E, 0x3F, 0x2A, 0xCE, 0x39, 0xF9,
+    0x12, 0xD9, 0x90, 0x3F, 0x26, 0xBD, 0xE1, 0x54, 0x88, 0x9D, 0x95, 0x03, 0xCC, 0x08, 0x33, 0xC1,
+    0xCC, 0xD0, 0x0B, 0x0C, 0x1B, 0xC5, 0xCE, 0xB0, 0x07, 0x07, 0xCB, 0x11, 0x66, 0xB2, 0x2F, 0xCF,
+    0xD0, 0x8B, 0xBD, 0xCD, 0x46, 0x91, 0x9E, 0x3D, 0x48, 0x6F, 0x46, 0x18, 0x76, 0x7A, 0x86, 0x66,
+    0xB7, 0x6D, 0x45, 0xF9, 0x54, 0xCE, 0x05, 0x96, 0xFF, 0x8E, 0x1C, 0x0C, 0xA3, 0xE3, 0xA8, 0xB7,
+    0x11, 0x28, 0x40, 0xB6, 0xC0, 0x01, 0x50, 0x7C, 0x98, 0x1D, 0x50, 0xF0, 0xA6, 0xB0, 0x81, 0x9B,
+    0xA2, 0xDC, 0x88, 0x39, 0xF3, 0x9E, 0xD9, 0x40, 0x62, 0x34, 0x56, 0x9C, 0x6D, 0x32, 0x81, 0x4C,
+    0x69, 0xF6, 0x07, 0x38, 0x67, 0x64, 0xA7, 0x38, 0xA0, 0x62, 0x5F, 0xB0, 0x43, 0x21, 0x1E, 0x61,
+    0xC5, 0xB1, 0x5A, 0x80, 0x8C, 0x53, 0x3D, 0x03, 0xA0, 0xD8, 0x5A, 0xDC, 0xBA, 0xB3, 0x11, 0x80,
+    0x7D, 0x8F, 0xDD, 0x0C, 0xC0, 0x46, 0x33, 0x03, 0x70, 0x93, 0x21, 0x00, 0x8E, 0xB2, 0x0B, 0x15,
+    0x3B, 0xE4, 0xEC, 0x35, 0x7B, 0x81, 0xE3, 0x4C, 0xA8, 0x89, 0x9C, 0x7C, 0x3D, 0xC9, 0x83, 0x49,
+    0x20, 0x64, 0x07, 0xE4, 0x12, 0x96, 0x84, 0x0F, 0x6F, 0x1A, 0x00, 0xB6, 0xB1, 0x0D, 0x4C, 0x30,
+    0x01, 0xD5, 0x5C, 0xCD, 0xA9, 0x05, 0x5D, 0xE3, 0x2E, 0x71, 0xC8, 0x1F, 0x34, 0x09, 0x37, 0x54,
+    0x90, 0x33, 0x4A, 0x92, 0x43, 0xC1, 0x37, 0x18, 0x15, 0x7D, 0xC5, 0x27, 0xE8, 0x73, 0x06, 0x06,
+    0x98, 0xD9, 0x4C, 0xD0, 0xBC, 0xBE, 0x20, 0xE7, 0x1B, 0xEC, 0xE0, 0xEE, 0x70, 0x40, 0x3D, 0xBB,
+    0x09, 0x25, 0x4F, 0x88, 0x5C, 0xE6, 0xB3, 0xC0, 0x11, 0x66, 0x32, 0x84, 0x89, 0x05, 0xCF, 0xED,
+    0x02, 0x47, 0x2E, 0x09, 0x9D, 0x6F, 0x39, 0xDD, 0xED, 0x92, 0xFE, 0x25, 0x08, 0x9D, 0x0B, 0xA1,
+    0x71, 0x29, 0xA1, 0x6D, 0x14, 0x01, 0xFB, 0xEE, 0xDD, 0xDC, 0xB6, 0xED, 0x96, 0xDE, 0x66, 0x06,
+    0x60, 0x27, 0xB3, 0x48, 0xF4, 0xE8, 0x7B, 0x11, 0xBA, 0x22, 0x72, 0x72, 0x73, 0x17, 0xA1, 0x05,
+    0x2D, 0x33, 0x03, 0xC0, 0x55, 0x71, 0xDA, 0x5E, 0x4A, 0xBE, 0xC6, 0x45, 0x45, 0x94, 0x7C, 0x82,
+    0x1D, 0x18, 0xE8, 0x51, 0xCD, 0x26, 0x40, 0xF1, 0xFA, 0xDC, 0xB6, 0x7C, 0x83, 0x14, 0x0F, 0x09,
+    0x67, 0xF7, 0x76, 0xFB, 0x19, 0x9E, 0x44, 0x80, 0x2F, 0xB2, 0x81, 0x0D, 0x1C, 0x50, 0x4F, 0x66,
+    0x86, 0x8E, 0x05, 0xFB, 0xEA, 0x67, 0x90, 0xEF, 0x37, 0xD9, 0xBF, 0xFF, 0x63, 0x23, 0xFB, 0xAF,
+    0xDA, 0xBF, 0x7F, 0x13, 0x0D, 0x74, 0x06, 0xD7, 0x24, 0x29, 0x54, 0xF1, 0x36, 0x7D, 0x12, 0x43,
+    0x33, 0x82, 0xCD, 0x65, 0x2D, 0xF3, 0x20, 0xCF, 0x05, 0x46, 0x31, 0xA0, 0x22, 0x19, 0x45, 0x50,
+    0x46, 0xBD, 0x34, 0x96, 0xBE, 0x0E, 0x28, 0x39, 0xD4, 0x01, 0x39, 0x43, 0x35, 0x00, 0x9C, 0xF4,
+    0x00, 0xB8, 0x98, 0x77, 0xAB, 0x25, 0x43, 0x80, 0xE0, 0x46, 0xB0, 0x7C, 0x42, 0xBE, 0x65, 0xC5,
+    0x9F, 0xDE, 0xD8, 0xB8, 0x79, 0xEF, 0x99, 0x84, 0x6B, 0x29, 0x3A, 0xC0, 0x8D, 0xB5, 0x47, 0xC6,
+    0x60, 0x06, 0x28, 0x0E, 0x76, 0x82, 0xA6, 0xB7, 0xFC, 0x2A, 0x09, 0x93, 0x70, 0x11, 0xE4, 0xB0,
+    0x7A, 0x10, 0x0E, 0x37, 0x0D, 0x90, 0xCD, 0x59, 0x22, 0x78, 0xC1, 0x92, 0x72, 0x74, 0xB9, 0x3D,
+    0xB0, 0x05, 0x70, 0x22, 0x36, 0x11, 0x36, 0x9A, 0x64, 0x5F, 0x2D, 0x8F, 0x31, 0xE8, 0x1E, 0x1C,
+    0x8B, 0x54, 0x8C, 0x55, 0xE2, 0xD2, 0xE4, 0x2C, 0x9B, 0x92, 0x9C, 0x91, 0xB5, 0x27, 0x72, 0x23,
+    0x6B, 0x60, 0xA2, 0xF6, 0x30, 0x93, 0x19, 0xE0, 0x82, 0x99, 0x0F, 0x45, 0x18, 0xDC, 0x0A, 0x60,
+    0xAF, 0x01, 0x87, 0xFB, 0x20, 0xB7, 0x1D, 0xB6, 0x74, 0x0F, 0x69, 0xBA, 0xD9, 0x3C, 0xF3, 0x3E,
+    0xA2, 0xD7, 0x51, 0x7B, 0xCD, 0x91, 0xDE, 0x32, 0x3A, 0xB2, 0x73, 0x8C, 0x86, 0x0B, 0x6A, 0x0E,
+    0x8A, 0x01, 0x8A, 0x4D, 0xC6, 0x80, 0x62, 0x01, 0x38, 0x41, 0x8B, 0x01, 0x35, 0x59, 0xBC, 0xEB,
+    0xB0, 0x8D, 0xFC, 0x28, 0x09, 0xE7, 0x01, 0xC5, 0x8E, 0x8D, 0x58, 0x8C, 0x01, 0x80, 0xAF, 0xCE,
+    0x00, 0xE0, 0x24, 0xDC, 0xC6, 0x24, 0x45, 0x71, 0xC5, 0x1A, 0xF9, 0xBD, 0xB0, 0xC1, 0xE4, 0xB9,
+    0x10, 0xD7, 0xD5, 0x7F, 0x29, 0x0A, 0x69, 0xAC, 0x46, 0xA9, 0xC2, 0x20, 0xF0, 0x1A, 0x81, 0x35,
+    0x25, 0xD3, 0xFE, 0xB4, 0x43, 0x08, 0x01, 0x07, 0x6D, 0x2B, 0x22, 0x67, 0x94, 0x0E, 0xB4, 0x85,
+    0xB2, 0x1E, 0x08, 0xBC, 0xF5, 0x9E, 0xBF, 0x6D, 0xBC, 0x88, 0x5F, 0xE3, 0x45, 0x86, 0x9F, 0x27,
+    0x38, 0x07, 0x17, 0x83, 0x73, 0xAA, 0x35, 0x38, 0x67, 0xDC, 0x06, 0xE7, 0xE8, 0x15, 0x86, 0xBA,
+    0x1F, 0x9C, 0xE3, 0x77, 0x60, 0xDA, 0x14, 0x16, 0x12, 0xB7, 0x18, 0xBD, 0xA6, 0x58, 0x00, 0x8C,
+    0x65, 0x0A, 0xAE, 0xC5, 0x6A, 0xE0, 0x28, 0x53, 0xFB, 0x2D, 0x00, 0xF0, 0xE0, 0x45, 0x59, 0x63,
+    0xCB, 0xF8, 0x9E, 0xD8, 0xE3, 0x78, 0x3F, 0x9B, 0xF1, 0xFD, 0xA3, 0x68, 0xEA, 0x72, 0x28, 0x07,
+    0x88, 0x56, 0x08, 0xC5, 0x9B, 0xEC, 0x00, 0xF6, 0xEC, 0x81, 0x6A, 0xA8, 0x86, 0xF7, 0x96, 0xC8,
+    0x34, 0xD9, 0x5B, 0xBE, 0x4A, 0x86, 0x9A, 0x13, 0x39, 0x15, 0x9C, 0x0A, 0x06, 0xD4, 0x13, 0x5C,
+    0x84, 0x8E, 0xD0, 0x44, 0xB1, 0x20, 0xE7, 0x90, 0x27, 0xB4, 0x53, 0x97, 0x50, 0x54, 0x19, 0x7B,
+    0x13, 0xD6, 0x90, 0xA6, 0x82, 0x65, 0xDC, 0xD6, 0xB5, 0x3E, 0x4F, 0x2E, 0xE3, 0x6E, 0x9B, 0x9C,
+    0xA2, 0xE2, 0x80, 0x14, 0x69, 0xB8, 0x86, 0xA7, 0xAC, 0x71, 0x58, 0xE2, 0xFC, 0x00, 0x70, 0x7F,
+    0xC6, 0x0E, 0xF8, 0x44, 0x4E, 0x0F, 0x54, 0x14, 0x3B, 0xA7, 0xA8, 0x89, 0x09, 0x7B, 0xDD, 0x01,
+    0x38, 0xDC, 0x72, 0x93, 0x2B, 0xF8, 0x2D, 0x00, 0xF8, 0x04, 0xFE, 0x99, 0x78, 0x24, 0x5D, 0x03,
+    0x28, 0x3E, 0xC4, 0x4E, 0x64, 0xF4, 0x06, 0xA8, 0xA7, 0x6A, 0x06, 0x60, 0x7B, 0x33, 0x00, 0x58,
+    0x24, 0x7A, 0xEE, 0xCF, 0xF1, 0x47, 0xFF, 0x28, 0x9B, 0x1F, 0x1F, 0xC2, 0x29, 0x80, 0x72, 0x30,
+    0x00, 0x54, 0xAC, 0x07, 0x20, 0xA3, 0xE4, 0x29, 0x79, 0x24, 0x02, 0xB0, 0xB7, 0x67, 0x00, 0xB5,
+    0x5F, 0x00, 0xE8, 0xDE, 0x02, 0xC8, 0x86, 0x12, 0xFF, 0xF8, 0x58, 0x00, 0xEA, 0xBE, 0x1A, 0x00,
+    0xD4, 0x51, 0xCF, 0xD8, 0x76, 0x85, 0x9C, 0xCF, 0xB3, 0x07, 0x60, 0xA4, 0x2F, 0x64, 0x0D, 0xEE,
+    0xE1, 0x7E, 0x07, 0x6D, 0x7B, 0x7C, 0xD4, 0xB6, 0x0F, 0x8B, 0xD5, 0xE0, 0xC7, 0x24, 0xCB, 0xE4,
+    0x0A, 0x26, 0x27, 0x98, 0x79, 0xAB, 0xA1, 0x5D, 0x82, 0xC9, 0x88, 0xFB, 0x98, 0x0C, 0xC5, 0x1E,
+    0xD5, 0x02, 0x38, 0x51, 0x97, 0x2B, 0x76, 0xB9, 0xA0, 0xF1, 0x1C, 0x27, 0x01, 0x8A, 0x2D, 0x29,
+    0xCC, 0xBD, 0x03, 0x2C, 0x17, 0x0E, 0xFB, 0x81, 0x2D, 0xEF, 0x8B, 0xC9, 0x58, 0x73, 0x1C, 0xF1,
+    0xFF, 0x4D, 0xAE, 0xA3, 0x35, 0x4A, 0x42, 0x06, 0x72, 0x4C, 0x4C, 0xC0, 0x8C, 0x66, 0xBC, 0xB8,
+    0xAD, 0x87, 0xFA, 0xBD, 0x79, 0xC0, 0xDF, 0x17, 0x2C, 0xE3, 0x68, 0x1B, 0x37, 0x3C, 0x3B, 0x92,
+    0x7C, 0x91, 0x92, 0x3F, 0xE5, 0xCE, 0xB3, 0xF4, 0x9A, 0x82, 0xDE, 0x85, 0xF5, 0x9A, 0x28, 0x22,
+    0x18, 0x60, 0x3A, 0x4D, 0xA8, 0x90, 0x2C, 0x6D, 0xDC, 0x3A, 0x69, 0x7E, 0xC9, 0xC3, 0x9A, 0x4F,
+    0x02, 0x75, 0x82, 0x77, 0x88, 0x11, 0x7C, 0xDC, 0x3A, 0xD2, 0xC5, 0x06, 0xCC, 0x6D, 0x80, 0x8D,
+    0xC0, 0x45, 0x24, 0x12, 0x2A, 0x02, 0xC0, 0xA1, 0x44, 0xE5, 0xF0, 0xAD, 0x6D, 0xC9, 0x33, 0xDE,
+    0xB9, 0x15, 0x15, 0x7D, 0x15, 0x34, 0x61, 0x3B, 0x13, 0xB1, 0x80, 0x41, 0x8D, 0x8A, 0xFE, 0x3E,
+    0xF1, 0x90, 0x6D, 0x13, 0x61, 0x28, 0xFA, 0x54, 0x94, 0x8B, 0x97, 0x9C, 0x48, 0x39, 0x11, 0x35,
+    0x39, 0x24, 0xF0, 0x65, 0x31, 0xAF, 0x98, 0x1A, 0xE3, 0x13, 0xF4, 0x22, 0x9F, 0x00, 0xA8, 0xFE,
+    0xD2, 0x7E, 0x0F, 0xD4, 0x51, 0xA0, 0xA5, 0xD0, 0x4C, 0x30, 0xB9, 0xB5, 0xF7, 0x6F, 0xFB, 0xFF,
+    0xE5, 0x23, 0x60, 0x3B, 0x0C, 0xB6, 0x60, 0x72, 0xA0, 0x26, 0x7F, 0x4A, 0x52, 0xBA, 0x97, 0xE5,
+    0xD2, 0x20, 0x23, 0xCF, 0x77, 0xF1, 0xEE, 0x5B, 0x8F, 0x99, 0x58, 0xB8, 0x57, 0x1C, 0xD8, 0x16,
+    0x18, 0xB6, 0x45, 0x41, 0xDC, 0xFD, 0xD0, 0xF2, 0x4C, 0x7A, 0x88, 0x3C, 0x4F, 0x0F, 0x91, 0x83,
+    0x3C, 0x24, 0xD0, 0x3A, 0x80, 0xE1, 0x41, 0xF6, 0xE9, 0x4B, 0x6E, 0x4A, 0x5F, 0xD2, 0x4C, 0x5F,
+    0x4A, 0xA0, 0x5B, 0x06, 0x30, 0xA4, 0x87, 0x04, 0x80, 0xAB, 0x89, 0x6A, 0x49, 0x0F, 0xD5, 0x84,
+    0x26, 0x72, 0xDE, 0x21, 0xBB, 0x92, 0xAF, 0xC9, 0xB0, 0x33, 0xE4, 0xF7, 0x48, 0xB2, 0x49, 0xB5,
+    0x3B, 0x17, 0xA2, 0x5F, 0x70, 0x29, 0x08, 0xAC, 0x42, 0x66, 0x50, 0x28, 0x3E, 0xCC, 0x06, 0xEB,
+    0xEC, 0xFA, 0x33, 0x86, 0xD3, 0x2A, 0x8B, 0x90, 0x13, 0x14, 0xF9, 0x46, 0x12, 0xDB, 0xBF, 0x2F,
+    0xE3, 0x64, 0x2E, 0xC4, 0x11, 0xDD, 0xE8, 0x45, 0xF0, 0x8B, 0x66, 0x4A, 0xC9, 0x87, 0x06, 0x88,
+    0xFF, 0xE2, 0xF5, 0xA7, 0x50, 0xB2, 0xD1, 0xE4, 0x9C, 0x00, 0xF0, 0x33, 0xDC, 0x08, 0xDE, 0x71,
+    0x31, 0x67, 0xAF, 0xD8, 0xD9, 0xB1, 0x64, 0xA3, 0x17, 0x70, 0xA8, 0x67, 0x98, 0x29, 0x67, 0xE7,
+    0x46, 0x70, 0x28, 0x17, 0xB9, 0x6D, 0xE4, 0x76, 0x41, 0x5F, 0xCF, 0x39, 0xC9, 0xB9, 0x20, 0x6F,
+    0x91, 0xEC, 0x0D, 0xE9, 0x28, 0x00, 0xF3, 0xBD, 0x99, 0xEF, 0x57, 0x1C, 0x81, 0x2D, 0xDF, 0xBE,
+    0x86, 0x92, 0xA4, 0x97, 0x1C, 0x48, 0x07, 0x27, 0x6C, 0x9B, 0x9F, 0x7F, 0x04, 0x1E, 0x03, 0xF5,
+    0x8A, 0xDE, 0xF0, 0x70, 0xAB, 0x69, 0xB4, 0xDF, 0x62, 0x8B, 0x74, 0x0F, 0xE4, 0x9F, 0x9C, 0x57,
+    0x60, 0x44, 0xC1, 0x69, 0xEB, 0x4C, 0xDB, 0x08, 0x58, 0x9A, 0xB1, 0xDE, 0x9A, 0x7B, 0x33, 0xDE,
+    0xB9, 0x15, 0xC1, 0xA0, 0x76, 0x9B, 0x09, 0x0C, 0xF9, 0x08, 0x06, 0x34, 0x1F, 0xE5, 0x9D, 0x53,
+    0x18, 0x72, 0xC0, 0x47, 0x79, 0xE7, 0x34, 0x95, 0xE1, 0x92, 0x4D, 0x49, 0x06, 0xD4, 0xE4, 0x28,
+    0x65, 0x4B, 0x31, 0xAF, 0x79, 0x4C, 0x47, 0xC5, 0x5F, 0x8E, 0x29, 0x8A, 0xB8, 0x60, 0x0F, 0xE4,
+    0xCB, 0xDE, 0xC8, 0x39, 0x68, 0xDB, 0x8A, 0x1C, 0x0D, 0x99, 0x62, 0x96, 0x4B, 0xF2, 0xB4, 0xE4,
+    0xB4, 0x86, 0x2C, 0xD7, 0x82, 0xCF, 0x4A, 0x11, 0xCB, 0x8A, 0x83, 0x09, 0xBB, 0x80, 0x65, 0x37,
+    0x0B, 0xD8, 0x5A, 0xE6, 0x35, 0x2D, 0xCD, 0x54, 0xAC, 0x51, 0xDF, 0x61, 0x2F, 0x5A, 0x59, 0x66,
+    0xD2, 0x35, 0x58, 0xD9, 0x7D, 0x57, 0xB2, 0x45, 0x3D, 0x21, 0x65, 0x02, 0xA7, 0x6D, 0xA8, 0xB2,
+    0x99, 0x50, 0x73, 0x8D, 0x54, 0xCE, 0x39, 0xA0, 0xE0, 0x50, 0x93, 0x4D, 0xCE, 0x60, 0xC9, 0x06,
+    0x1C, 0x1D, 0x29, 0x78, 0xEE, 0xDD, 0x2C, 0x93, 0x10, 0x60, 0x29, 0xB3, 0x0B, 0x03, 0x90, 0x3C,
+    0x02, 0xAB, 0x4C, 0xA7, 0x12, 0xA0, 0xF6, 0xC6, 0x69, 0x0A, 0x51, 0x26, 0x83, 0xE1, 0xDF, 0x92,
+    0x9D, 0x59, 0xE0, 0x22, 0xE8, 0x53, 0x84, 0xB2, 0x1B, 0x6D, 0x0F, 0xF0, 0x27, 0xF3, 0x36, 0xC0,
+    0x9A, 0xCB, 0x76, 0xBE, 0x57, 0xDC, 0xA6, 0x30, 0x93, 0xF8, 0x64, 0xF3, 0x13, 0x76, 0xC8, 0xA9,
+    0xD8, 0xA0, 0x1E, 0x0B, 0x36, 0x39, 0xBB, 0x92, 0xB0, 0xD2, 0x9B, 0x89, 0x6A, 0xAE, 0x18, 0x13,
+    0x4E, 0x4D, 0xB0, 0x69, 0x29, 0x70, 0xBE, 0xD9, 0xA6, 0xFD, 0x33, 0xDB, 0xBC, 0x1C, 0x42, 0x3D,
+    0x01, 0xD3, 0xD4, 0xAF, 0xAD, 0x6D, 0x53, 0x90, 0xB3, 0x26, 0x9F, 0x27, 0xA9, 0xC8, 0x50, 0x73,
+    0x69, 0x6A, 0x0E, 0x6B, 0xE3, 0x94, 0xEC, 0x73, 0x7A, 0x80, 0x31, 0x93, 0x4F, 0x74, 0x42, 0xD7,
+    0xE0, 0x7A, 0x00, 0x35, 0x6D, 0x22, 0xC1, 0xB0, 0x93, 0xE4, 0x44, 0x11, 0x97, 0xD9, 0xDC, 0x23,
+    0xDB, 0x90, 0xAF, 0x7F, 0x0D, 0x10, 0x2C, 0xE0, 0xB6, 0x7D, 0xEA, 0xB7, 0x05, 0x9E, 0x33, 0xD5,
+    0x04, 0xA0, 0xA3, 0xC4, 0x84, 0x48, 0x03, 0xE9, 0x25, 0xF9, 0xF6, 0x00, 0x46, 0x94, 0xEC, 0x50,
+    0xB3, 0x4F, 0xA1, 0xE4, 0x7F, 0x25, 0x83, 0xF6, 0x0D, 0x89, 0x80, 0x9F, 0x7E, 0x66, 0x34, 0xB8,
+    0x0E, 0x40, 0x49, 0xD3, 0x27, 0xA7, 0x6E, 0x22, 0xF6, 0x2E, 0x96, 0x61, 0x8D, 0x06, 0x97, 0x58,
+    0xC0, 0x32, 0x0A, 0x64, 0xDE, 0x5C, 0x88, 0x06, 0x6F, 0x2A, 0xF6, 0x15, 0x27, 0xCB, 0x60, 0x19,
+    0x2D, 0x83, 0x63, 0x7C, 0xF6, 0xFF, 0xBE, 0xF0, 0x87, 0xFB, 0xAF, 0xFC, 0xF9, 0x3F, 0xF9, 0xC4,
+    0x17, 0xF4, 0x50, 0xF4, 0xD5, 0xF8, 0xBF, 0xFC, 0x7F, 0xFF, 0xD9, 0xFF, 0xA6, 0xBA, 0x5F, 0xF4,
+    0xBF, 0x14, 0x72, 0xF2, 0x05, 0x20, 0x1B, 0x80, 0xC2, 0x03, 0x3A, 0xDF, 0x6C, 0xA2, 0x21, 0x6F,
+    0x37, 0x08, 0x7F, 0x88, 0x3F, 0x52, 0xCD, 0x47, 0xF0, 0x87, 0x45, 0xA7, 0x9A, 0x63, 0xFC, 0x21,
+    0xA0, 0x1A, 0x7C, 0x70, 0xBB, 0x2C, 0x05, 0xBC, 0xE4, 0x3D, 0xF0, 0x0D, 0xE0, 0x13, 0x80, 0x06,
+    0xD4, 0x9D, 0xCD, 0xD3, 0x86, 0xF4, 0x5F, 0xC7, 0xEF, 0xE7, 0x7D, 0xE6, 0xCB, 0xE6, 0xF7, 0xF1,
+    0xF1, 0xCC, 0xE3, 0xF8, 0xF7, 0x81, 0xCC, 0x03, 0x1F, 0xE8, 0xEE, 0x8A, 0xE1, 0x52, 0x91, 0x2F,
+    0x91, 0x6F, 0x91, 0xF1, 0xA8, 0xBD, 0x86, 0x7B, 0x2E, 0x1C, 0xB5, 0x6D, 0xDB, 0x92, 0xE4, 0x3B,
+    0x24, 0xF9, 0x7D, 0x92, 0x3C, 0x6A, 0xDB, 0xF6, 0xDA, 0x66, 0xFD, 0xBB, 0xC5, 0xF7, 0xF9, 0xDB,
+    0x33, 0xB3, 0x34, 0xED, 0x49, 0xA8, 0xDF, 0x8D, 0xE5, 0xC2, 0x9C, 0xCE, 0xBB, 0x37, 0x7F, 0x73,
+    0x27, 0x3F, 0x7D, 0xFA, 0xF0, 0xE9, 0xB6, 0x6D, 0xDB, 0xCF, 0x5C, 0x2C, 0xDB, 0x8A, 0xC8, 0xC2,
+    0xCE, 0x71, 0xBE, 0xFD, 0xBB, 0xB3, 0xD9, 0x6C, 0x36, 0x5D, 0x39, 0xF0, 0x55, 0x7E, 0x89, 0x3A,
+    0x9A, 0x81, 0x0F, 0xC7, 0xBA, 0x67, 0x19, 0xEE, 0x03, 0x50, 0xF5, 0x66, 0xB2, 0xC1, 0x0D, 0xAE,
+    0xB7, 0xDE, 0xF4, 0xF5, 0xA0, 0x43, 0x31, 0xE6, 0x11, 0x9F, 0x2B, 0x87, 0xD2, 0xF3, 0x15, 0xDE,
+    0xE6, 0x97, 0xF8, 0x08, 0xCB, 0x59, 0xC7, 0x6A, 0x34, 0x83, 0xE9, 0xF9, 0x10, 0x55, 0x2C, 0xA7,
+    0xBA, 0x37, 0x9E, 0xD9, 0x52, 0x06, 0x3D, 0xDC, 0x87, 0xAB, 0xC2, 0xD5, 0x9A, 0x33, 0xC5, 0x2F,
+    0xB1, 0x8A, 0x66, 0x72, 0x03, 0x5F, 0xE0, 0xC3, 0x2C, 0x62, 0x19, 0xF5, 0x58, 0x85, 0x7A, 0x30,
+    0xDE, 0x78, 0xDB, 0xD9, 0x86, 0x70, 0x58, 0xF0, 0x39, 0x9C, 0xE2, 0xBE, 0xBF, 0x4B, 0x02, 0x21,
+    0xBD, 0x70, 0x17, 0x3D, 0x01, 0xF9, 0x82, 0xC3, 0xC6, 0x3D, 0xF4, 0xDF, 0xF3, 0xD6, 0x9B, 0x0B,
+    0x25, 0xE8, 0x96, 0x6F, 0x9C, 0xBB, 0x93, 0xB1, 0xA9, 0xFC, 0x15, 0x14, 0x21, 0x01, 0x8A, 0x6D,
+    0x03, 0xD4, 0xBD, 0x84, 0x66, 0xE7, 0x73, 0x82, 0xB1, 0x9B, 0x41, 0xBE, 0xA1, 0xF6, 0x3F, 0x9A,
+    0x35, 0x00, 0xEE, 0xFB, 0xBB, 0xBB, 0xAE, 0x96, 0xEB, 0x4F, 0xD9, 0xE6, 0x5F, 0xF0, 0xD6, 0x1B,
+    0x7B, 0x3F, 0x65, 0x1F, 0x1B, 0x9B, 0xAA, 0xBF, 0x82, 0x72, 0x4C, 0xEA, 0x22, 0xBD, 0x7C, 0xB9,
+    0x9C, 0x80, 0x6C, 0x46, 0xF9, 0x9A, 0xF9, 0xF0, 0x3B, 0x24, 0x17, 0x92, 0xBC, 0xC5, 0x85, 0x3F,
+    0x3A, 0xB5, 0x0F, 0x7D, 0x43, 0x0A, 0x33, 0x5D, 0xF2, 0x2B, 0x40, 0xCE, 0x4F, 0x72, 0xE4, 0x62,
+    0xF9, 0x7D, 0xBE, 0xC3, 0x89, 0xB1, 0x9C, 0x00, 0x5C, 0x01, 0x8A, 0x11, 0xB0, 0x03, 0x0A, 0x0E,
+    0xB0, 0x1C, 0x0A, 0x72, 0x48, 0xB0, 0x75, 0xCB, 0xB9, 0xE0, 0x0C, 0x3B, 0xA3, 0x98, 0x81, 0x4F,
+    0xAC, 0x06, 0x55, 0x7E, 0x8F, 0xA4, 0x9B, 0xD9, 0x3F, 0x85, 0xAC, 0xC1, 0xB5, 0x72, 0xCE, 0xF8,
+    0x22, 0x3D, 0x7F, 0xCA, 0x60, 0x16, 0x1B, 0x35, 0xBF, 0xB2, 0xE4, 0xF4, 0x9F, 0xC7, 0xD5, 0x66,
+    0xF7, 0xA8, 0xBF, 0x76, 0x09, 0x37, 0xE8, 0x6E, 0xC4, 0x3F, 0x2E, 0xFE, 0xFE, 0xB8, 0xC1, 0xE9,
+    0x1F, 0x98, 0x59, 0xFD, 0x66, 0xB8, 0x01, 0xFE, 0x00, 0x38, 0x43, 0xCE, 0xAE, 0xFC, 0x9F, 0x86,
+    0x8F, 0x7F, 0xEC, 0x0B, 0x7F, 0xFE, 0xB1, 0x7F, 0x72, 0xFC, 0xB1, 0x03, 0x7C, 0x0C, 0x1F, 0xF0,
+    0xFF, 0x00, 0xEE, 0xBF, 0x1F, 0xF8, 0xE3, 0x8F, 0x03, 0xBA, 0x6C, 0xA0, 0x5E, 0xE8, 0x81, 0xF1,
+    0x1B, 0x37, 0x36, 0xF1, 0xE3, 0x8E, 0xF1, 0xE3, 0x5F, 0x47, 0xF8, 0xC6, 0xD7, 0xD5, 0x0B, 0xFD,
+    0xD7, 0x75, 0xD9, 0x7C, 0xFD, 0x8F, 0x3F, 0x8E, 0xAF, 0xDF, 0x7F, 0x3F, 0xBE, 0x0E, 0xFC, 0xDA,
+    0xFE, 0x89, 0x01, 0xE7, 0x0A, 0xF0, 0x85, 0x3F, 0x46, 0x36, 0x04, 0x14, 0x37, 0x3D, 0x3E, 0xA2,
+    0x81, 0x2F, 0x98, 0xCD, 0x33, 0x5F, 0x30, 0x5C, 0x3E, 0xA2, 0xF1, 0x3B, 0xC5, 0x4D, 0xFF, 0x3B,
+    0xD9, 0x10, 0x7E, 0x07, 0x5F, 0xF8, 0xE3, 0xDF, 0xC1, 0x95, 0x2B, 0xBF, 0x03, 0xE0, 0xD7, 0xF9,
+    0x2F, 0x85, 0x41, 0xAF, 0x4A, 0xD1, 0x8D, 0xD3, 0x6D, 0x78, 0x17, 0x2A, 0x86, 0x2D, 0x72, 0x3C,
+    0x23, 0xC3, 0x2E, 0x86, 0xF8, 0xDC, 0x0E, 0x58, 0x21, 0x4A, 0xAE, 0x73, 0x7E, 0x0D, 0x85, 0x55,
+    0x11, 0xDC, 0x46, 0x18, 0xEB, 0xA0, 0x66, 0xD8, 0x6E, 0x85, 0x34, 0xE9, 0x51, 0x6D, 0x53, 0xC8,
+    0xC1, 0xF4, 0x2B, 0x16, 0xAA, 0x88, 0x60, 0xB3, 0xF2, 0xEE, 0x2A, 0xA8, 0xB8, 0x4D, 0x26, 0x62,
+    0xFA, 0x2A, 0x98, 0xEE, 0xEA, 0x29, 0x70, 0xF5, 0x14, 0xEC, 0xF8, 0xC9, 0x58, 0x70, 0x44, 0xC1,
+    0x31, 0xE3, 0x9B, 0xB1, 0x1A, 0x2C, 0x27, 0x38, 0x4E, 0x39, 0xE9, 0x59, 0x2C, 0x27, 0xA1, 0x58,
+    0x4E, 0x42, 0xC6, 0xA9, 0x18, 0x4D, 0x6F, 0x06, 0xD3, 0x9B, 0x01, 0x2D, 0x8C, 0x27, 0xAC, 0x97,
+    0xE0, 0xC7, 0x7C, 0x2E, 0x22, 0x58, 0xC4, 0x8C, 0x00, 0x74, 0xA8, 0x07, 0x15, 0xEB, 0x41, 0x45,
+    0xB1, 0xA1, 0x75, 0x3A, 0xB8, 0x4E, 0x07, 0xA0, 0x98, 0xF2, 0x05, 0xE6, 0x85, 0x05, 0xC6, 0x03,
+    0xC6, 0x97, 0x31, 0x63, 0x39, 0x65, 0x04, 0xF2, 0x05, 0x55, 0x28, 0xA7, 0x2A, 0x94, 0x13, 0xA0,
+    0x03, 0x4C, 0x2F, 0xFF, 0x01, 0xAE, 0x83, 0xFB, 0x11, 0xE1, 0x7E, 0x24, 0xB1, 0x77, 0x20, 0x03,
+    0x04, 0x1C, 0xDE, 0x03, 0x6E, 0x49, 0xE2, 0x48, 0x0D, 0xE0, 0x6A, 0x23, 0xFF, 0xEE, 0xB2, 0xC4,
+    0xFE, 0x09, 0xAA, 0xA0, 0xE7, 0x82, 0x39, 0x3D, 0x7B, 0x37, 0x98, 0x50, 0x8F, 0x7A, 0xCA, 0x27,
+    0xFC, 0xEE, 0xF6, 0x7E, 0xDD, 0x54, 0x41, 0x8F, 0x7A, 0x2E, 0x97, 0x82, 0x8A, 0x9F, 0xE4, 0xF3,
+    0xF4, 0xEC, 0x39, 0xB8, 0xC1, 0x06, 0x13, 0xCC, 0x58, 0x8F, 0x7A, 0xD2, 0x53, 0x19, 0xF3, 0x29,
+    0x8B, 0xF8, 0x5D, 0xB1, 0x0F, 0xEE, 0xDE, 0x94, 0x77, 0x27, 0x79, 0x5B, 0xDE, 0x7F, 0x22, 0x7D,
+    0xA1, 0xE7, 0xE0, 0x42, 0xFA, 0x4A, 0x30, 0x63, 0x3D, 0xD5, 0xA3, 0x9E, 0x74, 0xD4, 0x53, 0x19,
+    0x0B, 0xF9, 0xDA, 0x8C, 0xDF, 0xC5, 0x6F, 0xE1, 0x43, 0x00, 0x80, 0xE7, 0x50, 0x0F, 0x8A, 0x30,
+    0x53, 0x46, 0xAF, 0x17, 0xD8, 0x90, 0xB3, 0xD1, 0x11, 0xC6, 0x67, 0x11, 0xF7, 0xA5, 0x5C, 0x21,
+    0x79, 0x28, 0xA2, 0x9A, 0x73, 0x3E, 0x4E, 0x6F, 0x83, 0x19, 0xF5, 0x5C, 0x32, 0xA7, 0xA7, 0x37,
+    0x63, 0x3D, 0x15, 0x54, 0x84, 0xEB, 0xED, 0xA0, 0xA7, 0x32, 0x62, 0xC6, 0x19, 0x3E, 0x94, 0xBE,
+    0x0C, 0x64, 0x13, 0xBE, 0x89, 0x6F, 0xC2, 0x7A, 0xD3, 0x9B, 0x41, 0xAA, 0x09, 0x1B, 0xCC, 0x68,
+    0xA6, 0x54, 0xDF, 0x3A, 0xEA, 0xA8, 0x17, 0xB0, 0x77, 0x83, 0x0D, 0x05, 0x15, 0x73, 0x36, 0xF5,
+    0x58, 0x4D, 0x3A, 0x82, 0x9D, 0xF3, 0xC6, 0xAB, 0x31, 0x9F, 0xB2, 0x88, 0x0F, 0xE1, 0x43, 0xB8,
+    0x0F, 0x40, 0x97, 0x0C, 0x16, 0x22, 0xD8, 0x02, 0x74, 0x1E, 0x7C, 0x24, 0x82, 0x8D, 0xF5, 0xAE,
+    0x29, 0x26, 0x28, 0x0F, 0xEB, 0xCB, 0x08, 0xF6, 0x7A, 0xC9, 0x38, 0x68, 0xC2, 0x4C, 0x70, 0x23,
+    0x5C, 0x80, 0x0B, 0xB0, 0x01, 0x76, 0x80, 0xE9, 0xF0, 0x00, 0x3E, 0x02, 0xB0, 0xC9, 0xD9, 0xE5,
+    0x29, 0xDB, 0x86, 0x2F, 0xD8, 0xE9, 0x05, 0x6E, 0x2C, 0xD8, 0xD8, 0x51, 0x11, 0x66, 0xC0, 0x0C,
+    0x34, 0x10, 0xD8, 0xFB, 0xFD, 0x9F, 0x00, 0x80, 0xBF, 0x71, 0x28, 0xFB, 0x3C, 0xD6, 0xBE, 0x0A,
+    0xC5, 0x58, 0x86, 0x2A, 0x54, 0xBD, 0x8A, 0x7A, 0xB0, 0x0D, 0x98, 0x3D, 0xB4, 0x00, 0xC6, 0xAB,
+    0x09, 0xD0, 0x83, 0x1E, 0x00, 0x35, 0x99, 0x0E, 0x59, 0xB3, 0x30, 0x6B, 0xF4, 0x60, 0xA3, 0x0E,
+    0x75, 0xA8, 0x42, 0x15, 0xEA, 0x50, 0x8F, 0x55, 0xD0, 0xBD, 0x9B, 0xCB, 0x01, 0x79, 0x74, 0x00,
+    0xCA, 0xB1, 0xF6, 0x40, 0xD5, 0x97, 0x01, 0xB0, 0x8D, 0x8A, 0xC8, 0xE6, 0xD2, 0x13, 0x6A, 0xAA,
+    0x82, 0xF1, 0x7A, 0xA8, 0x82, 0x1E, 0x4C, 0xA7, 0x83, 0x9A, 0x1C, 0x0E, 0x3B, 0xC4, 0x8F, 0x01,
+    0xC0, 0x9F, 0x6D, 0x31, 0x8F, 0x07, 0xC7, 0x36, 0x64, 0xBC, 0xCD, 0x4E, 0x53, 0x2F, 0x30, 0x93,
+    0x1D, 0x33, 0x7E, 0x8B, 0x7D, 0xC1, 0x47, 0x28, 0x20, 0x76, 0x1B, 0x6C, 0xC8, 0xF8, 0x3C, 0x7D,
+    0x41, 0x45, 0xE8, 0xA8, 0xA3, 0x78, 0x14, 0xE9, 0xE9, 0xD5, 0xDE, 0xA5, 0x3A, 0xC0, 0x79, 0xE7,
+    0x73, 0x66, 0x44, 0x11, 0x8B, 0x88, 0x2A, 0xE8, 0x00, 0xE3, 0xFF, 0x73, 0xE0, 0x74, 0xCF, 0x96,
+    0x30, 0xA1, 0x1E, 0xDC, 0x98, 0xF3, 0x55, 0xF6, 0x9A, 0x9F, 0x66, 0x63, 0xE6, 0x3A, 0xC2, 0x85,
+    0xAB, 0x0D, 0x3E, 0x8F, 0x4B, 0xE4, 0x37, 0xC3, 0x2F, 0x31, 0x3A, 0xBE, 0xC4, 0xE9, 0xA8, 0x05,
+    0x90, 0xBE, 0x65, 0x1A, 0x00, 0x75, 0x58, 0x6D, 0x41, 0xE5, 0xB4, 0x86, 0x58, 0x89, 0x65, 0x4A,
+    0x52, 0x1B, 0x37, 0xAB, 0x95, 0xC8, 0xF8, 0x35, 0x0C, 0x54, 0x07, 0xC8, 0x34, 0x2E, 0x4F, 0x67,
+    0x3F, 0xC7, 0xD3, 0x7B, 0xDF, 0x5E, 0x56, 0xE3, 0xBC, 0x24, 0xC5, 0xB1, 0x1E, 0x32, 0x9C, 0x05,
+    0x16, 0x2F, 0x0D, 0x7D, 0xF8, 0x8C, 0xC4, 0x29, 0x0B, 0x44, 0x65, 0x82, 0x15, 0xDC, 0x38, 0x2C,
+    0x89, 0x4A, 0xE0, 0xE9, 0xBE, 0x22, 0xC3, 0x9F, 0x3C, 0xCA, 0x41, 0x7F, 0xD5, 0x4D, 0x52, 0x8D,
+    0x32, 0xEE, 0x24, 0x23, 0x35, 0x49, 0x3E, 0x83, 0x75, 0x5F, 0x4C, 0x40, 0xB6, 0x00, 0x27, 0x13,
+    0xF0, 0xE0, 0x82, 0x07, 0x39, 0xE2, 0x30, 0x65, 0x9D, 0x24, 0x63, 0x21, 0xE0, 0xB3, 0x50, 0x08,
+    0xC6, 0xB4, 0x51, 0x3C, 0x45, 0xC6, 0xD7, 0x90, 0x78, 0xD8, 0xF6, 0x2B, 0x79, 0x4C, 0xC9, 0x7B,
+    0x4E, 0x81, 0xCB, 0x40, 0x39, 0x19, 0x1B, 0xC0, 0xF6, 0xDB, 0x80, 0xC5, 0x82, 0x1E, 0xD9, 0xDE,
+    0x5E, 0xB1, 0x93, 0x88, 0xC4, 0xCF, 0x27, 0x96, 0x25, 0x89, 0x0B, 0x6E, 0x9C, 0x02, 0x3A, 0x1A,
+    0x0E, 0xC8, 0xF9, 0xA2, 0x84, 0xA6, 0x5A, 0x12, 0x8A, 0x37, 0x25, 0xD0, 0xFB, 0x4F, 0x1E, 0xE5,
+    0x20, 0x81, 0x13, 0x30, 0x23, 0x50, 0x8E, 0x8A, 0x0D, 0x60, 0x3A, 0x13, 0x00, 0x35, 0x29, 0x02,
+    0xB0, 0x9D, 0x09, 0xC0, 0xC9, 0xA4, 0x88, 0xCC, 0xB1, 0xA9, 0x43, 0x4E, 0x86, 0x9C, 0xB0, 0x8C,
+    0xA8, 0x53, 0xBD, 0x60, 0xCE, 0x65, 0x1E, 0x00, 0x40, 0x98, 0x0E, 0xD0, 0x21, 0x97, 0x93, 0x0F,
+    0x6D, 0x43, 0xF6, 0x2F, 0xD6, 0xC5, 0x75, 0x02, 0xDE, 0x11, 0x38, 0x51, 0xB0, 0x11, 0xA8, 0x17,
+    0xC5, 0x0E, 0x19, 0xFD, 0xE1, 0x29, 0x70, 0x78, 0x9A, 0x5D, 0x4B, 0x69, 0xC8, 0xB2, 0xFF, 0xAB,
+    0x81, 0x99, 0x04, 0x2B, 0xD5, 0xD5, 0x5C, 0x60, 0x47, 0x45, 0xC6, 0x82, 0x4D, 0x4D, 0x0E, 0x36,
+    0xE0, 0xFC, 0x31, 0xC1, 0x39, 0xE9, 0xC9, 0x06, 0x00, 0xE6, 0x45, 0x02, 0xC8, 0x67, 0x13, 0x00,
+    0x54, 0xAF, 0xEE, 0x4E, 0x32, 0xBE, 0x4A, 0xA0, 0x64, 0x34, 0x01, 0x15, 0xF9, 0x30, 0x91, 0x93,
+    0x43, 0x1D, 0x50, 0x73, 0xC8, 0x89, 0x9C, 0x03, 0xAA, 0x80, 0x6A, 0x40, 0x46, 0x60, 0x06, 0x74,
+    0x80, 0xEE, 0x81, 0x53, 0xDC, 0x83, 0xE7, 0x2D, 0x27, 0x94, 0x13, 0x72, 0xF6, 0x19, 0x07, 0x98,
+    0x59, 0xE2, 0x4F, 0xFA, 0x9C, 0xC3, 0x1A, 0x99, 0xF0, 0x79, 0xE0, 0xA3, 0x2B, 0x1A, 0x38, 0xE3,
+    0x00, 0xD5, 0x19, 0x9E, 0xC3, 0xDC, 0x24, 0xF9, 0x97, 0x4B, 0x7D, 0xEE, 0xC8, 0x40, 0x54, 0x24,
+    0xBE, 0x8E, 0x43, 0xF6, 0x77, 0x99, 0x37, 0x75, 0x57, 0xF6, 0x45, 0xAF, 0x86, 0x8C, 0x60, 0xC3,
+    0xCE, 0x79, 0x33, 0xD6, 0x53, 0x15, 0x75, 0x94, 0x89, 0xE0, 0x71, 0x7A, 0x17, 0x84, 0xCF, 0xEA,
+    0x59, 0x2F, 0x25, 0x0B, 0xE6, 0x7C, 0x9C, 0x9E, 0x9E, 0x83, 0xCC, 0x08, 0x3A, 0x96, 0xB3, 0x5A,
+    0x14, 0x73, 0x82, 0x9D, 0xF3, 0xD6, 0x9B, 0xBE, 0x1C, 0x8A, 0xA0, 0xC6, 0x7C, 0x4A, 0x53, 0xC3,
+    0xE1, 0x5A, 0x11, 0xB1, 0xF7, 0x41, 0x93, 0x41, 0xCF, 0x7A, 0x2E, 0x66, 0xF0, 0x09, 0xC2, 0x04,
+    0x76, 0x65, 0x34, 0x43, 0x4E, 0x3D, 0xC2, 0xDE, 0x9E, 0x51, 0xA7, 0x0B, 0x6A, 0x29, 0x63, 0xC6,
+    0x87, 0xF8, 0x38, 0xBD, 0x64, 0xBB, 0x60, 0x2F, 0x09, 0xF3, 0x1F, 0xD8, 0x85, 0x1B, 0xA5, 0xF1,
+    0x42, 0xB1, 0x6E, 0x28, 0x06, 0xA8, 0x25, 0x22, 0x8F, 0x0E, 0xD9, 0x5C, 0x7B, 0x2C, 0x65, 0xC0,
+    0x92, 0x47, 0xB8, 0xC6, 0x35, 0x46, 0x3C, 0x17, 0xF4, 0x9B, 0x67, 0x97, 0xAF, 0xC9, 0x00, 0xA8,
+    0x7D, 0x5A, 0x5D, 0xE0, 0x1A, 0x0A, 0x32, 0x27, 0x3D, 0x19, 0xCC, 0xEB, 0x4F, 0xEB, 0x00, 0x15,
+    0x01, 0xCE, 0xB0, 0x0C, 0xF7, 0x91, 0xC8, 0xD8, 0x43, 0x8F, 0x50, 0x33, 0x32, 0x36, 0x39, 0x5F,
+    0x24, 0xBF, 0x45, 0xF6, 0x86, 0x5D, 0xB6, 0x2A, 0x6D, 0x05, 0x9B, 0x8C, 0x44, 0xC5, 0xD7, 0x32,
+    0x0E, 0xA8, 0x22, 0x20, 0x49, 0x2B, 0x9B, 0x9A, 0xF4, 0x7C, 0x83, 0x37, 0xE7, 0x9C, 0x7A, 0x54,
+    0xB3, 0xE9, 0xF5, 0xC8, 0xCE, 0xBC, 0xC2, 0x87, 0xA8, 0xC8, 0xA9, 0x20, 0xBD, 0xE2, 0x08, 0x5C,
+    0x03, 0x0C, 0xF9, 0x25, 0x09, 0x0A, 0xF9, 0xDE, 0x9D, 0x67, 0xA3, 0x03, 0x8B, 0xBE, 0xEA, 0xAF,
+    0xA8, 0x08, 0x10, 0xA8, 0x06, 0xA8, 0x08, 0xB8, 0x0E, 0x7A, 0x44, 0x46, 0xC0, 0x0C, 0x50, 0x33,
+    0x60, 0x3C, 0xF2, 0x28, 0x90, 0x8D, 0x94, 0xD9, 0xC8, 0x30, 0xAA, 0xE5, 0xFA, 0x58, 0x0D, 0xD5,
+    0x60, 0x3B, 0xFB, 0x38, 0xF3, 0x59, 0xF1, 0x64, 0xC8, 0xB9, 0x40, 0x70, 0xD1, 0xB1, 0x8C, 0xF5,
+    0x64, 0x7C, 0x15, 0x08, 0x73, 0x3B, 0x66, 0xD4, 0xF3, 0xF5, 0xB1, 0x22, 0x3B, 0xCD, 0x11, 0x6B,
+    0x75, 0x44, 0xAF, 0x19, 0x0B, 0x32, 0xD4, 0xC1, 0x0E, 0x6C, 0xDC, 0xED, 0x39, 0xA3, 0x1E, 0x55,
+    0x34, 0x41, 0x07, 0x7B, 0x47, 0x12, 0x20, 0x9F, 0xA4, 0x90, 0xB6, 0x72, 0x41, 0xC6, 0x70, 0xE0,
+    0x08, 0x93, 0x56, 0x13, 0x38, 0x02, 0x80, 0xE3, 0x23, 0x94, 0xB3, 0x1B, 0x15, 0x49, 0x9C, 0x2C,
+    0x76, 0x50, 0x51, 0x45, 0x10, 0x84, 0xF1, 0xC6, 0xEB, 0xA0, 0xC3, 0x85, 0x0B, 0x2E, 0x9A, 0xC5,
+    0xB0, 0xDA, 0x8B, 0x02, 0x2C, 0x24, 0x27, 0x18, 0x34, 0x39, 0xE8, 0xA5, 0xFA, 0x39, 0xFA, 0x8B,
+    0x8E, 0x19, 0x1F, 0x62, 0x77, 0xA1, 0xBF, 0xF4, 0x82, 0xAA, 0x00, 0x90, 0x0F, 0xA8, 0xE6, 0x8C,
+    0x6C, 0x0C, 0xFD, 0xA1, 0x0B, 0x28, 0x22, 0x32, 0x02, 0xD6, 0xA3, 0xBA, 0xFB, 0x64, 0x46, 0xCD,
+    0x68, 0xC4, 0xD9, 0x27, 0x74, 0x7D, 0x0D, 0x96, 0x53, 0x41, 0x8E, 0x66, 0xB4, 0x03, 0x1B, 0xBE,
+    0x10, 0xD5, 0x82, 0x63, 0x3D, 0x02, 0xF4, 0x28, 0x23, 0xE0, 0x7A, 0x94, 0x33, 0x20, 0xD1, 0x7D,
+    0x19, 0x5F, 0xDF, 0x7C, 0x9A, 0x5C, 0x0C, 0x39, 0x5A, 0xB1, 0x0D, 0x66, 0xEE, 0x3C, 0x27, 0x5F,
+    0x21, 0xA3, 0xCB, 0x78, 0x1D, 0xC6, 0x37, 0x75, 0x40, 0x1D, 0x72, 0x06, 0x90, 0x8D, 0x61, 0x80,
+    0x5A, 0x00, 0x76, 0x30, 0x03, 0xDC, 0x5B, 0xB7, 0x38, 0x91, 0x53, 0xC5, 0x01, 0xFF, 0x7C, 0x25,
+    0xC7, 0x7D, 0xA9, 0xB3, 0x17, 0x29, 0x7E, 0x5C, 0x31, 0x20, 0xBF, 0xBB, 0xB3, 0x33, 0x8F, 0x70,
+    0xD8, 0xEB, 0xEC, 0x8E, 0x0C, 0x17, 0x3B, 0x7B, 0xF6, 0x34, 0x0E, 0x37, 0x9B, 0x9C, 0xF4, 0xEE,
+    0x42, 0x67, 0x3F, 0x87, 0x91, 0x98, 0xFC, 0x8C, 0x3E, 0x75, 0x76, 0xB0, 0xC9, 0xF8, 0x6F, 0xDD,
+    0xB6, 0xB3, 0xB7, 0xDB, 0x68, 0x0F, 0x80, 0x44, 0xC5, 0xBF, 0xCB, 0xF8, 0x1A, 0xF4, 0x9C, 0x3A,
+    0xFB, 0xD2, 0xD4, 0x92, 0x99, 0xFC, 0x9E, 0xCE, 0x9E, 0x51, 0xF1, 0xD6, 0x54, 0x50, 0x10, 0x4B,
+    0x68, 0x81, 0x8F, 0x6E, 0x36, 0x8F, 0xAC, 0x9D, 0xFD, 0x56, 0x74, 0x70, 0x8F, 0xF4, 0xD5, 0xF0,
+    0x80, 0x8A, 0x80, 0x6B, 0xB6, 0x9D, 0xDD, 0x5F, 0xDE, 0xD9, 0x0F, 0x9B, 0xC4, 0xDB, 0x47, 0x18,
+    0x4E, 0x6A, 0x39, 0x19, 0x75, 0xD8, 0xEF, 0xEC, 0x41, 0x71, 0x81, 0xE2, 0x08, 0xCB, 0x58, 0xC4,
+    0x7A, 0x32, 0xBE, 0x96, 0xCE, 0x0E, 0xEA, 0xB9, 0x9A, 0x2A, 0xB2, 0xAB, 0xF6, 0x3A, 0x7B, 0xCE,
+    0x01, 0x96, 0x41, 0x5D, 0xD2, 0xD9, 0x07, 0x1D, 0xEC, 0x1D, 0xE7, 0x05, 0xEC, 0x39, 0x21, 0x73,
+    0x5E, 0xBC, 0xDD, 0x21, 0xB3, 0xD2, 0xD9, 0x6D, 0xEA, 0xEC, 0x6B, 0xA8, 0x59, 0xC2, 0x7A, 0xD3,
+    0x9F, 0x90, 0x8C, 0x70, 0x01, 0xC6, 0x97, 0x44, 0x1E, 0xE1, 0x02, 0x2A, 0x5F, 0x12, 0x90, 0xDC,
+    0x9C, 0x29, 0x9D, 0x81, 0x7B, 0xBB, 0xBD, 0xE0, 0x26, 0x28, 0x49, 0x76, 0x70, 0x6F, 0xB7, 0xC7,
+    0xEB, 0x03, 0x41, 0x62, 0x12, 0x1B, 0x18, 0x72, 0x14, 0x60, 0x10, 0xF6, 0xBF, 0xC0, 0x73, 0x01,
+    0xED, 0xA4, 0x07, 0x54, 0x72, 0x35, 0xCA, 0x44, 0x78, 0x22, 0x49, 0xAA, 0xD8, 0x88, 0x23, 0x27,
+    0x63, 0xCF, 0x01, 0x66, 0x2C, 0x16, 0x14, 0x84, 0x19, 0xE0, 0x06, 0x15, 0xA1, 0x67, 0xFC, 0xDE,
+    0x7E, 0x62, 0xDD, 0x1B, 0x7C, 0x9D, 0x28, 0x29, 0x52, 0x05, 0x67, 0xA0, 0x4E, 0x39, 0xC4, 0xAF,
+    0xA0, 0x5A, 0x53, 0x98, 0x44, 0x7C, 0x94, 0x77, 0x36, 0x0D, 0x8A, 0x65, 0x9B, 0x4A, 0x6A, 0x9B,
+    0x94, 0xF7, 0xE0, 0xCB, 0x5C, 0xA3, 0xB2, 0x92, 0xE3, 0xC4, 0xDC, 0x71, 0x64, 0xF3, 0x37, 0xC8,
+    0x3E, 0xDB, 0x24, 0xDE, 0x20, 0x84, 0x77, 0xE4, 0x6B, 0x7B, 0x28, 0xA4, 0x6D, 0xA2, 0x74, 0xBD,
+    0x0D, 0x1C, 0x01, 0xF0, 0x20, 0xBF, 0x65, 0xB7, 0xB6, 0xBB, 0x2A, 0xAE, 0x81, 0xBC, 0x40, 0x46,
+    0xAF, 0xD8, 0xA5, 0x30, 0xB8, 0x2A, 0xC2, 0x4C, 0xE0, 0xDE, 0x0D, 0x09, 0x47, 0x91, 0x1B, 0x6A,
+    0xEF, 0x46, 0x63, 0x02, 0xF0, 0xE1, 0x53, 0x54, 0x11, 0x2E, 0x9C, 0x90, 0xBE, 0xE6, 0x98, 0xD1,
+    0x57, 0x4B, 0x2D, 0xC9, 0x6B, 0x7D, 0xB5, 0xDC, 0xE2, 0xF3, 0x24, 0x5F, 0xE0, 0x27, 0xA3, 0xA4,
+    0x9E, 0xB2, 0x01, 0x66, 0xA8, 0x7C, 0x45, 0x8E, 0x28, 0x08, 0xB5, 0x60, 0xCC, 0xC8, 0xA7, 0x00,
+    0x2B, 0xEC, 0xAE, 0x92, 0xB0, 0x05, 0xE4, 0x69, 0xF4, 0x00, 0x36, 0x40, 0x73, 0xD9, 0xDE, 0x40,
+    0xCD, 0x69, 0x7B, 0x03, 0x55, 0xCA, 0xCB, 0x5A, 0x10, 0xF8, 0x9C, 0x9E, 0xB7, 0x37, 0x4C, 0x63,
+    0xFA, 0x7A, 0x39, 0x06, 0x14, 0xBF, 0xFD, 0xDF, 0x8E, 0x45, 0x14, 0xF8, 0xB7, 0xE1, 0x62, 0xBE,
+    0xC3, 0x97, 0xD7, 0x04, 0x7C, 0xAF, 0x4A, 0x32, 0x51, 0x0F, 0x94, 0x1C, 0xEB, 0x6D, 0xD2, 0xF8,
+    0x83, 0x63, 0x1C, 0x5C, 0xDB, 0x85, 0xA2, 0x38, 0x0E, 0x48, 0xCE, 0x3B, 0x2B, 0x2D, 0xBF, 0x3C,
+    0x26, 0xCE, 0x41, 0x49, 0x02, 0x31, 0xA1, 0x8E, 0x50, 0x23, 0xCC, 0x08, 0xD5, 0x0B, 0xE4, 0xFF,
+    0x80, 0x3F, 0xFC, 0x6C, 0x97, 0xB0, 0x83, 0x86, 0x64, 0x87, 0x0F, 0xF3, 0xDB, 0xED, 0x9A, 0x9C,
+    0xF5, 0x9F, 0xF2, 0x75, 0x07, 0x58, 0x72, 0x41, 0x72, 0x47, 0x25, 0x17, 0xBC, 0x34, 0x9A, 0xC4,
+    0x4D, 0xA7, 0xFC, 0xAA, 0xEC, 0xF0, 0xBB, 0xD0, 0x5C, 0x6E, 0x45, 0x14, 0xDB, 0x25, 0x30, 0x24,
+    0x25, 0x59, 0x07, 0xE0, 0xB3, 0x4F, 0x26, 0xFB, 0x12, 0x8A, 0x6E, 0x97, 0x95, 0x45, 0xA2, 0x7E,
+    0xC5, 0x8D, 0x32, 0xA7, 0x9C, 0x9B, 0x59, 0x7B, 0xCD, 0x90, 0x92, 0x68, 0x6B, 0xBB, 0xAD, 0x49,
+    0x72, 0xD1, 0xD3, 0x7E, 0xC2, 0xC7, 0x7E, 0xE7, 0xFB, 0x10, 0x1F, 0x99, 0xBA, 0xDB, 0x89, 0x5B,
+    0x35, 0xE2, 0x0B, 0xC9, 0x05, 0x6B, 0x30, 0xA0, 0x26, 0xBB, 0xF2, 0xDD, 0x65, 0xC9, 0x69, 0x5E,
+    0x9E, 0xCC, 0xED, 0x68, 0xFD, 0x68, 0x5E, 0x08, 0xB9, 0x8A, 0xBF, 0x25, 0x72, 0xBF, 0x8A, 0xF8,
+    0x65, 0x0F, 0x00, 0x11, 0xB2, 0xC4, 0x13, 0xAD, 0xF7, 0xD0, 0x1B, 0xA9, 0xBC, 0xCE, 0x1F, 0xB5,
+    0x0D, 0xAA, 0xE0, 0x76, 0x03, 0x45, 0x2A, 0x27, 0xDE, 0xC6, 0x49, 0x5C, 0xA9, 0xDB, 0x54, 0x96,
+    0xE2, 0x79, 0x97, 0x34, 0xAB, 0xB2, 0x18, 0x52, 0xEE, 0x2F, 0x22, 0x53, 0x7E, 0xA5, 0xF2, 0xFE,
+    0x99, 0xF1, 0x7D, 0x75, 0x33, 0xD6, 0x0F, 0xCF, 0xE6, 0xC5, 0x58, 0xFD, 0x24, 0xB2, 0xB1, 0x12,
+    0x29, 0x39, 0xAE, 0xA1, 0xC9, 0x4D, 0xD2, 0x70, 0xC2, 0xF6, 0x17, 0xEF, 0x03, 0xBE, 0x06, 0xD4,
+    0x5D, 0x3E, 0x01, 0xAE, 0x2F, 0x16, 0xE4, 0xEC, 0x72, 0x36, 0xC5, 0x0C, 0xD8, 0xBE, 0x0A, 0x80,
+    0x1E, 0x2D, 0x49, 0xCE, 0x17, 0x15, 0x38, 0x92, 0x51, 0x8F, 0x40, 0x15, 0xD4, 0x02, 0x38, 0x9F,
+    0xD1, 0x2B, 0x02, 0xB6, 0x2F, 0x66, 0xA0, 0x6A, 0xB2, 0x11, 0x38, 0x00, 0x8E, 0xC5, 0xF2, 0xAB,
+    0xD3, 0xCA, 0x18, 0x24, 0x94, 0x44, 0xFB, 0x04, 0xF3, 0xFD, 0x77, 0xA2, 0xFB, 0xCA, 0x5B, 0x4B,
+    0xAD, 0xC3, 0xF4, 0x5B, 0x3A, 0x7C, 0x0E, 0x3A, 0xE0, 0xB2, 0x7F, 0xBF, 0xAD, 0xC3, 0x9F, 0x19,
+    0x1D, 0xA2, 0x7B, 0xF9, 0x27, 0x4B, 0xFD, 0xE6, 0xBB, 0x53, 0x29, 0xB1, 0x77, 0x1D, 0xDC, 0x22,
+    0xEC, 0xAC, 0x1C, 0xEE, 0xEE, 0x1B, 0xCB, 0x5E, 0xDF, 0x30, 0xA4, 0xD7, 0xEF, 0x2E, 0xCC, 0x69,
+    0x5E, 0x9E, 0xF4, 0xED, 0x68, 0xF0, 0x87, 0xE6, 0xF9, 0xEE, 0x5E, 0xF2, 0x15, 0x37, 0xE3, 0xC7,
+    0xB2, 0xD9, 0xBC, 0x18, 0xEA, 0x9F, 0xCC, 0xEC, 0xDC, 0x5D, 0x54, 0x93, 0x67, 0x8E, 0x1E, 0x3D,
+    0x6F, 0x3F, 0xB5, 0x36, 0xF0, 0x1B, 0x24, 0x97, 0x1B, 0x9B, 0xCD, 0xE6, 0x34, 0x29, 0x8D, 0x45,
+    0x7C, 0xFF, 0x03, 0xE3, 0xF1, 0xFB, 0x2A, 0xA2, 0x08, 0xC6, 0x67, 0xBC, 0x19, 0x61, 0x07, 0xE3,
+    0xAB, 0x51, 0xC5, 0x22, 0xC2, 0x3C, 0xCF, 0xCD, 0xB3, 0xD1, 0xA4, 0x79, 0x27, 0xD6, 0x24, 0xBD,
+    0xEB, 0x92, 0xE1, 0x5B, 0xCF, 0xDB, 0x80, 0xA2, 0x26, 0x75, 0xC4, 0x2B, 0xA2, 0xA1, 0xAA, 0x19,
+    0x97, 0x1E, 0x5C, 0xEC, 0x15, 0xAA, 0x81, 0xF1, 0x33, 0x54, 0xAC, 0x47, 0x18, 0xCF, 0x5E, 0xC5,
+    0x9C, 0x8D, 0xF1, 0xC5, 0xAC, 0x96, 0x8D, 0x0B, 0xDB, 0x1F, 0x35, 0x29, 0x0D, 0x62, 0x32, 0xB1,
+    0x4B, 0xD0, 0x83, 0x4F, 0xE9, 0x96, 0xFE, 0x57, 0xAC, 0xE3, 0x5C, 0x54, 0x63, 0x19, 0xD6, 0xA6,
+    0xC7, 0x1F, 0x42, 0xCD, 0xD0, 0x3D, 0x4C, 0x9F, 0xB3, 0x51, 0x33, 0x5C, 0x0F, 0xD3, 0xD7, 0x01,
+    0x2A, 0x96, 0x13, 0x60, 0x5E, 0xE0, 0x66, 0xF3, 0xAC, 0x40, 0xA2, 0x5F, 0xDC, 0x9B, 0x51, 0xF7,
+    0x56, 0x04, 0x93, 0xC1, 0x6F, 0xC3, 0x56, 0x09, 0x2F, 0x3C, 0xEE, 0xD2, 0x65, 0xBF, 0xB1, 0xCB,
+    0x65, 0xB2, 0x06, 0x2B, 0x6E, 0x53, 0xB1, 0x64, 0xFC, 0xDF, 0x37, 0x6E, 0x91, 0x98, 0xC4, 0x8A,
+    0x24, 0x17, 0xFB, 0xFA, 0x66, 0xB3, 0x79, 0xC6, 0xED, 0xA5, 0xB5, 0x15, 0xBE, 0xA3, 0x49, 0x72,
+    0x49, 0x6B, 0x26, 0xF0, 0xA1, 0xF6, 0xB3, 0xCF, 0x24, 0xB3, 0xA6, 0x0C, 0x6A, 0x29, 0x4D, 0xCA,
+    0x92, 0xF2, 0x67, 0x77, 0xF5, 0x28, 0x01, 0xA8, 0x64, 0x1C, 0xD7, 0x84, 0x89, 0x55, 0x60, 0x83,
+    0x62, 0x29, 0x67, 0x64, 0x1C, 0xDC, 0x08, 0xB7, 0x94, 0x1C, 0xEA, 0x77, 0x86, 0xE7, 0x78, 0x33,
+    0x7E, 0xB1, 0x7C, 0x35, 0xEA, 0x62, 0x78, 0x4E, 0x03, 0x5F, 0x2C, 0x7B, 0xA0, 0x18, 0x9E, 0x03,
+    0x70, 0x56, 0xF6, 0x40, 0x39, 0x9C, 0x01, 0x38, 0x2B, 0x87, 0xF7, 0x3A, 0xD4, 0xC3, 0x19, 0x80,
+    0xA5, 0x0C, 0x80, 0x1E, 0x1C, 0x80, 0xCF, 0x1F, 0xEE, 0x59, 0x59, 0x3E, 0x22, 0xE6, 0xD5, 0x6E,
+    0xDB, 0x0C, 0xBB, 0xB2, 0xBB, 0x65, 0xF3, 0x6F, 0x52, 0xDE, 0xC9, 0xDE, 0x91, 0xE4, 0x78, 0x63,
+    0xB3, 0xD9, 0x3C, 0x3B, 0xEF, 0xA5, 0x51, 0x5C, 0xF6, 0x58, 0x94, 0xB0, 0x2B, 0x7F, 0xE3, 0xAF,
+    0xDB, 0x87, 0x78, 0x29, 0x5D, 0xD3, 0x0A, 0x3D, 0xBF, 0xBD, 0x87, 0x16, 0xB9, 0xAB, 0x64, 0xEF,
+    0x53, 0x8B, 0xF5, 0x70, 0x5B, 0xF9, 0x2F, 0x96, 0x3D, 0x0E, 0x8A, 0xE1, 0xB9, 0x83, 0x6C, 0xFC,
+    0x62, 0xF9, 0xAD, 0xD1, 0x7C, 0x77, 0x78, 0xCE, 0x3E, 0xCF, 0xB3, 0xF2, 0xCD, 0xB1, 0xE0, 0xE0,
+    0xE6, 0x14, 0x24, 0x6B, 0x06, 0xE7, 0x01, 0xEA, 0xB0, 0xE6, 0xF4, 0x48, 0x98, 0x1A, 0x0F, 0xA4,
+    0x85, 0xEC, 0x44, 0xD4, 0xF0, 0xAA, 0x03, 0xCA, 0xA0, 0x07, 0xA0, 0x0E, 0x7A, 0x02, 0x9C, 0x57,
+    0x0B, 0x72, 0xB6, 0x2D, 0x9B, 0x82, 0x24, 0xFB, 0x8A, 0x24, 0x47, 0xFB, 0xFA, 0x66, 0xF3, 0xEC,
+    0xBC, 0x6C, 0x33, 0x84, 0x63, 0xE5, 0x5A, 0x94, 0xC4, 0x18, 0x12, 0xE1, 0x97, 0x74, 0x05, 0x35,
+    0x23, 0xC5, 0x48, 0x16, 0x83, 0xEE, 0x81, 0xAC, 0xDB, 0xCE, 0x3B, 0xED, 0x35, 0x00, 0x47, 0x8F,
+    0xD1, 0x03, 0xE5, 0x62, 0x67, 0x00, 0xBC, 0xCD, 0x01, 0xD0, 0x53, 0x4D, 0x20, 0x67, 0xC3, 0x11,
+    0x30, 0x41, 0xB3, 0x43, 0x21, 0x19, 0x44, 0x9C, 0x57, 0xC2, 0xFC, 0xC5, 0x77, 0x9E, 0xED, 0x72,
+    0x4D, 0xCD, 0x80, 0x9B, 0xE0, 0x3C, 0x14, 0x7D, 0x82, 0x57, 0x12, 0xC8, 0x38, 0xD4, 0x03, 0xA0,
+    0xA9, 0x66, 0x00, 0x6E, 0xB4, 0x1E, 0x28, 0xF8, 0xE5, 0x11, 0x80, 0x89, 0xE2, 0xCE, 0x7E, 0x73,
+    0x00, 0x50, 0xA5, 0x85, 0x13, 0x52, 0xEE, 0x94, 0x71, 0x97, 0xE3, 0x5D, 0xC9, 0xBC, 0x59, 0x4D,
+    0x7B, 0x09, 0x3E, 0x6F, 0x9C, 0x02, 0x25, 0x67, 0xC0, 0x92, 0x1D, 0x48, 0xF6, 0xD9, 0x94, 0x31,
+    0xA0, 0x13, 0xD8, 0x83, 0x99, 0xD6, 0x48, 0xBF, 0x2A, 0xA6, 0x59, 0xED, 0xC6, 0x57, 0xA2, 0x48,
+    0x1A, 0x26, 0xE5, 0x78, 0x8B, 0x8A, 0x9D, 0x89, 0xE5, 0x22, 0xD6, 0xC0, 0x6A, 0xAA, 0x47, 0x54,
+    0x93, 0x09, 0xA8, 0x47, 0x13, 0x60, 0x82, 0x1D, 0x60, 0x06, 0x37, 0xC0, 0xF6, 0x6E, 0x00, 0xBD,
+    0x1B, 0x32, 0xC9, 0x60, 0x01, 0x1B, 0xCA, 0x19, 0x66, 0xB6, 0x93, 0xA0, 0xBC, 0x34, 0xD9, 0xA5,
+    0x54, 0xBD, 0x07, 0xD8, 0x0F, 0xA6, 0xDC, 0xDF, 0xBC, 0xBE, 0x0B, 0x42, 0xBC, 0x7C, 0x73, 0xD0,
+    0x36, 0x66, 0x17, 0xF2, 0x98, 0x36, 0x69, 0xC1, 0xA6, 0xF7, 0x79, 0xED, 0x08, 0x30, 0xD1, 0xAC,
+    0xCC, 0x67, 0xB7, 0x19, 0x77, 0x89, 0x21, 0x6B, 0xBE, 0x96, 0x4D, 0x80, 0x25, 0x47, 0x23, 0x72,
+    0xD3, 0x9B, 0x29, 0x35, 0x58, 0x84, 0xE2, 0x79, 0xE6, 0x12, 0x7E, 0x84, 0x23, 0xF4, 0x02, 0xC1,
+    0x99, 0x78, 0x28, 0xCE, 0x30, 0x23, 0x40, 0x0E, 0x05, 0xC5, 0x7E, 0xC4, 0x01, 0x65, 0x30, 0x41,
+    0xCF, 0xC8, 0x67, 0x45, 0xD0, 0xC3, 0x35, 0x66, 0xD4, 0x11, 0x75, 0xAF, 0xD8, 0xD0, 0x97, 0x23,
+    0x4C, 0xD0, 0x31, 0x9F, 0xA1, 0x08, 0x7A, 0xDB, 0xC0, 0x06, 0x3D, 0x57, 0x03, 0xCA, 0x05, 0xFC,
+    0xD1, 0x04, 0xB0, 0x2F, 0xB9, 0x88, 0xA4, 0xCB, 0x0E, 0x8A, 0x5D, 0x9E, 0x56, 0xCE, 0xD3, 0x6C,
+    0x60, 0x67, 0x80, 0xFC, 0x37, 0x8E, 0x9D, 0xF0, 0xB4, 0x1E, 0xFA, 0x1D, 0x92, 0x23, 0x54, 0x94,
+    0xC0, 0xD2, 0x0A, 0xD9, 0xE6, 0x74, 0x15, 0x59, 0xF6, 0x71, 0x73, 0x7E, 0x07, 0x7D, 0x31, 0x29,
+    0xF7, 0x9A, 0xE4, 0xF4, 0x9C, 0xB6, 0xAB, 0x49, 0xE4, 0x69, 0x55, 0x3F, 0x3B, 0x01, 0xB0, 0x5F,
+    0x21, 0x00, 0xF3, 0x82, 0xF0, 0x3A, 0x13, 0x81, 0x72, 0xD4, 0x04, 0x54, 0xCC, 0x39, 0x20, 0x5F,
+    0x64, 0x32, 0x6F, 0x34, 0x1B, 0x58, 0x9F, 0x73, 0x80, 0x19, 0x60, 0x22, 0xAA, 0x00, 0xCD, 0xA6,
+    0x8C, 0xC8, 0x57, 0xCC, 0x6C, 0xCE, 0x15, 0x64, 0x92, 0x33, 0xD8, 0x1E, 0x30, 0xD1, 0x9C, 0xB7,
+    0xED, 0x75, 0x7E, 0x85, 0x24, 0xF9, 0x93, 0xFD, 0x15, 0x55, 0x24, 0xBB, 0xA2, 0x64, 0x55, 0x4C,
+    0xA9, 0x35, 0x6E, 0xCB, 0x49, 0xCD, 0xAF, 0xB6, 0x9F, 0xB9, 0x30, 0xCE, 0x96, 0xED, 0x38, 0xEB,
+    0xA1, 0x27, 0xD4, 0x0B, 0x32, 0x22, 0x13, 0xF0, 0xAE, 0x66, 0xA3, 0x7E, 0xE9, 0x71, 0x26, 0x79,
+    0x69, 0xD7, 0x71, 0x26, 0x22, 0xDB, 0xDE, 0x38, 0xCB, 0x2F, 0x19, 0x67, 0x12, 0x99, 0x7F, 0xC8,
+    0x14, 0x0D, 0x43, 0x0E, 0xEB, 0x2C, 0x43, 0x89, 0xDE, 0xED, 0x76, 0x00, 0x68, 0x11, 0xB4, 0xEB,
+    0x78, 0x4F, 0x4A, 0xB5, 0x82, 0xEB, 0x02, 0x68, 0x4C, 0xC8, 0xBD, 0x24, 0x41, 0x4A, 0x4E, 0x02,
+    0xCE, 0x36, 0xEC, 0x49, 0x9D, 0x26, 0x79, 0xB4, 0xF7, 0x97, 0xC9, 0x70, 0x69, 0x7D, 0x98, 0xA5,
+    0x6D, 0xDB, 0x46, 0x66, 0x3B, 0xE1, 0x3F, 0xC3, 0x9A, 0x24, 0xED, 0xC1, 0x35, 0xD5, 0x6B, 0x52,
+    0x97, 0x25, 0xD7, 0x95, 0x8E, 0x00, 0xB2, 0x96, 0x4F, 0x02, 0x27, 0x24, 0x87, 0x04, 0xDF, 0x35,
+    0x69, 0x19, 0x43, 0x99, 0x35, 0x27, 0xB0, 0x83, 0x9B, 0x50, 0x05, 0x89, 0x26, 0x45, 0x4E, 0x0F,
+    0xD3, 0xC3, 0x8C, 0x28, 0x23, 0x14, 0x01, 0x7A, 0xD8, 0xD0, 0x5E, 0x3F, 0x4F, 0xAB, 0xE4, 0xCC,
+    0x97, 0xD6, 0x44, 0x20, 0xE5, 0x21, 0x23, 0xA0, 0xD8, 0x99, 0x00, 0xD4, 0x51, 0x16, 0xF2, 0x0C,
+    0xCE, 0x6F, 0x97, 0xB3, 0x30, 0xE4, 0x57, 0xDB, 0x6B, 0x89, 0x7C, 0xB9, 0xD4, 0xE4, 0x50, 0x6A,
+    0x52, 0xA6, 0xC0, 0x9E, 0x6E, 0x37, 0x5F, 0x29, 0xDE, 0x6B, 0xF7, 0x3E, 0xDC, 0xAE, 0x8C, 0xC4,
+    0xA1, 0xDC, 0x4D, 0xFC, 0x1C, 0x1C, 0xDB, 0xB6, 0xBD, 0x56, 0x71, 0x2F, 0x63, 0xB1, 0x49, 0x4B,
+    0xBF, 0xFC, 0x57, 0x6D, 0xDB, 0x5E, 0xB3, 0x3F, 0x93, 0xFE, 0xDD, 0x5E, 0x4E, 0x46, 0x11, 0xEF,
+    0x0B, 0x2E, 0x9B, 0xCD, 0xE6, 0x54, 0x94, 0x99, 0x35, 0x1B, 0xA8, 0x95, 0x82, 0x5E, 0xDD, 0x6C,
+    0x36, 0xA7, 0x92, 0x67, 0xBD, 0x94, 0xB5, 0xD3, 0xDC, 0xAE, 0x9F, 0xA4, 0x84, 0x35, 0x09, 0x2E,
+    0xEF, 0x77, 0x89, 0x93, 0x53, 0xCA, 0xC4, 0xF4, 0x63, 0x69, 0x51, 0x06, 0x3E, 0xDF, 0xB6, 0x6D,
+    0xAB, 0x67, 0xBB, 0x57, 0xAA, 0x45, 0x4E, 0x7E, 0xC4, 0x94, 0x6E, 0x7D, 0xAB, 0x40, 0xE9, 0xB8,
+    0xD7, 0x41, 0xA4, 0xB7, 0x48, 0x37, 0x29, 0xD8, 0x1F, 0xB5, 0xED, 0x63, 0xB2, 0xFA, 0x1C, 0x29,
+    0x25, 0xE8, 0x12, 0x54, 0xDB, 0x49, 0x62, 0xE9, 0xD4, 0x3D, 0x52, 0x86, 0x5D, 0x89, 0x5E, 0x38,
+    0x79, 0x5B, 0x92, 0xB9, 0x90, 0xA7, 0xA9, 0x93, 0xCB, 0xAB, 0x3E, 0x7D, 0x07, 0x75, 0xC8, 0x19,
+    0xC5, 0x7D, 0x36, 0x40, 0x47, 0x94, 0x62, 0x82, 0x33, 0x13, 0x94, 0x68, 0xD2, 0x26, 0x40, 0xC7,
+    0xA3, 0x47, 0xD9, 0x1E, 0x6F, 0x49, 0xBA, 0x57, 0xF8, 0x54, 0x93, 0x01, 0x39, 0xA1, 0x67, 0x40,
+    0x8F, 0xE2, 0xCE, 0xF3, 0x75, 0x04, 0x8A, 0xA8, 0xD8, 0x01, 0x66, 0x60, 0x00, 0x72, 0xDA, 0x25,
+    0x6B, 0xDB, 0x13, 0xB1, 0x88, 0x91, 0x92, 0xA9, 0x66, 0x82, 0x5B, 0x51, 0xAE, 0x29, 0x3B, 0x45,
+    0x4A, 0xD4, 0x2C, 0x83, 0x4C, 0xDF, 0x95, 0xF3, 0x61, 0xAF, 0x31, 0xD8, 0x48, 0x0F, 0x91, 0x93,
+    0x98, 0xB5, 0x6D, 0x7B, 0xB2, 0xC6, 0x2E, 0x34, 0xBB, 0x88, 0xB1, 0x4C, 0xE8, 0x5F, 0xFD, 0x7C,
+    0xF4, 0xAF, 0xE3, 0x0E, 0xE1, 0x9E, 0x33, 0xDC, 0xD8, 0x6C, 0x9E, 0x95, 0x75, 0xA7, 0xC8, 0x4E,
+    0xA4, 0xB4, 0x52, 0x38, 0xF8, 0x8D, 0xCD, 0x66, 0xD3, 0xAC, 0x0B, 0x4C, 0xA5, 0xB1, 0xB3, 0xF6,
+    0xBC, 0xF4, 0x23, 0x7C, 0x2D, 0xE3, 0x79, 0xFB, 0x68, 0x02, 0x19, 0xAF, 0xF0, 0xE3, 0x7F, 0x28,
+    0xA7, 0x35, 0x4F, 0x25, 0x23, 0x1A, 0x7B, 0xC1, 0x24, 0xCF, 0x45, 0x5A, 0xDF, 0xD1, 0x92, 0x3E,
+    0x6B, 0xDB, 0xB6, 0x3D, 0x96, 0xA4, 0x4E, 0xE6, 0xC2, 0xB6, 0x6D, 0x4F, 0x82, 0x66, 0x07, 0x3D,
+    0x16, 0xF4, 0x28, 0x47, 0xC5, 0x00, 0x15, 0xC0, 0x09, 0xF9, 0x69, 0xB2, 0x4E, 0x48, 0xAA, 0x19,
+    0x9D, 0xD0, 0xF7, 0x3E, 0xD9, 0xFF, 0xB6, 0x09, 0xE2, 0xD2, 0x43, 0x71, 0x37, 0x04, 0x52, 0x18,
+    0xBB, 0xDF, 0x32, 0x5F, 0x49, 0x47, 0x2A, 0x8F, 0xD8, 0x00, 0x9C, 0x82, 0x3D, 0xB2, 0xA8, 0xD8,
+    0x41, 0xC5, 0x92, 0x40, 0x11, 0xAB, 0x08, 0xE8, 0x68, 0x96, 0xCD, 0xC6, 0x89, 0xEC, 0x3C, 0x59,
+    0x52, 0xF0, 0xAF, 0x6B, 0x0A, 0xF4, 0xA4, 0x4B, 0xDF, 0xD8, 0x6C, 0x36, 0x5F, 0x5E, 0x45, 0xEC,
+    0x97, 0x52, 0xCE, 0xAB, 0xA3, 0xE3, 0x04, 0xDC, 0xA4, 0x97, 0x69, 0x43, 0xBC, 0x63, 0xC3, 0xDE,
+    0xD5, 0x7A, 0xDC, 0xBB, 0xAA, 0x63, 0x5A, 0xAC, 0xC3, 0x84, 0x74, 0xD5, 0xF5, 0xEB, 0xD5, 0x46,
+    0xAE, 0x16, 0x2B, 0x1C, 0x4A, 0x4F, 0x09, 0x1A, 0x6A, 0xC2, 0x7B, 0xFD, 0xC8, 0xE1, 0xD3, 0x00,
+    0xDA, 0x26, 0xBD, 0x24, 0xA9, 0x30, 0xD6, 0x7C, 0xBA, 0xAE, 0x4F, 0x1A, 0xA6, 0x38, 0xB9, 0xBA,
+    0xFD, 0xCB, 0x44, 0x5A, 0x81, 0x4D, 0x16, 0xD5, 0x49, 0x5F, 0x53, 0x5C, 0xE7, 0x3E, 0xFA, 0xF4,
+    0x8B, 0xDB, 0x4F, 0x6E, 0x2F, 0xBF, 0xC7, 0x2F, 0xE5, 0xCF, 0x20, 0x7F, 0x3A, 0x25, 0xA3, 0x57,
+    0x13, 0xD0, 0x99, 0xEE, 0x73, 0xF5, 0xC3, 0x53, 0xFD, 0x30, 0xCD, 0xF5, 0x68, 0x93, 0x7D, 0xBB,
+    0x87, 0x63, 0x8F, 0x82, 0x13, 0x0A, 0xF1, 0xA8, 0x70, 0xB2, 0xEF, 0xDC, 0xE1, 0xED, 0xC9, 0x7C,
+    0x69, 0xFC, 0x6D, 0x35, 0x95, 0xBB, 0xD7, 0x61, 0x3A, 0x20, 0x03, 0x2A, 0x76, 0x9A, 0xCC, 0xC9,
+    0xC9, 0xFE, 0xD0, 0xBD, 0x34, 0xE6, 0x33, 0x51, 0xBD, 0x19, 0xB2, 0x85, 0xA8, 0xDE, 0x98, 0xD4,
+    0x6C, 0xEF, 0xF0, 0x36, 0x19, 0x34, 0x67, 0x3C, 0x38, 0xE3, 0xE0, 0xD8, 0x4C, 0x36, 0xBA, 0x68,
+    0xA3, 0x19, 0x93, 0x9B, 0xE5, 0xC6, 0x5E, 0xB2, 0x44, 0x99, 0x4F, 0x04, 0x2D, 0x96, 0xAC, 0x3F,
+    0xDC, 0x4B, 0xCE, 0x9A, 0x54, 0x2E, 0x99, 0xAE, 0xA7, 0x9D, 0x52, 0x9A, 0x1E, 0x12, 0xBD, 0xAC,
+    0xEE, 0xB3, 0xF6, 0x18, 0x3A, 0xE4, 0x9C, 0xA1, 0x22, 0x1C, 0xBB, 0x6C, 0x46, 0xCD, 0x00, 0xE2,
+    0xF0, 0x56, 0x84, 0xF1, 0x50, 0x6C, 0xAA, 0x01, 0xB0, 0x43, 0x19, 0x00, 0x1D, 0x95, 0xA4, 0xEE,
+    0x5C, 0x00, 0xB8, 0xDE, 0x35, 0x80, 0x9E, 0x8C, 0x07, 0x14, 0xF5, 0x00, 0xC0, 0xBD, 0x38, 0x02,
+    0xA8, 0x7E, 0x1A, 0x01, 0xA8, 0x45, 0x2C, 0xB4, 0x6C, 0xB6, 0xC9, 0x0F, 0xD5, 0xBE, 0xC9, 0xAE,
+    0xDA, 0xB7, 0x4B, 0xB5, 0xFB, 0xA9, 0xF8, 0xBE, 0x5E, 0xB3, 0xA9, 0x5E, 0x20, 0x3F, 0xC9, 0x8A,
+    0xAC, 0x26, 0x3E, 0xCE, 0x45, 0xC5, 0x8C, 0x83, 0x1E, 0x14, 0x61, 0xBA, 0x32, 0x82, 0x70, 0x51,
+    0x2D, 0x25, 0x63, 0x49, 0x7E, 0x65, 0xD1, 0x9C, 0x74, 0xAC, 0xD8, 0xE9, 0x70, 0xF8, 0xB5, 0xA4,
+    0x90, 0xE3, 0xFF, 0x6C, 0xF0, 0x3F, 0x37, 0x05, 0x87, 0x82, 0x83, 0x80, 0x73, 0x0D, 0x67, 0xCB,
+    0x68, 0x9E, 0x27, 0x8B, 0x68, 0x1B, 0x13, 0xF3, 0xE8, 0x50, 0x87, 0x3C, 0x3A, 0x54, 0x63, 0x1E,
+    0x6D, 0x63, 0x63, 0x1E, 0xED, 0xB7, 0xC8, 0x47, 0xA2, 0x64, 0x27, 0xA8, 0x19, 0x6A, 0x06, 0x49,
+    0x64, 0x83, 0x67, 0x80, 0x67, 0x52, 0x86, 0x7C, 0xD1, 0x37, 0xFF, 0xDE, 0xB6, 0xAF, 0x6F, 0x36,
+    0x9B, 0x67, 0xEC, 0x6E, 0x3E, 0xBA, 0xB0, 0xC5, 0xDD, 0x66, 0x08, 0x64, 0x6B, 0xB2, 0xCD, 0x6E,
+    0x4F, 0xF4, 0x4A, 0x79, 0xF2, 0xA4, 0x19, 0x92, 0x31, 0xF5, 0x7D, 0x9F, 0xE8, 0x7F, 0x95, 0x27,
+    0x82, 0x3C, 0x71, 0x67, 0xB3, 0xD9, 0x6C, 0xD2, 0xFA, 0x4D, 0x7A, 0xCF, 0x2A, 0x27, 0x08, 0x4A,
+    0x92, 0xAD, 0xE5, 0x2F, 0xF2, 0xF7, 0xD3, 0xA7, 0xDA, 0xA6, 0x3D, 0x09, 0xE6, 0xDD, 0xA8, 0x17,
+    0x2A, 0x3A, 0xCF, 0x37, 0x7F, 0x73, 0x27, 0x3F, 0x7D, 0xFA, 0xBE, 0xA7, 0xEE, 0x12, 0x3C, 0x52,
+    0x8A, 0x2C, 0xE1, 0xE5, 0x6B, 0x77, 0x8F, 0xBB, 0x4C, 0x9F, 0x29, 0xD1, 0x27, 0xBF, 0x3F, 0x02,
+    0xA8, 0x47, 0xC1, 0xD8, 0x97, 0x33, 0x00, 0x3B, 0xD8, 0x01, 0x28, 0x63, 0x02, 0x81, 0x56, 0x23,
+    0x50, 0x8F, 0xA0, 0x87, 0x22, 0xCA, 0x19, 0xB0, 0x03, 0xEC, 0x00, 0x3D, 0xAF, 0x72, 0x6B, 0x3D,
+    0xA1, 0x9E, 0x24, 0xB5, 0xAC, 0x80, 0xD6, 0x07, 0xC0, 0x0E, 0x12, 0x64, 0x2A, 0x1C, 0x7A, 0xAA,
+    0x27, 0x51, 0xFB, 0x01, 0x68, 0x11, 0x05, 0x6D, 0x38, 0x6A, 0x00, 0x1C, 0x7D, 0x86, 0x00, 0xCA,
+    0x45, 0x0C, 0x74, 0xAF, 0xB0, 0x03, 0xAA, 0xA8, 0x23, 0x90, 0xB3, 0x71, 0x3D, 0x60, 0x42, 0x41,
+    0xA0, 0x5C, 0x44, 0x53, 0xF4, 0x19, 0x3B, 0x54, 0x11, 0x3A, 0x22, 0x67, 0x03, 0xD7, 0xC3, 0x04,
+    0x28, 0xA2, 0x58, 0x00, 0x13, 0x40, 0x8F, 0x8C, 0x9D, 0x8E, 0x80, 0x8E, 0x39, 0x1B, 0xC0, 0xF5,
+    0x32, 0x0D, 0x24, 0x9E, 0x2A, 0x58, 0xFD, 0xAF, 0x4C, 0x00, 0xF4, 0x92, 0xD6, 0xDD, 0x0C, 0xBB,
+    0x60, 0x85, 0x3A, 0x45, 0x1A, 0x4E, 0x7B, 0xC2, 0x8B, 0xDB, 0x4F, 0xD8, 0x9C, 0x52, 0x3E, 0x9D,
+    0x02, 0x96, 0x69, 0xCD, 0xAC, 0x4E, 0x04, 0x26, 0x9E, 0x3F, 0xCA, 0x50, 0x47, 0x28, 0xDE, 0x24,
+    0xA0, 0xA3, 0x1D, 0x00, 0xF7, 0xDD, 0x19, 0x28, 0x66, 0xEB, 0x01, 0xF3, 0xBD, 0x08, 0xA8, 0xC5,
+    0x79, 0xC0, 0xBC, 0xF1, 0xC1, 0x1F, 0x1E, 0x35, 0xC0, 0xD1, 0xA7, 0x7E, 0xAD, 0x3F, 0x61, 0x3D,
+    0x60, 0xA4, 0x42, 0x26, 0x00, 0xBC, 0xCD, 0x06, 0x55, 0xAC, 0x16, 0x94, 0x6C, 0xB6, 0xF6, 0x20,
+    0x49, 0x06, 0xD9, 0xA0, 0x26, 0x3B, 0x01, 0xFD, 0x40, 0x56, 0xEE, 0x15, 0x7C, 0x64, 0x49, 0x7A,
+    0xC9, 0xD9, 0x09, 0x33, 0x39, 0x8F, 0x92, 0x79, 0x00, 0x18, 0xAE, 0x7C, 0x10, 0xA1, 0x7A, 0xBF,
+    0xDA, 0xE1, 0xB0, 0x15, 0x66, 0xD8, 0x03, 0xA1, 0x8A, 0x80, 0x79, 0x41, 0x60, 0x0B, 0x23, 0x60,
+    0x93, 0xC3, 0xA9, 0x01, 0x0E, 0x53, 0x22, 0xEB, 0x75, 0xEA, 0x4A, 0xE9, 0x77, 0x9B, 0xAD, 0x7D,
+    0x73, 0xE5, 0x36, 0xD6, 0xE3, 0x57, 0xF9, 0x3B, 0x02, 0x90, 0x35, 0x12, 0x01, 0xF4, 0x30, 0x07,
+    0xC0, 0x46, 0xB3, 0x00, 0xA5, 0x98, 0xCE, 0x5C, 0xAC, 0x23, 0xA0, 0xD8, 0x7C, 0x1E, 0xC0, 0x61,
+    0x53, 0x8E, 0x40, 0xB6, 0xE4, 0xEC, 0xEF, 0x79, 0xCC, 0xCC, 0x92, 0x52, 0xAE, 0x59, 0xBD, 0x28,
+    0xBF, 0xF4, 0xDF, 0xC1, 0x7E, 0xAE, 0xE4, 0x95, 0xA9, 0xEC, 0x57, 0x5B, 0xEE, 0x08, 0x08, 0xAA,
+    0x1A, 0x4D, 0xB4, 0xB3, 0x9D, 0x4D, 0xBC, 0x37, 0xAE, 0xFC, 0xF0, 0x6B, 0x26, 0xDA, 0x68, 0x67,
+    0x1B, 0xEB, 0x31, 0xC3, 0xAF, 0xBF, 0xE8, 0xBF, 0x10, 0x25, 0x7F, 0x29, 0xE8, 0xD0, 0x67, 0x1B,
+    0xE4, 0xA8, 0x38, 0xA0, 0xCE, 0xC9, 0x39, 0x17, 0x43, 0xFA, 0xC8, 0xCE, 0x92, 0x8F, 0x4F, 0xA8,
+    0x38, 0x66, 0x5E, 0xB2, 0xEB, 0xDD, 0xF5, 0x57, 0x50, 0xF2, 0xB4, 0x52, 0xA0, 0x11, 0x64, 0xBF,
+    0xD9, 0x6C, 0x36, 0x9B, 0xCB, 0xC2, 0x04, 0x49, 0x3E, 0xB2, 0xF7, 0xF4, 0x51, 0xDB, 0xB6, 0x6D,
+    0x83, 0x2B, 0xD2, 0x22, 0x85, 0x27, 0x3B, 0xF3, 0x12, 0xF9, 0x1D, 0x9A, 0x77, 0xC9, 0x69, 0xC9,
+    0xC9, 0xDB, 0x01, 0x9C, 0xB2, 0x0E, 0x37, 0x1A, 0x1C, 0x01, 0x8D, 0x66, 0x53, 0xF4, 0x64, 0x67,
+    0x5E, 0x26, 0x7F, 0x44, 0xF3, 0x23, 0x72, 0x5C, 0x32, 0xF2, 0x85, 0x00, 0x37, 0xA1, 0xC1, 0x91,
+    0x38, 0x0C, 0x1E, 0xFE, 0x0F, 0xC0, 0xE1, 0x37, 0xF7, 0x1C, 0xF8, 0x0F, 0x92, 0x5C, 0x9A, 0xEC,
+    0xC6, 0xE6, 0xC9, 0x4B, 0x6C, 0x04, 0x8E, 0xFF, 0x41, 0x0C, 0x24, 0x37, 0x93, 0x6B, 0xE2, 0x0E,
+    0x79, 0xFB, 0x49, 0x20, 0xFB, 0x1F, 0xB7, 0xCF, 0x34, 0xC9, 0x01, 0xA0, 0x04, 0x67, 0xB7, 0x15,
+    0xEC, 0x1D, 0xC9, 0x7F, 0xBB, 0xB9, 0x75, 0xE7, 0x69, 0x41, 0xE0, 0x09, 0x74, 0x0D, 0xE5, 0x05,
+    0xE1, 0xFF, 0xC6, 0xB2, 0xD9, 0x74, 0xC6, 0xA7, 0x85, 0x24, 0xEF, 0xBB, 0x84, 0x72, 0x76, 0xAB,
+    0xE3, 0xCD, 0x37, 0x36, 0x9B, 0x4B, 0x72, 0xA4, 0xED, 0x3D, 0x60, 0x49, 0xF2, 0x95, 0xCD, 0x66,
+    0xB3, 0x79, 0xFA, 0xF2, 0x66, 0xD8, 0x7B, 0x36, 0x51, 0x57, 0xFA, 0xBC, 0xE4, 0xB0, 0xEA, 0x92,
+    0x50, 0x3D, 0x21, 0x01, 0xAB, 0xC5, 0xAC, 0xE5, 0x46, 0x01, 0x08, 0x49, 0xF2, 0x82, 0x7B, 0x36,
+    0x49, 0x39, 0x41, 0xBD, 0x75, 0xC9, 0x1C, 0x6E, 0x36, 0x9B, 0xA7, 0x2F, 0x90, 0x41, 0xD8, 0xC4,
+    0x90, 0xDC, 0x9C, 0x8A, 0x3D, 0x04, 0xA9, 0x73, 0xCF, 0xC6, 0x8B, 0xA2, 0x55, 0xA6, 0x34, 0x8F,
+    0x02, 0x21, 0x93, 0x7F, 0x8A, 0x83, 0xC4, 0x91, 0xE0, 0x42, 0xC0, 0xEF, 0xA5, 0x0A, 0x55, 0x96,
+    0x8A, 0x52, 0x01, 0x59, 0xCA, 0xEC, 0x57, 0x4F, 0x40, 0x2D, 0xAB, 0xC2, 0xE7, 0x9C, 0x51, 0xB3,
+    0x47, 0xCD, 0xD3, 0x9C, 0xE7, 0xC8, 0x39, 0xA1, 0x66, 0x87, 0x9A, 0x5D, 0xCE, 0x09, 0xB0, 0x53,
+    0x5A, 0x4C, 0x65, 0x96, 0xC0, 0xC6, 0x9A, 0x7D, 0x2E, 0xBC, 0x71, 0xDE, 0x96, 0xF5, 0xEE, 0x0B,
+    0x3E, 0x97, 0xCC, 0x22, 0xF2, 0x3B, 0x30, 0x29, 0x99, 0xFA, 0x21, 0x80, 0xCF, 0x5D, 0x49, 0x7D,
+    0x44, 0x37, 0x80, 0x88, 0x21, 0x49, 0x21, 0x63, 0xA7, 0x24, 0x10, 0x7C, 0x92, 0x2C, 0x00, 0x96,
+    0x5D, 0xC1, 0x09, 0xDB, 0x02, 0x6D, 0x4B, 0x94, 0xB3, 0x47, 0x3D, 0x0B, 0x42, 0xCA, 0xCE, 0xE9,
+    0xC1, 0x71, 0xFB, 0x62, 0x7A, 0x6F, 0x3D, 0x5D, 0xBF, 0x5B, 0x4F, 0x12, 0x38, 0xAD, 0x3D, 0x30,
+    0x01, 0xF8, 0x10, 0xF6, 0xE1, 0xB8, 0xBF, 0x8C, 0x71, 0xC3, 0xEF, 0xF2, 0x55, 0x24, 0x13, 0xC6,
+    0xCA, 0x2A, 0x87, 0x7B, 0xEE, 0xFC, 0xA2, 0xC6, 0x8D, 0x3D, 0x93, 0xA3, 0xF5, 0x7B, 0xD6, 0x18,
+    0x29, 0x81, 0xD8, 0x69, 0xD4, 0x82, 0x8B, 0xF6, 0x47, 0xB7, 0x5B, 0xCF, 0x73, 0x29, 0x79, 0xFE,
+    0x19, 0xB6, 0x0F, 0x71, 0x4C, 0x76, 0xE6, 0x22, 0x42, 0xB1, 0x11, 0x93, 0x23, 0xF4, 0x28, 0x78,
+    0x0D, 0xC0, 0x0D, 0x30, 0x03, 0xCA, 0x05, 0xC5, 0x0C, 0xD8, 0x20, 0x29, 0xDA, 0xC5, 0xE4, 0x28,
+    0xB8, 0x7E, 0x7A, 0x13, 0x00, 0xCD, 0x87, 0x53, 0x86, 0xDB, 0xD7, 0x37, 0xCF, 0x88, 0xB9, 0x79,
+    0x48, 0x59, 0x4D, 0x93, 0x65, 0x4B, 0xF2, 0xDE, 0xA6, 0x45, 0x01, 0xCA, 0xB8, 0x97, 0x56, 0xFF,
+    0x82, 0xC9, 0x71, 0x5D, 0xE1, 0x2B, 0xA1, 0x35, 0xD2, 0x13, 0xA3, 0x58, 0xDE, 0xF6, 0x24, 0xD9,
+    0x42, 0xB2, 0xB2, 0xB3, 0x97, 0xEF, 0x8F, 0xA9, 0x6E, 0x69, 0x19, 0xA1, 0xA3, 0xF6, 0xB1, 0x45,
+    0x52, 0xEE, 0x3E, 0xCF, 0x51, 0x72, 0x6C, 0x7B, 0x64, 0x6C, 0xAA, 0x08, 0xD4, 0x01, 0xEC, 0xA1,
+    0x16, 0xE8, 0x05, 0xB0, 0x3D, 0x9C, 0x98, 0xD6, 0xC4, 0x02, 0xCA, 0x1E, 0x55, 0x48, 0x62, 0x6C,
+    0x32, 0xC7, 0xDA, 0x09, 0x65, 0x44, 0xCD, 0xC3, 0x0D, 0x5F, 0x77, 0xC9, 0x13, 0x28, 0x96, 0xBE,
+    0x39, 0x91, 0xB5, 0x20, 0xF9, 0xD4, 0x8A, 0x46, 0x48, 0xDE, 0xD7, 0xB5, 0xB0, 0xF7, 0x88, 0x8A,
+    0x29, 0xAF, 0x5F, 0x83, 0x07, 0x77, 0x29, 0x99, 0xBC, 0xF8, 0x45, 0x44, 0xF1, 0xF0, 0x6E, 0xD9,
+    0x89, 0x0C, 0x17, 0xAC, 0x8D, 0xAB, 0x71, 0x7B, 0xDC, 0x3F, 0xB9, 0xCC, 0x6A, 0xBD, 0x1C, 0x23,
+    0xA5, 0x6A, 0x4F, 0xB6, 0xC4, 0x94, 0x91, 0xDB, 0xA7, 0x1F, 0xBD, 0x2B, 0x70, 0xBF, 0x6D, 0xDB,
+    0x86, 0x3B, 0x37, 0x1E, 0xFD, 0x85, 0x93, 0xA3, 0xB6, 0x3D, 0x96, 0xAF, 0x2D, 0x92, 0xB0, 0x21,
+    0x2D, 0x69, 0x23, 0x09, 0x9D, 0xE4, 0x6B, 0xE5, 0xDA, 0xFF, 0xEF, 0xB5, 0xA4, 0x57, 0xFB, 0x83,
+    0xA1, 0x7A, 0x2F, 0x13, 0xEA, 0x63, 0x92, 0x84, 0x29, 0xD1, 0x20, 0x59, 0xCA, 0x9B, 0xF4, 0xA3,
+    0x77, 0x67, 0x5D, 0x91, 0xB5, 0x64, 0xB7, 0x86, 0x2D, 0x5E, 0x38, 0x01, 0x70, 0x78, 0x76, 0x2A,
+    0x4A, 0xFD, 0x92, 0x06, 0xEE, 0x00, 0x98, 0xF3, 0xB3, 0x93, 0x08, 0xB0, 0x39, 0xCB, 0x08, 0x15,
+    0x71, 0x06, 0xE3, 0xCB, 0x80, 0x33, 0xE8, 0x41, 0x7B, 0x9C, 0x41, 0x85, 0xBA, 0xC3, 0x19, 0xF2,
+    0xC9, 0x00, 0x67, 0x40, 0xB4, 0xC0, 0x19, 0x30, 0x9F, 0x01, 0x67, 0xC0, 0x99, 0xDB, 0x6C, 0xB8,
+    0xD9, 0x88, 0xB7, 0x97, 0xEB, 0xEE, 0xAC, 0x6D, 0xCF, 0xDA, 0xF6, 0x2C, 0x3D, 0x92, 0x5E, 0x30,
+    0xC0, 0x19, 0xB2, 0x98, 0x3E, 0xA6, 0x7B, 0x9C, 0xA1, 0x08, 0xE9, 0x87, 0xD2, 0xCF, 0x82, 0xDD,
+    0x59, 0xCE, 0x6D, 0x91, 0x52, 0x01, 0x53, 0x71, 0xD7, 0xA5, 0xBB, 0x2E, 0xAD, 0xC3, 0x84, 0x3A,
+    0x02, 0x6C, 0x20, 0x75, 0x80, 0xD4, 0x01, 0x52, 0x07, 0x48, 0x1D, 0x20, 0x75, 0x80, 0xD4, 0x01,
+    0x52, 0x07, 0x48, 0x1D, 0x36, 0x97, 0xD5, 0xA1, 0x95, 0x3A, 0x40, 0xEA, 0x00, 0x60, 0x36, 0x0D,
+    0x20, 0x75, 0x80, 0xD4, 0x01, 0x52, 0x07, 0x48, 0x1D, 0x20, 0x75, 0x80, 0xD4, 0x01, 0xBF, 0x70,
+    0x1D, 0xAA, 0x5D, 0x1D, 0x16, 0xA4, 0x65, 0x48, 0x90, 0x73, 0xD0, 0x6F, 0x0E, 0x28, 0xDF, 0x0D,
+    0xF5, 0x97, 0x27, 0xD4, 0xAF, 0x4C, 0x26, 0x5F, 0xE0, 0x9A, 0x68, 0xE1, 0x9E, 0x98, 0x31, 0x9F,
+    0xA1, 0x7E, 0x63, 0xC4, 0xD9, 0x73, 0x28, 0xD9, 0xE3, 0x8B, 0xCF, 0x21, 0x67, 0x23, 0xBB, 0x0E,
+    0x5F, 0x7C, 0x0E, 0x25, 0x07, 0x9C, 0x9D, 0xA1, 0xFE, 0xDE, 0x84, 0x33, 0x0B, 0xF7, 0xC9, 0x05,
+    0xB3, 0xC9, 0x67, 0xB8, 0xC7, 0x63, 0xFD, 0xE5, 0x11, 0xF5, 0xBF, 0x9B, 0x34, 0x7B, 0x94, 0xEF,
+    0x86, 0x92, 0x0D, 0x72, 0x0E, 0xE9, 0x67, 0x21, 0x68, 0xFB, 0x5F, 0xB5, 0x0E, 0xB2, 0xBA, 0x45,
+    0x19, 0x80, 0x9C, 0x83, 0xF6, 0x40, 0xF9, 0x6E, 0xA8, 0x3B, 0xA0, 0x7E, 0x65, 0x32, 0x80, 0xD4,
+    0x01, 0xF9, 0x8C, 0xF9, 0x0C, 0x28, 0x47, 0x9C, 0x9D, 0x01, 0x75, 0x8F, 0x2F, 0x3E, 0x07, 0x38,
+    0xA9, 0xC3, 0x0C, 0x7C, 0xF1, 0x39, 0x94, 0x23, 0x70, 0x76, 0x86, 0xBA, 0x07, 0xCE, 0x2C, 0x5C,
+    0x03, 0xA9, 0x03, 0xB2, 0x58, 0x7F, 0x79, 0x04, 0xF2, 0x49, 0xB3, 0x07, 0x8A, 0x50, 0xB2, 0x01,
+    0xB4, 0xD4, 0xC1, 0xFC, 0x7C, 0x75, 0x38, 0xDA, 0xC2, 0x2D, 0x84, 0xFD, 0xFE, 0x86, 0x0E, 0x6F,
+    0x6C, 0x78, 0x67, 0xF3, 0x57, 0x97, 0xDA, 0x45, 0xC2, 0x45, 0xAB, 0x61, 0x76, 0x0C, 0x5C, 0x03,
+    0xAE, 0x65, 0xF4, 0x70, 0x01, 0x66, 0x34, 0x0B, 0x34, 0x9B, 0x92, 0xB7, 0x19, 0x32, 0x8E, 0x70,
+    0xD1, 0x2C, 0xA8, 0x88, 0x92, 0xCF, 0xD3, 0x4B, 0x9E, 0xCE, 0xEC, 0x18, 0xE9, 0x2D, 0xA9, 0xE8,
+    0x29, 0x90, 0x71, 0x29, 0xD6, 0x74, 0x32, 0xE4, 0x98, 0x96, 0x94, 0x5B, 0x50, 0xF2, 0x75, 0xF2,
+    0x2F, 0xD8, 0x29, 0x76, 0x25, 0x7D, 0xE5, 0x15, 0x3D, 0xD8, 0x67, 0x1E, 0x4C, 0xD0, 0x3E, 0x1B,
+    0xB6, 0x29, 0x7A, 0x4B, 0xA6, 0x29, 0x93, 0x9C, 0xD6, 0x20, 0x9B, 0xB4, 0x0E, 0x04, 0xBB, 0x6A,
+    0x5D, 0xD7, 0x5B, 0x53, 0x1C, 0x5D, 0x8A, 0x7E, 0x9B, 0xFE, 0x61, 0x75, 0x8F, 0x6B, 0x59, 0x94,
+    0xFE, 0x03, 0x79, 0xA0, 0x07, 0x6A, 0xC6, 0x22, 0xB9, 0x1B, 0x1F, 0x4E, 0x08, 0x58, 0xBF, 0x06,
+    0x6B, 0xDF, 0x78, 0x06, 0x40, 0x26, 0x0B, 0xAF, 0xBB, 0xED, 0xCA, 0x4D, 0x3D, 0x4A, 0x7E, 0xD5,
+    0xCD, 0xC8, 0xD8, 0x67, 0x92, 0xDE, 0xA4, 0x18, 0xA1, 0xD8, 0xE0, 0x81, 0x15, 0x45, 0x28, 0x56,
+    0xA0, 0xC3, 0xFD, 0x39, 0xC7, 0x92, 0x12, 0x22, 0x43, 0x4A, 0x89, 0xA4, 0x1C, 0xEA, 0x83, 0x3B,
+    0x71, 0x0C, 0x15, 0x17, 0xA9, 0xC6, 0x5B, 0xC2, 0xAD, 0x01, 0xDC, 0x78, 0xEA, 0x81, 0xED, 0x42,
+    0xDB, 0x8E, 0x8C, 0x6B, 0x76, 0xC6, 0x82, 0xDF, 0x76, 0x11, 0xE0, 0xA0, 0xE8, 0x51, 0x47, 0xC9,
+    0xCA, 0xD2, 0x29, 0x7A, 0xD8, 0x11, 0x26, 0xA2, 0x24, 0x14, 0xFD, 0x21, 0x39, 0x98, 0xA8, 0x48,
+    0x2A, 0x7A, 0x4B, 0x06, 0x13, 0x0B, 0x72, 0x56, 0xBF, 0xD1, 0x2A, 0x40, 0x32, 0x48, 0x03, 0x15,
+    0x87, 0x07, 0x29, 0xB9, 0xA9, 0x79, 0x47, 0x06, 0x62, 0xB2, 0x1A, 0x7A, 0xE9, 0x83, 0x3F, 0x3C,
+    0x61, 0x03, 0x33, 0xC1, 0xCD, 0xA8, 0x24, 0xA9, 0x0D, 0x07, 0x54, 0xBD, 0x88, 0x1B, 0x6B, 0xFB,
+    0xD4, 0xDB, 0x29, 0x52, 0xCC, 0x4C, 0x27, 0xEB, 0x90, 0xD1, 0xEB, 0xE0, 0xF1, 0x5B, 0x1B, 0x64,
+    0xB6, 0x1E, 0x7C, 0xD0, 0x35, 0xFD, 0x45, 0x4F, 0x04, 0x2E, 0x3F, 0x54, 0x9C, 0x6B, 0xF2, 0x53,
+    0x64, 0x2F, 0x8B, 0x87, 0xD4, 0xE4, 0x9A, 0xF7, 0x02, 0xB8, 0xFA, 0xCC, 0x81, 0x10, 0xA9, 0x5A,
+    0x33, 0x39, 0xDD, 0x11, 0x3F, 0xCF, 0x45, 0x22, 0xBD, 0x7D, 0x42, 0xC0, 0x4C, 0x70, 0x6B, 0x2A,
+    0x1E, 0xC8, 0x1A, 0xAD, 0x7A, 0xDE, 0xF6, 0x80, 0x80, 0x6A, 0x96, 0xF4, 0x3C, 0xC2, 0x2E, 0x62,
+    0x22, 0x52, 0xB7, 0x25, 0x92, 0x5A, 0x89, 0x14, 0xF5, 0x4A, 0xA4, 0xDE, 0xFC, 0xC7, 0x4E, 0xA4,
+    0x64, 0x1B, 0x2B, 0x98, 0x40, 0x07, 0xC9, 0x0F, 0x21, 0x9D, 0x4C, 0xCF, 0x5A, 0x72, 0xB9, 0x35,
+    0x7F, 0x54, 0x4B, 0x08, 0xBE, 0x4E, 0xC1, 0x0E, 0xF4, 0x80, 0x0D, 0xA8, 0x24, 0xD0, 0x27, 0xA7,
+    0x97, 0x91, 0x9D, 0x54, 0xF0, 0x6D, 0xF6, 0x54, 0x01, 0x0B, 0x92, 0xE3, 0xCA, 0x6A, 0x56, 0x16,
+    0xF4, 0x41, 0x9D, 0x0E, 0x57, 0x20, 0xA9, 0x6F, 0x06, 0xC7, 0x25, 0x23, 0xE7, 0x94, 0xF4, 0xF9,
+    0x05, 0x11, 0x15, 0xC7, 0xBD, 0xAC, 0x73, 0x82, 0xA8, 0xD9, 0x42, 0x43, 0xB6, 0x0B, 0xB7, 0xA7,
+    0x95, 0x55, 0x80, 0x62, 0xCE, 0xE5, 0x05, 0xD7, 0x88, 0x4A, 0xA4, 0x13, 0x7B, 0xC4, 0x59, 0x92,
+    0x1E, 0x8B, 0x41, 0x46, 0xCA, 0x81, 0x95, 0x0B, 0x35, 0x67, 0x58, 0xB2, 0xAB, 0x65, 0x5C, 0xC6,
+    0x82, 0xB7, 0x58, 0x90, 0xF4, 0xF4, 0x3A, 0x58, 0x72, 0xAC, 0x26, 0x58, 0x98, 0x88, 0x9C, 0xBE,
+    0x10, 0xAE, 0xC2, 0xE6, 0x01, 0x49, 0xC1, 0xC6, 0x46, 0x16, 0x6C, 0x49, 0x49, 0xB2, 0x61, 0xC9,
+    0x46, 0xAA, 0x47, 0x41, 0xE5, 0x64, 0x94, 0x54, 0x51, 0xC8, 0x1C, 0x3B, 0x13, 0x91, 0x05, 0x70,
+    0x92, 0x85, 0x62, 0x14, 0x3B, 0x59, 0xE0, 0xA5, 0x1E, 0x73, 0x0E, 0x99, 0x09, 0x8A, 0xA8, 0xC9,
+    0x1F, 0xF0, 0x5D, 0xF6, 0x99, 0x84, 0xB8, 0x4C, 0xD0, 0xE4, 0xB7, 0xC8, 0x19, 0x30, 0x1C, 0xF1,
+    0xE8, 0x93, 0x7B, 0xD9, 0xF7, 0xD6, 0xBF, 0x3F, 0xD8, 0xF3, 0x2C, 0x25, 0xD2, 0x74, 0xBB, 0xB0,
+    0x30, 0xF1, 0xBD, 0xAF, 0x60, 0xF6, 0xB3, 0x47, 0x97, 0x35, 0x60, 0x47, 0x56, 0xE9, 0x2C, 0x3D,
+    0x8A, 0x21, 0x61, 0x92, 0x32, 0x71, 0xCA, 0x7E, 0xEB, 0x19, 0x9C, 0x09, 0x81, 0xD9, 0x9B, 0x4E,
+    0x04, 0x83, 0x50, 0x0F, 0xC2, 0x5E, 0xA7, 0x2A, 0x25, 0x94, 0x8B, 0x7A, 0x49, 0xCB, 0xEC, 0xEA,
+    0x84, 0x57, 0x18, 0x2B, 0xD1, 0x0F, 0x97, 0xA6, 0x12, 0xA7, 0x6C, 0x07, 0xC3, 0xB9, 0x4A, 0xCB,
+    0xCF, 0x8F, 0x05, 0xC5, 0x8D, 0x28, 0x0B, 0xC5, 0x38, 0xB2, 0x81, 0x65, 0x2C, 0x29, 0x88, 0xDE,
+    0xA8, 0xC9, 0x11, 0x28, 0x38, 0x6B, 0xC9, 0xCC, 0xCE, 0xA5, 0x92, 0x70, 0x0B, 0xBB, 0x3A, 0x7E,
+    0x2A, 0xBE, 0xC1, 0x84, 0x0D, 0x49, 0x8A, 0x6F, 0xB6, 0x60, 0x5D, 0x07, 0x70, 0x5D, 0x16, 0xAE,
+    0xFA, 0xD7, 0xE3, 0x2E, 0xC4, 0x69, 0x17, 0xA7, 0x08, 0x00, 0xF8, 0x57, 0x2B, 0xA1, 0x1E, 0x00,
+    0x80, 0xFF, 0x1F,
 };
 
 static const EpdGlyph bookerly_18_boldGlyphs[] = {
@@ -2641,7 +2758,7 @@ static const EpdGlyph bookerly_18_boldGlyphs[] = {
     { 6, 35, 12, 3, 30, 53, 12709 }, // |
     { 13, 38, 15, 0, 31, 124, 12762 }, // }
     { 19, 8, 24, 2, 17, 38, 12886 }, // ~
-    { 0, 0, 8, 0, 0, 0, 0 }, //  
+    { 0, 0, 8, 0, 0, 0, 12924 }, //  
     { 8, 30, 11, 1, 21, 60, 0 }, // ¡
     { 20, 38, 24, 2, 30, 190, 60 }, // ¢
     { 22, 28, 24, 1, 27, 154, 250 }, // £
@@ -2652,642 +2769,649 @@ static const EpdGlyph bookerly_18_boldGlyphs[] = {
     { 15, 6, 26, 5, 29, 23, 866 }, // ¨
     { 28, 28, 30, 1, 27, 196, 889 }, // ©
     { 15, 20, 17, 1, 28, 75, 1085 }, // ª
-    { 20, 15, 22, 1, 17, 75, 1160 }, // «
-    { 18, 10, 24, 3, 18, 45, 1235 }, // ¬
-    { 13, 5, 14, 1, 12, 17, 1280 }, // ­
-    { 20, 21, 22, 1, 30, 105, 1297 }, // ®
-    { 14, 5, 26, 6, 28, 18, 1402 }, // ¯
-    { 14, 14, 20, 3, 27, 49, 1420 }, // °
-    { 18, 24, 24, 3, 23, 108, 1469 }, // ±
-    { 15, 18, 17, 1, 32, 68, 1577 }, // ²
-    { 13, 19, 17, 2, 32, 62, 1645 }, // ³
-    { 8, 10, 26, 9, 32, 20, 1707 }, // ´
-    { 24, 30, 25, 2, 21, 180, 1727 }, // µ
-    { 22, 33, 23, 0, 27, 182, 1907 }, // ¶
-    { 7, 7, 11, 2, 14, 13, 2089 }, // ·
-    { 8, 10, 26, 9, -1, 20, 2102 }, // ¸
-    { 13, 18, 17, 2, 32, 59, 2122 }, // ¹
-    { 15, 20, 17, 1, 28, 75, 2181 }, // º
-    { 21, 15, 22, 1, 17, 79, 2256 }, // »
-    { 38, 31, 41, 2, 28, 295, 2335 }, // ¼
-    { 38, 31, 41, 2, 28, 295, 2630 }, // ½
-    { 38, 31, 41, 2, 28, 295, 2925 }, // ¾
-    { 16, 29, 19, 1, 21, 116, 3220 }, // ¿
-    { 30, 37, 29, 0, 37, 278, 3336 }, // À
-    { 30, 37, 29, 0, 37, 278, 3614 }, // Á
-    { 30, 37, 29, 0, 37, 278, 3892 }, // Â
-    { 30, 36, 29, 0, 36, 270, 4170 }, // Ã
-    { 30, 36, 29, 0, 36, 270, 4440 }, // Ä
-    { 30, 38, 29, 0, 38, 285, 4710 }, // Å
-    { 37, 27, 37, -1, 27, 250, 4995 }, // Æ
-    { 23, 38, 25, 1, 28, 219, 5245 }, // Ç
-    { 23, 37, 25, 1, 37, 213, 5464 }, // È
-    { 23, 37, 25, 1, 37, 213, 5677 }, // É
-    { 23, 37, 25, 1, 37, 213, 5890 }, // Ê
-    { 23, 36, 25, 1, 36, 207, 6103 }, // Ë
-    { 14, 37, 16, 1, 37, 130, 6310 }, // Ì
-    { 14, 37, 16, 1, 37, 130, 6440 }, // Í
-    { 15, 37, 16, 0, 37, 139, 6570 }, // Î
-    { 16, 36, 16, 0, 36, 144, 6709 }, // Ï
-    { 28, 28, 29, 0, 27, 196, 6853 }, // Ð
-    { 31, 37, 31, 0, 36, 287, 7049 }, // Ñ
-    { 28, 38, 30, 1, 37, 266, 7336 }, // Ò
-    { 28, 38, 30, 1, 37, 266, 7602 }, // Ó
-    { 28, 38, 30, 1, 37, 266, 7868 }, // Ô
-    { 28, 37, 30, 1, 36, 259, 8134 }, // Õ
-    { 28, 37, 30, 1, 36, 259, 8393 }, // Ö
-    { 17, 17, 24, 3, 21, 73, 8652 }, // ×
-    { 29, 29, 30, 0, 28, 211, 8725 }, // Ø
-    { 30, 38, 31, 0, 37, 285, 8936 }, // Ù
-    { 30, 38, 31, 0, 37, 285, 9221 }, // Ú
-    { 30, 38, 31, 0, 37, 285, 9506 }, // Û
-    { 30, 37, 31, 0, 36, 278, 9791 }, // Ü
-    { 27, 37, 27, 0, 37, 250, 10069 }, // Ý
-    { 23, 27, 25, 1, 27, 156, 10319 }, // Þ
-    { 25, 31, 25, 0, 30, 194, 10475 }, // ß
-    { 21, 33, 22, 1, 32, 174, 10669 }, // à
-    { 21, 33, 22, 1, 32, 174, 10843 }, // á
-    { 21, 32, 22, 1, 31, 168, 11017 }, // â
-    { 21, 31, 22, 1, 30, 163, 11185 }, // ã
-    { 21, 30, 22, 1, 29, 158, 11348 }, // ä
-    { 21, 33, 22, 1, 32, 174, 11506 }, // å
-    { 30, 22, 32, 1, 21, 165, 11680 }, // æ
-    { 18, 32, 20, 1, 21, 144, 11845 }, // ç
-    { 19, 33, 21, 1, 32, 157, 11989 }, // è
-    { 19, 33, 21, 1, 32, 157, 12146 }, // é
-    { 19, 32, 21, 1, 31, 152, 12303 }, // ê
-    { 19, 30, 21, 1, 29, 143, 12455 }, // ë
-    { 13, 32, 13, 0, 32, 104, 12598 }, // ì
-    { 13, 32, 13, 0, 32, 104, 12702 }, // í
-    { 14, 31, 13, 0, 31, 109, 12806 }, // î
-    { 14, 29, 13, 0, 29, 102, 12915 }, // ï
-    { 21, 32, 23, 1, 31, 168, 13017 }, // ð
-    { 26, 30, 26, 0, 30, 195, 13185 }, // ñ
-    { 21, 33, 23, 1, 32, 174, 13380 }, // ò
-    { 21, 33, 23, 1, 32, 174, 13554 }, // ó
-    { 21, 32, 23, 1, 31, 168, 13728 }, // ô
-    { 21, 31, 23, 1, 30, 163, 13896 }, // õ
-    { 21, 30, 23, 1, 29, 158, 14059 }, // ö
-    { 18, 18, 24, 3, 22, 81, 14217 }, // ÷
-    { 22, 22, 23, 0, 21, 121, 14298 }, // ø
-    { 25, 33, 25, 0, 32, 207, 14419 }, // ù
-    { 25, 33, 25, 0, 32, 207, 14626 }, // ú
-    { 25, 32, 25, 0, 31, 200, 14833 }, // û
-    { 25, 30, 25, 0, 29, 188, 15033 }, // ü
-    { 25, 41, 25, 0, 32, 257, 15221 }, // ý
-    { 23, 39, 24, 0, 30, 225, 15478 }, // þ
-    { 25, 38, 25, 0, 29, 238, 15703 }, // ÿ
-    { 30, 35, 29, 0, 35, 263, 0 }, // Ā
-    { 21, 29, 22, 1, 28, 153, 263 }, // ā
-    { 30, 37, 29, 0, 37, 278, 416 }, // Ă
-    { 21, 31, 22, 1, 30, 163, 694 }, // ă
-    { 30, 37, 29, 0, 28, 278, 857 }, // Ą
-    { 21, 30, 22, 1, 21, 158, 1135 }, // ą
-    { 23, 38, 25, 1, 37, 219, 1293 }, // Ć
-    { 18, 33, 20, 1, 32, 149, 1512 }, // ć
-    { 23, 38, 25, 1, 37, 219, 1661 }, // Ĉ
-    { 18, 32, 20, 1, 31, 144, 1880 }, // ĉ
-    { 23, 37, 25, 1, 36, 213, 2024 }, // Ċ
-    { 18, 31, 20, 1, 30, 140, 2237 }, // ċ
-    { 23, 38, 25, 1, 37, 219, 2377 }, // Č
-    { 18, 33, 20, 1, 32, 149, 2596 }, // č
-    { 27, 38, 29, 1, 37, 257, 2745 }, // Ď
-    { 27, 31, 25, 1, 30, 210, 3002 }, // ď
-    { 28, 28, 29, 0, 27, 196, 3212 }, // Đ
-    { 23, 31, 24, 1, 30, 179, 3408 }, // đ
-    { 23, 35, 25, 1, 35, 202, 3587 }, // Ē
-    { 19, 29, 21, 1, 28, 138, 3789 }, // ē
-    { 23, 37, 25, 1, 37, 213, 3927 }, // Ĕ
-    { 19, 31, 21, 1, 30, 148, 4140 }, // ĕ
-    { 23, 36, 25, 1, 36, 207, 4288 }, // Ė
-    { 19, 31, 21, 1, 30, 148, 4495 }, // ė
-    { 23, 36, 25, 1, 27, 207, 4643 }, // Ę
-    { 19, 30, 21, 1, 21, 143, 4850 }, // ę
-    { 23, 37, 25, 1, 37, 213, 4993 }, // Ě
-    { 19, 33, 21, 1, 32, 157, 5206 }, // ě
-    { 26, 38, 28, 1, 37, 247, 5363 }, // Ĝ
-    { 23, 40, 23, 0, 31, 230, 5610 }, // ĝ
-    { 26, 38, 28, 1, 37, 247, 5840 }, // Ğ
-    { 23, 39, 23, 0, 30, 225, 6087 }, // ğ
-    { 26, 37, 28, 1, 36, 241, 6312 }, // Ġ
-    { 23, 39, 23, 0, 30, 225, 6553 }, // ġ
-    { 26, 38, 28, 1, 28, 247, 6778 }, // Ģ
-    { 23, 42, 23, 0, 33, 242, 7025 }, // ģ
-    { 31, 37, 33, 1, 37, 287, 7267 }, // Ĥ
-    { 26, 39, 25, -1, 39, 254, 7554 }, // ĥ
-    { 32, 27, 33, 0, 27, 216, 7808 }, // Ħ
-    { 25, 30, 25, 0, 30, 188, 8024 }, // ħ
-    { 14, 36, 16, 1, 36, 126, 8212 }, // Ĩ
-    { 14, 30, 13, 0, 30, 105, 8338 }, // ĩ
-    { 14, 35, 16, 1, 35, 123, 8443 }, // Ī
-    { 14, 28, 13, 0, 28, 98, 8566 }, // ī
-    { 14, 37, 16, 1, 37, 130, 8664 }, // Ĭ
-    { 14, 30, 13, 0, 30, 105, 8794 }, // ĭ
-    { 14, 36, 16, 1, 27, 126, 8899 }, // Į
-    { 14, 39, 13, 0, 30, 137, 9025 }, // į
-    { 14, 36, 16, 1, 36, 126, 9162 }, // İ
-    { 13, 21, 13, 0, 21, 69, 9288 }, // ı
-    { 30, 35, 31, 1, 27, 263, 9357 }, // Ĳ
-    { 24, 39, 26, 0, 30, 234, 9620 }, // ĳ
-    { 17, 45, 15, -2, 37, 192, 9854 }, // Ĵ
-    { 16, 40, 12, -3, 31, 160, 10046 }, // ĵ
-    { 28, 37, 29, 1, 27, 259, 10206 }, // Ķ
-    { 24, 40, 24, 0, 30, 240, 10465 }, // ķ
-    { 25, 22, 25, 0, 21, 138, 10705 }, // ĸ
-    { 23, 37, 24, 1, 37, 213, 10843 }, // Ĺ
-    { 13, 39, 13, 0, 39, 127, 11056 }, // ĺ
-    { 23, 37, 24, 1, 27, 213, 11183 }, // Ļ
-    { 13, 40, 13, 0, 30, 130, 11396 }, // ļ
-    { 23, 30, 24, 1, 30, 173, 11526 }, // Ľ
-    { 17, 30, 14, 0, 30, 128, 11699 }, // ľ
-    { 23, 27, 24, 1, 27, 156, 11827 }, // Ŀ
-    { 20, 30, 20, 0, 30, 150, 11983 }, // ŀ
-    { 25, 27, 24, -1, 27, 169, 12133 }, // Ł
-    { 15, 30, 13, -1, 30, 113, 12302 }, // ł
-    { 31, 38, 31, 0, 37, 295, 12415 }, // Ń
-    { 26, 32, 26, 0, 32, 208, 12710 }, // ń
-    { 31, 37, 31, 0, 27, 287, 12918 }, // Ņ
-    { 26, 31, 26, 0, 21, 202, 13205 }, // ņ
-    { 31, 38, 31, 0, 37, 295, 13407 }, // Ň
-    { 26, 32, 26, 0, 32, 208, 13702 }, // ň
-    { 33, 28, 35, 1, 28, 231, 13910 }, // ŉ
-    { 31, 35, 31, 0, 27, 272, 14141 }, // Ŋ
-    { 23, 30, 25, 0, 21, 173, 14413 }, // ŋ
-    { 28, 36, 30, 1, 35, 252, 14586 }, // Ō
-    { 21, 29, 23, 1, 28, 153, 14838 }, // ō
-    { 28, 38, 30, 1, 37, 266, 14991 }, // Ŏ
-    { 21, 31, 23, 1, 30, 163, 15257 }, // ŏ
-    { 28, 39, 30, 1, 38, 273, 15420 }, // Ő
-    { 21, 33, 23, 1, 32, 174, 15693 }, // ő
-    { 36, 28, 38, 1, 27, 252, 15867 }, // Œ
-    { 33, 22, 35, 1, 21, 182, 16119 }, // œ
-    { 27, 38, 27, 1, 37, 257, 16301 }, // Ŕ
-    { 18, 32, 18, 0, 32, 144, 16558 }, // ŕ
-    { 27, 37, 27, 1, 27, 250, 16702 }, // Ŗ
-    { 18, 31, 18, 0, 21, 140, 16952 }, // ŗ
-    { 27, 38, 27, 1, 37, 257, 17092 }, // Ř
-    { 18, 32, 18, 0, 32, 144, 17349 }, // ř
-    { 20, 38, 22, 1, 37, 190, 17493 }, // Ś
-    { 17, 33, 19, 1, 32, 141, 17683 }, // ś
-    { 20, 38, 22, 1, 37, 190, 17824 }, // Ŝ
-    { 17, 32, 19, 1, 31, 136, 18014 }, // ŝ
-    { 20, 38, 22, 1, 28, 190, 18150 }, // Ş
-    { 17, 32, 19, 1, 21, 136, 18340 }, // ş
-    { 20, 38, 22, 1, 37, 190, 18476 }, // Š
-    { 17, 33, 19, 1, 32, 141, 18666 }, // š
-    { 26, 37, 27, 1, 27, 241, 18807 }, // Ţ
-    { 17, 36, 16, -1, 25, 153, 19048 }, // ţ
-    { 26, 37, 27, 1, 37, 241, 19201 }, // Ť
-    { 17, 32, 16, -1, 31, 136, 19442 }, // ť
-    { 26, 27, 27, 1, 27, 176, 19578 }, // Ŧ
-    { 17, 26, 16, -1, 25, 111, 19754 }, // ŧ
-    { 30, 37, 31, 0, 36, 278, 19865 }, // Ũ
-    { 25, 31, 25, 0, 30, 194, 20143 }, // ũ
-    { 30, 36, 31, 0, 35, 270, 20337 }, // Ū
-    { 25, 29, 25, 0, 28, 182, 20607 }, // ū
-    { 30, 38, 31, 0, 37, 285, 20789 }, // Ŭ
-    { 25, 31, 25, 0, 30, 194, 21074 }, // ŭ
-    { 30, 39, 31, 0, 38, 293, 21268 }, // Ů
-    { 25, 33, 25, 0, 32, 207, 21561 }, // ů
-    { 30, 39, 31, 0, 38, 293, 21768 }, // Ű
-    { 25, 33, 25, 0, 32, 207, 22061 }, // ű
-    { 30, 36, 31, 0, 27, 270, 22268 }, // Ų
-    { 25, 29, 25, 0, 20, 182, 22538 }, // ų
-    { 42, 38, 42, 0, 37, 399, 22720 }, // Ŵ
-    { 34, 32, 34, 0, 31, 272, 23119 }, // ŵ
-    { 27, 37, 27, 0, 37, 250, 23391 }, // Ŷ
-    { 25, 40, 25, 0, 31, 250, 23641 }, // ŷ
-    { 27, 36, 27, 0, 36, 243, 23891 }, // Ÿ
-    { 22, 38, 23, 1, 37, 209, 24134 }, // Ź
-    { 19, 33, 20, 0, 32, 157, 24343 }, // ź
-    { 22, 37, 23, 1, 36, 204, 24500 }, // Ż
-    { 19, 31, 20, 0, 30, 148, 24704 }, // ż
-    { 22, 38, 23, 1, 37, 209, 24852 }, // Ž
-    { 19, 33, 20, 0, 32, 157, 25061 }, // ž
-    { 19, 30, 16, 0, 30, 143, 25218 }, // ſ
-    { 9, 10, 0, -6, 32, 23, 0 }, // ̀
-    { 8, 10, 0, -3, 32, 20, 23 }, // ́
-    { 14, 9, 0, -7, 31, 32, 43 }, // ̂
-    { 14, 7, 0, -7, 30, 25, 75 }, // ̃
-    { 14, 5, 0, -7, 28, 18, 100 }, // ̄
-    { 14, 7, 0, -7, 30, 25, 118 }, // ̆
-    { 8, 7, 0, -4, 30, 14, 143 }, // ̇
-    { 14, 6, 0, -7, 29, 21, 157 }, // ̈
-    { 12, 12, 0, -6, 34, 36, 178 }, // ̉
-    { 12, 10, 0, -6, 32, 30, 214 }, // ̊
-    { 13, 10, 0, -5, 32, 33, 244 }, // ̋
-    { 14, 9, 0, -7, 32, 32, 277 }, // ̌
-    { 13, 10, 0, -8, 32, 33, 309 }, // ̏
-    { 14, 7, 0, -7, 30, 25, 342 }, // ̑
-    { 8, 11, 0, -4, 33, 22, 367 }, // ̒
-    { 8, 11, 0, -3, 34, 22, 389 }, // ̓
-    { 8, 11, 0, -5, 34, 22, 411 }, // ̔
-    { 5, 10, 0, -2, 33, 13, 433 }, // ̕
-    { 7, 10, 0, -4, 25, 18, 446 }, // ̛
-    { 8, 6, 0, -4, -3, 12, 464 }, // ̣
-    { 14, 6, 0, -7, -3, 21, 476 }, // ̤
-    { 10, 9, 0, -5, -1, 23, 497 }, // ̥
-    { 8, 9, 0, -4, -1, 18, 520 }, // ̦
-    { 8, 10, 0, -4, -1, 20, 538 }, // ̧
-    { 10, 10, 0, -5, 1, 25, 558 }, // ̨
-    { 5, 9, 11, 3, -2, 12, 583 }, // ̩
-    { 14, 9, 0, -7, -2, 32, 595 }, // ̭
-    { 14, 8, 0, -7, -2, 28, 627 }, // ̮
-    { 14, 7, 0, -7, -3, 25, 655 }, // ̰
-    { 14, 4, 0, -7, -4, 14, 680 }, // ̱
-    { 14, 7, 0, -7, 30, 25, 694 }, // ͂
-    { 14, 15, 0, -7, 39, 53, 719 }, // ̈́
-    { 8, 8, 0, -3, -2, 16, 772 }, // ͅ
-    { 23, 37, 25, 1, 37, 213, 0 }, // Ѐ
-    { 23, 36, 25, 1, 36, 207, 213 }, // Ё
-    { 30, 35, 33, 1, 27, 263, 420 }, // Ђ
-    { 22, 37, 24, 1, 37, 204, 683 }, // Ѓ
-    { 24, 29, 26, 1, 28, 174, 887 }, // Є
-    { 20, 29, 22, 1, 28, 145, 1061 }, // Ѕ
-    { 14, 27, 16, 1, 27, 95, 1206 }, // І
-    { 16, 36, 16, 0, 36, 144, 1301 }, // Ї
-    { 17, 35, 15, -2, 27, 149, 1445 }, // Ј
-    { 37, 28, 38, 0, 27, 259, 1594 }, // Љ
-    { 39, 28, 40, 1, 27, 273, 1853 }, // Њ
-    { 34, 27, 35, 1, 27, 230, 2126 }, // Ћ
-    { 28, 38, 29, 1, 37, 266, 2356 }, // Ќ
-    { 31, 37, 32, 1, 37, 287, 2622 }, // Ѝ
-    { 28, 38, 27, 0, 37, 266, 2909 }, // Ў
-    { 29, 36, 31, 1, 27, 261, 3175 }, // Џ
-    { 30, 28, 29, 0, 28, 210, 3436 }, // А
-    { 23, 28, 25, 1, 27, 161, 3646 }, // Б
-    { 23, 28, 25, 1, 27, 161, 3807 }, // В
-    { 22, 27, 24, 1, 27, 149, 3968 }, // Г
-    { 30, 35, 30, 0, 27, 263, 4117 }, // Д
-    { 23, 27, 25, 1, 27, 156, 4380 }, // Е
-    { 42, 28, 42, 0, 27, 294, 4536 }, // Ж
-    { 22, 29, 24, 1, 28, 160, 4830 }, // З
-    { 31, 27, 32, 1, 27, 210, 4990 }, // И
-    { 31, 37, 32, 1, 37, 287, 5200 }, // Й
-    { 28, 28, 29, 1, 27, 196, 5487 }, // К
-    { 29, 28, 29, 0, 27, 203, 5683 }, // Л
-    { 36, 27, 36, 0, 27, 243, 5886 }, // М
-    { 31, 27, 33, 1, 27, 210, 6129 }, // Н
-    { 28, 29, 30, 1, 28, 203, 6339 }, // О
-    { 30, 27, 32, 1, 27, 203, 6542 }, // П
-    { 22, 27, 24, 1, 27, 149, 6745 }, // Р
-    { 23, 29, 25, 1, 28, 167, 6894 }, // С
-    { 26, 27, 27, 1, 27, 176, 7061 }, // Т
-    { 28, 28, 27, 0, 27, 196, 7237 }, // У
-    { 29, 29, 31, 1, 28, 211, 7433 }, // Ф
-    { 29, 27, 29, 0, 27, 196, 7644 }, // Х
-    { 30, 35, 32, 1, 27, 263, 7840 }, // Ц
-    { 29, 27, 29, 0, 27, 196, 8103 }, // Ч
-    { 40, 27, 42, 1, 27, 270, 8299 }, // Ш
-    { 41, 35, 43, 1, 27, 359, 8569 }, // Щ
-    { 28, 28, 30, 1, 27, 196, 8928 }, // Ъ
-    { 37, 28, 39, 1, 27, 259, 9124 }, // Ы
-    { 23, 28, 25, 1, 27, 161, 9383 }, // Ь
-    { 24, 29, 26, 1, 28, 174, 9544 }, // Э
-    { 40, 29, 42, 1, 28, 290, 9718 }, // Ю
-    { 26, 28, 27, 0, 27, 182, 10008 }, // Я
-    { 21, 22, 22, 1, 21, 116, 10190 }, // а
-    { 21, 32, 23, 1, 31, 168, 10306 }, // б
-    { 20, 22, 22, 1, 21, 110, 10474 }, // в
-    { 19, 20, 20, 1, 20, 95, 10584 }, // г
-    { 25, 27, 26, 0, 20, 169, 10679 }, // д
-    { 19, 22, 21, 1, 21, 105, 10848 }, // е
-    { 34, 22, 34, 0, 21, 187, 10953 }, // ж
-    { 19, 22, 20, 0, 21, 105, 11140 }, // з
-    { 25, 20, 26, 1, 20, 125, 11245 }, // и
-    { 25, 30, 26, 1, 30, 188, 11370 }, // й
-    { 23, 22, 24, 1, 21, 127, 11558 }, // к
-    { 24, 21, 25, 0, 20, 126, 11685 }, // л
-    { 28, 20, 30, 1, 20, 140, 11811 }, // м
-    { 25, 20, 27, 1, 20, 125, 11951 }, // н
-    { 21, 22, 23, 1, 21, 116, 12076 }, // о
-    { 25, 20, 26, 1, 20, 125, 12192 }, // п
-    { 23, 30, 24, 0, 21, 173, 12317 }, // р
-    { 18, 22, 20, 1, 21, 99, 12490 }, // с
-    { 22, 20, 23, 1, 20, 110, 12589 }, // т
-    { 25, 29, 25, 0, 20, 182, 12699 }, // у
-    { 28, 39, 30, 1, 30, 273, 12881 }, // ф
-    { 24, 20, 24, 0, 20, 120, 13154 }, // х
-    { 25, 27, 27, 1, 20, 169, 13274 }, // ц
-    { 24, 20, 24, 0, 20, 120, 13443 }, // ч
-    { 33, 20, 35, 1, 20, 165, 13563 }, // ш
-    { 34, 27, 35, 1, 20, 230, 13728 }, // щ
-    { 24, 21, 25, 1, 20, 126, 13958 }, // ъ
-    { 31, 21, 33, 1, 20, 163, 14084 }, // ы
-    { 19, 21, 21, 1, 20, 100, 14247 }, // ь
-    { 20, 22, 21, 0, 21, 110, 14347 }, // э
-    { 32, 22, 34, 1, 21, 176, 14457 }, // ю
-    { 22, 21, 23, 0, 20, 116, 14633 }, // я
-    { 19, 33, 21, 1, 32, 157, 14749 }, // ѐ
-    { 19, 30, 21, 1, 29, 143, 14906 }, // ё
-    { 23, 39, 24, 0, 30, 225, 15049 }, // ђ
-    { 19, 32, 20, 1, 32, 152, 15274 }, // ѓ
-    { 19, 22, 20, 1, 21, 105, 15426 }, // є
-    { 17, 22, 19, 1, 21, 94, 15531 }, // ѕ
-    { 13, 30, 13, 0, 30, 98, 15625 }, // і
-    { 14, 29, 13, 0, 29, 102, 15723 }, // ї
-    { 13, 39, 12, -3, 30, 127, 15825 }, // ј
-    { 30, 21, 31, 0, 20, 158, 15952 }, // љ
-    { 32, 21, 33, 1, 20, 168, 16110 }, // њ
-    { 25, 30, 25, 0, 30, 188, 16278 }, // ћ
-    { 23, 33, 24, 1, 32, 190, 16466 }, // ќ
-    { 25, 32, 26, 1, 32, 200, 16656 }, // ѝ
-    { 25, 39, 25, 0, 30, 244, 16856 }, // ў
-    { 24, 28, 26, 1, 20, 168, 17100 }, // џ
-    { 27, 31, 29, 1, 30, 210, 17268 }, // Ѣ
-    { 23, 28, 25, 1, 27, 161, 17478 }, // ѣ
-    { 28, 29, 30, 1, 28, 203, 17639 }, // Ѳ
-    { 21, 22, 23, 1, 21, 116, 17842 }, // ѳ
-    { 30, 29, 30, 0, 28, 218, 17958 }, // Ѵ
-    { 26, 22, 25, 0, 21, 143, 18176 }, // ѵ
-    { 31, 45, 32, 1, 37, 349, 18319 }, // Ҋ
-    { 25, 37, 26, 1, 30, 232, 18668 }, // ҋ
-    { 23, 28, 25, 1, 27, 161, 18900 }, // Ҍ
-    { 20, 28, 21, 0, 27, 140, 19061 }, // ҍ
-    { 22, 27, 24, 1, 27, 149, 19201 }, // Ҏ
-    { 23, 30, 24, 0, 21, 173, 19350 }, // ҏ
-    { 20, 32, 22, 1, 32, 160, 19523 }, // Ґ
-    { 18, 25, 19, 1, 25, 113, 19683 }, // ґ
-    { 22, 27, 24, 1, 27, 149, 19796 }, // Ғ
-    { 20, 20, 20, 0, 20, 100, 19945 }, // ғ
-    { 25, 35, 28, 1, 27, 219, 20045 }, // Ҕ
-    { 22, 29, 24, 1, 20, 160, 20264 }, // ҕ
-    { 42, 35, 42, 0, 27, 368, 20424 }, // Җ
-    { 34, 28, 34, 0, 21, 238, 20792 }, // җ
-    { 22, 37, 24, 1, 28, 204, 21030 }, // Ҙ
-    { 19, 29, 20, 0, 21, 138, 21234 }, // ҙ
-    { 28, 35, 29, 1, 27, 245, 21372 }, // Қ
-    { 23, 28, 24, 1, 21, 161, 21617 }, // қ
-    { 30, 28, 31, 1, 27, 210, 21778 }, // Ҝ
-    { 24, 22, 25, 1, 21, 132, 21988 }, // ҝ
-    { 28, 28, 29, 1, 27, 196, 22120 }, // Ҟ
-    { 24, 28, 24, 0, 27, 168, 22316 }, // ҟ
-    { 32, 28, 33, 1, 27, 224, 22484 }, // Ҡ
-    { 28, 22, 29, 1, 21, 154, 22708 }, // ҡ
-    { 32, 35, 33, 1, 27, 280, 22862 }, // Ң
-    { 26, 27, 27, 1, 20, 176, 23142 }, // ң
-    { 36, 27, 38, 1, 27, 243, 23318 }, // Ҥ
-    { 30, 20, 31, 1, 20, 150, 23561 }, // ҥ
-    { 40, 35, 42, 1, 27, 350, 23711 }, // Ҧ
-    { 34, 29, 36, 1, 20, 247, 24061 }, // ҧ
-    { 31, 29, 32, 1, 28, 225, 24308 }, // Ҩ
-    { 25, 22, 27, 1, 21, 138, 24533 }, // ҩ
-    { 23, 37, 25, 1, 28, 213, 24671 }, // Ҫ
-    { 18, 29, 20, 1, 21, 131, 24884 }, // ҫ
-    { 26, 35, 27, 1, 27, 228, 25015 }, // Ҭ
-    { 22, 27, 23, 1, 20, 149, 25243 }, // ҭ
-    { 27, 27, 27, 0, 27, 183, 25392 }, // Ү
-    { 25, 29, 25, 0, 20, 182, 25575 }, // ү
-    { 27, 27, 27, 0, 27, 183, 25757 }, // Ұ
-    { 25, 29, 25, 0, 20, 182, 25940 }, // ұ
-    { 30, 35, 30, 0, 27, 263, 26122 }, // Ҳ
-    { 24, 27, 24, 0, 20, 162, 26385 }, // ҳ
-    { 34, 35, 35, 1, 27, 298, 26547 }, // Ҵ
-    { 29, 27, 31, 1, 20, 196, 26845 }, // ҵ
-    { 30, 35, 30, 0, 27, 263, 27041 }, // Ҷ
-    { 25, 27, 25, 0, 20, 169, 27304 }, // ҷ
-    { 29, 27, 29, 0, 27, 196, 27473 }, // Ҹ
-    { 24, 20, 25, 0, 20, 120, 27669 }, // ҹ
-    { 28, 27, 30, 1, 27, 189, 27789 }, // Һ
-    { 25, 30, 25, 0, 30, 188, 27978 }, // һ
-    { 31, 29, 32, 0, 28, 225, 28166 }, // Ҽ
-    { 25, 22, 25, 0, 21, 138, 28391 }, // ҽ
-    { 31, 36, 32, 0, 28, 279, 28529 }, // Ҿ
-    { 25, 29, 25, 0, 21, 182, 28808 }, // ҿ
-    { 14, 27, 16, 1, 27, 95, 28990 }, // Ӏ
-    { 42, 38, 42, 0, 37, 399, 29085 }, // Ӂ
-    { 34, 31, 34, 0, 30, 264, 29484 }, // ӂ
-    { 26, 35, 28, 1, 27, 228, 29748 }, // Ӄ
-    { 22, 30, 24, 1, 21, 165, 29976 }, // ӄ
-    { 29, 35, 29, 0, 27, 254, 30141 }, // Ӆ
-    { 24, 27, 25, 0, 20, 162, 30395 }, // ӆ
-    { 31, 35, 32, 1, 27, 272, 30557 }, // Ӈ
-    { 25, 29, 26, 1, 20, 182, 30829 }, // ӈ
-    { 31, 35, 33, 1, 27, 272, 31011 }, // Ӊ
-    { 26, 27, 27, 1, 20, 176, 31283 }, // ӊ
-    { 29, 35, 29, 0, 27, 254, 31459 }, // Ӌ
-    { 24, 27, 24, 0, 20, 162, 31713 }, // ӌ
-    { 36, 35, 37, 0, 27, 315, 31875 }, // Ӎ
-    { 29, 27, 30, 1, 20, 196, 32190 }, // ӎ
-    { 14, 29, 16, 1, 29, 102, 32386 }, // ӏ
-    { 30, 37, 29, 0, 37, 278, 32488 }, // Ӑ
-    { 21, 31, 22, 1, 30, 163, 32766 }, // ӑ
-    { 30, 36, 29, 0, 36, 270, 32929 }, // Ӓ
-    { 21, 30, 22, 1, 29, 158, 33199 }, // ӓ
-    { 37, 27, 37, -1, 27, 250, 33357 }, // Ӕ
-    { 30, 22, 32, 1, 21, 165, 33607 }, // ӕ
-    { 23, 37, 25, 1, 37, 213, 33772 }, // Ӗ
-    { 19, 31, 21, 1, 30, 148, 33985 }, // ӗ
-    { 24, 29, 27, 1, 28, 174, 34133 }, // Ә
-    { 19, 22, 21, 1, 21, 105, 34307 }, // ә
-    { 24, 37, 27, 1, 36, 222, 34412 }, // Ӛ
-    { 19, 30, 21, 1, 29, 143, 34634 }, // ӛ
-    { 42, 37, 42, 0, 36, 389, 34777 }, // Ӝ
-    { 34, 30, 34, 0, 29, 255, 35166 }, // ӝ
-    { 22, 37, 24, 1, 36, 204, 35421 }, // Ӟ
-    { 19, 30, 20, 0, 29, 143, 35625 }, // ӟ
-    { 20, 28, 22, 1, 27, 140, 35768 }, // Ӡ
-    { 20, 29, 21, 0, 20, 145, 35908 }, // ӡ
-    { 31, 35, 32, 1, 35, 272, 36053 }, // Ӣ
-    { 25, 28, 26, 1, 28, 175, 36325 }, // ӣ
-    { 31, 36, 32, 1, 36, 279, 36500 }, // Ӥ
-    { 25, 29, 26, 1, 29, 182, 36779 }, // ӥ
-    { 28, 37, 30, 1, 36, 259, 36961 }, // Ӧ
-    { 21, 30, 23, 1, 29, 158, 37220 }, // ӧ
-    { 28, 29, 30, 1, 28, 203, 37378 }, // Ө
-    { 21, 22, 23, 1, 21, 116, 37581 }, // ө
-    { 28, 37, 30, 1, 36, 259, 37697 }, // Ӫ
-    { 21, 30, 23, 1, 29, 158, 37956 }, // ӫ
-    { 24, 37, 26, 1, 36, 222, 38114 }, // Ӭ
-    { 20, 30, 21, 0, 29, 150, 38336 }, // ӭ
-    { 28, 36, 27, 0, 35, 252, 38486 }, // Ӯ
-    { 25, 37, 25, 0, 28, 232, 38738 }, // ӯ
-    { 28, 37, 27, 0, 36, 259, 38970 }, // Ӱ
-    { 25, 38, 25, 0, 29, 238, 39229 }, // ӱ
-    { 28, 39, 27, 0, 38, 273, 39467 }, // Ӳ
-    { 25, 41, 25, 0, 32, 257, 39740 }, // ӳ
-    { 29, 36, 29, 0, 36, 261, 39997 }, // Ӵ
-    { 24, 29, 24, 0, 29, 174, 40258 }, // ӵ
-    { 22, 35, 24, 1, 27, 193, 40432 }, // Ӷ
-    { 19, 27, 20, 1, 20, 129, 40625 }, // ӷ
-    { 37, 37, 39, 1, 36, 343, 40754 }, // Ӹ
-    { 31, 30, 33, 1, 29, 233, 41097 }, // ӹ
-    { 22, 35, 24, 1, 27, 193, 41330 }, // Ӻ
-    { 20, 28, 20, 0, 20, 140, 41523 }, // ӻ
-    { 28, 35, 29, 0, 27, 245, 41663 }, // Ӽ
-    { 23, 29, 23, 0, 20, 167, 41908 }, // ӽ
-    { 29, 27, 29, 0, 27, 196, 42075 }, // Ӿ
-    { 24, 20, 24, 0, 20, 120, 42271 }, // ӿ
-    { 0, 0, 19, 0, 0, 0, 0 }, //  
-    { 0, 0, 38, 0, 0, 0, 0 }, //  
-    { 0, 0, 19, 0, 0, 0, 0 }, //  
-    { 0, 0, 38, 0, 0, 0, 0 }, //  
-    { 0, 0, 13, 0, 0, 0, 0 }, //  
-    { 0, 0, 10, 0, 0, 0, 0 }, //  
-    { 0, 0, 6, 0, 0, 0, 0 }, //  
-    { 0, 0, 24, 0, 0, 0, 0 }, //  
-    { 0, 0, 11, 0, 0, 0, 0 }, //  
-    { 0, 0, 8, 0, 0, 0, 0 }, //  
-    { 0, 0, 2, 0, 0, 0, 0 }, //  
-    { 0, 0, 0, 0, 0, 0, 0 }, // ​
-    { 2, 31, 0, -1, 22, 16, 0 }, // ‌
-    { 8, 34, 0, -4, 25, 68, 16 }, // ‍
-    { 14, 36, 0, -7, 27, 126, 84 }, // ‎
-    { 14, 36, 0, -7, 27, 126, 210 }, // ‏
-    { 13, 5, 14, 1, 12, 17, 336 }, // ‐
-    { 13, 5, 14, 1, 12, 17, 353 }, // ‑
-    { 19, 5, 24, 2, 15, 24, 370 }, // ‒
-    { 19, 5, 19, 0, 12, 24, 394 }, // –
-    { 38, 5, 38, 0, 12, 48, 418 }, // —
-    { 38, 5, 38, 0, 12, 48, 466 }, // ―
-    { 13, 39, 19, 3, 30, 127, 514 }, // ‖
-    { 19, 11, 19, 0, -1, 53, 641 }, // ‗
-    { 8, 13, 9, 1, 29, 26, 694 }, // ‘
-    { 7, 13, 9, 1, 29, 23, 720 }, // ’
-    { 7, 12, 9, 1, 5, 21, 743 }, // ‚
-    { 8, 13, 9, 1, 29, 26, 764 }, // ‛
-    { 15, 13, 17, 1, 29, 49, 790 }, // “
-    { 15, 13, 17, 1, 29, 49, 839 }, // ”
-    { 15, 12, 17, 1, 5, 45, 888 }, // „
-    { 15, 13, 17, 1, 29, 49, 933 }, // ‟
-    { 17, 25, 19, 1, 27, 107, 982 }, // †
-    { 17, 29, 19, 1, 27, 124, 1089 }, // ‡
-    { 9, 10, 11, 1, 15, 23, 1213 }, // •
-    { 14, 14, 24, 5, 20, 49, 1236 }, // ‣
-    { 7, 7, 11, 2, 6, 13, 1285 }, // ․
-    { 17, 7, 19, 1, 6, 30, 1298 }, // ‥
-    { 34, 7, 38, 2, 6, 60, 1328 }, // …
-    { 7, 7, 11, 2, 14, 13, 1388 }, // ‧
-    { 0, 0, 0, 0, 0, 0, 1401 }, //  
-    { 0, 0, 0, 0, 0, 0, 1401 }, //  
-    { 14, 36, 0, -7, 27, 126, 1401 }, // ‪
-    { 14, 36, 0, -7, 27, 126, 1527 }, // ‫
-    { 12, 35, 0, -6, 26, 105, 1653 }, // ‬
-    { 16, 36, 0, -8, 27, 144, 1758 }, // ‭
-    { 16, 36, 0, -8, 27, 144, 1902 }, // ‮
-    { 0, 0, 4, 0, 0, 0, 2046 }, //  
-    { 51, 30, 53, 1, 28, 383, 2046 }, // ‰
-    { 9, 13, 10, 1, 27, 30, 2429 }, // ′
-    { 17, 13, 19, 1, 27, 56, 2459 }, // ″
-    { 25, 13, 27, 1, 27, 82, 2515 }, // ‴
-    { 10, 13, 10, 0, 27, 33, 2597 }, // ‵
-    { 17, 13, 19, 1, 27, 56, 2630 }, // ‶
-    { 26, 13, 28, 1, 27, 85, 2686 }, // ‷
-    { 17, 8, 19, 1, 0, 34, 2771 }, // ‸
-    { 11, 15, 13, 1, 17, 42, 2805 }, // ‹
-    { 11, 15, 13, 1, 17, 42, 2847 }, // ›
-    { 24, 26, 24, 0, 25, 156, 2889 }, // ※
-    { 19, 30, 22, 2, 29, 143, 3045 }, // ‼
-    { 19, 4, 19, 0, 32, 19, 3188 }, // ‾
-    { 10, 5, 11, 1, 12, 13, 3207 }, // ⁃
-    { 21, 31, 7, -7, 28, 163, 3220 }, // ⁄
-    { 32, 29, 36, 2, 28, 232, 3383 }, // ⁇
-    { 26, 30, 29, 2, 29, 195, 3615 }, // ⁈
-    { 26, 30, 29, 2, 29, 195, 3810 }, // ⁉
-    { 23, 8, 38, 7, 15, 46, 4005 }, // ⁓
-    { 34, 13, 35, 1, 27, 111, 4051 }, // ⁗
-    { 0, 0, 8, 0, 0, 0, 4162 }, //  
-    { 0, 0, 0, 0, 0, 0, 4162 }, // ⁠
-    { 0, 0, 0, 0, 0, 0, 4162 }, // ⁡
-    { 0, 0, 0, 0, 0, 0, 4162 }, // ⁢
-    { 0, 0, 0, 0, 0, 0, 4162 }, // ⁣
-    { 0, 0, 0, 0, 0, 0, 4162 }, // ⁤
-    { 17, 19, 17, 0, 32, 81, 0 }, // ⁰
-    { 17, 19, 17, 0, 32, 81, 81 }, // ⁴
-    { 13, 18, 17, 2, 31, 59, 162 }, // ⁵
-    { 15, 19, 17, 1, 32, 72, 221 }, // ⁶
-    { 14, 18, 17, 2, 31, 63, 293 }, // ⁷
-    { 15, 19, 17, 1, 32, 72, 356 }, // ⁸
-    { 15, 19, 17, 1, 32, 72, 428 }, // ⁹
-    { 17, 14, 21, 2, 27, 60, 500 }, // ⁿ
-    { 17, 19, 17, 0, 13, 81, 560 }, // ₀
-    { 13, 18, 17, 2, 13, 59, 641 }, // ₁
-    { 15, 18, 17, 1, 13, 68, 700 }, // ₂
-    { 13, 19, 17, 2, 13, 62, 768 }, // ₃
-    { 17, 19, 17, 0, 13, 81, 830 }, // ₄
-    { 13, 18, 17, 2, 12, 59, 911 }, // ₅
-    { 15, 19, 17, 1, 13, 72, 970 }, // ₆
-    { 14, 18, 17, 2, 12, 63, 1042 }, // ₇
-    { 15, 19, 17, 1, 13, 72, 1105 }, // ₈
-    { 15, 19, 17, 1, 13, 72, 1177 }, // ₉
-    { 22, 26, 24, 1, 26, 143, 0 }, // ₣
-    { 22, 28, 24, 1, 27, 154, 143 }, // ₤
-    { 50, 28, 52, 1, 27, 350, 297 }, // ₧
-    { 24, 28, 24, 0, 27, 168, 647 }, // €
-    { 24, 18, 38, 7, 22, 108, 0 }, // ←
-    { 18, 25, 38, 10, 26, 113, 108 }, // ↑
-    { 24, 18, 38, 7, 22, 108, 221 }, // →
-    { 18, 25, 38, 10, 26, 113, 329 }, // ↓
-    { 24, 17, 38, 7, 22, 102, 442 }, // ↔
-    { 16, 26, 38, 11, 26, 104, 544 }, // ↕
-    { 18, 27, 38, 10, 27, 122, 648 }, // ↨
-    { 18, 26, 38, 10, 26, 117, 770 }, // ↲
-    { 18, 26, 38, 10, 26, 117, 887 }, // ↳
-    { 22, 20, 38, 8, 23, 110, 1004 }, // ↵
-    { 24, 22, 38, 7, 24, 132, 1114 }, // ⇐
-    { 22, 24, 38, 8, 25, 132, 1246 }, // ⇑
-    { 24, 22, 38, 7, 24, 132, 1378 }, // ⇒
-    { 22, 24, 38, 8, 25, 132, 1510 }, // ⇓
-    { 24, 20, 38, 7, 23, 120, 1642 }, // ⇔
-    { 26, 28, 38, 6, 27, 182, 0 }, // ∀
-    { 20, 31, 24, 2, 30, 155, 182 }, // ∂
-    { 20, 27, 38, 9, 27, 135, 337 }, // ∃
-    { 30, 30, 38, 4, 28, 225, 472 }, // ∅
-    { 25, 28, 26, 0, 28, 175, 697 }, // ∆
-    { 26, 28, 38, 6, 27, 182, 872 }, // ∇
-    { 26, 27, 38, 6, 27, 176, 1054 }, // ∈
-    { 26, 34, 38, 6, 30, 221, 1230 }, // ∉
-    { 26, 23, 38, 6, 25, 150, 1451 }, // ∊
-    { 26, 27, 38, 6, 27, 176, 1601 }, // ∋
-    { 26, 34, 38, 6, 30, 221, 1777 }, // ∌
-    { 26, 23, 38, 6, 25, 150, 1998 }, // ∍
-    { 30, 33, 32, 1, 27, 248, 2148 }, // ∏
-    { 24, 34, 25, 1, 27, 204, 2396 }, // ∑
-    { 18, 4, 24, 3, 15, 18, 2600 }, // −
-    { 18, 30, 20, 1, 28, 135, 2618 }, // ∕
-    { 18, 30, 20, 1, 28, 135, 2753 }, // ∖
-    { 18, 18, 24, 3, 22, 81, 2888 }, // ∗
-    { 14, 14, 24, 5, 20, 49, 2969 }, // ∘
-    { 8, 7, 24, 8, 14, 14, 3018 }, // ∙
-    { 25, 36, 24, -1, 31, 225, 3032 }, // √
-    { 19, 16, 24, 2, 20, 76, 3257 }, // ∝
-    { 24, 14, 24, 0, 19, 84, 3333 }, // ∞
-    { 24, 27, 38, 7, 27, 162, 3417 }, // ∟
-    { 28, 27, 38, 5, 27, 189, 3579 }, // ∠
-    { 5, 39, 19, 7, 30, 49, 3768 }, // ∣
-    { 13, 39, 19, 3, 30, 127, 3817 }, // ∥
-    { 26, 27, 38, 6, 27, 176, 3944 }, // ∧
-    { 26, 27, 38, 6, 27, 176, 4120 }, // ∨
-    { 22, 28, 38, 8, 28, 154, 4296 }, // ∩
-    { 22, 28, 38, 8, 27, 154, 4450 }, // ∪
-    { 22, 39, 24, 1, 30, 215, 4604 }, // ∫
-    { 26, 22, 38, 6, 21, 143, 4819 }, // ∴
-    { 26, 22, 38, 6, 21, 143, 4962 }, // ∵
-    { 8, 22, 12, 2, 24, 44, 5105 }, // ∶
-    { 26, 22, 38, 6, 21, 143, 5149 }, // ∷
-    { 23, 8, 38, 7, 15, 46, 5292 }, // ∼
-    { 23, 22, 38, 7, 24, 127, 5338 }, // ≅
-    { 19, 16, 24, 2, 21, 76, 5465 }, // ≈
-    { 22, 15, 38, 8, 18, 83, 5541 }, // ≍
-    { 18, 19, 24, 3, 22, 86, 5624 }, // ≠
-    { 22, 19, 38, 8, 21, 105, 5710 }, // ≡
-    { 18, 23, 24, 3, 23, 104, 5815 }, // ≤
-    { 18, 24, 24, 3, 24, 108, 5919 }, // ≥
-    { 32, 18, 38, 3, 22, 144, 6027 }, // ≪
-    { 32, 18, 38, 3, 22, 144, 6171 }, // ≫
-    { 26, 23, 38, 6, 25, 150, 6315 }, // ⊃
-    { 26, 34, 38, 6, 30, 221, 6465 }, // ⊄
-    { 26, 34, 38, 6, 30, 221, 6686 }, // ⊅
-    { 26, 27, 38, 6, 27, 176, 6907 }, // ⊆
-    { 26, 27, 38, 6, 27, 176, 7083 }, // ⊇
-    { 28, 28, 38, 5, 27, 196, 7259 }, // ⊕
-    { 28, 28, 38, 5, 27, 196, 7455 }, // ⊖
-    { 28, 28, 38, 5, 27, 196, 7651 }, // ⊗
-    { 28, 28, 38, 5, 27, 196, 7847 }, // ⊘
-    { 22, 27, 38, 8, 27, 149, 8043 }, // ⊥
-    { 8, 7, 24, 8, 14, 14, 8192 }, // ⋅
-    { 34, 7, 38, 2, 14, 60, 8206 }, // ⋯
-    { 36, 36, 38, 1, 32, 324, 0 }, // �
+    { 20, 15, 22, 1, 17, 75, 12924 }, // «
+    { 18, 10, 24, 3, 18, 45, 1160 }, // ¬
+    { 13, 5, 14, 1, 12, 17, 1205 }, // ­
+    { 20, 21, 22, 1, 30, 105, 1222 }, // ®
+    { 14, 5, 26, 6, 28, 18, 1327 }, // ¯
+    { 14, 14, 20, 3, 27, 49, 1345 }, // °
+    { 18, 24, 24, 3, 23, 108, 1394 }, // ±
+    { 15, 18, 17, 1, 32, 68, 1502 }, // ²
+    { 13, 19, 17, 2, 32, 62, 1570 }, // ³
+    { 8, 10, 26, 9, 32, 20, 1632 }, // ´
+    { 24, 30, 25, 2, 21, 180, 1652 }, // µ
+    { 22, 33, 23, 0, 27, 182, 1832 }, // ¶
+    { 7, 7, 11, 2, 14, 13, 2014 }, // ·
+    { 8, 10, 26, 9, -1, 20, 2027 }, // ¸
+    { 13, 18, 17, 2, 32, 59, 2047 }, // ¹
+    { 15, 20, 17, 1, 28, 75, 2106 }, // º
+    { 21, 15, 22, 1, 17, 79, 12999 }, // »
+    { 38, 31, 41, 2, 28, 295, 2181 }, // ¼
+    { 38, 31, 41, 2, 28, 295, 2476 }, // ½
+    { 38, 31, 41, 2, 28, 295, 2771 }, // ¾
+    { 16, 29, 19, 1, 21, 116, 3066 }, // ¿
+    { 30, 37, 29, 0, 37, 278, 13078 }, // À
+    { 30, 37, 29, 0, 37, 278, 13356 }, // Á
+    { 30, 37, 29, 0, 37, 278, 13634 }, // Â
+    { 30, 36, 29, 0, 36, 270, 3182 }, // Ã
+    { 30, 36, 29, 0, 36, 270, 13912 }, // Ä
+    { 30, 38, 29, 0, 38, 285, 3452 }, // Å
+    { 37, 27, 37, -1, 27, 250, 3737 }, // Æ
+    { 23, 38, 25, 1, 28, 219, 14182 }, // Ç
+    { 23, 37, 25, 1, 37, 213, 14401 }, // È
+    { 23, 37, 25, 1, 37, 213, 14614 }, // É
+    { 23, 37, 25, 1, 37, 213, 14827 }, // Ê
+    { 23, 36, 25, 1, 36, 207, 15040 }, // Ë
+    { 14, 37, 16, 1, 37, 130, 15247 }, // Ì
+    { 14, 37, 16, 1, 37, 130, 15377 }, // Í
+    { 15, 37, 16, 0, 37, 139, 15507 }, // Î
+    { 16, 36, 16, 0, 36, 144, 15646 }, // Ï
+    { 28, 28, 29, 0, 27, 196, 3987 }, // Ð
+    { 31, 37, 31, 0, 36, 287, 15790 }, // Ñ
+    { 28, 38, 30, 1, 37, 266, 16077 }, // Ò
+    { 28, 38, 30, 1, 37, 266, 16343 }, // Ó
+    { 28, 38, 30, 1, 37, 266, 16609 }, // Ô
+    { 28, 37, 30, 1, 36, 259, 4183 }, // Õ
+    { 28, 37, 30, 1, 36, 259, 16875 }, // Ö
+    { 17, 17, 24, 3, 21, 73, 4442 }, // ×
+    { 29, 29, 30, 0, 28, 211, 4515 }, // Ø
+    { 30, 38, 31, 0, 37, 285, 17134 }, // Ù
+    { 30, 38, 31, 0, 37, 285, 17419 }, // Ú
+    { 30, 38, 31, 0, 37, 285, 17704 }, // Û
+    { 30, 37, 31, 0, 36, 278, 17989 }, // Ü
+    { 27, 37, 27, 0, 37, 250, 4726 }, // Ý
+    { 23, 27, 25, 1, 27, 156, 4976 }, // Þ
+    { 25, 31, 25, 0, 30, 194, 5132 }, // ß
+    { 21, 33, 22, 1, 32, 174, 18267 }, // à
+    { 21, 33, 22, 1, 32, 174, 18441 }, // á
+    { 21, 32, 22, 1, 31, 168, 18615 }, // â
+    { 21, 31, 22, 1, 30, 163, 5326 }, // ã
+    { 21, 30, 22, 1, 29, 158, 18783 }, // ä
+    { 21, 33, 22, 1, 32, 174, 5489 }, // å
+    { 30, 22, 32, 1, 21, 165, 5663 }, // æ
+    { 18, 32, 20, 1, 21, 144, 18941 }, // ç
+    { 19, 33, 21, 1, 32, 157, 19085 }, // è
+    { 19, 33, 21, 1, 32, 157, 19242 }, // é
+    { 19, 32, 21, 1, 31, 152, 19399 }, // ê
+    { 19, 30, 21, 1, 29, 143, 19551 }, // ë
+    { 13, 32, 13, 0, 32, 104, 19694 }, // ì
+    { 13, 32, 13, 0, 32, 104, 19798 }, // í
+    { 14, 31, 13, 0, 31, 109, 19902 }, // î
+    { 14, 29, 13, 0, 29, 102, 20011 }, // ï
+    { 21, 32, 23, 1, 31, 168, 5828 }, // ð
+    { 26, 30, 26, 0, 30, 195, 20113 }, // ñ
+    { 21, 33, 23, 1, 32, 174, 20308 }, // ò
+    { 21, 33, 23, 1, 32, 174, 20482 }, // ó
+    { 21, 32, 23, 1, 31, 168, 20656 }, // ô
+    { 21, 31, 23, 1, 30, 163, 5996 }, // õ
+    { 21, 30, 23, 1, 29, 158, 20824 }, // ö
+    { 18, 18, 24, 3, 22, 81, 6159 }, // ÷
+    { 22, 22, 23, 0, 21, 121, 6240 }, // ø
+    { 25, 33, 25, 0, 32, 207, 20982 }, // ù
+    { 25, 33, 25, 0, 32, 207, 21189 }, // ú
+    { 25, 32, 25, 0, 31, 200, 21396 }, // û
+    { 25, 30, 25, 0, 29, 188, 21596 }, // ü
+    { 25, 41, 25, 0, 32, 257, 6361 }, // ý
+    { 23, 39, 24, 0, 30, 225, 6618 }, // þ
+    { 25, 38, 25, 0, 29, 238, 6843 }, // ÿ
+    { 30, 35, 29, 0, 35, 263, 7081 }, // Ā
+    { 21, 29, 22, 1, 28, 153, 7344 }, // ā
+    { 30, 37, 29, 0, 37, 278, 7497 }, // Ă
+    { 21, 31, 22, 1, 30, 163, 7775 }, // ă
+    { 30, 37, 29, 0, 28, 278, 7938 }, // Ą
+    { 21, 30, 22, 1, 21, 158, 8216 }, // ą
+    { 23, 38, 25, 1, 37, 219, 8374 }, // Ć
+    { 18, 33, 20, 1, 32, 149, 8593 }, // ć
+    { 23, 38, 25, 1, 37, 219, 8742 }, // Ĉ
+    { 18, 32, 20, 1, 31, 144, 8961 }, // ĉ
+    { 23, 37, 25, 1, 36, 213, 9105 }, // Ċ
+    { 18, 31, 20, 1, 30, 140, 9318 }, // ċ
+    { 23, 38, 25, 1, 37, 219, 9458 }, // Č
+    { 18, 33, 20, 1, 32, 149, 9677 }, // č
+    { 27, 38, 29, 1, 37, 257, 9826 }, // Ď
+    { 27, 31, 25, 1, 30, 210, 10083 }, // ď
+    { 28, 28, 29, 0, 27, 196, 10293 }, // Đ
+    { 23, 31, 24, 1, 30, 179, 10489 }, // đ
+    { 23, 35, 25, 1, 35, 202, 10668 }, // Ē
+    { 19, 29, 21, 1, 28, 138, 10870 }, // ē
+    { 23, 37, 25, 1, 37, 213, 11008 }, // Ĕ
+    { 19, 31, 21, 1, 30, 148, 11221 }, // ĕ
+    { 23, 36, 25, 1, 36, 207, 11369 }, // Ė
+    { 19, 31, 21, 1, 30, 148, 11576 }, // ė
+    { 23, 36, 25, 1, 27, 207, 11724 }, // Ę
+    { 19, 30, 21, 1, 21, 143, 11931 }, // ę
+    { 23, 37, 25, 1, 37, 213, 12074 }, // Ě
+    { 19, 33, 21, 1, 32, 157, 12287 }, // ě
+    { 26, 38, 28, 1, 37, 247, 12444 }, // Ĝ
+    { 23, 40, 23, 0, 31, 230, 12691 }, // ĝ
+    { 26, 38, 28, 1, 37, 247, 12921 }, // Ğ
+    { 23, 39, 23, 0, 30, 225, 13168 }, // ğ
+    { 26, 37, 28, 1, 36, 241, 13393 }, // Ġ
+    { 23, 39, 23, 0, 30, 225, 13634 }, // ġ
+    { 26, 38, 28, 1, 28, 247, 13859 }, // Ģ
+    { 23, 42, 23, 0, 33, 242, 14106 }, // ģ
+    { 31, 37, 33, 1, 37, 287, 14348 }, // Ĥ
+    { 26, 39, 25, -1, 39, 254, 14635 }, // ĥ
+    { 32, 27, 33, 0, 27, 216, 14889 }, // Ħ
+    { 25, 30, 25, 0, 30, 188, 15105 }, // ħ
+    { 14, 36, 16, 1, 36, 126, 15293 }, // Ĩ
+    { 14, 30, 13, 0, 30, 105, 15419 }, // ĩ
+    { 14, 35, 16, 1, 35, 123, 15524 }, // Ī
+    { 14, 28, 13, 0, 28, 98, 15647 }, // ī
+    { 14, 37, 16, 1, 37, 130, 15745 }, // Ĭ
+    { 14, 30, 13, 0, 30, 105, 15875 }, // ĭ
+    { 14, 36, 16, 1, 27, 126, 15980 }, // Į
+    { 14, 39, 13, 0, 30, 137, 16106 }, // į
+    { 14, 36, 16, 1, 36, 126, 16243 }, // İ
+    { 13, 21, 13, 0, 21, 69, 16369 }, // ı
+    { 30, 35, 31, 1, 27, 263, 16438 }, // Ĳ
+    { 24, 39, 26, 0, 30, 234, 16701 }, // ĳ
+    { 17, 45, 15, -2, 37, 192, 16935 }, // Ĵ
+    { 16, 40, 12, -3, 31, 160, 17127 }, // ĵ
+    { 28, 37, 29, 1, 27, 259, 17287 }, // Ķ
+    { 24, 40, 24, 0, 30, 240, 17546 }, // ķ
+    { 25, 22, 25, 0, 21, 138, 17786 }, // ĸ
+    { 23, 37, 24, 1, 37, 213, 17924 }, // Ĺ
+    { 13, 39, 13, 0, 39, 127, 18137 }, // ĺ
+    { 23, 37, 24, 1, 27, 213, 18264 }, // Ļ
+    { 13, 40, 13, 0, 30, 130, 18477 }, // ļ
+    { 23, 30, 24, 1, 30, 173, 18607 }, // Ľ
+    { 17, 30, 14, 0, 30, 128, 18780 }, // ľ
+    { 23, 27, 24, 1, 27, 156, 18908 }, // Ŀ
+    { 20, 30, 20, 0, 30, 150, 19064 }, // ŀ
+    { 25, 27, 24, -1, 27, 169, 19214 }, // Ł
+    { 15, 30, 13, -1, 30, 113, 19383 }, // ł
+    { 31, 38, 31, 0, 37, 295, 19496 }, // Ń
+    { 26, 32, 26, 0, 32, 208, 19791 }, // ń
+    { 31, 37, 31, 0, 27, 287, 19999 }, // Ņ
+    { 26, 31, 26, 0, 21, 202, 20286 }, // ņ
+    { 31, 38, 31, 0, 37, 295, 20488 }, // Ň
+    { 26, 32, 26, 0, 32, 208, 20783 }, // ň
+    { 33, 28, 35, 1, 28, 231, 20991 }, // ŉ
+    { 31, 35, 31, 0, 27, 272, 21222 }, // Ŋ
+    { 23, 30, 25, 0, 21, 173, 21494 }, // ŋ
+    { 28, 36, 30, 1, 35, 252, 21667 }, // Ō
+    { 21, 29, 23, 1, 28, 153, 21919 }, // ō
+    { 28, 38, 30, 1, 37, 266, 22072 }, // Ŏ
+    { 21, 31, 23, 1, 30, 163, 22338 }, // ŏ
+    { 28, 39, 30, 1, 38, 273, 22501 }, // Ő
+    { 21, 33, 23, 1, 32, 174, 22774 }, // ő
+    { 36, 28, 38, 1, 27, 252, 21784 }, // Œ
+    { 33, 22, 35, 1, 21, 182, 22036 }, // œ
+    { 27, 38, 27, 1, 37, 257, 22948 }, // Ŕ
+    { 18, 32, 18, 0, 32, 144, 23205 }, // ŕ
+    { 27, 37, 27, 1, 27, 250, 23349 }, // Ŗ
+    { 18, 31, 18, 0, 21, 140, 23599 }, // ŗ
+    { 27, 38, 27, 1, 37, 257, 23739 }, // Ř
+    { 18, 32, 18, 0, 32, 144, 23996 }, // ř
+    { 20, 38, 22, 1, 37, 190, 24140 }, // Ś
+    { 17, 33, 19, 1, 32, 141, 24330 }, // ś
+    { 20, 38, 22, 1, 37, 190, 24471 }, // Ŝ
+    { 17, 32, 19, 1, 31, 136, 24661 }, // ŝ
+    { 20, 38, 22, 1, 28, 190, 24797 }, // Ş
+    { 17, 32, 19, 1, 21, 136, 24987 }, // ş
+    { 20, 38, 22, 1, 37, 190, 25123 }, // Š
+    { 17, 33, 19, 1, 32, 141, 25313 }, // š
+    { 26, 37, 27, 1, 27, 241, 25454 }, // Ţ
+    { 17, 36, 16, -1, 25, 153, 25695 }, // ţ
+    { 26, 37, 27, 1, 37, 241, 25848 }, // Ť
+    { 17, 32, 16, -1, 31, 136, 26089 }, // ť
+    { 26, 27, 27, 1, 27, 176, 26225 }, // Ŧ
+    { 17, 26, 16, -1, 25, 111, 26401 }, // ŧ
+    { 30, 37, 31, 0, 36, 278, 26512 }, // Ũ
+    { 25, 31, 25, 0, 30, 194, 26790 }, // ũ
+    { 30, 36, 31, 0, 35, 270, 26984 }, // Ū
+    { 25, 29, 25, 0, 28, 182, 27254 }, // ū
+    { 30, 38, 31, 0, 37, 285, 27436 }, // Ŭ
+    { 25, 31, 25, 0, 30, 194, 27721 }, // ŭ
+    { 30, 39, 31, 0, 38, 293, 27915 }, // Ů
+    { 25, 33, 25, 0, 32, 207, 28208 }, // ů
+    { 30, 39, 31, 0, 38, 293, 28415 }, // Ű
+    { 25, 33, 25, 0, 32, 207, 28708 }, // ű
+    { 30, 36, 31, 0, 27, 270, 28915 }, // Ų
+    { 25, 29, 25, 0, 20, 182, 29185 }, // ų
+    { 42, 38, 42, 0, 37, 399, 29367 }, // Ŵ
+    { 34, 32, 34, 0, 31, 272, 29766 }, // ŵ
+    { 27, 37, 27, 0, 37, 250, 30038 }, // Ŷ
+    { 25, 40, 25, 0, 31, 250, 30288 }, // ŷ
+    { 27, 36, 27, 0, 36, 243, 30538 }, // Ÿ
+    { 22, 38, 23, 1, 37, 209, 30781 }, // Ź
+    { 19, 33, 20, 0, 32, 157, 30990 }, // ź
+    { 22, 37, 23, 1, 36, 204, 31147 }, // Ż
+    { 19, 31, 20, 0, 30, 148, 31351 }, // ż
+    { 22, 38, 23, 1, 37, 209, 31499 }, // Ž
+    { 19, 33, 20, 0, 32, 157, 31708 }, // ž
+    { 19, 30, 16, 0, 30, 143, 31865 }, // ſ
+    { 9, 10, 0, -6, 32, 23, 32008 }, // ̀
+    { 8, 10, 0, -3, 32, 20, 32031 }, // ́
+    { 14, 9, 0, -7, 31, 32, 32051 }, // ̂
+    { 14, 7, 0, -7, 30, 25, 32083 }, // ̃
+    { 14, 5, 0, -7, 28, 18, 32108 }, // ̄
+    { 14, 7, 0, -7, 30, 25, 32126 }, // ̆
+    { 8, 7, 0, -4, 30, 14, 32151 }, // ̇
+    { 14, 6, 0, -7, 29, 21, 32165 }, // ̈
+    { 12, 12, 0, -6, 34, 36, 32186 }, // ̉
+    { 12, 10, 0, -6, 32, 30, 32222 }, // ̊
+    { 13, 10, 0, -5, 32, 33, 32252 }, // ̋
+    { 14, 9, 0, -7, 32, 32, 32285 }, // ̌
+    { 13, 10, 0, -8, 32, 33, 32317 }, // ̏
+    { 14, 7, 0, -7, 30, 25, 32350 }, // ̑
+    { 8, 11, 0, -4, 33, 22, 32375 }, // ̒
+    { 8, 11, 0, -3, 34, 22, 32397 }, // ̓
+    { 8, 11, 0, -5, 34, 22, 32419 }, // ̔
+    { 5, 10, 0, -2, 33, 13, 32441 }, // ̕
+    { 7, 10, 0, -4, 25, 18, 32454 }, // ̛
+    { 8, 6, 0, -4, -3, 12, 32472 }, // ̣
+    { 14, 6, 0, -7, -3, 21, 32484 }, // ̤
+    { 10, 9, 0, -5, -1, 23, 32505 }, // ̥
+    { 8, 9, 0, -4, -1, 18, 32528 }, // ̦
+    { 8, 10, 0, -4, -1, 20, 32546 }, // ̧
+    { 10, 10, 0, -5, 1, 25, 32566 }, // ̨
+    { 5, 9, 11, 3, -2, 12, 32591 }, // ̩
+    { 14, 9, 0, -7, -2, 32, 32603 }, // ̭
+    { 14, 8, 0, -7, -2, 28, 32635 }, // ̮
+    { 14, 7, 0, -7, -3, 25, 32663 }, // ̰
+    { 14, 4, 0, -7, -4, 14, 32688 }, // ̱
+    { 14, 7, 0, -7, 30, 25, 32702 }, // ͂
+    { 14, 15, 0, -7, 39, 53, 32727 }, // ̈́
+    { 8, 8, 0, -3, -2, 16, 32780 }, // ͅ
+    { 23, 37, 25, 1, 37, 213, 32796 }, // Ѐ
+    { 23, 36, 25, 1, 36, 207, 0 }, // Ё
+    { 30, 35, 33, 1, 27, 263, 33009 }, // Ђ
+    { 22, 37, 24, 1, 37, 204, 33272 }, // Ѓ
+    { 24, 29, 26, 1, 28, 174, 33476 }, // Є
+    { 20, 29, 22, 1, 28, 145, 33650 }, // Ѕ
+    { 14, 27, 16, 1, 27, 95, 33795 }, // І
+    { 16, 36, 16, 0, 36, 144, 33890 }, // Ї
+    { 17, 35, 15, -2, 27, 149, 34034 }, // Ј
+    { 37, 28, 38, 0, 27, 259, 34183 }, // Љ
+    { 39, 28, 40, 1, 27, 273, 34442 }, // Њ
+    { 34, 27, 35, 1, 27, 230, 34715 }, // Ћ
+    { 28, 38, 29, 1, 37, 266, 34945 }, // Ќ
+    { 31, 37, 32, 1, 37, 287, 35211 }, // Ѝ
+    { 28, 38, 27, 0, 37, 266, 35498 }, // Ў
+    { 29, 36, 31, 1, 27, 261, 35764 }, // Џ
+    { 30, 28, 29, 0, 28, 210, 207 }, // А
+    { 23, 28, 25, 1, 27, 161, 417 }, // Б
+    { 23, 28, 25, 1, 27, 161, 578 }, // В
+    { 22, 27, 24, 1, 27, 149, 739 }, // Г
+    { 30, 35, 30, 0, 27, 263, 888 }, // Д
+    { 23, 27, 25, 1, 27, 156, 1151 }, // Е
+    { 42, 28, 42, 0, 27, 294, 1307 }, // Ж
+    { 22, 29, 24, 1, 28, 160, 1601 }, // З
+    { 31, 27, 32, 1, 27, 210, 1761 }, // И
+    { 31, 37, 32, 1, 37, 287, 1971 }, // Й
+    { 28, 28, 29, 1, 27, 196, 2258 }, // К
+    { 29, 28, 29, 0, 27, 203, 2454 }, // Л
+    { 36, 27, 36, 0, 27, 243, 2657 }, // М
+    { 31, 27, 33, 1, 27, 210, 2900 }, // Н
+    { 28, 29, 30, 1, 28, 203, 3110 }, // О
+    { 30, 27, 32, 1, 27, 203, 3313 }, // П
+    { 22, 27, 24, 1, 27, 149, 3516 }, // Р
+    { 23, 29, 25, 1, 28, 167, 3665 }, // С
+    { 26, 27, 27, 1, 27, 176, 3832 }, // Т
+    { 28, 28, 27, 0, 27, 196, 4008 }, // У
+    { 29, 29, 31, 1, 28, 211, 4204 }, // Ф
+    { 29, 27, 29, 0, 27, 196, 4415 }, // Х
+    { 30, 35, 32, 1, 27, 263, 4611 }, // Ц
+    { 29, 27, 29, 0, 27, 196, 4874 }, // Ч
+    { 40, 27, 42, 1, 27, 270, 5070 }, // Ш
+    { 41, 35, 43, 1, 27, 359, 5340 }, // Щ
+    { 28, 28, 30, 1, 27, 196, 5699 }, // Ъ
+    { 37, 28, 39, 1, 27, 259, 5895 }, // Ы
+    { 23, 28, 25, 1, 27, 161, 6154 }, // Ь
+    { 24, 29, 26, 1, 28, 174, 6315 }, // Э
+    { 40, 29, 42, 1, 28, 290, 6489 }, // Ю
+    { 26, 28, 27, 0, 27, 182, 6779 }, // Я
+    { 21, 22, 22, 1, 21, 116, 6961 }, // а
+    { 21, 32, 23, 1, 31, 168, 7077 }, // б
+    { 20, 22, 22, 1, 21, 110, 7245 }, // в
+    { 19, 20, 20, 1, 20, 95, 7355 }, // г
+    { 25, 27, 26, 0, 20, 169, 7450 }, // д
+    { 19, 22, 21, 1, 21, 105, 7619 }, // е
+    { 34, 22, 34, 0, 21, 187, 7724 }, // ж
+    { 19, 22, 20, 0, 21, 105, 7911 }, // з
+    { 25, 20, 26, 1, 20, 125, 8016 }, // и
+    { 25, 30, 26, 1, 30, 188, 8141 }, // й
+    { 23, 22, 24, 1, 21, 127, 8329 }, // к
+    { 24, 21, 25, 0, 20, 126, 8456 }, // л
+    { 28, 20, 30, 1, 20, 140, 8582 }, // м
+    { 25, 20, 27, 1, 20, 125, 8722 }, // н
+    { 21, 22, 23, 1, 21, 116, 8847 }, // о
+    { 25, 20, 26, 1, 20, 125, 8963 }, // п
+    { 23, 30, 24, 0, 21, 173, 9088 }, // р
+    { 18, 22, 20, 1, 21, 99, 9261 }, // с
+    { 22, 20, 23, 1, 20, 110, 9360 }, // т
+    { 25, 29, 25, 0, 20, 182, 9470 }, // у
+    { 28, 39, 30, 1, 30, 273, 9652 }, // ф
+    { 24, 20, 24, 0, 20, 120, 9925 }, // х
+    { 25, 27, 27, 1, 20, 169, 10045 }, // ц
+    { 24, 20, 24, 0, 20, 120, 10214 }, // ч
+    { 33, 20, 35, 1, 20, 165, 10334 }, // ш
+    { 34, 27, 35, 1, 20, 230, 10499 }, // щ
+    { 24, 21, 25, 1, 20, 126, 10729 }, // ъ
+    { 31, 21, 33, 1, 20, 163, 10855 }, // ы
+    { 19, 21, 21, 1, 20, 100, 11018 }, // ь
+    { 20, 22, 21, 0, 21, 110, 11118 }, // э
+    { 32, 22, 34, 1, 21, 176, 11228 }, // ю
+    { 22, 21, 23, 0, 20, 116, 11404 }, // я
+    { 19, 33, 21, 1, 32, 157, 36025 }, // ѐ
+    { 19, 30, 21, 1, 29, 143, 11520 }, // ё
+    { 23, 39, 24, 0, 30, 225, 36182 }, // ђ
+    { 19, 32, 20, 1, 32, 152, 36407 }, // ѓ
+    { 19, 22, 20, 1, 21, 105, 36559 }, // є
+    { 17, 22, 19, 1, 21, 94, 36664 }, // ѕ
+    { 13, 30, 13, 0, 30, 98, 36758 }, // і
+    { 14, 29, 13, 0, 29, 102, 36856 }, // ї
+    { 13, 39, 12, -3, 30, 127, 36958 }, // ј
+    { 30, 21, 31, 0, 20, 158, 37085 }, // љ
+    { 32, 21, 33, 1, 20, 168, 37243 }, // њ
+    { 25, 30, 25, 0, 30, 188, 37411 }, // ћ
+    { 23, 33, 24, 1, 32, 190, 37599 }, // ќ
+    { 25, 32, 26, 1, 32, 200, 37789 }, // ѝ
+    { 25, 39, 25, 0, 30, 244, 37989 }, // ў
+    { 24, 28, 26, 1, 20, 168, 38233 }, // џ
+    { 27, 31, 29, 1, 30, 210, 38401 }, // Ѣ
+    { 23, 28, 25, 1, 27, 161, 38611 }, // ѣ
+    { 28, 29, 30, 1, 28, 203, 38772 }, // Ѳ
+    { 21, 22, 23, 1, 21, 116, 38975 }, // ѳ
+    { 30, 29, 30, 0, 28, 218, 39091 }, // Ѵ
+    { 26, 22, 25, 0, 21, 143, 39309 }, // ѵ
+    { 31, 45, 32, 1, 37, 349, 39452 }, // Ҋ
+    { 25, 37, 26, 1, 30, 232, 39801 }, // ҋ
+    { 23, 28, 25, 1, 27, 161, 40033 }, // Ҍ
+    { 20, 28, 21, 0, 27, 140, 40194 }, // ҍ
+    { 22, 27, 24, 1, 27, 149, 40334 }, // Ҏ
+    { 23, 30, 24, 0, 21, 173, 40483 }, // ҏ
+    { 20, 32, 22, 1, 32, 160, 40656 }, // Ґ
+    { 18, 25, 19, 1, 25, 113, 40816 }, // ґ
+    { 22, 27, 24, 1, 27, 149, 40929 }, // Ғ
+    { 20, 20, 20, 0, 20, 100, 41078 }, // ғ
+    { 25, 35, 28, 1, 27, 219, 41178 }, // Ҕ
+    { 22, 29, 24, 1, 20, 160, 41397 }, // ҕ
+    { 42, 35, 42, 0, 27, 368, 41557 }, // Җ
+    { 34, 28, 34, 0, 21, 238, 41925 }, // җ
+    { 22, 37, 24, 1, 28, 204, 42163 }, // Ҙ
+    { 19, 29, 20, 0, 21, 138, 0 }, // ҙ
+    { 28, 35, 29, 1, 27, 245, 138 }, // Қ
+    { 23, 28, 24, 1, 21, 161, 383 }, // қ
+    { 30, 28, 31, 1, 27, 210, 544 }, // Ҝ
+    { 24, 22, 25, 1, 21, 132, 754 }, // ҝ
+    { 28, 28, 29, 1, 27, 196, 886 }, // Ҟ
+    { 24, 28, 24, 0, 27, 168, 1082 }, // ҟ
+    { 32, 28, 33, 1, 27, 224, 1250 }, // Ҡ
+    { 28, 22, 29, 1, 21, 154, 1474 }, // ҡ
+    { 32, 35, 33, 1, 27, 280, 1628 }, // Ң
+    { 26, 27, 27, 1, 20, 176, 1908 }, // ң
+    { 36, 27, 38, 1, 27, 243, 2084 }, // Ҥ
+    { 30, 20, 31, 1, 20, 150, 2327 }, // ҥ
+    { 40, 35, 42, 1, 27, 350, 2477 }, // Ҧ
+    { 34, 29, 36, 1, 20, 247, 2827 }, // ҧ
+    { 31, 29, 32, 1, 28, 225, 3074 }, // Ҩ
+    { 25, 22, 27, 1, 21, 138, 3299 }, // ҩ
+    { 23, 37, 25, 1, 28, 213, 3437 }, // Ҫ
+    { 18, 29, 20, 1, 21, 131, 3650 }, // ҫ
+    { 26, 35, 27, 1, 27, 228, 3781 }, // Ҭ
+    { 22, 27, 23, 1, 20, 149, 4009 }, // ҭ
+    { 27, 27, 27, 0, 27, 183, 4158 }, // Ү
+    { 25, 29, 25, 0, 20, 182, 4341 }, // ү
+    { 27, 27, 27, 0, 27, 183, 4523 }, // Ұ
+    { 25, 29, 25, 0, 20, 182, 4706 }, // ұ
+    { 30, 35, 30, 0, 27, 263, 4888 }, // Ҳ
+    { 24, 27, 24, 0, 20, 162, 5151 }, // ҳ
+    { 34, 35, 35, 1, 27, 298, 5313 }, // Ҵ
+    { 29, 27, 31, 1, 20, 196, 5611 }, // ҵ
+    { 30, 35, 30, 0, 27, 263, 5807 }, // Ҷ
+    { 25, 27, 25, 0, 20, 169, 6070 }, // ҷ
+    { 29, 27, 29, 0, 27, 196, 6239 }, // Ҹ
+    { 24, 20, 25, 0, 20, 120, 6435 }, // ҹ
+    { 28, 27, 30, 1, 27, 189, 6555 }, // Һ
+    { 25, 30, 25, 0, 30, 188, 6744 }, // һ
+    { 31, 29, 32, 0, 28, 225, 6932 }, // Ҽ
+    { 25, 22, 25, 0, 21, 138, 7157 }, // ҽ
+    { 31, 36, 32, 0, 28, 279, 7295 }, // Ҿ
+    { 25, 29, 25, 0, 21, 182, 7574 }, // ҿ
+    { 14, 27, 16, 1, 27, 95, 7756 }, // Ӏ
+    { 42, 38, 42, 0, 37, 399, 7851 }, // Ӂ
+    { 34, 31, 34, 0, 30, 264, 8250 }, // ӂ
+    { 26, 35, 28, 1, 27, 228, 8514 }, // Ӄ
+    { 22, 30, 24, 1, 21, 165, 8742 }, // ӄ
+    { 29, 35, 29, 0, 27, 254, 8907 }, // Ӆ
+    { 24, 27, 25, 0, 20, 162, 9161 }, // ӆ
+    { 31, 35, 32, 1, 27, 272, 9323 }, // Ӈ
+    { 25, 29, 26, 1, 20, 182, 9595 }, // ӈ
+    { 31, 35, 33, 1, 27, 272, 9777 }, // Ӊ
+    { 26, 27, 27, 1, 20, 176, 10049 }, // ӊ
+    { 29, 35, 29, 0, 27, 254, 10225 }, // Ӌ
+    { 24, 27, 24, 0, 20, 162, 10479 }, // ӌ
+    { 36, 35, 37, 0, 27, 315, 10641 }, // Ӎ
+    { 29, 27, 30, 1, 20, 196, 10956 }, // ӎ
+    { 14, 29, 16, 1, 29, 102, 11152 }, // ӏ
+    { 30, 37, 29, 0, 37, 278, 11254 }, // Ӑ
+    { 21, 31, 22, 1, 30, 163, 11532 }, // ӑ
+    { 30, 36, 29, 0, 36, 270, 11695 }, // Ӓ
+    { 21, 30, 22, 1, 29, 158, 11965 }, // ӓ
+    { 37, 27, 37, -1, 27, 250, 12123 }, // Ӕ
+    { 30, 22, 32, 1, 21, 165, 12373 }, // ӕ
+    { 23, 37, 25, 1, 37, 213, 12538 }, // Ӗ
+    { 19, 31, 21, 1, 30, 148, 12751 }, // ӗ
+    { 24, 29, 27, 1, 28, 174, 12899 }, // Ә
+    { 19, 22, 21, 1, 21, 105, 13073 }, // ә
+    { 24, 37, 27, 1, 36, 222, 13178 }, // Ӛ
+    { 19, 30, 21, 1, 29, 143, 13400 }, // ӛ
+    { 42, 37, 42, 0, 36, 389, 13543 }, // Ӝ
+    { 34, 30, 34, 0, 29, 255, 13932 }, // ӝ
+    { 22, 37, 24, 1, 36, 204, 14187 }, // Ӟ
+    { 19, 30, 20, 0, 29, 143, 14391 }, // ӟ
+    { 20, 28, 22, 1, 27, 140, 14534 }, // Ӡ
+    { 20, 29, 21, 0, 20, 145, 14674 }, // ӡ
+    { 31, 35, 32, 1, 35, 272, 14819 }, // Ӣ
+    { 25, 28, 26, 1, 28, 175, 15091 }, // ӣ
+    { 31, 36, 32, 1, 36, 279, 15266 }, // Ӥ
+    { 25, 29, 26, 1, 29, 182, 15545 }, // ӥ
+    { 28, 37, 30, 1, 36, 259, 15727 }, // Ӧ
+    { 21, 30, 23, 1, 29, 158, 15986 }, // ӧ
+    { 28, 29, 30, 1, 28, 203, 16144 }, // Ө
+    { 21, 22, 23, 1, 21, 116, 16347 }, // ө
+    { 28, 37, 30, 1, 36, 259, 16463 }, // Ӫ
+    { 21, 30, 23, 1, 29, 158, 16722 }, // ӫ
+    { 24, 37, 26, 1, 36, 222, 16880 }, // Ӭ
+    { 20, 30, 21, 0, 29, 150, 17102 }, // ӭ
+    { 28, 36, 27, 0, 35, 252, 17252 }, // Ӯ
+    { 25, 37, 25, 0, 28, 232, 17504 }, // ӯ
+    { 28, 37, 27, 0, 36, 259, 17736 }, // Ӱ
+    { 25, 38, 25, 0, 29, 238, 17995 }, // ӱ
+    { 28, 39, 27, 0, 38, 273, 18233 }, // Ӳ
+    { 25, 41, 25, 0, 32, 257, 18506 }, // ӳ
+    { 29, 36, 29, 0, 36, 261, 18763 }, // Ӵ
+    { 24, 29, 24, 0, 29, 174, 19024 }, // ӵ
+    { 22, 35, 24, 1, 27, 193, 19198 }, // Ӷ
+    { 19, 27, 20, 1, 20, 129, 19391 }, // ӷ
+    { 37, 37, 39, 1, 36, 343, 19520 }, // Ӹ
+    { 31, 30, 33, 1, 29, 233, 19863 }, // ӹ
+    { 22, 35, 24, 1, 27, 193, 20096 }, // Ӻ
+    { 20, 28, 20, 0, 20, 140, 20289 }, // ӻ
+    { 28, 35, 29, 0, 27, 245, 20429 }, // Ӽ
+    { 23, 29, 23, 0, 20, 167, 20674 }, // ӽ
+    { 29, 27, 29, 0, 27, 196, 20841 }, // Ӿ
+    { 24, 20, 24, 0, 20, 120, 21037 }, // ӿ
+    { 0, 0, 19, 0, 0, 0, 21157 }, //  
+    { 0, 0, 38, 0, 0, 0, 21157 }, //  
+    { 0, 0, 19, 0, 0, 0, 21157 }, //  
+    { 0, 0, 38, 0, 0, 0, 21157 }, //  
+    { 0, 0, 13, 0, 0, 0, 21157 }, //  
+    { 0, 0, 10, 0, 0, 0, 21157 }, //  
+    { 0, 0, 6, 0, 0, 0, 21157 }, //  
+    { 0, 0, 24, 0, 0, 0, 21157 }, //  
+    { 0, 0, 11, 0, 0, 0, 21157 }, //  
+    { 0, 0, 8, 0, 0, 0, 21157 }, //  
+    { 0, 0, 2, 0, 0, 0, 21157 }, //  
+    { 0, 0, 0, 0, 0, 0, 21157 }, // ​
+    { 2, 31, 0, -1, 22, 16, 21157 }, // ‌
+    { 8, 34, 0, -4, 25, 68, 21173 }, // ‍
+    { 14, 36, 0, -7, 27, 126, 21241 }, // ‎
+    { 14, 36, 0, -7, 27, 126, 21367 }, // ‏
+    { 13, 5, 14, 1, 12, 17, 21493 }, // ‐
+    { 13, 5, 14, 1, 12, 17, 21510 }, // ‑
+    { 19, 5, 24, 2, 15, 24, 21527 }, // ‒
+    { 19, 5, 19, 0, 12, 24, 22218 }, // –
+    { 38, 5, 38, 0, 12, 48, 22242 }, // —
+    { 38, 5, 38, 0, 12, 48, 21551 }, // ―
+    { 13, 39, 19, 3, 30, 127, 21599 }, // ‖
+    { 19, 11, 19, 0, -1, 53, 21726 }, // ‗
+    { 8, 13, 9, 1, 29, 26, 22290 }, // ‘
+    { 7, 13, 9, 1, 29, 23, 22316 }, // ’
+    { 7, 12, 9, 1, 5, 21, 21779 }, // ‚
+    { 8, 13, 9, 1, 29, 26, 21800 }, // ‛
+    { 15, 13, 17, 1, 29, 49, 22339 }, // “
+    { 15, 13, 17, 1, 29, 49, 22388 }, // ”
+    { 15, 12, 17, 1, 5, 45, 21826 }, // „
+    { 15, 13, 17, 1, 29, 49, 21871 }, // ‟
+    { 17, 25, 19, 1, 27, 107, 21920 }, // †
+    { 17, 29, 19, 1, 27, 124, 22027 }, // ‡
+    { 9, 10, 11, 1, 15, 23, 22151 }, // •
+    { 14, 14, 24, 5, 20, 49, 22174 }, // ‣
+    { 7, 7, 11, 2, 6, 13, 22223 }, // ․
+    { 17, 7, 19, 1, 6, 30, 22236 }, // ‥
+    { 34, 7, 38, 2, 6, 60, 22437 }, // …
+    { 7, 7, 11, 2, 14, 13, 22266 }, // ‧
+    { 0, 0, 0, 0, 0, 0, 22279 }, //  
+    { 0, 0, 0, 0, 0, 0, 22279 }, //  
+    { 14, 36, 0, -7, 27, 126, 22279 }, // ‪
+    { 14, 36, 0, -7, 27, 126, 22405 }, // ‫
+    { 12, 35, 0, -6, 26, 105, 22531 }, // ‬
+    { 16, 36, 0, -8, 27, 144, 22636 }, // ‭
+    { 16, 36, 0, -8, 27, 144, 22780 }, // ‮
+    { 0, 0, 4, 0, 0, 0, 22924 }, //  
+    { 51, 30, 53, 1, 28, 383, 22924 }, // ‰
+    { 9, 13, 10, 1, 27, 30, 23307 }, // ′
+    { 17, 13, 19, 1, 27, 56, 23337 }, // ″
+    { 25, 13, 27, 1, 27, 82, 23393 }, // ‴
+    { 10, 13, 10, 0, 27, 33, 23475 }, // ‵
+    { 17, 13, 19, 1, 27, 56, 23508 }, // ‶
+    { 26, 13, 28, 1, 27, 85, 23564 }, // ‷
+    { 17, 8, 19, 1, 0, 34, 23649 }, // ‸
+    { 11, 15, 13, 1, 17, 42, 23683 }, // ‹
+    { 11, 15, 13, 1, 17, 42, 23725 }, // ›
+    { 24, 26, 24, 0, 25, 156, 23767 }, // ※
+    { 19, 30, 22, 2, 29, 143, 23923 }, // ‼
+    { 19, 4, 19, 0, 32, 19, 24066 }, // ‾
+    { 10, 5, 11, 1, 12, 13, 24085 }, // ⁃
+    { 21, 31, 7, -7, 28, 163, 24098 }, // ⁄
+    { 32, 29, 36, 2, 28, 232, 24261 }, // ⁇
+    { 26, 30, 29, 2, 29, 195, 24493 }, // ⁈
+    { 26, 30, 29, 2, 29, 195, 24688 }, // ⁉
+    { 23, 8, 38, 7, 15, 46, 24883 }, // ⁓
+    { 34, 13, 35, 1, 27, 111, 24929 }, // ⁗
+    { 0, 0, 8, 0, 0, 0, 25040 }, //  
+    { 0, 0, 0, 0, 0, 0, 25040 }, // ⁠
+    { 0, 0, 0, 0, 0, 0, 25040 }, // ⁡
+    { 0, 0, 0, 0, 0, 0, 25040 }, // ⁢
+    { 0, 0, 0, 0, 0, 0, 25040 }, // ⁣
+    { 0, 0, 0, 0, 0, 0, 25040 }, // ⁤
+    { 17, 19, 17, 0, 32, 81, 25040 }, // ⁰
+    { 17, 19, 17, 0, 32, 81, 25121 }, // ⁴
+    { 13, 18, 17, 2, 31, 59, 25202 }, // ⁵
+    { 15, 19, 17, 1, 32, 72, 25261 }, // ⁶
+    { 14, 18, 17, 2, 31, 63, 25333 }, // ⁷
+    { 15, 19, 17, 1, 32, 72, 25396 }, // ⁸
+    { 15, 19, 17, 1, 32, 72, 25468 }, // ⁹
+    { 17, 14, 21, 2, 27, 60, 25540 }, // ⁿ
+    { 17, 19, 17, 0, 13, 81, 25600 }, // ₀
+    { 13, 18, 17, 2, 13, 59, 25681 }, // ₁
+    { 15, 18, 17, 1, 13, 68, 25740 }, // ₂
+    { 13, 19, 17, 2, 13, 62, 25808 }, // ₃
+    { 17, 19, 17, 0, 13, 81, 25870 }, // ₄
+    { 13, 18, 17, 2, 12, 59, 25951 }, // ₅
+    { 15, 19, 17, 1, 13, 72, 26010 }, // ₆
+    { 14, 18, 17, 2, 12, 63, 26082 }, // ₇
+    { 15, 19, 17, 1, 13, 72, 26145 }, // ₈
+    { 15, 19, 17, 1, 13, 72, 26217 }, // ₉
+    { 22, 26, 24, 1, 26, 143, 26289 }, // ₣
+    { 22, 28, 24, 1, 27, 154, 26432 }, // ₤
+    { 50, 28, 52, 1, 27, 350, 26586 }, // ₧
+    { 24, 28, 24, 0, 27, 168, 26936 }, // €
+    { 24, 18, 38, 7, 22, 108, 27104 }, // ←
+    { 18, 25, 38, 10, 26, 113, 27212 }, // ↑
+    { 24, 18, 38, 7, 22, 108, 27325 }, // →
+    { 18, 25, 38, 10, 26, 113, 27433 }, // ↓
+    { 24, 17, 38, 7, 22, 102, 27546 }, // ↔
+    { 16, 26, 38, 11, 26, 104, 27648 }, // ↕
+    { 18, 27, 38, 10, 27, 122, 27752 }, // ↨
+    { 18, 26, 38, 10, 26, 117, 27874 }, // ↲
+    { 18, 26, 38, 10, 26, 117, 27991 }, // ↳
+    { 22, 20, 38, 8, 23, 110, 28108 }, // ↵
+    { 24, 22, 38, 7, 24, 132, 28218 }, // ⇐
+    { 22, 24, 38, 8, 25, 132, 28350 }, // ⇑
+    { 24, 22, 38, 7, 24, 132, 28482 }, // ⇒
+    { 22, 24, 38, 8, 25, 132, 28614 }, // ⇓
+    { 24, 20, 38, 7, 23, 120, 28746 }, // ⇔
+    { 26, 28, 38, 6, 27, 182, 28866 }, // ∀
+    { 20, 31, 24, 2, 30, 155, 29048 }, // ∂
+    { 20, 27, 38, 9, 27, 135, 29203 }, // ∃
+    { 30, 30, 38, 4, 28, 225, 29338 }, // ∅
+    { 25, 28, 26, 0, 28, 175, 29563 }, // ∆
+    { 26, 28, 38, 6, 27, 182, 29738 }, // ∇
+    { 26, 27, 38, 6, 27, 176, 29920 }, // ∈
+    { 26, 34, 38, 6, 30, 221, 30096 }, // ∉
+    { 26, 23, 38, 6, 25, 150, 30317 }, // ∊
+    { 26, 27, 38, 6, 27, 176, 30467 }, // ∋
+    { 26, 34, 38, 6, 30, 221, 30643 }, // ∌
+    { 26, 23, 38, 6, 25, 150, 30864 }, // ∍
+    { 30, 33, 32, 1, 27, 248, 31014 }, // ∏
+    { 24, 34, 25, 1, 27, 204, 31262 }, // ∑
+    { 18, 4, 24, 3, 15, 18, 31466 }, // −
+    { 18, 30, 20, 1, 28, 135, 31484 }, // ∕
+    { 18, 30, 20, 1, 28, 135, 31619 }, // ∖
+    { 18, 18, 24, 3, 22, 81, 31754 }, // ∗
+    { 14, 14, 24, 5, 20, 49, 31835 }, // ∘
+    { 8, 7, 24, 8, 14, 14, 31884 }, // ∙
+    { 25, 36, 24, -1, 31, 225, 31898 }, // √
+    { 19, 16, 24, 2, 20, 76, 32123 }, // ∝
+    { 24, 14, 24, 0, 19, 84, 32199 }, // ∞
+    { 24, 27, 38, 7, 27, 162, 32283 }, // ∟
+    { 28, 27, 38, 5, 27, 189, 32445 }, // ∠
+    { 5, 39, 19, 7, 30, 49, 32634 }, // ∣
+    { 13, 39, 19, 3, 30, 127, 32683 }, // ∥
+    { 26, 27, 38, 6, 27, 176, 32810 }, // ∧
+    { 26, 27, 38, 6, 27, 176, 32986 }, // ∨
+    { 22, 28, 38, 8, 28, 154, 33162 }, // ∩
+    { 22, 28, 38, 8, 27, 154, 33316 }, // ∪
+    { 22, 39, 24, 1, 30, 215, 33470 }, // ∫
+    { 26, 22, 38, 6, 21, 143, 33685 }, // ∴
+    { 26, 22, 38, 6, 21, 143, 33828 }, // ∵
+    { 8, 22, 12, 2, 24, 44, 33971 }, // ∶
+    { 26, 22, 38, 6, 21, 143, 34015 }, // ∷
+    { 23, 8, 38, 7, 15, 46, 34158 }, // ∼
+    { 23, 22, 38, 7, 24, 127, 34204 }, // ≅
+    { 19, 16, 24, 2, 21, 76, 34331 }, // ≈
+    { 22, 15, 38, 8, 18, 83, 34407 }, // ≍
+    { 18, 19, 24, 3, 22, 86, 34490 }, // ≠
+    { 22, 19, 38, 8, 21, 105, 34576 }, // ≡
+    { 18, 23, 24, 3, 23, 104, 34681 }, // ≤
+    { 18, 24, 24, 3, 24, 108, 34785 }, // ≥
+    { 32, 18, 38, 3, 22, 144, 34893 }, // ≪
+    { 32, 18, 38, 3, 22, 144, 35037 }, // ≫
+    { 26, 23, 38, 6, 25, 150, 35181 }, // ⊃
+    { 26, 34, 38, 6, 30, 221, 35331 }, // ⊄
+    { 26, 34, 38, 6, 30, 221, 35552 }, // ⊅
+    { 26, 27, 38, 6, 27, 176, 35773 }, // ⊆
+    { 26, 27, 38, 6, 27, 176, 35949 }, // ⊇
+    { 28, 28, 38, 5, 27, 196, 36125 }, // ⊕
+    { 28, 28, 38, 5, 27, 196, 36321 }, // ⊖
+    { 28, 28, 38, 5, 27, 196, 36517 }, // ⊗
+    { 28, 28, 38, 5, 27, 196, 36713 }, // ⊘
+    { 22, 27, 38, 8, 27, 149, 36909 }, // ⊥
+    { 8, 7, 24, 8, 14, 14, 37058 }, // ⋅
+    { 34, 7, 38, 2, 14, 60, 37072 }, // ⋯
+    { 33, 30, 29, 0, 30, 248, 37132 }, // ﬀ
+    { 26, 30, 27, 0, 30, 195, 37380 }, // ﬁ
+    { 26, 30, 27, 0, 30, 195, 37575 }, // ﬂ
+    { 39, 30, 40, 0, 30, 293, 37770 }, // ﬃ
+    { 39, 30, 40, 0, 30, 293, 38063 }, // ﬄ
+    { 30, 31, 30, 0, 30, 233, 38356 }, // ﬅ
+    { 34, 31, 35, 1, 30, 264, 38589 }, // ﬆ
+    { 36, 36, 38, 1, 32, 324, 38853 }, // �
 };
 
 static const EpdUnicodeInterval bookerly_18_boldIntervals[] = {
@@ -3354,32 +3478,336 @@ static const EpdUnicodeInterval bookerly_18_boldIntervals[] = {
     { 0x22A5, 0x22A5, 0x2E7 },
     { 0x22C5, 0x22C5, 0x2E8 },
     { 0x22EF, 0x22EF, 0x2E9 },
-    { 0xFFFD, 0xFFFD, 0x2EA },
+    { 0xFB00, 0xFB06, 0x2EA },
+    { 0xFFFD, 0xFFFD, 0x2F1 },
 };
 
 static const EpdFontGroup bookerly_18_boldGroups[] = {
-    { 0, 5775, 12924, 100, 0 },
-    { 5775, 5814, 15941, 96, 100 },
-    { 11589, 7935, 25361, 128, 196 },
-    { 19524, 558, 788, 33, 324 },
-    { 20082, 13336, 42391, 220, 357 },
-    { 33418, 1883, 4162, 74, 577 },
-    { 35301, 662, 1249, 18, 651 },
-    { 35963, 438, 815, 4, 669 },
-    { 36401, 801, 1762, 15, 673 },
-    { 37202, 3078, 8266, 58, 688 },
-    { 40280, 179, 324, 1, 746 },
+    { 0, 8146, 22497, 151, 5 },
+    { 8146, 4863, 11663, 66, 358 },
+    { 13009, 14383, 42367, 264, 0 },
+    { 27392, 14931, 39177, 273, 474 },
+};
+
+static const uint8_t bookerly_18_boldGlyphGroups[754] = {
+    2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0,
+    2, 2, 2, 2, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0,
+    0, 2, 2, 2, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0,
+    0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 3, 3, 3, 0, 0, 3, 3, 0, 0, 3,
+    3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+};
+
+static const uint8_t bookerly_18_boldKernLeftClasses[754] = {
+    0, 0, 0, 0, 0, 0, 0, 86, 0, 0, 0, 0, 86, 75, 0, 73,
+    0, 5, 22, 5, 28, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 123,
+    123, 0, 0, 0, 0, 135, 3, 95, 37, 14, 110, 65, 89, 30, 30, 34,
+    61, 39, 114, 16, 14, 63, 72, 33, 52, 12, 2, 8, 8, 82, 4, 111,
+    84, 62, 0, 0, 0, 0, 27, 18, 77, 131, 46, 25, 40, 26, 76, 122,
+    56, 78, 26, 26, 18, 18, 106, 29, 48, 94, 43, 10, 10, 112, 10, 130,
+    80, 0, 0, 0, 0, 108, 0, 0, 0, 0, 0, 0, 0, 0, 0, 81,
+    0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64,
+    0, 0, 0, 54, 3, 3, 3, 3, 3, 3, 110, 37, 110, 110, 110, 110,
+    30, 30, 30, 30, 14, 16, 14, 14, 14, 14, 14, 0, 90, 2, 2, 2,
+    2, 4, 58, 98, 27, 27, 27, 27, 27, 27, 46, 77, 46, 46, 46, 46,
+    76, 76, 36, 36, 18, 26, 18, 18, 18, 18, 18, 0, 18, 43, 43, 43,
+    43, 10, 18, 10, 3, 27, 3, 27, 57, 83, 37, 77, 37, 77, 37, 77,
+    37, 77, 14, 32, 14, 133, 110, 46, 110, 46, 110, 46, 136, 115, 110, 46,
+    89, 40, 89, 40, 89, 40, 89, 40, 30, 26, 30, 26, 30, 36, 30, 36,
+    30, 36, 30, 104, 30, 76, 34, 122, 34, 109, 61, 56, 56, 39, 78, 39,
+    78, 0, 32, 0, 0, 39, 91, 16, 26, 16, 26, 16, 26, 26, 16, 26,
+    14, 18, 14, 18, 14, 18, 110, 46, 33, 29, 33, 29, 33, 29, 52, 48,
+    52, 48, 52, 48, 52, 48, 12, 129, 12, 140, 12, 94, 2, 43, 2, 43,
+    2, 43, 2, 43, 2, 43, 2, 102, 8, 10, 4, 10, 4, 111, 130, 111,
+    130, 111, 130, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 118, 118, 79, 0, 138, 97, 15, 15, 49, 19, 19,
+    60, 9, 15, 1, 15, 21, 121, 51, 13, 24, 118, 9, 51, 15, 15, 9,
+    15, 99, 15, 7, 15, 38, 101, 13, 1, 69, 59, 24, 15, 15, 24, 19,
+    15, 19, 7, 7, 15, 53, 11, 127, 35, 55, 66, 42, 74, 93, 93, 42,
+    93, 93, 93, 11, 93, 11, 124, 35, 20, 11, 85, 55, 93, 93, 55, 31,
+    93, 31, 11, 11, 93, 66, 66, 88, 35, 110, 119, 125, 116, 0, 31, 31,
+    70, 42, 93, 20, 93, 103, 117, 7, 11, 44, 87, 24, 55, 19, 31, 38,
+    11, 45, 100, 41, 35, 0, 0, 50, 92, 51, 74, 50, 92, 9, 42, 9,
+    42, 9, 42, 24, 55, 0, 0, 0, 0, 107, 120, 101, 124, 13, 35, 23,
+    20, 23, 20, 67, 113, 24, 55, 24, 55, 15, 93, 68, 70, 128, 66, 128,
+    66, 15, 9, 42, 137, 134, 24, 55, 49, 96, 24, 55, 15, 93, 24, 55,
+    126, 21, 53, 21, 53, 118, 66, 118, 66, 7, 11, 7, 11, 9, 42, 51,
+    74, 139, 132, 15, 93, 15, 93, 7, 11, 7, 11, 7, 11, 7, 11, 1,
+    20, 1, 20, 1, 20, 15, 93, 13, 35, 15, 93, 41, 35, 71, 105, 59,
+    85, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 22, 22, 0, 22, 22, 22, 0, 0, 6, 17, 47, 6, 6, 17, 5,
+    6, 0, 0, 0, 0, 0, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 81, 64, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 25, 76, 78, 76, 78, 94,
+    94, 0,
+};
+
+static const uint8_t bookerly_18_boldKernRightClasses[754] = {
+    0, 0, 0, 0, 0, 0, 0, 81, 0, 0, 0, 0, 81, 0, 85, 48,
+    0, 39, 11, 5, 41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 107,
+    106, 0, 0, 0, 33, 0, 4, 7, 2, 7, 7, 7, 2, 7, 7, 79,
+    7, 7, 101, 7, 2, 7, 2, 7, 60, 34, 16, 28, 28, 98, 21, 96,
+    0, 31, 110, 0, 0, 0, 20, 88, 1, 1, 1, 59, 22, 30, 100, 92,
+    30, 30, 51, 51, 1, 99, 1, 51, 37, 45, 25, 18, 18, 80, 9, 70,
+    0, 0, 104, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49,
+    0, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 78,
+    0, 0, 0, 111, 4, 4, 4, 4, 4, 4, 50, 2, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 2, 2, 2, 2, 2, 0, 71, 16, 16, 16,
+    16, 21, 7, 95, 20, 20, 20, 76, 73, 20, 20, 1, 1, 1, 1, 65,
+    113, 100, 74, 36, 1, 51, 1, 1, 1, 1, 17, 0, 68, 25, 25, 25,
+    25, 9, 94, 9, 4, 55, 4, 55, 4, 20, 2, 1, 2, 17, 2, 1,
+    2, 17, 7, 1, 7, 1, 7, 67, 7, 17, 7, 1, 7, 1, 7, 17,
+    2, 22, 2, 61, 2, 22, 2, 22, 7, 30, 7, 93, 7, 36, 7, 36,
+    7, 36, 7, 100, 7, 100, 7, 100, 79, 66, 7, 30, 51, 7, 30, 7,
+    30, 7, 30, 7, 30, 7, 83, 7, 51, 7, 51, 7, 51, 51, 7, 51,
+    2, 1, 2, 17, 2, 1, 2, 1, 7, 51, 7, 51, 7, 109, 60, 37,
+    60, 77, 60, 37, 60, 75, 34, 45, 34, 45, 34, 45, 16, 25, 16, 25,
+    16, 25, 16, 25, 16, 25, 16, 25, 28, 18, 21, 9, 21, 96, 70, 96,
+    70, 96, 97, 95, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 15, 15, 14, 15, 8, 108, 15, 15, 91, 46, 15,
+    14, 15, 15, 35, 15, 27, 15, 15, 15, 64, 15, 42, 72, 15, 15, 15,
+    46, 105, 15, 8, 15, 15, 8, 14, 35, 58, 56, 15, 26, 15, 15, 14,
+    15, 15, 117, 15, 86, 40, 103, 10, 10, 57, 3, 47, 63, 10, 10, 10,
+    32, 10, 10, 3, 10, 89, 3, 12, 19, 3, 43, 10, 13, 10, 10, 12,
+    10, 10, 102, 10, 52, 3, 3, 69, 10, 3, 87, 115, 90, 82, 32, 10,
+    69, 10, 10, 24, 10, 14, 12, 8, 3, 62, 19, 15, 10, 118, 116, 15,
+    89, 15, 10, 15, 10, 15, 10, 42, 47, 72, 63, 15, 10, 15, 10, 0,
+    0, 14, 12, 15, 10, 15, 10, 15, 10, 8, 3, 8, 3, 14, 12, 44,
+    19, 44, 19, 56, 43, 0, 12, 26, 13, 26, 13, 15, 69, 38, 29, 38,
+    29, 15, 42, 47, 15, 10, 46, 32, 15, 10, 15, 10, 26, 13, 0, 10,
+    69, 27, 40, 27, 40, 53, 40, 15, 3, 112, 84, 0, 84, 42, 47, 72,
+    63, 0, 114, 15, 10, 15, 10, 8, 3, 8, 3, 8, 3, 0, 63, 35,
+    24, 35, 54, 35, 24, 0, 13, 15, 10, 15, 10, 15, 10, 56, 43, 56,
+    43, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 11, 11, 0, 11, 11, 11, 0, 0, 6, 23, 5, 6, 6, 23, 5,
+    6, 0, 0, 0, 0, 0, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 78, 0, 0, 0, 0, 0,
+    33, 33, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 59, 59, 59, 59, 59, 59,
+    37, 0,
+};
+
+static const int8_t bookerly_18_boldKernMatrix[16779] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -4, 0, -5, 0, 0, -3, 0, -3, -2, -2, -2, 0, 0, 0, 0, 0, -2, 0, 0, 0, 1, -2, 0, 0, -6, 0, -4, 0, 0, -4, 0, 0, 1, 0, 0, -1, -5, -4, -4, -1, -2, 2, 0, -3, -3, 0, -3, 0, 0, -6, -6, -2, 0, 0, -4, -3, 0, 0, 0, 1, -3, -4, 0, 0, 0, 0, 1, 0, 0, -2, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -3, 0, -3, -3, 0, -1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, -2, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, 1, -1, 0,
+    0, -1, -1, 0, -2, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, 0, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -2, 0, 0, 0, -1, 1, -1, -1, 0, -1, -1, 0, -1, 1, -1, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 1, 0, -4, 0, 0, -3, 0, -1, 0, 0, 0, 0, -2, 0, -3, 0, 0, -4, 0, -3, 0, -1, 0, 0, -4, 0, 0, -4, 0, -2, -4, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, -1, 0, 0, -3, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -3, -2, 0, -4, -3, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, -3, -1, 0, -3, 1, -4, 1, 0, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 2, -3, 0, -3, 0, -4, 0, 0, 0, 0, 0, 0, 1, -2, -4, -2, 0, 0, 0, -1, 0, 0, 0, -1, -2, -4, 0, 0, 0, -3, 2, -3, -3, 0, -2, -2, 0, -2, 2, -3, -3, -3, -2, 0, -2, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 1, 0, 0, -2, 0, -2, 0, -1, 0, 0, 1, 0, -1, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -2, -1, 1, 0, -3, 0, -2, -3, 0, 0, -2, -3, -3, 0, -2, -1, -3, -3, 0, -3, 0, -2, -3, -1, -4, 1, -5, -2, 0, 0, 0, 0, -3, -2, 0, 0, -3, 0, 0, 0, 0, 1, -3, -1, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, -1, 0, 0, 0, -5, 0, 0, -1, -1, -1, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, -1, -3, -3, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 0, -1, 2, 2, 0, 1, -2, 0, 2, 0, 0, -3, 1, 0, 1, 0, -2, 0, 2, 1, 1, -1, 0, -3, 0, 0, 0, 2, 1, 0, -2, 0, 0, 0, -4, 0, -2, -4, 2, 0, 0, -1, 0, 0, 0, -2, 1, 0, -2, -1, 1, -1, -1, 1, 0, 0, 0, 0, 1, -1, 0, -1, 0, 0, 2, 0, 0, 1, 0, 0, -1, -1, 1, 0, 1, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, -2, 0, 0, -1, 0, 0, 0, -2, 0, -2, -2, 0, -1, 0, -1, 0, 0, 0, 0, 0, -2, -3, 0, 0, -1, -2, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -3, -2, 0, -5, -5, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, -3, -1, 0, -3, 1, -3, 1, 0, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 2, -3, 0, -5, 0, -5, 0, 0, 0, 0, 0, 0, 1, -2, -5, -1, 0, 0, 0, -2, 0, 0, 0, -1, -1, -2, 0, 0, 0, -3, 2, -3, -3, 0, -1, -2, 0, -2, 2, -3, -2, -3, -1, 0, -1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 1, 0, 0, -1, 0, -1, 0, -1, 0, 0, 1, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, -1, 0, -2, 0, 0, -1, -2, -2, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, -2, 0, -2, 1, 0, -3, 0, 0, 0, 0, 0, -1, 0, 0, -3, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, -2, 0, 0, 0, -3, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, 0, -3, 2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -2, 2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, -3, 0, -2, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 1, 0, -2, 0, 0, 0, -1, 2, -1, -1, 0, 0, 0, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 1, -1, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -2, -1, -1, 0, 0, 0, 0, 0, -1, 0, -2, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, -1, 0, -4, -4, 1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -2, 0, 0, -2, 0, -2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -3, 0, -4, 0, -5, 0, 0, 0, 0, 0, 0, 0, -1, -4, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, -2, 0, 0, 0, -2, 0, -2, -2, 0, -1, -1, 0, -2, 1, -3, -2, -3, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, -4, 1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, -4, 0, -3, 0, 0, -3, 0, 0, 0, 0, 0, -1, -4, -2, -5, -1, 0, 0, 0, -3, 0, 0, -1, 0, 0, -3, -4, 0, 0, 0, -3, -1, 0, 0, 0, 0, -1, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, -2, -3, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2, 0, 0, 0, 1, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -1, 0, -1, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, -1, 1, -1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 2, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 2, -1, -1, 0, 0, -1, 0, -1, 2, -1, -1, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -3, -2, -3, -4, -3, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, -2, 1, -3, 0, 0, 0, 0, -4, 1, -1, 1, 0, -3, 0, 0, 0, 1, -3, 0, -3, -2, 0, -1, 0, 1, 0, -3, 0, 0, 0, -6, 0, -3, -6, 0, -2, 0, -3, 0, 0, -1, -3, 1, 0, -3, -3, 1, -3, -3, 1, -1, -2, 0, -2, 1, -3, -2, -3, 0, 0, 0, 0, 0, 1, 0, 0, -2, -3, 1, 0, 1, 0, 0, 1, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, -2, 0, 0, 0, 0, 1, -1, -1, -3, 0, 0, 0, 0, -2, 0, 0, 0, -1, -2, 0, -4, 0, 0, 0, 0, -2, 0, 0, 0, -3, 0, 0, -1, 0, 1, 0, -1, -1, -3, 0, 0, -1, -2, 0, 0, 0, -1, 0, -2, 0, 0, -1, 0, 0, 0, 0, -3, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, -3, 2, 0, 0, 0, 0, -1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -3, -1, -2, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -4, 0, -1, 0, 0, -1, -2, -3, -4, 0, 0, 0, 0, -2, 0, 0, 0, -3, -2, 0, -5, 1, 0, -2, 0, -4, 1, -2, 0, -2, 0, 0, -3, 0, 0, 1, 1, 1, -3, 0, 0, 0, -3, -1, 0, 0, 0, 1, -2, 0, 0, 1, -2, 0, 0, 0, -4, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0, -2, 0, 0, -1, 0, -1, -1, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, -1, 0, 1, 0, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, -3, 0, 0, -2, 0, -1, -2, -2, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 1, -1, 0, 0, -3, 0, -3, 0, 0, -3, 0, 0, 1, 0, 0, -2, -3, -2, -4, -1, -2, 1, 0, -3, -2, 1, -2, 0, 0, -4, -4, -1, 0, 0, -3, -1, 0, 0, 0, 1, -2, -3, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -2, 0, -2, -2, 0, -1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 1, -1, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, 0, -1, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 3, 0, 0, 0, 0, 0, 0, 0, 4, 0, 2, 0, 0, 5, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 2, 4, 1, -1, 0, 0, 0, 0, 2, 3, 1, 1, 1, 0, 0, 0, 4, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 2, 4, 0, 0, 0, 2, 0, 0, 1, 0, 0, 0, 4, 0, 0, 0, 0, 1, 3, 0, 0, 3, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -2, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -3, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -2, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -4, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -3, -2, -3, -4, 0, 0, 0, -2, -1, -1, 0, -1, 0, 0, 0, 0, -3, -1, -1, -4, 0, -3, 0, -1, -1, 0, -4, 0, -1, 0, 0, -2, 0, 0, 0, 1, -3, 0, 0, -4, 0, 0, -2, 0, 0, -2, -2, 0, 0, -5, -2, -3, -5, -1, -4, 0, -4, -2, -2, -1, -3, 0, -1, -2, -3, 0, -3, -3, 0, -2, -2, 0, -4, 1, -3, -4, -3, 0, 0, -2, 0, 0, 0, 0, 0, 0, -3, 0, -2, 1, 0, 0, 0, 0, 0, -1, -2, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0,
+    0, -1, 0, 0, 0, -3, 1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, -3, 0, -2, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -2, -3, 0, 0, 0, 0, 0, -3, 0, 0, 0, -2, -3, 0, 0, 0, 0, -1, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 2, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 4, 2, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 2, 0, 1, 0, 0, 0, 0, 1, 0, 0, 4, 0, 3, 0, 0, 4, 0, 0, 0, 2, 4, 4, 0, 0, 1, 0, 0, 2, 0, 0, 0, 3, 0, 0, 0, 0, 1, 2, 0, 0, 2, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 1, 0, -2, 0, 0, -1, 0, -1, 0, 0, 0, 0, -2, 0, -1, 0, 0, -3, 0, -2, 0, -1, 0, 0, -2, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -1, 0, -2, -2, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, 0, -1, -1, 0, -1, 1, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -2, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 2, 1, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 1, 0, 0, 2, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, 0, 0, -1, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, -4, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 0, -4, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -4, -1, -4, -1, 0, 0, 0, -2, 0, 2, 0, 0, 0, -2, -5, 1, 0, 0, -2, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, -1, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, -2, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, -3, 0, -1, 0, 0, 0, 0, -3, 0, 0, -4, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 1, -1, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, -3, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, -3, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, -1, -3, -1, -3, 0, 0, 0, 0, -2, 0, 2, 0, 0, 0, -3, -4, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -3, 0, -4, 1, 0, -1, 0, -2, -2, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, -5, 0, -3, 0, 0, -3, 0, 0, 1, 0, 0, -2, -4, -2, 0, -2, -1, 1, 0, -3, -2, 0, -1, 0, 0, -3, -6, 0, 0, 0, -3, -2, 0, 0, 0, 0, -3, -4, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -2, 0, -2, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -3, 0, -2, 1, 0, -1, 0, -2, 0, -2, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -4, 0, -4, 0, 0, -3, 0, 0, 0, 0, 0, -3, -2, -3, -3, -1, -2, 0, 0, -3, -2, 1, 0, 0, 0, -3, -4, -1, 0, 0, -3, -2, 0, 0, 0, 0, -2, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2, -3, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -2, -1, 1, 0, -3, 0, -2, -1, 0, 0, -2, -3, -3, 0, -2, -1, -3, -1, 0, -3, 0, -2, -1, -1, -4, 1, -5, -2, 0, 0, 0, 0, -3, -2, 0, 0, -3, 0, 0, 0, 0, 1, -3, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -5, 0, 0, -1, -1, -1, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, -2, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -2, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, -2, -2, -1, -1, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, -1, -2, -1, 0, 0, -1, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, -1, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, -2, -2, -2, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, -2, 0, 0, -3, 0, 0, 0, 0, 0, -1, 0, 0, -3, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 1, 1, 0, 1, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, -1, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, -2, 0, 0, 0, -1, -2, 0, 0, 0, 0, -1, 0, -4, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -1, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -2, -1, -1, -1, -1, -1, -1, -2, 0, 0, 0, -1, 0, 0, -3, 0, -1, 0, 0, 0, -2, 0, 0, -2, 0, 0, -1, 0, 0, -1, -2, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, -2, 0, 0, -1, 0, -1, -1, -1, -1, -1, 0, -1, 0, -2, -1, -2, 0, 1, -1, 0, 1, -1, 0, 0, 0, -2, -1, 0, 0, 1, 1, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 1, 0, -4, 0, 0, -3, 0, -1, 0, 0, 0, 0, -2, 0, -3, 0, 0, -4, 0, -3, 0, -1, 0, 0, -4, 0, 0, -4, 0, -2, -4, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, -1, 0, 0, -3, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 1, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -3, -3, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -3, -1, 0, 0, 0, 0, 0, -3, 0, -1, -2, 0, -1, -1, 0, 0, -1, 0, -3, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, -1, 0, -2, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, -3, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -2, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, -2, 0, 0, 1, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, -1, 0, 1, 1, -2, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -2, 0, -1, 0, 0, 0, -2, -3, -3, 0, 0, 0, 0, -3, 0, 0, 0, -2, -3, 0, -4, 0, 0, -2, 0, -5, 0, 0, 0, -2, 0, 0, -3, 0, 0, 0, 0, 0, -4, 0, 0, 0, -3, 0, 0, 0, 0, 0, -3, 0, 0, 0, -2, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -2, 0, 1, 0, 0, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, -1, -2, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 1, -1, -1, 0, 0, -2, 0, -1, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -1, -1, 0, 0, 0, 0, -1, -1, 0, 0, -1, -1, -3, 0, -2, -1, -1, -1, 0, -3, 1, 0, -1, -1, -4, 0, -4, 0, 0, 0, 0, 0, -3, -2, 0, 0, -2, 0, 0, 0, 0, 0, -3, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 1, -4, 0, 0, -1, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, -4, -4, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, -1, 1, 0, -1, 0, -1, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, 0, -4, 0, -4, 0, 0, 0, 1, 0, 0, 2, 0, -5, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 1, -1, -1, 0, 0, 0, 0, -1, 1, -1, -1, -1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, -1, -2, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, -1, 0, -2, 0, 0, -1, 0, 0, -2, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, -3, -3, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, -1, 0, -3, 0, -3, 0, 0, 0, 0, 0, 0, 2, 0, -4, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0, -1, 2, -1, -1, 0, -1, 0, 0, -1, 2, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -2, -2, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 0, 0, 0, -2, 0, 0, 1, 0, 0, 0, 0, 0, -3, 0, 0, 0, 1, 1, 0, 0, 0, 2, 1, 0, 0, 0, 1, 1, 2, 0, 1, 1, -2, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 1, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, -3, -3, 0, 0, 0, 0, -2, 0, 0, 0, 0, -2, 0, -4, 0, 0, -2, 0, -5, 0, 0, 0, -2, 0, 0, -2, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -2, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -3, 0, 0, 0, 0, -1, 0, 0, -2, 0, 0, 0, -2, 0, -2, -3, 0, -1, 0, -2, 0, 0, 0, 0, 0, -1, -3, 0, 0, -2, -2, 0, 0, 0, 0, -1, 0, -3, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0,
+    0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -2, 0, 0, 0, -1, -2, 0, 0, 0, 0, -1, 0, -3, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, -2, 0, 0, -1, -2, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, -4, 0, 0, 1, 0, 0, 0, 0, 0, -3, 0, -2, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -1, 0, 1, 1, -2, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, -2, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, -2, 0, 0, 0, 1, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 3, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 2, 0, 1, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, -1, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 1, -1, 0, 0, 0, 0, -3, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -3, 0, 0, 0, -5, 0, 0, -5, 0, 0, 1, 0, 0, 0, 0, -1, 1, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -1, -1, 0, 0, 0, 0, -1, 1, 0, 0, 0, 0, 0, 0, 0, -1, 1, 1, -1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 2, -1, -1, 0, 0, -1, 0, -1, 1, 0, -1, 0, 0, 2, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 1, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 1, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0, -2, 0, 0, 0, 0, -4, 0, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 3, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 1, 3, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 1, 0, 0, 2, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -2, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -4, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 2, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 1, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 2, 1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -2, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 2, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 2, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -2, 0, 0, 0, -1, -2, 0, 0, 0, 0, -1, 0, -3, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2, 0, 0, 0, 1, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, -1, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -2, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -2, 0, 0, 0, -2, 0, 0, -1, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 2, 1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 2, 1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t bookerly_18_boldGlyphLookup[368] = {
+    0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0001, 0x0002, 0xFFFF, 0xFFFF, 0xFFFF, 0x0003, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0004, 0xFFFF, 0xFFFF,
+    0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, 0x0010, 0x0011, 0x0012, 0x0013, 0x0014,
+    0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, 0x0020, 0x0021, 0x0022, 0x0023, 0x0024,
+    0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, 0x0030, 0x0031, 0x0032, 0x0033, 0x0034,
+    0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, 0x0040, 0x0041, 0x0042, 0x0043, 0x0044,
+    0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051, 0x0052, 0x0053, 0x0054,
+    0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, 0x0060, 0x0061, 0x0062, 0x0063, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x0072, 0x0073,
+    0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, 0x0080, 0x0081, 0x0082, 0x0083,
+    0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F, 0x0090, 0x0091, 0x0092, 0x0093,
+    0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F, 0x00A0, 0x00A1, 0x00A2, 0x00A3,
+    0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF, 0x00B0, 0x00B1, 0x00B2, 0x00B3,
+    0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF, 0x00C0, 0x00C1, 0x00C2, 0x00C3,
+    0x0241, 0x0242, 0x0243, 0x0244, 0x0245, 0x0246, 0x0247, 0x0248, 0x0249, 0x024A, 0x024B, 0x024C, 0x024D, 0x024E, 0x024F, 0x0250,
+    0x0251, 0x0252, 0x0253, 0x0254, 0x0255, 0x0256, 0x0257, 0x0258, 0x0259, 0x025A, 0x025B, 0x025C, 0x025D, 0x025E, 0x025F, 0x0260,
+    0x0261, 0x0262, 0x0263, 0x0264, 0x0265, 0x0266, 0x0267, 0x0268, 0x0269, 0x026A, 0x026B, 0x026C, 0x026D, 0x026E, 0x026F, 0x0270,
+    0x0271, 0xFFFF, 0x0272, 0x0273, 0x0274, 0x0275, 0x0276, 0x0277, 0x0278, 0x0279, 0x027A, 0x027B, 0x027C, 0xFFFF, 0x027D, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x027E, 0x027F, 0xFFFF, 0xFFFF, 0x0280, 0x0281, 0x0282, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x0283, 0xFFFF, 0xFFFF, 0xFFFF, 0x0284, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0285,
+    0x0286, 0x0287, 0x0288, 0x0289, 0x028A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
 };
 
 static const EpdFontData bookerly_18_bold = {
     bookerly_18_boldBitmaps,
     bookerly_18_boldGlyphs,
     bookerly_18_boldIntervals,
-    64,
+    65,
     49,
     40,
     -10,
     true,
     bookerly_18_boldGroups,
-    11,
+    4,
+    bookerly_18_boldKernLeftClasses,
+    bookerly_18_boldKernRightClasses,
+    bookerly_18_boldKernMatrix,
+    119,
+    nullptr,
+    0,
+    0,
+    bookerly_18_boldGlyphLookup,
+    bookerly_18_boldGlyphGroups,
+    false,
+    nullptr,
 };
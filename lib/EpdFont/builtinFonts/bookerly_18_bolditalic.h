@@ -3,2713 +3,2859 @@
  * name: bookerly_18_bolditalic
  * size: 18
  * mode: 2-bit  compressed: true
- * Command used: fontconvert.py bookerly_18_bolditalic 18 ../builtinFonts/source/Bookerly/Bookerly-BoldItalic.ttf --2bit --compress
+ * Command used: fontconvert.py bookerly_18_bolditalic 18 ../builtinFonts/source/Bookerly/Bookerly-BoldItalic.ttf --2bit --compress --frequency-corpus ../../../test/hyphenation_eval/resources/english_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/french_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/german_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/italian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/russian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/spanish_hyphenation_tests.txt
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t bookerly_18_bolditalicBitmaps[43201] = {
-    0x95, 0x5B, 0xBF, 0xAF, 0xE4, 0xD6, 0x75, 0xBE, 0x1C, 0xEA, 0x2D, 0x15, 0x33, 0x0E, 0xB7, 0xD8,
-    0x4D, 0x22, 0x2B, 0x08, 0xDB, 0xC0, 0x40, 0xC2, 0x7F, 0x20, 0x30, 0x29, 0x6F, 0xE1, 0xC2, 0x85,
-    0x5E, 0x00, 0x3D, 0x09, 0x88, 0x8A, 0x6D, 0xDC, 0x64, 0x0D, 0x64, 0x9B, 0x14, 0x29, 0x02, 0x93,
-    0xF6, 0x02, 0x51, 0xE1, 0xC2, 0x1B, 0xC0, 0x4A, 0x93, 0x42, 0x2A, 0x5C, 0xC8, 0xCF, 0xC5, 0x36,
-    0xA9, 0x02, 0xCB, 0xA4, 0x24, 0x24, 0x2A, 0x54, 0x68, 0x2C, 0xC7, 0x50, 0xE1, 0x42, 0x54, 0xB4,
-    0x8A, 0x63, 0xB9, 0x58, 0x2A, 0x1E, 0x61, 0xB9, 0xBB, 0x24, 0x6F, 0xBE, 0xEF, 0x3B, 0x97, 0x33,
-    0xEF, 0xED, 0x4A, 0x56, 0x3C, 0x78, 0xC3, 0x99, 0xE1, 0x8F, 0x7B, 0xCF, 0x3D, 0xF7, 0x9C, 0xEF,
-    0x7C, 0xE7, 0xDC, 0xFB, 0x9C, 0x7B, 0xC6, 0x25, 0x8B, 0xCB, 0x26, 0x57, 0x4C, 0xAE, 0xDC, 0xB9,
-    0x7A, 0x70, 0xED, 0xE0, 0xFC, 0xD6, 0xF9, 0x0E, 0x7F, 0x91, 0x6F, 0x22, 0x5F, 0x6D, 0xBC, 0xDB,
-    0x2C, 0x2E, 0x9E, 0x5D, 0x3C, 0xE9, 0x6F, 0x74, 0xF1, 0x8E, 0x7F, 0xC9, 0xE0, 0x2E, 0x54, 0xCE,
-    0x5E, 0xE9, 0xE0, 0x8A, 0x91, 0x0D, 0x94, 0x83, 0x2B, 0x7B, 0xF7, 0x05, 0x9C, 0xBF, 0x18, 0x55,
-    0xF5, 0x77, 0xE6, 0x7C, 0xD7, 0xBE, 0xEE, 0xB3, 0xA9, 0x1C, 0xFC, 0x0D, 0x7C, 0x2F, 0x5F, 0xF3,
-    0xC9, 0x54, 0xF4, 0x38, 0x9F, 0xEE, 0xCA, 0xAE, 0x8D, 0xA7, 0x6C, 0x28, 0x9B, 0xDB, 0xF1, 0x4D,
-    0x6B, 0xE4, 0x5A, 0xF5, 0x65, 0x3C, 0xE7, 0xAB, 0xBA, 0xC1, 0xD1, 0xB5, 0x95, 0x8B, 0x3C, 0x3E,
-    0xD9, 0x39, 0x8E, 0xF1, 0x1C, 0x41, 0x08, 0x8F, 0xD7, 0x9C, 0xF2, 0x38, 0x65, 0x3A, 0x1E, 0x5D,
-    0xBD, 0xF7, 0xFC, 0xFC, 0x8C, 0xCB, 0x86, 0x74, 0xE7, 0x5C, 0x3E, 0x64, 0x83, 0x73, 0x45, 0xAF,
-    0xE3, 0x36, 0xEF, 0xDD, 0xE5, 0xFA, 0xE7, 0xF5, 0x87, 0x55, 0xCD, 0x3B, 0xB7, 0x2D, 0x8F, 0x9D,
-    0x8E, 0x8D, 0x35, 0xEF, 0xD4, 0x7C, 0xA4, 0xE6, 0x37, 0x6C, 0x1E, 0xC3, 0xDB, 0xCC, 0xF8, 0xFE,
-    0x4A, 0xF4, 0x8A, 0xDB, 0xBF, 0x36, 0x03, 0x8F, 0x13, 0x0F, 0x5F, 0xE1, 0x21, 0xE7, 0x98, 0x9F,
-    0xEC, 0x70, 0xC1, 0xE3, 0x09, 0xC8, 0x32, 0xF0, 0xE0, 0x5D, 0x3A, 0x17, 0x6D, 0x8F, 0x11, 0xBD,
-    0x35, 0x45, 0x3E, 0xEE, 0x17, 0xD7, 0xBE, 0x36, 0x94, 0x55, 0x31, 0xFE, 0x38, 0xAD, 0x12, 0xFF,
-    0x13, 0x3C, 0xE2, 0x3D, 0x1E, 0x2C, 0x70, 0x37, 0x1E, 0xB4, 0xAF, 0x90, 0x38, 0x3A, 0x9C, 0xCD,
-    0xFC, 0x1C, 0x8D, 0xF1, 0x3B, 0xBE, 0xF1, 0x9B, 0xA1, 0xEC, 0xEB, 0x6E, 0xCA, 0xC6, 0x7C, 0xF7,
-    0x95, 0x64, 0x8E, 0x7D, 0x7E, 0x05, 0x82, 0xFA, 0x77, 0x7D, 0xC5, 0x21, 0x57, 0x8E, 0x9D, 0xB9,
-    0xC4, 0xDF, 0x43, 0x9B, 0x05, 0x05, 0xCA, 0x20, 0x8B, 0x4B, 0x7A, 0x8A, 0xBA, 0xDB, 0x8B, 0x5A,
-    0xF2, 0x50, 0x54, 0xEE, 0xDC, 0xEB, 0x71, 0x1E, 0x8E, 0xF1, 0x7E, 0x15, 0xEF, 0x16, 0xF7, 0x25,
-    0x78, 0xE7, 0x1E, 0x07, 0xCC, 0x59, 0xE4, 0xEF, 0x60, 0x72, 0x31, 0x24, 0xF4, 0x3B, 0x40, 0x95,
-    0xB8, 0xA3, 0x2B, 0x61, 0x08, 0x15, 0xA7, 0x1E, 0x7D, 0x4B, 0xBF, 0xF8, 0xDA, 0x62, 0x76, 0xDA,
-    0x26, 0x1B, 0x60, 0x0A, 0xBC, 0x52, 0x77, 0x25, 0xFA, 0xCF, 0x76, 0xF1, 0x42, 0xD5, 0xB9, 0x72,
-    0x9B, 0x0D, 0x59, 0x8F, 0x4E, 0x30, 0x8E, 0x06, 0x5A, 0x9E, 0x36, 0xFE, 0xF9, 0x29, 0x1D, 0x32,
-    0x3F, 0x61, 0xEE, 0xBA, 0xBA, 0xC2, 0x94, 0x25, 0x7E, 0x8C, 0x47, 0x76, 0xB2, 0xF9, 0x37, 0x07,
-    0x23, 0x60, 0x27, 0x50, 0xBF, 0x3A, 0x41, 0x17, 0xBD, 0x3A, 0x91, 0x01, 0x34, 0x9C, 0xC7, 0x6C,
-    0x50, 0x27, 0xEA, 0x73, 0x47, 0xF1, 0xD2, 0x49, 0x9D, 0x38, 0x9E, 0xF4, 0x0D, 0xA4, 0xC1, 0x75,
-    0x76, 0xE2, 0x68, 0x7B, 0xEC, 0x04, 0xBF, 0xA8, 0x9F, 0x11, 0xB7, 0x42, 0xE6, 0xCD, 0x7D, 0x34,
-    0x16, 0x77, 0xEE, 0x91, 0xD7, 0x05, 0x9B, 0x63, 0xCD, 0x22, 0x5E, 0xB5, 0x67, 0xAF, 0x68, 0xE0,
-    0x96, 0xE9, 0xAF, 0xA7, 0x06, 0x68, 0x81, 0x1C, 0x1E, 0xC6, 0x17, 0xE9, 0xB6, 0xB2, 0xCB, 0xC2,
-    0x69, 0x08, 0x7B, 0x11, 0xFA, 0xCB, 0x77, 0x6E, 0xD3, 0xBB, 0xFC, 0xAE, 0x97, 0x3C, 0xB5, 0xDF,
-    0x46, 0x2D, 0xDC, 0xC5, 0xEF, 0x22, 0xDA, 0x45, 0x8D, 0xA7, 0xD1, 0x6C, 0xEA, 0x27, 0xF5, 0xD2,
-    0xBE, 0x37, 0xA6, 0xBF, 0x86, 0xB5, 0x4C, 0xC5, 0xF0, 0x58, 0xD1, 0x61, 0x14, 0x75, 0xEF, 0x16,
-    0x4A, 0xEB, 0xB7, 0x90, 0x34, 0x83, 0xDD, 0x50, 0x97, 0xE5, 0xB0, 0xF1, 0x6F, 0x40, 0x16, 0xDF,
-    0xC5, 0xFE, 0x0E, 0x47, 0x84, 0xB1, 0x78, 0x1A, 0x1A, 0xFE, 0x06, 0x4E, 0x57, 0x75, 0xDD, 0xF7,
-    0xB4, 0x19, 0xBA, 0x82, 0x3E, 0x1F, 0x78, 0x7F, 0x1B, 0x17, 0x17, 0xD8, 0x15, 0x06, 0x7D, 0x82,
-    0x8E, 0xBC, 0x8D, 0xF7, 0x4B, 0xF8, 0x79, 0x31, 0x7F, 0xDF, 0x7F, 0x9D, 0xFE, 0x77, 0x65, 0xCA,
-    0x07, 0x3A, 0xDE, 0x50, 0x76, 0xB7, 0x0F, 0x5A, 0x48, 0x71, 0x27, 0xC6, 0x40, 0xEF, 0xA5, 0xFB,
-    0x52, 0x87, 0xFB, 0x77, 0xC1, 0x29, 0xC7, 0x79, 0xA0, 0x03, 0xB5, 0x2E, 0xE3, 0xA0, 0x6E, 0xA1,
-    0x76, 0x8C, 0x16, 0xB3, 0x56, 0x0C, 0x76, 0x91, 0x17, 0x22, 0xCE, 0xDE, 0x7A, 0x92, 0x77, 0xEB,
-    0xCE, 0x3A, 0x34, 0xCF, 0x3B, 0x88, 0x29, 0x6A, 0x37, 0x99, 0xC3, 0x0F, 0x76, 0x10, 0xF3, 0xB6,
-    0x76, 0x6B, 0x0D, 0xE9, 0x2C, 0x2D, 0xCD, 0x8D, 0x67, 0xA7, 0xEA, 0xEF, 0xD7, 0x96, 0x26, 0xF6,
-    0xD3, 0x9C, 0x7D, 0xB0, 0xB7, 0x07, 0x37, 0xEA, 0x7D, 0xFF, 0x23, 0x34, 0xC9, 0x9E, 0xAD, 0xB3,
-    0x20, 0xDB, 0x7A, 0xC2, 0x46, 0xD1, 0xC9, 0xEE, 0x75, 0x32, 0x7B, 0x78, 0x78, 0xBC, 0xC8, 0x27,
-    0x78, 0xC3, 0x59, 0x9D, 0xF0, 0x5D, 0x0F, 0xA1, 0x2F, 0x6A, 0x59, 0x2E, 0x96, 0xDC, 0x74, 0x4D,
-    0x5B, 0x15, 0xE9, 0x2E, 0x99, 0xE0, 0xF8, 0x77, 0xBA, 0xA7, 0x5A, 0x38, 0x15, 0x66, 0xA1, 0x7E,
-    0x30, 0xB5, 0x77, 0xFE, 0xF1, 0xCD, 0x09, 0xF0, 0x0A, 0xBB, 0x81, 0x3F, 0xB8, 0x6C, 0x1B, 0xC6,
-    0x44, 0xB3, 0xA2, 0x0B, 0x3D, 0xF2, 0xE5, 0xC2, 0x69, 0xFB, 0xD1, 0x2B, 0x84, 0xA9, 0xB7, 0x88,
-    0x6F, 0xC4, 0xAE, 0xEE, 0xB3, 0x6F, 0x76, 0xEE, 0xCB, 0x10, 0x36, 0xE2, 0x08, 0x33, 0x2F, 0x0C,
-    0x07, 0x7A, 0x37, 0xE9, 0x0C, 0xB9, 0xA1, 0x9F, 0x72, 0xC0, 0x21, 0xED, 0xD5, 0x9D, 0x5F, 0x32,
-    0x62, 0x88, 0xFF, 0x18, 0x8D, 0x5E, 0x3E, 0x39, 0x71, 0x51, 0xD5, 0x7E, 0xD7, 0x97, 0x93, 0xFF,
-    0x5F, 0x1F, 0x19, 0xFC, 0x1E, 0x1D, 0xCB, 0x0D, 0x28, 0x9F, 0x66, 0x4B, 0x13, 0x69, 0xAA, 0xD3,
-    0x7C, 0xFE, 0xAE, 0xD7, 0x9A, 0xDF, 0xF5, 0x5A, 0xFE, 0xB9, 0xD7, 0x4E, 0x57, 0x3C, 0x3B, 0x92,
-    0x03, 0xCB, 0x63, 0x6B, 0xC2, 0xF9, 0x86, 0x00, 0x2F, 0x18, 0x46, 0x1C, 0x02, 0x9E, 0x23, 0x90,
-    0xE1, 0x6F, 0x64, 0x20, 0x2B, 0x01, 0x3C, 0x1D, 0x34, 0x93, 0x40, 0xF9, 0xC5, 0x94, 0xEA, 0x98,
-    0xE1, 0xC1, 0x72, 0xA2, 0x35, 0x95, 0x53, 0xC9, 0xE3, 0x58, 0xCA, 0xFC, 0xE9, 0x00, 0xF5, 0x80,
-    0x47, 0x9D, 0xB7, 0xE3, 0x16, 0xC7, 0x0D, 0xA6, 0x11, 0xF1, 0x0E, 0x61, 0x69, 0x04, 0x46, 0xE3,
-    0x09, 0xA9, 0x79, 0x89, 0xD0, 0x49, 0xAE, 0x6E, 0x0D, 0x95, 0x63, 0x39, 0x1F, 0xC4, 0xA1, 0xFC,
-    0xD1, 0xB1, 0xC9, 0x79, 0x89, 0x67, 0x1A, 0x08, 0xB6, 0x8B, 0xCC, 0x22, 0x3C, 0xEF, 0xA6, 0xBC,
-    0x5B, 0xF6, 0xC1, 0xFE, 0x09, 0xFC, 0x84, 0xAB, 0x87, 0x4E, 0xE6, 0x72, 0xF9, 0x87, 0x4F, 0x2E,
-    0x76, 0x32, 0x5E, 0x4F, 0xB6, 0x04, 0x17, 0x3F, 0x53, 0x82, 0x1B, 0x32, 0x14, 0xEB, 0x52, 0x51,
-    0x65, 0xA3, 0x38, 0x41, 0x1B, 0xC2, 0xE4, 0xDF, 0x02, 0xC4, 0xF8, 0x26, 0xF7, 0x0A, 0xED, 0x03,
-    0x3C, 0x0C, 0x9D, 0x7E, 0x0B, 0x57, 0x7B, 0xD8, 0x6F, 0x31, 0x0B, 0xF7, 0xF8, 0x30, 0x43, 0x12,
-    0xC6, 0x46, 0xC0, 0xE3, 0x38, 0x62, 0xF6, 0xE1, 0x34, 0x2E, 0x9D, 0xCC, 0x39, 0xE1, 0x09, 0x3B,
-    0xDF, 0xD8, 0x15, 0xDD, 0x3E, 0xE9, 0xCA, 0xC9, 0xC9, 0x49, 0x42, 0x48, 0xEA, 0x85, 0x4B, 0x0A,
-    0xCE, 0x5D, 0xC9, 0xDF, 0x6E, 0x2F, 0x94, 0xFC, 0x8B, 0x47, 0x9C, 0xDE, 0x49, 0xA8, 0x2E, 0xF1,
-    0x55, 0x2E, 0x78, 0xF7, 0xDB, 0x78, 0xA0, 0x17, 0x7E, 0x91, 0xFA, 0xA6, 0xD6, 0xD8, 0x74, 0x3E,
-    0xAF, 0x9D, 0x5E, 0x97, 0x3F, 0x72, 0xC2, 0x13, 0x3E, 0x8B, 0x87, 0x71, 0x22, 0xE2, 0x5C, 0x3B,
-    0x8D, 0x02, 0x02, 0x1F, 0xBE, 0x06, 0x89, 0x1A, 0x1E, 0x86, 0xA3, 0xBF, 0x0E, 0x9A, 0x5F, 0xF8,
-    0xE8, 0xC2, 0x73, 0x8C, 0x9C, 0x47, 0xAB, 0x29, 0x3D, 0xE6, 0x0C, 0xCF, 0x9D, 0xC1, 0x0B, 0xBE,
-    0xF6, 0x6B, 0xA7, 0x91, 0xB7, 0x86, 0x06, 0x69, 0x94, 0xF8, 0x73, 0x57, 0x40, 0xF7, 0x34, 0x71,
-    0x71, 0x07, 0xA1, 0x23, 0x8F, 0xC8, 0x8C, 0xAF, 0xD9, 0x48, 0xF8, 0x83, 0xB9, 0xE6, 0x3B, 0x00,
-    0x08, 0xBE, 0x62, 0x20, 0xF9, 0xBD, 0x93, 0xFA, 0x93, 0xBF, 0xA2, 0x1A, 0xE4, 0xC8, 0xDE, 0x0B,
-    0xB0, 0xC7, 0x52, 0x5C, 0x24, 0xA0, 0x97, 0xD0, 0xD5, 0xA0, 0x2A, 0x9C, 0xC8, 0x42, 0xF0, 0x51,
-    0x60, 0xA2, 0xF2, 0x4A, 0x82, 0x7C, 0xA2, 0xB9, 0x6D, 0x39, 0x95, 0x76, 0x83, 0x8C, 0x8C, 0x20,
-    0x18, 0x1E, 0x2B, 0x17, 0x4D, 0x0C, 0x85, 0xA6, 0x8D, 0xD1, 0xC8, 0x78, 0x9F, 0x02, 0x05, 0x22,
-    0x84, 0x5B, 0xE7, 0x2A, 0x91, 0xC7, 0x4A, 0xB7, 0xA9, 0x9D, 0xE5, 0x34, 0x96, 0xA6, 0xE6, 0xCE,
-    0xC6, 0xFA, 0x4D, 0x3E, 0x9B, 0x4A, 0x55, 0x2D, 0x0F, 0xB1, 0xF4, 0x15, 0xED, 0xA9, 0x84, 0x7C,
-    0xAF, 0xE0, 0xDD, 0x69, 0x70, 0xBD, 0x7B, 0x9C, 0x9A, 0xDB, 0xFC, 0xCD, 0xE1, 0xB4, 0x8B, 0x5A,
-    0xE7, 0x98, 0xEA, 0x69, 0x6F, 0x59, 0xE5, 0x72, 0x4A, 0x3E, 0xB7, 0xFA, 0x4B, 0x4F, 0xBF, 0xF5,
-    0x5B, 0x58, 0x37, 0xFA, 0x85, 0x3B, 0xC2, 0x1C, 0x81, 0xAA, 0x39, 0x43, 0x20, 0xBE, 0x24, 0x54,
-    0x62, 0x87, 0xE9, 0x48, 0x74, 0x1A, 0xB1, 0x09, 0x0F, 0xC0, 0x42, 0x70, 0x2B, 0xA3, 0xE1, 0x47,
-    0x81, 0x72, 0x55, 0xC6, 0xBE, 0x70, 0x46, 0xA1, 0xFB, 0xB2, 0xFA, 0x85, 0xE0, 0x62, 0x89, 0x3F,
-    0xE5, 0x61, 0x27, 0x8E, 0x58, 0x7E, 0x72, 0x52, 0x83, 0x7C, 0xC2, 0x9C, 0xC0, 0x77, 0xB2, 0x39,
-    0x9A, 0x68, 0x2C, 0x7F, 0x61, 0x16, 0x23, 0x35, 0xE8, 0x20, 0xDD, 0xC4, 0x66, 0xF6, 0x62, 0x77,
-    0xDD, 0x6A, 0x0C, 0x07, 0x5B, 0xAF, 0xC7, 0xD5, 0xBC, 0x0A, 0x73, 0x12, 0x67, 0xAE, 0x1B, 0x8C,
-    0xB6, 0xED, 0xF7, 0x50, 0xF5, 0x0D, 0x77, 0x40, 0x00, 0x58, 0xBE, 0xC6, 0x2E, 0x8D, 0x42, 0x47,
-    0xC5, 0xF2, 0x1C, 0x83, 0x7B, 0x85, 0x71, 0x63, 0xEA, 0xDB, 0x6D, 0xA6, 0x69, 0x25, 0xDD, 0xEE,
-    0x20, 0x13, 0x06, 0x5C, 0x4F, 0xF9, 0xAC, 0xF9, 0xD7, 0x08, 0x65, 0xF9, 0xBD, 0x6C, 0xBE, 0xC1,
-    0x0C, 0xB5, 0x34, 0xE4, 0xA7, 0xC8, 0x30, 0xD0, 0x46, 0x57, 0x52, 0x6B, 0x09, 0x7D, 0x6A, 0x8B,
-    0xDE, 0xB3, 0x29, 0x5D, 0xA8, 0xBA, 0x96, 0x00, 0x18, 0xFB, 0x0F, 0x71, 0x6F, 0x21, 0xBE, 0xDB,
-    0x52, 0xF1, 0xC0, 0xA0, 0x6D, 0xD0, 0xD3, 0xFA, 0x11, 0xA6, 0x6C, 0xC5, 0x0B, 0x62, 0xE8, 0xAF,
-    0x31, 0x5C, 0x88, 0xD1, 0x8E, 0xC2, 0x39, 0x65, 0x05, 0xB9, 0xE2, 0x0A, 0x8E, 0xF5, 0xD9, 0xA3,
-    0x9D, 0xC7, 0xDF, 0x48, 0x74, 0xA8, 0x0D, 0x0E, 0x6D, 0x66, 0x7A, 0x4D, 0x35, 0x04, 0xFF, 0xD2,
-    0x2D, 0x99, 0x6A, 0x2E, 0x63, 0x93, 0x39, 0x6C, 0xA4, 0xC8, 0x4C, 0x92, 0xB4, 0x62, 0x7C, 0x34,
-    0xD5, 0x27, 0xBD, 0x8D, 0xD0, 0x50, 0xE6, 0xE6, 0x01, 0x42, 0xBF, 0x54, 0x91, 0x17, 0x6D, 0x8B,
-    0x19, 0x1A, 0x16, 0xF5, 0x7A, 0xE4, 0x15, 0x55, 0x48, 0x10, 0x5A, 0x30, 0x4C, 0xCC, 0x13, 0xE2,
-    0xC6, 0x13, 0xF6, 0x14, 0x43, 0x08, 0x9E, 0x23, 0xB8, 0x71, 0x6E, 0x3E, 0xFD, 0xD1, 0x43, 0x1B,
-    0xA2, 0xB2, 0x4E, 0xD2, 0x1B, 0x8F, 0x5C, 0xE4, 0x96, 0x70, 0x6C, 0x3A, 0x18, 0x23, 0xF0, 0xE0,
-    0x36, 0xE3, 0xD9, 0xFB, 0x95, 0x17, 0x6C, 0xE4, 0x00, 0x13, 0xDE, 0xEC, 0x66, 0xDC, 0xBF, 0x1D,
-    0x26, 0xC0, 0x7C, 0xA0, 0xF8, 0xD4, 0x03, 0x99, 0x87, 0xA2, 0xC5, 0x4A, 0xC8, 0xA5, 0xB5, 0x69,
-    0x1F, 0xF5, 0xAF, 0x9D, 0x9E, 0x9E, 0x36, 0xE7, 0x24, 0xDC, 0x5F, 0xE2, 0x97, 0xFF, 0xC0, 0xE5,
-    0x57, 0x08, 0x5C, 0x91, 0x00, 0x98, 0xA4, 0xC6, 0xA8, 0x61, 0xFF, 0xC8, 0xE1, 0x49, 0xF1, 0xAC,
-    0xC9, 0xFC, 0x3B, 0xA7, 0x42, 0xF4, 0x6E, 0xF4, 0x96, 0xB5, 0x17, 0xEC, 0x48, 0x9D, 0xFD, 0x0D,
-    0x65, 0x87, 0xF3, 0x34, 0x70, 0x1C, 0x18, 0x5B, 0xF6, 0x73, 0xFF, 0x7A, 0x05, 0x6B, 0x06, 0xCD,
-    0x20, 0xF9, 0xF5, 0x8A, 0xF7, 0xCC, 0x9D, 0x98, 0x14, 0xEA, 0x3B, 0x06, 0x50, 0x71, 0x34, 0x24,
-    0xA6, 0xF8, 0xBB, 0x70, 0x73, 0x2F, 0x6D, 0x45, 0x82, 0x84, 0x21, 0x66, 0xB3, 0x28, 0xD5, 0x13,
-    0xEB, 0x85, 0x67, 0xEC, 0xE3, 0x49, 0x32, 0xD6, 0x30, 0xEA, 0x39, 0x60, 0x9D, 0x17, 0x5F, 0xF4,
-    0xBF, 0x7A, 0xD6, 0xD8, 0x6E, 0x6F, 0x3E, 0xD6, 0x8E, 0x86, 0x8A, 0x06, 0x57, 0x98, 0x8F, 0xBA,
-    0x37, 0x1E, 0x81, 0x19, 0x42, 0xC6, 0xD5, 0xD5, 0x1D, 0x28, 0x85, 0x5F, 0x90, 0x3C, 0x44, 0x8A,
-    0xAD, 0xC8, 0x16, 0x70, 0x93, 0x7F, 0x0D, 0xD6, 0x82, 0x0C, 0x33, 0x9D, 0x22, 0x50, 0xA1, 0xD7,
-    0x17, 0x70, 0x6D, 0x64, 0xA8, 0x1E, 0x2C, 0x9E, 0x7C, 0x3E, 0x99, 0x40, 0xE3, 0x77, 0xA0, 0xDE,
-    0xC5, 0xFB, 0xFC, 0x09, 0xEE, 0xED, 0xBF, 0x36, 0x85, 0x2B, 0x45, 0x9F, 0x80, 0xAC, 0xE3, 0xFE,
-    0xB6, 0xC9, 0x87, 0x1C, 0xDA, 0x80, 0x71, 0xD5, 0xFF, 0xFD, 0xA0, 0xAF, 0x61, 0x5B, 0xB0, 0xE9,
-    0x97, 0x20, 0x1C, 0xFA, 0x26, 0x2F, 0x83, 0x9B, 0x22, 0x7C, 0x35, 0x94, 0xDF, 0x37, 0x9B, 0x97,
-    0x91, 0xBD, 0x06, 0x30, 0xE6, 0xB8, 0x96, 0xF0, 0x45, 0x18, 0x13, 0x55, 0x21, 0xA0, 0xD4, 0x42,
-    0xCE, 0x5F, 0x9D, 0xB4, 0x42, 0x10, 0x1F, 0x22, 0x36, 0xDD, 0x66, 0xB4, 0x54, 0x44, 0x50, 0x7B,
-    0x86, 0x3F, 0x9C, 0x79, 0x5D, 0x37, 0x00, 0x16, 0xE8, 0x07, 0xD0, 0x21, 0x2A, 0x4D, 0x6E, 0x0F,
-    0xC7, 0x04, 0xAE, 0xD9, 0xCE, 0xCA, 0xBB, 0x2C, 0x5C, 0xD1, 0xB2, 0x4B, 0x59, 0x7F, 0x7B, 0xC3,
-    0x74, 0x38, 0xE8, 0xE7, 0x66, 0xD9, 0x58, 0x30, 0xE8, 0x0A, 0xA9, 0x78, 0x8C, 0x0C, 0xF5, 0x2C,
-    0x0A, 0x96, 0xAA, 0x00, 0xAC, 0xF3, 0x13, 0x79, 0x1F, 0xFC, 0xD3, 0x72, 0xCF, 0xE5, 0xF4, 0x94,
-    0xF6, 0x86, 0x3B, 0xC4, 0xAA, 0x76, 0x0A, 0x29, 0xF1, 0x62, 0xF0, 0x29, 0xE3, 0x06, 0xB2, 0xC1,
-    0x8B, 0x5B, 0x3F, 0xD3, 0xA5, 0x31, 0xC0, 0x0F, 0x04, 0xF6, 0x41, 0x3C, 0x3A, 0x28, 0x21, 0x91,
-    0x46, 0x3D, 0x8B, 0x0D, 0x28, 0x1E, 0xDC, 0xC7, 0x8F, 0x27, 0x00, 0x66, 0x68, 0x20, 0x15, 0xEE,
-    0xA3, 0x35, 0x86, 0x3B, 0x02, 0x3F, 0xAD, 0x9C, 0x02, 0x42, 0xB8, 0x96, 0x20, 0x65, 0xB9, 0xDE,
-    0x7F, 0x72, 0x24, 0x7B, 0xD1, 0x66, 0x53, 0x65, 0x8F, 0xCB, 0x8C, 0xDC, 0x78, 0x9A, 0x5C, 0x89,
-    0x84, 0xA7, 0x67, 0x6B, 0x46, 0xDC, 0x30, 0x21, 0x78, 0x1A, 0xD7, 0xF0, 0x47, 0x60, 0x40, 0xC2,
-    0x86, 0xCB, 0xED, 0xBD, 0xE7, 0xFC, 0x60, 0xF4, 0x25, 0xB6, 0x00, 0x8D, 0xC3, 0xFD, 0x47, 0x61,
-    0xA2, 0x5D, 0x34, 0x95, 0x7E, 0x94, 0x4A, 0x96, 0xA0, 0x9F, 0xC2, 0xDF, 0xFE, 0xA3, 0x89, 0x5C,
-    0x2C, 0x86, 0x89, 0xD0, 0x5F, 0x18, 0x40, 0xE2, 0x5D, 0x0A, 0xFD, 0x26, 0xBD, 0x62, 0x84, 0x71,
-    0x2C, 0x8B, 0x1C, 0xE1, 0x58, 0x5B, 0xE8, 0xFF, 0xAC, 0xE3, 0xB4, 0x1E, 0xA3, 0xA6, 0xA6, 0xCA,
-    0xC1, 0xA5, 0x98, 0x06, 0x14, 0xFE, 0xDE, 0xF3, 0x8C, 0x82, 0x8C, 0x0D, 0x89, 0x5F, 0xD5, 0x27,
-    0xDF, 0xA7, 0x68, 0xEE, 0xF2, 0xD9, 0x8C, 0xFF, 0x0F, 0xBD, 0x90, 0x94, 0x88, 0x71, 0xD3, 0xD4,
-    0xBC, 0x88, 0x2F, 0x53, 0x47, 0x4F, 0x5C, 0x9D, 0x2F, 0x58, 0xFD, 0x42, 0x58, 0x2C, 0x55, 0x4C,
-    0xE2, 0x4F, 0xB9, 0x94, 0x2D, 0x8E, 0x49, 0x53, 0x80, 0x3C, 0xF4, 0xBD, 0x7C, 0x51, 0x58, 0xA4,
-    0xDD, 0x09, 0xDD, 0x7B, 0xC1, 0x0E, 0x06, 0xC1, 0x7B, 0x8A, 0x59, 0xF7, 0x64, 0x5E, 0xF7, 0xF0,
-    0x1D, 0xEE, 0x31, 0x2A, 0x7D, 0xB6, 0x9D, 0x5A, 0x13, 0xA3, 0x91, 0xF9, 0x3E, 0xA2, 0xFC, 0xAD,
-    0x86, 0x21, 0xB5, 0x8F, 0xF6, 0xD1, 0x4B, 0xD8, 0xE5, 0xEC, 0x50, 0x22, 0xD0, 0xCB, 0x93, 0x2A,
-    0x8C, 0x21, 0xB3, 0x29, 0xB2, 0x07, 0xD1, 0xC7, 0x51, 0x2D, 0x8B, 0x61, 0x3A, 0x84, 0xCE, 0xCA,
-    0x86, 0x93, 0x1C, 0x8B, 0xBE, 0xBB, 0x3F, 0x0E, 0xAC, 0x2E, 0x04, 0xE8, 0xA0, 0xFB, 0xD8, 0x3C,
-    0xAF, 0x14, 0x4B, 0x4A, 0xBC, 0xF1, 0xA6, 0x4F, 0x4E, 0x8E, 0x57, 0x16, 0x69, 0x34, 0xD2, 0xE8,
-    0xA7, 0x9E, 0xCC, 0x2B, 0xDA, 0x0E, 0x2B, 0x5F, 0x94, 0xBD, 0xE2, 0xD8, 0x33, 0xC6, 0x8A, 0xD3,
-    0x5B, 0x5E, 0x36, 0x17, 0xCC, 0x66, 0x36, 0x0F, 0xE9, 0x82, 0xBC, 0xEB, 0x68, 0x6C, 0x68, 0xC5,
-    0x5E, 0x5C, 0xAF, 0xD6, 0x8A, 0x8E, 0x0A, 0x4B, 0x69, 0xC7, 0x1D, 0x0B, 0x37, 0xB8, 0xF1, 0x1B,
-    0x81, 0x9B, 0x09, 0xB0, 0x03, 0xBD, 0xC0, 0xE5, 0x9F, 0x5F, 0xAB, 0x56, 0x33, 0xAF, 0xC5, 0x7E,
-    0x0B, 0x01, 0xC6, 0x7A, 0x59, 0x09, 0x87, 0x79, 0x7C, 0x3B, 0x3C, 0xFA, 0x74, 0xA3, 0x31, 0xDC,
-    0x36, 0xA0, 0x19, 0x56, 0x6E, 0x18, 0x9F, 0x71, 0x46, 0x43, 0xE4, 0x7B, 0x01, 0x8A, 0x56, 0x40,
-    0x92, 0x3B, 0x34, 0x8C, 0x6C, 0x57, 0x77, 0x34, 0x6E, 0xE7, 0x65, 0x1A, 0xD9, 0x20, 0x7A, 0xB4,
-    0x28, 0xC4, 0x65, 0x8D, 0xF5, 0xB2, 0xB1, 0xEE, 0x57, 0xED, 0x76, 0x07, 0x03, 0xA7, 0x0B, 0x22,
-    0x58, 0xB5, 0xCC, 0x9D, 0x10, 0xC0, 0x10, 0x3A, 0xFC, 0x88, 0x1F, 0x17, 0xDA, 0x25, 0x25, 0x83,
-    0x47, 0x6E, 0x45, 0xFB, 0x01, 0xCE, 0xF6, 0x0C, 0xA6, 0x25, 0xEE, 0xA6, 0xA3, 0xFB, 0x8A, 0x89,
-    0xAB, 0xB7, 0x7C, 0xEE, 0x60, 0xB7, 0x2C, 0x3B, 0x98, 0x5D, 0x58, 0xB2, 0x0A, 0x2D, 0x1F, 0x1F,
-    0xE1, 0x4D, 0xE5, 0x44, 0xC1, 0x32, 0xFA, 0xC2, 0xB8, 0x32, 0x64, 0x96, 0xC2, 0xCC, 0x02, 0xCD,
-    0x3E, 0x97, 0x40, 0xE6, 0x28, 0x2D, 0x05, 0xD7, 0x04, 0xAB, 0xE7, 0xCE, 0x7E, 0x94, 0x93, 0xCD,
-    0xB7, 0xB4, 0xC6, 0x1F, 0xF5, 0xCE, 0xAC, 0x45, 0xC1, 0xA9, 0x34, 0x81, 0x4C, 0x33, 0xAA, 0x31,
-    0x7C, 0x72, 0xF2, 0x2C, 0x3B, 0xF9, 0x9C, 0xB6, 0x42, 0x04, 0x66, 0xC4, 0x37, 0x1F, 0xAA, 0xEC,
-    0x47, 0x3B, 0x98, 0x7E, 0x18, 0x1B, 0xA0, 0x73, 0x38, 0x37, 0x61, 0x89, 0x05, 0x32, 0xA8, 0xBF,
-    0xB4, 0x62, 0x65, 0x65, 0xA3, 0xB4, 0x84, 0x87, 0xBD, 0x46, 0x02, 0x77, 0x3E, 0xAE, 0x39, 0x57,
-    0x5C, 0x94, 0xDE, 0x29, 0x88, 0x9A, 0x96, 0xC1, 0xB3, 0x6D, 0xF5, 0xAC, 0x41, 0x73, 0x18, 0x12,
-    0x2C, 0x7B, 0xF4, 0x76, 0x59, 0x8B, 0x1F, 0x82, 0xA9, 0x58, 0x8A, 0x69, 0x00, 0x58, 0xC5, 0x3E,
-    0xC4, 0x97, 0x93, 0x93, 0x67, 0x14, 0x9E, 0x66, 0x69, 0x43, 0x55, 0x98, 0x33, 0x49, 0x97, 0x1D,
-    0xCD, 0x5B, 0x8A, 0x33, 0x10, 0x27, 0x8A, 0x13, 0x2C, 0xBA, 0x1E, 0x0E, 0xF6, 0xE9, 0x87, 0xBD,
-    0x8F, 0x99, 0xDD, 0x9A, 0x73, 0xC6, 0xE1, 0xD8, 0xEC, 0x8F, 0x96, 0xAE, 0x84, 0xD0, 0xEF, 0x3F,
-    0xA3, 0xAB, 0x7D, 0x27, 0x8F, 0x5B, 0x9E, 0xFC, 0x55, 0x36, 0xA9, 0xAA, 0x80, 0xE5, 0x2F, 0x38,
-    0x8A, 0xB5, 0xAB, 0xC5, 0xA3, 0xEF, 0xAF, 0x70, 0x72, 0x7C, 0xD9, 0xB4, 0xFA, 0xBA, 0x0D, 0x96,
-    0xD5, 0x11, 0x8E, 0xF0, 0x66, 0x1A, 0xAC, 0x86, 0xED, 0x6E, 0x48, 0xB1, 0x1B, 0xF5, 0xAD, 0x6E,
-    0x4A, 0xD8, 0x29, 0x25, 0xF2, 0xDB, 0xD2, 0xB2, 0xA9, 0xC4, 0xC0, 0x7D, 0xB2, 0xD1, 0xF9, 0xBB,
-    0xC1, 0xE5, 0x0C, 0x3E, 0x32, 0xEF, 0x43, 0x65, 0x71, 0x09, 0xD1, 0xDD, 0xFC, 0x72, 0xA9, 0x4D,
-    0xF0, 0x9D, 0xA0, 0x1E, 0x1A, 0xF0, 0x96, 0x8F, 0x45, 0xD2, 0x4B, 0x31, 0x85, 0xDC, 0xBA, 0xA7,
-    0x4F, 0xB0, 0xEE, 0x90, 0x88, 0x0B, 0x31, 0x47, 0x1A, 0x64, 0x26, 0x19, 0xC6, 0xE3, 0x55, 0x49,
-    0x18, 0x54, 0x74, 0x48, 0x7D, 0x15, 0x88, 0x70, 0xB0, 0x15, 0x33, 0x16, 0xE7, 0x43, 0xC2, 0xBD,
-    0x5D, 0x27, 0xC1, 0xD4, 0x6C, 0x8A, 0xB4, 0x19, 0x92, 0xA0, 0xA6, 0x65, 0xD3, 0xA6, 0xBA, 0x36,
-    0xE5, 0x67, 0xB3, 0xFB, 0xD4, 0x07, 0x83, 0xD0, 0xEE, 0x0F, 0x34, 0x31, 0x3F, 0x09, 0xC0, 0x48,
-    0x47, 0xDD, 0x2A, 0xFC, 0x83, 0xB6, 0x9D, 0xB6, 0x93, 0x50, 0x71, 0x2B, 0x47, 0x09, 0xD0, 0x8E,
-    0xE0, 0x44, 0xD9, 0x00, 0x8B, 0x90, 0x8F, 0x01, 0x01, 0x9D, 0x4B, 0x45, 0xA5, 0x2A, 0x19, 0x0C,
-    0x6F, 0x14, 0x27, 0x55, 0x5D, 0x65, 0x6B, 0x64, 0x26, 0x5B, 0x6B, 0xE4, 0x96, 0xE2, 0xB5, 0x6D,
-    0x1F, 0x2F, 0xB2, 0xE0, 0xB7, 0xC7, 0x68, 0x96, 0xA3, 0x7D, 0x00, 0xDA, 0x4F, 0x16, 0x90, 0xEE,
-    0xE0, 0x2E, 0x4F, 0x13, 0xD8, 0xA6, 0x72, 0x28, 0xC5, 0x74, 0x3C, 0xF9, 0x21, 0x6F, 0x6A, 0xBF,
-    0xED, 0x9F, 0xEE, 0x55, 0xBC, 0xDB, 0xD6, 0xBF, 0x1E, 0xE8, 0x1E, 0x19, 0xD2, 0x85, 0x91, 0x93,
-    0x97, 0x60, 0x46, 0x27, 0x96, 0x14, 0x37, 0x60, 0x90, 0xB3, 0x12, 0x38, 0xCF, 0x84, 0x99, 0x9C,
-    0x88, 0xF4, 0xAE, 0x22, 0x93, 0x2B, 0x7A, 0xE5, 0x5A, 0x15, 0x31, 0x9F, 0xC4, 0x68, 0xCB, 0xBA,
-    0x39, 0xBF, 0xB3, 0x38, 0xE4, 0x40, 0xFD, 0xF2, 0xA5, 0x5A, 0x13, 0x29, 0x2E, 0x4B, 0x18, 0xB3,
-    0x89, 0xD7, 0x18, 0xD3, 0x60, 0x56, 0x8E, 0x39, 0x33, 0x8C, 0x5F, 0xAC, 0x11, 0xE3, 0x61, 0x4B,
-    0xB1, 0x1B, 0x25, 0x76, 0x05, 0xA3, 0x33, 0x83, 0x7C, 0xD9, 0x5B, 0xDD, 0x5A, 0xF5, 0x6F, 0x2A,
-    0xA4, 0x96, 0xC7, 0xCE, 0x56, 0x0E, 0x23, 0xF4, 0xB4, 0xAA, 0x69, 0x58, 0x31, 0x7E, 0xE3, 0x59,
-    0xE0, 0x22, 0x94, 0x7C, 0x80, 0x5C, 0x99, 0xFE, 0x3B, 0xE7, 0x8B, 0xEA, 0x97, 0x65, 0xE7, 0x87,
-    0x82, 0x6D, 0x01, 0x49, 0x6E, 0xA8, 0xAD, 0xAE, 0x9C, 0x54, 0xA5, 0x1F, 0x37, 0xFE, 0x5D, 0xB5,
-    0x55, 0x65, 0xBE, 0xED, 0x94, 0xAB, 0xCA, 0x3B, 0x36, 0x8C, 0xDC, 0x02, 0x83, 0xDE, 0xA6, 0x23,
-    0x66, 0x1A, 0xE9, 0x8D, 0x08, 0x66, 0x82, 0x0A, 0x86, 0x2E, 0x61, 0xC3, 0x22, 0x6A, 0xB0, 0x11,
-    0x34, 0x4F, 0x21, 0x67, 0x0B, 0xF5, 0x66, 0xAB, 0x0D, 0x1C, 0x42, 0xCA, 0x4D, 0xAB, 0xCF, 0x85,
-    0x6A, 0x75, 0xA7, 0xC0, 0xCD, 0xEC, 0x15, 0x1C, 0x66, 0xE7, 0xA4, 0x06, 0xD0, 0x1A, 0xDC, 0x32,
-    0x27, 0xC2, 0xC9, 0xDE, 0x62, 0x1B, 0xA3, 0xCC, 0xC6, 0xFF, 0xC6, 0x1E, 0x33, 0x14, 0xBD, 0x2B,
-    0x0C, 0xF5, 0xAD, 0x7E, 0xDC, 0x11, 0x38, 0x2F, 0x5E, 0x70, 0xFA, 0x9E, 0x82, 0xC2, 0xA4, 0x6A,
-    0xBF, 0xFF, 0xAE, 0x2A, 0xB7, 0x03, 0x6F, 0x2B, 0x16, 0xD6, 0xA9, 0x12, 0x75, 0x10, 0xF9, 0x1D,
-    0xC2, 0x18, 0xC8, 0x9B, 0x31, 0x87, 0x46, 0x40, 0xBE, 0x5D, 0x43, 0x6A, 0xD4, 0x9A, 0xBB, 0x9E,
-    0xA3, 0x4E, 0x47, 0xAD, 0x7F, 0xD9, 0x85, 0x82, 0x62, 0x60, 0x84, 0x22, 0x4E, 0xEE, 0xC2, 0x73,
-    0xDE, 0x12, 0xBC, 0x21, 0xF0, 0xD4, 0x72, 0x32, 0x5F, 0xED, 0xE8, 0x30, 0x25, 0x93, 0xCE, 0xCE,
-    0x0A, 0x8E, 0xE2, 0xC4, 0xAA, 0x58, 0xC0, 0x67, 0x18, 0x20, 0x63, 0x64, 0xED, 0xA3, 0x14, 0x62,
-    0x18, 0x2B, 0x1B, 0x15, 0x36, 0x64, 0xCB, 0xF1, 0x21, 0x86, 0x17, 0xE7, 0xF8, 0xCA, 0x78, 0x08,
-    0xE2, 0x60, 0xA9, 0x56, 0xDB, 0x0B, 0xB1, 0x48, 0x90, 0xED, 0x97, 0x87, 0x18, 0xAA, 0x65, 0x10,
-    0xA5, 0x0F, 0xC0, 0x6A, 0x9E, 0x67, 0x8A, 0x67, 0xDF, 0x2F, 0x2A, 0xE7, 0x36, 0xDD, 0xAB, 0xBE,
-    0x17, 0xD4, 0x44, 0xF5, 0xE3, 0x1C, 0xCB, 0x00, 0x46, 0x01, 0x89, 0x42, 0xE5, 0x12, 0x3E, 0x27,
-    0xFB, 0xAC, 0xC3, 0x67, 0xBB, 0x7E, 0x6A, 0x0A, 0x7A, 0x67, 0x53, 0xB1, 0xD5, 0x27, 0xDB, 0xB2,
-    0xD9, 0x68, 0x74, 0x9D, 0xE3, 0xD7, 0x84, 0x18, 0xF9, 0xD3, 0xDB, 0xE6, 0x44, 0x35, 0xBA, 0xD4,
-    0x62, 0xF1, 0xE2, 0xAD, 0xFA, 0x12, 0x30, 0xD2, 0x87, 0x0C, 0xA6, 0xB4, 0x34, 0x51, 0x8D, 0x59,
-    0x9D, 0x2E, 0x90, 0x96, 0x22, 0x64, 0x4A, 0x08, 0x95, 0xF7, 0x8F, 0x2F, 0x99, 0x99, 0xE9, 0xD1,
-    0x44, 0xB5, 0x45, 0xD5, 0xBE, 0x2C, 0xCC, 0x60, 0x7A, 0x9B, 0x73, 0xB9, 0xA7, 0x5D, 0xFC, 0x1F,
-    0x23, 0xC6, 0x8B, 0xE9, 0x06, 0x9D, 0xD7, 0xFE, 0x5E, 0x0B, 0xB1, 0xFE, 0x09, 0x16, 0x33, 0x2B,
-    0xE6, 0x48, 0xD0, 0xC9, 0xF8, 0x42, 0x6F, 0x81, 0xBC, 0x52, 0xA0, 0x9F, 0x42, 0xF0, 0x0E, 0x44,
-    0x81, 0xC1, 0x28, 0x5B, 0x36, 0x87, 0x24, 0x24, 0x32, 0xA6, 0x62, 0xB5, 0x29, 0x1A, 0x2A, 0x87,
-    0xE2, 0xDF, 0xE1, 0x84, 0x26, 0x3E, 0xB6, 0x90, 0xAB, 0x98, 0xA6, 0xA2, 0x05, 0x9B, 0x60, 0xA2,
-    0x4B, 0xEB, 0x59, 0x54, 0x38, 0x00, 0x14, 0x60, 0x34, 0x90, 0xEE, 0x8A, 0x57, 0xE5, 0xF2, 0x7B,
-    0x4A, 0x8F, 0xC6, 0x87, 0x1C, 0xAC, 0x0D, 0x09, 0x14, 0x31, 0x44, 0x48, 0xE9, 0x69, 0x78, 0xDB,
-    0x44, 0xA5, 0x1A, 0x64, 0xB2, 0x9E, 0xA8, 0x8C, 0x78, 0x5B, 0x32, 0x3E, 0x6C, 0x1A, 0x31, 0x38,
-    0x5B, 0x15, 0x83, 0x98, 0x3B, 0xE9, 0x58, 0xE1, 0xC5, 0x58, 0x81, 0x17, 0xF9, 0x1B, 0x2D, 0x95,
-    0x8C, 0x74, 0xF7, 0xAB, 0x34, 0x85, 0x0C, 0x49, 0x00, 0x57, 0x46, 0x59, 0x82, 0xA1, 0xBF, 0x43,
-    0xD8, 0x84, 0x34, 0xED, 0x47, 0x8A, 0x3D, 0x32, 0x23, 0x4B, 0xD7, 0xC5, 0xCA, 0xA8, 0xE1, 0x23,
-    0x32, 0x5F, 0x2B, 0x05, 0xFB, 0xFF, 0xF2, 0xFB, 0x22, 0x9C, 0x9F, 0xCA, 0x0F, 0xAF, 0xCF, 0xCF,
-    0xFA, 0x6C, 0xA0, 0xCF, 0xBC, 0x09, 0xD8, 0xED, 0xF2, 0xF7, 0xA1, 0xDD, 0x3E, 0xD9, 0x95, 0xF0,
-    0x94, 0xCD, 0x18, 0x55, 0x50, 0xEC, 0xA5, 0x35, 0xDA, 0x07, 0x0E, 0x69, 0x9E, 0xF9, 0x69, 0x9C,
-    0xF8, 0x73, 0x2E, 0x6B, 0xCA, 0x03, 0x27, 0x1E, 0xCD, 0x2C, 0x86, 0x33, 0xDC, 0x65, 0x51, 0x34,
-    0x3A, 0xA9, 0xF0, 0x26, 0x65, 0xC4, 0xFB, 0x4D, 0xC8, 0xC9, 0x9B, 0x5A, 0x58, 0x1C, 0x52, 0xD7,
-    0x8D, 0x96, 0x11, 0x2B, 0x17, 0xD2, 0x5C, 0x2D, 0x0F, 0x0C, 0xE2, 0x1D, 0xB9, 0xD5, 0x22, 0xD2,
-    0xC5, 0xFD, 0x96, 0x7B, 0x2C, 0xD7, 0x49, 0x67, 0x09, 0xAA, 0x7B, 0xFA, 0xCF, 0xBE, 0xC7, 0xEC,
-    0x48, 0x53, 0xBF, 0x51, 0x61, 0x46, 0x67, 0x12, 0xCA, 0x63, 0x99, 0x90, 0xE5, 0x77, 0x3E, 0x2C,
-    0x1D, 0x6B, 0xD0, 0x0A, 0x1E, 0x7B, 0x1E, 0xCC, 0xA1, 0x1C, 0xD9, 0x50, 0x52, 0x1B, 0x0A, 0x39,
-    0x48, 0xAB, 0xD8, 0xC2, 0xAA, 0x29, 0x41, 0x49, 0xDC, 0xCB, 0x32, 0x68, 0xD6, 0x50, 0x18, 0xF4,
-    0x4B, 0xA3, 0xC2, 0xCC, 0xDF, 0x59, 0xAA, 0x99, 0x34, 0xAA, 0x74, 0x36, 0xDE, 0x23, 0xB8, 0x18,
-    0x14, 0x4F, 0x58, 0x9C, 0x54, 0x59, 0xD4, 0xB5, 0x9D, 0xB1, 0x9F, 0xAD, 0x2A, 0x11, 0x5A, 0xCC,
-    0x49, 0x96, 0xB0, 0x22, 0xFA, 0x5D, 0x59, 0x68, 0xF9, 0x9B, 0x30, 0x0F, 0x61, 0x35, 0xD5, 0x87,
-    0xEA, 0x95, 0xC0, 0x35, 0x37, 0xA1, 0xC3, 0xEC, 0x85, 0xE9, 0x73, 0xE5, 0xD9, 0xDA, 0xDC, 0x11,
-    0xC3, 0x24, 0x59, 0xC2, 0x31, 0x0D, 0xAB, 0x80, 0x1D, 0xFB, 0x37, 0xE8, 0xD1, 0x8C, 0xCA, 0x0B,
-    0x83, 0x0F, 0x62, 0x61, 0x6E, 0x83, 0x2A, 0x87, 0x50, 0x18, 0xA2, 0xBA, 0xDA, 0xAD, 0xB2, 0x7B,
-    0x2F, 0x4D, 0xD6, 0x82, 0x28, 0x8C, 0x4B, 0x60, 0x3C, 0x58, 0xA1, 0xA2, 0x62, 0xA1, 0x6A, 0x92,
-    0xA3, 0xC1, 0xDF, 0xB5, 0xAE, 0xB7, 0x4B, 0x1F, 0xCC, 0x2A, 0xFD, 0x63, 0x48, 0x6F, 0xB3, 0x8A,
-    0x4F, 0x8C, 0x9E, 0xC1, 0x12, 0x58, 0xFA, 0x98, 0xB3, 0xC1, 0x5F, 0x59, 0x34, 0xD0, 0xFA, 0xC6,
-    0xA2, 0xAA, 0x6E, 0xFB, 0xC1, 0x94, 0x8D, 0x1C, 0x43, 0xE4, 0x5F, 0xEA, 0xCB, 0x5F, 0x0A, 0x6F,
-    0xC0, 0x47, 0x5A, 0xD5, 0x7D, 0xC1, 0x28, 0x36, 0x36, 0xDC, 0x92, 0x15, 0x31, 0x69, 0x43, 0xC5,
-    0x0F, 0x63, 0xB5, 0x40, 0xCF, 0xD9, 0x34, 0xD3, 0x18, 0xD1, 0x13, 0x71, 0x32, 0xBD, 0xA8, 0x72,
-    0x6B, 0xA8, 0xAF, 0x88, 0x7B, 0x1E, 0xD2, 0x95, 0xE4, 0x3C, 0xC3, 0x29, 0xEF, 0x4B, 0xF3, 0xB8,
-    0x6D, 0xA9, 0x9A, 0xE3, 0x62, 0x25, 0x46, 0x80, 0x54, 0xAA, 0x0A, 0xFE, 0x62, 0xEB, 0x09, 0xAC,
-    0xA5, 0x07, 0x5E, 0x17, 0xB8, 0xF4, 0x1B, 0xDE, 0xC0, 0xF3, 0xBD, 0x29, 0x94, 0x87, 0x86, 0x40,
-    0x4C, 0xBB, 0x10, 0x2C, 0x02, 0xA8, 0x06, 0x70, 0x5D, 0x7F, 0x7B, 0x93, 0x2E, 0x0E, 0xB6, 0x96,
-    0x2D, 0x76, 0x7F, 0x31, 0xD8, 0xC4, 0xB5, 0x9D, 0xE8, 0x3C, 0xCC, 0x5B, 0x51, 0x0A, 0x0C, 0x41,
-    0x3E, 0x08, 0x19, 0x2C, 0xE7, 0x18, 0x14, 0x4F, 0x38, 0x67, 0x5C, 0x81, 0x01, 0x03, 0xF8, 0xAA,
-    0xAD, 0x45, 0x79, 0xB1, 0x56, 0xAE, 0x41, 0x9E, 0x9C, 0x7C, 0x5D, 0x83, 0x9A, 0x81, 0x60, 0x31,
-    0xA9, 0x38, 0x47, 0xD4, 0xA7, 0x46, 0x85, 0x98, 0x63, 0x4F, 0x4A, 0x8E, 0x0D, 0x74, 0xB9, 0x1A,
-    0xE8, 0xB7, 0x99, 0x42, 0x8B, 0xAD, 0x2D, 0x0F, 0xB5, 0x68, 0xE2, 0xD3, 0x82, 0xAD, 0xC5, 0xD6,
-    0x33, 0x02, 0x53, 0xB5, 0x9C, 0x63, 0x39, 0x63, 0x6D, 0x16, 0x49, 0x93, 0xA0, 0xF0, 0xE1, 0x00,
-    0x16, 0x0F, 0x25, 0xFB, 0xFD, 0x1E, 0x2D, 0x6C, 0xA3, 0x05, 0x3D, 0xAF, 0x0F, 0x96, 0x69, 0x19,
-    0xC3, 0x9A, 0xE6, 0x07, 0x46, 0xD0, 0xBE, 0x48, 0xB4, 0x64, 0x44, 0x03, 0x1D, 0x53, 0x38, 0x5C,
-    0x14, 0x5C, 0xFF, 0x2C, 0x2C, 0xBC, 0xB4, 0xB6, 0xAA, 0x64, 0x8B, 0x35, 0xFD, 0xBA, 0xB4, 0x16,
-    0x94, 0xDC, 0x5A, 0x49, 0x5C, 0x8E, 0x24, 0xB8, 0x0A, 0x17, 0x41, 0xB2, 0xB6, 0x8C, 0xD2, 0xE9,
-    0xC0, 0x8B, 0x99, 0xC8, 0x46, 0x31, 0x30, 0x51, 0x2C, 0xA1, 0xAF, 0xD3, 0x1F, 0xF9, 0x6D, 0xBD,
-    0x5F, 0x61, 0x43, 0xFC, 0x08, 0xF9, 0xA8, 0x15, 0xA6, 0xE9, 0x6C, 0xA5, 0xD6, 0x59, 0x10, 0xDD,
-    0x97, 0x1F, 0x9C, 0x5F, 0xEC, 0x26, 0x73, 0x4C, 0xA6, 0x33, 0x0B, 0xDD, 0x65, 0x58, 0x16, 0xD7,
-    0x02, 0xFF, 0x6F, 0x5F, 0xDC, 0xEF, 0xC2, 0xC9, 0xD1, 0xAA, 0xE5, 0xF2, 0x9C, 0x36, 0xAC, 0xE9,
-    0xF3, 0xE4, 0xF9, 0x95, 0xF5, 0x4F, 0x2A, 0x2D, 0x27, 0x25, 0xC1, 0x54, 0x1D, 0xFD, 0x5A, 0x77,
-    0x87, 0x55, 0x75, 0x7A, 0x54, 0x16, 0x3A, 0x4E, 0xCE, 0x2D, 0xBF, 0x57, 0x41, 0x88, 0x70, 0x33,
-    0xFB, 0xCC, 0x43, 0x17, 0xA9, 0x6D, 0x3A, 0x09, 0x42, 0x85, 0x9B, 0xD9, 0x6A, 0x1D, 0xC6, 0x57,
-    0x84, 0x56, 0x25, 0x0F, 0xC7, 0xF9, 0xCA, 0x41, 0x21, 0x14, 0x67, 0x73, 0x6B, 0x5A, 0x77, 0x23,
-    0xFC, 0xEE, 0x43, 0x0A, 0x9B, 0x05, 0x1E, 0xD5, 0xDF, 0xF0, 0xFF, 0xD0, 0xDF, 0xE5, 0xB6, 0x93,
-    0x04, 0xA9, 0xD6, 0x08, 0xE6, 0x95, 0x91, 0xA8, 0x21, 0x05, 0xAC, 0xC4, 0x42, 0xB1, 0xF8, 0x10,
-    0x77, 0x5F, 0xBC, 0x47, 0x5C, 0x7E, 0x93, 0x8C, 0xF1, 0x06, 0x39, 0xE6, 0x15, 0x46, 0xE1, 0x48,
-    0x7B, 0xB1, 0x90, 0x99, 0x83, 0x18, 0x34, 0xE8, 0xB2, 0xEE, 0x20, 0xA5, 0xF6, 0xAA, 0x14, 0x03,
-    0x3A, 0xCC, 0x77, 0xE5, 0x0A, 0x25, 0x8E, 0x61, 0xF8, 0x39, 0x7F, 0xEE, 0xC5, 0x53, 0xCF, 0x3C,
-    0xEE, 0xBE, 0xE2, 0xDA, 0x0A, 0xD9, 0x52, 0x0F, 0xFC, 0x63, 0x7D, 0xFC, 0x2F, 0xF7, 0xCB, 0xA0,
-    0x2D, 0x17, 0x35, 0xBD, 0x6F, 0xFB, 0x48, 0xD1, 0xC6, 0xDF, 0xF7, 0x8C, 0xD0, 0x5A, 0x93, 0xA2,
-    0x97, 0x13, 0x48, 0xE1, 0xDD, 0xE5, 0x00, 0x08, 0x65, 0xC9, 0x86, 0x6B, 0x69, 0x5C, 0xC2, 0x05,
-    0x7E, 0x71, 0x25, 0x6A, 0x47, 0xBE, 0x00, 0x4F, 0x60, 0x92, 0xBC, 0x2C, 0xBF, 0xE7, 0x87, 0xB9,
-    0x7D, 0xEF, 0x8E, 0x5F, 0x0A, 0xB0, 0x77, 0x9F, 0xFA, 0x81, 0x25, 0x9A, 0x01, 0x6D, 0x41, 0xC2,
-    0x4B, 0xB6, 0x9C, 0x78, 0x2C, 0xBA, 0x51, 0x85, 0xE5, 0xAD, 0x82, 0x90, 0x79, 0x74, 0x75, 0xDE,
-    0x2F, 0x6A, 0xDA, 0x3A, 0x70, 0xBF, 0x16, 0xBD, 0x31, 0xAC, 0x0A, 0xCA, 0x54, 0x34, 0xFD, 0x1A,
-    0xE1, 0xF4, 0x2D, 0x58, 0x55, 0xF1, 0x4B, 0x26, 0xC4, 0x0F, 0x76, 0x2D, 0xE8, 0xC8, 0xC0, 0xE5,
-    0xC3, 0x1D, 0xA3, 0x14, 0x6B, 0xD9, 0x24, 0xE0, 0xEC, 0x6E, 0x2F, 0x68, 0xC3, 0x2B, 0x5B, 0x7C,
-    0x6A, 0x1C, 0x68, 0xAD, 0xED, 0xB5, 0xBC, 0x18, 0x83, 0xF8, 0xED, 0x6C, 0x49, 0x5A, 0xD5, 0xB5,
-    0xFC, 0x5D, 0x4A, 0x53, 0xD9, 0x02, 0x71, 0x44, 0x02, 0x39, 0x0A, 0xC4, 0xE0, 0x6A, 0x4E, 0x8B,
-    0x8B, 0xCD, 0x8F, 0x11, 0x26, 0x2F, 0x51, 0xCB, 0xC5, 0xEE, 0xB0, 0x21, 0x84, 0x31, 0x40, 0xE9,
-    0xA3, 0xBD, 0x2F, 0x42, 0x42, 0x24, 0xF8, 0x4F, 0x8E, 0x68, 0x73, 0x20, 0x1B, 0xCF, 0x95, 0xC5,
-    0xEE, 0xCE, 0x2D, 0xBF, 0x5D, 0xB0, 0xE2, 0xD1, 0xB4, 0x06, 0xCA, 0x67, 0x1F, 0x1D, 0xB2, 0x29,
-    0x23, 0x62, 0x8A, 0x5A, 0xCC, 0x30, 0xAB, 0xD2, 0xF6, 0x15, 0x11, 0x48, 0x17, 0x24, 0x34, 0xAA,
-    0x48, 0xB0, 0x28, 0xCE, 0x01, 0x95, 0x03, 0xB7, 0xF2, 0xF1, 0x0C, 0xE2, 0x01, 0x23, 0x1F, 0x04,
-    0xA3, 0x26, 0x98, 0x9D, 0x73, 0xAD, 0x91, 0x57, 0x80, 0x2C, 0x08, 0x1F, 0xED, 0x77, 0xEA, 0xA9,
-    0xBC, 0x7E, 0xF7, 0x81, 0x47, 0xCA, 0x34, 0x13, 0x78, 0xA7, 0x92, 0x95, 0x38, 0x16, 0xDC, 0x47,
-    0x72, 0xCC, 0xE3, 0x00, 0x25, 0xF5, 0x62, 0x79, 0x3A, 0xFB, 0xF3, 0x37, 0xB8, 0xE9, 0xA9, 0xEE,
-    0xDA, 0xA6, 0x18, 0xB8, 0x7E, 0x52, 0xF4, 0xD9, 0x94, 0xED, 0xB2, 0x29, 0x99, 0x58, 0xB2, 0x68,
-    0xAD, 0xDE, 0x56, 0x32, 0x4B, 0x86, 0xC3, 0x5F, 0x01, 0x12, 0x0E, 0x6D, 0x9F, 0xB2, 0x0E, 0x30,
-    0xAB, 0xD6, 0x58, 0xAB, 0x24, 0xBF, 0x3B, 0x43, 0x61, 0xAF, 0x55, 0x87, 0x15, 0x48, 0xED, 0x93,
-    0xDA, 0xE7, 0x43, 0x1B, 0x1F, 0x5B, 0x6C, 0x75, 0xFF, 0xEA, 0x9C, 0x05, 0xB7, 0x75, 0x69, 0x3C,
-    0x94, 0x73, 0x95, 0xA0, 0x8B, 0xDC, 0xCF, 0xB6, 0x94, 0x62, 0x85, 0x1E, 0xA5, 0x00, 0xA7, 0xFE,
-    0xFE, 0x0F, 0xF6, 0xCB, 0xEA, 0x2B, 0x0B, 0x0C, 0x29, 0x6A, 0x64, 0x1F, 0x9B, 0x95, 0x88, 0x54,
-    0xE7, 0x3E, 0x42, 0x4A, 0x71, 0x76, 0x09, 0x27, 0x3B, 0xD7, 0xF9, 0xA7, 0xC9, 0xA0, 0x42, 0xF8,
-    0x81, 0xC6, 0x58, 0x29, 0xC8, 0x96, 0x82, 0xFF, 0xC4, 0x7A, 0x2D, 0xBF, 0xAA, 0xEE, 0x5A, 0x1F,
-    0x42, 0x94, 0xD5, 0xFF, 0x2D, 0x08, 0x3F, 0xB9, 0x2F, 0x73, 0x47, 0x21, 0x33, 0xF9, 0xE8, 0x87,
-    0x56, 0x69, 0x64, 0xBA, 0xDC, 0xDA, 0x3A, 0x86, 0xFF, 0x77, 0x5A, 0x05, 0x61, 0x27, 0x0B, 0x71,
-    0xB0, 0xA3, 0x52, 0xB8, 0xD0, 0xC5, 0x3A, 0x0F, 0x9D, 0x12, 0xF8, 0x23, 0xC1, 0xCB, 0x07, 0xB6,
-    0x6E, 0xED, 0xFB, 0x7D, 0x34, 0x0B, 0x8A, 0xD0, 0xA6, 0x82, 0x75, 0x74, 0x6B, 0x68, 0x64, 0xEF,
-    0x69, 0xD8, 0x50, 0xF8, 0x2F, 0x5A, 0xC4, 0x6C, 0x58, 0x80, 0x29, 0xB9, 0x88, 0xC2, 0x6D, 0x44,
-    0x1C, 0x63, 0xCB, 0x6C, 0xBF, 0x62, 0xE4, 0x64, 0x3A, 0xE1, 0xFF, 0xB9, 0x9D, 0x6C, 0x41, 0xC8,
-    0xF2, 0x35, 0x2E, 0x7E, 0xB7, 0x36, 0x88, 0xE3, 0x75, 0xE1, 0x3F, 0x0E, 0x6B, 0x79, 0xDC, 0x38,
-    0x71, 0x75, 0xD9, 0x4F, 0x42, 0x36, 0xED, 0x67, 0x60, 0xDD, 0xBB, 0xF0, 0x18, 0xF5, 0x06, 0xF1,
-    0xC1, 0x22, 0x99, 0xE4, 0xFC, 0x8C, 0xFB, 0x28, 0x27, 0x61, 0x0F, 0x57, 0xAB, 0x00, 0x86, 0x25,
-    0x2C, 0x78, 0x4C, 0xB8, 0x8C, 0x0D, 0x39, 0x90, 0xDF, 0x64, 0x5A, 0x72, 0xB6, 0x8D, 0x23, 0xCC,
-    0x6F, 0x58, 0x27, 0x5E, 0xB4, 0xEB, 0x69, 0x6B, 0xFB, 0x58, 0xDB, 0xED, 0xB7, 0xA9, 0x9D, 0x6F,
-    0xD1, 0xEA, 0xFD, 0x07, 0x4C, 0xD9, 0x26, 0x5E, 0xF5, 0xC9, 0x12, 0x82, 0x3F, 0xED, 0x6F, 0xA3,
-    0x95, 0x49, 0xF0, 0x9D, 0x52, 0x39, 0x7B, 0x7E, 0x60, 0xA0, 0x17, 0x18, 0x53, 0x3B, 0x30, 0xA3,
-    0x6B, 0xCC, 0x63, 0x41, 0xD5, 0x1A, 0xD5, 0x46, 0x68, 0x8B, 0x50, 0x87, 0xAD, 0xD4, 0xA3, 0xE3,
-    0x82, 0x3B, 0x5D, 0x2F, 0x96, 0x1F, 0x0F, 0x18, 0x64, 0x4D, 0x0A, 0xD3, 0xA0, 0xBF, 0xB0, 0x47,
-    0xA2, 0xAE, 0x56, 0x13, 0x09, 0x5B, 0x1F, 0xA6, 0xBD, 0x8D, 0x15, 0x9A, 0x83, 0x8B, 0xE7, 0x09,
-    0x9E, 0xEA, 0x77, 0xA9, 0x9F, 0x56, 0xFA, 0xF2, 0x85, 0x5B, 0xA3, 0x0B, 0x3B, 0xDA, 0xCC, 0xB6,
-    0xC2, 0x1E, 0x8F, 0x61, 0x3F, 0x7D, 0xC6, 0x37, 0xE7, 0xBD, 0x59, 0x87, 0x8D, 0x2B, 0x0F, 0x6F,
-    0x0A, 0x31, 0x7A, 0xBE, 0xB7, 0x80, 0xB0, 0x75, 0xE4, 0xAC, 0xFA, 0xDD, 0x9F, 0xB2, 0xAD, 0x78,
-    0x56, 0x62, 0x6E, 0x56, 0x20, 0x46, 0x29, 0xDB, 0xAC, 0x2D, 0xF7, 0xE6, 0xAC, 0xB6, 0x73, 0x98,
-    0xD4, 0x84, 0x8E, 0x16, 0x09, 0xA4, 0xD5, 0x5C, 0x36, 0xAD, 0xBB, 0x58, 0xD4, 0xA4, 0xBA, 0x2C,
-    0x7B, 0x44, 0xA2, 0xF2, 0x1D, 0x0C, 0x08, 0x10, 0x8D, 0x09, 0xB9, 0xF5, 0x0B, 0xA0, 0xD1, 0xAB,
-    0xDC, 0xDF, 0x39, 0x70, 0x81, 0x6C, 0x9B, 0x80, 0x27, 0x73, 0xFF, 0x28, 0xE0, 0x69, 0x1B, 0x2F,
-    0x89, 0xB7, 0x2D, 0x3D, 0xA9, 0x76, 0x3B, 0x90, 0xC5, 0x65, 0x13, 0x6D, 0x7F, 0x02, 0x0C, 0xE6,
-    0x23, 0xD7, 0x49, 0x76, 0x99, 0xFF, 0x3E, 0xA0, 0x8D, 0xF3, 0x18, 0x79, 0x9E, 0x96, 0x8B, 0x11,
-    0x99, 0xAB, 0x94, 0x25, 0xC6, 0x17, 0xFC, 0x72, 0x84, 0x1C, 0x50, 0x80, 0x47, 0x9B, 0xE0, 0x72,
-    0x21, 0xFD, 0x64, 0x60, 0x37, 0xB3, 0x6C, 0xA3, 0xA3, 0x05, 0x9D, 0xB9, 0xA5, 0x8F, 0xB5, 0x47,
-    0xA7, 0x1E, 0x9E, 0xF2, 0x6F, 0xBD, 0xC5, 0xAD, 0x39, 0x3B, 0x70, 0x04, 0xDF, 0xBB, 0xFD, 0xB2,
-    0xEB, 0x63, 0x30, 0x84, 0xAA, 0x60, 0xD4, 0xAB, 0xFD, 0x6B, 0x7E, 0xCC, 0x58, 0x8B, 0x7F, 0x93,
-    0xAB, 0xBE, 0xDB, 0x6B, 0xFE, 0x25, 0x42, 0x26, 0x30, 0xB1, 0x7D, 0x1A, 0x8F, 0x21, 0x54, 0x4E,
-    0x30, 0x53, 0x06, 0x16, 0xC8, 0x59, 0x91, 0xAD, 0xF6, 0xDC, 0x66, 0xC5, 0x22, 0x50, 0x31, 0x29,
-    0xEA, 0x54, 0x2C, 0xFF, 0xC0, 0x7F, 0xC2, 0x76, 0xBC, 0x45, 0x31, 0xC7, 0x69, 0xF3, 0x87, 0x99,
-    0xAC, 0xBC, 0x39, 0x9F, 0x14, 0x95, 0x2E, 0x15, 0x08, 0x5E, 0x4D, 0x36, 0xFD, 0x03, 0xC3, 0x69,
-    0x93, 0x73, 0xD0, 0x78, 0x18, 0xA9, 0xB9, 0x1E, 0x86, 0x93, 0x40, 0x67, 0x33, 0x1A, 0x09, 0xA8,
-    0x61, 0x02, 0x57, 0xEE, 0x3A, 0x75, 0x4A, 0x51, 0xE7, 0x54, 0x6B, 0xD3, 0xD7, 0xFC, 0x7B, 0xAA,
-    0x10, 0xEF, 0xA0, 0x2B, 0x3F, 0x27, 0x4C, 0x43, 0xAA, 0x76, 0xCB, 0x00, 0x1D, 0xFC, 0x87, 0x85,
-    0x8B, 0xD1, 0xE2, 0xBA, 0xAD, 0xA6, 0xFA, 0x55, 0x6D, 0x2C, 0x76, 0xA6, 0xF3, 0xE3, 0xF4, 0x9F,
-    0x77, 0x7F, 0x06, 0x51, 0xFC, 0x5C, 0x32, 0x3C, 0xBE, 0xA1, 0x82, 0x33, 0xC0, 0xC7, 0xD2, 0xED,
-    0x35, 0x42, 0x28, 0xA4, 0x91, 0xCF, 0x03, 0xE8, 0x77, 0x11, 0x18, 0xC3, 0xC0, 0x58, 0xBB, 0x65,
-    0x6B, 0x5F, 0xC3, 0x13, 0x0B, 0xB7, 0x84, 0x8F, 0x74, 0xA5, 0x77, 0xE9, 0x46, 0xD7, 0x99, 0x66,
-    0xD2, 0xD1, 0x7F, 0xC3, 0x6D, 0xE5, 0xDF, 0xE3, 0xE8, 0x4B, 0x4E, 0x47, 0x3B, 0xB0, 0xFC, 0xFD,
-    0x89, 0x15, 0x15, 0xAC, 0x80, 0x6E, 0x14, 0xE9, 0xF2, 0x01, 0x1C, 0xE1, 0x26, 0x98, 0xFB, 0x16,
-    0x61, 0x88, 0x9E, 0xFD, 0x3D, 0x58, 0xD6, 0xA9, 0x27, 0xFC, 0x47, 0x7E, 0xC9, 0x48, 0x8D, 0x46,
-    0xA5, 0xE4, 0x43, 0xAA, 0x85, 0x4A, 0x1D, 0x39, 0xFB, 0x89, 0x06, 0x65, 0x7A, 0x4E, 0x49, 0x5B,
-    0x9C, 0x02, 0xA5, 0x76, 0x12, 0x0C, 0xB4, 0x05, 0x25, 0xC0, 0xE4, 0x5F, 0xE5, 0x72, 0xDD, 0xAF,
-    0x6B, 0x82, 0xB5, 0x12, 0x80, 0xF6, 0x8E, 0xA8, 0xE8, 0xF6, 0x78, 0x75, 0x1B, 0xC3, 0xAE, 0x4D,
-    0x58, 0x52, 0xAB, 0x34, 0xFC, 0xDB, 0x56, 0x6D, 0x73, 0xC1, 0x81, 0xDC, 0xB5, 0xD3, 0x1F, 0xBA,
-    0xCF, 0x27, 0x54, 0xED, 0x9E, 0x50, 0x71, 0xDB, 0x7C, 0x7F, 0x96, 0x50, 0x35, 0x8F, 0x10, 0x2A,
-    0x88, 0x57, 0x79, 0xBA, 0xCF, 0xAC, 0x2C, 0x98, 0x75, 0x69, 0x0F, 0x24, 0xC1, 0xB8, 0x09, 0x63,
-    0xE4, 0xAD, 0x97, 0x44, 0xD0, 0x2D, 0x3D, 0x97, 0x0F, 0x1A, 0x73, 0x58, 0xD6, 0xB4, 0xA2, 0x0C,
-    0xCB, 0x7A, 0x9D, 0xBB, 0x70, 0x7A, 0x1A, 0x76, 0x69, 0x5C, 0x1F, 0x93, 0x89, 0x16, 0xF3, 0x0B,
-    0xD8, 0xD8, 0x7C, 0xCD, 0xBF, 0x0D, 0xEB, 0x93, 0x78, 0xED, 0x53, 0x55, 0xA6, 0x92, 0xC1, 0xCE,
-    0x8A, 0x76, 0xF1, 0xBA, 0x5B, 0x45, 0xF0, 0xC9, 0xCC, 0xC9, 0xD6, 0xD1, 0xB6, 0x86, 0x3B, 0xD2,
-    0x86, 0x2D, 0x6D, 0x55, 0x6B, 0x90, 0xD1, 0xAE, 0xD8, 0x5C, 0xA5, 0xA9, 0x51, 0x61, 0xAF, 0xFE,
-    0xB0, 0x05, 0xED, 0x8A, 0x49, 0x52, 0x2E, 0x8A, 0xEB, 0x7A, 0xED, 0x48, 0xD9, 0x5A, 0x41, 0x4F,
-    0xE5, 0x7E, 0x9E, 0x41, 0xCC, 0xF9, 0x3B, 0xE8, 0xA7, 0xC5, 0xBC, 0x94, 0x03, 0x12, 0x70, 0x84,
-    0x24, 0x19, 0x44, 0xA9, 0xB5, 0x99, 0x39, 0xEC, 0x8B, 0xE0, 0x3E, 0x1C, 0x72, 0xF3, 0xE2, 0xB0,
-    0x5D, 0x19, 0x3C, 0x60, 0x2C, 0x6C, 0x73, 0xCC, 0x78, 0xEA, 0x3F, 0x7A, 0x39, 0x52, 0xD9, 0xA5,
-    0x91, 0x4C, 0xF6, 0x36, 0xE8, 0x4C, 0xAD, 0xD0, 0x26, 0xF5, 0x90, 0x4F, 0xE6, 0xD3, 0xA6, 0x2F,
-    0x26, 0x50, 0x67, 0x5B, 0x37, 0x84, 0xB1, 0x2F, 0xA6, 0xB0, 0x4B, 0x07, 0x70, 0x86, 0x8C, 0x48,
-    0x5C, 0x31, 0x56, 0x12, 0xB5, 0xB6, 0xFF, 0x32, 0x63, 0x4E, 0x25, 0x1F, 0xA5, 0x41, 0xB1, 0xD8,
-    0x36, 0x44, 0xDA, 0xF6, 0x80, 0x5F, 0x89, 0x42, 0x51, 0xA1, 0xAD, 0x0A, 0xDA, 0xCC, 0x85, 0x29,
-    0xA8, 0x47, 0x19, 0x18, 0x37, 0x54, 0x14, 0xB4, 0xED, 0xCD, 0x83, 0xE9, 0xF7, 0xB3, 0xA9, 0x78,
-    0xFB, 0x3E, 0xA8, 0x21, 0x01, 0x85, 0xCB, 0x24, 0x60, 0x95, 0x20, 0x5F, 0x3D, 0xAB, 0x6B, 0x33,
-    0x7D, 0x2B, 0x5A, 0xA3, 0x11, 0x61, 0x0B, 0xC1, 0xA5, 0xC4, 0x8D, 0x5D, 0x3E, 0x7F, 0x53, 0x7B,
-    0xE5, 0x14, 0x04, 0xDB, 0x5E, 0xF8, 0x25, 0x63, 0xCE, 0x18, 0x8C, 0x72, 0x0A, 0x02, 0xF5, 0x93,
-    0x9C, 0xE1, 0xD0, 0x22, 0xFB, 0xFA, 0x98, 0x93, 0x7E, 0x77, 0x0A, 0xF9, 0x70, 0x66, 0x64, 0xB3,
-    0x09, 0x79, 0xAF, 0x2C, 0x24, 0xED, 0xCF, 0xED, 0x81, 0x82, 0x1E, 0x1B, 0x6E, 0x61, 0xBC, 0xC2,
-    0xDA, 0x93, 0xF3, 0x1F, 0x33, 0x75, 0xDF, 0xE6, 0xD3, 0x35, 0x32, 0x0C, 0x6E, 0x27, 0x16, 0xB9,
-    0xEE, 0x44, 0x2E, 0xB9, 0xEB, 0x06, 0x53, 0x9A, 0x32, 0x1D, 0xC8, 0x69, 0x83, 0xD9, 0x04, 0x07,
-    0xE5, 0x34, 0x61, 0x1C, 0x35, 0x66, 0x1E, 0xA8, 0x09, 0x41, 0xF2, 0xC1, 0x2F, 0x39, 0x22, 0xCC,
-    0x54, 0xD7, 0x6F, 0xB3, 0xDA, 0x54, 0x5F, 0xBD, 0xAB, 0xDD, 0x9B, 0x6F, 0x78, 0x89, 0xD5, 0x19,
-    0xF7, 0xDD, 0x96, 0xB6, 0x78, 0x2A, 0xC3, 0x2A, 0x7B, 0xC5, 0x2C, 0x88, 0xF6, 0xEA, 0x23, 0xC1,
-    0x92, 0xF0, 0xC3, 0x1D, 0x83, 0x29, 0x9E, 0x04, 0xA0, 0xD1, 0x3A, 0x08, 0x40, 0x40, 0x91, 0x9F,
-    0x82, 0x1F, 0xDF, 0x9F, 0xAC, 0xF8, 0x12, 0x02, 0xD6, 0x7E, 0x35, 0xAB, 0xDA, 0xD3, 0xB9, 0xB0,
-    0x21, 0xD1, 0x8A, 0xA0, 0x2C, 0xA7, 0x4D, 0x98, 0x97, 0x3F, 0xAF, 0xDF, 0xD7, 0xDA, 0x6A, 0xEC,
-    0xDB, 0x17, 0x00, 0x5F, 0x7E, 0xCE, 0x09, 0xB8, 0x03, 0x90, 0x0B, 0x04, 0xE1, 0xD2, 0x01, 0x83,
-    0xD6, 0xF9, 0x60, 0x03, 0xB1, 0x16, 0x72, 0x30, 0x25, 0xEE, 0x02, 0x12, 0x4A, 0x6F, 0xA5, 0x09,
-    0x2B, 0xA0, 0x69, 0xBF, 0xDE, 0x90, 0x59, 0x3A, 0x28, 0x9F, 0xE0, 0xDC, 0x40, 0x31, 0x1B, 0x6D,
-    0x6E, 0xE3, 0xF4, 0xC0, 0xA4, 0x12, 0x45, 0xCF, 0xC1, 0x18, 0xE1, 0x55, 0xC5, 0xF3, 0xBB, 0x16,
-    0x9F, 0xF9, 0x8F, 0x29, 0x36, 0x59, 0xEB, 0xF6, 0x9E, 0xCC, 0xF8, 0x69, 0xA8, 0x53, 0x8C, 0x67,
-    0xB8, 0x2A, 0x1D, 0xFE, 0x8B, 0xCA, 0x34, 0xE3, 0xE5, 0xD6, 0xB4, 0x47, 0xA2, 0x50, 0xB1, 0x29,
-    0x43, 0x01, 0x74, 0xBF, 0x2D, 0xAB, 0x62, 0xBE, 0x00, 0x71, 0xFD, 0x0B, 0x33, 0x0B, 0x89, 0x24,
-    0xE6, 0x00, 0x97, 0xF9, 0x79, 0x58, 0x1E, 0x80, 0xB0, 0x89, 0xB9, 0xA9, 0xCA, 0xDD, 0xCC, 0xC6,
-    0x95, 0x2D, 0x86, 0xAA, 0x5F, 0x30, 0x16, 0x95, 0xFB, 0xDA, 0x2E, 0xE1, 0x3F, 0x04, 0xA5, 0xDB,
-    0xD4, 0x7F, 0x3F, 0xA7, 0xDF, 0x90, 0xFF, 0xC0, 0x7B, 0xEA, 0x5F, 0x70, 0x01, 0xBB, 0xAB, 0xFD,
-    0x21, 0x2A, 0xB9, 0x50, 0xC7, 0xB4, 0x1A, 0x40, 0xEC, 0x5F, 0x0C, 0xE9, 0x75, 0x48, 0x9A, 0x59,
-    0x36, 0x8C, 0xA7, 0x90, 0x73, 0xD7, 0xDD, 0x99, 0x2C, 0x3A, 0x24, 0xCC, 0xE6, 0xC0, 0x5D, 0xD8,
-    0x8B, 0xBF, 0xEE, 0xF8, 0xDF, 0xDF, 0x19, 0x52, 0x76, 0xB7, 0x6F, 0x73, 0xBD, 0xB0, 0x0B, 0x3B,
-    0xE3, 0x7D, 0xD8, 0x26, 0x9F, 0xDD, 0x3B, 0x26, 0xD3, 0x25, 0x40, 0x57, 0x96, 0x64, 0x5B, 0x0A,
-    0x62, 0xFF, 0xB2, 0x01, 0x20, 0x85, 0xFF, 0x70, 0x8F, 0xDB, 0xA7, 0xFC, 0x46, 0xBB, 0x0F, 0xFF,
-    0xE6, 0x82, 0xD8, 0xC3, 0xBF, 0x87, 0x47, 0x7E, 0x27, 0x67, 0x7F, 0x7F, 0xE1, 0xE5, 0x75, 0x02,
-    0x14, 0xD7, 0x26, 0x49, 0x13, 0x3D, 0xE7, 0x6D, 0xEC, 0x91, 0xFD, 0x0F, 0x12, 0x57, 0x20, 0x25,
-    0xB7, 0x68, 0xFE, 0xCE, 0xF4, 0x43, 0xBE, 0xA8, 0x7A, 0x49, 0x17, 0xDE, 0xBD, 0x15, 0xBA, 0x33,
-    0x5B, 0x9B, 0xB0, 0x6D, 0x36, 0xA6, 0xB1, 0x38, 0x3C, 0xBE, 0xBE, 0x93, 0xF0, 0x56, 0xC9, 0x73,
-    0x94, 0x6A, 0x2E, 0x73, 0x17, 0x94, 0x0C, 0xB7, 0xD2, 0x7A, 0xC2, 0x3E, 0x13, 0x23, 0x37, 0x6E,
-    0xE0, 0x50, 0x05, 0xB8, 0xD0, 0x3B, 0x9E, 0xC9, 0xC7, 0xE8, 0x61, 0x20, 0x6F, 0x90, 0x6F, 0x45,
-    0x8D, 0xFB, 0xDB, 0xEA, 0xFF, 0x00, 0xDD, 0x5B, 0x3D, 0xAC, 0xDE, 0xD6, 0x79, 0x3E, 0x24, 0x7D,
-    0x2F, 0x6B, 0x33, 0x29, 0x35, 0x48, 0x6D, 0x1A, 0xA5, 0xA1, 0x87, 0x00, 0x0D, 0x82, 0xC6, 0xCC,
-    0x90, 0x21, 0x83, 0x6D, 0xB2, 0xF6, 0x90, 0x21, 0x28, 0x22, 0xA0, 0x52, 0x8A, 0x22, 0x83, 0x3B,
-    0x04, 0x05, 0xEA, 0x0E, 0xEA, 0xE8, 0xC1, 0x31, 0x3F, 0xD8, 0xA3, 0x87, 0x68, 0x68, 0x9B, 0x31,
-    0x1E, 0x32, 0x04, 0x37, 0x83, 0x3C, 0x78, 0x70, 0x00, 0x49, 0x64, 0xA4, 0x41, 0x43, 0x06, 0x33,
-    0x71, 0xDB, 0x0C, 0x19, 0xC4, 0xC2, 0x4E, 0x03, 0x44, 0x83, 0xE8, 0x98, 0x8E, 0x29, 0x89, 0xE4,
-    0xE9, 0xF3, 0x3C, 0x2F, 0xBF, 0xFB, 0x63, 0x5D, 0x79, 0x6A, 0xAB, 0x58, 0x1F, 0xEE, 0xE5, 0xF7,
-    0x43, 0xF2, 0x9C, 0xF7, 0xFF, 0x9F, 0xCE, 0x39, 0x17, 0xCC, 0x2E, 0xF6, 0x2E, 0xF1, 0x2E, 0x5D,
-    0x5C, 0x32, 0xB9, 0xE0, 0x82, 0xE3, 0xEB, 0x84, 0x0B, 0x7B, 0x17, 0xF7, 0x2E, 0xE9, 0x5D, 0x8A,
-    0xBF, 0xCE, 0x65, 0x9D, 0xCB, 0x3B, 0x57, 0xB4, 0xFC, 0xAB, 0x1A, 0x57, 0x37, 0xCE, 0x37, 0x81,
-    0xDF, 0x84, 0x7E, 0x13, 0xF9, 0x72, 0x7F, 0x81, 0x6C, 0x72, 0xF9, 0xE0, 0x72, 0x5B, 0x83, 0xAF,
-    0xA2, 0xC4, 0xA1, 0xE2, 0xA7, 0x9A, 0x87, 0x85, 0x87, 0x99, 0xBB, 0x4E, 0x3C, 0x8C, 0x38, 0x9C,
-    0xF6, 0x1B, 0x17, 0x7A, 0x3F, 0xBA, 0xDC, 0xFB, 0xC9, 0xD5, 0xDE, 0xCF, 0xA1, 0xBF, 0xF9, 0x8B,
-    0x29, 0xF6, 0x69, 0xF3, 0x78, 0x3A, 0xA5, 0x0D, 0x16, 0x4C, 0x37, 0xAE, 0xE8, 0xB3, 0xD2, 0x15,
-    0x5D, 0x8E, 0xC5, 0xDA, 0x02, 0x8B, 0xB5, 0x4F, 0xF3, 0xF0, 0x5D, 0x1E, 0x2E, 0xE3, 0xB7, 0x7E,
-    0x72, 0x6D, 0x31, 0x4C, 0x71, 0x5F, 0x2C, 0x63, 0xD5, 0x65, 0xDE, 0xFB, 0x4D, 0x82, 0x95, 0x5C,
-    0xE0, 0x7D, 0xE7, 0x5C, 0x76, 0x1B, 0xFB, 0x24, 0xF8, 0xE0, 0xD2, 0x76, 0xFF, 0xD0, 0xE0, 0x90,
-    0xF1, 0x90, 0x6F, 0xB6, 0x70, 0x16, 0xEE, 0xD0, 0x6B, 0x47, 0xC7, 0x9A, 0x10, 0x87, 0x5A, 0x25,
-    0x22, 0x7C, 0xF8, 0xFC, 0x7D, 0x5F, 0x62, 0xDD, 0x12, 0x74, 0x70, 0x7E, 0x03, 0xE2, 0x80, 0x16,
-    0x11, 0x10, 0x29, 0x7A, 0xF7, 0x2F, 0x58, 0x91, 0x28, 0x91, 0x8E, 0x8E, 0x37, 0xF0, 0x18, 0xF8,
-    0xE6, 0x1C, 0xCE, 0x02, 0xA4, 0xD2, 0x11, 0xB0, 0x06, 0xA4, 0xD2, 0x7A, 0xB1, 0x88, 0x11, 0x7A,
-    0xEE, 0x0C, 0x62, 0x8A, 0x5A, 0x84, 0xD1, 0x65, 0x03, 0x8F, 0x29, 0xD7, 0x08, 0xFF, 0x06, 0xC4,
-    0xFA, 0xB6, 0xF3, 0x7C, 0x35, 0x35, 0x8F, 0x7D, 0xCE, 0xE3, 0x10, 0xFB, 0xF2, 0xBC, 0x1F, 0xDC,
-    0x4F, 0xB0, 0x3E, 0xEE, 0xE7, 0x12, 0x27, 0xC0, 0xB0, 0x33, 0xC1, 0x10, 0x4F, 0xB9, 0x7F, 0x75,
-    0x0A, 0x75, 0xA9, 0xAB, 0x48, 0x08, 0x97, 0x8F, 0x09, 0x56, 0x29, 0xDA, 0x08, 0xC7, 0x6A, 0x13,
-    0xCE, 0xE4, 0x05, 0x8F, 0xDE, 0x45, 0xD3, 0xC1, 0x31, 0x1D, 0x88, 0x0F, 0xB0, 0x88, 0x74, 0x2B,
-    0x41, 0x9D, 0x5D, 0xFD, 0x2B, 0x7F, 0x1B, 0xA8, 0xBA, 0xE7, 0xF1, 0xFF, 0x19, 0x6C, 0xF2, 0xA9,
-    0x95, 0x38, 0x00, 0xE2, 0x19, 0xEF, 0xDF, 0xC1, 0x85, 0x85, 0x9F, 0x0B, 0xB2, 0xCC, 0x6F, 0xAA,
-    0x19, 0xB7, 0x42, 0x1A, 0x1A, 0xB0, 0x88, 0x82, 0x90, 0x82, 0x14, 0xBE, 0x23, 0x11, 0x20, 0x1B,
-    0x90, 0x17, 0x50, 0x88, 0x7B, 0x44, 0xFE, 0x59, 0xEC, 0xFD, 0x48, 0x3E, 0xD5, 0x3F, 0xC5, 0x79,
-    0x7F, 0x03, 0x7B, 0xA5, 0x84, 0xD6, 0xB9, 0x73, 0x95, 0xDF, 0xBB, 0x40, 0x8A, 0x90, 0x0A, 0x7B,
-    0x17, 0x97, 0x1F, 0x1B, 0xA9, 0xB0, 0x4C, 0x2D, 0xEA, 0xAD, 0x04, 0x25, 0xA5, 0xDD, 0x96, 0x7C,
-    0xE0, 0xBF, 0x48, 0xB6, 0xAC, 0x50, 0x95, 0xDC, 0x8D, 0xB7, 0x38, 0x2D, 0xC9, 0x77, 0x47, 0x79,
-    0x85, 0xEC, 0x62, 0x73, 0x60, 0x1A, 0x1C, 0xF3, 0xBD, 0xDE, 0xF0, 0xFB, 0xCE, 0x19, 0x77, 0xCC,
-    0x2B, 0xD8, 0xD3, 0x79, 0x70, 0x1B, 0xAC, 0x3E, 0xB8, 0xDE, 0xBE, 0xC7, 0x87, 0xBF, 0x3F, 0xF6,
-    0xDA, 0xFE, 0x4D, 0xF9, 0x4C, 0x30, 0x16, 0x8A, 0x1F, 0x14, 0xA2, 0xAB, 0x06, 0x5C, 0x55, 0x34,
-    0xE0, 0xE8, 0x4B, 0xAE, 0xEE, 0xDD, 0x85, 0xE8, 0x06, 0x30, 0xC8, 0xB0, 0xA5, 0xBB, 0x04, 0x5C,
-    0xC2, 0xBE, 0x18, 0x5C, 0x02, 0xF1, 0x75, 0x79, 0x93, 0x8F, 0xE0, 0x10, 0xF8, 0xEF, 0x37, 0x59,
-    0x0F, 0x99, 0xC8, 0xBA, 0xC0, 0xB7, 0x39, 0xF4, 0x8C, 0x32, 0xEF, 0x5B, 0xF0, 0xA9, 0xBE, 0x86,
-    0xBB, 0xEA, 0xEF, 0x41, 0x64, 0xEB, 0xCB, 0x61, 0xE7, 0x20, 0x0E, 0x0D, 0xF4, 0xCF, 0x97, 0xE9,
-    0x14, 0x91, 0xC8, 0x29, 0x37, 0xCC, 0xC8, 0xF4, 0xC4, 0xBF, 0x0B, 0x40, 0x88, 0x52, 0xD2, 0xE4,
-    0xCF, 0xFA, 0x64, 0xAA, 0x7A, 0xFF, 0xB3, 0x39, 0x1B, 0x8B, 0xD2, 0xE8, 0xE6, 0x76, 0xAF, 0x5C,
-    0x90, 0x74, 0x7A, 0x7E, 0x4F, 0x97, 0x73, 0x75, 0x47, 0xE9, 0x70, 0xE1, 0x64, 0xBA, 0x59, 0xB9,
-    0x48, 0x0A, 0xD3, 0xA4, 0x4D, 0x50, 0x5F, 0x88, 0xBA, 0x0C, 0xCB, 0x8E, 0x61, 0xFF, 0xB4, 0xAB,
-    0x6E, 0x8E, 0x6E, 0x7C, 0x0A, 0x9A, 0x3C, 0xBA, 0x4B, 0x2F, 0xE2, 0xEA, 0xC1, 0xBD, 0xF8, 0x26,
-    0xE4, 0xFF, 0x8C, 0x7B, 0x6A, 0xA4, 0x1A, 0xB8, 0xA7, 0xC7, 0x78, 0x38, 0xF2, 0xC6, 0x1F, 0x9F,
-    0x7A, 0x93, 0x42, 0xE6, 0x9E, 0x7A, 0x31, 0xE2, 0x6E, 0x2F, 0x3E, 0x15, 0xF8, 0xDF, 0x5E, 0x02,
-    0xF2, 0x60, 0xEC, 0xE4, 0xC6, 0xAC, 0xCC, 0xFD, 0x10, 0xF6, 0xD8, 0xE8, 0x1F, 0x5D, 0xDC, 0x46,
-    0xE4, 0x6E, 0xB6, 0x71, 0x06, 0x84, 0x2B, 0x36, 0x8E, 0x2B, 0x24, 0xCB, 0xBF, 0x89, 0xD3, 0xB5,
-    0xC0, 0x75, 0x3B, 0x7B, 0xE5, 0x4A, 0xEA, 0x78, 0x78, 0x13, 0xCA, 0x35, 0x82, 0xDD, 0x43, 0x38,
-    0x27, 0x7D, 0x3C, 0x24, 0x5D, 0x82, 0xA5, 0xD2, 0x36, 0x03, 0xE4, 0xC5, 0x26, 0x6B, 0xEA, 0x32,
-    0xFB, 0x85, 0xFF, 0x6B, 0x10, 0xE6, 0x72, 0xEA, 0xCF, 0x8F, 0xF1, 0x0C, 0x5B, 0x66, 0xF7, 0x9E,
-    0xD8, 0xDD, 0xBB, 0x48, 0x6D, 0x82, 0x08, 0xFB, 0x8D, 0xF1, 0xBA, 0x77, 0x4F, 0x40, 0xFC, 0xA0,
-    0x86, 0xD0, 0xCA, 0xAA, 0x07, 0x61, 0xEB, 0x3E, 0x5E, 0x0F, 0xDE, 0xBE, 0x42, 0x9B, 0xC1, 0xA8,
-    0x7A, 0x48, 0xA1, 0x30, 0x1E, 0x7C, 0x01, 0x57, 0x28, 0xEA, 0x13, 0x4C, 0x21, 0x99, 0x36, 0xC0,
-    0x54, 0xC2, 0xA0, 0x82, 0x1A, 0x8F, 0xB8, 0x73, 0x78, 0x7D, 0x03, 0x52, 0x38, 0x51, 0x7A, 0x7F,
-    0xE6, 0x65, 0x3D, 0x20, 0x05, 0x4E, 0xFA, 0x76, 0xF4, 0x43, 0xF8, 0xA3, 0xC2, 0x2F, 0x00, 0xF1,
-    0x97, 0xDE, 0xBF, 0x87, 0xEB, 0x4E, 0x9D, 0x83, 0xC5, 0x70, 0x27, 0x65, 0x1C, 0x41, 0x44, 0xF0,
-    0x86, 0xCC, 0x48, 0x1A, 0xD8, 0xC1, 0xA0, 0x7F, 0x22, 0xF7, 0xE5, 0x9B, 0x4F, 0x66, 0x37, 0xBB,
-    0x27, 0x5F, 0x88, 0xAF, 0xF6, 0x5F, 0x7E, 0x03, 0x87, 0xB4, 0x8F, 0xAF, 0xB7, 0x29, 0xA1, 0xC4,
-    0xE1, 0x96, 0x4B, 0xDF, 0x88, 0xDF, 0x6A, 0xD2, 0x17, 0xE2, 0x6B, 0xFD, 0xE7, 0x9F, 0xCC, 0x3F,
-    0x98, 0x9F, 0x7C, 0xE2, 0xD4, 0x99, 0x2F, 0xBE, 0x90, 0xC2, 0x68, 0xF5, 0x5C, 0xA5, 0xD5, 0x7A,
-    0xE0, 0x26, 0xD9, 0x83, 0x7D, 0x76, 0xCE, 0x9D, 0xC5, 0xCE, 0xBF, 0xF1, 0x50, 0x74, 0x3F, 0xED,
-    0x70, 0xE7, 0x1D, 0x9E, 0xA5, 0xFD, 0x84, 0x56, 0x4F, 0xC5, 0xAF, 0xEB, 0x5F, 0x8E, 0xE1, 0x52,
-    0xBB, 0xF4, 0x2E, 0x24, 0xB2, 0x2E, 0xD3, 0x9B, 0x53, 0x38, 0x17, 0x77, 0xFC, 0x55, 0x10, 0x3C,
-    0x81, 0x85, 0x38, 0x0D, 0x7E, 0x04, 0x67, 0xEE, 0x8B, 0x19, 0x3E, 0xC4, 0x47, 0x68, 0x50, 0xC9,
-    0x04, 0xDE, 0xF7, 0x62, 0xE7, 0xBE, 0x64, 0xDC, 0x09, 0x40, 0xBD, 0xB3, 0xFB, 0x77, 0xD5, 0xBA,
-    0x6B, 0xFB, 0x82, 0xA5, 0x49, 0x21, 0x07, 0xF8, 0x3D, 0x19, 0xD3, 0x21, 0x2F, 0xF3, 0xF6, 0x8B,
-    0x54, 0xF3, 0x84, 0x96, 0xA2, 0x91, 0xF1, 0xC5, 0xC5, 0x30, 0x3F, 0xB0, 0xD2, 0x54, 0xEC, 0x68,
-    0x39, 0x77, 0x16, 0x7C, 0x1E, 0xCC, 0x86, 0x8E, 0xB6, 0x7C, 0x0D, 0x2E, 0x42, 0xB7, 0xFC, 0x12,
-    0x8D, 0x69, 0xFF, 0xE7, 0x74, 0x4C, 0x59, 0xCB, 0x15, 0x4E, 0x73, 0xED, 0xDE, 0x5D, 0x01, 0x3F,
-    0x09, 0x0E, 0xC0, 0x82, 0xF8, 0x85, 0x3E, 0xF8, 0x27, 0xDF, 0x56, 0x7E, 0x88, 0x40, 0xB5, 0x1D,
-    0x03, 0xB0, 0x0F, 0xA7, 0x68, 0x4E, 0xA7, 0x7C, 0x28, 0xBA, 0xBA, 0x9C, 0xDD, 0x57, 0x0E, 0xD9,
-    0x8C, 0xBA, 0x09, 0xB1, 0x5E, 0x0D, 0xDB, 0x57, 0xD2, 0x58, 0x11, 0x98, 0x89, 0x1F, 0x60, 0xB2,
-    0x32, 0x2E, 0x56, 0xD2, 0x1E, 0xC3, 0x6B, 0x78, 0x77, 0xE8, 0x34, 0xE1, 0xA4, 0xE9, 0x0F, 0xD6,
-    0xD3, 0x2D, 0x4F, 0xE7, 0xB0, 0x1C, 0x3A, 0xED, 0x69, 0x97, 0xCB, 0x9A, 0xA8, 0x7D, 0x50, 0xFB,
-    0xAF, 0x6F, 0x40, 0xC6, 0x1F, 0xC8, 0x17, 0x5C, 0xF7, 0x90, 0x45, 0xDF, 0xF8, 0x31, 0xBA, 0x4D,
-    0xF9, 0x0B, 0x96, 0x1D, 0xBA, 0x83, 0x7A, 0x73, 0xE0, 0x4E, 0x52, 0x61, 0x1C, 0xCF, 0xF7, 0xF3,
-    0x36, 0x07, 0xCE, 0x5A, 0x62, 0x57, 0xD1, 0x39, 0xD1, 0x7F, 0x0C, 0xE4, 0x5C, 0xFD, 0x1A, 0x8F,
-    0x70, 0x96, 0xF0, 0x0A, 0xD7, 0xE5, 0x1B, 0xDE, 0x23, 0x5D, 0xFD, 0x78, 0x99, 0xBA, 0x38, 0x17,
-    0xF2, 0x6C, 0x38, 0x9D, 0x6E, 0x4F, 0xFF, 0x17, 0xAD, 0xBE, 0x4E, 0x17, 0x3A, 0x9D, 0xE8, 0x34,
-    0x7E, 0xBA, 0x46, 0x9B, 0xA7, 0xD3, 0xEE, 0x1F, 0x86, 0xCB, 0xDC, 0x6E, 0x92, 0xBF, 0x2D, 0xCC,
-    0x13, 0xF3, 0xB4, 0x8B, 0x75, 0x3A, 0x3C, 0xE6, 0xF4, 0xAB, 0xF2, 0xD9, 0xD7, 0x75, 0xD1, 0x87,
-    0x90, 0xDC, 0xC7, 0xC9, 0x09, 0x57, 0x7C, 0x9B, 0xC7, 0xD4, 0xDF, 0xA6, 0x00, 0x4A, 0xA0, 0xB7,
-    0x56, 0x3C, 0xEC, 0xAA, 0x77, 0xFC, 0x5B, 0xBE, 0x18, 0xEA, 0x72, 0x65, 0x49, 0x31, 0xEE, 0x2C,
-    0x70, 0xF3, 0xB0, 0xB1, 0x6D, 0xD5, 0xE6, 0xA6, 0xF0, 0xF0, 0xC8, 0xED, 0x79, 0xFF, 0x8A, 0x9F,
-    0x63, 0x3A, 0xCB, 0x26, 0x40, 0x04, 0x34, 0x90, 0xE5, 0x9E, 0x4C, 0x87, 0xE4, 0xD4, 0x25, 0x64,
-    0x80, 0x8A, 0x35, 0x56, 0xFE, 0xF7, 0x94, 0xC0, 0x00, 0x84, 0xA5, 0x78, 0x54, 0xB7, 0x60, 0x71,
-    0x22, 0x68, 0x02, 0x84, 0x60, 0x0A, 0xA7, 0x78, 0x88, 0x26, 0xD8, 0x9E, 0x11, 0x96, 0xA7, 0x4F,
-    0xFA, 0xAC, 0x8B, 0x6F, 0x43, 0x04, 0xE8, 0x7F, 0xEA, 0x61, 0x4B, 0xDB, 0x72, 0x77, 0xAF, 0x6E,
-    0xC0, 0xAF, 0xA6, 0x30, 0x0B, 0x06, 0x08, 0xDD, 0x97, 0xE9, 0x3D, 0x18, 0x52, 0xF5, 0x90, 0x0C,
-    0xC4, 0x50, 0xB0, 0x70, 0x75, 0x9F, 0x42, 0x00, 0x97, 0xD0, 0xB7, 0x21, 0x2E, 0x85, 0x37, 0xE0,
-    0xF7, 0x0A, 0x9A, 0xB6, 0x3D, 0x20, 0xC8, 0xC2, 0x6F, 0x38, 0x74, 0xBC, 0xB0, 0x85, 0x01, 0x06,
-    0x16, 0x27, 0xF7, 0x59, 0x48, 0xBC, 0x1E, 0x11, 0x5B, 0xE9, 0x09, 0xB9, 0x3B, 0xBD, 0xFE, 0x79,
-    0x19, 0x38, 0x4A, 0x92, 0x97, 0x75, 0xED, 0xC9, 0xE6, 0xF5, 0x9C, 0xBE, 0x39, 0x5E, 0x10, 0x10,
-    0xB0, 0x9C, 0xDF, 0xF2, 0x76, 0x55, 0x46, 0x1D, 0x24, 0x33, 0xD4, 0x4F, 0xFE, 0x2C, 0x6B, 0x8C,
-    0x7F, 0xC4, 0x6E, 0x14, 0x32, 0xE2, 0xD8, 0x70, 0x9F, 0x1C, 0x3E, 0x75, 0xE2, 0x57, 0x98, 0xFD,
-    0xC4, 0xE2, 0xA2, 0x05, 0x62, 0x34, 0x64, 0xD8, 0x11, 0xF7, 0xD6, 0x15, 0xC4, 0xA8, 0x44, 0x34,
-    0x99, 0x5F, 0xEF, 0x6B, 0xDF, 0x61, 0xAB, 0xB8, 0xBF, 0x22, 0xFE, 0x36, 0xC1, 0x94, 0xCA, 0xD3,
-    0x80, 0xAA, 0x7F, 0x45, 0x78, 0xA0, 0x3B, 0xD9, 0xAF, 0xCF, 0xFF, 0x3B, 0x45, 0xB1, 0x89, 0x2C,
-    0x54, 0xC2, 0xB9, 0x82, 0xE1, 0x08, 0x01, 0x0E, 0xF6, 0x7E, 0x7C, 0x67, 0x23, 0x45, 0xB7, 0xC0,
-    0x52, 0xE0, 0x63, 0x61, 0x43, 0x46, 0x11, 0x66, 0xB5, 0xD9, 0x92, 0xE3, 0x75, 0x77, 0xEC, 0x4B,
-    0xB1, 0x9D, 0xC8, 0x44, 0x79, 0x13, 0x99, 0x18, 0x54, 0x88, 0x4C, 0xF0, 0xE9, 0x2B, 0x99, 0x88,
-    0xB7, 0xC8, 0x24, 0x45, 0xE1, 0x3E, 0x8A, 0xEB, 0x44, 0x26, 0xC5, 0x16, 0xA4, 0x07, 0xC3, 0x40,
-    0x91, 0x29, 0x19, 0xDD, 0x4A, 0x26, 0x9D, 0x23, 0x99, 0x8A, 0x66, 0x17, 0x2B, 0x82, 0x4C, 0xC9,
-    0x10, 0x12, 0xFB, 0x81, 0xF7, 0xD2, 0x0F, 0x50, 0xF1, 0x9B, 0xBC, 0x2B, 0x5A, 0xC6, 0xD6, 0x7D,
-    0x34, 0x46, 0x33, 0xC8, 0x84, 0x90, 0xEC, 0xF3, 0xAE, 0xB8, 0x8E, 0x0B, 0x09, 0x7F, 0x32, 0x82,
-    0x4C, 0xA4, 0x62, 0xE8, 0xB7, 0x7C, 0x10, 0xCA, 0x24, 0x7A, 0xBE, 0x65, 0xA2, 0x54, 0x9B, 0xE7,
-    0x4C, 0xBB, 0x15, 0x98, 0xBA, 0x95, 0x89, 0x32, 0x01, 0x44, 0x86, 0x2E, 0x4E, 0xE7, 0x22, 0x85,
-    0x44, 0x85, 0xF4, 0x10, 0x9E, 0x4B, 0x6B, 0x9A, 0x0F, 0x2D, 0x8F, 0x27, 0x93, 0x7B, 0xDC, 0x59,
-    0x7C, 0xE9, 0xE8, 0x94, 0x03, 0x29, 0x18, 0x97, 0xCE, 0xF5, 0x09, 0x2B, 0x86, 0xBE, 0x5E, 0xA1,
-    0x48, 0x5B, 0x62, 0x4E, 0x08, 0x65, 0x4B, 0x63, 0xAD, 0x4D, 0xAE, 0x88, 0x3E, 0x50, 0x24, 0xB2,
-    0xD5, 0xCC, 0xAE, 0x71, 0x4C, 0x24, 0x16, 0xB0, 0x4F, 0x20, 0xF2, 0x20, 0x69, 0x44, 0x30, 0xF2,
-    0x2E, 0xEF, 0xD7, 0xA8, 0x34, 0x64, 0xB0, 0x3C, 0x4A, 0xB4, 0x16, 0x59, 0xD5, 0x99, 0x12, 0xF5,
-    0x7C, 0x3D, 0x2B, 0x1B, 0xB9, 0xF1, 0x53, 0x6A, 0xA4, 0x47, 0xC4, 0x52, 0x45, 0x08, 0x76, 0x40,
-    0xAB, 0xEC, 0xEA, 0x48, 0xDF, 0x5E, 0x97, 0xAB, 0x48, 0x01, 0x8A, 0xAC, 0xAD, 0x4C, 0x7A, 0x83,
-    0xE5, 0x5B, 0x73, 0x29, 0x21, 0x49, 0x15, 0x14, 0x2B, 0x9B, 0x91, 0x4C, 0x91, 0x64, 0xCF, 0xEF,
-    0x2D, 0x88, 0xDE, 0x18, 0x9E, 0x32, 0xE9, 0x31, 0x75, 0xE0, 0xBE, 0x6B, 0x24, 0xBF, 0xAC, 0xCC,
-    0xB6, 0xD7, 0xE7, 0x8F, 0x27, 0x16, 0x80, 0x47, 0x68, 0x90, 0x2A, 0x9D, 0x22, 0x71, 0x1E, 0xDD,
-    0x27, 0x2F, 0x90, 0x01, 0x7B, 0xC1, 0xF7, 0x53, 0x5E, 0xC2, 0x69, 0xF9, 0xD3, 0xFE, 0x5F, 0x25,
-    0x7F, 0x08, 0x94, 0x80, 0xEB, 0x33, 0x3E, 0x78, 0xA3, 0x52, 0x2C, 0xF0, 0xB2, 0xA7, 0x7B, 0xEA,
-    0x82, 0x7A, 0xBB, 0x6F, 0xB8, 0x72, 0xE9, 0x25, 0x7B, 0x4B, 0x57, 0xF6, 0x49, 0x54, 0x69, 0x67,
-    0xED, 0xBA, 0x6C, 0x8D, 0x65, 0x4E, 0xAF, 0xA7, 0x77, 0x8F, 0xE5, 0xED, 0xAE, 0xD9, 0xA5, 0xD5,
-    0x1D, 0xB8, 0xCA, 0x9C, 0x62, 0x6A, 0x7E, 0x21, 0xF4, 0x76, 0x6F, 0x61, 0x4B, 0xA6, 0x7E, 0xB6,
-    0x3C, 0xA6, 0x92, 0xBF, 0x28, 0xDE, 0x16, 0xD7, 0x92, 0xD1, 0xC2, 0x70, 0x6F, 0x41, 0x79, 0xDE,
-    0xE5, 0x22, 0x1E, 0x32, 0x0F, 0x99, 0x9A, 0x4D, 0x36, 0x49, 0x58, 0xE8, 0xBE, 0x44, 0x74, 0x09,
-    0xB0, 0xA7, 0xDC, 0x29, 0xB5, 0x58, 0x94, 0x4F, 0x49, 0x32, 0xAB, 0xDF, 0xEE, 0x5D, 0xF4, 0x86,
-    0x4F, 0xD5, 0x0B, 0xA4, 0x98, 0x7E, 0x13, 0x9B, 0xC1, 0xFE, 0xF1, 0xD7, 0xC8, 0xB7, 0x89, 0xBF,
-    0x4D, 0x4F, 0xF2, 0x36, 0xAC, 0x01, 0x23, 0x56, 0xB8, 0x16, 0x8A, 0x75, 0x7B, 0x60, 0xF3, 0xF0,
-    0xBA, 0xBC, 0x06, 0x07, 0x9D, 0x85, 0xE0, 0xCB, 0x4A, 0x8E, 0xD6, 0x58, 0x60, 0x54, 0xF2, 0x76,
-    0xF2, 0xB1, 0xE3, 0x05, 0xFE, 0x21, 0xA2, 0x4A, 0xF0, 0xF7, 0xDB, 0x50, 0x64, 0x25, 0xC3, 0x2A,
-    0x24, 0x93, 0xA1, 0x62, 0x40, 0xD7, 0x8D, 0xB7, 0x7C, 0x2A, 0x1A, 0xE4, 0x76, 0xA1, 0xBB, 0x0F,
-    0x37, 0x55, 0x2E, 0x3B, 0x05, 0x3B, 0xC5, 0x98, 0x1B, 0xB0, 0x37, 0x07, 0x4B, 0x81, 0x04, 0x56,
-    0xF6, 0x8A, 0xA1, 0xF4, 0x7A, 0xDA, 0xB9, 0x8F, 0x79, 0x9D, 0x37, 0x32, 0xE4, 0xC3, 0xAA, 0xDB,
-    0x26, 0x7D, 0x2B, 0x19, 0x72, 0x5B, 0x22, 0x32, 0x32, 0xB8, 0x75, 0xDB, 0xEC, 0x43, 0x09, 0x63,
-    0x34, 0x1B, 0x19, 0xEA, 0x57, 0xB4, 0x5F, 0xDA, 0xEB, 0x6B, 0xB8, 0x18, 0x65, 0x2B, 0x26, 0x7F,
-    0x34, 0xA6, 0x22, 0x03, 0xAC, 0xBE, 0xA8, 0x02, 0xF3, 0xC9, 0xAF, 0x89, 0x5F, 0x4D, 0x95, 0xF9,
-    0xC3, 0xC2, 0x12, 0xE6, 0x78, 0xD9, 0xDB, 0x93, 0x19, 0x6D, 0x64, 0x73, 0x08, 0x52, 0x35, 0x30,
-    0x8C, 0x64, 0x22, 0xAE, 0xFB, 0x0A, 0xA4, 0xF0, 0xFE, 0x82, 0x22, 0x35, 0x90, 0x31, 0x53, 0xCA,
-    0x8E, 0xC8, 0x62, 0x05, 0x6F, 0x4D, 0x56, 0xCB, 0x97, 0xCC, 0x9E, 0xE4, 0x46, 0x8D, 0x6B, 0x02,
-    0x27, 0x37, 0x9E, 0x05, 0x4B, 0x68, 0x1C, 0x7D, 0xE8, 0xA9, 0x11, 0xAC, 0x81, 0xE3, 0x6A, 0x55,
-    0x6A, 0xD3, 0x98, 0xEC, 0x3F, 0x25, 0xEE, 0xCC, 0x4E, 0x25, 0x39, 0x0A, 0x18, 0xE0, 0x0E, 0xF3,
-    0xD2, 0x10, 0xEC, 0x0F, 0xE3, 0x1B, 0xFC, 0xE4, 0x61, 0x25, 0xCE, 0x29, 0x26, 0xB3, 0x67, 0x56,
-    0x65, 0x31, 0x50, 0xA5, 0x92, 0x02, 0x27, 0xA8, 0xD7, 0xE4, 0x16, 0xA0, 0x2C, 0xC1, 0x73, 0x02,
-    0x3C, 0xBB, 0xA5, 0x40, 0x9A, 0x02, 0x04, 0xF7, 0x26, 0x9C, 0xD2, 0xF7, 0xBD, 0xE2, 0x08, 0x00,
-    0x61, 0x29, 0x09, 0x23, 0xAF, 0x6A, 0xB5, 0xE1, 0xF5, 0xCB, 0x7E, 0x75, 0x96, 0xD3, 0xD6, 0xB1,
-    0x15, 0x08, 0x95, 0x45, 0xDF, 0x68, 0x0E, 0xD6, 0xF4, 0xAF, 0xE8, 0x12, 0x03, 0x88, 0x49, 0xFA,
-    0x6D, 0x01, 0x94, 0x2D, 0x7B, 0x46, 0xC8, 0xC0, 0x2C, 0x85, 0xF4, 0xDA, 0xAF, 0x59, 0x9E, 0xFF,
-    0x8F, 0x73, 0x80, 0x15, 0xA1, 0x30, 0xDC, 0x38, 0x6D, 0xCF, 0xA2, 0x7A, 0x11, 0xA8, 0x85, 0x78,
-    0x23, 0x56, 0x8A, 0xA6, 0x90, 0x83, 0x89, 0x0B, 0xED, 0x4A, 0x22, 0x8B, 0x81, 0x9B, 0x59, 0x36,
-    0x54, 0x51, 0xAA, 0xC1, 0x7E, 0x65, 0xED, 0xB7, 0xB5, 0xA4, 0x35, 0x75, 0x5C, 0x4A, 0x19, 0xA6,
-    0x71, 0xDD, 0xD3, 0x28, 0x9E, 0xFB, 0x77, 0xFF, 0x74, 0x72, 0x88, 0x4D, 0xA2, 0x29, 0x60, 0xB6,
-    0x36, 0xB1, 0x12, 0x16, 0x21, 0x68, 0x87, 0x8D, 0xC2, 0x62, 0xDB, 0xB2, 0x10, 0x90, 0x98, 0x0E,
-    0x8E, 0x66, 0x4C, 0xEB, 0xFB, 0x1D, 0xA7, 0xED, 0x31, 0xD8, 0x30, 0x10, 0x8D, 0x41, 0x11, 0xC6,
-    0x0A, 0xB9, 0xBF, 0xFD, 0x6D, 0xDF, 0x08, 0xC0, 0x32, 0x36, 0x76, 0x9B, 0x79, 0xCC, 0x3C, 0x41,
-    0x73, 0xA7, 0xCA, 0xFD, 0xF8, 0x76, 0x75, 0x00, 0xE6, 0xF7, 0x8C, 0x35, 0x66, 0xDE, 0xF2, 0x66,
-    0x8D, 0xCB, 0x58, 0x5B, 0x71, 0xDB, 0xFA, 0xE8, 0xFE, 0xEB, 0x0B, 0xC6, 0x0C, 0xFB, 0xCD, 0x08,
-    0x6C, 0x38, 0x10, 0x43, 0x51, 0x7B, 0x34, 0x5A, 0x98, 0x7F, 0xF9, 0xCE, 0x47, 0xAB, 0x66, 0x94,
-    0x97, 0x52, 0x75, 0xCB, 0xC5, 0xCA, 0x7B, 0xAD, 0x2C, 0x3A, 0x2B, 0x90, 0xC3, 0x4E, 0xC5, 0xC2,
-    0x9E, 0x95, 0x1D, 0x7B, 0x16, 0x78, 0x90, 0xCE, 0xD0, 0x03, 0xE1, 0x9A, 0xCF, 0x38, 0x93, 0x65,
-    0x85, 0x7E, 0xFB, 0x54, 0x8A, 0x8C, 0xFD, 0x85, 0xA4, 0x2C, 0x36, 0xA9, 0xAB, 0x3F, 0x20, 0xFB,
-    0xD3, 0xE5, 0x90, 0x5B, 0xCF, 0xE6, 0xED, 0x9D, 0xE0, 0x38, 0x92, 0x91, 0x68, 0x94, 0x70, 0x03,
-    0x47, 0xC6, 0x65, 0x3D, 0xF6, 0x24, 0x93, 0x33, 0x29, 0x86, 0xA4, 0x77, 0x36, 0xED, 0x58, 0x0B,
-    0x0B, 0x7F, 0x64, 0x22, 0xD9, 0x1E, 0x14, 0x17, 0xAD, 0x12, 0x19, 0x98, 0x0A, 0x54, 0xA6, 0x89,
-    0xB6, 0xE1, 0x0F, 0xDD, 0x27, 0x1F, 0xE1, 0x3F, 0x71, 0x07, 0xA5, 0xEA, 0xC0, 0x0C, 0x59, 0xAD,
-    0x53, 0xB9, 0x6C, 0x50, 0x32, 0x31, 0xFB, 0x80, 0xD6, 0xB0, 0x34, 0x9E, 0x97, 0x41, 0xFB, 0xC9,
-    0xE7, 0xB0, 0x6E, 0x1E, 0x24, 0xD4, 0xFE, 0x2A, 0xB7, 0xC8, 0x26, 0xDC, 0x87, 0xF5, 0x64, 0x65,
-    0xB3, 0x4E, 0x21, 0xFE, 0x89, 0x7B, 0x7C, 0x1C, 0x8D, 0xDF, 0x59, 0xC3, 0xB1, 0x73, 0xB6, 0x6A,
-    0x62, 0x08, 0x23, 0xF8, 0xF8, 0x5B, 0x16, 0x65, 0x95, 0xE2, 0x42, 0x3F, 0x22, 0x95, 0xBC, 0x49,
-    0x31, 0xA4, 0x01, 0xC1, 0xC6, 0x05, 0xB6, 0x73, 0xBE, 0xE2, 0x68, 0x08, 0x0B, 0xC7, 0x15, 0xE1,
-    0x8A, 0x65, 0x16, 0xAC, 0xA6, 0xCA, 0x8B, 0xE1, 0x68, 0x08, 0x07, 0xE6, 0x0E, 0x70, 0x67, 0x30,
-    0x08, 0x61, 0x10, 0x11, 0x21, 0x0E, 0xEC, 0x16, 0x8B, 0x4A, 0xCC, 0xBA, 0xEF, 0xC0, 0x9E, 0x07,
-    0x46, 0x7E, 0xE1, 0xD8, 0x0A, 0xE1, 0x69, 0x2D, 0xFA, 0x0A, 0x49, 0x39, 0x0D, 0x6E, 0x60, 0xDA,
-    0xAA, 0x83, 0x72, 0xC7, 0x23, 0x49, 0x01, 0xAB, 0x8D, 0xEA, 0x6D, 0xA4, 0x56, 0xF7, 0x9F, 0xCD,
-    0x27, 0x18, 0xB1, 0xEB, 0x7E, 0x05, 0x5C, 0x60, 0x55, 0x5A, 0x4B, 0x4E, 0x66, 0xCB, 0x3A, 0x75,
-    0x32, 0x48, 0x4B, 0x21, 0xE9, 0xEF, 0xB9, 0x5C, 0x6C, 0x96, 0xE9, 0x00, 0xF8, 0xB8, 0xB9, 0x53,
-    0xDD, 0x88, 0x7B, 0x0D, 0x84, 0xBB, 0xD9, 0xCF, 0x33, 0xE3, 0x76, 0xCD, 0xBB, 0x72, 0x5A, 0x3A,
-    0x42, 0x5D, 0x29, 0x67, 0xDD, 0x7C, 0x34, 0x87, 0x79, 0xF0, 0xF0, 0xFE, 0x9D, 0x18, 0x54, 0x72,
-    0xA1, 0x86, 0x46, 0x97, 0xD9, 0xF6, 0x0D, 0xA6, 0xAB, 0x16, 0xBC, 0xCE, 0xA4, 0xFE, 0x57, 0x8F,
-    0xEA, 0xCA, 0x19, 0x83, 0x56, 0x87, 0x58, 0xE2, 0xCD, 0xE5, 0xB5, 0xA3, 0x60, 0xB6, 0x34, 0x8E,
-    0xBB, 0x89, 0xF3, 0xAB, 0x63, 0x6F, 0x56, 0xE8, 0x84, 0x5F, 0x6C, 0xCD, 0x8D, 0xAD, 0x25, 0xB6,
-    0xC3, 0xB2, 0xD5, 0x0A, 0xA1, 0x23, 0x0C, 0x6D, 0xE1, 0x51, 0x91, 0x40, 0x4B, 0x98, 0xDB, 0x03,
-    0x42, 0x33, 0x06, 0x0E, 0xE8, 0x0B, 0x55, 0x70, 0xC2, 0xDD, 0xF1, 0x02, 0x80, 0xA3, 0x89, 0x25,
-    0x90, 0xD2, 0x95, 0x7F, 0xA8, 0x30, 0xC3, 0x58, 0x79, 0x7F, 0x61, 0xCD, 0x0A, 0x2E, 0xB8, 0xD5,
-    0xEA, 0xA8, 0xBD, 0x85, 0xED, 0xFF, 0xEC, 0xB9, 0x79, 0x97, 0x5F, 0xD9, 0x82, 0xC4, 0x8D, 0x04,
-    0x81, 0x7A, 0x80, 0x33, 0x4C, 0x7B, 0x0A, 0xAA, 0x8C, 0x9C, 0x3E, 0xBD, 0x2A, 0x61, 0xC9, 0x16,
-    0x41, 0x88, 0x78, 0x6C, 0xCF, 0xDF, 0xF9, 0x21, 0x58, 0x5C, 0x71, 0xB5, 0x6A, 0x64, 0x67, 0xAD,
-    0xCC, 0x67, 0x5D, 0x43, 0x65, 0xA6, 0xFF, 0xE6, 0x5A, 0x9D, 0xC4, 0x80, 0x68, 0x03, 0xE1, 0xFC,
-    0x60, 0x9D, 0x6A, 0x32, 0xEB, 0xA3, 0xBD, 0xE4, 0x25, 0xCC, 0x00, 0x4A, 0x11, 0x47, 0x7B, 0xEB,
-    0x04, 0xEC, 0xF2, 0x91, 0x7C, 0x73, 0xCD, 0x43, 0x80, 0x76, 0x56, 0x1E, 0xCA, 0x44, 0x0E, 0x9A,
-    0x56, 0xC8, 0x45, 0xCC, 0xDE, 0xBE, 0x9E, 0xF4, 0x1F, 0x97, 0x8C, 0x40, 0x19, 0xF8, 0x4F, 0xEB,
-    0xA4, 0x42, 0x3B, 0xA0, 0xC5, 0x3F, 0x8B, 0xDC, 0xB1, 0x67, 0xF9, 0xED, 0xB6, 0xA5, 0xBE, 0xEA,
-    0xBA, 0x54, 0x5E, 0x6D, 0x2A, 0x25, 0x81, 0xAA, 0xCF, 0xC8, 0x64, 0x4B, 0xDA, 0xBD, 0xAA, 0x57,
-    0x01, 0x65, 0x5C, 0xAA, 0xF1, 0xA1, 0xDF, 0xA8, 0x55, 0xB7, 0x14, 0x93, 0x0A, 0x4A, 0xC5, 0xCF,
-    0x7D, 0x47, 0xC3, 0x11, 0x4D, 0xA9, 0x57, 0x1D, 0xA7, 0x6A, 0xAA, 0x51, 0x6B, 0x21, 0xCA, 0xB9,
-    0xA6, 0xB5, 0x36, 0xF9, 0x5C, 0x35, 0x2A, 0xA1, 0xF8, 0xBB, 0x93, 0x8A, 0x2A, 0x89, 0x95, 0x59,
-    0x58, 0xBA, 0x1B, 0x54, 0xD5, 0x8B, 0xFC, 0x5A, 0x4C, 0x93, 0xC6, 0xB0, 0x5C, 0xA7, 0x80, 0xAD,
-    0xA2, 0x1D, 0x95, 0x9A, 0x75, 0x0C, 0x42, 0x99, 0xAC, 0x89, 0x87, 0x11, 0xA9, 0xB7, 0x0D, 0x06,
-    0x9D, 0x45, 0xE7, 0x81, 0x85, 0xD0, 0x4F, 0x1F, 0x72, 0x5D, 0x6B, 0xDD, 0x37, 0x36, 0xEB, 0x99,
-    0x58, 0x90, 0xBD, 0x9E, 0xBA, 0xB7, 0xF8, 0x11, 0xD4, 0xB7, 0x75, 0x31, 0x77, 0x0E, 0xCD, 0x5E,
-    0x1A, 0x9B, 0x2A, 0xFF, 0xAF, 0xB5, 0x2F, 0x53, 0xC9, 0x4E, 0x24, 0x81, 0x6F, 0x2B, 0xD6, 0xFF,
-    0x97, 0x54, 0x75, 0xAE, 0xF7, 0xBC, 0xEA, 0x5E, 0x85, 0x6E, 0x7B, 0x9F, 0x92, 0x99, 0xFB, 0x4A,
-    0xED, 0xE0, 0xBB, 0xFA, 0xB2, 0xD0, 0xB8, 0x46, 0xFE, 0x16, 0xB7, 0x2F, 0x66, 0x7E, 0x89, 0xFD,
-    0x5B, 0xFC, 0x52, 0x8F, 0x8C, 0xE5, 0x52, 0x9F, 0xE0, 0x32, 0xC4, 0x13, 0x15, 0xFD, 0xA3, 0x36,
-    0xC8, 0x20, 0x6B, 0xBE, 0x3D, 0xBD, 0xBA, 0x14, 0x13, 0x97, 0x59, 0xCC, 0x58, 0xD4, 0xF8, 0x31,
-    0x37, 0x70, 0xF6, 0x70, 0x61, 0x77, 0x5B, 0xFB, 0xB1, 0xDC, 0xC0, 0x72, 0xFA, 0x54, 0x82, 0x12,
-    0x1B, 0x11, 0xEA, 0x77, 0xEF, 0x53, 0xF2, 0xF9, 0x84, 0xA2, 0x1D, 0x58, 0x5C, 0x69, 0x49, 0x42,
-    0xA6, 0x64, 0x23, 0x96, 0x8B, 0x0B, 0x7C, 0xD5, 0xAB, 0xF9, 0x2B, 0xAB, 0xD4, 0xD3, 0xEF, 0x06,
-    0xA3, 0xFB, 0xE3, 0x87, 0x04, 0xED, 0x2B, 0x32, 0x0F, 0x66, 0x1C, 0x12, 0x7F, 0x77, 0xD8, 0x37,
-    0x0C, 0xA9, 0x99, 0x85, 0xFB, 0x1B, 0x85, 0xD3, 0xB2, 0x92, 0x6A, 0xE1, 0x50, 0x8F, 0x54, 0xF1,
-    0xE7, 0x16, 0x31, 0x33, 0x86, 0xC1, 0xC9, 0x69, 0x22, 0x89, 0x60, 0x0B, 0x2D, 0x96, 0x8A, 0x75,
-    0x14, 0x9C, 0xDC, 0x53, 0x96, 0x88, 0xA9, 0x6E, 0x2B, 0x84, 0xE9, 0x87, 0x86, 0x76, 0xAD, 0x2F,
-    0x86, 0xE9, 0x8A, 0xF6, 0x0D, 0x7E, 0xA9, 0x26, 0x2F, 0x73, 0xFD, 0x2A, 0xBF, 0xF8, 0x9E, 0x97,
-    0xE5, 0x4B, 0xAC, 0x98, 0x88, 0x1B, 0x04, 0x7E, 0x08, 0xFD, 0x8C, 0x54, 0xC9, 0xE2, 0xA6, 0x8D,
-    0x62, 0x94, 0x56, 0x78, 0x74, 0xCA, 0x18, 0xA5, 0xAD, 0xA7, 0x8E, 0x48, 0x6A, 0xBE, 0xA9, 0x54,
-    0x87, 0xC8, 0x46, 0x2B, 0x43, 0x6C, 0xB6, 0x01, 0x9A, 0xF3, 0x2A, 0x42, 0x04, 0xC7, 0x54, 0x21,
-    0x3E, 0x89, 0x08, 0x07, 0xA5, 0x7B, 0x3C, 0x84, 0x27, 0x41, 0x12, 0x9B, 0x0F, 0x75, 0x9F, 0x4D,
-    0x89, 0xCF, 0x26, 0xB5, 0xC2, 0x13, 0x39, 0x91, 0xD9, 0x74, 0x3B, 0xB3, 0x29, 0x0C, 0xB8, 0x4A,
-    0x5C, 0x33, 0x27, 0x3E, 0x99, 0x35, 0xEC, 0x92, 0xB4, 0x8F, 0x3A, 0x77, 0x24, 0x18, 0x67, 0xC4,
-    0xBA, 0xEB, 0xDF, 0x75, 0x83, 0x25, 0xC1, 0xCF, 0x9A, 0x1B, 0x3D, 0xC8, 0xFE, 0x19, 0x87, 0x2E,
-    0xDF, 0xA2, 0x00, 0x51, 0x12, 0x0B, 0x79, 0xB7, 0x8D, 0xD4, 0x89, 0xDB, 0xC8, 0x2D, 0x70, 0x8E,
-    0x81, 0x83, 0x1B, 0xF0, 0x1B, 0x94, 0x70, 0xEE, 0xFC, 0xB6, 0xBD, 0xD7, 0xCF, 0x72, 0xCE, 0xA7,
-    0x0B, 0x67, 0xB8, 0xC2, 0xD0, 0xB7, 0x49, 0x1F, 0x73, 0xC6, 0xA3, 0xCD, 0x1B, 0xBD, 0x37, 0x35,
-    0xB6, 0x2A, 0xE5, 0x03, 0xE4, 0x31, 0x6F, 0xF4, 0xF4, 0xAE, 0xA1, 0x5A, 0xBC, 0x0C, 0x88, 0xBC,
-    0xBC, 0x7A, 0xE0, 0x27, 0xCB, 0x30, 0xE4, 0x97, 0x5A, 0x9A, 0x7A, 0x68, 0xC3, 0x66, 0xDF, 0x8F,
-    0xC7, 0x1A, 0x69, 0x01, 0xC6, 0xEF, 0x58, 0x69, 0xBE, 0xD8, 0x9C, 0x57, 0xAC, 0xFA, 0x69, 0x35,
-    0xA8, 0x0F, 0xBF, 0xC2, 0x6D, 0x10, 0xBF, 0xD6, 0xBE, 0xCD, 0x2A, 0x5A, 0x0E, 0xB1, 0x5F, 0x02,
-    0xAF, 0xE6, 0x55, 0xF9, 0xD7, 0xAE, 0x7E, 0x73, 0x4C, 0xB2, 0x76, 0x96, 0xF1, 0x8D, 0xB7, 0x26,
-    0x72, 0xC5, 0x96, 0x8B, 0x87, 0xCE, 0x2E, 0x25, 0x6B, 0x87, 0xF4, 0xF0, 0xF9, 0xA0, 0x58, 0x25,
-    0x35, 0x0F, 0x1F, 0x79, 0x45, 0x38, 0x0C, 0x70, 0x18, 0xF7, 0xD4, 0xDD, 0xC7, 0x5D, 0xB3, 0xB1,
-    0x6B, 0x5A, 0x41, 0xC5, 0x6B, 0x96, 0x8F, 0xB9, 0x86, 0xEB, 0x14, 0xCC, 0x5B, 0x90, 0xCE, 0xB0,
-    0x33, 0x6C, 0xF1, 0x05, 0x02, 0xDF, 0x6A, 0x71, 0xDB, 0xB1, 0x98, 0x60, 0x2D, 0x3F, 0xE4, 0x6B,
-    0x7D, 0x63, 0xDB, 0xC2, 0x3E, 0x20, 0xCD, 0xEA, 0x15, 0x43, 0xB3, 0x0A, 0xD6, 0x0B, 0xD2, 0x9A,
-    0xB2, 0x9A, 0x96, 0x82, 0x18, 0xA9, 0x52, 0x3B, 0x17, 0x5E, 0x70, 0x0F, 0x39, 0x4D, 0x82, 0xD7,
-    0xD6, 0x6A, 0xDE, 0xFA, 0xD6, 0xAF, 0xE5, 0x29, 0x4B, 0xC4, 0x2A, 0x2B, 0x60, 0x29, 0x0A, 0x42,
-    0x24, 0x5C, 0x59, 0x4C, 0x76, 0x4F, 0x1B, 0xEC, 0x61, 0x93, 0x13, 0x43, 0x6A, 0x0A, 0xC7, 0xB5,
-    0xCE, 0xAB, 0xAB, 0x7A, 0xAB, 0xAC, 0x0D, 0x72, 0xA8, 0xF1, 0x98, 0xF6, 0x66, 0x52, 0xEE, 0x89,
-    0x21, 0x76, 0x40, 0x08, 0xFC, 0x3F, 0x0B, 0xEF, 0x15, 0x69, 0x4C, 0x85, 0x55, 0xB9, 0x29, 0x27,
-    0x21, 0x60, 0x7B, 0x0E, 0xE1, 0x02, 0x38, 0x57, 0x5C, 0x62, 0xD5, 0xE7, 0x15, 0xCC, 0x85, 0x47,
-    0xF1, 0xFD, 0xC8, 0x35, 0xCB, 0x7A, 0x4D, 0xA9, 0x94, 0x82, 0xD7, 0x8C, 0x1F, 0x73, 0x4D, 0x6D,
-    0x75, 0x4C, 0x56, 0xD3, 0xD8, 0x3A, 0x34, 0x6A, 0x07, 0x84, 0x67, 0x34, 0x8B, 0xB7, 0xD6, 0x10,
-    0xD6, 0x36, 0xC2, 0xB8, 0x3F, 0xC1, 0x77, 0x38, 0x9E, 0x5A, 0xDB, 0x73, 0x56, 0xE1, 0x0A, 0xFD,
-    0xE1, 0x22, 0xC8, 0x62, 0x69, 0xBA, 0x95, 0xC6, 0x44, 0x87, 0xAF, 0x1D, 0x53, 0x12, 0x70, 0x9A,
-    0xEE, 0xE9, 0x0A, 0x3F, 0x83, 0x14, 0xA0, 0xC8, 0x55, 0x55, 0x02, 0x3B, 0x26, 0x06, 0x08, 0x71,
-    0x59, 0x8F, 0x20, 0x33, 0x1B, 0x2E, 0x0D, 0xEB, 0x4E, 0x89, 0xF3, 0x6D, 0x2A, 0xD3, 0xAC, 0xDD,
-    0xAA, 0x9E, 0x3F, 0x45, 0xFE, 0x9B, 0x4A, 0xCA, 0x17, 0x6F, 0xD1, 0x7F, 0xA3, 0x88, 0x4E, 0xD6,
-    0xAD, 0x5A, 0x0E, 0x17, 0x0D, 0x6C, 0x86, 0xC3, 0x54, 0xBA, 0xEE, 0x0F, 0x95, 0xE3, 0x8E, 0x16,
-    0x46, 0x3A, 0x0B, 0x77, 0xFA, 0xFD, 0x88, 0x21, 0xDB, 0x22, 0xAE, 0xF2, 0xAD, 0x8D, 0x30, 0x3A,
-    0x13, 0x10, 0xB2, 0x6E, 0x9B, 0xCE, 0x81, 0x98, 0x67, 0xAC, 0x72, 0xFA, 0xEE, 0x7E, 0x6D, 0xC2,
-    0x28, 0x58, 0x0D, 0xEC, 0x28, 0xE6, 0x9A, 0x40, 0xC1, 0x96, 0xB9, 0x24, 0x54, 0x1D, 0xCE, 0x96,
-    0x72, 0x0E, 0xA9, 0xA9, 0x25, 0x8C, 0xEC, 0xBF, 0x78, 0xF2, 0x16, 0xA7, 0x2B, 0x9A, 0xFB, 0xFF,
-    0xE6, 0xDD, 0x46, 0xFE, 0xDC, 0x9A, 0xF8, 0xFE, 0x4E, 0xB9, 0xA6, 0x85, 0x6B, 0x95, 0x5D, 0x83,
-    0x6A, 0x96, 0x5A, 0x6F, 0x41, 0xD3, 0xEB, 0xB3, 0x3F, 0x5C, 0x9B, 0x56, 0x2B, 0x56, 0xF6, 0x9E,
-    0xDB, 0x15, 0xA1, 0x86, 0x14, 0x25, 0x17, 0x2A, 0x3E, 0x1A, 0x89, 0x99, 0xE2, 0xA8, 0xAA, 0x0C,
-    0x4D, 0x52, 0xCB, 0xD9, 0x37, 0x4A, 0x7A, 0xA0, 0x4A, 0xD6, 0x2D, 0x1F, 0xAD, 0x33, 0x5E, 0xB7,
-    0x12, 0x70, 0xFC, 0x2C, 0x5A, 0xA6, 0x93, 0x75, 0xAA, 0x0B, 0x2B, 0xB0, 0x43, 0xE3, 0x44, 0xBB,
-    0x64, 0x36, 0x52, 0x22, 0xB2, 0xD4, 0x3B, 0x16, 0x23, 0xC0, 0xB1, 0x25, 0x8E, 0x1C, 0xE2, 0x51,
-    0x31, 0x1F, 0x82, 0x9A, 0x78, 0x1B, 0x4B, 0x64, 0x9E, 0x92, 0x4E, 0x9F, 0x53, 0x68, 0x5E, 0x75,
-    0xB3, 0x35, 0xC7, 0xBF, 0xE1, 0x2F, 0xEA, 0xE7, 0xDC, 0x8A, 0x5B, 0x7D, 0x65, 0xD4, 0x6F, 0x2A,
-    0xD5, 0x0E, 0x16, 0x9B, 0x24, 0xCA, 0xD7, 0x58, 0xCE, 0x18, 0x7D, 0x26, 0x32, 0xB6, 0x77, 0xF6,
-    0x73, 0x7E, 0x77, 0x1D, 0xD8, 0x59, 0xCB, 0xAD, 0xEB, 0xA4, 0x5A, 0x50, 0xEF, 0x17, 0x6B, 0x35,
-    0xFA, 0x91, 0x59, 0x93, 0x60, 0xBF, 0x70, 0x69, 0xD4, 0x9D, 0xF6, 0x5D, 0xA4, 0xC5, 0x8B, 0x2F,
-    0x1C, 0x95, 0xE1, 0x13, 0x22, 0xE6, 0xCF, 0xE9, 0xB6, 0x17, 0xB2, 0xD4, 0x13, 0xCB, 0x9B, 0x9C,
-    0x73, 0xDB, 0x14, 0xEC, 0x2C, 0x20, 0xDE, 0xE0, 0x2F, 0x6C, 0xA8, 0xDA, 0xD0, 0x5B, 0xC7, 0x31,
-    0xA5, 0x21, 0x66, 0xBB, 0x01, 0x4C, 0x00, 0xB7, 0xD9, 0x6B, 0xDB, 0x14, 0x03, 0x68, 0x94, 0xCE,
-    0xD1, 0xDD, 0xF1, 0x2F, 0xFC, 0xB5, 0xDF, 0xFB, 0x0A, 0x66, 0xA7, 0x46, 0xC4, 0x04, 0xA4, 0xAF,
-    0xF9, 0x29, 0xD6, 0x10, 0x0B, 0x60, 0x38, 0xB3, 0xCE, 0xD3, 0xDA, 0xEB, 0x6B, 0xDB, 0x51, 0x89,
-    0x75, 0x16, 0x60, 0xDA, 0x1E, 0xE4, 0xBB, 0x6C, 0x90, 0x43, 0xD0, 0x7F, 0xEE, 0x28, 0xC8, 0x2A,
-    0x69, 0xD7, 0x43, 0xC5, 0x34, 0xB7, 0x56, 0xAD, 0xBE, 0x77, 0xFE, 0x0E, 0x07, 0x2A, 0x3A, 0xCD,
-    0xC5, 0xC0, 0x3A, 0x68, 0xA0, 0x0A, 0x0C, 0x2A, 0x38, 0x38, 0x93, 0xC3, 0x54, 0xC1, 0xE7, 0x01,
-    0x19, 0x4E, 0xD7, 0x74, 0x11, 0xF1, 0x08, 0x09, 0xAD, 0xA3, 0x11, 0x2B, 0x97, 0xE5, 0x51, 0xDF,
-    0xCF, 0xF5, 0x8D, 0x5B, 0x7E, 0xC9, 0x11, 0xFE, 0xC1, 0xB2, 0xF7, 0xDE, 0xC3, 0x0A, 0x60, 0x2D,
-    0xA8, 0xF0, 0x49, 0x1B, 0x7D, 0x58, 0x9B, 0x11, 0x1A, 0x12, 0xD6, 0xA0, 0x88, 0xD9, 0x58, 0xF6,
-    0x26, 0xDF, 0x99, 0x58, 0x35, 0xAC, 0x4A, 0x90, 0x3E, 0x69, 0x59, 0x40, 0xEF, 0x1F, 0x38, 0x81,
-    0x4F, 0x97, 0x5F, 0xA0, 0xB5, 0x48, 0xE1, 0x27, 0xFC, 0x73, 0xAD, 0x4B, 0x6F, 0x32, 0xFB, 0x57,
-    0xCC, 0xFB, 0x7A, 0x3A, 0x1C, 0x33, 0xDD, 0x6A, 0xBA, 0x9F, 0x31, 0x2C, 0xBC, 0x35, 0x32, 0x8E,
-    0x06, 0x04, 0x4B, 0x0D, 0x45, 0x06, 0x7D, 0xD8, 0x97, 0x85, 0xBE, 0x4C, 0x36, 0x9F, 0xC4, 0x09,
-    0xD3, 0x32, 0x59, 0x04, 0x72, 0x59, 0xB1, 0x59, 0x0B, 0x4F, 0xE4, 0x49, 0xE5, 0x9A, 0xB4, 0x44,
-    0xAE, 0xE4, 0xDB, 0xA2, 0x7E, 0xB9, 0x9A, 0x8A, 0xF3, 0x1F, 0xDE, 0xF5, 0x08, 0x93, 0x67, 0xDA,
-    0xC4, 0xA9, 0x80, 0xB8, 0xE3, 0xCE, 0x0D, 0x94, 0x73, 0xC7, 0xB2, 0xF8, 0xCB, 0x9C, 0xF4, 0xA8,
-    0x7F, 0xAA, 0xD9, 0x38, 0x90, 0x31, 0x65, 0xA3, 0x31, 0x1A, 0x8F, 0x4B, 0x69, 0x1E, 0x04, 0xBB,
-    0xD5, 0xC3, 0x8B, 0xAC, 0x2E, 0xC8, 0xD1, 0xC6, 0x91, 0x33, 0xE2, 0x97, 0xD8, 0xB7, 0x2A, 0x28,
-    0x92, 0x09, 0x67, 0xCE, 0x03, 0x99, 0x6B, 0x09, 0x42, 0x30, 0x3F, 0x50, 0x76, 0x3F, 0x22, 0x16,
-    0x06, 0xEC, 0x58, 0x31, 0xCA, 0xF0, 0x3F, 0xD8, 0x56, 0xBC, 0xB1, 0xD8, 0x9D, 0xDA, 0x7F, 0xDD,
-    0x93, 0xF2, 0x20, 0x7F, 0xCC, 0xF9, 0xEE, 0x88, 0xB5, 0xBE, 0xBC, 0x8F, 0x99, 0x60, 0x15, 0xF0,
-    0x45, 0x84, 0xA1, 0xA9, 0x3A, 0x92, 0xF0, 0x3A, 0x8C, 0x76, 0x2F, 0x43, 0x4B, 0xB2, 0x69, 0xAC,
-    0x55, 0xB9, 0x88, 0x6F, 0x19, 0x3F, 0x7E, 0x05, 0x9C, 0x45, 0x16, 0x30, 0xFA, 0x7E, 0x41, 0x0E,
-    0x0B, 0x70, 0x38, 0x8F, 0x09, 0x6B, 0xC6, 0xC9, 0x59, 0x9E, 0xC9, 0xD9, 0x02, 0x60, 0xCE, 0xF5,
-    0xAE, 0x38, 0x7C, 0x72, 0x95, 0xAC, 0x40, 0x75, 0x32, 0x95, 0xA7, 0xE9, 0x72, 0x00, 0xCA, 0x25,
-    0xC8, 0xCF, 0xC9, 0xD4, 0xE2, 0x1D, 0x33, 0x95, 0x16, 0x26, 0xE9, 0xDF, 0xDB, 0xFF, 0x09, 0xD0,
-    0x7E, 0xA8, 0xC7, 0xD3, 0x63, 0x65, 0xA3, 0xB9, 0x80, 0x80, 0x5D, 0x2E, 0xDC, 0x70, 0x6A, 0x25,
-    0xB4, 0xC6, 0x9C, 0xC0, 0x95, 0xF3, 0x8D, 0x4D, 0xF0, 0x17, 0x36, 0x87, 0xC6, 0x12, 0x56, 0x7A,
-    0xE1, 0x70, 0xBD, 0x64, 0x5C, 0x3B, 0x5C, 0xDC, 0x49, 0x45, 0x48, 0xDF, 0xAE, 0xA5, 0x21, 0x4E,
-    0x58, 0x45, 0xCD, 0x51, 0x51, 0x63, 0xF8, 0xC0, 0x39, 0x76, 0xE0, 0xDF, 0x93, 0x54, 0x6C, 0x3B,
-    0x86, 0x8B, 0x86, 0x24, 0x8A, 0xB6, 0x86, 0xD3, 0x29, 0xDA, 0xA2, 0xCF, 0xFA, 0xBA, 0x4F, 0x16,
-    0x35, 0x46, 0x37, 0x8E, 0x14, 0xC2, 0xDA, 0x8F, 0x02, 0xA3, 0xF4, 0xAA, 0xDF, 0xE4, 0x3D, 0xCB,
-    0xF9, 0x74, 0x67, 0x81, 0xD5, 0x4D, 0x5B, 0x77, 0x68, 0x32, 0xCF, 0xB9, 0x37, 0x9C, 0x86, 0x4C,
-    0xAD, 0x1A, 0xC7, 0xB1, 0x1E, 0x26, 0xBA, 0xD1, 0x76, 0x60, 0x4D, 0xFD, 0xB7, 0xAF, 0x7E, 0x54,
-    0x39, 0x33, 0x8D, 0x72, 0xAB, 0x76, 0x06, 0x36, 0xBD, 0x42, 0x50, 0xB2, 0x3E, 0x19, 0xE1, 0xF2,
-    0xF8, 0x31, 0xEF, 0x08, 0x26, 0x65, 0xEA, 0x2A, 0xE4, 0x6B, 0x51, 0x0B, 0xA6, 0xB3, 0x8D, 0x41,
-    0xA0, 0x2F, 0x10, 0xAE, 0xA6, 0xEE, 0x92, 0x49, 0x1D, 0x15, 0xD2, 0x52, 0x80, 0x69, 0x74, 0xF2,
-    0x90, 0x6D, 0xAB, 0xD7, 0x52, 0x6C, 0x6C, 0xF9, 0x2A, 0x70, 0xBA, 0xCE, 0x6E, 0x4A, 0xD1, 0x84,
-    0x73, 0x00, 0x09, 0x2D, 0x93, 0xCD, 0x51, 0xA3, 0x16, 0xD8, 0x48, 0xBE, 0xE6, 0xA7, 0xA4, 0xBE,
-    0xA4, 0x94, 0xAB, 0x81, 0x7F, 0x8A, 0x8F, 0x21, 0x4D, 0x04, 0x49, 0x15, 0x4F, 0x58, 0xB4, 0xBE,
-    0x35, 0x0B, 0x7E, 0xD1, 0x0A, 0xF0, 0x84, 0x25, 0x00, 0x9B, 0x12, 0x92, 0x95, 0xC4, 0x8A, 0x28,
-    0x72, 0x99, 0xF6, 0xA4, 0xA3, 0x3B, 0x69, 0x83, 0x91, 0x49, 0x23, 0x54, 0xF3, 0x91, 0x32, 0x09,
-    0x97, 0x90, 0xB5, 0xC5, 0xE6, 0x18, 0xC3, 0xF5, 0x7F, 0x4B, 0x9B, 0xC7, 0x5D, 0xD4, 0x6A, 0x16,
-    0xB4, 0xB1, 0x67, 0x5C, 0xB0, 0x2C, 0x95, 0x7D, 0xDF, 0x4C, 0xED, 0xFA, 0xC6, 0x43, 0xAF, 0xA6,
-    0xCF, 0x22, 0xFE, 0x81, 0xBA, 0x2F, 0x74, 0xE4, 0x30, 0x3C, 0x0B, 0x65, 0x5B, 0x7A, 0x0E, 0xEE,
-    0x72, 0x88, 0x37, 0x48, 0xA7, 0x17, 0x2B, 0xC6, 0xCB, 0xAF, 0xF8, 0x11, 0x78, 0xEF, 0xD3, 0x3D,
-    0x2D, 0x45, 0xF9, 0xC8, 0x64, 0x88, 0xB1, 0x3E, 0xE3, 0x17, 0xE4, 0xAC, 0x4C, 0x6E, 0xA3, 0xF2,
-    0x68, 0x91, 0x03, 0x70, 0x4D, 0x2A, 0x08, 0x3C, 0xCF, 0x22, 0xC6, 0x62, 0xA2, 0x53, 0x37, 0x0A,
-    0x3D, 0xF4, 0xB1, 0xDD, 0x8F, 0x42, 0xAA, 0x4E, 0x41, 0x72, 0x3A, 0x3D, 0xE2, 0x8A, 0xF7, 0xD8,
-    0x21, 0x6A, 0x62, 0x75, 0xE8, 0x3A, 0x66, 0x0E, 0x07, 0x5E, 0x38, 0x6F, 0xD8, 0xF7, 0xA5, 0xD9,
-    0xA8, 0x7C, 0x93, 0xFE, 0x6E, 0x8A, 0xA6, 0xB4, 0x03, 0xAD, 0xB2, 0x26, 0x3A, 0x54, 0x5B, 0xD8,
-    0x25, 0x22, 0x13, 0xAF, 0xD8, 0x65, 0x24, 0xC3, 0xAA, 0xC1, 0xA8, 0x60, 0xD9, 0x86, 0x99, 0xB9,
-    0x6D, 0x6A, 0xD3, 0xD6, 0x36, 0xD7, 0x8C, 0xDF, 0x4F, 0x44, 0x3E, 0xC3, 0x0D, 0x7D, 0x2C, 0xC5,
-    0xE7, 0xF3, 0x41, 0x42, 0x39, 0x18, 0xC3, 0x3E, 0x1B, 0x8A, 0xCE, 0xFF, 0x02, 0x74, 0x48, 0xE6,
-    0xB8, 0xCF, 0xDA, 0x7B, 0x2A, 0x39, 0xFF, 0xCB, 0x48, 0xCA, 0x7B, 0x4C, 0x10, 0xDE, 0x6C, 0x96,
-    0x7C, 0xD1, 0xE4, 0x6C, 0xBB, 0x3C, 0x89, 0xAA, 0x11, 0xB4, 0x3A, 0xBD, 0x05, 0x91, 0x1B, 0x4B,
-    0x02, 0x4E, 0xFF, 0x86, 0x45, 0x18, 0x16, 0x8E, 0xD6, 0x09, 0x80, 0x8D, 0x1F, 0x72, 0x38, 0x0A,
-    0x04, 0xB6, 0x40, 0xB9, 0xFE, 0x9D, 0xDF, 0x04, 0xFE, 0x7B, 0x48, 0x48, 0x16, 0x18, 0xAE, 0xFC,
-    0xF7, 0x34, 0x01, 0x6F, 0xB1, 0xDE, 0xCF, 0x67, 0x37, 0x06, 0x5A, 0xCD, 0x6B, 0x30, 0xB7, 0x4B,
-    0xC2, 0xA7, 0x05, 0x32, 0x35, 0x13, 0xD6, 0xAE, 0x51, 0x69, 0x73, 0x68, 0x36, 0x62, 0xF2, 0x59,
-    0xBA, 0xE8, 0x74, 0x89, 0xD9, 0xA9, 0xF8, 0x80, 0xDC, 0x67, 0xD7, 0xD5, 0x7C, 0xF4, 0x5F, 0x46,
-    0xF3, 0xB1, 0x65, 0xBD, 0x47, 0xC0, 0x89, 0x4D, 0x3E, 0x42, 0xDA, 0xB0, 0x4E, 0x0D, 0x6B, 0xED,
-    0x77, 0x2F, 0xCE, 0x92, 0x7A, 0x98, 0x78, 0xCA, 0x74, 0x05, 0xEF, 0x38, 0xC0, 0xC1, 0xE4, 0xE6,
-    0x9F, 0xF9, 0xA8, 0x09, 0x7D, 0x0E, 0x03, 0x75, 0x88, 0x63, 0xDD, 0xCB, 0x2F, 0xDA, 0xB0, 0x79,
-    0xAC, 0xA7, 0xB4, 0xEA, 0xF6, 0x65, 0x80, 0x3A, 0x7F, 0x97, 0xDE, 0xC4, 0xBF, 0xCD, 0x52, 0x28,
-    0x11, 0xF4, 0xD4, 0x36, 0xCB, 0x32, 0xF6, 0x47, 0x64, 0x83, 0x61, 0x1B, 0x5B, 0x6A, 0x0C, 0x76,
-    0xBF, 0xD3, 0x63, 0x01, 0xAB, 0x9E, 0xEA, 0x7A, 0xF1, 0x08, 0xB0, 0xE5, 0xDA, 0x32, 0x2F, 0x54,
-    0x86, 0xC3, 0xA7, 0x6A, 0xA9, 0x19, 0x3B, 0x54, 0x03, 0xC8, 0x04, 0xFF, 0x08, 0xF8, 0xBE, 0xC7,
-    0x19, 0x67, 0xEC, 0x57, 0x7C, 0xC0, 0x22, 0xD3, 0xAF, 0xA8, 0xC2, 0x00, 0x24, 0x9B, 0xA8, 0xA4,
-    0xEF, 0x50, 0xDB, 0xE0, 0x4D, 0xF2, 0x31, 0x87, 0x5B, 0x6C, 0xAA, 0x19, 0xD9, 0x84, 0xB7, 0xCE,
-    0x86, 0xCC, 0x0E, 0x96, 0xDF, 0x39, 0xAC, 0x1D, 0x1A, 0x8C, 0x99, 0xD6, 0x59, 0x57, 0x8B, 0x22,
-    0x35, 0x70, 0xA3, 0x1C, 0x5F, 0xA8, 0x88, 0xA6, 0xFF, 0x7C, 0x8F, 0xF9, 0x08, 0xD6, 0x02, 0xEC,
-    0x86, 0x61, 0x0F, 0xB4, 0xFF, 0x8E, 0x1E, 0xF1, 0xA8, 0x06, 0x12, 0x6A, 0xC8, 0x48, 0x40, 0xC0,
-    0x5B, 0x30, 0x3A, 0x51, 0x72, 0x5C, 0x0C, 0x9C, 0x16, 0xE9, 0x59, 0x3C, 0x66, 0xD8, 0x52, 0x77,
-    0xAC, 0xE5, 0x36, 0xBE, 0x83, 0x84, 0xC3, 0x25, 0x40, 0x75, 0x08, 0x68, 0xB1, 0x36, 0xCC, 0xF8,
-    0x48, 0x1B, 0xB7, 0x3D, 0x04, 0xA9, 0x3D, 0xE5, 0x30, 0xAC, 0xC5, 0x88, 0x8C, 0x5D, 0xA5, 0x85,
-    0x5D, 0xE3, 0xBE, 0x60, 0x3F, 0xF7, 0x0A, 0xE7, 0x4E, 0x87, 0x07, 0x41, 0xC6, 0xD3, 0x9B, 0x93,
-    0x4C, 0x29, 0x9F, 0x02, 0x5C, 0x23, 0x56, 0x58, 0xA0, 0x83, 0x51, 0x0F, 0xCF, 0x1D, 0x36, 0x45,
-    0x7B, 0x6C, 0xBC, 0xF8, 0xFF, 0x47, 0xB7, 0x97, 0x02, 0x5A, 0x95, 0x98, 0x1A, 0x96, 0xEA, 0x00,
-    0xFF, 0x31, 0xC6, 0xFD, 0x03, 0x86, 0x6A, 0xFB, 0xB0, 0x8B, 0xC6, 0x66, 0x18, 0xB4, 0x28, 0xA2,
-    0x78, 0xC2, 0x38, 0xBD, 0xBB, 0xB7, 0xB7, 0xF7, 0xA3, 0x8F, 0x3C, 0xEC, 0x72, 0x78, 0x42, 0xD8,
-    0xF1, 0xD9, 0x0E, 0xBB, 0x4B, 0x1D, 0xD0, 0x75, 0x52, 0x47, 0xE1, 0xC7, 0x9C, 0xB0, 0xF4, 0xE3,
-    0x6F, 0x76, 0xAA, 0x5E, 0xF0, 0xF8, 0x7D, 0x1C, 0x23, 0x05, 0xB9, 0x38, 0x72, 0xA4, 0x00, 0x31,
-    0xB9, 0xC6, 0xB5, 0x28, 0x3E, 0x45, 0x9F, 0xDF, 0x1A, 0x60, 0x18, 0xF3, 0x57, 0xE1, 0x62, 0xE7,
-    0xFC, 0x15, 0xDA, 0xCF, 0x6A, 0x23, 0x0E, 0x97, 0x44, 0x4E, 0xF7, 0x31, 0x65, 0x27, 0x11, 0x37,
-    0xEA, 0x5B, 0xDE, 0xAE, 0x2C, 0x27, 0xC7, 0xF1, 0x8A, 0xE4, 0xE0, 0x4A, 0x42, 0xB3, 0xF3, 0xE9,
-    0xA3, 0x1A, 0x65, 0x83, 0x43, 0x97, 0xB6, 0x53, 0xEC, 0xDB, 0x01, 0xB6, 0xCA, 0xAA, 0x23, 0xDD,
-    0x41, 0x47, 0x46, 0x19, 0x9C, 0xFB, 0xF2, 0x31, 0x06, 0x2B, 0xD4, 0x53, 0x80, 0x35, 0xCD, 0x32,
-    0xBB, 0x7E, 0xF9, 0xF8, 0x18, 0xFC, 0x07, 0xE8, 0x5C, 0xF1, 0x79, 0xC0, 0x90, 0x8F, 0xAB, 0x51,
-    0x53, 0x2B, 0x22, 0x81, 0x6F, 0x01, 0x83, 0x54, 0x12, 0x84, 0x8C, 0xE9, 0x23, 0x7B, 0x94, 0x6A,
-    0xE1, 0x0F, 0x34, 0x9F, 0x3D, 0x2B, 0x3C, 0xBE, 0xB9, 0xE2, 0xA3, 0xC8, 0x27, 0xEF, 0x2F, 0x57,
-    0x60, 0x59, 0x33, 0x3F, 0x14, 0xFC, 0xDB, 0x30, 0xB2, 0x1C, 0xD5, 0x7D, 0xD5, 0x43, 0x10, 0x87,
-    0xB0, 0x08, 0xBA, 0x83, 0x59, 0x27, 0x99, 0x78, 0xCB, 0x8C, 0x6D, 0x8E, 0xCE, 0xEF, 0xE7, 0xCB,
-    0x56, 0xFB, 0x73, 0xAF, 0x1D, 0x83, 0x43, 0xC2, 0x2A, 0xDC, 0x33, 0x2C, 0xC0, 0x4F, 0xEC, 0xAE,
-    0xD6, 0xDD, 0x97, 0x68, 0x47, 0x0F, 0x80, 0xA5, 0x28, 0xF5, 0x7A, 0xEE, 0x8B, 0xA1, 0x3D, 0x96,
-    0xC7, 0x0F, 0xF6, 0xBC, 0x0E, 0xEC, 0x2F, 0x35, 0x89, 0xA5, 0xEF, 0x7C, 0x60, 0xE5, 0x80, 0x21,
-    0x32, 0xB8, 0x13, 0xDE, 0x9D, 0x3E, 0x95, 0x4E, 0xF9, 0x5B, 0x77, 0x10, 0xDB, 0x42, 0x36, 0x5A,
-    0x08, 0x2A, 0xC3, 0x62, 0x68, 0x75, 0xC7, 0xA2, 0x8A, 0x9E, 0x1B, 0x3B, 0xD4, 0xE2, 0xB0, 0xDC,
-    0x62, 0x4D, 0xE3, 0xC7, 0xED, 0xCC, 0xBC, 0xAB, 0xBF, 0x49, 0xE9, 0x19, 0x38, 0xC0, 0x55, 0x6D,
-    0x0A, 0xC7, 0xA1, 0x93, 0x17, 0xFE, 0xA0, 0x38, 0x90, 0x73, 0x14, 0x1B, 0x57, 0x4E, 0xEA, 0xDF,
-    0x30, 0xCA, 0x6F, 0xE9, 0x5F, 0xE7, 0x68, 0xBC, 0x5F, 0x17, 0xFB, 0x81, 0x93, 0x7A, 0x8D, 0xC7,
-    0xD6, 0xE7, 0x92, 0xB7, 0x4F, 0x2D, 0x24, 0xEB, 0xA8, 0xDB, 0xA1, 0x87, 0xA9, 0xEC, 0x29, 0x0F,
-    0x77, 0xC5, 0x4C, 0xFA, 0x7D, 0x9E, 0x9B, 0xD8, 0x55, 0x10, 0x18, 0x31, 0xE9, 0x6C, 0x18, 0x3C,
-    0x65, 0xB3, 0xDB, 0x35, 0xEA, 0xB3, 0x06, 0x38, 0xC9, 0x74, 0x68, 0xFA, 0xA7, 0xB7, 0x91, 0x65,
-    0x67, 0x5D, 0xCC, 0x4C, 0x4F, 0x7B, 0xA8, 0xBF, 0x9E, 0xF5, 0xD4, 0xAD, 0xC0, 0x2A, 0xD4, 0x69,
-    0x6F, 0xD5, 0xC1, 0xE7, 0xF4, 0x98, 0xCC, 0x87, 0x26, 0x0F, 0x9A, 0xDC, 0x4B, 0xAD, 0xB8, 0x67,
-    0x95, 0xB3, 0x74, 0x2D, 0x15, 0x59, 0x41, 0x70, 0x3C, 0x78, 0x02, 0x59, 0xF2, 0xFF, 0x69, 0x15,
-    0x9A, 0xA2, 0xE5, 0xE2, 0x64, 0x33, 0x48, 0x36, 0x74, 0xB5, 0x39, 0x18, 0xDD, 0xAE, 0x2F, 0x1C,
-    0xEE, 0xB4, 0x6B, 0xCA, 0x2F, 0x56, 0x9D, 0x50, 0xE1, 0xBB, 0xDB, 0x79, 0x6E, 0x3E, 0x78, 0xEA,
-    0xC0, 0x64, 0xD2, 0xCC, 0x82, 0x15, 0xAA, 0xC0, 0x1E, 0xD1, 0x88, 0x46, 0x02, 0x01, 0x37, 0xCD,
-    0xCC, 0xCF, 0x14, 0xF6, 0x5F, 0xE4, 0x56, 0xBE, 0xFE, 0x26, 0x39, 0x8C, 0x58, 0x9B, 0x45, 0x56,
-    0x95, 0x84, 0x3B, 0x3D, 0x15, 0xD1, 0xA8, 0xA4, 0xC6, 0xB2, 0x42, 0xAC, 0x08, 0x25, 0x61, 0x9D,
-    0xC1, 0x29, 0x95, 0x5F, 0x9F, 0x99, 0x63, 0x99, 0xAF, 0x03, 0x3A, 0x94, 0xE7, 0x1C, 0xF9, 0xAD,
-    0x5B, 0x9F, 0xDA, 0x28, 0x54, 0x35, 0xAC, 0xEE, 0xAA, 0x0E, 0xD7, 0x9D, 0xDD, 0x16, 0xBD, 0xD6,
-    0x32, 0x9A, 0x8E, 0x16, 0xA6, 0x28, 0x2B, 0x75, 0xF6, 0x8C, 0xA7, 0x42, 0x31, 0xF7, 0xA5, 0xBD,
-    0xBD, 0xED, 0x93, 0x14, 0x97, 0xF4, 0xB8, 0x35, 0x59, 0x1B, 0xFA, 0xAF, 0x2F, 0xC2, 0x83, 0x89,
-    0x59, 0x30, 0x47, 0xC3, 0xC7, 0x4D, 0x5D, 0x7C, 0x82, 0x19, 0xFC, 0x3F, 0xE5, 0x5D, 0x3D, 0xB0,
-    0xE6, 0x56, 0x79, 0x3E, 0x92, 0xF6, 0x5E, 0x81, 0xC5, 0x58, 0x5B, 0xEC, 0x26, 0x80, 0x93, 0x88,
-    0x22, 0x33, 0x21, 0x84, 0x44, 0x29, 0x52, 0x24, 0x33, 0x24, 0x92, 0xED, 0xC2, 0x05, 0x05, 0xB7,
-    0xF0, 0xB5, 0x33, 0x43, 0x81, 0x0B, 0x8A, 0x8C, 0x99, 0x61, 0x1B, 0x0A, 0x0A, 0xB0, 0xE4, 0xB8,
-    0xA0, 0xA0, 0xC8, 0x66, 0x86, 0x24, 0x05, 0x8D, 0x0B, 0x0A, 0xB8, 0xCE, 0xCC, 0xA6, 0x70, 0x91,
-    0xCC, 0x18, 0x4B, 0xD8, 0x93, 0x71, 0x41, 0x11, 0x81, 0x27, 0x71, 0x41, 0x61, 0x11, 0x4C, 0x92,
-    0x31, 0xC5, 0xCA, 0x41, 0x60, 0xED, 0xAE, 0xA4, 0x93, 0xF7, 0x79, 0xDE, 0x73, 0xBE, 0x9F, 0xFB,
-    0x63, 0x1C, 0x92, 0x01, 0xAF, 0xD9, 0xF1, 0x7E, 0xDF, 0xDE, 0xEF, 0xD3, 0x95, 0xCE, 0x79, 0xFF,
-    0x7F, 0x9E, 0xF7, 0xD8, 0x18, 0x93, 0x58, 0x3B, 0x18, 0xF9, 0x63, 0xAD, 0xC5, 0x5B, 0xEA, 0x7E,
-    0x3C, 0x39, 0xF9, 0x86, 0x79, 0x8B, 0x3F, 0xD7, 0x4A, 0xBE, 0xE5, 0x23, 0xDF, 0x62, 0x5B, 0xF3,
-    0xDD, 0xCE, 0xFA, 0xA9, 0x6D, 0xF1, 0x16, 0xD9, 0x45, 0x3F, 0xB5, 0x1D, 0xDE, 0xB2, 0x37, 0x57,
-    0x7E, 0xBA, 0x14, 0x7C, 0x40, 0xF3, 0x94, 0x3E, 0x6F, 0xE0, 0x8F, 0xE1, 0x1A, 0x5A, 0xDC, 0xB2,
-    0x6A, 0xF3, 0x09, 0x9F, 0x4E, 0x01, 0xEE, 0x11, 0x5A, 0x93, 0xE1, 0x96, 0x45, 0x67, 0xF0, 0xA3,
-    0x2C, 0x15, 0xB7, 0x0C, 0xE4, 0xCD, 0xF6, 0xF2, 0xA9, 0xE5, 0x9A, 0xE3, 0xF5, 0xE4, 0x04, 0x6B,
-    0x96, 0x2B, 0x62, 0xAB, 0x4B, 0xAA, 0x46, 0x13, 0xAD, 0x58, 0x40, 0xCD, 0xDF, 0x2B, 0x16, 0xD3,
-    0xD8, 0xEB, 0xF2, 0x77, 0x29, 0xEC, 0x6A, 0x32, 0x6B, 0x7F, 0x20, 0x4B, 0x0A, 0x79, 0xAF, 0xE3,
-    0x63, 0x79, 0x6A, 0x83, 0xDB, 0xC8, 0xDD, 0x5A, 0xEC, 0xBE, 0xC7, 0x87, 0x47, 0x7B, 0x9B, 0xBD,
-    0x8C, 0x05, 0xDA, 0xEF, 0x58, 0xB9, 0xE1, 0x6A, 0xEB, 0x58, 0x9E, 0xDA, 0x46, 0xF6, 0x47, 0x76,
-    0x90, 0xFB, 0x17, 0x58, 0x68, 0xB2, 0x18, 0x7C, 0x62, 0xAA, 0x5E, 0xDE, 0x8B, 0xD1, 0x34, 0x7D,
-    0x3A, 0x9B, 0x62, 0x8C, 0xB1, 0xFA, 0xD0, 0xD6, 0xA9, 0x35, 0xB6, 0x4B, 0xE4, 0xDA, 0x31, 0xB2,
-    0x7D, 0xBA, 0x44, 0x77, 0xA6, 0xDF, 0xB1, 0x2F, 0xFE, 0xD4, 0x56, 0x8D, 0x9D, 0x1A, 0xFB, 0xAA,
-    0x9D, 0x73, 0xFB, 0xA2, 0x9D, 0x63, 0xF9, 0xCD, 0xC9, 0xC8, 0x82, 0x8F, 0xCC, 0xC1, 0xDE, 0xC3,
-    0x3F, 0x6A, 0x22, 0xBC, 0x25, 0xBD, 0x51, 0x36, 0xD5, 0xCF, 0xF3, 0x47, 0xAB, 0x34, 0x2E, 0xAC,
-    0x72, 0xA0, 0x99, 0xF4, 0xEA, 0x87, 0xCF, 0xE5, 0xD6, 0xA1, 0x5E, 0xA4, 0x24, 0x16, 0xF2, 0xE8,
-    0xC5, 0xA9, 0xDE, 0x22, 0x74, 0x5C, 0x2B, 0x94, 0x4D, 0xA9, 0x72, 0x2D, 0xB0, 0xB2, 0x1B, 0x7C,
-    0xFA, 0x32, 0xD9, 0x94, 0x4C, 0xCA, 0x35, 0x1B, 0xF1, 0xC7, 0xBC, 0x27, 0xE7, 0x63, 0x6C, 0x8F,
-    0x8B, 0x22, 0x9B, 0xF2, 0x81, 0x5C, 0x8B, 0x16, 0x93, 0xE2, 0x47, 0x21, 0x2B, 0x6E, 0x29, 0xF4,
-    0xB6, 0x64, 0x86, 0xA5, 0x68, 0x55, 0xAF, 0x9F, 0xDC, 0x90, 0x7B, 0xE0, 0x8A, 0x6A, 0xE0, 0x92,
-    0x62, 0xF9, 0x5B, 0x80, 0x9F, 0x13, 0x3F, 0x8D, 0x40, 0xAC, 0x5B, 0xD8, 0xE1, 0xCB, 0xC2, 0x0D,
-    0x61, 0xF6, 0x5A, 0xC8, 0x92, 0x72, 0xDE, 0xEB, 0x43, 0xE6, 0x92, 0x31, 0x5F, 0x34, 0xB1, 0x5C,
-    0xDC, 0x26, 0xC2, 0xAE, 0xF5, 0x5A, 0x2F, 0xB7, 0xC0, 0x6D, 0x73, 0x30, 0x2E, 0x68, 0xAE, 0xEF,
-    0xED, 0x3B, 0xE0, 0x5A, 0x97, 0x6C, 0x90, 0xCD, 0xDD, 0x9C, 0x4C, 0x65, 0x65, 0xAB, 0xC5, 0xDA,
-    0x58, 0x79, 0x54, 0xC4, 0x35, 0x37, 0x1D, 0x38, 0x35, 0xC4, 0xAB, 0x3C, 0x39, 0xB2, 0x65, 0xB2,
-    0x92, 0x91, 0x65, 0x85, 0x8D, 0x88, 0x20, 0xDA, 0x21, 0x15, 0xD1, 0x91, 0x6B, 0xCB, 0x42, 0xBE,
-    0xE9, 0x8A, 0xE6, 0x2F, 0xAB, 0xB9, 0xB8, 0xF6, 0xE6, 0x1D, 0x6B, 0xBF, 0x6C, 0x17, 0x6B, 0x5F,
-    0xB0, 0x73, 0x61, 0xDB, 0x4A, 0x7E, 0xB3, 0x4E, 0x27, 0xB0, 0xED, 0xE8, 0x5D, 0xA9, 0x23, 0x58,
-    0x17, 0x57, 0x67, 0x92, 0x41, 0xC9, 0xAA, 0x5B, 0x30, 0x85, 0xEE, 0x28, 0xF2, 0x3F, 0x7A, 0x79,
-    0x52, 0xF1, 0x8A, 0xD7, 0x1D, 0x5A, 0x5C, 0xE2, 0x76, 0xC6, 0xAA, 0x95, 0x9D, 0x36, 0x60, 0xAA,
-    0xAC, 0xC6, 0xDE, 0x16, 0x5A, 0x88, 0x46, 0xAC, 0x22, 0x08, 0xB2, 0x33, 0xD9, 0xA3, 0x6D, 0xB3,
-    0x49, 0xD8, 0x21, 0x44, 0xCF, 0x85, 0xE8, 0x26, 0x5D, 0x64, 0x87, 0xB2, 0xDE, 0xA6, 0x8F, 0xA0,
-    0x57, 0x21, 0xB4, 0xC7, 0x58, 0xB0, 0x63, 0x5D, 0xDF, 0x6B, 0x87, 0xA5, 0x79, 0xF5, 0xA6, 0x5D,
-    0x73, 0xFB, 0xA6, 0xB5, 0x89, 0x1D, 0xAC, 0x0D, 0x84, 0x5D, 0xAB, 0x08, 0xA1, 0xB9, 0x62, 0x42,
-    0x2C, 0x34, 0xE0, 0x6A, 0xB9, 0x98, 0x6F, 0x6E, 0x96, 0x9B, 0xAE, 0xD7, 0xB1, 0xC4, 0x81, 0xE2,
-    0xBA, 0xB3, 0x40, 0x0A, 0x4E, 0x4C, 0x91, 0xE7, 0xE7, 0x01, 0x2F, 0x49, 0x40, 0x43, 0xD9, 0x18,
-    0xC9, 0xFE, 0x1A, 0xBE, 0xFC, 0x93, 0xD3, 0xBA, 0x15, 0x34, 0x6B, 0x49, 0x21, 0x9F, 0x48, 0xF4,
-    0xD5, 0x71, 0x20, 0xB7, 0xAF, 0xFD, 0xBA, 0xC8, 0xD7, 0x22, 0xD4, 0xC1, 0xAD, 0x22, 0x11, 0x92,
-    0xD6, 0x44, 0x63, 0x02, 0x79, 0xEF, 0x53, 0x55, 0x22, 0xD2, 0xB6, 0x98, 0xB7, 0xAF, 0xAA, 0x98,
-    0xCD, 0x45, 0xAF, 0xB3, 0x7F, 0x0D, 0xEA, 0x0A, 0x4C, 0x6D, 0x41, 0xF1, 0xA2, 0xCD, 0xED, 0xAD,
-    0x4F, 0xDA, 0x36, 0x05, 0xA7, 0xCB, 0x58, 0xD9, 0xAF, 0xAA, 0x96, 0x59, 0x2C, 0xCD, 0x5C, 0x2D,
-    0xB7, 0xAB, 0x7D, 0xD6, 0x31, 0x13, 0xAC, 0x17, 0xE9, 0x97, 0x1F, 0x26, 0xF7, 0x43, 0x55, 0xD3,
-    0xC8, 0x18, 0xF3, 0x47, 0xA7, 0x35, 0xE8, 0x3E, 0x11, 0x91, 0x44, 0x36, 0x16, 0x91, 0x69, 0xF2,
-    0x8F, 0x62, 0x4A, 0x5A, 0x51, 0x95, 0x2B, 0x14, 0x1C, 0xC8, 0x12, 0x8D, 0x82, 0x68, 0xB3, 0x49,
-    0x78, 0xDB, 0x1E, 0x64, 0x86, 0x50, 0xF7, 0xE6, 0xB2, 0x6C, 0x35, 0x2D, 0x9B, 0xE9, 0xBE, 0x09,
-    0x2B, 0x83, 0x38, 0x76, 0x42, 0xA5, 0x51, 0xA4, 0x50, 0x7E, 0x2D, 0x70, 0xFA, 0xF2, 0x69, 0x4A,
-    0xD1, 0xAA, 0xD6, 0xA7, 0xF6, 0xA6, 0x28, 0xB0, 0xD7, 0xE4, 0x8E, 0xF1, 0x92, 0x4C, 0x78, 0x48,
-    0x28, 0xAF, 0x69, 0x6D, 0x9E, 0xBE, 0x8B, 0x89, 0xDF, 0xE0, 0xB1, 0x33, 0x2C, 0x41, 0x87, 0x8B,
-    0xE4, 0xB9, 0x2F, 0x8D, 0xD0, 0xED, 0x36, 0x5C, 0x44, 0xA3, 0x8A, 0x32, 0xA9, 0xF7, 0x7D, 0x4E,
-    0x80, 0x27, 0x37, 0x42, 0x44, 0xA1, 0x1A, 0x3D, 0x93, 0xE8, 0xEA, 0x73, 0x42, 0xDD, 0xA0, 0x84,
-    0x99, 0xA4, 0x2D, 0x80, 0x5D, 0x80, 0x42, 0x93, 0xE6, 0x89, 0xA3, 0x39, 0x88, 0x1F, 0x88, 0xED,
-    0x32, 0xB2, 0xE1, 0x27, 0x1B, 0x59, 0x2D, 0x3C, 0x95, 0x2C, 0x4C, 0xC8, 0x54, 0x8A, 0x0D, 0x94,
-    0x5F, 0xBB, 0xEA, 0xA8, 0xF7, 0x35, 0x0A, 0x3D, 0x77, 0x46, 0x8B, 0xAD, 0x96, 0xC4, 0xD0, 0xBC,
-    0x98, 0xB4, 0x3F, 0xD7, 0x97, 0xDC, 0x2D, 0x24, 0x0F, 0x45, 0xA3, 0xC5, 0xF0, 0x8B, 0x1F, 0xA6,
-    0xAD, 0x83, 0x73, 0xF6, 0x06, 0x6B, 0x57, 0xBA, 0x41, 0x64, 0x08, 0x37, 0x68, 0x2C, 0xBB, 0x01,
-    0x89, 0x21, 0xDA, 0x20, 0x07, 0x24, 0x1B, 0x04, 0x86, 0x60, 0x83, 0xBE, 0xF8, 0x6B, 0xF5, 0xEF,
-    0x65, 0x50, 0x17, 0x52, 0x0D, 0xE2, 0x42, 0xA8, 0x33, 0xAE, 0x65, 0x74, 0xA4, 0x0D, 0x4B, 0xF3,
-    0x17, 0x22, 0xD1, 0x83, 0x69, 0x44, 0x41, 0xC4, 0x7E, 0xD5, 0x30, 0x2A, 0x90, 0xEC, 0xC8, 0xD2,
-    0x94, 0xA8, 0x41, 0x89, 0xD5, 0x1D, 0x57, 0xE5, 0x69, 0x12, 0xDF, 0x67, 0x61, 0x6A, 0x2A, 0x18,
-    0x70, 0x25, 0x71, 0xC8, 0xBD, 0x86, 0x76, 0xBD, 0xBF, 0x6A, 0x43, 0x0B, 0xA1, 0x51, 0x1A, 0x83,
-    0xC9, 0x46, 0x0C, 0xB7, 0x3C, 0xF7, 0x09, 0x47, 0x52, 0x25, 0xB2, 0x12, 0x3C, 0xA2, 0x41, 0x0E,
-    0x68, 0xC3, 0x1C, 0x4D, 0xF3, 0x55, 0xA3, 0x87, 0x9A, 0x86, 0xBA, 0xDF, 0x92, 0x39, 0xC7, 0x6F,
-    0x3C, 0x16, 0xE3, 0x86, 0x5F, 0xA0, 0x70, 0x5A, 0xA3, 0x74, 0xA6, 0xDF, 0xEE, 0xB0, 0x1A, 0x79,
-    0xC5, 0x0F, 0xED, 0x86, 0xD0, 0x07, 0xD4, 0xDF, 0xA0, 0x0C, 0x44, 0x44, 0x4D, 0xDE, 0x9A, 0x35,
-    0x5C, 0x4C, 0x38, 0xE7, 0x72, 0xD9, 0xBA, 0x62, 0x0D, 0xBD, 0x5B, 0x08, 0x0D, 0xEA, 0x1F, 0xEC,
-    0xEF, 0xB1, 0x74, 0xF2, 0x9D, 0x8B, 0x1C, 0xD1, 0xB0, 0x08, 0x15, 0x6B, 0x0A, 0xB8, 0x48, 0xDF,
-    0x91, 0xBA, 0x32, 0x6C, 0x05, 0x0C, 0xA0, 0x9F, 0xA3, 0x74, 0x53, 0x32, 0x71, 0x5F, 0xB8, 0xAD,
-    0x92, 0xB6, 0x25, 0x5F, 0x0F, 0x57, 0xAC, 0x0E, 0xA6, 0xC9, 0x96, 0x34, 0x2E, 0x01, 0xBD, 0x96,
-    0x13, 0xF2, 0xF7, 0x53, 0x12, 0x4C, 0x5E, 0xD3, 0x4D, 0x25, 0x63, 0x4C, 0x02, 0xD9, 0x87, 0x54,
-    0xDE, 0xEF, 0xCC, 0x7B, 0x21, 0x90, 0x7A, 0xAE, 0x68, 0x3A, 0x2B, 0xF6, 0x07, 0x0D, 0x99, 0x22,
-    0x61, 0x08, 0xDE, 0xE9, 0x56, 0x6B, 0x86, 0x36, 0xB2, 0xFE, 0xC3, 0x47, 0xED, 0xFD, 0x8D, 0xFC,
-    0x18, 0x82, 0x5A, 0xC2, 0x8B, 0x06, 0xBB, 0xE1, 0xDD, 0x62, 0xC4, 0x94, 0x90, 0xCF, 0x51, 0xFD,
-    0x2E, 0x58, 0xD9, 0x32, 0x14, 0x90, 0xF5, 0x82, 0x31, 0x78, 0xA2, 0x68, 0x01, 0xAE, 0xC9, 0x56,
-    0x5E, 0x93, 0x80, 0xD1, 0x2D, 0x79, 0x47, 0x8F, 0x3D, 0xF8, 0x6B, 0xB2, 0x85, 0x6A, 0xB3, 0x73,
-    0x9F, 0xCC, 0x92, 0x18, 0xB9, 0x3E, 0x0B, 0x9A, 0x9D, 0x53, 0x50, 0x40, 0x09, 0x84, 0x5C, 0xBA,
-    0x3A, 0x2E, 0x76, 0x3F, 0x2E, 0x12, 0xDA, 0x1C, 0xA9, 0x61, 0x5F, 0x18, 0x7B, 0x7C, 0x8B, 0x96,
-    0xC3, 0xBE, 0x80, 0x9F, 0x1E, 0xB1, 0x2F, 0xCE, 0x94, 0x9A, 0xA7, 0x46, 0x52, 0xE6, 0xA1, 0x81,
-    0x92, 0x94, 0x74, 0xFA, 0x26, 0x9C, 0xB8, 0x14, 0xAF, 0x22, 0xE0, 0xA1, 0x7D, 0x65, 0xD1, 0x7C,
-    0x61, 0x56, 0x61, 0xC5, 0x9B, 0xB8, 0xF4, 0x89, 0xCC, 0x81, 0xD6, 0xC9, 0x4A, 0xC1, 0x79, 0x46,
-    0x58, 0x74, 0x34, 0x0C, 0xF2, 0x46, 0xBA, 0x1D, 0x3A, 0x7B, 0xA8, 0x16, 0x79, 0x4B, 0x07, 0x6F,
-    0x34, 0x4A, 0xC6, 0x5B, 0xAA, 0x6F, 0x12, 0x6F, 0xC9, 0x5E, 0xE0, 0xE7, 0x5B, 0xC3, 0x60, 0xB9,
-    0x95, 0xE7, 0x0C, 0x0D, 0x83, 0x75, 0x09, 0xBB, 0x68, 0xE8, 0x70, 0xCF, 0xD3, 0x31, 0xF3, 0xAF,
-    0xE9, 0x7E, 0x1B, 0xDD, 0xB7, 0x23, 0x46, 0xA5, 0x11, 0xD1, 0x07, 0x3E, 0xB5, 0x1C, 0xE2, 0xC7,
-    0x04, 0x26, 0xB5, 0x23, 0x19, 0xB1, 0x72, 0xF9, 0x06, 0xD4, 0x94, 0xD5, 0x49, 0xF8, 0x49, 0x33,
-    0x48, 0xBB, 0x40, 0xAE, 0x44, 0xCA, 0xB2, 0x13, 0x7B, 0xFB, 0x6B, 0xC2, 0xB2, 0x0A, 0x77, 0xAB,
-    0x26, 0x50, 0xBA, 0x14, 0x65, 0xC3, 0x35, 0xA9, 0xE5, 0x35, 0x64, 0x59, 0x4F, 0xB6, 0xC2, 0xE0,
-    0x08, 0xE7, 0xF2, 0xED, 0x7D, 0x64, 0xB9, 0x90, 0xD9, 0x86, 0xCF, 0xA2, 0x80, 0x36, 0x34, 0x5D,
-    0x91, 0x32, 0x29, 0x72, 0xF1, 0x1A, 0xD6, 0x5A, 0x9E, 0xE6, 0x95, 0xF3, 0xC1, 0xF8, 0xB6, 0xDD,
-    0xBC, 0x3E, 0xE2, 0x94, 0x5B, 0x3E, 0x3F, 0x7C, 0xC6, 0xFE, 0x17, 0x23, 0x3F, 0xB9, 0xF9, 0x3D,
-    0x37, 0xEC, 0xD7, 0x7D, 0xF0, 0xF5, 0xD9, 0x87, 0x16, 0x70, 0x01, 0x1F, 0xE7, 0x7C, 0x6D, 0xF0,
-    0xA8, 0xD0, 0x76, 0x88, 0xFD, 0xC8, 0x1C, 0x91, 0x3B, 0xE1, 0x84, 0x6C, 0x57, 0xC8, 0xA8, 0x9C,
-    0x51, 0xC6, 0x28, 0x5F, 0x94, 0x2D, 0x4D, 0x0F, 0xAE, 0x28, 0x53, 0x94, 0x27, 0xCA, 0x12, 0xE5,
-    0x88, 0x32, 0x44, 0xF9, 0xE1, 0xD8, 0xE1, 0xB9, 0xC1, 0xB4, 0xCA, 0x27, 0x94, 0x9A, 0x5E, 0xDE,
-    0x73, 0x72, 0x72, 0xFD, 0x5C, 0xAF, 0x72, 0xF5, 0xF8, 0xF8, 0xF8, 0x61, 0x93, 0x2A, 0x15, 0x2C,
-    0x29, 0x93, 0xA8, 0xE1, 0x11, 0x2B, 0xF9, 0xE8, 0xAC, 0x3A, 0xD5, 0x92, 0xD2, 0x13, 0xB9, 0x55,
-    0x94, 0x58, 0x7C, 0x50, 0xAB, 0x71, 0x50, 0xC7, 0xEA, 0x2D, 0x1E, 0x24, 0x7E, 0x36, 0xDE, 0x58,
-    0x55, 0x30, 0x09, 0x72, 0xB7, 0xE3, 0x63, 0x67, 0x3B, 0x5C, 0x74, 0x22, 0xBF, 0xD9, 0xB9, 0xDF,
-    0x0C, 0x46, 0x0A, 0x82, 0xB8, 0x07, 0xD1, 0xA3, 0x04, 0xC4, 0x11, 0xB9, 0x93, 0x67, 0xDE, 0x96,
-    0xA0, 0x39, 0x50, 0xF9, 0xA1, 0xC6, 0x77, 0x64, 0x13, 0x1C, 0x12, 0x6E, 0xE6, 0x7C, 0x2A, 0xA2,
-    0xE4, 0xD9, 0x1C, 0xF0, 0xF6, 0x7B, 0xEE, 0xDB, 0xEE, 0xBA, 0x6F, 0xC9, 0x9F, 0x22, 0x09, 0x67,
-    0xC5, 0x17, 0xE4, 0x43, 0x2A, 0xFF, 0x0C, 0x91, 0x6A, 0x14, 0x9D, 0xE4, 0x1E, 0xB3, 0x2C, 0xA0,
-    0xB9, 0xB9, 0xD0, 0x0B, 0x19, 0x08, 0x86, 0x28, 0x4C, 0x58, 0xCA, 0x72, 0x66, 0x31, 0x79, 0x4D,
-    0x8B, 0xE5, 0x7B, 0xF7, 0xED, 0x3C, 0xC7, 0x95, 0xDD, 0x27, 0x85, 0xAD, 0xF9, 0x43, 0x79, 0x7B,
-    0xDE, 0xA4, 0xCC, 0x09, 0x18, 0xC2, 0x35, 0x54, 0x46, 0xE7, 0x6C, 0xD4, 0xD8, 0x9B, 0x83, 0xD3,
-    0x6E, 0x46, 0xF6, 0x80, 0xEC, 0x57, 0xB7, 0x97, 0x2A, 0xB1, 0x55, 0x26, 0x45, 0x7C, 0x0F, 0x24,
-    0x52, 0x17, 0xB1, 0x85, 0xCD, 0x84, 0x05, 0xAA, 0x41, 0xB2, 0x08, 0x42, 0xDD, 0x89, 0x41, 0x75,
-    0x61, 0x42, 0xE8, 0x88, 0xED, 0x28, 0x4F, 0x62, 0x2B, 0xE5, 0x63, 0x5A, 0x21, 0xD3, 0xFC, 0x04,
-    0x89, 0xB4, 0x12, 0xDB, 0x51, 0x3E, 0x5B, 0xFC, 0x6F, 0x66, 0x25, 0x28, 0x1F, 0x4D, 0xAA, 0x16,
-    0x25, 0xC4, 0x2F, 0x1D, 0xE4, 0x99, 0xC8, 0x0E, 0x69, 0x57, 0xFB, 0x48, 0xE5, 0x80, 0x94, 0x6F,
-    0xE1, 0x67, 0xE4, 0x37, 0x67, 0x73, 0xAF, 0xC4, 0xAF, 0xB1, 0x04, 0x91, 0x7F, 0x37, 0x63, 0xD1,
-    0x08, 0x68, 0x84, 0x8B, 0xFB, 0x79, 0xDF, 0x2F, 0x84, 0xF8, 0xEA, 0xCF, 0xD2, 0x69, 0x97, 0x12,
-    0x93, 0x52, 0x62, 0x37, 0x65, 0xBA, 0xDB, 0x25, 0x9D, 0xDE, 0x33, 0xE6, 0x33, 0x4A, 0xBD, 0x0F,
-    0x02, 0xA9, 0xB3, 0xB1, 0x21, 0x63, 0xC2, 0x9A, 0xEE, 0x1C, 0x24, 0x2F, 0x7A, 0x10, 0x38, 0x1B,
-    0xF2, 0x3E, 0x99, 0x41, 0xF1, 0x44, 0xB2, 0xB6, 0x68, 0x89, 0x24, 0x47, 0x13, 0xA9, 0x02, 0xC1,
-    0x71, 0x61, 0xCA, 0x88, 0x42, 0x72, 0x2F, 0xD0, 0x3B, 0x9F, 0x42, 0x4B, 0xB9, 0xC1, 0x5F, 0x92,
-    0x9B, 0x79, 0x6C, 0x79, 0x17, 0x4A, 0xAA, 0x4B, 0xA4, 0xB8, 0x0C, 0xF9, 0xA3, 0x77, 0xCD, 0x34,
-    0x39, 0x5E, 0x5C, 0xF6, 0xDF, 0x6F, 0x6B, 0x01, 0xA1, 0xDD, 0xCF, 0xB7, 0xAA, 0x55, 0x45, 0x17,
-    0x0B, 0xB4, 0x4F, 0x49, 0x58, 0x5A, 0x56, 0x2D, 0x24, 0xB7, 0x68, 0xD3, 0x31, 0xEF, 0xD3, 0x39,
-    0x1D, 0xD3, 0x19, 0x82, 0x1B, 0x5A, 0x09, 0xFC, 0x54, 0xC6, 0x4B, 0xCA, 0xED, 0x83, 0x42, 0x86,
-    0x41, 0xCC, 0xF5, 0x2C, 0xAB, 0x5A, 0x28, 0xB6, 0x15, 0x3D, 0x8C, 0x3C, 0xE5, 0x00, 0x4F, 0xFA,
-    0x82, 0x41, 0x9C, 0x28, 0x4F, 0x97, 0x1D, 0xA7, 0x48, 0x02, 0xED, 0xD3, 0x1A, 0xFE, 0x25, 0xDB,
-    0x80, 0xE7, 0x31, 0x73, 0x08, 0x56, 0xB6, 0x11, 0x88, 0xBF, 0x06, 0x20, 0x4E, 0x3A, 0x56, 0x10,
-    0x9F, 0xEA, 0xE6, 0xB0, 0x0D, 0x95, 0x12, 0x5D, 0x73, 0xDE, 0xDE, 0xF5, 0x46, 0xE5, 0xE7, 0x0D,
-    0x5E, 0xED, 0x5E, 0xF0, 0x2A, 0xE2, 0x4E, 0x0B, 0x03, 0x79, 0x17, 0x85, 0x2A, 0x3A, 0x08, 0xBC,
-    0x81, 0x89, 0xA1, 0xC4, 0x27, 0xAB, 0xEC, 0x11, 0x57, 0x53, 0xA8, 0x29, 0xF3, 0xC2, 0xB0, 0xB4,
-    0x85, 0xD0, 0xAB, 0xDA, 0xBA, 0xE0, 0x75, 0xD0, 0x2B, 0x36, 0x56, 0xE6, 0xCF, 0x55, 0x76, 0x06,
-    0xAD, 0x20, 0xA9, 0xC7, 0x27, 0xE9, 0x9B, 0x57, 0x27, 0x2E, 0x4E, 0x4C, 0x05, 0x78, 0xBF, 0xB0,
-    0xC8, 0x11, 0x9D, 0xB1, 0xF1, 0xA8, 0xE9, 0x18, 0x2D, 0xB7, 0x04, 0x1A, 0xB3, 0x56, 0x8C, 0x37,
-    0x72, 0xDB, 0x1D, 0xD8, 0x32, 0x91, 0x55, 0x69, 0x2E, 0x81, 0x35, 0x23, 0xA0, 0xEA, 0x91, 0xB0,
-    0x99, 0xC9, 0x68, 0x11, 0x58, 0x93, 0x89, 0x68, 0x97, 0x25, 0xAE, 0x8C, 0x25, 0x51, 0x8D, 0xF8,
-    0xF2, 0x2F, 0x23, 0x24, 0xB0, 0xB3, 0xFC, 0x90, 0xA1, 0x24, 0x56, 0x9B, 0xCF, 0xD8, 0x1E, 0xF2,
-    0x94, 0xA1, 0x9C, 0x29, 0x0C, 0xA9, 0x8B, 0xD5, 0xB0, 0x94, 0x03, 0x32, 0x89, 0x52, 0x8F, 0x08,
-    0x2F, 0x1A, 0x96, 0xA4, 0x42, 0x35, 0x80, 0xB1, 0x86, 0xA8, 0x31, 0xA3, 0x6A, 0x63, 0xF6, 0x7C,
-    0xA8, 0x89, 0x55, 0x2C, 0xBD, 0xA5, 0xD3, 0xC4, 0x86, 0x51, 0xE9, 0xC2, 0x4C, 0xAE, 0x7A, 0x12,
-    0x4B, 0xCA, 0x7A, 0xC8, 0x72, 0x38, 0x51, 0xBC, 0xCD, 0x99, 0xC2, 0xAD, 0x91, 0x70, 0x4F, 0x82,
-    0x8E, 0x48, 0xCD, 0x99, 0xBD, 0x03, 0xB6, 0x17, 0x53, 0x3A, 0x1F, 0x21, 0x46, 0xAA, 0x10, 0x75,
-    0xB6, 0xB1, 0xDA, 0x7D, 0xC4, 0xA5, 0xB6, 0x46, 0xE6, 0x97, 0xCE, 0x8C, 0xAB, 0xC4, 0xFE, 0x0F,
-    0xD8, 0x3E, 0x33, 0xA4, 0xCC, 0xAE, 0x3B, 0x09, 0xD4, 0xB2, 0x2D, 0x59, 0x30, 0x3F, 0xC4, 0x16,
-    0xB4, 0x5E, 0xCA, 0x8D, 0x34, 0x5A, 0xEA, 0xBC, 0xD5, 0x80, 0xED, 0x93, 0xFC, 0x58, 0xE2, 0x5A,
-    0xA1, 0x53, 0x83, 0x90, 0xB3, 0xC6, 0xAF, 0x4B, 0x76, 0x29, 0x61, 0x18, 0xD4, 0xC1, 0xDE, 0xFA,
-    0x0C, 0x83, 0x79, 0xFE, 0x4E, 0x41, 0x7A, 0x98, 0xDF, 0x53, 0x7A, 0xF8, 0x3F, 0x89, 0x31, 0x2D,
-    0xF7, 0xF8, 0x31, 0x3C, 0xA2, 0xCF, 0x59, 0xF7, 0x23, 0x8F, 0x5C, 0xB9, 0x56, 0x97, 0xE5, 0x73,
-    0x9E, 0xBB, 0x5F, 0x02, 0xAE, 0xD0, 0x12, 0x4A, 0xB6, 0xF1, 0x0F, 0x34, 0xA0, 0x39, 0x76, 0xBA,
-    0x5C, 0xEB, 0x48, 0xDA, 0x89, 0x2B, 0xE2, 0x86, 0x0F, 0x57, 0xF3, 0xAE, 0x64, 0xFA, 0x3F, 0x6A,
-    0x3A, 0xDA, 0xEF, 0x98, 0x5A, 0xE7, 0xCF, 0x35, 0x51, 0x3D, 0x5B, 0x33, 0xD8, 0x94, 0x0E, 0x6E,
-    0x19, 0x2D, 0xB9, 0xEB, 0xEB, 0x44, 0xFA, 0xDA, 0x3A, 0x14, 0x31, 0xF9, 0xD4, 0x88, 0xFA, 0x8C,
-    0xB1, 0xCC, 0x74, 0xC4, 0x29, 0x83, 0xA9, 0x2B, 0x8B, 0x07, 0x69, 0xAD, 0x05, 0x83, 0x50, 0xE3,
-    0x84, 0x62, 0x37, 0xC2, 0xD0, 0x1A, 0x0D, 0x82, 0xC8, 0x93, 0x93, 0xAF, 0x37, 0x70, 0xDA, 0xF6,
-    0xDB, 0xB6, 0x16, 0x51, 0x9A, 0xE4, 0x87, 0xC3, 0x66, 0x4D, 0xE4, 0xB2, 0x40, 0xD3, 0x31, 0xF0,
-    0xB9, 0x27, 0xD3, 0xE5, 0xEA, 0x62, 0x94, 0x6B, 0x4A, 0x31, 0x75, 0x89, 0x16, 0xFE, 0xF3, 0x6D,
-    0x1A, 0x56, 0xE3, 0x6D, 0xA7, 0x82, 0x20, 0x7F, 0x3E, 0xB0, 0x17, 0x4D, 0xD5, 0x67, 0xA3, 0xA9,
-    0xF6, 0xA2, 0x4E, 0xD4, 0xBB, 0x46, 0xC7, 0xEF, 0x56, 0xD6, 0x91, 0x3D, 0xFD, 0x4E, 0x7F, 0x29,
-    0xD5, 0xB0, 0xC7, 0xEE, 0x7C, 0xE3, 0x5A, 0x04, 0x2E, 0x68, 0x28, 0x77, 0xFC, 0xA8, 0xFC, 0x79,
-    0x4E, 0x85, 0xBD, 0xDC, 0x06, 0x4E, 0xAE, 0xC1, 0xA0, 0xE5, 0x3A, 0xE7, 0x05, 0x2A, 0xFE, 0x90,
-    0xB8, 0x6F, 0xBA, 0x6D, 0xFD, 0x72, 0xB7, 0xD7, 0x63, 0xAE, 0xD9, 0xD7, 0xBF, 0xA1, 0x15, 0x0F,
-    0x84, 0xD0, 0xC8, 0x83, 0x24, 0x12, 0xB0, 0xFF, 0x8C, 0xA8, 0x35, 0x26, 0xD3, 0x0D, 0x62, 0x19,
-    0xB6, 0xEC, 0x20, 0x6D, 0xAC, 0x3A, 0xA0, 0xE9, 0x20, 0x37, 0x66, 0x1D, 0xB5, 0xB8, 0xC3, 0xA8,
-    0x80, 0xB9, 0xF8, 0xA6, 0x40, 0xD6, 0x6D, 0x95, 0x31, 0xD6, 0x2D, 0x54, 0xDA, 0xA6, 0x21, 0x25,
-    0x12, 0xED, 0xB0, 0xD8, 0xAF, 0x0A, 0x9F, 0xC0, 0x77, 0xD8, 0xB8, 0x1E, 0x54, 0xA7, 0x04, 0x38,
-    0x71, 0x28, 0x51, 0xEC, 0x63, 0x5D, 0xE8, 0x6F, 0x45, 0xD2, 0x02, 0xED, 0xCA, 0x44, 0x4A, 0xD0,
-    0xB0, 0xD9, 0xA4, 0xFC, 0x1F, 0xF0, 0xF4, 0x1C, 0x9D, 0x07, 0x54, 0xAE, 0x7A, 0xA7, 0x2F, 0x0F,
-    0x7E, 0xD5, 0xB5, 0x8F, 0xC6, 0xBC, 0x73, 0x42, 0xAA, 0x02, 0xFA, 0x84, 0x89, 0xEA, 0xF3, 0xAA,
-    0xB5, 0xC7, 0xC7, 0x47, 0x07, 0xE8, 0x67, 0x5A, 0xF4, 0x47, 0x34, 0x26, 0xEB, 0x73, 0x50, 0xA7,
-    0xB1, 0x1A, 0x3C, 0xFA, 0x5A, 0x85, 0x56, 0x32, 0x58, 0x08, 0x1A, 0x18, 0x92, 0x31, 0xFC, 0x61,
-    0x68, 0x45, 0xC9, 0x68, 0x8D, 0xAF, 0x40, 0x19, 0xAD, 0x4F, 0xD5, 0xFA, 0x43, 0x35, 0xBA, 0xDE,
-    0x9E, 0x35, 0xAE, 0x2E, 0x36, 0x68, 0xAC, 0xC6, 0x0F, 0x24, 0x5A, 0x7B, 0xC4, 0x87, 0x52, 0x6F,
-    0x71, 0xAF, 0x56, 0xD3, 0x9A, 0x62, 0x32, 0xAE, 0xDA, 0x52, 0xEA, 0x0F, 0xCD, 0xA0, 0xF2, 0x9B,
-    0xC9, 0x07, 0xA2, 0x13, 0x6D, 0xCE, 0x22, 0x21, 0xBA, 0xA5, 0x9A, 0x67, 0xB4, 0x8D, 0xB5, 0x1B,
-    0x69, 0x52, 0xA9, 0x69, 0x06, 0xDF, 0x5D, 0x4B, 0xE0, 0x1A, 0x43, 0x8B, 0xE0, 0xA9, 0xA9, 0xC5,
-    0x62, 0x66, 0x5D, 0x38, 0xA2, 0x3A, 0x71, 0x69, 0x43, 0x9D, 0x23, 0xAA, 0x07, 0x23, 0x61, 0x76,
-    0x30, 0xB0, 0xF4, 0xE0, 0x53, 0x24, 0x28, 0x09, 0x9F, 0x6A, 0x25, 0xAC, 0xF5, 0x5D, 0x3C, 0x51,
-    0x89, 0x4B, 0xA8, 0x5D, 0x89, 0xC0, 0xC4, 0x2B, 0x42, 0xC4, 0xEA, 0x65, 0xF9, 0xC5, 0x64, 0x66,
-    0xF5, 0x11, 0xCD, 0x3A, 0xC9, 0x68, 0x10, 0xF1, 0x4D, 0x62, 0x76, 0x72, 0xC9, 0x73, 0x24, 0x8B,
-    0x62, 0x83, 0x71, 0x86, 0x01, 0x12, 0xF7, 0x27, 0xC2, 0x30, 0x40, 0xAD, 0x56, 0x96, 0x59, 0x3A,
-    0xB6, 0x1D, 0xE5, 0xAA, 0x27, 0x21, 0x8F, 0x4F, 0xA0, 0xDF, 0x68, 0x7F, 0x60, 0xCB, 0xD4, 0xCE,
-    0xF8, 0xD6, 0xC6, 0xAB, 0xAB, 0x10, 0x1F, 0xFC, 0x7C, 0x7C, 0xBC, 0x6A, 0x41, 0xFB, 0x1F, 0x96,
-    0x54, 0x62, 0xE6, 0x12, 0xFA, 0xA7, 0xFD, 0x59, 0x7C, 0x2C, 0x7F, 0x79, 0x7C, 0x3C, 0xC3, 0x90,
-    0x7E, 0x8F, 0x21, 0xF7, 0xDC, 0x58, 0xBF, 0x4E, 0xE5, 0x69, 0xCD, 0x07, 0x1B, 0xF9, 0xA7, 0xF3,
-    0x0E, 0xC5, 0x70, 0xF8, 0x9A, 0x30, 0x04, 0xCA, 0xD2, 0x7C, 0x17, 0xF9, 0xBE, 0x32, 0xE4, 0xC6,
-    0x8F, 0xC0, 0x90, 0x01, 0xB5, 0xAC, 0xF9, 0x2D, 0x18, 0x22, 0xCA, 0x99, 0xEE, 0x31, 0xA4, 0x7A,
-    0x3B, 0x0C, 0x11, 0x2B, 0xF6, 0xDB, 0xA0, 0xC2, 0x17, 0x65, 0x0D, 0xB7, 0x59, 0xC6, 0x9B, 0x4D,
-    0xDC, 0x0B, 0x2F, 0xC2, 0xF6, 0x4C, 0x52, 0x44, 0xEE, 0x69, 0x21, 0x8C, 0x2F, 0xB1, 0xF5, 0x74,
-    0x21, 0xD5, 0x55, 0x64, 0xB5, 0x4A, 0xD6, 0xBB, 0x64, 0xDD, 0xB5, 0x76, 0x5B, 0x67, 0xCB, 0xC9,
-    0x25, 0x3E, 0x3C, 0xB1, 0xBE, 0xBC, 0xAF, 0x2F, 0xAB, 0xCF, 0x7F, 0x58, 0x16, 0xA0, 0xF9, 0xD7,
-    0x1B, 0x4F, 0xB4, 0x4C, 0x1D, 0x5B, 0x6E, 0x0A, 0x6E, 0x30, 0x9F, 0x35, 0x8F, 0x25, 0x36, 0xEA,
-    0xAB, 0x35, 0x7F, 0x71, 0xB5, 0x4B, 0xFA, 0x82, 0x1D, 0x7E, 0x33, 0x3C, 0x13, 0x40, 0x5D, 0x43,
-    0x5D, 0x65, 0x10, 0xD2, 0xB7, 0xC1, 0x33, 0x56, 0x5D, 0x72, 0xD5, 0x33, 0x47, 0x65, 0xCB, 0xBE,
-    0xA7, 0x95, 0xC7, 0x3F, 0x8B, 0x81, 0xD5, 0x47, 0x58, 0xB9, 0x62, 0xB8, 0x6C, 0xEC, 0x4B, 0x42,
-    0x51, 0x38, 0x28, 0x30, 0xB4, 0x66, 0xB3, 0xE4, 0x8A, 0x33, 0x5D, 0xB3, 0x92, 0x87, 0x2F, 0xE1,
-    0xC9, 0xC9, 0xD7, 0xDE, 0xA1, 0xE4, 0x91, 0xC4, 0x55, 0x9E, 0xDF, 0x89, 0x28, 0xA2, 0xA2, 0x17,
-    0x10, 0x1A, 0xB2, 0x85, 0x50, 0xA0, 0xB8, 0x6B, 0xE5, 0x21, 0xB3, 0x88, 0x1E, 0x0C, 0x64, 0xCD,
-    0x1A, 0x6B, 0xEE, 0x9A, 0xEA, 0xAB, 0x5A, 0x08, 0x2A, 0x81, 0x36, 0x55, 0x1B, 0xD4, 0x36, 0x02,
-    0xA1, 0xD4, 0x17, 0x60, 0x57, 0x02, 0x0A, 0xFC, 0xC4, 0x2E, 0x46, 0xB0, 0xBD, 0xEF, 0x3F, 0x98,
-    0xF7, 0x69, 0x54, 0x1F, 0xAD, 0xE1, 0x8C, 0x88, 0x78, 0x74, 0x50, 0x00, 0x86, 0x20, 0xC1, 0xD1,
-    0x3B, 0x90, 0x4A, 0x25, 0xFB, 0xB0, 0x5D, 0x53, 0x66, 0x0F, 0xD8, 0xAF, 0xCE, 0xC2, 0xD3, 0x16,
-    0x34, 0x09, 0xF7, 0xAB, 0xD6, 0xFF, 0xEF, 0x42, 0x84, 0xBD, 0xF3, 0xF9, 0x30, 0x47, 0x01, 0x49,
-    0x84, 0x15, 0x72, 0x9B, 0xDC, 0x0D, 0x17, 0x8D, 0x9D, 0x73, 0x83, 0xAC, 0x25, 0x34, 0x83, 0xDB,
-    0x38, 0xF7, 0x07, 0x22, 0x91, 0x16, 0xE9, 0xD9, 0xCB, 0xB9, 0x6D, 0x3B, 0x38, 0x12, 0x65, 0xAB,
-    0xDB, 0xB5, 0x65, 0x14, 0xC4, 0x82, 0x47, 0x56, 0xBB, 0x72, 0x0E, 0x62, 0x92, 0x60, 0x31, 0xAE,
-    0x66, 0x92, 0x29, 0xC6, 0x62, 0x8B, 0xF2, 0x60, 0x92, 0x06, 0xFC, 0xC2, 0x02, 0x44, 0x85, 0x3C,
-    0x25, 0x1B, 0x76, 0x45, 0x08, 0x75, 0x72, 0xDB, 0x3E, 0x8E, 0x7D, 0x48, 0x1C, 0x26, 0xA1, 0x1D,
-    0xC4, 0x45, 0x84, 0x27, 0x21, 0x64, 0x46, 0xFE, 0x13, 0xC9, 0xC9, 0x91, 0x23, 0x5D, 0x2E, 0xDE,
-    0x18, 0x44, 0x6C, 0x2A, 0xDB, 0x55, 0xB6, 0xCC, 0x61, 0x5A, 0x4C, 0xDA, 0x22, 0x0D, 0x2A, 0x64,
-    0x27, 0x00, 0xD1, 0x18, 0x49, 0xAC, 0x32, 0x5F, 0xB6, 0xF9, 0xBC, 0xF7, 0x55, 0xD5, 0x66, 0xCB,
-    0xCB, 0xB9, 0x25, 0xC8, 0x03, 0x57, 0x9C, 0x71, 0xF6, 0x8A, 0x22, 0x74, 0x11, 0x15, 0x16, 0x77,
-    0xBF, 0x1D, 0xA2, 0x9D, 0x43, 0xF1, 0xBD, 0xCB, 0x4F, 0x51, 0x9C, 0x15, 0x12, 0x92, 0x70, 0xD9,
-    0xE0, 0xCA, 0xEE, 0xB3, 0x91, 0x9D, 0x33, 0x3B, 0x08, 0x0D, 0x22, 0xEE, 0xA0, 0x01, 0x72, 0x0A,
-    0xEF, 0x1D, 0x10, 0x1F, 0x62, 0x7D, 0x7B, 0x18, 0xE4, 0xF9, 0x52, 0xF1, 0xC6, 0x1B, 0xD6, 0xBE,
-    0x64, 0xE1, 0x66, 0xF3, 0x69, 0xD7, 0x07, 0x72, 0x03, 0xA1, 0xBF, 0x27, 0x85, 0xA2, 0xB2, 0x63,
-    0x40, 0x1F, 0x88, 0x15, 0xAA, 0xDF, 0x2A, 0x75, 0x0D, 0xCD, 0xA0, 0x2B, 0xA6, 0xDF, 0x9A, 0xCF,
-    0xF1, 0x5B, 0x81, 0xF7, 0x81, 0xF9, 0xC6, 0x07, 0xB6, 0x6E, 0x7F, 0xE7, 0xDC, 0xCB, 0xEC, 0xFB,
-    0xC0, 0xC1, 0x11, 0x67, 0xF5, 0xF7, 0xEA, 0xCE, 0xDE, 0x2B, 0xF6, 0xF7, 0x6A, 0x06, 0xCD, 0x9D,
-    0x53, 0xEB, 0xC5, 0x8B, 0xFD, 0xD4, 0x85, 0xEB, 0x2A, 0x88, 0x29, 0x73, 0x8E, 0xA3, 0x50, 0x59,
-    0xAA, 0x7D, 0x91, 0xED, 0x01, 0x8D, 0x02, 0x63, 0xEB, 0x90, 0x35, 0x8D, 0x8B, 0x06, 0x63, 0xEB,
-    0x30, 0x45, 0xB9, 0x0B, 0x13, 0xCD, 0x07, 0x4A, 0x2F, 0x83, 0xA8, 0x06, 0xA1, 0xB6, 0xDB, 0x22,
-    0x31, 0x90, 0x44, 0x01, 0x51, 0x29, 0x1D, 0x9F, 0x2C, 0x56, 0x22, 0xE1, 0x60, 0xDD, 0xC2, 0x72,
-    0x76, 0x6A, 0x05, 0x83, 0xB9, 0x26, 0x89, 0x80, 0x64, 0x46, 0x08, 0x32, 0xE4, 0x39, 0x10, 0x55,
-    0x98, 0x3B, 0x09, 0x68, 0x33, 0x0A, 0x27, 0x64, 0x15, 0x86, 0x0A, 0xD9, 0x81, 0xDC, 0x1C, 0xBA,
-    0x8B, 0x84, 0x9E, 0x2D, 0x33, 0xF9, 0x47, 0x42, 0x07, 0x2A, 0x0F, 0x86, 0x41, 0xC4, 0xB3, 0x4B,
-    0x6D, 0x28, 0xC1, 0xD3, 0x8A, 0x44, 0x27, 0x28, 0xA4, 0x03, 0x68, 0x15, 0x5B, 0x54, 0xE0, 0x0D,
-    0x3A, 0x69, 0x3D, 0x62, 0xE4, 0x9C, 0x81, 0x99, 0x26, 0xB7, 0x8A, 0x1B, 0x62, 0x2E, 0xF1, 0x31,
-    0x5A, 0xB0, 0xE2, 0xDF, 0x54, 0x02, 0x5D, 0x5C, 0xA0, 0x0D, 0x8E, 0x8E, 0xD9, 0xBF, 0x37, 0x3A,
-    0x87, 0xF5, 0x4E, 0x21, 0xD5, 0x37, 0xB4, 0x7B, 0x16, 0x0D, 0x70, 0x9F, 0xC8, 0xC6, 0x64, 0x4F,
-    0x8D, 0x34, 0x32, 0xE9, 0xCC, 0xE7, 0x4E, 0xEB, 0x05, 0x4A, 0xF2, 0xC6, 0x61, 0xCC, 0xBC, 0xC6,
-    0x6B, 0x2E, 0x78, 0x41, 0xA1, 0x71, 0x27, 0xD5, 0xE2, 0xA3, 0x69, 0x82, 0x7D, 0x76, 0x40, 0x53,
-    0xEC, 0x7A, 0xF0, 0x3F, 0xF3, 0x37, 0x35, 0xCD, 0x75, 0x58, 0x80, 0x9F, 0xF9, 0x9B, 0xDB, 0x8B,
-    0xDF, 0xA3, 0xBA, 0x37, 0xB2, 0x42, 0x53, 0x51, 0x12, 0x12, 0x4F, 0x1C, 0xAD, 0x90, 0xF0, 0xDA,
-    0x83, 0xAF, 0x9C, 0xDA, 0xAA, 0xE6, 0x51, 0x56, 0xDB, 0xB9, 0x8A, 0x71, 0xC2, 0xDA, 0xF3, 0x1F,
-    0xCC, 0xBE, 0xA2, 0x26, 0xB2, 0xB1, 0x5C, 0x50, 0x50, 0x53, 0x14, 0x17, 0x7F, 0x69, 0xE6, 0x42,
-    0xF1, 0x7A, 0xCF, 0x8D, 0x69, 0x8B, 0x73, 0x53, 0xD9, 0x55, 0xF8, 0x9A, 0xBE, 0x6A, 0xEA, 0xDC,
-    0xF4, 0x9B, 0xC7, 0x1A, 0x57, 0xC7, 0xDC, 0xF4, 0x2F, 0x5D, 0xE2, 0x18, 0xD9, 0x6D, 0xC2, 0x1F,
-    0xEF, 0xA4, 0xE0, 0xE9, 0x0E, 0x40, 0x25, 0xDF, 0xDC, 0xFE, 0xB7, 0x78, 0xCB, 0xE2, 0x15, 0xD7,
-    0xF8, 0x20, 0x11, 0x08, 0x18, 0xE0, 0xA6, 0x62, 0x15, 0x0D, 0x98, 0x8C, 0xAB, 0xEA, 0x3A, 0x5E,
-    0x50, 0x8B, 0x2E, 0xF6, 0x84, 0xA5, 0xA7, 0xEB, 0x89, 0x8B, 0x99, 0x41, 0x52, 0x36, 0xEE, 0x6B,
-    0x12, 0x9E, 0x14, 0x06, 0x3C, 0xB0, 0xE4, 0x72, 0xB9, 0x9D, 0xD8, 0x2A, 0x63, 0xF3, 0x59, 0xF7,
-    0x62, 0xDF, 0x74, 0x2B, 0x75, 0x35, 0x19, 0xA7, 0x8E, 0x95, 0x75, 0x92, 0xAB, 0x25, 0xF2, 0x74,
-    0xAD, 0x14, 0xEA, 0x32, 0x12, 0x7A, 0x21, 0xC6, 0xC1, 0x2A, 0xE5, 0x14, 0x5A, 0x86, 0xFA, 0xBD,
-    0x7A, 0xEB, 0x48, 0x01, 0x0D, 0x25, 0xAB, 0x0B, 0xF9, 0x42, 0xCF, 0x89, 0x20, 0x39, 0xB5, 0x13,
-    0x6D, 0x75, 0x4A, 0xFC, 0x0E, 0xDA, 0xC8, 0x2A, 0xEE, 0xC1, 0xAE, 0xAB, 0x0D, 0x1D, 0xF8, 0xCE,
-    0xFB, 0x82, 0xC2, 0x75, 0x66, 0xEC, 0x3E, 0x36, 0x4F, 0xB3, 0x45, 0xDF, 0x7E, 0x80, 0x07, 0xDF,
-    0x24, 0x40, 0xCD, 0xE2, 0xC2, 0x6D, 0x28, 0xA5, 0x44, 0xDB, 0x8B, 0x27, 0x36, 0x5F, 0x78, 0x5F,
-    0x52, 0x9D, 0xDC, 0x2C, 0x7A, 0x89, 0x78, 0x8A, 0xEF, 0xCA, 0x0E, 0xAB, 0x6F, 0xCB, 0x4B, 0x73,
-    0xE3, 0x7B, 0x8B, 0xB1, 0xDF, 0x8C, 0xE4, 0x65, 0x00, 0xF0, 0xA7, 0x8B, 0x27, 0x00, 0x5E, 0x91,
-    0xE4, 0x54, 0x5D, 0x24, 0x11, 0x39, 0x6C, 0x14, 0x2A, 0x20, 0xB2, 0xF4, 0x64, 0xA5, 0xFB, 0x47,
-    0x62, 0x3E, 0x8B, 0xD6, 0x67, 0x93, 0x58, 0xC9, 0x7C, 0x4C, 0xED, 0x57, 0x8A, 0x21, 0x46, 0x84,
-    0x2D, 0x51, 0xBA, 0x7C, 0x4C, 0x0A, 0x07, 0x7E, 0x73, 0xA3, 0x4F, 0xF9, 0xA3, 0xED, 0xCB, 0xE8,
-    0xB1, 0x49, 0x79, 0xBD, 0x83, 0xC7, 0xBB, 0x7C, 0x28, 0x01, 0xD6, 0x22, 0xCE, 0x35, 0x5B, 0xD1,
-    0x95, 0x5E, 0x1F, 0xB7, 0x4F, 0x8A, 0x38, 0xD8, 0x2F, 0xAD, 0xCF, 0x05, 0xF6, 0x13, 0x70, 0x02,
-    0x05, 0xF0, 0x19, 0xCF, 0x1B, 0x6D, 0x87, 0x10, 0x76, 0xC9, 0xFD, 0x26, 0x0B, 0x57, 0xD5, 0x20,
-    0x1C, 0xA9, 0x24, 0x35, 0x9A, 0x8A, 0xFE, 0x7D, 0x92, 0x5C, 0x4F, 0x4F, 0x48, 0x96, 0x67, 0x97,
-    0x62, 0x60, 0xF0, 0x2F, 0x8A, 0x52, 0x75, 0x4A, 0x52, 0x2D, 0xCC, 0x7F, 0x88, 0x32, 0xDA, 0x6D,
-    0x08, 0x4D, 0xF4, 0x0C, 0xF1, 0x3F, 0x0A, 0xB0, 0x52, 0xDD, 0x3E, 0x2C, 0xCF, 0xF6, 0xFE, 0xBC,
-    0x7D, 0x51, 0xA4, 0x71, 0x4E, 0x91, 0x55, 0xE5, 0xD7, 0xBE, 0x9E, 0x1D, 0x36, 0xF5, 0x1B, 0x35,
-    0x3D, 0xD5, 0xB8, 0x51, 0x7F, 0xB5, 0x0B, 0x6A, 0x03, 0xA8, 0x49, 0xE7, 0xFC, 0x62, 0xED, 0x4C,
-    0x46, 0x0F, 0x5B, 0x92, 0xF4, 0xDA, 0xEC, 0x93, 0x5F, 0x14, 0xCE, 0x03, 0x5F, 0x2B, 0xD9, 0xCE,
-    0xEB, 0xCF, 0xD8, 0x6F, 0xB1, 0x09, 0xC2, 0xF6, 0xCC, 0xE0, 0xA0, 0x2C, 0xFC, 0x23, 0x0A, 0x2F,
-    0xFB, 0xAC, 0x90, 0x2B, 0x75, 0x99, 0x7D, 0x2D, 0xB0, 0xD7, 0xCD, 0x7B, 0x8D, 0x2F, 0xC8, 0x86,
-    0xEC, 0x52, 0xD4, 0x88, 0xCD, 0x1E, 0x55, 0xBB, 0x0E, 0x55, 0x15, 0x96, 0x41, 0x4B, 0xC9, 0x55,
-    0xEA, 0x74, 0xCE, 0x4A, 0xEF, 0x05, 0x5F, 0xD7, 0x3B, 0x5F, 0xC7, 0xF6, 0x92, 0xA9, 0xFE, 0x7B,
-    0x48, 0xE8, 0x68, 0x3A, 0x96, 0x4D, 0x26, 0x95, 0x48, 0x46, 0x7B, 0x2E, 0xDC, 0x64, 0xE5, 0x29,
-    0x54, 0x78, 0xEC, 0x59, 0x52, 0xCC, 0x1B, 0x3B, 0x79, 0x01, 0x29, 0x18, 0x07, 0x5D, 0x40, 0x43,
-    0xB8, 0xEB, 0x7B, 0xE9, 0xEB, 0x9F, 0x77, 0x5D, 0x23, 0xD4, 0xBA, 0x3A, 0x22, 0x62, 0x25, 0x00,
-    0x3F, 0x69, 0x66, 0xB6, 0x8C, 0x3A, 0xE6, 0xC0, 0x0E, 0xA7, 0xB1, 0x6F, 0x09, 0xB7, 0x56, 0x4B,
-    0xEB, 0x52, 0x1A, 0xEC, 0xF1, 0x63, 0xAD, 0x5A, 0xD1, 0xD8, 0xBA, 0x36, 0xE0, 0x15, 0x64, 0xB6,
-    0xA2, 0xD3, 0x10, 0xBB, 0x47, 0xE9, 0x9A, 0x89, 0xBD, 0x98, 0x40, 0x20, 0xF5, 0xA6, 0x10, 0xFE,
-    0x9C, 0xE1, 0xA3, 0xFF, 0xB9, 0x87, 0xEA, 0xD1, 0xA3, 0x92, 0x78, 0x0D, 0x51, 0x1A, 0x29, 0x22,
-    0xB7, 0x4B, 0x81, 0xFD, 0xB6, 0x64, 0xCD, 0x43, 0x6E, 0x47, 0x90, 0x4E, 0x68, 0xA0, 0xA0, 0x8B,
-    0x68, 0x60, 0xC9, 0xB2, 0xA9, 0x11, 0xFD, 0x25, 0x03, 0x1E, 0x2E, 0xFF, 0x85, 0xFD, 0x6E, 0xB5,
-    0xD4, 0x55, 0x53, 0xE5, 0x5B, 0x09, 0xA7, 0x1E, 0x64, 0x1F, 0x7D, 0x20, 0xBC, 0x73, 0xAA, 0xE0,
-    0x3D, 0xC6, 0x1C, 0xBD, 0xE6, 0x2E, 0x05, 0x30, 0x67, 0x88, 0x7A, 0x92, 0xF9, 0xB1, 0x2D, 0xA6,
-    0xAC, 0xDE, 0x36, 0x94, 0xD5, 0x5D, 0x15, 0xF3, 0xD6, 0x51, 0xAA, 0xDD, 0xBC, 0xF0, 0x6B, 0x70,
-    0xE9, 0x8F, 0xC9, 0x09, 0x79, 0x86, 0x7C, 0x2D, 0x7A, 0x2C, 0x5F, 0x27, 0x23, 0x3B, 0x81, 0xB3,
-    0x6B, 0xD4, 0x11, 0xA9, 0x53, 0x6A, 0x87, 0xCE, 0xF5, 0xC9, 0xC5, 0xE6, 0x5D, 0x12, 0xA1, 0x7C,
-    0x60, 0x12, 0xFA, 0x15, 0x22, 0xBD, 0x4F, 0xCD, 0x07, 0xD5, 0x58, 0x49, 0x10, 0x22, 0x7B, 0x28,
-    0x86, 0x05, 0xD5, 0x98, 0x56, 0xA2, 0x10, 0xD0, 0xE6, 0x50, 0xFD, 0x4B, 0x36, 0xBB, 0x42, 0x72,
-    0xE1, 0xF1, 0xA9, 0xC4, 0x4A, 0x7A, 0xD8, 0x2B, 0x6D, 0x1B, 0xAF, 0x9B, 0x4E, 0x5F, 0x57, 0x0D,
-    0x80, 0xA4, 0xE7, 0xA0, 0xC4, 0xA0, 0x35, 0xA4, 0x46, 0x56, 0xCD, 0x7D, 0x1F, 0x6C, 0x13, 0x31,
-    0x17, 0xD0, 0xAA, 0x1A, 0x27, 0x5A, 0xBD, 0xD0, 0x20, 0x40, 0x77, 0x6D, 0x77, 0x5F, 0x7B, 0xA5,
-    0x49, 0x80, 0xC8, 0xA9, 0x8D, 0x89, 0x28, 0xC2, 0x86, 0xC5, 0x52, 0x82, 0xD5, 0x65, 0x8A, 0x52,
-    0x6F, 0x19, 0x5E, 0x77, 0xA5, 0x7E, 0x25, 0xB4, 0x12, 0x4C, 0x55, 0x59, 0xA4, 0x53, 0xDC, 0xB1,
-    0xCA, 0xA8, 0xD2, 0x8B, 0xBA, 0xAC, 0x6D, 0x7B, 0x15, 0x52, 0x25, 0x97, 0x53, 0x66, 0x78, 0x08,
-    0xD6, 0x8B, 0xD9, 0xED, 0x11, 0xD1, 0xC0, 0xCA, 0x14, 0x5B, 0xEF, 0x5C, 0xAE, 0xC3, 0x60, 0xF1,
-    0x43, 0x38, 0xB7, 0x50, 0x11, 0x57, 0x79, 0x59, 0x0C, 0x62, 0xF3, 0xE6, 0x6C, 0x8E, 0xD7, 0x44,
-    0x82, 0xEC, 0xFB, 0xAD, 0x10, 0xE9, 0x0F, 0x3C, 0x7E, 0x8B, 0xD9, 0x2B, 0x39, 0xAC, 0xD8, 0xAD,
-    0x52, 0xA8, 0xFC, 0x1C, 0x36, 0x0F, 0x05, 0x2D, 0x49, 0x26, 0xAE, 0xFA, 0xC8, 0xFC, 0xDC, 0x4A,
-    0xFC, 0x71, 0xE4, 0x21, 0x70, 0x14, 0x86, 0xB9, 0xB0, 0xC2, 0xE3, 0x51, 0x35, 0x72, 0x88, 0x61,
-    0x07, 0x3F, 0xC4, 0x05, 0x7F, 0xF6, 0x7F, 0x50, 0xE2, 0x2B, 0xA4, 0x0F, 0x1C, 0x2C, 0xC8, 0xF3,
-    0xE8, 0x79, 0xC9, 0xA8, 0x03, 0xCB, 0x7F, 0x58, 0xC4, 0x0E, 0xC5, 0x9F, 0x1A, 0x5E, 0x3A, 0x5B,
-    0x58, 0x13, 0x6E, 0xE0, 0xAB, 0x67, 0x73, 0xAF, 0xBF, 0x7E, 0x55, 0xE9, 0xE1, 0xF5, 0x97, 0x48,
-    0x13, 0x11, 0x1D, 0x90, 0x04, 0x9A, 0x09, 0x8A, 0x6C, 0xD1, 0x69, 0xBE, 0x46, 0xFB, 0x45, 0xB3,
-    0xEF, 0xAE, 0x73, 0x57, 0xDF, 0xCD, 0x5C, 0x24, 0x1F, 0xBB, 0xB9, 0x0E, 0x17, 0x04, 0x9E, 0xE3,
-    0x4B, 0x7C, 0x51, 0xE0, 0xC8, 0x04, 0x9A, 0x13, 0x21, 0x0D, 0x9A, 0x19, 0x92, 0x25, 0x9E, 0xEF,
-    0x39, 0x7A, 0x7F, 0x80, 0xCE, 0x16, 0xCC, 0xF1, 0x26, 0x8C, 0x66, 0x40, 0x9C, 0x5B, 0x36, 0x45,
-    0xD0, 0x3A, 0xA4, 0xDD, 0x82, 0x24, 0x03, 0xA3, 0x0A, 0x10, 0x6B, 0xCA, 0x34, 0x59, 0x52, 0x37,
-    0x56, 0x17, 0x7E, 0x20, 0xFE, 0x14, 0x51, 0xE6, 0x92, 0xAD, 0x0C, 0xAE, 0x8B, 0x56, 0x2C, 0x0E,
-    0xEE, 0x35, 0xC7, 0xF6, 0x29, 0xDE, 0xAB, 0x2D, 0x66, 0xB6, 0xA0, 0xC5, 0xEF, 0xBF, 0xC2, 0x7B,
-    0x95, 0xA9, 0x05, 0xEA, 0x35, 0x1B, 0x34, 0x0E, 0x65, 0x8A, 0xCB, 0xEC, 0xB2, 0xD7, 0xD0, 0x4C,
-    0xAC, 0x93, 0x56, 0xB3, 0x8B, 0x4E, 0xBB, 0xEC, 0xE8, 0xCC, 0x54, 0x4C, 0xB9, 0x57, 0x82, 0xEF,
-    0xD8, 0xD8, 0x64, 0x15, 0x91, 0x98, 0x1C, 0x97, 0x13, 0xED, 0x01, 0xFC, 0xEE, 0xDD, 0x86, 0x36,
-    0x4D, 0xEB, 0x23, 0x15, 0x35, 0xC4, 0x84, 0x2A, 0xA4, 0x54, 0x3B, 0xCD, 0x26, 0xCC, 0x59, 0xA4,
-    0xCA, 0x35, 0x04, 0x29, 0x95, 0x78, 0xC1, 0x45, 0xC2, 0xD8, 0x0A, 0xB9, 0xE8, 0xAB, 0x0C, 0xB3,
-    0x46, 0xB1, 0xBF, 0x76, 0x89, 0x31, 0xFE, 0x50, 0x36, 0x1D, 0xC6, 0x0D, 0x5C, 0xA9, 0x10, 0xC3,
-    0x22, 0x93, 0x4E, 0x29, 0x88, 0xA4, 0xB1, 0x54, 0xE8, 0x93, 0x55, 0x8E, 0xFF, 0xBC, 0x07, 0xA5,
-    0xC2, 0x57, 0x5E, 0xC6, 0xA8, 0xCF, 0x52, 0xC0, 0x4B, 0xBE, 0xA8, 0x95, 0xC7, 0xCE, 0x99, 0x84,
-    0xA3, 0x5F, 0x55, 0x46, 0x6D, 0xBA, 0x37, 0xDB, 0xEF, 0xE3, 0xD9, 0x27, 0x22, 0xEE, 0x83, 0xC4,
-    0x57, 0x4E, 0xEC, 0x5E, 0x86, 0xC2, 0x44, 0xED, 0x97, 0xCB, 0x33, 0xA7, 0x92, 0x58, 0x8E, 0xA2,
-    0x86, 0xD9, 0x76, 0xD2, 0x88, 0x9B, 0xBD, 0xA9, 0x78, 0xD8, 0xB4, 0x1D, 0x7E, 0xDF, 0x67, 0xA2,
-    0x6E, 0x9C, 0x01, 0x88, 0x7E, 0x1D, 0xE9, 0xE9, 0x7D, 0x3F, 0xEC, 0x4B, 0x1A, 0x7C, 0x47, 0xEB,
-    0x46, 0xD7, 0x1D, 0x05, 0x9A, 0x61, 0x3F, 0x96, 0xFF, 0xD5, 0xD6, 0xF1, 0xC7, 0xCC, 0xEF, 0x82,
-    0xE8, 0x59, 0x2F, 0x34, 0x84, 0xF4, 0xA4, 0x3D, 0xDD, 0x01, 0x76, 0x43, 0x78, 0x3A, 0x0A, 0x6B,
-    0x5C, 0xC4, 0x66, 0x60, 0xC7, 0xEC, 0x0D, 0x1A, 0x49, 0x22, 0x90, 0x4B, 0x90, 0x25, 0x76, 0xBF,
-    0x6B, 0xEC, 0x4B, 0xD6, 0x1E, 0xDE, 0x58, 0x14, 0x1D, 0xFE, 0x10, 0xFB, 0x33, 0x60, 0xFF, 0x28,
-    0x26, 0x3E, 0xD7, 0x59, 0xAF, 0x16, 0xF2, 0x32, 0x05, 0x18, 0xEB, 0x43, 0xAC, 0xC5, 0xFE, 0x8C,
-    0xA2, 0x62, 0xE9, 0xA9, 0x39, 0x23, 0xF6, 0x97, 0x70, 0xD4, 0x5F, 0xC4, 0x78, 0x9E, 0x7D, 0x79,
-    0xA7, 0x1D, 0xB0, 0xEC, 0xB4, 0x03, 0xAE, 0xEC, 0xC9, 0x74, 0xB1, 0x37, 0x01, 0x15, 0xF8, 0xB1,
-    0x3B, 0xFD, 0xD2, 0x8D, 0x1D, 0x39, 0xA9, 0x60, 0x19, 0x31, 0x10, 0x62, 0x73, 0xD9, 0x11, 0x4A,
-    0x63, 0x85, 0x2D, 0x67, 0x15, 0x72, 0x13, 0x3C, 0x63, 0x2B, 0x05, 0x56, 0xDB, 0x2F, 0x69, 0x7F,
-    0xED, 0x7E, 0x16, 0xDB, 0x20, 0xEB, 0xA0, 0x66, 0x5B, 0x68, 0xC5, 0x4D, 0xC3, 0x99, 0x9E, 0x0F,
-    0xA4, 0xC8, 0x33, 0x14, 0x76, 0x85, 0x40, 0xBD, 0x86, 0x0E, 0x5C, 0x25, 0x5F, 0x01, 0xD7, 0x9F,
-    0x2A, 0x0D, 0xB7, 0xD4, 0xF1, 0x1A, 0xCB, 0x78, 0x3D, 0x25, 0x4A, 0xA4, 0x74, 0xF1, 0x9B, 0xAB,
-    0xBA, 0xBD, 0xDB, 0xA5, 0xCF, 0x99, 0x1B, 0xC7, 0x90, 0x0F, 0x05, 0xD6, 0x59, 0x1F, 0xE7, 0x9B,
-    0xED, 0xCD, 0xD9, 0xA9, 0xAB, 0xF5, 0xBD, 0x58, 0x37, 0x0D, 0xE7, 0x7D, 0xF3, 0xB6, 0x15, 0x5E,
-    0x92, 0x8B, 0x34, 0x53, 0x94, 0x3D, 0xB5, 0x52, 0x14, 0x3D, 0x18, 0x29, 0x4A, 0x9E, 0xD8, 0xA8,
-    0x64, 0x21, 0xCF, 0x10, 0x00, 0xA2, 0xED, 0x9C, 0x4D, 0x09, 0x84, 0x8F, 0xAC, 0x22, 0x5A, 0x1E,
-    0x52, 0x87, 0xAA, 0xA7, 0x84, 0x75, 0x13, 0x47, 0x4A, 0x03, 0x70, 0x1A, 0x06, 0xB0, 0xA3, 0x97,
-    0xE3, 0x4B, 0xE2, 0x13, 0xF5, 0xA7, 0x85, 0xB3, 0xE1, 0x54, 0x81, 0x81, 0x5A, 0x52, 0x44, 0xA6,
-    0xCB, 0xAA, 0x90, 0x6B, 0x59, 0x53, 0x6B, 0xB4, 0xC3, 0xE6, 0xCA, 0xB0, 0x17, 0x4F, 0xF7, 0xDE,
-    0x47, 0xE8, 0x7C, 0xE5, 0xB2, 0x53, 0x37, 0x13, 0x6B, 0xD1, 0xF9, 0xBA, 0xF5, 0x49, 0xE4, 0x19,
-    0xE0, 0x7F, 0x8B, 0x8A, 0x77, 0xB5, 0xC4, 0x2C, 0x9D, 0xA2, 0xE7, 0x25, 0x57, 0x66, 0x0C, 0x22,
-    0x7F, 0xAC, 0xBF, 0xA6, 0x0D, 0xC1, 0x37, 0xD9, 0x0E, 0x24, 0xB2, 0x22, 0xB4, 0x37, 0x19, 0x63,
-    0xAF, 0x3A, 0x1E, 0xF0, 0x2A, 0x71, 0x04, 0xB3, 0x65, 0x7B, 0xE1, 0xCB, 0x0C, 0x3D, 0x07, 0x5C,
-    0x96, 0xB3, 0x87, 0x17, 0xF3, 0x01, 0x42, 0x2B, 0xD9, 0x45, 0xD0, 0x38, 0x18, 0x61, 0xCD, 0x9E,
-    0x24, 0x07, 0xA7, 0x74, 0xD2, 0x53, 0x89, 0xEF, 0xC6, 0xAB, 0x20, 0x9F, 0x7B, 0x8D, 0xA6, 0xE9,
-    0xCC, 0x14, 0x6F, 0x40, 0xD6, 0x2D, 0x24, 0x01, 0x31, 0x50, 0x5D, 0x60, 0x6F, 0xA3, 0xB2, 0x52,
-    0x56, 0xA4, 0xFC, 0x88, 0x0A, 0xE6, 0x54, 0x20, 0xB4, 0x16, 0x85, 0x29, 0xE0, 0x57, 0x8A, 0x11,
-    0x09, 0xD7, 0x80, 0x3E, 0xEF, 0x80, 0x2A, 0x6A, 0x0F, 0x50, 0x66, 0x6B, 0x25, 0xA9, 0xAE, 0x1B,
-    0xC9, 0x5B, 0x85, 0x04, 0xD5, 0x8C, 0x65, 0x0D, 0x7A, 0x4F, 0x25, 0xFA, 0x1E, 0xCE, 0xFA, 0xF7,
-    0x4D, 0xA8, 0x89, 0x16, 0x60, 0x4C, 0x4D, 0x5D, 0x19, 0x57, 0xFA, 0xDD, 0x0C, 0xEE, 0x6A, 0xAD,
-    0xF2, 0x9C, 0xB1, 0xDD, 0xA0, 0xB9, 0xA5, 0xBC, 0xD3, 0xC8, 0x99, 0xB8, 0x16, 0x6E, 0xBD, 0xB2,
-    0x7F, 0xD3, 0x40, 0x05, 0x30, 0xB7, 0x10, 0xB1, 0x0F, 0xD4, 0xA1, 0xCE, 0x54, 0xAC, 0xA9, 0xC5,
-    0x50, 0xC6, 0x1B, 0x3A, 0x0C, 0x5B, 0xAC, 0xCA, 0x0E, 0x72, 0xA0, 0x22, 0x07, 0x88, 0x6C, 0xC8,
-    0x1D, 0x07, 0x94, 0x1D, 0x8B, 0x22, 0xAF, 0xFE, 0x85, 0x19, 0x01, 0x40, 0x21, 0xB2, 0x91, 0x84,
-    0xB8, 0xAD, 0xBE, 0x82, 0xCE, 0xF0, 0x01, 0x62, 0x6C, 0x72, 0xDB, 0xDD, 0xE7, 0xD0, 0xCA, 0x3A,
-    0xAA, 0xA0, 0x64, 0x5C, 0x29, 0x2F, 0x8A, 0x30, 0x7E, 0xD8, 0xD5, 0x45, 0x2E, 0x01, 0x62, 0xFC,
-    0x1B, 0x70, 0x65, 0xCF, 0xC9, 0x95, 0x5F, 0xE5, 0x90, 0xD8, 0xA0, 0x16, 0xC1, 0xDC, 0x77, 0xCB,
-    0xFC, 0xD2, 0x39, 0x82, 0x74, 0x0A, 0x13, 0x8E, 0xF1, 0x18, 0x68, 0x79, 0x8B, 0x6A, 0xD4, 0x4C,
-    0x05, 0xAB, 0x60, 0xDF, 0x01, 0x57, 0xB2, 0x35, 0x51, 0x73, 0x42, 0x8B, 0xF0, 0x9B, 0x26, 0x29,
-    0x2F, 0xE0, 0x8E, 0x53, 0x13, 0xC7, 0x9E, 0xD4, 0xA3, 0x64, 0xC0, 0x1F, 0xA7, 0x28, 0x8E, 0x41,
-    0x4E, 0x53, 0x94, 0x43, 0x83, 0xAA, 0xCA, 0xA0, 0x2C, 0x1A, 0x54, 0x57, 0x06, 0xE5, 0xD1, 0xA0,
-    0xCA, 0xD2, 0x2B, 0x93, 0xDC, 0x5B, 0xA7, 0x5C, 0x6A, 0x55, 0x5D, 0x6A, 0x65, 0x93, 0x51, 0x7D,
-    0x31, 0xCA, 0x27, 0xA3, 0x0A, 0x63, 0x1C, 0xA3, 0x9C, 0xC6, 0x38, 0x4E, 0x39, 0x95, 0xF1, 0xAC,
-    0xDA, 0x8E, 0x24, 0xA2, 0xFA, 0xFF, 0xA7, 0x18, 0x2B, 0x8F, 0x47, 0x58, 0x58, 0xFB, 0x71, 0xC8,
-    0x51, 0x8F, 0x52, 0xDD, 0x24, 0xA6, 0x33, 0x58, 0x11, 0x99, 0x15, 0x18, 0x11, 0x0A, 0xBB, 0xF4,
-    0x1C, 0xD4, 0x55, 0xE0, 0x6E, 0x3E, 0x91, 0x10, 0x9D, 0x08, 0xCA, 0x0D, 0x98, 0x62, 0xE1, 0x1E,
-    0x63, 0xAD, 0x92, 0xEC, 0x8B, 0xD0, 0x2A, 0xA8, 0xC9, 0xBF, 0x98, 0xDF, 0x92, 0x81, 0x29, 0x67,
-    0x9D, 0xC8, 0xC1, 0x94, 0x2D, 0x03, 0xB2, 0x10, 0xD0, 0xF0, 0x41, 0x79, 0x18, 0x11, 0x76, 0x40,
-    0x26, 0xBA, 0xEE, 0x86, 0xE7, 0xE2, 0xE3, 0xDF, 0x00, 0xC4, 0xD8, 0x43, 0x13, 0xFC, 0x66, 0x2D,
-    0x37, 0x6F, 0xAD, 0x9F, 0x45, 0x14, 0x83, 0x79, 0x15, 0x13, 0x6C, 0xB5, 0xC2, 0xE9, 0x91, 0x41,
-    0xA2, 0xB2, 0xC2, 0x49, 0x44, 0x24, 0xDD, 0x1C, 0x4C, 0x84, 0x19, 0xFD, 0x74, 0xA4, 0x20, 0x28,
-    0x87, 0xA0, 0xDA, 0x74, 0x51, 0x37, 0xFD, 0x4F, 0xDC, 0x9E, 0x30, 0x48, 0x82, 0x91, 0x13, 0xAB,
-    0x60, 0xCA, 0x8E, 0x25, 0x3A, 0x62, 0x91, 0x37, 0x57, 0x13, 0x3E, 0xC9, 0xD6, 0x20, 0x87, 0xDA,
-    0x1D, 0x80, 0x48, 0x61, 0xC9, 0x60, 0xAF, 0xEC, 0x1C, 0x0B, 0x68, 0x91, 0x2C, 0xC6, 0x30, 0x6E,
-    0xC8, 0x27, 0xA3, 0x59, 0xC1, 0x16, 0x27, 0xA4, 0x9D, 0xFE, 0x51, 0x5B, 0x47, 0x73, 0x17, 0x10,
-    0x2B, 0x49, 0x9B, 0xBD, 0x69, 0x47, 0x07, 0x1B, 0xB8, 0xFD, 0x21, 0xC7, 0x96, 0xD0, 0x0C, 0xC3,
-    0xA9, 0x04, 0x13, 0xBA, 0xD6, 0xA2, 0x41, 0x16, 0xD8, 0x7B, 0xA1, 0xF6, 0x18, 0xCF, 0x50, 0xA3,
-    0xD5, 0x34, 0xDF, 0xD2, 0x48, 0x67, 0xA4, 0x2E, 0x45, 0x98, 0xE1, 0x8F, 0x24, 0x90, 0x00, 0xF2,
-    0xAD, 0x00, 0x5E, 0x9C, 0xB5, 0x1F, 0xD6, 0x90, 0x2A, 0xCB, 0xF2, 0x13, 0x5B, 0x02, 0x50, 0xAD,
-    0xC1, 0xBC, 0x37, 0x25, 0x72, 0x22, 0x1A, 0xA0, 0x5F, 0x84, 0xE8, 0xBF, 0xE2, 0xEB, 0x0D, 0xAF,
-    0x2A, 0x6E, 0x79, 0xAC, 0x08, 0x7C, 0x9A, 0x14, 0xAF, 0x7F, 0xB4, 0x35, 0x66, 0x6A, 0x7E, 0xD3,
-    0x76, 0x27, 0x06, 0xD2, 0xD0, 0x2D, 0x71, 0x65, 0x11, 0x2D, 0x09, 0x69, 0xA5, 0xFE, 0xDE, 0xF3,
-    0x94, 0x0C, 0xF8, 0xF4, 0x70, 0x3B, 0xC4, 0xB6, 0x80, 0xF4, 0xFF, 0x21, 0x9A, 0x75, 0x08, 0x7F,
-    0x0A, 0xB7, 0x33, 0x2B, 0x72, 0x75, 0xD0, 0xF1, 0x2B, 0x36, 0xCC, 0xD2, 0x45, 0xE1, 0x2C, 0x83,
-    0x6B, 0xF5, 0x39, 0x38, 0x0C, 0x82, 0xFA, 0x62, 0xD2, 0xF9, 0x32, 0x96, 0x16, 0xD4, 0xB4, 0x9A,
-    0xDC, 0xCD, 0x54, 0xDD, 0xD1, 0xB2, 0xED, 0xC7, 0x2D, 0xA7, 0x60, 0x53, 0xED, 0x66, 0xE6, 0x0A,
-    0x6C, 0x29, 0x74, 0xD4, 0x0C, 0x8A, 0x87, 0x4C, 0x81, 0x23, 0x54, 0x01, 0xBB, 0x64, 0x73, 0xC8,
-    0x32, 0xAA, 0xB8, 0xE6, 0x15, 0xF3, 0x8B, 0x6E, 0xD4, 0x72, 0x67, 0x40, 0xE7, 0x59, 0x57, 0x6D,
-    0x7B, 0xBB, 0xF3, 0xD6, 0xE8, 0x9D, 0x4F, 0xF1, 0x8C, 0x08, 0xE2, 0x7B, 0x12, 0x67, 0x2E, 0x8F,
-    0x8B, 0x71, 0x6E, 0x53, 0x0E, 0xCA, 0x37, 0xF7, 0xD3, 0xEA, 0x07, 0xEA, 0x6F, 0x5D, 0x91, 0xB8,
-    0x98, 0x5C, 0xE9, 0x13, 0x82, 0xAB, 0xE8, 0xAD, 0x6E, 0xB7, 0xF8, 0x35, 0xB9, 0x82, 0x4D, 0xB1,
-    0x17, 0x28, 0x5F, 0xC3, 0xBC, 0x18, 0x22, 0x82, 0x55, 0xE5, 0x9B, 0x63, 0x34, 0xB7, 0x1A, 0xB1,
-    0x21, 0x7F, 0x2D, 0xBB, 0x5D, 0xD8, 0xE0, 0xA5, 0x53, 0xD1, 0x09, 0x53, 0xDB, 0x2B, 0xBA, 0xA7,
-    0x74, 0x5D, 0x54, 0xED, 0x66, 0x3A, 0xF4, 0x10, 0x2A, 0x54, 0xE9, 0x1A, 0xBA, 0xC3, 0x06, 0xDC,
-    0xD1, 0x03, 0xF5, 0xE6, 0x5C, 0x91, 0x62, 0xA5, 0xF6, 0xDA, 0xEF, 0x5A, 0xC6, 0xEF, 0x91, 0x86,
-    0xA6, 0x2C, 0x74, 0x35, 0x43, 0xCA, 0x6D, 0xD4, 0x00, 0x3B, 0xA8, 0xA4, 0xA2, 0xB9, 0x54, 0xB1,
-    0x02, 0x28, 0xAB, 0x7B, 0x10, 0x66, 0xB5, 0xB1, 0x7F, 0x45, 0xAF, 0x37, 0x9D, 0x4E, 0x2E, 0x5D,
-    0x47, 0xC3, 0x9F, 0x39, 0xB0, 0x9B, 0x5B, 0xEA, 0x57, 0xAE, 0xC5, 0xA9, 0x00, 0x44, 0x3D, 0x01,
-    0x60, 0x4B, 0x60, 0xE4, 0x07, 0xC8, 0x24, 0x8B, 0xE5, 0xF0, 0xC6, 0x0C, 0x5B, 0x0D, 0x12, 0xA7,
-    0x77, 0xC6, 0x2B, 0x7A, 0x2A, 0x06, 0x2B, 0x4E, 0xB9, 0xDD, 0x07, 0x43, 0x6C, 0x51, 0x16, 0xBD,
-    0xA3, 0xB3, 0xB3, 0x1B, 0xB5, 0x2B, 0x8B, 0x72, 0x73, 0xD1, 0x3E, 0xA2, 0x86, 0x2D, 0x0C, 0x86,
-    0xE7, 0x5C, 0x1C, 0x47, 0x4B, 0x99, 0x36, 0xA6, 0x9D, 0xCF, 0x22, 0x3F, 0xEF, 0xC4, 0xBD, 0x36,
-    0x1F, 0x26, 0x0E, 0x92, 0x17, 0x5A, 0x56, 0x36, 0x02, 0xCB, 0xF0, 0x39, 0xD4, 0x0A, 0xBD, 0x6B,
-    0xE9, 0xB9, 0xC6, 0xE1, 0x39, 0x53, 0xAA, 0x77, 0xB5, 0xC6, 0x84, 0x67, 0x47, 0x31, 0xE2, 0xDB,
-    0x8B, 0x1B, 0xC5, 0xC8, 0x2E, 0x1A, 0xC5, 0x00, 0xAC, 0xA2, 0xAE, 0xBE, 0x25, 0xE9, 0x98, 0xAC,
-    0x44, 0xD8, 0xF9, 0xC1, 0xE6, 0xC7, 0xC4, 0x7E, 0x01, 0x5E, 0xB0, 0x1C, 0x28, 0x37, 0xAB, 0xC5,
-    0x1D, 0xF9, 0x70, 0x1E, 0x8A, 0x61, 0x72, 0xBC, 0xA4, 0xC1, 0xDE, 0x99, 0x2F, 0x2E, 0x3D, 0x1C,
-    0x59, 0x93, 0x7A, 0xE3, 0xCE, 0x94, 0xA0, 0x1D, 0x6B, 0xB4, 0xD1, 0x43, 0x62, 0x78, 0xBE, 0x23,
-    0x6B, 0xDD, 0xFB, 0x93, 0x00, 0xDE, 0x9B, 0x78, 0x1C, 0x2F, 0xD1, 0x24, 0x33, 0x0C, 0x60, 0x05,
-    0xC0, 0x83, 0x98, 0x7D, 0x58, 0x5F, 0xD0, 0x1F, 0x63, 0xE2, 0xA3, 0xB0, 0x3E, 0xD1, 0xF2, 0xE8,
-    0x76, 0x4C, 0x3C, 0x25, 0xB9, 0x0B, 0xEB, 0x13, 0x28, 0xF0, 0xB2, 0xD6, 0x09, 0x9C, 0xF7, 0xE3,
-    0xEA, 0xA4, 0x43, 0x00, 0x00, 0x16, 0x77, 0x19, 0x6A, 0x93, 0xA1, 0x25, 0xE9, 0x27, 0x51, 0x96,
-    0xC8, 0xDE, 0xE6, 0x54, 0xA6, 0x43, 0xCC, 0x30, 0x00, 0x7B, 0xED, 0x54, 0x28, 0xC4, 0xB0, 0xA6,
-    0xF2, 0x12, 0x9B, 0x8F, 0xAE, 0x32, 0xAC, 0x38, 0x92, 0x5A, 0x41, 0x04, 0xA7, 0x27, 0x4A, 0xFC,
-    0xE0, 0x4B, 0xC5, 0x76, 0x24, 0x10, 0x3E, 0x3F, 0x6C, 0x6A, 0xD9, 0xCE, 0xC7, 0xF0, 0x6B, 0x97,
-    0x1D, 0x31, 0x67, 0x17, 0x1A, 0x6C, 0x5F, 0x74, 0xD0, 0x49, 0xA4, 0xE1, 0x73, 0x42, 0xDC, 0x64,
-    0x08, 0x10, 0x10, 0xE0, 0xD0, 0x9C, 0x5B, 0x48, 0xB7, 0x15, 0x8D, 0x32, 0xB8, 0x60, 0xED, 0xEA,
-    0x4E, 0x43, 0x5F, 0xB5, 0x9A, 0x21, 0x32, 0xBB, 0xF9, 0x6C, 0xE6, 0x8B, 0xFB, 0x9A, 0x79, 0xE2,
-    0x4C, 0x7B, 0xB6, 0x93, 0xFF, 0x0E, 0x27, 0x39, 0x2B, 0x5D, 0xD5, 0xE0, 0x60, 0xBD, 0x38, 0xCC,
-    0x20, 0x9A, 0x85, 0x01, 0x79, 0xC7, 0xF6, 0x9C, 0xD8, 0x9F, 0x2E, 0xEC, 0x4F, 0x07, 0x59, 0xC8,
-    0x5B, 0x33, 0x3D, 0x02, 0x60, 0x36, 0xD9, 0xAD, 0x6B, 0x88, 0x77, 0x53, 0x05, 0xA2, 0xA6, 0xAB,
-    0x1F, 0x8B, 0x61, 0xCF, 0x71, 0xFB, 0xA2, 0x80, 0xA4, 0x55, 0x42, 0xD7, 0x62, 0x0A, 0x51, 0xF0,
-    0x4A, 0x67, 0x9C, 0xAF, 0xB2, 0x5E, 0x23, 0x06, 0xB4, 0x35, 0x6E, 0x16, 0xB8, 0xDC, 0x97, 0x07,
-    0xA2, 0x90, 0x1B, 0x17, 0x8A, 0x13, 0x5C, 0x83, 0xA8, 0xA1, 0x8B, 0x09, 0xEC, 0x28, 0x70, 0x0E,
-    0x4B, 0x34, 0x31, 0x9A, 0xE2, 0x88, 0x7A, 0xCD, 0x06, 0x03, 0x53, 0x7E, 0x9F, 0xCC, 0x58, 0x55,
-    0x1C, 0x07, 0xD6, 0x60, 0xC6, 0x3C, 0x29, 0x16, 0x37, 0xE0, 0xD5, 0xDF, 0x44, 0x3C, 0x24, 0x66,
-    0x2F, 0x5B, 0x02, 0x64, 0xE8, 0x5D, 0x8E, 0x24, 0x3C, 0x42, 0xE8, 0x52, 0x17, 0xF6, 0x19, 0x36,
-    0xB9, 0x19, 0x35, 0x5B, 0x02, 0x64, 0x18, 0x16, 0x3C, 0xBC, 0x41, 0x76, 0x47, 0x3B, 0x7D, 0x3B,
-    0xED, 0xAA, 0x4D, 0xFE, 0x4C, 0x0D, 0xB5, 0xF7, 0xEC, 0x51, 0x87, 0xD3, 0x39, 0x33, 0x89, 0x10,
-    0x56, 0x40, 0x66, 0x20, 0xAB, 0xC5, 0x10, 0xA1, 0x58, 0x72, 0x99, 0x36, 0x14, 0x64, 0x40, 0xC1,
-    0x9D, 0x32, 0xCA, 0xCA, 0x3B, 0x3E, 0x11, 0x8B, 0x07, 0x31, 0x6D, 0xD0, 0x0B, 0x16, 0x29, 0x4D,
-    0xED, 0x57, 0xD9, 0x37, 0xE0, 0x58, 0x63, 0xE8, 0x63, 0x9C, 0x4D, 0x8F, 0x1D, 0x56, 0xF2, 0x80,
-    0xB8, 0x03, 0x16, 0x2F, 0xF4, 0x2F, 0x4C, 0x77, 0xB1, 0x21, 0x2D, 0x4F, 0x20, 0x90, 0x95, 0x61,
-    0xFA, 0x6D, 0x24, 0x0A, 0x7D, 0xC4, 0x05, 0xF9, 0x9D, 0xD9, 0x1B, 0x10, 0x57, 0x30, 0x3A, 0x7D,
-    0x3C, 0x85, 0xB2, 0x24, 0xF7, 0x53, 0x32, 0x44, 0xE0, 0x41, 0x59, 0xC0, 0x13, 0xC0, 0xC5, 0x06,
-    0x15, 0x68, 0x38, 0xE2, 0xD9, 0x31, 0x25, 0xD7, 0x46, 0x94, 0x9B, 0x16, 0xEF, 0x3C, 0x57, 0x8C,
-    0x1F, 0xC2, 0x1E, 0x3C, 0xAA, 0x96, 0x10, 0xE9, 0xC7, 0x70, 0xBD, 0xCA, 0xB4, 0x2C, 0xB7, 0x1A,
-    0x95, 0x2F, 0x09, 0x6E, 0xC6, 0x13, 0x05, 0x24, 0xA6, 0x5B, 0x6F, 0xE8, 0x11, 0x10, 0xB3, 0x1F,
-    0xC6, 0x53, 0xA9, 0x76, 0x34, 0x38, 0x12, 0xE7, 0x15, 0x0D, 0x22, 0xBC, 0xD1, 0x24, 0xC2, 0x4D,
-    0x9B, 0x2D, 0x81, 0x0A, 0xB2, 0xC9, 0xD5, 0xFB, 0x4E, 0x1A, 0xED, 0xA4, 0x3D, 0x33, 0x40, 0x47,
-    0xC9, 0x26, 0x82, 0x89, 0x0E, 0x05, 0xCC, 0xA1, 0x68, 0x03, 0x55, 0xE4, 0x5D, 0xEC, 0xEC, 0x65,
-    0x3B, 0x53, 0x0B, 0x3D, 0xFA, 0x0F, 0x65, 0xC1, 0x31, 0x50, 0xBB, 0x39, 0x6A, 0x74, 0xB4, 0x25,
-    0x94, 0x6E, 0x9F, 0xF9, 0xB5, 0x3B, 0x99, 0xDF, 0x01, 0xD2, 0x85, 0x63, 0xCD, 0x16, 0xFE, 0x5D,
-    0x33, 0x05, 0xC5, 0x43, 0x17, 0x3F, 0xBC, 0xB6, 0x3C, 0x62, 0x53, 0xA4, 0x8D, 0xC5, 0x4B, 0xA2,
-    0xBE, 0x6D, 0xF6, 0x7D, 0xE4, 0x21, 0x92, 0x0B, 0x09, 0x25, 0xC2, 0x29, 0x40, 0xFE, 0x72, 0xC5,
-    0x8F, 0xDF, 0x38, 0x6C, 0x96, 0x7A, 0x2B, 0x2D, 0x10, 0x6B, 0xAF, 0x39, 0x7D, 0x7B, 0x5F, 0x6F,
-    0x41, 0x37, 0x7A, 0x10, 0x87, 0x16, 0x65, 0x14, 0x0A, 0x10, 0x58, 0xBB, 0x9E, 0x3A, 0x29, 0xC9,
-    0x15, 0x09, 0xDD, 0xF4, 0xAE, 0x16, 0x0E, 0x75, 0xE6, 0x56, 0x8F, 0x60, 0xD2, 0x9A, 0xB9, 0x9E,
-    0xD3, 0x92, 0xEC, 0xD9, 0x0C, 0x9E, 0x93, 0x33, 0x6D, 0x0F, 0x2F, 0x41, 0x8F, 0xAA, 0xB1, 0x38,
-    0xAE, 0x60, 0xC6, 0xF4, 0xFF, 0x89, 0x7D, 0xFD, 0xE9, 0x40, 0x27, 0xB3, 0xE8, 0xB6, 0x22, 0x97,
-    0x06, 0xF1, 0xE4, 0x09, 0x0D, 0xC3, 0x8C, 0x4E, 0xC7, 0x18, 0xD9, 0x7F, 0xD8, 0xE7, 0x73, 0x3E,
-    0xE4, 0x0A, 0x35, 0xAF, 0x53, 0x96, 0x81, 0xBA, 0x4D, 0x78, 0x1B, 0x6B, 0xA0, 0x68, 0x58, 0x30,
-    0x83, 0x22, 0x2E, 0x5A, 0xEE, 0x47, 0xF9, 0xEE, 0x89, 0xCD, 0x82, 0x7E, 0x9B, 0xB6, 0xBC, 0x60,
-    0xA1, 0x33, 0x1D, 0xB0, 0xB4, 0x70, 0xA5, 0x63, 0x2D, 0x6E, 0x2A, 0xA4, 0x7E, 0xDC, 0xC1, 0x4F,
-    0x0D, 0x67, 0x70, 0x59, 0xF2, 0xE7, 0x88, 0x0D, 0xE1, 0x55, 0xD3, 0xBB, 0x4F, 0xF0, 0xF5, 0xC5,
-    0xF5, 0x11, 0xFB, 0xAF, 0xD7, 0x06, 0xE4, 0x8B, 0x62, 0x42, 0xEB, 0x62, 0x0E, 0xD6, 0x0C, 0x2D,
-    0xD5, 0xEA, 0xC1, 0x41, 0xA2, 0xE1, 0xBC, 0xBE, 0x22, 0x7B, 0x0C, 0xCA, 0x8B, 0x3A, 0xD0, 0x1B,
-    0x38, 0x95, 0x7D, 0x5B, 0x5F, 0xEB, 0x69, 0x38, 0xCB, 0xF6, 0xE0, 0x94, 0xCA, 0xCF, 0x3A, 0x68,
-    0x2F, 0x72, 0x97, 0xFE, 0xB3, 0x8B, 0xEC, 0x08, 0xB4, 0x81, 0x29, 0x40, 0xF3, 0x7D, 0x12, 0x6A,
-    0xD8, 0x2F, 0xB7, 0xC2, 0x93, 0x67, 0xB7, 0xAD, 0xE8, 0xFB, 0x84, 0xA2, 0xE0, 0x0A, 0xE0, 0xF9,
-    0x35, 0xD8, 0x72, 0xBA, 0x65, 0x7D, 0xFA, 0x78, 0x1F, 0xAE, 0xC0, 0xEA, 0xB8, 0x67, 0x19, 0xA0,
-    0x2D, 0x0B, 0xE6, 0x84, 0x10, 0x1E, 0x70, 0xC7, 0xA8, 0x99, 0xE8, 0x14, 0x1F, 0xF4, 0xF3, 0x4B,
-    0x7D, 0x7E, 0x46, 0xEA, 0x1F, 0xB1, 0x3F, 0x39, 0xE2, 0xA6, 0x15, 0xCF, 0xB9, 0x9E, 0x11, 0xEB,
-    0xB7, 0x94, 0xFA, 0xE0, 0x67, 0x49, 0xFD, 0xF3, 0xCE, 0x92, 0xEE, 0xB6, 0xA4, 0x41, 0x1C, 0xCC,
-    0x57, 0x41, 0x64, 0x3F, 0xD2, 0xDC, 0xFE, 0x3A, 0x69, 0xB3, 0xED, 0x3E, 0x77, 0x3C, 0xCF, 0x02,
-    0x15, 0xA8, 0xF0, 0x86, 0x3D, 0xD9, 0xB6, 0xA4, 0x8B, 0x21, 0xC0, 0x91, 0x7B, 0x7D, 0x22, 0x61,
-    0x33, 0x09, 0xD3, 0x70, 0x52, 0x62, 0xD5, 0xA4, 0xC9, 0xE1, 0xA6, 0xFE, 0xC9, 0xB8, 0x65, 0x3D,
-    0xA7, 0x49, 0xA8, 0x75, 0x90, 0x4A, 0xE2, 0x78, 0x1E, 0xE4, 0x8E, 0xC3, 0xBA, 0xAA, 0x2F, 0xA8,
-    0x8F, 0x1E, 0x28, 0x08, 0x55, 0x72, 0x13, 0x21, 0x9E, 0x7D, 0x43, 0x3C, 0x25, 0x82, 0xDA, 0xDC,
-    0xDE, 0x42, 0xD5, 0x81, 0xF2, 0x86, 0x43, 0x34, 0xB4, 0x99, 0x0C, 0x91, 0x22, 0x58, 0x83, 0xE5,
-    0x80, 0xD0, 0xA9, 0xDD, 0xC5, 0xD7, 0xAC, 0xEE, 0x9A, 0x92, 0x92, 0x87, 0x6B, 0xA6, 0xB7, 0xB8,
-    0xA6, 0xD1, 0x16, 0x35, 0x4A, 0x13, 0x0D, 0xE6, 0x8D, 0x5A, 0x05, 0xBB, 0x2E, 0x81, 0x0F, 0xFE,
-    0xDD, 0xCC, 0xB4, 0x3B, 0x8A, 0x6F, 0xD2, 0x3C, 0xA2, 0xDF, 0xA9, 0xD6, 0x09, 0x49, 0xAF, 0xBF,
-    0x87, 0x76, 0xE9, 0x0B, 0xE0, 0xD9, 0x2B, 0x18, 0x67, 0x43, 0xA1, 0x2E, 0x18, 0x59, 0x94, 0x6A,
-    0xAB, 0x0B, 0x87, 0xEE, 0x80, 0x48, 0x46, 0xFA, 0x24, 0x0E, 0xA8, 0x40, 0x2C, 0x2F, 0x02, 0xDC,
-    0xA6, 0x80, 0x61, 0x60, 0xB9, 0x62, 0x7A, 0x10, 0x64, 0x28, 0xD0, 0x01, 0x3F, 0x65, 0x1C, 0xB4,
-    0x6A, 0x3A, 0x16, 0x80, 0x08, 0x5D, 0x98, 0x10, 0xF7, 0x37, 0x5D, 0x4A, 0x1C, 0x69, 0x03, 0x6F,
-    0x96, 0xDC, 0x1C, 0xFE, 0xB0, 0x18, 0x9A, 0xE2, 0x47, 0xDF, 0x27, 0x55, 0x1F, 0xC4, 0x7F, 0x53,
-    0x6A, 0x25, 0x45, 0xAC, 0x65, 0xFB, 0xD9, 0x08, 0xEE, 0x5D, 0x72, 0x27, 0x1F, 0xF6, 0x66, 0x83,
-    0xD2, 0xF4, 0x52, 0xF4, 0x91, 0x93, 0x93, 0x8B, 0xD6, 0x8A, 0x6A, 0xD1, 0xF1, 0xF1, 0xC3, 0xC8,
-    0x36, 0xE4, 0x6F, 0xA6, 0x87, 0x35, 0xBD, 0x60, 0xED, 0x75, 0x49, 0x41, 0xD0, 0x1A, 0x54, 0xFC,
-    0x8D, 0x02, 0xF7, 0x79, 0x04, 0x4B, 0xAB, 0xE7, 0x45, 0x69, 0x8B, 0x20, 0xD7, 0xE3, 0x5B, 0x2E,
-    0xB8, 0xA6, 0xD7, 0x6B, 0x46, 0x05, 0xF5, 0x2E, 0x14, 0xF9, 0x0B, 0xAF, 0x49, 0x14, 0xFE, 0x8E,
-    0x3A, 0x13, 0x44, 0xB9, 0x99, 0xF5, 0x80, 0x19, 0xAC, 0x47, 0x6B, 0x75, 0x0E, 0xCA, 0xE8, 0x8F,
-    0xF1, 0x53, 0x60, 0xD9, 0x7E, 0xCD, 0x0E, 0x60, 0x46, 0x57, 0xDF, 0x56, 0xE8, 0x89, 0xDA, 0xA2,
-    0xAB, 0xC7, 0xE7, 0x1C, 0xFC, 0x08, 0x41, 0xA9, 0xBA, 0x06, 0x00, 0x7D, 0xE0, 0xFB, 0xF2, 0xE9,
-    0x9E, 0x1B, 0x33, 0x74, 0xA7, 0xEA, 0x23, 0x48, 0x63, 0xA9, 0x88, 0xF3, 0x0A, 0xF5, 0xB8, 0x10,
-    0x3D, 0x1F, 0x8C, 0x45, 0xCA, 0x1E, 0x58, 0x15, 0x22, 0x7E, 0xA2, 0xCE, 0x88, 0x4C, 0xE7, 0xD0,
-    0x6E, 0x42, 0x96, 0x3E, 0x6F, 0xA3, 0xC8, 0x26, 0x3F, 0x5E, 0x9F, 0xCF, 0x40, 0xC9, 0xB1, 0xC0,
-    0x7F, 0x35, 0x3A, 0x1C, 0x13, 0x4F, 0xB5, 0x29, 0x61, 0x3A, 0x76, 0x33, 0x86, 0xC1, 0x40, 0xBE,
-    0xC4, 0x31, 0x64, 0xDA, 0x3E, 0x25, 0x64, 0x2F, 0xB5, 0x7E, 0x90, 0xBD, 0xD5, 0xBE, 0x4A, 0x7D,
-    0xAA, 0x68, 0xB2, 0x33, 0xF1, 0xF0, 0x30, 0x60, 0x24, 0xE0, 0xB1, 0x45, 0x43, 0xCC, 0x96, 0x15,
-    0xCE, 0xFA, 0x03, 0xDB, 0x6E, 0xED, 0x52, 0x3E, 0x9D, 0x3D, 0xE5, 0x03, 0x86, 0x73, 0xAD, 0x2A,
-    0x59, 0xFF, 0x56, 0xD7, 0xEC, 0x29, 0x62, 0x3E, 0x7A, 0x25, 0x3B, 0xFF, 0x9A, 0x5C, 0x95, 0x35,
-    0xD1, 0x32, 0x62, 0xE8, 0xDA, 0x47, 0x12, 0x9A, 0x54, 0xBE, 0x82, 0x62, 0xFC, 0x50, 0x9F, 0x37,
-    0x91, 0x0E, 0x86, 0xBB, 0x9D, 0x69, 0xE7, 0x48, 0xB3, 0x24, 0x91, 0x1F, 0x85, 0x2B, 0x27, 0xAC,
-    0xEA, 0x27, 0x40, 0x8A, 0xA9, 0x66, 0x2A, 0xB7, 0xAB, 0xFE, 0x9D, 0xA5, 0x6B, 0xDE, 0x64, 0x3A,
-    0x20, 0x7A, 0xAA, 0x0E, 0x31, 0xF9, 0xA1, 0x4E, 0xC6, 0x0E, 0xEC, 0x8C, 0x9B, 0x49, 0x9B, 0xB0,
-    0x05, 0x2B, 0x1D, 0x0E, 0x18, 0xBC, 0x39, 0xE6, 0xF2, 0x9E, 0xD7, 0xDE, 0xA5, 0x8A, 0x68, 0x3E,
-    0x5B, 0x6E, 0x8E, 0x2B, 0x64, 0xEA, 0x98, 0x74, 0xCF, 0x33, 0x0B, 0x00, 0x37, 0x27, 0xB0, 0x37,
-    0x1A, 0x30, 0xB5, 0x9E, 0xDC, 0x99, 0x36, 0x47, 0xAD, 0x26, 0xAF, 0xBD, 0xD3, 0xF4, 0x53, 0xF2,
-    0xE7, 0x8F, 0x6A, 0x1A, 0xC5, 0xDC, 0xC3, 0x76, 0x15, 0x73, 0xDE, 0x4D, 0x37, 0x82, 0xED, 0x55,
-    0xC5, 0x2D, 0x8B, 0xAC, 0x5F, 0x27, 0xDE, 0xF6, 0xDE, 0x77, 0xB7, 0x85, 0x95, 0xD8, 0x0A, 0xC2,
-    0xDD, 0xFE, 0x16, 0x03, 0x38, 0xF6, 0x68, 0x10, 0xAE, 0x66, 0xCC, 0xD9, 0x78, 0x6C, 0x5C, 0xC2,
-    0x6E, 0x49, 0xF1, 0x00, 0x24, 0x7C, 0x88, 0xEB, 0x77, 0x90, 0xE1, 0xBD, 0x7A, 0x7C, 0x5C, 0xCA,
-    0x5F, 0x78, 0x86, 0x14, 0xC3, 0x33, 0x76, 0x8C, 0x19, 0x44, 0xBD, 0x86, 0xB3, 0x5D, 0x77, 0x63,
-    0x0B, 0xCE, 0xC7, 0xD3, 0xA4, 0xA1, 0x7C, 0x9B, 0x29, 0x9D, 0x92, 0xFD, 0xF8, 0xE3, 0xD4, 0x35,
-    0x7B, 0x5C, 0xE2, 0x35, 0xFD, 0xC5, 0xD7, 0x84, 0x8E, 0x93, 0xCD, 0xC8, 0x90, 0x27, 0xB7, 0xEE,
-    0xDC, 0xBB, 0x31, 0x76, 0x87, 0x9C, 0xE9, 0x71, 0x8D, 0x7C, 0x0B, 0x5D, 0x7B, 0x2A, 0x71, 0x30,
-    0xE4, 0x03, 0x97, 0x0C, 0x2D, 0x7B, 0x6F, 0xCD, 0x5E, 0xD5, 0x37, 0x71, 0xF0, 0x38, 0x67, 0x65,
-    0x92, 0xB3, 0xC0, 0x99, 0x04, 0x36, 0xFC, 0x01, 0xCC, 0x92, 0xCD, 0x00, 0x2C, 0x34, 0xFD, 0x47,
-    0x50, 0x6B, 0xDA, 0x12, 0x1B, 0x35, 0x0D, 0x14, 0xA2, 0x74, 0x16, 0xDC, 0x1B, 0xD3, 0x80, 0xC4,
-    0x06, 0x36, 0x13, 0x67, 0xBC, 0xC9, 0x07, 0x80, 0x0B, 0x60, 0x5C, 0x55, 0x76, 0x13, 0xDE, 0x99,
-    0xDF, 0x97, 0xCE, 0xF9, 0xBF, 0xDC, 0x9E, 0x2A, 0xF8, 0xA2, 0x0E, 0xA0, 0xC2, 0x35, 0x42, 0x13,
-    0x16, 0x07, 0x73, 0x02, 0x7A, 0x71, 0x64, 0x22, 0x3D, 0x40, 0x76, 0x53, 0xF8, 0x75, 0xDD, 0x8F,
-    0x4A, 0x5B, 0x20, 0x7F, 0xCF, 0xB8, 0x85, 0x93, 0xE5, 0x7B, 0x45, 0xE2, 0x0F, 0xFA, 0x7F, 0x44,
-    0x9B, 0x93, 0x80, 0x3C, 0x1E, 0x50, 0xA8, 0xE3, 0x2F, 0x2D, 0xFE, 0xD3, 0x91, 0x22, 0x5A, 0x3D,
-    0x86, 0xAA, 0xEA, 0x7D, 0xC6, 0xF4, 0x4D, 0x73, 0x4F, 0x79, 0x51, 0xF8, 0xF3, 0xB0, 0x86, 0xAD,
-    0xAC, 0xBA, 0xCE, 0x80, 0x70, 0x14, 0x40, 0x61, 0x20, 0x73, 0xE8, 0xD1, 0x45, 0x6F, 0x5A, 0xD4,
-    0x3F, 0x8A, 0xD9, 0x83, 0x8E, 0x1B, 0xAA, 0xA5, 0x63, 0x22, 0xCE, 0xB6, 0x41, 0x0B, 0x13, 0xF1,
-    0x25, 0x98, 0x9E, 0xB1, 0xD5, 0xC8, 0x21, 0xBE, 0x11, 0x55, 0x31, 0x2A, 0x85, 0xF8, 0x96, 0x51,
-    0xCF, 0x12, 0x2E, 0x9B, 0xA6, 0x03, 0x9C, 0x23, 0x5D, 0xA2, 0xD9, 0x96, 0x9A, 0xCB, 0x64, 0x2F,
-    0x2F, 0x5C, 0x6F, 0xD3, 0xD9, 0x74, 0x2C, 0xD8, 0x2F, 0x7D, 0x68, 0x2A, 0xBE, 0x4F, 0x08, 0xC3,
-    0x5A, 0xB4, 0xF6, 0xAF, 0x38, 0x48, 0x77, 0x6B, 0x8D, 0x56, 0xC6, 0x9B, 0xD5, 0xCD, 0x21, 0xB9,
-    0xA3, 0x13, 0xBF, 0x48, 0x90, 0x14, 0xCA, 0x8D, 0x3E, 0x80, 0x86, 0x0E, 0x22, 0xEC, 0xB3, 0x3B,
-    0x0E, 0xC6, 0x0D, 0xC7, 0xDB, 0x49, 0xAB, 0xC3, 0x7A, 0xB0, 0x95, 0x3A, 0xA1, 0x0D, 0xA8, 0x48,
-    0xF2, 0xE8, 0x68, 0xB9, 0x28, 0x32, 0x74, 0x1D, 0x02, 0x97, 0x97, 0x7B, 0x61, 0x6A, 0xDC, 0x28,
-    0xCE, 0x27, 0x74, 0x7A, 0xE5, 0x49, 0x3D, 0xA9, 0xB4, 0x66, 0x3D, 0x27, 0xAF, 0xE3, 0xF3, 0x62,
-    0xE2, 0x4B, 0x7A, 0x14, 0x49, 0xD5, 0xA1, 0x5C, 0xD4, 0x65, 0x22, 0x12, 0x2F, 0xA1, 0x57, 0x56,
-    0x56, 0x6F, 0x3C, 0x63, 0x59, 0x7E, 0x03, 0x8D, 0x24, 0x23, 0xA1, 0x40, 0x61, 0xE2, 0x0D, 0xD8,
-    0xA3, 0x1C, 0xA5, 0xBC, 0x6A, 0x4C, 0xA1, 0xE4, 0xF9, 0x02, 0xF4, 0xB3, 0x48, 0xEA, 0x93, 0xC8,
-    0x55, 0x44, 0x49, 0x00, 0xB0, 0x78, 0xD1, 0x4E, 0x92, 0x86, 0xA4, 0x6F, 0x2C, 0x56, 0xEC, 0x4D,
-    0xB4, 0x2C, 0xD5, 0xAB, 0x84, 0x3F, 0xA4, 0x7A, 0x84, 0x44, 0xA4, 0x05, 0xED, 0x52, 0x61, 0xB2,
-    0xB5, 0x96, 0x5E, 0x6B, 0x1D, 0xD7, 0xA8, 0x55, 0xF8, 0x36, 0x12, 0xA1, 0xE0, 0x51, 0xD7, 0x99,
-    0x50, 0xD5, 0xD1, 0xD3, 0xBE, 0xB3, 0x9F, 0x72, 0x70, 0x81, 0x67, 0xEC, 0x86, 0x48, 0x9C, 0x09,
-    0x77, 0x7B, 0xFA, 0xEC, 0xD4, 0xC2, 0xF1, 0xF1, 0xC7, 0x45, 0x5C, 0x0A, 0x9C, 0x7A, 0x8D, 0x93,
-    0xA5, 0x5E, 0xE0, 0xB9, 0xAF, 0x7D, 0xA2, 0xC0, 0x9F, 0xC2, 0x61, 0xD4, 0xDB, 0x50, 0xFB, 0x43,
-    0x3C, 0x62, 0xA1, 0x4B, 0xD9, 0xAE, 0x0E, 0x15, 0x52, 0x5D, 0x71, 0xB0, 0xEA, 0x13, 0x5C, 0x9D,
-    0x66, 0x5C, 0xD6, 0x41, 0x80, 0xC7, 0xDD, 0xF3, 0x14, 0xDA, 0xFF, 0xCD, 0x44, 0x54, 0xBF, 0x05,
-    0xB7, 0x58, 0x57, 0x6F, 0xB4, 0xFB, 0x01, 0x94, 0x16, 0x4B, 0x5C, 0x36, 0x5F, 0x2D, 0xDB, 0x18,
-    0x26, 0x9A, 0x09, 0xD2, 0xB7, 0x2C, 0x22, 0x16, 0x2D, 0x3A, 0x74, 0xF1, 0x68, 0xC6, 0xF3, 0xC5,
-    0xE4, 0x5A, 0xCF, 0x39, 0x36, 0xA1, 0x31, 0x72, 0x30, 0x4C, 0xB9, 0x98, 0xC7, 0x19, 0x82, 0x21,
-    0x25, 0xD7, 0xE3, 0x2B, 0x1D, 0x8C, 0x5A, 0x73, 0xD0, 0x94, 0x1C, 0x09, 0xB4, 0x63, 0x91, 0x73,
-    0x18, 0x97, 0x58, 0xD5, 0x6C, 0xA0, 0x80, 0x5B, 0xA2, 0x53, 0xD3, 0x9F, 0xA8, 0x8C, 0xF3, 0xA3,
-    0xF4, 0xCE, 0xB8, 0x6D, 0x88, 0xBA, 0x63, 0xD9, 0x95, 0x30, 0xFE, 0xFC, 0xB6, 0x7A, 0x3B, 0x4F,
-    0x45, 0x63, 0xD7, 0x29, 0x58, 0xEA, 0x75, 0x9D, 0xEB, 0xD5, 0x4E, 0x9B, 0x1B, 0xFB, 0xD2, 0x42,
-    0xC5, 0x3E, 0xD4, 0x22, 0x9C, 0x38, 0x84, 0x20, 0x2A, 0x48, 0x48, 0x98, 0x4E, 0x7A, 0xBE, 0xC0,
-    0x72, 0xFF, 0xC8, 0x06, 0xD9, 0x65, 0x37, 0x19, 0x70, 0xEA, 0xE0, 0x88, 0x87, 0x1B, 0x98, 0x38,
-    0x74, 0x7A, 0xBB, 0x02, 0x59, 0x6E, 0x8F, 0xC2, 0x5E, 0xC3, 0x11, 0x83, 0xC8, 0x8D, 0x30, 0xCC,
-    0xD0, 0xB1, 0xC0, 0x1D, 0xB0, 0xB2, 0x68, 0x26, 0x3F, 0xE4, 0x2C, 0x5C, 0x10, 0x34, 0x59, 0x8C,
-    0x5A, 0x41, 0xBF, 0x39, 0x6C, 0x06, 0xC6, 0x34, 0x60, 0xDA, 0x9C, 0xA6, 0x72, 0x76, 0x8E, 0xCE,
-    0x1F, 0x79, 0x33, 0x9C, 0x3D, 0xC2, 0x6E, 0x35, 0x9B, 0x02, 0x4C, 0xEA, 0x2B, 0xF4, 0xDE, 0x42,
-    0x86, 0x3B, 0xC7, 0x8B, 0xF0, 0x76, 0xBE, 0x5C, 0xC3, 0xB6, 0xC5, 0xBC, 0x79, 0x4A, 0x78, 0xFD,
-    0x6C, 0x52, 0xAF, 0x43, 0x62, 0xFE, 0x64, 0x30, 0x9D, 0x41, 0x30, 0xCD, 0xDF, 0xA0, 0x6E, 0x6D,
-    0xD9, 0xF3, 0xB0, 0x34, 0xDD, 0x2B, 0xD9, 0xF3, 0x61, 0x67, 0x9F, 0x1B, 0x4D, 0x41, 0xC7, 0x8D,
-    0x5D, 0xF7, 0xC7, 0x57, 0x6F, 0xBE, 0xD4, 0x19, 0x2F, 0xB5, 0x54, 0xEE, 0x4B, 0x21, 0x5D, 0x07,
-    0x5B, 0x93, 0x0C, 0xF8, 0x32, 0x1D, 0x00, 0x0E, 0xC9, 0x87, 0x8C, 0x87, 0xE0, 0x17, 0xF6, 0xE4,
-    0x19, 0x8C, 0xFC, 0x6E, 0xB1, 0xFC, 0xB9, 0xCB, 0x2A, 0xB6, 0x43, 0x51, 0x08, 0x4E, 0xBC, 0x6C,
-    0x67, 0x9B, 0xC1, 0x2C, 0x1E, 0x52, 0x82, 0x8D, 0xB2, 0xF2, 0x44, 0x6E, 0x07, 0xED, 0x19, 0xE4,
-    0x73, 0x31, 0xE1, 0xD0, 0x60, 0xFB, 0xA5, 0x05, 0x4E, 0x17, 0x8A, 0x2C, 0x86, 0x7B, 0xF9, 0xA4,
-    0x38, 0x30, 0xFC, 0xAF, 0x07, 0xA2, 0x01, 0x16, 0xE2, 0xBA, 0x16, 0xE7, 0x7A, 0x47, 0x43, 0xBA,
-    0xA4, 0x74, 0x53, 0xC8, 0x6D, 0xDA, 0xB8, 0x14, 0xD1, 0x4B, 0xBA, 0xC4, 0x7E, 0x25, 0x43, 0x65,
-    0x10, 0x33, 0xCA, 0xA2, 0x76, 0xD5, 0xF7, 0x70, 0xAA, 0x43, 0xCB, 0x9E, 0x98, 0x36, 0xFE, 0xF5,
-    0x34, 0x6B, 0xED, 0x3B, 0x37, 0xDB, 0x31, 0x08, 0x67, 0x97, 0xCF, 0x3F, 0xC0, 0xE8, 0xAE, 0xE1,
-    0x43, 0xF0, 0xB4, 0x57, 0x44, 0xFD, 0x1F, 0x1F, 0xCC, 0xBE, 0x01, 0x91, 0x9E, 0x7B, 0xEA, 0xE3,
-    0x2F, 0x92, 0xF0, 0xEF, 0x37, 0x01, 0x20, 0x99, 0x84, 0x33, 0x8A, 0xD7, 0x42, 0x51, 0xED, 0x3B,
-    0x2C, 0xA1, 0xB3, 0xDD, 0xA0, 0x08, 0x5A, 0x67, 0x11, 0x9B, 0xBB, 0x95, 0xFC, 0xB5, 0x79, 0x56,
-    0xD2, 0x2B, 0xA1, 0x68, 0x34, 0xA6, 0x38, 0x07, 0x5B, 0xFC, 0x63, 0xA8, 0x43, 0x23, 0x8B, 0x2F,
-    0x35, 0x92, 0x8E, 0x59, 0xFD, 0xCB, 0xD4, 0x00, 0x63, 0x1E, 0xD7, 0x33, 0x8D, 0xB4, 0x10, 0x50,
-    0xA8, 0x65, 0x56, 0x73, 0x15, 0xAA, 0x4B, 0x90, 0xC7, 0x3D, 0xBB, 0x99, 0x73, 0xF5, 0x87, 0x7B,
-    0x65, 0x0E, 0xC5, 0x30, 0xED, 0x0E, 0x83, 0xAB, 0xED, 0x77, 0xC3, 0xB4, 0xFE, 0xAD, 0xE9, 0xF7,
-    0xE2, 0x17, 0x87, 0xB4, 0x69, 0x77, 0x0E, 0xD1, 0xD2, 0xD6, 0xF4, 0xF6, 0xCD, 0xEC, 0x8C, 0x29,
-    0x27, 0x6A, 0x37, 0xD3, 0xBD, 0x87, 0xBF, 0xFD, 0x35, 0xF0, 0xE1, 0xBF, 0xA1, 0x4F, 0x2D, 0x1E,
-    0xE0, 0xE3, 0xDC, 0x60, 0xBA, 0x1B, 0x80, 0xAD, 0xDC, 0xC4, 0xBF, 0x02, 0x7C, 0xFE, 0x07, 0x5D,
-    0x52, 0xAF, 0x6F, 0x16, 0x31, 0x18, 0x7E, 0x7A, 0xB7, 0x6F, 0x25, 0x3B, 0x51, 0x43, 0x08, 0xC1,
-    0xD4, 0xA2, 0xA8, 0x41, 0x20, 0xD8, 0xDA, 0x0D, 0x81, 0x04, 0xC1, 0x34, 0x66, 0x1E, 0x3B, 0x31,
-    0x76, 0xB7, 0x4D, 0xE0, 0x08, 0x7F, 0xC2, 0x04, 0x6A, 0x7F, 0x01, 0x24, 0x1B, 0xD7, 0xED, 0x13,
-    0xB3, 0xCD, 0x10, 0x13, 0x08, 0x9A, 0x90, 0x2C, 0xE0, 0x9A, 0x70, 0xE2, 0x92, 0xF5, 0xEE, 0xE5,
-    0xBD, 0x0B, 0x82, 0x50, 0xD7, 0xBC, 0x3F, 0x9E, 0x5F, 0xEF, 0x02, 0xD2, 0x97, 0x59, 0x50, 0x63,
-    0x93, 0x24, 0xD8, 0x58, 0x66, 0x3C, 0xC2, 0xFC, 0x76, 0x31, 0x16, 0x24, 0x47, 0x95, 0x4D, 0xB2,
-    0xDE, 0xE2, 0x21, 0xFE, 0xBE, 0xBA, 0x81, 0x1A, 0x50, 0x52, 0x42, 0x4B, 0xCE, 0xFC, 0xC8, 0xB2,
-    0xD7, 0xE7, 0x23, 0x06, 0xD3, 0x48, 0xCF, 0x55, 0xF1, 0xB1, 0x70, 0x14, 0xDF, 0x1A, 0x7A, 0xFD,
-    0xF5, 0x96, 0xF2, 0xBE, 0xA2, 0x2D, 0x6F, 0xC3, 0x34, 0xB6, 0xD8, 0x7E, 0x55, 0x11, 0xFD, 0x26,
-    0xCA, 0x44, 0xC3, 0x62, 0x7B, 0x1B, 0x77, 0x20, 0xF6, 0xC0, 0x98, 0x86, 0x6E, 0x86, 0x96, 0x7A,
-    0x43, 0x71, 0x75, 0xC4, 0xEA, 0xE1, 0x58, 0xD3, 0x48, 0x97, 0x1D, 0x50, 0x05, 0x7D, 0x48, 0x72,
-    0xB0, 0x89, 0x2E, 0x99, 0x84, 0x6D, 0xDA, 0x19, 0xFD, 0x2E, 0x34, 0x6D, 0x11, 0xE9, 0x9B, 0x61,
-    0x5F, 0xA6, 0x64, 0xBC, 0x18, 0xF0, 0x26, 0xC8, 0x1E, 0xDA, 0x61, 0x63, 0xAA, 0x8B, 0xCF, 0xA0,
-    0x6C, 0xE9, 0x3A, 0xD6, 0xA7, 0x25, 0xF9, 0x8D, 0x5C, 0x7D, 0xBB, 0xE5, 0x2F, 0x5A, 0xC7, 0x35,
-    0x87, 0x75, 0xC1, 0xAC, 0x27, 0xB9, 0x55, 0x2E, 0x07, 0x9D, 0x54, 0x6F, 0x83, 0x89, 0xE4, 0xEC,
-    0x66, 0xC6, 0x3A, 0xD2, 0x0C, 0x70, 0x1F, 0x6B, 0xCF, 0xA3, 0xEC, 0x6B, 0x31, 0x96, 0x3D, 0xEB,
-    0xFE, 0x9E, 0x04, 0x65, 0x28, 0x72, 0x60, 0x19, 0xA2, 0x9F, 0x5B, 0x2A, 0x44, 0xFB, 0x2C, 0xD9,
-    0x77, 0x9D, 0x5D, 0xF6, 0xFA, 0x2A, 0xAB, 0x38, 0xC8, 0xF4, 0xA5, 0x08, 0x4F, 0xA7, 0xDA, 0xEA,
-    0x4B, 0xD4, 0xE4, 0x5A, 0x4A, 0x2D, 0x8D, 0xD6, 0xD5, 0xEF, 0x51, 0x5D, 0x41, 0xCC, 0x06, 0xAC,
-    0xE0, 0xAC, 0xE8, 0xAA, 0xA8, 0x3D, 0x6F, 0x6D, 0x6A, 0x5F, 0x07, 0x1B, 0x1F, 0x38, 0xD6, 0xD3,
-    0x7A, 0xDB, 0xC9, 0x01, 0x6C, 0xBE, 0x37, 0x41, 0x45, 0x95, 0x54, 0x12, 0xC7, 0x10, 0x4E, 0xF5,
-    0xA6, 0xB3, 0x81, 0x1B, 0x9B, 0xBA, 0xB1, 0x8D, 0xF1, 0x2A, 0x14, 0xCD, 0x1A, 0x06, 0x06, 0xB4,
-    0x47, 0xA9, 0xAE, 0xFC, 0x27, 0xC1, 0x4B, 0x0B, 0xD6, 0x51, 0x66, 0x99, 0x55, 0xB2, 0xC1, 0xE2,
-    0xF1, 0x44, 0x6E, 0x49, 0x0C, 0xDD, 0x5E, 0x44, 0xE1, 0x16, 0x82, 0xCA, 0xCC, 0xFE, 0x5D, 0x13,
-    0xFB, 0xE7, 0x69, 0xF3, 0x43, 0xD1, 0x70, 0x83, 0x89, 0x8A, 0x8E, 0xD2, 0xE9, 0xBA, 0x5C, 0x86,
-    0x3D, 0xCB, 0x16, 0x27, 0x39, 0xA9, 0xAA, 0x02, 0x9D, 0x13, 0x47, 0xE9, 0x07, 0x15, 0x76, 0xE7,
-    0x98, 0xBD, 0xED, 0x17, 0x23, 0x6C, 0xA3, 0x99, 0x56, 0x1D, 0xCC, 0x34, 0x8A, 0x63, 0xE9, 0xB5,
-    0xB3, 0x38, 0xC3, 0x08, 0xFA, 0xD5, 0x66, 0xC3, 0x31, 0xA9, 0x54, 0x5F, 0x8C, 0xAA, 0xE3, 0xFD,
-    0xB2, 0x9F, 0xBC, 0x84, 0xD8, 0x61, 0x8C, 0x0E, 0x05, 0x1F, 0x88, 0xA6, 0x54, 0x10, 0xCF, 0x26,
-    0x7B, 0xC1, 0x9B, 0x64, 0x83, 0x9D, 0x15, 0x80, 0x43, 0x1F, 0xB9, 0x72, 0x30, 0xB6, 0x53, 0x50,
-    0xA9, 0x22, 0xF7, 0xEF, 0xD9, 0xBC, 0xF8, 0xEF, 0x6C, 0x34, 0xD1, 0x92, 0xA6, 0x46, 0x3A, 0x38,
-    0x39, 0x39, 0xC6, 0x3D, 0x57, 0x50, 0xAF, 0x69, 0xE0, 0x3F, 0x53, 0x48, 0xD8, 0x6F, 0xF0, 0x64,
-    0xCE, 0x64, 0x32, 0x43, 0xF1, 0x26, 0x62, 0x29, 0x99, 0xD9, 0x07, 0x94, 0x03, 0xA6, 0xCC, 0xC0,
-    0xBF, 0x59, 0x37, 0xD0, 0x16, 0xB9, 0xCA, 0xBA, 0x63, 0x47, 0x02, 0x1D, 0x91, 0xE8, 0x64, 0xC4,
-    0xC2, 0x71, 0x1E, 0x6C, 0xAF, 0xFD, 0x69, 0xF9, 0xCE, 0x81, 0x3F, 0xED, 0x7D, 0x3D, 0xB0, 0xE5,
-    0xE6, 0x79, 0x1E, 0x70, 0xC0, 0x5D, 0x50, 0x84, 0x2D, 0xEC, 0x4C, 0x96, 0xB1, 0xC5, 0xCD, 0x18,
-    0x2A, 0x5C, 0x28, 0x8A, 0x68, 0xB8, 0x70, 0xE1, 0xC2, 0x12, 0x20, 0x72, 0x12, 0x16, 0x2A, 0x78,
-    0x8B, 0xBD, 0x62, 0x1C, 0x16, 0x4C, 0x91, 0xCC, 0x24, 0x74, 0xB1, 0x29, 0x5C, 0xB8, 0x10, 0x89,
-    0x43, 0x73, 0x26, 0x2C, 0x54, 0x70, 0x3D, 0x23, 0xC5, 0x85, 0x0B, 0x71, 0x32, 0xCC, 0xC4, 0x5A,
-    0x17, 0xEB, 0x22, 0x99, 0x71, 0x21, 0x12, 0x20, 0xB7, 0x60, 0xC1, 0x42, 0x90, 0x28, 0x89, 0x85,
-    0x0A, 0x81, 0x26, 0x39, 0x8A, 0xC5, 0x82, 0xA0, 0x09, 0x0E, 0xB1, 0xBB, 0x00, 0xBE, 0xBC, 0xCF,
-    0xF3, 0xBE, 0x1F, 0xCE, 0xB9, 0x77, 0x7F, 0x48, 0xCB, 0xFC, 0x59, 0x52, 0xBA, 0xA2, 0xCE, 0xDD,
-    0x7B, 0xEF, 0x39, 0xC0, 0xF7, 0xBD, 0xDF, 0xFB, 0xFB, 0xBC, 0x3F, 0x08, 0x82, 0xE0, 0x77, 0x03,
-    0x7C, 0xC5, 0x1D, 0xBF, 0xB9, 0x06, 0xAF, 0xA9, 0xE3, 0x0F, 0xF5, 0x8C, 0xD7, 0xD0, 0x8D, 0xFC,
-    0x56, 0xF3, 0x4F, 0xC1, 0x7F, 0x0A, 0x8E, 0x7E, 0x85, 0x87, 0xF2, 0x55, 0x06, 0x4E, 0xBE, 0x16,
-    0xF9, 0xA0, 0x7C, 0xB5, 0x41, 0x2D, 0xAF, 0xF2, 0xD9, 0x6A, 0x38, 0x51, 0x35, 0x41, 0xE2, 0x82,
-    0x68, 0x92, 0x2B, 0xF7, 0x41, 0xB1, 0x0D, 0xD2, 0x25, 0x88, 0x06, 0xF9, 0xA1, 0x0D, 0x7E, 0x3B,
-    0x08, 0xB2, 0x09, 0x17, 0xD8, 0xE8, 0x3D, 0x0B, 0xFE, 0x10, 0xC9, 0x27, 0xE5, 0xC7, 0xC2, 0x39,
-    0xF9, 0x31, 0x96, 0x1F, 0x4A, 0x59, 0xC6, 0x3B, 0x87, 0x07, 0x01, 0x3E, 0xC9, 0x05, 0x72, 0x9D,
-    0xD9, 0xEC, 0x3F, 0x99, 0x95, 0x41, 0x3E, 0x05, 0xD1, 0x28, 0x9F, 0xDC, 0x06, 0x75, 0x19, 0x14,
-    0x43, 0x90, 0xF6, 0x72, 0xCF, 0x0B, 0x17, 0x5D, 0x90, 0x61, 0x35, 0x1D, 0x2E, 0x29, 0xAB, 0x29,
-    0x9C, 0x5E, 0xDA, 0x7F, 0x6D, 0x06, 0x6E, 0xD9, 0x3D, 0x8F, 0x5B, 0x64, 0x93, 0x7C, 0x4E, 0xAE,
-    0xF7, 0x38, 0x36, 0x9E, 0x75, 0x79, 0x2B, 0xDF, 0x4E, 0x05, 0xC7, 0xBF, 0xEE, 0x94, 0x9D, 0x9E,
-    0xD5, 0x3D, 0x76, 0x81, 0x5E, 0x35, 0xD1, 0x0D, 0xC7, 0xAE, 0x7C, 0x40, 0x16, 0x5C, 0xCB, 0x1E,
-    0x1B, 0x50, 0x4F, 0xD6, 0x83, 0x95, 0x16, 0x65, 0x90, 0xCE, 0x41, 0xB8, 0x15, 0x1A, 0xF2, 0xCE,
-    0xB9, 0xED, 0x51, 0x37, 0xCC, 0x3D, 0xDA, 0x86, 0x2B, 0xE7, 0x64, 0x01, 0x89, 0x3B, 0x3C, 0x5C,
-    0xF7, 0xA8, 0x1B, 0x0E, 0x5D, 0x6B, 0x9F, 0x0C, 0x07, 0x6E, 0x58, 0x88, 0x58, 0x8C, 0x41, 0x32,
-    0xC8, 0x27, 0x85, 0xEA, 0x72, 0xCF, 0x2B, 0x17, 0x5C, 0x1F, 0x2A, 0xF9, 0xB9, 0xC7, 0x96, 0x1B,
-    0x9E, 0x82, 0x13, 0x38, 0x98, 0x43, 0xFE, 0xC5, 0x0D, 0x39, 0xBF, 0xF1, 0x2F, 0xAE, 0x2F, 0x5E,
-    0x3F, 0x37, 0x7F, 0xDD, 0xC5, 0xA3, 0x5C, 0x2E, 0xEB, 0xAA, 0xB2, 0x18, 0x37, 0x73, 0xDC, 0xCB,
-    0xE5, 0xF2, 0x26, 0x0F, 0xAA, 0x3E, 0x3C, 0x8F, 0x85, 0x28, 0xB1, 0x7B, 0x5D, 0xC8, 0x7F, 0x38,
-    0x8F, 0x1F, 0xB0, 0x6B, 0xD2, 0xB4, 0x91, 0x85, 0xC8, 0x17, 0xCE, 0x2C, 0x74, 0x58, 0xC8, 0x36,
-    0x16, 0xE2, 0x57, 0x03, 0xCE, 0x30, 0x76, 0x5C, 0xA5, 0x50, 0x42, 0x96, 0x2C, 0x5B, 0xC0, 0x0F,
-    0xB2, 0x05, 0xF9, 0x41, 0xCE, 0x4C, 0xDE, 0xB9, 0x91, 0x1F, 0x8A, 0x21, 0xE6, 0xB9, 0xE0, 0x92,
-    0x72, 0x43, 0xB9, 0x64, 0xEB, 0x4F, 0x57, 0x29, 0x23, 0xA4, 0x08, 0xB6, 0x5C, 0x43, 0x41, 0xEE,
-    0x10, 0x2A, 0x63, 0x25, 0x35, 0x08, 0x26, 0x77, 0xE0, 0xE1, 0xDF, 0x71, 0xD9, 0x1F, 0x8B, 0x32,
-    0x70, 0xB6, 0xC5, 0x6B, 0x42, 0x0A, 0xC7, 0xBC, 0xCE, 0x46, 0x19, 0x57, 0xDF, 0x9E, 0xE9, 0xDB,
-    0x5F, 0x0B, 0x6E, 0xCC, 0xBE, 0x93, 0x1E, 0x6D, 0x43, 0xF6, 0x9D, 0xC0, 0xBE, 0x87, 0x8E, 0xEC,
-    0x9B, 0x8C, 0x24, 0x85, 0x70, 0x97, 0x2C, 0x33, 0xE9, 0x79, 0x40, 0x0B, 0x99, 0x30, 0x6D, 0x8E,
-    0xB3, 0xEF, 0x76, 0xDD, 0x00, 0x48, 0x41, 0x29, 0xEA, 0xF7, 0x44, 0xEA, 0x38, 0xFB, 0x5E, 0xC3,
-    0x14, 0x5C, 0x72, 0xE2, 0x40, 0xF0, 0x8C, 0xBB, 0x8E, 0x48, 0x69, 0x1C, 0x6D, 0xBB, 0xBF, 0xEC,
-    0x7A, 0x11, 0xB6, 0x95, 0x53, 0x1D, 0x79, 0x16, 0x33, 0x97, 0x3E, 0x09, 0x1B, 0x9D, 0x17, 0x0A,
-    0xC8, 0x2F, 0xA3, 0x29, 0x02, 0x5B, 0x8E, 0x89, 0x30, 0x49, 0xDC, 0x83, 0xBA, 0x71, 0xAB, 0x37,
-    0xD2, 0x85, 0xCA, 0x0A, 0x6F, 0x23, 0xD7, 0x2D, 0x20, 0x2B, 0x5E, 0x75, 0xCF, 0xEE, 0xCA, 0x85,
-    0xA7, 0xFD, 0xB9, 0xEB, 0x6B, 0x0D, 0xC1, 0x08, 0x2A, 0xF9, 0x5B, 0xD2, 0x14, 0xB2, 0xEE, 0xB4,
-    0x2B, 0xE4, 0x9A, 0x45, 0x97, 0xB9, 0xD7, 0x4E, 0xBA, 0x96, 0xFC, 0xDF, 0x18, 0x3B, 0x54, 0x58,
-    0x0E, 0x0E, 0x0B, 0x44, 0x38, 0x51, 0xEE, 0x56, 0xCB, 0xC5, 0xD6, 0xF8, 0x7D, 0xE5, 0xD7, 0xDA,
-    0xC8, 0xFA, 0xE2, 0x29, 0x28, 0x20, 0x31, 0x31, 0x05, 0x06, 0xC2, 0x23, 0x1F, 0x2E, 0x37, 0x5B,
-    0x55, 0x3C, 0x31, 0x8F, 0xAF, 0x80, 0x5C, 0x04, 0x64, 0xBD, 0x88, 0x92, 0x92, 0x92, 0x1C, 0x19,
-    0xFF, 0x98, 0xBB, 0x26, 0xE4, 0xBB, 0x9F, 0x11, 0x2A, 0x74, 0x69, 0x2B, 0x84, 0x0D, 0x17, 0x88,
-    0x4C, 0x0E, 0xF6, 0x53, 0xBE, 0x2C, 0xDC, 0xDF, 0xB8, 0x3E, 0x5A, 0x8F, 0x17, 0xEB, 0xC3, 0x6A,
-    0x82, 0xB3, 0x76, 0xFA, 0x07, 0x20, 0x6D, 0x43, 0x56, 0x0C, 0x49, 0x63, 0x1C, 0x01, 0xA5, 0x4E,
-    0x19, 0x70, 0xB2, 0x53, 0x8B, 0x55, 0x4F, 0xD8, 0x81, 0xF2, 0xB8, 0xC8, 0xB4, 0xD5, 0x60, 0x27,
-    0x99, 0x5E, 0xFB, 0x76, 0x52, 0x5C, 0x0F, 0x51, 0x48, 0x92, 0x2D, 0x24, 0x4E, 0x8B, 0x7B, 0x95,
-    0x11, 0xC9, 0x6D, 0x5F, 0xCF, 0x84, 0xA2, 0xC2, 0x5C, 0xBC, 0xC8, 0xA7, 0xE4, 0x9A, 0xF1, 0x92,
-    0xCA, 0x8F, 0x93, 0x88, 0x78, 0x50, 0x06, 0xE5, 0x51, 0x5E, 0x3D, 0xC0, 0x26, 0x7A, 0x7D, 0x89,
-    0xA9, 0x1D, 0xC9, 0x31, 0x58, 0x84, 0x32, 0x1A, 0x0F, 0x0D, 0x0B, 0xE0, 0x16, 0xA8, 0x77, 0xB8,
-    0xBA, 0x48, 0x5F, 0xB6, 0xB6, 0x32, 0xEE, 0x2D, 0xDD, 0xBD, 0x2C, 0x9E, 0x2B, 0xB9, 0x64, 0xEE,
-    0x42, 0x2F, 0x3C, 0xDA, 0x9A, 0x0B, 0x7B, 0x21, 0x97, 0x42, 0x0D, 0x82, 0xEF, 0x66, 0x1E, 0xCA,
-    0x84, 0xFB, 0x90, 0xB1, 0x55, 0x8A, 0xF5, 0x55, 0x79, 0xFC, 0x08, 0xCF, 0x91, 0xB7, 0xB9, 0x54,
-    0x91, 0xFA, 0x9D, 0x68, 0x18, 0xB7, 0x75, 0xAB, 0xB6, 0x53, 0xC1, 0x88, 0xEC, 0x75, 0xBB, 0xBE,
-    0x72, 0xE5, 0xA6, 0x9B, 0x54, 0x9E, 0xAE, 0x73, 0xAB, 0xF5, 0x26, 0xB7, 0xF3, 0xC2, 0xC5, 0x3D,
-    0xB8, 0x64, 0x45, 0x9E, 0xAC, 0xC1, 0xE7, 0xF2, 0xAA, 0x7C, 0x45, 0x26, 0xFD, 0x96, 0x52, 0x96,
-    0xBA, 0xF2, 0xAC, 0xCA, 0x9C, 0x33, 0xD6, 0x72, 0x54, 0xC9, 0xC1, 0x19, 0xFC, 0xE3, 0x3C, 0x57,
-    0xDB, 0xE8, 0xC5, 0x83, 0x7A, 0x6B, 0xFF, 0x70, 0xB6, 0x1B, 0xF9, 0x87, 0x6E, 0x45, 0xB8, 0x4F,
-    0xFF, 0xB1, 0x99, 0x4D, 0xD4, 0xC5, 0xF4, 0xA9, 0xE0, 0xC6, 0xA2, 0x2B, 0x5F, 0xA7, 0x70, 0x0F,
-    0x4A, 0x39, 0xB1, 0x53, 0x11, 0x8D, 0x87, 0x18, 0x9C, 0x48, 0x6F, 0x56, 0x88, 0xEE, 0x2E, 0x6B,
-    0xD9, 0x07, 0x65, 0x22, 0x9F, 0x71, 0x2B, 0xD9, 0x2E, 0x76, 0xE9, 0xB0, 0x63, 0x58, 0xCF, 0x05,
-    0xAF, 0xE0, 0x12, 0x6A, 0xD4, 0x74, 0x3E, 0x95, 0x0E, 0xD8, 0x7A, 0x3E, 0x7D, 0x45, 0x75, 0x6E,
-    0x3D, 0xD6, 0x42, 0xB8, 0x6A, 0x7E, 0xC0, 0xF5, 0xC2, 0x1F, 0x5C, 0x7D, 0x63, 0xE6, 0x6F, 0x06,
-    0xD9, 0x0B, 0x6E, 0xE7, 0xC4, 0x11, 0xA6, 0xBA, 0x13, 0x66, 0x47, 0xD6, 0x30, 0xE6, 0x3C, 0x60,
-    0x39, 0xD2, 0x94, 0x07, 0x9A, 0xBB, 0x31, 0xD4, 0xCD, 0x57, 0xBD, 0xD1, 0x5D, 0xEE, 0xB0, 0x21,
-    0xE9, 0xB8, 0xA8, 0x96, 0x67, 0x53, 0x9A, 0xC2, 0x93, 0x1F, 0xD5, 0xA4, 0xEF, 0xBF, 0x3B, 0xDA,
-    0xBD, 0xFB, 0x75, 0x33, 0xF0, 0x8E, 0xA7, 0xA1, 0xFF, 0x58, 0x78, 0x38, 0x6A, 0x52, 0xF3, 0xF9,
-    0xF0, 0x01, 0xB7, 0xAD, 0x27, 0xBB, 0xB6, 0x08, 0x2F, 0xAE, 0x2D, 0x17, 0x83, 0x81, 0x6B, 0x74,
-    0x97, 0xA0, 0x2F, 0x54, 0xB2, 0x90, 0x87, 0x36, 0x5F, 0xFE, 0x13, 0x13, 0x2B, 0xEF, 0x0E, 0x61,
-    0xF8, 0xF0, 0xEE, 0xD0, 0xF5, 0x30, 0x32, 0xB9, 0x98, 0x38, 0x98, 0x96, 0x12, 0xDA, 0xBC, 0xC7,
-    0x7E, 0x2A, 0xF3, 0x06, 0x7A, 0x21, 0xC1, 0xB2, 0x27, 0x57, 0x6A, 0x28, 0xF5, 0xE8, 0xC5, 0x08,
-    0xF2, 0x9B, 0x9A, 0x52, 0xF9, 0x46, 0x53, 0x19, 0x54, 0xDB, 0x7C, 0x92, 0xB3, 0x55, 0x5B, 0x19,
-    0x54, 0xB2, 0xDF, 0x8D, 0x2C, 0x46, 0x6E, 0xB6, 0x59, 0x05, 0xCF, 0xF3, 0xB1, 0x9C, 0xFB, 0xC3,
-    0x66, 0x2E, 0x17, 0x0A, 0x06, 0x36, 0xBB, 0x51, 0x37, 0x21, 0xC2, 0x1A, 0x3B, 0x92, 0x44, 0xBE,
-    0x81, 0x9D, 0xF9, 0x8D, 0xCC, 0x0F, 0x82, 0xC9, 0x5B, 0xD2, 0x85, 0x42, 0x2B, 0x7B, 0xA2, 0x77,
-    0x33, 0x53, 0x0C, 0x84, 0x13, 0xC4, 0xA4, 0x89, 0xBC, 0xB7, 0x35, 0x8F, 0xE6, 0x15, 0x39, 0x21,
-    0x59, 0xEE, 0xF3, 0xCA, 0xAA, 0x30, 0x96, 0xC1, 0x9E, 0x0D, 0x94, 0x4F, 0xEA, 0x8F, 0x95, 0x6A,
-    0x98, 0xD4, 0x99, 0x6F, 0x47, 0x31, 0x09, 0x12, 0xDB, 0xFB, 0xE7, 0x82, 0xEB, 0x7C, 0x81, 0x13,
-    0x4E, 0xCE, 0x2A, 0xD5, 0x35, 0x35, 0x66, 0x97, 0x0A, 0x67, 0xE6, 0xEE, 0x72, 0x00, 0xB6, 0x92,
-    0x25, 0xC7, 0xEE, 0x59, 0x9E, 0x6B, 0xD1, 0x7E, 0x1E, 0x5B, 0x8E, 0x66, 0x15, 0xCF, 0x9C, 0xF2,
-    0x3F, 0x87, 0x4E, 0xCF, 0x3F, 0xED, 0x55, 0x8E, 0xEB, 0x92, 0x0B, 0x88, 0x47, 0xF3, 0x78, 0xA8,
-    0x3E, 0xD4, 0xA2, 0x41, 0x7F, 0x99, 0xE0, 0x2A, 0xD7, 0xB8, 0xAE, 0xE8, 0x95, 0x9F, 0xEA, 0x4E,
-    0xA5, 0x9A, 0x6F, 0xAF, 0x7B, 0xB2, 0xD0, 0x06, 0x04, 0x50, 0x4E, 0xA2, 0xD4, 0x0B, 0xCB, 0x41,
-    0x40, 0xE8, 0x4F, 0x4C, 0xA0, 0xB3, 0x5F, 0x70, 0x1F, 0x28, 0xBB, 0x6F, 0x4D, 0x02, 0x4D, 0xD5,
-    0xAF, 0x44, 0x12, 0x2B, 0xA3, 0x5F, 0xF1, 0x6C, 0xFF, 0xA8, 0x8C, 0x8A, 0x91, 0x9D, 0xA0, 0x9C,
-    0x45, 0x73, 0xEC, 0x2D, 0x9B, 0xED, 0xF5, 0xA8, 0x05, 0xD9, 0x39, 0x01, 0xA5, 0x8C, 0x1D, 0x99,
-    0xFF, 0xDB, 0x65, 0xEA, 0x01, 0x0F, 0xF2, 0xFF, 0xD7, 0x54, 0x13, 0x81, 0x3F, 0x70, 0xBC, 0xD4,
-    0x59, 0x72, 0x8F, 0x0D, 0x16, 0x86, 0x4D, 0xD0, 0xCE, 0xC1, 0x4F, 0xC4, 0xFD, 0x20, 0xCD, 0xD0,
-    0xA5, 0xDC, 0x28, 0x9D, 0x60, 0xD1, 0x18, 0x38, 0x60, 0xD9, 0x7E, 0xFD, 0x32, 0x55, 0xFD, 0x90,
-    0x0F, 0xB8, 0x96, 0x58, 0x89, 0x89, 0xD7, 0xAA, 0xDF, 0x75, 0xDC, 0xA4, 0xDC, 0x76, 0x4B, 0xA2,
-    0xC8, 0xED, 0xA9, 0x42, 0x33, 0x47, 0xA5, 0x20, 0xD7, 0x52, 0x06, 0x92, 0x03, 0x54, 0xD5, 0x18,
-    0xE9, 0x21, 0xEA, 0x0F, 0xBA, 0x2E, 0x71, 0xCA, 0xE5, 0x17, 0xB2, 0xEA, 0x46, 0xFE, 0xBF, 0xC5,
-    0xC9, 0xF3, 0xF4, 0x71, 0x58, 0x35, 0x2D, 0xCC, 0xDE, 0xD7, 0x17, 0x40, 0xA5, 0x2E, 0xF8, 0x06,
-    0xB5, 0x57, 0x80, 0x53, 0x4B, 0x87, 0x78, 0xE0, 0x11, 0xF3, 0xCC, 0xCC, 0xF6, 0x87, 0xC6, 0x6A,
-    0x27, 0xCA, 0xEB, 0x50, 0xAC, 0x3C, 0x71, 0x78, 0x56, 0x16, 0xDC, 0x14, 0xE4, 0x61, 0xF9, 0x26,
-    0x4E, 0x0A, 0x1C, 0xE9, 0x0E, 0xA4, 0x89, 0x1C, 0x97, 0x95, 0xD0, 0xFD, 0x92, 0x8B, 0x73, 0xA1,
-    0x60, 0x0B, 0xD9, 0x4D, 0xD5, 0xD0, 0x00, 0x63, 0x49, 0xE9, 0x44, 0x1E, 0x4F, 0xE6, 0x88, 0x1E,
-    0xE1, 0x82, 0x37, 0xCA, 0x67, 0x33, 0xE5, 0x9F, 0xA2, 0xE1, 0x1A, 0x74, 0xED, 0xCE, 0x1C, 0x2F,
-    0x95, 0x85, 0x5A, 0xF5, 0x75, 0xA1, 0x9C, 0x81, 0x2B, 0x06, 0xBF, 0x11, 0xF2, 0x8D, 0x45, 0xC2,
-    0x35, 0x57, 0x2A, 0x52, 0x95, 0xF2, 0x4E, 0xA1, 0xD7, 0xC8, 0x95, 0x41, 0xC2, 0xF2, 0xA8, 0xCA,
-    0x8C, 0x54, 0x0C, 0xE1, 0x3C, 0x2C, 0x74, 0x51, 0x73, 0x37, 0x87, 0x35, 0x3E, 0x59, 0x0D, 0xAA,
-    0xF7, 0xE0, 0xB6, 0xE3, 0x3C, 0x52, 0xE7, 0xDD, 0x86, 0xED, 0xEA, 0x22, 0x78, 0xEF, 0xE1, 0x3D,
-    0xDE, 0xD8, 0xDA, 0x1B, 0xFB, 0xD5, 0xA5, 0x58, 0xBD, 0x8D, 0xFD, 0x37, 0x86, 0xFE, 0x8D, 0xF5,
-    0xF1, 0x37, 0x2E, 0x3B, 0x17, 0x04, 0x87, 0xBE, 0x11, 0x17, 0xEF, 0xE2, 0x62, 0x96, 0xCE, 0xFB,
-    0xBC, 0xEA, 0x90, 0xF8, 0x08, 0x29, 0x9D, 0xBC, 0x3C, 0xD8, 0xA9, 0x79, 0x2E, 0x28, 0x4C, 0x2C,
-    0x52, 0x13, 0xAC, 0x68, 0xB0, 0x37, 0x78, 0x57, 0xE6, 0x2B, 0xFE, 0x98, 0xAF, 0x11, 0x95, 0x73,
-    0x7A, 0x89, 0x5C, 0x3F, 0x11, 0xAB, 0x9F, 0xEC, 0x4F, 0x25, 0x57, 0x79, 0x8B, 0x8C, 0x6D, 0xCC,
-    0xD5, 0xCD, 0xDE, 0xA5, 0x75, 0x8F, 0xE6, 0x42, 0x9D, 0x85, 0xC7, 0xD5, 0xE4, 0xF7, 0xFC, 0x71,
-    0xB3, 0x6C, 0xB8, 0xAA, 0xAA, 0xE1, 0xE1, 0xA4, 0xA3, 0xB9, 0x3A, 0x6A, 0x81, 0x8A, 0x36, 0xB0,
-    0xB8, 0x01, 0x97, 0x0C, 0xD5, 0xBC, 0xA8, 0x4E, 0x07, 0xBB, 0x5C, 0xB8, 0x00, 0x8A, 0x50, 0x14,
-    0x74, 0x49, 0x38, 0x86, 0x45, 0x69, 0x44, 0xC9, 0x9B, 0x45, 0x78, 0xCF, 0xCB, 0xFF, 0xE7, 0x42,
-    0x84, 0x5A, 0x28, 0xF5, 0xAA, 0x2C, 0x89, 0x56, 0x5B, 0xC3, 0x85, 0x68, 0x17, 0x02, 0x8E, 0xF4,
-    0x14, 0x10, 0xEC, 0xF6, 0x27, 0x1C, 0x63, 0x51, 0x44, 0x80, 0x0B, 0x48, 0x24, 0x8A, 0x2C, 0xD2,
-    0xDB, 0x3C, 0xE5, 0x1D, 0x1E, 0xF5, 0x51, 0x52, 0x77, 0x56, 0x2D, 0xE1, 0xAC, 0xCA, 0x70, 0x50,
-    0x1B, 0x88, 0x4F, 0x9F, 0x84, 0x73, 0xB7, 0xC0, 0x55, 0xC4, 0xA7, 0xDD, 0x16, 0xBB, 0x42, 0xE8,
-    0xD1, 0xE3, 0xEC, 0x10, 0x51, 0xCD, 0xB4, 0xFD, 0x0E, 0x7F, 0x8E, 0x11, 0x4D, 0xBD, 0xFE, 0x10,
-    0xE5, 0x16, 0x0A, 0x60, 0x3D, 0xC6, 0xCB, 0xC7, 0x89, 0x7F, 0x97, 0x33, 0x07, 0x7C, 0x56, 0xB3,
-    0xDB, 0xC9, 0xFD, 0xAE, 0xC8, 0x0F, 0x9F, 0xCB, 0xA6, 0x58, 0x43, 0x9C, 0x0A, 0xA2, 0xB7, 0xC5,
-    0xC1, 0xC3, 0x44, 0x41, 0xD5, 0xE0, 0xCE, 0x42, 0xCB, 0xBA, 0xC5, 0x9F, 0x0B, 0xFC, 0xF9, 0x47,
-    0x20, 0xFC, 0x4A, 0xC9, 0x59, 0x59, 0x08, 0x86, 0x2B, 0x74, 0x34, 0xF3, 0x50, 0x25, 0xF0, 0x6E,
-    0x3B, 0xBA, 0x19, 0x93, 0x05, 0x80, 0x08, 0xFF, 0x69, 0xA6, 0x35, 0x12, 0x0C, 0xE5, 0xCF, 0xF5,
-    0x65, 0x71, 0x4E, 0xE2, 0x5D, 0x70, 0x4E, 0x8F, 0xF8, 0xCA, 0x27, 0x38, 0x26, 0x0B, 0xD5, 0x83,
-    0x50, 0x46, 0xC3, 0x87, 0x6A, 0xC6, 0xD9, 0xE6, 0x3C, 0xE2, 0x3D, 0x99, 0x1A, 0x31, 0x2C, 0x5B,
-    0x9D, 0xA6, 0xD9, 0x38, 0xC2, 0xD9, 0xBD, 0x2A, 0x55, 0xE0, 0x41, 0x4E, 0x2F, 0x06, 0x6C, 0xAE,
-    0x98, 0x41, 0x3C, 0xEA, 0x62, 0xE5, 0x03, 0xFA, 0x46, 0x67, 0x4E, 0x6F, 0xBD, 0xD5, 0x37, 0x16,
-    0x8D, 0xBE, 0x51, 0x0C, 0x30, 0xDF, 0x98, 0xF6, 0xBA, 0x60, 0xB9, 0x13, 0xDF, 0x18, 0x4F, 0xF4,
-    0xD0, 0xC0, 0xDF, 0x5E, 0x44, 0xF8, 0x46, 0x68, 0x3D, 0xBC, 0xF1, 0xA4, 0xFB, 0xF1, 0xE1, 0x43,
-    0x4B, 0x69, 0xFA, 0xC0, 0x29, 0xA2, 0xC1, 0xF8, 0x4C, 0xC1, 0x02, 0x35, 0xC2, 0xD9, 0xA0, 0x3A,
-    0x53, 0xAE, 0xA6, 0xA6, 0x7D, 0x21, 0xA8, 0x13, 0xE0, 0x00, 0x16, 0x53, 0x0D, 0x85, 0xA9, 0x86,
-    0x8C, 0x7E, 0x7B, 0x6F, 0x36, 0xF3, 0xAF, 0x3F, 0xC1, 0x18, 0x91, 0x3A, 0xF2, 0xB0, 0x59, 0xF8,
-    0x58, 0x4E, 0x55, 0x40, 0x53, 0xEA, 0xA0, 0x20, 0x06, 0xB5, 0xAE, 0x13, 0xC2, 0xDB, 0x5C, 0x96,
-    0x9E, 0xBC, 0x39, 0x04, 0x95, 0x30, 0xF8, 0x9B, 0x4D, 0x70, 0x5B, 0x26, 0x3E, 0x68, 0x99, 0x8E,
-    0xB7, 0xE3, 0x60, 0x9A, 0x74, 0x32, 0x0D, 0x5A, 0x6C, 0x8B, 0x3E, 0xF6, 0xA1, 0x83, 0x84, 0xA6,
-    0xBC, 0xD5, 0x66, 0x8A, 0xD5, 0x8C, 0xC9, 0x66, 0xC4, 0xC0, 0x67, 0xAD, 0xA9, 0x58, 0xD7, 0x2C,
-    0xE6, 0x9E, 0x28, 0x2F, 0x79, 0xE7, 0x59, 0xD7, 0xC7, 0xA5, 0x96, 0xFA, 0xCB, 0xE7, 0x9D, 0x69,
-    0xEA, 0x7C, 0x12, 0xC7, 0xC0, 0x40, 0xBB, 0xB6, 0xE8, 0x33, 0xDE, 0x2A, 0x13, 0xF9, 0xDC, 0x52,
-    0x67, 0x8A, 0x67, 0x2C, 0x0E, 0x0D, 0x0D, 0xB5, 0x98, 0xFC, 0x5C, 0x39, 0x0C, 0xF0, 0x1E, 0x4E,
-    0x1B, 0x01, 0xAA, 0x7C, 0x87, 0xC0, 0x96, 0x42, 0x35, 0x89, 0x2E, 0x46, 0x0A, 0x48, 0x01, 0x77,
-    0x64, 0xC1, 0xAE, 0x23, 0x02, 0x0C, 0xF0, 0x0C, 0x4A, 0x8A, 0x33, 0x1C, 0x17, 0xB9, 0xC3, 0x81,
-    0x79, 0xD1, 0x7B, 0xDA, 0xA6, 0xB3, 0x68, 0xBF, 0x36, 0x47, 0x42, 0x48, 0x21, 0xC4, 0xC2, 0xD6,
-    0xC5, 0xA7, 0x99, 0x70, 0xDA, 0x8F, 0x42, 0xB8, 0x4E, 0xD8, 0x51, 0x51, 0x12, 0x20, 0x9F, 0x87,
-    0x30, 0xCF, 0x05, 0x36, 0x9B, 0x69, 0xA4, 0xEE, 0xC8, 0xA8, 0xCB, 0xEA, 0x92, 0x91, 0x0E, 0xC5,
-    0x2C, 0x9C, 0x95, 0xB8, 0x08, 0x3A, 0xE9, 0xD2, 0x8C, 0xAD, 0x42, 0xAD, 0xF4, 0x0C, 0xF4, 0x13,
-    0xD2, 0xAA, 0xC6, 0xDA, 0x4E, 0xD2, 0x17, 0x09, 0xCF, 0xFE, 0x4A, 0x3A, 0x6A, 0x72, 0x45, 0x65,
-    0xAE, 0x3E, 0xF8, 0x23, 0xE3, 0xB7, 0x54, 0xA1, 0xDD, 0xD1, 0x8C, 0xB6, 0xBB, 0xEA, 0xCC, 0x14,
-    0x9B, 0x2D, 0xCE, 0x3C, 0xC0, 0x74, 0xAD, 0xD7, 0xB6, 0x86, 0x06, 0xD0, 0x72, 0xA9, 0x85, 0x53,
-    0xA0, 0x63, 0x68, 0x18, 0x68, 0x49, 0x50, 0x05, 0xEB, 0x65, 0xDC, 0x87, 0xF5, 0xE2, 0xA8, 0xB0,
-    0xF7, 0x7C, 0x09, 0x2C, 0xBE, 0x69, 0x49, 0xCB, 0xC8, 0x99, 0xB7, 0x42, 0xD2, 0xE5, 0xCA, 0x52,
-    0xD8, 0x6E, 0xC6, 0x85, 0x14, 0x63, 0x32, 0xE3, 0x28, 0x22, 0x77, 0x8F, 0xFB, 0x9A, 0x23, 0x73,
-    0x48, 0xFC, 0xCA, 0xFD, 0x57, 0xBD, 0x91, 0x6E, 0x34, 0x5A, 0x2E, 0x94, 0x71, 0x38, 0x7A, 0x1B,
-    0x25, 0x1D, 0x43, 0x01, 0xA1, 0x65, 0xAF, 0x4A, 0xBF, 0x50, 0x2F, 0x92, 0x3F, 0xE8, 0xBA, 0x60,
-    0x34, 0x06, 0x06, 0x0B, 0x3C, 0xB1, 0x82, 0xFE, 0x27, 0x75, 0xDD, 0x94, 0x68, 0xB8, 0xBF, 0x8B,
-    0x09, 0xCB, 0xB0, 0xA6, 0xCA, 0x52, 0xD6, 0x77, 0x63, 0xC4, 0xAD, 0xAA, 0xA8, 0x87, 0xE0, 0xB8,
-    0x37, 0x79, 0xD5, 0x74, 0xB8, 0x9D, 0x77, 0xE2, 0x01, 0xB8, 0x0E, 0x76, 0x09, 0x0A, 0x97, 0xAE,
-    0x65, 0x36, 0x99, 0x92, 0xEC, 0x73, 0x8D, 0x94, 0x9F, 0x53, 0x80, 0xC4, 0xE4, 0xD9, 0xE2, 0xA1,
-    0xD0, 0x24, 0x39, 0x71, 0x6A, 0x9D, 0x8A, 0x51, 0x1D, 0x30, 0xD7, 0xD2, 0xB5, 0x11, 0xAA, 0x52,
-    0x7A, 0x85, 0x54, 0x94, 0x96, 0x5A, 0xE5, 0x56, 0x8D, 0x2A, 0x62, 0x2E, 0x4A, 0x2C, 0x3C, 0xDB,
-    0x54, 0x31, 0x38, 0x5B, 0x30, 0x05, 0x35, 0xF5, 0x52, 0xCA, 0x13, 0xDC, 0x87, 0x3A, 0x32, 0x35,
-    0xAF, 0x0A, 0x74, 0x8C, 0x7B, 0x38, 0x47, 0xDD, 0xA8, 0xA1, 0xA9, 0xB7, 0xDE, 0xE0, 0x14, 0xFE,
-    0xFB, 0xA8, 0x10, 0x07, 0x41, 0x0F, 0x51, 0x8C, 0x6A, 0x98, 0x26, 0x95, 0xCA, 0xD8, 0x96, 0x97,
-    0x0C, 0xFA, 0x1D, 0x06, 0x8C, 0x96, 0xAF, 0x53, 0xE5, 0x0D, 0x6C, 0x83, 0xDF, 0x55, 0xD7, 0xC8,
-    0xE5, 0x15, 0xCE, 0x71, 0x6A, 0x93, 0xA9, 0x78, 0xCC, 0xC0, 0xC8, 0x77, 0xA0, 0x1A, 0x38, 0x6D,
-    0x80, 0x1A, 0x38, 0xE4, 0x5A, 0xA3, 0xE0, 0x80, 0xAC, 0xA6, 0x21, 0x5E, 0x8E, 0xEF, 0x0A, 0x68,
-    0x74, 0x7B, 0xDA, 0xE7, 0x4E, 0x18, 0x02, 0x18, 0xE3, 0x02, 0xBB, 0x83, 0x37, 0x4E, 0xC4, 0x90,
-    0x5A, 0x05, 0x57, 0x29, 0xB0, 0xBA, 0x44, 0xCE, 0x9A, 0xFC, 0x1E, 0x11, 0x8E, 0x1C, 0x94, 0x8B,
-    0x14, 0x59, 0xAE, 0xEB, 0x2E, 0x5A, 0x68, 0xDE, 0xBF, 0x3F, 0x86, 0x33, 0x05, 0xFE, 0x55, 0x91,
-    0x5E, 0x9C, 0x41, 0x32, 0x88, 0xA8, 0xDD, 0x0F, 0x76, 0x9D, 0x8A, 0xBE, 0xA0, 0x3F, 0xEA, 0x92,
-    0x39, 0x6F, 0x68, 0xF2, 0x1F, 0x73, 0xF7, 0x33, 0x80, 0x2D, 0xDA, 0xEA, 0x8D, 0x1E, 0x66, 0x2B,
-    0x15, 0x31, 0x19, 0xB1, 0xB9, 0x58, 0x78, 0x47, 0x18, 0x6E, 0x4B, 0x54, 0x48, 0x15, 0x30, 0x0F,
-    0x09, 0xC7, 0x5B, 0x89, 0x0E, 0x29, 0x93, 0x05, 0xF6, 0x3B, 0x04, 0x23, 0x96, 0x34, 0xE0, 0x2D,
-    0xAC, 0x9F, 0xDA, 0xDA, 0x02, 0xB0, 0x7F, 0xB0, 0x79, 0x4A, 0x7C, 0x42, 0xD9, 0xFA, 0xA8, 0x30,
-    0x78, 0xAA, 0x46, 0x8F, 0x88, 0xBE, 0x9A, 0xC2, 0xED, 0x11, 0x1D, 0x17, 0x7A, 0x1D, 0x97, 0xAB,
-    0xEF, 0x34, 0x04, 0x3E, 0x2C, 0x09, 0x9C, 0xD7, 0x71, 0x8B, 0xE9, 0x53, 0x1F, 0x76, 0x64, 0xA6,
-    0xE3, 0x36, 0xA6, 0xE3, 0x4C, 0x96, 0x9A, 0xE3, 0xB2, 0xE4, 0x56, 0xE7, 0x87, 0x6C, 0x1C, 0xFB,
-    0x5F, 0x88, 0x09, 0xFE, 0xBA, 0xCA, 0xE5, 0x4D, 0xAF, 0xA5, 0x42, 0x7F, 0x63, 0x1D, 0x97, 0x99,
-    0x8E, 0xCB, 0x4D, 0xC7, 0xC5, 0x5E, 0x50, 0x8F, 0xEA, 0xB8, 0x33, 0x0A, 0x4B, 0x19, 0x4C, 0x85,
-    0x5D, 0xA6, 0xF4, 0x2E, 0x62, 0x77, 0xF9, 0x41, 0xD9, 0x2E, 0x1D, 0x47, 0x91, 0x6D, 0x79, 0xCB,
-    0x1C, 0xF3, 0xBE, 0x1D, 0x4E, 0x39, 0x77, 0x99, 0xC3, 0x42, 0xDE, 0xD6, 0x8F, 0xE9, 0xAA, 0xDE,
-    0x55, 0xE5, 0x51, 0xF3, 0x87, 0x37, 0xB9, 0xD9, 0x45, 0xD5, 0xF9, 0xCF, 0xF0, 0x43, 0x35, 0x29,
-    0xAA, 0xFD, 0x4D, 0x82, 0x56, 0x3D, 0xDE, 0x96, 0x2F, 0x31, 0x93, 0x3E, 0xB8, 0x41, 0x48, 0x3F,
-    0x20, 0xAC, 0xCD, 0xB1, 0xD9, 0x92, 0x30, 0xAD, 0x77, 0x94, 0x35, 0x1C, 0x14, 0xAE, 0x2C, 0x77,
-    0x7E, 0xE2, 0xA1, 0x8F, 0xB5, 0x3A, 0xC3, 0xC0, 0x06, 0x15, 0x42, 0x9E, 0xD0, 0xE5, 0xC3, 0x07,
-    0x3C, 0x89, 0x3C, 0x31, 0x3D, 0xA9, 0x3C, 0x51, 0x29, 0x27, 0x0C, 0x1C, 0x8F, 0xBD, 0xD1, 0xEB,
-    0x3A, 0x7D, 0x63, 0xFB, 0xDE, 0x6F, 0xCC, 0x7D, 0xE0, 0x68, 0x4A, 0xFB, 0xA6, 0x6F, 0xDC, 0x50,
-    0x94, 0xF4, 0x70, 0x2A, 0x65, 0x2F, 0x20, 0x69, 0x5B, 0x8B, 0x82, 0x77, 0xD9, 0x89, 0x13, 0xB5,
-    0x7B, 0x4A, 0x63, 0xAF, 0x3E, 0x30, 0xFF, 0x9E, 0x10, 0x5F, 0x70, 0xF2, 0x01, 0xC7, 0x9C, 0x4C,
-    0xDD, 0x5B, 0xD4, 0x51, 0xF0, 0x56, 0x91, 0xE2, 0x5D, 0x44, 0x71, 0x9A, 0x48, 0x81, 0x3E, 0x5D,
-    0xB5, 0xEE, 0x7E, 0x43, 0xE4, 0xEC, 0xAB, 0xF8, 0xA4, 0x26, 0x2C, 0x12, 0x65, 0x38, 0xFE, 0x5B,
-    0xF8, 0xF8, 0xE0, 0x48, 0x9A, 0x6C, 0xCF, 0x5B, 0x1C, 0xF7, 0xDC, 0xFF, 0xFA, 0xB2, 0x69, 0x5A,
-    0x65, 0x5D, 0x75, 0xE2, 0x97, 0x6B, 0x32, 0x2A, 0x19, 0xB8, 0x2D, 0x24, 0x27, 0x69, 0xF0, 0x98,
-    0xBB, 0xD7, 0x7E, 0x6B, 0x82, 0xFD, 0x8F, 0x44, 0x82, 0x7B, 0xE6, 0x55, 0x84, 0x9B, 0x06, 0xE6,
-    0x55, 0x3A, 0x0D, 0x20, 0xF2, 0x79, 0x0F, 0xE3, 0x9E, 0x76, 0x80, 0x52, 0x7D, 0xA3, 0xD7, 0xC9,
-    0xBF, 0x86, 0xDB, 0x0A, 0xEA, 0xA1, 0x81, 0x5B, 0x51, 0x08, 0xC7, 0x0B, 0xEB, 0x36, 0x1A, 0xC6,
-    0xC5, 0xCE, 0x07, 0x6B, 0x74, 0x86, 0x08, 0xD9, 0x81, 0x87, 0x14, 0xAB, 0x54, 0x99, 0xFB, 0x7B,
-    0x65, 0x1E, 0x8D, 0xE3, 0x15, 0xA8, 0x4C, 0x7B, 0x50, 0xF5, 0x85, 0x11, 0xE6, 0xF4, 0x15, 0x28,
-    0xE4, 0x78, 0x28, 0x84, 0x96, 0x9B, 0x31, 0x2C, 0x45, 0x23, 0x9D, 0xF6, 0xE0, 0xB9, 0x05, 0x36,
-    0xCA, 0x9A, 0x0A, 0x61, 0xFB, 0xC8, 0xF4, 0x7D, 0xFD, 0x79, 0x6B, 0x68, 0xAF, 0xDF, 0x52, 0xEC,
-    0x09, 0xAA, 0xA9, 0x80, 0xE5, 0xD3, 0x02, 0xF4, 0x58, 0xA6, 0x03, 0xF0, 0xED, 0xA4, 0xEE, 0xF7,
-    0x40, 0x4E, 0x51, 0x02, 0x18, 0x4C, 0xA2, 0x5E, 0xF6, 0xBF, 0xA1, 0x11, 0x8D, 0x77, 0x2A, 0x00,
-    0x98, 0xF5, 0x50, 0xBD, 0x05, 0xBF, 0x61, 0x5B, 0x75, 0x05, 0xFC, 0xC0, 0xBA, 0xCD, 0x66, 0xEC,
-    0xAB, 0x49, 0x97, 0x5C, 0xBF, 0x15, 0x80, 0x2D, 0xD2, 0xB9, 0x10, 0x15, 0x22, 0xC1, 0x77, 0x31,
-    0x20, 0x09, 0x3B, 0x15, 0xF2, 0x11, 0xB8, 0x90, 0x33, 0x32, 0xA4, 0x62, 0x43, 0xEE, 0x73, 0x09,
-    0x3D, 0x4D, 0x10, 0x36, 0xB4, 0xB4, 0x44, 0x66, 0xCC, 0x9B, 0xED, 0xAF, 0x21, 0xA8, 0x16, 0x85,
-    0x5B, 0xD5, 0xF0, 0xEA, 0xB7, 0xBB, 0x2E, 0x5C, 0xD8, 0xAE, 0x1E, 0xF0, 0x59, 0x70, 0x75, 0x57,
-    0x68, 0x58, 0xDD, 0xE2, 0xFB, 0x86, 0x9C, 0xDE, 0x92, 0x73, 0x49, 0x98, 0x6C, 0xD1, 0xAB, 0xC9,
-    0x7A, 0xAB, 0x4E, 0xDD, 0x0F, 0x4B, 0xC1, 0x5C, 0x72, 0x1A, 0x59, 0xFC, 0x6C, 0x32, 0x94, 0xA6,
-    0xB7, 0xF0, 0xC4, 0x47, 0x24, 0x4A, 0xB2, 0xDC, 0x30, 0x53, 0xFF, 0xF3, 0x1A, 0xA6, 0x18, 0xD5,
-    0x16, 0x0B, 0xB1, 0x7B, 0xA5, 0x7C, 0xDD, 0xD4, 0x8A, 0x15, 0x97, 0x94, 0xD7, 0xD8, 0xE2, 0xDC,
-    0x6C, 0x5C, 0x71, 0xAF, 0x94, 0x6E, 0xE5, 0xC2, 0xF4, 0xAF, 0x28, 0xCA, 0x7B, 0xCC, 0xE9, 0x8D,
-    0x48, 0xF1, 0x4F, 0x3E, 0x16, 0xE7, 0x76, 0xB1, 0x77, 0x7A, 0x3C, 0xF6, 0xDE, 0x3F, 0x5C, 0xF8,
-    0x03, 0xCA, 0x9D, 0x1E, 0x96, 0xAB, 0x8D, 0x4D, 0xF3, 0xE3, 0xB0, 0x9C, 0x7D, 0x30, 0xF8, 0x2F,
-    0xF4, 0xDA, 0x41, 0x22, 0xD1, 0x26, 0x72, 0x93, 0x97, 0xE5, 0x9A, 0x62, 0x46, 0x85, 0x98, 0x20,
-    0x0D, 0xAB, 0x09, 0x46, 0xCD, 0x38, 0x20, 0x29, 0x0F, 0xE5, 0x10, 0x6A, 0xAE, 0x9E, 0xC9, 0x88,
-    0xDE, 0xA7, 0x6F, 0x5C, 0xEF, 0x13, 0x11, 0x4C, 0xBE, 0x50, 0x47, 0x67, 0xEE, 0x0A, 0x38, 0xB0,
-    0x50, 0xE7, 0xD1, 0x6C, 0x5E, 0x66, 0xC8, 0xBE, 0xA9, 0x41, 0xD3, 0x20, 0xEA, 0xE7, 0x79, 0x56,
-    0x55, 0xE8, 0xC5, 0x54, 0x4C, 0xE6, 0x82, 0x1D, 0xA7, 0xAA, 0x1B, 0x1C, 0xAB, 0xAC, 0xC9, 0xA2,
-    0xBF, 0xCA, 0xFF, 0xE0, 0x83, 0x4F, 0xC2, 0xA9, 0x95, 0x26, 0x8E, 0x9F, 0x70, 0x62, 0x88, 0xE9,
-    0xD3, 0xB4, 0x39, 0xFE, 0xEB, 0x78, 0x1C, 0x55, 0xEF, 0x63, 0x37, 0x4B, 0x97, 0xE1, 0xD6, 0xF8,
-    0xAF, 0xA5, 0x83, 0x2C, 0xFF, 0x65, 0x7A, 0x80, 0x21, 0x92, 0xD5, 0xAA, 0x5E, 0x34, 0x9D, 0x84,
-    0x83, 0xD9, 0x98, 0x2B, 0x0D, 0x0D, 0x34, 0x32, 0x10, 0x25, 0xF8, 0x56, 0xD2, 0x31, 0x2D, 0xD6,
-    0xAB, 0xC7, 0xBB, 0xAB, 0xCB, 0x8F, 0xFE, 0xEA, 0x8B, 0xDD, 0x80, 0xEC, 0xE1, 0x14, 0x8C, 0x91,
-    0xAB, 0x67, 0x7B, 0x57, 0x57, 0x8F, 0x37, 0xDF, 0xBB, 0xFA, 0x76, 0xBD, 0xFA, 0xB0, 0x5B, 0xFB,
-    0xB7, 0x1F, 0x74, 0x87, 0x0F, 0x39, 0x8F, 0xCC, 0xEE, 0x61, 0xB2, 0xE6, 0x01, 0x39, 0xEF, 0x69,
-    0x7D, 0x94, 0xB4, 0x89, 0x7E, 0x59, 0xDA, 0x74, 0x1F, 0x10, 0x6D, 0xAA, 0x3D, 0xDA, 0x94, 0x3B,
-    0xDA, 0xB4, 0x2B, 0x6D, 0xE6, 0x1D, 0x6D, 0x56, 0xE8, 0x26, 0xDD, 0xE5, 0xD6, 0x77, 0x4E, 0x63,
-    0xD6, 0xAF, 0xB6, 0x7E, 0x67, 0xF8, 0xB3, 0xD5, 0x6F, 0xD9, 0xEC, 0x3E, 0x93, 0xAF, 0x9F, 0x09,
-    0x9F, 0x52, 0x9B, 0x7B, 0x96, 0xAA, 0x7D, 0xD1, 0x44, 0x1E, 0xC3, 0x42, 0x51, 0xB5, 0xC5, 0x8F,
-    0x20, 0xC4, 0xE2, 0xE6, 0xCF, 0x80, 0x6E, 0xE0, 0xBB, 0x87, 0x13, 0xF7, 0x58, 0x28, 0xC2, 0xA6,
-    0x1A, 0x4D, 0x09, 0x20, 0x1B, 0xFB, 0x56, 0xB0, 0x5A, 0xC7, 0x7A, 0x95, 0x1A, 0x09, 0xEA, 0xE7,
-    0x8D, 0x68, 0xF4, 0x18, 0x50, 0x94, 0x12, 0xBC, 0x41, 0x84, 0x70, 0x2D, 0xE2, 0x1B, 0x33, 0xCC,
-    0x8D, 0x40, 0xC6, 0x77, 0xC4, 0x4F, 0xD0, 0xCA, 0x23, 0x35, 0x38, 0x9B, 0x23, 0xA0, 0x2F, 0xCB,
-    0x04, 0x02, 0x2B, 0x55, 0xEA, 0xD5, 0x2C, 0xEF, 0xFE, 0xC5, 0x48, 0x7D, 0x43, 0x89, 0x23, 0xEE,
-    0x42, 0x67, 0x91, 0x42, 0x99, 0xF9, 0xDA, 0x05, 0xAB, 0x5B, 0x68, 0xD7, 0x7A, 0x86, 0x26, 0xF0,
-    0x65, 0x11, 0xCD, 0x7E, 0xC5, 0x83, 0x29, 0xBD, 0x1F, 0xAD, 0x45, 0x0E, 0x4E, 0xCB, 0x9E, 0xE8,
-    0xF5, 0x6D, 0xAD, 0x0C, 0xC2, 0x23, 0x1D, 0x80, 0x89, 0x07, 0xAF, 0x05, 0x8B, 0x49, 0x0B, 0x28,
-    0x66, 0xFE, 0x6B, 0x6B, 0x3C, 0xE7, 0x75, 0xA5, 0xFF, 0x17, 0x98, 0x42, 0x8B, 0x30, 0x46, 0xB9,
-    0x69, 0x6A, 0x3C, 0xE1, 0x14, 0x06, 0xA8, 0xC5, 0x59, 0x6A, 0x73, 0x9F, 0xC8, 0xB8, 0x07, 0xFB,
-    0xA3, 0x32, 0x8A, 0xED, 0x5F, 0x4B, 0x99, 0xAE, 0x1A, 0x74, 0x9F, 0x2E, 0xFA, 0x5B, 0x7D, 0x4D,
-    0xD4, 0x36, 0x1D, 0x29, 0x46, 0xE8, 0x76, 0xBE, 0x0D, 0x5F, 0x43, 0xAB, 0x25, 0xD2, 0x62, 0x84,
-    0x1F, 0xAF, 0xC0, 0x7D, 0x64, 0x85, 0x5F, 0x30, 0xC7, 0xB2, 0x37, 0xCD, 0x5A, 0x67, 0x8B, 0x9D,
-    0x57, 0xC6, 0x30, 0x56, 0x11, 0x70, 0x3D, 0x44, 0xD9, 0x83, 0xFC, 0x12, 0x3C, 0x3D, 0x2A, 0x00,
-    0xAE, 0xA8, 0x7D, 0xB1, 0x72, 0xF0, 0xF9, 0xE3, 0x19, 0x13, 0xFC, 0x26, 0xE5, 0xBD, 0xF2, 0xD5,
-    0xAB, 0xE8, 0x18, 0x47, 0xCB, 0x45, 0x4A, 0x38, 0x3A, 0x15, 0x0F, 0xE8, 0x51, 0xDA, 0xDC, 0x2F,
-    0x68, 0x81, 0x89, 0xD7, 0xA9, 0xE9, 0xFA, 0x5A, 0x51, 0x69, 0xD4, 0x7C, 0xD5, 0xA4, 0x74, 0x7D,
-    0xA1, 0xBE, 0xC6, 0x65, 0xAD, 0xC7, 0x90, 0xE1, 0x4D, 0x0A, 0x5F, 0x1B, 0x71, 0xAC, 0xE8, 0x79,
-    0x88, 0x24, 0x32, 0xE1, 0x6F, 0x00, 0x0D, 0xA4, 0x3D, 0x4A, 0x0C, 0x6D, 0x55, 0x3F, 0xE8, 0xEC,
-    0xB1, 0x15, 0x83, 0xE5, 0xB4, 0xE8, 0xCA, 0x69, 0xDA, 0x44, 0x33, 0x05, 0x65, 0xA1, 0x69, 0x17,
-    0x39, 0x92, 0x42, 0xAD, 0x1A, 0xC8, 0xE1, 0xBE, 0x8D, 0xA5, 0x08, 0x5F, 0x17, 0x0B, 0xC1, 0x3D,
-    0xA1, 0x30, 0x4E, 0x53, 0x59, 0x28, 0x73, 0xBA, 0x8F, 0x62, 0x80, 0xF1, 0xA7, 0xBD, 0x51, 0x8E,
-    0x61, 0xD9, 0xCB, 0xC6, 0xFC, 0x95, 0x8D, 0x22, 0x43, 0xA9, 0xF3, 0xD5, 0x4B, 0x11, 0xE3, 0x7B,
-    0x67, 0xE8, 0x5D, 0xA6, 0x75, 0x06, 0x15, 0x78, 0x9E, 0x91, 0x29, 0xB3, 0x2A, 0x5B, 0x78, 0xAC,
-    0xB8, 0xAA, 0x6B, 0xB3, 0xC5, 0x3E, 0x32, 0xC4, 0x5C, 0x40, 0x47, 0xAF, 0x53, 0xB1, 0x2B, 0xF8,
-    0xD1, 0x33, 0xDD, 0x5B, 0x66, 0x36, 0x1A, 0xFA, 0xEB, 0xD0, 0x91, 0x53, 0xA8, 0x79, 0x08, 0x1E,
-    0x0A, 0xD6, 0xA0, 0xE8, 0xF1, 0xA4, 0xD2, 0x95, 0xAB, 0x0C, 0x20, 0x53, 0x54, 0xFB, 0xF4, 0xF3,
-    0x9A, 0x80, 0x0E, 0x88, 0x9F, 0xE1, 0x64, 0xC1, 0x3A, 0xA1, 0x9A, 0xF8, 0x8D, 0x46, 0x7E, 0x21,
-    0x1C, 0x45, 0xDD, 0xA0, 0x39, 0x2D, 0xD0, 0x86, 0x39, 0x95, 0xA5, 0xE9, 0x6E, 0xAC, 0x95, 0xC2,
-    0x22, 0xBE, 0xAD, 0x5A, 0x5B, 0xD3, 0x98, 0x97, 0xCF, 0x4D, 0x16, 0x90, 0xAB, 0xAF, 0x4A, 0x47,
-    0xCB, 0x92, 0x13, 0x79, 0x4F, 0xEE, 0x4E, 0x07, 0x4A, 0x77, 0x3A, 0x19, 0xC8, 0xA2, 0x95, 0x40,
-    0x0B, 0xAF, 0x13, 0x33, 0xFD, 0x13, 0x3F, 0xC4, 0xDC, 0xD9, 0x06, 0x60, 0x2D, 0x09, 0xBA, 0xAD,
-    0xC8, 0x98, 0xE0, 0x50, 0x40, 0x35, 0x74, 0xAE, 0x4E, 0xFB, 0x8D, 0xDC, 0xA6, 0x3E, 0x76, 0x05,
-    0x7F, 0xAB, 0xEE, 0x42, 0x4D, 0x14, 0x5C, 0x71, 0x08, 0x39, 0x84, 0xE3, 0x2B, 0xA0, 0xDF, 0x05,
-    0x52, 0x07, 0x19, 0x9C, 0x7A, 0x39, 0xEE, 0x1C, 0x3E, 0x2D, 0xCA, 0x03, 0x90, 0xC4, 0xAF, 0x11,
-    0xF2, 0xC1, 0xE7, 0xED, 0xE4, 0x2F, 0xD8, 0x77, 0xB9, 0x2C, 0x9F, 0x71, 0xFD, 0x5C, 0xFF, 0xEC,
-    0x4D, 0xB7, 0xE4, 0x12, 0x8F, 0x8B, 0x87, 0xD2, 0x03, 0xC4, 0x80, 0xA4, 0x8B, 0x07, 0x7F, 0x7A,
-    0xCF, 0x21, 0x97, 0xAF, 0x2F, 0xD1, 0x07, 0x6F, 0x91, 0xBA, 0x98, 0xA9, 0x61, 0x80, 0x22, 0x28,
-    0xAC, 0xF7, 0x9A, 0xD5, 0x9A, 0xD1, 0x65, 0x62, 0x69, 0x42, 0x40, 0x62, 0x68, 0xBC, 0x30, 0x27,
-    0xA2, 0x24, 0xAB, 0x17, 0xE5, 0x84, 0xD2, 0x77, 0x7D, 0xF4, 0x2D, 0x27, 0xB6, 0xAD, 0x45, 0x77,
-    0xCB, 0x92, 0x4A, 0x61, 0xA9, 0x62, 0xA4, 0x9A, 0x2D, 0x51, 0x4B, 0x33, 0x24, 0xE0, 0x17, 0xC2,
-    0xBE, 0xD8, 0x82, 0x52, 0x4B, 0x14, 0x2F, 0x25, 0xBA, 0xEA, 0x99, 0x84, 0x7B, 0x19, 0xFE, 0x12,
-    0x3D, 0x72, 0x0A, 0xEA, 0x46, 0x33, 0x98, 0x67, 0xD7, 0x28, 0x22, 0x61, 0xBC, 0x4E, 0x8F, 0x4E,
-    0xB6, 0x8A, 0x40, 0xA0, 0x95, 0x65, 0x08, 0x51, 0x1A, 0x21, 0xC7, 0x98, 0x77, 0xB1, 0x8B, 0x96,
-    0x73, 0x20, 0x35, 0xF6, 0x2C, 0x0C, 0x54, 0xFF, 0x28, 0x74, 0xDF, 0x17, 0x7D, 0x31, 0xC1, 0x93,
-    0xFD, 0x3E, 0x40, 0xF8, 0x5A, 0xE4, 0x3D, 0x96, 0xE8, 0x57, 0xBC, 0x75, 0x37, 0x10, 0x6F, 0x65,
-    0x9A, 0x34, 0x3C, 0xB0, 0x63, 0xD8, 0x50, 0xA7, 0xBB, 0x36, 0x05, 0x56, 0xB2, 0xFC, 0x95, 0xBB,
-    0x47, 0xD4, 0x4B, 0xFB, 0x07, 0xCC, 0x6A, 0x42, 0x8D, 0xB3, 0x88, 0x68, 0x61, 0x46, 0x3E, 0x92,
-    0x8D, 0xC7, 0x2C, 0x38, 0xD9, 0x82, 0xA9, 0xC3, 0x52, 0x4C, 0xC9, 0x20, 0x47, 0x35, 0xA7, 0xEE,
-    0x41, 0x96, 0x86, 0x96, 0x00, 0x0F, 0x79, 0xF5, 0x13, 0xBC, 0x3A, 0xEA, 0x58, 0x2A, 0xAA, 0x37,
-    0x68, 0x1C, 0x44, 0x34, 0x12, 0x8B, 0x77, 0x1B, 0x5F, 0x50, 0x56, 0x1A, 0x88, 0x44, 0x6B, 0x21,
-    0x1C, 0x74, 0xF2, 0x7F, 0x69, 0x25, 0x20, 0x33, 0x33, 0x31, 0x0B, 0x4D, 0x47, 0x24, 0x27, 0xCA,
-    0x78, 0x81, 0x7A, 0x1F, 0x81, 0xB6, 0xBF, 0x84, 0x1B, 0xC0, 0xB7, 0x9F, 0xC4, 0xC6, 0x55, 0xAF,
-    0x82, 0xD6, 0x50, 0x98, 0x28, 0xBF, 0xAD, 0x5B, 0x1C, 0x82, 0x5C, 0xBB, 0x10, 0xD2, 0xFE, 0x94,
-    0xD0, 0x25, 0x32, 0x10, 0x74, 0xFE, 0x3B, 0xBF, 0x61, 0x66, 0x96, 0xAB, 0x45, 0x81, 0x3D, 0x08,
-    0x1C, 0x4A, 0x76, 0x81, 0xB6, 0xD6, 0xDB, 0xBC, 0x2F, 0x9A, 0x74, 0xC8, 0xBB, 0x74, 0x4A, 0x87,
-    0x74, 0x8A, 0xA7, 0x5C, 0x42, 0xC7, 0x5A, 0x81, 0x2F, 0x44, 0x77, 0xE2, 0x12, 0x6C, 0xEE, 0x95,
-    0xBB, 0xF7, 0x75, 0x97, 0x20, 0x52, 0x98, 0x79, 0x24, 0x15, 0x05, 0x77, 0xF0, 0xE9, 0x8B, 0x53,
-    0x46, 0x54, 0x39, 0x7E, 0xBA, 0x45, 0x12, 0xDB, 0xE4, 0x62, 0x69, 0x45, 0x57, 0x4B, 0x00, 0xBA,
-    0x61, 0xCC, 0xD1, 0x15, 0x5B, 0xB9, 0x64, 0x75, 0x9F, 0x8B, 0x87, 0xAC, 0xFF, 0x52, 0xD4, 0x48,
-    0x1C, 0xC3, 0xD8, 0x34, 0x74, 0x45, 0x5F, 0x53, 0xFF, 0x5E, 0x5D, 0x32, 0xAD, 0x65, 0x73, 0x2F,
-    0x4F, 0xAA, 0x90, 0x67, 0xB3, 0x21, 0x5A, 0x7A, 0x16, 0x14, 0xAF, 0xAA, 0x88, 0xC6, 0x53, 0x75,
-    0x55, 0x4B, 0x54, 0x93, 0xA9, 0xDE, 0x32, 0xF9, 0xE7, 0xBE, 0x36, 0x85, 0xDD, 0x97, 0x92, 0x31,
-    0xED, 0xEB, 0x57, 0x6A, 0xA1, 0x61, 0xB8, 0x68, 0xD5, 0x4F, 0x93, 0xB7, 0x8C, 0x9F, 0x7B, 0x2C,
-    0x63, 0xA1, 0xB3, 0x54, 0x02, 0x83, 0x38, 0x00, 0x41, 0x4E, 0xF8, 0xFC, 0x4B, 0x0E, 0xA8, 0x46,
-    0x21, 0x52, 0x51, 0x53, 0x7F, 0x21, 0xE2, 0xB7, 0x95, 0x98, 0xAE, 0x65, 0xF8, 0x9B, 0x8C, 0x9A,
-    0xFB, 0xFB, 0x22, 0xC5, 0xA5, 0xC7, 0xC9, 0xB6, 0xC1, 0xE6, 0x41, 0x67, 0x49, 0xF9, 0xD0, 0x6D,
-    0xFF, 0x36, 0xC8, 0x86, 0x5C, 0x38, 0x15, 0x58, 0x8B, 0xC4, 0x88, 0xAC, 0xFD, 0x82, 0xE7, 0xB1,
-    0xEC, 0xAB, 0x7A, 0xC6, 0x08, 0x62, 0x6D, 0x85, 0x3A, 0x48, 0x82, 0xD4, 0xDD, 0x17, 0x51, 0x9F,
-    0x53, 0x86, 0x4C, 0x1E, 0xCB, 0xCD, 0x50, 0xD0, 0xD9, 0x87, 0xCC, 0xA3, 0x27, 0x94, 0x99, 0x02,
-    0x92, 0xC4, 0x34, 0x76, 0xA3, 0xE5, 0x6B, 0x62, 0xFF, 0xF2, 0x21, 0xA2, 0x28, 0x11, 0xA8, 0xDE,
-    0x5C, 0x9D, 0x7E, 0x23, 0x9D, 0xF2, 0xEF, 0x5F, 0x19, 0x2B, 0x78, 0xB2, 0xAD, 0xEC, 0xD7, 0x2D,
-    0x11, 0x92, 0x1B, 0x1D, 0x2A, 0x38, 0xE7, 0x40, 0x37, 0xB9, 0xFB, 0xFA, 0x6D, 0x26, 0x37, 0x80,
-    0xB4, 0x96, 0x49, 0x03, 0x5F, 0xEE, 0x51, 0xA8, 0xB2, 0x87, 0x7A, 0x5F, 0x1B, 0xAA, 0xF5, 0x4E,
-    0xE1, 0xB7, 0x8E, 0x1A, 0x27, 0x00, 0xC9, 0x43, 0xCE, 0x4A, 0x32, 0x07, 0x21, 0xDE, 0xFC, 0x0D,
-    0xD5, 0x67, 0x86, 0xEC, 0x57, 0x00, 0x21, 0x83, 0xAC, 0x93, 0x33, 0x91, 0xF3, 0xAE, 0x50, 0x9E,
-    0x2C, 0x7A, 0x00, 0x76, 0x9C, 0xC0, 0x76, 0xD1, 0x31, 0xDD, 0x5E, 0x16, 0x33, 0x31, 0x09, 0xEC,
-    0x32, 0xAF, 0x9B, 0xC6, 0x3D, 0x3F, 0xB9, 0x8B, 0xE2, 0x77, 0xBF, 0xE0, 0x44, 0x8A, 0xE4, 0x3F,
-    0xA1, 0x5B, 0x53, 0xF0, 0x7C, 0xAA, 0x16, 0x47, 0xA2, 0x45, 0xE4, 0xA7, 0x4E, 0x8A, 0x57, 0x3B,
-    0x57, 0xC8, 0x71, 0xD4, 0x00, 0x32, 0x1F, 0x76, 0xCF, 0x09, 0x55, 0xDD, 0x13, 0xCB, 0xED, 0x81,
-    0x4B, 0xA1, 0xB8, 0x24, 0x82, 0xDB, 0x2C, 0x15, 0x54, 0x14, 0x4D, 0x12, 0xAD, 0x25, 0x19, 0x1F,
-    0xFE, 0xE1, 0x24, 0xC7, 0x27, 0x12, 0x22, 0xD6, 0x69, 0xCC, 0xFB, 0x7F, 0x95, 0x8F, 0xD9, 0xF4,
-    0x28, 0xEC, 0xE2, 0x0C, 0xB3, 0x35, 0x15, 0x42, 0xFD, 0x5E, 0x02, 0x75, 0x32, 0x94, 0xAA, 0xE7,
-    0xD3, 0xC6, 0x74, 0xBE, 0x62, 0x7A, 0xA3, 0xD0, 0xC4, 0x02, 0x07, 0x47, 0xAB, 0x27, 0xB2, 0x16,
-    0xB8, 0x48, 0xD1, 0x40, 0x89, 0x16, 0x25, 0xD1, 0x6B, 0x3A, 0x79, 0x0E, 0x08, 0x49, 0x38, 0x83,
-    0x4D, 0x36, 0x13, 0x10, 0x9A, 0x68, 0x42, 0x59, 0x44, 0x32, 0x00, 0x19, 0x80, 0x9F, 0x7B, 0xFB,
-    0xDD, 0x55, 0x9B, 0xCE, 0x8F, 0x14, 0x80, 0xA9, 0x66, 0xA6, 0x17, 0xA6, 0x02, 0x48, 0x60, 0x9F,
-    0x43, 0x4B, 0x94, 0xD0, 0x78, 0x07, 0xFB, 0x18, 0xED, 0xD6, 0x72, 0x11, 0xCD, 0x46, 0x7D, 0xD0,
-    0x32, 0xA3, 0xE1, 0x5B, 0x08, 0xD6, 0x44, 0x57, 0xA7, 0xE4, 0x5D, 0x59, 0x5F, 0xF6, 0xB3, 0xBE,
-    0x38, 0x87, 0x94, 0x61, 0xF1, 0xFC, 0x08, 0x6B, 0x3F, 0xBA, 0xFB, 0x2F, 0x01, 0x3E, 0xFF, 0xE1,
-    0xFC, 0x2C, 0xF4, 0x76, 0x91, 0x5C, 0xED, 0x6B, 0x39, 0xE7, 0x29, 0x77, 0x7F, 0x8E, 0xC5, 0xF4,
-    0xD5, 0x44, 0xB8, 0xE8, 0x31, 0xD1, 0x2F, 0xB2, 0xFE, 0x19, 0x00, 0x05, 0x7E, 0x9D, 0x89, 0xCC,
-    0x7F, 0xE9, 0x0B, 0x85, 0xE8, 0xD8, 0xEC, 0x1F, 0x7B, 0x68, 0x06, 0xD9, 0xFD, 0x0B, 0xC2, 0x43,
-    0xA2, 0xB3, 0x44, 0xDE, 0x83, 0x54, 0x7C, 0xE5, 0x56, 0x36, 0x7F, 0x5A, 0xF4, 0xAE, 0x92, 0x68,
-    0xCD, 0x19, 0x88, 0xF9, 0xCC, 0x86, 0x0A, 0x15, 0x1E, 0xDF, 0x84, 0xC9, 0x1B, 0x1E, 0x86, 0xBE,
-    0xC6, 0xB9, 0xA3, 0xF4, 0x10, 0xFA, 0x1E, 0x4C, 0xD2, 0x22, 0xA1, 0xAB, 0xD9, 0x4C, 0xC6, 0xE7,
-    0xA3, 0xD6, 0x6C, 0x24, 0xCB, 0x21, 0xDE, 0xD5, 0xDA, 0x07, 0x00, 0xE2, 0x27, 0xCB, 0xED, 0xE2,
-    0xBA, 0xBA, 0x9F, 0xBF, 0x0A, 0xFA, 0x2C, 0x30, 0x83, 0x80, 0x4E, 0x84, 0x48, 0xC2, 0x12, 0x8A,
-    0xA6, 0x1D, 0x98, 0x22, 0x8B, 0xD5, 0x70, 0x8C, 0x70, 0x55, 0x44, 0x46, 0xAE, 0x88, 0xC1, 0x9B,
-    0x99, 0xCE, 0x8C, 0xDC, 0x7D, 0x88, 0xA6, 0x84, 0x3F, 0x8B, 0x11, 0xA2, 0xF3, 0x32, 0xA8, 0x78,
-    0x0E, 0xCC, 0x89, 0xEA, 0x8A, 0xB7, 0xA1, 0x36, 0x9F, 0x5C, 0xC0, 0x14, 0xA2, 0xEC, 0xBB, 0xBA,
-    0x87, 0x6F, 0xFD, 0x8E, 0x56, 0x39, 0x83, 0xDA, 0x9D, 0xD9, 0xA1, 0x3B, 0x6D, 0x7F, 0x65, 0x70,
-    0x4E, 0x88, 0x20, 0x46, 0xE6, 0x39, 0x37, 0x27, 0x90, 0xB1, 0xFE, 0x61, 0xF7, 0x33, 0xC2, 0x0D,
-    0x03, 0xD6, 0x3E, 0xC7, 0x70, 0xD6, 0xCA, 0xBA, 0x85, 0x41, 0x9E, 0x98, 0xCB, 0x82, 0x9F, 0x21,
-    0x9B, 0xA6, 0x1D, 0xD7, 0xF2, 0x8F, 0xA3, 0x3B, 0x9C, 0xB9, 0xC3, 0x97, 0x5F, 0x42, 0xD5, 0xC9,
-    0x0C, 0x9F, 0xFC, 0x7A, 0x3B, 0xE4, 0x1E, 0x85, 0x2B, 0x84, 0x3B, 0x6B, 0x51, 0xD3, 0xF2, 0x01,
-    0xF7, 0xA4, 0x9C, 0xCB, 0x05, 0x91, 0x01, 0x64, 0x6D, 0x17, 0x02, 0x0F, 0x63, 0x82, 0xA0, 0xAA,
-    0xA7, 0xA9, 0x6D, 0xF8, 0x8A, 0x7A, 0xCE, 0x98, 0xF7, 0x8A, 0xB1, 0x45, 0x28, 0x95, 0x9C, 0x62,
-    0x29, 0xAB, 0x48, 0xB1, 0x26, 0x3D, 0x0E, 0x2A, 0x11, 0x71, 0x8A, 0xC5, 0x7C, 0xFA, 0x5A, 0x80,
-    0x8A, 0xCE, 0x65, 0xFD, 0x26, 0x2C, 0x93, 0x6B, 0x0F, 0x7C, 0xE4, 0xE2, 0x3D, 0xF8, 0xAD, 0xC2,
-    0x4C, 0xA4, 0xFB, 0x6B, 0xEA, 0x21, 0x69, 0x0A, 0x01, 0xA6, 0xEE, 0xC2, 0x77, 0xFD, 0x8A, 0x43,
-    0xF1, 0xF9, 0x12, 0x6D, 0xA6, 0x80, 0x1F, 0x2B, 0x37, 0xF9, 0x9E, 0xAC, 0xEB, 0x34, 0x42, 0x4A,
-    0x28, 0x4A, 0xC8, 0x0F, 0x5C, 0x2A, 0x64, 0x71, 0x98, 0xC9, 0xD1, 0xFF, 0x9F, 0x92, 0x5B, 0x0F,
-    0xF5, 0x78, 0x66, 0xAC, 0x14, 0x16, 0x6F, 0x33, 0xA2, 0xB8, 0xC3, 0xEE, 0x14, 0xC4, 0xAE, 0x9C,
-    0x44, 0xD6, 0x7D, 0x03, 0x3B, 0xFB, 0x9C, 0x1B, 0x53, 0x68, 0x82, 0x17, 0xA8, 0xF2, 0x1E, 0x76,
-    0xDF, 0x11, 0x1B, 0x01, 0x8B, 0x56, 0xDF, 0xEF, 0x06, 0xF8, 0x53, 0xA2, 0x5C, 0xDB, 0x5A, 0xBC,
-    0x4D, 0xF8, 0xBF, 0x90, 0x1E, 0x78, 0xC4, 0x0C, 0xFE, 0x72, 0x24, 0x92, 0xE0, 0xAB, 0xC8, 0x89,
-    0x22, 0x4C, 0x86, 0xFC, 0x07, 0x09, 0x5C, 0x2E, 0x3A, 0x58, 0xA2, 0xBB, 0x94, 0x6A, 0x54, 0xBF,
-    0x0A, 0x36, 0x4E, 0xA7, 0xF3, 0x91, 0xFA, 0xF9, 0x1B, 0xC4, 0x19, 0x33, 0x28, 0x0D, 0xA8, 0x36,
-    0x37, 0xF2, 0xC3, 0xA2, 0xB4, 0x2A, 0x71, 0x4A, 0xD6, 0xBA, 0xD0, 0x3D, 0x09, 0x3E, 0xB9, 0x60,
-    0xCB, 0x91, 0xBA, 0xA6, 0x50, 0x5F, 0x73, 0x70, 0xF2, 0xA2, 0x16, 0x34, 0x8B, 0xC3, 0x01, 0xC7,
-    0x74, 0x21, 0x89, 0xAB, 0x3E, 0xA5, 0xF7, 0xCD, 0x60, 0xBB, 0xE8, 0x21, 0xB5, 0x1B, 0xB7, 0x61,
-    0x4D, 0x79, 0x5F, 0xB0, 0xC6, 0x80, 0xD8, 0x55, 0xDA, 0x33, 0x28, 0x71, 0x0F, 0x31, 0x3F, 0xF8,
-    0xAE, 0x66, 0x15, 0xAD, 0x42, 0xB4, 0xDB, 0x61, 0xB7, 0xA9, 0xE1, 0xB9, 0xDD, 0x0E, 0xFC, 0xB2,
-    0xFA, 0x06, 0xB4, 0x20, 0xFD, 0xA6, 0xB8, 0xB4, 0x48, 0x17, 0x5E, 0x9C, 0xD6, 0x23, 0x8C, 0xBC,
-    0xC7, 0xAB, 0x88, 0xF4, 0x1A, 0x48, 0xA9, 0xD7, 0xB8, 0xB1, 0xCA, 0x72, 0xBE, 0x87, 0xC9, 0x66,
-    0xF1, 0x86, 0xAB, 0x2D, 0x6B, 0x58, 0xBA, 0xB5, 0xA8, 0xCD, 0xC0, 0x35, 0xC3, 0x28, 0xC9, 0xC3,
-    0x7F, 0xE2, 0xFE, 0x9F, 0x86, 0xEA, 0xCA, 0x5A, 0x4C, 0xD3, 0xD4, 0x57, 0x11, 0x73, 0x3F, 0xBE,
-    0x88, 0x50, 0x88, 0x36, 0x69, 0x8B, 0x51, 0x1C, 0x5B, 0x39, 0x11, 0xE1, 0xFE, 0x4A, 0x08, 0x5D,
-    0x75, 0xC8, 0x82, 0xBE, 0x28, 0xA7, 0xD0, 0xC0, 0x83, 0x4B, 0x46, 0x3A, 0x73, 0x72, 0xE8, 0xE2,
-    0xFB, 0xA4, 0xC2, 0xAE, 0x20, 0x97, 0x30, 0x4D, 0x25, 0x14, 0x42, 0x3C, 0xF3, 0x9C, 0xF8, 0x7C,
-    0xA2, 0x22, 0x70, 0x4D, 0xBB, 0x01, 0xEE, 0x36, 0x30, 0x42, 0x78, 0x2A, 0x38, 0xBE, 0x34, 0x12,
-    0xAA, 0x64, 0xF5, 0xCD, 0xEF, 0x11, 0xC0, 0x88, 0x16, 0xB6, 0x64, 0x55, 0x4E, 0xC1, 0x70, 0xBE,
-    0x2B, 0x99, 0xF7, 0x6D, 0x1E, 0xC4, 0x51, 0x18, 0x51, 0x3C, 0x98, 0x86, 0x85, 0xD0, 0x42, 0x28,
-    0xB0, 0xA4, 0xE8, 0x8D, 0x1F, 0x88, 0x66, 0xBE, 0xA2, 0x14, 0x6C, 0xD6, 0x4E, 0x2F, 0xBB, 0x10,
-    0x73, 0xD1, 0xCB, 0x5A, 0x40, 0x1C, 0x59, 0xBD, 0x3C, 0x0E, 0x75, 0x92, 0x95, 0xDE, 0x5D, 0xBD,
-    0x42, 0x98, 0x35, 0x72, 0xF5, 0x13, 0x80, 0xA7, 0xE7, 0x0C, 0xBC, 0xD4, 0x6B, 0x3D, 0xEE, 0xE9,
-    0x3D, 0x7E, 0xFF, 0x67, 0xB9, 0x0A, 0xEE, 0x1A, 0x57, 0xA1, 0xA4, 0xAB, 0x70, 0x37, 0x5C, 0x85,
-    0x77, 0xA6, 0x9D, 0xAB, 0xE0, 0xE0, 0x2A, 0x2C, 0x40, 0xD9, 0x93, 0x9F, 0x77, 0xC2, 0xBB, 0xB7,
-    0x29, 0x1A, 0xEA, 0xAC, 0xF8, 0x5E, 0x2B, 0xA2, 0x58, 0x60, 0xB5, 0x62, 0x90, 0xDA, 0xC9, 0x76,
-    0xD6, 0xE7, 0x7D, 0xC4, 0x2D, 0x7D, 0x41, 0xF6, 0x58, 0xFF, 0x3D, 0x84, 0x5E, 0x94, 0x3F, 0xD4,
-    0x7C, 0xD5, 0xC8, 0x7A, 0x72, 0x2D, 0xE2, 0x81, 0xEE, 0xE3, 0xE2, 0x24, 0x16, 0x82, 0x16, 0xAA,
-    0x34, 0xD5, 0x57, 0x6E, 0x88, 0x38, 0xE5, 0x5A, 0x9E, 0x48, 0x3E, 0x15, 0xCD, 0x0F, 0x7E, 0x7B,
-    0x72, 0x6B, 0x1D, 0x2B, 0x85, 0x86, 0xA7, 0xBD, 0xCF, 0x4F, 0xED, 0xB2, 0xD4, 0xA2, 0x0A, 0x9A,
-    0x50, 0x82, 0x8F, 0x2E, 0x67, 0x23, 0x54, 0x2D, 0xDE, 0x5D, 0x87, 0x00, 0xA3, 0xF9, 0xA2, 0xB8,
-    0xA7, 0x2C, 0x7C, 0x16, 0x43, 0x3B, 0xC1, 0x1C, 0x83, 0x95, 0xF0, 0x5D, 0x68, 0x32, 0xC0, 0x30,
-    0x8B, 0x00, 0x43, 0x6A, 0x43, 0x04, 0x58, 0x31, 0x74, 0xA7, 0xB8, 0x26, 0x09, 0x9C, 0x7B, 0xB9,
-    0x08, 0xFA, 0x46, 0x70, 0x11, 0x20, 0xB8, 0xF3, 0x86, 0x01, 0xBC, 0x78, 0xC2, 0x6E, 0x0B, 0x47,
-    0x5A, 0x6C, 0xE0, 0x3D, 0x57, 0xC7, 0x2F, 0xA4, 0xA2, 0xA0, 0x92, 0x9F, 0xCF, 0x13, 0x9C, 0x52,
-    0xF7, 0x22, 0xF4, 0xCC, 0x00, 0xA6, 0x90, 0x73, 0x6C, 0xE1, 0xB4, 0x43, 0x7B, 0x54, 0xD8, 0xAE,
-    0x50, 0xF2, 0xC4, 0x11, 0x55, 0xF0, 0xFE, 0xD6, 0xBB, 0xB5, 0xF5, 0x06, 0xBF, 0xDC, 0x7A, 0xA7,
-    0xE3, 0xEB, 0xFD, 0x33, 0xAE, 0xF7, 0x8D, 0xD1, 0xAF, 0x77, 0xE4, 0x7A, 0x13, 0xBF, 0xDE, 0xA5,
-    0xD7, 0xF5, 0xBE, 0xDD, 0xEB, 0x7A, 0xEF, 0x33, 0xC0, 0x27, 0x1E, 0x8E, 0x7E, 0x4F, 0xEC, 0x7B,
-    0x6A, 0x7F, 0xAF, 0xAD, 0x6E, 0xCF, 0x83, 0x83, 0x16, 0xD7, 0x8A, 0xEF, 0xBC, 0xE0, 0x54, 0x91,
-    0x5F, 0x77, 0x5D, 0x7D, 0xE1, 0x7F, 0xCF, 0x11, 0x42, 0xB5, 0x14, 0x95, 0x4B, 0x79, 0x27, 0x2E,
-    0xFA, 0xE7, 0x92, 0xCB, 0xFF, 0x59, 0x4D, 0x06, 0x6D, 0x6D, 0x7E, 0xF9, 0x9C, 0xEC, 0xBD, 0xCC,
-    0x46, 0x74, 0x32, 0x75, 0x39, 0x38, 0xA4, 0x6E, 0x22, 0xF8, 0x4F, 0xB9, 0xC4, 0x30, 0x27, 0x2D,
-    0x86, 0x61, 0x61, 0xCB, 0x7E, 0x0C, 0x13, 0xF8, 0xC4, 0x99, 0x8A, 0x07, 0xEC, 0x88, 0x16, 0xC3,
-    0x0C, 0x5F, 0x84, 0x45, 0x49, 0xE1, 0x8E, 0x50, 0xE7, 0x25, 0x4C, 0x26, 0x6C, 0x23, 0x7D, 0x4F,
-    0xE8, 0xFE, 0xFB, 0xD3, 0x70, 0x59, 0x45, 0x47, 0x34, 0xEA, 0x89, 0xC0, 0x47, 0x4B, 0x25, 0xE6,
-    0xFB, 0xAA, 0xF8, 0xC9, 0x42, 0x87, 0x0E, 0x16, 0x43, 0x18, 0x56, 0x18, 0x52, 0x96, 0x81, 0x2E,
-    0x22, 0x2C, 0xE9, 0xBE, 0xE5, 0x76, 0xB9, 0x4E, 0xFD, 0x9C, 0x7B, 0xF2, 0x31, 0xD1, 0x38, 0x12,
-    0x4B, 0xC0, 0xB7, 0x97, 0x73, 0x44, 0x05, 0x66, 0x8B, 0x42, 0x88, 0xC2, 0xB0, 0xBA, 0xB3, 0x3B,
-    0x06, 0x4D, 0xB4, 0x67, 0x21, 0xD0, 0x42, 0x27, 0xAE, 0x8A, 0xB4, 0x62, 0x7B, 0x5D, 0x41, 0x7E,
-    0x96, 0xB5, 0x24, 0x06, 0x5D, 0x09, 0x0D, 0xFE, 0xA1, 0x1E, 0x29, 0xC0, 0xB2, 0xF0, 0xBA, 0xA9,
-    0xC5, 0x60, 0x6D, 0x50, 0xA2, 0x29, 0x6F, 0xAF, 0xDA, 0x7C, 0x4E, 0x9C, 0xA6, 0x5C, 0x2B, 0xED,
-    0xF6, 0xD8, 0xFA, 0x12, 0xA3, 0x30, 0xD0, 0x00, 0x79, 0xA3, 0xF9, 0x1A, 0xF8, 0xE6, 0xFF, 0x43,
-    0x96, 0xD4, 0x89, 0x91, 0xFA, 0x1D, 0x6C, 0xFF, 0x94, 0xE2, 0xB8, 0x72, 0xBF, 0x3B, 0x2E, 0xD0,
-    0x00, 0x39, 0xCD, 0xC4, 0x9D, 0xFC, 0xEE, 0xBA, 0x20, 0xF1, 0xC5, 0xE5, 0x0F, 0x5D, 0x0E, 0x1A,
-    0xB9, 0xB6, 0x1A, 0x22, 0x4B, 0x9E, 0x0E, 0xD6, 0x26, 0xB8, 0xC6, 0x2D, 0xA7, 0x45, 0xD0, 0x01,
-    0xB6, 0x0C, 0xB1, 0x56, 0x2C, 0xDD, 0x43, 0x9C, 0x03, 0x9E, 0x10, 0x32, 0xAE, 0x58, 0xBA, 0x84,
-    0x04, 0xA0, 0x2B, 0x6D, 0x6A, 0xBC, 0xD0, 0xDB, 0xD9, 0x80, 0xB2, 0xB8, 0xF2, 0x2F, 0xA8, 0x94,
-    0xB8, 0x89, 0xA2, 0x67, 0x8E, 0x38, 0x95, 0x60, 0xEC, 0xA2, 0x44, 0x47, 0x73, 0xE4, 0xDF, 0xD3,
-    0xC0, 0x35, 0xDA, 0x56, 0x3D, 0x8D, 0x2E, 0xF0, 0x8E, 0x52, 0x94, 0xFE, 0x1C, 0x68, 0x79, 0x21,
-    0xB6, 0xD7, 0xD1, 0x82, 0xC3, 0x81, 0x6B, 0x19, 0xA9, 0xED, 0x29, 0x21, 0xD0, 0x23, 0xAC, 0x2D,
-    0xE3, 0x4B, 0x0C, 0x0B, 0xE5, 0x2F, 0xF7, 0x42, 0x6C, 0xB6, 0x54, 0x93, 0x91, 0x86, 0x4E, 0x2D,
-    0xD6, 0xC9, 0x82, 0x4E, 0xB8, 0xD6, 0xCB, 0xC5, 0xC1, 0x9A, 0x29, 0x22, 0x7A, 0x3E, 0xC5, 0x4B,
-    0x38, 0xB1, 0x41, 0x7C, 0xFB, 0xCD, 0x12, 0xCD, 0xBF, 0xF1, 0x07, 0x75, 0x53, 0xBD, 0xFC, 0x86,
-    0x1B, 0x12, 0x88, 0x8E, 0x70, 0xCD, 0x93, 0x30, 0x04, 0x9D, 0x78, 0x63, 0x15, 0xF4, 0x24, 0x65,
-    0x1B, 0x8B, 0x18, 0xCD, 0xB6, 0x14, 0x56, 0x18, 0x42, 0xF3, 0xCE, 0x83, 0x86, 0xCA, 0x8C, 0xF6,
-    0xCB, 0x21, 0x6F, 0xD3, 0x72, 0xC1, 0x8D, 0x66, 0xFD, 0x7B, 0xB0, 0x58, 0x24, 0x0E, 0xAB, 0x18,
-    0xD2, 0xBA, 0x11, 0xB2, 0xB5, 0xB5, 0x2C, 0xB6, 0x40, 0xE1, 0x61, 0x2F, 0x3E, 0xE9, 0xC2, 0x92,
-    0xE9, 0x2D, 0xDB, 0x4E, 0xE4, 0xDA, 0x9F, 0x91, 0xB3, 0x4C, 0x9F, 0x77, 0x12, 0xA6, 0xA3, 0xD7,
-    0x35, 0x55, 0x30, 0x03, 0xC9, 0xBD, 0xD6, 0xC4, 0x6F, 0xD3, 0x49, 0x34, 0x87, 0x70, 0x3E, 0x1F,
-    0xE1, 0x77, 0x4A, 0xE0, 0x27, 0x61, 0xCA, 0xF1, 0xB6, 0x8B, 0x90, 0xA1, 0xCD, 0x96, 0x0E, 0x1A,
-    0x37, 0x8D, 0x0F, 0x14, 0x6D, 0xD6, 0x27, 0xE2, 0x0F, 0xA1, 0x44, 0xA9, 0x05, 0x00, 0x10, 0x21,
-    0x75, 0x5A, 0x3D, 0x0F, 0x87, 0x92, 0x25, 0x7E, 0x9D, 0xDE, 0x46, 0x28, 0xFB, 0xBB, 0x58, 0x45,
-    0x03, 0x08, 0x80, 0x85, 0xA3, 0x70, 0xD4, 0x42, 0x85, 0xC6, 0x07, 0xEF, 0x2F, 0x1C, 0x98, 0x3D,
-    0xB4, 0x30, 0x0C, 0xD1, 0xEF, 0x43, 0xB3, 0xE5, 0x14, 0x4E, 0x5E, 0xD4, 0xE2, 0x37, 0xD7, 0xDD,
-    0x51, 0x2F, 0x17, 0xB6, 0xA4, 0x99, 0xBE, 0x54, 0xDD, 0x5D, 0xE7, 0xC5, 0x6A, 0xA0, 0xD2, 0xE6,
-    0x05, 0x04, 0x1F, 0xDF, 0x81, 0x54, 0x54, 0x17, 0x97, 0x10, 0x2E, 0x37, 0xD9, 0x2E, 0x82, 0xC4,
-    0x45, 0x00, 0xC0, 0x62, 0x00, 0x6A, 0xC0, 0xF4, 0x96, 0x94, 0x2F, 0xC8, 0x91, 0x60, 0x5D, 0x13,
-    0xA3, 0x4D, 0x71, 0x76, 0xB3, 0x11, 0xD6, 0x74, 0xE0, 0xC9, 0xEB, 0x79, 0x99, 0xD1, 0x02, 0xD7,
-    0x40, 0x1B, 0x9C, 0x17, 0xEA, 0x6C, 0xC6, 0x6C, 0x54, 0x1A, 0x10, 0x02, 0x8B, 0x34, 0xB1, 0xD0,
-    0xED, 0x68, 0xD5, 0x5B, 0x6A, 0x90, 0x4D, 0x2C, 0xAA, 0x5F, 0x0C, 0x14, 0xC3, 0x71, 0xA7, 0x50,
-    0x81, 0xFF, 0x2D, 0x38, 0x7A, 0xBA, 0x42, 0x2B, 0xFC, 0x9F, 0x52, 0xDD, 0x03, 0x4D, 0x2A, 0x9F,
-    0x85, 0x05, 0x2E, 0xE9, 0x36, 0x23, 0x7E, 0xCC, 0x67, 0x45, 0x19, 0x32, 0x56, 0x8D, 0x74, 0xC4,
-    0x93, 0x42, 0x9A, 0x3A, 0x09, 0xAA, 0x64, 0x65, 0x71, 0x0B, 0x40, 0x29, 0x72, 0x3F, 0xA1, 0xB4,
-    0x0C, 0xA1, 0x02, 0xA3, 0xF3, 0x5A, 0x87, 0x49, 0x7F, 0x05, 0xF9, 0x13, 0x80, 0x0B, 0x12, 0xB5,
-    0x5C, 0x15, 0x65, 0xDF, 0x26, 0x28, 0xA0, 0x3A, 0xA8, 0x5A, 0x25, 0x65, 0xBA, 0x5C, 0x44, 0x5A,
-    0x63, 0xA0, 0xA8, 0xBB, 0x1F, 0x1F, 0xEA, 0x2F, 0x85, 0xF8, 0xF7, 0x8A, 0xEF, 0x30, 0xD4, 0xC3,
-    0x66, 0xC9, 0xAC, 0x95, 0x19, 0xC7, 0x27, 0xCC, 0x78, 0x79, 0x2D, 0x59, 0x2C, 0x95, 0x39, 0x90,
-    0xDA, 0xAF, 0xD1, 0x5A, 0xFC, 0x3A, 0x18, 0x32, 0x82, 0xB2, 0x3C, 0x45, 0xC0, 0x13, 0xCA, 0x4C,
-    0x23, 0xD0, 0xD9, 0xEA, 0x1D, 0x1D, 0xD1, 0xD5, 0xED, 0x9F, 0x8A, 0x02, 0xAC, 0x41, 0xF6, 0x3E,
-    0x91, 0x20, 0xFE, 0xAF, 0x78, 0xF5, 0x40, 0xAF, 0xEE, 0xB1, 0xB6, 0xCD, 0x08, 0xF7, 0x5A, 0xF6,
-    0x5F, 0xB0, 0x54, 0x65, 0x97, 0x4C, 0x82, 0x69, 0x2C, 0x50, 0x12, 0xD3, 0x3C, 0x0C, 0x2D, 0xB1,
-    0x0D, 0x81, 0x13, 0xE0, 0x94, 0x44, 0x21, 0x26, 0x40, 0x0B, 0xA8, 0xD0, 0xE1, 0xC9, 0xC8, 0x4E,
-    0x4E, 0x15, 0x6F, 0x09, 0xFF, 0xCB, 0x7F, 0xA2, 0x84, 0xB7, 0x72, 0xD2, 0xC2, 0x72, 0xE1, 0xB8,
-    0x11, 0xB5, 0x59, 0x74, 0xEE, 0x87, 0xC2, 0xCB, 0xC9, 0x1C, 0xF7, 0x59, 0x7B, 0x8C, 0xE9, 0xCF,
-    0x68, 0xED, 0xAD, 0x38, 0x59, 0x01, 0x6E, 0x01, 0xEB, 0x0C, 0x77, 0xA3, 0x6E, 0xC8, 0x0B, 0xFC,
-    0x67, 0xCB, 0x7F, 0x82, 0x4A, 0x55, 0xC7, 0x20, 0x27, 0x9D, 0x6E, 0x0B, 0xE4, 0x5E, 0x42, 0x65,
-    0x96, 0xEF, 0xE2, 0xAC, 0x50, 0xDC, 0xE0, 0x15, 0x7C, 0x55, 0x7A, 0x6F, 0xC8, 0xAA, 0xF2, 0xA6,
-    0xD5, 0xF5, 0x63, 0x27, 0xD7, 0xF1, 0xEE, 0xF7, 0x44, 0x9B, 0x46, 0x99, 0x0D, 0xC2, 0x07, 0xEE,
-    0xB8, 0x38, 0xAE, 0xD1, 0x54, 0x31, 0xAC, 0x1E, 0x3A, 0x45, 0x41, 0xAB, 0x18, 0xB5, 0xCC, 0x78,
-    0x5E, 0xBB, 0xBA, 0x33, 0x05, 0xC9, 0xB6, 0xBE, 0x09, 0x64, 0xFF, 0x03, 0xCB, 0x6A, 0x93, 0xAD,
-    0xF2, 0xB1, 0xD9, 0x7F, 0xD7, 0xEF, 0xE0, 0x5A, 0xD1, 0x5C, 0x4D, 0x16, 0xAC, 0xC5, 0xDA, 0xA6,
-    0x4B, 0x6F, 0xB5, 0x7A, 0x2D, 0xD8, 0xB7, 0xE0, 0xA1, 0xE5, 0x00, 0x35, 0x41, 0x01, 0xA5, 0x4B,
-    0x2F, 0x60, 0x51, 0xB1, 0x70, 0x8A, 0x08, 0x67, 0x2D, 0xCB, 0x41, 0xA2, 0x29, 0x51, 0x34, 0xAE,
-    0x74, 0xFF, 0xEE, 0x69, 0x02, 0x08, 0x54, 0xA2, 0x4E, 0xDD, 0x3A, 0xD1, 0x3D, 0x57, 0xCE, 0x2D,
-    0x80, 0x41, 0x16, 0x6D, 0x52, 0xAE, 0x10, 0x00, 0x27, 0x03, 0xEA, 0x13, 0x3A, 0x78, 0xF1, 0x62,
-    0x60, 0xEF, 0xAE, 0x5A, 0x39, 0xE0, 0xFA, 0x12, 0x32, 0x31, 0x43, 0x3E, 0xB2, 0x2E, 0x1A, 0x01,
-    0x23, 0x4B, 0x0E, 0xB7, 0x44, 0x60, 0x65, 0xBF, 0xA7, 0xF7, 0x22, 0x71, 0x32, 0x0B, 0x6B, 0x5E,
-    0x68, 0x1B, 0x90, 0xA9, 0xC5, 0x8E, 0x1F, 0xA6, 0x41, 0x0F, 0x14, 0x2F, 0xC7, 0x37, 0x43, 0xE4,
-    0x8A, 0x5E, 0x0B, 0x23, 0xDE, 0xFA, 0xAE, 0xD5, 0xDD, 0x59, 0xD6, 0x13, 0xFD, 0xF3, 0xEE, 0x72,
-    0x3D, 0x25, 0xCB, 0x21, 0x3E, 0x09, 0x2B, 0xB3, 0x8D, 0x27, 0x44, 0x7D, 0xF2, 0x0D, 0xF6, 0x67,
-    0x9B, 0x40, 0x8D, 0x88, 0xEB, 0x35, 0x20, 0x38, 0x6F, 0x6B, 0xA0, 0x3E, 0x70, 0x1B, 0x0A, 0xA6,
-    0xC6, 0x60, 0x47, 0x12, 0xF7, 0xDA, 0x8E, 0x6E, 0x07, 0x3C, 0xE1, 0xD6, 0x74, 0x9E, 0xD6, 0xC4,
-    0x84, 0x0F, 0x2D, 0x3E, 0x07, 0x46, 0xAD, 0xA7, 0xB9, 0x23, 0x55, 0x7B, 0x47, 0xCF, 0xEE, 0x61,
-    0x04, 0x1A, 0xB5, 0xB8, 0x70, 0x13, 0x22, 0x30, 0x31, 0x33, 0xC2, 0x6E, 0xEF, 0x2E, 0x48, 0xFB,
-    0x2D, 0xC0, 0xCA, 0xC5, 0x27, 0x92, 0x65, 0xF7, 0x1E, 0x59, 0x88, 0x89, 0x2C, 0xD4, 0xA2, 0xE1,
-    0x91, 0xB8, 0x21, 0xB2, 0xA0, 0x11, 0x6B, 0xDD, 0x3E, 0x86, 0x5A, 0x98, 0x47, 0xB1, 0x70, 0xF7,
-    0xAA, 0x62, 0x4B, 0xB8, 0x2B, 0xDB, 0xA2, 0xCB, 0xA3, 0xDE, 0xF3, 0xA6, 0xF5, 0xCE, 0x5D, 0x3A,
-    0x7A, 0x56, 0xA1, 0x96, 0x64, 0xC9, 0xF7, 0xA2, 0xE2, 0x2A, 0x5F, 0xC7, 0x25, 0xE9, 0xA3, 0x04,
-    0xE2, 0x98, 0x22, 0x09, 0xBE, 0x17, 0x68, 0x13, 0xC7, 0xDA, 0xFB, 0x64, 0xC9, 0xC6, 0xCE, 0xE2,
-    0xB3, 0x35, 0xCA, 0xBB, 0xFB, 0x3A, 0x25, 0xD7, 0x1B, 0xFA, 0xD5, 0x35, 0x88, 0x86, 0xB5, 0xE4,
-    0xE3, 0x1D, 0x1A, 0x7D, 0x7B, 0x74, 0x52, 0x75, 0x4B, 0x85, 0x04, 0xC5, 0x66, 0x2F, 0xB0, 0xAA,
-    0xE8, 0x31, 0xC0, 0xF4, 0x6E, 0x33, 0xEA, 0x20, 0x38, 0x79, 0x7D, 0x42, 0x1F, 0xE6, 0x59, 0x17,
-    0x49, 0x1C, 0xFA, 0xF6, 0xF2, 0xAC, 0x70, 0x7B, 0xE6, 0x86, 0x02, 0xFF, 0x6D, 0x81, 0x74, 0xA0,
-    0xA8, 0x1A, 0x2E, 0xD5, 0xE9, 0x20, 0x38, 0x5A, 0xFF, 0x7D, 0x9E, 0x85, 0x24, 0x9F, 0x85, 0xE0,
-    0x34, 0x51, 0x47, 0x0B, 0xF2, 0x0C, 0x56, 0x7D, 0x19, 0x90, 0x75, 0xA8, 0x39, 0xD6, 0x58, 0xE5,
-    0xED, 0xC4, 0xB7, 0x8E, 0xEF, 0xE0, 0x13, 0x8E, 0x20, 0x7C, 0xE0, 0x41, 0xEC, 0x4D, 0xF0, 0xEE,
-    0x7F, 0x01, 0x3F, 0xF1, 0x89, 0x17, 0x80, 0x77, 0x17, 0xB0, 0x93, 0xA1, 0x06, 0xF4, 0xFD, 0xCA,
-    0x22, 0x9B, 0x79, 0x4D, 0x53, 0xEF, 0x15, 0x30, 0x04, 0x9B, 0x0B, 0x18, 0xD9, 0x90, 0xD8, 0x00,
-    0x11, 0x6D, 0xA8, 0x98, 0x7D, 0xC7, 0xD3, 0x5D, 0x17, 0xDC, 0x72, 0xE1, 0x29, 0xAD, 0x47, 0xD3,
-    0xD7, 0xEA, 0x17, 0xEE, 0x17, 0x17, 0xBB, 0x4A, 0x9C, 0xD3, 0xAC, 0xAD, 0x65, 0x9D, 0x59, 0xF3,
-    0x28, 0x52, 0xAF, 0xDB, 0x7F, 0x2D, 0x0C, 0x73, 0x97, 0xB7, 0x01, 0x91, 0xC1, 0x64, 0x50, 0x12,
-    0x89, 0x56, 0x29, 0x30, 0xC5, 0x97, 0x2E, 0x27, 0x9D, 0xE6, 0xB1, 0x99, 0x98, 0xCC, 0xE6, 0x5D,
-    0x72, 0x1B, 0xAF, 0x03, 0x73, 0x26, 0x6C, 0xFE, 0x92, 0x65, 0x22, 0x4D, 0xF9, 0xCE, 0x83, 0xEC,
-    0xB3, 0xB0, 0x24, 0x30, 0xCD, 0xF2, 0x7E, 0xEB, 0x35, 0x58, 0xED, 0xA4, 0xAA, 0x4A, 0x60, 0x62,
-    0x2C, 0xD8, 0x7E, 0x01, 0x26, 0x17, 0x00, 0xA5, 0x76, 0xC7, 0xDD, 0xCF, 0x12, 0xFF, 0x59, 0x43,
-    0xA1, 0x21, 0xD5, 0x42, 0xD4, 0x74, 0x7C, 0xB8, 0xD4, 0x96, 0x01, 0xF0, 0x79, 0xCE, 0x7C, 0x53,
-    0x20, 0x0A, 0x9B, 0xA1, 0x86, 0x04, 0xA6, 0xB2, 0x18, 0x44, 0xB1, 0x10, 0x8E, 0x36, 0x42, 0xCD,
-    0x1D, 0xBE, 0xE5, 0x00, 0xE5, 0x93, 0x89, 0xC5, 0x04, 0x15, 0xF0, 0x0A, 0x78, 0x7F, 0x05, 0xF3,
-    0xC4, 0x65, 0xD5, 0xAA, 0x0B, 0x78, 0x44, 0x57, 0xDF, 0xAC, 0xCA, 0x78, 0x00, 0xCB, 0x33, 0x41,
-    0x05, 0xBC, 0x5F, 0x9C, 0x82, 0x98, 0x21, 0x53, 0xA7, 0xF5, 0x9A, 0xCC, 0xC4, 0xBB, 0xB7, 0xB5,
-    0x38, 0x4C, 0x6B, 0x28, 0xDE, 0xD5, 0x12, 0x15, 0x76, 0x86, 0xB9, 0x37, 0xB5, 0xF7, 0xDD, 0xBD,
-    0x73, 0x78, 0xF8, 0x80, 0xEC, 0x94, 0x06, 0x18, 0xB7, 0x8F, 0xDD, 0x37, 0x09, 0x5E, 0xF6, 0x88,
-    0x0E, 0xB3, 0x45, 0x2B, 0x97, 0x79, 0x03, 0xF8, 0x43, 0x63, 0xC0, 0x2A, 0xE3, 0xE5, 0x3D, 0xAA,
-    0x8C, 0xAF, 0x07, 0x2D, 0xBF, 0x0E, 0x68, 0x39, 0x00, 0xB4, 0xBC, 0x91, 0x80, 0x50, 0xF8, 0x14,
-    0xFB, 0x1E, 0xC5, 0xBB, 0xAA, 0x5F, 0xC6, 0x4A, 0x90, 0x91, 0x9E, 0xDC, 0x2F, 0x2E, 0xD4, 0x6F,
-    0x83, 0xDD, 0x9F, 0x9C, 0x2C, 0x23, 0xD7, 0xD5, 0x5D, 0x2C, 0x4E, 0xDA, 0xEB, 0xF5, 0x0D, 0xA1,
-    0x65, 0x6D, 0x28, 0x38, 0x90, 0x0F, 0xDD, 0x8B, 0x9B, 0x45, 0xEE, 0x2D, 0xCB, 0x50, 0xE6, 0x1A,
-    0x27, 0x94, 0x6C, 0x96, 0x60, 0x84, 0x2F, 0xBE, 0x5C, 0x0B, 0xD7, 0xA0, 0x6E, 0xB5, 0xDE, 0xAC,
-    0xD3, 0x1E, 0xEE, 0x5E, 0xEB, 0x84, 0x58, 0x53, 0xB2, 0x8D, 0x75, 0xBE, 0x06, 0xED, 0x74, 0x46,
-    0x18, 0xC1, 0xEB, 0x04, 0x84, 0x5F, 0x74, 0x54, 0x06, 0xB6, 0x52, 0x88, 0x9B, 0xA6, 0x1D, 0x4D,
-    0x4F, 0xA8, 0x52, 0x7D, 0x55, 0xE5, 0x7E, 0xB6, 0x52, 0x1B, 0xB7, 0x5F, 0x79, 0x68, 0xDD, 0xA5,
-    0xB1, 0x95, 0x28, 0x5B, 0x51, 0x88, 0xF6, 0x03, 0xEE, 0x57, 0x0A, 0xED, 0xDB, 0x68, 0x1A, 0x33,
-    0x4C, 0x24, 0x00, 0xBA, 0x56, 0x2F, 0xFF, 0x12, 0xB1, 0xE9, 0xCC, 0x56, 0xF4, 0x7F, 0x2F, 0x0C,
-    0x4E, 0x0B, 0x4E, 0x25, 0x55, 0x30, 0x07, 0x51, 0xF4, 0xD0, 0x85, 0x05, 0x95, 0x53, 0xF1, 0x36,
-    0xD5, 0xCA, 0xBB, 0x03, 0xF5, 0x49, 0xB7, 0x42, 0x6C, 0x5A, 0x61, 0xAA, 0x45, 0x91, 0xC5, 0xBC,
-    0x2B, 0x36, 0xCD, 0xFB, 0xA3, 0x65, 0x48, 0xBF, 0x52, 0x6D, 0x3C, 0xED, 0x2F, 0xDF, 0xC6, 0xF3,
-    0x8E, 0x6F, 0xE3, 0x99, 0x7D, 0x1B, 0x4F, 0x67, 0x6D, 0x3C, 0x1E, 0x02, 0xF5, 0xE5, 0x60, 0xE9,
-    0x78, 0xAC, 0x14, 0xCC, 0xA3, 0x40, 0xA1, 0x7F, 0x67, 0x66, 0xEF, 0x0C, 0xFD, 0x3B, 0xEF, 0xB8,
-    0x25, 0xF2, 0x8D, 0xE5, 0xF1, 0x7C, 0xE3, 0xA5, 0x16, 0xF9, 0xC6, 0xFC, 0xBE, 0x5D, 0xBE, 0xB1,
-    0x2F, 0x18, 0x7C, 0x20, 0x0F, 0x34, 0xC3, 0x41, 0xFA, 0x9A, 0x9A, 0x8B, 0xED, 0x5A, 0xCF, 0xC6,
-    0x30, 0x2F, 0x78, 0x96, 0x2C, 0xA2, 0x4D, 0xAF, 0xFF, 0xA4, 0x7A, 0xA8, 0x3B, 0xDD, 0x3B, 0x67,
-    0x3D, 0x2A, 0x5D, 0x5B, 0x3B, 0xDE, 0xC7, 0x51, 0x0F, 0x75, 0x52, 0x04, 0x2C, 0x56, 0xFB, 0x80,
-    0xCE, 0x81, 0xD1, 0xE0, 0x1F, 0x1A, 0x72, 0x47, 0xDD, 0xDC, 0x72, 0x19, 0x5F, 0x74, 0xBF, 0xD8,
-    0xF2, 0xC0, 0x8F, 0xFC, 0x39, 0xA8, 0x5E, 0xF9, 0xAE, 0xA2, 0x55, 0x58, 0x1E, 0x10, 0xB3, 0xC7,
-    0x60, 0xBF, 0x01, 0x56, 0x3D, 0x0F, 0x94, 0x4D, 0xDE, 0x57, 0xFF, 0xB9, 0xC3, 0x79, 0xC1, 0x80,
-    0x38, 0xC6, 0x4C, 0xA8, 0x06, 0xC2, 0xC1, 0xEE, 0x8B, 0xD1, 0xCD, 0x3A, 0x1B, 0x42, 0xED, 0x6C,
-    0x88, 0xB4, 0xB3, 0x41, 0x9B, 0x28, 0x6C, 0x92, 0x47, 0xC6, 0xCE, 0x86, 0xC7, 0xD8, 0xD9, 0xF0,
-    0x08, 0xC7, 0x96, 0x5C, 0x7A, 0x95, 0x9D, 0x0D, 0x05, 0x87, 0x81, 0x68, 0x67, 0xC3, 0xE2, 0x3B,
-    0x1B, 0x4A, 0x5F, 0xF6, 0x9F, 0x2E, 0x07, 0x05, 0x65, 0x0C, 0x6C, 0x29, 0x17, 0xFC, 0xEC, 0x2F,
-    0xD1, 0xD9, 0xF0, 0xCB, 0x65, 0xE0, 0x92, 0xE3, 0x19, 0xB8, 0xDB, 0x52, 0x30, 0xEA, 0x37, 0x84,
-    0x60, 0xE9, 0xF8, 0x28, 0x4C, 0xC7, 0x50, 0x00, 0xC4, 0x1A, 0x10, 0x6D, 0x17, 0x73, 0x7A, 0x6D,
-    0x06, 0x8E, 0x7D, 0x45, 0x07, 0x23, 0x85, 0xF0, 0x7B, 0xE4, 0x99, 0x47, 0x98, 0x81, 0xFB, 0xFC,
-    0x7B, 0x66, 0xE0, 0x82, 0x15, 0x73, 0x7A, 0x26, 0xD8, 0x31, 0xB0, 0xFA, 0x3E, 0xF0, 0x83, 0x44,
-    0x7F, 0x3D, 0x38, 0xF9, 0x5E, 0x1B, 0xB7, 0x56, 0xA5, 0xD1, 0x53, 0xFF, 0xF6, 0x61, 0x79, 0xDD,
-    0xDE, 0xEE, 0xE3, 0xA3, 0xD4, 0x8E, 0xF7, 0x76, 0xAB, 0xBB, 0x63, 0xA9, 0xCB, 0x63, 0xB3, 0xCF,
-    0x82, 0x1B, 0x75, 0x97, 0x4C, 0xEF, 0x75, 0x06, 0xB3, 0x1F, 0x34, 0xE7, 0xE7, 0x92, 0xD1, 0xAC,
-    0x51, 0xE9, 0x88, 0x6F, 0xF7, 0x27, 0x42, 0x30, 0x84, 0x9A, 0x34, 0xAD, 0x5B, 0xD1, 0x0E, 0x4F,
-    0x1B, 0xAF, 0x32, 0x7C, 0x66, 0x48, 0xCC, 0x24, 0x4C, 0xE2, 0xB1, 0xA7, 0xBD, 0x97, 0xCC, 0x07,
-    0x3D, 0xA7, 0x10, 0x83, 0xFD, 0x21, 0xD3, 0x91, 0xEA, 0x0D, 0x34, 0xD6, 0x07, 0xC1, 0x0E, 0x94,
-    0x13, 0xE5, 0xFB, 0xE8, 0xA6, 0xDF, 0xDE, 0xBC, 0x9B, 0xFE, 0x8E, 0xF2, 0xC8, 0x86, 0xC3, 0x07,
-    0xDC, 0x8F, 0x0F, 0xB8, 0xC7, 0x45, 0x8B, 0x3B, 0xDB, 0x0F, 0xBE, 0x9B, 0xFE, 0x34, 0x2C, 0x30,
-    0x2B, 0x0E, 0x91, 0x44, 0x9D, 0xD2, 0xE5, 0x41, 0x77, 0x2F, 0xCA, 0x83, 0x3E, 0x0F, 0x79, 0xFE,
-    0x8F, 0x22, 0x4C, 0x8F, 0xE4, 0x28, 0x77, 0x06, 0x07, 0x6B, 0xF1, 0x0E, 0x14, 0x43, 0xEC, 0x2E,
-    0x6E, 0xC5, 0xD8, 0x00, 0x63, 0x3D, 0xF5, 0xA7, 0x28, 0x4A, 0x46, 0x51, 0xD3, 0xE3, 0x8E, 0xBD,
-    0x4A, 0x40, 0x2B, 0x17, 0x2B, 0x6A, 0xDA, 0x1B, 0xE0, 0xD0, 0x1F, 0x1B, 0xE0, 0xF0, 0xCE, 0xE1,
-    0x6E, 0x80, 0x83, 0x83, 0x91, 0x40, 0xF9, 0x89, 0x36, 0xA2, 0x3F, 0x7D, 0x7C, 0x80, 0xC3, 0x5D,
-    0xE7, 0xBD, 0xC6, 0x0B, 0xEC, 0xD3, 0x9A, 0x0C, 0x9A, 0xA0, 0x06, 0xE0, 0xCF, 0x38, 0x1D, 0x76,
-    0xD7, 0x80, 0x75, 0xB4, 0x46, 0x5A, 0xAB, 0x9E, 0x63, 0x67, 0x23, 0x7E, 0xC0, 0x73, 0x88, 0x82,
-    0xD1, 0x9E, 0x89, 0xDA, 0xBA, 0x74, 0x4E, 0xC9, 0x0C, 0xA8, 0xA2, 0xDD, 0x1C, 0xE9, 0xB0, 0xE9,
-    0x30, 0xCB, 0x0A, 0xB7, 0x4F, 0xDB, 0x9A, 0x3E, 0xA2, 0xA3, 0xB3, 0xE4, 0x76, 0x1E, 0x46, 0xF8,
-    0x6C, 0x49, 0x15, 0xCE, 0x96, 0xA0, 0x85, 0xAE, 0xE1, 0x43, 0xF3, 0x21, 0x50, 0x81, 0xB4, 0x11,
-    0x99, 0x45, 0x0F, 0xCD, 0x67, 0x19, 0xAE, 0x47, 0x6C, 0x5F, 0xB8, 0x7A, 0x19, 0x22, 0x33, 0x51,
-    0xCD, 0xA4, 0xF3, 0x83, 0x50, 0x86, 0x19, 0x95, 0xE1, 0x0F, 0x5D, 0x19, 0x23, 0x9D, 0x55, 0xBD,
-    0xE4, 0x82, 0x78, 0x06, 0xF2, 0xF8, 0xD3, 0x49, 0x59, 0x17, 0x71, 0x53, 0xAA, 0x15, 0x44, 0xB7,
-    0x89, 0x6D, 0x8A, 0x50, 0x28, 0x50, 0xBD, 0xC1, 0x69, 0x01, 0xD6, 0x52, 0xB9, 0x8F, 0x3C, 0xFE,
-    0xBA, 0x71, 0x7E, 0xBF, 0x71, 0xBE, 0xBC, 0x5E, 0xE3, 0xBC, 0x5B, 0x93, 0x6B, 0xBE, 0xBD, 0x63,
-    0xC5, 0x03, 0x8E, 0xF4, 0x78, 0xEC, 0x72, 0x58, 0x7B, 0x8D, 0x1E, 0xDE, 0xA2, 0x1F, 0xED, 0xF6,
-    0x10, 0xB1, 0x29, 0x6F, 0x95, 0x1A, 0xB6, 0xFE, 0x78, 0x0D, 0x5B, 0x67, 0x35, 0x6C, 0xB3, 0xD5,
-    0xB0, 0x5D, 0x6D, 0xB5, 0x86, 0x6D, 0x7A, 0xC6, 0x6A, 0xD8, 0x7C, 0xF3, 0x4A, 0xE0, 0x4D, 0xD7,
-    0x35, 0xBF, 0xC8, 0x8D, 0x3A, 0xB9, 0x1F, 0x4F, 0xE3, 0xFF, 0xF0, 0x31, 0x8E, 0x1E, 0xE8, 0x6E,
-    0x36, 0x7A, 0xA0, 0x5A, 0xED, 0x17, 0x9C, 0xF5, 0xCD, 0x57, 0x67, 0xDF, 0xA5, 0x56, 0x31, 0x75,
-    0x85, 0x97, 0xF0, 0xBB, 0xC1, 0x87, 0x5F, 0xBC, 0x07, 0xB0, 0x17, 0x56, 0xE8, 0x54, 0x5E, 0x06,
-    0xD1, 0xCB, 0x8C, 0xB5, 0x2D, 0x1C, 0xCA, 0x87, 0xEB, 0x85, 0x07, 0x31, 0xEB, 0x2E, 0xFB, 0x48,
-    0x83, 0x83, 0x80, 0x43, 0x41, 0x50, 0xBB, 0xCD, 0x91, 0x65, 0xCC, 0x08, 0x42, 0x71, 0x85, 0x25,
-    0x7B, 0xC4, 0x48, 0x9B, 0x8E, 0x2E, 0x75, 0x3A, 0xD3, 0x4C, 0x8B, 0x74, 0xD0, 0x01, 0x15, 0xA1,
-    0xD2, 0x82, 0x82, 0xE7, 0xE6, 0xBD, 0x6E, 0x77, 0x3F, 0xF8, 0xB0, 0x52, 0x75, 0xEF, 0x9B, 0xDE,
-    0x65, 0xD1, 0x83, 0x5E, 0x82, 0xA4, 0x53, 0x70, 0xC8, 0xF7, 0xBC, 0xFB, 0xD9, 0x5F, 0x60, 0x19,
-    0x46, 0x19, 0x25, 0x4B, 0xC0, 0xB5, 0xE5, 0xDD, 0x8F, 0xFE, 0xD2, 0x46, 0xFE, 0x21, 0xD2, 0xB2,
-    0xD1, 0x66, 0x7F, 0xDC, 0x90, 0x97, 0x26, 0x85, 0xB6, 0xBD, 0x33, 0xE1, 0xC7, 0x19, 0xF9, 0x29,
-    0x46, 0x36, 0x17, 0x6C, 0x73, 0xFE, 0x43, 0x86, 0x0A, 0x67, 0x80, 0x73, 0xD0, 0xAE, 0x0B, 0xD6,
-    0x71, 0x6A, 0xF6, 0x78, 0xCE, 0xEE, 0x85, 0x8E, 0x02, 0xC3, 0x43, 0xF6, 0x2F, 0x9E, 0x38, 0xD6,
-    0xC3, 0x90, 0x0C, 0xEC, 0xED, 0x06, 0xCC, 0x93, 0x32, 0x81, 0xB5, 0x30, 0x1F, 0x16, 0xEB, 0x18,
-    0x22, 0xB1, 0x2F, 0x36, 0x8A, 0xB6, 0xFB, 0x3C, 0xB9, 0x9C, 0x62, 0xE9, 0x7E, 0xF8, 0x98, 0xD2,
-    0xF9, 0x85, 0x4B, 0x2A, 0xE9, 0x2F, 0x32, 0x72, 0xDE, 0xB8, 0x27, 0xEF, 0xEF, 0x78, 0x2A, 0xF7,
-    0x9F, 0xB3, 0xD3, 0xB1, 0x6E, 0x3F, 0x13, 0x6F, 0xA7, 0xED, 0x7D, 0xC9, 0xF2, 0x7B, 0x85, 0x02,
-    0xFA, 0x5F, 0xA6, 0x46, 0x4C, 0xA7, 0x3F, 0x22, 0x6D, 0x33, 0x71, 0x0A, 0xF5, 0xA0, 0xFE, 0x2C,
-    0xB5, 0x45, 0x27, 0xD6, 0xA7, 0xC1, 0x19, 0x4F, 0x85, 0x35, 0x15, 0xD7, 0x03, 0xE3, 0x39, 0x06,
-    0x87, 0xDA, 0xCD, 0x84, 0x34, 0x0D, 0xBB, 0x03, 0xCC, 0x57, 0xD8, 0xEB, 0xBA, 0x3C, 0x03, 0x40,
-    0xE5, 0x05, 0x35, 0xEA, 0x88, 0x7C, 0x66, 0x16, 0xE4, 0x21, 0x07, 0x9A, 0xFF, 0x40, 0x6C, 0x03,
-    0xE4, 0xA8, 0xFA, 0xE9, 0x93, 0xA8, 0xD8, 0xFF, 0xF2, 0x33, 0x58, 0xCA, 0xBB, 0x9D, 0x71, 0x97,
-    0x7A, 0x60, 0xC9, 0xFC, 0x7F, 0x71, 0x81, 0xB7, 0xB1, 0x51, 0xF7, 0xFD, 0x14, 0x2B, 0xF9, 0x42,
-    0xDE, 0x7F, 0x01, 0xF0, 0xCF, 0xDF, 0xF7, 0x8C, 0x58, 0x2F, 0x31, 0xB1, 0x83, 0xEA, 0x03, 0xD4,
-    0x3E, 0xD9, 0x94, 0xB7, 0xFD, 0x1A, 0xD3, 0x7F, 0xDA, 0xF8, 0x87, 0x13, 0xD5, 0x5C, 0x42, 0x98,
-    0x85, 0xA5, 0x63, 0x86, 0x1E, 0x6E, 0x2A, 0x34, 0xE5, 0xB1, 0xB1, 0xF1, 0x0F, 0x99, 0x8E, 0x7F,
-    0x68, 0x3E, 0xF6, 0xF1, 0x0F, 0x27, 0xCE, 0x5B, 0xFD, 0x34, 0x03, 0x29, 0x73, 0x1F, 0xD2, 0xB5,
-    0x5A, 0xDE, 0xC6, 0xF7, 0xE9, 0x98, 0xD5, 0x50, 0x16, 0x24, 0x4C, 0xFF, 0x83, 0xBF, 0x59, 0xFE,
-    0x27, 0x20, 0x24, 0x98, 0xB6, 0xFA, 0x39, 0xF7, 0x6F, 0x83, 0xE2, 0x95, 0x05, 0x69, 0x66, 0x38,
-    0x80, 0xD3, 0xB3, 0x81, 0x0A, 0x81, 0xAF, 0x77, 0x99, 0xD8, 0xE0, 0x09, 0xFF, 0x15, 0x59, 0x68,
-    0xB1, 0x04, 0x88, 0x00, 0xDC, 0xF6, 0xA9, 0xA2, 0x2F, 0x86, 0x09, 0xD3, 0xA6, 0x1C, 0x03, 0xAC,
-    0x7B, 0x51, 0x86, 0xC6, 0xC2, 0xB6, 0x72, 0x45, 0xCA, 0xD7, 0x11, 0xCB, 0x25, 0x66, 0x29, 0x38,
-    0x16, 0x8B, 0x7E, 0xD3, 0x69, 0x8C, 0x5F, 0xE8, 0x80, 0xAB, 0xD1, 0x1D, 0x40, 0x27, 0xBD, 0x79,
-    0x09, 0xFD, 0x0B, 0xC9, 0xF4, 0x99, 0xAC, 0x15, 0xDE, 0x91, 0xD5, 0x56, 0x28, 0x7F, 0x93, 0x5B,
-    0x4D, 0xA8, 0x21, 0x11, 0x52, 0x1F, 0xA4, 0xCB, 0x46, 0xA7, 0x12, 0x0D, 0x06, 0x13, 0xB5, 0x4E,
-    0xBD, 0xCE, 0x35, 0x2F, 0xD4, 0xD9, 0x20, 0x42, 0x65, 0xFA, 0x7B, 0x9D, 0xE6, 0xC3, 0x2C, 0x13,
-    0x45, 0x30, 0x1A, 0x24, 0x26, 0xE9, 0xD8, 0xD0, 0x60, 0xBD, 0x47, 0xAC, 0x3B, 0x68, 0x6C, 0x28,
-    0xB1, 0xB2, 0x76, 0x05, 0xAF, 0x5A, 0x55, 0x77, 0x0A, 0x60, 0x98, 0x4D, 0xE3, 0x5B, 0xED, 0x41,
-    0x9D, 0x8F, 0x1A, 0x28, 0xE8, 0xF6, 0x6D, 0x82, 0x29, 0x9B, 0x65, 0x35, 0x15, 0xA0, 0xF0, 0xF4,
-    0xEC, 0x3D, 0x42, 0xE5, 0x71, 0x89, 0x96, 0x74, 0x3C, 0xE5, 0xA2, 0x59, 0x56, 0x5F, 0xDF, 0x37,
-    0x09, 0xE7, 0x7D, 0x2E, 0x99, 0xE9, 0xEE, 0x5F, 0xE5, 0x2B, 0x55, 0xA6, 0x96, 0xF4, 0x66, 0x8B,
-    0x6A, 0x7D, 0xED, 0xBF, 0x53, 0x19, 0xAB, 0x9B, 0xDF, 0x0F, 0xAA, 0xAE, 0x78, 0x0B, 0xD5, 0xA0,
-    0x18, 0x98, 0x0B, 0xC7, 0x99, 0xA5, 0xAB, 0xF0, 0x3F, 0xB7, 0x66, 0x27, 0x0F, 0x82, 0x4F, 0xCF,
-    0x88, 0x88, 0x03, 0x3F, 0x22, 0xA2, 0xB5, 0x11, 0x11, 0xB3, 0x1F, 0x11, 0xD1, 0x1C, 0x6B, 0x00,
-    0x34, 0x54, 0x6C, 0x87, 0xF9, 0xB8, 0x63, 0x8D, 0x7F, 0x6B, 0xDB, 0x5F, 0xEE, 0x6B, 0x0D, 0x9E,
-    0xDA, 0xCB, 0xBB, 0xC6, 0x33, 0xB4, 0x6A, 0x2E, 0x47, 0x06, 0xAA, 0x6A, 0x61, 0x70, 0xC4, 0x46,
-    0x19, 0xE0, 0x36, 0x1D, 0x71, 0x9B, 0xD2, 0x32, 0x31, 0xCE, 0xF7, 0xA0, 0x6D, 0x43, 0x9D, 0x0D,
-    0xCE, 0xD2, 0x60, 0x70, 0x0D, 0x92, 0x01, 0x4C, 0x63, 0xC9, 0x95, 0xFE, 0x10, 0xF9, 0xAD, 0x57,
-    0x7B, 0xAE, 0xFC, 0x71, 0xE4, 0xC0, 0xA0, 0x87, 0x8A, 0x85, 0xA5, 0xB3, 0xDF, 0xC7, 0xEA, 0x4F,
-    0x57, 0x3B, 0x6C, 0x4A, 0x7D, 0x3F, 0x75, 0x7C, 0xDC, 0x8A, 0x19, 0x6A, 0x16, 0x75, 0xEF, 0x40,
-    0x0F, 0xCF, 0x72, 0xFB, 0x95, 0x05, 0x35, 0xAC, 0x61, 0xA2, 0xA3, 0x89, 0x0A, 0x0C, 0x16, 0xDD,
-    0xF0, 0x54, 0xB3, 0xC1, 0x1F, 0x96, 0x86, 0x38, 0x50, 0x1E, 0xCE, 0x9F, 0x9B, 0x8D, 0x2C, 0xC7,
-    0x4C, 0x70, 0x25, 0xB9, 0xBC, 0xE1, 0xF4, 0xEE, 0x20, 0xC8, 0x08, 0xA1, 0x0D, 0x7C, 0xB5, 0xE3,
-    0xD4, 0x68, 0xD2, 0x5B, 0x73, 0xD5, 0x6A, 0x1B, 0xF7, 0xE3, 0xC3, 0x07, 0x75, 0xE4, 0xAB, 0x3F,
-    0xE4, 0xF5, 0xEC, 0xF8, 0x79, 0x0D, 0x03, 0xD7, 0x29, 0x4B, 0xD7, 0xBF, 0xC1, 0xD6, 0xCF, 0x8F,
-    0x5D, 0x2C, 0x99, 0xE1, 0x27, 0x82, 0x04, 0x2B, 0xEB, 0x06, 0xD7, 0x0E, 0xED, 0x61, 0x8D, 0x9A,
-    0xD3, 0x4A, 0x6E, 0x37, 0xD7, 0x9A, 0x2D, 0xE5, 0x99, 0x5D, 0x58, 0x98, 0x79, 0x0C, 0x16, 0xD6,
-    0x73, 0xA3, 0x62, 0x73, 0x9B, 0xCE, 0xD9, 0xC8, 0x83, 0x4B, 0xAD, 0x7F, 0x2B, 0xD0, 0xAA, 0x6E,
-    0x83, 0xB0, 0xEC, 0xF4, 0x88, 0x54, 0x69, 0xFD, 0x01, 0xF2, 0x8B, 0x18, 0x88, 0xD7, 0x6D, 0x03,
-    0x96, 0x77, 0x77, 0x3C, 0x5A, 0x76, 0x07, 0x31, 0xF0, 0xE6, 0x37, 0xAD, 0xB9, 0x1C, 0x76, 0x52,
-    0x6F, 0x23, 0x3F, 0xBC, 0x34, 0x58, 0x06, 0xDD, 0xC6, 0xC2, 0xF1, 0x9C, 0xB4, 0x73, 0xB3, 0xBA,
-    0x7C, 0x48, 0x77, 0x8E, 0x27, 0xB4, 0x9B, 0xB6, 0x60, 0x96, 0x62, 0xDC, 0x1B, 0xBA, 0xA0, 0x34,
-    0x8D, 0x19, 0x3E, 0xAE, 0x13, 0x79, 0x1B, 0x23, 0x60, 0xBA, 0x68, 0x64, 0xBA, 0x35, 0x40, 0x06,
-    0xE3, 0xE7, 0xFD, 0x7C, 0x42, 0xE2, 0x24, 0xFA, 0xE6, 0x42, 0xE3, 0x54, 0x9D, 0x3C, 0xEB, 0x7A,
-    0xBD, 0x01, 0x9C, 0xAA, 0x50, 0x67, 0xF8, 0xB2, 0xE7, 0x8D, 0x87, 0xA6, 0x78, 0x5D, 0xA4, 0xAD,
-    0xE2, 0xD6, 0x29, 0xCF, 0xC6, 0x0C, 0x6B, 0x97, 0xCF, 0x67, 0x8E, 0x60, 0x4D, 0xD1, 0x5E, 0xCE,
-    0x20, 0xA7, 0xEA, 0xB5, 0xB7, 0x46, 0x3C, 0xC4, 0x4B, 0x8E, 0xA8, 0xDE, 0x36, 0x9D, 0xF7, 0x40,
-    0x51, 0x3F, 0x5A, 0x52, 0x8D, 0xFD, 0xED, 0xAB, 0x75, 0x9A, 0x62, 0x93, 0xDD, 0x78, 0x9D, 0x6A,
-    0x9B, 0x7B, 0x4C, 0xDB, 0xEC, 0x14, 0x65, 0xF2, 0xB5, 0x5D, 0xE6, 0x48, 0xCB, 0xDA, 0x35, 0x75,
-    0x34, 0xB3, 0x3C, 0x81, 0x99, 0x6B, 0x2D, 0x6E, 0x07, 0xFD, 0x06, 0x1D, 0x74, 0x37, 0x13, 0x48,
-    0x81, 0xC1, 0x69, 0x35, 0x7B, 0x34, 0xFD, 0x71, 0xA9, 0x43, 0xBB, 0x18, 0x90, 0x65, 0x3A, 0x19,
-    0x99, 0x60, 0x4C, 0x82, 0xDE, 0x8D, 0x08, 0x45, 0x29, 0x2C, 0x00, 0xB3, 0x1E, 0x80, 0xE7, 0x08,
-    0x8C, 0x25, 0xC8, 0x20, 0xA1, 0x35, 0xF7, 0x25, 0x61, 0x1B, 0x11, 0xEF, 0x99, 0x1D, 0x6E, 0xC8,
-    0xFF, 0x83, 0x64, 0xC9, 0x54, 0xA1, 0x45, 0xC0, 0x2B, 0x1C, 0x2D, 0x21, 0x5E, 0x47, 0xF1, 0xD2,
-    0x79, 0x0A, 0x6D, 0x3C, 0xFD, 0xF7, 0xD4, 0xEC, 0x65, 0x57, 0xAC, 0xC1, 0x54, 0x79, 0x38, 0xB5,
-    0xC9, 0x15, 0xD9, 0x91, 0xF1, 0x8D, 0x67, 0x16, 0x23, 0x85, 0x9E, 0xB5, 0xFB, 0x07, 0x7D, 0x6B,
-    0x1B, 0x5E, 0x00, 0x50, 0xDF, 0x6D, 0xD8, 0x8D, 0x3C, 0xB0, 0xFB, 0x0C, 0xC5, 0xA9, 0x0B, 0xE2,
-    0x90, 0x12, 0x5E, 0x74, 0xC9, 0x74, 0xAE, 0xB8, 0x9F, 0x33, 0x13, 0x94, 0x8F, 0x0B, 0xFF, 0x8B,
-    0xBB, 0x38, 0x02, 0x6D, 0x15, 0x29, 0x79, 0x82, 0x2A, 0x2B, 0x1B, 0xD1, 0xAC, 0x2D, 0xE6, 0xEC,
-    0x7E, 0xA7, 0x05, 0xF6, 0xB4, 0x1A, 0x91, 0x4B, 0x9D, 0xC2, 0xD2, 0xFC, 0x2B, 0x7A, 0x06, 0x4B,
-    0x60, 0xD0, 0x65, 0x05, 0xC4, 0x1E, 0xCE, 0x6B, 0xC3, 0x11, 0xE5, 0xE8, 0x73, 0x79, 0x17, 0x2C,
-    0x34, 0x71, 0x70, 0xBA, 0x38, 0x47, 0x17, 0xC5, 0x4F, 0xE8, 0x73, 0x9B, 0xEB, 0x5C, 0x59, 0x4B,
-    0x76, 0xE5, 0x2E, 0x13, 0x9C, 0x3A, 0x71, 0xA0, 0xF9, 0xA9, 0xBB, 0xD6, 0x26, 0xD5, 0x8D, 0x82,
-    0x80, 0x63, 0xF0, 0x5F, 0xC1, 0x0F, 0xE2, 0xAE, 0x20, 0x4F, 0x8A, 0xD2, 0xB6, 0xE2, 0x65, 0x89,
-    0x26, 0x25, 0xBC, 0x9F, 0x8A, 0x36, 0xED, 0xB2, 0xB7, 0x5C, 0x50, 0x97, 0xD5, 0x8B, 0x13, 0xC4,
-    0xB6, 0xE8, 0xD3, 0x3E, 0x19, 0x91, 0x0B, 0x42, 0xB1, 0x9B, 0xFC, 0x2F, 0x95, 0x5F, 0xA7, 0x12,
-    0xFD, 0x27, 0x63, 0x85, 0xDA, 0xBB, 0x77, 0xD1, 0xC0, 0x99, 0x9B, 0x06, 0xFE, 0xAD, 0xC7, 0xB4,
-    0x3F, 0xBC, 0x16, 0x37, 0xB2, 0x0D, 0x4E, 0x94, 0x7B, 0xE5, 0x97, 0xB7, 0xF0, 0xB4, 0x97, 0x33,
-    0x9A, 0x21, 0xD5, 0x58, 0x3F, 0xDB, 0xBD, 0x7E, 0x3E, 0xD7, 0x6A, 0xEF, 0xAD, 0x95, 0x69, 0xF9,
-    0xF9, 0xCE, 0x77, 0x9D, 0xFF, 0xB0, 0x3A, 0x17, 0x8A, 0x92, 0xAD, 0xF0, 0x08, 0x1B, 0xBF, 0x2C,
-    0x31, 0x64, 0xE5, 0x54, 0x19, 0xFB, 0xA0, 0xF1, 0xD6, 0x9B, 0x45, 0x73, 0x79, 0x55, 0x1F, 0x8A,
-    0x29, 0x86, 0x16, 0xC5, 0x58, 0xBD, 0xAF, 0xA6, 0xDA, 0x34, 0x1D, 0x64, 0xC0, 0x91, 0x4A, 0x57,
-    0x41, 0x65, 0xA4, 0x99, 0xB5, 0xCD, 0xF9, 0xE0, 0x63, 0x6F, 0xD8, 0xB8, 0xDB, 0x1A, 0x36, 0x2A,
-    0x6B, 0xD8, 0x98, 0xAD, 0x61, 0x63, 0xD2, 0x86, 0x8D, 0x65, 0xD4, 0x86, 0x8D, 0xCB, 0xA6, 0x27,
-    0xEF, 0xF1, 0x80, 0xC8, 0x0D, 0xBE, 0x1B, 0x72, 0x66, 0x10, 0xA6, 0xAF, 0x7F, 0x47, 0x40, 0xA0,
-    0xC9, 0xC0, 0xAF, 0x71, 0x26, 0xCC, 0xAC, 0x7A, 0xFB, 0x79, 0x0A, 0x43, 0x87, 0xC3, 0x29, 0x68,
-    0xE2, 0x18, 0x26, 0x35, 0x50, 0x64, 0xCC, 0xA3, 0xB3, 0x70, 0x83, 0x03, 0xB1, 0x36, 0x9A, 0xD7,
-    0xAB, 0x58, 0x37, 0x74, 0x3F, 0x21, 0xE9, 0x45, 0x63, 0x4C, 0x9D, 0x22, 0xAC, 0x6A, 0xAD, 0x5A,
-    0xAE, 0x01, 0x7F, 0x6D, 0x20, 0xC8, 0x4D, 0x60, 0xE3, 0x6E, 0x1D, 0x2A, 0x64, 0xC3, 0xC2, 0x33,
-    0xB7, 0xEB, 0xA6, 0x66, 0x4D, 0x09, 0x1A, 0x93, 0x27, 0x16, 0x94, 0xFC, 0x09, 0xB0, 0x53, 0xAD,
-    0x26, 0xA9, 0x09, 0x4B, 0xF6, 0x29, 0x9B, 0x8E, 0x07, 0xAD, 0x23, 0xC9, 0x91, 0xA1, 0x45, 0x6F,
-    0x68, 0x90, 0x01, 0xDB, 0xCA, 0xDE, 0x5A, 0xAC, 0x72, 0x24, 0xD5, 0xBC, 0x17, 0x5D, 0xDB, 0xAD,
-    0x39, 0xBB, 0x0A, 0xB1, 0x0F, 0xBE, 0x63, 0x38, 0x5F, 0xCB, 0x3B, 0xA9, 0xBF, 0x8B, 0xD6, 0x58,
-    0x29, 0xD3, 0xD1, 0x27, 0xF2, 0xF2, 0xC5, 0x0B, 0x7F, 0x1D, 0x7C, 0x04, 0x54, 0xBC, 0xB3, 0xC6,
-    0xC8, 0x60, 0xC3, 0xDB, 0xB5, 0x23, 0x45, 0xC3, 0xBE, 0x5B, 0x8E, 0x8A, 0xF4, 0xEB, 0x14, 0xBD,
-    0x9F, 0x38, 0x36, 0xF6, 0x7D, 0x53, 0xF1, 0xD3, 0x31, 0xA2, 0x68, 0xB6, 0x11, 0x45, 0xCE, 0x46,
-    0x14, 0x19, 0x46, 0x19, 0xCD, 0x47, 0x67, 0xF8, 0x78, 0x91, 0x5C, 0x1B, 0x14, 0xFC, 0xE4, 0x79,
-    0x8B, 0x4A, 0xD2, 0x66, 0x0F, 0xD1, 0xFD, 0xD0, 0x7A, 0x79, 0xFE, 0x16, 0xBD, 0x3C, 0xDF, 0x67,
-    0x0F, 0x0D, 0x7A, 0x40, 0x12, 0x34, 0x4A, 0xFA, 0x5E, 0x9E, 0x37, 0x1B, 0x51, 0xD1, 0xB7, 0xD5,
-    0xBB, 0x10, 0x69, 0xAF, 0x12, 0x49, 0x83, 0xA8, 0x73, 0xC3, 0x5A, 0x02, 0x1A, 0x72, 0xE0, 0x08,
-    0xC5, 0xE0, 0x20, 0xB5, 0x06, 0x8A, 0x86, 0xC3, 0x1E, 0x2A, 0x37, 0x73, 0xD0, 0x81, 0xA8, 0xCE,
-    0xF3, 0x49, 0x5F, 0x75, 0x8C, 0xA5, 0x8B, 0xE7, 0xDD, 0xBD, 0x9C, 0x05, 0xB2, 0xA4, 0x73, 0xDA,
-    0x20, 0x90, 0xEE, 0x8B, 0xFE, 0x2B, 0xD0, 0x0E, 0x27, 0x1F, 0x73, 0x8D, 0x8E, 0xA6, 0x89, 0x17,
-    0x4B, 0x85, 0xF9, 0x4E, 0x76, 0xED, 0x50, 0xED, 0x34, 0x4B, 0x16, 0xF9, 0xA7, 0xB1, 0xD0, 0xB7,
-    0xAC, 0x75, 0xD2, 0x0D, 0x7F, 0xAB, 0x23, 0x46, 0x26, 0x13, 0x68, 0x0E, 0x64, 0x54, 0x84, 0x54,
-    0x33, 0xD7, 0x89, 0xBF, 0x6C, 0x71, 0xC3, 0xCB, 0xE6, 0xCB, 0x77, 0xBF, 0x7E, 0x71, 0x37, 0x11,
-    0xD9, 0x4F, 0xE9, 0x43, 0xD1, 0xB6, 0x0D, 0x9C, 0x31, 0x2E, 0xEA, 0x8F, 0x15, 0x1A, 0xF8, 0x43,
-    0x5E, 0x83, 0xCD, 0x60, 0xAD, 0x5F, 0xF7, 0x41, 0x66, 0xEC, 0xFF, 0x72, 0x47, 0xB9, 0x0E, 0xAB,
-    0xD4, 0xB9, 0x29, 0xFA, 0xC4, 0x0D, 0xCD, 0x85, 0xDE, 0x79, 0x78, 0xF6, 0x83, 0x2E, 0x06, 0x6C,
-    0x8E, 0x17, 0x03, 0xB6, 0x2C, 0x06, 0x4C, 0xEE, 0x75, 0xC9, 0xDB, 0x73, 0xB5, 0x57, 0x0C, 0xD8,
-    0xC0, 0x79, 0x78, 0x56, 0x28, 0xB2, 0xB9, 0x8C, 0x3E, 0xD9, 0x70, 0xEF, 0xD8, 0xF7, 0x9B, 0xAA,
-    0xB2, 0x6E, 0xAD, 0xF4, 0x55, 0x3A, 0xDC, 0x79, 0xCB, 0x8F, 0x9A, 0x2A, 0xD7, 0x8C, 0xA3, 0x01,
-    0x3F, 0xB1, 0xBF, 0x86, 0x1F, 0x9F, 0xD6, 0xEC, 0x21, 0x04, 0xD6, 0x32, 0x64, 0x29, 0x97, 0x65,
-    0x3F, 0xD5, 0x72, 0x72, 0xED, 0x4A, 0x38, 0x87, 0x02, 0x26, 0x71, 0xC9, 0x92, 0x25, 0x61, 0x39,
-    0x8B, 0x36, 0x8F, 0x65, 0xBD, 0xD6, 0x80, 0xA3, 0xE2, 0x1B, 0xF8, 0x80, 0x95, 0x10, 0x77, 0x4C,
-    0x0A, 0xC6, 0xCC, 0xFE, 0xB8, 0x39, 0xD0, 0x3A, 0xE3, 0xC4, 0xDD, 0xBF, 0x57, 0x18, 0x3D, 0xFE,
-    0x29, 0xCE, 0xF9, 0x3B, 0x44, 0xE6, 0x46, 0x5F, 0xC8, 0x54, 0x2C, 0x88, 0x62, 0x16, 0xC0, 0xD3,
-    0x76, 0x1A, 0xF5, 0x4E, 0x1E, 0xEB, 0x75, 0xB2, 0xD1, 0x99, 0x79, 0xED, 0x68, 0x3A, 0x51, 0xDA,
-    0x61, 0x9C, 0x75, 0x28, 0x12, 0x71, 0x3F, 0xA7, 0x20, 0xBA, 0xAF, 0x51, 0x43, 0xE9, 0x61, 0x4C,
-    0x7E, 0x18, 0x59, 0xC1, 0x30, 0x2E, 0xD4, 0xC0, 0xD2, 0x82, 0xBE, 0x7C, 0x4A, 0x1F, 0xE7, 0xE0,
-    0xF9, 0x47, 0x58, 0xE9, 0xF3, 0x7C, 0xCF, 0x13, 0xFB, 0xE6, 0x73, 0x78, 0x93, 0x13, 0x67, 0x5A,
-    0x4F, 0x61, 0x0A, 0x6C, 0x24, 0x0D, 0x0F, 0x03, 0xF7, 0x9D, 0x28, 0x50, 0x51, 0xA7, 0x83, 0xC8,
-    0x1F, 0x27, 0xE1, 0x1F, 0xD1, 0x14, 0xFA, 0x81, 0xFA, 0x6E, 0x9B, 0xFD, 0xC3, 0xB0, 0x6A, 0x45,
-    0xE6, 0x6B, 0xF6, 0x12, 0xE6, 0x24, 0x2B, 0x1A, 0xB2, 0xD9, 0x25, 0x81, 0x32, 0xB4, 0x87, 0x19,
-    0x70, 0x65, 0x1A, 0xAB, 0x30, 0x52, 0x41, 0xAB, 0x4D, 0x34, 0xDF, 0x0D, 0x0A, 0xBF, 0x74, 0x09,
-    0x65, 0x96, 0x7F, 0x54, 0x2B, 0xF6, 0x42, 0xB2, 0xA2, 0x4C, 0xE9, 0xA7, 0xB8, 0xDA, 0x40, 0x65,
-    0x90, 0x4E, 0xA2, 0xCA, 0xDE, 0x72, 0x2F, 0x36, 0xC1, 0x89, 0xCC, 0x1A, 0xE2, 0x99, 0xB4, 0xEB,
-    0xD6, 0xC7, 0x0E, 0x1D, 0xF8, 0x6A, 0x18, 0x0F, 0xCA, 0xDA, 0x10, 0x43, 0x4B, 0x49, 0x6B, 0xAD,
-    0x98, 0x3D, 0xC4, 0xCD, 0xEA, 0x03, 0xFC, 0x23, 0x80, 0xDA, 0x23, 0x7C, 0x77, 0xEE, 0xB2, 0x6E,
-    0x88, 0x53, 0x6B, 0xF8, 0x2D, 0xB5, 0x67, 0x63, 0x5D, 0x86, 0x06, 0xB6, 0x47, 0xA3, 0x31, 0x6B,
-    0x41, 0x89, 0xB0, 0xA7, 0xBE, 0x68, 0x62, 0x18, 0x8B, 0xC9, 0x75, 0x5C, 0xBB, 0x97, 0x83, 0x2D,
-    0x33, 0xC7, 0x5A, 0x9A, 0xE1, 0x9C, 0xC4, 0x33, 0x12, 0x5D, 0x4B, 0x78, 0xE6, 0x5E, 0x22, 0xCE,
-    0xE1, 0xAE, 0x57, 0xBB, 0xDD, 0x1F, 0xA9, 0xDD, 0x56, 0x97, 0x26, 0x3C, 0x52, 0x51, 0x7F, 0x1B,
-    0x4B, 0x6C, 0x47, 0x8C, 0x53, 0x44, 0x16, 0xE1, 0x25, 0x24, 0x78, 0x26, 0x42, 0x47, 0x35, 0x11,
-    0xA9, 0x16, 0x01, 0x23, 0xFA, 0xB9, 0x72, 0xC7, 0x4A, 0xA5, 0x76, 0x57, 0xBB, 0x5D, 0xB2, 0x76,
-    0x5B, 0x3D, 0xD8, 0xE3, 0xB5, 0xDB, 0xC9, 0xFB, 0xAB, 0xDD, 0x66, 0xF4, 0x35, 0x28, 0x5E, 0xE3,
-    0x06, 0x9B, 0x58, 0xD3, 0x19, 0x2C, 0x22, 0x6A, 0xA4, 0x58, 0x50, 0x93, 0xD2, 0x53, 0x58, 0x2E,
-    0x31, 0x00, 0x13, 0x17, 0xA5, 0xA9, 0xD0, 0xBC, 0xF5, 0xE2, 0x08, 0x66, 0xCA, 0xA7, 0xFA, 0xCF,
-    0x09, 0x63, 0x3D, 0x81, 0x5A, 0x4E, 0x39, 0x9C, 0xE2, 0xAA, 0xFB, 0xF6, 0xE1, 0x83, 0x6E, 0x63,
-    0x53, 0xF3, 0x12, 0x0B, 0x40, 0x13, 0x0B, 0x40, 0x53, 0x6F, 0xE5, 0xFB, 0x60, 0xCF, 0x55, 0x3A,
-    0xF2, 0xE3, 0xEF, 0xEB, 0xE0, 0xA1, 0x6C, 0x4B, 0x52, 0x26, 0x54, 0x33, 0xDB, 0x33, 0xB4, 0x26,
-    0xBA, 0xB8, 0x74, 0xF7, 0x58, 0xA8, 0x49, 0x87, 0x33, 0x69, 0x94, 0x7E, 0xC2, 0x87, 0x94, 0xA7,
-    0xB8, 0x91, 0xC1, 0xB7, 0x20, 0xF0, 0x51, 0x53, 0xF9, 0x20, 0xDA, 0x38, 0x9E, 0xA2, 0xE5, 0xE4,
-    0x56, 0xDC, 0x81, 0x1F, 0x8E, 0x79, 0x97, 0x4C, 0x05, 0x1A, 0xA6, 0xEE, 0xEB, 0xC5, 0xA5, 0xE8,
-    0x2A, 0x89, 0xC6, 0x87, 0x68, 0xB6, 0xB1, 0x41, 0xEC, 0x06, 0xB8, 0x4C, 0x50, 0x23, 0x88, 0xA0,
-    0x0F, 0xC2, 0x81, 0x03, 0x73, 0x4A, 0x0D, 0x0B, 0x63, 0x1B, 0xD6, 0x4C, 0xE8, 0x7E, 0xD9, 0xEB,
-    0x59, 0xFC, 0x44, 0x93, 0x74, 0x38, 0x42, 0x52, 0xD3, 0xC2, 0xDD, 0x91, 0x47, 0xEF, 0x54, 0xCD,
-    0xD1, 0x18, 0xE6, 0xA8, 0xBF, 0x64, 0x69, 0xF0, 0xB8, 0x39, 0x5E, 0xE8, 0xFF, 0x91, 0x1F, 0xC7,
-    0x9E, 0x4E, 0xE6, 0xA2, 0x92, 0x6E, 0xAD, 0x61, 0x4A, 0x9A, 0xB5, 0x13, 0x80, 0x39, 0xAE, 0x5B,
-    0xE4, 0xA9, 0x73, 0xC7, 0x9E, 0xEB, 0xC3, 0x93, 0xDB, 0x86, 0xAB, 0x53, 0xB3, 0xFA, 0xA0, 0x42,
-    0xA2, 0xD5, 0xB1, 0x71, 0x6B, 0x99, 0x47, 0xBE, 0x9B, 0x9E, 0x9B, 0xED, 0x86, 0xFF, 0xEE, 0x77,
-    0xB8, 0x5E, 0xF3, 0x95, 0xB7, 0xF4, 0x6C, 0xCE, 0x00, 0x86, 0x06, 0x72, 0xD5, 0x6D, 0xB4, 0x01,
-    0x30, 0xE5, 0x63, 0xB7, 0xF0, 0x78, 0xB9, 0xE6, 0x0C, 0xFF, 0x00, 0xDA, 0x97, 0x68, 0x00, 0x5C,
-    0xC6, 0x20, 0xFC, 0xEA, 0xC2, 0x36, 0xD6, 0x72, 0x4B, 0x47, 0x14, 0x6D, 0xC5, 0xEA, 0x38, 0xA3,
-    0x83, 0x58, 0xDD, 0xF5, 0x2E, 0x1B, 0x8D, 0x3D, 0xF2, 0xA6, 0x6A, 0x2D, 0xAB, 0x5B, 0xDD, 0xE3,
-    0x7C, 0x9E, 0x77, 0x01, 0xC8, 0xEB, 0xB1, 0x45, 0xE7, 0x11, 0x39, 0x0F, 0x5D, 0xAB, 0xA2, 0xB6,
-    0x71, 0xB1, 0xA3, 0xCD, 0xCB, 0xE2, 0x6C, 0xB1, 0xC6, 0xC2, 0x80, 0x39, 0x5A, 0x36, 0xF6, 0x5C,
-    0x23, 0xB9, 0x55, 0x64, 0x33, 0x2B, 0xD1, 0xBF, 0xAC, 0x46, 0x62, 0x88, 0xEC, 0xB1, 0x33, 0x19,
-    0x9D, 0x2E, 0x3D, 0xCA, 0x11, 0xD1, 0x4E, 0x3D, 0xE8, 0x43, 0x0A, 0xD5, 0xB3, 0x61, 0xC9, 0x8B,
-    0xEE, 0xBA, 0xD0, 0x67, 0x07, 0xA0, 0x7A, 0x89, 0x53, 0xD6, 0x54, 0xD7, 0x7B, 0x2D, 0x79, 0x0D,
-    0x11, 0x43, 0xDD, 0xD3, 0xDF, 0x5A, 0x15, 0x30, 0x0B, 0x51, 0x29, 0x14, 0x56, 0xB1, 0x5A, 0xBD,
-    0xEE, 0xFC, 0x56, 0xDA, 0x23, 0xCF, 0xFC, 0x0A, 0x4E, 0x1E, 0x5C, 0x23, 0x17, 0x9F, 0xD0, 0x01,
-    0x47, 0x1F, 0xEE, 0x64, 0xFE, 0x9F, 0xF8, 0xD4, 0xEC, 0xE2, 0x99, 0xA3, 0xB4, 0xE7, 0xB9, 0xB0,
-    0xF1, 0x8D, 0xE0, 0x17, 0x57, 0x65, 0xD3, 0x2C, 0xAB, 0x51, 0xA5, 0xCD, 0xF5, 0x3B, 0x04, 0x5E,
-    0x1F, 0x4D, 0xB7, 0x0E, 0xCC, 0x66, 0x83, 0x57, 0xCF, 0xD4, 0x6C, 0xA4, 0x8F, 0xBE, 0xC4, 0xAF,
-    0x28, 0x82, 0x0C, 0x19, 0x9D, 0x4D, 0xC6, 0xF7, 0x6D, 0x72, 0xDE, 0x61, 0xDD, 0xAA, 0x5B, 0x9D,
-    0x6E, 0x55, 0xA5, 0xD7, 0x6B, 0x46, 0xDE, 0x9E, 0x60, 0xA3, 0x72, 0xB7, 0x79, 0xD6, 0x87, 0x86,
-    0xA7, 0x42, 0x80, 0xD2, 0xF7, 0xA1, 0xA0, 0xEB, 0x1F, 0xD1, 0xE8, 0x3B, 0x3D, 0xEC, 0x9A, 0x0A,
-    0xE6, 0xB9, 0x78, 0x1E, 0xE5, 0x07, 0x8D, 0xA8, 0xD2, 0xB4, 0x95, 0x15, 0xB2, 0xAE, 0xEF, 0x12,
-    0x70, 0xBD, 0xAB, 0xFA, 0xF0, 0x9E, 0x41, 0xEB, 0x4D, 0x23, 0xF7, 0x75, 0xE2, 0xBE, 0x68, 0x9A,
-    0x80, 0x5F, 0xC5, 0x46, 0x45, 0x4E, 0xE5, 0xD2, 0x64, 0x17, 0x63, 0x07, 0xB4, 0x1E, 0xB7, 0xDE,
-    0xD5, 0x5C, 0xAB, 0x19, 0x4F, 0x01, 0xBD, 0x78, 0x84, 0x8F, 0x92, 0xB9, 0xAA, 0x4D, 0x22, 0xEC,
-    0x1B, 0x97, 0x95, 0x9D, 0xB9, 0x1C, 0x7C, 0x54, 0x4F, 0x1B, 0x68, 0x3F, 0x9C, 0xA7, 0x0D, 0x2C,
-    0xA5, 0x3D, 0x6D, 0x60, 0xB0, 0xA7, 0x0D, 0x8C, 0xF6, 0xB4, 0x81, 0x5E, 0xF9, 0xD1, 0x87, 0x7F,
-    0x45, 0x7B, 0x24, 0xD3, 0xE8, 0x13, 0x8C, 0x1E, 0x7C, 0xB3, 0x44, 0xC0, 0x5A, 0x63, 0xFE, 0x99,
-    0xFD, 0x86, 0xC5, 0xD8, 0xD8, 0xCB, 0x1E, 0x56, 0xD5, 0xF9, 0x31, 0x4D, 0x11, 0x32, 0x0F, 0x41,
-    0x38, 0x33, 0x75, 0xEB, 0x18, 0x63, 0xEB, 0x9C, 0xA6, 0xBC, 0x61, 0x36, 0x0A, 0xA9, 0x3C, 0x51,
-    0x81, 0x38, 0x07, 0x1D, 0xD4, 0xC4, 0xB2, 0x38, 0x34, 0xF6, 0x72, 0xA4, 0x53, 0x53, 0x0C, 0xDF,
-    0xE0, 0xA4, 0xA6, 0x2A, 0x65, 0x7D, 0xE9, 0x25, 0x66, 0x08, 0x3A, 0x16, 0x5E, 0x0C, 0x1C, 0xD5,
-    0x34, 0x41, 0xC7, 0x9C, 0x5E, 0xF6, 0x4C, 0xAA, 0x86, 0xAA, 0xBA, 0x4A, 0xD5, 0xFC, 0x8A, 0x45,
-    0x6C, 0xDA, 0x23, 0xC5, 0x27, 0xB7, 0x6C, 0xFA, 0x38, 0x7F, 0xDF, 0xE9, 0xE3, 0x54, 0x67, 0xEC,
-    0x36, 0x01, 0xAB, 0xAF, 0xDD, 0xA4, 0x4B, 0x71, 0x96, 0xD6, 0xDF, 0xF3, 0xED, 0xBD, 0x5B, 0x7F,
-    0xBB, 0x39, 0x36, 0x51, 0x6F, 0xC0, 0x51, 0x65, 0x80, 0x51, 0xE2, 0xF1, 0xB4, 0xC2, 0xA7, 0x21,
-    0x2F, 0x3E, 0xBD, 0xE7, 0x91, 0xF5, 0x41, 0xF5, 0x32, 0x58, 0xE7, 0x0A, 0x4A, 0x03, 0xB4, 0x88,
-    0x85, 0xB9, 0x98, 0x86, 0x20, 0x1B, 0x7A, 0xC5, 0x06, 0x8D, 0xDB, 0xD7, 0x27, 0x4E, 0xF2, 0x51,
-    0x5E, 0x1D, 0x52, 0x8F, 0x18, 0x27, 0x9B, 0xAA, 0xCF, 0xCD, 0x67, 0x5A, 0x6E, 0x99, 0x7B, 0x62,
-    0x93, 0x95, 0x0E, 0x62, 0xD2, 0xBF, 0xB4, 0x6A, 0x98, 0x88, 0xE8, 0xEA, 0x1C, 0x12, 0xD4, 0x79,
-    0x81, 0x2F, 0x1E, 0x81, 0x7C, 0x16, 0x57, 0x9D, 0x75, 0x29, 0xD0, 0xAA, 0x9A, 0x54, 0x7E, 0xFA,
-    0x9E, 0x14, 0x71, 0xC3, 0x32, 0x80, 0xF1, 0x58, 0xD6, 0xDF, 0xE6, 0xC1, 0x5B, 0x22, 0x6E, 0xFF,
-    0x0F, 0xCD, 0x51, 0xC7, 0x72, 0xEF, 0x39, 0xE7, 0x1F, 0x4A, 0x19, 0xC0, 0x37, 0x98, 0x43, 0xD6,
-    0x32, 0x00, 0xCE, 0xCE, 0x62, 0x46, 0x4D, 0x82, 0xBA, 0xD6, 0xD0, 0x4A, 0x15, 0xCE, 0x78, 0xD7,
-    0xCF, 0xA1, 0xFD, 0x80, 0x2A, 0x9A, 0xCF, 0x1C, 0x91, 0xCC, 0x5B, 0x07, 0x78, 0xC9, 0xDF, 0x63,
-    0xC6, 0x77, 0xE8, 0xED, 0x29, 0x5D, 0x2F, 0x4B, 0x24, 0x69, 0x3A, 0xC2, 0xAA, 0x54, 0x0C, 0x3A,
-    0xB3, 0xE3, 0x50, 0x71, 0xDB, 0xE8, 0xEF, 0x36, 0xE5, 0x9E, 0x6C, 0x7D, 0x30, 0x43, 0x7B, 0x26,
-    0x0F, 0x8F, 0x6E, 0xAC, 0xC7, 0x4C, 0xDB, 0x8E, 0xB4, 0xD5, 0x44, 0x03, 0x6A, 0x6D, 0x0C, 0x6D,
-    0x56, 0xC8, 0x6B, 0x58, 0x8F, 0xE2, 0x51, 0xEE, 0x78, 0xAF, 0x72, 0xED, 0x57, 0xE1, 0xD1, 0x33,
-    0x6E, 0x7D, 0xF4, 0xCC, 0x25, 0xFF, 0xE8, 0x99, 0xEE, 0xF8, 0x7C, 0xED, 0xB5, 0xE1, 0xCA, 0x4B,
-    0xD9, 0x0E, 0x19, 0x5D, 0xFF, 0xB1, 0x86, 0x14, 0xC1, 0x7C, 0x3C, 0x08, 0xF9, 0x78, 0x46, 0x07,
-    0x7E, 0xD9, 0x46, 0x07, 0x8E, 0x36, 0x3A, 0xF0, 0x65, 0x1D, 0x1D, 0xE8, 0x6C, 0x74, 0xE0, 0xA4,
-    0xA3, 0x03, 0x5D, 0x47, 0xBB, 0x7D, 0x9B, 0x85, 0xA1, 0xD1, 0x78, 0xD4, 0xB8, 0xDB, 0x5E, 0x92,
-    0xEE, 0x48, 0x45, 0x69, 0xD0, 0x1F, 0x2B, 0xE0, 0xCC, 0xAC, 0x07, 0xC3, 0xDA, 0x36, 0x28, 0x07,
-    0x5A, 0xD4, 0xE7, 0x99, 0xB2, 0xEE, 0x8C, 0x27, 0xD3, 0xDD, 0xC4, 0x1D, 0x43, 0xAF, 0x6F, 0xF4,
-    0xF6, 0xE8, 0x06, 0x6F, 0x2F, 0xFC, 0xDB, 0x63, 0x0D, 0xBE, 0x3B, 0x1F, 0x7A, 0xCE, 0xC7, 0x82,
-    0x8C, 0x88, 0x8D, 0x39, 0x6D, 0xF0, 0x77, 0x7A, 0x3C, 0x19, 0xB3, 0xD0, 0x7D, 0xA2, 0x85, 0x3B,
-    0xFA, 0xEE, 0x74, 0x6D, 0xA9, 0xDC, 0x1E, 0xAB, 0xBC, 0x3E, 0x3A, 0xBA, 0xBA, 0xDC, 0xAF, 0xBE,
-    0xFD, 0xC4, 0x3E, 0xEC, 0x73, 0x25, 0x8C, 0x5C, 0xBC, 0x14, 0x6D, 0x9B, 0x76, 0x21, 0x6A, 0x02,
-    0x20, 0xFD, 0xEE, 0x27, 0xF4, 0x19, 0x66, 0x9D, 0xBF, 0x6B, 0x75, 0x95, 0xBB, 0xC2, 0x94, 0xC4,
-    0xDD, 0x07, 0xA6, 0xBD, 0xBA, 0xA8, 0xBA, 0x4C, 0xDD, 0x45, 0x4E, 0x3F, 0x75, 0x1D, 0x74, 0xBF,
-    0x1A, 0x70, 0x9D, 0xEB, 0x84, 0x3B, 0x6D, 0x09, 0xA4, 0xB1, 0x73, 0x3A, 0xD1, 0xD1, 0xE8, 0x65,
-    0x8E, 0x59, 0xC3, 0xA9, 0xFC, 0x65, 0x48, 0xDF, 0xEC, 0xBE, 0xE3, 0xD2, 0x9F, 0xCE, 0x0B, 0x73,
-    0xEC, 0x15, 0x74, 0x7B, 0x8A, 0x70, 0x0D, 0x45, 0x38, 0x0B, 0x14, 0xCF, 0x11, 0x18, 0x28, 0x2F,
-    0x1F, 0xD5, 0xEA, 0x37, 0x92, 0x1E, 0x73, 0xE9, 0x78, 0x88, 0xA3, 0x76, 0x31, 0x2C, 0x9B, 0x6B,
-    0x0A, 0x5D, 0x3F, 0x8D, 0xA7, 0xF6, 0x0C, 0x82, 0xE2, 0xFA, 0x39, 0x04, 0x25, 0x28, 0xF7, 0xE5,
-    0x3C, 0xAC, 0x68, 0x4C, 0xFA, 0x6B, 0x77, 0xFC, 0xF1, 0x4C, 0xB1, 0x46, 0x8D, 0xEB, 0xE1, 0x41,
-    0xE0, 0x1F, 0x17, 0xBA, 0x2B, 0xA9, 0x2B, 0xF5, 0xE1, 0x32, 0x86, 0x4B, 0x48, 0x18, 0x1C, 0x3E,
-    0xA4, 0xCD, 0xC1, 0x6F, 0x0E, 0x96, 0x77, 0x5B, 0x64, 0xA9, 0x1A, 0xA8, 0xBE, 0xED, 0x2C, 0x1B,
-    0xE1, 0xBC, 0xB6, 0x4D, 0x06, 0xDF, 0x3E, 0x82, 0x5E, 0x46, 0xCB, 0x36, 0xFA, 0x3A, 0xC8, 0x42,
-    0x87, 0x57, 0x11, 0xCC, 0xB1, 0xAA, 0xD7, 0xA2, 0xB3, 0x5E, 0x59, 0x8C, 0x64, 0xBB, 0xCC, 0x05,
-    0x65, 0xCB, 0x05, 0x67, 0x39, 0x10, 0x9F, 0xB9, 0xF4, 0xC0, 0x27, 0xDA, 0xB7, 0x0F, 0x81, 0xFF,
-    0x97, 0x01, 0x07, 0x50, 0x31, 0x25, 0x52, 0xB3, 0x58, 0x4C, 0x62, 0x30, 0x24, 0xEB, 0x44, 0x07,
-    0xC9, 0x22, 0xF9, 0x20, 0x59, 0x3C, 0x58, 0x33, 0x71, 0x24, 0x28, 0x1B, 0x11, 0x3A, 0x6D, 0x3B,
-    0x4B, 0xEC, 0x69, 0xEC, 0xCE, 0xCF, 0x92, 0x22, 0x4E, 0x12, 0x3A, 0x96, 0xB3, 0x7F, 0x67, 0x7D,
-    0x90, 0x83, 0x1C, 0x41, 0xED, 0xEE, 0x73, 0x7C, 0x1E, 0x2D, 0xF2, 0x25, 0x12, 0x42, 0xD9, 0x30,
-    0xB3, 0x78, 0xC2, 0x49, 0xB4, 0x29, 0xC6, 0x23, 0xD5, 0x4D, 0x05, 0x9B, 0xE7, 0x5E, 0xC0, 0xCC,
-    0x2D, 0x1E, 0x3C, 0x0E, 0x04, 0x38, 0x57, 0x9B, 0xB0, 0x98, 0x06, 0xC9, 0xD2, 0xE0, 0xF7, 0x91,
-    0x42, 0x6E, 0xC2, 0xD1, 0xF5, 0x8B, 0x6B, 0xCF, 0x8C, 0xB5, 0x9B, 0x6A, 0xE6, 0x42, 0x58, 0xE8,
-    0x52, 0xC0, 0x77, 0x5C, 0xF4, 0xF1, 0x0A, 0xAF, 0x11, 0x75, 0x39, 0x8A, 0xA9, 0x06, 0x7F, 0x80,
-    0xFC, 0x45, 0x90, 0x00, 0x45, 0x6B, 0x43, 0x22, 0x6E, 0x84, 0xF9, 0xD6, 0xE7, 0x95, 0x28, 0xD4,
-    0x3A, 0x5E, 0x1F, 0xB3, 0xB9, 0xF3, 0xD0, 0x1E, 0xC1, 0xE0, 0x53, 0x88, 0xB3, 0xC2, 0xA7, 0x68,
-    0x92, 0x2D, 0x1F, 0xB0, 0x12, 0x7D, 0x42, 0xA9, 0x56, 0x7A, 0x59, 0x94, 0x2C, 0xD7, 0xDB, 0xFA,
-    0x44, 0xC3, 0xD1, 0xB6, 0xB9, 0xB5, 0x44, 0xB1, 0x61, 0xFC, 0xC1, 0x61, 0x0F, 0xAC, 0x2B, 0xBC,
-    0x7E, 0x8B, 0x63, 0xA8, 0xB5, 0x9E, 0x05, 0x1F, 0x34, 0x93, 0x0C, 0x9A, 0x54, 0x90, 0x7B, 0x5E,
-    0xB9, 0x80, 0x96, 0x64, 0x1E, 0x6F, 0xB1, 0x9B, 0x28, 0xB3, 0x03, 0x05, 0x3F, 0x13, 0x9C, 0x6C,
-    0x82, 0x5E, 0x54, 0xDC, 0x57, 0x82, 0xBC, 0x4D, 0x44, 0xA2, 0xFE, 0x6A, 0xD2, 0x8E, 0x18, 0x16,
-    0x1E, 0xFD, 0x71, 0xF9, 0xD1, 0xCD, 0xE1, 0xF2, 0x35, 0x9D, 0xAF, 0xAD, 0x05, 0xDB, 0x3A, 0xE1,
-    0x5E, 0x9F, 0x21, 0x50, 0x5C, 0xE6, 0x30, 0x04, 0x20, 0xB1, 0x4D, 0xA4, 0x20, 0xCB, 0xE7, 0xFD,
-    0x13, 0x10, 0xA2, 0xB5, 0x1C, 0x72, 0x75, 0x53, 0x85, 0xCA, 0x87, 0x98, 0xB5, 0xD0, 0xD4, 0xBB,
-    0x51, 0x18, 0x13, 0xC1, 0x88, 0x25, 0x15, 0x32, 0x3E, 0xE4, 0x22, 0x66, 0x6C, 0x9E, 0xE3, 0x73,
-    0x00, 0xDA, 0x8A, 0x8D, 0xEF, 0x50, 0x53, 0x98, 0xF3, 0x50, 0xA2, 0x92, 0x0B, 0x15, 0xF0, 0x70,
-    0xD0, 0xDF, 0xE4, 0x94, 0x03, 0x67, 0x0F, 0x23, 0xEB, 0x7C, 0x32, 0x69, 0x9D, 0x90, 0x7D, 0x1B,
-    0x91, 0x6C, 0xAC, 0x78, 0x0E, 0x74, 0x3C, 0xC5, 0x5F, 0xBA, 0x6D, 0x2D, 0xDE, 0x69, 0xDC, 0xB0,
-    0x85, 0x31, 0xB1, 0xC9, 0x53, 0xF6, 0x77, 0xB1, 0x0A, 0x84, 0x59, 0xDC, 0x56, 0xB4, 0xCC, 0x90,
-    0xA3, 0xFF, 0x0F, 0xA3, 0x2B, 0x84, 0x92, 0x63, 0xB4, 0xC4, 0x0C, 0x0A, 0x51, 0xD3, 0xDA, 0x29,
-    0x87, 0xEE, 0x13, 0x66, 0x33, 0xC4, 0x34, 0xFA, 0x09, 0x6D, 0x10, 0x15, 0x7D, 0xDD, 0xD1, 0x65,
-    0xEC, 0x08, 0x69, 0x95, 0xE1, 0xB5, 0x63, 0x0D, 0x3E, 0x51, 0xA4, 0x8C, 0xBB, 0x6C, 0xCB, 0x31,
-    0x70, 0x45, 0x8F, 0x24, 0x14, 0x14, 0xC0, 0xB6, 0x2A, 0xAF, 0xA3, 0xC1, 0x3F, 0x12, 0x72, 0x7B,
-    0xBE, 0x9F, 0x36, 0xBE, 0xE0, 0x98, 0xF3, 0xD9, 0x0C, 0xFA, 0xF9, 0xC1, 0x5A, 0x02, 0xE0, 0x12,
-    0x0F, 0x8B, 0x27, 0x43, 0xD6, 0x1D, 0xB5, 0x34, 0x37, 0x98, 0xF0, 0xF0, 0xEB, 0x46, 0xC9, 0x7F,
-    0xD2, 0x13, 0x86, 0x9F, 0xB1, 0x13, 0x40, 0xDB, 0x83, 0x3A, 0x2A, 0x66, 0xE4, 0xAA, 0x56, 0x5D,
-    0x96, 0x68, 0x4C, 0xBB, 0xE0, 0x66, 0x5F, 0x9F, 0x74, 0x10, 0x3C, 0x69, 0x33, 0x74, 0x97, 0x21,
-    0x83, 0xEB, 0x52, 0x34, 0xEF, 0xC3, 0xED, 0x92, 0x05, 0x97, 0xF2, 0xB6, 0xA3, 0x52, 0x7F, 0x2B,
-    0x3E, 0x8A, 0x79, 0x8C, 0x3A, 0xCC, 0x0F, 0x10, 0x9B, 0xF8, 0x3C, 0x8E, 0x19, 0x55, 0x2A, 0xD7,
-    0x8E, 0xBC, 0xE3, 0x6E, 0x6D, 0x36, 0xE8, 0x60, 0xB3, 0x41, 0xFF, 0x42, 0xF8, 0xA4, 0x13, 0xA6,
-    0xFF, 0x4D, 0xAD, 0xA2, 0xCA, 0x3B, 0x2D, 0xAF, 0xBE, 0xA3, 0xEE, 0xB5, 0xA3, 0x91, 0x0F, 0x02,
-    0xD4, 0xA6, 0x48, 0x2D, 0x13, 0x1B, 0x31, 0x1B, 0xB4, 0x45, 0x57, 0x24, 0x66, 0x83, 0x8E, 0x91,
-    0xD5, 0xF0, 0x8C, 0x86, 0xA1, 0x1F, 0x7A, 0x80, 0x9A, 0x01, 0x99, 0xA6, 0xFD, 0x8C, 0x48, 0xF2,
-    0xFA, 0x3A, 0x28, 0x50, 0x34, 0xC4, 0xFA, 0xF1, 0xC0, 0xAB, 0xA0, 0x22, 0x4C, 0x7F, 0xB7, 0x15,
-    0x03, 0xAC, 0x8D, 0x0A, 0xDE, 0xF4, 0xFA, 0x29, 0x2F, 0xDA, 0x95, 0x3D, 0xED, 0x4A, 0x1F, 0x53,
-    0xB7, 0xAB, 0x1A, 0x48, 0x30, 0x21, 0x11, 0x61, 0x59, 0xDE, 0x5A, 0x67, 0x41, 0xCE, 0x7C, 0x11,
-    0x6E, 0x25, 0xFA, 0xB0, 0xB3, 0x67, 0xD6, 0x98, 0x63, 0x56, 0x6B, 0x7D, 0xF8, 0x81, 0xCF, 0x5C,
-    0x75, 0x5C, 0xA1, 0x3A, 0x13, 0x7C, 0x20, 0xE0, 0x84, 0xEB, 0xC8, 0x9B, 0x9E, 0xC5, 0xC5, 0x36,
-    0x3D, 0x47, 0xEB, 0x94, 0x3A, 0x02, 0xBA, 0x6E, 0xD7, 0x69, 0xD0, 0x5A, 0x23, 0x67, 0x8B, 0xDC,
-    0xFA, 0x94, 0xA8, 0x3E, 0xBA, 0x9A, 0x46, 0x7C, 0xBF, 0x15, 0xC3, 0x58, 0xC0, 0x1E, 0x3E, 0xEF,
-    0x82, 0xDB, 0xD9, 0x73, 0x32, 0xEA, 0x3C, 0x5F, 0x3E, 0xBA, 0x69, 0xE0, 0x33, 0x6A, 0x84, 0xCB,
-    0x03, 0x75, 0x98, 0x2D, 0x92, 0x3C, 0x67, 0x73, 0x9D, 0x7C, 0x9E, 0x02, 0x4A, 0x65, 0xBB, 0xDF,
-    0x74, 0x15, 0x3C, 0x7C, 0xE1, 0xC2, 0x4D, 0xC5, 0xF2, 0x57, 0xE3, 0x01, 0xD3, 0x1F, 0x5D, 0xC9,
-    0xD7, 0x07, 0x34, 0xFF, 0x2D, 0xDB, 0xEA, 0xE3, 0xD0, 0x92, 0xD9, 0xF4, 0xAC, 0xFB, 0xA1, 0x5A,
-    0x08, 0x8E, 0x2A, 0x25, 0xAF, 0x7D, 0x75, 0x6F, 0xDC, 0xC8, 0xAF, 0xEC, 0xC1, 0xE6, 0x40, 0x65,
-    0x85, 0xB6, 0x80, 0xA5, 0x26, 0xD6, 0xDA, 0xD3, 0x1E, 0xCD, 0xD1, 0x78, 0x23, 0x86, 0xFF, 0xF8,
-    0x9F, 0xA5, 0x22, 0x1E, 0x15, 0x0F, 0x32, 0x1B, 0x15, 0x2D, 0xD8, 0x72, 0xED, 0x04, 0x8C, 0xB4,
-    0x95, 0xFB, 0x3A, 0x27, 0xFA, 0x89, 0x7C, 0xF2, 0x72, 0xF0, 0x68, 0x88, 0x79, 0x64, 0x31, 0xDC,
-    0x29, 0x26, 0x61, 0xF1, 0x38, 0xA0, 0x31, 0xBE, 0x16, 0x13, 0xE0, 0xE4, 0x3D, 0x28, 0xB4, 0x54,
-    0x5B, 0x94, 0x61, 0xCF, 0xAE, 0xC0, 0xAF, 0x2C, 0xAB, 0x81, 0xD9, 0x17, 0x0C, 0x2D, 0x1A, 0xF9,
-    0x60, 0x0E, 0x1C, 0xCF, 0x40, 0x68, 0x1F, 0xA1, 0x2F, 0x6A, 0x85, 0x2B, 0xE0, 0x0D, 0xE2, 0x85,
-    0x63, 0x0A, 0x09, 0xB0, 0xF7, 0x2D, 0x1E, 0xCD, 0x21, 0x74, 0xA8, 0x26, 0xCD, 0x1B, 0x5A, 0x7E,
-    0x74, 0x3E, 0x3E, 0x9D, 0xEB, 0xD7, 0x63, 0xE6, 0xDE, 0x7B, 0xCC, 0xDC, 0x07, 0xCD, 0xAC, 0xB7,
-    0x32, 0x65, 0xFF, 0x39, 0xCC, 0xFA, 0x3A, 0x99, 0xB5, 0x00, 0xB3, 0x8A, 0xAB, 0xCF, 0x59, 0xD2,
-    0x38, 0x83, 0xE2, 0x9D, 0xC3, 0x73, 0x03, 0x1F, 0x32, 0x81, 0x0D, 0xF4, 0x38, 0x84, 0x1E, 0xD6,
-    0xA5, 0xA3, 0x36, 0x21, 0x0C, 0x89, 0x53, 0x08, 0x2A, 0x3C, 0x4C, 0xEE, 0x66, 0xCC, 0x4A, 0xE7,
-    0x53, 0xE7, 0x52, 0x83, 0xDF, 0xF5, 0x95, 0x49, 0x67, 0xCC, 0xE1, 0xBC, 0xED, 0x9A, 0x48, 0xE7,
-    0x13, 0xF2, 0x18, 0xC3, 0x4D, 0x9F, 0xB4, 0x0C, 0x29, 0xF8, 0x30, 0x8F, 0x78, 0xC6, 0xC0, 0xAB,
-    0x6B, 0xC7, 0x8F, 0x7F, 0x74, 0x23, 0xEB, 0xCD, 0x8D, 0x32, 0xDB, 0x62, 0x23, 0x03, 0x4E, 0x5E,
-    0xB8, 0xF0, 0xD4, 0xF5, 0x4D, 0xC9, 0xA7, 0xE4, 0x71, 0xDB, 0x74, 0x8E, 0xEC, 0x01, 0xD6, 0x06,
-    0xC1, 0xE7, 0xEA, 0xA7, 0x2A, 0x62, 0x7A, 0x3D, 0xD4, 0x1A, 0x21, 0x01, 0x9F, 0x53, 0x88, 0x1A,
-    0xDA, 0x09, 0xFE, 0xC1, 0xC3, 0xAC, 0x65, 0x61, 0x77, 0x33, 0xB2, 0x63, 0x68, 0x67, 0x81, 0x2B,
-    0x4B, 0xD8, 0x18, 0x1D, 0x2D, 0xB2, 0x15, 0xE6, 0x7D, 0xF3, 0x3E, 0xE7, 0xA1, 0x70, 0xB3, 0x59,
-    0xAF, 0xA3, 0x4C, 0x74, 0x92, 0xC9, 0x3B, 0x5A, 0x40, 0xCB, 0x5F, 0xA5, 0x57, 0xD5, 0xE3, 0x37,
-    0x6F, 0x5E, 0x01, 0x91, 0x61, 0x1F, 0x74, 0xDB, 0xAE, 0xE3, 0x90, 0x35, 0xE5, 0xD5, 0x92, 0x8A,
-    0xC5, 0x2F, 0x34, 0x49, 0xA3, 0x91, 0x92, 0x1B, 0x77, 0xF0, 0x79, 0x72, 0xF9, 0x98, 0x9F, 0xA7,
-    0xD3, 0x1C, 0xCD, 0xC3, 0x4A, 0xE7, 0x7C, 0xDA, 0x81, 0xF8, 0x69, 0xAF, 0x71, 0xE6, 0xB5, 0xCA,
-    0xED, 0x53, 0x72, 0xE6, 0x8F, 0xB2, 0x32, 0x92, 0x11, 0x61, 0x40, 0xAB, 0xC1, 0xD0, 0xBE, 0x65,
-    0xF9, 0xCB, 0x70, 0xB3, 0x78, 0xE1, 0x13, 0x3F, 0x5B, 0xD8, 0x6A, 0xFA, 0xFE, 0x90, 0x33, 0x68,
-    0x98, 0x53, 0xCE, 0x26, 0xC2, 0x47, 0xF5, 0x58, 0x70, 0xA2, 0xE2, 0x2B, 0x60, 0xB3, 0x74, 0x61,
-    0x2A, 0x26, 0xEF, 0x08, 0xF4, 0x7F, 0x36, 0x88, 0xCB, 0x4F, 0x27, 0x1F, 0x58, 0xD8, 0xF1, 0x3B,
-    0x01, 0xEF, 0x3B, 0x12, 0xC4, 0x74, 0x8F, 0xCF, 0xDA, 0x87, 0xB5, 0x05, 0x8E, 0xC2, 0xF1, 0x3D,
-    0x1C, 0xB1, 0x12, 0xE4, 0x84, 0xAE, 0xC2, 0x2E, 0x29, 0x3F, 0xBD, 0x5A, 0x41, 0x93, 0x79, 0x8A,
-    0xF0, 0x7A, 0x4F, 0x47, 0x21, 0x5E, 0x9F, 0xC9, 0xBB, 0x76, 0xF3, 0x87, 0x87, 0x67, 0x4F, 0x1C,
-    0x1E, 0xDE, 0xAB, 0xDD, 0x01, 0x0F, 0xA1, 0x0F, 0x11, 0xD8, 0xEC, 0x08, 0x00, 0x26, 0xD1, 0x06,
-    0x83, 0x62, 0xD4, 0xBA, 0x45, 0x6B, 0x3A, 0x28, 0xB5, 0xDF, 0xC3, 0x57, 0x7E, 0x30, 0xCC, 0x6A,
-    0xC8, 0x27, 0x4E, 0x47, 0x11, 0x38, 0xB3, 0xBE, 0x6F, 0xE8, 0x83, 0x6D, 0xE9, 0xAE, 0x18, 0x32,
-    0x58, 0xF9, 0xC4, 0x81, 0x95, 0x47, 0xE9, 0x8E, 0x6D, 0x9C, 0xCF, 0x5A, 0x46, 0xBB, 0x57, 0x20,
-    0x5E, 0x4D, 0xBB, 0xEA, 0x29, 0xEB, 0xF7, 0xB0, 0x86, 0x9C, 0xBF, 0x03, 0xA8, 0x47, 0x1C, 0xAB,
-    0xC6, 0xD3, 0xA5, 0x72, 0xF4, 0x43, 0xC6, 0xC3, 0x0D, 0x70, 0xBC, 0x8F, 0xFA, 0x91, 0x4D, 0xFF,
-    0xBC, 0x09, 0x8A, 0x69, 0x73, 0xDD, 0x91, 0x91, 0x85, 0x55, 0x73, 0x06, 0xC1, 0x07, 0x39, 0x41,
-    0xB1, 0xDB, 0x2B, 0x9D, 0x57, 0x78, 0x34, 0xB1, 0x18, 0x7D, 0xBF, 0xBA, 0x66, 0xDE, 0xEF, 0x31,
-    0x7C, 0x7A, 0x45, 0xA8, 0x7F, 0xE9, 0x47, 0xC9, 0x02, 0x1D, 0x0A, 0xFB, 0xAA, 0x0F, 0x27, 0xFF,
-    0x28, 0xD9, 0x6D, 0xE5, 0xAE, 0x8A, 0x3B, 0xF9, 0xCE, 0x28, 0xBE, 0xE3, 0x62, 0x05, 0x34, 0x69,
-    0xAF, 0x55, 0x91, 0x1B, 0x6B, 0xC1, 0xA3, 0x38, 0xDC, 0x79, 0xFC, 0x70, 0xE3, 0xDE, 0xF7, 0x40,
-    0x66, 0xA3, 0x07, 0xD8, 0x8B, 0xD1, 0xB7, 0x2E, 0x8B, 0x65, 0xE8, 0x7C, 0x31, 0xB9, 0xF7, 0xCE,
-    0xC2, 0x1B, 0xA3, 0xEB, 0xBF, 0x7E, 0x14, 0xFA, 0xF5, 0x1F, 0x85, 0xEE, 0xAD, 0xAE, 0xC7, 0xCC,
-    0x19, 0xC2, 0xD2, 0xE5, 0xE8, 0x35, 0x5F, 0x70, 0x53, 0xC3, 0x1B, 0xDC, 0xC2, 0x4F, 0xAF, 0xBA,
-    0xB5, 0xA7, 0x9D, 0x0E, 0x6B, 0x0A, 0xB7, 0xF0, 0xBA, 0xD3, 0xA4, 0x70, 0xEF, 0x87, 0x8D, 0x3E,
-    0xBB, 0xA2, 0x76, 0x7B, 0xBE, 0x87, 0xCE, 0x92, 0x08, 0xFF, 0x3A, 0xF8, 0x60, 0x26, 0xA4, 0xFE,
-    0x1F, 0x3F, 0x21, 0xF5, 0x92, 0xF6, 0xE8, 0xE2, 0x2C, 0x96, 0x3A, 0x38, 0x71, 0x80, 0xD8, 0x0E,
-    0x14, 0x89, 0xC6, 0x20, 0xFA, 0xCB, 0x49, 0x01, 0x7F, 0xC0, 0xD8, 0xEB, 0x73, 0x05, 0x6F, 0x85,
-    0x26, 0xED, 0xC6, 0x9A, 0xB4, 0x6D, 0xA8, 0x83, 0x7E, 0xBE, 0x6E, 0x2A, 0xEB, 0x47, 0xE6, 0xD1,
-    0xA1, 0x7B, 0x64, 0xB6, 0x26, 0x6D, 0x05, 0x03, 0xA9, 0x73, 0x34, 0x5F, 0xAD, 0xD3, 0xBA, 0x42,
-    0x0D, 0x46, 0x77, 0xFD, 0xBB, 0xEB, 0xF7, 0xAD, 0x2A, 0x44, 0xBD, 0xE1, 0xA3, 0x91, 0x9F, 0x26,
-    0xEF, 0x4B, 0x5F, 0xAC, 0xE7, 0xC2, 0x5A, 0x2D, 0xCE, 0xFC, 0x43, 0x10, 0x7C, 0x78, 0x4D, 0xDA,
-    0xF5, 0xFE, 0x03, 0x17, 0xCB, 0x98, 0x13, 0x6A, 0x32, 0xCE, 0x09, 0x2F, 0xF8, 0x88, 0xF8, 0xD3,
-    0x7E, 0xB8, 0x85, 0x12, 0x17, 0x57, 0x29, 0xE1, 0xCC, 0x24, 0x5B, 0x78, 0x29, 0xD5, 0x1B, 0xCC,
-    0x0E, 0xAB, 0x22, 0x9A, 0x77, 0xED, 0xDA, 0x1F, 0xF2, 0x21, 0x86, 0xD6, 0x51, 0xB3, 0xB1, 0xCA,
-    0xDF, 0xF0, 0x42, 0xED, 0x2E, 0x9C, 0xFF, 0x80, 0x3B, 0xED, 0x27, 0xEB, 0xB4, 0x9F, 0xAC, 0xD3,
-    0x7E, 0x7C, 0x5F, 0x87, 0x90, 0xED, 0x1D, 0x82, 0xBA, 0x23, 0x5E, 0x37, 0xF7, 0x06, 0x10, 0xF9,
-    0x43, 0xE8, 0xFD, 0xDC, 0xA1, 0x0D, 0x1E, 0xC6, 0x8E, 0x43, 0xD8, 0xDE, 0xFC, 0xA9, 0x97, 0xFF,
-    0x1F, 0xC5, 0x57, 0x3D, 0x8C, 0xE5, 0x56, 0x15, 0x3E, 0xB6, 0x67, 0xC7, 0xC9, 0x58, 0x1A, 0xA7,
-    0x20, 0x52, 0x12, 0x6D, 0xE2, 0x02, 0x8A, 0x45, 0xDA, 0xC1, 0xCD, 0x16, 0x29, 0x76, 0xB9, 0x1E,
-    0xA5, 0x48, 0x41, 0xC1, 0x2B, 0x76, 0x94, 0x82, 0x02, 0x0A, 0x0A, 0xB2, 0x88, 0x9F, 0x22, 0xC5,
-    0x88, 0x1F, 0xD9, 0xCA, 0x36, 0x94, 0x5B, 0xD0, 0xD1, 0x50, 0x4C, 0x91, 0xCC, 0x16, 0x99, 0x62,
-    0x8B, 0x28, 0x84, 0xF5, 0x25, 0x29, 0x68, 0x2D, 0x1A, 0x0A, 0x0A, 0x5C, 0x10, 0x51, 0xA1, 0xB9,
-    0x48, 0x16, 0x38, 0xCB, 0xB5, 0x0F, 0xDF, 0x77, 0xED, 0xB7, 0xBB, 0x93, 0x00, 0x52, 0xA4, 0x4D,
-    0xB0, 0xC7, 0x9E, 0xF7, 0xEE, 0xCF, 0x39, 0xDF, 0xF9, 0xFD, 0xEE, 0xBB, 0xFB, 0x9B, 0x0B, 0x97,
-    0x3C, 0xB3, 0xF3, 0xC6, 0x8B, 0x37, 0x8E, 0xF3, 0x3E, 0xED, 0x8A, 0xE1, 0xA7, 0x7F, 0xFB, 0xF2,
-    0x2F, 0x92, 0xE6, 0xB3, 0xDE, 0x22, 0x72, 0x09, 0xCF, 0xB1, 0x48, 0xD4, 0x8B, 0xA4, 0x56, 0x24,
-    0x8F, 0x4F, 0x4F, 0xBD, 0x51, 0xFD, 0xB0, 0x12, 0x77, 0x4D, 0x5E, 0x4E, 0xAA, 0x97, 0xE4, 0x5A,
-    0xDA, 0x24, 0xD5, 0x46, 0xAE, 0x89, 0x24, 0x95, 0x3C, 0xB9, 0x7F, 0x91, 0x2C, 0xDA, 0xE3, 0x4E,
-    0xE4, 0x9E, 0xC8, 0x0D, 0xE8, 0xC6, 0xDC, 0x83, 0xD3, 0xB7, 0xA0, 0xDD, 0x9E, 0xC9, 0xE5, 0xB8,
-    0x8B, 0x6C, 0x56, 0x5D, 0x96, 0x83, 0xC8, 0xCA, 0xE6, 0x32, 0xD6, 0x03, 0xDD, 0x13, 0xFD, 0xB7,
-    0x63, 0x74, 0xCE, 0x55, 0xFF, 0xA8, 0xFA, 0x77, 0x55, 0xFF, 0xEC, 0xD1, 0x91, 0x7C, 0x6A, 0x00,
-    0xCF, 0xD1, 0x91, 0xE2, 0xFA, 0x27, 0x5F, 0x7F, 0xE6, 0x8B, 0x43, 0x37, 0x4F, 0x71, 0xDD, 0xD5,
-    0x0B, 0x17, 0xAD, 0x91, 0xD3, 0xED, 0xF5, 0x8E, 0xFE, 0x8F, 0x4B, 0x1E, 0x5E, 0x9F, 0x75, 0xFD,
-    0x51, 0x75, 0xF4, 0x23, 0x67, 0xFE, 0xE5, 0xF3, 0x59, 0x13, 0x6D, 0xAD, 0x9E, 0x7F, 0x71, 0x5F,
-    0xFE, 0xF1, 0xD6, 0xDE, 0x09, 0xBD, 0xF1, 0xDA, 0x45, 0x6C, 0x1C, 0xBA, 0xF9, 0x10, 0x9F, 0xB9,
-    0x30, 0xF7, 0x80, 0x96, 0x31, 0xC7, 0x32, 0x9B, 0xBB, 0x7C, 0xC8, 0xC6, 0xD4, 0x27, 0xB3, 0x68,
-    0xD5, 0xDA, 0x72, 0xC8, 0xE6, 0x48, 0xAB, 0x17, 0xC2, 0xA6, 0xB2, 0x31, 0xE1, 0x6B, 0x53, 0x77,
-    0x25, 0x96, 0x61, 0x91, 0x8F, 0xA7, 0x68, 0x92, 0xE7, 0x30, 0x37, 0x45, 0x6A, 0x8D, 0xCB, 0x7D,
-    0xAC, 0x82, 0x79, 0x6B, 0xBA, 0xC2, 0xE5, 0x2E, 0x73, 0xF2, 0x6B, 0xEE, 0xEB, 0xEA, 0x41, 0x7B,
-    0xB5, 0x6A, 0x5B, 0x4C, 0x94, 0x7D, 0xEE, 0xD2, 0x11, 0xDB, 0x7E, 0xBE, 0x62, 0xC9, 0x6C, 0x50,
-    0x0B, 0x89, 0xD8, 0x31, 0x52, 0x39, 0xD5, 0x07, 0x00, 0x2A, 0xAD, 0x25, 0x88, 0xD2, 0x65, 0x33,
-    0x35, 0x1F, 0x12, 0x0A, 0xC1, 0xBC, 0x8E, 0xBB, 0xED, 0xDA, 0xAE, 0x1C, 0xCB, 0x31, 0x9D, 0xD3,
-    0x65, 0xAA, 0xB6, 0x50, 0xDC, 0x9B, 0xBE, 0x70, 0x05, 0x85, 0x0D, 0x29, 0x84, 0x25, 0x3E, 0x19,
-    0x85, 0x37, 0x10, 0x8E, 0xA9, 0x66, 0x73, 0xA2, 0x29, 0x9E, 0x64, 0x8E, 0x35, 0x99, 0x92, 0x99,
-    0xBA, 0xF2, 0x31, 0x1F, 0xB8, 0xC5, 0x74, 0xC6, 0xB6, 0x4D, 0x2B, 0xB3, 0x5C, 0x91, 0x93, 0xC5,
-    0xE0, 0xAE, 0x6C, 0x00, 0xDD, 0x05, 0xF0, 0xBF, 0xA3, 0x01, 0xDA, 0xC0, 0xC9, 0x8D, 0xE9, 0x00,
-    0xAA, 0x37, 0x5D, 0x8E, 0x5D, 0x50, 0x32, 0x44, 0x53, 0xE2, 0x61, 0xCE, 0xFB, 0x8B, 0x3D, 0x3F,
-    0x44, 0xD9, 0x18, 0x54, 0x69, 0x3E, 0xA0, 0x4C, 0x3C, 0x06, 0x66, 0x3C, 0x35, 0x06, 0x0B, 0x2B,
-    0x7A, 0xF7, 0x81, 0x9A, 0x35, 0x43, 0xFF, 0x7A, 0x62, 0x76, 0xCF, 0x24, 0x47, 0x82, 0xA7, 0x58,
-    0x1D, 0x8F, 0xF4, 0x22, 0x57, 0x52, 0x31, 0x0B, 0xDC, 0x2D, 0xDB, 0x23, 0x6E, 0x6F, 0x11, 0x1D,
-    0x83, 0xFA, 0x2B, 0x30, 0x98, 0x51, 0xE6, 0x33, 0x41, 0xD5, 0xEE, 0x5F, 0x64, 0xD1, 0x05, 0x5F,
-    0xAD, 0xCA, 0xF2, 0x7E, 0xD5, 0x16, 0xE1, 0x1B, 0xD5, 0x25, 0x50, 0xE5, 0x0B, 0xBC, 0xFA, 0x9F,
-    0xBC, 0xE2, 0xBE, 0x1F, 0x50, 0x40, 0x9E, 0xAC, 0xCB, 0x4B, 0xB7, 0x4A, 0x8F, 0xF9, 0x0D, 0x01,
-    0x8B, 0x7F, 0x59, 0x1E, 0x7E, 0x0F, 0xC5, 0xA5, 0xAE, 0xC6, 0xEB, 0x4D, 0x3D, 0x3F, 0x9F, 0x22,
-    0x60, 0xDA, 0x48, 0x32, 0x3E, 0x94, 0x8E, 0xE5, 0x09, 0x51, 0xE5, 0x63, 0xC8, 0x0A, 0x22, 0x89,
-    0xB0, 0x74, 0x54, 0xAD, 0xF5, 0x1C, 0x25, 0x38, 0xA8, 0xCF, 0x46, 0xD9, 0x81, 0x61, 0x70, 0x41,
-    0xDD, 0x4B, 0xAA, 0xBD, 0xD4, 0xDA, 0xA7, 0xC0, 0x00, 0xA1, 0xBF, 0x07, 0x9E, 0x5A, 0xA7, 0x54,
-    0x27, 0xA9, 0x27, 0x49, 0xA7, 0xD0, 0x52, 0x42, 0x8F, 0xA9, 0xF4, 0x4F, 0xD0, 0xD9, 0x4E, 0xDA,
-    0x9D, 0x48, 0x54, 0xC9, 0x97, 0x92, 0x49, 0xDA, 0x0F, 0xD5, 0xD6, 0x4E, 0x5D, 0xE9, 0xCD, 0x90,
-    0x6B, 0x3E, 0xC6, 0x5A, 0x9D, 0xC8, 0xF3, 0x9C, 0xC5, 0x9F, 0x6C, 0x00, 0x1F, 0x6E, 0x4E, 0x7D,
-    0xED, 0xA4, 0xF4, 0x82, 0x2A, 0x70, 0x62, 0xBC, 0x14, 0xE1, 0xFF, 0x28, 0xC5, 0xD4, 0x76, 0x62,
-    0xB0, 0x64, 0x7C, 0x5E, 0x64, 0xAF, 0x92, 0xDD, 0x3B, 0x8F, 0x54, 0xD8, 0x9B, 0xFF, 0xA1, 0xA5,
-    0x36, 0xB7, 0xFC, 0xF5, 0xF4, 0xFF, 0xD7, 0x52, 0xEF, 0x5C, 0x31, 0x53, 0xF2, 0xC5, 0xB4, 0x54,
-    0xE4, 0xB8, 0xDC, 0x97, 0x58, 0x9B, 0xEC, 0x07, 0xFD, 0xC1, 0xD5, 0xE3, 0x37, 0xAE, 0xBE, 0xB8,
-    0xB9, 0x7A, 0x49, 0xAE, 0xCA, 0x13, 0xFE, 0x63, 0xA6, 0x22, 0x55, 0xAF, 0x1F, 0xC0, 0xC2, 0xAC,
-    0x92, 0xE4, 0x03, 0x18, 0x3C, 0xDC, 0xBB, 0x75, 0xEA, 0x0F, 0x5A, 0xF5, 0x07, 0x67, 0xE2, 0xEE,
-    0x9D, 0x61, 0xEC, 0x0C, 0x73, 0x67, 0x58, 0x73, 0x86, 0xB5, 0x67, 0xD8, 0xF2, 0x79, 0x3D, 0xE1,
-    0xDA, 0x41, 0x5E, 0x1E, 0x5F, 0x47, 0xD0, 0x9D, 0xA4, 0xB7, 0xAD, 0xBC, 0x04, 0xCF, 0x1F, 0x9B,
-    0xD3, 0xB7, 0x8F, 0xC1, 0x29, 0xF8, 0xBC, 0x8F, 0xB1, 0x7D, 0xCC, 0xED, 0x63, 0xCD, 0x3E, 0xD6,
-    0xEE, 0x63, 0xC7, 0xE7, 0xF9, 0xAC, 0xD7, 0x53, 0xDB, 0x0F, 0x1B, 0x3C, 0xBF, 0x5D, 0x3F, 0xB7,
-    0x28, 0xC9, 0xD4, 0x2F, 0x9F, 0x0B, 0xF5, 0x6B, 0xA5, 0xB3, 0xD6, 0xCE, 0xFD, 0x52, 0x80, 0xA1,
-    0x06, 0xD1, 0x13, 0xD8, 0x16, 0xC2, 0x0E, 0xF4, 0xD7, 0xD0, 0x0A, 0x58, 0xDE, 0x13, 0x3E, 0xB1,
-    0x07, 0x85, 0xED, 0x8E, 0xB5, 0xD4, 0xAC, 0xAB, 0x9A, 0xDC, 0x25, 0xAB, 0x5C, 0x0C, 0xA3, 0x69,
-    0xDA, 0x55, 0xD6, 0x80, 0xBE, 0x38, 0x6D, 0x29, 0x02, 0xED, 0x0D, 0xE5, 0xBE, 0x09, 0xCD, 0x46,
-    0x1B, 0xDC, 0x01, 0x50, 0x3D, 0xC5, 0xFA, 0x2D, 0x9F, 0xB9, 0x1C, 0x80, 0x72, 0x9D, 0xD0, 0x5D,
-    0x6C, 0x5D, 0xA1, 0xA2, 0x05, 0xA0, 0x52, 0x1D, 0x93, 0x91, 0x80, 0xF0, 0x0C, 0xF1, 0x7B, 0x62,
-    0x42, 0xC3, 0x27, 0x1B, 0x20, 0xD5, 0x27, 0x02, 0x7A, 0x05, 0x0F, 0x50, 0x14, 0x3D, 0x01, 0x05,
-    0x50, 0x68, 0x52, 0x01, 0x50, 0x6B, 0x89, 0x35, 0xE7, 0x50, 0xFD, 0xC1, 0x0C, 0x50, 0x01, 0x27,
-    0x00, 0xB1, 0xE6, 0x43, 0xD3, 0x23, 0x20, 0xD3, 0x73, 0x15, 0x26, 0xD1, 0x88, 0x79, 0x5B, 0x1A,
-    0x40, 0x40, 0x91, 0x7E, 0x83, 0x0E, 0x72, 0x42, 0x40, 0x78, 0x3A, 0xE1, 0x2E, 0x00, 0xC2, 0x83,
-    0x89, 0x0C, 0xBB, 0xE2, 0x07, 0x78, 0xDE, 0x63, 0x9F, 0xB4, 0xF2, 0x5F, 0xAF, 0x21, 0x0E, 0x0C,
-    0x91, 0x4F, 0xB9, 0x2F, 0x07, 0xD3, 0xD7, 0x56, 0xAB, 0xFB, 0xAC, 0x95, 0x65, 0xAE, 0xC7, 0xAC,
-    0x4F, 0x34, 0x9B, 0xB0, 0xC2, 0xE7, 0x53, 0x31, 0xE6, 0xDE, 0x38, 0xAE, 0x33, 0x7D, 0x6B, 0xB9,
-    0x56, 0x0F, 0x67, 0xB9, 0x8F, 0xCE, 0x7B, 0x45, 0xBE, 0xB3, 0x95, 0x78, 0x43, 0xBE, 0x2E, 0x5F,
-    0x13, 0xB2, 0x1E, 0x6E, 0x9F, 0xF9, 0x74, 0x0A, 0x04, 0x84, 0xFB, 0x10, 0x3E, 0xB5, 0x81, 0x16,
-    0xC1, 0x64, 0x75, 0x6F, 0x60, 0x9D, 0x71, 0x2B, 0x79, 0x8D, 0xA4, 0x61, 0xF0, 0xEB, 0x08, 0x61,
-    0x14, 0xF7, 0x9C, 0x3C, 0x4D, 0x61, 0x31, 0x03, 0x07, 0x02, 0x72, 0x19, 0x1C, 0x09, 0x62, 0x4C,
-    0xE8, 0x29, 0x18, 0x37, 0x2D, 0xD3, 0x98, 0x8F, 0x1C, 0x59, 0x99, 0x01, 0xB3, 0x84, 0x06, 0xA8,
-    0x60, 0x64, 0xCB, 0xB5, 0xC5, 0x48, 0xD6, 0x63, 0xB8, 0xBB, 0x0C, 0xE4, 0x8D, 0x3D, 0xF7, 0xB1,
-    0xEB, 0xE9, 0x2D, 0xCE, 0xF7, 0xE5, 0x67, 0xE0, 0x30, 0x63, 0x4B, 0x50, 0x37, 0xE8, 0x57, 0xB1,
-    0x94, 0x02, 0x0A, 0xB8, 0xFF, 0x90, 0x02, 0x60, 0xB0, 0x87, 0xD6, 0x05, 0x29, 0x25, 0xE1, 0x5C,
-    0x50, 0x84, 0xD3, 0x82, 0xB4, 0x15, 0x73, 0x28, 0x19, 0x02, 0x5A, 0x8A, 0xDC, 0x83, 0x3C, 0x26,
-    0x1B, 0x93, 0x4C, 0xE1, 0x6D, 0x86, 0x00, 0xC7, 0x13, 0xD1, 0x57, 0x81, 0x1E, 0x8B, 0xDB, 0x2A,
-    0x1D, 0x25, 0x72, 0x8C, 0x6A, 0x39, 0x88, 0x76, 0x29, 0x44, 0x4D, 0x62, 0x06, 0x41, 0x1F, 0x6F,
-    0x07, 0xB6, 0xF0, 0x7C, 0x42, 0x24, 0x85, 0xC9, 0x62, 0x1A, 0x74, 0xCA, 0xB8, 0x67, 0x25, 0x60,
-    0x04, 0xC7, 0x0C, 0x69, 0x43, 0x73, 0x47, 0xBF, 0x2F, 0xBC, 0xD4, 0x43, 0xB4, 0x6C, 0xF7, 0x24,
-    0x1A, 0x53, 0x91, 0x75, 0x76, 0x42, 0xDB, 0x09, 0xA4, 0xF2, 0x6E, 0x2B, 0x59, 0x17, 0xFB, 0xD2,
-    0x82, 0xA8, 0x87, 0x8C, 0xCE, 0xED, 0x12, 0x9F, 0xF7, 0xE0, 0x47, 0x8D, 0x10, 0x2A, 0x98, 0x4B,
-    0x5A, 0xCB, 0x7B, 0xF2, 0x5A, 0x32, 0x42, 0x55, 0x54, 0xCD, 0x1A, 0x55, 0x58, 0xE1, 0x73, 0x57,
-    0x86, 0x60, 0x94, 0x74, 0x82, 0xCB, 0xBB, 0x76, 0xCA, 0x7A, 0xB0, 0x24, 0x99, 0x33, 0x1B, 0x48,
-    0xD0, 0x45, 0x07, 0xBA, 0x04, 0xD5, 0x22, 0x22, 0xD1, 0x94, 0x59, 0x85, 0x00, 0x1C, 0x22, 0x6C,
-    0x8E, 0xDC, 0xCE, 0x7B, 0xC3, 0x1A, 0x1B, 0x5B, 0xD9, 0x6D, 0xC4, 0x87, 0x3E, 0xF8, 0xE3, 0xAD,
-    0x9F, 0x6F, 0xCA, 0xA5, 0x8D, 0x14, 0x23, 0xFD, 0x02, 0xA7, 0xCE, 0x92, 0x29, 0xAD, 0x36, 0x43,
-    0xAC, 0x16, 0xC6, 0xC1, 0xEE, 0x8C, 0x8E, 0xC7, 0x40, 0x14, 0x56, 0x64, 0x33, 0xCD, 0x06, 0xCF,
-    0x2D, 0x5B, 0xEA, 0x0E, 0x21, 0x47, 0x68, 0x50, 0x06, 0x70, 0x3C, 0x0A, 0xC1, 0x74, 0x11, 0xFD,
-    0x24, 0x70, 0x28, 0x80, 0x94, 0x1D, 0x29, 0x1A, 0x18, 0x0D, 0x61, 0x21, 0xC4, 0xF8, 0x96, 0x3A,
-    0xFA, 0x05, 0x0C, 0xD8, 0x5D, 0xC8, 0x74, 0x80, 0x87, 0x1B, 0x5A, 0xB0, 0x32, 0x14, 0x54, 0x64,
-    0x4F, 0xC4, 0x06, 0x2E, 0xEC, 0x59, 0x38, 0x5F, 0x95, 0xE8, 0x0E, 0xA4, 0x7E, 0xFA, 0x32, 0xFA,
-    0x4D, 0x10, 0xFC, 0xA4, 0xF3, 0xB3, 0x47, 0x8F, 0x1A, 0x16, 0xD4, 0x2D, 0xE7, 0xA5, 0xD0, 0x86,
-    0x8A, 0x41, 0xB6, 0x67, 0x83, 0xE5, 0xAC, 0xB2, 0x36, 0xB1, 0x50, 0xEC, 0xB2, 0xF4, 0x97, 0x68,
-    0xE9, 0x5E, 0xFA, 0xD8, 0xBB, 0x0E, 0x6D, 0xCB, 0x84, 0x1E, 0xB5, 0x34, 0xA4, 0x32, 0xBC, 0x8B,
-    0x00, 0x3B, 0x1C, 0x3C, 0xC2, 0x99, 0x68, 0x29, 0x66, 0xA1, 0xC1, 0xDB, 0x43, 0xCC, 0x56, 0xF4,
-    0xBC, 0x74, 0xC7, 0xE5, 0x1D, 0xC4, 0x69, 0x10, 0xA7, 0x8F, 0x89, 0x8B, 0xFA, 0xC7, 0x9D, 0xF0,
-    0x3A, 0xCE, 0x50, 0x77, 0xA4, 0xD4, 0x26, 0x56, 0xD4, 0xB5, 0x36, 0x68, 0xB3, 0x38, 0xFB, 0xA0,
-    0x9F, 0x8D, 0x38, 0xA5, 0x61, 0xC0, 0x4D, 0xDF, 0xF6, 0xD9, 0x47, 0xED, 0x1F, 0x90, 0xE9, 0x4F,
-    0xB1, 0xB1, 0x9A, 0xD0, 0x70, 0x88, 0x1E, 0x50, 0x88, 0x06, 0x3D, 0x15, 0xC3, 0x30, 0x93, 0xF6,
-    0x32, 0xC3, 0x1B, 0xFA, 0x91, 0x2E, 0xD0, 0x30, 0x83, 0xE1, 0x75, 0x19, 0xEC, 0x03, 0x58, 0xE8,
-    0x41, 0x2F, 0xEF, 0x33, 0x1E, 0x50, 0x10, 0x45, 0x60, 0x45, 0xBE, 0x03, 0x82, 0xDC, 0xFA, 0x44,
-    0x23, 0xA2, 0x91, 0x38, 0x68, 0x21, 0xA9, 0x13, 0x06, 0xA8, 0x61, 0xB2, 0x23, 0x39, 0x98, 0xFC,
-    0x70, 0x33, 0x8D, 0x44, 0x44, 0x19, 0xA4, 0x35, 0xA9, 0x60, 0x49, 0x36, 0x65, 0x08, 0x60, 0x81,
-    0x5F, 0x85, 0x23, 0x0A, 0xC4, 0xF0, 0x7C, 0xE5, 0x60, 0x06, 0xB6, 0x98, 0xD7, 0xD0, 0x04, 0xFA,
-    0xAF, 0x44, 0xBA, 0x54, 0x23, 0xDF, 0x11, 0x0F, 0xF2, 0x40, 0x14, 0x13, 0xE4, 0xC0, 0x98, 0x9B,
-    0x7E, 0xA9, 0xB8, 0x24, 0x1C, 0xCA, 0x80, 0x15, 0x39, 0x86, 0x37, 0x4D, 0x1E, 0x89, 0x1E, 0x87,
-    0xB9, 0x56, 0x99, 0x4D, 0xCB, 0x1B, 0x45, 0x8A, 0x14, 0x02, 0xF4, 0xBD, 0xEA, 0x02, 0x70, 0xA6,
-    0xA0, 0x0B, 0xC5, 0x38, 0x30, 0x9F, 0x90, 0xDB, 0x68, 0xC6, 0xAC, 0x6B, 0xE6, 0x2A, 0x41, 0xEF,
-    0x2D, 0x80, 0x43, 0xCC, 0xFB, 0x08, 0x27, 0x6D, 0xFE, 0x6A, 0x18, 0xE1, 0x19, 0xDB, 0x32, 0xFF,
-    0x06, 0x06, 0x80, 0x4D, 0x0B, 0x9E, 0x6A, 0x5D, 0xFE, 0x51, 0xA8, 0x89, 0x0D, 0xDB, 0x9E, 0x65,
-    0x62, 0xE4, 0x24, 0xC5, 0x91, 0xD8, 0x61, 0x07, 0xFD, 0xBC, 0x24, 0x2C, 0xFC, 0x5C, 0xF6, 0x24,
-    0x45, 0xA6, 0x02, 0xBB, 0x46, 0xD0, 0xB6, 0x18, 0x81, 0xA4, 0x62, 0xC4, 0x92, 0x01, 0x81, 0xC6,
-    0x79, 0xB0, 0x8A, 0x20, 0x19, 0x06, 0xD0, 0xF9, 0xDF, 0x15, 0x79, 0xA1, 0x92, 0x4F, 0xD6, 0x05,
-    0x7C, 0x8F, 0x93, 0x11, 0xEB, 0x0F, 0x36, 0x94, 0x7E, 0x1B, 0x01, 0xD0, 0x2F, 0x33, 0xFC, 0x24,
-    0x6C, 0x0B, 0x17, 0x44, 0x41, 0x69, 0x63, 0xF4, 0x63, 0x31, 0xB7, 0x51, 0x1D, 0xBF, 0x9A, 0xCB,
-    0x8F, 0x5B, 0x64, 0x0D, 0x90, 0xC1, 0xEF, 0x67, 0xB2, 0x0B, 0x7D, 0x17, 0xC5, 0x2F, 0x6C, 0x90,
-    0x57, 0x0B, 0x1F, 0x64, 0xC3, 0xC2, 0x08, 0xF8, 0x21, 0x12, 0x38, 0x21, 0xD6, 0xDB, 0x8F, 0x58,
-    0x81, 0xBC, 0x50, 0xF7, 0x2B, 0x33, 0xAC, 0xDC, 0x10, 0xC8, 0x15, 0xEC, 0x90, 0xF9, 0x85, 0x1F,
-    0x1E, 0x32, 0xC4, 0xB4, 0x72, 0x04, 0x9C, 0xFB, 0x6F, 0x95, 0x94, 0x31, 0x6E, 0xD5, 0x40, 0x10,
-    0x86, 0xC7, 0xB6, 0x9C, 0x95, 0xD8, 0xC2, 0x15, 0x14, 0x20, 0xB1, 0x3D, 0xCD, 0x5E, 0x00, 0x69,
-    0xDF, 0x11, 0x28, 0x40, 0x48, 0x70, 0x88, 0x1C, 0x61, 0x2D, 0x71, 0x01, 0x8A, 0x48, 0x14, 0x14,
-    0x69, 0x28, 0xA2, 0x47, 0x91, 0x13, 0xC0, 0x2E, 0x50, 0xA4, 0xC4, 0x4D, 0x94, 0x32, 0x96, 0x20,
-    0x0D, 0x0D, 0x16, 0x32, 0x61, 0x03, 0x6B, 0x0F, 0xFF, 0xDA, 0xF1, 0x23, 0x4F, 0x11, 0x42, 0xAC,
-    0x34, 0xCF, 0xFB, 0xC6, 0x9E, 0x99, 0x7F, 0x67, 0x3E, 0x9B, 0x08, 0x6B, 0x77, 0x24, 0xC9, 0x23,
-    0x39, 0x1E, 0x44, 0xAC, 0x82, 0xF1, 0xFA, 0xDB, 0x48, 0xF6, 0x63, 0x9F, 0xB1, 0xF5, 0x72, 0x1C,
-    0x49, 0x7F, 0x0D, 0xC4, 0xB6, 0x11, 0x91, 0x57, 0xFA, 0xD3, 0x48, 0x2C, 0x63, 0xD5, 0xAB, 0x91,
-    0x6B, 0xC3, 0x81, 0x34, 0xAF, 0x28, 0x5B, 0xD1, 0xE5, 0xCA, 0x23, 0x91, 0x84, 0x69, 0x98, 0x0B,
-    0x94, 0x73, 0x4F, 0xF2, 0x47, 0x47, 0xFA, 0xA8, 0x23, 0x27, 0xBB, 0x3C, 0x56, 0xAD, 0xEC, 0xAA,
-    0x46, 0x9D, 0xED, 0x9E, 0x19, 0xE6, 0x11, 0x36, 0x94, 0x8F, 0xDC, 0x1E, 0x91, 0x45, 0xAC, 0x83,
-    0xF1, 0x9C, 0x46, 0x23, 0x31, 0x73, 0x2B, 0x18, 0x05, 0x3D, 0xD1, 0x48, 0x24, 0x2E, 0x92, 0xB7,
-    0x86, 0xD7, 0xD3, 0x0E, 0x4A, 0xE6, 0xC9, 0x17, 0xE0, 0x6B, 0x29, 0x43, 0x90, 0x0E, 0xE5, 0x6B,
-    0xAE, 0x35, 0xCA, 0x59, 0xDC, 0xB8, 0xB9, 0xC8, 0xA1, 0xDD, 0x48, 0x82, 0x07, 0x44, 0xEE, 0x91,
-    0x6B, 0x21, 0x07, 0x41, 0x50, 0x56, 0x21, 0xBD, 0x42, 0x6E, 0xF3, 0x85, 0x3D, 0x0E, 0xDB, 0x98,
-    0x5A, 0xB5, 0x16, 0x86, 0x6B, 0x63, 0x92, 0xE7, 0x9C, 0xEB, 0x0A, 0xFD, 0x48, 0xF2, 0xA9, 0xA4,
-    0xF4, 0xEC, 0xB3, 0x59, 0xEE, 0x49, 0x27, 0xC2, 0x1B, 0x62, 0x81, 0x87, 0xA8, 0xEA, 0x27, 0x15,
-    0x16, 0xBB, 0x6E, 0xB3, 0xEB, 0xA7, 0x22, 0xA6, 0xA1, 0x02, 0x75, 0x0C, 0xFA, 0xF2, 0x60, 0x51,
-    0x92, 0x5A, 0xCC, 0xE4, 0x5E, 0x0C, 0x45, 0x14, 0x41, 0xB5, 0xA8, 0xEA, 0x99, 0xF8, 0xB4, 0x23,
-    0x14, 0x12, 0x28, 0xE4, 0x0E, 0x7B, 0xD9, 0xEB, 0xCE, 0xD4, 0xE6, 0xFD, 0x80, 0x16, 0x07, 0x11,
-    0xD5, 0x85, 0x6B, 0x34, 0xD4, 0x2B, 0x9C, 0x7B, 0xB3, 0x24, 0xFE, 0x58, 0x46, 0xD4, 0x7E, 0xCC,
-    0x91, 0xAA, 0x48, 0xBF, 0x21, 0x1B, 0x04, 0x6C, 0xDA, 0xF3, 0xCB, 0x98, 0xF1, 0x34, 0x97, 0x6E,
-    0xEA, 0x0E, 0x39, 0x8F, 0x18, 0xBA, 0x05, 0x97, 0xE1, 0x86, 0xCC, 0xC5, 0x9C, 0xA6, 0x7C, 0x7E,
-    0x3B, 0xE7, 0x23, 0xAE, 0x46, 0x1B, 0xF3, 0x5F, 0xA7, 0x9D, 0x8C, 0xDA, 0x9B, 0x06, 0x75, 0x8B,
-    0x4E, 0xF4, 0xCA, 0x6B, 0xFF, 0x96, 0xC6, 0xE2, 0xFB, 0x87, 0xBE, 0x62, 0xE5, 0x6D, 0x70, 0xC4,
-    0x7F, 0x4E, 0xA2, 0x07, 0xC8, 0x9D, 0x59, 0x19, 0xC0, 0x4A, 0xF3, 0x0F, 0x56, 0x2A, 0x00, 0x05,
-    0x56, 0xFC, 0xC2, 0x4A, 0x79, 0xC9, 0x8A, 0x6A, 0x14, 0x9A, 0x3A, 0x08, 0xC8, 0x34, 0x3E, 0x43,
-    0x73, 0x7A, 0x5C, 0x31, 0x7F, 0xCC, 0x47, 0xB5, 0xE4, 0x56, 0xE8, 0x5F, 0xD5, 0xED, 0x70, 0xB0,
-    0x7C, 0x9E, 0x66, 0x3E, 0xB5, 0x70, 0xC0, 0x49, 0xA0, 0x91, 0xA3, 0x0C, 0x55, 0xAF, 0x6B, 0xDD,
-    0xDC, 0x4F, 0xC0, 0xC8, 0x30, 0xB5, 0x3E, 0x61, 0x87, 0xB3, 0x56, 0x01, 0x40, 0xAC, 0x48, 0xCD,
-    0x23, 0xD1, 0xCC, 0x3D, 0x33, 0xBF, 0x03, 0x68, 0x73, 0x59, 0x50, 0xE0, 0xD8, 0x2B, 0x1E, 0x8B,
-    0x50, 0x75, 0x77, 0x13, 0x59, 0xAA, 0x49, 0x19, 0xEE, 0x8C, 0xA0, 0x22, 0xDD, 0xAB, 0xE7, 0xC9,
-    0xF9, 0x44, 0x57, 0xCE, 0xD9, 0x13, 0x6E, 0x2C, 0xF7, 0x05, 0xC4, 0x97, 0xCB, 0x24, 0x29, 0xBB,
-    0x0E, 0xB9, 0x00, 0xE4, 0x0A, 0x90, 0x5B, 0xD9, 0x65, 0x43, 0xD5, 0x8A, 0x7E, 0x82, 0xFC, 0x78,
-    0x81, 0xFC, 0xC6, 0xDA, 0x1D, 0x40, 0xE4, 0x6A, 0x0B, 0xF2, 0x7B, 0xEB, 0x83, 0x0D, 0xE4, 0xC7,
-    0x0F, 0x69, 0x01, 0x1A, 0xE2, 0x19, 0x2A, 0xC4, 0x36, 0xE4, 0x29, 0x48, 0x85, 0xF2, 0x29, 0xFB,
-    0xF4, 0x6E, 0x6C, 0x43, 0x0E, 0x1D, 0xF9, 0x84, 0xC9, 0x2B, 0x72, 0x9F, 0xA7, 0xD3, 0x5F, 0x85,
-    0x5C, 0xFF, 0x4C, 0x90, 0x9B, 0xEB, 0x90, 0x9F, 0xCD, 0x90, 0x17, 0x09, 0x72, 0x24, 0xBB, 0xBD,
-    0x5E, 0x6F, 0x20, 0x97, 0x71, 0x81, 0x5C, 0xFE, 0x17, 0xE4, 0x3A, 0xA1, 0xCC, 0x64, 0x4F, 0x36,
-    0x90, 0xDB, 0x1A, 0x90, 0xEF, 0x03, 0x57, 0x46, 0x21, 0x7C, 0x04, 0x0E, 0xBB, 0x2D, 0xC8, 0x8B,
-    0xA8, 0x7A, 0xDB, 0x18, 0xC8, 0x48, 0x2F, 0xF7, 0xE6, 0x3B, 0x92, 0x20, 0x37, 0x09, 0xF2, 0xC3,
-    0xBF, 0x40, 0xFE, 0x78, 0x86, 0xDC, 0x5E, 0x81, 0x5C, 0x30, 0x95, 0x2E, 0xC2, 0xD5, 0x92, 0xC1,
-    0xB0, 0x33, 0xA4, 0xF9, 0x0D, 0x55, 0x53, 0x3B, 0x6E, 0xDC, 0x30, 0x10, 0x7D, 0x12, 0xB3, 0x50,
-    0xA1, 0x42, 0x29, 0xD2, 0xF3, 0x08, 0x3A, 0x82, 0x74, 0x04, 0x03, 0x81, 0x2B, 0xDF, 0x20, 0x8D,
-    0x1B, 0xD7, 0x91, 0xBA, 0x5C, 0x20, 0x40, 0xDA, 0x94, 0xF9, 0x14, 0x5B, 0xBB, 0x08, 0xC4, 0x23,
-    0xE8, 0x08, 0xAA, 0x0C, 0xC4, 0x4D, 0x08, 0x58, 0x85, 0x62, 0x70, 0x35, 0x79, 0x33, 0xF4, 0xAE,
-    0x11, 0x02, 0x3B, 0xE0, 0x6A, 0x7E, 0x6F, 0xDE, 0x1B, 0xA2, 0x12, 0x9E, 0xE0, 0xD4, 0x46, 0xA8,
-    0xDD, 0x50, 0xC8, 0xF3, 0xF1, 0x04, 0x74, 0x2B, 0x86, 0x1E, 0x3E, 0xC1, 0x07, 0xD4, 0x82, 0x6A,
-    0x81, 0x93, 0xB1, 0xF8, 0x0A, 0xC8, 0x0C, 0x9E, 0x21, 0xAA, 0x6D, 0x93, 0xDA, 0x5A, 0x64, 0x07,
-    0xB4, 0xC8, 0x08, 0x2D, 0x12, 0xE8, 0xFE, 0x7B, 0x7D, 0x75, 0x76, 0x37, 0xBB, 0xDA, 0x9F, 0xF2,
-    0x48, 0x6F, 0x27, 0xB2, 0xF0, 0x8B, 0xC8, 0x8A, 0xFF, 0xDD, 0x95, 0x95, 0x6D, 0x2D, 0xB9, 0x55,
-    0x30, 0x1A, 0x64, 0x7E, 0x9E, 0x83, 0xD9, 0x49, 0x03, 0x4B, 0x2B, 0x50, 0x9A, 0xAF, 0x94, 0x2F,
-    0xD2, 0x13, 0xEF, 0xD8, 0x31, 0x57, 0x42, 0xC3, 0xA4, 0x69, 0x76, 0x1B, 0xBB, 0x44, 0x7C, 0x06,
-    0xFC, 0x66, 0xE5, 0x39, 0x0B, 0x63, 0x2C, 0x81, 0xF6, 0x64, 0x18, 0x04, 0x16, 0xC4, 0xCA, 0x3E,
-    0x1D, 0x7A, 0x83, 0x1E, 0xCF, 0x41, 0x1F, 0xE4, 0xF1, 0xBB, 0xBA, 0x17, 0x1B, 0x70, 0xB5, 0x1A,
-    0x0A, 0xA4, 0x7C, 0xCF, 0xDC, 0x1B, 0x23, 0x49, 0xC2, 0x64, 0x8C, 0xB5, 0x6A, 0xD7, 0x4A, 0xFA,
-    0x5B, 0xCE, 0x73, 0xCF, 0x36, 0xBD, 0x46, 0x5F, 0xE3, 0x72, 0x6E, 0x8D, 0x12, 0x3B, 0x2E, 0x37,
-    0xBF, 0xDC, 0x33, 0x8D, 0x50, 0x50, 0x0F, 0x97, 0x41, 0xDF, 0x76, 0x6B, 0x73, 0xC9, 0x20, 0xF7,
-    0x12, 0x5F, 0xEE, 0x95, 0xA0, 0x4B, 0xF8, 0x68, 0xF7, 0x52, 0xC6, 0x46, 0x20, 0x7D, 0xCE, 0x5E,
-    0x28, 0xCB, 0x10, 0xEC, 0x4E, 0xC9, 0x64, 0x6E, 0xE3, 0x39, 0x79, 0x8A, 0x7E, 0xFF, 0x86, 0x21,
-    0xA9, 0x7C, 0xC3, 0x46, 0xC4, 0x6C, 0x35, 0x32, 0x79, 0x4A, 0x64, 0xA0, 0x97, 0xE3, 0x02, 0x1B,
-    0x78, 0x9A, 0x31, 0x8C, 0x77, 0xCA, 0xCA, 0xA6, 0x9C, 0xB4, 0x9C, 0xDB, 0x2B, 0xC9, 0x1C, 0xBA,
-    0xDE, 0x55, 0xDC, 0xDF, 0x04, 0xCC, 0x0B, 0xB1, 0x38, 0xC5, 0x56, 0xB0, 0xB3, 0xE7, 0xCF, 0x06,
-    0x98, 0x02, 0xFF, 0xC7, 0xCC, 0xA5, 0x1A, 0xBF, 0x6B, 0x67, 0x63, 0xEC, 0x0D, 0x25, 0xA9, 0x95,
-    0x68, 0xB7, 0x57, 0x9F, 0x42, 0x1B, 0x9D, 0x26, 0x14, 0xF2, 0xE7, 0x29, 0xD5, 0x9B, 0xCF, 0x4B,
-    0x22, 0x2B, 0x01, 0xF8, 0x17, 0xB5, 0xD7, 0x56, 0x52, 0xAD, 0x20, 0x18, 0xB4, 0x14, 0xB2, 0xBD,
-    0x6A, 0x9F, 0x69, 0xC5, 0xA1, 0xCF, 0x94, 0xAA, 0x24, 0x83, 0x25, 0x75, 0xB6, 0x78, 0x8D, 0x3C,
-    0x73, 0x06, 0x27, 0x4B, 0x99, 0x0C, 0x65, 0x1B, 0x14, 0x83, 0x5B, 0xF9, 0x09, 0x78, 0xA7, 0x3B,
-    0xA1, 0x1B, 0x70, 0xDC, 0x7F, 0xEC, 0x59, 0xFB, 0x19, 0x55, 0x56, 0xDA, 0x65, 0x0E, 0x0D, 0xBC,
-    0x8A, 0x2F, 0xB6, 0x7A, 0xB2, 0x98, 0x3E, 0x29, 0x13, 0x8A, 0xD7, 0xB0, 0x94, 0xC9, 0x27, 0x3F,
-    0x23, 0x7B, 0xCE, 0xC5, 0x2F, 0x96, 0xB6, 0x6D, 0x77, 0xF6, 0x6E, 0xF4, 0x19, 0x9C, 0xEC, 0x35,
-    0x98, 0xCC, 0x05, 0xF7, 0xFF, 0x1F, 0xA5, 0x55, 0x3D, 0x6F, 0xD4, 0x40, 0x10, 0x5D, 0xDB, 0x04,
-    0x47, 0x58, 0xD1, 0xD2, 0xA4, 0x43, 0xF8, 0x0F, 0x20, 0xB9, 0x49, 0xBF, 0x17, 0x51, 0xD2, 0x50,
-    0x70, 0x14, 0x54, 0xB4, 0xA4, 0xCA, 0x0F, 0x40, 0xB1, 0xA5, 0xFC, 0x00, 0x52, 0x53, 0xD1, 0x80,
-    0x14, 0xA7, 0xA5, 0x4D, 0x76, 0x93, 0x14, 0x29, 0x63, 0x44, 0x41, 0x99, 0xAD, 0xA1, 0xC8, 0x8A,
-    0x58, 0xCA, 0xA1, 0xAC, 0x77, 0x98, 0x19, 0xDF, 0x39, 0x97, 0x23, 0xA4, 0x80, 0x95, 0x6E, 0xF4,
-    0xE4, 0x5B, 0xCF, 0xC7, 0x9B, 0x37, 0x63, 0x11, 0x09, 0x3A, 0x69, 0x45, 0x36, 0xB7, 0x64, 0x4B,
-    0x47, 0x16, 0xE8, 0x49, 0xD2, 0x11, 0x94, 0xAD, 0x88, 0xC6, 0x2F, 0x14, 0xE0, 0x09, 0x7A, 0xCE,
-    0x16, 0x6C, 0xE5, 0x84, 0xEE, 0x24, 0xC0, 0x7E, 0xA0, 0x21, 0xAB, 0xD8, 0x83, 0x64, 0x9C, 0x8C,
-    0xC4, 0xCD, 0x93, 0xE3, 0x83, 0x0C, 0xFD, 0xC6, 0x80, 0x2F, 0x6A, 0xB0, 0x02, 0xDD, 0x54, 0xD9,
-    0x55, 0x08, 0x31, 0xA8, 0xD3, 0x89, 0x3A, 0xF6, 0xA5, 0x69, 0xD5, 0x91, 0x8B, 0x13, 0xBF, 0x8C,
-    0x9E, 0x0C, 0x7A, 0xF0, 0xE2, 0x5F, 0x01, 0x1E, 0x0E, 0x9F, 0x34, 0xD3, 0x3A, 0xC8, 0xFA, 0xB9,
-    0x7C, 0xB5, 0x59, 0x1D, 0x8F, 0x44, 0xEE, 0xB8, 0x20, 0x3F, 0x57, 0x5C, 0xC7, 0x96, 0x4B, 0x2B,
-    0x98, 0x15, 0x30, 0x44, 0x13, 0xBF, 0x95, 0xB3, 0x87, 0x8C, 0x8B, 0x8C, 0xCD, 0x8D, 0xE2, 0xFE,
-    0x2F, 0xDF, 0x4D, 0x65, 0x9A, 0x7C, 0xDB, 0x17, 0x4F, 0x3B, 0x75, 0xE2, 0xF3, 0x0B, 0x0F, 0xA3,
-    0x12, 0xA0, 0x89, 0x00, 0x5A, 0x8C, 0x8C, 0x94, 0xE5, 0x80, 0xD5, 0x94, 0x14, 0xD1, 0x0D, 0x11,
-    0x1F, 0x08, 0xF1, 0x01, 0x73, 0xAC, 0x62, 0x62, 0xB3, 0x49, 0x03, 0xF2, 0x5A, 0xC5, 0x30, 0x4A,
-    0xF1, 0x7A, 0xD9, 0xE4, 0x8E, 0xAA, 0x2E, 0xB9, 0x20, 0x98, 0x3B, 0xDC, 0x4B, 0x4F, 0x7C, 0xE4,
-    0x2E, 0x09, 0x44, 0x43, 0x04, 0x86, 0x28, 0x29, 0x1B, 0x7A, 0x31, 0x1F, 0x45, 0xF8, 0xD7, 0x92,
-    0x10, 0xCF, 0x85, 0x88, 0x30, 0xA4, 0x44, 0x37, 0x0A, 0xF3, 0x03, 0x40, 0xDE, 0xC0, 0x48, 0x00,
-    0xA7, 0xCE, 0x2E, 0xBD, 0x7E, 0xF7, 0x33, 0x14, 0xD2, 0x4D, 0x96, 0xA5, 0x7B, 0xCD, 0x77, 0x6E,
-    0xF9, 0xAD, 0x48, 0xB7, 0xA9, 0xA4, 0xF3, 0xFA, 0xF4, 0x22, 0x14, 0xE7, 0x57, 0x93, 0x0C, 0xC0,
-    0xC6, 0xD8, 0x70, 0xA1, 0x31, 0x6C, 0x81, 0x39, 0x67, 0x76, 0x51, 0x1B, 0x61, 0x4E, 0x1B, 0x8A,
-    0xC2, 0x5D, 0x05, 0x60, 0x6D, 0xC8, 0x63, 0xAF, 0xC4, 0x9A, 0x3A, 0xAC, 0xFE, 0xA4, 0x2F, 0xDD,
-    0xF6, 0x4F, 0x22, 0x64, 0xCD, 0x15, 0x17, 0x1D, 0x54, 0x7A, 0x81, 0xB5, 0xFE, 0xCE, 0xEA, 0xCB,
-    0x5F, 0xE3, 0x67, 0xB3, 0x06, 0xFF, 0x20, 0xB0, 0x51, 0xD7, 0xF5, 0x8E, 0xE8, 0x29, 0x4D, 0xFD,
-    0xDD, 0x00, 0x1D, 0x3C, 0xC2, 0x68, 0xA9, 0x53, 0xC8, 0xD5, 0xB6, 0x17, 0xA5, 0x55, 0x26, 0x6F,
-    0x13, 0x8F, 0x7F, 0xAA, 0x43, 0xA8, 0xF7, 0x3C, 0x71, 0x7A, 0x4C, 0xB4, 0xD2, 0x58, 0x18, 0x8D,
-    0xE3, 0x43, 0xCC, 0x0A, 0x49, 0x23, 0xA4, 0x48, 0x79, 0xD4, 0x3C, 0x16, 0xE2, 0x3D, 0x7C, 0xD0,
-    0x4C, 0x87, 0xEB, 0x16, 0x70, 0x53, 0x15, 0x38, 0x3F, 0xCA, 0x74, 0x08, 0x8A, 0x16, 0x01, 0x34,
-    0x89, 0xC7, 0xEE, 0x2A, 0x93, 0x76, 0x49, 0xA8, 0xB5, 0x1B, 0x82, 0x12, 0xA8, 0x7A, 0xAD, 0x66,
-    0x93, 0x5E, 0xA8, 0x31, 0x49, 0x96, 0x14, 0x20, 0xDE, 0xE2, 0x2F, 0x9A, 0x0A, 0xB4, 0x19, 0xC6,
-    0x1A, 0xE1, 0x1A, 0x41, 0x9C, 0x53, 0xD5, 0xA0, 0x53, 0x84, 0x9A, 0x60, 0xE1, 0x30, 0x1A, 0x39,
-    0x51, 0x47, 0x50, 0x63, 0x61, 0x2C, 0x9F, 0x13, 0x98, 0x45, 0x01, 0x43, 0x85, 0xCC, 0x56, 0xC3,
-    0x64, 0xD8, 0x18, 0x11, 0xCF, 0x46, 0xCA, 0xF3, 0xF0, 0x70, 0xAE, 0xA7, 0x9F, 0x79, 0x4C, 0xF8,
-    0x36, 0x13, 0xD9, 0xA7, 0xD4, 0xCB, 0x38, 0x82, 0xF7, 0xB5, 0x0E, 0x29, 0x8F, 0x5D, 0xCE, 0xB6,
-    0xFC, 0x8E, 0x3D, 0xD9, 0xD5, 0xFD, 0x70, 0xF6, 0x19, 0xF7, 0x5B, 0x86, 0x6D, 0xC2, 0x56, 0xC0,
-    0xFA, 0xF8, 0xD5, 0x6E, 0x5F, 0xCA, 0x74, 0xA8, 0xFB, 0x6C, 0xA2, 0x7E, 0xE6, 0x37, 0x17, 0x14,
-    0x25, 0x48, 0xD3, 0x18, 0x8B, 0x6E, 0x96, 0xB4, 0xA1, 0x72, 0x87, 0x25, 0xA4, 0x01, 0xB7, 0x50,
-    0x04, 0x56, 0xB7, 0xA8, 0xC5, 0x0C, 0x6C, 0x71, 0x69, 0xF7, 0xB1, 0xB1, 0x5B, 0xD9, 0x57, 0x2F,
-    0x53, 0xBB, 0x2F, 0x85, 0xD8, 0xCA, 0xF0, 0x2E, 0x42, 0x7C, 0xED, 0x80, 0x60, 0x66, 0x0F, 0x18,
-    0xDA, 0xBF, 0x41, 0xC9, 0x30, 0xD0, 0x66, 0x90, 0x96, 0xB2, 0x7F, 0x73, 0x7F, 0xE7, 0x3A, 0x95,
-    0xC7, 0x6C, 0xCB, 0x6A, 0x68, 0xC3, 0x75, 0xEE, 0x3A, 0xD4, 0x9F, 0x60, 0xC4, 0x2B, 0xA7, 0x61,
-    0xDB, 0x92, 0x34, 0xF7, 0xB8, 0x28, 0x11, 0x7A, 0x3B, 0xB7, 0xA2, 0xFA, 0x75, 0x65, 0x36, 0x3E,
-    0x8E, 0xD7, 0xE1, 0x56, 0x5E, 0x85, 0xE2, 0xB5, 0xB7, 0x32, 0xC4, 0xCE, 0x16, 0x33, 0xBB, 0xA3,
-    0x8A, 0x19, 0x1C, 0x8A, 0x27, 0x1E, 0x96, 0x10, 0x2E, 0x45, 0xED, 0x56, 0xF6, 0xA5, 0x55, 0xDF,
-    0xEC, 0x7E, 0x79, 0x08, 0x07, 0xD9, 0x79, 0x9B, 0x22, 0x7D, 0x28, 0x20, 0xA4, 0x0F, 0x43, 0x5A,
-    0x8D, 0xA1, 0x81, 0xE6, 0x3E, 0x01, 0x4A, 0x48, 0xC2, 0x6C, 0x23, 0xF2, 0x8A, 0x9A, 0x9E, 0xD8,
-    0x24, 0x15, 0x2D, 0x4F, 0x89, 0x91, 0x0A, 0x47, 0xFA, 0xD1, 0x26, 0xA1, 0xAD, 0x35, 0x1E, 0xE3,
-    0xD6, 0x62, 0x06, 0x58, 0x09, 0x2D, 0x29, 0x61, 0xAF, 0xE3, 0xE2, 0x81, 0x3D, 0xCD, 0xB6, 0x16,
-    0x33, 0xC0, 0x4A, 0xC0, 0x49, 0x64, 0xD9, 0x95, 0x86, 0xFA, 0x9F, 0x3B, 0xE2, 0x33, 0xB5, 0xF4,
-    0xDD, 0x89, 0xAA, 0xE1, 0xBB, 0xF3, 0x1B, 0xD5, 0x59, 0x3D, 0xAF, 0xDD, 0xE4, 0x1D, 0x7F, 0x6C,
-    0x93, 0x6B, 0x15, 0xAB, 0x72, 0x97, 0xBB, 0x90, 0xC1, 0xDF, 0xA0, 0xFE, 0x08, 0x8F, 0x4B, 0x54,
-    0x31, 0xB0, 0xDC, 0x21, 0x06, 0xA9, 0x19, 0x60, 0xED, 0x55, 0xD5, 0x7C, 0x83, 0xDA, 0x94, 0xA1,
-    0x43, 0x86, 0x64, 0xA0, 0x53, 0x87, 0x76, 0x88, 0xAA, 0xE4, 0x54, 0x2A, 0x0C, 0x1D, 0xCB, 0xB5,
-    0x03, 0x52, 0x19, 0x18, 0xEA, 0x66, 0x28, 0x03, 0x03, 0x56, 0xD5, 0x0A, 0x11, 0x86, 0x58, 0xAA,
-    0x0B, 0xBE, 0x89, 0xED, 0xA7, 0xBF, 0xDF, 0xFF, 0xEF, 0x7B, 0x8E, 0x4F, 0x72, 0x11, 0x84, 0x14,
-    0x50, 0x8F, 0xCE, 0x79, 0xFC, 0xF2, 0xBC, 0xFC, 0xDF, 0x5F, 0x4F, 0x7E, 0xD9, 0x18, 0x73, 0x78,
-    0xC5, 0xD5, 0xC6, 0x44, 0x73, 0x31, 0xE1, 0xC1, 0xBD, 0xEB, 0x5A, 0x63, 0xE2, 0x21, 0x75, 0xC6,
-    0xF8, 0x2E, 0x73, 0xBD, 0x31, 0xB6, 0x8B, 0x5D, 0x69, 0xC2, 0xC9, 0x14, 0xA3, 0x31, 0x55, 0x1D,
-    0x38, 0x7C, 0x06, 0x93, 0xF2, 0x62, 0x3C, 0x8E, 0x9D, 0x89, 0x31, 0x62, 0x77, 0x35, 0x60, 0xDE,
-    0x04, 0xAE, 0x8E, 0x07, 0x6C, 0x9B, 0x0C, 0xCE, 0xF0, 0x5C, 0x9B, 0xF2, 0x40, 0x17, 0xF0, 0xF4,
-    0xAA, 0x2F, 0x00, 0x2A, 0x74, 0xD7, 0x70, 0xAC, 0xB1, 0x23, 0xE6, 0x01, 0xE4, 0x3E, 0xE6, 0x4D,
-    0xE2, 0x70, 0x38, 0xC0, 0x03, 0x12, 0x70, 0x21, 0x58, 0x2C, 0xE0, 0x3C, 0x8E, 0x6B, 0x78, 0x49,
-    0x06, 0x8E, 0xE6, 0xA6, 0x8C, 0xC7, 0x37, 0xB8, 0x08, 0x27, 0x16, 0xDC, 0x00, 0xE0, 0x8D, 0x37,
-    0x78, 0xC0, 0xA3, 0x34, 0x85, 0x9C, 0xCC, 0xB5, 0x29, 0x0F, 0x4C, 0x38, 0xC4, 0x18, 0x8E, 0xAF,
-    0x8F, 0xD8, 0x01, 0x20, 0x96, 0x03, 0x76, 0x8C, 0x81, 0x2B, 0xED, 0x18, 0xCD, 0x98, 0xC5, 0x7C,
-    0x32, 0xA4, 0x3D, 0x06, 0xDB, 0x99, 0xB4, 0xC7, 0x60, 0xBB, 0xA2, 0x35, 0xB6, 0xAD, 0x5A, 0x53,
-    0x34, 0x18, 0x5C, 0x5D, 0xB5, 0x9E, 0x2B, 0xAB, 0x2E, 0x70, 0xA6, 0xE8, 0xA2, 0x09, 0xB4, 0x15,
-    0xC2, 0x81, 0x96, 0x94, 0x97, 0xA0, 0x81, 0x00, 0x2F, 0xF0, 0x97, 0xE7, 0xF9, 0x11, 0x59, 0x33,
-    0xAE, 0x87, 0x7B, 0xD5, 0x28, 0xF4, 0x7E, 0xE1, 0x70, 0x21, 0xCF, 0xEC, 0x98, 0x70, 0xF1, 0x6A,
-    0xD8, 0x6C, 0xBE, 0x6C, 0xDB, 0x21, 0x07, 0xCB, 0xC5, 0xFB, 0x83, 0x70, 0x4F, 0x11, 0x4A, 0xDD,
-    0x3F, 0xBD, 0x41, 0xF8, 0xD4, 0xDB, 0x52, 0x84, 0x76, 0x5F, 0xC5, 0x05, 0x2E, 0x04, 0xEE, 0xD4,
-    0xAB, 0x9C, 0x88, 0xCD, 0x60, 0x4F, 0x3C, 0x53, 0x4E, 0xB5, 0xEF, 0x28, 0x42, 0xD0, 0xD8, 0x53,
-    0x1C, 0x6D, 0x88, 0x05, 0xF6, 0x3D, 0x67, 0x40, 0x6B, 0xD4, 0x41, 0x15, 0x26, 0xE3, 0x4F, 0x60,
-    0x03, 0x16, 0x55, 0x99, 0xED, 0xC1, 0xBA, 0xB4, 0x09, 0xA0, 0x27, 0x75, 0xD4, 0x53, 0x51, 0x46,
-    0x7F, 0x32, 0x32, 0x5B, 0x64, 0xE0, 0x54, 0x3C, 0x25, 0xD8, 0x35, 0x1B, 0xF7, 0x31, 0x21, 0x34,
-    0x91, 0x9B, 0x45, 0x22, 0x16, 0x2C, 0x03, 0xF7, 0x7D, 0x08, 0xCC, 0x88, 0xF2, 0x60, 0xED, 0x44,
-    0x60, 0xBF, 0xAF, 0x30, 0x43, 0x02, 0x20, 0xF2, 0xF8, 0x73, 0x21, 0x24, 0x18, 0x43, 0xA1, 0x27,
-    0x31, 0xDE, 0x06, 0x42, 0x37, 0x99, 0xD9, 0xFF, 0xA4, 0x35, 0xC7, 0x62, 0xD8, 0xE9, 0x4B, 0x22,
-    0xFA, 0x12, 0x8B, 0x48, 0xA0, 0xAB, 0xA2, 0x62, 0xF2, 0xCA, 0xC9, 0xAA, 0xE2, 0x3A, 0x5F, 0xD9,
-    0x77, 0xF8, 0x2A, 0xE9, 0xC8, 0xC8, 0xA8, 0x8F, 0xF1, 0x2A, 0x18, 0x7D, 0x90, 0xE8, 0xCF, 0xC2,
-    0x5B, 0x97, 0x09, 0x52, 0x35, 0x5F, 0xD9, 0x96, 0xAF, 0x12, 0xC1, 0x33, 0x1A, 0x71, 0x58, 0x17,
-    0xCC, 0xE4, 0xBB, 0xEF, 0x08, 0xA5, 0x04, 0x23, 0xF0, 0xAA, 0x68, 0x44, 0x14, 0xA7, 0x79, 0xFE,
-    0x8A, 0xBB, 0x4E, 0x02, 0xDC, 0xBF, 0x65, 0x1C, 0x65, 0x74, 0x54, 0x8B, 0x3C, 0xF7, 0xE5, 0x7E,
-    0x10, 0x02, 0x61, 0x67, 0xF2, 0x90, 0xBA, 0x5F, 0xE7, 0x2F, 0xEF, 0xD9, 0xD9, 0xBC, 0xB5, 0x33,
-    0x30, 0x01, 0x5A, 0x36, 0xC3, 0x86, 0x0C, 0x95, 0xDB, 0x0A, 0x0A, 0xC1, 0xD7, 0xB6, 0x33, 0x1A,
-    0x36, 0x16, 0x2C, 0x76, 0x46, 0xBE, 0x85, 0x6B, 0x3B, 0xF3, 0xCF, 0xB1, 0x33, 0x73, 0x98, 0xE7,
-    0x99, 0x39, 0x00, 0xA2, 0x33, 0xAD, 0x07, 0x47, 0x88, 0xF5, 0xCF, 0x46, 0x90, 0x6F, 0xED, 0x62,
-    0xAD, 0xA5, 0x1C, 0xD9, 0x9A, 0x33, 0xAB, 0x03, 0x6A, 0x22, 0x27, 0x60, 0x2C, 0x50, 0x48, 0xFE,
-    0xE5, 0x4A, 0xF6, 0x7C, 0x28, 0xE3, 0xA4, 0x0F, 0x1F, 0xE8, 0x43, 0xD1, 0xE9, 0x1E, 0x81, 0x28,
-    0xB6, 0x6B, 0x7C, 0xC1, 0xCF, 0xC4, 0xFA, 0xAE, 0x9A, 0xF4, 0xDD, 0x8C, 0x73, 0xB2, 0x58, 0x31,
-    0x10, 0xFF, 0xD3, 0xCA, 0x05, 0xE2, 0xB8, 0xE8, 0x94, 0x3C, 0xE3, 0x5D, 0xD6, 0x1D, 0xBA, 0x9D,
-    0xC8, 0x78, 0xB9, 0x7B, 0xC3, 0x98, 0xAB, 0xB2, 0xA0, 0x92, 0xD5, 0x22, 0x80, 0x56, 0xCF, 0x09,
-    0xA0, 0x27, 0xC0, 0x1F, 0x1C, 0xA5, 0x84, 0x67, 0x62, 0x41, 0xD8, 0xB6, 0xA1, 0xFE, 0x47, 0xA3,
-    0x60, 0x85, 0xE7, 0xA2, 0xCB, 0x5F, 0x39, 0xCD, 0x5F, 0x5C, 0x23, 0xFF, 0x08, 0x25, 0x46, 0x64,
-    0xD1, 0x79, 0x54, 0x25, 0x78, 0x96, 0x8E, 0xAC, 0x10, 0x59, 0xB8, 0x8E, 0xC8, 0x44, 0xEE, 0xA3,
-    0x41, 0x58, 0x0D, 0x79, 0x5F, 0x5E, 0xD8, 0xE7, 0x2B, 0x25, 0x07, 0x4A, 0x49, 0xA4, 0x94, 0x28,
-    0x33, 0x93, 0x35, 0x4B, 0xF6, 0x3E, 0x2A, 0x8C, 0x44, 0xF6, 0x44, 0x0B, 0x09, 0xF2, 0x50, 0x39,
-    0x72, 0x39, 0x59, 0x7C, 0xA6, 0xD0, 0x6F, 0x7B, 0xE5, 0xFF, 0x8F, 0x39, 0x53, 0x7C, 0x29, 0xFF,
-    0x05, 0x72, 0x2A, 0xBC, 0x36, 0x62, 0x3E, 0xD8, 0x3A, 0x6F, 0x36, 0x9B, 0x1B, 0xA9, 0x22, 0x5A,
-    0x28, 0xA2, 0x85, 0x22, 0xFA, 0x1C, 0x67, 0x44, 0x3F, 0x04, 0xF5, 0x53, 0xB3, 0x70, 0x37, 0x52,
-    0xE7, 0x52, 0x69, 0x64, 0x10, 0x17, 0x24, 0xC8, 0x40, 0x91, 0x45, 0x32, 0x6B, 0x60, 0xE2, 0x9E,
-    0x01, 0xEC, 0x0E, 0xCD, 0x23, 0x9E, 0x8A, 0x15, 0x56, 0xB3, 0x3E, 0x7C, 0xAC, 0x28, 0xEA, 0xB2,
-    0x66, 0x2B, 0xD4, 0x33, 0x05, 0x51, 0x6D, 0x51, 0x35, 0x09, 0x5D, 0x03, 0x74, 0xAE, 0xB8, 0x41,
-    0x30, 0x70, 0x8A, 0x41, 0x29, 0x0F, 0x25, 0x1F, 0xE6, 0x6C, 0xAB, 0x1E, 0xB6, 0xDD, 0xB1, 0xD7,
-    0xBB, 0xFA, 0x1F, 0xBE, 0xE4, 0xEA, 0x1B, 0x8B, 0x92, 0xEB, 0xD6, 0x7A, 0x39, 0xC7, 0xA4, 0x9D,
-    0xEF, 0xC4, 0x29, 0xD0, 0x1D, 0xC4, 0x8C, 0x23, 0x70, 0x23, 0x35, 0x61, 0x07, 0x34, 0xCE, 0x5A,
-    0x2C, 0x73, 0x3C, 0x7C, 0xC9, 0xE5, 0x47, 0x5B, 0x96, 0xAE, 0x90, 0x5F, 0x28, 0x81, 0x73, 0x81,
-    0x92, 0x80, 0x92, 0xB8, 0xA7, 0x46, 0xE1, 0x47, 0x5B, 0x09, 0x47, 0x61, 0x85, 0x6D, 0xC9, 0x2B,
-    0xDF, 0x15, 0xB3, 0x97, 0xE7, 0xD0, 0xD5, 0x5A, 0xD9, 0x17, 0x69, 0xAC, 0xAD, 0x84, 0xBF, 0x8B,
-    0x82, 0x90, 0x95, 0x9D, 0xF2, 0x23, 0xDB, 0xF1, 0x63, 0xF7, 0x59, 0x09, 0x03, 0x0E, 0x4B, 0x25,
-    0x27, 0x0F, 0x23, 0x8E, 0xC6, 0xD9, 0xAD, 0x72, 0x4C, 0x0D, 0x54, 0xF6, 0x7A, 0xCA, 0xFF, 0xE4,
-    0xAB, 0xF1, 0x5F, 0x2D, 0x3C, 0x14, 0x01, 0xC2, 0xF3, 0x1D, 0x6F, 0x36, 0x7F, 0x70, 0x93, 0xB2,
-    0xAA, 0x14, 0x38, 0x4D, 0xA4, 0x1E, 0x1C, 0x33, 0x9B, 0x4C, 0x5C, 0x08, 0x3F, 0x6A, 0x3B, 0x67,
-    0x9A, 0xB7, 0x00, 0x41, 0x70, 0x72, 0xA7, 0xF9, 0x4B, 0x12, 0x04, 0x54, 0x8C, 0xDB, 0x98, 0xF0,
-    0x7F, 0xF0, 0x98, 0x42, 0x61, 0xF0, 0x83, 0x4D, 0x37, 0x56, 0x2C, 0x6B, 0x0A, 0x95, 0xC0, 0x1A,
-    0xBC, 0xAB, 0xC9, 0xED, 0xFC, 0x48, 0x0C, 0xB5, 0xB3, 0x7B, 0x23, 0xA4, 0x20, 0xAE, 0x3E, 0xEE,
-    0x43, 0x28, 0x42, 0xD4, 0x07, 0x38, 0x2B, 0xE8, 0x68, 0x72, 0xFE, 0x0D, 0x71, 0xFE, 0xB4, 0x99,
-    0x9D, 0x94, 0x42, 0x51, 0x75, 0x5F, 0x05, 0xA7, 0x1E, 0x7B, 0x59, 0x34, 0xEE, 0x4C, 0x40, 0xCC,
-    0xCA, 0x93, 0x95, 0xEA, 0x7C, 0xE3, 0x79, 0xB7, 0x84, 0x06, 0x7E, 0x83, 0xE2, 0xF3, 0x44, 0xDB,
-    0x82, 0x91, 0x1A, 0x1C, 0x8E, 0xB4, 0xBE, 0x78, 0xB4, 0x33, 0x13, 0x0D, 0x11, 0xCB, 0x20, 0x32,
-    0xEF, 0x15, 0xCF, 0x74, 0x6B, 0xC0, 0x46, 0x44, 0x79, 0x8D, 0x2A, 0xC4, 0x65, 0xEF, 0x8B, 0x7D,
-    0x33, 0xBF, 0x38, 0x92, 0xC3, 0xA9, 0x15, 0xC1, 0xBC, 0xD3, 0x4B, 0x01, 0x1F, 0x8D, 0x4F, 0x3E,
-    0x57, 0x3E, 0xE9, 0x5C, 0xF2, 0xA5, 0x73, 0x1B, 0x51, 0x73, 0xFA, 0xA8, 0x70, 0x5E, 0x02, 0x92,
-    0x4F, 0x1C, 0xC4, 0x68, 0xAA, 0x66, 0x59, 0xCC, 0xD7, 0x1E, 0x8F, 0xD9, 0xBD, 0x26, 0xFF, 0x53,
-    0xF2, 0x9A, 0x2C, 0x95, 0xD7, 0xC8, 0x08, 0xF5, 0xB5, 0x44, 0x48, 0x49, 0x99, 0xA7, 0xF5, 0x91,
-    0xDB, 0xD7, 0x5F, 0x00, 0xC9, 0xBF, 0x6D, 0xFC, 0x5B, 0x9C, 0x01, 0x9C, 0x00, 0x6B, 0x4B, 0x5B,
-    0xBE, 0x9A, 0x5E, 0x1A, 0xD2, 0x4B, 0xCE, 0xBE, 0x32, 0x92, 0xF1, 0xB4, 0xF9, 0x06, 0xA6, 0xDA,
-    0x40, 0xE2, 0x03, 0x7E, 0x6E, 0x08, 0x45, 0x26, 0x9F, 0x3F, 0x70, 0xEF, 0x0E, 0xF6, 0x57, 0xFD,
-    0xF7, 0x83, 0x21, 0xDA, 0x6D, 0x97, 0x1B, 0x8F, 0xE9, 0x4E, 0x89, 0x48, 0xE6, 0x73, 0xE1, 0xBF,
-    0xAA, 0xF7, 0x7B, 0x7F, 0x72, 0x26, 0xB9, 0xDF, 0x79, 0x33, 0x2E, 0x9F, 0x0E, 0xC1, 0x54, 0x3C,
-    0x60, 0xA6, 0x01, 0x75, 0x9B, 0xCC, 0xC5, 0x09, 0x12, 0xB3, 0x43, 0x31, 0x56, 0x63, 0x31, 0xDA,
-    0xFE, 0x82, 0xA6, 0x52, 0xC7, 0xEA, 0x10, 0xEB, 0x1D, 0xCF, 0x22, 0x51, 0xA8, 0x60, 0x71, 0xCD,
-    0xEA, 0xB4, 0xC5, 0x5B, 0x5B, 0xF5, 0xBF, 0x1A, 0xD4, 0x35, 0x4C, 0x4F, 0xAB, 0x45, 0x85, 0xC6,
-    0x8F, 0xC6, 0xCB, 0x8F, 0xB0, 0xC8, 0x07, 0xC4, 0x80, 0x61, 0xA0, 0xF4, 0x26, 0xA8, 0x33, 0xD4,
-    0xDB, 0x1C, 0xBC, 0x39, 0x12, 0x10, 0xF4, 0x13, 0x69, 0x21, 0xF8, 0x19, 0x75, 0x64, 0x0F, 0x01,
-    0x81, 0xAF, 0xB3, 0xB0, 0xA9, 0x22, 0xC7, 0x06, 0x62, 0x13, 0xB8, 0x98, 0x0A, 0x5F, 0xBD, 0x47,
-    0x21, 0x24, 0x9F, 0x8D, 0x22, 0x58, 0x91, 0x6C, 0x25, 0x4A, 0x94, 0x2C, 0xBA, 0x2E, 0xD8, 0x54,
-    0xFD, 0x2E, 0x9A, 0x2C, 0x41, 0x33, 0xDF, 0x3A, 0xC4, 0x13, 0x63, 0xDE, 0x4A, 0x01, 0xF3, 0x1D,
-    0xE7, 0x9E, 0x77, 0xB0, 0xC7, 0x64, 0x70, 0xAF, 0x21, 0x6A, 0x8E, 0x48, 0x99, 0x62, 0xE4, 0x33,
-    0x60, 0x24, 0x94, 0x07, 0xE1, 0x62, 0x0C, 0xE6, 0xC8, 0xC1, 0x34, 0xDC, 0xF5, 0x19, 0xD9, 0x63,
-    0x3C, 0x92, 0xB3, 0xDD, 0xC1, 0xEF, 0x4C, 0x28, 0xBC, 0x31, 0x7F, 0xCC, 0xCC, 0xCF, 0xB3, 0x90,
-    0x09, 0x31, 0x52, 0x87, 0x21, 0xA1, 0x99, 0xC0, 0x61, 0x8E, 0xF6, 0x8E, 0x73, 0xE1, 0x58, 0x20,
-    0x7F, 0xF7, 0xC7, 0x8A, 0xA1, 0x02, 0x63, 0xD2, 0xFB, 0x78, 0x53, 0xE0, 0x4D, 0xF1, 0x37, 0xE7,
-    0x5E, 0x40, 0x4E, 0x0E, 0xC3, 0xE9, 0x53, 0xDA, 0x14, 0x5C, 0x3A, 0xE2, 0x4A, 0x6D, 0x6E, 0x1B,
-    0x7C, 0x0F, 0x45, 0x04, 0x45, 0xFD, 0x9D, 0x8E, 0xF7, 0x60, 0xDB, 0xB7, 0x8B, 0x5D, 0xD4, 0xDA,
-    0x1B, 0xD7, 0x81, 0xE5, 0x4F, 0x32, 0x7A, 0x1A, 0x82, 0x96, 0x00, 0xBE, 0x24, 0x68, 0x1A, 0x47,
-    0x16, 0x31, 0x78, 0xAE, 0xFD, 0xD2, 0x15, 0xCD, 0xD3, 0xAC, 0xE8, 0x74, 0xC5, 0x03, 0x20, 0xBE,
-    0xD1, 0xE4, 0xC7, 0xC5, 0x7A, 0xD1, 0xD4, 0xDA, 0x2D, 0x31, 0x26, 0xD7, 0x10, 0xF6, 0x55, 0x3F,
-    0x9F, 0xDD, 0xCC, 0x33, 0x78, 0x66, 0xFB, 0x70, 0x8C, 0x67, 0x17, 0xB8, 0xAA, 0x46, 0xA9, 0xF4,
-    0xAD, 0x3D, 0x7C, 0x76, 0xEB, 0xD9, 0x9B, 0x8F, 0xA4, 0x27, 0x91, 0x52, 0xAD, 0x1E, 0xFF, 0x4C,
-    0xDD, 0xD5, 0xCD, 0x09, 0x87, 0x23, 0x29, 0x6E, 0x8C, 0xFB, 0xA8, 0x17, 0x5F, 0xE5, 0xC4, 0x68,
-    0xC4, 0x27, 0x15, 0x2D, 0x9D, 0x55, 0x34, 0x8A, 0x29, 0xB8, 0x3A, 0xE9, 0xC5, 0x97, 0x49, 0x5D,
-    0x27, 0x4E, 0x0B, 0xB3, 0xF8, 0xC6, 0xD3, 0x59, 0x76, 0x9B, 0x0E, 0xFC, 0xE2, 0x8E, 0xCF, 0x78,
-    0x5D, 0x88, 0x79, 0x32, 0x57, 0xD1, 0x4A, 0x0F, 0xB3, 0xE9, 0xA0, 0xCD, 0x01, 0x4A, 0x43, 0x13,
-    0xC6, 0xA2, 0x13, 0xF5, 0x3D, 0x7C, 0x99, 0xEF, 0xA2, 0x59, 0x72, 0x4D, 0x77, 0x97, 0x02, 0x4B,
-    0x58, 0x51, 0xD3, 0xFB, 0xD1, 0xED, 0xD9, 0x8E, 0x15, 0x24, 0x8A, 0x40, 0xA9, 0x27, 0x6B, 0xBA,
-    0x59, 0xD8, 0x69, 0x3C, 0x8A, 0x77, 0xC4, 0x02, 0x38, 0x4A, 0x00, 0xA1, 0xCF, 0xC4, 0x1D, 0x60,
-    0x61, 0x41, 0x2C, 0x71, 0x49, 0xBC, 0x67, 0xD5, 0xD0, 0x91, 0x06, 0x6E, 0xF1, 0xA9, 0xC4, 0xC5,
-    0x73, 0xD7, 0x07, 0x89, 0x6F, 0xE2, 0x06, 0x2A, 0x71, 0x00, 0x81, 0x6A, 0xAA, 0x66, 0x9A, 0x9E,
-    0x1B, 0x56, 0x29, 0xCE, 0x92, 0x6F, 0xAE, 0x34, 0xF9, 0x2A, 0xC2, 0x36, 0x93, 0xD8, 0x46, 0x8A,
-    0x87, 0x52, 0xD3, 0x2A, 0x77, 0x8A, 0x2C, 0x24, 0x65, 0xBE, 0xFF, 0x3A, 0x79, 0x30, 0x92, 0x05,
-    0xD5, 0x07, 0xD8, 0x15, 0x4E, 0xB4, 0x13, 0xFB, 0x21, 0xBD, 0xD4, 0xCC, 0x4C, 0xDE, 0x7E, 0xFA,
-    0xBF, 0xBF, 0x25, 0x27, 0x0F, 0x5F, 0xFC, 0x46, 0x41, 0x08, 0x15, 0x4A, 0x10, 0x59, 0x0A, 0x51,
-    0x66, 0x10, 0x44, 0xC2, 0x7C, 0x3D, 0x93, 0x48, 0x1F, 0x48, 0x58, 0x67, 0xBE, 0x92, 0x91, 0x31,
-    0x90, 0xE3, 0xC1, 0x6D, 0xE1, 0xD7, 0x73, 0x37, 0x45, 0xFF, 0x3A, 0xD1, 0x38, 0x56, 0xBB, 0x54,
-    0x42, 0x3B, 0xE0, 0xEC, 0xC8, 0xF9, 0x92, 0x09, 0x3D, 0x73, 0x66, 0xA2, 0x22, 0x8C, 0xEF, 0xE4,
-    0xB6, 0xDD, 0xA6, 0x3C, 0xF4, 0x1C, 0x1D, 0x43, 0x01, 0x6A, 0xFC, 0xDA, 0x68, 0xF7, 0xA0, 0xA0,
-    0x7E, 0xF8, 0xA4, 0x0C, 0xF5, 0x93, 0xC6, 0xBD, 0xB3, 0xD0, 0xD5, 0xA9, 0x75, 0x65, 0xA2, 0x38,
-    0xFD, 0xCA, 0xDB, 0xA8, 0x7B, 0xFC, 0xDA, 0x9F, 0x43, 0x1E, 0x98, 0x25, 0x12, 0xDC, 0x2E, 0x11,
-    0x3D, 0xC4, 0xDC, 0x99, 0x2C, 0x94, 0x06, 0x5B, 0x35, 0xA6, 0x32, 0x93, 0xFD, 0x94, 0x25, 0x5D,
-    0x16, 0xF5, 0x74, 0xAC, 0x52, 0x81, 0x3F, 0xB2, 0xCC, 0x4E, 0x92, 0x00, 0x12, 0xBF, 0xB4, 0x7D,
-    0x2A, 0x84, 0x2E, 0x68, 0x75, 0x30, 0xEF, 0x39, 0x95, 0x35, 0xD9, 0x3A, 0xF3, 0x1C, 0x5F, 0xFD,
-    0x50, 0xEC, 0xAF, 0xB6, 0x4C, 0x17, 0x93, 0x73, 0xC1, 0x7A, 0x47, 0xC8, 0xE5, 0x38, 0x5F, 0xDB,
-    0x1E, 0x39, 0x14, 0x92, 0x89, 0x6F, 0x9E, 0x86, 0x27, 0x62, 0xA9, 0xEC, 0xC8, 0x18, 0x8B, 0x82,
-    0xD2, 0xA2, 0x20, 0xB2, 0xAF, 0x43, 0xB3, 0x7F, 0x33, 0xA7, 0xA7, 0x08, 0x0E, 0x9D, 0xA3, 0x9E,
-    0x9B, 0xB7, 0xA0, 0x0C, 0xCD, 0x5E, 0x47, 0xE9, 0x27, 0x99, 0xF1, 0x31, 0xD5, 0x9A, 0x14, 0xCA,
-    0x32, 0xF9, 0xB3, 0x64, 0xEF, 0xBD, 0x2B, 0xE1, 0x2D, 0x5E, 0x1B, 0x30, 0xD1, 0x7B, 0x70, 0x50,
-    0xB7, 0x1F, 0xC7, 0x2C, 0x94, 0x60, 0xA9, 0xAB, 0x25, 0xE8, 0x34, 0x8C, 0x4D, 0x9B, 0xC7, 0xB9,
-    0x26, 0x81, 0xE6, 0x85, 0xD5, 0x6A, 0xA9, 0x8E, 0x32, 0xF3, 0x8C, 0x8A, 0x26, 0xAC, 0x61, 0x78,
-    0x16, 0x09, 0xF6, 0xDF, 0x9D, 0x7D, 0x88, 0x94, 0x0E, 0xEC, 0x74, 0xEF, 0xB2, 0x32, 0xF0, 0x4A,
-    0x73, 0x9C, 0x91, 0x01, 0x6C, 0x4C, 0x85, 0x0D, 0x57, 0xFD, 0x95, 0xC5, 0x99, 0x45, 0x7D, 0xD6,
-    0xCF, 0x38, 0xF6, 0x9D, 0x8E, 0x3D, 0x0C, 0x2E, 0xF9, 0x01, 0x01, 0x5D, 0xFA, 0x04, 0x3C, 0xF8,
-    0xB3, 0xDD, 0x36, 0x9A, 0x46, 0x36, 0x48, 0xE6, 0xCC, 0x3B, 0xDE, 0xBC, 0x71, 0x4E, 0x4B, 0xA1,
-    0x72, 0x9F, 0x68, 0x3F, 0xE5, 0x75, 0xA7, 0x2D, 0xC4, 0x07, 0xD8, 0x86, 0x85, 0xDE, 0xCF, 0xB6,
-    0x6B, 0x24, 0xE5, 0xCA, 0x96, 0xB4, 0xB0, 0x32, 0xDB, 0x3A, 0x80, 0x37, 0x7F, 0xD9, 0xBC, 0xF9,
-    0xE0, 0x96, 0xF1, 0xC7, 0x25, 0x29, 0x45, 0x82, 0x18, 0xED, 0xD5, 0x0A, 0xC7, 0xA8, 0x30, 0x4A,
-    0xC9, 0xE9, 0xA8, 0x68, 0xCF, 0x9E, 0xC3, 0xB9, 0x62, 0x5B, 0x12, 0x4E, 0x2C, 0x35, 0x36, 0xE5,
-    0xA3, 0x28, 0xAE, 0x16, 0xC8, 0xED, 0x5D, 0xAE, 0xBA, 0x75, 0xBE, 0x18, 0x56, 0x6B, 0x17, 0xEE,
-    0xAA, 0xF2, 0x87, 0x9D, 0x96, 0xAD, 0x9A, 0x5D, 0x0F, 0xD2, 0xFD, 0x3A, 0xFB, 0x49, 0xDA, 0x11,
-    0x52, 0x8D, 0x92, 0x73, 0x87, 0x7A, 0xA9, 0x06, 0x52, 0x82, 0x11, 0x0E, 0x1F, 0x10, 0x81, 0x3D,
-    0x36, 0xA8, 0xBF, 0xA0, 0x82, 0xA7, 0xED, 0xD2, 0xB6, 0x4E, 0xCF, 0x1D, 0x6A, 0xAD, 0xCB, 0x98,
-    0x06, 0x46, 0xD2, 0xF8, 0x69, 0x05, 0x0C, 0x7F, 0x01, 0xC1, 0xA5, 0xCC, 0x7D, 0x9A, 0x35, 0x61,
-    0xE7, 0xD6, 0x5F, 0xDE, 0x82, 0x4A, 0x82, 0x5B, 0xA9, 0x36, 0x4A, 0x89, 0xE2, 0x29, 0x5B, 0xB8,
-    0x0C, 0xAF, 0x93, 0xC0, 0x43, 0x81, 0xEA, 0x43, 0xFD, 0x7D, 0x69, 0xD9, 0xB3, 0x03, 0x5C, 0x4A,
-    0xB7, 0xBA, 0x18, 0xB4, 0x84, 0x2F, 0x26, 0xF6, 0x4D, 0x04, 0x35, 0x5F, 0x9D, 0xE4, 0xB4, 0xC5,
-    0xF5, 0xD1, 0x17, 0x72, 0xEE, 0x16, 0x8E, 0xB1, 0xCA, 0x52, 0x73, 0x80, 0xDF, 0xAB, 0xCF, 0x2C,
-    0x3A, 0x12, 0x63, 0xD0, 0x7C, 0x44, 0xCB, 0x1F, 0xEB, 0x4A, 0xB6, 0xD8, 0x84, 0xE1, 0x85, 0x00,
-    0x74, 0x25, 0xEF, 0xB7, 0x08, 0x6D, 0x31, 0xA2, 0xE7, 0x48, 0xC5, 0x53, 0x34, 0xD2, 0x0E, 0x96,
-    0x85, 0xFD, 0x76, 0xE3, 0xB2, 0xEF, 0xEC, 0xF1, 0xEC, 0x5C, 0x60, 0xE2, 0x4B, 0xE5, 0x06, 0xA6,
-    0x12, 0xA9, 0xEF, 0x19, 0x96, 0xBA, 0x4F, 0xD3, 0x0B, 0xD1, 0xCE, 0xE1, 0xBA, 0xE3, 0x71, 0xE6,
-    0x33, 0xDB, 0xC7, 0x66, 0x9E, 0xB4, 0x17, 0xB2, 0xEA, 0x50, 0x16, 0xF5, 0xAA, 0x79, 0xA3, 0x18,
-    0x68, 0xA9, 0x2B, 0x15, 0xE9, 0xBA, 0x5D, 0x29, 0x07, 0xB5, 0xDA, 0x83, 0x8B, 0xDC, 0xE9, 0xCB,
-    0x2E, 0xFF, 0x11, 0xF8, 0xA2, 0x6D, 0xE9, 0x70, 0x94, 0x72, 0x5F, 0x3A, 0x94, 0x6C, 0x2C, 0x85,
-    0x6C, 0x5F, 0x82, 0x60, 0x69, 0x5B, 0xD3, 0xA1, 0x4C, 0x52, 0xFD, 0x57, 0x0C, 0x84, 0xDA, 0xA1,
-    0x1C, 0x3C, 0xF9, 0x67, 0xA7, 0x66, 0x12, 0x10, 0xBB, 0x4B, 0xB3, 0xB6, 0xBE, 0xEE, 0x6D, 0x6E,
-    0x6B, 0x77, 0xBA, 0x0D, 0xDD, 0xAA, 0xDB, 0x2B, 0x16, 0x35, 0x2D, 0x75, 0xF5, 0x52, 0x63, 0x9F,
-    0xD7, 0xA1, 0x3C, 0x5C, 0x68, 0xBB, 0x70, 0x79, 0xBD, 0xA2, 0xD7, 0x46, 0xDD, 0x2A, 0xA5, 0x0D,
-    0x47, 0x15, 0x46, 0xA3, 0xE7, 0xF7, 0x0B, 0x6D, 0xCA, 0xB1, 0xFA, 0x30, 0xBF, 0x32, 0x4B, 0x87,
-    0xAB, 0xBA, 0x43, 0x93, 0x8C, 0x87, 0x40, 0xF2, 0x41, 0xF1, 0xF8, 0xE0, 0x0D, 0x76, 0x81, 0x37,
-    0x0C, 0x53, 0x40, 0xA7, 0xD2, 0x4E, 0x9C, 0x36, 0x4C, 0x31, 0xC3, 0xEE, 0xED, 0xB4, 0xEA, 0xDE,
-    0x42, 0xBF, 0x81, 0x6E, 0xEA, 0x0E, 0x36, 0xEE, 0x1E, 0x4A, 0x6A, 0x6D, 0x6F, 0x44, 0x5A, 0xD3,
-    0x28, 0x5B, 0x49, 0xDA, 0xCD, 0xA5, 0x64, 0x37, 0xC2, 0x9B, 0x1D, 0xB2, 0x8F, 0xE5, 0x8C, 0x52,
-    0x51, 0xD2, 0x95, 0x5C, 0x14, 0xE3, 0x13, 0x61, 0xD4, 0xFA, 0x37, 0x8A, 0x56, 0x20, 0x75, 0x35,
-    0xEF, 0x72, 0x87, 0xBD, 0xE6, 0xE4, 0x59, 0x2F, 0xBC, 0x5F, 0x3F, 0x9C, 0xD7, 0xE4, 0x9E, 0x8F,
-    0xF4, 0x1F, 0x8B, 0x6D, 0xEB, 0x51, 0xB3, 0x31, 0x2C, 0xBA, 0x78, 0xD6, 0x71, 0xD9, 0x05, 0x73,
-    0xE9, 0xA9, 0x65, 0xFA, 0x1F, 0x83, 0x16, 0x3F, 0xF5, 0xDE, 0x03, 0x3C, 0xDF, 0x91, 0x9E, 0x36,
-    0x67, 0xDA, 0xF0, 0x2E, 0xF5, 0x68, 0x7D, 0x18, 0xD5, 0x3A, 0xDA, 0x75, 0x75, 0xB5, 0xC6, 0x29,
-    0x59, 0x1B, 0x43, 0xF2, 0x45, 0x1D, 0xD7, 0x2B, 0xFC, 0x0B, 0x60, 0xCB, 0x83, 0xA5, 0xB1, 0x9E,
-    0x2D, 0x40, 0xF7, 0x43, 0xB7, 0xE0, 0xAB, 0x18, 0x68, 0x1F, 0xCC, 0xED, 0x3D, 0xD0, 0x8D, 0x9C,
-    0xDC, 0xD0, 0xEA, 0x7E, 0x5E, 0x0C, 0x17, 0xC8, 0xD9, 0xD3, 0x93, 0xAB, 0xD2, 0x79, 0x3D, 0x81,
-    0xD6, 0x22, 0xF4, 0x9C, 0x18, 0x5B, 0x47, 0x1D, 0x2E, 0x71, 0x0B, 0x83, 0x3F, 0x31, 0x41, 0x97,
-    0x96, 0xB8, 0xF8, 0x83, 0x95, 0x32, 0x7F, 0x2C, 0xE4, 0x32, 0x9D, 0xC8, 0xE5, 0xA4, 0xDA, 0x6C,
-    0xDC, 0x66, 0x33, 0x6B, 0x35, 0x78, 0x76, 0x39, 0xC9, 0x73, 0x7E, 0x97, 0x25, 0xCB, 0x06, 0xD9,
-    0xEE, 0x8D, 0xCB, 0x61, 0x71, 0x83, 0x4B, 0xD8, 0x2D, 0x80, 0x16, 0xB0, 0xD0, 0xB3, 0x13, 0xAA,
-    0xC7, 0x82, 0xD2, 0x82, 0xE0, 0x82, 0xAE, 0xF1, 0xD4, 0xBA, 0xCF, 0xA5, 0x61, 0x10, 0x37, 0x01,
-    0xC1, 0x2B, 0x0D, 0x46, 0x69, 0x30, 0x4A, 0x83, 0x51, 0x1A, 0x8C, 0xD2, 0x60, 0x94, 0x06, 0xA3,
-    0x34, 0x18, 0xA5, 0x61, 0x73, 0x1E, 0x0D, 0xB9, 0xD2, 0x60, 0x94, 0x06, 0x6E, 0xB0, 0x92, 0xCB,
-    0x8D, 0xCB, 0x61, 0x71, 0x23, 0x11, 0x6F, 0x01, 0xB4, 0x80, 0x35, 0xF2, 0x5F, 0x25, 0x69, 0x30,
-    0x4F, 0x4C, 0x43, 0xB2, 0xA3, 0x41, 0x4C, 0xB4, 0x8E, 0xE4, 0xB0, 0x36, 0xBE, 0x0F, 0x47, 0xF3,
-    0xB0, 0x4B, 0xAF, 0x81, 0xCC, 0xBB, 0x83, 0xF5, 0xE1, 0xAF, 0x32, 0xD0, 0x50, 0xFD, 0x72, 0x22,
-    0x0D, 0xE9, 0xA7, 0xBD, 0x39, 0x79, 0x1B, 0xC7, 0x34, 0xE6, 0x17, 0x6F, 0x4B, 0x44, 0x90, 0x4B,
-    0xC9, 0x0B, 0xD5, 0x0F, 0x34, 0xA4, 0x1F, 0x0E, 0xA4, 0xA1, 0x7A, 0x7E, 0x06, 0x0D, 0xC8, 0xCA,
-    0xAB, 0xD7, 0xC6, 0xF4, 0x5A, 0x6F, 0xD2, 0x7F, 0x0C, 0x31, 0xFD, 0xC4, 0xC3, 0x0E, 0x05, 0x0A,
-    0x01, 0x2D, 0x60, 0x8D, 0x3C, 0x3D, 0x35, 0x0D, 0xA3, 0xD2, 0x20, 0x71, 0x53, 0xE4, 0x40, 0x1A,
-    0x18, 0x8D, 0xEE, 0x8A, 0x1C, 0x84, 0x06, 0xD6, 0x08, 0x94, 0x03, 0x32, 0x5B, 0xF2, 0x3A, 0x15,
-    0x1A, 0x30, 0x25, 0x34, 0xC0, 0x39, 0x90, 0x06, 0x58, 0x35, 0x69, 0x68, 0x44, 0x0E, 0xEC, 0x5E,
-    0x09, 0x0D, 0x94, 0x03, 0xFF, 0x7B, 0xF3, 0x85, 0x06, 0xCA, 0x41, 0x5A, 0x81, 0x4A, 0x83, 0xFD,
-    0x6A, 0x34, 0x88, 0x4F, 0x0D, 0xA7, 0x6D, 0x5B, 0xF3, 0x5B, 0xBA, 0x3D, 0xDE, 0xB8, 0x07, 0x9B,
-    0xDF, 0x9E, 0xDB, 0x20, 0xE9, 0xF6, 0xDB, 0x87, 0x28, 0x01, 0x0C, 0xFC, 0xFD, 0x65, 0x7A, 0x09,
-    0x54, 0xD9, 0xB6, 0x47, 0x32, 0xCE, 0xFF, 0x48, 0x91, 0x71, 0x76, 0xAC, 0x29, 0x2A, 0x66, 0xE7,
-    0x89, 0x03, 0x79, 0x77, 0xB0, 0x82, 0xFF, 0xA4, 0xF6, 0xD8, 0xA2, 0xBB, 0xFE, 0x0B, 0x4D, 0x90,
-    0xB1, 0x11, 0x83, 0x30, 0x10, 0x04, 0x0F, 0x12, 0x02, 0x02, 0x27, 0xCE, 0x95, 0x3A, 0xA3, 0x04,
-    0xA8, 0xC2, 0xDD, 0x78, 0xAC, 0x2E, 0x5C, 0x83, 0x9B, 0x30, 0x94, 0x80, 0x3B, 0x50, 0xEE, 0xC4,
-    0x01, 0x01, 0x01, 0xD2, 0xF9, 0x4F, 0x82, 0x19, 0x2B, 0x78, 0xED, 0xCC, 0xAF, 0x4E, 0xD2, 0x03,
-    0x7F, 0xEB, 0x72, 0xC0, 0x6B, 0xDF, 0x6B, 0xFA, 0x02, 0x2D, 0x43, 0x81, 0x8E, 0xEB, 0xAE, 0x5C,
-    0x53, 0x51, 0x02, 0xBA, 0x2C, 0xB5, 0x13, 0x9A, 0x2C, 0x75, 0x13, 0xAA, 0x2C, 0x8D, 0xEF, 0x67,
-    0x4E, 0xAA, 0x49, 0xCE, 0xBD, 0x57, 0x0A, 0xF9, 0xED, 0x82, 0x52, 0xC8, 0xD5, 0x99, 0x34, 0x1A,
-    0x6C, 0xA7, 0x94, 0x15, 0x03, 0x7A, 0x29, 0x5C, 0x1C, 0x83, 0x94, 0x34, 0x38, 0xAE, 0x77, 0x03,
-    0x8F, 0x9E, 0xD1, 0x51, 0x77, 0x5B, 0xB7, 0x11, 0x58, 0x99, 0x2B, 0x81, 0x45, 0x0C, 0xB8, 0x73,
-    0xB3, 0x93, 0x11, 0x70, 0x4A, 0xE1, 0x02, 0xEB, 0x47, 0x83, 0x19, 0xA8, 0x98, 0x9C, 0x14, 0x40,
-    0x49, 0x51, 0x0F, 0x73, 0xFC, 0x48, 0x91, 0x04, 0x29, 0x26, 0x25, 0x64, 0xC5, 0x24, 0xC4, 0xF2,
-    0x41, 0xF7, 0x58, 0x0A, 0x34, 0x45, 0x51, 0xD2, 0xB0, 0xCF, 0xE5, 0x76, 0x0C, 0xEA, 0xAC, 0xF2,
-    0x03,
+static const uint8_t bookerly_18_bolditalicBitmaps[45547] = {
+    0xDD, 0xBC, 0x3F, 0xF0, 0x2D, 0xC9, 0x75, 0xDF, 0xF7, 0x99, 0xE9, 0x7D, 0x6F, 0x48, 0x8C, 0xA5,
+    0xDE, 0x60, 0x9F, 0x2C, 0xEE, 0xCA, 0x1E, 0x05, 0xAC, 0x92, 0x8B, 0x65, 0x6A, 0x12, 0x05, 0x0E,
+    0x54, 0xEC, 0x01, 0x37, 0x60, 0xA0, 0x00, 0xCF, 0x55, 0xFB, 0x23, 0xCA, 0x46, 0xB0, 0x0E, 0x90,
+    0x70, 0x55, 0xE5, 0x55, 0xA0, 0x40, 0x01, 0x8D, 0x19, 0x61, 0xAB, 0xC4, 0x80, 0x01, 0xD7, 0x55,
+    0xA4, 0x13, 0x05, 0x44, 0xC0, 0x00, 0x7C, 0x0C, 0xD6, 0x81, 0x22, 0x17, 0x17, 0xD3, 0xBB, 0x5B,
+    0x36, 0x02, 0x04, 0x18, 0x00, 0x66, 0x21, 0x60, 0xB0, 0x43, 0x63, 0xA9, 0x3F, 0x40, 0x80, 0x86,
+    0x30, 0xD0, 0xCE, 0xDB, 0xED, 0x99, 0xAF, 0x82, 0xD3, 0xF7, 0xFE, 0x7E, 0x6F, 0xDF, 0x03, 0x68,
+    0x56, 0x49, 0x86, 0x81, 0x5B, 0xF5, 0x9B, 0xFB, 0xBB, 0x33, 0x73, 0xE7, 0x76, 0x9F, 0x3E, 0x7D,
+    0xCE, 0xF7, 0x9C, 0xF3, 0xED, 0x86, 0x57, 0x68, 0x4E, 0x7C, 0xA6, 0xCF, 0x84, 0x8D, 0x31, 0x31,
+    0x27, 0xB4, 0xA0, 0x88, 0x62, 0xA5, 0xA9, 0xD2, 0x50, 0x8B, 0xFA, 0xC4, 0x1D, 0xB8, 0x8C, 0xCB,
+    0xB8, 0x1D, 0xB7, 0xE1, 0x36, 0x9A, 0xC4, 0xFD, 0x01, 0x7B, 0xB5, 0x89, 0x7E, 0x27, 0x6C, 0x84,
+    0x44, 0x58, 0xF9, 0xD4, 0x00, 0xCF, 0x57, 0xC3, 0xF8, 0xC5, 0xA3, 0xDB, 0xE6, 0x77, 0xE5, 0x73,
+    0x48, 0x7A, 0xE3, 0xE8, 0xB6, 0xF0, 0x8E, 0x9A, 0xDC, 0xAF, 0xE3, 0x17, 0x8F, 0x76, 0x0B, 0x71,
+    0x76, 0xD9, 0xA7, 0x30, 0x7D, 0xE0, 0xDE, 0xB4, 0x87, 0xBC, 0x36, 0xFC, 0xCA, 0x00, 0x1A, 0xC6,
+    0x09, 0xC4, 0x3C, 0x50, 0x09, 0x41, 0x7D, 0x22, 0x70, 0x47, 0x75, 0xE2, 0x24, 0xE9, 0x68, 0x25,
+    0x29, 0x7B, 0x49, 0xCA, 0xF7, 0x5E, 0x7D, 0xFC, 0xB9, 0xE3, 0x15, 0x7C, 0x6A, 0x37, 0xE8, 0x92,
+    0x4F, 0xD0, 0xAF, 0x3E, 0x41, 0xBF, 0x74, 0x2B, 0x0F, 0xC6, 0x3F, 0x1B, 0xFF, 0x72, 0x18, 0x25,
+    0x69, 0x99, 0x25, 0x29, 0xCE, 0x92, 0x34, 0xD9, 0xE3, 0x11, 0x82, 0xEA, 0x44, 0x50, 0x1F, 0xD5,
+    0x09, 0x2E, 0xD7, 0x07, 0xD4, 0x5F, 0xAE, 0xBE, 0xCC, 0xF5, 0x55, 0x27, 0x80, 0x0C, 0xF0, 0x6B,
+    0x00, 0xDD, 0x00, 0xBC, 0x14, 0xA1, 0xD6, 0x09, 0xAD, 0x94, 0x68, 0x25, 0xD1, 0x1E, 0xFD, 0xBC,
+    0xBA, 0xEC, 0xBF, 0x96, 0x2B, 0xB9, 0xF5, 0x64, 0x7E, 0x27, 0x85, 0xA1, 0xDF, 0xFF, 0xB4, 0x1D,
+    0x1A, 0x7D, 0x05, 0x90, 0x06, 0xE8, 0x95, 0xA0, 0x2E, 0xFF, 0x6E, 0x50, 0xDD, 0x9E, 0xF5, 0x3A,
+    0xAA, 0xDD, 0x7D, 0x53, 0x93, 0xEA, 0x14, 0xD6, 0x31, 0x66, 0xBF, 0x77, 0xDB, 0xAF, 0x35, 0x87,
+    0x53, 0xF7, 0xB2, 0x90, 0xBE, 0xAD, 0xC1, 0x4B, 0x1A, 0x90, 0x04, 0x8D, 0x1E, 0x03, 0x3D, 0x80,
+    0x8F, 0x40, 0xB3, 0x02, 0xF5, 0x76, 0x6D, 0x6A, 0x00, 0xE8, 0x07, 0x9E, 0x78, 0xFD, 0x02, 0xC0,
+    0x43, 0xE0, 0x6D, 0x60, 0xCE, 0xD0, 0x64, 0xE8, 0x94, 0x21, 0xAC, 0x54, 0xFA, 0x7E, 0xC6, 0x9D,
+    0xE0, 0xF7, 0x2E, 0xD1, 0x25, 0x98, 0x63, 0x58, 0xD0, 0x80, 0x3B, 0xD0, 0xE0, 0x37, 0xE8, 0x92,
+    0x3B, 0x98, 0x27, 0x98, 0x27, 0x9F, 0x5C, 0x06, 0x77, 0x30, 0xC6, 0x10, 0xC1, 0x6F, 0xEE, 0xAC,
+    0x0F, 0x20, 0x2C, 0x3E, 0xF9, 0x95, 0x87, 0x68, 0xD2, 0x24, 0xE6, 0x5C, 0xEB, 0x73, 0xB9, 0x4D,
+    0x5E, 0xD9, 0x49, 0x71, 0x1C, 0xA4, 0xDC, 0x68, 0x77, 0xBB, 0xDF, 0xBB, 0x54, 0xFF, 0x1F, 0x84,
+    0x38, 0xC7, 0xB0, 0x40, 0x7D, 0xB8, 0x03, 0x0D, 0xD0, 0xAD, 0x5D, 0x72, 0x07, 0x20, 0xE6, 0xC9,
+    0x27, 0xF0, 0xC9, 0x1D, 0x8C, 0x11, 0xE6, 0xC9, 0x6F, 0xEE, 0x84, 0x36, 0x13, 0x16, 0x9F, 0x60,
+    0x8C, 0x68, 0x9A, 0x27, 0xDC, 0x41, 0xAD, 0xCF, 0x65, 0x08, 0x09, 0x27, 0x45, 0x6A, 0x41, 0xA3,
+    0x1D, 0xDA, 0x0D, 0xEA, 0x8F, 0x00, 0x17, 0x79, 0xEA, 0x75, 0xDF, 0xC6, 0xB8, 0xD6, 0x09, 0xC0,
+    0xA8, 0x03, 0xC0, 0xE9, 0x2D, 0x93, 0xDF, 0xDA, 0x25, 0xA0, 0x12, 0x21, 0x02, 0x7E, 0xAB, 0x4E,
+    0x80, 0x10, 0x7D, 0x39, 0xAD, 0x81, 0xE7, 0x69, 0x72, 0xB7, 0x51, 0xAF, 0x74, 0x1F, 0x0A, 0xC6,
+    0xC8, 0xA8, 0xA5, 0x9A, 0x45, 0xAD, 0xAD, 0x92, 0x12, 0xA3, 0x08, 0x3A, 0x68, 0x95, 0x6B, 0x9D,
+    0x30, 0xBF, 0xBF, 0xB7, 0xDF, 0x4B, 0xB4, 0xB9, 0x4F, 0xCF, 0xF5, 0x91, 0xB0, 0x8C, 0x2B, 0x27,
+    0xB5, 0xD0, 0xD2, 0x6E, 0xF8, 0x5C, 0x29, 0x86, 0x48, 0x48, 0xB5, 0xDE, 0x3B, 0x40, 0xD1, 0xE9,
+    0xFB, 0x09, 0x27, 0x1A, 0x09, 0x5A, 0xD1, 0x2A, 0x41, 0xA7, 0xE1, 0x75, 0xAD, 0xD0, 0x4B, 0xD2,
+    0x01, 0xBD, 0xF4, 0xB1, 0xF4, 0x01, 0xAD, 0xCE, 0x5A, 0xDA, 0xE1, 0x06, 0x66, 0x59, 0x7F, 0x5F,
+    0xDC, 0xE1, 0xF9, 0xEE, 0x2F, 0xF4, 0x8F, 0x72, 0x48, 0x7A, 0x39, 0x77, 0x69, 0xFC, 0xE2, 0xD1,
+    0xA6, 0x10, 0x3F, 0xB8, 0x95, 0x42, 0x1B, 0xA1, 0xDB, 0xA0, 0xDF, 0x21, 0x6C, 0x10, 0xD2, 0xED,
+    0x5F, 0xBF, 0x41, 0xB7, 0x83, 0xCF, 0xD0, 0x66, 0x70, 0x27, 0xD4, 0x02, 0x34, 0xC1, 0xB8, 0x40,
+    0x9F, 0xEC, 0xA2, 0x3B, 0xA1, 0xD2, 0x70, 0x7B, 0xB2, 0xCD, 0xE5, 0xCE, 0xB1, 0x3C, 0xDE, 0x9D,
+    0x80, 0xA2, 0x3D, 0xB7, 0x39, 0xCA, 0x87, 0x7E, 0x03, 0x27, 0x60, 0x5E, 0xEC, 0x41, 0x28, 0x82,
+    0xDF, 0x80, 0xFD, 0xEE, 0x50, 0xFD, 0xB3, 0xCB, 0x93, 0x32, 0x54, 0x9A, 0xEE, 0x7E, 0x71, 0xB5,
+    0x2F, 0xD6, 0x1A, 0x60, 0xBC, 0x7E, 0x28, 0x8F, 0xEC, 0xB6, 0xCB, 0x8F, 0x95, 0xB6, 0x5D, 0x4E,
+    0x58, 0x2F, 0x22, 0x84, 0xD5, 0x4E, 0xFA, 0x4F, 0x76, 0x4F, 0xD1, 0xBE, 0x11, 0xD6, 0x27, 0x65,
+    0x12, 0x12, 0x8C, 0xA9, 0xFC, 0x56, 0x04, 0x06, 0x80, 0xE6, 0x4D, 0xA6, 0x79, 0xE8, 0xDB, 0xAD,
+    0xC9, 0x27, 0xF3, 0xF7, 0xE3, 0xA7, 0x67, 0x65, 0x66, 0xC5, 0xF1, 0xE3, 0x3C, 0x7F, 0xFF, 0x5F,
+    0x7C, 0x35, 0x67, 0x7A, 0x9F, 0x98, 0x04, 0x7E, 0x29, 0x7D, 0x0A, 0x11, 0x5C, 0x7E, 0xC6, 0x3F,
+    0xF7, 0x1F, 0xCD, 0xDF, 0xFD, 0xF2, 0x2C, 0xE9, 0x6B, 0x92, 0xF2, 0x28, 0x29, 0xFE, 0xF8, 0x9B,
+    0xE1, 0x57, 0x26, 0xA8, 0x40, 0x83, 0x17, 0x7D, 0x26, 0x24, 0x34, 0xB5, 0x07, 0x61, 0x75, 0x22,
+    0x24, 0x27, 0xDA, 0x15, 0x20, 0xE8, 0xF4, 0xD2, 0xB7, 0xA5, 0x1F, 0x48, 0xF9, 0xC1, 0xCD, 0x0D,
+    0xD5, 0x30, 0xFF, 0xAE, 0x42, 0xD6, 0xBF, 0x57, 0x65, 0xE6, 0xF7, 0xDE, 0x43, 0xB0, 0x3E, 0xDB,
+    0x68, 0xD1, 0x27, 0x8A, 0xE8, 0x68, 0xF3, 0x5F, 0xFF, 0xDA, 0xF4, 0xD7, 0xBD, 0xD6, 0xFD, 0x95,
+    0xD7, 0x1E, 0x5D, 0xEC, 0xD9, 0x3D, 0x80, 0xFB, 0x3A, 0x80, 0x51, 0x9A, 0xA8, 0x25, 0x2D, 0xB4,
+    0x92, 0x12, 0xFD, 0x89, 0x36, 0xC6, 0x8D, 0x71, 0x47, 0x0B, 0x21, 0x3B, 0x45, 0xFA, 0xDC, 0x08,
+    0xFA, 0xDC, 0x0A, 0xFA, 0xEC, 0x0F, 0x08, 0xB9, 0xCB, 0x10, 0x72, 0xC8, 0x10, 0xF6, 0xB0, 0x43,
+    0xD8, 0xC2, 0x06, 0x63, 0x1A, 0x37, 0x90, 0x1D, 0x97, 0x71, 0xA3, 0x56, 0x1C, 0x37, 0x9C, 0x86,
+    0x71, 0xC7, 0x8B, 0x60, 0xAE, 0xF2, 0xAC, 0xB4, 0xD1, 0x49, 0x5A, 0x30, 0xAB, 0xEC, 0xA4, 0x1D,
+    0x18, 0x35, 0x01, 0xD5, 0x43, 0x6B, 0xE7, 0x0B, 0xC0, 0x38, 0xD1, 0x6A, 0xAB, 0x4C, 0x23, 0x84,
+    0xB7, 0xF6, 0x2E, 0xA0, 0x04, 0x21, 0x83, 0x17, 0x34, 0x9F, 0x3C, 0xD9, 0x09, 0xDA, 0xA7, 0x4E,
+    0x9E, 0x76, 0xD2, 0x5D, 0x4E, 0xCE, 0x07, 0xAD, 0x74, 0x78, 0x49, 0x6F, 0x48, 0x8A, 0xE5, 0x27,
+    0x2B, 0x69, 0xA0, 0x96, 0x04, 0x92, 0x32, 0x41, 0x6F, 0x69, 0x69, 0x35, 0x75, 0x42, 0x0B, 0x4A,
+    0x7E, 0xC3, 0x8B, 0x2F, 0x80, 0x56, 0x06, 0xFA, 0x03, 0x70, 0x8A, 0x80, 0x36, 0x20, 0x9C, 0x80,
+    0xD7, 0x04, 0x4E, 0x09, 0xD0, 0x7E, 0x39, 0xD9, 0x69, 0x80, 0x46, 0x0B, 0xD4, 0x76, 0x65, 0xC3,
+    0x1A, 0x46, 0xA7, 0x9B, 0x9B, 0x9B, 0x46, 0x92, 0x56, 0xA9, 0xB4, 0x48, 0x31, 0x48, 0x5A, 0xB9,
+    0x36, 0xEA, 0x84, 0x5A, 0x3A, 0x41, 0xD2, 0x46, 0xD0, 0x5B, 0x8A, 0x8D, 0x86, 0xEE, 0x60, 0x8C,
+    0x68, 0x71, 0x09, 0x9F, 0xF9, 0x1B, 0xD4, 0x8A, 0xC0, 0xB8, 0x01, 0xDD, 0x71, 0xF9, 0xD1, 0xD7,
+    0x15, 0x8B, 0x89, 0x6E, 0xA4, 0x0D, 0x82, 0x14, 0xA9, 0xE8, 0x4F, 0x00, 0xAD, 0x80, 0xBF, 0xFD,
+    0xB7, 0xB4, 0x68, 0x82, 0x4E, 0xE9, 0xDE, 0xFF, 0x58, 0x24, 0x7F, 0xD2, 0x48, 0x27, 0x74, 0x7A,
+    0x0C, 0xDC, 0xBB, 0xA8, 0xD2, 0x73, 0x98, 0x3D, 0xC7, 0xCC, 0x0B, 0x95, 0xD6, 0xCB, 0x8F, 0x56,
+    0xB2, 0x07, 0x25, 0xA8, 0xA4, 0x08, 0xDD, 0x87, 0x27, 0x54, 0xFA, 0xCC, 0x06, 0xDD, 0x36, 0x46,
+    0x2A, 0xBD, 0x2C, 0xE8, 0x36, 0xBF, 0x53, 0x69, 0x18, 0x17, 0xBA, 0xAD, 0x16, 0x95, 0x06, 0x9F,
+    0xE9, 0x1E, 0xDF, 0x8C, 0x3F, 0xFA, 0xEF, 0xA5, 0x32, 0x91, 0xA5, 0x5E, 0x92, 0xF6, 0x20, 0x49,
+    0x4B, 0xB1, 0x5E, 0x74, 0x3B, 0xC5, 0x54, 0x95, 0x13, 0xBE, 0x38, 0x1F, 0xA0, 0x96, 0xB4, 0x12,
+    0xA4, 0x83, 0x46, 0x52, 0x64, 0x96, 0x72, 0xB9, 0x41, 0x13, 0x66, 0x04, 0xCB, 0xD7, 0xC2, 0x39,
+    0x40, 0x23, 0x0D, 0x30, 0x4B, 0xE0, 0xA5, 0x0C, 0xBC, 0xAE, 0x15, 0xE8, 0xC5, 0x65, 0xAC, 0x1A,
+    0x0D, 0x17, 0xD9, 0xB6, 0x76, 0x36, 0x01, 0xC1, 0xC4, 0x1C, 0xAD, 0xAF, 0xFF, 0x58, 0xCA, 0xB4,
+    0xD2, 0x09, 0xB3, 0x4E, 0x70, 0x7A, 0x0C, 0x54, 0x57, 0x28, 0x71, 0x0F, 0xA0, 0x57, 0x84, 0xB6,
+    0x4C, 0xBD, 0xC7, 0x30, 0xEA, 0x03, 0x68, 0xB5, 0x03, 0xF3, 0x09, 0xB4, 0x5A, 0x80, 0x31, 0x5F,
+    0x35, 0x2B, 0x9C, 0x8F, 0x06, 0xAA, 0xEB, 0x7C, 0x59, 0x19, 0x25, 0x2D, 0xB5, 0x96, 0x4E, 0xD1,
+    0x1F, 0x78, 0x31, 0x26, 0xBA, 0x5C, 0x29, 0x32, 0xA6, 0x46, 0x54, 0x8A, 0x5D, 0xA6, 0x11, 0x63,
+    0xA2, 0xDF, 0xD1, 0x8A, 0x16, 0xA7, 0xE8, 0x45, 0xA3, 0xEF, 0x16, 0xC8, 0x35, 0x18, 0xFA, 0xA2,
+    0x31, 0xD7, 0xFD, 0x00, 0x68, 0x25, 0x9D, 0x4E, 0x92, 0xBE, 0x21, 0x49, 0x9B, 0x24, 0xE5, 0xF0,
+    0xA3, 0x9B, 0xF1, 0xE8, 0x36, 0xBA, 0xA3, 0xC9, 0xF8, 0xA3, 0xCA, 0xF8, 0x93, 0xBF, 0x6F, 0x1A,
+    0xD3, 0xEA, 0x72, 0x68, 0x34, 0x80, 0x33, 0xB5, 0x8F, 0x98, 0x1A, 0x9A, 0x32, 0xDC, 0xEA, 0xFA,
+    0xB8, 0x5F, 0xD4, 0xAB, 0xB7, 0x49, 0x82, 0x4D, 0xDD, 0xA2, 0xB4, 0xF3, 0x7A, 0x35, 0x55, 0x9F,
+    0xE7, 0xD6, 0x02, 0x54, 0x3A, 0x07, 0xAA, 0x22, 0x51, 0xED, 0xF4, 0xE7, 0x67, 0x15, 0x9D, 0x06,
+    0x7F, 0x30, 0x2F, 0xCC, 0x8B, 0xCF, 0xF8, 0x8C, 0x62, 0xA5, 0xE8, 0x4F, 0xC6, 0xC4, 0x98, 0xBB,
+    0x83, 0xFA, 0xD2, 0xC3, 0x08, 0xA3, 0x56, 0x08, 0xD2, 0x44, 0xA7, 0xF9, 0xA4, 0xD1, 0xA7, 0xB5,
+    0x55, 0x8A, 0x4E, 0x31, 0x24, 0xBA, 0xDC, 0x9C, 0xA0, 0x65, 0x5E, 0xF1, 0xB9, 0x3D, 0xA9, 0x14,
+    0xE7, 0x8D, 0x71, 0x73, 0xFA, 0xCB, 0xF9, 0xA4, 0x97, 0x34, 0x31, 0x4B, 0x0B, 0xD5, 0xAC, 0xA5,
+    0xC8, 0xE9, 0xF2, 0x56, 0x86, 0xEC, 0x62, 0x2F, 0x16, 0x5A, 0x7D, 0x4F, 0x09, 0x7F, 0x32, 0xEF,
+    0xF4, 0x99, 0x90, 0x09, 0x1B, 0x5D, 0x26, 0x24, 0xBA, 0x6C, 0x63, 0x74, 0x39, 0xDA, 0xF9, 0x4C,
+    0xD8, 0x09, 0x27, 0xA3, 0x99, 0x43, 0x1B, 0x99, 0x95, 0xCA, 0xCC, 0xD1, 0x8B, 0x6F, 0x69, 0xC2,
+    0xAC, 0x59, 0x51, 0x87, 0x5A, 0x1B, 0xE0, 0xB5, 0x00, 0xB3, 0x86, 0x82, 0x3F, 0x5F, 0x92, 0xF5,
+    0xD0, 0xAC, 0xCC, 0x9B, 0xB7, 0x26, 0xF4, 0xC5, 0xC1, 0xE7, 0x4A, 0x4B, 0x7F, 0xD4, 0x32, 0xE8,
+    0xF5, 0xD4, 0xAB, 0x1A, 0xEA, 0x93, 0x39, 0x79, 0xA1, 0xD4, 0x66, 0x7E, 0xC9, 0xBE, 0x45, 0x9B,
+    0xA9, 0xB4, 0xD0, 0x1F, 0xD4, 0x8A, 0x3C, 0xFB, 0xAB, 0xB7, 0xCF, 0x00, 0x77, 0x80, 0x12, 0xAD,
+    0x0C, 0x47, 0x9E, 0x30, 0x2F, 0xF8, 0x1D, 0x27, 0x50, 0x24, 0x24, 0xEA, 0xFD, 0xEE, 0xFD, 0xD4,
+    0x09, 0x6A, 0x4D, 0xD4, 0xCA, 0xD4, 0x3A, 0xA8, 0xB5, 0x5F, 0xFF, 0x98, 0xB7, 0x32, 0x07, 0xFA,
+    0x67, 0x1E, 0x22, 0x84, 0x1D, 0x18, 0x2F, 0x80, 0x9C, 0x56, 0x52, 0xBE, 0x7A, 0xFD, 0xD7, 0x1E,
+    0x3D, 0x7A, 0x34, 0x3D, 0xD1, 0xC2, 0xEB, 0xA5, 0x59, 0xD2, 0xFF, 0xF5, 0xE8, 0xD1, 0xA3, 0x2F,
+    0x3F, 0x07, 0x54, 0x1B, 0x06, 0xDB, 0x1A, 0x83, 0x86, 0xEB, 0x53, 0x87, 0x97, 0x14, 0xA1, 0xCF,
+    0x36, 0xBF, 0x3B, 0x2D, 0xF4, 0x5A, 0xE8, 0x35, 0xD1, 0x6B, 0x32, 0x6D, 0xEF, 0x27, 0x60, 0x02,
+    0xF8, 0x2D, 0x6A, 0xED, 0x4E, 0x9A, 0xA4, 0x2D, 0x48, 0xFE, 0xCF, 0xF4, 0xEE, 0xD0, 0x25, 0x5C,
+    0xA6, 0x3A, 0x41, 0xA0, 0x01, 0x4D, 0x68, 0xAA, 0x34, 0xA0, 0x01, 0xC1, 0x38, 0xD0, 0x2B, 0xB6,
+    0x4A, 0x28, 0x71, 0xFF, 0xCD, 0x6B, 0x6B, 0x07, 0xC6, 0x95, 0xB0, 0xE3, 0x0F, 0x6A, 0x61, 0x83,
+    0x02, 0xF0, 0x8A, 0xBD, 0xBD, 0x24, 0x7D, 0x70, 0xE9, 0xF5, 0x51, 0x6C, 0x9D, 0x04, 0x8C, 0xFA,
+    0x77, 0xBF, 0x69, 0x68, 0x77, 0xB5, 0x39, 0x36, 0xEF, 0x66, 0x15, 0xCD, 0x5C, 0xF9, 0x9D, 0x71,
+    0x35, 0x1C, 0xE1, 0x4E, 0xDA, 0xA3, 0x8F, 0x63, 0xEC, 0x13, 0x3A, 0x0F, 0x54, 0x09, 0x2F, 0x25,
+    0x77, 0xF8, 0x1D, 0xBD, 0xA3, 0xE8, 0xB7, 0x10, 0xDB, 0x5C, 0x1D, 0x84, 0x77, 0x4F, 0xC2, 0xD2,
+    0x26, 0xE4, 0xB7, 0x4A, 0x84, 0xD8, 0xE4, 0x10, 0xFD, 0xC6, 0x49, 0xFF, 0x17, 0x22, 0xC4, 0x76,
+    0x43, 0xBF, 0x91, 0xCB, 0x95, 0x7E, 0x6D, 0x72, 0x2D, 0xC2, 0x32, 0x4F, 0x5D, 0xEA, 0x76, 0xA7,
+    0xFA, 0x64, 0xFC, 0xD7, 0x1F, 0xAF, 0x63, 0x6A, 0x73, 0x25, 0xFD, 0xA1, 0x44, 0x9F, 0x9C, 0xF2,
+    0xA8, 0xC4, 0x18, 0x1B, 0x4D, 0x3A, 0x40, 0x53, 0xFD, 0x25, 0x5E, 0x1B, 0x8A, 0x31, 0x06, 0xDA,
+    0xB3, 0xFC, 0xE3, 0xCF, 0x62, 0x3B, 0x3B, 0x0D, 0x36, 0xDC, 0xBD, 0xFE, 0xDD, 0xCD, 0x9C, 0x29,
+    0x00, 0x3E, 0x02, 0x9D, 0x0C, 0x3A, 0x14, 0x53, 0xCA, 0x1D, 0xFC, 0x70, 0xE7, 0xF5, 0xBA, 0x19,
+    0xE0, 0x7E, 0x83, 0x8B, 0xD1, 0x01, 0x94, 0xB9, 0x9A, 0x63, 0x70, 0x66, 0x08, 0x91, 0x16, 0x28,
+    0xEE, 0x0A, 0xDC, 0x11, 0x12, 0xC0, 0xFC, 0x86, 0xC9, 0x30, 0x85, 0x04, 0xD4, 0x67, 0x6D, 0xCE,
+    0x20, 0xF6, 0x3B, 0xE0, 0xF7, 0xCA, 0xAC, 0x9E, 0x79, 0xC1, 0xB0, 0x50, 0x2C, 0xBC, 0x0E, 0xA8,
+    0xA4, 0x32, 0x3F, 0x2D, 0xF6, 0x3C, 0x1F, 0x3D, 0x52, 0x02, 0x45, 0x1A, 0x59, 0x93, 0xC6, 0x0D,
+    0x77, 0x9A, 0xF9, 0x54, 0x84, 0x70, 0x30, 0xEB, 0x4D, 0x66, 0x1D, 0x41, 0x27, 0x9D, 0xF4, 0x1D,
+    0x69, 0xA9, 0x55, 0x9A, 0x07, 0xBC, 0xA8, 0xD3, 0x7C, 0xD5, 0x01, 0x2A, 0xFE, 0xE0, 0x23, 0x1D,
+    0xFC, 0x52, 0x97, 0x1B, 0x45, 0x5A, 0x31, 0x26, 0x9C, 0x26, 0x9F, 0x41, 0x8B, 0x13, 0x84, 0xAD,
+    0x52, 0xA4, 0xCB, 0xCC, 0x0B, 0xAD, 0x2C, 0xD6, 0xFB, 0xBF, 0x43, 0x82, 0x6B, 0xD3, 0x0E, 0x13,
+    0xE5, 0x4A, 0xAB, 0x4A, 0x19, 0xA7, 0xA9, 0xD5, 0x84, 0x16, 0xB4, 0x32, 0xA6, 0x02, 0xDC, 0xFC,
+    0x49, 0x2B, 0x9C, 0x26, 0xA7, 0xA9, 0x56, 0x44, 0x4B, 0xA5, 0x95, 0xF9, 0xF1, 0x67, 0x95, 0x0C,
+    0xBE, 0x38, 0x73, 0xD0, 0x92, 0x3E, 0x7A, 0xDA, 0x4C, 0xCC, 0xE7, 0x00, 0x9D, 0xB4, 0x53, 0x49,
+    0x3A, 0x8B, 0x7C, 0x7A, 0x7D, 0xF0, 0x5F, 0x66, 0xE6, 0x03, 0x97, 0x2B, 0x25, 0x5C, 0x76, 0x8A,
+    0xB8, 0xAD, 0xD5, 0x40, 0xB3, 0x7A, 0x01, 0x86, 0xB1, 0xCC, 0x73, 0x94, 0xE3, 0x68, 0xAE, 0xFF,
+    0xC7, 0x1D, 0xF3, 0xE5, 0x58, 0x4D, 0xA3, 0xA0, 0x89, 0x41, 0x91, 0x10, 0x7B, 0x3D, 0xFE, 0x9C,
+    0xA2, 0x97, 0xA4, 0xA1, 0xD1, 0x45, 0x7C, 0x09, 0x3A, 0x9D, 0x03, 0xF0, 0xE0, 0x6E, 0xC4, 0xFF,
+    0xB7, 0xA4, 0x37, 0x8B, 0xE9, 0x78, 0xD3, 0xC4, 0x7C, 0xC2, 0x68, 0xE2, 0xFE, 0xA5, 0x57, 0x8F,
+    0xFB, 0x96, 0xBF, 0xC0, 0x6B, 0xA1, 0x56, 0x44, 0x19, 0xB4, 0xD2, 0x09, 0xC2, 0x86, 0xD3, 0x42,
+    0x97, 0x61, 0xDE, 0x69, 0x05, 0xDD, 0x89, 0x53, 0xA4, 0xD1, 0x84, 0x56, 0x2A, 0xAD, 0x84, 0x0D,
+    0xC6, 0x9D, 0x2E, 0x43, 0x7F, 0xD0, 0x0A, 0xBC, 0x70, 0x8A, 0x38, 0xC5, 0xCB, 0x3D, 0x06, 0xA5,
+    0xEF, 0x3E, 0x67, 0xCC, 0x38, 0x4D, 0xCC, 0x19, 0xB4, 0x56, 0x3A, 0xAC, 0x79, 0x87, 0x65, 0x76,
+    0x76, 0x7B, 0x5B, 0x41, 0xB2, 0xFE, 0x5C, 0x25, 0x7F, 0x73, 0x73, 0x73, 0x33, 0x94, 0x3E, 0x78,
+    0x1B, 0x22, 0xFB, 0x22, 0xE3, 0x76, 0x6F, 0x8C, 0xB4, 0xC2, 0x65, 0x50, 0x22, 0x4C, 0xF8, 0x13,
+    0xB7, 0x81, 0x16, 0xFE, 0x76, 0x41, 0x75, 0xC5, 0x41, 0x17, 0xD9, 0x3B, 0x9B, 0x79, 0x41, 0xCA,
+    0xD0, 0xC8, 0x70, 0xD3, 0x8F, 0x6E, 0x1E, 0x5E, 0x50, 0xA4, 0xC1, 0x48, 0x83, 0x9F, 0xD4, 0x8A,
+    0x74, 0x03, 0xBD, 0x65, 0xBE, 0x34, 0x31, 0x0F, 0x84, 0x0D, 0x9F, 0x68, 0xF5, 0xE8, 0x2D, 0xD1,
+    0xDD, 0xAA, 0xCD, 0x61, 0x33, 0x24, 0x96, 0xF6, 0x5E, 0x7A, 0x63, 0x5D, 0xEB, 0xAF, 0xCD, 0xD5,
+    0x40, 0x9F, 0xE9, 0x23, 0x5E, 0xB4, 0x09, 0xA7, 0x58, 0x6F, 0xA0, 0x95, 0xCF, 0x17, 0x6C, 0x46,
+    0x9F, 0xB9, 0xC0, 0x0B, 0x9C, 0xFE, 0xEC, 0xB5, 0xE1, 0xA2, 0xE6, 0xA3, 0xB4, 0x41, 0x2F, 0xED,
+    0xB7, 0x97, 0x27, 0xA0, 0xB2, 0x19, 0x3F, 0xA7, 0xA7, 0xBF, 0x3D, 0x01, 0xB5, 0x3E, 0x30, 0x43,
+    0x93, 0x2E, 0xD8, 0xD0, 0xDD, 0x99, 0x8C, 0x66, 0x91, 0x1F, 0x17, 0x53, 0x74, 0x31, 0x48, 0x8D,
+    0x24, 0x4D, 0xB5, 0x0E, 0x5E, 0xDD, 0x98, 0x0F, 0x10, 0x9D, 0xC0, 0x27, 0xA7, 0x08, 0x27, 0xF3,
+    0x06, 0x7E, 0xB2, 0x5F, 0xA9, 0xED, 0xE7, 0x2F, 0xD2, 0x8D, 0xB7, 0x0A, 0xDE, 0x6A, 0xE2, 0xD1,
+    0xA3, 0x2F, 0xCF, 0x3B, 0x5E, 0xFA, 0x9A, 0xA6, 0x4A, 0xDA, 0xE7, 0x9D, 0xFB, 0xF3, 0xD9, 0x2A,
+    0x52, 0x29, 0x8E, 0x19, 0xFA, 0xDD, 0x69, 0xA5, 0xD6, 0x14, 0x34, 0x11, 0xB6, 0x4A, 0x1A, 0x9C,
+    0x68, 0x65, 0xF1, 0xDC, 0xAD, 0xDE, 0x4E, 0x30, 0x9A, 0x5E, 0x58, 0xB0, 0x5A, 0xDD, 0xDC, 0x3C,
+    0xBC, 0x77, 0x73, 0xF3, 0x10, 0x49, 0x55, 0xD1, 0x8C, 0xB5, 0x37, 0xAC, 0xBC, 0x31, 0x6B, 0xE5,
+    0xA2, 0x81, 0xA6, 0x9F, 0x67, 0x01, 0x73, 0x5A, 0x4C, 0x3C, 0xDD, 0x61, 0x63, 0x5D, 0x2B, 0xDA,
+    0x87, 0x90, 0x6D, 0xBC, 0x9D, 0x26, 0xFB, 0x30, 0x6E, 0xA6, 0x2D, 0x12, 0xC5, 0xFC, 0x25, 0xD3,
+    0x18, 0x09, 0x98, 0x7F, 0x74, 0xF3, 0x9B, 0x5A, 0xFF, 0xCA, 0x67, 0x15, 0x0F, 0x1C, 0x76, 0xCA,
+    0x1C, 0x1A, 0xEC, 0xC3, 0x9C, 0x4C, 0x3E, 0x9D, 0x06, 0x3A, 0x29, 0xF6, 0xD2, 0xE4, 0xA4, 0xDC,
+    0x48, 0x3B, 0xC1, 0x92, 0x95, 0x83, 0xF5, 0xD2, 0x02, 0x1E, 0x49, 0x54, 0xD2, 0x62, 0x5F, 0xAF,
+    0xB4, 0x14, 0xE8, 0x1A, 0x72, 0xD1, 0xD9, 0x46, 0x43, 0x51, 0xF8, 0x39, 0x95, 0x81, 0xF0, 0x67,
+    0x41, 0xFC, 0xB5, 0x62, 0x51, 0x8A, 0x27, 0x6F, 0xEF, 0x73, 0x91, 0x8A, 0xD3, 0x74, 0x09, 0x31,
+    0xCD, 0x00, 0x0E, 0x4E, 0xC5, 0xBF, 0xDC, 0xDC, 0xBC, 0x02, 0x66, 0xBF, 0xED, 0x5C, 0xA5, 0x3B,
+    0x41, 0x97, 0x1D, 0x6D, 0xB6, 0xF4, 0x77, 0x4C, 0x5C, 0xD8, 0xB9, 0x44, 0x1B, 0x8C, 0xE9, 0x56,
+    0x3F, 0x95, 0xAE, 0x73, 0xCC, 0xF4, 0xD6, 0x26, 0xA7, 0x2B, 0xC7, 0xE9, 0x7A, 0xB4, 0x70, 0xA5,
+    0xB8, 0x7E, 0xFD, 0x98, 0x9F, 0xBA, 0xFE, 0xC8, 0x2F, 0x58, 0x9C, 0xFC, 0xEB, 0x5A, 0x4A, 0x56,
+    0xC0, 0xE2, 0x17, 0x66, 0x0B, 0x60, 0x35, 0x01, 0xF7, 0x7E, 0xFF, 0x62, 0x4E, 0x1E, 0x3E, 0x30,
+    0xA9, 0xBE, 0x6B, 0x9D, 0x3D, 0xBD, 0x44, 0x2D, 0xBD, 0xD9, 0x16, 0xAD, 0x09, 0x3B, 0xD4, 0x8A,
+    0x4E, 0x13, 0x78, 0xD9, 0xCF, 0x84, 0xDD, 0x69, 0x00, 0xB4, 0x04, 0x8B, 0xA6, 0x1A, 0x33, 0xEE,
+    0xD9, 0x7A, 0xA7, 0x0F, 0xCB, 0x94, 0x33, 0xF3, 0xE1, 0xA5, 0x92, 0x59, 0x3C, 0x8B, 0x77, 0xB7,
+    0x79, 0x79, 0x8E, 0xD6, 0xF0, 0x6D, 0xDE, 0x4D, 0x02, 0xB2, 0x78, 0xAC, 0x52, 0x02, 0xFA, 0x5C,
+    0x62, 0xEB, 0xD5, 0x69, 0x05, 0xA7, 0xA1, 0xD1, 0x0A, 0xFD, 0x81, 0x57, 0xA2, 0x93, 0xA2, 0xD7,
+    0x8E, 0x24, 0xBC, 0x92, 0x93, 0x76, 0x5A, 0x0D, 0x05, 0x08, 0x17, 0x5D, 0x31, 0x65, 0x41, 0x25,
+    0xE0, 0x5E, 0x2E, 0x83, 0x60, 0x62, 0x36, 0x41, 0xDA, 0x08, 0x69, 0xBD, 0x4A, 0xD9, 0xA4, 0xA9,
+    0x74, 0x15, 0xBE, 0x3F, 0x78, 0xE6, 0x17, 0x4B, 0xA3, 0xF9, 0x9B, 0xB4, 0x82, 0xAF, 0x14, 0xC3,
+    0xA8, 0x44, 0xBF, 0x38, 0x4D, 0x88, 0xFE, 0x7C, 0x34, 0xE7, 0x4E, 0x92, 0x16, 0x49, 0x52, 0x31,
+    0xED, 0xF0, 0xE0, 0xE6, 0x21, 0xDC, 0xDC, 0x40, 0x50, 0x86, 0x59, 0xAB, 0x89, 0x28, 0x28, 0x59,
+    0xCA, 0x32, 0x68, 0x85, 0x56, 0x1B, 0x9D, 0x45, 0xC8, 0x07, 0xFE, 0x92, 0x23, 0xB7, 0x10, 0x6F,
+    0x9E, 0x57, 0x77, 0x0A, 0x08, 0x5F, 0xDF, 0xAB, 0x43, 0x11, 0xBA, 0xEF, 0x08, 0x85, 0x04, 0xED,
+    0xA6, 0x38, 0x7F, 0x26, 0x83, 0xCB, 0x21, 0x85, 0x37, 0x04, 0xA8, 0x3D, 0xFA, 0xA8, 0x08, 0xF3,
+    0x3F, 0xD7, 0x67, 0xD6, 0x90, 0x20, 0x2C, 0xE3, 0xF7, 0x52, 0x97, 0xC1, 0x27, 0xAF, 0xBD, 0x11,
+    0x34, 0xBB, 0x53, 0xAE, 0x34, 0x51, 0x1F, 0xE8, 0x60, 0x5E, 0x41, 0xF4, 0xA2, 0xDF, 0x61, 0x8C,
+    0x8D, 0x86, 0xF6, 0x84, 0x7E, 0xAD, 0x14, 0x9D, 0x06, 0x7C, 0x22, 0x2C, 0x68, 0xA1, 0xC9, 0xF8,
+    0x44, 0xD8, 0xA8, 0x45, 0xFD, 0x25, 0xBA, 0x73, 0xB8, 0x04, 0x52, 0xD9, 0x5F, 0xA2, 0x70, 0x77,
+    0xF1, 0x31, 0x13, 0xD5, 0xCD, 0x43, 0x2A, 0xF3, 0x5F, 0x91, 0x51, 0x19, 0x6F, 0x21, 0xF6, 0xC4,
+    0xA8, 0x95, 0x5E, 0x6F, 0xC2, 0x28, 0x0B, 0xFB, 0x1B, 0xED, 0xB8, 0x03, 0x13, 0xC8, 0x18, 0xC1,
+    0xEB, 0xB0, 0x74, 0x98, 0x94, 0x98, 0x27, 0xE8, 0x64, 0xC9, 0xF8, 0x5A, 0xE3, 0x8E, 0x06, 0x08,
+    0xDF, 0x51, 0xEC, 0x12, 0xB8, 0xA3, 0x3B, 0x6B, 0x01, 0x21, 0x2A, 0xF5, 0x2B, 0x34, 0xB9, 0xD1,
+    0x1B, 0x07, 0x30, 0xC7, 0x90, 0x43, 0x04, 0xBF, 0xD7, 0xFA, 0x76, 0xC6, 0xB2, 0x85, 0x73, 0x84,
+    0x2E, 0xD9, 0xEC, 0xA8, 0x85, 0xB3, 0x4A, 0xC4, 0x6A, 0xC3, 0xE1, 0x4E, 0x2A, 0xB3, 0x79, 0x0B,
+    0x5E, 0xAB, 0x65, 0x4D, 0xC7, 0x13, 0x5A, 0x9D, 0x38, 0x2D, 0xD4, 0x52, 0x32, 0xAB, 0xA6, 0xD3,
+    0xB2, 0xA5, 0xD7, 0xDC, 0xC0, 0xAD, 0x4B, 0x79, 0xD3, 0xF2, 0x73, 0x25, 0x5B, 0x1D, 0xF1, 0xB2,
+    0x34, 0xCC, 0xE3, 0xCF, 0x69, 0x43, 0x19, 0xAF, 0x18, 0x04, 0xE3, 0xD1, 0x28, 0xE2, 0xB4, 0x9A,
+    0x6F, 0xEB, 0x04, 0xB5, 0x7E, 0x68, 0x5F, 0x33, 0x2B, 0xFA, 0xA1, 0x22, 0xF4, 0x9A, 0x33, 0xD4,
+    0xFA, 0xBE, 0x26, 0x08, 0xA7, 0x76, 0x70, 0x7A, 0x5F, 0x13, 0x8C, 0x59, 0x3B, 0xB4, 0xFA, 0x5D,
+    0x4D, 0xA0, 0x34, 0x67, 0xE8, 0xCF, 0x46, 0x0B, 0x8D, 0x62, 0x10, 0x95, 0xB6, 0x5A, 0x47, 0x35,
+    0x17, 0xE4, 0x30, 0x11, 0x2C, 0x07, 0x63, 0x2E, 0xB5, 0x9A, 0x6D, 0xBA, 0x3E, 0x01, 0x9D, 0xEE,
+    0xCD, 0xFA, 0x12, 0x25, 0xA1, 0x58, 0x10, 0xE1, 0x28, 0x49, 0xDC, 0xFF, 0xAC, 0x2C, 0xC0, 0x4B,
+    0x05, 0xA7, 0x86, 0x6C, 0x73, 0x35, 0xE2, 0x0F, 0x42, 0xC6, 0xC2, 0x72, 0xFA, 0xCC, 0xB8, 0x61,
+    0x19, 0x0B, 0xC2, 0x5E, 0x6B, 0xC1, 0xE9, 0xD3, 0xDA, 0x61, 0x54, 0xA9, 0x1B, 0x89, 0x32, 0x47,
+    0xF1, 0xE7, 0xC3, 0x5B, 0x1F, 0xDE, 0x3F, 0x81, 0x57, 0xF6, 0x5B, 0x27, 0xCE, 0xFC, 0xD8, 0x72,
+    0x7B, 0xC5, 0x17, 0x25, 0x70, 0xD2, 0xF9, 0x09, 0x84, 0x6A, 0x11, 0x44, 0x50, 0x31, 0xAC, 0x36,
+    0xF3, 0x4C, 0xF0, 0x30, 0xEA, 0x0F, 0x66, 0x0D, 0x14, 0xD9, 0xE3, 0x94, 0x28, 0x62, 0xC2, 0x69,
+    0xC5, 0x6B, 0xA0, 0x2E, 0x10, 0xB0, 0x56, 0x22, 0x9C, 0xE5, 0x3D, 0xDB, 0xFB, 0x58, 0xDE, 0xE7,
+    0xCB, 0xFB, 0x0E, 0x4E, 0x2B, 0x36, 0x14, 0x0B, 0xDA, 0xA1, 0x51, 0xC4, 0x46, 0x63, 0x62, 0x2E,
+    0x28, 0x65, 0xCE, 0x96, 0x85, 0x1A, 0xB3, 0xFD, 0xD9, 0x98, 0x40, 0xA7, 0xA9, 0x35, 0x5F, 0x7C,
+    0xCA, 0xB2, 0x2F, 0xC5, 0x46, 0xAA, 0x44, 0x30, 0xC1, 0xC2, 0x44, 0xDA, 0x12, 0xEE, 0x54, 0x17,
+    0xD0, 0xD2, 0x97, 0x48, 0xA9, 0x91, 0x3E, 0x7A, 0xF8, 0x82, 0xA9, 0x99, 0xB2, 0x9D, 0xD0, 0x06,
+    0xF0, 0xBA, 0xCC, 0xCD, 0x54, 0x73, 0xF9, 0xEE, 0x25, 0xF6, 0xB4, 0x8B, 0xFF, 0xD6, 0x80, 0xF1,
+    0x69, 0xB2, 0xD1, 0xC0, 0xA8, 0xC7, 0xB3, 0xA8, 0xFE, 0x57, 0xC5, 0x70, 0x40, 0x2B, 0x6B, 0x68,
+    0x36, 0xBC, 0xB0, 0x9A, 0x23, 0x1F, 0xBC, 0xA0, 0xCB, 0xC5, 0x79, 0x17, 0xA0, 0xD0, 0x1D, 0xE0,
+    0xCF, 0xFA, 0x36, 0x08, 0xA9, 0x0C, 0xA9, 0x58, 0x6E, 0x8A, 0x70, 0x6A, 0x01, 0xF4, 0x4D, 0x45,
+    0x68, 0xE4, 0xCC, 0xE5, 0xB6, 0x02, 0x4B, 0x5A, 0xE0, 0x34, 0xF5, 0x27, 0xF8, 0x83, 0x70, 0xC2,
+    0xBC, 0x31, 0x8A, 0x51, 0x62, 0xD6, 0xCB, 0x52, 0x66, 0xD6, 0xEF, 0x49, 0x6B, 0x41, 0x53, 0x77,
+    0x26, 0xD8, 0x5C, 0x02, 0xA8, 0x89, 0x51, 0x3A, 0xF0, 0x92, 0xA2, 0xD3, 0xD2, 0x64, 0x42, 0x22,
+    0xC4, 0x46, 0xB8, 0x9D, 0x39, 0x11, 0x68, 0x35, 0xD4, 0x13, 0xF3, 0x41, 0xA9, 0x8A, 0x11, 0xB4,
+    0x01, 0x32, 0xF7, 0x62, 0xA8, 0x40, 0x40, 0xA7, 0xDD, 0x42, 0xC9, 0x6A, 0x62, 0x3E, 0x78, 0x9B,
+    0x5A, 0xAB, 0x5F, 0xE8, 0x8E, 0xEA, 0xA4, 0xD2, 0xD2, 0x27, 0xFA, 0xEC, 0x34, 0x35, 0x9A, 0x82,
+    0xFE, 0x44, 0xC9, 0x06, 0xCB, 0xCB, 0xC2, 0xF5, 0x73, 0x28, 0x12, 0xBE, 0x77, 0x73, 0x73, 0x49,
+    0x05, 0xEB, 0xFF, 0xD1, 0x35, 0x09, 0xA7, 0x1C, 0xFE, 0xF2, 0xF5, 0xE3, 0x37, 0xE5, 0x53, 0x2B,
+    0xC2, 0x57, 0x77, 0xA7, 0xD8, 0xFD, 0x45, 0x46, 0x6B, 0xB3, 0x05, 0xC6, 0xAD, 0xDE, 0xAB, 0xA1,
+    0xCB, 0xBC, 0x70, 0xF1, 0xF6, 0x05, 0x43, 0xDA, 0xCC, 0x7C, 0x16, 0x26, 0xFE, 0x2B, 0x2E, 0x4F,
+    0x60, 0x30, 0xAF, 0x04, 0x54, 0xCD, 0x65, 0xBA, 0x18, 0x76, 0x39, 0x81, 0x07, 0x37, 0x37, 0xC3,
+    0x83, 0x9B, 0x1B, 0x2F, 0xAD, 0x5E, 0xFA, 0xAA, 0xB4, 0x35, 0x52, 0x9A, 0xF5, 0x01, 0xB3, 0xDE,
+    0xAC, 0x15, 0xA9, 0x35, 0x50, 0xC2, 0xDC, 0xB0, 0x43, 0x48, 0x74, 0x07, 0x74, 0x96, 0x8B, 0x68,
+    0x4F, 0x7E, 0xC2, 0x3D, 0x16, 0xEB, 0xB4, 0x07, 0xEE, 0x72, 0xCF, 0xFA, 0xE3, 0xEF, 0x31, 0x3D,
+    0x82, 0x79, 0xA3, 0xD6, 0x44, 0x2F, 0x6A, 0x45, 0x1A, 0x6D, 0x4D, 0x89, 0x84, 0x2C, 0xBE, 0x53,
+    0x29, 0x1D, 0x6B, 0xA5, 0xA4, 0x5E, 0xAF, 0x38, 0xF8, 0xC1, 0xCD, 0xCD, 0x70, 0xCF, 0xBA, 0xD2,
+    0x5A, 0x57, 0x9C, 0xB4, 0xCE, 0x5A, 0xE9, 0xB5, 0x38, 0xC3, 0xD9, 0xCC, 0xD6, 0xCC, 0x2E, 0xC3,
+    0xB8, 0xD2, 0x68, 0x20, 0x18, 0x14, 0xEE, 0x37, 0x08, 0xBB, 0x55, 0xF9, 0x4E, 0xDA, 0xC3, 0x70,
+    0xCF, 0x09, 0x8C, 0xA9, 0x96, 0xA5, 0x5F, 0x2C, 0x2D, 0xCA, 0x1C, 0x0D, 0xFD, 0x2C, 0x40, 0xBF,
+    0xF5, 0x09, 0x68, 0xCE, 0x52, 0x11, 0xFD, 0xDD, 0x1D, 0x20, 0xFC, 0xB0, 0x8C, 0x43, 0xA9, 0xA6,
+    0xAA, 0x64, 0xAF, 0x06, 0x2E, 0x39, 0xF9, 0xEB, 0xE8, 0x95, 0xE1, 0x23, 0xDC, 0xCD, 0xCD, 0xDD,
+    0xBB, 0xB9, 0x19, 0x80, 0x9B, 0x9B, 0x87, 0x92, 0xE8, 0x63, 0x23, 0xBD, 0x27, 0x6D, 0x88, 0x5E,
+    0x67, 0xAB, 0x93, 0x36, 0xD3, 0x59, 0xA7, 0x42, 0x2A, 0x89, 0xA1, 0x5A, 0x91, 0x79, 0xA1, 0xCF,
+    0x16, 0x81, 0xC2, 0x98, 0x98, 0x33, 0xFD, 0x66, 0xC6, 0x38, 0x59, 0xA2, 0x62, 0xE8, 0x15, 0xDB,
+    0x0C, 0xFE, 0x40, 0x1A, 0xC2, 0x0A, 0x61, 0x6B, 0x3F, 0x3E, 0x2A, 0x59, 0x97, 0xBE, 0xBE, 0xF9,
+    0x1D, 0x9C, 0x3E, 0x7D, 0x84, 0x65, 0x8C, 0xD0, 0x1E, 0x3E, 0xE9, 0xE5, 0x13, 0xE8, 0xB7, 0xF1,
+    0x8D, 0xB3, 0x4B, 0xC0, 0xFC, 0x9D, 0xEC, 0x77, 0x4D, 0x50, 0xE9, 0x0F, 0xD7, 0xF0, 0x6F, 0x32,
+    0xD0, 0x9C, 0x62, 0x9E, 0x57, 0xC0, 0x6B, 0xAF, 0xAD, 0xBB, 0x41, 0xD1, 0xE0, 0x00, 0x3A, 0x2D,
+    0xAF, 0x8E, 0x53, 0x62, 0x3C, 0x4C, 0x32, 0x93, 0x01, 0x3D, 0xFA, 0x8C, 0xC1, 0x49, 0xE6, 0xB5,
+    0xE4, 0xF5, 0x6B, 0x41, 0x58, 0x3E, 0x91, 0x74, 0xB8, 0xB9, 0x79, 0x78, 0xEF, 0xE6, 0x15, 0x5A,
+    0x69, 0x0D, 0x36, 0xE3, 0x96, 0xA0, 0x4C, 0xAD, 0xD3, 0x52, 0x8C, 0x21, 0xD3, 0x1E, 0x40, 0x77,
+    0x5A, 0x3D, 0xC1, 0xCB, 0x92, 0x64, 0x8D, 0x86, 0x82, 0xA5, 0xDF, 0x93, 0x19, 0xCF, 0xF7, 0x73,
+    0x49, 0x0F, 0xA5, 0x02, 0x4C, 0x63, 0x71, 0x16, 0xC5, 0xA8, 0x16, 0xE3, 0x7A, 0xF9, 0x2C, 0x6B,
+    0x9D, 0x2B, 0xBA, 0xE6, 0x4F, 0xBB, 0xBF, 0x4F, 0x36, 0x70, 0x73, 0x9C, 0x13, 0x50, 0x6B, 0x08,
+    0x3B, 0xD0, 0x1C, 0x36, 0x07, 0xBB, 0xBD, 0xC4, 0x1C, 0x09, 0xAF, 0x81, 0x56, 0x27, 0xB3, 0x32,
+    0xBD, 0xF4, 0xEB, 0x56, 0x8B, 0x92, 0x93, 0x76, 0x1E, 0xDC, 0xDC, 0x70, 0x73, 0xF3, 0x8F, 0xA4,
+    0x35, 0xE8, 0x90, 0x0E, 0x27, 0xBD, 0xAB, 0x93, 0x56, 0x6B, 0x6B, 0x50, 0x28, 0x6C, 0xF8, 0x8C,
+    0x53, 0xAC, 0xCD, 0xE8, 0x8E, 0x0B, 0x68, 0xF1, 0x3B, 0xB4, 0xB2, 0xDA, 0x72, 0x1A, 0x17, 0x70,
+    0xFA, 0xCC, 0x0E, 0xF4, 0xA7, 0xD5, 0x33, 0x0A, 0x52, 0xB5, 0x98, 0xE3, 0xBC, 0xA3, 0x6D, 0xE6,
+    0x49, 0x9B, 0x22, 0xF0, 0x74, 0x6B, 0x2C, 0x3E, 0x11, 0xEC, 0xAF, 0x57, 0x6B, 0x61, 0x44, 0x0B,
+    0xBA, 0x02, 0xE7, 0xEF, 0xDD, 0x94, 0x38, 0xEC, 0x12, 0xE6, 0x17, 0x44, 0x30, 0xFF, 0x01, 0xF3,
+    0x81, 0xA8, 0xB4, 0x23, 0x9C, 0x56, 0x4E, 0xBC, 0x22, 0xFF, 0x4D, 0x29, 0xBC, 0xCC, 0x56, 0x55,
+    0xB2, 0x62, 0xCD, 0x7A, 0x29, 0xAD, 0x15, 0x21, 0xCF, 0x96, 0x12, 0x4F, 0x94, 0xBA, 0xDA, 0xE5,
+    0xE2, 0x89, 0x5B, 0x50, 0xA6, 0x4D, 0xB5, 0x12, 0x3E, 0x35, 0x8A, 0xF4, 0xA9, 0xD3, 0x40, 0x58,
+    0x83, 0x1E, 0xFD, 0x89, 0x96, 0xF1, 0x5A, 0x61, 0xD3, 0xD4, 0x97, 0x78, 0xD4, 0x12, 0xD3, 0xB3,
+    0x06, 0x82, 0x16, 0xBC, 0x12, 0xCD, 0xF9, 0x47, 0x4F, 0x16, 0xBB, 0xFD, 0x66, 0xAC, 0x8F, 0x6B,
+    0xA1, 0x3B, 0x94, 0xB2, 0x78, 0x9B, 0x4B, 0x31, 0xE9, 0xC7, 0x17, 0xF7, 0x63, 0x39, 0xB9, 0x5B,
+    0xB6, 0xBC, 0x12, 0x30, 0x97, 0x9A, 0xBE, 0xDF, 0x3F, 0x59, 0x59, 0xFF, 0xD1, 0x40, 0xA7, 0x44,
+    0x53, 0x54, 0x95, 0x9B, 0xA1, 0xDC, 0x5D, 0xAA, 0xEA, 0x5D, 0xB2, 0xD6, 0xB4, 0x85, 0x87, 0x72,
+    0x5B, 0x7E, 0x1F, 0x4A, 0x23, 0xCA, 0xCD, 0x7D, 0x2A, 0x37, 0xEF, 0xA5, 0x95, 0xC7, 0xA5, 0x51,
+    0xE5, 0xE6, 0x39, 0x96, 0x9B, 0xD7, 0xD2, 0xC0, 0xAD, 0xB4, 0x27, 0x43, 0xFD, 0xE5, 0x5B, 0x81,
+    0x74, 0x4A, 0xD4, 0x6F, 0xE5, 0x0B, 0x1B, 0xE1, 0xAF, 0xDF, 0xA5, 0x42, 0x16, 0x78, 0x5A, 0x7E,
+    0xE9, 0xFF, 0x85, 0xFC, 0x1E, 0xCC, 0x91, 0x4E, 0x89, 0x56, 0x3B, 0xB5, 0x99, 0xC7, 0x57, 0xCA,
+    0x94, 0x37, 0x87, 0xD5, 0x98, 0x2B, 0x5E, 0xC0, 0x2B, 0x41, 0xFF, 0xFE, 0x06, 0xE1, 0xAB, 0x3B,
+    0x8C, 0x6F, 0x64, 0xD0, 0xCB, 0x27, 0x95, 0x2A, 0x51, 0x9F, 0x68, 0x70, 0x99, 0x79, 0x6A, 0x33,
+    0x63, 0xF4, 0xBB, 0x71, 0x55, 0xFA, 0xD4, 0x27, 0xBA, 0x2D, 0x5C, 0x4C, 0x09, 0x37, 0x37, 0x37,
+    0x37, 0x9F, 0xD5, 0x13, 0xAF, 0x9B, 0x9B, 0x9B, 0x9B, 0x57, 0x7E, 0x81, 0x5F, 0x63, 0x1E, 0x14,
+    0xE7, 0x35, 0x6C, 0x6D, 0xAE, 0x0E, 0xFE, 0xE1, 0xB5, 0x0C, 0x3A, 0x6F, 0x63, 0x44, 0x9A, 0xD7,
+    0x4A, 0x52, 0x42, 0x1F, 0x29, 0xA3, 0xD5, 0x9F, 0x8C, 0xA9, 0xD6, 0x10, 0x12, 0x8A, 0xDD, 0x4E,
+    0x48, 0xFE, 0xA0, 0xDF, 0x9D, 0xF0, 0x47, 0xA5, 0xD8, 0x88, 0x79, 0x75, 0x8A, 0x61, 0xAB, 0xB5,
+    0xFA, 0x03, 0xED, 0x4E, 0xC3, 0x79, 0xFE, 0xA2, 0xD2, 0x31, 0xBF, 0xFF, 0x7D, 0x9D, 0xBD, 0x3E,
+    0x94, 0x5A, 0x25, 0xA9, 0x52, 0xF2, 0x27, 0x61, 0xE5, 0x05, 0x2B, 0x27, 0x3E, 0x04, 0x7A, 0x0D,
+    0xA5, 0xBC, 0xD5, 0x6B, 0x87, 0x7B, 0xAF, 0x1E, 0xD7, 0xA2, 0xA6, 0xD5, 0x81, 0xD7, 0x4B, 0xD2,
+    0xDB, 0x67, 0x06, 0xDC, 0x59, 0x6B, 0x40, 0xBF, 0xA1, 0xC4, 0xF8, 0x35, 0x9D, 0xF4, 0xFF, 0x46,
+    0x8A, 0xFE, 0xE3, 0x6D, 0x4E, 0x4E, 0xA9, 0xCB, 0x95, 0x36, 0x27, 0xE6, 0xBD, 0x52, 0xEC, 0x33,
+    0x63, 0xF2, 0xE7, 0x6D, 0x43, 0x27, 0x27, 0xE6, 0xA5, 0xD2, 0x14, 0x12, 0x8A, 0x3E, 0x33, 0xAF,
+    0x8D, 0x18, 0x93, 0xD3, 0xE3, 0x79, 0xB3, 0x92, 0xF4, 0x28, 0x6D, 0x74, 0xDF, 0xD6, 0x0A, 0x83,
+    0x15, 0x88, 0x2B, 0xA8, 0xE6, 0x9D, 0x56, 0x27, 0x41, 0x42, 0x3A, 0x9D, 0xA6, 0x3F, 0x6D, 0x4F,
+    0x5E, 0xF0, 0xD9, 0xDA, 0x75, 0x21, 0x84, 0xCC, 0xAB, 0xFD, 0xC9, 0xFE, 0x9E, 0x57, 0x62, 0x9B,
+    0xF7, 0x97, 0xF6, 0x51, 0x4A, 0x41, 0x5A, 0x3A, 0x69, 0x68, 0xB4, 0x3D, 0x51, 0x7E, 0xBB, 0x6F,
+    0xC9, 0xA3, 0x7C, 0x71, 0x94, 0xBF, 0xF9, 0x74, 0x97, 0x4D, 0x18, 0x55, 0xA5, 0x89, 0xFE, 0x18,
+    0x17, 0xC3, 0xFD, 0xA3, 0x94, 0x09, 0xE7, 0x7C, 0x5A, 0x46, 0xA2, 0xCB, 0xCC, 0xD1, 0x67, 0x42,
+    0x6A, 0x4E, 0xFC, 0xEE, 0x34, 0xB4, 0x07, 0x8A, 0x4E, 0x8C, 0xA9, 0x52, 0xEC, 0x77, 0x94, 0xFC,
+    0xC1, 0xBC, 0x3B, 0x0D, 0xE1, 0x44, 0x4B, 0x98, 0xBF, 0x38, 0xE6, 0xF0, 0xFA, 0x87, 0x1F, 0x4B,
+    0xBF, 0xAB, 0x43, 0x7A, 0x57, 0x39, 0x28, 0x8E, 0xD9, 0x69, 0xF2, 0x3B, 0xF7, 0x6C, 0x64, 0xAA,
+    0x62, 0x41, 0x67, 0xAD, 0x48, 0x19, 0xBD, 0x21, 0x34, 0x8C, 0x71, 0x9E, 0xFA, 0x14, 0xA2, 0xDF,
+    0xFA, 0xD5, 0x67, 0xBF, 0xF9, 0xDC, 0xE4, 0x3E, 0xD7, 0x9A, 0x2D, 0xDF, 0x16, 0x34, 0xE0, 0x33,
+    0xF5, 0xCB, 0xC2, 0xA5, 0x79, 0x6D, 0x73, 0x67, 0xA6, 0xFD, 0x60, 0x54, 0xC6, 0x69, 0xBB, 0x03,
+    0x61, 0x5F, 0x1B, 0x6E, 0x2B, 0x90, 0x04, 0x9B, 0x11, 0x06, 0xCD, 0x6A, 0x39, 0xF3, 0xAD, 0xFC,
+    0x2B, 0x30, 0xE7, 0x76, 0x29, 0x8D, 0x97, 0x74, 0x2E, 0xFD, 0x5E, 0xC0, 0xFD, 0x61, 0xA5, 0x14,
+    0x4B, 0xF4, 0x28, 0x03, 0x8F, 0xF4, 0xD1, 0x1F, 0x5D, 0xCB, 0xEA, 0x17, 0x14, 0x58, 0x42, 0xD4,
+    0xCA, 0xDE, 0xEA, 0x0B, 0x10, 0x19, 0x9E, 0x78, 0x2B, 0x21, 0xC5, 0xDD, 0x12, 0x8E, 0x7F, 0xE2,
+    0xC7, 0x9F, 0xD5, 0x06, 0xC2, 0x76, 0x17, 0xC6, 0x58, 0x2A, 0xC8, 0x4A, 0xC1, 0x7F, 0xC7, 0x7E,
+    0x35, 0xFC, 0xBA, 0x26, 0x4A, 0x65, 0x1E, 0x4A, 0x88, 0x33, 0x9A, 0x13, 0x7E, 0xE9, 0x9A, 0xE6,
+    0xAE, 0x4A, 0x64, 0xF2, 0xDD, 0x3F, 0xB6, 0x4C, 0x63, 0xC4, 0x6B, 0xB6, 0x3A, 0x86, 0xFE, 0x4F,
+    0x18, 0xD7, 0x26, 0x83, 0x2F, 0x7E, 0x30, 0xB6, 0x07, 0xF8, 0x1D, 0x45, 0x6C, 0x52, 0xD2, 0xE6,
+    0x46, 0x40, 0xF8, 0xD8, 0xEA, 0xD6, 0x5A, 0xAF, 0xDE, 0xAC, 0x08, 0x22, 0xAC, 0x77, 0x7A, 0x77,
+    0x71, 0x8D, 0xE7, 0x70, 0x09, 0x45, 0x1B, 0xFD, 0x4B, 0x1D, 0xD4, 0x9A, 0x5A, 0x6D, 0x84, 0x95,
+    0x56, 0x53, 0x7B, 0x40, 0xBF, 0x33, 0x2F, 0xD4, 0x1A, 0x1A, 0x0D, 0xCC, 0x89, 0xA0, 0xFF, 0x6D,
+    0xCE, 0x56, 0x10, 0xB2, 0x78, 0x6D, 0x82, 0x7A, 0xB6, 0x4E, 0x3C, 0xBC, 0x14, 0xFE, 0x5D, 0xA9,
+    0xE5, 0x25, 0xA8, 0x5E, 0x3D, 0xAF, 0x83, 0xE0, 0xF3, 0x75, 0x04, 0x2E, 0xDC, 0x85, 0xE7, 0x20,
+    0xA4, 0x6E, 0xA7, 0x39, 0xBD, 0x56, 0xC6, 0x6F, 0x49, 0xB4, 0x59, 0x4A, 0x68, 0x7E, 0x43, 0x78,
+    0x2D, 0x21, 0x55, 0xDA, 0x9B, 0x93, 0x5E, 0xCC, 0x8B, 0xD3, 0xE2, 0x33, 0x21, 0x63, 0xC4, 0x91,
+    0x9D, 0x39, 0x39, 0xD1, 0x9E, 0x84, 0x84, 0x16, 0xE3, 0xB1, 0xCE, 0xCB, 0x3F, 0x57, 0x6C, 0x8F,
+    0x2F, 0xF4, 0x3B, 0xD2, 0x77, 0x34, 0x78, 0xE5, 0x90, 0x90, 0x9A, 0xB3, 0x38, 0xFF, 0x7B, 0x40,
+    0xBD, 0xE3, 0x0F, 0xFA, 0x83, 0x70, 0x10, 0x72, 0x29, 0xD9, 0x1B, 0x2B, 0x50, 0x31, 0x28, 0x8E,
+    0x8A, 0xAF, 0x29, 0xA2, 0xA9, 0xD2, 0x54, 0x0B, 0x27, 0x9A, 0x93, 0xF6, 0xC0, 0x2A, 0xF5, 0xDD,
+    0x4E, 0xBF, 0x11, 0xD2, 0xF3, 0xE1, 0x07, 0x69, 0x54, 0x1A, 0xB5, 0x06, 0x4D, 0xFD, 0x7E, 0xE1,
+    0x48, 0x8C, 0xC3, 0x45, 0x45, 0x0A, 0xF5, 0x21, 0x5F, 0x75, 0xAC, 0x5F, 0x01, 0x9E, 0x7F, 0x12,
+    0xE0, 0xB5, 0x1A, 0xA0, 0x55, 0xBE, 0xC0, 0x97, 0x4F, 0xBD, 0xB5, 0x53, 0x18, 0x6D, 0xA6, 0x5B,
+    0x85, 0xE3, 0x91, 0xAE, 0xC3, 0x67, 0x78, 0xF3, 0xB8, 0xAA, 0x75, 0x21, 0xAE, 0x7C, 0x92, 0x14,
+    0x62, 0xF0, 0xFC, 0xAA, 0x01, 0x85, 0x3A, 0x72, 0x57, 0xFC, 0xFC, 0xD7, 0xCC, 0x2B, 0xEE, 0x18,
+    0x33, 0x8C, 0xA6, 0x05, 0x5A, 0x4A, 0x46, 0x8E, 0xD1, 0x62, 0xEF, 0x87, 0xC0, 0x7C, 0x94, 0x41,
+    0x6D, 0x74, 0x42, 0xF5, 0xEA, 0x71, 0x79, 0x9C, 0xCF, 0x17, 0x16, 0x4B, 0xBF, 0x5D, 0x7E, 0x32,
+    0xAC, 0x7D, 0x22, 0x7C, 0x53, 0x99, 0xF1, 0x6B, 0xCA, 0xCC, 0x6F, 0xFD, 0xF9, 0x81, 0xDE, 0x76,
+    0x07, 0x4A, 0x2E, 0x57, 0x5A, 0x9A, 0xBD, 0xD6, 0xE4, 0x93, 0x13, 0xE3, 0xE2, 0xCE, 0x46, 0x46,
+    0xE9, 0x69, 0xA5, 0x81, 0xF6, 0x14, 0xF8, 0xAC, 0x88, 0xCF, 0xE3, 0x4A, 0xB7, 0xF7, 0x99, 0x7E,
+    0xF3, 0xFA, 0xFD, 0x90, 0x1A, 0xE5, 0x90, 0x2A, 0xE5, 0x71, 0xB5, 0x29, 0x56, 0x41, 0x35, 0xB4,
+    0x5A, 0xA4, 0xDF, 0xD1, 0x79, 0x6F, 0xDC, 0xCC, 0xE0, 0x75, 0x3B, 0xF3, 0xE2, 0x84, 0xCF, 0x8C,
+    0xA9, 0xD6, 0xE4, 0x0F, 0x42, 0x42, 0xB1, 0x39, 0xE9, 0xEF, 0xDC, 0xB2, 0x3A, 0x0D, 0x3E, 0x33,
+    0xA6, 0x4F, 0xEB, 0x6B, 0x5F, 0x93, 0x7A, 0x6D, 0xB3, 0x06, 0xAD, 0x5C, 0xCB, 0xAE, 0xCF, 0x71,
+    0x5F, 0x43, 0x9F, 0x6A, 0x0D, 0xA3, 0xDE, 0xD1, 0xEE, 0x15, 0x67, 0x7D, 0x55, 0x79, 0xD4, 0xF2,
+    0x9A, 0xFE, 0x50, 0x87, 0xB4, 0xA2, 0xF9, 0x33, 0xDA, 0xE6, 0xB5, 0x52, 0xF6, 0x5A, 0xE6, 0xA5,
+    0xD2, 0xE6, 0x35, 0x28, 0xD6, 0x5A, 0x3B, 0xA1, 0xE8, 0x14, 0xFB, 0x5C, 0x69, 0x72, 0x1A, 0xC2,
+    0x5E, 0x6B, 0x68, 0x2E, 0x74, 0xBC, 0x93, 0x31, 0x39, 0xE1, 0x0F, 0xE6, 0xA2, 0xB2, 0x8A, 0xED,
+    0x41, 0x97, 0x51, 0xF4, 0xF9, 0x85, 0x7E, 0xAF, 0x34, 0xF9, 0xFC, 0xDB, 0x61, 0xAB, 0x35, 0x75,
+    0xCA, 0x21, 0xD5, 0x1A, 0x3A, 0xED, 0x21, 0x39, 0xE1, 0xB5, 0x8E, 0x8B, 0x3B, 0x68, 0x2F, 0x56,
+    0xC3, 0x1A, 0x3C, 0xF0, 0xFA, 0x5E, 0x6B, 0x1A, 0xF5, 0x8E, 0x8E, 0x56, 0x79, 0x54, 0x7A, 0x4D,
+    0xEF, 0x4B, 0x78, 0x6D, 0x63, 0x42, 0x47, 0x73, 0xD2, 0x69, 0x98, 0x97, 0x5A, 0xEB, 0x65, 0xFE,
+    0x38, 0x4D, 0xDD, 0x6E, 0x7E, 0xDD, 0xAA, 0xA9, 0xBA, 0x88, 0x6D, 0xAD, 0x14, 0xDB, 0xE3, 0x17,
+    0xFA, 0x1D, 0x7D, 0xFB, 0x5B, 0x9A, 0xBC, 0x8E, 0xB0, 0x21, 0xBD, 0x27, 0xBC, 0xD2, 0xB8, 0x94,
+    0x70, 0xFB, 0xE2, 0x21, 0x1A, 0x6D, 0x20, 0xED, 0x74, 0xD2, 0x56, 0xE9, 0x23, 0x25, 0x7F, 0x54,
+    0x5A, 0xB4, 0x38, 0xFD, 0x86, 0xF0, 0x67, 0xD8, 0x08, 0xBB, 0x22, 0xFA, 0xB6, 0x70, 0x7A, 0x7D,
+    0xC7, 0x67, 0xAD, 0x8C, 0x3F, 0xD4, 0x50, 0xEB, 0xF7, 0x4E, 0x7C, 0x0E, 0x3B, 0xF3, 0x3A, 0xA7,
+    0x56, 0x95, 0x7E, 0x64, 0x49, 0x05, 0x4B, 0xA0, 0x1B, 0x44, 0x7A, 0x70, 0x6B, 0x1C, 0x5B, 0x0D,
+    0xE3, 0xCA, 0xAC, 0x37, 0xB4, 0x23, 0xFD, 0x9E, 0x32, 0x8F, 0x34, 0xEB, 0xA0, 0xD2, 0xE9, 0x4F,
+    0x2A, 0xED, 0xED, 0x49, 0xAD, 0xD4, 0x9E, 0x38, 0xC5, 0xF6, 0xC4, 0x69, 0xF2, 0x07, 0x8D, 0xF0,
+    0xB9, 0x50, 0xDC, 0xDB, 0x83, 0x7E, 0xC7, 0x67, 0x42, 0xC2, 0xEF, 0x8C, 0x89, 0x6E, 0xB7, 0x00,
+    0xD8, 0x69, 0x22, 0x9C, 0xAF, 0xEB, 0x52, 0x13, 0x1C, 0xA5, 0x04, 0xF3, 0xF7, 0x35, 0x80, 0x96,
+    0x87, 0x97, 0x69, 0x63, 0xB6, 0xAB, 0x2E, 0x25, 0xB5, 0x01, 0x68, 0xF4, 0x81, 0x65, 0xDB, 0x28,
+    0x13, 0x88, 0xD7, 0x1E, 0xFD, 0x31, 0x7F, 0x35, 0xA0, 0x9A, 0xAF, 0x80, 0xAA, 0xDF, 0x09, 0xEB,
+    0x5D, 0x40, 0x35, 0x3D, 0x05, 0xA8, 0x36, 0xA7, 0x41, 0x07, 0x4A, 0x87, 0xE8, 0x75, 0x8E, 0xB1,
+    0x91, 0xFA, 0x15, 0x9D, 0x7E, 0xC7, 0x1F, 0xEE, 0x80, 0x17, 0x2A, 0x0D, 0x05, 0xB9, 0xDA, 0x1C,
+    0x34, 0xE4, 0x70, 0x5E, 0xC2, 0x8A, 0x50, 0xCA, 0x7A, 0x91, 0xFB, 0x8F, 0x1E, 0x15, 0x96, 0xC6,
+    0xEB, 0x7B, 0x93, 0x47, 0xBD, 0xA3, 0x3F, 0x57, 0x0E, 0xC7, 0x6B, 0xFA, 0xBA, 0xA2, 0xFF, 0x48,
+    0x19, 0xCD, 0x9F, 0x1E, 0xBC, 0xA2, 0x45, 0x2C, 0xBD, 0x8A, 0x11, 0x0B, 0x7B, 0x89, 0x9D, 0xE6,
+    0x74, 0xA9, 0xA3, 0x2D, 0x66, 0x77, 0x6A, 0x4D, 0x97, 0xD2, 0xD6, 0x70, 0x71, 0x32, 0x30, 0x58,
+    0xB0, 0x3F, 0x6A, 0x67, 0x96, 0x18, 0xFF, 0x72, 0x9E, 0x42, 0x72, 0xD1, 0x67, 0x9E, 0x77, 0x9A,
+    0x8C, 0xB7, 0xD0, 0x69, 0xB1, 0x84, 0x5E, 0xA7, 0xC5, 0xCE, 0xB4, 0x9A, 0xFE, 0x29, 0x5A, 0x67,
+    0xBA, 0x3D, 0xA4, 0xF6, 0xF0, 0xFA, 0x97, 0x72, 0x92, 0x08, 0x92, 0xE9, 0x43, 0xF5, 0xD0, 0x8C,
+    0x37, 0x7E, 0xBF, 0x45, 0x5F, 0x21, 0x51, 0xCD, 0xDA, 0x7B, 0x23, 0xC7, 0xEC, 0x8F, 0xF4, 0xDD,
+    0x2F, 0x55, 0x8A, 0xD4, 0x9A, 0x70, 0x1A, 0xCA, 0x9F, 0x99, 0xCE, 0xD6, 0x12, 0x6D, 0x78, 0x73,
+    0xA5, 0x43, 0x97, 0xEB, 0xB5, 0xCF, 0x7D, 0xEA, 0xAD, 0x6E, 0x38, 0x79, 0x9D, 0x26, 0xB0, 0x17,
+    0x6E, 0x8D, 0x33, 0x95, 0x7E, 0x5D, 0xA2, 0xCB, 0x5E, 0x99, 0x79, 0xFD, 0x95, 0x39, 0x39, 0x0D,
+    0x95, 0x26, 0x53, 0xA8, 0x90, 0x08, 0xA9, 0xD2, 0x64, 0x93, 0xB8, 0x39, 0x09, 0x89, 0x7E, 0xAB,
+    0x14, 0x51, 0xF4, 0x27, 0xEE, 0x64, 0xDC, 0xE9, 0x37, 0xA7, 0x05, 0xC5, 0x5E, 0x38, 0xD5, 0x1F,
+    0xE7, 0xFF, 0xC2, 0xE7, 0xFE, 0xEB, 0x1F, 0xED, 0xA3, 0xF2, 0xA8, 0x45, 0x5A, 0x74, 0x3A, 0x65,
+    0xA7, 0xD5, 0x69, 0x6A, 0x0E, 0x78, 0x58, 0xB0, 0x00, 0xDC, 0x3F, 0xE9, 0xB7, 0xA0, 0x29, 0xE4,
+    0x51, 0xB1, 0x3B, 0xFE, 0xB1, 0xA2, 0x3F, 0xD0, 0xE2, 0x33, 0xF3, 0xEA, 0x33, 0x63, 0xF2, 0x99,
+    0x90, 0xFC, 0x46, 0x48, 0x5D, 0x22, 0xA4, 0xB0, 0xD2, 0xA7, 0x10, 0xE9, 0xD3, 0x3C, 0xD0, 0xFD,
+    0x40, 0xD0, 0x7D, 0x98, 0x4B, 0x3C, 0xEC, 0x0D, 0x6C, 0x4E, 0x25, 0xEE, 0xF5, 0x19, 0x0A, 0x37,
+    0xF8, 0x16, 0x7F, 0x54, 0xF3, 0xD4, 0x6D, 0xB5, 0x5E, 0xD6, 0xD6, 0x08, 0xFD, 0x40, 0x27, 0xF3,
+    0xD2, 0xE5, 0xD7, 0x14, 0xBB, 0xDD, 0x89, 0xB0, 0x39, 0x31, 0xC7, 0xF6, 0x40, 0xB1, 0x4F, 0x68,
+    0x0A, 0xA9, 0xDD, 0x09, 0xA9, 0x3B, 0xDC, 0x81, 0xCF, 0xAD, 0x06, 0x51, 0xCB, 0x69, 0x1D, 0x27,
+    0xC6, 0x77, 0xB4, 0x87, 0x48, 0x97, 0x74, 0x76, 0x2B, 0x2E, 0x8F, 0xE3, 0xD7, 0x13, 0x68, 0x7C,
+    0xF5, 0xC3, 0x0D, 0x82, 0xDE, 0x53, 0x06, 0xAF, 0x68, 0xD8, 0x77, 0x09, 0x56, 0x3C, 0xF5, 0x27,
+    0x10, 0xD6, 0xE6, 0xB4, 0xA6, 0xBD, 0xFD, 0x94, 0xB3, 0x1C, 0x17, 0xC6, 0xA5, 0x53, 0x6C, 0x15,
+    0xA5, 0x61, 0x96, 0x93, 0x1A, 0x6D, 0xF8, 0x1C, 0xBE, 0x31, 0xD1, 0x7F, 0x94, 0x2D, 0xF9, 0x52,
+    0x1C, 0xD6, 0xB5, 0x9A, 0x35, 0x5C, 0xE1, 0x5C, 0x21, 0x24, 0x5A, 0x12, 0x34, 0x41, 0x9D, 0xB5,
+    0xF0, 0xAB, 0xE3, 0x5F, 0x28, 0x22, 0x39, 0xCD, 0xBF, 0xA3, 0xE4, 0x75, 0x74, 0x1A, 0x3A, 0xA5,
+    0xB0, 0xD1, 0x1F, 0xBC, 0x70, 0x6B, 0x83, 0x2E, 0xE3, 0x81, 0xD3, 0xEE, 0x14, 0x19, 0x15, 0xBB,
+    0x83, 0xFB, 0x6F, 0x65, 0x64, 0xA9, 0x09, 0x4B, 0xA0, 0x29, 0x62, 0x03, 0x83, 0x93, 0xD5, 0x67,
+    0x52, 0x97, 0xA0, 0x56, 0x7D, 0x02, 0x5D, 0x0A, 0x11, 0x2A, 0x35, 0x19, 0xF0, 0xC9, 0x10, 0xE1,
+    0xAB, 0x2B, 0xE0, 0x3F, 0x34, 0xFF, 0x3C, 0x0F, 0x94, 0xC1, 0xBA, 0xD0, 0x7B, 0xBC, 0xE1, 0xD3,
+    0x92, 0xA7, 0xD8, 0xEF, 0x60, 0xD5, 0x39, 0xC2, 0xDF, 0xA0, 0x4F, 0xE0, 0xCE, 0xB7, 0xF2, 0xD5,
+    0x12, 0x95, 0x8C, 0x4D, 0x28, 0x09, 0xD0, 0x2B, 0x2D, 0x6B, 0x20, 0xEC, 0x2E, 0x23, 0xFD, 0xCE,
+    0x51, 0xCB, 0x80, 0xB9, 0x36, 0x77, 0x7C, 0x4E, 0xAB, 0xDB, 0xD1, 0xE4, 0x92, 0x3B, 0xE1, 0x4D,
+    0xBF, 0x5F, 0xD0, 0x62, 0xC9, 0xFA, 0x15, 0x65, 0xE9, 0x13, 0x30, 0xC7, 0x66, 0xA8, 0x45, 0xBB,
+    0xB4, 0xFA, 0xFD, 0x2E, 0xF5, 0x92, 0xD2, 0x28, 0x69, 0x1D, 0xFF, 0x5C, 0x8A, 0x7D, 0x1C, 0x75,
+    0xEB, 0x95, 0x28, 0x79, 0x4C, 0xCB, 0x01, 0x38, 0xFD, 0x41, 0x09, 0xAF, 0x4B, 0xD0, 0xEC, 0x93,
+    0x31, 0xD8, 0xAB, 0xEB, 0x3A, 0x81, 0x74, 0xBB, 0xCC, 0xA0, 0xD2, 0x50, 0x26, 0x70, 0x2C, 0x5C,
+    0xFC, 0x0B, 0xE3, 0xFF, 0x7A, 0x67, 0x09, 0xD9, 0xB9, 0x3E, 0xF3, 0x72, 0x61, 0x2B, 0xCC, 0x78,
+    0x15, 0x9A, 0xBC, 0x7F, 0xFC, 0x10, 0x67, 0x14, 0x82, 0xC1, 0x82, 0x6C, 0x0B, 0x41, 0x6C, 0xC9,
+    0x46, 0xBF, 0xE2, 0x37, 0x5C, 0xA6, 0x7A, 0xC6, 0xE7, 0x79, 0x7A, 0xEA, 0x73, 0x58, 0x9E, 0xFE,
+    0x9C, 0x9E, 0xFA, 0xDC, 0xDC, 0xFD, 0xFC, 0xA9, 0x2F, 0x5D, 0x06, 0x40, 0x2B, 0xB5, 0x32, 0x4E,
+    0x27, 0xD5, 0x67, 0x65, 0x7D, 0xAF, 0x6C, 0x0D, 0x12, 0xF5, 0x61, 0xED, 0x6E, 0x72, 0xC9, 0x60,
+    0x24, 0xC3, 0x8B, 0x61, 0xB1, 0x6E, 0x84, 0x4B, 0x86, 0xC3, 0x6C, 0x57, 0x29, 0x3C, 0x51, 0xC9,
+    0x24, 0xE6, 0xCA, 0xD7, 0x2F, 0x7F, 0x4D, 0xF9, 0x6B, 0xB3, 0x59, 0xCB, 0x2E, 0xF1, 0x60, 0x4C,
+    0x04, 0x45, 0x46, 0x0D, 0x8C, 0xFB, 0x9D, 0x48, 0xAC, 0x39, 0x69, 0x26, 0x69, 0xE8, 0xBF, 0x26,
+    0x7D, 0x53, 0x41, 0xD2, 0xAE, 0x5A, 0x7A, 0x2F, 0x55, 0xCA, 0xD5, 0xC4, 0xFF, 0x3C, 0x50, 0x25,
+    0xFE, 0x3E, 0xB5, 0x08, 0x6B, 0xAD, 0x61, 0x4C, 0x4E, 0xC3, 0x9C, 0x9A, 0x72, 0x90, 0x7D, 0xAC,
+    0x14, 0xC3, 0xC6, 0xBC, 0x79, 0xE1, 0x55, 0x69, 0x41, 0x4B, 0x97, 0xF1, 0xB9, 0xD2, 0x84, 0xA6,
+    0x6E, 0xC3, 0xAF, 0xD5, 0x01, 0x0F, 0x79, 0x8E, 0x7A, 0xE5, 0x57, 0xA9, 0x44, 0x58, 0x2C, 0x66,
+    0x6D, 0xC4, 0xBC, 0x30, 0x27, 0x7F, 0xE0, 0xCF, 0x5A, 0x4B, 0xAD, 0x18, 0x76, 0xC6, 0xE4, 0x0F,
+    0xC6, 0xAD, 0xD5, 0xE5, 0xE0, 0x4F, 0x0B, 0xE9, 0xC7, 0xD5, 0x1F, 0xF8, 0xA5, 0xCE, 0x30, 0x14,
+    0x4B, 0x5D, 0x17, 0x3C, 0xF4, 0x05, 0xEE, 0xC6, 0x69, 0x85, 0x69, 0x50, 0xD8, 0xC8, 0xD7, 0xFC,
+    0x33, 0x2F, 0x95, 0xCB, 0xF7, 0x87, 0x67, 0x91, 0x41, 0xEF, 0x6F, 0x45, 0x79, 0x0B, 0x9C, 0xB7,
+    0x28, 0xCF, 0x5F, 0x22, 0xC7, 0x5C, 0x72, 0xA4, 0xCB, 0x9D, 0x3C, 0x77, 0x25, 0xA3, 0x25, 0x86,
+    0x6F, 0x09, 0xA0, 0xDD, 0x2D, 0x18, 0x94, 0x4D, 0xD3, 0x7E, 0xED, 0x37, 0xA0, 0xC9, 0x86, 0x1C,
+    0x34, 0x75, 0x36, 0x9D, 0x2A, 0x45, 0x70, 0x87, 0xB5, 0x76, 0xB6, 0x9A, 0x57, 0x67, 0x95, 0x3A,
+    0x57, 0xD2, 0xFE, 0xE3, 0x77, 0x1F, 0xBD, 0x25, 0xEB, 0xCF, 0x98, 0xA8, 0x35, 0x58, 0xE2, 0x7E,
+    0xBD, 0x66, 0xEC, 0x9D, 0x96, 0x56, 0x8F, 0x69, 0xA5, 0x6F, 0x49, 0x6B, 0x25, 0x9D, 0x41, 0x07,
+    0x7D, 0xA9, 0x9F, 0x15, 0x62, 0xA7, 0x2D, 0xF8, 0xBA, 0xA4, 0x16, 0x0A, 0x79, 0xB9, 0xF8, 0xDD,
+    0xC2, 0x1D, 0xBD, 0x4D, 0xC7, 0x7F, 0xEA, 0x99, 0x42, 0xF9, 0x79, 0x92, 0x4A, 0xF5, 0x3F, 0x71,
+    0xB5, 0x9E, 0x57, 0x72, 0x72, 0x89, 0xC0, 0xA8, 0x4B, 0xA3, 0xE7, 0x58, 0x82, 0x28, 0xB7, 0xD9,
+    0xCA, 0xBA, 0xFF, 0xEA, 0xE7, 0x5E, 0x57, 0x4C, 0x37, 0x86, 0x2F, 0xD8, 0x0C, 0xEA, 0x37, 0xA0,
+    0xD2, 0x7B, 0x16, 0xB8, 0x5A, 0x2B, 0x2B, 0x5B, 0xE4, 0x77, 0xC5, 0x27, 0x3F, 0xDF, 0x24, 0xD5,
+    0x9F, 0x15, 0xBA, 0xE7, 0x73, 0x77, 0xB4, 0xD9, 0x26, 0xF1, 0xAB, 0x56, 0xDF, 0x30, 0xAA, 0x74,
+    0x2C, 0x8C, 0xEC, 0x0B, 0x08, 0xBA, 0x0B, 0xFA, 0xE0, 0x97, 0x6D, 0xA8, 0xD6, 0x3B, 0x49, 0xB2,
+    0x52, 0x17, 0x99, 0x8B, 0xBA, 0x96, 0x4C, 0x9B, 0x4D, 0x96, 0xCF, 0xF3, 0x54, 0x75, 0xEA, 0x67,
+    0x8A, 0x98, 0x79, 0x5D, 0x06, 0x4B, 0xBB, 0x70, 0xCD, 0x8F, 0xD4, 0x85, 0x8C, 0x66, 0x94, 0xA7,
+    0x3B, 0x4C, 0x33, 0xFE, 0x88, 0x9F, 0xFD, 0x0E, 0xFF, 0x2D, 0xEB, 0x6F, 0xB6, 0xE1, 0xB4, 0x69,
+    0x66, 0x69, 0xA0, 0x0F, 0x4F, 0xA0, 0xCD, 0x3E, 0x81, 0x13, 0x61, 0x80, 0x7E, 0xA8, 0x96, 0x9F,
+    0xFD, 0x11, 0x06, 0xA8, 0xB7, 0x66, 0x05, 0xF4, 0xAE, 0x71, 0x22, 0xC3, 0x06, 0xB5, 0xDE, 0x10,
+    0xD0, 0xAD, 0xFD, 0xF2, 0x74, 0x1A, 0xCE, 0xEA, 0xE8, 0x37, 0xAF, 0x58, 0x1F, 0x8D, 0xB5, 0x7B,
+    0x18, 0x09, 0x75, 0xA1, 0xD1, 0xF0, 0xD9, 0x0C, 0x73, 0x22, 0x44, 0xBC, 0x70, 0x3B, 0x68, 0x25,
+    0x0C, 0xF8, 0x83, 0x6A, 0xBA, 0xE4, 0x95, 0xFB, 0xBB, 0x04, 0xD8, 0x70, 0x21, 0xDA, 0xDA, 0x0A,
+    0x1E, 0x6D, 0xD0, 0xEA, 0xE6, 0xE6, 0xDA, 0x47, 0xEB, 0xF0, 0x2D, 0xEB, 0xA7, 0xDA, 0xA8, 0x15,
+    0x09, 0x13, 0x61, 0xA7, 0xDD, 0x70, 0xB6, 0xC4, 0x62, 0xFE, 0xE8, 0x91, 0x52, 0x65, 0xE2, 0xB7,
+    0xD5, 0x63, 0x4E, 0x85, 0xEC, 0xF2, 0xF0, 0x32, 0x73, 0xC3, 0x65, 0x85, 0x92, 0xCD, 0x56, 0x23,
+    0x72, 0xA4, 0x4F, 0x22, 0x9C, 0x07, 0x46, 0x49, 0xCE, 0x78, 0x29, 0xD1, 0x19, 0x9B, 0x73, 0x2A,
+    0xC2, 0x7E, 0x9A, 0x30, 0x5A, 0x99, 0x71, 0xFD, 0x49, 0x84, 0xD1, 0x1F, 0xC3, 0x2F, 0xDD, 0xCB,
+    0xCA, 0xA9, 0xD9, 0x88, 0x29, 0x5B, 0x21, 0x24, 0x02, 0x7F, 0x17, 0x68, 0x96, 0x12, 0x5A, 0xF4,
+    0x2A, 0xF9, 0xA3, 0x51, 0x83, 0xB5, 0xE4, 0x49, 0x40, 0xF6, 0xD3, 0x6F, 0xEF, 0xFF, 0x40, 0xA9,
+    0x7D, 0x36, 0x97, 0xD5, 0x71, 0xCC, 0xEF, 0x67, 0x6A, 0x99, 0x27, 0x3E, 0x68, 0x56, 0xFE, 0xC1,
+    0x27, 0x6A, 0xF5, 0xD6, 0x5A, 0x2F, 0xA5, 0xB2, 0x22, 0xCF, 0x56, 0xFA, 0x6C, 0x97, 0xB2, 0x73,
+    0x61, 0x77, 0x96, 0x91, 0xAF, 0xAE, 0x6B, 0xCD, 0x9C, 0x1D, 0xA6, 0xD2, 0xEA, 0x56, 0x17, 0x4B,
+    0x6C, 0x87, 0xF3, 0x32, 0x2B, 0xFA, 0x7C, 0xE9, 0xA1, 0x3D, 0x78, 0x2F, 0x84, 0xDD, 0x50, 0x0E,
+    0xD7, 0x29, 0xF0, 0x76, 0x95, 0x71, 0x96, 0xF7, 0xF6, 0x27, 0xCD, 0xE9, 0x33, 0x2E, 0xB7, 0x1B,
+    0x0C, 0x0C, 0xFF, 0xBF, 0x6C, 0xF3, 0xDB, 0x58, 0xA4, 0x1A, 0xF6, 0x6E, 0x30, 0x3F, 0xF4, 0xBD,
+    0xAD, 0x40, 0x05, 0xF3, 0x48, 0xDD, 0x1B, 0x05, 0xAA, 0xFC, 0xEF, 0xED, 0x4F, 0x5E, 0xCF, 0xF5,
+    0xE0, 0x06, 0x1E, 0xDC, 0xBC, 0x82, 0x57, 0xA6, 0x31, 0xE6, 0x74, 0x64, 0xD6, 0x4E, 0xA3, 0x93,
+    0x5A, 0x8F, 0x0D, 0xF4, 0x1A, 0xC7, 0x45, 0x13, 0x61, 0x31, 0xF8, 0xD7, 0xE4, 0x82, 0x4B, 0xE6,
+    0x42, 0x8A, 0x6A, 0x77, 0xA8, 0xA4, 0x0D, 0x0D, 0xD0, 0x7F, 0xA8, 0xC9, 0x6F, 0xE0, 0xCE, 0x90,
+    0x2B, 0x01, 0xE1, 0x1B, 0x5A, 0xFB, 0x04, 0x2E, 0x7B, 0x0B, 0xEE, 0xC7, 0x38, 0xEE, 0x61, 0x81,
+    0x36, 0x3B, 0xBD, 0x97, 0x01, 0x4D, 0xFD, 0x31, 0xDA, 0x92, 0x76, 0x7D, 0x6C, 0xB1, 0xAE, 0x31,
+    0x77, 0xFA, 0x64, 0x2C, 0xAC, 0xFA, 0x2C, 0xC5, 0x92, 0xB0, 0x9A, 0x7A, 0xB9, 0x03, 0x8C, 0xAA,
+    0xB7, 0xD0, 0x98, 0x4E, 0xAE, 0x04, 0x5B, 0xE7, 0x5F, 0x98, 0x42, 0xBA, 0x96, 0x78, 0x2F, 0x91,
+    0x76, 0x65, 0x38, 0xEB, 0xD7, 0xEE, 0xD8, 0x79, 0x5B, 0xAF, 0x68, 0x8F, 0xB8, 0xF2, 0xE7, 0xCA,
+    0xA5, 0xA7, 0xC3, 0x1E, 0xA3, 0x0D, 0x36, 0x17, 0xC6, 0xB0, 0xF2, 0xED, 0xAA, 0x9C, 0x3F, 0x98,
+    0x35, 0x78, 0x45, 0x94, 0x0B, 0x5B, 0x70, 0xCC, 0x10, 0x4E, 0xA3, 0x0A, 0xFE, 0x40, 0x09, 0x7A,
+    0x19, 0x4F, 0xF0, 0x87, 0x46, 0xD2, 0x34, 0x92, 0xE0, 0xC7, 0x8A, 0xD0, 0x17, 0x92, 0xA6, 0x31,
+    0x36, 0x0F, 0xA3, 0x07, 0x7E, 0x5D, 0x13, 0xCC, 0xBB, 0x71, 0x03, 0x5B, 0x45, 0x6A, 0xAD, 0xE3,
+    0x01, 0x63, 0x76, 0x4A, 0x74, 0x1A, 0x7A, 0x2D, 0x2F, 0x5D, 0x57, 0x4D, 0x38, 0xF3, 0x34, 0xDE,
+    0x2A, 0x7C, 0x2F, 0x19, 0xDD, 0xB1, 0xBA, 0x52, 0xF9, 0xA6, 0x3B, 0x51, 0x9F, 0x01, 0xC8, 0xAE,
+    0xB0, 0xC5, 0x97, 0x4B, 0x72, 0x1A, 0xE6, 0x0F, 0x7E, 0x4C, 0xB0, 0xF7, 0x33, 0xDA, 0xED, 0xEA,
+    0xF3, 0x5C, 0x97, 0xC7, 0xDB, 0xC2, 0x32, 0x1A, 0x59, 0x09, 0x68, 0x4C, 0xC0, 0xBC, 0x58, 0xDA,
+    0xC9, 0xED, 0x50, 0xED, 0xFC, 0xCD, 0x9F, 0x9B, 0xD1, 0x06, 0xE8, 0xA7, 0x11, 0xF0, 0xB9, 0xDB,
+    0x2D, 0x3A, 0x99, 0x2E, 0xCE, 0x1D, 0xD5, 0x07, 0x50, 0x3D, 0x23, 0x38, 0xF9, 0xD9, 0x64, 0x22,
+    0xD7, 0x17, 0x1C, 0x53, 0x72, 0x19, 0xA6, 0xEB, 0x06, 0xA3, 0xAE, 0x29, 0x0D, 0x23, 0x95, 0x51,
+    0xCD, 0x85, 0x20, 0x1B, 0x9F, 0x81, 0x57, 0x5F, 0xA9, 0x6E, 0x6E, 0x1E, 0x4A, 0x27, 0xB6, 0x9F,
+    0xC4, 0x30, 0x4A, 0xAD, 0xCE, 0xA1, 0xD5, 0x63, 0x7A, 0x63, 0x31, 0x78, 0x8B, 0x1B, 0x9D, 0x26,
+    0x9C, 0xA8, 0xB4, 0x5C, 0x19, 0x83, 0xF3, 0xFA, 0x93, 0xEE, 0x99, 0xEC, 0x9E, 0x85, 0x50, 0xEE,
+    0x39, 0x7F, 0xC2, 0x3D, 0xBD, 0x6D, 0xD1, 0xD2, 0x6A, 0xA0, 0xDF, 0xA9, 0x0B, 0x7F, 0x7C, 0xD4,
+    0x30, 0x5E, 0x58, 0xB8, 0x5C, 0x0A, 0xCB, 0x97, 0x8A, 0x7E, 0x59, 0xBB, 0x01, 0x37, 0xB7, 0xFD,
+    0x99, 0xEE, 0xEC, 0xCA, 0x63, 0xBB, 0x7B, 0x70, 0x59, 0x02, 0xD1, 0x15, 0x14, 0x56, 0xF8, 0x6A,
+    0x76, 0xAD, 0x7E, 0x93, 0x9F, 0x73, 0x99, 0x54, 0x5F, 0xE2, 0x42, 0x1E, 0xBC, 0xB2, 0xC9, 0x2E,
+    0xFB, 0xDA, 0x38, 0xD9, 0x2E, 0x1A, 0x96, 0x70, 0x6E, 0x4E, 0x5B, 0x72, 0xFC, 0x36, 0xCD, 0xF0,
+    0x73, 0xAE, 0x27, 0xD6, 0xA9, 0x5C, 0xEF, 0x25, 0x8B, 0x61, 0xB4, 0x3F, 0x2B, 0xC8, 0x6F, 0x63,
+    0x02, 0x9A, 0xDD, 0x56, 0x85, 0x3F, 0xCF, 0x53, 0x9E, 0xE1, 0x9E, 0x2D, 0x2C, 0x7B, 0x59, 0xDA,
+    0x9D, 0xF4, 0x03, 0xE9, 0xA8, 0xA4, 0xDC, 0xEB, 0x31, 0xBD, 0x3E, 0xB8, 0xDB, 0x97, 0x90, 0x2E,
+    0x7D, 0x69, 0x34, 0xD0, 0xA8, 0x90, 0x82, 0xA7, 0x9F, 0x70, 0xCF, 0x93, 0xC4, 0xE1, 0x79, 0xB9,
+    0x90, 0x82, 0x9F, 0x7D, 0x4F, 0x61, 0xED, 0xF6, 0x07, 0xCC, 0x2B, 0xAD, 0x49, 0xBB, 0xD2, 0x51,
+    0x69, 0xB7, 0x54, 0x47, 0x09, 0xA3, 0x4A, 0x5A, 0xC8, 0x98, 0x03, 0x66, 0x46, 0xAE, 0x76, 0xF3,
+    0x05, 0x80, 0xCE, 0xD2, 0x2A, 0xD7, 0x90, 0x57, 0xCB, 0x95, 0xC8, 0x62, 0x5B, 0xAE, 0xA4, 0xCB,
+    0x4E, 0x3B, 0x77, 0x5E, 0xCF, 0x03, 0xB5, 0xBE, 0x21, 0x9C, 0x4E, 0x4D, 0x8D, 0x71, 0xCC, 0xBF,
+    0xA7, 0xE4, 0x34, 0x85, 0xBD, 0x52, 0xBC, 0xF2, 0x8C, 0x56, 0x2C, 0xFB, 0xBB, 0xFA, 0x4C, 0xD8,
+    0x1A, 0xD1, 0xE5, 0x5A, 0x93, 0x17, 0x5A, 0x5A, 0x4D, 0x61, 0x73, 0x5A, 0xFD, 0xE1, 0x3E, 0xDE,
+    0xFF, 0x9E, 0xDE, 0xFB, 0x0F, 0x1A, 0x67, 0xED, 0xB3, 0xDE, 0x57, 0xEE, 0xF5, 0x9E, 0x72, 0xA3,
+    0x18, 0x76, 0x34, 0xF1, 0xF0, 0x89, 0xE5, 0x23, 0xFF, 0xDD, 0x65, 0x93, 0x1C, 0x63, 0x67, 0xDC,
+    0xB2, 0x0D, 0x9A, 0x83, 0x92, 0xF9, 0xB7, 0x9D, 0xAE, 0xFE, 0xCE, 0x93, 0x4D, 0xFE, 0x69, 0x10,
+    0xD9, 0x0A, 0x6D, 0x76, 0xBA, 0x10, 0x36, 0x82, 0xA9, 0xE6, 0x02, 0xDD, 0x77, 0x32, 0x74, 0xEB,
+    0x38, 0xE0, 0x53, 0xBB, 0xD0, 0xAE, 0xA4, 0x9F, 0xBA, 0x80, 0xDF, 0xAE, 0x76, 0x98, 0xDF, 0xD1,
+    0x40, 0x48, 0x5A, 0xF0, 0x7B, 0x48, 0xB8, 0xFD, 0x59, 0x88, 0xFA, 0xA7, 0x21, 0xCB, 0xFF, 0x7C,
+    0x8C, 0x3B, 0x34, 0x58, 0xE8, 0xF2, 0x7A, 0x84, 0x2E, 0xDA, 0x80, 0xC9, 0x2A, 0x49, 0xFE, 0xCD,
+    0xBB, 0x88, 0x72, 0x2F, 0x09, 0xB3, 0x50, 0x16, 0x8E, 0xA2, 0xA5, 0x80, 0xE7, 0x71, 0xFA, 0xC4,
+    0x66, 0x62, 0xCF, 0x59, 0xCC, 0x5D, 0xDB, 0xD2, 0xCD, 0xE4, 0x4E, 0x9F, 0xDD, 0x51, 0xA9, 0x3E,
+    0x99, 0xA3, 0x6D, 0x23, 0x10, 0x52, 0x58, 0x42, 0xEA, 0xD2, 0x9C, 0xDA, 0x53, 0x4B, 0x2D, 0x4D,
+    0xE8, 0x80, 0x90, 0xF8, 0x45, 0x9F, 0xF1, 0xEF, 0x6A, 0xEA, 0xD3, 0x28, 0x6D, 0x5E, 0x65, 0xD7,
+    0x30, 0xFF, 0x44, 0x01, 0x1A, 0xF8, 0x57, 0x40, 0xB7, 0x94, 0x7A, 0xFE, 0xBC, 0x58, 0x0D, 0xD0,
+    0x82, 0x97, 0xA9, 0xA4, 0xF3, 0xFE, 0xC1, 0x27, 0x76, 0xB3, 0xA0, 0xD3, 0x54, 0xD6, 0x6A, 0x29,
+    0xA1, 0x37, 0x44, 0x58, 0xBA, 0xD4, 0xEE, 0xB5, 0x10, 0x61, 0xE9, 0x57, 0x9F, 0xDD, 0xE1, 0xC4,
+    0xF8, 0xAE, 0x62, 0x7B, 0x6A, 0x29, 0xAB, 0xF1, 0x16, 0x50, 0xE4, 0x97, 0x7D, 0xC6, 0xC7, 0x79,
+    0x6D, 0x73, 0x23, 0x69, 0x08, 0xD2, 0x52, 0xD9, 0x42, 0xA8, 0xED, 0xEE, 0x46, 0x30, 0xCC, 0x25,
+    0xB2, 0x6B, 0x0C, 0xC2, 0x40, 0xF8, 0xEA, 0x86, 0x4F, 0x21, 0xD6, 0x47, 0x95, 0x09, 0x43, 0x3B,
+    0x3D, 0xA9, 0xE9, 0x95, 0xF6, 0x12, 0xCF, 0x48, 0xF8, 0x3D, 0x24, 0x77, 0x54, 0x62, 0x9E, 0xFA,
+    0xE4, 0x93, 0x3B, 0xEA, 0x13, 0xC5, 0xB0, 0x84, 0xD4, 0xE4, 0x3E, 0x33, 0x7F, 0xFF, 0xA0, 0xD5,
+    0x09, 0xB2, 0x72, 0x7D, 0x3D, 0x28, 0x92, 0xDB, 0x93, 0x39, 0x8E, 0xB6, 0xBE, 0xE1, 0xA0, 0xB3,
+    0xD5, 0x83, 0x43, 0x91, 0x56, 0xBD, 0xB6, 0x11, 0xBD, 0x21, 0xFA, 0x7D, 0x4C, 0xB5, 0x9A, 0x83,
+    0x6E, 0x09, 0xD3, 0xD3, 0x3B, 0x7D, 0xFC, 0x67, 0x96, 0xCD, 0xDF, 0xC5, 0x2D, 0x84, 0x88, 0x62,
+    0xAD, 0xC9, 0x69, 0xA8, 0x45, 0x75, 0x70, 0x3B, 0xEF, 0xEF, 0x2B, 0x4A, 0x8D, 0xF2, 0x8B, 0x73,
+    0x42, 0x53, 0x73, 0xD2, 0x3F, 0x83, 0xA0, 0xB4, 0x38, 0x55, 0x3E, 0xFF, 0xF6, 0xA8, 0x1F, 0x48,
+    0x6F, 0x68, 0x6F, 0xCF, 0x5B, 0xB9, 0xFB, 0x01, 0x66, 0xB3, 0x80, 0x21, 0x51, 0x69, 0xC2, 0xEF,
+    0x30, 0x4F, 0xD4, 0x1B, 0xB8, 0xE1, 0x49, 0xDC, 0x8B, 0x53, 0xA6, 0x53, 0xE2, 0x35, 0x45, 0xDC,
+    0x69, 0xAA, 0x33, 0xDB, 0x7A, 0x93, 0x6E, 0x87, 0x79, 0xC1, 0x5D, 0x6A, 0x06, 0x2B, 0xB5, 0x06,
+    0x7C, 0x7E, 0x8E, 0xF0, 0x83, 0x54, 0x49, 0xB1, 0xD1, 0x89, 0xD7, 0x4A, 0x7F, 0xB7, 0x56, 0xD8,
+    0x47, 0xDA, 0x93, 0x4A, 0x1B, 0xA3, 0xA2, 0xFF, 0xF7, 0xD9, 0x65, 0xBF, 0x8A, 0xB1, 0x8B, 0xEE,
+    0x4E, 0xDE, 0xF0, 0xBE, 0xA2, 0x53, 0x66, 0x54, 0xBC, 0xFF, 0x56, 0x06, 0x4D, 0x74, 0xBB, 0x2D,
+    0x6E, 0x48, 0x34, 0x65, 0x6B, 0x95, 0x6C, 0xCB, 0x51, 0x76, 0x6A, 0x0D, 0x84, 0xF4, 0xBC, 0x53,
+    0xC7, 0xA8, 0xD4, 0xE8, 0x24, 0x68, 0xAA, 0x35, 0xD9, 0x82, 0xD6, 0xBD, 0x4E, 0xDD, 0x16, 0x56,
+    0x7D, 0x53, 0x6F, 0xA8, 0x3D, 0x9A, 0xD4, 0x2D, 0x4F, 0x81, 0xFB, 0xFF, 0xC4, 0x9D, 0x7C, 0x71,
+    0xF8, 0x65, 0xF0, 0x67, 0xB3, 0x50, 0xEB, 0x47, 0x07, 0x84, 0x59, 0x11, 0xB7, 0x6A, 0x83, 0xFF,
+    0xD6, 0x1D, 0xCF, 0xCC, 0x37, 0x3C, 0xC7, 0x7D, 0x4D, 0xFD, 0xDE, 0x28, 0x77, 0x5A, 0x66, 0x7D,
+    0x55, 0xBA, 0xFF, 0xD6, 0x21, 0x25, 0xA4, 0xDF, 0x10, 0x5E, 0xCB, 0xB8, 0x56, 0xDA, 0xDA, 0x83,
+    0xFE, 0x34, 0x6A, 0x98, 0xCF, 0x84, 0xDD, 0xB8, 0x3E, 0xFD, 0x66, 0x34, 0xC6, 0x3B, 0x54, 0xB5,
+    0x2E, 0x33, 0x2F, 0x5F, 0xD4, 0xE4, 0x8F, 0xFF, 0x25, 0xEC, 0x48, 0xDF, 0xBA, 0x43, 0x63, 0x3C,
+    0xEE, 0xD0, 0x18, 0xB9, 0xEE, 0x01, 0xE3, 0xD3, 0xB5, 0x66, 0x7F, 0x49, 0xD0, 0x58, 0x32, 0x7F,
+    0x06, 0xF8, 0xED, 0x27, 0x1A, 0x3B, 0x94, 0x4C, 0x77, 0xB0, 0x2D, 0xB1, 0x0E, 0xC6, 0x73, 0xCE,
+    0x4E, 0xC3, 0xB8, 0x85, 0x0D, 0x7D, 0x43, 0xD1, 0xE9, 0xF7, 0x0E, 0xFC, 0x19, 0x12, 0xE1, 0x47,
+    0x8A, 0xE8, 0xCF, 0x4F, 0x9C, 0xC2, 0x4E, 0x97, 0xB5, 0x30, 0x7F, 0x47, 0x93, 0x93, 0x3F, 0xE9,
+    0xF7, 0x3E, 0xD7, 0x8A, 0xE3, 0x31, 0x66, 0x64, 0x39, 0x96, 0xBD, 0xAC, 0xF4, 0xB9, 0x77, 0x57,
+    0x0B, 0x13, 0x50, 0x67, 0xAC, 0x1A, 0x5D, 0x98, 0x04, 0xDB, 0x25, 0x7C, 0xD5, 0x00, 0x1C, 0x00,
+    0xFF, 0xE4, 0xA9, 0x69, 0x5A, 0x95, 0x50, 0x70, 0x62, 0x94, 0x96, 0x4A, 0x1F, 0x29, 0x39, 0x0D,
+    0xE3, 0xE6, 0x0F, 0xC2, 0xD6, 0x65, 0xC2, 0x1E, 0x36, 0xC2, 0x1E, 0x92, 0x01, 0xBA, 0xB0, 0xCD,
+    0x2B, 0x21, 0x69, 0x65, 0x4C, 0x5A, 0x98, 0x57, 0xAD, 0x28, 0x6A, 0xAD, 0x35, 0xCD, 0xA9, 0x15,
+    0xE3, 0x31, 0x66, 0xA3, 0x4F, 0x97, 0x2D, 0xD8, 0x0E, 0x9E, 0x68, 0xA9, 0x6D, 0xAB, 0xB7, 0x15,
+    0x00, 0xDD, 0x69, 0xA5, 0x3A, 0x43, 0xC4, 0xA7, 0x30, 0x20, 0xBE, 0x42, 0x93, 0xD8, 0x7E, 0x1A,
+    0x62, 0xFC, 0x42, 0xB5, 0x53, 0xAB, 0x39, 0x70, 0xF2, 0x07, 0x4E, 0x3E, 0x53, 0xEF, 0x4D, 0x7A,
+    0xD6, 0x1E, 0x46, 0xFF, 0x1F, 0x8A, 0xCC, 0x6A, 0x4E, 0x7F, 0x0A, 0xD0, 0xEC, 0xB7, 0x35, 0xBF,
+    0xB2, 0xCC, 0x7F, 0xBD, 0xCD, 0x4F, 0x84, 0x08, 0xF0, 0xAB, 0xCF, 0x98, 0x34, 0xB5, 0x22, 0xE3,
+    0x32, 0x2B, 0x36, 0x72, 0x12, 0xFD, 0xFE, 0x29, 0xA3, 0xD2, 0x8C, 0xAB, 0x13, 0xB5, 0x06, 0x23,
+    0xDB, 0x8E, 0x2B, 0x21, 0xD5, 0x77, 0x18, 0x57, 0x63, 0x22, 0x24, 0x67, 0xA4, 0x82, 0x93, 0xF6,
+    0x40, 0x1B, 0x21, 0xB5, 0x8A, 0x28, 0x7E, 0x45, 0xCE, 0xA9, 0xFD, 0xE1, 0xF9, 0x95, 0x4E, 0xEA,
+    0xB4, 0x05, 0x6D, 0x41, 0x93, 0x84, 0x76, 0xB4, 0x56, 0x1A, 0x78, 0x81, 0xBB, 0x60, 0xBF, 0x5A,
+    0x6F, 0xCB, 0x64, 0x73, 0xBC, 0x42, 0x63, 0x2B, 0x3D, 0xEA, 0x0A, 0x98, 0x2D, 0x66, 0xE2, 0x4B,
+    0xCF, 0xE8, 0xC3, 0x4F, 0x97, 0x1E, 0x06, 0x54, 0xC7, 0x2D, 0x21, 0xBD, 0x2C, 0xF5, 0x4D, 0xC0,
+    0xFC, 0x99, 0x15, 0xDA, 0xAD, 0x8F, 0x30, 0x4E, 0x01, 0xDC, 0xFE, 0x49, 0x68, 0xFF, 0x53, 0x1E,
+    0x81, 0x9E, 0xB7, 0xC1, 0xA9, 0xCD, 0xD0, 0xE5, 0x90, 0x60, 0x5C, 0x34, 0xC1, 0xE1, 0xF6, 0x1F,
+    0x97, 0xD3, 0xFD, 0x69, 0x8A, 0xFA, 0xB5, 0x3F, 0xBE, 0xB9, 0xB9, 0xB9, 0xB9, 0xEC, 0xFC, 0x61,
+    0x1B, 0x17, 0x48, 0xD2, 0x66, 0xBB, 0x38, 0x95, 0xAA, 0x70, 0xA5, 0xF8, 0x40, 0xF4, 0x16, 0xFD,
+    0x85, 0xD8, 0x59, 0x00, 0xEB, 0x57, 0x2F, 0xF0, 0x47, 0x29, 0x11, 0x3B, 0xC1, 0xE7, 0x2F, 0x6B,
+    0x32, 0x6D, 0xE3, 0x94, 0x6B, 0x8A, 0xFD, 0x9A, 0x1C, 0xF7, 0x92, 0xE8, 0x8F, 0x52, 0x3D, 0x6A,
+    0x4B, 0xC0, 0xBB, 0x38, 0xC5, 0x52, 0x2D, 0xBB, 0xDE, 0x1D, 0x72, 0x49, 0x74, 0xB4, 0x16, 0x7F,
+    0x5A, 0x2D, 0xD3, 0x0A, 0x67, 0x63, 0xB6, 0xA5, 0x85, 0xAB, 0x57, 0x24, 0x6C, 0x34, 0x5B, 0xAD,
+    0x83, 0xEE, 0xC0, 0x65, 0xAB, 0x24, 0x3D, 0x7A, 0x4B, 0x65, 0x77, 0x93, 0x4B, 0x2E, 0x4A, 0x65,
+    0x9F, 0xB8, 0x42, 0x29, 0xE0, 0xE6, 0xEE, 0xEA, 0x04, 0x23, 0x75, 0xDE, 0xD7, 0x4A, 0x27, 0xD5,
+    0xD2, 0xD4, 0x48, 0xBB, 0x94, 0x2B, 0x7D, 0x24, 0xAD, 0x8A, 0x61, 0x6B, 0xB4, 0x35, 0xD9, 0x56,
+    0x32, 0xCF, 0xEF, 0x98, 0xA3, 0xDB, 0xC2, 0x46, 0xD8, 0x9D, 0x9C, 0x70, 0xFA, 0xB4, 0xE2, 0x98,
+    0x08, 0x69, 0x5E, 0xDB, 0x13, 0x27, 0x6D, 0x68, 0x65, 0xD4, 0x8E, 0x3F, 0x68, 0x65, 0x9B, 0xE0,
+    0x28, 0xF1, 0x8B, 0xFE, 0xA4, 0x17, 0x2E, 0xCD, 0xA9, 0xD5, 0x5E, 0xAB, 0xD1, 0xB7, 0x25, 0x69,
+    0x09, 0xD2, 0xFB, 0xD2, 0x86, 0xB4, 0x8D, 0x65, 0xC7, 0xB5, 0x0B, 0x2B, 0xF4, 0x15, 0x78, 0xF4,
+    0xE8, 0xD1, 0xA3, 0x3F, 0x79, 0x72, 0xC1, 0x13, 0x60, 0xE7, 0x1F, 0x3D, 0x7A, 0xF4, 0xE8, 0xD1,
+    0x5B, 0xFA, 0x09, 0xAF, 0x27, 0x75, 0x2D, 0xFA, 0xE4, 0xB7, 0x76, 0x6F, 0xB2, 0x3B, 0xD1, 0x30,
+    0xC7, 0x7E, 0x6B, 0xCF, 0x4A, 0xC3, 0x8B, 0x25, 0x05, 0x19, 0xB6, 0xF6, 0xAC, 0x34, 0x8D, 0x4B,
+    0x9F, 0xFC, 0xD6, 0x64, 0x97, 0xEB, 0xA3, 0x3A, 0xF8, 0xDB, 0xD7, 0x6F, 0xB7, 0xD1, 0x27, 0x9F,
+    0xFC, 0xE6, 0x53, 0xBB, 0xB7, 0x7B, 0x93, 0x9B, 0xEC, 0x4E, 0x77, 0xA2, 0x41, 0xCC, 0x71, 0x8E,
+    0xFD, 0xD6, 0xA7, 0xF6, 0x6C, 0xCF, 0x4A, 0x9F, 0xD6, 0xF0, 0x22, 0x2F, 0x02, 0xBF, 0xC5, 0x6F,
+    0x31, 0x2F, 0xF3, 0xD2, 0xEF, 0xFD, 0xDE, 0x9C, 0x8D, 0x5D, 0x1A, 0xE3, 0x18, 0xC3, 0x1A, 0xD6,
+    0x2E, 0x75, 0xC9, 0x6F, 0x7E, 0x6B, 0xF6, 0x76, 0x77, 0xD9, 0xED, 0xEC, 0xEC, 0x54, 0x03, 0xD5,
+    0x00, 0x0F, 0xFB, 0x84, 0xDF, 0x68, 0xF2, 0x98, 0x6C, 0x7F, 0x2B, 0x5B, 0xAF, 0xDF, 0x9D, 0x4A,
+    0x84, 0x9D, 0xEE, 0x98, 0x17, 0xE3, 0x3B, 0xFF, 0x12, 0x7C, 0x6A, 0xE0, 0xFE, 0x9B, 0xFF, 0x11,
+    0xBD, 0x9A, 0xBF, 0xB3, 0x25, 0xC7, 0x75, 0xDF, 0x3F, 0x33, 0xCD, 0xDD, 0x81, 0x3D, 0x74, 0x35,
+    0x02, 0xA0, 0xF4, 0x83, 0x2E, 0x4F, 0xE2, 0x80, 0x05, 0x93, 0x9E, 0x44, 0xA1, 0x4B, 0x3D, 0x80,
+    0x02, 0x04, 0x0A, 0xB8, 0xC1, 0x5E, 0x32, 0x40, 0x80, 0xC8, 0x55, 0x2E, 0x38, 0xD8, 0xD4, 0x81,
+    0xCD, 0x19, 0x1A, 0x55, 0x62, 0xC0, 0x00, 0x70, 0x95, 0xA4, 0x44, 0x81, 0x11, 0x48, 0x65, 0x6B,
+    0x15, 0xC0, 0x7F, 0x80, 0xCB, 0xDD, 0x00, 0x02, 0x04, 0x0C, 0x30, 0x36, 0xA9, 0x42, 0xE0, 0x00,
+    0x43, 0x81, 0x2A, 0xDA, 0x66, 0x80, 0xB6, 0x39, 0x28, 0xCC, 0x62, 0x7B, 0xE6, 0xEB, 0xE0, 0xCC,
+    0x7D, 0x6F, 0x77, 0x49, 0x4B, 0x2A, 0xD9, 0xE5, 0x5B, 0xB5, 0xF7, 0xBE, 0xB7, 0x6F, 0xEE, 0xCC,
+    0xE9, 0xD3, 0xE7, 0x7C, 0xCF, 0xF7, 0x7C, 0x4F, 0xC3, 0xF9, 0xAA, 0xD7, 0x66, 0x01, 0xF4, 0xBE,
+    0x06, 0xE8, 0x4A, 0x58, 0xA1, 0xD6, 0x9B, 0x02, 0xBA, 0xA5, 0x9F, 0x81, 0xE7, 0x79, 0xF6, 0xF5,
+    0xE2, 0xE5, 0x72, 0xB9, 0x8F, 0x97, 0xA4, 0x05, 0x49, 0xDA, 0x69, 0x25, 0x69, 0xA6, 0xD1, 0xF0,
+    0x9D, 0x02, 0x31, 0x13, 0x12, 0x5E, 0xB8, 0x0D, 0xB4, 0x10, 0x06, 0xFC, 0x4E, 0x35, 0x51, 0x29,
+    0x01, 0xF4, 0x05, 0xC0, 0xD9, 0x2F, 0x41, 0x2A, 0xE0, 0x24, 0x25, 0x18, 0xA5, 0x15, 0x5A, 0x5D,
+    0x2E, 0x80, 0x16, 0x00, 0x7F, 0x00, 0x54, 0x9A, 0xCF, 0x6F, 0x56, 0x2B, 0xB5, 0x12, 0x61, 0x22,
+    0x6C, 0xB4, 0x2B, 0x4E, 0x03, 0x82, 0xF8, 0xE5, 0x43, 0xE5, 0x4A, 0x92, 0x0E, 0x82, 0x24, 0xCD,
+    0x4E, 0x92, 0xCA, 0x53, 0x96, 0x3F, 0x18, 0x00, 0xE8, 0x57, 0x00, 0x1A, 0x4D, 0x00, 0x9C, 0x17,
+    0xF5, 0x66, 0x8F, 0xD3, 0x6E, 0xFF, 0x6B, 0x4F, 0xEC, 0xBE, 0x38, 0x00, 0xDC, 0x1E, 0x32, 0x40,
+    0x7C, 0x53, 0x00, 0x3E, 0x87, 0x0C, 0xD4, 0x47, 0xAD, 0x01, 0x18, 0x53, 0xBF, 0x01, 0x7E, 0xAB,
+    0x94, 0xA0, 0x16, 0x5D, 0x01, 0xC2, 0x8C, 0x12, 0xB4, 0x92, 0x76, 0xA8, 0xCC, 0x5F, 0x66, 0x1C,
+    0x34, 0xC7, 0xC3, 0x87, 0xCA, 0xA0, 0x44, 0x23, 0x33, 0x69, 0x5C, 0x71, 0x07, 0x38, 0x4D, 0x28,
+    0x41, 0xD8, 0x89, 0x7A, 0x9B, 0xA8, 0x3D, 0xE8, 0xA0, 0x93, 0x3E, 0x95, 0xE6, 0x5A, 0xDA, 0xA9,
+    0x2E, 0x97, 0xCB, 0x65, 0x70, 0xB7, 0x1B, 0xB0, 0xD1, 0xDB, 0x43, 0xC6, 0x7C, 0x47, 0x03, 0x7D,
+    0x21, 0x24, 0xFC, 0x81, 0x5F, 0x70, 0x1A, 0x9C, 0x3D, 0xE6, 0x1D, 0x18, 0xF3, 0xAD, 0xFB, 0xBD,
+    0xEE, 0x03, 0x4E, 0xDA, 0x01, 0x49, 0x2B, 0x8C, 0x92, 0x06, 0xFA, 0x72, 0x57, 0x19, 0x7F, 0xD0,
+    0x1D, 0x38, 0x0D, 0x4E, 0x53, 0xA5, 0x84, 0x32, 0x31, 0x13, 0x36, 0xFA, 0x82, 0xDF, 0xF1, 0x07,
+    0x8D, 0x70, 0x1A, 0x1A, 0x4D, 0xB5, 0xFE, 0xF2, 0x75, 0xA5, 0x4E, 0x92, 0x26, 0x2F, 0x49, 0x83,
+    0x93, 0xF4, 0xE8, 0xD9, 0xB0, 0xF9, 0x4D, 0x1D, 0x03, 0x44, 0x69, 0x07, 0x33, 0x7D, 0xD4, 0x97,
+    0xDA, 0xF9, 0x8D, 0xAE, 0x34, 0x4A, 0xB4, 0x62, 0xCC, 0x38, 0x4D, 0xBE, 0x80, 0x66, 0x27, 0x08,
+    0x6B, 0xA5, 0x44, 0x57, 0x88, 0x33, 0xAD, 0x08, 0x19, 0xA7, 0x1F, 0x87, 0x0C, 0x37, 0x9E, 0xDC,
+    0xA1, 0x93, 0xB4, 0xD0, 0xAA, 0x52, 0xC1, 0x69, 0x6A, 0x35, 0xA1, 0x19, 0x2D, 0x8C, 0x99, 0x50,
+    0xE8, 0x0B, 0xFE, 0xA0, 0x15, 0x4E, 0x93, 0xD3, 0x54, 0x2B, 0xA1, 0xB9, 0xD2, 0x42, 0x7C, 0xF4,
+    0x1D, 0xE5, 0x46, 0x92, 0x16, 0x67, 0xD1, 0x2B, 0xE9, 0xCB, 0x5B, 0x73, 0xCD, 0xC9, 0x58, 0x10,
+    0x79, 0x49, 0x4A, 0x44, 0x8B, 0xA8, 0x71, 0xBD, 0x98, 0xC1, 0xED, 0x06, 0xCA, 0xC4, 0x01, 0x7F,
+    0xD0, 0x66, 0xD0, 0xC2, 0x01, 0xDD, 0x8E, 0x4F, 0xD4, 0x67, 0x7C, 0x9F, 0xC1, 0x3E, 0x01, 0x84,
+    0xD5, 0x02, 0x0F, 0x80, 0x98, 0x6D, 0x1F, 0x2C, 0xDC, 0x16, 0x80, 0x6E, 0x07, 0xAE, 0xDF, 0x7C,
+    0x3A, 0x4D, 0x36, 0x80, 0x56, 0x6F, 0x03, 0x9D, 0x94, 0x2D, 0x65, 0x2C, 0x7F, 0xE6, 0x5B, 0x83,
+    0x2F, 0x67, 0xA0, 0x29, 0x41, 0x94, 0xA4, 0x0C, 0x5F, 0xB3, 0xE5, 0x41, 0x97, 0xCD, 0x8C, 0x76,
+    0x43, 0x33, 0xE0, 0xF6, 0x33, 0x22, 0x74, 0x3E, 0x6B, 0x9C, 0x2C, 0xDB, 0xFA, 0xD9, 0x69, 0x00,
+    0x7C, 0xB6, 0x8C, 0x6D, 0x36, 0x33, 0xD6, 0xED, 0xE7, 0x85, 0x3A, 0xD3, 0x32, 0x4E, 0x76, 0x61,
+    0x48, 0x76, 0x61, 0xBF, 0xD8, 0x85, 0x3E, 0x9B, 0xC1, 0xED, 0x66, 0x17, 0x36, 0x05, 0xA7, 0x01,
+    0xDC, 0xC1, 0x35, 0x45, 0x88, 0x19, 0x2A, 0x0D, 0x84, 0x0D, 0xEE, 0xEA, 0xCF, 0x2F, 0xAF, 0x1F,
+    0x03, 0x9D, 0x24, 0x49, 0x86, 0x27, 0x52, 0x72, 0xF6, 0x99, 0x51, 0x02, 0xBA, 0x95, 0xB0, 0xD8,
+    0xDD, 0xBC, 0xA5, 0x1F, 0xAE, 0x00, 0xC4, 0x81, 0x03, 0x20, 0x24, 0x02, 0x80, 0x5F, 0xE8, 0x12,
+    0xE0, 0x32, 0xF5, 0x04, 0xF0, 0xEF, 0x9F, 0xDE, 0xD0, 0xC3, 0x36, 0x74, 0x26, 0x9E, 0x69, 0xB3,
+    0xDE, 0x19, 0x13, 0xAD, 0x70, 0x05, 0x94, 0x09, 0x13, 0xFE, 0xC0, 0xAD, 0xA0, 0x99, 0x5F, 0xC7,
+    0xD2, 0xF9, 0xD9, 0x0D, 0x95, 0xD2, 0x15, 0xBD, 0x1A, 0x49, 0x03, 0xC4, 0xCF, 0x2F, 0xF7, 0xAE,
+    0x80, 0xF5, 0x4B, 0x1B, 0xDA, 0x0D, 0xF4, 0x05, 0xB7, 0xE1, 0x34, 0x11, 0x07, 0xC2, 0x8A, 0xCF,
+    0xB4, 0x7A, 0xF8, 0xAE, 0x6C, 0xD9, 0x16, 0x86, 0xBB, 0x01, 0x44, 0x7A, 0x2A, 0x75, 0xEA, 0x9D,
+    0xEA, 0x72, 0x19, 0x88, 0x03, 0xFD, 0x41, 0x27, 0xD1, 0x0B, 0xB4, 0x13, 0xB5, 0xD6, 0xDA, 0x71,
+    0x2A, 0xC4, 0x63, 0xE8, 0x95, 0x69, 0x3F, 0x5B, 0x19, 0xE7, 0x4A, 0x9F, 0x25, 0xBE, 0xD2, 0xE5,
+    0x5A, 0x83, 0xDF, 0x9E, 0x03, 0xFA, 0xE4, 0x0B, 0x1A, 0x00, 0xC2, 0x14, 0x72, 0xB3, 0x99, 0x8D,
+    0x68, 0x0A, 0x09, 0xA0, 0x2E, 0xCD, 0x6E, 0xBE, 0xA4, 0x59, 0xFB, 0xB5, 0xB3, 0x90, 0xF2, 0x8B,
+    0x92, 0xAD, 0x86, 0xD1, 0x62, 0xE9, 0x5C, 0xF9, 0x69, 0x5F, 0x90, 0x2D, 0x1C, 0x9C, 0xDE, 0x97,
+    0xB3, 0x48, 0xEE, 0x8B, 0x2F, 0x7E, 0x3F, 0x41, 0x3B, 0xE4, 0x6E, 0x03, 0xE8, 0x54, 0x69, 0x0A,
+    0x19, 0xA8, 0x94, 0x9B, 0x9D, 0xB8, 0x00, 0x5E, 0x43, 0x6F, 0x11, 0x56, 0x69, 0x43, 0xC9, 0x69,
+    0x82, 0x4E, 0xC9, 0x1D, 0xB4, 0x1A, 0xA8, 0x55, 0xE8, 0x36, 0xBC, 0x20, 0x28, 0x35, 0x3A, 0xE8,
+    0x85, 0x53, 0x61, 0x54, 0x21, 0x68, 0x70, 0x9A, 0x6A, 0x69, 0x21, 0x6C, 0x70, 0xCF, 0xAC, 0xBC,
+    0xF3, 0x04, 0xDA, 0x2C, 0x10, 0xA5, 0x89, 0x28, 0x15, 0x82, 0xA4, 0xC1, 0xAF, 0xB5, 0x72, 0xB3,
+    0x11, 0x4A, 0x55, 0x68, 0xC5, 0x77, 0x71, 0x4A, 0x77, 0xCE, 0xAD, 0x1A, 0xF3, 0x99, 0x9F, 0x97,
+    0xB8, 0x42, 0x50, 0x86, 0x4E, 0x82, 0x56, 0xCA, 0x50, 0xE9, 0x00, 0x5A, 0x25, 0x40, 0x19, 0x08,
+    0x7B, 0x3D, 0xD1, 0xCA, 0x65, 0x9C, 0x3E, 0xD8, 0xA9, 0x34, 0x6B, 0xAE, 0x94, 0x83, 0xFE, 0x4C,
+    0xB9, 0x95, 0x94, 0x89, 0xD2, 0xC2, 0x5D, 0x69, 0x82, 0xEA, 0xFE, 0x99, 0xA0, 0xF7, 0xEE, 0x5C,
+    0x2E, 0xF7, 0x90, 0xC4, 0x19, 0x84, 0x4B, 0x67, 0x61, 0xB8, 0x12, 0xF5, 0x53, 0x18, 0x57, 0xCB,
+    0x8B, 0x56, 0x27, 0x30, 0x28, 0x53, 0x6B, 0xB1, 0xA0, 0x8A, 0xBB, 0x85, 0x55, 0x50, 0x32, 0x8C,
+    0x51, 0x81, 0x5A, 0xA9, 0xB1, 0x48, 0x2C, 0x95, 0xB4, 0x81, 0xD3, 0x14, 0x3F, 0xD6, 0x00, 0x61,
+    0xED, 0xD7, 0x98, 0xA1, 0x91, 0x2F, 0x5E, 0x40, 0xFC, 0x42, 0x68, 0x01, 0x2F, 0x59, 0x9E, 0x4B,
+    0x4B, 0xA5, 0x19, 0x3A, 0xAD, 0xF4, 0x05, 0x2C, 0x94, 0x12, 0xF4, 0x32, 0xC0, 0x71, 0x4A, 0x34,
+    0x1A, 0xEC, 0x17, 0xB3, 0x6B, 0xC2, 0x6B, 0xA0, 0x93, 0x52, 0x27, 0x4D, 0x4E, 0x2A, 0xEE, 0xF4,
+    0x6F, 0x8A, 0x67, 0x2C, 0x3C, 0x19, 0xB8, 0x16, 0x5C, 0x99, 0x7F, 0x72, 0xC6, 0x9B, 0x4F, 0x00,
+    0x7E, 0x73, 0x56, 0x82, 0xF5, 0x58, 0x67, 0x29, 0x3E, 0x6B, 0x71, 0x77, 0x82, 0x19, 0x77, 0x06,
+    0x7E, 0xD5, 0xEB, 0xC5, 0xCB, 0x85, 0xCB, 0xE5, 0x82, 0x97, 0xB2, 0xB7, 0xF2, 0x77, 0x54, 0x27,
+    0x03, 0x19, 0x5A, 0x1D, 0x03, 0x8D, 0x06, 0x5A, 0x9D, 0xF0, 0xAA, 0x6C, 0x7E, 0xEC, 0x0F, 0x73,
+    0x5D, 0xAB, 0x19, 0xFC, 0x81, 0x53, 0x31, 0x4E, 0x21, 0x25, 0xE8, 0x2D, 0xA4, 0x70, 0xB6, 0x28,
+    0x08, 0x5B, 0xBB, 0x8F, 0x2B, 0x38, 0xBD, 0xA2, 0xDF, 0x15, 0x30, 0x66, 0x25, 0x65, 0x68, 0x35,
+    0xE6, 0xD3, 0x75, 0xDB, 0xE9, 0xCB, 0x83, 0xCE, 0xAA, 0xFB, 0x50, 0x9B, 0xEB, 0x66, 0x42, 0x81,
+    0x5A, 0xD9, 0x40, 0x3F, 0x14, 0xDB, 0x56, 0xA7, 0xE9, 0xB4, 0x6B, 0x03, 0xAD, 0x54, 0x92, 0xED,
+    0x58, 0x90, 0x52, 0x30, 0xAC, 0x2B, 0xAD, 0xB4, 0xDE, 0x2E, 0xF6, 0xCE, 0xE5, 0x32, 0x54, 0x71,
+    0x40, 0x96, 0xF0, 0x4E, 0xDA, 0x9C, 0x76, 0x5A, 0x59, 0xAA, 0x57, 0x9A, 0x2B, 0x7D, 0x36, 0xD1,
+    0x0A, 0xBF, 0x3E, 0x07, 0xE1, 0xCC, 0x70, 0x2D, 0xED, 0x06, 0x38, 0x0D, 0x63, 0x02, 0xBA, 0x72,
+    0x82, 0x64, 0xEE, 0x67, 0xC0, 0xE9, 0xBD, 0xC3, 0xEA, 0x8E, 0xE5, 0x73, 0xB0, 0x64, 0xAE, 0xCE,
+    0x4C, 0x6E, 0x65, 0xD5, 0x29, 0x6C, 0xDE, 0x90, 0x7E, 0xEE, 0x37, 0xA0, 0xD1, 0x10, 0xB2, 0xD5,
+    0x24, 0x2D, 0x40, 0xB4, 0xBC, 0xB5, 0xA2, 0x0A, 0x7E, 0xA7, 0xD5, 0x00, 0x71, 0xC5, 0x0B, 0xC6,
+    0x1B, 0x83, 0x0B, 0x41, 0x83, 0xBF, 0x66, 0x29, 0xC0, 0x8B, 0xE7, 0xCA, 0x2E, 0x97, 0xFB, 0x56,
+    0xBC, 0x55, 0xA0, 0x37, 0x16, 0x63, 0xA5, 0xEA, 0x6D, 0x20, 0x26, 0x2B, 0x34, 0x71, 0xBA, 0x16,
+    0x9C, 0x70, 0xFD, 0xDC, 0x80, 0xEA, 0x60, 0x5C, 0x0D, 0x18, 0xAD, 0x30, 0x15, 0xCB, 0xCA, 0xE6,
+    0x34, 0xAF, 0x5D, 0xED, 0xD3, 0x67, 0x23, 0x8E, 0xDD, 0x62, 0xE0, 0x1D, 0x66, 0x2B, 0xA7, 0xC1,
+    0xB0, 0x86, 0x38, 0x35, 0xE6, 0x32, 0xAB, 0xC9, 0xEE, 0xB0, 0x2D, 0x6A, 0x0A, 0x5E, 0xF0, 0xBC,
+    0x5F, 0xF1, 0x07, 0xFC, 0x76, 0xCC, 0x74, 0x3B, 0x44, 0x25, 0xFA, 0x1D, 0xA4, 0xA1, 0x95, 0x32,
+    0xDA, 0xE9, 0xA5, 0xCC, 0x98, 0x09, 0xD2, 0xF2, 0x04, 0xFA, 0xBC, 0x78, 0xB9, 0x07, 0x97, 0x0B,
+    0x04, 0x15, 0x88, 0x5A, 0xF0, 0xD2, 0x89, 0x2A, 0x51, 0x89, 0xA0, 0x05, 0x5A, 0xAD, 0x16, 0xEF,
+    0x4E, 0x3B, 0x5E, 0xAB, 0x45, 0x51, 0xA3, 0x1D, 0x88, 0x71, 0x71, 0x87, 0x80, 0xF0, 0xD1, 0x56,
+    0xED, 0x4A, 0xD0, 0x7D, 0x2A, 0x14, 0x32, 0xB4, 0xAB, 0x52, 0xFC, 0x56, 0x01, 0x57, 0x42, 0x0E,
+    0x6F, 0x0A, 0x50, 0xBB, 0xF7, 0x49, 0x09, 0xE2, 0xF7, 0xF4, 0xAD, 0x25, 0x64, 0x08, 0xF3, 0xF8,
+    0xF3, 0xDC, 0x15, 0xF0, 0xD9, 0x6B, 0x6B, 0x04, 0xCD, 0xE6, 0x54, 0x2A, 0x4D, 0xD4, 0x3B, 0x32,
+    0x00, 0x16, 0xBD, 0xE8, 0x37, 0x18, 0x53, 0xA3, 0xA1, 0x3D, 0xA0, 0x5F, 0x2A, 0x25, 0xA7, 0x01,
+    0x9F, 0x09, 0x33, 0x9A, 0xCF, 0x5A, 0x1B, 0x56, 0x6A, 0x51, 0xBF, 0x43, 0x77, 0x0C, 0xAD, 0x36,
+    0x20, 0xAA, 0x78, 0x2B, 0x7A, 0x92, 0xBB, 0x96, 0xC2, 0xE9, 0x29, 0x8C, 0xAB, 0xAE, 0x18, 0xD7,
+    0x1B, 0x77, 0x5A, 0x89, 0x5A, 0x2C, 0x19, 0x74, 0xC5, 0xB8, 0xE3, 0xC4, 0x53, 0xCD, 0x96, 0xA8,
+    0xDD, 0x89, 0x71, 0xF5, 0x89, 0x71, 0x67, 0x2E, 0xA5, 0x67, 0x73, 0x49, 0x37, 0xE4, 0x47, 0xCA,
+    0x56, 0x80, 0x25, 0x20, 0x7E, 0x7E, 0xF9, 0xB6, 0xE5, 0xE5, 0x5F, 0x79, 0x2F, 0x4B, 0xFA, 0xFF,
+    0x33, 0xC6, 0x75, 0x27, 0xC6, 0xF5, 0x27, 0xC6, 0x35, 0xD7, 0x44, 0x7D, 0x1A, 0xE3, 0xBE, 0xA6,
+    0xB7, 0xAD, 0x34, 0x2E, 0x16, 0xC2, 0x09, 0x2F, 0xE9, 0xA0, 0xD1, 0xA3, 0xD7, 0xB4, 0xA2, 0x82,
+    0x57, 0x0A, 0x82, 0x71, 0x6F, 0x94, 0x70, 0x5A, 0xB4, 0x42, 0xAF, 0x4E, 0x50, 0xEB, 0x17, 0xF6,
+    0x35, 0xB3, 0xEA, 0x0B, 0x03, 0x8F, 0x58, 0xA0, 0xD6, 0x67, 0x9A, 0x20, 0x1C, 0x06, 0xE7, 0x9F,
+    0x68, 0x82, 0xB1, 0x68, 0x83, 0x56, 0x3F, 0xD0, 0x04, 0xCA, 0xB1, 0x40, 0x7F, 0x34, 0x9A, 0x69,
+    0x94, 0x82, 0xA8, 0xB4, 0xD6, 0xDA, 0xAB, 0x78, 0x12, 0x9B, 0x89, 0x60, 0x94, 0xCF, 0x88, 0x72,
+    0x15, 0x8D, 0x8C, 0xBC, 0x38, 0xDC, 0xF2, 0xC4, 0xB3, 0x7F, 0xB8, 0x76, 0x10, 0xD2, 0x6A, 0x49,
+    0xA8, 0x05, 0xC6, 0x47, 0x97, 0xEF, 0x5C, 0x5D, 0x74, 0x75, 0xE6, 0xD5, 0x55, 0x57, 0xA7, 0xB6,
+    0xC2, 0x3A, 0x96, 0x67, 0x2F, 0xBC, 0x62, 0x9D, 0x5D, 0x38, 0xFF, 0xF5, 0x17, 0xF6, 0x27, 0x14,
+    0xFB, 0x13, 0xB4, 0xFF, 0xCA, 0x0B, 0x6B, 0x2D, 0x37, 0x05, 0x68, 0xB4, 0xF0, 0xCA, 0xE1, 0xDC,
+    0xA4, 0xEE, 0xCA, 0x84, 0x01, 0xEE, 0x44, 0xBD, 0x63, 0xBD, 0x57, 0xE6, 0xE4, 0xF7, 0xA3, 0x24,
+    0x71, 0xF7, 0x3B, 0xAA, 0xB5, 0x41, 0xCC, 0x67, 0xD7, 0x11, 0x0A, 0x68, 0x71, 0x4A, 0xF8, 0x9D,
+    0x50, 0xA8, 0x94, 0x9C, 0x12, 0x7D, 0x39, 0xAD, 0xB6, 0xD5, 0xD7, 0x9A, 0x71, 0x7A, 0x59, 0x1B,
+    0x8C, 0xD2, 0x61, 0xB7, 0x06, 0xA4, 0x03, 0xF0, 0xC7, 0xBD, 0xA7, 0x9A, 0xD4, 0x27, 0xD8, 0xE2,
+    0xF6, 0x04, 0xFD, 0x8F, 0x8F, 0x4E, 0xA4, 0xB5, 0xD0, 0x35, 0x12, 0x7F, 0x3C, 0x51, 0xDE, 0xAA,
+    0x78, 0x0C, 0xD0, 0x49, 0x1B, 0x95, 0xA4, 0xE3, 0x6C, 0x1E, 0x7B, 0xFD, 0xF4, 0xD7, 0x0A, 0x71,
+    0xC7, 0x95, 0x4A, 0x19, 0x57, 0x9C, 0x12, 0x6E, 0x6D, 0x35, 0xD0, 0x2C, 0xD6, 0x40, 0xF4, 0xFB,
+    0x2D, 0x37, 0xB5, 0xF7, 0x71, 0xE3, 0xAC, 0x36, 0xBF, 0xF2, 0xBD, 0x5C, 0xDF, 0xAB, 0x69, 0x14,
+    0x34, 0x29, 0x28, 0x11, 0x52, 0xAF, 0x47, 0xAF, 0x29, 0x59, 0x1B, 0xD7, 0xE8, 0xDA, 0xAC, 0x65,
+    0xE8, 0x74, 0x0C, 0x67, 0x0C, 0xDD, 0xB9, 0x5C, 0x2E, 0x97, 0x8B, 0xE5, 0xDC, 0x5F, 0x58, 0xF0,
+    0x48, 0x92, 0x4A, 0xF8, 0xCB, 0x07, 0xFB, 0xB7, 0xE5, 0x73, 0x2B, 0xC2, 0x87, 0x9B, 0x53, 0xEA,
+    0x7E, 0x52, 0xD0, 0xD2, 0xAC, 0x81, 0x71, 0xAD, 0xB7, 0x6A, 0xE8, 0x0A, 0x2F, 0x58, 0xE6, 0xDF,
+    0x34, 0x36, 0x16, 0x9A, 0xE3, 0xFA, 0x64, 0x67, 0xFA, 0x37, 0xFA, 0xF3, 0x64, 0xE5, 0xE9, 0x66,
+    0x49, 0xCD, 0xD5, 0xA1, 0x05, 0x2A, 0x73, 0x6B, 0x75, 0xB9, 0x0C, 0x77, 0x2E, 0xF7, 0xBD, 0x94,
+    0x82, 0x4A, 0x27, 0xA5, 0xA0, 0xAD, 0xD5, 0x4E, 0xAB, 0x05, 0x65, 0x9C, 0xB5, 0x21, 0xAD, 0xC1,
+    0x8A, 0x5F, 0x21, 0x6C, 0x84, 0x6C, 0x8C, 0x20, 0x41, 0x67, 0x15, 0xD5, 0x97, 0x5A, 0x40, 0x6B,
+    0x0C, 0xB9, 0x39, 0xFC, 0x0A, 0x38, 0x75, 0x19, 0x70, 0x0A, 0x67, 0xF9, 0x1C, 0x4C, 0x35, 0x78,
+    0x52, 0x52, 0x88, 0x56, 0xCC, 0xC3, 0x62, 0x14, 0x3A, 0x01, 0x5F, 0xAD, 0xAC, 0x61, 0x6A, 0x77,
+    0x63, 0xD5, 0x9B, 0x7D, 0x2C, 0x56, 0x8A, 0x07, 0x80, 0xDE, 0x2A, 0x65, 0x75, 0x03, 0x34, 0x97,
+    0xCB, 0x7D, 0xA0, 0x36, 0x35, 0xC3, 0x19, 0x45, 0xA8, 0xA2, 0x39, 0xC0, 0xAA, 0x34, 0xC6, 0xB2,
+    0xFF, 0x91, 0xB4, 0x9D, 0x60, 0x38, 0x9D, 0xD8, 0x58, 0x69, 0x1D, 0xFF, 0xA7, 0x36, 0xA7, 0x69,
+    0x5C, 0x42, 0xF1, 0x22, 0xCE, 0xDD, 0xDE, 0x15, 0x94, 0xFC, 0xD1, 0xDB, 0x47, 0xD8, 0x2A, 0x25,
+    0xBF, 0x87, 0xB5, 0xD6, 0xE4, 0x4B, 0x58, 0x9D, 0x86, 0xBE, 0x84, 0xCD, 0x89, 0xB0, 0xF6, 0xBB,
+    0x13, 0xCA, 0x5E, 0xAF, 0xAA, 0x55, 0x6A, 0xAC, 0x79, 0xAA, 0x0C, 0x2F, 0xE8, 0xCE, 0xE0, 0xED,
+    0x9E, 0xB4, 0x81, 0xF1, 0x18, 0x8C, 0x5E, 0xCC, 0xD6, 0xAA, 0xCE, 0xC0, 0x6F, 0x3E, 0x7C, 0x38,
+    0xDD, 0x30, 0xE0, 0xFB, 0xB4, 0xD2, 0x12, 0xAC, 0xAD, 0x9E, 0x83, 0x0A, 0xB5, 0x0E, 0xA3, 0x66,
+    0xA1, 0xD0, 0xEE, 0x40, 0x77, 0xD8, 0xDD, 0xBC, 0x18, 0x17, 0xA3, 0x1F, 0x9A, 0x00, 0xA7, 0x0F,
+    0x64, 0x9D, 0xC5, 0x27, 0xE5, 0x54, 0x69, 0xF2, 0xD9, 0x9E, 0x5C, 0x3B, 0x12, 0x73, 0x99, 0xA5,
+    0xC3, 0xED, 0xEF, 0x37, 0x6D, 0xCA, 0xE9, 0xB5, 0xE3, 0x6C, 0xB1, 0xB3, 0x79, 0x3E, 0xA6, 0x98,
+    0x81, 0x5A, 0x43, 0xD8, 0x80, 0xE6, 0xEC, 0x73, 0xBB, 0xB3, 0x7D, 0x1D, 0x33, 0x5E, 0x03, 0xAD,
+    0x0E, 0xA2, 0x0A, 0xBD, 0xF4, 0xCA, 0x49, 0x7A, 0x9D, 0xB4, 0xD9, 0xBA, 0x5E, 0xBC, 0x5C, 0x38,
+    0x51, 0x28, 0x21, 0x1D, 0xAD, 0x94, 0xE9, 0xB5, 0x57, 0xD7, 0xA2, 0xE7, 0x34, 0x99, 0x80, 0x75,
+    0xAD, 0x75, 0x31, 0x5B, 0x18, 0x87, 0x62, 0x71, 0x6E, 0x8F, 0xFA, 0x6B, 0x2F, 0x9C, 0x6F, 0x6C,
+    0x6A, 0x34, 0x40, 0x5F, 0x0C, 0x6A, 0x9E, 0xBD, 0xB0, 0xBA, 0x5E, 0x18, 0x9F, 0xBD, 0xF0, 0xB0,
+    0x92, 0xEB, 0x34, 0x11, 0x36, 0xA8, 0xF5, 0xE5, 0xC3, 0x77, 0x75, 0xDB, 0x7B, 0xFB, 0x67, 0x7B,
+    0xEF, 0x27, 0x37, 0x97, 0xE6, 0x54, 0xD4, 0xAA, 0xD3, 0xB1, 0xC4, 0x33, 0x4C, 0xFB, 0xB3, 0x65,
+    0xF5, 0x16, 0xEC, 0xB8, 0xF3, 0x8B, 0xFC, 0x33, 0x78, 0xF1, 0x72, 0xA9, 0x2E, 0x97, 0x7B, 0xD2,
+    0xDE, 0x49, 0x1F, 0x4B, 0x39, 0x4A, 0xAD, 0x8E, 0x2A, 0x6A, 0xA9, 0x95, 0x08, 0x1B, 0xFE, 0xA0,
+    0xD2, 0x4C, 0x58, 0x69, 0x45, 0xA5, 0x99, 0xBE, 0xD0, 0x0A, 0x94, 0xE9, 0x8B, 0x49, 0x62, 0x99,
+    0xCE, 0xDA, 0x93, 0x98, 0x69, 0x0D, 0xA3, 0x3B, 0x7D, 0xA9, 0xC3, 0x58, 0xC0, 0xC6, 0xB5, 0xE6,
+    0x75, 0x3A, 0x93, 0x30, 0x94, 0x27, 0x1A, 0x71, 0xE3, 0x79, 0xD7, 0x50, 0x35, 0xE9, 0xE5, 0x84,
+    0x98, 0x4E, 0xDC, 0x46, 0xAA, 0xD1, 0xE0, 0xC6, 0x72, 0xAD, 0xBA, 0x5C, 0x5E, 0xBE, 0x5C, 0x5E,
+    0x36, 0xD9, 0xA0, 0x04, 0x95, 0x51, 0x3B, 0x5E, 0xFA, 0xBE, 0xF4, 0x03, 0xE3, 0x34, 0x73, 0xAF,
+    0xB9, 0xD7, 0x02, 0x63, 0x66, 0xCC, 0xD7, 0xDE, 0xAD, 0x3D, 0xF5, 0x11, 0x2D, 0x68, 0x31, 0x6E,
+    0xB3, 0xE3, 0x77, 0x7B, 0xBA, 0xE6, 0x4A, 0xC9, 0x38, 0x49, 0xA1, 0x2F, 0x67, 0x59, 0x4B, 0xF5,
+    0x49, 0xA5, 0xC3, 0x46, 0xD8, 0x08, 0x2B, 0x26, 0xBE, 0x0D, 0x8D, 0x80, 0x70, 0x73, 0xF7, 0xE6,
+    0xF6, 0xEE, 0x31, 0xDF, 0xDC, 0xFD, 0x38, 0x1F, 0x00, 0x9A, 0x91, 0x89, 0x31, 0x5D, 0x39, 0x1F,
+    0x60, 0x77, 0x37, 0xC6, 0xDB, 0x3F, 0x71, 0xF7, 0xE9, 0xE6, 0xEE, 0xEB, 0xAD, 0xED, 0x7F, 0xF0,
+    0x9A, 0x2E, 0xAF, 0x8B, 0x6B, 0x34, 0x9C, 0x62, 0x9E, 0x8C, 0x9F, 0x87, 0xEB, 0x8F, 0xFF, 0x9F,
+    0x7D, 0xE3, 0xFE, 0xB6, 0xBE, 0x59, 0xFE, 0x1F, 0xF9, 0x66, 0x7C, 0xC2, 0x37, 0xC3, 0xAD, 0x6F,
+    0xE6, 0x1B, 0xDF, 0xEC, 0xB7, 0xBE, 0xB9, 0x91, 0x6E, 0xFC, 0xAD, 0xF8, 0x7C, 0x4B, 0x1A, 0xBB,
+    0x7C, 0x53, 0xEB, 0x6F, 0x0B, 0x7F, 0x77, 0xC3, 0x5B, 0xEA, 0xDB, 0xEF, 0xF4, 0x37, 0xDF, 0xA9,
+    0xDE, 0xB1, 0x9A, 0x7B, 0x9F, 0x46, 0xD2, 0x41, 0x6D, 0xB2, 0x8B, 0xA4, 0x63, 0x20, 0xFC, 0x38,
+    0x6C, 0xE0, 0xB3, 0xDF, 0xA1, 0x59, 0x9D, 0x06, 0xAA, 0x52, 0x29, 0x41, 0x30, 0x85, 0xCD, 0x10,
+    0xCD, 0x1C, 0x80, 0xD3, 0xEF, 0x73, 0x53, 0x1D, 0xE3, 0x4D, 0xD6, 0x4C, 0xF8, 0xBD, 0xD6, 0x4A,
+    0x23, 0x3A, 0x99, 0xC3, 0x13, 0x71, 0xF9, 0x15, 0x8A, 0x6F, 0xA3, 0xC1, 0xFE, 0x5C, 0xE9, 0xF3,
+    0xD7, 0x94, 0x4C, 0xF7, 0xB7, 0x82, 0x53, 0x3F, 0x25, 0xFA, 0x56, 0x17, 0x6B, 0x81, 0xEE, 0x5B,
+    0xA3, 0xE9, 0x4E, 0x15, 0xF5, 0xFC, 0xA9, 0xD5, 0x31, 0x50, 0x4B, 0xF3, 0xA9, 0xBB, 0x74, 0xFB,
+    0x35, 0x29, 0xBB, 0x72, 0x4D, 0xD9, 0xBE, 0x5C, 0xEB, 0xBB, 0xE1, 0x5E, 0x3A, 0xD9, 0x94, 0x29,
+    0x8D, 0xE3, 0x7A, 0xA5, 0x58, 0x06, 0x7A, 0x3F, 0xE6, 0x8A, 0x6A, 0xB2, 0xA1, 0x03, 0x4E, 0xD2,
+    0x84, 0x16, 0x2B, 0x88, 0xA6, 0x74, 0xB4, 0xAA, 0xB4, 0x5E, 0x51, 0x30, 0x14, 0xA7, 0x84, 0xB1,
+    0x3E, 0x93, 0x9E, 0x0A, 0x7D, 0xB9, 0x62, 0xE5, 0xF5, 0xA7, 0x8D, 0xB0, 0xB5, 0xB2, 0x67, 0x8F,
+    0xAB, 0x3F, 0x63, 0x42, 0x26, 0x03, 0xC4, 0x47, 0xAF, 0x69, 0xEE, 0x8F, 0x33, 0x5D, 0x5E, 0x91,
+    0xB2, 0x81, 0x51, 0x73, 0xFE, 0x74, 0x0C, 0xFE, 0x06, 0x41, 0x9F, 0xF4, 0x8B, 0xFD, 0xAF, 0xBD,
+    0xB7, 0x56, 0x9B, 0x4C, 0x89, 0x35, 0x60, 0x32, 0xC8, 0x32, 0x6E, 0xA3, 0x99, 0xEB, 0x9A, 0x6D,
+    0xBD, 0x4E, 0x7F, 0x7E, 0x23, 0xDC, 0xBB, 0x73, 0xEC, 0x22, 0xAD, 0xB4, 0xAA, 0x62, 0x39, 0x75,
+    0x7B, 0xDB, 0xAF, 0xAE, 0xE0, 0x75, 0x2A, 0xE0, 0xB6, 0x89, 0x61, 0xA3, 0x2B, 0x84, 0x95, 0x71,
+    0x33, 0x01, 0xDC, 0x54, 0xFB, 0x70, 0x13, 0xC1, 0x6F, 0x3F, 0xA3, 0xB7, 0x3C, 0xD0, 0xDB, 0xE0,
+    0xA5, 0xDD, 0x1A, 0x1C, 0x63, 0x15, 0x0B, 0x61, 0x76, 0x5A, 0x19, 0x07, 0x54, 0x18, 0x21, 0x14,
+    0xBE, 0x0B, 0xFD, 0xCE, 0xD7, 0xA1, 0x3B, 0x6E, 0x31, 0xD5, 0xDF, 0xBC, 0x8F, 0x92, 0x4C, 0x91,
+    0x06, 0x49, 0x07, 0xC4, 0x87, 0xF1, 0x97, 0x28, 0x6B, 0xDC, 0xAA, 0x09, 0x94, 0xFD, 0x8C, 0xD3,
+    0x12, 0x32, 0xAD, 0x52, 0xD8, 0x08, 0x22, 0xE8, 0xE7, 0x2A, 0x74, 0x92, 0x32, 0xED, 0xA9, 0xB6,
+    0x1A, 0x0F, 0xBA, 0xFF, 0x8C, 0xC5, 0x97, 0xCB, 0x7D, 0x6A, 0x6D, 0x27, 0x35, 0xEF, 0xAE, 0x93,
+    0x82, 0x21, 0xD8, 0xD8, 0x45, 0xC7, 0x10, 0xAC, 0xAA, 0xF9, 0x9D, 0xA0, 0x3F, 0xD0, 0x01, 0x8D,
+    0x08, 0x07, 0xAD, 0x12, 0xB5, 0x52, 0x7F, 0x80, 0x85, 0x50, 0x27, 0x5B, 0x47, 0x58, 0xBD, 0x06,
+    0x6B, 0x7E, 0x2C, 0x62, 0x94, 0x69, 0x54, 0x9F, 0x7C, 0xA5, 0x36, 0x65, 0xC8, 0xDB, 0xC2, 0x4C,
+    0x45, 0x22, 0x9C, 0xCD, 0x41, 0xA6, 0x93, 0xAC, 0x7F, 0xA3, 0xD5, 0xB7, 0xB5, 0x60, 0x53, 0x95,
+    0x29, 0x6E, 0xE0, 0x35, 0xA0, 0xB9, 0x3B, 0xCE, 0xAF, 0xAC, 0x8D, 0x12, 0xB5, 0x16, 0x3A, 0x13,
+    0x33, 0x94, 0x69, 0x45, 0xD8, 0x21, 0x6E, 0x36, 0xD9, 0x48, 0xC4, 0x62, 0x18, 0x59, 0x2A, 0x9B,
+    0x43, 0xD0, 0x4B, 0x2A, 0xD4, 0xA7, 0x7A, 0x5C, 0x2C, 0xBB, 0x7A, 0xCB, 0x01, 0xED, 0x37, 0x9D,
+    0x1F, 0xC0, 0xFD, 0x5B, 0x0F, 0x5D, 0x80, 0x07, 0x92, 0x66, 0xA3, 0x72, 0xD9, 0x10, 0x65, 0xA1,
+    0xD2, 0x76, 0x5D, 0xE0, 0x49, 0x5A, 0xC2, 0x0A, 0x7D, 0xA1, 0x2B, 0x57, 0xEC, 0xC6, 0x9D, 0x68,
+    0x19, 0x57, 0xAC, 0xDA, 0x9E, 0x88, 0xF9, 0xE8, 0x41, 0x39, 0x1B, 0x72, 0xE3, 0xAA, 0x9A, 0x6E,
+    0x87, 0x13, 0x7D, 0x1E, 0x33, 0xE0, 0xD7, 0xAE, 0x00, 0xBE, 0x9C, 0x22, 0x8B, 0xD3, 0x04, 0xCD,
+    0x81, 0x66, 0x68, 0xC4, 0x98, 0x69, 0x5E, 0x17, 0x5D, 0xA1, 0x96, 0x06, 0x73, 0xE8, 0x34, 0x6A,
+    0x27, 0x68, 0x0A, 0xD2, 0xD4, 0x68, 0xE8, 0xA4, 0xC4, 0x0B, 0xD7, 0x85, 0x7C, 0xC5, 0x38, 0xF6,
+    0x98, 0x90, 0xE2, 0x52, 0xD9, 0xA0, 0xE0, 0x4B, 0x15, 0xB4, 0xF8, 0x83, 0x31, 0xD7, 0x1A, 0x42,
+    0x46, 0xA9, 0xDB, 0x08, 0xD9, 0xEF, 0xF4, 0x9B, 0x13, 0x7E, 0xAF, 0x94, 0x1A, 0x11, 0x17, 0xA7,
+    0x14, 0xD6, 0x5A, 0x8B, 0xDF, 0xD1, 0xE6, 0x34, 0x1C, 0xC7, 0xDF, 0x51, 0xDE, 0xE3, 0x27, 0x9F,
+    0xE9, 0xE8, 0xF5, 0x85, 0xD4, 0x2A, 0x4B, 0x95, 0xB2, 0x3F, 0x08, 0x0B, 0x2F, 0x3C, 0x41, 0xC8,
+    0x81, 0x6F, 0x00, 0x55, 0x9C, 0xE1, 0xAE, 0x76, 0x68, 0xA4, 0x44, 0x23, 0x93, 0xF5, 0x7E, 0x0A,
+    0xD6, 0xC6, 0x6D, 0x36, 0x32, 0x01, 0x34, 0x5D, 0xA1, 0xDF, 0xED, 0xED, 0x23, 0x18, 0x7F, 0xA8,
+    0x0D, 0xFF, 0xC5, 0xB5, 0xFB, 0xA6, 0xD7, 0x14, 0x57, 0xA7, 0xC5, 0x69, 0x08, 0x85, 0xB0, 0x35,
+    0x1A, 0x6A, 0x0D, 0x31, 0xD3, 0xAF, 0xED, 0x81, 0x13, 0x5A, 0x6C, 0x09, 0xE6, 0x2D, 0xA5, 0xF6,
+    0xA0, 0x2F, 0x8C, 0xB9, 0x11, 0x4E, 0x1F, 0x6B, 0xA6, 0x97, 0x56, 0xDB, 0x73, 0x6A, 0x9B, 0x60,
+    0xDE, 0xBF, 0xE9, 0x22, 0x5A, 0x2D, 0xB4, 0xC6, 0xE8, 0x76, 0x34, 0x8D, 0x4B, 0x98, 0xDD, 0xDE,
+    0x6E, 0x84, 0x24, 0xFC, 0xD6, 0x2F, 0x8D, 0xDC, 0xF1, 0x40, 0xD3, 0x28, 0xA9, 0x95, 0x54, 0xE2,
+    0x8F, 0x2B, 0x7D, 0x54, 0xF0, 0x45, 0x09, 0x7D, 0x54, 0xE8, 0xB6, 0x38, 0x3B, 0x35, 0x7A, 0x59,
+    0x73, 0x90, 0xD6, 0x4A, 0xDA, 0x6D, 0x4C, 0x5A, 0xDD, 0x3B, 0xB7, 0xA1, 0x56, 0xA1, 0x95, 0x66,
+    0x2F, 0x95, 0xE6, 0xF8, 0x23, 0xBD, 0xB2, 0x11, 0xE7, 0xDF, 0xA2, 0xB7, 0xE8, 0xA1, 0xDF, 0x21,
+    0x1E, 0x54, 0xDA, 0x71, 0xDA, 0x68, 0xB4, 0xD0, 0x68, 0xC2, 0x69, 0xAA, 0x06, 0xA5, 0x6A, 0x1D,
+    0x73, 0xBD, 0x7B, 0xBD, 0x26, 0x27, 0x69, 0x18, 0x25, 0xBB, 0xFB, 0x9D, 0x7B, 0x00, 0x6F, 0xBC,
+    0x0D, 0xA3, 0x56, 0x5A, 0x69, 0x65, 0x94, 0x72, 0xB5, 0xD5, 0x5A, 0x6A, 0x03, 0x43, 0xA7, 0xE1,
+    0x14, 0x91, 0xFA, 0x62, 0x18, 0x7A, 0xF7, 0x4F, 0x94, 0x6A, 0x49, 0x04, 0x93, 0x6D, 0x94, 0xC3,
+    0xE6, 0xF4, 0xBE, 0x86, 0xE6, 0xE8, 0x0A, 0xFD, 0xA6, 0x99, 0xF8, 0x23, 0xE1, 0xD4, 0x6D, 0xF8,
+    0x12, 0x17, 0xC6, 0x4F, 0x35, 0xD4, 0xF2, 0x3B, 0xBE, 0x84, 0x95, 0x38, 0x6B, 0x71, 0xAA, 0x95,
+    0x42, 0x6E, 0xF4, 0x5F, 0x35, 0x78, 0x69, 0xC3, 0x4B, 0x03, 0xAD, 0x96, 0xEB, 0x82, 0xA9, 0x80,
+    0xF1, 0x30, 0x61, 0x4F, 0x2A, 0xE8, 0x4D, 0xA1, 0x61, 0x4C, 0x71, 0xEA, 0x73, 0x48, 0x7E, 0xED,
+    0x17, 0x5F, 0xFC, 0xEA, 0x4B, 0x53, 0xFA, 0x52, 0x2B, 0x9A, 0xF0, 0x15, 0x34, 0xE0, 0x0B, 0xF5,
+    0xEF, 0x08, 0x97, 0xE3, 0xD2, 0x96, 0x4E, 0xDA, 0x9D, 0xB4, 0x33, 0xAA, 0xE0, 0xB4, 0x5E, 0xC7,
+    0x17, 0xCF, 0x9F, 0x4E, 0x8D, 0x99, 0x9D, 0xAE, 0x30, 0x2A, 0xF5, 0xA9, 0x55, 0xEE, 0xB4, 0xBB,
+    0x52, 0x4B, 0x4E, 0x5A, 0xC2, 0x14, 0xB5, 0x8C, 0xAF, 0xAA, 0x59, 0xBB, 0xFC, 0x0D, 0x97, 0xFA,
+    0x2C, 0x57, 0x80, 0x4A, 0x21, 0x47, 0x80, 0xEE, 0xF1, 0xD1, 0x2D, 0x56, 0xEA, 0x3F, 0x2E, 0x06,
+    0xC8, 0xFB, 0x59, 0x43, 0xA2, 0xF5, 0x9C, 0xE1, 0x53, 0x4B, 0xD1, 0xA6, 0x8C, 0x8F, 0x37, 0x00,
+    0xB5, 0x25, 0x4E, 0x40, 0x3F, 0xEB, 0x77, 0x4B, 0xB5, 0x7C, 0xA3, 0xDD, 0x7C, 0x8E, 0x3F, 0x89,
+    0x8D, 0x54, 0x1D, 0x8D, 0x34, 0x47, 0xA5, 0x7E, 0x0E, 0xDA, 0x5A, 0x65, 0x57, 0x6A, 0x1D, 0x84,
+    0x8D, 0x30, 0xB4, 0x1A, 0xB8, 0x47, 0x75, 0xDA, 0x7E, 0x07, 0xE8, 0x35, 0xD1, 0x9B, 0x44, 0x5A,
+    0x2A, 0xFD, 0x1B, 0xA5, 0x6E, 0x6A, 0x77, 0x66, 0xC6, 0x04, 0xED, 0x66, 0xB3, 0xBF, 0x97, 0x94,
+    0x68, 0x94, 0x61, 0xD4, 0x4C, 0xFD, 0x9A, 0xCE, 0xA1, 0x7C, 0xA5, 0xE9, 0x3F, 0xD0, 0xAD, 0x7D,
+    0x72, 0x72, 0x7A, 0x59, 0x4B, 0x90, 0xB6, 0xCA, 0x04, 0xB5, 0xE3, 0x49, 0xA8, 0x6F, 0x45, 0xA5,
+    0x57, 0x24, 0xBA, 0xE2, 0x55, 0x88, 0xCB, 0x4B, 0x31, 0x3B, 0x0D, 0x95, 0x26, 0x5F, 0x68, 0x77,
+    0x42, 0x26, 0xE4, 0x4A, 0x13, 0x4A, 0xED, 0x4E, 0x73, 0x10, 0x32, 0xFD, 0x5A, 0x29, 0xA1, 0xE4,
+    0x0F, 0xDC, 0xC1, 0xB8, 0xD1, 0xAF, 0x4E, 0x33, 0x4A, 0xBD, 0x70, 0xAA, 0x1F, 0x97, 0xAF, 0xFA,
+    0xD2, 0x7F, 0xF4, 0xE5, 0x36, 0xAA, 0x8C, 0x9A, 0xA5, 0x59, 0x87, 0x53, 0x71, 0x5A, 0x9C, 0xA6,
+    0x66, 0xC7, 0x16, 0x79, 0xFB, 0xFA, 0x75, 0xA8, 0x13, 0x19, 0xC2, 0xD0, 0x26, 0xAA, 0x83, 0xEF,
+    0x42, 0x73, 0xBC, 0x6E, 0x55, 0x1D, 0xF0, 0x5A, 0x80, 0xEA, 0xF7, 0x9F, 0x2E, 0x4E, 0x31, 0xD3,
+    0xAD, 0xBD, 0x72, 0xA5, 0x24, 0xA5, 0xF6, 0xA8, 0xFF, 0x4C, 0x84, 0x95, 0x6E, 0x43, 0x89, 0x38,
+    0x3B, 0xE1, 0x44, 0xB7, 0xE1, 0x0B, 0x71, 0x66, 0x5C, 0x9C, 0xA8, 0x35, 0x74, 0x05, 0x5F, 0xD0,
+    0x42, 0x58, 0x1A, 0x4D, 0xB5, 0x86, 0xB0, 0xE3, 0x4B, 0xAD, 0x4C, 0xC8, 0x7D, 0x4C, 0x49, 0xEF,
+    0x17, 0xBD, 0xFB, 0x7D, 0xE9, 0x43, 0xED, 0x5E, 0xBB, 0xD7, 0x12, 0x94, 0xC2, 0x41, 0xD8, 0x18,
+    0x67, 0xEE, 0x5C, 0x8F, 0x70, 0x3C, 0x7F, 0x57, 0x93, 0xDB, 0x47, 0xA5, 0x4E, 0x51, 0x29, 0xEA,
+    0x0D, 0xBD, 0xA7, 0x03, 0x7D, 0xFF, 0x78, 0x0E, 0xF9, 0x95, 0x4A, 0x7D, 0xA2, 0x3E, 0x46, 0x70,
+    0xFB, 0x01, 0xCE, 0xAA, 0xA5, 0x06, 0x5A, 0x69, 0xC2, 0x97, 0x31, 0xE1, 0x4B, 0x58, 0xE8, 0xB6,
+    0x3E, 0xFF, 0xFD, 0x7E, 0xEB, 0xCA, 0x77, 0xC3, 0xEA, 0xB5, 0x87, 0xB5, 0x51, 0x09, 0xD9, 0x29,
+    0x8F, 0x8B, 0xC1, 0x9C, 0xC1, 0xF3, 0x0B, 0x67, 0xD0, 0x99, 0x54, 0x0C, 0xB5, 0x49, 0x13, 0x47,
+    0xCC, 0xD7, 0xD3, 0x13, 0xDD, 0x1C, 0x16, 0x08, 0x29, 0xCE, 0x10, 0x06, 0x25, 0x88, 0x28, 0x81,
+    0x2A, 0x0D, 0x54, 0x7B, 0x2D, 0xA8, 0x8B, 0x13, 0xB8, 0xE2, 0x0E, 0x68, 0xD7, 0x76, 0x37, 0x9E,
+    0xFB, 0xDC, 0x37, 0xC7, 0xD9, 0xEF, 0xFF, 0x2A, 0x28, 0x79, 0xED, 0x41, 0x83, 0x57, 0x09, 0x07,
+    0x5E, 0xB9, 0x5F, 0x69, 0x35, 0x54, 0xC3, 0xCD, 0x38, 0xD0, 0x34, 0xDA, 0xE9, 0x9C, 0x45, 0xA4,
+    0xDA, 0x38, 0xE8, 0xD0, 0x69, 0xA6, 0xD2, 0x81, 0x04, 0xEE, 0x71, 0x69, 0xBF, 0x28, 0xD0, 0x7D,
+    0x92, 0xC3, 0x83, 0x05, 0x62, 0x78, 0x7F, 0xD3, 0x80, 0xDB, 0xF4, 0xAD, 0x0F, 0x0A, 0xF8, 0xFF,
+    0xB2, 0xFF, 0xA7, 0x2E, 0x43, 0x68, 0x1F, 0xE7, 0x98, 0xA8, 0x4A, 0xAF, 0x7F, 0x7D, 0x40, 0x9B,
+    0xC7, 0xE2, 0x57, 0x08, 0xDF, 0x53, 0x0E, 0x33, 0xEC, 0x8D, 0x06, 0x41, 0x9B, 0xBB, 0xD2, 0x94,
+    0x6F, 0x7C, 0x3D, 0x4C, 0xE3, 0xD2, 0xFD, 0xAF, 0xAC, 0x82, 0x88, 0xFA, 0x50, 0x8B, 0xDB, 0x6A,
+    0x95, 0x4E, 0xF8, 0xB9, 0xD1, 0x1C, 0x32, 0x2F, 0xE0, 0x37, 0x73, 0xD1, 0xCD, 0xCC, 0xE0, 0x41,
+    0xA1, 0x5B, 0x47, 0xCD, 0xB5, 0x7E, 0xA0, 0x9D, 0xB0, 0xBE, 0xA1, 0xE4, 0x84, 0x2F, 0x8C, 0xD9,
+    0xF0, 0xBE, 0xDB, 0xD0, 0x5C, 0x6B, 0xF0, 0x36, 0xCD, 0x4C, 0x4E, 0xD2, 0x66, 0x67, 0x36, 0xDA,
+    0xE3, 0x32, 0x66, 0x3B, 0x34, 0xE1, 0x0B, 0xE3, 0x52, 0x29, 0xB5, 0xC7, 0x73, 0xFD, 0x86, 0x7E,
+    0xF6, 0xA9, 0x06, 0xAF, 0x23, 0x64, 0xA4, 0x0F, 0x84, 0x57, 0x1E, 0xE7, 0x53, 0x4D, 0xBB, 0x77,
+    0x02, 0x59, 0x63, 0x85, 0x63, 0xA3, 0x93, 0xD6, 0x4A, 0x5F, 0x2A, 0xFB, 0xBD, 0xD2, 0xAC, 0xD9,
+    0xE9, 0x55, 0xE1, 0x8F, 0xB0, 0x12, 0x36, 0x25, 0xF4, 0xB1, 0x70, 0x7A, 0xB0, 0xE1, 0x8B, 0x16,
+    0xC6, 0x5F, 0x68, 0xA8, 0xF5, 0xD6, 0x81, 0x2F, 0x61, 0x23, 0x2E, 0x31, 0xB7, 0xAA, 0xF4, 0xB9,
+    0xB2, 0x93, 0x84, 0x93, 0x96, 0xB3, 0x0E, 0xBD, 0x78, 0xAE, 0x6F, 0xE0, 0xC1, 0x56, 0x6B, 0x1A,
+    0xF5, 0x9E, 0xF6, 0x56, 0x65, 0x54, 0x7E, 0x43, 0x9F, 0x48, 0x78, 0xAD, 0x63, 0x46, 0x7B, 0x73,
+    0xD0, 0x69, 0x88, 0x73, 0xAD, 0xC5, 0x17, 0x42, 0xB1, 0x79, 0x70, 0xB7, 0x59, 0x1D, 0xB7, 0xE3,
+    0x1F, 0x4F, 0xAF, 0x70, 0x7F, 0xAE, 0xDF, 0xD0, 0xC7, 0x3F, 0xD2, 0xE4, 0xB5, 0x87, 0xF5, 0x57,
+    0xAF, 0x10, 0x2A, 0x68, 0x35, 0x8C, 0x0B, 0x51, 0x6F, 0x6A, 0x43, 0x7A, 0x4B, 0x85, 0x87, 0x8A,
+    0xDA, 0xA9, 0x74, 0xF8, 0x83, 0x4A, 0x5B, 0x7B, 0x50, 0x2B, 0xB7, 0x07, 0x4E, 0xA9, 0x3D, 0x70,
+    0x9A, 0xFC, 0x4E, 0x23, 0x7C, 0xA1, 0x39, 0x30, 0x50, 0xE9, 0x37, 0x7C, 0x21, 0x64, 0xFC, 0xC6,
+    0x98, 0x6D, 0x3B, 0xE8, 0x57, 0xA7, 0x89, 0x70, 0x3C, 0xD0, 0xF5, 0x2C, 0xC0, 0x28, 0x65, 0x88,
+    0x9F, 0x69, 0x00, 0xCD, 0xF7, 0xAE, 0x9D, 0xCB, 0x95, 0xC1, 0x4F, 0x26, 0x33, 0x01, 0x8D, 0x7E,
+    0x6A, 0x0C, 0xC9, 0x46, 0x08, 0xC0, 0x1B, 0x0F, 0xFF, 0xF4, 0x6A, 0x71, 0x15, 0x37, 0x5A, 0x3B,
+    0xCA, 0x84, 0x74, 0x38, 0x4D, 0xFF, 0xB1, 0x3D, 0x78, 0xC1, 0x17, 0x03, 0xCA, 0x90, 0xAD, 0x61,
+    0x88, 0x8B, 0xFD, 0x93, 0xFD, 0x7B, 0x5E, 0x99, 0x35, 0x6E, 0x5F, 0xDB, 0x46, 0x93, 0xC5, 0xE7,
+    0x4E, 0x1A, 0x1A, 0xAD, 0xB7, 0xBB, 0xC0, 0x57, 0xB8, 0xAB, 0xA1, 0xCF, 0xB5, 0x86, 0x51, 0xEF,
+    0x69, 0xF3, 0x4A, 0x51, 0x1F, 0xAA, 0x8C, 0x9A, 0xDF, 0xD0, 0xBF, 0xD5, 0x2E, 0x2D, 0x28, 0x7E,
+    0x4B, 0x6B, 0x5C, 0x2A, 0x15, 0xAF, 0x39, 0xCE, 0x95, 0x56, 0xAF, 0x41, 0xA9, 0xD6, 0xD2, 0x09,
+    0x25, 0xA7, 0xD4, 0x97, 0x4A, 0x93, 0xD3, 0x10, 0xB6, 0x5A, 0x43, 0x23, 0x42, 0x76, 0xA2, 0x3D,
+    0x18, 0xB3, 0x13, 0x7E, 0x27, 0xCE, 0xE6, 0x35, 0xA5, 0x76, 0xC7, 0xC4, 0xC6, 0xF2, 0x42, 0xBF,
+    0x55, 0x9A, 0x7C, 0xF9, 0x97, 0x61, 0xAD, 0x35, 0x75, 0x2A, 0x21, 0xD7, 0x1A, 0x3A, 0x6D, 0x21,
+    0x3B, 0xE1, 0xB5, 0x8C, 0xB3, 0xDB, 0x69, 0x8F, 0x93, 0x64, 0xDD, 0x66, 0xF0, 0xDD, 0x83, 0x7E,
+    0xC5, 0x19, 0x35, 0x1D, 0x95, 0xBA, 0x9D, 0xBB, 0xEF, 0x16, 0x34, 0x83, 0x66, 0x5F, 0xA0, 0x3D,
+    0x50, 0x82, 0x31, 0xFB, 0x02, 0x4E, 0x68, 0x80, 0x90, 0xBB, 0x0C, 0xB5, 0xEA, 0x03, 0xE8, 0x72,
+    0x48, 0x50, 0xA9, 0x29, 0x80, 0xCF, 0x02, 0xD0, 0xEB, 0x0B, 0xE0, 0xBF, 0xB0, 0xA9, 0x62, 0x1C,
+    0x6E, 0x20, 0xFB, 0xD4, 0x6E, 0xFD, 0xA9, 0xE7, 0x2E, 0xB7, 0xE2, 0xD7, 0x79, 0xBE, 0x21, 0x26,
+    0xF8, 0x7B, 0xF4, 0x19, 0xDC, 0xF1, 0x6E, 0xB9, 0xD9, 0x42, 0x77, 0x65, 0xBC, 0xA6, 0x48, 0xDF,
+    0x34, 0x52, 0xC6, 0x1A, 0x6B, 0x9D, 0xD5, 0x78, 0x02, 0x1B, 0x36, 0xE3, 0xD7, 0x71, 0x82, 0xFA,
+    0x60, 0xB1, 0x93, 0x2B, 0xB7, 0xE2, 0xDA, 0xA9, 0x51, 0xAE, 0x00, 0xFF, 0x5C, 0xFF, 0xCD, 0x5A,
+    0x75, 0x0B, 0x2D, 0xAD, 0xF4, 0x8A, 0x8F, 0x35, 0x37, 0x7A, 0xF3, 0x68, 0x85, 0xE6, 0x30, 0x87,
+    0xAD, 0xDF, 0x5C, 0xA9, 0xF4, 0x81, 0x18, 0x93, 0x2F, 0xE3, 0xD2, 0x14, 0xF4, 0xC3, 0x9D, 0x98,
+    0x7C, 0x51, 0x6A, 0xB7, 0x4A, 0x1F, 0x15, 0x34, 0xF4, 0x9B, 0x66, 0xBF, 0x3A, 0xB5, 0x07, 0x22,
+    0x2E, 0x63, 0xEE, 0x72, 0x57, 0x9C, 0xDE, 0x53, 0xAB, 0xC1, 0x2B, 0x3E, 0x3E, 0x27, 0x24, 0x2B,
+    0x44, 0x93, 0x98, 0x1F, 0xE8, 0x1D, 0x9E, 0x35, 0x2D, 0x0E, 0xC0, 0xE0, 0x33, 0xF0, 0x8F, 0xAB,
+    0x03, 0x70, 0x47, 0x4C, 0xC0, 0x28, 0x13, 0xC3, 0x0B, 0x60, 0x12, 0xEE, 0xCD, 0x6B, 0x9C, 0x19,
+    0xE7, 0x4E, 0xA9, 0x55, 0x92, 0x86, 0x28, 0x27, 0x35, 0x5A, 0xF1, 0x25, 0xFC, 0xE7, 0x89, 0xFE,
+    0x4B, 0xF3, 0x60, 0xE2, 0x3C, 0xDF, 0xC0, 0x79, 0xA3, 0x01, 0x68, 0x0F, 0x80, 0xD1, 0x54, 0xEF,
+    0x8D, 0x73, 0x7E, 0x5A, 0x17, 0xCD, 0x7C, 0x73, 0xFC, 0x89, 0x12, 0x92, 0x53, 0xFC, 0xBE, 0xB2,
+    0xD7, 0xDE, 0x69, 0xE8, 0x94, 0xC3, 0x4A, 0xBF, 0xF3, 0xC2, 0x13, 0xF1, 0xFE, 0x7F, 0x45, 0x15,
+    0xF4, 0x4B, 0x54, 0x61, 0x70, 0xAA, 0x1F, 0x97, 0x6F, 0xFA, 0xD2, 0x7F, 0xF4, 0x79, 0xB9, 0xA5,
+    0x0A, 0x72, 0x2A, 0xEE, 0xD8, 0x9C, 0xA6, 0xF6, 0x67, 0x0B, 0xF7, 0xF8, 0x8A, 0xA9, 0xA1, 0x36,
+    0xA9, 0xB0, 0x78, 0xCA, 0x76, 0xC0, 0xEA, 0x46, 0x83, 0x8C, 0xE9, 0x89, 0xA6, 0xAC, 0x8A, 0x33,
+    0xF1, 0x43, 0x6D, 0xC4, 0xBF, 0xD0, 0x41, 0x58, 0xDF, 0xD0, 0xE0, 0x0B, 0x63, 0x6A, 0x0E, 0x7A,
+    0x3B, 0xC4, 0x83, 0x66, 0x77, 0x10, 0x32, 0x9A, 0x42, 0x21, 0xE4, 0xD1, 0x46, 0x7D, 0x43, 0x2D,
+    0x29, 0xD1, 0xDB, 0xF1, 0xC4, 0x6E, 0x03, 0xDA, 0xE3, 0x39, 0xA8, 0xF5, 0xD6, 0x04, 0x67, 0xF3,
+    0x9B, 0xC1, 0xDB, 0x21, 0x96, 0xF9, 0xA9, 0x33, 0x32, 0xDC, 0x55, 0xAA, 0x44, 0xBF, 0xF4, 0x5A,
+    0x9C, 0x88, 0x73, 0xD0, 0xD2, 0x1C, 0x28, 0xBD, 0x14, 0x97, 0x76, 0x47, 0x89, 0x71, 0xF6, 0xA5,
+    0xD2, 0x40, 0x4C, 0xF6, 0xA9, 0xE4, 0xD7, 0x5A, 0xA0, 0xA9, 0xCB, 0x4E, 0x54, 0x1A, 0x42, 0x6E,
+    0x0E, 0x6A, 0x11, 0x96, 0x76, 0xC7, 0x89, 0x38, 0xFB, 0x82, 0x3B, 0x50, 0xEA, 0x0B, 0xED, 0x5E,
+    0x2B, 0x85, 0x0D, 0x5F, 0x1A, 0x4D, 0xDA, 0xF0, 0xA5, 0xD3, 0x2B, 0x8F, 0xB7, 0xAF, 0xFB, 0x6D,
+    0x54, 0xFB, 0xB3, 0xBD, 0x74, 0xDA, 0xA5, 0x1F, 0xAA, 0x78, 0xAD, 0x52, 0xA3, 0xEC, 0x35, 0xAB,
+    0x34, 0x9A, 0x9B, 0x83, 0x71, 0x76, 0x07, 0xDC, 0xE3, 0xCE, 0x53, 0x50, 0xF0, 0x37, 0xB3, 0x77,
+    0x3A, 0xED, 0xE5, 0x6F, 0x67, 0x6F, 0x79, 0xD6, 0xDE, 0x7F, 0xE1, 0xB7, 0x51, 0xED, 0xCF, 0xB7,
+    0xAB, 0xBD, 0x9B, 0xD7, 0x2A, 0xB5, 0x57, 0x7B, 0x8F, 0x6C, 0xF6, 0xFE, 0x22, 0x9B, 0xBD, 0xAF,
+    0x9E, 0x82, 0x4F, 0xB3, 0x3E, 0xFD, 0xD9, 0x9E, 0x9F, 0xFE, 0xFC, 0x7B, 0x3C, 0xCF, 0xED, 0x5D,
+    0xC5, 0xC1, 0xB3, 0xAF, 0xED, 0xA5, 0xA3, 0x96, 0x54, 0xBC, 0xA4, 0x25, 0x3E, 0xFC, 0x77, 0xBB,
+    0xDB, 0x08, 0xC9, 0xE7, 0x66, 0xA3, 0x5F, 0xE2, 0xC4, 0x6F, 0xB4, 0x8F, 0xFE, 0xA9, 0x95, 0x0C,
+    0x27, 0x89, 0xFE, 0xD1, 0x83, 0x1D, 0x0D, 0xDD, 0xD6, 0x14, 0xC2, 0xD2, 0x67, 0x34, 0xC5, 0xE4,
+    0xF6, 0x5A, 0xF4, 0xB9, 0xD1, 0xDD, 0xB3, 0x87, 0xE9, 0xA4, 0xE9, 0xA9, 0x1E, 0x86, 0xEB, 0xE0,
+    0xCC, 0xD2, 0x03, 0xE2, 0x62, 0x87, 0x61, 0xD6, 0x97, 0xE2, 0x02, 0xBE, 0xD0, 0xAD, 0xE0, 0x44,
+    0x5B, 0xA0, 0xD2, 0xE4, 0xEC, 0x9A, 0x4A, 0xBF, 0xF7, 0xC7, 0x84, 0x95, 0x28, 0x25, 0x63, 0x22,
+    0xC5, 0x09, 0x7F, 0xFC, 0x91, 0x5E, 0xD6, 0xD4, 0x1C, 0x8C, 0x4B, 0x9C, 0x2B, 0x0D, 0x7E, 0x0B,
+    0x99, 0x98, 0xDC, 0xE1, 0x0B, 0x7D, 0x46, 0xAF, 0x1E, 0xCF, 0xB5, 0x85, 0xF8, 0x9E, 0xDE, 0xFA,
+    0x9E, 0xDE, 0xD3, 0x1C, 0xB5, 0x04, 0x69, 0xE9, 0x95, 0x1B, 0x69, 0x6E, 0xB5, 0x12, 0x4E, 0xAD,
+    0xEE, 0xFE, 0x6D, 0x80, 0xB6, 0x9A, 0xA8, 0x25, 0xEC, 0xA0, 0xD3, 0x4B, 0x71, 0x39, 0x7D, 0xD5,
+    0x16, 0x53, 0x7D, 0xA9, 0xF4, 0x7B, 0x7F, 0x4C, 0x7B, 0x4A, 0x57, 0x3B, 0xFA, 0xEF, 0x71, 0x6B,
+    0x0E, 0x42, 0xEE, 0x56, 0x62, 0x8A, 0xA9, 0x56, 0x2D, 0xDA, 0xAD, 0x2D, 0x8C, 0x73, 0xBF, 0xB7,
+    0xB2, 0x91, 0xEB, 0xA8, 0x03, 0x46, 0x4D, 0xD7, 0x23, 0x46, 0x15, 0xD6, 0x20, 0xD7, 0x36, 0xAF,
+    0x51, 0xAE, 0xF4, 0x87, 0x9A, 0xDB, 0xA5, 0xD6, 0xF4, 0x0F, 0x70, 0xE2, 0x79, 0xD3, 0x71, 0x43,
+    0xE6, 0xEF, 0x3E, 0x54, 0x62, 0x94, 0x6C, 0x12, 0x77, 0xF7, 0x4F, 0x6F, 0x0C, 0xF2, 0xA5, 0x4E,
+    0x8C, 0x4B, 0x3F, 0x39, 0xA1, 0x79, 0x5C, 0xDD, 0x39, 0x3C, 0x5D, 0xB1, 0xC3, 0x1C, 0x37, 0x7D,
+    0xCB, 0x0B, 0x54, 0x31, 0x53, 0x6B, 0x6D, 0xEC, 0xC4, 0xD2, 0x2B, 0xD2, 0xE0, 0xA5, 0xFC, 0x86,
+    0x92, 0x97, 0x0E, 0x42, 0x6E, 0x8F, 0x5A, 0xC9, 0x97, 0x46, 0x84, 0xDC, 0x1C, 0x4E, 0xF8, 0x52,
+    0xEB, 0x65, 0x4D, 0x4E, 0xE8, 0x7F, 0x28, 0xA1, 0x14, 0xA4, 0x4C, 0xC8, 0x9D, 0xB4, 0xE1, 0xB7,
+    0x56, 0xEF, 0x1E, 0x34, 0xBB, 0xBB, 0x5E, 0x93, 0xC6, 0xA5, 0xD2, 0x34, 0xE6, 0xAE, 0xA0, 0xD4,
+    0x6F, 0x4E, 0x83, 0x66, 0xBF, 0x63, 0xC7, 0x0B, 0xE9, 0xA5, 0x05, 0x25, 0x27, 0x2D, 0x8C, 0x33,
+    0xFD, 0x79, 0xE8, 0xEA, 0xFE, 0xED, 0x91, 0xAB, 0x2A, 0x9E, 0x13, 0xDF, 0x44, 0x90, 0x56, 0xFC,
+    0xF1, 0x3B, 0xC2, 0x8E, 0xEE, 0x85, 0xEC, 0xAC, 0x75, 0x9A, 0x09, 0xB9, 0x2D, 0x38, 0x0D, 0x9A,
+    0xE8, 0x8F, 0x77, 0x57, 0x90, 0x04, 0x4E, 0xCA, 0x10, 0x7E, 0x24, 0xF0, 0x6B, 0x58, 0xA8, 0x0F,
+    0xB7, 0x7F, 0xF5, 0xB7, 0x62, 0x1A, 0x3F, 0xFE, 0xB9, 0xD6, 0x56, 0xBB, 0x44, 0xD4, 0x5B, 0x4A,
+    0xAD, 0x96, 0x71, 0x61, 0x5C, 0xB8, 0x07, 0xF7, 0xA0, 0x5E, 0xDA, 0x84, 0xDE, 0x14, 0xFD, 0x36,
+    0xE6, 0x5A, 0xCD, 0x4E, 0x37, 0x87, 0xE9, 0x19, 0x55, 0xAF, 0x02, 0x3A, 0x4D, 0xB4, 0x3A, 0xEC,
+    0x39, 0x7A, 0x53, 0x84, 0xB9, 0xCB, 0xED, 0x56, 0x0B, 0x11, 0xE6, 0x7E, 0xF1, 0xC5, 0xED, 0x4E,
+    0x8C, 0xEF, 0x2B, 0xB5, 0x87, 0xE6, 0xF3, 0xD8, 0xCD, 0x0C, 0x4A, 0xFC, 0x43, 0x5F, 0xF0, 0x29,
+    0x2E, 0x6D, 0x69, 0x64, 0x62, 0xE0, 0x5C, 0x99, 0x1A, 0xBD, 0x5A, 0x89, 0xFE, 0xDF, 0xE5, 0xBD,
+    0x3F, 0xAC, 0x2D, 0xD7, 0x75, 0xE6, 0xF9, 0xAB, 0x2A, 0xBE, 0x57, 0x32, 0xCB, 0xAD, 0x4D, 0x60,
+    0xC8, 0x1E, 0x59, 0xB4, 0x5D, 0x0A, 0x0C, 0x8C, 0xDA, 0xD3, 0x56, 0x39, 0xE8, 0xA0, 0x1B, 0x90,
+    0xB4, 0x4B, 0x22, 0x30, 0x0A, 0x84, 0x81, 0x1E, 0x30, 0x3C, 0x52, 0x63, 0x14, 0x48, 0x81, 0x31,
+    0xE8, 0xA1, 0x81, 0xE6, 0x04, 0x0E, 0x14, 0x50, 0xAC, 0x92, 0x18, 0x28, 0x10, 0x30, 0x7A, 0x03,
+    0xD8, 0xD3, 0x81, 0x03, 0x33, 0x50, 0x20, 0x3F, 0x0D, 0x40, 0x07, 0x0A, 0x6C, 0x80, 0x64, 0x95,
+    0x48, 0x0C, 0x18, 0x38, 0x70, 0xB5, 0x34, 0x6A, 0x05, 0x0E, 0x58, 0x6A, 0x51, 0xEE, 0x1E, 0x29,
+    0xE0, 0x66, 0xAB, 0x68, 0xD5, 0x23, 0x77, 0xD5, 0x37, 0xC1, 0xDA, 0x75, 0xEE, 0xBD, 0xEF, 0x8F,
+    0xE4, 0x76, 0xF7, 0xB4, 0x44, 0xF5, 0x01, 0x79, 0xEE, 0xBB, 0xF7, 0xD4, 0x3D, 0xB7, 0xCE, 0xFE,
+    0xB3, 0xF6, 0x5A, 0xDF, 0xFA, 0xD6, 0xB7, 0x00, 0xB2, 0x8D, 0x52, 0x54, 0xC2, 0xED, 0x54, 0x91,
+    0xEC, 0x26, 0x00, 0x0F, 0x91, 0x07, 0xCA, 0x40, 0x15, 0x70, 0x01, 0x37, 0x53, 0xCF, 0x34, 0x33,
+    0x7E, 0xC2, 0x4F, 0x74, 0x23, 0xC3, 0x88, 0xC6, 0x4C, 0x7D, 0xAE, 0xBE, 0x50, 0x7B, 0x7E, 0x83,
+    0x3A, 0xD2, 0x2C, 0x34, 0xF6, 0x1E, 0x00, 0xBE, 0x05, 0x3A, 0x80, 0x01, 0x60, 0x07, 0xD8, 0x80,
+    0x2C, 0x02, 0xD9, 0x0A, 0x3C, 0xAA, 0x9E, 0x5C, 0x5A, 0x69, 0xA4, 0xC8, 0x20, 0x6D, 0xB9, 0x7E,
+    0xF4, 0xAD, 0x58, 0xCA, 0x8D, 0xEF, 0x73, 0xD1, 0x8D, 0x34, 0x8B, 0xEB, 0xF1, 0xA1, 0x6E, 0xF1,
+    0x73, 0x03, 0xDD, 0xE4, 0x61, 0x98, 0x3E, 0x0C, 0xC3, 0xF4, 0x79, 0x18, 0xA6, 0x17, 0xA0, 0x0B,
+    0x91, 0xC9, 0x2F, 0xB1, 0x0C, 0x7E, 0x5F, 0xBB, 0xB9, 0x96, 0xD4, 0x57, 0xD2, 0x46, 0x26, 0xCD,
+    0x50, 0xDF, 0x06, 0xAA, 0x19, 0x70, 0xD3, 0xF9, 0x69, 0x04, 0xEA, 0x11, 0x68, 0xFA, 0xE3, 0x3E,
+    0x3D, 0x97, 0x1E, 0xD7, 0x00, 0x18, 0x76, 0x20, 0x97, 0x66, 0x28, 0xA4, 0x08, 0xB9, 0xFE, 0x95,
+    0x5A, 0x32, 0xB5, 0x7E, 0x02, 0xF5, 0x2E, 0xC0, 0x30, 0x16, 0x2B, 0xF8, 0xC0, 0x1F, 0x42, 0xBD,
+    0x02, 0x54, 0x11, 0xA0, 0x10, 0x40, 0xA6, 0xF1, 0x04, 0x5E, 0x52, 0x4B, 0x2D, 0x69, 0xA4, 0x92,
+    0x34, 0x43, 0xB9, 0x03, 0xE4, 0x6A, 0x01, 0x34, 0x02, 0xF8, 0x19, 0xA0, 0x5E, 0x00, 0x5C, 0x04,
+    0xF2, 0xFF, 0x69, 0x83, 0x4F, 0x23, 0x49, 0x1A, 0x07, 0x49, 0x0A, 0x8D, 0x24, 0x2D, 0xA5, 0xDA,
+    0x27, 0xB5, 0xF0, 0x17, 0x90, 0xB5, 0xD0, 0x02, 0x0F, 0xE5, 0x81, 0x1B, 0xD9, 0x52, 0xC6, 0x46,
+    0x5F, 0x8E, 0xB9, 0x24, 0x05, 0x3A, 0x49, 0x3D, 0xCD, 0x5A, 0x6D, 0xE0, 0xA7, 0x62, 0x83, 0xAE,
+    0xCF, 0x37, 0x18, 0xC8, 0x37, 0x10, 0x45, 0xBC, 0x78, 0x76, 0x0B, 0xA8, 0xF7, 0x81, 0x42, 0x52,
+    0xA0, 0x96, 0xB4, 0x31, 0xFC, 0xB5, 0x6E, 0xAB, 0xF5, 0x3C, 0xD1, 0x7A, 0xDE, 0x03, 0xFC, 0x6A,
+    0x1A, 0x9C, 0x46, 0xFA, 0xA8, 0xF4, 0x7D, 0x29, 0x78, 0x6D, 0x5E, 0x5B, 0x2E, 0xF5, 0xDD, 0x46,
+    0xA1, 0xBE, 0xD0, 0x48, 0x37, 0x51, 0x47, 0xDC, 0x0A, 0x9A, 0x0B, 0x41, 0x25, 0x86, 0x11, 0x7C,
+    0x70, 0x0B, 0x14, 0x7A, 0x6C, 0x83, 0x07, 0x9A, 0x38, 0x7C, 0x13, 0xA4, 0x57, 0x15, 0x70, 0x92,
+    0x04, 0xA7, 0x4E, 0xB7, 0x6E, 0x42, 0xAE, 0x19, 0xB8, 0xF5, 0xDC, 0xFE, 0x75, 0x1B, 0xAA, 0x15,
+    0x06, 0x49, 0xED, 0x31, 0xA0, 0xF8, 0x00, 0xC7, 0xF0, 0x31, 0x4C, 0x00, 0xF5, 0x9E, 0xEE, 0xAA,
+    0x85, 0x4A, 0x5A, 0x01, 0xC9, 0xAE, 0x16, 0x74, 0x23, 0xCD, 0x8C, 0x5B, 0x28, 0x22, 0xD9, 0x3D,
+    0xBE, 0x1F, 0x7A, 0x9A, 0x99, 0x6B, 0x37, 0xB8, 0xC7, 0x23, 0xBB, 0x05, 0x43, 0x8F, 0x9F, 0x70,
+    0xE1, 0xD2, 0xF5, 0xF6, 0x7D, 0x79, 0xF9, 0xFB, 0x07, 0x9F, 0x3D, 0xFF, 0x52, 0xB3, 0x41, 0xA5,
+    0x9D, 0x4C, 0x8A, 0x34, 0x73, 0xB7, 0x64, 0xC2, 0x8F, 0x2E, 0xF2, 0x34, 0x43, 0xE0, 0x66, 0xF1,
+    0x6A, 0x80, 0xBA, 0x99, 0xE1, 0x79, 0x1F, 0xC8, 0x83, 0x5F, 0xA8, 0x26, 0xBF, 0xD0, 0x8C, 0xCD,
+    0x4A, 0xD7, 0xD7, 0x0B, 0xEA, 0xEB, 0x80, 0xC6, 0x7A, 0xCE, 0x34, 0x35, 0x63, 0xA6, 0xC9, 0x83,
+    0xA6, 0x08, 0xC3, 0xCB, 0x33, 0x0C, 0x5F, 0xE9, 0x61, 0x78, 0x21, 0x9F, 0x51, 0x68, 0xC6, 0x42,
+    0xAD, 0x5A, 0x17, 0x0B, 0x31, 0x8C, 0x4E, 0x8A, 0xD4, 0x52, 0x4F, 0xA5, 0xD7, 0x80, 0x1B, 0x40,
+    0x35, 0x36, 0x8F, 0xA9, 0x8A, 0x5D, 0xD0, 0x5F, 0x6E, 0xF5, 0xEA, 0x5B, 0x1B, 0x37, 0xAE, 0xBF,
+    0x78, 0x13, 0xC8, 0xA4, 0x1D, 0x70, 0xFB, 0x69, 0x98, 0xA1, 0xEB, 0xC9, 0xA3, 0xED, 0xCD, 0x8E,
+    0x62, 0x06, 0xDC, 0xE8, 0xC6, 0x6C, 0xB8, 0x59, 0xCC, 0x35, 0xB5, 0xD6, 0x3C, 0x7C, 0x98, 0xEE,
+    0x47, 0x2B, 0xEB, 0x87, 0xD8, 0x59, 0x79, 0xFE, 0xA9, 0x3C, 0xB2, 0xF0, 0xD4, 0x9F, 0x17, 0x2B,
+    0x37, 0xF8, 0xD0, 0x5A, 0xAC, 0xC0, 0x87, 0xD7, 0x72, 0xB9, 0xF2, 0x65, 0x05, 0x3E, 0xF4, 0xE7,
+    0x45, 0x04, 0x3E, 0xF4, 0x54, 0xB1, 0x03, 0x4F, 0x7D, 0x28, 0xD3, 0x0F, 0x9F, 0xE7, 0x79, 0xCF,
+    0xA0, 0xC8, 0x5A, 0xB7, 0x8D, 0x96, 0x3C, 0xB8, 0x31, 0xFB, 0x5F, 0x29, 0xA7, 0x22, 0x00, 0x75,
+    0x8F, 0xDD, 0x04, 0xBE, 0xA7, 0x5C, 0xA1, 0xDA, 0xFF, 0xCF, 0x61, 0x02, 0x06, 0xED, 0x00, 0xD7,
+    0x6E, 0xB5, 0x69, 0xA8, 0xCB, 0xE5, 0xCF, 0xF1, 0x5A, 0x91, 0x96, 0x7C, 0xAB, 0x42, 0xB9, 0x54,
+    0x73, 0x15, 0xDC, 0xE8, 0xA6, 0x7A, 0x74, 0xA3, 0xEF, 0xEB, 0x71, 0x68, 0xEB, 0x6F, 0xE9, 0x7F,
+    0x74, 0xD2, 0x0B, 0x4E, 0x4F, 0xAE, 0xE5, 0xE6, 0x66, 0xEC, 0x77, 0x1F, 0xBA, 0x7E, 0xEB, 0xB9,
+    0xD0, 0x48, 0xC1, 0x4B, 0x3D, 0xC0, 0xE9, 0x74, 0x3A, 0x7D, 0x5C, 0x52, 0x1C, 0x24, 0xFD, 0xA5,
+    0xA4, 0x08, 0xF8, 0x11, 0x8A, 0xBB, 0xFE, 0x91, 0x7F, 0xCD, 0x6B, 0x77, 0xD2, 0x77, 0xA5, 0x37,
+    0xA4, 0xF8, 0xC8, 0xE9, 0x04, 0x3C, 0x0C, 0x3C, 0xAA, 0x05, 0xF6, 0xD3, 0x40, 0x31, 0x53, 0x8D,
+    0xAE, 0x27, 0x0B, 0x1F, 0x68, 0xD4, 0xFE, 0xF9, 0x07, 0xEB, 0x1F, 0xCD, 0x1F, 0xFC, 0x5C, 0xF9,
+    0x52, 0xF8, 0x9D, 0x6F, 0x94, 0x2F, 0x05, 0x17, 0xCA, 0x57, 0x26, 0x17, 0x4A, 0xB5, 0x2E, 0x94,
+    0xAF, 0xE3, 0xBE, 0x51, 0xFE, 0xD5, 0xE8, 0x3E, 0x57, 0xBE, 0x1C, 0x7E, 0xF3, 0x83, 0xCD, 0x9B,
+    0xDB, 0x07, 0x3F, 0xF0, 0xC8, 0x8D, 0xF7, 0x7F, 0xCE, 0xB5, 0x64, 0xA1, 0x98, 0xA9, 0x26, 0xF6,
+    0xD3, 0x00, 0xB5, 0x16, 0xE0, 0x04, 0xD7, 0x4E, 0x8F, 0x3B, 0xE9, 0xDF, 0x49, 0xB7, 0xA5, 0x78,
+    0xED, 0x74, 0x82, 0x6B, 0x50, 0xAB, 0xAF, 0xA4, 0x5C, 0x8A, 0xFE, 0x07, 0xC3, 0x77, 0xD7, 0x7C,
+    0x1F, 0x70, 0x6F, 0x07, 0x34, 0xB4, 0xEE, 0x47, 0x31, 0xDF, 0xFC, 0x5B, 0x7A, 0x49, 0x5A, 0x2A,
+    0x6D, 0x3C, 0xBA, 0x43, 0x76, 0xE3, 0xBE, 0x9F, 0xAC, 0x88, 0x94, 0x57, 0xC6, 0xA0, 0x93, 0x34,
+    0xDE, 0xFF, 0x62, 0xF8, 0x6D, 0x1B, 0xCE, 0xEC, 0x74, 0x3A, 0x3D, 0x7E, 0xFE, 0xAD, 0x41, 0x32,
+    0x93, 0x06, 0x40, 0xB7, 0xE1, 0xB4, 0x23, 0xC5, 0x6A, 0x75, 0x4B, 0xD3, 0x36, 0xD3, 0xFB, 0x11,
+    0x54, 0x2B, 0x0C, 0x23, 0x55, 0x04, 0x8D, 0xB8, 0x95, 0x4C, 0x2D, 0xCD, 0x4C, 0xB1, 0x9F, 0x1E,
+    0x6F, 0xA4, 0xC5, 0x8C, 0xDE, 0x6A, 0x6F, 0x3F, 0x2C, 0x0C, 0x9A, 0x1A, 0xED, 0xC5, 0xEA, 0xC2,
+    0x6F, 0xB0, 0x43, 0x3D, 0x51, 0xAD, 0x3C, 0xBA, 0xE1, 0x14, 0x78, 0x51, 0x3D, 0x45, 0x04, 0x3F,
+    0x52, 0xAE, 0xE4, 0xCA, 0x7E, 0x5F, 0x53, 0xA7, 0xA5, 0xD0, 0xC2, 0x35, 0xBB, 0xC1, 0x90, 0xC7,
+    0x62, 0x73, 0xB1, 0x59, 0xFC, 0x3C, 0xB4, 0x1B, 0xBF, 0x7B, 0x69, 0x93, 0x0F, 0x63, 0xBE, 0xC3,
+    0x30, 0x17, 0x6A, 0xF1, 0x01, 0x8D, 0xB8, 0x88, 0x0F, 0x94, 0x3B, 0xF5, 0x4A, 0xAE, 0xB6, 0xDA,
+    0x60, 0x18, 0x0B, 0x71, 0xE9, 0xE5, 0x99, 0x62, 0xA7, 0x5E, 0xC8, 0xD2, 0xCB, 0x53, 0x21, 0x68,
+    0x96, 0xCC, 0x5E, 0x56, 0xA0, 0x50, 0x3B, 0x44, 0xD0, 0x9B, 0x83, 0x3E, 0xD6, 0x77, 0xD2, 0x9F,
+    0x28, 0x34, 0xD2, 0x2B, 0x5A, 0x9C, 0x34, 0x6A, 0x2D, 0x6E, 0xAB, 0xAF, 0x97, 0x6C, 0xBF, 0x06,
+    0x2D, 0x43, 0x7F, 0x61, 0xFF, 0xDD, 0x0A, 0x50, 0x6E, 0xF7, 0x3B, 0x1E, 0x2E, 0x4E, 0xD7, 0xD3,
+    0x09, 0xE8, 0xA4, 0x99, 0x5C, 0xD2, 0x42, 0x29, 0x0D, 0xCF, 0x52, 0x4A, 0x6E, 0xA4, 0x90, 0x5E,
+    0x09, 0x14, 0xD2, 0x1B, 0x2B, 0x99, 0xB4, 0xBE, 0x00, 0x83, 0x36, 0x0F, 0x5E, 0x72, 0x23, 0xEE,
+    0x78, 0xF9, 0x7B, 0x2B, 0xD8, 0xCB, 0x5E, 0x9B, 0x87, 0x4A, 0x72, 0x23, 0x48, 0x2F, 0x07, 0xA8,
+    0xF5, 0xBD, 0x15, 0xF8, 0x5F, 0x96, 0x17, 0x00, 0xA2, 0x07, 0xF0, 0x76, 0x74, 0xBE, 0x1C, 0x80,
+    0xF2, 0x7B, 0x2B, 0x90, 0xDF, 0xE3, 0xE5, 0x2F, 0x4F, 0x80, 0x7B, 0x25, 0x00, 0xE5, 0x4F, 0x16,
+    0x78, 0x5F, 0xA1, 0x05, 0xFC, 0xA7, 0xB5, 0x80, 0xD3, 0xED, 0x1B, 0x80, 0x16, 0xE0, 0x30, 0xBB,
+    0xF9, 0xDC, 0x7D, 0x5F, 0x7F, 0x25, 0xBF, 0x0C, 0x6D, 0x9A, 0x12, 0xBF, 0x5E, 0xDB, 0xF1, 0x6D,
+    0x33, 0x36, 0x53, 0x37, 0x35, 0x3D, 0x00, 0x2D, 0xF5, 0xF4, 0xA4, 0x9E, 0xD1, 0x56, 0x2A, 0xD0,
+    0x8D, 0xD9, 0x4E, 0xB5, 0xE0, 0x47, 0x44, 0xB9, 0xD2, 0xCC, 0x0C, 0x6D, 0x11, 0x71, 0xA1, 0xD4,
+    0xDA, 0xE9, 0x6F, 0xA5, 0x91, 0x6C, 0xE8, 0x71, 0x0A, 0x74, 0xAF, 0xAF, 0xA8, 0x88, 0xF9, 0x96,
+    0xC7, 0x22, 0xE6, 0xB1, 0x5C, 0x8A, 0x58, 0x85, 0x72, 0xAD, 0x82, 0x0B, 0x55, 0xA8, 0xE7, 0xF2,
+    0xF6, 0x30, 0xE6, 0x12, 0x0C, 0xCB, 0x31, 0xB6, 0xED, 0xF5, 0x5B, 0xC3, 0xD8, 0x48, 0xA3, 0xD7,
+    0x7E, 0xF9, 0x40, 0xE8, 0x81, 0x07, 0x00, 0xEA, 0x16, 0xAA, 0x05, 0x28, 0x36, 0x78, 0x52, 0xBD,
+    0x4D, 0x93, 0x53, 0x00, 0xEA, 0x00, 0x9D, 0xD2, 0x6B, 0xD4, 0x01, 0x50, 0x0F, 0xD9, 0x0E, 0x34,
+    0x01, 0x68, 0xA6, 0xB4, 0x7B, 0x8A, 0x08, 0xA8, 0x4D, 0x1B, 0xAA, 0x99, 0x80, 0x72, 0x85, 0x72,
+    0x25, 0x5B, 0x19, 0x7A, 0x10, 0x0C, 0x63, 0xB5, 0x40, 0x33, 0xD2, 0x44, 0x04, 0xE5, 0x42, 0x65,
+    0x9E, 0xC7, 0x4E, 0xAE, 0xA5, 0x56, 0xC0, 0x8F, 0x0C, 0x5D, 0x29, 0xB5, 0x55, 0xA0, 0x79, 0x25,
+    0x0C, 0x9A, 0xB3, 0x9D, 0x32, 0xBC, 0x08, 0xE0, 0xC7, 0x2C, 0xBA, 0x19, 0x70, 0x81, 0xEE, 0x23,
+    0x1B, 0x90, 0xEF, 0xD4, 0x3F, 0x78, 0xF2, 0xFF, 0x01, 0xBA, 0xB1, 0x30, 0x67, 0xC4, 0x05, 0xBC,
+    0xB4, 0x41, 0xB1, 0x91, 0xDD, 0xFA, 0xFA, 0x5B, 0x3D, 0x0C, 0x63, 0x72, 0xDD, 0xEA, 0x00, 0x54,
+    0x21, 0x7D, 0x18, 0x76, 0xA0, 0xEB, 0x8F, 0xE1, 0xF8, 0x33, 0xEE, 0xF9, 0xB8, 0xC6, 0x31, 0x4C,
+    0x2B, 0x69, 0x98, 0x7C, 0x48, 0xC3, 0x54, 0x46, 0xD2, 0x30, 0xA9, 0x4D, 0xC3, 0xE4, 0xE7, 0xF4,
+    0x77, 0xAA, 0x48, 0x1A, 0x26, 0x91, 0x86, 0xC9, 0x4F, 0x69, 0x98, 0xAA, 0x95, 0x34, 0x4C, 0x22,
+    0x0D, 0x93, 0x1F, 0xAF, 0xAB, 0x67, 0xE8, 0xA9, 0x96, 0x5C, 0x6A, 0xAB, 0x85, 0x6C, 0x47, 0x8A,
+    0x08, 0xFC, 0xD8, 0xCC, 0x7E, 0x72, 0x01, 0x17, 0x8A, 0xB5, 0xD8, 0x6A, 0x85, 0x7C, 0xE3, 0x37,
+    0xF1, 0xAF, 0x48, 0x6D, 0xD7, 0x43, 0xB5, 0x0E, 0x9A, 0x5D, 0x80, 0x5C, 0xC7, 0x3C, 0x0C, 0x23,
+    0x30, 0xF4, 0x69, 0x8E, 0xEA, 0x90, 0xF6, 0x62, 0x11, 0x8F, 0xED, 0xA8, 0x96, 0xCC, 0x6E, 0x2C,
+    0xD8, 0x85, 0x94, 0x11, 0x1A, 0x29, 0x80, 0x5A, 0x0A, 0xC9, 0x4C, 0x04, 0xB5, 0x34, 0xD9, 0x7B,
+    0xDA, 0x29, 0xD5, 0xDE, 0x7B, 0x98, 0x78, 0x1F, 0xE6, 0xC1, 0x51, 0x04, 0xC8, 0xB4, 0xA4, 0xB7,
+    0x6E, 0xB4, 0xD8, 0x5F, 0xCB, 0x35, 0xA4, 0xBB, 0x70, 0x93, 0x1F, 0xED, 0x0E, 0x7F, 0x83, 0xDD,
+    0xFE, 0xAE, 0xCD, 0x8A, 0x9F, 0x00, 0x86, 0x96, 0x7C, 0x4F, 0x76, 0xD2, 0x66, 0xCC, 0x29, 0xA4,
+    0x91, 0xFA, 0xC0, 0x30, 0x53, 0x2D, 0x64, 0x2B, 0xF8, 0x91, 0xAE, 0xA7, 0x09, 0xC9, 0xEF, 0xCB,
+    0x35, 0x52, 0xAD, 0x34, 0x23, 0xCD, 0x0E, 0xC3, 0x98, 0x6F, 0xE4, 0x5A, 0x9E, 0x18, 0x36, 0xEA,
+    0x99, 0xE6, 0xD5, 0x6F, 0x4A, 0x23, 0x22, 0x8F, 0x5D, 0xA1, 0xD7, 0x70, 0x81, 0xFA, 0xA5, 0x95,
+    0x16, 0x86, 0x36, 0x2D, 0xA9, 0x32, 0x52, 0x4F, 0x9D, 0xAD, 0xDE, 0x6C, 0xFF, 0xE4, 0xD6, 0x42,
+    0xB1, 0xE1, 0x24, 0xF5, 0xD0, 0xCC, 0x69, 0x4D, 0x65, 0x82, 0x27, 0x6E, 0xED, 0xCF, 0x82, 0x5B,
+    0x80, 0xF2, 0xD8, 0x0E, 0x34, 0xE3, 0xE1, 0x2B, 0xEF, 0x69, 0xB2, 0xED, 0xF1, 0x9B, 0xF7, 0x1E,
+    0x2C, 0x3F, 0xE2, 0x17, 0xDC, 0x46, 0x29, 0x50, 0xCB, 0xAF, 0x9C, 0x87, 0x57, 0x14, 0x0A, 0xB9,
+    0x22, 0x8F, 0x08, 0xBA, 0x3E, 0x45, 0x28, 0xE7, 0xFF, 0xBA, 0x11, 0x3F, 0x52, 0xCF, 0x54, 0x2B,
+    0x1F, 0x55, 0xF6, 0x8D, 0x4E, 0xBB, 0x93, 0xBE, 0x28, 0x4D, 0x8D, 0xE6, 0x6C, 0x38, 0xFF, 0xDD,
+    0x17, 0xB8, 0x09, 0xE0, 0xD7, 0x06, 0xC0, 0xE9, 0x47, 0x8B, 0xB9, 0x48, 0x02, 0xA8, 0x9F, 0x31,
+    0x2B, 0xFC, 0x67, 0x6E, 0xE6, 0xA7, 0x3C, 0x9E, 0xB4, 0xA9, 0x6E, 0x96, 0x74, 0x67, 0xB6, 0x53,
+    0x14, 0x93, 0xDF, 0x3C, 0x5A, 0x64, 0xB0, 0xD9, 0x4F, 0x65, 0xDE, 0xEB, 0x4F, 0x76, 0x80, 0x62,
+    0x33, 0xCF, 0x76, 0x78, 0x46, 0x00, 0x2E, 0xF8, 0x00, 0xE4, 0xBB, 0x9D, 0x01, 0xDD, 0xD8, 0xAC,
+    0x80, 0x5B, 0x33, 0x8D, 0x90, 0x8B, 0x3A, 0x02, 0x7E, 0x42, 0x23, 0x54, 0x4A, 0x03, 0x6D, 0xBB,
+    0xD9, 0x9B, 0x43, 0x5D, 0xEE, 0xB7, 0x6E, 0x29, 0x80, 0x46, 0x4A, 0xD9, 0x2D, 0x75, 0x0B, 0xC5,
+    0x0E, 0x85, 0x7A, 0x34, 0x82, 0xDF, 0x18, 0x74, 0x93, 0x41, 0x9B, 0xD7, 0x4E, 0x2D, 0x7D, 0x5F,
+    0x9A, 0x72, 0xD9, 0xED, 0x65, 0xC9, 0x32, 0xDB, 0x4D, 0x32, 0x98, 0x3F, 0x5D, 0xFF, 0x9B, 0x15,
+    0x20, 0x0F, 0xCE, 0xCE, 0x24, 0x56, 0x80, 0x22, 0x34, 0xAD, 0x7D, 0xC0, 0x70, 0xF9, 0xF3, 0x66,
+    0x7F, 0xF1, 0xCB, 0x3A, 0x38, 0x8F, 0x9C, 0x4E, 0xA7, 0xD3, 0x8D, 0xB4, 0x3C, 0xEC, 0x56, 0x0B,
+    0xC9, 0xE2, 0x14, 0xB2, 0x21, 0x79, 0x8F, 0xE4, 0xDA, 0xB3, 0xCF, 0x04, 0x80, 0xFA, 0xF5, 0x05,
+    0x3F, 0x02, 0xD9, 0xDE, 0x8D, 0x16, 0x08, 0xBB, 0x1F, 0x8B, 0x22, 0x00, 0xC8, 0xCE, 0x7C, 0xA8,
+    0x96, 0x2E, 0xAD, 0xC6, 0xE1, 0x8B, 0x4A, 0x8B, 0x3B, 0xBA, 0x78, 0xAC, 0x7F, 0x2F, 0x05, 0xA0,
+    0xD8, 0xB2, 0xE4, 0x5F, 0xF9, 0xB9, 0xB2, 0x1B, 0xCA, 0x85, 0xBF, 0x7D, 0xBA, 0x01, 0xD4, 0xFB,
+    0x2D, 0x1B, 0xC8, 0x4C, 0x4A, 0x47, 0x97, 0xB3, 0x30, 0x0A, 0xD0, 0x77, 0x4E, 0x9A, 0xA8, 0x5B,
+    0xAA, 0x48, 0x21, 0xD8, 0x61, 0x98, 0xA8, 0x23, 0xD5, 0x42, 0xB9, 0xC3, 0x30, 0xE3, 0x47, 0xBA,
+    0x40, 0xA1, 0x5B, 0xCF, 0x89, 0x4A, 0x73, 0x26, 0x49, 0x6B, 0x26, 0xCD, 0x4E, 0x92, 0xC6, 0x4A,
+    0x6A, 0x07, 0x1D, 0xD1, 0x95, 0x3D, 0xFE, 0xA1, 0x74, 0x13, 0x0B, 0xD3, 0x6E, 0x82, 0xEC, 0xEF,
+    0x76, 0x36, 0xDE, 0xBF, 0xF6, 0x99, 0xED, 0xBA, 0x76, 0xA8, 0x84, 0xD3, 0x44, 0xAE, 0x11, 0x45,
+    0xD0, 0x4C, 0x2D, 0xF0, 0x0B, 0x85, 0x26, 0xEA, 0x08, 0xC3, 0x4A, 0x25, 0xA8, 0x77, 0x0A, 0x8D,
+    0x94, 0xEA, 0x6F, 0xE9, 0xAD, 0xAF, 0x66, 0x9A, 0x3B, 0x69, 0xA7, 0x5B, 0x1B, 0x49, 0x6D, 0xB3,
+    0x51, 0x09, 0x9C, 0x28, 0x34, 0x52, 0x68, 0x44, 0x33, 0x99, 0x66, 0xBA, 0x05, 0x14, 0x68, 0x2E,
+    0xDE, 0xA7, 0x8B, 0x14, 0xEA, 0x19, 0x22, 0x68, 0xCE, 0xB4, 0xD9, 0xED, 0x6D, 0x36, 0x4B, 0xAB,
+    0x7D, 0x99, 0x41, 0xD2, 0x7E, 0xD5, 0x38, 0xBF, 0xC8, 0x4D, 0xC0, 0xAF, 0x75, 0x0B, 0x95, 0xDE,
+    0x5E, 0xCE, 0xB1, 0xA4, 0x7B, 0x46, 0x13, 0xF0, 0x67, 0x55, 0xB8, 0xCF, 0xD6, 0x7F, 0x54, 0x37,
+    0x0F, 0x7F, 0x8C, 0x46, 0xD2, 0x88, 0x93, 0xB4, 0x53, 0xEA, 0xF6, 0xA7, 0xB5, 0xA0, 0x88, 0xD3,
+    0xE8, 0x05, 0xDD, 0x56, 0x6A, 0xA4, 0xD0, 0xAC, 0x05, 0x1A, 0xD5, 0x82, 0x5C, 0x3F, 0xB6, 0x5F,
+    0xF3, 0x11, 0x72, 0xFD, 0x44, 0x23, 0x34, 0x1A, 0x22, 0xE4, 0x7A, 0x5D, 0x3D, 0xF8, 0x5D, 0x2B,
+    0x14, 0x7A, 0x55, 0x3D, 0x74, 0x51, 0x2B, 0x54, 0xFA, 0xB2, 0x7A, 0x50, 0x18, 0x22, 0x34, 0x7B,
+    0xA9, 0x89, 0x52, 0xA3, 0x17, 0x99, 0x96, 0x5C, 0x5B, 0x36, 0xEC, 0x16, 0x5A, 0xF7, 0x78, 0x5B,
+    0xA2, 0xF6, 0x91, 0xB3, 0x41, 0x33, 0xC0, 0x23, 0xAD, 0x1D, 0x3E, 0xEF, 0xCB, 0x03, 0x4D, 0x2E,
+    0x9A, 0x65, 0x08, 0x75, 0xAC, 0x54, 0x47, 0x06, 0x45, 0x2A, 0x6D, 0x30, 0x6C, 0x50, 0x0B, 0x6A,
+    0x83, 0x04, 0xA8, 0xB7, 0x21, 0xD4, 0x5B, 0xA5, 0x6A, 0x63, 0x98, 0x5E, 0xA0, 0x9A, 0x7E, 0x05,
+    0xA6, 0xCB, 0x63, 0xF0, 0x10, 0x70, 0x5D, 0xAF, 0xB1, 0xD8, 0xFA, 0x7B, 0x6C, 0xB5, 0xFD, 0x77,
+    0xDE, 0x78, 0x3D, 0x99, 0xF6, 0x4F, 0x4A, 0x50, 0x28, 0xE0, 0x05, 0x4E, 0x3D, 0xB5, 0x5A, 0x6A,
+    0x41, 0xA7, 0x1E, 0x1F, 0xC9, 0xA4, 0x91, 0x6E, 0xA5, 0x7C, 0x5B, 0x23, 0x0A, 0xD4, 0xDF, 0xB6,
+    0xAF, 0xC3, 0x63, 0x1A, 0x33, 0xCD, 0xF9, 0x56, 0x68, 0xCC, 0x35, 0x55, 0xA1, 0x54, 0x5F, 0x68,
+    0x6A, 0xC6, 0x52, 0x7D, 0xA1, 0x71, 0xA0, 0x52, 0x5B, 0xE8, 0xE5, 0x68, 0x0B, 0xE4, 0xD5, 0x40,
+    0xBD, 0x93, 0x4B, 0x23, 0x3E, 0x92, 0x4B, 0xD0, 0xAD, 0x64, 0x8A, 0x64, 0x0A, 0xA0, 0x95, 0x52,
+    0x13, 0x0C, 0x6A, 0x1B, 0xF5, 0xE7, 0x65, 0x5B, 0x4A, 0xD2, 0x02, 0xF5, 0xF7, 0xED, 0x14, 0xF3,
+    0xFD, 0x93, 0x5A, 0x81, 0x7F, 0x00, 0xA7, 0x3B, 0x27, 0xDC, 0x0E, 0xA0, 0x72, 0xB6, 0x9D, 0x6E,
+    0x7B, 0x2E, 0x9C, 0x61, 0x23, 0xBC, 0x5A, 0xA0, 0xB2, 0xF5, 0xF5, 0x4F, 0xEF, 0xFC, 0xE5, 0x47,
+    0x4E, 0x27, 0x4E, 0xA7, 0x8F, 0x4B, 0xB3, 0xD7, 0x26, 0x6D, 0x85, 0xF4, 0x92, 0x76, 0x2A, 0xCD,
+    0x95, 0xC0, 0xCF, 0xF8, 0x05, 0x17, 0x29, 0x34, 0xE6, 0x82, 0x3A, 0xD2, 0x4D, 0xA0, 0xC9, 0xAD,
+    0x50, 0x29, 0x17, 0xD0, 0x85, 0x6E, 0x82, 0x42, 0x9F, 0x58, 0x81, 0x66, 0x97, 0x59, 0xCD, 0x11,
+    0x70, 0xE6, 0x5B, 0x77, 0x66, 0x3A, 0x53, 0xF4, 0x60, 0x61, 0x85, 0x05, 0x14, 0x43, 0x30, 0xBB,
+    0x60, 0x46, 0xC1, 0xE2, 0x8A, 0x14, 0x70, 0xCC, 0x40, 0x69, 0x76, 0xC6, 0xD6, 0x7D, 0x2D, 0xBB,
+    0x20, 0x3B, 0x9D, 0x6E, 0x1C, 0x30, 0x18, 0x66, 0x5A, 0x1A, 0xDD, 0x06, 0xE8, 0x16, 0x43, 0x3D,
+    0x6E, 0x98, 0xAD, 0x79, 0xCD, 0x6C, 0xE1, 0x08, 0x66, 0x06, 0xBB, 0xA5, 0x56, 0x4F, 0x13, 0x51,
+    0xC0, 0x89, 0x26, 0x52, 0xA8, 0x2F, 0x05, 0x9A, 0x32, 0x8D, 0x74, 0x81, 0x21, 0xD0, 0x44, 0xFC,
+    0x8A, 0x13, 0x3E, 0x52, 0xA8, 0xEF, 0x22, 0x99, 0xFE, 0x46, 0x11, 0x06, 0x69, 0x85, 0xC6, 0xDC,
+    0x54, 0xBD, 0xD5, 0x9A, 0x81, 0x3E, 0xCE, 0xA5, 0x5A, 0xEA, 0xC1, 0x49, 0xCB, 0xF9, 0xD6, 0x00,
+    0x78, 0xEF, 0x57, 0xED, 0xB4, 0x52, 0xFA, 0x54, 0xF6, 0xB5, 0xB1, 0x2B, 0x72, 0xF5, 0x3E, 0x18,
+    0xC6, 0x36, 0x8C, 0x80, 0x0D, 0x31, 0xC5, 0x6E, 0xFE, 0x5E, 0xB3, 0x98, 0x53, 0xA5, 0xB1, 0xD8,
+    0x0D, 0xC7, 0x33, 0x7F, 0x70, 0x35, 0xDF, 0x6F, 0x98, 0x5C, 0xB0, 0x1F, 0xAB, 0x05, 0x5C, 0x34,
+    0x5F, 0xCC, 0xDB, 0x91, 0x94, 0xA9, 0x57, 0x00, 0xAA, 0xCD, 0x86, 0xD2, 0x87, 0x42, 0xB3, 0xBD,
+    0x99, 0x26, 0x28, 0xCD, 0xBC, 0x51, 0xAF, 0x76, 0xFC, 0x0D, 0x13, 0x95, 0x0C, 0xDA, 0x72, 0x11,
+    0x5C, 0xFC, 0x75, 0x7C, 0x80, 0x6E, 0xDE, 0xCC, 0xFD, 0xFB, 0xB8, 0x9E, 0x8B, 0xE0, 0x62, 0x23,
+    0x8D, 0xE0, 0x43, 0x67, 0xA3, 0x3F, 0x76, 0x6A, 0xA1, 0xDC, 0x2D, 0xB8, 0x6D, 0x92, 0x45, 0xB2,
+    0x89, 0xBE, 0x51, 0xD8, 0xB4, 0xCF, 0xF6, 0xE3, 0xE6, 0xED, 0x14, 0x43, 0xDA, 0x11, 0x90, 0x25,
+    0xB4, 0x23, 0x1B, 0xCE, 0x6E, 0xCC, 0xA3, 0xED, 0x6F, 0x81, 0x5F, 0x5D, 0x4B, 0xA3, 0xCF, 0x4C,
+    0xB8, 0x1F, 0x29, 0x50, 0xCC, 0x5A, 0xE0, 0xCF, 0xDC, 0x72, 0x0F, 0x48, 0xCC, 0x26, 0xBB, 0x0E,
+    0x78, 0xBD, 0xBE, 0xD2, 0x49, 0x11, 0xBF, 0x0F, 0xC2, 0xAF, 0x85, 0xFA, 0x3A, 0x32, 0x4C, 0x2E,
+    0xE2, 0x43, 0xB9, 0xE3, 0x62, 0xA1, 0xB6, 0xDA, 0xD1, 0x58, 0xA8, 0xED, 0x42, 0xA6, 0xB1, 0x59,
+    0x51, 0x70, 0x1B, 0xC3, 0x5A, 0xA8, 0xF5, 0x3B, 0x9A, 0xFC, 0xF0, 0xC5, 0x2E, 0xFA, 0x27, 0x7F,
+    0xF2, 0xB6, 0xF4, 0x65, 0x6D, 0xD2, 0x4B, 0x8A, 0x5E, 0x63, 0x17, 0x0B, 0xF5, 0x6E, 0xE5, 0x9A,
+    0x81, 0x58, 0xD9, 0x5F, 0x60, 0x16, 0x83, 0x42, 0x3B, 0x64, 0x6B, 0x3D, 0xC2, 0xF3, 0x45, 0x00,
+    0x4F, 0x84, 0x6A, 0xFA, 0x3C, 0x64, 0xBB, 0x00, 0x2F, 0x03, 0xB5, 0x2F, 0x1B, 0xA4, 0x5C, 0xFF,
+    0x5A, 0x14, 0xDA, 0xD5, 0x97, 0x92, 0xC6, 0x42, 0x3F, 0x52, 0x28, 0xD4, 0xFB, 0x35, 0xD3, 0x58,
+    0x6D, 0x68, 0x2C, 0x44, 0x37, 0xA3, 0xD1, 0x2F, 0x0C, 0xB3, 0x8B, 0xF8, 0xA5, 0x14, 0x75, 0xCC,
+    0xD5, 0x3B, 0xA1, 0xA9, 0x52, 0xEF, 0x97, 0x42, 0xB3, 0xDB, 0x8A, 0xB7, 0xD7, 0xFF, 0x4E, 0x2F,
+    0xFF, 0xAD, 0xBA, 0x41, 0xEB, 0xA0, 0x57, 0x15, 0x1B, 0xBD, 0xAC, 0x58, 0x6A, 0xF4, 0x2B, 0xEA,
+    0xB9, 0x71, 0x0E, 0x7C, 0x32, 0xC8, 0xB4, 0x66, 0x5A, 0x70, 0xD2, 0x9F, 0x68, 0x33, 0xEB, 0x27,
+    0xF4, 0xD6, 0xA0, 0x8F, 0xA9, 0x50, 0xEF, 0x62, 0xA1, 0x52, 0xB8, 0xA5, 0xD8, 0x5D, 0xA4, 0x09,
+    0x65, 0xAC, 0x57, 0xFC, 0xE4, 0x56, 0xBF, 0x30, 0x8C, 0xDD, 0xEC, 0x03, 0x7A, 0x45, 0x7D, 0x17,
+    0x72, 0x69, 0x63, 0x98, 0x0B, 0x69, 0x42, 0x53, 0xA5, 0x0D, 0x34, 0xD5, 0x1A, 0xF9, 0x5D, 0x4D,
+    0x5E, 0x63, 0xB6, 0x2A, 0xEC, 0x9A, 0x1E, 0x5D, 0x07, 0xC5, 0x41, 0x0A, 0x9D, 0x82, 0x97, 0x26,
+    0xAF, 0xB1, 0xD1, 0x8E, 0xDB, 0x29, 0xF5, 0x1A, 0xDC, 0x30, 0x78, 0xCA, 0x42, 0xB2, 0x58, 0xF5,
+    0xD4, 0x9B, 0xC0, 0x6B, 0x01, 0xBF, 0xA7, 0x1D, 0x5C, 0x29, 0x80, 0x86, 0x19, 0x82, 0xED, 0x8A,
+    0xDE, 0xAC, 0xDA, 0xA3, 0xFF, 0x2E, 0x52, 0x49, 0x0B, 0x4A, 0x4E, 0x40, 0xAF, 0xA5, 0x51, 0x25,
+    0x7C, 0xF4, 0x81, 0xE1, 0x3F, 0xA8, 0xCF, 0xF4, 0x95, 0x48, 0xB9, 0x77, 0x81, 0xE6, 0x6F, 0xD5,
+    0xA3, 0xBF, 0xDA, 0x28, 0xE4, 0x17, 0x9A, 0x45, 0x13, 0x7A, 0x59, 0xBD, 0xDB, 0x2B, 0xB5, 0x0A,
+    0xB5, 0xA4, 0xB6, 0x91, 0x16, 0xBC, 0xC1, 0xE1, 0xD3, 0xE1, 0x65, 0x3E, 0xDA, 0x3F, 0x0C, 0x43,
+    0xF8, 0x10, 0xB9, 0xD6, 0x9D, 0x62, 0x57, 0xA4, 0x08, 0xC3, 0x4A, 0x3E, 0xFA, 0xE9, 0x9E, 0x0B,
+    0x30, 0xD3, 0x06, 0x4E, 0xEA, 0xE9, 0xA4, 0x29, 0xD3, 0x5B, 0x0A, 0x85, 0xDA, 0x6E, 0x71, 0x1B,
+    0x7E, 0xA9, 0x23, 0x7E, 0xF5, 0x0B, 0x7E, 0xF5, 0x01, 0xBF, 0x74, 0x01, 0xBF, 0x0C, 0x33, 0x3E,
+    0x68, 0xA6, 0x0B, 0x9A, 0x18, 0x66, 0xCD, 0x68, 0xD4, 0x9C, 0xAB, 0x1F, 0x42, 0x25, 0xBA, 0xAD,
+    0x8B, 0x78, 0x19, 0x18, 0xDD, 0x93, 0x6B, 0x83, 0x04, 0x1C, 0x1D, 0x58, 0x59, 0xB5, 0x27, 0x53,
+    0x59, 0x45, 0xE0, 0x03, 0xE6, 0x34, 0x5C, 0xBF, 0x75, 0xEB, 0xD6, 0xD7, 0xEE, 0xC0, 0xCA, 0x2E,
+    0xC7, 0x2B, 0x54, 0xDB, 0xF1, 0x5B, 0x1B, 0x60, 0x4E, 0xF2, 0x03, 0x3C, 0x00, 0x99, 0xB6, 0xAA,
+    0xA7, 0x90, 0x7E, 0x34, 0x53, 0x4A, 0x9A, 0x29, 0xF5, 0xAF, 0x34, 0x53, 0xA8, 0xF5, 0x81, 0x42,
+    0xAD, 0xDB, 0xC8, 0xD4, 0xD7, 0xEA, 0xD1, 0x58, 0x6B, 0xC6, 0x87, 0xE6, 0xF5, 0x85, 0x7A, 0x6D,
+    0xBE, 0xBC, 0x51, 0x6D, 0xCD, 0x33, 0xA2, 0x50, 0xD7, 0x6B, 0x44, 0x6A, 0x87, 0x19, 0xAF, 0xD6,
+    0x9B, 0x79, 0x5D, 0xC9, 0xD5, 0x37, 0x11, 0x86, 0xDB, 0x9D, 0xD9, 0xCF, 0x08, 0x2F, 0x4A, 0x2B,
+    0xBC, 0x58, 0x69, 0x81, 0x7F, 0x70, 0x40, 0x62, 0x77, 0x3C, 0x5C, 0xCB, 0x91, 0x9A, 0x39, 0xC2,
+    0xCA, 0xCA, 0x22, 0x01, 0x5D, 0x82, 0xA7, 0x2C, 0x0C, 0xE7, 0x45, 0x00, 0x8A, 0xFB, 0x04, 0xB6,
+    0xD7, 0x77, 0x9A, 0x85, 0x42, 0x6B, 0xA1, 0x91, 0x4E, 0x63, 0xBD, 0x71, 0xFD, 0xB9, 0x88, 0xEC,
+    0x08, 0x8B, 0x50, 0xED, 0x68, 0x84, 0x2E, 0xB8, 0x78, 0x36, 0xA5, 0x3E, 0xD4, 0x01, 0x72, 0xE5,
+    0x3B, 0x50, 0x07, 0x3F, 0x42, 0xA6, 0x32, 0x02, 0x2E, 0xD8, 0xE1, 0xF6, 0x99, 0x19, 0x70, 0x3F,
+    0x89, 0x00, 0x1A, 0x5A, 0xC0, 0xD9, 0xD9, 0x64, 0x86, 0xDF, 0x25, 0x4B, 0x67, 0xE7, 0xD9, 0x7A,
+    0x91, 0x84, 0x61, 0x18, 0xE1, 0x1F, 0xD0, 0x04, 0x28, 0xF6, 0xE7, 0x22, 0xE0, 0x25, 0x73, 0xD9,
+    0x7B, 0xC0, 0x5B, 0xA8, 0x31, 0x1C, 0xC8, 0xDA, 0x0D, 0x30, 0xD7, 0x87, 0x52, 0x3B, 0x86, 0xE5,
+    0xC3, 0xB5, 0xCF, 0x6C, 0xE7, 0xC4, 0x8C, 0x05, 0x18, 0x29, 0x90, 0x31, 0x3B, 0xEB, 0x43, 0x06,
+    0xF8, 0xB9, 0x0B, 0xD0, 0xBD, 0xA4, 0x08, 0xC3, 0x5F, 0x6A, 0x07, 0x3D, 0x27, 0x81, 0x86, 0x4F,
+    0x88, 0x4C, 0xB1, 0x14, 0x99, 0x42, 0x29, 0x72, 0xCD, 0xA5, 0x28, 0x34, 0x96, 0x3B, 0x66, 0x24,
+    0x4B, 0xE1, 0x36, 0xAA, 0x1D, 0x17, 0x71, 0x1B, 0xCD, 0x9A, 0x50, 0x48, 0x17, 0x19, 0x66, 0xEA,
+    0x35, 0xD7, 0x48, 0xA3, 0x3F, 0x11, 0x29, 0xAC, 0xF6, 0xD2, 0x02, 0xDD, 0xDB, 0xEA, 0x61, 0x98,
+    0x1F, 0x07, 0xEC, 0x63, 0xD8, 0x12, 0xD4, 0x68, 0xC9, 0x27, 0x30, 0x0B, 0x80, 0xC1, 0xDC, 0x5E,
+    0x6A, 0xE1, 0xB7, 0x6F, 0xDD, 0xB2, 0x4F, 0xFA, 0x34, 0xCF, 0x03, 0xF5, 0xE2, 0x67, 0xC8, 0xF5,
+    0xB1, 0x1D, 0xF0, 0x61, 0x98, 0x20, 0xDB, 0x8A, 0xE5, 0xA7, 0x85, 0xB9, 0xEF, 0xEC, 0x09, 0xAE,
+    0xCC, 0xBF, 0x39, 0x92, 0x44, 0x2E, 0x7D, 0x7B, 0xEB, 0xD6, 0x9F, 0xFE, 0xD7, 0x10, 0xDA, 0x9F,
+    0x4E, 0x2D, 0x0C, 0xB2, 0x85, 0x34, 0xE2, 0xA4, 0x19, 0x2C, 0x9A, 0xE5, 0xE7, 0x7A, 0x6E, 0x9E,
+    0x1F, 0xFF, 0x98, 0x02, 0xCB, 0xD9, 0xDA, 0x34, 0xF5, 0x2F, 0xA6, 0x59, 0x33, 0x4F, 0xD6, 0xBC,
+    0x5B, 0x86, 0x14, 0x34, 0x3F, 0x7E, 0xEF, 0x15, 0xBA, 0x70, 0x09, 0x41, 0xA7, 0x5B, 0x53, 0x28,
+    0x3C, 0xDA, 0x4F, 0x93, 0x95, 0xB3, 0x69, 0x72, 0x09, 0xF1, 0x50, 0x37, 0x03, 0xF8, 0x6F, 0xCB,
+    0x2C, 0x9D, 0xCD, 0x9A, 0x6C, 0x8D, 0x35, 0x73, 0xB3, 0x00, 0x65, 0xCC, 0x0D, 0xEC, 0xED, 0xEB,
+    0x08, 0x34, 0x21, 0xD3, 0x68, 0xB0, 0x57, 0x4C, 0x31, 0xF0, 0x04, 0xB5, 0x05, 0x13, 0x85, 0xE5,
+    0x61, 0xE9, 0x7E, 0x78, 0xEB, 0xB9, 0xE4, 0xE1, 0x75, 0x81, 0x5C, 0x2D, 0xA5, 0x5A, 0xFC, 0x0C,
+    0x7E, 0xC5, 0x36, 0xC8, 0x54, 0xE9, 0x36, 0x95, 0xF4, 0x6D, 0x69, 0xCE, 0xA4, 0xDD, 0x6B, 0xA3,
+    0x91, 0x26, 0x78, 0x1F, 0x0F, 0xC0, 0xE7, 0x29, 0xC1, 0x8F, 0xD5, 0x88, 0xDB, 0x9F, 0x9C, 0xC9,
+    0xA5, 0x00, 0x8D, 0x85, 0x73, 0x37, 0x7F, 0xEE, 0xEE, 0xD9, 0x2F, 0x23, 0xC2, 0x43, 0x6D, 0x9E,
+    0x47, 0x0A, 0xF7, 0xB3, 0x03, 0x84, 0xB1, 0x4F, 0x74, 0x60, 0xBB, 0xFE, 0x58, 0x4F, 0xB6, 0xBC,
+    0xCA, 0xCB, 0xB9, 0x82, 0x07, 0x00, 0x86, 0xA5, 0x1B, 0x91, 0x86, 0x39, 0x93, 0x14, 0xD0, 0x5B,
+    0x8A, 0x68, 0x76, 0x3B, 0x5D, 0xC8, 0xD5, 0xFA, 0x80, 0xC6, 0x7A, 0xC5, 0x07, 0xB7, 0xD1, 0xAC,
+    0x85, 0x70, 0x5B, 0xA6, 0xB1, 0x14, 0xC3, 0x5C, 0x68, 0xF4, 0x4B, 0xAE, 0xD9, 0x6D, 0x68, 0x2D,
+    0xD4, 0xEE, 0xFB, 0xAF, 0x28, 0x6C, 0xC3, 0xAB, 0xAF, 0x6B, 0x6F, 0xF4, 0x13, 0xA9, 0x52, 0x90,
+    0x32, 0x05, 0xB7, 0xD3, 0x04, 0x1E, 0x26, 0x0F, 0x40, 0x16, 0x0E, 0xD0, 0x9D, 0x17, 0xCE, 0xB7,
+    0xEB, 0xF6, 0x9B, 0x90, 0x2B, 0x5C, 0x0A, 0x15, 0x00, 0x0C, 0xED, 0xB4, 0xF0, 0xB5, 0x09, 0xE7,
+    0xE8, 0xB5, 0xB2, 0xB8, 0xC5, 0x86, 0xFD, 0x35, 0x80, 0x7F, 0x76, 0x97, 0x07, 0x36, 0xEC, 0x2D,
+    0xD4, 0xD2, 0x9A, 0x50, 0x26, 0x9B, 0x81, 0x46, 0xAF, 0xFD, 0xB7, 0x91, 0x61, 0xA3, 0x88, 0x99,
+    0x02, 0x45, 0x2C, 0x34, 0x52, 0x2C, 0x95, 0x5A, 0xCA, 0xD9, 0x82, 0xCD, 0x66, 0x03, 0xF0, 0xF1,
+    0xE2, 0xD9, 0x36, 0xE6, 0x70, 0xBF, 0xE7, 0x78, 0x3C, 0x67, 0x7D, 0x27, 0x28, 0x47, 0xAF, 0x11,
+    0x3F, 0x36, 0xBA, 0xFD, 0x69, 0x8D, 0x4E, 0x92, 0xDA, 0xD2, 0xA6, 0xDF, 0xB6, 0x5A, 0x6D, 0x78,
+    0xCE, 0x23, 0x97, 0x1C, 0x93, 0x6F, 0xA4, 0xC9, 0x2C, 0xF6, 0x44, 0x18, 0xA8, 0xD7, 0xF4, 0x4D,
+    0xD7, 0x27, 0x62, 0xC8, 0x3F, 0xB9, 0x73, 0x07, 0x3D, 0xAA, 0x9E, 0x4A, 0x3B, 0x85, 0x14, 0x90,
+    0x76, 0xFC, 0x5A, 0x8D, 0xD5, 0xCE, 0xC3, 0x68, 0xB4, 0xB5, 0x54, 0x58, 0x08, 0x9E, 0x1C, 0xC3,
+    0x61, 0x06, 0x97, 0x3C, 0xC4, 0x87, 0x9C, 0x70, 0xED, 0xB0, 0x3E, 0xBA, 0x96, 0x92, 0xF0, 0xD2,
+    0x94, 0x59, 0x7A, 0x6E, 0x39, 0xA3, 0xAA, 0xFC, 0x1E, 0xA4, 0x9B, 0xC0, 0x5D, 0x9C, 0x51, 0x99,
+    0x9E, 0x0C, 0x50, 0x6E, 0xD5, 0x0A, 0xCD, 0x92, 0xAF, 0xE0, 0x7A, 0x9E, 0x7D, 0x07, 0x0F, 0xFE,
+    0x00, 0x34, 0x11, 0x83, 0x5A, 0x24, 0xF0, 0xAF, 0x2C, 0xB8, 0xE0, 0xC7, 0x7C, 0xCB, 0x22, 0xBE,
+    0xAD, 0xFA, 0xAB, 0x67, 0x4E, 0x36, 0xAC, 0x30, 0x68, 0xC6, 0x4B, 0x38, 0x69, 0x2E, 0xD4, 0x3F,
+    0xCF, 0x30, 0x67, 0xAD, 0x8B, 0xC9, 0x98, 0xFB, 0x00, 0xA5, 0xD2, 0x98, 0x9F, 0xBD, 0x72, 0xB7,
+    0x93, 0xA1, 0xC0, 0x52, 0xE9, 0x0B, 0x43, 0xDF, 0x49, 0xA1, 0x90, 0x36, 0x6A, 0xA9, 0xA5, 0x53,
+    0x0B, 0x8F, 0xA4, 0xD1, 0xFB, 0x2A, 0x1C, 0xE9, 0x93, 0x2B, 0xAE, 0xDC, 0x0A, 0x70, 0x1F, 0x6C,
+    0xFF, 0x9D, 0x32, 0xE4, 0xF9, 0x4D, 0x4B, 0xFE, 0x78, 0xB3, 0x75, 0x74, 0xF3, 0xD9, 0x60, 0x5D,
+    0x5E, 0xDD, 0xD9, 0xB0, 0x52, 0x69, 0xC7, 0x4B, 0x48, 0x7B, 0xA1, 0xFE, 0xF9, 0x6A, 0xE7, 0x61,
+    0x17, 0x6D, 0x65, 0xFB, 0x60, 0x0B, 0x7B, 0x98, 0xED, 0x7F, 0xD9, 0xFF, 0x0F, 0x29, 0xB0, 0x0C,
+    0xEB, 0xA3, 0x6B, 0x67, 0xA4, 0x89, 0xA9, 0x96, 0xDA, 0x52, 0x4B, 0x1A, 0xDA, 0xBC, 0xE5, 0x5F,
+    0x40, 0x11, 0x18, 0x46, 0x50, 0x4A, 0xA3, 0xA9, 0x87, 0xC2, 0x40, 0x71, 0x33, 0x28, 0x09, 0x7F,
+    0xEA, 0xDA, 0xBB, 0xC1, 0xD3, 0xD7, 0x0E, 0xF0, 0xD4, 0x86, 0x38, 0x97, 0xA4, 0x36, 0xD7, 0xFE,
+    0x91, 0x6E, 0xCC, 0xB5, 0xE0, 0x82, 0x8D, 0x31, 0x0A, 0xB0, 0x31, 0x2C, 0xF0, 0x74, 0x1A, 0x52,
+    0x1B, 0x64, 0x1B, 0xF0, 0x22, 0x39, 0xBE, 0xF3, 0xC5, 0x98, 0x36, 0xBB, 0x79, 0x0F, 0xFD, 0x19,
+    0xDF, 0x4A, 0xC3, 0xDC, 0x08, 0xF8, 0x6C, 0xA9, 0x00, 0x4F, 0x21, 0x81, 0xB0, 0x71, 0x2E, 0x0C,
+    0xD3, 0xEF, 0x24, 0x4D, 0x07, 0x96, 0x95, 0x06, 0xDA, 0xF2, 0xD5, 0x59, 0x9B, 0xCD, 0x78, 0x9A,
+    0x91, 0x3D, 0xDF, 0xC8, 0x63, 0x33, 0x51, 0xEC, 0x7B, 0xF2, 0x56, 0x9D, 0x0E, 0x83, 0xFA, 0x81,
+    0xAB, 0x9F, 0xB1, 0x4D, 0xEB, 0xBB, 0x31, 0x00, 0x3A, 0xE0, 0xA5, 0xBE, 0x50, 0xFF, 0x3C, 0xCD,
+    0xCA, 0x0D, 0x3B, 0xCA, 0xB6, 0x94, 0x2A, 0xCD, 0x74, 0xC4, 0x9C, 0xCD, 0x9A, 0x96, 0x78, 0xA1,
+    0x9E, 0xD6, 0x09, 0xD7, 0x36, 0xFB, 0xF5, 0x9D, 0xCE, 0x4C, 0x93, 0xDA, 0x4C, 0x5A, 0x2C, 0x20,
+    0x3E, 0x16, 0xF9, 0x7B, 0xC8, 0x6F, 0x02, 0x4D, 0x5F, 0x44, 0xA0, 0x5A, 0x52, 0xF6, 0xF2, 0x63,
+    0xB6, 0xDE, 0xDF, 0x8E, 0x57, 0x5C, 0x20, 0x3B, 0xB9, 0x8A, 0xF5, 0x1E, 0x59, 0xDC, 0x41, 0xAF,
+    0x19, 0x6A, 0xA6, 0xD7, 0xCE, 0xF8, 0x6D, 0x6D, 0x00, 0xFA, 0xF5, 0x4F, 0xE9, 0x23, 0x83, 0x7A,
+    0x72, 0x8D, 0x85, 0x16, 0x18, 0x0C, 0xCD, 0xF5, 0x2B, 0xA5, 0x46, 0xDC, 0x06, 0x5A, 0xEC, 0xDC,
+    0xDD, 0xC9, 0x0D, 0xD0, 0x47, 0x81, 0x4C, 0x33, 0x7E, 0x85, 0x6E, 0xC5, 0x6D, 0x50, 0xEF, 0x94,
+    0x82, 0x4A, 0x6D, 0x7E, 0x00, 0xFA, 0x01, 0x14, 0x8E, 0x6B, 0xEA, 0x0D, 0x7C, 0xBC, 0xFC, 0x3E,
+    0xB5, 0x40, 0x33, 0x8D, 0xFD, 0xAD, 0x4E, 0x2D, 0x8D, 0xA5, 0x5D, 0x12, 0x7E, 0x6B, 0x77, 0x87,
+    0xB7, 0x5C, 0xC4, 0x15, 0xC0, 0x95, 0x1B, 0x66, 0xD8, 0x37, 0x40, 0xFA, 0xE6, 0x0E, 0x48, 0x2F,
+    0x6D, 0xC0, 0x27, 0xF5, 0x72, 0x04, 0x32, 0x3D, 0xB3, 0x00, 0xB9, 0x3E, 0x66, 0x00, 0x5F, 0x65,
+    0x69, 0x9D, 0x6A, 0x84, 0x07, 0xCA, 0x3D, 0x6F, 0xC9, 0xF5, 0xDD, 0xCD, 0xE2, 0x85, 0x68, 0x8B,
+    0x35, 0x02, 0x7A, 0xCB, 0x90, 0xF9, 0xDE, 0x2F, 0x50, 0x1A, 0x58, 0x68, 0x91, 0x1B, 0xF5, 0x6A,
+    0x4E, 0xDE, 0xC2, 0x30, 0x1D, 0xDC, 0x11, 0x3A, 0xF3, 0x18, 0x87, 0xB9, 0xD0, 0x88, 0x79, 0xC9,
+    0xA0, 0xC9, 0xD9, 0x17, 0x3F, 0x7C, 0xB1, 0x45, 0x61, 0x1B, 0x5E, 0x1D, 0x19, 0xB4, 0x0E, 0x1A,
+    0xE9, 0x14, 0x06, 0x81, 0xD7, 0xD8, 0x45, 0x70, 0xBB, 0x05, 0xE2, 0x77, 0xF8, 0xCC, 0xBF, 0x54,
+    0x39, 0x18, 0x5B, 0xC7, 0x8F, 0x9A, 0x9F, 0xAD, 0xF1, 0xFC, 0xFC, 0xC9, 0xB4, 0xB9, 0x7B, 0xB8,
+    0xFE, 0x75, 0xFD, 0x7B, 0xA8, 0xA4, 0x08, 0x0F, 0x3E, 0xA7, 0xAF, 0x1D, 0xCE, 0xD7, 0xBF, 0xFC,
+    0xD8, 0x06, 0xA5, 0x14, 0x0F, 0xB4, 0x77, 0x90, 0x56, 0x72, 0x4D, 0xDD, 0x92, 0x90, 0x5C, 0xB7,
+    0xE1, 0x03, 0x75, 0x4C, 0x18, 0xFB, 0x30, 0xA5, 0x89, 0xB1, 0x79, 0xB1, 0x69, 0x19, 0xE6, 0x4A,
+    0x7D, 0x9A, 0x14, 0x9B, 0x13, 0x9B, 0x12, 0x9B, 0x11, 0x9B, 0x10, 0x9B, 0x8F, 0x34, 0x1D, 0xC7,
+    0x6C, 0x0C, 0x96, 0x2A, 0xBA, 0x8C, 0x9F, 0x3F, 0x78, 0xEB, 0xD6, 0xCD, 0x7B, 0x9E, 0x2A, 0x8F,
+    0x9C, 0x4E, 0xA7, 0xC7, 0x2D, 0x45, 0x33, 0x23, 0x49, 0x9B, 0xE5, 0x4A, 0x26, 0x4A, 0xB5, 0x9F,
+    0x8A, 0xB6, 0xA7, 0x46, 0x9C, 0x28, 0x56, 0xD0, 0x8C, 0x6F, 0x71, 0x1B, 0x59, 0x9F, 0xE2, 0x7A,
+    0x9A, 0x78, 0x19, 0xDF, 0x97, 0xE2, 0x19, 0x78, 0xEF, 0xA4, 0x05, 0x2A, 0x9D, 0x4E, 0xE7, 0x70,
+    0xD9, 0xED, 0x16, 0xE2, 0x4C, 0xE9, 0x37, 0xB3, 0x85, 0x5C, 0x23, 0xBE, 0xC7, 0xAF, 0x54, 0x0B,
+    0x85, 0x5A, 0x04, 0xC3, 0x5B, 0xB7, 0x14, 0x32, 0x5B, 0x3F, 0x5E, 0x92, 0xA6, 0x42, 0x06, 0xE3,
+    0x67, 0xA7, 0x13, 0xA4, 0x33, 0x75, 0xCA, 0xA5, 0xC8, 0xB5, 0xD3, 0xE9, 0x8E, 0x90, 0x31, 0xD3,
+    0xE5, 0xE3, 0x7B, 0xF5, 0xA1, 0xD8, 0x32, 0x31, 0xF4, 0x4D, 0x70, 0xA1, 0xD8, 0xF2, 0x1D, 0x8D,
+    0x7E, 0xF2, 0xA1, 0x8C, 0x4D, 0x64, 0x78, 0x7D, 0x33, 0x64, 0x45, 0x1B, 0xB8, 0x48, 0xDE, 0x6A,
+    0x24, 0x56, 0x3B, 0xC3, 0xD8, 0x49, 0xCB, 0x71, 0x7C, 0xA7, 0x93, 0xE3, 0xE1, 0xCB, 0x7F, 0x29,
+    0x1F, 0xF9, 0x5D, 0xE0, 0x45, 0x1C, 0xE0, 0xD6, 0x6A, 0x06, 0x06, 0x45, 0xCE, 0x87, 0x8D, 0x19,
+    0xFB, 0xBB, 0x71, 0xAE, 0xEC, 0x74, 0x3A, 0x9D, 0x0E, 0x5B, 0xE1, 0x6C, 0xB0, 0x6D, 0x4D, 0xD2,
+    0x2D, 0xD7, 0xBA, 0x91, 0x2A, 0xF1, 0x61, 0x03, 0xBE, 0xC7, 0xED, 0x14, 0x0B, 0x68, 0xE2, 0x3D,
+    0x87, 0x9B, 0x90, 0xA7, 0xC1, 0x4E, 0x23, 0x6F, 0xA8, 0xBC, 0x14, 0x2D, 0x71, 0xD4, 0xC2, 0xF0,
+    0xE6, 0xE9, 0xC6, 0x31, 0xD8, 0x77, 0x64, 0x56, 0x46, 0xEA, 0x96, 0x26, 0x52, 0xAC, 0xB6, 0x2D,
+    0x5A, 0xFC, 0x82, 0x0B, 0x54, 0xBA, 0xF5, 0x9C, 0xCC, 0xAE, 0xCE, 0x85, 0xAD, 0x03, 0x2F, 0x7B,
+    0xEB, 0xAC, 0x05, 0x22, 0xEF, 0xA6, 0x9E, 0xCA, 0x29, 0xD3, 0xBF, 0x8A, 0x38, 0x73, 0x68, 0xA6,
+    0x4B, 0x68, 0xC6, 0x7F, 0xB9, 0xC1, 0xB7, 0xF3, 0xCC, 0x92, 0xD5, 0xF9, 0xE5, 0xB4, 0x52, 0x42,
+    0x61, 0xEA, 0x89, 0x5F, 0x86, 0x95, 0x4E, 0x7E, 0xD3, 0x5C, 0xC4, 0x42, 0xAD, 0xBD, 0x4F, 0x37,
+    0xDF, 0xCB, 0x37, 0x6C, 0xA1, 0x56, 0x4F, 0xA3, 0x15, 0x2F, 0xE1, 0x67, 0x8D, 0x7E, 0xAA, 0x43,
+    0x33, 0x57, 0xD1, 0x85, 0x62, 0xAB, 0xD6, 0x42, 0xC5, 0x56, 0x28, 0x53, 0x25, 0x86, 0xD7, 0x37,
+    0x1A, 0xAD, 0x38, 0x4D, 0x14, 0x82, 0x9B, 0x1A, 0x89, 0xCD, 0x9A, 0xAB, 0x94, 0xD4, 0x4A, 0x6A,
+    0x6B, 0xC9, 0xA6, 0x23, 0x6B, 0xDF, 0x81, 0x2B, 0x35, 0x05, 0x52, 0x24, 0xD8, 0xD0, 0xDE, 0xB5,
+    0xB6, 0xE0, 0x78, 0x4B, 0xD1, 0xFF, 0x25, 0x24, 0x2F, 0xD7, 0xD5, 0x78, 0xAB, 0xDB, 0x6D, 0xE9,
+    0x4A, 0x11, 0x3D, 0x23, 0xD4, 0x76, 0xE3, 0xD0, 0x37, 0xC1, 0x8F, 0x6E, 0x69, 0x66, 0x17, 0xDD,
+    0xE2, 0x62, 0x19, 0x9B, 0x98, 0x6B, 0x58, 0xD2, 0x1A, 0x6F, 0x71, 0x91, 0xFC, 0x31, 0x51, 0x84,
+    0x61, 0xAE, 0x62, 0x6D, 0x39, 0xD4, 0x8D, 0x4E, 0x1B, 0x85, 0x22, 0x5C, 0x8B, 0xC0, 0x53, 0xC0,
+    0xD3, 0x09, 0x7A, 0x77, 0x13, 0x14, 0x7A, 0xD6, 0xDC, 0xBF, 0xEA, 0xC2, 0xE1, 0xF9, 0x2C, 0xD7,
+    0x5B, 0xA8, 0xC7, 0x62, 0x83, 0x6C, 0xCF, 0xD4, 0x82, 0x33, 0x22, 0x46, 0xF7, 0x7A, 0xB8, 0x70,
+    0x95, 0x2A, 0xBB, 0xE7, 0x66, 0x7C, 0xC7, 0x1B, 0x95, 0xBF, 0xAF, 0xF3, 0xAA, 0x2B, 0xCE, 0xEB,
+    0xAC, 0xB1, 0xD8, 0x32, 0xD1, 0xCC, 0x55, 0x44, 0xF8, 0xA9, 0x5A, 0x0B, 0xE1, 0x27, 0x1F, 0x32,
+    0x55, 0xA2, 0xDA, 0x35, 0xD1, 0x68, 0xB5, 0x45, 0x5D, 0x08, 0x6E, 0xBA, 0x88, 0x1B, 0x9B, 0x35,
+    0x97, 0x6D, 0xDB, 0xE4, 0xBC, 0x06, 0xBB, 0xE2, 0x6C, 0x65, 0xFE, 0xB9, 0xAD, 0x1D, 0xA3, 0xF9,
+    0xA7, 0x13, 0xDF, 0x32, 0xAF, 0xAF, 0xAE, 0x40, 0x13, 0xFC, 0x08, 0x2E, 0xB2, 0x01, 0x2F, 0xDC,
+    0x9D, 0x82, 0xC8, 0x06, 0xDD, 0x34, 0x30, 0x28, 0x18, 0x24, 0xD4, 0xD3, 0xC9, 0x2A, 0x4C, 0xA6,
+    0x6B, 0x6A, 0x2B, 0x4D, 0x29, 0x96, 0x40, 0xF8, 0x08, 0x6E, 0xAE, 0xD4, 0xC2, 0x8A, 0x81, 0xC0,
+    0x16, 0x4C, 0x14, 0x97, 0xA7, 0x24, 0xC1, 0x58, 0xC3, 0xCA, 0x83, 0xB7, 0x6E, 0x7D, 0x59, 0x3D,
+    0x52, 0x1C, 0x56, 0x6A, 0xE9, 0xCB, 0xEA, 0xF9, 0x7D, 0xCD, 0x43, 0x84, 0x3A, 0x96, 0x1A, 0xC9,
+    0xD5, 0xFB, 0x1D, 0x9A, 0xB5, 0xD0, 0x4A, 0xA1, 0xB6, 0xD6, 0x82, 0x0F, 0x18, 0x63, 0x26, 0x57,
+    0x4A, 0xF4, 0x48, 0x2B, 0x94, 0xD2, 0x6B, 0x70, 0x27, 0xAD, 0xA0, 0x5C, 0x2F, 0xA5, 0x72, 0x7D,
+    0x82, 0xA7, 0x17, 0x20, 0xDF, 0x7C, 0x0F, 0x74, 0x5F, 0x88, 0x40, 0x3D, 0xBB, 0x09, 0xF2, 0x95,
+    0xA7, 0xEE, 0xB2, 0xB5, 0x0F, 0x01, 0x5C, 0xD7, 0x7E, 0xEB, 0x26, 0x85, 0x99, 0x33, 0xBD, 0x2D,
+    0x8D, 0xF8, 0xD5, 0xC5, 0x1B, 0x94, 0x3B, 0xDD, 0x08, 0x1A, 0x4B, 0xB3, 0xFB, 0x83, 0x95, 0xB1,
+    0x44, 0x70, 0x31, 0x53, 0x0F, 0xC3, 0xD8, 0x05, 0x28, 0x34, 0x44, 0xA0, 0x36, 0x02, 0x51, 0x0A,
+    0xA0, 0xB6, 0x0B, 0xC8, 0x82, 0x2E, 0xCD, 0x8E, 0xE1, 0xA5, 0x7A, 0xCD, 0x5C, 0x9F, 0x00, 0xDD,
+    0xED, 0x41, 0x13, 0xCD, 0xCA, 0xA0, 0xB6, 0xD8, 0x61, 0x58, 0x19, 0x26, 0x72, 0xF5, 0xD5, 0x06,
+    0xCD, 0x42, 0xB7, 0x50, 0x89, 0x42, 0xB7, 0x7F, 0x5F, 0x23, 0xB5, 0xC5, 0xB0, 0xDE, 0x72, 0xD3,
+    0xFF, 0xBD, 0x8D, 0xC7, 0xF1, 0xA8, 0x60, 0x84, 0x7C, 0xE5, 0x83, 0x80, 0x9F, 0x9B, 0x91, 0x04,
+    0x7B, 0x1E, 0x70, 0xAD, 0xDD, 0xD6, 0x11, 0xF3, 0xBC, 0xF3, 0x57, 0xC0, 0xC3, 0x64, 0x40, 0x35,
+    0xF2, 0x67, 0xC0, 0x4E, 0x03, 0xB8, 0xED, 0x49, 0x2B, 0x7B, 0x58, 0x49, 0xA9, 0x6F, 0xB8, 0xBE,
+    0xF3, 0x4B, 0x39, 0xE9, 0x7F, 0xCE, 0xA5, 0x24, 0xE3, 0x65, 0x66, 0x4A, 0xE2, 0xBF, 0x75, 0xED,
+    0x7D, 0x79, 0x57, 0xB7, 0x8D, 0x09, 0x22, 0x7B, 0x5E, 0x8D, 0xC4, 0xD3, 0xE7, 0xDA, 0xF8, 0xCC,
+    0xC2, 0xB0, 0x81, 0xA8, 0x05, 0x2E, 0x14, 0x1A, 0x61, 0x67, 0x58, 0xC0, 0xF5, 0x06, 0x18, 0x24,
+    0x7E, 0xA3, 0xBF, 0xEC, 0x61, 0x18, 0x46, 0x53, 0xA9, 0xE7, 0xD6, 0xAD, 0xAF, 0x0D, 0x2B, 0x4E,
+    0xFA, 0x4B, 0xF5, 0x99, 0xB4, 0x0E, 0x2B, 0xD7, 0x87, 0xBD, 0xD2, 0x48, 0x66, 0xE1, 0x58, 0xB3,
+    0x16, 0x9A, 0xC9, 0xD5, 0x7B, 0xF5, 0xF8, 0x25, 0x93, 0xDA, 0x42, 0xE6, 0xDD, 0x04, 0x9A, 0x8B,
+    0x30, 0xAC, 0x87, 0xEE, 0x32, 0x82, 0x00, 0xFC, 0xDA, 0x15, 0x6F, 0xAA, 0xBF, 0xDB, 0x9B, 0x1A,
+    0xEF, 0x97, 0x89, 0xFA, 0xA5, 0xD9, 0xE3, 0xEF, 0xD4, 0xA9, 0x03, 0xA8, 0xE7, 0x4B, 0xF9, 0xA5,
+    0x44, 0x94, 0xD1, 0xA5, 0x57, 0x52, 0x8A, 0x20, 0x39, 0x0D, 0xED, 0xA5, 0x73, 0x14, 0x78, 0xFE,
+    0xA2, 0x3C, 0x32, 0x39, 0x4E, 0x47, 0xDE, 0xBD, 0xBF, 0x74, 0x0A, 0x18, 0xCF, 0xBE, 0xBA, 0x9C,
+    0x91, 0x37, 0xFC, 0xF2, 0x72, 0xAE, 0x87, 0x27, 0xF5, 0xC3, 0x3F, 0x35, 0xC4, 0x63, 0xC4, 0x69,
+    0x50, 0xA4, 0x50, 0xAF, 0xFF, 0x1B, 0xBA, 0xB9, 0x8C, 0xE0, 0x12, 0x75, 0x6C, 0xAC, 0x36, 0x70,
+    0x2B, 0x1A, 0xB1, 0xA4, 0x03, 0x55, 0x2C, 0x05, 0xF8, 0xB7, 0x35, 0x92, 0x6A, 0x25, 0xCF, 0x00,
+    0xD9, 0x74, 0xB1, 0x19, 0x4B, 0xFB, 0x08, 0x07, 0x9B, 0x6C, 0xB7, 0x22, 0x3B, 0x41, 0xA9, 0x3F,
+    0xD6, 0x46, 0xAE, 0xBE, 0xD2, 0x82, 0x9F, 0xA9, 0xD2, 0x0A, 0x48, 0xCB, 0xA1, 0x2D, 0xD5, 0x1A,
+    0x2E, 0xF4, 0x7F, 0x0E, 0xD1, 0x0C, 0xB1, 0xB9, 0x37, 0x3D, 0xE4, 0xC3, 0x39, 0xE4, 0xFF, 0xB5,
+    0x63, 0x3C, 0x97, 0x83, 0xCD, 0x6D, 0x51, 0x44, 0x76, 0x70, 0x4C, 0xBB, 0x57, 0x53, 0xFA, 0x68,
+    0x69, 0x0E, 0x52, 0xC2, 0x9E, 0xB2, 0xD7, 0x45, 0x7F, 0x2F, 0xB4, 0xF6, 0x74, 0xBA, 0x71, 0xED,
+    0x74, 0xBA, 0x81, 0xA4, 0x2C, 0xF9, 0x64, 0x73, 0x23, 0x8D, 0x0C, 0x32, 0xE7, 0xF1, 0xC0, 0x2A,
+    0x0C, 0xC9, 0xD8, 0xB1, 0x6F, 0x34, 0x99, 0xFB, 0x53, 0x27, 0xCE, 0x46, 0xAE, 0x91, 0x03, 0x81,
+    0xC2, 0xF0, 0xA9, 0xDE, 0xBE, 0xE9, 0x96, 0x83, 0xEE, 0x4B, 0xC2, 0xC5, 0x42, 0x62, 0x0E, 0x0A,
+    0x18, 0xDE, 0x3C, 0x7D, 0xF2, 0x70, 0xA5, 0x7E, 0xCA, 0x7B, 0x8D, 0x16, 0xD6, 0xF8, 0x95, 0x84,
+    0xB6, 0xB4, 0xF6, 0xCD, 0x10, 0x6C, 0xFD, 0x1A, 0x29, 0x52, 0x63, 0x23, 0xF5, 0x85, 0x14, 0x4B,
+    0x59, 0x9C, 0x31, 0x0E, 0xD2, 0x79, 0x35, 0xD9, 0xAA, 0x19, 0xC2, 0x91, 0x5D, 0xAB, 0xB4, 0x41,
+    0xAE, 0x3A, 0xC0, 0xD0, 0x77, 0x2D, 0xF5, 0x94, 0x2F, 0x70, 0xC3, 0x72, 0x51, 0x67, 0x72, 0x43,
+    0xA5, 0x09, 0x0A, 0x09, 0xE8, 0x14, 0x20, 0xFB, 0xCC, 0xCE, 0xC1, 0x1F, 0x70, 0xF1, 0x4C, 0x1C,
+    0x68, 0x16, 0x33, 0x46, 0x0F, 0x80, 0x0F, 0xF5, 0x4A, 0xB9, 0x3B, 0xCD, 0x74, 0xDF, 0x96, 0xA8,
+    0xA2, 0x14, 0xD0, 0xF0, 0x8C, 0x70, 0x9A, 0x7C, 0xC8, 0xB4, 0x96, 0x3B, 0x8D, 0x18, 0xA6, 0x42,
+    0x93, 0x8B, 0xF8, 0x88, 0xC6, 0x52, 0x6D, 0xBD, 0x32, 0x84, 0x42, 0x54, 0x3B, 0x3E, 0xA0, 0xA9,
+    0xDC, 0xCD, 0x24, 0x7D, 0x41, 0x63, 0xB5, 0x3D, 0xDD, 0xAC, 0x48, 0xDF, 0x57, 0xEB, 0x14, 0x7D,
+    0x40, 0x2A, 0xF7, 0x84, 0x10, 0x5F, 0xFB, 0xFB, 0xCD, 0xE3, 0x23, 0x7A, 0xF3, 0xF4, 0x49, 0xFD,
+    0xA0, 0xAD, 0x24, 0x8B, 0xE5, 0xEC, 0xAB, 0xC6, 0x9F, 0x35, 0x8F, 0xED, 0xCF, 0x6F, 0x1E, 0xEF,
+    0x9A, 0x90, 0xF9, 0xCA, 0x84, 0x3C, 0xF8, 0xDC, 0xFE, 0x35, 0x8C, 0xEF, 0xFD, 0xDE, 0x61, 0xFF,
+    0xDA, 0x71, 0x3A, 0xF8, 0x70, 0xFD, 0x35, 0xCA, 0xBD, 0xD4, 0xC4, 0xF0, 0x2D, 0x09, 0x67, 0x13,
+    0xF2, 0xDC, 0x8F, 0x84, 0x53, 0xE8, 0x42, 0xA6, 0xF8, 0x53, 0x26, 0x24, 0x57, 0xEB, 0xAE, 0x4C,
+    0x48, 0xF7, 0x77, 0x99, 0x10, 0x9A, 0xF6, 0xB7, 0x40, 0xF3, 0xE7, 0x29, 0xF4, 0xD6, 0x66, 0x7C,
+    0xCB, 0x72, 0xD6, 0x42, 0x3E, 0xDE, 0x15, 0x14, 0x19, 0x5D, 0xD4, 0x25, 0x4A, 0x55, 0xA0, 0xD4,
+    0x31, 0x2E, 0x46, 0x17, 0x1D, 0x42, 0xDA, 0x75, 0x68, 0x4E, 0xC1, 0x7A, 0x4A, 0xED, 0x8E, 0xC9,
+    0x96, 0x17, 0xEA, 0x53, 0xBE, 0xA0, 0xD2, 0x01, 0xEF, 0xDB, 0xD3, 0x7E, 0xC4, 0x3F, 0x4D, 0x3C,
+    0xCC, 0xBF, 0xBD, 0xB1, 0xB1, 0x8D, 0x27, 0x7C, 0x7A, 0x1A, 0xE1, 0x5F, 0xF2, 0xD9, 0x4A, 0xC5,
+    0xDC, 0xED, 0xCD, 0xCB, 0xBB, 0x36, 0xF7, 0x92, 0xC2, 0x6F, 0xE4, 0x77, 0x39, 0x50, 0x4F, 0x46,
+    0xAB, 0x12, 0xD3, 0x98, 0x7D, 0x5D, 0x76, 0x24, 0x77, 0x33, 0xF9, 0x91, 0xB2, 0x9F, 0xC9, 0x2D,
+    0xDA, 0xC4, 0x07, 0x32, 0xF5, 0x54, 0x1B, 0xF8, 0xF0, 0x10, 0x7A, 0x65, 0x2C, 0x25, 0x6A, 0xAD,
+    0x78, 0xF5, 0x0C, 0x73, 0x0A, 0x62, 0x32, 0x29, 0xDA, 0xF0, 0x14, 0x52, 0x24, 0xBF, 0x75, 0xEB,
+    0xAB, 0xBF, 0xA0, 0xC3, 0x73, 0x3A, 0xB5, 0x4E, 0x9A, 0x06, 0x2B, 0x1E, 0xCD, 0x4E, 0xA7, 0xCB,
+    0x4E, 0xD6, 0x75, 0x8D, 0x48, 0x94, 0x8A, 0xBC, 0x77, 0x08, 0xA0, 0x9E, 0x72, 0xB7, 0xE8, 0x50,
+    0xA3, 0xFD, 0x73, 0x01, 0x8D, 0x14, 0xB2, 0xA4, 0xEA, 0x30, 0x51, 0x28, 0xC3, 0xC5, 0xA7, 0xE8,
+    0x14, 0x32, 0xA9, 0x2F, 0xB4, 0x52, 0xED, 0x09, 0xD3, 0x38, 0x4A, 0xC6, 0x7E, 0xD5, 0xBC, 0xFA,
+    0x62, 0xCF, 0x23, 0xB9, 0xB4, 0x24, 0x2A, 0x40, 0xB3, 0x5F, 0x54, 0x9D, 0xFC, 0x62, 0x8D, 0x52,
+    0x0B, 0xAE, 0x67, 0x1A, 0xDA, 0xFA, 0xA3, 0xFA, 0xE3, 0x58, 0x48, 0x63, 0xA9, 0x48, 0x7E, 0x15,
+    0xB5, 0xFE, 0xCF, 0xBE, 0x88, 0x4E, 0xA7, 0x1B, 0xF6, 0xF7, 0x25, 0x91, 0x49, 0x93, 0xDD, 0x61,
+    0xA6, 0x29, 0x7D, 0x1A, 0x1F, 0xD3, 0x27, 0x2F, 0xD5, 0x26, 0x2C, 0x61, 0x08, 0xE9, 0x83, 0xBB,
+    0x83, 0xD6, 0x99, 0x6B, 0x4C, 0x1F, 0xF9, 0xEA, 0xE5, 0x4D, 0x4C, 0x63, 0x57, 0xA8, 0xB7, 0x0A,
+    0xFA, 0x4A, 0x9A, 0x90, 0xD4, 0x26, 0x22, 0x75, 0xDD, 0x27, 0x38, 0xC7, 0xF7, 0x89, 0x52, 0x5B,
+    0xAD, 0x40, 0x6D, 0x1C, 0x8B, 0x0B, 0x96, 0x07, 0xE4, 0x2B, 0x6E, 0xA3, 0xD9, 0xF0, 0x1B, 0x3E,
+    0xA6, 0xD0, 0xFD, 0x58, 0x42, 0x5E, 0x63, 0xA7, 0xF1, 0x09, 0x8D, 0xA8, 0xCF, 0xD4, 0xE7, 0xA2,
+    0x10, 0xE5, 0x4E, 0xB5, 0xE1, 0x22, 0x2E, 0x52, 0xAF, 0x34, 0x0B, 0x3E, 0x3C, 0xE4, 0xDF, 0x08,
+    0x9D, 0x42, 0xA7, 0xA9, 0x53, 0xDB, 0x44, 0xCA, 0x19, 0x37, 0xD2, 0x80, 0x87, 0x0E, 0xBA, 0x1F,
+    0xE2, 0xF7, 0xC4, 0xFA, 0x02, 0x3E, 0x77, 0x9C, 0x55, 0xDD, 0xF9, 0x23, 0x6F, 0xF7, 0x84, 0x20,
+    0xAF, 0x25, 0x70, 0x26, 0xD9, 0x2B, 0xA9, 0xBD, 0xFF, 0x28, 0x6C, 0xE9, 0xFD, 0x2E, 0x0D, 0xDA,
+    0x3D, 0x46, 0xFC, 0xCA, 0xE5, 0x77, 0x8C, 0xB8, 0x71, 0xD5, 0xDB, 0x42, 0xDA, 0xCE, 0xBC, 0xB2,
+    0x47, 0x55, 0x28, 0xD6, 0x0A, 0x4F, 0x68, 0x2C, 0x76, 0xEA, 0xD5, 0x6A, 0x89, 0xEB, 0xD5, 0x8A,
+    0x86, 0x5D, 0xA4, 0x9B, 0x73, 0xB5, 0x2E, 0x3E, 0xE0, 0xDF, 0x78, 0x43, 0x7A, 0x45, 0xBB, 0xD3,
+    0xDC, 0xAC, 0x97, 0xCF, 0xC0, 0x16, 0x49, 0xF9, 0xF1, 0x9E, 0x5E, 0x1A, 0xE9, 0xB4, 0x58, 0x25,
+    0x87, 0x5F, 0xED, 0x96, 0x4A, 0xB5, 0x76, 0x0F, 0x43, 0xB0, 0x3B, 0x76, 0x4A, 0x8B, 0xE2, 0xCE,
+    0x73, 0x2B, 0x3B, 0xCE, 0xC0, 0xE6, 0x7C, 0x06, 0x8E, 0xE9, 0xF3, 0xDD, 0xE3, 0xBD, 0xB8, 0x7A,
+    0x06, 0x86, 0x34, 0x38, 0xFB, 0xF1, 0x5E, 0xD3, 0xDD, 0xEF, 0x55, 0x1E, 0xEF, 0x35, 0x04, 0x8B,
+    0x9D, 0x9D, 0x8E, 0xE5, 0x35, 0x61, 0xD8, 0x72, 0x34, 0xF6, 0x59, 0x71, 0x10, 0x66, 0xBD, 0xAD,
+    0xA5, 0xFE, 0x00, 0xD9, 0x3E, 0x6A, 0x5E, 0x60, 0x79, 0x54, 0x2E, 0x0D, 0xC9, 0x1B, 0x2C, 0x13,
+    0x7F, 0x9D, 0x26, 0xB9, 0x89, 0xFC, 0x5A, 0x7B, 0xAC, 0x41, 0x5E, 0x30, 0x6C, 0x77, 0xCC, 0x35,
+    0x31, 0x2C, 0x68, 0xC1, 0x47, 0x7C, 0xC4, 0xED, 0x94, 0xD1, 0xEA, 0x4A, 0xB9, 0xE4, 0x0A, 0x19,
+    0x56, 0x10, 0x78, 0x72, 0x2D, 0x14, 0x33, 0x29, 0x93, 0x18, 0x34, 0x3E, 0xA1, 0xF1, 0xBD, 0x43,
+    0xC0, 0xCF, 0xD4, 0x91, 0x7A, 0xA5, 0xDC, 0xA9, 0x22, 0xB9, 0xDA, 0x42, 0x98, 0xEC, 0x09, 0x3E,
+    0xA4, 0xBA, 0x29, 0x1F, 0x12, 0x63, 0xB3, 0x50, 0x5B, 0xEE, 0x56, 0x4A, 0x90, 0x8A, 0xC8, 0xDB,
+    0x7A, 0xC5, 0xBF, 0x11, 0xAA, 0x8D, 0x5A, 0xB1, 0x50, 0x5B, 0x6A, 0x47, 0x23, 0xDA, 0xE9, 0x66,
+    0x9A, 0x95, 0x66, 0x81, 0x1B, 0x29, 0xB8, 0xBD, 0x24, 0x06, 0xF2, 0xC1, 0x4C, 0x23, 0xF8, 0x7F,
+    0x63, 0x2B, 0x30, 0xF9, 0x05, 0x96, 0xE0, 0x98, 0x80, 0xEB, 0x67, 0xA3, 0x73, 0xBD, 0xBF, 0x04,
+    0xA4, 0x1E, 0x09, 0xED, 0x19, 0x70, 0x9B, 0xA9, 0x65, 0x94, 0x11, 0x32, 0xF5, 0xF5, 0x08, 0xD5,
+    0xC4, 0x1F, 0xDC, 0xB9, 0x2F, 0x4E, 0xA7, 0xC7, 0x2D, 0xB9, 0x3B, 0x9D, 0x4B, 0x27, 0x52, 0x2C,
+    0x78, 0x1F, 0xA0, 0xF1, 0x52, 0xA8, 0xD5, 0x5F, 0x94, 0x7D, 0xA4, 0xE8, 0xE0, 0xA7, 0x54, 0x94,
+    0xDC, 0xFD, 0x9B, 0x7F, 0xD7, 0x5A, 0x94, 0x3B, 0x0B, 0x57, 0xDE, 0x65, 0x7B, 0x6F, 0x69, 0x36,
+    0x4B, 0xBF, 0xF6, 0x50, 0x1D, 0x83, 0x63, 0x08, 0xC9, 0x0A, 0x70, 0xED, 0x0F, 0xEF, 0xF8, 0xA8,
+    0x16, 0x47, 0xA5, 0x2A, 0x3D, 0xE3, 0x38, 0x2D, 0x40, 0xF3, 0xFD, 0x78, 0x20, 0x6A, 0xD9, 0xCE,
+    0x76, 0x1F, 0x40, 0xCD, 0x58, 0x5C, 0x40, 0xA5, 0x08, 0x38, 0x45, 0xE0, 0xC1, 0xE7, 0xD6, 0x0B,
+    0x9E, 0x9B, 0xAD, 0x5D, 0x1F, 0x2E, 0x9E, 0x2D, 0x74, 0xB6, 0x12, 0x8B, 0x4B, 0xAC, 0xDC, 0xEC,
+    0x22, 0x7F, 0x99, 0x02, 0xC7, 0x42, 0x17, 0x01, 0x7F, 0x79, 0x29, 0x04, 0x77, 0x97, 0x08, 0x2A,
+    0xCD, 0xF9, 0xED, 0x7F, 0x93, 0x61, 0x06, 0xFF, 0xDD, 0x94, 0xF8, 0x00, 0x3A, 0x6D, 0x80, 0x57,
+    0x00, 0x4A, 0x5B, 0x1A, 0xD9, 0xE9, 0x74, 0xE3, 0x11, 0x3B, 0x3A, 0x5E, 0x32, 0x8B, 0xBE, 0x3B,
+    0x83, 0x9E, 0x6E, 0x56, 0xC9, 0x67, 0xF6, 0x2B, 0x96, 0xB8, 0xEF, 0xC1, 0xC9, 0x46, 0xD8, 0xAF,
+    0x85, 0x5A, 0x40, 0x93, 0x5F, 0x80, 0x52, 0x36, 0xB1, 0x4D, 0xB4, 0xCF, 0xA2, 0x9F, 0xA4, 0x3B,
+    0x4D, 0x98, 0x4C, 0xDA, 0x8E, 0x9D, 0xD2, 0xCA, 0x4D, 0x04, 0xDD, 0xBD, 0x33, 0xAA, 0xCB, 0x32,
+    0xAC, 0x96, 0x83, 0x91, 0x8D, 0x9C, 0x51, 0xCB, 0x9A, 0x98, 0xA7, 0xD3, 0xBA, 0x30, 0x42, 0x43,
+    0x5B, 0x6A, 0x86, 0xC6, 0x34, 0x1C, 0x6A, 0x69, 0x74, 0x5A, 0x91, 0x84, 0x53, 0x28, 0xA4, 0x95,
+    0x2A, 0x85, 0x3A, 0xD9, 0xE5, 0xA3, 0x36, 0x4F, 0xE4, 0xBB, 0xE3, 0x2C, 0xF0, 0x29, 0x33, 0xA3,
+    0xAB, 0xDC, 0xBC, 0x54, 0x50, 0x9C, 0xD2, 0x0F, 0xB8, 0xFE, 0x22, 0x00, 0x1A, 0xB6, 0xE4, 0x6E,
+    0x97, 0xDA, 0x21, 0xFB, 0xCC, 0x76, 0x0C, 0xB6, 0x8B, 0xC7, 0xFB, 0x36, 0x47, 0xD1, 0x3A, 0x7E,
+    0x6E, 0x02, 0xFE, 0x5B, 0x8A, 0x74, 0x7F, 0xA9, 0xC8, 0xF0, 0xDC, 0x5F, 0x6F, 0xE8, 0x85, 0x62,
+    0x43, 0xA1, 0x88, 0x99, 0xA6, 0x72, 0xCD, 0xD5, 0xBB, 0x50, 0x88, 0x6E, 0x2A, 0xF6, 0x52, 0x94,
+    0xD2, 0x42, 0x25, 0xB5, 0x54, 0xBB, 0xC0, 0x45, 0x8D, 0xB8, 0xD8, 0xCD, 0xD4, 0x6B, 0x13, 0x69,
+    0x16, 0xA7, 0x3F, 0xF4, 0xA1, 0x54, 0xF4, 0x21, 0x53, 0xEC, 0x66, 0x5B, 0x2D, 0xD9, 0xF1, 0xE1,
+    0x96, 0x23, 0xE4, 0xBF, 0x10, 0x08, 0x28, 0x96, 0x83, 0x9B, 0xD4, 0xF4, 0x97, 0xF8, 0x78, 0x0F,
+    0x5D, 0x57, 0x5F, 0x6C, 0x9D, 0xC6, 0x7A, 0x1F, 0x34, 0x76, 0xFB, 0x13, 0xFA, 0x82, 0x36, 0xF4,
+    0xA5, 0xFD, 0xF9, 0x4C, 0x9F, 0x08, 0x64, 0xF2, 0x3D, 0xB9, 0x5E, 0xC4, 0xD2, 0x21, 0x85, 0xB6,
+    0xF4, 0x79, 0xAB, 0x4D, 0xE0, 0xE2, 0xD0, 0xE2, 0x62, 0x37, 0x52, 0xAF, 0x7E, 0xFE, 0xD5, 0x66,
+    0x69, 0xD6, 0xA7, 0x7D, 0xA8, 0xB5, 0xF9, 0xE0, 0x14, 0x7D, 0x28, 0x14, 0xBA, 0xC9, 0x86, 0xF4,
+    0xE1, 0x73, 0xAD, 0x3A, 0xE5, 0x74, 0x1E, 0xE8, 0x46, 0x60, 0x9C, 0x36, 0x23, 0x58, 0xD9, 0xDE,
+    0xBE, 0xDE, 0xDE, 0xA3, 0xCE, 0x2D, 0xD9, 0x17, 0x97, 0x4A, 0x23, 0xB7, 0xF3, 0xE6, 0xB7, 0xBC,
+    0x9E, 0x15, 0xB5, 0x5A, 0xE5, 0xDA, 0x7E, 0xB6, 0x2C, 0x79, 0x2A, 0x65, 0xBB, 0xB0, 0x01, 0x9A,
+    0xEE, 0xFD, 0x8B, 0x7D, 0x32, 0x19, 0x33, 0x43, 0xA0, 0x9A, 0x2D, 0xD9, 0xE7, 0x44, 0xBE, 0xE1,
+    0x57, 0x5C, 0xC8, 0xF5, 0xC3, 0xAF, 0xEB, 0x9B, 0x92, 0xB4, 0x39, 0xC9, 0x0E, 0xD0, 0xE3, 0x18,
+    0xE1, 0x29, 0xE8, 0x26, 0xBA, 0x9D, 0x46, 0x53, 0xAD, 0xD7, 0x32, 0xDD, 0x3C, 0x17, 0x96, 0x3F,
+    0x4C, 0xAE, 0x05, 0xA9, 0xAF, 0xB5, 0xF2, 0x29, 0xB3, 0xEB, 0x85, 0xA0, 0x9B, 0xA9, 0x36, 0x92,
+    0x10, 0x48, 0xA6, 0x91, 0x66, 0xA5, 0xB8, 0xEF, 0xCB, 0xFD, 0xA5, 0x97, 0x4B, 0x3D, 0x40, 0xF7,
+    0x1F, 0x42, 0x25, 0x31, 0x68, 0xAA, 0x64, 0x5B, 0xF1, 0xC6, 0xB9, 0xBA, 0xCE, 0xA7, 0xB2, 0xB9,
+    0x1D, 0x72, 0xA3, 0xC7, 0xDE, 0x3D, 0x14, 0xF1, 0x6C, 0x27, 0xEF, 0x33, 0x14, 0x6E, 0xBB, 0xFF,
+    0x18, 0x66, 0x9A, 0x78, 0x37, 0x95, 0xE0, 0xC5, 0x94, 0x35, 0x52, 0xA0, 0x99, 0x0A, 0xF5, 0x88,
+    0x66, 0xBF, 0x35, 0xC4, 0x5A, 0x92, 0x26, 0x49, 0x52, 0xE2, 0x69, 0x5C, 0xB5, 0x84, 0x17, 0x56,
+    0xCB, 0x70, 0x29, 0x73, 0xF6, 0x86, 0xF6, 0x8C, 0x5A, 0x75, 0xFD, 0x45, 0x1A, 0xF0, 0x61, 0x2A,
+    0x4D, 0x4E, 0x6B, 0xA9, 0x9D, 0x4F, 0xA9, 0x45, 0x23, 0x3E, 0x50, 0xAF, 0x54, 0x1B, 0x76, 0x9A,
+    0xD2, 0x05, 0x9A, 0x15, 0x77, 0xF1, 0xFD, 0x4C, 0x93, 0x2A, 0x1F, 0xC9, 0xCC, 0x1F, 0xB6, 0x4A,
+    0xC8, 0x52, 0x0F, 0x64, 0xFA, 0xCB, 0x71, 0x50, 0x68, 0xB4, 0x54, 0x5A, 0xD0, 0x9C, 0x48, 0x17,
+    0x45, 0xA0, 0xD8, 0x61, 0xE8, 0xA9, 0x27, 0xAA, 0x40, 0xB1, 0x50, 0x2C, 0xE4, 0xF3, 0x65, 0xB4,
+    0x34, 0xA1, 0xA9, 0x55, 0xE0, 0xDA, 0xE9, 0xF4, 0x58, 0xC4, 0x49, 0x61, 0xA7, 0x90, 0xD6, 0x0E,
+    0x06, 0x2D, 0x4D, 0x4F, 0xA6, 0xC9, 0x8D, 0x30, 0x84, 0x62, 0x06, 0x1F, 0xF9, 0xEC, 0x05, 0xA7,
+    0xAC, 0xBF, 0x48, 0x28, 0xDB, 0x71, 0xE5, 0xE3, 0xC5, 0x41, 0x69, 0x76, 0xF3, 0xBE, 0x2F, 0x97,
+    0x6A, 0xF9, 0xA7, 0xE4, 0x1A, 0x69, 0x7A, 0x86, 0x80, 0x9B, 0xF1, 0x91, 0x6A, 0xC1, 0xED, 0x14,
+    0x31, 0x25, 0xEA, 0x3A, 0x49, 0x6A, 0x2D, 0x43, 0x97, 0xF2, 0xE4, 0x64, 0xED, 0x03, 0x34, 0xFA,
+    0xE8, 0xEA, 0xB4, 0xFA, 0x6F, 0x4A, 0xCF, 0xC4, 0x6B, 0xDD, 0xD2, 0xB5, 0x85, 0xAA, 0x80, 0x0F,
+    0x1B, 0xE5, 0xEE, 0x46, 0x86, 0x69, 0xC1, 0xC5, 0xEB, 0x76, 0xBE, 0xD4, 0x31, 0x01, 0xC9, 0xFE,
+    0xE0, 0xA7, 0xFA, 0x90, 0x8E, 0x95, 0x61, 0x4A, 0xB6, 0x2D, 0x15, 0x1F, 0xDE, 0x71, 0x5D, 0x17,
+    0x5A, 0x4A, 0x35, 0x30, 0x28, 0xA4, 0xCA, 0x5F, 0xB5, 0xF6, 0xB9, 0xAF, 0x5D, 0x04, 0x62, 0xC9,
+    0xA1, 0xB5, 0x6D, 0x5C, 0x19, 0x7A, 0x61, 0x4E, 0x80, 0x7D, 0x6A, 0x5D, 0x7E, 0x9E, 0x6D, 0x4C,
+    0xB2, 0x48, 0x9E, 0x8A, 0x5C, 0x46, 0xB7, 0x53, 0xA8, 0x77, 0x1B, 0x85, 0x5A, 0xB7, 0x52, 0xAA,
+    0xCD, 0x6F, 0x26, 0xA8, 0xDF, 0x06, 0xDA, 0x06, 0xCC, 0xB6, 0x72, 0x13, 0xC9, 0xD7, 0xB4, 0x46,
+    0x6D, 0xBC, 0xFC, 0x8A, 0x0B, 0x96, 0xB6, 0xB7, 0x45, 0x6A, 0xC3, 0x75, 0xD4, 0x15, 0xB7, 0x66,
+    0xD6, 0x2D, 0xDB, 0x33, 0x73, 0xAD, 0x5B, 0x48, 0xDC, 0xFA, 0x74, 0xE4, 0x26, 0x0E, 0x16, 0x2E,
+    0x9A, 0xD7, 0x92, 0x1B, 0xE3, 0xAA, 0x69, 0x7D, 0xF0, 0xC1, 0xC5, 0x3A, 0x96, 0x7B, 0xA5, 0x5C,
+    0x1F, 0x11, 0x1A, 0x3F, 0x70, 0xF0, 0xB7, 0xA8, 0xF6, 0x34, 0xC3, 0xC6, 0xDD, 0x6A, 0xA9, 0xE3,
+    0xF3, 0x54, 0x76, 0xA0, 0xB6, 0x0C, 0x87, 0xA3, 0x7C, 0x83, 0xBF, 0xF7, 0x26, 0xFE, 0x78, 0x7B,
+    0x94, 0xEF, 0xA6, 0x32, 0xD6, 0x0D, 0xA8, 0xD5, 0x26, 0xEB, 0x9A, 0x25, 0xFA, 0xA1, 0x80, 0x0F,
+    0xFF, 0x27, 0x6C, 0xE2, 0x87, 0x61, 0xD8, 0x70, 0x5A, 0xE9, 0x34, 0xF3, 0xA9, 0x7B, 0x05, 0xA3,
+    0x89, 0x2C, 0xFF, 0x7E, 0x1A, 0x05, 0xA4, 0xBE, 0xD0, 0x4C, 0xBD, 0x91, 0x6B, 0x66, 0x50, 0x5B,
+    0x2A, 0xF2, 0xEE, 0xE3, 0xFA, 0xDD, 0x56, 0x8F, 0x46, 0x4A, 0x3D, 0x40, 0x1D, 0x9F, 0x67, 0x50,
+    0xC8, 0xA5, 0xB6, 0xD2, 0x82, 0xDB, 0xB9, 0xC4, 0x4E, 0x3B, 0x30, 0xDA, 0xCF, 0x73, 0xF5, 0xB8,
+    0x6E, 0x12, 0xBE, 0x5B, 0x27, 0x4F, 0xBE, 0x4C, 0x75, 0x1D, 0xC9, 0x09, 0xBC, 0xC7, 0x59, 0x72,
+    0x80, 0x02, 0x37, 0xC8, 0x2C, 0x26, 0x1A, 0xE9, 0x14, 0x71, 0x8A, 0x54, 0xC7, 0xBC, 0x37, 0xBA,
+    0x69, 0xAA, 0x32, 0x7E, 0x86, 0x52, 0xAB, 0xC9, 0xD6, 0x0C, 0x1A, 0xE9, 0x46, 0x4B, 0x1D, 0x56,
+    0x56, 0xC0, 0x1C, 0x18, 0x7A, 0xA8, 0xA5, 0xD6, 0x2D, 0x90, 0xAB, 0x5B, 0xAD, 0x48, 0xE9, 0xFB,
+    0x1A, 0xEB, 0x00, 0xC5, 0x56, 0xEF, 0xB9, 0x00, 0x3F, 0x2A, 0x34, 0x33, 0x94, 0xB1, 0xD4, 0x33,
+    0x9B, 0x69, 0x13, 0x45, 0x3F, 0x82, 0x5B, 0x73, 0x7D, 0xD7, 0xF4, 0x7B, 0x9C, 0x86, 0x11, 0xEA,
+    0x60, 0x7E, 0x68, 0xAE, 0xC4, 0x43, 0x6A, 0x66, 0x73, 0xCD, 0x8A, 0x3D, 0xA1, 0xD9, 0x7E, 0xB2,
+    0x2C, 0x7B, 0xB9, 0x19, 0x9E, 0x6E, 0x14, 0xF3, 0xC9, 0x12, 0x9B, 0x4D, 0x04, 0xAF, 0xFD, 0x48,
+    0xFE, 0x72, 0x95, 0xE0, 0xF7, 0xEE, 0x0B, 0xD7, 0x66, 0x18, 0x0F, 0x4F, 0xC5, 0x0C, 0x71, 0x37,
+    0x99, 0xBC, 0x0F, 0x60, 0xD1, 0x04, 0x77, 0x33, 0x55, 0x9E, 0x5C, 0x73, 0xF5, 0x9D, 0xBE, 0xA9,
+    0xAD, 0x52, 0xEC, 0x14, 0x9E, 0xD0, 0xAB, 0x12, 0x4E, 0x4B, 0x17, 0xD0, 0x56, 0xEE, 0xD4, 0x6A,
+    0x87, 0x29, 0xD7, 0x7C, 0x40, 0x85, 0x85, 0xFA, 0x7A, 0xB5, 0x2A, 0x85, 0x4A, 0x06, 0x15, 0x1E,
+    0xC1, 0x6A, 0xA6, 0xB1, 0xDA, 0xDE, 0xD5, 0xAC, 0xE8, 0xBB, 0xDF, 0x56, 0xEF, 0xB4, 0xF9, 0x05,
+    0xE9, 0x65, 0x43, 0x1E, 0xA7, 0x64, 0x12, 0x6E, 0xFC, 0xD7, 0x3A, 0x51, 0xE7, 0xEC, 0xCD, 0xC5,
+    0xEB, 0xE5, 0x51, 0x97, 0xDE, 0x8D, 0x87, 0xCE, 0xC7, 0x71, 0xC5, 0x95, 0x08, 0x05, 0xAA, 0xE9,
+    0xE7, 0x3C, 0x67, 0x69, 0x4B, 0xF6, 0x67, 0x09, 0x32, 0x3F, 0x9D, 0x3D, 0x6E, 0xDF, 0x1F, 0xF2,
+    0x3D, 0x96, 0x76, 0xF8, 0x9D, 0x23, 0x12, 0x4D, 0xE5, 0x0C, 0x59, 0x4C, 0x49, 0xAA, 0x7A, 0x3E,
+    0xF2, 0x61, 0x5F, 0x32, 0xE7, 0xBB, 0xD8, 0xCF, 0x7B, 0x3D, 0x8D, 0xC0, 0x10, 0xAE, 0xFA, 0xF2,
+    0xFF, 0x75, 0xEF, 0xF1, 0xCF, 0xF2, 0x8F, 0xA0, 0xEE, 0xEB, 0x99, 0x2C, 0x96, 0x2B, 0xB8, 0x59,
+    0x80, 0xBA, 0x11, 0x4A, 0x05, 0xC0, 0x1F, 0xFA, 0x53, 0x47, 0xC1, 0x0E, 0x57, 0x0A, 0x8D, 0xAE,
+    0xAB, 0x6F, 0xD6, 0x52, 0xB1, 0xD6, 0x34, 0xE8, 0x15, 0xE9, 0xFA, 0x73, 0x9B, 0xB1, 0xC3, 0x3F,
+    0x26, 0x9C, 0xA6, 0x6E, 0xCE, 0xB4, 0x54, 0x1B, 0x8D, 0xD5, 0x7A, 0x8D, 0x2E, 0xE2, 0xD7, 0x4C,
+    0x7D, 0x29, 0x9A, 0xC5, 0xF2, 0x33, 0xC6, 0x8A, 0xD5, 0x58, 0xEE, 0xD4, 0x91, 0x61, 0xFA, 0xA2,
+    0x7A, 0xB7, 0x7D, 0xDE, 0xAF, 0x48, 0xDF, 0xBE, 0x94, 0x0E, 0xD8, 0x2E, 0xA5, 0x03, 0x1E, 0xBE,
+    0xB2, 0xA6, 0xFD, 0x95, 0x0A, 0xA8, 0xEC, 0x28, 0xBB, 0xB3, 0x17, 0x53, 0xD9, 0x51, 0x5A, 0x15,
+    0xD5, 0x0A, 0x64, 0x94, 0xF1, 0xBA, 0xFA, 0x66, 0x2D, 0x62, 0xAD, 0xE0, 0xD5, 0x46, 0x5B, 0xE4,
+    0x64, 0x5F, 0x57, 0x52, 0x39, 0xD0, 0x97, 0x2C, 0xBF, 0xF6, 0x11, 0xF5, 0xD8, 0x5A, 0x87, 0x4A,
+    0xA3, 0x37, 0xC4, 0xCD, 0xDC, 0x99, 0xB9, 0xDC, 0xC1, 0x96, 0x3C, 0x34, 0x91, 0x04, 0x04, 0xDA,
+    0x35, 0xD4, 0x2B, 0xD8, 0xCA, 0x37, 0xC2, 0xF5, 0x67, 0x5A, 0xFC, 0x8A, 0x34, 0xE1, 0x36, 0xBC,
+    0x02, 0x85, 0x70, 0x0A, 0x64, 0x6A, 0x93, 0xFF, 0x96, 0x50, 0xB7, 0x5F, 0xF6, 0xD5, 0x97, 0xCC,
+    0x4D, 0x9A, 0x90, 0xF7, 0x99, 0xB2, 0x05, 0xD5, 0x94, 0xCE, 0x66, 0xBD, 0x1E, 0xD3, 0x76, 0xD5,
+    0x91, 0x8B, 0x4D, 0xD5, 0x70, 0xC7, 0xD9, 0x7C, 0x91, 0x0A, 0x6F, 0xAF, 0xAB, 0x6F, 0xD6, 0x4E,
+    0xDF, 0xD4, 0x36, 0xE8, 0x15, 0xC9, 0xAC, 0x94, 0xF4, 0x31, 0xA1, 0xAD, 0xDC, 0x33, 0x2D, 0xD5,
+    0x96, 0x6B, 0xAE, 0xB6, 0x42, 0xA3, 0x8B, 0x85, 0x7A, 0x17, 0x4B, 0x51, 0xAF, 0x95, 0x68, 0x16,
+    0xB7, 0xE1, 0x83, 0x8B, 0xF8, 0x50, 0x47, 0x86, 0xB9, 0x59, 0xD1, 0xE4, 0x57, 0x34, 0xFA, 0x25,
+    0xD3, 0xE8, 0x43, 0xAE, 0xBE, 0x9B, 0x0A, 0x1D, 0x47, 0x5D, 0x75, 0x04, 0xEA, 0xCF, 0xD6, 0x2B,
+    0xF9, 0xDA, 0x05, 0x8A, 0x54, 0xA2, 0x71, 0x14, 0xED, 0x77, 0x29, 0x65, 0xAD, 0x60, 0xA0, 0x61,
+    0x7B, 0x66, 0x63, 0xDF, 0xBF, 0xBA, 0xF7, 0x9D, 0x28, 0xDC, 0x63, 0x65, 0xBC, 0x57, 0x12, 0x4D,
+    0xEB, 0x5D, 0x55, 0xBC, 0xFF, 0x65, 0x95, 0x12, 0xD2, 0xE3, 0x77, 0xC8, 0x2D, 0xD0, 0xFA, 0x33,
+    0x60, 0xE8, 0x3B, 0x12, 0xF4, 0x7B, 0x2E, 0xDC, 0x35, 0xAC, 0xF2, 0x1E, 0x65, 0xBB, 0xD9, 0x70,
+    0xDB, 0xE6, 0xCE, 0x3C, 0x67, 0x45, 0x2B, 0x64, 0x98, 0xE9, 0xF4, 0x47, 0x83, 0x5A, 0xA7, 0x11,
+    0xC5, 0x42, 0x81, 0x52, 0x53, 0x17, 0xC1, 0xEF, 0x4E, 0x2D, 0xB9, 0xDE, 0xB0, 0x62, 0x58, 0xBF,
+    0xDB, 0x74, 0x8C, 0xD0, 0xA8, 0x8B, 0x90, 0xEB, 0x6D, 0x8D, 0xD0, 0xA4, 0x19, 0xB0, 0xE9, 0xD8,
+    0x8C, 0x79, 0xF5, 0x57, 0xEA, 0x61, 0x58, 0x87, 0x15, 0x9C, 0x2A, 0x8D, 0xE4, 0x9A, 0xBB, 0x0D,
+    0xBA, 0x58, 0x28, 0x50, 0xAB, 0x6D, 0x34, 0x3D, 0x9A, 0xD8, 0xCA, 0x56, 0xAA, 0x60, 0xC3, 0xB8,
+    0x03, 0x8F, 0x1A, 0xE8, 0x95, 0x3D, 0x9E, 0x70, 0x91, 0x07, 0xC8, 0x16, 0x7E, 0x9D, 0x3C, 0xF2,
+    0x3C, 0x85, 0xFE, 0x78, 0xC5, 0x48, 0x8D, 0x83, 0x46, 0x78, 0xF4, 0x36, 0x3F, 0xF7, 0x19, 0x81,
+    0x99, 0x7F, 0x02, 0x94, 0x4B, 0x66, 0xF0, 0x56, 0xB5, 0x01, 0xC3, 0xEA, 0x37, 0x28, 0xF4, 0xAF,
+    0xB5, 0x40, 0xBD, 0x57, 0x66, 0x4E, 0xDC, 0x02, 0xFC, 0x06, 0x55, 0x7B, 0x9F, 0xD9, 0x49, 0xDB,
+    0x24, 0x4D, 0x8F, 0x3B, 0x58, 0x32, 0x7F, 0x34, 0xA8, 0x4D, 0x1B, 0x25, 0x4D, 0x50, 0xDA, 0x29,
+    0x36, 0x43, 0xC1, 0xB6, 0x4A, 0xB0, 0x29, 0x0A, 0xB6, 0x57, 0x82, 0xCD, 0x51, 0xB0, 0xCD, 0x32,
+    0xDB, 0x24, 0xA5, 0x2F, 0x93, 0xCD, 0xD2, 0x68, 0xDB, 0xA5, 0xB7, 0x69, 0xC2, 0xF6, 0x0B, 0x36,
+    0x4F, 0xD8, 0x86, 0x21, 0x4D, 0x54, 0xDA, 0x31, 0x69, 0xA6, 0xD2, 0x96, 0x39, 0xA6, 0xEA, 0xA2,
+    0x24, 0xF1, 0x01, 0xE0, 0x43, 0x04, 0x28, 0x17, 0x3F, 0x82, 0x3E, 0x1E, 0xC1, 0xCF, 0x6A, 0xA9,
+    0x56, 0x3F, 0x91, 0xED, 0xD5, 0x02, 0xBE, 0xDF, 0x20, 0x9F, 0xDC, 0x3D, 0x58, 0x57, 0x59, 0x7A,
+    0xF3, 0x15, 0x3A, 0x69, 0xA2, 0xD6, 0x73, 0xA2, 0x50, 0xDB, 0x2D, 0x68, 0x2A, 0xD4, 0xD6, 0xD1,
+    0x80, 0xD4, 0x42, 0xBD, 0x0F, 0x56, 0x0F, 0x5F, 0x98, 0x3E, 0x47, 0x70, 0x3B, 0xA5, 0xD0, 0xC4,
+    0x30, 0xBB, 0x1D, 0x17, 0xD1, 0x9C, 0xAB, 0xAF, 0xC4, 0x10, 0x6C, 0x0E, 0x4D, 0x3E, 0xD2, 0x99,
+    0x78, 0xA2, 0xA6, 0x2B, 0xB3, 0x68, 0xDB, 0xDA, 0x8D, 0x97, 0xCE, 0x56, 0x73, 0x09, 0xAA, 0x14,
+    0x6E, 0x1B, 0xD4, 0x60, 0x08, 0xF0, 0xBB, 0xEF, 0x35, 0x79, 0x7A, 0xD6, 0x66, 0x2D, 0x15, 0x47,
+    0x6D, 0x64, 0xD2, 0xDF, 0x28, 0x72, 0xFD, 0x63, 0x42, 0x0B, 0x34, 0xD1, 0x18, 0x91, 0xC1, 0xCA,
+    0x7A, 0xFA, 0x4A, 0x76, 0x90, 0x5A, 0xCD, 0xBA, 0xA5, 0x90, 0x12, 0xCD, 0xA2, 0x5B, 0xC0, 0xAF,
+    0x55, 0x52, 0xCD, 0x5A, 0x8E, 0x2D, 0x4B, 0x93, 0x6A, 0x75, 0xDE, 0x36, 0x38, 0xF0, 0xE3, 0x02,
+    0xEA, 0xE8, 0x2C, 0x4B, 0xD6, 0x18, 0x61, 0xC2, 0x5B, 0x09, 0xD3, 0xB0, 0x82, 0x5F, 0xB0, 0xD2,
+    0x9C, 0x4C, 0x31, 0x93, 0x62, 0xAE, 0xCD, 0x49, 0x21, 0xD7, 0xEE, 0xA5, 0x3E, 0x95, 0xF0, 0x5D,
+    0x2A, 0xFC, 0xF8, 0x46, 0x42, 0x71, 0xFE, 0xAE, 0x75, 0xBC, 0xC0, 0x93, 0x6B, 0x19, 0x3B, 0x7D,
+    0x53, 0x7F, 0xAD, 0xE8, 0xB7, 0x27, 0xF4, 0x57, 0x1A, 0xDD, 0x5B, 0x8A, 0x68, 0xF8, 0x48, 0xEB,
+    0x34, 0x9A, 0xE2, 0x66, 0xA3, 0x04, 0x3E, 0xFA, 0x35, 0x41, 0x6A, 0x43, 0x38, 0x58, 0x41, 0xD3,
+    0x65, 0x50, 0x65, 0x4D, 0x40, 0x80, 0xBF, 0xE2, 0x80, 0x3D, 0xA9, 0x7F, 0x6F, 0x27, 0xCD, 0x6E,
+    0xDB, 0x41, 0x2D, 0x9D, 0x6E, 0x0F, 0x22, 0xFB, 0x3F, 0x34, 0xFA, 0x0D, 0x2A, 0xD1, 0x45, 0xF0,
+    0x56, 0xB9, 0xA8, 0xD9, 0x58, 0x23, 0x6D, 0xCA, 0xCE, 0x59, 0x96, 0x2C, 0xB1, 0x52, 0xEA, 0x0D,
+    0xDC, 0x9E, 0xA7, 0x22, 0xF6, 0x54, 0xD2, 0xDE, 0x9F, 0xF5, 0x2A, 0xFC, 0xAE, 0x09, 0xD0, 0xB7,
+    0x34, 0x42, 0xA9, 0xC2, 0x5C, 0x9E, 0x4A, 0xC0, 0x10, 0x9C, 0xA0, 0x50, 0xDF, 0xEC, 0x36, 0x6D,
+    0x3B, 0x0C, 0x0B, 0x9D, 0xE8, 0x24, 0x06, 0x3D, 0x66, 0xEA, 0xFA, 0x5F, 0x91, 0xE6, 0x43, 0x0A,
+    0xE1, 0x52, 0xD0, 0x92, 0x90, 0xF2, 0xA3, 0x96, 0xFD, 0x72, 0xCC, 0x62, 0x2F, 0xA5, 0xD4, 0x99,
+    0x11, 0xDB, 0xAC, 0xB2, 0xFC, 0x62, 0x80, 0x4B, 0xC5, 0x7A, 0xAB, 0x14, 0xFD, 0x76, 0xFD, 0xB9,
+    0xA8, 0x88, 0x7B, 0x4B, 0x11, 0xF7, 0xF6, 0xF2, 0xB0, 0xA9, 0x2D, 0xD4, 0x6A, 0x53, 0xAC, 0x7F,
+    0x29, 0xC9, 0x7E, 0x91, 0xBD, 0x9F, 0xD3, 0x38, 0xA7, 0xC4, 0x7D, 0x9F, 0xE0, 0xB6, 0x42, 0xED,
+    0x99, 0x88, 0xC8, 0x65, 0x68, 0xDC, 0xC5, 0xE3, 0xE6, 0x8A, 0xF5, 0x08, 0x47, 0xDC, 0x74, 0x44,
+    0x27, 0x9F, 0x4B, 0xCB, 0xBD, 0xE7, 0xFD, 0x80, 0x6F, 0xCB, 0x08, 0x98, 0xFE, 0x7C, 0xA6, 0xCA,
+    0xC4, 0xBF, 0xD4, 0x5F, 0xA4, 0x8A, 0x52, 0x42, 0xEA, 0x1E, 0xD5, 0x8F, 0xEF, 0xE8, 0x1D, 0x93,
+    0xDF, 0x4D, 0xF1, 0x2F, 0xDF, 0xDA, 0x12, 0xC5, 0xBF, 0xBE, 0x1F, 0xC5, 0x1F, 0xAE, 0xAB, 0xEF,
+    0xBE, 0x29, 0x95, 0xFA, 0xB8, 0xA2, 0xDF, 0xDE, 0x3B, 0xFC, 0x58, 0x01, 0x3D, 0xA7, 0xB1, 0xD8,
+    0xB7, 0x6B, 0x36, 0x9B, 0xDD, 0x96, 0xA4, 0x04, 0xEE, 0x95, 0x1D, 0x5F, 0xD3, 0x5C, 0x96, 0xBA,
+    0x5A, 0xB7, 0xDA, 0x1E, 0x34, 0x57, 0x0B, 0x16, 0x49, 0x5A, 0x05, 0x6A, 0x8F, 0xD4, 0x5A, 0x27,
+    0xA0, 0x39, 0xCF, 0x3B, 0xFF, 0xE8, 0x8E, 0xFB, 0xAA, 0xF4, 0x5A, 0x52, 0xF6, 0x2F, 0x95, 0x58,
+    0x0A, 0x11, 0xBF, 0xD1, 0x8D, 0x85, 0x28, 0x22, 0x5D, 0xC0, 0xF7, 0x95, 0x28, 0x02, 0xC3, 0xC2,
+    0xFB, 0x8D, 0x4F, 0x45, 0x77, 0x51, 0x7E, 0xEC, 0xB4, 0x03, 0x5E, 0x87, 0x63, 0x9E, 0x74, 0xD0,
+    0x72, 0x45, 0xDE, 0x43, 0xA5, 0xA9, 0x9A, 0x68, 0x76, 0x36, 0x32, 0x4D, 0xF5, 0x4C, 0xBD, 0xE5,
+    0x22, 0xD7, 0xE8, 0x57, 0xBA, 0xB5, 0xD0, 0x5B, 0x83, 0x12, 0xBD, 0x52, 0xE9, 0x60, 0x7F, 0xED,
+    0x8E, 0x23, 0xB6, 0x6A, 0x13, 0x41, 0xB9, 0xD8, 0x53, 0xEA, 0x28, 0x53, 0x7F, 0xF0, 0x13, 0x7A,
+    0x4B, 0x4E, 0xDF, 0x59, 0xA9, 0x70, 0x14, 0x54, 0x74, 0x5A, 0x6D, 0x83, 0x77, 0x3F, 0x18, 0xFA,
+    0x42, 0x7C, 0x10, 0x17, 0x79, 0x28, 0x0D, 0x66, 0x4C, 0x47, 0xCE, 0xC5, 0x93, 0x15, 0xD0, 0x0C,
+    0x2B, 0x7F, 0x80, 0xE6, 0x2A, 0x64, 0xEA, 0x7D, 0xA8, 0x36, 0x74, 0x7B, 0x08, 0x45, 0x62, 0x39,
+    0x84, 0xE4, 0x04, 0x3C, 0x72, 0x29, 0x51, 0x6C, 0xBB, 0x7A, 0x88, 0x47, 0x96, 0xD8, 0x6D, 0x6A,
+    0x29, 0x54, 0x44, 0x50, 0x5F, 0x8F, 0x77, 0x67, 0x88, 0x7F, 0xC1, 0x87, 0xBC, 0x5A, 0x52, 0x9A,
+    0xB5, 0xD4, 0x64, 0x32, 0x1C, 0x45, 0xEC, 0x5A, 0x9A, 0x49, 0xE4, 0x1B, 0x11, 0x37, 0xE5, 0xF3,
+    0x9D, 0x87, 0x77, 0xB7, 0x5B, 0x8A, 0x3B, 0x97, 0x22, 0xF5, 0xED, 0x27, 0x67, 0x34, 0x3A, 0x23,
+    0x38, 0xBA, 0xFD, 0x28, 0xB7, 0xE8, 0x4C, 0x95, 0xFA, 0x78, 0x32, 0xA2, 0xCB, 0xCE, 0x6F, 0xE0,
+    0xD7, 0x3C, 0xD2, 0xCD, 0x2E, 0xE6, 0x6A, 0xFD, 0xFE, 0x64, 0x24, 0xDD, 0x5E, 0x34, 0xB0, 0xFC,
+    0xCA, 0x7A, 0x18, 0x76, 0x93, 0xD8, 0xE9, 0xE9, 0x12, 0x69, 0x43, 0x63, 0xA1, 0xA9, 0x8C, 0xF8,
+    0x80, 0x1F, 0x4B, 0x51, 0xAC, 0x0C, 0x01, 0x4F, 0xA5, 0x36, 0xEF, 0x0F, 0xB1, 0xA9, 0xF5, 0xEC,
+    0x24, 0x1F, 0x2D, 0x47, 0xC6, 0x23, 0xD5, 0x5A, 0x6B, 0x35, 0x8E, 0x67, 0xD6, 0x33, 0x6C, 0xBC,
+    0x40, 0xAE, 0xD9, 0x4D, 0xD4, 0x5B, 0xB6, 0x93, 0x69, 0x6A, 0x02, 0x4D, 0x2C, 0xD4, 0x97, 0xEA,
+    0xBD, 0xBE, 0xAE, 0x60, 0xB4, 0x70, 0x27, 0x09, 0x2A, 0x23, 0x2F, 0x3F, 0x7E, 0x66, 0x0C, 0x17,
+    0x97, 0xF2, 0x41, 0x96, 0xAD, 0x59, 0x0F, 0xAD, 0x06, 0xB3, 0xF7, 0xCD, 0x92, 0x08, 0x15, 0x77,
+    0xD5, 0xBA, 0x75, 0x5A, 0x19, 0x24, 0xBA, 0x1F, 0x0C, 0xBD, 0x0F, 0xC5, 0xE8, 0x22, 0x0F, 0x15,
+    0xEA, 0x6D, 0x55, 0xD6, 0x9A, 0x6C, 0x8D, 0xD6, 0x9A, 0xEC, 0x27, 0x95, 0xFA, 0x3F, 0x40, 0xF3,
+    0x40, 0xBD, 0xFA, 0x50, 0x6D, 0x4E, 0x7F, 0xAC, 0x22, 0x69, 0x62, 0xD8, 0x1A, 0x3D, 0xD3, 0xBD,
+    0xD4, 0xDB, 0xA9, 0x70, 0x6D, 0xC3, 0x3A, 0xB1, 0xF8, 0xD1, 0xFE, 0x1F, 0xC6, 0x83, 0x27, 0x7D,
+    0xAE, 0x6C, 0xCF, 0x57, 0xBA, 0x91, 0x6A, 0x29, 0x23, 0xB8, 0x65, 0x18, 0xA1, 0x79, 0x3B, 0x1E,
+    0x06, 0x24, 0x01, 0x11, 0x77, 0xCA, 0x1E, 0xD8, 0x94, 0x34, 0x47, 0xF5, 0xC5, 0x84, 0xB7, 0xCD,
+    0x32, 0x95, 0x11, 0x17, 0x71, 0xC1, 0x16, 0x74, 0xAE, 0x91, 0x98, 0x26, 0xA5, 0xB1, 0x04, 0x47,
+    0xAA, 0x42, 0x9E, 0x8E, 0x59, 0xE1, 0x28, 0xEE, 0x0D, 0x07, 0x5B, 0x93, 0x46, 0x23, 0x9F, 0xA5,
+    0x51, 0x6B, 0x6B, 0xDA, 0xB7, 0x74, 0x8B, 0xCD, 0x4B, 0x15, 0xA9, 0x84, 0x5F, 0xE9, 0x56, 0xB4,
+    0x3F, 0x67, 0xD2, 0x02, 0xF1, 0x28, 0xF2, 0xB2, 0x55, 0x9D, 0xC6, 0xE0, 0x06, 0x9F, 0xA3, 0x08,
+    0xF9, 0x46, 0xB1, 0x56, 0x8B, 0xD9, 0x6C, 0x34, 0xF4, 0x49, 0x4D, 0xD4, 0xC7, 0xC3, 0x68, 0x57,
+    0xE3, 0x5D, 0x85, 0x59, 0x74, 0x7B, 0x62, 0xC6, 0x34, 0xD2, 0x48, 0xF7, 0x83, 0xA1, 0x47, 0xA3,
+    0x03, 0x8D, 0xD9, 0x71, 0xC4, 0xC6, 0x63, 0x6D, 0xD7, 0x66, 0xA1, 0x97, 0xE3, 0x87, 0xCD, 0x4E,
+    0xD9, 0xBA, 0x9D, 0x66, 0x2C, 0x77, 0x7C, 0xA8, 0x36, 0xFC, 0xFE, 0xE4, 0x45, 0x44, 0x31, 0x5E,
+    0x8A, 0x28, 0xAE, 0x9D, 0x4E, 0xA7, 0xD3, 0xC9, 0x08, 0xB2, 0xFF, 0x56, 0x92, 0x35, 0x69, 0x90,
+    0xA2, 0xFF, 0xC1, 0x93, 0xDB, 0x27, 0xE5, 0x42, 0x25, 0xFC, 0x2B, 0x6B, 0xA1, 0xB1, 0xFE, 0x5E,
+    0x44, 0x73, 0xB9, 0x78, 0xBA, 0x25, 0x5F, 0xB3, 0xB6, 0x8E, 0x3C, 0x7C, 0x94, 0x75, 0x24, 0xCE,
+    0x8F, 0x9D, 0x56, 0x49, 0x3B, 0x34, 0xDE, 0xA9, 0xE0, 0xF0, 0x53, 0x5E, 0xBE, 0x20, 0x73, 0x98,
+    0xC0, 0x83, 0x05, 0xFB, 0x96, 0x62, 0xCE, 0x74, 0x59, 0xAE, 0xFF, 0x81, 0x4B, 0xE0, 0x53, 0xAA,
+    0x0A, 0x35, 0x40, 0xCA, 0x6A, 0x39, 0x4D, 0xDA, 0xC7, 0xB0, 0x58, 0xD3, 0xFF, 0xA8, 0xAE, 0xD8,
+    0x8C, 0x7C, 0xB5, 0x73, 0xEB, 0x10, 0xC5, 0xF0, 0x81, 0x6C, 0xD0, 0xDA, 0x58, 0x83, 0x8B, 0xF5,
+    0x96, 0x7E, 0xF8, 0x6C, 0x66, 0x15, 0x3F, 0x14, 0x6A, 0xD3, 0xFF, 0x76, 0xFA, 0x55, 0xE6, 0x86,
+    0x25, 0x51, 0x4F, 0xDA, 0x3A, 0xE6, 0x73, 0x13, 0x9B, 0xD0, 0x18, 0x85, 0xB9, 0x77, 0xDA, 0xCD,
+    0x72, 0x25, 0xF7, 0xB6, 0x34, 0x47, 0xD1, 0xE4, 0xE5, 0x07, 0x60, 0x33, 0x18, 0xB9, 0x99, 0xAD,
+    0x7C, 0xD1, 0x1E, 0xBF, 0xC5, 0xF5, 0x1E, 0x3C, 0xD5, 0x0A, 0x2E, 0xB8, 0x15, 0xF2, 0xDD, 0xAD,
+    0x80, 0x7F, 0xDD, 0xA8, 0xDA, 0xCB, 0x25, 0x5E, 0x4E, 0xB8, 0x8B, 0xEF, 0x73, 0x3A, 0x9D, 0x6E,
+    0x74, 0x92, 0xB4, 0x37, 0x92, 0xA4, 0x4F, 0x48, 0x92, 0x5E, 0xDE, 0x3F, 0xA9, 0xEF, 0x3C, 0x19,
+    0xC4, 0x10, 0x8A, 0xD8, 0xF5, 0x3E, 0x66, 0x7B, 0x3D, 0xBA, 0x9D, 0xEE, 0xB1, 0x50, 0xAA, 0x6D,
+    0xFA, 0x87, 0x33, 0x8D, 0x59, 0x7B, 0xBF, 0xCC, 0xE6, 0x99, 0xA6, 0xA3, 0xBF, 0xD3, 0xCB, 0xA6,
+    0xB2, 0xB2, 0x5D, 0x08, 0x72, 0x74, 0x07, 0x87, 0x7E, 0xBC, 0x50, 0x9A, 0x4D, 0x8F, 0x98, 0x3C,
+    0xBB, 0x7C, 0x4B, 0xE6, 0xA0, 0x58, 0xC8, 0xD7, 0xA7, 0x41, 0x5F, 0x1E, 0x69, 0x96, 0x6F, 0x5C,
+    0xA4, 0x38, 0x1F, 0x95, 0xFA, 0x46, 0x8A, 0x95, 0xA4, 0xFE, 0x96, 0x7E, 0xF8, 0xEC, 0x9D, 0xA9,
+    0xD0, 0x3B, 0x65, 0x63, 0xDC, 0x96, 0xDC, 0x5D, 0x17, 0x69, 0x33, 0x8D, 0x1F, 0xA0, 0x89, 0x4D,
+    0xC8, 0xA5, 0x9D, 0x46, 0xEA, 0x31, 0x33, 0x31, 0x19, 0xEF, 0xE4, 0xEF, 0xBF, 0xEA, 0x9B, 0xBB,
+    0x56, 0xFD, 0x27, 0xF5, 0xE6, 0x0D, 0xE8, 0x0E, 0x4D, 0xDB, 0xFD, 0xAE, 0x65, 0xFD, 0x53, 0x57,
+    0x7D, 0xF6, 0xB3, 0x56, 0xFD, 0x8B, 0xC9, 0x92, 0x5E, 0x4E, 0x75, 0x3E, 0x2A, 0xF5, 0x83, 0x14,
+    0x06, 0x69, 0xFD, 0xED, 0xE1, 0xAD, 0xAF, 0x51, 0xC7, 0xCB, 0x59, 0xCD, 0x89, 0x46, 0x8A, 0x4E,
+    0xDA, 0xF3, 0xE7, 0x74, 0xEB, 0x22, 0xD5, 0xE9, 0x43, 0x46, 0x1D, 0xF3, 0xB9, 0x52, 0x15, 0x73,
+    0x69, 0x67, 0xD0, 0x8E, 0xD3, 0x6E, 0x41, 0x53, 0xE2, 0xE3, 0xFC, 0x05, 0xE9, 0xB6, 0x9E, 0xB7,
+    0x20, 0x54, 0x89, 0xAA, 0xD7, 0x03, 0xCD, 0x63, 0x1A, 0x81, 0xBC, 0xEF, 0xFA, 0xFB, 0xE0, 0x6E,
+    0xD7, 0x8C, 0xDC, 0xF8, 0x98, 0xB4, 0x16, 0xD2, 0x1B, 0xD2, 0x96, 0x49, 0xB1, 0xD1, 0x6D, 0x1A,
+    0xBD, 0xC6, 0x10, 0x60, 0x98, 0xF0, 0x96, 0xA4, 0x74, 0x3B, 0x46, 0x02, 0x68, 0x29, 0x45, 0x9E,
+    0xB6, 0xDD, 0xFD, 0xAF, 0xD9, 0xD3, 0x35, 0x2D, 0x4A, 0xD7, 0xAC, 0x3F, 0xE5, 0x9A, 0xC1, 0x52,
+    0x9F, 0xCD, 0x06, 0xC3, 0x4C, 0xA5, 0xD1, 0x48, 0x94, 0x5B, 0x76, 0x38, 0xFF, 0xA9, 0x16, 0x37,
+    0x49, 0xBC, 0xAD, 0x1C, 0x5D, 0xC1, 0xCE, 0x28, 0x10, 0x54, 0x37, 0xDF, 0x05, 0x68, 0x7A, 0x0A,
+    0x9C, 0xBE, 0x1B, 0xA0, 0x1B, 0x34, 0x92, 0x2D, 0x3E, 0x42, 0x3E, 0x76, 0xF7, 0x2D, 0xE6, 0x6A,
+    0x22, 0xE5, 0x56, 0x29, 0xD2, 0x05, 0xAF, 0x90, 0xAB, 0xBF, 0xA5, 0xD1, 0x6D, 0x94, 0x3B, 0x3E,
+    0xD0, 0x2C, 0x68, 0x24, 0x25, 0xD0, 0x69, 0x16, 0xEA, 0x15, 0x8D, 0x0C, 0x53, 0x29, 0x0A, 0xE1,
+    0x57, 0xDC, 0x9A, 0x69, 0x66, 0x98, 0x9C, 0xDA, 0x42, 0x0C, 0x11, 0x17, 0xAB, 0xD7, 0xC3, 0xEF,
+    0xFA, 0x30, 0xF8, 0x1F, 0x7D, 0x4F, 0x7A, 0x43, 0x7A, 0x4C, 0x7A, 0x4C, 0xAB, 0x53, 0x70, 0xEA,
+    0x9D, 0xF5, 0xAC, 0x69, 0xCD, 0x34, 0x26, 0xF2, 0x5C, 0x62, 0xFF, 0x1D, 0xAB, 0xE8, 0xAC, 0x0E,
+    0x79, 0xF7, 0xE3, 0x74, 0x3A, 0x71, 0x3A, 0x3D, 0xEE, 0xA5, 0xDE, 0x4B, 0xB5, 0x89, 0x00, 0xBD,
+    0x24, 0xDD, 0xCC, 0xB5, 0xB7, 0x95, 0x30, 0x5E, 0x87, 0x11, 0xC2, 0x35, 0x1B, 0x9F, 0x63, 0x81,
+    0xCE, 0xA0, 0xE7, 0xC6, 0x64, 0x41, 0xEE, 0x73, 0xCD, 0x6C, 0xD7, 0x2C, 0x46, 0x16, 0xDD, 0x28,
+    0xD4, 0xDF, 0xFF, 0x9A, 0xCA, 0x68, 0xD5, 0xB9, 0x26, 0xAA, 0x1D, 0x86, 0x68, 0xC2, 0x25, 0x9A,
+    0xEA, 0x84, 0x01, 0x25, 0x8A, 0xDC, 0x21, 0x0F, 0x67, 0x84, 0xA5, 0xAB, 0x58, 0xD0, 0x23, 0x49,
+    0xCF, 0x7A, 0x3D, 0x28, 0x0D, 0x66, 0x8B, 0x1E, 0x39, 0xDD, 0x43, 0x50, 0x30, 0xD7, 0x48, 0x37,
+    0x0D, 0x1A, 0x4B, 0x15, 0x12, 0xCD, 0xFA, 0xA0, 0xA9, 0x5D, 0x76, 0x73, 0x21, 0x72, 0xB5, 0xC6,
+    0x64, 0xEE, 0x66, 0x7C, 0xC8, 0xD5, 0x66, 0xEA, 0x5D, 0xA4, 0xDA, 0xE8, 0x02, 0x3E, 0x14, 0xEA,
+    0x51, 0x5F, 0xEF, 0x54, 0x1B, 0x5A, 0xF0, 0xA1, 0xD2, 0x88, 0xC6, 0x17, 0x55, 0x14, 0xAA, 0x7E,
+    0xBC, 0xBF, 0x58, 0x4B, 0xB5, 0x16, 0xAF, 0xC5, 0xAB, 0x97, 0xD0, 0x8A, 0xE6, 0x4C, 0x2D, 0x0F,
+    0x1F, 0xC5, 0x62, 0xF6, 0x08, 0xBC, 0x0B, 0x60, 0xA3, 0xB6, 0xB4, 0x5C, 0xD3, 0x1B, 0x0F, 0x2F,
+    0x15, 0x48, 0x8F, 0x86, 0xD7, 0xF7, 0x77, 0x80, 0x26, 0x97, 0x98, 0xF4, 0x8F, 0x67, 0xA7, 0xD3,
+    0x0D, 0x59, 0x23, 0xA6, 0x4E, 0x6A, 0x3B, 0xA9, 0xD2, 0xDE, 0x56, 0xBA, 0x7D, 0x79, 0xE4, 0x5D,
+    0x3C, 0x46, 0x3E, 0xD3, 0x44, 0x66, 0x5B, 0x81, 0x61, 0xFE, 0x69, 0xD7, 0x5C, 0xD9, 0x88, 0xCD,
+    0x72, 0x6C, 0xB2, 0x7B, 0x5F, 0xD3, 0xD8, 0x66, 0xAD, 0xD4, 0x9A, 0x56, 0xAD, 0xAD, 0x8D, 0x4E,
+    0x6D, 0x77, 0x20, 0x28, 0x1C, 0xC5, 0x62, 0x87, 0x89, 0xE4, 0x68, 0x03, 0x75, 0xE2, 0x52, 0xA9,
+    0x6C, 0x1E, 0xF8, 0xC7, 0xE0, 0xE6, 0x62, 0x06, 0xFF, 0xE6, 0xD0, 0x1E, 0x1A, 0xD7, 0x36, 0xDB,
+    0xDD, 0xFC, 0x8B, 0xB5, 0xD7, 0x0E, 0x93, 0x99, 0x08, 0xCE, 0xD6, 0x01, 0x87, 0xEA, 0x07, 0x56,
+    0x71, 0x19, 0xEA, 0x1E, 0x60, 0xB5, 0xE4, 0x9E, 0xCF, 0x17, 0xCE, 0x84, 0xD3, 0xB3, 0x7C, 0xE2,
+    0x83, 0xAF, 0xFD, 0x92, 0x6E, 0x44, 0xFE, 0x65, 0x7B, 0x96, 0xC1, 0xB3, 0x1E, 0x7E, 0xD3, 0x8B,
+    0x1C, 0xBD, 0x45, 0xD6, 0x62, 0x86, 0x22, 0x34, 0x40, 0xF5, 0xF6, 0xCA, 0x21, 0xE1, 0x59, 0xBD,
+    0xF6, 0x8B, 0xB6, 0x3F, 0xF9, 0x03, 0xFE, 0xB1, 0x85, 0x51, 0xBE, 0x07, 0x34, 0x75, 0x01, 0xB2,
+    0x0B, 0x94, 0x7B, 0x85, 0x3C, 0xF1, 0x61, 0xD5, 0x76, 0x37, 0x81, 0x7F, 0x66, 0xA4, 0x8E, 0x5F,
+    0x5E, 0x0B, 0x4B, 0x9B, 0x01, 0xC5, 0xF8, 0x9B, 0x80, 0x1F, 0x77, 0xC8, 0xE5, 0x56, 0xA8, 0x97,
+    0x61, 0x4C, 0x72, 0x64, 0xD5, 0xE2, 0x47, 0xF0, 0x1F, 0x8D, 0x40, 0x28, 0xFB, 0x5F, 0x20, 0xC3,
+    0xFB, 0xC8, 0xE9, 0xD4, 0x3E, 0x72, 0x3A, 0x39, 0x13, 0x3D, 0x7F, 0x45, 0x5A, 0x4A, 0x29, 0x0C,
+    0x7A, 0x8D, 0x41, 0x37, 0x2F, 0xFB, 0x16, 0x1A, 0x0F, 0xDF, 0xA2, 0xDE, 0xA0, 0xB6, 0x71, 0xAA,
+    0xAE, 0xFA, 0x1F, 0x77, 0x5C, 0x73, 0x65, 0x96, 0x72, 0xB5, 0xC7, 0x0C, 0xDC, 0xF3, 0x9A, 0x3C,
+    0xCD, 0xE4, 0xB0, 0x90, 0xAB, 0xA7, 0x51, 0xD2, 0x53, 0x5B, 0xCA, 0x24, 0x9E, 0x65, 0x32, 0x80,
+    0x52, 0x30, 0xB8, 0x72, 0xB6, 0x83, 0xDD, 0x04, 0x90, 0x52, 0x30, 0xB4, 0x5D, 0xF9, 0x32, 0x5C,
+    0x41, 0x7D, 0xAB, 0x44, 0xBB, 0x4A, 0x56, 0xA6, 0xBA, 0x9B, 0x90, 0x51, 0x89, 0x4C, 0x1F, 0x95,
+    0xA8, 0xA3, 0x53, 0x64, 0x98, 0x7F, 0x7B, 0x08, 0xC5, 0xA5, 0xC1, 0xF6, 0x01, 0x1F, 0x32, 0xF5,
+    0x56, 0x63, 0x7C, 0x18, 0xD3, 0x4C, 0x23, 0xC6, 0xF9, 0xDB, 0xE9, 0x56, 0x9A, 0xA5, 0xD0, 0x84,
+    0xC6, 0x46, 0x14, 0xCA, 0xDF, 0x8E, 0xBF, 0xEA, 0x62, 0xF3, 0x57, 0x6F, 0xAD, 0x9D, 0x62, 0xA7,
+    0x49, 0x9A, 0xB4, 0x17, 0x8A, 0x85, 0xE6, 0x42, 0x7D, 0xB9, 0xC3, 0x0D, 0x6B, 0x40, 0x49, 0x73,
+    0x06, 0x7E, 0x53, 0xF6, 0xA3, 0xB3, 0x14, 0xC8, 0xFF, 0x05, 0x58, 0x67, 0x85, 0xAB, 0xE5, 0x7C,
+    0xEF, 0x3D, 0xFE, 0x51, 0x9C, 0x15, 0x66, 0x0E, 0x9E, 0x19, 0xF9, 0x39, 0x36, 0xF4, 0xFF, 0x2E,
+    0x0D, 0x45, 0xB1, 0x1F, 0xDC, 0x9C, 0x6E, 0x3E, 0x22, 0xA6, 0x17, 0x78, 0xB0, 0xBD, 0x9F, 0xFB,
+    0xF3, 0xB8, 0xB9, 0xAD, 0x4E, 0x0A, 0x79, 0xA4, 0x53, 0xF4, 0x52, 0xEB, 0x42, 0x2E, 0xCD, 0x83,
+    0x66, 0x86, 0x31, 0xD3, 0x66, 0x2D, 0x2C, 0xC0, 0x8E, 0xCE, 0x26, 0x1E, 0x93, 0xA8, 0x60, 0x14,
+    0x60, 0x2A, 0xAB, 0x12, 0xA9, 0x23, 0x5E, 0x56, 0x1C, 0xB6, 0xE4, 0xB2, 0x5E, 0x14, 0x9A, 0x9C,
+    0x16, 0xD3, 0xA8, 0x6D, 0x87, 0x61, 0xAA, 0x03, 0xB8, 0xAD, 0x88, 0x6A, 0x2D, 0x96, 0xA9, 0xBF,
+    0xBD, 0x95, 0x11, 0x18, 0x26, 0xB9, 0x43, 0xB4, 0x7B, 0xF5, 0xDF, 0x13, 0x50, 0xED, 0x7E, 0xD4,
+    0x57, 0x56, 0xA0, 0xBE, 0xBD, 0x17, 0x7B, 0x37, 0x9A, 0x7C, 0x4D, 0xF5, 0xB6, 0x55, 0x92, 0xAA,
+    0x6F, 0x12, 0x45, 0x38, 0x32, 0x18, 0x4D, 0x58, 0x73, 0x66, 0x73, 0xEE, 0x75, 0x14, 0x5D, 0x6B,
+    0x35, 0x74, 0xD8, 0x04, 0x93, 0xEC, 0x10, 0x3A, 0x93, 0x55, 0x9A, 0x90, 0x5A, 0xC0, 0xDD, 0x93,
+    0xB0, 0x93, 0x86, 0x36, 0xF1, 0x04, 0xD2, 0x62, 0x1A, 0x52, 0x89, 0xC7, 0x27, 0xAC, 0x2A, 0xE2,
+    0x0B, 0xA6, 0x80, 0xD9, 0xFB, 0x16, 0x68, 0xFA, 0xF2, 0x5E, 0x3E, 0xF1, 0x03, 0x26, 0x71, 0xD1,
+    0x4D, 0xD5, 0xE6, 0x34, 0xD5, 0xB1, 0xD0, 0x2B, 0x5A, 0x73, 0xB5, 0xDD, 0x1B, 0x5F, 0x17, 0xDD,
+    0xEC, 0x22, 0x9A, 0x5C, 0xCC, 0x45, 0xB3, 0x14, 0x62, 0x18, 0x8B, 0x1D, 0x8D, 0xCD, 0x8C, 0xC6,
+    0x6E, 0x71, 0x0B, 0x3E, 0x34, 0x5B, 0x11, 0xA9, 0xA2, 0xD3, 0x17, 0x76, 0x32, 0x95, 0x9A, 0x05,
+    0xDD, 0xCB, 0x5A, 0xBB, 0x1E, 0xF7, 0xC6, 0x26, 0x3F, 0x52, 0x6C, 0x5B, 0xF7, 0xEA, 0x04, 0x92,
+    0x33, 0x69, 0x82, 0xC2, 0x00, 0xED, 0xD6, 0xE8, 0x97, 0xBD, 0x41, 0xAF, 0xBD, 0x95, 0x01, 0xF4,
+    0xB6, 0xF8, 0xCE, 0x2B, 0xC2, 0x48, 0x89, 0x29, 0x33, 0x61, 0x5B, 0xC7, 0x54, 0xA4, 0xEB, 0xBF,
+    0x15, 0x87, 0x76, 0x6B, 0xAE, 0xB6, 0xE9, 0xA1, 0xBE, 0x4B, 0xBC, 0xF5, 0x1D, 0xD7, 0xF5, 0xE5,
+    0xC2, 0x08, 0x84, 0x4B, 0x35, 0x39, 0xDD, 0x76, 0xE1, 0xC3, 0x14, 0x71, 0x68, 0x01, 0x15, 0x2B,
+    0xE0, 0xC7, 0x7A, 0x84, 0x72, 0xE1, 0x3E, 0xEA, 0xF1, 0x4F, 0xCE, 0xB9, 0x5A, 0xBC, 0x7A, 0x1F,
+    0x29, 0x15, 0x33, 0x4D, 0x3C, 0xA1, 0xD1, 0x6D, 0xE0, 0x36, 0x4C, 0x16, 0x31, 0xD1, 0x73, 0x2D,
+    0x06, 0xB5, 0x96, 0xC1, 0x99, 0x65, 0x2C, 0x9A, 0x19, 0x32, 0x15, 0x11, 0xA8, 0x43, 0x37, 0x02,
+    0x72, 0x01, 0x70, 0x6F, 0xDA, 0x1A, 0xEF, 0x46, 0xC0, 0xBD, 0xBD, 0x5C, 0x24, 0x44, 0x93, 0xDC,
+    0xB7, 0x0D, 0xCC, 0xA1, 0x0B, 0xD6, 0x5F, 0xD4, 0xE9, 0x54, 0x11, 0x98, 0x8C, 0x84, 0xF3, 0x43,
+    0xAB, 0x17, 0xB5, 0x4C, 0x5B, 0x2A, 0x27, 0x32, 0xA0, 0xE2, 0x6A, 0x0A, 0x3F, 0x5F, 0x8B, 0xC5,
+    0xB6, 0xE0, 0x08, 0x6E, 0xB3, 0x0A, 0xC2, 0x97, 0xD4, 0x83, 0x5B, 0xEA, 0x19, 0x78, 0x28, 0x31,
+    0xCE, 0xEF, 0x10, 0x24, 0x78, 0x7C, 0xD0, 0x5E, 0x48, 0xAF, 0x4A, 0x93, 0x57, 0x6C, 0x34, 0x33,
+    0xEC, 0x0C, 0x81, 0x62, 0x4F, 0x55, 0x6B, 0xF8, 0x48, 0x13, 0xC8, 0x92, 0x70, 0xC7, 0x66, 0x91,
+    0x7C, 0x68, 0x02, 0x94, 0x2A, 0x37, 0xC0, 0x2F, 0x86, 0xA0, 0xBF, 0x1E, 0xCE, 0x85, 0x48, 0xE6,
+    0x30, 0x9D, 0x55, 0x3A, 0xEE, 0xAE, 0xCF, 0x3A, 0xA4, 0x54, 0xC2, 0xDD, 0xD2, 0x68, 0x3B, 0x67,
+    0x00, 0xC6, 0x1D, 0x08, 0xFD, 0x61, 0x21, 0xF3, 0x4B, 0xB2, 0x15, 0xEA, 0x2F, 0xC1, 0x35, 0x2D,
+    0x64, 0x49, 0x6A, 0xAF, 0x4F, 0x52, 0x69, 0x77, 0x06, 0xF5, 0x56, 0x7C, 0x74, 0x28, 0x4E, 0x19,
+    0xB7, 0x9D, 0xE1, 0x8F, 0x18, 0x36, 0x44, 0xA6, 0x15, 0x51, 0x68, 0x66, 0xC7, 0x69, 0xE4, 0xFD,
+    0xC9, 0x3E, 0x0F, 0x16, 0x82, 0x2E, 0x67, 0xBB, 0x7E, 0xC8, 0x22, 0x9F, 0x5F, 0xB4, 0xDA, 0x21,
+    0xB3, 0x54, 0xE9, 0xC5, 0x9D, 0x62, 0x42, 0x91, 0x2A, 0xE4, 0x0A, 0xB8, 0x50, 0x6A, 0xA4, 0x09,
+    0xB5, 0x5A, 0xFC, 0xEC, 0x75, 0xEB, 0xEB, 0x9A, 0xBA, 0x4B, 0x1C, 0xF1, 0xE6, 0xDC, 0xB7, 0x2C,
+    0x3B, 0xDF, 0x6E, 0x31, 0x1E, 0x6B, 0xBB, 0x3E, 0x17, 0xFC, 0x0C, 0x53, 0xE2, 0xDA, 0xE5, 0xDB,
+    0x51, 0xCA, 0x90, 0x8D, 0x77, 0x31, 0x6A, 0xFD, 0x5A, 0x44, 0xA4, 0x2F, 0x6D, 0xB9, 0x6C, 0x23,
+    0x6B, 0x29, 0xB6, 0x4F, 0x6B, 0x2E, 0x56, 0xD4, 0x17, 0xA1, 0xD8, 0xE1, 0xA6, 0x81, 0x73, 0x73,
+    0x1A, 0xC3, 0x42, 0x47, 0xFE, 0xB2, 0x09, 0xC0, 0x30, 0x96, 0x6D, 0x2E, 0xAA, 0xA9, 0xD2, 0x1F,
+    0xD6, 0xA1, 0x91, 0x14, 0x3A, 0x49, 0x73, 0xF7, 0xD7, 0xD2, 0xD8, 0x8C, 0x9D, 0xCE, 0x89, 0x7F,
+    0x53, 0x49, 0xB6, 0xBC, 0xF3, 0x70, 0x41, 0xAF, 0x4F, 0x76, 0xF9, 0xDE, 0xC2, 0x38, 0xEF, 0x98,
+    0x79, 0xC8, 0x9E, 0x3D, 0x36, 0xA2, 0x09, 0xEA, 0xC7, 0x23, 0x01, 0xE1, 0xEE, 0xA9, 0x26, 0xF8,
+    0x5F, 0x72, 0xE0, 0xDF, 0x43, 0x76, 0x13, 0x3A, 0xDC, 0x02, 0x5D, 0xEF, 0x27, 0xF0, 0xFF, 0x5A,
+    0xED, 0x21, 0xA1, 0x6B, 0xCC, 0xCC, 0x64, 0x11, 0x87, 0x77, 0xEA, 0xF0, 0xF7, 0x7C, 0x83, 0x22,
+    0x14, 0x91, 0x62, 0x71, 0x81, 0x22, 0xFA, 0x91, 0xDC, 0x8A, 0x11, 0xB6, 0x03, 0x6A, 0xB4, 0xF6,
+    0xAC, 0xFD, 0xCF, 0x73, 0x07, 0xC0, 0x13, 0xA6, 0x95, 0x63, 0x40, 0x80, 0x37, 0xCB, 0x6C, 0xE6,
+    0x2A, 0xB7, 0x23, 0xA1, 0xD8, 0xF9, 0xC6, 0xB9, 0x7E, 0xF2, 0x10, 0x8D, 0xAA, 0x13, 0x8B, 0x61,
+    0xBD, 0x5C, 0x64, 0x6C, 0xB6, 0x3F, 0x15, 0x69, 0x1E, 0x5F, 0x52, 0x3F, 0x2C, 0x5D, 0xA6, 0x42,
+    0x64, 0x07, 0x23, 0xA2, 0xBF, 0xA8, 0xF3, 0xB9, 0xF8, 0xC2, 0xA5, 0xF2, 0xD7, 0x2A, 0x75, 0x5A,
+    0xBC, 0xF2, 0xC7, 0xFF, 0xEE, 0xF7, 0x30, 0xCC, 0xC0, 0xAF, 0xDB, 0x5F, 0xF5, 0x1F, 0x55, 0x7F,
+    0x51, 0xF0, 0x9C, 0x0A, 0x2B, 0xBB, 0x54, 0x49, 0x6E, 0x04, 0x9F, 0x6B, 0x94, 0x63, 0x11, 0x33,
+    0xF5, 0x3E, 0x94, 0xC2, 0xCF, 0x45, 0x3C, 0x52, 0xF9, 0x9F, 0x63, 0xCF, 0x55, 0xEE, 0x2E, 0x36,
+    0xC1, 0x8F, 0x9E, 0xF7, 0x5F, 0xAA, 0x80, 0x75, 0x1B, 0x85, 0x02, 0x83, 0xDA, 0xE6, 0xFB, 0xB1,
+    0x5C, 0xEB, 0x6F, 0xEE, 0x6C, 0xC9, 0x07, 0xCB, 0xBE, 0x9A, 0xB7, 0x9A, 0x3F, 0xDF, 0xE8, 0x33,
+    0xDF, 0x7E, 0x5B, 0xF1, 0x69, 0xA7, 0x8F, 0xA6, 0xBE, 0x4B, 0xD7, 0x4E, 0x8F, 0x57, 0xD2, 0x8F,
+    0xA5, 0x28, 0x6D, 0xD7, 0x4E, 0x27, 0xDE, 0x45, 0xF6, 0x14, 0xA5, 0x68, 0xF4, 0x37, 0xDB, 0xA0,
+    0xB5, 0xD1, 0x7C, 0x7D, 0xE7, 0xFA, 0x17, 0xF7, 0x4E, 0xBB, 0x5E, 0x59, 0xA0, 0x9A, 0xEA, 0x2F,
+    0xAA, 0xDC, 0x7C, 0xD0, 0x2B, 0xBB, 0x8B, 0xBE, 0x1F, 0x12, 0x5C, 0x53, 0xEB, 0xA3, 0x52, 0xFD,
+    0x37, 0xDB, 0xD3, 0x65, 0x08, 0xCD, 0x98, 0x6D, 0x3C, 0x39, 0x95, 0x2B, 0x75, 0xCB, 0x87, 0x01,
+    0xB2, 0xBF, 0x40, 0xD1, 0xEB, 0xBB, 0x73, 0xF7, 0x7C, 0xA1, 0xF1, 0xC3, 0xB1, 0xFA, 0xEB, 0xB7,
+    0xA3, 0x97, 0x15, 0x95, 0xB5, 0x7C, 0x28, 0x0B, 0x0C, 0x45, 0xCC, 0x54, 0xC5, 0x62, 0xAB, 0x83,
+    0x5B, 0xFD, 0xD4, 0xCC, 0x6A, 0xFD, 0x47, 0xA2, 0x31, 0xB9, 0x80, 0xF7, 0xF0, 0xE0, 0xC7, 0xE6,
+    0x72, 0xED, 0xB2, 0xBD, 0x58, 0xFD, 0xE8, 0x5F, 0x0D, 0x99, 0x22, 0x4E, 0x2D, 0x7E, 0x22, 0x5B,
+    0x93, 0x9C, 0xDC, 0xEC, 0x1F, 0x0B, 0xFE, 0x4B, 0x8B, 0x7F, 0x79, 0xAD, 0xBF, 0x15, 0xDD, 0xBC,
+    0x95, 0xE1, 0xC5, 0x7C, 0xFA, 0x20, 0xC0, 0xF5, 0x1B, 0x74, 0x6A, 0x07, 0x85, 0x41, 0xBB, 0x6F,
+    0xBB, 0xFF, 0x9D, 0xEA, 0x5B, 0x64, 0x93, 0x79, 0xA3, 0x2F, 0xE4, 0x4B, 0x35, 0xD7, 0xA3, 0x1F,
+    0x7D, 0xDF, 0x8D, 0xDD, 0xE4, 0xE7, 0xF7, 0xB6, 0x3C, 0xCC, 0x30, 0xFA, 0xA5, 0xDC, 0x10, 0x7E,
+    0x6C, 0x26, 0x37, 0xBB, 0xE0, 0x42, 0xF6, 0x2C, 0x59, 0xEB, 0xD6, 0x66, 0xF1, 0x53, 0x37, 0x76,
+    0x7D, 0xD7, 0xFB, 0xBE, 0x19, 0xDD, 0x94, 0xF7, 0x0F, 0xB2, 0xD5, 0xDF, 0x8A, 0xFE, 0x99, 0xD0,
+    0x55, 0xE3, 0x9F, 0x67, 0x40, 0x1E, 0x8B, 0xAD, 0x88, 0x65, 0x74, 0xC1, 0x4F, 0x9E, 0x7F, 0x02,
+    0x54, 0x2F, 0x6B, 0xD0, 0x3E, 0xBC, 0x34, 0x67, 0xED, 0xB5, 0x4C, 0x45, 0xF4, 0x41, 0xDF, 0x95,
+    0x8B, 0x7E, 0xD4, 0x47, 0x6E, 0xE6, 0x3D, 0xD0, 0xCC, 0x4E, 0xCF, 0x84, 0xE7, 0x3F, 0x54, 0xBE,
+    0x3C, 0x3D, 0xE5, 0xEB, 0x2F, 0x2A, 0x94, 0x2B, 0x50, 0x4D, 0xFA, 0xA6, 0xCA, 0xB5, 0x1E, 0x37,
+    0x37, 0x7D, 0xCE, 0xE8, 0xD6, 0xD6, 0x36, 0xBB, 0xAF, 0x2F, 0xB5, 0xCD, 0x7E, 0xB6, 0x1C, 0xEB,
+    0xD6, 0xF3, 0x02, 0x3B, 0xFA, 0x7F, 0x87, 0xD8, 0x2C, 0xE0, 0x42, 0xF7, 0xD2, 0xEE, 0x16, 0x3F,
+    0xAA, 0x5C, 0x9B, 0x59, 0x2D, 0xD9, 0xEF, 0x41, 0xB3, 0x90, 0x2B, 0x50, 0x2B, 0xE4, 0xEA, 0xA6,
+    0x26, 0xF8, 0x97, 0x76, 0x7C, 0xD9, 0xF3, 0x7B, 0x0F, 0xC0, 0x53, 0x94, 0x3B, 0xB5, 0xBE, 0xB0,
+    0x0F, 0x8A, 0x5E, 0xC1, 0xCA, 0x72, 0xCF, 0xCB, 0xE6, 0x13, 0x77, 0x2C, 0x9B, 0x5A, 0x7A, 0x59,
+    0x8A, 0x5E, 0xFA, 0xC2, 0xAD, 0x5B, 0xCF, 0xF2, 0x0F, 0xDB, 0x5C, 0x6B, 0xAD, 0xCD, 0x4B, 0x3B,
+    0x0A, 0x3C, 0xDD, 0xA7, 0x76, 0x88, 0x19, 0xD6, 0x75, 0x4A, 0x76, 0x00, 0x74, 0x13, 0xC5, 0x66,
+    0x15, 0x07, 0x11, 0x72, 0x33, 0x38, 0x43, 0x1E, 0xAB, 0x58, 0x2F, 0x3E, 0x68, 0xD2, 0x33, 0xCA,
+    0x96, 0x72, 0xE6, 0x5A, 0x5B, 0x8F, 0xBE, 0xF7, 0xBD, 0xFF, 0xF7, 0x3E, 0x26, 0x66, 0xF9, 0x6F,
+    0xD9, 0x66, 0x9C, 0x2F, 0x6D, 0xDE, 0xE4, 0xE7, 0x0E, 0xA9, 0xB5, 0x8B, 0x75, 0xBF, 0x1B, 0xEC,
+    0x1C, 0xFF, 0xBD, 0xBB, 0xD1, 0xD1, 0x77, 0x92, 0x84, 0xA7, 0x65, 0xA4, 0xAC, 0xF5, 0xEC, 0xD2,
+    0x5C, 0x94, 0x79, 0x29, 0x58, 0x4A, 0xAA, 0x5C, 0x73, 0x8D, 0xF5, 0xDC, 0xB5, 0x7E, 0xCD, 0xB7,
+    0x32, 0x14, 0x6A, 0x9B, 0xB1, 0xA1, 0x0B, 0xD9, 0xCD, 0xBB, 0xFC, 0xC1, 0xFF, 0xF9, 0xE6, 0x99,
+    0x2C, 0x59, 0xCB, 0xB2, 0xBD, 0xD6, 0xC5, 0x3A, 0x66, 0x5A, 0xAC, 0x51, 0x63, 0x4F, 0xB7, 0x24,
+    0x15, 0xF6, 0xFC, 0x1C, 0xD3, 0x3A, 0x03, 0x38, 0x34, 0xD1, 0x44, 0xEA, 0x8D, 0x42, 0x7D, 0xAE,
+    0x09, 0xBF, 0x94, 0xD2, 0x5C, 0x08, 0x49, 0x74, 0xA1, 0x96, 0xA6, 0xE3, 0x33, 0x8F, 0x67, 0xEB,
+    0x67, 0x22, 0x0F, 0x3E, 0x4F, 0xD0, 0x91, 0x31, 0xB5, 0xED, 0x44, 0xDD, 0x00, 0x1E, 0xBC, 0x7D,
+    0x91, 0xF0, 0x3C, 0x57, 0xA3, 0x24, 0x60, 0xC2, 0x04, 0x41, 0x53, 0xBF, 0x15, 0xBB, 0xBC, 0xB6,
+    0xCB, 0x5F, 0xE3, 0xFE, 0x93, 0x6A, 0x54, 0x08, 0x8D, 0x0C, 0x47, 0x4B, 0xCA, 0x93, 0x49, 0x5E,
+    0x54, 0x26, 0x78, 0x31, 0xB4, 0xB8, 0x9D, 0xCA, 0xC4, 0x2E, 0x76, 0xA8, 0x37, 0xDC, 0x78, 0x6F,
+    0xE9, 0x82, 0xFF, 0x18, 0xD1, 0x83, 0xAB, 0xB2, 0xC5, 0x49, 0x99, 0xEE, 0xA6, 0x6D, 0x10, 0x4B,
+    0xDE, 0xA5, 0xE4, 0xE7, 0x74, 0x85, 0x78, 0x96, 0x98, 0x0A, 0x2B, 0xB9, 0x0E, 0xF6, 0x48, 0xA4,
+    0xD3, 0xCD, 0x2A, 0xA2, 0x95, 0x22, 0x16, 0x9A, 0x28, 0xD7, 0x4A, 0x2D, 0x65, 0x70, 0x3B, 0x94,
+    0x53, 0x73, 0xA9, 0xC1, 0x84, 0x5F, 0x78, 0x00, 0x3A, 0x69, 0x3F, 0x68, 0x89, 0x89, 0x4A, 0xFD,
+    0xD6, 0xAD, 0xAF, 0x5E, 0xAD, 0xD1, 0x1C, 0x16, 0xC8, 0xE9, 0x22, 0x54, 0xA3, 0xDF, 0xC0, 0xCD,
+    0x5E, 0x2D, 0x7E, 0xAE, 0xF5, 0xDA, 0x75, 0x4D, 0x95, 0x24, 0x8D, 0x69, 0x39, 0x58, 0xC6, 0x32,
+    0xC1, 0x4A, 0xEF, 0x0C, 0xA6, 0xCB, 0xCF, 0x5B, 0x3E, 0x27, 0x81, 0x49, 0x59, 0xA4, 0x30, 0x19,
+    0x2D, 0xB7, 0x53, 0xEE, 0x2E, 0x52, 0xC4, 0x6A, 0x81, 0xF6, 0x0A, 0x78, 0xFC, 0x0B, 0x22, 0x74,
+    0x94, 0x20, 0x2E, 0xEB, 0x81, 0x74, 0xCE, 0x2D, 0xCF, 0xE7, 0xC8, 0xF1, 0xA2, 0x40, 0xF7, 0x58,
+    0xDC, 0x69, 0xCD, 0xAD, 0x17, 0x01, 0x67, 0xD2, 0xBE, 0xB8, 0x47, 0x2D, 0xF0, 0x79, 0x63, 0x14,
+    0xE9, 0xB9, 0x3F, 0x3F, 0x97, 0x49, 0xB6, 0xFD, 0x5E, 0xB5, 0xC0, 0xE7, 0x3F, 0x75, 0xFE, 0x23,
+    0xA6, 0x03, 0xE2, 0x3F, 0xAA, 0xE9, 0x90, 0x01, 0x19, 0xB4, 0x9F, 0xD3, 0x44, 0xDE, 0x16, 0xE9,
+    0x1F, 0x5E, 0x38, 0xE2, 0xA7, 0xC7, 0x6D, 0xCF, 0x29, 0x2D, 0x2D, 0xE3, 0x60, 0xF2, 0xA8, 0x8E,
+    0x2E, 0x11, 0xC3, 0x98, 0xCA, 0x97, 0x86, 0x3E, 0xFD, 0x43, 0xE9, 0xD3, 0xA0, 0xF4, 0x51, 0xB2,
+    0x3D, 0xFD, 0x23, 0xDF, 0xD2, 0x56, 0x2F, 0x62, 0xF2, 0x16, 0xCB, 0x98, 0xE9, 0x07, 0x46, 0x25,
+    0x49, 0xDD, 0xA3, 0x5C, 0x28, 0x52, 0x23, 0xB0, 0xB9, 0xB0, 0x3F, 0xE6, 0xA7, 0x42, 0xED, 0x10,
+    0xB1, 0x3D, 0xD1, 0x6C, 0x30, 0xF4, 0x95, 0x70, 0x3B, 0x08, 0x27, 0x0C, 0x27, 0x75, 0x7B, 0xD2,
+    0xAA, 0xA9, 0x37, 0xDC, 0xF6, 0x90, 0x5B, 0x68, 0x22, 0x4D, 0xFC, 0xB0, 0xD9, 0xDC, 0xC1, 0xDA,
+    0x41, 0x6C, 0x9F, 0x52, 0x90, 0xDA, 0x47, 0x25, 0x69, 0x4C, 0x87, 0x82, 0x21, 0xDE, 0x92, 0x6E,
+    0x5E, 0xE2, 0xF5, 0x9A, 0x12, 0x88, 0xC9, 0x2F, 0xAC, 0x4D, 0xAA, 0x4A, 0x8E, 0x87, 0x0A, 0xC3,
+    0x9A, 0xD9, 0x87, 0xEF, 0x42, 0x1A, 0xF7, 0x26, 0x26, 0x4F, 0xD7, 0xED, 0x67, 0xB1, 0x94, 0x36,
+    0x19, 0xBC, 0xD4, 0x20, 0xE2, 0xEA, 0xD5, 0xC5, 0xC5, 0xD5, 0x3F, 0xE0, 0x50, 0xD2, 0x3B, 0x7A,
+    0x29, 0x5F, 0x34, 0xA0, 0x90, 0x66, 0x9A, 0xED, 0xF4, 0x29, 0xF5, 0x43, 0x4C, 0xEF, 0x5D, 0xAA,
+    0x2F, 0xD4, 0xD2, 0x05, 0x14, 0x32, 0x8D, 0xF6, 0x29, 0x19, 0x02, 0x95, 0xA8, 0x64, 0x82, 0x09,
+    0xBD, 0xD5, 0x8A, 0xA3, 0x29, 0xD3, 0x64, 0x57, 0x67, 0x0A, 0xB9, 0x26, 0x9A, 0xED, 0x93, 0x0A,
+    0x75, 0x6A, 0x44, 0x1E, 0x9C, 0x34, 0x77, 0xE9, 0x8C, 0x0C, 0xFE, 0x6A, 0x2F, 0x09, 0x3B, 0x28,
+    0x6D, 0xEA, 0xD5, 0xDA, 0x49, 0x79, 0xB4, 0x62, 0xB5, 0xA3, 0x92, 0xAE, 0x6F, 0x62, 0xB6, 0x63,
+    0x67, 0x25, 0x1D, 0x7E, 0xC9, 0x23, 0x0D, 0x5D, 0xC8, 0x97, 0x8B, 0x32, 0xC5, 0xA3, 0xAD, 0xFD,
+    0xFC, 0x44, 0x3A, 0x2E, 0x77, 0x0E, 0x65, 0xE1, 0x5C, 0xA9, 0x4B, 0xCC, 0x54, 0x68, 0xB6, 0xD6,
+    0x62, 0x33, 0xA5, 0x61, 0xFA, 0xA5, 0x25, 0x57, 0x2A, 0x81, 0x26, 0xDC, 0x4E, 0x66, 0xBD, 0x51,
+    0x72, 0x13, 0x24, 0x2C, 0x8C, 0x72, 0x50, 0x6A, 0x2C, 0xA5, 0x69, 0x50, 0x74, 0xD2, 0xF7, 0xA4,
+    0x68, 0x19, 0x9F, 0xF5, 0x4A, 0xF5, 0x74, 0x0A, 0xBF, 0x0E, 0xDD, 0xF4, 0x2E, 0x45, 0x18, 0x09,
+    0xA4, 0x4B, 0x2D, 0xCB, 0x52, 0xAF, 0xE9, 0xB3, 0xA4, 0xE6, 0x5D, 0xD0, 0xE3, 0xF5, 0xA4, 0xDA,
+    0x37, 0x44, 0x2C, 0xB1, 0xB1, 0xD0, 0xE8, 0x36, 0x83, 0xE9, 0x16, 0x96, 0x7A, 0x11, 0x9A, 0x88,
+    0x9F, 0xDE, 0x07, 0x0A, 0xC5, 0x66, 0xDB, 0xB3, 0x31, 0x51, 0x21, 0xAB, 0x11, 0xEB, 0x82, 0x4B,
+    0x51, 0x6F, 0x6A, 0xCF, 0x58, 0xA6, 0x80, 0x2C, 0x21, 0x6D, 0x16, 0xB5, 0x94, 0x47, 0xC3, 0xE5,
+    0x58, 0xA7, 0x4A, 0x77, 0x6F, 0xE0, 0x73, 0x3B, 0xCC, 0xB6, 0xAB, 0x35, 0x02, 0x43, 0x28, 0x0C,
+    0xD0, 0x1A, 0xCB, 0x64, 0xAA, 0x8C, 0x87, 0xB9, 0xD0, 0x6C, 0x26, 0xEF, 0x6A, 0xDD, 0xC0, 0x8F,
+    0x1B, 0x0E, 0xD8, 0x72, 0xEF, 0xCF, 0x25, 0xE2, 0x8F, 0x5F, 0x2D, 0x31, 0xF7, 0x5C, 0xD0, 0xA9,
+    0x6C, 0x9C, 0xD6, 0x23, 0x1B, 0x10, 0x8E, 0x5C, 0xC6, 0x78, 0xC7, 0x25, 0x79, 0x7F, 0xEF, 0x02,
+    0xD4, 0x0B, 0xF1, 0x49, 0x0E, 0xF1, 0xC9, 0xDA, 0xFC, 0xC2, 0xC5, 0x88, 0x7B, 0xDD, 0x72, 0x88,
+    0x3C, 0x26, 0x9B, 0xA5, 0x60, 0x48, 0xAA, 0xDB, 0x93, 0xDB, 0xA9, 0xD9, 0x1A, 0xC4, 0xD5, 0x9B,
+    0xA1, 0x75, 0xB9, 0xC6, 0xD2, 0x5C, 0xC3, 0x98, 0x29, 0x75, 0x8D, 0x19, 0xBE, 0xAB, 0x16, 0xFC,
+    0xD2, 0x2C, 0x26, 0x96, 0xE5, 0xA2, 0x13, 0x30, 0xFC, 0x44, 0x49, 0x78, 0x4B, 0xBD, 0xD5, 0x22,
+    0x68, 0xCE, 0xAC, 0xB5, 0xE0, 0x82, 0x31, 0xC3, 0xB7, 0x24, 0x3E, 0xA9, 0x9F, 0x22, 0x3E, 0xE9,
+    0x92, 0xF8, 0x64, 0x9D, 0xC4, 0x27, 0x0B, 0x29, 0xDE, 0x25, 0x22, 0x0A, 0xC0, 0xFB, 0x81, 0x62,
+    0xE6, 0x29, 0x2B, 0x25, 0x8F, 0x80, 0x5B, 0xCA, 0x05, 0x70, 0x1A, 0x2E, 0xA5, 0x94, 0xB2, 0xB4,
+    0xD4, 0xEE, 0x6E, 0x21, 0x9B, 0x9D, 0x4E, 0xED, 0xB5, 0xD3, 0xE3, 0x4E, 0x1A, 0xBD, 0x62, 0x2D,
+    0x8D, 0x5E, 0x6B, 0xA5, 0x8D, 0x4A, 0x33, 0x56, 0x6A, 0xC9, 0x10, 0xCC, 0xD1, 0x5F, 0x70, 0x0B,
+    0xF8, 0x15, 0x1F, 0xA0, 0x89, 0x74, 0xA6, 0x5E, 0xA1, 0x16, 0x5C, 0xCC, 0xAD, 0xD2, 0xAF, 0x88,
+    0x40, 0xB9, 0x3B, 0x83, 0x42, 0x6A, 0x5B, 0x3F, 0x3E, 0xB1, 0x1D, 0x0C, 0x97, 0xD4, 0x95, 0x5C,
+    0xC3, 0x72, 0x59, 0x5D, 0xA0, 0x1B, 0x81, 0x5F, 0x35, 0x8A, 0xB9, 0x37, 0x4C, 0xA0, 0xB3, 0x2D,
+    0xD5, 0x1D, 0x82, 0xC6, 0xED, 0xA5, 0xA8, 0xFC, 0xD0, 0x17, 0x3A, 0x4C, 0x66, 0x61, 0xDB, 0x70,
+    0x44, 0xDA, 0x2B, 0xD3, 0x03, 0xDE, 0xB2, 0x43, 0x72, 0xF4, 0xD0, 0x3B, 0x3B, 0xAB, 0xAC, 0x0D,
+    0xC9, 0x0F, 0x38, 0x5C, 0x84, 0xC3, 0x7B, 0xF8, 0x19, 0x17, 0x4E, 0xE9, 0xC2, 0x70, 0x76, 0x29,
+    0xCE, 0xDE, 0xC6, 0xE5, 0x0B, 0xB3, 0xE3, 0xC2, 0xE1, 0xCE, 0x0B, 0xF7, 0x0B, 0x17, 0xC4, 0x24,
+    0x9D, 0xDE, 0xBA, 0xF5, 0xDC, 0x9E, 0x4E, 0xBA, 0xC3, 0xE7, 0x35, 0x87, 0xE4, 0xE8, 0xD2, 0x90,
+    0x20, 0x89, 0x8B, 0xEC, 0xD8, 0xB1, 0x0A, 0x7C, 0xDA, 0x16, 0x47, 0x97, 0x8B, 0x73, 0xFB, 0xD7,
+    0xC3, 0x95, 0xF9, 0xF0, 0xA5, 0x0A, 0xB6, 0x63, 0xCB, 0xAD, 0x49, 0xF9, 0xC5, 0xA7, 0x5D, 0x80,
+    0xA6, 0xE4, 0xA7, 0x77, 0x7D, 0x82, 0x56, 0x2F, 0xA5, 0x75, 0x32, 0xF3, 0x68, 0xFB, 0x42, 0x0A,
+    0xC5, 0xEE, 0x62, 0xB1, 0x65, 0xCA, 0x77, 0x86, 0x51, 0xF8, 0x69, 0xE8, 0x7D, 0xF0, 0x93, 0x0F,
+    0x75, 0x18, 0x42, 0xB5, 0x6B, 0xCA, 0xA5, 0x1E, 0x99, 0x2A, 0xC5, 0xAF, 0xB8, 0x88, 0x7B, 0x49,
+    0x7D, 0x13, 0x3A, 0x69, 0x71, 0xD2, 0x92, 0x99, 0xA7, 0x74, 0xE6, 0x4F, 0xFE, 0x34, 0x4D, 0xA7,
+    0xEB, 0xCF, 0xD9, 0x21, 0xA1, 0xF9, 0xC1, 0x61, 0xBF, 0xD5, 0x27, 0x4D, 0xA7, 0x00, 0x74, 0xF3,
+    0x7B, 0x6F, 0xD2, 0x8D, 0x5A, 0x18, 0x5E, 0x51, 0x44, 0x7F, 0xA2, 0x0D, 0x75, 0xCF, 0xED, 0x99,
+    0xB6, 0x4A, 0xB9, 0x96, 0x52, 0x85, 0x42, 0xA9, 0x42, 0x63, 0xA9, 0x52, 0x7D, 0x69, 0x5D, 0x0D,
+    0x9C, 0xA8, 0x76, 0xB7, 0xE1, 0x36, 0x17, 0x71, 0xB1, 0x8E, 0xB8, 0xD8, 0xAC, 0xD4, 0xAB, 0x5F,
+    0x68, 0x16, 0x1F, 0xF0, 0xA1, 0x9B, 0x8D, 0x7E, 0x72, 0xEE, 0xA3, 0x5D, 0x08, 0x6E, 0x96, 0x1B,
+    0xF9, 0x5A, 0xA7, 0xEE, 0x09, 0xA5, 0x34, 0x26, 0x45, 0xF7, 0x61, 0xBE, 0x4C, 0xF2, 0xB1, 0x06,
+    0x13, 0xE5, 0x41, 0x50, 0x6C, 0x16, 0x52, 0x7D, 0x71, 0x9B, 0x10, 0xD1, 0xFF, 0xED, 0xCE, 0x6C,
+    0xD9, 0x20, 0x18, 0xCC, 0x30, 0x86, 0x72, 0xFF, 0x63, 0xB5, 0x2F, 0xD2, 0x2C, 0x45, 0x9B, 0x1F,
+    0xA5, 0x4C, 0xCD, 0x66, 0xD4, 0xE8, 0x5A, 0x56, 0x1B, 0x5C, 0xA6, 0x86, 0x4D, 0xF8, 0x95, 0x87,
+    0x0B, 0x51, 0x4E, 0x5D, 0xC8, 0xB7, 0x42, 0xFF, 0x46, 0xA3, 0xB7, 0xB1, 0x8D, 0x96, 0xFA, 0xC8,
+    0xCE, 0x94, 0xF1, 0x4E, 0x2D, 0xD2, 0x9A, 0x49, 0xCA, 0xF4, 0xB6, 0x7A, 0x4D, 0xD5, 0xA8, 0x91,
+    0x1B, 0xDD, 0xC1, 0x33, 0xDC, 0x9F, 0x9B, 0x4A, 0x69, 0xC9, 0xA5, 0x88, 0xBE, 0x73, 0x3A, 0x93,
+    0x0F, 0x1F, 0x53, 0x9B, 0x2D, 0xC3, 0x92, 0xEF, 0x75, 0x8A, 0x51, 0x5B, 0xA3, 0x7E, 0xDF, 0x3E,
+    0x5B, 0x90, 0xFF, 0x3F, 0x89, 0xE5, 0xFF, 0x99, 0x75, 0x29, 0x67, 0xAF, 0xBE, 0x59, 0xC9, 0x5A,
+    0xB2, 0x35, 0x0F, 0xF5, 0xE2, 0x67, 0x7D, 0x4B, 0xCF, 0xA8, 0xDA, 0xCA, 0x70, 0x97, 0xEC, 0xE4,
+    0xA3, 0xA2, 0x50, 0xA4, 0x56, 0xE0, 0x09, 0x8D, 0x14, 0x7B, 0x52, 0x48, 0xBD, 0x43, 0x2C, 0xF5,
+    0x0E, 0x71, 0xD0, 0x07, 0xF0, 0x6F, 0x84, 0x4C, 0x1A, 0x4B, 0xED, 0x38, 0xCD, 0x34, 0xEB, 0x45,
+    0xA1, 0x56, 0xD7, 0x1E, 0x60, 0xA2, 0xF9, 0xCF, 0x3E, 0x9E, 0xD1, 0xC8, 0x66, 0xBE, 0x10, 0x3A,
+    0xBA, 0x94, 0xB6, 0x6F, 0x0F, 0x0E, 0x91, 0x34, 0x1E, 0x9A, 0x75, 0xA6, 0x3B, 0xE7, 0x97, 0x8B,
+    0x3A, 0x80, 0x70, 0x0E, 0x68, 0x87, 0xF9, 0x8C, 0x61, 0x6A, 0x3C, 0xFE, 0x98, 0x25, 0xCC, 0x9A,
+    0x3B, 0x7F, 0xC1, 0x78, 0x59, 0xD3, 0xD9, 0xA6, 0x5C, 0x51, 0x8C, 0x36, 0xA5, 0xBA, 0x62, 0xEB,
+    0x62, 0x4A, 0x30, 0x95, 0x16, 0x7F, 0x19, 0x67, 0xFE, 0xB5, 0x33, 0x8B, 0x8B, 0x4B, 0xDC, 0xB5,
+    0xC1, 0xB2, 0x74, 0x4D, 0xF2, 0x20, 0xF6, 0xA4, 0x9E, 0x67, 0x29, 0xE7, 0x7A, 0xEA, 0x46, 0xA0,
+    0x88, 0xD6, 0xB6, 0xC5, 0xB7, 0xFA, 0x1F, 0xBE, 0x0A, 0x55, 0xB0, 0x40, 0x5A, 0xB9, 0x69, 0x3C,
+    0x4F, 0xFE, 0xAD, 0x27, 0x77, 0xF2, 0x58, 0xEC, 0x16, 0x7D, 0x76, 0x53, 0x21, 0x6B, 0x7F, 0xD7,
+    0xCC, 0x58, 0xB2, 0xF8, 0x77, 0xBA, 0xA9, 0xDA, 0x18, 0x5E, 0x56, 0xA4, 0x5B, 0x9A, 0xD5, 0xAB,
+    0x2D, 0xA4, 0xBD, 0xB0, 0x02, 0xD2, 0xBE, 0x59, 0x6C, 0xAB, 0x3C, 0xCC, 0xE5, 0xBE, 0x12, 0xD7,
+    0x35, 0x56, 0x11, 0x3A, 0x4D, 0x6E, 0x83, 0xC1, 0x1A, 0x5C, 0x3F, 0x71, 0x28, 0x10, 0x8C, 0xF5,
+    0x0A, 0x68, 0x4C, 0x55, 0x3F, 0x3E, 0x40, 0xAE, 0xD6, 0xBF, 0xF1, 0xA7, 0xC9, 0x21, 0xB6, 0xB6,
+    0x42, 0x5A, 0x4A, 0x49, 0xB7, 0x87, 0x58, 0xED, 0x27, 0x8D, 0x2E, 0xBA, 0x0D, 0xF5, 0x65, 0x74,
+    0x11, 0xF5, 0x65, 0xAC, 0x23, 0xEA, 0xAB, 0xD8, 0xAC, 0xA8, 0xAF, 0x17, 0xBF, 0xA0, 0x69, 0x08,
+    0xD6, 0x35, 0x62, 0xF4, 0x01, 0x2F, 0xD1, 0x4D, 0x56, 0x92, 0x73, 0x8C, 0xDB, 0x0D, 0x7E, 0xAA,
+    0x6C, 0xF4, 0xF5, 0xE7, 0x52, 0x7B, 0xC0, 0x1D, 0x33, 0x7B, 0x57, 0xE7, 0xEE, 0x09, 0xE8, 0xA6,
+    0x21, 0x52, 0x45, 0xAF, 0x09, 0x7D, 0x45, 0x3B, 0xEE, 0x27, 0xBB, 0xE6, 0x4C, 0x7B, 0xB5, 0xD3,
+    0xA8, 0x1F, 0xA6, 0x42, 0xE1, 0x42, 0x36, 0xBA, 0x4F, 0xB2, 0xD1, 0x38, 0xDD, 0xA5, 0xE3, 0xED,
+    0x7E, 0x96, 0x6C, 0x74, 0xF2, 0xB3, 0x26, 0xC0, 0x3C, 0x8A, 0xB3, 0xBE, 0x5E, 0x77, 0x24, 0x06,
+    0xB2, 0xFD, 0x5C, 0x71, 0x72, 0xE7, 0x4E, 0xBA, 0x50, 0xB9, 0xD3, 0xA0, 0x71, 0xD0, 0x13, 0xFA,
+    0xA6, 0x76, 0xF4, 0xA5, 0xFD, 0x5D, 0xC8, 0x2D, 0x64, 0x6A, 0x46, 0xF2, 0xBD, 0x83, 0x62, 0xDB,
+    0xCF, 0x27, 0x80, 0x5A, 0x73, 0x58, 0x5C, 0xEC, 0x46, 0x5C, 0xF4, 0x33, 0xF5, 0xDA, 0x84, 0x5F,
+    0x6F, 0xD6, 0x3A, 0x3E, 0xED, 0x17, 0xA7, 0xCD, 0x2F, 0xE5, 0xA1, 0x72, 0x37, 0x5F, 0xA8, 0xDC,
+    0x19, 0x53, 0xEF, 0xF9, 0x0B, 0x11, 0x97, 0x66, 0xB9, 0x53, 0xCE, 0xB1, 0x9B, 0x2E, 0x8E, 0xCB,
+    0xDF, 0xE1, 0x17, 0x92, 0x29, 0x6A, 0x9D, 0x7D, 0xFF, 0x05, 0xEF, 0x06, 0xEA, 0xB1, 0x98, 0xA1,
+    0xD8, 0x78, 0x01, 0xF0, 0xB7, 0x87, 0x9E, 0x54, 0x9D, 0x7E, 0xC8, 0x2D, 0xDD, 0x25, 0x96, 0xF9,
+    0x0E, 0xEF, 0xED, 0xFE, 0x9F, 0xCA, 0x57, 0xD2, 0x7F, 0x0C, 0x5F, 0xE9, 0xBF, 0xD1, 0x5C, 0xE8,
+    0x4B, 0xAF, 0x6C, 0x70, 0xC3, 0x67, 0x67, 0x5D, 0x1C, 0xA3, 0x4A, 0xF8, 0xF1, 0x2C, 0x3E, 0x39,
+    0x84, 0x4B, 0x0C, 0x19, 0x20, 0x29, 0x82, 0x57, 0xA9, 0x77, 0x99, 0xE6, 0x33, 0xA5, 0xC2, 0x2F,
+    0xF0, 0xDE, 0x5B, 0xDA, 0x6F, 0x3D, 0xEB, 0x2F, 0x94, 0x0A, 0x43, 0xF7, 0x43, 0xFD, 0xF0, 0xB9,
+    0xB9, 0x6B, 0x35, 0xD5, 0xD3, 0x90, 0x69, 0xAC, 0xC7, 0xA7, 0x73, 0x8D, 0x4D, 0xFF, 0x8F, 0x0A,
+    0xF5, 0xEF, 0x3D, 0xCE, 0x80, 0x22, 0x11, 0x01, 0x52, 0xDD, 0x9E, 0x7A, 0x9C, 0xA4, 0x80, 0xDB,
+    0xAF, 0x6B, 0xA5, 0x8E, 0xF8, 0x48, 0x1D, 0xA9, 0x37, 0x9A, 0x88, 0x33, 0x69, 0xC4, 0x0D, 0xBF,
+    0x50, 0x5B, 0x31, 0x5F, 0x64, 0x08, 0x0C, 0x0B, 0x7A, 0xF3, 0xD3, 0x9A, 0xEB, 0xB3, 0x1E, 0xDD,
+    0xCA, 0x70, 0x47, 0x7F, 0xC6, 0x16, 0xAE, 0x9B, 0xA9, 0xEC, 0xF4, 0x4D, 0x2B, 0x7F, 0x7B, 0x45,
+    0x1B, 0x3C, 0xA1, 0x57, 0x53, 0x75, 0xFC, 0x27, 0xAC, 0x58, 0xB1, 0x8A, 0x90, 0x69, 0xB1, 0xCE,
+    0xBD, 0xB3, 0x5B, 0x9F, 0x68, 0x0B, 0x8D, 0xB5, 0x14, 0x0A, 0x2B, 0xD7, 0x28, 0x85, 0x7F, 0xEB,
+    0xC9, 0xAD, 0x12, 0x7E, 0x2E, 0x77, 0xB7, 0xD1, 0x4D, 0xC5, 0xEE, 0x22, 0xDD, 0x54, 0x6C, 0xB5,
+    0x7D, 0x69, 0x56, 0xBA, 0xA9, 0x8A, 0x7E, 0xA5, 0x5B, 0xBA, 0xE0, 0x17, 0xBC, 0x34, 0xF9, 0x40,
+    0x2D, 0xB5, 0xDD, 0x74, 0x54, 0xBC, 0x5C, 0xE9, 0x01, 0x74, 0x7F, 0x35, 0x8F, 0xA5, 0xD4, 0x82,
+    0x56, 0x9C, 0x46, 0xBF, 0x83, 0xDF, 0x4A, 0xF5, 0xE4, 0x9A, 0x8D, 0x40, 0x57, 0xEF, 0x80, 0xC9,
+    0x47, 0x38, 0x99, 0x83, 0xFE, 0x13, 0x73, 0x9C, 0x07, 0x49, 0xD2, 0xEB, 0x06, 0x6A, 0xE8, 0xCD,
+    0xD3, 0xE9, 0x53, 0x7A, 0xD5, 0x10, 0x41, 0x2B, 0xE5, 0xFD, 0xB2, 0x5A, 0x30, 0x86, 0x67, 0xBD,
+    0x9B, 0xEE, 0xC1, 0xE8, 0x77, 0xD0, 0x92, 0x6B, 0x65, 0xD8, 0x71, 0xDA, 0x7F, 0x96, 0x9A, 0x47,
+    0x76, 0xEC, 0x48, 0x69, 0xA5, 0x96, 0x96, 0x4C, 0x3F, 0x50, 0x70, 0x1B, 0x9A, 0x34, 0xE5, 0xFA,
+    0xD8, 0x4E, 0xB9, 0xFB, 0x40, 0xBD, 0xEA, 0x3B, 0xA7, 0xE1, 0xBB, 0x92, 0xF4, 0xA4, 0xA4, 0xA8,
+    0x1F, 0xDE, 0x1A, 0x7E, 0x2C, 0x32, 0x7D, 0x25, 0xE2, 0xA2, 0x5F, 0x18, 0xE6, 0x61, 0x2E, 0x95,
+    0xE9, 0x07, 0x17, 0xE5, 0xA0, 0xF3, 0xD5, 0x72, 0xD0, 0xA3, 0xF2, 0x82, 0x4C, 0x8F, 0x99, 0xB6,
+    0xC5, 0x1B, 0xD6, 0x94, 0x73, 0x6B, 0xCC, 0x41, 0x6F, 0xAD, 0x6D, 0xD2, 0xD8, 0x44, 0xD0, 0x77,
+    0xA6, 0x52, 0x30, 0x4C, 0x64, 0x9A, 0x8E, 0x66, 0xA6, 0x8D, 0xD5, 0xC7, 0x9B, 0xA8, 0x4D, 0x6F,
+    0x84, 0x34, 0x43, 0x0B, 0xEA, 0x98, 0x25, 0xAD, 0x16, 0xD3, 0x92, 0x1D, 0xFD, 0x08, 0x78, 0x6B,
+    0xDC, 0x51, 0x6D, 0xCE, 0xCA, 0x7E, 0xBF, 0x64, 0x46, 0xF5, 0xFB, 0xB6, 0xEF, 0xB7, 0xD4, 0x6E,
+    0x29, 0x05, 0x73, 0x29, 0x2C, 0x33, 0x9F, 0xE0, 0xE8, 0x05, 0x92, 0xA2, 0xF7, 0x94, 0x3B, 0x75,
+    0xF7, 0xD0, 0x8C, 0xBA, 0xAE, 0x91, 0x2A, 0x7A, 0xCD, 0x34, 0x5B, 0xA7, 0xC0, 0xB0, 0xFF, 0x43,
+    0x85, 0x4C, 0x1B, 0x43, 0x28, 0xF4, 0xCF, 0xE9, 0x42, 0x15, 0xA1, 0x0B, 0x75, 0x00, 0x1F, 0xFC,
+    0x04, 0x3E, 0x0C, 0x3D, 0xF8, 0x20, 0xC0, 0xFF, 0x38, 0x02, 0xFE, 0x27, 0x0B, 0xE0, 0x53, 0xFB,
+    0xF3, 0xF1, 0x1C, 0x23, 0x5A, 0xEE, 0xDD, 0xE4, 0x16, 0x2C, 0x5C, 0xB4, 0xA4, 0xD3, 0xFD, 0xBA,
+    0x1D, 0x92, 0x8F, 0xA9, 0xC6, 0xF9, 0x83, 0x09, 0x41, 0x34, 0xE6, 0xA2, 0x5B, 0x53, 0x50, 0xA5,
+    0xB7, 0xEF, 0xD0, 0xB2, 0x3E, 0x14, 0xF0, 0xEE, 0x11, 0x55, 0x5F, 0x62, 0x8D, 0x9D, 0x70, 0x09,
+    0xEE, 0x42, 0xDA, 0xB3, 0xD4, 0x45, 0xB1, 0xAD, 0xB4, 0xB7, 0x94, 0x6A, 0x49, 0x42, 0x00, 0x36,
+    0x5A, 0x4E, 0x89, 0xE0, 0xA3, 0xD9, 0xDC, 0x04, 0xB7, 0x9B, 0x0C, 0x6C, 0xA6, 0xC9, 0xDC, 0xC1,
+    0x26, 0xD2, 0x99, 0x2E, 0xEC, 0x58, 0xCB, 0x04, 0x0E, 0xAA, 0xCD, 0x14, 0xBC, 0x3F, 0x6A, 0x95,
+    0xE8, 0x5D, 0xD0, 0x68, 0xDD, 0x35, 0xBA, 0x90, 0x30, 0x88, 0x35, 0x75, 0x49, 0xD9, 0xA9, 0x4D,
+    0x9E, 0xA0, 0xCD, 0x0D, 0x83, 0x98, 0x52, 0x47, 0x8C, 0x70, 0x67, 0x77, 0x8D, 0x3E, 0xDD, 0xD7,
+    0x0A, 0x7A, 0x93, 0x4C, 0x8A, 0x59, 0xCA, 0x64, 0x8D, 0xDE, 0x40, 0xBB, 0x58, 0x25, 0xB4, 0xE8,
+    0x92, 0x62, 0xDA, 0xB9, 0x5C, 0xFC, 0x88, 0x4F, 0x5D, 0xF2, 0xDD, 0xB3, 0xE3, 0xCA, 0xA3, 0x3B,
+    0x52, 0x76, 0x5C, 0xF9, 0xE0, 0xE5, 0x11, 0x7B, 0x0F, 0xE4, 0x23, 0x01, 0x7C, 0x5B, 0x8D, 0x64,
+    0x3B, 0x4F, 0x43, 0xB9, 0x7F, 0x26, 0x1C, 0x49, 0x06, 0x3B, 0x7A, 0xB2, 0x3B, 0xCE, 0xBE, 0x21,
+    0x50, 0x2F, 0x8D, 0x42, 0xA6, 0x51, 0x1A, 0xAB, 0x3D, 0xFF, 0xBA, 0xF0, 0x17, 0x75, 0x00, 0x85,
+    0x92, 0xA6, 0x94, 0x35, 0x55, 0x3A, 0x4E, 0xF4, 0x3A, 0x9A, 0x9A, 0x07, 0x7E, 0x2E, 0xD5, 0xE6,
+    0x6A, 0xFD, 0x86, 0x8B, 0xB9, 0x02, 0x3E, 0x34, 0xC3, 0xCB, 0x93, 0x5E, 0x8A, 0x6A, 0x3E, 0x26,
+    0xBD, 0xA2, 0xCD, 0x69, 0x73, 0x0A, 0x5E, 0xA3, 0xD7, 0xE8, 0x57, 0x86, 0x8D, 0x6B, 0xF0, 0xF1,
+    0x70, 0x2E, 0x58, 0x35, 0x35, 0x34, 0x23, 0xBE, 0xBC, 0x78, 0x51, 0xC5, 0xE7, 0xAE, 0xE6, 0x09,
+    0x2E, 0x74, 0x38, 0xC3, 0x85, 0x0E, 0xE7, 0x05, 0xEA, 0xFE, 0x88, 0xDE, 0x7C, 0x1C, 0x06, 0x69,
+    0x39, 0x1A, 0x36, 0x65, 0x29, 0x69, 0x66, 0xA8, 0xFB, 0x77, 0x6C, 0xBB, 0x59, 0xB8, 0xAC, 0x89,
+    0x52, 0xA6, 0x57, 0x9C, 0x19, 0x3C, 0x5B, 0xEF, 0xB8, 0x0D, 0xB7, 0x53, 0x47, 0x9C, 0x52, 0xAE,
+    0xEF, 0x7C, 0x64, 0xD4, 0x11, 0xBF, 0xD0, 0xAD, 0x0C, 0xB7, 0x3F, 0x95, 0x74, 0x38, 0xFB, 0x0B,
+    0x96, 0xCB, 0x15, 0x32, 0xD8, 0xF5, 0xA1, 0xA7, 0xB4, 0xF3, 0x61, 0x34, 0xE2, 0x46, 0xA6, 0xD6,
+    0x36, 0x4F, 0x21, 0x53, 0x1E, 0x2F, 0xA4, 0x8D, 0xDF, 0xD6, 0x0F, 0x7B, 0xDC, 0x9D, 0x2F, 0xD3,
+    0x7D, 0xEF, 0x4F, 0xA9, 0xA4, 0x0D, 0x49, 0x8B, 0xDB, 0xFF, 0x58, 0x5F, 0x50, 0xEF, 0x62, 0xBD,
+    0x30, 0xBC, 0x24, 0xAA, 0xD8, 0x04, 0x86, 0x2F, 0x8A, 0x7A, 0x69, 0xB6, 0x4A, 0x48, 0x1A, 0x4B,
+    0x69, 0xB6, 0xEE, 0x04, 0x97, 0xB7, 0xD1, 0xB5, 0x41, 0xCF, 0xDA, 0x81, 0x18, 0xB8, 0xD4, 0xD7,
+    0x5B, 0x5C, 0xFF, 0x94, 0xAC, 0x63, 0x6A, 0x48, 0xF2, 0xF7, 0x4D, 0xEA, 0x53, 0x3C, 0xE2, 0x36,
+    0xEA, 0x48, 0xA6, 0xF1, 0x0B, 0x1A, 0x69, 0xE2, 0xE7, 0x9B, 0x95, 0x42, 0x2F, 0x7F, 0x5F, 0xE0,
+    0x57, 0xAF, 0x99, 0x42, 0x1F, 0xD1, 0x0A, 0xDD, 0x6E, 0x5D, 0x95, 0xAD, 0xA5, 0x80, 0xCD, 0xC9,
+    0x7E, 0xC3, 0x9B, 0xEE, 0xE9, 0x0A, 0x4D, 0xE4, 0xDD, 0x77, 0x35, 0x4A, 0xED, 0x01, 0x86, 0xDB,
+    0x16, 0xF8, 0xA4, 0xF4, 0x9F, 0xE5, 0x02, 0xF7, 0x0B, 0x84, 0xA5, 0x52, 0xDB, 0xCD, 0x0C, 0x7A,
+    0x46, 0x2B, 0xD2, 0x57, 0x14, 0xB9, 0xA5, 0x41, 0x1B, 0x99, 0x76, 0xB7, 0x93, 0x69, 0xAD, 0x76,
+    0x72, 0x85, 0x6A, 0xA7, 0xD0, 0x58, 0xED, 0x14, 0xEA, 0xAB, 0x8D, 0x52, 0xB8, 0x88, 0x79, 0xE6,
+    0xD5, 0xF6, 0x80, 0x5B, 0x71, 0xF1, 0xA9, 0x7A, 0xC1, 0xAD, 0x4F, 0xFB, 0x40, 0xBD, 0xF8, 0x6E,
+    0xA2, 0x59, 0x6A, 0xF5, 0xF8, 0xCD, 0xE9, 0x48, 0x50, 0x77, 0x56, 0x60, 0xFF, 0xBA, 0xB5, 0x40,
+    0xBA, 0xB1, 0x82, 0x46, 0x9E, 0x27, 0xD3, 0xC8, 0xE7, 0xC9, 0xD5, 0xF3, 0xBE, 0x14, 0x33, 0x96,
+    0x7A, 0xED, 0xEC, 0x7C, 0x19, 0x6B, 0xF0, 0x89, 0x0B, 0x49, 0xAD, 0x04, 0xF6, 0x98, 0x34, 0x88,
+    0x2D, 0xE0, 0x24, 0xBC, 0xED, 0x47, 0x1E, 0x39, 0x9D, 0x3E, 0x1D, 0x0F, 0x85, 0x1E, 0x63, 0xAC,
+    0x57, 0x4A, 0x2D, 0xA4, 0xFE, 0xE8, 0xD4, 0xDE, 0x33, 0x91, 0x7A, 0x67, 0x17, 0xD7, 0x3B, 0x13,
+    0xA9, 0x89, 0x86, 0xF3, 0x33, 0x49, 0x8E, 0xF7, 0x4A, 0xCF, 0xDF, 0x7F, 0x0E, 0xB6, 0x4B, 0x4A,
+    0x23, 0x26, 0xC2, 0xBD, 0x1D, 0x46, 0x27, 0x8B, 0xFC, 0xBE, 0x14, 0x73, 0xC9, 0x92, 0x8E, 0x7D,
+    0xFE, 0x75, 0x7D, 0x35, 0xAD, 0xD5, 0x52, 0x47, 0x48, 0x5C, 0xED, 0x97, 0x65, 0xCA, 0xEE, 0x25,
+    0x2A, 0xFE, 0x90, 0x0F, 0xF0, 0x4F, 0xBB, 0x90, 0x14, 0xFD, 0x53, 0x5A, 0xE6, 0xC0, 0xAA, 0x6D,
+    0xE9, 0xFE, 0x8C, 0xD4, 0x75, 0xFF, 0xD3, 0x53, 0xD7, 0x0F, 0xB6, 0x57, 0x3E, 0x70, 0xF6, 0x29,
+    0x7D, 0xE7, 0x06, 0x78, 0xC9, 0xAA, 0xC4, 0x35, 0xFD, 0xE7, 0x4F, 0x5D, 0x3F, 0x0C, 0xD7, 0x15,
+    0x49, 0xF5, 0x2A, 0xD1, 0xED, 0x9F, 0xD6, 0x63, 0x0B, 0xC3, 0xF4, 0x3E, 0x9A, 0xC0, 0x67, 0xEB,
+    0xC8, 0xE7, 0x9B, 0x0D, 0xA7, 0x8D, 0x4C, 0x91, 0x42, 0x0B, 0xA5, 0x22, 0xA5, 0x9E, 0xEB, 0x0B,
+    0x7D, 0x74, 0x46, 0xE3, 0x43, 0x7F, 0xD0, 0x05, 0x06, 0xA7, 0x4F, 0xEB, 0x19, 0x49, 0x63, 0x27,
+    0xF5, 0x85, 0xF6, 0x24, 0x33, 0x67, 0xA3, 0x51, 0xD8, 0xC2, 0x51, 0xEA, 0xE4, 0x68, 0xE4, 0x8C,
+    0x37, 0x4F, 0x6A, 0x69, 0x62, 0xEA, 0x1E, 0xEC, 0x02, 0x85, 0xFA, 0xD2, 0xB8, 0x19, 0x5F, 0x3D,
+    0x8C, 0xE2, 0x51, 0x47, 0xFB, 0xDE, 0x9B, 0x87, 0xC5, 0x23, 0xFD, 0xB6, 0xA4, 0x91, 0x26, 0x66,
+    0x5A, 0x71, 0xBB, 0xB5, 0x34, 0xEF, 0x73, 0x8D, 0x99, 0x26, 0xBA, 0xC0, 0x10, 0xA8, 0x23, 0x4D,
+    0xA4, 0x54, 0xCA, 0xDD, 0x14, 0x6A, 0x19, 0x42, 0xAE, 0x19, 0xBF, 0xD6, 0xD2, 0xE8, 0x36, 0x27,
+    0x85, 0x42, 0x85, 0xB4, 0xE6, 0x57, 0xEA, 0xD2, 0x67, 0x78, 0x17, 0x5D, 0x00, 0x37, 0x0D, 0x26,
+    0xF7, 0xB2, 0x90, 0x7A, 0xDD, 0x24, 0x0F, 0x23, 0x7B, 0xD1, 0xA4, 0xE9, 0xF4, 0x6F, 0x25, 0xED,
+    0x5E, 0xD2, 0xF4, 0x99, 0xED, 0xB4, 0xA1, 0xDE, 0x8D, 0xF5, 0x42, 0xCC, 0xC5, 0xBB, 0x4D, 0xC6,
+    0x70, 0x07, 0xBA, 0xB7, 0x6F, 0x5B, 0xB3, 0x73, 0x49, 0xC1, 0x6D, 0x9F, 0xD6, 0x17, 0xD4, 0xD7,
+    0xB1, 0x5E, 0x18, 0xBE, 0xA5, 0xB6, 0xDC, 0x7C, 0xA0, 0xFB, 0xB6, 0x28, 0xB7, 0x6E, 0xA6, 0xFB,
+    0xEB, 0x68, 0x4B, 0x77, 0x18, 0xED, 0x1C, 0xCD, 0xC5, 0x03, 0xF8, 0xB9, 0x98, 0x5D, 0xA4, 0xFB,
+    0x91, 0xA8, 0xA4, 0xD1, 0x6E, 0x62, 0x98, 0xE1, 0xFF, 0x03, 0xED, 0xBD, 0x4F, 0xAC, 0x25, 0x59,
+    0x7D, 0xE7, 0xF9, 0x89, 0x88, 0xCA, 0x0C, 0x20, 0xDA, 0x3E, 0xB5, 0xA8, 0x9C, 0x1E, 0x53, 0x34,
+    0x61, 0x69, 0x7A, 0xC1, 0x58, 0xD0, 0xD1, 0x0B, 0x16, 0xBD, 0x00, 0x9F, 0xA0, 0x4A, 0x2D, 0x16,
+    0x2C, 0x48, 0x69, 0xF2, 0x82, 0xBA, 0x6B, 0x81, 0x17, 0xDD, 0xD2, 0x38, 0x7B, 0xA6, 0xB3, 0x17,
+    0x5E, 0xA0, 0x19, 0x53, 0x11, 0x50, 0xD2, 0x30, 0x12, 0x0B, 0xB2, 0x25, 0x7A, 0x2C, 0x8D, 0x17,
+    0xA0, 0x51, 0x4D, 0x8B, 0x7A, 0x48, 0x53, 0xB5, 0xF0, 0x48, 0x3D, 0x3D, 0xAE, 0x17, 0xA7, 0x2A,
+    0xA5, 0xAE, 0x05, 0x0B, 0x02, 0x3C, 0x34, 0x0B, 0x16, 0x04, 0x36, 0x0C, 0x32, 0x68, 0x54, 0xC7,
+    0x26, 0x70, 0x45, 0x66, 0x9D, 0x88, 0xEF, 0x2C, 0xCE, 0x89, 0x7B, 0x6F, 0x66, 0x65, 0xF1, 0xC7,
+    0x06, 0xEC, 0xF6, 0xCC, 0xAD, 0xCA, 0xFB, 0xEE, 0x7B, 0x2F, 0xDE, 0xBD, 0x71, 0xCE, 0xF9, 0x9D,
+    0xDF, 0x9F, 0xEF, 0xEF, 0xFB, 0xFB, 0x1D, 0x38, 0x3D, 0xF2, 0x95, 0xEC, 0x70, 0x68, 0x19, 0x5A,
+    0x9A, 0x8D, 0x5A, 0xA2, 0x11, 0x68, 0x65, 0xD0, 0x9C, 0x6B, 0xA5, 0x50, 0x60, 0xD8, 0xDA, 0x46,
+    0x9E, 0xEA, 0xD5, 0x99, 0x6E, 0xCC, 0xF4, 0xAA, 0xE3, 0x91, 0xDA, 0xE7, 0x6A, 0xCD, 0xF2, 0x16,
+    0xA0, 0x71, 0x26, 0xA0, 0x16, 0xC0, 0xF6, 0xD6, 0x97, 0x0B, 0x00, 0x42, 0xBD, 0x75, 0x00, 0x79,
+    0x28, 0xD7, 0x22, 0x00, 0x50, 0xCE, 0xCD, 0x5C, 0x8F, 0x00, 0x98, 0x49, 0x6E, 0x8B, 0xB7, 0xD0,
+    0x49, 0xF2, 0x00, 0x14, 0x92, 0xE4, 0x00, 0xB0, 0x92, 0xE2, 0x9B, 0x16, 0x7A, 0x59, 0x85, 0x00,
+    0x68, 0x82, 0x09, 0x66, 0x05, 0xC8, 0x34, 0x5A, 0x5F, 0x2F, 0x00, 0xB5, 0x32, 0xF5, 0xD6, 0x03,
+    0x99, 0x7C, 0xB9, 0x32, 0x4C, 0x80, 0x51, 0xDB, 0xF8, 0x4C, 0x0E, 0x32, 0x2D, 0xC8, 0x15, 0xEA,
+    0xA1, 0x96, 0x2B, 0x36, 0x2A, 0xB5, 0xE4, 0x0A, 0xD4, 0x0B, 0x46, 0x60, 0xE5, 0x4A, 0x6D, 0x34,
+    0x6A, 0x0B, 0x05, 0x3A, 0x05, 0xAC, 0xDA, 0x42, 0x7D, 0x2E, 0x4D, 0x58, 0xC1, 0xF5, 0x78, 0x97,
+    0xF1, 0xC3, 0xE2, 0x0D, 0x8F, 0xFB, 0xAB, 0x4C, 0xC7, 0x1F, 0x96, 0xF3, 0xF1, 0x65, 0xE3, 0x8E,
+    0x2F, 0x2F, 0x8F, 0xAF, 0x0A, 0x7F, 0x7C, 0x79, 0xB5, 0x05, 0x1E, 0x05, 0x78, 0x04, 0x06, 0xCF,
+    0x4A, 0x1D, 0xE8, 0xE4, 0x1A, 0x57, 0xC9, 0xD7, 0x5A, 0x8B, 0x90, 0x4B, 0x85, 0x34, 0xD9, 0x7E,
+    0xD0, 0xD4, 0x7D, 0x50, 0xE5, 0x5C, 0xFB, 0x77, 0x17, 0xAE, 0xF1, 0x2A, 0x02, 0x90, 0xC9, 0xFA,
+    0x01, 0xA0, 0x7E, 0x7D, 0xAB, 0x27, 0x20, 0x93, 0xBE, 0x11, 0xE2, 0x5C, 0xAC, 0x72, 0x40, 0xAE,
+    0x41, 0x0B, 0x80, 0xFD, 0x13, 0xA9, 0x07, 0xCA, 0xD0, 0xBD, 0xBE, 0x00, 0xA8, 0x0A, 0x43, 0x0F,
+    0x34, 0xA3, 0x3E, 0x14, 0x32, 0xFF, 0xEE, 0x6A, 0x31, 0x7E, 0xF8, 0xF6, 0x50, 0x4A, 0xD9, 0x56,
+    0x4A, 0xD3, 0x20, 0xD7, 0x8C, 0x56, 0x6B, 0x25, 0x5F, 0x84, 0x5C, 0xAF, 0x8F, 0x76, 0xC1, 0xB6,
+    0x55, 0x78, 0x91, 0xEB, 0x64, 0x70, 0xC5, 0x4C, 0x69, 0x10, 0x69, 0xF1, 0x78, 0xC3, 0x0F, 0x9A,
+    0x34, 0x3B, 0x4D, 0x48, 0x03, 0xDF, 0x7F, 0x71, 0xE5, 0x38, 0x01, 0x6F, 0xD7, 0x04, 0x83, 0xD4,
+    0x33, 0x48, 0x01, 0x2B, 0xA9, 0x35, 0x73, 0x2E, 0x5F, 0x2E, 0xD8, 0x90, 0x05, 0x2A, 0xF1, 0x34,
+    0x85, 0xDC, 0x15, 0xD0, 0x04, 0x74, 0x1E, 0xB0, 0x33, 0x1C, 0x86, 0x19, 0xAC, 0x3C, 0xD4, 0x12,
+    0x54, 0x92, 0x87, 0x4C, 0x1B, 0x50, 0xC9, 0x01, 0xF2, 0x80, 0x5D, 0xF3, 0x9E, 0x4A, 0x85, 0xA7,
+    0xD0, 0x9D, 0x95, 0x4C, 0x93, 0xC6, 0x4C, 0xDE, 0xEA, 0x4B, 0xF2, 0x95, 0x24, 0xCF, 0x20, 0x4D,
+    0x5C, 0x95, 0x7A, 0xC8, 0x3A, 0x00, 0x33, 0x02, 0xC5, 0x0C, 0xF9, 0x07, 0x56, 0x40, 0x02, 0x3A,
+    0xB5, 0x60, 0xD4, 0x42, 0xF6, 0xDC, 0x71, 0x04, 0x8D, 0x7A, 0x1A, 0xA9, 0xAD, 0xA4, 0x90, 0xE9,
+    0x5F, 0xCB, 0xD5, 0x7D, 0xB5, 0x32, 0xD2, 0x39, 0xA8, 0x16, 0xC8, 0x05, 0xBF, 0x21, 0x47, 0x29,
+    0x0F, 0x9D, 0x46, 0xF2, 0xA7, 0x04, 0x34, 0x33, 0x64, 0xEA, 0x5F, 0xA0, 0x9E, 0x1B, 0x57, 0xA8,
+    0xD0, 0x07, 0x34, 0x59, 0x69, 0xC9, 0xA4, 0x8D, 0x52, 0x1B, 0x64, 0x5D, 0x0B, 0xF9, 0x0C, 0x8F,
+    0x36, 0x2D, 0xC5, 0x37, 0x66, 0xE8, 0x04, 0xA5, 0xC6, 0xF8, 0xC7, 0xF7, 0x3F, 0xAE, 0x1D, 0x0E,
+    0x94, 0x0B, 0x46, 0xF2, 0x85, 0x26, 0xA4, 0x0D, 0x89, 0x4A, 0x5B, 0x6B, 0x35, 0x51, 0xAA, 0x35,
+    0x0A, 0x30, 0xF8, 0x5C, 0x59, 0x8B, 0x11, 0x9D, 0x03, 0x34, 0x19, 0x0F, 0x98, 0x35, 0x5F, 0x81,
+    0x4C, 0xCE, 0xF6, 0x71, 0x53, 0x79, 0xA0, 0xD0, 0x4B, 0x6B, 0xDA, 0x78, 0x2E, 0x6E, 0xC5, 0x90,
+    0x36, 0xE7, 0x08, 0x54, 0x2A, 0x05, 0xA0, 0xC9, 0xCE, 0xF1, 0x2D, 0xD4, 0x43, 0xA6, 0xD1, 0x84,
+    0xB8, 0xD4, 0x9A, 0x20, 0x97, 0x2B, 0x05, 0xD8, 0x05, 0x1B, 0xA0, 0x50, 0x9B, 0x6B, 0x84, 0x61,
+    0xC6, 0x88, 0x4C, 0x0A, 0x0C, 0x01, 0x2B, 0xB9, 0x42, 0x73, 0x21, 0x2D, 0x98, 0xB4, 0xD9, 0xD3,
+    0xF8, 0xF6, 0xDD, 0xD4, 0x4C, 0xBB, 0x6A, 0x8A, 0xAA, 0x20, 0x5E, 0x54, 0xA4, 0x49, 0xB0, 0x49,
+    0x71, 0xDD, 0x06, 0xE0, 0xD1, 0xAB, 0xEA, 0x8B, 0xB5, 0x93, 0xAB, 0x35, 0xC8, 0x0D, 0xBA, 0xA9,
+    0x97, 0xB4, 0xA1, 0x4F, 0x6F, 0x6F, 0x41, 0x66, 0x26, 0x53, 0xE3, 0xC8, 0xB7, 0x0E, 0x8A, 0x75,
+    0x83, 0x42, 0x82, 0x52, 0x6A, 0xA9, 0xA4, 0x1E, 0x13, 0x3A, 0x87, 0x09, 0x76, 0xA2, 0x5E, 0x1A,
+    0xFF, 0x8E, 0x66, 0xA9, 0xC3, 0xD3, 0x76, 0x36, 0x5A, 0xED, 0x5C, 0x6A, 0xB5, 0xBE, 0xD0, 0xDA,
+    0x4D, 0x6C, 0x2B, 0xF0, 0xE8, 0x0A, 0x64, 0xDB, 0x7D, 0x4F, 0xC5, 0x0A, 0x34, 0x0B, 0x60, 0xA7,
+    0xFB, 0xE4, 0x9B, 0xEC, 0x70, 0xB8, 0x4E, 0x35, 0x63, 0xA4, 0x89, 0x6E, 0xC5, 0x48, 0x63, 0xA6,
+    0x8D, 0x4A, 0x1B, 0xA5, 0x56, 0xE8, 0x3C, 0x66, 0x0B, 0x30, 0x78, 0xEC, 0xF4, 0xEB, 0xA0, 0x89,
+    0xA1, 0x07, 0xF4, 0xB5, 0x4F, 0xC6, 0x79, 0x7E, 0xE5, 0x4E, 0xDC, 0xE9, 0x5F, 0xFE, 0xF4, 0x0C,
+    0xE4, 0xFA, 0xEC, 0x87, 0x27, 0xA0, 0xD0, 0x87, 0x6F, 0xA5, 0xD5, 0x51, 0x7F, 0xF6, 0xB5, 0x54,
+    0x27, 0x07, 0x54, 0xDB, 0x3F, 0xB0, 0x13, 0x60, 0xD6, 0xF7, 0x5B, 0x0F, 0x98, 0xF0, 0xBE, 0x66,
+    0x06, 0xEA, 0xF0, 0xBB, 0x75, 0x5C, 0xA8, 0x8F, 0x9B, 0x74, 0xD3, 0x95, 0xE2, 0x96, 0x2A, 0xD5,
+    0x83, 0xF5, 0x14, 0x72, 0x30, 0xCC, 0xE4, 0xF2, 0xD4, 0x52, 0x8F, 0x16, 0xAC, 0xD4, 0xD3, 0x09,
+    0x2B, 0xB5, 0xD4, 0x69, 0x39, 0xB2, 0x36, 0x0D, 0xF2, 0xF1, 0x0D, 0xEC, 0x2B, 0x0A, 0x94, 0x7A,
+    0x5E, 0x1E, 0xBB, 0xDE, 0x94, 0x2B, 0xE4, 0x8B, 0x8D, 0xE6, 0xAB, 0xAD, 0x59, 0x3E, 0xB0, 0x42,
+    0xF7, 0xCD, 0xCF, 0x3A, 0x72, 0xBD, 0xFF, 0x45, 0x30, 0xE1, 0xB5, 0x29, 0x49, 0x57, 0x26, 0x09,
+    0xAA, 0xF5, 0x7F, 0xDF, 0xC0, 0xFE, 0xF0, 0x4E, 0x00, 0x7D, 0xC5, 0xCC, 0x94, 0x7A, 0x57, 0xE3,
+    0xDF, 0xD5, 0x2C, 0x74, 0x7F, 0xEC, 0x35, 0x22, 0xDD, 0x11, 0xB9, 0x56, 0x13, 0x28, 0x34, 0x75,
+    0x23, 0x65, 0xD4, 0xFC, 0x67, 0xBB, 0xE0, 0xCA, 0xE1, 0xD0, 0x66, 0x43, 0x8B, 0xA2, 0xD9, 0x2A,
+    0xA4, 0xA5, 0xD0, 0x4A, 0xA5, 0x68, 0xB0, 0x32, 0x8D, 0x99, 0x5E, 0xED, 0xA9, 0x84, 0x99, 0xDF,
+    0xC2, 0x95, 0x6E, 0x6D, 0xD5, 0x42, 0x27, 0x95, 0x0B, 0x64, 0x52, 0xB0, 0x0E, 0xA8, 0x43, 0x1E,
+    0x00, 0x06, 0x5F, 0x8F, 0x40, 0x91, 0x0C, 0x93, 0x49, 0x56, 0x29, 0x6D, 0x88, 0x2C, 0xD9, 0xA3,
+    0x7D, 0x27, 0xD8, 0xC5, 0x04, 0x00, 0x8D, 0xCD, 0x02, 0x94, 0x6A, 0xAD, 0x3F, 0x6D, 0x05, 0x86,
+    0x68, 0x7D, 0x0A, 0xF5, 0x85, 0x7A, 0x30, 0x2B, 0x95, 0xDA, 0x7D, 0x2F, 0xD0, 0x1D, 0x6F, 0x38,
+    0x60, 0xD5, 0x1A, 0x69, 0xC2, 0x26, 0x03, 0x73, 0x0D, 0xB8, 0x72, 0x1B, 0xE8, 0x36, 0x60, 0x90,
+    0x03, 0xAB, 0x09, 0x30, 0xCB, 0x2E, 0x73, 0x71, 0xA3, 0x74, 0x0E, 0x8C, 0x94, 0xA9, 0x94, 0x5E,
+    0xD2, 0x57, 0xBF, 0xB4, 0xFD, 0x2F, 0x9A, 0x33, 0xE5, 0x0A, 0x0C, 0x2F, 0xE9, 0x1F, 0x63, 0xBF,
+    0xBD, 0x81, 0x99, 0x37, 0x28, 0xC3, 0x25, 0x71, 0x13, 0x20, 0x4D, 0x60, 0x15, 0xC0, 0x6C, 0x82,
+    0x72, 0xB3, 0x13, 0xB9, 0x3E, 0x14, 0x40, 0x4E, 0xFD, 0x17, 0xAC, 0xB7, 0x73, 0xA8, 0x43, 0x29,
+    0x55, 0x42, 0x7A, 0x52, 0x7D, 0xAD, 0x56, 0x2E, 0x57, 0x1B, 0x8D, 0xD5, 0x99, 0xFA, 0x39, 0xB4,
+    0x0C, 0x9F, 0x94, 0xA4, 0xB6, 0xD6, 0x67, 0x24, 0x85, 0x4C, 0xB2, 0x92, 0x7A, 0xA3, 0x45, 0xD7,
+    0x35, 0xA1, 0x57, 0xEF, 0x84, 0x42, 0x7D, 0x15, 0xDE, 0x5A, 0x8F, 0xF5, 0x4A, 0xE7, 0xE8, 0xE8,
+    0x7C, 0x11, 0x20, 0xE4, 0x72, 0x76, 0x84, 0xEB, 0x66, 0xCB, 0x37, 0x00, 0x3B, 0x9B, 0x68, 0xBF,
+    0x47, 0x01, 0x54, 0xD2, 0x0C, 0xD0, 0x48, 0x13, 0x80, 0x76, 0x95, 0xF4, 0xA4, 0x5A, 0xA0, 0x0E,
+    0xE5, 0x16, 0xD7, 0xCB, 0x04, 0xA0, 0x50, 0x6F, 0x17, 0xC0, 0x6C, 0x47, 0x33, 0xA1, 0x09, 0x32,
+    0xB9, 0x5C, 0x0E, 0x2A, 0x45, 0xD1, 0xEE, 0x02, 0x26, 0xA9, 0x6E, 0xA3, 0x36, 0x93, 0x56, 0x1A,
+    0xF5, 0x95, 0xE4, 0x69, 0xD6, 0xFB, 0x0D, 0x54, 0x5B, 0x49, 0x7D, 0xB5, 0x34, 0x52, 0xDB, 0x05,
+    0x2B, 0x65, 0x0A, 0x97, 0x4F, 0xA8, 0xD4, 0xB2, 0x15, 0x9B, 0x59, 0x1E, 0x55, 0xB1, 0xDA, 0x91,
+    0xE1, 0x83, 0x61, 0x68, 0xF9, 0xB5, 0x6A, 0x0D, 0x80, 0x79, 0x3D, 0x00, 0x46, 0x21, 0xDA, 0x60,
+    0xA0, 0xDE, 0xA2, 0xD6, 0x17, 0x60, 0x7D, 0xDC, 0x63, 0x83, 0xFB, 0x87, 0x74, 0x93, 0xFD, 0xB3,
+    0x85, 0x61, 0xB2, 0x9A, 0xD1, 0x58, 0xCB, 0x23, 0x57, 0xC9, 0x65, 0xEA, 0x93, 0x9D, 0xBC, 0x1E,
+    0xB5, 0xC7, 0x95, 0xC3, 0xE1, 0x3A, 0x92, 0x32, 0x69, 0xC3, 0x48, 0x53, 0x23, 0x39, 0x06, 0xCD,
+    0x0C, 0x9A, 0xA0, 0x9B, 0xA3, 0xA9, 0xAB, 0x04, 0x66, 0x4B, 0x76, 0x4F, 0x23, 0x18, 0x11, 0x77,
+    0xAA, 0x26, 0x72, 0xB9, 0xF8, 0x8D, 0x0D, 0x90, 0xCB, 0x51, 0xA8, 0x8F, 0xDF, 0x74, 0x73, 0x72,
+    0xB6, 0xB4, 0xBB, 0x5A, 0x1E, 0xCA, 0xFD, 0x07, 0xC3, 0x8F, 0x0E, 0x1F, 0xD1, 0xF4, 0x13, 0xDF,
+    0xCB, 0x45, 0x1B, 0x6F, 0x17, 0x28, 0xE4, 0x28, 0xD5, 0xC6, 0x6F, 0x06, 0x0F, 0x95, 0x7A, 0x6A,
+    0x5D, 0xA7, 0x96, 0x5C, 0x23, 0x8D, 0x85, 0x14, 0x4A, 0x69, 0xC5, 0x4A, 0x6E, 0xD8, 0x9D, 0x3C,
+    0x4C, 0xF2, 0x11, 0x50, 0x9F, 0x7E, 0xE0, 0x1F, 0x70, 0xAC, 0x92, 0xBB, 0x48, 0xBE, 0x5F, 0xD9,
+    0xA4, 0x2B, 0xF9, 0xC2, 0x2E, 0x8C, 0x8F, 0x8B, 0x72, 0x2D, 0xB5, 0xD2, 0x2C, 0x8D, 0x66, 0x34,
+    0xDE, 0x94, 0x2B, 0x44, 0x21, 0xEA, 0x80, 0x09, 0x0C, 0x13, 0xDD, 0x54, 0xA8, 0xCD, 0xD5, 0x9A,
+    0x80, 0x91, 0xE4, 0xB1, 0x92, 0xFA, 0x4C, 0xD2, 0x4A, 0xB5, 0x1D, 0x3A, 0x8F, 0x9D, 0x91, 0x43,
+    0xAE, 0xDC, 0x28, 0x45, 0xB3, 0xFC, 0xA3, 0x66, 0x41, 0x7F, 0xE2, 0x35, 0x16, 0xD2, 0x33, 0xC2,
+    0x68, 0x35, 0x01, 0xBB, 0xF9, 0x6E, 0xA4, 0xFB, 0x8A, 0x03, 0x1E, 0xEB, 0x00, 0xB2, 0xF5, 0xE4,
+    0xFB, 0x45, 0xC7, 0x47, 0xEC, 0x46, 0x21, 0x8B, 0x83, 0x3A, 0x2D, 0xE8, 0xE1, 0x06, 0x56, 0x72,
+    0xD1, 0xDF, 0x95, 0xB6, 0x5C, 0x92, 0xFA, 0x5C, 0x1A, 0x73, 0x49, 0xDB, 0xBE, 0xAA, 0xF5, 0xBC,
+    0x2F, 0x96, 0x75, 0x18, 0x81, 0x59, 0xD1, 0xBE, 0x6E, 0xC5, 0xB2, 0x2F, 0x47, 0x1D, 0xA7, 0xDC,
+    0x88, 0xC7, 0x4E, 0x0B, 0x01, 0x51, 0xEF, 0x71, 0xB6, 0xBE, 0x18, 0xE9, 0x64, 0xCD, 0xA3, 0x56,
+    0xCB, 0xF5, 0xF5, 0xC3, 0x53, 0xEA, 0x39, 0x5B, 0xE4, 0xE3, 0xDA, 0x91, 0x69, 0x8C, 0xCB, 0x1B,
+    0xC5, 0x4B, 0xBB, 0x37, 0xF7, 0x86, 0x0F, 0xE8, 0xA3, 0x15, 0xA1, 0xD9, 0xA0, 0x5B, 0x61, 0x5F,
+    0xEE, 0x9E, 0xA3, 0xE8, 0x52, 0x48, 0x61, 0xDF, 0xD0, 0xC9, 0xFD, 0x95, 0xCB, 0xA4, 0xB9, 0xD3,
+    0x98, 0x4B, 0xEB, 0xA0, 0xB1, 0x90, 0x74, 0x53, 0xAE, 0xD0, 0xC5, 0x86, 0x5C, 0x29, 0x36, 0xE4,
+    0xAA, 0xAD, 0x08, 0x99, 0x7A, 0xB3, 0xD6, 0x4B, 0xAE, 0xD6, 0x04, 0x33, 0x15, 0x71, 0x14, 0x85,
+    0xA4, 0x25, 0x4A, 0xEB, 0x4C, 0x5A, 0x3D, 0xCC, 0x8A, 0xF5, 0x60, 0x02, 0xDD, 0x04, 0x75, 0x60,
+    0x98, 0x7A, 0x9A, 0x05, 0x7D, 0x6F, 0xC2, 0xCE, 0x48, 0x13, 0xD6, 0x23, 0xB9, 0xF8, 0x05, 0xBA,
+    0x91, 0x6E, 0x3E, 0xED, 0xFA, 0xEC, 0x70, 0x38, 0x1C, 0x0E, 0x87, 0x7D, 0x37, 0x28, 0x44, 0xB5,
+    0x23, 0x69, 0x84, 0x5C, 0x92, 0x74, 0x17, 0xA0, 0xBB, 0x7B, 0x78, 0x4A, 0x10, 0xB7, 0x40, 0xF4,
+    0x70, 0x8D, 0x92, 0xD7, 0x89, 0x5D, 0xE2, 0x0E, 0x03, 0x8D, 0x69, 0x4E, 0x4B, 0xB5, 0x71, 0x4E,
+    0x69, 0x42, 0xDC, 0x43, 0x20, 0x8F, 0xD9, 0xDE, 0x7E, 0x3B, 0x4E, 0xA0, 0x95, 0x02, 0x98, 0x95,
+    0x28, 0x8C, 0x74, 0x9E, 0x4A, 0x52, 0xBC, 0xD8, 0x86, 0x4C, 0x31, 0x4A, 0xD1, 0x84, 0x7C, 0xFC,
+    0x80, 0x36, 0xD7, 0x98, 0x69, 0xA4, 0x0E, 0x14, 0xEA, 0x2B, 0xC1, 0xE0, 0x31, 0x1B, 0x4D, 0xA0,
+    0x90, 0xC3, 0x2E, 0x68, 0xC2, 0x6C, 0xA0, 0xA9, 0x50, 0x4F, 0x37, 0x53, 0xA8, 0x6F, 0x56, 0x72,
+    0x8D, 0x98, 0xB5, 0x96, 0xE8, 0x14, 0xE8, 0xBC, 0xB4, 0x16, 0x92, 0xCF, 0x75, 0x47, 0xF2, 0xB5,
+    0xD4, 0x9B, 0x75, 0x5F, 0xA1, 0x61, 0x8F, 0x55, 0x8A, 0x18, 0x82, 0xF1, 0x96, 0xA3, 0x75, 0x0A,
+    0x65, 0xDA, 0xBB, 0xA5, 0x94, 0x7E, 0x14, 0x17, 0x3C, 0x9A, 0xCA, 0x3D, 0x18, 0x78, 0xFC, 0x3B,
+    0xBB, 0x2E, 0x05, 0x6E, 0x2D, 0xB9, 0x7A, 0xE8, 0xF4, 0x92, 0x56, 0xA8, 0x14, 0x3A, 0x4D, 0x70,
+    0x53, 0xDF, 0x92, 0x00, 0xA3, 0x79, 0xF0, 0x90, 0x69, 0xAD, 0x36, 0xA0, 0x56, 0x1B, 0xE7, 0x7C,
+    0x32, 0xE1, 0x9F, 0xB4, 0xD8, 0x90, 0x49, 0x6A, 0x0B, 0xF5, 0xB5, 0xB4, 0xD2, 0xF9, 0x5C, 0x92,
+    0xAF, 0x36, 0xEC, 0x52, 0xA8, 0xD7, 0x58, 0x08, 0x13, 0x4C, 0xA0, 0xF3, 0xE8, 0x25, 0xB9, 0x6A,
+    0xA3, 0x5A, 0x9B, 0x85, 0x61, 0x62, 0xF8, 0x23, 0xB5, 0x66, 0xA5, 0x5A, 0xAD, 0x47, 0x8E, 0xE1,
+    0x8E, 0xA8, 0x03, 0x55, 0xE8, 0xC6, 0x5C, 0xED, 0xAE, 0x70, 0x4C, 0x94, 0x81, 0x3C, 0xA9, 0x1B,
+    0x3B, 0x01, 0x19, 0x55, 0x00, 0xF8, 0xC3, 0x68, 0xF6, 0xEA, 0x7B, 0x1A, 0xA3, 0xFD, 0x9F, 0x39,
+    0x2A, 0x79, 0xA8, 0xEF, 0x9E, 0xFB, 0xE3, 0x8F, 0x6F, 0x69, 0x2A, 0xE2, 0x5A, 0xEB, 0x4F, 0xE3,
+    0xA5, 0x63, 0x76, 0xD1, 0x52, 0x6A, 0xCA, 0xA5, 0x16, 0xCD, 0x48, 0x2B, 0x36, 0x60, 0x37, 0xF9,
+    0x4A, 0xAD, 0x59, 0x73, 0xB5, 0x9A, 0x32, 0xB5, 0xF5, 0xD2, 0xAC, 0x58, 0x9F, 0xE9, 0x19, 0xB9,
+    0x72, 0xC5, 0x2C, 0xDD, 0xC2, 0xE0, 0x32, 0x7D, 0x5A, 0xAD, 0x09, 0xD4, 0xCB, 0xE0, 0x91, 0xCB,
+    0xF5, 0x61, 0x61, 0x02, 0xD6, 0xCB, 0x23, 0x57, 0xC8, 0x08, 0x13, 0x18, 0xC6, 0xC1, 0x23, 0x67,
+    0x42, 0xA5, 0xD6, 0x84, 0x5C, 0x6D, 0xB7, 0xA0, 0xD1, 0xFA, 0x42, 0xAE, 0xDC, 0x4C, 0xC0, 0x6E,
+    0xD8, 0xD7, 0x04, 0x0A, 0x99, 0x34, 0x52, 0x69, 0x7B, 0x5E, 0x73, 0xE6, 0x1B, 0x49, 0xD2, 0x16,
+    0x55, 0x82, 0x1C, 0x9D, 0xEE, 0x0E, 0x1A, 0xE1, 0xCA, 0x75, 0xAE, 0xB5, 0xC0, 0xDB, 0x63, 0x3C,
+    0x09, 0xE4, 0xFA, 0x4E, 0x14, 0xEE, 0xDF, 0xA6, 0x50, 0x6B, 0xD5, 0x36, 0x73, 0x21, 0xB5, 0xEA,
+    0xED, 0x37, 0x54, 0x85, 0x3C, 0x94, 0xC1, 0x8E, 0x66, 0xAA, 0xFF, 0x4C, 0x0C, 0x6D, 0xF7, 0xE5,
+    0x50, 0x84, 0x4C, 0xD6, 0x1B, 0x5F, 0x2D, 0x72, 0xD6, 0xD9, 0x3F, 0x12, 0x42, 0x26, 0x14, 0xC1,
+    0xCC, 0xCD, 0x5C, 0x2D, 0x5D, 0xDF, 0xF9, 0xFA, 0xB5, 0x80, 0x7C, 0x93, 0x34, 0xF0, 0xDF, 0xFD,
+    0xA4, 0x24, 0xAD, 0x0C, 0x7A, 0x5E, 0x23, 0x57, 0xDA, 0xEC, 0xFA, 0xC9, 0x8F, 0x1E, 0xB6, 0x16,
+    0x6A, 0x69, 0x21, 0x93, 0xB4, 0x51, 0x29, 0x1A, 0xEE, 0xEF, 0xFC, 0xDD, 0xC0, 0xB0, 0x52, 0x84,
+    0x4C, 0x9E, 0x22, 0x14, 0x72, 0x14, 0x73, 0xA5, 0x96, 0x72, 0x4A, 0xFA, 0x2A, 0xAA, 0xB4, 0x70,
+    0x7A, 0xEE, 0x16, 0x80, 0xE1, 0xCD, 0x9E, 0xC3, 0xFE, 0x9C, 0xF5, 0x9D, 0xA0, 0x74, 0x56, 0x0E,
+    0xEB, 0x1A, 0xDD, 0x7D, 0x4A, 0xCE, 0x48, 0x52, 0x5B, 0xC6, 0x2D, 0x1A, 0x55, 0xE8, 0xE3, 0xDA,
+    0xDA, 0x63, 0xAC, 0x5F, 0x9F, 0x9E, 0x7F, 0xBD, 0x71, 0x40, 0xA7, 0x1E, 0x18, 0xA2, 0x9F, 0x16,
+    0x00, 0xDE, 0x1E, 0xE3, 0x95, 0x0C, 0xB2, 0x61, 0xA1, 0xD2, 0x86, 0x95, 0x90, 0xB6, 0x42, 0xFD,
+    0x1F, 0x56, 0x1B, 0x8F, 0x99, 0x10, 0x03, 0x21, 0xEB, 0x63, 0xBC, 0x3B, 0x4C, 0xF1, 0x9F, 0xE2,
+    0xBF, 0x47, 0xE5, 0x99, 0x87, 0xE5, 0xF1, 0xA5, 0x93, 0xBC, 0x95, 0xC6, 0x5A, 0x6A, 0x4B, 0xCD,
+    0x60, 0x5B, 0x68, 0x5A, 0x1E, 0x6D, 0x5A, 0xDE, 0xDF, 0xB5, 0x74, 0x8A, 0xCA, 0x78, 0x0F, 0x1A,
+    0xAF, 0x1C, 0x0E, 0x87, 0xC3, 0x21, 0x1A, 0xF7, 0x3F, 0x96, 0x24, 0xCD, 0x51, 0xC5, 0xD9, 0xEF,
+    0xDE, 0x5A, 0x3F, 0x22, 0xE3, 0x2B, 0x61, 0x5F, 0x59, 0x0A, 0xB9, 0xFA, 0xDB, 0x01, 0x4D, 0xE5,
+    0x6C, 0xE9, 0xE6, 0x7C, 0xC9, 0xDA, 0x3A, 0xF0, 0x18, 0x49, 0xC5, 0x17, 0x49, 0x77, 0x4D, 0x40,
+    0xD2, 0x9C, 0x27, 0xF5, 0xF7, 0x53, 0xFC, 0x7A, 0x57, 0x8B, 0xC0, 0x70, 0xF7, 0xA8, 0x3E, 0x0A,
+    0x49, 0xD1, 0xB5, 0xEE, 0x01, 0x86, 0x11, 0xA0, 0xF1, 0xEC, 0xDE, 0x2E, 0x09, 0x38, 0x8A, 0xBB,
+    0xCB, 0xB6, 0x00, 0xC6, 0x9D, 0x85, 0x7F, 0x11, 0x44, 0xB9, 0xAA, 0xB6, 0xF1, 0xB9, 0xDA, 0x4E,
+    0x2F, 0x69, 0x31, 0x72, 0x83, 0x5E, 0x51, 0xE8, 0x34, 0xDE, 0xD4, 0xE7, 0xB5, 0x4A, 0x13, 0x1A,
+    0x3E, 0xAC, 0x79, 0x98, 0x32, 0x05, 0xA3, 0x71, 0x18, 0x33, 0xCD, 0x26, 0xFA, 0xB5, 0x53, 0x2D,
+    0xE4, 0x0A, 0xB9, 0x26, 0x64, 0xEA, 0x0B, 0xB5, 0x76, 0xC9, 0xD5, 0x96, 0xC2, 0xFA, 0x42, 0x54,
+    0x1B, 0x9D, 0x2F, 0x84, 0x59, 0x19, 0xC6, 0x72, 0xC3, 0x04, 0xE4, 0xAA, 0x95, 0x3A, 0x20, 0x67,
+    0xC2, 0x7B, 0x9A, 0x25, 0x53, 0x6F, 0x42, 0x67, 0xE7, 0x5C, 0x7D, 0xAD, 0xD5, 0xFA, 0x5C, 0x6D,
+    0xAD, 0x60, 0x7D, 0x21, 0xCC, 0xB6, 0x74, 0x63, 0xB1, 0x52, 0xDD, 0x4D, 0x7A, 0xF2, 0x89, 0x1D,
+    0x10, 0x79, 0x93, 0xAF, 0x09, 0x39, 0x8B, 0x5E, 0x2C, 0x30, 0xB8, 0x3D, 0x20, 0xB8, 0x76, 0x38,
+    0x70, 0x38, 0x7C, 0x48, 0x9A, 0xAC, 0xD6, 0xA8, 0xB7, 0x5F, 0xD6, 0x46, 0xA5, 0xA9, 0x12, 0xD8,
+    0x09, 0x3B, 0x63, 0x02, 0x85, 0x5C, 0x2E, 0xA8, 0x03, 0xDD, 0x08, 0x1A, 0xCD, 0x02, 0x95, 0x72,
+    0x01, 0x9D, 0xEF, 0x46, 0x28, 0xF4, 0xE1, 0x05, 0x68, 0xB6, 0x18, 0x63, 0xCA, 0x45, 0xF5, 0xCB,
+    0x1E, 0x6C, 0xEC, 0xCB, 0x18, 0x95, 0x7D, 0x19, 0x95, 0x7F, 0x34, 0x06, 0x71, 0x1D, 0xD3, 0x02,
+    0x47, 0xDB, 0x96, 0x6B, 0x8A, 0x0B, 0xE9, 0xA3, 0xB1, 0x8C, 0xF6, 0x7F, 0x3A, 0x9A, 0xF9, 0x8D,
+    0x66, 0xB6, 0xEA, 0x6D, 0xE8, 0xE4, 0xEA, 0xF5, 0x5F, 0xC8, 0x99, 0x15, 0x8D, 0x26, 0x30, 0x4C,
+    0x26, 0xD0, 0x79, 0xB3, 0x60, 0xBD, 0x99, 0xB1, 0xBE, 0xF6, 0x34, 0xDE, 0x8E, 0x34, 0xDE, 0x3A,
+    0x6A, 0x3F, 0x40, 0xFD, 0x67, 0x1B, 0x98, 0xD7, 0x02, 0x18, 0x79, 0x30, 0xD1, 0xB5, 0xED, 0x93,
+    0xB3, 0x6B, 0xC2, 0xAE, 0xBA, 0x6B, 0xBF, 0x0B, 0x8C, 0xF5, 0xBB, 0xFE, 0xB6, 0x63, 0x12, 0xA5,
+    0x5A, 0x1B, 0x58, 0x6D, 0xF0, 0x1B, 0x17, 0x5F, 0xE4, 0x97, 0x30, 0x8B, 0xD7, 0x06, 0xDD, 0x88,
+    0x9E, 0xC9, 0x48, 0x84, 0xB6, 0x88, 0x61, 0xDF, 0xDF, 0xB8, 0x59, 0x14, 0x18, 0x29, 0x50, 0x4B,
+    0x01, 0xEA, 0xF9, 0xA7, 0x9F, 0xC5, 0xE4, 0xCC, 0xDE, 0xA0, 0x92, 0x26, 0xAB, 0x80, 0x91, 0x46,
+    0xAB, 0x40, 0xAE, 0x8D, 0x4A, 0x23, 0xD8, 0x40, 0x15, 0x43, 0xA0, 0x08, 0x9A, 0x1A, 0xD1, 0xC5,
+    0x31, 0xB6, 0x09, 0xB4, 0xB8, 0xA3, 0xE8, 0xE3, 0x7F, 0x2B, 0x4A, 0xFE, 0x0E, 0xFF, 0x76, 0x47,
+    0xEC, 0x37, 0x39, 0x16, 0x3B, 0x00, 0x94, 0xBE, 0x3F, 0x02, 0xC2, 0x51, 0x5B, 0x98, 0x2D, 0x5E,
+    0xDF, 0xF8, 0x38, 0x5D, 0x83, 0x1B, 0xA2, 0x6B, 0xDB, 0xDA, 0x05, 0x28, 0xD7, 0xA8, 0x82, 0xEA,
+    0x25, 0x0A, 0x4D, 0xE7, 0x31, 0x6A, 0xA9, 0xB4, 0x31, 0x68, 0xA5, 0x91, 0x9E, 0x90, 0x84, 0x95,
+    0x0A, 0x29, 0x61, 0x94, 0x45, 0xFA, 0xC4, 0xF2, 0x81, 0x2D, 0xB9, 0x83, 0xBB, 0x55, 0xDA, 0x9A,
+    0x55, 0x8A, 0x4A, 0x8C, 0x3B, 0x43, 0x74, 0x77, 0x6C, 0xB8, 0x1B, 0x6B, 0xB9, 0x4A, 0x4E, 0x6A,
+    0x07, 0x15, 0x52, 0xA9, 0x19, 0x13, 0xEC, 0x57, 0x7B, 0x9A, 0x7B, 0x01, 0xB0, 0x72, 0xC0, 0xB0,
+    0xB2, 0xC3, 0x95, 0xD1, 0xCB, 0xAA, 0xB6, 0xA3, 0xB1, 0x28, 0xB4, 0x90, 0x60, 0xCE, 0x3C, 0x68,
+    0x7C, 0xE1, 0x3D, 0xDD, 0xB7, 0xF5, 0x95, 0x51, 0xF1, 0xCD, 0x7C, 0xA5, 0x50, 0xAB, 0xAD, 0xE5,
+    0xED, 0x4C, 0xF3, 0xAA, 0x7B, 0x0C, 0x1E, 0x19, 0x4E, 0x21, 0x52, 0xBC, 0x45, 0xEB, 0x8E, 0x41,
+    0xD4, 0xAD, 0x08, 0x20, 0xB5, 0x40, 0x76, 0x1D, 0x0E, 0x87, 0xC3, 0x81, 0xC3, 0xE1, 0xBA, 0x91,
+    0x14, 0x8C, 0xE4, 0xAC, 0x24, 0xDF, 0x69, 0xCD, 0x24, 0xC9, 0x0D, 0xBA, 0x5D, 0xF9, 0x6E, 0xDA,
+    0xE8, 0x3C, 0xF6, 0x65, 0x3D, 0x39, 0xE7, 0x72, 0x6C, 0x66, 0x35, 0xAE, 0x12, 0x85, 0xB7, 0xFE,
+    0x37, 0xB1, 0x0B, 0x57, 0x3F, 0x29, 0x37, 0xA1, 0x11, 0xCA, 0x0D, 0xCA, 0x1D, 0xE0, 0x6C, 0x02,
+    0x20, 0x17, 0x05, 0xBC, 0x50, 0x1A, 0x59, 0x1D, 0x1D, 0xDC, 0x68, 0xCD, 0x3A, 0x1F, 0x7F, 0x9A,
+    0xCB, 0xC5, 0x7D, 0x6C, 0xB6, 0x24, 0x76, 0x36, 0x22, 0xA4, 0x64, 0x72, 0x71, 0x32, 0xCA, 0x84,
+    0x50, 0xBD, 0xC9, 0xDB, 0x36, 0xDB, 0x73, 0x1F, 0x79, 0x7E, 0x6B, 0xA9, 0xA3, 0x9F, 0x3E, 0x25,
+    0x7F, 0x5D, 0x7D, 0x34, 0x75, 0xDA, 0xBD, 0xD9, 0x66, 0x77, 0x66, 0xF7, 0xA0, 0x73, 0x5F, 0xE4,
+    0x63, 0xB0, 0x89, 0xDD, 0x63, 0xCA, 0x3D, 0xC8, 0x2C, 0xF7, 0xDF, 0xBC, 0xAD, 0x8D, 0x70, 0xC7,
+    0x75, 0x28, 0xA4, 0x85, 0x88, 0xE8, 0xD1, 0x49, 0xC0, 0xB5, 0xC3, 0x0D, 0xDE, 0xF0, 0xC8, 0xE5,
+    0xE8, 0xC6, 0x41, 0xAE, 0x54, 0x21, 0xD1, 0x2C, 0x6F, 0x7B, 0x3E, 0xA0, 0x91, 0x6E, 0x2A, 0x44,
+    0x0A, 0x41, 0x03, 0xDD, 0x84, 0xF5, 0xB9, 0xDA, 0x4C, 0xBD, 0x09, 0x54, 0x2B, 0x9D, 0xC7, 0xFA,
+    0x42, 0x0E, 0xF5, 0xF5, 0x46, 0xB5, 0xA2, 0x19, 0xEB, 0x2B, 0x8D, 0xC8, 0x5D, 0xAA, 0x7A, 0x52,
+    0xD5, 0x0F, 0xD7, 0xAE, 0x96, 0x6A, 0xCD, 0x56, 0xB3, 0x95, 0x93, 0xD0, 0x25, 0x9A, 0xF2, 0xBB,
+    0x0B, 0x8F, 0x91, 0x9D, 0x2D, 0x7B, 0x0C, 0x41, 0xA3, 0x55, 0xA9, 0xE3, 0xC6, 0x3B, 0xCD, 0xC3,
+    0x35, 0xAE, 0x1D, 0x0E, 0xD9, 0xE1, 0x70, 0x5D, 0x5A, 0x6B, 0xE9, 0x1B, 0x92, 0x1F, 0xA4, 0x4A,
+    0x5B, 0x36, 0x68, 0xCA, 0x63, 0xFC, 0x60, 0x36, 0x32, 0x8D, 0xD8, 0x99, 0x4A, 0x64, 0x1A, 0x69,
+    0x02, 0x55, 0x8C, 0x72, 0x9A, 0x40, 0xA1, 0x1E, 0x79, 0xEA, 0x95, 0x42, 0x8E, 0xC1, 0x53, 0xC9,
+    0x15, 0x72, 0xD4, 0xBA, 0x17, 0x35, 0x85, 0xB4, 0xC4, 0x2F, 0x23, 0xD4, 0x29, 0x04, 0x4D, 0x3E,
+    0x58, 0xD2, 0x7C, 0xC9, 0xB2, 0xD4, 0xE1, 0x2C, 0xDA, 0x48, 0xA6, 0xA7, 0x8E, 0x3E, 0xF7, 0x51,
+    0x1D, 0xBA, 0xA8, 0x4F, 0xCF, 0x53, 0x30, 0x9D, 0x3B, 0x43, 0x08, 0xAA, 0xF9, 0x3C, 0xE5, 0xB2,
+    0x9D, 0xA7, 0x5A, 0xAE, 0xEE, 0xAB, 0xCA, 0xAD, 0x99, 0xC6, 0x77, 0xEA, 0xAB, 0xAD, 0xD2, 0x82,
+    0xC6, 0x9B, 0xD1, 0xAD, 0xF6, 0x99, 0xFA, 0x5C, 0x34, 0x33, 0x76, 0x2A, 0xD4, 0x16, 0x1B, 0xD6,
+    0x63, 0x27, 0x23, 0x0A, 0x95, 0x9A, 0xB0, 0xD2, 0x4A, 0x2E, 0xC9, 0x51, 0xE9, 0xC3, 0xE1, 0x18,
+    0xD2, 0x37, 0xCB, 0xEF, 0x40, 0xAE, 0xCF, 0x3B, 0xB0, 0xC9, 0x8B, 0x01, 0xEC, 0xE6, 0x21, 0xDB,
+    0x2C, 0xEC, 0xAB, 0x31, 0x9C, 0xF6, 0x63, 0x4C, 0xD7, 0x78, 0xE0, 0xF1, 0x08, 0xE0, 0xB5, 0xC0,
+    0x95, 0x36, 0x2D, 0xC6, 0x0D, 0x69, 0x35, 0xD2, 0xF7, 0x24, 0xDF, 0x49, 0x1F, 0xD2, 0xC6, 0xBE,
+    0x18, 0x21, 0x46, 0x72, 0x1E, 0x3B, 0x53, 0xA8, 0xCF, 0x62, 0x60, 0x99, 0x82, 0xBE, 0x26, 0x98,
+    0x67, 0xE4, 0x90, 0xFF, 0x84, 0xD9, 0x28, 0xF4, 0xB2, 0xB7, 0x33, 0x95, 0x3E, 0xF3, 0x92, 0x46,
+    0x6A, 0xE9, 0x79, 0xC5, 0x55, 0x08, 0xF1, 0xCB, 0x14, 0x17, 0xA3, 0x05, 0x42, 0x13, 0x80, 0x62,
+    0x1A, 0x3C, 0x60, 0x9E, 0x91, 0x03, 0x3E, 0x61, 0x36, 0x80, 0xEB, 0xD1, 0x77, 0xCB, 0xCF, 0x17,
+    0xA3, 0x8A, 0xE6, 0x68, 0x90, 0x7A, 0x28, 0x4E, 0x1B, 0x8B, 0x5B, 0x33, 0xF5, 0xDC, 0xA9, 0x2F,
+    0x55, 0x69, 0x66, 0x98, 0x6E, 0xAA, 0x35, 0x2B, 0x75, 0x8C, 0x55, 0x30, 0x01, 0x3B, 0x65, 0xEA,
+    0x8B, 0xF5, 0x3D, 0xCD, 0x8C, 0xFD, 0xA3, 0x3B, 0xA2, 0xD8, 0xDE, 0x37, 0x44, 0xEC, 0x85, 0x5C,
+    0xD2, 0x44, 0xA5, 0x6F, 0xAE, 0xC0, 0x2C, 0x07, 0xC6, 0x84, 0xC7, 0xE0, 0xCF, 0xF4, 0x65, 0xC7,
+    0x95, 0x5A, 0x01, 0x72, 0xC5, 0xA4, 0xDD, 0xB4, 0xCB, 0x4D, 0x96, 0xA0, 0x94, 0x13, 0x28, 0x1B,
+    0x15, 0x77, 0x16, 0x73, 0x14, 0xD8, 0x39, 0x0A, 0x86, 0x83, 0xDD, 0x6D, 0xDD, 0xE3, 0xD6, 0x78,
+    0xC1, 0x51, 0xEE, 0x6E, 0xDD, 0x8D, 0x03, 0x52, 0x1B, 0x61, 0x92, 0x36, 0x62, 0x24, 0xD0, 0xDD,
+    0xA5, 0x8B, 0xB1, 0xF7, 0xE0, 0x63, 0xD6, 0xC2, 0x61, 0x23, 0x58, 0x1E, 0xF7, 0x41, 0x19, 0x83,
+    0xF1, 0x26, 0x50, 0xA8, 0x3D, 0xEE, 0x83, 0x9E, 0xC1, 0x53, 0x6F, 0x14, 0x72, 0x95, 0xF4, 0x49,
+    0xC9, 0x4B, 0x32, 0xD2, 0x1F, 0x49, 0x73, 0xD4, 0x15, 0xD7, 0x21, 0x5A, 0xC7, 0x22, 0xA5, 0x96,
+    0x3C, 0x64, 0x1F, 0xDB, 0x8E, 0xF7, 0x66, 0xC2, 0xF1, 0xD6, 0x9B, 0x19, 0x28, 0xC4, 0x23, 0x60,
+    0x7D, 0xBD, 0x50, 0x6E, 0x46, 0x13, 0xDD, 0x1F, 0x49, 0x54, 0x41, 0xF2, 0x68, 0x78, 0x46, 0x18,
+    0x8D, 0xD6, 0x67, 0x5A, 0xCA, 0x8D, 0x46, 0x0C, 0x63, 0xA1, 0xD1, 0x04, 0x6C, 0x40, 0xAE, 0x54,
+    0x5B, 0x2F, 0x0C, 0xC9, 0x83, 0xB5, 0x1E, 0x25, 0xE7, 0x75, 0x18, 0x3F, 0x29, 0x57, 0xAD, 0x4F,
+    0x37, 0x0B, 0xD2, 0x9F, 0xA8, 0x35, 0x0A, 0xD6, 0x23, 0x95, 0x5B, 0x9A, 0x9A, 0x2B, 0xF7, 0xA9,
+    0xB2, 0x6C, 0x98, 0x23, 0x5E, 0xA3, 0x68, 0x42, 0xA2, 0x1C, 0x48, 0x12, 0xD7, 0xB0, 0x5B, 0xA6,
+    0xA5, 0xF2, 0x46, 0x14, 0xBA, 0x13, 0x0A, 0x39, 0x6C, 0xE8, 0x5C, 0xE7, 0xC9, 0xF5, 0xE5, 0xC5,
+    0x6C, 0xD0, 0x84, 0xE1, 0x53, 0x72, 0x14, 0xFA, 0x74, 0xB0, 0x0B, 0xD8, 0xD9, 0xBE, 0xAE, 0x7F,
+    0x73, 0x78, 0x4A, 0x11, 0x4D, 0x89, 0x89, 0xB8, 0x3D, 0xA4, 0x93, 0xDC, 0xEE, 0x1B, 0x25, 0x2C,
+    0xE5, 0xA1, 0xDF, 0xFE, 0x43, 0xD0, 0x02, 0x75, 0x4F, 0xA5, 0x91, 0x6A, 0x01, 0xAB, 0xFE, 0x71,
+    0xB5, 0x11, 0xA1, 0x99, 0x22, 0xD2, 0xB5, 0x44, 0x48, 0x22, 0x00, 0xDC, 0x8A, 0xA8, 0x0D, 0x57,
+    0xF6, 0x90, 0xF2, 0x51, 0x20, 0xD7, 0x0C, 0x99, 0xE4, 0x60, 0xD0, 0x06, 0xCD, 0xDC, 0x4D, 0x94,
+    0xA1, 0xD8, 0xAE, 0xF6, 0xC2, 0x7E, 0x6D, 0x69, 0xA6, 0x2A, 0xD8, 0x62, 0xCD, 0xF4, 0x41, 0x3F,
+    0xB8, 0x61, 0xEA, 0xCC, 0xD2, 0xCD, 0xC5, 0x2A, 0x05, 0x1A, 0x69, 0x85, 0x41, 0x77, 0x81, 0x5B,
+    0x0B, 0x05, 0x99, 0xFA, 0x6C, 0xC6, 0xAC, 0x99, 0xDA, 0x18, 0x16, 0x96, 0x52, 0x80, 0x46, 0x1B,
+    0x30, 0x6C, 0x00, 0x8F, 0xFD, 0x2D, 0x98, 0xD2, 0xF9, 0xBE, 0x29, 0x4D, 0x5A, 0x38, 0xBA, 0xA8,
+    0x65, 0xD2, 0x06, 0x9D, 0xBB, 0x3F, 0x86, 0xB9, 0xDF, 0x5F, 0x4A, 0x69, 0xF0, 0xD2, 0x3D, 0x60,
+    0x2C, 0x7F, 0xF9, 0xCB, 0x71, 0xA6, 0x93, 0x2F, 0x01, 0xAA, 0x09, 0xE0, 0x45, 0x80, 0xCA, 0x01,
+    0xFC, 0xE1, 0x31, 0xC7, 0x95, 0x1D, 0x0E, 0xD7, 0xA3, 0xA2, 0x91, 0x94, 0x94, 0x8C, 0x5D, 0x22,
+    0x3C, 0x9A, 0xD2, 0x67, 0x21, 0xA9, 0xA6, 0x72, 0xF7, 0x73, 0x18, 0x7C, 0x32, 0x65, 0xD1, 0xE7,
+    0x9C, 0x93, 0x2E, 0x35, 0x6F, 0xBC, 0x3C, 0x7A, 0x35, 0x3E, 0x05, 0xC7, 0xF5, 0x06, 0x95, 0x34,
+    0x12, 0xD1, 0x2E, 0x05, 0x1E, 0xF2, 0x78, 0xD7, 0xEE, 0xB8, 0xF4, 0xD9, 0xD1, 0xA9, 0x39, 0xFA,
+    0xA0, 0xC5, 0x9A, 0x1D, 0x1D, 0x1B, 0x0D, 0x7B, 0x00, 0xD1, 0xEC, 0xAE, 0x2D, 0xD4, 0x3A, 0xF1,
+    0x16, 0xAE, 0xF3, 0xE6, 0x8F, 0x66, 0xE4, 0xDA, 0xE1, 0x06, 0x8F, 0xCF, 0xE4, 0x9A, 0x72, 0x69,
+    0xCA, 0xE5, 0x31, 0x1A, 0x8D, 0xD4, 0x36, 0x1A, 0xB1, 0x72, 0x8F, 0x6B, 0xCA, 0x25, 0x18, 0xD4,
+    0x96, 0x2B, 0xF5, 0xB6, 0x90, 0x7D, 0x60, 0xA3, 0xF1, 0xA8, 0xED, 0x21, 0x0F, 0xC8, 0x45, 0x64,
+    0xAD, 0x9C, 0x0B, 0xC5, 0xCC, 0x26, 0x66, 0xAA, 0x97, 0x24, 0x1E, 0x8D, 0xEB, 0xC6, 0x94, 0xD5,
+    0xED, 0x9E, 0xD0, 0x9E, 0xE7, 0xDD, 0x4C, 0x48, 0x64, 0x82, 0x72, 0x47, 0xAE, 0x8F, 0x16, 0x6C,
+    0xC7, 0xB3, 0xE7, 0xA4, 0xD4, 0x1B, 0x1F, 0xA3, 0xE4, 0x5C, 0x4E, 0x2E, 0x85, 0x01, 0x6B, 0xB1,
+    0xE5, 0xEA, 0x81, 0x4C, 0x53, 0xBD, 0x44, 0xCA, 0x48, 0x2D, 0x86, 0xD1, 0x44, 0x23, 0x31, 0xC7,
+    0x8C, 0x00, 0xD4, 0xEA, 0x4D, 0x48, 0x4B, 0xB9, 0x60, 0x27, 0x86, 0x19, 0x1A, 0xB9, 0x2C, 0x7A,
+    0x36, 0x85, 0x42, 0xB4, 0xBF, 0x3E, 0x92, 0x43, 0xE4, 0x0A, 0xCD, 0xD8, 0x05, 0xAB, 0xA8, 0xEB,
+    0x77, 0x2D, 0xF9, 0x86, 0x49, 0xCC, 0xE2, 0x98, 0x5E, 0xE0, 0x7D, 0x09, 0xAF, 0x88, 0x22, 0x55,
+    0x2E, 0x59, 0xDA, 0x33, 0xDF, 0xD5, 0x3E, 0x94, 0xC4, 0x82, 0xD9, 0x03, 0xBD, 0xAB, 0xD7, 0xDF,
+    0xB0, 0x2F, 0xFE, 0xDA, 0xC9, 0x21, 0xD3, 0x83, 0xE4, 0x90, 0x31, 0x91, 0x43, 0x96, 0x44, 0x0E,
+    0xD9, 0x88, 0xE4, 0x10, 0xB5, 0x89, 0x1C, 0xF2, 0x97, 0x4E, 0xCD, 0x62, 0x13, 0x85, 0x48, 0x53,
+    0xB5, 0xC4, 0x88, 0xA8, 0x8B, 0xA9, 0xD9, 0x22, 0xA5, 0x66, 0x9B, 0x98, 0x71, 0xF8, 0x8F, 0x7B,
+    0x6A, 0x76, 0xDB, 0x85, 0xA3, 0x8D, 0xF8, 0x91, 0x5A, 0xA8, 0x44, 0xB7, 0xF3, 0x0F, 0xD6, 0x68,
+    0x58, 0xBB, 0x25, 0xEE, 0x36, 0xF9, 0x13, 0x02, 0x3F, 0x78, 0x2A, 0xC5, 0x6D, 0xD7, 0xA4, 0xD0,
+    0x64, 0xF0, 0x30, 0xCC, 0x14, 0xEA, 0xE9, 0x24, 0xCC, 0x1A, 0x53, 0xB3, 0x9D, 0xC7, 0x28, 0x7A,
+    0x62, 0x90, 0x82, 0x98, 0xA3, 0xC3, 0xDA, 0x47, 0xB7, 0xDA, 0xF4, 0x51, 0xA5, 0x0F, 0xC7, 0x8C,
+    0x7C, 0x14, 0xFC, 0xB4, 0xEF, 0xF2, 0xCB, 0x3D, 0x34, 0x7C, 0x34, 0x1B, 0x26, 0x86, 0x0F, 0x2A,
+    0xA0, 0x3F, 0x97, 0x18, 0xC2, 0x4D, 0xB9, 0x6E, 0xC3, 0x7A, 0xFB, 0x32, 0xF5, 0xD2, 0x38, 0xCA,
+    0xD5, 0x8C, 0xE4, 0xAA, 0x3C, 0xE8, 0xCE, 0x0C, 0xF6, 0xF5, 0x15, 0x6A, 0x69, 0xA6, 0x8A, 0x4A,
+    0xE1, 0x23, 0xF2, 0xC8, 0x99, 0x95, 0x6E, 0xCA, 0xD4, 0x37, 0x33, 0xD6, 0x9B, 0x15, 0x13, 0x62,
+    0xB2, 0x4B, 0x0E, 0xF5, 0xDD, 0x18, 0x03, 0xF7, 0xDA, 0x43, 0x84, 0xB1, 0x8B, 0x15, 0x1E, 0xCD,
+    0x05, 0x9F, 0xC8, 0xD4, 0x62, 0x5F, 0x57, 0x8F, 0x91, 0x7A, 0x72, 0xA9, 0x85, 0xC7, 0xEF, 0x9E,
+    0x30, 0xC2, 0x1B, 0xD1, 0x43, 0x8C, 0x1A, 0x33, 0x1A, 0xD2, 0xC7, 0x25, 0xE9, 0x36, 0x30, 0xB8,
+    0x08, 0xE7, 0x0D, 0x7D, 0xFC, 0xAA, 0xE4, 0xD0, 0x2B, 0x3A, 0x58, 0xD9, 0x16, 0x41, 0xBF, 0x7C,
+    0x8D, 0x93, 0x53, 0x84, 0x68, 0x64, 0xCA, 0x94, 0x0D, 0xAF, 0xE6, 0xE4, 0xE5, 0xF8, 0x98, 0x3A,
+    0xAA, 0xD3, 0x9C, 0xDA, 0x31, 0xBA, 0xFD, 0x36, 0x12, 0xB4, 0x18, 0xFA, 0xE8, 0x87, 0x28, 0xC6,
+    0x2C, 0xC5, 0x16, 0xF5, 0x6C, 0x19, 0x30, 0x82, 0x47, 0xCD, 0x8C, 0xD9, 0xE0, 0x37, 0x07, 0x4F,
+    0xBD, 0xC6, 0xDC, 0x78, 0xB3, 0xB5, 0x44, 0x36, 0xCE, 0x4C, 0x8C, 0xEA, 0x17, 0x3A, 0x8F, 0x95,
+    0x7C, 0x94, 0xC7, 0x3D, 0xFC, 0xB3, 0xE3, 0x7D, 0x99, 0xC6, 0x3D, 0xC1, 0xB8, 0x83, 0x6F, 0x29,
+    0x11, 0x90, 0x90, 0x5C, 0x78, 0x6B, 0x5A, 0xB5, 0xC7, 0x92, 0x3E, 0x6A, 0xA1, 0x52, 0xCC, 0x27,
+    0x6B, 0x82, 0x72, 0x1B, 0x3C, 0x14, 0xC1, 0x04, 0xC8, 0xD6, 0x62, 0x03, 0x94, 0xAB, 0x05, 0xDB,
+    0xCA, 0x41, 0xE3, 0xAC, 0x07, 0xE3, 0xEB, 0x19, 0xCA, 0xB9, 0x0A, 0x90, 0x87, 0x42, 0x89, 0x16,
+    0x07, 0x43, 0x3B, 0x8C, 0x60, 0x9D, 0x9D, 0x7F, 0xF7, 0x3D, 0xDD, 0x68, 0xD6, 0xCE, 0xC8, 0x17,
+    0xD2, 0x1D, 0xCD, 0x48, 0x93, 0x16, 0xAC, 0xE6, 0x66, 0xA6, 0x52, 0xE0, 0x3A, 0x3C, 0xB6, 0x9D,
+    0x99, 0xD4, 0x18, 0xAA, 0xC6, 0xBB, 0x8C, 0x9A, 0x3F, 0x62, 0x11, 0xF9, 0x78, 0x1F, 0xF9, 0xE4,
+    0x6F, 0x6C, 0xFA, 0xB8, 0xF9, 0xA9, 0xD3, 0xC7, 0x46, 0x31, 0x9F, 0x88, 0xA6, 0xB8, 0x1B, 0xEB,
+    0x35, 0xFA, 0xFD, 0xFB, 0x76, 0x3C, 0xE6, 0xA4, 0x92, 0x5B, 0xFF, 0x96, 0xE4, 0xD8, 0x14, 0x3E,
+    0x01, 0x47, 0x5D, 0x02, 0x8C, 0xAA, 0x1D, 0x4F, 0xB3, 0x7B, 0x1A, 0xF2, 0xF9, 0x67, 0xCF, 0x3C,
+    0x32, 0x4F, 0xF7, 0x0D, 0xAD, 0x34, 0xF7, 0xA4, 0xD6, 0x44, 0x12, 0x0B, 0xD6, 0x67, 0x72, 0x26,
+    0x30, 0x4C, 0xE5, 0x86, 0x9D, 0x63, 0xDC, 0xAE, 0x84, 0x17, 0xC9, 0xD5, 0x92, 0xA6, 0x6A, 0x3B,
+    0x74, 0x73, 0x11, 0x7F, 0xE3, 0x4A, 0xD1, 0xF9, 0x4C, 0x7D, 0xB3, 0x30, 0x4C, 0x66, 0xC5, 0xCE,
+    0x85, 0x38, 0xFE, 0x66, 0x8C, 0x86, 0x69, 0x70, 0x3B, 0xC4, 0x56, 0xCF, 0xF0, 0x68, 0x15, 0xE0,
+    0x13, 0xC5, 0x0A, 0xF6, 0xF5, 0x88, 0xC7, 0x41, 0x2E, 0xB1, 0xEF, 0xCA, 0xBF, 0x35, 0x34, 0x80,
+    0xF6, 0x27, 0xD2, 0x00, 0x96, 0x07, 0xB2, 0xFE, 0x36, 0x99, 0xC5, 0x2A, 0x3C, 0xF8, 0x0B, 0x77,
+    0xBF, 0x63, 0xC9, 0x3F, 0xE3, 0x17, 0x4A, 0x03, 0xF8, 0xDD, 0x66, 0x41, 0xDF, 0x8B, 0x34, 0x80,
+    0x3B, 0xC2, 0x68, 0x33, 0x01, 0xAB, 0xB9, 0x1B, 0x13, 0x5A, 0x19, 0x37, 0x67, 0xC4, 0x8B, 0x6C,
+    0x0F, 0x64, 0xE1, 0xB4, 0x35, 0x5F, 0xBC, 0x6F, 0x67, 0xFE, 0xCD, 0x01, 0x5E, 0x9A, 0x87, 0x02,
+    0x2F, 0xF1, 0x59, 0xE3, 0x91, 0xEB, 0x54, 0x45, 0xD7, 0x2B, 0x25, 0x92, 0x62, 0x3A, 0x22, 0xB1,
+    0x54, 0x12, 0x74, 0x96, 0x96, 0x23, 0x6E, 0xB7, 0x3C, 0xFE, 0x2C, 0x6F, 0xCF, 0xF6, 0xD6, 0xC8,
+    0xF0, 0x8A, 0x16, 0x86, 0x3F, 0xD6, 0x86, 0x9D, 0x23, 0xEE, 0xD2, 0xB9, 0x72, 0xA3, 0x89, 0x04,
+    0x62, 0x34, 0x46, 0xD8, 0x45, 0xBD, 0x0D, 0x58, 0xDF, 0x6D, 0x18, 0x49, 0x6D, 0x44, 0x5D, 0x9A,
+    0x35, 0x6E, 0x96, 0xB0, 0xC3, 0xA3, 0x11, 0xC6, 0x94, 0x83, 0x3C, 0x8A, 0x6A, 0xD8, 0x03, 0x6A,
+    0xF5, 0xFB, 0xED, 0x44, 0xC8, 0x6B, 0x3E, 0x2E, 0xC5, 0xD3, 0x00, 0xCD, 0x19, 0x73, 0xED, 0xDA,
+    0xE1, 0x3A, 0x1C, 0x0E, 0x89, 0x07, 0x35, 0x68, 0x8A, 0x5B, 0xCF, 0xCA, 0x47, 0x93, 0x62, 0x35,
+    0x41, 0xA5, 0x39, 0x3A, 0xCC, 0x85, 0xD6, 0x88, 0xEE, 0x67, 0x52, 0x5B, 0x6A, 0x05, 0x86, 0x61,
+    0x2A, 0x36, 0x01, 0xF6, 0x2B, 0x4B, 0xB6, 0xCA, 0x41, 0xFD, 0x27, 0x42, 0xD6, 0x43, 0x35, 0xCB,
+    0x0D, 0x1F, 0x0E, 0x50, 0x04, 0xEB, 0xED, 0x33, 0x02, 0x54, 0xAD, 0x8D, 0x93, 0x83, 0xE1, 0x93,
+    0xFA, 0xF0, 0x64, 0x3D, 0xD8, 0xB1, 0xFB, 0x81, 0xAF, 0x03, 0x18, 0x6F, 0xB4, 0x94, 0x82, 0x72,
+    0x29, 0x14, 0x32, 0xF5, 0xE4, 0x2B, 0x8A, 0x14, 0x66, 0xD1, 0x88, 0x66, 0x81, 0xCE, 0x95, 0x6A,
+    0xAB, 0x0D, 0x9A, 0x29, 0x93, 0x2B, 0xD4, 0x62, 0x3C, 0x76, 0x44, 0x23, 0x65, 0xC0, 0x78, 0xEC,
+    0x4C, 0x2E, 0xF2, 0x2F, 0x50, 0x6F, 0x6D, 0xA5, 0x25, 0xFA, 0x22, 0x46, 0x6A, 0x61, 0x90, 0xEE,
+    0x28, 0x32, 0xC8, 0x8E, 0x29, 0x85, 0x7A, 0xDF, 0x3A, 0xFB, 0xAE, 0x3B, 0xEE, 0xB2, 0x13, 0x32,
+    0x7A, 0x7C, 0x71, 0x0C, 0x29, 0x58, 0x1F, 0x0C, 0x42, 0xE2, 0x9E, 0xEB, 0x93, 0x77, 0xE7, 0xF2,
+    0x98, 0x0A, 0x68, 0x6B, 0x8D, 0x64, 0x91, 0x8E, 0x4A, 0xF1, 0x7A, 0xA8, 0x5E, 0x0B, 0x50, 0x7F,
+    0xCB, 0xDB, 0x5B, 0x13, 0x0C, 0xF6, 0xE5, 0x45, 0x2D, 0xC5, 0xA2, 0x0F, 0xDF, 0x09, 0x60, 0xBE,
+    0xB6, 0x5E, 0xD6, 0x1E, 0x6C, 0xF5, 0xBA, 0x1F, 0x1C, 0x59, 0x68, 0xF4, 0xA9, 0x0D, 0x2A, 0xDF,
+    0x05, 0x33, 0x83, 0xFD, 0xA4, 0xBC, 0x1D, 0x61, 0x2D, 0xD5, 0x0A, 0x2A, 0x5F, 0x87, 0x32, 0xBC,
+    0xFF, 0x5D, 0xB6, 0xEF, 0xA6, 0xFA, 0xCF, 0x17, 0x05, 0xC4, 0xA0, 0x6F, 0x68, 0x2A, 0x96, 0x5C,
+    0xAA, 0x85, 0x19, 0x4B, 0x05, 0xEB, 0x79, 0x0C, 0xA3, 0xE9, 0x31, 0x80, 0x47, 0x52, 0x18, 0x5A,
+    0x2C, 0xF7, 0x1B, 0xF7, 0x34, 0x96, 0x6A, 0xBA, 0x8F, 0x51, 0x8A, 0x7F, 0x80, 0xC0, 0x59, 0x47,
+    0x5D, 0x2B, 0x18, 0x8E, 0x2C, 0xDC, 0x48, 0xEA, 0xDB, 0x85, 0x72, 0x98, 0x92, 0x4C, 0x9A, 0x90,
+    0x34, 0xFB, 0x11, 0xBD, 0x7E, 0xB3, 0xCB, 0x8B, 0x37, 0xB9, 0xDC, 0xEE, 0x97, 0x97, 0x31, 0xF8,
+    0x9E, 0xF6, 0xD0, 0x73, 0x7D, 0x20, 0xC8, 0x28, 0x5A, 0xA0, 0x1C, 0xF9, 0x77, 0x71, 0x79, 0xEA,
+    0x16, 0x68, 0x7C, 0x15, 0x89, 0x3B, 0xF1, 0x6A, 0x93, 0x0C, 0x5F, 0x93, 0x9C, 0x9D, 0x2B, 0x0F,
+    0x0F, 0xF4, 0x6E, 0xB5, 0xE7, 0xEC, 0xDB, 0x32, 0x5D, 0x9C, 0xC2, 0xAD, 0x26, 0xAA, 0x85, 0x22,
+    0x7D, 0x7E, 0x8A, 0x58, 0xEA, 0xD7, 0x62, 0x9E, 0x30, 0x6E, 0x4C, 0x86, 0x67, 0xA2, 0x0F, 0xEC,
+    0xAD, 0x07, 0xF2, 0x2D, 0xEE, 0xCF, 0xCE, 0x35, 0x0B, 0x60, 0x96, 0x2C, 0xEE, 0xD4, 0x38, 0x78,
+    0x3B, 0x92, 0xFC, 0x27, 0xAD, 0xC9, 0x67, 0x9F, 0x92, 0xD5, 0x81, 0x72, 0xBB, 0xB8, 0x90, 0x07,
+    0x39, 0x4A, 0xC5, 0x5B, 0xEA, 0x66, 0x8A, 0x2D, 0xBA, 0xE9, 0x72, 0x60, 0x57, 0x06, 0xDD, 0x66,
+    0xD0, 0x6A, 0xB5, 0x51, 0x4B, 0x7F, 0x12, 0x79, 0x53, 0xA7, 0xE9, 0x29, 0xA0, 0x6A, 0xF3, 0x11,
+    0x33, 0x65, 0x9E, 0x22, 0x64, 0x01, 0xF4, 0x1F, 0x57, 0xB0, 0x5A, 0x21, 0x57, 0xD8, 0x79, 0x95,
+    0x27, 0x62, 0x4A, 0xA5, 0x0F, 0x06, 0x8C, 0x5E, 0xDF, 0xA2, 0xBA, 0x34, 0x7A, 0x5E, 0xCE, 0x6C,
+    0x68, 0x2A, 0x45, 0x13, 0x0D, 0x78, 0xA6, 0xBE, 0x10, 0x1A, 0x73, 0xF5, 0xD6, 0xA3, 0xB1, 0x0E,
+    0x74, 0xBE, 0xDA, 0xB0, 0xA1, 0x50, 0xDB, 0x6C, 0x68, 0x34, 0xEA, 0xED, 0x6C, 0x5E, 0x9D, 0x3E,
+    0x2F, 0xF3, 0xCD, 0x75, 0x93, 0xFE, 0x58, 0xEA, 0xE4, 0x07, 0x19, 0xF9, 0x5A, 0x68, 0x2A, 0x36,
+    0xB2, 0xF6, 0x7E, 0x18, 0xA8, 0x69, 0x9F, 0x8E, 0xEC, 0xB7, 0x66, 0x06, 0x32, 0xDD, 0x51, 0x0B,
+    0x34, 0x4B, 0xAC, 0x62, 0xD8, 0xF2, 0x37, 0x10, 0x5D, 0xFF, 0x36, 0xAE, 0xDA, 0x8B, 0xD9, 0x02,
+    0xC3, 0x4B, 0x6A, 0xB1, 0x5E, 0x23, 0x66, 0xB1, 0x9E, 0x62, 0xA9, 0xFC, 0x1B, 0x47, 0xFC, 0x08,
+    0xC0, 0x30, 0x77, 0x0E, 0x69, 0x98, 0xB2, 0x48, 0x9F, 0xBB, 0xA7, 0x80, 0x26, 0xB3, 0xD1, 0xF9,
+    0x5C, 0xAD, 0xF5, 0xC8, 0xD5, 0x4B, 0x8C, 0x88, 0x9A, 0xA5, 0x10, 0x66, 0xCD, 0xE4, 0x4A, 0x31,
+    0x4C, 0x85, 0x9C, 0x9D, 0x73, 0x4D, 0x66, 0x45, 0x4B, 0xA1, 0x76, 0xDB, 0xDE, 0x2A, 0xBF, 0x0E,
+    0xDF, 0x7A, 0x55, 0x5B, 0xA3, 0xD7, 0xA4, 0x4A, 0x5E, 0xCA, 0xE4, 0xCD, 0x86, 0x9D, 0x78, 0xEC,
+    0x64, 0x26, 0x0E, 0x11, 0x6B, 0xCE, 0x76, 0x1E, 0x58, 0xF2, 0x95, 0x5A, 0x20, 0x1B, 0x76, 0x5C,
+    0x22, 0xD7, 0x96, 0x7D, 0xCC, 0x03, 0xD4, 0xAF, 0xCE, 0x29, 0xEF, 0xB6, 0x75, 0x2E, 0xA6, 0x22,
+    0xCC, 0x0F, 0x95, 0xB2, 0x11, 0xDA, 0xB5, 0x6D, 0x35, 0xEF, 0xE5, 0x23, 0xC3, 0xA7, 0xB4, 0x67,
+    0x1B, 0x77, 0x1E, 0xA4, 0x75, 0x36, 0x66, 0x3E, 0x8A, 0x35, 0x4B, 0xAC, 0x57, 0x3B, 0x55, 0x51,
+    0xC8, 0x73, 0x61, 0xEF, 0x1E, 0xAE, 0x03, 0xF5, 0x76, 0xA1, 0x94, 0x03, 0xD9, 0x33, 0x97, 0x3B,
+    0xF0, 0x09, 0xFA, 0xFA, 0x41, 0x23, 0x75, 0x4B, 0x15, 0x28, 0x04, 0x1B, 0x0C, 0x23, 0x75, 0xA0,
+    0x9A, 0x29, 0x37, 0x18, 0x26, 0xAC, 0xA3, 0xF3, 0x14, 0xBA, 0x78, 0x5E, 0x54, 0x9A, 0x32, 0x29,
+    0x16, 0x22, 0x4C, 0x46, 0x92, 0x5C, 0x25, 0xB5, 0xC3, 0x8E, 0xC0, 0x3C, 0x12, 0x29, 0x2B, 0x5A,
+    0x32, 0xCD, 0x18, 0xE9, 0xF3, 0xD1, 0x79, 0x93, 0x84, 0xEE, 0x0D, 0xFA, 0xA0, 0x0A, 0xF5, 0x26,
+    0x14, 0x2A, 0x85, 0x99, 0x8B, 0xCD, 0x04, 0x1A, 0x5F, 0x86, 0x7A, 0xC1, 0x8E, 0x66, 0xB1, 0x33,
+    0x83, 0xEB, 0x26, 0xEB, 0xD1, 0x2B, 0xEA, 0x3B, 0x9F, 0x4B, 0x2B, 0xC3, 0x54, 0x48, 0x23, 0x1A,
+    0x2B, 0xAD, 0xA0, 0xB1, 0x96, 0xE3, 0x1F, 0x6A, 0xB4, 0x72, 0xD9, 0x22, 0xBF, 0x69, 0x7C, 0x7C,
+    0x19, 0x14, 0x06, 0xC9, 0x77, 0x91, 0xE8, 0x62, 0xE5, 0x1A, 0x6D, 0x98, 0x8D, 0x52, 0xDF, 0x81,
+    0xEB, 0x0F, 0x62, 0xAA, 0xBC, 0x17, 0xF8, 0x04, 0x55, 0x0F, 0xF5, 0x98, 0xCD, 0x90, 0x8B, 0xE1,
+    0xE8, 0xCB, 0xB0, 0x43, 0xAD, 0xCB, 0xC3, 0x31, 0x9B, 0x6B, 0x87, 0xC3, 0xE1, 0x46, 0x84, 0xFF,
+    0x63, 0x0A, 0x71, 0x8D, 0xF0, 0xE9, 0x48, 0xA9, 0xF6, 0xA3, 0x89, 0xA2, 0xEF, 0x30, 0x22, 0x51,
+    0x2F, 0x6D, 0x8B, 0x59, 0xC9, 0xFA, 0x3D, 0xD1, 0x10, 0x9D, 0xA9, 0x9D, 0x39, 0x71, 0xA4, 0x28,
+    0x3A, 0xE8, 0x22, 0x43, 0x51, 0x87, 0xC3, 0xD1, 0x01, 0x8B, 0x59, 0x96, 0x18, 0x04, 0xD3, 0x04,
+    0xB2, 0xC8, 0xF5, 0xB4, 0x3D, 0x76, 0xA1, 0x9A, 0x63, 0x52, 0x01, 0x86, 0x7B, 0x17, 0xF2, 0x59,
+    0x04, 0x73, 0xAD, 0x14, 0x3D, 0xE7, 0x73, 0x50, 0xF0, 0xAD, 0x5C, 0x75, 0xF8, 0x2C, 0xF0, 0x9B,
+    0x34, 0x63, 0x35, 0xE6, 0xFA, 0xFD, 0x10, 0x2B, 0x62, 0x3A, 0xF5, 0xF0, 0x4F, 0x76, 0x17, 0x2C,
+    0x8B, 0x68, 0x17, 0x95, 0x36, 0x0A, 0xC9, 0xA3, 0x67, 0x84, 0x1D, 0x6B, 0x5F, 0x2D, 0xB9, 0x10,
+    0x76, 0x6C, 0x26, 0x13, 0x8A, 0xB5, 0x10, 0xDD, 0xCB, 0x72, 0xD5, 0xA6, 0x31, 0x39, 0x44, 0x23,
+    0xC8, 0xF1, 0xF7, 0x4D, 0xC0, 0xB8, 0x61, 0xAA, 0x42, 0x29, 0xA9, 0xB5, 0xD2, 0x98, 0x49, 0x9E,
+    0x42, 0xF3, 0x59, 0x21, 0x00, 0x70, 0x55, 0xDF, 0x39, 0x12, 0xB6, 0xAD, 0x94, 0x52, 0x4F, 0x1E,
+    0x7B, 0x97, 0x61, 0xC3, 0x78, 0x4A, 0xB9, 0x22, 0x82, 0x2C, 0xBF, 0x1E, 0xC1, 0xCE, 0x13, 0x67,
+    0xC8, 0x9F, 0xDC, 0x54, 0x23, 0x0E, 0x87, 0xC3, 0x47, 0xE5, 0x06, 0x29, 0xD2, 0x9C, 0xA4, 0xD0,
+    0x48, 0xD2, 0x66, 0x74, 0x38, 0x7C, 0x4C, 0x85, 0x5A, 0x0A, 0xBD, 0x24, 0x47, 0xAE, 0xB1, 0xF3,
+    0x20, 0x5F, 0x07, 0xD0, 0x5C, 0xAA, 0x65, 0x58, 0xD0, 0x9C, 0x29, 0x60, 0xF5, 0xAA, 0x96, 0x9D,
+    0x28, 0xDA, 0x29, 0xD6, 0xA6, 0x44, 0x68, 0xF0, 0xC6, 0x49, 0xA5, 0xDC, 0x12, 0x34, 0x5A, 0xA9,
+    0x25, 0x5F, 0xE8, 0xF7, 0xD4, 0x0F, 0xAD, 0x09, 0xA5, 0x63, 0x18, 0x7F, 0x9D, 0x6A, 0x8D, 0x78,
+    0x69, 0xFA, 0xBD, 0x33, 0x9B, 0x09, 0x85, 0x50, 0x2F, 0x57, 0xCF, 0x8D, 0x2F, 0x54, 0xAC, 0x74,
+    0xA3, 0x1D, 0xEB, 0xA5, 0xD8, 0x4A, 0x61, 0x25, 0x97, 0x49, 0x53, 0x94, 0xD0, 0xF3, 0x89, 0xC9,
+    0xE7, 0x72, 0x82, 0x42, 0xD5, 0x0A, 0x79, 0x54, 0xF4, 0xC3, 0x24, 0x07, 0xF5, 0xD4, 0x8C, 0x40,
+    0xFB, 0x06, 0x35, 0xFF, 0x9F, 0xD8, 0x54, 0x96, 0x53, 0xDD, 0xE7, 0x2A, 0x57, 0xAC, 0x1F, 0xC6,
+    0x42, 0x26, 0xD0, 0xF4, 0x5D, 0xFB, 0x10, 0x0D, 0xFE, 0x4B, 0x99, 0xEE, 0x5D, 0xEE, 0x43, 0xBE,
+    0x13, 0x8E, 0x9B, 0xD9, 0x1E, 0xB1, 0xF2, 0xAF, 0x1E, 0x29, 0x00, 0xAA, 0x76, 0x58, 0xBC, 0x9A,
+    0xEB, 0xE9, 0x7E, 0x4B, 0xF3, 0xF0, 0xC7, 0xFF, 0x5F, 0x28, 0xB9, 0x17, 0x4A, 0xF2, 0xB0, 0x42,
+    0xC9, 0xE5, 0xA8, 0x5A, 0x93, 0xB3, 0xF9, 0x62, 0x5A, 0x01, 0xEB, 0x63, 0xE0, 0x58, 0x2A, 0x19,
+    0xB9, 0x6E, 0x8C, 0x2E, 0x4B, 0xB1, 0x98, 0x89, 0x1F, 0xF7, 0xF8, 0x4F, 0x1D, 0x04, 0xAF, 0xC6,
+    0xDA, 0x61, 0x42, 0xBD, 0x50, 0xCA, 0x6C, 0xE4, 0x7A, 0x46, 0x60, 0xFB, 0xA1, 0x25, 0x7B, 0xC0,
+    0xB9, 0xFB, 0xA5, 0xD7, 0x43, 0x8E, 0x3F, 0xAE, 0x1E, 0xF2, 0x06, 0x40, 0xB6, 0x14, 0x13, 0xF5,
+    0x6C, 0x27, 0xF4, 0xB2, 0xDA, 0x42, 0x26, 0x50, 0xF9, 0x7A, 0x7C, 0x70, 0x8D, 0xAE, 0x00, 0x95,
+    0x26, 0x72, 0x69, 0xA6, 0x91, 0x7C, 0xA6, 0x7F, 0x2D, 0x57, 0x4E, 0xB9, 0xDA, 0x5F, 0x89, 0x2C,
+    0xAA, 0x66, 0x8A, 0xF4, 0xEA, 0xB7, 0x0D, 0x3E, 0x56, 0x34, 0x66, 0x52, 0x9B, 0x8A, 0x22, 0x23,
+    0x4D, 0x6C, 0xC9, 0x1D, 0xDD, 0xD8, 0xB8, 0x42, 0x68, 0xEC, 0x96, 0x22, 0x71, 0x78, 0x96, 0x84,
+    0xA1, 0x1F, 0x76, 0x80, 0xFA, 0x3A, 0xB5, 0x52, 0xDA, 0x2F, 0x4D, 0x52, 0xC0, 0x7E, 0xF7, 0x30,
+    0xCC, 0x58, 0x87, 0x46, 0xBA, 0xB6, 0x50, 0x4B, 0x87, 0x59, 0xE1, 0x3D, 0x89, 0x0C, 0x70, 0x2C,
+    0x54, 0xD8, 0x4D, 0x6F, 0x24, 0x5F, 0x45, 0x20, 0xD0, 0xA6, 0xA2, 0x88, 0xED, 0x94, 0x1C, 0xAD,
+    0xF6, 0xE7, 0x72, 0xA4, 0xDA, 0x68, 0xC6, 0x54, 0x59, 0xD0, 0x04, 0xEC, 0xC2, 0x30, 0x63, 0xF5,
+    0xAA, 0x26, 0x6A, 0x49, 0x3D, 0xC9, 0x31, 0x1B, 0x22, 0x3F, 0xFC, 0xFA, 0x9E, 0xB9, 0x9A, 0x68,
+    0x8E, 0xCE, 0x84, 0x2B, 0xE3, 0x2D, 0x8F, 0x68, 0xE4, 0x12, 0xB3, 0x92, 0x7B, 0x86, 0x91, 0xAC,
+    0xAD, 0xD6, 0x23, 0xE3, 0x35, 0xBE, 0x8C, 0x1C, 0xB9, 0x74, 0x93, 0xFD, 0x9E, 0x12, 0x2D, 0xE3,
+    0x3E, 0xAF, 0x8F, 0xB5, 0x1A, 0xBB, 0xC3, 0xD1, 0xF9, 0x23, 0x61, 0xA0, 0x14, 0x6F, 0x81, 0x66,
+    0x61, 0x21, 0x26, 0xDE, 0xCC, 0x86, 0x9D, 0x91, 0x47, 0x1A, 0x44, 0x74, 0x98, 0x53, 0x24, 0x79,
+    0x6B, 0x6B, 0x77, 0x0D, 0x32, 0xEF, 0x4A, 0xA5, 0x3F, 0x2F, 0xBA, 0xE2, 0xE6, 0xC5, 0xC5, 0x8F,
+    0xDD, 0x96, 0x91, 0x46, 0x79, 0xC0, 0x48, 0xDE, 0xC4, 0x71, 0x6E, 0x59, 0x72, 0x9B, 0xDA, 0x4A,
+    0x5B, 0x4B, 0xA9, 0x36, 0x4E, 0xE4, 0xE0, 0xA3, 0x00, 0x1A, 0xC5, 0x1A, 0x11, 0x34, 0x45, 0x12,
+    0x84, 0xD9, 0x28, 0x14, 0xA2, 0x23, 0xA4, 0x84, 0x20, 0x76, 0xD1, 0x73, 0x72, 0xB5, 0xD4, 0x83,
+    0x5D, 0xAA, 0x35, 0xC2, 0x93, 0x4F, 0xE8, 0x43, 0x91, 0x7B, 0x29, 0x17, 0xA1, 0xCE, 0xCE, 0x47,
+    0xA8, 0x53, 0x0B, 0x11, 0x9E, 0xDC, 0xA8, 0x63, 0x6C, 0xD2, 0xE6, 0x72, 0xD0, 0x68, 0x4C, 0xF0,
+    0xA4, 0x7F, 0x10, 0xEA, 0x4C, 0x05, 0x2B, 0xC3, 0x02, 0x9A, 0xC9, 0x62, 0xD5, 0xDA, 0x82, 0x8D,
+    0x34, 0x38, 0x77, 0x56, 0xAB, 0xF2, 0xCB, 0xA3, 0x7C, 0xF5, 0x0F, 0x52, 0xBE, 0x1C, 0x72, 0x97,
+    0x2A, 0x0A, 0x55, 0x3F, 0xDC, 0x2E, 0xCF, 0x28, 0x5F, 0xBD, 0x84, 0x16, 0x34, 0x65, 0x6A, 0x79,
+    0x2C, 0x46, 0xB0, 0xA7, 0x47, 0xDD, 0x37, 0x11, 0xEC, 0x5E, 0x93, 0x9E, 0xD5, 0xD7, 0xA2, 0x85,
+    0x30, 0xA1, 0x89, 0x96, 0x66, 0xF8, 0xC0, 0x76, 0xE6, 0x16, 0xFE, 0x7F, 0x75, 0x61, 0x1B, 0x5E,
+    0x84, 0x42, 0x55, 0x80, 0x3A, 0x58, 0xBF, 0xDB, 0xA3, 0xB5, 0x58, 0xDE, 0x4C, 0xE0, 0x2B, 0x91,
+    0xE9, 0x09, 0x89, 0x3A, 0x18, 0x05, 0x86, 0xE9, 0x37, 0x06, 0x5F, 0x9C, 0xAD, 0xA3, 0xF5, 0x58,
+    0x9F, 0xA9, 0x8F, 0xDC, 0xF0, 0x72, 0xC3, 0x7A, 0x9A, 0x39, 0x93, 0x43, 0xCE, 0x6C, 0x14, 0x1B,
+    0xDD, 0x42, 0x33, 0x17, 0x1A, 0x91, 0x6B, 0x44, 0xA1, 0xFC, 0xF5, 0xF0, 0x77, 0x4C, 0x68, 0xBE,
+    0x72, 0x6F, 0xE9, 0x14, 0x3A, 0x8D, 0xD2, 0xA8, 0xAD, 0x50, 0x28, 0x34, 0x15, 0xEA, 0xCB, 0x95,
+    0x68, 0x4A, 0x4E, 0x78, 0x41, 0xDF, 0x41, 0x34, 0x25, 0x64, 0xBA, 0xA3, 0x1E, 0xEA, 0x10, 0x01,
+    0xA3, 0x58, 0xCA, 0xFD, 0x90, 0x15, 0x7D, 0x5C, 0xB7, 0xD9, 0x3D, 0xB6, 0x26, 0xB1, 0x41, 0x62,
+    0xAD, 0xF9, 0xDD, 0xA7, 0x34, 0xA3, 0x80, 0x91, 0xB3, 0x82, 0x6E, 0x2D, 0xE5, 0x28, 0x34, 0x69,
+    0x86, 0x46, 0xB5, 0x20, 0xD7, 0x0F, 0xE3, 0x9F, 0xC5, 0xD9, 0x7E, 0x2D, 0x4E, 0xFE, 0x10, 0x20,
+    0xD7, 0xAB, 0xEA, 0xC1, 0x6E, 0x91, 0xF7, 0xF6, 0x2D, 0xF5, 0xD0, 0x05, 0x2D, 0x50, 0xE9, 0x33,
+    0xEA, 0x41, 0x7E, 0x08, 0xD0, 0x6C, 0xA5, 0x46, 0x4A, 0x39, 0x2B, 0x32, 0xCD, 0xB9, 0xD6, 0x6C,
+    0x88, 0xC8, 0x6E, 0x2C, 0x79, 0xD2, 0x08, 0x11, 0x49, 0xC8, 0x86, 0x18, 0x18, 0x5D, 0x8B, 0xD2,
+    0xFC, 0x74, 0xB6, 0x90, 0xAB, 0x5C, 0x29, 0x64, 0x56, 0x0A, 0x99, 0x40, 0xBE, 0x94, 0x6F, 0xC4,
+    0x04, 0x32, 0x20, 0xD3, 0x4A, 0xCC, 0x65, 0x76, 0xD2, 0x98, 0xE9, 0x9E, 0x7C, 0xA1, 0xB6, 0x9B,
+    0xCD, 0x8A, 0x9D, 0xEB, 0x80, 0x5D, 0xEC, 0x8C, 0x5D, 0xAC, 0xC7, 0xCE, 0x9D, 0xC7, 0xCE, 0xC3,
+    0x84, 0xF5, 0x9A, 0xE8, 0xBC, 0x46, 0x86, 0x49, 0x13, 0x72, 0x9A, 0x72, 0xF5, 0x83, 0xAF, 0x44,
+    0xB7, 0x76, 0x21, 0xE6, 0x0D, 0x53, 0x7E, 0x74, 0x8D, 0x14, 0xBD, 0x9F, 0x66, 0x4A, 0xE7, 0x52,
+    0x33, 0xB1, 0xA0, 0xDD, 0x6E, 0x60, 0xD7, 0x52, 0x3D, 0xB9, 0xA6, 0x68, 0x98, 0xEB, 0x0D, 0xD0,
+    0x0F, 0x23, 0x0F, 0x24, 0x92, 0x40, 0x5E, 0x8B, 0x8C, 0x9D, 0x41, 0x92, 0xF4, 0x6A, 0xA4, 0xED,
+    0xE8, 0x47, 0x87, 0xC3, 0x47, 0xF5, 0xAD, 0xC8, 0x14, 0xD1, 0x0C, 0xA5, 0x3E, 0xA3, 0x16, 0xE4,
+    0x87, 0x05, 0xEA, 0x2D, 0x2E, 0x93, 0xB3, 0x1B, 0x68, 0xCE, 0xB5, 0x30, 0x6C, 0x18, 0x6D, 0x3F,
+    0x69, 0x4A, 0x33, 0xA0, 0xD4, 0x1C, 0xF7, 0x55, 0x2D, 0xCD, 0x99, 0xBE, 0x2B, 0x6F, 0x56, 0x34,
+    0x6A, 0xCC, 0xF5, 0xC1, 0x8D, 0x72, 0xB3, 0x9E, 0x7A, 0xD1, 0xD7, 0x0F, 0xC3, 0x37, 0x24, 0xE9,
+    0x96, 0xA4, 0xA0, 0xEF, 0x5F, 0x0C, 0x3F, 0x14, 0x99, 0x3E, 0x1B, 0x30, 0xC1, 0xCE, 0x0C, 0xD3,
+    0x30, 0x95, 0xCA, 0xF4, 0xDD, 0xC1, 0x17, 0x92, 0x28, 0xA4, 0x29, 0xCD, 0xD2, 0x35, 0x7E, 0x61,
+    0xC2, 0xFA, 0x37, 0x79, 0x66, 0xFF, 0x2A, 0xC2, 0xFA, 0x5D, 0xF9, 0x42, 0xAD, 0x9D, 0xCD, 0x4A,
+    0x33, 0xD7, 0x0B, 0xF5, 0x62, 0x3D, 0xF5, 0x62, 0x7F, 0x74, 0xB8, 0x35, 0x77, 0x92, 0xE6, 0x41,
+    0x92, 0xD7, 0xF7, 0x2F, 0x06, 0x2F, 0x47, 0x37, 0xC9, 0x21, 0xA7, 0x31, 0x57, 0x3F, 0x4C, 0xA5,
+    0xE8, 0xEE, 0xDE, 0xFA, 0xF1, 0xC2, 0x5A, 0x8D, 0xB5, 0x03, 0xEB, 0xBB, 0x09, 0x3A, 0xAF, 0xF8,
+    0x3C, 0x82, 0x75, 0x43, 0x0B, 0x8F, 0xBC, 0x21, 0xD2, 0xB9, 0xA5, 0xDB, 0x60, 0xA4, 0x35, 0x2E,
+    0x40, 0x9F, 0x38, 0xA3, 0x76, 0x2C, 0x34, 0xD3, 0xB5, 0x28, 0xD0, 0x81, 0x0D, 0x3C, 0x0D, 0xCD,
+    0xCA, 0xBB, 0xF6, 0xC8, 0xB3, 0xD6, 0xC9, 0x79, 0x4A, 0x95, 0xED, 0x8A, 0xD4, 0x4A, 0x88, 0xE8,
+    0xD4, 0x70, 0x31, 0xBC, 0xA1, 0x16, 0x6B, 0x58, 0xB2, 0x1E, 0xE4, 0xCD, 0x48, 0xA1, 0xC9, 0x7A,
+    0x2A, 0x39, 0xBB, 0x60, 0x85, 0xD5, 0x0F, 0x62, 0x59, 0x82, 0x62, 0x21, 0x64, 0x0B, 0x83, 0xE6,
+    0x63, 0xB8, 0x99, 0xFB, 0x6A, 0xC4, 0xFA, 0xC1, 0x65, 0xBA, 0x23, 0xCA, 0xD5, 0x2C, 0x98, 0xF1,
+    0x48, 0xDF, 0xBE, 0x6F, 0xC6, 0x93, 0x5B, 0xEA, 0x93, 0x5B, 0xFA, 0x3F, 0x69, 0xAC, 0xA6, 0x5C,
+    0xFD, 0x3B, 0x29, 0xC4, 0xA3, 0x47, 0x04, 0xFE, 0x6D, 0x17, 0x72, 0x74, 0x91, 0x90, 0x1A, 0xB8,
+    0xFA, 0xDC, 0x30, 0x25, 0x76, 0xAE, 0x09, 0xB9, 0xA3, 0x9B, 0x9A, 0x08, 0xFF, 0x76, 0x73, 0x91,
+    0x2A, 0xC0, 0xE6, 0xD8, 0xC0, 0x81, 0x1B, 0xE7, 0x6E, 0x54, 0xB2, 0x2D, 0xA9, 0x65, 0xC0, 0xD5,
+    0x8B, 0x8B, 0x2F, 0x3C, 0xDC, 0x94, 0x64, 0x87, 0x43, 0x7B, 0xE5, 0x70, 0x23, 0xD2, 0xEE, 0x43,
+    0x2D, 0x39, 0xAB, 0xA5, 0xD2, 0x4A, 0x15, 0x0B, 0x3C, 0x8B, 0x48, 0xEC, 0xAD, 0xA2, 0x5D, 0x33,
+    0x73, 0xE4, 0xB2, 0x44, 0xEE, 0x4A, 0xE7, 0xA0, 0x8E, 0x01, 0xA4, 0x09, 0x79, 0x74, 0x9F, 0x8B,
+    0x00, 0x94, 0x9B, 0x89, 0x8C, 0xD1, 0x3A, 0x16, 0x13, 0x24, 0xEE, 0x7F, 0x0C, 0x0A, 0x53, 0x16,
+    0x30, 0x41, 0x47, 0xC3, 0x7C, 0x9E, 0x5E, 0xED, 0x1C, 0xF0, 0x77, 0x22, 0x17, 0xD9, 0x26, 0x27,
+    0x34, 0x06, 0x45, 0x5D, 0x94, 0x73, 0x9B, 0xD2, 0x08, 0xCB, 0xFD, 0x8D, 0x1F, 0xA2, 0x73, 0x84,
+    0xD9, 0x8B, 0x63, 0xD7, 0x88, 0x57, 0x38, 0x20, 0x22, 0xA6, 0x0F, 0x43, 0xAD, 0xA7, 0x5C, 0x2D,
+    0x56, 0xBD, 0x0D, 0x94, 0x0A, 0x99, 0x46, 0x6E, 0xCA, 0x99, 0x35, 0x56, 0x37, 0x3B, 0x62, 0x39,
+    0x0B, 0xA5, 0x22, 0x6C, 0xEC, 0xCD, 0x0C, 0x85, 0x32, 0x01, 0x8D, 0x6F, 0x26, 0xC8, 0x62, 0x64,
+    0x57, 0xFB, 0xD8, 0xCA, 0x24, 0x76, 0x32, 0xF9, 0x51, 0x24, 0xD0, 0x76, 0x0E, 0x30, 0xAF, 0x47,
+    0x8F, 0x3F, 0x79, 0xF3, 0x11, 0x10, 0x99, 0xCF, 0x41, 0xB7, 0x9E, 0x3D, 0xFD, 0x1E, 0x53, 0x5E,
+    0x63, 0x2E, 0xC0, 0x7E, 0x3F, 0x26, 0x69, 0x62, 0xA4, 0xA4, 0xE5, 0x04, 0x9F, 0x57, 0x77, 0x1F,
+    0xF0, 0xF3, 0x96, 0x62, 0x3E, 0x79, 0x58, 0x66, 0x6D, 0xC2, 0x09, 0xC4, 0x37, 0x3E, 0xC6, 0x99,
+    0x6F, 0x54, 0x6E, 0x7F, 0x4B, 0xD6, 0xFC, 0x69, 0xFE, 0x10, 0x62, 0x44, 0x48, 0xAE, 0x0F, 0xC6,
+    0xAA, 0x8D, 0x61, 0x84, 0x6C, 0x2D, 0xE6, 0x1F, 0x17, 0x2F, 0x5C, 0xDD, 0x68, 0x66, 0x0A, 0x2D,
+    0x85, 0x1C, 0x9D, 0x5C, 0xBD, 0x72, 0x35, 0xFA, 0xC7, 0xB1, 0x8E, 0x89, 0x6A, 0x43, 0x0E, 0x3A,
+    0x6F, 0x02, 0x14, 0x42, 0x2D, 0xB1, 0x9A, 0x89, 0x5C, 0xF9, 0x06, 0xD4, 0xDE, 0x3A, 0xC8, 0x54,
+    0x06, 0xC0, 0xF8, 0x58, 0x76, 0xF5, 0xB1, 0x89, 0x54, 0xDB, 0x04, 0x1A, 0xDA, 0x13, 0x99, 0x4E,
+    0x09, 0xFE, 0x6A, 0xCF, 0x2A, 0xAD, 0x62, 0x2D, 0xA1, 0x8E, 0x79, 0xEC, 0x5F, 0xA1, 0xF1, 0x50,
+    0x6C, 0xCF, 0xC7, 0x7A, 0x1C, 0x9D, 0xAA, 0x8A, 0x6C, 0xAA, 0x51, 0xBC, 0xFD, 0xC0, 0x28, 0x5E,
+    0xE0, 0x1F, 0x01, 0xC5, 0x9C, 0x05, 0xA0, 0x0E, 0xD5, 0x06, 0x0C, 0x8B, 0x5D, 0xA1, 0xD0, 0xB7,
+    0x35, 0x83, 0xD9, 0x4A, 0xF5, 0xD0, 0x4C, 0x66, 0x01, 0x7E, 0x95, 0xB2, 0xFD, 0xDB, 0x29, 0x07,
+    0x29, 0xEC, 0x78, 0x27, 0x33, 0x50, 0x2C, 0xCD, 0x08, 0xE8, 0x99, 0x35, 0xD6, 0x61, 0xF5, 0x50,
+    0x86, 0x66, 0x02, 0x54, 0x2E, 0x40, 0xE3, 0x36, 0x20, 0x9B, 0xAA, 0xF6, 0x6F, 0xAF, 0x56, 0x88,
+    0xC9, 0xBC, 0x88, 0xF0, 0xEE, 0x9E, 0x4E, 0x84, 0x78, 0xF7, 0x4C, 0xDE, 0x1B, 0x07, 0x7F, 0x38,
+    0xDC, 0xB8, 0x72, 0x38, 0x3C, 0x19, 0xAB, 0x03, 0x3E, 0x26, 0xBD, 0x2C, 0x85, 0x46, 0xCB, 0x55,
+    0xC5, 0x82, 0xFE, 0x08, 0xA8, 0x95, 0x6A, 0x8F, 0x45, 0x07, 0x6D, 0xAC, 0xF7, 0xD8, 0x99, 0x1F,
+    0x66, 0xA3, 0x90, 0xA3, 0x9B, 0x31, 0x8A, 0xAD, 0x08, 0x94, 0xAC, 0xEF, 0x0F, 0xB4, 0x44, 0x3E,
+    0xF9, 0x14, 0xBF, 0xC4, 0x7E, 0x37, 0xE1, 0x8C, 0xF7, 0x9D, 0x6A, 0x71, 0x53, 0x3B, 0x9F, 0x23,
+    0x8D, 0xF6, 0x8C, 0x20, 0xDE, 0x85, 0x13, 0x7B, 0x2A, 0xD5, 0x7B, 0xA4, 0x82, 0x9C, 0x7F, 0x97,
+    0xCF, 0xA0, 0x67, 0x04, 0xC3, 0xB7, 0xE5, 0x68, 0x7C, 0x37, 0x52, 0xCE, 0x6F, 0x82, 0xE3, 0xFD,
+    0xBC, 0xD8, 0x1F, 0x0B, 0x50, 0x6D, 0x6F, 0x81, 0x5C, 0x9F, 0xED, 0x8F, 0x2D, 0x6C, 0x7C, 0x2A,
+    0x6A, 0x8C, 0xB9, 0x94, 0x2B, 0x7B, 0x0F, 0x87, 0x96, 0x98, 0x28, 0x89, 0xA9, 0x2C, 0x52, 0x9A,
+    0xAE, 0x9B, 0x0F, 0x31, 0x44, 0xAC, 0x16, 0x90, 0x67, 0x68, 0x31, 0x1B, 0x95, 0x07, 0x4D, 0x6C,
+    0x50, 0xAF, 0x18, 0xB7, 0xCF, 0x82, 0x0D, 0x67, 0xD3, 0x64, 0x13, 0x9B, 0x93, 0x9F, 0x50, 0xC4,
+    0xF9, 0x90, 0x54, 0xD0, 0x12, 0x83, 0xC7, 0xDB, 0xC7, 0xE9, 0x2B, 0x8E, 0x44, 0xAB, 0xE9, 0x8C,
+    0x3A, 0x1F, 0xE1, 0xD1, 0x2A, 0xC5, 0xE8, 0xE7, 0xEC, 0x9A, 0xF5, 0xBC, 0xC6, 0xF0, 0xD9, 0x23,
+    0x42, 0x9D, 0x2B, 0x50, 0x49, 0xA3, 0x91, 0x42, 0xB9, 0xFD, 0xBE, 0x9E, 0x58, 0x18, 0xC6, 0xF7,
+    0x1E, 0x0B, 0xF0, 0x9A, 0x15, 0x86, 0x8D, 0x4C, 0x2B, 0x85, 0x16, 0x4A, 0x4D, 0x94, 0xEA, 0xE3,
+    0x78, 0xE4, 0x32, 0xDF, 0xF9, 0x2C, 0x18, 0x3D, 0xA5, 0x42, 0x52, 0xDF, 0xE9, 0xF5, 0xA9, 0xD4,
+    0x8F, 0x16, 0xAE, 0xB4, 0x5B, 0x22, 0xD0, 0x18, 0x1F, 0x59, 0x91, 0x79, 0x2A, 0xC1, 0xCB, 0xF5,
+    0xA0, 0x87, 0x1F, 0x19, 0x4F, 0x7B, 0x0D, 0x64, 0xBD, 0xEC, 0x00, 0xBB, 0x5D, 0xF6, 0xD2, 0x65,
+    0xEB, 0x77, 0x02, 0x7A, 0x73, 0xF4, 0xCE, 0xB2, 0x37, 0x47, 0xD7, 0x63, 0x51, 0x4F, 0xCA, 0xC3,
+    0xF9, 0xC8, 0xF6, 0x3B, 0xBD, 0xAA, 0xB4, 0xB5, 0xE4, 0xD2, 0x98, 0xA4, 0xB5, 0x5E, 0xF7, 0xA5,
+    0xA8, 0x77, 0x42, 0x7D, 0x22, 0xD3, 0x8F, 0x47, 0x92, 0xBD, 0x63, 0xE7, 0xEA, 0xBB, 0x73, 0x1A,
+    0x7E, 0xA2, 0xE7, 0xFF, 0x5F, 0x47, 0xE6, 0xBD, 0x96, 0xBD, 0xAA, 0x50, 0xEA, 0x13, 0x37, 0x5F,
+    0x9A, 0x12, 0xC5, 0x3F, 0xD3, 0x9C, 0x27, 0x2E, 0xBF, 0x0D, 0x91, 0xD5, 0xBF, 0x62, 0x43, 0xC4,
+    0xC8, 0x03, 0x4D, 0xD8, 0x89, 0xFC, 0xFB, 0xAB, 0x05, 0xBB, 0x54, 0x89, 0x82, 0xDC, 0xCD, 0x26,
+    0x15, 0x30, 0x2A, 0xE2, 0x1A, 0xC3, 0xDD, 0xA7, 0x34, 0x36, 0x5B, 0x62, 0xD9, 0x3E, 0xB1, 0xF3,
+    0xCF, 0x96, 0x32, 0xBD, 0xDA, 0xDA, 0xBD, 0xE5, 0xD4, 0xE9, 0x11, 0xAD, 0xEE, 0x8E, 0x99, 0xDB,
+    0x39, 0x62, 0xF6, 0xA1, 0xF1, 0x31, 0x5F, 0xF0, 0x63, 0x0D, 0x6F, 0xC2, 0x43, 0x22, 0x76, 0x01,
+    0xC3, 0x14, 0x01, 0x99, 0xF9, 0x37, 0x86, 0x09, 0x4C, 0xA0, 0x9E, 0xA1, 0x10, 0x55, 0x80, 0xC8,
+    0x72, 0x80, 0x61, 0xCA, 0xF4, 0x3F, 0x3C, 0x8B, 0x9D, 0x19, 0x24, 0x67, 0x02, 0x56, 0x0A, 0x85,
+    0x30, 0xDB, 0xEF, 0xEB, 0x03, 0xEA, 0xCB, 0x8D, 0x6E, 0x1A, 0xC6, 0x4C, 0xAD, 0x59, 0xAC, 0x67,
+    0x70, 0x29, 0xE1, 0x8B, 0x3E, 0xB8, 0xBD, 0xA5, 0x0A, 0x0C, 0x2F, 0xE9, 0xB3, 0x9F, 0xD4, 0x4B,
+    0x1A, 0x07, 0x4D, 0x56, 0x9A, 0x1A, 0xF9, 0x52, 0x1A, 0x2B, 0xCD, 0xD8, 0x34, 0xBD, 0x37, 0x7E,
+    0x1E, 0x7B, 0xF5, 0x6D, 0xED, 0x7D, 0x7B, 0x35, 0xFB, 0xA8, 0xBE, 0x7E, 0x1D, 0xAC, 0xB4, 0x1D,
+    0xAB, 0xAF, 0xFF, 0x4A, 0x7B, 0x75, 0x3E, 0xA6, 0x70, 0xED, 0xAE, 0x3B, 0xD3, 0x2E, 0x3C, 0xFB,
+    0x26, 0xCF, 0x63, 0xE3, 0x08, 0x9D, 0xF9, 0x1E, 0xB1, 0x97, 0x44, 0xF6, 0xC5, 0x23, 0x77, 0xF8,
+    0x6A, 0x0C, 0x66, 0xC6, 0x5A, 0x0A, 0x66, 0x7B, 0x4A, 0x4F, 0xCE, 0x0C, 0xE3, 0xAF, 0xD3, 0x78,
+    0x7E, 0xAB, 0x0E, 0x7C, 0xA2, 0x59, 0x31, 0x5A, 0xC9, 0x14, 0x28, 0x34, 0x53, 0xC6, 0x66, 0x6A,
+    0x7D, 0xA1, 0x27, 0x26, 0xE4, 0x1E, 0xFD, 0x83, 0xCE, 0x33, 0x18, 0x3D, 0xA5, 0x3B, 0xB1, 0x46,
+    0x57, 0xA1, 0xD0, 0x36, 0x70, 0xE5, 0x7A, 0xED, 0x22, 0x05, 0xB2, 0x58, 0x28, 0x7E, 0x2F, 0x44,
+    0xC0, 0xBF, 0xDB, 0x76, 0x24, 0xF9, 0x6F, 0x48, 0x91, 0xB6, 0x4B, 0x45, 0xDA, 0xA9, 0xA9, 0x43,
+    0xFC, 0xFB, 0xC1, 0x75, 0xA9, 0x1E, 0xD9, 0x86, 0xA8, 0x03, 0xEB, 0x35, 0x15, 0x69, 0x47, 0x30,
+    0x90, 0x52, 0xA4, 0x7C, 0x75, 0xEC, 0xD6, 0x95, 0xC5, 0x60, 0xF4, 0x54, 0xBF, 0x7B, 0xFC, 0xDA,
+    0x47, 0x85, 0x18, 0x3F, 0xF0, 0xE9, 0xE4, 0xDE, 0xE9, 0x48, 0x7D, 0x49, 0x35, 0x17, 0xA9, 0xD4,
+    0xE2, 0xF1, 0x3F, 0x3D, 0x6D, 0x8B, 0x9F, 0x7F, 0x91, 0xF6, 0x30, 0xF2, 0x9E, 0xEE, 0xDB, 0x72,
+    0x48, 0x85, 0xDA, 0x52, 0xBE, 0xDA, 0xA8, 0xD5, 0xD6, 0x01, 0x3B, 0x63, 0x67, 0x1E, 0xDB, 0x9B,
+    0x5B, 0xC4, 0xC9, 0xDD, 0x80, 0xD6, 0xCC, 0x50, 0xF5, 0x9D, 0x83, 0xEE, 0x07, 0x2B, 0x91, 0xF3,
+    0x95, 0x9C, 0x8C, 0x54, 0xAE, 0xFD, 0x0B, 0x5E, 0xC4, 0x2C, 0x55, 0xD4, 0xE4, 0x89, 0xF9, 0x9B,
+    0x5D, 0x0C, 0xBA, 0xB8, 0xFD, 0x73, 0xAE, 0xB4, 0x0F, 0xA9, 0xD2, 0x3E, 0xA4, 0x4A, 0xFB, 0xE5,
+    0xA7, 0x5A, 0x84, 0xFA, 0x6C, 0x11, 0xA2, 0x3B, 0xB2, 0xEB, 0x66, 0x9F, 0x00, 0xA2, 0x7D, 0x11,
+    0xFC, 0xDE, 0x77, 0x28, 0x0F, 0x72, 0xBC, 0xA7, 0xFB, 0xB6, 0x7A, 0xA4, 0x42, 0xC3, 0xA7, 0xE5,
+    0x8D, 0xD6, 0x53, 0xA5, 0xFC, 0xCA, 0x63, 0x70, 0x0D, 0xBE, 0xF4, 0x7F, 0xDE, 0xF7, 0xE0, 0xD1,
+    0x47, 0x7E, 0xE7, 0xEF, 0xBD, 0xFF, 0xE3, 0x66, 0x2A, 0xC7, 0x7A, 0xFE, 0xEF, 0xFF, 0x9F, 0xFF,
+    0xE2, 0x7F, 0x2C, 0xFA, 0x9F, 0xF5, 0xBF, 0xE4, 0x7F, 0x7C, 0x1C, 0xB2, 0x29, 0x16, 0xB9, 0x99,
+    0xFC, 0xE2, 0x22, 0x58, 0xE9, 0x4E, 0x8B, 0x7F, 0x2F, 0xFF, 0xA8, 0x68, 0xDF, 0xC9, 0x7B, 0xCB,
+    0xBE, 0x68, 0xAF, 0xF3, 0xDE, 0x48, 0xE0, 0xFB, 0xB9, 0x7D, 0xC9, 0x52, 0x16, 0x2E, 0x1F, 0xE1,
+    0x0F, 0xE0, 0xFD, 0x60, 0xA0, 0xB8, 0x77, 0xF1, 0x45, 0x2B, 0xB9, 0x17, 0x78, 0x47, 0x3E, 0x66,
+    0xAE, 0x6A, 0xDF, 0xC1, 0x7B, 0x32, 0xC7, 0xF5, 0x77, 0xC4, 0x12, 0xA5, 0x9F, 0xEB, 0x97, 0x47,
+    0xAC, 0x36, 0x23, 0x7D, 0x43, 0xFA, 0x33, 0x29, 0x5C, 0x3B, 0x1C, 0x78, 0xC3, 0x0F, 0xAE, 0x1D,
+    0x0E, 0x87, 0x83, 0xA4, 0x88, 0xCD, 0x7D, 0x4B, 0x92, 0xAE, 0x1D, 0x0E, 0x87, 0x1B, 0x17, 0xFB,
+    0xE3, 0x79, 0xFD, 0x98, 0xC7, 0x99, 0xD7, 0xDC, 0x1E, 0x6E, 0x79, 0xFB, 0x7A, 0x30, 0x9B, 0x0A,
+    0x0D, 0x4E, 0xAF, 0xFE, 0xF2, 0xBE, 0xF9, 0x8B, 0x2F, 0xBE, 0xED, 0xD9, 0xC3, 0xE1, 0x70, 0xF8,
+    0xE8, 0xFD, 0xF7, 0x96, 0xCA, 0x66, 0x38, 0xD5, 0xAA, 0x9D, 0x1E, 0xF7, 0x2E, 0x2E, 0x2E, 0x2E,
+    0x7A, 0xD6, 0x4C, 0xCE, 0x7A, 0x13, 0x72, 0xA1, 0xBE, 0x73, 0x76, 0xAC, 0xBD, 0xF1, 0x95, 0xE7,
+    0x0B, 0x40, 0x33, 0x76, 0xB3, 0x26, 0x39, 0xB9, 0xC1, 0xD9, 0xB1, 0x99, 0x8C, 0x2F, 0x97, 0x6C,
+    0xE5, 0x13, 0xC0, 0x9A, 0x2D, 0xA5, 0xAA, 0xAD, 0x50, 0xB9, 0x15, 0x2A, 0xB6, 0x5C, 0xC5, 0x5A,
+    0x6C, 0x65, 0x28, 0x83, 0x59, 0xCC, 0x5C, 0xFB, 0xDA, 0xDB, 0xD1, 0xBA, 0xA1, 0x1F, 0xD8, 0x78,
+    0x57, 0xF2, 0x0D, 0x9B, 0xB1, 0xE9, 0xBB, 0x59, 0x5E, 0x93, 0x9C, 0x5E, 0x92, 0x93, 0x53, 0x3F,
+    0x38, 0xF5, 0x76, 0x1C, 0x5C, 0x33, 0xD9, 0xD1, 0xF8, 0xDA, 0x97, 0x4B, 0x35, 0x67, 0x6B, 0x11,
+    0xF8, 0x44, 0x74, 0x2C, 0xE0, 0x5F, 0xB6, 0x31, 0x26, 0x34, 0x73, 0x2A, 0x86, 0xD9, 0x80, 0xAE,
+    0x85, 0xDA, 0xA1, 0x2F, 0xDD, 0x93, 0x4D, 0x4B, 0xF6, 0xBD, 0x67, 0xED, 0xD5, 0x17, 0x30, 0x0E,
+    0xCA, 0x09, 0xF2, 0x25, 0xF9, 0xA7, 0x5D, 0x2A, 0xBE, 0xDF, 0xBD, 0xC6, 0x6C, 0x03, 0x86, 0x3E,
+    0xD6, 0xDB, 0xD4, 0x3E, 0xC5, 0x54, 0x8F, 0x46, 0x24, 0xE0, 0x3B, 0x7B, 0xFC, 0xA9, 0x36, 0x7D,
+    0x98, 0x99, 0xD2, 0xA7, 0x65, 0x01, 0xF4, 0xA5, 0x7B, 0x2A, 0x24, 0x85, 0x5A, 0xD2, 0xF4, 0xDF,
+    0x3D, 0xE9, 0xFF, 0x45, 0xA2, 0xEC, 0x0E, 0x7B, 0xA1, 0x4E, 0xE3, 0xD3, 0xBB, 0xE7, 0x21, 0x16,
+    0x01, 0xE4, 0x9F, 0x6B, 0x3E, 0xF0, 0x5F, 0x9B, 0x64, 0x1D, 0xF5, 0x29, 0xBD, 0xFA, 0xEA, 0x9A,
+    0xD1, 0x71, 0x3D, 0x52, 0x7E, 0xE3, 0xBB, 0xF7, 0x49, 0xE1, 0x9A, 0xE5, 0xD8, 0x3E, 0x30, 0xD3,
+    0xA7, 0xB4, 0x48, 0x9D, 0x5E, 0xD5, 0x6B, 0x9A, 0x15, 0xAA, 0x85, 0x47, 0x22, 0x69, 0xBC, 0x9B,
+    0x28, 0x35, 0xD1, 0x69, 0x2A, 0xA5, 0xA9, 0x93, 0x5E, 0x91, 0x42, 0xA7, 0xB5, 0xD4, 0x4A, 0xB7,
+    0x52, 0xAE, 0xF0, 0xFE, 0x94, 0xFA, 0x6E, 0xF5, 0x4D, 0x49, 0xC3, 0xAA, 0xF1, 0x59, 0xB2, 0x96,
+    0xC7, 0x8A, 0x95, 0xE1, 0x8E, 0x5C, 0xE7, 0xE5, 0x9B, 0x60, 0x67, 0x23, 0xB3, 0xE4, 0x6A, 0x9F,
+    0xE5, 0xD7, 0xCE, 0x2E, 0x75, 0x37, 0x1E, 0xA2, 0x2B, 0xFA, 0x9B, 0xE1, 0x7D, 0xE5, 0x5F, 0x9F,
+    0xAE, 0xB8, 0xFD, 0x2E, 0xBB, 0x16, 0xBF, 0x1C, 0x5D, 0xC1, 0xBB, 0xE0, 0x92, 0x5C, 0x7D, 0xF5,
+    0xDF, 0x4E, 0xEF, 0x79, 0xF7, 0xC7, 0x7F, 0xE7, 0xDD, 0x7F, 0xEF, 0xFA, 0xBB, 0xAF, 0xF0, 0x6E,
+    0x7E, 0xCE, 0xFF, 0x03, 0x8F, 0x3E, 0x0A, 0xEF, 0x7B, 0x0F, 0x98, 0xAA, 0xA5, 0x78, 0x79, 0x84,
+    0xF9, 0x0F, 0x6E, 0x5E, 0x84, 0xF7, 0x0C, 0x0A, 0xEF, 0x79, 0x01, 0xFF, 0x07, 0x2F, 0x14, 0x2F,
+    0x8F, 0x2F, 0x98, 0xAA, 0x7D, 0xE1, 0x7D, 0xEF, 0xE1, 0x85, 0x47, 0x1F, 0xE5, 0x05, 0xF8, 0x85,
+    0xFD, 0x8B, 0x71, 0xDB, 0x23, 0xF0, 0xF1, 0xF7, 0x91, 0x4D, 0x9E, 0xF2, 0x19, 0xC7, 0x3B, 0x0D,
+    0x7C, 0xDC, 0x5E, 0x3C, 0xF7, 0x71, 0xAB, 0xED, 0x9D, 0x86, 0x5F, 0x2D, 0x9F, 0x71, 0xBF, 0x9A,
+    0x4D, 0xFE, 0x57, 0xF9, 0xF8, 0xFB, 0x7E, 0x95, 0x47, 0x1E, 0xF9, 0x55, 0xE0, 0x17, 0xF9, 0x2F,
+    0x3D, 0xDE, 0xC2, 0x59, 0x25, 0xEB, 0x8B, 0x7B, 0xCC, 0x10, 0x4E, 0xFD, 0x6F, 0x6A, 0x85, 0x23,
+    0x62, 0x94, 0xE9, 0xD5, 0x70, 0x6C, 0xE6, 0x6D, 0x96, 0xDA, 0x1F, 0x2B, 0x09, 0x06, 0x67, 0xC7,
+    0xE4, 0x85, 0x51, 0xAC, 0xA8, 0x3D, 0x16, 0xD3, 0xF9, 0x62, 0x4D, 0xD5, 0xBF, 0x30, 0xF4, 0xC6,
+    0x1F, 0x5B, 0x5E, 0xAD, 0x74, 0x6E, 0xAF, 0xE5, 0x31, 0x73, 0xB1, 0xED, 0x35, 0xC0, 0xD8, 0xD1,
+    0x78, 0x33, 0x71, 0x1D, 0x78, 0x14, 0xF5, 0xEA, 0xC5, 0x10, 0xA0, 0x5B, 0x73, 0x3D, 0x15, 0x2A,
+    0x6F, 0x14, 0x30, 0x5A, 0x0B, 0xC9, 0x75, 0xAD, 0x14, 0xD0, 0xAB, 0xA1, 0xD4, 0x52, 0x2C, 0x66,
+    0xA9, 0xBD, 0x59, 0xEA, 0x39, 0xFF, 0xF7, 0x58, 0x37, 0x38, 0x3B, 0x76, 0xCE, 0x8E, 0x90, 0xAF,
+    0xC5, 0x8A, 0x9E, 0x5C, 0x51, 0x0F, 0xF5, 0x54, 0xFB, 0x62, 0xAD, 0x7D, 0xB1, 0x02, 0x62, 0xE8,
+    0x8D, 0x1F, 0x9C, 0x99, 0xC1, 0xF8, 0x62, 0xA5, 0x7B, 0x79, 0xA3, 0x73, 0x30, 0xF4, 0x66, 0x2E,
+    0x36, 0xB3, 0xE4, 0x82, 0x2A, 0x60, 0x47, 0xE3, 0xED, 0x64, 0x66, 0xE8, 0x1C, 0xEA, 0x87, 0x7E,
+    0xE8, 0x07, 0x47, 0xB1, 0x92, 0xEB, 0xA9, 0x90, 0xE9, 0x43, 0x21, 0x75, 0x4F, 0x96, 0x2B, 0xA4,
+    0x91, 0x5C, 0x50, 0x6A, 0x89, 0xA5, 0x29, 0xD5, 0x0C, 0xF9, 0x3D, 0xC8, 0xFF, 0x7D, 0x0B, 0x85,
+    0x7B, 0xF3, 0x38, 0x6D, 0xCE, 0xB7, 0x42, 0xE5, 0x66, 0x56, 0x13, 0x9A, 0xD9, 0x4E, 0x9D, 0x53,
+    0x7B, 0xB9, 0x17, 0x5A, 0xCC, 0xF9, 0x94, 0x6F, 0x45, 0x28, 0x54, 0xAD, 0xE5, 0x66, 0x82, 0x59,
+    0xEB, 0xC5, 0x04, 0xEB, 0x9B, 0xD9, 0x4E, 0x76, 0x1A, 0x5C, 0xE7, 0xD4, 0xEA, 0x03, 0x1B, 0x97,
+    0x59, 0xE0, 0x5D, 0xFC, 0xD6, 0xFE, 0x8E, 0xEF, 0xE7, 0x37, 0xF9, 0x07, 0x34, 0x93, 0xF1, 0xC6,
+    0x9B, 0x50, 0x85, 0x72, 0x2D, 0xB7, 0x42, 0xB1, 0xF1, 0x78, 0x1F, 0x8B, 0xA6, 0x87, 0x71, 0x18,
+    0xBB, 0xC9, 0x7A, 0x3B, 0x59, 0x5F, 0xFB, 0xDA, 0x9B, 0xD9, 0x2C, 0x66, 0xAE, 0x96, 0x22, 0xE4,
+    0x4B, 0x16, 0x08, 0xBC, 0x8B, 0xFF, 0x3C, 0xD6, 0x41, 0xE6, 0xBE, 0x08, 0xA8, 0xB7, 0xBE, 0x5A,
+    0x91, 0x6B, 0xE6, 0x62, 0xA3, 0x73, 0xD5, 0xCC, 0x9A, 0xCA, 0x24, 0x73, 0x9F, 0xF9, 0x22, 0xE4,
+    0x2B, 0xEA, 0xE5, 0xAC, 0x6F, 0xE6, 0x6A, 0x2D, 0x85, 0x9C, 0x5C, 0x33, 0xD7, 0x4B, 0xB1, 0xE5,
+    0xA2, 0x73, 0x76, 0xAC, 0xE6, 0x32, 0xB0, 0x72, 0xC9, 0x5B, 0x8F, 0xE5, 0x95, 0xFC, 0x21, 0xBF,
+    0xCB, 0x27, 0xB0, 0xAE, 0x19, 0x6B, 0x5F, 0x6C, 0x85, 0x72, 0x61, 0x7D, 0x33, 0xD7, 0x4B, 0xAE,
+    0x0F, 0xC8, 0xC9, 0x99, 0x60, 0x42, 0xB5, 0x12, 0xEF, 0xB4, 0xD8, 0x72, 0x65, 0x6A, 0x6B, 0x6F,
+    0xE6, 0x6A, 0x61, 0x68, 0x3B, 0x67, 0x5D, 0x31, 0xE7, 0x4B, 0x16, 0x78, 0x2B, 0x6F, 0xE5, 0x6D,
+    0x40, 0x9F, 0x82, 0x34, 0xB9, 0x08, 0x7C, 0x6A, 0x70, 0xE8, 0x83, 0x01, 0xB5, 0x9D, 0x1B, 0xDA,
+    0x72, 0x21, 0xF3, 0x54, 0x81, 0x66, 0x46, 0x63, 0xA9, 0xB6, 0x5E, 0xB1, 0x33, 0x9D, 0x67, 0x98,
+    0xB1, 0x21, 0x16, 0xFE, 0x82, 0x7A, 0x6C, 0xCF, 0x15, 0xF2, 0x89, 0x32, 0x50, 0xC4, 0x36, 0x20,
+    0x83, 0xC7, 0x2E, 0x34, 0x81, 0x3A, 0xD0, 0xCD, 0x59, 0xFC, 0xF3, 0x48, 0xEB, 0x68, 0x79, 0x24,
+    0x71, 0x07, 0x1F, 0x7D, 0x3F, 0xC0, 0xBF, 0x1B, 0xA8, 0xC6, 0x3C, 0x34, 0xAE, 0xF6, 0xE5, 0x5C,
+    0xF9, 0xDA, 0xD7, 0x63, 0x11, 0xCC, 0xD4, 0xB5, 0x28, 0xFB, 0xC0, 0x06, 0xD6, 0x15, 0x0B, 0x98,
+    0xC9, 0x4C, 0x50, 0x2C, 0xB6, 0x27, 0x6B, 0x37, 0x65, 0xAD, 0x99, 0xBA, 0x60, 0x7C, 0xE3, 0x6B,
+    0x5F, 0xFB, 0xC6, 0x37, 0x73, 0xED, 0xCD, 0x38, 0xAC, 0xD5, 0x44, 0x1E, 0x06, 0xA0, 0x9A, 0x1B,
+    0x07, 0xF5, 0x58, 0x79, 0xE8, 0xDA, 0x22, 0x90, 0xAD, 0x95, 0x13, 0xC5, 0x52, 0x7B, 0xEB, 0xCC,
+    0x54, 0x7B, 0x33, 0xD9, 0xDE, 0xF8, 0x62, 0x19, 0xB8, 0xDA, 0x13, 0xDE, 0x0D, 0xF0, 0xAF, 0xF6,
+    0x79, 0xBE, 0xC1, 0x95, 0xEB, 0xD4, 0x0B, 0x3B, 0x2B, 0xA1, 0x12, 0x9D, 0xC7, 0xCE, 0xB9, 0x5C,
+    0x26, 0x67, 0x56, 0x2A, 0x61, 0x3D, 0x36, 0xF1, 0x16, 0xAA, 0x8D, 0x42, 0x34, 0x3E, 0xFD, 0x49,
+    0x37, 0x16, 0x1B, 0xB9, 0x30, 0x33, 0xD5, 0x42, 0xE7, 0xB0, 0x63, 0x26, 0x10, 0xE5, 0x42, 0x11,
+    0x68, 0x46, 0xCC, 0xC4, 0x00, 0xB6, 0x2D, 0x02, 0xAC, 0x98, 0x89, 0xD2, 0x63, 0x5B, 0x7E, 0x0D,
+    0xEE, 0xE7, 0x8C, 0x55, 0x9E, 0xAE, 0x65, 0x98, 0x4A, 0x51, 0xA8, 0x6D, 0x02, 0x26, 0xA0, 0x09,
+    0x3B, 0xE5, 0x82, 0xFF, 0x92, 0xEC, 0xF6, 0xDE, 0x77, 0xF5, 0xBE, 0x87, 0xD5, 0x87, 0xF5, 0x9A,
+    0x56, 0x6D, 0xD7, 0x0E, 0xE7, 0xA5, 0xF7, 0xF6, 0xAC, 0xC1, 0x53, 0x3D, 0x9F, 0x6A, 0x9A, 0x62,
+    0x41, 0x53, 0x54, 0x62, 0xB1, 0x94, 0x29, 0x95, 0x54, 0x6C, 0x1C, 0xFB, 0x23, 0xA5, 0xE7, 0xAE,
+    0x3D, 0x55, 0xD5, 0x46, 0x85, 0x94, 0x3A, 0x3A, 0x8E, 0xEC, 0x0E, 0x44, 0x82, 0xE3, 0x62, 0xA7,
+    0xA1, 0xF2, 0xAC, 0x2D, 0x61, 0x7A, 0xEB, 0xED, 0x54, 0xA1, 0x98, 0x25, 0xE0, 0xBD, 0x3F, 0xC5,
+    0xA9, 0xF1, 0xED, 0xB2, 0xFB, 0x20, 0xD2, 0xDF, 0x86, 0xAB, 0xB7, 0x69, 0xD4, 0xE7, 0x0A, 0x85,
+    0xD4, 0xD7, 0x0A, 0x46, 0x6A, 0xA5, 0x25, 0xC6, 0x48, 0x7E, 0xFD, 0x58, 0xA8, 0xBE, 0x3B, 0x7C,
+    0xAD, 0xAD, 0xFD, 0x5B, 0x50, 0x8B, 0x75, 0x14, 0x2B, 0xD9, 0x06, 0xC6, 0x63, 0x3C, 0x0C, 0x3D,
+    0x6A, 0xA9, 0x02, 0x66, 0x81, 0xC1, 0xA1, 0x7E, 0x07, 0x74, 0xD4, 0xA3, 0x16, 0xB3, 0xEC, 0x97,
+    0x75, 0x2D, 0x45, 0x88, 0x34, 0x4E, 0x4D, 0x95, 0x3C, 0x36, 0x22, 0xC5, 0xC3, 0xCC, 0xD5, 0xDB,
+    0x70, 0xF3, 0x41, 0xAE, 0xCB, 0x0C, 0x5D, 0x4F, 0x37, 0x51, 0x88, 0x42, 0x3D, 0x75, 0xD8, 0x0B,
+    0xE4, 0x1B, 0x4F, 0x26, 0xF8, 0x35, 0xC8, 0x6E, 0x1F, 0x85, 0xEA, 0xB7, 0xA1, 0x5A, 0x2B, 0x4D,
+    0xD4, 0xC1, 0x6A, 0xC1, 0x2E, 0x56, 0x2B, 0x9D, 0xB7, 0x12, 0x83, 0xB7, 0x1F, 0x15, 0x9A, 0xFE,
+    0x7E, 0x16, 0xD1, 0x7B, 0x21, 0x47, 0xB6, 0x65, 0xEA, 0x29, 0x42, 0xAE, 0x16, 0x33, 0xE7, 0x02,
+    0x3B, 0xC5, 0x1D, 0x57, 0xAC, 0x94, 0x2B, 0x45, 0xC0, 0xCC, 0x14, 0x01, 0xEB, 0x28, 0x16, 0xBA,
+    0x96, 0x72, 0x66, 0x10, 0xA5, 0x4F, 0xCF, 0x36, 0x50, 0x79, 0xAE, 0xDE, 0x4E, 0x9D, 0xB9, 0xCE,
+    0x9B, 0x56, 0x18, 0x4F, 0x37, 0xA5, 0xF6, 0xDF, 0x9D, 0x47, 0x23, 0x9D, 0x67, 0x70, 0xD8, 0x91,
+    0x5F, 0x83, 0xB7, 0x71, 0x4C, 0xDA, 0x76, 0x53, 0xF6, 0x6C, 0x4C, 0xA4, 0x2C, 0xE4, 0x72, 0x83,
+    0x26, 0xEC, 0x6C, 0xA4, 0xB6, 0x14, 0x52, 0x60, 0xF0, 0xE6, 0xBB, 0x72, 0x66, 0xE5, 0x7A, 0x11,
+    0x62, 0xE2, 0xC1, 0x99, 0x00, 0xE5, 0x92, 0xA9, 0x07, 0x51, 0xCF, 0x24, 0x81, 0x35, 0x0B, 0xCD,
+    0x44, 0xB1, 0x51, 0xAC, 0x51, 0x6B, 0x38, 0xEC, 0x98, 0x06, 0x81, 0xED, 0xB3, 0x0D, 0x8A, 0x39,
+    0xF2, 0x96, 0xDA, 0x4C, 0x81, 0xD2, 0x63, 0x04, 0xFF, 0x0C, 0xDE, 0xFE, 0x40, 0x52, 0xA0, 0xF2,
+    0x54, 0x33, 0xB9, 0xFA, 0x4C, 0x0E, 0x3B, 0x47, 0xAC, 0x3F, 0x76, 0x08, 0x9E, 0x68, 0x3C, 0x3C,
+    0x7B, 0xAA, 0x75, 0x6D, 0x33, 0x4D, 0x14, 0xBD, 0xD5, 0x5D, 0xEC, 0x33, 0x92, 0x7E, 0x7F, 0x6B,
+    0xEE, 0x0E, 0x92, 0x17, 0xB5, 0xC4, 0x0B, 0x5C, 0xD5, 0xF8, 0x40, 0xCE, 0x21, 0x5A, 0x03, 0xD3,
+    0x46, 0x7B, 0x50, 0xCD, 0xD1, 0x22, 0x14, 0x5B, 0xB4, 0x09, 0xB9, 0x9E, 0x39, 0x59, 0x05, 0xB9,
+    0x61, 0xEC, 0xA6, 0x64, 0x19, 0x92, 0x6D, 0x30, 0x4B, 0xB4, 0x0E, 0x55, 0x88, 0xF6, 0xE1, 0x68,
+    0x21, 0xD6, 0x64, 0x23, 0xDE, 0xB6, 0xE7, 0x73, 0xB6, 0xBD, 0xBF, 0x5E, 0x19, 0xCC, 0x62, 0x5D,
+    0xF3, 0xE7, 0x1B, 0xDD, 0x57, 0xE6, 0x4C, 0x9D, 0xAB, 0xB6, 0x8D, 0xE6, 0xD5, 0x05, 0x75, 0x63,
+    0x19, 0xD4, 0x36, 0x7F, 0xB2, 0xA1, 0x2A, 0x98, 0xB9, 0xDE, 0xD4, 0x5B, 0x2D, 0x34, 0x6A, 0xCF,
+    0xB2, 0x4C, 0x79, 0x88, 0xBB, 0xB8, 0x09, 0x30, 0x2C, 0xE4, 0x9A, 0xA9, 0x5E, 0xF3, 0x34, 0xAF,
+    0x78, 0x86, 0xCA, 0xE7, 0xC1, 0x4C, 0x95, 0x37, 0x63, 0xFD, 0xDD, 0x5B, 0xDF, 0xB5, 0xD2, 0x66,
+    0xA5, 0xF5, 0xCA, 0x61, 0xF8, 0x5C, 0x0C, 0x47, 0x86, 0xE3, 0xE6, 0xA6, 0xD1, 0x82, 0x34, 0x95,
+    0x52, 0xDB, 0x38, 0xD8, 0xA0, 0xBC, 0x1B, 0xCB, 0xE2, 0x24, 0xC7, 0x55, 0xB5, 0x11, 0xE5, 0x5E,
+    0xA0, 0x99, 0xC8, 0x04, 0xCD, 0x72, 0xE5, 0x4B, 0xEA, 0x1B, 0xCD, 0x74, 0xDB, 0x39, 0xEA, 0x7D,
+    0x2B, 0x50, 0x6A, 0xA5, 0xD1, 0xE7, 0x18, 0xA6, 0x68, 0xE4, 0x03, 0x98, 0xC8, 0xA8, 0x69, 0xED,
+    0xF7, 0xE5, 0xAC, 0x6B, 0x46, 0xDB, 0xD7, 0x53, 0xD7, 0xD7, 0x93, 0xED, 0xEB, 0xD1, 0x3A, 0xEB,
+    0x9A, 0xBF, 0x50, 0x6F, 0xB4, 0xC5, 0x16, 0x37, 0x57, 0xA0, 0x96, 0x9E, 0x89, 0xB7, 0xFB, 0x0D,
+    0x5F, 0x2E, 0x2F, 0xA2, 0xD2, 0x59, 0x87, 0x99, 0xC9, 0x37, 0xE8, 0x1C, 0xC6, 0x1F, 0x5F, 0xCD,
+    0xE4, 0x22, 0x09, 0x13, 0xB6, 0x3D, 0x15, 0xAE, 0xDC, 0xDA, 0xA8, 0x24, 0x86, 0xDF, 0x5B, 0x8B,
+    0x50, 0x2E, 0xF5, 0xD4, 0x8C, 0xD6, 0x09, 0x7D, 0xCB, 0x13, 0xF9, 0x32, 0x0C, 0xCF, 0xCF, 0xD5,
+    0xDC, 0x78, 0xDB, 0xDB, 0x97, 0x57, 0x54, 0x2D, 0x65, 0xA8, 0xEF, 0x0E, 0x63, 0x64, 0xD6, 0xF7,
+    0xE7, 0xAC, 0xB6, 0x9E, 0x4E, 0x1E, 0x7D, 0x3E, 0xE4, 0x6B, 0x11, 0x8A, 0x90, 0xAF, 0xC5, 0x92,
+    0xAD, 0xE5, 0x92, 0xAD, 0x45, 0xC8, 0xD7, 0x42, 0xBF, 0x1F, 0x29, 0x74, 0x8D, 0x7C, 0x24, 0xF1,
+    0x0E, 0x8E, 0x4A, 0xFC, 0x67, 0x5A, 0xB0, 0x1A, 0xB1, 0x29, 0x0B, 0x76, 0xE5, 0xF6, 0xDB, 0x73,
+    0xBD, 0x22, 0xB3, 0x75, 0x21, 0x7F, 0xFD, 0x5B, 0xBE, 0x0A, 0x8D, 0xB3, 0xE3, 0x8A, 0x0A, 0x5F,
+    0xCE, 0xB5, 0x6B, 0xDC, 0x25, 0x5B, 0xF1, 0xA3, 0x3B, 0xB3, 0x51, 0xED, 0xBA, 0x65, 0x40, 0xA7,
+    0x91, 0x34, 0x2B, 0x65, 0x92, 0x95, 0xD5, 0x2C, 0x76, 0xFC, 0x09, 0xB2, 0x62, 0x82, 0x59, 0xEA,
+    0x4D, 0x6E, 0x97, 0x95, 0x9D, 0xEC, 0x52, 0x8F, 0xB5, 0x9E, 0xD1, 0x5A, 0xCA, 0x63, 0x5D, 0xB6,
+    0x51, 0x45, 0x3A, 0x30, 0x65, 0xA0, 0x9E, 0x18, 0xDA, 0x22, 0x60, 0xFC, 0x55, 0x2D, 0x9D, 0xFE,
+    0x62, 0xA7, 0xCC, 0xDF, 0x5A, 0xA9, 0xB4, 0x22, 0x85, 0x6A, 0x31, 0x73, 0xD3, 0x37, 0xE3, 0xFB,
+    0x50, 0x4C, 0xC1, 0x74, 0x8E, 0x2A, 0xC0, 0xE0, 0x30, 0x0B, 0x99, 0x5A, 0xEA, 0xB8, 0x24, 0x4D,
+    0xEC, 0x9A, 0xFB, 0xD2, 0xB1, 0xDE, 0x70, 0x98, 0x18, 0xE4, 0x6A, 0x6D, 0xC5, 0x62, 0xFC, 0x3B,
+    0xD9, 0xA0, 0x1E, 0xA9, 0x16, 0x1E, 0xDF, 0x30, 0x9A, 0x18, 0xD4, 0xC7, 0x95, 0x73, 0x94, 0x0B,
+    0xB9, 0xB2, 0x7F, 0xAA, 0xB1, 0xD3, 0x5C, 0x68, 0x39, 0xF5, 0xA2, 0x22, 0x7B, 0xA3, 0x90, 0x97,
+    0xAF, 0x79, 0xEA, 0x57, 0x3C, 0x5D, 0xE5, 0xB3, 0xD5, 0x4C, 0xE5, 0x6C, 0xC6, 0xFA, 0xBB, 0xB7,
+    0xBE, 0xBE, 0x0B, 0xF9, 0xDB, 0x2E, 0x86, 0x2F, 0x46, 0x9B, 0x75, 0x26, 0xE4, 0xBF, 0x71, 0xF1,
+    0xC5, 0xA3, 0x90, 0x7F, 0xFD, 0x06, 0xBB, 0x40, 0xAB, 0x45, 0xEA, 0x63, 0x39, 0xE9, 0x49, 0xC8,
+    0x11, 0xD4, 0xCB, 0x95, 0xA7, 0xE4, 0x1A, 0x2D, 0x0F, 0x08, 0x79, 0x13, 0xC8, 0xB5, 0x52, 0xEB,
+    0x59, 0x86, 0xEF, 0x90, 0xA9, 0xBD, 0x4F, 0xC8, 0x9B, 0x7B, 0x72, 0xD6, 0xD9, 0x37, 0x0A, 0xF9,
+    0x77, 0xA3, 0x90, 0x17, 0x9A, 0xE1, 0x1A, 0xBC, 0xFD, 0xE2, 0xE2, 0x28, 0xE4, 0x55, 0xD8, 0x85,
+    0xBC, 0xFA, 0x99, 0x84, 0xBC, 0xD9, 0x28, 0x25, 0xBA, 0x6F, 0x1C, 0x85, 0xBC, 0xEB, 0x85, 0x3E,
+    0xEF, 0x91, 0x28, 0xE4, 0x19, 0x9E, 0xF7, 0xF7, 0x09, 0x79, 0x11, 0xEA, 0xB9, 0x1B, 0xAD, 0x36,
+    0x1A, 0xF5, 0x27, 0x3D, 0x52, 0xA9, 0xC7, 0xCA, 0xA3, 0xE7, 0xDF, 0x44, 0xC8, 0x3F, 0x1A, 0x85,
+    0xBC, 0x3B, 0x13, 0xF2, 0x52, 0x5C, 0x19, 0x02, 0x9D, 0x26, 0xEC, 0x9A, 0x82, 0xE6, 0x52, 0x8A,
+    0x0E, 0x7E, 0xEC, 0xDC, 0x1F, 0xFB, 0x51, 0xDF, 0x7B, 0x7E, 0x05, 0x3B, 0xD3, 0xB5, 0xD4, 0x81,
+    0xDA, 0x51, 0x89, 0x72, 0xA2, 0x50, 0x9F, 0x7D, 0x61, 0xEF, 0x38, 0x17, 0x13, 0x62, 0x31, 0xD7,
+    0x50, 0xED, 0xFD, 0xF0, 0x53, 0x7F, 0x7C, 0x07, 0xDD, 0xDD, 0xC3, 0xF5, 0x63, 0xA7, 0xE4, 0x0D,
+    0xE0, 0x4B, 0xFA, 0x7E, 0xBF, 0xA7, 0x08, 0x4D, 0x62, 0xAC, 0x9E, 0xFD, 0xBA, 0xD4, 0x78, 0x24,
+    0xDB, 0x34, 0x8A, 0x49, 0xD0, 0x63, 0x59, 0x58, 0x2C, 0x3D, 0x18, 0x62, 0xA1, 0x7C, 0xAA, 0xD4,
+    0x09, 0x90, 0xEB, 0xF7, 0xD4, 0x92, 0xA9, 0xB7, 0x23, 0xC8, 0x19, 0x0F, 0xC3, 0x58, 0x2C, 0x60,
+    0x3D, 0x9F, 0xDB, 0xC9, 0x11, 0x66, 0x4D, 0x80, 0x70, 0x80, 0x58, 0xEB, 0x69, 0x53, 0xB6, 0xD2,
+    0x03, 0x57, 0xEA, 0x70, 0x25, 0xB6, 0xCA, 0xF3, 0xFB, 0x45, 0x37, 0xF5, 0xFD, 0xE7, 0x8E, 0x74,
+    0x82, 0x58, 0x8C, 0x6A, 0x02, 0x90, 0xFF, 0x57, 0x2B, 0x3C, 0x15, 0x9D, 0xB8, 0x54, 0x7B, 0xD4,
+    0x48, 0xD2, 0x5C, 0xAA, 0xBD, 0xA5, 0x99, 0xFF, 0x63, 0x27, 0x13, 0x1C, 0xCE, 0xC9, 0x67, 0x47,
+    0xCD, 0x54, 0x9C, 0x75, 0xEE, 0x2C, 0xF6, 0xBA, 0xCB, 0x08, 0x49, 0xFF, 0xDF, 0xC7, 0x81, 0x3E,
+    0x6A, 0x67, 0x73, 0xFC, 0x8B, 0x3A, 0x70, 0xCC, 0x9A, 0x95, 0x4A, 0x14, 0x35, 0x20, 0x57, 0x6F,
+    0xB4, 0x87, 0xA5, 0x9A, 0x0A, 0xF5, 0xA9, 0x47, 0x99, 0x9D, 0xD1, 0x98, 0xDA, 0xC2, 0xD4, 0x81,
+    0xC1, 0xD7, 0xDB, 0x17, 0xE9, 0x02, 0x95, 0xE8, 0x96, 0x41, 0x42, 0xEA, 0x73, 0xF5, 0x43, 0xB0,
+    0x52, 0xAB, 0xE7, 0x27, 0x24, 0x05, 0x86, 0x91, 0xAE, 0xFF, 0x1D, 0xAC, 0xB4, 0x60, 0x3D, 0xCD,
+    0x94, 0xFA, 0xF4, 0x9A, 0x40, 0xB5, 0x41, 0xA5, 0x3F, 0x8D, 0x30, 0xD3, 0xCE, 0x4D, 0xCE, 0xD4,
+    0x52, 0xC7, 0x0C, 0x3E, 0x0C, 0x8E, 0x4C, 0x3E, 0x75, 0xD7, 0xF5, 0x11, 0xB0, 0x8F, 0xE4, 0x21,
+    0x1E, 0x41, 0xAE, 0x8A, 0xCD, 0x6E, 0xCA, 0x4F, 0xBB, 0xC6, 0x17, 0xB1, 0x01, 0xC3, 0xAB, 0x3F,
+    0x0C, 0xD5, 0x52, 0xA7, 0x32, 0xC2, 0x39, 0x62, 0x62, 0x1E, 0x8C, 0xE6, 0x46, 0xA1, 0x92, 0x16,
+    0xC8, 0x34, 0x65, 0x47, 0x38, 0xFD, 0xCA, 0x91, 0xA3, 0x11, 0x15, 0xE3, 0x2D, 0xCD, 0x31, 0x87,
+    0xEF, 0xF7, 0xC4, 0x98, 0xD1, 0xBD, 0x61, 0xA4, 0xD0, 0x94, 0x87, 0xD8, 0x51, 0xC2, 0x51, 0x07,
+    0x8A, 0x99, 0x42, 0x1C, 0xF3, 0x13, 0xD9, 0xF3, 0xDB, 0xC5, 0xB6, 0x37, 0x91, 0x28, 0xF7, 0x03,
+    0x17, 0xDA, 0x23, 0x45, 0x22, 0x8B, 0x88, 0x6C, 0x2C, 0x70, 0x48, 0x07, 0x32, 0xA4, 0x1C, 0xF9,
+    0x7E, 0x59, 0xAA, 0x8A, 0x9D, 0xA0, 0xC7, 0x68, 0xCC, 0x5E, 0x8C, 0x74, 0x40, 0xB7, 0x17, 0x91,
+    0xA5, 0xAA, 0x89, 0x2A, 0x2E, 0x73, 0x76, 0xFD, 0xC8, 0x47, 0x2F, 0xFB, 0x63, 0xC7, 0xD2, 0xB4,
+    0x6F, 0x62, 0x12, 0x63, 0x4D, 0xFD, 0x79, 0xB2, 0xC3, 0x0D, 0x2B, 0x49, 0xDB, 0x70, 0xF6, 0x9C,
+    0x2A, 0xDA, 0xCE, 0x09, 0x3E, 0xA9, 0x19, 0x64, 0xCC, 0xFF, 0x8D, 0xC7, 0x92, 0xF9, 0xFB, 0xC8,
+    0xF2, 0x6D, 0xCC, 0x95, 0xE5, 0x5A, 0x62, 0x07, 0x88, 0x46, 0xEA, 0xAB, 0xD7, 0xB7, 0x2D, 0x97,
+    0xFD, 0xCA, 0x62, 0xEF, 0x84, 0xCE, 0xCD, 0xF6, 0x65, 0x9F, 0x17, 0xE1, 0x2D, 0x31, 0x2C, 0x28,
+    0x02, 0x7F, 0xD9, 0x17, 0x3B, 0x01, 0xA4, 0x18, 0x4F, 0x7D, 0x86, 0x4C, 0xB8, 0x8F, 0x90, 0x74,
+    0xED, 0xD0, 0x52, 0xFB, 0x41, 0x92, 0xC2, 0xD9, 0xE0, 0xD6, 0x41, 0x7B, 0x59, 0x6F, 0x3C, 0x12,
+    0x6B, 0xAF, 0xF6, 0x38, 0xF6, 0x4E, 0x8D, 0xD5, 0xD2, 0xF9, 0xFD, 0xC8, 0xC2, 0x5F, 0xED, 0x7E,
+    0xFF, 0x95, 0x75, 0x63, 0xFD, 0x4C, 0x68, 0x9E, 0x5C, 0xED, 0x2B, 0xA1, 0xFE, 0x61, 0x50, 0x1B,
+    0x09, 0xAB, 0x3B, 0xF1, 0xB1, 0x56, 0x9B, 0xD8, 0x43, 0xA7, 0x54, 0xF5, 0xDB, 0xE0, 0x0B, 0xD0,
+    0xF4, 0xF9, 0x42, 0x6C, 0x94, 0x9E, 0xAB, 0xCF, 0xD5, 0x96, 0x2B, 0x74, 0x63, 0xED, 0xC1, 0xCC,
+    0x9D, 0x24, 0xAD, 0xF7, 0xC7, 0x74, 0x92, 0x82, 0x99, 0xA1, 0xF6, 0xC5, 0x06, 0x83, 0xCB, 0xE4,
+    0x0A, 0x41, 0x37, 0x96, 0x2B, 0xD4, 0x6D, 0x16, 0x9D, 0xA6, 0xEB, 0x51, 0xB2, 0x8D, 0x8F, 0xB2,
+    0x15, 0x99, 0xC7, 0xCE, 0x48, 0xDE, 0x7E, 0xEB, 0xB5, 0x30, 0x7C, 0xF6, 0xCF, 0xB7, 0xC6, 0xF8,
+    0xE5, 0x2D, 0xC6, 0xFF, 0x16, 0xC6, 0xF3, 0xB0, 0x7F, 0xBF, 0x62, 0xFC, 0xBF, 0xB2, 0xC6, 0x87,
+    0xE1, 0x2B, 0x3F, 0xDC, 0x9A, 0x57, 0x5F, 0x5F, 0x2A, 0x69, 0xCA, 0xA5, 0x9E, 0x61, 0x8B, 0x04,
+    0xA7, 0x6A, 0x7A, 0x50, 0x36, 0xB6, 0x33, 0xD9, 0xB0, 0x92, 0x33, 0xAF, 0x6F, 0xCA, 0x65, 0xBF,
+    0xB2, 0x98, 0x3B, 0xC1, 0xF2, 0x5E, 0xFB, 0x52, 0xFF, 0xC6, 0xE9, 0x2B, 0x9F, 0x09, 0xEF, 0xCE,
+    0x56, 0xFB, 0x8A, 0x6F, 0x7E, 0xB8, 0xAA, 0x1F, 0x1E, 0x98, 0xB5, 0x78, 0xCD, 0xB5, 0x8F, 0xDC,
+    0x3D, 0x7C, 0x68, 0x5F, 0xE0, 0x1F, 0x48, 0xDA, 0x6E, 0x5E, 0x5C, 0x5C, 0xDC, 0x4E, 0x84, 0xAC,
+    0x32, 0xFC, 0xF8, 0x17, 0xD6, 0xF1, 0x8E, 0x22, 0x50, 0x7A, 0xEB, 0x32, 0x3D, 0x13, 0xE8, 0x26,
+    0xEB, 0xEA, 0xB9, 0x08, 0x65, 0xC0, 0xBE, 0xA4, 0x8B, 0x2F, 0x05, 0x2B, 0xE9, 0xCE, 0x5E, 0xE8,
+    0xE9, 0x86, 0x23, 0xF2, 0xBD, 0x1E, 0x1B, 0x4C, 0xB4, 0x49, 0x10, 0x1F, 0x89, 0x08, 0x7D, 0xB1,
+    0xF2, 0xD0, 0x17, 0xF7, 0x4B, 0x45, 0xD1, 0x62, 0xDD, 0x4A, 0x11, 0x9A, 0x19, 0xEB, 0x34, 0x16,
+    0x21, 0x57, 0x6B, 0x5D, 0xB9, 0x16, 0xDB, 0xC5, 0xE0, 0x8F, 0x1F, 0x6A, 0xA3, 0x69, 0x6B, 0xA6,
+    0xE8, 0x4B, 0x45, 0xF2, 0x88, 0x4B, 0x1D, 0x47, 0x7E, 0xF7, 0x54, 0x77, 0x62, 0xC7, 0xE3, 0xB6,
+    0xB6, 0x23, 0xEF, 0xA5, 0x58, 0x31, 0x23, 0x76, 0xCC, 0xD5, 0x16, 0x2B, 0xC3, 0x88, 0x1D, 0x1B,
+    0x4F, 0x11, 0xAA, 0x05, 0xEC, 0xCB, 0xBA, 0xB8, 0xF8, 0x52, 0xE8, 0x24, 0xE9, 0x15, 0xED, 0x9F,
+    0x22, 0xA7, 0xF6, 0xA4, 0x1A, 0x96, 0xB3, 0x7A, 0xA8, 0x53, 0x9B, 0xC9, 0x47, 0xCF, 0xD6, 0xF4,
+    0x0F, 0x4E, 0x18, 0x40, 0x44, 0x05, 0x22, 0x74, 0xD9, 0xC5, 0x2C, 0xE8, 0xFF, 0x7C, 0x31, 0x6C,
+    0xA5, 0x24, 0x6D, 0xB5, 0x24, 0x6D, 0xDD, 0xF7, 0x2F, 0x2E, 0x2E, 0x9E, 0x1B, 0xCE, 0x08, 0x39,
+    0x36, 0xD5, 0xCD, 0x4A, 0xDA, 0x8A, 0x58, 0x96, 0xAD, 0x0F, 0x1C, 0xFE, 0xE9, 0x73, 0xA9, 0xAB,
+    0x58, 0xDC, 0xD4, 0xF1, 0x6E, 0x62, 0xD3, 0x99, 0x13, 0xF0, 0x92, 0x24, 0x2A, 0xB2, 0x7D, 0xB2,
+    0xA4, 0x95, 0x47, 0xA8, 0xBD, 0x5A, 0xCA, 0xAD, 0x5A, 0xC9, 0x34, 0x0D, 0x33, 0xC3, 0x56, 0x69,
+    0x6A, 0x5E, 0x9B, 0x5E, 0xD4, 0x33, 0xE1, 0xE9, 0xEA, 0x8F, 0x82, 0x29, 0xA7, 0x17, 0x0D, 0x3C,
+    0x5D, 0x8D, 0x50, 0x4E, 0x2F, 0x02, 0x97, 0xD5, 0x08, 0xD5, 0x74, 0x09, 0x5C, 0x56, 0xD3, 0x9B,
+    0xBD, 0x34, 0xD3, 0x25, 0xB0, 0x55, 0x1E, 0xCC, 0x34, 0x00, 0xBF, 0x7D, 0xF5, 0x8C, 0xCB, 0xF8,
+    0xCE, 0x18, 0x00, 0xF7, 0xA7, 0x8E, 0x68, 0xC7, 0x7B, 0x1F, 0xB6, 0x8B, 0x7F, 0x9B, 0x0A, 0xFF,
+    0xC7, 0x41, 0x92, 0xE6, 0x9B, 0x17, 0x17, 0x17, 0x5F, 0x8A, 0xC6, 0x38, 0x02, 0x27, 0xDB, 0x99,
+    0x8A, 0x8A, 0xEA, 0xCA, 0xDD, 0xFC, 0x5F, 0x0F, 0x1F, 0xD0, 0x43, 0xE7, 0x35, 0x1D, 0xD7, 0xF0,
+    0x2B, 0xA7, 0x88, 0xE3, 0xC1, 0x3B, 0xFB, 0x31, 0xA3, 0xD8, 0x5F, 0x1E, 0x07, 0xFF, 0x74, 0x35,
+    0x72, 0xA5, 0x9C, 0x5E, 0xBC, 0x92, 0xCD, 0x4F, 0x57, 0x5F, 0x9D, 0xED, 0x37, 0xA6, 0x17, 0xBB,
+    0x97, 0x74, 0x59, 0xBD, 0x3A, 0x97, 0x9A, 0x86, 0x15, 0xB3, 0xC5, 0x26, 0xFE, 0x83, 0x4B, 0x34,
+    0xC0, 0x42, 0xE1, 0xC8, 0xFF, 0x88, 0xC0, 0xCE, 0x89, 0x93, 0x9D, 0xBB, 0xA2, 0x87, 0xCA, 0x9B,
+    0x09, 0x1A, 0x1F, 0x31, 0x94, 0x62, 0x23, 0xD7, 0xE1, 0x10, 0x4F, 0xF9, 0xD0, 0x58, 0x4B, 0xD2,
+    0xDC, 0x7D, 0xFF, 0xE2, 0xE2, 0x4B, 0xEB, 0x76, 0x22, 0x53, 0xEE, 0x5A, 0x4B, 0x92, 0x7C, 0xAC,
+    0xC2, 0xCD, 0x44, 0x26, 0xE8, 0x5C, 0xB1, 0x42, 0xED, 0xCD, 0x0C, 0xE5, 0x64, 0x46, 0xC8, 0xFA,
+    0xA3, 0xDD, 0x39, 0xDC, 0x00, 0xAE, 0x3D, 0x15, 0x9B, 0xBD, 0x74, 0x2B, 0xA0, 0x3B, 0x9A, 0xC0,
+    0x2C, 0x8D, 0x20, 0x57, 0xAB, 0x19, 0xAC, 0x37, 0xEA, 0x29, 0x57, 0xBA, 0x00, 0x43, 0xF4, 0x36,
+    0x97, 0xD8, 0x8A, 0x2F, 0xDA, 0x5D, 0x8F, 0x89, 0xDE, 0xD1, 0xB0, 0x30, 0x38, 0x0A, 0x39, 0xB3,
+    0x80, 0x5D, 0x11, 0x64, 0x9A, 0x9A, 0x09, 0x8C, 0x8A, 0x75, 0x6F, 0x96, 0x41, 0xA9, 0xCF, 0xCC,
+    0xB1, 0xE4, 0x01, 0xC8, 0xF5, 0xEA, 0xB4, 0x23, 0xFA, 0x10, 0x1D, 0xAE, 0x2A, 0x32, 0x21, 0x6D,
+    0x3A, 0xA3, 0x63, 0x3C, 0x71, 0x65, 0x53, 0x4A, 0xF1, 0xE6, 0xED, 0x64, 0xA8, 0x3B, 0xA9, 0x47,
+    0xD2, 0x98, 0x2D, 0x99, 0x3C, 0x7D, 0x6C, 0xF7, 0x67, 0x97, 0xDD, 0x3D, 0xDD, 0xBD, 0x19, 0x6E,
+    0x7E, 0x36, 0xC4, 0xBE, 0x51, 0x56, 0x0A, 0x48, 0x0A, 0x85, 0x7A, 0x1B, 0xAA, 0x2D, 0x1E, 0xD3,
+    0x53, 0x2F, 0xCD, 0x1C, 0x19, 0x63, 0xCD, 0x6C, 0x7D, 0xAC, 0x4F, 0xB0, 0xD3, 0x30, 0xD1, 0x8D,
+    0xC3, 0x84, 0xDC, 0x30, 0x65, 0xEA, 0x07, 0x5F, 0x88, 0xCE, 0x57, 0x2B, 0x76, 0xED, 0x96, 0x58,
+    0x0A, 0x9F, 0xCA, 0x1C, 0x96, 0xE4, 0xE6, 0x5E, 0x39, 0x1C, 0x0E, 0xD7, 0x9B, 0x5D, 0xD3, 0xED,
+    0x4F, 0xDF, 0x1F, 0xC2, 0xEE, 0x81, 0x3C, 0xFC, 0xE9, 0xCA, 0xA1, 0xB5, 0xA1, 0xDE, 0x53, 0x8C,
+    0xE9, 0xE9, 0xE2, 0xE2, 0x27, 0xFD, 0xD9, 0x35, 0xB0, 0xC1, 0xEE, 0xCA, 0xE7, 0xF4, 0x34, 0x9F,
+    0xFC, 0xEE, 0x46, 0xDF, 0xC9, 0x62, 0x85, 0xFC, 0x6C, 0x7B, 0x1A, 0x49, 0xAF, 0xFA, 0xFD, 0xE0,
+    0xAD, 0x42, 0x77, 0xB3, 0x41, 0xC7, 0xEA, 0x34, 0xB3, 0x81, 0x89, 0x6D, 0xEC, 0x0A, 0xAD, 0xD8,
+    0x99, 0x18, 0xBE, 0x81, 0x7D, 0x45, 0x68, 0xA2, 0xF2, 0xD6, 0x9B, 0x95, 0x7C, 0x8D, 0x5D, 0x1D,
+    0x87, 0xD6, 0xCE, 0x26, 0xD0, 0x8C, 0x85, 0x5A, 0xB9, 0x6A, 0xC6, 0x7A, 0x13, 0xF2, 0x35, 0xF6,
+    0x7C, 0xEC, 0x5A, 0x3A, 0x6F, 0xD6, 0x7A, 0xA2, 0xDA, 0xD0, 0xF7, 0x16, 0xD0, 0x58, 0x69, 0x83,
+    0x3A, 0x60, 0x23, 0xED, 0x2F, 0x57, 0xAC, 0xD6, 0x33, 0x6A, 0xE9, 0x56, 0x90, 0xFE, 0xED, 0x90,
+    0x0A, 0x3C, 0x34, 0x62, 0x5E, 0x93, 0x34, 0x53, 0x84, 0x52, 0x9A, 0xA1, 0x26, 0xBB, 0xB8, 0xFD,
+    0x10, 0xCE, 0x6A, 0x84, 0x31, 0xE3, 0x19, 0x3A, 0x56, 0xA7, 0x76, 0xB2, 0x26, 0x51, 0x63, 0xA3,
+    0x88, 0xC5, 0x86, 0x1B, 0xDD, 0x02, 0x74, 0x9F, 0x15, 0x60, 0x5F, 0x8E, 0xBA, 0xCE, 0x06, 0xA8,
+    0x66, 0x23, 0x28, 0x42, 0xAE, 0x89, 0x7C, 0x8B, 0xC6, 0xBC, 0x35, 0x6A, 0xE9, 0x5C, 0xAE, 0x09,
+    0x3B, 0x61, 0x03, 0xB5, 0xC7, 0xA8, 0xAD, 0x02, 0xB9, 0x7C, 0xB1, 0x81, 0x0D, 0xB9, 0xC0, 0xA8,
+    0x97, 0x23, 0x97, 0xEF, 0x46, 0xB0, 0xC1, 0xDE, 0x3D, 0x1C, 0x3E, 0xA6, 0xCF, 0x4A, 0x92, 0x7E,
+    0x18, 0x0F, 0xB3, 0x89, 0x3E, 0x45, 0x3C, 0xEB, 0x26, 0xB6, 0x43, 0x5E, 0x62, 0x3A, 0xFE, 0x4E,
+    0xFC, 0xA6, 0xD1, 0xBF, 0x39, 0x7C, 0xF4, 0xBE, 0x7D, 0xB6, 0x1D, 0xF7, 0xD9, 0x88, 0x59, 0x68,
+    0x36, 0x32, 0xED, 0x5E, 0xBA, 0x51, 0x5B, 0xFC, 0xA5, 0xF7, 0x59, 0x3C, 0xAC, 0x71, 0xDF, 0x67,
+    0x6E, 0x2F, 0xBF, 0xDA, 0xE7, 0x2D, 0x7F, 0xC8, 0x3E, 0xE3, 0xDA, 0xE1, 0xD0, 0x72, 0xF5, 0xD4,
+    0xBC, 0x79, 0xDA, 0xAD, 0x8C, 0x24, 0x4D, 0x36, 0xED, 0xD6, 0xFE, 0xC4, 0x65, 0xDB, 0xE9, 0x6B,
+    0x27, 0xD7, 0x9C, 0x52, 0x57, 0x0E, 0x87, 0xC3, 0x8D, 0x58, 0xF9, 0xF4, 0x4D, 0x9D, 0x3C, 0x48,
+    0x7D, 0x23, 0x7E, 0xD3, 0xF9, 0x33, 0xAF, 0x33, 0x52, 0xDE, 0xEE, 0x27, 0xFE, 0x0E, 0x89, 0x20,
+    0xB7, 0x1D, 0x0E, 0x87, 0x36, 0x5A, 0xBB, 0xA8, 0x7F, 0x62, 0x49, 0xF3, 0x16, 0x1B, 0x82, 0x4E,
+    0x9C, 0xBA, 0x3F, 0x0C, 0xEE, 0xE8, 0xCE, 0x66, 0x07, 0x7D, 0x0E, 0x6E, 0x49, 0x9A, 0x18, 0x4E,
+    0x9D, 0x4B, 0xA6, 0xDD, 0x6A, 0x2E, 0xA8, 0x67, 0x58, 0xA8, 0x13, 0x7D, 0x39, 0x36, 0x3E, 0x89,
+    0xDD, 0xEE, 0x62, 0xAB, 0x1A, 0x39, 0x3A, 0x7F, 0xF8, 0x58, 0xF4, 0x90, 0x8E, 0x37, 0xFF, 0xC0,
+    0x48, 0x30, 0x0B, 0x58, 0x9F, 0xC5, 0x0E, 0xAE, 0x91, 0x1F, 0x1F, 0x13, 0x7A, 0x7E, 0x70, 0x50,
+    0xE9, 0x5B, 0x91, 0x96, 0xA5, 0x7F, 0x73, 0xB8, 0x91, 0xA6, 0x2F, 0x8F, 0x23, 0xB9, 0xAA, 0xD4,
+    0x73, 0x5E, 0xDA, 0x76, 0x8C, 0xBE, 0x3E, 0x9F, 0x92, 0x07, 0xDA, 0x70, 0x28, 0x76, 0x2C, 0x92,
+    0xA6, 0xEA, 0x64, 0xF8, 0x35, 0x0D, 0x3A, 0x1C, 0x0E, 0x37, 0xEA, 0xF3, 0x63, 0x8F, 0x76, 0x92,
+    0xF0, 0x3F, 0x3E, 0x1C, 0x0E, 0x37, 0xBA, 0x9F, 0x38, 0xFF, 0xFD, 0x19, 0x6F, 0x4E, 0xE9, 0xA8,
+    0x9D, 0xED, 0xE2, 0xE2, 0xE2, 0x76, 0x73, 0x76, 0x24, 0xD7, 0x44, 0x17, 0x6F, 0xF4, 0xED, 0x17,
+    0x17, 0x17, 0xB7, 0xAF, 0x1D, 0x0E, 0xB1, 0x21, 0x9F, 0xEE, 0x92, 0x66, 0xB7, 0x8A, 0xCA, 0x65,
+    0xD8, 0x8F, 0xF4, 0xDB, 0x7B, 0x3F, 0x35, 0xDB, 0x7D, 0xCD, 0xFD, 0xFA, 0x53, 0xB4, 0x80, 0x5E,
+    0x3A, 0x1C, 0x0E, 0x07, 0xB3, 0x76, 0x67, 0x77, 0xB5, 0xC5, 0x6F, 0xBE, 0x77, 0x76, 0x66, 0x46,
+    0x14, 0x50, 0x13, 0xCE, 0x04, 0x24, 0x4A, 0x4B, 0x14, 0x93, 0x52, 0xE3, 0xB5, 0xC3, 0xE1, 0x29,
+    0x2D, 0xB1, 0xCD, 0x78, 0xBC, 0x83, 0xBE, 0x8A, 0xC5, 0x9D, 0x83, 0xB4, 0xB5, 0x47, 0xF1, 0x88,
+    0xE8, 0x40, 0x9C, 0xDE, 0xEC, 0xD6, 0x8F, 0x6E, 0xC4, 0xDE, 0x74, 0xBA, 0x9D, 0x84, 0x3C, 0xFE,
+    0xA9, 0x4B, 0xEF, 0x43, 0xE3, 0x73, 0x05, 0x50, 0x9B, 0xA7, 0xB8, 0x5A, 0xD0, 0x39, 0xEC, 0x42,
+    0xB1, 0xC5, 0x4E, 0xFC, 0x1E, 0x13, 0xAE, 0x7D, 0x44, 0x87, 0xEB, 0xC7, 0x29, 0x3D, 0xBB, 0xF9,
+    0x34, 0x92, 0x89, 0x5C, 0x98, 0x15, 0xCC, 0x1C, 0xF3, 0x0E, 0xAE, 0x09, 0x50, 0x46, 0xD6, 0xAE,
+    0x9D, 0xE4, 0x21, 0x57, 0xB7, 0x65, 0x87, 0xC3, 0xAD, 0x23, 0x42, 0x51, 0x45, 0x5B, 0x3B, 0x48,
+    0xBA, 0xBB, 0x0B, 0xC8, 0xA9, 0x77, 0x6C, 0xDC, 0x64, 0x26, 0x3C, 0x58, 0x16, 0x7C, 0x5C, 0x0C,
+    0xB5, 0x51, 0x42, 0xE2, 0x37, 0x21, 0x3B, 0x1C, 0x0E, 0xB7, 0x52, 0xBF, 0x9F, 0xF3, 0xA0, 0x38,
+    0x8B, 0xF3, 0x5F, 0xFF, 0x74, 0xF3, 0x1F, 0x77, 0x78, 0xEC, 0xEF, 0x95, 0xCB, 0xDF, 0xBC, 0xB8,
+    0xF8, 0x92, 0xD6, 0x38, 0x55, 0x7D, 0xF4, 0xD2, 0x52, 0x9F, 0xA2, 0x9B, 0x17, 0x17, 0x17, 0x6D,
+    0xEA, 0x57, 0x75, 0x48, 0x7B, 0x67, 0x97, 0xBC, 0xF4, 0x21, 0xFA, 0x4E, 0xA6, 0xBB, 0x87, 0x8F,
+    0xC8, 0xA7, 0x93, 0x7F, 0x52, 0xA3, 0xD0, 0xFF, 0x44, 0xBE, 0x6D, 0x74, 0x9B, 0x46, 0xB7, 0x63,
+    0x2F, 0x28, 0x7D, 0x53, 0x5A, 0xCB, 0x38, 0x40, 0xD7, 0x49, 0x2E, 0x3B, 0x1C, 0x0E, 0x87, 0xEB,
+    0xF5, 0xA9, 0xCB, 0xCD, 0xF1, 0xF9, 0x70, 0xB8, 0xE5, 0x8D, 0x7A, 0xCC, 0x5C, 0xCA, 0x51, 0xCD,
+    0x85, 0x3C, 0x85, 0x47, 0x0B, 0xF9, 0xED, 0xC4, 0x2A, 0x6C, 0x74, 0x5A, 0xA5, 0x32, 0x35, 0x06,
+    0x99, 0x4E, 0x35, 0x22, 0xE9, 0xA2, 0x70, 0xDA, 0x02, 0xC3, 0xA9, 0xED, 0x42, 0x54, 0xBE, 0x11,
+    0x97, 0x3B, 0xF5, 0x64, 0xB8, 0x8D, 0x46, 0xB2, 0x50, 0xA8, 0xA7, 0x08, 0x95, 0xA0, 0x0C, 0x75,
+    0x00, 0x13, 0xEC, 0x76, 0x71, 0x31, 0x44, 0xDF, 0x79, 0xE9, 0x24, 0x69, 0xB6, 0x27, 0x74, 0x2C,
+    0xC5, 0xD2, 0x37, 0x2F, 0x2E, 0x2E, 0x3E, 0xB3, 0xBB, 0xD8, 0x5F, 0xDE, 0x3B, 0x3E, 0x45, 0xC4,
+    0xB8, 0x1B, 0x8F, 0xED, 0x37, 0xA3, 0x5C, 0x46, 0x42, 0x6A, 0xF8, 0xD9, 0x7F, 0xD7, 0xFF, 0xAC,
+    0xBF, 0xAB, 0x7F, 0xE2, 0xEF, 0x2E, 0x22, 0xA4, 0xD7, 0xA6, 0x0E, 0x16, 0xD6, 0x9F, 0xF7, 0x45,
+    0x1C, 0xC6, 0x74, 0x71, 0xEC, 0x78, 0xD8, 0x9F, 0xFF, 0x58, 0xE7, 0x9D, 0x12, 0x4D, 0x48, 0x7D,
+    0x30, 0x62, 0xCB, 0xC4, 0x25, 0xFD, 0xB8, 0x5A, 0xCF, 0xDF, 0xF2, 0xF8, 0xE3, 0x37, 0xF9, 0xA4,
+    0xFC, 0x39, 0xF2, 0x2F, 0xA6, 0x9C, 0x6E, 0xB1, 0x40, 0x6F, 0xFB, 0xDF, 0x6A, 0x9E, 0x5C, 0x9A,
+    0x27, 0x65, 0x3F, 0x16, 0xBA, 0x84, 0x4A, 0x8E, 0x0C, 0x1A, 0x13, 0x51, 0x43, 0x4B, 0x29, 0x69,
+    0xE9, 0x5E, 0xBB, 0xA7, 0x3B, 0x8B, 0xFD, 0xF4, 0xFC, 0x2B, 0xC5, 0x52, 0x9D, 0xFE, 0x1C, 0xDB,
+    0x43, 0x16, 0x9B, 0xC6, 0x4B, 0xB9, 0xB4, 0x74, 0xDF, 0x1D, 0xBE, 0x3C, 0xE7, 0xAB, 0xA8, 0x5F,
+    0xF5, 0xD9, 0x26, 0xEA, 0x1F, 0x2C, 0xC5, 0xDA, 0xDD, 0xD3, 0x1D, 0xC9, 0x1B, 0xAD, 0x3C, 0xBE,
+    0x72, 0xE5, 0xBA, 0x5D, 0xBA, 0x30, 0x84, 0x2E, 0xD8, 0x39, 0x25, 0x2A, 0x6E, 0x9E, 0x35, 0x4C,
+    0x8D, 0x73, 0x56, 0x9D, 0x9F, 0x70, 0x97, 0x0C, 0xF0, 0x79, 0x60, 0xE6, 0x4F, 0xF9, 0xE6, 0x44,
+    0x8F, 0xD1, 0x59, 0xF4, 0xD6, 0x8C, 0xD9, 0xE1, 0x3A, 0xC6, 0xE7, 0x5A, 0x29, 0x02, 0x83, 0xFA,
+    0x6C, 0xA5, 0x91, 0x47, 0x5C, 0x7D, 0x3E, 0xE6, 0x4F, 0xD5, 0xD6, 0x13, 0x74, 0x53, 0xE5, 0xC1,
+    0x84, 0x22, 0x56, 0xD7, 0x6D, 0xC0, 0x30, 0x0E, 0x2D, 0x98, 0xC5, 0x3A, 0x28, 0x64, 0x26, 0x60,
+    0x78, 0x65, 0x06, 0xEA, 0xBF, 0x08, 0x40, 0xB1, 0x6D, 0x27, 0x66, 0x7B, 0x9D, 0x64, 0xDD, 0x9F,
+    0x6A, 0xC8, 0xEA, 0x73, 0xF4, 0xEA, 0x04, 0xE3, 0x5E, 0xC2, 0x0B, 0x8D, 0xDA, 0xFA, 0x65, 0xE9,
+    0x09, 0xD5, 0x52, 0xBD, 0xE8, 0x93, 0xDA, 0x8A, 0x90, 0x69, 0x32, 0x53, 0x21, 0x6C, 0x5F, 0x05,
+    0xC4, 0x10, 0x8A, 0xAD, 0x52, 0xA8, 0xA4, 0xCF, 0x6E, 0x46, 0x8B, 0x09, 0xB5, 0x7A, 0xE3, 0xAF,
+    0x7E, 0x61, 0x3F, 0x1D, 0xE2, 0x7F, 0x6B, 0xF9, 0x97, 0x6D, 0xA9, 0xA9, 0xD4, 0x64, 0xB4, 0xD4,
+    0x9A, 0xAD, 0xD6, 0x4E, 0xC1, 0xBE, 0x24, 0x95, 0xA1, 0x6B, 0x6D, 0xC8, 0xC3, 0x40, 0xE3, 0xF3,
+    0x30, 0x50, 0xCF, 0x79, 0xE8, 0xDA, 0x2E, 0xE4, 0xA1, 0xFB, 0xAA, 0xF4, 0xC1, 0x60, 0x15, 0x06,
+    0xCD, 0x8D, 0x7C, 0x23, 0x5F, 0xC9, 0x55, 0x72, 0x3C, 0x07, 0xCF, 0xA5, 0x7A, 0xED, 0x18, 0x95,
+    0xFE, 0xB5, 0x3D, 0x7F, 0xFF, 0xE2, 0xE2, 0xE2, 0xB9, 0xEE, 0x64, 0xB5, 0xEE, 0x7B, 0xE6, 0x41,
+    0xB0, 0x62, 0xE7, 0x2A, 0x24, 0x03, 0x6E, 0xEE, 0x6B, 0xE6, 0x3B, 0xA4, 0x83, 0x6E, 0xA6, 0x9F,
+    0x78, 0xC5, 0xF8, 0x57, 0xB9, 0xC2, 0xC7, 0x2B, 0xEE, 0x5D, 0x5C, 0x5C, 0x5C, 0x44, 0xE7, 0x47,
+    0xE6, 0x0C, 0xBB, 0xDB, 0x8B, 0xEC, 0x75, 0xE8, 0xF4, 0xB3, 0x3C, 0xFE, 0xE2, 0xD9, 0xBF, 0x66,
+    0x22, 0xEF, 0x03, 0xEE, 0x49, 0x3A, 0x29, 0x28, 0x6A, 0xFC, 0x5D, 0xDC, 0xC3, 0xA9, 0x14, 0xB2,
+    0x4A, 0xA1, 0xFF, 0xB7, 0x66, 0xA0, 0x99, 0x63, 0x5D, 0x60, 0xB5, 0x02, 0xDD, 0xD4, 0x4D, 0x50,
+    0xA5, 0xD6, 0xEE, 0xAE, 0x9E, 0xA1, 0x99, 0x91, 0xA3, 0x10, 0xD5, 0x0A, 0xDD, 0x44, 0x37, 0x1D,
+    0x49, 0x45, 0x8E, 0x66, 0xA1, 0x59, 0x20, 0xC2, 0x9C, 0x66, 0xA5, 0x9B, 0xA0, 0x9B, 0xCC, 0x4A,
+    0xEA, 0xDF, 0x4F, 0xB3, 0x34, 0x4B, 0x04, 0x07, 0x00, 0x13, 0x1D, 0xC6, 0xCE, 0x5F, 0x6B, 0x81,
+    0x6B, 0x1F, 0x15, 0x50, 0x6D, 0x11, 0xC6, 0xFB, 0x5A, 0x2C, 0x41, 0x32, 0x01, 0x72, 0xC5, 0x6E,
+    0xF2, 0xBE, 0x14, 0x54, 0x5B, 0x8C, 0x27, 0x5D, 0x96, 0xB8, 0x1B, 0x81, 0x5C, 0x2D, 0xC3, 0x18,
+    0x49, 0x6A, 0x94, 0x1B, 0xC4, 0xF3, 0x70, 0x63, 0xFB, 0x12, 0x4C, 0xC8, 0xD5, 0xC2, 0x30, 0x5A,
+    0x0F, 0x85, 0x92, 0x4E, 0x8D, 0xFD, 0xC0, 0x3E, 0x1B, 0x8F, 0x55, 0x57, 0x0B, 0x0C, 0xA9, 0x08,
+    0x62, 0x3D, 0x79, 0x9A, 0x29, 0xF9, 0x60, 0xCE, 0x0F, 0x38, 0x2C, 0xD6, 0x07, 0x5A, 0x0A, 0x74,
+    0xD2, 0x18, 0x3B, 0x0A, 0x44, 0xB7, 0x4A, 0x77, 0x3F, 0x22, 0xDF, 0x04, 0x0A, 0x3D, 0x23, 0x30,
+    0xA1, 0x9B, 0x60, 0xF8, 0xC6, 0x0A, 0xE5, 0xDA, 0x39, 0xB0, 0xDF, 0x0C, 0x50, 0x6C, 0x83, 0x03,
+    0xFB, 0x83, 0x9F, 0xFF, 0xCB, 0x6B, 0x2D, 0x5C, 0xFB, 0xD0, 0x2F, 0xF4, 0x23, 0x3A, 0x07, 0x36,
+    0x0E, 0xC8, 0x7A, 0xD0, 0x1D, 0xB5, 0xD4, 0xA1, 0xDE, 0xA8, 0xD4, 0x1E, 0x51, 0xA3, 0x90, 0xCE,
+    0xE2, 0x8A, 0x47, 0x27, 0x5F, 0x7D, 0x2E, 0x76, 0x01, 0x7B, 0x16, 0xA8, 0x63, 0x2B, 0x1C, 0xB9,
+    0x94, 0xBC, 0xB3, 0xCB, 0xE0, 0xA8, 0x94, 0x7B, 0x90, 0x7F, 0x64, 0xDF, 0xA2, 0xF2, 0xFC, 0x35,
+    0xBD, 0x9C, 0x8E, 0x2E, 0x8F, 0x46, 0xF0, 0x75, 0x00, 0xFB, 0xB2, 0x1C, 0x11, 0x3D, 0xE8, 0x62,
+    0xAB, 0x5D, 0xB5, 0x70, 0x35, 0x65, 0xDE, 0x76, 0xD3, 0x15, 0x49, 0x5A, 0xB1, 0xAE, 0x65, 0x3F,
+    0x49, 0xF9, 0x54, 0x89, 0xFC, 0x97, 0x7F, 0x5C, 0x03, 0xB2, 0xB6, 0x0E, 0x50, 0xE8, 0x49, 0x4D,
+    0xD0, 0x05, 0xBB, 0x41, 0x15, 0x01, 0xB6, 0x21, 0x34, 0x31, 0x83, 0xF5, 0xDB, 0xC0, 0xD5, 0xB6,
+    0x9A, 0x21, 0xDB, 0x72, 0x8D, 0x6F, 0xB8, 0xCC, 0xAE, 0x50, 0x46, 0x58, 0xB9, 0x99, 0xFE, 0x4A,
+    0x37, 0x14, 0xB3, 0xB0, 0xA9, 0xBF, 0xE0, 0xAE, 0x54, 0xCE, 0x87, 0x1D, 0x7F, 0xF3, 0xF6, 0x16,
+    0xF8, 0x07, 0x98, 0x90, 0xCB, 0xD9, 0x50, 0xA8, 0xAF, 0x1F, 0xFA, 0xB1, 0xD9, 0x75, 0xD4, 0xDA,
+    0x50, 0xC8, 0xD9, 0xB9, 0xD8, 0xB8, 0xD2, 0xF2, 0x8B, 0x1F, 0xC3, 0xCF, 0x34, 0xA5, 0x7F, 0x29,
+    0x46, 0xD2, 0x3F, 0x6D, 0xC9, 0xA9, 0x35, 0xD1, 0xE4, 0xD2, 0x9A, 0x47, 0xDC, 0x7D, 0x56, 0xDF,
+    0x49, 0x9F, 0x5C, 0xA8, 0x35, 0x67, 0x8E, 0xEC, 0xB9, 0x37, 0xDE, 0x59, 0x29, 0xC5, 0xF6, 0xF9,
+    0xB1, 0x72, 0x5A, 0x1A, 0x2F, 0x2E, 0x2E, 0x1E, 0xD2, 0xAF, 0x2C, 0xB6, 0xEC, 0xFD, 0xE0, 0xD9,
+    0xD5, 0xD7, 0x62, 0xC1, 0xE1, 0x23, 0x71, 0x69, 0x4A, 0x27, 0xF5, 0xF6, 0xCB, 0xD2, 0x7F, 0x94,
+    0x7D, 0x5D, 0x5A, 0xB6, 0x5C, 0xBA, 0xE3, 0xD1, 0x92, 0xF5, 0xDC, 0x6C, 0xB9, 0x06, 0xAD, 0x51,
+    0x5B, 0x8E, 0x52, 0x6F, 0xBF, 0x22, 0x7D, 0x4F, 0xF6, 0x7B, 0xD2, 0xBC, 0x65, 0xD2, 0xCB, 0x9E,
+    0x61, 0xA1, 0xE5, 0x5A, 0xCC, 0x2F, 0x3C, 0xF9, 0xA7, 0x70, 0xF5, 0x0F, 0xED, 0x11, 0x68, 0x0A,
+    0x8F, 0x4B, 0xDA, 0xDA, 0xEC, 0xE6, 0xC5, 0xE7, 0x1E, 0x02, 0x29, 0x0C, 0xFA, 0xD3, 0x88, 0xA7,
+    0x3C, 0x93, 0x32, 0x19, 0xF7, 0xA4, 0x3B, 0x9F, 0x83, 0xEC, 0xBF, 0xB9, 0xAF, 0xBA, 0xBE, 0xDE,
+    0xAB, 0x23, 0x06, 0x8E, 0x71, 0xC0, 0x20, 0xE9, 0x3F, 0x5C, 0x3C, 0x7F, 0xEF, 0x8B, 0xB1, 0xF4,
+    0xC1, 0xF6, 0x60, 0xD2, 0x51, 0xF1, 0xC7, 0x6B, 0x6E, 0x6E, 0x17, 0x17, 0xBD, 0x75, 0x50, 0xCC,
+    0x70, 0xE4, 0x64, 0x9D, 0xCF, 0x5C, 0x77, 0x0C, 0x09, 0xD7, 0x9B, 0xB1, 0x3C, 0xE5, 0x81, 0xC7,
+    0xD9, 0x05, 0x9D, 0x24, 0x7D, 0xED, 0xE2, 0xE2, 0xE2, 0xE2, 0x8B, 0x0F, 0x5F, 0x86, 0xB3, 0x6B,
+    0xD3, 0xEC, 0x46, 0xE1, 0x2F, 0x7D, 0x0C, 0x5B, 0xA3, 0x77, 0xBD, 0x50, 0x6A, 0x3E, 0xFE, 0x63,
+    0x98, 0xA1, 0x8C, 0x87, 0x11, 0x3E, 0xEC, 0xC9, 0xA5, 0x68, 0xA0, 0x39, 0x66, 0x70, 0xAE, 0x5E,
+    0x5C, 0x5C, 0x7C, 0xF1, 0xBE, 0x69, 0x88, 0xFA, 0x62, 0x4A, 0x59, 0xD1, 0x42, 0x63, 0xEC, 0x0C,
+    0xF6, 0xC6, 0xA7, 0xD8, 0x7E, 0x8C, 0x4A, 0x8E, 0x4A, 0x13, 0x95, 0x26, 0xEA, 0xF4, 0xAF, 0xD0,
+    0x04, 0xCD, 0xC8, 0x03, 0xF4, 0xD4, 0x87, 0xC6, 0x5F, 0x59, 0xBA, 0x95, 0x1A, 0x32, 0x0F, 0xB9,
+    0x7A, 0x9A, 0x05, 0x9A, 0xD8, 0xF3, 0x3E, 0xD7, 0x4A, 0xA3, 0x91, 0x46, 0xB7, 0x73, 0xDD, 0x25,
+    0xD7, 0x42, 0xA3, 0x3E, 0x92, 0x3B, 0x17, 0xE8, 0x96, 0x18, 0xC2, 0x77, 0x6B, 0xE4, 0x6E, 0x34,
+    0x1A, 0xF3, 0xA8, 0x24, 0xD7, 0xE3, 0xBD, 0x3E, 0xF8, 0x03, 0x97, 0x47, 0xDA, 0x46, 0xFC, 0x1C,
+    0x6C, 0x3A, 0x5F, 0xE2, 0x2A, 0xF0, 0x5B, 0x8F, 0x24, 0x19, 0x31, 0x2D, 0x44, 0x7F, 0x24, 0x86,
+    0x3F, 0x56, 0x7D, 0xA1, 0x25, 0x72, 0xCF, 0x3B, 0xF5, 0xD0, 0xA9, 0x2F, 0xB5, 0x70, 0xBC, 0xA1,
+    0xE3, 0x1D, 0xE5, 0x1A, 0x69, 0xD6, 0x48, 0x25, 0xE9, 0xD6, 0x74, 0xE1, 0x7C, 0xFC, 0xC3, 0xF4,
+    0x77, 0xFB, 0xB7, 0xFB, 0xFB, 0x36, 0x0B, 0xB9, 0xFA, 0x58, 0xFA, 0xBA, 0x10, 0xCF, 0xC7, 0xB9,
+    0xFD, 0x57, 0xC2, 0x42, 0xDC, 0x91, 0x76, 0xB2, 0x23, 0x1E, 0xBB, 0xCE, 0x9C, 0xDE, 0xF0, 0x9B,
+    0x9F, 0x15, 0x0B, 0x39, 0x43, 0x28, 0x3B, 0x77, 0x06, 0xDE, 0xA4, 0x9E, 0x16, 0xD1, 0x55, 0xD9,
+    0xB8, 0x1F, 0xAE, 0x1C, 0xA4, 0x78, 0xC0, 0x8A, 0xB4, 0x55, 0xBA, 0xFB, 0x51, 0x1D, 0x3E, 0xA0,
+    0x39, 0xC1, 0xD2, 0x65, 0x3A, 0xEF, 0xD1, 0xD1, 0x79, 0xCC, 0x4C, 0x29, 0x72, 0xC5, 0x66, 0xDA,
+    0x13, 0xD5, 0x46, 0xB9, 0x92, 0xD8, 0xA6, 0x65, 0x42, 0x28, 0x97, 0x2C, 0xA6, 0x3F, 0xAD, 0x07,
+    0xA3, 0x27, 0xB7, 0x08, 0x7D, 0x7D, 0xFF, 0xE2, 0xB9, 0x88, 0x4E, 0x4F, 0xE5, 0xD9, 0x51, 0x7D,
+    0x13, 0xE9, 0x68, 0xF9, 0xD8, 0x1A, 0x3C, 0x9D, 0xC7, 0xF0, 0x10, 0x84, 0x32, 0x35, 0x9E, 0xE2,
+    0xCA, 0x8D, 0xF3, 0x2B, 0xD2, 0x91, 0x9D, 0x67, 0x2E, 0x6D, 0x19, 0xE2, 0x62, 0x8C, 0xF1, 0xFD,
+    0xE7, 0x34, 0xB6, 0x74, 0x2E, 0xE0, 0xB5, 0xC3, 0x53, 0x5B, 0x3C, 0x12, 0xEF, 0x25, 0xCD, 0x60,
+    0x96, 0x42, 0x8E, 0x4C, 0x6D, 0x1D, 0xA0, 0xF1, 0x68, 0xA4, 0xD8, 0x30, 0x1B, 0x74, 0x23, 0xC3,
+    0x91, 0xE1, 0xA2, 0x1E, 0x8D, 0xD4, 0x3E, 0xF9, 0xB3, 0x09, 0xBD, 0xED, 0x16, 0xAA, 0x40, 0xA3,
+    0xAB, 0x17, 0xFA, 0xFE, 0x90, 0x12, 0x87, 0x11, 0x18, 0x5C, 0xD3, 0xB4, 0x96, 0x92, 0x9E, 0x3D,
+    0xD2, 0xA1, 0xCD, 0x72, 0x7E, 0xB3, 0x6F, 0xF0, 0x19, 0x63, 0x73, 0x8C, 0x43, 0xCB, 0xE3, 0xC7,
+    0x56, 0x9F, 0x72, 0x31, 0x8D, 0x52, 0x24, 0x4A, 0xD1, 0x59, 0xB7, 0xCE, 0xFB, 0xC0, 0xC9, 0x1D,
+    0x0B, 0xBF, 0x8F, 0x8C, 0xF2, 0x30, 0x90, 0x7B, 0xBB, 0xBE, 0x73, 0x8B, 0x12, 0xF4, 0x18, 0xBD,
+    0x31, 0xB9, 0xF4, 0xA1, 0xF7, 0x19, 0xF3, 0xC3, 0xE1, 0x70, 0x38, 0xB4, 0x3A, 0x65, 0xFD, 0xE4,
+    0xEE, 0xFB, 0xE6, 0xDA, 0x21, 0x35, 0x8A, 0xD4, 0xD6, 0x46, 0xC0, 0xBB, 0x4F, 0x27, 0xEA, 0xD8,
+    0x63, 0xC7, 0xEE, 0x6A, 0x97, 0xFF, 0x37, 0x02, 0xEF, 0xF5, 0xF9, 0x66, 0xA8, 0xDF, 0x0C, 0x71,
+    0x7D, 0x4A, 0x93, 0x3D, 0xCD, 0x41, 0x02, 0xD6, 0xDB, 0xF4, 0xA1, 0x0F, 0xF6, 0x70, 0x3C, 0x1C,
+    0x0E, 0xF1, 0x0E, 0x22, 0x0E, 0xA6, 0xFB, 0xBE, 0x01, 0xAE, 0x5E, 0xDE, 0x8E, 0xD1, 0xFD, 0x96,
+    0x36, 0xEE, 0x04, 0xF6, 0xEE, 0xE5, 0xAD, 0x00, 0x6A, 0x2F, 0x33, 0x51, 0x04, 0x2E, 0xB1, 0xAE,
+    0xF2, 0x5C, 0x62, 0x26, 0xE3, 0xB8, 0xA4, 0xF0, 0x4D, 0xCF, 0x25, 0xF9, 0x62, 0xE1, 0x12, 0x42,
+    0x07, 0x97, 0xB0, 0x5E, 0xC2, 0x25, 0x5C, 0x0E, 0x17, 0x17, 0xBA, 0xB8, 0x88, 0xC9, 0x61, 0xED,
+    0x5F, 0x2E, 0x0F, 0x87, 0xCB, 0xC3, 0xE1, 0x32, 0x5D, 0x92, 0xFE, 0xC0, 0xC2, 0x25, 0x59, 0x48,
+    0x6F, 0x66, 0x46, 0x2E, 0x29, 0x7D, 0xFA, 0xA0, 0xF4, 0xB1, 0xA8, 0xBF, 0xCC, 0x75, 0xBC, 0xA5,
+    0x74, 0x83, 0xE9, 0x76, 0xC9, 0xE2, 0xEE, 0x7E, 0xE8, 0x18, 0x16, 0x9A, 0x00, 0x6A, 0x89, 0x63,
+    0x20, 0x8E, 0x81, 0x38, 0x06, 0xE2, 0x18, 0x88, 0x63, 0x20, 0x8E, 0x81, 0x38, 0x06, 0xE2, 0x18,
+    0x2E, 0x1E, 0x36, 0x86, 0x43, 0x1C, 0x03, 0x71, 0x0C, 0xC0, 0x6A, 0x5B, 0x88, 0x63, 0x20, 0x8E,
+    0x81, 0x38, 0x06, 0xE2, 0x18, 0x88, 0x63, 0x88, 0xCC, 0xC6, 0xBB, 0xFC, 0xCC, 0x63, 0xA8, 0x4F,
+    0x63, 0xD8, 0x80, 0xC1, 0x55, 0xB1, 0xE1, 0x9D, 0x79, 0x75, 0xA2, 0x7A, 0xDD, 0x37, 0x9F, 0x59,
+    0x68, 0xBE, 0xB6, 0xD8, 0x7C, 0x63, 0x68, 0x43, 0xC7, 0xF0, 0xA9, 0x95, 0xF5, 0x92, 0xE6, 0x07,
+    0x33, 0x97, 0x2F, 0x52, 0x69, 0xE4, 0xE9, 0x17, 0xC9, 0xD5, 0xC6, 0x2F, 0x3D, 0x4F, 0xBF, 0x48,
+    0xA5, 0x89, 0xCB, 0x4B, 0x9A, 0x6F, 0x2E, 0x5C, 0x76, 0x0C, 0x4F, 0x6C, 0xAC, 0x36, 0x5F, 0x19,
+    0x3E, 0x19, 0x9A, 0xCF, 0xCC, 0x34, 0x7F, 0xBC, 0x18, 0x8D, 0x54, 0xAF, 0xFB, 0xD8, 0xEF, 0x79,
+    0x4A, 0x1F, 0x8B, 0xDA, 0x9F, 0xC7, 0x18, 0x42, 0x1C, 0x83, 0x87, 0x5C, 0x93, 0x71, 0x50, 0xBD,
+    0xEE, 0x9B, 0x1E, 0x9A, 0xAF, 0x2D, 0x16, 0xE2, 0x18, 0xC8, 0x57, 0xD6, 0x4B, 0xA8, 0x66, 0x2E,
+    0x2F, 0xA1, 0x19, 0x79, 0xFA, 0x45, 0x18, 0xE2, 0x18, 0x56, 0x78, 0xFA, 0x45, 0xAA, 0x19, 0x2E,
+    0x2F, 0x69, 0x46, 0xB8, 0xEC, 0x18, 0x5A, 0xE2, 0x18, 0xC8, 0x42, 0xF3, 0x99, 0x19, 0xF2, 0xC5,
+    0x68, 0x84, 0xD2, 0x57, 0x6A, 0xC1, 0xC4, 0x31, 0xD8, 0x9F, 0x6E, 0x0C, 0xD7, 0x8E, 0xEC, 0x8C,
+    0xA8, 0x7E, 0x7F, 0x49, 0x2F, 0x6F, 0x5E, 0xE8, 0xDE, 0xC5, 0xE7, 0x1F, 0x0A, 0x90, 0xF8, 0xFB,
+    0xE1, 0xC3, 0xEC, 0x3A, 0xDC, 0x80, 0x1B, 0x7B, 0x11, 0xD2, 0x6C, 0x37, 0x8C, 0xDA, 0x4A, 0x77,
+    0xE4, 0x33, 0xCD, 0x0C, 0xC1, 0x6E, 0xD4, 0xA2, 0xD2, 0x4B, 0xF1, 0xB4, 0x34, 0x3B, 0x67, 0xD7,
+    0x49, 0x7F, 0xB5, 0x3B, 0x36, 0x51, 0x4F, 0x0C, 0x77, 0xAB, 0x3D, 0x68, 0xDF, 0x51, 0xA7, 0x4E,
+    0xDA, 0x4F, 0x51, 0xBE, 0xA7, 0xD8, 0x4D, 0xA9, 0x50, 0x5B, 0x6D, 0xFC, 0x41, 0xB4, 0xC8, 0xA9,
+    0xA5, 0x44, 0xEC, 0x61, 0x9B, 0xB4, 0x54, 0x4A, 0x27, 0x25, 0x38, 0x23, 0x9D, 0x86, 0xB1, 0xB7,
+    0x81, 0x4B, 0x6F, 0x17, 0xB7, 0x50, 0x00, 0x2E, 0x74, 0xEF, 0x42, 0xF7, 0x9E, 0x25, 0xE2, 0xB3,
+    0xA9, 0x31, 0x8C, 0xC6, 0x64, 0xDA, 0x63, 0x45, 0x52, 0xD2, 0x82, 0x49, 0x11, 0xE6, 0xEA, 0xF3,
+    0xD4, 0x24, 0x5C, 0x6D, 0xB1, 0xF7, 0x22, 0x38, 0xBD, 0xDA, 0xCD, 0x61, 0xA9, 0xBD, 0x33, 0x4F,
+    0xB5, 0xED, 0xDE, 0x83, 0x59, 0x77, 0xD7, 0xE1, 0x74, 0xCB, 0x3F, 0xF6, 0xE6, 0x53, 0x87, 0x86,
+    0x64, 0x8F, 0x52, 0x2F, 0x9B, 0x88, 0xDC, 0xA4, 0x5B, 0x96, 0x03, 0xDE, 0x11, 0x0F, 0x81, 0x01,
+    0xEC, 0x13, 0x5A, 0x3F, 0x26, 0xF6, 0x31, 0xA6, 0x3C, 0xEF, 0x9E, 0x18, 0xED, 0xF4, 0xB5, 0xA4,
+    0x95, 0x1F, 0xDF, 0xCE, 0xB8, 0xDE, 0x70, 0xE5, 0x9F, 0xA7, 0xAE, 0x48, 0x4A, 0xA8, 0x53, 0xEA,
+    0x3F, 0xBE, 0xBF, 0xC3, 0x54, 0xA7, 0xB9, 0x2F, 0x66, 0xA0, 0xDC, 0xC8, 0xC6, 0xB3, 0xAC, 0x53,
+    0xBA, 0xEB, 0x63, 0x3F, 0xAE, 0xE4, 0x08, 0x37, 0x89, 0x22, 0x3B, 0xA4, 0xAF, 0x17, 0xBA, 0x17,
+    0xCF, 0x06, 0xD9, 0x6F, 0x5B, 0x63, 0xEC, 0x70, 0x25, 0x97, 0xC7, 0xA3, 0x32, 0x5D, 0x11, 0xB3,
+    0xD4, 0xB1, 0xE1, 0x4B, 0xA1, 0xB6, 0xDC, 0xD2, 0x92, 0xAF, 0x71, 0x6E, 0x4D, 0x88, 0x33, 0x9B,
+    0xFA, 0x2E, 0x45, 0x7F, 0xDC, 0xAC, 0x58, 0xFF, 0xEB, 0x60, 0x02, 0xF6, 0x47, 0x73, 0xFC, 0xAA,
+    0x39, 0xB1, 0x0C, 0x7C, 0xEC, 0x7C, 0x23, 0x07, 0xB1, 0xD1, 0x02, 0x58, 0x1F, 0xE9, 0xA8, 0x7B,
+    0x43, 0xA0, 0xB8, 0xEA, 0xEF, 0x48, 0x2B, 0x6D, 0x9F, 0x88, 0xAB, 0x3B, 0xEC, 0x1D, 0xCA, 0x92,
+    0xD5, 0xED, 0x52, 0x1E, 0xE4, 0xF1, 0xFB, 0xCD, 0xDA, 0x23, 0x89, 0xB5, 0x1F, 0x39, 0x08, 0x29,
+    0x5B, 0x92, 0xED, 0xDE, 0xB9, 0xEE, 0x0D, 0x09, 0x9A, 0x48, 0x87, 0xEC, 0xF9, 0x48, 0x65, 0xDD,
+    0x17, 0xB3, 0x4E, 0x8B, 0x5F, 0x6D, 0x51, 0x58, 0x1E, 0x97, 0x9E, 0x50, 0x0F, 0x83, 0x34, 0xA5,
+    0xA9, 0x9B, 0xAD, 0x87, 0xDF, 0x18, 0xB6, 0x67, 0xE3, 0x85, 0x2B, 0xFB, 0x9C, 0x1C, 0xCF, 0x1B,
+    0x8B, 0x8D, 0x28, 0xD2, 0x3B, 0x36, 0x4B, 0x6A, 0xB7, 0xB1, 0x92, 0x26, 0xAD, 0x8D, 0x02, 0x79,
+    0x76, 0x61, 0xE7, 0xCF, 0x64, 0xCC, 0xAC, 0x54, 0xEB, 0x5B, 0x92, 0xE4, 0x7E, 0xAC, 0x8D, 0x17,
+    0xA6, 0x7E, 0x46, 0xFB, 0xF4, 0x19, 0x79, 0x30, 0x6B, 0x44, 0x64, 0x0B, 0xA5, 0x36, 0x39, 0x7B,
+    0xAF, 0x93, 0x38, 0x7F, 0xE5, 0xEE, 0x31, 0xCD, 0x4D, 0x72, 0x22, 0xF6, 0xCE, 0x5E, 0xE9, 0x6B,
+    0x62, 0xF7, 0x90, 0x0D, 0xDF, 0x79, 0x00, 0x94, 0xF8, 0xE7, 0xE9, 0x7D, 0xEE, 0xEE, 0xF2, 0x67,
+    0xA4, 0x6F, 0x6A, 0xEF, 0xF8, 0xA6, 0xD3, 0x64, 0xEA, 0x24, 0x88, 0x55, 0x92, 0xC5, 0x6A, 0x3B,
+    0x17, 0xC7, 0x33, 0x89, 0x3C, 0x13, 0xCA, 0x73, 0xB9, 0x3C, 0x13, 0xCD, 0x33, 0xE9, 0x3C, 0x13,
+    0xD0, 0x93, 0x8C, 0x0E, 0xD3, 0x2E, 0xA6, 0x67, 0x92, 0x7A, 0x26, 0xAC, 0x67, 0xF2, 0x7A, 0x26,
+    0xB2, 0x67, 0x52, 0x7B, 0x26, 0xB8, 0x67, 0xB2, 0x7B, 0x26, 0xBE, 0x67, 0x12, 0x6C, 0x56, 0x9A,
+    0x24, 0xC4, 0x67, 0x72, 0x7C, 0x26, 0xCA, 0x67, 0xD2, 0x7C, 0x26, 0xD0, 0x67, 0x32, 0x7D, 0x14,
+    0xEB, 0xA3, 0x7A, 0x38, 0x6E, 0xB4, 0x33, 0x05, 0x71, 0xA6, 0x21, 0xCE, 0x54, 0xC4, 0x99, 0x8E,
+    0x38, 0x53, 0x12, 0x0F, 0x6A, 0x89, 0x73, 0x89, 0x6F, 0xB6, 0xF6, 0x24, 0xF4, 0xEB, 0x99, 0xDC,
+    0x9F, 0xAF, 0xD6, 0x2E, 0xFD, 0x63, 0x7E, 0xDC, 0x00, 0xD3, 0x03, 0x7B, 0x60, 0xDF, 0x06, 0x67,
+    0x3B, 0xE1, 0x6C, 0x33, 0xE8, 0xB4, 0x1F, 0x24, 0xF9, 0xD3, 0x7A, 0xED, 0xBB, 0xE2, 0xE2, 0x6C,
+    0x63, 0x44, 0x51, 0xD8, 0x67, 0xFE, 0x7C, 0x7B, 0x9C, 0x09, 0xBE, 0x3D, 0xC9, 0xFE, 0xBE, 0x4F,
+    0xEE, 0xDB, 0x2A, 0x49, 0x91, 0xBF, 0xE1, 0xEF, 0xCE, 0xF6, 0x4C, 0x73, 0xFE, 0x77, 0xFB, 0xCE,
+    0x39, 0xDB, 0x3C, 0xA7, 0xFD, 0x73, 0xB6, 0x85, 0xCE, 0x76, 0xD1, 0xD9, 0x46, 0x3A, 0xED, 0xA5,
+    0x3E, 0xDB, 0x8B, 0x06, 0x8E, 0x8B, 0x56, 0x62, 0xE7, 0xB4, 0xB9, 0x8A, 0xB9, 0xD1, 0xD7, 0x95,
+    0xDA, 0xE1, 0x9D, 0x72, 0xB2, 0x67, 0xAB, 0x56, 0x6B, 0x1E, 0x74, 0x3B, 0xC9, 0xF9, 0x74, 0x5E,
+    0xC0, 0x70, 0x34, 0xB0, 0x3B, 0xA5, 0xEE, 0x78, 0xB8, 0xC0, 0x69, 0x6F, 0xE6, 0x7A, 0x62, 0x3F,
+    0xB2, 0x2B, 0x45, 0xCE, 0xD5, 0x1A, 0xC1, 0x1C, 0x4C, 0x48, 0x31, 0x5F, 0x1D, 0x52, 0x80, 0xD4,
+    0x2C, 0x51, 0x6A, 0x8F, 0x96, 0xF5, 0x68, 0x58, 0x8F, 0x76, 0xF5, 0x64, 0x56, 0x87, 0xDD, 0x96,
+    0x6A, 0x1F, 0xD6, 0x6E, 0x49, 0x8F, 0x26, 0xF5, 0x68, 0x51, 0x8F, 0xB3, 0x7F, 0x54, 0x5A, 0xC5,
+    0x6E, 0x44, 0x4B, 0xED, 0xC7, 0x1F, 0x6C, 0x54, 0x1B, 0x8F, 0xA6, 0x89, 0xCC, 0x7C, 0xDC, 0x26,
+    0x5B, 0x9D, 0xF6, 0x8B, 0xE4, 0xE3, 0x9D, 0x4A, 0x23, 0x34, 0x4B, 0x4A, 0x90, 0xD8, 0x99, 0x5C,
+    0xDF, 0x49, 0x51, 0xDD, 0x63, 0x9C, 0x29, 0xFF, 0xDD, 0xE6, 0xEF, 0xEA, 0xFF, 0xA8, 0xFF, 0x8F,
+    0x06, 0xE0, 0x38, 0x49, 0x47, 0x13, 0xF0, 0x80, 0x0D, 0x38, 0x7C, 0xA9, 0x8D, 0x2B, 0x10, 0xDF,
+    0xA1, 0x4B, 0xAB, 0x63, 0xEF, 0x3D, 0x15, 0x73, 0xF3, 0x2E, 0x56, 0xE1, 0x9A, 0x29, 0x86, 0xF8,
+    0xE5, 0xCC, 0xE0, 0x62, 0xD3, 0xE5, 0x2E, 0xE6, 0x78, 0x3F, 0x95, 0x90, 0x89, 0x6F, 0x4B, 0x72,
+    0xE5, 0xF6, 0xD4, 0xFC, 0x2F, 0xF4, 0xFD, 0xBE, 0x10, 0xEF, 0x4D, 0x1C, 0x91, 0x78, 0xB7, 0x76,
+    0x89, 0x58, 0x83, 0x91, 0xA3, 0xDA, 0x48, 0x4D, 0xF4, 0xDA, 0x48, 0x76, 0xD3, 0xFE, 0x8E, 0x11,
+    0x0E, 0x8F, 0xC7, 0xA5, 0x31, 0x2C, 0xD5, 0x06, 0x65, 0x6B, 0xB6, 0x42, 0xED, 0x23, 0x95, 0xCF,
+    0xD4, 0xCB, 0xD5, 0x85, 0x18, 0xC6, 0x6E, 0xEE, 0x9C, 0xEE, 0x0E, 0xBE, 0x8E, 0xE1, 0x97, 0x2F,
+    0xD2, 0x3F, 0x22, 0xA1, 0x6A, 0xC4, 0xA8, 0x8F, 0x68, 0xEB, 0x03, 0x07, 0x5A, 0x9D, 0xCE, 0x58,
+    0xBC, 0xDC, 0x19, 0xAB, 0xBB, 0xE4, 0x56, 0xFB, 0x39, 0x8E, 0xCD, 0x5E, 0xFA, 0x71, 0xF9, 0x91,
+    0x74, 0xD2, 0xF4, 0x94, 0x9A, 0x9B, 0x54, 0x8E, 0x72, 0x4A, 0x9C, 0xBD, 0x78, 0xF0, 0xF8, 0xF0,
+    0xD5, 0xE7, 0xB8, 0x4C, 0x72, 0x3D, 0xDA, 0x3E, 0x7A, 0xC2, 0xBE, 0x99, 0xA2, 0x58, 0x2D, 0xF5,
+    0x12, 0xC5, 0x2A, 0x98, 0x2D, 0x8A, 0x7E, 0x30, 0x89, 0xCF, 0x33, 0xD7, 0x11, 0x10, 0xD9, 0xDA,
+    0x3A, 0x92, 0x16, 0x7A, 0xAC, 0xD6, 0x3A, 0xB6, 0xCD, 0xD3, 0x9C, 0x4E, 0xE9, 0xD0, 0x98, 0x25,
+    0xF6, 0x4C, 0x4B, 0xA7, 0x10, 0x0B, 0x3C, 0x62, 0x4D, 0xF3, 0x0C, 0xA5, 0x56, 0x93, 0x4E, 0x15,
+    0xDD, 0xEA, 0xD8, 0x58, 0xAA, 0xDB, 0x9D, 0xCF, 0x5A, 0x3F, 0xD8, 0x8F, 0xCB, 0x4E, 0x22, 0x9C,
+    0x6D, 0x7B, 0xC9, 0x4E, 0xB7, 0x1F, 0xD3, 0x58, 0xFF, 0xDE, 0xBC, 0xC3, 0x8E, 0xE3, 0x0E, 0xEF,
+    0xEE, 0xB2, 0xF1, 0x89, 0x7D, 0xA2, 0x1E, 0x03, 0xF8, 0x7F, 0x01,
 };
 
 static const EpdGlyph bookerly_18_bolditalicGlyphs[] = {
@@ -2813,7 +2959,7 @@ static const EpdGlyph bookerly_18_bolditalicGlyphs[] = {
     { 13, 34, 12, -1, 29, 111, 13562 }, // |
     { 16, 38, 16, -2, 31, 152, 13673 }, // }
     { 19, 8, 24, 2, 17, 38, 13825 }, // ~
-    { 0, 0, 8, 0, 0, 0, 0 }, //  
+    { 0, 0, 8, 0, 0, 0, 13863 }, //  
     { 12, 30, 13, -1, 21, 90, 0 }, // ¡
     { 20, 38, 24, 2, 30, 190, 90 }, // ¢
     { 25, 28, 24, -1, 27, 175, 280 }, // £
@@ -2824,642 +2970,649 @@ static const EpdGlyph bookerly_18_bolditalicGlyphs[] = {
     { 14, 6, 24, 5, 29, 21, 997 }, // ¨
     { 28, 28, 30, 1, 27, 196, 1018 }, // ©
     { 16, 20, 17, 1, 28, 80, 1214 }, // ª
-    { 21, 15, 23, 1, 17, 79, 1294 }, // «
-    { 18, 10, 24, 3, 18, 45, 1373 }, // ¬
-    { 13, 5, 15, 1, 12, 17, 1418 }, // ­
-    { 20, 21, 22, 1, 30, 105, 1435 }, // ®
-    { 13, 5, 24, 5, 28, 17, 1540 }, // ¯
-    { 14, 14, 20, 3, 27, 49, 1557 }, // °
-    { 18, 24, 24, 3, 23, 108, 1606 }, // ±
-    { 15, 18, 17, 1, 32, 68, 1714 }, // ²
-    { 14, 19, 17, 1, 32, 67, 1782 }, // ³
-    { 8, 11, 24, 8, 33, 22, 1849 }, // ´
-    { 25, 30, 23, -2, 21, 188, 1871 }, // µ
-    { 25, 33, 23, -1, 27, 207, 2059 }, // ¶
-    { 7, 7, 12, 2, 14, 13, 2266 }, // ·
-    { 9, 10, 24, 7, -1, 23, 2279 }, // ¸
-    { 11, 18, 17, 2, 32, 50, 2302 }, // ¹
-    { 16, 19, 17, 1, 27, 76, 2352 }, // º
-    { 21, 15, 23, 1, 17, 79, 2428 }, // »
-    { 38, 31, 41, 2, 28, 295, 2507 }, // ¼
-    { 38, 31, 41, 2, 28, 295, 2802 }, // ½
-    { 39, 31, 41, 1, 28, 303, 3097 }, // ¾
-    { 13, 30, 15, 0, 21, 98, 3400 }, // ¿
-    { 30, 37, 28, -3, 37, 278, 3498 }, // À
-    { 30, 37, 28, -3, 37, 278, 3776 }, // Á
-    { 30, 37, 28, -3, 37, 278, 4054 }, // Â
-    { 30, 36, 28, -3, 36, 270, 4332 }, // Ã
-    { 30, 36, 28, -3, 36, 270, 4602 }, // Ä
-    { 30, 38, 28, -3, 38, 285, 4872 }, // Å
-    { 39, 27, 36, -3, 27, 264, 5157 }, // Æ
-    { 24, 39, 25, 1, 28, 234, 5421 }, // Ç
-    { 26, 37, 24, -2, 37, 241, 5655 }, // È
-    { 26, 37, 24, -2, 37, 241, 5896 }, // É
-    { 26, 37, 24, -2, 37, 241, 6137 }, // Ê
-    { 26, 36, 24, -2, 36, 234, 6378 }, // Ë
-    { 19, 37, 15, -2, 37, 176, 6612 }, // Ì
-    { 19, 37, 15, -2, 37, 176, 6788 }, // Í
-    { 20, 37, 15, -2, 37, 185, 6964 }, // Î
-    { 20, 36, 15, -2, 36, 180, 7149 }, // Ï
-    { 29, 29, 28, -2, 28, 211, 7329 }, // Ð
-    { 34, 37, 29, -2, 36, 315, 7540 }, // Ñ
-    { 26, 38, 28, 1, 37, 247, 7855 }, // Ò
-    { 26, 38, 28, 1, 37, 247, 8102 }, // Ó
-    { 26, 38, 28, 1, 37, 247, 8349 }, // Ô
-    { 26, 37, 28, 1, 36, 241, 8596 }, // Õ
-    { 26, 37, 28, 1, 36, 241, 8837 }, // Ö
-    { 17, 17, 24, 3, 21, 73, 9078 }, // ×
-    { 32, 30, 28, -2, 28, 240, 9151 }, // Ø
-    { 29, 38, 30, 3, 37, 276, 9391 }, // Ù
-    { 29, 38, 30, 3, 37, 276, 9667 }, // Ú
-    { 29, 38, 30, 3, 37, 276, 9943 }, // Û
-    { 29, 37, 30, 3, 36, 269, 10219 }, // Ü
-    { 26, 37, 25, 2, 37, 241, 10488 }, // Ý
-    { 25, 27, 23, -2, 27, 169, 10729 }, // Þ
-    { 31, 39, 24, -7, 30, 303, 10898 }, // ß
-    { 21, 33, 23, 1, 32, 174, 11201 }, // à
-    { 21, 34, 23, 1, 33, 179, 11375 }, // á
-    { 21, 33, 23, 1, 32, 174, 11554 }, // â
-    { 21, 31, 23, 1, 30, 163, 11728 }, // ã
-    { 21, 30, 23, 1, 29, 158, 11891 }, // ä
-    { 21, 33, 23, 1, 32, 174, 12049 }, // å
-    { 28, 22, 30, 1, 21, 154, 12223 }, // æ
-    { 16, 32, 17, 1, 21, 128, 12377 }, // ç
-    { 17, 33, 18, 1, 32, 141, 12505 }, // è
-    { 18, 34, 18, 1, 33, 153, 12646 }, // é
-    { 18, 33, 18, 1, 32, 149, 12799 }, // ê
-    { 18, 30, 18, 1, 29, 135, 12948 }, // ë
-    { 11, 33, 12, 1, 32, 91, 13083 }, // ì
-    { 15, 34, 12, 1, 33, 128, 13174 }, // í
-    { 14, 33, 12, 1, 32, 116, 13302 }, // î
-    { 15, 30, 12, 1, 29, 113, 13418 }, // ï
-    { 19, 32, 21, 1, 31, 152, 13531 }, // ð
-    { 22, 31, 24, 1, 30, 171, 13683 }, // ñ
-    { 19, 33, 21, 1, 32, 157, 13854 }, // ò
-    { 20, 34, 21, 1, 33, 170, 14011 }, // ó
-    { 19, 33, 21, 1, 32, 157, 14181 }, // ô
-    { 20, 31, 21, 1, 30, 155, 14338 }, // õ
-    { 20, 30, 21, 1, 29, 150, 14493 }, // ö
-    { 18, 18, 24, 3, 22, 81, 14643 }, // ÷
-    { 25, 23, 21, -2, 21, 144, 14724 }, // ø
-    { 23, 33, 23, 0, 32, 190, 14868 }, // ù
-    { 23, 34, 23, 0, 33, 196, 15058 }, // ú
-    { 23, 33, 23, 0, 32, 190, 15254 }, // û
-    { 23, 30, 23, 0, 29, 173, 15444 }, // ü
-    { 26, 42, 20, -6, 33, 273, 15617 }, // ý
-    { 24, 39, 21, -4, 30, 234, 15890 }, // þ
-    { 26, 38, 20, -6, 29, 247, 16124 }, // ÿ
-    { 30, 34, 28, -3, 34, 255, 0 }, // Ā
-    { 21, 29, 23, 1, 28, 153, 255 }, // ā
-    { 30, 37, 28, -3, 37, 278, 408 }, // Ă
-    { 21, 31, 23, 1, 30, 163, 686 }, // ă
-    { 30, 37, 28, -3, 28, 278, 849 }, // Ą
-    { 21, 30, 23, 1, 21, 158, 1127 }, // ą
-    { 24, 38, 25, 1, 37, 228, 1285 }, // Ć
-    { 18, 34, 17, 1, 33, 153, 1513 }, // ć
-    { 24, 38, 25, 1, 37, 228, 1666 }, // Ĉ
-    { 18, 33, 17, 1, 32, 149, 1894 }, // ĉ
-    { 24, 37, 25, 1, 36, 222, 2043 }, // Ċ
-    { 16, 31, 17, 1, 30, 124, 2265 }, // ċ
-    { 25, 38, 25, 1, 37, 238, 2389 }, // Č
-    { 19, 33, 17, 1, 32, 157, 2627 }, // č
-    { 29, 38, 28, -2, 37, 276, 2784 }, // Ď
-    { 28, 31, 24, 1, 30, 217, 3060 }, // ď
-    { 29, 29, 28, -2, 28, 211, 3277 }, // Đ
-    { 24, 31, 23, 1, 30, 186, 3488 }, // đ
-    { 26, 34, 24, -2, 34, 221, 3674 }, // Ē
-    { 18, 29, 18, 1, 28, 131, 3895 }, // ē
-    { 26, 37, 24, -2, 37, 241, 4026 }, // Ĕ
-    { 18, 31, 18, 1, 30, 140, 4267 }, // ĕ
-    { 26, 36, 24, -2, 36, 234, 4407 }, // Ė
-    { 17, 31, 18, 1, 30, 132, 4641 }, // ė
-    { 26, 36, 24, -2, 27, 234, 4773 }, // Ę
-    { 17, 30, 18, 1, 21, 128, 5007 }, // ę
-    { 26, 37, 24, -2, 37, 241, 5135 }, // Ě
-    { 19, 33, 18, 1, 32, 157, 5376 }, // ě
-    { 26, 38, 28, 1, 37, 247, 5533 }, // Ĝ
-    { 26, 41, 20, -3, 32, 267, 5780 }, // ĝ
-    { 26, 38, 28, 1, 37, 247, 6047 }, // Ğ
-    { 26, 39, 20, -3, 30, 254, 6294 }, // ğ
-    { 26, 37, 28, 1, 36, 241, 6548 }, // Ġ
-    { 26, 39, 20, -3, 30, 254, 6789 }, // ġ
-    { 26, 38, 28, 1, 28, 247, 7043 }, // Ģ
-    { 26, 42, 20, -3, 33, 273, 7290 }, // ģ
-    { 34, 37, 30, -2, 37, 315, 7563 }, // Ĥ
-    { 22, 41, 23, 0, 40, 226, 7878 }, // ĥ
-    { 34, 27, 30, -2, 27, 230, 8104 }, // Ħ
-    { 22, 31, 23, 0, 30, 171, 8334 }, // ħ
-    { 20, 36, 15, -2, 36, 180, 8505 }, // Ĩ
-    { 15, 31, 12, 1, 30, 117, 8685 }, // ĩ
-    { 20, 34, 15, -2, 34, 170, 8802 }, // Ī
-    { 15, 29, 12, 1, 28, 109, 8972 }, // ī
-    { 20, 37, 15, -2, 37, 185, 9081 }, // Ĭ
-    { 15, 31, 12, 1, 30, 117, 9266 }, // ĭ
-    { 19, 36, 15, -2, 27, 171, 9383 }, // Į
-    { 12, 38, 12, 1, 29, 114, 9554 }, // į
-    { 19, 36, 15, -2, 36, 171, 9668 }, // İ
-    { 11, 22, 12, 1, 21, 61, 9839 }, // ı
-    { 34, 35, 30, -2, 27, 298, 9900 }, // Ĳ
-    { 25, 38, 24, 1, 29, 238, 10198 }, // ĳ
-    { 26, 45, 14, -7, 37, 293, 10436 }, // Ĵ
-    { 24, 41, 12, -8, 32, 246, 10729 }, // ĵ
-    { 31, 37, 27, -2, 27, 287, 10975 }, // Ķ
-    { 20, 40, 20, 0, 30, 200, 11262 }, // ķ
-    { 20, 22, 22, 1, 21, 110, 11462 }, // ĸ
-    { 23, 37, 22, -2, 37, 213, 11572 }, // Ĺ
-    { 14, 40, 12, 1, 39, 140, 11785 }, // ĺ
-    { 23, 37, 22, -2, 27, 213, 11925 }, // Ļ
-    { 13, 40, 12, -1, 30, 130, 12138 }, // ļ
-    { 25, 30, 22, -2, 30, 188, 12268 }, // Ľ
-    { 18, 31, 13, 1, 30, 140, 12456 }, // ľ
-    { 24, 27, 22, -2, 27, 162, 12596 }, // Ŀ
-    { 17, 31, 16, 1, 30, 132, 12758 }, // ŀ
-    { 23, 27, 22, -2, 27, 156, 12890 }, // Ł
-    { 15, 31, 12, -1, 30, 117, 13046 }, // ł
-    { 34, 38, 29, -2, 37, 323, 13163 }, // Ń
-    { 22, 34, 24, 1, 33, 187, 13486 }, // ń
-    { 34, 37, 29, -2, 27, 315, 13673 }, // Ņ
-    { 22, 31, 24, 1, 21, 171, 13988 }, // ņ
-    { 34, 38, 29, -2, 37, 323, 14159 }, // Ň
-    { 22, 33, 24, 1, 32, 182, 14482 }, // ň
-    { 29, 30, 32, 2, 29, 218, 14664 }, // ŉ
-    { 34, 35, 29, -2, 27, 298, 14882 }, // Ŋ
-    { 20, 30, 22, 1, 21, 150, 15180 }, // ŋ
-    { 26, 35, 28, 1, 34, 228, 15330 }, // Ō
-    { 20, 29, 21, 1, 28, 145, 15558 }, // ō
-    { 26, 38, 28, 1, 37, 247, 15703 }, // Ŏ
-    { 20, 31, 21, 1, 30, 155, 15950 }, // ŏ
-    { 28, 39, 28, 1, 38, 273, 16105 }, // Ő
-    { 22, 33, 21, 1, 32, 182, 16378 }, // ő
-    { 37, 28, 38, 1, 27, 259, 16560 }, // Œ
-    { 30, 22, 31, 1, 21, 165, 16819 }, // œ
-    { 27, 38, 26, -2, 37, 257, 16984 }, // Ŕ
-    { 18, 33, 18, 1, 33, 149, 17241 }, // ŕ
-    { 27, 38, 26, -2, 28, 257, 17390 }, // Ŗ
-    { 20, 31, 18, -1, 21, 155, 17647 }, // ŗ
-    { 27, 38, 26, -2, 37, 257, 17802 }, // Ř
-    { 19, 32, 18, 1, 32, 152, 18059 }, // ř
-    { 22, 38, 21, -1, 37, 209, 18211 }, // Ś
-    { 19, 34, 16, -1, 33, 162, 18420 }, // ś
-    { 22, 38, 21, -1, 37, 209, 18582 }, // Ŝ
-    { 19, 33, 16, -1, 32, 157, 18791 }, // ŝ
-    { 22, 39, 21, -1, 28, 215, 18948 }, // Ş
-    { 17, 32, 16, -1, 21, 136, 19163 }, // ş
-    { 23, 38, 21, -1, 37, 219, 19299 }, // Š
-    { 20, 33, 16, -1, 32, 165, 19518 }, // š
-    { 25, 38, 25, 2, 27, 238, 19683 }, // Ţ
-    { 16, 36, 16, 1, 25, 144, 19921 }, // ţ
-    { 25, 37, 25, 2, 37, 232, 20065 }, // Ť
-    { 18, 32, 16, 1, 31, 144, 20297 }, // ť
-    { 25, 27, 25, 2, 27, 169, 20441 }, // Ŧ
-    { 17, 26, 16, 0, 25, 111, 20610 }, // ŧ
-    { 29, 37, 30, 3, 36, 269, 20721 }, // Ũ
-    { 23, 31, 23, 0, 30, 179, 20990 }, // ũ
-    { 29, 35, 30, 3, 34, 254, 21169 }, // Ū
-    { 23, 29, 23, 0, 28, 167, 21423 }, // ū
-    { 29, 38, 30, 3, 37, 276, 21590 }, // Ŭ
-    { 23, 31, 23, 0, 30, 179, 21866 }, // ŭ
-    { 29, 39, 30, 3, 38, 283, 22045 }, // Ů
-    { 23, 33, 23, 0, 32, 190, 22328 }, // ů
-    { 29, 39, 30, 3, 38, 283, 22518 }, // Ű
-    { 23, 33, 23, 0, 32, 190, 22801 }, // ű
-    { 29, 36, 30, 3, 27, 261, 22991 }, // Ų
-    { 23, 30, 23, 0, 21, 173, 23252 }, // ų
-    { 39, 38, 38, 2, 37, 371, 23425 }, // Ŵ
-    { 29, 33, 29, 0, 32, 240, 23796 }, // ŵ
-    { 26, 37, 25, 2, 37, 241, 24036 }, // Ŷ
-    { 26, 41, 20, -6, 32, 267, 24277 }, // ŷ
-    { 26, 36, 25, 2, 36, 234, 24544 }, // Ÿ
-    { 24, 38, 24, -1, 37, 228, 24778 }, // Ź
-    { 20, 34, 18, -1, 33, 170, 25006 }, // ź
-    { 24, 37, 24, -1, 36, 222, 25176 }, // Ż
-    { 20, 31, 18, -1, 30, 155, 25398 }, // ż
-    { 24, 38, 24, -1, 37, 228, 25553 }, // Ž
-    { 20, 33, 18, -1, 32, 165, 25781 }, // ž
-    { 28, 39, 16, -7, 30, 273, 25946 }, // ſ
-    { 9, 10, 0, -6, 32, 23, 0 }, // ̀
-    { 8, 11, 0, -3, 33, 22, 23 }, // ́
-    { 14, 10, 0, -8, 32, 35, 45 }, // ̂
-    { 14, 7, 0, -7, 30, 25, 80 }, // ̃
-    { 13, 5, 0, -7, 28, 17, 105 }, // ̄
-    { 12, 7, 0, -6, 30, 21, 122 }, // ̆
-    { 6, 7, 0, -3, 30, 11, 143 }, // ̇
-    { 14, 6, 0, -7, 29, 21, 154 }, // ̈
-    { 11, 12, 0, -5, 34, 33, 175 }, // ̉
-    { 10, 10, 0, -5, 32, 25, 208 }, // ̊
-    { 16, 10, 0, -7, 32, 40, 233 }, // ̋
-    { 14, 9, 0, -6, 32, 32, 273 }, // ̌
-    { 12, 10, 0, -8, 32, 30, 305 }, // ̏
-    { 13, 8, 0, -7, 30, 26, 335 }, // ̑
-    { 8, 11, 0, -4, 33, 22, 361 }, // ̒
-    { 9, 11, 0, -4, 34, 25, 383 }, // ̓
-    { 8, 11, 0, -5, 34, 22, 408 }, // ̔
-    { 6, 10, 0, -3, 33, 15, 430 }, // ̕
-    { 8, 10, 0, -4, 25, 20, 445 }, // ̛
-    { 6, 6, 0, -3, -3, 9, 465 }, // ̣
-    { 14, 6, 0, -7, -3, 21, 474 }, // ̤
-    { 10, 9, 0, -5, -1, 23, 495 }, // ̥
-    { 7, 9, 0, -4, -1, 16, 518 }, // ̦
-    { 9, 10, 0, -5, -1, 23, 534 }, // ̧
-    { 8, 10, 0, -4, 1, 20, 557 }, // ̨
-    { 7, 9, 10, -1, -2, 16, 577 }, // ̩
-    { 15, 8, 0, -8, -2, 30, 593 }, // ̭
-    { 12, 8, 0, -6, -2, 24, 623 }, // ̮
-    { 14, 7, 0, -7, -3, 25, 647 }, // ̰
-    { 14, 4, 0, -7, -4, 14, 672 }, // ̱
-    { 12, 8, 0, -6, 30, 24, 686 }, // ͂
-    { 15, 15, 0, -8, 39, 57, 710 }, // ̈́
-    { 8, 8, 0, -3, -2, 16, 767 }, // ͅ
-    { 26, 37, 24, -2, 37, 241, 0 }, // Ѐ
-    { 26, 36, 24, -2, 36, 234, 241 }, // Ё
-    { 26, 35, 29, 2, 27, 228, 475 }, // Ђ
-    { 26, 37, 22, -2, 37, 241, 703 }, // Ѓ
-    { 24, 29, 25, 1, 28, 174, 944 }, // Є
-    { 22, 29, 21, -1, 28, 160, 1118 }, // Ѕ
-    { 19, 27, 15, -2, 27, 129, 1278 }, // І
-    { 20, 36, 15, -2, 36, 180, 1407 }, // Ї
-    { 24, 35, 14, -7, 27, 210, 1587 }, // Ј
-    { 36, 28, 35, -2, 27, 252, 1797 }, // Љ
-    { 37, 28, 36, -2, 27, 259, 2049 }, // Њ
-    { 28, 27, 32, 2, 27, 189, 2308 }, // Ћ
-    { 31, 38, 27, -2, 37, 295, 2497 }, // Ќ
-    { 34, 37, 31, -2, 37, 315, 2792 }, // Ѝ
-    { 28, 39, 26, 1, 38, 273, 3107 }, // Ў
-    { 33, 36, 29, -2, 27, 297, 3380 }, // Џ
-    { 30, 28, 28, -3, 28, 210, 3677 }, // А
-    { 25, 28, 24, -2, 27, 175, 3887 }, // Б
-    { 25, 29, 24, -2, 28, 182, 4062 }, // В
-    { 26, 27, 22, -2, 27, 176, 4244 }, // Г
-    { 33, 35, 28, -3, 27, 289, 4420 }, // Д
-    { 26, 27, 24, -2, 27, 176, 4709 }, // Е
-    { 43, 29, 37, -4, 28, 312, 4885 }, // Ж
-    { 21, 29, 22, -1, 28, 153, 5197 }, // З
-    { 34, 27, 31, -2, 27, 230, 5350 }, // И
-    { 34, 38, 31, -2, 38, 323, 5580 }, // Й
-    { 31, 29, 27, -2, 28, 225, 5903 }, // К
-    { 32, 28, 28, -2, 27, 224, 6128 }, // Л
-    { 37, 27, 34, -3, 27, 250, 6352 }, // М
-    { 34, 27, 30, -2, 27, 230, 6602 }, // Н
-    { 26, 29, 28, 1, 28, 189, 6832 }, // О
-    { 33, 27, 29, -2, 27, 223, 7021 }, // П
-    { 26, 28, 23, -2, 28, 182, 7244 }, // Р
-    { 24, 29, 25, 1, 28, 174, 7426 }, // С
-    { 25, 27, 25, 2, 27, 169, 7600 }, // Т
-    { 28, 28, 26, 1, 27, 196, 7769 }, // У
-    { 28, 29, 29, 0, 28, 203, 7965 }, // Ф
-    { 32, 27, 25, -4, 27, 216, 8168 }, // Х
-    { 33, 35, 29, -2, 27, 289, 8384 }, // Ц
-    { 27, 27, 27, 2, 27, 183, 8673 }, // Ч
-    { 42, 27, 38, -2, 27, 284, 8856 }, // Ш
-    { 42, 35, 39, -2, 27, 368, 9140 }, // Щ
-    { 25, 28, 28, 2, 27, 175, 9508 }, // Ъ
-    { 40, 28, 36, -2, 27, 280, 9683 }, // Ы
-    { 24, 28, 23, -2, 27, 168, 9963 }, // Ь
-    { 24, 29, 24, -1, 28, 174, 10131 }, // Э
-    { 41, 29, 39, -2, 28, 298, 10305 }, // Ю
-    { 29, 28, 25, -2, 27, 203, 10603 }, // Я
-    { 21, 22, 23, 1, 21, 116, 10806 }, // а
-    { 22, 32, 21, 1, 31, 176, 10922 }, // б
-    { 18, 22, 20, 1, 21, 99, 11098 }, // в
-    { 17, 22, 17, 0, 21, 94, 11197 }, // г
-    { 19, 31, 21, 1, 30, 148, 11291 }, // д
-    { 17, 22, 18, 1, 21, 94, 11439 }, // е
-    { 34, 22, 34, 0, 21, 187, 11533 }, // ж
-    { 18, 22, 18, -1, 21, 99, 11720 }, // з
-    { 23, 22, 23, 0, 21, 127, 11819 }, // и
-    { 23, 32, 23, 0, 31, 184, 11946 }, // й
-    { 20, 22, 22, 1, 21, 110, 12130 }, // к
-    { 24, 22, 24, -1, 21, 132, 12240 }, // л
-    { 31, 22, 30, -1, 21, 171, 12372 }, // м
-    { 22, 22, 24, 1, 21, 121, 12543 }, // н
-    { 19, 22, 21, 1, 21, 105, 12664 }, // о
-    { 22, 22, 24, 1, 21, 121, 12769 }, // п
-    { 24, 30, 22, -3, 21, 180, 12890 }, // р
-    { 16, 22, 17, 1, 21, 88, 13070 }, // с
-    { 32, 22, 33, 1, 21, 176, 13158 }, // т
-    { 26, 30, 20, -6, 21, 195, 13334 }, // у
-    { 26, 39, 27, 1, 30, 254, 13529 }, // ф
-    { 23, 22, 22, -1, 21, 127, 13783 }, // х
-    { 23, 29, 24, 0, 21, 167, 13910 }, // ц
-    { 21, 22, 23, 1, 21, 116, 14077 }, // ч
-    { 32, 22, 32, 0, 21, 176, 14193 }, // ш
-    { 32, 29, 32, 0, 21, 232, 14369 }, // щ
-    { 19, 22, 21, 1, 21, 105, 14601 }, // ъ
-    { 29, 22, 30, 0, 21, 160, 14706 }, // ы
-    { 19, 22, 19, 0, 21, 105, 14866 }, // ь
-    { 19, 22, 18, -1, 21, 105, 14971 }, // э
-    { 29, 22, 30, 1, 21, 160, 15076 }, // ю
-    { 22, 22, 23, 0, 21, 121, 15236 }, // я
-    { 17, 33, 18, 1, 32, 141, 15357 }, // ѐ
-    { 18, 30, 18, 1, 29, 135, 15498 }, // ё
-    { 20, 39, 22, 0, 30, 195, 15633 }, // ђ
-    { 18, 34, 17, 0, 33, 153, 15828 }, // ѓ
-    { 17, 22, 18, 1, 21, 94, 15981 }, // є
-    { 17, 22, 16, -1, 21, 94, 16075 }, // ѕ
-    { 12, 30, 12, 1, 29, 90, 16169 }, // і
-    { 15, 30, 12, 1, 29, 113, 16259 }, // ї
-    { 22, 38, 12, -8, 29, 209, 16372 }, // ј
-    { 30, 22, 30, -1, 21, 165, 16581 }, // љ
-    { 28, 22, 29, 1, 21, 154, 16746 }, // њ
-    { 22, 31, 23, 0, 30, 171, 16900 }, // ћ
-    { 20, 34, 22, 1, 33, 170, 17071 }, // ќ
-    { 23, 33, 23, 0, 32, 190, 17241 }, // ѝ
-    { 26, 40, 20, -6, 31, 260, 17431 }, // ў
-    { 23, 29, 23, 0, 21, 167, 17691 }, // џ
-    { 24, 31, 27, 2, 30, 186, 17858 }, // Ѣ
-    { 28, 22, 30, 1, 21, 154, 18044 }, // ѣ
-    { 26, 29, 28, 1, 28, 189, 18198 }, // Ѳ
-    { 19, 22, 21, 1, 21, 105, 18387 }, // ѳ
-    { 29, 29, 29, 2, 28, 211, 18492 }, // Ѵ
-    { 24, 22, 22, -1, 21, 132, 18703 }, // ѵ
-    { 34, 46, 31, -2, 38, 391, 18835 }, // Ҋ
-    { 23, 39, 23, 0, 31, 225, 19226 }, // ҋ
-    { 24, 28, 23, -2, 27, 168, 19451 }, // Ҍ
-    { 18, 29, 19, 1, 28, 131, 19619 }, // ҍ
-    { 26, 28, 23, -2, 28, 182, 19750 }, // Ҏ
-    { 24, 30, 22, -3, 21, 180, 19932 }, // ҏ
-    { 26, 32, 22, -2, 32, 208, 20112 }, // Ґ
-    { 20, 26, 18, 0, 25, 130, 20320 }, // ґ
-    { 26, 27, 22, -2, 27, 176, 20450 }, // Ғ
-    { 17, 22, 17, 0, 21, 94, 20626 }, // ғ
-    { 25, 35, 25, -2, 27, 219, 20720 }, // Ҕ
-    { 18, 29, 21, 1, 20, 131, 20939 }, // ҕ
-    { 43, 36, 37, -4, 28, 387, 21070 }, // Җ
-    { 34, 29, 34, 0, 21, 247, 21457 }, // җ
-    { 21, 36, 22, -1, 28, 189, 21704 }, // Ҙ
-    { 18, 29, 18, -1, 21, 131, 21893 }, // ҙ
-    { 30, 36, 27, -2, 28, 270, 22024 }, // Қ
-    { 20, 29, 22, 1, 21, 145, 22294 }, // қ
-    { 32, 29, 28, -2, 28, 232, 22439 }, // Ҝ
-    { 23, 22, 24, 1, 21, 127, 22671 }, // ҝ
-    { 31, 29, 27, -2, 28, 225, 22798 }, // Ҟ
-    { 21, 29, 21, 0, 28, 153, 23023 }, // ҟ
-    { 31, 29, 31, 2, 28, 225, 23176 }, // Ҡ
-    { 24, 22, 25, 1, 21, 132, 23401 }, // ҡ
-    { 34, 35, 31, -2, 27, 298, 23533 }, // Ң
-    { 23, 29, 24, 1, 21, 167, 23831 }, // ң
-    { 39, 27, 35, -2, 27, 264, 23998 }, // Ҥ
-    { 28, 22, 29, 1, 21, 154, 24262 }, // ҥ
-    { 39, 35, 39, -2, 27, 342, 24416 }, // Ҧ
-    { 30, 30, 32, 1, 21, 225, 24758 }, // ҧ
-    { 30, 29, 32, 1, 28, 218, 24983 }, // Ҩ
-    { 23, 22, 25, 1, 21, 127, 25201 }, // ҩ
-    { 24, 36, 25, 1, 28, 216, 25328 }, // Ҫ
-    { 16, 29, 17, 1, 21, 116, 25544 }, // ҫ
-    { 25, 35, 25, 2, 27, 219, 25660 }, // Ҭ
-    { 32, 29, 34, 1, 21, 232, 25879 }, // ҭ
-    { 26, 27, 25, 2, 27, 176, 26111 }, // Ү
-    { 20, 30, 20, 0, 21, 150, 26287 }, // ү
-    { 26, 27, 25, 2, 27, 176, 26437 }, // Ұ
-    { 20, 30, 20, 0, 21, 150, 26613 }, // ұ
-    { 32, 35, 25, -4, 27, 280, 26763 }, // Ҳ
-    { 23, 29, 22, -1, 21, 167, 27043 }, // ҳ
-    { 35, 35, 35, 2, 27, 307, 27210 }, // Ҵ
-    { 23, 36, 24, 0, 28, 207, 27517 }, // ҵ
-    { 27, 35, 27, 2, 27, 237, 27724 }, // Ҷ
-    { 22, 29, 23, 1, 21, 160, 27961 }, // ҷ
-    { 27, 27, 28, 2, 27, 183, 28121 }, // Ҹ
-    { 22, 22, 23, 1, 21, 121, 28304 }, // ҹ
-    { 27, 27, 27, -2, 27, 183, 28425 }, // Һ
-    { 22, 31, 23, 0, 30, 171, 28608 }, // һ
-    { 30, 29, 31, 1, 28, 218, 28779 }, // Ҽ
-    { 22, 22, 23, 0, 21, 121, 28997 }, // ҽ
-    { 30, 37, 31, 1, 28, 278, 29118 }, // Ҿ
-    { 22, 29, 23, 0, 21, 160, 29396 }, // ҿ
-    { 19, 27, 15, -2, 27, 129, 29556 }, // Ӏ
-    { 43, 39, 37, -4, 38, 420, 29685 }, // Ӂ
-    { 34, 32, 34, 0, 31, 272, 30105 }, // ӂ
-    { 31, 36, 27, -2, 28, 279, 30377 }, // Ӄ
-    { 21, 30, 22, 1, 21, 158, 30656 }, // ӄ
-    { 32, 35, 28, -2, 27, 280, 30814 }, // Ӆ
-    { 25, 29, 24, -1, 21, 182, 31094 }, // ӆ
-    { 34, 35, 30, -2, 27, 298, 31276 }, // Ӈ
-    { 21, 30, 22, 1, 21, 158, 31574 }, // ӈ
-    { 34, 35, 31, -2, 27, 298, 31732 }, // Ӊ
-    { 23, 29, 24, 1, 21, 167, 32030 }, // ӊ
-    { 27, 35, 27, 2, 27, 237, 32197 }, // Ӌ
-    { 21, 29, 22, 1, 21, 153, 32434 }, // ӌ
-    { 37, 35, 35, -3, 27, 324, 32587 }, // Ӎ
-    { 31, 29, 30, -1, 21, 225, 32911 }, // ӎ
-    { 19, 30, 15, -2, 30, 143, 33136 }, // ӏ
-    { 30, 38, 28, -3, 38, 285, 33279 }, // Ӑ
-    { 21, 32, 23, 1, 31, 168, 33564 }, // ӑ
-    { 30, 36, 28, -3, 36, 270, 33732 }, // Ӓ
-    { 21, 30, 23, 1, 29, 158, 34002 }, // ӓ
-    { 39, 27, 36, -3, 27, 264, 34160 }, // Ӕ
-    { 28, 22, 30, 1, 21, 154, 34424 }, // ӕ
-    { 26, 38, 24, -2, 38, 247, 34578 }, // Ӗ
-    { 18, 32, 18, 1, 31, 144, 34825 }, // ӗ
-    { 25, 29, 25, 0, 28, 182, 34969 }, // Ә
-    { 18, 22, 19, 0, 21, 99, 35151 }, // ә
-    { 25, 37, 25, 0, 36, 232, 35250 }, // Ӛ
-    { 18, 30, 19, 0, 29, 135, 35482 }, // ӛ
-    { 43, 37, 37, -4, 36, 398, 35617 }, // Ӝ
-    { 34, 30, 34, 0, 29, 255, 36015 }, // ӝ
-    { 21, 37, 22, -1, 36, 195, 36270 }, // Ӟ
-    { 19, 30, 18, -1, 29, 143, 36465 }, // ӟ
-    { 24, 28, 22, -1, 27, 168, 36608 }, // Ӡ
-    { 23, 29, 20, -3, 20, 167, 36776 }, // ӡ
-    { 34, 34, 31, -2, 34, 289, 36943 }, // Ӣ
-    { 23, 29, 23, 0, 28, 167, 37232 }, // ӣ
-    { 34, 36, 31, -2, 36, 306, 37399 }, // Ӥ
-    { 23, 30, 23, 0, 29, 173, 37705 }, // ӥ
-    { 26, 37, 28, 1, 36, 241, 37878 }, // Ӧ
-    { 20, 30, 21, 1, 29, 150, 38119 }, // ӧ
-    { 26, 29, 28, 1, 28, 189, 38269 }, // Ө
-    { 19, 22, 21, 1, 21, 105, 38458 }, // ө
-    { 26, 37, 28, 1, 36, 241, 38563 }, // Ӫ
-    { 20, 30, 21, 1, 29, 150, 38804 }, // ӫ
-    { 24, 37, 24, -1, 36, 222, 38954 }, // Ӭ
-    { 19, 30, 18, -1, 29, 143, 39176 }, // ӭ
-    { 28, 35, 26, 1, 34, 245, 39319 }, // Ӯ
-    { 26, 37, 20, -6, 28, 241, 39564 }, // ӯ
-    { 28, 37, 26, 1, 36, 259, 39805 }, // Ӱ
-    { 26, 38, 20, -6, 29, 247, 40064 }, // ӱ
-    { 28, 39, 26, 1, 38, 273, 40311 }, // Ӳ
-    { 26, 41, 20, -6, 32, 267, 40584 }, // ӳ
-    { 27, 36, 27, 2, 36, 243, 40851 }, // Ӵ
-    { 21, 30, 23, 1, 29, 158, 41094 }, // ӵ
-    { 26, 35, 22, -2, 27, 228, 41252 }, // Ӷ
-    { 17, 29, 17, 0, 21, 124, 41480 }, // ӷ
-    { 40, 37, 36, -2, 36, 370, 41604 }, // Ӹ
-    { 29, 30, 30, 0, 29, 218, 41974 }, // ӹ
-    { 26, 35, 22, -2, 27, 228, 42192 }, // Ӻ
-    { 17, 29, 17, 0, 21, 124, 42420 }, // ӻ
-    { 32, 35, 25, -4, 27, 280, 42544 }, // Ӽ
-    { 23, 30, 22, -1, 21, 173, 42824 }, // ӽ
-    { 32, 27, 25, -4, 27, 216, 42997 }, // Ӿ
-    { 23, 22, 22, -1, 21, 127, 43213 }, // ӿ
-    { 0, 0, 19, 0, 0, 0, 0 }, //  
-    { 0, 0, 38, 0, 0, 0, 0 }, //  
-    { 0, 0, 19, 0, 0, 0, 0 }, //  
-    { 0, 0, 38, 0, 0, 0, 0 }, //  
-    { 0, 0, 13, 0, 0, 0, 0 }, //  
-    { 0, 0, 10, 0, 0, 0, 0 }, //  
-    { 0, 0, 6, 0, 0, 0, 0 }, //  
-    { 0, 0, 24, 0, 0, 0, 0 }, //  
-    { 0, 0, 12, 0, 0, 0, 0 }, //  
-    { 0, 0, 8, 0, 0, 0, 0 }, //  
-    { 0, 0, 2, 0, 0, 0, 0 }, //  
-    { 0, 0, 0, 0, 0, 0, 0 }, // ​
-    { 2, 31, 0, -1, 22, 16, 0 }, // ‌
-    { 8, 34, 0, -4, 25, 68, 16 }, // ‍
-    { 14, 36, 0, -7, 27, 126, 84 }, // ‎
-    { 14, 36, 0, -7, 27, 126, 210 }, // ‏
-    { 13, 5, 15, 1, 12, 17, 336 }, // ‐
-    { 13, 5, 15, 1, 12, 17, 353 }, // ‑
-    { 19, 5, 24, 2, 15, 24, 370 }, // ‒
-    { 19, 5, 19, 0, 12, 24, 394 }, // –
-    { 38, 5, 38, 0, 12, 48, 418 }, // —
-    { 38, 5, 38, 0, 12, 48, 466 }, // ―
-    { 13, 39, 19, 3, 30, 127, 514 }, // ‖
-    { 19, 11, 19, 0, -1, 53, 641 }, // ‗
-    { 9, 13, 11, 3, 29, 30, 694 }, // ‘
-    { 9, 13, 11, 2, 29, 30, 724 }, // ’
-    { 9, 12, 11, 0, 5, 27, 754 }, // ‚
-    { 8, 14, 11, 2, 29, 28, 781 }, // ‛
-    { 17, 13, 19, 3, 29, 56, 809 }, // “
-    { 17, 12, 19, 2, 28, 51, 865 }, // ”
-    { 16, 12, 19, 0, 5, 48, 916 }, // „
-    { 16, 14, 19, 2, 29, 56, 964 }, // ‟
-    { 17, 25, 18, 1, 27, 107, 1020 }, // †
-    { 19, 29, 18, -1, 27, 138, 1127 }, // ‡
-    { 9, 9, 11, 1, 15, 21, 1265 }, // •
-    { 14, 14, 24, 5, 20, 49, 1286 }, // ‣
-    { 7, 7, 11, 2, 6, 13, 1335 }, // ․
-    { 17, 7, 19, 1, 6, 30, 1348 }, // ‥
-    { 32, 7, 38, 3, 6, 56, 1378 }, // …
-    { 7, 7, 11, 2, 14, 13, 1434 }, // ‧
-    { 0, 0, 0, 0, 0, 0, 1447 }, //  
-    { 0, 0, 0, 0, 0, 0, 1447 }, //  
-    { 14, 36, 0, -7, 27, 126, 1447 }, // ‪
-    { 14, 36, 0, -7, 27, 126, 1573 }, // ‫
-    { 12, 35, 0, -6, 26, 105, 1699 }, // ‬
-    { 16, 36, 0, -8, 27, 144, 1804 }, // ‭
-    { 16, 36, 0, -8, 27, 144, 1948 }, // ‮
-    { 0, 0, 4, 0, 0, 0, 2092 }, //  
-    { 51, 31, 54, 1, 28, 396, 2092 }, // ‰
-    { 8, 13, 10, 1, 27, 26, 2488 }, // ′
-    { 16, 13, 17, 1, 27, 52, 2514 }, // ″
-    { 25, 13, 26, 1, 27, 82, 2566 }, // ‴
-    { 9, 13, 10, 0, 27, 30, 2648 }, // ‵
-    { 17, 13, 18, 0, 27, 56, 2678 }, // ‶
-    { 26, 13, 26, 0, 27, 85, 2734 }, // ‷
-    { 17, 8, 19, 1, 0, 34, 2819 }, // ‸
-    { 12, 15, 13, 1, 17, 45, 2853 }, // ‹
-    { 12, 15, 13, 1, 17, 45, 2898 }, // ›
-    { 24, 26, 24, 0, 25, 156, 2943 }, // ※
-    { 23, 30, 23, 1, 29, 173, 3099 }, // ‼
-    { 19, 4, 19, 0, 32, 19, 3272 }, // ‾
-    { 9, 5, 11, 1, 12, 12, 3291 }, // ⁃
-    { 25, 31, 11, -7, 28, 194, 3303 }, // ⁄
-    { 27, 29, 30, 3, 28, 196, 3497 }, // ⁇
-    { 24, 30, 26, 3, 29, 180, 3693 }, // ⁈
-    { 26, 30, 27, 1, 29, 195, 3873 }, // ⁉
-    { 23, 8, 38, 7, 15, 46, 4068 }, // ⁓
-    { 33, 13, 35, 1, 27, 108, 4114 }, // ⁗
-    { 0, 0, 8, 0, 0, 0, 4222 }, //  
-    { 0, 0, 0, 0, 0, 0, 4222 }, // ⁠
-    { 0, 0, 0, 0, 0, 0, 4222 }, // ⁡
-    { 0, 0, 0, 0, 0, 0, 4222 }, // ⁢
-    { 0, 0, 0, 0, 0, 0, 4222 }, // ⁣
-    { 0, 0, 0, 0, 0, 0, 4222 }, // ⁤
-    { 15, 19, 17, 1, 32, 72, 0 }, // ⁰
-    { 16, 19, 17, 0, 32, 76, 72 }, // ⁴
-    { 15, 18, 17, 1, 31, 68, 148 }, // ⁵
-    { 16, 19, 17, 1, 32, 76, 216 }, // ⁶
-    { 14, 18, 17, 3, 31, 63, 292 }, // ⁷
-    { 15, 19, 17, 1, 32, 72, 355 }, // ⁸
-    { 16, 19, 17, 0, 32, 76, 427 }, // ⁹
-    { 15, 14, 22, 4, 27, 53, 503 }, // ⁿ
-    { 15, 19, 17, 1, 13, 72, 556 }, // ₀
-    { 11, 18, 17, 2, 13, 50, 628 }, // ₁
-    { 15, 18, 17, 1, 13, 68, 678 }, // ₂
-    { 14, 19, 17, 1, 13, 67, 746 }, // ₃
-    { 16, 19, 17, 0, 13, 76, 813 }, // ₄
-    { 15, 18, 17, 1, 12, 68, 889 }, // ₅
-    { 16, 19, 17, 1, 13, 76, 957 }, // ₆
-    { 14, 18, 17, 3, 12, 63, 1033 }, // ₇
-    { 15, 19, 17, 1, 13, 72, 1096 }, // ₈
-    { 16, 19, 17, 0, 13, 76, 1168 }, // ₉
-    { 25, 26, 24, -1, 26, 163, 0 }, // ₣
-    { 25, 28, 24, -1, 27, 175, 163 }, // ₤
-    { 49, 28, 50, 0, 27, 343, 338 }, // ₧
-    { 26, 28, 24, -1, 27, 182, 681 }, // €
-    { 24, 18, 38, 7, 22, 108, 0 }, // ←
-    { 18, 25, 38, 10, 26, 113, 108 }, // ↑
-    { 24, 18, 38, 7, 22, 108, 221 }, // →
-    { 18, 25, 38, 10, 26, 113, 329 }, // ↓
-    { 24, 17, 38, 7, 22, 102, 442 }, // ↔
-    { 16, 26, 38, 11, 26, 104, 544 }, // ↕
-    { 18, 27, 38, 10, 27, 122, 648 }, // ↨
-    { 18, 26, 38, 10, 26, 117, 770 }, // ↲
-    { 18, 26, 38, 10, 26, 117, 887 }, // ↳
-    { 22, 20, 38, 8, 23, 110, 1004 }, // ↵
-    { 24, 22, 38, 7, 24, 132, 1114 }, // ⇐
-    { 22, 24, 38, 8, 25, 132, 1246 }, // ⇑
-    { 24, 22, 38, 7, 24, 132, 1378 }, // ⇒
-    { 22, 24, 38, 8, 25, 132, 1510 }, // ⇓
-    { 24, 20, 38, 7, 23, 120, 1642 }, // ⇔
-    { 26, 28, 38, 6, 27, 182, 0 }, // ∀
-    { 20, 31, 24, 2, 30, 155, 182 }, // ∂
-    { 20, 27, 38, 9, 27, 135, 337 }, // ∃
-    { 30, 30, 38, 4, 28, 225, 472 }, // ∅
-    { 25, 28, 26, 0, 28, 175, 697 }, // ∆
-    { 26, 28, 38, 6, 27, 182, 872 }, // ∇
-    { 26, 27, 38, 6, 27, 176, 1054 }, // ∈
-    { 26, 34, 38, 6, 30, 221, 1230 }, // ∉
-    { 26, 23, 38, 6, 25, 150, 1451 }, // ∊
-    { 26, 27, 38, 6, 27, 176, 1601 }, // ∋
-    { 26, 34, 38, 6, 30, 221, 1777 }, // ∌
-    { 26, 23, 38, 6, 25, 150, 1998 }, // ∍
-    { 30, 33, 32, 1, 27, 248, 2148 }, // ∏
-    { 24, 34, 25, 1, 27, 204, 2396 }, // ∑
-    { 18, 4, 24, 3, 15, 18, 2600 }, // −
-    { 23, 30, 20, -2, 28, 173, 2618 }, // ∕
-    { 18, 30, 20, 1, 28, 135, 2791 }, // ∖
-    { 18, 18, 24, 3, 22, 81, 2926 }, // ∗
-    { 14, 14, 24, 5, 20, 49, 3007 }, // ∘
-    { 8, 7, 24, 8, 14, 14, 3056 }, // ∙
-    { 25, 36, 24, -1, 31, 225, 3070 }, // √
-    { 19, 16, 24, 2, 20, 76, 3295 }, // ∝
-    { 24, 14, 24, 0, 19, 84, 3371 }, // ∞
-    { 24, 27, 38, 7, 27, 162, 3455 }, // ∟
-    { 28, 27, 38, 5, 27, 189, 3617 }, // ∠
-    { 5, 39, 19, 7, 30, 49, 3806 }, // ∣
-    { 13, 39, 19, 3, 30, 127, 3855 }, // ∥
-    { 26, 27, 38, 6, 27, 176, 3982 }, // ∧
-    { 26, 27, 38, 6, 27, 176, 4158 }, // ∨
-    { 22, 28, 38, 8, 28, 154, 4334 }, // ∩
-    { 22, 28, 38, 8, 27, 154, 4488 }, // ∪
-    { 22, 39, 24, 1, 30, 215, 4642 }, // ∫
-    { 26, 22, 38, 6, 21, 143, 4857 }, // ∴
-    { 26, 22, 38, 6, 21, 143, 5000 }, // ∵
-    { 10, 21, 12, 1, 23, 53, 5143 }, // ∶
-    { 26, 22, 38, 6, 21, 143, 5196 }, // ∷
-    { 23, 8, 38, 7, 15, 46, 5339 }, // ∼
-    { 23, 22, 38, 7, 24, 127, 5385 }, // ≅
-    { 19, 16, 24, 2, 21, 76, 5512 }, // ≈
-    { 22, 15, 38, 8, 18, 83, 5588 }, // ≍
-    { 18, 19, 24, 3, 22, 86, 5671 }, // ≠
-    { 22, 19, 38, 8, 21, 105, 5757 }, // ≡
-    { 18, 23, 24, 3, 23, 104, 5862 }, // ≤
-    { 18, 24, 24, 3, 24, 108, 5966 }, // ≥
-    { 32, 18, 38, 3, 22, 144, 6074 }, // ≪
-    { 32, 18, 38, 3, 22, 144, 6218 }, // ≫
-    { 26, 23, 38, 6, 25, 150, 6362 }, // ⊃
-    { 26, 34, 38, 6, 30, 221, 6512 }, // ⊄
-    { 26, 34, 38, 6, 30, 221, 6733 }, // ⊅
-    { 26, 27, 38, 6, 27, 176, 6954 }, // ⊆
-    { 26, 27, 38, 6, 27, 176, 7130 }, // ⊇
-    { 28, 28, 38, 5, 27, 196, 7306 }, // ⊕
-    { 28, 28, 38, 5, 27, 196, 7502 }, // ⊖
-    { 28, 28, 38, 5, 27, 196, 7698 }, // ⊗
-    { 28, 28, 38, 5, 27, 196, 7894 }, // ⊘
-    { 22, 27, 38, 8, 27, 149, 8090 }, // ⊥
-    { 8, 7, 24, 8, 14, 14, 8239 }, // ⋅
-    { 34, 7, 38, 2, 14, 60, 8253 }, // ⋯
-    { 36, 36, 38, 1, 32, 324, 0 }, // �
+    { 21, 15, 23, 1, 17, 79, 13863 }, // «
+    { 18, 10, 24, 3, 18, 45, 1294 }, // ¬
+    { 13, 5, 15, 1, 12, 17, 1339 }, // ­
+    { 20, 21, 22, 1, 30, 105, 1356 }, // ®
+    { 13, 5, 24, 5, 28, 17, 1461 }, // ¯
+    { 14, 14, 20, 3, 27, 49, 1478 }, // °
+    { 18, 24, 24, 3, 23, 108, 1527 }, // ±
+    { 15, 18, 17, 1, 32, 68, 1635 }, // ²
+    { 14, 19, 17, 1, 32, 67, 1703 }, // ³
+    { 8, 11, 24, 8, 33, 22, 1770 }, // ´
+    { 25, 30, 23, -2, 21, 188, 1792 }, // µ
+    { 25, 33, 23, -1, 27, 207, 1980 }, // ¶
+    { 7, 7, 12, 2, 14, 13, 2187 }, // ·
+    { 9, 10, 24, 7, -1, 23, 2200 }, // ¸
+    { 11, 18, 17, 2, 32, 50, 2223 }, // ¹
+    { 16, 19, 17, 1, 27, 76, 2273 }, // º
+    { 21, 15, 23, 1, 17, 79, 13942 }, // »
+    { 38, 31, 41, 2, 28, 295, 2349 }, // ¼
+    { 38, 31, 41, 2, 28, 295, 2644 }, // ½
+    { 39, 31, 41, 1, 28, 303, 2939 }, // ¾
+    { 13, 30, 15, 0, 21, 98, 3242 }, // ¿
+    { 30, 37, 28, -3, 37, 278, 14021 }, // À
+    { 30, 37, 28, -3, 37, 278, 14299 }, // Á
+    { 30, 37, 28, -3, 37, 278, 14577 }, // Â
+    { 30, 36, 28, -3, 36, 270, 3340 }, // Ã
+    { 30, 36, 28, -3, 36, 270, 14855 }, // Ä
+    { 30, 38, 28, -3, 38, 285, 3610 }, // Å
+    { 39, 27, 36, -3, 27, 264, 3895 }, // Æ
+    { 24, 39, 25, 1, 28, 234, 15125 }, // Ç
+    { 26, 37, 24, -2, 37, 241, 15359 }, // È
+    { 26, 37, 24, -2, 37, 241, 15600 }, // É
+    { 26, 37, 24, -2, 37, 241, 15841 }, // Ê
+    { 26, 36, 24, -2, 36, 234, 16082 }, // Ë
+    { 19, 37, 15, -2, 37, 176, 16316 }, // Ì
+    { 19, 37, 15, -2, 37, 176, 16492 }, // Í
+    { 20, 37, 15, -2, 37, 185, 16668 }, // Î
+    { 20, 36, 15, -2, 36, 180, 16853 }, // Ï
+    { 29, 29, 28, -2, 28, 211, 4159 }, // Ð
+    { 34, 37, 29, -2, 36, 315, 17033 }, // Ñ
+    { 26, 38, 28, 1, 37, 247, 17348 }, // Ò
+    { 26, 38, 28, 1, 37, 247, 17595 }, // Ó
+    { 26, 38, 28, 1, 37, 247, 17842 }, // Ô
+    { 26, 37, 28, 1, 36, 241, 4370 }, // Õ
+    { 26, 37, 28, 1, 36, 241, 18089 }, // Ö
+    { 17, 17, 24, 3, 21, 73, 4611 }, // ×
+    { 32, 30, 28, -2, 28, 240, 4684 }, // Ø
+    { 29, 38, 30, 3, 37, 276, 18330 }, // Ù
+    { 29, 38, 30, 3, 37, 276, 18606 }, // Ú
+    { 29, 38, 30, 3, 37, 276, 18882 }, // Û
+    { 29, 37, 30, 3, 36, 269, 19158 }, // Ü
+    { 26, 37, 25, 2, 37, 241, 4924 }, // Ý
+    { 25, 27, 23, -2, 27, 169, 5165 }, // Þ
+    { 31, 39, 24, -7, 30, 303, 5334 }, // ß
+    { 21, 33, 23, 1, 32, 174, 19427 }, // à
+    { 21, 34, 23, 1, 33, 179, 19601 }, // á
+    { 21, 33, 23, 1, 32, 174, 19780 }, // â
+    { 21, 31, 23, 1, 30, 163, 5637 }, // ã
+    { 21, 30, 23, 1, 29, 158, 19954 }, // ä
+    { 21, 33, 23, 1, 32, 174, 5800 }, // å
+    { 28, 22, 30, 1, 21, 154, 5974 }, // æ
+    { 16, 32, 17, 1, 21, 128, 20112 }, // ç
+    { 17, 33, 18, 1, 32, 141, 20240 }, // è
+    { 18, 34, 18, 1, 33, 153, 20381 }, // é
+    { 18, 33, 18, 1, 32, 149, 20534 }, // ê
+    { 18, 30, 18, 1, 29, 135, 20683 }, // ë
+    { 11, 33, 12, 1, 32, 91, 20818 }, // ì
+    { 15, 34, 12, 1, 33, 128, 20909 }, // í
+    { 14, 33, 12, 1, 32, 116, 21037 }, // î
+    { 15, 30, 12, 1, 29, 113, 21153 }, // ï
+    { 19, 32, 21, 1, 31, 152, 6128 }, // ð
+    { 22, 31, 24, 1, 30, 171, 21266 }, // ñ
+    { 19, 33, 21, 1, 32, 157, 21437 }, // ò
+    { 20, 34, 21, 1, 33, 170, 21594 }, // ó
+    { 19, 33, 21, 1, 32, 157, 21764 }, // ô
+    { 20, 31, 21, 1, 30, 155, 6280 }, // õ
+    { 20, 30, 21, 1, 29, 150, 21921 }, // ö
+    { 18, 18, 24, 3, 22, 81, 6435 }, // ÷
+    { 25, 23, 21, -2, 21, 144, 6516 }, // ø
+    { 23, 33, 23, 0, 32, 190, 22071 }, // ù
+    { 23, 34, 23, 0, 33, 196, 22261 }, // ú
+    { 23, 33, 23, 0, 32, 190, 22457 }, // û
+    { 23, 30, 23, 0, 29, 173, 22647 }, // ü
+    { 26, 42, 20, -6, 33, 273, 6660 }, // ý
+    { 24, 39, 21, -4, 30, 234, 6933 }, // þ
+    { 26, 38, 20, -6, 29, 247, 7167 }, // ÿ
+    { 30, 34, 28, -3, 34, 255, 7414 }, // Ā
+    { 21, 29, 23, 1, 28, 153, 7669 }, // ā
+    { 30, 37, 28, -3, 37, 278, 7822 }, // Ă
+    { 21, 31, 23, 1, 30, 163, 8100 }, // ă
+    { 30, 37, 28, -3, 28, 278, 8263 }, // Ą
+    { 21, 30, 23, 1, 21, 158, 8541 }, // ą
+    { 24, 38, 25, 1, 37, 228, 8699 }, // Ć
+    { 18, 34, 17, 1, 33, 153, 8927 }, // ć
+    { 24, 38, 25, 1, 37, 228, 9080 }, // Ĉ
+    { 18, 33, 17, 1, 32, 149, 9308 }, // ĉ
+    { 24, 37, 25, 1, 36, 222, 9457 }, // Ċ
+    { 16, 31, 17, 1, 30, 124, 9679 }, // ċ
+    { 25, 38, 25, 1, 37, 238, 9803 }, // Č
+    { 19, 33, 17, 1, 32, 157, 10041 }, // č
+    { 29, 38, 28, -2, 37, 276, 10198 }, // Ď
+    { 28, 31, 24, 1, 30, 217, 10474 }, // ď
+    { 29, 29, 28, -2, 28, 211, 10691 }, // Đ
+    { 24, 31, 23, 1, 30, 186, 10902 }, // đ
+    { 26, 34, 24, -2, 34, 221, 11088 }, // Ē
+    { 18, 29, 18, 1, 28, 131, 11309 }, // ē
+    { 26, 37, 24, -2, 37, 241, 11440 }, // Ĕ
+    { 18, 31, 18, 1, 30, 140, 11681 }, // ĕ
+    { 26, 36, 24, -2, 36, 234, 11821 }, // Ė
+    { 17, 31, 18, 1, 30, 132, 12055 }, // ė
+    { 26, 36, 24, -2, 27, 234, 12187 }, // Ę
+    { 17, 30, 18, 1, 21, 128, 12421 }, // ę
+    { 26, 37, 24, -2, 37, 241, 12549 }, // Ě
+    { 19, 33, 18, 1, 32, 157, 12790 }, // ě
+    { 26, 38, 28, 1, 37, 247, 12947 }, // Ĝ
+    { 26, 41, 20, -3, 32, 267, 13194 }, // ĝ
+    { 26, 38, 28, 1, 37, 247, 13461 }, // Ğ
+    { 26, 39, 20, -3, 30, 254, 13708 }, // ğ
+    { 26, 37, 28, 1, 36, 241, 13962 }, // Ġ
+    { 26, 39, 20, -3, 30, 254, 14203 }, // ġ
+    { 26, 38, 28, 1, 28, 247, 14457 }, // Ģ
+    { 26, 42, 20, -3, 33, 273, 14704 }, // ģ
+    { 34, 37, 30, -2, 37, 315, 14977 }, // Ĥ
+    { 22, 41, 23, 0, 40, 226, 15292 }, // ĥ
+    { 34, 27, 30, -2, 27, 230, 15518 }, // Ħ
+    { 22, 31, 23, 0, 30, 171, 15748 }, // ħ
+    { 20, 36, 15, -2, 36, 180, 15919 }, // Ĩ
+    { 15, 31, 12, 1, 30, 117, 16099 }, // ĩ
+    { 20, 34, 15, -2, 34, 170, 16216 }, // Ī
+    { 15, 29, 12, 1, 28, 109, 16386 }, // ī
+    { 20, 37, 15, -2, 37, 185, 16495 }, // Ĭ
+    { 15, 31, 12, 1, 30, 117, 16680 }, // ĭ
+    { 19, 36, 15, -2, 27, 171, 16797 }, // Į
+    { 12, 38, 12, 1, 29, 114, 16968 }, // į
+    { 19, 36, 15, -2, 36, 171, 17082 }, // İ
+    { 11, 22, 12, 1, 21, 61, 17253 }, // ı
+    { 34, 35, 30, -2, 27, 298, 17314 }, // Ĳ
+    { 25, 38, 24, 1, 29, 238, 17612 }, // ĳ
+    { 26, 45, 14, -7, 37, 293, 17850 }, // Ĵ
+    { 24, 41, 12, -8, 32, 246, 18143 }, // ĵ
+    { 31, 37, 27, -2, 27, 287, 18389 }, // Ķ
+    { 20, 40, 20, 0, 30, 200, 18676 }, // ķ
+    { 20, 22, 22, 1, 21, 110, 18876 }, // ĸ
+    { 23, 37, 22, -2, 37, 213, 18986 }, // Ĺ
+    { 14, 40, 12, 1, 39, 140, 19199 }, // ĺ
+    { 23, 37, 22, -2, 27, 213, 19339 }, // Ļ
+    { 13, 40, 12, -1, 30, 130, 19552 }, // ļ
+    { 25, 30, 22, -2, 30, 188, 19682 }, // Ľ
+    { 18, 31, 13, 1, 30, 140, 19870 }, // ľ
+    { 24, 27, 22, -2, 27, 162, 20010 }, // Ŀ
+    { 17, 31, 16, 1, 30, 132, 20172 }, // ŀ
+    { 23, 27, 22, -2, 27, 156, 20304 }, // Ł
+    { 15, 31, 12, -1, 30, 117, 20460 }, // ł
+    { 34, 38, 29, -2, 37, 323, 20577 }, // Ń
+    { 22, 34, 24, 1, 33, 187, 20900 }, // ń
+    { 34, 37, 29, -2, 27, 315, 21087 }, // Ņ
+    { 22, 31, 24, 1, 21, 171, 21402 }, // ņ
+    { 34, 38, 29, -2, 37, 323, 21573 }, // Ň
+    { 22, 33, 24, 1, 32, 182, 21896 }, // ň
+    { 29, 30, 32, 2, 29, 218, 22078 }, // ŉ
+    { 34, 35, 29, -2, 27, 298, 22296 }, // Ŋ
+    { 20, 30, 22, 1, 21, 150, 22594 }, // ŋ
+    { 26, 35, 28, 1, 34, 228, 22744 }, // Ō
+    { 20, 29, 21, 1, 28, 145, 22972 }, // ō
+    { 26, 38, 28, 1, 37, 247, 23117 }, // Ŏ
+    { 20, 31, 21, 1, 30, 155, 23364 }, // ŏ
+    { 28, 39, 28, 1, 38, 273, 23519 }, // Ő
+    { 22, 33, 21, 1, 32, 182, 23792 }, // ő
+    { 37, 28, 38, 1, 27, 259, 22820 }, // Œ
+    { 30, 22, 31, 1, 21, 165, 23079 }, // œ
+    { 27, 38, 26, -2, 37, 257, 23974 }, // Ŕ
+    { 18, 33, 18, 1, 33, 149, 24231 }, // ŕ
+    { 27, 38, 26, -2, 28, 257, 24380 }, // Ŗ
+    { 20, 31, 18, -1, 21, 155, 24637 }, // ŗ
+    { 27, 38, 26, -2, 37, 257, 24792 }, // Ř
+    { 19, 32, 18, 1, 32, 152, 25049 }, // ř
+    { 22, 38, 21, -1, 37, 209, 25201 }, // Ś
+    { 19, 34, 16, -1, 33, 162, 25410 }, // ś
+    { 22, 38, 21, -1, 37, 209, 25572 }, // Ŝ
+    { 19, 33, 16, -1, 32, 157, 25781 }, // ŝ
+    { 22, 39, 21, -1, 28, 215, 25938 }, // Ş
+    { 17, 32, 16, -1, 21, 136, 26153 }, // ş
+    { 23, 38, 21, -1, 37, 219, 26289 }, // Š
+    { 20, 33, 16, -1, 32, 165, 26508 }, // š
+    { 25, 38, 25, 2, 27, 238, 26673 }, // Ţ
+    { 16, 36, 16, 1, 25, 144, 26911 }, // ţ
+    { 25, 37, 25, 2, 37, 232, 27055 }, // Ť
+    { 18, 32, 16, 1, 31, 144, 27287 }, // ť
+    { 25, 27, 25, 2, 27, 169, 27431 }, // Ŧ
+    { 17, 26, 16, 0, 25, 111, 27600 }, // ŧ
+    { 29, 37, 30, 3, 36, 269, 27711 }, // Ũ
+    { 23, 31, 23, 0, 30, 179, 27980 }, // ũ
+    { 29, 35, 30, 3, 34, 254, 28159 }, // Ū
+    { 23, 29, 23, 0, 28, 167, 28413 }, // ū
+    { 29, 38, 30, 3, 37, 276, 28580 }, // Ŭ
+    { 23, 31, 23, 0, 30, 179, 28856 }, // ŭ
+    { 29, 39, 30, 3, 38, 283, 29035 }, // Ů
+    { 23, 33, 23, 0, 32, 190, 29318 }, // ů
+    { 29, 39, 30, 3, 38, 283, 29508 }, // Ű
+    { 23, 33, 23, 0, 32, 190, 29791 }, // ű
+    { 29, 36, 30, 3, 27, 261, 29981 }, // Ų
+    { 23, 30, 23, 0, 21, 173, 30242 }, // ų
+    { 39, 38, 38, 2, 37, 371, 30415 }, // Ŵ
+    { 29, 33, 29, 0, 32, 240, 30786 }, // ŵ
+    { 26, 37, 25, 2, 37, 241, 31026 }, // Ŷ
+    { 26, 41, 20, -6, 32, 267, 31267 }, // ŷ
+    { 26, 36, 25, 2, 36, 234, 31534 }, // Ÿ
+    { 24, 38, 24, -1, 37, 228, 31768 }, // Ź
+    { 20, 34, 18, -1, 33, 170, 31996 }, // ź
+    { 24, 37, 24, -1, 36, 222, 32166 }, // Ż
+    { 20, 31, 18, -1, 30, 155, 32388 }, // ż
+    { 24, 38, 24, -1, 37, 228, 32543 }, // Ž
+    { 20, 33, 18, -1, 32, 165, 32771 }, // ž
+    { 28, 39, 16, -7, 30, 273, 32936 }, // ſ
+    { 9, 10, 0, -6, 32, 23, 33209 }, // ̀
+    { 8, 11, 0, -3, 33, 22, 33232 }, // ́
+    { 14, 10, 0, -8, 32, 35, 33254 }, // ̂
+    { 14, 7, 0, -7, 30, 25, 33289 }, // ̃
+    { 13, 5, 0, -7, 28, 17, 33314 }, // ̄
+    { 12, 7, 0, -6, 30, 21, 33331 }, // ̆
+    { 6, 7, 0, -3, 30, 11, 33352 }, // ̇
+    { 14, 6, 0, -7, 29, 21, 33363 }, // ̈
+    { 11, 12, 0, -5, 34, 33, 33384 }, // ̉
+    { 10, 10, 0, -5, 32, 25, 33417 }, // ̊
+    { 16, 10, 0, -7, 32, 40, 33442 }, // ̋
+    { 14, 9, 0, -6, 32, 32, 33482 }, // ̌
+    { 12, 10, 0, -8, 32, 30, 33514 }, // ̏
+    { 13, 8, 0, -7, 30, 26, 33544 }, // ̑
+    { 8, 11, 0, -4, 33, 22, 33570 }, // ̒
+    { 9, 11, 0, -4, 34, 25, 33592 }, // ̓
+    { 8, 11, 0, -5, 34, 22, 33617 }, // ̔
+    { 6, 10, 0, -3, 33, 15, 33639 }, // ̕
+    { 8, 10, 0, -4, 25, 20, 33654 }, // ̛
+    { 6, 6, 0, -3, -3, 9, 33674 }, // ̣
+    { 14, 6, 0, -7, -3, 21, 33683 }, // ̤
+    { 10, 9, 0, -5, -1, 23, 33704 }, // ̥
+    { 7, 9, 0, -4, -1, 16, 33727 }, // ̦
+    { 9, 10, 0, -5, -1, 23, 33743 }, // ̧
+    { 8, 10, 0, -4, 1, 20, 33766 }, // ̨
+    { 7, 9, 10, -1, -2, 16, 33786 }, // ̩
+    { 15, 8, 0, -8, -2, 30, 33802 }, // ̭
+    { 12, 8, 0, -6, -2, 24, 33832 }, // ̮
+    { 14, 7, 0, -7, -3, 25, 33856 }, // ̰
+    { 14, 4, 0, -7, -4, 14, 33881 }, // ̱
+    { 12, 8, 0, -6, 30, 24, 33895 }, // ͂
+    { 15, 15, 0, -8, 39, 57, 33919 }, // ̈́
+    { 8, 8, 0, -3, -2, 16, 33976 }, // ͅ
+    { 26, 37, 24, -2, 37, 241, 33992 }, // Ѐ
+    { 26, 36, 24, -2, 36, 234, 0 }, // Ё
+    { 26, 35, 29, 2, 27, 228, 34233 }, // Ђ
+    { 26, 37, 22, -2, 37, 241, 34461 }, // Ѓ
+    { 24, 29, 25, 1, 28, 174, 34702 }, // Є
+    { 22, 29, 21, -1, 28, 160, 34876 }, // Ѕ
+    { 19, 27, 15, -2, 27, 129, 35036 }, // І
+    { 20, 36, 15, -2, 36, 180, 35165 }, // Ї
+    { 24, 35, 14, -7, 27, 210, 35345 }, // Ј
+    { 36, 28, 35, -2, 27, 252, 35555 }, // Љ
+    { 37, 28, 36, -2, 27, 259, 35807 }, // Њ
+    { 28, 27, 32, 2, 27, 189, 36066 }, // Ћ
+    { 31, 38, 27, -2, 37, 295, 36255 }, // Ќ
+    { 34, 37, 31, -2, 37, 315, 36550 }, // Ѝ
+    { 28, 39, 26, 1, 38, 273, 36865 }, // Ў
+    { 33, 36, 29, -2, 27, 297, 37138 }, // Џ
+    { 30, 28, 28, -3, 28, 210, 234 }, // А
+    { 25, 28, 24, -2, 27, 175, 444 }, // Б
+    { 25, 29, 24, -2, 28, 182, 619 }, // В
+    { 26, 27, 22, -2, 27, 176, 801 }, // Г
+    { 33, 35, 28, -3, 27, 289, 977 }, // Д
+    { 26, 27, 24, -2, 27, 176, 1266 }, // Е
+    { 43, 29, 37, -4, 28, 312, 1442 }, // Ж
+    { 21, 29, 22, -1, 28, 153, 1754 }, // З
+    { 34, 27, 31, -2, 27, 230, 1907 }, // И
+    { 34, 38, 31, -2, 38, 323, 2137 }, // Й
+    { 31, 29, 27, -2, 28, 225, 2460 }, // К
+    { 32, 28, 28, -2, 27, 224, 2685 }, // Л
+    { 37, 27, 34, -3, 27, 250, 2909 }, // М
+    { 34, 27, 30, -2, 27, 230, 3159 }, // Н
+    { 26, 29, 28, 1, 28, 189, 3389 }, // О
+    { 33, 27, 29, -2, 27, 223, 3578 }, // П
+    { 26, 28, 23, -2, 28, 182, 3801 }, // Р
+    { 24, 29, 25, 1, 28, 174, 3983 }, // С
+    { 25, 27, 25, 2, 27, 169, 4157 }, // Т
+    { 28, 28, 26, 1, 27, 196, 4326 }, // У
+    { 28, 29, 29, 0, 28, 203, 4522 }, // Ф
+    { 32, 27, 25, -4, 27, 216, 4725 }, // Х
+    { 33, 35, 29, -2, 27, 289, 4941 }, // Ц
+    { 27, 27, 27, 2, 27, 183, 5230 }, // Ч
+    { 42, 27, 38, -2, 27, 284, 5413 }, // Ш
+    { 42, 35, 39, -2, 27, 368, 5697 }, // Щ
+    { 25, 28, 28, 2, 27, 175, 6065 }, // Ъ
+    { 40, 28, 36, -2, 27, 280, 6240 }, // Ы
+    { 24, 28, 23, -2, 27, 168, 6520 }, // Ь
+    { 24, 29, 24, -1, 28, 174, 6688 }, // Э
+    { 41, 29, 39, -2, 28, 298, 6862 }, // Ю
+    { 29, 28, 25, -2, 27, 203, 7160 }, // Я
+    { 21, 22, 23, 1, 21, 116, 7363 }, // а
+    { 22, 32, 21, 1, 31, 176, 7479 }, // б
+    { 18, 22, 20, 1, 21, 99, 7655 }, // в
+    { 17, 22, 17, 0, 21, 94, 7754 }, // г
+    { 19, 31, 21, 1, 30, 148, 7848 }, // д
+    { 17, 22, 18, 1, 21, 94, 7996 }, // е
+    { 34, 22, 34, 0, 21, 187, 8090 }, // ж
+    { 18, 22, 18, -1, 21, 99, 8277 }, // з
+    { 23, 22, 23, 0, 21, 127, 8376 }, // и
+    { 23, 32, 23, 0, 31, 184, 8503 }, // й
+    { 20, 22, 22, 1, 21, 110, 8687 }, // к
+    { 24, 22, 24, -1, 21, 132, 8797 }, // л
+    { 31, 22, 30, -1, 21, 171, 8929 }, // м
+    { 22, 22, 24, 1, 21, 121, 9100 }, // н
+    { 19, 22, 21, 1, 21, 105, 9221 }, // о
+    { 22, 22, 24, 1, 21, 121, 9326 }, // п
+    { 24, 30, 22, -3, 21, 180, 9447 }, // р
+    { 16, 22, 17, 1, 21, 88, 9627 }, // с
+    { 32, 22, 33, 1, 21, 176, 9715 }, // т
+    { 26, 30, 20, -6, 21, 195, 9891 }, // у
+    { 26, 39, 27, 1, 30, 254, 10086 }, // ф
+    { 23, 22, 22, -1, 21, 127, 10340 }, // х
+    { 23, 29, 24, 0, 21, 167, 10467 }, // ц
+    { 21, 22, 23, 1, 21, 116, 10634 }, // ч
+    { 32, 22, 32, 0, 21, 176, 10750 }, // ш
+    { 32, 29, 32, 0, 21, 232, 10926 }, // щ
+    { 19, 22, 21, 1, 21, 105, 11158 }, // ъ
+    { 29, 22, 30, 0, 21, 160, 11263 }, // ы
+    { 19, 22, 19, 0, 21, 105, 11423 }, // ь
+    { 19, 22, 18, -1, 21, 105, 11528 }, // э
+    { 29, 22, 30, 1, 21, 160, 11633 }, // ю
+    { 22, 22, 23, 0, 21, 121, 11793 }, // я
+    { 17, 33, 18, 1, 32, 141, 37435 }, // ѐ
+    { 18, 30, 18, 1, 29, 135, 11914 }, // ё
+    { 20, 39, 22, 0, 30, 195, 37576 }, // ђ
+    { 18, 34, 17, 0, 33, 153, 37771 }, // ѓ
+    { 17, 22, 18, 1, 21, 94, 37924 }, // є
+    { 17, 22, 16, -1, 21, 94, 38018 }, // ѕ
+    { 12, 30, 12, 1, 29, 90, 38112 }, // і
+    { 15, 30, 12, 1, 29, 113, 38202 }, // ї
+    { 22, 38, 12, -8, 29, 209, 38315 }, // ј
+    { 30, 22, 30, -1, 21, 165, 38524 }, // љ
+    { 28, 22, 29, 1, 21, 154, 38689 }, // њ
+    { 22, 31, 23, 0, 30, 171, 38843 }, // ћ
+    { 20, 34, 22, 1, 33, 170, 39014 }, // ќ
+    { 23, 33, 23, 0, 32, 190, 39184 }, // ѝ
+    { 26, 40, 20, -6, 31, 260, 39374 }, // ў
+    { 23, 29, 23, 0, 21, 167, 39634 }, // џ
+    { 24, 31, 27, 2, 30, 186, 39801 }, // Ѣ
+    { 28, 22, 30, 1, 21, 154, 39987 }, // ѣ
+    { 26, 29, 28, 1, 28, 189, 40141 }, // Ѳ
+    { 19, 22, 21, 1, 21, 105, 40330 }, // ѳ
+    { 29, 29, 29, 2, 28, 211, 40435 }, // Ѵ
+    { 24, 22, 22, -1, 21, 132, 40646 }, // ѵ
+    { 34, 46, 31, -2, 38, 391, 40778 }, // Ҋ
+    { 23, 39, 23, 0, 31, 225, 41169 }, // ҋ
+    { 24, 28, 23, -2, 27, 168, 41394 }, // Ҍ
+    { 18, 29, 19, 1, 28, 131, 41562 }, // ҍ
+    { 26, 28, 23, -2, 28, 182, 41693 }, // Ҏ
+    { 24, 30, 22, -3, 21, 180, 41875 }, // ҏ
+    { 26, 32, 22, -2, 32, 208, 42055 }, // Ґ
+    { 20, 26, 18, 0, 25, 130, 42263 }, // ґ
+    { 26, 27, 22, -2, 27, 176, 42393 }, // Ғ
+    { 17, 22, 17, 0, 21, 94, 42569 }, // ғ
+    { 25, 35, 25, -2, 27, 219, 42663 }, // Ҕ
+    { 18, 29, 21, 1, 20, 131, 42882 }, // ҕ
+    { 43, 36, 37, -4, 28, 387, 0 }, // Җ
+    { 34, 29, 34, 0, 21, 247, 387 }, // җ
+    { 21, 36, 22, -1, 28, 189, 634 }, // Ҙ
+    { 18, 29, 18, -1, 21, 131, 823 }, // ҙ
+    { 30, 36, 27, -2, 28, 270, 954 }, // Қ
+    { 20, 29, 22, 1, 21, 145, 1224 }, // қ
+    { 32, 29, 28, -2, 28, 232, 1369 }, // Ҝ
+    { 23, 22, 24, 1, 21, 127, 1601 }, // ҝ
+    { 31, 29, 27, -2, 28, 225, 1728 }, // Ҟ
+    { 21, 29, 21, 0, 28, 153, 1953 }, // ҟ
+    { 31, 29, 31, 2, 28, 225, 2106 }, // Ҡ
+    { 24, 22, 25, 1, 21, 132, 2331 }, // ҡ
+    { 34, 35, 31, -2, 27, 298, 2463 }, // Ң
+    { 23, 29, 24, 1, 21, 167, 2761 }, // ң
+    { 39, 27, 35, -2, 27, 264, 2928 }, // Ҥ
+    { 28, 22, 29, 1, 21, 154, 3192 }, // ҥ
+    { 39, 35, 39, -2, 27, 342, 3346 }, // Ҧ
+    { 30, 30, 32, 1, 21, 225, 3688 }, // ҧ
+    { 30, 29, 32, 1, 28, 218, 3913 }, // Ҩ
+    { 23, 22, 25, 1, 21, 127, 4131 }, // ҩ
+    { 24, 36, 25, 1, 28, 216, 4258 }, // Ҫ
+    { 16, 29, 17, 1, 21, 116, 4474 }, // ҫ
+    { 25, 35, 25, 2, 27, 219, 4590 }, // Ҭ
+    { 32, 29, 34, 1, 21, 232, 4809 }, // ҭ
+    { 26, 27, 25, 2, 27, 176, 5041 }, // Ү
+    { 20, 30, 20, 0, 21, 150, 5217 }, // ү
+    { 26, 27, 25, 2, 27, 176, 5367 }, // Ұ
+    { 20, 30, 20, 0, 21, 150, 5543 }, // ұ
+    { 32, 35, 25, -4, 27, 280, 5693 }, // Ҳ
+    { 23, 29, 22, -1, 21, 167, 5973 }, // ҳ
+    { 35, 35, 35, 2, 27, 307, 6140 }, // Ҵ
+    { 23, 36, 24, 0, 28, 207, 6447 }, // ҵ
+    { 27, 35, 27, 2, 27, 237, 6654 }, // Ҷ
+    { 22, 29, 23, 1, 21, 160, 6891 }, // ҷ
+    { 27, 27, 28, 2, 27, 183, 7051 }, // Ҹ
+    { 22, 22, 23, 1, 21, 121, 7234 }, // ҹ
+    { 27, 27, 27, -2, 27, 183, 7355 }, // Һ
+    { 22, 31, 23, 0, 30, 171, 7538 }, // һ
+    { 30, 29, 31, 1, 28, 218, 7709 }, // Ҽ
+    { 22, 22, 23, 0, 21, 121, 7927 }, // ҽ
+    { 30, 37, 31, 1, 28, 278, 8048 }, // Ҿ
+    { 22, 29, 23, 0, 21, 160, 8326 }, // ҿ
+    { 19, 27, 15, -2, 27, 129, 8486 }, // Ӏ
+    { 43, 39, 37, -4, 38, 420, 8615 }, // Ӂ
+    { 34, 32, 34, 0, 31, 272, 9035 }, // ӂ
+    { 31, 36, 27, -2, 28, 279, 9307 }, // Ӄ
+    { 21, 30, 22, 1, 21, 158, 9586 }, // ӄ
+    { 32, 35, 28, -2, 27, 280, 9744 }, // Ӆ
+    { 25, 29, 24, -1, 21, 182, 10024 }, // ӆ
+    { 34, 35, 30, -2, 27, 298, 10206 }, // Ӈ
+    { 21, 30, 22, 1, 21, 158, 10504 }, // ӈ
+    { 34, 35, 31, -2, 27, 298, 10662 }, // Ӊ
+    { 23, 29, 24, 1, 21, 167, 10960 }, // ӊ
+    { 27, 35, 27, 2, 27, 237, 11127 }, // Ӌ
+    { 21, 29, 22, 1, 21, 153, 11364 }, // ӌ
+    { 37, 35, 35, -3, 27, 324, 11517 }, // Ӎ
+    { 31, 29, 30, -1, 21, 225, 11841 }, // ӎ
+    { 19, 30, 15, -2, 30, 143, 12066 }, // ӏ
+    { 30, 38, 28, -3, 38, 285, 12209 }, // Ӑ
+    { 21, 32, 23, 1, 31, 168, 12494 }, // ӑ
+    { 30, 36, 28, -3, 36, 270, 12662 }, // Ӓ
+    { 21, 30, 23, 1, 29, 158, 12932 }, // ӓ
+    { 39, 27, 36, -3, 27, 264, 13090 }, // Ӕ
+    { 28, 22, 30, 1, 21, 154, 13354 }, // ӕ
+    { 26, 38, 24, -2, 38, 247, 13508 }, // Ӗ
+    { 18, 32, 18, 1, 31, 144, 13755 }, // ӗ
+    { 25, 29, 25, 0, 28, 182, 13899 }, // Ә
+    { 18, 22, 19, 0, 21, 99, 14081 }, // ә
+    { 25, 37, 25, 0, 36, 232, 14180 }, // Ӛ
+    { 18, 30, 19, 0, 29, 135, 14412 }, // ӛ
+    { 43, 37, 37, -4, 36, 398, 14547 }, // Ӝ
+    { 34, 30, 34, 0, 29, 255, 14945 }, // ӝ
+    { 21, 37, 22, -1, 36, 195, 15200 }, // Ӟ
+    { 19, 30, 18, -1, 29, 143, 15395 }, // ӟ
+    { 24, 28, 22, -1, 27, 168, 15538 }, // Ӡ
+    { 23, 29, 20, -3, 20, 167, 15706 }, // ӡ
+    { 34, 34, 31, -2, 34, 289, 15873 }, // Ӣ
+    { 23, 29, 23, 0, 28, 167, 16162 }, // ӣ
+    { 34, 36, 31, -2, 36, 306, 16329 }, // Ӥ
+    { 23, 30, 23, 0, 29, 173, 16635 }, // ӥ
+    { 26, 37, 28, 1, 36, 241, 16808 }, // Ӧ
+    { 20, 30, 21, 1, 29, 150, 17049 }, // ӧ
+    { 26, 29, 28, 1, 28, 189, 17199 }, // Ө
+    { 19, 22, 21, 1, 21, 105, 17388 }, // ө
+    { 26, 37, 28, 1, 36, 241, 17493 }, // Ӫ
+    { 20, 30, 21, 1, 29, 150, 17734 }, // ӫ
+    { 24, 37, 24, -1, 36, 222, 17884 }, // Ӭ
+    { 19, 30, 18, -1, 29, 143, 18106 }, // ӭ
+    { 28, 35, 26, 1, 34, 245, 18249 }, // Ӯ
+    { 26, 37, 20, -6, 28, 241, 18494 }, // ӯ
+    { 28, 37, 26, 1, 36, 259, 18735 }, // Ӱ
+    { 26, 38, 20, -6, 29, 247, 18994 }, // ӱ
+    { 28, 39, 26, 1, 38, 273, 19241 }, // Ӳ
+    { 26, 41, 20, -6, 32, 267, 19514 }, // ӳ
+    { 27, 36, 27, 2, 36, 243, 19781 }, // Ӵ
+    { 21, 30, 23, 1, 29, 158, 20024 }, // ӵ
+    { 26, 35, 22, -2, 27, 228, 20182 }, // Ӷ
+    { 17, 29, 17, 0, 21, 124, 20410 }, // ӷ
+    { 40, 37, 36, -2, 36, 370, 20534 }, // Ӹ
+    { 29, 30, 30, 0, 29, 218, 20904 }, // ӹ
+    { 26, 35, 22, -2, 27, 228, 21122 }, // Ӻ
+    { 17, 29, 17, 0, 21, 124, 21350 }, // ӻ
+    { 32, 35, 25, -4, 27, 280, 21474 }, // Ӽ
+    { 23, 30, 22, -1, 21, 173, 21754 }, // ӽ
+    { 32, 27, 25, -4, 27, 216, 21927 }, // Ӿ
+    { 23, 22, 22, -1, 21, 127, 22143 }, // ӿ
+    { 0, 0, 19, 0, 0, 0, 22270 }, //  
+    { 0, 0, 38, 0, 0, 0, 22270 }, //  
+    { 0, 0, 19, 0, 0, 0, 22270 }, //  
+    { 0, 0, 38, 0, 0, 0, 22270 }, //  
+    { 0, 0, 13, 0, 0, 0, 22270 }, //  
+    { 0, 0, 10, 0, 0, 0, 22270 }, //  
+    { 0, 0, 6, 0, 0, 0, 22270 }, //  
+    { 0, 0, 24, 0, 0, 0, 22270 }, //  
+    { 0, 0, 12, 0, 0, 0, 22270 }, //  
+    { 0, 0, 8, 0, 0, 0, 22270 }, //  
+    { 0, 0, 2, 0, 0, 0, 22270 }, //  
+    { 0, 0, 0, 0, 0, 0, 22270 }, // ​
+    { 2, 31, 0, -1, 22, 16, 22270 }, // ‌
+    { 8, 34, 0, -4, 25, 68, 22286 }, // ‍
+    { 14, 36, 0, -7, 27, 126, 22354 }, // ‎
+    { 14, 36, 0, -7, 27, 126, 22480 }, // ‏
+    { 13, 5, 15, 1, 12, 17, 22606 }, // ‐
+    { 13, 5, 15, 1, 12, 17, 22623 }, // ‑
+    { 19, 5, 24, 2, 15, 24, 22640 }, // ‒
+    { 19, 5, 19, 0, 12, 24, 23244 }, // –
+    { 38, 5, 38, 0, 12, 48, 23268 }, // —
+    { 38, 5, 38, 0, 12, 48, 22664 }, // ―
+    { 13, 39, 19, 3, 30, 127, 22712 }, // ‖
+    { 19, 11, 19, 0, -1, 53, 22839 }, // ‗
+    { 9, 13, 11, 3, 29, 30, 23316 }, // ‘
+    { 9, 13, 11, 2, 29, 30, 23346 }, // ’
+    { 9, 12, 11, 0, 5, 27, 22892 }, // ‚
+    { 8, 14, 11, 2, 29, 28, 22919 }, // ‛
+    { 17, 13, 19, 3, 29, 56, 23376 }, // “
+    { 17, 12, 19, 2, 28, 51, 23432 }, // ”
+    { 16, 12, 19, 0, 5, 48, 22947 }, // „
+    { 16, 14, 19, 2, 29, 56, 22995 }, // ‟
+    { 17, 25, 18, 1, 27, 107, 23051 }, // †
+    { 19, 29, 18, -1, 27, 138, 23158 }, // ‡
+    { 9, 9, 11, 1, 15, 21, 23296 }, // •
+    { 14, 14, 24, 5, 20, 49, 23317 }, // ‣
+    { 7, 7, 11, 2, 6, 13, 23366 }, // ․
+    { 17, 7, 19, 1, 6, 30, 23379 }, // ‥
+    { 32, 7, 38, 3, 6, 56, 23483 }, // …
+    { 7, 7, 11, 2, 14, 13, 23409 }, // ‧
+    { 0, 0, 0, 0, 0, 0, 23422 }, //  
+    { 0, 0, 0, 0, 0, 0, 23422 }, //  
+    { 14, 36, 0, -7, 27, 126, 23422 }, // ‪
+    { 14, 36, 0, -7, 27, 126, 23548 }, // ‫
+    { 12, 35, 0, -6, 26, 105, 23674 }, // ‬
+    { 16, 36, 0, -8, 27, 144, 23779 }, // ‭
+    { 16, 36, 0, -8, 27, 144, 23923 }, // ‮
+    { 0, 0, 4, 0, 0, 0, 24067 }, //  
+    { 51, 31, 54, 1, 28, 396, 24067 }, // ‰
+    { 8, 13, 10, 1, 27, 26, 24463 }, // ′
+    { 16, 13, 17, 1, 27, 52, 24489 }, // ″
+    { 25, 13, 26, 1, 27, 82, 24541 }, // ‴
+    { 9, 13, 10, 0, 27, 30, 24623 }, // ‵
+    { 17, 13, 18, 0, 27, 56, 24653 }, // ‶
+    { 26, 13, 26, 0, 27, 85, 24709 }, // ‷
+    { 17, 8, 19, 1, 0, 34, 24794 }, // ‸
+    { 12, 15, 13, 1, 17, 45, 24828 }, // ‹
+    { 12, 15, 13, 1, 17, 45, 24873 }, // ›
+    { 24, 26, 24, 0, 25, 156, 24918 }, // ※
+    { 23, 30, 23, 1, 29, 173, 25074 }, // ‼
+    { 19, 4, 19, 0, 32, 19, 25247 }, // ‾
+    { 9, 5, 11, 1, 12, 12, 25266 }, // ⁃
+    { 25, 31, 11, -7, 28, 194, 25278 }, // ⁄
+    { 27, 29, 30, 3, 28, 196, 25472 }, // ⁇
+    { 24, 30, 26, 3, 29, 180, 25668 }, // ⁈
+    { 26, 30, 27, 1, 29, 195, 25848 }, // ⁉
+    { 23, 8, 38, 7, 15, 46, 26043 }, // ⁓
+    { 33, 13, 35, 1, 27, 108, 26089 }, // ⁗
+    { 0, 0, 8, 0, 0, 0, 26197 }, //  
+    { 0, 0, 0, 0, 0, 0, 26197 }, // ⁠
+    { 0, 0, 0, 0, 0, 0, 26197 }, // ⁡
+    { 0, 0, 0, 0, 0, 0, 26197 }, // ⁢
+    { 0, 0, 0, 0, 0, 0, 26197 }, // ⁣
+    { 0, 0, 0, 0, 0, 0, 26197 }, // ⁤
+    { 15, 19, 17, 1, 32, 72, 26197 }, // ⁰
+    { 16, 19, 17, 0, 32, 76, 26269 }, // ⁴
+    { 15, 18, 17, 1, 31, 68, 26345 }, // ⁵
+    { 16, 19, 17, 1, 32, 76, 26413 }, // ⁶
+    { 14, 18, 17, 3, 31, 63, 26489 }, // ⁷
+    { 15, 19, 17, 1, 32, 72, 26552 }, // ⁸
+    { 16, 19, 17, 0, 32, 76, 26624 }, // ⁹
+    { 15, 14, 22, 4, 27, 53, 26700 }, // ⁿ
+    { 15, 19, 17, 1, 13, 72, 26753 }, // ₀
+    { 11, 18, 17, 2, 13, 50, 26825 }, // ₁
+    { 15, 18, 17, 1, 13, 68, 26875 }, // ₂
+    { 14, 19, 17, 1, 13, 67, 26943 }, // ₃
+    { 16, 19, 17, 0, 13, 76, 27010 }, // ₄
+    { 15, 18, 17, 1, 12, 68, 27086 }, // ₅
+    { 16, 19, 17, 1, 13, 76, 27154 }, // ₆
+    { 14, 18, 17, 3, 12, 63, 27230 }, // ₇
+    { 15, 19, 17, 1, 13, 72, 27293 }, // ₈
+    { 16, 19, 17, 0, 13, 76, 27365 }, // ₉
+    { 25, 26, 24, -1, 26, 163, 27441 }, // ₣
+    { 25, 28, 24, -1, 27, 175, 27604 }, // ₤
+    { 49, 28, 50, 0, 27, 343, 27779 }, // ₧
+    { 26, 28, 24, -1, 27, 182, 28122 }, // €
+    { 24, 18, 38, 7, 22, 108, 28304 }, // ←
+    { 18, 25, 38, 10, 26, 113, 28412 }, // ↑
+    { 24, 18, 38, 7, 22, 108, 28525 }, // →
+    { 18, 25, 38, 10, 26, 113, 28633 }, // ↓
+    { 24, 17, 38, 7, 22, 102, 28746 }, // ↔
+    { 16, 26, 38, 11, 26, 104, 28848 }, // ↕
+    { 18, 27, 38, 10, 27, 122, 28952 }, // ↨
+    { 18, 26, 38, 10, 26, 117, 29074 }, // ↲
+    { 18, 26, 38, 10, 26, 117, 29191 }, // ↳
+    { 22, 20, 38, 8, 23, 110, 29308 }, // ↵
+    { 24, 22, 38, 7, 24, 132, 29418 }, // ⇐
+    { 22, 24, 38, 8, 25, 132, 29550 }, // ⇑
+    { 24, 22, 38, 7, 24, 132, 29682 }, // ⇒
+    { 22, 24, 38, 8, 25, 132, 29814 }, // ⇓
+    { 24, 20, 38, 7, 23, 120, 29946 }, // ⇔
+    { 26, 28, 38, 6, 27, 182, 30066 }, // ∀
+    { 20, 31, 24, 2, 30, 155, 30248 }, // ∂
+    { 20, 27, 38, 9, 27, 135, 30403 }, // ∃
+    { 30, 30, 38, 4, 28, 225, 30538 }, // ∅
+    { 25, 28, 26, 0, 28, 175, 30763 }, // ∆
+    { 26, 28, 38, 6, 27, 182, 30938 }, // ∇
+    { 26, 27, 38, 6, 27, 176, 31120 }, // ∈
+    { 26, 34, 38, 6, 30, 221, 31296 }, // ∉
+    { 26, 23, 38, 6, 25, 150, 31517 }, // ∊
+    { 26, 27, 38, 6, 27, 176, 31667 }, // ∋
+    { 26, 34, 38, 6, 30, 221, 31843 }, // ∌
+    { 26, 23, 38, 6, 25, 150, 32064 }, // ∍
+    { 30, 33, 32, 1, 27, 248, 32214 }, // ∏
+    { 24, 34, 25, 1, 27, 204, 32462 }, // ∑
+    { 18, 4, 24, 3, 15, 18, 32666 }, // −
+    { 23, 30, 20, -2, 28, 173, 32684 }, // ∕
+    { 18, 30, 20, 1, 28, 135, 32857 }, // ∖
+    { 18, 18, 24, 3, 22, 81, 32992 }, // ∗
+    { 14, 14, 24, 5, 20, 49, 33073 }, // ∘
+    { 8, 7, 24, 8, 14, 14, 33122 }, // ∙
+    { 25, 36, 24, -1, 31, 225, 33136 }, // √
+    { 19, 16, 24, 2, 20, 76, 33361 }, // ∝
+    { 24, 14, 24, 0, 19, 84, 33437 }, // ∞
+    { 24, 27, 38, 7, 27, 162, 33521 }, // ∟
+    { 28, 27, 38, 5, 27, 189, 33683 }, // ∠
+    { 5, 39, 19, 7, 30, 49, 33872 }, // ∣
+    { 13, 39, 19, 3, 30, 127, 33921 }, // ∥
+    { 26, 27, 38, 6, 27, 176, 34048 }, // ∧
+    { 26, 27, 38, 6, 27, 176, 34224 }, // ∨
+    { 22, 28, 38, 8, 28, 154, 34400 }, // ∩
+    { 22, 28, 38, 8, 27, 154, 34554 }, // ∪
+    { 22, 39, 24, 1, 30, 215, 34708 }, // ∫
+    { 26, 22, 38, 6, 21, 143, 34923 }, // ∴
+    { 26, 22, 38, 6, 21, 143, 35066 }, // ∵
+    { 10, 21, 12, 1, 23, 53, 35209 }, // ∶
+    { 26, 22, 38, 6, 21, 143, 35262 }, // ∷
+    { 23, 8, 38, 7, 15, 46, 35405 }, // ∼
+    { 23, 22, 38, 7, 24, 127, 35451 }, // ≅
+    { 19, 16, 24, 2, 21, 76, 35578 }, // ≈
+    { 22, 15, 38, 8, 18, 83, 35654 }, // ≍
+    { 18, 19, 24, 3, 22, 86, 35737 }, // ≠
+    { 22, 19, 38, 8, 21, 105, 35823 }, // ≡
+    { 18, 23, 24, 3, 23, 104, 35928 }, // ≤
+    { 18, 24, 24, 3, 24, 108, 36032 }, // ≥
+    { 32, 18, 38, 3, 22, 144, 36140 }, // ≪
+    { 32, 18, 38, 3, 22, 144, 36284 }, // ≫
+    { 26, 23, 38, 6, 25, 150, 36428 }, // ⊃
+    { 26, 34, 38, 6, 30, 221, 36578 }, // ⊄
+    { 26, 34, 38, 6, 30, 221, 36799 }, // ⊅
+    { 26, 27, 38, 6, 27, 176, 37020 }, // ⊆
+    { 26, 27, 38, 6, 27, 176, 37196 }, // ⊇
+    { 28, 28, 38, 5, 27, 196, 37372 }, // ⊕
+    { 28, 28, 38, 5, 27, 196, 37568 }, // ⊖
+    { 28, 28, 38, 5, 27, 196, 37764 }, // ⊗
+    { 28, 28, 38, 5, 27, 196, 37960 }, // ⊘
+    { 22, 27, 38, 8, 27, 149, 38156 }, // ⊥
+    { 8, 7, 24, 8, 14, 14, 38305 }, // ⋅
+    { 34, 7, 38, 2, 14, 60, 38319 }, // ⋯
+    { 40, 39, 28, -7, 30, 390, 38379 }, // ﬀ
+    { 32, 39, 24, -7, 30, 312, 38769 }, // ﬁ
+    { 33, 39, 26, -7, 30, 322, 39081 }, // ﬂ
+    { 44, 39, 36, -7, 30, 429, 39403 }, // ﬃ
+    { 45, 39, 38, -7, 30, 439, 39832 }, // ﬄ
+    { 36, 39, 29, -7, 30, 351, 40271 }, // ﬅ
+    { 33, 28, 31, -1, 27, 231, 40622 }, // ﬆ
+    { 36, 36, 38, 1, 32, 324, 40853 }, // �
 };
 
 static const EpdUnicodeInterval bookerly_18_bolditalicIntervals[] = {
@@ -3526,32 +3679,340 @@ static const EpdUnicodeInterval bookerly_18_bolditalicIntervals[] = {
     { 0x22A5, 0x22A5, 0x2E7 },
     { 0x22C5, 0x22C5, 0x2E8 },
     { 0x22EF, 0x22EF, 0x2E9 },
-    { 0xFFFD, 0xFFFD, 0x2EA },
+    { 0xFB00, 0xFB06, 0x2EA },
+    { 0xFFFD, 0xFFFD, 0x2F1 },
 };
 
 static const EpdFontGroup bookerly_18_bolditalicGroups[] = {
-    { 0, 6342, 13863, 100, 0 },
-    { 6342, 6086, 16371, 96, 100 },
-    { 12428, 9107, 26219, 128, 196 },
-    { 21535, 556, 783, 33, 324 },
-    { 22091, 14038, 43340, 220, 357 },
-    { 36129, 1896, 4222, 74, 577 },
-    { 38025, 668, 1244, 18, 651 },
-    { 38693, 465, 863, 4, 669 },
-    { 39158, 801, 1762, 15, 673 },
-    { 39959, 3063, 8313, 58, 688 },
-    { 43022, 179, 324, 1, 746 },
+    { 0, 8880, 23539, 151, 5 },
+    { 8880, 5486, 12049, 66, 358 },
+    { 14366, 15484, 43013, 261, 0 },
+    { 29850, 15697, 41177, 276, 471 },
+};
+
+static const uint8_t bookerly_18_bolditalicGlyphGroups[754] = {
+    2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0,
+    2, 2, 2, 2, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0,
+    0, 2, 2, 2, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0,
+    0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 3, 3, 3, 0, 0, 3, 3, 0, 0, 3,
+    3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+};
+
+static const uint8_t bookerly_18_bolditalicKernLeftClasses[754] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 55, 0, 129,
+    0, 2, 116, 2, 29, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 133,
+    133, 0, 0, 0, 0, 0, 5, 102, 101, 9, 74, 66, 59, 14, 14, 38,
+    56, 46, 123, 17, 9, 65, 54, 25, 64, 15, 4, 27, 50, 84, 12, 76,
+    82, 36, 0, 0, 0, 0, 34, 26, 91, 135, 73, 32, 20, 30, 99, 103,
+    121, 122, 30, 30, 26, 26, 105, 42, 85, 98, 34, 53, 53, 134, 53, 86,
+    63, 0, 0, 0, 0, 88, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 116, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 78,
+    0, 0, 0, 61, 5, 5, 5, 5, 5, 5, 74, 101, 74, 74, 74, 74,
+    14, 14, 14, 14, 9, 17, 9, 9, 9, 9, 9, 0, 9, 4, 4, 4,
+    4, 12, 77, 143, 34, 34, 34, 34, 34, 34, 73, 131, 73, 73, 73, 73,
+    99, 117, 28, 28, 26, 30, 26, 26, 26, 26, 26, 0, 97, 34, 34, 34,
+    34, 53, 26, 53, 5, 34, 5, 34, 48, 68, 101, 91, 101, 91, 101, 91,
+    101, 91, 9, 24, 9, 135, 74, 73, 74, 73, 74, 73, 108, 130, 74, 73,
+    59, 20, 59, 20, 59, 20, 59, 20, 14, 30, 90, 30, 14, 28, 14, 28,
+    14, 28, 71, 112, 14, 34, 38, 103, 38, 106, 56, 121, 140, 46, 122, 46,
+    139, 0, 24, 0, 0, 46, 118, 17, 30, 17, 30, 17, 30, 30, 17, 103,
+    9, 26, 9, 26, 9, 26, 74, 73, 25, 42, 25, 42, 25, 42, 64, 85,
+    64, 85, 64, 124, 64, 85, 15, 132, 15, 0, 15, 98, 4, 34, 4, 34,
+    4, 34, 4, 34, 4, 34, 4, 68, 27, 53, 12, 53, 12, 76, 86, 76,
+    86, 76, 86, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 100, 100, 72, 0, 144, 125, 1, 1, 51, 22, 22,
+    57, 7, 1, 3, 1, 13, 141, 37, 16, 23, 100, 7, 37, 1, 1, 7,
+    1, 93, 1, 10, 1, 31, 114, 52, 3, 67, 40, 23, 1, 1, 23, 22,
+    1, 22, 10, 10, 1, 19, 113, 94, 69, 89, 69, 120, 94, 19, 19, 79,
+    19, 19, 19, 21, 58, 21, 110, 58, 43, 89, 92, 11, 19, 19, 11, 104,
+    19, 33, 21, 21, 19, 69, 69, 109, 69, 110, 127, 142, 107, 115, 33, 33,
+    58, 79, 19, 43, 19, 111, 33, 10, 21, 44, 95, 23, 11, 22, 33, 31,
+    21, 41, 87, 39, 69, 0, 0, 80, 60, 37, 94, 70, 60, 7, 79, 7,
+    79, 7, 79, 23, 11, 0, 0, 0, 0, 81, 138, 114, 110, 16, 11, 18,
+    75, 18, 75, 45, 83, 23, 11, 23, 11, 1, 19, 62, 58, 136, 69, 136,
+    69, 1, 7, 120, 47, 126, 23, 11, 51, 115, 23, 11, 1, 0, 23, 11,
+    128, 13, 19, 13, 19, 100, 69, 100, 69, 10, 21, 10, 21, 7, 120, 37,
+    94, 137, 119, 1, 19, 1, 19, 10, 21, 10, 21, 10, 21, 10, 21, 3,
+    43, 3, 43, 3, 43, 1, 19, 16, 69, 1, 19, 39, 69, 49, 96, 40,
+    92, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 116, 116, 0, 116, 116, 116, 0, 0, 8, 6, 35, 8, 8, 6, 2,
+    0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 78, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32, 99, 122, 99, 122, 98,
+    98, 0,
+};
+
+static const uint8_t bookerly_18_bolditalicKernRightClasses[754] = {
+    0, 0, 0, 0, 0, 0, 93, 101, 0, 0, 0, 0, 101, 0, 86, 36,
+    0, 27, 47, 3, 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 41,
+    38, 0, 0, 0, 66, 0, 5, 42, 2, 42, 6, 6, 2, 6, 6, 56,
+    6, 6, 87, 6, 2, 42, 2, 42, 93, 32, 10, 24, 24, 82, 25, 108,
+    0, 12, 96, 0, 0, 0, 1, 8, 1, 1, 1, 13, 17, 8, 72, 62,
+    8, 8, 20, 20, 1, 20, 1, 20, 29, 57, 21, 18, 18, 92, 71, 89,
+    0, 0, 95, 0, 0, 111, 0, 0, 0, 0, 0, 0, 0, 0, 0, 34,
+    0, 47, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 73,
+    0, 0, 0, 104, 5, 5, 5, 5, 5, 5, 53, 2, 6, 6, 6, 6,
+    6, 6, 6, 6, 42, 6, 2, 2, 2, 2, 2, 0, 2, 10, 10, 10,
+    10, 25, 6, 78, 1, 1, 1, 1, 76, 1, 1, 1, 1, 1, 1, 1,
+    97, 72, 43, 43, 1, 20, 1, 1, 1, 1, 1, 0, 65, 21, 21, 21,
+    21, 18, 63, 18, 5, 1, 5, 1, 5, 1, 2, 1, 2, 1, 2, 1,
+    2, 74, 42, 1, 42, 1, 6, 1, 6, 1, 6, 1, 6, 1, 6, 1,
+    2, 17, 2, 17, 2, 17, 2, 17, 6, 8, 6, 64, 6, 43, 6, 43,
+    6, 43, 6, 72, 6, 20, 6, 72, 56, 109, 6, 8, 20, 6, 8, 6,
+    8, 6, 8, 6, 8, 6, 59, 6, 20, 6, 20, 6, 20, 20, 6, 20,
+    2, 1, 2, 1, 2, 1, 2, 1, 42, 20, 42, 20, 42, 20, 93, 29,
+    93, 29, 93, 29, 93, 79, 32, 57, 32, 57, 32, 57, 10, 21, 10, 21,
+    10, 21, 10, 21, 10, 21, 10, 21, 24, 18, 25, 18, 25, 108, 89, 108,
+    89, 108, 100, 78, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 7, 7, 22, 7, 11, 107, 7, 7, 69, 70, 7,
+    22, 7, 7, 45, 7, 26, 7, 80, 7, 61, 7, 39, 99, 7, 7, 7,
+    48, 84, 7, 11, 7, 80, 11, 22, 45, 83, 31, 7, 28, 7, 7, 22,
+    7, 7, 102, 7, 67, 4, 91, 4, 77, 81, 4, 37, 35, 23, 23, 16,
+    19, 52, 16, 4, 16, 94, 4, 16, 9, 4, 58, 23, 15, 23, 23, 85,
+    23, 23, 35, 16, 75, 4, 4, 44, 77, 4, 88, 105, 98, 49, 19, 16,
+    44, 16, 23, 9, 23, 22, 16, 11, 4, 60, 50, 7, 16, 112, 103, 80,
+    16, 7, 90, 7, 77, 7, 16, 39, 37, 99, 35, 7, 16, 7, 16, 0,
+    0, 22, 0, 7, 16, 7, 16, 7, 16, 11, 4, 11, 4, 22, 16, 46,
+    9, 46, 9, 31, 58, 0, 0, 28, 15, 28, 15, 7, 44, 51, 33, 51,
+    33, 7, 39, 37, 7, 16, 48, 19, 7, 16, 7, 16, 28, 15, 0, 52,
+    106, 26, 4, 26, 4, 55, 4, 7, 4, 110, 68, 0, 68, 39, 37, 99,
+    35, 113, 54, 7, 23, 7, 23, 11, 4, 11, 4, 11, 4, 0, 35, 45,
+    9, 45, 9, 45, 9, 0, 15, 7, 77, 7, 23, 7, 77, 31, 58, 31,
+    58, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 47, 47, 0, 47, 47, 47, 0, 0, 14, 30, 3, 14, 14, 30, 3,
+    0, 0, 0, 0, 0, 0, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 34, 73, 0, 93, 0, 0, 0,
+    66, 66, 93, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 13, 13, 13, 13, 13,
+    29, 0,
+};
+
+static const int8_t bookerly_18_bolditalicKernMatrix[16530] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -2, 0, 0, -1, -2, 0, 0, -2, 0, 0, 1, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 1, 1, 1, 0, -2, -2, -1, 0, 1, -4, -2, 0, 1, -2, 0, 0, -1, -2, -1, -4, -2, 1, 0, -3, 0, -4, 2, -2, -1, -2, 0, 0, 0, 0, 2, 0, 0, 1, 0, 0, 0, -2, 0, 2, 4, -2, -4, 0, 1, 0, 1, 4, -1, 0, 0, -4, 1, 4, 0, 0, 0, 0, 2, 0, 4, 2, -2, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 2, -1, 0, -3, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -4, -3, 0, 0, 0, 0, 0, 0, -1, 2, 0, 0, -1, -1, 0, 0, -6, 0, 0, 1, -1, 0, 0, -5, -4, 2, 0, 2, 2, 0, -3, 0, -2, 3, -2, -2, 1, -3, -2, 0, 0, 3, 1, 2, 0, -3, 0, 0, 0, -2, 0, -1, -7, 0, 0, -1, 0, 2, -3, 0, 0, 0, 0, 0, -2, -1, 0, -3, 0, 0, -1, 0, -4, 0, 0, 0, 0, 1, 0, 0, -1, 0, -1, 0, 0, -2, 0, -1, 0, 0, 0, -1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, -1, -3, 0, -2, 0, 0, 2, 0, 0, 0, 1, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -3, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 2, 0, 0, 0, 2, 2, -2, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 1, 1, 0, 0, 0, -2, 0, -6, 0, -4, 0, 0, 1, -2, 0, -1, -1, 0, 0, -4, -3, 0, 0, 0, 0, -3, 0, -2, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1, -1, 0, 0, 0, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -4, -2, -7, -4, -6, -2, -2, -1, 0, -2, -2, 0, -2, 0, 0, -1, -4, 0, -7, -1, -1, -1, -1, -1, -1, -6, -7, 0, -3, 0, -1, -1, -2, 0, -2, 0, -3, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, -5, 0, 0, 0, -3, -6, 0, -6, -2, 0, -1, -1, -1, -4, 0, -1, -1, -4, -1, -3, 0, -2, -5, 0, -1, 0, -4, -4, -4, -2, 0, -3, 0, -4, -1, -2, -2, 0, 0, -2, -3, -1, -3, -3, -1, -2, -1, 0, 0, -1, 0, -3, -1, 0, -2, 0, 0, -1, -2, -2, -1, 0, 0, 0, 0, -1,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, 1, 0, 0, -2, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 2, 0, -3, -2, -1, 1, 0, 0, 2, 0, 0, 0, 0, 2, 0, 0, -1, 1, 0, -1, 0, 0, 0, -2, 1, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 2, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 1, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -3, -1, -4, -3, -4, -2, -2, 0, 0, -1, -1, 0, -1, 0, 0, 0, -3, 0, -6, 0, 0, 0, 0, -1, 0, -4, -4, 0, -3, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0, -2, -4, 0, -4, 0, 0, -1, 0, -1, -3, 0, 0, 0, -3, 0, -3, -1, 0, -4, 0, 0, 0, -3, -2, -3, 0, 0, -3, 0, -3, 0, 0, -2, 0, 0, -2, -3, -1, -2, -2, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -4, 0, 0, -1, 0, 0, 0, -2, 0, 0,
+    0, 0, 1, -2, 0, -2, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 1, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -2, -2, -1, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, -1, -1, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -2, -1, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, -3, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 7, 4, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, -1, -3, 0, -4, 0, 0, 2, 0, 0, 0, 2, -1, 0, 0, 0, -2, 0, 0, -1, -1, 0, 0, 1, 1, 0, -3, 0, -2, 0, 0, 1, 0, -1, 0, 2, 0, -3, 0, -2, -3, 1, 2, 0, 0, 0, -2, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, 2, 0, 0, 0, 2, 2, -2, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, -2, 0, 0, -2, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, -2, 0, -2, -6, 0, -4, -3, -1, 0, 0, 0, 0, 0, -2, -1, 0, 0, 1, 0, -5, 0, -3, 2, 0, -2, -1, 0, -2, 0, 0, 2, 0, 0, 0, 0, 0, -1, -3, 0, 2, 0, -2, -4, 0, 0, -1, 2, 0, 0, 0, 0, -4, 2, 0, 0, 0, 0, -1, 2, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 2, -2, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -1, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -2, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 1, 1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, -4, 0, -3, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, -1, 1, 0, 0, 0, 0, 0, 0, 1, 0, -4, 0, -1, 1, 0, 0, 0, -1, 0, 3, 0, -2, 0, -3, -2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 2, -2, 0, 0, 0, 0, 0, 1, 0, 0, -2, 0, -2, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -4, -2, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, -4, -4, 0, 0, 1, 1, 0, -3, -1, -1, 3, -1, -2, 0, -3, -2, 0, 0, 1, 0, 1, 0, -2, 0, 1, 0, -2, 0, -1, -3, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1, -1, 0, -2, 0, 0, 0, 0, -3, 0, -1, 0, 0, 1, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -1, -2, 0, -2, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -3, -2, 0, 0, 0, 0, 0, 0, -1, 2, 0, 0, -1, -1, 0, 0, -4, 0, 0, 1, -1, 0, 0, -3, -3, 1, 0, 0, 2, 0, -3, -1, -2, 2, -1, -2, 0, -2, -2, 0, 0, 2, 2, 1, -2, -2, 0, 0, 0, -2, 0, -2, -4, 0, 0, -2, 0, 1, -2, 0, 0, 0, 0, 0, -2, -2, 0, -2, 0, 0, -1, 0, -3, 0, -2, 0, 0, 1, 0, 0, -1, 0, -1, 0, 0, -2, 0, -2, -1, 0, 0, -1, 0, 0, 0, 2, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 2, 0, 0, 1, 2, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 2, 0, 0, 0, 1, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 4, 1, 0, 0, 0, 0, 0, 0, 0, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 1, 0, 1, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -3, 0, -2, -1, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, -3, 0, -2, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, -3, 0, 0, 0, -1, -3, 0, 0, -2, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 5, 2, 2, 0, 0, 1, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 5, 0, 0, 2, 5, 5, 0, 3, 0, 0, 0, 0, 2, 2, 0, 2, 0, 1, 0, 0, 2, 0, 0, 0, 0, 0, 0, 3, 0, 0, 1, 0, 0, 1, 0, 0, 3, 2, 2, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 2, 1, 0, 0, 0, -2, 0, -4, -1, -2, 0, 0, 0, -1, 0, 0, -1, 0, 0, -3, -2, 0, 0, 0, 0, -1, 0, -2, 0, -2, 0, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, -1, -5, 0, -4, 0, 0, 2, 0, 0, 0, 2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 1, 0, -5, 0, -2, 0, 0, 0, 0, -1, 0, 1, 0, -3, 0, -3, -3, 1, 1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -5, 0, 0, 0, 0, 0, 2, 0, 0, 0, 2, 2, -2, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, -2, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 3, 3, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -4, -1, 0, -4, -3, 0, 0, 1, 0, 0, -1, 0, -2, 0, 0, -1, -4, 0, -4, -1, -2, 0, -2, 0, 0, -3, 0, 0, -3, 0, 0, 0, -2, 0, -2, 0, -2, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, -1, 0, 0, 0, -3, -5, -2, -5, 0, -1, -2, 1, 0, -2, 0, 1, 1, -4, 0, -2, -2, 0, -1, 0, 0, 0, -4, -3, -4, -1, 0, -3, 0, -1, 0, -1, -2, -1, 0, -2, -3, -2, -2, -1, -2, 0, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -3, -1, 0, 0, -1, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, -4, -3, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -2, -1, -3, -2, 0, 0, 0, -1, -1, 0, -2, 0, 1, 0, -1, 0, 0, -5, 0, 0, 0, 0, -1, -3, 0, 0, 0, 0, 0, -2, 0, 0, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, -2, 0, 0, 0, 0, 3, 0, 0, 0, 4, 0, 1, 0, 0, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 3, 0, 0, 0, 0, 0, 4, 0, 0, 0, -1, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 3, 3, -1, 2, 0, 0, 0, 0, 1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -5, 0, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 1, 1, 1, 0, 0, -2, -1, 0, 3, -4, -2, 0, 1, -2, 0, 0, -1, -2, -1, -4, -2, 1, 0, -3, 0, -4, 2, -2, -1, -2, 0, 0, 0, 0, 2, 0, 0, 1, 0, 0, 0, -2, 0, 2, 4, 0, -4, 0, 1, 0, 1, 4, -1, 0, 0, -4, 1, 4, 0, 0, 0, 0, 2, 0, 4, 2, 2, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 2, -1, 0, -3, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 2, 1, 1, 1, -2, -2, -1, 0, 2, 0, -3, 0, 3, -2, 0, 0, 0, -2, 0, -4, -3, 2, 0, -3, 0, 0, 2, -2, 0, 0, 0, 0, 0, 0, 2, 0, 0, 1, 0, 1, 0, -3, 0, 2, 2, -2, -3, 0, 1, 0, 1, 5, 0, 1, 1, -4, 3, 2, 1, 1, 0, 0, 2, 0, 5, 2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 2, -1, 1, -1, 0, 1, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, -2, -2, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, -2, 0, -1, 0, 0, 2, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, -2, 0, -1, -2, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 2, 0, 0, 0, 2, 2, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, -3, -2, 0, 0, 2, 0, 0, -2, -1, 0, 0, 0, -1, 0, -2, -1, 0, 0, 2, 0, 0, 0, -2, 0, 2, 0, -1, 0, 0, -4, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -2, 0, 0, -2, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, -1, 0, 0, 0, 0, 0, 0, -1, 1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, -2, 1, 0, 0, 2, 0, -2, -1, 0, 1, 0, -1, 2, 0, -1, 0, 0, 1, 0, 1, 0, 2, 0, 0, -2, 0, 0, -2, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, 0, -1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -3, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, 0, 0, -5, 0, 0, 0, -1, 0, 0, -3, -3, 1, 0, 2, 0, 0, -4, -2, -3, 2, -3, -2, 0, -3, -2, 0, 0, 0, 2, 0, 0, -2, 0, 0, 0, -2, 0, -1, -5, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, -2, -2, 0, -2, 0, 0, 0, 0, -2, 0, -2, 0, 0, 0, -1, 0, -2, 0, -2, 0, 0, -2, 0, -3, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 1, 0, 1, 0, 0, 0, 0, 0, 0, -3, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -4, -3, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, -4, -4, 0, 0, 0, 1, 0, -3, -2, -2, 0, -1, -3, 0, -4, -3, 0, 0, 0, 1, 0, 0, -2, 0, 0, 0, -2, 0, -1, -5, 0, 0, -1, 0, 0, -3, 0, 0, 0, 0, 0, -2, -2, 0, -2, 0, 0, 0, 0, -4, 0, -1, 0, 0, 0, -2, 0, -2, -1, 0, 0, 0, -2, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, -1, 0, 0, 2, 0, 4, 0, -1, 1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 2, 0, 1, 0, 0, 3, 0, -2, -1, 0, 1, 0, 0, 3, 0, -1, 0, 0, 1, 0, 1, 0, 3, 6, 4, -2, 0, 0, 1, 2, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 2, 0, 5, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, -1, 0, -1, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 2, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, -3, -2, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, -2, 0, 0, -1, 0, -2, 0, -2, 0, 0, 0, -2, -2, 0, 0, -2, 0, 0, 0, -2, 0, 0, 0, -2, 0, 0, 0, -1, 0, -2, 0, -1, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2, -2, -2, 0, -2, -1, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, -2, 0, -2, 0, 0, -1, 0, -2, 0, -2, 0, 0, 0, -2, 0, -2, 0, -1, -1, 0, -2, 0, -2, -2, 0, 0, -2, 0, 0, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, -2, 0, 0, -2, 0, 0, -1,
+    0, 0, -2, 0, 0, 1, 1, 0, 0, 0, -2, 0, -6, 4, -4, 0, 0, 2, -2, 0, -1, -1, 0, 0, -4, -3, 0, 0, 0, 0, -3, 0, -2, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 5, -1, 0, 0, 0, 0, 6, 0, 0, 1, -1, 0, 0, 0, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, -2, 0, 0, 0, 0, 0, 0, -1, 1, 0, 0, -2, -2, 0, 0, -2, 0, 0, 0, -1, 0, 0, -1, -2, 1, 0, 0, 2, 0, -2, -1, -2, 1, 0, -1, 2, 0, -1, 0, 0, 1, 0, 1, 0, -1, 2, 0, -2, -2, 0, -2, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -1, -2, 3, -1, 0, 0, 0, 0, -2, 0, -2, 0, 0, 1, -2, 0, -1, 2, 0, 0, 0, -2, 0, -1, 0, 0, 0, -2, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, -1, -5, 0, -4, 0, 0, 2, 0, 0, 0, 2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 1, 0, -5, 0, -2, 0, 0, 0, 0, -1, 0, 1, 0, -3, 0, -3, -3, 1, 2, 0, 0, 0, -1, 0, 0, 0, 0, 0, -5, 0, 0, 0, 0, 0, 2, 0, 0, 0, 2, 2, -2, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, -2, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -2, 0, 0, 0, 1, 0, -1, 0, -1, 2, -1, -2, 0, -1, -2, 0, 0, 2, 1, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -4, -2, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, -3, -4, 0, 0, 1, 1, 0, -3, -1, -1, 3, -1, -2, 0, -3, -2, 0, 0, 1, 0, 1, 0, -2, 0, 1, 0, -2, 0, -1, -3, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1, -1, 0, -2, 0, 0, 0, 0, -3, 0, -1, 0, 0, 1, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, -2, 0, -2, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, -2, -1, 0, 7, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 7, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 4, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 7, -1, 0, 0, 0, 0, 0, 0, 0, 7, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -1, 0, -1, 0, 0, 0, 3, 3, 0, -1, 0, 6, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 6, 3, 0, 0, 0, 0, 0, 4, 0, 0, 3, 0, 1, 6, 3, 3, -1, 0, 0, 0, 4, 0, 3, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -1, 0, 0, 1, 0, 0, 2, 0, 0, 0, 1, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -2, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 2, 0, 0, 0, 2, 2, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 2, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, -2, 0, -1, -3, 0, -3, -3, -1, 0, 0, 0, 0, 0, -4, -1, 0, 0, 0, 0, -4, 0, -3, 1, 0, -2, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -2, -3, 0, 0, 0, -2, -3, 0, 0, -2, 0, 0, 0, 0, 0, -5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -3, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -2, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 6, 4, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 1, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, -1, 0, 0, 0, -1, 0, -1, 0, 0, 4, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, 4, 0, 0, 0, 0, 0, 0, 5, 0, 0, -1, -2, 0, 4, -1, -1, -1, 0, 0, 0, 5, 0, 0, 0, 0, -1, 0, -1, 0, 4, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -4, 0, 0, -2, -1, 0, 0, 0, 0, 0, -4, -1, 0, 0, 0, 0, -5, 0, -2, 1, 0, -1, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, -2, -3, 0, 0, 0, -1, -3, 0, 0, -2, 0, 0, 0, 0, 0, -5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, 0, -2, 0, 0, 0, 2, 2, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 4, 2, 0, 0, 0, 0, 0, 2, 0, 0, 2, 0, 0, 4, 2, 2, -2, 0, 0, 0, 2, 0, 2, 0, 0, -2, 0, -2, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -2, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, -3, 0, -4, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 1, 0, 0, 0, 0, 0, -1, -1, 0, -3, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -3, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, -3, 0, -3, 0, 0, 1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, -1, 2, 0, 0, 0, -1, 0, 0, 0, -2, 0, -2, -2, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, -2, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -2, -1, -1, -2, 0, 0, 0, -1, -2, 0, -1, 0, 0, 0, -1, 0, 0, -2, 0, 0, 0, 0, -2, -1, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 5, -1, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 1, 4, 3, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 2, 0, 4, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+    0, -1, -1, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -2, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, -1, 0, 1, 0, 0, 5, 1, 1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 1, 0, -3, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -1, -2, 0, 1, 3, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, -3, 2, 0, 0, 0, 0, 0, 1, 0, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -3, 0, -2, -1, 0, 0, 0, -1, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, 0, -3, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, -2, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 3, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 2, 0, 4, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 2, 0, -1, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, -3, 0, 2, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, -3, 2, 0, 0, 0, 0, 0, 2, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 2, 0, 0, 3, 0, 0, 3, 3, 3, 0, 0, 0, 0, 2, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, -2, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 7, 2, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 1, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -1, -2, 0, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 1, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, -1, 0, 0, -1, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, -2, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 2, 0, 0, -1, -1, -1, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 2, 0, 0, 0, 0, 0, 0, 4, 0, 0, -1, -2, 0, 2, -1, -1, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -1, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 1, 1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -2, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, -1, 0, 0, 0, 0, 0, 2, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -2, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 1, 0, -1, 0, 0, 2, 0, -1, -1, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0, 0, -1, 1, 0, 0, 0, 0, -1, 1, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -3, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 2, 0, 0, -2, 0, 0, 1, 1, 0, 0, -1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 2, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, -2, 0, -1, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -2, -2, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -3, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -2, 3, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 3, 3, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -3, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -2, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 2, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 4, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 1, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 3, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 2, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t bookerly_18_bolditalicGlyphLookup[368] = {
+    0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0001, 0x0002, 0xFFFF, 0xFFFF, 0xFFFF, 0x0003, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0004, 0xFFFF, 0xFFFF,
+    0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, 0x0010, 0x0011, 0x0012, 0x0013, 0x0014,
+    0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, 0x0020, 0x0021, 0x0022, 0x0023, 0x0024,
+    0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, 0x0030, 0x0031, 0x0032, 0x0033, 0x0034,
+    0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, 0x0040, 0x0041, 0x0042, 0x0043, 0x0044,
+    0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051, 0x0052, 0x0053, 0x0054,
+    0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, 0x0060, 0x0061, 0x0062, 0x0063, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x0072, 0x0073,
+    0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, 0x0080, 0x0081, 0x0082, 0x0083,
+    0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F, 0x0090, 0x0091, 0x0092, 0x0093,
+    0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F, 0x00A0, 0x00A1, 0x00A2, 0x00A3,
+    0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF, 0x00B0, 0x00B1, 0x00B2, 0x00B3,
+    0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF, 0x00C0, 0x00C1, 0x00C2, 0x00C3,
+    0x0241, 0x0242, 0x0243, 0x0244, 0x0245, 0x0246, 0x0247, 0x0248, 0x0249, 0x024A, 0x024B, 0x024C, 0x024D, 0x024E, 0x024F, 0x0250,
+    0x0251, 0x0252, 0x0253, 0x0254, 0x0255, 0x0256, 0x0257, 0x0258, 0x0259, 0x025A, 0x025B, 0x025C, 0x025D, 0x025E, 0x025F, 0x0260,
+    0x0261, 0x0262, 0x0263, 0x0264, 0x0265, 0x0266, 0x0267, 0x0268, 0x0269, 0x026A, 0x026B, 0x026C, 0x026D, 0x026E, 0x026F, 0x0270,
+    0x0271, 0xFFFF, 0x0272, 0x0273, 0x0274, 0x0275, 0x0276, 0x0277, 0x0278, 0x0279, 0x027A, 0x027B, 0x027C, 0xFFFF, 0x027D, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x027E, 0x027F, 0xFFFF, 0xFFFF, 0x0280, 0x0281, 0x0282, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x0283, 0xFFFF, 0xFFFF, 0xFFFF, 0x0284, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0285,
+    0x0286, 0x0287, 0x0288, 0x0289, 0x028A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
 };
 
 static const EpdFontData bookerly_18_bolditalic = {
     bookerly_18_bolditalicBitmaps,
     bookerly_18_bolditalicGlyphs,
     bookerly_18_bolditalicIntervals,
-    64,
+    65,
     49,
     40,
     -10,
     true,
     bookerly_18_bolditalicGroups,
-    11,
+    4,
+    bookerly_18_bolditalicKernLeftClasses,
+    bookerly_18_bolditalicKernRightClasses,
+    bookerly_18_bolditalicKernMatrix,
+    114,
+    nullptr,
+    0,
+    0,
+    bookerly_18_bolditalicGlyphLookup,
+    bookerly_18_bolditalicGlyphGroups,
+    false,
+    nullptr,
 };
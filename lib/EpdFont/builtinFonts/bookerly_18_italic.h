@@ -3,2584 +3,2692 @@
  * name: bookerly_18_italic
  * size: 18
  * mode: 2-bit  compressed: true
- * Command used: fontconvert.py bookerly_18_italic 18 ../builtinFonts/source/Bookerly/Bookerly-Italic.ttf --2bit --compress
+ * Command used: fontconvert.py bookerly_18_italic 18 ../builtinFonts/source/Bookerly/Bookerly-Italic.ttf --2bit --compress --frequency-corpus ../../../test/hyphenation_eval/resources/english_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/french_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/german_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/italian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/russian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/spanish_hyphenation_tests.txt
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t bookerly_18_italicBitmaps[41139] = {
-    0xA5, 0x5B, 0xBF, 0x93, 0xDD, 0xD6, 0x75, 0xBE, 0x00, 0xC4, 0x45, 0x62, 0x4C, 0x06, 0xCA, 0x0C,
-    0xE5, 0x19, 0x9B, 0x13, 0xC3, 0x4D, 0x0A, 0x6B, 0xAC, 0x81, 0xFF, 0x00, 0x89, 0x80, 0x9C, 0x99,
-    0xA4, 0x50, 0x21, 0x66, 0x86, 0x6B, 0xCF, 0xC8, 0x85, 0xAA, 0x34, 0x4E, 0x26, 0x6C, 0x5D, 0x88,
-    0x0B, 0xD8, 0x2E, 0x52, 0xA4, 0x10, 0x8B, 0x38, 0x29, 0x54, 0xC4, 0x05, 0x8B, 0x68, 0x53, 0xD0,
-    0x45, 0x0A, 0xCF, 0x84, 0xBB, 0x80, 0xC3, 0x82, 0x45, 0x0A, 0x43, 0x56, 0x32, 0x2E, 0x54, 0x08,
-    0x71, 0xE8, 0x78, 0x42, 0x15, 0x42, 0x14, 0xD8, 0x7E, 0x24, 0xF1, 0x23, 0xDF, 0xF7, 0x9D, 0x8B,
-    0xB7, 0xBB, 0xB4, 0x94, 0x38, 0xC9, 0xE3, 0x3E, 0xBC, 0xF7, 0xF0, 0xE3, 0xDE, 0x73, 0xCF, 0xCF,
-    0xEF, 0x9C, 0x73, 0xE9, 0x9C, 0x73, 0xA7, 0x2E, 0xEF, 0xA2, 0xC9, 0x55, 0x75, 0x32, 0xB8, 0xD5,
-    0xA5, 0xBD, 0x9B, 0x5C, 0xD6, 0x86, 0x3B, 0x97, 0x97, 0xD1, 0xE0, 0x0A, 0x17, 0xF5, 0xEE, 0xA6,
-    0x8B, 0x5B, 0x77, 0xD7, 0xA5, 0xB5, 0x1B, 0x5D, 0x5A, 0xBA, 0xDE, 0xF9, 0x17, 0x6E, 0xAA, 0xDA,
-    0x64, 0x72, 0x8D, 0x0B, 0x4A, 0xFE, 0x0E, 0xC6, 0xA4, 0x9D, 0x92, 0xBE, 0x8A, 0xC6, 0xBC, 0x9C,
-    0xD2, 0xF6, 0x28, 0x1A, 0xB2, 0x72, 0x97, 0xB4, 0x37, 0xC3, 0x21, 0x73, 0xF8, 0x7C, 0x29, 0xEC,
-    0x52, 0x77, 0xFE, 0x55, 0xB8, 0xAB, 0x38, 0x5E, 0x75, 0x2F, 0xE1, 0x78, 0xD3, 0xBD, 0x81, 0xE3,
-    0x5D, 0xFC, 0x73, 0x20, 0x60, 0xE7, 0x82, 0xC3, 0x47, 0x87, 0x8F, 0xAE, 0x47, 0x2B, 0x5E, 0x53,
-    0xCC, 0xE3, 0xCE, 0x45, 0x03, 0x68, 0x01, 0x3D, 0x51, 0xE7, 0x5C, 0xDC, 0x81, 0x24, 0x90, 0x95,
-    0xE0, 0x98, 0xB4, 0xA0, 0x0C, 0xD4, 0x81, 0xB4, 0xE7, 0xEF, 0x3C, 0x6C, 0x1E, 0xD6, 0x05, 0xEF,
-    0x6F, 0x9F, 0x6F, 0x8E, 0x9B, 0xE3, 0x12, 0xC3, 0x73, 0x92, 0x97, 0x30, 0x81, 0xC3, 0x14, 0x77,
-    0x35, 0xC9, 0x84, 0xE3, 0x0E, 0xFF, 0x9C, 0xFB, 0x2E, 0xFE, 0xED, 0x5F, 0x1C, 0xD8, 0x05, 0x83,
-    0xD3, 0x3D, 0xA2, 0x0C, 0xAF, 0xD7, 0xB1, 0xB4, 0x78, 0x9D, 0x31, 0xC1, 0xBA, 0x62, 0xF9, 0xE3,
-    0x13, 0xF2, 0xE8, 0xA5, 0xBC, 0xC7, 0xE2, 0xA2, 0x5D, 0x38, 0x25, 0xED, 0x91, 0x6B, 0xA2, 0xFE,
-    0x73, 0x2E, 0x6F, 0x47, 0xDC, 0x38, 0x71, 0x15, 0xEB, 0x87, 0x38, 0x64, 0x2B, 0x88, 0x0A, 0x56,
-    0x4E, 0x92, 0xAE, 0x1C, 0xB8, 0x99, 0xB9, 0xE4, 0x15, 0x04, 0xA7, 0xE9, 0xE4, 0xCA, 0xB8, 0x5D,
-    0xDD, 0x18, 0xF6, 0x79, 0x77, 0xE4, 0xC6, 0x64, 0xCC, 0xDB, 0x17, 0xA3, 0x29, 0x19, 0x33, 0xB7,
-    0x04, 0xEB, 0x2B, 0xF5, 0xEA, 0xF2, 0xF5, 0xDF, 0xD6, 0x32, 0xC4, 0x32, 0x4A, 0x97, 0x70, 0x72,
-    0x48, 0x83, 0x03, 0xD5, 0x9F, 0x44, 0x65, 0x56, 0x5E, 0xE0, 0xAC, 0x7B, 0x16, 0xEF, 0xCB, 0x3C,
-    0x4F, 0x1A, 0xC0, 0xB5, 0xB4, 0x73, 0xE1, 0xBA, 0x38, 0x8A, 0x37, 0xDC, 0xA5, 0xAD, 0x8B, 0x07,
-    0x17, 0xEC, 0x02, 0xF2, 0x94, 0xEC, 0x3E, 0x72, 0x11, 0x88, 0x3F, 0xC1, 0xF8, 0x10, 0xA9, 0x64,
-    0x8E, 0x4B, 0x2E, 0x6D, 0x71, 0x04, 0xAB, 0xE2, 0x1E, 0x97, 0x4E, 0x30, 0xD0, 0x0E, 0x97, 0x8E,
-    0x30, 0xE8, 0x91, 0xCB, 0xEA, 0xAB, 0xEE, 0x52, 0x09, 0x96, 0xB7, 0x85, 0x2B, 0xE6, 0x68, 0x48,
-    0xBB, 0xBC, 0xAC, 0xD6, 0xB6, 0xB9, 0xD3, 0x65, 0x65, 0x15, 0xEE, 0x92, 0xB5, 0xD3, 0x15, 0xF7,
-    0xF5, 0x32, 0x69, 0xF3, 0x32, 0xA5, 0x90, 0x70, 0x26, 0x1C, 0x38, 0x58, 0xDC, 0x71, 0xD0, 0x68,
-    0x08, 0xA9, 0x5D, 0x2E, 0x1C, 0xF1, 0x0B, 0xEB, 0x0A, 0x39, 0x38, 0x2E, 0x05, 0xF8, 0xD5, 0x1A,
-    0x55, 0xB8, 0x45, 0x54, 0xB9, 0x23, 0x9C, 0x84, 0x92, 0xB9, 0xF4, 0x09, 0x3E, 0x2B, 0x32, 0x78,
-    0x67, 0x2B, 0x3E, 0xB8, 0x85, 0x1F, 0xF5, 0x7E, 0xD1, 0x07, 0xC6, 0x84, 0x70, 0x35, 0x0D, 0xAD,
-    0xEC, 0x13, 0xDA, 0xD8, 0x4A, 0xDB, 0xCA, 0x42, 0x4A, 0xAA, 0x35, 0x91, 0xA0, 0xB8, 0x33, 0x25,
-    0xD4, 0x69, 0x37, 0xC5, 0x62, 0x69, 0x3C, 0x60, 0xA2, 0xB0, 0x76, 0xD9, 0x87, 0xE4, 0x1A, 0x06,
-    0xC1, 0x54, 0x98, 0x3E, 0x06, 0xEF, 0x2E, 0x35, 0x9D, 0x6B, 0x46, 0x29, 0x43, 0xFA, 0x7E, 0x1F,
-    0x91, 0x9D, 0x53, 0xDE, 0x16, 0x2B, 0xB9, 0x5B, 0xBD, 0xBC, 0xBB, 0x4B, 0xC6, 0xAC, 0x11, 0x68,
-    0x8F, 0x86, 0x60, 0xA6, 0xA1, 0xA4, 0x35, 0xEC, 0x4A, 0xA7, 0xA3, 0x09, 0xAA, 0x8B, 0x99, 0xE3,
-    0xA9, 0xE0, 0x14, 0x2E, 0x59, 0x46, 0xC9, 0x24, 0xA1, 0x92, 0x14, 0xBD, 0xCB, 0x16, 0x52, 0xB2,
-    0xDC, 0xA1, 0xBC, 0x41, 0xF7, 0xFA, 0x01, 0x35, 0x26, 0x5F, 0x77, 0x98, 0xA4, 0x74, 0xC1, 0x35,
-    0xC8, 0x70, 0xB5, 0x25, 0x5E, 0xE1, 0x92, 0x6E, 0xA6, 0x3F, 0x98, 0xF2, 0xDF, 0x1B, 0x8A, 0xA8,
-    0xBF, 0x19, 0xB7, 0x77, 0x93, 0x33, 0xD1, 0x47, 0x64, 0xF4, 0x20, 0x29, 0xBB, 0xAC, 0xF3, 0xEF,
-    0x56, 0x33, 0xE9, 0x9D, 0xF4, 0x9A, 0x5D, 0x52, 0xA7, 0xA4, 0xC5, 0x89, 0x23, 0xF1, 0x86, 0xE2,
-    0x96, 0xA8, 0xED, 0x82, 0x74, 0xD5, 0xD9, 0x49, 0xDE, 0xAD, 0x3B, 0x75, 0x57, 0xE7, 0xEF, 0xA8,
-    0xB6, 0xAB, 0xE3, 0xF6, 0xA3, 0x13, 0xA7, 0xEC, 0x36, 0x3D, 0x53, 0x39, 0x9B, 0xCE, 0x7D, 0xE3,
-    0xBC, 0x6A, 0x7E, 0xCF, 0x0F, 0x1D, 0x6F, 0xB7, 0x90, 0x2A, 0x8D, 0x9F, 0x6D, 0xC3, 0x9D, 0x9E,
-    0x1F, 0xFB, 0xD4, 0x5F, 0x89, 0xF7, 0x64, 0xF8, 0xAB, 0x3C, 0xA1, 0x09, 0x4F, 0xBD, 0x7D, 0x6C,
-    0x27, 0xA9, 0x36, 0x6E, 0xBB, 0x50, 0xF8, 0x8B, 0xE2, 0xC3, 0x39, 0x5E, 0x6C, 0x3C, 0xCA, 0xF1,
-    0x2E, 0x78, 0x7E, 0xCF, 0xC6, 0x4B, 0x9C, 0x38, 0x6C, 0xE7, 0x60, 0xBA, 0xEA, 0xAA, 0x1F, 0x42,
-    0x9D, 0xDE, 0x6A, 0x93, 0x75, 0xCC, 0x1E, 0x4F, 0xD5, 0x0F, 0x83, 0xEC, 0x5E, 0x17, 0xB6, 0x93,
-    0x46, 0xFD, 0xD4, 0xF6, 0xC0, 0x89, 0x9F, 0x21, 0xE9, 0xFC, 0xD4, 0xE7, 0x4E, 0xD0, 0x15, 0xBD,
-    0x89, 0xF7, 0xBF, 0x1C, 0x56, 0xDF, 0xB9, 0xFE, 0xB1, 0x77, 0xD8, 0x09, 0xBE, 0xBE, 0xE0, 0x8A,
-    0x2E, 0x1D, 0xA1, 0x3A, 0x95, 0xCB, 0x61, 0x59, 0x69, 0x97, 0xF4, 0x69, 0xCF, 0x3B, 0xDC, 0x73,
-    0x87, 0xB0, 0xAE, 0x05, 0x7F, 0xC5, 0x3A, 0x1F, 0x7C, 0x79, 0xAE, 0xDE, 0x9B, 0xAA, 0x6F, 0xDE,
-    0xF2, 0xA4, 0xDA, 0xAA, 0x8C, 0x89, 0xE2, 0xBA, 0xC6, 0x13, 0x5F, 0x4C, 0xD1, 0x4F, 0x9D, 0xE7,
-    0x82, 0xF9, 0x10, 0xF2, 0xE1, 0x7F, 0x7A, 0xE4, 0xE8, 0xE3, 0x1E, 0x21, 0x21, 0xF1, 0xC5, 0x47,
-    0xEC, 0xEE, 0xF9, 0xE2, 0x23, 0x9F, 0xDD, 0xF8, 0x42, 0xFF, 0x13, 0x34, 0xD4, 0xEC, 0x86, 0x2E,
-    0xAC, 0x5A, 0xD6, 0xC1, 0x65, 0x63, 0xB0, 0xD2, 0x2A, 0xE2, 0x09, 0xB1, 0x06, 0xEB, 0x85, 0x04,
-    0xC2, 0x39, 0xDA, 0x51, 0x0C, 0xB4, 0xBB, 0x39, 0xC5, 0xD8, 0xF9, 0x3B, 0x33, 0xBF, 0xD2, 0x6A,
-    0xF3, 0x7B, 0x74, 0x15, 0x53, 0x45, 0x2B, 0xB9, 0x4F, 0xFF, 0x3A, 0x36, 0x18, 0xBD, 0xE1, 0x5D,
-    0xE9, 0x80, 0x01, 0x02, 0x3D, 0x50, 0xB4, 0x74, 0x93, 0x63, 0x82, 0xA8, 0xB1, 0x20, 0x22, 0xE1,
-    0x2F, 0x82, 0x07, 0x1D, 0x60, 0x40, 0x0D, 0x1E, 0x5F, 0x69, 0xA8, 0x01, 0x0F, 0xCE, 0x5D, 0xDF,
-    0x6B, 0x21, 0xD6, 0x94, 0xD1, 0xCD, 0xEE, 0x70, 0xBD, 0x73, 0x87, 0x9C, 0x7C, 0x32, 0xA5, 0x80,
-    0xFA, 0x42, 0x06, 0xB2, 0x23, 0xEA, 0xC5, 0x62, 0x6A, 0x48, 0x1E, 0x34, 0xA4, 0xC5, 0x6E, 0xAA,
-    0x4A, 0xBB, 0xFF, 0xEC, 0xA6, 0x78, 0xC4, 0x62, 0x1F, 0x95, 0x90, 0x75, 0x82, 0x90, 0xB5, 0xAD,
-    0x1F, 0x4B, 0x27, 0xC1, 0x9C, 0x1D, 0xEB, 0x1F, 0x5D, 0x86, 0xF9, 0xDA, 0x68, 0xE6, 0xFA, 0x31,
-    0x4F, 0xD1, 0xC2, 0x99, 0x63, 0xC8, 0xDF, 0xB0, 0x51, 0x5C, 0x42, 0xC3, 0x72, 0x32, 0xF5, 0x82,
-    0xEC, 0x4E, 0x26, 0xB9, 0x33, 0x8D, 0xC3, 0xEB, 0x39, 0x39, 0x9F, 0xF2, 0x64, 0xC4, 0xE5, 0x04,
-    0x1C, 0xDB, 0x5F, 0xA1, 0x60, 0x52, 0xCA, 0x24, 0xB6, 0x67, 0x8E, 0x8F, 0x8F, 0xEB, 0x8A, 0x61,
-    0x33, 0x61, 0x30, 0x2C, 0xA9, 0x87, 0xFD, 0x46, 0x54, 0x2C, 0xFF, 0x89, 0x10, 0x89, 0x03, 0x38,
-    0x44, 0x99, 0x94, 0x58, 0x2E, 0x60, 0xC0, 0xC0, 0x65, 0x7C, 0x09, 0xCC, 0xDF, 0xD3, 0x41, 0x7E,
-    0x3B, 0xCE, 0x13, 0xF2, 0x70, 0xC5, 0xA4, 0x49, 0x93, 0xA1, 0x48, 0x3F, 0x75, 0xA8, 0xC8, 0x96,
-    0xEE, 0x44, 0x8C, 0xC8, 0x26, 0x31, 0xD9, 0x9E, 0x18, 0xD1, 0x9A, 0x4D, 0xD4, 0x83, 0xC9, 0x7D,
-    0xFA, 0x0E, 0xF8, 0xA2, 0x28, 0x0A, 0x77, 0x06, 0x89, 0x5E, 0xBA, 0xE6, 0x65, 0x11, 0xC8, 0x77,
-    0x4D, 0x1A, 0x84, 0xDE, 0xBC, 0xD2, 0xA3, 0x1C, 0x2F, 0x5A, 0xB9, 0xE2, 0xA5, 0xE1, 0xC8, 0x6F,
-    0xD2, 0x21, 0xF7, 0x98, 0x35, 0xDA, 0x51, 0x18, 0x2B, 0xF9, 0x5F, 0xB4, 0x45, 0x0D, 0x21, 0x40,
-    0x40, 0x78, 0xBC, 0x20, 0xC9, 0xB0, 0x7F, 0xD0, 0xD0, 0x50, 0x7C, 0x69, 0x1F, 0x2E, 0x87, 0x87,
-    0xCB, 0x75, 0xB2, 0x01, 0x1E, 0x15, 0xAF, 0xF9, 0xF9, 0xE3, 0x63, 0xE0, 0x03, 0x0E, 0xA1, 0x00,
-    0xC1, 0xB5, 0x25, 0x72, 0xFB, 0x8D, 0x0C, 0xA9, 0xDF, 0xD4, 0x39, 0x50, 0xE4, 0x6D, 0xA8, 0x1A,
-    0xE0, 0xDC, 0x60, 0xCA, 0xAF, 0x3B, 0xED, 0x49, 0xF1, 0xA7, 0x92, 0x81, 0x3C, 0x10, 0xAD, 0x0F,
-    0xC8, 0x55, 0x12, 0xFF, 0x15, 0x45, 0xFC, 0x58, 0x92, 0x29, 0x86, 0x6D, 0x5D, 0xEE, 0x8C, 0x39,
-    0xE9, 0xFE, 0x64, 0x34, 0x6F, 0xD2, 0x8D, 0x78, 0xB8, 0x82, 0xC3, 0x6B, 0xF4, 0xF3, 0x95, 0xA1,
-    0x8D, 0x07, 0xE7, 0xF5, 0xF5, 0x39, 0xD9, 0xD2, 0x4E, 0x94, 0xB5, 0x38, 0x3C, 0x22, 0xCD, 0x9C,
-    0xA9, 0xD8, 0xED, 0x55, 0xE2, 0x4C, 0x4F, 0xB2, 0xB3, 0x89, 0x1B, 0x2E, 0x04, 0x4C, 0x5F, 0x31,
-    0xD3, 0x77, 0x20, 0x04, 0xD0, 0x50, 0x75, 0x58, 0x44, 0xB8, 0x70, 0xF9, 0xE9, 0xC0, 0x45, 0xAD,
-    0x0A, 0xAE, 0xFA, 0xBA, 0xF0, 0x6B, 0xD6, 0xC5, 0xC6, 0x50, 0x30, 0xB2, 0x84, 0xA6, 0x41, 0xED,
-    0xD2, 0xE5, 0x06, 0x63, 0xAF, 0xAC, 0xA8, 0x59, 0x4A, 0xAF, 0x48, 0x1C, 0x77, 0x47, 0xD5, 0xFA,
-    0x88, 0xDC, 0x7D, 0xF3, 0xA7, 0x87, 0x5F, 0x65, 0x7C, 0xCB, 0x7F, 0x30, 0x42, 0x83, 0x80, 0xCC,
-    0xB2, 0xEE, 0x77, 0x64, 0x1A, 0xB6, 0x66, 0x92, 0x97, 0x28, 0x58, 0xD4, 0x9E, 0x38, 0xF2, 0x43,
-    0xAA, 0x96, 0xED, 0xAF, 0x2B, 0xB2, 0xB4, 0x9E, 0x37, 0x76, 0xBA, 0xF4, 0x3A, 0x4D, 0x47, 0xAD,
-    0x9B, 0x24, 0x82, 0xA0, 0x3E, 0xE7, 0x65, 0x42, 0x32, 0x3D, 0xA1, 0xB4, 0xD2, 0xF9, 0xF5, 0x89,
-    0xAA, 0xD7, 0xD4, 0x52, 0x00, 0xDC, 0x8A, 0xBF, 0x99, 0x02, 0x83, 0xA2, 0x34, 0x24, 0xA4, 0x01,
-    0xAC, 0xA2, 0x56, 0x17, 0x3F, 0xC7, 0xC8, 0x0A, 0xE2, 0x08, 0xBC, 0x62, 0x14, 0x22, 0xF4, 0xFA,
-    0xCA, 0x22, 0xCE, 0xF4, 0x81, 0x4C, 0x74, 0xE1, 0xF4, 0x64, 0x48, 0x0F, 0x52, 0xE3, 0x11, 0x4F,
-    0x87, 0x13, 0x28, 0x87, 0xAA, 0x37, 0x2D, 0x0E, 0xE9, 0xF2, 0xD6, 0x4A, 0x81, 0x2C, 0x9C, 0x9C,
-    0x12, 0xB9, 0x64, 0xAE, 0xEF, 0xBA, 0x34, 0x88, 0x2B, 0x90, 0x27, 0x28, 0x1E, 0x37, 0x03, 0x69,
-    0x02, 0xA0, 0x9B, 0xC5, 0xD6, 0x1A, 0x2B, 0x07, 0x79, 0xF8, 0xB5, 0x72, 0x59, 0xE9, 0xFE, 0x6B,
-    0xAB, 0x19, 0xB8, 0xE4, 0x82, 0xB8, 0x3A, 0x06, 0x26, 0x7A, 0xF4, 0xDA, 0xCA, 0x61, 0xA0, 0x83,
-    0xA1, 0x77, 0x2B, 0x64, 0x9F, 0xD7, 0x22, 0x33, 0x53, 0x99, 0x0C, 0x55, 0x37, 0x27, 0x63, 0x72,
-    0x9E, 0xBC, 0xB1, 0x4A, 0x1F, 0x4B, 0xDA, 0x29, 0x69, 0xFA, 0x23, 0xCF, 0xAC, 0xA4, 0x4B, 0x76,
-    0x11, 0x20, 0x66, 0x59, 0x3C, 0x85, 0x17, 0xED, 0xF5, 0x19, 0x50, 0x93, 0x8D, 0xC9, 0x04, 0x37,
-    0xFA, 0x99, 0x7D, 0x70, 0x03, 0xBB, 0xA0, 0x03, 0x98, 0xCB, 0x54, 0xFF, 0x93, 0x5E, 0x5F, 0x90,
-    0xA8, 0xF0, 0x07, 0xB5, 0xAA, 0x14, 0x75, 0x26, 0x3A, 0x4E, 0x04, 0x19, 0xAC, 0xF7, 0xE4, 0xFC,
-    0x9D, 0x71, 0x6D, 0xA2, 0xAD, 0xC8, 0x49, 0xE2, 0xA9, 0x5A, 0xF8, 0x87, 0x48, 0xAB, 0xA0, 0x8D,
-    0x73, 0x01, 0xC0, 0x59, 0x98, 0x98, 0x90, 0x45, 0x88, 0x68, 0x76, 0xBA, 0xD5, 0xC5, 0xB3, 0x61,
-    0x5A, 0xBC, 0x60, 0xCA, 0xC7, 0xAF, 0x82, 0x31, 0xFF, 0xAA, 0xDC, 0xE0, 0xE9, 0x17, 0x4E, 0x2E,
-    0x5B, 0xEC, 0x35, 0x14, 0x88, 0x49, 0xC3, 0xC5, 0x8F, 0x1C, 0x73, 0xE4, 0xEC, 0x6C, 0x64, 0xE2,
-    0x52, 0x21, 0xB1, 0x41, 0xD7, 0x39, 0x31, 0xE7, 0x05, 0x2B, 0x35, 0x6B, 0xD3, 0x19, 0x3C, 0x08,
-    0xB6, 0xD1, 0x9B, 0x1E, 0x13, 0x20, 0x24, 0x0F, 0xD9, 0x07, 0x4B, 0xC8, 0xD0, 0x60, 0x80, 0x95,
-    0x41, 0x10, 0x8C, 0xCD, 0x6B, 0xFE, 0x41, 0x63, 0x28, 0x68, 0xFD, 0xE1, 0x27, 0x22, 0x6E, 0x84,
-    0x61, 0xA9, 0x09, 0xFD, 0x39, 0x3A, 0x71, 0x05, 0xAC, 0x80, 0xDA, 0xD3, 0x9B, 0x5D, 0xF6, 0x27,
-    0xFF, 0x78, 0xB9, 0x65, 0x38, 0x76, 0x95, 0x13, 0x50, 0xFA, 0x43, 0x60, 0x86, 0x5F, 0x07, 0x20,
-    0x53, 0x4E, 0x92, 0x6B, 0xA9, 0xBC, 0x57, 0x92, 0xBF, 0xC5, 0x3C, 0xB1, 0x62, 0x72, 0x40, 0xBD,
-    0x85, 0x26, 0xB7, 0x69, 0x8B, 0xD1, 0xD7, 0x65, 0xE7, 0x4E, 0xE8, 0x14, 0xFF, 0x0A, 0x3E, 0xBE,
-    0x03, 0x2C, 0xED, 0xF0, 0xC0, 0x89, 0x12, 0xBC, 0xAB, 0x2E, 0xF9, 0x91, 0x47, 0xDD, 0x30, 0x5B,
-    0x00, 0x0D, 0xA4, 0x78, 0xF7, 0x06, 0xC2, 0x71, 0x00, 0x7F, 0x60, 0x7C, 0xC2, 0xFF, 0xFC, 0x15,
-    0xA6, 0x02, 0x05, 0x52, 0x41, 0xA4, 0x89, 0xB4, 0xA9, 0x39, 0xE9, 0xC2, 0x1D, 0x74, 0x3F, 0xAF,
-    0x79, 0xE2, 0x08, 0x4E, 0x23, 0xE9, 0x11, 0xAB, 0xF3, 0xAF, 0x4E, 0x10, 0x79, 0xBA, 0xBE, 0x03,
-    0x63, 0xC0, 0x6C, 0xCD, 0x90, 0x52, 0x89, 0xCB, 0xE0, 0x36, 0x3D, 0xD7, 0x5E, 0x71, 0xB2, 0x6E,
-    0x13, 0xCF, 0xA6, 0x0A, 0x94, 0x67, 0xE2, 0xB5, 0xF6, 0x8A, 0x00, 0xE1, 0xEA, 0xD5, 0x1C, 0x8E,
-    0x4B, 0xEA, 0x0D, 0x5D, 0x7E, 0xF0, 0x49, 0x3A, 0xF7, 0x3D, 0x0B, 0x1F, 0xB3, 0x1F, 0xD4, 0x5C,
-    0x42, 0x33, 0x58, 0x72, 0x39, 0xD9, 0x47, 0x65, 0x33, 0xBF, 0xAA, 0xA9, 0xD3, 0x7B, 0x3B, 0x33,
-    0x03, 0xA1, 0x81, 0x68, 0x50, 0x66, 0x10, 0x8E, 0x82, 0x96, 0xC8, 0x87, 0x66, 0xC3, 0x34, 0x32,
-    0x8E, 0x23, 0x13, 0x54, 0x61, 0xAE, 0x2A, 0xAF, 0x15, 0x22, 0xE8, 0xF0, 0xA4, 0x94, 0xAB, 0xB4,
-    0xF1, 0xF1, 0xF1, 0xB1, 0x87, 0x07, 0x90, 0x76, 0xE0, 0xF1, 0xC0, 0x6C, 0x50, 0xA2, 0xB1, 0xE0,
-    0x59, 0x58, 0x3C, 0x64, 0x38, 0x4F, 0x96, 0x97, 0x19, 0x22, 0xAA, 0x75, 0x47, 0x71, 0x2A, 0x80,
-    0xBE, 0x76, 0x7C, 0x4B, 0x4B, 0x86, 0x9B, 0xD2, 0xBA, 0x7F, 0xF3, 0x46, 0x0B, 0x84, 0x00, 0xF9,
-    0x61, 0x20, 0x70, 0x0D, 0xFC, 0x42, 0xE4, 0x91, 0x41, 0x81, 0x36, 0x8C, 0x2A, 0xA7, 0x26, 0xA5,
-    0x2A, 0xF1, 0x0B, 0xE7, 0xE8, 0x97, 0xA4, 0xFF, 0xB9, 0x8E, 0xCB, 0x21, 0x82, 0x02, 0xE8, 0xC9,
-    0x46, 0x01, 0x9C, 0x9E, 0x54, 0x14, 0x2D, 0xC9, 0x51, 0x66, 0x1F, 0x69, 0x6D, 0x69, 0x4F, 0x52,
-    0x2B, 0x86, 0x7C, 0xCC, 0xC1, 0x80, 0xD0, 0x1E, 0xAC, 0xC7, 0x77, 0x26, 0x06, 0xBD, 0xB5, 0xE6,
-    0xDA, 0x6E, 0x9D, 0xB1, 0xF8, 0xEB, 0xB7, 0x4D, 0x28, 0x35, 0x01, 0xC3, 0x0A, 0xAF, 0xF7, 0xD3,
-    0xAF, 0x21, 0x20, 0xC0, 0x46, 0x76, 0xC1, 0xA2, 0xAC, 0x8E, 0x80, 0x4D, 0xF2, 0xDC, 0x51, 0xFD,
-    0xC2, 0x5A, 0x41, 0xCE, 0x38, 0x69, 0xA1, 0x55, 0x27, 0x9C, 0x31, 0x7C, 0x77, 0xA6, 0x05, 0x72,
-    0x63, 0xC1, 0xB2, 0x0F, 0xFD, 0xE6, 0xD2, 0x0C, 0xF7, 0x28, 0x8A, 0xFD, 0x16, 0x90, 0x12, 0x64,
-    0x83, 0x6C, 0x2E, 0x68, 0x5A, 0x63, 0x0F, 0x2D, 0xA2, 0xF6, 0x00, 0xC4, 0x3B, 0xDB, 0xCF, 0x1E,
-    0xDF, 0x56, 0xB2, 0xBD, 0x1A, 0x28, 0x91, 0xF2, 0xFC, 0x6E, 0xE3, 0x5E, 0x17, 0xEC, 0x82, 0x19,
-    0x18, 0x38, 0x2B, 0x4C, 0x2E, 0x70, 0xC2, 0x5C, 0xBA, 0x37, 0x37, 0x38, 0xF8, 0x48, 0xF0, 0x52,
-    0x74, 0x45, 0x72, 0x57, 0xFC, 0x50, 0x86, 0x24, 0x5E, 0xF3, 0x83, 0x64, 0xE1, 0x3A, 0x95, 0x01,
-    0x0B, 0x24, 0xED, 0x84, 0x4A, 0xAD, 0xE8, 0x15, 0x44, 0xED, 0x28, 0x0F, 0x6F, 0xEE, 0x64, 0x04,
-    0xC4, 0x45, 0xC7, 0xDC, 0x18, 0x2E, 0x5A, 0xE5, 0x3E, 0xC8, 0xDF, 0xD5, 0x94, 0xBB, 0x97, 0x6A,
-    0x3F, 0x3A, 0xA7, 0xC5, 0x97, 0x0E, 0xF1, 0xD2, 0x12, 0x16, 0x7F, 0x74, 0xCD, 0xF1, 0xF1, 0xAC,
-    0x67, 0xDF, 0x10, 0xF9, 0x6F, 0x88, 0xFA, 0x6F, 0x88, 0xAD, 0xD7, 0x44, 0xFB, 0xC6, 0x34, 0xE3,
-    0xA8, 0xF2, 0x24, 0xAA, 0xE3, 0xF7, 0xA5, 0x9B, 0x93, 0x2F, 0x56, 0x78, 0x57, 0x63, 0xFC, 0xB6,
-    0x24, 0xD8, 0xA7, 0xC2, 0xC8, 0xB7, 0x75, 0x84, 0x2B, 0x26, 0x0A, 0x90, 0x72, 0x03, 0xEA, 0x13,
-    0x92, 0x83, 0x56, 0xA2, 0x05, 0x92, 0x3A, 0x93, 0x52, 0x8E, 0x46, 0x0A, 0xAF, 0xE9, 0x54, 0x27,
-    0x25, 0x81, 0x8F, 0x7B, 0x78, 0x2C, 0xA5, 0x0A, 0xA5, 0x43, 0x49, 0x4D, 0x3D, 0x7D, 0x41, 0x90,
-    0x68, 0xA3, 0xCF, 0x8B, 0xB3, 0xDE, 0xC3, 0xA5, 0xF8, 0xD1, 0x6B, 0xB7, 0xA5, 0xA7, 0xBD, 0xDC,
-    0xF3, 0x45, 0x6D, 0x10, 0xFE, 0xF2, 0x0F, 0xF6, 0xFB, 0x07, 0x7F, 0x45, 0x8D, 0x0E, 0xD6, 0xBF,
-    0x10, 0x04, 0xB2, 0x70, 0xDF, 0x7A, 0x15, 0x7D, 0xDB, 0x34, 0x60, 0x27, 0xD8, 0xB6, 0xE0, 0xCA,
-    0x77, 0x6E, 0x48, 0x47, 0x31, 0x2F, 0xB5, 0x4C, 0x71, 0xDC, 0x4D, 0x62, 0xD8, 0x28, 0x1F, 0x79,
-    0xCB, 0x88, 0x3B, 0xCF, 0x98, 0xA2, 0x3D, 0x23, 0x17, 0xC7, 0xE0, 0xF0, 0x10, 0x8F, 0x62, 0x0E,
-    0xB0, 0x07, 0x09, 0x3F, 0x87, 0x49, 0xC6, 0x42, 0xF9, 0x65, 0xA1, 0x24, 0xBB, 0x50, 0x0A, 0x49,
-    0x40, 0x9E, 0x76, 0x84, 0x5F, 0x59, 0xCB, 0x08, 0x52, 0xB5, 0xA1, 0x6A, 0x4F, 0xE2, 0x15, 0x4B,
-    0x37, 0x32, 0x25, 0x01, 0x5D, 0xF0, 0x50, 0x6F, 0xC2, 0xC4, 0x48, 0x96, 0x84, 0xFB, 0xA9, 0xB5,
-    0x44, 0x40, 0x8A, 0x4C, 0xAB, 0xC7, 0x94, 0x24, 0x22, 0x6F, 0xCF, 0xB2, 0x54, 0x92, 0x4C, 0x5E,
-    0x91, 0x3D, 0xE2, 0xC8, 0xEA, 0x19, 0xE6, 0xF5, 0xEE, 0xEC, 0xC6, 0xD5, 0xFC, 0x92, 0x68, 0x30,
-    0xF8, 0x21, 0x46, 0xEF, 0x6F, 0xCC, 0xFC, 0x8D, 0xE4, 0xA8, 0xAC, 0x75, 0xF2, 0x69, 0xDF, 0xF2,
-    0xD4, 0x88, 0x4F, 0xDF, 0x48, 0xDE, 0xF1, 0xE6, 0x03, 0xAC, 0x27, 0xC4, 0x3B, 0x03, 0x9B, 0xA1,
-    0x62, 0x5C, 0x60, 0x19, 0x4B, 0x10, 0x7E, 0x69, 0xB6, 0xAC, 0x70, 0xA3, 0x92, 0xE3, 0x91, 0xBA,
-    0x6D, 0xB2, 0x8B, 0x27, 0x87, 0xA7, 0x4E, 0x7A, 0xE3, 0xB2, 0x93, 0xCB, 0x53, 0x27, 0x23, 0x3F,
-    0x7D, 0x66, 0xD3, 0x4A, 0x50, 0xD4, 0x4A, 0x67, 0xF3, 0x67, 0x5A, 0xB0, 0xF9, 0x13, 0xAB, 0xE4,
-    0x98, 0x5C, 0xD7, 0xA7, 0xFD, 0xCE, 0xAF, 0xA9, 0x69, 0xDE, 0x61, 0x8D, 0x4F, 0x3D, 0x18, 0x9D,
-    0x7B, 0x50, 0xE9, 0x83, 0x65, 0xCD, 0xC9, 0xF0, 0xF1, 0x23, 0xE1, 0xC4, 0xE7, 0x39, 0x57, 0x34,
-    0xDE, 0x20, 0x47, 0x0D, 0x6D, 0x0A, 0x90, 0x54, 0xBB, 0x0B, 0x1E, 0xE0, 0xBA, 0xF3, 0xAA, 0x61,
-    0x26, 0x56, 0xE7, 0xB8, 0x89, 0x5C, 0xA4, 0x1B, 0x5B, 0x2D, 0xB7, 0x2A, 0x6A, 0xAD, 0x2E, 0xED,
-    0xC4, 0xDD, 0x78, 0xD4, 0x47, 0x38, 0xF9, 0xFC, 0xC2, 0x3E, 0x8A, 0x3F, 0xD3, 0xB0, 0xE9, 0x8F,
-    0xCD, 0x21, 0xAC, 0xA3, 0xE1, 0x08, 0x0B, 0x85, 0x6B, 0x63, 0xDA, 0xFD, 0xA6, 0x29, 0xFF, 0x3B,
-    0xAB, 0x11, 0xAA, 0xD4, 0x11, 0xE3, 0xCC, 0xB6, 0x6A, 0xA2, 0x6F, 0xCC, 0xA5, 0xD4, 0x13, 0x0B,
-    0x5F, 0xAD, 0xA4, 0x94, 0x99, 0xA3, 0xA4, 0x3F, 0xA5, 0x0D, 0x22, 0x5C, 0x43, 0x0E, 0x40, 0xD2,
-    0xBD, 0xCC, 0x30, 0xB3, 0x09, 0x08, 0x7C, 0xA9, 0x07, 0xB4, 0xC3, 0x81, 0x22, 0x79, 0xB4, 0x41,
-    0x7E, 0x13, 0xC3, 0x59, 0x7E, 0x65, 0x2C, 0x35, 0x29, 0x88, 0xDD, 0x26, 0x21, 0x05, 0xDE, 0xF8,
-    0x5C, 0x42, 0x36, 0xEC, 0x25, 0x71, 0xEE, 0x81, 0x7C, 0x7B, 0xE0, 0x8B, 0x64, 0x70, 0xC4, 0x64,
-    0xC5, 0x4D, 0xCA, 0x5B, 0x88, 0x9F, 0xA3, 0x51, 0x0E, 0xCC, 0x40, 0x93, 0xF7, 0x5F, 0x64, 0xAE,
-    0x0E, 0xAA, 0xA3, 0xA9, 0x10, 0xDA, 0xD0, 0x01, 0xD1, 0x8F, 0x30, 0xCF, 0x54, 0x19, 0x2E, 0x55,
-    0xA2, 0x54, 0x1A, 0x30, 0xCC, 0x69, 0x88, 0x39, 0xCC, 0xFE, 0x48, 0x16, 0x89, 0x79, 0x26, 0x7D,
-    0xC9, 0x01, 0x8A, 0xF8, 0xE5, 0x34, 0x6B, 0x23, 0x56, 0x0A, 0xDD, 0x0C, 0xC3, 0x67, 0xE9, 0xC2,
-    0x4D, 0xF0, 0x03, 0x6D, 0x43, 0x18, 0xC1, 0x62, 0xE8, 0x42, 0x58, 0x91, 0xF6, 0x57, 0x55, 0x3E,
-    0x00, 0x48, 0xBA, 0xAB, 0x12, 0xC1, 0x10, 0x0F, 0x3B, 0x7E, 0x49, 0xFA, 0xF8, 0xA3, 0x41, 0x01,
-    0xA9, 0x8B, 0x9E, 0x74, 0xFA, 0x82, 0x08, 0xD7, 0xF2, 0x4B, 0x0E, 0xE7, 0x50, 0x52, 0xA9, 0x0A,
-    0xE6, 0x29, 0xFA, 0xC2, 0x63, 0x60, 0x95, 0x4F, 0x0B, 0x5C, 0xC0, 0xD6, 0xB7, 0xF8, 0x25, 0x50,
-    0x22, 0x16, 0x2F, 0xC8, 0xEE, 0x07, 0xCB, 0x60, 0x1A, 0x7D, 0xA1, 0x57, 0xB9, 0x74, 0xDD, 0xD4,
-    0x2A, 0x67, 0x79, 0x12, 0x3C, 0xC8, 0xB4, 0xBA, 0xDE, 0x50, 0x12, 0x4B, 0x42, 0x14, 0x2C, 0x61,
-    0x39, 0xCF, 0x4D, 0x1E, 0x04, 0x4F, 0x96, 0x4A, 0x71, 0xB2, 0xF0, 0x97, 0x93, 0xEA, 0x7C, 0xD1,
-    0x7F, 0xCC, 0xAA, 0xF5, 0x44, 0xC3, 0x2A, 0x94, 0x1B, 0x0F, 0x0D, 0xFB, 0x02, 0x58, 0x42, 0xD1,
-    0xC6, 0x2A, 0x2C, 0xE7, 0x2D, 0x0B, 0x49, 0x69, 0x9B, 0xF6, 0xF2, 0x43, 0xC8, 0x6C, 0x58, 0x5D,
-    0xCA, 0xEA, 0x88, 0x75, 0x66, 0xAE, 0x67, 0xCA, 0xE8, 0x55, 0xCA, 0x60, 0x66, 0x31, 0x89, 0x49,
-    0x7A, 0x61, 0x9F, 0x55, 0x65, 0x75, 0x23, 0x56, 0x50, 0x49, 0x52, 0xBE, 0x98, 0x76, 0x30, 0x01,
-    0xE0, 0xD2, 0x92, 0x99, 0xD7, 0x06, 0xD9, 0x1C, 0x17, 0x16, 0x7A, 0x2D, 0x73, 0xE5, 0x19, 0x32,
-    0xB1, 0x58, 0xC0, 0x38, 0x35, 0xB2, 0x6E, 0x10, 0x60, 0xE5, 0x19, 0x01, 0xBC, 0x52, 0x46, 0xC4,
-    0x5F, 0xF9, 0xD4, 0x96, 0x2A, 0x16, 0x4D, 0xB1, 0xD2, 0xA3, 0x8E, 0xA7, 0xC2, 0x59, 0x98, 0x39,
-    0xFB, 0x89, 0x8A, 0x0E, 0x8B, 0x55, 0x2D, 0xDE, 0x55, 0xE5, 0x44, 0xBE, 0xDE, 0x15, 0xF7, 0x77,
-    0xB2, 0x76, 0xD9, 0x78, 0x25, 0xAB, 0x4A, 0x06, 0x5D, 0x59, 0x7C, 0x32, 0xAA, 0x60, 0xB0, 0x0B,
-    0x55, 0x5B, 0xB2, 0x74, 0xA6, 0x65, 0xA4, 0x47, 0x44, 0x88, 0xD6, 0x7F, 0x67, 0xDD, 0x29, 0x31,
-    0x1F, 0x6C, 0x8E, 0x89, 0x45, 0x5C, 0xBE, 0x5E, 0x3B, 0xBE, 0xF6, 0x34, 0xE0, 0x4B, 0x14, 0x48,
-    0x61, 0x26, 0x86, 0x32, 0xC0, 0x44, 0x42, 0x32, 0xAA, 0x7D, 0x28, 0x64, 0x92, 0xAA, 0xFC, 0xA0,
-    0xF4, 0x15, 0xDC, 0x81, 0xB2, 0xC3, 0x40, 0x40, 0x49, 0x2E, 0xA4, 0xA8, 0x30, 0x13, 0x09, 0xFC,
-    0x64, 0x0F, 0xAF, 0xFD, 0x7F, 0x03, 0xE9, 0x6D, 0xC3, 0xCA, 0xDE, 0xBB, 0x2A, 0xEB, 0x54, 0x2D,
-    0x23, 0x97, 0x33, 0x18, 0xAD, 0xC4, 0x40, 0x07, 0x61, 0x6E, 0x49, 0xDF, 0xE5, 0x37, 0x08, 0x43,
-    0x77, 0x86, 0xDE, 0x64, 0xB3, 0x00, 0x45, 0x62, 0x30, 0x3E, 0x65, 0xAD, 0x59, 0x67, 0xD3, 0x7A,
-    0xB0, 0xC4, 0x93, 0xC6, 0xE6, 0xD6, 0xBC, 0x68, 0x51, 0xDB, 0x67, 0x55, 0xDA, 0xE7, 0x6A, 0xF8,
-    0x90, 0x0E, 0xAF, 0xF0, 0xD5, 0x02, 0x85, 0xDD, 0xD1, 0xCA, 0x00, 0x74, 0x59, 0x9C, 0x87, 0x30,
-    0x11, 0x29, 0x44, 0x2C, 0x91, 0xAE, 0x0F, 0x55, 0x10, 0xA1, 0x2E, 0xB4, 0xB6, 0x0C, 0x73, 0xB1,
-    0xD1, 0xEA, 0x73, 0xDD, 0xC6, 0x17, 0x5A, 0x13, 0x9F, 0x28, 0xF8, 0x9A, 0x20, 0xEF, 0x7C, 0x6C,
-    0xFD, 0xAB, 0x2D, 0xF7, 0x48, 0xB6, 0x94, 0xF2, 0x86, 0x6F, 0x25, 0x28, 0x35, 0x93, 0xEC, 0xE2,
-    0x8D, 0xE3, 0xBC, 0xE3, 0x2F, 0xA7, 0xC0, 0x38, 0xA1, 0x3A, 0x60, 0xAD, 0x8A, 0xA0, 0xF0, 0x3A,
-    0x44, 0x04, 0xFC, 0x6D, 0x80, 0x1D, 0x82, 0x14, 0xFD, 0x35, 0x1D, 0x76, 0xD6, 0x85, 0xE6, 0x08,
-    0xE8, 0x20, 0x16, 0x15, 0x47, 0x6D, 0x2E, 0x33, 0xE1, 0x4C, 0x89, 0x49, 0xA2, 0xBC, 0x04, 0x2E,
-    0x79, 0xE7, 0x7C, 0x45, 0x06, 0xE6, 0xC3, 0x29, 0x90, 0xB6, 0x2D, 0x12, 0x63, 0x21, 0x2C, 0x8F,
-    0xB4, 0x9C, 0x11, 0xB1, 0xEA, 0x19, 0x13, 0xE3, 0xF5, 0x15, 0x2E, 0xBC, 0xB0, 0xEC, 0x07, 0x94,
-    0x7E, 0xF6, 0x6D, 0x21, 0x81, 0x91, 0x81, 0x1A, 0xB8, 0xBF, 0x8B, 0xD5, 0xA8, 0x9B, 0xA0, 0x43,
-    0xC8, 0x74, 0xE0, 0x3C, 0x46, 0x7A, 0x90, 0x3E, 0x9C, 0xF7, 0xB5, 0x3B, 0xA1, 0x6A, 0xC5, 0x25,
-    0xA5, 0xC6, 0xB1, 0xD6, 0x4E, 0x4D, 0xB6, 0x5A, 0x5C, 0x28, 0xB6, 0x56, 0xED, 0x67, 0x28, 0x83,
-    0x97, 0x48, 0xEB, 0x91, 0x3F, 0xE4, 0xF4, 0x7B, 0x45, 0x8D, 0xF0, 0xB2, 0xBA, 0xE6, 0xD1, 0xD7,
-    0x66, 0x82, 0x3C, 0xD5, 0x2B, 0x4A, 0x43, 0xE9, 0xCF, 0x11, 0xE0, 0x5E, 0x13, 0x18, 0xB9, 0xA7,
-    0x63, 0xF6, 0xF0, 0xCE, 0xE3, 0xE3, 0xE9, 0x04, 0xCF, 0x44, 0x3F, 0x19, 0x98, 0xED, 0xBC, 0xDA,
-    0x42, 0xAF, 0xDF, 0x78, 0x01, 0x23, 0x05, 0xC3, 0xB3, 0x24, 0x73, 0x8B, 0x08, 0x69, 0xB7, 0x8F,
-    0xB4, 0x9F, 0x04, 0x2B, 0xFF, 0xBB, 0x60, 0x5F, 0xB9, 0x8B, 0x0F, 0x06, 0xCD, 0x03, 0x69, 0x08,
-    0xA3, 0x99, 0x69, 0x37, 0x7D, 0x24, 0xDE, 0x85, 0x5C, 0xE4, 0x54, 0xB0, 0x44, 0xBB, 0x8E, 0x0A,
-    0xB4, 0x8B, 0x59, 0xCD, 0x6C, 0xCF, 0x4F, 0xDB, 0x07, 0x87, 0x0F, 0x94, 0x64, 0xD1, 0x3F, 0x0A,
-    0x1C, 0x8D, 0x06, 0x50, 0x06, 0xCB, 0x15, 0x2C, 0xC3, 0x8F, 0x7B, 0xEB, 0xB8, 0x74, 0x5B, 0x03,
-    0x26, 0xB7, 0xFE, 0x43, 0xE1, 0x3F, 0x88, 0x6C, 0x6A, 0x83, 0x7A, 0xA5, 0xDB, 0x1C, 0xA2, 0xB9,
-    0x66, 0x9F, 0x4B, 0xC2, 0x96, 0x68, 0x53, 0xC0, 0xB1, 0x42, 0x99, 0x82, 0x95, 0xA4, 0x7A, 0x71,
-    0xBE, 0x5A, 0xC5, 0xF5, 0x5C, 0x77, 0xE7, 0xD7, 0x80, 0x7C, 0x90, 0x6B, 0xD8, 0x11, 0x63, 0x44,
-    0xEC, 0x1C, 0xD9, 0x1A, 0x14, 0x2A, 0x0C, 0xCC, 0x98, 0xFA, 0xB8, 0xD5, 0x38, 0xBB, 0x1A, 0x27,
-    0x1B, 0x63, 0x54, 0x65, 0xA1, 0xB6, 0x2A, 0x7D, 0x17, 0x47, 0x8C, 0x2C, 0x6A, 0x31, 0xB8, 0xA8,
-    0x25, 0x09, 0x38, 0x1D, 0x99, 0x71, 0x5B, 0x58, 0x5F, 0xE0, 0xD4, 0xFA, 0x0F, 0xC6, 0xE0, 0x1F,
-    0x99, 0xC4, 0xDE, 0x95, 0x40, 0x92, 0x0F, 0x7A, 0xB3, 0xA4, 0xD6, 0xED, 0xEB, 0xA1, 0x66, 0xA8,
-    0x5B, 0xDD, 0xEA, 0x62, 0x3D, 0xE9, 0xB9, 0xC3, 0xEB, 0xF6, 0xF1, 0x87, 0x94, 0xCB, 0x55, 0x6A,
-    0xCF, 0xFD, 0x55, 0x91, 0x30, 0x59, 0x67, 0x5A, 0x59, 0x2A, 0xB2, 0x69, 0x49, 0x74, 0x3A, 0xA3,
-    0x32, 0x64, 0xD5, 0xCC, 0xC8, 0x2F, 0x02, 0x10, 0xCB, 0xB9, 0x56, 0x09, 0x03, 0x2B, 0x66, 0x8D,
-    0x07, 0x54, 0xD2, 0x58, 0x1A, 0xAD, 0x28, 0x6B, 0x83, 0x69, 0xD1, 0xB2, 0xAB, 0x32, 0x7D, 0x77,
-    0xC7, 0xE5, 0xB2, 0xD7, 0x92, 0xF4, 0x4A, 0xFB, 0x46, 0xB6, 0x09, 0xAD, 0x3F, 0x94, 0xB6, 0x95,
-    0x22, 0x63, 0x51, 0x9E, 0x04, 0x93, 0x9A, 0x1D, 0x73, 0x84, 0xC8, 0xCD, 0xE8, 0x15, 0xED, 0xD8,
-    0xCD, 0x94, 0x49, 0xF4, 0xB0, 0x29, 0x75, 0x10, 0xF3, 0x3F, 0x47, 0x04, 0x57, 0xE7, 0xE3, 0xB4,
-    0x70, 0xD1, 0xCF, 0xE9, 0x64, 0xC2, 0xC7, 0xA0, 0xEF, 0xFD, 0xD6, 0x59, 0x59, 0x29, 0x37, 0xC4,
-    0x33, 0x6D, 0xA5, 0x89, 0xAA, 0xF7, 0x95, 0x7B, 0xF2, 0x3F, 0xDE, 0xA7, 0x71, 0x59, 0x7F, 0xB1,
-    0xB8, 0x81, 0x14, 0x04, 0xEC, 0xB8, 0x06, 0xFF, 0x30, 0xA6, 0xCA, 0x6A, 0xE0, 0x09, 0x30, 0x1A,
-    0xA3, 0x22, 0xED, 0x01, 0xAB, 0x56, 0xC7, 0x6D, 0x31, 0x3E, 0xA6, 0x83, 0xE1, 0xA4, 0xAA, 0x36,
-    0x78, 0x34, 0x25, 0x1E, 0xE5, 0x79, 0xEC, 0x67, 0x65, 0x90, 0xD8, 0xBB, 0xFA, 0x62, 0xF4, 0x9D,
-    0x52, 0x9B, 0xAA, 0x1A, 0xBC, 0x1F, 0x94, 0x59, 0x45, 0x1F, 0xD9, 0x33, 0xB3, 0x0F, 0x20, 0xA5,
-    0x2F, 0x8E, 0x6B, 0x1E, 0x70, 0x56, 0x13, 0x34, 0xA6, 0x2C, 0x50, 0x87, 0x2D, 0x47, 0x80, 0x26,
-    0x1D, 0x60, 0x59, 0x80, 0x23, 0xB1, 0x95, 0x11, 0x4A, 0x3A, 0x1F, 0xBE, 0x9F, 0x13, 0xBC, 0xBD,
-    0x01, 0x27, 0xD5, 0xAC, 0x3F, 0x5B, 0xD9, 0x75, 0xE9, 0x33, 0x86, 0xEB, 0xDA, 0xFC, 0x22, 0x97,
-    0x83, 0x31, 0xD3, 0xCD, 0x67, 0x4A, 0x44, 0xB5, 0x40, 0xC5, 0x60, 0x3D, 0x3E, 0x09, 0xA1, 0xF8,
-    0x36, 0x89, 0x4E, 0x3E, 0x52, 0xF5, 0x77, 0x99, 0xCE, 0x6A, 0x3C, 0xB1, 0xA9, 0x93, 0x39, 0x73,
-    0xB9, 0x0A, 0xEB, 0x58, 0xF9, 0x78, 0x67, 0xC8, 0xF8, 0xC2, 0x65, 0x9F, 0x0B, 0x3F, 0x2A, 0xF7,
-    0x00, 0xC2, 0x17, 0x9B, 0x2C, 0xD1, 0x25, 0x6A, 0xEC, 0xB4, 0xF5, 0xA0, 0xCE, 0x1E, 0x1E, 0xFF,
-    0xED, 0x24, 0x70, 0xD2, 0x21, 0xD5, 0x85, 0xF7, 0x45, 0xAE, 0x0C, 0x41, 0xBD, 0xE0, 0x5D, 0xA6,
-    0x79, 0x23, 0x03, 0xD2, 0x62, 0xA9, 0x20, 0x76, 0x6C, 0xDD, 0x85, 0x76, 0x3F, 0xB9, 0x41, 0x5C,
-    0xCD, 0xA0, 0x2A, 0xB6, 0xA5, 0x29, 0x00, 0x0D, 0x41, 0xCF, 0x87, 0x13, 0xE2, 0x56, 0xE8, 0x3C,
-    0xB8, 0x17, 0x8E, 0x89, 0x9A, 0x4D, 0xEA, 0x59, 0x28, 0xD7, 0x1E, 0x23, 0xCB, 0x28, 0xB7, 0x3D,
-    0x13, 0x93, 0x0A, 0xA7, 0xEE, 0xF4, 0xBA, 0x75, 0xDF, 0x7C, 0x06, 0x47, 0xA8, 0x66, 0x30, 0xCD,
-    0xDE, 0x84, 0x66, 0x49, 0xE7, 0x3B, 0x9E, 0x82, 0x63, 0xD6, 0xCB, 0x2B, 0x7C, 0x97, 0xAE, 0xF2,
-    0x8D, 0xC1, 0x13, 0x77, 0x36, 0xCC, 0xAF, 0x31, 0x84, 0x86, 0x01, 0x72, 0x28, 0x66, 0xA3, 0xE4,
-    0xB2, 0x3D, 0x1A, 0xFA, 0xDB, 0x05, 0xF8, 0x4A, 0xDB, 0x92, 0xC0, 0x11, 0xFD, 0x68, 0x89, 0x7F,
-    0xBA, 0xB0, 0x09, 0x39, 0x91, 0x4E, 0xFB, 0xC1, 0x0B, 0xDF, 0x3E, 0x9C, 0x6C, 0xFE, 0xF3, 0x03,
-    0x15, 0x67, 0xA4, 0xF1, 0x89, 0x83, 0xFA, 0x8C, 0x01, 0x9F, 0xF6, 0xE4, 0xFE, 0x6F, 0x56, 0x7D,
-    0xF4, 0x7F, 0x5B, 0x75, 0x7E, 0x71, 0x98, 0xE7, 0x4E, 0xCF, 0x18, 0xE0, 0x85, 0x52, 0x7B, 0x43,
-    0xD6, 0x56, 0x0B, 0xA6, 0x18, 0xBF, 0xA0, 0x41, 0x40, 0x0B, 0x63, 0xB8, 0x09, 0x37, 0x41, 0x97,
-    0xB3, 0xB6, 0xC0, 0x3C, 0x70, 0x35, 0x05, 0xBE, 0x26, 0xDC, 0x64, 0x33, 0x03, 0x43, 0xE3, 0x8E,
-    0x02, 0xB3, 0x47, 0x23, 0x86, 0xCD, 0xEE, 0xF7, 0xBE, 0xA1, 0x2A, 0x89, 0xEB, 0xF5, 0xF0, 0x18,
-    0xAF, 0x67, 0xDC, 0x8B, 0x30, 0xB7, 0xA6, 0x2E, 0xBA, 0x74, 0x80, 0x0D, 0xDE, 0x25, 0xD7, 0xF3,
-    0xFA, 0x32, 0x1B, 0x31, 0x85, 0x30, 0x0B, 0xE2, 0xEE, 0xCB, 0xF0, 0x76, 0x82, 0xA1, 0x8D, 0x76,
-    0xE5, 0xF8, 0x86, 0x47, 0xC1, 0x25, 0x64, 0xEC, 0x35, 0x24, 0x6A, 0x85, 0x8C, 0x16, 0xCD, 0xD4,
-    0x28, 0xC3, 0xD4, 0x6B, 0x0B, 0xF3, 0xFA, 0xFB, 0xFE, 0xB7, 0x67, 0x77, 0x32, 0x7E, 0xB1, 0x6A,
-    0xA7, 0x9B, 0x45, 0xBA, 0xCE, 0xD9, 0x1A, 0xAE, 0x33, 0xFC, 0x75, 0x21, 0xF0, 0x7C, 0xCD, 0x3D,
-    0xE3, 0xE1, 0x84, 0xDA, 0x4D, 0x6A, 0xB4, 0x04, 0x5F, 0xDD, 0x6D, 0xA9, 0xB1, 0x0C, 0x53, 0x01,
-    0x42, 0xCD, 0x64, 0xC5, 0x08, 0xF5, 0x96, 0xB3, 0xF6, 0x0A, 0x0C, 0xE5, 0x9B, 0x70, 0xE5, 0xF9,
-    0x1F, 0x10, 0x7D, 0x64, 0xEF, 0xE1, 0x70, 0x13, 0x60, 0xE3, 0x88, 0x0D, 0xEE, 0xA6, 0x07, 0x21,
-    0xCA, 0x77, 0xE0, 0xE1, 0x67, 0x46, 0xA9, 0x49, 0xF5, 0x4D, 0x01, 0x5E, 0x36, 0xF3, 0x06, 0x0C,
-    0x9C, 0xB0, 0x21, 0x85, 0x94, 0x8E, 0xF5, 0xCE, 0x94, 0x76, 0x92, 0x2D, 0x5F, 0x9B, 0xAC, 0x7E,
-    0x54, 0xDC, 0x80, 0xA9, 0x3C, 0x63, 0x90, 0xFA, 0x06, 0x4B, 0x02, 0x3D, 0xC2, 0x45, 0x9B, 0xFF,
-    0xF3, 0x29, 0x4C, 0xE1, 0x59, 0xCE, 0x7F, 0x6A, 0xA4, 0xE5, 0xE7, 0xFA, 0xB7, 0xF2, 0xFB, 0x0A,
-    0x87, 0xEC, 0xD4, 0xC2, 0x86, 0xDF, 0x28, 0xBA, 0xA4, 0x67, 0x67, 0x96, 0x23, 0x72, 0x5D, 0x97,
-    0xF7, 0xED, 0x7F, 0x38, 0xB2, 0x8E, 0x62, 0xE0, 0x12, 0xBF, 0x72, 0xAE, 0xD7, 0x77, 0xD6, 0x35,
-    0x3F, 0xEB, 0x7E, 0x57, 0x34, 0xBE, 0x9C, 0xB5, 0x22, 0x44, 0x3C, 0xBF, 0x47, 0x28, 0x63, 0xD9,
-    0x10, 0x1E, 0x82, 0x95, 0xC2, 0x9A, 0x80, 0xA0, 0x0B, 0xB5, 0xD5, 0x46, 0x79, 0x9C, 0x9A, 0x23,
-    0x6C, 0x10, 0x94, 0x42, 0x05, 0x82, 0x0D, 0xDC, 0xF5, 0xC2, 0x2B, 0xC9, 0x69, 0x90, 0x75, 0xC9,
-    0xFB, 0x5F, 0xBE, 0x3F, 0xA5, 0xF7, 0xDF, 0x1D, 0xD6, 0xF5, 0x9D, 0x75, 0xC8, 0xD7, 0xAE, 0x82,
-    0x0F, 0xA8, 0xE1, 0x22, 0x2E, 0x59, 0xEA, 0x73, 0x03, 0xE0, 0x8F, 0x70, 0xE5, 0x03, 0x70, 0xD3,
-    0x2D, 0x50, 0xE0, 0x53, 0x8C, 0xB1, 0x24, 0x5D, 0x38, 0x21, 0xF9, 0x1A, 0x73, 0xE8, 0x49, 0xF1,
-    0xFB, 0x90, 0x1F, 0xE4, 0x55, 0xB1, 0x1D, 0x73, 0x6B, 0x1F, 0xDD, 0x9F, 0x05, 0x03, 0xFE, 0x8E,
-    0xAD, 0x27, 0x30, 0xB1, 0x63, 0xF9, 0x26, 0x62, 0x69, 0xFD, 0xF2, 0x85, 0xA8, 0xE3, 0x23, 0xB5,
-    0xB0, 0x9B, 0x4B, 0x1F, 0x2F, 0xB6, 0x83, 0x60, 0xD8, 0x64, 0x6D, 0xC6, 0xB0, 0x61, 0x2F, 0x0F,
-    0xBE, 0xBC, 0x3F, 0x0D, 0xD6, 0xC3, 0xD2, 0x8A, 0x4F, 0x5B, 0x3D, 0x6E, 0xCB, 0x47, 0x6C, 0xC7,
-    0xC8, 0x86, 0xE6, 0x2C, 0xCD, 0xF7, 0x95, 0x13, 0xEF, 0xA4, 0x2F, 0x0E, 0xEB, 0xA7, 0x32, 0x2F,
-    0xEE, 0x87, 0x88, 0x2E, 0x0E, 0xE1, 0xCE, 0x0F, 0xD1, 0xBB, 0x33, 0x50, 0xF8, 0x14, 0x65, 0xE7,
-    0xCE, 0x19, 0x92, 0x49, 0x3B, 0x4D, 0x5F, 0x18, 0x79, 0xB6, 0x4E, 0x2A, 0xE4, 0xD6, 0x7B, 0x79,
-    0x1B, 0x8B, 0x08, 0x54, 0x4E, 0x0E, 0xD6, 0x3B, 0xD0, 0x5F, 0x68, 0xCC, 0x74, 0x6D, 0xEB, 0x0A,
-    0x9C, 0xCA, 0x37, 0x14, 0x92, 0x3F, 0xF4, 0x4C, 0xFB, 0x98, 0xE4, 0x51, 0x66, 0xAB, 0xDC, 0xBD,
-    0xD3, 0x88, 0x85, 0x16, 0x89, 0x0D, 0x9E, 0x3E, 0x38, 0xA3, 0xDA, 0x68, 0x0A, 0x6D, 0xCA, 0x42,
-    0xC0, 0xBB, 0x51, 0x1F, 0x61, 0x79, 0x1D, 0xC6, 0x90, 0xEC, 0x5C, 0x6E, 0x09, 0xC3, 0x5A, 0x73,
-    0xB1, 0xA9, 0x2A, 0x04, 0x56, 0xA1, 0x07, 0x11, 0x88, 0xFB, 0x07, 0x8B, 0x35, 0xB6, 0xF6, 0xB9,
-    0xE5, 0x15, 0xAB, 0xD4, 0x6B, 0xF7, 0x5D, 0x63, 0x79, 0x30, 0x31, 0x94, 0x75, 0x08, 0xBB, 0x6D,
-    0xC6, 0xE0, 0xDC, 0x36, 0x90, 0x72, 0x33, 0xD0, 0x78, 0x08, 0xBE, 0x0F, 0xB1, 0x10, 0x10, 0xCC,
-    0x09, 0x88, 0x28, 0xD2, 0x5F, 0xCC, 0x2E, 0xFB, 0x47, 0x30, 0x27, 0xF9, 0x80, 0x5B, 0xB5, 0x9E,
-    0x74, 0x78, 0x16, 0x76, 0x35, 0x31, 0xA3, 0x58, 0xE8, 0x59, 0x70, 0x65, 0x07, 0x91, 0xB0, 0x32,
-    0xDE, 0x33, 0xA7, 0x19, 0x69, 0x4F, 0x42, 0x03, 0x55, 0x00, 0xFB, 0xCC, 0xBF, 0x75, 0x0F, 0xD0,
-    0xEB, 0x67, 0xC3, 0x44, 0xBB, 0xA9, 0x08, 0xC4, 0xD8, 0x07, 0xEB, 0x37, 0xF2, 0x28, 0x0A, 0xC0,
-    0x8D, 0x94, 0x99, 0x88, 0xD1, 0xB2, 0xBD, 0x5E, 0xAB, 0x81, 0x3B, 0x56, 0x0D, 0x98, 0xB2, 0x73,
-    0xCF, 0x94, 0x17, 0x49, 0x94, 0x90, 0x40, 0x6F, 0x8D, 0x0E, 0x7E, 0xBE, 0x1C, 0x4C, 0x9F, 0x4B,
-    0x3E, 0x1A, 0xF3, 0xB5, 0x6E, 0xD8, 0x7F, 0x72, 0xE7, 0x1A, 0x98, 0x5A, 0x2A, 0x23, 0x6F, 0xB4,
-    0x6F, 0x36, 0x7F, 0x7C, 0x7F, 0xD3, 0x7D, 0xFA, 0xBB, 0x1E, 0x92, 0xAA, 0x2D, 0x2A, 0xC6, 0x88,
-    0x45, 0x52, 0xE0, 0x65, 0x33, 0x6C, 0x31, 0xA8, 0xDA, 0xD4, 0x56, 0xA3, 0x17, 0x1B, 0x1F, 0x93,
-    0x61, 0xD3, 0xB4, 0x79, 0xFF, 0xF0, 0xC7, 0xFF, 0x22, 0x0C, 0xAD, 0x41, 0x47, 0xF6, 0xD6, 0xCE,
-    0x09, 0xB9, 0x69, 0x33, 0xA0, 0x85, 0x7E, 0x95, 0x03, 0xE2, 0x3D, 0x21, 0x5F, 0x99, 0x7E, 0xE5,
-    0x69, 0x99, 0x80, 0x0C, 0xE0, 0x54, 0x64, 0x1D, 0x3C, 0x70, 0xE9, 0x3F, 0x40, 0x4E, 0x55, 0xF1,
-    0xE1, 0x10, 0x3E, 0x19, 0xE1, 0xD4, 0x17, 0x90, 0x58, 0xF4, 0x21, 0xDD, 0x74, 0x4A, 0x47, 0xBE,
-    0xE0, 0x61, 0xF0, 0x7B, 0xBA, 0x32, 0x33, 0x80, 0xB0, 0x5F, 0xD3, 0x11, 0x92, 0x22, 0x59, 0x65,
-    0xC5, 0x2A, 0x65, 0xDD, 0xA3, 0x08, 0x58, 0x52, 0x82, 0x02, 0x22, 0x1C, 0xAC, 0x0F, 0x80, 0xF0,
-    0xD7, 0x91, 0x4D, 0x95, 0xDA, 0x3C, 0x7C, 0x50, 0xE6, 0x6B, 0xBC, 0x0E, 0x87, 0x6A, 0x15, 0xCD,
-    0x4C, 0x36, 0xD9, 0xAB, 0x56, 0xC8, 0x8A, 0xA9, 0xE5, 0x69, 0x67, 0x5B, 0x43, 0xFD, 0xD9, 0x8A,
-    0x2B, 0x5C, 0xB6, 0xB3, 0x5F, 0xDE, 0xBD, 0x58, 0xFC, 0xF5, 0xBD, 0x75, 0x28, 0x26, 0x80, 0x24,
-    0x38, 0xAA, 0xE0, 0x6D, 0x97, 0xDC, 0x72, 0x7F, 0x5A, 0x16, 0x00, 0x7D, 0x03, 0x52, 0xC7, 0x6A,
-    0xC5, 0x64, 0x70, 0xD4, 0xEE, 0x28, 0xFD, 0xD9, 0x58, 0xDD, 0xE9, 0x41, 0x59, 0x38, 0x4E, 0x9C,
-    0x68, 0x8A, 0x7E, 0x39, 0x60, 0x90, 0x65, 0x88, 0x9E, 0x10, 0x80, 0x13, 0x79, 0x11, 0xAB, 0xAF,
-    0x35, 0x70, 0x9D, 0x74, 0x26, 0xA1, 0xED, 0x01, 0x3D, 0xA5, 0x83, 0x75, 0xE3, 0xF0, 0x50, 0xA5,
-    0x5E, 0x4C, 0x4B, 0x7B, 0x54, 0x17, 0x66, 0x36, 0x55, 0x71, 0xD3, 0x33, 0x2C, 0x95, 0x60, 0x8D,
-    0x2F, 0x64, 0xAD, 0x54, 0x68, 0xD6, 0x4D, 0x08, 0x5B, 0x60, 0xEC, 0xC2, 0x9D, 0x81, 0xBC, 0x69,
-    0x83, 0xDF, 0xDC, 0x26, 0x49, 0x3A, 0xC1, 0x8C, 0x21, 0x59, 0x6B, 0x92, 0x88, 0xBC, 0xA1, 0x5F,
-    0x80, 0xDC, 0x4E, 0x0B, 0xBA, 0xE4, 0xF7, 0x99, 0xEE, 0x2C, 0x03, 0x78, 0x9C, 0x32, 0x9E, 0x72,
-    0xEB, 0x92, 0xB2, 0xB1, 0x8A, 0x60, 0x8E, 0x9D, 0xED, 0xD6, 0x2A, 0x32, 0xD2, 0xDB, 0x40, 0x94,
-    0xE5, 0x75, 0x09, 0xFE, 0x8F, 0x2F, 0x32, 0xB2, 0xBF, 0xFE, 0x03, 0x1A, 0xC3, 0x40, 0x5F, 0x3F,
-    0x31, 0xAA, 0x2D, 0xFB, 0x2D, 0x5B, 0x37, 0x1E, 0x58, 0x55, 0x4E, 0x3D, 0xFD, 0xBC, 0x4F, 0x99,
-    0x71, 0xA6, 0x03, 0xD7, 0xD0, 0xB2, 0x61, 0x84, 0x9B, 0xC3, 0x29, 0x27, 0xB4, 0x5E, 0xB8, 0x07,
-    0x8A, 0x79, 0x1B, 0xE2, 0x57, 0x44, 0xB3, 0xCA, 0x30, 0xA6, 0x5B, 0x62, 0x66, 0x39, 0xE4, 0x43,
-    0x5D, 0xB4, 0xCC, 0xEB, 0xFF, 0x0D, 0xAA, 0x24, 0x87, 0xAB, 0x8A, 0x82, 0xA6, 0xC0, 0xC2, 0x38,
-    0x31, 0xA2, 0x39, 0xE8, 0x5D, 0x12, 0x5E, 0x3C, 0xCA, 0xDF, 0xC2, 0xC3, 0x27, 0x27, 0x04, 0xA5,
-    0xF3, 0xA8, 0xAE, 0x60, 0x47, 0xA5, 0x5E, 0xEB, 0x40, 0x9B, 0x1A, 0x70, 0x26, 0x14, 0x40, 0xB0,
-    0x96, 0x98, 0x21, 0x06, 0x45, 0x62, 0x2A, 0x00, 0xA6, 0xC3, 0x92, 0xF3, 0xD6, 0x97, 0x38, 0xD2,
-    0x9E, 0xAA, 0x8C, 0x98, 0xBC, 0xDB, 0x9A, 0x3A, 0x8A, 0xCA, 0xD0, 0xB1, 0x6B, 0x7B, 0xFF, 0xAC,
-    0x4D, 0x61, 0xDE, 0xDA, 0xCD, 0x2D, 0xFB, 0xF2, 0xCA, 0x6D, 0xE7, 0x77, 0x10, 0xB9, 0xE7, 0x8F,
-    0xFF, 0xC6, 0x2A, 0x2D, 0x00, 0x34, 0x31, 0xD5, 0x51, 0x81, 0xA3, 0xAA, 0x9B, 0x51, 0x5E, 0x87,
-    0xCD, 0xA5, 0x9E, 0x93, 0x77, 0x98, 0x35, 0xA5, 0x38, 0xB2, 0x56, 0xFD, 0x75, 0xEE, 0x9E, 0xE2,
-    0x2E, 0x86, 0x86, 0x86, 0xBA, 0x52, 0x22, 0xB4, 0x07, 0x1A, 0x45, 0x99, 0x9F, 0x00, 0x7B, 0x4F,
-    0x50, 0x1A, 0x0E, 0x97, 0xAF, 0xEF, 0x60, 0x08, 0x46, 0x49, 0x77, 0x4D, 0x7B, 0xD6, 0xCE, 0x70,
-    0xCB, 0x39, 0xF0, 0x32, 0xF8, 0x9D, 0x6A, 0x09, 0x63, 0xD7, 0xC1, 0xF1, 0x31, 0xB9, 0xF7, 0x8D,
-    0x62, 0x8D, 0x96, 0x62, 0x4D, 0x31, 0x24, 0x32, 0xB8, 0xA3, 0xE2, 0xBA, 0x3B, 0xC1, 0x20, 0xF3,
-    0x60, 0x85, 0x12, 0xD9, 0xB3, 0x35, 0x6E, 0xD4, 0x44, 0xDC, 0xD9, 0x50, 0xDB, 0xEE, 0xCB, 0xD4,
-    0xEF, 0xBC, 0xA4, 0x63, 0x31, 0x5F, 0x04, 0x9C, 0x92, 0x2B, 0xAB, 0x00, 0xE9, 0x37, 0x41, 0xCE,
-    0xE7, 0x19, 0xB5, 0x78, 0x59, 0xF5, 0xB4, 0xCE, 0xB0, 0x23, 0x13, 0x44, 0x6E, 0xE5, 0xE0, 0xB9,
-    0xEA, 0xE5, 0xD2, 0xCD, 0x59, 0x19, 0x0D, 0x4D, 0x99, 0x7D, 0x6B, 0x7D, 0x38, 0xB1, 0x69, 0x14,
-    0x32, 0x5C, 0x5C, 0xF6, 0xDB, 0x5F, 0xEE, 0xCA, 0x53, 0x71, 0x65, 0x98, 0x21, 0x7E, 0x74, 0x08,
-    0x29, 0x3C, 0x61, 0x5C, 0x58, 0x6C, 0x7A, 0xA5, 0xBC, 0x72, 0x61, 0xAC, 0x92, 0x8F, 0x92, 0x09,
-    0x49, 0x3C, 0xB5, 0xCB, 0xB3, 0xFB, 0x52, 0xD6, 0x66, 0x2F, 0xCF, 0xC9, 0xC0, 0x0A, 0xA5, 0x0A,
-    0x48, 0xA5, 0x0C, 0xF7, 0x18, 0x11, 0x84, 0xF3, 0xA4, 0x03, 0x7D, 0x93, 0xFC, 0x72, 0xE6, 0xFD,
-    0xB1, 0xF0, 0x8C, 0x9D, 0xF2, 0x76, 0xC6, 0x11, 0x73, 0x9A, 0xD8, 0x76, 0x2A, 0x9C, 0xFC, 0x16,
-    0xAC, 0x53, 0xFA, 0x7A, 0x00, 0x9F, 0x0F, 0x69, 0x10, 0x27, 0xBB, 0x2F, 0xA6, 0x7D, 0x9E, 0xBD,
-    0xD9, 0x12, 0xD2, 0x8C, 0x88, 0x37, 0xB4, 0x27, 0x01, 0xCC, 0xCB, 0xAC, 0xF5, 0x04, 0xDF, 0x75,
-    0x71, 0x07, 0x3D, 0x2D, 0x7E, 0xCC, 0x2D, 0x12, 0x75, 0xD5, 0x06, 0xAC, 0x7A, 0x45, 0x23, 0x4D,
-    0xAA, 0x93, 0x03, 0x4A, 0xE9, 0xE8, 0xB8, 0x2B, 0x12, 0x84, 0x54, 0xCC, 0x08, 0xA9, 0x98, 0x59,
-    0x6D, 0xB5, 0x87, 0x82, 0x41, 0x79, 0x3A, 0x62, 0xD1, 0x9A, 0x22, 0x58, 0xB7, 0x9D, 0x72, 0xCD,
-    0x7E, 0xA3, 0x34, 0xBF, 0xDC, 0x76, 0x80, 0xA4, 0x27, 0x40, 0xE7, 0x29, 0x7C, 0xD7, 0xFD, 0x95,
-    0xEA, 0x9B, 0x8E, 0xDC, 0x87, 0xD7, 0x12, 0x91, 0x72, 0x6D, 0x15, 0xCB, 0x73, 0x74, 0x7C, 0x90,
-    0x66, 0x53, 0xCB, 0xE7, 0xC9, 0xC1, 0xE6, 0x2D, 0x96, 0xC2, 0x75, 0x61, 0xE8, 0x82, 0x9D, 0xC4,
-    0x0F, 0x5B, 0x16, 0x6D, 0x82, 0x8F, 0xC6, 0x94, 0xD6, 0x30, 0x9D, 0x60, 0xFE, 0x70, 0x7C, 0x23,
-    0xFB, 0x36, 0x24, 0x77, 0x72, 0x35, 0xFE, 0x09, 0x2B, 0x75, 0x95, 0x7B, 0xA4, 0x8D, 0x26, 0x4A,
-    0xB5, 0xE1, 0x6F, 0xB4, 0x47, 0xAE, 0xB2, 0x9A, 0x4A, 0x5A, 0xBA, 0xF1, 0x5C, 0x50, 0x42, 0x56,
-    0x73, 0xD0, 0xB3, 0xBA, 0xB6, 0x76, 0xE0, 0x78, 0xBA, 0x96, 0x6F, 0xAF, 0x6E, 0xFD, 0x13, 0xC4,
-    0x7C, 0x6A, 0x48, 0xB4, 0x63, 0x32, 0x95, 0xFC, 0xE7, 0xB0, 0x95, 0xE1, 0x7C, 0xEE, 0xAE, 0x18,
-    0x6F, 0x49, 0x6D, 0x3A, 0xED, 0xAB, 0x9B, 0xF1, 0x7B, 0xBC, 0xEF, 0xAA, 0x36, 0xD2, 0x0E, 0x10,
-    0xFB, 0xE7, 0x91, 0xBC, 0x07, 0xE5, 0x8A, 0x80, 0x09, 0xDF, 0x56, 0xC3, 0x03, 0x63, 0xED, 0x70,
-    0xAB, 0x97, 0x6C, 0x2F, 0x0B, 0x58, 0x12, 0xF6, 0x2C, 0x4F, 0x90, 0x0B, 0xAA, 0xAD, 0x04, 0x4D,
-    0xA9, 0x6D, 0x75, 0xB5, 0x0A, 0x50, 0xAD, 0x2F, 0x9B, 0xEC, 0xD4, 0x75, 0x52, 0x3F, 0xD9, 0x4A,
-    0xFF, 0x91, 0xF6, 0x11, 0x27, 0x9A, 0x85, 0x7B, 0xD2, 0xA3, 0x21, 0x97, 0x3D, 0x5D, 0xD5, 0xF1,
-    0xAE, 0x8E, 0xAA, 0x83, 0x88, 0xEC, 0xE8, 0x97, 0xED, 0xBE, 0x0C, 0x1B, 0x9D, 0x6B, 0xF8, 0x1B,
-    0xF2, 0x4B, 0xDB, 0x3D, 0x9E, 0x53, 0x85, 0xED, 0xEA, 0x1D, 0x45, 0x58, 0x05, 0xA5, 0xC2, 0x52,
-    0x66, 0xDB, 0x8E, 0xF0, 0xF5, 0x32, 0x44, 0x34, 0xA9, 0x4F, 0xE2, 0x75, 0x7D, 0xB5, 0x3B, 0x6D,
-    0xD6, 0x5D, 0x5A, 0x5F, 0x59, 0xC0, 0xC8, 0xBC, 0x3D, 0x30, 0x03, 0x9E, 0x7C, 0xD4, 0xD6, 0x66,
-    0xE1, 0x71, 0xDB, 0xC4, 0xEC, 0xF7, 0x2C, 0xFB, 0x5A, 0xAA, 0x1B, 0x8A, 0xE5, 0x5A, 0xFE, 0x0A,
-    0xF3, 0xEA, 0x19, 0x39, 0x76, 0xD2, 0xDE, 0x50, 0xF3, 0xD2, 0x87, 0x03, 0x5A, 0x34, 0xCC, 0x30,
-    0xFF, 0x27, 0x19, 0xCA, 0xB4, 0xB7, 0xAF, 0xBC, 0x54, 0x8E, 0xB8, 0x7D, 0x98, 0xEB, 0x28, 0x94,
-    0x2C, 0x9A, 0xE7, 0x94, 0x21, 0xAF, 0xFE, 0x7C, 0x79, 0xEE, 0xB2, 0xF5, 0x76, 0xCC, 0x0A, 0xED,
-    0xF2, 0x91, 0xE5, 0x97, 0x27, 0x06, 0x5B, 0x1B, 0xD6, 0x92, 0x5B, 0x6E, 0x0B, 0x55, 0xA2, 0x15,
-    0x2A, 0x96, 0x14, 0x6C, 0xF4, 0xC4, 0x1D, 0x27, 0x9A, 0x54, 0x4F, 0xAC, 0xDD, 0x4D, 0xE6, 0xD8,
-    0xBA, 0x14, 0x9C, 0xBB, 0xD4, 0x33, 0x3D, 0x3D, 0xF1, 0x97, 0xAE, 0xF2, 0x12, 0xB7, 0x1C, 0x6F,
-    0x97, 0x4A, 0x5C, 0x8A, 0xFC, 0x25, 0x77, 0x7B, 0xFB, 0x3F, 0x1B, 0xEA, 0x03, 0x01, 0x09, 0xCD,
-    0x06, 0x6F, 0x48, 0x23, 0x73, 0xDC, 0x13, 0xA3, 0x2E, 0x3D, 0xFB, 0x7A, 0xFE, 0xAC, 0xCF, 0xD2,
-    0x57, 0x5F, 0xB3, 0xDA, 0x89, 0x70, 0xF2, 0x88, 0x69, 0xF1, 0x74, 0xF1, 0x26, 0xE6, 0xEA, 0x7E,
-    0xD0, 0x23, 0xCB, 0xAD, 0x79, 0xE5, 0x48, 0xFB, 0x7B, 0xB8, 0xAB, 0x8A, 0x7B, 0xBC, 0xF8, 0xDF,
-    0x13, 0xC2, 0x47, 0x2E, 0x7C, 0x19, 0xE1, 0xEF, 0x26, 0xA0, 0x78, 0xFA, 0xDE, 0xD8, 0xAC, 0xD3,
-    0x5D, 0xC0, 0xA4, 0xA8, 0xB6, 0x1A, 0x8A, 0x73, 0xFF, 0x05, 0xDD, 0x5B, 0x3D, 0x90, 0xDD, 0xD6,
-    0x75, 0xBE, 0x00, 0xB8, 0x0B, 0x67, 0x10, 0x19, 0xCC, 0x0C, 0xE9, 0x58, 0x61, 0x22, 0xA4, 0xC9,
-    0x8C, 0xAD, 0x48, 0x44, 0x0A, 0x17, 0x29, 0x48, 0x02, 0x96, 0x67, 0xA2, 0xC2, 0x85, 0x58, 0x70,
-    0xE5, 0x19, 0xB3, 0x50, 0x8A, 0x14, 0xB1, 0x26, 0x33, 0x4C, 0x91, 0x82, 0x05, 0x49, 0x40, 0x6A,
-    0x54, 0xA4, 0xE0, 0x16, 0x89, 0x53, 0xB8, 0x08, 0x0B, 0x16, 0xF6, 0x6A, 0x26, 0x72, 0x66, 0x58,
-    0x70, 0x26, 0xDC, 0x05, 0x24, 0x16, 0x2C, 0x54, 0x18, 0x32, 0xC7, 0xE3, 0x52, 0x90, 0x25, 0x67,
-    0xC6, 0x51, 0x41, 0x48, 0x41, 0x4C, 0xAC, 0x04, 0xE0, 0xE6, 0xFB, 0xCE, 0xB9, 0xEF, 0xBD, 0x7D,
-    0xDC, 0xA5, 0xCB, 0x28, 0xE2, 0x9B, 0x5D, 0xBC, 0x5D, 0x3C, 0xE0, 0xE2, 0xFC, 0xDD, 0xEF, 0x7C,
-    0xE7, 0xDC, 0xFB, 0x8C, 0x31, 0x26, 0xAE, 0x8D, 0x35, 0xE1, 0x68, 0x92, 0xD6, 0x7C, 0xD3, 0xE8,
-    0xCB, 0xCB, 0xCD, 0x69, 0x63, 0x7A, 0x13, 0x34, 0x26, 0x31, 0xE6, 0x8A, 0xF1, 0x3B, 0x5E, 0x75,
-    0xCE, 0x78, 0xBD, 0x89, 0x1A, 0x93, 0x19, 0x6F, 0x34, 0x51, 0x67, 0xB2, 0xD2, 0x4C, 0xF2, 0x5E,
-    0x9B, 0xD9, 0x44, 0x3D, 0xFF, 0xBF, 0x69, 0x16, 0x2F, 0x5C, 0x6F, 0xCC, 0x80, 0xDF, 0x24, 0x37,
-    0xBC, 0xDF, 0xE0, 0x36, 0x63, 0x82, 0x16, 0x87, 0xB3, 0x3C, 0xBB, 0x6F, 0x4C, 0x61, 0x27, 0x93,
-    0x5A, 0xDB, 0xC6, 0xFB, 0x9F, 0xCD, 0xC1, 0x98, 0x78, 0x75, 0xE5, 0xF1, 0x39, 0xA7, 0x8D, 0x3F,
-    0xE0, 0xC1, 0x59, 0x7E, 0xC6, 0x84, 0x5D, 0x58, 0x9B, 0xCA, 0xDC, 0x36, 0x51, 0x1B, 0xE7, 0x78,
-    0x08, 0x3E, 0xEE, 0x20, 0x50, 0xE5, 0xB7, 0x26, 0x1C, 0xCE, 0x99, 0x7F, 0xC8, 0xEE, 0x37, 0xE9,
-    0x0B, 0x76, 0xBA, 0xD4, 0xC6, 0xD6, 0xF6, 0x18, 0x0B, 0xCF, 0x4B, 0x3F, 0xC2, 0xE8, 0x7C, 0x1C,
-    0xAE, 0xD3, 0xE7, 0x9E, 0xE3, 0x73, 0x1B, 0x43, 0x3D, 0x8C, 0x89, 0x16, 0x62, 0x2D, 0x5E, 0x1B,
-    0x3C, 0xF8, 0xB8, 0x1B, 0xB7, 0xDA, 0x11, 0xC7, 0xEA, 0xCD, 0xD9, 0x50, 0x41, 0x8B, 0xBB, 0x3A,
-    0x3C, 0x1C, 0xCF, 0x36, 0xD7, 0x44, 0x9F, 0xCB, 0x18, 0x94, 0xB7, 0x53, 0x51, 0x1E, 0x73, 0x1E,
-    0x2B, 0x19, 0xC5, 0xF2, 0x50, 0x58, 0x0E, 0x60, 0x2D, 0xC5, 0xF8, 0xDE, 0xB4, 0x75, 0x1E, 0x03,
-    0x70, 0x40, 0x13, 0xC8, 0xF3, 0x42, 0x3E, 0x82, 0xE6, 0xA2, 0x71, 0x68, 0x06, 0x37, 0x58, 0xCA,
-    0xC1, 0x9E, 0x2E, 0x8C, 0xF9, 0x5A, 0x9D, 0xE1, 0x5E, 0xAB, 0xC7, 0x32, 0x6B, 0x2F, 0x5A, 0x4B,
-    0x2F, 0x98, 0xF3, 0x2A, 0xE8, 0x71, 0xC3, 0x9B, 0x6E, 0xFB, 0x43, 0x34, 0xBF, 0x30, 0x98, 0xBD,
-    0xCA, 0x3E, 0x80, 0x73, 0xE6, 0xB7, 0x66, 0x8E, 0xE6, 0xE3, 0x39, 0x49, 0x69, 0x46, 0x31, 0xF2,
-    0x28, 0x2A, 0xE3, 0x78, 0x55, 0x8E, 0xBB, 0xC6, 0x1B, 0x78, 0x84, 0x32, 0xA6, 0x90, 0x27, 0xDB,
-    0xF7, 0xAA, 0xC6, 0x44, 0x96, 0x26, 0xCB, 0x5E, 0xB4, 0xED, 0x2E, 0x2E, 0x3C, 0x89, 0x5B, 0x8E,
-    0x63, 0xF8, 0x63, 0x26, 0xB3, 0xA3, 0x67, 0xED, 0x75, 0x3B, 0x9B, 0x0A, 0xD7, 0xED, 0x9B, 0x4D,
-    0x5B, 0xC2, 0xB5, 0xB8, 0xD3, 0x9B, 0x45, 0x65, 0x38, 0x1B, 0xEA, 0x43, 0x99, 0x14, 0xD2, 0xCF,
-    0xA2, 0x43, 0x5A, 0xC7, 0x0D, 0xF5, 0x13, 0xAD, 0x66, 0x6A, 0x98, 0xDA, 0x7B, 0x30, 0x42, 0x64,
-    0x1F, 0xD2, 0x20, 0x5B, 0xD5, 0xFE, 0x05, 0x6A, 0x4B, 0x5B, 0x9C, 0x84, 0x5D, 0x70, 0x37, 0x9E,
-    0xDD, 0x19, 0x4F, 0x2D, 0xE5, 0xCC, 0xA0, 0x86, 0x51, 0x83, 0x61, 0xDC, 0x95, 0x81, 0x8B, 0x5F,
-    0x8B, 0x83, 0x2C, 0x06, 0xF7, 0xAC, 0xF8, 0xC9, 0xF8, 0x3D, 0xDD, 0x91, 0xD1, 0x91, 0x61, 0x63,
-    0x52, 0xAA, 0x09, 0xED, 0xE2, 0x12, 0x8A, 0x68, 0xA4, 0x66, 0x4B, 0xAB, 0x1D, 0x78, 0xF9, 0x37,
-    0xD6, 0x83, 0x98, 0x77, 0xB5, 0x0C, 0x4F, 0xB1, 0x8D, 0x7C, 0xB4, 0x8A, 0xDF, 0x68, 0xA6, 0x16,
-    0x9D, 0x29, 0x2E, 0xCE, 0x18, 0x35, 0x2B, 0x0B, 0x13, 0xB6, 0x50, 0xBD, 0x3B, 0xDD, 0x9B, 0xE3,
-    0x31, 0x9C, 0x15, 0xDE, 0x85, 0x02, 0x1D, 0xFE, 0xB8, 0x43, 0x53, 0xE0, 0x82, 0xB0, 0x81, 0x9B,
-    0x47, 0x78, 0x33, 0x69, 0xFC, 0xDE, 0x9F, 0x30, 0x7E, 0xDA, 0x46, 0xB5, 0x67, 0xF1, 0xB4, 0xB8,
-    0x43, 0xC4, 0xCF, 0x31, 0x1C, 0xF5, 0x4B, 0xA8, 0xBA, 0xDF, 0x1D, 0x37, 0xC9, 0x70, 0x05, 0xAA,
-    0x66, 0xB9, 0x37, 0xC5, 0x9D, 0x99, 0x7D, 0xFB, 0xF2, 0x0C, 0xBB, 0xCF, 0xD0, 0x72, 0x15, 0x99,
-    0x61, 0x17, 0x7D, 0x38, 0x46, 0x93, 0x0D, 0xE6, 0x2C, 0xD7, 0x18, 0x33, 0x9B, 0x7B, 0xDB, 0x46,
-    0x8C, 0x40, 0xF3, 0xC4, 0xF3, 0x56, 0x05, 0x93, 0x14, 0xA5, 0x81, 0xF3, 0x3D, 0x9A, 0xAD, 0xD0,
-    0xD9, 0x15, 0xD7, 0x50, 0xE5, 0xDF, 0xB6, 0x83, 0x36, 0x81, 0x03, 0x3A, 0xBF, 0x3B, 0x67, 0xB2,
-    0x1F, 0x76, 0x66, 0x38, 0x0B, 0xE1, 0x3A, 0x73, 0xE7, 0x0A, 0xE4, 0xF9, 0xA9, 0xB9, 0x72, 0x5B,
-    0x66, 0xC6, 0xD9, 0x21, 0x90, 0x09, 0x32, 0xC8, 0x8D, 0xAB, 0x37, 0xF9, 0xEC, 0xB6, 0xBE, 0x5D,
-    0x61, 0xF4, 0x98, 0x2B, 0x67, 0x8D, 0xCD, 0xBF, 0x6E, 0xEE, 0x64, 0x08, 0xF2, 0xC1, 0x0C, 0x49,
-    0x1E, 0xD9, 0xD6, 0xEF, 0xF0, 0xA0, 0x2D, 0x78, 0x40, 0x2E, 0xD4, 0xF0, 0x83, 0x10, 0x12, 0x1E,
-    0x03, 0x2D, 0xF8, 0xC3, 0x8A, 0xB3, 0xAE, 0x12, 0x71, 0xCD, 0xC6, 0x0E, 0xBD, 0xB9, 0x79, 0xE3,
-    0x3C, 0x4E, 0x94, 0xF1, 0xC7, 0xA3, 0xD9, 0x0D, 0xBA, 0x00, 0xB3, 0x3A, 0xC5, 0xB4, 0x1C, 0xFC,
-    0x2E, 0x68, 0xE2, 0x32, 0xC9, 0x27, 0x73, 0x35, 0xEA, 0x5F, 0x9B, 0x3E, 0x7F, 0x3F, 0xB0, 0xD7,
-    0x87, 0x70, 0x90, 0xA9, 0x21, 0xAE, 0xDB, 0xD9, 0xE9, 0x30, 0x2D, 0x5E, 0xB3, 0x96, 0x0E, 0xDA,
-    0xF6, 0x4A, 0x3C, 0x67, 0x17, 0x71, 0x97, 0x95, 0xC0, 0x83, 0x36, 0x18, 0xA3, 0xC1, 0xB3, 0x3E,
-    0x6C, 0x58, 0x57, 0x08, 0x56, 0x98, 0xB4, 0xA8, 0x6D, 0xEE, 0x4F, 0x01, 0x51, 0x0A, 0xA1, 0x99,
-    0x96, 0x70, 0xF6, 0x1D, 0x04, 0x8B, 0xDF, 0x04, 0x12, 0x6B, 0xE6, 0xE4, 0xD6, 0xD6, 0x16, 0x20,
-    0xC3, 0x7E, 0xC8, 0x10, 0xC4, 0xDF, 0x7B, 0xB4, 0x5B, 0xE9, 0xE0, 0x69, 0x70, 0x98, 0x11, 0x97,
-    0x27, 0xB7, 0xF2, 0xC2, 0xCE, 0xF8, 0xC9, 0x80, 0x54, 0xE6, 0x04, 0xCE, 0x9D, 0x62, 0x00, 0xC2,
-    0xF2, 0xBC, 0x32, 0xAA, 0x71, 0x8B, 0xD7, 0x9D, 0x8E, 0xE6, 0xFC, 0xF6, 0x99, 0xE8, 0xE3, 0xE6,
-    0xCC, 0xE5, 0xE0, 0x9D, 0xF6, 0xF9, 0x5B, 0x38, 0xC4, 0x5D, 0x70, 0xAF, 0xC6, 0xC1, 0xC2, 0xF5,
-    0xC1, 0xCF, 0x4C, 0x7C, 0x8B, 0xFF, 0xE2, 0xD3, 0xEE, 0x99, 0x33, 0x71, 0xBF, 0x7B, 0xE6, 0xF4,
-    0xC6, 0xF9, 0x13, 0x97, 0x81, 0x67, 0x5E, 0xC7, 0x51, 0x1A, 0x19, 0xCF, 0x24, 0x12, 0xDA, 0x5B,
-    0x8C, 0x3A, 0x0B, 0xD1, 0xEE, 0x73, 0x86, 0x6C, 0xF0, 0x74, 0x19, 0xC2, 0x80, 0x53, 0xD8, 0xA7,
-    0x26, 0x46, 0xCC, 0x8D, 0xE7, 0x4C, 0x84, 0x37, 0x38, 0x22, 0x7E, 0x67, 0xF4, 0x7B, 0x5C, 0x89,
-    0xC8, 0x29, 0xCD, 0xAB, 0xB9, 0xB3, 0xD4, 0x2E, 0x11, 0x05, 0xFF, 0x60, 0x58, 0x4E, 0x93, 0xE5,
-    0x89, 0xAD, 0x8B, 0xBF, 0xBE, 0x40, 0x60, 0xB9, 0x6E, 0x39, 0x93, 0x8E, 0xBA, 0x62, 0x75, 0xE2,
-    0xC0, 0xEB, 0xD9, 0x9D, 0x9D, 0x9D, 0xEB, 0x0B, 0x43, 0xC9, 0x99, 0x14, 0x90, 0x0F, 0x6B, 0x14,
-    0xFF, 0x32, 0xC2, 0x7F, 0x5D, 0x8C, 0x70, 0x3B, 0x46, 0x78, 0x64, 0x0C, 0x60, 0xBE, 0x06, 0x84,
-    0x8A, 0x5C, 0xB0, 0xAE, 0x52, 0x98, 0x9B, 0xA8, 0x83, 0x6D, 0x2B, 0x40, 0x5A, 0xE5, 0x86, 0xF0,
-    0x10, 0xB8, 0x08, 0x82, 0xE4, 0xE7, 0xA3, 0xDF, 0xC6, 0xF5, 0x57, 0x18, 0x37, 0x98, 0x85, 0x80,
-    0xD9, 0x53, 0x98, 0x99, 0xB6, 0x36, 0x3F, 0xB0, 0x6E, 0x3C, 0xCE, 0x02, 0xE3, 0x4D, 0xB8, 0xA1,
-    0x2C, 0x6C, 0x1B, 0x40, 0xF0, 0x0D, 0x15, 0xEB, 0x5B, 0x66, 0xF4, 0xC7, 0xA8, 0x4F, 0xDA, 0xAC,
-    0xDC, 0x35, 0xB7, 0x64, 0xCC, 0x1B, 0x66, 0xB3, 0x34, 0x74, 0x76, 0x2D, 0x00, 0x50, 0x12, 0x56,
-    0x20, 0x50, 0x2A, 0x60, 0x90, 0x96, 0x12, 0x98, 0xB9, 0xD9, 0x93, 0x51, 0x27, 0x89, 0xD3, 0x71,
-    0x71, 0xDC, 0x93, 0xF9, 0x33, 0x09, 0x4E, 0x4F, 0xA2, 0xC2, 0x44, 0x0D, 0xF0, 0xE0, 0xB8, 0x37,
-    0x08, 0xAB, 0x14, 0x89, 0xD0, 0xE6, 0x77, 0xC6, 0xE7, 0x03, 0xFB, 0x71, 0x6F, 0xC7, 0xE0, 0x81,
-    0x6D, 0x6D, 0x1F, 0xBE, 0x6B, 0xF3, 0xA2, 0x8E, 0xEA, 0x0B, 0xC0, 0x4C, 0xC9, 0x75, 0x6B, 0x47,
-    0x07, 0xED, 0x87, 0xB2, 0xC5, 0xB9, 0x75, 0xF3, 0x7A, 0x5B, 0x40, 0xC6, 0x4D, 0x49, 0x1B, 0x05,
-    0x0D, 0xEC, 0x23, 0xDA, 0x0C, 0xED, 0x7B, 0x8E, 0x56, 0x1B, 0x01, 0x1B, 0x80, 0xE3, 0x33, 0x9C,
-    0x43, 0x00, 0x0C, 0x64, 0x96, 0xE1, 0x36, 0x8F, 0xFD, 0xC0, 0x63, 0xD7, 0xCB, 0xB1, 0xE3, 0xF1,
-    0x03, 0x39, 0xFE, 0xBC, 0xE5, 0x95, 0xF7, 0x5B, 0xDE, 0x75, 0x17, 0xCE, 0x8C, 0xED, 0x5D, 0x08,
-    0xE0, 0xFD, 0xE8, 0x0D, 0x8A, 0x11, 0x7F, 0x97, 0x62, 0xC4, 0x2F, 0xF1, 0x98, 0xC4, 0xB9, 0x1C,
-    0x29, 0xC2, 0x69, 0xE6, 0x49, 0x73, 0x96, 0x89, 0xC6, 0x9C, 0x61, 0x66, 0x36, 0x57, 0x98, 0x27,
-    0xCD, 0x40, 0x5F, 0x79, 0x9F, 0x72, 0x6A, 0x07, 0x16, 0x83, 0xDD, 0x8A, 0x99, 0xE3, 0xAC, 0x65,
-    0x96, 0x28, 0x86, 0x65, 0xE6, 0x64, 0xAA, 0xCC, 0xDE, 0x1D, 0xED, 0x3D, 0x81, 0x6F, 0x53, 0xE5,
-    0x59, 0x67, 0x08, 0x7E, 0x49, 0x99, 0xD6, 0x45, 0x79, 0x9A, 0xCF, 0xC9, 0xBD, 0xBD, 0x4D, 0xDB,
-    0x54, 0xA3, 0x79, 0xA5, 0x06, 0x96, 0xA4, 0x25, 0x62, 0x2C, 0xA3, 0x7F, 0xAF, 0x31, 0xE2, 0x46,
-    0x1A, 0x6C, 0x34, 0x97, 0x9A, 0xC2, 0xBE, 0x4B, 0x03, 0xFC, 0x18, 0x36, 0xE8, 0x8C, 0xAD, 0xEA,
-    0x34, 0x1F, 0xC3, 0x36, 0x6A, 0xEE, 0x98, 0x3B, 0x04, 0x34, 0x40, 0x6B, 0x52, 0x26, 0x25, 0xA0,
-    0x29, 0x7E, 0x6F, 0x82, 0x92, 0xB9, 0x6F, 0x17, 0xD8, 0xE0, 0x01, 0x1B, 0x60, 0xBC, 0xC8, 0xCE,
-    0xB9, 0x29, 0x81, 0x0C, 0x61, 0x83, 0x11, 0xE3, 0x26, 0x61, 0x1C, 0xC0, 0x01, 0x04, 0x09, 0x00,
-    0x03, 0x70, 0xB2, 0x2A, 0xAD, 0x11, 0x50, 0x48, 0xDB, 0xAC, 0xF1, 0xE7, 0x60, 0x32, 0x49, 0x93,
-    0xD5, 0x1E, 0xCF, 0x24, 0xBC, 0x68, 0xF0, 0xFA, 0x43, 0x39, 0x43, 0x92, 0x22, 0x88, 0x90, 0xF1,
-    0xF6, 0x8C, 0xA2, 0xDB, 0x29, 0x9B, 0x2B, 0x97, 0x61, 0xA4, 0xAA, 0x5B, 0xC3, 0xCE, 0xA5, 0x71,
-    0x6F, 0x99, 0xCE, 0x76, 0x17, 0x91, 0x90, 0xB9, 0x89, 0x25, 0xFF, 0x85, 0x84, 0x17, 0x46, 0xB6,
-    0x20, 0x26, 0xAF, 0xC6, 0x1F, 0x78, 0x2A, 0xAE, 0xC6, 0x51, 0x92, 0x06, 0xE1, 0xC7, 0xB7, 0x72,
-    0xF5, 0x88, 0x3F, 0x6A, 0x5E, 0x79, 0xC7, 0xF8, 0x0F, 0xBB, 0x4D, 0xA8, 0x77, 0x15, 0x97, 0x0D,
-    0x09, 0xEC, 0xC3, 0x24, 0x76, 0x35, 0x84, 0xBD, 0x40, 0xC5, 0x00, 0x0C, 0x32, 0x81, 0xBD, 0x41,
-    0x1E, 0x98, 0x94, 0xDE, 0xE0, 0xF2, 0x80, 0x37, 0x8A, 0x40, 0xE4, 0x77, 0x44, 0x13, 0xC9, 0x7A,
-    0x32, 0x8D, 0x45, 0x60, 0x5E, 0x2D, 0x72, 0xF0, 0x6A, 0x06, 0x3D, 0x65, 0x00, 0xF5, 0xE2, 0x68,
-    0x77, 0xDC, 0xAF, 0x39, 0xE0, 0x67, 0xF7, 0x3A, 0xC6, 0x43, 0xEE, 0xF8, 0xD5, 0xA9, 0x56, 0x55,
-    0xDC, 0x64, 0x84, 0x70, 0x72, 0x89, 0x51, 0x24, 0x1B, 0x25, 0x8B, 0xE1, 0x91, 0x18, 0xD4, 0x02,
-    0xC4, 0x18, 0xFE, 0x23, 0x36, 0xC9, 0x8C, 0x63, 0x84, 0xA3, 0xFB, 0x43, 0x91, 0xE7, 0x9A, 0x18,
-    0x09, 0xF8, 0xB0, 0x4B, 0x01, 0x43, 0x4C, 0x0C, 0x7C, 0x9E, 0x9A, 0xE4, 0xB3, 0x59, 0x09, 0x4D,
-    0x96, 0x17, 0xFC, 0x63, 0x30, 0x67, 0x4C, 0x06, 0x8B, 0xE0, 0x01, 0x27, 0xCC, 0xB5, 0xC2, 0xD6,
-    0x42, 0xEB, 0xC6, 0x02, 0xA0, 0x52, 0x3A, 0x65, 0xB2, 0x05, 0xCD, 0x1A, 0xDD, 0x14, 0xE4, 0x03,
-    0x30, 0xA5, 0xD5, 0x0B, 0xD1, 0xC2, 0x02, 0xE9, 0x42, 0x20, 0x49, 0x52, 0xD0, 0x20, 0x98, 0x77,
-    0x6E, 0x8A, 0x06, 0x11, 0xC9, 0x06, 0x35, 0x08, 0x89, 0x98, 0x61, 0xB3, 0x30, 0x40, 0x79, 0x28,
-    0x3E, 0x3C, 0x9A, 0x03, 0xD4, 0x15, 0xA9, 0x59, 0x0C, 0xDF, 0x10, 0xC4, 0x5B, 0x1D, 0xCE, 0xDB,
-    0xA7, 0x21, 0x68, 0xF0, 0x88, 0x59, 0x48, 0xC4, 0x3A, 0x46, 0x99, 0x02, 0xA5, 0x83, 0x8D, 0x13,
-    0x41, 0xAE, 0x15, 0x5B, 0x14, 0x8D, 0x0B, 0x1D, 0xB1, 0x25, 0x03, 0x09, 0xEC, 0xB0, 0xA6, 0xD4,
-    0xF4, 0x4F, 0x26, 0x3F, 0x69, 0xE3, 0x38, 0x0F, 0x42, 0x85, 0x83, 0x03, 0x3E, 0xD3, 0x51, 0x90,
-    0x77, 0x60, 0xAC, 0x98, 0x57, 0x06, 0x0E, 0x91, 0xBC, 0x84, 0x84, 0x99, 0xC3, 0x91, 0x08, 0x16,
-    0xCE, 0x61, 0xE8, 0x90, 0xBC, 0xD0, 0x29, 0x0C, 0xB9, 0x68, 0xC1, 0x10, 0x49, 0x79, 0xCE, 0x05,
-    0x90, 0x86, 0x0B, 0x0E, 0x4C, 0x8D, 0x6A, 0x1F, 0x8D, 0x17, 0x75, 0x12, 0x0F, 0x51, 0xBB, 0x20,
-    0xF1, 0x85, 0x71, 0xDC, 0x5E, 0x9C, 0x2C, 0xD1, 0x92, 0x2C, 0x92, 0x90, 0xF9, 0xCA, 0x41, 0x13,
-    0xC1, 0x37, 0xD1, 0x60, 0x30, 0xDD, 0xC8, 0x92, 0x9F, 0x59, 0x42, 0xDF, 0x79, 0x0A, 0x4F, 0x8B,
-    0xBD, 0x3C, 0x88, 0xDF, 0x0B, 0x91, 0x1F, 0x3F, 0x55, 0xCE, 0xDC, 0x51, 0xA8, 0xAE, 0x39, 0xA5,
-    0xE0, 0x03, 0xC9, 0x6D, 0xCB, 0xBF, 0x83, 0x53, 0x72, 0x50, 0xE4, 0x18, 0xDA, 0x3C, 0x9B, 0x1F,
-    0x7C, 0xC8, 0x5F, 0x98, 0x03, 0x94, 0x91, 0xB8, 0x2D, 0x6C, 0xD2, 0x81, 0x44, 0xEA, 0x68, 0x55,
-    0xA5, 0x9F, 0x7A, 0xA5, 0x39, 0xE2, 0xF5, 0x9C, 0xBE, 0x15, 0x7A, 0x4D, 0xD6, 0xEA, 0x9D, 0xCA,
-    0x47, 0x05, 0xFB, 0xF0, 0xF6, 0xBE, 0x00, 0x7A, 0x78, 0x5F, 0x86, 0x0F, 0xBA, 0x59, 0xC9, 0xA8,
-    0x02, 0xFC, 0xA8, 0x0C, 0x76, 0x57, 0xBD, 0x78, 0x4D, 0x07, 0xCA, 0x24, 0x1A, 0x60, 0xE3, 0x60,
-    0x31, 0x13, 0xD5, 0x88, 0xCC, 0x0C, 0x81, 0x30, 0x70, 0x52, 0x5B, 0xB2, 0x0B, 0x6F, 0xDE, 0xD9,
-    0xA9, 0x4A, 0xC9, 0x4D, 0xB1, 0x30, 0x75, 0xE1, 0xC2, 0xD4, 0xA7, 0xD2, 0x44, 0x02, 0x9F, 0x0B,
-    0x86, 0x0C, 0xA2, 0x9D, 0x6F, 0xB7, 0x91, 0x12, 0x91, 0x24, 0xC0, 0x4D, 0xC4, 0x61, 0x6B, 0xD6,
-    0x00, 0xC5, 0x13, 0x45, 0x27, 0x65, 0x4F, 0xFA, 0x61, 0x68, 0x35, 0x41, 0xA9, 0x51, 0xA2, 0x7D,
-    0xBD, 0x64, 0xDB, 0x3C, 0xE9, 0xC6, 0xD8, 0x75, 0xCE, 0xD7, 0x19, 0x5C, 0xA9, 0x12, 0x55, 0x21,
-    0xD2, 0x57, 0x5A, 0x9B, 0x59, 0xC5, 0xA3, 0x6B, 0x26, 0x2C, 0x9F, 0x50, 0x63, 0xFC, 0x40, 0x71,
-    0xAB, 0x6A, 0x24, 0xB9, 0x17, 0x93, 0xE2, 0xEF, 0x5B, 0xF2, 0x61, 0xFC, 0x1D, 0x89, 0x0C, 0xAF,
-    0x4E, 0x8F, 0x9C, 0x18, 0x47, 0x85, 0x94, 0x71, 0x33, 0xAB, 0xD2, 0xB4, 0x9F, 0xA9, 0x31, 0x32,
-    0x01, 0x05, 0xE0, 0x8E, 0x98, 0x3A, 0xBE, 0x3B, 0x28, 0xC4, 0xCD, 0x6A, 0x13, 0x61, 0x43, 0x7E,
-    0x1F, 0x6A, 0xEE, 0xD3, 0x81, 0x46, 0x9D, 0xB1, 0xD7, 0x14, 0xAA, 0x33, 0xAD, 0xFF, 0x20, 0x46,
-    0x25, 0xA6, 0xB5, 0x4C, 0x2B, 0x5A, 0xA8, 0x9A, 0xF0, 0xB3, 0x9D, 0x9D, 0x59, 0x61, 0x13, 0x75,
-    0x18, 0x4D, 0x49, 0x63, 0x60, 0x10, 0xD6, 0xBE, 0x95, 0x4E, 0x6E, 0x2A, 0x95, 0xB4, 0x26, 0xE3,
-    0x5D, 0xF3, 0xB7, 0xC1, 0x38, 0x59, 0xAD, 0x10, 0xBD, 0x85, 0xBF, 0x83, 0x23, 0xFA, 0x8C, 0xF6,
-    0x60, 0x92, 0xA7, 0x78, 0xF6, 0xDB, 0xA2, 0x7D, 0x51, 0x57, 0xB5, 0x96, 0x4D, 0xBF, 0x43, 0x7B,
-    0x5F, 0xEB, 0x86, 0xD0, 0xE1, 0xCA, 0xEC, 0xE6, 0x95, 0x9E, 0xB5, 0x6A, 0x84, 0x49, 0x8D, 0x70,
-    0x55, 0x31, 0x28, 0xD3, 0x1A, 0x3F, 0xFD, 0xCE, 0xA0, 0xAC, 0xB0, 0x52, 0x5B, 0x08, 0x3B, 0x08,
-    0x5B, 0x19, 0x28, 0x20, 0x55, 0x12, 0xC0, 0x95, 0x38, 0x19, 0x45, 0x23, 0x24, 0x02, 0x5F, 0x52,
-    0x96, 0x15, 0xCF, 0xA5, 0x6A, 0x84, 0xE4, 0xBF, 0x76, 0xDE, 0x1C, 0x34, 0xB5, 0x28, 0xE2, 0xD3,
-    0x08, 0xB4, 0x05, 0x42, 0x8B, 0x97, 0x83, 0x3B, 0x68, 0xF9, 0x55, 0x1A, 0xB9, 0x6B, 0x9F, 0x45,
-    0x83, 0x27, 0xBC, 0xBD, 0x34, 0xAE, 0x6A, 0x36, 0x1A, 0xBF, 0xA1, 0x0A, 0x1F, 0xA9, 0xD4, 0x41,
-    0x2B, 0xD3, 0xC3, 0xEB, 0x54, 0xFB, 0x3B, 0xD2, 0x28, 0x31, 0xA9, 0xA7, 0x1F, 0xFE, 0x56, 0x81,
-    0xB3, 0x50, 0xCD, 0x36, 0x6F, 0xAE, 0xD9, 0x24, 0xD2, 0xB7, 0x44, 0xE7, 0x55, 0x3C, 0xB8, 0x61,
-    0x1D, 0xF2, 0x8A, 0x69, 0x82, 0x87, 0x32, 0x8E, 0xD7, 0x6B, 0xD4, 0x8C, 0x3A, 0x1F, 0x76, 0xD5,
-    0x34, 0x99, 0xE8, 0x89, 0xC4, 0xA3, 0xA9, 0xA4, 0x4C, 0x94, 0x26, 0x49, 0x62, 0x44, 0xB6, 0x9B,
-    0xD5, 0x42, 0xD0, 0x93, 0xA4, 0x44, 0xA6, 0x90, 0xCE, 0x07, 0xD0, 0x3F, 0x31, 0x4D, 0xB1, 0xB3,
-    0xF3, 0x56, 0xAB, 0x55, 0xC7, 0xA8, 0x7C, 0xC3, 0xBA, 0xE4, 0x5B, 0xCB, 0xE5, 0x91, 0xA6, 0x6F,
-    0x6F, 0x96, 0xDC, 0x63, 0xAA, 0x8F, 0x12, 0xCC, 0x87, 0x50, 0x7B, 0x1B, 0x81, 0x58, 0x15, 0xDC,
-    0x06, 0xC5, 0xDF, 0x96, 0x71, 0xC1, 0x26, 0x39, 0x9B, 0x5D, 0x09, 0xB5, 0x57, 0x68, 0xFF, 0xF9,
-    0x55, 0xED, 0xDF, 0x58, 0x69, 0x32, 0xE0, 0x8F, 0xCF, 0x3B, 0x6D, 0x20, 0xF9, 0xBF, 0x05, 0x39,
-    0x6B, 0xC4, 0x77, 0xB3, 0x6B, 0x35, 0x8C, 0x2E, 0xF5, 0x80, 0xA8, 0xD6, 0x0E, 0x77, 0x74, 0xDA,
-    0xC3, 0xA3, 0xAE, 0xAB, 0x81, 0xA9, 0x6B, 0xDF, 0xB4, 0xCA, 0x77, 0x32, 0x6B, 0x95, 0x79, 0xA0,
-    0x38, 0xAA, 0xC5, 0x0A, 0xEE, 0xEA, 0x44, 0xAA, 0x01, 0x95, 0x48, 0x3D, 0x15, 0xFF, 0x62, 0x4B,
-    0x13, 0x17, 0x74, 0xC3, 0xD8, 0xBE, 0xC0, 0x04, 0xFD, 0xDE, 0x32, 0x10, 0x08, 0x1F, 0xAA, 0xE8,
-    0xCC, 0x2C, 0xEC, 0x0A, 0xB0, 0xC2, 0x84, 0x53, 0xCE, 0x9A, 0x02, 0xB5, 0xB6, 0xED, 0x09, 0x24,
-    0xB6, 0x21, 0x9B, 0xB2, 0xCA, 0x04, 0x8D, 0x79, 0xF5, 0xA6, 0x36, 0xAC, 0x4A, 0x3E, 0xD0, 0xD6,
-    0x9E, 0xFD, 0xF5, 0x45, 0x29, 0x74, 0xFC, 0x81, 0x7D, 0x9E, 0xA8, 0x61, 0x28, 0xA6, 0x82, 0x49,
-    0x03, 0x63, 0xD5, 0x2F, 0xB3, 0x7A, 0x39, 0xFB, 0x55, 0x52, 0x39, 0xA1, 0xB4, 0x49, 0x41, 0x54,
-    0x03, 0xA1, 0xA0, 0x5A, 0xDE, 0xBC, 0x6A, 0xE6, 0xC4, 0x7A, 0xB5, 0x7C, 0xC8, 0x99, 0xF6, 0x94,
-    0x81, 0xC2, 0x3E, 0x64, 0x6A, 0xBD, 0xAA, 0x26, 0xD2, 0x8D, 0x02, 0x74, 0x25, 0xFD, 0xCA, 0x8B,
-    0x36, 0x56, 0xE0, 0xAD, 0xC3, 0xC4, 0xF2, 0xD0, 0x3F, 0x1C, 0x9C, 0x09, 0x16, 0xDC, 0x43, 0x71,
-    0x44, 0xCC, 0x19, 0x6E, 0x1F, 0xA6, 0x02, 0x1A, 0x71, 0x0A, 0x7E, 0xB6, 0x5D, 0xB1, 0x00, 0x5F,
-    0x3F, 0xF8, 0xFA, 0xFA, 0xFC, 0xD6, 0x38, 0xA0, 0x29, 0x66, 0x77, 0x34, 0xD5, 0xCE, 0x8E, 0x52,
-    0x96, 0x2B, 0xA2, 0xE5, 0x15, 0x19, 0xF2, 0xB2, 0x98, 0xE0, 0xBC, 0x4E, 0xD1, 0xB5, 0xF6, 0x9E,
-    0xF2, 0x39, 0xA0, 0xD4, 0x6D, 0x81, 0xAC, 0x51, 0x1C, 0xD8, 0x2F, 0x5B, 0x7D, 0xCD, 0xAA, 0x1E,
-    0x5C, 0x56, 0x85, 0xBE, 0xF6, 0x4A, 0x4A, 0x3A, 0x2C, 0x16, 0xCC, 0x03, 0x45, 0xB6, 0x8C, 0x8E,
-    0x4D, 0xFA, 0x49, 0xDC, 0x37, 0x49, 0xB4, 0x8F, 0x87, 0x80, 0x58, 0x91, 0x28, 0x15, 0xDA, 0x2E,
-    0x1E, 0xD5, 0xB4, 0x2E, 0xDD, 0x4F, 0xF3, 0xB4, 0xF9, 0xD2, 0x6A, 0xB7, 0xBB, 0x22, 0x2C, 0x5A,
-    0x60, 0xA5, 0xEF, 0x77, 0x8B, 0x3C, 0x1D, 0x48, 0x35, 0x00, 0x68, 0xB8, 0xFC, 0xA5, 0xD3, 0xEE,
-    0x6F, 0xD9, 0x59, 0xD4, 0xC4, 0x13, 0x4E, 0x21, 0xC4, 0x08, 0xC7, 0x88, 0x45, 0x40, 0x17, 0xB4,
-    0x47, 0x64, 0x9B, 0x2F, 0x89, 0xBF, 0xBE, 0xE5, 0x8A, 0x3A, 0x42, 0xBF, 0x50, 0x6D, 0xE1, 0x44,
-    0xC4, 0xAA, 0x83, 0x0C, 0x7B, 0x6B, 0xEB, 0x3C, 0xEE, 0x45, 0x8D, 0x2D, 0xDD, 0xF9, 0x46, 0x01,
-    0x41, 0xA4, 0x9C, 0x1C, 0xA9, 0xA2, 0x08, 0xEB, 0x27, 0xCD, 0xFA, 0x49, 0x81, 0x9D, 0x6A, 0x71,
-    0xB2, 0x7D, 0xE4, 0x24, 0x81, 0xE8, 0xD2, 0x3E, 0x81, 0xBB, 0x33, 0xD5, 0x81, 0x0E, 0xAA, 0xF9,
-    0x63, 0x57, 0x02, 0xB2, 0x97, 0x4B, 0xF2, 0xEB, 0x13, 0x07, 0x58, 0x5E, 0x6D, 0xE6, 0xEB, 0xC6,
-    0xD6, 0x7B, 0x45, 0x40, 0xF6, 0xBA, 0x05, 0xF6, 0xC4, 0x52, 0x93, 0x33, 0x96, 0x66, 0xE4, 0xDA,
-    0x89, 0xB8, 0xAC, 0xF9, 0xAB, 0x05, 0xBC, 0xCD, 0x07, 0xAF, 0x4B, 0x97, 0xD7, 0x95, 0x6E, 0x9E,
-    0x2E, 0xAE, 0xDB, 0xB4, 0xDB, 0x4C, 0x40, 0xF5, 0x9A, 0x98, 0x52, 0x1B, 0x57, 0x42, 0x74, 0x1A,
-    0xE5, 0xA5, 0x11, 0x79, 0x63, 0x05, 0xC3, 0x23, 0xD4, 0xFF, 0xD2, 0xAC, 0x5B, 0x52, 0x6E, 0x17,
-    0x49, 0x05, 0xC8, 0xE4, 0xE9, 0x92, 0x55, 0xA7, 0x05, 0x28, 0x88, 0x43, 0xED, 0x22, 0x12, 0x04,
-    0x30, 0x69, 0x4F, 0x11, 0x6D, 0x79, 0xB9, 0x18, 0x4F, 0x70, 0x5C, 0x2E, 0x9F, 0x17, 0x97, 0x4B,
-    0x64, 0x54, 0x8B, 0x60, 0x82, 0x55, 0x19, 0x7F, 0xC6, 0xC9, 0xEB, 0xDD, 0xF0, 0x6E, 0xC0, 0x83,
-    0x80, 0x72, 0x52, 0xA7, 0x70, 0x0C, 0x47, 0x26, 0x8A, 0xFA, 0x70, 0xF0, 0x1A, 0x71, 0xB8, 0x27,
-    0xA0, 0x4E, 0x8F, 0x3F, 0x2A, 0x4E, 0xFE, 0xA8, 0x38, 0x2A, 0x7D, 0x77, 0x48, 0xFA, 0xA5, 0x38,
-    0x7A, 0x79, 0x7B, 0x48, 0x7A, 0xFA, 0x84, 0x56, 0x15, 0x07, 0x46, 0x9A, 0x53, 0xCD, 0x1F, 0xED,
-    0xDC, 0xD4, 0x44, 0x4A, 0x83, 0x66, 0x1A, 0xB0, 0x7F, 0x56, 0x99, 0x57, 0xAC, 0x50, 0x66, 0xCF,
-    0xCA, 0xC2, 0x85, 0xC9, 0x94, 0x3E, 0x82, 0x32, 0x4B, 0xB5, 0x3F, 0xC8, 0x33, 0xA0, 0x12, 0x35,
-    0xC7, 0xAF, 0x03, 0x1C, 0x4E, 0xA4, 0x60, 0xF4, 0x2E, 0xFE, 0xCF, 0x16, 0xDE, 0x48, 0x45, 0xF3,
-    0x60, 0x94, 0xF2, 0x18, 0x9F, 0x53, 0x1E, 0x98, 0x9C, 0x42, 0x42, 0x18, 0x17, 0xB0, 0x8E, 0x90,
-    0x53, 0x4C, 0x5D, 0x2A, 0xA1, 0x36, 0xD0, 0x98, 0x1C, 0xA4, 0xD2, 0xB9, 0x62, 0xC5, 0xDF, 0x9B,
-    0x76, 0xE7, 0x2D, 0x2B, 0x39, 0xD8, 0x4A, 0xDF, 0xCE, 0xEE, 0xAF, 0xB7, 0x06, 0x6F, 0x78, 0x1A,
-    0x1E, 0x53, 0x24, 0x4A, 0xA5, 0x36, 0xD1, 0x3E, 0x62, 0xA5, 0x39, 0xED, 0x6C, 0xAC, 0xEC, 0xE0,
-    0x1B, 0x41, 0xFF, 0x3B, 0x48, 0xFB, 0xC6, 0x05, 0x3A, 0xE4, 0x02, 0xEE, 0x26, 0x02, 0x70, 0x12,
-    0x62, 0x72, 0xF3, 0x79, 0xB4, 0x14, 0x5B, 0x5A, 0x8B, 0x1E, 0x83, 0xD5, 0x12, 0x5B, 0x72, 0x09,
-    0xF9, 0x24, 0x1C, 0x4E, 0xB3, 0xF8, 0x0F, 0x47, 0x69, 0x09, 0x05, 0x9F, 0x4C, 0xD2, 0x40, 0x09,
-    0x3A, 0xAB, 0x3D, 0x91, 0xAE, 0x62, 0xF3, 0x05, 0x4C, 0x24, 0xAB, 0xD9, 0x4F, 0x89, 0x9B, 0xB4,
-    0x66, 0x6F, 0x00, 0x2C, 0xBA, 0x8D, 0xA5, 0x81, 0x11, 0x71, 0x75, 0x40, 0xCA, 0x1B, 0x6D, 0xB3,
-    0x04, 0x23, 0xE5, 0xE7, 0x92, 0x47, 0xAA, 0xED, 0x1F, 0xEB, 0xDA, 0x40, 0x45, 0xA1, 0x7D, 0x9F,
-    0xCC, 0x6A, 0x17, 0x24, 0x9D, 0x35, 0x1E, 0x62, 0x29, 0x7D, 0x72, 0x18, 0x80, 0x9F, 0x75, 0xE2,
-    0x97, 0xCA, 0x76, 0x0E, 0xEC, 0x96, 0x74, 0x56, 0x5F, 0x4F, 0x19, 0xB7, 0x2E, 0xB4, 0xAA, 0xD0,
-    0x5C, 0x87, 0xD0, 0x11, 0xD2, 0x48, 0x27, 0xDC, 0xE6, 0x61, 0x13, 0x09, 0x13, 0xF2, 0xB4, 0xCF,
-    0x51, 0x09, 0x48, 0x16, 0xBD, 0x87, 0xC8, 0x49, 0x7A, 0x36, 0x28, 0xC2, 0x51, 0x7C, 0x66, 0xA5,
-    0x50, 0x10, 0x04, 0x18, 0xB9, 0xB8, 0x01, 0x17, 0x5B, 0x21, 0x13, 0x09, 0x9F, 0x95, 0xFC, 0x4A,
-    0x0A, 0x8A, 0x59, 0x28, 0x51, 0x72, 0x7F, 0x94, 0x4F, 0x84, 0x08, 0x65, 0xF7, 0x06, 0x99, 0x4C,
-    0x52, 0xF2, 0x15, 0x6F, 0x0C, 0x12, 0xB7, 0xF2, 0xC9, 0x1C, 0x0A, 0x56, 0x34, 0x99, 0x54, 0x6E,
-    0xFE, 0x2C, 0x5C, 0x26, 0x61, 0x7D, 0x57, 0x33, 0x3A, 0x52, 0x28, 0x6C, 0x7F, 0x53, 0x69, 0x1F,
-    0x4A, 0x60, 0x48, 0x8E, 0x6C, 0x9B, 0xAC, 0xBD, 0xFE, 0xC4, 0xAC, 0xD6, 0x13, 0xA3, 0x79, 0x55,
-    0xE6, 0xFB, 0xCA, 0x79, 0x0A, 0x41, 0x7A, 0x3F, 0x7F, 0xC2, 0xD4, 0xD6, 0x4E, 0x53, 0x34, 0xAD,
-    0xD6, 0x6E, 0x5D, 0x41, 0xAF, 0xF2, 0x45, 0x9D, 0x10, 0xFF, 0xC1, 0x7C, 0xF5, 0x09, 0x51, 0xFB,
-    0x9B, 0xDA, 0x71, 0x1D, 0x62, 0xA9, 0x46, 0x3E, 0x94, 0x32, 0xB1, 0xA2, 0xB7, 0xA3, 0xD7, 0xC5,
-    0xDB, 0x7F, 0x1F, 0xB5, 0x8F, 0x01, 0x80, 0x4D, 0x59, 0x76, 0x4B, 0x04, 0x19, 0x05, 0xBE, 0x10,
-    0x1F, 0x79, 0x32, 0xE1, 0xF1, 0x39, 0x9F, 0x4A, 0xA3, 0xA1, 0x44, 0xE0, 0x8C, 0x1E, 0x03, 0x4D,
-    0x72, 0x94, 0xD7, 0x9F, 0x04, 0x9A, 0xD3, 0xF7, 0x66, 0xD1, 0x54, 0x40, 0x39, 0xF9, 0x50, 0xD4,
-    0x9E, 0x44, 0xED, 0xF4, 0x97, 0x4E, 0x53, 0x55, 0x5B, 0x4A, 0xB6, 0x41, 0xFE, 0xA9, 0xC4, 0x60,
-    0x71, 0xCB, 0x91, 0x7D, 0xAD, 0xB4, 0x8B, 0x32, 0x85, 0x78, 0x49, 0x47, 0xB2, 0xCE, 0x9C, 0x31,
-    0x49, 0xDB, 0x32, 0x9B, 0x7F, 0x44, 0xD9, 0x2B, 0x41, 0x69, 0xCF, 0xD5, 0x63, 0x27, 0x97, 0xE0,
-    0x77, 0x83, 0x63, 0x95, 0x95, 0xD0, 0x0B, 0x69, 0xE7, 0x59, 0xE1, 0xFA, 0x48, 0x38, 0xCD, 0x63,
-    0x54, 0xFD, 0x92, 0x46, 0x34, 0x58, 0xCA, 0x4F, 0x33, 0xA0, 0x5A, 0x52, 0x87, 0x5D, 0xD8, 0x25,
-    0xB5, 0x3F, 0x02, 0x10, 0xAB, 0x49, 0xC9, 0xBD, 0x8C, 0x83, 0x54, 0x3A, 0x55, 0xC8, 0x34, 0x69,
-    0x9D, 0x34, 0x51, 0x97, 0xE5, 0xFE, 0xF8, 0xBC, 0xD1, 0x55, 0x2F, 0x75, 0xB0, 0x2F, 0x0B, 0x93,
-    0xB6, 0xBC, 0xA3, 0x2E, 0xBE, 0x44, 0x1F, 0x9F, 0x4F, 0xA1, 0xB9, 0x38, 0xB9, 0x37, 0xCE, 0xCB,
-    0x92, 0x6E, 0x33, 0x4D, 0x70, 0x31, 0x4C, 0x0F, 0xE9, 0x83, 0x4F, 0x27, 0x39, 0x3B, 0x26, 0x8D,
-    0x2C, 0xEF, 0xE3, 0x00, 0x5F, 0x27, 0x35, 0xD7, 0x54, 0x81, 0xF1, 0xC8, 0xB3, 0x59, 0x89, 0x34,
-    0x90, 0x36, 0x30, 0x55, 0xC1, 0x1B, 0x8B, 0x92, 0xCB, 0x6A, 0x75, 0xD8, 0x87, 0xDC, 0x81, 0x61,
-    0x8A, 0xD7, 0x07, 0x66, 0xB5, 0x70, 0xD8, 0x93, 0xDC, 0x57, 0x3C, 0x28, 0x49, 0x4B, 0x02, 0xAB,
-    0x0B, 0xD3, 0x2C, 0xB8, 0x92, 0xCE, 0x38, 0xB7, 0x9B, 0x8C, 0x9F, 0xF0, 0xD1, 0xE2, 0xF8, 0xA0,
-    0xD7, 0xFC, 0x7C, 0x16, 0x1E, 0xDB, 0x16, 0x34, 0x3F, 0xB9, 0xDE, 0x71, 0x51, 0x0A, 0x19, 0x6A,
-    0x60, 0x47, 0x0A, 0xFA, 0xA1, 0x82, 0xB9, 0xA7, 0xC1, 0x22, 0xD6, 0x31, 0xE6, 0x88, 0xB5, 0x7E,
-    0xA6, 0x3C, 0xFC, 0x66, 0x92, 0xF1, 0xC6, 0x0C, 0xB1, 0x90, 0xD8, 0x5E, 0xAA, 0xC9, 0x59, 0xC9,
-    0xC3, 0xA4, 0x69, 0x64, 0x5C, 0xBC, 0x09, 0xA1, 0x1C, 0x24, 0xDB, 0x23, 0xDD, 0x91, 0x47, 0xE1,
-    0xCF, 0x48, 0x57, 0x6A, 0x62, 0xF7, 0xD6, 0x8A, 0x34, 0x0C, 0xBF, 0x48, 0x0A, 0x71, 0xB7, 0xDA,
-    0x28, 0x6D, 0x72, 0xF7, 0x56, 0xCA, 0x0A, 0x07, 0xDF, 0x90, 0xE4, 0x16, 0xF9, 0x4D, 0x33, 0xAD,
-    0x6B, 0x5A, 0x81, 0x3C, 0x31, 0xEC, 0xE0, 0x15, 0x04, 0x86, 0x74, 0x1D, 0xB4, 0xDF, 0x27, 0xD0,
-    0x5D, 0x29, 0x68, 0x7B, 0x17, 0x1E, 0x51, 0x27, 0x70, 0x6D, 0xEC, 0x5A, 0x95, 0xD7, 0xFD, 0x12,
-    0x9A, 0xDE, 0x8A, 0xE9, 0x60, 0x3B, 0x6E, 0xDB, 0x3C, 0xD9, 0x96, 0xD0, 0xB5, 0x86, 0x45, 0xAF,
-    0x29, 0x53, 0x06, 0x34, 0x4B, 0x77, 0x24, 0x1C, 0x14, 0xA5, 0x1A, 0xE1, 0xD3, 0x98, 0x24, 0xF5,
-    0x13, 0x69, 0x09, 0xBF, 0xDC, 0x94, 0x15, 0xDC, 0x4E, 0x62, 0x3F, 0xEB, 0x32, 0x79, 0x6B, 0x33,
-    0xED, 0x25, 0xA7, 0xF9, 0x63, 0x68, 0xE0, 0x13, 0x15, 0x05, 0xDA, 0xA4, 0xD7, 0x2E, 0x54, 0xA2,
-    0xEB, 0x87, 0xD3, 0x6A, 0x2E, 0x28, 0xFB, 0xFB, 0x3D, 0xF3, 0xE8, 0x4A, 0xFB, 0x56, 0xBE, 0xB1,
-    0xF5, 0x32, 0xCA, 0x84, 0x88, 0x3B, 0x3A, 0x3A, 0xDF, 0xCE, 0x44, 0x47, 0x3C, 0x9B, 0x8D, 0x54,
-    0x51, 0x91, 0xAA, 0x5B, 0x11, 0x0A, 0x5A, 0x4C, 0xD2, 0x4F, 0x17, 0x86, 0x2C, 0xE5, 0x53, 0x52,
-    0xCB, 0xF6, 0xB5, 0x41, 0xBA, 0x7C, 0x95, 0x34, 0xCA, 0x93, 0x07, 0xF5, 0xAA, 0xD3, 0xA9, 0x44,
-    0x4B, 0x79, 0x98, 0xF6, 0x66, 0x3C, 0xB7, 0xD0, 0x60, 0x56, 0xCD, 0xB2, 0x83, 0x1F, 0x2B, 0x8D,
-    0xF5, 0xED, 0x3F, 0x2D, 0xD3, 0x73, 0xBC, 0xEA, 0x49, 0x4A, 0x6F, 0x6E, 0x90, 0x6C, 0x96, 0x2F,
-    0x27, 0xBE, 0xF6, 0xD4, 0xF6, 0x73, 0xED, 0x0D, 0xE6, 0x52, 0x3A, 0xA0, 0xA8, 0x1D, 0x37, 0x71,
-    0xC4, 0xC8, 0x55, 0x49, 0x0B, 0x5B, 0xE7, 0x44, 0x14, 0x53, 0x5A, 0x93, 0xA4, 0xDC, 0x9C, 0x87,
-    0xD3, 0xF0, 0x1F, 0x7E, 0x04, 0xBD, 0x21, 0x53, 0x20, 0x17, 0x55, 0xB8, 0xF1, 0x73, 0x3E, 0x87,
-    0x9B, 0x8F, 0x90, 0xF6, 0x7E, 0x92, 0x2F, 0x9B, 0x7B, 0x54, 0x70, 0x93, 0x0F, 0xF1, 0xA4, 0x3C,
-    0x89, 0x0E, 0xAC, 0xA9, 0x3C, 0xBB, 0xAD, 0x30, 0x64, 0x55, 0x01, 0xE9, 0x3E, 0x21, 0xD3, 0xCF,
-    0xAA, 0xB3, 0x68, 0x3A, 0xE9, 0x30, 0x95, 0x2E, 0x27, 0x67, 0xB9, 0x2C, 0x0F, 0xEA, 0x0E, 0x2B,
-    0x4A, 0xC6, 0x66, 0x2A, 0x3E, 0x11, 0x16, 0x87, 0x04, 0xE4, 0x96, 0x43, 0xC4, 0xA6, 0xBA, 0x92,
-    0x1B, 0x69, 0x5F, 0x24, 0x18, 0x74, 0x39, 0x7A, 0xD2, 0x95, 0xBB, 0x42, 0xD7, 0xF5, 0x92, 0xDA,
-    0x5B, 0xAC, 0x95, 0x74, 0x12, 0x97, 0x64, 0x13, 0x74, 0x18, 0x27, 0x41, 0xA1, 0x95, 0x63, 0xEA,
-    0xBA, 0xC1, 0xAD, 0xAC, 0x26, 0x04, 0xFD, 0x37, 0xA4, 0xCC, 0x46, 0x09, 0xC2, 0x7C, 0x52, 0x44,
-    0xD3, 0x45, 0xB6, 0x37, 0xDF, 0x16, 0xD5, 0xE2, 0x36, 0xA1, 0xDD, 0x31, 0xCE, 0xC9, 0x95, 0xD7,
-    0xC4, 0xF3, 0x8B, 0xF5, 0x44, 0x2F, 0xD7, 0x96, 0x6E, 0xEF, 0xBA, 0x8F, 0x1A, 0x95, 0xB1, 0x0B,
-    0xCE, 0x6A, 0x6D, 0xD9, 0x20, 0x59, 0xFA, 0x39, 0xD0, 0x98, 0x94, 0x7E, 0xFF, 0xB0, 0x1C, 0x4B,
-    0xFB, 0x3D, 0x7F, 0xBA, 0x1E, 0x9C, 0x7B, 0xEC, 0xE1, 0xD8, 0x61, 0x64, 0x75, 0xCF, 0x6E, 0x75,
-    0xC8, 0x2A, 0x13, 0xB7, 0xC2, 0x45, 0x51, 0xEB, 0x49, 0x11, 0x3A, 0xCB, 0x5A, 0x09, 0xF5, 0xA3,
-    0x4F, 0xCB, 0x98, 0x13, 0x4F, 0xA7, 0xA4, 0x24, 0xF4, 0x82, 0xA9, 0x15, 0xDC, 0xE1, 0x41, 0xF9,
-    0x62, 0xEF, 0x3F, 0x6C, 0xFE, 0xDD, 0x06, 0x9F, 0xF4, 0x9C, 0xE7, 0x05, 0x6A, 0xD6, 0x1E, 0x74,
-    0xCF, 0x32, 0xA1, 0x7B, 0xB9, 0x6E, 0x67, 0xD0, 0xD7, 0x5F, 0x2F, 0x56, 0xE0, 0xD5, 0x65, 0x0E,
-    0x3D, 0x17, 0x07, 0x51, 0x35, 0xA8, 0x8F, 0xC0, 0x92, 0xB4, 0x3C, 0x01, 0xCF, 0xCE, 0x99, 0x74,
-    0xCA, 0x4B, 0xB6, 0x02, 0x1A, 0x23, 0x84, 0x47, 0xBC, 0x5D, 0xD0, 0x13, 0xDC, 0x71, 0x21, 0x0B,
-    0xD0, 0xA8, 0x02, 0xA1, 0x41, 0x20, 0x40, 0x22, 0x10, 0xC3, 0xBA, 0x8F, 0x41, 0x68, 0x41, 0x76,
-    0xCC, 0x7F, 0xB4, 0x7F, 0x30, 0x99, 0xDD, 0xFE, 0xB9, 0xA2, 0x1E, 0xAF, 0x66, 0xB1, 0x9D, 0x12,
-    0xEB, 0x5B, 0xEA, 0x9E, 0x09, 0x4D, 0x3B, 0xAF, 0x5B, 0x0D, 0xF4, 0x28, 0x22, 0x66, 0xBA, 0x49,
-    0x93, 0x87, 0xEB, 0x5C, 0x13, 0x79, 0x7B, 0x74, 0xF3, 0x32, 0xAE, 0xC3, 0x9A, 0x3D, 0xA7, 0xFC,
-    0x8B, 0xB6, 0x6A, 0xDC, 0x7D, 0x95, 0x81, 0xC1, 0x15, 0x6F, 0xFB, 0x79, 0xCB, 0x6A, 0x19, 0x71,
-    0x76, 0x0B, 0x04, 0x14, 0x5A, 0x9C, 0x3F, 0x62, 0x55, 0x69, 0xC0, 0xCD, 0x11, 0xF9, 0x7C, 0x42,
-    0xDA, 0x1A, 0x73, 0xCC, 0x98, 0x34, 0x99, 0x53, 0xB7, 0x84, 0x85, 0x62, 0x6E, 0x2A, 0x0C, 0x28,
-    0x0D, 0xE4, 0xAD, 0xA8, 0x12, 0x4D, 0x9B, 0x0B, 0xD0, 0x0A, 0x12, 0xE3, 0x74, 0x4C, 0x39, 0xA3,
-    0x3D, 0x0F, 0x99, 0xEF, 0xFD, 0x17, 0xEE, 0x8D, 0xF1, 0xBD, 0xFB, 0x9D, 0xB5, 0xEF, 0xD9, 0x0E,
-    0x04, 0xB0, 0xE8, 0x03, 0x21, 0xF7, 0x1B, 0x07, 0x8A, 0x65, 0xEE, 0xA0, 0x60, 0xC2, 0xA8, 0xF9,
-    0x38, 0x2E, 0x1F, 0x3C, 0xB6, 0x7F, 0x10, 0xB5, 0x1B, 0x34, 0xF7, 0xF5, 0x9A, 0x40, 0xC3, 0x55,
-    0xB5, 0xA2, 0x27, 0xF5, 0x1B, 0x69, 0xAB, 0x3D, 0xDD, 0x5E, 0x45, 0x83, 0x51, 0x90, 0xB0, 0xF3,
-    0xA5, 0x4F, 0x30, 0x8B, 0xF7, 0xB9, 0x7E, 0x2F, 0x49, 0x00, 0x1A, 0x64, 0x14, 0xF1, 0xF4, 0x70,
-    0xAC, 0xC8, 0xD3, 0xAB, 0x51, 0xD2, 0x65, 0xC9, 0x4B, 0x77, 0xAD, 0x7D, 0xD1, 0xD6, 0x15, 0xE3,
-    0x26, 0xE6, 0x96, 0x3D, 0x73, 0xC2, 0x78, 0xAB, 0xAD, 0x36, 0x82, 0xA6, 0xD2, 0x61, 0x1C, 0x09,
-    0x0F, 0x57, 0x39, 0x5F, 0x12, 0x6E, 0xC9, 0x8B, 0xEA, 0xB3, 0x4C, 0x49, 0xB2, 0x87, 0x82, 0x58,
-    0x14, 0x3C, 0xB2, 0xE2, 0xFD, 0x7F, 0x1C, 0x96, 0xA7, 0x5A, 0x73, 0xA9, 0xE4, 0x7E, 0x2D, 0x44,
-    0x82, 0xA4, 0xAD, 0x37, 0x31, 0x4A, 0x9B, 0x4C, 0xB2, 0x71, 0x98, 0x1E, 0xC3, 0xA8, 0x71, 0xE3,
-    0x8D, 0x82, 0xB9, 0xC1, 0x40, 0xB0, 0xCA, 0xE3, 0x4E, 0xB6, 0xA6, 0x56, 0xDC, 0x96, 0x54, 0xA1,
-    0x58, 0xCF, 0xB8, 0x34, 0xD7, 0x91, 0xAB, 0x10, 0x7E, 0x33, 0xA8, 0xB4, 0x2D, 0x20, 0xA7, 0x2D,
-    0x50, 0xE9, 0x83, 0x14, 0xF9, 0x55, 0xCB, 0x7D, 0xA6, 0x6F, 0x0F, 0x55, 0x9E, 0xB4, 0x99, 0xE5,
-    0x4E, 0xA7, 0x32, 0xB5, 0x75, 0x8A, 0x22, 0x02, 0xD6, 0x8B, 0xE0, 0x17, 0x16, 0x12, 0x92, 0x20,
-    0x2F, 0x6D, 0x23, 0x8C, 0x5A, 0x00, 0x72, 0x9D, 0xFE, 0x62, 0x0F, 0x72, 0x1C, 0x67, 0xE3, 0x65,
-    0x4F, 0x49, 0x93, 0x6E, 0xD6, 0x95, 0x7C, 0xCE, 0xE9, 0x8D, 0x2A, 0x86, 0x69, 0x9F, 0x9B, 0xDC,
-    0x50, 0xF7, 0x5C, 0xC9, 0x9A, 0xA8, 0xE5, 0x36, 0x4D, 0xBA, 0x99, 0xE9, 0xE0, 0x84, 0x0B, 0x00,
-    0x96, 0x0E, 0x9D, 0x2E, 0xAD, 0xB9, 0x1D, 0x3A, 0xA9, 0xEE, 0xED, 0x3C, 0xBD, 0x68, 0xC0, 0x70,
-    0xB9, 0x30, 0xEC, 0x94, 0xDF, 0x0B, 0xE0, 0x59, 0x07, 0x25, 0x61, 0xBD, 0xBE, 0x55, 0xE6, 0x12,
-    0x66, 0x03, 0xD9, 0xC7, 0xC7, 0x93, 0xB9, 0x66, 0x66, 0x50, 0x8B, 0x3D, 0x88, 0x35, 0x47, 0x8D,
-    0x3F, 0xC6, 0x75, 0xD4, 0xA7, 0x65, 0xD6, 0x64, 0x7F, 0x05, 0x13, 0x57, 0x70, 0x15, 0x1C, 0x5B,
-    0x6C, 0x6B, 0xD3, 0x12, 0xBF, 0xC7, 0x21, 0xEB, 0xAD, 0x0C, 0x1E, 0x4B, 0x91, 0x1E, 0xB9, 0xDD,
-    0x31, 0xB0, 0x1F, 0x2D, 0x25, 0x24, 0x46, 0xE5, 0xAB, 0xAD, 0x3D, 0xC2, 0x68, 0x5C, 0x1B, 0x89,
-    0x2D, 0x25, 0xD7, 0x1D, 0x31, 0x6B, 0x62, 0x40, 0x4B, 0x5C, 0x58, 0x35, 0xDE, 0x10, 0x0C, 0x94,
-    0x83, 0x08, 0x50, 0xCA, 0x66, 0x52, 0xD4, 0x39, 0x14, 0x24, 0x7E, 0xAF, 0x6A, 0x82, 0xCF, 0x6D,
-    0xE9, 0xB1, 0x50, 0xA3, 0x24, 0x6E, 0x07, 0x8F, 0x87, 0x47, 0xF8, 0x0D, 0x45, 0x91, 0xAD, 0x41,
-    0x74, 0x5D, 0x4C, 0x8F, 0x9D, 0x58, 0x16, 0x21, 0x6C, 0xC9, 0x0A, 0x3D, 0x67, 0xF1, 0x39, 0x62,
-    0xBE, 0x4E, 0x98, 0xA9, 0x13, 0x1E, 0xB2, 0x8B, 0xCC, 0xF7, 0xF4, 0xC1, 0x8D, 0x54, 0xCC, 0x1A,
-    0xB4, 0x47, 0xF8, 0x99, 0xCD, 0xC3, 0x36, 0x6E, 0xC3, 0xD6, 0xE7, 0xB6, 0xDB, 0x19, 0x9A, 0x54,
-    0x10, 0xA8, 0xCA, 0xF7, 0x0C, 0xAC, 0x01, 0x8B, 0xC4, 0x0F, 0x66, 0xE0, 0x57, 0x2F, 0x9D, 0x30,
-    0x47, 0x44, 0xCC, 0x31, 0xF8, 0x2D, 0xCA, 0x2D, 0x44, 0xA6, 0x4D, 0x02, 0xB2, 0x80, 0x8C, 0x1F,
-    0x2F, 0x11, 0xA6, 0x42, 0x54, 0x27, 0x5D, 0x8A, 0x58, 0xE0, 0x26, 0xB7, 0xA3, 0x97, 0xF5, 0x37,
-    0x19, 0x0E, 0xEC, 0xD2, 0xC2, 0x14, 0x74, 0x09, 0x88, 0x1A, 0xA6, 0x04, 0x44, 0x90, 0x8D, 0xB5,
-    0x74, 0x0A, 0x24, 0xC2, 0x9C, 0x81, 0x0C, 0x34, 0x86, 0xB8, 0x25, 0xDC, 0x77, 0xCD, 0x64, 0x5A,
-    0x83, 0x41, 0x74, 0x2B, 0x20, 0x2C, 0x51, 0x0A, 0x31, 0x87, 0xB8, 0x46, 0x76, 0x43, 0xE5, 0xE6,
-    0x2C, 0x2F, 0x2A, 0xCA, 0x60, 0x72, 0x4D, 0xD1, 0x2B, 0x8B, 0x45, 0x81, 0xEF, 0x97, 0xC5, 0xCC,
-    0xDC, 0x89, 0x0F, 0x08, 0xC5, 0x59, 0x89, 0xA0, 0x2C, 0x88, 0x78, 0x33, 0x26, 0x8C, 0x3B, 0x71,
-    0xBC, 0x08, 0xFF, 0xF1, 0xD3, 0xBE, 0xC2, 0xE4, 0x2A, 0x91, 0x40, 0xF3, 0xA5, 0xA7, 0x03, 0xD9,
-    0x25, 0x47, 0x37, 0xEB, 0x0F, 0x7C, 0xFC, 0xFC, 0x41, 0x9A, 0xFB, 0x63, 0xEE, 0x97, 0xE5, 0xE0,
-    0x0C, 0x74, 0xDD, 0x17, 0x90, 0xC9, 0xAE, 0xD0, 0x50, 0xFB, 0x86, 0xBA, 0x85, 0x3D, 0x15, 0xBE,
-    0x84, 0xA7, 0x78, 0xE3, 0x33, 0xE0, 0x72, 0x79, 0x6A, 0xCB, 0x88, 0xEE, 0x76, 0xB9, 0x86, 0x69,
-    0x83, 0x0D, 0x12, 0xD0, 0x8C, 0x9E, 0x5E, 0x9C, 0xE2, 0x1A, 0x3E, 0xDC, 0x35, 0x67, 0x57, 0x1E,
-    0xFC, 0xDA, 0x0D, 0x53, 0xCC, 0xB2, 0xF1, 0x16, 0x63, 0x07, 0x07, 0xC7, 0x4E, 0x64, 0xED, 0x59,
-    0x77, 0x92, 0x2E, 0x1F, 0x9F, 0x87, 0xDD, 0x65, 0x7F, 0xDC, 0x05, 0x3C, 0x71, 0x56, 0x73, 0xAE,
-    0x1C, 0x5F, 0x3A, 0x0A, 0x7E, 0xFA, 0x15, 0xDC, 0x74, 0xD8, 0x4B, 0xDF, 0x2F, 0xF9, 0x0C, 0x61,
-    0x19, 0x93, 0x90, 0x27, 0x5F, 0xB6, 0x40, 0xE9, 0x0A, 0xAF, 0xF2, 0xB4, 0x59, 0xF2, 0xF4, 0xF2,
-    0xFC, 0x71, 0x53, 0x84, 0x65, 0xF4, 0x69, 0xCF, 0xE7, 0xB0, 0x3C, 0x24, 0xF7, 0x58, 0x81, 0x64,
-    0xC7, 0x5C, 0xD3, 0x81, 0x7A, 0xC5, 0x5C, 0x94, 0x97, 0xEE, 0x31, 0x7B, 0x1E, 0xB2, 0x89, 0x21,
-    0x7B, 0x05, 0xF9, 0xB3, 0x85, 0xF8, 0x9E, 0x4C, 0x1B, 0x9A, 0xEE, 0xCF, 0x3F, 0xE0, 0x66, 0xDC,
-    0x87, 0x2D, 0xE1, 0xB4, 0x4E, 0x7A, 0x54, 0xDE, 0xEC, 0xA1, 0x44, 0x4C, 0x3A, 0x34, 0xE1, 0x3B,
-    0xDC, 0x6E, 0x06, 0x2B, 0xFA, 0x5C, 0xF7, 0x8E, 0x3E, 0xA0, 0x08, 0xDF, 0x65, 0x23, 0x01, 0xB6,
-    0x0D, 0x3B, 0xEA, 0xFD, 0x02, 0x73, 0x16, 0x02, 0x35, 0x6E, 0x90, 0xA5, 0xA0, 0xF7, 0x7E, 0xD1,
-    0x2A, 0xCD, 0x4C, 0xC9, 0x75, 0xBD, 0x95, 0x5C, 0xC1, 0xC8, 0xF2, 0xD6, 0x76, 0x77, 0xF8, 0xD1,
-    0x83, 0xD2, 0x25, 0xCD, 0xE7, 0xB8, 0x48, 0x66, 0xF2, 0x8D, 0xC3, 0x81, 0xEB, 0xFD, 0x84, 0xD8,
-    0x4D, 0x1E, 0x5F, 0x16, 0x56, 0xE6, 0x50, 0x3B, 0x43, 0xD3, 0xBD, 0x8C, 0xB9, 0xF0, 0xFD, 0x1A,
-    0x0E, 0x98, 0x3B, 0x20, 0x7E, 0x2C, 0xBD, 0x0B, 0xCB, 0xE8, 0x62, 0x9F, 0x8B, 0xE8, 0x04, 0x10,
-    0xCE, 0x6A, 0xDD, 0xDB, 0x1B, 0x93, 0x04, 0xF3, 0x06, 0xE0, 0x72, 0x99, 0x73, 0xD3, 0xEF, 0x19,
-    0x26, 0xB4, 0x57, 0x40, 0x29, 0x30, 0x34, 0x5C, 0x91, 0x11, 0xB9, 0x75, 0x9F, 0xC7, 0xC6, 0x82,
-    0x85, 0xC8, 0xA6, 0x08, 0x5D, 0x84, 0x68, 0x16, 0xD4, 0xAE, 0x58, 0xEC, 0x1F, 0xD4, 0xAD, 0xBD,
-    0x6B, 0xC4, 0xEE, 0xD4, 0xBE, 0x94, 0x32, 0xD2, 0x8D, 0x32, 0x11, 0x67, 0x13, 0xE6, 0xC3, 0xC8,
-    0x85, 0x83, 0x2E, 0x23, 0x31, 0x67, 0x84, 0xC8, 0xFE, 0x0D, 0x78, 0x2F, 0xEA, 0x48, 0x60, 0xDF,
-    0xE0, 0xDE, 0xE3, 0x84, 0x26, 0x64, 0x92, 0x7E, 0x8D, 0xB9, 0x09, 0x97, 0x27, 0xAD, 0x90, 0x82,
-    0x74, 0xBF, 0xEA, 0x8E, 0x36, 0xA1, 0x09, 0x17, 0x5C, 0x4E, 0xF7, 0xCF, 0x34, 0x6E, 0x89, 0x44,
-    0x48, 0xDC, 0x74, 0x34, 0x91, 0xBB, 0xF4, 0x91, 0xAE, 0x08, 0xF8, 0x5C, 0x1E, 0x49, 0xDB, 0x98,
-    0xE5, 0x20, 0x12, 0x14, 0x4D, 0x44, 0x89, 0x39, 0xD3, 0x46, 0xD9, 0x48, 0xC1, 0xE7, 0xDD, 0xE5,
-    0xAE, 0x77, 0x24, 0x8E, 0xA0, 0x2F, 0x1C, 0xEF, 0x9A, 0x89, 0x41, 0xBC, 0xBC, 0x28, 0x85, 0x13,
-    0x54, 0xFF, 0x69, 0xB9, 0xCD, 0x94, 0xED, 0xA0, 0x79, 0xB5, 0x67, 0xF4, 0xD8, 0x42, 0xA4, 0x4C,
-    0x36, 0x26, 0x31, 0x97, 0x80, 0xB9, 0x79, 0xDC, 0x22, 0x21, 0xC4, 0x6D, 0x54, 0x58, 0xC8, 0xBF,
-    0x08, 0xA3, 0x55, 0xA6, 0x55, 0xAA, 0x56, 0xD9, 0x4A, 0x83, 0x0E, 0x98, 0x9A, 0x1F, 0x45, 0xD4,
-    0xB8, 0xF5, 0xD6, 0x10, 0x65, 0x01, 0x74, 0xB5, 0x8F, 0x34, 0x89, 0x54, 0x8C, 0xD9, 0x00, 0x4E,
-    0x39, 0xC6, 0x2C, 0xB3, 0x16, 0xF3, 0xA1, 0x5A, 0xCC, 0x87, 0xF8, 0x03, 0xCA, 0xF5, 0x62, 0xA7,
-    0x9A, 0xC6, 0x2D, 0x37, 0x35, 0xE2, 0xF2, 0x70, 0x10, 0xFE, 0x19, 0xCD, 0x97, 0x46, 0x52, 0x86,
-    0x52, 0xD2, 0xF7, 0x5A, 0xF7, 0x8A, 0xF4, 0xC1, 0x9F, 0xB9, 0xEC, 0x34, 0x71, 0x25, 0xEA, 0xB1,
-    0xDC, 0x8C, 0xCE, 0x13, 0x23, 0xA5, 0xB2, 0x9A, 0x88, 0xA4, 0x25, 0xDE, 0x13, 0x2B, 0x89, 0x48,
-    0xF0, 0x7C, 0xD4, 0x89, 0xFB, 0xC4, 0x4C, 0x94, 0x89, 0x52, 0xC4, 0x0D, 0xFD, 0x57, 0xCB, 0x97,
-    0x34, 0x44, 0x28, 0x4C, 0x91, 0xD9, 0x91, 0x3A, 0x1A, 0x4A, 0xA4, 0xD2, 0x6F, 0xA1, 0x6C, 0x2C,
-    0x3B, 0x6B, 0xD6, 0xC5, 0x7A, 0xD2, 0x2D, 0xD6, 0x95, 0x57, 0xAF, 0xC5, 0x57, 0x0A, 0x3E, 0xD8,
-    0xDA, 0xDA, 0x3A, 0x50, 0xA5, 0x5F, 0x3D, 0x70, 0x8B, 0xB4, 0x47, 0xFF, 0xE6, 0x60, 0xEA, 0xDB,
-    0xFE, 0x7D, 0x86, 0xDE, 0x70, 0x55, 0x7C, 0x3C, 0x70, 0x87, 0xBD, 0x6D, 0x5D, 0x25, 0x0E, 0x0B,
-    0x32, 0x9B, 0xD5, 0xAC, 0xAA, 0xB3, 0x9C, 0x15, 0x76, 0x65, 0xAE, 0xB1, 0x84, 0xF5, 0xD8, 0xDE,
-    0x99, 0xA2, 0x06, 0x02, 0x4F, 0x69, 0xCE, 0x65, 0x24, 0xD2, 0x5E, 0x2E, 0x57, 0x71, 0x9F, 0x53,
-    0xA9, 0xB5, 0x7B, 0x28, 0x7B, 0xA7, 0x13, 0xAE, 0x04, 0x32, 0x1C, 0xB3, 0x4B, 0xF4, 0xFB, 0x19,
-    0xB1, 0xF2, 0x71, 0x97, 0xA6, 0x05, 0xE1, 0x75, 0x3A, 0x54, 0xAB, 0x75, 0x21, 0xDD, 0x9D, 0x62,
-    0x57, 0xEB, 0xE7, 0x52, 0x85, 0x1E, 0x60, 0x19, 0xB2, 0xAC, 0x78, 0x03, 0x5C, 0x2B, 0x45, 0x88,
-    0x00, 0x75, 0x7A, 0x4A, 0x4A, 0x29, 0xA4, 0x9C, 0xAD, 0x95, 0x64, 0xCA, 0x29, 0x7E, 0x83, 0xA0,
-    0x63, 0x1A, 0x28, 0x8C, 0x14, 0x1A, 0xCB, 0x53, 0x69, 0xAD, 0x2D, 0xD4, 0x48, 0x54, 0x9C, 0x48,
-    0x8A, 0x63, 0x50, 0xF6, 0xD7, 0xEB, 0xD9, 0xFF, 0x64, 0x18, 0x85, 0x67, 0xE6, 0x95, 0xCD, 0x99,
-    0xD0, 0xC9, 0xD9, 0xD7, 0x8B, 0xB5, 0xA7, 0x56, 0xDD, 0xAF, 0x6A, 0xB9, 0x82, 0xAF, 0xA2, 0xCE,
-    0xC6, 0x2D, 0xC3, 0xEB, 0x8E, 0xA4, 0x47, 0xD1, 0x72, 0xC7, 0x98, 0x93, 0x5C, 0x22, 0xC1, 0xF4,
-    0xB1, 0xFC, 0x0A, 0x5D, 0x20, 0x0B, 0x96, 0x2A, 0x1C, 0xAB, 0x0C, 0x3D, 0x15, 0xBB, 0x6F, 0xF5,
-    0xA9, 0x36, 0x7B, 0xCB, 0x53, 0xDA, 0x49, 0xC8, 0x78, 0x2A, 0x26, 0xA1, 0x45, 0x29, 0x04, 0xB4,
-    0xDC, 0x1D, 0x9E, 0x8B, 0xDB, 0x34, 0xB9, 0x5E, 0xB3, 0xD0, 0xE8, 0xC1, 0x80, 0x09, 0xB6, 0xC2,
-    0x8E, 0x17, 0x5C, 0x7E, 0x63, 0xB9, 0xF3, 0x47, 0x97, 0xE1, 0x64, 0x07, 0x59, 0xF2, 0x33, 0x2E,
-    0xDD, 0x77, 0xC4, 0xA9, 0x89, 0x94, 0x0D, 0xF5, 0x43, 0xCE, 0xE9, 0x7F, 0xFE, 0xFF, 0x87, 0x95,
-    0xA3, 0x96, 0x49, 0x96, 0x94, 0x89, 0xDF, 0x10, 0x60, 0xBE, 0x7D, 0x6C, 0x69, 0xF4, 0x45, 0x86,
-    0x82, 0x5B, 0xD4, 0x52, 0xBA, 0x20, 0xE9, 0xC7, 0x05, 0xEE, 0x78, 0xE0, 0xFB, 0x85, 0x12, 0xBE,
-    0xCF, 0x1C, 0x29, 0xBB, 0x77, 0x93, 0x3B, 0xC7, 0xD2, 0x89, 0x13, 0x33, 0xB3, 0xBC, 0xCD, 0xAB,
-    0x72, 0xE5, 0x10, 0xD2, 0x90, 0xAB, 0x3D, 0x29, 0xAB, 0x3D, 0xD9, 0x6E, 0xE8, 0xCB, 0x9E, 0x11,
-    0x5D, 0xE9, 0x65, 0x29, 0x16, 0x76, 0x91, 0xEC, 0xEB, 0x97, 0x2F, 0x4B, 0x91, 0x4C, 0xE0, 0x28,
-    0xDF, 0xAF, 0x64, 0xFA, 0xC6, 0x91, 0x06, 0xF3, 0xFF, 0x5B, 0xBE, 0x55, 0xF0, 0x50, 0xBB, 0x63,
-    0xF9, 0x72, 0xBF, 0xE4, 0x61, 0x01, 0xB3, 0x65, 0x23, 0xEC, 0xDC, 0x5B, 0xD2, 0xC7, 0xD4, 0x3D,
-    0x71, 0xD2, 0x38, 0x49, 0xB7, 0x97, 0x5F, 0x45, 0x5D, 0x34, 0xBB, 0x25, 0xB3, 0x78, 0xDF, 0x3B,
-    0xB0, 0x11, 0x2C, 0x5B, 0x35, 0xDA, 0x74, 0x05, 0x4C, 0x37, 0xE1, 0x8D, 0xBA, 0x3F, 0x6C, 0x93,
-    0xDD, 0x9F, 0xD7, 0x98, 0x75, 0x26, 0x7E, 0x69, 0x22, 0xF8, 0x64, 0x62, 0xC3, 0xEB, 0x5F, 0xB9,
-    0xA8, 0x74, 0xAD, 0x27, 0x99, 0x17, 0x76, 0x20, 0x71, 0x4D, 0x04, 0x28, 0x72, 0x4F, 0xDA, 0x7F,
-    0x51, 0xEF, 0xBE, 0xD4, 0x2A, 0xDF, 0x6F, 0xD5, 0x49, 0x01, 0x7F, 0x8A, 0x1F, 0xF9, 0x5D, 0xC1,
-    0x81, 0x3F, 0xC4, 0xAA, 0xF9, 0xE2, 0xE8, 0xF6, 0xD0, 0xF9, 0xFB, 0xB2, 0xB9, 0xA6, 0x39, 0xB1,
-    0x2E, 0x93, 0x2E, 0x5E, 0xA8, 0xA7, 0x26, 0xDD, 0xDC, 0x77, 0x63, 0xF1, 0x5D, 0xC6, 0xCD, 0x9D,
-    0x9D, 0xB5, 0x9E, 0x66, 0x27, 0xCB, 0xE7, 0x1D, 0x5B, 0x5A, 0x28, 0x93, 0xDD, 0x92, 0xFA, 0x63,
-    0xD7, 0xF5, 0xBF, 0x54, 0x4E, 0xFC, 0x5F, 0xE5, 0x5C, 0x3D, 0x8C, 0xE5, 0xD6, 0x79, 0xBD, 0x24,
-    0x77, 0x86, 0xB6, 0x18, 0x84, 0x6B, 0x40, 0x32, 0x6C, 0x6D, 0x2C, 0xAA, 0x70, 0x00, 0x27, 0x90,
-    0xCD, 0x14, 0x29, 0x52, 0x48, 0x4B, 0x4A, 0x02, 0x9C, 0xC2, 0x85, 0xA6, 0xD8, 0x51, 0x61, 0x15,
-    0x72, 0x19, 0x38, 0x80, 0x27, 0xA5, 0x0A, 0x69, 0x49, 0xAF, 0x0A, 0x17, 0x2E, 0xBC, 0x85, 0x37,
-    0x29, 0x52, 0x58, 0x85, 0x0D, 0xD8, 0x63, 0x20, 0xEB, 0x00, 0x2E, 0x8C, 0x44, 0x33, 0xA4, 0x2D,
-    0x04, 0x2E, 0x54, 0x84, 0x82, 0x0B, 0x95, 0x22, 0xA2, 0x15, 0x04, 0x5B, 0xC5, 0x52, 0x0A, 0x0D,
-    0x71, 0x57, 0x24, 0x6F, 0xBE, 0x73, 0xBE, 0xCB, 0xF7, 0xDE, 0xBC, 0x99, 0x95, 0x7F, 0x60, 0xC5,
-    0x5A, 0x79, 0xA0, 0x1D, 0x8E, 0xDE, 0x23, 0x2F, 0xEF, 0x3D, 0xDF, 0xFF, 0xCF, 0xBD, 0xC6, 0x18,
-    0xFF, 0xF0, 0xF0, 0xAA, 0x91, 0x8B, 0xB5, 0x83, 0x5C, 0x4C, 0x65, 0x27, 0x5C, 0x76, 0xF6, 0xF7,
-    0xCD, 0x9D, 0x7F, 0x22, 0xBD, 0x24, 0x0D, 0x2F, 0xF1, 0xA0, 0x1F, 0x5A, 0x5E, 0x02, 0x5B, 0xF3,
-    0xF2, 0x6E, 0x87, 0x8B, 0xD7, 0x73, 0x38, 0x33, 0x66, 0x25, 0x2E, 0x47, 0x71, 0x8B, 0x4B, 0xE6,
-    0x8F, 0xB8, 0xA4, 0x79, 0xC1, 0x61, 0x4A, 0x0E, 0x14, 0xD7, 0x41, 0x2F, 0x97, 0xB0, 0x35, 0x33,
-    0x9E, 0xEF, 0x4C, 0x26, 0x03, 0xF9, 0x83, 0x89, 0x30, 0x90, 0xB5, 0x9C, 0x57, 0x25, 0xD7, 0xDC,
-    0x98, 0xE2, 0xF0, 0xF0, 0xBA, 0x0C, 0x94, 0xE5, 0x26, 0x90, 0x81, 0x12, 0xB9, 0x4F, 0xDE, 0x1D,
-    0xCB, 0x20, 0x69, 0xCD, 0xDB, 0xA3, 0x1E, 0xCF, 0x1B, 0x6F, 0x36, 0x01, 0x9F, 0xBA, 0x91, 0xC8,
-    0xE2, 0x42, 0x6B, 0xBF, 0x65, 0xE5, 0x13, 0x6B, 0x1B, 0x8C, 0x37, 0x60, 0x34, 0x79, 0x53, 0xC2,
-    0x11, 0xCF, 0xFC, 0x39, 0x36, 0x7B, 0x82, 0xCB, 0x30, 0xE2, 0x51, 0x0C, 0x15, 0xDA, 0x5C, 0xDE,
-    0x57, 0xD4, 0x32, 0xFB, 0xA8, 0xF5, 0x46, 0x23, 0xF3, 0x95, 0x01, 0x46, 0x93, 0xC9, 0x8C, 0xF0,
-    0xEA, 0xB4, 0x94, 0xE5, 0xC5, 0x8D, 0x7C, 0x2C, 0x93, 0x18, 0x31, 0xB7, 0x42, 0x5E, 0x27, 0xF3,
-    0xF3, 0x6F, 0x96, 0x7F, 0xDF, 0xFB, 0xEF, 0x36, 0xFF, 0x6E, 0x83, 0xB7, 0xFB, 0x31, 0xB3, 0x7D,
-    0x31, 0x46, 0xB6, 0x4F, 0x26, 0x63, 0x5B, 0xB9, 0xC9, 0xCB, 0xCD, 0x79, 0x62, 0x55, 0x9A, 0x07,
-    0x09, 0x99, 0x79, 0x88, 0x94, 0x30, 0x17, 0x89, 0xCE, 0x6D, 0xAB, 0xB0, 0x2A, 0xBC, 0xE9, 0xAC,
-    0x73, 0xBB, 0x74, 0xE6, 0x8C, 0x7F, 0xC4, 0xDF, 0x9E, 0x62, 0x6E, 0x2C, 0x31, 0x37, 0x15, 0x29,
-    0x61, 0xB2, 0x51, 0x2F, 0x85, 0xD2, 0xEE, 0x09, 0x12, 0x2F, 0x7E, 0x89, 0xC4, 0x8B, 0x1A, 0x0E,
-    0x1B, 0x74, 0x29, 0x88, 0xE7, 0xF7, 0x21, 0x1E, 0xF1, 0x06, 0x1D, 0x68, 0x04, 0xD0, 0xC6, 0x5C,
-    0x36, 0x24, 0x5E, 0x46, 0xCC, 0x65, 0xAD, 0x32, 0x41, 0x79, 0xDE, 0x12, 0xCE, 0x48, 0x2E, 0x42,
-    0xBC, 0xF0, 0xF6, 0xE1, 0xA1, 0x0C, 0x04, 0x3A, 0x0A, 0xF1, 0x04, 0x21, 0x13, 0xCB, 0x40, 0x32,
-    0x08, 0xE8, 0x8D, 0xDB, 0xAB, 0x1C, 0x60, 0x99, 0xA4, 0x35, 0x19, 0x9E, 0x9A, 0x1F, 0xB5, 0x32,
-    0xC7, 0xC2, 0x0E, 0xD6, 0xCA, 0x27, 0xD6, 0x4D, 0x5B, 0x96, 0x1F, 0x80, 0x2B, 0x82, 0xDA, 0x84,
-    0x43, 0xD4, 0x82, 0x58, 0x2D, 0xE8, 0x84, 0xB7, 0x57, 0xE5, 0xE9, 0x45, 0xFB, 0x83, 0x20, 0x18,
-    0xD9, 0xD7, 0x3B, 0xD0, 0x72, 0x30, 0x31, 0x80, 0x8D, 0x3B, 0xCF, 0x82, 0x0A, 0x69, 0x29, 0x4B,
-    0x11, 0x92, 0x0C, 0x60, 0x88, 0x11, 0x53, 0xAA, 0x40, 0x57, 0xE1, 0xC6, 0x2C, 0x17, 0x86, 0x49,
-    0x6B, 0xF9, 0x58, 0xEE, 0x1D, 0x4D, 0x0C, 0x62, 0x45, 0xC7, 0x5E, 0xD2, 0x44, 0xAF, 0x3D, 0xF6,
-    0xF3, 0x31, 0xFE, 0xF9, 0x2F, 0x3A, 0x6B, 0x5F, 0xB1, 0x5D, 0x6A, 0x9B, 0xA2, 0x0F, 0x6C, 0x29,
-    0x0B, 0xD9, 0x31, 0x26, 0xFF, 0xC8, 0xA1, 0x1D, 0xB6, 0x2A, 0xBC, 0x2A, 0xCA, 0xA1, 0x5E, 0x02,
-    0x5D, 0x83, 0x71, 0x2B, 0xCB, 0x6E, 0x73, 0xDD, 0xA1, 0x4A, 0xB6, 0x29, 0x4A, 0x4C, 0xE8, 0x5E,
-    0x19, 0x7F, 0xCE, 0x8C, 0x67, 0x31, 0xA8, 0x7D, 0x54, 0xE6, 0x25, 0x9C, 0xDE, 0xC9, 0x7B, 0x45,
-    0x64, 0x0B, 0x3C, 0x0A, 0x8C, 0x45, 0xA8, 0x85, 0xFD, 0x85, 0x0E, 0x51, 0x0B, 0x12, 0xF4, 0xF2,
-    0xB1, 0x4F, 0x79, 0x81, 0x54, 0x18, 0x5B, 0xCB, 0xCA, 0xFF, 0xB3, 0xFD, 0xC4, 0x64, 0x8E, 0xFA,
-    0x87, 0x8A, 0x7A, 0x7C, 0x2E, 0x8B, 0xED, 0x94, 0x58, 0xDF, 0x42, 0xD2, 0xB2, 0x01, 0x42, 0xBD,
-    0x67, 0x62, 0xBC, 0x9B, 0xBF, 0x22, 0xBC, 0x3E, 0x68, 0x89, 0x15, 0xE7, 0x71, 0x8D, 0x90, 0xE4,
-    0xBA, 0xD2, 0xD5, 0x4F, 0x58, 0xAA, 0xF4, 0x60, 0xE5, 0x23, 0x25, 0x07, 0x8B, 0x2A, 0xB0, 0x96,
-    0x80, 0xB8, 0x7F, 0x7C, 0x9B, 0x81, 0x76, 0x0F, 0x73, 0xAC, 0x4E, 0x78, 0x07, 0xAB, 0x19, 0x4D,
-    0x32, 0xEF, 0x57, 0xAD, 0x2F, 0x03, 0xA7, 0xA5, 0x60, 0x67, 0x8E, 0x30, 0x11, 0xBF, 0x03, 0xB8,
-    0x71, 0x59, 0xC8, 0xAD, 0x9F, 0x23, 0x4D, 0x9C, 0xFA, 0xE3, 0x8B, 0xF4, 0x03, 0xA7, 0xDC, 0xCA,
-    0x15, 0x53, 0x84, 0x9C, 0x67, 0xA2, 0x1F, 0x13, 0x3C, 0x95, 0x65, 0x7E, 0x19, 0xE1, 0x99, 0x46,
-    0xF8, 0x4E, 0xF4, 0xA0, 0x48, 0xF5, 0x05, 0xC1, 0x45, 0xDE, 0x2E, 0x5A, 0x84, 0xBA, 0x29, 0x52,
-    0xFA, 0x6C, 0x88, 0x79, 0x90, 0x83, 0x57, 0x74, 0x68, 0x6F, 0x76, 0x63, 0x1D, 0x93, 0x55, 0x8C,
-    0xF9, 0xCC, 0xF6, 0x9A, 0x0E, 0xAE, 0xCA, 0x62, 0x66, 0xA8, 0xF5, 0xDA, 0x9F, 0x9E, 0x82, 0xB6,
-    0x3A, 0x6F, 0x46, 0xF7, 0x00, 0x98, 0x02, 0xAC, 0x87, 0xF9, 0x06, 0x6E, 0x44, 0x83, 0x85, 0x61,
-    0x45, 0x61, 0x6F, 0x3C, 0x19, 0x3E, 0xAC, 0xB3, 0x26, 0x6A, 0x23, 0xB0, 0x0A, 0xFE, 0xC5, 0xE0,
-    0xEE, 0x7B, 0x37, 0x5F, 0xA0, 0x8C, 0x53, 0xB4, 0x64, 0x0C, 0xFC, 0x2E, 0xAE, 0xE3, 0xE9, 0x01,
-    0x03, 0x17, 0x79, 0x9A, 0x83, 0x89, 0x1E, 0xBE, 0xDB, 0x70, 0xDE, 0x93, 0x09, 0x00, 0x5E, 0x70,
-    0x3A, 0x44, 0x6C, 0x94, 0xB7, 0x4E, 0xA2, 0x27, 0x26, 0xE1, 0xB8, 0x23, 0xD1, 0xC7, 0x9F, 0x86,
-    0x12, 0x58, 0x7E, 0xBC, 0xE3, 0x5C, 0x56, 0x33, 0x40, 0x1C, 0x4D, 0xF4, 0xEB, 0x03, 0x68, 0x9A,
-    0x1C, 0x92, 0xE3, 0x0F, 0x14, 0x63, 0x9D, 0x32, 0x66, 0x19, 0x2B, 0xAC, 0x27, 0x70, 0x3E, 0x27,
-    0x73, 0x4E, 0x8C, 0xCD, 0xD3, 0x52, 0xE6, 0x51, 0x06, 0x10, 0xA2, 0x6C, 0xD6, 0x19, 0x98, 0xE5,
-    0xA2, 0xEB, 0xA4, 0xD4, 0x05, 0x5C, 0x50, 0x4C, 0xB9, 0xBC, 0xFF, 0x4C, 0xD5, 0xEF, 0xC1, 0x8C,
-    0x7B, 0x30, 0x54, 0x22, 0xE2, 0x32, 0xA3, 0xD0, 0x5E, 0x3B, 0x18, 0x4C, 0xD5, 0x88, 0xE8, 0x01,
-    0x9E, 0x34, 0x07, 0x30, 0x2F, 0x02, 0xC0, 0xA0, 0x05, 0xA2, 0xF7, 0x28, 0x46, 0x98, 0x97, 0x72,
-    0xC3, 0x02, 0xDA, 0xB0, 0x7E, 0x35, 0xE6, 0xAA, 0xBC, 0xE6, 0x20, 0xD6, 0x09, 0x38, 0x88, 0x73,
-    0xBA, 0x0D, 0xF2, 0xEB, 0x6F, 0x31, 0xBB, 0xA8, 0x89, 0x6C, 0xB9, 0x6B, 0xA9, 0xA3, 0x3A, 0x60,
-    0x32, 0xD3, 0xA9, 0xC0, 0x4D, 0xF7, 0xA9, 0x9A, 0x2E, 0xF9, 0x24, 0x9E, 0x80, 0xC7, 0x80, 0x57,
-    0x9E, 0x3F, 0xB9, 0x02, 0xC1, 0xB3, 0xB0, 0x25, 0xE0, 0xAC, 0x9E, 0x1C, 0x80, 0x66, 0xA6, 0x60,
-    0x8A, 0x12, 0x01, 0x96, 0x98, 0x19, 0xA0, 0x94, 0x59, 0x01, 0x49, 0xCC, 0x1C, 0x40, 0x16, 0xA5,
-    0xD7, 0x09, 0x8E, 0x57, 0x84, 0x9C, 0x01, 0xA1, 0x6C, 0x1D, 0x7C, 0x62, 0x15, 0xEE, 0x85, 0xD6,
-    0xC0, 0xCD, 0x51, 0x87, 0xDB, 0x83, 0x01, 0x2B, 0xF7, 0x66, 0xF2, 0x52, 0x45, 0x5E, 0xCA, 0xB8,
-    0xA2, 0xB8, 0xDE, 0x86, 0xF3, 0xAB, 0xDF, 0x35, 0xF4, 0x0D, 0x5A, 0xC7, 0xAB, 0x0A, 0x67, 0xDA,
-    0x53, 0xBD, 0x95, 0x10, 0x44, 0x32, 0xAB, 0xE2, 0x89, 0xB1, 0xFD, 0x52, 0xC1, 0x51, 0x6E, 0x55,
-    0x40, 0x15, 0x28, 0x75, 0x7D, 0xF4, 0x37, 0x11, 0xA5, 0x06, 0x5D, 0x7E, 0x67, 0x9B, 0x77, 0xEA,
-    0xB3, 0x1D, 0x84, 0x5D, 0x19, 0x56, 0x31, 0x0D, 0x38, 0x05, 0x78, 0x3F, 0xED, 0x8A, 0x63, 0xEF,
-    0xD3, 0x25, 0x7A, 0x57, 0x4D, 0x0A, 0xF3, 0x70, 0x04, 0xA5, 0x3F, 0x8A, 0x52, 0x0D, 0x6E, 0x8D,
-    0xCE, 0x09, 0x23, 0xE3, 0xC7, 0xCD, 0x29, 0x4E, 0xB9, 0x70, 0xC3, 0x90, 0x6F, 0x65, 0xBC, 0x8E,
-    0x8C, 0x2B, 0xFA, 0xFA, 0x9C, 0xEA, 0xFC, 0xB4, 0x74, 0xAC, 0x4B, 0xA7, 0x8B, 0x53, 0x9E, 0x16,
-    0x26, 0xE1, 0xC2, 0x30, 0x7F, 0xE0, 0x99, 0x93, 0x7D, 0xE3, 0x5E, 0xD0, 0x48, 0xC9, 0xBB, 0x18,
-    0x8F, 0x0C, 0xEC, 0x04, 0xE4, 0x41, 0xFD, 0x63, 0x50, 0x24, 0x26, 0xFA, 0x74, 0xA6, 0x52, 0xE6,
-    0xCA, 0x5E, 0x23, 0x77, 0x25, 0x6A, 0x31, 0x23, 0xF5, 0x68, 0xFC, 0xFE, 0x34, 0x4F, 0xDF, 0x7F,
-    0xE8, 0xA8, 0x00, 0x15, 0x9E, 0x29, 0x08, 0x7F, 0x59, 0x99, 0xA7, 0xC1, 0x55, 0x95, 0x4A, 0xE9,
-    0xAC, 0x24, 0x94, 0x29, 0xC5, 0x3D, 0x6D, 0x60, 0x34, 0xD0, 0xFE, 0x85, 0xF4, 0xBF, 0xF0, 0x0F,
-    0xEF, 0x0C, 0xE8, 0xAC, 0xE1, 0x02, 0x5B, 0x2B, 0x97, 0x48, 0x2F, 0x20, 0x99, 0x7C, 0x0F, 0x6E,
-    0x97, 0x35, 0x62, 0x85, 0xF0, 0x19, 0x6A, 0x32, 0x3A, 0x2E, 0x69, 0x43, 0x10, 0x84, 0x3A, 0xB8,
-    0x58, 0xAE, 0x1F, 0x5A, 0xA5, 0x52, 0x1E, 0x96, 0x0F, 0x44, 0xC0, 0x76, 0xED, 0xE1, 0x75, 0xAB,
-    0x52, 0xD7, 0x92, 0x48, 0xB7, 0xB6, 0xD7, 0xF1, 0x15, 0xBD, 0x8C, 0x1B, 0x97, 0x1D, 0xCC, 0xD5,
-    0x5C, 0xB0, 0x8F, 0x61, 0xD9, 0x99, 0x7D, 0x1C, 0x78, 0xDF, 0x57, 0x3D, 0xAE, 0x62, 0x17, 0x90,
-    0x1B, 0x2A, 0xB5, 0x64, 0xC7, 0xDE, 0xA6, 0x2D, 0xD6, 0x31, 0x3C, 0xF5, 0x9F, 0xAF, 0x0C, 0x14,
-    0xC1, 0xDB, 0x83, 0xFA, 0x06, 0x1C, 0xAA, 0x29, 0xE8, 0x2F, 0xC3, 0x16, 0x1B, 0x3A, 0xAA, 0x34,
-    0xE7, 0x60, 0x03, 0xF9, 0x13, 0x7C, 0x4E, 0x93, 0x4C, 0xAF, 0x39, 0xA5, 0x21, 0xA7, 0xBF, 0x21,
-    0xFF, 0x2A, 0xB5, 0x0C, 0x10, 0xE8, 0x42, 0xF5, 0x0D, 0x1D, 0x22, 0x6A, 0xF3, 0xE7, 0xC4, 0xE3,
-    0xA7, 0x81, 0xC6, 0x5C, 0xC5, 0x7B, 0x95, 0xE7, 0xE0, 0x17, 0xC9, 0x60, 0xB3, 0xB2, 0xEE, 0x9E,
-    0x70, 0xD0, 0x07, 0x43, 0x31, 0xEF, 0xA9, 0x5F, 0xEF, 0xCB, 0x05, 0x3E, 0x8F, 0x78, 0xDF, 0xD0,
-    0x2E, 0x1F, 0x3C, 0xC5, 0xC8, 0xBA, 0x07, 0xF4, 0x18, 0x08, 0xEA, 0xCE, 0x01, 0xA5, 0x88, 0xBE,
-    0x1C, 0x43, 0x97, 0x94, 0x8A, 0x8D, 0x31, 0x89, 0xB7, 0x3F, 0x41, 0xDB, 0xD0, 0x87, 0xDB, 0x03,
-    0xA2, 0xC5, 0x70, 0x4C, 0x17, 0x4D, 0x1E, 0xAC, 0xDE, 0x92, 0x05, 0x47, 0x3D, 0x54, 0x5E, 0x61,
-    0xD4, 0x01, 0xA2, 0xD3, 0x09, 0x9C, 0x27, 0xAC, 0x3D, 0x84, 0x67, 0xE4, 0x68, 0x40, 0xD7, 0x88,
-    0xEE, 0xA8, 0xFA, 0x46, 0x0A, 0xBF, 0x47, 0xE7, 0x28, 0xA4, 0x43, 0x4A, 0xEF, 0xC8, 0x21, 0xAF,
-    0xEE, 0xD1, 0xCA, 0x25, 0x3D, 0x04, 0xEE, 0x1A, 0xC3, 0xF9, 0xCA, 0x08, 0xFB, 0xFB, 0x7B, 0x67,
-    0x58, 0x09, 0x89, 0xEB, 0x24, 0xB2, 0x03, 0x7D, 0x66, 0xF7, 0xDB, 0x54, 0x87, 0x87, 0x13, 0x81,
-    0x79, 0x96, 0xB4, 0x79, 0x96, 0xA4, 0x79, 0x86, 0x52, 0xBE, 0xA7, 0xAB, 0x75, 0x66, 0x57, 0x85,
-    0x97, 0x41, 0x1A, 0x7C, 0xCF, 0x9F, 0x70, 0x95, 0xE3, 0xC2, 0x79, 0x6A, 0x31, 0x36, 0xB5, 0x5F,
-    0xBA, 0x68, 0x3F, 0x9F, 0xBF, 0x85, 0x9B, 0x85, 0x16, 0x31, 0x3D, 0x59, 0x71, 0x0F, 0x2C, 0xB8,
-    0x6D, 0xD7, 0x82, 0x9E, 0x05, 0xA3, 0xBB, 0x4A, 0xB9, 0x25, 0x82, 0x6D, 0xC6, 0x5F, 0xB1, 0xB5,
-    0xF5, 0x19, 0x2B, 0xD8, 0x85, 0xCB, 0x2B, 0x5F, 0x8B, 0x16, 0x6F, 0xC4, 0xF5, 0x91, 0x65, 0x94,
-    0xE2, 0x5C, 0x76, 0xF2, 0xC7, 0x91, 0xBC, 0x31, 0xAE, 0x05, 0xEE, 0x41, 0x08, 0x9E, 0x7D, 0x51,
-    0xD8, 0xE5, 0x3D, 0xFA, 0xBB, 0x62, 0xA5, 0x6F, 0x39, 0xEA, 0x09, 0xDE, 0x1E, 0x66, 0xF1, 0xE3,
-    0x00, 0x81, 0x40, 0x0A, 0x2E, 0x85, 0xB5, 0x0A, 0xEC, 0x0D, 0x9A, 0x0B, 0x95, 0xD5, 0x8F, 0x2D,
-    0x31, 0x98, 0x2C, 0x7E, 0x80, 0x4D, 0xBD, 0xAE, 0x11, 0x68, 0xBD, 0x0A, 0xBF, 0xBC, 0xBD, 0xBB,
-    0x0D, 0x55, 0xFE, 0x3C, 0x63, 0x76, 0x45, 0xFA, 0x7D, 0x59, 0xF3, 0xA3, 0x23, 0xDE, 0x22, 0xE1,
-    0x01, 0xC4, 0xB4, 0x38, 0x65, 0x22, 0x0E, 0x10, 0x5C, 0xCB, 0x7A, 0x93, 0xB7, 0x26, 0xF1, 0xF3,
-    0xE2, 0x56, 0xBC, 0x9F, 0x63, 0x38, 0xF3, 0x6D, 0xD4, 0xC8, 0xD4, 0x05, 0x3A, 0x71, 0x5B, 0x32,
-    0x89, 0x73, 0x0F, 0x84, 0x0F, 0x2B, 0x44, 0xD6, 0x32, 0xD3, 0xE2, 0xAA, 0x13, 0x02, 0xC1, 0xF9,
-    0xBC, 0x88, 0x66, 0x24, 0x0E, 0x47, 0xD4, 0xF9, 0x98, 0x43, 0x8C, 0xD8, 0x35, 0x9B, 0xF3, 0xB5,
-    0x07, 0x49, 0xC3, 0xEF, 0xAB, 0xEF, 0x46, 0x44, 0xA3, 0xB5, 0xAB, 0x66, 0xFC, 0xAB, 0xE6, 0xAE,
-    0xE4, 0x5C, 0x7A, 0x38, 0xB0, 0x28, 0x30, 0xE0, 0x59, 0xAB, 0xC3, 0x9C, 0x3B, 0x0D, 0x2D, 0xB8,
-    0x17, 0xC8, 0x0A, 0xF3, 0x02, 0x58, 0xF0, 0x2E, 0x70, 0x05, 0xEB, 0x02, 0x56, 0x70, 0x2E, 0x50,
-    0x05, 0xE3, 0x02, 0xD4, 0xC2, 0x61, 0x0A, 0xB6, 0x05, 0xA4, 0xE0, 0x5A, 0x20, 0x4A, 0xA6, 0xBD,
-    0xF7, 0x2E, 0xE1, 0xBE, 0x40, 0x47, 0xA2, 0x88, 0x31, 0xAD, 0x21, 0xD2, 0x8A, 0x1F, 0xB5, 0xFD,
-    0xD5, 0x2F, 0xCD, 0x12, 0xA2, 0x21, 0x77, 0xF3, 0x87, 0x45, 0x49, 0xDE, 0xFF, 0x49, 0x21, 0x48,
-    0x58, 0x6B, 0x18, 0x99, 0xBA, 0x00, 0x28, 0x7B, 0x03, 0x76, 0x6A, 0x71, 0x6C, 0x4B, 0xF3, 0xA9,
-    0x95, 0xB7, 0x92, 0xE5, 0xF8, 0x1D, 0xF5, 0x34, 0x6C, 0x96, 0x5E, 0x1A, 0xC3, 0x1F, 0xD1, 0x04,
-    0xA5, 0xE6, 0xAB, 0xB6, 0x68, 0x0A, 0xFC, 0xF7, 0xB8, 0xE2, 0x61, 0x21, 0x40, 0xFA, 0xAB, 0x43,
-    0x89, 0x49, 0x85, 0x19, 0xE4, 0xB5, 0x82, 0xB1, 0xD7, 0x39, 0x0A, 0x00, 0xAE, 0x7B, 0x17, 0x18,
-    0xD5, 0x61, 0x54, 0x12, 0x38, 0xFB, 0x5E, 0x1C, 0xFE, 0xB0, 0xA4, 0x79, 0xE9, 0x16, 0x1A, 0xE8,
-    0xD7, 0x2E, 0xC9, 0x50, 0x99, 0x35, 0x11, 0x40, 0x9C, 0x92, 0x5F, 0x2B, 0x61, 0x2F, 0x1A, 0x47,
-    0x05, 0x99, 0xB7, 0xD8, 0xF8, 0x03, 0xF8, 0xE1, 0xF0, 0x5D, 0x65, 0x90, 0x85, 0x0C, 0xBF, 0x9F,
-    0xBB, 0x38, 0xA8, 0xC2, 0x95, 0x00, 0xAF, 0xA7, 0x36, 0x10, 0x92, 0xA4, 0x25, 0x35, 0xAE, 0xF8,
-    0xA7, 0x1D, 0xD5, 0x41, 0xD4, 0x8A, 0x2D, 0x07, 0x49, 0xCC, 0x2C, 0x16, 0x95, 0xFA, 0x20, 0xB9,
-    0xE1, 0x74, 0x2E, 0x4C, 0x7C, 0x4E, 0x85, 0x10, 0x77, 0xF2, 0x56, 0x2A, 0xDD, 0x0C, 0xE3, 0x51,
-    0x23, 0xEC, 0x9C, 0xC8, 0xE4, 0xA8, 0x33, 0xAE, 0x8E, 0x39, 0xA3, 0x11, 0xC2, 0x1F, 0x8C, 0x60,
-    0xC1, 0xB8, 0x45, 0xC8, 0x99, 0xE6, 0xDE, 0xF6, 0x14, 0xBF, 0xFA, 0x3D, 0xB5, 0xC8, 0x3D, 0x5D,
-    0xF5, 0x59, 0x38, 0xF8, 0x9A, 0xD8, 0x6E, 0x71, 0xD5, 0x05, 0x53, 0xE4, 0x8B, 0x46, 0x46, 0x30,
-    0x03, 0x19, 0x5E, 0x73, 0x2D, 0x57, 0xDF, 0xDF, 0x55, 0x47, 0x80, 0xB1, 0xBF, 0x5F, 0x20, 0xA9,
-    0x34, 0xF3, 0xF7, 0x08, 0xB7, 0x37, 0xEA, 0x30, 0x97, 0xA8, 0xCB, 0x18, 0x39, 0x67, 0x9C, 0x11,
-    0x24, 0x3D, 0x66, 0x6C, 0x99, 0xD4, 0x11, 0x8C, 0x4D, 0xED, 0x5B, 0x26, 0x44, 0x2A, 0x72, 0x81,
-    0xC8, 0x12, 0x74, 0xD9, 0x7D, 0x7B, 0x1B, 0x6E, 0x85, 0x0B, 0x53, 0x75, 0x91, 0xCA, 0x57, 0xD1,
-    0xAB, 0x98, 0x4E, 0xD4, 0x1E, 0xF3, 0x37, 0x7C, 0xB4, 0xB0, 0x25, 0x14, 0x57, 0x99, 0x10, 0x3C,
-    0x11, 0x23, 0xFD, 0xDB, 0xF7, 0xF6, 0x19, 0x43, 0xC3, 0xAA, 0xCD, 0x95, 0xD0, 0x2D, 0xEC, 0x83,
-    0xB7, 0x19, 0x6C, 0x4F, 0x0C, 0x96, 0x84, 0xFE, 0x42, 0x11, 0x90, 0x31, 0xA3, 0x4B, 0x2F, 0xFA,
-    0x1E, 0xF4, 0xEB, 0xE9, 0x31, 0xDA, 0x2F, 0x8E, 0xF4, 0xCE, 0x06, 0x32, 0x33, 0x85, 0x3E, 0xA1,
-    0xB2, 0x65, 0xCA, 0x89, 0x6E, 0xE1, 0xA2, 0x8A, 0x19, 0xFE, 0x42, 0x96, 0x65, 0xA4, 0xE4, 0x56,
-    0x21, 0xC4, 0x48, 0x5B, 0xE4, 0xB6, 0x04, 0xAD, 0x60, 0x26, 0xEF, 0x65, 0xCC, 0xD7, 0xCA, 0x5F,
-    0x96, 0xAE, 0x98, 0xE0, 0x2D, 0x9C, 0x12, 0x50, 0x08, 0x94, 0x1A, 0x22, 0xC6, 0x73, 0xBE, 0x4E,
-    0x6C, 0x46, 0xB5, 0xE9, 0x48, 0x45, 0xE6, 0xA2, 0xAA, 0x7A, 0x95, 0xD3, 0xAC, 0xFA, 0x35, 0x38,
-    0x77, 0x25, 0x5D, 0x35, 0x0B, 0x6E, 0x0C, 0x84, 0xA8, 0x81, 0xA8, 0xFB, 0xD3, 0x2E, 0xD6, 0x54,
-    0x10, 0xE8, 0x48, 0x81, 0x3E, 0x68, 0xCF, 0x4E, 0x32, 0xEF, 0xFE, 0xC7, 0xB5, 0x4B, 0xF4, 0x98,
-    0x27, 0xE6, 0x7A, 0x2D, 0xA6, 0x1F, 0xFF, 0xD7, 0x92, 0x0E, 0x17, 0xEF, 0xF0, 0x48, 0x93, 0xE1,
-    0x4A, 0x57, 0xA8, 0x27, 0xFA, 0xF4, 0x71, 0xC3, 0x48, 0x66, 0xBA, 0x40, 0x93, 0x6B, 0x35, 0x0D,
-    0xC3, 0x75, 0x5F, 0xCE, 0x37, 0xD4, 0x89, 0xEA, 0x8B, 0xDE, 0xAC, 0xF2, 0x60, 0x17, 0x34, 0x81,
-    0xFE, 0x06, 0xE3, 0xC9, 0xD2, 0x17, 0x06, 0x52, 0xCF, 0x58, 0xBD, 0x65, 0xF2, 0x4D, 0xC9, 0xA4,
-    0x7A, 0x03, 0x47, 0xF9, 0xA0, 0x65, 0x3C, 0xAF, 0x4E, 0x32, 0x42, 0xE7, 0xCA, 0x79, 0xCA, 0xEA,
-    0x2C, 0x45, 0x0A, 0x77, 0xBF, 0x0E, 0xA4, 0x33, 0xAE, 0xF2, 0x9E, 0x3B, 0x64, 0xD4, 0xEF, 0x1A,
-    0x8A, 0x7E, 0xDA, 0xAC, 0xDF, 0xA4, 0xCB, 0x53, 0xD7, 0xC4, 0xA9, 0xE1, 0x73, 0x77, 0x28, 0x18,
-    0xDC, 0xFF, 0x2B, 0x38, 0xDD, 0x05, 0x99, 0xBF, 0x78, 0x8B, 0x3A, 0x33, 0xCF, 0xEE, 0x05, 0xC9,
-    0x58, 0x9C, 0x28, 0x11, 0xE3, 0x0A, 0x09, 0x27, 0xA5, 0x28, 0xA3, 0x39, 0x44, 0x0C, 0x59, 0x0E,
-    0xC9, 0x8B, 0xFB, 0x83, 0x9A, 0x19, 0x9C, 0x92, 0x32, 0xCA, 0xD4, 0xCB, 0xAD, 0xB5, 0x75, 0xD6,
-    0x90, 0x0F, 0x44, 0x59, 0x65, 0x3D, 0x0F, 0x18, 0x7F, 0xD8, 0x7F, 0x11, 0x63, 0xE1, 0x03, 0x4C,
-    0x5A, 0xF6, 0x8C, 0xF5, 0x93, 0x40, 0xD3, 0xC8, 0x33, 0x6D, 0x4C, 0x91, 0xFB, 0x36, 0xF7, 0xAA,
-    0x92, 0x01, 0x59, 0x89, 0x00, 0x01, 0x8F, 0xEF, 0xC2, 0x7F, 0xB8, 0xEB, 0xE4, 0x2C, 0x53, 0x14,
-    0x36, 0x52, 0x2A, 0xAA, 0xBB, 0x8A, 0xB5, 0x11, 0x75, 0xDE, 0xCC, 0x62, 0xA5, 0xC3, 0x7A, 0x9D,
-    0xAE, 0xD4, 0xDF, 0x9A, 0xDE, 0xF6, 0x4F, 0xD8, 0xDD, 0x7C, 0xAD, 0x9A, 0xC3, 0xD1, 0x55, 0x7F,
-    0xB6, 0x7F, 0xFE, 0xF1, 0x07, 0xFB, 0x39, 0x31, 0x6A, 0x10, 0x14, 0x08, 0xEA, 0xC2, 0x0E, 0xE3,
-    0xDE, 0x92, 0xB2, 0x3F, 0x66, 0x12, 0x3D, 0xE3, 0xEB, 0x85, 0xC8, 0x23, 0xDF, 0x73, 0xCC, 0x37,
-    0x60, 0x72, 0xD9, 0x2B, 0x15, 0x65, 0x74, 0x5E, 0xBB, 0x3A, 0x21, 0x09, 0xA0, 0x26, 0x37, 0xD4,
-    0x39, 0x69, 0x2D, 0x2A, 0xC3, 0xD7, 0x5E, 0xC5, 0x24, 0xFF, 0xFC, 0x34, 0x62, 0x48, 0x51, 0xEC,
-    0x9A, 0xB4, 0xB0, 0x25, 0xD3, 0x60, 0x54, 0xF7, 0xF2, 0x17, 0x12, 0xFF, 0x13, 0x54, 0x36, 0xC2,
-    0x22, 0xBB, 0x80, 0x36, 0x51, 0xD0, 0x4F, 0xB9, 0xD1, 0xCF, 0xB9, 0x6B, 0xE5, 0x2C, 0x68, 0xE1,
-    0x72, 0x0A, 0x55, 0xA1, 0x81, 0x56, 0xF5, 0xB8, 0xE3, 0xB1, 0x5C, 0x51, 0xBE, 0x6C, 0x82, 0x33,
-    0xCA, 0x2D, 0x8C, 0x2C, 0xD5, 0xE1, 0x19, 0x68, 0xC8, 0x61, 0x4F, 0x62, 0xBC, 0x33, 0x6D, 0x68,
-    0x25, 0xC8, 0x73, 0xA1, 0x66, 0x56, 0xD4, 0xD9, 0x9C, 0x9C, 0xA7, 0x07, 0x94, 0x41, 0x34, 0xB0,
-    0x0C, 0x4D, 0x7A, 0xA7, 0x3A, 0xC4, 0x05, 0xFC, 0x1B, 0x37, 0x5A, 0xE5, 0xD1, 0xD4, 0x6A, 0x26,
-    0x01, 0x4A, 0xC8, 0x6E, 0xDC, 0xE8, 0x2D, 0x37, 0x56, 0x6E, 0xD4, 0x54, 0x33, 0x1A, 0x34, 0x4C,
-    0xD1, 0xFB, 0xDD, 0x08, 0xEE, 0xC3, 0xCD, 0x07, 0x22, 0x5A, 0xE9, 0x2D, 0x50, 0xB3, 0x65, 0x08,
-    0x08, 0xB0, 0x0B, 0xF5, 0x55, 0xFF, 0x9A, 0xD8, 0x30, 0xDB, 0x85, 0xFF, 0x2F, 0x60, 0xAA, 0x8A,
-    0xE7, 0x07, 0x3C, 0x5F, 0x80, 0xC0, 0xE1, 0x49, 0x50, 0xF6, 0x96, 0xB0, 0x30, 0x85, 0x17, 0xB5,
-    0xF3, 0x74, 0xBB, 0xB0, 0xA0, 0x4A, 0x2C, 0x19, 0x93, 0x79, 0x35, 0x12, 0x9A, 0xBC, 0x27, 0xDF,
-    0x7C, 0x0D, 0x89, 0x1D, 0x79, 0x6F, 0xF6, 0x18, 0x02, 0xA4, 0x97, 0xA6, 0x2A, 0x0F, 0xDF, 0xE9,
-    0xE3, 0xC6, 0xBF, 0xDD, 0x83, 0x6B, 0x60, 0xAE, 0x25, 0xC2, 0xAF, 0xE0, 0x26, 0x64, 0x65, 0x08,
-    0x83, 0x2E, 0x12, 0x2E, 0x98, 0x5A, 0xB0, 0xAD, 0x40, 0x38, 0x01, 0xBF, 0x0C, 0x4B, 0x4D, 0xEA,
-    0xC7, 0x07, 0xB1, 0x08, 0x3F, 0x9A, 0x8C, 0x7F, 0x6B, 0x44, 0xFE, 0x66, 0x12, 0x1C, 0xB2, 0x49,
-    0x6C, 0x44, 0x34, 0xB8, 0xE9, 0xA1, 0x98, 0x8B, 0x7F, 0xA1, 0x66, 0x9A, 0x6B, 0xEA, 0x18, 0xE0,
-    0x8A, 0x08, 0xCC, 0x5F, 0x4A, 0x09, 0x85, 0x59, 0x11, 0xE7, 0x9E, 0xEB, 0xB7, 0x0F, 0x0F, 0xAF,
-    0xDF, 0xBE, 0x0A, 0x6B, 0x4E, 0x07, 0xF2, 0x87, 0xF3, 0xE1, 0xE1, 0xE1, 0xFC, 0x7D, 0xBD, 0x71,
-    0x49, 0x6B, 0x53, 0x90, 0x1B, 0xC5, 0x3C, 0xD4, 0xFB, 0xA8, 0x5B, 0xC8, 0x7E, 0x7C, 0x70, 0xE3,
-    0xC6, 0xA4, 0x59, 0x13, 0x87, 0xE9, 0xD2, 0xD1, 0x01, 0x34, 0x6F, 0x8D, 0xB8, 0x7D, 0x23, 0xA8,
-    0x88, 0x9B, 0x77, 0x85, 0x9F, 0x7D, 0xF9, 0x97, 0x08, 0x8F, 0xC3, 0xB1, 0x47, 0xFC, 0x1A, 0x32,
-    0x28, 0xA7, 0x2D, 0xAA, 0x06, 0x96, 0x87, 0xA1, 0x2D, 0x8A, 0x15, 0xD8, 0x60, 0x42, 0x4D, 0x89,
-    0x57, 0x60, 0xA7, 0x9D, 0xE2, 0x5A, 0xEE, 0x72, 0xBD, 0xF2, 0x8D, 0x04, 0x42, 0x03, 0xE4, 0x6D,
-    0x0A, 0x41, 0x06, 0x64, 0x55, 0x93, 0x97, 0xBB, 0x22, 0x8F, 0xDE, 0x14, 0x0F, 0xCC, 0x7F, 0xB7,
-    0x05, 0xD8, 0xF0, 0x57, 0x33, 0x38, 0xBA, 0x62, 0x03, 0xB2, 0x5C, 0xF0, 0x4C, 0x6A, 0xCD, 0x1D,
-    0xCE, 0xA0, 0xB0, 0xB0, 0xD3, 0x08, 0xB4, 0x0A, 0x4F, 0xE6, 0x9B, 0x5E, 0x79, 0xA9, 0x37, 0xF1,
-    0x9B, 0xDD, 0x88, 0x94, 0x51, 0x01, 0xF7, 0x49, 0x68, 0x9E, 0xB6, 0x8B, 0xA9, 0xFC, 0x2B, 0x93,
-    0x9B, 0x64, 0x88, 0x05, 0xA7, 0x5F, 0x08, 0x79, 0x2B, 0x59, 0xC2, 0x15, 0x99, 0xFA, 0x3F, 0x45,
-    0xED, 0x19, 0xB2, 0x25, 0xBE, 0x80, 0x33, 0x03, 0x28, 0x6B, 0x51, 0xD5, 0xCE, 0x6E, 0x45, 0x64,
-    0x67, 0xB0, 0x2F, 0xA5, 0x05, 0x90, 0x91, 0xD3, 0x8A, 0xC5, 0x16, 0x5B, 0x17, 0x17, 0xAC, 0xEE,
-    0xF3, 0x57, 0xF7, 0x0D, 0x4E, 0x00, 0x56, 0xF7, 0x41, 0x02, 0xC0, 0xF1, 0x91, 0x75, 0x95, 0xCB,
-    0xA4, 0x7D, 0x28, 0xB4, 0x8F, 0x37, 0x76, 0x1E, 0x93, 0x2F, 0xD9, 0xB2, 0x85, 0x29, 0xDF, 0xAC,
-    0x32, 0xEF, 0x7C, 0x9F, 0x85, 0x1E, 0xA0, 0x89, 0xA9, 0x8C, 0x7C, 0x01, 0x86, 0x15, 0xE5, 0x07,
-    0xA0, 0x2B, 0x7D, 0xF5, 0xB4, 0xFE, 0xFC, 0x51, 0xF9, 0xFC, 0x19, 0x53, 0x21, 0x8B, 0xDD, 0x82,
-    0x40, 0x50, 0xAC, 0x34, 0x9D, 0xEC, 0x39, 0x28, 0x68, 0x6A, 0xE4, 0x9B, 0xFB, 0xF6, 0x2F, 0x7D,
-    0x48, 0x50, 0x40, 0xEE, 0x49, 0x22, 0xA5, 0xD3, 0x99, 0xA7, 0x2F, 0x8B, 0x69, 0x02, 0xDB, 0xE9,
-    0xFA, 0x84, 0x83, 0x68, 0x69, 0x4B, 0xBE, 0xB7, 0xD0, 0xD1, 0x14, 0x96, 0xD5, 0xE7, 0xE7, 0x4D,
-    0x11, 0x96, 0xD1, 0x3B, 0x12, 0x7B, 0x61, 0x95, 0xB0, 0x6C, 0x9A, 0xAA, 0x13, 0x5F, 0xF8, 0xBC,
-    0xC4, 0xC1, 0x3E, 0xD2, 0x7B, 0xA9, 0xE6, 0x96, 0x58, 0x25, 0xF1, 0xE9, 0xC2, 0x9D, 0x00, 0x02,
-    0xB8, 0x78, 0xD0, 0x4D, 0x6A, 0x34, 0x00, 0x03, 0x17, 0xAC, 0x85, 0x61, 0x97, 0x88, 0x77, 0x99,
-    0xFA, 0xDA, 0xC1, 0x43, 0x20, 0xE8, 0xC7, 0x57, 0x66, 0xF3, 0x76, 0xAC, 0xD9, 0x3F, 0x99, 0xD8,
-    0x9F, 0x97, 0xC4, 0x3E, 0x0D, 0x38, 0xB0, 0xB8, 0x30, 0xA3, 0xA0, 0xC5, 0xD2, 0xD8, 0xBC, 0xCA,
-    0x18, 0x21, 0x61, 0x64, 0x1F, 0x45, 0xFE, 0x35, 0x47, 0x4A, 0xA8, 0xB8, 0xFA, 0xC1, 0xB0, 0x84,
-    0xD3, 0x4F, 0xAA, 0x9B, 0x98, 0x19, 0xB2, 0x5B, 0xD5, 0x33, 0x4E, 0xFF, 0xC4, 0x87, 0xDD, 0xD6,
-    0x87, 0x2E, 0x1B, 0xAC, 0x1F, 0xCE, 0x5B, 0x1F, 0x06, 0x4E, 0x87, 0x24, 0xAA, 0x3B, 0x4A, 0xCD,
-    0x46, 0x20, 0x17, 0x91, 0xBA, 0x02, 0x10, 0x4D, 0xB0, 0xFD, 0x3E, 0x14, 0xB9, 0x53, 0x8B, 0xEA,
-    0x25, 0x44, 0xEC, 0x0E, 0x90, 0x00, 0xF7, 0xA4, 0xB4, 0x7A, 0x5F, 0x45, 0x05, 0x23, 0xB3, 0x4C,
-    0xDE, 0x66, 0x5C, 0xEC, 0xEC, 0xD2, 0xBA, 0xFE, 0xE8, 0xB2, 0xBD, 0xF2, 0x62, 0xB6, 0x84, 0xE4,
-    0xC9, 0x4F, 0xDB, 0xF4, 0xE5, 0x26, 0xB5, 0x65, 0x4A, 0x65, 0x22, 0x31, 0x50, 0x5C, 0x9A, 0x84,
-    0xEF, 0x97, 0xFF, 0xB2, 0x6B, 0xA8, 0x9D, 0x30, 0xF3, 0x01, 0x7D, 0x4D, 0xBA, 0x92, 0xF3, 0xD1,
-    0xF7, 0x80, 0x05, 0xBD, 0xB0, 0x15, 0x05, 0xEE, 0xEF, 0xE7, 0xE4, 0x0C, 0x3A, 0xFE, 0x95, 0x33,
-    0x6B, 0x27, 0xCA, 0xB9, 0x95, 0xD9, 0xFA, 0x70, 0xDC, 0xFA, 0x70, 0x05, 0xE9, 0xAA, 0x4A, 0xD9,
-    0x9E, 0xC4, 0xD9, 0xAB, 0x6E, 0x90, 0x22, 0x3E, 0x64, 0x74, 0xE7, 0xFB, 0x89, 0xFD, 0x96, 0x6D,
-    0x65, 0x24, 0x24, 0x4E, 0xB3, 0x12, 0xE1, 0x87, 0xDC, 0x38, 0x33, 0x59, 0x12, 0xCB, 0xE7, 0x9F,
-    0x18, 0x1F, 0xA8, 0xD2, 0x03, 0xFB, 0x4D, 0xFB, 0x75, 0x4B, 0x82, 0x82, 0x9E, 0xEA, 0x24, 0x8C,
-    0x0B, 0x59, 0x13, 0xE7, 0x23, 0x2C, 0xC5, 0xEB, 0xD0, 0x65, 0x37, 0x12, 0x67, 0x47, 0x9C, 0x89,
-    0x5E, 0x14, 0x7E, 0xEC, 0x3C, 0x09, 0xE7, 0x34, 0x2C, 0x8E, 0xC4, 0xE2, 0x5C, 0x2C, 0x7E, 0xC4,
-    0x74, 0x72, 0xB0, 0xC5, 0xB5, 0x70, 0x86, 0x6A, 0x71, 0x41, 0x16, 0xAB, 0xE2, 0x8C, 0x9C, 0xEF,
-    0x5C, 0x83, 0xC5, 0x01, 0x71, 0xC6, 0x07, 0x1F, 0x81, 0x47, 0xE4, 0x23, 0xC2, 0x2B, 0x1F, 0x91,
-    0x55, 0x1C, 0x2F, 0x84, 0xAE, 0x2D, 0x42, 0xFD, 0xCE, 0x07, 0x35, 0x8F, 0xE6, 0xF7, 0x1A, 0xD9,
-    0xC5, 0xAE, 0x41, 0x27, 0xB3, 0xCA, 0x25, 0xE9, 0x70, 0x86, 0xEB, 0x04, 0x9B, 0x20, 0x41, 0x97,
-    0x8C, 0x4E, 0x96, 0x1A, 0x51, 0xF1, 0x13, 0x3D, 0x7B, 0xAC, 0x45, 0xFC, 0x33, 0x7F, 0x44, 0xF5,
-    0xDC, 0x2F, 0xD0, 0xE1, 0x3F, 0x91, 0xB3, 0x8A, 0x96, 0x07, 0x75, 0x84, 0x1A, 0x98, 0x55, 0x74,
-    0x38, 0x07, 0x50, 0x37, 0x46, 0xA5, 0x17, 0xEB, 0xCB, 0x4A, 0x4C, 0x6C, 0xC2, 0x72, 0x43, 0xC6,
-    0x8D, 0x29, 0x1A, 0x96, 0x0C, 0x83, 0x76, 0x79, 0x50, 0x44, 0x30, 0xA9, 0xBD, 0xF1, 0x01, 0x79,
-    0x56, 0xD4, 0x53, 0x80, 0xFA, 0x5D, 0x89, 0x91, 0xD0, 0xB5, 0xE1, 0x69, 0x08, 0x91, 0x3B, 0x9F,
-    0xB4, 0x58, 0xBB, 0xC9, 0x90, 0x8F, 0x5D, 0x95, 0xA9, 0xEB, 0x6A, 0x54, 0x19, 0x51, 0x02, 0x10,
-    0x7F, 0xAB, 0x78, 0xE2, 0x3C, 0x6D, 0xAD, 0x1A, 0x6B, 0x60, 0x7A, 0x9B, 0x45, 0x44, 0xB6, 0x06,
-    0x84, 0x3D, 0x82, 0xA0, 0xD3, 0xBD, 0x01, 0xAE, 0xE3, 0xCC, 0x59, 0x74, 0x3A, 0x7D, 0xAE, 0xF2,
-    0xBC, 0x04, 0xB1, 0xA7, 0x52, 0x66, 0x77, 0xC8, 0x89, 0x9D, 0xF9, 0x75, 0xB6, 0xF9, 0x75, 0xFF,
-    0xBE, 0x5F, 0x87, 0x27, 0xC2, 0xAD, 0x0D, 0x82, 0x6B, 0xB8, 0x13, 0xAD, 0x67, 0xA0, 0x1C, 0x90,
-    0x7D, 0x71, 0x22, 0xF9, 0xA9, 0x7E, 0x9D, 0x7B, 0xBF, 0x4D, 0xFB, 0x7B, 0x57, 0x2F, 0x61, 0xB5,
-    0xD3, 0x27, 0x70, 0x05, 0xA5, 0xEE, 0xA7, 0x0C, 0x14, 0x10, 0x3A, 0x4C, 0xE6, 0x11, 0x80, 0xEC,
-    0x9D, 0x0C, 0x9E, 0x3F, 0xF9, 0x82, 0x51, 0x8D, 0xE4, 0x6A, 0x51, 0x0A, 0x87, 0xB2, 0x62, 0xB5,
-    0x9E, 0xF5, 0xB4, 0x2A, 0x63, 0xBB, 0xDA, 0x60, 0xB9, 0x5A, 0x69, 0x76, 0xE7, 0x07, 0x68, 0x29,
-    0x94, 0xC2, 0x0C, 0xA3, 0xF4, 0xAE, 0xE3, 0x55, 0x58, 0x82, 0x05, 0xFA, 0x25, 0xBE, 0xBA, 0x7C,
-    0xC0, 0xD2, 0x33, 0xED, 0xE7, 0xBC, 0xA6, 0xCD, 0x8E, 0xD8, 0x28, 0xE7, 0x59, 0x0A, 0xCD, 0x20,
-    0xE5, 0xA9, 0x90, 0x1C, 0xFA, 0x9B, 0x05, 0x32, 0x70, 0x14, 0xE0, 0xF3, 0xD4, 0x74, 0xFB, 0x5A,
-    0x4C, 0xE6, 0xC5, 0x1F, 0x35, 0x03, 0x6D, 0xF5, 0x92, 0x7D, 0x43, 0xF9, 0xEC, 0x55, 0x0D, 0xDE,
-    0x74, 0xA9, 0xBE, 0x2B, 0x5D, 0x58, 0x17, 0xEF, 0x7D, 0x4B, 0xC3, 0xCE, 0x57, 0xAC, 0x12, 0x82,
-    0xEE, 0x95, 0x8C, 0x33, 0x69, 0x26, 0x99, 0x51, 0x4C, 0x56, 0x32, 0x52, 0x17, 0x5A, 0x31, 0xA7,
-    0xD9, 0xB1, 0x07, 0x08, 0x4D, 0x76, 0xF2, 0xBF, 0xBB, 0xF6, 0xDB, 0x26, 0x9D, 0xD8, 0xF1, 0x27,
-    0xE6, 0x96, 0x85, 0xA6, 0x64, 0x3C, 0xDD, 0x4E, 0xE7, 0x44, 0x51, 0x8B, 0xF1, 0x4E, 0x2B, 0x2F,
-    0xFC, 0xB0, 0xA8, 0x82, 0xE2, 0xC4, 0xE5, 0xF3, 0x4E, 0x2D, 0xEF, 0xB9, 0x26, 0xA9, 0x0C, 0x8B,
-    0x7F, 0x72, 0x5C, 0x00, 0x4D, 0x97, 0x3A, 0x3A, 0x9D, 0x7F, 0x62, 0x7E, 0x4C, 0xEA, 0xEC, 0xDE,
-    0x30, 0xF1, 0xCF, 0x10, 0x78, 0x64, 0x37, 0x3B, 0xFF, 0xBD, 0x5E, 0x62, 0x60, 0x59, 0x85, 0x28,
-    0x04, 0x1F, 0xC5, 0xBD, 0x18, 0xDD, 0x51, 0xB3, 0x3C, 0x2C, 0xCB, 0x1C, 0x2F, 0x4C, 0x86, 0x3D,
-    0x22, 0x09, 0x04, 0xE3, 0x18, 0x8D, 0x8F, 0x43, 0x01, 0x44, 0x91, 0x71, 0x17, 0x8C, 0xBD, 0x51,
-    0x3C, 0xD9, 0xA8, 0x0D, 0xEC, 0x8D, 0x2C, 0x17, 0x36, 0x11, 0x0B, 0x44, 0x9F, 0x6E, 0x6F, 0x43,
-    0x6F, 0xA5, 0xAB, 0xF2, 0x3D, 0xDD, 0x80, 0xD6, 0x31, 0x06, 0xA7, 0xF4, 0x05, 0x4C, 0xFE, 0x07,
-    0x66, 0xB7, 0x15, 0xBC, 0xAB, 0x37, 0x6D, 0x17, 0x8B, 0xBA, 0x29, 0xED, 0x8B, 0xE6, 0x48, 0x98,
-    0x20, 0xE8, 0xA0, 0x8B, 0x5F, 0x96, 0x49, 0x5F, 0x7C, 0x56, 0xEE, 0x7A, 0x8F, 0xFD, 0x67, 0xB9,
-    0xCB, 0xCF, 0xCE, 0xE8, 0xC3, 0x78, 0x1B, 0x6A, 0xF7, 0x79, 0x64, 0xB8, 0xA3, 0xCE, 0x0B, 0xBA,
-    0xA4, 0xF9, 0x4C, 0x52, 0x67, 0xAF, 0x74, 0xB2, 0x10, 0x7B, 0x45, 0x62, 0x98, 0x11, 0xDA, 0xA5,
-    0x34, 0x27, 0xBA, 0x3D, 0xFE, 0x62, 0xC5, 0x87, 0x94, 0x07, 0x82, 0xA6, 0x1E, 0x10, 0xE3, 0xAE,
-    0xDD, 0xFC, 0x0C, 0xDD, 0x40, 0x8D, 0x2C, 0x00, 0xDC, 0x5A, 0x11, 0xC5, 0x6E, 0x73, 0xF3, 0xC2,
-    0xB2, 0x4E, 0xD6, 0x82, 0x6D, 0xC6, 0xAE, 0xD6, 0x2A, 0x64, 0xDE, 0x7A, 0x20, 0x5D, 0x1E, 0x78,
-    0x88, 0xFE, 0x5B, 0x03, 0x2D, 0xC0, 0x66, 0xC1, 0xA4, 0x96, 0x07, 0x84, 0x54, 0x88, 0x67, 0x18,
-    0xE5, 0xB4, 0x9B, 0x25, 0xB5, 0x87, 0x08, 0xAC, 0x30, 0x15, 0xB4, 0xA8, 0x2D, 0xBD, 0x5F, 0x6E,
-    0xCA, 0xBC, 0x4F, 0x0B, 0x2D, 0x21, 0xE1, 0xCA, 0x3D, 0xF4, 0x4E, 0xB8, 0x48, 0xC0, 0xBE, 0x50,
-    0x5A, 0xA8, 0x57, 0xE9, 0xBD, 0x8F, 0x07, 0xC5, 0xAF, 0xCF, 0x09, 0xD0, 0x35, 0x52, 0xF6, 0x99,
-    0x65, 0xD2, 0x3E, 0x75, 0xBD, 0x2E, 0x1F, 0x5E, 0x80, 0x36, 0x2D, 0x27, 0xB9, 0x20, 0xDC, 0x7E,
-    0xE7, 0xB8, 0xD6, 0x51, 0xA5, 0x03, 0x2E, 0x45, 0xFD, 0xC8, 0xEC, 0xDB, 0x33, 0x3C, 0x2A, 0xC1,
-    0x4C, 0x8B, 0xE6, 0x82, 0xA6, 0x76, 0x32, 0xA4, 0xB5, 0xB6, 0x73, 0x02, 0xCA, 0xC5, 0x07, 0x63,
-    0xAB, 0xE7, 0x39, 0x7F, 0x78, 0x58, 0xB0, 0x12, 0x2B, 0x25, 0x50, 0xC1, 0x9F, 0xDB, 0x73, 0x53,
-    0x11, 0x70, 0x42, 0x8E, 0xA4, 0x1D, 0x11, 0x19, 0x0B, 0x33, 0xFC, 0xD1, 0xAC, 0xA6, 0xA6, 0xB2,
-    0x72, 0x78, 0x59, 0xC8, 0x6E, 0x58, 0xB1, 0x68, 0x85, 0xBD, 0x91, 0xE6, 0x78, 0x70, 0x64, 0xE2,
-    0xBB, 0xA1, 0x3D, 0xA5, 0x82, 0xFD, 0xEC, 0x9D, 0x1B, 0xD4, 0xF2, 0x95, 0xDE, 0x88, 0x36, 0xFA,
-    0xA6, 0xE6, 0xED, 0xB6, 0xAB, 0xCA, 0xAC, 0x90, 0xC5, 0x83, 0x0C, 0x2C, 0x63, 0xDA, 0xEC, 0xC2,
-    0x10, 0x5A, 0x0F, 0x80, 0xD6, 0xC8, 0x89, 0xCC, 0xBE, 0x4B, 0x84, 0x68, 0x17, 0x23, 0x4C, 0xAD,
-    0xE8, 0x8A, 0x1D, 0x33, 0x09, 0xAB, 0x89, 0x1E, 0x18, 0x93, 0x72, 0xDF, 0x86, 0xB2, 0xA2, 0x2B,
-    0xC0, 0x07, 0x48, 0x9D, 0xDB, 0x70, 0x86, 0xF3, 0xB5, 0x9B, 0x4B, 0x95, 0x3F, 0x39, 0xDC, 0x93,
-    0x7A, 0x9D, 0x33, 0xE1, 0x87, 0xC5, 0x56, 0x7F, 0x20, 0x49, 0x54, 0x78, 0x90, 0xF2, 0x1A, 0x31,
-    0xAE, 0x1A, 0x7E, 0xFC, 0x03, 0xFF, 0xA9, 0xBD, 0x52, 0xF3, 0xCD, 0x0C, 0x8A, 0xA7, 0x59, 0x3B,
-    0x2A, 0x9C, 0x13, 0x3D, 0x65, 0xCD, 0x2A, 0xD3, 0xA6, 0x2C, 0x25, 0x8B, 0x13, 0x2F, 0x58, 0x88,
-    0x87, 0x28, 0x1C, 0x49, 0x2C, 0xF8, 0x2B, 0x2C, 0x31, 0x54, 0x27, 0x1E, 0xDC, 0xC0, 0xD7, 0x5F,
-    0xE1, 0xFB, 0x23, 0x65, 0x43, 0x98, 0x71, 0xE6, 0x41, 0x90, 0x31, 0x81, 0x4F, 0x44, 0x3E, 0x64,
-    0xDD, 0x6B, 0x40, 0xCF, 0x88, 0x4B, 0x10, 0xF8, 0x0C, 0xA3, 0x3A, 0x95, 0x45, 0x7A, 0x96, 0x8D,
-    0x2E, 0x9C, 0x05, 0xBF, 0x52, 0xD1, 0xC9, 0xDC, 0xDA, 0x35, 0x69, 0x77, 0xDE, 0x8C, 0xFE, 0xE8,
-    0x8D, 0xE1, 0xE4, 0x8F, 0xD1, 0x18, 0x0C, 0x61, 0x2F, 0x84, 0xC8, 0x43, 0xE7, 0x30, 0x2E, 0x43,
-    0xC4, 0xCC, 0x3B, 0xE5, 0x44, 0x26, 0xFB, 0x4E, 0x4D, 0xAD, 0x88, 0xD6, 0x5F, 0x00, 0xB3, 0xF3,
-    0xFB, 0xAA, 0x2E, 0x04, 0x7A, 0xC3, 0xE5, 0xC5, 0x97, 0x54, 0x1F, 0x4A, 0xBB, 0x9F, 0xE1, 0x7A,
-    0x55, 0x24, 0xE6, 0x4D, 0xC4, 0xC1, 0x57, 0x36, 0x24, 0x73, 0xFC, 0x5D, 0x24, 0xF3, 0xB7, 0xD4,
-    0x4D, 0x1F, 0x33, 0xD1, 0x7B, 0x12, 0xDE, 0x0D, 0x26, 0x9E, 0x60, 0xD3, 0x61, 0x43, 0xC5, 0x4F,
-    0xCC, 0xAA, 0xDC, 0xFF, 0xC6, 0x6F, 0xAF, 0x9B, 0xCE, 0xD8, 0x38, 0xE0, 0xD2, 0xAD, 0x72, 0x9B,
-    0x5E, 0x53, 0x6B, 0xD6, 0x35, 0x27, 0xB4, 0xE9, 0xE6, 0x1B, 0x45, 0x86, 0x53, 0x8D, 0x00, 0x97,
-    0xD4, 0xED, 0xC0, 0x43, 0x31, 0xD3, 0x8F, 0xB9, 0x46, 0xE6, 0x30, 0x79, 0xC7, 0xAE, 0x61, 0xF2,
-    0xC8, 0x41, 0x46, 0x76, 0xEC, 0x78, 0xF5, 0x2D, 0xFD, 0x64, 0xE3, 0xBF, 0x3B, 0x92, 0xFF, 0x83,
-    0xB7, 0x27, 0xA3, 0xBE, 0xA8, 0xE5, 0x6A, 0xC3, 0xAE, 0x62, 0xFB, 0x66, 0xD4, 0x66, 0x75, 0x48,
-    0xF2, 0xA6, 0x35, 0x2B, 0x2D, 0x12, 0xDF, 0x28, 0xA9, 0xA3, 0x8E, 0xE4, 0x2E, 0x83, 0x01, 0xD7,
-    0xB4, 0x0C, 0xC6, 0x84, 0x9C, 0xE3, 0x4D, 0xA9, 0x72, 0x8F, 0x75, 0x5C, 0x54, 0x14, 0xEA, 0x46,
-    0x64, 0xAE, 0x45, 0x97, 0xE9, 0x41, 0xE0, 0xC4, 0xD6, 0xDD, 0x9C, 0x25, 0xB6, 0x0C, 0x7D, 0x27,
-    0xA3, 0x36, 0xE1, 0xF9, 0xE3, 0xA6, 0xFE, 0x71, 0x3F, 0x9F, 0x5B, 0x2B, 0x4E, 0xBB, 0x76, 0x1F,
-    0xFB, 0x95, 0xEB, 0x4A, 0x95, 0x19, 0x9C, 0xD1, 0x22, 0x23, 0x96, 0x1C, 0xAE, 0x40, 0x17, 0xD9,
-    0xB2, 0xB0, 0xA8, 0xDC, 0x86, 0xED, 0x2C, 0xBE, 0xD1, 0x71, 0x86, 0x28, 0xE1, 0xB5, 0x5A, 0xB8,
-    0x7E, 0xEE, 0x7C, 0xD2, 0x54, 0x1C, 0x33, 0x5B, 0x8A, 0x84, 0xA7, 0x1D, 0xFA, 0x93, 0x26, 0xE8,
-    0xC3, 0x0C, 0xE5, 0x89, 0x90, 0xF1, 0x45, 0xC5, 0xB0, 0x02, 0xED, 0x49, 0xB9, 0x78, 0x1F, 0xFD,
-    0xC3, 0xC8, 0x2B, 0x3E, 0xFD, 0x53, 0x24, 0xB8, 0x3A, 0x74, 0x2C, 0x8D, 0xD0, 0xC6, 0xF3, 0x52,
-    0xBA, 0xFB, 0x53, 0xA1, 0x8A, 0xEB, 0x3D, 0x5F, 0x9A, 0x8B, 0xD7, 0xED, 0xFF, 0x8B, 0x83, 0xE8,
-    0x2F, 0xDF, 0xBB, 0x60, 0x71, 0x69, 0x2D, 0xFD, 0xC2, 0x1F, 0x8F, 0x36, 0x1B, 0xFD, 0x95, 0x64,
-    0xA2, 0x4D, 0x83, 0xDE, 0xAF, 0x3C, 0x5E, 0xB6, 0x35, 0xF8, 0xAE, 0x34, 0xF0, 0x31, 0x27, 0x7C,
-    0x97, 0x5D, 0xD2, 0x23, 0xCB, 0x35, 0x06, 0x4A, 0x6B, 0x75, 0x80, 0xE3, 0x77, 0x75, 0x99, 0xA1,
-    0x8B, 0x76, 0xFD, 0x65, 0x13, 0xCD, 0xD1, 0x9F, 0xA4, 0xC8, 0x3E, 0x08, 0x69, 0x8D, 0x73, 0x26,
-    0xC1, 0x58, 0xFF, 0x69, 0x68, 0x47, 0x31, 0x36, 0xFB, 0x91, 0xDD, 0x1E, 0xA9, 0xEA, 0xAC, 0x9A,
-    0xE1, 0x55, 0xF4, 0x56, 0x59, 0x51, 0xAC, 0x62, 0x9F, 0x90, 0x61, 0xBB, 0x1C, 0xBF, 0x39, 0x9A,
-    0xE8, 0xF5, 0x4E, 0x48, 0x3A, 0x8D, 0xA0, 0xF2, 0x4D, 0x04, 0x10, 0x16, 0x7B, 0x58, 0x12, 0x51,
-    0xBE, 0x12, 0xBA, 0xD0, 0x4E, 0x36, 0xF2, 0x58, 0xC0, 0xB0, 0x9F, 0x79, 0x68, 0x56, 0x02, 0x44,
-    0x93, 0xFB, 0xC3, 0x39, 0xF9, 0x28, 0x7B, 0x1C, 0xBC, 0xF0, 0x6B, 0x34, 0x78, 0x64, 0xD6, 0x47,
-    0x59, 0xBE, 0x46, 0x92, 0xAA, 0x35, 0x66, 0x53, 0x27, 0x3B, 0x2D, 0x9C, 0xB9, 0x2D, 0x20, 0xAE,
-    0xB5, 0x74, 0x3E, 0xF1, 0xA5, 0xBA, 0x28, 0x4B, 0x5F, 0x88, 0xCB, 0x80, 0x04, 0x1D, 0xF9, 0xD8,
-    0xEF, 0x63, 0x5B, 0x0B, 0x50, 0xBD, 0x9B, 0xB9, 0xC8, 0x46, 0xF6, 0x1D, 0xDC, 0x41, 0x76, 0xE6,
-    0xE6, 0x17, 0xA0, 0xAA, 0x0B, 0x40, 0x4B, 0x29, 0x93, 0xB2, 0xE4, 0x6A, 0xC1, 0xA2, 0xD6, 0x7B,
-    0x1A, 0x32, 0x40, 0xAC, 0x15, 0x6E, 0x65, 0x6E, 0x80, 0x1B, 0x6A, 0xC2, 0x57, 0x96, 0x43, 0x73,
-    0x34, 0xC5, 0x34, 0xD7, 0xD9, 0xD3, 0xDC, 0xE0, 0x25, 0xAF, 0x35, 0xBA, 0x2A, 0xD2, 0xC8, 0xE5,
-    0xAF, 0x3F, 0x58, 0x35, 0x54, 0xFC, 0x8E, 0x9C, 0xE6, 0x3B, 0x4E, 0x33, 0x13, 0x4B, 0xBC, 0xB2,
-    0xE0, 0x3B, 0x70, 0x5A, 0xB2, 0xC5, 0x69, 0x48, 0x89, 0x6E, 0x72, 0x9A, 0xD7, 0x6F, 0x36, 0xC7,
-    0x2C, 0xAD, 0x54, 0x26, 0x57, 0x37, 0xD5, 0xEF, 0x95, 0x50, 0x2E, 0xF3, 0x20, 0x57, 0xA7, 0x7F,
-    0x4E, 0x94, 0xFF, 0x48, 0x2E, 0x32, 0x99, 0x6A, 0x1D, 0xF2, 0x18, 0xA9, 0x44, 0x16, 0x9B, 0x91,
-    0xCB, 0x03, 0x87, 0x91, 0x38, 0x64, 0x30, 0x68, 0x1C, 0x74, 0xB7, 0xC7, 0x68, 0x6E, 0x8F, 0x1B,
-    0xB2, 0x17, 0xF4, 0x4D, 0x0D, 0xEE, 0x2A, 0x41, 0x0A, 0x14, 0xAD, 0x0B, 0xDD, 0x99, 0xC4, 0xEE,
-    0x55, 0xE7, 0x27, 0x52, 0xFF, 0xE9, 0x4E, 0x3E, 0x99, 0xF0, 0x0B, 0x70, 0x0D, 0xA6, 0x0A, 0x45,
-    0xE7, 0x19, 0x68, 0x0F, 0xAB, 0xBE, 0x77, 0xB7, 0xEF, 0xB0, 0x60, 0x26, 0x89, 0x75, 0x00, 0x73,
-    0x46, 0x25, 0xE0, 0xC4, 0xD6, 0x11, 0xF8, 0xE2, 0xA5, 0x6E, 0x7F, 0x42, 0xA2, 0x3A, 0x4F, 0xE0,
-    0x92, 0xE4, 0xD4, 0x90, 0xD8, 0xAF, 0xC1, 0x06, 0xFC, 0x50, 0xD3, 0x0A, 0x59, 0x8D, 0xB7, 0xF8,
-    0x13, 0x63, 0x99, 0xF4, 0x15, 0xCD, 0x58, 0x90, 0x97, 0x93, 0xD7, 0xD9, 0x09, 0x35, 0x51, 0x13,
-    0xA6, 0xAF, 0x72, 0xB6, 0x23, 0xA7, 0x94, 0xFD, 0x9C, 0xB3, 0x1E, 0xF8, 0x3F, 0x15, 0xE3, 0x94,
-    0xB8, 0xC5, 0xC8, 0xFE, 0xC4, 0x31, 0x0B, 0x44, 0xE2, 0x26, 0xC1, 0xCE, 0x32, 0x10, 0x49, 0x34,
-    0x82, 0xCF, 0xBE, 0xC6, 0x7F, 0x05, 0x4F, 0xB9, 0xFE, 0x08, 0x4D, 0x5C, 0xB9, 0x1D, 0x0F, 0xDC,
-    0x65, 0xC8, 0xA5, 0xDD, 0x69, 0x93, 0xE1, 0x85, 0x5B, 0xAE, 0x0B, 0xA6, 0x42, 0x56, 0x1A, 0x7D,
-    0xAB, 0x85, 0xA8, 0x28, 0xF4, 0x37, 0xA3, 0x4C, 0x9E, 0xD6, 0x68, 0x5C, 0x8E, 0xA0, 0x6C, 0x44,
-    0xFB, 0x46, 0x1D, 0x54, 0xD0, 0x37, 0x50, 0x96, 0x17, 0xE4, 0x85, 0x21, 0xE5, 0xFF, 0xBE, 0x8E,
-    0xA6, 0x61, 0x28, 0x86, 0x96, 0x1B, 0xDE, 0xD2, 0x5B, 0xE2, 0x21, 0x66, 0xEC, 0x3F, 0x03, 0x50,
-    0xCE, 0x7F, 0x2A, 0x19, 0x79, 0x5F, 0x34, 0x21, 0x69, 0x42, 0x36, 0xCA, 0xDE, 0x9A, 0xCC, 0x6A,
-    0x7B, 0x46, 0xA8, 0xF2, 0xB3, 0x93, 0x7F, 0x44, 0x50, 0x77, 0x7B, 0xF3, 0xFE, 0x0C, 0xA6, 0xFA,
-    0x61, 0x99, 0x00, 0x38, 0x92, 0x0E, 0x78, 0xC1, 0x75, 0xDC, 0x3A, 0x4D, 0x86, 0x83, 0x1B, 0x8E,
-    0x0C, 0x29, 0xE2, 0x85, 0xAA, 0xCC, 0x1A, 0x0F, 0x9D, 0x13, 0xA4, 0x83, 0xAC, 0x45, 0x44, 0xBB,
-    0x41, 0xBA, 0x09, 0xBA, 0x87, 0x84, 0x10, 0x7E, 0x97, 0x39, 0x22, 0x4D, 0x5A, 0x40, 0x2D, 0x31,
-    0xE9, 0x5A, 0xE4, 0x4C, 0x8C, 0x7B, 0x68, 0x88, 0x97, 0x79, 0x92, 0x14, 0xB1, 0xB6, 0x5B, 0x0C,
-    0x1B, 0x76, 0x78, 0x0F, 0x01, 0x23, 0x64, 0xF9, 0x45, 0x2C, 0xB4, 0xD7, 0x25, 0x76, 0x09, 0x55,
-    0x50, 0x0D, 0xFF, 0x3E, 0x9A, 0xE8, 0x15, 0x27, 0x2D, 0x5D, 0xBD, 0xCF, 0x98, 0xE8, 0x0C, 0xC6,
-    0xE1, 0xE6, 0x14, 0x47, 0x17, 0x60, 0x80, 0x3E, 0x01, 0x12, 0x06, 0xB5, 0x05, 0x76, 0x9B, 0x93,
-    0x32, 0x5A, 0xD6, 0xAD, 0x1D, 0x69, 0x08, 0x6D, 0xDA, 0x28, 0x6D, 0x1A, 0xB6, 0x3A, 0x24, 0xAD,
-    0x12, 0xA7, 0x25, 0x59, 0x92, 0x46, 0xA9, 0xD3, 0x28, 0x5D, 0xEA, 0xE5, 0x92, 0x93, 0x0A, 0x4A,
-    0x1F, 0x15, 0x5E, 0xCD, 0xB5, 0x49, 0x44, 0x80, 0x07, 0x64, 0x5C, 0xA5, 0x10, 0x4B, 0x15, 0xF2,
-    0x85, 0x23, 0x51, 0x60, 0x7F, 0xC9, 0x2D, 0x36, 0x4A, 0x23, 0x93, 0xB8, 0x0D, 0x87, 0xF7, 0x2D,
-    0x0D, 0x44, 0xE7, 0xD8, 0x54, 0x82, 0xBC, 0x3F, 0x26, 0x58, 0x5C, 0x01, 0x77, 0xFF, 0x14, 0x9B,
-    0x03, 0xE0, 0x62, 0xD0, 0xCF, 0x88, 0xCB, 0x47, 0xA0, 0xE8, 0x4E, 0x76, 0x86, 0x79, 0xD5, 0x55,
-    0x47, 0xAC, 0x88, 0x1B, 0x8D, 0x20, 0x34, 0x21, 0x1A, 0x21, 0x48, 0xAD, 0x80, 0xA9, 0x02, 0xF6,
-    0xFB, 0xA3, 0x19, 0xB2, 0x26, 0xB9, 0x90, 0xC5, 0x1A, 0x10, 0x15, 0x4D, 0x1E, 0x83, 0x6A, 0xD2,
-    0x2B, 0xE1, 0xEE, 0x4F, 0x88, 0x8E, 0x6E, 0x96, 0x20, 0xC1, 0x02, 0xEA, 0x21, 0x0A, 0xCF, 0xD2,
-    0xAB, 0x7C, 0x1F, 0xBA, 0x3B, 0x2F, 0xB9, 0x0A, 0x37, 0x5B, 0x7A, 0xDC, 0x1F, 0xB2, 0xBE, 0x27,
-    0xE7, 0xC3, 0xC3, 0x11, 0x8A, 0x1B, 0x4E, 0xE0, 0x00, 0x43, 0x0A, 0xB7, 0xA0, 0x47, 0x3C, 0x8B,
-    0x3F, 0x3A, 0x5F, 0x9B, 0x34, 0x0C, 0x7B, 0x36, 0xA8, 0x13, 0x23, 0x57, 0xBD, 0x58, 0x95, 0xB8,
-    0x19, 0x26, 0xC7, 0x4B, 0x0D, 0x2F, 0xBE, 0x7D, 0xD8, 0xEB, 0x1F, 0x20, 0x2A, 0xB0, 0x4E, 0x58,
-    0xE6, 0x71, 0xB5, 0x8E, 0x55, 0x07, 0x03, 0x3F, 0xA1, 0x47, 0x86, 0x3F, 0x94, 0x42, 0xBA, 0x49,
-    0x6A, 0x87, 0xDF, 0x23, 0x34, 0x23, 0x55, 0x00, 0x25, 0x3B, 0x98, 0x66, 0x86, 0xC9, 0x33, 0x67,
-    0x2A, 0x8E, 0x83, 0x7D, 0xE3, 0x29, 0x5D, 0x8D, 0x5D, 0x96, 0x95, 0xB8, 0x52, 0xBF, 0xAC, 0x78,
-    0x51, 0xC2, 0x07, 0x2F, 0x98, 0x7B, 0x28, 0x3B, 0x65, 0xCA, 0x32, 0xD0, 0x50, 0xFC, 0x70, 0xF0,
-    0x67, 0x63, 0x0B, 0x53, 0x41, 0x3E, 0x2C, 0xA9, 0x44, 0xB3, 0x0E, 0x0D, 0x56, 0x86, 0x1D, 0x8B,
-    0x0D, 0xCC, 0xF3, 0x47, 0x5D, 0x34, 0xC8, 0x12, 0xFD, 0x21, 0xED, 0xB1, 0x6E, 0x81, 0x95, 0x81,
-    0x3A, 0x0A, 0xA1, 0xDA, 0x51, 0x25, 0x2A, 0x2C, 0xD6, 0x0A, 0x7F, 0xA4, 0x09, 0x0A, 0x61, 0x60,
-    0xF3, 0x13, 0xE1, 0x52, 0x2B, 0xA8, 0x45, 0xF3, 0xC1, 0x6D, 0xB4, 0x11, 0xC8, 0x2B, 0x33, 0xD6,
-    0x66, 0x5B, 0x1F, 0xCD, 0x4A, 0x3B, 0xDB, 0x5D, 0x82, 0x5E, 0xBD, 0x4E, 0x12, 0xE8, 0x36, 0xA2,
-    0xC4, 0xAE, 0x37, 0x49, 0x6B, 0xE3, 0xD6, 0xEE, 0x29, 0xF9, 0xD9, 0x39, 0xFC, 0x9E, 0x59, 0xBA,
-    0xB4, 0xB4, 0x23, 0xEA, 0xE3, 0x07, 0x35, 0x6E, 0x8E, 0xD1, 0x5F, 0x81, 0xE1, 0xB4, 0xAE, 0x14,
-    0xB2, 0xB8, 0xEB, 0xC2, 0x62, 0x0D, 0x76, 0x33, 0xC6, 0xC7, 0xA8, 0x61, 0x4D, 0x84, 0xB7, 0xE0,
-    0x06, 0xC8, 0xF4, 0x2D, 0x70, 0x0D, 0x85, 0xDD, 0xF5, 0x34, 0x7A, 0x13, 0x63, 0xFB, 0x4A, 0x37,
-    0x8B, 0xD4, 0x5A, 0x5E, 0x63, 0x8E, 0x85, 0xFB, 0xC6, 0x64, 0x4C, 0x3C, 0x5D, 0xD1, 0x47, 0xC7,
-    0x56, 0x95, 0x16, 0x75, 0xE8, 0x70, 0xD6, 0x9A, 0x5E, 0x5F, 0x91, 0xBB, 0xCC, 0x09, 0xF7, 0x3D,
-    0x74, 0x21, 0x05, 0xAB, 0x63, 0x93, 0x0B, 0x3B, 0x96, 0x7F, 0x0F, 0x9F, 0x0A, 0x00, 0x9F, 0x11,
-    0x17, 0xC9, 0x3E, 0x6F, 0x3B, 0xC1, 0x7D, 0xAC, 0x7A, 0x73, 0x39, 0x13, 0x97, 0x48, 0x7C, 0x8E,
-    0xF8, 0x35, 0x17, 0x74, 0x63, 0xAA, 0xE0, 0x98, 0xA5, 0x5D, 0x07, 0x18, 0x7A, 0xA7, 0xF6, 0x2C,
-    0x76, 0x1B, 0xFD, 0x3B, 0xC6, 0x7C, 0xF9, 0x70, 0x6F, 0x69, 0x3D, 0x75, 0x6D, 0x9E, 0xFF, 0x3C,
-    0x7A, 0x9A, 0xE6, 0x8F, 0xBB, 0xA5, 0xEE, 0xA4, 0xFE, 0x68, 0x48, 0x6F, 0xD4, 0x1F, 0x5D, 0x65,
-    0x3C, 0x60, 0x55, 0x1C, 0xD3, 0x4E, 0xD0, 0xC7, 0x22, 0x5F, 0xA3, 0x3C, 0xE4, 0xCF, 0x4C, 0x65,
-    0xE8, 0xC1, 0x03, 0x19, 0xB3, 0x5A, 0x09, 0x77, 0x46, 0x53, 0xD5, 0xAA, 0x61, 0xC3, 0xD3, 0x9C,
-    0x52, 0x8E, 0x57, 0x24, 0x4C, 0xE3, 0xC9, 0x98, 0x02, 0x18, 0x36, 0x08, 0xCD, 0xAC, 0xD6, 0x15,
-    0x6D, 0xC2, 0xFD, 0x8E, 0x5F, 0x82, 0xF2, 0xD6, 0x36, 0xC4, 0xB5, 0x93, 0xEB, 0xB6, 0x95, 0xD9,
-    0x8D, 0x32, 0x8F, 0xAB, 0xE0, 0xF4, 0xEB, 0x68, 0xCD, 0xC5, 0x74, 0x37, 0x9C, 0x43, 0x1E, 0x96,
-    0x99, 0x0D, 0xE6, 0x00, 0xE8, 0x99, 0x22, 0x15, 0x46, 0x78, 0xFD, 0xD7, 0xB9, 0x39, 0x1A, 0x14,
-    0x3E, 0xC3, 0x7E, 0x24, 0xEE, 0x0B, 0x31, 0x8A, 0xDF, 0xAA, 0x0B, 0x81, 0x82, 0x5D, 0x2D, 0x89,
-    0x9D, 0xC9, 0xA5, 0xD6, 0xB4, 0x48, 0x94, 0x6F, 0x57, 0xC8, 0xAC, 0x59, 0xEF, 0x97, 0x60, 0x90,
-    0xA5, 0xEE, 0x30, 0xFE, 0x27, 0x5F, 0x9A, 0x0C, 0x4B, 0xE3, 0x12, 0x81, 0xC1, 0xC0, 0x51, 0x8A,
-    0xC7, 0x58, 0xD0, 0x7F, 0x57, 0x0B, 0x27, 0xE3, 0x6A, 0x8B, 0xF3, 0x2A, 0x28, 0xBD, 0x6B, 0x99,
-    0xDC, 0xC7, 0xE6, 0x89, 0x01, 0x55, 0x4B, 0x04, 0x2A, 0xC7, 0xD0, 0xD8, 0xEF, 0x0C, 0x4E, 0x90,
-    0x6D, 0xBD, 0x2E, 0xBD, 0x6E, 0x84, 0x4D, 0x1F, 0x34, 0x95, 0xCC, 0xDF, 0x2D, 0xA1, 0x32, 0x31,
-    0x56, 0x23, 0xEB, 0x46, 0xDD, 0xDE, 0x43, 0x7E, 0xFF, 0x0F, 0xDC, 0xBE, 0xAB, 0x18, 0xBA, 0x34,
-    0x6B, 0xC2, 0x51, 0x23, 0xF4, 0x09, 0xDB, 0xFA, 0x47, 0x71, 0xE1, 0x65, 0x1C, 0xAF, 0x65, 0xDD,
-    0xCB, 0xD3, 0xBE, 0xF6, 0x66, 0x29, 0x13, 0xB2, 0xD3, 0x53, 0xC3, 0x68, 0x9A, 0xCB, 0xD8, 0xD2,
-    0x33, 0xA3, 0x92, 0xAF, 0x3F, 0x0D, 0xFB, 0xF0, 0x08, 0xE4, 0xE2, 0xB2, 0xFB, 0x95, 0xD6, 0xA8,
-    0xF9, 0x96, 0x15, 0x8C, 0x7B, 0x75, 0xEB, 0xA9, 0x49, 0xF7, 0x0A, 0xA8, 0x27, 0xB7, 0xE1, 0xC1,
-    0xDD, 0x51, 0x5D, 0x1C, 0x9D, 0x56, 0x17, 0xDC, 0x2C, 0xEE, 0x5B, 0xAD, 0x30, 0x05, 0x7D, 0xD8,
-    0x08, 0x37, 0x3D, 0xC8, 0x60, 0x89, 0x05, 0xDB, 0x71, 0x41, 0x73, 0x76, 0x19, 0x48, 0x96, 0x76,
-    0x0B, 0xD6, 0x72, 0xC5, 0xC3, 0x9C, 0x24, 0x3E, 0xC9, 0x4C, 0x95, 0x27, 0x65, 0x3A, 0x5F, 0xAF,
-    0x03, 0x6D, 0x1F, 0xC9, 0x4F, 0x6E, 0x16, 0xBF, 0xBC, 0x6C, 0x9E, 0xE0, 0x3A, 0x93, 0xB7, 0xC0,
-    0x73, 0x57, 0x46, 0x4C, 0xEA, 0xE8, 0x54, 0x29, 0xF8, 0x43, 0x05, 0xE5, 0x9E, 0x22, 0x18, 0xD0,
-    0x8D, 0x43, 0x8E, 0x59, 0x0C, 0x28, 0x82, 0xEA, 0xD1, 0xC7, 0xBE, 0x87, 0x87, 0xCD, 0xA7, 0x36,
-    0x5B, 0x81, 0xB1, 0x7F, 0x39, 0xE2, 0xC4, 0xC5, 0x38, 0x36, 0x49, 0x2E, 0x62, 0x5E, 0x52, 0xBF,
-    0x80, 0xD9, 0xE0, 0x1B, 0x51, 0xF3, 0x66, 0x83, 0x9B, 0x53, 0xB2, 0x70, 0x67, 0xD2, 0xEC, 0x18,
-    0xC0, 0x2E, 0xA3, 0x62, 0xBB, 0x4B, 0x75, 0xBB, 0xD2, 0x66, 0x82, 0x6A, 0x5A, 0x14, 0xD9, 0x87,
-    0x8D, 0xBD, 0xE2, 0x7E, 0x91, 0x8A, 0xDD, 0x71, 0x89, 0xFB, 0xA8, 0x4F, 0xE3, 0xD5, 0x19, 0x1D,
-    0x3F, 0x59, 0x18, 0x2B, 0x95, 0xB8, 0x52, 0xF8, 0x2A, 0xCB, 0x9F, 0x03, 0x5B, 0x45, 0x6E, 0x5B,
-    0x14, 0x1D, 0xD4, 0x46, 0xC3, 0x70, 0xF0, 0x14, 0x34, 0x0C, 0x3E, 0x2B, 0x1E, 0x15, 0x8E, 0x4A,
-    0x24, 0xD4, 0x16, 0x86, 0xBA, 0x62, 0x7F, 0x35, 0x06, 0x6C, 0x40, 0xE9, 0x57, 0xEC, 0x04, 0x2B,
-    0x50, 0x75, 0x2A, 0xB2, 0x17, 0x95, 0xC5, 0x33, 0xD6, 0x65, 0xDC, 0xAE, 0xA2, 0x3D, 0x28, 0x93,
-    0x17, 0x0D, 0x9D, 0xBB, 0xA4, 0x71, 0x1B, 0xBE, 0x79, 0x32, 0x41, 0xC4, 0x35, 0xF3, 0xD7, 0xD6,
-    0x6E, 0x6F, 0xEE, 0x9C, 0x8F, 0xE0, 0xA5, 0x12, 0xDE, 0xB8, 0xD7, 0xA3, 0x43, 0x12, 0x34, 0xE0,
-    0x87, 0x2D, 0xF1, 0x05, 0x09, 0x9F, 0xD1, 0x8A, 0x86, 0x76, 0x07, 0xAB, 0x4B, 0x3B, 0xAF, 0xF6,
-    0x51, 0xE8, 0x5E, 0xE6, 0x6A, 0x5C, 0x1D, 0x80, 0x93, 0x8E, 0x4A, 0x0C, 0x42, 0x1C, 0x8B, 0x45,
-    0xEC, 0x85, 0x1D, 0x3C, 0x9C, 0x23, 0xA0, 0xAE, 0x69, 0x86, 0xB0, 0x26, 0xAB, 0x23, 0x7B, 0xAD,
-    0x6A, 0xE0, 0x22, 0xD7, 0x0E, 0x64, 0xDD, 0x5A, 0xB8, 0xAD, 0x0E, 0xDB, 0xDF, 0xA4, 0x0E, 0xCD,
-    0xEE, 0x2D, 0xDD, 0x69, 0xC0, 0x2A, 0x31, 0x64, 0x32, 0x29, 0x7D, 0xB5, 0x6E, 0x69, 0xED, 0xB8,
-    0x22, 0x66, 0xC1, 0x67, 0x58, 0xEA, 0x08, 0x94, 0x47, 0xAD, 0x95, 0x43, 0x8C, 0xCD, 0x73, 0x48,
-    0x62, 0xF4, 0x32, 0x41, 0x30, 0x20, 0xE5, 0x38, 0x62, 0x70, 0x95, 0x3B, 0x1F, 0x78, 0x8F, 0x0E,
-    0xE2, 0x4B, 0xFC, 0x9D, 0xFC, 0xEA, 0xFA, 0xED, 0xC3, 0xF1, 0x08, 0x7B, 0x05, 0xFE, 0x07, 0x45,
-    0xEA, 0xF8, 0x89, 0x5A, 0x0C, 0xC9, 0xB3, 0x9F, 0x97, 0x97, 0x79, 0xDD, 0x79, 0x30, 0xE7, 0xFB,
-    0x15, 0x7D, 0x56, 0x1D, 0x15, 0xD3, 0x3A, 0xA7, 0x74, 0xEA, 0x04, 0x82, 0x64, 0x6B, 0xCB, 0xAD,
-    0x3E, 0x88, 0xA6, 0x24, 0x84, 0x14, 0x14, 0x4A, 0xBB, 0x85, 0x82, 0x2B, 0x2D, 0xD2, 0xB0, 0x3F,
-    0xBD, 0x5D, 0x82, 0x63, 0xD9, 0x5D, 0x89, 0xF7, 0x40, 0xBE, 0xDA, 0x96, 0x1D, 0x71, 0x43, 0x05,
-    0xED, 0x27, 0x8F, 0x16, 0xB8, 0xB6, 0x27, 0xB4, 0x78, 0x19, 0xBE, 0x27, 0x66, 0xA8, 0x8D, 0xFA,
-    0x7C, 0xF4, 0x78, 0x7D, 0xFE, 0x40, 0xA6, 0x43, 0x46, 0x7A, 0x02, 0x91, 0xDC, 0xF4, 0x37, 0xE2,
-    0xCF, 0x34, 0x49, 0x23, 0xC1, 0x91, 0x10, 0x80, 0x6D, 0x8B, 0xCD, 0xCA, 0x03, 0xA9, 0x72, 0xB5,
-    0x72, 0x6E, 0xA8, 0x54, 0x7B, 0x8F, 0x70, 0x82, 0xC0, 0x8D, 0x35, 0xC3, 0xEA, 0x19, 0x05, 0xE4,
-    0x58, 0x93, 0xB1, 0xA8, 0x53, 0x1D, 0xD4, 0x2B, 0x13, 0xAF, 0xCD, 0x88, 0xE3, 0x76, 0x07, 0x98,
-    0xFC, 0xB0, 0x2D, 0x7A, 0x84, 0x79, 0xB7, 0x6F, 0xCF, 0x87, 0xF6, 0xF0, 0xFA, 0xCB, 0xC8, 0x12,
-    0x5E, 0x4C, 0x21, 0x87, 0xFD, 0x28, 0xA8, 0x87, 0x3F, 0xC3, 0x86, 0xCD, 0xC4, 0x03, 0x3F, 0x9F,
-    0x3F, 0x89, 0xFA, 0x1D, 0xCE, 0x7D, 0x38, 0x13, 0xF5, 0x13, 0x67, 0x6D, 0x6C, 0x93, 0x0B, 0x5D,
-    0x83, 0xBA, 0x6B, 0x17, 0x8E, 0xC6, 0x7A, 0x8A, 0xCF, 0x3A, 0x6B, 0xE3, 0x1A, 0x7D, 0xC5, 0x11,
-    0xF3, 0x9E, 0x6F, 0x4D, 0xF4, 0x92, 0x38, 0xFE, 0x2F, 0x95, 0xC6, 0x25, 0xC7, 0x80, 0x38, 0x54,
-    0x0C, 0x83, 0x44, 0x97, 0x08, 0x5B, 0x3D, 0x31, 0xB8, 0x3E, 0x6E, 0x6D, 0x18, 0xE2, 0x9B, 0xA3,
-    0xA5, 0xEE, 0xD6, 0x04, 0x42, 0x96, 0x24, 0x07, 0xEA, 0x09, 0xB7, 0x98, 0x76, 0x8C, 0x20, 0x00,
-    0xFB, 0x1F, 0x86, 0x5B, 0x9F, 0x9C, 0x2E, 0xB9, 0x10, 0x13, 0xCB, 0x2A, 0xFF, 0x60, 0xDC, 0xFA,
-    0xBB, 0x30, 0x5D, 0xC5, 0xDD, 0x06, 0x5F, 0x82, 0x56, 0x2A, 0x7E, 0x07, 0xA6, 0xFB, 0x07, 0x26,
-    0x7E, 0x02, 0x1B, 0xF0, 0x58, 0x2D, 0xFB, 0x32, 0x75, 0xD5, 0x4D, 0xB2, 0x51, 0x42, 0x90, 0xCC,
-    0xC7, 0x97, 0xAA, 0xC5, 0x19, 0xDB, 0x6C, 0x2F, 0xE1, 0x9F, 0xF6, 0xF5, 0xE3, 0xA8, 0x2A, 0xB9,
-    0xF4, 0xCC, 0x09, 0xCF, 0x8B, 0x13, 0xC1, 0x05, 0x8E, 0xCB, 0x85, 0x91, 0x03, 0x4B, 0xF3, 0x20,
-    0x18, 0xDB, 0xF0, 0x7A, 0x2D, 0x27, 0x77, 0x1A, 0x59, 0x74, 0xDA, 0x59, 0xD8, 0xEA, 0x19, 0x04,
-    0xCD, 0xD2, 0xEE, 0x97, 0xEA, 0x51, 0x04, 0x99, 0xBB, 0x94, 0x2C, 0x40, 0xB0, 0xA9, 0x2F, 0x5F,
-    0x8A, 0xB1, 0x85, 0xE6, 0x6C, 0xDD, 0xE1, 0x46, 0x59, 0x43, 0x01, 0x4F, 0x59, 0x12, 0xE1, 0x8E,
-    0x00, 0xDD, 0x42, 0xA6, 0x27, 0x4B, 0x68, 0x1D, 0xC2, 0xDB, 0xCC, 0x1F, 0xFA, 0x13, 0xAA, 0x63,
-    0x55, 0xF7, 0x2C, 0xD4, 0xF3, 0x4D, 0x51, 0xB0, 0x1D, 0x76, 0x9A, 0x3D, 0xB0, 0x55, 0x17, 0xD9,
-    0xB4, 0x03, 0xC2, 0x3B, 0x30, 0x36, 0x71, 0x87, 0x06, 0x1E, 0x76, 0xDA, 0x09, 0x5D, 0x0B, 0x17,
-    0xC7, 0xA4, 0xA5, 0x7E, 0x84, 0x04, 0xA8, 0xDB, 0xBB, 0x2F, 0x6B, 0x38, 0x5E, 0x7D, 0xA4, 0x49,
-    0xEB, 0x0C, 0x1F, 0xC5, 0x6C, 0xD8, 0xBF, 0x89, 0xDA, 0xCC, 0xD1, 0xF0, 0x50, 0xDC, 0xA6, 0xC9,
-    0xB7, 0x6A, 0x9C, 0x26, 0xD5, 0x8B, 0x86, 0x46, 0x69, 0x87, 0x7B, 0xF7, 0xEF, 0x35, 0x3C, 0xD8,
-    0xE1, 0x9E, 0xC3, 0x43, 0xDD, 0x61, 0xAA, 0xA6, 0x49, 0x2F, 0xDE, 0x1D, 0x8F, 0x5F, 0xFB, 0x68,
-    0xD0, 0x87, 0x31, 0x5F, 0xC2, 0x3B, 0xAC, 0x1D, 0xEE, 0xB4, 0x9B, 0xEA, 0x05, 0xB1, 0x86, 0xF0,
-    0x25, 0x2D, 0x3A, 0xDF, 0x10, 0x98, 0xE4, 0xDE, 0xE4, 0x60, 0xE7, 0x31, 0x53, 0xFC, 0x48, 0x16,
-    0x1C, 0x30, 0xDA, 0x2C, 0xDC, 0x71, 0x17, 0xCB, 0x47, 0xE8, 0xCC, 0xE7, 0x51, 0x1F, 0x2D, 0x34,
-    0xE8, 0x64, 0xBE, 0x80, 0xCA, 0x48, 0xF4, 0xDA, 0x95, 0x7A, 0xF6, 0xDF, 0x1E, 0x46, 0x9E, 0xA5,
-    0x90, 0x57, 0x36, 0x87, 0x7B, 0x82, 0x1C, 0xA6, 0x3B, 0x85, 0xCD, 0xD7, 0x8B, 0x2C, 0x99, 0x65,
-    0x9B, 0x96, 0xBB, 0x87, 0xE2, 0x59, 0x5B, 0x57, 0x74, 0x2D, 0x6E, 0xE7, 0xE4, 0x19, 0x2C, 0xF4,
-    0x11, 0x12, 0x9E, 0x30, 0x37, 0x57, 0x31, 0xC3, 0xCF, 0x03, 0x04, 0x9E, 0xB0, 0xC7, 0xFD, 0x37,
-    0xB4, 0x48, 0x67, 0xA5, 0x50, 0xFF, 0x38, 0xC2, 0xB3, 0xA4, 0xB8, 0x53, 0x17, 0xE5, 0x4F, 0x5A,
-    0x28, 0xD1, 0xD2, 0x78, 0x9B, 0xF0, 0xD2, 0xE8, 0xA5, 0xA5, 0x83, 0xE8, 0xDF, 0x9A, 0x36, 0x3B,
-    0x0D, 0xEE, 0x2F, 0x3F, 0x6A, 0xB4, 0x3B, 0xBF, 0x82, 0x23, 0x86, 0x41, 0xF0, 0x7B, 0x2C, 0xFB,
-    0x22, 0x92, 0xFE, 0x41, 0x83, 0x46, 0xF7, 0x47, 0x02, 0x1E, 0x08, 0xF3, 0xA2, 0x59, 0xD2, 0x9C,
-    0x55, 0xF3, 0x21, 0x20, 0xA3, 0x29, 0x79, 0x46, 0x4E, 0xD8, 0xB0, 0x3A, 0x91, 0x76, 0xDC, 0xBA,
-    0x64, 0xDB, 0x8C, 0x31, 0xF7, 0xA3, 0xDC, 0x83, 0x3C, 0x44, 0xDA, 0xD1, 0xCF, 0xC4, 0xF5, 0xDF,
-    0x99, 0x3F, 0xFF, 0x88, 0xCA, 0x5E, 0xB9, 0xC3, 0x2C, 0xD0, 0xE0, 0xB2, 0x60, 0x9E, 0xC5, 0xA3,
-    0x59, 0x6D, 0xDD, 0xCE, 0x49, 0x6F, 0xC4, 0x0C, 0x53, 0x7C, 0x6F, 0x4A, 0xEF, 0x8F, 0xAD, 0x2E,
-    0xEF, 0x0A, 0xCC, 0x35, 0x6B, 0xE5, 0xD2, 0x56, 0xD3, 0x26, 0xE6, 0xC5, 0xE6, 0x91, 0x4A, 0xAE,
-    0xBC, 0xEA, 0xAA, 0xAB, 0x2E, 0xC0, 0x0A, 0xE7, 0x17, 0xCC, 0xAA, 0xD1, 0xDD, 0x45, 0xB6, 0xFF,
-    0xAF, 0x22, 0x82, 0xD3, 0x22, 0xE8, 0xC6, 0x19, 0xF5, 0xD7, 0x55, 0xA3, 0xAD, 0x36, 0x73, 0x86,
-    0xB7, 0xA0, 0xFF, 0x78, 0xD6, 0xA4, 0x37, 0x6F, 0x25, 0xBA, 0xFD, 0x55, 0x74, 0x94, 0x2D, 0x7F,
-    0x05, 0xAB, 0x88, 0x29, 0xBB, 0xE9, 0xF6, 0xB2, 0xE8, 0xD9, 0x0A, 0x7A, 0x1C, 0x99, 0x3B, 0xD8,
-    0x42, 0x3C, 0xF5, 0xCF, 0x9F, 0x6D, 0x91, 0xD1, 0x11, 0xA9, 0x17, 0x64, 0x5C, 0x05, 0xAA, 0xD4,
-    0x8E, 0x70, 0x3F, 0x85, 0x4A, 0x95, 0x6D, 0x90, 0x5D, 0xB4, 0x5A, 0xCA, 0xAF, 0xB5, 0x8A, 0xAD,
-    0x27, 0x82, 0xB0, 0x59, 0xC2, 0xB5, 0x60, 0xB3, 0x90, 0xC6, 0xED, 0xCB, 0x2C, 0xCF, 0x60, 0x0B,
-    0x2A, 0x98, 0x41, 0x02, 0xCE, 0xF7, 0x38, 0x8C, 0x00, 0x96, 0xFC, 0x77, 0x6B, 0xF4, 0x78, 0xB7,
-    0x29, 0xC3, 0x99, 0x7A, 0x02, 0x6E, 0xD8, 0x1D, 0xBB, 0x53, 0xAA, 0xB2, 0xC7, 0x46, 0xA3, 0x19,
-    0xE9, 0x31, 0x64, 0xD3, 0x7C, 0xD0, 0x47, 0x4D, 0x52, 0x67, 0xF4, 0xDD, 0x33, 0x53, 0x30, 0xDD,
-    0x9B, 0x5D, 0xE9, 0xCD, 0xC8, 0x20, 0x7F, 0x8E, 0xEB, 0xA0, 0x7B, 0x8E, 0x79, 0xDE, 0x23, 0x13,
-    0xFF, 0x82, 0xC7, 0x2C, 0xBC, 0x2E, 0xF3, 0x7B, 0x1A, 0xCB, 0x48, 0xAF, 0x0B, 0xEB, 0x8F, 0xAE,
-    0x5F, 0xDF, 0xD7, 0x1D, 0x07, 0x8C, 0x7A, 0x97, 0xFD, 0x0B, 0x5A, 0x40, 0x88, 0xB5, 0xAA, 0xA5,
-    0x51, 0xD0, 0xD2, 0x1D, 0xB1, 0xF9, 0xE3, 0xFA, 0x9A, 0x97, 0x1E, 0x36, 0x05, 0x56, 0x4F, 0x97,
-    0x33, 0x97, 0xDD, 0xEE, 0x64, 0xE5, 0xA7, 0x62, 0x69, 0x76, 0xA5, 0x49, 0xDA, 0x35, 0xDE, 0xE9,
-    0x8A, 0xEB, 0x55, 0xF3, 0x35, 0x21, 0x40, 0x86, 0x2C, 0x8F, 0x67, 0x13, 0x5B, 0xA2, 0xB4, 0xD5,
-    0x24, 0xC8, 0xD9, 0x86, 0xC8, 0xF2, 0xA4, 0xE8, 0x9A, 0x28, 0xF2, 0xA8, 0x47, 0x6F, 0x68, 0xEB,
-    0xCF, 0x48, 0x89, 0x0B, 0x9B, 0x94, 0x22, 0xB5, 0x95, 0x20, 0x4D, 0xD1, 0x4E, 0x01, 0x51, 0xD0,
-    0xC5, 0x15, 0xC2, 0xAF, 0x31, 0x7C, 0xB9, 0xC1, 0xA9, 0x5D, 0x8F, 0xBF, 0xD3, 0xA3, 0x81, 0xF5,
-    0x95, 0xEE, 0x72, 0x8C, 0xD3, 0xEB, 0x86, 0xE4, 0x9B, 0xB2, 0xA4, 0xE7, 0xC6, 0xE0, 0xCD, 0x86,
-    0x99, 0x1C, 0xAC, 0x3E, 0x9C, 0xD8, 0x0A, 0xE2, 0x4D, 0x9A, 0xC6, 0x79, 0xC4, 0x31, 0xDA, 0x6F,
-    0xDC, 0xDD, 0xF1, 0x9E, 0x76, 0xF5, 0xEB, 0xA1, 0x29, 0x67, 0xEE, 0xEE, 0x00, 0xDF, 0xEC, 0xEC,
-    0x3F, 0x69, 0xD1, 0xF7, 0x34, 0x17, 0xB6, 0xF3, 0xED, 0x8C, 0xC2, 0x01, 0xCB, 0x76, 0xD0, 0x09,
-    0x42, 0x6B, 0x28, 0x08, 0xBB, 0xE4, 0xA1, 0x27, 0xC6, 0xF2, 0x6C, 0xD7, 0x60, 0x4C, 0xA5, 0x04,
-    0x0E, 0x06, 0x82, 0x59, 0xB1, 0x9D, 0x3E, 0xB9, 0x59, 0xAF, 0x72, 0x2D, 0xEE, 0x04, 0xA3, 0x3B,
-    0x6F, 0xDF, 0x38, 0xB5, 0xBB, 0xC3, 0x6D, 0xDD, 0xB1, 0xDF, 0x5E, 0x95, 0x51, 0x63, 0x57, 0x43,
-    0x5E, 0x52, 0x6E, 0xEE, 0x48, 0x49, 0xA5, 0x17, 0x57, 0x3B, 0x15, 0x94, 0x0D, 0xCC, 0x21, 0x6A,
-    0x63, 0x1E, 0x9D, 0x16, 0x95, 0xC8, 0x04, 0x6F, 0x51, 0xD1, 0xFB, 0xAE, 0xF1, 0x5B, 0xB4, 0x84,
-    0x87, 0xDA, 0x0A, 0x29, 0x8C, 0x5F, 0xE5, 0xBA, 0x2F, 0x90, 0x9A, 0x89, 0x7D, 0x2F, 0x49, 0xAD,
-    0xD1, 0x1F, 0x4F, 0x04, 0x68, 0xB5, 0xB3, 0x04, 0xAA, 0x47, 0x98, 0x1A, 0xC6, 0xA1, 0xC3, 0xF8,
-    0x41, 0x97, 0x32, 0x8B, 0x7B, 0xD1, 0x2C, 0x16, 0x3B, 0xE8, 0x30, 0x7B, 0xFF, 0x7F, 0xC1, 0x4C,
-    0xC1, 0xBB, 0xF5, 0xAA, 0x83, 0x52, 0x43, 0x9A, 0x60, 0xA3, 0xD5, 0x58, 0x53, 0x5C, 0xD9, 0x6A,
-    0xAD, 0x17, 0x79, 0x86, 0x55, 0x46, 0x8B, 0xCF, 0xDD, 0xE5, 0x26, 0x75, 0xFD, 0x21, 0xF7, 0xF3,
-    0x3C, 0xC9, 0x84, 0x9B, 0x29, 0xE2, 0x11, 0xC9, 0xED, 0x60, 0x0A, 0x34, 0x53, 0x7C, 0x66, 0x2F,
-    0xD7, 0x7D, 0xDC, 0xF1, 0x71, 0x80, 0x43, 0x1A, 0xED, 0x9B, 0x16, 0xC7, 0x91, 0xB5, 0x90, 0x93,
-    0xA2, 0xD4, 0x22, 0x0F, 0x82, 0xE7, 0xB4, 0x76, 0x87, 0x98, 0xF9, 0x7A, 0x12, 0x49, 0x51, 0x32,
-    0x6C, 0xEF, 0xB8, 0x1D, 0x77, 0x64, 0x63, 0x5C, 0xF6, 0x3C, 0xAB, 0xA1, 0xEF, 0xF0, 0x24, 0x92,
-    0x59, 0x51, 0xE6, 0xEF, 0x70, 0xDA, 0xD8, 0x66, 0x51, 0x6C, 0x1E, 0x4B, 0xD2, 0xAD, 0xD7, 0x78,
-    0xE2, 0x6B, 0x77, 0x30, 0x11, 0x34, 0xA1, 0xA7, 0xC1, 0x84, 0xB5, 0x27, 0xA3, 0xDB, 0x87, 0x56,
-    0x1A, 0xDD, 0x5B, 0x1F, 0xE2, 0xA5, 0xA7, 0x65, 0x64, 0xCC, 0xC2, 0x5C, 0x3D, 0xE3, 0x40, 0x1F,
-    0x36, 0x3C, 0x4C, 0xAC, 0x9D, 0x0C, 0xDE, 0x7C, 0x78, 0x58, 0xA1, 0xDF, 0xC7, 0x9F, 0xA0, 0x82,
-    0x05, 0xAA, 0x01, 0x9A, 0xC0, 0x6F, 0x98, 0xD6, 0x5D, 0xBA, 0x79, 0x3B, 0x97, 0xEF, 0x31, 0x6E,
-    0xE7, 0x35, 0x4B, 0xE5, 0xE1, 0x46, 0xB7, 0xFD, 0xB8, 0xDA, 0x56, 0xA2, 0x47, 0x5F, 0xD1, 0x95,
-    0x41, 0x6A, 0xEE, 0x01, 0x3E, 0xFC, 0x22, 0x0B, 0x33, 0x38, 0x49, 0x47, 0xCC, 0x9A, 0x8C, 0xE3,
-    0x8D, 0xAC, 0x39, 0x77, 0xAC, 0xCC, 0xE6, 0xD9, 0xA9, 0xA6, 0x7A, 0x2D, 0x7F, 0x66, 0xEE, 0xD5,
-    0x1C, 0xB2, 0x70, 0x95, 0x3B, 0xAA, 0xC1, 0x47, 0x4E, 0xB5, 0x0D, 0xE4, 0xBE, 0x0C, 0x53, 0x1E,
-    0xC9, 0xB0, 0x4F, 0x34, 0xC7, 0x95, 0x1D, 0xE2, 0xF2, 0xC2, 0x2C, 0x86, 0x25, 0xAD, 0x77, 0x09,
-    0x2F, 0x85, 0xA6, 0x70, 0x88, 0x53, 0x50, 0xA6, 0xA5, 0x6F, 0xBC, 0x71, 0x89, 0x0E, 0x41, 0xAE,
-    0xCB, 0xE6, 0xBD, 0xF4, 0x4B, 0xA8, 0x15, 0x4F, 0x85, 0xB5, 0x51, 0x7D, 0xC0, 0x6D, 0xEF, 0xF9,
-    0x3A, 0x22, 0xB2, 0xEB, 0x6E, 0x32, 0xB5, 0x3C, 0xDA, 0xFB, 0xF2, 0xDD, 0xB3, 0xB9, 0x49, 0x54,
-    0x03, 0x9B, 0xDA, 0xF3, 0x98, 0xC7, 0x17, 0xE0, 0x68, 0x6F, 0x74, 0x40, 0xE2, 0x50, 0x21, 0x9E,
-    0x7B, 0x70, 0x91, 0xAB, 0xFA, 0xF1, 0x69, 0x20, 0x99, 0x8D, 0xD5, 0x6D, 0x9A, 0x2B, 0x20, 0x17,
-    0x2A, 0xD8, 0x55, 0x96, 0x5A, 0x09, 0xA2, 0xD2, 0x2C, 0x5A, 0x3C, 0x24, 0x9B, 0xA6, 0x1C, 0x07,
-    0x9D, 0x03, 0xE2, 0x63, 0x60, 0x9C, 0x82, 0x0D, 0xE3, 0x8A, 0x77, 0x13, 0xBB, 0xAD, 0xEB, 0xCE,
-    0x8C, 0x96, 0xAE, 0x27, 0x0E, 0xBA, 0x91, 0x82, 0xC1, 0x64, 0xD8, 0x76, 0x55, 0x79, 0xF7, 0xBB,
-    0xE6, 0xB3, 0x81, 0x1D, 0xA2, 0x46, 0xEC, 0xE1, 0x14, 0xBD, 0x25, 0x3A, 0x65, 0xF0, 0xAA, 0x36,
-    0x86, 0xE0, 0x7F, 0x45, 0x0B, 0x00, 0x2E, 0x6D, 0xAB, 0x20, 0x2F, 0x98, 0xAE, 0x40, 0xD6, 0x0D,
-    0x98, 0x71, 0x60, 0xDF, 0xF0, 0x7B, 0x74, 0x69, 0x3F, 0xF1, 0xAA, 0x50, 0xFE, 0xC5, 0x5D, 0x92,
-    0xFC, 0x12, 0xBB, 0x11, 0xC4, 0xE3, 0x42, 0xA9, 0xA5, 0x44, 0x73, 0x16, 0x8F, 0x80, 0x60, 0x7B,
-    0xC0, 0x9B, 0xDC, 0xC1, 0x4B, 0x84, 0x35, 0x08, 0xCA, 0xF2, 0xBB, 0x8C, 0x97, 0x7D, 0xEC, 0x89,
-    0x76, 0xB9, 0xEE, 0xD2, 0x1C, 0x47, 0x4B, 0xAE, 0xDB, 0xDE, 0x29, 0xD7, 0xFD, 0x41, 0x43, 0xBD,
-    0xB6, 0x75, 0xCA, 0xB8, 0x15, 0x2F, 0xF1, 0xED, 0x59, 0xF7, 0xC6, 0x75, 0xEB, 0xE6, 0xDE, 0xB4,
-    0xDC, 0x38, 0x42, 0xC4, 0x7D, 0xA6, 0xDA, 0xCA, 0x9D, 0x1E, 0xA2, 0x45, 0xE6, 0xA5, 0xE0, 0xA0,
-    0xFE, 0xA6, 0xEB, 0x1C, 0x55, 0x73, 0xE4, 0xC8, 0xE5, 0xCC, 0x55, 0x78, 0x62, 0xD8, 0x79, 0x73,
-    0x08, 0x37, 0xAC, 0x1A, 0x34, 0x77, 0x64, 0x98, 0x6B, 0xCA, 0xCC, 0x36, 0xFB, 0x8F, 0xA3, 0x6E,
-    0x63, 0xC7, 0xA2, 0x9B, 0x59, 0x78, 0x7A, 0xB6, 0x74, 0xAC, 0x84, 0xF9, 0xF9, 0xFA, 0x4C, 0x53,
-    0x30, 0xAE, 0x47, 0xAD, 0xD2, 0x89, 0xFD, 0x1F, 0x75, 0x52, 0xB1, 0x6E, 0x14, 0x31, 0x14, 0x9C,
-    0x5D, 0x47, 0xE7, 0x88, 0x55, 0xF0, 0x15, 0x41, 0x4A, 0xE7, 0x94, 0x14, 0x08, 0xFF, 0xC0, 0x25,
-    0x36, 0xA4, 0x47, 0x08, 0xF1, 0x01, 0x7C, 0x46, 0x8A, 0x04, 0x2F, 0xDC, 0x07, 0xD0, 0xD0, 0x43,
-    0x4F, 0x43, 0x49, 0x71, 0xC9, 0x6E, 0xB8, 0xE2, 0xCA, 0x38, 0x34, 0x69, 0x2D, 0x51, 0x50, 0xA4,
-    0x71, 0x24, 0x17, 0x46, 0xB2, 0xD7, 0xD8, 0x47, 0x41, 0x85, 0x2C, 0x59, 0xF6, 0x7B, 0x1A, 0xCF,
-    0x78, 0xE6, 0xED, 0x80, 0x43, 0xF6, 0xD2, 0x70, 0x47, 0x43, 0x93, 0x70, 0x8C, 0x5D, 0x00, 0x8F,
-    0xA1, 0x91, 0x49, 0xEC, 0x3C, 0x37, 0x12, 0x8B, 0x52, 0x40, 0xA3, 0x40, 0x22, 0x48, 0x56, 0x24,
-    0xBB, 0x36, 0xA4, 0x26, 0x8A, 0x77, 0x91, 0xDC, 0x47, 0x9C, 0x1D, 0x6C, 0x01, 0x60, 0x6E, 0x4F,
-    0x46, 0x31, 0xE4, 0xCB, 0x28, 0xE3, 0x57, 0xEE, 0xE7, 0x8D, 0xD2, 0x39, 0x0D, 0x79, 0x2A, 0x7B,
-    0xE9, 0x76, 0xC0, 0xC6, 0xE2, 0x7E, 0x6A, 0xBD, 0xCC, 0x81, 0xE6, 0x00, 0x61, 0x31, 0x7B, 0x9E,
-    0xF4, 0x6D, 0xD4, 0x4A, 0x55, 0x78, 0x79, 0x50, 0x5A, 0xB9, 0x4E, 0x34, 0xCA, 0x5E, 0xD7, 0x02,
-    0x2E, 0xD5, 0x90, 0xC4, 0xA7, 0x9F, 0x56, 0x2E, 0xA8, 0x45, 0x84, 0x56, 0x62, 0x2C, 0x87, 0x45,
-    0x15, 0x82, 0x39, 0xB4, 0xE3, 0x79, 0xED, 0x2E, 0xCE, 0xC8, 0xDD, 0x78, 0xBC, 0xA2, 0xB7, 0x36,
-    0xCA, 0xAC, 0xF2, 0x58, 0x71, 0xFB, 0x50, 0xF0, 0xD4, 0x30, 0x27, 0xFB, 0x61, 0x99, 0x68, 0x10,
-    0x56, 0x5E, 0x4D, 0x6D, 0x60, 0x96, 0xF5, 0x47, 0xDB, 0xE6, 0x2E, 0x1E, 0x30, 0xC5, 0xD6, 0x8E,
-    0x99, 0xC4, 0x0C, 0xBF, 0x36, 0x24, 0x5B, 0x48, 0x8B, 0xCE, 0x6D, 0x69, 0x77, 0xF0, 0xCC, 0x3D,
-    0x65, 0x26, 0xCA, 0xA5, 0xD7, 0x9D, 0x8D, 0xEC, 0xCA, 0x8B, 0xD6, 0x2E, 0x5A, 0xBC, 0xA9, 0xC4,
-    0x62, 0x82, 0xCE, 0x4E, 0xDF, 0x25, 0x09, 0xF9, 0x02, 0xF4, 0x3B, 0x60, 0x2A, 0xE6, 0x49, 0x13,
-    0x88, 0x63, 0x23, 0xEF, 0xA5, 0x2A, 0xAB, 0x78, 0x29, 0x7A, 0xA0, 0xB5, 0x5D, 0x24, 0x75, 0x05,
-    0xE2, 0x69, 0xE9, 0x4A, 0xB5, 0xAA, 0x46, 0x2C, 0xA7, 0xE1, 0x83, 0x4B, 0x6C, 0x8C, 0xB4, 0x38,
-    0x5B, 0x28, 0x67, 0x28, 0x1C, 0x51, 0x9C, 0xB8, 0x23, 0x32, 0x9E, 0x36, 0x68, 0x43, 0xBB, 0xC5,
-    0x74, 0x4E, 0x8C, 0xC7, 0x38, 0x2C, 0x88, 0xD9, 0xB2, 0xDA, 0x24, 0x55, 0xE1, 0x6F, 0x9A, 0xD4,
-    0x46, 0x69, 0xF4, 0x3A, 0xD2, 0x28, 0x94, 0xDC, 0xEA, 0x45, 0x9B, 0x48, 0xFE, 0xE1, 0x56, 0x9E,
-    0x1F, 0xD1, 0xEB, 0xCD, 0x4D, 0xB6, 0x5D, 0x95, 0xD4, 0x8D, 0xBA, 0x9F, 0x88, 0xE7, 0x63, 0xEC,
-    0xCC, 0x69, 0xB9, 0xD3, 0xC0, 0x26, 0x5C, 0xE2, 0x02, 0x91, 0x96, 0x87, 0xCF, 0x81, 0x97, 0x64,
-    0x64, 0x25, 0xEB, 0x33, 0xAC, 0x30, 0x7C, 0xD4, 0x91, 0x5B, 0x6A, 0xAA, 0x28, 0xFE, 0xDE, 0xCB,
-    0x93, 0xA2, 0xAA, 0x84, 0x1D, 0x4A, 0xD8, 0x3D, 0xC9, 0x9E, 0xC4, 0x4C, 0x02, 0xFB, 0xE5, 0xF1,
-    0xFB, 0x33, 0x0E, 0xF6, 0xD1, 0x7C, 0xC3, 0xC3, 0x84, 0xF3, 0xFC, 0x25, 0xE8, 0x6C, 0x79, 0x56,
-    0xCD, 0xEB, 0x2A, 0xA2, 0xB3, 0x7B, 0x32, 0x70, 0x3D, 0xBD, 0x8D, 0x32, 0x79, 0xEE, 0x0F, 0x67,
-    0xFD, 0xBF, 0xF4, 0xFF, 0xEF, 0x1B, 0xDA, 0x92, 0x65, 0x11, 0xC3, 0x6C, 0x9D, 0x2D, 0x0C, 0x0A,
-    0xCC, 0x80, 0x78, 0xFC, 0x9D, 0xB8, 0x92, 0xF2, 0x9C, 0x1B, 0x51, 0x67, 0x42, 0x8F, 0xC3, 0xDA,
-    0x53, 0x5F, 0x8B, 0x8F, 0xCA, 0x17, 0xAC, 0x50, 0xF9, 0x55, 0xDE, 0x04, 0xE0, 0x0F, 0xED, 0x7D,
-    0x4D, 0xAC, 0xDD, 0xE6, 0x99, 0x1E, 0x7F, 0x2C, 0x31, 0x09, 0x67, 0x86, 0x2A, 0x2A, 0x0D, 0x12,
-    0x1B, 0x13, 0x7A, 0x91, 0x45, 0x67, 0x62, 0x87, 0xB3, 0xE8, 0x22, 0x0B, 0x5B, 0xA4, 0x63, 0x60,
-    0xBC, 0xC8, 0xC2, 0x6A, 0x21, 0x25, 0x40, 0xBC, 0x70, 0x16, 0x5D, 0x14, 0x99, 0x62, 0xEE, 0x2C,
-    0xB2, 0x98, 0x02, 0x92, 0x48, 0xC7, 0x18, 0x64, 0x51, 0xA0, 0x51, 0xD1, 0xA4, 0x5D, 0x64, 0x51,
-    0x2F, 0x1C, 0x20, 0xBE, 0x5A, 0xDC, 0x14, 0x70, 0x5B, 0x03, 0xA3, 0x7B, 0x49, 0xC7, 0x0B, 0x2F,
-    0xB2, 0x18, 0x4E, 0x5C, 0x37, 0x40, 0x67, 0x61, 0xC6, 0x91, 0xC7, 0x1D, 0x65, 0x61, 0x3A, 0xA1,
-    0x62, 0x5E, 0x89, 0xE4, 0xD7, 0xF7, 0x79, 0xDE, 0x8F, 0x3C, 0xE7, 0x5C, 0x5D, 0x29, 0xB2, 0x23,
-    0x3B, 0x96, 0x27, 0xC7, 0xBE, 0xE7, 0x1C, 0x9D, 0xC3, 0x43, 0x7E, 0xDF, 0xF7, 0xBE, 0xDF, 0xFB,
-    0xF3, 0xBC, 0x3F, 0x74, 0x1C, 0xFB, 0xF8, 0x53, 0x3E, 0x8F, 0x7C, 0x36, 0x19, 0x9F, 0x1B, 0x3C,
-    0x27, 0x3D, 0x9E, 0x3D, 0xFD, 0xE2, 0x93, 0xCE, 0xC6, 0xE3, 0xC8, 0x19, 0x79, 0x38, 0xB1, 0x31,
-    0x66, 0xB2, 0xCF, 0x4E, 0xB9, 0xBD, 0x2D, 0x87, 0x1A, 0xC7, 0x39, 0xEB, 0x38, 0x13, 0x9F, 0xE5,
-    0x9F, 0x7F, 0xE5, 0xB8, 0xF2, 0x7C, 0xCA, 0xF1, 0x06, 0xFC, 0xCA, 0xD7, 0x67, 0x9E, 0xD7, 0xEF,
-    0xF0, 0x1C, 0x5C, 0xDB, 0x7E, 0xC1, 0x71, 0x42, 0x63, 0xE4, 0x9B, 0xC8, 0x18, 0xF9, 0x2C, 0xE2,
-    0xB5, 0xE3, 0x9A, 0x23, 0xA8, 0x56, 0xCF, 0x69, 0xE1, 0x78, 0x7C, 0x0E, 0x0A, 0x27, 0xCF, 0x9C,
-    0xA8, 0x70, 0x4A, 0xF9, 0x2A, 0xC3, 0x05, 0x53, 0xE7, 0xA8, 0x0C, 0xC1, 0x38, 0xB9, 0x3C, 0x8D,
-    0x4E, 0x69, 0x78, 0x36, 0xC7, 0xF9, 0xB7, 0xCE, 0xB3, 0x72, 0x99, 0x11, 0x17, 0x0D, 0xC6, 0x40,
-    0x86, 0x11, 0x0C, 0xA1, 0xBC, 0xF7, 0x5B, 0xBF, 0x71, 0x6E, 0x7C, 0x7C, 0xE8, 0x67, 0x74, 0x02,
-    0x03, 0x3C, 0x85, 0x8F, 0xCD, 0x4B, 0x7C, 0x8E, 0xAF, 0xEC, 0x5C, 0xDB, 0x1E, 0x76, 0xE5, 0xB7,
-    0xFE, 0xEB, 0xAD, 0x3B, 0x38, 0xF1, 0xE3, 0x45, 0xD8, 0x3A, 0x67, 0x1F, 0x94, 0x53, 0xBA, 0x35,
-    0x47, 0x2C, 0xA3, 0xE9, 0x56, 0xD7, 0x33, 0xEE, 0x69, 0xAC, 0x07, 0x66, 0x16, 0xE1, 0xE4, 0x4E,
-    0x7E, 0x6D, 0xC7, 0x80, 0xBE, 0xE1, 0xE8, 0x44, 0xAD, 0x13, 0xF6, 0x18, 0x8B, 0xBC, 0x91, 0xE9,
-    0xA5, 0x55, 0xD0, 0x62, 0xE6, 0xF2, 0x43, 0x99, 0xA1, 0x1C, 0x1A, 0xB5, 0x98, 0x63, 0x5A, 0x61,
-    0x16, 0x93, 0x6B, 0x2E, 0xC8, 0x89, 0x8D, 0x69, 0x9D, 0xE4, 0x65, 0x63, 0x2A, 0x7B, 0xA5, 0xD6,
-    0xCE, 0xC9, 0xE1, 0xD2, 0xFC, 0xBE, 0x93, 0xCA, 0xA1, 0x7B, 0x4F, 0xC8, 0xC9, 0x3C, 0x63, 0xE4,
-    0x6D, 0x60, 0xB0, 0x48, 0xDE, 0x73, 0x9B, 0xAB, 0xFE, 0x83, 0xB5, 0x41, 0xE2, 0xD9, 0x35, 0x38,
-    0x4D, 0x64, 0x70, 0x9A, 0xE4, 0x32, 0x3E, 0xFE, 0xD4, 0x21, 0x74, 0x3A, 0xBD, 0x46, 0xA7, 0x71,
-    0x8D, 0x4E, 0x03, 0x67, 0x3D, 0x90, 0x4E, 0x3D, 0xE9, 0xD4, 0x71, 0x30, 0x2D, 0xE9, 0x94, 0x6D,
-    0xD2, 0x89, 0xE3, 0x0D, 0xF9, 0x1C, 0xE9, 0xF3, 0xCD, 0xE9, 0xB4, 0x3C, 0xE7, 0xDC, 0x1F, 0xA5,
-    0xEE, 0x15, 0x3C, 0x1D, 0x95, 0xB5, 0x90, 0x8F, 0x31, 0x0C, 0xA1, 0xD3, 0xA0, 0x63, 0xFC, 0xDA,
-    0xB3, 0xFC, 0x4C, 0x66, 0x81, 0x85, 0xAE, 0x5C, 0xF3, 0xC6, 0x13, 0x13, 0xE6, 0xE7, 0xF5, 0xAE,
-    0x8C, 0x2F, 0xAC, 0x71, 0xBD, 0x84, 0xBF, 0xEF, 0x31, 0x77, 0xAF, 0x48, 0x71, 0x21, 0x77, 0x5C,
-    0x8D, 0x28, 0xBD, 0x52, 0x62, 0x4A, 0x58, 0x63, 0xDF, 0xE0, 0x44, 0x3A, 0xAC, 0x1C, 0x83, 0x70,
-    0xA7, 0x15, 0xCF, 0xE1, 0x4C, 0x2E, 0x97, 0x3A, 0x72, 0x4A, 0x39, 0xC9, 0x9E, 0x23, 0xF4, 0x08,
-    0x7A, 0xCF, 0xD4, 0xAE, 0xA9, 0x7D, 0x2E, 0x92, 0x2C, 0x3F, 0xD6, 0xBF, 0x34, 0x58, 0xCE, 0x23,
-    0xA7, 0xF0, 0xAB, 0x7B, 0x9F, 0x23, 0x55, 0x3A, 0x0C, 0x6F, 0x90, 0x5F, 0x07, 0x83, 0x4C, 0x49,
-    0x38, 0x68, 0x74, 0xDC, 0x5E, 0x5E, 0xDC, 0x4E, 0x16, 0xCD, 0x6D, 0xB8, 0xF3, 0x5D, 0xCE, 0x12,
-    0x27, 0x70, 0x72, 0x5C, 0x31, 0x86, 0x84, 0x08, 0x28, 0x20, 0xCA, 0x81, 0xA4, 0x02, 0x55, 0x0D,
-    0xC6, 0x9F, 0x57, 0x42, 0xAB, 0xA4, 0x7E, 0x18, 0x6B, 0x78, 0xDE, 0x3E, 0x25, 0x55, 0x89, 0xA5,
-    0x2B, 0x0B, 0x99, 0x6D, 0xB9, 0x2F, 0xDC, 0x90, 0x60, 0x4A, 0x72, 0x6D, 0x39, 0xCB, 0x91, 0x4C,
-    0xC9, 0x29, 0xA7, 0xC3, 0x1A, 0xC9, 0x24, 0x79, 0x45, 0x63, 0x17, 0x3B, 0xAA, 0x95, 0x33, 0xB8,
-    0xD1, 0x36, 0x3E, 0x6C, 0x0F, 0x7C, 0x88, 0xB5, 0x09, 0xE7, 0x0F, 0xA7, 0x03, 0x1F, 0x82, 0xF2,
-    0x20, 0x92, 0xF0, 0x0A, 0x76, 0xA5, 0x7C, 0xE3, 0x3E, 0xE3, 0x3E, 0x23, 0xE3, 0x94, 0x45, 0x33,
-    0x8F, 0x98, 0x2C, 0x18, 0x64, 0xF6, 0x42, 0x92, 0xEA, 0x46, 0x3E, 0x03, 0x0D, 0x65, 0x21, 0xF8,
-    0xA3, 0xA4, 0xB6, 0x17, 0xE4, 0xBA, 0x47, 0xB5, 0xE5, 0x05, 0x5E, 0x92, 0xEC, 0x43, 0xFE, 0x18,
-    0x67, 0xC6, 0x22, 0xE7, 0x2C, 0x87, 0x93, 0x78, 0xA5, 0x33, 0x1F, 0xDE, 0xD8, 0xC3, 0x49, 0x70,
-    0xD2, 0x1B, 0xF4, 0xC7, 0x20, 0x5D, 0xAC, 0x8E, 0x8E, 0x52, 0x1E, 0xB2, 0xDD, 0x1D, 0x2E, 0x0E,
-    0x96, 0x7D, 0x5C, 0x28, 0xAF, 0x9C, 0x6B, 0xF7, 0xF4, 0x8A, 0x15, 0x94, 0x43, 0xC8, 0x9A, 0x2A,
-    0x9B, 0x94, 0x9F, 0x39, 0xAE, 0x0D, 0xD6, 0xE2, 0x0F, 0xA7, 0xD5, 0x4E, 0x58, 0xFB, 0xA1, 0xBF,
-    0xF6, 0x43, 0xB2, 0xBA, 0x3B, 0xAC, 0xFD, 0xF0, 0x86, 0x33, 0xC9, 0x07, 0xF7, 0xE3, 0x5A, 0x7E,
-    0xB7, 0x05, 0x0E, 0x34, 0x5C, 0x7B, 0xF2, 0x06, 0x79, 0x65, 0x79, 0xB8, 0x10, 0x5D, 0x19, 0xBF,
-    0xA4, 0xE0, 0x21, 0x67, 0x93, 0x1F, 0x9D, 0xF8, 0x8D, 0x27, 0x38, 0x08, 0x11, 0x79, 0x3A, 0x23,
-    0xB7, 0xD7, 0xB1, 0x09, 0x4D, 0xFC, 0xF9, 0x1B, 0x1D, 0xA1, 0x6C, 0xEC, 0x9C, 0xAF, 0x41, 0xA3,
-    0x13, 0x94, 0x3D, 0xA4, 0x43, 0x95, 0x6F, 0xD2, 0x6F, 0xEB, 0x37, 0x2E, 0x45, 0xAE, 0x7C, 0xA3,
-    0x12, 0x18, 0xDF, 0xBC, 0xBA, 0x35, 0xE0, 0x6C, 0x72, 0xDA, 0x10, 0x32, 0x0C, 0xB3, 0x16, 0x8A,
-    0xC9, 0x75, 0xE2, 0x0A, 0xD7, 0x14, 0xCA, 0xCB, 0xDC, 0xE5, 0xCC, 0xE7, 0x31, 0x7D, 0x39, 0xB3,
-    0xDF, 0xE2, 0xB4, 0x72, 0x48, 0x52, 0x38, 0x69, 0xE6, 0xA4, 0x4F, 0x61, 0x37, 0xC8, 0xC7, 0x43,
-    0x9C, 0xD7, 0x98, 0x79, 0x5E, 0x53, 0x39, 0x5C, 0xD9, 0x19, 0x7D, 0x99, 0x2B, 0xA6, 0x54, 0x88,
-    0x76, 0xC1, 0x36, 0x13, 0x02, 0x66, 0x2B, 0xFE, 0x39, 0xAD, 0x04, 0x04, 0xE9, 0x0C, 0x16, 0x25,
-    0x16, 0x09, 0xA8, 0xA4, 0x2D, 0x33, 0x27, 0xEC, 0x2C, 0xF9, 0x74, 0x06, 0x93, 0xE5, 0x29, 0x70,
-    0x10, 0xDF, 0x60, 0x9D, 0xE3, 0xCA, 0xD2, 0x92, 0x2B, 0x03, 0xDA, 0x90, 0x04, 0x94, 0xC4, 0x99,
-    0x25, 0x1F, 0xA9, 0x14, 0x50, 0x1F, 0xF4, 0x54, 0x3B, 0xC6, 0xCC, 0x72, 0xC7, 0x7C, 0xC9, 0x70,
-    0x26, 0x72, 0xCE, 0xA8, 0xC3, 0x1A, 0x72, 0x12, 0x38, 0x99, 0xB7, 0xF6, 0x46, 0xFE, 0x97, 0xB3,
-    0xCA, 0x39, 0x7D, 0x7D, 0xD3, 0xE1, 0xBD, 0x9C, 0x55, 0xB8, 0x4C, 0x76, 0x5F, 0x49, 0x5A, 0xCB,
-    0x5A, 0x50, 0x07, 0xC8, 0x16, 0x07, 0x97, 0x26, 0xD7, 0x2E, 0x42, 0x35, 0x75, 0x3E, 0x2F, 0x5A,
-    0x9A, 0x56, 0xAE, 0x3F, 0x65, 0x2B, 0x72, 0xAB, 0xA6, 0x22, 0xAD, 0x5B, 0x7D, 0xCE, 0xB7, 0xCB,
-    0x2B, 0x17, 0x5B, 0xAA, 0xAA, 0xE6, 0x92, 0xAC, 0x75, 0x50, 0xCB, 0xEF, 0x9C, 0xA0, 0x7A, 0x5E,
-    0x26, 0x1E, 0x64, 0x96, 0x1B, 0x95, 0xB5, 0x66, 0xBD, 0x7A, 0xDF, 0xBE, 0x3C, 0x4F, 0x60, 0x7E,
-    0x9F, 0x62, 0x30, 0x30, 0x17, 0xB6, 0x3A, 0x2C, 0x9B, 0x10, 0x51, 0x46, 0x22, 0x83, 0x94, 0xA9,
-    0xE1, 0xB9, 0xC6, 0x98, 0x65, 0xA9, 0x64, 0xC0, 0x32, 0x23, 0x19, 0xAD, 0x30, 0xB8, 0x1C, 0x00,
-    0x5D, 0xD6, 0x50, 0xAF, 0xD6, 0xD0, 0x57, 0x5B, 0x97, 0x53, 0x33, 0xC8, 0x99, 0x72, 0xD3, 0x07,
-    0x66, 0x5A, 0x67, 0xCE, 0x50, 0x5F, 0x54, 0xB2, 0xFB, 0x6A, 0x00, 0x25, 0x46, 0x25, 0xBC, 0x5A,
-    0x40, 0x3A, 0x37, 0x37, 0x3B, 0xC4, 0x66, 0x38, 0x2D, 0x32, 0x5D, 0x08, 0x2B, 0xAA, 0x68, 0x24,
-    0x7D, 0x21, 0xB5, 0xCB, 0xCC, 0x03, 0xEB, 0x89, 0xB8, 0xE9, 0xEE, 0xC1, 0xD4, 0xC8, 0xBD, 0x23,
-    0x49, 0x26, 0x53, 0x1C, 0x39, 0x47, 0xAF, 0xE3, 0x24, 0x83, 0x86, 0xF4, 0xA4, 0xF0, 0xF1, 0xBB,
-    0x44, 0xED, 0x07, 0xDD, 0x61, 0x3A, 0xC8, 0xE8, 0x6A, 0xA9, 0x3B, 0x92, 0x94, 0x8F, 0x6B, 0x72,
-    0x42, 0x52, 0xC5, 0x0D, 0x5F, 0xAC, 0xE0, 0x09, 0x7A, 0xBE, 0x70, 0xF3, 0xE6, 0x19, 0x85, 0x44,
-    0xA9, 0xA6, 0x9C, 0x4C, 0x43, 0xB4, 0xC2, 0x51, 0xF3, 0x6D, 0x27, 0x6D, 0xA9, 0xA4, 0xE2, 0x81,
-    0x5A, 0x2A, 0xB0, 0x2B, 0x70, 0x6A, 0x63, 0x3A, 0xB5, 0x7D, 0x3D, 0x6F, 0x5F, 0x53, 0x6B, 0x27,
-    0x85, 0xC6, 0x7E, 0x50, 0xB6, 0x76, 0x3F, 0xCF, 0x0B, 0xE8, 0x65, 0x87, 0x58, 0x52, 0x64, 0x7B,
-    0xFC, 0xC9, 0x5A, 0xCB, 0xF6, 0x18, 0xB8, 0x30, 0x11, 0x04, 0x18, 0x84, 0x68, 0xD2, 0xA8, 0xC0,
-    0xA4, 0x6C, 0xEE, 0x61, 0x94, 0x29, 0xD7, 0x73, 0x48, 0x42, 0x84, 0x90, 0xD2, 0x56, 0x08, 0x09,
-    0x9D, 0x03, 0xB3, 0xE4, 0xEF, 0xF5, 0xC0, 0xF0, 0x15, 0x3D, 0x30, 0xAA, 0x79, 0xA0, 0x6C, 0x5B,
-    0x2C, 0xA8, 0xAC, 0x01, 0x6D, 0x92, 0xA8, 0x8D, 0x2A, 0x3D, 0x63, 0x54, 0x61, 0x1D, 0xDC, 0x31,
-    0x56, 0xBB, 0xA4, 0x8C, 0x69, 0x5C, 0x39, 0xC9, 0x6B, 0x05, 0xF7, 0x13, 0x4C, 0x0B, 0x1E, 0x28,
-    0xAF, 0x3C, 0xD0, 0x58, 0xF6, 0x93, 0x3D, 0xC9, 0x03, 0x21, 0x1E, 0xB1, 0xCA, 0x5B, 0xC2, 0x7F,
-    0xC9, 0x3E, 0x24, 0x72, 0xE3, 0x80, 0xFF, 0x4A, 0x91, 0x2B, 0xF9, 0xAC, 0xE0, 0xED, 0xE3, 0x13,
-    0x58, 0x82, 0xC6, 0x79, 0x08, 0xC4, 0x28, 0xBC, 0x86, 0xFB, 0x38, 0xCE, 0x60, 0x64, 0x79, 0xBD,
-    0x6E, 0xCB, 0x82, 0x2F, 0x94, 0x74, 0xCE, 0xE9, 0x83, 0xEB, 0x24, 0x62, 0x11, 0x2C, 0x94, 0xC8,
-    0xD2, 0xE4, 0xA6, 0x2D, 0xA1, 0xB3, 0x4D, 0x06, 0x33, 0x48, 0x88, 0x2D, 0xC3, 0x70, 0x07, 0x15,
-    0x10, 0x35, 0xF5, 0xE2, 0x1E, 0xB5, 0xA1, 0xC8, 0x26, 0xB0, 0xB5, 0x4E, 0xDD, 0xED, 0xED, 0x4A,
-    0x70, 0x61, 0x76, 0xC9, 0x4A, 0xE4, 0xA8, 0xB0, 0x4D, 0x29, 0x5B, 0x5F, 0xA4, 0x90, 0x49, 0x1F,
-    0xA7, 0x3A, 0xD9, 0xBB, 0xC4, 0x6B, 0x52, 0x95, 0xCB, 0xCE, 0x72, 0x56, 0x86, 0x0F, 0x8C, 0x4E,
-    0x95, 0xBC, 0xF2, 0xB8, 0x40, 0xA9, 0xE3, 0xFF, 0x74, 0xD0, 0x7D, 0x40, 0x99, 0x5C, 0xEA, 0xB4,
-    0xAD, 0x5A, 0x3A, 0xB5, 0xA6, 0x21, 0x4F, 0x28, 0x99, 0x65, 0x63, 0x61, 0xF0, 0xC5, 0x4C, 0x65,
-    0x32, 0x88, 0x51, 0xFD, 0x0D, 0x22, 0x63, 0x41, 0x21, 0xD6, 0x4A, 0xA5, 0x31, 0x3E, 0xC2, 0x3E,
-    0x8F, 0x94, 0xC4, 0xBA, 0xEE, 0x85, 0x6E, 0xFD, 0x51, 0x3F, 0x82, 0x92, 0x4B, 0x95, 0x13, 0x1C,
-    0x6B, 0x15, 0x04, 0xED, 0xEA, 0x64, 0xA0, 0xB9, 0x51, 0x3E, 0x9F, 0x4F, 0x46, 0x36, 0x68, 0x28,
-    0xC9, 0xE7, 0x93, 0x41, 0xA2, 0xE0, 0xA3, 0xD0, 0x9E, 0x0C, 0x8B, 0x3A, 0x42, 0xD3, 0x5E, 0xDB,
-    0x36, 0x24, 0x2D, 0xD5, 0x91, 0x0A, 0xCD, 0x61, 0xE5, 0xEB, 0x58, 0xF5, 0x36, 0xDB, 0x7C, 0xB3,
-    0x6F, 0xC4, 0xC5, 0xE7, 0xAA, 0xD9, 0x8F, 0x1F, 0xB6, 0x0B, 0xD1, 0x3A, 0x37, 0x79, 0xFC, 0xC0,
-    0x59, 0xC9, 0xB5, 0x65, 0xF9, 0xEC, 0x26, 0x4A, 0x75, 0x4D, 0x53, 0x55, 0x69, 0xF1, 0xE3, 0x24,
-    0x4B, 0xF4, 0x52, 0xAF, 0xAA, 0x4F, 0xD5, 0x73, 0xCB, 0xED, 0xEE, 0x75, 0xD4, 0xF8, 0x62, 0x9A,
-    0x8D, 0x56, 0xD7, 0x65, 0xDC, 0xA4, 0x6A, 0x47, 0xA8, 0xCE, 0x4E, 0xE8, 0x3C, 0x50, 0xEC, 0xD7,
-    0xAA, 0x06, 0x3A, 0xBA, 0x22, 0xDB, 0x93, 0xAA, 0x09, 0xCB, 0x4E, 0x58, 0xD9, 0x51, 0x97, 0xAB,
-    0x54, 0x9E, 0x07, 0xA3, 0x88, 0x34, 0x81, 0x05, 0x19, 0x4E, 0x8F, 0x80, 0x61, 0x85, 0x9C, 0x86,
-    0x7A, 0x6D, 0x5C, 0xB3, 0xB5, 0x07, 0xFB, 0x2C, 0xB6, 0xF6, 0xC5, 0x1E, 0x4B, 0xEF, 0x76, 0x60,
-    0x76, 0x97, 0xE7, 0xF3, 0x5A, 0xCC, 0xD1, 0xAB, 0x0E, 0xF3, 0x89, 0xFA, 0x53, 0xBA, 0x11, 0x2E,
-    0x73, 0x54, 0x50, 0x73, 0x57, 0xBF, 0x24, 0x4C, 0x15, 0xF1, 0x92, 0x42, 0x32, 0x79, 0x93, 0x50,
-    0x5E, 0x27, 0x8B, 0xD4, 0x5E, 0x93, 0xDD, 0x72, 0x00, 0xED, 0x47, 0x5C, 0xD0, 0x08, 0xDD, 0xB6,
-    0x85, 0x13, 0xE1, 0x13, 0x35, 0xF0, 0x89, 0xF6, 0x57, 0x0B, 0xFD, 0x95, 0xED, 0x0B, 0x34, 0xB8,
-    0x7B, 0x2A, 0x8B, 0xC1, 0xF9, 0xF8, 0x56, 0x15, 0xF7, 0x18, 0xA0, 0x6A, 0x0A, 0x5C, 0xA7, 0xC6,
-    0xF9, 0x72, 0x0E, 0x74, 0xA0, 0x4E, 0x6B, 0xB8, 0xCD, 0x32, 0x28, 0xF7, 0x11, 0xEB, 0x13, 0x50,
-    0x83, 0x26, 0x7C, 0x9E, 0xCE, 0x94, 0x3D, 0xD5, 0x0A, 0x35, 0x8B, 0xAC, 0x0F, 0x46, 0x51, 0x79,
-    0xDC, 0x90, 0x50, 0x3B, 0xA4, 0x41, 0xD4, 0x60, 0x49, 0xF3, 0x2C, 0xE4, 0x35, 0xE4, 0x0C, 0xD0,
-    0x8E, 0xDB, 0x3B, 0x03, 0xF9, 0xAA, 0x08, 0x69, 0x0F, 0xDC, 0x45, 0x4E, 0xCB, 0x19, 0x8E, 0x51,
-    0x6D, 0x09, 0x5A, 0x2B, 0x24, 0x97, 0xEC, 0x89, 0x33, 0x10, 0x8D, 0xC2, 0x93, 0x4A, 0xDD, 0xD4,
-    0x5E, 0xD2, 0xB2, 0x61, 0x50, 0xAB, 0x89, 0x98, 0xD8, 0xB1, 0x0D, 0x7A, 0xFD, 0xA0, 0x56, 0x9D,
-    0x9E, 0xD8, 0x81, 0xF7, 0x6A, 0xCC, 0x84, 0xB5, 0x0E, 0x23, 0xD5, 0x59, 0x89, 0x16, 0xA4, 0xB1,
-    0x23, 0x12, 0x8C, 0x27, 0xDB, 0x55, 0x7B, 0x53, 0xF6, 0x19, 0xA7, 0x28, 0x62, 0x89, 0x66, 0xB2,
-    0xAE, 0x0D, 0x35, 0x3D, 0x3E, 0xDE, 0x53, 0xCB, 0x08, 0x87, 0x94, 0x98, 0xCB, 0xB4, 0x6D, 0xA6,
-    0x0B, 0x64, 0x0B, 0x19, 0xB8, 0xA7, 0x9B, 0x3A, 0xE3, 0xEA, 0xA8, 0x49, 0xE3, 0x58, 0xA7, 0x16,
-    0x56, 0x93, 0x6F, 0x07, 0xA9, 0x1A, 0xB7, 0x75, 0x4E, 0x72, 0xF5, 0x32, 0x87, 0x83, 0x3C, 0x6B,
-    0xF5, 0xD9, 0x85, 0xBB, 0x02, 0xE0, 0x10, 0x15, 0x03, 0x05, 0x22, 0xAB, 0x23, 0xFA, 0x59, 0xA8,
-    0x06, 0x57, 0x2C, 0x32, 0x55, 0x40, 0x6D, 0x42, 0x17, 0x2D, 0x2D, 0x5C, 0x19, 0xB7, 0x2B, 0x84,
-    0x91, 0x89, 0xF7, 0x1F, 0xE3, 0x4F, 0x56, 0xE4, 0xCB, 0x2D, 0x77, 0x9C, 0x93, 0xEB, 0xEC, 0x91,
-    0x03, 0x4E, 0xCA, 0xB4, 0x66, 0xC3, 0x7A, 0xB4, 0xC2, 0x2E, 0xCA, 0x86, 0x50, 0xED, 0x82, 0xE8,
-    0xC5, 0x21, 0x56, 0x09, 0x16, 0x5F, 0x9F, 0xAC, 0x45, 0x90, 0x5A, 0x73, 0x5E, 0x96, 0xE5, 0xBF,
-    0x5E, 0x25, 0x9B, 0x08, 0xBF, 0x04, 0xAD, 0xBA, 0x18, 0x61, 0x1F, 0xB6, 0x3A, 0xCD, 0xB8, 0x0D,
-    0x1B, 0x65, 0xD7, 0xB4, 0x8E, 0x6A, 0x75, 0xF7, 0x45, 0x59, 0x50, 0x53, 0xCB, 0x8E, 0x15, 0x72,
-    0x7A, 0xE0, 0x96, 0x88, 0xCC, 0x43, 0xAF, 0x8E, 0x32, 0x40, 0xBC, 0x46, 0x78, 0x9E, 0xB0, 0xC1,
-    0x6B, 0x58, 0x66, 0x6E, 0x79, 0x01, 0x5E, 0x74, 0x22, 0x46, 0x80, 0x2C, 0x40, 0x24, 0xBB, 0xB6,
-    0xA3, 0x6D, 0x21, 0x67, 0x70, 0xED, 0x46, 0x3B, 0x66, 0xBD, 0xEF, 0x5C, 0x26, 0xEE, 0x93, 0x76,
-    0x6F, 0xDC, 0x07, 0xD5, 0x18, 0xF4, 0xB0, 0xEA, 0x5B, 0x59, 0xD4, 0xA4, 0x7A, 0x18, 0xE4, 0x3B,
-    0xA6, 0xF4, 0x01, 0x23, 0x51, 0xAC, 0xCA, 0x1E, 0xF7, 0x41, 0xE4, 0x18, 0x24, 0xCA, 0x69, 0xF8,
-    0x11, 0x90, 0x88, 0x67, 0xF7, 0x4C, 0xBD, 0xB9, 0xE1, 0x01, 0x19, 0xE6, 0xDB, 0xF2, 0x45, 0xF9,
-    0xB8, 0x98, 0xA4, 0x83, 0x18, 0x33, 0x65, 0x95, 0x5F, 0x2B, 0x49, 0x94, 0xCA, 0xD9, 0x82, 0x98,
-    0x73, 0x4F, 0x59, 0xDD, 0x68, 0x5D, 0xDB, 0xC2, 0x9F, 0xDD, 0x5B, 0xC8, 0x66, 0xA8, 0x18, 0xCF,
-    0x6A, 0x47, 0xEE, 0x05, 0x10, 0x21, 0xB7, 0xEA, 0x31, 0x6F, 0x54, 0x65, 0x96, 0x56, 0xA5, 0x95,
-    0x56, 0xF3, 0xED, 0xDA, 0x03, 0x77, 0x53, 0x3D, 0x70, 0x04, 0x0D, 0x85, 0xAC, 0x83, 0xAF, 0xFE,
-    0xF1, 0xE0, 0xEA, 0x81, 0x83, 0x3D, 0xE3, 0xC0, 0x11, 0xC7, 0x7F, 0x37, 0xA8, 0xF6, 0x7B, 0xBB,
-    0x57, 0x47, 0x7A, 0xEC, 0x75, 0x7F, 0x61, 0x76, 0x3C, 0xB0, 0xD7, 0xA9, 0xC5, 0x96, 0x2B, 0xE1,
-    0x93, 0x50, 0x63, 0x0F, 0x7A, 0x79, 0x88, 0x09, 0x8F, 0xAE, 0xF3, 0x04, 0xDE, 0x05, 0x17, 0x67,
-    0xEA, 0x8E, 0x6E, 0x3C, 0x3E, 0xC3, 0xE7, 0xE7, 0x9D, 0x88, 0xAF, 0xBB, 0x4E, 0x68, 0x45, 0x4F,
-    0xA0, 0x2A, 0xAD, 0x0B, 0x1B, 0x35, 0x3C, 0x14, 0x55, 0x94, 0xB3, 0x59, 0xF5, 0x79, 0xFC, 0x50,
-    0x9D, 0x79, 0x42, 0x84, 0xD0, 0x09, 0x0A, 0x4B, 0xBD, 0x68, 0xA0, 0x94, 0x54, 0x8F, 0x09, 0x0E,
-    0xDC, 0x3C, 0x3A, 0xEC, 0x41, 0xA2, 0x13, 0xC2, 0x1F, 0xAE, 0x51, 0x8F, 0xDF, 0x33, 0xAA, 0xED,
-    0x3D, 0xA3, 0xD3, 0xF0, 0x7E, 0xA5, 0x07, 0x7A, 0x9D, 0x1E, 0xE8, 0x77, 0x84, 0x06, 0x2A, 0xBF,
-    0x8D, 0x08, 0x0F, 0xF8, 0xAD, 0xCE, 0xD7, 0x6F, 0xF5, 0x8C, 0x3E, 0x1D, 0x1D, 0x27, 0x7F, 0xAC,
-    0x55, 0xE3, 0xE3, 0xE5, 0x46, 0x71, 0x84, 0x77, 0x1A, 0xB5, 0x3E, 0xE4, 0xF4, 0x8A, 0x3C, 0x34,
-    0x4A, 0x40, 0x71, 0x08, 0xF5, 0xC0, 0xDA, 0xDA, 0x1F, 0xD6, 0xB0, 0xBD, 0x4F, 0x5C, 0x86, 0x50,
-    0xFE, 0x66, 0x0B, 0x18, 0x26, 0x5E, 0xCC, 0xAD, 0xF2, 0x91, 0x70, 0x19, 0x66, 0x7F, 0xDE, 0xDA,
-    0x4D, 0xB0, 0x3A, 0xE0, 0x23, 0x05, 0xFB, 0x5F, 0x1A, 0xD7, 0x5C, 0xF9, 0xA0, 0x51, 0x71, 0xB8,
-    0x6B, 0x85, 0x70, 0xA5, 0x1B, 0xDF, 0x7A, 0xF1, 0x71, 0x41, 0x19, 0x6F, 0x57, 0x7C, 0x96, 0x4B,
-    0xE2, 0xC0, 0x8F, 0x6B, 0x6A, 0xC4, 0x8A, 0x08, 0x99, 0x3A, 0x4F, 0x91, 0xEA, 0xA6, 0x0D, 0x1A,
-    0x55, 0x69, 0x83, 0xAA, 0x89, 0xB8, 0xD0, 0xBD, 0xA9, 0xCE, 0x2E, 0x64, 0x99, 0x9C, 0xE2, 0x98,
-    0xFC, 0x1E, 0x4E, 0xE1, 0x6B, 0xAA, 0x4C, 0x21, 0x07, 0xCB, 0xCB, 0xB4, 0xFE, 0x61, 0xCC, 0x0B,
-    0xDD, 0x12, 0xAC, 0xD6, 0xA9, 0x95, 0xCB, 0xA2, 0x4F, 0x2E, 0x88, 0xE4, 0x51, 0xDA, 0x1B, 0xD0,
-    0xBB, 0x57, 0x84, 0x8B, 0x4E, 0x49, 0x24, 0xCB, 0x83, 0x3F, 0x62, 0x60, 0x09, 0x26, 0x91, 0xE4,
-    0x85, 0x73, 0x9E, 0xF6, 0xA6, 0x0C, 0x6F, 0xE0, 0x1B, 0x58, 0xE5, 0x78, 0xB3, 0x07, 0x26, 0x03,
-    0x21, 0xC4, 0x11, 0x09, 0x6A, 0xBC, 0x19, 0xA2, 0x3A, 0x02, 0x1A, 0xE6, 0xF6, 0x51, 0x9D, 0x64,
-    0x13, 0x66, 0x15, 0x35, 0x10, 0xB9, 0x32, 0xF2, 0xB0, 0xBD, 0x84, 0x37, 0x41, 0x1B, 0xB4, 0x84,
-    0x3F, 0xC2, 0x26, 0xF8, 0x45, 0xAB, 0x58, 0x80, 0x7F, 0xBD, 0xE6, 0x9B, 0xCA, 0x97, 0x8D, 0x07,
-    0xEB, 0xBA, 0x80, 0x24, 0x04, 0x16, 0x20, 0x3C, 0xC3, 0xFD, 0x9C, 0xE2, 0x99, 0xA6, 0x08, 0xF4,
-    0x2C, 0x66, 0xBB, 0x07, 0x1D, 0x06, 0xC3, 0x86, 0x9E, 0x6B, 0x30, 0x65, 0x29, 0x61, 0xD5, 0xD2,
-    0x34, 0x25, 0xDF, 0x40, 0x10, 0xDD, 0x9E, 0x84, 0xB2, 0xC6, 0xF4, 0x62, 0xC0, 0x47, 0xCD, 0xCA,
-    0xA8, 0x9F, 0x2D, 0xEC, 0x0D, 0x51, 0x96, 0xAE, 0x1F, 0x68, 0xD4, 0x0E, 0xA5, 0x4E, 0x1E, 0x2D,
-    0xEA, 0x63, 0xD6, 0x0E, 0x9C, 0x4D, 0x76, 0x90, 0x71, 0x86, 0xFA, 0xDC, 0x19, 0xC4, 0x2B, 0x6F,
-    0x71, 0xE0, 0xED, 0x48, 0x28, 0x82, 0xB0, 0x2E, 0xCD, 0x39, 0x48, 0x67, 0x88, 0xF5, 0x0E, 0xDE,
-    0x8F, 0x48, 0x3B, 0x59, 0x38, 0xB8, 0x9D, 0x51, 0xAF, 0x73, 0xAC, 0x70, 0x09, 0xD9, 0x59, 0x14,
-    0xFA, 0x35, 0x01, 0xCD, 0x91, 0xDB, 0x25, 0x7E, 0x7D, 0xA0, 0xB7, 0x4B, 0xF9, 0x1F, 0xBF, 0xA2,
-    0x2E, 0x02, 0x31, 0xD8, 0xF4, 0xE5, 0x9E, 0xBB, 0x91, 0x7C, 0x98, 0x7F, 0xB3, 0xA7, 0x55, 0xC6,
-    0x6F, 0x26, 0x3A, 0xB4, 0x49, 0x8D, 0xDF, 0x04, 0xBD, 0xA7, 0x42, 0x0A, 0x5A, 0x44, 0x84, 0x7C,
-    0x29, 0x6C, 0x07, 0x40, 0xF7, 0x1F, 0xE1, 0x50, 0x85, 0xBA, 0x26, 0x8A, 0xEC, 0xA9, 0xD6, 0x50,
-    0xAB, 0x83, 0x2E, 0x15, 0x1E, 0xB5, 0x7A, 0x28, 0x72, 0x8A, 0xE4, 0xCA, 0x7F, 0xD9, 0x36, 0xBA,
-    0xD2, 0xBE, 0x5D, 0x7D, 0x2E, 0xC9, 0x9A, 0x4B, 0x65, 0x57, 0x24, 0xB2, 0xEE, 0x75, 0xAA, 0x2E,
-    0x95, 0x6B, 0x5D, 0xAA, 0x70, 0x76, 0xA9, 0xAC, 0x77, 0x7B, 0xC0, 0x3F, 0x8B, 0xED, 0x1A, 0x97,
-    0x9B, 0x2E, 0x15, 0x4F, 0xD6, 0x6C, 0xF8, 0x67, 0xEE, 0xB8, 0x92, 0x72, 0x33, 0x75, 0x46, 0x8B,
-    0xB0, 0x8E, 0x19, 0x84, 0x3C, 0x68, 0x80, 0xBF, 0x54, 0x0D, 0xCB, 0xAF, 0x6C, 0x9F, 0x3A, 0x68,
-    0x9A, 0x87, 0x56, 0xD4, 0x59, 0x10, 0x47, 0x66, 0x01, 0xE3, 0x99, 0x72, 0x7A, 0xE0, 0x67, 0x2D,
-    0x3F, 0xA3, 0x01, 0x34, 0x62, 0x8C, 0x32, 0xF2, 0x1C, 0x9A, 0x1B, 0x36, 0x3D, 0x8C, 0x3B, 0x9C,
-    0x0A, 0x12, 0xF7, 0xCA, 0xA9, 0xDB, 0x47, 0x3C, 0x21, 0xD1, 0x2C, 0x3B, 0x84, 0x8B, 0x0E, 0x5B,
-    0x01, 0xF5, 0xF1, 0x7B, 0x05, 0xEA, 0xD7, 0xD0, 0xD4, 0x35, 0x18, 0x76, 0x1D, 0xA8, 0x1F, 0x56,
-    0xD6, 0x7A, 0xAA, 0x50, 0x6B, 0x85, 0xF8, 0x88, 0x8C, 0xC1, 0xEB, 0x44, 0x61, 0xB9, 0x65, 0xA5,
-    0x2B, 0xE3, 0x11, 0xB9, 0x13, 0x5E, 0xC5, 0x41, 0x00, 0xC7, 0x6F, 0x1A, 0xF1, 0x11, 0xC1, 0xFD,
-    0x7A, 0x0B, 0xEF, 0xE6, 0x71, 0xC8, 0xD4, 0xB3, 0x0F, 0x02, 0x0B, 0x68, 0x8F, 0x01, 0xC3, 0x5F,
-    0xE2, 0x02, 0xF5, 0x62, 0xF8, 0x7B, 0xEB, 0xD7, 0x2F, 0x16, 0x77, 0xF6, 0x96, 0x28, 0x72, 0xEE,
-    0x6C, 0xFE, 0x10, 0xB2, 0xD3, 0xBA, 0x0A, 0xBE, 0xA1, 0x08, 0x39, 0x42, 0x35, 0x7D, 0xAA, 0x34,
-    0xB2, 0xA7, 0xCC, 0x0F, 0xB9, 0xED, 0x46, 0xF0, 0x37, 0x96, 0x42, 0x7D, 0x75, 0xE2, 0x95, 0x54,
-    0xDB, 0x9E, 0xB2, 0x2B, 0x54, 0x96, 0x0C, 0x80, 0x4E, 0x07, 0x64, 0x38, 0x98, 0x33, 0xA5, 0x16,
-    0xA3, 0x6A, 0x8B, 0x1A, 0x9A, 0x97, 0x49, 0xC5, 0xCB, 0xE6, 0x6A, 0x3D, 0x8C, 0x34, 0xD0, 0xBD,
-    0x6B, 0x1C, 0x6C, 0xA0, 0xE0, 0x5C, 0xA4, 0xD8, 0xB2, 0xAE, 0x3C, 0x61, 0x0F, 0xAA, 0x04, 0xA0,
-    0x51, 0x1C, 0x77, 0xF4, 0x4D, 0x1E, 0x5D, 0x72, 0x56, 0x1E, 0x47, 0x3B, 0xE3, 0x1D, 0x0B, 0x86,
-    0xE7, 0x52, 0xE0, 0x03, 0xC4, 0xE4, 0x31, 0xFB, 0xAB, 0xF9, 0xC2, 0x95, 0x96, 0xEF, 0x2F, 0x8A,
-    0x4B, 0x41, 0x01, 0xD6, 0x61, 0xC6, 0xD7, 0x85, 0x4C, 0xA6, 0xD8, 0xF3, 0x4C, 0x96, 0x57, 0x51,
-    0x13, 0x0C, 0x74, 0x28, 0x92, 0x57, 0xE0, 0x47, 0xB8, 0xA3, 0x98, 0xD9, 0xF2, 0xE6, 0xE7, 0xC4,
-    0x8B, 0xC7, 0x92, 0x6E, 0xE3, 0x6B, 0x2D, 0x3D, 0x4B, 0x03, 0xA5, 0x94, 0xFE, 0x6D, 0x0B, 0xC4,
-    0xB3, 0x2B, 0x33, 0x31, 0x84, 0x8C, 0x8F, 0x28, 0x4B, 0x5E, 0x25, 0x5D, 0x54, 0xE5, 0x2D, 0x4D,
-    0xF9, 0x9E, 0x40, 0x04, 0xE6, 0xF4, 0xE7, 0xD3, 0x29, 0xF5, 0x52, 0x56, 0x60, 0x83, 0x4B, 0x4F,
-    0xCD, 0x53, 0x86, 0xFD, 0x93, 0xED, 0x67, 0xE7, 0xB1, 0x03, 0x77, 0x91, 0xB1, 0x01, 0x72, 0x87,
-    0xDA, 0x2F, 0x81, 0x6A, 0x8D, 0x0B, 0x80, 0x05, 0xEA, 0x0B, 0xF3, 0x69, 0xA8, 0xA2, 0x55, 0xEE,
-    0xCC, 0x0B, 0x8B, 0x22, 0x2B, 0xDF, 0xC2, 0x38, 0x24, 0xE9, 0x2D, 0xA4, 0x6E, 0x77, 0x44, 0xAA,
-    0x90, 0xBB, 0x67, 0xAD, 0xFA, 0xBC, 0x5D, 0x37, 0xD9, 0xFC, 0x5F, 0xE8, 0x6F, 0x46, 0xBB, 0xCF,
-    0x32, 0x6B, 0x68, 0xA8, 0x2F, 0x67, 0x55, 0x76, 0xA9, 0xBB, 0x21, 0xAE, 0x16, 0x61, 0x2D, 0x34,
-    0x3F, 0x2A, 0x94, 0x13, 0x35, 0x14, 0xA8, 0x5F, 0x9C, 0x61, 0x55, 0x29, 0x91, 0xDF, 0x03, 0x84,
-    0x64, 0x0E, 0x40, 0x48, 0xCD, 0xFB, 0x00, 0x21, 0x95, 0x4A, 0x85, 0x5F, 0x07, 0x21, 0x4D, 0x99,
-    0x85, 0x90, 0x2A, 0x8B, 0xBB, 0x5B, 0x98, 0xC8, 0xC6, 0x3E, 0x6C, 0xD4, 0xC2, 0x06, 0x2D, 0x2C,
-    0xBC, 0x46, 0x1F, 0xD8, 0xFA, 0x58, 0xFA, 0xE8, 0xEC, 0xD7, 0x05, 0x36, 0xFC, 0x29, 0x21, 0xAE,
-    0x28, 0x33, 0x39, 0xEF, 0x9B, 0x42, 0xD6, 0x5C, 0xA4, 0x69, 0x87, 0x51, 0x7A, 0x8A, 0xFD, 0x4F,
-    0x3C, 0x69, 0x4A, 0x70, 0x3E, 0xAE, 0x2C, 0x90, 0xB1, 0xFA, 0xDA, 0xF0, 0x6B, 0x05, 0xC1, 0x43,
-    0x02, 0xFA, 0x8E, 0x79, 0xF5, 0x89, 0x89, 0xA0, 0x86, 0x50, 0xD0, 0x55, 0x70, 0xE8, 0xE8, 0x73,
-    0x5F, 0x6C, 0x57, 0x72, 0xC9, 0x06, 0x5B, 0x94, 0xE7, 0xE2, 0x6A, 0x25, 0xD8, 0xD6, 0xBF, 0x76,
-    0xCB, 0xFF, 0xAD, 0xE0, 0x52, 0x36, 0xC7, 0xA3, 0x64, 0xFB, 0xEB, 0xFF, 0xC2, 0x1B, 0x83, 0x78,
-    0x63, 0x31, 0x0D, 0x5C, 0xE1, 0xC7, 0x96, 0x0E, 0x54, 0x49, 0xB7, 0xD5, 0x6A, 0xAC, 0x49, 0x97,
-    0x9F, 0x2F, 0x56, 0x1F, 0xB9, 0xC3, 0xAC, 0xEB, 0x35, 0x14, 0x61, 0x5F, 0x7C, 0x35, 0xEF, 0xFD,
-    0x7E, 0xD6, 0x72, 0x7E, 0xA7, 0x24, 0xE3, 0x8B, 0xD5, 0x61, 0x8A, 0xDD, 0xD8, 0x17, 0xAB, 0xA1,
-    0xA2, 0x66, 0xA6, 0x9D, 0xBC, 0x58, 0x65, 0xA6, 0xD1, 0x1D, 0xFC, 0xC9, 0xFF, 0x96, 0x0F, 0x88,
-    0xF8, 0x38, 0xF6, 0x85, 0x2C, 0xC3, 0x97, 0x52, 0xA9, 0x54, 0x2E, 0x0A, 0xB0, 0x5C, 0x34, 0xE4,
-    0x64, 0xD5, 0x9B, 0x90, 0x7B, 0x7B, 0x87, 0x16, 0xBD, 0x3E, 0x3A, 0xEE, 0x5D, 0x06, 0x37, 0x3E,
-    0x22, 0xAB, 0xE1, 0xBC, 0xDB, 0xD5, 0x30, 0x17, 0x96, 0xD5, 0x18, 0x96, 0xD5, 0x58, 0x00, 0x72,
-    0x7F, 0x89, 0x00, 0xDA, 0x30, 0xDE, 0xA2, 0x73, 0x16, 0x79, 0xBD, 0xB1, 0x1D, 0xE4, 0xDD, 0xE2,
-    0x58, 0x86, 0xC5, 0xFC, 0xEE, 0xA8, 0x6A, 0x41, 0xAA, 0xFD, 0x91, 0x16, 0x84, 0x4C, 0xEA, 0xCA,
-    0x4E, 0x4B, 0xAF, 0x42, 0x76, 0x68, 0x4B, 0x54, 0x93, 0xD0, 0xFF, 0x83, 0xD4, 0x08, 0xC7, 0x36,
-    0x22, 0x9B, 0x8A, 0x5E, 0x9F, 0x26, 0xCA, 0x00, 0xDF, 0x9C, 0xF1, 0x6E, 0x27, 0xFD, 0xCE, 0x16,
-    0x0D, 0x66, 0x51, 0x24, 0x1A, 0xDC, 0x4A, 0x61, 0x5C, 0xE0, 0x87, 0x25, 0xC4, 0x8D, 0x4A, 0x32,
-    0xF9, 0x18, 0x61, 0xC1, 0x4C, 0x23, 0x63, 0x80, 0x0F, 0xC5, 0x3C, 0xB8, 0xB2, 0xA3, 0xF0, 0x0B,
-    0x2C, 0xE6, 0x0D, 0x74, 0x6F, 0x15, 0xC8, 0x76, 0x16, 0x63, 0x7A, 0xB1, 0xA6, 0x17, 0x59, 0xB6,
-    0x88, 0xA9, 0x95, 0x38, 0x53, 0x49, 0xD5, 0x39, 0x2B, 0x21, 0xB4, 0x08, 0xAB, 0x95, 0xF5, 0xAD,
-    0x47, 0xBF, 0x31, 0x1F, 0x8D, 0xF3, 0xF2, 0x68, 0x88, 0x1C, 0xB5, 0xC0, 0xCF, 0x94, 0xAD, 0x3D,
-    0x5A, 0x2C, 0x4E, 0x2B, 0xDD, 0xD2, 0xCA, 0x72, 0x46, 0xD8, 0xDA, 0x73, 0x7B, 0x0A, 0x14, 0x70,
-    0xA2, 0xD6, 0xBC, 0x4E, 0x2B, 0x6B, 0x5F, 0x47, 0xCD, 0xCC, 0x47, 0xAD, 0xAF, 0x16, 0x76, 0xDC,
-    0xA9, 0xA4, 0xDB, 0x2E, 0x3B, 0x57, 0x03, 0xE8, 0xA6, 0xB1, 0x46, 0xF6, 0x74, 0x10, 0x07, 0xE0,
-    0x12, 0x30, 0x7A, 0x4D, 0x9F, 0xD6, 0x59, 0xC5, 0x37, 0x67, 0xAB, 0x6C, 0x5C, 0x44, 0xA2, 0xC5,
-    0x11, 0xAB, 0x85, 0x49, 0xD2, 0xBF, 0x5E, 0x30, 0xE2, 0x12, 0x04, 0x56, 0x88, 0x58, 0xF4, 0xD7,
-    0xA8, 0x03, 0x53, 0xDC, 0x95, 0x34, 0xF1, 0x09, 0x3E, 0x13, 0x1F, 0x96, 0x45, 0x93, 0xF1, 0x11,
-    0x1E, 0x96, 0x55, 0x89, 0x5B, 0xA2, 0xC3, 0x01, 0xED, 0xE5, 0x0D, 0x70, 0xF8, 0x2B, 0xFF, 0xC8,
-    0x91, 0x4D, 0x44, 0xAB, 0xC4, 0x8F, 0xDD, 0x3F, 0x23, 0xA3, 0xDC, 0x43, 0xE0, 0x47, 0x0C, 0x12,
-    0x31, 0xD6, 0x07, 0xA2, 0x52, 0x19, 0x88, 0x74, 0xFF, 0x3C, 0x58, 0xB3, 0x32, 0x99, 0xE4, 0xED,
-    0xF6, 0xB6, 0x30, 0x5C, 0x32, 0xE7, 0x52, 0x34, 0x4B, 0xA0, 0x60, 0x6D, 0x0A, 0xD4, 0x84, 0x71,
-    0xF3, 0x00, 0xFD, 0x08, 0x28, 0x96, 0x0C, 0xB0, 0x5D, 0x23, 0x52, 0x58, 0x6C, 0xD6, 0xFC, 0x5A,
-    0xA9, 0x3F, 0xC5, 0x2C, 0xE1, 0x92, 0xB9, 0xA7, 0x97, 0x35, 0x43, 0x2A, 0x06, 0xD7, 0x0D, 0x10,
-    0x01, 0xD7, 0x4E, 0x11, 0x68, 0x59, 0xBF, 0x68, 0xFA, 0x33, 0xC5, 0x19, 0x7C, 0x70, 0x3E, 0x87,
-    0x26, 0x92, 0x04, 0xD6, 0x0F, 0xD7, 0x05, 0x0E, 0x45, 0x5C, 0x5B, 0x21, 0xE1, 0x29, 0xF4, 0x93,
-    0xCC, 0x54, 0x97, 0x95, 0xF1, 0x7B, 0x8A, 0x17, 0x2A, 0x8C, 0x44, 0x43, 0x44, 0x0A, 0x71, 0x83,
-    0xEF, 0x4A, 0xCA, 0x72, 0x39, 0x2A, 0xBA, 0xB6, 0x63, 0x71, 0xB0, 0x69, 0x4E, 0x68, 0x88, 0x15,
-    0xA1, 0x13, 0x56, 0x1A, 0xF8, 0x91, 0xB0, 0x43, 0x52, 0xD1, 0x39, 0x2A, 0x19, 0x1B, 0xD6, 0x34,
-    0x0C, 0x05, 0x0F, 0xE4, 0x10, 0x39, 0x38, 0x6D, 0xAC, 0x9C, 0x40, 0x34, 0x4D, 0xC6, 0x00, 0x03,
-    0x7E, 0x84, 0xA3, 0x05, 0xB7, 0x20, 0x9F, 0x76, 0xC6, 0x39, 0xC5, 0x83, 0x7E, 0x75, 0x0F, 0x07,
-    0x7B, 0x36, 0xC4, 0x4E, 0x2F, 0xB0, 0xCF, 0x29, 0xE8, 0x19, 0x6A, 0xA8, 0x94, 0x07, 0x06, 0xE6,
-    0x7B, 0x40, 0x14, 0x53, 0x02, 0xCC, 0xBE, 0xAA, 0x3A, 0xA8, 0xB7, 0xC2, 0x51, 0xBF, 0x80, 0x12,
-    0x51, 0xC3, 0x61, 0xB1, 0x4A, 0x36, 0x75, 0x85, 0x48, 0x10, 0xB1, 0x23, 0x6A, 0x2E, 0xAC, 0xCD,
-    0x36, 0x18, 0x56, 0x08, 0x54, 0x54, 0x71, 0x4B, 0xED, 0xD9, 0x64, 0x0D, 0xCA, 0xA4, 0x34, 0x8B,
-    0xE9, 0x02, 0x12, 0x08, 0x4D, 0x2A, 0xC2, 0x6A, 0xE3, 0x0C, 0xC9, 0xE5, 0x84, 0x0F, 0xC4, 0x7C,
-    0xF1, 0x09, 0x2F, 0x57, 0xC1, 0x48, 0x7F, 0x73, 0x86, 0x1C, 0x65, 0x44, 0xC7, 0x65, 0x48, 0x53,
-    0xCA, 0xCB, 0x15, 0x48, 0x2A, 0xA9, 0x1D, 0xBA, 0x7C, 0x25, 0x2C, 0xDF, 0x9C, 0x40, 0x4E, 0x01,
-    0x80, 0x03, 0x88, 0x04, 0xB6, 0x63, 0xA3, 0xB2, 0x9C, 0x91, 0x88, 0x14, 0x04, 0x96, 0x8B, 0x1B,
-    0x64, 0x5C, 0xFD, 0x4D, 0xF3, 0xCF, 0x46, 0x67, 0xB7, 0x7B, 0x20, 0xAF, 0x86, 0x73, 0xA9, 0x18,
-    0x42, 0xB1, 0xF1, 0xCC, 0x28, 0x56, 0x6F, 0x4A, 0x47, 0xF5, 0x94, 0x73, 0xCF, 0x3A, 0x50, 0xF6,
-    0xC9, 0x45, 0xC2, 0x95, 0x8C, 0x63, 0x1A, 0xC0, 0x60, 0xCC, 0xF4, 0xB9, 0x96, 0x69, 0x98, 0xD5,
-    0x21, 0xF2, 0xA6, 0x76, 0x47, 0xBA, 0x92, 0xB5, 0xC3, 0x51, 0x91, 0x5C, 0xC9, 0x17, 0x65, 0x31,
-    0xFC, 0x77, 0x18, 0xF0, 0x41, 0x72, 0x5C, 0x34, 0x01, 0x02, 0xC5, 0xF0, 0x31, 0xF2, 0xB0, 0x05,
-    0x87, 0x97, 0x1A, 0x4A, 0xF7, 0x19, 0x49, 0xC1, 0x9E, 0x43, 0x46, 0x86, 0x4B, 0xE0, 0x3F, 0xC5,
-    0x1A, 0x05, 0x9D, 0x1A, 0x25, 0xF2, 0x91, 0xF0, 0x62, 0xB4, 0x0F, 0x6B, 0x91, 0x21, 0x52, 0x57,
-    0x7D, 0x5A, 0x45, 0x57, 0xEE, 0xE3, 0xB6, 0x16, 0xEA, 0xEF, 0xF4, 0xDC, 0xAF, 0x03, 0x4D, 0xFC,
-    0xA8, 0xD9, 0x93, 0xC5, 0x4F, 0xE5, 0x1C, 0x71, 0x15, 0x77, 0xD1, 0x75, 0x33, 0x52, 0xB8, 0xCB,
-    0x22, 0x03, 0x47, 0xC9, 0x9F, 0x94, 0xF3, 0xBD, 0xDC, 0x3A, 0xC1, 0xDB, 0xC2, 0xC7, 0x1D, 0x58,
-    0x2D, 0xDC, 0xBF, 0x6F, 0x70, 0xC0, 0xBE, 0x21, 0x88, 0x78, 0x82, 0xD1, 0xD7, 0x7D, 0xC2, 0xDE,
-    0xA2, 0x83, 0xFC, 0xCE, 0x1F, 0xFE, 0x40, 0x4E, 0x75, 0x8C, 0xEB, 0xA1, 0xA9, 0x0A, 0x30, 0x61,
-    0x85, 0x78, 0x51, 0x4F, 0x90, 0x10, 0xEE, 0xFC, 0x44, 0xF1, 0xF6, 0x31, 0x99, 0xD3, 0x0B, 0xE2,
-    0xA1, 0xFE, 0xD8, 0xFC, 0xDC, 0xF8, 0x0C, 0x18, 0xF4, 0x96, 0x0B, 0x8F, 0xD3, 0xD2, 0xAD, 0xD4,
-    0xB9, 0x4C, 0xBF, 0x23, 0xCE, 0xCC, 0x33, 0xBA, 0xC5, 0xE9, 0x46, 0x4D, 0xB3, 0xE4, 0x22, 0xC3,
-    0xC8, 0x75, 0xDC, 0xD3, 0xB2, 0x0E, 0xE5, 0x44, 0x60, 0xAF, 0xF3, 0x26, 0xA1, 0x3A, 0xA3, 0x55,
-    0x50, 0xE7, 0x51, 0xC3, 0xB9, 0x39, 0xC9, 0x0F, 0x11, 0xDC, 0x41, 0xC0, 0xA8, 0x43, 0xBC, 0xE8,
-    0x45, 0x84, 0x71, 0xE1, 0x19, 0x75, 0x08, 0x2A, 0x55, 0x72, 0xDA, 0x11, 0x49, 0x29, 0xAD, 0x8F,
-    0xCD, 0x1B, 0x4E, 0x5B, 0x2D, 0x31, 0x0C, 0x8D, 0x7C, 0xDB, 0xC5, 0xDB, 0x02, 0x2C, 0x2D, 0x5B,
-    0xF2, 0xE7, 0xA3, 0x73, 0xDE, 0x99, 0x84, 0x94, 0x7B, 0xC2, 0xF2, 0x13, 0x62, 0x31, 0xA2, 0xF4,
-    0xBA, 0xA4, 0x48, 0xEB, 0xF4, 0xCF, 0x84, 0x3F, 0x4A, 0xE1, 0x33, 0xA1, 0x7F, 0x7E, 0x41, 0x75,
-    0x86, 0xFC, 0x1D, 0x93, 0xB3, 0x3F, 0x9F, 0x0A, 0xBB, 0x89, 0x38, 0xA9, 0x71, 0x5A, 0x1F, 0xE2,
-    0x15, 0x53, 0x3C, 0x7A, 0x19, 0x29, 0x0F, 0x7F, 0x21, 0xDC, 0x5C, 0x7B, 0xA2, 0xFA, 0x10, 0xAE,
-    0x02, 0x73, 0x9A, 0x3A, 0x7D, 0xA2, 0x0B, 0x1A, 0x7F, 0xFF, 0x92, 0x5F, 0x25, 0xD9, 0x08, 0xB1,
-    0xF8, 0xA7, 0x6E, 0x9F, 0x56, 0x89, 0xBA, 0x54, 0x83, 0xFA, 0x63, 0xFD, 0x5B, 0x4F, 0xA9, 0x57,
-    0x78, 0xAE, 0xA3, 0xC9, 0xE8, 0x5E, 0xDF, 0x52, 0x31, 0x99, 0xBC, 0xFE, 0x0B, 0xF5, 0x22, 0x87,
-    0xF4, 0x7F, 0xA9, 0x77, 0xE0, 0x4F, 0x27, 0x95, 0xE7, 0xF2, 0x97, 0xC8, 0x86, 0x5D, 0xD8, 0x9E,
-    0xB4, 0x51, 0x06, 0xBF, 0x75, 0x9B, 0xCF, 0xC4, 0x15, 0x42, 0xF8, 0xBB, 0xA1, 0x69, 0x5D, 0x71,
-    0x83, 0x4D, 0x01, 0x98, 0x14, 0xC3, 0x08, 0x44, 0xF0, 0x37, 0x20, 0xDD, 0x11, 0xC2, 0xF9, 0xC4,
-    0x1B, 0xF7, 0x44, 0xAC, 0xD0, 0x67, 0x18, 0x44, 0xAA, 0x4D, 0xBE, 0x08, 0x2B, 0x4F, 0x29, 0x32,
-    0xA8, 0x00, 0xDE, 0xAA, 0x2D, 0x3A, 0xD7, 0xAC, 0x63, 0xC4, 0x9F, 0x94, 0xBF, 0xB3, 0xF2, 0x3D,
-    0xC2, 0x80, 0x46, 0xE8, 0x29, 0x9C, 0x92, 0xD1, 0x20, 0x93, 0x65, 0x70, 0xB7, 0x85, 0x8B, 0x00,
-    0x13, 0x47, 0x6D, 0x2A, 0xBF, 0x9C, 0xE8, 0xB6, 0x89, 0x92, 0xB7, 0x46, 0x75, 0x52, 0xE8, 0x47,
-    0x10, 0x74, 0xE0, 0x6F, 0x4D, 0x2E, 0xD9, 0x5B, 0x3E, 0xF2, 0xF8, 0x51, 0x8A, 0x8F, 0x22, 0x58,
-    0x07, 0xDE, 0x5B, 0x85, 0xAC, 0xD9, 0x6E, 0xFF, 0x40, 0xD4, 0x24, 0xF1, 0xB7, 0x2A, 0x63, 0xFE,
-    0xCE, 0x74, 0xA1, 0x58, 0x80, 0xA3, 0xA3, 0x7B, 0xF7, 0xF8, 0x4A, 0x5C, 0xD8, 0x9D, 0x71, 0xDC,
-    0xF9, 0x03, 0x44, 0x92, 0x5D, 0x22, 0xCA, 0x67, 0x21, 0xBA, 0xE1, 0xFE, 0x9A, 0xB7, 0x88, 0x9B,
-    0x41, 0xFE, 0x1E, 0xF9, 0xF6, 0x06, 0x2E, 0x7E, 0xEF, 0x33, 0x8E, 0x7B, 0x2A, 0x91, 0xA1, 0x0A,
-    0xD7, 0x76, 0x9A, 0x03, 0x20, 0xDB, 0x49, 0xC7, 0x45, 0x41, 0xA3, 0x69, 0x01, 0x23, 0x64, 0x62,
-    0x5C, 0xD9, 0x89, 0xAC, 0x3E, 0x4A, 0xF0, 0x91, 0xCF, 0x8F, 0x88, 0x23, 0x7E, 0xAE, 0xBF, 0x27,
-    0xAA, 0xC3, 0xD7, 0xBE, 0x51, 0x4D, 0xDE, 0xDB, 0xFD, 0x40, 0x59, 0x93, 0x95, 0xA2, 0xB5, 0x6A,
-    0xDF, 0x40, 0x9D, 0x8A, 0xA3, 0x7C, 0xCC, 0x71, 0x9F, 0x73, 0xBC, 0xCB, 0xA9, 0x08, 0x84, 0x21,
-    0x97, 0x6D, 0x36, 0x38, 0xE7, 0x5D, 0xD9, 0x2B, 0xBB, 0xE0, 0xFF, 0x01, 0xBE, 0xFC, 0x00, 0x99,
-    0xD2, 0x5F, 0x92, 0xB5, 0xBC, 0x8A, 0xE4, 0xBB, 0x77, 0x5A, 0x0B, 0x98, 0xFA, 0x23, 0x32, 0x6E,
-    0x3B, 0xA0, 0x4E, 0xB2, 0xC9, 0x65, 0x71, 0x52, 0xE7, 0x98, 0x90, 0xBA, 0xFA, 0xBA, 0xEC, 0xF4,
-    0x9F, 0xB6, 0x42, 0x76, 0xD3, 0x00, 0xC4, 0x14, 0xE2, 0x2B, 0x40, 0x72, 0x8C, 0x86, 0x1E, 0xFC,
-    0x6D, 0x0A, 0x31, 0xA1, 0x34, 0xFD, 0x2E, 0xC8, 0x7B, 0x95, 0xD5, 0xE7, 0x28, 0xED, 0x29, 0xA9,
-    0x23, 0xAA, 0xB2, 0x4B, 0x90, 0xD3, 0x3E, 0xED, 0x94, 0xA8, 0xC0, 0x50, 0x76, 0xC1, 0xF2, 0x7E,
-    0x4B, 0xA0, 0x81, 0x92, 0xFF, 0x92, 0x93, 0x3E, 0x22, 0x1F, 0xB8, 0xC3, 0x1F, 0x3D, 0x9C, 0x67,
-    0xC1, 0x2F, 0x3A, 0x62, 0xF0, 0x4F, 0xCB, 0xCC, 0xCB, 0x3E, 0x42, 0x4A, 0x5F, 0x26, 0xCC, 0xE5,
-    0x40, 0x03, 0x7E, 0x5F, 0x2E, 0xFD, 0xFF, 0xB8, 0xED, 0x03, 0xB8, 0xD2, 0x3D, 0x33, 0x80, 0x7C,
-    0x6C, 0x17, 0xD9, 0xE1, 0xEF, 0x34, 0xF2, 0xBF, 0xE3, 0x9C, 0x1D, 0x9C, 0x7D, 0xB9, 0xD4, 0xE7,
-    0x52, 0xE7, 0xAC, 0xCC, 0x36, 0xFA, 0x62, 0xF5, 0xB0, 0xCC, 0xDC, 0xFF, 0x71, 0x97, 0xE0, 0xD2,
-    0xED, 0xB9, 0x08, 0xC6, 0xEC, 0xD9, 0xF8, 0x9B, 0x4F, 0xE1, 0x18, 0xFF, 0x67, 0x15, 0x8E, 0xC9,
-    0xF6, 0x1B, 0x1C, 0x53, 0xA5, 0xAD, 0x1C, 0xE3, 0xB5, 0x51, 0xEF, 0xB7, 0xC7, 0x1C, 0x91, 0x52,
-    0xCE, 0xF0, 0xE0, 0xD7, 0x01, 0xF5, 0xE6, 0x49, 0x32, 0x21, 0xB1, 0xCD, 0x3C, 0x6E, 0x64, 0x0A,
-    0x81, 0xE8, 0x0C, 0x2C, 0xB9, 0x51, 0x09, 0x7F, 0x8F, 0xB2, 0xE7, 0x71, 0x1F, 0xC9, 0x80, 0xB5,
-    0x10, 0xC0, 0x21, 0xA1, 0x23, 0x70, 0x9B, 0x3B, 0xD8, 0x90, 0xF9, 0x48, 0xA4, 0x0C, 0x81, 0x53,
-    0xCB, 0x9E, 0x86, 0x9B, 0x9C, 0xA1, 0xFB, 0x33, 0x67, 0xE6, 0x1F, 0x30, 0xAD, 0x33, 0xC4, 0x0F,
-    0x32, 0xFC, 0xE0, 0x21, 0xFC, 0xE0, 0xC9, 0x17, 0xC5, 0xA9, 0x30, 0x2D, 0xB2, 0xDB, 0x10, 0x40,
-    0x52, 0x68, 0xE4, 0x08, 0xA5, 0x0D, 0x4D, 0x64, 0x22, 0x51, 0xB2, 0x5E, 0x4D, 0xD4, 0xB9, 0xD8,
-    0x3A, 0x60, 0xAC, 0x0A, 0x61, 0x01, 0x1F, 0xB6, 0x31, 0xDD, 0x4B, 0xF8, 0x94, 0x2F, 0x21, 0x03,
-    0x20, 0x46, 0xF6, 0x55, 0x8E, 0x54, 0x13, 0x48, 0x3A, 0x51, 0x08, 0x21, 0x0E, 0xCF, 0x8B, 0xB4,
-    0x42, 0x4E, 0xE9, 0x3F, 0xC8, 0x22, 0xD2, 0xE4, 0x28, 0x27, 0x7B, 0x09, 0x61, 0x29, 0x51, 0x7F,
-    0xA6, 0x0D, 0x4D, 0x91, 0x1B, 0x48, 0xB6, 0xA0, 0x99, 0x44, 0x77, 0xEC, 0xA5, 0x98, 0xD7, 0x6B,
-    0x15, 0xCC, 0x10, 0x50, 0x11, 0xFB, 0xA6, 0x70, 0xC5, 0xCC, 0xEE, 0x00, 0x98, 0xE6, 0xB0, 0x80,
-    0xC0, 0xCB, 0x95, 0xC2, 0x81, 0xF3, 0xBC, 0xB0, 0x10, 0xD8, 0x76, 0x7E, 0xF7, 0x50, 0x7C, 0xAB,
-    0x79, 0xC9, 0x45, 0xF1, 0xA1, 0x01, 0x16, 0x94, 0x4F, 0x20, 0xB2, 0x73, 0x3E, 0xF9, 0xAE, 0x0C,
-    0x78, 0x77, 0x17, 0x82, 0x62, 0xEC, 0x68, 0x60, 0xD2, 0xCE, 0x30, 0xC0, 0x72, 0x5C, 0x7A, 0xD4,
-    0xDE, 0xB8, 0xF2, 0xC3, 0x54, 0x61, 0x6B, 0x5C, 0x3A, 0xA0, 0xAB, 0x15, 0x6A, 0xDE, 0x02, 0xB3,
-    0x0A, 0xA2, 0x06, 0x8C, 0x1C, 0x4F, 0x4F, 0x68, 0xFE, 0x80, 0x70, 0x43, 0xBA, 0x05, 0x46, 0x4E,
-    0x09, 0xEA, 0xA6, 0x6B, 0x39, 0x55, 0x7B, 0x6B, 0xE9, 0x24, 0x9A, 0x59, 0x69, 0x9E, 0x65, 0x18,
-    0x75, 0x24, 0xBC, 0xF3, 0x7D, 0x95, 0xF9, 0xB0, 0xB5, 0x69, 0x69, 0x24, 0xAF, 0xEE, 0xC9, 0x70,
-    0x8E, 0x45, 0x4C, 0xEC, 0xA5, 0xB1, 0x63, 0xB1, 0x5B, 0x70, 0x3E, 0x4D, 0xC0, 0x8C, 0xF6, 0x3F,
-    0x4C, 0x61, 0xD1, 0x70, 0x67, 0xD3, 0x3A, 0x6C, 0x4A, 0x31, 0x4D, 0x98, 0xB3, 0xD4, 0xAB, 0x9C,
-    0x93, 0x05, 0xBF, 0x20, 0xD2, 0x5E, 0xB8, 0xA8, 0x6C, 0x3D, 0x53, 0x61, 0xD5, 0x3B, 0x39, 0xBD,
-    0x73, 0x3E, 0x7A, 0xB3, 0xCB, 0x77, 0x1A, 0x59, 0x7A, 0xAF, 0x83, 0xC2, 0x1A, 0x07, 0xFF, 0x1D,
-    0x44, 0xC5, 0xA6, 0xD6, 0xBF, 0x2E, 0x92, 0xD9, 0x81, 0x24, 0x10, 0x41, 0xE2, 0x32, 0xB9, 0x31,
-    0x29, 0x44, 0x9D, 0x86, 0xD0, 0xFC, 0x3E, 0x73, 0xC5, 0x99, 0x75, 0x02, 0x42, 0xE3, 0xD2, 0x31,
-    0xF8, 0x32, 0x6C, 0x95, 0x29, 0x55, 0x0A, 0x0D, 0xF7, 0x58, 0xC1, 0xF9, 0xA0, 0x15, 0x45, 0x23,
-    0x0F, 0x12, 0x5D, 0x4B, 0xC1, 0xEA, 0x99, 0x06, 0x07, 0x69, 0xF2, 0x95, 0x15, 0x01, 0xEE, 0xB3,
-    0x48, 0xA5, 0x4A, 0x46, 0x98, 0xE4, 0x32, 0x58, 0x39, 0xBF, 0x5B, 0x66, 0x0A, 0x6C, 0x30, 0xC8,
-    0x51, 0xE1, 0x39, 0x66, 0xCE, 0x93, 0x88, 0x5B, 0x46, 0x2C, 0xB1, 0x20, 0xC2, 0x4D, 0x8C, 0x85,
-    0xC2, 0x79, 0xF4, 0x11, 0xDF, 0x45, 0xD6, 0x0C, 0xE1, 0xB3, 0x93, 0x7C, 0xBE, 0xC4, 0x67, 0xA2,
-    0x7C, 0xBF, 0x64, 0xBC, 0xE9, 0x9D, 0x6A, 0x49, 0xF3, 0xF3, 0xD7, 0xF0, 0x59, 0x9B, 0x53, 0x51,
-    0x2D, 0xB6, 0x12, 0x75, 0xFD, 0xC9, 0x1D, 0x5A, 0x87, 0x84, 0xBF, 0x52, 0x92, 0x2D, 0xB9, 0xB0,
-    0x19, 0xAE, 0x64, 0x91, 0x84, 0xCB, 0xC8, 0x5B, 0x70, 0x75, 0x8F, 0xA7, 0x78, 0x60, 0xC9, 0xA8,
-    0x5A, 0x27, 0xFD, 0xEE, 0x8A, 0xF4, 0x47, 0x26, 0xB5, 0x75, 0x27, 0xCD, 0xB2, 0x10, 0x1E, 0x7A,
-    0xA3, 0x4F, 0x5A, 0x6F, 0xF2, 0xFA, 0x60, 0x08, 0x3A, 0x4F, 0xDC, 0x2E, 0xCE, 0x6D, 0x42, 0x08,
-    0xC9, 0x99, 0xC4, 0xFA, 0x11, 0x7F, 0x25, 0xCD, 0x84, 0xEF, 0xA6, 0x1C, 0x8E, 0xF3, 0x98, 0xC3,
-    0x90, 0x13, 0x33, 0x49, 0xD6, 0x01, 0xCF, 0x15, 0xAC, 0x0B, 0xF8, 0xC0, 0x62, 0xFA, 0x57, 0x89,
-    0x58, 0x53, 0xF1, 0x53, 0x40, 0xE0, 0x77, 0xDE, 0x1A, 0x66, 0xC8, 0xE7, 0x3E, 0x75, 0x87, 0x52,
-    0xE7, 0xF0, 0x41, 0x61, 0xA6, 0x0F, 0x7A, 0x9C, 0xE9, 0x5B, 0x35, 0xE7, 0xCB, 0x84, 0x0F, 0x75,
-    0xE0, 0x8F, 0x16, 0xCE, 0xD1, 0x06, 0x09, 0xDE, 0x62, 0x20, 0x88, 0xCB, 0x64, 0xB2, 0xE7, 0x8C,
-    0x63, 0xFE, 0x1D, 0xE4, 0x73, 0x03, 0xDD, 0x8B, 0x55, 0x0E, 0x7F, 0xD9, 0xCE, 0x99, 0xE0, 0x16,
-    0x40, 0x24, 0xFC, 0xAD, 0x9E, 0x78, 0xC4, 0xE5, 0x2D, 0x19, 0xB7, 0x43, 0x2A, 0x9F, 0x73, 0x92,
-    0xA6, 0x76, 0x2B, 0x82, 0xFD, 0xFE, 0x34, 0x2B, 0xDD, 0xCC, 0xF4, 0x32, 0x4A, 0x1F, 0x2E, 0x75,
-    0x17, 0x89, 0x4D, 0x39, 0x62, 0xCB, 0xBA, 0xEF, 0x83, 0x82, 0x7E, 0xAA, 0x80, 0x6D, 0x7D, 0x16,
-    0x0A, 0xFA, 0xBF, 0x15, 0xB3, 0x82, 0x8E, 0x0D, 0x14, 0x74, 0xDF, 0x62, 0xAB, 0xC4, 0x8E, 0x86,
-    0x1A, 0x67, 0xF2, 0xE9, 0x5B, 0x2E, 0x17, 0xB3, 0xBF, 0x67, 0x1C, 0x43, 0xB6, 0x94, 0x73, 0x3A,
-    0x82, 0x2E, 0x61, 0x92, 0x45, 0xE6, 0x51, 0x0E, 0x53, 0xE2, 0xA6, 0xCE, 0xFA, 0x3F, 0x20, 0x99,
-    0x19, 0xD9, 0xC8, 0x69, 0xD9, 0xC1, 0xEF, 0x19, 0x47, 0x18, 0xC4, 0xE9, 0x62, 0xBA, 0x87, 0xA2,
-    0x16, 0x20, 0x97, 0xC1, 0x1A, 0xF4, 0xDF, 0xCD, 0xBC, 0x92, 0xCA, 0x9C, 0xD6, 0x52, 0x39, 0xED,
-    0x1C, 0xF9, 0x82, 0x81, 0xB5, 0xED, 0xF7, 0xB2, 0x18, 0x32, 0x90, 0x9C, 0x4F, 0xCC, 0x46, 0xC6,
-    0x53, 0x89, 0xA7, 0x09, 0x9B, 0x6F, 0x62, 0x7E, 0x00, 0x9E, 0x06, 0xEC, 0x16, 0x79, 0x2A, 0x64,
-    0x48, 0x09, 0x24, 0x29, 0xC2, 0xDF, 0x32, 0xC2, 0x60, 0xF5, 0x1B, 0x1C, 0x1E, 0xE3, 0x87, 0x69,
-    0xED, 0xE3, 0x87, 0xB2, 0xC3, 0xFF, 0x46, 0x7E, 0xED, 0x9A, 0xEA, 0xD3, 0xE7, 0xA2, 0xA8, 0xBE,
-    0x34, 0x86, 0x3F, 0x7A, 0xA5, 0x31, 0xA2, 0xA3, 0xDA, 0x52, 0x4C, 0x84, 0xBA, 0x14, 0x5F, 0x44,
-    0x0C, 0x33, 0x9F, 0x0E, 0xF8, 0x29, 0xD0, 0x29, 0x9B, 0x47, 0x97, 0x95, 0xDC, 0xFA, 0x13, 0x6C,
-    0x13, 0x61, 0x55, 0x10, 0xC1, 0x1D, 0xD4, 0xE8, 0xE0, 0xA5, 0x98, 0x65, 0xAC, 0xE1, 0x1E, 0x0E,
-    0x8E, 0x99, 0x38, 0xB9, 0x33, 0x8F, 0x2F, 0xBC, 0xE1, 0xE3, 0xA4, 0x52, 0xFB, 0x85, 0x03, 0x14,
-    0x0F, 0xBF, 0x83, 0x6F, 0x22, 0xEE, 0x43, 0x15, 0xEE, 0x7E, 0xDC, 0xEF, 0x64, 0x1C, 0xFF, 0x5E,
-    0x48, 0xC9, 0x11, 0xFE, 0xA4, 0x49, 0xCD, 0x2B, 0x66, 0x48, 0x84, 0x2D, 0x47, 0x31, 0x9D, 0xF3,
-    0x4B, 0x22, 0xB2, 0x84, 0xE4, 0x62, 0x93, 0x70, 0x88, 0x33, 0xAA, 0x94, 0xDA, 0x0D, 0x3B, 0x6C,
-    0xE6, 0xF2, 0x29, 0x44, 0x34, 0x63, 0xFF, 0x4E, 0xBC, 0x20, 0x4F, 0xDE, 0x73, 0x67, 0x9E, 0x20,
-    0x30, 0x8F, 0x1C, 0x17, 0x31, 0x7E, 0x93, 0xEC, 0x12, 0x80, 0xA6, 0x5A, 0x36, 0xE0, 0x49, 0xBA,
-    0x54, 0xE0, 0xFC, 0xE8, 0x2D, 0x26, 0x7E, 0xF7, 0x4E, 0xFA, 0x9F, 0xF2, 0x9A, 0x29, 0xE6, 0x18,
-    0x34, 0x15, 0x35, 0x98, 0x4E, 0xDE, 0x0C, 0xF4, 0xFE, 0xA2, 0x2E, 0x6E, 0x99, 0x0C, 0xA0, 0x9E,
-    0xD1, 0x69, 0x35, 0x3C, 0x9C, 0x23, 0x2E, 0xFD, 0xF1, 0x3D, 0xFA, 0x34, 0xA4, 0x10, 0x45, 0x10,
-    0x83, 0xF2, 0x73, 0x99, 0x03, 0xFC, 0x5D, 0x59, 0xB5, 0x41, 0xCC, 0x03, 0x59, 0x9D, 0xEB, 0x72,
-    0x24, 0x73, 0xF1, 0x1A, 0xF9, 0xBA, 0xBC, 0x90, 0x57, 0x96, 0xB2, 0x23, 0x7E, 0x37, 0x91, 0xBE,
-    0xF0, 0x2E, 0xA0, 0x1C, 0xAB, 0x12, 0x99, 0x3F, 0xB9, 0x07, 0xA5, 0xEF, 0x77, 0xD1, 0x4F, 0x44,
-    0x3C, 0x94, 0x45, 0xCA, 0xC4, 0x6D, 0x87, 0x8A, 0x90, 0x51, 0xDE, 0x23, 0x0C, 0x8A, 0x1C, 0x91,
-    0xD1, 0xE4, 0x48, 0x6E, 0x1A, 0xED, 0x0A, 0x69, 0x7E, 0x91, 0x02, 0x8F, 0xED, 0x09, 0x27, 0xB8,
-    0xCE, 0xB8, 0x5E, 0x1F, 0x75, 0xC1, 0x88, 0x0B, 0x61, 0x86, 0xB2, 0x54, 0x7B, 0x88, 0x78, 0xC8,
-    0xDF, 0x20, 0x92, 0xAA, 0x8F, 0x9A, 0x18, 0xC7, 0x14, 0x8C, 0xA6, 0x9C, 0xB0, 0x56, 0x7B, 0x68,
-    0x90, 0xAC, 0x63, 0xAA, 0xF0, 0x72, 0x38, 0xF8, 0x70, 0x8F, 0x98, 0xF4, 0xA7, 0x5B, 0x49, 0x2B,
-    0x35, 0x2C, 0xEE, 0xDF, 0x39, 0x27, 0x1E, 0x19, 0x2C, 0xE4, 0x95, 0x14, 0xF0, 0x35, 0xB1, 0xF3,
-    0xC1, 0x3D, 0xF1, 0xD5, 0xAD, 0xCE, 0x57, 0x84, 0xA4, 0x56, 0x0F, 0x06, 0x1B, 0xF0, 0xE8, 0x3E,
-    0xF7, 0x4A, 0x09, 0x8D, 0xA6, 0x31, 0xA9, 0x1C, 0xA9, 0x26, 0xE2, 0x20, 0xC1, 0x37, 0xC5, 0xAA,
-    0x93, 0xE9, 0x46, 0x17, 0xFE, 0x98, 0x3B, 0x40, 0x9D, 0x0C, 0xDE, 0x40, 0xFF, 0xD5, 0x63, 0x09,
-    0xCA, 0xE0, 0xDB, 0x97, 0xAB, 0x4F, 0x22, 0x8F, 0x3C, 0x68, 0xE9, 0xB4, 0x85, 0x0D, 0xF1, 0x53,
-    0x82, 0x61, 0x62, 0xA9, 0xD6, 0x04, 0x07, 0xE1, 0x6A, 0x21, 0x88, 0x5B, 0xF9, 0xD3, 0x93, 0x20,
-    0x08, 0x81, 0x04, 0x60, 0xA5, 0x36, 0xA8, 0x44, 0x57, 0xCD, 0xDD, 0xFE, 0x1E, 0xC5, 0x39, 0x3C,
-    0x15, 0x91, 0x0D, 0x49, 0x8D, 0x7C, 0x84, 0xDA, 0x25, 0xC4, 0xB8, 0xAB, 0x99, 0x57, 0xD8, 0x9C,
-    0xC0, 0x5F, 0x85, 0x85, 0x82, 0xE9, 0x4B, 0x9D, 0xCD, 0xC0, 0xF3, 0x0D, 0xB3, 0x03, 0xC0, 0x88,
-    0x94, 0xA9, 0x7B, 0xBE, 0xF8, 0xB1, 0xB9, 0x18, 0x8A, 0xF7, 0xE7, 0x59, 0x9E, 0x44, 0xA6, 0x88,
-    0xCD, 0x37, 0x91, 0xD6, 0x95, 0xD1, 0x39, 0x3F, 0xE2, 0xA8, 0x8D, 0x08, 0x5C, 0xC6, 0xD6, 0xC2,
-    0x20, 0xE0, 0xEC, 0xCF, 0x98, 0x21, 0x0C, 0x84, 0x00, 0x3C, 0x5D, 0xAC, 0x74, 0xD4, 0xFB, 0xE0,
-    0x44, 0x6A, 0x26, 0x2B, 0x80, 0xA8, 0x36, 0x11, 0xED, 0x00, 0xA4, 0xAE, 0x4A, 0x8A, 0x43, 0xD2,
-    0x79, 0x8E, 0xC2, 0x5A, 0x41, 0x15, 0xCD, 0x24, 0xFE, 0xF4, 0x79, 0x6C, 0xE7, 0x22, 0xA4, 0x72,
-    0x93, 0x45, 0x41, 0xF2, 0x76, 0xD8, 0x79, 0xBD, 0xFC, 0x1A, 0x03, 0x10, 0xE6, 0x2E, 0x38, 0x82,
-    0x60, 0xDF, 0x32, 0x82, 0xCC, 0xCE, 0x85, 0x8D, 0xF3, 0x3C, 0x3D, 0x64, 0x0C, 0xC2, 0xD1, 0x8A,
-    0xA8, 0xCB, 0x36, 0x94, 0x87, 0x27, 0xE6, 0x66, 0xC0, 0xC0, 0x74, 0xBF, 0xBC, 0x2A, 0xCD, 0xD1,
-    0x98, 0x7F, 0xCB, 0xDA, 0xA9, 0x23, 0xF9, 0x77, 0x4E, 0x2B, 0x57, 0x6B, 0x69, 0x0E, 0x0B, 0x75,
-    0x3C, 0xB9, 0x1E, 0x14, 0x4B, 0xFC, 0xB2, 0xA8, 0xE1, 0xBD, 0xF4, 0x31, 0x58, 0x3F, 0x62, 0xBB,
-    0x02, 0x66, 0x4C, 0x65, 0x67, 0x89, 0x65, 0xE2, 0x0D, 0x21, 0x88, 0x97, 0x82, 0x62, 0x93, 0x1A,
-    0xB7, 0x7E, 0x4F, 0x9B, 0x4F, 0xFE, 0x95, 0xD3, 0x16, 0x8E, 0x90, 0xC8, 0x0A, 0xB8, 0xE2, 0x0B,
-    0xBD, 0x2D, 0xED, 0x99, 0x2F, 0x4E, 0x06, 0x97, 0x83, 0xEF, 0x81, 0xD5, 0xD2, 0x09, 0xCB, 0x87,
-    0x0A, 0xEF, 0x01, 0x6B, 0xBD, 0xBC, 0x2C, 0x8E, 0x57, 0xA8, 0xC4, 0x99, 0x14, 0x6C, 0x2C, 0x6D,
-    0xCC, 0xEA, 0x86, 0x94, 0xE2, 0x05, 0xE9, 0x98, 0x80, 0x74, 0x7C, 0x5A, 0x8E, 0x3A, 0x46, 0x42,
-    0x1B, 0xE6, 0xA7, 0x11, 0xE9, 0xA8, 0x67, 0xA4, 0x03, 0xA1, 0xB3, 0x71, 0x1D, 0xE9, 0x88, 0x7E,
-    0x6C, 0x2E, 0x4E, 0x9B, 0x48, 0x87, 0xD8, 0xF9, 0xBE, 0xE6, 0x35, 0x3A, 0xF9, 0x77, 0x60, 0x62,
-    0x7E, 0x8C, 0xA6, 0x54, 0xA5, 0x06, 0x50, 0xF2, 0xD7, 0x67, 0x00, 0xC1, 0xF1, 0xCF, 0x32, 0xC2,
-    0xFC, 0x77, 0x5C, 0x14, 0xFB, 0x25, 0xB1, 0x32, 0x3B, 0x65, 0x88, 0x69, 0x8D, 0x21, 0xC4, 0x6A,
-    0x4D, 0x58, 0x72, 0x56, 0xA4, 0xD9, 0x39, 0xE1, 0xB1, 0xFB, 0xC1, 0xCB, 0x18, 0x24, 0x92, 0xDB,
-    0xB0, 0x73, 0x21, 0xE3, 0x90, 0xFB, 0x8C, 0x24, 0x37, 0x7C, 0x96, 0x3F, 0x22, 0xAE, 0x69, 0x2C,
-    0x54, 0x28, 0xB3, 0xF8, 0x1B, 0xE6, 0x0A, 0xF6, 0x63, 0xE5, 0x59, 0xEF, 0x5C, 0x61, 0x35, 0x99,
-    0x58, 0x84, 0xF2, 0x34, 0x6B, 0x36, 0xCF, 0x78, 0xAE, 0x6C, 0x88, 0xC2, 0xA8, 0xF2, 0xAF, 0x14,
-    0x92, 0x8C, 0xAC, 0x5D, 0x40, 0xE3, 0xD3, 0xBE, 0x3E, 0xE2, 0x0E, 0x9F, 0x0E, 0x7F, 0x21, 0x03,
-    0x2D, 0xCA, 0x1E, 0xEB, 0x92, 0x2D, 0x3C, 0x2B, 0x2C, 0xFB, 0xBA, 0x70, 0xEC, 0x8D, 0x0C, 0xFB,
-    0x95, 0x02, 0x5B, 0x9A, 0x20, 0x02, 0x33, 0x6E, 0xE6, 0xB8, 0x1A, 0xEB, 0x6C, 0xD4, 0x44, 0xD4,
-    0x3A, 0x9D, 0xE5, 0x73, 0xD9, 0xA8, 0x41, 0x21, 0x57, 0x01, 0xFF, 0x81, 0x0F, 0x31, 0xAF, 0xB5,
-    0x92, 0x08, 0xB2, 0x03, 0xB2, 0x18, 0xA9, 0xCC, 0x35, 0xF5, 0xEA, 0xD0, 0x8A, 0x09, 0xE7, 0x0F,
-    0x9F, 0x01, 0x23, 0x57, 0xD6, 0xF6, 0x72, 0x87, 0x8D, 0x3A, 0xB2, 0x69, 0x66, 0x28, 0x9A, 0xA7,
-    0x20, 0x85, 0xB7, 0x70, 0x7A, 0x3A, 0x17, 0x69, 0x85, 0x87, 0x14, 0xA1, 0x1D, 0xFE, 0x2F, 0xE4,
-    0xC7, 0x09, 0x91, 0x9C, 0xF8, 0xBB, 0xF0, 0xCC, 0x18, 0x18, 0xEC, 0xD7, 0x6A, 0x3A, 0xE8, 0x89,
-    0x43, 0x36, 0xD5, 0xAB, 0xC8, 0x73, 0xD0, 0x25, 0x9A, 0xC2, 0xA5, 0x96, 0x4B, 0x96, 0xAA, 0x46,
-    0x3D, 0xAF, 0x59, 0xF0, 0xA3, 0x26, 0xCF, 0x8E, 0x3B, 0x72, 0xCC, 0xA0, 0x05, 0x58, 0xBD, 0x67,
-    0x2E, 0xA2, 0x90, 0x50, 0x86, 0x3D, 0xC1, 0x53, 0x07, 0xE2, 0xEE, 0x37, 0x7C, 0x09, 0x2B, 0xBE,
-    0x44, 0x00, 0x3C, 0x87, 0x87, 0x61, 0xC8, 0xB8, 0x03, 0x0C, 0x7E, 0xE4, 0x8D, 0xD2, 0x62, 0xAD,
-    0x53, 0x70, 0xC9, 0xA4, 0xAE, 0xDB, 0x29, 0x58, 0x18, 0x2E, 0xA0, 0x1D, 0xE8, 0x45, 0x78, 0xC4,
-    0xE7, 0x39, 0x61, 0x58, 0x68, 0x7B, 0x5C, 0x02, 0xDA, 0xC7, 0x6A, 0x6F, 0x38, 0x3C, 0x33, 0x21,
-    0xCA, 0xAF, 0x3C, 0xA3, 0x21, 0xA9, 0x02, 0x60, 0xF2, 0x4E, 0x17, 0xBD, 0xFA, 0xA5, 0x5E, 0xB6,
-    0x30, 0x44, 0x31, 0x40, 0xB9, 0x34, 0x0B, 0x5B, 0xFC, 0xDA, 0xEB, 0x69, 0x14, 0x51, 0xA7, 0x09,
-    0x29, 0x45, 0xC7, 0xD4, 0xA2, 0x30, 0x99, 0x6F, 0x88, 0x28, 0xF4, 0xB4, 0x40, 0xD4, 0x94, 0x36,
-    0x65, 0x3F, 0xA7, 0x15, 0x9C, 0xA0, 0x81, 0x4B, 0x02, 0x04, 0xAD, 0x95, 0x35, 0xD8, 0x2F, 0xBD,
-    0xA3, 0xC2, 0x86, 0x84, 0xE2, 0x37, 0xA4, 0x94, 0xC3, 0xD4, 0x88, 0xD4, 0x85, 0x10, 0x46, 0xAE,
-    0x44, 0xF8, 0x7A, 0x1F, 0xD7, 0xFE, 0x55, 0xE4, 0xF5, 0x0F, 0x70, 0x3E, 0x53, 0x24, 0x7D, 0xC5,
-    0x1C, 0xD6, 0x40, 0x35, 0x03, 0x1A, 0x19, 0xD0, 0x5C, 0xAE, 0xA3, 0x66, 0x94, 0x0B, 0x67, 0xF7,
-    0x1B, 0xE2, 0x73, 0x47, 0x6F, 0xB6, 0x58, 0x07, 0x38, 0xDD, 0x06, 0x54, 0x21, 0xD0, 0xBB, 0x56,
-    0x9B, 0xE4, 0x67, 0x33, 0xA3, 0x68, 0x38, 0x3E, 0xB3, 0xA4, 0x25, 0x2C, 0x4E, 0x00, 0x38, 0xBC,
-    0x81, 0x05, 0x3F, 0x40, 0xA0, 0x87, 0xCA, 0xCB, 0xAF, 0x96, 0x98, 0x89, 0x7A, 0x19, 0x9A, 0x17,
-    0xB3, 0x96, 0x86, 0xA2, 0x56, 0xDB, 0xF1, 0xDF, 0x36, 0x02, 0xB6, 0xF6, 0xB8, 0x9F, 0x21, 0xFA,
-    0xBF, 0xE4, 0xDA, 0x12, 0x99, 0xF2, 0x19, 0x6C, 0xC5, 0xFA, 0x44, 0x93, 0x16, 0xC1, 0x72, 0xE4,
-    0x9F, 0x3A, 0xB0, 0xBA, 0x77, 0x95, 0x5F, 0xFB, 0x01, 0xA2, 0xA2, 0xFF, 0x12, 0xA8, 0x68, 0xE8,
-    0x2E, 0xF5, 0x33, 0xCC, 0x1E, 0x76, 0xDB, 0x95, 0xCB, 0x55, 0x2D, 0x95, 0xE1, 0x36, 0x43, 0x85,
-    0x85, 0x61, 0xB4, 0x50, 0x3F, 0xCB, 0xF0, 0xD1, 0x9C, 0x85, 0x82, 0xE0, 0xD1, 0x78, 0xE6, 0x34,
-    0x73, 0x31, 0x3A, 0x66, 0x62, 0x54, 0xE9, 0x19, 0x73, 0x26, 0x77, 0x7A, 0xE1, 0x25, 0xB1, 0x3A,
-    0xA3, 0x5A, 0xFE, 0x60, 0x1E, 0x3A, 0xC7, 0x6F, 0xCC, 0x85, 0x62, 0xD4, 0x31, 0xB0, 0x49, 0x76,
-    0x25, 0xC3, 0xF4, 0xC1, 0x64, 0xCB, 0x21, 0x63, 0x2D, 0xF7, 0x74, 0xD4, 0x19, 0x11, 0x1E, 0xB3,
-    0xA5, 0x1F, 0xA8, 0xC6, 0x76, 0x59, 0x0A, 0x80, 0x3C, 0x0C, 0x39, 0xE2, 0xCA, 0x45, 0x6A, 0x4B,
-    0x24, 0x09, 0xD9, 0xB2, 0x56, 0xBB, 0xAB, 0xEE, 0x2B, 0x20, 0xB2, 0xE0, 0xCF, 0x01, 0x77, 0x61,
-    0xC4, 0x7E, 0x02, 0xDB, 0xEF, 0x9D, 0xA4, 0xCC, 0x7A, 0xAD, 0x80, 0x30, 0x9F, 0x5A, 0x6C, 0xCB,
-    0x88, 0x91, 0x48, 0x44, 0x25, 0xFF, 0xAF, 0xF8, 0x6B, 0x2D, 0xC4, 0xA8, 0xD8, 0x45, 0xC9, 0xB5,
-    0xB2, 0x62, 0xAC, 0x05, 0xE6, 0x47, 0x2A, 0x5C, 0x51, 0x52, 0xC6, 0x81, 0xD3, 0xE5, 0x1F, 0xE4,
-    0x7E, 0x58, 0x8E, 0x69, 0x06, 0x00, 0x0E, 0x22, 0x34, 0x41, 0x2A, 0xDB, 0x48, 0x8D, 0xA5, 0xD2,
-    0xEB, 0xC4, 0x2A, 0xD1, 0xCD, 0x2D, 0xD7, 0x93, 0x21, 0xF7, 0x0F, 0x4D, 0x86, 0x4C, 0xE7, 0x64,
-    0xC8, 0x6E, 0x49, 0x86, 0x74, 0x0F, 0x24, 0x43, 0x5E, 0xD9, 0xDE, 0xDE, 0xDE, 0x79, 0x85, 0xD1,
-    0xFE, 0x51, 0x13, 0x00, 0x5E, 0xEE, 0x56, 0xC9, 0x90, 0xE9, 0x37, 0xBB, 0x55, 0x32, 0xA4, 0xB1,
-    0x39, 0x95, 0x36, 0x19, 0x72, 0x3C, 0x2C, 0x19, 0xF2, 0xCA, 0x46, 0x32, 0xE4, 0xFE, 0xCA, 0xA2,
-    0x76, 0x3E, 0x6B, 0xE1, 0x48, 0x57, 0xE1, 0xC8, 0xA0, 0xE7, 0x76, 0x8F, 0x50, 0xCC, 0x23, 0xE2,
-    0x26, 0x7D, 0x14, 0xC5, 0x47, 0x09, 0xD4, 0x30, 0xC6, 0xC0, 0x01, 0x31, 0x29, 0x46, 0xD6, 0x34,
-    0x42, 0x76, 0x13, 0xE4, 0xB9, 0xB8, 0x25, 0xC8, 0x88, 0xA1, 0x4B, 0x90, 0xBF, 0x5A, 0x56, 0x0C,
-    0x3F, 0xD2, 0xC8, 0xB4, 0x19, 0x76, 0x22, 0xAC, 0xC3, 0x1F, 0x43, 0x7A, 0xBB, 0xE6, 0x65, 0x18,
-    0xEF, 0xB1, 0x71, 0x19, 0x48, 0x83, 0xC7, 0x20, 0x8C, 0x72, 0xC1, 0xDA, 0x65, 0x68, 0x84, 0xD0,
-    0xE9, 0xBB, 0x82, 0xF6, 0x15, 0x25, 0x1F, 0x03, 0x6C, 0xA4, 0x05, 0xC3, 0xA5, 0x0C, 0x3C, 0x72,
-    0xAF, 0x09, 0xBB, 0x9C, 0xA7, 0x06, 0xF0, 0x35, 0x58, 0x44, 0xB7, 0x32, 0xCD, 0x34, 0xBA, 0x6F,
-    0x33, 0xB8, 0x35, 0x22, 0xD7, 0x50, 0x68, 0x24, 0x3F, 0xE2, 0x06, 0xCD, 0x4F, 0x6A, 0xCE, 0x8D,
-    0x26, 0xE0, 0x68, 0xD2, 0x55, 0x64, 0xB3, 0xD2, 0x1A, 0x67, 0x55, 0xC4, 0x63, 0xF9, 0xEB, 0xFB,
-    0xA8, 0x3E, 0x84, 0x52, 0xCA, 0x7F, 0xC2, 0x02, 0xD9, 0x42, 0x56, 0x35, 0x1D, 0xD5, 0x24, 0x72,
-    0xE9, 0x39, 0x82, 0x3D, 0xB0, 0xFB, 0x99, 0x7A, 0xE7, 0x9C, 0x83, 0x9F, 0xE1, 0xD3, 0xD5, 0xC4,
-    0xC5, 0xA3, 0xBF, 0x6B, 0x97, 0xEA, 0xC0, 0x5D, 0xC8, 0x13, 0x8F, 0x32, 0x24, 0xD4, 0xC2, 0x1D,
-    0xCD, 0xA1, 0x5B, 0xD5, 0x80, 0x6B, 0xFC, 0xE7, 0x9E, 0x1B, 0x4D, 0x97, 0xDF, 0xA5, 0xFF, 0xDF,
-    0x24, 0xFD, 0xFF, 0xC2, 0x21, 0xE9, 0xFF, 0x2B, 0x70, 0x6C, 0x49, 0x60, 0x5C, 0xF2, 0xC4, 0xA2,
-    0xB9, 0xDC, 0xB6, 0xD9, 0xCC, 0x96, 0x99, 0xA1, 0x0A, 0x67, 0x13, 0x7A, 0xFC, 0x40, 0x62, 0x48,
-    0xFD, 0xCD, 0x35, 0xE8, 0x24, 0x1A, 0xF4, 0x38, 0x34, 0xE8, 0xD3, 0xF5, 0x4A, 0x83, 0x56, 0xD0,
-    0xA0, 0x3D, 0x34, 0xA8, 0xC9, 0x44, 0x83, 0xFE, 0xF3, 0x56, 0x2B, 0x8C, 0x66, 0x15, 0xA4, 0xF2,
-    0xFD, 0xE4, 0x4A, 0xC3, 0x3F, 0x73, 0xDB, 0x09, 0x24, 0x39, 0x99, 0x80, 0xA2, 0xEB, 0xE2, 0xB4,
-    0xFD, 0x41, 0x26, 0x90, 0x40, 0x70, 0x56, 0x34, 0x40, 0x3F, 0x81, 0xCC, 0x5D, 0x2C, 0x31, 0xAC,
-    0xCF, 0x54, 0x6D, 0xF1, 0x13, 0x7B, 0xA7, 0xE9, 0xC7, 0x23, 0x39, 0x16, 0x4A, 0x1C, 0xD4, 0xC2,
-    0x1F, 0x76, 0x79, 0x58, 0x1F, 0x77, 0xA2, 0xB7, 0x8C, 0x18, 0x42, 0xA6, 0x8D, 0x2F, 0x87, 0x83,
-    0xB8, 0x34, 0x03, 0x50, 0xC1, 0x94, 0x36, 0x15, 0x5E, 0x61, 0x80, 0x8A, 0xD0, 0xAE, 0xB7, 0x2A,
-    0x65, 0xF6, 0xCE, 0x0A, 0xEC, 0x77, 0x91, 0x35, 0x6D, 0x96, 0xAC, 0xE9, 0xFB, 0xF1, 0xD9, 0xD3,
-    0x28, 0x36, 0x18, 0xC3, 0x97, 0x91, 0x24, 0x16, 0x95, 0x48, 0x6C, 0x4A, 0xD7, 0xB2, 0xA6, 0x61,
-    0x6B, 0x5C, 0xF9, 0x57, 0x94, 0x69, 0x3E, 0xB9, 0x26, 0x60, 0x2D, 0xE6, 0xC7, 0xDE, 0x45, 0xD6,
-    0xF4, 0x7B, 0x8C, 0xA6, 0x4C, 0x37, 0x46, 0x53, 0x1E, 0x60, 0x34, 0xE5, 0x9C, 0x8C, 0x3A, 0x6C,
-    0x52, 0x7A, 0xD6, 0x31, 0x12, 0x5C, 0x9A, 0x88, 0xD1, 0x94, 0x27, 0x35, 0x9A, 0xD2, 0x32, 0x9A,
-    0xD2, 0x32, 0x9A, 0xD2, 0x71, 0xD5, 0x07, 0xA2, 0xD7, 0x5F, 0xBF, 0xCD, 0x68, 0xCA, 0xCA, 0xD9,
-    0xAE, 0xD7, 0xD2, 0x2D, 0x77, 0x2D, 0x26, 0x88, 0x4A, 0x96, 0xAD, 0xCA, 0xD5, 0x9A, 0xC7, 0x5C,
-    0xB3, 0xF9, 0xCA, 0x6D, 0xE4, 0xD9, 0xEA, 0xEE, 0xD4, 0x3D, 0xA9, 0xC8, 0xAF, 0xAD, 0xE3, 0x2D,
-    0xD7, 0x36, 0xEF, 0xC6, 0xD7, 0xC3, 0x4D, 0xBE, 0x56, 0x23, 0xC6, 0xDB, 0xF8, 0xBA, 0xB8, 0xC9,
-    0xD7, 0x46, 0xD9, 0xED, 0x0D, 0xE5, 0xE7, 0x86, 0x0E, 0xD8, 0x5C, 0x74, 0x7F, 0x61, 0x31, 0xEC,
-    0x33, 0xBB, 0xA9, 0xBC, 0x56, 0x64, 0xE5, 0x16, 0x52, 0x6A, 0x21, 0x67, 0x84, 0xC2, 0x9B, 0x7E,
-    0xA1, 0x33, 0xCC, 0xD2, 0x83, 0x28, 0xE7, 0xF9, 0x19, 0xD3, 0xDE, 0x3C, 0x80, 0xEA, 0x08, 0xA7,
-    0x84, 0x7A, 0x0A, 0x20, 0x3B, 0xD8, 0xFD, 0x80, 0xC5, 0xFF, 0xC7, 0xEF, 0x64, 0xF5, 0xEA, 0x91,
-    0x27, 0xAE, 0x9E, 0x99, 0x5B, 0x0F, 0xE9, 0xF3, 0x1D, 0xAB, 0x5E, 0x3D, 0x3C, 0x15, 0xE4, 0x1E,
-    0x39, 0xFE, 0x85, 0xA8, 0x75, 0x61, 0x9E, 0x43, 0x2A, 0x8C, 0x84, 0x5F, 0xE3, 0x06, 0x01, 0xD8,
-    0xEC, 0x56, 0xA9, 0x20, 0x77, 0xA0, 0xEE, 0xB9, 0x83, 0x79, 0x11, 0xFC, 0x0A, 0x83, 0x0C, 0x6D,
-    0x47, 0x8E, 0x8B, 0x86, 0xE5, 0xCE, 0xE2, 0xDD, 0xC6, 0xB5, 0xAD, 0x78, 0x0E, 0x91, 0x5A, 0x65,
-    0xF3, 0x68, 0x02, 0xF6, 0x5F, 0x0A, 0x3A, 0x36, 0xDF, 0x60, 0xE7, 0x0D, 0x79, 0x46, 0x3A, 0x48,
-    0x8B, 0x09, 0x47, 0x2D, 0x32, 0x6B, 0xA2, 0x06, 0xF6, 0x8B, 0x62, 0xD6, 0xCA, 0x62, 0xAA, 0xA1,
-    0xA1, 0x0B, 0x0B, 0xE2, 0x80, 0xFB, 0x25, 0x15, 0x15, 0x14, 0xA2, 0xAF, 0x59, 0x38, 0x5F, 0xB3,
-    0x95, 0x04, 0x58, 0xF2, 0x6F, 0x22, 0x1E, 0x04, 0xBD, 0x27, 0x8C, 0x72, 0x49, 0x66, 0xF0, 0x20,
-    0xCD, 0x67, 0x9C, 0x8F, 0x68, 0x73, 0x7F, 0xEF, 0x05, 0x67, 0x2A, 0xE9, 0x33, 0xF7, 0xF1, 0xF4,
-    0x5D, 0x23, 0x03, 0x48, 0x5E, 0x87, 0x29, 0x0C, 0x5A, 0x0B, 0xC3, 0xA4, 0xAF, 0xC9, 0x26, 0x15,
-    0xF7, 0xCF, 0xBF, 0xD6, 0xE9, 0xBE, 0x4B, 0xD7, 0x32, 0x19, 0x65, 0x41, 0x45, 0x94, 0xB9, 0x5D,
-    0xD8, 0xB1, 0x57, 0x42, 0x4C, 0x9B, 0xAA, 0x70, 0xFE, 0xC9, 0x16, 0xAA, 0xF6, 0x4B, 0xA1, 0xAA,
-    0xC9, 0x96, 0x42, 0xD5, 0x7A, 0x4E, 0x03, 0xC9, 0x97, 0xEC, 0xC9, 0x74, 0x41, 0xA1, 0x56, 0xD8,
-    0x50, 0xBE, 0x48, 0xAD, 0xF3, 0xCB, 0xBB, 0x4B, 0xCB, 0xBB, 0x17, 0x96, 0x77, 0x5F, 0xFD, 0x2D,
-    0xA7, 0xF3, 0x7C, 0xCC, 0xA6, 0xF3, 0x78, 0x37, 0xA4, 0xF3, 0x54, 0x36, 0x9D, 0xE7, 0x05, 0x9B,
-    0xCE, 0xF3, 0xF7, 0x85, 0x4D, 0xE7, 0x99, 0x13, 0x84, 0x97, 0x86, 0x4B, 0x07, 0x3F, 0xF0, 0x6C,
-    0xE2, 0xB0, 0x6B, 0x96, 0xFC, 0xBA, 0x35, 0x29, 0xFE, 0x01, 0x17, 0xF7, 0xD6, 0x07, 0x8B, 0x7B,
-    0xF3, 0x99, 0x14, 0x8C, 0x97, 0x62, 0xCC, 0xFF, 0x03, 0xA1, 0x79, 0x08, 0x69, 0x86, 0xED, 0x3E,
-    0xA1, 0x7E, 0xF4, 0x1D, 0x4E, 0x58, 0xBA, 0xCF, 0xA2, 0xFA, 0xF8, 0x13, 0xC3, 0x29, 0xDA, 0x29,
-    0xB4, 0x2C, 0xB1, 0xBF, 0x0B, 0x1B, 0xD1, 0x74, 0x5A, 0x55, 0x3A, 0x69, 0x55, 0xA9, 0xCD, 0x22,
-    0x2E, 0x8B, 0x75, 0xF7, 0xA6, 0xDC, 0x68, 0xBB, 0x61, 0x19, 0xA4, 0xDF, 0x68, 0xB6, 0xF1, 0xCC,
-    0x7B, 0x02, 0xAD, 0xBA, 0x05, 0xB4, 0x1A, 0xD6, 0x40, 0xAB, 0x4F, 0x02, 0xB4, 0x7A, 0x58, 0xBC,
-    0xB4, 0x66, 0x00, 0x68, 0xD5, 0x27, 0x45, 0x60, 0x5E, 0x48, 0x33, 0x6F, 0xC4, 0x46, 0x3B, 0xD5,
-    0x2F, 0x63, 0x58, 0x9E, 0xBC, 0x85, 0x79, 0x66, 0xDE, 0x04, 0x01, 0x34, 0x32, 0x54, 0x63, 0x6A,
-    0xA0, 0x00, 0x04, 0x9B, 0xC8, 0x42, 0x46, 0xFC, 0x90, 0x0C, 0x5C, 0x14, 0xD6, 0x6C, 0xC3, 0xC4,
-    0x94, 0x3F, 0x5F, 0xCC, 0x76, 0x49, 0x84, 0xBF, 0x62, 0x47, 0x91, 0xF4, 0x3F, 0x3C, 0x4A, 0x24,
-    0xA7, 0x23, 0xB8, 0x23, 0x8E, 0x59, 0xCC, 0xEA, 0xCD, 0x6B, 0xEA, 0x38, 0x95, 0x96, 0x0E, 0x3F,
-    0xFB, 0x39, 0x57, 0x60, 0x7C, 0x48, 0x09, 0xF1, 0xD2, 0x8B, 0x1C, 0xD0, 0x70, 0x96, 0xD2, 0x32,
-    0x79, 0xB9, 0x28, 0x49, 0xC8, 0x7F, 0x43, 0x35, 0x94, 0x32, 0x1B, 0xD7, 0xD1, 0x5E, 0x7E, 0x5C,
-    0xD6, 0xD0, 0x96, 0x7A, 0xA7, 0x95, 0xAD, 0x9D, 0xD4, 0x6C, 0xF2, 0x48, 0x6B, 0x7C, 0x97, 0x8E,
-    0x3F, 0xA7, 0x18, 0x63, 0xBB, 0xEF, 0x69, 0x24, 0x20, 0x89, 0x8F, 0x2F, 0xC7, 0x21, 0xEE, 0x59,
-    0x5E, 0x92, 0xCD, 0x26, 0xA2, 0x35, 0x7A, 0x11, 0x4E, 0xE4, 0xD0, 0x02, 0xB2, 0xFA, 0x5B, 0xE1,
-    0x15, 0x77, 0xFF, 0x4D, 0x84, 0x0D, 0x08, 0x09, 0xD2, 0x48, 0x4C, 0x1F, 0x92, 0x79, 0x05, 0xBF,
-    0x7C, 0x59, 0xAE, 0xBB, 0xF7, 0x79, 0xA1, 0x43, 0xF4, 0x7F, 0xBE, 0xD0, 0xB3, 0xEB, 0x42, 0xFD,
-    0x80, 0xEC, 0xC9, 0x32, 0x64, 0xA2, 0x0E, 0xC1, 0xCB, 0xC9, 0xEF, 0x66, 0x1D, 0x96, 0xBD, 0x1B,
-    0x36, 0x2E, 0x4D, 0x9B, 0xB2, 0x00, 0xB9, 0x05, 0x93, 0x7C, 0x79, 0xFC, 0xD7, 0x1F, 0xAA, 0x7E,
-    0x4A, 0x6E, 0x59, 0xDB, 0x26, 0x79, 0x47, 0x77, 0xEA, 0x59, 0xB4, 0xAD, 0x9E, 0xA0, 0x9D, 0x8E,
-    0x6C, 0x7D, 0xDB, 0xBD, 0x1C, 0x9B, 0x21, 0x1C, 0xEE, 0x2D, 0x9F, 0x4D, 0x01, 0x17, 0x80, 0x7B,
-    0xFD, 0x85, 0x7B, 0x93, 0x77, 0x03, 0xB9, 0x26, 0x0B, 0xE4, 0x1A, 0xDE, 0x00, 0xB9, 0xB2, 0x7C,
-    0xC2, 0x1D, 0xD9, 0x88, 0xD0, 0x67, 0x1D, 0x61, 0xED, 0x9B, 0xB7, 0xA7, 0x6D, 0x04, 0xF3, 0x7A,
-    0x14, 0x51, 0xF8, 0xC3, 0x3D, 0x89, 0x26, 0x92, 0x23, 0x87, 0x04, 0xA6, 0x7A, 0xED, 0x0F, 0x30,
-    0x66, 0x8F, 0xCD, 0x5A, 0x36, 0x27, 0x9B, 0x8A, 0x38, 0x3D, 0xA7, 0xDE, 0xC1, 0x49, 0xAD, 0xA8,
-    0xB3, 0x3D, 0xB2, 0x74, 0x07, 0xE7, 0x5F, 0x56, 0x20, 0xA3, 0x52, 0x54, 0xB7, 0x8D, 0x94, 0x12,
-    0x73, 0x41, 0x03, 0x7D, 0xDE, 0x5C, 0xBB, 0x72, 0x24, 0x95, 0x6B, 0xC3, 0x21, 0x80, 0x7D, 0xE5,
-    0xBA, 0x73, 0x0B, 0x28, 0x86, 0x22, 0x2E, 0x03, 0x93, 0x0A, 0x39, 0xD8, 0x0C, 0x46, 0x99, 0x45,
-    0x22, 0x60, 0x4B, 0x7A, 0xDF, 0x3B, 0xED, 0x84, 0x4F, 0x21, 0x03, 0x7B, 0x4A, 0x4D, 0xEF, 0x99,
-    0x37, 0xAB, 0x38, 0x2B, 0x77, 0x2F, 0x79, 0x6D, 0x52, 0x7D, 0xB1, 0x4E, 0x11, 0x98, 0xF7, 0x09,
-    0xA7, 0x9C, 0x63, 0x52, 0x0A, 0x21, 0x95, 0x51, 0x7B, 0x14, 0x32, 0x17, 0x9C, 0xB9, 0xDD, 0x2F,
-    0xB1, 0x80, 0x86, 0x65, 0x2F, 0x32, 0xC7, 0x0C, 0x61, 0xDF, 0x07, 0xC4, 0xAA, 0x28, 0xBF, 0x58,
-    0x45, 0x0D, 0xE4, 0x03, 0x25, 0x93, 0x50, 0x40, 0xAD, 0xCE, 0xCC, 0xF9, 0x28, 0xD5, 0x49, 0x3F,
-    0x3B, 0xA3, 0x2A, 0x95, 0xAD, 0x93, 0xB6, 0x2B, 0x1B, 0xCC, 0x1A, 0x77, 0x70, 0x36, 0xE4, 0xAF,
-    0xCD, 0x62, 0x5A, 0xE5, 0x50, 0x2C, 0x8D, 0x53, 0x67, 0x58, 0xF6, 0x5F, 0xBC, 0x1F, 0x99, 0x8A,
-    0x05, 0x7E, 0x70, 0x12, 0x3F, 0x78, 0x9C, 0x82, 0x02, 0x39, 0x63, 0xE9, 0xF5, 0x47, 0xC5, 0x63,
-    0x1C, 0x9E, 0x87, 0xA8, 0xD5, 0xF6, 0x4B, 0xFD, 0xCA, 0x66, 0xE8, 0x17, 0xE3, 0x89, 0xFB, 0xD8,
-    0xEB, 0xD7, 0x30, 0x05, 0x98, 0xF2, 0x99, 0x6D, 0xE2, 0xB5, 0xB4, 0x22, 0x03, 0xCF, 0x12, 0x4F,
-    0xBA, 0xA6, 0x46, 0x3D, 0xE8, 0x17, 0x67, 0x76, 0xE5, 0xBC, 0x76, 0xAE, 0xC0, 0x49, 0xE6, 0x05,
-    0xF5, 0xEA, 0x99, 0x88, 0xC7, 0x57, 0x25, 0xD4, 0x73, 0x7D, 0x96, 0xB3, 0x14, 0x5B, 0xAF, 0x28,
-    0xE9, 0x68, 0xF0, 0x29, 0xB3, 0x2D, 0x99, 0x74, 0xA1, 0x97, 0x22, 0xA0, 0x99, 0x4A, 0x2B, 0xCE,
-    0xD0, 0x92, 0x9D, 0x6A, 0xA3, 0x0A, 0x68, 0xA6, 0xE9, 0xC2, 0x47, 0x4B, 0xAD, 0xF7, 0x0A, 0x68,
-    0x5A, 0x0A, 0xE0, 0x17, 0xF6, 0x74, 0xD6, 0x1A, 0x95, 0x11, 0xCD, 0x3F, 0x93, 0x69, 0x42, 0xE7,
-    0x4B, 0x86, 0x49, 0x48, 0x28, 0x74, 0x00, 0x12, 0x08, 0xFA, 0xF8, 0x40, 0x43, 0xC4, 0xF5, 0x46,
-    0xC6, 0x6C, 0xFA, 0x14, 0x6B, 0x11, 0x46, 0xC7, 0x12, 0x89, 0x5E, 0x4B, 0x35, 0xD7, 0x62, 0x38,
-    0xE3, 0x99, 0x2F, 0x77, 0x8E, 0xA5, 0x94, 0xE2, 0x40, 0x70, 0xBF, 0xBD, 0xE1, 0x1E, 0x62, 0xFF,
-    0x0D, 0x3F, 0x4F, 0x9F, 0x54, 0x3C, 0x62, 0x70, 0x18, 0x42, 0x63, 0x76, 0xA4, 0xAD, 0xD5, 0x3D,
-    0xB2, 0x5E, 0xDC, 0xEE, 0x78, 0x4B, 0xB5, 0x64, 0xCC, 0x37, 0x30, 0x99, 0xC2, 0x6B, 0xDF, 0xFB,
-    0x9A, 0x22, 0x83, 0x66, 0x09, 0x5A, 0x58, 0x94, 0x4D, 0xA3, 0xB1, 0xCD, 0x9C, 0xAD, 0xB3, 0x74,
-    0x09, 0x5C, 0xDC, 0x20, 0x6F, 0x71, 0xBC, 0xD4, 0x9E, 0x67, 0x79, 0x28, 0x6A, 0x6C, 0x30, 0x8F,
-    0xFC, 0x31, 0xDB, 0xEE, 0x24, 0xB8, 0x0E, 0x3A, 0x10, 0xCF, 0x9D, 0x2E, 0x6A, 0xD7, 0xDA, 0x88,
-    0xBD, 0x6F, 0x63, 0xAD, 0x5A, 0x4E, 0x9A, 0xB9, 0x04, 0xD4, 0xD8, 0xD6, 0x88, 0x4B, 0xD7, 0x5B,
-    0x42, 0x46, 0xEA, 0xCB, 0x46, 0x84, 0x0C, 0xA9, 0x7B, 0xAC, 0x8B, 0x06, 0xC0, 0x42, 0x41, 0x62,
-    0x67, 0x62, 0x77, 0xC4, 0x7D, 0x39, 0xCB, 0x4F, 0x18, 0x79, 0x44, 0x5D, 0x8E, 0xF0, 0x03, 0x43,
-    0x17, 0x8B, 0x99, 0x1F, 0x2E, 0xB1, 0xFD, 0xA5, 0x0D, 0xA1, 0x45, 0x02, 0xFD, 0x2C, 0xB2, 0x1B,
-    0x6B, 0xEF, 0xCF, 0xE7, 0x4E, 0x64, 0x66, 0x4E, 0x91, 0xCC, 0x67, 0xDC, 0xD4, 0xD9, 0xCE, 0x6C,
-    0x1E, 0x2D, 0xED, 0x4E, 0xA6, 0x3F, 0x68, 0x2E, 0xAD, 0x63, 0xB3, 0x69, 0x1D, 0xCD, 0xA7, 0x75,
-    0x6C, 0x46, 0x2D, 0x00, 0x65, 0xCD, 0x4E, 0x10, 0xDB, 0xEF, 0xA9, 0xD3, 0xF0, 0xCA, 0xFC, 0x5F,
-    0xA1, 0xD0, 0x08, 0x2A, 0xCC, 0x34, 0xC8, 0xAD, 0x35, 0xDF, 0x35, 0x28, 0x6D, 0x2F, 0xB3, 0x10,
-    0xC0, 0x3F, 0x9B, 0x73, 0xB1, 0xC6, 0xC6, 0x9D, 0xB4, 0xBA, 0x26, 0x6A, 0x98, 0x0C, 0x8B, 0x94,
-    0x44, 0x62, 0x67, 0x3F, 0x1D, 0x68, 0xC1, 0x4C, 0xD8, 0x99, 0xE8, 0x8C, 0xC0, 0x8A, 0xC4, 0x59,
-    0x7C, 0x24, 0xD5, 0x46, 0xD9, 0x5F, 0xBE, 0x16, 0x0B, 0x77, 0x32, 0xCF, 0x76, 0x8B, 0x52, 0xEF,
-    0xC2, 0x2A, 0x8F, 0x44, 0x9B, 0xD2, 0x31, 0xF5, 0x44, 0xE6, 0xB6, 0xB3, 0xF6, 0xA1, 0xAB, 0xF1,
-    0x14, 0x21, 0x13, 0xFA, 0xA9, 0xA4, 0x0D, 0xE3, 0xD2, 0xA6, 0xF0, 0xA6, 0x27, 0x3B, 0x11, 0xBE,
-    0x41, 0xEB, 0x0F, 0xAC, 0xCE, 0xF3, 0x06, 0xD9, 0xCF, 0x69, 0x25, 0x7A, 0x8E, 0x79, 0x77, 0x63,
-    0x82, 0x5C, 0x23, 0x77, 0x4C, 0x41, 0x66, 0xFB, 0xE2, 0x0D, 0x79, 0x85, 0xB2, 0xA8, 0x21, 0x2F,
-    0x58, 0x1D, 0xC5, 0x97, 0xA0, 0xE3, 0x0B, 0xC2, 0x15, 0x28, 0x86, 0x6A, 0x72, 0x1C, 0x89, 0x78,
-    0x01, 0xCB, 0xA1, 0x52, 0x34, 0xFE, 0x62, 0xC0, 0x22, 0x7D, 0x7A, 0xA0, 0xD7, 0xF7, 0x1A, 0x22,
-    0x16, 0x19, 0xB0, 0x40, 0xD7, 0xEC, 0x6F, 0x89, 0x61, 0x44, 0xD0, 0x68, 0x9A, 0x80, 0x53, 0x3F,
-    0xC9, 0x8A, 0xE6, 0xCC, 0x39, 0xB3, 0x0E, 0x1B, 0x22, 0xD0, 0x42, 0x17, 0x13, 0x25, 0xD0, 0xC2,
-    0x32, 0x26, 0x0B, 0x9B, 0xB0, 0xC9, 0xE1, 0xD4, 0x8A, 0xEB, 0xDA, 0xC9, 0x7F, 0x3D, 0xD3, 0x60,
-    0x9A, 0x49, 0x4C, 0x80, 0xF4, 0x51, 0x94, 0xC2, 0x8F, 0x48, 0x3C, 0xF2, 0xDB, 0x1C, 0x75, 0x5B,
-    0x4F, 0x21, 0x93, 0x09, 0x49, 0xA1, 0x7D, 0xD0, 0x44, 0x0D, 0x8A, 0x4A, 0xD2, 0x2A, 0x7A, 0x49,
-    0x3C, 0xEC, 0x82, 0x30, 0x6E, 0x9D, 0x76, 0x2E, 0x04, 0xDB, 0x95, 0x4B, 0x32, 0x8E, 0x1D, 0xE1,
-    0x84, 0x23, 0x99, 0x76, 0xF8, 0xBD, 0x03, 0x1D, 0x88, 0x7F, 0x6D, 0x63, 0x83, 0xE0, 0xDD, 0x35,
-    0x36, 0x70, 0x4B, 0x1A, 0xB2, 0xEA, 0xA4, 0x47, 0xD9, 0xD2, 0x40, 0x0F, 0x88, 0x8A, 0xF3, 0x07,
-    0x4F, 0x32, 0x58, 0xAD, 0x1D, 0x87, 0x1B, 0x1B, 0xDC, 0xB0, 0x69, 0x25, 0x11, 0xE3, 0x6A, 0xBF,
-    0x71, 0x32, 0x34, 0x7C, 0x28, 0x5C, 0xF6, 0x61, 0xC2, 0xD0, 0xA1, 0x30, 0x19, 0x5A, 0xF0, 0x59,
-    0x3F, 0xFC, 0xD7, 0xB7, 0x5A, 0xF8, 0xD6, 0x07, 0xD6, 0x6A, 0xE1, 0x1F, 0x55, 0x7D, 0x38, 0x16,
-    0xAF, 0xB5, 0x5A, 0x6D, 0xFD, 0x40, 0x8D, 0x10, 0x24, 0x2B, 0xEF, 0xC8, 0xAF, 0xE7, 0x76, 0x94,
-    0x1F, 0x48, 0xC2, 0x77, 0x7D, 0x63, 0xC2, 0xF7, 0xC7, 0x6D, 0x4C, 0x38, 0x61, 0xDC, 0xC0, 0xED,
-    0x77, 0x6D, 0xC2, 0xF7, 0x60, 0x13, 0xBE, 0x5F, 0xD0, 0x84, 0xEF, 0xF1, 0xAF, 0x6C, 0xC2, 0xF7,
-    0x70, 0xC0, 0xFB, 0x3F, 0xF0, 0x3A, 0xEB, 0xF0, 0xFB, 0xDA, 0x83, 0x79, 0x99, 0x27, 0xD8, 0x57,
-    0x77, 0xCB, 0x60, 0x2F, 0xBD, 0x29, 0xCF, 0x89, 0x69, 0xD0, 0xBF, 0x2A, 0x2F, 0x6C, 0x7F, 0x5C,
-    0x21, 0x84, 0x56, 0xEF, 0x6A, 0x81, 0x3C, 0x6B, 0xF8, 0x0A, 0xC6, 0xE9, 0x58, 0x40, 0x02, 0xAD,
-    0x07, 0xEA, 0x3C, 0xCD, 0x28, 0xE5, 0x2F, 0x98, 0xBD, 0x3D, 0x0D, 0xAB, 0x86, 0x8C, 0xC1, 0xB8,
-    0x26, 0x9A, 0xF3, 0x5B, 0x56, 0xC5, 0xDB, 0xAF, 0x2D, 0x6E, 0xB9, 0x9F, 0x2D, 0xDD, 0x66, 0xD4,
-    0x88, 0x73, 0x9F, 0x75, 0x82, 0x1A, 0x69, 0x21, 0x3F, 0x11, 0x89, 0x55, 0x16, 0x39, 0xAC, 0x5E,
-    0x74, 0x87, 0x80, 0x9C, 0xA9, 0x99, 0xA9, 0x29, 0x86, 0x45, 0xCF, 0xF4, 0x42, 0xF9, 0x3C, 0xD7,
-    0x91, 0xF9, 0x2D, 0xFC, 0x2B, 0xB4, 0xC0, 0x48, 0xB1, 0x51, 0x86, 0xF3, 0x88, 0xEC, 0xCF, 0xD8,
-    0x02, 0x2D, 0xE1, 0xF2, 0x26, 0xE9, 0x3F, 0xCD, 0x6C, 0x03, 0xB1, 0xE8, 0xF3, 0x1A, 0xB9, 0xC7,
-    0x71, 0xEE, 0x05, 0x94, 0xFD, 0x9E, 0x96, 0x4C, 0x1B, 0x2B, 0x60, 0xD6, 0xEE, 0x18, 0xDC, 0x72,
-    0xC9, 0x18, 0x30, 0xD4, 0x2E, 0xE5, 0x8E, 0xE6, 0x9B, 0xDB, 0x35, 0xB1, 0x4B, 0xD6, 0xDF, 0xE9,
-    0x25, 0x4B, 0x74, 0xC9, 0xCE, 0xDF, 0x74, 0xC9, 0xE8, 0x2F, 0x85, 0xF3, 0x92, 0x21, 0x8F, 0x8D,
-    0x21, 0x64, 0xF7, 0xC9, 0x57, 0x4F, 0xDD, 0xE6, 0x92, 0xDD, 0xBD, 0x4D, 0x36, 0x2E, 0xD8, 0x26,
-    0x1B, 0x95, 0x36, 0xD9, 0xB0, 0xFB, 0x48, 0x21, 0xCF, 0xC5, 0xF6, 0xD8, 0x5B, 0xD7, 0xC9, 0xCB,
-    0xA6, 0x9B, 0xFB, 0x9A, 0xB6, 0xAB, 0xEE, 0xB6, 0xEF, 0x47, 0xF6, 0xFF, 0x43, 0xC8, 0xFE, 0xFF,
-    0x46, 0x8B, 0xEC, 0xFF, 0xBC, 0x40, 0xF6, 0xFF, 0xC8, 0xEC, 0xFF, 0xE7, 0x91, 0xFD, 0xFF, 0xCB,
-    0x1A, 0x09, 0xC9, 0x3A, 0x90, 0x93, 0x2B, 0xD8, 0x27, 0x58, 0x52, 0x3D, 0xAC, 0xB3, 0x32, 0x5B,
-    0x53, 0x88, 0xDF, 0x9C, 0x06, 0xAD, 0x20, 0xB3, 0x1F, 0x45, 0xE6, 0x87, 0xE1, 0xD4, 0x8B, 0xF8,
-    0xD5, 0xE9, 0x09, 0x14, 0xB1, 0x8A, 0x57, 0x92, 0x21, 0x79, 0xD4, 0x13, 0xE7, 0xF8, 0x24, 0x7E,
-    0xD6, 0x8B, 0x6F, 0x9A, 0xC9, 0xC4, 0x1F, 0xF4, 0xFB, 0x00, 0x89, 0x15, 0xAE, 0xB5, 0x79, 0x6D,
-    0xD2, 0xA8, 0xDD, 0xEF, 0x38, 0x3F, 0x0B, 0xD0, 0x6A, 0xDB, 0xA5, 0xB8, 0x55, 0x61, 0xBE, 0x71,
-    0x60, 0x62, 0x0F, 0xE4, 0x56, 0xB1, 0x59, 0xCD, 0xF3, 0x81, 0xDE, 0x6D, 0x1D, 0x68, 0xDD, 0x33,
-    0xD7, 0x4C, 0xDB, 0xA5, 0xB8, 0x67, 0x73, 0xFB, 0x6E, 0x5F, 0x5F, 0xEB, 0x4D, 0x83, 0x71, 0xCE,
-    0x51, 0x5F, 0xEC, 0xC6, 0xF4, 0x00, 0x72, 0xEA, 0xD7, 0x07, 0x1A, 0xD2, 0x7E, 0x46, 0x1D, 0xF4,
-    0x9E, 0x86, 0x76, 0xE5, 0xAC, 0xD8, 0xE1, 0x86, 0xC7, 0x1D, 0xCF, 0xAD, 0xFA, 0x24, 0x22, 0xC3,
-    0x8F, 0x21, 0xB7, 0x6A, 0xBF, 0x9F, 0x73, 0xAB, 0x1E, 0x41, 0x42, 0x6E, 0x11, 0x7D, 0x0B, 0x58,
-    0x8F, 0x46, 0x82, 0xD7, 0xEA, 0x2C, 0xF8, 0x96, 0xB2, 0xD9, 0x16, 0xD7, 0x67, 0x4B, 0x61, 0xF8,
-    0xFB, 0xD6, 0x13, 0x25, 0xFB, 0x8D, 0x7A, 0xA2, 0xBC, 0xA1, 0xDE, 0x1D, 0xA1, 0x1E, 0x73, 0xB3,
-    0x9F, 0x2B, 0x6D, 0x94, 0x7F, 0x75, 0xCE, 0x16, 0xBE, 0xFF, 0xD4, 0xED, 0x17, 0x92, 0xE4, 0xB7,
-    0x55, 0x48, 0x72, 0xFF, 0xBC, 0x21, 0xC7, 0x74, 0xCE, 0xED, 0x8A, 0x26, 0x30, 0x1B, 0xBD, 0xE6,
-    0x63, 0x27, 0x97, 0x1D, 0xEE, 0xB7, 0x4B, 0x55, 0xF8, 0xEA, 0xA6, 0x02, 0xD3, 0x6F, 0xBA, 0xDA,
-    0x01, 0x4A, 0x35, 0x8D, 0xD7, 0x70, 0xB5, 0x3B, 0xAE, 0xF6, 0x43, 0x5C, 0xED, 0xB7, 0x56, 0x1D,
-    0x68, 0xEC, 0xAD, 0x28, 0x8E, 0xEE, 0x73, 0xB5, 0xF9, 0xB5, 0x13, 0xF3, 0xD2, 0x01, 0xBB, 0x79,
-    0xCB, 0xAF, 0x6F, 0xB7, 0x03, 0xCD, 0x6D, 0xAE, 0x5D, 0x0B, 0xD0, 0xE1, 0xF3, 0x58, 0xBB, 0x4F,
-    0xCF, 0x6B, 0xE7, 0x72, 0xED, 0x3E, 0xC1, 0x14, 0x98, 0xCF, 0xE3, 0x7A, 0x9F, 0x46, 0x11, 0x4E,
-    0xF8, 0xE8, 0x2D, 0x8B, 0x70, 0x34, 0x3F, 0xC1, 0x26, 0x71, 0x68, 0x82, 0x82, 0x95, 0xA9, 0x66,
-    0x8D, 0xE4, 0xE3, 0x8D, 0x6D, 0xEC, 0x55, 0x03, 0xDE, 0x8B, 0x3B, 0xD1, 0x5C, 0xC3, 0x12, 0x04,
-    0xC4, 0x3D, 0x42, 0xF3, 0x9D, 0xB2, 0x45, 0x57, 0xFE, 0x88, 0x9B, 0x2D, 0xA4, 0x4D, 0x15, 0x68,
-    0x30, 0x70, 0x69, 0x63, 0x5F, 0xD8, 0x1E, 0xC5, 0x5A, 0x64, 0xA8, 0xAD, 0x90, 0x63, 0x86, 0x9D,
-    0x12, 0xB6, 0xE1, 0xCF, 0xEB, 0x1C, 0xF9, 0x6E, 0x63, 0x89, 0x0C, 0xB3, 0xE1, 0xD7, 0xA5, 0xA8,
-    0xAA, 0x77, 0xB6, 0xB7, 0x70, 0xA6, 0x4D, 0x51, 0x75, 0x5F, 0x90, 0xD5, 0x82, 0x62, 0x1A, 0x43,
-    0x94, 0xEE, 0x44, 0xBF, 0x12, 0x7F, 0xF8, 0x47, 0x22, 0x33, 0xC3, 0x9F, 0xD7, 0x51, 0xE5, 0x5D,
-    0xAF, 0xE5, 0xB7, 0x06, 0x8E, 0x71, 0xDA, 0xDA, 0x52, 0x9C, 0x0C, 0x3D, 0x2D, 0x2A, 0xDF, 0x16,
-    0xE7, 0xB0, 0x14, 0xE9, 0x60, 0x8A, 0x6A, 0x78, 0x8B, 0x14, 0xD5, 0x7B, 0x9F, 0x73, 0x56, 0x69,
-    0xC5, 0xB1, 0xEE, 0x9B, 0xF2, 0x72, 0xAC, 0x25, 0x0C, 0xE8, 0x9D, 0x81, 0xF4, 0x9D, 0x31, 0x2E,
-    0x70, 0xBB, 0x82, 0x29, 0xA5, 0xD4, 0x94, 0x17, 0xB4, 0x4D, 0x14, 0xB6, 0x1E, 0xF9, 0xF2, 0x0D,
-    0x4A, 0xCD, 0xE4, 0xFA, 0x78, 0xE6, 0xCC, 0x97, 0x87, 0x48, 0x6F, 0x7D, 0xE0, 0xDA, 0x56, 0x3C,
-    0xE1, 0x55, 0x42, 0x0C, 0xB6, 0xAF, 0xF9, 0x2D, 0x5F, 0x3A, 0xE2, 0x7B, 0x08, 0xA1, 0x78, 0x35,
-    0xCD, 0xBE, 0x18, 0xA5, 0xFF, 0x17, 0x8E, 0x5A, 0xA9, 0x30, 0xAA, 0x03, 0x45, 0x97, 0xC5, 0x26,
-    0x83, 0x9C, 0xB0, 0x7A, 0xB1, 0x9F, 0x3B, 0xA3, 0xE7, 0x80, 0x8F, 0x50, 0xD4, 0x20, 0x5B, 0x33,
-    0x29, 0x32, 0x31, 0x4F, 0x7E, 0xDA, 0x26, 0x45, 0xD8, 0xF6, 0xE8, 0x75, 0x79, 0x32, 0x6C, 0xA2,
-    0x5E, 0x7C, 0xB5, 0xAD, 0xCE, 0x9F, 0x26, 0xBD, 0x51, 0x44, 0x26, 0x13, 0xBF, 0xBC, 0x4E, 0x10,
-    0xF6, 0xDB, 0x79, 0x5E, 0x86, 0xE4, 0xD1, 0x4B, 0xC2, 0x9D, 0x77, 0xB4, 0xC7, 0xDA, 0xE5, 0x19,
-    0x34, 0xB9, 0xF5, 0x92, 0x4D, 0xBA, 0x64, 0xDD, 0x87, 0x76, 0xC9, 0x2C, 0xB2, 0x61, 0xD5, 0x75,
-    0xBA, 0x81, 0x08, 0xD8, 0xD0, 0xE6, 0xD9, 0x8D, 0x97, 0xAF, 0x6F, 0x16, 0x3E, 0x7C, 0x40, 0x4B,
-    0xAD, 0x8D, 0x32, 0xBA, 0x25, 0xCC, 0x9A, 0x2C, 0x5D, 0x88, 0xD8, 0xD5, 0xDF, 0x79, 0x7E, 0xCE,
-    0x7D, 0xFB, 0x2D, 0xDC, 0xAE, 0xE6, 0xE0, 0xE3, 0xF7, 0xAC, 0xE5, 0xD3, 0x3A, 0x0F, 0x2C, 0xF9,
-    0x61, 0x0F, 0x2D, 0x19, 0x63, 0xFD, 0x0C, 0xE9, 0x2E, 0xD9, 0x63, 0xAB, 0x46, 0x3D, 0xE5, 0xB8,
-    0x64, 0x5B, 0x65, 0x37, 0x6B, 0x59, 0xFF, 0xBB, 0xAE, 0xD2, 0x37, 0xE9, 0x2A, 0xBD, 0xB1, 0x48,
-    0x73, 0xC7, 0xB6, 0xBF, 0xB4, 0x91, 0xF9, 0xC8, 0x9A, 0xD3, 0xCA, 0x2D, 0x72, 0xB1, 0x4B, 0x9B,
-    0xE8, 0x5D, 0x32, 0x13, 0xF2, 0x53, 0x87, 0x2F, 0xFC, 0x5F, 0x64, 0xCE, 0x0F, 0x10, 0xC9, 0x4F,
-    0x47, 0x74, 0x4C, 0x37, 0x55, 0x6C, 0x90, 0x39, 0x2A, 0x86, 0xB1, 0x4C, 0xFF, 0xBC, 0x93, 0x7E,
-    0xB7, 0x7A, 0xC8, 0xEB, 0x58, 0x4E, 0xE8, 0x3B, 0xF1, 0xD3, 0x03, 0x43, 0xCF, 0x4E, 0x9F, 0x6B,
-    0x3C, 0x26, 0xFA, 0x8F, 0xBD, 0x6A, 0xCD, 0x77, 0x5E, 0x7B, 0x54, 0xBB, 0x5E, 0xFD, 0xCF, 0x56,
-    0x5B, 0x1F, 0x4E, 0x89, 0xC6, 0x4E, 0xD2, 0x97, 0xAE, 0x9F, 0x57, 0x46, 0x49, 0x7F, 0xC6, 0x01,
-    0xEE, 0x06, 0x83, 0x6D, 0x7C, 0x5E, 0x12, 0xD2, 0xF7, 0x9B, 0xA8, 0x49, 0x9D, 0x4F, 0x7B, 0x8F,
-    0x0C, 0x68, 0x29, 0x1D, 0xD6, 0xA2, 0x40, 0xE2, 0x2C, 0x31, 0x62, 0xB8, 0x55, 0x1E, 0x86, 0x81,
-    0x9A, 0x9D, 0x93, 0x0C, 0x72, 0x9D, 0xC2, 0x9A, 0x1C, 0x79, 0x8F, 0x11, 0x67, 0x6D, 0xA1, 0xE2,
-    0x69, 0xE7, 0x54, 0xF2, 0xE7, 0x1C, 0xAA, 0xEB, 0xB7, 0x32, 0x45, 0xCF, 0x3B, 0x5D, 0x35, 0x2A,
-    0xE0, 0xAB, 0x4F, 0x80, 0x73, 0xD1, 0xF5, 0xA8, 0xD1, 0x16, 0x66, 0x0A, 0xF9, 0x84, 0xDA, 0xBF,
-    0x2F, 0xB0, 0x35, 0x38, 0xAB, 0x17, 0xDB, 0x05, 0xB5, 0xD4, 0x4D, 0x64, 0x68, 0xB8, 0x23, 0x54,
-    0x87, 0x9E, 0x45, 0x86, 0x8D, 0x03, 0x10, 0xAA, 0x9B, 0x65, 0x59, 0xB3, 0x8E, 0x55, 0xD2, 0x2D,
-    0xFD, 0xAA, 0xB5, 0x84, 0xB6, 0xD6, 0x9A, 0x05, 0x39, 0x96, 0x82, 0xF7, 0x5E, 0xB0, 0x65, 0x12,
-    0x8D, 0x9C, 0x22, 0x7F, 0x93, 0x86, 0x6C, 0x5C, 0xA4, 0x97, 0x9C, 0x5D, 0x8F, 0x1E, 0x68, 0x26,
-    0xFA, 0x14, 0x50, 0x71, 0x20, 0x96, 0x09, 0x8C, 0xB0, 0xF0, 0xC7, 0xFB, 0xE4, 0x63, 0x84, 0x8A,
-    0x64, 0xF7, 0x74, 0xAE, 0x29, 0x12, 0x18, 0xA3, 0x80, 0x51, 0xFD, 0x96, 0x5D, 0x6F, 0x84, 0x5D,
-    0x44, 0x10, 0xA6, 0x88, 0x8C, 0x8E, 0x22, 0x27, 0x82, 0x25, 0x4F, 0x6B, 0x9A, 0x6D, 0x34, 0x99,
-    0x17, 0xF0, 0xD2, 0xB0, 0x42, 0xAF, 0x36, 0xAE, 0x2B, 0x4B, 0xDD, 0x2E, 0x38, 0x1F, 0x99, 0x16,
-    0xCC, 0x46, 0x43, 0xA6, 0x89, 0xCA, 0x02, 0x6B, 0xF0, 0xCD, 0xE1, 0x27, 0xEB, 0x9D, 0xCE, 0x8D,
-    0xE4, 0xCE, 0x6F, 0x3A, 0xA9, 0x17, 0xD6, 0xAA, 0x95, 0xB4, 0x6F, 0x48, 0x4C, 0xB4, 0xEC, 0x26,
-    0x7D, 0x43, 0x8A, 0x43, 0xFB, 0x86, 0x5C, 0x3A, 0xD8, 0x37, 0x44, 0x0C, 0x9D, 0x47, 0x33, 0x59,
-    0x81, 0x21, 0x41, 0xDF, 0x90, 0xB7, 0x7B, 0xF6, 0xE3, 0x7A, 0x05, 0x66, 0xA6, 0x41, 0xDF, 0x90,
-    0x69, 0x00, 0xEF, 0x3F, 0x5A, 0xAF, 0xE0, 0xB7, 0x6E, 0x65, 0xE4, 0x9F, 0x5D, 0xF9, 0x60, 0xBF,
-    0xEF, 0x6C, 0x86, 0xA0, 0xDE, 0x6D, 0xF4, 0xB0, 0xFD, 0xD0, 0x45, 0x0F, 0xE9, 0x48, 0xB1, 0x89,
-    0x5A, 0xA1, 0x62, 0x2D, 0x3E, 0xE0, 0x9D, 0xFA, 0x9B, 0x41, 0xC4, 0x4F, 0x5A, 0x93, 0x38, 0xFA,
-    0x07, 0x33, 0xAB, 0x21, 0x2B, 0xD2, 0xAD, 0xA7, 0x71, 0xF4, 0xD9, 0xB9, 0xE0, 0xE4, 0x38, 0xEC,
-    0xED, 0x5D, 0x0D, 0x1E, 0xE6, 0x20, 0x01, 0x63, 0x87, 0xCC, 0x17, 0x65, 0xE8, 0x10, 0xB1, 0x06,
-    0xDC, 0xBA, 0xAA, 0xC5, 0x0C, 0x59, 0xD2, 0xD9, 0xF8, 0x57, 0xCF, 0x3C, 0x59, 0x33, 0x1A, 0x15,
-    0xF2, 0x49, 0x8B, 0x75, 0x15, 0x18, 0x4A, 0x35, 0xC4, 0xC5, 0xD0, 0x84, 0x08, 0x9E, 0xF3, 0x4B,
-    0xBA, 0xE7, 0x30, 0xBB, 0x3D, 0x70, 0x38, 0x7F, 0x8F, 0x95, 0x96, 0x3B, 0xB5, 0xF5, 0x94, 0x52,
-    0x8C, 0x2A, 0xBC, 0xEC, 0x7C, 0x34, 0xE3, 0xBD, 0x07, 0x3A, 0xF7, 0xC7, 0x36, 0x8C, 0x1B, 0xCD,
-    0xF1, 0xDF, 0x6E, 0x93, 0x84, 0xDE, 0xC1, 0x78, 0xF0, 0xB0, 0x86, 0x27, 0xDC, 0xF1, 0x78, 0xEF,
-    0x0F, 0x0B, 0x11, 0x8A, 0xFD, 0xC3, 0xAB, 0x78, 0xEF, 0xC0, 0xF4, 0xE2, 0xA7, 0x3B, 0xD9, 0x6E,
-    0xBC, 0x25, 0x64, 0xBA, 0xDA, 0x57, 0x83, 0xBD, 0x5D, 0xC7, 0x1C, 0x8A, 0xA6, 0x9A, 0x0D, 0x9D,
-    0xF7, 0x1F, 0x29, 0xF8, 0xCD, 0xBB, 0xA7, 0xB2, 0x34, 0x9C, 0xC1, 0xF7, 0xE5, 0xDB, 0x71, 0xCD,
-    0x28, 0x56, 0x11, 0x62, 0x11, 0x1C, 0xA5, 0xCB, 0xE7, 0xF9, 0xFC, 0xF1, 0xA5, 0xE5, 0x44, 0x8A,
-    0xA1, 0xE6, 0xF4, 0xB9, 0xF6, 0x20, 0x6A, 0xB5, 0xFA, 0x07, 0x6B, 0x38, 0x68, 0xF9, 0x63, 0x5C,
-    0x13, 0x27, 0x70, 0x07, 0x97, 0x7D, 0x77, 0x64, 0xD0, 0xA5, 0x11, 0x29, 0x6D, 0x61, 0x82, 0x7C,
-    0xF1, 0xFF, 0xA6, 0xC5, 0xF5, 0x67, 0xAB, 0x72, 0xDA, 0xA6, 0x33, 0x77, 0xB9, 0xCB, 0x2E, 0x21,
-    0x5A, 0xC1, 0x27, 0x5A, 0x35, 0xDE, 0xAA, 0xDD, 0xE3, 0x87, 0xA5, 0x59, 0x7E, 0xF8, 0xBE, 0x34,
-    0xCB, 0x3F, 0x35, 0x37, 0xCB, 0x6F, 0xE7, 0x66, 0xF9, 0x33, 0x9C, 0x36, 0x8B, 0xBC, 0xA5, 0x72,
-    0x63, 0x95, 0xA7, 0x39, 0x3A, 0x9B, 0x5B, 0x67, 0xD5, 0xE0, 0x74, 0xD6, 0x57, 0x24, 0xE4, 0x07,
-    0xD8, 0x6E, 0xEA, 0x7E, 0x6D, 0x37, 0xF5, 0x39, 0xDB, 0x6E, 0x6A, 0x47, 0xDB, 0x4D, 0xBD, 0xA6,
-    0xED, 0xA6, 0xDE, 0x66, 0xBB, 0xA9, 0x69, 0xD0, 0x76, 0x53, 0xE7, 0x36, 0xE0, 0xC4, 0x38, 0x5B,
-    0x07, 0x15, 0x83, 0x6A, 0x03, 0x5A, 0xAC, 0x37, 0xEA, 0xF1, 0x78, 0x67, 0xD7, 0x60, 0x5D, 0x28,
-    0xCD, 0xE8, 0x26, 0xD9, 0xE8, 0x0E, 0x7E, 0x18, 0xEE, 0x6B, 0xB3, 0xEE, 0xF4, 0xC0, 0x1D, 0xD8,
-    0xAC, 0x3B, 0xF4, 0x00, 0xEF, 0x22, 0x08, 0xE3, 0x84, 0xE9, 0x56, 0xB5, 0xAF, 0x77, 0xFF, 0x09,
-    0x6C, 0x2A, 0x46, 0xA7, 0xC6, 0x78, 0xB3, 0xCA, 0x45, 0xB8, 0xE1, 0x11, 0x6E, 0x90, 0xD8, 0xA6,
-    0x2D, 0x84, 0xB3, 0xEE, 0xD2, 0xCD, 0xF9, 0x8E, 0xB6, 0xE4, 0xEE, 0x6C, 0xC5, 0x81, 0x3A, 0x3A,
-    0xBB, 0x16, 0xA7, 0xB7, 0x81, 0xED, 0xCC, 0x5A, 0x56, 0xB1, 0xE6, 0x7D, 0xCD, 0xC6, 0x92, 0xB5,
-    0xE9, 0xC0, 0x38, 0x5E, 0xAF, 0x32, 0xC2, 0xCA, 0xFE, 0x52, 0xF3, 0x44, 0xF2, 0xED, 0xED, 0x9D,
-    0x86, 0x92, 0xC4, 0xB7, 0xA9, 0x0D, 0x7A, 0xEB, 0x37, 0x2B, 0x90, 0x58, 0xF7, 0xD1, 0x6A, 0xC0,
-    0x61, 0x54, 0xFF, 0x9F, 0x29, 0x86, 0xE6, 0x5B, 0x9A, 0x0B, 0x5B, 0xAF, 0xFB, 0x26, 0xE2, 0xDD,
-    0xD5, 0xA8, 0xD7, 0x7A, 0x1E, 0x82, 0xF8, 0x12, 0xCE, 0xB4, 0x6B, 0xEF, 0x33, 0xA0, 0xED, 0x47,
-    0x8E, 0x1E, 0xE8, 0x61, 0xB4, 0x87, 0xFB, 0x17, 0x99, 0x7E, 0xD0, 0x3A, 0x48, 0x1F, 0x1D, 0x27,
-    0x51, 0x2E, 0xA7, 0x1D, 0x58, 0x5C, 0x86, 0xFA, 0x99, 0xE3, 0x9F, 0xD2, 0xF9, 0xAE, 0xA0, 0x66,
-    0x1B, 0x0D, 0xC8, 0x84, 0x10, 0x40, 0x38, 0xD6, 0xFA, 0x5B, 0x6F, 0x15, 0x8F, 0x75, 0xDE, 0x3B,
-    0xF5, 0x7F, 0x37, 0xFE, 0xDB, 0xDD, 0x90, 0x9A, 0x2E, 0x1F, 0xD0, 0x63, 0x67, 0x74, 0x0C, 0xEC,
-    0xD0, 0xB9, 0xA2, 0xD6, 0x7D, 0xC6, 0xC3, 0x00, 0xF4, 0xCE, 0xCC, 0x32, 0xA4, 0x47, 0x68, 0x62,
-    0xE7, 0x55, 0xA9, 0xE6, 0x66, 0x54, 0x38, 0x37, 0x7D, 0x58, 0x21, 0x64, 0x15, 0x96, 0x6D, 0xEA,
-    0xEE, 0x59, 0xBD, 0x66, 0xF7, 0xE9, 0xA8, 0x1C, 0x72, 0x4E, 0x85, 0x72, 0xAA, 0xE4, 0x49, 0x1E,
-    0xB5, 0xF9, 0x42, 0x9A, 0x9E, 0x56, 0xC7, 0x6A, 0x1D, 0x6B, 0xE3, 0x5D, 0xBD, 0x3B, 0x94, 0xDB,
-    0xAB, 0x85, 0x6B, 0x5D, 0x84, 0x3D, 0xF5, 0xCF, 0x53, 0x63, 0x7B, 0xD2, 0xD9, 0x3B, 0x0E, 0xB0,
-    0x0C, 0xC0, 0xF6, 0x21, 0xB7, 0x37, 0x54, 0x00, 0x8D, 0x81, 0x5A, 0x0D, 0x0A, 0x5D, 0x0F, 0x1A,
-    0x01, 0xE1, 0xAF, 0xF6, 0x51, 0xBE, 0x26, 0x62, 0xF2, 0x67, 0x6A, 0x44, 0x74, 0x4B, 0xA2, 0x37,
-    0x2C, 0xFF, 0x06, 0x41, 0x24, 0x34, 0x86, 0xF1, 0xFB, 0x55, 0x8B, 0xE4, 0x83, 0x6C, 0xD9, 0x1C,
-    0xC1, 0xC5, 0xBF, 0x55, 0x29, 0xB0, 0x92, 0xD6, 0x39, 0xD2, 0x1C, 0x82, 0x41, 0xEB, 0x6E, 0x59,
-    0xF9, 0x09, 0x5A, 0xA0, 0xA4, 0x3E, 0x20, 0xB2, 0xD1, 0x6B, 0x8F, 0x66, 0xB4, 0xA6, 0xA4, 0x0E,
-    0x46, 0x95, 0x7D, 0x8A, 0x2E, 0xC9, 0x9F, 0xEB, 0xEF, 0xC9, 0xB3, 0xE4, 0x5C, 0x18, 0xB7, 0x69,
-    0xFC, 0xF8, 0x4B, 0xC6, 0x3C, 0x86, 0x5A, 0xAD, 0x47, 0x4C, 0x1D, 0x4D, 0x98, 0xC3, 0xD2, 0x9F,
-    0x50, 0xEF, 0x7B, 0x35, 0xE7, 0x2D, 0x35, 0xEA, 0x09, 0xD9, 0x91, 0x07, 0xE6, 0x3B, 0x5F, 0x53,
-    0x40, 0x53, 0xD6, 0x82, 0xE6, 0xAF, 0x7F, 0xBD, 0xD5, 0xE4, 0x30, 0x54, 0xDA, 0xB1, 0xC0, 0xC6,
-    0xED, 0xE7, 0xDB, 0xAA, 0x0C, 0x33, 0x82, 0x3F, 0xD8, 0x1E, 0x3B, 0xCE, 0xEE, 0x12, 0x7E, 0x9A,
-    0x2D, 0xFD, 0xDC, 0x31, 0x17, 0xAD, 0xEF, 0x91, 0x2A, 0xD8, 0x21, 0xD6, 0x9B, 0xDA, 0x29, 0x49,
-    0x16, 0xCE, 0x71, 0x31, 0xBB, 0xE7, 0x23, 0x63, 0x6D, 0xC7, 0xE8, 0x55, 0xBD, 0x25, 0x19, 0xE8,
-    0x00, 0x45, 0x4E, 0xFC, 0x06, 0x14, 0x60, 0x99, 0x1E, 0xAC, 0x18, 0xDD, 0x2C, 0x13, 0x0C, 0x04,
-    0x7B, 0x93, 0xD4, 0xDC, 0x09, 0x46, 0xED, 0xDE, 0x5D, 0x44, 0xA6, 0xA3, 0xE5, 0x55, 0x07, 0x66,
-    0x70, 0xE6, 0xEC, 0xAC, 0xFB, 0x1A, 0x67, 0x0B, 0x00, 0xF5, 0x14, 0xEA, 0x6D, 0x91, 0xD1, 0xBE,
-    0x20, 0x6D, 0xE2, 0xD1, 0xC5, 0xED, 0xAF, 0xE5, 0x64, 0x83, 0xA7, 0x4A, 0x96, 0xF7, 0x1A, 0xF5,
-    0x7B, 0x18, 0x2E, 0x19, 0x6E, 0x3A, 0x29, 0x23, 0x2F, 0xE1, 0x9F, 0x95, 0x21, 0x5B, 0xA4, 0xB2,
-    0x0F, 0x40, 0x46, 0x9D, 0x98, 0x02, 0x1A, 0xE3, 0xFD, 0x19, 0x89, 0x8B, 0x69, 0x37, 0x81, 0x3C,
-    0x3B, 0x27, 0xA2, 0xB7, 0xCD, 0x5F, 0xEC, 0xCB, 0x2C, 0x6E, 0x44, 0xD3, 0x20, 0x47, 0x23, 0x31,
-    0x15, 0x2A, 0x04, 0xA3, 0x89, 0x32, 0x0A, 0xC5, 0xAF, 0xA7, 0x6F, 0x10, 0x71, 0x3F, 0x70, 0xFE,
-    0x88, 0x9C, 0xFA, 0x30, 0x05, 0xE4, 0x30, 0x4B, 0x37, 0xBD, 0xB7, 0xB6, 0xF6, 0xD7, 0xBB, 0xE1,
-    0x0E, 0xA5, 0x77, 0xC3, 0x4D, 0xDA, 0xAD, 0xCC, 0x72, 0x0B, 0x99, 0xA1, 0xAC, 0x30, 0x16, 0xB7,
-    0x76, 0xB1, 0xEA, 0x2C, 0xAA, 0xA7, 0x6D, 0xBE, 0x81, 0x99, 0xBC, 0xBF, 0xFD, 0x64, 0x9C, 0x3F,
-    0x7C, 0x4E, 0x01, 0x88, 0xD9, 0xDE, 0x8B, 0xAF, 0xBA, 0x6A, 0x49, 0x94, 0x15, 0x9A, 0x16, 0x98,
-    0xEC, 0x9E, 0xCD, 0xDB, 0x7A, 0x28, 0x8F, 0x26, 0xAB, 0x14, 0x10, 0xF5, 0x9D, 0x83, 0xEE, 0x13,
-    0xDB, 0xDB, 0xDB, 0x65, 0xC5, 0x2C, 0x40, 0x46, 0xF3, 0x06, 0x6D, 0xCA, 0x4D, 0x5D, 0xA9, 0xED,
-    0xDC, 0xB5, 0x69, 0x71, 0x8E, 0xF3, 0xB1, 0x05, 0x00, 0xDC, 0x52, 0xD7, 0xB0, 0x30, 0x48, 0xEC,
-    0xD3, 0x7D, 0x6B, 0x79, 0xD6, 0xB6, 0x6A, 0x61, 0xEE, 0x32, 0xC4, 0xC2, 0x02, 0xE4, 0xC3, 0xF4,
-    0x41, 0x1F, 0x0C, 0x61, 0xE5, 0x8E, 0x47, 0xD5, 0x70, 0x9B, 0x74, 0x60, 0x5B, 0x36, 0x56, 0x7D,
-    0x79, 0x0C, 0xE4, 0xB4, 0x71, 0xC3, 0x0E, 0x17, 0xE8, 0x75, 0xD1, 0x8C, 0xEC, 0x63, 0x53, 0x66,
-    0xE5, 0x63, 0xB2, 0x3C, 0x2C, 0xD0, 0xC9, 0xEC, 0x49, 0xEF, 0x95, 0xFF, 0xC4, 0xB5, 0x81, 0xF0,
-    0x8A, 0x7A, 0x80, 0xBC, 0x22, 0x66, 0xD8, 0x54, 0x73, 0xF7, 0xD0, 0x56, 0x25, 0x1F, 0xF2, 0x25,
-    0x52, 0xC1, 0x10, 0x57, 0x61, 0x1F, 0xB5, 0xA2, 0xCB, 0x06, 0xDB, 0xE9, 0xF9, 0xE0, 0x63, 0xEB,
-    0x02, 0x4D, 0x57, 0x54, 0xD9, 0x61, 0x25, 0x3D, 0x84, 0xD9, 0xBE, 0x4A, 0xC6, 0xF6, 0x6D, 0x37,
-    0x94, 0xFB, 0x68, 0x40, 0x37, 0x9E, 0xF9, 0xCF, 0x1D, 0xD6, 0x32, 0x40, 0xDF, 0x24, 0x91, 0xBE,
-    0xCC, 0xD9, 0xC0, 0x62, 0xA6, 0x45, 0x52, 0x87, 0x5D, 0x5E, 0xD3, 0x3B, 0xE4, 0x7D, 0xD1, 0x97,
-    0x6D, 0xFB, 0xAC, 0xF3, 0xAC, 0x75, 0xA9, 0x86, 0x59, 0xD4, 0x85, 0x43, 0xB8, 0xBC, 0xB3, 0xE6,
-    0x85, 0x38, 0x31, 0xAB, 0x3E, 0xF8, 0xCE, 0xEF, 0x10, 0xD9, 0xF7, 0x8C, 0xC8, 0xE6, 0x76, 0x62,
-    0xD4, 0xA6, 0xBC, 0xA8, 0x37, 0x2D, 0x7C, 0xE0, 0xDC, 0xCE, 0xE3, 0xEE, 0x03, 0x60, 0xC9, 0x63,
-    0x64, 0xAF, 0x00, 0x9C, 0x45, 0xF6, 0xF2, 0x1B, 0xFF, 0x46, 0x7E, 0x42, 0x2A, 0x60, 0xCC, 0x0C,
-    0x54, 0xD6, 0xB8, 0x7E, 0x7B, 0xAB, 0x63, 0xC9, 0x94, 0x1A, 0x6E, 0x74, 0x81, 0x58, 0x52, 0x6C,
-    0x6B, 0xA6, 0x14, 0x86, 0xAC, 0xD5, 0x86, 0xF1, 0xB5, 0x0F, 0xFB, 0xB8, 0xDC, 0xCA, 0x18, 0x75,
-    0x0D, 0x5A, 0xF8, 0x12, 0xAD, 0x3D, 0xA1, 0x6C, 0xAA, 0x3D, 0x67, 0xDB, 0x45, 0x88, 0x1D, 0x87,
-    0xDC, 0x31, 0xD6, 0x4D, 0xB1, 0x7C, 0xF7, 0x28, 0x81, 0xC9, 0x55, 0xC4, 0x01, 0xC2, 0x1D, 0xB6,
-    0x0F, 0xF7, 0x66, 0x5A, 0xA4, 0x87, 0x91, 0x03, 0x3D, 0xC3, 0x13, 0x55, 0xC4, 0x15, 0x0A, 0xA8,
-    0x9C, 0x87, 0x90, 0xF9, 0xA3, 0x82, 0x0E, 0x8E, 0x09, 0xB6, 0xE8, 0xD1, 0x51, 0xBD, 0x4C, 0x45,
-    0x94, 0x58, 0x0A, 0x45, 0xF3, 0x7A, 0x70, 0x51, 0x07, 0x86, 0x32, 0x2A, 0xD9, 0x01, 0xC6, 0x41,
-    0x1D, 0x15, 0x81, 0x65, 0xCA, 0x08, 0xED, 0x1A, 0xC6, 0x80, 0x57, 0x42, 0xCD, 0xCF, 0x76, 0x21,
-    0xA2, 0xE0, 0x2E, 0xA2, 0x13, 0x21, 0x4E, 0x70, 0x89, 0x8D, 0x03, 0xD8, 0x6C, 0x36, 0x9C, 0xB3,
-    0x55, 0xAB, 0x25, 0xA0, 0xAB, 0x6F, 0x35, 0xB5, 0x45, 0xED, 0x15, 0x1A, 0x2B, 0xEE, 0x92, 0xBA,
-    0x3C, 0xA7, 0x2F, 0x04, 0xEB, 0x29, 0x7E, 0x59, 0xC4, 0xDF, 0x5F, 0x02, 0xF4, 0xA2, 0x05, 0xE8,
-    0x22, 0x01, 0xC0, 0xE1, 0xD3, 0x8E, 0x4C, 0x20, 0xB5, 0x55, 0xEF, 0xD0, 0x52, 0xCB, 0x9D, 0x01,
-    0xCE, 0x64, 0x1E, 0x35, 0x76, 0xCA, 0x82, 0x8D, 0x0E, 0xE7, 0xA3, 0xCA, 0x0E, 0x39, 0xC8, 0x1F,
-    0x38, 0xF3, 0xFD, 0x4D, 0x67, 0xB8, 0x34, 0xA9, 0x66, 0x51, 0xAB, 0xA8, 0x4D, 0xCE, 0xB0, 0x16,
-    0x4D, 0x9B, 0xCF, 0x9A, 0xB5, 0x41, 0xB7, 0x8B, 0x18, 0x56, 0xDD, 0xAE, 0x39, 0x35, 0xEA, 0x27,
-    0xA1, 0x9C, 0x4F, 0x96, 0xB9, 0xB1, 0xF7, 0x84, 0xCF, 0xE1, 0x3C, 0xE7, 0x2D, 0x98, 0xA7, 0x9F,
-    0xAB, 0xAA, 0xEF, 0xB5, 0x72, 0x4D, 0x64, 0x77, 0x66, 0xBD, 0x40, 0x7B, 0x9F, 0x22, 0x9B, 0x5A,
-    0xC2, 0x8E, 0x1A, 0x37, 0x7F, 0x7C, 0xC4, 0xEF, 0xEE, 0xF8, 0x5B, 0x4A, 0xB6, 0xB9, 0xAD, 0x46,
-    0x46, 0x47, 0x8B, 0xA3, 0x85, 0x72, 0xA6, 0x96, 0x0D, 0xFA, 0x93, 0xF5, 0x9F, 0x78, 0xAF, 0x0A,
-    0x5A, 0xDC, 0x49, 0x76, 0x0B, 0xD2, 0xFD, 0x93, 0xB8, 0xA5, 0x29, 0x9B, 0x77, 0xB2, 0x9F, 0xA1,
-    0x93, 0x34, 0x2C, 0x2D, 0xB8, 0xA9, 0x6B, 0xF6, 0x5B, 0xA1, 0xA2, 0xFB, 0x8C, 0xFB, 0x0C, 0xCB,
-    0x25, 0xA1, 0x84, 0xD5, 0x58, 0x73, 0x0C, 0xF7, 0x49, 0x58, 0x47, 0xF5, 0x4D, 0x46, 0x7A, 0x37,
-    0xDE, 0x09, 0x71, 0xA5, 0x2B, 0xBC, 0xC9, 0x67, 0x6B, 0xA3, 0xE1, 0x16, 0x7E, 0x32, 0x1A, 0x97,
-    0x33, 0xC2, 0xC0, 0xDE, 0x9B, 0x65, 0x91, 0xD6, 0xEC, 0x5C, 0xCE, 0xAE, 0x18, 0x11, 0xBA, 0x76,
-    0xA3, 0xC7, 0x44, 0x4B, 0x28, 0x05, 0xF1, 0x8B, 0x96, 0x77, 0xEF, 0x86, 0x83, 0x82, 0x10, 0x5C,
-    0x0C, 0x0B, 0x33, 0x2D, 0x78, 0xE7, 0x23, 0x31, 0xA5, 0x26, 0xEB, 0x60, 0xA3, 0x92, 0x3E, 0xD2,
-    0xAC, 0xA5, 0x7E, 0x05, 0x1B, 0xFD, 0xAE, 0x91, 0xD2, 0xA1, 0x8D, 0x94, 0x7E, 0x23, 0xCE, 0xBC,
-    0xCB, 0x56, 0x53, 0x21, 0x0C, 0x70, 0x26, 0xE4, 0x84, 0x3F, 0xF1, 0xF6, 0x3B, 0x37, 0xE3, 0xCC,
-    0xCF, 0xCE, 0x9C, 0x19, 0x2B, 0x67, 0xC6, 0x0D, 0xD7, 0x1E, 0xFD, 0x4F, 0xD0, 0x19, 0xC9, 0xEF,
-    0x60, 0x53, 0x76, 0x5C, 0x7C, 0xA8, 0x7A, 0x3E, 0xB5, 0x6C, 0x36, 0x89, 0xD5, 0x5F, 0x63, 0x4F,
-    0x22, 0x3A, 0x5C, 0xFE, 0xF8, 0xEA, 0x56, 0x3B, 0x3B, 0x60, 0xE3, 0x92, 0xCC, 0xF1, 0xC7, 0xF2,
-    0x9F, 0x72, 0xBB, 0x6B, 0x90, 0x59, 0x9C, 0xB4, 0xB0, 0x3D, 0x7B, 0xF7, 0x30, 0x25, 0xF4, 0xA1,
-    0xBD, 0x25, 0x92, 0x46, 0x9D, 0xE0, 0xBE, 0x88, 0x07, 0xEA, 0x0F, 0x2C, 0x40, 0xC8, 0x7F, 0x9D,
-    0x81, 0xE8, 0xED, 0xCB, 0x7C, 0x1F, 0x86, 0xBE, 0xCF, 0xE6, 0xFB, 0x15, 0xA9, 0x0E, 0xF2, 0x59,
-    0xEB, 0x97, 0xB1, 0x23, 0xE5, 0x91, 0x53, 0xF9, 0x6C, 0xDD, 0xEE, 0x39, 0xC8, 0xA9, 0x7B, 0x58,
-    0x73, 0x10, 0x4A, 0x70, 0x73, 0xCD, 0x5E, 0xC0, 0xE1, 0x62, 0x20, 0x3A, 0x7F, 0xB2, 0xBD, 0xAD,
-    0xDA, 0x7C, 0x58, 0xD9, 0x38, 0x9A, 0x01, 0x78, 0xC8, 0xC3, 0xA5, 0x62, 0x3C, 0x9D, 0xD0, 0x21,
-    0x6B, 0x4B, 0xB6, 0x33, 0xCE, 0x92, 0xCE, 0xDE, 0x5E, 0x8B, 0xFA, 0x49, 0xB1, 0x5C, 0x2C, 0xD1,
-    0x1E, 0xF5, 0x91, 0xBD, 0x6F, 0x11, 0x8C, 0xAF, 0x84, 0xAD, 0xFF, 0x00, 0x13, 0xB1, 0x5E, 0x95,
-    0x3E, 0xB7, 0xDF, 0xD3, 0x2F, 0x0C, 0x5B, 0xCD, 0xEF, 0x7C, 0x51, 0x2D, 0x35, 0x36, 0xEA, 0x72,
-    0xF6, 0x2E, 0xA9, 0xBD, 0x55, 0xAF, 0x21, 0xA0, 0x36, 0x90, 0xA7, 0xEA, 0x5B, 0x29, 0x7E, 0x41,
-    0xAB, 0x09, 0x7F, 0xAA, 0x56, 0xAB, 0x2A, 0xB8, 0xD2, 0x66, 0xA3, 0x17, 0xEB, 0xB5, 0xCA, 0x73,
-    0x63, 0x1F, 0xCD, 0x64, 0x0D, 0x6F, 0xBC, 0xBD, 0xF7, 0x5D, 0xDA, 0xCA, 0xD0, 0xC2, 0x1A, 0xD8,
-    0x0D, 0xEA, 0x73, 0xD2, 0xE9, 0x4E, 0x6B, 0x56, 0x2A, 0x9D, 0x3B, 0x1C, 0xDA, 0xB8, 0xEB, 0x6F,
-    0x6B, 0x3A, 0xA7, 0x81, 0x69, 0xBD, 0x0B, 0x04, 0x40, 0xDC, 0xA6, 0x4C, 0x3A, 0x4F, 0x3E, 0x32,
-    0x64, 0x05, 0x5A, 0xA8, 0x0D, 0x90, 0x12, 0xFA, 0x7D, 0xDA, 0xFA, 0xBA, 0x46, 0x15, 0x45, 0x3C,
-    0x86, 0x8C, 0x48, 0x16, 0x25, 0xE3, 0xE2, 0x94, 0xF2, 0x9F, 0x07, 0x70, 0xBA, 0xF9, 0x40, 0x45,
-    0xF0, 0x99, 0x33, 0x21, 0x9B, 0x6B, 0x0C, 0x09, 0xCB, 0x65, 0xEB, 0x50, 0x6B, 0x4C, 0x79, 0x2B,
-    0xD1, 0x05, 0xD5, 0x17, 0x55, 0xB6, 0x6A, 0xF7, 0xA7, 0x7D, 0x86, 0x31, 0xDC, 0xF3, 0x8E, 0x7A,
-    0x19, 0x74, 0x3A, 0xB8, 0xE9, 0x26, 0xCD, 0x2B, 0x18, 0x6C, 0x52, 0xAD, 0xC2, 0x02, 0xAF, 0x68,
-    0xE4, 0x61, 0x47, 0x21, 0x8A, 0x6E, 0x6D, 0xEF, 0x59, 0x4C, 0xC8, 0x02, 0x2E, 0x84, 0x06, 0x3E,
-    0x13, 0x58, 0x4C, 0xC1, 0x59, 0xFC, 0x36, 0xED, 0xC3, 0xB4, 0x34, 0x65, 0x58, 0xF5, 0xCB, 0xFB,
-    0x18, 0xA4, 0xB2, 0x13, 0x33, 0xFA, 0x9D, 0x3E, 0xC5, 0xE9, 0xD3, 0xBE, 0x1D, 0xA1, 0x74, 0x83,
-    0x3E, 0xE1, 0x9D, 0xA1, 0xD9, 0xD8, 0x27, 0x3B, 0xCB, 0xBC, 0xC5, 0xFB, 0xEF, 0xF2, 0x7D, 0xFC,
-    0xC7, 0xBA, 0x73, 0x69, 0xD7, 0xC3, 0xB2, 0x0F, 0x14, 0x4B, 0x1B, 0x9C, 0xFE, 0x70, 0x1F, 0xF3,
-    0x6E, 0xB9, 0x8B, 0xEA, 0x8C, 0x5E, 0x8D, 0x0A, 0x9B, 0x88, 0xCE, 0x4E, 0x6B, 0xBB, 0x7B, 0x0F,
-    0xB5, 0x96, 0x32, 0xE7, 0x04, 0x32, 0x2F, 0x92, 0x17, 0x0D, 0x79, 0x91, 0x59, 0x00, 0xCC, 0xB2,
-    0x60, 0x02, 0xC6, 0xF2, 0x0F, 0x34, 0x6C, 0x65, 0x35, 0x57, 0x3C, 0x68, 0x9F, 0x1C, 0xCD, 0x03,
-    0x38, 0xBA, 0xBF, 0xD6, 0x96, 0x98, 0xA1, 0xDF, 0x09, 0x79, 0x8B, 0x28, 0xDB, 0x66, 0x77, 0x3B,
-    0x1B, 0xE7, 0x24, 0x05, 0x8E, 0xDC, 0xB9, 0xB6, 0x5F, 0xB6, 0xFC, 0xD1, 0x52, 0xBD, 0x75, 0xDE,
-    0x7B, 0xDB, 0xAF, 0xCB, 0x9A, 0x5F, 0x3C, 0x97, 0x47, 0x2E, 0xEB, 0x3A, 0xAE, 0x92, 0x55, 0x54,
-    0xF9, 0x69, 0x45, 0x89, 0xA2, 0x74, 0x1A, 0xB9, 0x76, 0x8B, 0x9B, 0xB7, 0x09, 0xFB, 0x75, 0x77,
-    0x8C, 0xFB, 0x8C, 0x6C, 0x88, 0xD6, 0xA0, 0x49, 0xF9, 0xC5, 0xC1, 0x37, 0x53, 0xEB, 0x9B, 0x9F,
-    0x54, 0xCE, 0xA9, 0xC4, 0x96, 0xEF, 0xB4, 0xCA, 0xCA, 0xB6, 0x3F, 0xF8, 0xAA, 0x5D, 0x13, 0xED,
-    0x31, 0x67, 0x31, 0x5D, 0x89, 0x9B, 0xD9, 0x56, 0x16, 0xE1, 0x30, 0x37, 0xEE, 0x39, 0xDC, 0x3C,
-    0x3B, 0xE8, 0x75, 0xFF, 0x13, 0xBF, 0xB7, 0xE8, 0xFC, 0x88, 0x2B, 0xCA, 0x5A, 0xD5, 0xE7, 0x81,
-    0xEA, 0x73, 0x51, 0x6C, 0xC5, 0xAD, 0x96, 0xEF, 0x28, 0x7C, 0x92, 0xE3, 0x6C, 0xC5, 0xE2, 0xF5,
-    0xCC, 0xC2, 0xE5, 0xED, 0x51, 0x18, 0x9D, 0x63, 0x35, 0x28, 0xE9, 0x1F, 0xB2, 0x6D, 0x38, 0x3B,
-    0x89, 0x1F, 0xC1, 0x12, 0x45, 0x6F, 0x19, 0x34, 0x15, 0x47, 0x6C, 0x0E, 0x90, 0xF5, 0x23, 0x46,
-    0x5B, 0x8D, 0x8F, 0x7A, 0x7F, 0x8D, 0x9E, 0x37, 0x57, 0x81, 0x6D, 0x0E, 0xC4, 0x5D, 0x76, 0x12,
-    0xEE, 0xB7, 0x11, 0x36, 0x62, 0xAC, 0x89, 0xD4, 0x7D, 0xB2, 0xC2, 0xF8, 0x0C, 0xDA, 0x70, 0x89,
-    0x55, 0x59, 0xA1, 0x27, 0x51, 0xA8, 0x77, 0x62, 0xBA, 0x83, 0x5B, 0xEA, 0x4E, 0x77, 0xD2, 0x83,
-    0x44, 0x2A, 0xED, 0xA2, 0x6B, 0xAF, 0x0F, 0x95, 0xCE, 0x1A, 0x8A, 0x67, 0x42, 0xC8, 0x1F, 0x53,
-    0x31, 0xA9, 0x60, 0x4E, 0x39, 0x92, 0x7B, 0x8B, 0xF7, 0xDE, 0x79, 0x0F, 0x0A, 0xF6, 0x2F, 0xD9,
-    0x79, 0xEF, 0x8A, 0x79, 0x5A, 0x16, 0x43, 0x5C, 0xEC, 0xDE, 0x39, 0x8D, 0xAD, 0x8A, 0x0A, 0xED,
-    0xB3, 0x4C, 0xEF, 0x3A, 0x89, 0xDB, 0x89, 0xB6, 0xB3, 0x89, 0x73, 0xD7, 0x15, 0x64, 0xE6, 0x5A,
-    0x90, 0xE9, 0x0F, 0x8A, 0x9D, 0x23, 0xE0, 0x61, 0xBA, 0x25, 0xA5, 0xCE, 0x86, 0x25, 0x96, 0x96,
-    0x09, 0xBC, 0xD2, 0x57, 0x35, 0x16, 0x13, 0xFD, 0xC3, 0x64, 0x21, 0xD5, 0xC2, 0x99, 0xBB, 0xD7,
-    0xCC, 0x29, 0xC8, 0xEF, 0xF7, 0xED, 0x98, 0x80, 0xA4, 0xA1, 0x3B, 0x82, 0xE1, 0xCD, 0x7A, 0x98,
-    0xE0, 0x71, 0x64, 0xE9, 0xB4, 0xB1, 0x56, 0x6F, 0x8E, 0x5F, 0x66, 0x30, 0x6C, 0xA3, 0x82, 0xF9,
-    0x0E, 0x1C, 0xA3, 0xE2, 0x37, 0x65, 0xF6, 0xBE, 0x52, 0xCB, 0x3D, 0x93, 0xEF, 0x9F, 0xB1, 0x21,
-    0xA9, 0x4E, 0xEB, 0x8E, 0xCD, 0x1D, 0x2C, 0x9F, 0xBD, 0xF1, 0x1E, 0xF5, 0xEF, 0x61, 0xC5, 0xDD,
-    0x6D, 0x73, 0xE5, 0x99, 0xB9, 0x83, 0x4A, 0x34, 0xDE, 0x72, 0xC5, 0x6F, 0x7A, 0x03, 0xAC, 0xFF,
-    0x0F, 0xC5, 0x57, 0x3B, 0x6F, 0xDD, 0x36, 0x14, 0x3E, 0x12, 0x6D, 0xAB, 0x88, 0x00, 0xD3, 0x83,
-    0xBD, 0x14, 0x49, 0x14, 0xA0, 0x1D, 0x52, 0xC0, 0xAE, 0x96, 0x0C, 0x19, 0x9C, 0x4B, 0x01, 0xF9,
-    0x01, 0xF5, 0x90, 0xEC, 0x1D, 0x3C, 0x05, 0xE8, 0x96, 0xC1, 0x40, 0x63, 0x4B, 0x6D, 0x97, 0x8E,
-    0xDE, 0xBA, 0x7A, 0xC8, 0xD0, 0x38, 0xCB, 0x1D, 0x32, 0x18, 0xA8, 0xED, 0x4B, 0x24, 0x43, 0x57,
-    0xFE, 0x04, 0x2D, 0xED, 0xD0, 0xA0, 0x28, 0x07, 0x01, 0x51, 0x02, 0x4A, 0xEC, 0x77, 0x28, 0x5D,
-    0xDB, 0x79, 0x0C, 0x29, 0x90, 0xA4, 0xB4, 0x29, 0x51, 0xE4, 0x79, 0xF3, 0xF0, 0x3B, 0xBC, 0x8F,
-    0x7F, 0x7B, 0xAD, 0xD1, 0xCA, 0xC2, 0xFD, 0x2B, 0xB7, 0x76, 0x64, 0x9D, 0x98, 0xAC, 0xF9, 0xFE,
-    0xEF, 0x2F, 0x7E, 0x16, 0xD5, 0x7F, 0xFD, 0x23, 0xA2, 0x45, 0xF4, 0x1D, 0xA2, 0xA8, 0x26, 0x4A,
-    0x34, 0x91, 0x8C, 0x0F, 0x0F, 0x9D, 0xF2, 0xFE, 0x59, 0x41, 0xF6, 0x06, 0xDD, 0x14, 0xC5, 0x55,
-    0xBA, 0x91, 0x54, 0xA2, 0xD8, 0xA2, 0x1B, 0x44, 0xA2, 0xA0, 0x0F, 0xF7, 0x8A, 0x68, 0xD0, 0x1E,
-    0x1B, 0xA2, 0x27, 0x44, 0xB7, 0xA0, 0x1B, 0x6B, 0xAF, 0x0E, 0x7F, 0x85, 0x76, 0x3D, 0xA5, 0xCB,
-    0xB1, 0x89, 0x74, 0x5A, 0x5C, 0xA6, 0x8D, 0x48, 0xD3, 0xD6, 0x65, 0xD0, 0xC3, 0xBA, 0x0F, 0xFA,
-    0x5A, 0x58, 0xBB, 0x5B, 0x94, 0xBE, 0xC7, 0xBF, 0xF2, 0xDD, 0xC5, 0x31, 0x1B, 0x26, 0xBD, 0xF7,
-    0x3D, 0xBA, 0xFF, 0xE3, 0x2E, 0x1A, 0xCF, 0x08, 0x3F, 0x6F, 0x7F, 0x1D, 0xA2, 0xD1, 0xBC, 0x49,
-    0xFF, 0x56, 0x7B, 0x75, 0x38, 0x6F, 0xEF, 0x47, 0xB5, 0x46, 0x6B, 0xD2, 0x64, 0xCF, 0x9A, 0xC4,
-    0x76, 0x91, 0x53, 0x45, 0xF9, 0x09, 0x3F, 0x9E, 0x1E, 0xC4, 0x07, 0xEF, 0xE7, 0x1D, 0xC7, 0xE1,
-    0x0E, 0x66, 0x36, 0xC8, 0xC5, 0x90, 0x20, 0x4D, 0xAE, 0x95, 0x2E, 0xAB, 0x52, 0x97, 0x46, 0x71,
-    0x22, 0xDD, 0x11, 0xBD, 0xF0, 0x91, 0x8F, 0xFA, 0xC8, 0xC5, 0xAD, 0xB0, 0x69, 0x2D, 0x2B, 0x45,
-    0xD7, 0x89, 0xB6, 0x45, 0x87, 0x95, 0x2E, 0x76, 0xC2, 0x09, 0xE6, 0xD3, 0x79, 0xB1, 0x4B, 0x5F,
-    0x82, 0x41, 0xDD, 0xF6, 0xB2, 0x51, 0xBA, 0x17, 0x2D, 0xCF, 0x66, 0xA0, 0x9E, 0x8C, 0x4A, 0x37,
-    0x68, 0x93, 0x5C, 0xD4, 0xC6, 0x8D, 0xB0, 0xAC, 0x08, 0x66, 0x6A, 0x28, 0xAB, 0xA0, 0xAE, 0x28,
-    0xAB, 0x59, 0x51, 0x6A, 0x5F, 0x94, 0xC6, 0x63, 0xA6, 0x2C, 0xE6, 0x76, 0x46, 0xAC, 0xA0, 0x4F,
-    0xBA, 0xD8, 0x8B, 0x2E, 0x82, 0xBA, 0xA8, 0x13, 0x0E, 0x33, 0x2D, 0xAB, 0x0C, 0x32, 0xA0, 0x20,
-    0x2F, 0x14, 0xD2, 0xEC, 0x68, 0x60, 0xD8, 0xA6, 0x03, 0xD1, 0xA5, 0xCC, 0xE3, 0xC4, 0x40, 0x1B,
-    0x0C, 0x7C, 0x93, 0x7E, 0x97, 0x8E, 0x61, 0xEC, 0xB7, 0x81, 0x45, 0x15, 0x7B, 0xC2, 0x8B, 0x5E,
-    0x36, 0xB9, 0x55, 0x7A, 0x56, 0xC0, 0xD1, 0x41, 0xFE, 0x40, 0xCD, 0x0E, 0xB0, 0x0B, 0x13, 0x7A,
-    0x30, 0x68, 0x80, 0xA2, 0xD8, 0x0D, 0x5D, 0xB4, 0xE8, 0x76, 0xEC, 0x35, 0xA9, 0x5F, 0xFE, 0x3C,
-    0x99, 0x79, 0xDF, 0xA1, 0xBB, 0x87, 0xA9, 0xDE, 0x26, 0x89, 0x00, 0x4A, 0xF8, 0x92, 0xA1, 0xE7,
-    0xAC, 0x69, 0xEC, 0x7B, 0xE8, 0xA7, 0xE8, 0x9C, 0x92, 0x10, 0x13, 0xB1, 0xB8, 0x76, 0x10, 0x47,
-    0xC1, 0xF5, 0xB4, 0x1A, 0x14, 0x50, 0xAE, 0xC7, 0x69, 0x66, 0x63, 0x35, 0x1C, 0x4C, 0xD6, 0x93,
-    0x62, 0xEB, 0x0C, 0x2B, 0xBA, 0x54, 0xB8, 0xA5, 0x82, 0xA4, 0x1E, 0x19, 0x78, 0xCF, 0x02, 0x03,
-    0xC7, 0x30, 0xB1, 0x83, 0xB2, 0xD5, 0xC4, 0xAC, 0xA6, 0x7D, 0xEF, 0x35, 0x98, 0x9C, 0x7C, 0xF9,
-    0x72, 0x56, 0x05, 0xB3, 0xE2, 0x26, 0x78, 0x3F, 0x0A, 0x2E, 0x59, 0xAF, 0x1D, 0x2D, 0xA3, 0xAD,
-    0xD8, 0xFF, 0xE0, 0xAD, 0xEF, 0x94, 0xFF, 0xC6, 0x3F, 0xF5, 0x75, 0x8E, 0xD3, 0x4C, 0x0B, 0x90,
-    0x08, 0x96, 0xB2, 0xA6, 0xC4, 0xD7, 0x54, 0xFA, 0x3A, 0xF1, 0xBE, 0x2E, 0xBD, 0xFF, 0x1D, 0x52,
-    0x4B, 0xDF, 0x25, 0x38, 0x62, 0x65, 0x47, 0x49, 0x17, 0x4E, 0x3D, 0xB7, 0xA5, 0xDB, 0x7D, 0xF9,
-    0xC2, 0x2B, 0xB3, 0x75, 0xA9, 0x88, 0x0E, 0x3C, 0xE5, 0xFF, 0xB8, 0xC8, 0xCF, 0x6C, 0xD2, 0x79,
-    0xCA, 0xEA, 0x2D, 0x5A, 0xA5, 0xA5, 0x8A, 0xE2, 0x7D, 0xA2, 0x87, 0x79, 0x4D, 0xD2, 0x52, 0xE2,
-    0x54, 0x4D, 0x79, 0x43, 0xD2, 0x95, 0x86, 0x72, 0x4B, 0xB2, 0x85, 0x33, 0x50, 0x2C, 0xED, 0x5A,
-    0x40, 0x94, 0xA8, 0xC8, 0x9E, 0x41, 0x5E, 0x9F, 0x57, 0xEF, 0x80, 0xB7, 0xEA, 0x9E, 0xDB, 0x4C,
-    0xFE, 0x3F, 0x78, 0xDB, 0xBF, 0xAE, 0x3A, 0xF1, 0x69, 0xE0, 0x8D, 0x0F, 0xDF, 0x29, 0xC5, 0xBE,
-    0x4A, 0xBF, 0xAB, 0x37, 0xD6, 0x77, 0xEE, 0xAF, 0x5F, 0xD9, 0x5A, 0x5F, 0xA4, 0x75, 0xFA, 0xC0,
-    0xFF, 0x68, 0x2B, 0x2B, 0x44, 0x9B, 0x1B, 0xF0, 0x30, 0x2D, 0x48, 0x3C, 0x85, 0xC3, 0xCD, 0x93,
-    0x7B, 0x87, 0x6E, 0x63, 0xE6, 0xDD, 0xC6, 0x94, 0xEC, 0x93, 0x29, 0xE6, 0xA6, 0x58, 0x9B, 0x82,
-    0x66, 0x0A, 0xDA, 0x29, 0x58, 0x3E, 0x56, 0x0F, 0x6D, 0x01, 0x09, 0xB8, 0xB3, 0x89, 0x4D, 0x47,
-    0xAE, 0xFC, 0xA4, 0xE9, 0x2A, 0x22, 0xBF, 0xA3, 0x0E, 0x1F, 0xED, 0x28, 0xDF, 0x63, 0xBC, 0x8C,
-    0xB9, 0x65, 0xAC, 0x2D, 0x83, 0x66, 0x19, 0xB4, 0xCB, 0xE0, 0xF8, 0x98, 0x7D, 0x6C, 0x2B, 0xE3,
-    0x7B, 0x0B, 0x7D, 0x44, 0x88, 0xAC, 0x1F, 0xCF, 0x36, 0xDA, 0xCC, 0x57, 0xC3, 0x79, 0xE4, 0x23,
-    0x8E, 0x53, 0x1A, 0x8E, 0x24, 0x92, 0xB6, 0x4E, 0xEA, 0x70, 0x68, 0x19, 0x8B, 0x35, 0xC6, 0x6A,
-    0x80, 0xBC, 0xBC, 0x00, 0x8E, 0x9C, 0x0E, 0xAC, 0x0A, 0x98, 0x12, 0xB5, 0xF3, 0x71, 0x52, 0x8B,
-    0x81, 0x15, 0x07, 0x3A, 0x35, 0xA9, 0x99, 0x8F, 0x19, 0xA3, 0xE6, 0xE3, 0xAC, 0x9A, 0xD0, 0x22,
-    0x04, 0xAD, 0x01, 0x25, 0x14, 0x90, 0xC5, 0x37, 0x28, 0x00, 0x46, 0x51, 0x07, 0x64, 0xF7, 0x8E,
-    0x32, 0x6F, 0xF3, 0xE7, 0x0D, 0xAE, 0x15, 0xFA, 0x94, 0xCA, 0xB8, 0x4D, 0x3D, 0x00, 0x4E, 0x05,
-    0x42, 0x17, 0x3D, 0x02, 0x40, 0x9D, 0x90, 0x02, 0x24, 0x30, 0x8A, 0x9C, 0xE0, 0x99, 0x43, 0xDF,
-    0x31, 0x72, 0xAE, 0x8D, 0x1A, 0x52, 0x89, 0xE1, 0xB1, 0xB0, 0xB1, 0x25, 0x95, 0x6A, 0xA6, 0x49,
-    0x0D, 0xD6, 0x27, 0x70, 0x01, 0x16, 0xE6, 0x15, 0xC6, 0xBB, 0x52, 0x47, 0x8C, 0x0E, 0x8C, 0x26,
-    0x4E, 0x6A, 0xB6, 0xD6, 0x31, 0x47, 0x23, 0x35, 0xAC, 0x85, 0xE0, 0x08, 0x05, 0x21, 0xA9, 0x33,
-    0x1D, 0x50, 0xC6, 0xCF, 0xB4, 0xE8, 0x3D, 0x62, 0x85, 0x18, 0x28, 0xC4, 0xCB, 0xB7, 0x03, 0x4C,
-    0x2E, 0x01, 0x0F, 0x3E, 0x67, 0x6C, 0xA2, 0x8B, 0xED, 0x88, 0x7A, 0xA0, 0xBF, 0x4B, 0x5A, 0x69,
-    0x65, 0x8D, 0x9A, 0x01, 0xFC, 0xBE, 0x79, 0xBE, 0x66, 0xA9, 0x8F, 0x1D, 0xAF, 0x33, 0x45, 0xA0,
-    0xB1, 0x59, 0x2D, 0x6B, 0x85, 0xEA, 0x52, 0x02, 0xEB, 0x4F, 0x41, 0xED, 0x40, 0x3F, 0xBD, 0x20,
-    0x30, 0xAE, 0x85, 0x96, 0x55, 0x90, 0x85, 0xDA, 0xE3, 0xE3, 0x6E, 0x10, 0x9E, 0x81, 0x69, 0x56,
-    0xF9, 0x20, 0x8B, 0x3F, 0x0D, 0x4B, 0xE8, 0x51, 0x19, 0xD9, 0x74, 0xC3, 0x35, 0x6E, 0x19, 0x67,
-    0xE3, 0xFE, 0x99, 0x98, 0xAF, 0x69, 0x46, 0xB3, 0x42, 0x69, 0x65, 0x64, 0x9D, 0x5A, 0xEC, 0xB3,
-    0x83, 0xAE, 0xF5, 0xF9, 0x5A, 0x86, 0xD5, 0xB2, 0x40, 0x61, 0x43, 0x89, 0x63, 0x1A, 0x36, 0x4A,
-    0xDA, 0xD4, 0x26, 0x8D, 0x68, 0x01, 0xD6, 0x0E, 0x39, 0xB2, 0x8B, 0x9D, 0x5A, 0xA7, 0x2B, 0x74,
-    0x41, 0x62, 0x36, 0xF2, 0xA9, 0xEA, 0x8C, 0x53, 0xE7, 0x26, 0x70, 0xDB, 0xC0, 0xDF, 0x0C, 0x12,
-    0x58, 0x46, 0x34, 0x48, 0x39, 0x0D, 0x72, 0x54, 0x90, 0x74, 0x96, 0x9A, 0xD5, 0x50, 0x5C, 0xC8,
-    0x23, 0xC2, 0x1D, 0x06, 0x0E, 0xA1, 0xC6, 0xFD, 0x00, 0xE4, 0x99, 0x3E, 0x21, 0x4E, 0xAC, 0x7D,
-    0x8C, 0x60, 0x87, 0xD2, 0xC2, 0x51, 0xC9, 0x0F, 0x80, 0x6D, 0xA9, 0xE1, 0x10, 0xF4, 0x73, 0x12,
-    0x1E, 0x07, 0x88, 0x0B, 0xA2, 0xB0, 0xFF, 0xD2, 0x70, 0xC2, 0xA2, 0x20, 0x29, 0x90, 0x54, 0x71,
-    0x47, 0x79, 0x1D, 0xF7, 0x94, 0x99, 0x88, 0x05, 0x52, 0x7B, 0x7E, 0x18, 0x16, 0x76, 0xF8, 0xB9,
-    0x39, 0x61, 0xAC, 0x6C, 0x65, 0x21, 0x8D, 0xA8, 0x05, 0xC7, 0xA7, 0xA2, 0x06, 0xB7, 0x0B, 0x60,
-    0x66, 0x54, 0x40, 0x72, 0x46, 0xC8, 0x25, 0x80, 0x37, 0xC3, 0x77, 0x64, 0x33, 0x66, 0x39, 0xC6,
-    0xF9, 0x49, 0x4C, 0x8E, 0x84, 0x81, 0x97, 0x26, 0x33, 0x29, 0xFB, 0x6B, 0xE2, 0x6A, 0xD2, 0xA2,
-    0xC2, 0x51, 0xCB, 0xD7, 0x08, 0x51, 0x73, 0x4D, 0x4D, 0x2B, 0x61, 0x38, 0x54, 0x84, 0x7C, 0x3B,
-    0x4E, 0xAA, 0x5B, 0x10, 0x25, 0xEB, 0x0C, 0xC2, 0x70, 0x69, 0xD6, 0xFC, 0x8E, 0x6C, 0x38, 0x8A,
-    0xC7, 0x37, 0xF8, 0xB9, 0x7E, 0x31, 0x93, 0x50, 0x67, 0xE1, 0x74, 0x47, 0xB2, 0x26, 0x4F, 0x69,
-    0x43, 0x65, 0xC5, 0x7E, 0x6B, 0xEA, 0xB9, 0x02, 0x95, 0x7C, 0x54, 0x73, 0x4E, 0x6F, 0x2C, 0xE3,
-    0xA3, 0x41, 0x66, 0xE3, 0x03, 0xE9, 0xBB, 0xC7, 0x59, 0x9D, 0x17, 0xFC, 0xA1, 0x11, 0x6A, 0x7C,
-    0x20, 0x59, 0x5B, 0xAE, 0x3D, 0xAC, 0x1C, 0xCE, 0xCC, 0x3F, 0x22, 0xCB, 0xA5, 0xF5, 0x88, 0x70,
-    0x09, 0xFF, 0x8A, 0xDE, 0x6C, 0x29, 0x4B, 0x4D, 0x10, 0x71, 0x13, 0xA3, 0x04, 0x5A, 0x84, 0x19,
-    0xFA, 0x16, 0xF9, 0xD2, 0x42, 0xAF, 0xDF, 0x21, 0xF5, 0xDA, 0x9D, 0xCC, 0xBF, 0xF0, 0xCE, 0xF7,
-    0x81, 0x2F, 0x60, 0x43, 0xA2, 0x69, 0x2C, 0xD7, 0xE1, 0xB2, 0x30, 0x1C, 0x9D, 0x61, 0x8B, 0x79,
-    0x6F, 0xE6, 0x85, 0x7B, 0x40, 0x09, 0x15, 0x7C, 0x6D, 0x02, 0x59, 0x75, 0x46, 0x96, 0x06, 0x8E,
-    0xDD, 0x40, 0x56, 0x9F, 0x93, 0x05, 0x8E, 0x2C, 0x28, 0x69, 0x07, 0x40, 0xA2, 0x80, 0x01, 0x01,
-    0xA7, 0xCE, 0xC8, 0x06, 0xC1, 0x5C, 0x7C, 0xC3, 0x85, 0x65, 0x4E, 0x16, 0xA4, 0xD1, 0xB5, 0xD7,
-    0x62, 0x0C, 0xCC, 0x4B, 0x11, 0x50, 0xC0, 0x8F, 0xF2, 0x26, 0x03, 0xF2, 0x94, 0xDE, 0x66, 0xCF,
-    0x7B, 0x2A, 0x1F, 0xB7, 0x9F, 0x21, 0x02, 0xD7, 0x98, 0x5F, 0x0D, 0x46, 0x8D, 0xAF, 0xBD, 0xE1,
-    0xD5, 0x05, 0xA3, 0xD9, 0x3D, 0x84, 0x0A, 0xFF, 0x63, 0xBA, 0x71, 0x3E, 0x22, 0x12, 0xD8, 0x29,
-    0x86, 0x52, 0xEC, 0x8D, 0xAC, 0x83, 0x25, 0x6C, 0xCC, 0xDE, 0xB9, 0x28, 0x70, 0x43, 0x65, 0x8E,
-    0xE1, 0xCC, 0x0E, 0x24, 0x9A, 0xDE, 0x6E, 0x0B, 0x83, 0x13, 0x10, 0x89, 0x5C, 0x8F, 0x00, 0x41,
-    0xB8, 0x0D, 0xC5, 0x3E, 0x4C, 0x20, 0x2F, 0x70, 0x2B, 0x19, 0xB0, 0xFC, 0xBC, 0x9D, 0xB2, 0x3F,
-    0x71, 0xC7, 0xEE, 0x08, 0xC7, 0xDE, 0x24, 0x2D, 0x3B, 0x93, 0x5A, 0xF6, 0x05, 0x59, 0x03, 0xFD,
-    0xAC, 0x4C, 0x85, 0x5D, 0xD8, 0x0B, 0xDB, 0xD2, 0xB1, 0x0A, 0xB8, 0x81, 0x8C, 0x81, 0x17, 0xB0,
-    0x0F, 0x4E, 0xA8, 0xE0, 0xC3, 0x24, 0xB8, 0xB0, 0x1B, 0x38, 0x1E, 0x04, 0x43, 0x8E, 0x83, 0xFD,
-    0x47, 0xC1, 0xFC, 0xC1, 0xFA, 0x26, 0xAC, 0xD6, 0x6F, 0x59, 0xBE, 0x12, 0xA4, 0xF2, 0x59, 0xE5,
-    0x24, 0x82, 0xD9, 0xA9, 0x63, 0xAB, 0x01, 0xA7, 0xAB, 0x7C, 0x3B, 0xBA, 0x90, 0xE2, 0x14, 0x7C,
-    0xC9, 0x38, 0x20, 0x40, 0x7D, 0x64, 0x5D, 0x25, 0x91, 0x4A, 0xB9, 0x16, 0xAF, 0x66, 0x38, 0x5B,
-    0xB4, 0x8F, 0x0B, 0x71, 0x1B, 0x12, 0xC6, 0x85, 0x9D, 0x2F, 0xC3, 0x6E, 0xB2, 0x31, 0x89, 0xE5,
-    0xCA, 0x22, 0x2C, 0x6F, 0x76, 0x12, 0x6A, 0x01, 0x9E, 0x93, 0xF0, 0x44, 0x82, 0xA0, 0x78, 0x25,
-    0xA1, 0x84, 0x21, 0x65, 0x98, 0xA2, 0x0D, 0x30, 0x82, 0x3B, 0x50, 0xE9, 0x38, 0xEB, 0x65, 0xC7,
-    0x69, 0x1F, 0x75, 0xEF, 0x08, 0x3A, 0x87, 0x41, 0xF0, 0x15, 0x8F, 0x44, 0x17, 0xA2, 0x3D, 0x04,
-    0x1C, 0x17, 0x3C, 0xA4, 0x3F, 0x9F, 0x6E, 0xBA, 0x57, 0x00, 0xF3, 0x95, 0xDF, 0xA7, 0x07, 0xF8,
-    0x6D, 0x62, 0xF2, 0x1F, 0x5B, 0x5C, 0x2E, 0x2D, 0x0E, 0x17, 0x0A, 0x03, 0x64, 0x6E, 0x9F, 0x0B,
-    0xAA, 0x64, 0xB8, 0x8B, 0x03, 0xF2, 0x45, 0x33, 0x22, 0x76, 0x31, 0xD6, 0x86, 0xDC, 0x30, 0x96,
-    0xE3, 0xE3, 0xE2, 0x3C, 0x88, 0x02, 0x8A, 0xE3, 0x5A, 0x8F, 0x5F, 0x2F, 0x19, 0x00, 0x7F, 0x97,
-    0x7F, 0xEA, 0x00, 0x94, 0xAA, 0x14, 0x78, 0xB9, 0x79, 0x26, 0xF9, 0x5F, 0x85, 0x93, 0xBF, 0x6E,
-    0xD4, 0x40, 0x10, 0xC6, 0xBF, 0xB5, 0x21, 0x46, 0xB8, 0xD8, 0x26, 0x48, 0x08, 0x0A, 0x3F, 0x40,
-    0x8A, 0x7D, 0x01, 0x82, 0x9D, 0x2A, 0x05, 0x0D, 0x1D, 0x05, 0x45, 0x1E, 0x21, 0x3D, 0x22, 0xB1,
-    0x5F, 0x01, 0x09, 0x44, 0x41, 0x43, 0x91, 0xEA, 0x1A, 0x5E, 0xE0, 0x2E, 0x76, 0x44, 0x41, 0x41,
-    0xB3, 0x48, 0x40, 0x0A, 0x9A, 0x95, 0x42, 0x45, 0xB5, 0x8A, 0x36, 0x92, 0x09, 0x7B, 0x1E, 0x66,
-    0xD7, 0xF7, 0x27, 0x22, 0x91, 0xB0, 0xBC, 0x3A, 0xDF, 0x7A, 0x66, 0x67, 0xBE, 0x6F, 0x7E, 0x06,
-    0xF8, 0x52, 0x73, 0xA4, 0xE4, 0x51, 0xBE, 0xF5, 0xA9, 0xCB, 0xAC, 0x6A, 0x64, 0xC7, 0x7F, 0x76,
-    0x0D, 0xBC, 0xAA, 0x52, 0xEB, 0x21, 0x3F, 0x5A, 0x1C, 0xCA, 0x2E, 0x71, 0x87, 0x90, 0x27, 0x1E,
-    0xB3, 0xD4, 0x66, 0x56, 0x5E, 0xB4, 0x28, 0xC8, 0xA2, 0x18, 0x00, 0x81, 0xE5, 0xA5, 0x1A, 0x24,
-    0x73, 0xFE, 0xB1, 0x48, 0xA8, 0x83, 0xAA, 0x91, 0xB8, 0x1E, 0x6A, 0x57, 0x27, 0x4E, 0x41, 0x55,
-    0x5E, 0xF4, 0xA9, 0x2D, 0xBE, 0xED, 0x7F, 0x25, 0xA2, 0x73, 0x5E, 0x0D, 0x64, 0x07, 0x3C, 0xE6,
-    0x3C, 0x07, 0x64, 0xFC, 0x28, 0xC9, 0xA1, 0xA5, 0x2E, 0x25, 0x82, 0x6C, 0x80, 0x97, 0xE0, 0xFC,
-    0xB0, 0x5B, 0x61, 0x8B, 0x17, 0x5A, 0x8E, 0x9C, 0x2F, 0xF6, 0x38, 0xBA, 0xE6, 0x24, 0x87, 0x0D,
-    0xAA, 0x42, 0x5A, 0xF9, 0x1B, 0xEB, 0x4B, 0x70, 0xF1, 0x7A, 0x80, 0xE4, 0x3D, 0xE2, 0x58, 0x03,
-    0x1C, 0x03, 0xE9, 0x9F, 0x9F, 0x50, 0xAC, 0x72, 0xFE, 0xCC, 0xA7, 0x86, 0xFB, 0xA8, 0x72, 0x7D,
-    0x00, 0x25, 0x1C, 0x3C, 0xEB, 0x31, 0xD2, 0xD4, 0x51, 0x8F, 0x1C, 0x16, 0x4A, 0x68, 0x90, 0x44,
-    0xA7, 0xBF, 0x3E, 0x9C, 0x9B, 0xC4, 0xDA, 0xC4, 0x6D, 0x8A, 0x1E, 0xF0, 0xF1, 0x9E, 0x01, 0x65,
-    0xBC, 0x55, 0x14, 0x90, 0x6B, 0xA4, 0x16, 0xE1, 0xF5, 0xA3, 0x75, 0x07, 0x09, 0x69, 0x10, 0x55,
-    0xA5, 0xF0, 0x99, 0x96, 0xDD, 0x14, 0x3E, 0xD7, 0xAA, 0x2A, 0x9F, 0x68, 0xC1, 0x25, 0x14, 0x77,
-    0xF6, 0x89, 0x9D, 0x90, 0x7A, 0x8A, 0x63, 0xD9, 0x65, 0x86, 0x2D, 0x95, 0x46, 0x75, 0x35, 0x59,
-    0xC1, 0x4A, 0xD6, 0x22, 0x4C, 0x30, 0x43, 0x9D, 0xCC, 0x43, 0x7F, 0x33, 0x94, 0x79, 0x17, 0x86,
-    0x51, 0xE6, 0x26, 0x35, 0xE5, 0x9B, 0x99, 0x20, 0xEA, 0x92, 0x49, 0x1F, 0x1B, 0x29, 0x34, 0x72,
-    0x87, 0x7C, 0x8E, 0x76, 0x40, 0xB6, 0x10, 0x20, 0xAA, 0x7B, 0xE9, 0x20, 0xDD, 0xD6, 0x19, 0x35,
-    0xDB, 0x17, 0x7D, 0xE6, 0x65, 0xD5, 0x0A, 0xCB, 0x65, 0x58, 0xAE, 0x91, 0xCD, 0x81, 0xB0, 0xF9,
-    0x89, 0xC2, 0xEC, 0xCC, 0x48, 0xBF, 0x8D, 0xF5, 0x0C, 0x95, 0x1F, 0x49, 0xF8, 0xD1, 0xA7, 0x7D,
-    0x66, 0x8B, 0xFF, 0x90, 0x70, 0x1C, 0x49, 0x70, 0x81, 0x04, 0xC7, 0x0B, 0xB8, 0x5D, 0x8D, 0xC7,
-    0xCC, 0x58, 0x7F, 0xEB, 0xC5, 0x5E, 0xC7, 0xB6, 0xA8, 0x86, 0x07, 0x56, 0x06, 0x8F, 0x0E, 0x83,
-    0x57, 0x3E, 0x78, 0xE6, 0xA1, 0x74, 0x4D, 0x9F, 0xB9, 0x52, 0x2C, 0xDA, 0x23, 0xE3, 0xC7, 0xFA,
-    0x5D, 0xC4, 0x4F, 0x72, 0xC0, 0x26, 0xC7, 0x86, 0x0C, 0x94, 0x15, 0xD2, 0xA0, 0xB1, 0x09, 0xA3,
-    0x0E, 0x13, 0xCF, 0x79, 0x98, 0xDC, 0xAE, 0xBC, 0x9C, 0xBC, 0x6F, 0x99, 0x20, 0xA2, 0x7E, 0xAC,
-    0xD8, 0x6A, 0xD4, 0xD4, 0x14, 0xDF, 0x7D, 0x62, 0x64, 0x77, 0x27, 0x8C, 0xA9, 0xA8, 0x42, 0xF0,
-    0xC3, 0x1E, 0x39, 0xD3, 0xF0, 0x62, 0x58, 0x9C, 0xC7, 0xCC, 0xD8, 0x40, 0x91, 0x68, 0x9B, 0x9A,
-    0x4C, 0xCA, 0x1E, 0x2F, 0x7B, 0x8E, 0x19, 0x91, 0x5E, 0x17, 0x01, 0x2A, 0x6A, 0x08, 0xA6, 0xB7,
-    0xD8, 0xD5, 0xA2, 0x57, 0x28, 0x9A, 0xE9, 0x48, 0xEF, 0xDE, 0xEB, 0x05, 0xBD, 0xDD, 0x8A, 0x5E,
-    0x6E, 0x21, 0xD3, 0xC0, 0xDD, 0xC9, 0xD1, 0x4D, 0xF4, 0x72, 0xE5, 0x48, 0x2F, 0xDD, 0x44, 0xAF,
-    0xA0, 0x26, 0xD2, 0xCB, 0x2F, 0x6E, 0xAD, 0x06, 0xDF, 0x32, 0xBD, 0x14, 0xC6, 0x09, 0x8A, 0x1A,
-    0xA2, 0x19, 0x97, 0x47, 0x91, 0xDE, 0xE1, 0x79, 0x7F, 0x85, 0xDE, 0x9D, 0x40, 0xAF, 0x59, 0xD2,
-    0xEB, 0x56, 0x5F, 0xE3, 0x83, 0xC9, 0x24, 0xD0, 0xCB, 0x8D, 0x9A, 0xC4, 0x59, 0xE1, 0xEE, 0x63,
-    0xA4, 0x77, 0x0A, 0x1C, 0x2C, 0xE9, 0x2D, 0x46, 0x7A, 0xCD, 0x15, 0x7A, 0xC5, 0x0A, 0xBD, 0x91,
-    0xDE, 0x9D, 0x6B, 0xF4, 0xC6, 0x12, 0xF2, 0xF4, 0x1A, 0xBD, 0xC5, 0x48, 0x2F, 0x1F, 0xF3, 0x74,
-    0x29, 0x42, 0xB3, 0x19, 0x4D, 0xF1, 0xE5, 0x5F, 0x7A, 0x75, 0x6A, 0xEA, 0x57, 0xCC, 0x07, 0x75,
-    0x1B, 0x97, 0x23, 0xBD, 0x32, 0xD2, 0x9B, 0xCD, 0xB1, 0x4F, 0x4C, 0x6F, 0x15, 0x8D, 0xF8, 0x0B,
-    0x5D, 0x53, 0x31, 0x92, 0xD4, 0x40, 0x0C, 0xEC, 0xF1, 0xD4, 0xED, 0x06, 0x0E, 0x9C, 0x00, 0x55,
-    0x14, 0x81, 0x7F, 0xC0, 0xFE, 0x00, 0xCF, 0x13, 0x2E, 0x38, 0xA2, 0x0D, 0x78, 0x01, 0x75, 0x29,
-    0xD1, 0x79, 0xEB, 0xF8, 0x00, 0x01, 0x4F, 0x20, 0xBA, 0xFB, 0x02, 0x94, 0xF7, 0x09, 0x7E, 0xC2,
-    0x04, 0x4B, 0x42, 0x82, 0x03, 0x53, 0x65, 0xAE, 0x6C, 0x8B, 0x96, 0x66, 0x7C, 0x01, 0x13, 0x74,
-    0x69, 0x25, 0xAD, 0xD4, 0x6A, 0xC9, 0x28, 0x45, 0x64, 0x46, 0x65, 0xB8, 0xEB, 0x14, 0xD1, 0x04,
-    0x37, 0x01, 0x6D, 0xC0, 0x08, 0x74, 0xC0, 0x00, 0x08, 0xD0, 0x03, 0x2B, 0xF4, 0x2D, 0x0A, 0x6E,
-    0x56, 0x2C, 0x0C, 0xBD, 0xC8, 0x62, 0xC8, 0x5F, 0xFB, 0xA7, 0x87, 0x6F, 0x40, 0x39, 0xA8, 0x3F,
-    0x61, 0x15, 0x35, 0xFD, 0xC3, 0xCF, 0x6B, 0x06, 0x45, 0xE8, 0xDA, 0x75, 0xBF, 0xBE, 0xD0, 0xD5,
-    0x9C, 0x35, 0xDA, 0x9C, 0x0C, 0x83, 0xE6, 0xC8, 0x57, 0xE2, 0x41, 0x44, 0x1D, 0x86, 0xFA, 0xAE,
-    0xAC, 0x8F, 0x90, 0x09, 0x6A, 0x6D, 0x80, 0xEE, 0x71, 0xB5, 0xF6, 0x4C, 0xF0, 0x83, 0xD2, 0x2B,
-    0x23, 0xEE, 0xD8, 0xE6, 0x8C, 0x4F, 0xFC, 0xF7, 0xFF, 0x45, 0x99, 0xF0, 0xD2, 0xCA, 0x91, 0x61,
-    0x6B, 0x0C, 0xDD, 0xF2, 0xCC, 0xDC, 0x71, 0xE8, 0x89, 0xC5, 0x95, 0x96, 0x3B, 0xFE, 0x79, 0x7F,
-    0xFD, 0xCC, 0xB9, 0x57, 0xAC, 0xAD, 0xD8, 0x41, 0x8B, 0xBD, 0x6E, 0x81, 0x57, 0x67, 0x96, 0x11,
-    0xD9, 0x30, 0x1E, 0x65, 0xC5, 0x5B, 0xC6, 0xAC, 0xCD, 0x0D, 0xB6, 0x77, 0x2B, 0x72, 0xCA, 0xA6,
-    0x66, 0x66, 0xDB, 0xFF, 0x1E, 0xDF, 0xAC, 0x5B, 0x4A, 0x87, 0x6A, 0xC8, 0x26, 0xD5, 0x69, 0x43,
-    0xB6, 0x57, 0xF8, 0x29, 0x9B, 0x75, 0xCF, 0x21, 0x4A, 0x64, 0xA5, 0xFD, 0x58, 0xA4, 0x7C, 0x8E,
-    0xD7, 0x86, 0x77, 0xA9, 0xE0, 0x44, 0xAE, 0xFB, 0x98, 0xFA, 0x04, 0xB7, 0xEC, 0xE4, 0x01, 0x87,
-    0x19, 0xFB, 0x11, 0xED, 0x67, 0xCE, 0x53, 0x4B, 0x64, 0x9B, 0xDB, 0xD8, 0xCA, 0xEC, 0xE3, 0x47,
-    0x94, 0x4F, 0x1C, 0xB4, 0x3E, 0xE1, 0x3B, 0xD9, 0xDA, 0xCC, 0xA3, 0x0A, 0x86, 0x6A, 0xA5, 0xE4,
-    0x07, 0x5B, 0xB2, 0x2D, 0x94, 0x82, 0xFA, 0x25, 0xAB, 0xD8, 0x90, 0xC5, 0x04, 0xAF, 0x6E, 0x6D,
-    0xD3, 0xC4, 0x24, 0xEB, 0x0F, 0xE3, 0xEF, 0x75, 0x1F, 0x5A, 0x81, 0x46, 0xAB, 0x14, 0x66, 0x7F,
-    0x8F, 0x3A, 0x98, 0x7A, 0xD5, 0x79, 0x1E, 0xDD, 0x50, 0x88, 0x2E, 0x79, 0xED, 0xAA, 0xCB, 0x1D,
-    0x2F, 0x83, 0x05, 0x2A, 0xE9, 0xA9, 0x46, 0xA7, 0x8B, 0x40, 0x1B, 0x0B, 0xE9, 0xF3, 0xA8, 0xDB,
-    0xF4, 0xB8, 0x0A, 0x49, 0xBE, 0x0B, 0x6C, 0x55, 0x8C, 0x37, 0xEB, 0xE3, 0x6C, 0x2C, 0xD8, 0x49,
-    0x89, 0x4C, 0x76, 0x88, 0x75, 0x50, 0x82, 0x2E, 0xEA, 0xAC, 0x49, 0xB6, 0xB4, 0x32, 0x77, 0xB3,
-    0x29, 0xBE, 0xB7, 0x8D, 0x6E, 0x6A, 0xE6, 0xE3, 0x4A, 0x97, 0x6D, 0x71, 0x77, 0xFC, 0xAB, 0xBB,
-    0xCE, 0xCA, 0x6F, 0x69, 0xB6, 0xED, 0x22, 0x57, 0x63, 0xE9, 0x17, 0x1C, 0xF4, 0xA2, 0x47, 0x40,
-    0xFE, 0x7A, 0x7F, 0xFC, 0x50, 0x34, 0x58, 0x1A, 0x42, 0xBB, 0xFD, 0x03, 0x9D, 0x54, 0xB1, 0x6E,
-    0xD4, 0x40, 0x10, 0x5D, 0x7B, 0xA5, 0x38, 0xC2, 0x20, 0x37, 0x94, 0x48, 0xA6, 0x8E, 0x84, 0xDC,
-    0xA4, 0xC5, 0x6B, 0x89, 0x6F, 0x30, 0x94, 0x69, 0x11, 0x35, 0x05, 0x4D, 0x62, 0x4B, 0xF9, 0x00,
-    0xF2, 0x07, 0xB4, 0x64, 0xAF, 0xA5, 0xF4, 0x71, 0x4B, 0xAE, 0xA0, 0xA0, 0x88, 0x25, 0x44, 0x9D,
-    0x43, 0x74, 0x34, 0x58, 0x9C, 0x25, 0x4E, 0x61, 0xEF, 0x96, 0x79, 0xBB, 0xBE, 0xE5, 0x12, 0x92,
-    0xE2, 0x58, 0x69, 0xE6, 0x56, 0x3B, 0xEB, 0xD9, 0x37, 0x6F, 0xE6, 0x1D, 0x63, 0x58, 0xC1, 0x0C,
-    0xBE, 0x82, 0x4B, 0x14, 0x39, 0xDE, 0x61, 0xAB, 0xE1, 0x44, 0x59, 0x3E, 0x95, 0x6F, 0x0C, 0xD6,
-    0x04, 0xEE, 0x67, 0x4F, 0x87, 0xF7, 0xE3, 0xD6, 0xC6, 0x0A, 0xF8, 0x25, 0xF3, 0x5F, 0xDC, 0x63,
-    0x57, 0x16, 0xA7, 0x5C, 0x29, 0x05, 0xAA, 0x25, 0x0B, 0x8C, 0x29, 0xA2, 0xF9, 0x79, 0x9B, 0x4E,
-    0xA7, 0xBD, 0xE0, 0x4A, 0x3F, 0xE0, 0x6A, 0xDF, 0xC6, 0x61, 0xD1, 0xDA, 0xDA, 0xED, 0x6C, 0xBD,
-    0xDE, 0x59, 0xE0, 0x0E, 0x12, 0xF3, 0xC8, 0x79, 0xF7, 0xE2, 0xB4, 0x2C, 0x0F, 0xCE, 0x8D, 0x5F,
-    0x5F, 0x09, 0x6F, 0xB0, 0x40, 0xEC, 0x08, 0x2E, 0x45, 0xA9, 0xD1, 0xDF, 0x52, 0xA3, 0x4D, 0xEC,
-    0xDB, 0x62, 0x59, 0xD7, 0x30, 0xD4, 0xF4, 0x88, 0xAB, 0x57, 0xE2, 0xC9, 0x07, 0x9D, 0x4C, 0x3F,
-    0x76, 0xFC, 0xD7, 0x85, 0x62, 0xC6, 0x10, 0x38, 0x7A, 0x26, 0xA1, 0xF7, 0xC2, 0xDA, 0x3E, 0x41,
-    0x68, 0xE2, 0x02, 0xD4, 0x67, 0x35, 0x27, 0x54, 0xEF, 0x19, 0x1B, 0xB3, 0x90, 0x36, 0x59, 0x11,
-    0xD1, 0x61, 0xDC, 0xA6, 0x5F, 0xCA, 0xF2, 0x59, 0x2F, 0x80, 0x5C, 0x3B, 0x8F, 0xE6, 0xF0, 0x0E,
-    0x5C, 0x27, 0x2A, 0xD0, 0xB6, 0xDA, 0xCA, 0x82, 0x4F, 0x15, 0xEF, 0x6D, 0x01, 0x9E, 0x95, 0x00,
-    0xD9, 0x91, 0x9B, 0x12, 0x4E, 0x56, 0x2C, 0xFC, 0xFD, 0xA3, 0x8E, 0xBF, 0x7D, 0x9A, 0x89, 0xE3,
-    0x33, 0x9D, 0x73, 0xD5, 0xEC, 0x72, 0xF5, 0xD0, 0xF3, 0x7F, 0x8B, 0xA1, 0x47, 0xE8, 0x15, 0x7A,
-    0x86, 0xDE, 0xA1, 0x87, 0xE8, 0x25, 0x4B, 0xFB, 0xAB, 0xFC, 0x63, 0x8F, 0x33, 0x8A, 0x85, 0xC6,
-    0xD8, 0x77, 0xB2, 0xE3, 0xB3, 0x05, 0xBE, 0xBD, 0xED, 0x1D, 0x9C, 0x03, 0x07, 0xEE, 0xE1, 0x3E,
-    0xF0, 0x01, 0xA7, 0xC5, 0x4B, 0xF9, 0xE4, 0xE8, 0xBB, 0x5C, 0xB7, 0x6D, 0x78, 0x65, 0xB9, 0x61,
-    0xE3, 0x0D, 0x6B, 0xBC, 0xED, 0x90, 0xA5, 0x75, 0x43, 0x9C, 0x34, 0x44, 0x4A, 0x43, 0x3C, 0x35,
-    0xC4, 0x58, 0x43, 0xDC, 0xE9, 0x0A, 0x1C, 0x4A, 0xF9, 0xD6, 0x32, 0xD8, 0x0F, 0x59, 0x30, 0xBF,
-    0x09, 0x66, 0xC2, 0x3D, 0x50, 0x0D, 0x83, 0x71, 0x93, 0xE5, 0xDE, 0x4E, 0x58, 0x1E, 0xF6, 0xF4,
-    0xBB, 0x24, 0x13, 0x64, 0x89, 0x7A, 0x4C, 0x3D, 0x11, 0xAE, 0x47, 0xCB, 0x3D, 0x39, 0xD2, 0x6E,
-    0xA8, 0x30, 0x5D, 0x94, 0x11, 0x6D, 0x0A, 0x3A, 0xD7, 0x6D, 0x5A, 0x7B, 0x5E, 0x68, 0x15, 0xD4,
-    0x82, 0x14, 0x36, 0x17, 0xCB, 0xD1, 0xD5, 0x1C, 0xF0, 0x72, 0xC0, 0xCA, 0x51, 0xF8, 0x0A, 0x6E,
-    0x69, 0x55, 0xF6, 0x8F, 0x2C, 0x6F, 0x90, 0x1B, 0xDB, 0xBF, 0x26, 0x60, 0x3B, 0xEA, 0x76, 0x72,
-    0x12, 0xB8, 0xF9, 0xA5, 0x94, 0xF2, 0x14, 0x54, 0x31, 0xA7, 0xDF, 0x0C, 0xA7, 0x33, 0x2B, 0x6B,
-    0x7E, 0x39, 0xA2, 0xAD, 0xFD, 0x76, 0x90, 0xB5, 0x7D, 0x26, 0x74, 0x89, 0x91, 0x4D, 0x50, 0x2C,
-    0x31, 0x48, 0x4D, 0x11, 0x43, 0x63, 0x2C, 0x3A, 0xA3, 0xD2, 0x49, 0x62, 0xF8, 0xBC, 0xD3, 0xFA,
-    0xAE, 0x48, 0xA6, 0x2E, 0x24, 0x28, 0xC9, 0x56, 0x9B, 0xF0, 0xE4, 0xB9, 0xAF, 0x20, 0x50, 0xD7,
-    0x44, 0x1C, 0x76, 0x16, 0xBA, 0xB2, 0x83, 0xB0, 0x43, 0xF8, 0xA5, 0xD3, 0xB6, 0xFD, 0xC3, 0x3A,
-    0xB2, 0xD0, 0x5F, 0x0F, 0x55, 0xAC, 0x5C, 0xA8, 0xF2, 0xD2, 0x76, 0x24, 0xEC, 0xA2, 0x6B, 0xB1,
-    0xFA, 0x3F, 0x70, 0xC1, 0xE7, 0x4E, 0xBF, 0x14, 0x55, 0x72, 0xA1, 0x4C, 0x67, 0x3A, 0x6E, 0x12,
-    0x4D, 0x02, 0x26, 0x12, 0xB2, 0x03, 0x92, 0xF0, 0x84, 0x40, 0x40, 0xAF, 0xEC, 0x8E, 0xC7, 0x1F,
-    0xD6, 0xD0, 0x76, 0xDC, 0x46, 0x56, 0xD5, 0x08, 0x8E, 0x31, 0x3F, 0x21, 0x20, 0xD6, 0xB1, 0x05,
-    0x9A, 0xA1, 0x88, 0xC5, 0x21, 0x6E, 0x1F, 0x62, 0xA2, 0x58, 0x93, 0xE2, 0xBC, 0x8F, 0xE0, 0xDB,
-    0x60, 0x25, 0xE5, 0xA4, 0xC0, 0xC8, 0x8D, 0xBD, 0xAA, 0x5B, 0xE8, 0x2B, 0x28, 0x48, 0xD1, 0x7F,
-    0x00, 0xCD, 0x59, 0x3D, 0x90, 0xE4, 0xC4, 0x15, 0x7E, 0x1A, 0xB1, 0xAB, 0x2A, 0x2B, 0x10, 0xC1,
-    0x2D, 0x01, 0x94, 0xAD, 0xD8, 0x04, 0xC8, 0xA1, 0x83, 0xDD, 0x6B, 0x95, 0x09, 0x08, 0x1C, 0x70,
-    0xE5, 0xBA, 0x39, 0x07, 0x0E, 0xEC, 0x80, 0xC4, 0x26, 0x20, 0x71, 0xE0, 0x60, 0xEF, 0xA4, 0xB2,
-    0x03, 0x82, 0x0B, 0xD8, 0x18, 0x07, 0x26, 0x84, 0xB9, 0x60, 0xD3, 0x0B, 0x96, 0x91, 0xE0, 0x82,
-    0x0B, 0x1C, 0x78, 0x8C, 0xCB, 0x26, 0x44, 0x36, 0x98, 0x80, 0x0B, 0x2C, 0xAA, 0xA6, 0x0A, 0xED,
-    0x21, 0xA9, 0xFD, 0x7D, 0xAF, 0x35, 0x23, 0xED, 0xCD, 0xF2, 0x63, 0x30, 0xD8, 0xAA, 0xDD, 0xEE,
-    0x19, 0x75, 0xF7, 0xEB, 0xEF, 0xFD, 0xF6, 0x7B, 0x3D, 0x07, 0xA9, 0x88, 0xEC, 0x3D, 0xDB, 0xA1,
-    0x9D, 0xB5, 0x49, 0x85, 0xCE, 0xE4, 0x16, 0x6D, 0x50, 0x47, 0x6B, 0x74, 0xBD, 0x64, 0xA5, 0x48,
-    0xB4, 0xF2, 0x5B, 0x8E, 0x0B, 0x27, 0x98, 0xD4, 0xB3, 0x1C, 0x97, 0xC8, 0x5A, 0xDB, 0x8B, 0x14,
-    0xE8, 0x4A, 0xF1, 0xED, 0xE2, 0x0E, 0xE6, 0x24, 0x2B, 0x8C, 0x0B, 0x26, 0x60, 0x5C, 0xA2, 0x5A,
-    0x96, 0xA0, 0x51, 0xE4, 0x11, 0x68, 0xF8, 0xAD, 0xD7, 0x90, 0x7A, 0x89, 0x71, 0xF1, 0x7A, 0x1F,
-    0xE3, 0x98, 0xF0, 0xA6, 0x70, 0xC2, 0xF3, 0x18, 0x17, 0xFF, 0x9C, 0xE3, 0x62, 0xB8, 0x3B, 0x28,
-    0x70, 0x5C, 0x22, 0xE2, 0xC2, 0x04, 0x8E, 0x2B, 0x49, 0x3C, 0x8F, 0x6B, 0xBB, 0x87, 0xFF, 0xA7,
-    0xEC, 0x4A, 0x66, 0x16, 0x33, 0xE3, 0xBF, 0x66, 0x95, 0xFC, 0x5A, 0xCC, 0x4A, 0x37, 0xE0, 0x02,
-    0x92, 0xE0, 0x5A, 0x9F, 0x4C, 0x44, 0x40, 0x7D, 0xDD, 0xE4, 0x92, 0x01, 0x2E, 0x40, 0x37, 0x62,
-    0xD3, 0xA2, 0xC2, 0xCB, 0x2C, 0x07, 0xFC, 0x1E, 0x64, 0xFD, 0x35, 0x46, 0xA3, 0xB7, 0x80, 0x3F,
-    0x0B, 0x6B, 0xF0, 0xC9, 0x6F, 0x2B, 0x8C, 0x19, 0xBF, 0xC1, 0x37, 0xCC, 0x8C, 0x4A, 0xBC, 0x5A,
-    0x0A, 0xD9, 0x9A, 0x75, 0x92, 0xA5, 0x7E, 0xFF, 0xB3, 0xB5, 0x04, 0xD6, 0xA6, 0x68, 0x28, 0xB3,
-    0x6B, 0xF8, 0x3F, 0x98, 0xCF, 0xE7, 0x3E, 0x64, 0xD1, 0x1A, 0x34, 0x7F, 0x81, 0x38, 0xB8, 0x3F,
-    0xE4, 0x21, 0xB3, 0xCF, 0xFB, 0x10, 0xDB, 0x45, 0xF1, 0x0E, 0x16, 0x74, 0x09, 0x9A, 0x2F, 0x9A,
-    0xBC, 0xFD, 0x90, 0x61, 0xF2, 0xBB, 0x5C, 0xC5, 0x0F, 0xB9, 0x0A, 0x44, 0x1E, 0x13, 0xD9, 0x5F,
-    0x9E, 0xC8, 0x91, 0x6A, 0x24, 0xED, 0x09, 0xCF, 0x7E, 0xD2, 0x48, 0xD2, 0xCF, 0x5F, 0x02, 0xC6,
-    0xA2, 0x82, 0xA8, 0x72, 0x6A, 0x4E, 0x6C, 0x49, 0x6D, 0xFA, 0x76, 0x15, 0x42, 0x38, 0xA1, 0xAD,
-    0xA1, 0x26, 0x49, 0xEE, 0xAF, 0x63, 0x50, 0x2E, 0xFC, 0x26, 0x29, 0xC1, 0xB2, 0x76, 0x61, 0x0D,
-    0x49, 0x94, 0x12, 0x97, 0x2A, 0x90, 0x4C, 0xE5, 0xE2, 0xB5, 0xDA, 0x05, 0x6B, 0xE8, 0xD3, 0xE4,
-    0x58, 0xC2, 0x99, 0xD0, 0xA8, 0xBF, 0x8E, 0x4B, 0xC0, 0x0B, 0xEB, 0xE8, 0xFD, 0x35, 0xF5, 0x1A,
-    0x91, 0x97, 0x64, 0x15, 0x10, 0x5C, 0x56, 0xCE, 0x2C, 0x35, 0xCA, 0x2D, 0x25, 0xEE, 0xA0, 0x82,
-    0xFE, 0x55, 0xBB, 0x16, 0x73, 0x5B, 0x0D, 0xA7, 0x00, 0xDC, 0x73, 0x91, 0x43, 0xF1, 0x7E, 0x99,
-    0xCA, 0xF8, 0x78, 0xAF, 0xB1, 0x4D, 0x4A, 0xB5, 0x05, 0x0E, 0x44, 0x6A, 0x17, 0xA6, 0xA5, 0xA1,
-    0x7E, 0x4A, 0x4B, 0x89, 0xFE, 0x44, 0x7B, 0xB8, 0x45, 0x81, 0xF8, 0x35, 0x00, 0x02, 0x28, 0xA7,
-    0xBC, 0x49, 0x31, 0xF9, 0x35, 0x34, 0x27, 0x49, 0x4E, 0xD6, 0x3A, 0xCA, 0x0C, 0x4A, 0x06, 0x2B,
-    0x49, 0x0E, 0x15, 0x4A, 0x0B, 0xF3, 0x93, 0xB0, 0x02, 0x07, 0xB4, 0xD5, 0x68, 0x0D, 0x9E, 0x24,
-    0xA6, 0x3D, 0xD0, 0x38, 0x29, 0x9F, 0x1F, 0xB5, 0xB4, 0xD0, 0x88, 0x84, 0xDB, 0xCC, 0x7E, 0x74,
-    0x6A, 0x3F, 0xB1, 0x7C, 0xFE, 0xA5, 0x6D, 0x49, 0x3D, 0xCF, 0xAF, 0x51, 0xF0, 0xB6, 0xD5, 0xB6,
-    0xCB, 0x3E, 0x9A, 0xCF, 0x5F, 0x6C, 0x8D, 0xCE, 0x8F, 0x6B, 0x1A, 0x1D, 0xF7, 0x0D, 0xEB, 0xB0,
-    0xA1, 0xED, 0x05, 0x24, 0x5F, 0xFA, 0x1D, 0x3D, 0x6B, 0x46, 0xA3, 0x4A, 0x09, 0x02, 0x16, 0x5A,
-    0xA4, 0xC0, 0x06, 0xE9, 0x70, 0x7F, 0x53, 0xCE, 0x08, 0xB8, 0xF2, 0xD5, 0x6D, 0x02, 0x60, 0x89,
-    0xD6, 0x04, 0x10, 0x34, 0xCE, 0x77, 0x92, 0x94, 0x6A, 0x27, 0x3A, 0xE9, 0x6F, 0xB1, 0xB5, 0x14,
-    0x84, 0x64, 0xDA, 0x9A, 0xB5, 0xCA, 0x4A, 0xDD, 0x23, 0x2E, 0x07, 0x5B, 0x10, 0x67, 0x92, 0x98,
-    0x03, 0x88, 0x50, 0x33, 0x5B, 0x30, 0xB3, 0x58, 0x78, 0xF6, 0x84, 0x8E, 0xA1, 0x9E, 0x15, 0xB9,
-    0x35, 0x2B, 0xD9, 0x38, 0x0E, 0xD1, 0x91, 0xAE, 0x73, 0x3B, 0x6D, 0xED, 0x82, 0x8F, 0xF2, 0xDE,
-    0xBB, 0x16, 0xEF, 0xE7, 0xF3, 0xEB, 0x6E, 0xD4, 0xCD, 0x34, 0xF9, 0x48, 0x21, 0xA6, 0x43, 0x48,
-    0xA8, 0xCE, 0xEC, 0xF7, 0x8E, 0xC4, 0x07, 0x0A, 0x50, 0x31, 0x04, 0xDA, 0xC2, 0x77, 0xAD, 0x2A,
-    0x34, 0xD6, 0x95, 0x64, 0x4F, 0x0E, 0xB2, 0x1D, 0xB4, 0xBD, 0xA2, 0x6D, 0x89, 0x16, 0xF2, 0x01,
-    0x5A, 0xC8, 0x87, 0x46, 0xA7, 0xDA, 0x84, 0x0A, 0xA9, 0xBF, 0x92, 0x18, 0x22, 0x1A, 0x92, 0xEA,
-    0x77, 0xB1, 0x28, 0x3E, 0xBA, 0x80, 0xD6, 0xCA, 0x5E, 0xA7, 0x68, 0xE9, 0xDE, 0xC2, 0x20, 0x64,
-    0x72, 0x86, 0x05, 0x53, 0x52, 0xD8, 0x71, 0xA5, 0xC2, 0x6E, 0x42, 0x6A, 0xAF, 0xA7, 0xB0, 0xC5,
-    0x79, 0x94, 0x99, 0xA2, 0x55, 0x54, 0xA2, 0xC1, 0x4A, 0x54, 0xE4, 0x5E, 0x3B, 0xB1, 0x55, 0x5A,
-    0xC4, 0x80, 0x99, 0xC1, 0xD0, 0xFA, 0x14, 0xF3, 0xC2, 0xC5, 0x2E, 0x0D, 0xA9, 0x83, 0x64, 0xB2,
-    0x74, 0x2A, 0xD5, 0x53, 0x44, 0x22, 0x45, 0xD8, 0xBA, 0xB6, 0x98, 0xC8, 0x7C, 0x90, 0xA7, 0xEA,
-    0x45, 0xE3, 0x30, 0x80, 0x9C, 0xA8, 0x2B, 0xE8, 0x2E, 0x4E, 0x92, 0x1E, 0x28, 0xF4, 0x50, 0x84,
-    0x42, 0xB6, 0x9D, 0xB6, 0xF0, 0xF4, 0xC5, 0xE2, 0x8E, 0xD5, 0xAD, 0xF7, 0xAD, 0xD3, 0x65, 0x39,
-    0x6A, 0x3A, 0x50, 0x5A, 0xFE, 0x94, 0x05, 0x17, 0x61, 0x7B, 0x55, 0x72, 0xAF, 0xF0, 0xAD, 0x6B,
-    0xD5, 0x78, 0x9C, 0xFE, 0xFA, 0x71, 0xE6, 0xAC, 0x1D, 0x29, 0x84, 0xEB, 0x91, 0x43, 0x0D, 0xD1,
-    0x4F, 0x59, 0xC5, 0xD0, 0x68, 0xBB, 0x62, 0x0B, 0xC5, 0xCF, 0x74, 0x67, 0x0D, 0xFE, 0x32, 0xEF,
-    0x76, 0xD0, 0x16, 0x8A, 0xD6, 0x28, 0x5A, 0xE8, 0x0F, 0x68, 0xA1, 0x04, 0xA0, 0x45, 0x0B, 0xB4,
-    0xCE, 0x4D, 0xA1, 0x28, 0x4F, 0x5B, 0x51, 0x3B, 0x00, 0xDA, 0x3B, 0xFD, 0x0E, 0xDA, 0xEC, 0x1A,
-    0xFD, 0xCA, 0x28, 0xDA, 0x44, 0x5D, 0x8B, 0x91, 0x8B, 0xA6, 0x41, 0xB4, 0xA1, 0x46, 0xBB, 0xA0,
-    0xA2, 0x97, 0xF8, 0x35, 0xD1, 0xE2, 0xE4, 0x50, 0x0C, 0xED, 0x88, 0xD6, 0xC9, 0xE2, 0x96, 0x53,
-    0x81, 0x8C, 0xEE, 0x40, 0xE4, 0x2A, 0x68, 0x87, 0x59, 0xCD, 0x0A, 0x72, 0x86, 0xA0, 0x9D, 0x5E,
-    0xEB, 0x89, 0xC5, 0x3B, 0xD9, 0x0E, 0x52, 0x85, 0xA2, 0x1E, 0x2E, 0xAC, 0x9A, 0xD2, 0xD0, 0x5E,
-    0x2E, 0xCF, 0x40, 0x5B, 0xC6, 0x0E, 0xC8, 0x61, 0xA5, 0x13, 0x53, 0x27, 0x49, 0x70, 0xF7, 0x30,
-    0x55, 0x0B, 0xC3, 0x13, 0xEB, 0x88, 0xBD, 0xEF, 0xBA, 0x55, 0xD0, 0x2F, 0x6E, 0xDC, 0x01, 0x45,
-    0x12, 0xCD, 0x72, 0x35, 0x32, 0x38, 0x1F, 0x35, 0x1D, 0x34, 0x0A, 0x04, 0x71, 0xEE, 0xFF, 0x7D,
-    0xF0, 0xA5, 0x3E, 0x97, 0xD8, 0x9E, 0x90, 0xD5, 0x8C, 0xF1, 0xB4, 0xA3, 0x71, 0x8B, 0x47, 0x6E,
-    0x53, 0x95, 0x58, 0x69, 0x9D, 0x4B, 0x41, 0xDA, 0x6D, 0xD0, 0x53, 0x79, 0x61, 0x47, 0xA5, 0x46,
-    0xCC, 0x36, 0x84, 0xED, 0xA1, 0xC4, 0x2A, 0xFA, 0x44, 0xCD, 0xD1, 0xA8, 0x32, 0x8C, 0x1A, 0x65,
-    0xB6, 0x1A, 0xB3, 0x07, 0xA7, 0x2A, 0x75, 0x09, 0xA7, 0x23, 0x1E, 0x1C, 0x0A, 0x68, 0xE3, 0x1C,
-    0x76, 0xB4, 0xE9, 0x2C, 0xDF, 0x4E, 0x23, 0xCE, 0x5F, 0xE8, 0x99, 0x52, 0x31, 0xB2, 0x45, 0x9A,
-    0x1D, 0x2D, 0x23, 0x0D, 0xF3, 0x88, 0x34, 0x8B, 0xE2, 0x9E, 0x02, 0x54, 0xF7, 0x6F, 0x22, 0x67,
-    0x4A, 0xDB, 0x87, 0xDF, 0xDF, 0xE7, 0x00, 0xF9, 0xD9, 0xA4, 0x2D, 0xA2, 0x51, 0x26, 0x24, 0x42,
-    0xCD, 0x82, 0x66, 0xEB, 0xAD, 0x37, 0x6A, 0xB3, 0xDC, 0x9A, 0x9F, 0x86, 0x45, 0x8D, 0xE8, 0x5F,
-    0xB0, 0xE4, 0xD6, 0x65, 0x4B, 0x88, 0x23, 0xB8, 0xB8, 0xC4, 0xCD, 0xEE, 0x2E, 0x2E, 0x79, 0x52,
-    0x6D, 0xFC, 0x8A, 0x1B, 0x9D, 0xAD, 0xDD, 0x22, 0x6E, 0x48, 0x5A, 0xC6, 0xBD, 0xA6, 0xFB, 0x92,
-    0x0C, 0xC3, 0x24, 0x43, 0x36, 0x5F, 0x33, 0x1C, 0x0E, 0xAF, 0x83, 0xD5, 0xB0, 0x62, 0x20, 0x3C,
-    0x10, 0xF2, 0x07, 0x42, 0xF1, 0x40, 0xE8, 0x6C, 0x24, 0xB4, 0x9F, 0xBB, 0x23, 0xFE, 0x98, 0x70,
-    0x09, 0xB4, 0x94, 0xEF, 0x7A, 0x75, 0x18, 0x55, 0xC7, 0xF1, 0xDF, 0xED, 0x1F, 0x92, 0x75, 0x48,
-    0x39, 0x26, 0x9A, 0x60, 0xE5, 0x88, 0xAD, 0xBD, 0x24, 0x9F, 0xBE, 0xB7, 0x36, 0x7F, 0xAE, 0x8B,
-    0x97, 0xF3, 0xE3, 0xA0, 0x4C, 0x63, 0xA4, 0x81, 0x58, 0x22, 0x5E, 0x3D, 0xD0, 0x78, 0x1A, 0xA1,
-    0xBF, 0x87, 0x67, 0xD6, 0x4B, 0xC1, 0x31, 0x19, 0xBD, 0x97, 0xFB, 0x9F, 0xAC, 0xA4, 0x6B, 0xC4,
-    0x18, 0x89, 0x6F, 0x23, 0x39, 0x01, 0xB9, 0x10, 0x94, 0x70, 0x30, 0x26, 0xB7, 0x3B, 0xFB, 0xA0,
-    0x33, 0x43, 0xD6, 0xF4, 0xFA, 0x18, 0x0A, 0x87, 0xD0, 0xD6, 0x8C, 0xB9, 0x66, 0xE8, 0x92, 0xD0,
-    0x6A, 0xAB, 0xB4, 0xE1, 0x78, 0x1D, 0xC2, 0xF3, 0xE4, 0xA8, 0x5C, 0x0E, 0x1E, 0x7D, 0x70, 0x9D,
-    0xC4, 0x80, 0x64, 0xC6, 0x20, 0xC8, 0xF4, 0xB3, 0xB0, 0xCA, 0x6F, 0x96, 0x92, 0xA4, 0xC9, 0x29,
-    0x40, 0x53, 0xAA, 0xAC, 0xCA, 0x58, 0x53, 0x6B, 0x04, 0x3D, 0x6C, 0x61, 0x74, 0x3B, 0xA3, 0x31,
-    0x7A, 0xA9, 0x30, 0x5C, 0x4A, 0xDE, 0xAA, 0x91, 0x2A, 0x26, 0xAB, 0x1A, 0x2C, 0x14, 0x53, 0x56,
-    0x8D, 0x07, 0x84, 0x99, 0x20, 0xDB, 0x1B, 0x0C, 0xEF, 0x85, 0xC0, 0xA6, 0xE1, 0x2A, 0xB3, 0x79,
-    0xF1, 0xEC, 0x79, 0xF1, 0x72, 0x95, 0xA4, 0xE6, 0x26, 0x74, 0x65, 0x2A, 0x68, 0x24, 0x83, 0x0D,
-    0x43, 0x41, 0x57, 0x71, 0xE8, 0x01, 0x70, 0xD7, 0x78, 0xF6, 0xF4, 0xED, 0xCE, 0xB7, 0xED, 0xAC,
-    0x43, 0x82, 0xE8, 0xAC, 0x64, 0x08, 0x7A, 0x1E, 0x13, 0xC6, 0x3C, 0xB4, 0x50, 0x46, 0x1D, 0x7F,
-    0xD8, 0x26, 0xBF, 0x6F, 0x8C, 0x98, 0x33, 0x69, 0xAF, 0x32, 0x52, 0x9D, 0x1D, 0xD1, 0x18, 0x8E,
-    0x6F, 0x52, 0x48, 0x67, 0x78, 0xB3, 0x96, 0x33, 0x23, 0x37, 0x3B, 0xAF, 0x49, 0x1E, 0x34, 0xE6,
-    0x01, 0x12, 0xC0, 0x0A, 0x39, 0xE0, 0xCC, 0xA6, 0x33, 0x3B, 0x50, 0xBB, 0x32, 0x11, 0xD4, 0xFF,
-    0xB6, 0x2D, 0xE8, 0x8D, 0xD7, 0x0B, 0x77, 0xEA, 0x4E, 0xDA, 0xC9, 0x91, 0xFE, 0x3D, 0x19, 0x6D,
-    0x41, 0x5C, 0x86, 0xED, 0xCE, 0x39, 0x17, 0xA9, 0x5D, 0xAC, 0x18, 0xE4, 0xEF, 0x02, 0xBF, 0x37,
-    0xBC, 0x2A, 0xC7, 0x33, 0x7B, 0xD6, 0x4F, 0xAA, 0x17, 0x0D, 0xEE, 0x43, 0xDA, 0xB5, 0xA1, 0x58,
-    0x4F, 0x29, 0xA6, 0x9F, 0x45, 0xF1, 0x9F, 0x84, 0xAB, 0x91, 0xC5, 0xFE, 0x63, 0x48, 0xC0, 0xB4,
-    0xAB, 0x0E, 0xA2, 0x7B, 0x75, 0x6B, 0xBE, 0x74, 0xF3, 0xF6, 0x6B, 0x07, 0xDE, 0x4F, 0xDA, 0xE8,
-    0x41, 0x6D, 0x4E, 0xCB, 0xBE, 0xF0, 0x1F, 0x7E, 0x73, 0x1F, 0x3F, 0x3C, 0x61, 0x4C, 0xF1, 0xAE,
-    0x8D, 0xB1, 0x35, 0x72, 0x11, 0xDA, 0x45, 0x54, 0x95, 0x41, 0xA6, 0xBA, 0x58, 0x6A, 0x04, 0x6A,
-    0xB5, 0x26, 0x6C, 0x69, 0xC2, 0xC8, 0x9D, 0xD9, 0xD6, 0x74, 0xBA, 0xB0, 0xD2, 0x2A, 0x72, 0xC5,
-    0x6C, 0xCD, 0x9D, 0xE5, 0x5A, 0x80, 0x0C, 0x67, 0x7C, 0xA1, 0x7F, 0x9D, 0x16, 0xA4, 0x3A, 0xC4,
-    0xCC, 0x00, 0x89, 0x36, 0xEB, 0x8F, 0x55, 0xA0, 0x09, 0x38, 0x89, 0xA0, 0x90, 0x65, 0x6A, 0xC7,
-    0x82, 0xC6, 0x55, 0x76, 0x58, 0xA3, 0x3E, 0xDB, 0x1F, 0x68, 0xEE, 0xA6, 0x49, 0x59, 0xCF, 0xF7,
-    0x5E, 0xEB, 0xE6, 0xE8, 0xFC, 0x35, 0x7D, 0x3F, 0xA8, 0x15, 0x40, 0x45, 0x3B, 0x88, 0x56, 0x04,
-    0x80, 0x19, 0xBA, 0x17, 0x01, 0x64, 0xFA, 0x57, 0x68, 0x20, 0xE8, 0x98, 0x7C, 0x7A, 0x2E, 0xD3,
-    0xD7, 0xC9, 0x1A, 0x15, 0xEB, 0x50, 0xB3, 0x0D, 0x12, 0x9C, 0x69, 0x22, 0x8F, 0x2D, 0x14, 0x80,
-    0x86, 0x8E, 0xA5, 0xC2, 0x30, 0xFD, 0xB6, 0xAE, 0x91, 0xB8, 0x1D, 0x8D, 0x27, 0x74, 0xC9, 0xC0,
-    0x39, 0x53, 0x3F, 0x9C, 0x8A, 0x33, 0xCD, 0x06, 0xB2, 0xF3, 0x1B, 0x76, 0x85, 0x71, 0xCF, 0x12,
-    0x8C, 0xDF, 0x10, 0x76, 0x72, 0x6F, 0x4D, 0xC2, 0x24, 0x16, 0xBD, 0xCB, 0x45, 0x1D, 0x73, 0x48,
-    0xA8, 0x83, 0x7C, 0xFD, 0xF7, 0x3F, 0x56, 0x14, 0xDB, 0xDE, 0x8F, 0xBF, 0x21, 0xEA, 0xEE, 0xE3,
-    0x84, 0x17, 0x4A, 0x2A, 0xBE, 0xD7, 0x6A, 0x69, 0xB5, 0x62, 0x18, 0x85, 0xEB, 0x24, 0x35, 0x32,
-    0xEC, 0xA2, 0x15, 0xA6, 0x43, 0x29, 0xF3, 0x05, 0x48, 0x61, 0xFF, 0x0D, 0xD9, 0x9C, 0x65, 0x33,
-    0x06, 0xCA, 0x88, 0xC9, 0x5C, 0xF2, 0x8E, 0x9A, 0xC7, 0x31, 0xB5, 0xF4, 0xF8, 0xE0, 0xB4, 0x63,
-    0xD3, 0x7F, 0xFB, 0x4D, 0x37, 0x1C, 0x36, 0x87, 0x54, 0x5F, 0xF1, 0xDC, 0x9A, 0xB5, 0x3A, 0xEB,
-    0x4E, 0xE5, 0xE0, 0xF5, 0x49, 0xFC, 0x71, 0x27, 0xCF, 0x90, 0xD7, 0x68, 0x1B, 0x3B, 0xAB, 0xA8,
-    0xE4, 0x6B, 0x3D, 0xFB, 0x34, 0xBC, 0x6B, 0xCC, 0x8E, 0x82, 0x96, 0x69, 0x6B, 0xD4, 0xB9, 0x96,
-    0x71, 0x27, 0x6C, 0x79, 0x7A, 0x38, 0xAF, 0x75, 0x45, 0x21, 0x0C, 0x8C, 0x7E, 0xB4, 0x99, 0xC3,
-    0xD3, 0xBC, 0xE5, 0xE9, 0xAF, 0xB7, 0x2A, 0x5F, 0xE3, 0xF1, 0x4E, 0x46, 0x3B, 0x4F, 0xA6, 0x3C,
-    0xBA, 0x52, 0x81, 0x18, 0xBF, 0xCF, 0x62, 0xBC, 0x8E, 0x5A, 0x24, 0x61, 0x57, 0x2E, 0xA1, 0x70,
-    0x05, 0x29, 0x9A, 0xA9, 0xA2, 0x06, 0xC1, 0xF3, 0xAE, 0x7C, 0xD3, 0x80, 0xBF, 0x94, 0xD0, 0x7E,
-    0x95, 0xCA, 0x0C, 0x8A, 0x3C, 0x91, 0x63, 0x84, 0xEA, 0x55, 0xF2, 0xDB, 0x06, 0x6E, 0x5B, 0x1F,
-    0xC1, 0x18, 0x1B, 0x41, 0xAA, 0xF3, 0xC2, 0x46, 0xAF, 0xF0, 0xE7, 0x1F, 0x04, 0xB0, 0xCD, 0xB0,
-    0xB4, 0x45, 0xFF, 0xDC, 0xDA, 0xA4, 0x89, 0xED, 0x67, 0x25, 0x4C, 0x39, 0x47, 0x6A, 0xB2, 0x97,
-    0xEE, 0xEC, 0xFD, 0x34, 0xEB, 0xB2, 0xDF, 0xD9, 0xCD, 0xBD, 0x92, 0xCB, 0x62, 0x77, 0x1E, 0x7F,
-    0x9C, 0xF0, 0x36, 0x17, 0x38, 0x53, 0x42, 0x92, 0xF0, 0xC3, 0xC4, 0x56, 0xE1, 0xBB, 0xD6, 0xFE,
-    0xAD, 0x5D, 0x22, 0x82, 0xDC, 0x2E, 0x03, 0x5B, 0x5D, 0x91, 0xFD, 0x0F, 0xE8, 0x27, 0x8F, 0x87,
-    0x36, 0xF5, 0x91, 0xBC, 0xA6, 0x5D, 0x76, 0x6A, 0x8B, 0x3F, 0xAE, 0x62, 0xBB, 0xFE, 0x8D, 0x24,
-    0xB4, 0xD0, 0x03, 0x77, 0xC7, 0xF6, 0xEC, 0x79, 0x2A, 0x4F, 0x38, 0xA2, 0x6F, 0x15, 0x5A, 0xCB,
-    0x3D, 0xB1, 0x78, 0x63, 0x17, 0xA1, 0xBC, 0x68, 0xFB, 0x93, 0x99, 0xA6, 0xBF, 0x3A, 0xF7, 0x1E,
-    0x6A, 0x3E, 0xEF, 0x6C, 0x3B, 0x4A, 0x73, 0x3A, 0xD2, 0x54, 0x73, 0xB1, 0x38, 0x7D, 0x83, 0x33,
-    0x5E, 0xD1, 0x22, 0x4A, 0x0B, 0xEE, 0xCA, 0x25, 0x83, 0xC8, 0xE2, 0xC8, 0x01, 0xCB, 0xE1, 0x9E,
-    0x33, 0xF2, 0xAB, 0xE2, 0x72, 0x49, 0x7F, 0x52, 0x7E, 0xCD, 0xAF, 0xDB, 0xED, 0x33, 0xDF, 0xE4,
-    0xD3, 0x93, 0x67, 0xBC, 0xA6, 0x18, 0x0B, 0xAD, 0x47, 0x9E, 0x71, 0x54, 0x27, 0x6F, 0x74, 0x52,
-    0xBA, 0xDA, 0xA1, 0x68, 0xA0, 0x2D, 0x00, 0x63, 0x84, 0x81, 0x18, 0x8A, 0xB5, 0x2B, 0x23, 0x22,
-    0x7A, 0x6E, 0xD6, 0x88, 0x0E, 0xEA, 0xA8, 0x24, 0x7C, 0xC5, 0xF1, 0xA0, 0x1B, 0xD2, 0xD7, 0x8B,
-    0x0A, 0x7B, 0x65, 0x93, 0xF6, 0x8B, 0xCB, 0x6C, 0x5D, 0x26, 0x50, 0x8C, 0x34, 0xC0, 0x96, 0x4A,
-    0x9A, 0x34, 0x66, 0xA4, 0x48, 0xB3, 0xC5, 0x97, 0x7D, 0xDE, 0x90, 0x61, 0x34, 0xEB, 0x10, 0xE2,
-    0x09, 0x89, 0x79, 0x75, 0x7A, 0x89, 0x49, 0x5C, 0xD8, 0xC1, 0x3D, 0xDC, 0xE7, 0xD8, 0x41, 0x42,
-    0xDD, 0x13, 0x80, 0x12, 0xA8, 0x4C, 0xBB, 0x73, 0xBD, 0x44, 0x00, 0x27, 0x4C, 0xA9, 0xC9, 0x10,
-    0x3A, 0x9E, 0xCB, 0x64, 0x90, 0xB0, 0x62, 0x64, 0xAD, 0x7A, 0x6D, 0xB7, 0xDB, 0xFB, 0xDA, 0x3B,
-    0x3A, 0x34, 0x2B, 0x16, 0x62, 0xBA, 0x59, 0xE9, 0xB2, 0xC5, 0xC7, 0x36, 0x76, 0xB8, 0x72, 0xCA,
-    0x26, 0x80, 0x4E, 0x36, 0xBB, 0x6F, 0xFB, 0xFD, 0xA1, 0x27, 0xD9, 0x97, 0x86, 0x3E, 0xD1, 0xDE,
-    0x25, 0x43, 0xC8, 0x6D, 0x43, 0xAB, 0x82, 0xA2, 0x88, 0xB2, 0x46, 0xA5, 0xFD, 0x48, 0xD7, 0x69,
-    0xC7, 0x1A, 0xB0, 0x70, 0x9B, 0x71, 0x4F, 0x6F, 0xB8, 0x17, 0x66, 0xD5, 0x28, 0x63, 0x3D, 0x8F,
-    0x3C, 0xBC, 0xD8, 0x3A, 0x4D, 0x51, 0x8D, 0x41, 0xE7, 0x62, 0x95, 0x3E, 0x69, 0xED, 0xA4, 0x9D,
-    0xBC, 0xD7, 0xAB, 0xD7, 0x4D, 0x95, 0xAE, 0xB5, 0x97, 0xAD, 0xA6, 0x55, 0x3A, 0xB7, 0x9A, 0xAA,
-    0xC9, 0x4C, 0xEE, 0xC6, 0x26, 0xB7, 0x46, 0xDA, 0x7A, 0x37, 0xCE, 0xE7, 0xC3, 0xBD, 0xD2, 0x70,
-    0x5B, 0xC4, 0xD5, 0x51, 0xC7, 0x82, 0x2D, 0xD6, 0x7B, 0x0F, 0x5E, 0xBA, 0xE6, 0xBC, 0x2D, 0xC2,
-    0xE1, 0x57, 0x28, 0xB1, 0x42, 0xCB, 0x2A, 0xAB, 0x07, 0x88, 0xDE, 0x60, 0xE2, 0x0D, 0x2B, 0xA9,
-    0x42, 0x23, 0x5B, 0x96, 0xD3, 0x89, 0xCC, 0x8A, 0x75, 0x5B, 0xBC, 0xA6, 0x63, 0x85, 0xFD, 0xF3,
-    0xEE, 0x86, 0x83, 0xBB, 0xB8, 0x9B, 0x2C, 0xAF, 0x70, 0x37, 0x59, 0x8F, 0x62, 0x1A, 0x6A, 0x1F,
-    0x77, 0x79, 0x51, 0xEF, 0xFA, 0x4C, 0x3C, 0xA9, 0x75, 0xCC, 0xE4, 0x7E, 0xE4, 0x4D, 0x95, 0x76,
-    0x3B, 0x95, 0x76, 0xB7, 0x95, 0x76, 0x50, 0x15, 0x5A, 0x2C, 0x52, 0xDA, 0xEE, 0xFE, 0x25, 0x2E,
-    0x29, 0x6D, 0x54, 0x94, 0xBD, 0x92, 0xB1, 0x9B, 0x76, 0xB9, 0x61, 0xA8, 0x1F, 0x5A, 0x20, 0x81,
-    0xB4, 0x81, 0x24, 0xD0, 0x1B, 0x9F, 0x98, 0x77, 0x40, 0x97, 0x4B, 0x7B, 0x17, 0x53, 0x37, 0x61,
-    0xAB, 0x99, 0x32, 0xB1, 0xC7, 0x70, 0x71, 0x41, 0xE6, 0x0F, 0xB7, 0x37, 0x74, 0xEE, 0xD0, 0xD9,
-    0xBD, 0xA1, 0x2B, 0x76, 0x0C, 0xE2, 0xB3, 0x6E, 0xE8, 0xE2, 0xE1, 0x86, 0x2E, 0xDD, 0xB9, 0xA1,
-    0x2B, 0x2E, 0x0D, 0x44, 0x3A, 0x68, 0xA7, 0x2D, 0x6F, 0x94, 0x2F, 0xDA, 0x2D, 0xE0, 0x9D, 0x4E,
-    0x6F, 0x97, 0xBE, 0xA2, 0xDD, 0xB6, 0x3B, 0x76, 0xBB, 0xFA, 0x3C, 0xBB, 0xBD, 0x10, 0x28, 0x9B,
-    0x69, 0xEB, 0x7E, 0x5C, 0x20, 0xFB, 0xFC, 0xCD, 0x07, 0x06, 0xB6, 0xA4, 0x3F, 0x99, 0x5C, 0x33,
-    0x99, 0x56, 0x0E, 0x61, 0x58, 0xD0, 0xD6, 0x21, 0xB4, 0x8D, 0x70, 0x7A, 0x88, 0xC8, 0x8E, 0xB0,
-    0x75, 0x88, 0xC0, 0x9E, 0xF0, 0x7E, 0x46, 0x9A, 0x23, 0xED, 0x8E, 0x8F, 0xB5, 0x3B, 0x3A, 0xD3,
-    0xEE, 0x2A, 0xBA, 0x9B, 0xE8, 0x8A, 0x69, 0x51, 0xD3, 0x8F, 0x63, 0xEC, 0x86, 0x05, 0x6E, 0xF9,
-    0xD9, 0x40, 0x6C, 0x20, 0x3D, 0x6C, 0x34, 0x6C, 0x0B, 0xE5, 0x13, 0x04, 0x54, 0x72, 0x48, 0x7E,
-    0x07, 0x80, 0x03, 0x5C, 0xF1, 0x16, 0xCA, 0xE6, 0x23, 0x3C, 0xCC, 0x1D, 0x0F, 0xE2, 0x78, 0x10,
-    0xC7, 0x83, 0x38, 0x1E, 0xC4, 0xF1, 0x20, 0x8E, 0x07, 0x71, 0x3C, 0x88, 0xE3, 0x41, 0x1C, 0x0F,
-    0xE2, 0x70, 0xCA, 0x65, 0x3C, 0x4C, 0xC6, 0x86, 0x05, 0x6E, 0xF9, 0xD9, 0x40, 0x6C, 0x20, 0x3D,
-    0x6C, 0x34, 0x6C, 0xAB, 0x06, 0xAC, 0x3C, 0x88, 0xE3, 0x61, 0xF1, 0x9F, 0xF3, 0x60, 0x9C, 0x91,
-    0x64, 0x65, 0xA8, 0x3F, 0xBA, 0x54, 0x11, 0x22, 0x41, 0xF0, 0x71, 0x9D, 0xD0, 0x97, 0x4A, 0xF0,
-    0xD0, 0x62, 0x03, 0xF0, 0x60, 0xE0, 0xF7, 0xE0, 0x21, 0xBA, 0x5F, 0xCB, 0xD5, 0xBB, 0x88, 0xEF,
-    0xA5, 0x3C, 0x73, 0x57, 0x0D, 0x08, 0x1D, 0x0B, 0xCF, 0x67, 0xCE, 0x60, 0xD0, 0x25, 0x79, 0x88,
-    0xEF, 0xD5, 0xE4, 0x21, 0xC3, 0xCA, 0xA3, 0x23, 0xAC, 0x32, 0x72, 0x9C, 0xF0, 0xD7, 0xBF, 0xB2,
-    0x89, 0x7E, 0x5E, 0x8A, 0xFF, 0x71, 0x1D, 0xEA, 0x8F, 0x4A, 0x95, 0x6E, 0x6B, 0xA6, 0x3C, 0xEC,
-    0x7F, 0x55, 0x1E, 0x06, 0x3D, 0x18, 0xA7, 0x07, 0xAB, 0x7A, 0xC0, 0x46, 0x89, 0x0A, 0xA9, 0x71,
-    0xD9, 0x84, 0xEA, 0x41, 0x79, 0xE0, 0x64, 0xCA, 0x3A, 0x72, 0x3C, 0x18, 0xE5, 0x81, 0x74, 0xC0,
-    0x03, 0xE9, 0x60, 0x8C, 0xB5, 0x17, 0x78, 0x30, 0x4E, 0x0F, 0xDC, 0xE2, 0x38, 0xD1, 0x2D, 0x1A,
-    0x8A, 0x87, 0x7A, 0xB0, 0x4E, 0x0F, 0xED, 0x97, 0xD7, 0xC3, 0xDE, 0x18, 0x37, 0xB5, 0xA8, 0xFB,
-    0x36, 0x3F, 0xEE, 0xCD, 0x7F, 0xDA, 0xCD, 0xE7, 0xF6, 0x91, 0xA7, 0x7E, 0xF2, 0xB9, 0xD6, 0xBE,
-    0xD7, 0x65, 0xE5, 0xB5, 0xEF, 0x40, 0x96, 0x27, 0xE2, 0xBD, 0x66, 0x5C, 0x00, 0x65, 0xD6, 0x8A,
-    0x0C, 0x5B, 0xF3, 0x56, 0xED, 0xC1, 0x18, 0xEA, 0xF2, 0xA0, 0xD9, 0x73, 0xD9, 0x76, 0xFA, 0x6F,
-    0x4D, 0x90, 0xB1, 0x11, 0x83, 0x30, 0x10, 0x04, 0x0F, 0x12, 0x02, 0x02, 0x27, 0xCE, 0x95, 0x3A,
-    0xA3, 0x04, 0xA8, 0xC2, 0xDD, 0x78, 0xAC, 0x2E, 0x5C, 0x83, 0x9B, 0x30, 0x94, 0x80, 0x3B, 0x50,
-    0xEE, 0xC4, 0x01, 0x01, 0x01, 0xD2, 0xF9, 0x4F, 0x82, 0x19, 0x2B, 0x78, 0xED, 0xCC, 0xAF, 0x4E,
-    0xD2, 0x03, 0x7F, 0xEB, 0x72, 0xC0, 0x6B, 0xDF, 0x6B, 0xFA, 0x02, 0x2D, 0x43, 0x81, 0x8E, 0xEB,
-    0xAE, 0x5C, 0x53, 0x51, 0x02, 0xBA, 0x2C, 0xB5, 0x13, 0x9A, 0x2C, 0x75, 0x13, 0xAA, 0x2C, 0x8D,
-    0xEF, 0x67, 0x4E, 0xAA, 0x49, 0xCE, 0xBD, 0x57, 0x0A, 0xF9, 0xED, 0x82, 0x52, 0xC8, 0xD5, 0x99,
-    0x34, 0x1A, 0x6C, 0xA7, 0x94, 0x15, 0x03, 0x7A, 0x29, 0x5C, 0x1C, 0x83, 0x94, 0x34, 0x38, 0xAE,
-    0x77, 0x03, 0x8F, 0x9E, 0xD1, 0x51, 0x77, 0x5B, 0xB7, 0x11, 0x58, 0x99, 0x2B, 0x81, 0x45, 0x0C,
-    0xB8, 0x73, 0xB3, 0x93, 0x11, 0x70, 0x4A, 0xE1, 0x02, 0xEB, 0x47, 0x83, 0x19, 0xA8, 0x98, 0x9C,
-    0x14, 0x40, 0x49, 0x51, 0x0F, 0x73, 0xFC, 0x48, 0x91, 0x04, 0x29, 0x26, 0x25, 0x64, 0xC5, 0x24,
-    0xC4, 0xF2, 0x41, 0xF7, 0x58, 0x0A, 0x34, 0x45, 0x51, 0xD2, 0xB0, 0xCF, 0xE5, 0x76, 0x0C, 0xEA,
-    0xAC, 0xF2, 0x03,
+static const uint8_t bookerly_18_italicBitmaps[42869] = {
+    0xDD, 0x9C, 0x3F, 0xCC, 0x27, 0xC7, 0x79, 0xDF, 0x3F, 0xB3, 0xC3, 0xBB, 0x4D, 0xBC, 0x70, 0x86,
+    0x01, 0x48, 0x25, 0x12, 0x63, 0xAF, 0x9A, 0x00, 0xB6, 0x20, 0x79, 0x5D, 0xA4, 0x48, 0x21, 0xDE,
+    0x0C, 0x6D, 0xC0, 0x2E, 0x54, 0xE8, 0x02, 0xDC, 0x2B, 0x03, 0x54, 0xA1, 0x34, 0x01, 0x02, 0x3B,
+    0xC8, 0xB5, 0x2A, 0xC8, 0x77, 0xC7, 0x76, 0xE1, 0xC2, 0x05, 0xAF, 0xB0, 0x93, 0x42, 0x45, 0x58,
+    0xB0, 0x30, 0x5F, 0x17, 0x74, 0x00, 0x17, 0x02, 0x72, 0xEF, 0xBB, 0xA3, 0xB0, 0x50, 0x91, 0xC2,
+    0x4B, 0x2B, 0x81, 0x0B, 0x15, 0xDA, 0xC8, 0xB4, 0x0D, 0x53, 0x05, 0xC7, 0xF4, 0xDA, 0xDA, 0x23,
+    0x67, 0xF7, 0x49, 0xF1, 0xEC, 0xFE, 0xDE, 0xF7, 0x78, 0xA4, 0xE3, 0x24, 0xB0, 0x15, 0x69, 0x71,
+    0xEF, 0xBB, 0xEF, 0xCD, 0xCE, 0xCE, 0x9F, 0x67, 0x9E, 0x79, 0x9E, 0xEF, 0xF3, 0x67, 0x16, 0xE0,
+    0x8A, 0x6E, 0xB4, 0x85, 0x3E, 0x36, 0x19, 0xC1, 0x4D, 0x14, 0xDA, 0x54, 0x2D, 0x74, 0xC1, 0x66,
+    0x3C, 0x76, 0xE2, 0x65, 0xEA, 0xC4, 0x43, 0x5C, 0x64, 0xC6, 0x05, 0x26, 0xF6, 0xAB, 0x5A, 0xE8,
+    0x53, 0x53, 0x18, 0x30, 0x01, 0xC0, 0xCC, 0x4D, 0x2A, 0xCD, 0xD4, 0xDB, 0xB9, 0x0B, 0xC5, 0xA5,
+    0x73, 0x9B, 0xDB, 0xB0, 0x34, 0xE9, 0xE5, 0x2A, 0xB7, 0x2C, 0x4D, 0x7A, 0xBE, 0x1A, 0x1D, 0x37,
+    0x2F, 0xCF, 0x1D, 0xE0, 0x0E, 0xCF, 0x03, 0x2F, 0xF3, 0x12, 0xF0, 0x90, 0x87, 0x40, 0x61, 0xC1,
+    0x9C, 0x3D, 0x3A, 0x7B, 0x74, 0xCF, 0x8A, 0x88, 0x94, 0x5A, 0x44, 0x64, 0xC1, 0x66, 0x3B, 0x81,
+    0x9D, 0xEC, 0x08, 0xF5, 0x58, 0x27, 0xA8, 0x53, 0x93, 0xA0, 0x49, 0x2E, 0x82, 0x8B, 0x2E, 0xF0,
+    0x99, 0x37, 0xDE, 0x19, 0xDE, 0x89, 0x5E, 0x44, 0x24, 0x7D, 0x66, 0xB8, 0x18, 0x2E, 0x02, 0x77,
+    0xB8, 0x03, 0x3C, 0xCF, 0xCB, 0xC0, 0x4B, 0x3C, 0x04, 0x1E, 0x52, 0x80, 0x85, 0x05, 0x78, 0x95,
+    0x57, 0xAF, 0xC7, 0x63, 0x47, 0xC0, 0x64, 0x80, 0x87, 0x00, 0x77, 0x00, 0xBE, 0x12, 0xA0, 0x96,
+    0x15, 0x9C, 0xC8, 0x8C, 0x9B, 0x3F, 0x10, 0xDC, 0xF4, 0x7C, 0x37, 0xD9, 0xDC, 0xDA, 0xA5, 0x2A,
+    0x4D, 0x3A, 0x67, 0xB0, 0xD3, 0x4F, 0xD2, 0xA5, 0x19, 0xEA, 0xF2, 0x12, 0x20, 0xEF, 0x02, 0xAD,
+    0x44, 0x30, 0xB2, 0x00, 0x4E, 0x46, 0x60, 0x58, 0x01, 0x2F, 0x09, 0x9C, 0x2B, 0x84, 0x3A, 0x09,
+    0x73, 0x35, 0x75, 0xE3, 0x39, 0x73, 0x33, 0x77, 0xE9, 0xF3, 0xB6, 0x34, 0x73, 0xCB, 0x66, 0xE4,
+    0x0B, 0x51, 0xE8, 0xE4, 0x4F, 0x25, 0x54, 0x22, 0x12, 0x68, 0x64, 0x05, 0xBA, 0x00, 0xB8, 0xF8,
+    0x71, 0xA3, 0x6C, 0xC3, 0x63, 0x94, 0xE5, 0x69, 0xE0, 0x19, 0xA0, 0x05, 0x23, 0x13, 0xB8, 0x91,
+    0x4A, 0x36, 0x70, 0x13, 0xD5, 0xE2, 0x12, 0x75, 0xC6, 0x2C, 0x66, 0xC1, 0x66, 0x28, 0x9C, 0x63,
+    0x67, 0xB8, 0xC4, 0xC5, 0x6A, 0x01, 0x8F, 0x9D, 0xCC, 0x02, 0x2E, 0x99, 0x85, 0x02, 0xF5, 0xC4,
+    0x25, 0x97, 0x60, 0x16, 0x3C, 0xE7, 0xC0, 0x39, 0x6D, 0xBC, 0xC3, 0xAD, 0xE0, 0xA2, 0x4B, 0x1E,
+    0xBF, 0xDA, 0xEC, 0xC6, 0x2E, 0xF4, 0x92, 0x86, 0x37, 0xC6, 0x36, 0xF4, 0xD5, 0xD2, 0xC8, 0xE8,
+    0x92, 0xC7, 0xF3, 0xCB, 0xA1, 0x49, 0x5D, 0x70, 0x09, 0x9A, 0xD1, 0xA5, 0x2A, 0x43, 0x3D, 0xD5,
+    0x23, 0x05, 0x6C, 0xAE, 0x32, 0x1E, 0xAA, 0x99, 0x82, 0x8B, 0x54, 0x0B, 0x9E, 0x7A, 0xC4, 0x14,
+    0x5C, 0xD2, 0x51, 0xD9, 0x5C, 0xCD, 0x70, 0x09, 0xE7, 0xA6, 0xC0, 0x00, 0xEE, 0x83, 0x02, 0x3D,
+    0x20, 0x8B, 0xCE, 0xF8, 0xF6, 0x03, 0x20, 0x9E, 0x26, 0x7D, 0x5B, 0x89, 0x50, 0x89, 0x72, 0x68,
+    0xAF, 0x77, 0x3B, 0x77, 0x09, 0xC0, 0x07, 0x0F, 0xA0, 0x73, 0x82, 0x66, 0xAC, 0x47, 0x65, 0x42,
+    0x0F, 0x40, 0xA9, 0x33, 0x40, 0x9D, 0x07, 0xA8, 0x22, 0xED, 0xBB, 0x13, 0x38, 0xE8, 0x17, 0x30,
+    0x85, 0x7A, 0x83, 0x5B, 0xC3, 0xC8, 0x30, 0x53, 0xCB, 0x8A, 0xFB, 0xCE, 0x64, 0x65, 0x83, 0xD2,
+    0x25, 0x2F, 0xE0, 0xC6, 0xFE, 0x85, 0xE5, 0x21, 0x9C, 0x23, 0xD6, 0x66, 0x6C, 0x36, 0x2B, 0x2E,
+    0xE0, 0xA2, 0x2D, 0x3C, 0x84, 0x73, 0x6C, 0xB1, 0x13, 0x66, 0xA1, 0x2E, 0x1E, 0xEA, 0x4C, 0xB3,
+    0xCD, 0xE0, 0x46, 0x1A, 0x89, 0xE0, 0x27, 0xDA, 0x0D, 0xF0, 0xDB, 0x1B, 0x22, 0x01, 0x7A, 0x91,
+    0xEF, 0xC9, 0x08, 0x9D, 0x2C, 0x56, 0xB6, 0x80, 0xB9, 0x8B, 0x11, 0xD1, 0x29, 0x3E, 0x37, 0x01,
+    0x2F, 0xBB, 0x6F, 0x94, 0xEE, 0xE7, 0xB3, 0xB7, 0xD3, 0xCB, 0x75, 0x7A, 0xD8, 0x5C, 0x2F, 0xBD,
+    0x4D, 0xD0, 0x64, 0x70, 0x13, 0xB4, 0xE3, 0xFE, 0x93, 0xC0, 0x8D, 0xFA, 0xD3, 0x4C, 0x50, 0x67,
+    0xB0, 0x19, 0xAA, 0x05, 0x28, 0xC0, 0x39, 0xE0, 0x03, 0xB8, 0x04, 0xF5, 0xB4, 0x3F, 0x58, 0x01,
+    0x8F, 0x16, 0xDA, 0xBC, 0xD7, 0xF4, 0x41, 0x9B, 0xA9, 0x16, 0x74, 0x1D, 0x5C, 0x02, 0x3B, 0x1F,
+    0xFF, 0x19, 0xC1, 0x1C, 0xD5, 0x6C, 0xDE, 0x4B, 0xEB, 0x0C, 0x7C, 0xF5, 0x26, 0x6B, 0xFE, 0xDE,
+    0xDE, 0x74, 0x7D, 0x54, 0x69, 0xA6, 0xBD, 0xFD, 0xF6, 0x68, 0xEE, 0xEA, 0x66, 0xDB, 0x57, 0xFB,
+    0x93, 0xFA, 0x34, 0x8C, 0xFD, 0x69, 0x9D, 0xF7, 0x0E, 0xAF, 0xF6, 0xFD, 0x71, 0x14, 0x56, 0xF3,
+    0x5E, 0xF3, 0x6A, 0xAF, 0xDD, 0x85, 0x9D, 0x0E, 0x37, 0x68, 0x71, 0xD0, 0xA8, 0x1B, 0xC1, 0x27,
+    0x70, 0x27, 0x32, 0xDE, 0x02, 0x3B, 0x57, 0x69, 0x35, 0xE5, 0x0E, 0xFD, 0x1F, 0x50, 0xC9, 0xD7,
+    0x52, 0x23, 0x73, 0xFB, 0x7E, 0xE9, 0xFF, 0xC0, 0xB4, 0x6F, 0x8E, 0x55, 0x2A, 0xE0, 0xE1, 0xC7,
+    0x8E, 0x17, 0x2E, 0xF7, 0x1E, 0x9A, 0x71, 0xEF, 0xFA, 0x46, 0x81, 0x17, 0x91, 0x57, 0x44, 0xE4,
+    0x7F, 0x9E, 0xF5, 0xBF, 0x7D, 0xEF, 0x23, 0x6B, 0x68, 0x01, 0xC0, 0x4F, 0xE3, 0x47, 0x37, 0x9B,
+    0x95, 0x9E, 0x2E, 0xBA, 0xE4, 0xC6, 0x66, 0x72, 0x53, 0x33, 0x02, 0xCF, 0x9E, 0x85, 0x5E, 0xB6,
+    0x5E, 0x36, 0x2F, 0xEB, 0xED, 0x9F, 0x5B, 0xFB, 0x6F, 0x97, 0xFE, 0x57, 0x1F, 0xEC, 0x43, 0xD5,
+    0x59, 0x29, 0x11, 0x6D, 0x66, 0x6F, 0xCF, 0x14, 0x76, 0x1A, 0x70, 0xC5, 0x4E, 0x05, 0x95, 0x21,
+    0x6D, 0xFA, 0xDF, 0xBF, 0x72, 0xFE, 0x51, 0xAF, 0x8C, 0x28, 0x7F, 0xDC, 0x78, 0x45, 0x6B, 0xAF,
+    0x8F, 0xBF, 0xF2, 0xA9, 0x83, 0x2E, 0xCF, 0x00, 0x66, 0xD8, 0x80, 0x41, 0x56, 0xE8, 0x37, 0xC9,
+    0xB4, 0xB3, 0x91, 0x68, 0x0B, 0x75, 0x41, 0xC0, 0x8F, 0xED, 0x48, 0xB5, 0xDA, 0x05, 0xBA, 0x71,
+    0x80, 0x6A, 0x75, 0x19, 0xBA, 0xB7, 0x56, 0xA8, 0xD6, 0x2E, 0x41, 0xF7, 0x66, 0x01, 0x5B, 0xFA,
+    0x08, 0xFE, 0x9B, 0x33, 0xD4, 0xF3, 0x10, 0x60, 0x70, 0x19, 0x5C, 0x16, 0x30, 0xAB, 0xCB, 0xE0,
+    0x93, 0x04, 0x9A, 0xB9, 0x59, 0x30, 0x1B, 0x7D, 0xA2, 0x4F, 0x56, 0xE8, 0x32, 0x9D, 0x0C, 0x05,
+    0x44, 0x36, 0x30, 0xB2, 0x01, 0xDC, 0x3B, 0x71, 0x61, 0x9B, 0x68, 0x85, 0x4E, 0x16, 0x44, 0x46,
+    0xCE, 0x06, 0xA8, 0x8A, 0x32, 0x85, 0x0F, 0x98, 0x55, 0xF7, 0x91, 0x4F, 0xB0, 0x29, 0x1B, 0xB6,
+    0x09, 0x06, 0xB0, 0x7B, 0xA5, 0x3E, 0x68, 0xFD, 0xEB, 0x4A, 0xF5, 0x8C, 0x19, 0x1E, 0x05, 0x11,
+    0x69, 0x44, 0xCA, 0x31, 0x7F, 0x06, 0x09, 0x30, 0xC8, 0x06, 0xFD, 0x26, 0x33, 0xED, 0x82, 0x24,
+    0xBB, 0x52, 0x17, 0x7C, 0xC0, 0x27, 0x3B, 0x62, 0x0B, 0xFF, 0x40, 0x5B, 0xA1, 0x59, 0x00, 0x04,
+    0xC0, 0x8F, 0x40, 0x53, 0x80, 0x4A, 0x00, 0x86, 0x04, 0x74, 0x19, 0x70, 0x05, 0xB0, 0x1B, 0x60,
+    0x24, 0x9C, 0x9E, 0x4C, 0x80, 0x9B, 0x81, 0x5A, 0xDF, 0xB9, 0xB8, 0xB8, 0x88, 0xBD, 0x88, 0x2C,
+    0x8D, 0x88, 0x48, 0xF0, 0x22, 0x2A, 0x0D, 0x9F, 0x01, 0x6A, 0x59, 0xA0, 0x15, 0x49, 0xB4, 0x32,
+    0x14, 0xDA, 0xD9, 0x48, 0x68, 0x32, 0xDD, 0x68, 0x33, 0xF5, 0xCC, 0xCF, 0x52, 0xAD, 0xA7, 0x71,
+    0x0C, 0x01, 0x90, 0x00, 0x95, 0x04, 0x78, 0x4E, 0x57, 0x73, 0x04, 0x2F, 0x2B, 0xFC, 0xD8, 0x99,
+    0x8C, 0x80, 0x5B, 0x00, 0xA3, 0xC3, 0x4E, 0x40, 0x7B, 0x1A, 0x8C, 0x2B, 0x40, 0x5B, 0xC0, 0x0C,
+    0x85, 0x4F, 0xBC, 0x21, 0x45, 0xB5, 0xA8, 0x11, 0x89, 0x70, 0xEB, 0xEE, 0xBE, 0x16, 0x06, 0x94,
+    0xB2, 0x18, 0x89, 0x40, 0x3F, 0x03, 0x4E, 0x00, 0x2B, 0x19, 0xD8, 0x06, 0xC0, 0xBF, 0x32, 0x81,
+    0x9B, 0x56, 0xB0, 0x4B, 0x9B, 0x40, 0xAA, 0x02, 0x3E, 0xF9, 0x88, 0xCB, 0x76, 0xC6, 0x16, 0x3C,
+    0x08, 0x75, 0xC6, 0x27, 0x06, 0x9A, 0x8C, 0x9B, 0xAA, 0xED, 0xEC, 0x6C, 0xBB, 0xD7, 0x8B, 0x88,
+    0x7C, 0x4F, 0x44, 0x64, 0xFD, 0xCC, 0xC5, 0xC5, 0xF0, 0x4E, 0x04, 0xBB, 0x00, 0xF4, 0x01, 0x5D,
+    0x67, 0x18, 0x40, 0x17, 0x56, 0xD9, 0xD9, 0x88, 0x48, 0x60, 0x10, 0x19, 0xF1, 0x22, 0x59, 0x99,
+    0xBF, 0xC9, 0x1C, 0x6F, 0xAE, 0xEC, 0xB2, 0x8B, 0xEE, 0x6D, 0xC0, 0xC9, 0xDB, 0x50, 0x8B, 0x44,
+    0xF8, 0x92, 0x2C, 0x40, 0x2D, 0x01, 0xF0, 0xF9, 0x98, 0x17, 0xD7, 0xC4, 0x71, 0xA7, 0x42, 0xBB,
+    0x1E, 0xAB, 0x6B, 0x05, 0x78, 0x4E, 0xE0, 0x45, 0x11, 0xE8, 0x15, 0x6D, 0xBC, 0x7D, 0x93, 0x5F,
+    0x9F, 0x05, 0xCC, 0xB0, 0x80, 0x11, 0x49, 0x18, 0x79, 0x04, 0x0C, 0x0B, 0xE0, 0x97, 0x13, 0x4B,
+    0x5C, 0xF3, 0x49, 0x7B, 0xDD, 0xF1, 0x20, 0x12, 0x70, 0x22, 0x42, 0x25, 0xBF, 0x3D, 0x14, 0x7C,
+    0xA2, 0x1F, 0xED, 0x42, 0xB5, 0xD1, 0x07, 0x5C, 0x6E, 0x32, 0x08, 0x03, 0xFB, 0x9F, 0x1B, 0x03,
+    0xB4, 0x63, 0xAD, 0x04, 0x4D, 0x0C, 0xC1, 0x6E, 0x74, 0x19, 0xB7, 0xDD, 0x2F, 0xD0, 0xCB, 0x06,
+    0x0C, 0x5B, 0xD8, 0x19, 0xC9, 0x89, 0xC8, 0xE2, 0x45, 0xE4, 0x3D, 0x11, 0x91, 0x57, 0xFE, 0xE4,
+    0xEC, 0x97, 0x8A, 0x87, 0xEE, 0x1B, 0x33, 0xD5, 0xDA, 0x24, 0xDA, 0xF1, 0x27, 0x60, 0x3B, 0xE6,
+    0x2C, 0x40, 0x33, 0x03, 0x7D, 0xDC, 0x07, 0xE7, 0x13, 0xCA, 0x6A, 0xED, 0xE9, 0xF9, 0x02, 0xF4,
+    0x69, 0xA7, 0x8D, 0x16, 0x87, 0x9D, 0xA7, 0xBB, 0x71, 0xAF, 0x64, 0x17, 0xC0, 0xC4, 0x1B, 0x52,
+    0xA6, 0x92, 0x05, 0x1A, 0x91, 0x11, 0xB7, 0x7E, 0xA5, 0xE0, 0x66, 0x86, 0xD8, 0x64, 0xDC, 0x64,
+    0x17, 0xEC, 0xC2, 0x0A, 0x2B, 0x3E, 0x32, 0xE0, 0x32, 0x43, 0xA8, 0x84, 0x21, 0xE0, 0xFF, 0x4A,
+    0x02, 0x56, 0x54, 0xF1, 0x02, 0x83, 0x4C, 0x18, 0xF9, 0xC2, 0x46, 0xB5, 0xD1, 0x4F, 0x66, 0xA5,
+    0x2E, 0x6C, 0x20, 0x61, 0x80, 0x76, 0xF2, 0x89, 0x7A, 0x76, 0x99, 0xAA, 0xD8, 0x82, 0x11, 0x86,
+    0x64, 0x04, 0xB7, 0x7D, 0x4D, 0x30, 0x22, 0x1B, 0x34, 0xF2, 0x08, 0xB8, 0xA5, 0xA2, 0xEF, 0x1E,
+    0x60, 0x64, 0x05, 0x44, 0x0A, 0xF8, 0xF7, 0x87, 0x8C, 0x9B, 0x91, 0x50, 0xAD, 0xD8, 0x82, 0x8F,
+    0xF8, 0xD4, 0x64, 0xAA, 0x15, 0x81, 0x6E, 0x74, 0xA7, 0x3F, 0x93, 0xCB, 0x54, 0x05, 0x09, 0xF8,
+    0xD4, 0x14, 0xEA, 0x05, 0xFF, 0xE8, 0x45, 0x01, 0x11, 0xC9, 0x54, 0xBB, 0x58, 0xE9, 0xE3, 0x89,
+    0x8B, 0x74, 0x9B, 0x46, 0xA0, 0x9F, 0x80, 0x6E, 0x01, 0xBA, 0x15, 0xB8, 0x2F, 0x50, 0x8B, 0x04,
+    0xF0, 0x12, 0x80, 0x7F, 0xB3, 0x13, 0xAB, 0x19, 0x9B, 0xC5, 0x6E, 0x46, 0x82, 0xFF, 0x10, 0x5E,
+    0xD4, 0xEB, 0x93, 0x74, 0x63, 0x3B, 0x37, 0xC5, 0x6C, 0x7C, 0xF2, 0xA4, 0xDC, 0x2A, 0xC1, 0x6E,
+    0xD8, 0x75, 0x67, 0xFD, 0x8F, 0xBB, 0x7E, 0x1A, 0x24, 0x20, 0x81, 0x3E, 0xD0, 0xC3, 0x15, 0x14,
+    0xEC, 0x4C, 0x33, 0xE1, 0x23, 0x97, 0x37, 0x6B, 0xD6, 0x51, 0x97, 0xB6, 0x2F, 0x18, 0x99, 0xA9,
+    0x25, 0xD2, 0x6E, 0x8A, 0xB4, 0xFC, 0x04, 0x6E, 0x05, 0x86, 0x19, 0x2A, 0x19, 0xA1, 0x91, 0x00,
+    0xFD, 0x0A, 0x46, 0x66, 0xA8, 0x57, 0xC5, 0xB4, 0xC0, 0x67, 0x2E, 0x2E, 0x2E, 0xBE, 0x28, 0x22,
+    0x7F, 0x2C, 0x22, 0x4F, 0x0E, 0x4C, 0x44, 0xB6, 0x43, 0xF7, 0x2A, 0x0A, 0x8C, 0x50, 0x6D, 0x7B,
+    0xCB, 0xB5, 0x8C, 0xD0, 0x5E, 0xB7, 0x9C, 0xA1, 0x96, 0xA8, 0x1B, 0x76, 0x98, 0xA9, 0x64, 0xA4,
+    0x91, 0x40, 0xB7, 0x6A, 0xAF, 0xC3, 0xA8, 0xF0, 0xC0, 0x1C, 0xAD, 0x0F, 0x13, 0x22, 0xA1, 0x97,
+    0xDC, 0x7E, 0x6F, 0xAB, 0x68, 0xD3, 0x0E, 0xA3, 0x39, 0x07, 0x1F, 0xE8, 0x22, 0x5D, 0xC4, 0x27,
+    0x7C, 0xDC, 0xFF, 0x75, 0x11, 0x97, 0xB0, 0x32, 0x32, 0xE4, 0x5D, 0xCA, 0xEC, 0x57, 0x17, 0x69,
+    0x33, 0xCD, 0x42, 0x55, 0x76, 0x85, 0x01, 0xFC, 0xCA, 0xF6, 0x40, 0x71, 0xAC, 0xC8, 0xDB, 0x40,
+    0x2D, 0x3A, 0x89, 0x4A, 0xDE, 0xE6, 0xB6, 0x44, 0x15, 0x92, 0xD5, 0x06, 0xFD, 0x2E, 0x95, 0xDA,
+    0x09, 0xC0, 0xC7, 0x7A, 0x46, 0xF5, 0xF8, 0x86, 0x91, 0x2F, 0x24, 0x97, 0xBA, 0x88, 0x6C, 0x0B,
+    0x97, 0x75, 0xC6, 0xFF, 0x47, 0x09, 0xCD, 0xB8, 0xE2, 0xC6, 0x26, 0x73, 0xD9, 0xA6, 0x6A, 0xE1,
+    0x0E, 0xCD, 0x1F, 0xEE, 0xA8, 0xBB, 0x78, 0x9A, 0x91, 0x87, 0xB8, 0x37, 0x33, 0x05, 0x97, 0xCC,
+    0x72, 0x4E, 0x9B, 0xCC, 0x42, 0xF7, 0x85, 0xC9, 0x2C, 0xF8, 0x60, 0xF3, 0x15, 0x5D, 0x6C, 0x32,
+    0x6B, 0x33, 0x56, 0x8B, 0x11, 0xBA, 0x78, 0x45, 0x17, 0xCF, 0x73, 0x93, 0x9B, 0xA9, 0x5A, 0xBB,
+    0xEE, 0x97, 0x0A, 0x57, 0x38, 0x79, 0x4B, 0x36, 0xEA, 0xCC, 0x90, 0x9D, 0x04, 0x7C, 0x30, 0xAF,
+    0xF1, 0x2C, 0xD7, 0x8C, 0xD3, 0x8E, 0xC7, 0xF2, 0x1C, 0xAC, 0xB0, 0x02, 0xCD, 0xCE, 0xB5, 0xCF,
+    0x65, 0xA0, 0x97, 0x9D, 0xCD, 0x07, 0x91, 0x15, 0x80, 0xFB, 0xF2, 0xF6, 0xC7, 0xF1, 0xDC, 0xEF,
+    0xA9, 0xFA, 0x58, 0xF7, 0x46, 0x55, 0x24, 0x0C, 0x59, 0x8D, 0xCB, 0xA2, 0xB7, 0x5E, 0x7B, 0xFE,
+    0xE2, 0x08, 0xE0, 0xDE, 0x5C, 0x74, 0x1B, 0x6C, 0x00, 0x36, 0x77, 0x09, 0xA8, 0xE6, 0x3A, 0x03,
+    0x66, 0xD1, 0x86, 0x0A, 0x3E, 0x00, 0xE7, 0xBA, 0x50, 0x5E, 0x45, 0x55, 0x17, 0x19, 0x76, 0x81,
+    0x37, 0x42, 0x23, 0x22, 0x33, 0xD4, 0xEF, 0x5F, 0x5C, 0xEC, 0xF0, 0xC0, 0x27, 0xCC, 0x8E, 0x07,
+    0x56, 0x85, 0x12, 0x83, 0x2A, 0x4F, 0xAF, 0xFA, 0xD0, 0x8F, 0xD0, 0x6C, 0x2F, 0x88, 0x44, 0x7A,
+    0x59, 0x44, 0x26, 0x55, 0xA0, 0x2F, 0x5E, 0x3C, 0x80, 0x5E, 0x64, 0xC1, 0x8A, 0x48, 0xE1, 0x1F,
+    0xDE, 0x4F, 0xED, 0x02, 0x1B, 0x2E, 0x63, 0x17, 0xDA, 0x11, 0x37, 0xEA, 0x86, 0x32, 0x2B, 0x55,
+    0x51, 0xAD, 0x86, 0x8F, 0xF8, 0x50, 0x15, 0xCC, 0x8A, 0x4F, 0xD4, 0x22, 0x0B, 0x74, 0x22, 0x0B,
+    0x6C, 0x67, 0xC3, 0x82, 0x9D, 0x69, 0x67, 0xDA, 0x44, 0x3B, 0x31, 0x80, 0x4F, 0x55, 0x41, 0x2D,
+    0x7B, 0x5B, 0xF0, 0x01, 0x37, 0x99, 0x02, 0x7D, 0x68, 0x32, 0x76, 0xC1, 0x27, 0xFA, 0x74, 0x5B,
+    0x2E, 0xDE, 0x28, 0x46, 0x44, 0x24, 0x36, 0x22, 0xF2, 0xE0, 0x9A, 0xC4, 0xBF, 0xFC, 0x9A, 0x2E,
+    0x4A, 0xA4, 0x15, 0x91, 0x64, 0xE4, 0x4F, 0xBE, 0xBC, 0xD1, 0xCD, 0x54, 0x8B, 0xD9, 0xA0, 0x19,
+    0x5D, 0x86, 0x0E, 0x01, 0x96, 0x7A, 0x86, 0x2A, 0xFA, 0x74, 0x5A, 0x12, 0x55, 0xAD, 0x3E, 0x81,
+    0xAA, 0x81, 0x9D, 0x11, 0x94, 0x0B, 0xFA, 0x08, 0x98, 0xED, 0xA4, 0xFA, 0x55, 0xA4, 0x29, 0xEE,
+    0x61, 0x48, 0xF0, 0xE3, 0x48, 0xA2, 0x9A, 0x2B, 0x99, 0xCC, 0x90, 0x94, 0x3C, 0x95, 0x88, 0xC4,
+    0x1D, 0x80, 0xEC, 0xC2, 0xF6, 0x53, 0x17, 0xAF, 0x01, 0xAD, 0xAE, 0x8B, 0x57, 0xE6, 0xF9, 0xE7,
+    0x03, 0x5F, 0x91, 0x00, 0x03, 0x46, 0x14, 0x9C, 0x79, 0x5D, 0x17, 0x37, 0x63, 0x0A, 0xC7, 0x76,
+    0xAB, 0x0B, 0xB6, 0x80, 0x2D, 0xD8, 0x45, 0x6F, 0x33, 0xD8, 0xA2, 0x16, 0x52, 0xA1, 0xD1, 0x9B,
+    0xCB, 0x60, 0x17, 0xDC, 0x04, 0xF5, 0x4C, 0x3B, 0x42, 0x93, 0xE9, 0x12, 0x38, 0xBD, 0x75, 0x23,
+    0x3E, 0xB2, 0x6F, 0x77, 0x04, 0xFA, 0x80, 0x5D, 0xD5, 0x5E, 0x5D, 0x40, 0x60, 0x18, 0xB9, 0x2D,
+    0x17, 0x6F, 0x88, 0x32, 0xF7, 0x04, 0x83, 0xC8, 0xA3, 0x1B, 0x5C, 0x7C, 0xEB, 0xEC, 0xEC, 0xEC,
+    0x8C, 0x56, 0x44, 0xB6, 0xFD, 0x37, 0xC3, 0xC5, 0xC5, 0x0A, 0x02, 0x2F, 0xC1, 0x06, 0x2F, 0xC1,
+    0x0A, 0x5F, 0xC5, 0xAC, 0x70, 0x97, 0xAA, 0x5C, 0x13, 0x4D, 0x29, 0x6A, 0x67, 0x80, 0xFA, 0xFD,
+    0x8B, 0xAF, 0x83, 0xA2, 0x4F, 0x27, 0x32, 0x1F, 0x80, 0x46, 0xE9, 0xAD, 0x46, 0xF0, 0x6E, 0x0A,
+    0x47, 0x2A, 0xF0, 0x91, 0x3A, 0xD2, 0x07, 0x5C, 0x64, 0x80, 0x2E, 0x20, 0xE0, 0xB9, 0x2D, 0x22,
+    0x42, 0x2F, 0x22, 0x2B, 0x83, 0x12, 0xF4, 0xD6, 0xD9, 0xD9, 0xD9, 0x5D, 0x7A, 0x11, 0x19, 0x8D,
+    0x88, 0x48, 0xA0, 0x7B, 0xE7, 0xA2, 0x80, 0x50, 0x65, 0xEC, 0x42, 0x13, 0x71, 0x23, 0x9F, 0x83,
+    0xFE, 0x7A, 0x7C, 0xFB, 0x72, 0xC6, 0x13, 0x5C, 0xAA, 0x1F, 0xBD, 0xF8, 0x1A, 0x74, 0x22, 0x13,
+    0x88, 0xC8, 0xE3, 0xDC, 0x30, 0x00, 0xC7, 0x8B, 0xD3, 0xE9, 0xC5, 0x27, 0xD8, 0xE8, 0xB6, 0xFC,
+    0x16, 0x18, 0xD9, 0xD5, 0x7D, 0xDA, 0x59, 0xF4, 0x75, 0xE5, 0x80, 0x05, 0x23, 0x22, 0x1B, 0x8D,
+    0xFC, 0xF6, 0xFD, 0x8D, 0x6E, 0x86, 0x95, 0x3E, 0x42, 0x61, 0x03, 0x8A, 0x2D, 0xC0, 0x5C, 0xCF,
+    0xC0, 0x03, 0x1D, 0xDC, 0x4D, 0xC2, 0xF8, 0x74, 0x3D, 0x5C, 0x1F, 0x31, 0x67, 0x67, 0x7D, 0xA4,
+    0x11, 0xE9, 0x03, 0xB5, 0xAC, 0x7D, 0x84, 0x66, 0xF6, 0x09, 0xEA, 0xEC, 0x13, 0x34, 0xD9, 0x8F,
+    0xE0, 0xA6, 0x2E, 0x83, 0x1B, 0x5D, 0x81, 0x36, 0xD5, 0x12, 0xE9, 0x53, 0x25, 0x22, 0x92, 0xE8,
+    0x77, 0xD7, 0x8D, 0x3C, 0x60, 0x07, 0xBA, 0xB7, 0xCE, 0xCE, 0xB8, 0x75, 0x76, 0x46, 0x2D, 0x12,
+    0xAD, 0x48, 0x32, 0x22, 0x11, 0x91, 0x91, 0x6A, 0xDD, 0x35, 0x93, 0xEC, 0x98, 0xD2, 0x47, 0x1D,
+    0xD4, 0x61, 0xA5, 0xD6, 0xB3, 0xD2, 0xAA, 0x2A, 0x3B, 0x45, 0x64, 0x27, 0xD8, 0xCE, 0x77, 0xD7,
+    0x15, 0x45, 0xE5, 0x52, 0x25, 0x22, 0x3B, 0xFC, 0x10, 0x91, 0x1B, 0x15, 0xDB, 0xBD, 0x62, 0x93,
+    0xB5, 0xD5, 0xAA, 0xEC, 0x66, 0xDF, 0xF6, 0xA1, 0x16, 0x3F, 0x5C, 0xD1, 0x16, 0xAD, 0x7C, 0x5B,
+    0x1E, 0x50, 0xC9, 0x03, 0x5A, 0xD9, 0x70, 0x22, 0x34, 0x22, 0xA1, 0x16, 0x49, 0x1C, 0x53, 0xD3,
+    0x69, 0x55, 0xC7, 0x28, 0x7D, 0xD4, 0xD1, 0x1D, 0x9D, 0x3D, 0x5E, 0x98, 0x3F, 0x54, 0xB8, 0x6F,
+    0x2E, 0x2D, 0xDC, 0x3E, 0x54, 0x68, 0xF7, 0xEE, 0x5B, 0xED, 0x36, 0x02, 0x9C, 0x9D, 0xDD, 0x05,
+    0xED, 0xBF, 0x95, 0xF5, 0x24, 0x4F, 0xD4, 0x93, 0xA3, 0xEB, 0x2A, 0x1F, 0x96, 0x3B, 0x7F, 0x4B,
+    0x4E, 0xDB, 0x05, 0xD6, 0xFC, 0xA1, 0x17, 0xED, 0x8D, 0x17, 0xFB, 0x70, 0xB2, 0x9A, 0x9B, 0xFC,
+    0xD1, 0x2D, 0x45, 0xF8, 0x74, 0x55, 0xC0, 0xCE, 0xF7, 0x47, 0x70, 0x8A, 0x36, 0x65, 0x42, 0xD1,
+    0xCE, 0x0D, 0x09, 0x70, 0x8F, 0x9D, 0x35, 0x74, 0x8B, 0xC5, 0x4E, 0x26, 0xAA, 0x55, 0xD1, 0xAF,
+    0xA8, 0x6D, 0xE5, 0xA3, 0xD9, 0x00, 0x37, 0x56, 0x2B, 0x50, 0xCF, 0xD5, 0x0A, 0x8A, 0x47, 0x01,
+    0xD1, 0x9B, 0xFF, 0x8D, 0x05, 0xC0, 0xFD, 0x91, 0x0A, 0x04, 0x99, 0x15, 0x47, 0xA8, 0x2A, 0x94,
+    0x41, 0xB9, 0xFB, 0x15, 0x65, 0xFE, 0xB7, 0x44, 0x07, 0xDA, 0x4D, 0xDA, 0xCE, 0xAA, 0xB3, 0xEE,
+    0x13, 0xE0, 0x63, 0x53, 0x74, 0xE2, 0xA2, 0x2E, 0xA5, 0x56, 0x05, 0xA5, 0x91, 0xC4, 0x6D, 0xF9,
+    0x2D, 0xBA, 0x95, 0x56, 0x24, 0x54, 0x32, 0x35, 0x22, 0x89, 0x56, 0x3B, 0xE0, 0x9E, 0xF2, 0x01,
+    0x46, 0x24, 0x43, 0x2B, 0x8F, 0x0E, 0xC8, 0xAF, 0xCB, 0x70, 0x6D, 0x5F, 0x29, 0x49, 0x75, 0x15,
+    0x7C, 0x3A, 0xAD, 0x90, 0x0F, 0xA7, 0xD5, 0x1B, 0xAE, 0x65, 0xC8, 0xF6, 0xA1, 0x17, 0xBA, 0xE3,
+    0x85, 0xCF, 0xE2, 0x23, 0x76, 0xAC, 0x67, 0x28, 0x0C, 0xD0, 0x26, 0x97, 0xB1, 0xF3, 0x6D, 0x11,
+    0x11, 0x05, 0x4D, 0xBB, 0xFC, 0xE2, 0xEC, 0x4C, 0x7F, 0x19, 0x11, 0xD4, 0x11, 0x3A, 0x08, 0x58,
+    0x59, 0xD4, 0xCE, 0x6C, 0x24, 0x82, 0x93, 0x80, 0x93, 0xA0, 0xC0, 0xB0, 0xEB, 0x81, 0xAE, 0x8F,
+    0x9C, 0xF7, 0x80, 0xF7, 0x91, 0xD2, 0x03, 0xBE, 0x4B, 0x66, 0xE9, 0x81, 0xAB, 0x36, 0xD9, 0x3C,
+    0x00, 0x6B, 0x9B, 0xEA, 0x71, 0x00, 0x8A, 0x1B, 0x5D, 0x1A, 0xC0, 0x2C, 0x6E, 0xEC, 0xC2, 0x06,
+    0xD5, 0xEC, 0xA6, 0x3B, 0x6C, 0x60, 0x73, 0x93, 0x1F, 0xB2, 0x41, 0x9D, 0xEB, 0xBC, 0xB0, 0x41,
+    0x33, 0xD5, 0xEF, 0x65, 0x56, 0x70, 0xA3, 0xFD, 0x60, 0x64, 0x05, 0x97, 0xAC, 0x24, 0x56, 0xE8,
+    0xA2, 0x95, 0x60, 0x0A, 0xF8, 0x50, 0x09, 0xA6, 0x80, 0xC7, 0x14, 0x8C, 0x7A, 0x3E, 0x55, 0x71,
+    0x5D, 0xC1, 0x03, 0xAA, 0x82, 0xD9, 0x02, 0x50, 0x6F, 0xC1, 0x4B, 0x56, 0x0B, 0x66, 0x90, 0x0C,
+    0x88, 0x8C, 0xDC, 0xBA, 0xA7, 0x6C, 0xD5, 0x09, 0x38, 0x29, 0xB4, 0x12, 0x70, 0x32, 0x29, 0x4A,
+    0xBA, 0x02, 0x24, 0xA9, 0x1B, 0x4A, 0x26, 0x28, 0x3B, 0x08, 0x2E, 0x6A, 0x4A, 0x99, 0x02, 0xD5,
+    0xF7, 0x0B, 0xD5, 0x02, 0xF6, 0x2F, 0x56, 0xAA, 0x19, 0x6C, 0x16, 0x6C, 0x86, 0x3A, 0x0F, 0xC1,
+    0x66, 0x68, 0x26, 0x9F, 0xEA, 0x09, 0xDC, 0xD8, 0xA5, 0x66, 0x02, 0x97, 0xDC, 0xE4, 0x46, 0x70,
+    0xA9, 0xC9, 0x2E, 0x41, 0x1B, 0xED, 0xE2, 0x12, 0x74, 0xD1, 0x96, 0x36, 0x82, 0x0F, 0x66, 0xED,
+    0x02, 0x78, 0x10, 0xAF, 0xF7, 0xBE, 0x57, 0xBF, 0x91, 0x17, 0xF5, 0x52, 0x75, 0x9B, 0x72, 0x87,
+    0x5B, 0xC1, 0x6C, 0x81, 0x66, 0x05, 0x2F, 0x19, 0x5B, 0x60, 0x90, 0xBC, 0xAF, 0x3E, 0x10, 0xAE,
+    0x91, 0x89, 0xEA, 0x02, 0x06, 0x91, 0x19, 0xFA, 0xD9, 0xC8, 0x48, 0x3B, 0x53, 0x09, 0x75, 0x01,
+    0xB7, 0xA8, 0x4C, 0x4D, 0x3E, 0x81, 0x2D, 0xF5, 0x02, 0x74, 0xA3, 0x00, 0xD5, 0xDA, 0x4E, 0x40,
+    0xFB, 0xDD, 0x02, 0x98, 0x4D, 0xBD, 0x16, 0xDF, 0x2A, 0x40, 0xB5, 0xF6, 0x11, 0xF0, 0xDF, 0x5C,
+    0x00, 0x5B, 0xFA, 0x00, 0xF4, 0xBF, 0xB1, 0x00, 0x4D, 0xEE, 0x23, 0xB0, 0xED, 0xC6, 0xA8, 0x4F,
+    0x50, 0x2F, 0xD5, 0x06, 0x46, 0xD4, 0x9C, 0x49, 0x0C, 0x23, 0x5D, 0xC6, 0xCA, 0x9F, 0x0F, 0x05,
+    0x1A, 0x95, 0xC1, 0x2A, 0x98, 0x30, 0xEA, 0xEC, 0x78, 0xF1, 0xE2, 0xEE, 0x87, 0x01, 0x5F, 0x53,
+    0x40, 0x68, 0xE6, 0x1D, 0x65, 0xB8, 0x11, 0x9F, 0xE8, 0x61, 0xA3, 0x2A, 0xD8, 0x05, 0x97, 0x71,
+    0xA3, 0x9A, 0xAF, 0xAC, 0xD4, 0x33, 0x75, 0xA6, 0x8F, 0x74, 0xA9, 0x5D, 0x40, 0x44, 0x02, 0x56,
+    0x64, 0x84, 0xF6, 0x9D, 0xBB, 0xFF, 0xAF, 0x8A, 0xF4, 0x35, 0xC5, 0xCA, 0xBB, 0x74, 0x15, 0x91,
+    0xAC, 0xBE, 0x8C, 0xAE, 0x00, 0xED, 0xAC, 0x2E, 0x86, 0x3E, 0x1D, 0x62, 0x09, 0xFA, 0xA4, 0x46,
+    0xA8, 0x4F, 0xD4, 0x8B, 0xA2, 0x37, 0x97, 0xD5, 0x56, 0x6F, 0x27, 0xBD, 0x77, 0x49, 0x77, 0xAF,
+    0x4F, 0x9C, 0xC0, 0x12, 0x5D, 0x52, 0xFC, 0xE7, 0x93, 0x4A, 0x51, 0x1F, 0xF5, 0xDE, 0x07, 0xBD,
+    0x8B, 0xE2, 0x43, 0xB3, 0xE9, 0xF8, 0x6D, 0xD1, 0x61, 0x37, 0xB3, 0xBA, 0x01, 0xBA, 0x49, 0x65,
+    0xC3, 0x90, 0xA0, 0x5E, 0xA9, 0x05, 0xA8, 0xE4, 0x9D, 0x61, 0xD9, 0x0D, 0x87, 0xA4, 0xD3, 0x50,
+    0x11, 0x6B, 0x65, 0xB7, 0x75, 0x87, 0xDD, 0xD1, 0xDA, 0xEC, 0x86, 0xC2, 0xEE, 0x13, 0x84, 0x56,
+    0xDE, 0xD7, 0xF8, 0xD5, 0x61, 0x7B, 0x34, 0x87, 0x49, 0x79, 0x7F, 0x0F, 0x25, 0xF0, 0xCC, 0xB1,
+    0x76, 0xF5, 0x41, 0x71, 0x59, 0xE0, 0x3F, 0x14, 0xA3, 0x94, 0x70, 0x19, 0x7C, 0xAC, 0x0A, 0x3B,
+    0x5E, 0xAF, 0x33, 0x6D, 0xDA, 0x01, 0x3B, 0x9B, 0x8E, 0x3F, 0x56, 0x2B, 0xB4, 0x63, 0xA5, 0x82,
+    0x60, 0x83, 0x6A, 0x1B, 0x36, 0x40, 0xFB, 0xD2, 0x2D, 0xDC, 0x8E, 0x9B, 0xCA, 0xE4, 0x04, 0x55,
+    0xB1, 0x0B, 0xBB, 0x47, 0x06, 0x1F, 0x5C, 0x86, 0x36, 0x55, 0x1B, 0x34, 0x19, 0x3F, 0x61, 0x0B,
+    0x76, 0xE3, 0xB6, 0x3C, 0xA0, 0x9F, 0x5A, 0x11, 0x6A, 0xF9, 0x82, 0x48, 0x52, 0x9F, 0x13, 0xDC,
+    0x85, 0x4F, 0xBD, 0x0E, 0x95, 0xC8, 0x8C, 0x13, 0x29, 0xF8, 0xB1, 0x2E, 0x0C, 0x98, 0xC2, 0x8A,
+    0x59, 0x4C, 0xC1, 0xCC, 0x55, 0xC1, 0x4C, 0xD5, 0x7A, 0xF2, 0xDD, 0xC9, 0x78, 0xE8, 0xA5, 0x56,
+    0x02, 0xD4, 0x32, 0x01, 0x43, 0x39, 0x7C, 0x71, 0x95, 0x24, 0xA0, 0x4F, 0x9F, 0x84, 0x6E, 0x7C,
+    0x1E, 0xDA, 0xF1, 0x7C, 0xFF, 0xD5, 0xA5, 0x01, 0x7C, 0x1C, 0x22, 0xC2, 0xF0, 0xE8, 0xCB, 0x2B,
+    0xDD, 0xEE, 0xAF, 0x08, 0x8A, 0xD2, 0x9F, 0x3D, 0x3B, 0x3B, 0x3B, 0xBB, 0x2B, 0x22, 0x22, 0x6F,
+    0x8A, 0x88, 0x48, 0xFB, 0xCE, 0x1B, 0xEF, 0x5F, 0x94, 0x4B, 0x7C, 0xB4, 0xDF, 0xCD, 0x6C, 0xB8,
+    0x2F, 0xA6, 0x7A, 0xE6, 0xA5, 0xCF, 0xD1, 0x25, 0x93, 0x9F, 0x66, 0xC0, 0x1C, 0x1A, 0xC1, 0x8D,
+    0x27, 0x4D, 0xFB, 0x71, 0xB0, 0xF2, 0x6F, 0x52, 0xF6, 0x3D, 0x8F, 0xBF, 0x68, 0x86, 0xB7, 0x81,
+    0x41, 0x0A, 0x58, 0xE5, 0xEE, 0x5B, 0x67, 0xF7, 0xB8, 0x75, 0x76, 0xCF, 0x4B, 0xA1, 0x95, 0xE2,
+    0x65, 0xA6, 0x95, 0xD9, 0x6C, 0xC0, 0xA6, 0xBB, 0x66, 0xD5, 0xF7, 0xCB, 0x71, 0xB3, 0x0B, 0x98,
+    0x05, 0x3B, 0x43, 0xB5, 0x28, 0x38, 0x9A, 0x15, 0xA0, 0x64, 0xB5, 0x15, 0xD4, 0xC2, 0xAF, 0x27,
+    0x8D, 0xB8, 0x8C, 0x47, 0x00, 0xA6, 0xD3, 0xF8, 0x83, 0xDF, 0x6F, 0x11, 0xDA, 0xA8, 0x50, 0x2F,
+    0x70, 0x08, 0x44, 0x15, 0xCD, 0xBB, 0x2D, 0xE9, 0x47, 0xEA, 0x05, 0xBA, 0x99, 0x2E, 0xAB, 0xE5,
+    0x99, 0xC0, 0x8A, 0x32, 0xED, 0xA0, 0x8C, 0x69, 0xEE, 0x71, 0x73, 0x0E, 0x2B, 0x5E, 0x8A, 0x97,
+    0x05, 0x2F, 0x93, 0xDD, 0x02, 0x46, 0xE7, 0x50, 0x15, 0xCC, 0x6E, 0xA7, 0x2A, 0xFB, 0x20, 0x4A,
+    0x59, 0x51, 0x4A, 0x0E, 0x4A, 0xA8, 0x5E, 0x55, 0x6D, 0x1F, 0xF6, 0x28, 0x8E, 0x5D, 0xD4, 0xAB,
+    0x90, 0x01, 0x1F, 0xDD, 0x08, 0x74, 0xA9, 0x4D, 0x40, 0x97, 0xBC, 0xC6, 0x05, 0xAE, 0x34, 0xFE,
+    0xA0, 0x04, 0xFE, 0x43, 0x5D, 0xB1, 0x6F, 0x65, 0x80, 0xE6, 0x7B, 0x93, 0xEE, 0xA4, 0xC4, 0xC9,
+    0x1F, 0xAA, 0x1B, 0xF5, 0xF0, 0x5B, 0x3D, 0xEE, 0x4F, 0x7A, 0xF6, 0xEC, 0x9E, 0xDE, 0xFE, 0x95,
+    0x48, 0xE6, 0x0E, 0x95, 0xC8, 0x37, 0x45, 0x82, 0x29, 0x34, 0xB2, 0x1A, 0x09, 0xB8, 0x0C, 0x82,
+    0x2D, 0x2A, 0x74, 0x66, 0x5C, 0xC6, 0x0A, 0x74, 0x09, 0xAF, 0x00, 0x44, 0x6D, 0x2E, 0x99, 0x69,
+    0x32, 0x55, 0xA1, 0x96, 0x11, 0x1F, 0x68, 0x32, 0x7E, 0x08, 0xA6, 0x40, 0x9B, 0x4C, 0xD9, 0x70,
+    0x23, 0xF4, 0xC1, 0x7D, 0x6B, 0xA1, 0x07, 0xB3, 0xD2, 0x37, 0x93, 0x9D, 0xC1, 0xCE, 0x76, 0xEE,
+    0x92, 0xC6, 0x87, 0x5C, 0xEA, 0xB9, 0x04, 0x7C, 0xB8, 0x34, 0xC5, 0x66, 0x60, 0xB5, 0xB9, 0xCE,
+    0x5D, 0x00, 0xBB, 0x74, 0x41, 0xA7, 0xEB, 0xA6, 0x82, 0xAF, 0x47, 0xA0, 0xFB, 0xCD, 0x91, 0xD5,
+    0x03, 0x5C, 0x79, 0xEC, 0x5F, 0xCD, 0x40, 0xF5, 0xFE, 0x8C, 0xFB, 0x4E, 0x42, 0xDD, 0x4A, 0x9D,
+    0x22, 0x9E, 0x72, 0xB8, 0x26, 0xFA, 0x69, 0xF7, 0xDC, 0x23, 0xBB, 0x6B, 0x13, 0xBB, 0xEC, 0x5E,
+    0xF3, 0x1B, 0x97, 0x39, 0x3B, 0xE3, 0xD9, 0xB3, 0xBB, 0x88, 0xCC, 0x4E, 0x36, 0x1A, 0xD9, 0x18,
+    0x24, 0xD2, 0xAC, 0xBA, 0x1F, 0x7C, 0xD2, 0x88, 0xDB, 0xA6, 0x74, 0x74, 0x59, 0x71, 0x52, 0x1F,
+    0x15, 0x1E, 0x95, 0x66, 0x47, 0x79, 0x3B, 0xF6, 0x53, 0x37, 0x48, 0xBD, 0x8B, 0x7A, 0x3F, 0xEF,
+    0x91, 0x52, 0xED, 0xAA, 0xCF, 0xBB, 0x1C, 0x8C, 0x00, 0xF6, 0x3D, 0x7D, 0x67, 0xDD, 0x15, 0x48,
+    0xD8, 0x9D, 0xE3, 0x76, 0xD1, 0xCD, 0xD4, 0x25, 0xD5, 0x33, 0x9B, 0x86, 0x51, 0x0E, 0x1B, 0xC1,
+    0x47, 0x6E, 0x4B, 0xA0, 0xDE, 0x42, 0xAD, 0x6E, 0x84, 0x20, 0x32, 0x23, 0x32, 0xF3, 0xEC, 0xD9,
+    0x3D, 0xCE, 0xCE, 0xEE, 0x8B, 0x30, 0xC8, 0x9F, 0x89, 0xD0, 0xC9, 0xD4, 0xCE, 0xD0, 0x47, 0x95,
+    0x8B, 0xF4, 0x81, 0x2E, 0xE1, 0x0E, 0x99, 0xE9, 0x46, 0xE8, 0x63, 0x33, 0x81, 0xCB, 0x1A, 0xE3,
+    0xB3, 0x19, 0xF0, 0xBF, 0x3E, 0x03, 0xCD, 0x7B, 0x0B, 0x60, 0xB6, 0x72, 0xED, 0xE3, 0xA9, 0x95,
+    0x9D, 0x54, 0x98, 0xF7, 0x81, 0x23, 0x62, 0xB5, 0xEB, 0x3B, 0x45, 0xC6, 0x8F, 0x3D, 0xDE, 0x6D,
+    0xE1, 0x47, 0xE1, 0x04, 0x20, 0x76, 0x67, 0x93, 0x1A, 0xBA, 0x83, 0x88, 0x8C, 0x56, 0x44, 0x24,
+    0xB6, 0xEF, 0x5C, 0xFC, 0x6E, 0xE1, 0x0A, 0xBA, 0xB1, 0xCA, 0x54, 0x1B, 0x2E, 0xD2, 0x4E, 0x7C,
+    0x6E, 0x17, 0x99, 0x2A, 0x8D, 0x14, 0x48, 0xCF, 0x00, 0x43, 0x04, 0x55, 0x85, 0x0A, 0xA4, 0xED,
+    0x0D, 0x88, 0xBB, 0x72, 0x78, 0xB1, 0xD5, 0x4C, 0x69, 0x33, 0x66, 0x42, 0xA0, 0x49, 0x2E, 0xC3,
+    0x1D, 0x24, 0x50, 0xCD, 0xCD, 0x0C, 0x6D, 0xEA, 0x45, 0x44, 0x8C, 0x88, 0xC8, 0x6C, 0xD5, 0xA2,
+    0x3C, 0x72, 0x26, 0x0A, 0xF4, 0x05, 0xAE, 0xEE, 0x69, 0xF4, 0x6D, 0xB7, 0xE0, 0xAA, 0x85, 0x1D,
+    0xA6, 0xE9, 0x4F, 0x3D, 0x69, 0x70, 0xD1, 0xED, 0x51, 0xCF, 0x56, 0x05, 0x0D, 0x7E, 0x8F, 0xD2,
+    0xF5, 0x7B, 0x60, 0xF0, 0x92, 0xEB, 0x66, 0xFE, 0x16, 0x4D, 0xB4, 0x11, 0xBA, 0xDF, 0x02, 0xBF,
+    0xEA, 0x48, 0x9E, 0xD1, 0x57, 0xAB, 0xBD, 0xBA, 0x4B, 0xDA, 0xCB, 0x9D, 0xBD, 0xC5, 0xBD, 0xB5,
+    0x66, 0x7F, 0xDB, 0x6B, 0x87, 0x66, 0xD9, 0x8B, 0xF7, 0xC6, 0xFD, 0x1E, 0x3E, 0x2C, 0xDA, 0xFF,
+    0xCD, 0x86, 0xFC, 0xF5, 0xD0, 0x6C, 0x86, 0xDB, 0xF1, 0x9A, 0x00, 0x9F, 0xD8, 0x87, 0xFB, 0x7F,
+    0x32, 0xEB, 0xF3, 0xFF, 0xBB, 0x59, 0x77, 0x8F, 0x37, 0xF3, 0xEC, 0xD5, 0x35, 0x01, 0xF6, 0x45,
+    0x89, 0xFB, 0x46, 0x96, 0x49, 0x95, 0x65, 0xF5, 0xD7, 0x33, 0xF8, 0x36, 0x51, 0x4F, 0x05, 0x4A,
+    0x33, 0xD1, 0x26, 0x4F, 0x35, 0xDB, 0x19, 0x4F, 0x9B, 0x9A, 0x89, 0xC2, 0x4A, 0x33, 0xB5, 0x09,
+    0x5F, 0xCD, 0xD8, 0xD9, 0x43, 0xFB, 0xCD, 0x69, 0x0F, 0xA8, 0x5A, 0x39, 0xAE, 0x77, 0x2E, 0x2E,
+    0x2E, 0x2E, 0x9E, 0xE2, 0xF3, 0x0C, 0x0C, 0xD1, 0x8F, 0x2E, 0xDB, 0x85, 0x87, 0x3C, 0x03, 0x5D,
+    0x7C, 0x06, 0x86, 0xCD, 0x63, 0x44, 0x24, 0x22, 0x2F, 0xC8, 0x88, 0xD0, 0x66, 0x06, 0xAA, 0x85,
+    0x7E, 0x0F, 0x78, 0x78, 0x5C, 0xA2, 0x4D, 0x4D, 0xA6, 0x99, 0xEC, 0x82, 0x9D, 0x55, 0x9B, 0x79,
+    0x10, 0xDA, 0x84, 0xA4, 0x3A, 0xF3, 0x5F, 0xA6, 0x7F, 0xBC, 0x72, 0x39, 0x7F, 0xB6, 0x4F, 0xE5,
+    0x65, 0xEF, 0x64, 0x6D, 0xA5, 0x92, 0xB5, 0x96, 0xE0, 0x17, 0x04, 0xEE, 0xF2, 0xD4, 0x0E, 0x27,
+    0x18, 0x96, 0x3D, 0xD0, 0x62, 0x7E, 0x69, 0x39, 0x4C, 0x63, 0x9B, 0x0F, 0x0D, 0xDC, 0x4C, 0x87,
+    0xB6, 0x76, 0x09, 0x68, 0xD3, 0x73, 0x91, 0xF6, 0x57, 0x25, 0xD3, 0xFD, 0xA2, 0x14, 0x7C, 0xFB,
+    0xED, 0x82, 0x7F, 0xB9, 0x5A, 0x39, 0x9F, 0xCD, 0xCA, 0x30, 0xB1, 0x22, 0x89, 0x15, 0x09, 0x66,
+    0x35, 0x1B, 0xA6, 0x98, 0x95, 0xAA, 0x54, 0x05, 0xBB, 0xD8, 0x19, 0x9B, 0x6D, 0xA6, 0xC9, 0x4D,
+    0xA6, 0x4D, 0x6E, 0xC2, 0x47, 0x37, 0x21, 0xB4, 0xDB, 0x97, 0x8B, 0xFA, 0x8F, 0xFC, 0x7D, 0x09,
+    0x3C, 0xA5, 0x90, 0xFA, 0xFE, 0x03, 0x5A, 0x99, 0x2A, 0x91, 0xD4, 0xFD, 0x8F, 0x2B, 0x53, 0x78,
+    0xDA, 0x25, 0xB8, 0xD2, 0xA1, 0x75, 0x37, 0xE2, 0xB7, 0x23, 0xF4, 0x1A, 0xD9, 0xAD, 0x67, 0x4C,
+    0x3B, 0xF1, 0x92, 0x1F, 0x9B, 0x69, 0x90, 0x0D, 0x91, 0x09, 0x59, 0x4E, 0xEE, 0xF7, 0x5B, 0xC0,
+    0x6D, 0x19, 0xC1, 0xCA, 0x0C, 0x7C, 0xE9, 0x46, 0xAC, 0xEF, 0x3A, 0x6A, 0x7E, 0x1D, 0xFD, 0xEE,
+    0xA1, 0x5A, 0xBA, 0x48, 0x23, 0xDF, 0x9B, 0x8E, 0x1C, 0xA1, 0xB6, 0xE0, 0xB2, 0x11, 0x9A, 0x4C,
+    0x17, 0x6D, 0xC6, 0x8D, 0xD5, 0x82, 0xCD, 0x14, 0x4C, 0xD1, 0xE0, 0x48, 0x17, 0xF1, 0xC1, 0x8D,
+    0x74, 0xC9, 0x66, 0x5C, 0x36, 0x05, 0x57, 0xE8, 0x69, 0xAE, 0x4C, 0x3B, 0x36, 0xDF, 0xF9, 0xB9,
+    0x6F, 0x16, 0xF7, 0xCD, 0x6F, 0x65, 0x91, 0xB7, 0x24, 0x77, 0x32, 0xF6, 0xB3, 0x95, 0xE8, 0x32,
+    0xB7, 0xD4, 0xF4, 0xB9, 0x3F, 0x61, 0xA5, 0xD0, 0x7E, 0x6F, 0xE5, 0x9C, 0xCD, 0x2C, 0x5C, 0xD9,
+    0xCC, 0xD6, 0x8C, 0x55, 0x71, 0xA9, 0x99, 0xBB, 0xE8, 0x47, 0xFF, 0x0B, 0x12, 0xFC, 0xB0, 0xD0,
+    0x4B, 0xA0, 0x7F, 0x70, 0xD2, 0xEE, 0x4F, 0xF7, 0x81, 0xDF, 0xF7, 0xA9, 0xC9, 0x9D, 0xC8, 0xE8,
+    0x44, 0xB0, 0xF2, 0xF6, 0x75, 0xD4, 0x61, 0xF7, 0xC8, 0xEF, 0x9A, 0x49, 0x02, 0xE0, 0xDE, 0xDF,
+    0x34, 0x83, 0x20, 0x1F, 0x6B, 0xAD, 0x9B, 0xE1, 0xC0, 0x5E, 0x3B, 0xF8, 0xDA, 0xE5, 0xA9, 0x91,
+    0xB3, 0xA0, 0xCE, 0xA7, 0xC3, 0x1F, 0x77, 0xD8, 0x23, 0x9A, 0x31, 0x72, 0xA0, 0x39, 0x35, 0xF3,
+    0x77, 0xCF, 0xC9, 0x2E, 0xA4, 0x1F, 0x6F, 0x76, 0xEF, 0x4A, 0xA5, 0xF8, 0xDE, 0x84, 0x7D, 0xBC,
+    0x09, 0x6E, 0x36, 0x31, 0x71, 0x0D, 0x0A, 0x3F, 0x34, 0xB2, 0x1B, 0x65, 0x8A, 0x64, 0xDC, 0xE8,
+    0x03, 0xE0, 0x75, 0x78, 0x3A, 0x4F, 0x86, 0x93, 0xEE, 0xFD, 0x95, 0xD7, 0xCF, 0x02, 0x46, 0x44,
+    0x46, 0x8C, 0xBC, 0x21, 0x19, 0xB3, 0x52, 0xEE, 0x1E, 0x51, 0x81, 0x2B, 0x9A, 0x11, 0x3C, 0x76,
+    0x06, 0x97, 0x34, 0x8F, 0x89, 0x2B, 0x60, 0x55, 0xCF, 0xDD, 0x5B, 0x03, 0x50, 0x2B, 0x44, 0xEB,
+    0x15, 0x9E, 0xBE, 0x7D, 0x3D, 0x6A, 0x1D, 0x53, 0xA5, 0x5D, 0xFA, 0x15, 0x30, 0x83, 0xCC, 0x50,
+    0x6F, 0x5F, 0x91, 0x44, 0xB3, 0xD0, 0xA9, 0xC1, 0x20, 0xD1, 0x2E, 0xE0, 0x32, 0x2B, 0xBB, 0x87,
+    0xDE, 0xAC, 0x34, 0x2B, 0xB7, 0x37, 0x0D, 0x6C, 0x9D, 0x6C, 0xCB, 0xE7, 0xD4, 0x53, 0x6F, 0xC2,
+    0x11, 0x0D, 0x1E, 0x04, 0x78, 0x56, 0x23, 0x84, 0xE3, 0xD1, 0xA3, 0xB9, 0x91, 0x06, 0x12, 0x8E,
+    0x0D, 0x5A, 0x67, 0xF3, 0x75, 0xAA, 0xA5, 0x96, 0xC4, 0xDA, 0xC8, 0x8C, 0x77, 0x7F, 0xBD, 0xD2,
+    0xFE, 0xB7, 0xD1, 0x87, 0xE6, 0x7B, 0xA3, 0x4B, 0xD5, 0x07, 0x63, 0x9D, 0x91, 0xA9, 0x2A, 0xF8,
+    0xCC, 0x46, 0x9B, 0xF1, 0xA1, 0x59, 0x68, 0x93, 0x2D, 0x34, 0x13, 0x1B, 0x76, 0xA6, 0x0F, 0x14,
+    0xBA, 0x44, 0x6F, 0xDC, 0x44, 0xF7, 0x6B, 0x6F, 0xCE, 0x34, 0x7F, 0x96, 0x0B, 0x56, 0xE6, 0x1E,
+    0x64, 0xEE, 0xA2, 0xA6, 0x25, 0x68, 0x72, 0x20, 0x5D, 0xAC, 0x04, 0x57, 0xF0, 0xA3, 0x8E, 0xE5,
+    0xB8, 0x5E, 0x8C, 0xAD, 0x44, 0xD9, 0xB0, 0x33, 0x2E, 0x31, 0x60, 0x17, 0xDC, 0x48, 0x4F, 0x55,
+    0x70, 0x93, 0x06, 0x3A, 0xDC, 0x84, 0x7F, 0xC1, 0x94, 0x9F, 0x6C, 0xDE, 0x9B, 0x3B, 0x89, 0xC3,
+    0x62, 0xE4, 0x70, 0x02, 0x5C, 0xF3, 0xC4, 0x10, 0xF7, 0xAC, 0x08, 0x97, 0x4F, 0x2C, 0xF6, 0xC4,
+    0xF5, 0x89, 0x57, 0x77, 0x48, 0xEA, 0x25, 0xEC, 0x84, 0xA9, 0xF3, 0xC1, 0xC0, 0xDB, 0xB1, 0xB1,
+    0x5D, 0xDA, 0x77, 0x7C, 0xB5, 0x1C, 0xAD, 0xFB, 0x83, 0x8E, 0x4D, 0x3E, 0x38, 0x6D, 0x3D, 0xBD,
+    0xFC, 0xD1, 0xFF, 0x6B, 0x32, 0x55, 0xF4, 0x81, 0xF6, 0x6B, 0x0B, 0x0C, 0x12, 0x35, 0x19, 0x50,
+    0x55, 0x3F, 0xE6, 0xEE, 0x0E, 0xC6, 0xBC, 0x04, 0xF8, 0x52, 0x79, 0xE2, 0x6D, 0x9B, 0x8F, 0x0D,
+    0x70, 0x05, 0xD8, 0xF9, 0xF6, 0xDB, 0xB8, 0xFF, 0x2A, 0x33, 0xBD, 0x7F, 0x37, 0x57, 0x1F, 0xCC,
+    0x6D, 0x6A, 0x36, 0x7A, 0xFC, 0x54, 0x2D, 0x08, 0x2E, 0xD5, 0x99, 0x8D, 0x2E, 0x76, 0x13, 0xE5,
+    0xB9, 0x15, 0xAB, 0xF1, 0x9A, 0x11, 0xAE, 0x7C, 0xC0, 0x2E, 0x3D, 0xB8, 0x51, 0xC0, 0x1B, 0xC1,
+    0x94, 0x4A, 0x42, 0x33, 0x59, 0x79, 0xDB, 0x07, 0x2B, 0x73, 0xA1, 0x92, 0xA8, 0x12, 0xDE, 0x84,
+    0x4E, 0x6A, 0xC9, 0x67, 0x82, 0x9B, 0x58, 0x69, 0x53, 0x55, 0xF0, 0xD1, 0xCE, 0x78, 0xEA, 0xCC,
+    0x15, 0x6E, 0xD4, 0xD4, 0xD0, 0xBD, 0xB4, 0xA7, 0xC9, 0x6C, 0x47, 0xE9, 0xCF, 0x2D, 0x9F, 0xF7,
+    0xFF, 0xE9, 0x4D, 0xC9, 0xBE, 0x54, 0x1B, 0xB7, 0xC0, 0xBC, 0x4E, 0xF3, 0x80, 0x7F, 0x1F, 0xBC,
+    0x30, 0xE4, 0x4A, 0x52, 0x2F, 0x56, 0xE6, 0x56, 0x26, 0xCE, 0xDD, 0x9F, 0xCD, 0xFD, 0x1B, 0x13,
+    0x57, 0xBE, 0x9A, 0x8B, 0x9B, 0x58, 0x8B, 0xFD, 0x7E, 0x76, 0x23, 0x5B, 0xB6, 0x1F, 0x24, 0x97,
+    0x90, 0xD1, 0x0A, 0x6D, 0x32, 0x12, 0xEB, 0x55, 0x79, 0xA6, 0x29, 0xF8, 0x60, 0x57, 0x5C, 0xD6,
+    0x68, 0x9C, 0x9B, 0xE8, 0xA9, 0x67, 0xDA, 0xC4, 0xD5, 0x1E, 0x8C, 0x59, 0x95, 0x55, 0x28, 0x4F,
+    0xB9, 0x11, 0x8F, 0x29, 0x9F, 0x6B, 0x13, 0x3D, 0x55, 0x59, 0xDB, 0xC4, 0x15, 0x95, 0x2C, 0x5D,
+    0x64, 0xA3, 0x92, 0xC9, 0x07, 0xCA, 0x01, 0xBF, 0xE1, 0x69, 0xCC, 0xEB, 0x34, 0x93, 0x95, 0xDC,
+    0x48, 0xEC, 0xC5, 0x4A, 0xA1, 0x9E, 0xB6, 0x3E, 0x71, 0xE5, 0x4D, 0xC1, 0x7D, 0x27, 0xB5, 0x89,
+    0x2D, 0x57, 0x0B, 0x6E, 0xC5, 0x47, 0x23, 0xD1, 0xCE, 0x74, 0x99, 0x1E, 0xBB, 0xD2, 0x4C, 0xF8,
+    0xA4, 0x1E, 0x19, 0x97, 0xD4, 0xB4, 0x76, 0x13, 0x5D, 0x0C, 0x2B, 0x76, 0xFE, 0x7C, 0x9B, 0xF0,
+    0x5F, 0xF9, 0x46, 0xC1, 0x4A, 0xEE, 0x22, 0xBE, 0xD8, 0x59, 0xB9, 0x53, 0x53, 0xB6, 0xEE, 0xBF,
+    0xAD, 0x5E, 0xB9, 0x4A, 0xA4, 0xD0, 0x4D, 0x6E, 0x36, 0x1B, 0x2E, 0xBB, 0x09, 0x9F, 0x04, 0x06,
+    0x3B, 0x53, 0x95, 0x2E, 0xD1, 0xE4, 0x0D, 0xBA, 0x37, 0x67, 0xD8, 0xDA, 0x11, 0x3B, 0xF7, 0xD0,
+    0x7E, 0xA3, 0xC0, 0x56, 0xCF, 0x34, 0xD9, 0x4D, 0xF4, 0xD1, 0xA7, 0xBA, 0x30, 0xFC, 0xA9, 0x24,
+    0xF5, 0x23, 0x0C, 0xDB, 0xD1, 0x85, 0x79, 0x9D, 0x2E, 0xE2, 0xA5, 0x92, 0x4C, 0xBF, 0x35, 0xB2,
+    0xC0, 0x79, 0xF7, 0xB5, 0x02, 0x97, 0x97, 0xB6, 0xC0, 0x3A, 0x57, 0x05, 0x64, 0x34, 0x05, 0x24,
+    0x9A, 0x82, 0x11, 0xAA, 0x42, 0xB5, 0x52, 0x95, 0x3D, 0x24, 0xA6, 0x88, 0xC1, 0x66, 0x9A, 0x4C,
+    0x9D, 0x71, 0x13, 0xCD, 0x44, 0x97, 0x76, 0x17, 0x87, 0x9B, 0xCC, 0x06, 0xED, 0xF6, 0xE5, 0xE5,
+    0x08, 0xEA, 0xF8, 0xFB, 0x12, 0xC0, 0x9B, 0xBB, 0x27, 0xF9, 0x7C, 0xCE, 0x49, 0xF2, 0xEC, 0x62,
+    0x79, 0x77, 0xAF, 0xBC, 0xC6, 0x9E, 0x41, 0xC4, 0x67, 0x2E, 0x7E, 0x47, 0x3D, 0x2D, 0xF1, 0x19,
+    0x6A, 0x99, 0x8B, 0x2A, 0x8E, 0x3E, 0x0E, 0x33, 0x1B, 0x6D, 0xB6, 0x0B, 0xCD, 0x54, 0x67, 0xDC,
+    0xE8, 0x46, 0x5C, 0x6A, 0x13, 0x6D, 0xEA, 0x22, 0x5D, 0xF4, 0x01, 0x1F, 0x7C, 0x60, 0xA0, 0x07,
+    0xA1, 0xC7, 0x6E, 0xF4, 0x34, 0x1B, 0x7D, 0xE8, 0x2E, 0xE9, 0x53, 0x29, 0x78, 0x99, 0x0B, 0x9D,
+    0xBC, 0xB5, 0xD0, 0x6C, 0x66, 0x81, 0xBB, 0xD5, 0xFC, 0x18, 0x6E, 0xB9, 0x01, 0x5E, 0xF2, 0x9E,
+    0xA9, 0xD6, 0x88, 0xC0, 0xED, 0x8B, 0x0B, 0xCC, 0xEB, 0x7C, 0xD5, 0x8B, 0xDD, 0xBC, 0xB8, 0x8D,
+    0xBE, 0x5B, 0x39, 0xF7, 0xF7, 0xB8, 0x5C, 0x60, 0xCD, 0xEA, 0x28, 0x91, 0x88, 0x11, 0x0D, 0xDC,
+    0xD8, 0xA2, 0xDA, 0xA9, 0xCE, 0xD7, 0xD9, 0x97, 0x6E, 0xCF, 0xBC, 0xEC, 0xD2, 0x21, 0x8B, 0xEE,
+    0x3F, 0xA0, 0x93, 0xD1, 0x8A, 0x44, 0x1F, 0x5E, 0x36, 0x0B, 0x9F, 0x6E, 0x26, 0x7D, 0xDC, 0xA7,
+    0xBD, 0xC5, 0x49, 0x0D, 0xC4, 0x7E, 0xD2, 0xB2, 0xFE, 0x85, 0xC0, 0xDA, 0x06, 0x9B, 0x87, 0xD0,
+    0xFE, 0x9A, 0xBC, 0x53, 0xAC, 0x48, 0xAA, 0x64, 0xDE, 0xF3, 0xEA, 0x22, 0x3C, 0x04, 0x97, 0x30,
+    0x0B, 0xF8, 0x40, 0xFD, 0xE8, 0xAC, 0x13, 0xF9, 0x40, 0x64, 0x65, 0xD3, 0xEE, 0x0B, 0xB4, 0x89,
+    0x6A, 0x01, 0x1F, 0x35, 0x46, 0xAD, 0x43, 0xBC, 0xD2, 0xC7, 0x2B, 0x3F, 0xDB, 0xA6, 0xF6, 0x85,
+    0xB5, 0xC9, 0xAD, 0xAC, 0x88, 0x50, 0x4B, 0xE0, 0x16, 0x98, 0x0B, 0x78, 0xB6, 0x92, 0x19, 0x97,
+    0xBD, 0x04, 0x15, 0xF4, 0xED, 0x2E, 0x8F, 0x9B, 0x4C, 0x17, 0xB5, 0x68, 0xDF, 0x67, 0xD4, 0x99,
+    0x2E, 0x71, 0x75, 0x2A, 0xAA, 0xCA, 0x9E, 0x82, 0x75, 0x85, 0x2B, 0xB8, 0xB1, 0x7A, 0x37, 0x86,
+    0x95, 0xCB, 0xE5, 0xB3, 0x6E, 0xEA, 0xDA, 0x57, 0x92, 0xC8, 0x5B, 0x32, 0x37, 0x32, 0xBB, 0x15,
+    0x05, 0x98, 0xCF, 0x60, 0xC0, 0xBC, 0x4A, 0x3D, 0x4A, 0xC6, 0xFF, 0x91, 0x8C, 0x0C, 0xB1, 0x4F,
+    0x66, 0x63, 0xC0, 0xCE, 0xA6, 0xE0, 0x46, 0x3B, 0xE3, 0x71, 0x53, 0xB5, 0xD0, 0x45, 0x97, 0xE8,
+    0xE9, 0x31, 0xC5, 0xCE, 0xD8, 0xDC, 0x46, 0xF5, 0x3D, 0xF8, 0x66, 0x84, 0x72, 0x0E, 0xD5, 0xF7,
+    0x33, 0x34, 0x72, 0x64, 0xCA, 0x0D, 0xA7, 0x44, 0x69, 0xC0, 0xBC, 0xC6, 0x73, 0x91, 0x4B, 0x27,
+    0xB8, 0x99, 0xFE, 0x9B, 0x32, 0x99, 0x0D, 0x37, 0xD7, 0x05, 0x9F, 0xCC, 0xAA, 0x09, 0x63, 0x3D,
+    0xED, 0x58, 0xAD, 0xB4, 0xC9, 0x2E, 0x0C, 0xB1, 0xCE, 0x5C, 0xA9, 0x80, 0xED, 0x92, 0x2B, 0x14,
+    0xEA, 0xDC, 0x08, 0x1E, 0x8A, 0x7D, 0x37, 0x75, 0x01, 0x6F, 0xDE, 0x9B, 0x5D, 0xC2, 0x8D, 0xE5,
+    0xB2, 0x19, 0xA9, 0xE6, 0x97, 0xDA, 0x5F, 0x9F, 0xE0, 0xF2, 0x4E, 0xFD, 0xDD, 0x0C, 0x6D, 0xCF,
+    0xA3, 0x19, 0x6A, 0xC1, 0xCF, 0x60, 0x24, 0xB8, 0x05, 0xE8, 0xD5, 0xA7, 0xE2, 0x02, 0xF3, 0x0D,
+    0xA5, 0x74, 0x3B, 0x72, 0x7B, 0xAA, 0x24, 0x21, 0xA3, 0x97, 0xE0, 0x24, 0xBC, 0x2E, 0xC8, 0xBF,
+    0xC3, 0xAC, 0xCD, 0x04, 0x76, 0xB9, 0x03, 0x34, 0x7F, 0x99, 0x0F, 0x37, 0xDC, 0x6E, 0xBB, 0xF7,
+    0xF1, 0x64, 0xD4, 0xBA, 0x72, 0xF2, 0x6E, 0xD6, 0xDF, 0xCE, 0xC0, 0x9D, 0x36, 0x81, 0xCD, 0x3E,
+    0xF2, 0x69, 0x1F, 0x06, 0x13, 0x64, 0x31, 0x22, 0x56, 0xA2, 0x95, 0xD9, 0xCD, 0xD4, 0x2B, 0xB7,
+    0x34, 0x97, 0xC5, 0xBC, 0x46, 0x35, 0xD1, 0x69, 0x36, 0xA2, 0x60, 0x0B, 0x66, 0x08, 0x55, 0x01,
+    0x1F, 0x4D, 0x01, 0x9F, 0x76, 0xB7, 0xC9, 0x02, 0x6E, 0xAC, 0x66, 0x70, 0x93, 0xBA, 0xFE, 0xED,
+    0x04, 0x75, 0x6E, 0x12, 0xD8, 0xEC, 0x22, 0xD8, 0xDC, 0x01, 0x36, 0xDF, 0x01, 0x6C, 0x7E, 0x08,
+    0xD8, 0x3C, 0x03, 0xD5, 0x5F, 0x66, 0xC0, 0x7E, 0x3F, 0x9D, 0xDC, 0xB0, 0xF6, 0x46, 0xC0, 0x5F,
+    0x91, 0x9F, 0x4B, 0x27, 0x3C, 0x57, 0x15, 0xE0, 0xCE, 0x1B, 0x19, 0xF0, 0x12, 0x0F, 0x8C, 0x44,
+    0xA7, 0xE9, 0x08, 0xBF, 0x1C, 0xAA, 0xE0, 0x25, 0x5E, 0xD6, 0x22, 0x5F, 0x1C, 0xAF, 0x06, 0x59,
+    0x5C, 0x7C, 0x6E, 0x63, 0xA6, 0x4B, 0xB7, 0x75, 0x03, 0x97, 0x5D, 0x6B, 0xB7, 0x49, 0x1D, 0x12,
+    0x9A, 0xC4, 0xBC, 0xE7, 0x2C, 0xEF, 0xBE, 0x54, 0xB2, 0xDF, 0xEE, 0x76, 0x5F, 0x10, 0x91, 0x79,
+    0xED, 0x45, 0x9A, 0x74, 0x5F, 0xD2, 0x29, 0x6F, 0x0B, 0x23, 0x20, 0x13, 0xDD, 0x7F, 0xA7, 0xD6,
+    0x68, 0xC8, 0xBE, 0xBF, 0xBA, 0x40, 0x35, 0x5F, 0xDF, 0x54, 0x74, 0x78, 0xA8, 0x27, 0x54, 0x72,
+    0xD2, 0x25, 0x90, 0xBD, 0x3C, 0xDC, 0x78, 0xAC, 0xB1, 0x1D, 0xDD, 0x85, 0xFA, 0xF8, 0x5C, 0xED,
+    0xCB, 0x4B, 0x85, 0xAD, 0x43, 0xC0, 0x4A, 0xA2, 0x5D, 0xE0, 0x29, 0xCD, 0xAA, 0x75, 0x09, 0x0F,
+    0x0B, 0xF5, 0x48, 0xA7, 0x59, 0xF0, 0xB8, 0xC8, 0xCB, 0x54, 0x59, 0x1F, 0x99, 0x1B, 0x8F, 0x26,
+    0xDA, 0xC8, 0xE5, 0xFE, 0xE8, 0x0E, 0x66, 0xA1, 0x19, 0xF1, 0xC7, 0xA3, 0xC0, 0x25, 0x76, 0x7F,
+    0xC4, 0x6B, 0xC7, 0x99, 0x0D, 0x09, 0x38, 0x81, 0x4F, 0xAC, 0x0A, 0x6F, 0xEA, 0x49, 0x6D, 0xDC,
+    0x4B, 0x1D, 0x9D, 0xBB, 0xFE, 0xF3, 0x66, 0xE9, 0x6E, 0xA5, 0xCB, 0xEE, 0xB3, 0x5A, 0x60, 0x08,
+    0xD4, 0x59, 0xCD, 0xE2, 0xF2, 0x78, 0xA5, 0x05, 0xEC, 0xDE, 0xE8, 0xB9, 0xDA, 0xD6, 0x2E, 0xC1,
+    0x39, 0x3C, 0x97, 0x69, 0x24, 0xE0, 0x27, 0x3D, 0x9E, 0x50, 0x3D, 0xA2, 0x7A, 0x41, 0x0A, 0x2F,
+    0x7B, 0x59, 0xDC, 0xB7, 0xE7, 0x41, 0xCA, 0x43, 0x06, 0xB1, 0x51, 0x7D, 0x28, 0x00, 0x0F, 0x4C,
+    0xA4, 0xE7, 0x92, 0x2E, 0xF9, 0xE8, 0x72, 0x3B, 0xD9, 0xD2, 0x2C, 0x46, 0xAA, 0x0D, 0x9F, 0x86,
+    0xD8, 0xCC, 0x2E, 0xD3, 0x27, 0x09, 0xD5, 0x6A, 0x0B, 0x4D, 0x76, 0x23, 0x5D, 0xF4, 0xF0, 0x90,
+    0x85, 0x6A, 0xB4, 0xBB, 0xC3, 0x24, 0x9A, 0x48, 0x3D, 0xBA, 0x84, 0x1B, 0xDB, 0x84, 0x4B, 0x5D,
+    0xA2, 0x4B, 0x3E, 0xE2, 0x53, 0x1F, 0x19, 0xA2, 0x50, 0xAD, 0xB6, 0xD0, 0x4D, 0x7E, 0xAC, 0x36,
+    0xBB, 0xD2, 0x8E, 0x3E, 0x99, 0xD5, 0x16, 0xDA, 0xE4, 0x23, 0x8B, 0x99, 0x9F, 0x84, 0x90, 0x3F,
+    0xCB, 0x0D, 0x1B, 0x46, 0xB3, 0x5C, 0xC1, 0xEE, 0x21, 0x85, 0x6E, 0x77, 0x69, 0x0E, 0xFA, 0xD4,
+    0xC4, 0x8F, 0x02, 0xA1, 0x9F, 0xE5, 0x86, 0x2B, 0x0A, 0xAF, 0xA6, 0x47, 0xA7, 0xA6, 0x8C, 0x6E,
+    0xF1, 0xDD, 0x79, 0x48, 0xFD, 0xAD, 0x59, 0xCD, 0xA1, 0x0D, 0xA0, 0x9A, 0xD5, 0xC2, 0xD9, 0x5D,
+    0x7B, 0x97, 0x66, 0xCF, 0xD5, 0xD6, 0x08, 0x8A, 0xE2, 0xD4, 0x36, 0xAA, 0x84, 0x49, 0x9A, 0x4E,
+    0x39, 0xD1, 0xA9, 0xD3, 0xF8, 0x48, 0x0B, 0x58, 0xC1, 0x6C, 0x17, 0x17, 0x43, 0x54, 0xCE, 0xCC,
+    0xD0, 0xEF, 0xE1, 0x95, 0x00, 0x03, 0x47, 0x46, 0x8B, 0x4B, 0x50, 0x2F, 0xB8, 0x19, 0x2A, 0x79,
+    0xD0, 0xCB, 0x44, 0x2B, 0x9B, 0x97, 0x05, 0x27, 0x12, 0x3E, 0x3E, 0x05, 0xAB, 0x3A, 0xDC, 0xBC,
+    0x49, 0xE7, 0x12, 0x01, 0x1A, 0xCD, 0x75, 0x31, 0x0F, 0xF8, 0x51, 0x27, 0xC6, 0x9E, 0xE5, 0x38,
+    0xA8, 0x89, 0x3A, 0xE8, 0x24, 0x86, 0x3E, 0x01, 0x0C, 0x76, 0xCF, 0xED, 0xF6, 0x3A, 0xCE, 0x3A,
+    0xFE, 0x68, 0x12, 0xC3, 0xBC, 0x5A, 0x3D, 0x00, 0xEC, 0xBA, 0xE7, 0x73, 0xBF, 0x20, 0x01, 0xE8,
+    0xD3, 0xA0, 0xC7, 0x0E, 0x5C, 0xFC, 0xF8, 0x0C, 0xD2, 0x4A, 0xF7, 0x6C, 0xBD, 0x6F, 0xA9, 0x6D,
+    0x67, 0x29, 0x2D, 0x15, 0xD5, 0xE3, 0xAB, 0x12, 0xE3, 0x65, 0xDD, 0x7E, 0x5E, 0x3D, 0xD4, 0xDD,
+    0xCF, 0x6B, 0xE4, 0x21, 0x0D, 0x9A, 0xDC, 0xD7, 0x26, 0xA0, 0x9E, 0xEA, 0x1D, 0xE9, 0xAD, 0x7A,
+    0xEA, 0xC7, 0x47, 0x40, 0xF3, 0xB9, 0xB8, 0x52, 0x5D, 0xE3, 0x45, 0x24, 0x40, 0x27, 0x7B, 0x00,
+    0xF5, 0xE2, 0x77, 0x97, 0x53, 0x60, 0xA4, 0xD6, 0xD4, 0x7E, 0x3B, 0xB3, 0x07, 0x14, 0xA8, 0x56,
+    0xC5, 0xAF, 0x7D, 0x44, 0x02, 0x74, 0x8F, 0x6A, 0xD9, 0x30, 0x22, 0x7F, 0xAC, 0x99, 0x3C, 0xF3,
+    0x0F, 0x41, 0xB6, 0x9C, 0xEE, 0x44, 0x45, 0x0D, 0x2B, 0xC0, 0x3F, 0xB9, 0x19, 0x65, 0x3B, 0xF9,
+    0x28, 0xD4, 0xB9, 0x5D, 0x3F, 0x78, 0x52, 0xEE, 0xE9, 0x3E, 0xDF, 0x7D, 0x44, 0xD3, 0xB5, 0xC8,
+    0xD3, 0x13, 0x03, 0xFC, 0xD3, 0xC7, 0x57, 0xF4, 0xFF, 0xFF, 0xCC, 0xB6, 0x0F, 0x09, 0x32, 0xE5,
+    0xBD, 0x6E, 0x66, 0x4F, 0x88, 0xD8, 0x65, 0x58, 0xF7, 0xB6, 0x66, 0x47, 0xFF, 0xD0, 0xCE, 0xEE,
+    0xF2, 0x5A, 0x3A, 0x6B, 0x44, 0xAE, 0xFB, 0x4E, 0x3E, 0x84, 0x92, 0x2D, 0xFB, 0x21, 0xBF, 0xAF,
+    0xFE, 0xD0, 0xCD, 0xEE, 0xDF, 0xF2, 0xDA, 0x21, 0x6A, 0xEA, 0xB5, 0x5E, 0xA1, 0x2E, 0x4D, 0x61,
+    0x3F, 0x28, 0xFA, 0xC4, 0xF5, 0x43, 0xB2, 0x5E, 0xFF, 0xE2, 0x38, 0xCD, 0xB6, 0xEC, 0xB8, 0xA2,
+    0x2B, 0x3B, 0xA2, 0xB8, 0x09, 0x27, 0x34, 0x21, 0xB3, 0x68, 0x96, 0x43, 0x37, 0x72, 0xE4, 0xA9,
+    0xEA, 0x16, 0xED, 0x03, 0x47, 0x8E, 0xEA, 0x8D, 0x42, 0x1E, 0x2F, 0x34, 0xEB, 0x6E, 0x23, 0x75,
+    0x49, 0xA7, 0xF0, 0x58, 0xA1, 0x4F, 0x70, 0xFF, 0x91, 0xA6, 0x72, 0x0D, 0x37, 0x33, 0xEC, 0xFF,
+    0xD9, 0x9E, 0x5A, 0xD2, 0x6C, 0xAA, 0xE9, 0x2B, 0x99, 0x34, 0x15, 0xFD, 0x76, 0x78, 0x9C, 0xD8,
+    0xFA, 0x6E, 0x2B, 0xCB, 0x1E, 0x1C, 0x93, 0x23, 0x27, 0x65, 0xDD, 0x89, 0x55, 0x1D, 0x87, 0x40,
+    0x34, 0xD2, 0x1C, 0x76, 0xE9, 0x33, 0x1C, 0xE2, 0x6D, 0xBB, 0x59, 0xAF, 0x3B, 0xD5, 0x8B, 0xFB,
+    0x3E, 0x3D, 0xEA, 0xDD, 0x96, 0x07, 0x9A, 0x04, 0x78, 0x73, 0x98, 0xCD, 0xB8, 0x6B, 0xE2, 0x46,
+    0x46, 0x55, 0xC2, 0xCD, 0xEC, 0x23, 0x03, 0x9E, 0x7A, 0xE2, 0x5F, 0xF2, 0x38, 0x25, 0x6B, 0x3D,
+    0x0C, 0xB5, 0xEC, 0x82, 0xCC, 0x3D, 0xEE, 0xE4, 0x9B, 0x8F, 0x05, 0x3D, 0x9D, 0x3E, 0x71, 0xE3,
+    0xE1, 0x21, 0x2C, 0x37, 0xAB, 0x9B, 0xF5, 0x90, 0xE3, 0xD7, 0x0E, 0xC5, 0xE5, 0xE0, 0x8C, 0xE1,
+    0x60, 0xA6, 0xFB, 0x8F, 0xA0, 0x15, 0x61, 0x1F, 0xAF, 0x79, 0xD5, 0xBC, 0x4A, 0x37, 0xFA, 0x11,
+    0x79, 0x41, 0x42, 0x5D, 0xEA, 0x42, 0x33, 0xBA, 0xF4, 0x24, 0xF3, 0x42, 0x2F, 0x65, 0x3F, 0x3B,
+    0xF5, 0xF8, 0x61, 0x18, 0x1D, 0x4E, 0xF8, 0xF0, 0x70, 0x6E, 0x38, 0x25, 0x1F, 0x1B, 0xFD, 0x69,
+    0x38, 0x5A, 0x7D, 0x7A, 0x62, 0xF4, 0x3E, 0x29, 0x55, 0x8D, 0x48, 0x3E, 0x25, 0x5B, 0x62, 0x5E,
+    0xD5, 0x03, 0x10, 0xCD, 0xDA, 0x44, 0x80, 0x4E, 0x5A, 0x4D, 0x28, 0x1C, 0x54, 0x1F, 0x3C, 0xEF,
+    0x54, 0x65, 0xFF, 0x94, 0x9D, 0xFF, 0x86, 0x73, 0x22, 0x3F, 0xFA, 0x89, 0x69, 0x7A, 0xFD, 0xB8,
+    0xC2, 0x97, 0xF9, 0x06, 0x94, 0xAB, 0x76, 0x40, 0xAC, 0x48, 0x4E, 0x0F, 0xFB, 0x71, 0xFB, 0x49,
+    0x12, 0xFD, 0x50, 0x66, 0xB6, 0x9D, 0xAE, 0x9F, 0xE0, 0x3A, 0xF9, 0xAC, 0xD9, 0xAE, 0xED, 0x81,
+    0xFD, 0x58, 0x76, 0x3F, 0x02, 0x54, 0xE1, 0x47, 0x6C, 0xDA, 0x7A, 0x00, 0xBF, 0x59, 0x75, 0x9D,
+    0xE7, 0x6B, 0xE4, 0xAF, 0xE3, 0x6B, 0xB2, 0xCD, 0x60, 0x16, 0xFE, 0xD1, 0x8F, 0xC6, 0xB4, 0xCD,
+    0xAB, 0xE6, 0x55, 0x60, 0x88, 0x43, 0x00, 0xB7, 0xB8, 0x19, 0x10, 0x23, 0x40, 0x33, 0xBA, 0xF1,
+    0x63, 0xB6, 0xFE, 0x0F, 0xF3, 0x02, 0x57, 0x2A, 0x03, 0x6B, 0x05, 0x16, 0x4D, 0xE1, 0x46, 0x3E,
+    0x93, 0x11, 0x9D, 0x71, 0xBB, 0xFB, 0x1A, 0xEF, 0x3E, 0x89, 0x3C, 0x7E, 0xF8, 0x93, 0xCC, 0x6E,
+    0x5C, 0x36, 0x3E, 0x16, 0xF5, 0x4D, 0x37, 0x92, 0x2A, 0xFB, 0xF5, 0xE6, 0x51, 0xAC, 0x07, 0xFC,
+    0x68, 0x53, 0x62, 0x8F, 0x53, 0x3B, 0x95, 0xE4, 0x5E, 0xD5, 0xDF, 0x36, 0x04, 0xA0, 0x5E, 0xF6,
+    0xC4, 0xD7, 0x66, 0x04, 0x7C, 0xA8, 0xD2, 0x8F, 0x24, 0x25, 0xAA, 0x78, 0x3B, 0x02, 0x6D, 0x6E,
+    0x33, 0xE0, 0xB3, 0xCF, 0x80, 0x9F, 0xBC, 0x7A, 0x1C, 0xBA, 0xF0, 0x31, 0x18, 0xE0, 0x47, 0x87,
+    0x0B, 0xDA, 0x93, 0xB2, 0xD3, 0xFC, 0xAE, 0x3E, 0x9D, 0x12, 0xC0, 0x7C, 0x40, 0x5D, 0xA1, 0xF0,
+    0xE9, 0xC7, 0xE7, 0x7F, 0xC5, 0x5D, 0x2A, 0x59, 0x0A, 0xB5, 0xC8, 0x86, 0x5D, 0x6B, 0x09, 0xB6,
+    0xD0, 0xA7, 0xAA, 0xD0, 0x4C, 0xA6, 0x60, 0x67, 0x36, 0x28, 0x78, 0xE8, 0xE9, 0x12, 0x5D, 0x74,
+    0x93, 0x46, 0x42, 0x9A, 0x4C, 0xC1, 0x16, 0x7A, 0xAC, 0xD0, 0xA6, 0xEA, 0xDD, 0xF8, 0x8B, 0x73,
+    0xF5, 0xFD, 0xF1, 0x3F, 0x8B, 0xFD, 0x8B, 0xB9, 0x78, 0x99, 0xFB, 0xD2, 0xC8, 0xDC, 0xAE, 0xC8,
+    0x64, 0x0B, 0x26, 0xF0, 0xF4, 0x75, 0xA7, 0xFF, 0xFA, 0xE4, 0x67, 0xD7, 0x54, 0xEC, 0x74, 0x20,
+    0xC1, 0x76, 0x3C, 0x20, 0xA4, 0x4D, 0x1F, 0xB1, 0x58, 0x7F, 0xCF, 0xA9, 0x46, 0xFA, 0xDB, 0xA7,
+    0x23, 0xD2, 0xD1, 0x09, 0xD0, 0xBD, 0x32, 0xEE, 0xA1, 0xCF, 0x36, 0x79, 0x70, 0xA9, 0x4E, 0x98,
+    0x48, 0xF8, 0x41, 0x53, 0xD5, 0x87, 0x1E, 0xFC, 0xE4, 0x13, 0x6E, 0x6E, 0xB3, 0x26, 0x2F, 0x7D,
+    0xF4, 0xD5, 0x4C, 0xB7, 0xA0, 0x93, 0x57, 0x12, 0xBD, 0xC8, 0x84, 0x1F, 0xFB, 0x19, 0x9F, 0xEA,
+    0xA2, 0xD1, 0xB3, 0x36, 0xE1, 0x83, 0x9B, 0xF4, 0xD3, 0x37, 0x75, 0xAE, 0x0A, 0xD5, 0xC2, 0x06,
+    0x2B, 0x3E, 0x30, 0x28, 0x0B, 0xD7, 0x19, 0x9F, 0x4D, 0xE1, 0x67, 0x96, 0xA7, 0xFA, 0xD0, 0xBD,
+    0xDC, 0xB4, 0xD9, 0xB7, 0x5F, 0x7C, 0x53, 0xE4, 0x17, 0x25, 0x0D, 0xF2, 0x82, 0x8C, 0x6E, 0xC3,
+    0x27, 0x8D, 0xA7, 0xFD, 0x1D, 0x64, 0x45, 0x35, 0xB3, 0xA6, 0x89, 0xB6, 0xEA, 0xE5, 0xAF, 0x66,
+    0xE8, 0x22, 0xF5, 0x02, 0x3F, 0x73, 0x40, 0x5F, 0xBB, 0x9F, 0xE9, 0xAA, 0xCB, 0xBE, 0x19, 0x64,
+    0x67, 0xB3, 0x3A, 0x3D, 0xF6, 0x99, 0x9E, 0xBF, 0xBB, 0x04, 0x26, 0x1B, 0x74, 0x64, 0x66, 0xDD,
+    0xBD, 0x5C, 0x3B, 0x80, 0xE7, 0xFC, 0x84, 0x4B, 0x79, 0x6C, 0x18, 0x88, 0x60, 0xB6, 0x61, 0x34,
+    0x8B, 0x5D, 0xCC, 0xC2, 0x15, 0x05, 0x1F, 0x2F, 0xE9, 0x92, 0xA7, 0x1B, 0xBB, 0xE8, 0x47, 0xF7,
+    0xD6, 0x30, 0xDA, 0x0F, 0x24, 0x1A, 0x59, 0xA1, 0x7F, 0x70, 0xFA, 0x12, 0x8D, 0x31, 0x2B, 0xD5,
+    0xE8, 0x53, 0x93, 0x1B, 0xCD, 0x72, 0xCD, 0x38, 0x79, 0x70, 0x1A, 0xCB, 0x5D, 0x35, 0x24, 0x8D,
+    0x24, 0x90, 0x19, 0xCA, 0x00, 0xAB, 0x1B, 0x59, 0xCD, 0xC2, 0x25, 0x77, 0xF8, 0xA4, 0xC6, 0xE8,
+    0x77, 0x7F, 0xDC, 0x10, 0xB1, 0x52, 0xA8, 0xDF, 0x97, 0x50, 0x4F, 0x6E, 0xAA, 0xA7, 0x6A, 0xB1,
+    0x99, 0xAD, 0x9A, 0x19, 0x28, 0x0C, 0xE1, 0x0A, 0x09, 0xFE, 0x17, 0x24, 0xB8, 0x77, 0x37, 0x6A,
+    0x99, 0xF5, 0xDC, 0xCF, 0x1E, 0xE9, 0x7A, 0xAA, 0x9E, 0x69, 0x82, 0xD0, 0xA5, 0x4E, 0x93, 0x56,
+    0x13, 0x7E, 0x0B, 0x37, 0x30, 0xC8, 0xC0, 0x4A, 0x9B, 0xBB, 0xA9, 0x12, 0xBB, 0x6A, 0xF0, 0xFC,
+    0xC9, 0xEB, 0xF6, 0x06, 0x56, 0x0A, 0x66, 0x1B, 0x46, 0xCE, 0xD9, 0x68, 0x63, 0x33, 0xD9, 0xCC,
+    0xC6, 0x25, 0x5D, 0x72, 0xA9, 0x99, 0xAB, 0xC5, 0xAE, 0xF8, 0x5F, 0x90, 0x60, 0x3F, 0x90, 0x48,
+    0x2F, 0x81, 0xFA, 0xD1, 0xF5, 0x17, 0x7E, 0x0C, 0x7D, 0xE0, 0xF7, 0x6D, 0x61, 0xA0, 0x13, 0x19,
+    0x11, 0xC9, 0xBA, 0x34, 0x26, 0x00, 0x81, 0xE7, 0xF5, 0xCC, 0x8A, 0xE6, 0x70, 0x74, 0x89, 0x97,
+    0x0E, 0x57, 0xC6, 0x8B, 0xB1, 0xDF, 0x9C, 0x4C, 0xAC, 0xB8, 0x27, 0xF3, 0x4A, 0xF6, 0x82, 0xA7,
+    0xFB, 0xFA, 0x37, 0xDF, 0x9B, 0x87, 0xAD, 0x91, 0xD8, 0xA7, 0x63, 0xCB, 0xDB, 0x80, 0x9D, 0xA9,
+    0x56, 0xCC, 0x06, 0xFA, 0xEF, 0x1C, 0x3E, 0x77, 0x53, 0xC7, 0xFC, 0x0E, 0xAD, 0x44, 0x27, 0x13,
+    0x76, 0x06, 0x3D, 0x90, 0xED, 0x23, 0x6E, 0xA4, 0x56, 0x8B, 0x6D, 0xD3, 0xC3, 0xFA, 0x09, 0x37,
+    0x61, 0xE7, 0xA7, 0x4D, 0xF9, 0x49, 0x86, 0x2E, 0x74, 0x12, 0x1B, 0x89, 0x46, 0x76, 0x39, 0xC4,
+    0x5D, 0xAA, 0x15, 0x23, 0xC9, 0xC8, 0x4C, 0x19, 0x58, 0x5D, 0x5A, 0xCD, 0x72, 0xC9, 0xF3, 0xD7,
+    0x2B, 0xF8, 0x89, 0x57, 0xE9, 0x37, 0xBC, 0x44, 0xDC, 0x88, 0xBD, 0xD9, 0xB6, 0x26, 0x47, 0xDB,
+    0xE5, 0xC8, 0x4D, 0xF7, 0x11, 0x37, 0x86, 0x3A, 0x7F, 0xB5, 0x2A, 0x97, 0x0C, 0x1B, 0xDD, 0x46,
+    0x5D, 0x38, 0xA4, 0xC9, 0xC0, 0xDA, 0xE6, 0xEE, 0xBB, 0x62, 0xD7, 0x27, 0x57, 0xE9, 0xC5, 0x48,
+    0xBF, 0xA9, 0x99, 0xBC, 0x07, 0x14, 0xCB, 0x29, 0xAC, 0xDF, 0xB3, 0x9F, 0x32, 0xC1, 0x8D, 0xD7,
+    0xE5, 0x4F, 0xD3, 0xD7, 0xB1, 0x79, 0x6F, 0x66, 0xD8, 0x68, 0x24, 0xD2, 0xA7, 0x9B, 0xE6, 0xA9,
+    0x2D, 0x36, 0x82, 0xE4, 0x87, 0xD0, 0xC9, 0xBB, 0x11, 0x9B, 0x25, 0xC3, 0x67, 0xEB, 0x15, 0x08,
+    0xB7, 0x9E, 0x64, 0x90, 0x1F, 0x4C, 0x96, 0xCC, 0x53, 0x47, 0xFC, 0x5E, 0x5D, 0x14, 0xE3, 0xA1,
+    0x5E, 0x15, 0xEF, 0x87, 0xE3, 0xDB, 0x67, 0x8F, 0x29, 0xD7, 0xE7, 0x1E, 0x81, 0x55, 0xE7, 0x8A,
+    0xD0, 0x2C, 0x76, 0xA5, 0x8F, 0xB6, 0xD8, 0x05, 0x97, 0x7D, 0xA2, 0x4B, 0x2B, 0x0C, 0x4D, 0xA6,
+    0x2A, 0x3E, 0xD2, 0xE4, 0x15, 0xFC, 0x6F, 0xCC, 0xB0, 0xB6, 0x89, 0x3A, 0xF7, 0xE0, 0x7F, 0x75,
+    0xD5, 0x83, 0x37, 0xED, 0xE4, 0xB2, 0x11, 0xBA, 0x47, 0x43, 0xC6, 0xCB, 0x06, 0x9D, 0xC4, 0x53,
+    0x2A, 0x9B, 0x82, 0xFF, 0x43, 0x9F, 0xDA, 0xE3, 0xEB, 0x24, 0x66, 0x3D, 0x14, 0xE9, 0xFA, 0xD1,
+    0xCA, 0xF4, 0xEF, 0x21, 0xED, 0x47, 0xA9, 0xA6, 0x9F, 0x57, 0x99, 0xA1, 0x92, 0x0C, 0xED, 0x2B,
+    0x23, 0xA6, 0xB4, 0x49, 0x95, 0x67, 0xD1, 0xED, 0x17, 0x7E, 0x10, 0x44, 0x5B, 0x4D, 0xA1, 0xDA,
+    0x6C, 0xC1, 0xAE, 0x75, 0xF9, 0x1B, 0xD4, 0xE5, 0xFD, 0xB7, 0xF7, 0x01, 0x75, 0x22, 0x89, 0x21,
+    0xFA, 0xD1, 0x6C, 0xB8, 0x6C, 0x17, 0x5C, 0x76, 0x59, 0xA3, 0xBD, 0x4D, 0xEE, 0x12, 0x4D, 0xF6,
+    0x91, 0x26, 0xFB, 0x80, 0x9B, 0xFA, 0x80, 0x1B, 0x7B, 0x68, 0x53, 0x0F, 0x3E, 0xF6, 0x81, 0x41,
+    0x0F, 0xCD, 0xAA, 0x9E, 0x7D, 0x34, 0x64, 0x9C, 0x48, 0xD4, 0x24, 0xE6, 0x9D, 0x5A, 0x4F, 0x71,
+    0x5A, 0xA9, 0xE1, 0xDA, 0x29, 0xA3, 0x61, 0x95, 0x1B, 0xA7, 0x89, 0x9A, 0x74, 0xFA, 0xA0, 0xD3,
+    0xE9, 0xFA, 0xD4, 0xAB, 0x98, 0xBB, 0x9D, 0x04, 0xC4, 0xCA, 0xAC, 0xF9, 0x67, 0x66, 0xDD, 0xF3,
+    0x61, 0x06, 0xAA, 0x65, 0x4F, 0x49, 0x5B, 0xB1, 0x99, 0x3D, 0x1B, 0x8D, 0xE6, 0xBA, 0xA8, 0x4B,
+    0xF4, 0x68, 0x32, 0xA5, 0x24, 0x56, 0x7E, 0x66, 0x79, 0xCA, 0x8D, 0xCD, 0x77, 0x7E, 0x2D, 0x6D,
+    0xD5, 0x5F, 0x2C, 0xC5, 0xC9, 0xDA, 0x4A, 0x18, 0x24, 0xC8, 0xA8, 0xB9, 0xBF, 0x8F, 0x63, 0xB9,
+    0x1F, 0xBF, 0xB6, 0x3E, 0x86, 0x93, 0xEB, 0x59, 0x87, 0xBA, 0x9D, 0x3E, 0xDB, 0x55, 0x7D, 0x84,
+    0x1D, 0xFE, 0x83, 0xC8, 0xEE, 0x39, 0x7D, 0xA7, 0x2C, 0x9F, 0x7C, 0x60, 0x7D, 0x01, 0xDA, 0x3F,
+    0x98, 0xC0, 0x66, 0x0F, 0xAC, 0xD5, 0x0C, 0x3E, 0xB8, 0x80, 0x89, 0x8F, 0x9B, 0xCF, 0x3F, 0x38,
+    0x2A, 0x37, 0x93, 0x4B, 0x54, 0x62, 0x57, 0xE8, 0x26, 0x9F, 0xA8, 0xCA, 0xC7, 0x82, 0xBB, 0x1F,
+    0xCC, 0x20, 0x9F, 0x3D, 0x3B, 0x3B, 0x3B, 0xBB, 0xB7, 0x1F, 0xFB, 0x97, 0xA2, 0x9F, 0x97, 0x10,
+    0x29, 0x58, 0xF9, 0xF3, 0x2F, 0x6D, 0x17, 0x17, 0x05, 0xB7, 0x62, 0x56, 0x58, 0xF0, 0x13, 0x55,
+    0x81, 0x19, 0xD1, 0xEF, 0x96, 0xE5, 0x4A, 0x53, 0x8B, 0x89, 0x76, 0xD9, 0xC3, 0x1A, 0x4D, 0xDE,
+    0x7D, 0xC5, 0xC7, 0xB9, 0xFF, 0x53, 0x54, 0x41, 0xCD, 0xA7, 0xF7, 0x2F, 0x66, 0xFD, 0x43, 0x64,
+    0xA6, 0x8F, 0xD0, 0x8A, 0x64, 0xFA, 0xFD, 0x5B, 0x05, 0xC7, 0x91, 0x24, 0x15, 0xCE, 0x3E, 0xEE,
+    0x7F, 0xA8, 0x33, 0x46, 0x3F, 0x9D, 0x76, 0x0B, 0xAF, 0x7F, 0x38, 0xBA, 0x09, 0x36, 0xE8, 0x68,
+    0xF5, 0x48, 0x9A, 0xA7, 0x51, 0xC3, 0xEF, 0x0A, 0x2B, 0x7F, 0xF2, 0x65, 0x9D, 0x8D, 0x1C, 0xD3,
+    0x6A, 0x65, 0xFF, 0xAE, 0x01, 0xCF, 0x1E, 0x96, 0xD7, 0xFD, 0x57, 0xF9, 0xB1, 0x05, 0x44, 0x62,
+    0x27, 0xA9, 0x12, 0x59, 0xFA, 0xDF, 0x5D, 0xAA, 0x0D, 0xE9, 0x19, 0xCC, 0x86, 0x13, 0xBA, 0xB4,
+    0x61, 0x05, 0x37, 0x09, 0x0C, 0xB1, 0xCE, 0x3E, 0xD0, 0xA5, 0x7A, 0xE9, 0x12, 0x4D, 0x6E, 0x16,
+    0x37, 0x51, 0x2D, 0xDD, 0x6C, 0x67, 0x10, 0x99, 0xCC, 0xAA, 0xF9, 0x46, 0x3D, 0xB4, 0xFA, 0xA5,
+    0x37, 0xA7, 0x47, 0x9A, 0x1A, 0xFD, 0x0E, 0x41, 0x2D, 0x81, 0xAF, 0xFB, 0x54, 0x4B, 0xAE, 0xD6,
+    0x66, 0xBB, 0xFF, 0xBE, 0xC8, 0x8A, 0xC8, 0xE2, 0xA5, 0xD0, 0xC8, 0x54, 0xC9, 0xDB, 0x70, 0xEB,
+    0x24, 0x7D, 0x3F, 0x7C, 0x78, 0xE3, 0x3A, 0x49, 0x59, 0x9E, 0xB8, 0xDE, 0xBF, 0x38, 0x2E, 0xE0,
+    0x73, 0x94, 0x6A, 0xAE, 0xB3, 0x1B, 0xBB, 0xE4, 0x53, 0x1F, 0xFB, 0xD4, 0x8F, 0x3E, 0x02, 0xF7,
+    0xEC, 0x66, 0xC5, 0x88, 0xD9, 0x4C, 0xA9, 0x16, 0x9B, 0x9B, 0xC9, 0x45, 0xCF, 0x4F, 0x69, 0x9B,
+    0x9F, 0xE3, 0xF3, 0x14, 0xB3, 0x54, 0xB3, 0xCD, 0x75, 0x76, 0xA3, 0x1B, 0xDB, 0xD4, 0x25, 0x1F,
+    0x7D, 0xEA, 0x43, 0x1F, 0x87, 0xD0, 0x27, 0x09, 0xFD, 0x28, 0xC9, 0xC7, 0xFE, 0x24, 0x82, 0xCD,
+    0x5A, 0x15, 0xBB, 0xD5, 0x6B, 0x25, 0x76, 0x35, 0x9B, 0x5D, 0xCD, 0x6A, 0x4B, 0x55, 0xEC, 0x62,
+    0xE7, 0x5A, 0xDB, 0x48, 0x6D, 0xEC, 0x82, 0xE7, 0x79, 0xBE, 0x7E, 0x24, 0xA7, 0x55, 0x0F, 0xE0,
+    0xB5, 0x6E, 0xC2, 0x65, 0xEA, 0xE2, 0x27, 0xBA, 0x19, 0x57, 0xFA, 0x91, 0x2E, 0xE3, 0x16, 0x1F,
+    0xE9, 0x46, 0x5C, 0x7E, 0x16, 0x6E, 0x81, 0x09, 0xFF, 0x0B, 0xDD, 0x9A, 0xB1, 0x8F, 0x25, 0xC9,
+    0x7D, 0xDF, 0x3F, 0xD5, 0x75, 0x33, 0x2D, 0xA9, 0x61, 0xD5, 0x1A, 0xB8, 0x05, 0x04, 0x1D, 0xAC,
+    0x62, 0xA0, 0x48, 0xB8, 0x63, 0xFB, 0x0F, 0x20, 0xB7, 0xEA, 0x1C, 0xD0, 0x01, 0x83, 0x9B, 0x60,
+    0x1F, 0x03, 0x5E, 0xC0, 0x54, 0xA0, 0x0D, 0x6D, 0xA2, 0xC0, 0x02, 0xF6, 0xAE, 0x9B, 0x36, 0x0C,
+    0x86, 0x1E, 0x03, 0xA4, 0x1D, 0x38, 0xB0, 0x82, 0x13, 0xC0, 0x1D, 0x05, 0xEB, 0x80, 0x80, 0x05,
+    0x68, 0x67, 0xBA, 0x28, 0x06, 0x0C, 0x1C, 0xB8, 0x29, 0x4A, 0x50, 0xE0, 0x80, 0x2D, 0x6A, 0x69,
+    0x49, 0xC7, 0xE0, 0x8A, 0x54, 0x9D, 0xAF, 0x77, 0xB7, 0xAA, 0x7F, 0x0E, 0xAA, 0xDF, 0x9B, 0xDD,
+    0x23, 0x21, 0xC8, 0x81, 0x03, 0x7B, 0xB0, 0xDB, 0xF3, 0xE6, 0xBD, 0x7A, 0xD5, 0x55, 0xBF, 0xFA,
+    0xD5, 0xF7, 0xFB, 0xFD, 0x7D, 0xAB, 0x81, 0xDF, 0xE6, 0x03, 0xD0, 0x45, 0x67, 0x68, 0x4B, 0x5B,
+    0xA0, 0xCD, 0x5D, 0x06, 0x1D, 0xF5, 0xC2, 0xCF, 0xFF, 0x9C, 0x1D, 0x0E, 0x87, 0x03, 0x56, 0x44,
+    0xB6, 0xFD, 0xCA, 0x74, 0x75, 0x55, 0x40, 0xE0, 0x21, 0x6C, 0xF0, 0x10, 0x0A, 0xFC, 0x2B, 0x54,
+    0x81, 0x0B, 0x9A, 0x0C, 0xA0, 0xEB, 0x75, 0x05, 0xD0, 0x09, 0xA0, 0x7D, 0x7E, 0xF5, 0x47, 0xD0,
+    0x89, 0x64, 0x30, 0x22, 0x09, 0xCC, 0x02, 0x60, 0x67, 0x80, 0x3E, 0xDC, 0x5E, 0xDD, 0x48, 0x03,
+    0x6E, 0xA4, 0x1D, 0x19, 0x3C, 0x66, 0x64, 0x82, 0xDE, 0x23, 0xE0, 0x38, 0x17, 0x11, 0x61, 0x10,
+    0x91, 0xC2, 0x24, 0x22, 0xF9, 0x95, 0xC1, 0xFE, 0x17, 0x00, 0x54, 0xA9, 0x7F, 0xC9, 0x08, 0xC0,
+    0x14, 0x01, 0x70, 0xB5, 0xA9, 0x1B, 0x00, 0xB0, 0xEF, 0xCC, 0x00, 0xE6, 0xBB, 0x2B, 0x40, 0x37,
+    0x6F, 0x00, 0x3A, 0xF6, 0x01, 0x68, 0x52, 0x1B, 0x01, 0xB5, 0xD6, 0x8E, 0x32, 0xCE, 0x03, 0xEF,
+    0xD7, 0x01, 0xBB, 0x3A, 0xB7, 0x7E, 0x64, 0x02, 0x8C, 0x88, 0xCC, 0xD0, 0x89, 0x48, 0x82, 0xF6,
+    0xF9, 0xD5, 0xD5, 0x56, 0x27, 0xEC, 0x02, 0x2A, 0x83, 0x89, 0x50, 0xA0, 0xC9, 0x30, 0x01, 0x93,
+    0xC7, 0x01, 0x76, 0xC1, 0xCD, 0xD0, 0x6D, 0x6F, 0x8B, 0x8C, 0x0C, 0xB2, 0x8A, 0x2C, 0x38, 0x29,
+    0x9C, 0x1D, 0x0E, 0x87, 0xFB, 0x58, 0x11, 0xC9, 0xFB, 0x95, 0xE9, 0xEA, 0x0F, 0x57, 0x10, 0x54,
+    0x82, 0x0D, 0x15, 0xA1, 0xD0, 0x44, 0x54, 0xA1, 0x09, 0xBF, 0x28, 0xD8, 0xEB, 0x05, 0xD0, 0x8A,
+    0x3C, 0x85, 0x4E, 0x64, 0x03, 0xF3, 0xF1, 0x97, 0x24, 0x60, 0x16, 0xDC, 0x8C, 0x9D, 0x31, 0x0B,
+    0x7D, 0xC0, 0xC4, 0xFD, 0xEA, 0xC6, 0xE3, 0x75, 0x61, 0xF0, 0xD8, 0x99, 0x09, 0xDC, 0x88, 0xA0,
+    0x84, 0x73, 0xB9, 0x9A, 0x32, 0x83, 0x88, 0x2C, 0x4C, 0x22, 0xCF, 0x6E, 0x03, 0xFD, 0xE5, 0xAB,
+    0x4B, 0x18, 0x44, 0x56, 0xB4, 0x88, 0x64, 0x7E, 0xF9, 0x41, 0xB0, 0x2B, 0x6C, 0x98, 0x88, 0x5E,
+    0xB1, 0x33, 0x66, 0x66, 0xF0, 0x0C, 0xA8, 0x42, 0x93, 0xE9, 0x22, 0x66, 0xC1, 0x8D, 0x38, 0xDF,
+    0x64, 0x54, 0xC1, 0x05, 0x5A, 0x91, 0x15, 0x7A, 0x91, 0x15, 0xB6, 0xC3, 0xB4, 0xA2, 0x13, 0x36,
+    0x61, 0x03, 0x76, 0x61, 0x02, 0x17, 0x9A, 0x0C, 0x82, 0x59, 0xD0, 0x19, 0xE7, 0x31, 0x8B, 0xCA,
+    0x30, 0xF8, 0x2E, 0xA2, 0x57, 0x5C, 0x60, 0x08, 0xE7, 0x72, 0xF5, 0x38, 0x2B, 0x11, 0x91, 0xB1,
+    0x13, 0x91, 0xCB, 0x97, 0xB3, 0xF6, 0xFE, 0x4B, 0x59, 0x5B, 0x5E, 0xCA, 0xDA, 0x0C, 0x1B, 0x64,
+    0x28, 0xB0, 0xA2, 0x0A, 0x24, 0x9A, 0x0C, 0x11, 0x9D, 0xC1, 0xBF, 0x9A, 0xB5, 0x11, 0xA0, 0x8B,
+    0x50, 0xD7, 0xF2, 0xEF, 0xCD, 0xDA, 0xD3, 0x75, 0xF0, 0x50, 0x17, 0x1C, 0x04, 0xE0, 0x5C, 0x2E,
+    0x81, 0x41, 0x0A, 0x30, 0x1D, 0x73, 0xF6, 0x70, 0x38, 0x1C, 0xEE, 0x43, 0x2B, 0x22, 0xB2, 0x70,
+    0xDC, 0x5C, 0x34, 0xE5, 0x30, 0x79, 0xA0, 0x9B, 0xEB, 0xEA, 0xBA, 0xFD, 0x96, 0x7B, 0x1A, 0xB6,
+    0xB3, 0xCA, 0x00, 0xFD, 0x3E, 0xB6, 0x5C, 0xEF, 0xDF, 0xCE, 0x6C, 0xF5, 0xED, 0x3A, 0xF0, 0x15,
+    0x1B, 0x80, 0x6E, 0xAE, 0xC3, 0x70, 0x75, 0x56, 0x4D, 0xC2, 0xCC, 0x80, 0x09, 0xB5, 0xB3, 0x6B,
+    0x54, 0x06, 0x74, 0xAC, 0x53, 0xEC, 0x3D, 0x6E, 0x04, 0x55, 0x63, 0x83, 0x99, 0xD1, 0x11, 0xB8,
+    0x01, 0x1B, 0x6A, 0x14, 0x26, 0x38, 0x97, 0xED, 0x4A, 0xB6, 0x4B, 0x06, 0x11, 0x11, 0x59, 0x1A,
+    0x11, 0x11, 0x11, 0x6F, 0x62, 0xCD, 0x44, 0x37, 0xD6, 0x50, 0x15, 0x00, 0xE7, 0xF5, 0x3E, 0x48,
+    0x13, 0xEA, 0x7D, 0xEE, 0x01, 0x58, 0x4F, 0x02, 0x78, 0x48, 0xE3, 0x01, 0x2E, 0xFF, 0x9F, 0xC0,
+    0x99, 0x66, 0x45, 0x1D, 0x0E, 0xA8, 0x4C, 0x27, 0xB4, 0x22, 0x18, 0xC1, 0x48, 0x68, 0xA5, 0x30,
+    0x08, 0xAD, 0x2C, 0xB8, 0x51, 0xC9, 0x86, 0x6A, 0x23, 0xCE, 0xEB, 0xF5, 0x97, 0xA0, 0x59, 0x5F,
+    0x5A, 0xBE, 0x61, 0xCF, 0x8E, 0xF7, 0x98, 0xB8, 0x01, 0xE0, 0x1E, 0x1B, 0x35, 0x19, 0x7A, 0x4A,
+    0x8D, 0x14, 0xC6, 0xE7, 0x6E, 0xAE, 0xAF, 0xBE, 0x93, 0x6D, 0x45, 0x30, 0xFB, 0x62, 0x93, 0x9A,
+    0x33, 0x4E, 0x64, 0x7F, 0x25, 0xFF, 0xF1, 0xE3, 0xC9, 0x03, 0x34, 0xA5, 0x8D, 0x2E, 0x00, 0x74,
+    0x6B, 0x17, 0xEB, 0x34, 0x6D, 0xEC, 0x96, 0x9A, 0xAE, 0x6E, 0x36, 0x73, 0x9B, 0x2A, 0x1A, 0x9A,
+    0xA0, 0x33, 0xA0, 0x05, 0x1B, 0x9A, 0x0D, 0x30, 0x99, 0x3E, 0x20, 0x80, 0x8B, 0xB8, 0x91, 0x69,
+    0x04, 0x99, 0x71, 0x1E, 0x37, 0xA3, 0xC5, 0xAB, 0xE9, 0x92, 0x3E, 0xD1, 0x17, 0x8C, 0x64, 0x4C,
+    0xC1, 0x25, 0xAC, 0xAC, 0x68, 0x41, 0xED, 0x1B, 0xED, 0x0E, 0xF0, 0xD5, 0x0F, 0x60, 0x90, 0x0D,
+    0x2D, 0xB2, 0x61, 0x7F, 0xFC, 0x46, 0xE1, 0x9A, 0x76, 0xD5, 0x11, 0x13, 0xCD, 0x48, 0x1F, 0x3E,
+    0x0F, 0x1B, 0x77, 0xEA, 0xFA, 0xD8, 0xB0, 0xE3, 0xB3, 0x5D, 0xD0, 0xB2, 0x81, 0x95, 0x04, 0x83,
+    0xAC, 0x40, 0x9F, 0x00, 0x1B, 0x01, 0x17, 0xF6, 0x9D, 0xA3, 0xF3, 0x9B, 0x60, 0x7E, 0x9A, 0x60,
+    0x7A, 0x27, 0xD2, 0xE6, 0x7E, 0x61, 0x0A, 0xC3, 0xF3, 0xA9, 0x30, 0x89, 0x04, 0x1E, 0xC8, 0x53,
+    0x50, 0x17, 0x35, 0x7D, 0x38, 0x3B, 0x1C, 0x68, 0x45, 0x46, 0x2D, 0x12, 0x94, 0xC8, 0x88, 0xC8,
+    0x4C, 0x53, 0xA0, 0xD9, 0xF6, 0xEE, 0xA6, 0x7D, 0x8B, 0x0E, 0x01, 0xCC, 0x0C, 0xC3, 0x02, 0x6D,
+    0x82, 0x69, 0xDD, 0x31, 0xBA, 0xD4, 0x86, 0xD7, 0x7B, 0xC3, 0x6B, 0x57, 0x1B, 0x16, 0xB3, 0x40,
+    0x1B, 0xC9, 0x3A, 0x41, 0x93, 0xC9, 0xAA, 0x36, 0xCC, 0x7B, 0x8F, 0x19, 0x17, 0xC0, 0x7E, 0x3F,
+    0x63, 0x16, 0xE8, 0x7E, 0xBA, 0xD2, 0x26, 0x68, 0xCA, 0x5A, 0xF7, 0x97, 0xAC, 0xFB, 0xAD, 0xD7,
+    0x3A, 0x35, 0xBB, 0x67, 0x65, 0x97, 0xEA, 0xED, 0x75, 0xAE, 0xB7, 0x3F, 0x97, 0x4B, 0x1A, 0xB9,
+    0xC4, 0xCA, 0x86, 0x11, 0xA1, 0x13, 0xF1, 0xAD, 0x48, 0xF8, 0x14, 0x25, 0xFF, 0x26, 0x00, 0xDF,
+    0xC6, 0x00, 0x70, 0x4D, 0xB7, 0x43, 0x4F, 0x5B, 0x29, 0x2D, 0x75, 0x0B, 0x80, 0x12, 0xA9, 0x7C,
+    0x6E, 0x77, 0x1E, 0xE4, 0x75, 0x7E, 0xD1, 0xCF, 0xDD, 0xC3, 0x7D, 0xEE, 0x1E, 0xEE, 0x9F, 0x6E,
+    0xDA, 0xD6, 0x95, 0xF4, 0x74, 0x09, 0xBA, 0xF5, 0x76, 0x74, 0x6C, 0xA0, 0x04, 0x70, 0x1E, 0x25,
+    0x23, 0xD8, 0x99, 0x46, 0x16, 0xE8, 0x22, 0x8D, 0xD4, 0x69, 0x34, 0xFF, 0xAB, 0x36, 0x6C, 0x52,
+    0x6D, 0xA8, 0x93, 0x1B, 0xC1, 0x06, 0x1D, 0xCD, 0x0C, 0x5D, 0xD4, 0xB1, 0xCE, 0x57, 0xC7, 0xDA,
+    0xA3, 0x8E, 0x08, 0x30, 0xFC, 0xF3, 0x88, 0x1B, 0xA1, 0xFF, 0xDE, 0x82, 0x9D, 0xA1, 0xFB, 0x64,
+    0xA1, 0x8D, 0xA0, 0x65, 0xA9, 0xB7, 0x96, 0xA5, 0x2E, 0xE0, 0x30, 0xD7, 0x05, 0xEC, 0xE7, 0xBA,
+    0xA3, 0x4D, 0xAC, 0xB8, 0xF4, 0xC6, 0xE6, 0xE9, 0x36, 0xCF, 0x20, 0x2B, 0x4E, 0x32, 0xBD, 0x14,
+    0xAC, 0x08, 0x70, 0x76, 0xB8, 0x4F, 0xB3, 0x62, 0x65, 0xC3, 0x16, 0xAC, 0xAC, 0x4C, 0x05, 0x26,
+    0xDF, 0x48, 0x06, 0xA1, 0x4B, 0xAF, 0xC1, 0x56, 0xD1, 0xA1, 0xE0, 0x3C, 0xA8, 0x42, 0x01, 0x9A,
+    0xDC, 0x24, 0x40, 0xE7, 0x76, 0x01, 0xF4, 0x5A, 0x01, 0x2C, 0xF5, 0x15, 0x63, 0x0A, 0x40, 0x27,
+    0x1B, 0x80, 0xF9, 0x78, 0xAA, 0xC4, 0xE0, 0x46, 0xC0, 0xCE, 0x7D, 0x00, 0xFA, 0x60, 0x17, 0xA0,
+    0x0F, 0x26, 0xD6, 0xB5, 0x59, 0x01, 0x37, 0xEA, 0x0C, 0x0C, 0x5E, 0x6D, 0x35, 0x19, 0xC5, 0x83,
+    0xC0, 0x14, 0x38, 0x97, 0x6F, 0xE0, 0x22, 0x83, 0x14, 0x6C, 0x66, 0x92, 0x4C, 0xBB, 0xD5, 0xF5,
+    0xB9, 0x00, 0xD4, 0xE1, 0x70, 0x38, 0x78, 0x10, 0x39, 0xE2, 0x9A, 0x6C, 0x1E, 0xDA, 0x67, 0x5F,
+    0xAA, 0x30, 0xBB, 0x73, 0xC0, 0x52, 0xE1, 0xF0, 0x7A, 0x07, 0xE1, 0x50, 0x37, 0x7E, 0x66, 0x00,
+    0xB0, 0x63, 0x17, 0x2B, 0x06, 0xCB, 0x4B, 0xB4, 0xD2, 0x2E, 0x47, 0x91, 0xD3, 0x07, 0x60, 0x87,
+    0x88, 0x26, 0xD5, 0x2E, 0x5C, 0xDD, 0xB4, 0xED, 0x52, 0x29, 0x2D, 0x57, 0x9A, 0xB0, 0x63, 0xDD,
+    0x9B, 0xB1, 0x76, 0x71, 0x03, 0x05, 0xEE, 0xF4, 0x01, 0x1B, 0x68, 0x7F, 0x58, 0xC9, 0x54, 0x36,
+    0xD4, 0xF4, 0x14, 0x23, 0x23, 0x22, 0x91, 0x61, 0xA6, 0x97, 0xAD, 0x4E, 0x66, 0x27, 0xBF, 0x7A,
+    0x51, 0x22, 0xD0, 0xC8, 0x06, 0x93, 0x80, 0x96, 0x15, 0x8C, 0x40, 0x27, 0x23, 0x18, 0xF1, 0x18,
+    0xF1, 0x60, 0xC5, 0xD3, 0x0F, 0x40, 0x3F, 0x8C, 0xBC, 0x3F, 0x00, 0xCE, 0x8D, 0xE4, 0x01, 0x70,
+    0x7D, 0x50, 0xEB, 0x00, 0xDC, 0xD8, 0xA0, 0xE3, 0x04, 0x14, 0x1B, 0xDA, 0x79, 0x02, 0xB2, 0x99,
+    0x4D, 0x98, 0x40, 0xAD, 0x66, 0xEE, 0xFD, 0x06, 0x4D, 0x32, 0xCB, 0x3D, 0x36, 0xD0, 0xB1, 0x8B,
+    0x4F, 0xD8, 0xA0, 0x8D, 0x6D, 0x5C, 0xD9, 0xA0, 0x5B, 0xDA, 0x9F, 0x45, 0x0A, 0x98, 0x59, 0xBF,
+    0x98, 0x29, 0x60, 0x82, 0x96, 0x40, 0x81, 0x7E, 0xD4, 0xE2, 0x55, 0x06, 0xE7, 0x1B, 0x41, 0x65,
+    0x70, 0xA8, 0x8C, 0xCA, 0x30, 0xC0, 0x4A, 0x93, 0xE1, 0x06, 0x2E, 0x69, 0x32, 0x6A, 0xF3, 0x40,
+    0xBB, 0x79, 0x27, 0x11, 0x98, 0x64, 0x99, 0x24, 0x02, 0x22, 0xF3, 0x3F, 0x10, 0xA1, 0x86, 0x1D,
+    0xA1, 0xFA, 0x1D, 0xA1, 0xCC, 0x8E, 0x50, 0x7A, 0x47, 0xA8, 0x1D, 0x78, 0x6E, 0xA1, 0xCC, 0xBD,
+    0xDC, 0x50, 0xAA, 0x0E, 0x6D, 0xA4, 0x4A, 0x1E, 0x44, 0x2A, 0x5F, 0x1C, 0x1B, 0xDA, 0xBD, 0x61,
+    0x17, 0x6B, 0xAF, 0x4D, 0xAE, 0x6C, 0xCF, 0xF6, 0xA9, 0x1E, 0x3F, 0xDD, 0xF0, 0x1F, 0x82, 0x50,
+    0x5F, 0xFD, 0xA0, 0xA2, 0xCE, 0x0A, 0x4C, 0x22, 0x09, 0x86, 0xA4, 0x64, 0xC6, 0x26, 0x1A, 0xA1,
+    0xCD, 0x60, 0xD6, 0x3A, 0xC7, 0xE0, 0x02, 0xE8, 0xDC, 0xAE, 0x40, 0x3F, 0x0B, 0xD0, 0x14, 0xBB,
+    0x00, 0xF6, 0x47, 0x19, 0x50, 0x9B, 0x0B, 0x80, 0xFD, 0x41, 0x06, 0x9A, 0x32, 0x8C, 0x80, 0xFB,
+    0xDE, 0x0A, 0xE8, 0x3C, 0x78, 0x60, 0xF8, 0xFA, 0x0A, 0x74, 0x71, 0x18, 0x81, 0xAD, 0xCD, 0x40,
+    0x3F, 0xBB, 0x00, 0xED, 0xDA, 0x54, 0x90, 0xB2, 0x11, 0x86, 0xC0, 0x34, 0xD3, 0x47, 0xB4, 0xFC,
+    0xED, 0x94, 0xA1, 0xAB, 0x31, 0xB1, 0x52, 0x60, 0x67, 0x8D, 0xAA, 0x3A, 0x0E, 0x17, 0xBB, 0x98,
+    0x99, 0x95, 0x48, 0x95, 0x1E, 0xFD, 0x87, 0xFF, 0xE1, 0x4A, 0x6A, 0xA4, 0xF5, 0x1E, 0x7D, 0x3B,
+    0xD7, 0x40, 0x4F, 0x55, 0xE0, 0x1D, 0x23, 0x62, 0x96, 0x8A, 0x42, 0xCE, 0x83, 0x1B, 0x6B, 0x34,
+    0xCB, 0x1E, 0xB8, 0x58, 0x83, 0xD9, 0x87, 0x1A, 0x60, 0xB9, 0x5D, 0x4A, 0xBB, 0xC7, 0x78, 0xAA,
+    0x71, 0x3F, 0xAE, 0xAE, 0x59, 0xEA, 0xFF, 0xA1, 0x76, 0x76, 0x5C, 0xF0, 0x23, 0xCA, 0x1D, 0x57,
+    0xA7, 0xD4, 0x85, 0xB0, 0xC5, 0x2B, 0x91, 0xA5, 0x13, 0xF1, 0x9D, 0x88, 0x77, 0x55, 0x58, 0x7E,
+    0xF9, 0xEA, 0xE2, 0xD3, 0xD2, 0xBC, 0xDB, 0xA1, 0x0E, 0xBD, 0x62, 0x16, 0xCC, 0x8C, 0x0B, 0x0C,
+    0xB0, 0xD1, 0x64, 0xF4, 0x8A, 0x89, 0x98, 0x19, 0x37, 0x32, 0x41, 0xA1, 0x4D, 0xB4, 0x91, 0x61,
+    0xA4, 0x0F, 0x76, 0x05, 0x11, 0xF1, 0x68, 0x91, 0x19, 0xEC, 0x87, 0x17, 0x47, 0x5D, 0x5B, 0xE5,
+    0x57, 0x95, 0x36, 0x6E, 0x3C, 0x15, 0x5D, 0x55, 0x29, 0xBB, 0x00, 0x9C, 0xCB, 0x37, 0x8E, 0xE9,
+    0xD0, 0x9D, 0x38, 0xEC, 0xAB, 0x1F, 0x00, 0x83, 0xC8, 0x88, 0x15, 0x91, 0xA0, 0xE4, 0xC7, 0xEF,
+    0x6E, 0xF4, 0x89, 0x66, 0x55, 0x1B, 0x74, 0xB3, 0x89, 0xD0, 0x23, 0xC0, 0xDA, 0x26, 0x68, 0x46,
+    0x17, 0x7E, 0x51, 0xDF, 0x55, 0xEB, 0x56, 0xD9, 0x57, 0x15, 0xCF, 0x30, 0x02, 0x6A, 0xBB, 0xD5,
+    0x84, 0x47, 0xF9, 0x03, 0x30, 0x05, 0xF8, 0x47, 0x48, 0xA0, 0x49, 0x8D, 0x2C, 0x6A, 0x0A, 0x35,
+    0x32, 0x8D, 0x88, 0x8C, 0x30, 0xC9, 0x0C, 0x9C, 0x79, 0xB8, 0x7B, 0x38, 0x1C, 0x0E, 0x17, 0x22,
+    0x22, 0xF2, 0x5D, 0x11, 0x11, 0xB1, 0x1F, 0x3E, 0x7E, 0x7E, 0x95, 0xAF, 0x71, 0xA3, 0xFE, 0x51,
+    0x64, 0xC3, 0xBC, 0x13, 0xDA, 0xC4, 0xC3, 0xB7, 0xE8, 0x83, 0x8A, 0x77, 0x98, 0x50, 0xC7, 0x51,
+    0x98, 0xF9, 0x24, 0xFC, 0x9B, 0x97, 0xEF, 0x3F, 0x52, 0xF3, 0xE1, 0x58, 0x4A, 0x54, 0xE9, 0x29,
+    0x3F, 0x37, 0x7C, 0x5E, 0xFD, 0xA2, 0x9A, 0x9E, 0x1E, 0x4B, 0x05, 0x2D, 0x12, 0x77, 0x1E, 0xBB,
+    0x7B, 0xB8, 0x98, 0x24, 0x29, 0x91, 0x3F, 0x11, 0xF1, 0xAD, 0x14, 0xA6, 0x19, 0xB6, 0x9A, 0x58,
+    0xB5, 0x7A, 0x71, 0x9E, 0x2E, 0xD1, 0xD4, 0x74, 0x35, 0x01, 0xDC, 0x48, 0x01, 0x26, 0xDA, 0x05,
+    0x54, 0xC6, 0x01, 0x3A, 0x35, 0x09, 0x30, 0x8B, 0x1D, 0x81, 0x3E, 0x64, 0x80, 0xA1, 0xAA, 0x87,
+    0x72, 0x0F, 0xA0, 0x79, 0x1E, 0x01, 0x5A, 0xF1, 0x00, 0x66, 0xE5, 0x36, 0xF2, 0x5C, 0x43, 0xA5,
+    0x04, 0x68, 0xFC, 0x00, 0x60, 0xBE, 0x1E, 0xA1, 0x02, 0x38, 0x34, 0x12, 0x01, 0x74, 0x65, 0x2F,
+    0xE5, 0x77, 0xBC, 0x57, 0x87, 0x03, 0xC0, 0x20, 0x09, 0x68, 0x6A, 0x29, 0xD9, 0xEC, 0xDA, 0x77,
+    0x04, 0xD4, 0x1F, 0x6E, 0x97, 0x15, 0xC0, 0x12, 0x5A, 0xE4, 0x85, 0x2C, 0x4A, 0xC6, 0x9B, 0x46,
+    0xFC, 0x10, 0xCC, 0xD2, 0x66, 0x13, 0x29, 0xF4, 0x3F, 0xC8, 0x98, 0xA0, 0x8A, 0x1B, 0x55, 0xC6,
+    0xFC, 0x24, 0xD2, 0x8F, 0x94, 0x09, 0x9D, 0xB0, 0x3F, 0x8C, 0x38, 0xDF, 0x64, 0x41, 0x47, 0xDC,
+    0x7F, 0x8F, 0x0C, 0xB4, 0x69, 0xF2, 0xDD, 0x82, 0xE8, 0x4C, 0x61, 0x08, 0x7D, 0x32, 0x61, 0x88,
+    0x4C, 0x22, 0xB2, 0xA2, 0xA4, 0xA2, 0xD4, 0xBF, 0xD8, 0x2E, 0x6A, 0x95, 0x52, 0x8B, 0xFF, 0xAA,
+    0x9A, 0x2E, 0x81, 0xA6, 0x26, 0xEC, 0x6F, 0x5D, 0x7D, 0x70, 0x1C, 0xFB, 0xDD, 0xC3, 0x05, 0x22,
+    0xC9, 0xC8, 0x46, 0x27, 0x1B, 0x93, 0x8C, 0x74, 0x65, 0xDF, 0xA8, 0x01, 0x33, 0x83, 0xDA, 0xEA,
+    0x8A, 0x9A, 0x58, 0xB3, 0x73, 0x18, 0xFB, 0x00, 0xE8, 0x5C, 0xF3, 0xD6, 0x7E, 0xBF, 0xCE, 0x56,
+    0xAA, 0xFF, 0xD0, 0xEE, 0x3B, 0xC2, 0x25, 0x6A, 0xD4, 0x6A, 0x98, 0x86, 0xF8, 0xB2, 0x64, 0xD3,
+    0x3F, 0xAB, 0xDF, 0x29, 0xFB, 0x3E, 0xF3, 0xBB, 0xD0, 0xA8, 0xB5, 0xDC, 0x4E, 0xD9, 0x53, 0xDD,
+    0x0D, 0x36, 0x9C, 0xC0, 0xDA, 0x8D, 0x9C, 0x8B, 0xA7, 0xDD, 0x7C, 0x5B, 0xEB, 0x62, 0x2F, 0x92,
+    0x10, 0x49, 0x55, 0x26, 0xDF, 0x3D, 0x5C, 0x30, 0xC8, 0xAA, 0x2B, 0xDE, 0x8D, 0x46, 0x0A, 0xF4,
+    0x73, 0xDD, 0x3C, 0x2F, 0x41, 0xD4, 0x91, 0x81, 0x64, 0xC7, 0xBB, 0xF5, 0x55, 0xBC, 0x7B, 0x09,
+    0xA2, 0xD8, 0x21, 0xAA, 0x8D, 0xB7, 0xDC, 0xB5, 0xD3, 0x54, 0x1B, 0x6F, 0x3B, 0xB3, 0xF3, 0x89,
+    0xB9, 0x8E, 0x9D, 0x1D, 0x69, 0x66, 0xAA, 0xAB, 0x70, 0xC2, 0xBB, 0xE5, 0x15, 0xBC, 0x53, 0x05,
+    0xCE, 0xE5, 0xF9, 0x95, 0x6C, 0xBE, 0x02, 0xB4, 0x84, 0x4E, 0x8E, 0xD4, 0x76, 0xDA, 0x48, 0xC7,
+    0xAD, 0xB4, 0x6F, 0x26, 0x50, 0xFB, 0xDB, 0x7B, 0x39, 0x45, 0xBF, 0xA7, 0x62, 0xDA, 0x3F, 0x1E,
+    0xE1, 0xEE, 0xE1, 0x42, 0x1D, 0x0E, 0x56, 0x36, 0x25, 0xF2, 0xD7, 0xB2, 0x31, 0xC8, 0xD2, 0x25,
+    0x10, 0x9A, 0x0C, 0x6E, 0x64, 0x03, 0x3B, 0xE3, 0x3C, 0x6D, 0xC4, 0x86, 0xDD, 0xC8, 0xB8, 0xFD,
+    0x58, 0xC0, 0xCE, 0xF4, 0x81, 0x2E, 0xD2, 0xAD, 0xE8, 0x0C, 0xF2, 0xE7, 0xEF, 0x6E, 0xD0, 0x8B,
+    0xC8, 0x88, 0xAA, 0xE6, 0xD0, 0xF9, 0xA3, 0x2F, 0xC6, 0x5B, 0x5C, 0xAA, 0xC9, 0xB1, 0xE7, 0x9C,
+    0x0D, 0xB7, 0xC0, 0xF6, 0xF2, 0xC7, 0x6A, 0xFA, 0xB3, 0x6A, 0x2E, 0x79, 0xA8, 0xF4, 0x7A, 0x76,
+    0xB8, 0x5F, 0xFF, 0x61, 0x25, 0x1B, 0xC9, 0x56, 0x0A, 0x56, 0x92, 0x91, 0x68, 0x25, 0xC1, 0xE4,
+    0x91, 0x1A, 0x5D, 0x81, 0xAD, 0x86, 0x7F, 0x83, 0x72, 0xE4, 0x23, 0x95, 0x8F, 0x5C, 0xDF, 0xE4,
+    0x23, 0x75, 0xE9, 0x8C, 0xAE, 0xF2, 0x5E, 0xAF, 0x47, 0x96, 0xD3, 0xA9, 0x2E, 0x59, 0xA2, 0x8D,
+    0x47, 0x0E, 0xAB, 0xDE, 0xCD, 0xFE, 0x6B, 0x67, 0x28, 0xB3, 0x1C, 0xD7, 0xCE, 0xCE, 0x47, 0x32,
+    0xB3, 0x81, 0xBE, 0xB2, 0x5D, 0x1F, 0x8E, 0x79, 0xE0, 0xC6, 0x23, 0x31, 0x3A, 0x5F, 0x53, 0xC6,
+    0x33, 0xF8, 0xCA, 0xA1, 0x30, 0x9D, 0x08, 0x70, 0x3A, 0x31, 0xE4, 0xB6, 0xD3, 0xDB, 0xF3, 0x2B,
+    0xB9, 0x7A, 0xBC, 0xF9, 0x9D, 0x99, 0x45, 0x12, 0xD3, 0xFE, 0x2A, 0xFE, 0x7F, 0x12, 0x0D, 0xFE,
+    0x4F, 0xA3, 0x21, 0x97, 0xA7, 0x68, 0xE4, 0x53, 0x34, 0x4E, 0x06, 0xE8, 0x71, 0x17, 0x1C, 0x8D,
+    0x90, 0x5B, 0xCE, 0x39, 0xE1, 0xF5, 0x2B, 0xDB, 0x01, 0xBA, 0x53, 0x61, 0xD9, 0x8D, 0xC7, 0x57,
+    0xE7, 0x95, 0x05, 0x41, 0x44, 0x0A, 0x5A, 0x44, 0x16, 0xEC, 0x87, 0x8F, 0x23, 0x5C, 0xE3, 0x3C,
+    0x4D, 0x54, 0x19, 0x4C, 0xE8, 0x22, 0xBC, 0x85, 0x0B, 0x70, 0x67, 0xE7, 0xE2, 0x74, 0x9B, 0xCF,
+    0xD3, 0x7D, 0x40, 0x8B, 0x3C, 0x05, 0x23, 0x92, 0xC1, 0x7D, 0xF3, 0x41, 0x46, 0x65, 0xCC, 0x4A,
+    0x17, 0x77, 0xBF, 0xB1, 0x0F, 0x6C, 0x30, 0xD1, 0xA6, 0x1D, 0xC9, 0x4C, 0x64, 0x82, 0xC1, 0xEB,
+    0x15, 0x9D, 0x31, 0x33, 0x43, 0x50, 0xF2, 0xE1, 0xE3, 0x6A, 0xBF, 0x8C, 0xFA, 0x53, 0xEE, 0x1E,
+    0x47, 0x2D, 0x1D, 0x38, 0x89, 0xE9, 0x93, 0x9A, 0x3E, 0x61, 0xD9, 0x09, 0xA6, 0x6E, 0xE1, 0xAC,
+    0x22, 0x55, 0xE2, 0x16, 0x84, 0x4E, 0x60, 0x75, 0xAB, 0xBE, 0x6B, 0xEB, 0x1F, 0x1F, 0x5B, 0x8B,
+    0xCC, 0xB5, 0xB5, 0x88, 0xEC, 0x0A, 0xFC, 0x30, 0xC5, 0xBD, 0x75, 0xB3, 0x1D, 0xD1, 0xCD, 0x85,
+    0x3D, 0x33, 0xBA, 0xB8, 0xF7, 0xDD, 0x54, 0xA3, 0x60, 0x83, 0xE9, 0x28, 0xAF, 0x5D, 0xD8, 0xF5,
+    0xB5, 0x59, 0x8E, 0x79, 0x14, 0x75, 0x55, 0xD8, 0x36, 0x55, 0xA4, 0xBB, 0x9A, 0x92, 0x92, 0x4B,
+    0xAC, 0x88, 0x2C, 0xBB, 0xC8, 0xDE, 0x3E, 0xED, 0x03, 0x9C, 0x1D, 0x0E, 0xA0, 0x44, 0x22, 0x58,
+    0x59, 0xA9, 0x5E, 0xC2, 0x3E, 0x8B, 0xCA, 0x16, 0xE5, 0x04, 0x89, 0xBB, 0x8F, 0x18, 0x4E, 0x49,
+    0xE2, 0xFE, 0xED, 0xC9, 0x23, 0x9E, 0x44, 0x96, 0xDD, 0x22, 0xDE, 0xD0, 0xA5, 0x0E, 0xAC, 0xFA,
+    0xAE, 0x7D, 0xC0, 0x44, 0xBD, 0x82, 0x54, 0x7F, 0xB8, 0x4D, 0xA8, 0x52, 0xED, 0x61, 0x13, 0xB1,
+    0xF1, 0x5C, 0xAE, 0xA6, 0xDC, 0x8A, 0xC8, 0xF6, 0xAA, 0x39, 0xFC, 0xE5, 0xBF, 0x05, 0x25, 0xB2,
+    0x81, 0x13, 0xC9, 0xB4, 0xCF, 0x0E, 0x12, 0xB9, 0x41, 0x89, 0x37, 0x81, 0x36, 0x93, 0xC1, 0xCD,
+    0xC6, 0xA3, 0x36, 0x3E, 0x73, 0x1C, 0xAC, 0xDC, 0x4A, 0x26, 0x81, 0xAB, 0xAB, 0xC7, 0x91, 0x5E,
+    0x64, 0xA3, 0xA9, 0xDE, 0x68, 0x5D, 0xD5, 0x97, 0xA7, 0x30, 0x01, 0xD8, 0xE5, 0x4D, 0xD0, 0xB9,
+    0x9D, 0x41, 0xBC, 0x80, 0x5B, 0xBA, 0x15, 0xBB, 0x32, 0x3C, 0x9F, 0xEA, 0x57, 0xA1, 0x95, 0xCD,
+    0x83, 0xBA, 0x7F, 0x8A, 0xD9, 0xAF, 0x3F, 0xDA, 0xE3, 0xD6, 0x4B, 0xA9, 0xB1, 0xAB, 0x0E, 0x74,
+    0x97, 0x30, 0xDB, 0x17, 0xAA, 0xCF, 0xA0, 0x0B, 0x5A, 0xC0, 0x2C, 0x4C, 0x1E, 0xB3, 0x42, 0xC1,
+    0xCE, 0x30, 0x04, 0xEC, 0xBC, 0x83, 0x44, 0x53, 0xAD, 0x9F, 0xFE, 0xB8, 0xEA, 0xAA, 0xA0, 0x57,
+    0x95, 0xD9, 0x09, 0xA3, 0x0F, 0x40, 0xD9, 0x2D, 0x6E, 0xCC, 0xCC, 0x24, 0x52, 0xBD, 0x05, 0xF3,
+    0xFC, 0xF1, 0xEE, 0x83, 0x6D, 0x0C, 0x1E, 0x9A, 0x8C, 0xAD, 0x0E, 0x9D, 0x1B, 0x9B, 0xCC, 0xE0,
+    0x41, 0x27, 0xFA, 0xD0, 0xAE, 0xC0, 0x84, 0x5E, 0x19, 0x46, 0xAA, 0x3C, 0xDF, 0x91, 0xAA, 0x4D,
+    0xB8, 0x65, 0xC7, 0x09, 0x25, 0x9E, 0x7E, 0xC6, 0x44, 0x4C, 0xC1, 0x26, 0xCE, 0xE5, 0x92, 0x61,
+    0x7B, 0x5C, 0x68, 0xEB, 0xA6, 0xD8, 0x60, 0x92, 0x95, 0x46, 0xB6, 0xA3, 0x10, 0xBB, 0x7F, 0xB2,
+    0x7D, 0x2E, 0x40, 0x4D, 0x22, 0x33, 0x38, 0x91, 0x0D, 0x5A, 0xF9, 0x83, 0xC9, 0x83, 0x9B, 0x55,
+    0x06, 0x5D, 0xA9, 0xCE, 0xCE, 0xF4, 0x23, 0xB5, 0x2E, 0x40, 0xAF, 0xE8, 0x58, 0x61, 0xAE, 0x22,
+    0x5B, 0x2D, 0x85, 0xF4, 0x5A, 0xDD, 0xC5, 0x19, 0xD4, 0xCE, 0xC9, 0x15, 0x96, 0x76, 0x07, 0xCA,
+    0x04, 0x37, 0x02, 0x37, 0x14, 0x6A, 0xC5, 0x0D, 0x38, 0x6F, 0x03, 0xE8, 0xCC, 0x0D, 0xD0, 0x07,
+    0x9D, 0xA0, 0x29, 0x47, 0x4B, 0x6E, 0x00, 0xD9, 0x68, 0x37, 0xAF, 0x65, 0x69, 0x44, 0x42, 0x5B,
+    0xB0, 0xB2, 0x9D, 0x2C, 0x47, 0xFA, 0xF1, 0x75, 0x98, 0x36, 0x87, 0x12, 0x91, 0x11, 0x79, 0x5B,
+    0x66, 0x04, 0x1B, 0x99, 0x68, 0x56, 0x06, 0x28, 0xB8, 0x11, 0x87, 0x09, 0xD8, 0xD0, 0x45, 0xBA,
+    0xA5, 0x62, 0x79, 0xA1, 0xC9, 0x38, 0x10, 0x6C, 0x40, 0x42, 0x1B, 0xF9, 0xE3, 0xE5, 0x1F, 0x17,
+    0xAE, 0xD3, 0x9B, 0x43, 0xC8, 0xEF, 0x39, 0x23, 0xC5, 0x4A, 0x23, 0xA5, 0x15, 0xEF, 0x56, 0x04,
+    0x2E, 0x78, 0xED, 0x65, 0xA3, 0xEC, 0xD7, 0x4E, 0x08, 0x37, 0x65, 0x50, 0x22, 0x1E, 0x25, 0x32,
+    0xC3, 0xF4, 0xDC, 0x43, 0xBF, 0x00, 0xDD, 0x72, 0xD2, 0x1D, 0xEE, 0x16, 0x6B, 0xF3, 0xF9, 0x25,
+    0xF4, 0x5F, 0x94, 0x05, 0xFD, 0x89, 0xC8, 0xC8, 0x50, 0xDA, 0x82, 0xD9, 0xB0, 0x0B, 0x32, 0xD6,
+    0x91, 0x77, 0xB1, 0x29, 0x30, 0xE1, 0x8E, 0x7B, 0x6E, 0xC3, 0x8D, 0x98, 0x59, 0x27, 0x54, 0xC6,
+    0x79, 0x5C, 0xD0, 0x89, 0x36, 0x55, 0x51, 0xA2, 0x32, 0x43, 0xC0, 0x3C, 0x1B, 0x22, 0x0C, 0x92,
+    0x41, 0xD5, 0x9A, 0xB6, 0xBA, 0x2B, 0x6F, 0x3C, 0x85, 0x49, 0x82, 0x92, 0xC7, 0xAB, 0x2A, 0x4C,
+    0x64, 0xFA, 0x90, 0x31, 0xCB, 0x0D, 0x6D, 0x74, 0xB4, 0xC9, 0x06, 0x9B, 0xCC, 0x0B, 0x29, 0x5A,
+    0x44, 0x96, 0xCD, 0xEB, 0x3C, 0xC0, 0xF0, 0x95, 0x80, 0xF9, 0x5E, 0xA4, 0xFD, 0x69, 0x41, 0x27,
+    0x37, 0xEA, 0xDC, 0x3D, 0x7B, 0x23, 0x23, 0xB2, 0xD2, 0xC9, 0x02, 0x77, 0x01, 0x7E, 0xE5, 0x19,
+    0x6D, 0x35, 0xC5, 0x75, 0xD2, 0xF9, 0x57, 0x69, 0xD3, 0x1D, 0x6C, 0x00, 0x01, 0x13, 0x69, 0x04,
+    0x86, 0x05, 0xB3, 0xA2, 0x04, 0xEC, 0x02, 0x1B, 0x74, 0x91, 0x5F, 0x72, 0x81, 0x3F, 0x12, 0xDF,
+    0xFD, 0xA9, 0xFC, 0x44, 0xB4, 0xC8, 0xD2, 0xC8, 0xBA, 0x67, 0xE1, 0xEB, 0x80, 0xAD, 0x00, 0x3E,
+    0xE3, 0xBE, 0x39, 0xCD, 0xFC, 0x7E, 0xDD, 0xE2, 0x83, 0xDF, 0x85, 0x50, 0x93, 0x8F, 0x24, 0x66,
+    0x03, 0xEA, 0xBE, 0xF3, 0x4C, 0x5B, 0xC1, 0x8A, 0xA4, 0x66, 0x7B, 0x5B, 0x66, 0x3B, 0x33, 0x51,
+    0x50, 0xD9, 0x2C, 0xB4, 0xD1, 0x41, 0xFF, 0x27, 0x19, 0x36, 0xB3, 0xA0, 0x93, 0xF3, 0x98, 0xEF,
+    0x14, 0xB8, 0x69, 0x23, 0x3A, 0xD9, 0x80, 0x0D, 0x83, 0xA7, 0xB0, 0xD1, 0x45, 0x9D, 0x99, 0xE8,
+    0xB6, 0x07, 0x11, 0x23, 0x02, 0x9D, 0xCC, 0xA7, 0xE0, 0x3D, 0x58, 0xD0, 0x92, 0xB1, 0x3F, 0x29,
+    0xBC, 0xCF, 0xA6, 0x56, 0x6E, 0x74, 0x64, 0xEB, 0xE6, 0x26, 0x9B, 0xD0, 0xA5, 0x7E, 0x74, 0xB3,
+    0xFB, 0x82, 0x78, 0x37, 0xAD, 0x0C, 0xE2, 0x19, 0x2E, 0x2B, 0x67, 0x0C, 0x70, 0x67, 0xF0, 0x7C,
+    0xDB, 0x85, 0x2E, 0xF6, 0x22, 0xB3, 0x11, 0x41, 0xCB, 0xD3, 0x3A, 0xC5, 0xF3, 0xA7, 0x74, 0xF0,
+    0x3B, 0x5E, 0xCB, 0xDC, 0x44, 0x5C, 0x56, 0x22, 0x38, 0x8C, 0xCC, 0xEE, 0xDD, 0xD4, 0x2E, 0xFA,
+    0xD9, 0x13, 0x1D, 0x7A, 0x5F, 0xC8, 0xF0, 0x4F, 0xD5, 0xEA, 0x42, 0x5F, 0x4B, 0xAA, 0x5C, 0xEB,
+    0xB1, 0xF5, 0xA3, 0xAF, 0xD5, 0xAA, 0xF0, 0xBD, 0xE4, 0x3C, 0xA0, 0x5E, 0x3C, 0xA8, 0x30, 0xD9,
+    0xFF, 0xE8, 0x67, 0xB5, 0x8A, 0xCC, 0xEE, 0xBF, 0xD6, 0xEA, 0x40, 0x6F, 0xF7, 0x6A, 0xCE, 0x0D,
+    0xDF, 0x5D, 0x00, 0x95, 0xBA, 0x78, 0x6F, 0x3F, 0x65, 0xD0, 0x51, 0x2D, 0xBF, 0x69, 0x83, 0x09,
+    0xCE, 0x5F, 0x77, 0x12, 0x55, 0x6A, 0x44, 0x46, 0xC9, 0xF4, 0x18, 0x99, 0xDB, 0x0D, 0xBD, 0x30,
+    0x2C, 0x9C, 0xC1, 0x9D, 0xDD, 0x6F, 0xBC, 0xF1, 0xF4, 0x92, 0x10, 0xC9, 0x7A, 0x55, 0x9B, 0x0E,
+    0x6C, 0x4D, 0x5D, 0x91, 0x5C, 0x01, 0xF8, 0xC1, 0xBC, 0xBB, 0x73, 0xCB, 0xCB, 0x1E, 0xF1, 0xAF,
+    0xD1, 0xE4, 0x87, 0xE8, 0x75, 0xC3, 0x44, 0xF9, 0xE6, 0x34, 0x0F, 0x22, 0xDE, 0x4A, 0x82, 0xD7,
+    0x41, 0x5D, 0xC1, 0xDD, 0x46, 0x12, 0x26, 0x3A, 0xF1, 0x6C, 0xE8, 0x84, 0x9D, 0x19, 0x76, 0x51,
+    0xDD, 0x8F, 0xF5, 0x2D, 0x33, 0x57, 0x7B, 0xAD, 0x8D, 0xF4, 0x81, 0x9B, 0xD3, 0x5B, 0x4D, 0xA6,
+    0x8D, 0xB8, 0xC0, 0x0D, 0x26, 0x63, 0xE6, 0xE6, 0xA3, 0xD1, 0x17, 0xAE, 0xD7, 0x37, 0xCD, 0xD2,
+    0xDB, 0x7F, 0x17, 0x44, 0xBE, 0x2F, 0xA9, 0x93, 0x64, 0x0A, 0x75, 0xEF, 0xBE, 0x7E, 0x0B, 0x17,
+    0xFB, 0xCE, 0x78, 0x9D, 0x5F, 0x05, 0x33, 0xAA, 0x85, 0x26, 0xF3, 0x10, 0xFA, 0xD9, 0x8E, 0x20,
+    0x1F, 0x2D, 0xD0, 0x4A, 0x02, 0xCE, 0xBE, 0xF1, 0x8A, 0x2F, 0xFE, 0xEB, 0xBF, 0x8F, 0xBA, 0xE8,
+    0xC5, 0x23, 0x5A, 0x12, 0x66, 0xC1, 0x79, 0x55, 0xF6, 0x71, 0x4D, 0x34, 0x6B, 0x7D, 0x8B, 0x82,
+    0x8E, 0xD8, 0xB0, 0x4F, 0xE4, 0xF6, 0xAD, 0x3E, 0x30, 0xA0, 0x33, 0xDD, 0x82, 0x04, 0x0A, 0x9F,
+    0x5D, 0x5F, 0x33, 0x73, 0xF7, 0xC3, 0x7F, 0x1D, 0xB6, 0xE6, 0xA7, 0x6B, 0x36, 0x52, 0xAC, 0xF8,
+    0x49, 0xBC, 0xCC, 0x5A, 0x46, 0x13, 0x51, 0x9E, 0x3B, 0xA8, 0x47, 0x34, 0x4F, 0x9D, 0x60, 0xF3,
+    0x20, 0x0C, 0x99, 0xF7, 0x95, 0xAC, 0x5C, 0xB7, 0x11, 0xB2, 0x09, 0x90, 0x1D, 0xB0, 0x3E, 0x01,
+    0xF5, 0x71, 0x84, 0xE6, 0x93, 0xB8, 0x1B, 0xA6, 0xBA, 0x64, 0x68, 0x53, 0x81, 0x6E, 0xB9, 0x01,
+    0x33, 0x3B, 0xEE, 0x98, 0xE0, 0xC2, 0xEF, 0xDA, 0x60, 0xFF, 0x32, 0xDA, 0x60, 0x64, 0xE9, 0x47,
+    0x2D, 0xC1, 0x55, 0xDF, 0x99, 0x3B, 0x00, 0xE7, 0xDB, 0xE5, 0x0E, 0x62, 0xF4, 0x92, 0x41, 0x95,
+    0x2E, 0x1E, 0xB1, 0xFA, 0x3D, 0x0A, 0xE8, 0xD8, 0x46, 0x30, 0xBE, 0x0F, 0xF0, 0x84, 0x1B, 0xD0,
+    0x51, 0x27, 0x30, 0xA3, 0x09, 0x70, 0xCD, 0x00, 0x3A, 0x36, 0x2B, 0xD8, 0xD1, 0xCC, 0xF0, 0x04,
+    0xF7, 0x36, 0x3A, 0xAA, 0xFC, 0x4F, 0x3E, 0x3F, 0xF8, 0xF6, 0x67, 0x49, 0x32, 0xBD, 0xFC, 0x1B,
+    0x09, 0x4C, 0xAB, 0xC9, 0x28, 0xF1, 0x67, 0x80, 0x07, 0xF5, 0x2D, 0x38, 0xFF, 0x1B, 0xAC, 0x04,
+    0xDA, 0x8D, 0x4E, 0x56, 0xB4, 0x78, 0xB4, 0xA0, 0x25, 0xA0, 0x3E, 0x59, 0xD4, 0x27, 0x0B, 0x3C,
+    0xCC, 0x3C, 0x4B, 0xF0, 0x59, 0xC7, 0xC3, 0x27, 0x60, 0xBE, 0x18, 0x3E, 0xEF, 0x40, 0xFF, 0x69,
+    0xEA, 0x4D, 0x80, 0xF8, 0x9E, 0x69, 0x17, 0x78, 0x68, 0xBF, 0xFE, 0xB5, 0x04, 0x9F, 0xD5, 0x7F,
+    0x15, 0x9E, 0x80, 0xF1, 0xCF, 0x16, 0x07, 0x3A, 0xB8, 0x68, 0x02, 0x4D, 0x34, 0xAB, 0x8E, 0x77,
+    0x48, 0x3A, 0x93, 0xDF, 0xFA, 0xDD, 0x27, 0x6C, 0x0C, 0x7D, 0xBF, 0xE1, 0xB0, 0xF2, 0x8E, 0x60,
+    0xC6, 0x56, 0xDE, 0x16, 0x94, 0x47, 0x2A, 0xC2, 0xBF, 0x56, 0xD3, 0xF3, 0x75, 0x2D, 0x91, 0x6E,
+    0x76, 0x02, 0x85, 0x36, 0x62, 0x02, 0x37, 0xA8, 0xBC, 0x1F, 0x99, 0x17, 0xF4, 0x5A, 0x0F, 0x4E,
+    0xF7, 0xF4, 0x14, 0x91, 0x5D, 0x20, 0xBB, 0xC3, 0xE1, 0xF8, 0x85, 0x09, 0x95, 0xE9, 0x16, 0xFA,
+    0xE0, 0x0B, 0x7A, 0xFD, 0x9C, 0x09, 0xB8, 0xAF, 0x7C, 0x27, 0xA3, 0x25, 0xF6, 0x23, 0x2E, 0xEB,
+    0xB4, 0x5B, 0x23, 0x67, 0x00, 0x0F, 0x9E, 0x82, 0xA9, 0x4E, 0x54, 0xA6, 0x5F, 0x4C, 0x52, 0x1B,
+    0x26, 0x9A, 0x05, 0x17, 0x04, 0x26, 0x9D, 0x68, 0x72, 0x1F, 0xE8, 0xE2, 0x06, 0xFD, 0x77, 0x13,
+    0x6C, 0x76, 0x46, 0xA7, 0x01, 0xEC, 0x77, 0x32, 0x6C, 0x6D, 0xA2, 0x8B, 0x66, 0x61, 0x18, 0x5D,
+    0x68, 0x33, 0xD3, 0xFF, 0x94, 0x80, 0xC8, 0x0A, 0xD3, 0xB6, 0xDF, 0x42, 0x3D, 0xA2, 0x5B, 0xB4,
+    0xC4, 0x4E, 0xC6, 0x41, 0xB4, 0x64, 0xDA, 0x65, 0x1B, 0x02, 0x37, 0x4E, 0x65, 0xCC, 0x0F, 0x83,
+    0x0D, 0x6C, 0xB1, 0x59, 0x31, 0x05, 0x37, 0x2A, 0x19, 0x75, 0xA2, 0x8F, 0x0C, 0xE8, 0x42, 0xB7,
+    0xE0, 0x42, 0xB5, 0x03, 0x8F, 0xF3, 0x32, 0x0B, 0xFD, 0xE8, 0x0B, 0x3A, 0x7D, 0xCE, 0xFE, 0x7D,
+    0xF3, 0x52, 0x8F, 0xE8, 0x47, 0x9C, 0x34, 0x12, 0x19, 0xB6, 0x4E, 0x56, 0x78, 0xBF, 0xFF, 0x4F,
+    0x19, 0xAE, 0xAF, 0x75, 0x86, 0x92, 0x9A, 0x0C, 0x32, 0xAB, 0x0C, 0x32, 0xAA, 0x8C, 0x12, 0x9A,
+    0x4C, 0x53, 0x6E, 0xEB, 0xB0, 0x4A, 0xD8, 0xF5, 0x5C, 0xBA, 0x8D, 0x98, 0xA5, 0xC6, 0x74, 0x7F,
+    0xAA, 0xC0, 0x2C, 0x6A, 0x03, 0xBB, 0xBD, 0x5B, 0x9F, 0x1F, 0x58, 0xC0, 0x3D, 0x10, 0x0F, 0x4E,
+    0x5D, 0x1C, 0x99, 0x97, 0xF7, 0xA1, 0x9E, 0x4D, 0x1C, 0xA5, 0x70, 0x3D, 0x69, 0xED, 0xE4, 0x03,
+    0xC0, 0x49, 0x01, 0x7E, 0xEB, 0xEA, 0x5B, 0x15, 0xF3, 0x2F, 0xB1, 0x55, 0x69, 0xF4, 0x7F, 0x7E,
+    0xA3, 0x32, 0x77, 0x4C, 0xA0, 0x26, 0xFC, 0xC9, 0xBB, 0xD5, 0xA9, 0x6A, 0xE9, 0xC1, 0xA3, 0x0A,
+    0xB4, 0x09, 0x65, 0x17, 0x1E, 0xBA, 0xB9, 0x5B, 0x26, 0xD9, 0x10, 0x59, 0x90, 0xB5, 0xE2, 0xDC,
+    0x23, 0xBA, 0x4B, 0x7E, 0xC7, 0x3B, 0x61, 0x8A, 0x8D, 0x84, 0x41, 0xB4, 0x24, 0x2B, 0x0B, 0xEF,
+    0x9B, 0xBF, 0x4E, 0xC3, 0xE3, 0x85, 0x1B, 0xD7, 0xA4, 0x6C, 0x16, 0x4A, 0xD6, 0x9F, 0x44, 0x33,
+    0xB3, 0x45, 0xFD, 0x22, 0x98, 0x80, 0xCC, 0x5A, 0xB0, 0x41, 0xC9, 0xD8, 0x16, 0xFA, 0xB1, 0x11,
+    0xBA, 0x8C, 0xF3, 0xBA, 0x60, 0x62, 0x7D, 0xEA, 0xC4, 0x2C, 0x0C, 0xB4, 0x09, 0x1B, 0xB8, 0xA1,
+    0x8B, 0x35, 0x29, 0x2B, 0x0A, 0xE5, 0xD7, 0x76, 0xE0, 0x7C, 0x6B, 0x87, 0xA2, 0x62, 0x03, 0x37,
+    0x34, 0xB2, 0xF6, 0x23, 0x1B, 0x8D, 0x2C, 0xCE, 0x93, 0x51, 0xE2, 0x4F, 0xC7, 0xB6, 0xEA, 0x03,
+    0x9A, 0x85, 0xBE, 0xD0, 0x66, 0x9C, 0xA0, 0x33, 0x6A, 0xF2, 0xD5, 0xD8, 0x50, 0x19, 0x5C, 0x50,
+    0x19, 0x6C, 0x50, 0x2B, 0x98, 0xB9, 0x49, 0x60, 0x16, 0x1D, 0xA1, 0x5B, 0xF4, 0x02, 0x6D, 0xEC,
+    0x02, 0xE8, 0x68, 0x46, 0xD0, 0xB1, 0x07, 0x74, 0xBC, 0x07, 0xE8, 0xF8, 0x04, 0xD0, 0x31, 0x01,
+    0xCD, 0xDF, 0x45, 0x40, 0x7F, 0x12, 0x00, 0x2D, 0xFE, 0x64, 0x0A, 0x56, 0xA3, 0x63, 0x7F, 0xA6,
+    0x22, 0x9C, 0xB4, 0x52, 0x93, 0x81, 0x7B, 0x8F, 0x23, 0xE0, 0x64, 0x04, 0x5C, 0x01, 0xE8, 0x2F,
+    0x5F, 0x3D, 0xAE, 0xEC, 0x57, 0x40, 0xC9, 0x06, 0xB4, 0x1F, 0xDF, 0x00, 0x26, 0xBC, 0x59, 0x1F,
+    0x5D, 0xF8, 0xD4, 0xD2, 0x5F, 0xDF, 0x2E, 0xFD, 0xD9, 0x56, 0xB5, 0xEE, 0x56, 0x9F, 0xB2, 0x98,
+    0x19, 0x7E, 0xBC, 0xF6, 0xB1, 0xD9, 0x9A, 0xB5, 0xCD, 0x6D, 0x6A, 0x92, 0x2A, 0x66, 0xD1, 0x91,
+    0xCD, 0x06, 0x1D, 0xD9, 0xDC, 0xA8, 0x23, 0x37, 0xCE, 0xB7, 0x91, 0x6D, 0xA0, 0x5D, 0x28, 0x03,
+    0xDD, 0x4C, 0x1E, 0x30, 0x73, 0x93, 0x07, 0x4C, 0xD0, 0xC9, 0x79, 0x13, 0xBA, 0xE8, 0x82, 0x09,
+    0x7D, 0xB0, 0xC9, 0x7E, 0x4D, 0x7C, 0x27, 0x8F, 0x3F, 0xCA, 0x47, 0xCB, 0xE7, 0x8D, 0x5A, 0x0E,
+    0xD5, 0xE1, 0xFC, 0xFC, 0xA0, 0x32, 0xF0, 0x56, 0x13, 0x01, 0xF7, 0xD1, 0x0C, 0x38, 0xF1, 0x54,
+    0x1E, 0x05, 0xCE, 0x47, 0xCE, 0x97, 0x46, 0x02, 0x32, 0x3B, 0xF1, 0x46, 0xFC, 0x23, 0x41, 0xFE,
+    0x25, 0xAA, 0x74, 0x0B, 0xE8, 0xF5, 0x1E, 0xD0, 0xFD, 0x5D, 0xA4, 0x9E, 0x93, 0x1D, 0x0D, 0xC4,
+    0x61, 0x3C, 0x79, 0x47, 0x26, 0x03, 0x4C, 0x09, 0x68, 0xFF, 0x47, 0x04, 0xEE, 0xD9, 0x00, 0x3A,
+    0xBA, 0x91, 0xCF, 0x38, 0x3F, 0x29, 0x2F, 0xAB, 0x12, 0xD1, 0x32, 0x6A, 0x49, 0x26, 0xD1, 0x16,
+    0xCE, 0x40, 0xFD, 0x5F, 0x20, 0xE8, 0xAF, 0x8D, 0x85, 0xEB, 0xF4, 0xD0, 0x2C, 0xBD, 0xFD, 0xCF,
+    0xE3, 0x91, 0xA0, 0xAD, 0xE0, 0x56, 0xD6, 0xC8, 0xEB, 0x60, 0xA9, 0x47, 0x8D, 0xC7, 0xE5, 0xAB,
+    0x2F, 0x1D, 0xB5, 0xAE, 0xBA, 0xF5, 0x31, 0xD4, 0x23, 0xB8, 0x6F, 0x24, 0x30, 0xB5, 0xB2, 0xE0,
+    0x7C, 0xB3, 0x62, 0x42, 0x85, 0x68, 0xC7, 0xCB, 0x7F, 0x78, 0x95, 0xEB, 0xC9, 0xC6, 0x10, 0x31,
+    0x22, 0x2B, 0x8D, 0x94, 0x02, 0x6F, 0x3C, 0x75, 0x27, 0xE9, 0xDE, 0xC5, 0x3B, 0xA0, 0xD7, 0xCF,
+    0x01, 0x65, 0x00, 0x9C, 0x1C, 0x23, 0x59, 0x93, 0x73, 0x57, 0x2A, 0xF7, 0x39, 0xFB, 0x67, 0x92,
+    0x70, 0xA3, 0x5E, 0x9D, 0x78, 0x9D, 0x18, 0xBC, 0x4E, 0x0C, 0x74, 0xB1, 0x5E, 0x26, 0xBA, 0xC8,
+    0x86, 0x59, 0xD8, 0x30, 0x33, 0x05, 0x33, 0x93, 0xB1, 0x41, 0x65, 0xEC, 0xD8, 0xAC, 0xF4, 0xA3,
+    0x4E, 0x38, 0xAF, 0x13, 0x8E, 0xF6, 0xF6, 0x3B, 0x0B, 0x1B, 0x36, 0xB2, 0xE1, 0x66, 0xBD, 0x61,
+    0xE6, 0x2E, 0xF3, 0xC7, 0x33, 0x45, 0x49, 0xF8, 0x8D, 0xF7, 0x8C, 0x99, 0x9F, 0x94, 0xEE, 0xBF,
+    0xFD, 0x60, 0x11, 0x79, 0x47, 0xE2, 0x94, 0x8D, 0xCC, 0x53, 0x69, 0x85, 0x61, 0xD1, 0x82, 0x1B,
+    0xB9, 0xE0, 0x0C, 0xFC, 0x71, 0x74, 0x7E, 0x2A, 0x98, 0x85, 0x4D, 0x4B, 0xC2, 0xF9, 0x36, 0x61,
+    0x66, 0x95, 0xAB, 0xE8, 0xE8, 0x22, 0x13, 0x4D, 0xC6, 0x8D, 0xF5, 0xB8, 0xA7, 0x60, 0xE6, 0xFA,
+    0x24, 0xCE, 0xC0, 0x71, 0x7C, 0xDD, 0xCF, 0xBD, 0xDD, 0x87, 0xAA, 0x5F, 0x36, 0x6C, 0xC4, 0x8D,
+    0x26, 0x21, 0x23, 0x85, 0x29, 0x74, 0xD7, 0xBF, 0xAC, 0x53, 0x2B, 0xFC, 0x5E, 0x7A, 0x58, 0x47,
+    0xF8, 0x17, 0x8B, 0x93, 0x1F, 0x48, 0xEE, 0x05, 0x29, 0x9D, 0xCC, 0xC3, 0x13, 0x25, 0xA3, 0xC9,
+    0x7C, 0x1C, 0xEB, 0x10, 0x8F, 0xAE, 0x92, 0xDB, 0x37, 0xEC, 0x6E, 0x50, 0xED, 0x8F, 0xB7, 0xEC,
+    0x16, 0xD1, 0xD1, 0xFB, 0xC7, 0x9E, 0x9C, 0xA7, 0xE6, 0xD1, 0xE1, 0x5D, 0x25, 0x22, 0xAB, 0x13,
+    0x91, 0x76, 0xA6, 0xF7, 0x4F, 0x30, 0xA1, 0x9B, 0xDB, 0x85, 0x7B, 0x6A, 0x05, 0xEE, 0x01, 0xE6,
+    0xA3, 0x42, 0x23, 0xB2, 0xE2, 0xFE, 0xFD, 0x30, 0x77, 0x33, 0x1B, 0x99, 0x6E, 0x31, 0x81, 0x1B,
+    0x32, 0x66, 0x36, 0x81, 0x4C, 0xC1, 0x8D, 0x26, 0xD9, 0xC8, 0x20, 0xEB, 0x5E, 0x19, 0xDD, 0xAF,
+    0xC2, 0x83, 0x33, 0x25, 0x2B, 0x70, 0xD3, 0xC9, 0x02, 0x3A, 0xE1, 0x3C, 0x98, 0x40, 0x06, 0x06,
+    0xDA, 0x58, 0x4D, 0xF5, 0x11, 0xCC, 0x42, 0x56, 0x1E, 0xE7, 0xF5, 0x0B, 0x59, 0xC8, 0x58, 0x91,
+    0xA5, 0x8D, 0x4C, 0x97, 0x43, 0xD8, 0x57, 0xB6, 0x60, 0x02, 0x9B, 0x4E, 0x38, 0x74, 0xB2, 0x41,
+    0x65, 0x4C, 0x98, 0x54, 0x1B, 0x19, 0x9A, 0xF5, 0x73, 0x26, 0xE8, 0x64, 0xFE, 0x22, 0xBA, 0x30,
+    0x8D, 0x4E, 0x18, 0x24, 0x21, 0x91, 0x61, 0xA3, 0xD9, 0xE0, 0x0C, 0x94, 0xE7, 0xEC, 0x5B, 0x30,
+    0x14, 0x90, 0xB2, 0x47, 0xA8, 0x3E, 0x5F, 0x54, 0x8D, 0xC7, 0x78, 0x97, 0xF6, 0x85, 0x2C, 0x9D,
+    0xC8, 0x6A, 0x52, 0x5B, 0x4C, 0x60, 0x33, 0x81, 0x1B, 0x3B, 0x72, 0xD3, 0x8F, 0x94, 0x7E, 0x24,
+    0xDB, 0xA0, 0x57, 0xB3, 0xD8, 0xA5, 0x13, 0x19, 0x1B, 0x79, 0x56, 0x0B, 0x34, 0x75, 0xE3, 0xE9,
+    0xA4, 0x60, 0x44, 0x42, 0xF7, 0xB4, 0xCB, 0x7A, 0x66, 0x62, 0xC6, 0xCE, 0xFB, 0x56, 0xDA, 0xEA,
+    0x23, 0x08, 0xD5, 0xF7, 0x4F, 0xDC, 0x7D, 0x3B, 0xEF, 0x96, 0x57, 0x3F, 0x8E, 0x98, 0x39, 0x61,
+    0xE2, 0x40, 0x17, 0xED, 0xC7, 0x0F, 0x92, 0xAE, 0x0E, 0xC9, 0x5C, 0x2B, 0x18, 0xF5, 0x08, 0xCE,
+    0x9F, 0xE1, 0x04, 0x26, 0x09, 0x83, 0xD4, 0x33, 0xA9, 0x01, 0x93, 0xBA, 0x95, 0x1B, 0x5C, 0xD0,
+    0x99, 0x52, 0x93, 0xAE, 0xA8, 0x82, 0xCA, 0x2A, 0xEB, 0x8C, 0xCA, 0x4D, 0xD6, 0x09, 0x95, 0x1B,
+    0x91, 0x48, 0x93, 0xF5, 0xFE, 0xEB, 0xE3, 0xAF, 0x2C, 0xE8, 0xB5, 0x8D, 0x66, 0xA1, 0x8D, 0xDD,
+    0x62, 0x16, 0xCC, 0x62, 0x16, 0xB3, 0x60, 0x83, 0x99, 0x4D, 0xC4, 0x8D, 0x26, 0x74, 0x49, 0x09,
+    0x36, 0xE8, 0xED, 0x2B, 0x99, 0x7E, 0x54, 0x22, 0x0B, 0xCE, 0x33, 0xEC, 0x87, 0x4A, 0x17, 0x00,
+    0xEA, 0xEA, 0x0F, 0xC0, 0x8A, 0x78, 0x7A, 0x91, 0x40, 0x3F, 0xEB, 0x88, 0x99, 0xD5, 0x4A, 0x17,
+    0xB9, 0xAE, 0x4F, 0x5E, 0xB1, 0x61, 0x02, 0x7D, 0x68, 0x17, 0xDA, 0xED, 0x4B, 0x69, 0x7F, 0x02,
+    0x4F, 0xCB, 0x04, 0x64, 0x1B, 0xA0, 0x74, 0x0B, 0xDC, 0xE8, 0x74, 0x87, 0x81, 0xFC, 0xD6, 0x67,
+    0x06, 0x3F, 0xF4, 0x46, 0x46, 0x2B, 0x5F, 0x97, 0xD0, 0x8A, 0x97, 0x11, 0xE1, 0x8C, 0x5B, 0x17,
+    0x60, 0xA2, 0x60, 0x63, 0xBF, 0x34, 0xA2, 0x0B, 0x36, 0xF4, 0xE3, 0x2F, 0x78, 0x9C, 0xE6, 0x7C,
+    0x03, 0x2D, 0x19, 0xB5, 0x4D, 0x33, 0xEF, 0xB3, 0x61, 0xC7, 0x6E, 0xD1, 0x91, 0x8D, 0x6B, 0xFA,
+    0x60, 0x42, 0x97, 0x9A, 0x55, 0x17, 0xDC, 0x17, 0xC4, 0xEB, 0x17, 0x32, 0x32, 0x88, 0xA7, 0x7D,
+    0xB6, 0x2F, 0x44, 0x1B, 0x51, 0x0C, 0x9E, 0x6F, 0xEB, 0xCC, 0x44, 0x2F, 0x32, 0x23, 0x12, 0x6B,
+    0x29, 0xA9, 0x3C, 0xFC, 0x6F, 0xE5, 0xBD, 0x4F, 0xAC, 0x27, 0x59, 0x75, 0xE7, 0xF9, 0xB9, 0x71,
+    0x2B, 0x5F, 0x00, 0xD1, 0xED, 0x9B, 0xAD, 0xA9, 0xB2, 0x80, 0x6A, 0x13, 0x2C, 0x3C, 0x92, 0xFF,
+    0x40, 0x45, 0x2F, 0xBC, 0xE8, 0x45, 0x55, 0xDE, 0x00, 0x24, 0x7B, 0x61, 0x69, 0xC8, 0x19, 0xD5,
+    0xC3, 0x92, 0x59, 0xE0, 0xC5, 0x2C, 0xA6, 0x99, 0x51, 0x67, 0x2F, 0xBC, 0x60, 0x51, 0x99, 0x11,
+    0x54, 0xA9, 0xE5, 0x45, 0x2F, 0xC8, 0x05, 0xB8, 0x17, 0x2C, 0x5C, 0x8B, 0xB2, 0x04, 0xAF, 0xA4,
+    0x2E, 0x46, 0x62, 0x81, 0x66, 0x32, 0x5F, 0x5C, 0x28, 0x8D, 0x6A, 0xC1, 0xC2, 0x51, 0x20, 0x0B,
+    0xA9, 0x67, 0x41, 0x60, 0x92, 0x41, 0xA6, 0x16, 0x75, 0x61, 0x02, 0x57, 0x64, 0x71, 0x23, 0xCE,
+    0x2C, 0xCE, 0x8D, 0xDF, 0xFB, 0x93, 0x59, 0x36, 0xF6, 0x80, 0xA1, 0xE8, 0x9F, 0x54, 0xEF, 0x97,
+    0xF5, 0x7B, 0xF1, 0xE2, 0x77, 0xE3, 0xDC, 0x73, 0xCF, 0x3D, 0x7F, 0xBE, 0xE7, 0x7B, 0x01, 0x5C,
+    0x40, 0x28, 0x13, 0xF5, 0xC4, 0x6F, 0xA3, 0x2F, 0xD3, 0xF2, 0x04, 0xCC, 0xD8, 0x91, 0x1A, 0x9E,
+    0xA1, 0x88, 0xB8, 0xC0, 0x35, 0xCC, 0x4C, 0x35, 0xE2, 0x31, 0x89, 0x2A, 0xE2, 0x7B, 0x56, 0xAA,
+    0x88, 0x0F, 0x6C, 0x54, 0x33, 0xBE, 0xE7, 0x05, 0xF6, 0x97, 0x0B, 0xC0, 0x02, 0xD4, 0x2D, 0x14,
+    0x11, 0xF0, 0x80, 0x9D, 0x80, 0xA7, 0x80, 0xFA, 0x3E, 0x74, 0xB2, 0xD2, 0x88, 0x4C, 0xEE, 0xFE,
+    0x9B, 0x9B, 0x4D, 0xB5, 0x09, 0x83, 0x89, 0xB8, 0xF0, 0x04, 0xC5, 0x62, 0x47, 0x7C, 0xFB, 0x24,
+    0x65, 0x2C, 0x03, 0x03, 0x5F, 0xA1, 0x9A, 0x5C, 0xCB, 0x46, 0xC4, 0xC5, 0x1A, 0x86, 0x62, 0xA2,
+    0x5C, 0xAE, 0xF1, 0xA7, 0xFE, 0x9B, 0x63, 0xF3, 0x61, 0x59, 0x6F, 0x4C, 0x4E, 0x64, 0xA6, 0x91,
+    0x05, 0x9A, 0x7B, 0x40, 0x04, 0x6A, 0xF2, 0xF7, 0x5E, 0x03, 0xEC, 0x08, 0x3C, 0x03, 0x54, 0xFB,
+    0xB0, 0xF6, 0xD7, 0x15, 0x80, 0x42, 0x66, 0xA0, 0x91, 0x04, 0x0C, 0x2F, 0x6E, 0x60, 0x12, 0x02,
+    0x36, 0x32, 0x40, 0x35, 0x71, 0x0B, 0x5C, 0xE0, 0x53, 0x50, 0x07, 0x00, 0xDF, 0x03, 0xF8, 0x16,
+    0x60, 0x00, 0x40, 0x00, 0x3A, 0x91, 0x04, 0x22, 0xB2, 0xC0, 0x1F, 0xAD, 0xC7, 0xD7, 0xC1, 0x26,
+    0x00, 0xBB, 0x00, 0x94, 0x33, 0x40, 0x15, 0x01, 0xDC, 0x04, 0xFB, 0xCD, 0x9A, 0x1E, 0x78, 0x4F,
+    0x07, 0xBF, 0x1E, 0xBC, 0x88, 0x88, 0xFE, 0xEC, 0xFD, 0xF4, 0x71, 0x11, 0x9E, 0x00, 0xAE, 0xEB,
+    0x40, 0xAF, 0x32, 0x01, 0x5F, 0x29, 0x96, 0x6A, 0xFB, 0xF0, 0xC2, 0xE9, 0x20, 0xAF, 0x8F, 0xD4,
+    0xDB, 0x4B, 0x1B, 0xB8, 0xA9, 0x48, 0x50, 0xF7, 0x24, 0xF0, 0x90, 0xE0, 0x1A, 0x24, 0xB8, 0x09,
+    0x09, 0xEE, 0x62, 0x16, 0xB8, 0x8B, 0x8D, 0xD0, 0xE1, 0x26, 0x90, 0x57, 0x87, 0x91, 0x4A, 0x44,
+    0x66, 0xFC, 0x1F, 0xC8, 0x74, 0x97, 0x9B, 0x3C, 0xC6, 0x35, 0xAE, 0x02, 0x8F, 0xE0, 0x25, 0x19,
+    0x91, 0xCF, 0xC8, 0xC6, 0x20, 0xAF, 0x0E, 0xF7, 0x39, 0x92, 0xBE, 0x9A, 0xA1, 0xC3, 0x6C, 0xE0,
+    0x5B, 0x7C, 0xC0, 0xF7, 0x94, 0x33, 0x4D, 0x80, 0x8D, 0x3A, 0x40, 0x13, 0xDC, 0x08, 0xE5, 0xEC,
+    0x26, 0x60, 0xAB, 0x22, 0x34, 0xF2, 0x8A, 0x2C, 0x54, 0xF2, 0x86, 0x24, 0x38, 0x1E, 0xEE, 0x3F,
+    0x0D, 0xD4, 0x09, 0x78, 0xEC, 0x8F, 0xD6, 0xE3, 0x9E, 0x52, 0x44, 0x22, 0x46, 0x25, 0x95, 0xC5,
+    0xA0, 0x82, 0x51, 0x81, 0xB1, 0x71, 0x26, 0xE0, 0xEE, 0x7B, 0x40, 0x21, 0x32, 0x81, 0x11, 0x99,
+    0x01, 0x8A, 0x19, 0x17, 0xF0, 0xB0, 0x50, 0x8E, 0x34, 0x90, 0xB0, 0x11, 0xD7, 0x73, 0x33, 0x6B,
+    0xAA, 0x3F, 0x48, 0xED, 0xDC, 0xAB, 0x78, 0xFE, 0xA2, 0x12, 0x93, 0xB0, 0x13, 0x75, 0xAB, 0xB2,
+    0x71, 0x81, 0x6B, 0x9C, 0xE9, 0x6F, 0xB5, 0x41, 0x23, 0x91, 0xEE, 0xE3, 0x1B, 0x37, 0xF1, 0x7D,
+    0x47, 0x39, 0xF9, 0x40, 0x7C, 0x62, 0xE6, 0xAA, 0xEB, 0xA0, 0x7C, 0x39, 0x62, 0x62, 0x07, 0x77,
+    0xCA, 0x99, 0x06, 0xDF, 0x97, 0xA3, 0x5D, 0x48, 0x34, 0x7D, 0x3D, 0x16, 0x73, 0xB1, 0xE2, 0x69,
+    0xA6, 0x2A, 0x18, 0x31, 0x33, 0x2E, 0x3E, 0x05, 0x9B, 0x03, 0xF7, 0xAD, 0x00, 0xF7, 0xE3, 0x55,
+    0xEA, 0xE5, 0x19, 0x6C, 0xF2, 0xAD, 0x59, 0x5D, 0x64, 0x2B, 0xE4, 0x63, 0x1B, 0x5E, 0x36, 0x0A,
+    0x39, 0xD3, 0xCC, 0x32, 0x56, 0xDF, 0x4D, 0xD5, 0x2A, 0x76, 0xF3, 0xAD, 0xEA, 0x18, 0x47, 0xA7,
+    0xB7, 0x01, 0x23, 0xB2, 0x01, 0x6E, 0x3B, 0x1E, 0x26, 0xE8, 0x7A, 0x8A, 0x84, 0x49, 0x40, 0xA7,
+    0xAB, 0xCB, 0x05, 0x17, 0xF8, 0x2F, 0xB7, 0xED, 0x54, 0x53, 0x49, 0x2C, 0xE2, 0x35, 0xFC, 0x9F,
+    0x47, 0x96, 0xA7, 0x48, 0x44, 0xEE, 0x3C, 0x63, 0x66, 0xBE, 0xC4, 0x33, 0x5F, 0x29, 0x22, 0xF0,
+    0xD4, 0x62, 0x23, 0x70, 0x6D, 0xB1, 0xD3, 0x85, 0xB7, 0x08, 0x3C, 0xF5, 0x15, 0x7D, 0x7B, 0xC6,
+    0x2C, 0xC0, 0x33, 0x4F, 0x21, 0xED, 0xBB, 0xB9, 0xE3, 0xE9, 0x64, 0x61, 0xA9, 0xDB, 0x4A, 0xA6,
+    0x22, 0xBA, 0xC0, 0x31, 0xE5, 0x68, 0x23, 0xBB, 0xFA, 0xD1, 0x81, 0xEF, 0x29, 0x17, 0xA8, 0xB6,
+    0x3F, 0x1F, 0x46, 0x60, 0x90, 0x0D, 0xE0, 0xCA, 0x49, 0x0B, 0x1C, 0x3D, 0x7F, 0x9D, 0x41, 0x7A,
+    0xF7, 0x5A, 0xE2, 0xAE, 0x8D, 0x76, 0x72, 0x6D, 0xC3, 0x33, 0x2C, 0x45, 0xB4, 0xA3, 0xEB, 0xEB,
+    0x76, 0xE5, 0x66, 0x35, 0x7F, 0x7A, 0xFD, 0xC9, 0xB7, 0xAD, 0x7C, 0x66, 0x29, 0x97, 0xA6, 0xDF,
+    0xA7, 0xEE, 0xE4, 0x24, 0x7A, 0x91, 0x4F, 0x8B, 0xBC, 0xC0, 0x63, 0xC7, 0xC7, 0xC7, 0x4E, 0x44,
+    0xBE, 0x2B, 0x22, 0xCB, 0xF1, 0xF1, 0xF1, 0x29, 0xE0, 0xFA, 0x6C, 0x5A, 0x96, 0xBC, 0xDE, 0x5D,
+    0xFF, 0xD8, 0x71, 0xDB, 0xC9, 0xD6, 0xC9, 0xE6, 0x65, 0x85, 0x47, 0x81, 0xC7, 0x65, 0x86, 0xED,
+    0x78, 0xC0, 0x4E, 0x54, 0xC1, 0xF5, 0x98, 0xF8, 0x44, 0xB5, 0xB5, 0x5F, 0x79, 0xB2, 0x7A, 0x6D,
+    0x7C, 0xF2, 0x53, 0xF6, 0x6B, 0xD3, 0x07, 0xBF, 0x6C, 0xBF, 0x36, 0xB9, 0x68, 0x5F, 0x09, 0x2E,
+    0x5A, 0xC1, 0x45, 0xFB, 0x57, 0xB8, 0x2F, 0xDB, 0x57, 0x82, 0xFB, 0x94, 0xFD, 0x5A, 0x7C, 0xDF,
+    0x93, 0x6E, 0xBE, 0xFB, 0xE4, 0x13, 0x57, 0xAE, 0x3F, 0xFA, 0x29, 0xD7, 0x62, 0xA2, 0x9D, 0xA8,
+    0x46, 0xB6, 0xE3, 0x01, 0x6A, 0x99, 0x81, 0x63, 0x68, 0x44, 0x9C, 0xC8, 0x37, 0x45, 0x22, 0x57,
+    0xA0, 0x96, 0xBE, 0x94, 0x8D, 0xB5, 0x9C, 0x1B, 0xDC, 0xCB, 0x91, 0x74, 0x8D, 0xEA, 0xE5, 0xC8,
+    0x1D, 0x8F, 0xFB, 0x5A, 0x2A, 0x66, 0x27, 0x82, 0x97, 0x9E, 0x4F, 0xB6, 0xF9, 0x29, 0xEF, 0x02,
+    0x4D, 0x0B, 0xD5, 0x08, 0xC5, 0x7C, 0xF6, 0xC1, 0xF1, 0xC7, 0xBF, 0xF7, 0xB4, 0x17, 0x91, 0xCF,
+    0x88, 0xC8, 0xF4, 0xD0, 0x2B, 0xCE, 0x3E, 0x38, 0xF7, 0xFA, 0x9D, 0x93, 0x93, 0x93, 0xCF, 0xEC,
+    0x82, 0x02, 0xA0, 0x59, 0xA9, 0x64, 0xA5, 0xFB, 0xCF, 0xC9, 0x46, 0x1B, 0x1D, 0x2E, 0x3C, 0xC2,
+    0x2D, 0xB0, 0x11, 0x7C, 0x8B, 0x9D, 0xA1, 0x6B, 0x29, 0x67, 0x18, 0xD4, 0x44, 0xAD, 0x50, 0x8B,
+    0x4C, 0x83, 0x48, 0x3F, 0xE4, 0x5B, 0x98, 0x61, 0x62, 0x90, 0xBE, 0xFE, 0x46, 0x2A, 0x26, 0x17,
+    0xDE, 0x41, 0x82, 0xBA, 0xA5, 0x9A, 0x78, 0x7C, 0xA6, 0x92, 0xC0, 0xBF, 0x93, 0x7C, 0x3F, 0x28,
+    0x23, 0x66, 0xC5, 0x0C, 0x7D, 0x27, 0x93, 0x95, 0x49, 0x2D, 0x2D, 0xFC, 0x1E, 0xA9, 0x48, 0xD5,
+    0x5C, 0x4F, 0xBE, 0xBF, 0xCB, 0x97, 0x01, 0xCC, 0xF3, 0x1C, 0xF5, 0xB8, 0x91, 0x26, 0xE0, 0x02,
+    0xBE, 0xA7, 0x0E, 0xF8, 0x96, 0x26, 0xE0, 0xA1, 0xE9, 0xE9, 0xC0, 0xB7, 0x9C, 0x82, 0x87, 0x15,
+    0x3A, 0x48, 0xFB, 0xCF, 0x53, 0x4C, 0x82, 0x15, 0xBB, 0xC0, 0x8A, 0x9D, 0x61, 0xA5, 0x9C, 0x31,
+    0x2B, 0x6E, 0xA6, 0xD8, 0x68, 0x66, 0xAC, 0xB4, 0x77, 0xD2, 0x07, 0xAD, 0xBC, 0x36, 0x4B, 0xB2,
+    0xAF, 0xCB, 0x24, 0x73, 0xF9, 0x75, 0x69, 0xBB, 0x50, 0x85, 0xA7, 0x79, 0x44, 0xF7, 0xA9, 0x0B,
+    0x3F, 0xB3, 0x59, 0x7E, 0xC0, 0xD2, 0x5F, 0xBB, 0x28, 0x5E, 0x73, 0xFC, 0x34, 0x1C, 0x89, 0x24,
+    0xE8, 0x44, 0x16, 0x0A, 0xD9, 0x3A, 0xA8, 0x64, 0xBD, 0x06, 0xB5, 0xA4, 0xA7, 0xC0, 0x4B, 0x7A,
+    0x12, 0x06, 0x59, 0x9E, 0x01, 0x91, 0xE5, 0x2B, 0x20, 0x32, 0x2F, 0x20, 0x12, 0x67, 0x10, 0x89,
+    0x11, 0x44, 0xBE, 0x13, 0x41, 0xE4, 0x1B, 0x13, 0x0C, 0xF2, 0xCD, 0x09, 0xBC, 0xBC, 0x3C, 0x82,
+    0x93, 0x97, 0x03, 0x98, 0xCF, 0xFF, 0x59, 0x00, 0xDC, 0x1F, 0xF6, 0x80, 0xFB, 0x68, 0x0F, 0xD4,
+    0xAE, 0x05, 0x6A, 0x07, 0xF0, 0x44, 0x0D, 0xF0, 0xD4, 0x13, 0x00, 0x4F, 0x3E, 0x05, 0xF0, 0xCC,
+    0x33, 0x00, 0xCB, 0x02, 0x98, 0x1F, 0x45, 0xC0, 0xCA, 0x08, 0x5F, 0x76, 0x02, 0x88, 0x5C, 0x05,
+    0xBA, 0xE5, 0xB0, 0xEB, 0x81, 0x49, 0xFE, 0xEB, 0x49, 0x5E, 0x89, 0x00, 0x0C, 0xAD, 0x8F, 0xAC,
+    0x78, 0xEA, 0xBE, 0x09, 0x5D, 0xFF, 0x44, 0x0B, 0xB4, 0xE6, 0xF4, 0x48, 0xC6, 0x21, 0xF1, 0x89,
+    0x60, 0x16, 0x9A, 0xBE, 0x98, 0xF1, 0xD8, 0xC8, 0x2D, 0xAA, 0x91, 0x84, 0x0B, 0x24, 0x6E, 0x8C,
+    0x9D, 0x7C, 0x5D, 0x16, 0x8A, 0x2F, 0x50, 0x48, 0x44, 0x86, 0xD0, 0xB4, 0xA9, 0x9C, 0xAA, 0xF1,
+    0x0E, 0x77, 0x5C, 0x70, 0x61, 0x21, 0xD5, 0x7D, 0xDD, 0x2F, 0x36, 0xBA, 0x57, 0x57, 0x06, 0x69,
+    0x0B, 0xD9, 0xD7, 0xB5, 0x39, 0x39, 0x89, 0x9D, 0x48, 0x25, 0x5B, 0x7B, 0x4E, 0xB2, 0x57, 0x01,
+    0x66, 0x30, 0xA7, 0xA8, 0x45, 0x79, 0x5C, 0x5A, 0xF5, 0x1F, 0x2A, 0x09, 0x79, 0x3A, 0xCA, 0x98,
+    0xB7, 0x4E, 0x73, 0xD8, 0x42, 0xEE, 0xEE, 0x33, 0xE8, 0xF3, 0x82, 0xC0, 0x05, 0x28, 0x27, 0x54,
+    0x23, 0x6D, 0x44, 0xAF, 0xB6, 0x11, 0x33, 0x73, 0x17, 0xCC, 0x4C, 0xB1, 0xE2, 0x81, 0x85, 0x42,
+    0x70, 0x01, 0x12, 0x85, 0x04, 0x1B, 0xE1, 0x0E, 0xC5, 0x1B, 0xF1, 0x68, 0x6B, 0xB9, 0x89, 0x99,
+    0x97, 0x5A, 0x22, 0xD7, 0x30, 0xF3, 0xCD, 0x52, 0x16, 0x3C, 0x66, 0x6E, 0x00, 0x9A, 0xD6, 0x2C,
+    0x2E, 0x00, 0x75, 0x6F, 0x96, 0x6C, 0x7B, 0x4D, 0x32, 0x4B, 0xF6, 0xA9, 0x44, 0x22, 0x54, 0x23,
+    0x5E, 0x64, 0xC9, 0x03, 0x76, 0x21, 0x8F, 0xC3, 0x4E, 0x60, 0x67, 0xC0, 0xCC, 0x50, 0x2C, 0x00,
+    0x77, 0xF2, 0x7F, 0x9C, 0x9B, 0x9F, 0xFC, 0x7A, 0x04, 0xA0, 0xCD, 0x3E, 0xCD, 0xE3, 0x93, 0x3E,
+    0xE2, 0x91, 0x8C, 0xC0, 0x69, 0x16, 0x8A, 0x49, 0x59, 0x0C, 0xBB, 0x31, 0x56, 0x09, 0x34, 0xAD,
+    0xFE, 0x0F, 0xBE, 0x55, 0x07, 0x0C, 0x0F, 0xA4, 0xFC, 0x0F, 0xB5, 0x18, 0xB7, 0xA0, 0x9C, 0x18,
+    0x26, 0xEE, 0x82, 0x0B, 0xA5, 0x24, 0x12, 0x34, 0xD4, 0x6F, 0x6E, 0xEA, 0x44, 0xF8, 0xB6, 0x23,
+    0xC1, 0xC2, 0x93, 0xF8, 0xA3, 0xAD, 0xB5, 0x91, 0x47, 0xB9, 0xD5, 0x49, 0xA8, 0x02, 0x90, 0x3A,
+    0xE9, 0xEB, 0x3E, 0x3F, 0x8C, 0xDF, 0x5D, 0x9B, 0x94, 0x97, 0x4E, 0x31, 0x83, 0x59, 0xD1, 0x59,
+    0xA8, 0x76, 0x09, 0x34, 0xFB, 0x80, 0x36, 0xF4, 0x09, 0xEC, 0x76, 0xF2, 0x02, 0x26, 0x41, 0x25,
+    0x32, 0x63, 0x23, 0x94, 0x22, 0x13, 0xE5, 0xB8, 0x0B, 0xA0, 0xBF, 0x20, 0x8E, 0xAB, 0xEA, 0xA1,
+    0x82, 0x89, 0x60, 0x64, 0x02, 0xDC, 0x08, 0x8D, 0x4C, 0x7A, 0x3B, 0x73, 0xBF, 0x0E, 0x2A, 0xF0,
+    0xAA, 0xF7, 0x79, 0x58, 0x8F, 0x90, 0xF2, 0x20, 0xA9, 0xC6, 0x3C, 0x04, 0x4E, 0xB3, 0xDC, 0xE8,
+    0xC6, 0xAC, 0x3A, 0x95, 0x04, 0x55, 0x24, 0xDE, 0xD3, 0x05, 0xCA, 0x09, 0x33, 0x83, 0x07, 0x0F,
+    0xCD, 0x98, 0xFD, 0x8C, 0x42, 0xA0, 0x8C, 0xD4, 0x2D, 0x4D, 0x82, 0xAE, 0x65, 0xA1, 0x78, 0x23,
+    0xF2, 0x89, 0x05, 0x17, 0xA8, 0x3F, 0xFA, 0x69, 0x91, 0x96, 0x3B, 0x98, 0xF9, 0xA6, 0x95, 0x91,
+    0x72, 0xA4, 0xFE, 0x70, 0x54, 0xF3, 0x91, 0xB5, 0xC5, 0x46, 0xEA, 0xFE, 0x5A, 0x56, 0x20, 0x55,
+    0x17, 0xB3, 0xE0, 0x44, 0x44, 0xE5, 0xA3, 0xFA, 0xA2, 0x93, 0x94, 0x80, 0x6A, 0xDA, 0x1D, 0xE7,
+    0x8E, 0xEC, 0x4F, 0xDB, 0xB8, 0x6B, 0x4C, 0x7D, 0x58, 0x38, 0xEF, 0x38, 0x2F, 0xA2, 0x2A, 0x50,
+    0x2D, 0xD8, 0x15, 0x04, 0xDE, 0x77, 0x30, 0x59, 0xD7, 0x29, 0x04, 0x23, 0x13, 0x1F, 0x5B, 0xE0,
+    0x16, 0x74, 0xD0, 0xB5, 0x74, 0x2D, 0x43, 0xCB, 0xA0, 0x9B, 0x37, 0xF8, 0x16, 0x17, 0xB0, 0x13,
+    0x24, 0xF0, 0xFD, 0xFF, 0x56, 0x89, 0xB4, 0x22, 0xC1, 0xC9, 0xC8, 0xEF, 0xE8, 0xB7, 0xFD, 0x3B,
+    0x9D, 0x90, 0x61, 0x7C, 0x06, 0xA0, 0x5B, 0x55, 0xB1, 0x5E, 0x92, 0x16, 0x70, 0x1F, 0x91, 0x00,
+    0x98, 0xD0, 0xF4, 0xBC, 0xF5, 0xEB, 0x4B, 0x3A, 0x9E, 0x55, 0xFF, 0x2F, 0xDB, 0x83, 0x41, 0xED,
+    0x90, 0x57, 0x1F, 0xD0, 0x77, 0x00, 0xD4, 0x1F, 0x1D, 0x01, 0xDC, 0xCB, 0x8B, 0xCE, 0xDD, 0x06,
+    0x60, 0x63, 0x13, 0x80, 0x62, 0x2E, 0x75, 0x51, 0xEB, 0x8D, 0x92, 0x1A, 0xEA, 0x5B, 0xAA, 0x83,
+    0x5E, 0x9D, 0xC9, 0xA6, 0x67, 0x00, 0x9C, 0x88, 0x8C, 0x64, 0xAF, 0x97, 0xF2, 0xCD, 0x93, 0x93,
+    0x4D, 0xF5, 0xC1, 0x07, 0x4C, 0x02, 0x17, 0x61, 0x85, 0x22, 0xA9, 0x47, 0x3F, 0xB4, 0x78, 0xA0,
+    0x9E, 0xF0, 0x23, 0x54, 0xDB, 0x87, 0x44, 0x7A, 0x3A, 0x59, 0x44, 0x26, 0xBC, 0xE8, 0xB0, 0x55,
+    0x16, 0xA5, 0xFA, 0xAA, 0x95, 0xA8, 0xFF, 0x3A, 0xDD, 0x05, 0x30, 0xD1, 0xF5, 0x00, 0x77, 0xEC,
+    0x08, 0xD0, 0x18, 0xFD, 0xE5, 0xDF, 0xE9, 0x1E, 0xDA, 0xE9, 0x03, 0x1E, 0xBD, 0x70, 0x41, 0x24,
+    0x95, 0xBE, 0xD5, 0xAA, 0xF4, 0x6E, 0xC9, 0xB7, 0x05, 0xC0, 0x4A, 0x00, 0xB0, 0x6F, 0x44, 0x00,
+    0x33, 0xEB, 0x00, 0x92, 0xEE, 0x4E, 0x77, 0x35, 0x9A, 0xF0, 0x45, 0x52, 0x9D, 0x52, 0x2D, 0xE9,
+    0x6B, 0xB5, 0x80, 0x76, 0xD6, 0xE5, 0xB7, 0xA9, 0xE6, 0xF9, 0x00, 0xC5, 0xA2, 0x6B, 0x51, 0x44,
+    0x56, 0x60, 0x10, 0x91, 0x16, 0xBA, 0x93, 0x93, 0x97, 0x26, 0x75, 0x04, 0x92, 0x9A, 0x12, 0xC9,
+    0xEB, 0x2A, 0x50, 0x45, 0xA8, 0x74, 0x65, 0x9A, 0x0D, 0xBB, 0x02, 0xC3, 0xBD, 0x5A, 0x16, 0x4A,
+    0x0D, 0x15, 0xAC, 0xC8, 0x08, 0x70, 0xE5, 0xF8, 0xF8, 0xF8, 0x98, 0x2C, 0x6E, 0x99, 0xD4, 0x5B,
+    0xCD, 0x4E, 0x7B, 0x29, 0x9F, 0xFB, 0xA4, 0x86, 0x43, 0x32, 0xD2, 0x00, 0xD8, 0x9F, 0x44, 0x8D,
+    0xC7, 0x8A, 0xBF, 0x4B, 0x14, 0x23, 0x60, 0x96, 0x2D, 0x7B, 0xEE, 0xC9, 0x67, 0xC5, 0x4E, 0xBA,
+    0x1D, 0xC3, 0x5D, 0x8D, 0x10, 0xE0, 0x34, 0x07, 0x09, 0x74, 0xC8, 0x8B, 0xA2, 0xA6, 0xCC, 0x8B,
+    0xA8, 0x51, 0xA9, 0x45, 0x02, 0xD0, 0xB4, 0xF9, 0xEA, 0x5A, 0x44, 0xAF, 0x76, 0xEA, 0x36, 0x83,
+    0xFB, 0xEB, 0xE3, 0xA1, 0x45, 0x6D, 0x46, 0x1D, 0x28, 0xA0, 0x9A, 0xA8, 0x22, 0xC5, 0x44, 0x19,
+    0xB1, 0x0B, 0xE8, 0x83, 0x6E, 0x70, 0x67, 0xF7, 0x89, 0x3A, 0xCA, 0xB5, 0xA5, 0x13, 0x91, 0xDE,
+    0xC9, 0x5C, 0x88, 0x88, 0x8C, 0xA5, 0x24, 0x44, 0x8D, 0x3C, 0xEF, 0x3D, 0x79, 0x41, 0xBF, 0x4B,
+    0x46, 0xF0, 0x22, 0x92, 0xE0, 0xBF, 0x1F, 0xF8, 0x84, 0xB4, 0x30, 0x60, 0x24, 0xC0, 0x06, 0x5E,
+    0x75, 0xCC, 0xCD, 0x6A, 0xEB, 0x16, 0x8A, 0x04, 0x65, 0xC2, 0x26, 0xB0, 0x09, 0xBB, 0xE8, 0xDB,
+    0x0C, 0x36, 0x99, 0x8F, 0xFF, 0xF8, 0x18, 0x9B, 0x2A, 0x11, 0x69, 0x6D, 0x72, 0x22, 0x82, 0x5D,
+    0x70, 0x13, 0x94, 0x33, 0xF5, 0x08, 0x55, 0xA4, 0x09, 0xE0, 0xF4, 0xAD, 0x19, 0xF1, 0x3D, 0x39,
+    0x38, 0x43, 0xA0, 0x6B, 0xB1, 0xAB, 0x3A, 0x72, 0x0B, 0x08, 0x0C, 0x23, 0x47, 0x72, 0xF2, 0x92,
+    0x40, 0xA7, 0x53, 0x33, 0x88, 0xDC, 0xBF, 0xA0, 0x80, 0xBF, 0xAD, 0x5B, 0xCC, 0xE2, 0x00, 0x2B,
+    0xDF, 0x8D, 0xC0, 0xE9, 0xB0, 0x01, 0xD5, 0xB3, 0x12, 0x80, 0xFF, 0x50, 0x4D, 0x6F, 0xB1, 0x9A,
+    0x8F, 0x4E, 0x5A, 0x7D, 0xFC, 0x5E, 0x57, 0x58, 0x4B, 0x29, 0x6D, 0xBD, 0x62, 0xA4, 0xA5, 0x89,
+    0x74, 0x01, 0xA4, 0x77, 0x11, 0xCA, 0x64, 0x13, 0xE0, 0x43, 0xD7, 0x43, 0xB1, 0xBA, 0x08, 0x34,
+    0xAF, 0x6E, 0x80, 0xD9, 0x9A, 0x00, 0xD4, 0xDF, 0x4D, 0x80, 0x59, 0x7D, 0x00, 0x9A, 0x6F, 0x2D,
+    0x80, 0x4D, 0x5D, 0x0F, 0xF8, 0x57, 0x66, 0xA0, 0x5C, 0xBA, 0x1E, 0x18, 0xCA, 0x05, 0x70, 0x53,
+    0x17, 0xA0, 0x58, 0x6D, 0x02, 0xBA, 0xBE, 0x99, 0xA0, 0x8E, 0x46, 0xA0, 0x4C, 0x54, 0x2B, 0x85,
+    0x80, 0xDF, 0x3E, 0x2F, 0x01, 0x06, 0x91, 0x11, 0x4C, 0xD6, 0xD2, 0xC7, 0xF6, 0x71, 0xFF, 0x6B,
+    0xF8, 0x92, 0xA7, 0x48, 0x75, 0x28, 0x63, 0x19, 0xEB, 0x50, 0xA4, 0x0E, 0x86, 0x15, 0x9A, 0x19,
+    0xEA, 0x08, 0x5D, 0xC2, 0xAC, 0x03, 0xE5, 0xDC, 0x84, 0x7A, 0xAC, 0xA2, 0x6F, 0x8B, 0xF4, 0x41,
+    0xD4, 0x69, 0xD5, 0xC7, 0x2E, 0x80, 0xC7, 0x45, 0xFA, 0x3B, 0xFA, 0xE0, 0x37, 0x5A, 0x4A, 0xB9,
+    0xDE, 0xC8, 0xA8, 0x8F, 0x3E, 0x93, 0x9F, 0x1D, 0x17, 0xC1, 0xEB, 0x4C, 0x3B, 0x09, 0x74, 0x3D,
+    0xF6, 0x47, 0x2B, 0x2E, 0x42, 0xAA, 0x47, 0xB3, 0x81, 0x37, 0x1B, 0x4D, 0xA0, 0x0E, 0xF5, 0x64,
+    0x13, 0x65, 0x34, 0x2B, 0xBE, 0x37, 0x89, 0x66, 0x2C, 0x17, 0x3A, 0x6C, 0xA2, 0xEB, 0xEB, 0x80,
+    0x0F, 0xE5, 0x5C, 0x4E, 0x94, 0x0B, 0xDD, 0xB3, 0x0B, 0x0C, 0x94, 0xCB, 0x29, 0xB8, 0x48, 0xF7,
+    0x7A, 0x4F, 0xB1, 0x62, 0x45, 0x63, 0xC2, 0x66, 0x81, 0x3A, 0x92, 0x85, 0x81, 0x5F, 0xB1, 0x02,
+    0x4E, 0xB6, 0xCF, 0x4B, 0xC0, 0xCE, 0xAA, 0xA8, 0x4F, 0x19, 0x91, 0xDB, 0x40, 0x7B, 0x26, 0x91,
+    0x1C, 0x7B, 0xF6, 0x67, 0x11, 0x79, 0xAD, 0xCE, 0xC2, 0xAA, 0x96, 0x1E, 0xC0, 0x4F, 0x00, 0xEF,
+    0xE4, 0xB2, 0x3B, 0x7C, 0xDC, 0x5E, 0x39, 0xFE, 0x98, 0x48, 0xAC, 0x64, 0xEB, 0x24, 0x16, 0xB2,
+    0x19, 0x69, 0x29, 0x17, 0x7C, 0xC0, 0x2E, 0x94, 0x33, 0x45, 0x02, 0xC1, 0x24, 0x68, 0x02, 0x2B,
+    0x94, 0x0B, 0xA7, 0x80, 0xD0, 0x01, 0x75, 0xF0, 0x80, 0x5D, 0x7C, 0x0B, 0x0C, 0x4D, 0x0F, 0xD4,
+    0xAF, 0x87, 0x33, 0xDB, 0xD7, 0x8D, 0x67, 0x89, 0x13, 0x4D, 0xA5, 0xE8, 0xD6, 0x9D, 0x13, 0x30,
+    0x3E, 0x5C, 0xFE, 0xB5, 0x9A, 0xC3, 0x42, 0x3E, 0x7B, 0x50, 0x4D, 0x77, 0x66, 0xA5, 0x80, 0x4E,
+    0x16, 0x30, 0x22, 0xED, 0xC1, 0xD9, 0xD7, 0xAD, 0xE5, 0x7E, 0xAB, 0xD6, 0xA2, 0x85, 0x4E, 0x24,
+    0x50, 0xA4, 0x23, 0x09, 0xB8, 0x89, 0xA1, 0xC7, 0xB7, 0x08, 0x24, 0x8A, 0x44, 0x19, 0xF3, 0x12,
+    0x6C, 0x02, 0x1B, 0x08, 0x76, 0xC6, 0xCE, 0xD4, 0x01, 0x1F, 0x18, 0xB0, 0x89, 0x22, 0x31, 0x04,
+    0xDC, 0x4F, 0x64, 0x01, 0x2F, 0x1B, 0x98, 0xED, 0x8B, 0xED, 0x2E, 0x56, 0xDF, 0x03, 0x47, 0xD2,
+    0x82, 0x11, 0x99, 0xA0, 0xD2, 0x81, 0x68, 0xE0, 0x76, 0x1B, 0xB5, 0x9C, 0xFA, 0x00, 0x12, 0x81,
+    0x62, 0xB5, 0x9B, 0x3E, 0xB3, 0x0F, 0xA0, 0x79, 0x37, 0x18, 0xD4, 0x77, 0xF4, 0x2D, 0x77, 0xD4,
+    0x77, 0xB8, 0x06, 0x94, 0x91, 0x06, 0x28, 0x16, 0x75, 0x0E, 0x56, 0x9C, 0x7A, 0xCF, 0xAE, 0x07,
+    0x6A, 0x75, 0xDB, 0xAA, 0x68, 0x27, 0xC0, 0x2E, 0xEA, 0x7B, 0xAE, 0x0C, 0x2D, 0xD0, 0xE1, 0x66,
+    0xA0, 0x0E, 0x46, 0xD4, 0xEF, 0x68, 0x22, 0xD8, 0x99, 0x42, 0x80, 0x15, 0xFC, 0x08, 0x9D, 0xE6,
+    0xB3, 0x9A, 0xBC, 0x3F, 0x4C, 0xD0, 0xF4, 0xD8, 0xF9, 0xB7, 0xA8, 0x46, 0x48, 0x75, 0x5F, 0x4E,
+    0xD0, 0x55, 0xEB, 0xC7, 0x23, 0x34, 0x5F, 0x15, 0x99, 0xC0, 0x4D, 0xB5, 0x8C, 0x60, 0x67, 0x1E,
+    0x3B, 0x9B, 0x35, 0x4E, 0x39, 0xCB, 0xF1, 0x98, 0x56, 0x8D, 0xFC, 0xEC, 0x46, 0xCD, 0xA3, 0x4D,
+    0x6A, 0xB1, 0x27, 0x8D, 0x38, 0x2F, 0x38, 0x12, 0x2E, 0xFE, 0x1A, 0x38, 0xA9, 0x02, 0x95, 0xFC,
+    0x64, 0xC2, 0x46, 0x89, 0xF0, 0xE5, 0x7A, 0x86, 0x47, 0x1E, 0x92, 0xF3, 0xA1, 0x58, 0x4C, 0x4B,
+    0x25, 0xDF, 0x8D, 0xD4, 0x22, 0x0B, 0x6E, 0xAE, 0x57, 0x5C, 0x34, 0x42, 0x15, 0x69, 0xFA, 0x32,
+    0xE2, 0x46, 0xBB, 0x60, 0x23, 0x09, 0x93, 0x18, 0xE0, 0x14, 0xDF, 0xE3, 0x5B, 0x37, 0xD2, 0x04,
+    0x1B, 0x71, 0xD1, 0x24, 0x5C, 0xA2, 0xA3, 0x3A, 0x35, 0xF5, 0x58, 0x7D, 0xFB, 0xC3, 0xAF, 0x24,
+    0xF7, 0xCA, 0x37, 0xA3, 0xC8, 0xAB, 0x12, 0x1B, 0x19, 0xBB, 0xD9, 0x4A, 0xEF, 0x22, 0x57, 0xB2,
+    0x3F, 0x70, 0x15, 0x40, 0x02, 0x20, 0x09, 0x48, 0x75, 0x0B, 0x37, 0xED, 0x04, 0x35, 0x0B, 0x54,
+    0xE1, 0x29, 0x30, 0x8B, 0x07, 0xBC, 0xB4, 0x60, 0xA5, 0xBD, 0x30, 0xDA, 0xA6, 0x7F, 0x14, 0x86,
+    0xCD, 0x63, 0x44, 0xA4, 0x47, 0x3E, 0x24, 0x23, 0x42, 0x1D, 0x75, 0xA2, 0x3B, 0x58, 0xF1, 0x3D,
+    0x1E, 0x17, 0xA8, 0x43, 0x15, 0xA9, 0x26, 0xBB, 0x60, 0x67, 0x56, 0x8A, 0x84, 0x07, 0xA1, 0x0E,
+    0x48, 0x28, 0x23, 0xFF, 0xE7, 0xF4, 0xAF, 0x56, 0xEE, 0xCE, 0x1F, 0xE8, 0x42, 0xBA, 0xE9, 0x9D,
+    0xAC, 0xB5, 0x14, 0xB2, 0x96, 0xD2, 0xFA, 0x05, 0x81, 0xEB, 0x1A, 0x52, 0x3C, 0x3E, 0x71, 0xA3,
+    0xA7, 0x90, 0xAD, 0x92, 0x19, 0x27, 0x22, 0x2F, 0x26, 0xFC, 0x54, 0xAF, 0x26, 0x21, 0xD8, 0x48,
+    0x2A, 0x12, 0x6E, 0x34, 0xC9, 0xCE, 0xD4, 0xC1, 0x2E, 0xD5, 0x44, 0xD3, 0xBA, 0xE8, 0x02, 0x9E,
+    0x21, 0x34, 0x81, 0xA1, 0xDA, 0xF0, 0x3D, 0x22, 0x11, 0xDF, 0x16, 0xB2, 0x81, 0xC7, 0xCA, 0x6D,
+    0xE8, 0x70, 0x2B, 0xD0, 0xD1, 0x6C, 0x40, 0xD7, 0xDE, 0x14, 0x4C, 0xEC, 0xBE, 0xBA, 0x0C, 0x6D,
+    0x3D, 0x79, 0x89, 0x9D, 0x48, 0xDF, 0x48, 0x68, 0x64, 0xC5, 0x6D, 0x54, 0x32, 0x61, 0xAE, 0xC3,
+    0xD3, 0x07, 0x31, 0x44, 0xD3, 0x52, 0xC5, 0x06, 0xDC, 0x1B, 0x11, 0xDC, 0xA6, 0x9E, 0x18, 0x85,
+    0x04, 0xF0, 0x9F, 0x08, 0x98, 0xC9, 0xB7, 0x18, 0x6E, 0x65, 0x0F, 0xF9, 0x77, 0xBF, 0x33, 0x53,
+    0xC9, 0x1B, 0x93, 0x11, 0x91, 0x50, 0xCF, 0xA5, 0x20, 0x94, 0xA9, 0x8A, 0xB8, 0xE8, 0x5B, 0x9A,
+    0xAF, 0x25, 0xE8, 0xDC, 0x44, 0x91, 0x7C, 0x4B, 0xF5, 0x9D, 0x04, 0xFE, 0x0F, 0x23, 0xA4, 0x26,
+    0x50, 0xC6, 0x01, 0xFC, 0x87, 0x13, 0x26, 0x95, 0x33, 0x6E, 0x74, 0xD1, 0x6C, 0x34, 0xF7, 0xBB,
+    0x49, 0x17, 0x6C, 0x23, 0x7D, 0x8E, 0x34, 0xC8, 0xA6, 0x66, 0x52, 0xD5, 0x1B, 0x64, 0x50, 0xCD,
+    0xAB, 0x5A, 0x69, 0x1F, 0xA6, 0x78, 0x47, 0x5B, 0x0B, 0x22, 0x81, 0x46, 0x24, 0x14, 0x1B, 0xD2,
+    0xD6, 0x13, 0xC2, 0x86, 0x4D, 0x2E, 0x52, 0x1D, 0xC6, 0x35, 0xEC, 0xE3, 0x72, 0xDF, 0x59, 0xC1,
+    0xFF, 0x41, 0xC4, 0xA4, 0x3A, 0xE0, 0xA6, 0xAE, 0x65, 0x60, 0xA3, 0x5C, 0x6C, 0xA2, 0x0B, 0xD5,
+    0x76, 0x23, 0xE1, 0x44, 0x7A, 0x2A, 0x99, 0x0E, 0x29, 0xE1, 0xEB, 0x39, 0xF1, 0xDC, 0x05, 0xDD,
+    0xAD, 0xEC, 0xA5, 0x04, 0xD0, 0x9E, 0x33, 0xFA, 0xCE, 0xF1, 0xF1, 0xF1, 0x99, 0x70, 0xB9, 0x79,
+    0xEE, 0x4F, 0xCA, 0x04, 0xFC, 0xCF, 0xE7, 0xAC, 0xF8, 0x70, 0xFB, 0x5F, 0x80, 0x93, 0xE5, 0x26,
+    0x0C, 0x22, 0x0B, 0xC5, 0x86, 0x4C, 0xD9, 0x8A, 0xBB, 0x09, 0x09, 0xF8, 0x60, 0x25, 0xE0, 0xDB,
+    0xFA, 0xF5, 0xC0, 0xC0, 0xAD, 0x26, 0xB0, 0x99, 0xA5, 0x09, 0xAC, 0xD5, 0xE8, 0x7B, 0xB3, 0x36,
+    0xAD, 0x6F, 0xCD, 0x9A, 0xE8, 0x30, 0x12, 0xD9, 0x30, 0xD2, 0xAB, 0xDD, 0x2F, 0x17, 0x0A, 0xA1,
+    0x8E, 0x54, 0xF2, 0xFF, 0x48, 0xC0, 0xDF, 0x90, 0x0D, 0x9E, 0xAC, 0x64, 0x82, 0xAB, 0x3C, 0x7A,
+    0x61, 0xE0, 0xBF, 0xC6, 0x21, 0x31, 0x4E, 0xD7, 0x1F, 0xF2, 0xEB, 0xEA, 0xF7, 0xE5, 0x0C, 0x7A,
+    0x80, 0x73, 0x91, 0xCD, 0xC5, 0xAD, 0xE8, 0x05, 0x8A, 0x89, 0x66, 0xA5, 0x4C, 0x78, 0xC1, 0x26,
+    0xCC, 0xD0, 0x16, 0x09, 0xDD, 0x51, 0xF1, 0xC1, 0x24, 0xA8, 0x83, 0x59, 0xC0, 0x8D, 0xC5, 0x0C,
+    0x6E, 0xB2, 0x11, 0xAA, 0xC9, 0x4E, 0x50, 0xC6, 0x2A, 0x80, 0x8D, 0xAE, 0x07, 0x1B, 0x1B, 0xC0,
+    0xC6, 0x6B, 0x80, 0x8D, 0x77, 0x00, 0x1B, 0x67, 0xA0, 0xF8, 0x7F, 0x23, 0x60, 0xDF, 0xD0, 0xED,
+    0xA9, 0x05, 0xEC, 0xF6, 0xF0, 0x01, 0xFA, 0xC3, 0x4E, 0x74, 0xED, 0xA5, 0x08, 0x78, 0x75, 0x53,
+    0x57, 0x80, 0xE6, 0xF6, 0xA1, 0xD8, 0x02, 0x95, 0xF4, 0xC0, 0xB0, 0x01, 0xE6, 0x8F, 0x96, 0xEC,
+    0x9E, 0xEE, 0x37, 0x50, 0x9B, 0xA9, 0xEE, 0x97, 0xFA, 0xC5, 0x49, 0x53, 0xC4, 0x47, 0x13, 0x34,
+    0x9F, 0x96, 0x08, 0x6B, 0x2D, 0x11, 0xFB, 0xC3, 0x75, 0x08, 0xB8, 0xBF, 0xE8, 0x87, 0x96, 0x5B,
+    0xB3, 0x59, 0x29, 0xA4, 0xB7, 0x33, 0x2E, 0xE1, 0x46, 0xFC, 0x48, 0xD7, 0x1A, 0xC1, 0x24, 0xAA,
+    0x39, 0x97, 0x6D, 0x7C, 0xCF, 0x8A, 0x49, 0x94, 0x11, 0x37, 0x51, 0x07, 0x3A, 0xB8, 0x8B, 0x5D,
+    0xB0, 0x3A, 0xE1, 0xDB, 0xC7, 0x35, 0xBB, 0xD5, 0x53, 0xDC, 0x97, 0x19, 0xDC, 0xF8, 0xE8, 0xC5,
+    0x31, 0x95, 0xD3, 0xD9, 0x4C, 0xAD, 0xEA, 0x6F, 0x3F, 0xBF, 0x67, 0xEB, 0x8F, 0x4E, 0x4E, 0x2E,
+    0x38, 0x15, 0xB1, 0x9A, 0xC0, 0xC5, 0x26, 0x42, 0x1D, 0xFD, 0x04, 0x6E, 0x6C, 0xC2, 0x5B, 0x46,
+    0x88, 0x6F, 0xB3, 0x49, 0xA4, 0x38, 0x39, 0xB9, 0xAD, 0xDB, 0xF5, 0x02, 0x30, 0x68, 0x90, 0xA8,
+    0xAE, 0xC6, 0x5B, 0xBD, 0xDE, 0xFE, 0x21, 0x9F, 0xC8, 0x92, 0x33, 0xFC, 0xB5, 0x5C, 0xDA, 0xCB,
+    0xCE, 0x5E, 0xA7, 0x5C, 0xA7, 0x90, 0x25, 0x51, 0x8A, 0x6C, 0xD8, 0xB5, 0x94, 0xD6, 0x26, 0xBA,
+    0x50, 0x24, 0xAA, 0xC9, 0x24, 0xEC, 0xCC, 0x06, 0x09, 0x0F, 0x1D, 0x4D, 0xA0, 0xE9, 0xDD, 0x84,
+    0x1B, 0xED, 0x4C, 0x15, 0x49, 0xD8, 0x44, 0x87, 0x15, 0xEA, 0x50, 0xBC, 0xDE, 0xFF, 0xC1, 0x5C,
+    0xBC, 0x31, 0xFE, 0xEF, 0x62, 0x7F, 0x38, 0x27, 0x2F, 0x73, 0x97, 0x2A, 0x99, 0xEB, 0x15, 0x99,
+    0x6C, 0xC2, 0xB4, 0xBA, 0xFB, 0x9A, 0x9E, 0xF7, 0x6B, 0x66, 0xED, 0x03, 0x6A, 0xB4, 0xAF, 0x01,
+    0xD4, 0x6F, 0xAA, 0x0D, 0x51, 0xAF, 0x4A, 0x37, 0x26, 0xCE, 0x6F, 0x3A, 0xBF, 0x6A, 0xE9, 0x09,
+    0xF8, 0x00, 0x16, 0xEA, 0xDE, 0x06, 0xCA, 0xA5, 0x9A, 0x40, 0x64, 0x82, 0x5A, 0x26, 0x60, 0xE8,
+    0x7F, 0xF1, 0xAE, 0xD2, 0xAF, 0x94, 0xB4, 0xD5, 0x10, 0x6A, 0xD2, 0x95, 0x3D, 0x73, 0x69, 0x73,
+    0xC6, 0x22, 0x3F, 0x99, 0x7F, 0xB3, 0xD5, 0x44, 0x88, 0x5A, 0xBD, 0xAE, 0xFF, 0xE7, 0x74, 0xF8,
+    0x5C, 0x0B, 0xFA, 0xA3, 0x0A, 0x7B, 0x3E, 0xD1, 0x2C, 0x00, 0xDD, 0xE7, 0x00, 0x27, 0xAD, 0x3E,
+    0xE9, 0xA5, 0x20, 0x70, 0x38, 0xC4, 0x80, 0x56, 0xC6, 0x3D, 0x04, 0x54, 0x43, 0xF9, 0xCE, 0x87,
+    0xA6, 0x01, 0x4A, 0x91, 0x05, 0x23, 0x22, 0x89, 0x7A, 0x3B, 0x1E, 0xA6, 0x42, 0x5A, 0x9A, 0xBE,
+    0x9E, 0xE0, 0x2E, 0x02, 0x45, 0x74, 0x11, 0x5C, 0xDF, 0xB5, 0xF0, 0x5B, 0x6A, 0x6A, 0xD5, 0xFC,
+    0x0D, 0x67, 0xB6, 0x37, 0x1B, 0xB7, 0xFE, 0xA0, 0x14, 0xE5, 0x42, 0x76, 0x01, 0xF7, 0x40, 0x4F,
+    0xD7, 0xF2, 0x0A, 0x50, 0x25, 0x60, 0x74, 0x09, 0x9A, 0xB6, 0xD9, 0x78, 0x3C, 0xE1, 0x25, 0x7B,
+    0x5E, 0x0B, 0x54, 0x3A, 0x3F, 0xE7, 0x96, 0xB9, 0x6D, 0xCF, 0xF2, 0xD2, 0x66, 0xCB, 0xF7, 0x3A,
+    0xD5, 0x3C, 0x38, 0xBF, 0x71, 0xF9, 0x99, 0x6E, 0xDC, 0xC6, 0xC8, 0x46, 0x21, 0x12, 0x8A, 0xF5,
+    0xE3, 0x93, 0x49, 0x5C, 0x25, 0xE5, 0x3F, 0xF0, 0x39, 0x72, 0x74, 0x39, 0x99, 0x6F, 0x56, 0xA0,
+    0x6B, 0xF5, 0x89, 0xCA, 0x19, 0x63, 0x36, 0xCA, 0xE0, 0xC7, 0x6A, 0xAA, 0x44, 0x26, 0x44, 0x26,
+    0x9C, 0xF4, 0x5C, 0x74, 0x76, 0x54, 0x71, 0xBA, 0x09, 0x28, 0x65, 0x02, 0xBA, 0x97, 0x46, 0x28,
+    0x97, 0x26, 0x40, 0xD7, 0x36, 0x2D, 0x36, 0xF2, 0xE4, 0xDB, 0x4D, 0xCE, 0xD7, 0xA1, 0x58, 0xD1,
+    0xC4, 0x97, 0xCC, 0x90, 0x06, 0x58, 0xDD, 0xC8, 0x6A, 0x16, 0xEE, 0x72, 0x8D, 0xF7, 0x9C, 0x2F,
+    0x70, 0x98, 0xD3, 0x96, 0x52, 0x16, 0x2A, 0x11, 0xAA, 0x1F, 0xDF, 0xE8, 0xCB, 0x48, 0x6B, 0x63,
+    0x2E, 0x8B, 0xA4, 0x3C, 0x64, 0xDF, 0xEB, 0xCE, 0x54, 0x5E, 0x92, 0xF3, 0x23, 0xE5, 0x42, 0x8D,
+    0xB4, 0x4D, 0xDF, 0x88, 0xF4, 0x56, 0xA4, 0xC7, 0x6F, 0x67, 0xA0, 0x89, 0xEB, 0x67, 0xCF, 0x29,
+    0xBA, 0xD1, 0x6B, 0x0C, 0x09, 0xF0, 0xDE, 0x87, 0xFB, 0x1D, 0x27, 0xB7, 0xF7, 0x1A, 0x7B, 0x27,
+    0x22, 0x94, 0xF2, 0xB9, 0x1B, 0x0B, 0xC3, 0x48, 0x35, 0x95, 0x0B, 0x34, 0xAD, 0x0F, 0x70, 0xC7,
+    0x26, 0xB0, 0x53, 0x3D, 0xC2, 0xBB, 0x54, 0x46, 0x9A, 0x73, 0x68, 0xCE, 0x09, 0x6D, 0x39, 0xFB,
+    0xEA, 0xAE, 0x25, 0xEB, 0x5A, 0x16, 0xB1, 0x0E, 0x20, 0x8B, 0xB8, 0x05, 0x8D, 0xB0, 0x7F, 0xCF,
+    0x0A, 0x54, 0x63, 0x25, 0xFD, 0x91, 0xE0, 0x44, 0x24, 0x52, 0x89, 0x6C, 0x50, 0xE8, 0xDE, 0xAA,
+    0x59, 0x9A, 0x42, 0xF3, 0x7C, 0x85, 0xA8, 0xC7, 0xD0, 0x84, 0x1C, 0x74, 0x5E, 0x90, 0x67, 0x27,
+    0x7D, 0x25, 0xC2, 0xF0, 0xB1, 0xA5, 0x8C, 0xB4, 0x5E, 0x85, 0xE9, 0x02, 0x0C, 0x3A, 0x32, 0x37,
+    0x42, 0xD7, 0x62, 0x56, 0x1D, 0x79, 0x3D, 0xF2, 0x48, 0xD7, 0x9B, 0x28, 0x6D, 0xF3, 0xAC, 0xC8,
+    0x62, 0x45, 0x7A, 0x2B, 0x53, 0x16, 0x9F, 0x69, 0x79, 0x14, 0xAA, 0x60, 0x56, 0xA8, 0x62, 0x39,
+    0x83, 0x5D, 0xEA, 0x11, 0xCC, 0x36, 0x00, 0x0C, 0x9A, 0x20, 0x3A, 0xE7, 0x2F, 0x9D, 0x7F, 0x7D,
+    0x32, 0x27, 0x46, 0xA7, 0xAC, 0xAB, 0x2A, 0xCE, 0x66, 0xA6, 0x58, 0xE8, 0x7A, 0x8A, 0x59, 0x95,
+    0x55, 0xE5, 0x59, 0xCE, 0x50, 0xF4, 0x2A, 0x1C, 0xD5, 0xD6, 0x5C, 0x85, 0x3D, 0x5F, 0x8B, 0xED,
+    0x0F, 0x12, 0xCD, 0xB1, 0x81, 0xFE, 0xF4, 0xE7, 0xAF, 0xD4, 0xBF, 0x8D, 0x60, 0x5B, 0x55, 0x58,
+    0x95, 0xA9, 0xD5, 0xCC, 0xEC, 0x90, 0x33, 0x2E, 0xEB, 0x21, 0x19, 0x68, 0x5A, 0x73, 0x9B, 0x86,
+    0xA6, 0xE7, 0x6E, 0x91, 0x34, 0xE7, 0x6C, 0xEF, 0xA7, 0xEC, 0x84, 0x55, 0xE9, 0xE0, 0x8D, 0x5F,
+    0x78, 0x3D, 0x7E, 0x0F, 0x4A, 0xF5, 0x7F, 0x22, 0xD5, 0x8F, 0x6F, 0xF4, 0x74, 0x3C, 0xA2, 0x36,
+    0xBF, 0xE9, 0xF7, 0xDA, 0x4D, 0xDC, 0x87, 0xBC, 0xEE, 0x4A, 0x52, 0x8F, 0x79, 0xFC, 0x66, 0x85,
+    0xB6, 0x5C, 0xA8, 0x71, 0x73, 0xB1, 0xD0, 0x88, 0xF4, 0x78, 0x59, 0x50, 0x05, 0xCE, 0x0B, 0xE4,
+    0xFD, 0xFA, 0x8F, 0x45, 0x25, 0xB1, 0x6A, 0x8E, 0x6A, 0x50, 0xE5, 0xF2, 0xDF, 0x56, 0x18, 0x91,
+    0xEE, 0x98, 0x95, 0x7A, 0x34, 0x97, 0x51, 0x00, 0xFC, 0x5C, 0xD2, 0xD3, 0x94, 0x11, 0x6C, 0xA2,
+    0xD2, 0x37, 0x17, 0xF9, 0xB9, 0xA7, 0xA7, 0x81, 0x3F, 0xC9, 0x25, 0x81, 0x73, 0x6F, 0x57, 0x4C,
+    0x02, 0x1E, 0x97, 0x0F, 0xCF, 0x80, 0x97, 0x8F, 0x44, 0xE0, 0xB1, 0xE1, 0x23, 0xBA, 0xEC, 0x6C,
+    0x00, 0x18, 0x74, 0x27, 0x3B, 0x35, 0xE7, 0xF7, 0xE2, 0xC4, 0x59, 0x10, 0xD3, 0x3C, 0xBB, 0x00,
+    0x85, 0xBC, 0xB9, 0xA8, 0x6F, 0x30, 0x03, 0x7E, 0xEC, 0x22, 0xE8, 0x5E, 0x4C, 0x91, 0xA8, 0x26,
+    0xB0, 0x11, 0x37, 0x42, 0x35, 0xE1, 0x02, 0xBA, 0x25, 0x43, 0x1D, 0x68, 0x7A, 0x68, 0x7A, 0x2D,
+    0xB1, 0xB6, 0x6A, 0xAD, 0x72, 0x60, 0xAE, 0xF6, 0xA6, 0xA3, 0x3A, 0x35, 0xD0, 0xB5, 0xCD, 0xCD,
+    0x0A, 0xBA, 0x90, 0x6E, 0x7A, 0xF0, 0x32, 0x77, 0x09, 0x1A, 0x19, 0xBB, 0x19, 0xDC, 0xA6, 0xAA,
+    0x9B, 0x13, 0x33, 0xBF, 0x1A, 0x05, 0x05, 0x55, 0xDD, 0x1B, 0x2B, 0x60, 0x65, 0x06, 0xAE, 0xDC,
+    0x18, 0xD9, 0xCB, 0x98, 0x45, 0x02, 0x1A, 0x91, 0x16, 0x44, 0x56, 0x30, 0xC7, 0xEB, 0x75, 0x72,
+    0x99, 0xFC, 0x7A, 0xD3, 0x43, 0xB7, 0x9C, 0xE6, 0x82, 0x30, 0xC3, 0x6B, 0x12, 0xA8, 0xE6, 0x42,
+    0xA0, 0x43, 0x1D, 0x20, 0x45, 0x8B, 0x78, 0x0E, 0xF1, 0x6B, 0x35, 0xE5, 0x39, 0x58, 0x29, 0x14,
+    0x0E, 0x16, 0xD5, 0x37, 0x52, 0xF1, 0x9B, 0x95, 0xBB, 0xF3, 0x07, 0xCA, 0xE4, 0x5E, 0xF9, 0x66,
+    0x74, 0xB2, 0xD6, 0x92, 0x25, 0xAF, 0xEE, 0xD1, 0xC1, 0x25, 0x3D, 0x39, 0x79, 0x61, 0x8F, 0xE1,
+    0x0A, 0x55, 0x84, 0xE3, 0xE3, 0x87, 0x64, 0x15, 0x73, 0xA1, 0xAB, 0x16, 0x91, 0x2D, 0xFF, 0x64,
+    0x38, 0x39, 0xD1, 0x72, 0xEB, 0x33, 0xB0, 0xC1, 0x33, 0xB0, 0xC2, 0xA7, 0x30, 0x2B, 0x5C, 0xCF,
+    0xC9, 0xE8, 0xF3, 0x70, 0x40, 0x4D, 0xD6, 0x94, 0x6F, 0x9E, 0x7C, 0x05, 0x2A, 0x91, 0xB4, 0x6B,
+    0x5E, 0x86, 0x06, 0x9E, 0xB3, 0x7E, 0x07, 0x24, 0x4A, 0xA1, 0xD8, 0xAA, 0x9E, 0xAE, 0xC5, 0xF5,
+    0x0C, 0xD0, 0xB4, 0x08, 0x78, 0x8E, 0x44, 0x44, 0xE8, 0x44, 0x64, 0x65, 0x50, 0x6D, 0xA9, 0x44,
+    0x02, 0x22, 0x09, 0x27, 0xF2, 0xB0, 0x28, 0xFB, 0x68, 0x03, 0x2B, 0x09, 0xB3, 0x0D, 0x23, 0xB7,
+    0xD8, 0xA8, 0xFB, 0x6A, 0xB2, 0x91, 0x8D, 0xBB, 0x34, 0xC1, 0x85, 0x6A, 0x2E, 0x16, 0xBB, 0xE2,
+    0x7F, 0x5F, 0x5A, 0xFB, 0x13, 0xE9, 0xE9, 0xA4, 0xA5, 0xBC, 0x9F, 0x67, 0xAF, 0x8C, 0x18, 0xBA,
+    0x96, 0x2F, 0xDB, 0xC4, 0x40, 0x23, 0x32, 0x22, 0x12, 0xB1, 0x72, 0xEF, 0x90, 0x2F, 0xFB, 0x13,
+    0xDE, 0xB1, 0xC7, 0x60, 0x45, 0x62, 0x01, 0x23, 0x2F, 0x69, 0x04, 0x1A, 0x0E, 0xE1, 0x97, 0xB9,
+    0xFE, 0x76, 0x93, 0x2A, 0x00, 0x9F, 0xE2, 0x08, 0x17, 0x8A, 0x11, 0xF9, 0x50, 0xD2, 0xC4, 0xBD,
+    0x97, 0x71, 0xAF, 0x50, 0x5C, 0x70, 0x1E, 0x27, 0xF0, 0x12, 0xA8, 0x5F, 0x5B, 0x29, 0x27, 0x37,
+    0x99, 0x85, 0x53, 0x3C, 0x6E, 0xAA, 0xC6, 0x22, 0x91, 0x18, 0xDA, 0xA6, 0xF7, 0xA3, 0x9D, 0x6F,
+    0xCC, 0xF8, 0x61, 0xA1, 0x94, 0x19, 0xBA, 0xDB, 0x79, 0x11, 0x74, 0x70, 0xB5, 0x9C, 0xA9, 0x5A,
+    0x1F, 0xAA, 0x58, 0x88, 0xAC, 0x38, 0x11, 0xF0, 0x5B, 0x7B, 0xE6, 0x41, 0x5E, 0x05, 0xF5, 0xB4,
+    0xF6, 0x3A, 0x74, 0x75, 0xE6, 0xAA, 0x51, 0xDC, 0xE6, 0x6D, 0xA9, 0xB9, 0x14, 0xBD, 0x7A, 0x48,
+    0x4D, 0xD4, 0x62, 0x53, 0x13, 0x32, 0x04, 0xE6, 0xA2, 0x68, 0xAD, 0x24, 0xEA, 0xD7, 0x56, 0x6E,
+    0xB1, 0x99, 0x85, 0x53, 0x1B, 0xD9, 0xAA, 0xB1, 0x48, 0x2E, 0x54, 0x73, 0xD3, 0xFB, 0xD1, 0xFF,
+    0xBE, 0xB4, 0x7E, 0x58, 0xE8, 0xA4, 0xA5, 0xBB, 0xAD, 0x7A, 0xDB, 0xC1, 0xD5, 0xAE, 0xE5, 0xCB,
+    0x3E, 0x54, 0xB1, 0x11, 0x19, 0x9D, 0x88, 0x2A, 0xED, 0xA3, 0x6F, 0x13, 0xED, 0xB3, 0x13, 0x07,
+    0xD0, 0xC7, 0xB5, 0x03, 0x68, 0x70, 0x07, 0xCC, 0x0E, 0x7F, 0x7B, 0x56, 0xA5, 0xAB, 0xE6, 0x9F,
+    0xB1, 0x94, 0x12, 0xFC, 0x7A, 0x84, 0x32, 0x68, 0x18, 0xD9, 0xE4, 0x00, 0xC8, 0x7F, 0x0F, 0x6A,
+    0xD9, 0x1D, 0xDB, 0x9E, 0x77, 0x1F, 0xBC, 0x15, 0xDF, 0x36, 0x01, 0xAA, 0xD9, 0x07, 0x40, 0xBA,
+    0x1E, 0x34, 0xFC, 0xC1, 0xA8, 0xC3, 0x52, 0x5F, 0xCE, 0x41, 0x1C, 0x1F, 0x1F, 0x1F, 0x5F, 0xA7,
+    0x13, 0x91, 0x65, 0x9F, 0x80, 0xE6, 0x07, 0x27, 0x43, 0x8B, 0x8B, 0x94, 0x01, 0xBB, 0x60, 0x62,
+    0x9E, 0x01, 0xBA, 0x96, 0x47, 0x77, 0x31, 0xAA, 0xC3, 0xA8, 0x53, 0x90, 0xF7, 0xF7, 0xEE, 0xE4,
+    0xC5, 0x1E, 0x1A, 0x91, 0xB8, 0xCF, 0x81, 0xFE, 0x3A, 0x27, 0x19, 0xB4, 0x66, 0xD8, 0x1C, 0x6A,
+    0x86, 0x3D, 0x76, 0xD9, 0x27, 0xF6, 0x1A, 0x79, 0x16, 0x7C, 0xC0, 0x05, 0x6E, 0x88, 0x48, 0xCC,
+    0x28, 0x86, 0x7D, 0x1A, 0xFE, 0x69, 0xEE, 0xE2, 0xA2, 0x06, 0x97, 0xEE, 0xA5, 0x99, 0x72, 0x72,
+    0x13, 0xB7, 0x68, 0x7A, 0x1B, 0xD9, 0x14, 0xAD, 0x90, 0x18, 0xDA, 0x6A, 0x72, 0x33, 0xFE, 0xF7,
+    0xA5, 0x65, 0x93, 0x49, 0xED, 0x41, 0x7D, 0x2F, 0xDB, 0x5C, 0x93, 0xA0, 0x2D, 0x67, 0xAA, 0xD6,
+    0xC5, 0x22, 0xA9, 0xD1, 0xF5, 0x92, 0xB2, 0x45, 0xB8, 0x00, 0x18, 0x2B, 0xD4, 0x19, 0x57, 0xC7,
+    0x5C, 0xD8, 0xC5, 0x6F, 0x53, 0x3D, 0x82, 0x9B, 0xCA, 0x09, 0x9A, 0xD6, 0x5C, 0x1E, 0xE2, 0x27,
+    0xFF, 0x52, 0x77, 0xE4, 0x19, 0x23, 0x22, 0x1B, 0x95, 0x7C, 0xEE, 0xC6, 0x4A, 0x33, 0xC3, 0xCA,
+    0xD0, 0x43, 0x32, 0x1B, 0xB0, 0xD8, 0x04, 0x68, 0xAE, 0xE5, 0xF6, 0xDF, 0xEF, 0xAA, 0x77, 0x2D,
+    0xE6, 0xF8, 0xB8, 0x6B, 0xA9, 0x64, 0xEB, 0x5A, 0x2A, 0x49, 0x5D, 0x0B, 0x55, 0xEC, 0x7A, 0xA8,
+    0xA2, 0x0F, 0xE0, 0x26, 0x3F, 0x82, 0x9B, 0x9A, 0x08, 0x6E, 0x74, 0x09, 0xEA, 0x50, 0x49, 0x4F,
+    0x17, 0x0A, 0x11, 0x91, 0x9E, 0x41, 0x64, 0x83, 0x4A, 0xEB, 0xD4, 0x8F, 0x5D, 0x3F, 0x0F, 0x8E,
+    0xD3, 0x30, 0x55, 0x1F, 0x52, 0xF5, 0xAA, 0xFA, 0x56, 0x04, 0xAA, 0xE9, 0x14, 0xA8, 0x26, 0x05,
+    0xFF, 0x15, 0x11, 0xB8, 0xCD, 0xFB, 0x2F, 0x47, 0x79, 0xFF, 0xE5, 0x2F, 0x8F, 0xA1, 0x54, 0xAC,
+    0xC2, 0x36, 0x48, 0xA0, 0x9C, 0xED, 0x0F, 0x5B, 0x6C, 0x64, 0x85, 0x62, 0xA1, 0x69, 0x21, 0xE1,
+    0x46, 0x14, 0xEF, 0x88, 0x0B, 0xC5, 0x02, 0x76, 0x36, 0x09, 0x90, 0xDF, 0x4F, 0x40, 0x2D, 0x0B,
+    0x60, 0x14, 0xDD, 0x52, 0xDF, 0x3E, 0x4B, 0xCE, 0x67, 0x40, 0xBB, 0xAA, 0x9A, 0xCC, 0xC0, 0x91,
+    0xC8, 0x08, 0xF5, 0xFD, 0x4E, 0xA0, 0x99, 0x18, 0x22, 0x4D, 0xC0, 0x6E, 0xB8, 0x09, 0x7C, 0xB0,
+    0x6A, 0x22, 0x04, 0xCA, 0x99, 0x66, 0xE6, 0xF1, 0x05, 0xAB, 0x98, 0xDD, 0x46, 0x7D, 0x90, 0x1B,
+    0x0A, 0x8F, 0xD4, 0xC4, 0x66, 0x15, 0x88, 0xE0, 0xA6, 0x72, 0x84, 0x6A, 0x1B, 0xC2, 0x21, 0xA7,
+    0x39, 0xCC, 0x0F, 0x22, 0x07, 0xDF, 0x56, 0xF3, 0xAA, 0x59, 0x70, 0x08, 0x50, 0x8D, 0x26, 0x42,
+    0xB1, 0x1E, 0xCD, 0x7B, 0xA5, 0x9E, 0x4A, 0x05, 0x7D, 0xE3, 0x2D, 0x40, 0x28, 0x47, 0xFF, 0xC7,
+    0xE7, 0x9E, 0x86, 0x5A, 0x64, 0x85, 0xFA, 0x4D, 0x11, 0xA8, 0x47, 0xF7, 0x7F, 0xED, 0xE9, 0xF0,
+    0x6A, 0xE2, 0xAE, 0x26, 0xC3, 0x75, 0x5E, 0x03, 0x78, 0xAA, 0x09, 0xDC, 0x58, 0x46, 0xB0, 0xEB,
+    0xE3, 0xF1, 0x50, 0x78, 0x2E, 0x15, 0x25, 0x70, 0xAB, 0x3D, 0x67, 0x4E, 0xD4, 0x5E, 0xCC, 0x1C,
+    0xF2, 0x60, 0x8F, 0x6B, 0x02, 0xFD, 0x7B, 0x92, 0x60, 0xE8, 0x0B, 0x09, 0xD9, 0x33, 0x56, 0x6F,
+    0xD9, 0x8D, 0xE0, 0x7B, 0x9B, 0xA0, 0x1E, 0x19, 0x46, 0x6E, 0x4C, 0xB8, 0x83, 0x93, 0x3C, 0x82,
+    0x19, 0xEE, 0x9F, 0xAB, 0xFD, 0xEC, 0x48, 0x8B, 0xF9, 0x2C, 0x90, 0x56, 0x8C, 0xC5, 0xBB, 0xDE,
+    0x22, 0xA3, 0xFE, 0xB6, 0x99, 0xD1, 0xF7, 0x9C, 0xC3, 0x66, 0xE8, 0xE3, 0xA9, 0x6B, 0x92, 0xCD,
+    0xF0, 0x23, 0x6F, 0x51, 0x30, 0x78, 0xEF, 0x0F, 0x8E, 0xAF, 0x43, 0x27, 0x32, 0x43, 0xF7, 0x9A,
+    0x24, 0xE8, 0x5A, 0xFF, 0x28, 0x78, 0x2D, 0x4E, 0xF4, 0xC5, 0x0C, 0x2E, 0xB0, 0xEA, 0x8C, 0x02,
+    0x89, 0xA6, 0x07, 0xDF, 0xD6, 0x01, 0xDC, 0x7C, 0x23, 0x80, 0x51, 0x40, 0x58, 0x2D, 0x2D, 0x60,
+    0xEE, 0x9F, 0xED, 0xCE, 0x3B, 0x6A, 0x44, 0x13, 0xC9, 0xD2, 0x02, 0x37, 0x64, 0x05, 0x23, 0xFF,
+    0x59, 0x22, 0xC5, 0x46, 0x25, 0x14, 0x09, 0xFC, 0xC4, 0x06, 0x36, 0x65, 0xA0, 0xAA, 0x8B, 0xD0,
+    0xB5, 0x85, 0xB4, 0x66, 0xE8, 0xF1, 0x22, 0xD2, 0x53, 0x68, 0x11, 0xE5, 0x48, 0xEE, 0xBD, 0x0D,
+    0xD7, 0x99, 0x57, 0x29, 0xF4, 0x97, 0x41, 0xEE, 0xDD, 0xD9, 0x26, 0x9A, 0xBD, 0x99, 0x7D, 0x97,
+    0x2E, 0xC3, 0x59, 0xBA, 0x52, 0x7F, 0x6A, 0x7A, 0xBB, 0xB8, 0xB0, 0xEF, 0xB6, 0x67, 0xA6, 0xB9,
+    0x4C, 0xE7, 0x81, 0x1E, 0xE7, 0x5E, 0xFF, 0xEB, 0x17, 0x8F, 0x5B, 0x8C, 0x88, 0x8C, 0x18, 0x79,
+    0x49, 0x22, 0x66, 0x25, 0x5D, 0xDF, 0x53, 0xF6, 0xA7, 0x54, 0x6A, 0x75, 0x75, 0x92, 0x13, 0xD8,
+    0xC8, 0x29, 0xB0, 0xD2, 0x01, 0xFE, 0xD5, 0x01, 0x28, 0x15, 0xCC, 0xA7, 0xAE, 0x4E, 0x79, 0xEF,
+    0xAC, 0x5E, 0x5A, 0xEA, 0x98, 0xB4, 0x16, 0xE5, 0x57, 0xC0, 0x0C, 0x32, 0x43, 0xB9, 0x7D, 0x42,
+    0x02, 0xD5, 0x42, 0xA3, 0x49, 0x0B, 0xE9, 0xED, 0x02, 0x2E, 0xB2, 0x92, 0x8B, 0x9D, 0x66, 0xA5,
+    0x5A, 0x39, 0xDA, 0x40, 0x76, 0xA1, 0xAD, 0xC0, 0xE3, 0xF2, 0x80, 0x1B, 0x7D, 0x73, 0x87, 0x03,
+    0xE4, 0x1D, 0xB4, 0xCB, 0x39, 0x85, 0xA1, 0xD3, 0x40, 0x6B, 0xF8, 0x48, 0xDA, 0x01, 0xF5, 0x28,
+    0xC0, 0xDA, 0x3E, 0x0C, 0x0B, 0x7B, 0x7C, 0x7C, 0x1D, 0x75, 0x78, 0x16, 0xBC, 0x24, 0x6A, 0x59,
+    0x70, 0xB2, 0x2A, 0xD2, 0xB8, 0x99, 0xD4, 0xAF, 0x29, 0x35, 0xB3, 0xA2, 0xCE, 0xE6, 0x9A, 0x3D,
+    0xBD, 0xAE, 0xD5, 0x49, 0x6B, 0x82, 0x2A, 0x8F, 0x8B, 0x6A, 0x43, 0x72, 0xC0, 0x7F, 0xEE, 0x42,
+    0x51, 0x1D, 0x6D, 0x44, 0x33, 0x09, 0x2E, 0x03, 0x16, 0xF7, 0x0B, 0xCD, 0x7E, 0xE1, 0x90, 0xEF,
+    0xDA, 0x68, 0x46, 0x03, 0x37, 0x5D, 0xBC, 0xE3, 0x03, 0x17, 0xFA, 0xA0, 0x17, 0xDF, 0xB8, 0x0F,
+    0xCD, 0x7D, 0x05, 0x31, 0x89, 0x44, 0x06, 0x99, 0xE9, 0xD4, 0x57, 0xFD, 0x9D, 0x03, 0x6C, 0xAB,
+    0x4B, 0x40, 0x37, 0x04, 0xE8, 0x9E, 0x5B, 0xA0, 0x6B, 0x3B, 0xF0, 0x67, 0x9A, 0x75, 0x96, 0xAA,
+    0x6D, 0x36, 0xA0, 0x91, 0x00, 0x57, 0x3E, 0x31, 0xED, 0x2A, 0x98, 0x21, 0xDA, 0x87, 0x42, 0xB3,
+    0x1B, 0x77, 0xDD, 0x33, 0x89, 0x7F, 0x0F, 0xA7, 0x46, 0x22, 0xFE, 0xC3, 0xB2, 0xE2, 0x5E, 0x5E,
+    0x87, 0xB6, 0xFC, 0xD1, 0xEC, 0xC6, 0xE2, 0xCD, 0xD9, 0x46, 0x4E, 0x67, 0x93, 0xF0, 0x0B, 0x03,
+    0x2E, 0xE1, 0xFB, 0x32, 0xE1, 0xC6, 0x62, 0xA3, 0x8C, 0x08, 0xC5, 0xA2, 0xD5, 0xEF, 0x7A, 0xC4,
+    0x53, 0x45, 0xEA, 0xF0, 0x91, 0x85, 0x6A, 0xFA, 0xD2, 0x4A, 0x71, 0x3F, 0x79, 0x90, 0xB5, 0x0E,
+    0xF8, 0xB5, 0x9A, 0xA8, 0x96, 0x3C, 0xBC, 0x2B, 0xC7, 0xC7, 0x5C, 0x39, 0x3E, 0xA6, 0xD4, 0x4C,
+    0x73, 0x30, 0x22, 0x3D, 0x22, 0x23, 0xC5, 0x0A, 0xC5, 0x5E, 0x4A, 0xE8, 0x38, 0x4C, 0xCE, 0xBB,
+    0x5E, 0x7A, 0xF3, 0xE4, 0xE4, 0xA5, 0x37, 0x6F, 0x5B, 0x11, 0x75, 0x20, 0x5F, 0xDC, 0x4E, 0x4E,
+    0x4E, 0xB6, 0x2F, 0xE8, 0x85, 0x7B, 0x5A, 0xDB, 0x07, 0x7D, 0x26, 0x37, 0xA9, 0x47, 0x22, 0x33,
+    0x14, 0x92, 0x2B, 0xB5, 0x22, 0x8A, 0x0B, 0xDF, 0x2F, 0xAC, 0xC7, 0xB3, 0xC9, 0x29, 0x67, 0xD5,
+    0x0B, 0x93, 0xCE, 0x4D, 0xCE, 0x5B, 0x5D, 0x68, 0x93, 0x5E, 0x7C, 0x24, 0xB7, 0x29, 0xE4, 0x36,
+    0xB5, 0x6C, 0x38, 0x11, 0x2A, 0x91, 0xB6, 0x14, 0x09, 0x79, 0x2F, 0x1A, 0x16, 0x60, 0x10, 0xE0,
+    0xB1, 0xEE, 0x20, 0xEC, 0x32, 0xEE, 0x29, 0xF1, 0x41, 0xA4, 0xE5, 0x4A, 0xF7, 0xB9, 0x36, 0xE7,
+    0x7A, 0xCB, 0xC8, 0x75, 0x8A, 0xA5, 0x90, 0x96, 0xB5, 0x94, 0x88, 0xAF, 0x64, 0xA5, 0xFE, 0x7A,
+    0xEC, 0xDA, 0xEA, 0xFB, 0x93, 0x0B, 0xC5, 0x1B, 0x53, 0x19, 0x91, 0x58, 0x24, 0x7C, 0x64, 0xA3,
+    0x9E, 0xF1, 0x6D, 0xB5, 0x50, 0x07, 0xCD, 0x1D, 0x6E, 0xD8, 0x99, 0xAE, 0x25, 0xD1, 0x04, 0x3A,
+    0xE3, 0x26, 0x9A, 0x67, 0x5F, 0x9E, 0x71, 0xDF, 0x8F, 0x09, 0x2B, 0x73, 0x07, 0x32, 0x37, 0x3D,
+    0xCD, 0xB4, 0x6F, 0x95, 0xBF, 0x4D, 0x4B, 0xBD, 0x38, 0x4A, 0xF9, 0x66, 0xE4, 0x74, 0xD8, 0x70,
+    0xCF, 0x4A, 0x78, 0x08, 0x32, 0xF5, 0xF8, 0xF8, 0x3A, 0xB5, 0x48, 0xDE, 0x06, 0x86, 0x36, 0x07,
+    0x09, 0x5B, 0x7E, 0x22, 0xB3, 0x66, 0x83, 0x6B, 0xF7, 0x4E, 0x05, 0x3B, 0xE7, 0xA9, 0xD3, 0x32,
+    0x79, 0x8E, 0x0B, 0x0E, 0xD7, 0x15, 0x87, 0xEB, 0x96, 0xBC, 0x00, 0x0E, 0xD7, 0xDD, 0xB8, 0x0F,
+    0x9D, 0x24, 0x2A, 0xC9, 0x95, 0xCB, 0x7A, 0xFA, 0x40, 0x29, 0x1F, 0x19, 0x65, 0x4B, 0xF5, 0x1F,
+    0x4A, 0x3F, 0xF9, 0xE9, 0x62, 0x95, 0xF9, 0xCA, 0x17, 0x28, 0x65, 0x42, 0x36, 0x1D, 0x8A, 0xA2,
+    0x21, 0xED, 0x02, 0xBE, 0xA5, 0x8C, 0xE7, 0x7B, 0xAF, 0xF6, 0xCF, 0x3F, 0x44, 0x19, 0x3F, 0xC5,
+    0xD0, 0xB4, 0x95, 0x4C, 0x0C, 0x0B, 0x65, 0xCA, 0x5B, 0x67, 0x71, 0x72, 0x72, 0x9B, 0x4E, 0x36,
+    0x2A, 0x91, 0x89, 0xC7, 0x8E, 0x9F, 0xFE, 0x25, 0x91, 0x42, 0x25, 0x12, 0x44, 0xD2, 0x83, 0x99,
+    0xA7, 0x3F, 0xEE, 0xE9, 0x36, 0x05, 0xF6, 0xAD, 0xE0, 0x82, 0xEE, 0xB4, 0xBD, 0xC2, 0xAC, 0xF5,
+    0x6E, 0x2A, 0x96, 0xC3, 0xE7, 0x57, 0xE9, 0xCA, 0xBE, 0xFA, 0xD1, 0xCC, 0xB0, 0xA1, 0x3B, 0x9B,
+    0xA6, 0xEA, 0x4C, 0xCF, 0x55, 0xEA, 0xB6, 0x08, 0x74, 0x34, 0x9A, 0x5B, 0x2A, 0x44, 0x5A, 0x0A,
+    0x99, 0x2E, 0x57, 0xF5, 0x1F, 0x3B, 0x7E, 0x1A, 0x23, 0x12, 0xF3, 0xA6, 0x31, 0xB4, 0xF9, 0x81,
+    0x5D, 0x6E, 0xA4, 0xD1, 0xE7, 0xD3, 0x4C, 0x7D, 0xC8, 0xE2, 0xB1, 0xF3, 0xEE, 0xC7, 0x0F, 0x9C,
+    0xBF, 0xBC, 0x6B, 0xB3, 0x14, 0xCE, 0x12, 0xFB, 0xDB, 0x9E, 0xD8, 0x6F, 0x42, 0x96, 0xC5, 0xE3,
+    0x5B, 0x4B, 0xA9, 0xA5, 0xB1, 0xED, 0x90, 0x31, 0x72, 0xA1, 0x18, 0xE5, 0x43, 0xA9, 0x12, 0x69,
+    0xBD, 0x04, 0xBA, 0xDB, 0x3F, 0x1F, 0x95, 0xC8, 0xF6, 0x49, 0x6D, 0x53, 0xB1, 0xE6, 0x11, 0x9D,
+    0xAF, 0x9E, 0x15, 0xE9, 0xF2, 0x87, 0xF1, 0xD2, 0x87, 0x39, 0x1B, 0xAC, 0x1F, 0x6E, 0x97, 0x3E,
+    0xB4, 0xD9, 0x86, 0xD4, 0x6A, 0x3B, 0x7A, 0xCD, 0x46, 0x5C, 0x43, 0x33, 0x02, 0x2E, 0x37, 0xDE,
+    0x20, 0x5F, 0x80, 0x46, 0xB2, 0x59, 0x54, 0x2F, 0xA1, 0x4A, 0xB8, 0x84, 0x9B, 0xB9, 0xB8, 0x5A,
+    0xCD, 0x27, 0xA9, 0xA5, 0xF7, 0xD2, 0xE3, 0x5B, 0x3C, 0x0C, 0xB0, 0xE5, 0xB4, 0x6E, 0x91, 0x72,
+    0xB6, 0xB7, 0x8A, 0xB8, 0x09, 0x37, 0xB6, 0xF5, 0x57, 0xA7, 0xE6, 0xEB, 0x63, 0x23, 0x7D, 0xB3,
+    0x51, 0xCF, 0x94, 0x23, 0xAE, 0xA7, 0x86, 0x6B, 0x70, 0x0D, 0xFC, 0xE7, 0xF0, 0x9B, 0x66, 0x3E,
+    0xB8, 0x9E, 0xE7, 0x55, 0x7A, 0x18, 0x26, 0x45, 0xBB, 0x15, 0xCF, 0x3F, 0x88, 0x59, 0x36, 0x22,
+    0x51, 0x1D, 0xFF, 0x21, 0x6F, 0x6B, 0x17, 0xCA, 0xB9, 0x03, 0x97, 0x3E, 0x4C, 0x97, 0x3E, 0x3C,
+    0x88, 0xF4, 0x50, 0xA5, 0x9C, 0x2E, 0xCA, 0xD9, 0x0C, 0xF7, 0x28, 0x45, 0x42, 0x21, 0x32, 0x71,
+    0xE5, 0x0B, 0xB5, 0x7C, 0x46, 0x26, 0x3B, 0x93, 0x18, 0xF0, 0xBD, 0x1B, 0xCB, 0x58, 0x24, 0x36,
+    0x7C, 0xDB, 0x04, 0x37, 0xD9, 0xF9, 0x5F, 0xA5, 0xF7, 0x0D, 0xCD, 0x0D, 0xF9, 0x4F, 0xF2, 0x69,
+    0xE1, 0x91, 0x3C, 0x9F, 0xEA, 0x24, 0xA4, 0x7D, 0x5A, 0xEB, 0xEC, 0x23, 0xEC, 0xC5, 0xEB, 0x32,
+    0x67, 0x37, 0xEA, 0xBC, 0x8F, 0xE4, 0x2D, 0x7A, 0x37, 0xF8, 0x2E, 0x7B, 0x12, 0xD9, 0x69, 0xD8,
+    0x1D, 0x89, 0xDD, 0xB9, 0xD8, 0xFD, 0x88, 0xF5, 0xE2, 0xCD, 0x76, 0xD7, 0x22, 0x6F, 0x54, 0xBB,
+    0x0B, 0xB2, 0xEF, 0x2A, 0x79, 0x93, 0x2B, 0xB2, 0x6B, 0xB0, 0x3B, 0x20, 0x79, 0xF3, 0x31, 0xAB,
+    0xEA, 0x48, 0x15, 0x75, 0xE1, 0xF9, 0xA0, 0xAA, 0xB2, 0xED, 0x48, 0xB0, 0xEC, 0x83, 0xF6, 0x00,
+    0xEF, 0xCF, 0x40, 0xED, 0xF9, 0x46, 0x46, 0xFD, 0x4A, 0x06, 0x2F, 0xAA, 0x96, 0x34, 0xCB, 0x43,
+    0x5C, 0xA7, 0xA6, 0xA7, 0xE9, 0x0B, 0xC1, 0x08, 0x2E, 0xE1, 0x12, 0x7E, 0xC4, 0x4F, 0x9C, 0x6A,
+    0x11, 0xFF, 0xA1, 0xAF, 0x3F, 0xEE, 0x79, 0x6F, 0x5F, 0x4B, 0x5F, 0x4B, 0x2F, 0x1B, 0xC3, 0x96,
+    0xF1, 0xDA, 0x2E, 0xE0, 0x46, 0x06, 0xF0, 0xD8, 0x05, 0x93, 0x70, 0x23, 0xD5, 0xA4, 0x6D, 0xCC,
+    0x45, 0x82, 0x15, 0x37, 0x51, 0x46, 0x6D, 0x47, 0x2D, 0x12, 0x6C, 0xB8, 0x09, 0x3B, 0xE3, 0x3F,
+    0x44, 0x1D, 0x4C, 0x7A, 0x1F, 0x03, 0xD5, 0x8F, 0x66, 0xBB, 0xD0, 0x48, 0xEF, 0x46, 0x86, 0x85,
+    0x0E, 0xA3, 0x21, 0x44, 0x9B, 0x7D, 0xD2, 0xEE, 0xCC, 0x4D, 0x76, 0x01, 0x8E, 0x74, 0x4D, 0xBD,
+    0x14, 0x77, 0x8C, 0xB7, 0x55, 0x84, 0xF7, 0xA5, 0xE2, 0x49, 0xF6, 0xB4, 0xB5, 0x6A, 0xAC, 0x81,
+    0xE9, 0x9B, 0x2B, 0x3B, 0x34, 0xA0, 0x9C, 0x8B, 0x99, 0x87, 0x60, 0x03, 0x32, 0xE2, 0x2C, 0xEF,
+    0xE8, 0x0A, 0x78, 0xD7, 0xCA, 0xF3, 0x1E, 0xC4, 0x3E, 0x90, 0x32, 0x7B, 0x8B, 0x9C, 0xD8, 0x43,
+    0x7F, 0x7D, 0x1E, 0x66, 0x9F, 0xE3, 0xA9, 0xF5, 0xEF, 0x45, 0xE1, 0x5F, 0x04, 0xE9, 0xF7, 0x67,
+    0xE1, 0x4E, 0x75, 0x36, 0x02, 0xD5, 0x00, 0xFF, 0xFB, 0x2B, 0xE0, 0x64, 0x03, 0x6C, 0x76, 0xEF,
+    0x2F, 0xCF, 0xFD, 0xA3, 0x87, 0x2F, 0xA9, 0x36, 0xA0, 0x90, 0x08, 0x74, 0xBE, 0x07, 0xF7, 0xD5,
+    0x04, 0x36, 0x56, 0x23, 0xAC, 0x3C, 0x05, 0x47, 0xE7, 0x71, 0xBB, 0x00, 0xBF, 0xFE, 0x3C, 0x6A,
+    0x91, 0x72, 0x2D, 0x4A, 0xC5, 0xA1, 0xAA, 0x38, 0x9C, 0x8D, 0x7A, 0x3D, 0x94, 0xB1, 0x73, 0x6D,
+    0xB0, 0x3F, 0x3C, 0xA9, 0x7F, 0xEB, 0x3F, 0xA8, 0xC3, 0x61, 0x86, 0x7D, 0x7B, 0xB8, 0xEA, 0xF4,
+    0x10, 0x96, 0x14, 0x09, 0x8A, 0xDE, 0xB7, 0x70, 0xEB, 0xC6, 0x04, 0x95, 0x2C, 0x40, 0xB7, 0x9D,
+    0xCD, 0xCD, 0x95, 0xE3, 0xA7, 0xC9, 0x9E, 0xA5, 0xC8, 0x68, 0x44, 0xFA, 0x46, 0x26, 0x8A, 0x55,
+    0xE1, 0x01, 0x82, 0x51, 0xDB, 0x6C, 0x74, 0xEB, 0x2E, 0xB4, 0x98, 0x5C, 0xAC, 0x40, 0xA1, 0x2D,
+    0x35, 0x88, 0xBE, 0xF9, 0x3F, 0x53, 0x3D, 0xFB, 0x56, 0xEE, 0xB9, 0xD2, 0x56, 0x88, 0x5C, 0xBA,
+    0x90, 0x1C, 0xEF, 0x7D, 0x46, 0xC3, 0xCE, 0x57, 0x45, 0x27, 0xA2, 0x99, 0xF4, 0x3E, 0xAB, 0x66,
+    0x92, 0xBB, 0x00, 0xF8, 0xBE, 0x4A, 0x3A, 0x57, 0x12, 0xA0, 0x8A, 0xD4, 0x5A, 0x53, 0x34, 0x12,
+    0x38, 0x92, 0xCF, 0xD2, 0xAC, 0xD4, 0x22, 0x6D, 0x21, 0x53, 0x25, 0x12, 0x72, 0x97, 0xC8, 0xC5,
+    0x8D, 0x37, 0x2F, 0x45, 0x2D, 0xC6, 0x67, 0xAB, 0x7C, 0x80, 0xFF, 0x6F, 0x9C, 0xD3, 0xC9, 0xFD,
+    0xED, 0x83, 0x87, 0x36, 0x45, 0x05, 0x49, 0x79, 0x69, 0xE1, 0x63, 0x89, 0x73, 0xED, 0xBE, 0xAC,
+    0xBB, 0xF3, 0x5F, 0x87, 0x2C, 0x62, 0x3B, 0x1F, 0xDD, 0xC3, 0x7D, 0x4D, 0x66, 0x3A, 0xFF, 0x7A,
+    0x2C, 0x7E, 0x32, 0xD7, 0xA1, 0xDA, 0xE8, 0xF0, 0x53, 0xB1, 0x20, 0xB8, 0x50, 0x46, 0x36, 0x9A,
+    0xBE, 0x99, 0x48, 0x8F, 0xAF, 0x58, 0x91, 0x9E, 0x5A, 0x46, 0x38, 0xF5, 0x2D, 0x76, 0xE9, 0xC0,
+    0x8D, 0x02, 0xDE, 0x08, 0x26, 0x15, 0xD2, 0x56, 0x93, 0x95, 0x7B, 0xBE, 0xB5, 0x32, 0x27, 0xB4,
+    0x55, 0xF9, 0xFA, 0x39, 0xBB, 0xD5, 0x1C, 0xCA, 0xF7, 0x87, 0xDE, 0x4C, 0xBF, 0x0F, 0xE9, 0x09,
+    0xC0, 0x7C, 0x91, 0xA3, 0x49, 0x12, 0xC3, 0xF7, 0x25, 0x3A, 0xE9, 0xEB, 0x5E, 0xEE, 0x70, 0xD7,
+    0x8D, 0xD8, 0x98, 0xC0, 0x7D, 0x3D, 0xC0, 0xB5, 0x67, 0xC0, 0xFC, 0x64, 0x84, 0x4A, 0xDA, 0x9C,
+    0x9F, 0xDD, 0x56, 0x28, 0x7F, 0xB8, 0x40, 0xF3, 0x5C, 0x84, 0xB5, 0x8A, 0xC6, 0xC6, 0x7A, 0xFC,
+    0x8D, 0x3A, 0xF8, 0x57, 0x63, 0x87, 0x97, 0x67, 0x17, 0x86, 0xE4, 0x46, 0x8D, 0xD7, 0xCF, 0xA1,
+    0x3D, 0xFE, 0xF5, 0x41, 0x0F, 0xAB, 0x6D, 0x47, 0x96, 0xA9, 0x07, 0xD4, 0x8D, 0xC0, 0x51, 0xFB,
+    0x10, 0xDB, 0x60, 0x44, 0x22, 0xD4, 0x72, 0xFF, 0x30, 0x29, 0x72, 0x59, 0x9B, 0xC7, 0x43, 0xFB,
+    0x8C, 0x0F, 0x07, 0x3B, 0x70, 0x4E, 0xB1, 0x87, 0x33, 0x13, 0xB2, 0x5D, 0xFA, 0x83, 0x66, 0xFF,
+    0x83, 0x0F, 0xE0, 0x7B, 0xEC, 0x58, 0xCE, 0x90, 0x18, 0xA0, 0x0E, 0x2E, 0x62, 0xE7, 0x23, 0x11,
+    0x91, 0x52, 0x44, 0x69, 0x05, 0x0E, 0x25, 0xB5, 0x0F, 0x40, 0x33, 0xD2, 0xAC, 0x34, 0xD2, 0x3B,
+    0xE9, 0xCD, 0xDF, 0x9E, 0x5F, 0xF3, 0x85, 0x44, 0x3A, 0xE1, 0xCA, 0x27, 0x0E, 0xEE, 0xA1, 0xB9,
+    0xE0, 0x22, 0x29, 0xB3, 0x09, 0xD5, 0xC1, 0xAB, 0x34, 0x7F, 0x8F, 0x07, 0xE5, 0x02, 0x26, 0x3D,
+    0x42, 0xF3, 0x5C, 0xB0, 0xF7, 0x15, 0x59, 0x2C, 0x81, 0x26, 0x63, 0x5D, 0x7E, 0x79, 0x05, 0x74,
+    0x7E, 0xE7, 0x1C, 0xFA, 0x03, 0x90, 0xE8, 0xDC, 0x77, 0xA6, 0x33, 0x1B, 0xD5, 0x67, 0xC1, 0x35,
+    0x42, 0x27, 0x1C, 0xCB, 0x43, 0x3C, 0x2A, 0x1B, 0x73, 0xD1, 0xDC, 0x8D, 0x19, 0xC9, 0xD0, 0x04,
+    0x85, 0x73, 0xD2, 0x9D, 0xF9, 0x60, 0x24, 0x4C, 0x7A, 0xA4, 0x58, 0x9E, 0xB4, 0xF7, 0x93, 0x95,
+    0x68, 0x25, 0x14, 0x7B, 0x83, 0x66, 0x19, 0xA9, 0x66, 0xCA, 0x19, 0x1B, 0x33, 0x22, 0xC2, 0xC3,
+    0xA7, 0xF2, 0x38, 0x5B, 0x76, 0x9C, 0x21, 0xBE, 0x35, 0xC7, 0xC7, 0x6D, 0xA2, 0x16, 0x29, 0x27,
+    0x3A, 0xB9, 0xD7, 0xB4, 0x54, 0x33, 0x09, 0x7C, 0xB0, 0x23, 0x6C, 0x38, 0xB0, 0x33, 0xBF, 0xF9,
+    0xD6, 0x00, 0xB5, 0xF6, 0x0C, 0x02, 0x7F, 0x0E, 0x37, 0xB5, 0x5D, 0x86, 0x5D, 0x0D, 0x1C, 0x24,
+    0xEB, 0x26, 0x98, 0xE9, 0x5A, 0x5C, 0x28, 0x12, 0x74, 0xB8, 0x88, 0x9D, 0xCD, 0x20, 0x22, 0xA1,
+    0x13, 0x91, 0xAD, 0xD8, 0x3B, 0x37, 0x79, 0x67, 0xDE, 0x6A, 0x8B, 0x85, 0x2B, 0xAC, 0x85, 0x44,
+    0x6F, 0x24, 0xD5, 0xFD, 0xB1, 0x94, 0x01, 0xFF, 0xEC, 0x84, 0x1B, 0x23, 0x65, 0x7C, 0xE4, 0x9C,
+    0x33, 0xDC, 0x9E, 0xB9, 0xB9, 0xC5, 0x92, 0x55, 0xC2, 0x67, 0x83, 0xB4, 0xE7, 0x4C, 0x58, 0xB3,
+    0x55, 0x3B, 0x8F, 0x0F, 0x54, 0x82, 0x14, 0x03, 0xCD, 0x73, 0x01, 0xF7, 0xFD, 0xA8, 0x1B, 0xBF,
+    0x44, 0xCD, 0xF6, 0xE8, 0x7E, 0xB5, 0xF7, 0xA6, 0x25, 0xC8, 0xDD, 0x79, 0xCD, 0x78, 0x19, 0x53,
+    0x36, 0x1E, 0x32, 0x6D, 0xAA, 0x52, 0x2E, 0xE2, 0x7A, 0x7C, 0x8F, 0xB4, 0xAC, 0x54, 0x2B, 0x65,
+    0xC4, 0x47, 0x9A, 0xC0, 0x70, 0xE1, 0x0F, 0xCF, 0xC9, 0xB7, 0x38, 0xC8, 0xF7, 0x4B, 0xAA, 0x86,
+    0x66, 0x45, 0xF3, 0x20, 0xDA, 0x61, 0xE6, 0xC6, 0x23, 0x11, 0x11, 0x23, 0x22, 0xB2, 0x54, 0x22,
+    0x7B, 0x82, 0xA0, 0x90, 0x48, 0x29, 0x51, 0xD7, 0xA2, 0x9B, 0x74, 0x30, 0x75, 0xCE, 0x05, 0xF9,
+    0xFE, 0x8C, 0x67, 0xA0, 0xCB, 0xC6, 0x79, 0xE5, 0x2A, 0xA9, 0x48, 0x26, 0x95, 0x6B, 0x91, 0xAA,
+    0x64, 0x97, 0x72, 0xB6, 0xB3, 0x69, 0xCB, 0xEC, 0x30, 0xEE, 0xB7, 0x70, 0x01, 0xEA, 0xD0, 0xD2,
+    0x3C, 0x17, 0xF0, 0x7F, 0x11, 0xF0, 0xA2, 0xD0, 0xDF, 0x66, 0xCA, 0x15, 0x8D, 0x7F, 0xCA, 0xCA,
+    0x6C, 0xC1, 0x2E, 0xB7, 0x76, 0x5F, 0x52, 0x7D, 0x28, 0x45, 0x3F, 0x47, 0x30, 0xC3, 0x06, 0xF8,
+    0xD7, 0x47, 0x30, 0xCF, 0x9E, 0x5B, 0x99, 0xE9, 0x1F, 0xB3, 0x32, 0x7F, 0x4A, 0xDB, 0xF4, 0x0E,
+    0xAA, 0x9F, 0x4C, 0xC8, 0x82, 0x5B, 0x29, 0x56, 0x8C, 0x04, 0x86, 0x05, 0x3F, 0xB4, 0xC5, 0x9F,
+    0xFD, 0xF4, 0xB6, 0xE9, 0x21, 0x8D, 0x03, 0x39, 0xDD, 0x7A, 0x68, 0x23, 0x6B, 0x84, 0xB3, 0x9A,
+    0x13, 0xD8, 0xCC, 0xAA, 0x61, 0x1E, 0x5A, 0x46, 0xB8, 0xF2, 0xB4, 0xBA, 0x1D, 0x8D, 0x80, 0x93,
+    0x44, 0x2D, 0xAD, 0x46, 0xE6, 0xD2, 0xEB, 0xD4, 0xED, 0x54, 0x08, 0xA2, 0x4C, 0x00, 0x46, 0x22,
+    0x24, 0x28, 0x64, 0xC1, 0x24, 0x28, 0xDE, 0x48, 0x14, 0x0B, 0xD8, 0x1F, 0xAE, 0xA8, 0x2F, 0x2A,
+    0x4A, 0xDD, 0x10, 0x87, 0x56, 0x3B, 0x31, 0x7C, 0x28, 0x73, 0x97, 0x47, 0x35, 0x81, 0x0B, 0x6E,
+    0xD2, 0xA9, 0xAE, 0xA2, 0x0B, 0x50, 0xF7, 0x76, 0x51, 0x36, 0x08, 0x9B, 0xEA, 0x1E, 0x7C, 0x6B,
+    0xD6, 0x46, 0xB5, 0x47, 0xB2, 0x16, 0x75, 0x9D, 0xBA, 0x11, 0x3E, 0x43, 0x74, 0x9B, 0x2D, 0xC7,
+    0x2E, 0x2B, 0x98, 0xAD, 0xA5, 0x5A, 0xC1, 0x4B, 0xC4, 0x26, 0x05, 0xE1, 0x15, 0xE9, 0xBC, 0xFD,
+    0xC9, 0xAF, 0xDF, 0x3A, 0x33, 0x9C, 0x72, 0xE6, 0x3E, 0xCE, 0x07, 0xD7, 0xD5, 0x03, 0xD8, 0x87,
+    0x40, 0x64, 0xCC, 0x17, 0xA9, 0x26, 0x2B, 0xB1, 0x92, 0xBE, 0x13, 0x2B, 0x89, 0x72, 0xDA, 0xBA,
+    0xC0, 0xA9, 0x37, 0x09, 0xF7, 0xED, 0x50, 0x07, 0xB6, 0x58, 0x2C, 0xB8, 0x15, 0xDF, 0x1B, 0xE9,
+    0xED, 0x4C, 0x13, 0xE9, 0xB0, 0x2B, 0xD5, 0x84, 0x0F, 0x4A, 0x44, 0xE3, 0x02, 0x03, 0x26, 0xE1,
+    0x26, 0x9A, 0xBE, 0x5D, 0xB1, 0xF3, 0x93, 0x75, 0xC0, 0x7F, 0xE2, 0xAB, 0x09, 0x2B, 0xB1, 0xE9,
+    0xF1, 0xC9, 0xCE, 0x19, 0x50, 0x7D, 0xE5, 0xBF, 0xA1, 0x59, 0xC9, 0xD8, 0xF3, 0x1D, 0x5C, 0x7C,
+    0x06, 0xFF, 0xDF, 0x1D, 0xC4, 0x62, 0xFF, 0x7D, 0x0E, 0x16, 0x77, 0x68, 0xE9, 0x13, 0xBF, 0xB8,
+    0xB9, 0x39, 0x87, 0xAF, 0xF4, 0xE1, 0xD2, 0x86, 0x3E, 0x1F, 0x3C, 0xDE, 0xBA, 0x07, 0x65, 0x33,
+    0x00, 0xDE, 0x91, 0x17, 0xDF, 0xAD, 0x43, 0xF7, 0x96, 0xC6, 0x40, 0x4D, 0xC8, 0x64, 0x04, 0x6F,
+    0xE8, 0x63, 0x96, 0x39, 0xDA, 0x2D, 0xF6, 0x26, 0x9A, 0xBB, 0xFF, 0x4D, 0x2E, 0xD9, 0xF7, 0xF3,
+    0x5B, 0xE0, 0x5A, 0x37, 0x42, 0xB2, 0x33, 0xB8, 0x71, 0x05, 0x3A, 0xDF, 0xA2, 0x9D, 0xED, 0xB9,
+    0x47, 0x6A, 0x78, 0x58, 0xCD, 0xF0, 0x36, 0xA7, 0x78, 0x61, 0x58, 0x4A, 0x89, 0x5E, 0x02, 0xB7,
+    0xDC, 0xF7, 0x13, 0xD5, 0x77, 0x63, 0x1D, 0x58, 0x93, 0x49, 0xB8, 0xD7, 0x69, 0x7A, 0x64, 0xB4,
+    0x0B, 0xF5, 0x82, 0x6F, 0x0B, 0xA1, 0x8C, 0xF8, 0x91, 0x53, 0x6C, 0xC2, 0x8D, 0x9A, 0x87, 0xAE,
+    0x22, 0x75, 0x60, 0xA3, 0x58, 0x1E, 0x71, 0x23, 0xFE, 0x23, 0x5F, 0x4D, 0xD8, 0x1F, 0xA7, 0x3A,
+    0xE0, 0xA5, 0x58, 0xB0, 0x12, 0x7C, 0x9B, 0x8B, 0xB3, 0x67, 0x36, 0x39, 0x5B, 0x61, 0x9F, 0x5B,
+    0x40, 0x32, 0xB4, 0x74, 0xBB, 0xF0, 0xCB, 0xDC, 0xE9, 0x96, 0x71, 0x21, 0x39, 0x03, 0x62, 0xA3,
+    0xF9, 0x22, 0xD5, 0x54, 0xCC, 0x4E, 0x42, 0xB3, 0x31, 0xE7, 0x91, 0x63, 0x16, 0xFF, 0x17, 0x11,
+    0x54, 0x9D, 0xC1, 0x77, 0x74, 0x90, 0x1F, 0x00, 0x2B, 0x9A, 0x94, 0x95, 0xDE, 0xCE, 0xC0, 0x10,
+    0xF4, 0x9A, 0x91, 0x53, 0x75, 0x05, 0x7C, 0x4B, 0x56, 0xEE, 0xDC, 0xA6, 0x8E, 0x3E, 0x0E, 0xF8,
+    0x96, 0xD5, 0x41, 0x1D, 0xF0, 0x9F, 0x08, 0x54, 0x11, 0x27, 0x01, 0x7D, 0x2A, 0x58, 0x0F, 0x9D,
+    0x37, 0x3F, 0x5F, 0x33, 0xD4, 0xFD, 0x23, 0x35, 0xAD, 0xC8, 0x9A, 0xC6, 0xDA, 0xF4, 0xE0, 0x61,
+    0x78, 0x0B, 0x4D, 0xAB, 0x2F, 0x69, 0x5A, 0x99, 0x2E, 0x6A, 0x9A, 0x99, 0xCF, 0x83, 0x63, 0x76,
+    0x28, 0x15, 0xAD, 0xBA, 0xA9, 0xC5, 0xAC, 0x13, 0x95, 0x33, 0x0F, 0xD8, 0x9D, 0x8A, 0xEF, 0x42,
+    0xF9, 0xCF, 0x7C, 0x91, 0x6A, 0xF2, 0xC2, 0xB0, 0xA8, 0xD5, 0xB9, 0xE5, 0xBE, 0x9F, 0x74, 0x96,
+    0xD6, 0x64, 0x12, 0x5B, 0x2C, 0x12, 0x32, 0xDA, 0xC5, 0x48, 0x6F, 0xE7, 0x42, 0x28, 0xA3, 0x5D,
+    0xA9, 0xA2, 0x4D, 0xB8, 0xA9, 0x9C, 0x71, 0x63, 0x15, 0xA9, 0x83, 0x9B, 0x94, 0x32, 0xD1, 0xF7,
+    0x75, 0xD0, 0xA2, 0x75, 0xA7, 0x9D, 0x49, 0xBE, 0x65, 0xDD, 0x5D, 0xF9, 0x62, 0xD9, 0xCD, 0x4A,
+    0x19, 0xE1, 0x79, 0x17, 0x30, 0xEB, 0xD0, 0x53, 0xC8, 0x06, 0x46, 0xF3, 0x07, 0xFD, 0xB9, 0xBE,
+    0xC3, 0x4E, 0x04, 0xB4, 0x0E, 0xC0, 0x43, 0x2A, 0x01, 0x6F, 0x6F, 0xA6, 0x0E, 0xD1, 0xEE, 0x90,
+    0xE9, 0x2D, 0x9B, 0x0C, 0x1F, 0xBF, 0x9F, 0x51, 0x30, 0x83, 0x08, 0xD5, 0x62, 0x57, 0xBA, 0xDE,
+    0x26, 0xBB, 0xE0, 0xA2, 0x0F, 0x34, 0x61, 0x85, 0xA1, 0x8A, 0x14, 0xC9, 0xF7, 0x54, 0x71, 0x05,
+    0xFF, 0x67, 0x33, 0xAC, 0x75, 0xA0, 0x8C, 0x1D, 0xF8, 0x4F, 0xAF, 0x14, 0xC9, 0x2E, 0xD4, 0x93,
+    0x8B, 0x46, 0x68, 0xEE, 0x0F, 0xF1, 0xC1, 0x0E, 0xF0, 0x9E, 0xAB, 0xC0, 0x35, 0x4A, 0xA0, 0x8C,
+    0x4A, 0x69, 0xFA, 0xDA, 0xCA, 0xA1, 0x3D, 0xA3, 0xD4, 0xF5, 0x73, 0xA5, 0xFD, 0x95, 0xE1, 0x47,
+    0x01, 0xBE, 0xC4, 0xBF, 0xC0, 0x2C, 0x3C, 0x89, 0xD9, 0x0A, 0xA5, 0xAE, 0x83, 0x4E, 0x7A, 0xA8,
+    0xEE, 0x3F, 0x38, 0x0D, 0x37, 0xEE, 0xE5, 0x69, 0x68, 0x44, 0x02, 0x43, 0xEF, 0x47, 0xB3, 0xE1,
+    0xA2, 0x5D, 0x70, 0xD1, 0x45, 0xAA, 0xE8, 0x46, 0xAA, 0xD8, 0x04, 0xAA, 0xE8, 0x7B, 0xED, 0x82,
+    0x77, 0x53, 0xD7, 0xE2, 0xC6, 0x0E, 0xEA, 0xD0, 0x81, 0xEF, 0xBB, 0x96, 0x41, 0x33, 0x5D, 0x3E,
+    0x94, 0x49, 0xA7, 0xC2, 0x29, 0xDC, 0x62, 0x39, 0xB7, 0x0F, 0x5F, 0xE7, 0x37, 0x75, 0x2D, 0xDF,
+    0x01, 0xDC, 0xAC, 0x8F, 0x18, 0xEB, 0x04, 0x85, 0x84, 0x21, 0x42, 0xB5, 0x5A, 0x69, 0xA1, 0x9E,
+    0xAA, 0x19, 0xF8, 0x0D, 0xAA, 0x87, 0x28, 0xCE, 0x27, 0x5F, 0xE0, 0x30, 0x2F, 0x0C, 0xDA, 0x0C,
+    0x28, 0x6D, 0xBD, 0x42, 0xAD, 0xA4, 0x17, 0x99, 0xBD, 0x45, 0x9B, 0xEC, 0xF3, 0xD4, 0x94, 0x0B,
+    0xD0, 0x8C, 0x3A, 0x37, 0x63, 0x3D, 0x01, 0xF5, 0xA4, 0x93, 0x33, 0xF9, 0x00, 0xD4, 0xA3, 0xCE,
+    0xCE, 0xA8, 0xF3, 0x12, 0xF6, 0xB7, 0x16, 0xE8, 0x7A, 0x9D, 0x1F, 0x5D, 0xBC, 0x9A, 0x6B, 0x2B,
+    0x56, 0x7C, 0x80, 0x72, 0x41, 0x67, 0x48, 0x99, 0x67, 0xC2, 0x3E, 0x45, 0x56, 0xFE, 0x76, 0x48,
+    0xEC, 0x73, 0x44, 0x9D, 0x1B, 0x0E, 0x1F, 0xDB, 0x01, 0x44, 0x8F, 0x00, 0x8B, 0x1D, 0x61, 0xB0,
+    0x09, 0xBA, 0x67, 0x57, 0xF0, 0x5F, 0xDD, 0xC0, 0x87, 0x2D, 0xFB, 0x19, 0xAE, 0x7F, 0x0A, 0x68,
+    0x2F, 0x22, 0xC3, 0xCC, 0x70, 0x3B, 0x4F, 0x56, 0x25, 0x12, 0x75, 0xD1, 0x94, 0x0B, 0x3E, 0xD8,
+    0x05, 0x17, 0x95, 0xBE, 0x64, 0x85, 0x81, 0x01, 0x9A, 0xE0, 0x7B, 0x9D, 0x3D, 0xBB, 0x94, 0x33,
+    0xAC, 0x26, 0x41, 0xA7, 0x49, 0xF2, 0x7A, 0xA4, 0x09, 0x76, 0xA1, 0x9E, 0xB4, 0x59, 0xA2, 0xB9,
+    0x3F, 0x44, 0xAC, 0xC8, 0x94, 0x17, 0xCF, 0xA5, 0xD6, 0x7E, 0x13, 0xCE, 0xE2, 0x51, 0xED, 0x58,
+    0xA9, 0xE5, 0xAC, 0x1F, 0x57, 0x31, 0x42, 0x47, 0x0F, 0x4C, 0xD5, 0x95, 0x93, 0xBF, 0x64, 0x07,
+    0x04, 0x29, 0xF8, 0xE6, 0x9D, 0x37, 0x42, 0x3D, 0x83, 0x8B, 0x08, 0xD8, 0x25, 0x97, 0x30, 0x4A,
+    0x65, 0xAA, 0xD5, 0x08, 0x4C, 0xE3, 0x2A, 0x65, 0x9F, 0x69, 0x46, 0xCC, 0x4A, 0x33, 0x41, 0x47,
+    0x37, 0x41, 0xF3, 0x9A, 0x4C, 0xA8, 0x5E, 0x65, 0xF8, 0x9C, 0x59, 0xDD, 0x04, 0x0C, 0xDA, 0x97,
+    0x10, 0xB4, 0x92, 0x53, 0x29, 0xAB, 0x82, 0x80, 0x49, 0x34, 0x13, 0x0C, 0xD8, 0x4D, 0xBB, 0x22,
+    0x26, 0x6E, 0xDC, 0xA7, 0xDC, 0xB4, 0x7C, 0x34, 0x0F, 0x92, 0x72, 0x6F, 0xD9, 0x99, 0xA7, 0x58,
+    0x66, 0xEF, 0xD5, 0xA6, 0xDC, 0x0D, 0xB7, 0xE6, 0x28, 0x75, 0x85, 0xCB, 0x69, 0x7B, 0xF3, 0x45,
+    0x3E, 0xE5, 0x24, 0xC8, 0x73, 0x12, 0x65, 0x32, 0x69, 0x98, 0xB9, 0xE5, 0x9F, 0xA6, 0xB9, 0x05,
+    0xEE, 0xDB, 0x39, 0xBE, 0x93, 0x5E, 0xF5, 0x71, 0x47, 0x86, 0xD8, 0xE5, 0x7C, 0x35, 0xEA, 0x72,
+    0x2D, 0x4F, 0x95, 0xE4, 0x8F, 0x4F, 0xAE, 0xEF, 0x28, 0xC7, 0x8C, 0x28, 0xFC, 0xF3, 0x64, 0x34,
+    0xA3, 0xEC, 0xE2, 0x5E, 0xE2, 0x50, 0xD7, 0xA7, 0x8C, 0xD4, 0x81, 0x22, 0xE5, 0x22, 0xAC, 0x4D,
+    0xE0, 0xFB, 0x62, 0x85, 0x7A, 0x2C, 0x36, 0x28, 0x63, 0xB9, 0x41, 0xB1, 0x0D, 0x5B, 0xB6, 0xC7,
+    0xBA, 0xB9, 0x42, 0x3D, 0x6E, 0x9A, 0x44, 0x0E, 0xA8, 0x0D, 0x85, 0x4D, 0x87, 0xD4, 0xBA, 0x08,
+    0x75, 0x28, 0x36, 0xA8, 0x22, 0x7E, 0xC2, 0x26, 0xEC, 0xC6, 0x91, 0xDC, 0xA6, 0x9B, 0x6A, 0x11,
+    0x4A, 0xF9, 0x43, 0x91, 0x90, 0x11, 0x6F, 0x67, 0xFE, 0x54, 0xEE, 0x60, 0x92, 0x73, 0x15, 0x85,
+    0x5C, 0x2C, 0x98, 0xCF, 0x02, 0x83, 0x1C, 0x3E, 0xDC, 0xCB, 0xBE, 0x5F, 0xD9, 0x7B, 0xB1, 0x9B,
+    0x95, 0x28, 0x13, 0x5D, 0xB3, 0x52, 0x7E, 0xF7, 0xC7, 0x2D, 0x77, 0x17, 0x15, 0x1F, 0x32, 0xAA,
+    0xE7, 0x68, 0x04, 0x95, 0xDF, 0xA1, 0xE0, 0x5D, 0xC6, 0x2C, 0x40, 0x37, 0x65, 0xA1, 0xD5, 0x87,
+    0x3A, 0x77, 0x7B, 0xB9, 0x18, 0x23, 0x9C, 0x41, 0xF3, 0xA9, 0xA6, 0x2C, 0x7E, 0x0F, 0xBB, 0x71,
+    0x79, 0x04, 0x7A, 0x72, 0xCE, 0xC9, 0x2E, 0x45, 0x02, 0xBA, 0x0F, 0x27, 0xC0, 0xBD, 0xA1, 0x39,
+    0xFA, 0x74, 0xE8, 0xA6, 0x3D, 0xC4, 0x3F, 0x6F, 0x5B, 0x25, 0x2F, 0x28, 0x7A, 0x16, 0x56, 0x5C,
+    0xF0, 0x2D, 0xA7, 0x6E, 0xC4, 0xFE, 0x68, 0xC9, 0x0B, 0x59, 0xC2, 0x59, 0x95, 0xEF, 0x9C, 0x87,
+    0xFE, 0xF3, 0x9E, 0x25, 0xFE, 0xED, 0x1E, 0x95, 0xD5, 0x29, 0xA7, 0x41, 0xCA, 0xFD, 0xAE, 0x97,
+    0xDB, 0x95, 0xDF, 0xFB, 0xC5, 0xDC, 0xE2, 0xE3, 0x44, 0x12, 0x7E, 0x2C, 0x93, 0x06, 0x83, 0x2B,
+    0x66, 0x31, 0x09, 0x33, 0x17, 0x09, 0x33, 0x15, 0x2B, 0x79, 0x40, 0x68, 0xFB, 0xF3, 0xB2, 0x83,
+    0x0A, 0x35, 0x62, 0x1B, 0x12, 0xE0, 0x84, 0x4C, 0x4E, 0x43, 0x17, 0xDE, 0x03, 0xCD, 0xF8, 0x14,
+    0xD4, 0xE3, 0xAD, 0xFC, 0xA3, 0x09, 0x03, 0xF8, 0x7E, 0xE8, 0x11, 0x86, 0xFB, 0x1F, 0x5F, 0x15,
+    0x96, 0xAE, 0x4E, 0xC3, 0x39, 0x67, 0xE1, 0x2D, 0xCD, 0xC5, 0xDD, 0x07, 0xCD, 0x05, 0xDC, 0xB8,
+    0x4D, 0x21, 0x5A, 0xCC, 0xB0, 0x73, 0x39, 0x9A, 0x85, 0xF7, 0x73, 0x9A, 0xE3, 0x8C, 0x32, 0xED,
+    0xD2, 0xDC, 0x72, 0xB2, 0xAB, 0xDC, 0x50, 0xE3, 0x51, 0xCE, 0xA6, 0x65, 0x35, 0x33, 0x9E, 0xA1,
+    0xAD, 0xFB, 0x66, 0x7B, 0x29, 0x58, 0x45, 0x2A, 0xB4, 0x17, 0x2D, 0xF5, 0xAD, 0x1D, 0xA7, 0x5F,
+    0xCA, 0x04, 0xF5, 0x6B, 0x33, 0x74, 0xCF, 0x26, 0xCC, 0xAA, 0x6C, 0xD9, 0x4F, 0xFE, 0xD2, 0x8A,
+    0xF2, 0xBA, 0x4A, 0xD0, 0x4A, 0x4F, 0x21, 0x11, 0x93, 0x36, 0xA5, 0xD4, 0x49, 0x45, 0x24, 0xF1,
+    0x24, 0xEF, 0x3E, 0x8F, 0x3A, 0x35, 0xA7, 0x2D, 0xCA, 0x7D, 0xB4, 0xE1, 0xC6, 0xBA, 0x2D, 0x27,
+    0xFA, 0x62, 0xC9, 0xCA, 0x56, 0xC7, 0x6C, 0x79, 0xFD, 0x92, 0xC7, 0x54, 0xEF, 0xDA, 0x59, 0x8F,
+    0x57, 0xB0, 0x73, 0x39, 0x92, 0x8A, 0x95, 0x5B, 0x0C, 0x6F, 0x0E, 0x5A, 0xB7, 0x1E, 0xD6, 0xDD,
+    0x90, 0xFD, 0xB2, 0xA9, 0x97, 0x12, 0x7B, 0x25, 0xE0, 0xE8, 0x40, 0x2C, 0x6A, 0xE7, 0x7D, 0x49,
+    0x0D, 0x3D, 0xF0, 0x95, 0x5D, 0xB1, 0x1A, 0x19, 0xAD, 0x48, 0xEF, 0xDB, 0x9B, 0x66, 0xE1, 0xFD,
+    0x55, 0xEE, 0xC0, 0xE9, 0x82, 0x0E, 0x52, 0x26, 0xD5, 0xA9, 0x6E, 0xD2, 0xCF, 0xBA, 0x0F, 0xB5,
+    0xAC, 0x75, 0x6B, 0xE3, 0xD0, 0xD6, 0xCF, 0xCA, 0x0F, 0x92, 0x15, 0x09, 0x85, 0xCC, 0x07, 0x75,
+    0x72, 0x51, 0xAF, 0xAF, 0x03, 0x5C, 0x3B, 0x90, 0x4D, 0x57, 0xF3, 0xDE, 0xC0, 0x72, 0x9D, 0x2B,
+    0x70, 0x87, 0x7A, 0xA4, 0x09, 0xF5, 0x98, 0x7B, 0x8B, 0xBB, 0x97, 0xC6, 0x9D, 0xED, 0x57, 0xC2,
+    0x83, 0x8D, 0xC5, 0xE6, 0xE4, 0x36, 0x54, 0x22, 0xA3, 0x8A, 0xD7, 0xCD, 0xCA, 0x52, 0x51, 0x07,
+    0x3B, 0x53, 0x4E, 0x26, 0x61, 0x66, 0x06, 0xF8, 0x94, 0x26, 0xCF, 0x15, 0x88, 0xAA, 0xDE, 0xD3,
+    0x76, 0x80, 0xEC, 0x6B, 0xDB, 0xEC, 0x90, 0x0E, 0x5C, 0x2B, 0x4D, 0xD2, 0xC9, 0x78, 0x0F, 0x34,
+    0xA3, 0x6B, 0x29, 0xE7, 0x72, 0xC2, 0xAC, 0x66, 0xC9, 0x5E, 0x90, 0xEF, 0x9B, 0x09, 0x1F, 0x2A,
+    0xF9, 0xDC, 0x30, 0x32, 0x88, 0x84, 0x2C, 0x64, 0xED, 0x62, 0xBB, 0x6C, 0x0E, 0xA7, 0x7F, 0xC8,
+    0x1C, 0x72, 0x74, 0x5F, 0x41, 0xED, 0x56, 0xA4, 0x67, 0x35, 0x33, 0x75, 0x5F, 0xE8, 0xEE, 0xD6,
+    0x84, 0xAC, 0x15, 0x6E, 0x45, 0xD5, 0x4F, 0x53, 0xD6, 0xD2, 0xE7, 0x87, 0xA9, 0x47, 0xD3, 0xB2,
+    0x72, 0x13, 0x17, 0xAA, 0xD9, 0x2C, 0x0C, 0x6F, 0x0E, 0x58, 0x91, 0x40, 0x25, 0xA3, 0xC6, 0x2B,
+    0x8F, 0x1D, 0x1F, 0x1F, 0x1F, 0x5F, 0x17, 0x11, 0x91, 0x97, 0x45, 0x44, 0xA4, 0xFE, 0xC1, 0x4B,
+    0x6F, 0x9E, 0xA4, 0xBB, 0xF8, 0xDE, 0xFE, 0x4D, 0x64, 0xC3, 0x7D, 0x34, 0x94, 0x33, 0xCF, 0x7C,
+    0x90, 0x26, 0x98, 0x78, 0x95, 0x01, 0xF3, 0xF7, 0xD5, 0x17, 0x0E, 0xC5, 0xFB, 0xF5, 0x2C, 0x7D,
+    0xF1, 0x40, 0xB3, 0x7B, 0x7D, 0xA9, 0xBB, 0x53, 0xFF, 0xD0, 0x0C, 0xF7, 0x80, 0x41, 0x12, 0xD8,
+    0x5C, 0x73, 0x39, 0xB7, 0xAF, 0x6A, 0x15, 0x6B, 0x06, 0xF8, 0xC4, 0xE5, 0x6A, 0x4F, 0x1D, 0x0E,
+    0x93, 0xF7, 0xBE, 0xF6, 0xD0, 0x01, 0x5C, 0x05, 0xF0, 0xBA, 0x7F, 0xBA, 0x11, 0xBA, 0xCF, 0x5D,
+    0x1F, 0x44, 0xBE, 0x2E, 0xB2, 0xE2, 0x7B, 0x32, 0x26, 0x9C, 0x3A, 0x28, 0xB1, 0x70, 0xBE, 0xC8,
+    0xEB, 0x2D, 0xAB, 0x49, 0xEF, 0xBF, 0xF2, 0x6F, 0xCA, 0x58, 0x8E, 0xF5, 0x38, 0xD0, 0xC9, 0x8C,
+    0x08, 0x46, 0xC6, 0x83, 0x07, 0x32, 0xB4, 0xBA, 0xCB, 0xE5, 0x5B, 0x35, 0x0A, 0x73, 0xE9, 0x7A,
+    0x8A, 0x7B, 0x67, 0x0A, 0xAB, 0xED, 0xF0, 0x4D, 0xA8, 0x47, 0xF0, 0xCF, 0x26, 0x60, 0xB8, 0x11,
+    0x0E, 0x5B, 0xBC, 0xE2, 0xDE, 0xD2, 0x65, 0xB0, 0x51, 0x66, 0xAE, 0x97, 0xE4, 0x45, 0x44, 0x7E,
+    0xB8, 0x9D, 0xC8, 0xC9, 0x4B, 0x5F, 0x1F, 0xED, 0xC2, 0xB5, 0x06, 0x37, 0x31, 0x27, 0xBA, 0xB6,
+    0xFC, 0xDA, 0x58, 0x24, 0x6A, 0x43, 0x15, 0xB9, 0x7A, 0x51, 0xEA, 0x6F, 0x41, 0x31, 0xF0, 0x50,
+    0xA9, 0x5F, 0xA0, 0x75, 0xB8, 0x3C, 0x5D, 0x8F, 0x6F, 0x6D, 0x6E, 0x10, 0xC5, 0x67, 0xB8, 0x0D,
+    0xA0, 0x07, 0x64, 0xDC, 0xD5, 0x81, 0x9B, 0x04, 0xC5, 0x8C, 0x79, 0x6E, 0xA2, 0x7A, 0x39, 0xE0,
+    0x5E, 0xEE, 0xC9, 0x79, 0x18, 0xBA, 0xCF, 0x5D, 0x6F, 0x44, 0xE2, 0x20, 0x32, 0x92, 0x73, 0x2E,
+    0x87, 0xBF, 0x58, 0x32, 0x64, 0x58, 0xB1, 0x29, 0xCA, 0xC1, 0xBC, 0x97, 0x78, 0x46, 0x4B, 0x1D,
+    0xEA, 0xB6, 0x1E, 0x07, 0x6A, 0x59, 0x71, 0x12, 0x29, 0xA5, 0x85, 0xEB, 0x3F, 0x2B, 0x6D, 0xFD,
+    0xD8, 0xFA, 0x74, 0x8E, 0x66, 0x76, 0x3E, 0xD8, 0x9F, 0x8D, 0xB6, 0xFE, 0x63, 0x94, 0x6E, 0xC0,
+    0x88, 0xC8, 0x1F, 0x8A, 0x24, 0xBA, 0x7F, 0x84, 0xD2, 0xFD, 0x2F, 0xA6, 0x05, 0xAC, 0xD8, 0x11,
+    0x70, 0xF2, 0xF5, 0x11, 0xA8, 0x5F, 0x97, 0x00, 0xD4, 0xA5, 0xB4, 0xC0, 0x3B, 0xF7, 0x04, 0xF9,
+    0x43, 0x3A, 0x3A, 0x9F, 0xE6, 0xCA, 0xF1, 0xD3, 0x0A, 0x21, 0x4F, 0x5E, 0x66, 0x6A, 0x99, 0xCD,
+    0x06, 0x6C, 0xBB, 0x13, 0x51, 0x24, 0x32, 0x6D, 0x25, 0x68, 0x5F, 0xB8, 0x59, 0xB0, 0x4A, 0x3D,
+    0x5E, 0xCE, 0x64, 0x88, 0x5D, 0xEE, 0x9A, 0xC6, 0x46, 0x05, 0xB1, 0x4D, 0xDA, 0xEE, 0x3E, 0xEE,
+    0xC8, 0xB2, 0x46, 0xBB, 0xDE, 0x7D, 0x7E, 0xEB, 0xA1, 0xEE, 0x15, 0x3F, 0xD6, 0xEE, 0x75, 0xBF,
+    0x4E, 0xD3, 0x83, 0x99, 0x47, 0xC7, 0x8F, 0x94, 0x0B, 0x34, 0x33, 0x8D, 0xF6, 0xE1, 0x89, 0x76,
+    0x2B, 0x29, 0x89, 0x41, 0xA6, 0x77, 0x3C, 0x9F, 0xAA, 0x2A, 0x56, 0x1B, 0x60, 0x88, 0xCF, 0x40,
+    0x2D, 0xAF, 0x07, 0x8A, 0x38, 0xCC, 0xF0, 0xBE, 0x4B, 0x29, 0xF8, 0xF3, 0xFB, 0x00, 0x3C, 0x56,
+    0xC8, 0x8C, 0x8B, 0x5E, 0x5A, 0x85, 0x13, 0xD7, 0x23, 0x5D, 0x8E, 0x63, 0x9A, 0x5E, 0x3F, 0x72,
+    0xF9, 0xCC, 0x9A, 0x32, 0xD2, 0x04, 0x4E, 0x0F, 0x1F, 0x69, 0x7E, 0xD4, 0x07, 0x4E, 0x95, 0x23,
+    0xAD, 0x78, 0xBD, 0x6F, 0x57, 0xEE, 0x2E, 0x1F, 0x70, 0x53, 0x53, 0x7F, 0x26, 0x88, 0xBC, 0x2A,
+    0x73, 0x25, 0xB3, 0x5B, 0x73, 0x9B, 0xF8, 0xA3, 0x18, 0x80, 0x77, 0x9D, 0x9C, 0x68, 0x33, 0xA3,
+    0x6E, 0x4D, 0xFA, 0x66, 0xDE, 0x92, 0xE9, 0xEB, 0x57, 0x63, 0x7E, 0x44, 0x16, 0x50, 0x76, 0x65,
+    0x91, 0xE5, 0xAD, 0x1A, 0x77, 0x9E, 0xC7, 0x5C, 0x6F, 0xA4, 0x45, 0xAC, 0xCC, 0xB8, 0x09, 0xDF,
+    0x9A, 0x35, 0x8B, 0x7D, 0xA0, 0x58, 0xF4, 0x23, 0x56, 0x6C, 0x54, 0xB6, 0x39, 0x65, 0x56, 0xD8,
+    0x3F, 0x6A, 0x82, 0x52, 0xDD, 0x56, 0x13, 0x12, 0x58, 0x79, 0x62, 0x79, 0xC4, 0x8D, 0xD5, 0xB7,
+    0x9F, 0x0D, 0x5B, 0xF1, 0xC3, 0x25, 0x39, 0x59, 0x6B, 0x69, 0x07, 0x69, 0x65, 0x54, 0x22, 0x29,
+    0xA3, 0x84, 0x5F, 0x85, 0xBE, 0xB9, 0xC0, 0x04, 0xB8, 0xA9, 0x0C, 0x80, 0xDB, 0x14, 0x25, 0xA1,
+    0xCF, 0x92, 0x9B, 0xF4, 0x1E, 0xA2, 0x42, 0xBF, 0x42, 0x8B, 0xA7, 0x6C, 0xB9, 0x0D, 0x89, 0x0F,
+    0x82, 0x9B, 0xEA, 0x90, 0x93, 0x75, 0x56, 0x12, 0x0F, 0xCF, 0xD6, 0xFD, 0x62, 0x16, 0xCF, 0x9E,
+    0x4D, 0x6D, 0x72, 0x94, 0xBF, 0x6A, 0x4E, 0x5E, 0xAB, 0xB0, 0x53, 0x0D, 0x60, 0x47, 0x7D, 0x9B,
+    0xAE, 0x01, 0x14, 0xF7, 0xD7, 0xF3, 0x45, 0xED, 0xF7, 0xF6, 0xBF, 0x6A, 0x73, 0x77, 0xF5, 0x20,
+    0x0E, 0x27, 0x23, 0x14, 0xF3, 0x35, 0xE0, 0x5A, 0x11, 0xC1, 0x8E, 0x0D, 0xF0, 0x94, 0x9D, 0x76,
+    0xE6, 0x42, 0xCD, 0xA8, 0x0D, 0xE3, 0x2F, 0xC1, 0x34, 0xD2, 0xF3, 0x27, 0x40, 0x39, 0x16, 0x11,
+    0x68, 0x62, 0xB5, 0x00, 0x32, 0xF9, 0x19, 0x4A, 0xF9, 0x90, 0x8C, 0x50, 0x2F, 0x95, 0x82, 0xC7,
+    0xEB, 0x09, 0xF8, 0xB7, 0x99, 0xD5, 0xF3, 0x57, 0x6F, 0xED, 0xF5, 0x57, 0x00, 0xCF, 0x92, 0xB3,
+    0x60, 0x46, 0xCA, 0x05, 0x7C, 0x90, 0xDC, 0xA4, 0x67, 0x52, 0x15, 0xA1, 0x61, 0x01, 0x7A, 0xF3,
+    0x8B, 0x36, 0x97, 0x6F, 0x0B, 0x99, 0x6B, 0xD6, 0x2A, 0xA7, 0xAD, 0xD6, 0xF3, 0x32, 0xEF, 0xCE,
+    0xB3, 0xF7, 0xE4, 0x4A, 0x5E, 0x2E, 0xE4, 0xE5, 0x00, 0xAB, 0xDC, 0x9E, 0xE7, 0x80, 0xA9, 0xCE,
+    0x91, 0xED, 0x3F, 0xEB, 0x12, 0x69, 0x79, 0x54, 0x8F, 0x9B, 0x43, 0xFD, 0x75, 0xB5, 0x68, 0x87,
+    0xBE, 0xC1, 0xF2, 0x7E, 0x4B, 0xA6, 0x35, 0x34, 0xDB, 0xA5, 0x44, 0x77, 0x71, 0x88, 0x8E, 0xFC,
+    0xFE, 0x2F, 0x7B, 0x88, 0x98, 0xFC, 0xEB, 0xB9, 0x6D, 0x42, 0xDB, 0xF8, 0x01, 0xBA, 0x3E, 0x73,
+    0x28, 0x14, 0xF3, 0x8E, 0x9D, 0x7D, 0xC0, 0xC8, 0x1F, 0x1F, 0xB7, 0xFA, 0x56, 0x8B, 0x60, 0x27,
+    0x1A, 0x49, 0x9D, 0xCC, 0xD4, 0x81, 0x41, 0xC6, 0x7A, 0x56, 0xCA, 0xCF, 0x88, 0x0F, 0x5A, 0x30,
+    0x55, 0xF2, 0x89, 0x48, 0x91, 0x76, 0xB4, 0xAF, 0x1B, 0xB5, 0x54, 0xDC, 0x6A, 0x25, 0x80, 0x4E,
+    0x8F, 0x59, 0x1A, 0xB0, 0x3F, 0x99, 0xA9, 0x03, 0x26, 0x51, 0xFF, 0xD5, 0x84, 0x32, 0x89, 0xAD,
+    0xBE, 0x2F, 0x23, 0xD4, 0x63, 0x19, 0x4F, 0x33, 0x21, 0x92, 0xFF, 0x70, 0x42, 0x33, 0xD2, 0xA9,
+    0x8C, 0xD5, 0x08, 0x76, 0xAE, 0x46, 0x65, 0x7B, 0x77, 0xA3, 0xA7, 0x2B, 0x66, 0xC0, 0x3F, 0x3B,
+    0x93, 0x5C, 0x00, 0x36, 0x17, 0x6C, 0xBC, 0x09, 0x14, 0xCB, 0x5D, 0xDC, 0x37, 0x23, 0x50, 0x7D,
+    0x37, 0xE2, 0x3F, 0xD1, 0x02, 0xCD, 0x4B, 0x2D, 0x6B, 0xCA, 0xD0, 0xF0, 0x42, 0xC1, 0xED, 0x12,
+    0x32, 0x65, 0x6A, 0xB9, 0xED, 0x05, 0x04, 0xA7, 0x05, 0x14, 0x8D, 0x82, 0xF6, 0x42, 0xFC, 0xF9,
+    0x57, 0x86, 0xD0, 0xEE, 0x70, 0x29, 0x15, 0xAC, 0x12, 0x99, 0x71, 0x2B, 0x37, 0xC2, 0xAA, 0x3E,
+    0x75, 0x3B, 0xAE, 0xB2, 0x06, 0x38, 0xC2, 0x3C, 0x58, 0xDC, 0xBB, 0xCD, 0xBF, 0xA7, 0x98, 0x7D,
+    0xC2, 0x8F, 0x46, 0x6A, 0xE9, 0xCB, 0x05, 0x3F, 0xD6, 0x11, 0xA1, 0x9C, 0x8B, 0x44, 0x13, 0x4C,
+    0xA2, 0x6B, 0xAB, 0x99, 0x0E, 0x37, 0x15, 0x1B, 0x75, 0x28, 0x16, 0xA4, 0xAF, 0x26, 0x06, 0x7C,
+    0xB4, 0x91, 0x3A, 0x34, 0x89, 0x84, 0x8D, 0x6E, 0xE0, 0x2E, 0xA4, 0xF2, 0xEB, 0xA3, 0x07, 0xFF,
+    0x91, 0x1F, 0xCD, 0x4D, 0x4B, 0xF5, 0x6A, 0xBC, 0xE5, 0x7A, 0x8A, 0x79, 0xA9, 0xFF, 0x53, 0x80,
+    0x9B, 0xC9, 0x7E, 0x7F, 0x84, 0x3A, 0x21, 0x23, 0x94, 0x2B, 0x5E, 0x1B, 0xB4, 0xDC, 0x04, 0x3C,
+    0x95, 0x15, 0xED, 0x1F, 0x6C, 0x24, 0xF8, 0x89, 0x02, 0xC8, 0x95, 0x9F, 0xE3, 0xA1, 0x8D, 0x04,
+    0x6F, 0x23, 0x3A, 0xFF, 0x3D, 0xE5, 0x96, 0xD9, 0x0B, 0x75, 0xBE, 0x36, 0x80, 0xB5, 0x03, 0x8A,
+    0xD9, 0xB7, 0x50, 0x4D, 0xAE, 0x87, 0xA6, 0xAF, 0x7A, 0x78, 0xE7, 0xE5, 0x59, 0x7C, 0x9B, 0x71,
+    0x0D, 0xBF, 0x97, 0xF7, 0x02, 0x75, 0x6C, 0x26, 0x70, 0xC9, 0x2D, 0x60, 0x57, 0xAB, 0x99, 0xE2,
+    0x87, 0xC2, 0x86, 0x1E, 0x3B, 0x7E, 0x9A, 0xE3, 0xE3, 0x1B, 0x22, 0x0C, 0xF2, 0x7D, 0x11, 0x1A,
+    0x99, 0xEA, 0x19, 0xBA, 0x5E, 0x8B, 0x3C, 0x74, 0x2D, 0x4D, 0xC8, 0x7C, 0x59, 0x85, 0x92, 0x5E,
+    0x74, 0xBD, 0x92, 0x35, 0x97, 0x11, 0x4C, 0xB2, 0x11, 0xF0, 0xCF, 0xCD, 0x40, 0xF5, 0xA3, 0x05,
+    0x30, 0x9B, 0x4A, 0x59, 0x39, 0xA0, 0xD7, 0x73, 0x88, 0xFE, 0xEE, 0x3C, 0x03, 0x46, 0x3C, 0x7B,
+    0xC6, 0x0B, 0xBF, 0xCE, 0x1C, 0x38, 0xF7, 0x5B, 0x30, 0x1A, 0x4C, 0x88, 0x5C, 0x8C, 0x6E, 0x3F,
+    0x70, 0xB0, 0xE8, 0xE6, 0x8C, 0x2F, 0x4A, 0x89, 0x19, 0xFC, 0x3D, 0x80, 0xDB, 0x0F, 0xE1, 0x8E,
+    0xA1, 0x12, 0x91, 0x15, 0x2F, 0x22, 0x8B, 0xD9, 0x4E, 0x4E, 0x86, 0x50, 0x4D, 0x14, 0x2B, 0x0D,
+    0x34, 0x13, 0x0B, 0x66, 0xA3, 0x18, 0xA9, 0xCF, 0xA0, 0x80, 0x9A, 0x29, 0x19, 0x5A, 0xC8, 0x4D,
+    0xBE, 0x5D, 0x7F, 0xC8, 0x38, 0xF9, 0x70, 0x18, 0xBB, 0x1F, 0xD9, 0x59, 0x96, 0xEA, 0x29, 0x27,
+    0x6C, 0xDF, 0x87, 0x8B, 0x70, 0x07, 0x01, 0x3B, 0xB9, 0x19, 0x9A, 0x76, 0x68, 0x31, 0xA9, 0x14,
+    0x11, 0x89, 0xB5, 0x88, 0x48, 0xEB, 0x1F, 0xC0, 0x6F, 0x6B, 0xF9, 0xD3, 0xE7, 0xAF, 0x2E, 0xD6,
+    0xFC, 0x95, 0x6E, 0xCC, 0x55, 0xAF, 0xA7, 0x1E, 0xA8, 0x50, 0xB7, 0x45, 0xEB, 0xA5, 0xBF, 0x5B,
+    0x8A, 0x7C, 0x74, 0x3C, 0x1D, 0x64, 0x71, 0xFD, 0xE3, 0x1B, 0x33, 0x4D, 0x38, 0xA2, 0x8A, 0xEC,
+    0x07, 0x3F, 0xAA, 0xC4, 0xCB, 0x79, 0x47, 0x23, 0xB7, 0x7A, 0xCF, 0x5C, 0x8D, 0x23, 0xFA, 0xED,
+    0x7A, 0xF3, 0x87, 0x22, 0x32, 0xAF, 0x9D, 0x48, 0x15, 0x6E, 0x48, 0xD8, 0x73, 0xC3, 0x57, 0xCE,
+    0x0C, 0x61, 0x75, 0x8E, 0xC8, 0x51, 0x61, 0x16, 0x2F, 0x3C, 0x5C, 0x9B, 0x8E, 0x8F, 0xDB, 0x42,
+    0x44, 0xA4, 0x75, 0x22, 0xB2, 0xD1, 0x9D, 0x9C, 0xBC, 0x14, 0x8B, 0x05, 0x86, 0x56, 0x8F, 0x9D,
+    0xBA, 0x06, 0x5D, 0xCF, 0x97, 0x1F, 0x14, 0x64, 0x33, 0xB2, 0x77, 0x04, 0x1E, 0x04, 0xB9, 0xCF,
+    0x82, 0x1C, 0xB2, 0xD4, 0x3A, 0x21, 0xBA, 0x9A, 0xBB, 0x40, 0xD9, 0xDB, 0x04, 0x0D, 0x3E, 0xC0,
+    0x62, 0x57, 0xA8, 0xC6, 0x66, 0x84, 0xCE, 0x88, 0x88, 0xA8, 0xBC, 0x47, 0x97, 0xBB, 0xA4, 0xF3,
+    0x36, 0xDA, 0x67, 0xF8, 0x95, 0x9F, 0x32, 0xBE, 0xD0, 0xF7, 0x97, 0xE1, 0x87, 0xC0, 0xD1, 0x0B,
+    0xFC, 0xA6, 0x95, 0xA5, 0x1A, 0x3B, 0x99, 0xD7, 0xEA, 0x35, 0x91, 0x7E, 0x31, 0xC3, 0xE4, 0xDA,
+    0x22, 0xF1, 0x27, 0x5A, 0x00, 0xC8, 0x69, 0x5B, 0x15, 0xF2, 0x2E, 0xD3, 0x83, 0x90, 0xB5, 0xD7,
+    0xCF, 0x59, 0xF9, 0x5E, 0x31, 0x0F, 0x22, 0xF2, 0xD1, 0x6F, 0x89, 0xC4, 0x3B, 0x47, 0x92, 0x72,
+    0x1F, 0xCC, 0xA3, 0x98, 0x16, 0x33, 0xE3, 0x7B, 0xCA, 0xA8, 0x6C, 0x03, 0x5D, 0x0F, 0xF5, 0xF7,
+    0xF5, 0xAC, 0xD9, 0xF6, 0x10, 0x04, 0xF9, 0xF6, 0x6D, 0xA6, 0xCB, 0x05, 0xE6, 0x90, 0xEB, 0xEE,
+    0x39, 0xAD, 0xF6, 0x5C, 0xB7, 0xBC, 0x55, 0xAE, 0xFB, 0xE7, 0x2D, 0xEA, 0xB3, 0xBD, 0x4E, 0x15,
+    0x77, 0xD0, 0xA3, 0xC8, 0xDE, 0xCC, 0x07, 0xCC, 0xC5, 0x33, 0x1C, 0x69, 0x3E, 0x95, 0x6C, 0x3D,
+    0x8F, 0x2D, 0xCD, 0x27, 0x4C, 0x29, 0x51, 0x45, 0x3E, 0x44, 0x21, 0x17, 0x1C, 0xD4, 0xDF, 0xCC,
+    0x20, 0x45, 0xDD, 0x8E, 0xF2, 0x74, 0xE5, 0xED, 0xAA, 0xBC, 0x70, 0xDB, 0xED, 0xFC, 0x2D, 0xF2,
+    0x6D, 0x75, 0x43, 0xCB, 0xEC, 0x54, 0x19, 0xFF, 0xE7, 0xCF, 0x43, 0x5D, 0xF3, 0x49, 0x55, 0xFE,
+    0xFC, 0xC8, 0xCA, 0x07, 0x47, 0xDB, 0x97, 0x11, 0xA8, 0x46, 0xDF, 0x82, 0xF2, 0x84, 0x42, 0x86,
+    0x43, 0x0D, 0x53, 0x2E, 0x3F, 0xD7, 0xF8, 0xDE, 0x8F, 0x75, 0x2C, 0x17, 0xB3, 0x72, 0x8D, 0x77,
+    0x00, 0xBF, 0x45, 0x87, 0xD8, 0x54, 0xCD, 0xF5, 0xE8, 0x75, 0x8F, 0x37, 0x2D, 0x36, 0x61, 0xA5,
+    0xB5, 0x12, 0x8B, 0x65, 0x35, 0xA9, 0xF9, 0x74, 0xB2, 0x3F, 0x4C, 0x3C, 0xF3, 0x6E, 0x3D, 0x43,
+    0xCE, 0xC5, 0x7F, 0xE9, 0x53, 0x33, 0xC8, 0x69, 0xF2, 0xE9, 0x4B, 0xF5, 0x7C, 0xD5, 0xB4, 0x9D,
+    0xAC, 0x83, 0x6C, 0x9D, 0xAC, 0x0A, 0x3D, 0x7F, 0x65, 0xE2, 0x87, 0x5B, 0x31, 0x7B, 0x59, 0x4A,
+    0x59, 0x68, 0x26, 0x8E, 0x3E, 0xBC, 0x76, 0xDF, 0x4A, 0x5D, 0xDB, 0x02, 0xAC, 0x26, 0xF9, 0xC9,
+    0xBF, 0xBC, 0x96, 0xC9, 0xF7, 0x2A, 0xBE, 0xD3, 0x76, 0x58, 0x9B, 0xBF, 0xF8, 0xEE, 0xE4, 0x9F,
+    0x2C, 0x27, 0x12, 0x5D, 0xDB, 0x84, 0x72, 0xE2, 0x49, 0x4C, 0x0B, 0x57, 0xE9, 0x62, 0x2D, 0x2F,
+    0xC7, 0xBB, 0xCF, 0xD8, 0xD7, 0xC2, 0xB5, 0x3B, 0xE5, 0xB7, 0xA6, 0xE4, 0xA5, 0x55, 0x1F, 0xE1,
+    0x51, 0x5A, 0xE6, 0x72, 0x74, 0xD1, 0xF7, 0xC3, 0x73, 0x6B, 0xB9, 0x34, 0x93, 0xFF, 0xEA, 0x56,
+    0x2C, 0x6E, 0x72, 0xFD, 0x53, 0x3C, 0x4A, 0xCB, 0x3B, 0x78, 0x97, 0x6B, 0xDD, 0xCB, 0xD1, 0x8D,
+    0xAB, 0x1B, 0xEB, 0xBF, 0x1A, 0xAD, 0x4C, 0xF8, 0x69, 0x17, 0xE8, 0x23, 0x7C, 0x28, 0x3E, 0xE1,
+    0xC6, 0xE4, 0x9F, 0x9B, 0xBB, 0x6A, 0x4A, 0xEE, 0xAB, 0x73, 0x53, 0x4C, 0x4F, 0x16, 0xFC, 0x09,
+    0xA6, 0xA5, 0xD9, 0xE8, 0x24, 0x76, 0xAF, 0xAD, 0x1E, 0xFF, 0x3F, 0x50, 0x7E, 0x0D, 0x46, 0x80,
+    0x0F, 0x98, 0xC5, 0x46, 0x17, 0xEA, 0xDE, 0xB7, 0xBE, 0xF5, 0xBD, 0x1F, 0x9B, 0x1E, 0x8A, 0xA9,
+    0x4A, 0x36, 0xD9, 0x64, 0x17, 0x3B, 0x97, 0xD1, 0x05, 0xDF, 0xDE, 0x01, 0xAA, 0xE7, 0xB6, 0xE1,
+    0x33, 0x71, 0x75, 0x21, 0x95, 0xA3, 0x27, 0xC2, 0x11, 0xC9, 0x7D, 0x35, 0x35, 0x1F, 0x89, 0x4F,
+    0xD9, 0xF0, 0x29, 0x43, 0xB1, 0x14, 0xC9, 0x26, 0xBB, 0x54, 0xB1, 0x09, 0xD7, 0x78, 0x3F, 0x70,
+    0xF4, 0xDC, 0xDA, 0x7D, 0x2B, 0xF9, 0x16, 0xD3, 0x1A, 0xB3, 0x16, 0xC9, 0x8F, 0xDD, 0xCB, 0xA9,
+    0x4C, 0x4D, 0xA6, 0x09, 0xA1, 0x58, 0xAD, 0x7C, 0x23, 0xDE, 0x99, 0xEB, 0xA7, 0xCA, 0xBF, 0x7A,
+    0xE5, 0x55, 0x99, 0xAA, 0x11, 0xA8, 0x42, 0xD7, 0x6F, 0x76, 0xAE, 0x43, 0xAA, 0xC6, 0x4F, 0x01,
+    0xE5, 0xE2, 0x36, 0x4E, 0xB9, 0x4B, 0x2A, 0x63, 0x13, 0x6E, 0xC2, 0x75, 0x1B, 0x1C, 0xD7, 0x78,
+    0x86, 0x3B, 0x0C, 0x9F, 0xED, 0x52, 0x3D, 0x95, 0xE3, 0xEA, 0x42, 0xAA, 0x9F, 0x9D, 0xFD, 0x47,
+    0x22, 0xB4, 0xD8, 0x05, 0x2B, 0xBD, 0x95, 0xD9, 0x26, 0xB1, 0x8B, 0xFB, 0xFE, 0xCC, 0xFD, 0xE7,
+    0x79, 0xF7, 0xA3, 0x98, 0xAF, 0xF0, 0x6B, 0x2B, 0x37, 0xE5, 0xC5, 0xA5, 0x93, 0xA9, 0x96, 0x56,
+    0x03, 0xDA, 0x6A, 0xFA, 0x97, 0x7E, 0xA9, 0xBB, 0xED, 0x56, 0xF2, 0xEB, 0x5C, 0xCF, 0xEF, 0x3F,
+    0xEA, 0xCF, 0x66, 0xFF, 0xAD, 0xE5, 0x46, 0xD1, 0xC2, 0x4D, 0x70, 0x93, 0xE2, 0x2D, 0x5B, 0xDC,
+    0x88, 0x9D, 0xF7, 0xC2, 0xF5, 0x55, 0xAE, 0xD6, 0x63, 0xF3, 0xF2, 0x5A, 0xA6, 0x2E, 0x0C, 0x2F,
+    0xCF, 0xEA, 0xD1, 0x3D, 0x46, 0x2A, 0xA7, 0xA6, 0x95, 0xFF, 0x49, 0x5E, 0x39, 0x9F, 0x4F, 0xFC,
+    0x37, 0xE7, 0x96, 0x81, 0xAA, 0xB7, 0xFA, 0xE7, 0xDA, 0x08, 0xAC, 0xA6, 0x8B, 0x77, 0x3F, 0xD0,
+    0xD8, 0xF6, 0xCB, 0x4D, 0xDD, 0xF7, 0x96, 0x05, 0x8E, 0xAE, 0xB5, 0x7F, 0x13, 0x4D, 0xA2, 0xFE,
+    0x68, 0x5F, 0x45, 0x9E, 0xF9, 0x20, 0xBE, 0x37, 0xE3, 0x43, 0x9A, 0x9B, 0xC4, 0x3C, 0x0D, 0x76,
+    0x95, 0x8D, 0x7C, 0x52, 0x64, 0xF7, 0xE6, 0x4B, 0x42, 0xB1, 0x52, 0xAD, 0xB8, 0x48, 0xB5, 0xE0,
+    0xFB, 0x4C, 0x67, 0xE3, 0x43, 0x19, 0x41, 0x68, 0x02, 0x36, 0x69, 0x78, 0x67, 0x17, 0xF0, 0xA1,
+    0x1E, 0x61, 0x33, 0x72, 0x9B, 0x72, 0x16, 0x89, 0x34, 0xAF, 0x88, 0x84, 0xFC, 0x4D, 0x67, 0x25,
+    0xA3, 0x22, 0xC1, 0xBF, 0xC4, 0x8F, 0x70, 0xFA, 0xF1, 0x15, 0x0A, 0x91, 0x31, 0xD3, 0x1C, 0x53,
+    0x7C, 0xF1, 0xA2, 0xD4, 0xBF, 0x74, 0x6E, 0x90, 0x33, 0x19, 0x04, 0x9C, 0xB9, 0xD8, 0x9A, 0x7B,
+    0xB0, 0xF3, 0x3F, 0x5D, 0x9C, 0xA7, 0xA7, 0xCF, 0xCD, 0xD3, 0x7A, 0x6E, 0x9E, 0x12, 0x7A, 0x0A,
+    0x04, 0x2B, 0x2C, 0x98, 0x15, 0x34, 0xC4, 0x50, 0x04, 0x6F, 0x7B, 0x71, 0x9E, 0xE2, 0x39, 0xBF,
+    0x39, 0x9E, 0xD9, 0xE6, 0x87, 0xCE, 0x13, 0x17, 0x49, 0xA3, 0xCF, 0x1D, 0xD8, 0x7E, 0x24, 0x0A,
+    0x9D, 0x5D, 0xF7, 0x92, 0xCF, 0x01, 0x14, 0xD8, 0x89, 0xF4, 0x9A, 0xF7, 0x31, 0xF2, 0xBD, 0x8F,
+    0x6F, 0x4A, 0x58, 0x6D, 0x36, 0xA8, 0x46, 0x17, 0xA1, 0x41, 0x80, 0x45, 0xF9, 0xAA, 0x7D, 0x38,
+    0x54, 0xDA, 0x72, 0x7F, 0xDA, 0x0F, 0x86, 0x15, 0x3D, 0xFF, 0xD5, 0x8A, 0x48, 0xBF, 0x97, 0x9A,
+    0xFA, 0x03, 0x2C, 0xDC, 0x1E, 0x58, 0xC0, 0x0D, 0x7E, 0x04, 0xC7, 0x10, 0xE0, 0x14, 0x09, 0x94,
+    0x4B, 0x21, 0xA3, 0x91, 0xD1, 0x8A, 0x28, 0xEF, 0xBC, 0x8C, 0x30, 0xC8, 0x3D, 0xE0, 0xCA, 0x2F,
+    0x1B, 0xB2, 0xE0, 0x17, 0x40, 0x36, 0x61, 0x9E, 0x37, 0xCF, 0xD3, 0x8C, 0x7E, 0x44, 0x3E, 0x24,
+    0x6D, 0x99, 0xCA, 0x44, 0x35, 0x3E, 0x40, 0x3B, 0x7E, 0xE5, 0xF8, 0x58, 0x9B, 0xE8, 0x94, 0xF9,
+    0xA4, 0x19, 0xF3, 0x17, 0xDA, 0x65, 0xDF, 0x83, 0x0F, 0x44, 0x1E, 0xEE, 0x40, 0xE4, 0xB1, 0x1E,
+    0x5A, 0x7C, 0xC3, 0xF9, 0xCB, 0xEB, 0x31, 0x2B, 0x4D, 0x71, 0x46, 0x1A, 0xD2, 0x5F, 0x26, 0x0D,
+    0x39, 0x92, 0xDB, 0xDA, 0x9D, 0x76, 0x60, 0x81, 0x39, 0x3E, 0xBE, 0xBE, 0xB7, 0xE1, 0x2B, 0x64,
+    0xD3, 0x6C, 0xFF, 0x60, 0x31, 0xF2, 0x52, 0x6B, 0xDE, 0x85, 0x22, 0xEE, 0x03, 0xAD, 0x8F, 0xBA,
+    0x12, 0xDE, 0xA2, 0x67, 0xB2, 0x7B, 0xA0, 0x67, 0xF2, 0x81, 0x3B, 0xF5, 0xB9, 0xF1, 0xDE, 0xCE,
+    0x37, 0xC6, 0xBD, 0xEF, 0x5E, 0x49, 0x17, 0x2E, 0xB6, 0xDD, 0x9B, 0xE3, 0x63, 0xCD, 0x21, 0xF9,
+    0xDD, 0xC9, 0x16, 0x11, 0xE5, 0x3C, 0xAB, 0xBF, 0xF7, 0xF1, 0x39, 0xFB, 0x33, 0xFA, 0x44, 0x66,
+    0xC9, 0x2E, 0x50, 0x35, 0xDA, 0xFD, 0x37, 0x39, 0x59, 0x95, 0xB2, 0x2F, 0x55, 0x4E, 0xD9, 0x9B,
+    0x6A, 0x76, 0x7F, 0x2A, 0xE1, 0x3F, 0xAB, 0xBF, 0x31, 0x4A, 0x77, 0xD8, 0x64, 0x0B, 0x4C, 0xC2,
+    0xFF, 0xF5, 0x8D, 0x04, 0xD5, 0xC8, 0x46, 0xB5, 0x64, 0x56, 0x30, 0x17, 0x31, 0x4B, 0xEE, 0x58,
+    0x75, 0x21, 0x9F, 0x5B, 0x7B, 0x2B, 0x9F, 0xB8, 0xA7, 0xE9, 0x48, 0x17, 0x33, 0x19, 0xB4, 0xFF,
+    0x74, 0x91, 0x30, 0x09, 0x9B, 0xEA, 0x6E, 0xA4, 0x8A, 0x74, 0xA3, 0x6C, 0x30, 0xFC, 0xE0, 0xA5,
+    0xD5, 0xCA, 0xA4, 0x30, 0xBB, 0x72, 0xA5, 0x10, 0x91, 0xDB, 0xE7, 0xFA, 0xE4, 0xB4, 0x1D, 0xFF,
+    0xBA, 0x4E, 0x5D, 0x3E, 0x36, 0x65, 0x21, 0xE3, 0x84, 0xDB, 0xB3, 0xDE, 0x43, 0x7D, 0x82, 0x6D,
+    0xF7, 0xEB, 0xD6, 0xFC, 0x0F, 0xB3, 0xEE, 0x94, 0x00, 0xE9, 0x5C, 0x5B, 0xA1, 0xEF, 0xF3, 0x74,
+    0xFB, 0x36, 0x4F, 0x5F, 0xA7, 0xB0, 0x71, 0x91, 0x7C, 0x84, 0x82, 0x28, 0x69, 0x9B, 0x13, 0x11,
+    0xF9, 0x98, 0xC4, 0xDC, 0x16, 0xE8, 0x66, 0xEA, 0x51, 0x1F, 0x82, 0x26, 0xE4, 0xCC, 0x9C, 0xFE,
+    0xA3, 0x48, 0xF8, 0x1E, 0xBB, 0x60, 0x53, 0xA6, 0xD1, 0xB1, 0x4B, 0x06, 0x73, 0x96, 0x33, 0x03,
+    0x54, 0x31, 0xA3, 0x07, 0x5D, 0xA4, 0x0B, 0x47, 0x72, 0x9B, 0xE6, 0xCD, 0x17, 0x85, 0x4E, 0x66,
+    0xC5, 0x83, 0x0E, 0x12, 0x4B, 0xB9, 0x70, 0xFA, 0xB6, 0xEE, 0x54, 0x5E, 0x44, 0x24, 0xEA, 0xCF,
+    0xEE, 0x64, 0xF8, 0xC1, 0x8B, 0xF1, 0x2E, 0x5D, 0x6B, 0xA7, 0x3B, 0x74, 0x94, 0xE3, 0xC2, 0x40,
+    0x19, 0xBE, 0xCC, 0x46, 0xD9, 0x66, 0x6D, 0x54, 0xD5, 0xDA, 0xF7, 0xD5, 0xC7, 0xEF, 0x83, 0xDD,
+    0x44, 0x02, 0x56, 0x94, 0x79, 0xE7, 0xF6, 0x8D, 0x99, 0x6A, 0xA6, 0x5A, 0x70, 0x31, 0x13, 0x8F,
+    0xDB, 0x25, 0x3B, 0x09, 0x75, 0xC8, 0x29, 0x57, 0x3D, 0x94, 0xCA, 0x45, 0x7C, 0x8F, 0x9B, 0xE8,
+    0x5A, 0xDC, 0x68, 0xE4, 0x36, 0x37, 0xEE, 0x79, 0x49, 0x56, 0xA4, 0x93, 0xA5, 0x94, 0xED, 0x21,
+    0x8D, 0x90, 0x7B, 0xEF, 0x46, 0x7B, 0xAE, 0x0B, 0x52, 0x3D, 0xE4, 0x22, 0x53, 0x67, 0xB6, 0x0F,
+    0xAD, 0xFC, 0x15, 0x0B, 0xB5, 0x6C, 0xD4, 0x2B, 0xB5, 0x2C, 0x0C, 0x2B, 0x0C, 0x6D, 0x21, 0x09,
+    0x84, 0x6A, 0x7E, 0x04, 0x36, 0xD5, 0xDE, 0x75, 0xA7, 0x09, 0x52, 0xC2, 0x85, 0x62, 0x06, 0x6C,
+    0xD2, 0x93, 0xC5, 0xF3, 0x99, 0xCE, 0x7A, 0x22, 0xB8, 0x32, 0x74, 0x50, 0xE9, 0x20, 0xDD, 0x8F,
+    0x33, 0x4F, 0x84, 0xEF, 0x81, 0x5A, 0x4F, 0xBB, 0x6A, 0x42, 0x3D, 0x01, 0x4D, 0xC8, 0x86, 0xA7,
+    0x5C, 0xD8, 0xB9, 0x22, 0xE9, 0x5A, 0x93, 0x69, 0xBC, 0x14, 0xA3, 0xCB, 0xA0, 0x64, 0x0B, 0x3E,
+    0xD2, 0xC9, 0x4A, 0x9D, 0x18, 0x24, 0xED, 0x27, 0x0E, 0x5F, 0x6A, 0x0A, 0x1D, 0x2F, 0xB2, 0x2E,
+    0xEC, 0xDD, 0x48, 0xFB, 0x71, 0x52, 0x87, 0x03, 0x75, 0xCE, 0xF2, 0xA1, 0xC5, 0x43, 0x5B, 0x29,
+    0x7E, 0x2A, 0x56, 0xBA, 0xBD, 0xCD, 0xB9, 0xCC, 0x50, 0xE3, 0x32, 0xB3, 0xD2, 0x55, 0xA2, 0x6C,
+    0x32, 0x95, 0x8C, 0xE0, 0x22, 0xD5, 0xFF, 0xAD, 0x17, 0x56, 0xDF, 0xD4, 0x0B, 0xDD, 0xB8, 0x01,
+    0x9D, 0x62, 0xA4, 0x68, 0x82, 0x0B, 0x4A, 0x5F, 0xE7, 0x82, 0xDE, 0xD1, 0x05, 0x25, 0x9B, 0xAB,
+    0xD5, 0x2F, 0x19, 0xEA, 0x5E, 0x59, 0xE9, 0xBE, 0xDD, 0x6B, 0x59, 0x41, 0x7A, 0xFD, 0x6A, 0xE9,
+    0x95, 0x95, 0x4E, 0xB2, 0xFA, 0x0D, 0xED, 0x4F, 0xCD, 0x4A, 0x77, 0x78, 0xBD, 0x0B, 0x28, 0x26,
+    0x9E, 0x04, 0x9A, 0xBE, 0x98, 0x80, 0x4D, 0xCF, 0xD6, 0x5E, 0x8B, 0x45, 0x97, 0xA5, 0x16, 0x90,
+    0xEF, 0x3D, 0x40, 0x6C, 0xB1, 0x9B, 0x45, 0xAE, 0x1C, 0x3F, 0xDD, 0xC8, 0x4A, 0x27, 0x71, 0x90,
+    0xD1, 0x88, 0xB4, 0xCD, 0x0C, 0xBE, 0xDF, 0x2B, 0x1A, 0x7A, 0x98, 0x56, 0xB1, 0xC2, 0x29, 0xB9,
+    0x53, 0x3E, 0x57, 0x74, 0x68, 0x82, 0x59, 0xB2, 0x24, 0x80, 0x95, 0xBB, 0x80, 0x5D, 0xCA, 0x09,
+    0xA8, 0xB4, 0x16, 0x5A, 0x7F, 0x55, 0x73, 0x03, 0x1F, 0xED, 0x01, 0x4E, 0xEF, 0x68, 0x19, 0x7B,
+    0xE4, 0x90, 0x3B, 0xCC, 0x8E, 0x0F, 0x4D, 0x7B, 0x06, 0x27, 0xBE, 0x5D, 0x07, 0xC0, 0x7E, 0x47,
+    0xB3, 0x2D, 0x1A, 0x45, 0xE5, 0xB4, 0x76, 0xDE, 0x96, 0xAE, 0x9F, 0xDB, 0x21, 0x1F, 0xD3, 0x69,
+    0xB6, 0x99, 0x71, 0xC4, 0xBD, 0x05, 0xAF, 0x50, 0x13, 0x2E, 0xF2, 0x0A, 0x65, 0x2A, 0x20, 0x37,
+    0xFE, 0xA3, 0x78, 0x85, 0xE2, 0x3F, 0x89, 0x57, 0x68, 0x7A, 0x08, 0xAF, 0xD0, 0x9B, 0x27, 0x72,
+    0x5F, 0xCF, 0x95, 0x56, 0xAF, 0x60, 0x67, 0x0D, 0xCF, 0x19, 0xC4, 0xFD, 0x98, 0xE8, 0x1C, 0x4F,
+    0xEF, 0x07, 0x3E, 0x1C, 0xFA, 0x48, 0xF3, 0xC7, 0x7B, 0xAA, 0xED, 0x52, 0xAA, 0xA2, 0xD5, 0x62,
+    0x4D, 0x19, 0x55, 0xB9, 0xED, 0xEE, 0xD4, 0x34, 0x21, 0x33, 0x60, 0xF6, 0xE7, 0x30, 0xB8, 0x3F,
+    0x7B, 0x0E, 0x72, 0xD3, 0xE6, 0xA3, 0x00, 0x87, 0x6D, 0x3F, 0x08, 0x50, 0xDD, 0x15, 0x6D, 0x00,
+    0x89, 0x56, 0x44, 0xFA, 0x2B, 0xDD, 0xE7, 0x9E, 0xD6, 0x1A, 0xD8, 0x39, 0x5A, 0x94, 0x42, 0x5A,
+    0x1B, 0xBD, 0xB4, 0xF5, 0x2B, 0xB2, 0x71, 0xEA, 0xFF, 0x20, 0xD9, 0x37, 0x62, 0x15, 0x9D, 0xD0,
+    0x04, 0x1F, 0x19, 0x8C, 0xB4, 0x45, 0xAA, 0x16, 0x2D, 0x49, 0x36, 0x61, 0x83, 0xAD, 0x9C, 0xB1,
+    0x4B, 0x13, 0x74, 0x51, 0x76, 0x76, 0xA6, 0x48, 0x2E, 0xE0, 0xA6, 0x0E, 0xBA, 0x0F, 0x2F, 0xD9,
+    0xDD, 0xD9, 0xBF, 0xDC, 0x66, 0x86, 0xB3, 0x47, 0x4C, 0x82, 0xB9, 0x1E, 0xF5, 0xF8, 0x94, 0x5A,
+    0x42, 0x66, 0xA8, 0x3E, 0xCB, 0xBC, 0xD5, 0xBD, 0xEE, 0x88, 0xDA, 0xD9, 0x5E, 0x46, 0xCD, 0x76,
+    0x5C, 0x14, 0xF3, 0xBB, 0xEE, 0x53, 0x8A, 0xD0, 0xC9, 0x66, 0x67, 0x9B, 0xDE, 0x47, 0x19, 0xAF,
+    0xEE, 0x27, 0xCA, 0xD6, 0x51, 0x3B, 0x6F, 0x46, 0xDC, 0x82, 0x11, 0x32, 0xAA, 0x9D, 0x2A, 0xF2,
+    0x0E, 0x1F, 0xF8, 0x8A, 0xB4, 0xEE, 0x1B, 0xF2, 0xE2, 0x66, 0x45, 0xA6, 0x42, 0x96, 0xBC, 0x30,
+    0x6F, 0xDC, 0xC3, 0x6A, 0x48, 0x41, 0xF7, 0xB9, 0x53, 0x93, 0x78, 0x87, 0x8D, 0x0A, 0xDA, 0x72,
+    0x01, 0x9A, 0xFF, 0x78, 0x8C, 0x17, 0xC1, 0x8B, 0xEC, 0x33, 0xB0, 0xFF, 0xF7, 0x68, 0xD7, 0x73,
+    0xC7, 0x8F, 0xD5, 0xAC, 0x33, 0xB1, 0x9D, 0xCD, 0xC4, 0xCF, 0x1E, 0x08, 0xDB, 0xF4, 0x85, 0x64,
+    0xAE, 0xAA, 0x0B, 0x9C, 0xA8, 0x7F, 0x9C, 0x39, 0xA9, 0x6C, 0xEE, 0x48, 0xD6, 0x7D, 0xB1, 0xA3,
+    0x48, 0x6A, 0x2D, 0xF2, 0xFB, 0x87, 0x4C, 0x7A, 0x5F, 0xF5, 0xA3, 0xB9, 0x91, 0x7E, 0x58, 0x8C,
+    0x1C, 0xD2, 0x99, 0x03, 0x6B, 0x1D, 0x9B, 0xBF, 0x11, 0xBB, 0xD6, 0xA1, 0xE9, 0x2F, 0x2A, 0xF3,
+    0xCF, 0x8E, 0x6E, 0x6F, 0x47, 0x11, 0x8F, 0xB9, 0xA4, 0x6A, 0xB7, 0x83, 0xEB, 0xFC, 0xD0, 0x5D,
+    0x84, 0x5F, 0x7F, 0x3E, 0xE3, 0x77, 0xBD, 0xEC, 0x5C, 0x39, 0x67, 0xBE, 0xF5, 0x81, 0x61, 0xCF,
+    0x85, 0x3C, 0x15, 0xC5, 0x41, 0xD3, 0xFD, 0xEE, 0xB8, 0x56, 0x0F, 0x71, 0xCC, 0x1F, 0xFE, 0x7F,
+    0x55, 0xA4, 0xE8, 0x7D, 0x4B, 0xFD, 0xF9, 0x05, 0x06, 0xE9, 0xB5, 0x3F, 0xF2, 0xB0, 0xCF, 0x1D,
+    0x6D, 0xB7, 0x01, 0x3A, 0x19, 0xB5, 0x57, 0x2F, 0x68, 0xED, 0xAB, 0x07, 0x5C, 0x50, 0x5B, 0xAB,
+    0x19, 0x18, 0xAF, 0x9B, 0xE7, 0x53, 0x6A, 0x32, 0x9E, 0x61, 0x7D, 0xA9, 0x87, 0xA4, 0x4E, 0xE9,
+    0x52, 0xC8, 0x8B, 0x09, 0x33, 0xDB, 0x99, 0x0D, 0x1B, 0x6D, 0xE4, 0x14, 0x3B, 0xD9, 0xC8, 0x29,
+    0x55, 0xB0, 0x91, 0x53, 0xE5, 0x19, 0x4A, 0x4F, 0x75, 0xAD, 0x9D, 0x4D, 0xF2, 0x82, 0x5D, 0xCB,
+    0xE8, 0x13, 0x46, 0x64, 0xF4, 0x11, 0xBA, 0x8D, 0x2B, 0xCA, 0x6D, 0x64, 0x4E, 0x30, 0x2D, 0x4E,
+    0x02, 0x09, 0x2B, 0x91, 0x5B, 0xDA, 0x78, 0xD1, 0xC2, 0xE9, 0x4E, 0x1C, 0x1D, 0xC1, 0x8D, 0xE6,
+    0x40, 0x7D, 0x6B, 0x12, 0xFE, 0x8F, 0x9F, 0x67, 0x10, 0x11, 0xE9, 0xBD, 0xC8, 0xF6, 0xD2, 0xEC,
+    0xFE, 0xFA, 0x63, 0x0B, 0x5B, 0x19, 0xB9, 0x4B, 0xF3, 0xB5, 0x84, 0x6F, 0xAB, 0x78, 0x8A, 0x1B,
+    0x8B, 0xC5, 0xB7, 0x76, 0x66, 0x75, 0x81, 0x8D, 0xAE, 0x8C, 0x34, 0x63, 0x57, 0x2C, 0x58, 0x91,
+    0x76, 0x3D, 0x1C, 0x7A, 0xF8, 0x34, 0xFF, 0x10, 0xD9, 0x27, 0x83, 0x48, 0xC4, 0x8B, 0x2C, 0xA8,
+    0xB1, 0xD9, 0xC9, 0x3E, 0xF7, 0xF6, 0x9B, 0x95, 0x61, 0xC4, 0x1B, 0x49, 0xD4, 0x5F, 0x13, 0x69,
+    0xAB, 0xBF, 0x59, 0xEA, 0xD1, 0xFE, 0x78, 0x2E, 0x23, 0x69, 0x2E, 0x12, 0x7E, 0x61, 0xA3, 0x4E,
+    0xF8, 0xB6, 0x4A, 0xD4, 0xC1, 0x6E, 0x54, 0x51, 0x8F, 0xC8, 0xEE, 0xFA, 0x9F, 0x9E, 0xEC, 0x33,
+    0x1B, 0xEE, 0x76, 0x57, 0x94, 0x26, 0xE4, 0xAD, 0xDE, 0x6C, 0x7B, 0xE0, 0xA4, 0x29, 0xB2, 0xF6,
+    0x21, 0xD4, 0x0D, 0xC5, 0x3D, 0x2F, 0xD4, 0xA9, 0x13, 0xBA, 0xC4, 0x2D, 0x23, 0x0B, 0x77, 0xCB,
+    0x88, 0x16, 0x99, 0x93, 0x07, 0x96, 0x3B, 0x60, 0x7E, 0x1C, 0xA1, 0x78, 0x23, 0xE6, 0x7E, 0x5F,
+    0xBB, 0x26, 0x28, 0xE7, 0x35, 0x93, 0xC8, 0xBB, 0xD1, 0x73, 0xD5, 0x05, 0x1F, 0xFE, 0xB4, 0x0E,
+    0xF5, 0x77, 0x62, 0x1D, 0x9C, 0x4C, 0x4D, 0x6F, 0x25, 0x78, 0xF5, 0xD3, 0xB8, 0x4A, 0x66, 0x5D,
+    0xB4, 0x67, 0x04, 0x34, 0x9A, 0x7C, 0xF7, 0x97, 0x49, 0x5B, 0xAA, 0x9C, 0xD1, 0xFC, 0x85, 0xA3,
+    0xE5, 0x0E, 0xAF, 0xF7, 0x83, 0xE9, 0xF9, 0x0F, 0xE0, 0x94, 0x50, 0x3E, 0xD8, 0x09, 0xDC, 0xE4,
+    0x02, 0xB8, 0x4D, 0x13, 0x03, 0x0B, 0xC0, 0x7B, 0xDA, 0xB7, 0x71, 0xB1, 0xF4, 0x9F, 0x11, 0xF9,
+    0xF1, 0x7B, 0x02, 0x8F, 0x56, 0xE6, 0xE0, 0x53, 0x38, 0x00, 0x13, 0x0F, 0xE3, 0x6C, 0xC2, 0x21,
+    0x5B, 0x96, 0x4B, 0x15, 0xD2, 0x43, 0x23, 0x2B, 0xF0, 0xBB, 0x5B, 0x7B, 0x81, 0xEE, 0xE8, 0xB1,
+    0xE3, 0xF5, 0xF8, 0x69, 0x3D, 0x74, 0x42, 0xC9, 0x77, 0xFC, 0xB1, 0x1C, 0x77, 0x2C, 0x76, 0x21,
+    0xD9, 0xD1, 0x8D, 0x76, 0x74, 0x74, 0x38, 0x1E, 0x7D, 0x10, 0xA0, 0x2F, 0x72, 0x0F, 0x3D, 0x68,
+    0x95, 0xE6, 0x07, 0x83, 0x80, 0x50, 0x6E, 0x39, 0x44, 0xAC, 0x35, 0x04, 0x26, 0x53, 0x19, 0x0E,
+    0x39, 0x5D, 0xEB, 0x7B, 0xEA, 0xD1, 0xAC, 0x20, 0x94, 0x91, 0x3A, 0xD2, 0xFD, 0xE0, 0x45, 0xC1,
+    0x8B, 0xC8, 0x64, 0xF6, 0x50, 0x3F, 0xAF, 0xAA, 0xC7, 0x7B, 0xAC, 0x44, 0x27, 0xD0, 0x89, 0x95,
+    0x08, 0x65, 0xDC, 0x06, 0xE0, 0xF4, 0x9A, 0x8D, 0xE0, 0xBE, 0xDD, 0x77, 0xC0, 0x16, 0xAB, 0x11,
+    0x5C, 0x52, 0x62, 0x80, 0xD6, 0xFD, 0xD7, 0x85, 0x26, 0x1A, 0x91, 0xD9, 0xAE, 0x34, 0x6F, 0x0E,
+    0xC1, 0x07, 0x3B, 0xB3, 0x95, 0x33, 0x9E, 0x6A, 0x1A, 0xB0, 0x91, 0x53, 0x37, 0xE1, 0xA9, 0xA6,
+    0x95, 0x32, 0x92, 0xB4, 0x2B, 0xFE, 0xAB, 0x09, 0xBB, 0x96, 0xB1, 0xE9, 0xA9, 0x65, 0xB5, 0x73,
+    0xE6, 0xCB, 0xDB, 0x1B, 0x5F, 0x3F, 0xF9, 0x02, 0x60, 0x06, 0x59, 0x0E, 0x9D, 0xBB, 0xDD, 0x7D,
+    0x23, 0x63, 0x6E, 0xDC, 0x2D, 0x13, 0xB8, 0x45, 0x73, 0x4C, 0xC1, 0x07, 0xB0, 0x49, 0x29, 0x5A,
+    0x47, 0xED, 0x82, 0xD3, 0xAE, 0xDD, 0xBF, 0x51, 0x10, 0x8E, 0xFF, 0xC1, 0xC9, 0xC9, 0xC9, 0x4B,
+    0xDF, 0x14, 0x11, 0x91, 0xB5, 0x13, 0x11, 0x91, 0x57, 0x34, 0xC2, 0xEB, 0x5A, 0x72, 0xAB, 0x78,
+    0x66, 0x5D, 0x47, 0x72, 0xF7, 0xAF, 0x36, 0xEC, 0xEA, 0x19, 0x87, 0x7B, 0xBF, 0xEE, 0x30, 0xD2,
+    0x44, 0xAC, 0xFC, 0x60, 0x48, 0x07, 0xF6, 0x70, 0xE5, 0x2A, 0xDA, 0x0F, 0x3A, 0xFA, 0xDD, 0x7B,
+    0xCA, 0xA6, 0x60, 0x44, 0x12, 0xCD, 0x54, 0x2E, 0x66, 0xA5, 0x8C, 0x6E, 0xC4, 0x8D, 0xA7, 0xE0,
+    0x3F, 0x12, 0x61, 0x6D, 0x7A, 0xEC, 0x2C, 0x22, 0xF2, 0x4D, 0x11, 0x91, 0x3A, 0x50, 0xA4, 0x0E,
+    0xDC, 0xAB, 0x49, 0x21, 0x29, 0x76, 0x71, 0x23, 0x4D, 0xF0, 0xC1, 0x26, 0xBA, 0xBF, 0x1E, 0x02,
+    0x83, 0x2C, 0xD0, 0xED, 0x29, 0xB9, 0xC7, 0x8E, 0x9F, 0x86, 0xEA, 0x1B, 0x22, 0x11, 0x23, 0xAF,
+    0x88, 0xB4, 0xD4, 0x62, 0xA4, 0xC5, 0x48, 0xB2, 0x09, 0x5C, 0xBC, 0x9D, 0xFD, 0xB2, 0x26, 0x64,
+    0x14, 0x0F, 0x4D, 0x8F, 0x59, 0x21, 0x41, 0xA9, 0xD4, 0xAC, 0x6E, 0xD2, 0x83, 0x5D, 0xB4, 0x13,
+    0x4A, 0x76, 0x26, 0x89, 0x5B, 0x40, 0x19, 0x33, 0xF5, 0x5E, 0xDD, 0x03, 0xBE, 0x4D, 0x00, 0x6B,
+    0x0E, 0x84, 0xBD, 0x96, 0x0F, 0x16, 0x80, 0xE6, 0xEB, 0x8A, 0xF2, 0xD0, 0x16, 0x9F, 0x4D, 0x81,
+    0x00, 0x1A, 0x82, 0xB8, 0x9C, 0xFE, 0x99, 0xB8, 0x4C, 0xE5, 0x61, 0xBE, 0x00, 0xC5, 0x34, 0x2C,
+    0xD0, 0x7D, 0x4B, 0x22, 0xA5, 0xF4, 0x5D, 0xC0, 0xAF, 0xEA, 0x12, 0x99, 0x44, 0xD3, 0x53, 0x46,
+    0x12, 0xB8, 0xA0, 0x07, 0x38, 0xDC, 0x04, 0x92, 0x9D, 0xC0, 0xCE, 0x1E, 0x70, 0xAF, 0xC6, 0x43,
+    0xC4, 0x74, 0xF7, 0x0E, 0x50, 0xBC, 0x11, 0x0E, 0x6D, 0xC6, 0xCD, 0x59, 0x7D, 0x34, 0x1F, 0x5D,
+    0x3D, 0xC2, 0x43, 0x8F, 0x20, 0xF8, 0x4D, 0x00, 0xBE, 0xAC, 0x0B, 0x98, 0xBB, 0x54, 0x39, 0x85,
+    0xAC, 0x7F, 0xE0, 0x66, 0x65, 0x72, 0x31, 0x92, 0x61, 0x43, 0xF9, 0xF8, 0xBD, 0xCB, 0xC6, 0xFD,
+    0x3C, 0xF8, 0xE2, 0xB1, 0xE3, 0xA7, 0x0F, 0x7C, 0xDB, 0xA5, 0x9E, 0x9D, 0xAC, 0x49, 0xA4, 0x6A,
+    0x39, 0x23, 0xE6, 0x66, 0xCB, 0x09, 0x5B, 0xDF, 0x6A, 0xA7, 0x4F, 0x3D, 0x2A, 0x97, 0x5F, 0x15,
+    0x29, 0x44, 0x19, 0xBC, 0x8B, 0xBF, 0xD3, 0x0B, 0x8B, 0x59, 0x2F, 0xB4, 0xB3, 0xEF, 0xA1, 0x0E,
+    0x36, 0xBA, 0x11, 0xAA, 0x68, 0xF5, 0x78, 0xC6, 0x64, 0xA3, 0xDE, 0xD1, 0x46, 0xED, 0x5D, 0xFF,
+    0x83, 0xA8, 0xF1, 0xD8, 0x2B, 0x93, 0xA6, 0x56, 0xDF, 0x98, 0x34, 0x20, 0x93, 0x29, 0x27, 0x63,
+    0xA7, 0xCC, 0x5D, 0x3E, 0xE6, 0xC0, 0x6D, 0xBC, 0x48, 0x2C, 0xFF, 0xF8, 0xD6, 0x52, 0x6D, 0xB7,
+    0x0F, 0x49, 0x81, 0x46, 0x56, 0xEA, 0x43, 0xC5, 0xBD, 0xCB, 0x02, 0xF0, 0x39, 0x0D, 0xBB, 0xC3,
+    0xD3, 0xDC, 0x9E, 0x82, 0xC8, 0xEF, 0x7B, 0x59, 0x78, 0x0F, 0xC5, 0x2E, 0x81, 0x38, 0xAE, 0xC3,
+    0xA3, 0xFC, 0x1A, 0xB8, 0xDE, 0x4C, 0x14, 0x89, 0x67, 0xA0, 0x19, 0xEB, 0x1E, 0xE4, 0xF5, 0x69,
+    0xA7, 0xB2, 0xBC, 0xF2, 0xD9, 0xFF, 0x9F, 0x3B, 0xE8, 0xF2, 0xD6, 0x3B, 0xE8, 0xC6, 0x13, 0xCB,
+    0xA3, 0x6E, 0xAC, 0xBE, 0xFD, 0xDC, 0x78, 0xB6, 0x83, 0x86, 0x41, 0x5A, 0x59, 0xAC, 0xF4, 0x4E,
+    0x5A, 0xD3, 0xF2, 0xDF, 0xC5, 0x03, 0x90, 0x4F, 0x49, 0x42, 0x23, 0xE4, 0x46, 0x36, 0xDD, 0xE1,
+    0x9F, 0xBF, 0x90, 0x82, 0xDE, 0x09, 0xCB, 0x16, 0x1E, 0x24, 0x2C, 0xEB, 0x44, 0xDA, 0x7C, 0xBE,
+    0xDD, 0x8B, 0xDB, 0x09, 0x17, 0xA9, 0x04, 0xFF, 0xA3, 0x6E, 0x10, 0xF7, 0xF2, 0x61, 0x95, 0xEE,
+    0xC7, 0x1F, 0x93, 0xC0, 0x86, 0x5D, 0xA9, 0x47, 0xDC, 0xA4, 0xD0, 0xAB, 0x26, 0xE4, 0xD2, 0x8E,
+    0x68, 0xC2, 0xAC, 0x9C, 0x31, 0xAB, 0x76, 0xAA, 0xB9, 0x48, 0x1D, 0x8F, 0xE4, 0x64, 0x48, 0xA5,
+    0x88, 0x6C, 0x97, 0xCF, 0xE6, 0x33, 0x43, 0xC0, 0x49, 0xE0, 0x5D, 0x43, 0xD0, 0x80, 0x2D, 0xB3,
+    0xF8, 0xD0, 0xC1, 0x63, 0xA7, 0x4F, 0xD3, 0xC9, 0xCA, 0x20, 0x09, 0xB3, 0xE4, 0x9E, 0xD4, 0xA8,
+    0x30, 0xB2, 0x6A, 0x7C, 0x14, 0xF7, 0xBA, 0x04, 0x27, 0x12, 0xEB, 0x7B, 0x55, 0x6A, 0xFA, 0x22,
+    0xF9, 0xD6, 0x24, 0x0F, 0xC9, 0x63, 0x92, 0xA7, 0x58, 0x7C, 0x5B, 0xC6, 0x66, 0xBC, 0x11, 0x54,
+    0xD9, 0xE7, 0x6C, 0xB0, 0xFF, 0xF8, 0xE4, 0x3A, 0x74, 0x22, 0x4B, 0x3E, 0x84, 0xF3, 0x9D, 0x37,
+    0x42, 0x95, 0xF3, 0x6C, 0x39, 0x1D, 0xE8, 0x46, 0x7C, 0xA0, 0x03, 0xC9, 0x2C, 0x85, 0x2E, 0xBE,
+    0xDF, 0x8D, 0xF8, 0xE7, 0xC6, 0x01, 0xD6, 0xEA, 0x95, 0x99, 0x32, 0xBA, 0xA1, 0xA7, 0x09, 0x7E,
+    0x81, 0xBD, 0xA7, 0x3D, 0x41, 0xFD, 0x83, 0xFF, 0x31, 0xC2, 0x80, 0x9D, 0x28, 0x12, 0x65, 0xC0,
+    0x4D, 0xBC, 0xE3, 0xAD, 0x72, 0xE7, 0x47, 0xF2, 0xD9, 0x1D, 0x74, 0x54, 0x65, 0x7A, 0x72, 0xF3,
+    0x45, 0x9A, 0x1E, 0x2F, 0x85, 0x44, 0xBA, 0xAD, 0x92, 0x05, 0x6E, 0x35, 0x9F, 0x4F, 0x70, 0xF7,
+    0xAE, 0x4D, 0xB0, 0xCE, 0x45, 0x02, 0x19, 0x4D, 0x02, 0xE9, 0x4D, 0xCA, 0xEC, 0xBE, 0xC5, 0x96,
+    0x33, 0xB1, 0x76, 0x39, 0x50, 0x2A, 0x7E, 0xA0, 0x8A, 0x94, 0xF1, 0xA6, 0x1B, 0xA9, 0x26, 0xDF,
+    0x04, 0xDC, 0x58, 0x0F, 0x2D, 0x6E, 0x72, 0x1B, 0xD4, 0xDB, 0x27, 0x96, 0xFD, 0x44, 0x2A, 0x7F,
+    0x43, 0x22, 0x78, 0x73, 0x7D, 0x06, 0x0F, 0x09, 0x6E, 0xC1, 0x9F, 0xEE, 0x08, 0x84, 0xF5, 0x0C,
+    0xE2, 0x5A, 0xC9, 0x0B, 0x90, 0xCF, 0x98, 0xFE, 0x9D, 0x93, 0x2F, 0x5C, 0x42, 0x8B, 0xEA, 0x32,
+    0x9B, 0xCF, 0xF1, 0x45, 0x79, 0xCC, 0xF1, 0xF1, 0xF1, 0x8D, 0x60, 0x44, 0x44, 0x26, 0x3A, 0x25,
+    0x39, 0x1C, 0x4E, 0x4E, 0x5E, 0xF8, 0x47, 0x51, 0xF7, 0xDA, 0x9F, 0x1E, 0x90, 0x77, 0x81, 0xD9,
+    0xF7, 0x21, 0xBF, 0x16, 0x55, 0xB7, 0xEF, 0xA9, 0x3E, 0x4F, 0x50, 0x1C, 0x7A, 0x00, 0xCD, 0xED,
+    0x83, 0x63, 0xDF, 0xE6, 0x45, 0x55, 0x44, 0x1E, 0x3B, 0xBE, 0xD1, 0x57, 0x22, 0x0B, 0x5E, 0xA4,
+    0xBD, 0x14, 0x17, 0x6A, 0xD7, 0x6A, 0xDC, 0xB1, 0x15, 0xB7, 0x76, 0xB2, 0x80, 0x8B, 0x17, 0x94,
+    0x53, 0xBE, 0x65, 0x9B, 0xA0, 0x7C, 0x7D, 0xCA, 0x19, 0x61, 0x3F, 0x1D, 0x6C, 0xF4, 0xCF, 0xA8,
+    0x0C, 0x79, 0xE5, 0xE3, 0x3F, 0x3E, 0xDE, 0xCB, 0xB1, 0xFA, 0xF3, 0x67, 0x56, 0x86, 0x3C, 0x24,
+    0x48, 0xC4, 0xCE, 0x36, 0xFD, 0x1A, 0xE5, 0x7C, 0x95, 0x3A, 0x3C, 0x82, 0xF0, 0x15, 0x17, 0xCD,
+    0x26, 0x20, 0x13, 0x6E, 0xC5, 0xC8, 0x4A, 0x3D, 0xDD, 0x61, 0xA3, 0x3D, 0x4B, 0x90, 0x54, 0xDF,
+    0x90, 0xD7, 0xE4, 0x42, 0x82, 0xE4, 0xEC, 0x81, 0x53, 0xFE, 0xC9, 0x70, 0xF2, 0xE2, 0x02, 0x82,
+    0x99, 0x61, 0xCB, 0x07, 0xAB, 0x15, 0x11, 0xB3, 0x52, 0x84, 0x87, 0xD6, 0xC7, 0xAF, 0xB4, 0x50,
+    0xFE, 0x9D, 0xAC, 0x5A, 0xA8, 0xE8, 0x71, 0xF2, 0xA2, 0x8C, 0xB8, 0x09, 0x1F, 0xA9, 0xC7, 0x7C,
+    0x6E, 0x68, 0x35, 0xD3, 0x04, 0x4A, 0x05, 0x3D, 0x2D, 0xF8, 0x9E, 0x72, 0xA6, 0x6B, 0x73, 0x35,
+    0xA2, 0x9C, 0x11, 0xA8, 0xE2, 0x91, 0xDC, 0xC6, 0xC5, 0x4E, 0x12, 0x6E, 0x1A, 0x64, 0xC9, 0x48,
+    0x19, 0x55, 0x31, 0xDD, 0xA1, 0x37, 0x30, 0x7D, 0x99, 0xC0, 0xDE, 0x1F, 0x22, 0xDA, 0x22, 0x8B,
+    0x55, 0x90, 0xE0, 0x27, 0x73, 0x7B, 0xAB, 0x13, 0x91, 0x3F, 0x13, 0x91, 0xB1, 0x8A, 0x36, 0x16,
+    0x0B, 0x77, 0x58, 0xF9, 0x20, 0xBE, 0x3D, 0x43, 0x13, 0x15, 0xCB, 0x7B, 0x6F, 0xB3, 0x0D, 0xD2,
+    0x7B, 0x91, 0xA5, 0xDE, 0x3E, 0x2F, 0xE5, 0x4C, 0xF3, 0x37, 0x0B, 0x36, 0xAD, 0x20, 0x1E, 0xFC,
+    0xB7, 0x03, 0xEE, 0x8D, 0x88, 0x7D, 0x73, 0x3E, 0xE3, 0xF1, 0xDC, 0xF3, 0x9D, 0x55, 0xA4, 0x2D,
+    0xA3, 0x99, 0xAB, 0x99, 0x41, 0x66, 0x6A, 0x89, 0xBA, 0x2F, 0xFF, 0x7F, 0xED, 0xBD, 0x4D, 0xAC,
+    0x25, 0xC7, 0x75, 0xE7, 0xF9, 0xCB, 0x8C, 0xAA, 0x97, 0x6A, 0x65, 0x5B, 0x51, 0x0B, 0x96, 0xE1,
+    0x26, 0x2D, 0xA5, 0x80, 0xF1, 0xC2, 0xB2, 0x29, 0x66, 0x2F, 0xB4, 0xD0, 0xA2, 0xEA, 0x45, 0xAA,
+    0x09, 0x34, 0x17, 0x5A, 0xA8, 0xD0, 0xA8, 0x6B, 0x01, 0xA3, 0x05, 0xB5, 0xD0, 0x62, 0x46, 0x3D,
+    0xDD, 0xEC, 0x85, 0x16, 0xC4, 0x4C, 0x55, 0x65, 0x4A, 0x5C, 0x68, 0x00, 0x03, 0xE3, 0x1A, 0x8C,
+    0x0C, 0x03, 0xE3, 0x45, 0x73, 0xC1, 0x06, 0xCC, 0xCB, 0x45, 0x69, 0x00, 0xCD, 0x0C, 0x81, 0x79,
+    0xEF, 0x65, 0x50, 0xB5, 0xD0, 0x42, 0x0B, 0xA7, 0xAD, 0x56, 0x6B, 0xE1, 0x85, 0xD2, 0x56, 0xC9,
+    0x9A, 0x26, 0x31, 0x50, 0x48, 0x4A, 0x9A, 0x59, 0xC5, 0xC8, 0x3C, 0xB3, 0x38, 0x99, 0xF7, 0xDE,
+    0x57, 0x55, 0x62, 0x4B, 0x6A, 0xC9, 0x1F, 0x3D, 0x73, 0xC9, 0xFB, 0x51, 0xF7, 0x65, 0xE6, 0xCD,
+    0x38, 0x71, 0xCE, 0x89, 0x73, 0xFE, 0xE7, 0x23, 0x48, 0x47, 0x92, 0xCD, 0x86, 0x24, 0x92, 0x0B,
+    0x99, 0x08, 0x56, 0xB0, 0xE2, 0x33, 0x99, 0xA8, 0x85, 0x4C, 0x7A, 0x5C, 0x93, 0xC8, 0x4C, 0x92,
+    0x05, 0x5C, 0x65, 0xC6, 0xF7, 0x41, 0x3A, 0xE2, 0xB0, 0x3D, 0x40, 0xA4, 0xC6, 0x35, 0x00, 0x37,
+    0x69, 0x39, 0x03, 0xE0, 0x98, 0x99, 0x08, 0x40, 0xC9, 0x64, 0x02, 0x00, 0xB6, 0x8A, 0x79, 0xA7,
+    0x9F, 0xDE, 0x88, 0x45, 0x03, 0x40, 0xF1, 0xEE, 0x2C, 0x00, 0xE0, 0x44, 0x96, 0x4F, 0xF2, 0x47,
+    0x6F, 0xB7, 0x15, 0x40, 0x3A, 0x65, 0xC1, 0x79, 0x80, 0x7C, 0xCC, 0x43, 0xD1, 0x01, 0x14, 0x21,
+    0xEF, 0x6D, 0x00, 0x70, 0x9D, 0xED, 0xB2, 0x01, 0x40, 0x1A, 0xEB, 0x4D, 0x04, 0x8C, 0x50, 0xF8,
+    0x74, 0x06, 0x6C, 0xA4, 0xF4, 0x08, 0xE0, 0x02, 0xAE, 0xA1, 0x6D, 0x40, 0x3A, 0x5C, 0x85, 0xEB,
+    0x30, 0x52, 0x25, 0xED, 0x6D, 0xCA, 0x91, 0x72, 0xC2, 0x4A, 0xC4, 0x4A, 0xE5, 0x06, 0x0A, 0x19,
+    0x31, 0xD2, 0x25, 0x7A, 0x17, 0xD4, 0x7E, 0xF9, 0xB0, 0x0C, 0x0E, 0xC0, 0x55, 0xEB, 0xA7, 0x7A,
+    0xFD, 0xC0, 0xAD, 0xDD, 0xA7, 0x93, 0xDD, 0xA7, 0xD7, 0x77, 0x9F, 0x3E, 0x0B, 0x47, 0xF7, 0xC8,
+    0xE1, 0x5F, 0x57, 0x46, 0xBA, 0x34, 0xE0, 0x62, 0x22, 0x82, 0xC3, 0x4A, 0xE7, 0x3E, 0x33, 0x64,
+    0xBD, 0xB9, 0x7F, 0x62, 0x7C, 0x59, 0x4D, 0x44, 0xF8, 0xA7, 0xC9, 0xE8, 0x7C, 0x09, 0x60, 0xBF,
+    0x1C, 0xB3, 0x0E, 0x60, 0xFC, 0xE1, 0x17, 0x23, 0x80, 0xBD, 0x39, 0xB8, 0x0A, 0x48, 0xDE, 0x7D,
+    0x41, 0x87, 0x5F, 0xFE, 0xD5, 0x8F, 0x05, 0xC0, 0x44, 0xF7, 0x7F, 0xF6, 0x00, 0xCE, 0xCC, 0xC7,
+    0x00, 0x79, 0x57, 0xDF, 0xED, 0x81, 0x64, 0xC8, 0xC3, 0x31, 0xEF, 0x83, 0x63, 0x66, 0x13, 0xD2,
+    0xFE, 0xB7, 0x0A, 0x6F, 0xBD, 0xAB, 0x4E, 0x73, 0x09, 0xC9, 0x90, 0x8A, 0x78, 0x89, 0x94, 0x58,
+    0x79, 0x3D, 0x9B, 0x31, 0x3D, 0xF5, 0x5F, 0x34, 0x17, 0xE1, 0x12, 0x5C, 0x8B, 0xCB, 0xAD, 0xDB,
+    0x95, 0x00, 0x0F, 0x7F, 0x91, 0x8E, 0xFA, 0x9E, 0x2C, 0x13, 0x46, 0xB9, 0x23, 0x10, 0xF0, 0xF9,
+    0x57, 0xA0, 0x96, 0x19, 0x23, 0x32, 0x53, 0x7C, 0xFF, 0xA9, 0x89, 0x53, 0xB2, 0xD1, 0x04, 0x6C,
+    0xB0, 0x0D, 0xA5, 0xBF, 0x0A, 0x33, 0x97, 0x30, 0x03, 0x50, 0x78, 0x48, 0x26, 0xA0, 0xE8, 0x31,
+    0x32, 0x43, 0x21, 0x03, 0xD4, 0x32, 0x02, 0xE5, 0x00, 0x14, 0x01, 0x70, 0x1E, 0x10, 0xC0, 0xC4,
+    0xA7, 0xC1, 0xFE, 0x68, 0x80, 0xF6, 0x53, 0x81, 0x2C, 0x96, 0x3D, 0x6D, 0x57, 0x3F, 0x68, 0x27,
+    0x5A, 0x11, 0xCF, 0x0B, 0x72, 0x0F, 0x92, 0x7A, 0x9D, 0x8A, 0x34, 0x2C, 0xF7, 0xFC, 0xBF, 0x9F,
+    0x81, 0x91, 0x00, 0x56, 0x80, 0xF7, 0xDF, 0x06, 0x48, 0xCE, 0x2A, 0x4A, 0x19, 0x10, 0x89, 0x66,
+    0x4C, 0x66, 0xE3, 0x99, 0x53, 0x98, 0x75, 0xB4, 0x66, 0x84, 0x17, 0x3A, 0xAC, 0x54, 0x58, 0xE9,
+    0x21, 0x1F, 0xC1, 0x44, 0x48, 0xE3, 0x6F, 0x90, 0xC6, 0x1B, 0x98, 0x71, 0xC6, 0x06, 0xF9, 0xC3,
+    0xB6, 0xAB, 0x45, 0xAA, 0x42, 0x06, 0x78, 0xCA, 0x43, 0xB6, 0x3C, 0x73, 0x8F, 0xBD, 0xD3, 0x60,
+    0x45, 0xCF, 0x04, 0xE0, 0xE2, 0xE6, 0x3A, 0xE9, 0x48, 0x21, 0x33, 0xC5, 0x44, 0x21, 0x23, 0xED,
+    0x04, 0x6D, 0x95, 0x4A, 0x04, 0x21, 0x1F, 0x2E, 0xC0, 0x4C, 0xD1, 0x01, 0x13, 0xAE, 0x82, 0x64,
+    0x62, 0x02, 0xD2, 0x98, 0x0E, 0x80, 0x89, 0x59, 0x0F, 0x98, 0xD1, 0x7A, 0xC0, 0x0C, 0x25, 0x40,
+    0xF6, 0x60, 0x02, 0xC8, 0x65, 0x06, 0xB0, 0x6F, 0xB7, 0x00, 0xB6, 0x77, 0x0D, 0x50, 0x74, 0xA5,
+    0x07, 0x4A, 0x5F, 0xF4, 0x40, 0xE9, 0x6D, 0x00, 0x5C, 0x93, 0x8D, 0x80, 0x6B, 0x4C, 0x04, 0xEA,
+    0x2A, 0x99, 0x81, 0x16, 0xA4, 0x02, 0x81, 0xD6, 0x73, 0x24, 0x5F, 0xC1, 0x0D, 0xD4, 0x32, 0x51,
+    0xCC, 0xB4, 0x12, 0xC9, 0x44, 0x67, 0xBD, 0xD5, 0x39, 0x6E, 0x39, 0x7C, 0x9B, 0xCE, 0x31, 0xC8,
+    0x32, 0x56, 0x95, 0x76, 0x5E, 0x26, 0x79, 0x95, 0xF4, 0x9E, 0x13, 0x8A, 0x58, 0x0B, 0x75, 0xE4,
+    0x56, 0x22, 0x23, 0xA7, 0x59, 0x80, 0x68, 0x3D, 0x44, 0x07, 0x8C, 0x27, 0x90, 0xBC, 0x1D, 0x20,
+    0x7D, 0x27, 0x80, 0x91, 0x01, 0xCC, 0x14, 0x21, 0x1B, 0x22, 0xE4, 0xFD, 0x19, 0xD8, 0xCE, 0xF1,
+    0x1B, 0xD6, 0x3B, 0x7F, 0xB5, 0xF0, 0x45, 0x1F, 0x0B, 0x6F, 0x65, 0x2C, 0x9B, 0x4C, 0x5E, 0x77,
+    0x55, 0x3A, 0xBD, 0x0E, 0x5C, 0x1B, 0x77, 0xF7, 0xB0, 0x7B, 0x49, 0x77, 0xCC, 0xB3, 0xF2, 0xE6,
+    0xC5, 0xCD, 0x75, 0x28, 0x9B, 0x44, 0xA4, 0xA3, 0x98, 0x29, 0x64, 0x24, 0x93, 0x9E, 0x7C, 0x20,
+    0x91, 0x09, 0x04, 0x5C, 0xD3, 0x60, 0x7B, 0xAC, 0xCE, 0x81, 0xF2, 0xE7, 0x1B, 0xD5, 0x29, 0x90,
+    0xC6, 0x17, 0x6D, 0x03, 0xB8, 0xDF, 0x7F, 0x36, 0x00, 0x66, 0x08, 0x27, 0x00, 0xEE, 0x53, 0x45,
+    0x05, 0x64, 0x0F, 0xA4, 0x07, 0x68, 0x97, 0x79, 0xF8, 0xDE, 0x5B, 0x01, 0x60, 0xBA, 0xA2, 0x13,
+    0x71, 0xF7, 0x8D, 0x08, 0xA4, 0xF1, 0x86, 0xED, 0x81, 0xF2, 0x1B, 0x4D, 0x0B, 0x98, 0xF1, 0x73,
+    0x66, 0x54, 0x85, 0x52, 0x76, 0x90, 0x05, 0x65, 0xF0, 0x16, 0xF2, 0x01, 0x6C, 0x0F, 0xCE, 0x73,
+    0x24, 0xB7, 0x49, 0x85, 0x4C, 0xA4, 0xC3, 0x46, 0x5A, 0x89, 0xE0, 0x7A, 0x1D, 0xCE, 0x35, 0x92,
+    0x57, 0xE1, 0xA9, 0x97, 0x24, 0x90, 0x4F, 0xB5, 0x90, 0x4A, 0x97, 0xF5, 0xB4, 0x27, 0x9C, 0x52,
+    0x34, 0xD8, 0x37, 0x4C, 0x0F, 0x31, 0x8C, 0x60, 0xFF, 0xB4, 0x84, 0xE4, 0xFE, 0x0F, 0x3C, 0x94,
+    0x32, 0x82, 0x11, 0xF1, 0xE0, 0xAE, 0x9C, 0x42, 0xF6, 0x93, 0x6F, 0x04, 0x38, 0xFB, 0xB8, 0x03,
+    0xFB, 0x1F, 0xFE, 0xD9, 0x08, 0x11, 0xDB, 0x3D, 0x5D, 0x78, 0xDA, 0xFC, 0x8D, 0x88, 0x91, 0xA1,
+    0x6C, 0x28, 0x67, 0x33, 0x40, 0x5B, 0x01, 0x49, 0xF5, 0xF3, 0xB0, 0x71, 0x2B, 0xC1, 0x55, 0x20,
+    0x12, 0x26, 0xE0, 0xD3, 0xD3, 0xBF, 0xF8, 0x5B, 0x67, 0xE3, 0xA0, 0x6C, 0xAC, 0x84, 0xCB, 0xE6,
+    0x95, 0x6E, 0xAA, 0xBA, 0xDA, 0x0E, 0x32, 0xE9, 0xE1, 0xE8, 0x4E, 0xB7, 0xAA, 0xB6, 0xFD, 0x4B,
+    0xD1, 0xC0, 0xC5, 0x17, 0xBE, 0x92, 0xDC, 0x2B, 0x24, 0xE6, 0xF1, 0xC9, 0xF6, 0x15, 0x17, 0xB9,
+    0x85, 0x8C, 0x9C, 0x9A, 0x1D, 0xF7, 0x96, 0x8F, 0xE1, 0xDE, 0x71, 0xC7, 0xBD, 0xD3, 0x01, 0xF7,
+    0x5E, 0xB2, 0xBE, 0xF4, 0x5F, 0x28, 0x7C, 0xF1, 0x97, 0xA1, 0xF0, 0xB9, 0xF4, 0x65, 0x63, 0xC4,
+    0x3B, 0xBD, 0x6D, 0x2E, 0x71, 0x79, 0xB3, 0xD9, 0x90, 0x4C, 0x56, 0x44, 0xBC, 0x91, 0xBB, 0x22,
+    0xD2, 0x19, 0xF9, 0xD1, 0xBC, 0x15, 0x8C, 0x8C, 0xA7, 0xB8, 0xCA, 0xC4, 0x0B, 0x25, 0x45, 0x67,
+    0x46, 0xAC, 0xCF, 0x43, 0x1A, 0x49, 0x3B, 0x13, 0x93, 0x08, 0x97, 0xD6, 0x55, 0xB6, 0xAE, 0x4E,
+    0x01, 0x0A, 0x7F, 0x13, 0x20, 0x0F, 0xC7, 0x00, 0x66, 0x59, 0x5A, 0x45, 0x25, 0xB8, 0xFE, 0xF4,
+    0x08, 0x50, 0xFA, 0x56, 0x8F, 0xB1, 0x3A, 0x13, 0x69, 0x54, 0x41, 0xAE, 0x1B, 0xA0, 0xAE, 0x6C,
+    0x00, 0x4A, 0x9F, 0xCC, 0x80, 0x0D, 0xB8, 0x0E, 0xCC, 0x48, 0x16, 0x55, 0xD8, 0xA5, 0x21, 0x91,
+    0x7B, 0x14, 0x03, 0xB9, 0x88, 0x37, 0x52, 0x19, 0x91, 0x9E, 0x72, 0x91, 0xF8, 0x8A, 0xF4, 0xDF,
+    0x5D, 0x27, 0xFF, 0xA2, 0x88, 0xCF, 0x66, 0x27, 0x63, 0x2A, 0x3F, 0xF0, 0x45, 0xD5, 0x9E, 0x9E,
+    0xA4, 0xA1, 0xF4, 0x9F, 0xEC, 0x5C, 0xD6, 0x73, 0x6C, 0xFA, 0x11, 0xB8, 0x79, 0x0C, 0xE4, 0xDF,
+    0xF4, 0xC0, 0x14, 0x01, 0x2B, 0x1D, 0x24, 0x72, 0x06, 0x94, 0x77, 0x03, 0x98, 0xC1, 0x55, 0xE0,
+    0x92, 0x48, 0x95, 0x05, 0xDB, 0x3F, 0xCD, 0x19, 0xED, 0x27, 0xBD, 0xED, 0x8D, 0x0C, 0x4C, 0x14,
+    0x33, 0xD6, 0x53, 0x57, 0xFA, 0x9B, 0x5C, 0xDC, 0x6C, 0xB8, 0xB8, 0xD9, 0x90, 0x89, 0x34, 0x46,
+    0xC4, 0x27, 0x22, 0x0D, 0x22, 0x1D, 0xE9, 0x04, 0xE9, 0xBC, 0xAC, 0x1D, 0xF5, 0xB2, 0x90, 0x97,
+    0x1E, 0x6C, 0xA7, 0x32, 0x96, 0x0D, 0xAA, 0xEB, 0xD3, 0xB8, 0x2C, 0x43, 0x8B, 0x0C, 0xE2, 0x1A,
+    0x5D, 0x75, 0x76, 0x07, 0x8A, 0x88, 0x0C, 0x90, 0x8A, 0x88, 0x4C, 0x80, 0x88, 0x9A, 0x2B, 0xEB,
+    0x81, 0xC5, 0x72, 0x60, 0x1E, 0xF4, 0xAA, 0x69, 0x84, 0x24, 0xA2, 0x2B, 0x4A, 0xFB, 0x1E, 0x07,
+    0xEA, 0xB2, 0xC2, 0x22, 0xEB, 0xAF, 0x50, 0xC8, 0x8C, 0x15, 0xF1, 0xB9, 0x48, 0x95, 0x89, 0x2C,
+    0x94, 0xCD, 0xD6, 0x15, 0x77, 0x5D, 0x8A, 0xDB, 0x75, 0xE5, 0x5D, 0x0C, 0x92, 0x7C, 0x59, 0x9A,
+    0xCD, 0xA2, 0x1E, 0x18, 0x96, 0xF7, 0xDF, 0x86, 0x64, 0x0B, 0x4F, 0x18, 0x09, 0xE4, 0x9D, 0x13,
+    0x98, 0xC8, 0x02, 0xD6, 0x73, 0x46, 0x12, 0xB1, 0x3D, 0xA5, 0x67, 0xC2, 0x8C, 0x58, 0x8F, 0xAB,
+    0x92, 0x48, 0x16, 0x28, 0x45, 0x04, 0x23, 0x22, 0x3D, 0x6E, 0xB3, 0x59, 0x4F, 0x68, 0x49, 0x22,
+    0x79, 0x4F, 0xE9, 0x9B, 0x09, 0x33, 0x1E, 0x5B, 0x8F, 0xFB, 0xD4, 0x1B, 0x11, 0x23, 0x63, 0xD9,
+    0xE0, 0xDE, 0x7D, 0x76, 0xC0, 0xC4, 0xAF, 0x01, 0x17, 0x6D, 0xB3, 0x5B, 0x0E, 0xD4, 0x66, 0x18,
+    0x77, 0xC6, 0x53, 0xD1, 0x1F, 0x18, 0x10, 0xEB, 0xD4, 0x6D, 0xAA, 0x44, 0xA4, 0x47, 0x44, 0x22,
+    0x85, 0x8C, 0x58, 0x11, 0xF1, 0xE4, 0x03, 0xE4, 0x0F, 0x5E, 0x1B, 0xD7, 0xF9, 0x2B, 0xAA, 0x85,
+    0x72, 0x69, 0xD0, 0x95, 0x47, 0x28, 0x57, 0x82, 0xA6, 0xDD, 0x3A, 0x89, 0x4F, 0x28, 0x9D, 0x4B,
+    0x8F, 0xCE, 0xAD, 0x89, 0xEB, 0x6F, 0xBB, 0x86, 0xFD, 0x4C, 0x42, 0x2B, 0x22, 0x52, 0x01, 0x56,
+    0x64, 0x21, 0xF4, 0xCA, 0x2B, 0xBB, 0x59, 0xDA, 0x73, 0x06, 0xA5, 0x57, 0x73, 0x65, 0xC7, 0x30,
+    0xFB, 0x39, 0xDD, 0xF1, 0x91, 0xCE, 0x4B, 0x5D, 0xA9, 0xEC, 0x90, 0x07, 0xD6, 0x89, 0xBD, 0xCD,
+    0x8E, 0x3D, 0xA1, 0x95, 0x81, 0x5A, 0x22, 0x3A, 0x35, 0x97, 0x37, 0x95, 0x44, 0x52, 0x91, 0xBB,
+    0x12, 0xB0, 0x22, 0x55, 0xE1, 0x71, 0xDC, 0xE4, 0x8C, 0x24, 0x9A, 0x60, 0x46, 0xF2, 0xDE, 0x35,
+    0xB6, 0xC3, 0x7D, 0x31, 0xE2, 0x60, 0x62, 0x99, 0x24, 0x72, 0x51, 0x55, 0x2E, 0x32, 0x03, 0xD3,
+    0xE6, 0xD3, 0x03, 0xCB, 0x4C, 0x51, 0x7A, 0x6A, 0xE0, 0x8C, 0x34, 0x5E, 0xC0, 0x0C, 0xD8, 0x3E,
+    0x60, 0x3D, 0xEE, 0x79, 0x4F, 0x0D, 0x12, 0x49, 0x47, 0x8C, 0x78, 0x6C, 0x87, 0xD5, 0xB9, 0xB8,
+    0xB8, 0x4C, 0xC7, 0x66, 0xB3, 0xB9, 0xB6, 0xF0, 0xB9, 0x08, 0x50, 0x88, 0x88, 0xC8, 0x6D, 0x20,
+    0x7F, 0xF0, 0xEF, 0x3E, 0x2F, 0x0D, 0x4A, 0xA2, 0x3C, 0xA8, 0x92, 0x5E, 0xE8, 0xC5, 0xB4, 0xD0,
+    0x8B, 0xC2, 0x2F, 0x56, 0x41, 0x1A, 0x17, 0x7A, 0xE1, 0xFC, 0x42, 0x2F, 0x33, 0x2E, 0xF4, 0xA2,
+    0xAE, 0x30, 0x63, 0x72, 0x5D, 0x17, 0xBE, 0xFA, 0x39, 0x19, 0xA1, 0x85, 0xEC, 0x5D, 0x91, 0x80,
+    0x0D, 0xD0, 0xCE, 0xAF, 0x89, 0x67, 0x06, 0x3B, 0x91, 0x4F, 0x14, 0x1D, 0xCC, 0x50, 0xF6, 0x69,
+    0xD4, 0xB9, 0x11, 0x4A, 0xBD, 0xA8, 0x0D, 0xEB, 0x45, 0x05, 0x57, 0x61, 0x46, 0xB0, 0x21, 0x1B,
+    0x74, 0xC2, 0x85, 0x56, 0xE7, 0xC6, 0xF6, 0x36, 0xE8, 0xDC, 0xCC, 0x47, 0x72, 0x9B, 0xF2, 0x3E,
+    0x14, 0xDF, 0x11, 0x69, 0x9C, 0x44, 0xD2, 0x28, 0x32, 0x64, 0x22, 0xCD, 0xDE, 0xCC, 0xCF, 0xC3,
+    0x6A, 0xCB, 0xCE, 0x3B, 0xC3, 0x5F, 0xE5, 0xCB, 0x54, 0x76, 0x11, 0xAC, 0xB3, 0x7F, 0xB9, 0xD8,
+    0x3E, 0xB9, 0x32, 0x11, 0x50, 0xCB, 0x7A, 0x81, 0x6D, 0x05, 0xC9, 0xAB, 0xE4, 0x3D, 0x18, 0x09,
+    0xB9, 0x34, 0x50, 0x8B, 0x91, 0x08, 0x64, 0xFD, 0x5C, 0x7B, 0xE0, 0xCC, 0x25, 0x11, 0xB0, 0xDF,
+    0xF5, 0x85, 0x07, 0xE6, 0x90, 0x46, 0xC0, 0x4E, 0xB8, 0x2F, 0x5E, 0x27, 0x91, 0xC6, 0xFC, 0x8D,
+    0x8C, 0x94, 0x81, 0x5A, 0xA4, 0x37, 0x13, 0xB9, 0xFC, 0xB1, 0x34, 0xCE, 0xD3, 0x56, 0x79, 0xCC,
+    0x06, 0x6C, 0x8F, 0xEB, 0x5A, 0x98, 0x48, 0x66, 0xDB, 0x53, 0x78, 0x6C, 0x3F, 0x91, 0x46, 0x98,
+    0x0B, 0x8F, 0x6B, 0xB0, 0x7F, 0x19, 0x31, 0x03, 0xCC, 0x65, 0x83, 0x83, 0xE2, 0x5B, 0x03, 0x59,
+    0xD8, 0xA9, 0x8F, 0x72, 0x19, 0xCD, 0x70, 0xCE, 0x97, 0xB1, 0x1D, 0x40, 0xA5, 0x73, 0x55, 0xEA,
+    0xC4, 0x9A, 0x65, 0xF1, 0x28, 0x45, 0x3D, 0xB7, 0x5A, 0x8D, 0xE7, 0x3B, 0x07, 0x5F, 0x26, 0x72,
+    0x0F, 0x20, 0x9F, 0xC8, 0xE7, 0x0A, 0xD7, 0x53, 0x4B, 0x87, 0x34, 0xE9, 0xFC, 0xFC, 0x90, 0xCE,
+    0x64, 0xC1, 0x44, 0x13, 0xB1, 0x5D, 0x1A, 0xF3, 0x01, 0xE7, 0x93, 0xC9, 0x06, 0x5C, 0x95, 0x4C,
+    0x65, 0x47, 0x4B, 0x32, 0x39, 0xCF, 0xBC, 0xBE, 0xA5, 0xB1, 0xF6, 0xC9, 0x84, 0x89, 0x75, 0x93,
+    0x4C, 0x98, 0xB1, 0x6E, 0x92, 0x89, 0x6C, 0xA8, 0x9B, 0x64, 0x22, 0x0F, 0x75, 0x93, 0x4C, 0xD8,
+    0xBE, 0xF6, 0xCC, 0x94, 0xDE, 0x79, 0x66, 0xEA, 0xCA, 0xF5, 0xB4, 0x08, 0x45, 0xC0, 0xBD, 0x14,
+    0xB1, 0x91, 0xF2, 0xBB, 0x01, 0x23, 0x95, 0x15, 0x4F, 0x22, 0xF7, 0x5F, 0x10, 0x52, 0x6A, 0x11,
+    0x99, 0x67, 0x32, 0x99, 0x9F, 0x97, 0x01, 0x2E, 0x56, 0x6C, 0xD6, 0x69, 0x4D, 0x5A, 0x0F, 0xD4,
+    0xF7, 0x81, 0x7C, 0x3C, 0x92, 0x0A, 0xA1, 0x95, 0x2A, 0xEF, 0xF3, 0xBE, 0xA6, 0xC6, 0x31, 0x99,
+    0xC1, 0x0C, 0x66, 0x2C, 0xBD, 0xF5, 0x79, 0x3F, 0x73, 0x0B, 0xF7, 0xEC, 0x90, 0x0E, 0x4C, 0x85,
+    0xB7, 0x9D, 0x09, 0x35, 0xAE, 0x2A, 0xBF, 0x18, 0x99, 0x88, 0xD9, 0x90, 0x8E, 0x59, 0x6F, 0xFB,
+    0x2C, 0x38, 0x9C, 0xB7, 0x77, 0x07, 0xDA, 0xA6, 0x94, 0x0A, 0xE9, 0xDC, 0x90, 0x20, 0x22, 0x6F,
+    0x9E, 0x50, 0xCB, 0x1D, 0x69, 0xB8, 0x58, 0x5D, 0xBC, 0xB6, 0xBA, 0x49, 0xD4, 0x22, 0x8D, 0x6A,
+    0xBB, 0x44, 0xBE, 0xFF, 0x99, 0x99, 0x72, 0x20, 0x1D, 0x93, 0x19, 0xF2, 0xCE, 0x86, 0x75, 0x12,
+    0xC6, 0x6C, 0x80, 0xB4, 0x71, 0x9E, 0x55, 0x17, 0x29, 0x83, 0x2A, 0x4F, 0xCE, 0xAB, 0x64, 0xA9,
+    0x64, 0xA0, 0x0B, 0xB9, 0xDA, 0x16, 0x99, 0xBA, 0x8E, 0x8B, 0xBB, 0x0C, 0xD0, 0x7A, 0xF8, 0x35,
+    0xC4, 0x93, 0x0E, 0xA9, 0xF4, 0x49, 0xEB, 0x8D, 0x88, 0x6A, 0x1F, 0x69, 0x48, 0x5A, 0xE9, 0x01,
+    0x75, 0xD2, 0x6D, 0x05, 0x70, 0x15, 0x20, 0x19, 0x80, 0x0F, 0x3C, 0xEF, 0x81, 0x76, 0x02, 0x12,
+    0xE9, 0x81, 0xE4, 0x4F, 0x94, 0x86, 0x2F, 0xDC, 0xC6, 0x4A, 0x9F, 0x88, 0xF8, 0xF2, 0xDB, 0x67,
+    0x49, 0xE4, 0x92, 0xF5, 0x70, 0x06, 0x26, 0x28, 0xA3, 0xCD, 0xCA, 0x68, 0x45, 0x07, 0x75, 0x45,
+    0x32, 0x41, 0x36, 0x90, 0x14, 0x3D, 0x37, 0x5C, 0x97, 0xF7, 0xAD, 0xCC, 0x88, 0xF4, 0xC8, 0xA8,
+    0x3E, 0x94, 0xAD, 0xE0, 0x2A, 0x24, 0x81, 0xFC, 0x8E, 0xC7, 0xC5, 0x9D, 0x1F, 0x7E, 0x79, 0xB3,
+    0xD9, 0x6C, 0xAE, 0x89, 0x88, 0xC8, 0x5D, 0x11, 0x11, 0x29, 0xDE, 0xBC, 0xF3, 0x60, 0x1B, 0x4F,
+    0x71, 0x8D, 0xF9, 0xAB, 0xC0, 0x8C, 0xFD, 0x03, 0x9F, 0x0D, 0xDC, 0xF8, 0x28, 0xA5, 0x4F, 0xC2,
+    0x25, 0x5A, 0x92, 0x95, 0x2E, 0xCA, 0xD8, 0x75, 0xC5, 0xAA, 0xB8, 0x17, 0x8A, 0x34, 0x3B, 0x17,
+    0x26, 0x0B, 0x7B, 0xB1, 0x90, 0x47, 0x08, 0xCA, 0xF9, 0x13, 0x93, 0xF6, 0x3F, 0xEA, 0xF2, 0x01,
+    0x46, 0x24, 0xB2, 0xAE, 0x6A, 0x87, 0x07, 0xE6, 0xBD, 0x0A, 0xD1, 0xCE, 0x29, 0x31, 0x1D, 0xC0,
+    0xFB, 0x41, 0x35, 0xC3, 0x6D, 0xFE, 0x75, 0xE5, 0x84, 0x36, 0xA4, 0xE2, 0x6B, 0x31, 0x32, 0x14,
+    0xD2, 0x73, 0xCB, 0xFE, 0x60, 0xA8, 0xEF, 0xF4, 0x9C, 0xB9, 0x74, 0x88, 0xB6, 0x67, 0x8A, 0xE6,
+    0x9D, 0x60, 0x3B, 0xE6, 0x60, 0xDE, 0xF5, 0xD6, 0x23, 0x9D, 0x11, 0x0A, 0x9F, 0x48, 0x93, 0x4D,
+    0x94, 0x4D, 0x2A, 0xE4, 0x11, 0x57, 0x99, 0x09, 0x1B, 0x70, 0x98, 0x88, 0xED, 0xA9, 0xC9, 0x06,
+    0x8A, 0x8E, 0x33, 0xF2, 0xA0, 0x6B, 0xBB, 0xED, 0x71, 0x15, 0xF1, 0x1F, 0xD9, 0x0E, 0x47, 0x12,
+    0xCB, 0xC2, 0x53, 0x93, 0x8C, 0xA7, 0x85, 0xE7, 0x8C, 0x54, 0x62, 0xD9, 0x30, 0x93, 0xCA, 0xEB,
+    0xAE, 0x22, 0x92, 0x4C, 0x2F, 0xEA, 0xB4, 0x5E, 0x8A, 0x0F, 0x79, 0xFF, 0x0F, 0xBD, 0xAF, 0x6B,
+    0xF8, 0x53, 0x8B, 0xB2, 0x2C, 0x76, 0x18, 0xC0, 0xE5, 0xCD, 0x75, 0x36, 0x9B, 0x17, 0x44, 0x68,
+    0xE5, 0x07, 0x22, 0x94, 0xD2, 0x17, 0x03, 0xD4, 0x8D, 0x89, 0xE0, 0x1A, 0xEA, 0x8A, 0xD2, 0x63,
+    0x03, 0x85, 0x27, 0x8D, 0xD8, 0x0E, 0xEA, 0x26, 0xEF, 0xC1, 0x86, 0x2C, 0x40, 0x12, 0x4D, 0x00,
+    0xDC, 0x4B, 0x03, 0x90, 0xFF, 0x78, 0x04, 0x92, 0x59, 0xD7, 0xDB, 0x08, 0x90, 0x4D, 0x07, 0xAA,
+    0x59, 0x8D, 0x40, 0x5D, 0x67, 0x54, 0x2A, 0x74, 0xBD, 0x3F, 0xF7, 0x67, 0x9D, 0xD7, 0xF2, 0x7E,
+    0x05, 0x89, 0xC8, 0x08, 0xA8, 0x11, 0x97, 0xBC, 0x42, 0xD6, 0x49, 0xC0, 0x7D, 0x47, 0x3A, 0xDA,
+    0xA6, 0xF6, 0xC9, 0x4C, 0x8B, 0x19, 0x92, 0x09, 0xDB, 0x99, 0x01, 0x87, 0xED, 0xD3, 0x11, 0xD7,
+    0x58, 0x4F, 0x4B, 0xAD, 0x77, 0x66, 0x42, 0xD1, 0x60, 0x7D, 0x04, 0x97, 0x77, 0x10, 0x6F, 0x81,
+    0x79, 0x67, 0xC5, 0x16, 0xCA, 0xB0, 0xD8, 0x00, 0xE9, 0xB8, 0xF2, 0x9D, 0x5B, 0xCD, 0xB6, 0xBC,
+    0x5F, 0x6D, 0xA0, 0x08, 0x14, 0x0F, 0xC0, 0x88, 0xC0, 0x93, 0xDB, 0x57, 0x7E, 0x41, 0x92, 0xD9,
+    0x1E, 0x6C, 0xC8, 0x03, 0x24, 0x53, 0xF6, 0x9E, 0x24, 0xCB, 0x67, 0x55, 0xE5, 0xD2, 0x80, 0x88,
+    0x74, 0x3B, 0x9A, 0x2C, 0x24, 0x1B, 0x7F, 0xD9, 0x24, 0x2B, 0x95, 0x64, 0xB7, 0x7E, 0x2A, 0xC9,
+    0xD2, 0x77, 0x02, 0xE4, 0x2B, 0xC9, 0x9C, 0x08, 0x89, 0x48, 0x24, 0x79, 0xFE, 0xDB, 0xD7, 0x7E,
+    0x46, 0x92, 0x91, 0x6C, 0x36, 0x5C, 0xDE, 0x5C, 0x43, 0x64, 0xB0, 0x32, 0x93, 0xCB, 0x4C, 0x2B,
+    0x0D, 0xF9, 0xA4, 0x63, 0x70, 0x1E, 0xDB, 0x41, 0x32, 0xEB, 0xF0, 0x6C, 0xD0, 0xF1, 0xD5, 0x8D,
+    0x5A, 0x86, 0x51, 0x87, 0x5E, 0xFC, 0x99, 0xB2, 0x8B, 0xE8, 0x1A, 0xB8, 0x82, 0x1D, 0x4E, 0x57,
+    0xC6, 0x74, 0x01, 0xB8, 0x6A, 0xE5, 0xF1, 0x42, 0x17, 0x78, 0xF3, 0x63, 0x3D, 0x67, 0x52, 0x8B,
+    0xC7, 0x55, 0x8B, 0xC3, 0x6A, 0x46, 0x15, 0xFF, 0xD2, 0x2B, 0x13, 0xCC, 0xCA, 0x99, 0xAB, 0xA5,
+    0xEF, 0x1A, 0x8E, 0xA4, 0x22, 0x9B, 0x6F, 0x67, 0x22, 0x4D, 0x2E, 0xE2, 0x45, 0x06, 0x94, 0xB8,
+    0x2C, 0x2E, 0xF6, 0xDE, 0xF6, 0x38, 0x3B, 0x5C, 0x93, 0x77, 0x42, 0x67, 0x9B, 0x73, 0x10, 0xCB,
+    0xFB, 0x81, 0xA3, 0x86, 0xA3, 0x3E, 0x15, 0x8F, 0x74, 0x4E, 0x2A, 0x2B, 0xD5, 0xAB, 0x82, 0xFC,
+    0x77, 0x24, 0x53, 0xDE, 0x83, 0x19, 0x8F, 0x81, 0xFC, 0x27, 0x81, 0x85, 0x41, 0x97, 0x91, 0xD5,
+    0xCD, 0x6E, 0xC2, 0x6D, 0x04, 0x68, 0x07, 0x20, 0xFB, 0x8B, 0x00, 0x1C, 0x17, 0xFE, 0x0A, 0x26,
+    0xB8, 0x2F, 0x85, 0x0F, 0xBB, 0xAA, 0xAD, 0x1B, 0x19, 0x13, 0x99, 0x8C, 0x34, 0x46, 0xBE, 0x66,
+    0x07, 0xB2, 0x9F, 0x74, 0x17, 0x21, 0xD1, 0x1B, 0x39, 0xDE, 0xC3, 0x3E, 0x59, 0xBF, 0x33, 0xF1,
+    0xD5, 0x59, 0x59, 0xAD, 0xA9, 0x64, 0xB3, 0xD9, 0x5C, 0x4F, 0x36, 0x1B, 0x44, 0x44, 0x9E, 0x15,
+    0xF1, 0x4E, 0x44, 0xBC, 0x48, 0x53, 0x7C, 0x7B, 0xFE, 0x4C, 0x48, 0x27, 0xF2, 0xCE, 0x55, 0x91,
+    0x96, 0x34, 0x14, 0xFE, 0x18, 0xD7, 0x30, 0xE6, 0xC1, 0x56, 0xB6, 0xE3, 0xA3, 0x66, 0xCC, 0xBC,
+    0x19, 0x48, 0x16, 0x9B, 0x57, 0x15, 0x6C, 0xBB, 0xC8, 0xBB, 0x6B, 0x94, 0x58, 0x56, 0x3D, 0x54,
+    0x55, 0xE1, 0xD3, 0xC2, 0x38, 0xEB, 0x81, 0xE5, 0x72, 0xA0, 0xED, 0x97, 0x03, 0x87, 0xFD, 0x81,
+    0xE9, 0xCF, 0x74, 0xE0, 0xE2, 0x9E, 0x25, 0x32, 0x6F, 0x5B, 0x79, 0x85, 0x5C, 0x0D, 0xE3, 0xC6,
+    0xE8, 0x7B, 0x77, 0xDE, 0x60, 0x4C, 0xE3, 0x43, 0x76, 0xA3, 0x7B, 0x08, 0x39, 0x35, 0xCB, 0x09,
+    0xEB, 0x04, 0xF2, 0x5B, 0xEA, 0xA0, 0x8F, 0x50, 0x88, 0x78, 0xF6, 0xEC, 0xF0, 0xC8, 0xE3, 0xC9,
+    0x97, 0x49, 0xAE, 0x95, 0x52, 0x21, 0x46, 0xD4, 0x00, 0xAC, 0x92, 0x89, 0x2C, 0x50, 0x7A, 0x5A,
+    0xD2, 0x71, 0x51, 0xF3, 0x13, 0x26, 0x50, 0x78, 0x6A, 0xD2, 0x48, 0xBE, 0xFF, 0xAA, 0xF4, 0xD4,
+    0x98, 0x48, 0xDE, 0x23, 0x9E, 0x89, 0x67, 0xC6, 0xDF, 0xB0, 0x5D, 0xFE, 0xDD, 0xE7, 0xFC, 0x9C,
+    0xFE, 0xE8, 0xFE, 0x68, 0x65, 0x2A, 0xA4, 0x6A, 0xE5, 0x13, 0x12, 0x8C, 0x34, 0xF6, 0x0F, 0x48,
+    0x2A, 0x92, 0xB0, 0x73, 0x30, 0xD3, 0x61, 0xF7, 0xD1, 0x04, 0x20, 0x9D, 0x0E, 0xC1, 0xF0, 0xCB,
+    0x9B, 0x6B, 0xC9, 0x66, 0x53, 0xC8, 0x9C, 0x88, 0xFC, 0x40, 0x66, 0x6A, 0xE9, 0xF3, 0x01, 0x84,
+    0x54, 0x95, 0xD7, 0x0C, 0x45, 0x87, 0xAB, 0xC8, 0x56, 0xFD, 0x95, 0x87, 0x83, 0x3F, 0x0B, 0x14,
+    0x1D, 0xA5, 0x27, 0x0F, 0xE4, 0x23, 0x26, 0x82, 0x7C, 0xFB, 0x33, 0x33, 0x94, 0x22, 0x52, 0x91,
+    0x28, 0x99, 0x8F, 0x5E, 0xFD, 0xE4, 0xA3, 0xEA, 0xDD, 0xBD, 0xA7, 0xF6, 0x4F, 0xDA, 0xEF, 0xAB,
+    0x77, 0xD7, 0xC1, 0xEA, 0x4A, 0x3F, 0xE6, 0x74, 0x9D, 0x1B, 0xE5, 0x5F, 0x1D, 0xF3, 0x02, 0xDF,
+    0xFF, 0x13, 0x48, 0x5E, 0x85, 0xEB, 0x56, 0x3C, 0x6D, 0x26, 0x3D, 0xAE, 0x4A, 0x47, 0xAC, 0x57,
+    0x0F, 0xDA, 0x71, 0xF0, 0x8F, 0xBA, 0x4A, 0x22, 0xCE, 0x53, 0x53, 0x07, 0xAC, 0xC8, 0x48, 0x2A,
+    0xD3, 0x04, 0x4F, 0xDD, 0x73, 0xBB, 0x3B, 0xCC, 0xC3, 0x87, 0x57, 0x81, 0x9C, 0x1C, 0xE0, 0xA4,
+    0x01, 0x3B, 0x77, 0x2C, 0x5E, 0xF3, 0xA5, 0xE3, 0x9D, 0x84, 0x9B, 0x00, 0x24, 0xE3, 0x6A, 0x9E,
+    0xA8, 0x31, 0x37, 0xFF, 0xE7, 0x52, 0x3B, 0xF3, 0xAE, 0x41, 0xD2, 0xBE, 0xE8, 0x28, 0xFD, 0x90,
+    0x07, 0xF2, 0xF1, 0x8A, 0x89, 0x20, 0x3F, 0x5C, 0xA9, 0xDD, 0x90, 0x2E, 0xD4, 0xBE, 0xFF, 0xC9,
+    0x00, 0x5C, 0x31, 0x11, 0x28, 0x98, 0x81, 0xCC, 0xBB, 0x0A, 0xD2, 0xFE, 0xA7, 0x53, 0xFB, 0xDF,
+    0x2B, 0xB5, 0x2B, 0xC8, 0x44, 0xFC, 0xCF, 0x4A, 0xBB, 0xE0, 0xAA, 0x24, 0x7E, 0xDC, 0x79, 0xEA,
+    0x0F, 0xAD, 0xB4, 0x4B, 0x64, 0x9A, 0xE0, 0xFD, 0x83, 0x03, 0x3E, 0x5E, 0x78, 0xF8, 0x50, 0x1E,
+    0x2E, 0x91, 0x3F, 0x3B, 0x5E, 0x01, 0xA6, 0x1A, 0x70, 0xB2, 0x2A, 0x34, 0x33, 0x03, 0x3C, 0xB1,
+    0x60, 0x09, 0x50, 0x2C, 0x5E, 0xEB, 0xB8, 0xD7, 0xA9, 0x72, 0x30, 0xE5, 0x13, 0x3B, 0x23, 0x7A,
+    0xF1, 0x49, 0x17, 0xCF, 0xF4, 0xC9, 0x57, 0xC0, 0x3C, 0x10, 0x69, 0xC8, 0x44, 0xA4, 0x27, 0x97,
+    0x3F, 0x6C, 0x03, 0x76, 0xC0, 0x0E, 0xD8, 0x9E, 0x7C, 0xA0, 0xE8, 0xC8, 0x06, 0x4A, 0xBF, 0xC8,
+    0x5C, 0x1E, 0x70, 0x0D, 0xB6, 0xC7, 0x35, 0xD8, 0x8E, 0xBA, 0xA2, 0xE8, 0x68, 0xA1, 0xF0, 0x08,
+    0x94, 0xFE, 0x48, 0x6E, 0x53, 0x77, 0xB5, 0x0C, 0xB9, 0x4C, 0xAD, 0x04, 0x2B, 0x91, 0xA4, 0x02,
+    0xDA, 0x11, 0x68, 0x05, 0xB8, 0x5C, 0x37, 0xAB, 0x86, 0xCF, 0xC2, 0x0E, 0xDC, 0x39, 0xDB, 0x71,
+    0xA6, 0xF5, 0x40, 0x16, 0x92, 0xD7, 0x49, 0xC7, 0x4C, 0x3C, 0x53, 0x2E, 0x03, 0xCE, 0xFE, 0xCD,
+    0x44, 0xF1, 0xCD, 0xCE, 0x55, 0xF9, 0x5B, 0x9D, 0xF5, 0xE9, 0xBB, 0x5D, 0x16, 0x90, 0x3E, 0x8D,
+    0xB8, 0xC0, 0x4C, 0x11, 0x70, 0x55, 0x3E, 0x52, 0x78, 0x95, 0xF5, 0x19, 0x33, 0x50, 0x57, 0x44,
+    0x4A, 0x4F, 0x9D, 0xD8, 0x9E, 0xF2, 0x4B, 0x77, 0x07, 0xF2, 0x1F, 0x84, 0x88, 0x91, 0xA1, 0x06,
+    0x45, 0x79, 0xFB, 0x05, 0xDF, 0x05, 0x9E, 0x7C, 0x55, 0x97, 0x3E, 0xF1, 0x4A, 0xCE, 0x00, 0xB4,
+    0xF7, 0x8A, 0x08, 0x66, 0xC2, 0xC4, 0xAC, 0xCB, 0x03, 0xE9, 0x54, 0x34, 0x45, 0x47, 0x32, 0x3B,
+    0x5C, 0x03, 0xB3, 0xA3, 0x85, 0x64, 0x72, 0x4C, 0x90, 0x4C, 0xEE, 0x4B, 0x11, 0xD2, 0x58, 0xBE,
+    0x3B, 0x6D, 0x36, 0x9F, 0x8E, 0x56, 0x44, 0x44, 0xC6, 0x44, 0x14, 0x66, 0xC9, 0xDF, 0xDE, 0x6C,
+    0x36, 0xD7, 0x16, 0x13, 0xFC, 0xBD, 0xDF, 0x06, 0xA0, 0x22, 0x1F, 0x21, 0xED, 0xC8, 0x26, 0x28,
+    0x3C, 0x46, 0x6E, 0x1F, 0x2D, 0x5A, 0x61, 0x52, 0x07, 0xAA, 0x07, 0x72, 0xB9, 0xAF, 0xC2, 0xB1,
+    0xAC, 0x8B, 0x23, 0x50, 0x8A, 0x87, 0xFA, 0xB5, 0x11, 0x6E, 0x31, 0x43, 0x4D, 0xD9, 0x54, 0x0E,
+    0xFB, 0x97, 0xA1, 0x6C, 0xF2, 0x30, 0x5A, 0x9F, 0x0D, 0xC7, 0x79, 0x6F, 0x47, 0x7B, 0x77, 0x78,
+    0x61, 0x30, 0xF3, 0x2C, 0x3D, 0x4E, 0xA4, 0x22, 0x95, 0x7B, 0x87, 0x13, 0x52, 0x51, 0x57, 0x7C,
+    0x0D, 0x1B, 0xD2, 0x48, 0x2A, 0x32, 0x81, 0x93, 0x08, 0x46, 0xEE, 0xAD, 0xA0, 0xC9, 0x7B, 0x93,
+    0x6C, 0x56, 0x92, 0x0D, 0x7F, 0x6F, 0x49, 0xB6, 0x20, 0x1B, 0xCB, 0x72, 0xED, 0xCE, 0x21, 0x02,
+    0x4B, 0x68, 0xF3, 0xC6, 0xB9, 0xB7, 0x2F, 0x9C, 0x5B, 0x96, 0xFE, 0xB6, 0x48, 0x9D, 0xF7, 0xAB,
+    0x23, 0xAA, 0x61, 0xD6, 0x12, 0x20, 0x6F, 0x80, 0xB4, 0x07, 0xF8, 0x1A, 0xC0, 0x85, 0x45, 0x0D,
+    0x64, 0x2B, 0x0A, 0x9C, 0xAE, 0xA0, 0xAE, 0x6B, 0x54, 0xD2, 0x56, 0x6C, 0xF6, 0xFC, 0x97, 0xE1,
+    0xA1, 0x2F, 0x8B, 0x4E, 0x35, 0x5C, 0xBA, 0x22, 0xB8, 0x87, 0x5F, 0x9A, 0x05, 0xAD, 0x2D, 0x44,
+    0xC8, 0x45, 0x9A, 0x47, 0x97, 0xEA, 0x7F, 0xBC, 0x58, 0x3E, 0x81, 0xA7, 0x97, 0x65, 0x3F, 0x70,
+    0x65, 0x01, 0x72, 0xC3, 0x1A, 0x25, 0xCB, 0xC6, 0x6C, 0x31, 0x02, 0x56, 0x8C, 0x65, 0x75, 0xAF,
+    0x15, 0x8F, 0xAB, 0x7E, 0x8A, 0x1D, 0xC0, 0xFF, 0x47, 0x83, 0xF5, 0xC3, 0x2E, 0x58, 0x3F, 0xB1,
+    0x0B, 0xD6, 0xB3, 0x06, 0xEB, 0x2F, 0x3D, 0x4C, 0x24, 0x9D, 0x81, 0x86, 0x7F, 0xB3, 0x44, 0xE6,
+    0xED, 0x62, 0x4E, 0x2B, 0xB7, 0x20, 0x4B, 0xB0, 0x7E, 0x87, 0xDE, 0x95, 0xEB, 0x44, 0xFE, 0x93,
+    0xC7, 0x13, 0xFE, 0x5F, 0x57, 0x7C, 0x95, 0xA3, 0x7B, 0xB8, 0x89, 0x12, 0x23, 0xBE, 0x90, 0x60,
+    0x02, 0x32, 0x99, 0xB7, 0xDB, 0xEA, 0x16, 0xEE, 0x8F, 0xFD, 0x95, 0x74, 0xB0, 0x9D, 0xF5, 0x18,
+    0x8A, 0x97, 0x62, 0x1A, 0x00, 0xC6, 0x5A, 0xE3, 0x31, 0xF6, 0x7F, 0x1A, 0x75, 0xD5, 0x7C, 0xE7,
+    0xBB, 0xCF, 0x0E, 0x00, 0xC5, 0xFF, 0x11, 0x04, 0x20, 0x9D, 0x4B, 0x8D, 0x9D, 0xB8, 0xBB, 0xEF,
+    0xDE, 0x52, 0x46, 0x71, 0xDF, 0xEB, 0x01, 0x4E, 0xB3, 0x78, 0x0C, 0x50, 0x54, 0xAD, 0xE9, 0x01,
+    0xD3, 0xDB, 0xDE, 0xF1, 0xA1, 0xF4, 0x13, 0x91, 0x68, 0x86, 0xBC, 0x6B, 0x85, 0xA2, 0x2A, 0x65,
+    0xB4, 0xE2, 0xD3, 0x80, 0x4C, 0xD4, 0x3D, 0xC7, 0x64, 0x33, 0x5C, 0x23, 0x51, 0xC5, 0xF4, 0x8B,
+    0x44, 0x9C, 0x67, 0x8D, 0x38, 0x8F, 0x1A, 0xAA, 0x0B, 0x07, 0xA1, 0xBA, 0xF1, 0x85, 0x4A, 0xD1,
+    0xF3, 0x41, 0xA9, 0x26, 0x80, 0x7D, 0xFB, 0x33, 0xE2, 0xC1, 0xF6, 0xB4, 0x3D, 0x14, 0x1D, 0x85,
+    0x42, 0x3E, 0xF9, 0x08, 0xA5, 0x27, 0x53, 0x83, 0xC4, 0xEC, 0xDF, 0xEA, 0x0A, 0x13, 0xA1, 0x55,
+    0x21, 0x12, 0x30, 0x23, 0x47, 0xF2, 0x15, 0xCC, 0x48, 0x2D, 0x13, 0xD9, 0x40, 0x2B, 0x71, 0xA7,
+    0xCB, 0xFA, 0x43, 0xAC, 0xB2, 0xAE, 0x80, 0xCF, 0x2E, 0x96, 0xD0, 0x0B, 0x11, 0x48, 0x54, 0x8F,
+    0xB1, 0xCC, 0xE0, 0x93, 0xB7, 0x15, 0x5A, 0x49, 0x7B, 0x89, 0xD4, 0x3F, 0x90, 0x60, 0xA4, 0x29,
+    0x1A, 0x77, 0xC2, 0x69, 0x1A, 0x30, 0xA1, 0xA8, 0xB0, 0x7E, 0x04, 0x97, 0x79, 0x92, 0xF1, 0x18,
+    0xF2, 0x3F, 0xBF, 0x0F, 0x4E, 0x43, 0x45, 0xE2, 0xB3, 0x21, 0x91, 0xA6, 0x6C, 0x10, 0x26, 0xD2,
+    0x68, 0x02, 0xD9, 0x50, 0x78, 0x6C, 0x57, 0x83, 0xFB, 0x67, 0x23, 0x4C, 0xB6, 0x53, 0x45, 0xA5,
+    0x68, 0xED, 0x6A, 0xA3, 0xB9, 0x86, 0x2A, 0x8D, 0xE4, 0xBE, 0xF4, 0xAA, 0xAC, 0x44, 0x1A, 0x68,
+    0x6F, 0xAF, 0x8E, 0xCF, 0xA6, 0xD2, 0x50, 0x51, 0xD4, 0x28, 0xC3, 0x5C, 0x41, 0x76, 0xFF, 0xF7,
+    0xD4, 0x7A, 0xD6, 0x91, 0x65, 0xBD, 0x5A, 0x20, 0xA7, 0x2A, 0x95, 0xD6, 0xAB, 0x94, 0x44, 0x55,
+    0xC1, 0x45, 0x93, 0x07, 0xFD, 0x2D, 0x75, 0xDE, 0x94, 0x28, 0x59, 0xAF, 0x16, 0xCC, 0xE2, 0x6A,
+    0x2E, 0xF2, 0x94, 0x0E, 0x7A, 0x09, 0xA7, 0xB8, 0x6E, 0xD6, 0x2B, 0xCD, 0xD4, 0xFE, 0xA3, 0x68,
+    0x34, 0x83, 0x22, 0xE8, 0x25, 0xCE, 0x60, 0x82, 0x4B, 0xA5, 0xA7, 0xF0, 0x64, 0xDF, 0x1D, 0x48,
+    0x23, 0xC8, 0x4C, 0xD2, 0xDE, 0xC3, 0x4A, 0x83, 0x48, 0xA0, 0xEE, 0x28, 0x45, 0x34, 0x64, 0x5A,
+    0xAA, 0x2E, 0x58, 0x0C, 0xBE, 0x35, 0xFC, 0xB4, 0x78, 0xA7, 0x0B, 0x7E, 0xB0, 0x2E, 0x17, 0xAB,
+    0x93, 0x7A, 0x5B, 0xDF, 0x8E, 0xE6, 0xDB, 0x90, 0x88, 0x54, 0x50, 0x48, 0x04, 0xA6, 0x3C, 0x80,
+    0xF5, 0xAE, 0x81, 0x9B, 0x4C, 0x60, 0x42, 0x16, 0xC0, 0x36, 0xA5, 0x87, 0x13, 0x45, 0x0E, 0xCD,
+    0x00, 0xB6, 0xB1, 0x1E, 0x4E, 0xA8, 0xC1, 0x84, 0x74, 0x84, 0xA2, 0xB1, 0x1D, 0x44, 0xDC, 0xB3,
+    0x55, 0xD6, 0x27, 0xB1, 0xBC, 0x5A, 0x57, 0xD9, 0x8F, 0x46, 0x19, 0x29, 0xE5, 0x5B, 0xE2, 0x69,
+    0xC5, 0x46, 0x92, 0x39, 0x5E, 0x04, 0x9E, 0xED, 0xF6, 0xF0, 0xDB, 0xB0, 0x37, 0xF2, 0x6F, 0xEC,
+    0x7D, 0xB0, 0x5F, 0xE3, 0x7C, 0x08, 0xEA, 0xE7, 0x8D, 0x1E, 0x86, 0xBF, 0x77, 0xD1, 0x43, 0x04,
+    0x0A, 0x99, 0xC1, 0x35, 0xAA, 0xD6, 0x8A, 0x87, 0xBC, 0x53, 0x73, 0x3E, 0x88, 0xF8, 0x1B, 0x8B,
+    0x49, 0x6C, 0xFF, 0x5A, 0xD6, 0x65, 0x68, 0x51, 0xE9, 0x8B, 0xA7, 0x71, 0xF4, 0x0A, 0x4B, 0x88,
+    0xEA, 0x09, 0x27, 0x70, 0xAA, 0xC1, 0xC3, 0x1A, 0xA2, 0xC6, 0x0E, 0x67, 0xD2, 0xA8, 0xA1, 0xC3,
+    0x88, 0x19, 0x92, 0x88, 0x09, 0xA9, 0x88, 0x04, 0x23, 0x22, 0xBD, 0x79, 0x7B, 0xF3, 0x7C, 0x97,
+    0x05, 0xAC, 0xCF, 0x03, 0xD6, 0xE7, 0x3D, 0x85, 0xB7, 0x9D, 0x02, 0x43, 0x4E, 0x43, 0x5C, 0x65,
+    0x83, 0xC3, 0x55, 0xCA, 0x36, 0xA7, 0x2B, 0xCA, 0x91, 0x8C, 0x8B, 0xC3, 0xF9, 0x8F, 0xB3, 0x00,
+    0xEE, 0x4E, 0xB7, 0x78, 0x4A, 0x6E, 0x06, 0xF2, 0x7B, 0xFC, 0x97, 0x19, 0xEF, 0x65, 0x89, 0xF7,
+    0x2E, 0x86, 0x40, 0xB1, 0x84, 0x71, 0xED, 0x1A, 0xFF, 0x1D, 0xCE, 0x4F, 0x61, 0xFA, 0x70, 0x3C,
+    0x38, 0x1E, 0xE0, 0x09, 0xBF, 0xF4, 0x78, 0xEF, 0xD7, 0x9B, 0x89, 0x74, 0xBC, 0xBA, 0x8F, 0xF7,
+    0xC6, 0xB2, 0xC1, 0xC9, 0x4B, 0x03, 0xC9, 0x3C, 0x00, 0x89, 0xDB, 0xCB, 0x95, 0xC2, 0xE1, 0xD5,
+    0x2E, 0x14, 0x7D, 0x02, 0x90, 0xF3, 0xAB, 0x47, 0x0A, 0x9A, 0xFF, 0x2C, 0xA4, 0xE0, 0xDF, 0xAB,
+    0xE1, 0x5E, 0x81, 0x15, 0xF1, 0xBB, 0xBF, 0x4E, 0x07, 0x46, 0xB1, 0xAA, 0x90, 0x05, 0xC1, 0xD1,
+    0x79, 0xF9, 0x38, 0x00, 0xFF, 0x68, 0x01, 0xF5, 0xB9, 0xEE, 0x84, 0x34, 0xD6, 0x33, 0x66, 0xE0,
+    0x0C, 0x13, 0x94, 0xF4, 0x91, 0xBC, 0x27, 0x62, 0xBB, 0x24, 0x52, 0x74, 0x49, 0xC4, 0xF9, 0x24,
+    0x26, 0xE2, 0x11, 0x91, 0x86, 0x56, 0xEA, 0x6A, 0x85, 0x09, 0xEA, 0x9D, 0xFF, 0x37, 0xEF, 0x5C,
+    0xFF, 0x08, 0x94, 0x11, 0x90, 0x95, 0xBB, 0x92, 0x9D, 0x94, 0x24, 0x61, 0x7D, 0x49, 0x7B, 0x20,
+    0xDD, 0x25, 0x2C, 0xB2, 0xD9, 0xE8, 0x4B, 0x22, 0x02, 0xA9, 0xCC, 0xEA, 0x71, 0x1A, 0x19, 0xD5,
+    0x6B, 0xCE, 0xA5, 0x61, 0xC9, 0x6E, 0xAB, 0xA0, 0x90, 0x8A, 0xB2, 0x06, 0xCA, 0xBA, 0xE1, 0x56,
+    0x0D, 0x38, 0xD7, 0x10, 0x6B, 0xC0, 0x95, 0x3E, 0x19, 0x6B, 0xE0, 0xAC, 0xF0, 0x26, 0xB4, 0xC0,
+    0x54, 0xF8, 0xAC, 0x6B, 0x81, 0x68, 0x3B, 0xEB, 0x5B, 0x48, 0x46, 0xDB, 0x95, 0xD5, 0x0C, 0xE9,
+    0x60, 0xFB, 0x63, 0x66, 0x30, 0x21, 0x0F, 0x27, 0xCC, 0x90, 0x85, 0x3C, 0x8C, 0xCC, 0x90, 0xF7,
+    0xD9, 0x8F, 0x03, 0x13, 0xD8, 0xCE, 0xBC, 0xDB, 0x31, 0x81, 0xF5, 0x46, 0x3C, 0x13, 0x94, 0x8D,
+    0x91, 0x2A, 0x89, 0xE0, 0xAA, 0x54, 0x48, 0x22, 0x38, 0x92, 0x48, 0x12, 0xA1, 0x86, 0x91, 0x34,
+    0xC2, 0x19, 0xDC, 0x26, 0x8D, 0x24, 0x73, 0x05, 0x64, 0xF3, 0x35, 0xA7, 0x1E, 0x96, 0x84, 0x56,
+    0x02, 0xB0, 0x4B, 0x93, 0xD8, 0xA9, 0xBC, 0xD5, 0xAB, 0x39, 0xC8, 0xD3, 0x9C, 0x38, 0x2F, 0x3A,
+    0x0B, 0xE2, 0x73, 0xB0, 0x5E, 0xF1, 0x8F, 0x96, 0xA8, 0xD6, 0xD1, 0xFF, 0x4D, 0x21, 0x9E, 0x6C,
+    0x26, 0x97, 0x11, 0x23, 0x15, 0x46, 0x30, 0xE2, 0x49, 0xDE, 0xE9, 0x93, 0x77, 0x7A, 0xB8, 0x11,
+    0xB9, 0x3F, 0xC0, 0x33, 0x8E, 0x1B, 0x27, 0x60, 0x3F, 0xE9, 0xAF, 0x3A, 0x30, 0x7F, 0x3E, 0x94,
+    0xD6, 0x43, 0xB8, 0x69, 0xB3, 0x1E, 0x6E, 0x14, 0x5F, 0xFE, 0xE2, 0x00, 0xCF, 0x98, 0xEF, 0xF9,
+    0x13, 0xB0, 0xD5, 0xFD, 0xDE, 0x81, 0xF1, 0x2E, 0x58, 0x4F, 0x1A, 0xEC, 0x68, 0xC2, 0x87, 0x19,
+    0x4C, 0x24, 0x3E, 0xF3, 0x85, 0x13, 0x66, 0xEA, 0xF2, 0xCE, 0x8C, 0xA3, 0x90, 0xEF, 0x0A, 0xB6,
+    0xC9, 0xE4, 0x47, 0x42, 0x52, 0x31, 0xC7, 0x0B, 0x00, 0x17, 0x6E, 0x9E, 0x83, 0x13, 0x8B, 0xEA,
+    0x10, 0x54, 0xCC, 0xFC, 0x39, 0x68, 0xB1, 0xDB, 0x31, 0x41, 0x26, 0xD2, 0xA4, 0x22, 0x9D, 0xE6,
+    0x3E, 0xB5, 0x07, 0x0E, 0x8F, 0x19, 0x16, 0x36, 0xFA, 0x25, 0x7E, 0x99, 0xDF, 0x87, 0x5A, 0x06,
+    0x35, 0x83, 0x1E, 0x75, 0x87, 0x9E, 0x26, 0xAB, 0xD4, 0x38, 0xE9, 0x00, 0xDB, 0x99, 0xA0, 0x36,
+    0xE6, 0x92, 0x8A, 0x31, 0xA8, 0x31, 0xDE, 0xEF, 0x73, 0x11, 0x1E, 0x79, 0xE4, 0xE7, 0xA6, 0x78,
+    0x49, 0x5B, 0xC8, 0xD7, 0xB5, 0x4B, 0x85, 0xF3, 0x9D, 0xA0, 0xF1, 0x4A, 0x9D, 0xEC, 0xA8, 0x8E,
+    0xCE, 0xE9, 0x82, 0xD3, 0x2F, 0x81, 0xED, 0x6A, 0xB1, 0xAC, 0x0A, 0xCD, 0xFB, 0x5A, 0x8D, 0xA5,
+    0xC5, 0xA6, 0x73, 0x1E, 0xD2, 0x51, 0x75, 0xC4, 0xA2, 0xFB, 0x5B, 0xCD, 0x13, 0xA9, 0xB7, 0xDB,
+    0x3B, 0x3D, 0x38, 0xB5, 0x61, 0x0B, 0x0F, 0xA2, 0x23, 0x57, 0x85, 0x44, 0x3E, 0x60, 0x82, 0x06,
+    0x1C, 0x26, 0xF5, 0xFF, 0x65, 0x24, 0x13, 0xF9, 0x03, 0xCD, 0x85, 0xED, 0x0E, 0x7D, 0x93, 0x8B,
+    0x15, 0x1D, 0x59, 0xC7, 0xD7, 0x30, 0x23, 0x27, 0x20, 0x9C, 0x42, 0x21, 0x13, 0x9A, 0x8C, 0xC8,
+    0xD1, 0xED, 0xF3, 0x63, 0x3F, 0xE3, 0x1A, 0xA9, 0x8C, 0x91, 0x4C, 0x64, 0xC6, 0x4C, 0x99, 0x54,
+    0x26, 0x52, 0xFB, 0x34, 0x92, 0xF7, 0x49, 0xC4, 0x0C, 0xCC, 0x10, 0x71, 0x50, 0x53, 0x7A, 0xCA,
+    0xC6, 0xF6, 0x1A, 0x90, 0xC9, 0x03, 0x11, 0x13, 0xA9, 0x17, 0x7F, 0xEB, 0x87, 0xCD, 0x73, 0x43,
+    0xFA, 0x4E, 0xF7, 0xBF, 0x89, 0xF9, 0xD1, 0x10, 0x9D, 0x0C, 0x75, 0xCC, 0x65, 0x28, 0x26, 0xA4,
+    0x37, 0x91, 0xA4, 0x52, 0x47, 0x2A, 0x79, 0x39, 0xBD, 0x0D, 0x98, 0xC9, 0xA8, 0xA1, 0xFD, 0x09,
+    0xA9, 0x80, 0xDA, 0xB7, 0x6A, 0x6E, 0xDA, 0x86, 0x9F, 0xFA, 0x58, 0x94, 0xD0, 0xB2, 0x60, 0x29,
+    0x3A, 0x47, 0xBA, 0xAC, 0x6B, 0x8B, 0x9C, 0x4E, 0xCA, 0x21, 0x37, 0x55, 0x29, 0x3B, 0x9D, 0x9E,
+    0xF2, 0xD9, 0x25, 0x5F, 0x48, 0xD3, 0xD3, 0xBA, 0x42, 0xAD, 0xE3, 0x6C, 0xD0, 0x79, 0x99, 0x54,
+    0xE9, 0xB9, 0x06, 0x58, 0x5C, 0x84, 0x33, 0xF5, 0xCF, 0x9D, 0x4E, 0x4F, 0xA9, 0xDA, 0xBF, 0x78,
+    0x73, 0xFB, 0xDA, 0xA8, 0xF3, 0x22, 0xEA, 0xD9, 0x3B, 0x8F, 0x19, 0x20, 0x0F, 0xA4, 0x51, 0xA1,
+    0xEB, 0xA8, 0x11, 0x10, 0xA9, 0xA0, 0xBC, 0x9F, 0xC9, 0x4C, 0x22, 0xF2, 0x3D, 0x35, 0x22, 0x86,
+    0x5D, 0xA2, 0x77, 0x0D, 0xAE, 0x77, 0x1E, 0x3B, 0x14, 0x01, 0x33, 0xAE, 0xB9, 0x12, 0x8F, 0xB2,
+    0x65, 0x7F, 0x11, 0x4A, 0xF9, 0x03, 0xAF, 0xC0, 0x8A, 0xEB, 0xEA, 0x01, 0xE7, 0xB3, 0x48, 0xE9,
+    0x39, 0xA3, 0xF0, 0xB8, 0xCA, 0xF6, 0x58, 0x6F, 0x02, 0x59, 0x48, 0x23, 0xE9, 0xC8, 0xBC, 0x78,
+    0x5C, 0x2D, 0xD6, 0xE3, 0x7C, 0x16, 0x70, 0x21, 0x89, 0x3C, 0x33, 0x5E, 0xA8, 0xAB, 0xF2, 0x66,
+    0x5E, 0x04, 0x57, 0x7C, 0xEA, 0xAE, 0xC8, 0x73, 0xE2, 0x5B, 0xF9, 0x84, 0x74, 0x76, 0xC6, 0x79,
+    0x9E, 0x58, 0x7D, 0xDD, 0x8B, 0x9B, 0xCD, 0x66, 0xC3, 0x9A, 0xB7, 0xD4, 0xAB, 0x27, 0xB4, 0xDC,
+    0x79, 0x26, 0x7F, 0xF8, 0x79, 0x05, 0x34, 0xA5, 0x53, 0xF3, 0xD7, 0xBC, 0x1B, 0x34, 0x39, 0x2C,
+    0xFD, 0x9B, 0x48, 0xDA, 0x01, 0xC9, 0x38, 0x2F, 0x69, 0x90, 0x71, 0x45, 0xF0, 0x63, 0xB1, 0xA8,
+    0xCB, 0xD3, 0x5D, 0xF8, 0x69, 0xB5, 0xF4, 0x6B, 0xE4, 0xB5, 0xC5, 0xF7, 0x70, 0x0A, 0x76, 0xB8,
+    0x4A, 0x43, 0x15, 0x94, 0x55, 0xBE, 0xC6, 0xC5, 0x16, 0x99, 0xB7, 0xB2, 0xD8, 0x8E, 0xF6, 0xDB,
+    0x1B, 0x45, 0x05, 0x6C, 0x47, 0xE1, 0x49, 0x21, 0xEF, 0xC9, 0x03, 0x69, 0x4F, 0x16, 0x30, 0x23,
+    0xA8, 0xB0, 0xCC, 0x70, 0x82, 0x19, 0xA0, 0xAE, 0xA8, 0xC9, 0xA6, 0x8A, 0x5A, 0x44, 0x1A, 0x2B,
+    0x43, 0x2A, 0x22, 0xD2, 0x65, 0x12, 0x59, 0xB3, 0xB3, 0x9E, 0xEA, 0x79, 0xA1, 0x21, 0x95, 0x39,
+    0x97, 0x01, 0x2B, 0x22, 0xAF, 0x45, 0x5C, 0x5F, 0x4C, 0x49, 0x44, 0x30, 0x81, 0x98, 0xEA, 0x22,
+    0x6B, 0x06, 0x0A, 0x6F, 0xC6, 0xBC, 0xA7, 0xAC, 0x6C, 0xB0, 0x1E, 0x47, 0xEB, 0x4B, 0x4F, 0x9B,
+    0xCF, 0x38, 0xF5, 0x6C, 0x5C, 0x95, 0xCA, 0x0C, 0x0E, 0x23, 0xB7, 0xA1, 0xC6, 0x4E, 0x40, 0x4D,
+    0x39, 0x03, 0x75, 0x75, 0x53, 0x48, 0x42, 0xFD, 0xC6, 0xD8, 0x56, 0x45, 0xEF, 0x24, 0xD4, 0x22,
+    0x4D, 0x29, 0xBE, 0x94, 0x09, 0x3B, 0x93, 0x4B, 0x4F, 0x72, 0x0D, 0xAE, 0x3F, 0xA2, 0xE2, 0xBE,
+    0xCA, 0x07, 0xC1, 0x04, 0xAE, 0x82, 0x19, 0x88, 0xAB, 0x76, 0x4B, 0x55, 0xF4, 0x5B, 0x35, 0x34,
+    0x1E, 0x02, 0x17, 0x74, 0x2E, 0x0B, 0x11, 0x99, 0x97, 0x57, 0xDA, 0xED, 0x56, 0xD3, 0x91, 0x6F,
+    0xC0, 0x0C, 0x37, 0x60, 0x82, 0x17, 0x49, 0x26, 0xB8, 0xF6, 0x10, 0x66, 0xBD, 0xCF, 0xE1, 0xC9,
+    0x1E, 0x6C, 0x5F, 0x87, 0x7C, 0x75, 0x34, 0x87, 0x5D, 0x36, 0x56, 0x77, 0x10, 0xCC, 0xF5, 0x0B,
+    0xCE, 0x97, 0x82, 0x6B, 0xC8, 0x1A, 0xEA, 0x0A, 0xDB, 0xD0, 0x42, 0x59, 0x21, 0xE0, 0x38, 0x12,
+    0x11, 0xA1, 0x16, 0x91, 0x89, 0x56, 0xE4, 0x40, 0x93, 0xA7, 0x24, 0x0D, 0x5F, 0x25, 0x62, 0x29,
+    0xBC, 0xE9, 0x92, 0x29, 0x89, 0xD8, 0x59, 0x16, 0xDB, 0xFC, 0x1C, 0x66, 0x72, 0x34, 0x83, 0x91,
+    0x48, 0x32, 0xB7, 0x1D, 0xB7, 0x98, 0x29, 0x9A, 0xBC, 0x37, 0x81, 0x99, 0x53, 0x4A, 0x6F, 0x7D,
+    0x3E, 0xA4, 0xA3, 0x99, 0x70, 0xFF, 0x5C, 0x2A, 0xF3, 0xAE, 0x34, 0xD4, 0x52, 0x91, 0xDD, 0x5F,
+    0x96, 0xEA, 0x2C, 0x90, 0x50, 0x57, 0x7C, 0xCD, 0x44, 0x5A, 0x4A, 0x91, 0x0E, 0x91, 0xA0, 0x18,
+    0xA0, 0x12, 0xEF, 0xD7, 0x5F, 0x55, 0x00, 0x62, 0xB5, 0xF7, 0x8A, 0xB7, 0x13, 0xB5, 0x24, 0x5A,
+    0x6F, 0x3C, 0x48, 0x75, 0x61, 0x0D, 0x98, 0x28, 0x99, 0x94, 0x47, 0xCB, 0x7D, 0x0A, 0x88, 0xFA,
+    0xCE, 0xD9, 0xF0, 0xFE, 0xED, 0x76, 0xDB, 0xFA, 0x56, 0x44, 0xC4, 0x88, 0x88, 0xC4, 0xD2, 0x43,
+    0xD1, 0xCD, 0x40, 0x6B, 0x06, 0x30, 0x63, 0xE1, 0xA1, 0xF4, 0x35, 0x24, 0x73, 0x12, 0xA1, 0x08,
+    0x66, 0x20, 0x11, 0x6C, 0xA0, 0x0C, 0x14, 0xF7, 0x17, 0xCB, 0xB3, 0x5B, 0xAA, 0x16, 0x48, 0xAE,
+    0xED, 0x0B, 0x0B, 0xFA, 0x44, 0x64, 0xCC, 0xC6, 0x2C, 0xE6, 0x3E, 0x99, 0x8E, 0xD4, 0x70, 0x9B,
+    0xF5, 0xC6, 0x5E, 0x58, 0x62, 0xD5, 0xF7, 0xA6, 0x6C, 0x4E, 0x62, 0xD1, 0xA7, 0xA3, 0xAB, 0x4C,
+    0x38, 0xC3, 0xF6, 0x13, 0xA5, 0x9F, 0x69, 0xAB, 0xF6, 0xB9, 0x09, 0x27, 0x03, 0x85, 0x54, 0xCB,
+    0x45, 0x9F, 0xE4, 0x49, 0x48, 0xE7, 0x74, 0x02, 0x3B, 0xDA, 0x01, 0x5C, 0x57, 0x7B, 0x38, 0x55,
+    0xB7, 0xE9, 0xE1, 0xC7, 0xDF, 0x77, 0x12, 0xA9, 0x62, 0x28, 0x7C, 0x3E, 0xDA, 0x60, 0xA6, 0x2C,
+    0x72, 0xB6, 0xB3, 0xCE, 0x0E, 0x1F, 0x2F, 0xDC, 0x26, 0x95, 0x99, 0x4C, 0xA4, 0xCF, 0xC6, 0x2C,
+    0xA6, 0x81, 0xBA, 0xFA, 0x2C, 0xB6, 0x57, 0xD6, 0x4F, 0x66, 0x78, 0x4A, 0x1A, 0x5A, 0xE9, 0x53,
+    0xF9, 0x5F, 0x86, 0x6C, 0x4E, 0x62, 0x36, 0x72, 0x66, 0x06, 0x5C, 0x3A, 0xE2, 0x9A, 0x89, 0xD2,
+    0xBB, 0xA6, 0xEC, 0xF2, 0xA1, 0xEE, 0x10, 0xE9, 0x28, 0xA4, 0x3A, 0x10, 0xDB, 0x57, 0x78, 0x65,
+    0x71, 0xA9, 0xE2, 0xAA, 0xEA, 0xF2, 0x98, 0xEF, 0x3E, 0x2D, 0xE6, 0x05, 0xA6, 0xDF, 0x99, 0x89,
+    0xEF, 0xB1, 0xE6, 0xFD, 0xFF, 0x88, 0xEC, 0x7F, 0x0A, 0x91, 0xAD, 0x97, 0x81, 0xD9, 0xA1, 0xD0,
+    0xD1, 0x48, 0x3A, 0xEF, 0xF8, 0x80, 0x9F, 0xE5, 0xF1, 0x0F, 0x0F, 0x80, 0xE5, 0x15, 0x5E, 0x51,
+    0xF6, 0xCA, 0x62, 0x1E, 0x95, 0xBD, 0x4C, 0x6F, 0x1E, 0xE5, 0xA7, 0xCF, 0xBF, 0x02, 0x85, 0x48,
+    0x83, 0x13, 0xE9, 0xA9, 0xBF, 0xF2, 0xC2, 0xC0, 0x29, 0xD9, 0xA8, 0x86, 0xDB, 0x48, 0x1A, 0x19,
+    0x30, 0xE3, 0x5A, 0x33, 0xA5, 0x30, 0x64, 0xA7, 0x36, 0x8C, 0x91, 0x19, 0x32, 0x99, 0xD4, 0xDA,
+    0x07, 0xDA, 0x6E, 0x2D, 0x7C, 0xB1, 0x07, 0x2F, 0x4F, 0x83, 0x0D, 0x37, 0xA1, 0xEC, 0x04, 0x6A,
+    0xDF, 0x36, 0xA9, 0x50, 0x3F, 0x68, 0x27, 0x4A, 0x91, 0xC0, 0x91, 0xCC, 0xD5, 0x61, 0xC4, 0x61,
+    0x4A, 0x22, 0xAE, 0x77, 0xDE, 0x4C, 0x59, 0xC4, 0x35, 0xEE, 0x71, 0xD3, 0xF1, 0xD4, 0x3D, 0x28,
+    0x75, 0x21, 0xF6, 0x66, 0x4C, 0x66, 0xAE, 0x60, 0xFB, 0xA5, 0x82, 0xCA, 0x7A, 0x15, 0xD1, 0xA3,
+    0x49, 0xBD, 0x4C, 0x45, 0x94, 0xF2, 0x71, 0xF1, 0xCB, 0xD2, 0x98, 0x34, 0x94, 0xFE, 0x06, 0x66,
+    0xB4, 0x3D, 0x82, 0xFC, 0x61, 0xDB, 0x65, 0x22, 0x83, 0xEA, 0x88, 0xA4, 0x5A, 0xB0, 0xD3, 0x6B,
+    0x94, 0x22, 0x12, 0x10, 0x11, 0xF1, 0xD9, 0x83, 0xED, 0x6B, 0x91, 0xA2, 0xC1, 0x79, 0x4E, 0x30,
+    0x91, 0xB4, 0xC7, 0x79, 0xF2, 0x35, 0x5B, 0xD5, 0xEF, 0x02, 0xBA, 0xFA, 0x51, 0x53, 0x5B, 0xD4,
+    0x5E, 0x11, 0x0F, 0x24, 0xBB, 0xD4, 0xE5, 0x35, 0x7D, 0x21, 0x3B, 0x4C, 0xF1, 0xAB, 0x2C, 0xA4,
+    0x91, 0x13, 0x28, 0x7A, 0x33, 0x82, 0x60, 0x47, 0xCA, 0x81, 0x72, 0xBE, 0x23, 0x15, 0x4E, 0x24,
+    0x40, 0x21, 0xF7, 0x81, 0xE4, 0xFA, 0xBA, 0x70, 0x57, 0xA9, 0x88, 0xCC, 0x38, 0x11, 0xE9, 0xCC,
+    0x40, 0x36, 0xEA, 0x92, 0x9D, 0x37, 0x38, 0xCF, 0x57, 0x95, 0xF4, 0xAA, 0x5B, 0xDA, 0xDD, 0x8D,
+    0xE5, 0xFB, 0x40, 0x6F, 0x7D, 0x0F, 0xC8, 0x25, 0x00, 0xBF, 0x2B, 0x07, 0x37, 0x1D, 0x76, 0x6A,
+    0x58, 0xD7, 0x76, 0xCD, 0xA9, 0x51, 0x3F, 0x89, 0xF7, 0x81, 0xED, 0xD3, 0x9E, 0x34, 0xE2, 0x1A,
+    0xEA, 0xC6, 0x48, 0x55, 0x07, 0x0A, 0x91, 0x11, 0x9C, 0x4C, 0xC0, 0x93, 0x8B, 0x5E, 0x7B, 0xFF,
+    0x76, 0x5B, 0x2D, 0x5E, 0xA0, 0x3A, 0x45, 0x6B, 0x6A, 0xC9, 0xE5, 0xCD, 0xF5, 0xF7, 0x92, 0xB3,
+    0xCB, 0x9B, 0xEB, 0x5C, 0xDE, 0x5C, 0xDF, 0x01, 0x53, 0x99, 0xBA, 0x2F, 0x95, 0xA6, 0xE3, 0x8F,
+    0x7B, 0x04, 0x8B, 0x79, 0xA9, 0x00, 0x74, 0x95, 0x52, 0xB7, 0xE8, 0x48, 0x45, 0xA1, 0xAE, 0x54,
+    0x14, 0xEA, 0x4A, 0xFF, 0x46, 0x0F, 0x4C, 0x07, 0x3D, 0xD0, 0x0C, 0xAE, 0x81, 0xC2, 0x9B, 0x60,
+    0x3B, 0xC8, 0x83, 0x09, 0x8A, 0x89, 0x19, 0x4D, 0x7F, 0x9E, 0x17, 0xA0, 0xBB, 0x7E, 0x2E, 0x28,
+    0x76, 0xF7, 0x8D, 0x5E, 0xC3, 0x6E, 0xEF, 0xF4, 0x64, 0x01, 0x8C, 0xF4, 0x4B, 0xA0, 0x6E, 0x49,
+    0x3C, 0xAF, 0xBB, 0x05, 0xE4, 0xEB, 0x16, 0xA4, 0x6D, 0xC9, 0xBA, 0x7F, 0x6A, 0xAE, 0xC8, 0xE7,
+    0x8A, 0x5A, 0x46, 0x9C, 0x44, 0x4A, 0x99, 0x96, 0xCC, 0x80, 0xBF, 0xA3, 0x64, 0x9B, 0x0B, 0xB6,
+    0xCB, 0xBF, 0xFB, 0x25, 0x3F, 0xA7, 0x3F, 0x1A, 0xE3, 0x9A, 0x6C, 0x53, 0x49, 0x67, 0xA4, 0xB1,
+    0x61, 0xE7, 0x76, 0x1D, 0x35, 0x47, 0x8D, 0x72, 0xA6, 0x96, 0x0D, 0x9A, 0x79, 0xF1, 0x9F, 0xA4,
+    0x92, 0xA5, 0xDA, 0xA3, 0xAC, 0xDE, 0x63, 0xEA, 0x7E, 0x36, 0x60, 0x74, 0x75, 0xDA, 0xEB, 0x05,
+    0xEF, 0xAC, 0x17, 0x60, 0xB4, 0x5D, 0x80, 0xD1, 0x76, 0x01, 0x46, 0x4F, 0x97, 0x03, 0x4F, 0x17,
+    0x60, 0x74, 0xB2, 0x3D, 0x64, 0x81, 0x68, 0x14, 0xEF, 0x8C, 0x0B, 0x82, 0x1A, 0x97, 0x2B, 0x46,
+    0xC5, 0x3B, 0xFF, 0x2C, 0x2A, 0xDE, 0xF9, 0xA3, 0x51, 0x81, 0xD1, 0x69, 0x54, 0x7E, 0x5F, 0x72,
+    0xFC, 0x71, 0x4B, 0xBE, 0x7E, 0xB1, 0x18, 0xA9, 0xF9, 0xF0, 0x38, 0x60, 0xF4, 0xF6, 0x4F, 0x01,
+    0x46, 0x21, 0xEF, 0xAD, 0x27, 0x15, 0x33, 0x41, 0xD9, 0x3B, 0x4F, 0x1A, 0x7F, 0xAA, 0x6B, 0xF6,
+    0x77, 0x32, 0x8B, 0xC9, 0xCB, 0xC9, 0xCB, 0x40, 0xDB, 0xB4, 0xD5, 0x6A, 0xAC, 0x21, 0x89, 0x00,
+    0x79, 0x67, 0xBB, 0x9F, 0x72, 0xA7, 0x9F, 0x7F, 0x65, 0x2F, 0xA1, 0xAD, 0xC8, 0x00, 0xF5, 0x90,
+    0x48, 0x47, 0x31, 0x90, 0x0A, 0x59, 0x04, 0x3B, 0x2A, 0xC3, 0x7B, 0xE7, 0xC1, 0xC4, 0x6C, 0x64,
+    0xD1, 0xE6, 0xA4, 0x53, 0xD1, 0x03, 0xC5, 0x5F, 0x45, 0x20, 0x99, 0x9D, 0x07, 0x8A, 0x6F, 0x45,
+    0x20, 0x9D, 0xEA, 0x06, 0x70, 0xDF, 0xD0, 0x78, 0x5E, 0x5D, 0x01, 0xF5, 0x97, 0x47, 0x20, 0x0F,
+    0x75, 0x03, 0xCC, 0x59, 0x04, 0xCA, 0xCE, 0x79, 0xC8, 0xC6, 0x54, 0x05, 0xBA, 0x08, 0x50, 0x7B,
+    0xDA, 0x8E, 0x32, 0x60, 0xE4, 0x3F, 0xB6, 0x11, 0x72, 0x45, 0x42, 0x0A, 0xD1, 0xFC, 0x99, 0x6B,
+    0xFB, 0x3B, 0x9F, 0x92, 0x48, 0x3A, 0x9B, 0x88, 0x99, 0xB2, 0xF8, 0x1E, 0x7E, 0xF2, 0x0B, 0xF7,
+    0x96, 0x08, 0x43, 0x29, 0xE2, 0x69, 0x1B, 0xD7, 0x25, 0xB3, 0x56, 0x6F, 0xD8, 0x60, 0x03, 0x79,
+    0xB0, 0x1D, 0x79, 0x28, 0x3D, 0x79, 0x70, 0x0D, 0x79, 0x70, 0x15, 0xB6, 0xAF, 0x2B, 0x0D, 0xC1,
+    0x15, 0xBE, 0x06, 0xD7, 0xD4, 0x15, 0x2D, 0xAE, 0x49, 0xE6, 0xC5, 0xC1, 0xBE, 0xDF, 0x06, 0xAC,
+    0x66, 0x2D, 0x8D, 0x7B, 0xD8, 0x48, 0x69, 0xD9, 0x1E, 0xD2, 0xF2, 0xFE, 0x63, 0x69, 0xE9, 0x56,
+    0x5A, 0x0E, 0x3B, 0x5A, 0x26, 0x0F, 0xD1, 0xF2, 0xCD, 0xED, 0x76, 0x7B, 0xE7, 0x5B, 0x22, 0x22,
+    0x32, 0xD5, 0x22, 0x22, 0xF2, 0x8D, 0x61, 0x4F, 0x4B, 0xF7, 0xE5, 0x61, 0x4F, 0x4B, 0x59, 0xA6,
+    0x64, 0xA1, 0xE5, 0xF4, 0x38, 0x5A, 0xBE, 0x79, 0x8E, 0x96, 0xF7, 0x0F, 0x68, 0xF9, 0xBB, 0xF7,
+    0xC0, 0x4A, 0xD4, 0x2C, 0xD8, 0xB2, 0xCF, 0xC6, 0x64, 0x22, 0x0B, 0xB6, 0xC3, 0x76, 0x67, 0xE0,
+    0x9E, 0x0D, 0x30, 0x95, 0x0D, 0x66, 0x10, 0x11, 0xF9, 0x96, 0x88, 0x48, 0xE1, 0x49, 0x63, 0x0D,
+    0xF6, 0xCF, 0x22, 0xD4, 0x59, 0xC0, 0x8C, 0xB6, 0xA3, 0xF4, 0xCE, 0x9B, 0x48, 0xFD, 0xED, 0xD6,
+    0xD3, 0xCA, 0x08, 0xB5, 0xEC, 0x96, 0xF6, 0xFF, 0x0C, 0xCE, 0xFC, 0x07, 0x46, 0x4D, 0x85, 0x30,
+    0x92, 0xA8, 0x7A, 0xC2, 0xCC, 0x26, 0xBE, 0x87, 0x9A, 0xF8, 0xDD, 0x95, 0x33, 0x0B, 0xE5, 0xCC,
+    0xA2, 0x4F, 0x26, 0xB2, 0x60, 0x06, 0xCC, 0x90, 0xF7, 0x98, 0xC1, 0x7A, 0xCC, 0x50, 0x36, 0x98,
+    0xC1, 0x89, 0xC8, 0xE0, 0x44, 0x24, 0xD4, 0x90, 0x87, 0x9A, 0x73, 0xEC, 0xE9, 0x2A, 0x5A, 0x9C,
+    0x37, 0x91, 0xE2, 0xED, 0x17, 0xC2, 0xEA, 0x80, 0x4D, 0xBB, 0x64, 0x8E, 0x8F, 0xF0, 0x11, 0x94,
+    0xDB, 0x13, 0x49, 0x05, 0xCA, 0x50, 0x06, 0x18, 0x93, 0xC7, 0x2D, 0x42, 0xFF, 0xF5, 0x7F, 0x84,
+    0x44, 0x64, 0x06, 0x27, 0x12, 0xC9, 0xEE, 0x6F, 0x24, 0x70, 0x46, 0x22, 0x95, 0xF5, 0x64, 0x91,
+    0x08, 0xAE, 0xB3, 0x15, 0xC9, 0xCC, 0x87, 0x57, 0x67, 0x5F, 0xF6, 0xE6, 0x83, 0xC0, 0x76, 0x7B,
+    0x27, 0x50, 0x8A, 0xCC, 0xA4, 0x0B, 0x4C, 0xB4, 0x64, 0x6D, 0x7A, 0x0E, 0x8B, 0xD5, 0x28, 0xFA,
+    0xA7, 0xC1, 0xC4, 0xAC, 0x5B, 0x96, 0x19, 0xD7, 0xE7, 0x23, 0xC5, 0x48, 0xFD, 0xA0, 0xD5, 0x53,
+    0x21, 0x93, 0xB9, 0x5A, 0x0D, 0x1F, 0x8D, 0x3A, 0xA5, 0x23, 0xAE, 0xAB, 0xBD, 0x89, 0x79, 0x54,
+    0xA8, 0xEC, 0xBD, 0x0D, 0xC4, 0xF4, 0x7E, 0x2A, 0x5C, 0x25, 0x0F, 0xA6, 0xA2, 0xAE, 0x16, 0xC3,
+    0xC6, 0x35, 0x60, 0x46, 0xAC, 0x48, 0x95, 0x88, 0x0C, 0x5C, 0xBC, 0x56, 0xAF, 0xD6, 0xED, 0x19,
+    0x0D, 0xB6, 0xBB, 0xAA, 0x39, 0x08, 0x2D, 0xF5, 0xB7, 0xDB, 0xCE, 0x88, 0x04, 0xF2, 0x9D, 0x81,
+    0xC8, 0xEF, 0x6C, 0xB7, 0xBA, 0x9A, 0xC7, 0xBD, 0x8D, 0xA3, 0x19, 0x80, 0x8F, 0x79, 0x24, 0x9B,
+    0x0D, 0x17, 0x37, 0xD7, 0x4B, 0x99, 0xA8, 0x25, 0xB4, 0xD2, 0x25, 0x22, 0x55, 0xA9, 0x39, 0xD9,
+    0xCE, 0x93, 0xC4, 0x15, 0xCB, 0x4D, 0x27, 0x38, 0x83, 0x4C, 0xD1, 0x29, 0x5D, 0x1E, 0x28, 0x7D,
+    0x32, 0x02, 0xB5, 0x02, 0xEE, 0x13, 0xA7, 0x80, 0x19, 0xB3, 0x1E, 0xC8, 0x83, 0xE6, 0x77, 0xBE,
+    0xA1, 0x96, 0xDA, 0xA7, 0x1A, 0x80, 0xB3, 0x13, 0xB5, 0xB7, 0xBA, 0x03, 0x04, 0x74, 0x09, 0xE4,
+    0xE9, 0xF2, 0xAD, 0x33, 0x7E, 0x5B, 0xAB, 0x09, 0xFF, 0x52, 0xAD, 0x56, 0x5D, 0xE0, 0xDA, 0x25,
+    0x1B, 0xBD, 0x39, 0xAC, 0x55, 0x86, 0x5C, 0xC4, 0xAF, 0x99, 0xAC, 0xF9, 0xC1, 0x5A, 0xF8, 0xE8,
+    0x40, 0x5F, 0x21, 0xED, 0x29, 0x27, 0xB2, 0x88, 0x13, 0x4C, 0x24, 0x69, 0x2B, 0x8D, 0x9E, 0x25,
+    0x11, 0x9C, 0x4F, 0x22, 0x14, 0x3E, 0x19, 0xC1, 0x76, 0xE9, 0x00, 0xB6, 0x37, 0x01, 0xF2, 0xDE,
+    0xF4, 0x90, 0x85, 0xDC, 0x83, 0x09, 0xB6, 0x01, 0x13, 0x4A, 0xC0, 0x84, 0x63, 0xC0, 0x84, 0x13,
+    0xC0, 0x84, 0x01, 0x48, 0x7F, 0x12, 0x00, 0xF3, 0x8E, 0x07, 0x8C, 0x54, 0xBB, 0x01, 0x1E, 0x02,
+    0x09, 0x1A, 0x97, 0x70, 0xBB, 0x1C, 0xCB, 0xE3, 0x3B, 0x61, 0x4D, 0x77, 0xC5, 0x69, 0x2D, 0xE5,
+    0x02, 0x6F, 0x3F, 0xC9, 0x93, 0x40, 0x22, 0x8B, 0xCF, 0x69, 0x47, 0xC0, 0x75, 0xAE, 0x03, 0x6E,
+    0x3E, 0x1E, 0xDA, 0xD0, 0xB4, 0x96, 0xCB, 0x9B, 0x6B, 0xAD, 0x0C, 0x89, 0xC8, 0xD7, 0x45, 0xAA,
+    0x4C, 0x26, 0x5A, 0x2D, 0x10, 0x54, 0xC4, 0xD7, 0x44, 0x70, 0x15, 0xF9, 0x40, 0x3A, 0x42, 0xD1,
+    0x61, 0x35, 0xB9, 0x7B, 0x02, 0x5A, 0xB2, 0x1E, 0x92, 0x88, 0x03, 0xCC, 0x90, 0x0E, 0x80, 0xED,
+    0x8B, 0x06, 0x28, 0xBD, 0x9A, 0xE5, 0xDA, 0x77, 0x63, 0x3A, 0x06, 0x48, 0x1F, 0x04, 0xB5, 0xA1,
+    0xAB, 0x83, 0x98, 0xC3, 0x12, 0x5B, 0x3A, 0xDD, 0x47, 0x91, 0x52, 0x15, 0x01, 0xFB, 0xE5, 0xC0,
+    0x9A, 0xDC, 0x49, 0xBA, 0x24, 0x1C, 0xEB, 0xFC, 0x3F, 0x04, 0xFC, 0x65, 0x41, 0xEB, 0x5D, 0xCA,
+    0x00, 0x45, 0x70, 0x3D, 0xD8, 0xAE, 0xFC, 0x2F, 0x66, 0x5A, 0x49, 0x75, 0xBC, 0x37, 0x29, 0x81,
+    0x7C, 0x34, 0x13, 0x20, 0x5D, 0x1D, 0xA0, 0x98, 0x72, 0x81, 0x54, 0x9A, 0xB6, 0x03, 0xDB, 0x67,
+    0x23, 0xF0, 0x71, 0x3E, 0xF8, 0xF0, 0x80, 0x37, 0x9B, 0x2A, 0xD9, 0x6C, 0x72, 0x91, 0xAA, 0x90,
+    0x58, 0xCA, 0x40, 0x2D, 0x5D, 0xAE, 0x35, 0xA6, 0x36, 0x40, 0xBD, 0x43, 0xF5, 0xDB, 0x8A, 0xB2,
+    0x21, 0x99, 0xD6, 0xB6, 0x1D, 0xEA, 0x56, 0x70, 0x0B, 0xF5, 0x32, 0x00, 0xA7, 0x36, 0xF3, 0xAC,
+    0x79, 0x05, 0x71, 0x49, 0xAA, 0x55, 0x58, 0xE0, 0x5B, 0x1A, 0x79, 0xB8, 0xA3, 0x10, 0xC5, 0x70,
+    0x20, 0x7B, 0x0B, 0x26, 0xB4, 0x00, 0x2E, 0xB7, 0x00, 0x7E, 0x2B, 0x5B, 0x30, 0x05, 0x76, 0x7E,
+    0x1B, 0xA5, 0xDA, 0xE5, 0x4B, 0x53, 0x86, 0x27, 0x76, 0xF7, 0xFF, 0x3E, 0x3E, 0x0C, 0x14, 0x9C,
+    0x00, 0xEE, 0x8B, 0x13, 0x20, 0x26, 0x42, 0x3A, 0xD9, 0x01, 0xB2, 0xB1, 0xEC, 0xC0, 0x76, 0xAE,
+    0x82, 0xA2, 0xBA, 0x01, 0x5C, 0xE0, 0xC3, 0xFF, 0xC0, 0xE5, 0xF8, 0x23, 0x2A, 0xB9, 0x1E, 0x8A,
+    0xA1, 0x18, 0x50, 0xC4, 0x03, 0x22, 0xE3, 0xE3, 0x7D, 0xCC, 0xBF, 0xCF, 0x79, 0x00, 0x07, 0x39,
+    0xEC, 0x3B, 0xF4, 0x6A, 0x52, 0xD8, 0x84, 0x32, 0xB8, 0x6E, 0x91, 0xDE, 0xC7, 0x5A, 0x4B, 0x15,
+    0x97, 0x8D, 0x04, 0xCA, 0x37, 0x64, 0xC4, 0x76, 0x9A, 0x05, 0xE0, 0xAA, 0x24, 0x6A, 0x02, 0xC6,
+    0xEE, 0x1F, 0x1D, 0xB5, 0x56, 0x73, 0x15, 0x51, 0xFB, 0xE4, 0x68, 0x1E, 0xC0, 0xD1, 0xFD, 0x85,
+    0x3D, 0x81, 0x34, 0x5E, 0x00, 0x66, 0x0B, 0xB8, 0xE7, 0x3D, 0x58, 0xF1, 0x6B, 0x9C, 0x53, 0x1A,
+    0xD6, 0x14, 0xBF, 0xCD, 0xE6, 0xFA, 0x41, 0xF8, 0x60, 0x3A, 0x08, 0x1F, 0x44, 0x34, 0x24, 0xC8,
+    0x04, 0x23, 0xC9, 0x04, 0x9A, 0xE4, 0xA5, 0xFA, 0xB1, 0x3A, 0x1F, 0x3E, 0x08, 0x07, 0xB3, 0x1E,
+    0xF6, 0xC9, 0x77, 0x8F, 0x0D, 0x1F, 0xEC, 0x5E, 0xB5, 0x52, 0xAC, 0x65, 0x67, 0x7B, 0x1C, 0xC9,
+    0x3D, 0xCD, 0x2F, 0x5E, 0xCB, 0x23, 0x77, 0x74, 0x9D, 0xF6, 0xC9, 0x2A, 0xBA, 0xF8, 0x69, 0x45,
+    0x89, 0xA2, 0x74, 0x1A, 0xB9, 0x4E, 0x1A, 0x80, 0xF7, 0xDF, 0x27, 0xD3, 0x10, 0x84, 0x19, 0x4C,
+    0xFC, 0x00, 0xD9, 0x70, 0x69, 0x17, 0x6A, 0x0D, 0xA4, 0x02, 0x75, 0x8F, 0x1D, 0x49, 0x44, 0x93,
+    0x64, 0x66, 0xC8, 0x03, 0xBF, 0xE5, 0x7C, 0x12, 0xA4, 0x2A, 0xBE, 0x24, 0xAF, 0x45, 0x23, 0x73,
+    0x30, 0xF2, 0x1D, 0xCF, 0xB5, 0x72, 0x29, 0xDF, 0x09, 0xCA, 0xCA, 0xB5, 0x8E, 0x70, 0xDF, 0xAE,
+    0xE9, 0x23, 0x7C, 0x64, 0x4D, 0x16, 0x58, 0x54, 0x7A, 0x11, 0x96, 0x56, 0x16, 0x79, 0x5C, 0x1B,
+    0xF7, 0x3C, 0xDE, 0x3C, 0x7B, 0xD8, 0xEB, 0xDE, 0x65, 0x1D, 0xB3, 0xF3, 0xBB, 0x77, 0x8E, 0xB7,
+    0x42, 0xED, 0xB2, 0x52, 0xCC, 0x35, 0xEC, 0x93, 0x92, 0x76, 0x79, 0x64, 0x07, 0x5D, 0x05, 0xA6,
+    0xDD, 0xD1, 0x1C, 0x1E, 0xFD, 0xFD, 0xF5, 0x68, 0x91, 0x4E, 0x8F, 0x16, 0x91, 0x25, 0x8B, 0x69,
+    0xD3, 0x86, 0xE5, 0xE8, 0x74, 0xD6, 0x46, 0x05, 0x1D, 0xCE, 0x2F, 0x69, 0x47, 0x79, 0x58, 0xAE,
+    0x9D, 0xAA, 0xC7, 0x3E, 0x43, 0xBB, 0x82, 0x00, 0x3A, 0xF2, 0xA2, 0xC3, 0xF6, 0xCB, 0xD1, 0x36,
+    0x18, 0x75, 0xC6, 0x8B, 0x21, 0x99, 0xE0, 0x48, 0xB6, 0xED, 0x90, 0x68, 0xB6, 0xB3, 0xF4, 0x8B,
+    0x3F, 0x3E, 0x9F, 0x73, 0xC8, 0x0F, 0x1E, 0x85, 0x2F, 0xAB, 0x1D, 0xB6, 0x9B, 0xE9, 0x7A, 0x6E,
+    0xBB, 0xB2, 0x79, 0x2F, 0xF2, 0x1D, 0xBD, 0x0C, 0x3C, 0x91, 0x49, 0x0F, 0xE9, 0x58, 0x8A, 0x66,
+    0x13, 0x4C, 0x9A, 0x2A, 0x10, 0x20, 0x89, 0x14, 0x1E, 0xF2, 0xC0, 0x99, 0xB6, 0x7C, 0x09, 0x17,
+    0x61, 0xC2, 0xFE, 0x50, 0x1A, 0x13, 0xA8, 0x45, 0x9A, 0xC2, 0xA7, 0xF3, 0x27, 0x84, 0x33, 0x6C,
+    0xC7, 0x64, 0x06, 0x9C, 0x7A, 0x42, 0x11, 0xDB, 0xD5, 0x64, 0x01, 0x97, 0xC6, 0x0B, 0x85, 0x4F,
+    0x62, 0xDE, 0x07, 0x87, 0xED, 0xDC, 0xF3, 0x5E, 0xD2, 0x19, 0x89, 0x89, 0x48, 0x67, 0xC4, 0x27,
+    0x32, 0x92, 0x8F, 0xF0, 0xC4, 0x2F, 0x55, 0xA4, 0x2E, 0x7E, 0xE6, 0xED, 0x8D, 0x46, 0x68, 0xD7,
+    0xD7, 0x5F, 0x54, 0xA4, 0x6E, 0xAB, 0x48, 0x55, 0x68, 0x8F, 0xAB, 0x5D, 0xAF, 0x0F, 0xD5, 0xCE,
+    0x1A, 0x8A, 0x2F, 0x2A, 0xE0, 0x23, 0x35, 0x3B, 0xC5, 0xEC, 0x46, 0x80, 0x27, 0xDF, 0x43, 0xA4,
+    0x2E, 0x20, 0xBC, 0x6E, 0x43, 0x32, 0x0B, 0x48, 0x8F, 0x9D, 0x48, 0x64, 0xA2, 0xE8, 0x4F, 0x98,
+    0xA9, 0x72, 0x0D, 0x9B, 0xFF, 0x1B, 0xA9, 0xF2, 0x3F, 0x97, 0x37, 0xE5, 0x25, 0x91, 0x39, 0x95,
+    0x71, 0xE4, 0xBA, 0xE9, 0xB4, 0x42, 0xFB, 0x06, 0x98, 0x9E, 0xE3, 0x96, 0x44, 0xC2, 0x6A, 0xE2,
+    0xFC, 0x83, 0x2B, 0xC8, 0xAC, 0xB5, 0x20, 0xD3, 0x44, 0xC5, 0xCE, 0x4B, 0x8F, 0xC8, 0xB0, 0x4B,
+    0xA9, 0x5B, 0xC2, 0x12, 0xBB, 0x96, 0x09, 0x0D, 0xC0, 0x67, 0x35, 0x16, 0x63, 0xFF, 0x7A, 0x5E,
+    0x20, 0xD5, 0x86, 0xB5, 0x7B, 0xCD, 0x9A, 0x82, 0xFC, 0x2B, 0x29, 0xC8, 0x04, 0x13, 0x5C, 0xC3,
+    0x87, 0x5D, 0xD5, 0x82, 0x8C, 0xC9, 0x84, 0x91, 0xC6, 0x8C, 0xD8, 0x81, 0x3C, 0x70, 0x71, 0xD7,
+    0x69, 0xE3, 0xA0, 0xDE, 0x3C, 0x00, 0x55, 0xD1, 0x80, 0x6D, 0x22, 0x50, 0x4B, 0x07, 0x28, 0x7E,
+    0xD3, 0x56, 0xBF, 0xD2, 0xD9, 0x4A, 0x36, 0xF5, 0xFD, 0xCD, 0x12, 0x92, 0x1A, 0xB4, 0xEE, 0x58,
+    0x7E, 0x89, 0xE5, 0xB3, 0xD5, 0x52, 0x3E, 0x5B, 0x69, 0xF9, 0xEC, 0xF0, 0x0B, 0x51, 0x3C, 0xD9,
+    0xCA, 0x9B, 0x2F, 0xAF, 0x1D, 0x54, 0xEC, 0xF4, 0x9E, 0x14, 0x4F, 0x2A, 0x19, 0x13, 0x11, 0x23,
+    0x8D, 0x91, 0xC1, 0x0E, 0x64, 0x13, 0x17, 0x21, 0x81, 0xD7, 0xFE, 0xAF, 0x73, 0x0F, 0x2E, 0x5D,
+    0xF8, 0xC2, 0x07, 0xAF, 0xBE, 0x68, 0xFB, 0xAC, 0x2B, 0x86, 0xFF, 0xE1, 0xFF, 0xF9, 0xAF, 0xFE,
+    0x47, 0xD3, 0xFC, 0xBC, 0xFF, 0x2D, 0xEB, 0xFA, 0x8B, 0x90, 0xF4, 0x9A, 0xD9, 0x65, 0xD3, 0xED,
+    0x36, 0x3A, 0x91, 0xBB, 0x15, 0xE1, 0x63, 0x7C, 0xDC, 0x54, 0x1F, 0xE2, 0x63, 0x59, 0x63, 0xAA,
+    0x6B, 0x7C, 0x0C, 0x4C, 0xC5, 0x2F, 0xEF, 0x2D, 0x59, 0x52, 0xAF, 0xD2, 0x0E, 0xBE, 0x06, 0x57,
+    0xC1, 0x82, 0x79, 0xB0, 0xFD, 0x13, 0x27, 0xE2, 0xBF, 0xCA, 0x6F, 0xA6, 0x5D, 0xE2, 0xF3, 0xEA,
+    0x37, 0xF9, 0x68, 0xE2, 0xB9, 0xF6, 0x9B, 0x90, 0x78, 0xF8, 0xA5, 0xBE, 0x5D, 0xB8, 0xBC, 0xA9,
+    0x6A, 0x99, 0x6B, 0x99, 0x9D, 0x4C, 0x87, 0x9F, 0xD7, 0x64, 0x97, 0x59, 0x44, 0xE4, 0xFB, 0x6B,
+    0xFA, 0x0B, 0xBB, 0x1C, 0x98, 0xF3, 0x8F, 0x07, 0xDB, 0xF5, 0x71, 0x99, 0xCB, 0xB6, 0x2B, 0xEE,
+    0x0E, 0x59, 0x98, 0x92, 0xE8, 0xAA, 0xFA, 0x6F, 0xF1, 0x1F, 0x5F, 0x7F, 0x39, 0x7D, 0x79, 0x49,
+    0xAA, 0x5E, 0x1E, 0x6F, 0x6E, 0xB7, 0x0A, 0x59, 0x3C, 0x74, 0xDF, 0x9B, 0xCD, 0x66, 0x73, 0x9D,
+    0xCF, 0x99, 0xC9, 0xCC, 0x66, 0x4A, 0xA3, 0x89, 0x66, 0xC8, 0x82, 0xF5, 0x65, 0x75, 0x93, 0xDF,
+    0x02, 0xDC, 0xB3, 0x62, 0x07, 0xE7, 0x67, 0x33, 0x66, 0xC1, 0xFA, 0xA2, 0x71, 0x1C, 0x03, 0x9F,
+    0xE3, 0x65, 0x33, 0xE5, 0xD1, 0xCC, 0x59, 0x34, 0x93, 0x89, 0x69, 0x34, 0xD1, 0x44, 0x33, 0x98,
+    0x21, 0x0B, 0x59, 0xB0, 0x9D, 0xF5, 0x45, 0x53, 0x56, 0x8E, 0x9B, 0x9C, 0xF0, 0x5B, 0x7C, 0x76,
+    0xB1, 0x7C, 0x6F, 0x19, 0x31, 0xB3, 0x1D, 0xCA, 0xE0, 0x7C, 0x5B, 0xCD, 0x49, 0x34, 0xA3, 0x19,
+    0xD6, 0xA3, 0x8B, 0xC6, 0xE1, 0x38, 0xE6, 0x78, 0xAD, 0xF2, 0x7A, 0x5D, 0xCD, 0x91, 0x74, 0xE9,
+    0x86, 0x68, 0xC2, 0xF2, 0xEC, 0x71, 0x7F, 0xF4, 0xD7, 0xA7, 0xAD, 0xC8, 0xD4, 0x8A, 0xC4, 0x57,
+    0x72, 0xFF, 0x39, 0x6C, 0xA3, 0x8B, 0x42, 0x51, 0x69, 0xCA, 0xBD, 0x5B, 0x9E, 0xB7, 0x96, 0x6C,
+    0xD6, 0x49, 0x75, 0x52, 0x12, 0x35, 0xF9, 0xD2, 0x8C, 0x40, 0xB5, 0x96, 0x6F, 0xA5, 0x71, 0x59,
+    0x08, 0xB5, 0x1D, 0xDE, 0xAA, 0xB9, 0x8E, 0xC1, 0xFD, 0xD1, 0x5F, 0x9F, 0xE6, 0x22, 0xD2, 0xB5,
+    0x22, 0xF1, 0xFD, 0x55, 0x3C, 0xAA, 0xB0, 0x7E, 0x39, 0x61, 0xC1, 0x8E, 0x54, 0x55, 0x65, 0x41,
+    0x7F, 0xEC, 0x89, 0xAC, 0x7B, 0x22, 0x9F, 0x67, 0xF1, 0x22, 0x12, 0xED, 0xFD, 0xFB, 0x6D, 0x83,
+    0xAD, 0x16, 0x53, 0xD3, 0x55, 0xCB, 0x85, 0xEB, 0xD5, 0xD0, 0x3D, 0x03, 0xB8, 0x96, 0xCA, 0x17,
+    0x25, 0xC8, 0xE4, 0xE4, 0x53, 0xF2, 0x75, 0xE9, 0xCB, 0x4E, 0x8B, 0xC8, 0xB2, 0x01, 0xEA, 0x9E,
+    0x4C, 0x7A, 0x6A, 0xE9, 0x33, 0x91, 0xBE, 0x16, 0xF9, 0x86, 0x48, 0xAC, 0x65, 0xCA, 0x64, 0xA2,
+    0x9E, 0xC8, 0xA6, 0xA5, 0x39, 0x0A, 0x1C, 0x3D, 0x3B, 0xD7, 0xEF, 0x88, 0xEB, 0xAE, 0xBD, 0xBF,
+    0x4A, 0x5E, 0x16, 0xCA, 0x1F, 0xC6, 0x44, 0xDA, 0x90, 0x4D, 0x42, 0xD1, 0x5F, 0xE3, 0x09, 0x8A,
+    0xBB, 0x73, 0xFD, 0xCE, 0x5C, 0x36, 0x8F, 0x91, 0xED, 0xE6, 0xF3, 0xF1, 0x4A, 0xF6, 0x77, 0x27,
+    0xDB, 0xB7, 0x7F, 0xDB, 0x4D, 0xE6, 0x6F, 0x47, 0xB6, 0xF9, 0x6D, 0x38, 0x23, 0x95, 0x26, 0xFF,
+    0x57, 0xFD, 0x47, 0x9F, 0x7E, 0xF1, 0x0B, 0x4F, 0x7F, 0xF0, 0xDA, 0xD3, 0x17, 0x79, 0x9A, 0x5F,
+    0xF2, 0xFF, 0xC0, 0xA5, 0x4B, 0x70, 0xE5, 0xA3, 0x60, 0xF3, 0x0A, 0xF3, 0xF5, 0x0E, 0x86, 0xAF,
+    0x7D, 0x7E, 0x1B, 0x3F, 0xDA, 0x4A, 0xFC, 0xE8, 0x57, 0x09, 0x5F, 0xFB, 0xAA, 0xF9, 0x7A, 0xF7,
+    0x55, 0x9B, 0x57, 0x5F, 0xBD, 0xF2, 0x51, 0xBE, 0x7A, 0xE9, 0x12, 0x5F, 0x85, 0x5F, 0xD9, 0x13,
+    0x80, 0x0B, 0x17, 0xE0, 0xC5, 0x2B, 0x24, 0x7D, 0x20, 0x7B, 0xC9, 0xF3, 0x21, 0x0B, 0x2F, 0xBA,
+    0xED, 0xAB, 0x2F, 0x3A, 0x99, 0x3F, 0x64, 0xF9, 0x40, 0xF6, 0x92, 0xFF, 0x40, 0xD2, 0x87, 0x0F,
+    0xF0, 0xE2, 0x95, 0x0F, 0x70, 0xE1, 0xC2, 0x07, 0x80, 0x5F, 0xE5, 0xF3, 0xA1, 0xEC, 0x8C, 0x6B,
+    0xFB, 0xBA, 0xCE, 0x62, 0xDE, 0x67, 0x49, 0xB7, 0xD2, 0xAC, 0xB5, 0x06, 0xE9, 0x68, 0xFD, 0xE2,
+    0x20, 0x92, 0xF5, 0x59, 0xBF, 0xA6, 0x1D, 0x5B, 0x9F, 0xF5, 0x6B, 0x0B, 0x80, 0xB2, 0x32, 0xFD,
+    0xDA, 0xB1, 0xC2, 0x61, 0xFA, 0xD5, 0x67, 0x72, 0x64, 0xFD, 0x92, 0xBD, 0xC2, 0x2D, 0xF2, 0x6E,
+    0x81, 0x53, 0xB8, 0x85, 0xF5, 0x6B, 0xBF, 0x98, 0x5B, 0x14, 0xCD, 0x31, 0x17, 0x2B, 0xB8, 0xCC,
+    0x31, 0x8E, 0x88, 0x0C, 0x18, 0xE9, 0x1C, 0x53, 0x3A, 0x64, 0x12, 0x29, 0x24, 0x94, 0x6F, 0x0D,
+    0x59, 0x57, 0xF8, 0x33, 0xEA, 0x74, 0xCC, 0xA5, 0xB3, 0xDE, 0xE1, 0x88, 0xC4, 0xE4, 0x55, 0x4A,
+    0x4E, 0x71, 0xE9, 0x40, 0x04, 0x4E, 0x89, 0x94, 0x26, 0x70, 0x02, 0xC9, 0x98, 0x0C, 0xB8, 0xAC,
+    0xE3, 0x04, 0x4C, 0x48, 0x03, 0x2E, 0xF7, 0x44, 0xC8, 0x3B, 0x13, 0x38, 0xB6, 0x9E, 0x11, 0xCA,
+    0xC6, 0x04, 0x6E, 0x5A, 0x9F, 0x0C, 0x50, 0x63, 0x02, 0xD1, 0x7A, 0x13, 0x20, 0x62, 0x42, 0x3A,
+    0x58, 0x9F, 0x77, 0xA4, 0x03, 0xC9, 0x98, 0x85, 0xAC, 0x5F, 0x0C, 0x11, 0x69, 0xBD, 0x99, 0x65,
+    0x69, 0x40, 0x31, 0x6B, 0x50, 0xB3, 0xA8, 0x34, 0x5F, 0xF7, 0xC9, 0x6A, 0x2D, 0x3B, 0x5C, 0x1F,
+    0xAF, 0x33, 0x27, 0xB3, 0x89, 0xD9, 0x68, 0x83, 0xED, 0x4B, 0xEF, 0xB8, 0xB9, 0x54, 0x0C, 0x00,
+    0xAF, 0x13, 0x98, 0xD3, 0x98, 0xCC, 0x26, 0x9A, 0x98, 0x8D, 0xD9, 0x68, 0x83, 0x0D, 0x45, 0x6F,
+    0x7B, 0xE7, 0x4B, 0x5F, 0x57, 0x8E, 0x33, 0x6E, 0x12, 0xF9, 0xF8, 0x9E, 0x8F, 0x80, 0xB4, 0x37,
+    0xDE, 0x36, 0xB6, 0x2F, 0xBD, 0xAB, 0xEA, 0x46, 0xD2, 0x49, 0x2F, 0x5E, 0xF4, 0xCE, 0xB7, 0x8D,
+    0x24, 0xB3, 0x89, 0x66, 0xB4, 0xA1, 0xE8, 0x4A, 0x5F, 0x57, 0x33, 0x31, 0x1D, 0xB3, 0x90, 0x75,
+    0xD6, 0x97, 0xD5, 0x07, 0x78, 0xFA, 0xA0, 0x6E, 0xF7, 0x19, 0x5A, 0xDA, 0xCA, 0x79, 0xD7, 0xD9,
+    0x3E, 0x0F, 0x66, 0x24, 0x72, 0x73, 0x2D, 0x55, 0x7D, 0x86, 0x82, 0x96, 0xBA, 0x6A, 0xAB, 0xBA,
+    0x71, 0xDE, 0x79, 0xD7, 0x15, 0xBD, 0xED, 0x6D, 0xC8, 0x43, 0x36, 0x98, 0x31, 0x8D, 0x44, 0x26,
+    0x6E, 0x72, 0xCC, 0xD3, 0x87, 0xA8, 0xDD, 0x33, 0x14, 0xCB, 0x79, 0xAE, 0xD9, 0x9D, 0xE9, 0xCB,
+    0xCE, 0x75, 0x45, 0x6F, 0x83, 0xED, 0x6D, 0xC8, 0x07, 0xBD, 0x82, 0x19, 0xD3, 0x98, 0xE8, 0x55,
+    0xCE, 0xB8, 0xC9, 0x31, 0x8E, 0xA7, 0xF9, 0xE0, 0x9E, 0x35, 0x9B, 0xC5, 0x80, 0x15, 0xAF, 0x79,
+    0xC2, 0xB1, 0xF0, 0x4C, 0x49, 0x64, 0xA2, 0xF0, 0xA7, 0x24, 0x23, 0xDC, 0xA6, 0xF0, 0x69, 0xD4,
+    0x40, 0x4B, 0xED, 0x4D, 0xA4, 0xEC, 0xA8, 0x3D, 0x6D, 0x45, 0x0B, 0x67, 0x70, 0xB2, 0x14, 0x03,
+    0xD3, 0x90, 0x75, 0xD8, 0x0E, 0xEB, 0x29, 0x3D, 0xCE, 0xD3, 0x36, 0xE9, 0x44, 0xD9, 0xA7, 0x33,
+    0x45, 0x97, 0x4C, 0x14, 0x7E, 0x41, 0xA7, 0x2E, 0x01, 0x5C, 0x78, 0x11, 0xE0, 0xCA, 0x31, 0x09,
+    0x8C, 0xB6, 0xB2, 0x9D, 0xE9, 0x4D, 0x67, 0xFB, 0xBC, 0x61, 0xB0, 0x5D, 0x09, 0x57, 0x93, 0xEA,
+    0x04, 0x0A, 0xD2, 0x00, 0x99, 0xCF, 0x3C, 0x24, 0xA1, 0x00, 0x38, 0xB9, 0x01, 0x59, 0x57, 0x0E,
+    0xD6, 0xDB, 0x90, 0x77, 0x45, 0x97, 0x07, 0xDB, 0xDB, 0x2E, 0x6D, 0x8E, 0xC7, 0xA3, 0x0A, 0xC6,
+    0x63, 0x4D, 0x1E, 0x6A, 0x20, 0x6F, 0x4C, 0x07, 0xCF, 0xC0, 0x00, 0x27, 0x59, 0x73, 0x95, 0x34,
+    0xD8, 0xBE, 0x20, 0xF3, 0xB6, 0xCF, 0x7C, 0x41, 0xE6, 0x93, 0x70, 0x03, 0xE0, 0xE4, 0x63, 0x9A,
+    0x30, 0x7F, 0x3E, 0xC3, 0xAC, 0xF0, 0xE9, 0x84, 0xED, 0x11, 0xF2, 0x41, 0x1B, 0x03, 0x95, 0x9E,
+    0x19, 0x1B, 0xA8, 0x31, 0x23, 0xA5, 0x67, 0x69, 0xFF, 0x64, 0x06, 0xCA, 0x86, 0x48, 0xDE, 0x71,
+    0x0B, 0x13, 0x28, 0x2B, 0x22, 0xB9, 0xE7, 0x18, 0x13, 0x28, 0x2A, 0x46, 0x32, 0xCF, 0x55, 0xD2,
+    0x40, 0xC1, 0xFA, 0x8F, 0x24, 0x60, 0x2B, 0x5E, 0xC7, 0x34, 0x2B, 0x26, 0x72, 0x2E, 0xC3, 0x99,
+    0x9A, 0x2C, 0xE2, 0xBA, 0x54, 0x28, 0x02, 0x2D, 0x66, 0xE4, 0x22, 0x7C, 0x6E, 0x29, 0x8B, 0xDA,
+    0x3D, 0xFC, 0xE5, 0xEB, 0x85, 0xBC, 0x23, 0x71, 0x49, 0x02, 0xAE, 0xF6, 0xD5, 0x09, 0xAE, 0xDA,
+    0x55, 0x5E, 0xA8, 0xA7, 0x12, 0xF7, 0xE5, 0x83, 0x67, 0x3B, 0x77, 0x65, 0xC1, 0x1A, 0x87, 0x7D,
+    0x3B, 0xA9, 0xB8, 0xF7, 0x77, 0x6F, 0xB2, 0xAB, 0x29, 0x72, 0x7B, 0xEC, 0x48, 0x4B, 0x21, 0x0E,
+    0x3A, 0x4D, 0x9E, 0x1E, 0x34, 0xA3, 0xD9, 0x5F, 0xB8, 0x6C, 0x76, 0xAE, 0x9C, 0xDD, 0x5F, 0xED,
+    0x3C, 0xEA, 0x9A, 0x4A, 0x43, 0x3E, 0x63, 0x65, 0xC0, 0x49, 0x57, 0x48, 0xA4, 0x96, 0x50, 0xBC,
+    0x35, 0x53, 0xBF, 0x36, 0xBE, 0x8F, 0x9A, 0x0F, 0x6B, 0x71, 0x0A, 0xEC, 0xDF, 0x6E, 0xB1, 0xC2,
+    0x01, 0xA9, 0x06, 0x1B, 0xF2, 0x9E, 0xBC, 0x67, 0x61, 0xB7, 0xC5, 0x89, 0x31, 0x51, 0xDB, 0x12,
+    0xF6, 0xD8, 0x1E, 0xCA, 0x86, 0xB2, 0x81, 0x5B, 0xFB, 0x4B, 0x4D, 0x20, 0x03, 0x65, 0x84, 0x56,
+    0x8B, 0x33, 0x1F, 0x1B, 0x08, 0xB8, 0xA0, 0x83, 0x68, 0xA1, 0xF6, 0x24, 0x02, 0x6D, 0x43, 0x2A,
+    0xD0, 0x6A, 0x5C, 0xEF, 0x89, 0xC3, 0x70, 0x91, 0x86, 0x3F, 0x53, 0x69, 0x48, 0x27, 0x2B, 0x03,
+    0x26, 0x16, 0x12, 0xC9, 0xC6, 0xE2, 0xAD, 0x99, 0x3C, 0xBC, 0x4F, 0xB1, 0xC7, 0x25, 0xFF, 0xD0,
+    0x61, 0x3B, 0xB8, 0xB5, 0xF4, 0x6D, 0x2C, 0x1B, 0xD2, 0x91, 0xB2, 0x22, 0xEF, 0x71, 0xE0, 0x3C,
+    0x0E, 0x66, 0x38, 0xC6, 0x8C, 0x70, 0x13, 0xDB, 0xC3, 0x0D, 0xCA, 0x06, 0x4E, 0x70, 0xC0, 0xEB,
+    0xB8, 0x09, 0xF4, 0xEE, 0x07, 0x6C, 0x0F, 0x8F, 0x02, 0xA3, 0x97, 0x28, 0x1B, 0xD2, 0x48, 0xED,
+    0xC9, 0x22, 0x6D, 0x43, 0x1E, 0x69, 0x21, 0x0F, 0x3C, 0x71, 0x18, 0x17, 0x51, 0xEE, 0x48, 0x27,
+    0x8A, 0x09, 0x84, 0x42, 0x7A, 0xEA, 0xC6, 0xCA, 0x4C, 0xE9, 0xCD, 0x83, 0xD6, 0xDB, 0xC0, 0x6D,
+    0x33, 0x98, 0x11, 0x38, 0xD3, 0x6E, 0x50, 0x55, 0x0D, 0x58, 0x5F, 0x36, 0x90, 0x85, 0xBC, 0x03,
+    0x13, 0x8C, 0xFA, 0x8A, 0x11, 0xB2, 0x81, 0x63, 0xC8, 0x06, 0x8A, 0x8A, 0x2C, 0x90, 0x79, 0xB2,
+    0x40, 0x1A, 0x30, 0x01, 0x46, 0x92, 0x11, 0xAE, 0x42, 0x1D, 0xB1, 0x15, 0x76, 0xC2, 0x34, 0x0B,
+    0x44, 0xF9, 0x18, 0xD6, 0x37, 0x81, 0x2C, 0x62, 0x26, 0x52, 0xD1, 0xEE, 0xC2, 0xE0, 0x1A, 0x2E,
+    0xC2, 0x51, 0xA5, 0x80, 0x6F, 0x8A, 0x93, 0xDB, 0xDC, 0xB0, 0x22, 0x5D, 0xF9, 0xA5, 0x31, 0x13,
+    0x09, 0x57, 0x49, 0x65, 0xA4, 0x21, 0xF9, 0xDC, 0xFE, 0x42, 0x8D, 0xE5, 0x98, 0x1B, 0xCC, 0x69,
+    0x34, 0xC3, 0xA2, 0xB1, 0xAB, 0x65, 0x6D, 0x28, 0xBB, 0xBA, 0x91, 0x74, 0x36, 0xF1, 0xF0, 0xFB,
+    0xC1, 0x86, 0xD2, 0xD7, 0xD5, 0x9C, 0x44, 0x13, 0xF2, 0xBE, 0xF0, 0xAE, 0xBA, 0x49, 0x4C, 0x07,
+    0xD3, 0x9B, 0x26, 0xE7, 0x83, 0x6B, 0x3B, 0x81, 0xF5, 0x51, 0x4E, 0x18, 0x89, 0xB8, 0x3F, 0x8A,
+    0x66, 0xC8, 0x42, 0xD9, 0x58, 0x1F, 0x71, 0xCF, 0xF5, 0xC4, 0xB2, 0x32, 0x21, 0x62, 0xEF, 0x06,
+    0x6E, 0x59, 0x9F, 0x0E, 0xB7, 0xB0, 0x6F, 0x44, 0x4E, 0x4D, 0xC8, 0x82, 0x7D, 0xBB, 0xA5, 0x90,
+    0x40, 0x31, 0xB3, 0xCB, 0xD9, 0x84, 0x52, 0x7B, 0x26, 0x94, 0x81, 0x54, 0x3C, 0x65, 0x4D, 0x3A,
+    0x8C, 0x94, 0xCF, 0x75, 0xE9, 0x50, 0x52, 0x56, 0x31, 0x19, 0x4D, 0x28, 0xBE, 0xFD, 0xC2, 0xBF,
+    0x17, 0x91, 0x1F, 0x8B, 0x48, 0x83, 0xF5, 0xDA, 0x05, 0x6A, 0x58, 0x2C, 0x5A, 0x19, 0x68, 0xC5,
+    0x1B, 0x11, 0x6C, 0x03, 0x37, 0x54, 0x9A, 0xAD, 0x54, 0xFC, 0xAE, 0x54, 0x0A, 0x6C, 0x4D, 0xCB,
+    0x77, 0x8A, 0xC8, 0x66, 0x03, 0x47, 0x52, 0x59, 0x19, 0x70, 0xF7, 0x0F, 0xE3, 0x1F, 0xE2, 0xA9,
+    0x67, 0xEC, 0x7D, 0x45, 0x7E, 0x7B, 0x6D, 0x28, 0xF8, 0xEE, 0x3D, 0x4A, 0x89, 0x4C, 0x9F, 0x8E,
+    0xA6, 0x37, 0xA1, 0xA8, 0xF2, 0xEE, 0x26, 0x65, 0x32, 0x10, 0x4D, 0xC8, 0x7A, 0xDB, 0xD7, 0x14,
+    0x12, 0xB0, 0x0B, 0x1A, 0x55, 0xCA, 0x6C, 0x45, 0xBE, 0xF3, 0xE6, 0x9D, 0x1F, 0xF7, 0x69, 0x08,
+    0xE9, 0xF0, 0x44, 0x32, 0x42, 0x84, 0x08, 0xA7, 0xE0, 0xC0, 0x41, 0xD9, 0x60, 0x3D, 0x79, 0x87,
+    0x09, 0x24, 0x23, 0x87, 0x54, 0x4D, 0xA5, 0x43, 0xA4, 0x72, 0x49, 0xCC, 0x3A, 0xEB, 0x4F, 0x88,
+    0x79, 0x57, 0x56, 0xEE, 0x93, 0x5D, 0x22, 0x81, 0x72, 0xC6, 0x7E, 0x63, 0x34, 0xC1, 0x76, 0x27,
+    0x9C, 0x59, 0x9F, 0xF5, 0x91, 0x53, 0xDB, 0x97, 0xBE, 0x96, 0x90, 0xC8, 0x70, 0x30, 0x88, 0x9E,
+    0x56, 0x7C, 0xF9, 0xC6, 0x64, 0x42, 0xD6, 0x9F, 0xE2, 0x72, 0x6F, 0x42, 0xC4, 0xE5, 0xBD, 0xE9,
+    0xDD, 0x1F, 0x9E, 0x26, 0x22, 0x3E, 0xDD, 0x8E, 0xE0, 0xA0, 0xE8, 0xC8, 0x07, 0xF2, 0x89, 0x76,
+    0xDE, 0x75, 0xAA, 0x4E, 0xAA, 0xCB, 0x66, 0xB6, 0xC3, 0xEF, 0x7E, 0x4F, 0x9A, 0xAB, 0x6F, 0x8F,
+    0x59, 0xB4, 0x55, 0x9B, 0x04, 0xDB, 0x97, 0x44, 0xD3, 0xDB, 0xE6, 0x66, 0x12, 0xF2, 0x37, 0x4A,
+    0x4E, 0xBF, 0xD7, 0xDB, 0x78, 0x95, 0xFD, 0x1C, 0x96, 0x51, 0x39, 0xE1, 0x2F, 0x46, 0x33, 0x66,
+    0xA1, 0xF8, 0x4F, 0x70, 0xC2, 0x99, 0x09, 0x59, 0xB0, 0x43, 0x4B, 0x21, 0x03, 0x85, 0xEC, 0x93,
+    0x40, 0x4F, 0x53, 0xE9, 0xDA, 0x98, 0x3C, 0xEF, 0x93, 0x91, 0xB2, 0x49, 0x07, 0x45, 0x63, 0x6F,
+    0x91, 0x77, 0x44, 0xAC, 0x27, 0x52, 0x76, 0xB5, 0x7C, 0x73, 0xA9, 0x10, 0x28, 0x47, 0x32, 0x89,
+    0xD4, 0x7F, 0xAC, 0xCE, 0x2B, 0xD6, 0x3F, 0xC1, 0x2D, 0xD5, 0xBD, 0x4B, 0x53, 0x56, 0xD7, 0xA8,
+    0x53, 0xA5, 0x8D, 0x3C, 0x66, 0xB0, 0x0F, 0xB6, 0x2F, 0xB7, 0x22, 0xCD, 0xBE, 0xFF, 0x59, 0x47,
+    0x2D, 0x4D, 0xF1, 0x1F, 0x62, 0xDA, 0x5B, 0xFF, 0x3E, 0x22, 0x14, 0x15, 0x79, 0xCF, 0x53, 0x23,
+    0xB9, 0x78, 0xFE, 0xFB, 0x79, 0xB9, 0x9E, 0xFA, 0x7B, 0x13, 0x49, 0xDB, 0xD4, 0xD2, 0x1B, 0xE9,
+    0x0F, 0x12, 0x57, 0x8B, 0x4A, 0xB9, 0x77, 0x20, 0x11, 0x4F, 0x51, 0x93, 0x0C, 0x23, 0xC5, 0x73,
+    0x5D, 0x32, 0x96, 0x14, 0xCD, 0x89, 0x72, 0xEF, 0xF3, 0x5F, 0x59, 0xB8, 0xD7, 0xEF, 0xB8, 0x77,
+    0x84, 0xAC, 0x83, 0xF7, 0x6F, 0x5F, 0x79, 0x1C, 0xF7, 0xCE, 0x28, 0xF7, 0xCA, 0xE3, 0xB8, 0x37,
+    0x91, 0xC6, 0xCA, 0x80, 0x9B, 0xB4, 0xFB, 0x88, 0xCE, 0x5C, 0xEB, 0xA9, 0x85, 0x7C, 0x02, 0xA9,
+    0xC8, 0x7B, 0xB8, 0x05, 0xE6, 0xC1, 0x2B, 0x94, 0x12, 0x99, 0x3F, 0x33, 0x1E, 0x70, 0xEF, 0x27,
+    0x06, 0xA2, 0xE9, 0x57, 0xEE, 0x1D, 0x76, 0xD2, 0xF8, 0xE4, 0x76, 0x6B, 0x45, 0xBE, 0x23, 0xF2,
+    0xE3, 0x3E, 0x1D, 0x42, 0x32, 0xFC, 0x06, 0xCA, 0xBD, 0x27, 0x70, 0x73, 0xE5, 0xDE, 0x42, 0xB9,
+    0xB7, 0x3F, 0xE0, 0xDE, 0x64, 0xC7, 0x7A, 0xCA, 0xBD, 0x9F, 0x78, 0x84, 0x7B, 0x07, 0x8A, 0x19,
+    0xFB, 0x9D, 0x47, 0xB8, 0xB7, 0x50, 0xEE, 0x1D, 0xCF, 0x75, 0x48, 0x6F, 0xA5, 0x29, 0xFE, 0xEC,
+    0x61, 0xEE, 0xED, 0x4C, 0x5F, 0xFF, 0xCF, 0xA7, 0xA9, 0x88, 0x3F, 0x7A, 0xA0, 0xDC, 0x6B, 0x3B,
+    0xF2, 0x81, 0x6C, 0xE2, 0x05, 0x21, 0x9B, 0x2B, 0x25, 0x44, 0x2E, 0x22, 0x11, 0x2B, 0x22, 0x91,
+    0xA3, 0x56, 0x24, 0x82, 0xAB, 0x92, 0x11, 0xEA, 0x8A, 0x01, 0x5A, 0x08, 0x20, 0xD0, 0x9D, 0x6F,
+    0xCD, 0x14, 0x0F, 0x5A, 0x33, 0x89, 0x4C, 0x6B, 0x8B, 0xCD, 0xEC, 0xC1, 0xF6, 0x95, 0x35, 0x42,
+    0xB5, 0xEF, 0x3D, 0x4C, 0xF2, 0xFC, 0xF7, 0xAF, 0xAD, 0xE9, 0x1F, 0x47, 0xED, 0x9B, 0xB7, 0x77,
+    0xD1, 0xF9, 0x05, 0x54, 0xAF, 0x80, 0x44, 0xBE, 0x02, 0xDA, 0xC9, 0x00, 0xB7, 0x26, 0xC9, 0x6B,
+    0xB2, 0x58, 0x2A, 0x03, 0x6B, 0x57, 0x82, 0xF6, 0xB5, 0x19, 0x92, 0x88, 0x80, 0x09, 0xB4, 0x90,
+    0xF7, 0xDC, 0x02, 0xEB, 0x79, 0xF1, 0x21, 0xA4, 0x7E, 0xC1, 0xE8, 0x2F, 0x83, 0x13, 0x99, 0xA0,
+    0x16, 0x89, 0xE7, 0x9A, 0x4A, 0x25, 0xA2, 0x1D, 0xC0, 0x44, 0x02, 0xC9, 0x67, 0xDE, 0xDE, 0x5C,
+    0xDB, 0xDD, 0x73, 0xB7, 0xB7, 0x80, 0xCA, 0x06, 0xF8, 0x27, 0x35, 0xFC, 0xBA, 0x77, 0x22, 0x4B,
+    0x5F, 0x3C, 0xF1, 0xAE, 0xFF, 0x8C, 0xCC, 0x3C, 0xB3, 0x9A, 0x4F, 0xFB, 0x54, 0xDD, 0x17, 0xF6,
+    0xAD, 0x66, 0x9C, 0xEC, 0x3E, 0x9B, 0x1F, 0x0E, 0x4F, 0xED, 0x9A, 0x14, 0xB7, 0xBB, 0x7A, 0x71,
+    0xEC, 0xD2, 0xFD, 0x41, 0x51, 0xE5, 0xB5, 0x6C, 0x9C, 0xA2, 0xC3, 0x35, 0xF9, 0x0A, 0x6C, 0x9B,
+    0x21, 0x0D, 0x6B, 0x8F, 0x8D, 0xBA, 0x3A, 0x5E, 0x2B, 0xCC, 0xF3, 0xB0, 0xD4, 0x3C, 0xB8, 0x2A,
+    0x99, 0x8E, 0x64, 0x4B, 0x19, 0xC9, 0x06, 0xEA, 0x97, 0x44, 0x42, 0x21, 0x3D, 0x2D, 0x2F, 0xF4,
+    0xB5, 0x44, 0xD3, 0xFF, 0x2B, 0xF2, 0x07, 0x32, 0x52, 0x34, 0x9C, 0x50, 0x21, 0x32, 0x92, 0x0E,
+    0x58, 0x0F, 0x76, 0xFE, 0x0A, 0x94, 0xD0, 0x2E, 0x13, 0x6A, 0x02, 0x66, 0x5A, 0xA8, 0xE8, 0xA0,
+    0xD0, 0x98, 0x2D, 0x59, 0x0F, 0xAE, 0x57, 0xB2, 0x9E, 0x02, 0xAD, 0xC6, 0x4E, 0xAC, 0x07, 0x33,
+    0x68, 0xE5, 0x6E, 0x34, 0x5F, 0xA2, 0xD0, 0x3A, 0x33, 0xEB, 0xE3, 0x90, 0x84, 0x54, 0x6E, 0x03,
+    0x73, 0x6B, 0xEF, 0xDD, 0x32, 0x22, 0x3D, 0x58, 0xE9, 0x44, 0x9A, 0x56, 0x5B, 0x1B, 0xF5, 0xE9,
+    0xAE, 0xCE, 0xB2, 0x3A, 0xDF, 0x49, 0xE7, 0x85, 0x35, 0x36, 0xD9, 0x81, 0x9B, 0x5F, 0x8B, 0x50,
+    0x8C, 0x58, 0x8F, 0x89, 0xA0, 0x1D, 0xC6, 0x8B, 0x8A, 0xD2, 0x93, 0xF4, 0x6B, 0xED, 0xE2, 0x5A,
+    0x9F, 0x90, 0x5C, 0x5F, 0x29, 0x9E, 0x69, 0x25, 0xDA, 0x42, 0xCD, 0x85, 0xB9, 0x94, 0xB3, 0x35,
+    0xF0, 0xFC, 0x99, 0xFB, 0x9B, 0x6B, 0xBB, 0x28, 0x8E, 0x39, 0xCC, 0x16, 0x59, 0xAB, 0x1D, 0x06,
+    0x78, 0x02, 0xDA, 0x7B, 0xDA, 0x97, 0x49, 0x64, 0x80, 0x5C, 0x8B, 0xE6, 0x96, 0xED, 0x0F, 0x0E,
+    0xB2, 0xAC, 0xFA, 0x5D, 0xFD, 0xB2, 0xB6, 0x60, 0x09, 0x3B, 0x8B, 0xD8, 0x6D, 0x36, 0xBF, 0xB7,
+    0xFD, 0xB7, 0x22, 0x22, 0xD2, 0x8A, 0x88, 0xFC, 0x78, 0x00, 0x9E, 0x50, 0xEF, 0x5A, 0xD9, 0x73,
+    0xDA, 0xDB, 0xBE, 0xBF, 0x76, 0xDE, 0x54, 0x30, 0x5E, 0xEB, 0x03, 0xEA, 0x89, 0x44, 0xA4, 0xCA,
+    0x7E, 0xF2, 0xA7, 0x5D, 0x71, 0xF7, 0xEE, 0xE0, 0x8C, 0x8F, 0xBF, 0x69, 0xFC, 0xC7, 0x30, 0x5E,
+    0x8F, 0x59, 0x37, 0x33, 0xC9, 0xBA, 0x9F, 0xEF, 0xB9, 0x3E, 0xBE, 0xB6, 0x67, 0xF8, 0x73, 0x61,
+    0x89, 0xCF, 0xBF, 0xBA, 0xD9, 0x3C, 0xFF, 0xA7, 0x7B, 0xA7, 0xE1, 0x2F, 0xAB, 0x35, 0x26, 0x7C,
+    0x6B, 0x27, 0x1C, 0xD9, 0x7E, 0xA8, 0xD9, 0xB9, 0xB4, 0x99, 0x9F, 0xF3, 0x5E, 0xD6, 0x31, 0x2C,
+    0x63, 0xFA, 0xA8, 0xF1, 0x2F, 0xBA, 0x67, 0xDF, 0x88, 0xF6, 0xEE, 0x37, 0x82, 0x79, 0xE7, 0xBB,
+    0x1E, 0x11, 0xED, 0x90, 0x6A, 0x03, 0xA4, 0xCD, 0xCA, 0x36, 0x79, 0x95, 0xF4, 0x50, 0x36, 0x66,
+    0x84, 0x33, 0x38, 0x25, 0x1D, 0xA1, 0xAC, 0xB2, 0x1E, 0xF2, 0xAE, 0xF8, 0xF6, 0x66, 0xF3, 0xE9,
+    0xC1, 0x89, 0x88, 0x44, 0x7D, 0xB5, 0x7E, 0x35, 0x3D, 0xAD, 0x5F, 0x5C, 0x84, 0x1A, 0x22, 0x14,
+    0xDE, 0x0C, 0x90, 0x1D, 0x94, 0x64, 0x27, 0x95, 0xAE, 0x7F, 0xE5, 0x08, 0xED, 0x4C, 0xFA, 0xEE,
+    0x0F, 0x9B, 0xFC, 0x7B, 0xDF, 0xEC, 0xDD, 0x4B, 0x5F, 0x8F, 0xC7, 0xC6, 0x9F, 0xBC, 0xCF, 0xF8,
+    0x0F, 0xEF, 0xE8, 0xFF, 0x53, 0x9E, 0xBF, 0x69, 0xFC, 0xC7, 0x9C, 0xF1, 0xB1, 0xB8, 0x7B, 0x77,
+    0xC8, 0x7E, 0xF2, 0xA7, 0x5D, 0x22, 0x52, 0x51, 0x4F, 0x9A, 0x4F, 0x7D, 0x48, 0xFF, 0xAC, 0xD3,
+    0xEF, 0xEA, 0x89, 0x54, 0xA4, 0xC9, 0xBF, 0xF7, 0xCD, 0xBE, 0x7C, 0xE9, 0xEB, 0xA3, 0x33, 0x3E,
+    0xFE, 0xB4, 0xDF, 0x79, 0x9F, 0xF1, 0x1F, 0x3E, 0x36, 0xFE, 0xA4, 0x7C, 0xE9, 0xEB, 0x63, 0xFE,
+    0xBD, 0x6F, 0xF6, 0xE9, 0xBB, 0x3F, 0x6C, 0x68, 0x67, 0xBD, 0xDF, 0xAC, 0x63, 0xFB, 0xDA, 0x9B,
+    0xDB, 0x75, 0xDA, 0x0E, 0xAA, 0xEA, 0xD7, 0xE7, 0xE9, 0xC1, 0xF3, 0x64, 0xF7, 0x3C, 0xE2, 0x84,
+    0xA2, 0x39, 0xA1, 0xE6, 0x84, 0xC8, 0x89, 0x09, 0x9C, 0x58, 0xCF, 0x89, 0x13, 0x89, 0xB5, 0x48,
+    0x74, 0xDB, 0xED, 0x9F, 0x2C, 0x02, 0xAF, 0x57, 0x71, 0x95, 0xA2, 0xC9, 0xC9, 0xBE, 0x7E, 0xFF,
+    0xD6, 0x4F, 0x79, 0x1E, 0xEF, 0x9E, 0xB7, 0x39, 0x4E, 0x07, 0x8E, 0x99, 0x38, 0xC6, 0x71, 0x8C,
+    0xF5, 0x57, 0x31, 0xC1, 0xE9, 0x1C, 0x4D, 0xBF, 0xB3, 0x7D, 0x2D, 0x2A, 0x53, 0x15, 0xBA, 0x6E,
+    0x27, 0x71, 0xE9, 0x9B, 0xA0, 0x4A, 0xE2, 0x77, 0x76, 0x82, 0x56, 0xF3, 0x6B, 0x70, 0x8C, 0x83,
+    0x63, 0x26, 0x38, 0x36, 0x01, 0x8E, 0xAD, 0x87, 0x63, 0x57, 0xC1, 0xB1, 0xAC, 0x41, 0x88, 0x69,
+    0xDF, 0xA0, 0xEF, 0x50, 0x2C, 0x1F, 0x23, 0x6E, 0x7C, 0xEC, 0x21, 0x01, 0x1E, 0x57, 0x0D, 0x2E,
+    0x56, 0x44, 0xE4, 0x27, 0x0F, 0xB6, 0xDB, 0xED, 0xAB, 0x27, 0xFB, 0x64, 0xA3, 0x52, 0x44, 0xA4,
+    0xD7, 0x9A, 0xBB, 0x07, 0xAF, 0x89, 0xF4, 0x76, 0xEF, 0x41, 0xEB, 0xCF, 0x2C, 0x20, 0x53, 0x58,
+    0x94, 0x8B, 0x15, 0x30, 0x21, 0x82, 0xD8, 0x80, 0x0B, 0xE2, 0x8B, 0xD6, 0x8A, 0xF9, 0x49, 0x88,
+    0xF1, 0x1F, 0x3B, 0x7B, 0x57, 0xFF, 0xE4, 0xAC, 0xFF, 0xF9, 0x3E, 0xA4, 0xB7, 0xFF, 0x9B, 0xBD,
+    0x1D, 0xFB, 0x70, 0x6C, 0x31, 0x0D, 0x56, 0xB4, 0x89, 0xAB, 0x88, 0x1C, 0x6D, 0xB7, 0xDB, 0x6D,
+    0xDC, 0x3B, 0xE7, 0xB7, 0x5A, 0x11, 0x91, 0x3F, 0x58, 0x46, 0x31, 0xEB, 0x9F, 0xEA, 0x9D, 0x68,
+    0x2B, 0x11, 0xDE, 0x07, 0x1C, 0xE7, 0xFE, 0x17, 0xBB, 0xB9, 0xE4, 0x5B, 0x21, 0x7E, 0xC1, 0xD5,
+    0xF6, 0xBB, 0x5E, 0x82, 0x04, 0x23, 0x36, 0x62, 0x83, 0x40, 0xF9, 0x7C, 0x03, 0x6D, 0xBF, 0xB8,
+    0x92, 0xEF, 0xDF, 0x9B, 0xF2, 0x4D, 0xDA, 0x40, 0xDE, 0x65, 0x3D, 0x94, 0x4D, 0x3A, 0xC2, 0x29,
+    0xDC, 0xD2, 0xDE, 0x2E, 0x4D, 0x2E, 0x22, 0xD2, 0x97, 0xDB, 0xED, 0x76, 0x3B, 0xDE, 0x84, 0x65,
+    0x6B, 0x12, 0x4E, 0x0A, 0x11, 0xDD, 0x17, 0x40, 0xA4, 0x4B, 0xE6, 0xED, 0xB6, 0xAD, 0xB8, 0x05,
+    0xA7, 0x3B, 0xA9, 0xEE, 0xB2, 0x0E, 0x92, 0x2A, 0xA9, 0xB8, 0x5C, 0x01, 0x17, 0x9F, 0xD5, 0xCD,
+    0x9A, 0xCA, 0x1E, 0x70, 0x8D, 0x00, 0x59, 0xB0, 0x03, 0x30, 0x2F, 0x85, 0x16, 0x4B, 0x7D, 0x43,
+    0xD9, 0x83, 0xAB, 0x12, 0xCD, 0x54, 0xB4, 0x4B, 0xC9, 0xAF, 0x68, 0xE6, 0xC8, 0xF6, 0xB5, 0x08,
+    0x65, 0xA7, 0x05, 0x35, 0x64, 0x01, 0xAC, 0xA6, 0x3D, 0xB4, 0x8D, 0xF5, 0x60, 0x62, 0xA2, 0x25,
+    0x54, 0xAE, 0x82, 0x64, 0x36, 0x5A, 0xDA, 0x75, 0x0A, 0xD0, 0x7E, 0xCA, 0x03, 0xE6, 0xFE, 0xC2,
+    0x5C, 0x6A, 0x02, 0xAA, 0xC9, 0xA1, 0x7E, 0x6D, 0xEB, 0xF7, 0x79, 0x3E, 0x0B, 0xF8, 0x7B, 0x11,
+    0x78, 0x4A, 0x3A, 0x52, 0x91, 0x40, 0xF1, 0xED, 0xBA, 0xE7, 0x0B, 0xDA, 0x24, 0xDE, 0x2D, 0x01,
+    0x58, 0x35, 0x69, 0x74, 0x49, 0xEE, 0xE1, 0xBA, 0x6B, 0xA8, 0xB5, 0x28, 0x63, 0x44, 0xAA, 0xB6,
+    0xB7, 0x3D, 0x75, 0x33, 0xC3, 0x9C, 0x05, 0xCC, 0xE0, 0x1A, 0xEC, 0x1B, 0x11, 0xEA, 0x3C, 0x90,
+    0x46, 0xD7, 0x60, 0xBB, 0x19, 0x9C, 0x19, 0x49, 0xA3, 0xED, 0xB5, 0xDF, 0xD3, 0x19, 0x42, 0x16,
+    0xD2, 0x89, 0xBA, 0x32, 0xF3, 0x67, 0x06, 0x32, 0x91, 0x4A, 0x77, 0xE1, 0xE1, 0x1A, 0xDA, 0xE2,
+    0xDD, 0xAC, 0x8A, 0xF5, 0x5B, 0xB2, 0x7D, 0x6D, 0x5A, 0xCA, 0x52, 0xD3, 0xF7, 0xFA, 0x50, 0xC8,
+    0xB6, 0xFD, 0x73, 0x11, 0x99, 0x96, 0x0E, 0x00, 0xE9, 0xCF, 0x74, 0x56, 0x2D, 0x22, 0xDF, 0x59,
+    0x13, 0xD1, 0x9B, 0x1D, 0xC6, 0x72, 0x74, 0x76, 0x9B, 0xAB, 0xD0, 0x8A, 0x54, 0x33, 0x99, 0x88,
+    0xBC, 0x33, 0x52, 0xCE, 0x9B, 0x17, 0xA4, 0xA7, 0xED, 0x49, 0xA5, 0x49, 0x04, 0x10, 0x6F, 0x22,
+    0x18, 0xE9, 0xF2, 0x01, 0x72, 0x09, 0x36, 0x40, 0xF9, 0x8D, 0xA1, 0xE8, 0xA0, 0x35, 0x63, 0xE9,
+    0x49, 0xA3, 0x19, 0x4B, 0x4F, 0x1E, 0xD2, 0xE8, 0x3C, 0x85, 0x4F, 0xA3, 0x6B, 0xA8, 0x49, 0xA3,
+    0x6B, 0x92, 0x48, 0x1A, 0x5D, 0x93, 0x0D, 0x98, 0xE8, 0x9A, 0xA2, 0xC3, 0x8C, 0xA5, 0x77, 0x15,
+    0x66, 0x28, 0xFC, 0x04, 0x79, 0xB0, 0xDF, 0x1B, 0xC0, 0x06, 0x2B, 0x1D, 0x94, 0x5D, 0x26, 0x0D,
+    0xD4, 0x3E, 0x15, 0x48, 0x04, 0x23, 0x1D, 0xC5, 0x84, 0x95, 0xF9, 0x7F, 0x95, 0x01, 0xF7, 0xFB,
+    0x22, 0xE2, 0x69, 0x69, 0xE5, 0x3E, 0x5C, 0x21, 0xF9, 0x6F, 0x0F, 0xB3, 0x4C, 0x93, 0x97, 0x77,
+    0x39, 0x26, 0xC9, 0xB2, 0xCF, 0x09, 0x2C, 0x1D, 0xC1, 0xD3, 0x77, 0x47, 0xC0, 0xFE, 0x69, 0x00,
+    0x6E, 0x95, 0xDD, 0x12, 0xEC, 0xA6, 0xF0, 0x02, 0x9C, 0xA6, 0x13, 0x98, 0x60, 0x46, 0x28, 0x1B,
+    0x1B, 0x60, 0xA2, 0xEC, 0xC8, 0x02, 0xCE, 0x53, 0x36, 0x9A, 0x08, 0x93, 0xCC, 0xE4, 0x3D, 0x26,
+    0xE2, 0x2A, 0xEC, 0x90, 0x44, 0x28, 0x7A, 0xDD, 0xB5, 0xCA, 0x01, 0xF2, 0xCF, 0x22, 0x24, 0xB3,
+    0xED, 0xC0, 0xC4, 0x5A, 0xDE, 0xBC, 0x23, 0xEF, 0x88, 0x88, 0xC8, 0x0F, 0x17, 0x98, 0x70, 0xB3,
+    0xD9, 0x6C, 0xAE, 0xD5, 0x22, 0xBA, 0x06, 0x88, 0x4C, 0xF5, 0x9B, 0x9B, 0xCD, 0xBF, 0x8C, 0xAE,
+    0x03, 0x13, 0x8B, 0x00, 0x66, 0xD0, 0x4A, 0xAE, 0x7C, 0x04, 0xDB, 0x67, 0xBA, 0x98, 0x4E, 0x4B,
+    0x82, 0x13, 0xAE, 0x5A, 0x80, 0x98, 0xB6, 0xD2, 0xC4, 0x3C, 0xCD, 0x89, 0x4C, 0x47, 0x28, 0x7B,
+    0x13, 0xC0, 0x86, 0xAC, 0x07, 0x3B, 0xD8, 0x0E, 0xB2, 0x51, 0x65, 0xA7, 0xAC, 0x20, 0x9D, 0x1C,
+    0xC0, 0x7C, 0x8B, 0xB5, 0xA1, 0x0E, 0x75, 0xDC, 0x27, 0x61, 0x68, 0xF2, 0x97, 0x9A, 0xE7, 0x17,
+    0xD6, 0x4C, 0xC5, 0x0D, 0xD4, 0xA2, 0x79, 0x4F, 0x22, 0xD4, 0xF2, 0xE6, 0x76, 0x9B, 0x88, 0x76,
+    0xC7, 0xD8, 0xA7, 0xCB, 0x69, 0x56, 0x8F, 0x3B, 0xD0, 0xD4, 0xF5, 0x41, 0x9F, 0x34, 0xD9, 0x6E,
+    0xB7, 0x5B, 0x5D, 0x39, 0x67, 0x7D, 0x6D, 0x61, 0xB3, 0xB9, 0xDE, 0x1E, 0x74, 0xA8, 0x59, 0x7C,
+    0x0B, 0xBF, 0xEF, 0xFE, 0xB4, 0xD6, 0x80, 0xE9, 0x25, 0xEE, 0xED, 0xD6, 0x06, 0x6D, 0x4E, 0x05,
+    0x4F, 0xAD, 0x69, 0x15, 0xCD, 0x2E, 0xB3, 0xFC, 0x72, 0xFD, 0xC8, 0xDD, 0xCE, 0xDB, 0x44, 0x6E,
+    0xA3, 0x00, 0xD6, 0x88, 0x0D, 0x98, 0x40, 0xD1, 0x2D, 0x9D, 0x4E, 0xB4, 0xD8, 0xC9, 0x7A, 0x6A,
+    0xB4, 0xE1, 0x13, 0x65, 0x83, 0x6C, 0xB7, 0xED, 0x9B, 0xE7, 0xEE, 0x56, 0xB8, 0x38, 0x6D, 0xAE,
+    0xB7, 0x10, 0xA1, 0x26, 0x19, 0xC1, 0x35, 0x66, 0x00, 0xE7, 0x4D, 0x80, 0xA2, 0xCF, 0x7A, 0xB0,
+    0x63, 0xDE, 0x81, 0x99, 0xAD, 0x67, 0xE9, 0x82, 0xA7, 0x8B, 0xDC, 0x7A, 0xB7, 0xB5, 0x88, 0xAC,
+    0x39, 0xD3, 0xF1, 0x5C, 0xEB, 0xAA, 0x85, 0xCC, 0x9B, 0xE5, 0x9E, 0x97, 0x6A, 0xF3, 0x37, 0xB7,
+    0xDB, 0xAD, 0xEA, 0xAE, 0xB2, 0xDF, 0x53, 0xE6, 0x5C, 0x7E, 0xD4, 0xF6, 0x8E, 0xC8, 0x28, 0x22,
+    0x22, 0x51, 0x5F, 0xDB, 0x03, 0x9A, 0x2F, 0xF4, 0xEC, 0x56, 0xAB, 0x1B, 0x32, 0xB9, 0xBD, 0xF6,
+    0xCA, 0x90, 0x85, 0x92, 0xC9, 0x1D, 0x91, 0x79, 0xB3, 0xB9, 0xBE, 0xEB, 0xF5, 0xA2, 0x1D, 0x35,
+    0xB6, 0xDB, 0xD7, 0x34, 0xE9, 0xE0, 0x48, 0xF3, 0xBE, 0x75, 0x07, 0x0A, 0x9D, 0x69, 0x75, 0x0E,
+    0xCC, 0xE1, 0x10, 0x96, 0xFD, 0x08, 0xB6, 0xDB, 0xED, 0x76, 0x3B, 0xB7, 0x7B, 0xAB, 0x5C, 0x2E,
+    0x6F, 0x36, 0xAB, 0x1B, 0x71, 0xE0, 0xE2, 0x1E, 0xF6, 0x70, 0xC8, 0x87, 0xFD, 0x08, 0x5B, 0x0F,
+    0x3C, 0x25, 0x88, 0x88, 0x8C, 0x68, 0x77, 0x71, 0x11, 0xB9, 0xB7, 0x42, 0xDD, 0x6A, 0x24, 0x6F,
+    0xA6, 0x47, 0xEE, 0xB6, 0x7D, 0x4D, 0x26, 0xED, 0xDE, 0x50, 0x51, 0x36, 0xD4, 0x1E, 0xEB, 0xB1,
+    0x01, 0xEB, 0xC9, 0x86, 0x45, 0x4C, 0x4D, 0x20, 0x89, 0x98, 0x00, 0x13, 0xE9, 0x08, 0xF3, 0xF6,
+    0xB5, 0xF9, 0x91, 0xBB, 0xAD, 0xAF, 0x69, 0x1B, 0x08, 0x66, 0x28, 0x2B, 0x26, 0x34, 0xD2, 0xB2,
+    0x34, 0x18, 0xCC, 0xBB, 0x7C, 0x80, 0xAC, 0x2F, 0x03, 0x98, 0xD0, 0x7A, 0x48, 0x45, 0x96, 0xEE,
+    0x86, 0xBB, 0xBB, 0x9D, 0xF6, 0xF9, 0xD2, 0x8B, 0xC5, 0xB0, 0xDB, 0x32, 0x73, 0xB3, 0xD9, 0x5C,
+    0x5F, 0xEF, 0x59, 0x44, 0x64, 0x66, 0xBB, 0xDD, 0xBE, 0xB6, 0xEC, 0x4D, 0x16, 0x0E, 0x38, 0x3E,
+    0xEE, 0x53, 0x46, 0x99, 0x4B, 0x91, 0x07, 0x5B, 0x71, 0x22, 0x22, 0xCB, 0xEB, 0xE3, 0xE9, 0xA9,
+    0x5B, 0x9D, 0x14, 0x01, 0x38, 0x92, 0x4E, 0x44, 0x44, 0x2A, 0xA5, 0x64, 0x2B, 0xF2, 0xA0, 0xD2,
+    0xED, 0x43, 0x36, 0x1B, 0xDD, 0xCE, 0x48, 0xBE, 0xB1, 0xB4, 0x6F, 0xCF, 0xE6, 0xED, 0xEF, 0xBD,
+    0x26, 0x4B, 0x2D, 0x69, 0xA3, 0x75, 0x89, 0x9A, 0x62, 0x9E, 0xA9, 0x8F, 0x9A, 0xCC, 0x7F, 0xEF,
+    0xFF, 0xF8, 0xC2, 0xDC, 0x50, 0xC8, 0x6D, 0x91, 0x91, 0x5A, 0x62, 0x2D, 0x13, 0xA5, 0xC8, 0xD2,
+    0x7D, 0xD2, 0xED, 0xED, 0x34, 0x23, 0xDB, 0xED, 0x6B, 0x31, 0xD3, 0xFE, 0x5C, 0x13, 0x58, 0x6F,
+    0x23, 0x94, 0xD8, 0x08, 0x57, 0x28, 0x74, 0x6F, 0x38, 0x2D, 0x63, 0x09, 0xFB, 0x9C, 0xF6, 0xBA,
+    0xDB, 0x5B, 0x0F, 0x3A, 0x55, 0x9A, 0x2C, 0x1E, 0x77, 0x1D, 0x23, 0x92, 0xF9, 0x5C, 0xD9, 0xD1,
+    0xCA, 0xD3, 0x75, 0xB3, 0x3B, 0xCC, 0x79, 0xF8, 0x6C, 0x3A, 0x81, 0xE9, 0x8B, 0x1E, 0x6C, 0x23,
+    0xC0, 0x99, 0x0D, 0x60, 0x86, 0xF6, 0xCD, 0xED, 0xB6, 0xD5, 0xFD, 0x5C, 0x72, 0x11, 0x91, 0xD1,
+    0x1E, 0xB4, 0xD5, 0x5F, 0x13, 0x65, 0xBE, 0x27, 0x22, 0xE3, 0x9A, 0xF6, 0x73, 0x71, 0x67, 0x4F,
+    0xE7, 0xFD, 0x6A, 0x4F, 0xA6, 0xC3, 0x4E, 0x1A, 0x0F, 0x7A, 0x68, 0xEF, 0xD4, 0x62, 0xE1, 0xFF,
+    0xD3, 0xA7, 0xDC, 0x7A, 0xDC, 0x29, 0xDD, 0x1A, 0x4B, 0xDA, 0x9F, 0xC2, 0x2E, 0x47, 0xF7, 0xE0,
+    0x94, 0x27, 0xAB, 0x35, 0xFD, 0x3F, 0xEA, 0x61, 0x59, 0xAF, 0x3F, 0x58, 0x56, 0xBB, 0x38, 0x4F,
+    0xB2, 0x64, 0xD1, 0xE4, 0x9D, 0xAA, 0x6C, 0xB7, 0x78, 0x4A, 0xCB, 0xD7, 0x59, 0xB7, 0x9C, 0xC1,
+    0x2E, 0xAC, 0x94, 0x0E, 0x6A, 0x53, 0x5B, 0xAF, 0x71, 0x2E, 0xA7, 0x3E, 0xD5, 0x7A, 0xA1, 0xA3,
+    0x46, 0x97, 0xF8, 0x1B, 0x40, 0xA1, 0x91, 0xB6, 0x0F, 0x26, 0x21, 0xB7, 0xFD, 0x8D, 0xE2, 0x2F,
+    0xE5, 0xDF, 0x96, 0x43, 0x2E, 0xD2, 0x51, 0x4A, 0x45, 0x26, 0x0D, 0xB9, 0xCC, 0x94, 0xEF, 0x7E,
+    0x77, 0x70, 0x7F, 0x16, 0xDA, 0x2F, 0x37, 0x37, 0x32, 0x5F, 0x15, 0x5C, 0x42, 0xA3, 0x98, 0xCB,
+    0x35, 0x7E, 0xA7, 0x41, 0x66, 0x44, 0xC2, 0x19, 0x93, 0xC3, 0x7E, 0xB7, 0x31, 0xEF, 0x74, 0x4C,
+    0x23, 0xCE, 0x51, 0xFC, 0xFE, 0x50, 0x78, 0x91, 0x2E, 0x97, 0x86, 0x0B, 0x50, 0xFE, 0xFE, 0x24,
+    0x6F, 0x4D, 0xEB, 0x06, 0x0F, 0x7F, 0xF2, 0x08, 0x6E, 0x37, 0x3E, 0x92, 0x53, 0xDE, 0xEF, 0x23,
+    0x6F, 0xC5, 0x23, 0x50, 0x5A, 0xCD, 0x6E, 0xCE, 0x98, 0xB8, 0x7C, 0x9D, 0x24, 0x22, 0x33, 0xE9,
+    0x88, 0x08, 0x66, 0xA0, 0x15, 0x4C, 0x80, 0xBA, 0xCA, 0x02, 0xB8, 0x26, 0xEF, 0xC0, 0x79, 0xDD,
+    0xE5, 0xAC, 0xF0, 0x6B, 0x82, 0xB1, 0xED, 0xDD, 0xAE, 0x1E, 0x2B, 0x1B, 0xCE, 0x00, 0x33, 0xAA,
+    0x49, 0xAE, 0xC5, 0x87, 0x23, 0xC0, 0xB2, 0xF1, 0x9B, 0x56, 0xD8, 0xF7, 0xFB, 0x05, 0xC2, 0x1D,
+    0xDC, 0xD9, 0xDA, 0x7C, 0xEC, 0x73, 0x99, 0x54, 0x79, 0x57, 0x4B, 0xD3, 0x3E, 0x7B, 0xBF, 0xFD,
+    0x72, 0x5F, 0x56, 0xEE, 0x26, 0x23, 0xAE, 0x37, 0x3D, 0x35, 0xB6, 0x21, 0x72, 0x8C, 0x1D, 0x99,
+    0x98, 0xC6, 0x44, 0xEE, 0x7C, 0x7D, 0x32, 0x12, 0xD3, 0x29, 0x95, 0x46, 0xB9, 0xA4, 0x5A, 0x71,
+    0xD8, 0x26, 0x91, 0x26, 0x97, 0x21, 0x97, 0x50, 0xFC, 0x75, 0x2C, 0xFF, 0x78, 0x74, 0xB8, 0x13,
+    0xE2, 0x31, 0x45, 0xE0, 0xE4, 0x2A, 0x79, 0xC7, 0x8D, 0x9B, 0xE4, 0x81, 0x93, 0x63, 0x8A, 0x81,
+    0x13, 0xC7, 0xCD, 0x29, 0x19, 0xCB, 0xB7, 0x46, 0xF7, 0x56, 0xB0, 0xD2, 0x5B, 0xE9, 0x52, 0xA9,
+    0xD2, 0x75, 0x83, 0xB1, 0x27, 0x0E, 0x08, 0xF5, 0x77, 0xFB, 0xDA, 0x6E, 0x36, 0x9B, 0xCD, 0xF5,
+    0x56, 0x57, 0xDD, 0x83, 0xD7, 0x83, 0x25, 0xFD, 0x43, 0x1C, 0x80, 0x60, 0x6A, 0x61, 0xEB, 0x3A,
+    0x97, 0xC5, 0x7D, 0x7A, 0xF3, 0x42, 0x7F, 0x55, 0xFC, 0xCB, 0x76, 0xC2, 0x3A, 0x19, 0xBA, 0x66,
+    0x2F, 0xB0, 0x99, 0xEA, 0x1F, 0xED, 0x1C, 0xA2, 0x66, 0xD7, 0x7A, 0xC5, 0x70, 0x78, 0xC5, 0xEA,
+    0xA7, 0x5D, 0xF1, 0xFB, 0x9B, 0xCD, 0x66, 0xA3, 0x29, 0x77, 0x7F, 0xB5, 0x18, 0x60, 0x22, 0x22,
+    0xD2, 0x5F, 0xB6, 0x77, 0x43, 0x74, 0x3F, 0xF3, 0xCB, 0xD7, 0x5F, 0xBE, 0x9C, 0xFC, 0x8B, 0x68,
+    0xDF, 0x0A, 0xEE, 0x8E, 0x9F, 0x5B, 0xF3, 0xE0, 0x57, 0xF7, 0xF1, 0xAF, 0x6F, 0x3F, 0x59, 0xAD,
+    0xE5, 0xAC, 0x4B, 0x45, 0xC6, 0xB8, 0x84, 0x77, 0x76, 0x49, 0xDE, 0xF5, 0x19, 0xC0, 0x99, 0xDB,
+    0xB5, 0xF2, 0x4A, 0x62, 0xE1, 0xD1, 0x82, 0x55, 0x4C, 0xB0, 0x3D, 0xE4, 0x7D, 0x16, 0xD0, 0x46,
+    0x70, 0xCB, 0x5A, 0xBE, 0x14, 0x10, 0x2D, 0x65, 0x00, 0xB4, 0x30, 0xA1, 0x45, 0x29, 0xB8, 0x26,
+    0x1D, 0x57, 0xFF, 0xD6, 0x76, 0x59, 0x58, 0x37, 0x09, 0xCD, 0x82, 0xEE, 0xB1, 0x52, 0x7A, 0xD4,
+    0xB3, 0x5B, 0x36, 0x61, 0x60, 0xBE, 0x0C, 0x70, 0xB9, 0xAE, 0x80, 0xD9, 0x35, 0x90, 0x44, 0x3D,
+    0x46, 0x9B, 0x04, 0xE6, 0x01, 0x32, 0xED, 0xED, 0xDB, 0x1B, 0xAD, 0x54, 0x8A, 0x68, 0xA2, 0xC2,
+    0x52, 0xE4, 0x53, 0x43, 0xAD, 0x11, 0xD5, 0x4A, 0x7B, 0x41, 0x6A, 0x59, 0x93, 0x1E, 0x6C, 0x82,
+    0x76, 0x90, 0x04, 0xED, 0x16, 0x91, 0x8E, 0xD6, 0x43, 0x12, 0xCB, 0x06, 0x50, 0x00, 0xE6, 0x4C,
+    0x53, 0xDE, 0xE7, 0x9D, 0x5F, 0x43, 0x11, 0xF7, 0xCC, 0xB3, 0x6C, 0xBF, 0x78, 0x1F, 0x32, 0x91,
+    0x89, 0x54, 0x44, 0x46, 0xEA, 0xFB, 0xBF, 0x27, 0x9D, 0x1D, 0x48, 0x44, 0x53, 0x1B, 0x5D, 0x03,
+    0xE5, 0xDD, 0x01, 0x92, 0x58, 0x03, 0xF6, 0x3B, 0x01, 0x98, 0x5A, 0xC0, 0xBE, 0x15, 0x80, 0xF9,
+    0x97, 0xFF, 0xB1, 0xBF, 0x0C, 0x5C, 0xFC, 0xE4, 0xAF, 0xE8, 0xEA, 0xFA, 0xF1, 0x60, 0x2C, 0xAE,
+    0x82, 0xE2, 0x6E, 0x04, 0x13, 0x75, 0x0F, 0x36, 0x69, 0x28, 0x83, 0x96, 0x4F, 0x17, 0x22, 0x52,
+    0x51, 0x8A, 0x34, 0x70, 0xF4, 0x2A, 0xEB, 0x5A, 0x96, 0xCA, 0x00, 0x56, 0x26, 0x28, 0xFF, 0x7C,
+    0x02, 0x57, 0xDD, 0x80, 0x96, 0x4B, 0x8B, 0xD0, 0xEE, 0x5F, 0xE6, 0xBF, 0xFD, 0x97, 0xB5, 0x29,
+    0xEA, 0x95, 0x34, 0x42, 0xFB, 0xDC, 0x00, 0xAD, 0xF4, 0x4B, 0x55, 0xDA, 0xD1, 0x9F, 0x1C, 0x86,
+    0xEE, 0xD5, 0x31, 0x1B, 0x97, 0xF8, 0x24, 0x8A, 0x86, 0xAE, 0x3B, 0xB3, 0xFD, 0xE2, 0x8F, 0xA3,
+    0x0A, 0xB8, 0xE6, 0x7A, 0xC8, 0x62, 0x1D, 0xC0, 0x4E, 0xFA, 0xEA, 0x3A, 0xC8, 0xE3, 0xC5, 0x83,
+    0x22, 0xF4, 0xA2, 0x03, 0x33, 0xBA, 0x00, 0xF9, 0x7A, 0x4C, 0x0F, 0x36, 0x16, 0xCD, 0x7E, 0xEB,
+    0xC5, 0x5F, 0xF4, 0x91, 0xDC, 0xDE, 0xF3, 0x79, 0x79, 0x38, 0xC6, 0xB0, 0xAB, 0x36, 0xFD, 0x08,
+    0xCE, 0xBB, 0x60, 0xA3, 0x89, 0x07, 0x85, 0x89, 0xFB, 0xC7, 0x13, 0xD4, 0x8D, 0xEB, 0xED, 0x98,
+    0xC5, 0xDD, 0x6E, 0xF5, 0xBF, 0xBA, 0x1B, 0xFE, 0x99, 0x88, 0xF6, 0xB3, 0xE5, 0x52, 0xE4, 0xF7,
+    0xE1, 0x9F, 0x66, 0x32, 0x91, 0x7B, 0x69, 0xE7, 0xE7, 0x06, 0x57, 0x95, 0x32, 0xA7, 0x9E, 0x42,
+    0x9A, 0x0B, 0x8F, 0xDD, 0x36, 0xE1, 0x77, 0xB6, 0xDB, 0xED, 0xF6, 0xA5, 0x3D, 0x60, 0xFF, 0xF8,
+    0x32, 0x5B, 0xB3, 0x3F, 0xE0, 0xEB, 0xDB, 0xED, 0x76, 0xAB, 0xAC, 0x54, 0xF7, 0x7C, 0xBC, 0x94,
+    0x3E, 0xFF, 0x8E, 0xC8, 0x7F, 0x88, 0x67, 0xA9, 0xC8, 0xEF, 0xFB, 0x4C, 0xFA, 0x27, 0x38, 0xBA,
+    0xC7, 0x93, 0x15, 0x97, 0x72, 0xA9, 0xCC, 0x5D, 0x91, 0x6A, 0xAA, 0xEF, 0x48, 0xFB, 0xCD, 0xAE,
+    0x90, 0xE1, 0x45, 0xCA, 0x09, 0xB8, 0xAC, 0x18, 0xDB, 0xB3, 0xF7, 0x2B, 0x7E, 0x5D, 0x2F, 0xFA,
+    0x46, 0x2B, 0x22, 0xF7, 0xF8, 0xF5, 0xED, 0xAB, 0x8F, 0xE9, 0xE0, 0xF2, 0x2F, 0x65, 0xBE, 0x9D,
+    0x8A, 0x88, 0x8C, 0x4E, 0x44, 0xE4, 0xEE, 0x3D, 0x48, 0x4E, 0x76, 0x7F, 0xBD, 0x86, 0xA6, 0x1A,
+    0x3B, 0xB6, 0xDB, 0x3B, 0xAF, 0xBA, 0x05, 0x5D, 0xED, 0xC9, 0x3B, 0xB5, 0x0F, 0x4D, 0x80, 0x24,
+    0x60, 0x44, 0xDD, 0xE1, 0xD9, 0x89, 0x48, 0x73, 0x8C, 0xDA, 0x92, 0xE6, 0xC0, 0xFD, 0xDA, 0x5C,
+    0x97, 0x73, 0x69, 0xE7, 0x0F, 0x57, 0xCB, 0xEF, 0x61, 0x8A, 0x43, 0x88, 0xFF, 0xDC, 0x63, 0xFF,
+    0xD7, 0xED, 0x41, 0x3E, 0x7B, 0xEE, 0xD5, 0x77, 0x68, 0x47, 0x52, 0xE9, 0xC9, 0xA5, 0xA1, 0x9C,
+    0xB4, 0xA2, 0xC2, 0xF5, 0x1A, 0x41, 0xA7, 0x1E, 0x59, 0xDA, 0x03, 0x49, 0x83, 0xB6, 0x5A, 0x6C,
+    0x87, 0x65, 0x37, 0xBF, 0xE2, 0x91, 0x09, 0xFB, 0x83, 0xD5, 0xEC, 0x5F, 0x73, 0xC8, 0xD2, 0x99,
+    0xA5, 0x45, 0x8D, 0x5E, 0xA3, 0x42, 0x29, 0xDD, 0x0E, 0x9A, 0xB9, 0x85, 0x0B, 0xD0, 0x0E, 0x1C,
+    0x2D, 0x9D, 0xDE, 0xEA, 0x89, 0x44, 0x06, 0xED, 0x87, 0x65, 0xAB, 0xC7, 0xB0, 0xC4, 0xB9, 0x5F,
+    0x58, 0x42, 0x26, 0x1E, 0x6E, 0xE8, 0x2D, 0xD5, 0x1D, 0x99, 0x74, 0xD4, 0xD3, 0xB9, 0xB7, 0xFB,
+    0x64, 0x72, 0x9B, 0x7A, 0x24, 0x93, 0x86, 0x7A, 0x04, 0x69, 0xB0, 0xA3, 0x0E, 0x50, 0x7A, 0x28,
+    0x66, 0x52, 0xE9, 0xA0, 0x7C, 0xF4, 0xDD, 0x48, 0x07, 0xA5, 0x5E, 0x87, 0xBA, 0xD7, 0x2C, 0x8F,
+    0x1B, 0x4B, 0x7E, 0x5C, 0xB5, 0x4F, 0x1E, 0x30, 0x9D, 0x4E, 0x76, 0xAD, 0xDB, 0xB7, 0x2C, 0xBF,
+    0xBE, 0x7B, 0x3F, 0x5A, 0xDE, 0x53, 0xE9, 0x78, 0x61, 0x79, 0x2F, 0x27, 0x2D, 0x8C, 0x2A, 0x03,
+    0xB4, 0x81, 0x5C, 0xA0, 0x1D, 0xC9, 0xA5, 0xA2, 0x1E, 0xC9, 0xF5, 0x4E, 0x0F, 0xDF, 0x26, 0xF2,
+    0xA5, 0xD0, 0xA7, 0xD5, 0x1F, 0x33, 0x9D, 0x86, 0x5B, 0x2E, 0x29, 0x9B, 0x54, 0xEC, 0xFD, 0x79,
+    0x99, 0x15, 0x90, 0xD1, 0xEE, 0x04, 0xFD, 0x5E, 0xE9, 0x9C, 0xF7, 0xD2, 0x0F, 0x5E, 0xE5, 0xE0,
+    0xF5, 0xE0, 0xFB, 0xA5, 0xE7, 0x56, 0xDC, 0x29, 0xE2, 0x44, 0xFA, 0x43, 0x2F, 0x7D, 0xD9, 0x1D,
+    0x61, 0xF7, 0x70, 0x07, 0xD8, 0xD8, 0x01, 0x6A, 0xA4, 0x2D, 0xE2, 0x7F, 0xEF, 0xFE, 0x66, 0xC1,
+    0x95, 0xF6, 0xBD, 0x09, 0x67, 0x3B, 0x61, 0x3B, 0x0A, 0xDD, 0xE8, 0xD8, 0x53, 0x34, 0xD4, 0x95,
+    0x76, 0x59, 0xC5, 0x41, 0x0B, 0xB7, 0x40, 0x74, 0x17, 0x73, 0x88, 0xD0, 0x92, 0x8C, 0x6B, 0xCC,
+    0xB9, 0x6E, 0x4C, 0x00, 0xD7, 0x65, 0x3D, 0x14, 0x43, 0xDE, 0x41, 0x3E, 0x7F, 0xCA, 0xAF, 0xFB,
+    0x20, 0x2F, 0x48, 0x56, 0xD2, 0x2A, 0x92, 0xF5, 0xF0, 0x3D, 0x2D, 0xBE, 0xCF, 0xB8, 0x0F, 0xB9,
+    0x3E, 0x54, 0x15, 0x79, 0xE0, 0xEB, 0xB8, 0x03, 0x7C, 0xE4, 0x14, 0x36, 0x9B, 0x4D, 0x3C, 0xA4,
+    0xF6, 0xB4, 0xA3, 0x76, 0xD6, 0xB7, 0x01, 0xF2, 0xCE, 0x0E, 0x2B, 0xFE, 0x52, 0xF8, 0x64, 0x82,
+    0xB2, 0x62, 0x06, 0xC7, 0x82, 0xD4, 0x08, 0x9C, 0x9D, 0xAF, 0x4D, 0x9C, 0x49, 0x47, 0xD2, 0x69,
+    0xCD, 0x5B, 0x0B, 0x14, 0x03, 0x79, 0xFF, 0x78, 0x6A, 0x3F, 0x7A, 0x4F, 0xD3, 0xC1, 0xB0, 0xC6,
+    0x87, 0xAA, 0x5C, 0x1F, 0xA2, 0xF9, 0x83, 0x1D, 0x42, 0xA7, 0x8B, 0xCE, 0xA3, 0x08, 0x5D, 0xFB,
+    0x08, 0x43, 0xFC, 0x34, 0x84, 0xAE, 0x18, 0xF6, 0x6D, 0x16, 0xCE, 0x23, 0x74, 0xED, 0x63, 0x15,
+    0x51, 0x29, 0x22, 0x22, 0x87, 0xAF, 0xBA, 0x6F, 0xF5, 0x21, 0xDF, 0x6E, 0xB7, 0xDB, 0x3B, 0x87,
+    0xE8, 0xD2, 0x2F, 0xC8, 0xB7, 0xF1, 0x11, 0xBE, 0xED, 0xDE, 0x8B, 0x6F, 0xCF, 0x29, 0xCA, 0xF1,
+    0xF0, 0x55, 0x83, 0x0B, 0x40, 0xAB, 0xF1, 0xFE, 0xF9, 0xAC, 0xED, 0xC1, 0x35, 0x57, 0xD2, 0x08,
+    0x91, 0x2B, 0x9A, 0x83, 0x7E, 0x05, 0xEB, 0x73, 0xCF, 0x15, 0x4C, 0x6F, 0x2B, 0xAE, 0x90, 0x84,
+    0x12, 0xAE, 0xC0, 0x78, 0x15, 0xAE, 0xC0, 0x8D, 0x1B, 0x70, 0x05, 0xAE, 0x9E, 0xC0, 0x15, 0x38,
+    0xD6, 0x74, 0xA0, 0xE3, 0xF6, 0xD0, 0xA9, 0x99, 0xF7, 0x7F, 0xBB, 0x02, 0xC7, 0xCB, 0x09, 0x7A,
+    0xFA, 0xC9, 0x72, 0xB1, 0xE5, 0xD2, 0xCB, 0x0F, 0x2D, 0x3F, 0xCB, 0xC4, 0x15, 0x6A, 0x70, 0xDD,
+    0x95, 0x2C, 0xEE, 0x6E, 0x70, 0xB9, 0x5D, 0x12, 0x6D, 0x27, 0xF7, 0xD0, 0x18, 0x36, 0x3A, 0x06,
+    0x74, 0x0C, 0x4B, 0x1E, 0x3D, 0x3A, 0x06, 0x74, 0x0C, 0xE8, 0x18, 0xD0, 0x31, 0xA0, 0x63, 0x40,
+    0xC7, 0x80, 0xDE, 0x27, 0x8F, 0x1B, 0xC3, 0xC1, 0xDF, 0x96, 0x13, 0xF4, 0xF4, 0x93, 0xE5, 0x62,
+    0xCB, 0xA5, 0x97, 0x1F, 0x5A, 0x7E, 0x16, 0xED, 0xE4, 0x8B, 0xEB, 0xD0, 0x31, 0x6C, 0x7F, 0xFE,
+    0x31, 0x38, 0x65, 0x92, 0xDA, 0xE7, 0x02, 0x89, 0xF4, 0xF6, 0x53, 0x9E, 0xEC, 0x47, 0xA1, 0x34,
+    0x81, 0xC2, 0x8F, 0x57, 0x89, 0xD4, 0xDC, 0xB8, 0x81, 0x4B, 0x22, 0x57, 0x4F, 0xB0, 0xDF, 0x08,
+    0x1C, 0xBF, 0x8E, 0x11, 0xCF, 0x33, 0xAF, 0x83, 0xC0, 0x33, 0xAF, 0x93, 0x08, 0x3C, 0x73, 0x42,
+    0x26, 0x9E, 0xE3, 0x13, 0x8A, 0xBB, 0x81, 0xE3, 0x1B, 0xD4, 0x44, 0xAE, 0x5E, 0x4D, 0x22, 0x8E,
+    0x1B, 0x65, 0x16, 0xB0, 0x7E, 0xB4, 0xCF, 0x7B, 0xCC, 0x8F, 0x42, 0x2E, 0xA0, 0x1D, 0xB8, 0xC1,
+    0x1D, 0x8E, 0xE1, 0xE8, 0x17, 0x1D, 0xC3, 0x32, 0x0F, 0x4E, 0xE7, 0x41, 0x7A, 0x5B, 0x81, 0xF9,
+    0x51, 0x28, 0x01, 0xEB, 0x47, 0xB5, 0x26, 0x6E, 0xDC, 0x00, 0x22, 0x57, 0x4F, 0xC0, 0x04, 0x8E,
+    0x4F, 0xC0, 0xEA, 0x18, 0x1C, 0x3C, 0xF3, 0x3A, 0x44, 0x78, 0xE6, 0x04, 0x13, 0xE0, 0xF8, 0x44,
+    0x53, 0xE5, 0x6E, 0xE0, 0x74, 0x1E, 0x22, 0x70, 0xA3, 0x34, 0x01, 0x18, 0xED, 0xA7, 0x3C, 0x24,
+    0x3A, 0x06, 0xA3, 0x63, 0xF8, 0x19, 0xE7, 0xE1, 0xE2, 0x5E, 0x6F, 0x96, 0xCD, 0xDF, 0xF2, 0xC7,
+    0x8B, 0x9B, 0x4F, 0x4F, 0x9B, 0xCD, 0xC3, 0xB5, 0x83, 0xE1, 0xC9, 0xE7, 0xA2, 0x7C, 0x77, 0xAA,
+    0xFD, 0xB5, 0xF7, 0x37, 0xA4, 0xB7, 0x49, 0x5E, 0x76, 0xAA, 0x40, 0x63, 0x1D, 0x28, 0x47, 0xB5,
+    0x5B, 0xCB, 0x51, 0x2D, 0x57, 0x1B, 0xC8, 0xC6, 0x8B, 0x6A, 0x6D, 0x3F, 0xAC, 0x02, 0x7E, 0xFD,
+    0xF6, 0xB2, 0x5A, 0xA6, 0x22, 0xCF, 0x29, 0x2E, 0x62, 0x45, 0xE4, 0x2D, 0x75, 0xDF, 0xAB, 0x42,
+    0x34, 0x3F, 0x66, 0x5A, 0xD6, 0x45, 0x92, 0xB8, 0x2E, 0x70, 0x66, 0x58, 0xB7, 0x28, 0x30, 0x61,
+    0xB5, 0xBA, 0xB3, 0xDD, 0xA7, 0xE2, 0xED, 0xCD, 0x67, 0xDE, 0xBE, 0xCE, 0xB2, 0x43, 0x89, 0x4C,
+    0xBB, 0x52, 0xC2, 0xB5, 0xF7, 0xE5, 0xD2, 0xC8, 0x4B, 0x33, 0x5B, 0x17, 0x35, 0xBB, 0x94, 0x32,
+    0xBB, 0x6A, 0xA9, 0x62, 0xA6, 0xDE, 0xC1, 0xF2, 0xF5, 0x6E, 0x53, 0x81, 0xB3, 0xDD, 0x5E, 0x09,
+    0xD3, 0x6E, 0x7F, 0x9F, 0xB8, 0xE2, 0x3D, 0x49, 0x5C, 0x97, 0x86, 0x74, 0x7F, 0xA3, 0xE3, 0x1A,
+    0x00, 0x31, 0xC3, 0xBA, 0xF3, 0xA9, 0x09, 0x2B, 0xE2, 0xB3, 0xBF, 0xE5, 0xBC, 0x5F, 0xE3, 0xCE,
+    0x76, 0xFF, 0xA9, 0x5B, 0xFD, 0xB0, 0xE2, 0xF0, 0x96, 0x1F, 0xBA, 0xD1, 0xF7, 0x51, 0x7B, 0xBD,
+    0x29, 0x57, 0xC9, 0xF4, 0xCF, 0x95, 0x76, 0xF2, 0xEE, 0xD2, 0xD0, 0xD2, 0x49, 0xD7, 0x2A, 0xE4,
+    0x93, 0xCF, 0xE7, 0x1A, 0x7F, 0x3D, 0xA5, 0x0A, 0x79, 0x6D, 0x94, 0x24, 0xAF, 0x49, 0xA3, 0x89,
+    0x5C, 0xB3, 0xAE, 0xBA, 0x49, 0x60, 0x69, 0x34, 0x7D, 0x10, 0x9E, 0x88, 0x87, 0x5E, 0x23, 0xD4,
+    0xDF, 0xDE, 0xBC, 0xAA, 0x5D, 0x2C, 0x24, 0x2E, 0xC4, 0x0E, 0x4A, 0xE0, 0xD2, 0x2B, 0xB1, 0x66,
+    0x1D, 0xB8, 0x86, 0xC7, 0x3B, 0xBD, 0xF5, 0x7A, 0xD9, 0xFC, 0x59, 0x33, 0xFE, 0xC9, 0x97, 0x62,
+    0x29, 0x35, 0x42, 0x60, 0xF9, 0x3A, 0x0B, 0x3A, 0xE4, 0x72, 0x19, 0xDC, 0xAC, 0xBD, 0x3E, 0xCC,
+    0x80, 0xED, 0xB5, 0x57, 0x85, 0x7B, 0xDE, 0x43, 0x4D, 0x22, 0x5A, 0x32, 0x99, 0x2D, 0xBB, 0x6C,
+    0xD9, 0xA5, 0x92, 0xF1, 0xC2, 0x41, 0xF8, 0x6C, 0x75, 0x67, 0x75, 0x1C, 0x97, 0xF4, 0x6B, 0x33,
+    0x68, 0x40, 0xD2, 0x2E, 0x95, 0x18, 0x6E, 0x41, 0xD4, 0xCB, 0xF1, 0xE1, 0x9A, 0x02, 0xE0, 0xA9,
+    0xB9, 0x5E, 0x8A, 0xD9, 0xB5, 0x81, 0xD8, 0x83, 0x3B, 0xF3, 0x92, 0xFC, 0xB7, 0xD0, 0x6B, 0xF5,
+    0xB9, 0x35, 0x95, 0x6F, 0x99, 0xEB, 0x75, 0xA6, 0xF3, 0x65, 0x9E, 0x8B, 0xB7, 0xAF, 0x67, 0x41,
+    0x5B, 0x90, 0x67, 0x01, 0x0A, 0x91, 0x31, 0xEF, 0x0F, 0x58, 0x72, 0x65, 0x48, 0x57, 0x29, 0xA9,
+    0x5C, 0xA5, 0x94, 0xAC, 0x17, 0x43, 0xA0, 0x5D, 0x86, 0xB0, 0xB2, 0xE1, 0xCA, 0x84, 0x71, 0xBF,
+    0xE9, 0xC9, 0x74, 0xC0, 0x7E, 0x66, 0x24, 0x59, 0x88, 0x96, 0x8E, 0x57, 0xF4, 0x76, 0xEE, 0x6B,
+    0x92, 0x8F, 0x91, 0xA0, 0x89, 0xFB, 0x0B, 0xD5, 0xB4, 0xB9, 0x54, 0xA7, 0x7E, 0xD4, 0xDA, 0x6C,
+    0x78, 0xED, 0x49, 0xA1, 0x64, 0x7B, 0xDF, 0x1A, 0x84, 0xAD, 0x96, 0x0D, 0x5F, 0x16, 0xAF, 0x60,
+    0xA5, 0x5B, 0x3E, 0x9F, 0x17, 0xED, 0xA7, 0x14, 0x7D, 0x4C, 0x97, 0x22, 0x74, 0x15, 0xC2, 0x1F,
+    0xCC, 0xED, 0x4E, 0xBA, 0x1B, 0xB3, 0x84, 0x09, 0x52, 0xD1, 0x0D, 0xA8, 0xF6, 0xF2, 0x8D, 0xD9,
+    0xF7, 0x18, 0xD8, 0x4B, 0xF8, 0x81, 0xBC, 0xA8, 0x8C, 0x6F, 0xFE, 0xEB, 0x66, 0x15, 0x72, 0x91,
+    0x6E, 0x5F, 0x30, 0xDC, 0xED, 0x68, 0x5A, 0xF8, 0x1D, 0x59, 0x95, 0xA2, 0x0D, 0x85, 0xD7, 0x81,
+    0xA9, 0x00, 0xB9, 0x6A, 0x27, 0xEA, 0x6E, 0x2F, 0xEB, 0xED, 0x5E, 0xD8, 0xE7, 0x3D, 0xA1, 0xA7,
+    0x9D, 0xB8, 0xEB, 0xF6, 0x32, 0x11, 0x26, 0x9D, 0x68, 0xA5, 0xB8, 0x19, 0x77, 0x12, 0x6F, 0x86,
+    0x4B, 0x2B, 0x1B, 0x64, 0xE1, 0x6B, 0x2B, 0x27, 0xE4, 0x3F, 0x0E, 0xEB, 0x20, 0xAC, 0x74, 0xAB,
+    0xD4, 0x5B, 0xA9, 0x56, 0xB1, 0xCF, 0xC7, 0x9D, 0xDC, 0x27, 0xD5, 0x39, 0xC1, 0x3F, 0x90, 0xFC,
+    0xBD, 0x8E, 0xDA, 0xCB, 0xFE, 0x81, 0xF0, 0x1F, 0x48, 0xFF, 0x81, 0xF8, 0x3F, 0x2C, 0xFF, 0x0B,
+    0x42, 0xA2, 0x66, 0xEB, 0x2B, 0xA4, 0xF2, 0x17, 0x4B, 0x62, 0xD5, 0x60, 0x97, 0xD9, 0x72, 0x22,
+    0xFF, 0xF6, 0xC1, 0xC1, 0x6C, 0x2D, 0xBB, 0xAB, 0x55, 0xB4, 0x0B, 0x01, 0x0B, 0x8D, 0xA1, 0x76,
+    0x7A, 0xCB, 0xEB, 0xDC, 0xE8, 0x74, 0x1D, 0x10, 0x48, 0xB3, 0x64, 0x64, 0xB3, 0x69, 0x37, 0x95,
+    0x6B, 0x40, 0xA3, 0x8B, 0x83, 0xDD, 0xCD, 0x97, 0xEE, 0xA1, 0xA7, 0x32, 0xA2, 0xD4, 0x1C, 0xF7,
+    0x5A, 0x75, 0xDE, 0x2B, 0x62, 0x1D, 0xB6, 0xF5, 0x3B, 0xBA, 0x64, 0x8B, 0x8E, 0x32, 0x41, 0x57,
+    0x83, 0x54, 0x95, 0xED, 0xC1, 0x8C, 0xE9, 0x79, 0x7B, 0xE2, 0xE9, 0x79, 0xF9, 0xFA, 0x7B, 0xE1,
+    0x70, 0xCA, 0x98, 0x2E, 0xEC, 0xCE, 0xAB, 0x33, 0x0D, 0x25, 0xB9, 0x86, 0xE2, 0x9B, 0xDD, 0xEE,
+    0x3C, 0xE9, 0xD7, 0x39, 0x4B, 0xA5, 0xDF, 0x9D, 0x57, 0x77, 0x7A, 0xDE, 0xD9, 0x42, 0xCF, 0xFD,
+    0xC2, 0x71, 0x38, 0x69, 0x7B, 0x6D, 0xDE, 0x64, 0x71, 0x55, 0xF1, 0x93, 0x91, 0xB7, 0x9F, 0x0A,
+    0x0F, 0xCF, 0x9A, 0x95, 0xA1, 0x5C, 0xC3, 0x7B, 0x6D, 0xB7, 0xEE, 0xD7, 0xFA, 0xD0, 0xCC, 0xAD,
+    0x07, 0xD8, 0xB5, 0x98, 0xC2, 0xBD, 0x35, 0xAE, 0x8B, 0x54, 0xD8, 0xA9, 0xEB, 0xCF, 0x2E, 0xD6,
+    0xC3, 0xD2, 0x44, 0x68, 0x58, 0x7C, 0xAF, 0x2C, 0x2C, 0xE5, 0x5F, 0x79, 0x58, 0xEE, 0xAA, 0x78,
+    0x7B, 0xF3, 0xFC, 0xF7, 0xAF, 0xB3, 0xEC, 0xDD, 0x1D, 0x77, 0xD3, 0xA4, 0x92, 0xA4, 0x6E, 0xC8,
+    0x2A, 0x2E, 0x3B, 0x61, 0xC1, 0x55, 0x0B, 0xFB, 0xD5, 0x07, 0x6E, 0xCB, 0x2E, 0x06, 0x32, 0xAD,
+    0x2B, 0xE5, 0xEA, 0x95, 0x26, 0xAB, 0x2B, 0x98, 0xAE, 0x91, 0xB0, 0xA5, 0x1B, 0xCC, 0x88, 0x19,
+    0xE8, 0x96, 0xB5, 0x22, 0x53, 0xB8, 0x26, 0x1B, 0x4A, 0xBF, 0xE8, 0x2A, 0xA9, 0x16, 0x65, 0x35,
+    0xE9, 0x02, 0xA9, 0x83, 0xB7, 0xDD, 0x12, 0xED, 0xD9, 0x35, 0x47, 0xDF, 0x35, 0xD1, 0x59, 0xE8,
+    0xBF, 0xAA, 0xAC, 0x9D, 0xCE, 0xDA, 0x29, 0xAD, 0x9D, 0xD6, 0x3A, 0xAF, 0xB6, 0xD8, 0xBC, 0xB2,
+    0xE8, 0x2C, 0xF5, 0xE5, 0x55, 0xDB, 0xE7, 0x4B, 0xAD, 0xEE, 0x4D, 0xA5, 0x55, 0x1A, 0x76, 0x5B,
+    0x0F, 0x47, 0xE0, 0xC9, 0x96, 0xFC, 0xED, 0xEB, 0xE4, 0x12, 0x33, 0x6D, 0xB6, 0x11, 0x6A, 0x11,
+    0x6F, 0xFB, 0xBC, 0xC9, 0x06, 0x96, 0x26, 0x6B, 0xCA, 0x9F, 0xED, 0xB2, 0x37, 0xEA, 0xB8, 0x34,
+    0xF6, 0xED, 0x34, 0xA7, 0xC6, 0x69, 0x2F, 0x9A, 0x75, 0x17, 0xAB, 0xBC, 0x57, 0x48, 0xD6, 0x55,
+    0xEA, 0x35, 0xAA, 0xF7, 0xD8, 0x65, 0x01, 0xAE, 0xE1, 0xAA, 0xC2, 0x1F, 0x65, 0x1D, 0x91, 0x96,
+    0x93, 0xB2, 0xCB, 0x7A, 0x13, 0x8B, 0xBE, 0x7D, 0xD0, 0x92, 0x8B, 0x20, 0x12, 0x28, 0xA4, 0xA7,
+    0x9D, 0x74, 0x15, 0xBB, 0xC8, 0xA3, 0xDB, 0x04, 0xFD, 0xF6, 0xAE, 0xF4, 0xED, 0xA0, 0xA2, 0x4F,
+    0x09, 0xB1, 0x6C, 0x2C, 0x44, 0xB9, 0xD2, 0xE8, 0xEC, 0xF7, 0x96, 0x9D, 0x69, 0xFA, 0x85, 0xB2,
+    0xB9, 0x5F, 0xD8, 0xA6, 0xF4, 0x8B, 0xE7, 0xDB, 0xFE, 0xD9, 0xAB, 0x9C, 0x29, 0xC5, 0xA4, 0x73,
+    0x8D, 0xF2, 0x4F, 0x28, 0x7B, 0xF5, 0x3E, 0xC7, 0x62, 0x5C, 0xCC, 0x03, 0xAB, 0x6D, 0x32, 0x25,
+    0xDA, 0x25, 0x9B, 0x70, 0x28, 0xA4, 0x2F, 0x45, 0x64, 0xAE, 0x0A, 0x19, 0x35, 0xBD, 0xCC, 0xC9,
+    0xA4, 0x3D, 0xBA, 0x35, 0xA7, 0x70, 0x24, 0x13, 0xE9, 0x92, 0x25, 0x3B, 0xA1, 0xA2, 0x96, 0xA8,
+    0x7D, 0x4C, 0x0B, 0x89, 0xAA, 0xA3, 0x32, 0x99, 0xB4, 0xDD, 0x63, 0x22, 0xB3, 0xEE, 0x4B, 0xB6,
+    0x6C, 0xCB, 0x01, 0x14, 0xF2, 0xD6, 0xBA, 0xDB, 0x0B, 0x3A, 0xD5, 0xC9, 0xBC, 0x04, 0xBF, 0xB4,
+    0x53, 0x19, 0x40, 0xF1, 0x47, 0xEB, 0xC2, 0xB2, 0x72, 0x43, 0xB2, 0x86, 0x11, 0x97, 0xE2, 0xC7,
+    0x35, 0xA0, 0xF8, 0xFF, 0x02,
 };
 
 static const EpdGlyph bookerly_18_italicGlyphs[] = {
@@ -2684,7 +2792,7 @@ static const EpdGlyph bookerly_18_italicGlyphs[] = {
     { 11, 34, 11, 0, 29, 94, 12687 }, // |
     { 15, 38, 15, -2, 31, 143, 12781 }, // }
     { 18, 7, 24, 3, 16, 32, 12924 }, // ~
-    { 0, 0, 8, 0, 0, 0, 0 }, //  
+    { 0, 0, 8, 0, 0, 0, 12956 }, //  
     { 11, 30, 12, -1, 21, 83, 0 }, // ¡
     { 18, 38, 24, 3, 30, 171, 83 }, // ¢
     { 24, 28, 24, -1, 27, 168, 254 }, // £
@@ -2695,642 +2803,649 @@ static const EpdGlyph bookerly_18_italicGlyphs[] = {
     { 13, 6, 23, 5, 29, 20, 919 }, // ¨
     { 28, 28, 30, 1, 27, 196, 939 }, // ©
     { 15, 18, 16, 1, 27, 68, 1135 }, // ª
-    { 18, 15, 20, 1, 17, 68, 1203 }, // «
-    { 17, 9, 24, 3, 18, 39, 1271 }, // ¬
-    { 12, 4, 14, 1, 12, 12, 1310 }, // ­
-    { 20, 21, 22, 1, 30, 105, 1322 }, // ®
-    { 13, 3, 23, 5, 27, 10, 1427 }, // ¯
-    { 14, 13, 20, 3, 27, 46, 1437 }, // °
-    { 17, 23, 24, 3, 23, 98, 1483 }, // ±
-    { 15, 18, 17, 1, 32, 68, 1581 }, // ²
-    { 14, 19, 17, 1, 32, 67, 1649 }, // ³
-    { 8, 10, 23, 8, 32, 20, 1716 }, // ´
-    { 24, 30, 23, -1, 20, 180, 1736 }, // µ
-    { 24, 33, 22, -1, 27, 198, 1916 }, // ¶
-    { 6, 7, 12, 3, 14, 11, 2114 }, // ·
-    { 9, 9, 23, 7, -1, 21, 2125 }, // ¸
-    { 10, 18, 17, 3, 32, 45, 2146 }, // ¹
-    { 14, 18, 17, 2, 27, 63, 2191 }, // º
-    { 19, 15, 20, 0, 17, 72, 2254 }, // »
-    { 37, 30, 41, 3, 28, 278, 2326 }, // ¼
-    { 36, 30, 41, 3, 28, 270, 2604 }, // ½
-    { 39, 30, 41, 1, 28, 293, 2874 }, // ¾
-    { 13, 29, 16, 0, 21, 95, 3167 }, // ¿
-    { 29, 37, 28, -3, 37, 269, 3262 }, // À
-    { 29, 37, 28, -3, 37, 269, 3531 }, // Á
-    { 29, 37, 28, -3, 37, 269, 3800 }, // Â
-    { 29, 36, 28, -3, 36, 261, 4069 }, // Ã
-    { 29, 35, 28, -3, 35, 254, 4330 }, // Ä
-    { 29, 38, 28, -3, 38, 276, 4584 }, // Å
-    { 37, 27, 34, -3, 27, 250, 4860 }, // Æ
-    { 23, 37, 24, 1, 27, 213, 5110 }, // Ç
-    { 24, 37, 23, -1, 37, 222, 5323 }, // È
-    { 24, 37, 23, -1, 37, 222, 5545 }, // É
-    { 24, 37, 23, -1, 37, 222, 5767 }, // Ê
-    { 24, 35, 23, -1, 35, 210, 5989 }, // Ë
-    { 17, 37, 14, -1, 37, 158, 6199 }, // Ì
-    { 18, 37, 14, -1, 37, 167, 6357 }, // Í
-    { 19, 37, 14, -1, 37, 176, 6524 }, // Î
-    { 19, 35, 14, -1, 35, 167, 6700 }, // Ï
-    { 28, 28, 28, -1, 27, 196, 6867 }, // Ð
-    { 32, 37, 29, -1, 36, 296, 7063 }, // Ñ
-    { 26, 38, 28, 1, 37, 247, 7359 }, // Ò
-    { 26, 38, 28, 1, 37, 247, 7606 }, // Ó
-    { 26, 38, 28, 1, 37, 247, 7853 }, // Ô
-    { 26, 37, 28, 1, 36, 241, 8100 }, // Õ
-    { 26, 36, 28, 1, 35, 234, 8341 }, // Ö
-    { 16, 16, 24, 4, 21, 64, 8575 }, // ×
-    { 30, 28, 28, -1, 27, 210, 8639 }, // Ø
-    { 28, 38, 29, 3, 37, 266, 8849 }, // Ù
-    { 28, 38, 29, 3, 37, 266, 9115 }, // Ú
-    { 28, 38, 29, 3, 37, 266, 9381 }, // Û
-    { 28, 36, 29, 3, 35, 252, 9647 }, // Ü
-    { 25, 37, 25, 2, 37, 232, 9899 }, // Ý
-    { 23, 27, 23, -1, 27, 156, 10131 }, // Þ
-    { 29, 39, 24, -6, 30, 283, 10287 }, // ß
-    { 21, 32, 22, 1, 31, 168, 10570 }, // à
-    { 21, 33, 22, 1, 32, 174, 10738 }, // á
-    { 21, 32, 22, 1, 31, 168, 10912 }, // â
-    { 21, 31, 22, 1, 30, 163, 11080 }, // ã
-    { 21, 30, 22, 1, 29, 158, 11243 }, // ä
-    { 21, 33, 22, 1, 32, 174, 11401 }, // å
-    { 28, 21, 29, 1, 20, 147, 11575 }, // æ
-    { 15, 30, 17, 1, 20, 113, 11722 }, // ç
-    { 16, 32, 18, 1, 31, 128, 11835 }, // è
-    { 17, 33, 18, 1, 32, 141, 11963 }, // é
-    { 17, 32, 18, 1, 31, 136, 12104 }, // ê
-    { 18, 30, 18, 1, 29, 135, 12240 }, // ë
-    { 10, 32, 13, 2, 31, 80, 12375 }, // ì
-    { 13, 33, 13, 2, 32, 108, 12455 }, // í
-    { 13, 32, 13, 2, 31, 104, 12563 }, // î
-    { 14, 30, 13, 2, 29, 105, 12667 }, // ï
-    { 19, 32, 21, 1, 31, 152, 12772 }, // ð
-    { 22, 31, 23, 1, 30, 171, 12924 }, // ñ
-    { 19, 32, 21, 1, 31, 152, 13095 }, // ò
-    { 19, 33, 21, 1, 32, 157, 13247 }, // ó
-    { 19, 32, 21, 1, 31, 152, 13404 }, // ô
-    { 19, 31, 21, 1, 30, 148, 13556 }, // õ
-    { 20, 30, 21, 1, 29, 150, 13704 }, // ö
-    { 17, 18, 24, 3, 22, 77, 13854 }, // ÷
-    { 24, 22, 21, -2, 21, 132, 13931 }, // ø
-    { 22, 32, 23, 1, 31, 176, 14063 }, // ù
-    { 22, 33, 23, 1, 32, 182, 14239 }, // ú
-    { 22, 32, 23, 1, 31, 176, 14421 }, // û
-    { 22, 30, 23, 1, 29, 165, 14597 }, // ü
-    { 24, 41, 20, -4, 32, 246, 14762 }, // ý
-    { 23, 39, 21, -3, 30, 225, 15008 }, // þ
-    { 24, 38, 20, -4, 29, 228, 15233 }, // ÿ
-    { 29, 34, 28, -3, 34, 247, 0 }, // Ā
-    { 21, 28, 22, 1, 27, 147, 247 }, // ā
-    { 29, 36, 28, -3, 36, 261, 394 }, // Ă
-    { 21, 31, 22, 1, 30, 163, 655 }, // ă
-    { 29, 36, 28, -3, 28, 261, 818 }, // Ą
-    { 21, 28, 22, 1, 20, 147, 1079 }, // ą
-    { 23, 38, 24, 1, 37, 219, 1226 }, // Ć
-    { 17, 33, 17, 1, 32, 141, 1445 }, // ć
-    { 23, 38, 24, 1, 37, 219, 1586 }, // Ĉ
-    { 17, 32, 17, 1, 31, 136, 1805 }, // ĉ
-    { 23, 37, 24, 1, 36, 213, 1941 }, // Ċ
-    { 15, 30, 17, 1, 29, 113, 2154 }, // ċ
-    { 24, 38, 24, 1, 37, 228, 2267 }, // Č
-    { 19, 32, 17, 1, 31, 152, 2495 }, // č
-    { 28, 38, 28, -1, 37, 266, 2647 }, // Ď
-    { 28, 34, 23, 1, 33, 238, 2913 }, // ď
-    { 28, 28, 28, -1, 27, 196, 3151 }, // Đ
-    { 23, 31, 22, 1, 30, 179, 3347 }, // đ
-    { 24, 34, 23, -1, 34, 204, 3526 }, // Ē
-    { 18, 28, 18, 1, 27, 126, 3730 }, // ē
-    { 24, 36, 23, -1, 36, 216, 3856 }, // Ĕ
-    { 18, 31, 18, 1, 30, 140, 4072 }, // ĕ
-    { 24, 36, 23, -1, 36, 216, 4212 }, // Ė
-    { 16, 30, 18, 1, 29, 120, 4428 }, // ė
-    { 24, 35, 23, -1, 27, 210, 4548 }, // Ę
-    { 16, 28, 18, 1, 20, 112, 4758 }, // ę
-    { 25, 37, 23, -1, 37, 232, 4870 }, // Ě
-    { 19, 32, 18, 1, 31, 152, 5102 }, // ě
-    { 24, 38, 27, 2, 37, 228, 5254 }, // Ĝ
-    { 25, 40, 19, -4, 31, 250, 5482 }, // ĝ
-    { 24, 37, 27, 2, 36, 222, 5732 }, // Ğ
-    { 25, 39, 19, -4, 30, 244, 5954 }, // ğ
-    { 24, 37, 27, 2, 36, 222, 6198 }, // Ġ
-    { 25, 38, 19, -4, 29, 238, 6420 }, // ġ
-    { 24, 37, 27, 2, 27, 222, 6658 }, // Ģ
-    { 25, 41, 19, -4, 32, 257, 6880 }, // ģ
-    { 33, 37, 30, -1, 37, 306, 7137 }, // Ĥ
-    { 21, 40, 23, 1, 39, 210, 7443 }, // ĥ
-    { 33, 27, 30, -1, 27, 223, 7653 }, // Ħ
-    { 21, 31, 23, 1, 30, 163, 7876 }, // ħ
-    { 18, 36, 14, -1, 36, 162, 8039 }, // Ĩ
-    { 14, 31, 13, 2, 30, 109, 8201 }, // ĩ
-    { 18, 34, 14, -1, 34, 153, 8310 }, // Ī
-    { 14, 28, 13, 2, 27, 98, 8463 }, // ī
-    { 19, 36, 14, -1, 36, 171, 8561 }, // Ĭ
-    { 14, 31, 13, 2, 30, 109, 8732 }, // ĭ
-    { 17, 35, 14, -1, 27, 149, 8841 }, // Į
-    { 12, 38, 12, 1, 30, 114, 8990 }, // į
-    { 17, 36, 14, -1, 36, 153, 9104 }, // İ
-    { 9, 21, 12, 2, 20, 48, 9257 }, // ı
-    { 31, 35, 28, -1, 27, 272, 9305 }, // Ĳ
-    { 23, 39, 23, 2, 30, 225, 9577 }, // ĳ
-    { 25, 45, 13, -7, 37, 282, 9802 }, // Ĵ
-    { 22, 40, 11, -7, 31, 220, 10084 }, // ĵ
-    { 29, 37, 27, -1, 27, 269, 10304 }, // Ķ
-    { 19, 40, 20, 1, 30, 190, 10573 }, // ķ
-    { 19, 21, 21, 1, 20, 100, 10763 }, // ĸ
-    { 22, 37, 22, -1, 37, 204, 10863 }, // Ĺ
-    { 14, 40, 12, 1, 39, 140, 11067 }, // ĺ
-    { 22, 37, 22, -1, 27, 204, 11207 }, // Ļ
-    { 12, 40, 12, -1, 30, 120, 11411 }, // ļ
-    { 23, 30, 22, -1, 30, 173, 11531 }, // Ľ
-    { 17, 34, 13, 1, 33, 145, 11704 }, // ľ
-    { 23, 27, 22, -1, 27, 156, 11849 }, // Ŀ
-    { 16, 31, 15, 1, 30, 124, 12005 }, // ŀ
-    { 22, 27, 22, -1, 27, 149, 12129 }, // Ł
-    { 14, 31, 12, -1, 30, 109, 12278 }, // ł
-    { 32, 38, 29, -1, 37, 304, 12387 }, // Ń
-    { 22, 33, 23, 1, 32, 182, 12691 }, // ń
-    { 32, 37, 29, -1, 27, 296, 12873 }, // Ņ
-    { 22, 30, 23, 1, 20, 165, 13169 }, // ņ
-    { 32, 38, 29, -1, 37, 304, 13334 }, // Ň
-    { 22, 32, 23, 1, 31, 176, 13638 }, // ň
-    { 29, 30, 31, 2, 29, 218, 13814 }, // ŉ
-    { 32, 35, 29, -1, 27, 280, 14032 }, // Ŋ
-    { 20, 29, 22, 1, 20, 145, 14312 }, // ŋ
-    { 26, 35, 28, 1, 34, 228, 14457 }, // Ō
-    { 19, 28, 21, 1, 27, 133, 14685 }, // ō
-    { 26, 37, 28, 1, 36, 241, 14818 }, // Ŏ
-    { 20, 31, 21, 1, 30, 155, 15059 }, // ŏ
-    { 28, 38, 28, 1, 37, 266, 15214 }, // Ő
-    { 21, 32, 21, 1, 31, 168, 15480 }, // ő
-    { 36, 28, 37, 1, 27, 252, 15648 }, // Œ
-    { 29, 21, 31, 1, 20, 153, 15900 }, // œ
-    { 25, 38, 25, -1, 37, 238, 16053 }, // Ŕ
-    { 17, 32, 16, 1, 32, 136, 16291 }, // ŕ
-    { 25, 37, 25, -1, 27, 232, 16427 }, // Ŗ
-    { 18, 30, 16, -1, 20, 135, 16659 }, // ŗ
-    { 25, 38, 25, -1, 37, 238, 16794 }, // Ř
-    { 18, 31, 16, 1, 31, 140, 17032 }, // ř
-    { 20, 38, 20, 0, 37, 190, 17172 }, // Ś
-    { 17, 33, 16, 0, 32, 141, 17362 }, // ś
-    { 20, 38, 20, 0, 37, 190, 17503 }, // Ŝ
-    { 17, 32, 16, 0, 31, 136, 17693 }, // ŝ
-    { 20, 37, 20, 0, 27, 185, 17829 }, // Ş
-    { 15, 30, 16, 0, 20, 113, 18014 }, // ş
-    { 21, 38, 20, 0, 37, 200, 18127 }, // Š
-    { 18, 32, 16, 0, 31, 144, 18327 }, // š
-    { 23, 37, 24, 3, 27, 213, 18471 }, // Ţ
-    { 15, 35, 15, 0, 25, 132, 18684 }, // ţ
-    { 23, 37, 24, 3, 37, 213, 18816 }, // Ť
-    { 16, 32, 15, 1, 31, 128, 19029 }, // ť
-    { 23, 27, 24, 3, 27, 156, 19157 }, // Ŧ
-    { 15, 26, 15, 0, 25, 98, 19313 }, // ŧ
-    { 28, 37, 29, 3, 36, 259, 19411 }, // Ũ
-    { 22, 31, 23, 1, 30, 171, 19670 }, // ũ
-    { 28, 35, 29, 3, 34, 245, 19841 }, // Ū
-    { 22, 28, 23, 1, 27, 154, 20086 }, // ū
-    { 28, 37, 29, 3, 36, 259, 20240 }, // Ŭ
-    { 22, 31, 23, 1, 30, 171, 20499 }, // ŭ
-    { 28, 39, 29, 3, 38, 273, 20670 }, // Ů
-    { 22, 33, 23, 1, 32, 182, 20943 }, // ů
-    { 28, 38, 29, 3, 37, 266, 21125 }, // Ű
-    { 22, 32, 23, 1, 31, 176, 21391 }, // ű
-    { 28, 35, 29, 3, 27, 245, 21567 }, // Ų
-    { 22, 28, 23, 1, 20, 154, 21812 }, // ų
-    { 39, 38, 40, 3, 37, 371, 21966 }, // Ŵ
-    { 29, 32, 29, 0, 31, 232, 22337 }, // ŵ
-    { 25, 37, 25, 2, 37, 232, 22569 }, // Ŷ
-    { 24, 40, 20, -4, 31, 240, 22801 }, // ŷ
-    { 25, 35, 25, 2, 35, 219, 23041 }, // Ÿ
-    { 23, 38, 22, -1, 37, 219, 23260 }, // Ź
-    { 18, 33, 18, 0, 32, 149, 23479 }, // ź
-    { 23, 37, 22, -1, 36, 213, 23628 }, // Ż
-    { 18, 30, 18, 0, 29, 135, 23841 }, // ż
-    { 23, 38, 22, -1, 37, 219, 23976 }, // Ž
-    { 18, 32, 18, 0, 31, 144, 24195 }, // ž
-    { 27, 39, 16, -7, 30, 264, 24339 }, // ſ
-    { 8, 9, 0, -6, 31, 18, 0 }, // ̀
-    { 8, 10, 0, -3, 32, 20, 18 }, // ́
-    { 13, 9, 0, -7, 31, 30, 38 }, // ̂
-    { 12, 7, 0, -6, 30, 21, 68 }, // ̃
-    { 12, 3, 0, -6, 27, 9, 89 }, // ̄
-    { 13, 7, 0, -6, 30, 23, 98 }, // ̆
-    { 6, 6, 0, -3, 29, 9, 121 }, // ̇
-    { 14, 6, 0, -7, 29, 21, 130 }, // ̈
-    { 10, 11, 0, -5, 33, 28, 151 }, // ̉
-    { 10, 11, 0, -5, 32, 28, 179 }, // ̊
-    { 15, 9, 0, -7, 31, 34, 207 }, // ̋
-    { 13, 9, 0, -6, 31, 30, 241 }, // ̌
-    { 11, 9, 0, -7, 31, 25, 271 }, // ̏
-    { 13, 8, 0, -7, 30, 26, 296 }, // ̑
-    { 8, 11, 0, -4, 32, 22, 322 }, // ̒
-    { 8, 11, 0, -3, 33, 22, 344 }, // ̓
-    { 6, 11, 0, -4, 33, 17, 366 }, // ̔
-    { 6, 10, 0, -3, 33, 15, 383 }, // ̕
-    { 8, 9, 0, -4, 24, 18, 398 }, // ̛
-    { 6, 6, 0, -3, -3, 9, 416 }, // ̣
-    { 14, 6, 0, -7, -3, 21, 425 }, // ̤
-    { 9, 9, 0, -4, -1, 21, 446 }, // ̥
-    { 7, 9, 0, -4, -1, 16, 467 }, // ̦
-    { 8, 9, 0, -4, -1, 18, 483 }, // ̧
-    { 8, 9, 0, -4, 1, 18, 501 }, // ̨
-    { 6, 8, 10, -1, -2, 12, 519 }, // ̩
-    { 13, 8, 0, -7, -2, 26, 531 }, // ̭
-    { 12, 7, 0, -6, -2, 21, 557 }, // ̮
-    { 12, 7, 0, -6, -2, 21, 578 }, // ̰
-    { 12, 3, 0, -6, -4, 9, 599 }, // ̱
-    { 13, 8, 0, -7, 30, 26, 608 }, // ͂
-    { 14, 15, 0, -8, 38, 53, 634 }, // ̈́
-    { 7, 8, 0, -2, -2, 14, 687 }, // ͅ
-    { 24, 37, 23, -1, 37, 222, 0 }, // Ѐ
-    { 24, 35, 23, -1, 35, 210, 222 }, // Ё
-    { 23, 35, 28, 3, 27, 202, 432 }, // Ђ
-    { 24, 37, 22, -1, 37, 222, 634 }, // Ѓ
-    { 23, 28, 24, 1, 27, 161, 856 }, // Є
-    { 20, 28, 20, 0, 27, 140, 1017 }, // Ѕ
-    { 17, 27, 14, -1, 27, 115, 1157 }, // І
-    { 19, 35, 14, -1, 35, 167, 1272 }, // Ї
-    { 23, 35, 13, -7, 27, 202, 1439 }, // Ј
-    { 35, 28, 34, -2, 27, 245, 1641 }, // Љ
-    { 36, 28, 35, -1, 27, 252, 1886 }, // Њ
-    { 24, 27, 30, 3, 27, 162, 2138 }, // Ћ
-    { 28, 38, 26, -1, 37, 266, 2300 }, // Ќ
-    { 33, 37, 30, -1, 37, 306, 2566 }, // Ѝ
-    { 27, 39, 24, 1, 38, 264, 2872 }, // Ў
-    { 31, 36, 29, -1, 27, 279, 3136 }, // Џ
-    { 29, 28, 28, -3, 28, 203, 3415 }, // А
-    { 24, 28, 23, -1, 27, 168, 3618 }, // Б
-    { 23, 28, 24, -1, 27, 161, 3786 }, // В
-    { 24, 27, 22, -1, 27, 162, 3947 }, // Г
-    { 31, 35, 27, -3, 27, 272, 4109 }, // Д
-    { 24, 27, 23, -1, 27, 162, 4381 }, // Е
-    { 40, 28, 36, -3, 27, 280, 4543 }, // Ж
-    { 19, 28, 21, 0, 27, 133, 4823 }, // З
-    { 33, 27, 30, -1, 27, 223, 4956 }, // И
-    { 33, 38, 30, -1, 38, 314, 5179 }, // Й
-    { 28, 28, 26, -1, 27, 196, 5493 }, // К
-    { 30, 28, 26, -2, 27, 210, 5689 }, // Л
-    { 36, 27, 34, -2, 27, 243, 5899 }, // М
-    { 33, 27, 30, -1, 27, 223, 6142 }, // Н
-    { 26, 28, 28, 1, 27, 182, 6365 }, // О
-    { 31, 27, 29, -1, 27, 210, 6547 }, // П
-    { 23, 27, 23, -1, 27, 156, 6757 }, // Р
-    { 23, 28, 24, 1, 27, 161, 6913 }, // С
-    { 23, 27, 24, 3, 27, 156, 7074 }, // Т
-    { 27, 28, 24, 1, 27, 189, 7230 }, // У
-    { 26, 29, 28, 1, 28, 189, 7419 }, // Ф
-    { 30, 27, 26, -3, 27, 203, 7608 }, // Х
-    { 31, 35, 29, -1, 27, 272, 7811 }, // Ц
-    { 25, 27, 26, 2, 27, 169, 8083 }, // Ч
-    { 40, 27, 38, -1, 27, 270, 8252 }, // Ш
-    { 40, 35, 38, -1, 27, 350, 8522 }, // Щ
-    { 23, 28, 27, 3, 27, 161, 8872 }, // Ъ
-    { 37, 28, 35, -1, 27, 259, 9033 }, // Ы
-    { 22, 28, 22, -1, 27, 154, 9292 }, // Ь
-    { 22, 28, 24, 0, 27, 154, 9446 }, // Э
-    { 38, 28, 38, -1, 27, 266, 9600 }, // Ю
-    { 27, 28, 24, -2, 27, 189, 9866 }, // Я
-    { 21, 21, 22, 1, 20, 111, 10055 }, // а
-    { 22, 32, 21, 1, 31, 176, 10166 }, // б
-    { 17, 21, 19, 1, 20, 90, 10342 }, // в
-    { 15, 21, 17, 1, 20, 79, 10432 }, // г
-    { 19, 31, 21, 1, 30, 148, 10511 }, // д
-    { 16, 21, 18, 1, 20, 84, 10659 }, // е
-    { 34, 21, 34, 0, 20, 179, 10743 }, // ж
-    { 16, 21, 17, 0, 20, 84, 10922 }, // з
-    { 22, 21, 23, 1, 20, 116, 11006 }, // и
-    { 22, 32, 23, 1, 31, 176, 11122 }, // й
-    { 20, 21, 21, 1, 20, 105, 11298 }, // к
-    { 23, 21, 23, -1, 20, 121, 11403 }, // л
-    { 29, 21, 29, 0, 20, 153, 11524 }, // м
-    { 22, 21, 23, 1, 20, 116, 11677 }, // н
-    { 19, 21, 21, 1, 20, 100, 11793 }, // о
-    { 22, 21, 23, 1, 20, 116, 11893 }, // п
-    { 24, 29, 22, -3, 20, 174, 12009 }, // р
-    { 15, 21, 17, 1, 20, 79, 12183 }, // с
-    { 32, 21, 34, 1, 20, 168, 12262 }, // т
-    { 24, 29, 20, -4, 20, 174, 12430 }, // у
-    { 24, 39, 27, 1, 30, 234, 12604 }, // ф
-    { 23, 21, 21, -1, 20, 121, 12838 }, // х
-    { 22, 28, 23, 1, 20, 154, 12959 }, // ц
-    { 21, 21, 22, 1, 20, 111, 13113 }, // ч
-    { 30, 21, 32, 1, 20, 158, 13224 }, // ш
-    { 31, 28, 32, 1, 20, 217, 13382 }, // щ
-    { 18, 21, 20, 1, 20, 95, 13599 }, // ъ
-    { 27, 21, 29, 1, 20, 142, 13694 }, // ы
-    { 16, 21, 18, 1, 20, 84, 13836 }, // ь
-    { 17, 21, 18, 0, 20, 90, 13920 }, // э
-    { 28, 21, 30, 1, 20, 147, 14010 }, // ю
-    { 21, 21, 21, -1, 20, 111, 14157 }, // я
-    { 16, 32, 18, 1, 31, 128, 14268 }, // ѐ
-    { 18, 30, 18, 1, 29, 135, 14396 }, // ё
-    { 19, 39, 22, 1, 30, 186, 14531 }, // ђ
-    { 15, 33, 17, 1, 32, 124, 14717 }, // ѓ
-    { 16, 21, 18, 1, 20, 84, 14841 }, // є
-    { 15, 21, 16, 0, 20, 79, 14925 }, // ѕ
-    { 11, 31, 12, 2, 30, 86, 15004 }, // і
-    { 14, 30, 12, 2, 29, 105, 15090 }, // ї
-    { 19, 39, 11, -7, 30, 186, 15195 }, // ј
-    { 28, 21, 28, -1, 20, 147, 15381 }, // љ
-    { 25, 21, 27, 1, 20, 132, 15528 }, // њ
-    { 21, 31, 23, 1, 30, 163, 15660 }, // ћ
-    { 20, 33, 21, 1, 32, 165, 15823 }, // ќ
-    { 22, 32, 23, 1, 31, 176, 15988 }, // ѝ
-    { 24, 40, 20, -4, 31, 240, 16164 }, // ў
-    { 22, 28, 23, 1, 20, 154, 16404 }, // џ
-    { 23, 31, 26, 2, 30, 179, 16558 }, // Ѣ
-    { 26, 21, 28, 1, 20, 137, 16737 }, // ѣ
-    { 26, 28, 28, 1, 27, 182, 16874 }, // Ѳ
-    { 19, 21, 21, 1, 20, 100, 17056 }, // ѳ
-    { 27, 28, 28, 3, 27, 189, 17156 }, // Ѵ
-    { 23, 21, 21, 0, 20, 121, 17345 }, // ѵ
-    { 33, 46, 30, -1, 38, 380, 17466 }, // Ҋ
-    { 22, 39, 23, 1, 31, 215, 17846 }, // ҋ
-    { 22, 28, 22, -1, 27, 154, 18061 }, // Ҍ
-    { 16, 29, 19, 2, 28, 116, 18215 }, // ҍ
-    { 23, 27, 23, -1, 27, 156, 18331 }, // Ҏ
-    { 24, 29, 22, -3, 20, 174, 18487 }, // ҏ
-    { 25, 32, 21, -1, 32, 200, 18661 }, // Ґ
-    { 19, 26, 17, 0, 25, 124, 18861 }, // ґ
-    { 24, 27, 22, -1, 27, 162, 18985 }, // Ғ
-    { 15, 21, 17, 1, 20, 79, 19147 }, // ғ
-    { 24, 35, 23, -1, 27, 210, 19226 }, // Ҕ
-    { 17, 29, 20, 2, 20, 124, 19436 }, // ҕ
-    { 40, 35, 36, -3, 27, 350, 19560 }, // Җ
-    { 34, 28, 34, 0, 20, 238, 19910 }, // җ
-    { 19, 35, 21, 0, 27, 167, 20148 }, // Ҙ
-    { 16, 28, 17, 0, 20, 112, 20315 }, // ҙ
-    { 28, 35, 26, -1, 27, 245, 20427 }, // Қ
-    { 20, 28, 21, 1, 20, 140, 20672 }, // қ
-    { 30, 28, 28, -1, 27, 210, 20812 }, // Ҝ
-    { 22, 21, 23, 1, 20, 116, 21022 }, // ҝ
-    { 28, 28, 26, -1, 27, 196, 21138 }, // Ҟ
-    { 20, 29, 21, 1, 28, 145, 21334 }, // ҟ
-    { 29, 28, 30, 3, 27, 203, 21479 }, // Ҡ
-    { 22, 21, 23, 1, 20, 116, 21682 }, // ҡ
-    { 33, 35, 30, -1, 27, 289, 21798 }, // Ң
-    { 22, 28, 24, 1, 20, 154, 22087 }, // ң
-    { 38, 27, 35, -1, 27, 257, 22241 }, // Ҥ
-    { 27, 21, 28, 1, 20, 142, 22498 }, // ҥ
-    { 38, 35, 39, -1, 27, 333, 22640 }, // Ҧ
-    { 30, 29, 32, 1, 20, 218, 22973 }, // ҧ
-    { 28, 28, 30, 1, 27, 196, 23191 }, // Ҩ
-    { 23, 22, 24, 1, 21, 127, 23387 }, // ҩ
-    { 23, 35, 24, 1, 27, 202, 23514 }, // Ҫ
-    { 15, 28, 17, 1, 20, 105, 23716 }, // ҫ
-    { 23, 35, 24, 3, 27, 202, 23821 }, // Ҭ
-    { 32, 28, 34, 1, 20, 224, 24023 }, // ҭ
-    { 25, 27, 25, 2, 27, 169, 24247 }, // Ү
-    { 19, 29, 20, 0, 20, 138, 24416 }, // ү
-    { 25, 27, 25, 2, 27, 169, 24554 }, // Ұ
-    { 19, 29, 20, 0, 20, 138, 24723 }, // ұ
-    { 30, 35, 26, -3, 27, 263, 24861 }, // Ҳ
-    { 23, 28, 21, -1, 20, 161, 25124 }, // ҳ
-    { 33, 35, 32, 1, 27, 289, 25285 }, // Ҵ
-    { 22, 35, 23, 1, 27, 193, 25574 }, // ҵ
-    { 25, 35, 26, 2, 27, 219, 25767 }, // Ҷ
-    { 21, 28, 23, 1, 20, 147, 25986 }, // ҷ
-    { 25, 27, 26, 2, 27, 169, 26133 }, // Ҹ
-    { 21, 21, 22, 1, 20, 111, 26302 }, // ҹ
-    { 24, 27, 25, -1, 27, 162, 26413 }, // Һ
-    { 21, 31, 23, 1, 30, 163, 26575 }, // һ
-    { 28, 28, 30, 1, 27, 196, 26738 }, // Ҽ
-    { 21, 21, 22, 0, 20, 111, 26934 }, // ҽ
-    { 28, 36, 30, 1, 27, 252, 27045 }, // Ҿ
-    { 21, 28, 22, 0, 20, 147, 27297 }, // ҿ
-    { 17, 27, 14, -1, 27, 115, 27444 }, // Ӏ
-    { 40, 39, 36, -3, 38, 390, 27559 }, // Ӂ
-    { 34, 32, 34, 0, 31, 272, 27949 }, // ӂ
-    { 28, 35, 26, -1, 27, 245, 28221 }, // Ӄ
-    { 19, 29, 21, 1, 20, 138, 28466 }, // ӄ
-    { 30, 35, 26, -2, 27, 263, 28604 }, // Ӆ
-    { 23, 28, 23, -1, 20, 161, 28867 }, // ӆ
-    { 33, 35, 30, -1, 27, 289, 29028 }, // Ӈ
-    { 20, 29, 22, 1, 20, 145, 29317 }, // ӈ
-    { 33, 35, 30, -1, 27, 289, 29462 }, // Ӊ
-    { 22, 28, 24, 1, 20, 154, 29751 }, // ӊ
-    { 25, 35, 26, 2, 27, 219, 29905 }, // Ӌ
-    { 20, 28, 21, 1, 20, 140, 30124 }, // ӌ
-    { 36, 35, 34, -2, 27, 315, 30264 }, // Ӎ
-    { 29, 28, 29, 0, 20, 203, 30579 }, // ӎ
-    { 17, 29, 12, -2, 29, 124, 30782 }, // ӏ
-    { 29, 38, 28, -3, 38, 276, 30906 }, // Ӑ
-    { 21, 32, 22, 1, 31, 168, 31182 }, // ӑ
-    { 29, 35, 28, -3, 35, 254, 31350 }, // Ӓ
-    { 21, 30, 22, 1, 29, 158, 31604 }, // ӓ
-    { 37, 27, 34, -3, 27, 250, 31762 }, // Ӕ
-    { 28, 21, 29, 1, 20, 147, 32012 }, // ӕ
-    { 24, 38, 23, -1, 38, 228, 32159 }, // Ӗ
-    { 18, 32, 18, 1, 31, 144, 32387 }, // ӗ
-    { 23, 28, 24, 0, 27, 161, 32531 }, // Ә
-    { 16, 21, 18, 1, 20, 84, 32692 }, // ә
-    { 23, 36, 24, 0, 35, 207, 32776 }, // Ӛ
-    { 17, 30, 18, 1, 29, 128, 32983 }, // ӛ
-    { 40, 36, 36, -3, 35, 360, 33111 }, // Ӝ
-    { 34, 30, 34, 0, 29, 255, 33471 }, // ӝ
-    { 20, 36, 21, 0, 35, 180, 33726 }, // Ӟ
-    { 18, 30, 17, 0, 29, 135, 33906 }, // ӟ
-    { 23, 28, 22, -1, 27, 161, 34041 }, // Ӡ
-    { 22, 29, 20, -3, 20, 160, 34202 }, // ӡ
-    { 33, 34, 30, -1, 34, 281, 34362 }, // Ӣ
-    { 22, 28, 23, 1, 27, 154, 34643 }, // ӣ
-    { 33, 35, 30, -1, 35, 289, 34797 }, // Ӥ
-    { 22, 30, 23, 1, 29, 165, 35086 }, // ӥ
-    { 26, 36, 28, 1, 35, 234, 35251 }, // Ӧ
-    { 20, 30, 21, 1, 29, 150, 35485 }, // ӧ
-    { 26, 28, 28, 1, 27, 182, 35635 }, // Ө
-    { 19, 21, 21, 1, 20, 100, 35817 }, // ө
-    { 26, 36, 28, 1, 35, 234, 35917 }, // Ӫ
-    { 20, 30, 21, 1, 29, 150, 36151 }, // ӫ
-    { 22, 36, 24, 0, 35, 198, 36301 }, // Ӭ
-    { 18, 30, 18, 0, 29, 135, 36499 }, // ӭ
-    { 27, 35, 24, 1, 34, 237, 36634 }, // Ӯ
-    { 24, 36, 20, -4, 27, 216, 36871 }, // ӯ
-    { 27, 36, 24, 1, 35, 243, 37087 }, // Ӱ
-    { 24, 38, 20, -4, 29, 228, 37330 }, // ӱ
-    { 27, 38, 24, 1, 37, 257, 37558 }, // Ӳ
-    { 24, 40, 20, -4, 31, 240, 37815 }, // ӳ
-    { 25, 35, 26, 2, 35, 219, 38055 }, // Ӵ
-    { 21, 30, 22, 1, 29, 158, 38274 }, // ӵ
-    { 24, 35, 22, -1, 27, 210, 38432 }, // Ӷ
-    { 15, 28, 17, 1, 20, 105, 38642 }, // ӷ
-    { 37, 36, 35, -1, 35, 333, 38747 }, // Ӹ
-    { 27, 30, 29, 1, 29, 203, 39080 }, // ӹ
-    { 24, 35, 22, -1, 27, 210, 39283 }, // Ӻ
-    { 15, 28, 17, 1, 20, 105, 39493 }, // ӻ
-    { 30, 35, 26, -3, 27, 263, 39598 }, // Ӽ
-    { 23, 29, 21, -1, 20, 167, 39861 }, // ӽ
-    { 30, 27, 26, -3, 27, 203, 40028 }, // Ӿ
-    { 23, 21, 21, -1, 20, 121, 40231 }, // ӿ
-    { 0, 0, 19, 0, 0, 0, 0 }, //  
-    { 0, 0, 38, 0, 0, 0, 0 }, //  
-    { 0, 0, 19, 0, 0, 0, 0 }, //  
-    { 0, 0, 38, 0, 0, 0, 0 }, //  
-    { 0, 0, 13, 0, 0, 0, 0 }, //  
-    { 0, 0, 10, 0, 0, 0, 0 }, //  
-    { 0, 0, 6, 0, 0, 0, 0 }, //  
-    { 0, 0, 24, 0, 0, 0, 0 }, //  
-    { 0, 0, 10, 0, 0, 0, 0 }, //  
-    { 0, 0, 8, 0, 0, 0, 0 }, //  
-    { 0, 0, 2, 0, 0, 0, 0 }, //  
-    { 0, 0, 0, 0, 0, 0, 0 }, // ​
-    { 2, 31, 0, -1, 22, 16, 0 }, // ‌
-    { 8, 34, 0, -4, 25, 68, 16 }, // ‍
-    { 14, 36, 0, -7, 27, 126, 84 }, // ‎
-    { 14, 36, 0, -7, 27, 126, 210 }, // ‏
-    { 12, 4, 14, 1, 12, 12, 336 }, // ‐
-    { 12, 4, 14, 1, 12, 12, 348 }, // ‑
-    { 18, 4, 24, 3, 15, 18, 360 }, // ‒
-    { 19, 4, 19, 0, 12, 19, 378 }, // –
-    { 38, 4, 38, 0, 12, 38, 397 }, // —
-    { 38, 4, 38, 0, 12, 38, 435 }, // ―
-    { 13, 39, 19, 3, 30, 127, 473 }, // ‖
-    { 19, 9, 19, 0, -1, 43, 600 }, // ‗
-    { 8, 13, 11, 3, 29, 26, 643 }, // ‘
-    { 8, 12, 11, 2, 29, 24, 669 }, // ’
-    { 8, 12, 11, 1, 5, 24, 693 }, // ‚
-    { 7, 13, 9, 1, 29, 23, 717 }, // ‛
-    { 16, 13, 19, 3, 29, 52, 740 }, // “
-    { 16, 13, 19, 2, 29, 52, 792 }, // ”
-    { 16, 12, 19, 1, 5, 48, 844 }, // „
-    { 15, 13, 17, 1, 29, 49, 892 }, // ‟
-    { 16, 25, 18, 2, 27, 100, 941 }, // †
-    { 18, 29, 18, 0, 27, 131, 1041 }, // ‡
-    { 9, 9, 11, 1, 14, 21, 1172 }, // •
-    { 14, 14, 24, 5, 20, 49, 1193 }, // ‣
-    { 6, 6, 10, 2, 5, 9, 1242 }, // ․
-    { 15, 6, 19, 2, 5, 23, 1251 }, // ‥
-    { 32, 6, 38, 3, 5, 48, 1274 }, // …
-    { 6, 6, 10, 2, 13, 9, 1322 }, // ‧
-    { 0, 0, 0, 0, 0, 0, 1331 }, //  
-    { 0, 0, 0, 0, 0, 0, 1331 }, //  
-    { 14, 36, 0, -7, 27, 126, 1331 }, // ‪
-    { 14, 36, 0, -7, 27, 126, 1457 }, // ‫
-    { 12, 35, 0, -6, 26, 105, 1583 }, // ‬
-    { 16, 36, 0, -8, 27, 144, 1688 }, // ‭
-    { 16, 36, 0, -8, 27, 144, 1832 }, // ‮
-    { 0, 0, 4, 0, 0, 0, 1976 }, //  
-    { 48, 30, 52, 2, 28, 360, 1976 }, // ‰
-    { 8, 13, 10, 1, 27, 26, 2336 }, // ′
-    { 16, 13, 17, 1, 27, 52, 2362 }, // ″
-    { 23, 13, 25, 1, 27, 75, 2414 }, // ‴
-    { 8, 13, 10, 1, 27, 26, 2489 }, // ‵
-    { 16, 13, 18, 1, 27, 52, 2515 }, // ‶
-    { 24, 13, 27, 1, 27, 78, 2567 }, // ‷
-    { 17, 8, 19, 1, 0, 34, 2645 }, // ‸
-    { 11, 15, 12, 1, 17, 42, 2679 }, // ‹
-    { 11, 15, 12, 0, 17, 42, 2721 }, // ›
-    { 24, 26, 24, 0, 25, 156, 2763 }, // ※
-    { 21, 30, 22, 2, 29, 158, 2919 }, // ‼
-    { 19, 3, 19, 0, 31, 15, 3077 }, // ‾
-    { 9, 4, 11, 1, 12, 9, 3092 }, // ⁃
-    { 23, 30, 9, -7, 28, 173, 3101 }, // ⁄
-    { 28, 29, 31, 3, 28, 203, 3274 }, // ⁇
-    { 24, 30, 27, 3, 29, 180, 3477 }, // ⁈
-    { 25, 30, 27, 2, 29, 188, 3657 }, // ⁉
-    { 22, 6, 38, 8, 14, 33, 3845 }, // ⁓
-    { 30, 13, 32, 1, 27, 98, 3878 }, // ⁗
-    { 0, 0, 8, 0, 0, 0, 3976 }, //  
-    { 0, 0, 0, 0, 0, 0, 3976 }, // ⁠
-    { 0, 0, 0, 0, 0, 0, 3976 }, // ⁡
-    { 0, 0, 0, 0, 0, 0, 3976 }, // ⁢
-    { 0, 0, 0, 0, 0, 0, 3976 }, // ⁣
-    { 0, 0, 0, 0, 0, 0, 3976 }, // ⁤
-    { 15, 19, 17, 1, 32, 72, 0 }, // ⁰
-    { 15, 18, 17, 1, 32, 68, 72 }, // ⁴
-    { 15, 18, 17, 1, 31, 68, 140 }, // ⁵
-    { 15, 19, 17, 2, 32, 72, 208 }, // ⁶
-    { 13, 18, 17, 4, 31, 59, 280 }, // ⁷
-    { 14, 19, 17, 2, 32, 67, 339 }, // ⁸
-    { 14, 19, 17, 1, 32, 67, 406 }, // ⁹
-    { 14, 14, 22, 4, 27, 49, 473 }, // ⁿ
-    { 15, 19, 17, 1, 13, 72, 522 }, // ₀
-    { 10, 18, 17, 3, 13, 45, 594 }, // ₁
-    { 15, 18, 17, 1, 13, 68, 639 }, // ₂
-    { 14, 19, 17, 1, 13, 67, 707 }, // ₃
-    { 15, 18, 17, 1, 13, 68, 774 }, // ₄
-    { 15, 18, 17, 1, 12, 68, 842 }, // ₅
-    { 15, 19, 17, 2, 13, 72, 910 }, // ₆
-    { 13, 18, 17, 4, 12, 59, 982 }, // ₇
-    { 14, 19, 17, 2, 13, 67, 1041 }, // ₈
-    { 14, 19, 17, 1, 13, 67, 1108 }, // ₉
-    { 24, 26, 24, 0, 26, 156, 0 }, // ₣
-    { 24, 28, 24, -1, 27, 168, 156 }, // ₤
-    { 46, 28, 48, 0, 27, 322, 324 }, // ₧
-    { 26, 28, 24, -1, 27, 182, 646 }, // €
-    { 22, 16, 38, 8, 21, 88, 0 }, // ←
-    { 16, 25, 38, 11, 26, 100, 88 }, // ↑
-    { 22, 16, 38, 8, 21, 88, 188 }, // →
-    { 16, 25, 38, 11, 26, 100, 276 }, // ↓
-    { 24, 16, 38, 7, 21, 96, 376 }, // ↔
-    { 16, 26, 38, 11, 26, 104, 472 }, // ↕
-    { 16, 25, 38, 11, 26, 100, 576 }, // ↨
-    { 16, 25, 38, 11, 26, 100, 676 }, // ↲
-    { 16, 25, 38, 11, 26, 100, 776 }, // ↳
-    { 20, 18, 38, 9, 22, 90, 876 }, // ↵
-    { 22, 17, 38, 8, 22, 94, 966 }, // ⇐
-    { 18, 22, 38, 10, 24, 99, 1060 }, // ⇑
-    { 22, 17, 38, 8, 22, 94, 1159 }, // ⇒
-    { 18, 22, 38, 10, 24, 99, 1253 }, // ⇓
-    { 24, 17, 38, 7, 22, 102, 1352 }, // ⇔
-    { 26, 28, 38, 6, 27, 182, 0 }, // ∀
-    { 19, 31, 24, 2, 30, 148, 182 }, // ∂
-    { 18, 27, 38, 10, 27, 122, 330 }, // ∃
-    { 28, 30, 38, 5, 28, 210, 452 }, // ∅
-    { 23, 27, 25, 1, 27, 156, 662 }, // ∆
-    { 24, 28, 38, 7, 27, 168, 818 }, // ∇
-    { 24, 27, 38, 7, 27, 162, 986 }, // ∈
-    { 24, 33, 38, 7, 29, 198, 1148 }, // ∉
-    { 24, 21, 38, 7, 24, 126, 1346 }, // ∊
-    { 24, 27, 38, 7, 27, 162, 1472 }, // ∋
-    { 24, 33, 38, 7, 29, 198, 1634 }, // ∌
-    { 24, 21, 38, 7, 24, 126, 1832 }, // ∍
-    { 29, 33, 31, 1, 27, 240, 1958 }, // ∏
-    { 23, 34, 23, 0, 27, 196, 2198 }, // ∑
-    { 17, 4, 24, 3, 15, 17, 2394 }, // −
-    { 21, 30, 19, -1, 28, 158, 2411 }, // ∕
-    { 15, 30, 19, 2, 28, 113, 2569 }, // ∖
-    { 17, 18, 24, 3, 22, 77, 2682 }, // ∗
-    { 13, 13, 24, 5, 19, 43, 2759 }, // ∘
-    { 6, 6, 24, 9, 13, 9, 2802 }, // ∙
-    { 24, 36, 24, 0, 31, 216, 2811 }, // √
-    { 19, 14, 24, 2, 19, 67, 3027 }, // ∝
-    { 24, 14, 24, 0, 19, 84, 3094 }, // ∞
-    { 24, 27, 38, 7, 27, 162, 3178 }, // ∟
-    { 26, 27, 38, 5, 27, 176, 3340 }, // ∠
-    { 5, 39, 19, 7, 30, 49, 3516 }, // ∣
-    { 11, 39, 19, 4, 30, 108, 3565 }, // ∥
-    { 24, 27, 38, 7, 27, 162, 3673 }, // ∧
-    { 24, 27, 38, 7, 27, 162, 3835 }, // ∨
-    { 22, 27, 38, 8, 27, 149, 3997 }, // ∩
-    { 22, 28, 38, 8, 27, 154, 4146 }, // ∪
-    { 20, 39, 24, 2, 30, 195, 4300 }, // ∫
-    { 24, 22, 38, 7, 21, 132, 4495 }, // ∴
-    { 24, 22, 38, 7, 21, 132, 4627 }, // ∵
-    { 9, 20, 12, 1, 23, 45, 4759 }, // ∶
-    { 24, 22, 38, 7, 21, 132, 4804 }, // ∷
-    { 22, 6, 38, 8, 14, 33, 4936 }, // ∼
-    { 22, 20, 38, 8, 23, 110, 4969 }, // ≅
-    { 18, 14, 24, 3, 20, 63, 5079 }, // ≈
-    { 22, 13, 38, 8, 17, 72, 5142 }, // ≍
-    { 17, 17, 24, 3, 21, 73, 5214 }, // ≠
-    { 20, 17, 38, 9, 20, 85, 5287 }, // ≡
-    { 17, 23, 24, 3, 23, 98, 5372 }, // ≤
-    { 17, 23, 24, 3, 23, 98, 5470 }, // ≥
-    { 30, 18, 38, 4, 22, 135, 5568 }, // ≪
-    { 30, 18, 38, 4, 22, 135, 5703 }, // ≫
-    { 24, 21, 38, 7, 24, 126, 5838 }, // ⊃
-    { 24, 34, 38, 7, 30, 204, 5964 }, // ⊄
-    { 24, 34, 38, 7, 30, 204, 6168 }, // ⊅
-    { 24, 27, 38, 7, 27, 162, 6372 }, // ⊆
-    { 24, 27, 38, 7, 27, 162, 6534 }, // ⊇
-    { 28, 28, 38, 5, 27, 196, 6696 }, // ⊕
-    { 28, 28, 38, 5, 27, 196, 6892 }, // ⊖
-    { 28, 28, 38, 5, 27, 196, 7088 }, // ⊗
-    { 28, 28, 38, 5, 27, 196, 7284 }, // ⊘
-    { 22, 27, 38, 8, 27, 149, 7480 }, // ⊥
-    { 6, 6, 24, 9, 13, 9, 7629 }, // ⋅
-    { 32, 6, 38, 3, 13, 48, 7638 }, // ⋯
-    { 36, 36, 38, 1, 32, 324, 0 }, // �
+    { 18, 15, 20, 1, 17, 68, 12956 }, // «
+    { 17, 9, 24, 3, 18, 39, 1203 }, // ¬
+    { 12, 4, 14, 1, 12, 12, 1242 }, // ­
+    { 20, 21, 22, 1, 30, 105, 1254 }, // ®
+    { 13, 3, 23, 5, 27, 10, 1359 }, // ¯
+    { 14, 13, 20, 3, 27, 46, 1369 }, // °
+    { 17, 23, 24, 3, 23, 98, 1415 }, // ±
+    { 15, 18, 17, 1, 32, 68, 1513 }, // ²
+    { 14, 19, 17, 1, 32, 67, 1581 }, // ³
+    { 8, 10, 23, 8, 32, 20, 1648 }, // ´
+    { 24, 30, 23, -1, 20, 180, 1668 }, // µ
+    { 24, 33, 22, -1, 27, 198, 1848 }, // ¶
+    { 6, 7, 12, 3, 14, 11, 2046 }, // ·
+    { 9, 9, 23, 7, -1, 21, 2057 }, // ¸
+    { 10, 18, 17, 3, 32, 45, 2078 }, // ¹
+    { 14, 18, 17, 2, 27, 63, 2123 }, // º
+    { 19, 15, 20, 0, 17, 72, 13024 }, // »
+    { 37, 30, 41, 3, 28, 278, 2186 }, // ¼
+    { 36, 30, 41, 3, 28, 270, 2464 }, // ½
+    { 39, 30, 41, 1, 28, 293, 2734 }, // ¾
+    { 13, 29, 16, 0, 21, 95, 3027 }, // ¿
+    { 29, 37, 28, -3, 37, 269, 13096 }, // À
+    { 29, 37, 28, -3, 37, 269, 13365 }, // Á
+    { 29, 37, 28, -3, 37, 269, 13634 }, // Â
+    { 29, 36, 28, -3, 36, 261, 3122 }, // Ã
+    { 29, 35, 28, -3, 35, 254, 13903 }, // Ä
+    { 29, 38, 28, -3, 38, 276, 3383 }, // Å
+    { 37, 27, 34, -3, 27, 250, 3659 }, // Æ
+    { 23, 37, 24, 1, 27, 213, 14157 }, // Ç
+    { 24, 37, 23, -1, 37, 222, 14370 }, // È
+    { 24, 37, 23, -1, 37, 222, 14592 }, // É
+    { 24, 37, 23, -1, 37, 222, 14814 }, // Ê
+    { 24, 35, 23, -1, 35, 210, 15036 }, // Ë
+    { 17, 37, 14, -1, 37, 158, 15246 }, // Ì
+    { 18, 37, 14, -1, 37, 167, 15404 }, // Í
+    { 19, 37, 14, -1, 37, 176, 15571 }, // Î
+    { 19, 35, 14, -1, 35, 167, 15747 }, // Ï
+    { 28, 28, 28, -1, 27, 196, 3909 }, // Ð
+    { 32, 37, 29, -1, 36, 296, 15914 }, // Ñ
+    { 26, 38, 28, 1, 37, 247, 16210 }, // Ò
+    { 26, 38, 28, 1, 37, 247, 16457 }, // Ó
+    { 26, 38, 28, 1, 37, 247, 16704 }, // Ô
+    { 26, 37, 28, 1, 36, 241, 4105 }, // Õ
+    { 26, 36, 28, 1, 35, 234, 16951 }, // Ö
+    { 16, 16, 24, 4, 21, 64, 4346 }, // ×
+    { 30, 28, 28, -1, 27, 210, 4410 }, // Ø
+    { 28, 38, 29, 3, 37, 266, 17185 }, // Ù
+    { 28, 38, 29, 3, 37, 266, 17451 }, // Ú
+    { 28, 38, 29, 3, 37, 266, 17717 }, // Û
+    { 28, 36, 29, 3, 35, 252, 17983 }, // Ü
+    { 25, 37, 25, 2, 37, 232, 4620 }, // Ý
+    { 23, 27, 23, -1, 27, 156, 4852 }, // Þ
+    { 29, 39, 24, -6, 30, 283, 5008 }, // ß
+    { 21, 32, 22, 1, 31, 168, 18235 }, // à
+    { 21, 33, 22, 1, 32, 174, 18403 }, // á
+    { 21, 32, 22, 1, 31, 168, 18577 }, // â
+    { 21, 31, 22, 1, 30, 163, 5291 }, // ã
+    { 21, 30, 22, 1, 29, 158, 18745 }, // ä
+    { 21, 33, 22, 1, 32, 174, 5454 }, // å
+    { 28, 21, 29, 1, 20, 147, 5628 }, // æ
+    { 15, 30, 17, 1, 20, 113, 18903 }, // ç
+    { 16, 32, 18, 1, 31, 128, 19016 }, // è
+    { 17, 33, 18, 1, 32, 141, 19144 }, // é
+    { 17, 32, 18, 1, 31, 136, 19285 }, // ê
+    { 18, 30, 18, 1, 29, 135, 19421 }, // ë
+    { 10, 32, 13, 2, 31, 80, 19556 }, // ì
+    { 13, 33, 13, 2, 32, 108, 19636 }, // í
+    { 13, 32, 13, 2, 31, 104, 19744 }, // î
+    { 14, 30, 13, 2, 29, 105, 19848 }, // ï
+    { 19, 32, 21, 1, 31, 152, 5775 }, // ð
+    { 22, 31, 23, 1, 30, 171, 19953 }, // ñ
+    { 19, 32, 21, 1, 31, 152, 20124 }, // ò
+    { 19, 33, 21, 1, 32, 157, 20276 }, // ó
+    { 19, 32, 21, 1, 31, 152, 20433 }, // ô
+    { 19, 31, 21, 1, 30, 148, 5927 }, // õ
+    { 20, 30, 21, 1, 29, 150, 20585 }, // ö
+    { 17, 18, 24, 3, 22, 77, 6075 }, // ÷
+    { 24, 22, 21, -2, 21, 132, 6152 }, // ø
+    { 22, 32, 23, 1, 31, 176, 20735 }, // ù
+    { 22, 33, 23, 1, 32, 182, 20911 }, // ú
+    { 22, 32, 23, 1, 31, 176, 21093 }, // û
+    { 22, 30, 23, 1, 29, 165, 21269 }, // ü
+    { 24, 41, 20, -4, 32, 246, 6284 }, // ý
+    { 23, 39, 21, -3, 30, 225, 6530 }, // þ
+    { 24, 38, 20, -4, 29, 228, 6755 }, // ÿ
+    { 29, 34, 28, -3, 34, 247, 6983 }, // Ā
+    { 21, 28, 22, 1, 27, 147, 7230 }, // ā
+    { 29, 36, 28, -3, 36, 261, 7377 }, // Ă
+    { 21, 31, 22, 1, 30, 163, 7638 }, // ă
+    { 29, 36, 28, -3, 28, 261, 7801 }, // Ą
+    { 21, 28, 22, 1, 20, 147, 8062 }, // ą
+    { 23, 38, 24, 1, 37, 219, 8209 }, // Ć
+    { 17, 33, 17, 1, 32, 141, 8428 }, // ć
+    { 23, 38, 24, 1, 37, 219, 8569 }, // Ĉ
+    { 17, 32, 17, 1, 31, 136, 8788 }, // ĉ
+    { 23, 37, 24, 1, 36, 213, 8924 }, // Ċ
+    { 15, 30, 17, 1, 29, 113, 9137 }, // ċ
+    { 24, 38, 24, 1, 37, 228, 9250 }, // Č
+    { 19, 32, 17, 1, 31, 152, 9478 }, // č
+    { 28, 38, 28, -1, 37, 266, 9630 }, // Ď
+    { 28, 34, 23, 1, 33, 238, 9896 }, // ď
+    { 28, 28, 28, -1, 27, 196, 10134 }, // Đ
+    { 23, 31, 22, 1, 30, 179, 10330 }, // đ
+    { 24, 34, 23, -1, 34, 204, 10509 }, // Ē
+    { 18, 28, 18, 1, 27, 126, 10713 }, // ē
+    { 24, 36, 23, -1, 36, 216, 10839 }, // Ĕ
+    { 18, 31, 18, 1, 30, 140, 11055 }, // ĕ
+    { 24, 36, 23, -1, 36, 216, 11195 }, // Ė
+    { 16, 30, 18, 1, 29, 120, 11411 }, // ė
+    { 24, 35, 23, -1, 27, 210, 11531 }, // Ę
+    { 16, 28, 18, 1, 20, 112, 11741 }, // ę
+    { 25, 37, 23, -1, 37, 232, 11853 }, // Ě
+    { 19, 32, 18, 1, 31, 152, 12085 }, // ě
+    { 24, 38, 27, 2, 37, 228, 12237 }, // Ĝ
+    { 25, 40, 19, -4, 31, 250, 12465 }, // ĝ
+    { 24, 37, 27, 2, 36, 222, 12715 }, // Ğ
+    { 25, 39, 19, -4, 30, 244, 12937 }, // ğ
+    { 24, 37, 27, 2, 36, 222, 13181 }, // Ġ
+    { 25, 38, 19, -4, 29, 238, 13403 }, // ġ
+    { 24, 37, 27, 2, 27, 222, 13641 }, // Ģ
+    { 25, 41, 19, -4, 32, 257, 13863 }, // ģ
+    { 33, 37, 30, -1, 37, 306, 14120 }, // Ĥ
+    { 21, 40, 23, 1, 39, 210, 14426 }, // ĥ
+    { 33, 27, 30, -1, 27, 223, 14636 }, // Ħ
+    { 21, 31, 23, 1, 30, 163, 14859 }, // ħ
+    { 18, 36, 14, -1, 36, 162, 15022 }, // Ĩ
+    { 14, 31, 13, 2, 30, 109, 15184 }, // ĩ
+    { 18, 34, 14, -1, 34, 153, 15293 }, // Ī
+    { 14, 28, 13, 2, 27, 98, 15446 }, // ī
+    { 19, 36, 14, -1, 36, 171, 15544 }, // Ĭ
+    { 14, 31, 13, 2, 30, 109, 15715 }, // ĭ
+    { 17, 35, 14, -1, 27, 149, 15824 }, // Į
+    { 12, 38, 12, 1, 30, 114, 15973 }, // į
+    { 17, 36, 14, -1, 36, 153, 16087 }, // İ
+    { 9, 21, 12, 2, 20, 48, 16240 }, // ı
+    { 31, 35, 28, -1, 27, 272, 16288 }, // Ĳ
+    { 23, 39, 23, 2, 30, 225, 16560 }, // ĳ
+    { 25, 45, 13, -7, 37, 282, 16785 }, // Ĵ
+    { 22, 40, 11, -7, 31, 220, 17067 }, // ĵ
+    { 29, 37, 27, -1, 27, 269, 17287 }, // Ķ
+    { 19, 40, 20, 1, 30, 190, 17556 }, // ķ
+    { 19, 21, 21, 1, 20, 100, 17746 }, // ĸ
+    { 22, 37, 22, -1, 37, 204, 17846 }, // Ĺ
+    { 14, 40, 12, 1, 39, 140, 18050 }, // ĺ
+    { 22, 37, 22, -1, 27, 204, 18190 }, // Ļ
+    { 12, 40, 12, -1, 30, 120, 18394 }, // ļ
+    { 23, 30, 22, -1, 30, 173, 18514 }, // Ľ
+    { 17, 34, 13, 1, 33, 145, 18687 }, // ľ
+    { 23, 27, 22, -1, 27, 156, 18832 }, // Ŀ
+    { 16, 31, 15, 1, 30, 124, 18988 }, // ŀ
+    { 22, 27, 22, -1, 27, 149, 19112 }, // Ł
+    { 14, 31, 12, -1, 30, 109, 19261 }, // ł
+    { 32, 38, 29, -1, 37, 304, 19370 }, // Ń
+    { 22, 33, 23, 1, 32, 182, 19674 }, // ń
+    { 32, 37, 29, -1, 27, 296, 19856 }, // Ņ
+    { 22, 30, 23, 1, 20, 165, 20152 }, // ņ
+    { 32, 38, 29, -1, 37, 304, 20317 }, // Ň
+    { 22, 32, 23, 1, 31, 176, 20621 }, // ň
+    { 29, 30, 31, 2, 29, 218, 20797 }, // ŉ
+    { 32, 35, 29, -1, 27, 280, 21015 }, // Ŋ
+    { 20, 29, 22, 1, 20, 145, 21295 }, // ŋ
+    { 26, 35, 28, 1, 34, 228, 21440 }, // Ō
+    { 19, 28, 21, 1, 27, 133, 21668 }, // ō
+    { 26, 37, 28, 1, 36, 241, 21801 }, // Ŏ
+    { 20, 31, 21, 1, 30, 155, 22042 }, // ŏ
+    { 28, 38, 28, 1, 37, 266, 22197 }, // Ő
+    { 21, 32, 21, 1, 31, 168, 22463 }, // ő
+    { 36, 28, 37, 1, 27, 252, 21434 }, // Œ
+    { 29, 21, 31, 1, 20, 153, 21686 }, // œ
+    { 25, 38, 25, -1, 37, 238, 22631 }, // Ŕ
+    { 17, 32, 16, 1, 32, 136, 22869 }, // ŕ
+    { 25, 37, 25, -1, 27, 232, 23005 }, // Ŗ
+    { 18, 30, 16, -1, 20, 135, 23237 }, // ŗ
+    { 25, 38, 25, -1, 37, 238, 23372 }, // Ř
+    { 18, 31, 16, 1, 31, 140, 23610 }, // ř
+    { 20, 38, 20, 0, 37, 190, 23750 }, // Ś
+    { 17, 33, 16, 0, 32, 141, 23940 }, // ś
+    { 20, 38, 20, 0, 37, 190, 24081 }, // Ŝ
+    { 17, 32, 16, 0, 31, 136, 24271 }, // ŝ
+    { 20, 37, 20, 0, 27, 185, 24407 }, // Ş
+    { 15, 30, 16, 0, 20, 113, 24592 }, // ş
+    { 21, 38, 20, 0, 37, 200, 24705 }, // Š
+    { 18, 32, 16, 0, 31, 144, 24905 }, // š
+    { 23, 37, 24, 3, 27, 213, 25049 }, // Ţ
+    { 15, 35, 15, 0, 25, 132, 25262 }, // ţ
+    { 23, 37, 24, 3, 37, 213, 25394 }, // Ť
+    { 16, 32, 15, 1, 31, 128, 25607 }, // ť
+    { 23, 27, 24, 3, 27, 156, 25735 }, // Ŧ
+    { 15, 26, 15, 0, 25, 98, 25891 }, // ŧ
+    { 28, 37, 29, 3, 36, 259, 25989 }, // Ũ
+    { 22, 31, 23, 1, 30, 171, 26248 }, // ũ
+    { 28, 35, 29, 3, 34, 245, 26419 }, // Ū
+    { 22, 28, 23, 1, 27, 154, 26664 }, // ū
+    { 28, 37, 29, 3, 36, 259, 26818 }, // Ŭ
+    { 22, 31, 23, 1, 30, 171, 27077 }, // ŭ
+    { 28, 39, 29, 3, 38, 273, 27248 }, // Ů
+    { 22, 33, 23, 1, 32, 182, 27521 }, // ů
+    { 28, 38, 29, 3, 37, 266, 27703 }, // Ű
+    { 22, 32, 23, 1, 31, 176, 27969 }, // ű
+    { 28, 35, 29, 3, 27, 245, 28145 }, // Ų
+    { 22, 28, 23, 1, 20, 154, 28390 }, // ų
+    { 39, 38, 40, 3, 37, 371, 28544 }, // Ŵ
+    { 29, 32, 29, 0, 31, 232, 28915 }, // ŵ
+    { 25, 37, 25, 2, 37, 232, 29147 }, // Ŷ
+    { 24, 40, 20, -4, 31, 240, 29379 }, // ŷ
+    { 25, 35, 25, 2, 35, 219, 29619 }, // Ÿ
+    { 23, 38, 22, -1, 37, 219, 29838 }, // Ź
+    { 18, 33, 18, 0, 32, 149, 30057 }, // ź
+    { 23, 37, 22, -1, 36, 213, 30206 }, // Ż
+    { 18, 30, 18, 0, 29, 135, 30419 }, // ż
+    { 23, 38, 22, -1, 37, 219, 30554 }, // Ž
+    { 18, 32, 18, 0, 31, 144, 30773 }, // ž
+    { 27, 39, 16, -7, 30, 264, 30917 }, // ſ
+    { 8, 9, 0, -6, 31, 18, 31181 }, // ̀
+    { 8, 10, 0, -3, 32, 20, 31199 }, // ́
+    { 13, 9, 0, -7, 31, 30, 31219 }, // ̂
+    { 12, 7, 0, -6, 30, 21, 31249 }, // ̃
+    { 12, 3, 0, -6, 27, 9, 31270 }, // ̄
+    { 13, 7, 0, -6, 30, 23, 31279 }, // ̆
+    { 6, 6, 0, -3, 29, 9, 31302 }, // ̇
+    { 14, 6, 0, -7, 29, 21, 31311 }, // ̈
+    { 10, 11, 0, -5, 33, 28, 31332 }, // ̉
+    { 10, 11, 0, -5, 32, 28, 31360 }, // ̊
+    { 15, 9, 0, -7, 31, 34, 31388 }, // ̋
+    { 13, 9, 0, -6, 31, 30, 31422 }, // ̌
+    { 11, 9, 0, -7, 31, 25, 31452 }, // ̏
+    { 13, 8, 0, -7, 30, 26, 31477 }, // ̑
+    { 8, 11, 0, -4, 32, 22, 31503 }, // ̒
+    { 8, 11, 0, -3, 33, 22, 31525 }, // ̓
+    { 6, 11, 0, -4, 33, 17, 31547 }, // ̔
+    { 6, 10, 0, -3, 33, 15, 31564 }, // ̕
+    { 8, 9, 0, -4, 24, 18, 31579 }, // ̛
+    { 6, 6, 0, -3, -3, 9, 31597 }, // ̣
+    { 14, 6, 0, -7, -3, 21, 31606 }, // ̤
+    { 9, 9, 0, -4, -1, 21, 31627 }, // ̥
+    { 7, 9, 0, -4, -1, 16, 31648 }, // ̦
+    { 8, 9, 0, -4, -1, 18, 31664 }, // ̧
+    { 8, 9, 0, -4, 1, 18, 31682 }, // ̨
+    { 6, 8, 10, -1, -2, 12, 31700 }, // ̩
+    { 13, 8, 0, -7, -2, 26, 31712 }, // ̭
+    { 12, 7, 0, -6, -2, 21, 31738 }, // ̮
+    { 12, 7, 0, -6, -2, 21, 31759 }, // ̰
+    { 12, 3, 0, -6, -4, 9, 31780 }, // ̱
+    { 13, 8, 0, -7, 30, 26, 31789 }, // ͂
+    { 14, 15, 0, -8, 38, 53, 31815 }, // ̈́
+    { 7, 8, 0, -2, -2, 14, 31868 }, // ͅ
+    { 24, 37, 23, -1, 37, 222, 31882 }, // Ѐ
+    { 24, 35, 23, -1, 35, 210, 0 }, // Ё
+    { 23, 35, 28, 3, 27, 202, 32104 }, // Ђ
+    { 24, 37, 22, -1, 37, 222, 32306 }, // Ѓ
+    { 23, 28, 24, 1, 27, 161, 32528 }, // Є
+    { 20, 28, 20, 0, 27, 140, 32689 }, // Ѕ
+    { 17, 27, 14, -1, 27, 115, 32829 }, // І
+    { 19, 35, 14, -1, 35, 167, 32944 }, // Ї
+    { 23, 35, 13, -7, 27, 202, 33111 }, // Ј
+    { 35, 28, 34, -2, 27, 245, 33313 }, // Љ
+    { 36, 28, 35, -1, 27, 252, 33558 }, // Њ
+    { 24, 27, 30, 3, 27, 162, 33810 }, // Ћ
+    { 28, 38, 26, -1, 37, 266, 33972 }, // Ќ
+    { 33, 37, 30, -1, 37, 306, 34238 }, // Ѝ
+    { 27, 39, 24, 1, 38, 264, 34544 }, // Ў
+    { 31, 36, 29, -1, 27, 279, 34808 }, // Џ
+    { 29, 28, 28, -3, 28, 203, 210 }, // А
+    { 24, 28, 23, -1, 27, 168, 413 }, // Б
+    { 23, 28, 24, -1, 27, 161, 581 }, // В
+    { 24, 27, 22, -1, 27, 162, 742 }, // Г
+    { 31, 35, 27, -3, 27, 272, 904 }, // Д
+    { 24, 27, 23, -1, 27, 162, 1176 }, // Е
+    { 40, 28, 36, -3, 27, 280, 1338 }, // Ж
+    { 19, 28, 21, 0, 27, 133, 1618 }, // З
+    { 33, 27, 30, -1, 27, 223, 1751 }, // И
+    { 33, 38, 30, -1, 38, 314, 1974 }, // Й
+    { 28, 28, 26, -1, 27, 196, 2288 }, // К
+    { 30, 28, 26, -2, 27, 210, 2484 }, // Л
+    { 36, 27, 34, -2, 27, 243, 2694 }, // М
+    { 33, 27, 30, -1, 27, 223, 2937 }, // Н
+    { 26, 28, 28, 1, 27, 182, 3160 }, // О
+    { 31, 27, 29, -1, 27, 210, 3342 }, // П
+    { 23, 27, 23, -1, 27, 156, 3552 }, // Р
+    { 23, 28, 24, 1, 27, 161, 3708 }, // С
+    { 23, 27, 24, 3, 27, 156, 3869 }, // Т
+    { 27, 28, 24, 1, 27, 189, 4025 }, // У
+    { 26, 29, 28, 1, 28, 189, 4214 }, // Ф
+    { 30, 27, 26, -3, 27, 203, 4403 }, // Х
+    { 31, 35, 29, -1, 27, 272, 4606 }, // Ц
+    { 25, 27, 26, 2, 27, 169, 4878 }, // Ч
+    { 40, 27, 38, -1, 27, 270, 5047 }, // Ш
+    { 40, 35, 38, -1, 27, 350, 5317 }, // Щ
+    { 23, 28, 27, 3, 27, 161, 5667 }, // Ъ
+    { 37, 28, 35, -1, 27, 259, 5828 }, // Ы
+    { 22, 28, 22, -1, 27, 154, 6087 }, // Ь
+    { 22, 28, 24, 0, 27, 154, 6241 }, // Э
+    { 38, 28, 38, -1, 27, 266, 6395 }, // Ю
+    { 27, 28, 24, -2, 27, 189, 6661 }, // Я
+    { 21, 21, 22, 1, 20, 111, 6850 }, // а
+    { 22, 32, 21, 1, 31, 176, 6961 }, // б
+    { 17, 21, 19, 1, 20, 90, 7137 }, // в
+    { 15, 21, 17, 1, 20, 79, 7227 }, // г
+    { 19, 31, 21, 1, 30, 148, 7306 }, // д
+    { 16, 21, 18, 1, 20, 84, 7454 }, // е
+    { 34, 21, 34, 0, 20, 179, 7538 }, // ж
+    { 16, 21, 17, 0, 20, 84, 7717 }, // з
+    { 22, 21, 23, 1, 20, 116, 7801 }, // и
+    { 22, 32, 23, 1, 31, 176, 7917 }, // й
+    { 20, 21, 21, 1, 20, 105, 8093 }, // к
+    { 23, 21, 23, -1, 20, 121, 8198 }, // л
+    { 29, 21, 29, 0, 20, 153, 8319 }, // м
+    { 22, 21, 23, 1, 20, 116, 8472 }, // н
+    { 19, 21, 21, 1, 20, 100, 8588 }, // о
+    { 22, 21, 23, 1, 20, 116, 8688 }, // п
+    { 24, 29, 22, -3, 20, 174, 8804 }, // р
+    { 15, 21, 17, 1, 20, 79, 8978 }, // с
+    { 32, 21, 34, 1, 20, 168, 9057 }, // т
+    { 24, 29, 20, -4, 20, 174, 9225 }, // у
+    { 24, 39, 27, 1, 30, 234, 9399 }, // ф
+    { 23, 21, 21, -1, 20, 121, 9633 }, // х
+    { 22, 28, 23, 1, 20, 154, 9754 }, // ц
+    { 21, 21, 22, 1, 20, 111, 9908 }, // ч
+    { 30, 21, 32, 1, 20, 158, 10019 }, // ш
+    { 31, 28, 32, 1, 20, 217, 10177 }, // щ
+    { 18, 21, 20, 1, 20, 95, 10394 }, // ъ
+    { 27, 21, 29, 1, 20, 142, 10489 }, // ы
+    { 16, 21, 18, 1, 20, 84, 10631 }, // ь
+    { 17, 21, 18, 0, 20, 90, 10715 }, // э
+    { 28, 21, 30, 1, 20, 147, 10805 }, // ю
+    { 21, 21, 21, -1, 20, 111, 10952 }, // я
+    { 16, 32, 18, 1, 31, 128, 35087 }, // ѐ
+    { 18, 30, 18, 1, 29, 135, 11063 }, // ё
+    { 19, 39, 22, 1, 30, 186, 35215 }, // ђ
+    { 15, 33, 17, 1, 32, 124, 35401 }, // ѓ
+    { 16, 21, 18, 1, 20, 84, 35525 }, // є
+    { 15, 21, 16, 0, 20, 79, 35609 }, // ѕ
+    { 11, 31, 12, 2, 30, 86, 35688 }, // і
+    { 14, 30, 12, 2, 29, 105, 35774 }, // ї
+    { 19, 39, 11, -7, 30, 186, 35879 }, // ј
+    { 28, 21, 28, -1, 20, 147, 36065 }, // љ
+    { 25, 21, 27, 1, 20, 132, 36212 }, // њ
+    { 21, 31, 23, 1, 30, 163, 36344 }, // ћ
+    { 20, 33, 21, 1, 32, 165, 36507 }, // ќ
+    { 22, 32, 23, 1, 31, 176, 36672 }, // ѝ
+    { 24, 40, 20, -4, 31, 240, 36848 }, // ў
+    { 22, 28, 23, 1, 20, 154, 37088 }, // џ
+    { 23, 31, 26, 2, 30, 179, 37242 }, // Ѣ
+    { 26, 21, 28, 1, 20, 137, 37421 }, // ѣ
+    { 26, 28, 28, 1, 27, 182, 37558 }, // Ѳ
+    { 19, 21, 21, 1, 20, 100, 37740 }, // ѳ
+    { 27, 28, 28, 3, 27, 189, 37840 }, // Ѵ
+    { 23, 21, 21, 0, 20, 121, 38029 }, // ѵ
+    { 33, 46, 30, -1, 38, 380, 38150 }, // Ҋ
+    { 22, 39, 23, 1, 31, 215, 38530 }, // ҋ
+    { 22, 28, 22, -1, 27, 154, 38745 }, // Ҍ
+    { 16, 29, 19, 2, 28, 116, 38899 }, // ҍ
+    { 23, 27, 23, -1, 27, 156, 39015 }, // Ҏ
+    { 24, 29, 22, -3, 20, 174, 39171 }, // ҏ
+    { 25, 32, 21, -1, 32, 200, 39345 }, // Ґ
+    { 19, 26, 17, 0, 25, 124, 39545 }, // ґ
+    { 24, 27, 22, -1, 27, 162, 39669 }, // Ғ
+    { 15, 21, 17, 1, 20, 79, 39831 }, // ғ
+    { 24, 35, 23, -1, 27, 210, 39910 }, // Ҕ
+    { 17, 29, 20, 2, 20, 124, 40120 }, // ҕ
+    { 40, 35, 36, -3, 27, 350, 0 }, // Җ
+    { 34, 28, 34, 0, 20, 238, 350 }, // җ
+    { 19, 35, 21, 0, 27, 167, 588 }, // Ҙ
+    { 16, 28, 17, 0, 20, 112, 755 }, // ҙ
+    { 28, 35, 26, -1, 27, 245, 867 }, // Қ
+    { 20, 28, 21, 1, 20, 140, 1112 }, // қ
+    { 30, 28, 28, -1, 27, 210, 1252 }, // Ҝ
+    { 22, 21, 23, 1, 20, 116, 1462 }, // ҝ
+    { 28, 28, 26, -1, 27, 196, 1578 }, // Ҟ
+    { 20, 29, 21, 1, 28, 145, 1774 }, // ҟ
+    { 29, 28, 30, 3, 27, 203, 1919 }, // Ҡ
+    { 22, 21, 23, 1, 20, 116, 2122 }, // ҡ
+    { 33, 35, 30, -1, 27, 289, 2238 }, // Ң
+    { 22, 28, 24, 1, 20, 154, 2527 }, // ң
+    { 38, 27, 35, -1, 27, 257, 2681 }, // Ҥ
+    { 27, 21, 28, 1, 20, 142, 2938 }, // ҥ
+    { 38, 35, 39, -1, 27, 333, 3080 }, // Ҧ
+    { 30, 29, 32, 1, 20, 218, 3413 }, // ҧ
+    { 28, 28, 30, 1, 27, 196, 3631 }, // Ҩ
+    { 23, 22, 24, 1, 21, 127, 3827 }, // ҩ
+    { 23, 35, 24, 1, 27, 202, 3954 }, // Ҫ
+    { 15, 28, 17, 1, 20, 105, 4156 }, // ҫ
+    { 23, 35, 24, 3, 27, 202, 4261 }, // Ҭ
+    { 32, 28, 34, 1, 20, 224, 4463 }, // ҭ
+    { 25, 27, 25, 2, 27, 169, 4687 }, // Ү
+    { 19, 29, 20, 0, 20, 138, 4856 }, // ү
+    { 25, 27, 25, 2, 27, 169, 4994 }, // Ұ
+    { 19, 29, 20, 0, 20, 138, 5163 }, // ұ
+    { 30, 35, 26, -3, 27, 263, 5301 }, // Ҳ
+    { 23, 28, 21, -1, 20, 161, 5564 }, // ҳ
+    { 33, 35, 32, 1, 27, 289, 5725 }, // Ҵ
+    { 22, 35, 23, 1, 27, 193, 6014 }, // ҵ
+    { 25, 35, 26, 2, 27, 219, 6207 }, // Ҷ
+    { 21, 28, 23, 1, 20, 147, 6426 }, // ҷ
+    { 25, 27, 26, 2, 27, 169, 6573 }, // Ҹ
+    { 21, 21, 22, 1, 20, 111, 6742 }, // ҹ
+    { 24, 27, 25, -1, 27, 162, 6853 }, // Һ
+    { 21, 31, 23, 1, 30, 163, 7015 }, // һ
+    { 28, 28, 30, 1, 27, 196, 7178 }, // Ҽ
+    { 21, 21, 22, 0, 20, 111, 7374 }, // ҽ
+    { 28, 36, 30, 1, 27, 252, 7485 }, // Ҿ
+    { 21, 28, 22, 0, 20, 147, 7737 }, // ҿ
+    { 17, 27, 14, -1, 27, 115, 7884 }, // Ӏ
+    { 40, 39, 36, -3, 38, 390, 7999 }, // Ӂ
+    { 34, 32, 34, 0, 31, 272, 8389 }, // ӂ
+    { 28, 35, 26, -1, 27, 245, 8661 }, // Ӄ
+    { 19, 29, 21, 1, 20, 138, 8906 }, // ӄ
+    { 30, 35, 26, -2, 27, 263, 9044 }, // Ӆ
+    { 23, 28, 23, -1, 20, 161, 9307 }, // ӆ
+    { 33, 35, 30, -1, 27, 289, 9468 }, // Ӈ
+    { 20, 29, 22, 1, 20, 145, 9757 }, // ӈ
+    { 33, 35, 30, -1, 27, 289, 9902 }, // Ӊ
+    { 22, 28, 24, 1, 20, 154, 10191 }, // ӊ
+    { 25, 35, 26, 2, 27, 219, 10345 }, // Ӌ
+    { 20, 28, 21, 1, 20, 140, 10564 }, // ӌ
+    { 36, 35, 34, -2, 27, 315, 10704 }, // Ӎ
+    { 29, 28, 29, 0, 20, 203, 11019 }, // ӎ
+    { 17, 29, 12, -2, 29, 124, 11222 }, // ӏ
+    { 29, 38, 28, -3, 38, 276, 11346 }, // Ӑ
+    { 21, 32, 22, 1, 31, 168, 11622 }, // ӑ
+    { 29, 35, 28, -3, 35, 254, 11790 }, // Ӓ
+    { 21, 30, 22, 1, 29, 158, 12044 }, // ӓ
+    { 37, 27, 34, -3, 27, 250, 12202 }, // Ӕ
+    { 28, 21, 29, 1, 20, 147, 12452 }, // ӕ
+    { 24, 38, 23, -1, 38, 228, 12599 }, // Ӗ
+    { 18, 32, 18, 1, 31, 144, 12827 }, // ӗ
+    { 23, 28, 24, 0, 27, 161, 12971 }, // Ә
+    { 16, 21, 18, 1, 20, 84, 13132 }, // ә
+    { 23, 36, 24, 0, 35, 207, 13216 }, // Ӛ
+    { 17, 30, 18, 1, 29, 128, 13423 }, // ӛ
+    { 40, 36, 36, -3, 35, 360, 13551 }, // Ӝ
+    { 34, 30, 34, 0, 29, 255, 13911 }, // ӝ
+    { 20, 36, 21, 0, 35, 180, 14166 }, // Ӟ
+    { 18, 30, 17, 0, 29, 135, 14346 }, // ӟ
+    { 23, 28, 22, -1, 27, 161, 14481 }, // Ӡ
+    { 22, 29, 20, -3, 20, 160, 14642 }, // ӡ
+    { 33, 34, 30, -1, 34, 281, 14802 }, // Ӣ
+    { 22, 28, 23, 1, 27, 154, 15083 }, // ӣ
+    { 33, 35, 30, -1, 35, 289, 15237 }, // Ӥ
+    { 22, 30, 23, 1, 29, 165, 15526 }, // ӥ
+    { 26, 36, 28, 1, 35, 234, 15691 }, // Ӧ
+    { 20, 30, 21, 1, 29, 150, 15925 }, // ӧ
+    { 26, 28, 28, 1, 27, 182, 16075 }, // Ө
+    { 19, 21, 21, 1, 20, 100, 16257 }, // ө
+    { 26, 36, 28, 1, 35, 234, 16357 }, // Ӫ
+    { 20, 30, 21, 1, 29, 150, 16591 }, // ӫ
+    { 22, 36, 24, 0, 35, 198, 16741 }, // Ӭ
+    { 18, 30, 18, 0, 29, 135, 16939 }, // ӭ
+    { 27, 35, 24, 1, 34, 237, 17074 }, // Ӯ
+    { 24, 36, 20, -4, 27, 216, 17311 }, // ӯ
+    { 27, 36, 24, 1, 35, 243, 17527 }, // Ӱ
+    { 24, 38, 20, -4, 29, 228, 17770 }, // ӱ
+    { 27, 38, 24, 1, 37, 257, 17998 }, // Ӳ
+    { 24, 40, 20, -4, 31, 240, 18255 }, // ӳ
+    { 25, 35, 26, 2, 35, 219, 18495 }, // Ӵ
+    { 21, 30, 22, 1, 29, 158, 18714 }, // ӵ
+    { 24, 35, 22, -1, 27, 210, 18872 }, // Ӷ
+    { 15, 28, 17, 1, 20, 105, 19082 }, // ӷ
+    { 37, 36, 35, -1, 35, 333, 19187 }, // Ӹ
+    { 27, 30, 29, 1, 29, 203, 19520 }, // ӹ
+    { 24, 35, 22, -1, 27, 210, 19723 }, // Ӻ
+    { 15, 28, 17, 1, 20, 105, 19933 }, // ӻ
+    { 30, 35, 26, -3, 27, 263, 20038 }, // Ӽ
+    { 23, 29, 21, -1, 20, 167, 20301 }, // ӽ
+    { 30, 27, 26, -3, 27, 203, 20468 }, // Ӿ
+    { 23, 21, 21, -1, 20, 121, 20671 }, // ӿ
+    { 0, 0, 19, 0, 0, 0, 20792 }, //  
+    { 0, 0, 38, 0, 0, 0, 20792 }, //  
+    { 0, 0, 19, 0, 0, 0, 20792 }, //  
+    { 0, 0, 38, 0, 0, 0, 20792 }, //  
+    { 0, 0, 13, 0, 0, 0, 20792 }, //  
+    { 0, 0, 10, 0, 0, 0, 20792 }, //  
+    { 0, 0, 6, 0, 0, 0, 20792 }, //  
+    { 0, 0, 24, 0, 0, 0, 20792 }, //  
+    { 0, 0, 10, 0, 0, 0, 20792 }, //  
+    { 0, 0, 8, 0, 0, 0, 20792 }, //  
+    { 0, 0, 2, 0, 0, 0, 20792 }, //  
+    { 0, 0, 0, 0, 0, 0, 20792 }, // ​
+    { 2, 31, 0, -1, 22, 16, 20792 }, // ‌
+    { 8, 34, 0, -4, 25, 68, 20808 }, // ‍
+    { 14, 36, 0, -7, 27, 126, 20876 }, // ‎
+    { 14, 36, 0, -7, 27, 126, 21002 }, // ‏
+    { 12, 4, 14, 1, 12, 12, 21128 }, // ‐
+    { 12, 4, 14, 1, 12, 12, 21140 }, // ‑
+    { 18, 4, 24, 3, 15, 18, 21152 }, // ‒
+    { 19, 4, 19, 0, 12, 19, 21839 }, // –
+    { 38, 4, 38, 0, 12, 38, 21858 }, // —
+    { 38, 4, 38, 0, 12, 38, 21170 }, // ―
+    { 13, 39, 19, 3, 30, 127, 21208 }, // ‖
+    { 19, 9, 19, 0, -1, 43, 21335 }, // ‗
+    { 8, 13, 11, 3, 29, 26, 21896 }, // ‘
+    { 8, 12, 11, 2, 29, 24, 21922 }, // ’
+    { 8, 12, 11, 1, 5, 24, 21378 }, // ‚
+    { 7, 13, 9, 1, 29, 23, 21402 }, // ‛
+    { 16, 13, 19, 3, 29, 52, 21946 }, // “
+    { 16, 13, 19, 2, 29, 52, 21998 }, // ”
+    { 16, 12, 19, 1, 5, 48, 21425 }, // „
+    { 15, 13, 17, 1, 29, 49, 21473 }, // ‟
+    { 16, 25, 18, 2, 27, 100, 21522 }, // †
+    { 18, 29, 18, 0, 27, 131, 21622 }, // ‡
+    { 9, 9, 11, 1, 14, 21, 21753 }, // •
+    { 14, 14, 24, 5, 20, 49, 21774 }, // ‣
+    { 6, 6, 10, 2, 5, 9, 21823 }, // ․
+    { 15, 6, 19, 2, 5, 23, 21832 }, // ‥
+    { 32, 6, 38, 3, 5, 48, 22050 }, // …
+    { 6, 6, 10, 2, 13, 9, 21855 }, // ‧
+    { 0, 0, 0, 0, 0, 0, 21864 }, //  
+    { 0, 0, 0, 0, 0, 0, 21864 }, //  
+    { 14, 36, 0, -7, 27, 126, 21864 }, // ‪
+    { 14, 36, 0, -7, 27, 126, 21990 }, // ‫
+    { 12, 35, 0, -6, 26, 105, 22116 }, // ‬
+    { 16, 36, 0, -8, 27, 144, 22221 }, // ‭
+    { 16, 36, 0, -8, 27, 144, 22365 }, // ‮
+    { 0, 0, 4, 0, 0, 0, 22509 }, //  
+    { 48, 30, 52, 2, 28, 360, 22509 }, // ‰
+    { 8, 13, 10, 1, 27, 26, 22869 }, // ′
+    { 16, 13, 17, 1, 27, 52, 22895 }, // ″
+    { 23, 13, 25, 1, 27, 75, 22947 }, // ‴
+    { 8, 13, 10, 1, 27, 26, 23022 }, // ‵
+    { 16, 13, 18, 1, 27, 52, 23048 }, // ‶
+    { 24, 13, 27, 1, 27, 78, 23100 }, // ‷
+    { 17, 8, 19, 1, 0, 34, 23178 }, // ‸
+    { 11, 15, 12, 1, 17, 42, 23212 }, // ‹
+    { 11, 15, 12, 0, 17, 42, 23254 }, // ›
+    { 24, 26, 24, 0, 25, 156, 23296 }, // ※
+    { 21, 30, 22, 2, 29, 158, 23452 }, // ‼
+    { 19, 3, 19, 0, 31, 15, 23610 }, // ‾
+    { 9, 4, 11, 1, 12, 9, 23625 }, // ⁃
+    { 23, 30, 9, -7, 28, 173, 23634 }, // ⁄
+    { 28, 29, 31, 3, 28, 203, 23807 }, // ⁇
+    { 24, 30, 27, 3, 29, 180, 24010 }, // ⁈
+    { 25, 30, 27, 2, 29, 188, 24190 }, // ⁉
+    { 22, 6, 38, 8, 14, 33, 24378 }, // ⁓
+    { 30, 13, 32, 1, 27, 98, 24411 }, // ⁗
+    { 0, 0, 8, 0, 0, 0, 24509 }, //  
+    { 0, 0, 0, 0, 0, 0, 24509 }, // ⁠
+    { 0, 0, 0, 0, 0, 0, 24509 }, // ⁡
+    { 0, 0, 0, 0, 0, 0, 24509 }, // ⁢
+    { 0, 0, 0, 0, 0, 0, 24509 }, // ⁣
+    { 0, 0, 0, 0, 0, 0, 24509 }, // ⁤
+    { 15, 19, 17, 1, 32, 72, 24509 }, // ⁰
+    { 15, 18, 17, 1, 32, 68, 24581 }, // ⁴
+    { 15, 18, 17, 1, 31, 68, 24649 }, // ⁵
+    { 15, 19, 17, 2, 32, 72, 24717 }, // ⁶
+    { 13, 18, 17, 4, 31, 59, 24789 }, // ⁷
+    { 14, 19, 17, 2, 32, 67, 24848 }, // ⁸
+    { 14, 19, 17, 1, 32, 67, 24915 }, // ⁹
+    { 14, 14, 22, 4, 27, 49, 24982 }, // ⁿ
+    { 15, 19, 17, 1, 13, 72, 25031 }, // ₀
+    { 10, 18, 17, 3, 13, 45, 25103 }, // ₁
+    { 15, 18, 17, 1, 13, 68, 25148 }, // ₂
+    { 14, 19, 17, 1, 13, 67, 25216 }, // ₃
+    { 15, 18, 17, 1, 13, 68, 25283 }, // ₄
+    { 15, 18, 17, 1, 12, 68, 25351 }, // ₅
+    { 15, 19, 17, 2, 13, 72, 25419 }, // ₆
+    { 13, 18, 17, 4, 12, 59, 25491 }, // ₇
+    { 14, 19, 17, 2, 13, 67, 25550 }, // ₈
+    { 14, 19, 17, 1, 13, 67, 25617 }, // ₉
+    { 24, 26, 24, 0, 26, 156, 25684 }, // ₣
+    { 24, 28, 24, -1, 27, 168, 25840 }, // ₤
+    { 46, 28, 48, 0, 27, 322, 26008 }, // ₧
+    { 26, 28, 24, -1, 27, 182, 26330 }, // €
+    { 22, 16, 38, 8, 21, 88, 26512 }, // ←
+    { 16, 25, 38, 11, 26, 100, 26600 }, // ↑
+    { 22, 16, 38, 8, 21, 88, 26700 }, // →
+    { 16, 25, 38, 11, 26, 100, 26788 }, // ↓
+    { 24, 16, 38, 7, 21, 96, 26888 }, // ↔
+    { 16, 26, 38, 11, 26, 104, 26984 }, // ↕
+    { 16, 25, 38, 11, 26, 100, 27088 }, // ↨
+    { 16, 25, 38, 11, 26, 100, 27188 }, // ↲
+    { 16, 25, 38, 11, 26, 100, 27288 }, // ↳
+    { 20, 18, 38, 9, 22, 90, 27388 }, // ↵
+    { 22, 17, 38, 8, 22, 94, 27478 }, // ⇐
+    { 18, 22, 38, 10, 24, 99, 27572 }, // ⇑
+    { 22, 17, 38, 8, 22, 94, 27671 }, // ⇒
+    { 18, 22, 38, 10, 24, 99, 27765 }, // ⇓
+    { 24, 17, 38, 7, 22, 102, 27864 }, // ⇔
+    { 26, 28, 38, 6, 27, 182, 27966 }, // ∀
+    { 19, 31, 24, 2, 30, 148, 28148 }, // ∂
+    { 18, 27, 38, 10, 27, 122, 28296 }, // ∃
+    { 28, 30, 38, 5, 28, 210, 28418 }, // ∅
+    { 23, 27, 25, 1, 27, 156, 28628 }, // ∆
+    { 24, 28, 38, 7, 27, 168, 28784 }, // ∇
+    { 24, 27, 38, 7, 27, 162, 28952 }, // ∈
+    { 24, 33, 38, 7, 29, 198, 29114 }, // ∉
+    { 24, 21, 38, 7, 24, 126, 29312 }, // ∊
+    { 24, 27, 38, 7, 27, 162, 29438 }, // ∋
+    { 24, 33, 38, 7, 29, 198, 29600 }, // ∌
+    { 24, 21, 38, 7, 24, 126, 29798 }, // ∍
+    { 29, 33, 31, 1, 27, 240, 29924 }, // ∏
+    { 23, 34, 23, 0, 27, 196, 30164 }, // ∑
+    { 17, 4, 24, 3, 15, 17, 30360 }, // −
+    { 21, 30, 19, -1, 28, 158, 30377 }, // ∕
+    { 15, 30, 19, 2, 28, 113, 30535 }, // ∖
+    { 17, 18, 24, 3, 22, 77, 30648 }, // ∗
+    { 13, 13, 24, 5, 19, 43, 30725 }, // ∘
+    { 6, 6, 24, 9, 13, 9, 30768 }, // ∙
+    { 24, 36, 24, 0, 31, 216, 30777 }, // √
+    { 19, 14, 24, 2, 19, 67, 30993 }, // ∝
+    { 24, 14, 24, 0, 19, 84, 31060 }, // ∞
+    { 24, 27, 38, 7, 27, 162, 31144 }, // ∟
+    { 26, 27, 38, 5, 27, 176, 31306 }, // ∠
+    { 5, 39, 19, 7, 30, 49, 31482 }, // ∣
+    { 11, 39, 19, 4, 30, 108, 31531 }, // ∥
+    { 24, 27, 38, 7, 27, 162, 31639 }, // ∧
+    { 24, 27, 38, 7, 27, 162, 31801 }, // ∨
+    { 22, 27, 38, 8, 27, 149, 31963 }, // ∩
+    { 22, 28, 38, 8, 27, 154, 32112 }, // ∪
+    { 20, 39, 24, 2, 30, 195, 32266 }, // ∫
+    { 24, 22, 38, 7, 21, 132, 32461 }, // ∴
+    { 24, 22, 38, 7, 21, 132, 32593 }, // ∵
+    { 9, 20, 12, 1, 23, 45, 32725 }, // ∶
+    { 24, 22, 38, 7, 21, 132, 32770 }, // ∷
+    { 22, 6, 38, 8, 14, 33, 32902 }, // ∼
+    { 22, 20, 38, 8, 23, 110, 32935 }, // ≅
+    { 18, 14, 24, 3, 20, 63, 33045 }, // ≈
+    { 22, 13, 38, 8, 17, 72, 33108 }, // ≍
+    { 17, 17, 24, 3, 21, 73, 33180 }, // ≠
+    { 20, 17, 38, 9, 20, 85, 33253 }, // ≡
+    { 17, 23, 24, 3, 23, 98, 33338 }, // ≤
+    { 17, 23, 24, 3, 23, 98, 33436 }, // ≥
+    { 30, 18, 38, 4, 22, 135, 33534 }, // ≪
+    { 30, 18, 38, 4, 22, 135, 33669 }, // ≫
+    { 24, 21, 38, 7, 24, 126, 33804 }, // ⊃
+    { 24, 34, 38, 7, 30, 204, 33930 }, // ⊄
+    { 24, 34, 38, 7, 30, 204, 34134 }, // ⊅
+    { 24, 27, 38, 7, 27, 162, 34338 }, // ⊆
+    { 24, 27, 38, 7, 27, 162, 34500 }, // ⊇
+    { 28, 28, 38, 5, 27, 196, 34662 }, // ⊕
+    { 28, 28, 38, 5, 27, 196, 34858 }, // ⊖
+    { 28, 28, 38, 5, 27, 196, 35054 }, // ⊗
+    { 28, 28, 38, 5, 27, 196, 35250 }, // ⊘
+    { 22, 27, 38, 8, 27, 149, 35446 }, // ⊥
+    { 6, 6, 24, 9, 13, 9, 35595 }, // ⋅
+    { 32, 6, 38, 3, 13, 48, 35604 }, // ⋯
+    { 40, 39, 28, -7, 30, 390, 35652 }, // ﬀ
+    { 31, 38, 25, -7, 29, 295, 36042 }, // ﬁ
+    { 32, 39, 26, -7, 30, 312, 36337 }, // ﬂ
+    { 44, 38, 37, -7, 29, 418, 36649 }, // ﬃ
+    { 45, 39, 38, -7, 30, 439, 37067 }, // ﬄ
+    { 36, 39, 28, -7, 30, 351, 37506 }, // ﬅ
+    { 31, 28, 30, 0, 27, 217, 37857 }, // ﬆ
+    { 36, 36, 38, 1, 32, 324, 38074 }, // �
 };
 
 static const EpdUnicodeInterval bookerly_18_italicIntervals[] = {
@@ -3397,32 +3512,327 @@ static const EpdUnicodeInterval bookerly_18_italicIntervals[] = {
     { 0x22A5, 0x22A5, 0x2E7 },
     { 0x22C5, 0x22C5, 0x2E8 },
     { 0x22EF, 0x22EF, 0x2E9 },
-    { 0xFFFD, 0xFFFD, 0x2EA },
+    { 0xFB00, 0xFB06, 0x2EA },
+    { 0xFFFD, 0xFFFD, 0x2F1 },
 };
 
 static const EpdFontGroup bookerly_18_italicGroups[] = {
-    { 0, 6138, 12956, 100, 0 },
-    { 6138, 6093, 15461, 96, 100 },
-    { 12231, 8497, 24603, 128, 196 },
-    { 20728, 502, 701, 33, 324 },
-    { 21230, 13379, 40352, 220, 357 },
-    { 34609, 1723, 3976, 74, 577 },
-    { 36332, 660, 1175, 18, 651 },
-    { 36992, 444, 828, 4, 669 },
-    { 37436, 629, 1454, 15, 673 },
-    { 38065, 2895, 7686, 58, 688 },
-    { 40960, 179, 324, 1, 746 },
+    { 0, 8282, 22098, 151, 5 },
+    { 8282, 5227, 11198, 66, 358 },
+    { 13509, 14455, 40244, 261, 0 },
+    { 27964, 14905, 38398, 276, 471 },
+};
+
+static const uint8_t bookerly_18_italicGlyphGroups[754] = {
+    2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0,
+    2, 2, 2, 2, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0,
+    0, 2, 2, 2, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0,
+    0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 3, 3, 3, 0, 0, 3, 3, 0, 0, 3,
+    3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+};
+
+static const uint8_t bookerly_18_italicKernLeftClasses[754] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 0, 90,
+    0, 2, 73, 2, 30, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 3, 84, 70, 9, 34, 68, 47, 10, 10, 54,
+    57, 41, 109, 21, 9, 55, 43, 22, 53, 19, 6, 18, 18, 86, 11, 85,
+    82, 46, 0, 0, 0, 0, 38, 20, 74, 0, 45, 37, 23, 31, 0, 112,
+    91, 0, 31, 31, 20, 20, 93, 40, 80, 110, 38, 36, 36, 124, 36, 75,
+    69, 0, 0, 0, 0, 78, 0, 0, 0, 0, 0, 0, 0, 0, 0, 111,
+    0, 73, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 71,
+    0, 0, 0, 61, 3, 3, 3, 3, 3, 3, 34, 70, 34, 34, 34, 34,
+    10, 10, 10, 10, 9, 21, 9, 9, 9, 9, 9, 0, 9, 6, 6, 6,
+    6, 11, 66, 128, 38, 38, 38, 38, 38, 38, 45, 123, 45, 45, 45, 45,
+    0, 0, 39, 39, 20, 31, 20, 20, 20, 20, 20, 0, 89, 38, 38, 38,
+    38, 36, 20, 36, 3, 38, 3, 38, 44, 72, 70, 74, 70, 74, 70, 74,
+    70, 74, 9, 24, 9, 0, 34, 45, 34, 45, 34, 45, 88, 99, 34, 45,
+    47, 23, 47, 23, 47, 23, 47, 23, 10, 31, 10, 31, 10, 39, 10, 39,
+    10, 39, 67, 107, 10, 38, 54, 112, 54, 104, 57, 91, 74, 41, 0, 41,
+    125, 0, 24, 0, 0, 41, 108, 21, 31, 21, 31, 21, 31, 31, 21, 116,
+    9, 20, 9, 20, 9, 20, 34, 45, 22, 40, 22, 40, 22, 40, 53, 80,
+    53, 80, 53, 100, 53, 80, 19, 120, 19, 0, 19, 110, 6, 38, 6, 38,
+    6, 38, 6, 38, 6, 38, 6, 72, 18, 36, 11, 36, 11, 85, 75, 85,
+    75, 85, 75, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 64, 64, 83, 0, 131, 97, 1, 1, 58, 26, 26,
+    63, 8, 1, 4, 1, 13, 130, 32, 15, 51, 64, 8, 32, 1, 1, 8,
+    1, 101, 1, 12, 1, 25, 94, 52, 4, 62, 48, 51, 1, 1, 51, 26,
+    1, 26, 12, 12, 1, 27, 96, 81, 0, 14, 76, 106, 81, 27, 27, 74,
+    27, 27, 27, 14, 60, 14, 74, 60, 28, 14, 119, 17, 27, 27, 17, 29,
+    27, 29, 14, 14, 27, 76, 76, 98, 0, 74, 113, 0, 95, 103, 29, 29,
+    60, 74, 27, 28, 27, 117, 29, 12, 14, 50, 126, 51, 17, 26, 29, 25,
+    14, 42, 79, 35, 0, 0, 0, 77, 92, 32, 81, 77, 92, 8, 74, 8,
+    74, 8, 74, 51, 17, 0, 0, 0, 0, 102, 115, 94, 74, 15, 17, 16,
+    28, 16, 28, 59, 87, 51, 17, 51, 17, 1, 27, 65, 60, 121, 76, 121,
+    76, 1, 8, 106, 127, 122, 51, 17, 58, 103, 51, 17, 1, 0, 51, 17,
+    129, 13, 27, 13, 27, 64, 76, 64, 76, 12, 14, 12, 14, 8, 106, 32,
+    81, 114, 118, 1, 27, 1, 27, 12, 14, 12, 14, 12, 14, 12, 14, 4,
+    28, 4, 28, 4, 28, 1, 27, 15, 0, 1, 27, 35, 0, 56, 105, 48,
+    119, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 73, 73, 0, 73, 73, 73, 0, 0, 7, 5, 33, 7, 7, 5, 2,
+    0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 111, 71, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 0, 0, 0, 0, 110,
+    110, 0,
+};
+
+static const uint8_t bookerly_18_italicKernRightClasses[754] = {
+    0, 0, 0, 0, 0, 0, 95, 0, 0, 0, 0, 0, 0, 0, 80, 35,
+    0, 20, 27, 3, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32,
+    31, 0, 0, 0, 67, 0, 5, 68, 2, 68, 23, 23, 2, 23, 23, 57,
+    23, 23, 89, 23, 2, 68, 2, 68, 88, 33, 6, 25, 25, 86, 22, 104,
+    0, 11, 92, 0, 0, 0, 1, 28, 1, 1, 1, 12, 18, 28, 77, 62,
+    28, 28, 24, 24, 1, 90, 1, 24, 30, 45, 14, 21, 21, 82, 69, 79,
+    0, 0, 94, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 36,
+    0, 27, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 63,
+    0, 0, 0, 103, 5, 5, 5, 5, 5, 5, 49, 2, 23, 23, 23, 23,
+    23, 23, 23, 23, 68, 23, 2, 2, 2, 2, 2, 0, 2, 6, 6, 6,
+    6, 22, 23, 74, 1, 1, 1, 1, 55, 1, 1, 1, 1, 1, 1, 1,
+    99, 77, 47, 47, 1, 24, 1, 1, 1, 1, 1, 0, 58, 14, 14, 14,
+    14, 21, 87, 21, 5, 1, 5, 1, 5, 1, 2, 1, 2, 1, 2, 1,
+    2, 54, 68, 1, 68, 1, 23, 1, 23, 1, 23, 1, 23, 1, 23, 1,
+    2, 18, 2, 18, 2, 18, 2, 18, 23, 28, 23, 84, 23, 47, 23, 47,
+    23, 47, 23, 77, 23, 24, 23, 77, 57, 109, 23, 28, 24, 23, 28, 23,
+    28, 23, 28, 23, 28, 23, 81, 23, 24, 23, 24, 23, 24, 24, 23, 24,
+    2, 1, 2, 1, 2, 1, 2, 1, 68, 24, 68, 24, 68, 24, 88, 30,
+    88, 30, 88, 30, 88, 73, 33, 45, 33, 45, 33, 45, 6, 14, 6, 14,
+    6, 14, 6, 14, 6, 14, 6, 14, 25, 21, 22, 21, 22, 104, 79, 104,
+    79, 104, 98, 74, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 8, 8, 16, 8, 10, 88, 8, 8, 64, 37, 8,
+    16, 8, 8, 38, 8, 29, 8, 97, 8, 59, 8, 50, 101, 8, 8, 8,
+    37, 91, 8, 10, 8, 97, 10, 16, 38, 71, 43, 8, 26, 8, 8, 16,
+    8, 8, 100, 8, 78, 4, 72, 4, 66, 61, 4, 39, 40, 13, 13, 17,
+    19, 44, 17, 4, 17, 17, 4, 17, 15, 4, 51, 13, 9, 13, 13, 65,
+    13, 13, 40, 17, 75, 4, 4, 93, 66, 4, 76, 105, 96, 52, 19, 17,
+    85, 17, 13, 15, 13, 16, 17, 10, 4, 60, 15, 8, 17, 0, 102, 97,
+    17, 8, 83, 8, 66, 8, 17, 50, 39, 101, 40, 8, 17, 8, 17, 0,
+    0, 16, 0, 8, 17, 8, 17, 8, 17, 10, 4, 10, 4, 16, 17, 42,
+    15, 42, 15, 43, 51, 0, 0, 26, 9, 26, 9, 8, 85, 48, 41, 48,
+    41, 8, 50, 39, 8, 17, 37, 19, 8, 17, 8, 17, 26, 9, 0, 44,
+    106, 29, 4, 29, 4, 53, 4, 8, 4, 107, 56, 0, 56, 50, 39, 101,
+    40, 108, 70, 8, 13, 8, 13, 10, 4, 10, 4, 10, 4, 0, 40, 38,
+    15, 38, 15, 38, 15, 0, 9, 8, 66, 8, 13, 8, 66, 43, 51, 43,
+    51, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 27, 27, 0, 27, 27, 27, 0, 0, 7, 34, 3, 7, 7, 34, 3,
+    0, 0, 0, 0, 0, 0, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 36, 63, 0, 95, 0, 0, 0,
+    67, 67, 95, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 12, 12, 12, 12, 12,
+    30, 0,
+};
+
+static const int8_t bookerly_18_italicKernMatrix[14520] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, -1, 0, 0, -1, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, 0, 0, 0, -2, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -1, 0, -1, 2, -2, -4, 0, -4, -1, 0, 1, -1, -1, -2, -2, -1, 1, 0, 0, -2, -2, 0, -1, -4, -4, 0, 0, 2, 0, 0, 0, -2, -4, 0, 0, 2, 0, 0, 0, -1, -2, 2, 0, -1, 0, 0, -4, 1, 1, 0, 3, 1, -1, -1, 0, 3, -1, 1, -4, -1, 3, 0, 3, -3, 0, 0, 0, -2, 0, -1, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -2, 0, 0, 1, -3, -4, 0, 0, 0, -6, 0, 0, -1, 0, 0, 0, 1, 0, 0, -2, -4, 0, -1, -4, 0, -1, 0, 0, 0, 0, 0, -2, -3, -3, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -5, -2, 0, 0, 1, 1, 0, 0, 2, 0, 0, 0, 0, 2, 0, 0, -4, -5, 0, 0, 0, 0, 0, 2, 0, 0, -4, 0, 0, 0, 0, 2, 3, 0, -3, 2, -1, -2, -2, 2, 2, -2, 0, -3, 0, 0, 0, 2, -1, 0, -4, 0, 0, -2, 0, 0, -3, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, -2, 0, -1, 0, 0, 0, 0, -1, 0, 2, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -4, -2, -5, -4, -6, -2, 0, -2, 0, -2, 0, -2, -1, -1, 0, -1, -1, -4, -7, -5, 0, -1, -2, -1, -1, 0, 0, -1, -6, -3, 0, 0, -1, 0, 0, 0, -5, 0, -3, -2, -4, -1, -1, -3, 0, 0, 0, 0, -6, -2, -2, 0, -6, -4, -4, 0, -2, -4, -5, -1, -4, 0, 0, -2, 0, -2, -2, -2, 0, 0, -2, -3, -3, 0, -4, -3, -1, -3, -1, 0, -1, -2, -3, -1, -1, -1, -1, -2, -2, -1, -2, 0, -1, 0, -3, 0, -2, -1, -1, -2, -2, 0, 0, -1, -1, -2, 0, -2, 0,
+    0, -2, -1, -3, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -3, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, -2, 0, 0, 0, 0, -2, -2, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -3, -1, -4, -3, -4, -1, 0, -2, 0, -1, 0, -1, 0, 0, 0, 0, 0, -3, -6, -4, 0, 0, -2, 0, -1, 0, 0, 0, -4, -3, 0, 0, 0, 0, 0, 0, -4, 0, -2, -2, 0, 0, 0, -3, 0, 0, 0, 0, -4, 0, -1, 0, -4, -3, -3, -2, 0, -3, -3, -1, -3, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -2, -3, 0, -3, -3, 0, -2, -1, 0, 0, -1, -2, 0, 0, 0, 0, -1, -2, 0, -2, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, -1, 0, 0, 0, 0, -3, -1, 0, 0, -1, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, 1, -2, 0, 0, -1, -1, -3, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, -1, 0, 0, 1, 0, -1, 0, 0, 0, -2, 0, 0, 0, 0, -1, -2, -2, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, -2, 0, -1, -1, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, -2, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -1, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, -2, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, -1, -4, 0, -4, 0, 0, 0, 0, 0, 1, -1, 0, -1, 0, 0, 0, -2, 0, -4, 0, 1, 0, 0, 0, 0, -2, 0, 0, -2, -2, -2, 0, 1, 2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 1, 0, -4, 0, 0, 0, 0, -2, -2, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 1, -2, 0, 0, 0, 0, -1, 0, 0, -1, -2, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, -4, 0, -4, -2, -6, 0, -1, 0, -2, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, -5, -1, 0, 1, 0, 0, 0, 0, -3, -3, -1, 1, -2, 0, 0, -2, -4, 1, 0, 0, 0, 0, -4, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 1, -4, -1, 0, 0, 0, -3, 0, -1, 0, 0, -1, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -4, -2, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, -4, 0, 0, 0, 0, 0, 1, 0, 0, -3, 0, -2, -2, 0, 2, 2, -1, -2, 1, -1, -1, -3, 0, 0, -2, 0, -3, 0, 0, 0, 0, 0, 0, -3, 0, 0, -2, 0, 0, -2, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, -2, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -4, -2, 0, 0, 0, 0, 0, -1, 1, 0, -1, 0, 0, 0, 0, 0, -4, -4, 0, 0, 0, 0, 0, 1, -2, 0, -3, 0, -2, -2, 0, 1, 2, -1, -2, 2, -2, -2, -2, 1, 0, -3, 0, -4, 0, 0, 0, 0, -2, 0, -4, 0, 0, -2, 0, 0, -3, 0, -1, 0, -1, 0, -2, -2, 0, 0, 0, -2, -1, -2, 0, 0, -3, -2, 0, -2, 0, 0, 0, 0, -2, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -3, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, -1, -5, 0, -4, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, -2, 0, -5, 0, 1, 0, 0, 0, 0, -1, 0, 0, -2, -3, -3, 0, 1, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 1, 0, -5, 0, 0, 0, 0, -2, -2, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, -4, 0, -3, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, -2, 0, 2, 2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, -3, 0, 0, 0, 0, -2, -2, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -1, -3, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -2, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 2, -2, -2, 0, 0, 0, -4, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, -3, 0, 0, -3, 0, -2, 0, 0, 0, 0, 0, -2, -2, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 2, 0, 0, 0, 0, 3, 0, 1, 0, 0, 0, 1, 0, 0, 2, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 4, 1, 0, 2, 0, 0, 0, 0, 0, 0, 2, 0, 0, 2, 0, 0, 0, 4, 0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 0, 0, 0, 2, 0, 0, 0, 2, 0, 1, 4, 4, 0, 0, 4, 0, 0, 4, 0, 0, 2, 0, 2, 0, 2, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -4, -2, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -4, -4, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, -3, -3, 0, 0, 0, 0, -3, -1, -1, -1, 0, -1, -1, -2, 0, -3, 0, 0, 0, -1, 0, 0, -5, 0, 0, -1, 0, 0, -3, -1, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -2, 0, -1, 0, -3, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -2, 0, 0, 0, -3, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -2, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, -3, 0, -2, 0, -5, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0,
+    0, -4, -2, 0, -4, -3, 0, 0, 0, 0, -2, 0, -2, -2, -2, 0, 0, -1, -4, -4, 0, 0, 0, 0, -1, 0, 0, 0, 0, -3, -3, 0, 0, 0, 0, 0, 0, -1, 0, -2, -2, -2, 0, 0, -3, -1, 0, 0, 0, -5, 0, -2, 0, -5, -4, -4, -2, 0, -4, -2, 0, -2, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, -1, -3, 0, -3, -3, 0, -2, -2, 0, 0, -2, -2, 0, 0, 0, 0, 0, -2, -1, -2, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -2, 0, 0, 0, -2, 0, 0, 0, 0, 0, -2, 0, 0, -1, 0, -2, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -1, 0, -1, 2, -2, -4, 0, -4, -1, 0, 3, -1, -1, -2, -2, -1, 1, 0, 0, -2, -2, 0, -1, -4, -4, 0, 0, 2, 0, 0, 0, -2, -4, 0, 0, 2, 0, 0, 0, -1, -2, 2, 0, -1, 0, 0, -4, 1, 1, 0, 3, 1, -1, -1, 0, 3, -1, 1, -4, -1, 3, 0, 3, -3, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -3, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -3, -3, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, -2, -2, 0, 1, 0, -1, -2, 1, 0, 0, 0, 0, 0, -2, 0, -3, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, -3, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, -2, 0, 0, 0, 1, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, -1, 0, -2, 1, 0, 0, -1, 0, 0, 0, 2, 0, 0, 0, 0, 0, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 2, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 2, 0, 0, 2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 0, 0, 2, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, -3, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, -3, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, -2, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, -2, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -3, -2, 0, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, -1, 0, -5, -3, 0, 0, 0, 0, 0, 1, 0, 0, -4, 0, 0, 0, 0, 2, 2, 0, -2, 2, -3, -3, -4, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, -5, 0, 0, -2, 0, 0, -3, 0, -1, 0, 0, 0, -2, -2, 0, 0, 0, -2, -2, -2, 0, 0, -3, 0, 0, -2, 0, 2, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, -2, 0, 0, -1, 0, 0, 0, 0, -2, 2, 0, 0, 0, 0, 0, 3, 0, 7, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 7, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 2, 0, -1, 1, 0, 8, 0, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -2, 0, 0, 1, -3, -4, 0, 0, 0, -6, 4, 0, -1, 0, 0, 0, 2, 0, 0, -2, -4, 0, -1, -4, 0, -1, 0, 0, 0, 0, 0, -2, -3, -3, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 1, 0, 0, 0, 0, -1, -1, 0, 4, 0, 0, 0, 0, 5, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 1, -2, 0, 0, -3, -1, 0, 0, 0, 0, -2, -2, 0, 3, 0, 0, -2, -3, 0, 0, -4, -3, 0, 0, 1, 0, 0, 0, -2, 0, 0, 0, 2, 0, 0, 0, 0, -3, 2, 0, 0, 0, 0, -3, 1, 2, 1, 0, 1, 0, 0, 0, 0, 0, 3, -4, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 2, 1, 0, 0, 1, 0, 0, 0, 2, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, -1, -1, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, -1, 0, 0, 0, 0, -2, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, -1, -1, 0, 0, 0, -1, 1, 0, 0, 0, -2, 0, 2, 0, 0, 0, 0, -2, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, -2, 0, 0, 0, 0, -1, -2, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, -1, 0, -2, 0, 0, 0, 0, 0, -1, 0, 6, 0, 0, 0, 0, 0, 2, -1, 0, 0, 1, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, -2, -2, 0, 4, -2, 1, 0, -2, 6, 0, 4, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 2, 2, 0, 2, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -4, -2, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -5, -4, 0, 0, 0, 0, 0, 0, -2, 0, -4, 0, -2, -2, 0, 0, 0, 0, -3, 1, -1, -2, -2, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, -2, 0, 0, -3, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, -2, -2, 0, 0, 0, -2, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -4, -2, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, -4, 0, 0, 0, 0, 0, 1, 0, 0, -3, 0, -2, -2, 0, 2, 2, -1, -2, 1, -1, -1, -3, 0, 0, -2, 0, -3, 0, 0, 0, 0, 0, 0, -3, 0, 0, -2, 0, 0, -2, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, -2, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 1, 0, -1, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, -4, 0, -4, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, -4, 0, -1, -1, 0, -1, 0, 0, 0, 0, -1, -3, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, -5, 0, 0, 0, 0, -2, -2, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, -2, 0, 0, 0, 0, -2, -1, 0, 0, -1, 0, -1, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, -1, -1, 0, 0, 0, -1, -1, 0, 0, -2, -2, 0, 2, -2, 0, 0, 0, -2, 0, 1, 0, 0, 0, 0, 0, -2, 0, 0, 1, 0, -2, 0, 0, 0, -2, -2, 0, 0, 0, -1, -2, -1, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, -1, -1, 0, 0, 1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, -2, 0, 0, 1, 0, -1, 1, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, -1, 0, 0, 0, 0, -2, -1, 0, 0, -1, 0, 1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, -1, -1, 0, 0, 0, -1, 1, 0, 0, 0, -2, 0, 2, 0, 0, 0, 0, -2, 0, 2, 0, 4, 2, 0, 0, 0, 0, 0, 2, 0, -1, 0, 0, 4, -2, 0, 0, 0, 0, -1, -2, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -3, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 1, 0, 0, 0, -2, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, -1, -1, 0, 4, -1, 0, -2, -1, 3, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -3, 0, 0, 0, 0, -1, 0, 0, -3, 0, 0, 0, 0, -1, 0, 0, -1, -3, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -2, -2, 0, 0, 0, 0, -1, -1, 0, 0, 0, -2, -1, -1, 0, -1, 0, 0, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, -1, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -3, 0, -2, -1, -3, 0, 0, 0, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, -3, -2, 0, 0, 0, 0, 0, 0, -3, 1, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, 0, 0, -2, 0, -2, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0, -2, -4, 0, 0, -2, 0, 0, 0, -3, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -5, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -4, 0, -2, -1, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, -2, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -1, -2, 0, 0, 0, -1, 0, 0, 0, 0, 3, 0, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, -2, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 3, -1, 0, 0, 0, 3, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, -3, 0, -3, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, -2, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 1, 0, -4, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 2, -1, -2, -2, 0, 2, -2, 0, 0, -2, 2, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, -1, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, 4, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 3, 0, 0, -2, 0, 3, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -3, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, -1, 0, 0, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, -2, -2, 0, 2, -2, 0, 0, -2, 2, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -2, 0, -1, 0, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, -2, 2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, -2, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, -1, -1, 0, 0, 0, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2, 0, 0, -2, 0, 0, 0, 0, 0, -2, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -1, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, -1, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 3, -1, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, -2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -2, 3, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -3, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -2, 2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 2, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 2, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t bookerly_18_italicGlyphLookup[368] = {
+    0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0001, 0x0002, 0xFFFF, 0xFFFF, 0xFFFF, 0x0003, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0004, 0xFFFF, 0xFFFF,
+    0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, 0x0010, 0x0011, 0x0012, 0x0013, 0x0014,
+    0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, 0x0020, 0x0021, 0x0022, 0x0023, 0x0024,
+    0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, 0x0030, 0x0031, 0x0032, 0x0033, 0x0034,
+    0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, 0x0040, 0x0041, 0x0042, 0x0043, 0x0044,
+    0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051, 0x0052, 0x0053, 0x0054,
+    0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, 0x0060, 0x0061, 0x0062, 0x0063, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x0072, 0x0073,
+    0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, 0x0080, 0x0081, 0x0082, 0x0083,
+    0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F, 0x0090, 0x0091, 0x0092, 0x0093,
+    0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F, 0x00A0, 0x00A1, 0x00A2, 0x00A3,
+    0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF, 0x00B0, 0x00B1, 0x00B2, 0x00B3,
+    0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF, 0x00C0, 0x00C1, 0x00C2, 0x00C3,
+    0x0241, 0x0242, 0x0243, 0x0244, 0x0245, 0x0246, 0x0247, 0x0248, 0x0249, 0x024A, 0x024B, 0x024C, 0x024D, 0x024E, 0x024F, 0x0250,
+    0x0251, 0x0252, 0x0253, 0x0254, 0x0255, 0x0256, 0x0257, 0x0258, 0x0259, 0x025A, 0x025B, 0x025C, 0x025D, 0x025E, 0x025F, 0x0260,
+    0x0261, 0x0262, 0x0263, 0x0264, 0x0265, 0x0266, 0x0267, 0x0268, 0x0269, 0x026A, 0x026B, 0x026C, 0x026D, 0x026E, 0x026F, 0x0270,
+    0x0271, 0xFFFF, 0x0272, 0x0273, 0x0274, 0x0275, 0x0276, 0x0277, 0x0278, 0x0279, 0x027A, 0x027B, 0x027C, 0xFFFF, 0x027D, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x027E, 0x027F, 0xFFFF, 0xFFFF, 0x0280, 0x0281, 0x0282, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x0283, 0xFFFF, 0xFFFF, 0xFFFF, 0x0284, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0285,
+    0x0286, 0x0287, 0x0288, 0x0289, 0x028A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
 };
 
 static const EpdFontData bookerly_18_italic = {
     bookerly_18_italicBitmaps,
     bookerly_18_italicGlyphs,
     bookerly_18_italicIntervals,
-    64,
+    65,
     49,
     40,
     -10,
     true,
     bookerly_18_italicGroups,
-    11,
+    4,
+    bookerly_18_italicKernLeftClasses,
+    bookerly_18_italicKernRightClasses,
+    bookerly_18_italicKernMatrix,
+    110,
+    nullptr,
+    0,
+    0,
+    bookerly_18_italicGlyphLookup,
+    bookerly_18_italicGlyphGroups,
+    false,
+    nullptr,
 };
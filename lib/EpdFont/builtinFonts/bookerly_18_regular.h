@@ -3,2353 +3,2486 @@
  * name: bookerly_18_regular
  * size: 18
  * mode: 2-bit  compressed: true
- * Command used: fontconvert.py bookerly_18_regular 18 ../builtinFonts/source/Bookerly/Bookerly-Regular.ttf --2bit --compress
+ * Command used: fontconvert.py bookerly_18_regular 18 ../builtinFonts/source/Bookerly/Bookerly-Regular.ttf --2bit --compress --frequency-corpus ../../../test/hyphenation_eval/resources/english_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/french_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/german_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/italian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/russian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/spanish_hyphenation_tests.txt
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t bookerly_18_regularBitmaps[37453] = {
-    0xB5, 0x5A, 0xBF, 0x93, 0xDD, 0xD6, 0x75, 0xBE, 0x78, 0xD0, 0x2E, 0x26, 0xC2, 0x4C, 0xE0, 0x42,
-    0x9B, 0x4C, 0xC8, 0x02, 0x4D, 0x9A, 0x78, 0x32, 0xC6, 0x3F, 0x20, 0x0B, 0x90, 0x59, 0xA8, 0x70,
-    0xC1, 0x2D, 0xB8, 0xF2, 0x58, 0x2A, 0x92, 0x22, 0x2E, 0x64, 0xCF, 0x64, 0x5B, 0x17, 0x12, 0x01,
-    0x0F, 0x0B, 0x17, 0x29, 0xB4, 0x05, 0x9D, 0xD2, 0xE3, 0x42, 0x9E, 0xB1, 0x56, 0x33, 0xD9, 0x56,
-    0x05, 0x45, 0xC0, 0x64, 0xC1, 0x42, 0x85, 0x9E, 0xCD, 0xCC, 0xB8, 0x48, 0x61, 0x38, 0xA6, 0xE3,
-    0x98, 0x2A, 0x0C, 0xD9, 0x90, 0x84, 0x47, 0x01, 0xB8, 0xFE, 0xBE, 0xEF, 0xE0, 0xED, 0x2E, 0x29,
-    0x31, 0xB2, 0x24, 0xE7, 0x2D, 0x16, 0x3F, 0x2E, 0x80, 0x7B, 0xCF, 0x3D, 0x3F, 0xBF, 0x73, 0x2E,
-    0x76, 0x2E, 0x0D, 0xF5, 0xE5, 0xDE, 0x27, 0x9D, 0x6D, 0x73, 0xD2, 0xDE, 0x8C, 0xB9, 0x5D, 0x8D,
-    0xDA, 0xAB, 0x61, 0xFB, 0x4C, 0xE0, 0xF0, 0x7B, 0x22, 0x1C, 0xEB, 0x77, 0xC6, 0xFA, 0xA7, 0x47,
-    0x38, 0x4F, 0x8B, 0x1B, 0xF9, 0xB3, 0x63, 0xFE, 0x35, 0x6D, 0x01, 0xB6, 0xE1, 0x74, 0xCB, 0x5C,
-    0xFF, 0x15, 0xD7, 0xBB, 0xB3, 0x5F, 0xEE, 0x9E, 0xC1, 0xFE, 0x19, 0xF7, 0x55, 0xEC, 0x5F, 0x71,
-    0x2F, 0x63, 0x7F, 0x03, 0x7F, 0xCE, 0x8D, 0x6E, 0x70, 0xC1, 0xC1, 0xE6, 0x60, 0x73, 0x25, 0xF4,
-    0xF8, 0x8D, 0x11, 0xF7, 0x83, 0x0B, 0xBB, 0xB0, 0x75, 0x2E, 0x6C, 0xC3, 0xB5, 0x73, 0xD1, 0x3A,
-    0x6A, 0xB0, 0x6F, 0x62, 0xEC, 0xE3, 0x26, 0xA9, 0x9C, 0x4B, 0xAA, 0xA4, 0x70, 0x5F, 0x3E, 0xB9,
-    0x5F, 0xDF, 0xAF, 0x72, 0x3E, 0xDF, 0x7C, 0xB9, 0x3E, 0xAE, 0x8F, 0x0B, 0x74, 0xCF, 0x41, 0xBE,
-    0x8A, 0x01, 0x1C, 0x86, 0xB8, 0xA1, 0x41, 0x46, 0xEC, 0x07, 0xFC, 0x39, 0xF7, 0x23, 0xFC, 0x2D,
-    0xBF, 0xB0, 0xD1, 0x13, 0xEC, 0xF5, 0xDC, 0xC9, 0xAE, 0x6F, 0x1D, 0xC6, 0x6F, 0x57, 0x7E, 0xF6,
-    0x55, 0xF9, 0xFD, 0xDB, 0x63, 0xD2, 0x7E, 0x37, 0x59, 0x8F, 0x51, 0x75, 0x23, 0x6D, 0xBE, 0x1B,
-    0x7F, 0x6F, 0x8C, 0x2B, 0x97, 0xB4, 0x6F, 0x3A, 0xE7, 0xFF, 0xAD, 0x72, 0xA1, 0xC7, 0xEC, 0x52,
-    0x0F, 0xF2, 0x32, 0xBC, 0x85, 0x33, 0xBC, 0xFF, 0x91, 0x07, 0x69, 0xF1, 0xF8, 0x84, 0xEB, 0xB2,
-    0x5B, 0xEB, 0xC4, 0x4D, 0xCF, 0xB8, 0x2E, 0xF9, 0x45, 0x97, 0xB8, 0xB1, 0x2E, 0xBA, 0xEC, 0xCE,
-    0x94, 0x44, 0x7D, 0xFE, 0xE0, 0xA3, 0xD9, 0x81, 0xE0, 0x22, 0xA8, 0x7D, 0x81, 0x57, 0x31, 0xF0,
-    0xAA, 0x73, 0x8F, 0x9C, 0x84, 0x9D, 0x38, 0x75, 0xEE, 0x47, 0xCE, 0x07, 0x78, 0x9E, 0x1C, 0x4D,
-    0xF8, 0xE2, 0x5B, 0x1C, 0x11, 0x73, 0xBA, 0x8A, 0xEB, 0x75, 0x4D, 0xEE, 0xBA, 0x78, 0x1D, 0xB7,
-    0x2E, 0xAD, 0xF8, 0xF6, 0xE8, 0x92, 0xC6, 0x05, 0x03, 0x5A, 0x63, 0xD0, 0x77, 0x13, 0x8F, 0x90,
-    0x99, 0x59, 0x11, 0xF6, 0x1C, 0x03, 0x6D, 0x13, 0x3B, 0x5A, 0xF1, 0x01, 0xF2, 0x08, 0x0F, 0x34,
-    0x2F, 0xBB, 0x6F, 0x17, 0x69, 0x13, 0x43, 0xC8, 0x7E, 0x0C, 0x87, 0xB0, 0x4B, 0x03, 0x70, 0xB5,
-    0x7C, 0xB7, 0x4F, 0x8A, 0x29, 0x1C, 0x22, 0xDF, 0xC7, 0xCD, 0x5B, 0xAE, 0x74, 0x59, 0x1B, 0xAD,
-    0x73, 0x74, 0x47, 0xC9, 0xA4, 0xCD, 0x0A, 0x9D, 0x04, 0x5D, 0xD4, 0xA2, 0x03, 0xB0, 0x18, 0xDD,
-    0x65, 0x15, 0x19, 0x7E, 0x53, 0xA3, 0xBE, 0xE2, 0xD2, 0x26, 0xEC, 0x49, 0x59, 0x44, 0x82, 0x30,
-    0x3A, 0x46, 0x25, 0xB9, 0x8D, 0xCB, 0x9A, 0x52, 0x47, 0x08, 0xBC, 0x70, 0x11, 0x29, 0xC3, 0x51,
-    0xB3, 0xFF, 0x16, 0xFE, 0x9F, 0xDA, 0x4E, 0x7A, 0x77, 0x5F, 0x53, 0xF7, 0x33, 0x0F, 0xB1, 0xF7,
-    0x15, 0x35, 0x6E, 0x9D, 0x53, 0x60, 0x79, 0x91, 0xF0, 0x50, 0x8A, 0x14, 0x57, 0x3B, 0x5D, 0x9D,
-    0x1E, 0xB2, 0x42, 0x87, 0xAB, 0x7C, 0xAF, 0x7C, 0x76, 0x90, 0xF6, 0x55, 0xAD, 0x0E, 0x8D, 0x75,
-    0xD9, 0x62, 0x76, 0x55, 0xE4, 0xBB, 0x15, 0x0E, 0xE9, 0x6F, 0xC7, 0xE0, 0xE4, 0x7E, 0x91, 0xDF,
-    0x9A, 0x49, 0x77, 0xE9, 0x7C, 0x81, 0x43, 0xED, 0xF2, 0x75, 0xB4, 0x76, 0xDE, 0x25, 0x3D, 0x0E,
-    0xB3, 0x8B, 0xE6, 0x98, 0x57, 0xCE, 0xBF, 0xD3, 0xF0, 0x90, 0x43, 0xDA, 0x65, 0x05, 0xA2, 0x2A,
-    0x97, 0xB7, 0x6E, 0x05, 0x55, 0x48, 0xE7, 0xE2, 0xD0, 0xFB, 0x23, 0x6A, 0xEF, 0x6F, 0x41, 0x71,
-    0x8D, 0xFF, 0xC3, 0xD1, 0x05, 0x2F, 0x15, 0x2E, 0x38, 0x72, 0xD1, 0xDD, 0x7E, 0xCA, 0x2F, 0xDF,
-    0xEE, 0xC6, 0x3C, 0xB9, 0xD5, 0xBD, 0xB9, 0x4C, 0xEF, 0x69, 0x07, 0x86, 0x84, 0x83, 0xA3, 0xD4,
-    0x1A, 0x0A, 0x70, 0x76, 0xC1, 0xC8, 0x06, 0xF0, 0x0B, 0x6D, 0x98, 0x59, 0x4A, 0x56, 0x81, 0x74,
-    0x6D, 0xC5, 0xB9, 0xCD, 0x5A, 0x74, 0x37, 0x5D, 0x43, 0x25, 0x5D, 0xD2, 0xB9, 0xA8, 0x77, 0x21,
-    0x06, 0x04, 0xB3, 0xBC, 0xE6, 0x99, 0xB6, 0x2E, 0x1E, 0xDC, 0x6A, 0x76, 0x32, 0x06, 0x53, 0x79,
-    0x3C, 0xC0, 0x5B, 0x3C, 0x94, 0x0D, 0x6F, 0xF3, 0x59, 0x3C, 0xA8, 0x86, 0x8A, 0xBD, 0xAC, 0xF8,
-    0x04, 0xB5, 0x5C, 0x6D, 0x50, 0x2C, 0x0C, 0x11, 0x5B, 0xF3, 0x72, 0x81, 0x3B, 0x3D, 0x29, 0x07,
-    0xA7, 0x28, 0x6F, 0x90, 0x89, 0xFB, 0x68, 0xE2, 0x23, 0x23, 0x27, 0xC1, 0x07, 0x4B, 0x6D, 0xA9,
-    0x29, 0xAE, 0xDB, 0xC1, 0xE0, 0x7D, 0xD8, 0x8C, 0xAB, 0xF1, 0x15, 0x57, 0xFF, 0x10, 0xEC, 0xFA,
-    0x4E, 0x93, 0xF8, 0x2E, 0xFB, 0x60, 0xAC, 0x7F, 0x18, 0x64, 0x77, 0x9A, 0xF0, 0xA7, 0x83, 0x14,
-    0xF8, 0xC9, 0xAD, 0xE0, 0xDF, 0x72, 0x52, 0x17, 0xA9, 0x11, 0x75, 0xEC, 0x7C, 0x03, 0xCD, 0xFD,
-    0x55, 0xFC, 0xFF, 0xEA, 0xA0, 0xFC, 0xC1, 0x95, 0x4F, 0x7C, 0xC2, 0x1A, 0xF8, 0xFB, 0xE7, 0x68,
-    0x0C, 0x27, 0xFC, 0x41, 0xA1, 0xA3, 0x3E, 0xE9, 0x92, 0x26, 0xAF, 0xAE, 0xBA, 0xEF, 0xBA, 0xBD,
-    0x83, 0xA2, 0xF4, 0x33, 0xB6, 0xDC, 0x4F, 0x3B, 0x97, 0xA6, 0xF2, 0x43, 0x9F, 0xAF, 0xA9, 0x6A,
-    0x7B, 0xD4, 0xAF, 0xC6, 0x99, 0x7A, 0x77, 0xB2, 0x0F, 0x4D, 0x49, 0x8A, 0x04, 0xB6, 0x7F, 0xF2,
-    0xCD, 0x9B, 0xF2, 0x6D, 0x67, 0x37, 0xA3, 0x6E, 0xA1, 0xE0, 0x71, 0x37, 0xC3, 0x47, 0x6F, 0x5E,
-    0xA8, 0x4E, 0x6D, 0xDC, 0xD1, 0x2B, 0x40, 0x37, 0x47, 0x30, 0x09, 0xF6, 0x17, 0xF8, 0x22, 0x1D,
-    0xA5, 0x76, 0x45, 0x5D, 0xB8, 0xAC, 0x93, 0xEC, 0x20, 0x2F, 0x57, 0x7F, 0x9D, 0xCE, 0xE7, 0xD7,
-    0xE8, 0x25, 0x1A, 0x71, 0xDB, 0x79, 0x2A, 0x76, 0xFE, 0x0E, 0x7A, 0x4F, 0x3E, 0x44, 0x63, 0x38,
-    0x9D, 0x36, 0x96, 0x6C, 0xD4, 0x93, 0x71, 0x8F, 0xBE, 0xC3, 0x31, 0xC3, 0xEB, 0x3E, 0xA2, 0x3C,
-    0x0B, 0x6A, 0x6F, 0x93, 0x0E, 0xAE, 0x5C, 0xAF, 0xFC, 0x7D, 0x78, 0xB2, 0xCC, 0x63, 0x17, 0xC8,
-    0xD0, 0x82, 0x6F, 0x6D, 0x8D, 0x70, 0x0D, 0x52, 0xAA, 0x5D, 0xA8, 0x73, 0x0E, 0x7F, 0xE3, 0xE9,
-    0xEA, 0xA0, 0x29, 0x54, 0xB3, 0x68, 0x90, 0xEE, 0x7C, 0x9E, 0x4B, 0x38, 0xBF, 0x7B, 0xA5, 0xF7,
-    0x7F, 0xE0, 0x1C, 0xCD, 0xE0, 0x4B, 0x8C, 0x9C, 0x7A, 0xDA, 0x25, 0x08, 0x81, 0x1E, 0xFA, 0x06,
-    0x5A, 0xE4, 0x2F, 0x21, 0x0E, 0x4C, 0xD4, 0xB0, 0x01, 0xB2, 0xCD, 0xD6, 0x4F, 0x90, 0x11, 0x4E,
-    0x9A, 0xE9, 0x38, 0x0D, 0x72, 0x06, 0x06, 0xCA, 0x13, 0x90, 0x4C, 0x75, 0x76, 0x35, 0x4F, 0xC6,
-    0xED, 0xC9, 0x69, 0x0B, 0x9F, 0x01, 0x07, 0x5D, 0x32, 0x1F, 0x1F, 0xBF, 0x4E, 0x15, 0x1A, 0x6B,
-    0xEA, 0x10, 0x43, 0x07, 0xEE, 0xEC, 0xD3, 0x99, 0xB6, 0xA0, 0x01, 0x6C, 0x7E, 0x50, 0x77, 0xE5,
-    0x3A, 0x9C, 0xA0, 0xE9, 0xE5, 0xB5, 0x06, 0x76, 0xF0, 0x25, 0x5A, 0xA4, 0x0B, 0x26, 0x1B, 0x2D,
-    0xA0, 0xA3, 0xC2, 0x7F, 0x8A, 0xFF, 0x1C, 0x52, 0x4A, 0x38, 0x01, 0xCA, 0xC8, 0x28, 0x23, 0x51,
-    0x1C, 0x74, 0x35, 0x2D, 0x0D, 0x35, 0xA6, 0x57, 0x93, 0xA7, 0xED, 0xCE, 0xA1, 0x6F, 0xC9, 0x5F,
-    0xF9, 0xBC, 0x0B, 0xD7, 0xCF, 0x5C, 0x7B, 0x46, 0x0F, 0x96, 0x91, 0xC0, 0x94, 0x6F, 0xC9, 0xBB,
-    0x27, 0x0C, 0x2B, 0xF1, 0x47, 0x68, 0x8C, 0x36, 0x13, 0x27, 0x5C, 0x62, 0xD8, 0x11, 0xA6, 0x1E,
-    0x4C, 0x30, 0x73, 0x37, 0x93, 0x1C, 0xEF, 0xD0, 0x58, 0xD3, 0xFE, 0xCB, 0x02, 0x8D, 0x79, 0x85,
-    0x46, 0x52, 0x5D, 0xA4, 0xBF, 0x39, 0x38, 0xFC, 0xCD, 0x73, 0x8A, 0xA2, 0xDC, 0xCD, 0x29, 0xF7,
-    0x15, 0x5D, 0x27, 0xA3, 0x1C, 0x07, 0xD2, 0x6C, 0xF8, 0xFA, 0xF9, 0x46, 0xF7, 0x13, 0x4A, 0xC1,
-    0xB7, 0x70, 0xB4, 0x74, 0x5F, 0xBE, 0x4D, 0xC8, 0x61, 0xFA, 0x5E, 0xF9, 0xD8, 0x69, 0x7B, 0x32,
-    0xD3, 0x10, 0xFC, 0x3D, 0xEA, 0x49, 0x47, 0x91, 0xAD, 0xDD, 0x5E, 0x4D, 0x26, 0x96, 0x62, 0x76,
-    0x43, 0xE5, 0xA3, 0x5E, 0xAF, 0xB7, 0x27, 0x8C, 0xDC, 0xE3, 0x22, 0xA2, 0x1C, 0xBA, 0x98, 0x4D,
-    0x7C, 0xA1, 0xC8, 0xA5, 0xDE, 0x68, 0x0C, 0x7E, 0x6C, 0x7C, 0x80, 0x93, 0x70, 0x17, 0xBD, 0x82,
-    0x42, 0xE5, 0x6A, 0x8C, 0x12, 0x93, 0x13, 0x62, 0x04, 0x5F, 0x2F, 0xB7, 0x3D, 0xA7, 0x12, 0x3C,
-    0x8C, 0x05, 0x0F, 0x6E, 0xA8, 0xB2, 0x88, 0xA7, 0xF7, 0x6B, 0x0F, 0xA5, 0x88, 0x67, 0x28, 0x4E,
-    0x3C, 0x62, 0xC4, 0xA4, 0x07, 0x45, 0x19, 0x95, 0xBE, 0x7C, 0xB5, 0x83, 0xC2, 0x41, 0x2E, 0xD1,
-    0x80, 0x1E, 0xB2, 0x35, 0xFA, 0xF6, 0x10, 0x60, 0x3C, 0x84, 0xFE, 0x7F, 0x7C, 0x13, 0x2E, 0x96,
-    0x86, 0x81, 0x5E, 0x28, 0xD8, 0x97, 0x6F, 0xC9, 0xAC, 0xBB, 0xDC, 0x5D, 0xBE, 0x7F, 0xFC, 0xC6,
-    0x98, 0x53, 0x3E, 0xF4, 0x6A, 0x80, 0x21, 0x49, 0x17, 0x1B, 0xD3, 0x4C, 0xFF, 0x9A, 0x85, 0x3B,
-    0x31, 0xE3, 0x16, 0xD4, 0xDA, 0x9A, 0xD3, 0xAD, 0x5A, 0x52, 0x6B, 0x4C, 0xB6, 0xBC, 0x8A, 0x1E,
-    0xBA, 0xD2, 0x3D, 0x3D, 0x29, 0x19, 0x8C, 0xF2, 0x55, 0x62, 0x02, 0x5D, 0x50, 0x66, 0x20, 0xA4,
-    0x73, 0xE5, 0xFD, 0xBA, 0x43, 0xA7, 0x79, 0x0B, 0x21, 0xE5, 0xB2, 0x07, 0x5C, 0x85, 0x23, 0x26,
-    0x99, 0xB4, 0x69, 0xC7, 0x10, 0xD5, 0x43, 0xB1, 0xF3, 0x8D, 0x74, 0xB1, 0x63, 0x50, 0x22, 0x2A,
-    0x01, 0xC7, 0xCA, 0x5B, 0xBE, 0xC5, 0x88, 0xBE, 0x05, 0x2B, 0xEA, 0x5B, 0xD4, 0x15, 0x71, 0x81,
-    0xDE, 0x63, 0xA0, 0xC3, 0xFF, 0x35, 0x9A, 0xEA, 0x68, 0x82, 0xAA, 0x26, 0xFE, 0x79, 0x0F, 0x5F,
-    0x0C, 0x2E, 0x44, 0xE2, 0xC2, 0x4B, 0x85, 0x99, 0x83, 0xFC, 0x50, 0x2A, 0x11, 0xFD, 0x1E, 0x0F,
-    0xF4, 0x2B, 0xD8, 0x63, 0x11, 0xF8, 0x4B, 0x18, 0x1F, 0xA0, 0x10, 0x02, 0x65, 0xB4, 0x78, 0x0F,
-    0xD3, 0xCF, 0x7F, 0x41, 0x4F, 0x72, 0x19, 0x11, 0x62, 0x42, 0x20, 0x8C, 0xFB, 0xB2, 0x25, 0xA9,
-    0x9B, 0xE7, 0x3D, 0x55, 0x68, 0x94, 0x42, 0xB9, 0x9D, 0x03, 0xB1, 0x60, 0x5C, 0xD4, 0x62, 0xC5,
-    0xAB, 0x8C, 0x8E, 0x50, 0x16, 0x02, 0xDD, 0x3B, 0xA4, 0x87, 0xC3, 0x83, 0x21, 0x11, 0x8D, 0x3C,
-    0xCF, 0xC5, 0x6B, 0x73, 0xF9, 0xE1, 0x6C, 0xD1, 0xFA, 0xF4, 0x77, 0xEA, 0xAB, 0x57, 0x7D, 0x3C,
-    0x26, 0x53, 0x32, 0x8A, 0xAB, 0x8F, 0xFE, 0x1E, 0xE3, 0xF4, 0x97, 0x5F, 0x44, 0x43, 0xC0, 0xD8,
-    0x25, 0x42, 0x25, 0xA2, 0x76, 0x04, 0x96, 0xA5, 0xB3, 0x29, 0x2F, 0xE8, 0x77, 0x09, 0x35, 0x8C,
-    0x24, 0xAD, 0xA4, 0x78, 0x24, 0xB0, 0x9C, 0x9C, 0x1E, 0x75, 0x91, 0xB4, 0x4F, 0xBD, 0x7C, 0xF9,
-    0xF8, 0xF8, 0xF8, 0x32, 0x74, 0xE4, 0xD7, 0x82, 0xAA, 0x8F, 0xFE, 0x68, 0x74, 0xDB, 0x30, 0x25,
-    0xD4, 0x11, 0x62, 0x50, 0x06, 0x62, 0xF5, 0x1C, 0xB1, 0xE7, 0xF4, 0xAC, 0xE7, 0xCE, 0x89, 0x0A,
-    0xD9, 0x06, 0xEE, 0x73, 0x60, 0x8E, 0x0B, 0x33, 0xD1, 0xA8, 0xF0, 0x1E, 0x0E, 0x58, 0xD7, 0xA2,
-    0x43, 0x70, 0x1D, 0x8D, 0x40, 0x6D, 0xBE, 0xA7, 0x9C, 0xBF, 0xF2, 0x0D, 0x6F, 0x9A, 0x45, 0xD8,
-    0x73, 0xD3, 0xC2, 0x52, 0xAE, 0x18, 0x03, 0x17, 0x8B, 0x61, 0x32, 0x0F, 0xE0, 0x36, 0xBB, 0x72,
-    0x96, 0xE1, 0xE4, 0x06, 0x30, 0x39, 0x81, 0xE2, 0x3C, 0xAE, 0xA4, 0x77, 0xC6, 0xD8, 0xA1, 0x37,
-    0xA1, 0xFC, 0x8B, 0x79, 0xFD, 0xFA, 0x77, 0xE6, 0x9C, 0x30, 0x95, 0xC2, 0x8E, 0xF2, 0x94, 0x40,
-    0x39, 0xEE, 0x10, 0x9D, 0xC5, 0xB3, 0xC9, 0x50, 0xB2, 0xA4, 0x6D, 0xD2, 0x00, 0xD8, 0x95, 0x9C,
-    0x06, 0x48, 0x80, 0xA6, 0xEE, 0x32, 0xBC, 0x54, 0x65, 0x01, 0x52, 0xE1, 0xBC, 0x92, 0x2E, 0x98,
-    0x5F, 0xEC, 0x41, 0xEA, 0x84, 0x50, 0x0A, 0x84, 0x31, 0x01, 0x3E, 0x76, 0xC0, 0x0C, 0xC9, 0xCF,
-    0x47, 0x98, 0x3E, 0xE2, 0xE3, 0x94, 0x33, 0xEC, 0xA0, 0xE1, 0x2E, 0x66, 0x7D, 0xC1, 0xB3, 0x81,
-    0x26, 0x89, 0x86, 0xDB, 0x78, 0x6D, 0x73, 0xD8, 0x20, 0xBF, 0x00, 0x80, 0xC5, 0x13, 0xD9, 0x25,
-    0x68, 0x3D, 0x5E, 0x89, 0xBA, 0xBC, 0x8A, 0xD8, 0xC7, 0x44, 0x2B, 0xA9, 0xEA, 0xF7, 0xEB, 0x2A,
-    0xA3, 0x49, 0xD7, 0x08, 0x23, 0xA0, 0xC4, 0x5F, 0x03, 0xFF, 0x60, 0x2C, 0x17, 0xAA, 0x60, 0xDF,
-    0x2C, 0x54, 0xB2, 0x98, 0x97, 0xA9, 0x27, 0x5B, 0xC1, 0xE5, 0xF4, 0x7E, 0x7F, 0x4D, 0xB9, 0x6D,
-    0xA0, 0x8A, 0x8C, 0xDE, 0x9C, 0x2C, 0x85, 0xCD, 0x13, 0x3D, 0x1E, 0x1C, 0xC2, 0xE1, 0x3D, 0xF4,
-    0xDB, 0xB5, 0xC3, 0xD2, 0xAB, 0x5F, 0x60, 0xE5, 0x5A, 0x23, 0x2C, 0x42, 0xA7, 0x64, 0xC1, 0xA9,
-    0x5F, 0xC8, 0xB9, 0x26, 0xB7, 0x65, 0xE5, 0xE9, 0x35, 0x1D, 0xF2, 0xC5, 0x03, 0xCB, 0x1B, 0x00,
-    0xBB, 0xE8, 0x30, 0xAA, 0x37, 0x82, 0xF2, 0x46, 0x20, 0x21, 0x33, 0xBC, 0x40, 0x3F, 0x01, 0x0B,
-    0x65, 0x6F, 0x3C, 0xA0, 0xB7, 0x8C, 0x9E, 0x49, 0x88, 0x44, 0xB8, 0xCD, 0x74, 0x6B, 0xE6, 0xF8,
-    0xE4, 0x1F, 0x03, 0xCF, 0xCA, 0x22, 0x60, 0x34, 0x31, 0x5A, 0xDD, 0xAB, 0xF1, 0xAE, 0xB2, 0xA4,
-    0x8E, 0xF6, 0x18, 0xBC, 0x50, 0xBF, 0x46, 0x6B, 0x87, 0x1E, 0x95, 0x6A, 0x4B, 0x81, 0x82, 0xE1,
-    0x15, 0x69, 0xA0, 0xE0, 0x56, 0x46, 0x98, 0x0B, 0xF2, 0xE8, 0x65, 0xCE, 0x4E, 0x53, 0xA2, 0x5E,
-    0xB8, 0xAD, 0x84, 0x6E, 0xC7, 0x29, 0x6C, 0x27, 0x8A, 0x2A, 0xFE, 0xB8, 0x9E, 0xF5, 0x5A, 0xCF,
-    0x49, 0xD4, 0x0D, 0x4E, 0x43, 0x21, 0x96, 0xAC, 0x31, 0x34, 0x29, 0x30, 0x7A, 0xDA, 0xEA, 0x2B,
-    0x9C, 0x96, 0xDD, 0x2E, 0x5E, 0x9B, 0x94, 0xEE, 0x91, 0x86, 0xF9, 0x8C, 0xAB, 0x37, 0xAF, 0x0B,
-    0xE9, 0xF7, 0xDC, 0xF9, 0x6A, 0xE5, 0x7F, 0x70, 0x38, 0x30, 0xA6, 0xE4, 0x15, 0xB8, 0xB0, 0x1A,
-    0x38, 0xDD, 0xB4, 0x62, 0x1C, 0x87, 0x61, 0x3B, 0xF7, 0x57, 0xC1, 0x7C, 0x1A, 0x40, 0xC3, 0xF1,
-    0x14, 0xDE, 0x3F, 0xE6, 0x54, 0x1C, 0xA7, 0x8D, 0x2F, 0x4A, 0x9B, 0x4A, 0xFE, 0x12, 0x99, 0xEC,
-    0x0F, 0xBA, 0x76, 0xE4, 0xFE, 0x95, 0x6E, 0xCB, 0xAF, 0x03, 0xBF, 0x04, 0x06, 0xBE, 0xF4, 0x02,
-    0x8C, 0xEE, 0x85, 0xFA, 0x75, 0x27, 0xA6, 0xC1, 0x32, 0x4B, 0x3B, 0xA4, 0xDD, 0x4E, 0x6D, 0x60,
-    0xBB, 0x14, 0x5F, 0x5C, 0xDD, 0xF2, 0x02, 0x9D, 0xF3, 0x02, 0xDA, 0xE5, 0xDD, 0xC2, 0x90, 0x65,
-    0xEE, 0x70, 0x7E, 0xBC, 0x80, 0xB0, 0xE4, 0x00, 0xDB, 0xC7, 0x5D, 0xD8, 0x63, 0xCB, 0x3B, 0xA5,
-    0x3A, 0x88, 0x7B, 0x03, 0x1F, 0xEA, 0x3A, 0x57, 0x22, 0x92, 0x4A, 0xB7, 0xE1, 0xBB, 0x76, 0x81,
-    0x98, 0x7C, 0x11, 0x9E, 0xD2, 0x36, 0x9F, 0x5A, 0xF7, 0xDE, 0x01, 0x7E, 0x96, 0x4E, 0x8B, 0xE6,
-    0x2A, 0x7D, 0x70, 0xFC, 0x86, 0xE8, 0x4A, 0x29, 0x06, 0xA7, 0xD3, 0xA4, 0xE0, 0xE9, 0xBE, 0xA9,
-    0x60, 0x22, 0x95, 0x3D, 0x7F, 0x7A, 0x42, 0x1B, 0x52, 0xD7, 0xD2, 0x95, 0x8F, 0x3F, 0xB0, 0x3D,
-    0x7D, 0x8A, 0xA7, 0xA1, 0x48, 0x7F, 0x85, 0xA7, 0xB1, 0x4E, 0xA7, 0x5D, 0x0E, 0x7C, 0x5B, 0x89,
-    0xBD, 0xD1, 0x40, 0xA2, 0xAE, 0xF0, 0x74, 0xD2, 0x2E, 0xF0, 0xC7, 0x6F, 0x4C, 0x7C, 0x5E, 0x46,
-    0xA0, 0x37, 0x9F, 0xE6, 0xEE, 0xEF, 0xAD, 0xE7, 0x47, 0x77, 0x07, 0x07, 0x47, 0x4E, 0x5E, 0xD5,
-    0x76, 0xC7, 0xC7, 0xD5, 0x27, 0x3F, 0xF7, 0xF1, 0xDD, 0xAE, 0xFF, 0x1D, 0x23, 0xA4, 0xF1, 0x48,
-    0xD6, 0x7A, 0xF2, 0x3B, 0x21, 0x19, 0xAA, 0x5F, 0x2E, 0x8D, 0x2E, 0x37, 0x07, 0x30, 0x7F, 0x44,
-    0x30, 0xA8, 0x2D, 0xE1, 0x46, 0x29, 0xCD, 0x49, 0x2A, 0x2A, 0x98, 0xCD, 0xCC, 0xED, 0x5B, 0xC8,
-    0x11, 0xBE, 0x5B, 0x3A, 0x5F, 0x72, 0x4A, 0x63, 0x07, 0x15, 0x6E, 0xEF, 0xE0, 0x8A, 0x97, 0xC7,
-    0xC4, 0x0D, 0xA8, 0xF1, 0x65, 0x58, 0xEC, 0x4E, 0x7D, 0x6D, 0x16, 0xD8, 0x22, 0x3E, 0x8A, 0xFA,
-    0x94, 0x79, 0xF3, 0xA4, 0xF0, 0x57, 0x16, 0x25, 0x91, 0xFC, 0x3A, 0xA6, 0xDB, 0xEF, 0xA1, 0x7D,
-    0x0F, 0xA0, 0x73, 0x8B, 0xA2, 0x19, 0x6D, 0x6E, 0xEF, 0xC7, 0x05, 0xFB, 0x74, 0xC1, 0xC1, 0xC1,
-    0x73, 0x8C, 0xEE, 0x35, 0x59, 0x39, 0xB0, 0xEB, 0x82, 0x1D, 0xED, 0x7A, 0x23, 0x24, 0x55, 0x16,
-    0xB8, 0x4D, 0x00, 0x3F, 0xC3, 0xA5, 0x17, 0x2F, 0x13, 0x6F, 0xCE, 0x6E, 0x7B, 0xF9, 0xB9, 0xBA,
-    0x7A, 0xE8, 0x72, 0xD7, 0xBF, 0x86, 0xF9, 0x3D, 0xB8, 0xE4, 0x05, 0xAD, 0x41, 0xF3, 0x24, 0xB8,
-    0x0C, 0x05, 0x50, 0xF6, 0x35, 0x10, 0x4B, 0x1B, 0xED, 0x9F, 0x6B, 0xDB, 0xF5, 0xF7, 0x20, 0x36,
-    0x74, 0xE5, 0xA0, 0x50, 0x60, 0x46, 0x97, 0x41, 0xF5, 0x77, 0xBC, 0x39, 0x45, 0xD9, 0x49, 0xA3,
-    0x27, 0xFF, 0x42, 0x97, 0x9C, 0x1F, 0xD3, 0x08, 0x82, 0x28, 0x26, 0xBF, 0x48, 0xDA, 0x3D, 0x71,
-    0xBD, 0x0B, 0xFE, 0x57, 0xA6, 0x76, 0x05, 0x64, 0x3C, 0xEB, 0x19, 0x71, 0xFD, 0xF7, 0xA1, 0xE6,
-    0x31, 0xDD, 0xEB, 0x5A, 0xD1, 0xC6, 0xCB, 0xED, 0x10, 0xBA, 0x4D, 0xEA, 0x8D, 0x18, 0x28, 0x6F,
-    0xE4, 0x9A, 0xBC, 0xC1, 0xDA, 0x51, 0xD8, 0x28, 0xE9, 0x14, 0x4D, 0xF2, 0xB7, 0xCD, 0x31, 0xD1,
-    0xCD, 0x21, 0x88, 0xC8, 0x83, 0x25, 0x76, 0xC8, 0xDF, 0xD1, 0xC1, 0x27, 0xA3, 0x54, 0x2D, 0xB1,
-    0xB7, 0x94, 0x7D, 0x20, 0x8F, 0xB3, 0x0E, 0x79, 0x40, 0xDF, 0xA9, 0x8D, 0xC5, 0x03, 0x6B, 0x01,
-    0x26, 0x0D, 0xA0, 0x0E, 0xBA, 0xFD, 0x94, 0x14, 0x02, 0xCF, 0x9A, 0xFA, 0xEE, 0x1E, 0x41, 0x22,
-    0xCE, 0x10, 0x27, 0xE4, 0xB4, 0x71, 0xF2, 0x2D, 0x8F, 0xB1, 0xF2, 0x2F, 0x7E, 0xFA, 0xF4, 0x99,
-    0x9F, 0x90, 0xC9, 0x27, 0x3C, 0x0D, 0xC6, 0x47, 0xFD, 0x44, 0x11, 0x80, 0xA3, 0xCE, 0x61, 0xC7,
-    0xCC, 0x10, 0x06, 0xDA, 0x86, 0xD4, 0xCE, 0x50, 0x6E, 0x99, 0xCE, 0x76, 0x30, 0x10, 0xC5, 0x74,
-    0x29, 0xF8, 0x08, 0x17, 0xFC, 0x4F, 0x09, 0xF1, 0xC1, 0xC4, 0xD5, 0x07, 0x60, 0xF6, 0x1F, 0xD0,
-    0x90, 0x21, 0x84, 0x3D, 0x03, 0xA4, 0x1E, 0x76, 0xDE, 0xC5, 0xB7, 0x18, 0x33, 0x81, 0xD6, 0xC7,
-    0x94, 0x0D, 0x79, 0x91, 0x7C, 0x8F, 0x0D, 0xE1, 0xB0, 0xEA, 0xD4, 0x90, 0x36, 0x39, 0x93, 0x9C,
-    0xAB, 0x6E, 0x8A, 0xD6, 0x78, 0x2D, 0x42, 0xFE, 0x73, 0xC3, 0x1A, 0xCA, 0xA4, 0x02, 0xAC, 0x89,
-    0xD7, 0xE1, 0xFB, 0x3D, 0xC3, 0xEC, 0x5B, 0x2E, 0x3B, 0x51, 0xCD, 0x65, 0x4D, 0xF1, 0x7B, 0x06,
-    0x6E, 0xC0, 0x46, 0x74, 0x0C, 0x18, 0x06, 0xFB, 0xAE, 0xD9, 0x00, 0x37, 0x61, 0x0D, 0x08, 0xD2,
-    0xA5, 0xDB, 0x9D, 0xF7, 0x83, 0x1F, 0x41, 0x08, 0xCF, 0x29, 0x0F, 0x83, 0x9E, 0xD6, 0x0C, 0xE3,
-    0x84, 0x70, 0x7B, 0xE0, 0xBC, 0xEC, 0xBA, 0x27, 0xEF, 0x47, 0x96, 0x95, 0x08, 0xC4, 0x09, 0x49,
-    0x65, 0x50, 0x68, 0x66, 0x29, 0xC8, 0x1B, 0xC0, 0xA3, 0xE3, 0xE2, 0xE5, 0x2F, 0x07, 0x5D, 0x4E,
-    0xB9, 0xCA, 0x31, 0xC9, 0xCF, 0xBC, 0x5D, 0xC6, 0x83, 0xD5, 0x8D, 0xA0, 0x60, 0xBC, 0x44, 0xB8,
-    0xD0, 0x25, 0x9A, 0x79, 0x09, 0xBD, 0x8B, 0x8D, 0x68, 0xBB, 0x8C, 0x47, 0x2B, 0x32, 0xE5, 0xAD,
-    0x2E, 0x9D, 0xB7, 0xCB, 0x68, 0xB4, 0xCB, 0xFC, 0x5D, 0x5D, 0x3A, 0x72, 0x7D, 0xA2, 0x7A, 0xD8,
-    0x65, 0x46, 0x4D, 0x3A, 0x42, 0x33, 0xE4, 0x41, 0x62, 0x67, 0x92, 0xBD, 0x64, 0xE3, 0x4B, 0xEA,
-    0xF0, 0xA4, 0xB0, 0x52, 0x64, 0xCE, 0xAB, 0x96, 0x27, 0x4B, 0xE6, 0x82, 0xC2, 0xD2, 0xEC, 0x94,
-    0xCE, 0x45, 0xA6, 0xF9, 0xF1, 0x24, 0x38, 0x96, 0x8C, 0x52, 0x92, 0xAC, 0xAB, 0x55, 0xDB, 0xBB,
-    0xAB, 0xB0, 0xEE, 0x5F, 0xED, 0x05, 0xD7, 0xE4, 0x5E, 0xE3, 0x41, 0x0A, 0x94, 0xFD, 0x51, 0x06,
-    0x50, 0xEB, 0xD6, 0x6A, 0xA6, 0x25, 0x31, 0xD7, 0x93, 0xD9, 0xFC, 0xDC, 0x0B, 0x82, 0xC9, 0x94,
-    0x90, 0xD8, 0x0C, 0x32, 0x0A, 0xE6, 0xD5, 0x18, 0x42, 0x79, 0x27, 0x5C, 0x7B, 0xAF, 0xE4, 0xBD,
-    0x9E, 0x0F, 0x6A, 0xF1, 0x5B, 0x81, 0x40, 0x45, 0x0F, 0xBC, 0x79, 0x8C, 0x59, 0x09, 0x1B, 0x31,
-    0x5F, 0xEE, 0xE5, 0x82, 0x2B, 0x74, 0x56, 0x32, 0x4A, 0x02, 0x1C, 0x83, 0x0C, 0x05, 0xE6, 0xB8,
-    0xB7, 0x2A, 0x1B, 0xE3, 0x7E, 0xC1, 0x12, 0x1C, 0x1B, 0x13, 0xE2, 0x5D, 0x66, 0x5C, 0x04, 0x51,
-    0x79, 0x73, 0x51, 0x9E, 0x6E, 0xA2, 0x84, 0x59, 0x62, 0x3B, 0x2E, 0x96, 0x20, 0xA1, 0x59, 0x1A,
-    0x26, 0xF1, 0xA7, 0x91, 0xE3, 0xAC, 0x71, 0xD7, 0xBF, 0xEE, 0xAC, 0xA2, 0x60, 0xC6, 0x48, 0x3C,
-    0x74, 0xB4, 0xD4, 0x3E, 0x7B, 0x3B, 0x78, 0xC1, 0xD3, 0x7B, 0x17, 0x49, 0xB2, 0x12, 0x05, 0x03,
-    0xED, 0xD9, 0x68, 0xE9, 0x15, 0x92, 0x05, 0x96, 0x3B, 0x42, 0x03, 0x0A, 0xB8, 0x15, 0x58, 0xFC,
-    0x2B, 0x24, 0x9F, 0x64, 0x30, 0x10, 0xE4, 0xAB, 0x85, 0xA7, 0x46, 0x4A, 0xDD, 0x6C, 0x2F, 0x75,
-    0xB7, 0xAE, 0x16, 0xB6, 0x1A, 0x52, 0xF6, 0x62, 0x9E, 0x40, 0xA2, 0x78, 0xEE, 0x16, 0xCE, 0x5A,
-    0x62, 0x32, 0x28, 0x89, 0xE3, 0x2D, 0xAA, 0x2C, 0xD5, 0xB4, 0x9C, 0xFF, 0x5D, 0xB4, 0x1B, 0x54,
-    0x65, 0xA5, 0xC7, 0xAA, 0x71, 0xF9, 0xA2, 0x21, 0xF5, 0xDA, 0x9D, 0xC3, 0xCA, 0x78, 0xDD, 0x80,
-    0x75, 0xBC, 0x24, 0x52, 0xB1, 0x37, 0x2C, 0x1D, 0x1B, 0x03, 0x5C, 0x70, 0xC5, 0x84, 0xB2, 0x20,
-    0x56, 0x09, 0xAD, 0x37, 0x72, 0xC8, 0x02, 0xA5, 0x2D, 0x89, 0xE1, 0x12, 0x95, 0xC9, 0x9C, 0x44,
-    0xA4, 0x8B, 0xDA, 0x2E, 0xEC, 0xCE, 0x6C, 0xAE, 0x57, 0x6E, 0x9D, 0x4A, 0x91, 0x7C, 0x50, 0xAB,
-    0x46, 0xE3, 0xAD, 0xE6, 0x62, 0x6C, 0x0A, 0xCD, 0xA1, 0x2E, 0xA5, 0x25, 0xAA, 0x15, 0x04, 0x6B,
-    0x95, 0x1F, 0xBA, 0x44, 0x82, 0xDF, 0x65, 0x50, 0x75, 0x0D, 0xAB, 0xA7, 0x57, 0x2D, 0x87, 0x50,
-    0x85, 0xAB, 0x9E, 0xB1, 0x28, 0x34, 0xF2, 0x77, 0x8F, 0xA4, 0x50, 0x2B, 0xAF, 0x9A, 0x99, 0x5F,
-    0xE7, 0xFD, 0xDF, 0x4E, 0x20, 0x2B, 0x59, 0x63, 0xA0, 0x89, 0xBE, 0xE3, 0xA7, 0x20, 0xE8, 0x06,
-    0x12, 0xD1, 0x1D, 0x31, 0x4D, 0x89, 0x66, 0xAE, 0x9A, 0xDD, 0x4C, 0x01, 0xB3, 0x60, 0xE6, 0x65,
-    0x75, 0x4A, 0x18, 0xF9, 0xC4, 0xBC, 0x43, 0xF5, 0x67, 0xED, 0x0E, 0x89, 0x5C, 0xF2, 0x47, 0xE5,
-    0xF3, 0x95, 0xCB, 0xEE, 0xD2, 0x90, 0xF3, 0xCD, 0x37, 0xFC, 0x25, 0x0E, 0x13, 0x33, 0xD6, 0x72,
-    0x60, 0x41, 0x3F, 0xC1, 0x2C, 0xC3, 0x59, 0xD8, 0x1F, 0x9F, 0x3C, 0x38, 0x9E, 0xAE, 0x32, 0xF9,
-    0x9D, 0xDE, 0xE2, 0x7E, 0x7C, 0x99, 0xFB, 0x1B, 0xDA, 0xBF, 0xF9, 0x14, 0xF7, 0x5F, 0xB2, 0xD4,
-    0xF8, 0xFF, 0x67, 0x5F, 0x3E, 0x38, 0x12, 0xDA, 0xEA, 0x64, 0x71, 0xDD, 0x16, 0xD1, 0x80, 0xF5,
-    0x55, 0xA0, 0x44, 0xBA, 0x82, 0x6C, 0x5B, 0xE6, 0xD8, 0x41, 0x6D, 0xA0, 0x8E, 0xBE, 0xC9, 0x32,
-    0x21, 0x29, 0xF3, 0x64, 0x46, 0x92, 0x17, 0x7F, 0x99, 0x9B, 0x51, 0x2F, 0x3D, 0x41, 0xC2, 0x24,
-    0x30, 0x57, 0x5A, 0xA1, 0x90, 0x05, 0x75, 0xA2, 0xF7, 0x56, 0x91, 0x3B, 0xB1, 0x94, 0x9C, 0x99,
-    0x42, 0xE2, 0xEF, 0xD7, 0xA3, 0xA9, 0xF5, 0x60, 0xDE, 0x4D, 0x6A, 0xBD, 0xC3, 0x82, 0x09, 0xE3,
-    0xE7, 0xCE, 0xC1, 0x15, 0xB8, 0x3A, 0xC8, 0x70, 0x22, 0xCE, 0x49, 0xFD, 0xB0, 0xAB, 0xE2, 0x46,
-    0x65, 0x55, 0x40, 0xAB, 0x7E, 0xCD, 0xCA, 0x94, 0x83, 0xB3, 0x1A, 0x7C, 0x66, 0xB5, 0x74, 0x8C,
-    0xC8, 0xBA, 0xB0, 0xEA, 0x3A, 0x02, 0x19, 0xAA, 0x31, 0x8F, 0x2A, 0x1A, 0x2B, 0xB3, 0x55, 0xC5,
-    0x8E, 0x05, 0x68, 0x02, 0x06, 0x19, 0x91, 0x2A, 0x4F, 0x70, 0x40, 0x06, 0x0B, 0xBE, 0xA7, 0x43,
-    0x76, 0x5B, 0x24, 0xA5, 0x77, 0xC5, 0xEF, 0xE4, 0xDD, 0xD6, 0xEC, 0x68, 0xC9, 0x49, 0x1B, 0x3B,
-    0x54, 0x66, 0x7C, 0xEE, 0x1C, 0x7E, 0xDD, 0xE6, 0x0A, 0xBA, 0x73, 0x70, 0x70, 0x89, 0x53, 0xDB,
-    0x61, 0x49, 0x69, 0xCA, 0xA9, 0x88, 0xCA, 0x83, 0x2A, 0x02, 0x09, 0xE2, 0x60, 0x18, 0x15, 0x9C,
-    0xF4, 0xC2, 0x1C, 0xFA, 0x1C, 0x7A, 0x87, 0x59, 0x49, 0x49, 0x44, 0xC8, 0xBA, 0x56, 0x32, 0x8A,
-    0xE8, 0xCC, 0x14, 0x14, 0x13, 0x63, 0xE8, 0xE2, 0x04, 0x80, 0x95, 0x1E, 0x8C, 0x9A, 0x6D, 0x82,
-    0xCC, 0xF6, 0x9F, 0xB8, 0xC0, 0xC2, 0xEC, 0x99, 0x81, 0x99, 0x93, 0xE6, 0x34, 0x61, 0xA9, 0x56,
-    0x30, 0x8C, 0xD7, 0x65, 0xC1, 0xB9, 0x63, 0xD2, 0x63, 0x38, 0xA8, 0xD0, 0x9E, 0xB4, 0x49, 0x93,
-    0x35, 0xC6, 0x82, 0x60, 0x00, 0x76, 0xEE, 0x54, 0x79, 0xCB, 0x71, 0x43, 0x0C, 0xC9, 0x2F, 0xC1,
-    0x36, 0x63, 0x25, 0x82, 0xC3, 0x55, 0x70, 0xD3, 0x18, 0xF2, 0x36, 0xC6, 0x7E, 0xB5, 0x51, 0xC1,
-    0x93, 0x62, 0x1E, 0x0C, 0x4A, 0x55, 0x44, 0x6E, 0x6E, 0xA9, 0xC6, 0x98, 0x9B, 0x89, 0xE8, 0x45,
-    0xE6, 0x53, 0x3F, 0x55, 0xAE, 0xB7, 0x20, 0xDF, 0x3C, 0xE4, 0x59, 0x05, 0x4A, 0x92, 0xDE, 0x87,
-    0x02, 0x57, 0xB9, 0xEF, 0x53, 0xB0, 0x27, 0x83, 0xE5, 0x23, 0xF1, 0xE3, 0xB3, 0xE0, 0x84, 0x8A,
-    0x31, 0x96, 0x0D, 0x46, 0xAA, 0xC6, 0xD2, 0x35, 0xAA, 0xC6, 0xE7, 0x2B, 0xCB, 0xF8, 0xEF, 0x8A,
-    0x88, 0xEC, 0x23, 0x93, 0xD1, 0x56, 0x2A, 0x4A, 0xD9, 0x56, 0x76, 0x88, 0xAC, 0x31, 0x31, 0xCA,
-    0x32, 0x85, 0x3A, 0x57, 0xCA, 0xBD, 0xBB, 0x69, 0xB5, 0x94, 0x0F, 0x55, 0xEF, 0xEE, 0x44, 0x28,
-    0x17, 0x89, 0x3A, 0x5B, 0xB4, 0x19, 0x25, 0x52, 0x16, 0xF6, 0xFC, 0x3E, 0xFA, 0x79, 0x8D, 0x69,
-    0x42, 0xED, 0xA7, 0x5A, 0x4E, 0x68, 0x34, 0x8C, 0xFA, 0x75, 0x56, 0x76, 0x85, 0xBF, 0x71, 0xAB,
-    0x39, 0x34, 0x44, 0x8B, 0xEE, 0x22, 0x13, 0xE7, 0x2C, 0x0E, 0xA4, 0xF2, 0x93, 0x94, 0x16, 0xC0,
-    0x43, 0x2D, 0xA1, 0x50, 0x27, 0x83, 0xD9, 0x84, 0xD1, 0xE5, 0xE2, 0xD4, 0xDB, 0x4A, 0xA6, 0xA7,
-    0x05, 0xA1, 0x8A, 0xF8, 0xD2, 0xB2, 0xA0, 0xE9, 0x5C, 0x62, 0xB4, 0xB0, 0xF0, 0xD3, 0x2E, 0x2E,
-    0xFA, 0xEB, 0xA7, 0xC1, 0x38, 0x94, 0x5B, 0xDE, 0xA1, 0x0B, 0x53, 0x1C, 0xFE, 0x9A, 0x72, 0x92,
-    0xFA, 0xFE, 0xF1, 0x49, 0x9F, 0x55, 0x0C, 0xEE, 0x88, 0x90, 0x23, 0x54, 0x00, 0xE3, 0xBC, 0x69,
-    0x05, 0x9D, 0xE0, 0x5C, 0xB2, 0x57, 0x2C, 0x75, 0x68, 0x21, 0x0C, 0xA1, 0x6D, 0x83, 0x27, 0xF2,
-    0x43, 0x5A, 0x2D, 0x50, 0x08, 0x8B, 0xC7, 0x85, 0x84, 0xA7, 0xD9, 0x43, 0xFA, 0x35, 0x62, 0x2B,
-    0x22, 0x29, 0xA8, 0x24, 0x8B, 0xED, 0x04, 0x2E, 0x5E, 0x65, 0xAF, 0x4B, 0xDE, 0x2F, 0x41, 0xC9,
-    0xE5, 0x33, 0xFE, 0x0E, 0x72, 0xF7, 0x05, 0xFE, 0xAE, 0xB0, 0x0F, 0xAE, 0x78, 0x24, 0xCD, 0xB2,
-    0x14, 0x54, 0x2E, 0x95, 0xF5, 0x60, 0x58, 0xD6, 0x83, 0xE2, 0x76, 0x29, 0x0A, 0x73, 0x41, 0x2B,
-    0xEA, 0x96, 0xE2, 0xBB, 0xBC, 0x41, 0xB7, 0x2C, 0x1B, 0xF1, 0x65, 0xC9, 0xE2, 0xF4, 0xE5, 0xC5,
-    0xC3, 0x9D, 0x7B, 0xB9, 0x5A, 0x9E, 0x3F, 0x7D, 0xB9, 0x5F, 0x96, 0xB2, 0x9E, 0xAC, 0x40, 0x83,
-    0xDF, 0xAB, 0xF1, 0xF2, 0xE7, 0xFE, 0xDB, 0xAB, 0x73, 0x9F, 0x2F, 0xFE, 0x83, 0xF6, 0x6D, 0x25,
-    0x7E, 0x95, 0xAA, 0x40, 0xD9, 0x07, 0x54, 0x2B, 0x8C, 0x19, 0xB5, 0x5C, 0x14, 0xD4, 0x02, 0x67,
-    0xEE, 0x56, 0x7D, 0x68, 0x75, 0x3B, 0x5C, 0x8F, 0x04, 0xA0, 0x2D, 0x97, 0x3D, 0x57, 0x3D, 0x08,
-    0xC3, 0xAC, 0xD3, 0x3B, 0xED, 0x52, 0x09, 0x57, 0x29, 0x43, 0xBF, 0xFB, 0xC7, 0xF8, 0xB1, 0x7C,
-    0x1A, 0xF6, 0xC2, 0x21, 0x10, 0x54, 0xD6, 0xB2, 0x44, 0x78, 0x6A, 0x90, 0x5C, 0x80, 0x75, 0x74,
-    0x58, 0xD1, 0x7C, 0xC2, 0xF2, 0x15, 0xEC, 0x30, 0xE5, 0x72, 0x2D, 0xF8, 0x03, 0xA0, 0xFA, 0x48,
-    0x71, 0x60, 0xB7, 0xF6, 0xC4, 0x23, 0x40, 0xA0, 0xC8, 0xB2, 0x19, 0xD1, 0x85, 0xEA, 0x3C, 0xE9,
-    0xDF, 0x9E, 0xAD, 0x81, 0x27, 0xB2, 0xCD, 0xA1, 0xBF, 0x8F, 0xB8, 0x94, 0xCF, 0xA1, 0x67, 0xAA,
-    0xFE, 0xCD, 0x22, 0xB0, 0xD5, 0x09, 0xC2, 0xAC, 0x6D, 0x5D, 0x2F, 0x36, 0x8D, 0xA8, 0x65, 0xB8,
-    0x22, 0x3B, 0x36, 0x7B, 0xFD, 0x78, 0x33, 0x20, 0xB3, 0xCB, 0xEE, 0x10, 0x06, 0xD7, 0x1C, 0x7C,
-    0xE5, 0xDF, 0x87, 0xFF, 0x89, 0x27, 0x6E, 0xF0, 0xA8, 0x89, 0x0C, 0x2C, 0xED, 0xB4, 0xF0, 0xDA,
-    0x18, 0x5A, 0xC9, 0x14, 0x1E, 0x6A, 0x5A, 0xDA, 0x23, 0xCD, 0xD1, 0x60, 0xCB, 0xB0, 0x2B, 0x99,
-    0x6A, 0xCC, 0xE2, 0x9D, 0x63, 0xF4, 0x2F, 0x0C, 0x6F, 0x05, 0x06, 0xBA, 0x77, 0x5E, 0x3F, 0xAD,
-    0x01, 0xD1, 0x13, 0xDB, 0xAA, 0xD3, 0xC8, 0x8A, 0xD2, 0x35, 0x30, 0xE9, 0x57, 0x88, 0x87, 0x3D,
-    0x7A, 0x79, 0x8D, 0x72, 0xD3, 0xA2, 0x64, 0xBF, 0x2C, 0x09, 0x31, 0xFF, 0x4C, 0xDB, 0xC5, 0x30,
-    0xB5, 0x9E, 0xD5, 0x5B, 0xCC, 0xD8, 0xAF, 0xFD, 0xC9, 0xA8, 0x85, 0xA1, 0x43, 0x5A, 0xE6, 0x0B,
-    0xFB, 0xA7, 0x60, 0xDF, 0x70, 0x5C, 0x6E, 0x46, 0x27, 0xB3, 0xB7, 0xC5, 0x24, 0xAD, 0x2B, 0x99,
-    0xEB, 0x0B, 0x1E, 0x69, 0x3E, 0x54, 0x46, 0x40, 0x13, 0x0F, 0x44, 0x34, 0x38, 0x70, 0xB8, 0xE6,
-    0x70, 0x65, 0x81, 0xE9, 0xD9, 0x2A, 0x56, 0xA4, 0x82, 0x57, 0xBA, 0xE6, 0x4A, 0x09, 0x82, 0x41,
-    0xCB, 0x66, 0x50, 0x17, 0xF5, 0xCC, 0x8A, 0xD2, 0x75, 0xA4, 0x66, 0x26, 0x8E, 0x93, 0x22, 0x4F,
-    0x4F, 0x83, 0xCF, 0x90, 0xDA, 0x54, 0xF0, 0xA5, 0x5C, 0xCB, 0xF4, 0xD7, 0x31, 0xE3, 0x0F, 0x7D,
-    0x0F, 0x28, 0x45, 0x49, 0x7D, 0xB3, 0xD8, 0xD9, 0x72, 0xA4, 0xDE, 0x10, 0x44, 0x0E, 0x2E, 0x7B,
-    0x50, 0xB7, 0x1C, 0xA5, 0x00, 0x66, 0x1B, 0xA8, 0x88, 0xB7, 0x19, 0xB3, 0xC0, 0x92, 0xF4, 0xCE,
-    0x36, 0x09, 0xBD, 0xF3, 0xE0, 0xF8, 0xF8, 0x27, 0x9C, 0x82, 0x68, 0xCF, 0xB7, 0x4B, 0x3C, 0xF4,
-    0xB6, 0x9C, 0xF6, 0x53, 0x50, 0xA3, 0xBA, 0xCA, 0x38, 0x05, 0xC6, 0x7C, 0xF7, 0x37, 0x74, 0x60,
-    0x5C, 0xCD, 0x0A, 0x96, 0xE2, 0x0D, 0xFC, 0xE5, 0x73, 0xE0, 0x77, 0xBB, 0x6A, 0x61, 0x31, 0x81,
-    0xAD, 0xFA, 0x24, 0xDB, 0x55, 0x1F, 0x71, 0x25, 0xDE, 0x1C, 0x14, 0x44, 0xF5, 0x2C, 0x40, 0x8D,
-    0xEE, 0xF9, 0xF9, 0xA0, 0xB0, 0xB1, 0xC4, 0xBD, 0xD3, 0xA7, 0x3E, 0x43, 0x53, 0xB9, 0xB1, 0x65,
-    0x1B, 0x77, 0xBE, 0xAA, 0x9A, 0xCD, 0x2F, 0x4E, 0xB6, 0xB8, 0x15, 0xCF, 0x27, 0xF3, 0x84, 0xA7,
-    0xD3, 0x96, 0x29, 0x40, 0x4D, 0x97, 0xC0, 0xA5, 0x43, 0x7E, 0x54, 0x10, 0xD2, 0x0E, 0x39, 0xC9,
-    0x92, 0xC1, 0x8C, 0x58, 0x64, 0xF3, 0xE2, 0x24, 0xBC, 0x2D, 0x61, 0x55, 0x70, 0x4F, 0x7B, 0x8B,
-    0x8B, 0x31, 0x4F, 0x62, 0x9E, 0x95, 0xC6, 0x7A, 0x4F, 0x29, 0x53, 0x17, 0x28, 0x6F, 0x07, 0x3D,
-    0x17, 0xB9, 0x52, 0x09, 0x86, 0xB2, 0x12, 0x31, 0x90, 0x6D, 0xF9, 0x25, 0x82, 0x81, 0x16, 0xDA,
-    0xC4, 0xD5, 0x6C, 0x2F, 0x98, 0xCC, 0x3A, 0xE5, 0x8A, 0xC2, 0x30, 0xD3, 0x5A, 0xC9, 0x9E, 0x96,
-    0x9A, 0x79, 0x3D, 0xFE, 0x1F, 0xE5, 0xB5, 0x8F, 0xDD, 0xA0, 0x7D, 0x85, 0x10, 0x18, 0xA3, 0x39,
-    0x0D, 0x0C, 0xCC, 0x7C, 0x16, 0x38, 0x9D, 0x39, 0xF9, 0xA8, 0x37, 0xFC, 0xF6, 0x93, 0x88, 0x5C,
-    0xDF, 0x32, 0x58, 0x5D, 0x7A, 0xF9, 0xBC, 0x41, 0x95, 0xEA, 0x3F, 0xEF, 0x46, 0x34, 0x17, 0x81,
-    0xBF, 0x9E, 0x79, 0xC2, 0xFD, 0xCB, 0x5C, 0x75, 0xDC, 0xBA, 0x80, 0x80, 0x10, 0xB6, 0x09, 0xB8,
-    0x6C, 0xF9, 0x10, 0x5A, 0x08, 0xBE, 0x53, 0x64, 0x5C, 0xE8, 0x54, 0x55, 0xAA, 0xFC, 0xB3, 0xB6,
-    0xC0, 0xDF, 0x63, 0xE1, 0xD0, 0x84, 0x07, 0x2D, 0x47, 0x48, 0xB7, 0x2D, 0xEA, 0x1F, 0x5E, 0x7E,
-    0x78, 0x33, 0xF0, 0xE3, 0x0A, 0x3A, 0x73, 0x51, 0x04, 0xFF, 0xB9, 0xDB, 0x70, 0xB6, 0x45, 0x02,
-    0xC7, 0x08, 0x8C, 0xBE, 0x41, 0x16, 0x99, 0x03, 0x6D, 0x1E, 0x3D, 0xD6, 0xCB, 0xF9, 0x33, 0xDE,
-    0x9B, 0x1C, 0xF2, 0x8F, 0x37, 0x13, 0x1A, 0xE5, 0x0D, 0xD7, 0xC4, 0x3D, 0x2C, 0x7C, 0x8D, 0xE6,
-    0xAC, 0x5D, 0xD2, 0xA7, 0x5C, 0x09, 0xA6, 0x32, 0xF3, 0x90, 0x0B, 0x87, 0x2E, 0xF9, 0x48, 0x06,
-    0xA5, 0x75, 0x12, 0xAF, 0x95, 0xE2, 0x91, 0xFB, 0xA4, 0x63, 0xC4, 0xCE, 0x9B, 0x5A, 0xE8, 0xA3,
-    0x96, 0x13, 0x64, 0x9D, 0xAA, 0xE3, 0xBE, 0xFC, 0x4F, 0xC7, 0x05, 0x74, 0x20, 0x99, 0x4E, 0xA5,
-    0x5F, 0xA1, 0xDB, 0x97, 0x48, 0x32, 0xC9, 0x87, 0x73, 0xF4, 0x12, 0xDB, 0x17, 0xDE, 0x24, 0x62,
-    0x7E, 0x1C, 0x72, 0x8E, 0xD9, 0xED, 0xC5, 0xD9, 0x56, 0x0A, 0x7D, 0xE2, 0x27, 0x20, 0x12, 0x70,
-    0xE7, 0x43, 0x7D, 0xBD, 0x30, 0xBA, 0x0B, 0x9E, 0x25, 0xEE, 0x67, 0xAD, 0x14, 0x82, 0x34, 0x8E,
-    0x58, 0x02, 0x53, 0xC4, 0x74, 0xE0, 0xB4, 0xEC, 0x93, 0x1C, 0x2B, 0x15, 0x50, 0x9B, 0xEC, 0x2B,
-    0x9D, 0xD5, 0x5F, 0xBC, 0x89, 0xDE, 0xA8, 0x84, 0x15, 0x6E, 0xF8, 0xCD, 0x56, 0xEE, 0xBB, 0xC4,
-    0x8F, 0x19, 0xFC, 0xBD, 0x9F, 0x83, 0x2D, 0x70, 0x01, 0xBE, 0xAA, 0x0E, 0xE9, 0x70, 0xDF, 0x13,
-    0xF3, 0x26, 0x7A, 0xDF, 0x0B, 0x7E, 0x26, 0xDD, 0xA9, 0xF0, 0x2A, 0x74, 0x0D, 0x66, 0x4F, 0x47,
-    0x62, 0xAA, 0x08, 0x0B, 0x4E, 0xE5, 0x58, 0xB1, 0x05, 0x9F, 0xED, 0x06, 0x52, 0x85, 0x95, 0x3F,
-    0x2A, 0x7D, 0x17, 0xFB, 0x59, 0x64, 0xF8, 0x65, 0xE9, 0x2D, 0xA8, 0x55, 0xC1, 0xD3, 0xB2, 0x2B,
-    0x1A, 0xA1, 0x1A, 0x25, 0x8B, 0x29, 0xA1, 0x67, 0x27, 0x39, 0xBF, 0x62, 0x8B, 0xE9, 0x2E, 0x02,
-    0x4F, 0x27, 0x99, 0xDF, 0x21, 0x96, 0x7E, 0x6F, 0xDE, 0xEA, 0x8C, 0x27, 0x7C, 0x93, 0x4F, 0x49,
-    0x5A, 0x98, 0x13, 0xC2, 0x2A, 0xF0, 0x1F, 0x4C, 0x91, 0x1C, 0x2E, 0x37, 0x17, 0x89, 0x79, 0xFD,
-    0x64, 0xAE, 0xDD, 0xB9, 0x6F, 0x1F, 0x6D, 0x65, 0x77, 0xA1, 0x39, 0xDC, 0x40, 0xA3, 0xA1, 0x38,
-    0xB1, 0xFF, 0x25, 0x9C, 0xD4, 0x45, 0xBF, 0xB9, 0xE8, 0x0B, 0xB3, 0x29, 0xBF, 0xAC, 0xB5, 0x84,
-    0x93, 0x7D, 0x06, 0x95, 0x74, 0x4B, 0x61, 0x47, 0xA7, 0xEE, 0xEC, 0x34, 0x98, 0x4E, 0x57, 0xB4,
-    0xC2, 0xC1, 0x4A, 0x0B, 0x8B, 0xED, 0xDC, 0x3F, 0xD1, 0x37, 0x20, 0xAA, 0x9B, 0x33, 0x27, 0x6A,
-    0xBF, 0xB4, 0x7C, 0x15, 0xB0, 0x2C, 0x84, 0x3E, 0x5A, 0x01, 0xAD, 0x19, 0x2E, 0xA5, 0x5C, 0xBB,
-    0x5C, 0xBB, 0xD8, 0xFE, 0x0E, 0x59, 0x2A, 0xCF, 0xC9, 0x19, 0x7A, 0x52, 0x2A, 0x11, 0xD1, 0x49,
-    0x61, 0xA1, 0x2F, 0xEA, 0x29, 0x65, 0x15, 0x9B, 0xA2, 0xDE, 0x02, 0xA2, 0x42, 0x61, 0xF4, 0xE8,
-    0xA9, 0x3D, 0xC0, 0xB5, 0xFD, 0x02, 0xCC, 0x61, 0x0F, 0x30, 0x6D, 0xC5, 0x97, 0x9E, 0x45, 0x47,
-    0x8A, 0x69, 0x7E, 0x0E, 0x96, 0xF7, 0x84, 0xC5, 0x65, 0x73, 0x29, 0x9F, 0x78, 0x7A, 0x91, 0x5C,
-    0x8C, 0x85, 0xC5, 0xBF, 0x7D, 0xFC, 0x93, 0x45, 0x7F, 0xB2, 0x9F, 0xF9, 0xAE, 0x1E, 0xF9, 0xE5,
-    0xCC, 0x05, 0x5F, 0x22, 0x23, 0x9C, 0x5D, 0x15, 0x2D, 0x75, 0x4A, 0xBD, 0x9A, 0x3E, 0x04, 0x25,
-    0x1E, 0xD7, 0x90, 0xCE, 0x47, 0xCE, 0x32, 0xE5, 0x45, 0x35, 0x03, 0xBF, 0xC1, 0xC5, 0x1C, 0x6E,
-    0x0E, 0xC7, 0xAC, 0x88, 0x01, 0x18, 0x93, 0x6B, 0x9D, 0xFB, 0x47, 0xA9, 0x00, 0x8B, 0x74, 0xCC,
-    0x26, 0x55, 0x1B, 0x58, 0xEB, 0x63, 0xCB, 0x5D, 0x7F, 0x0B, 0x58, 0xE7, 0x2B, 0xE8, 0xF3, 0x86,
-    0x4A, 0xBC, 0xD9, 0xDB, 0xC3, 0x6A, 0x82, 0xCB, 0x84, 0x6B, 0x98, 0x80, 0x7B, 0xD0, 0xDF, 0xDF,
-    0x19, 0x32, 0x56, 0x07, 0x96, 0x74, 0x47, 0x1B, 0x2E, 0x9C, 0x78, 0xC6, 0xD8, 0xE7, 0xFD, 0xC1,
-    0x7E, 0xF8, 0xF0, 0xDD, 0x4F, 0xB9, 0xA4, 0xC2, 0xCD, 0x6F, 0x34, 0x18, 0x42, 0x1F, 0x66, 0xEC,
-    0x5E, 0x77, 0xC1, 0x7F, 0xD0, 0xB3, 0xA7, 0xFC, 0x7E, 0xB0, 0x8D, 0x55, 0xF8, 0x71, 0x2F, 0x0E,
-    0x6E, 0xF7, 0x8B, 0x58, 0x4F, 0xB5, 0x7C, 0xC6, 0x67, 0x0E, 0x83, 0x22, 0xF4, 0x05, 0xD3, 0xE9,
-    0x6C, 0x3E, 0xF4, 0x1B, 0xAE, 0xED, 0xFD, 0x51, 0x22, 0x5C, 0x33, 0x30, 0xBE, 0xC4, 0xE4, 0x7C,
-    0xEF, 0x60, 0x1F, 0x0E, 0x57, 0xD6, 0xFE, 0xDF, 0x98, 0xF8, 0xE1, 0x1C, 0xA8, 0x94, 0xBE, 0xD2,
-    0x67, 0x79, 0xD1, 0xB0, 0x2C, 0xD5, 0xA6, 0xFA, 0x3C, 0xF0, 0xA6, 0x96, 0x1B, 0xF8, 0x29, 0x81,
-    0xD2, 0x80, 0xD9, 0x29, 0xAF, 0x65, 0x5E, 0x11, 0x75, 0xCC, 0x30, 0x92, 0x56, 0xA8, 0x86, 0xF8,
-    0xDB, 0xE5, 0xE5, 0x02, 0x1A, 0xB7, 0xC8, 0x2E, 0xF4, 0x67, 0xE0, 0xCD, 0xEA, 0x04, 0xFB, 0xC0,
-    0x7D, 0x7B, 0x64, 0xA8, 0x4B, 0xC0, 0x01, 0x58, 0xD6, 0x9A, 0x4B, 0xF2, 0x08, 0xFC, 0xF6, 0x39,
-    0x22, 0x17, 0x36, 0xA0, 0xBF, 0x10, 0x01, 0x54, 0x17, 0xE9, 0xA0, 0xAA, 0x2E, 0x70, 0xD1, 0x91,
-    0x4A, 0x71, 0x5E, 0xB5, 0x68, 0xA8, 0xF5, 0x49, 0xC3, 0xEF, 0x3F, 0xC7, 0xD5, 0x7B, 0x23, 0x33,
-    0x17, 0xA4, 0xF6, 0x49, 0x4B, 0x5A, 0xA6, 0x68, 0x5D, 0x87, 0x2A, 0xC0, 0xDC, 0x88, 0x3A, 0x7E,
-    0x01, 0x5B, 0x27, 0x55, 0xFE, 0x7D, 0x46, 0x88, 0xF7, 0x61, 0x05, 0xCA, 0x71, 0x4E, 0x5C, 0xF2,
-    0xCB, 0x4A, 0xDF, 0x70, 0xAA, 0x3C, 0xCE, 0x38, 0x1F, 0x99, 0x6D, 0x35, 0x56, 0x64, 0x8C, 0x86,
-    0x05, 0x7A, 0x9F, 0x91, 0x8C, 0x9C, 0x9D, 0x5F, 0xB3, 0xFA, 0x5B, 0xE0, 0x15, 0x78, 0x88, 0x27,
-    0x4B, 0xAB, 0x3E, 0xD0, 0x56, 0x08, 0x69, 0x6A, 0x7D, 0xB1, 0xE7, 0x53, 0x9A, 0xA4, 0x15, 0x22,
-    0xA5, 0x9D, 0xCB, 0x4A, 0xB1, 0x0C, 0x7A, 0x56, 0xA5, 0x90, 0x5F, 0xD3, 0xE8, 0x7B, 0x03, 0x90,
-    0xA8, 0x8F, 0xE8, 0x98, 0x21, 0xB3, 0x64, 0xB3, 0x09, 0x3D, 0xB2, 0x73, 0x9F, 0xB2, 0x2C, 0x30,
-    0x7E, 0x76, 0xF1, 0x74, 0x0F, 0x89, 0x67, 0xF5, 0x31, 0xF1, 0xA4, 0x8F, 0x8A, 0xC7, 0x2D, 0x80,
-    0xE9, 0x4C, 0x3C, 0x96, 0x7A, 0x4C, 0x67, 0x1E, 0x47, 0x2B, 0x48, 0x5C, 0x0F, 0x0A, 0x5E, 0xB4,
-    0x22, 0xA3, 0x32, 0x41, 0xBD, 0x97, 0xDD, 0xDB, 0x2E, 0x10, 0xC7, 0xCB, 0xBA, 0x4B, 0x3F, 0x15,
-    0xF1, 0xF0, 0x0C, 0xF2, 0xB8, 0xA4, 0x08, 0xC7, 0xB0, 0xA1, 0x0E, 0xAE, 0xB6, 0xD6, 0xED, 0xB7,
-    0xFF, 0x56, 0xD2, 0x62, 0x62, 0xCD, 0x4F, 0x8B, 0x5E, 0x26, 0xA4, 0x42, 0x0A, 0x93, 0xFE, 0xFE,
-    0xC1, 0x71, 0xFD, 0x2E, 0xFA, 0x78, 0x5F, 0xCB, 0xE6, 0xA7, 0xB9, 0x19, 0x1C, 0xF3, 0x18, 0xF8,
-    0xFD, 0x50, 0x75, 0x9F, 0xB3, 0x6D, 0xA0, 0x8E, 0x43, 0x42, 0x14, 0xFC, 0xB4, 0x6C, 0xFC, 0x10,
-    0x64, 0x60, 0xD4, 0xC4, 0x96, 0x58, 0xD4, 0xDC, 0xDE, 0x0A, 0xF4, 0xF0, 0x82, 0x5B, 0xCE, 0xF7,
-    0x33, 0xEA, 0x6B, 0x3C, 0xC4, 0x14, 0xD6, 0xA6, 0xF6, 0xAF, 0x7E, 0xDA, 0xEF, 0x1F, 0x94, 0xCA,
-    0x24, 0xBE, 0xD9, 0xA3, 0xF8, 0x0B, 0x30, 0x1A, 0xDD, 0x42, 0x25, 0x61, 0xE8, 0x33, 0xFB, 0x4B,
-    0x09, 0x88, 0x49, 0x47, 0x6B, 0x9F, 0xD1, 0x71, 0xB6, 0xBE, 0x02, 0x0F, 0xF2, 0x36, 0x98, 0x96,
-    0x07, 0xF5, 0x40, 0xA4, 0x2F, 0x23, 0xF4, 0xDA, 0xB6, 0x07, 0x42, 0x6A, 0x44, 0x5D, 0xAE, 0x0A,
-    0x22, 0x29, 0x5A, 0x6D, 0xDC, 0xAA, 0x00, 0x23, 0x5E, 0xC9, 0xFD, 0x90, 0xFC, 0x57, 0x5F, 0xFB,
-    0xF1, 0x06, 0x7C, 0x58, 0x58, 0x89, 0x77, 0xF8, 0xFD, 0x09, 0xDD, 0x5B, 0x3D, 0xAC, 0xDD, 0xD6,
-    0x7D, 0x3F, 0x24, 0xFD, 0x1E, 0x13, 0x11, 0x2D, 0x3D, 0xD8, 0xA9, 0x6B, 0xB5, 0x66, 0x87, 0x0E,
-    0x71, 0x9B, 0x88, 0x6B, 0x07, 0x49, 0xA4, 0x63, 0xA0, 0x1D, 0x32, 0x44, 0x83, 0x6E, 0x8A, 0xDA,
-    0x83, 0x33, 0x64, 0xC8, 0x07, 0xD0, 0x97, 0xA1, 0x83, 0x07, 0xD9, 0xBC, 0x89, 0x87, 0x0C, 0x19,
-    0xFC, 0x0A, 0x38, 0x01, 0x8A, 0x0C, 0xCD, 0xE0, 0x02, 0xCD, 0x13, 0x12, 0x79, 0xF0, 0xE0, 0x02,
-    0xD2, 0x23, 0x2D, 0xA1, 0xD0, 0xE0, 0xC1, 0x74, 0xDC, 0x22, 0x43, 0x06, 0xD3, 0xB5, 0x9C, 0x14,
-    0xF6, 0x60, 0xB6, 0x61, 0x60, 0x3E, 0x89, 0xE4, 0xE9, 0xEF, 0xF7, 0x3B, 0xBC, 0xF7, 0x5D, 0x49,
-    0x4F, 0x6D, 0x6A, 0xC7, 0x71, 0xEC, 0x8B, 0xF7, 0x78, 0xF9, 0x71, 0x78, 0xCE, 0xFF, 0xFB, 0xF3,
-    0x5C, 0x13, 0xF4, 0xE5, 0xCB, 0x43, 0x79, 0xB9, 0x31, 0xFC, 0x3C, 0x9F, 0x3C, 0xD4, 0x27, 0xDF,
-    0x1C, 0x92, 0x17, 0x0F, 0xFF, 0xD2, 0xCB, 0x63, 0xFA, 0xEA, 0x98, 0xBD, 0x3A, 0x64, 0x57, 0xDD,
-    0x18, 0xE3, 0xB5, 0x38, 0xA4, 0xF8, 0xF7, 0xD7, 0x27, 0x7C, 0x72, 0x62, 0x3E, 0xF1, 0xCA, 0xFF,
-    0x34, 0xBE, 0xB5, 0xBD, 0xB1, 0xD6, 0xD6, 0xD9, 0x95, 0x9F, 0x4C, 0x51, 0x7B, 0x2A, 0x6A, 0x86,
-    0xA0, 0x3A, 0x97, 0x2E, 0x4F, 0xFA, 0x41, 0x17, 0x54, 0x26, 0xCB, 0x4F, 0x9A, 0xB0, 0xC5, 0x49,
-    0x61, 0x56, 0x27, 0xBC, 0xD3, 0xF3, 0x51, 0x75, 0xD2, 0x04, 0x23, 0x4E, 0x92, 0xEE, 0x9C, 0xB9,
-    0xDB, 0xDE, 0x78, 0xB1, 0x0C, 0x30, 0x4F, 0x13, 0x71, 0xC2, 0x6D, 0x7B, 0xCD, 0x98, 0xA8, 0xC2,
-    0x3A, 0x2F, 0xE0, 0x3F, 0x5A, 0xDE, 0x7A, 0x12, 0xF3, 0xA4, 0x37, 0xAB, 0xCF, 0x16, 0x0F, 0xE5,
-    0x84, 0x83, 0xB5, 0x80, 0xD4, 0x7E, 0x1F, 0xA7, 0x25, 0x16, 0xC0, 0xF2, 0x61, 0x6B, 0xD2, 0x0A,
-    0x43, 0xE3, 0xC6, 0xFC, 0x85, 0x09, 0x3A, 0x22, 0x35, 0x68, 0x34, 0x0F, 0x29, 0x57, 0x88, 0xF1,
-    0x06, 0x57, 0xEE, 0x88, 0xC6, 0x60, 0xEE, 0x2D, 0xBF, 0xBB, 0x30, 0x26, 0xE1, 0x93, 0x88, 0x58,
-    0xFB, 0x1A, 0xCE, 0xB9, 0x31, 0x9B, 0xD9, 0x7C, 0xC2, 0xD9, 0xEE, 0xCA, 0xF0, 0x92, 0x8D, 0x79,
-    0xB8, 0x3C, 0x9D, 0x07, 0xF8, 0xA7, 0x8C, 0xF9, 0xE2, 0xEE, 0x5D, 0x5C, 0x86, 0xC0, 0x06, 0x3F,
-    0xE9, 0x8F, 0x4F, 0x0F, 0x77, 0xE9, 0x3B, 0xF6, 0x46, 0xEB, 0xD9, 0x9F, 0xDB, 0x06, 0x4B, 0x86,
-    0x9D, 0x89, 0x2B, 0xF3, 0xA4, 0x09, 0x1A, 0x7C, 0x7B, 0xBD, 0x09, 0x5A, 0x5C, 0x98, 0xC1, 0x24,
-    0x4B, 0x93, 0xF1, 0x02, 0xDF, 0x13, 0x47, 0x64, 0xBF, 0xDA, 0xE9, 0x4D, 0x81, 0x89, 0xAB, 0x32,
-    0xB2, 0xAF, 0x0C, 0x19, 0xD7, 0xFE, 0x16, 0xC1, 0x58, 0x16, 0x40, 0x32, 0xB3, 0x3B, 0x00, 0x36,
-    0xB1, 0xAF, 0x90, 0x52, 0xC5, 0x32, 0xEE, 0x09, 0x99, 0x67, 0x81, 0x4E, 0x6D, 0xD2, 0x06, 0xA4,
-    0x36, 0xC1, 0x20, 0x08, 0x8B, 0x25, 0x11, 0x8E, 0x3B, 0x43, 0x3C, 0x2C, 0x97, 0x32, 0x69, 0x8D,
-    0xC9, 0x7C, 0x3B, 0xA4, 0x36, 0xC7, 0x02, 0x5F, 0xB0, 0x95, 0xD9, 0x7A, 0xEC, 0xC6, 0xBF, 0x13,
-    0x39, 0x4B, 0xF6, 0x2E, 0x8A, 0x5F, 0x81, 0x02, 0x44, 0x2C, 0x37, 0x11, 0xD7, 0x27, 0xEA, 0x24,
-    0x38, 0x89, 0x48, 0xBC, 0x1D, 0xE1, 0x45, 0x92, 0xF9, 0xC1, 0xCE, 0xF5, 0x5C, 0x44, 0xC4, 0x13,
-    0xCF, 0x5A, 0x3C, 0x79, 0x72, 0xF3, 0x73, 0x8F, 0xE3, 0xD2, 0x83, 0x9B, 0xF7, 0x1E, 0x74, 0xF7,
-    0xCA, 0x86, 0x12, 0x94, 0x07, 0x07, 0x3B, 0x6D, 0xD0, 0x7A, 0x83, 0xDF, 0x43, 0xCA, 0x46, 0x13,
-    0x9A, 0x12, 0xD3, 0x66, 0x80, 0x3E, 0xC6, 0x49, 0xF8, 0xB3, 0x11, 0x92, 0x58, 0xB6, 0xE6, 0x89,
-    0xD0, 0x2E, 0xE3, 0x65, 0xDA, 0x83, 0x48, 0x76, 0x59, 0xE4, 0x61, 0x17, 0x81, 0x40, 0xC6, 0xD6,
-    0x61, 0x1D, 0x59, 0xB0, 0xB8, 0xE8, 0x4E, 0x63, 0xB2, 0xA7, 0x97, 0x26, 0x7E, 0x17, 0x70, 0x96,
-    0x78, 0x3B, 0x1A, 0x12, 0xC0, 0x09, 0x8A, 0x64, 0x20, 0x46, 0xBA, 0xB4, 0x75, 0xBA, 0x4C, 0xAC,
-    0x5D, 0x9A, 0x12, 0x98, 0x79, 0x67, 0x8D, 0x43, 0x06, 0x6A, 0x51, 0x95, 0x2F, 0x0D, 0xD1, 0x50,
-    0xE4, 0x0E, 0x19, 0xB3, 0xBD, 0xBF, 0x6B, 0x56, 0x88, 0x98, 0x78, 0x5A, 0x00, 0x48, 0x90, 0x91,
-    0x92, 0x20, 0xD9, 0x29, 0xC8, 0x3A, 0x3C, 0xA8, 0xC0, 0xA4, 0x1F, 0xEF, 0x06, 0x4D, 0x02, 0x2A,
-    0xB5, 0x7E, 0x7B, 0xDA, 0x64, 0xDF, 0x6B, 0x4D, 0x7F, 0x0A, 0x84, 0x6E, 0xCD, 0xC5, 0x73, 0x5E,
-    0x67, 0x9E, 0x33, 0xE7, 0x5E, 0x90, 0xE6, 0x9C, 0x22, 0xC8, 0xC6, 0x9C, 0xEE, 0xF5, 0xE2, 0xE1,
-    0x97, 0x9E, 0xBD, 0xE0, 0xBE, 0xCE, 0x79, 0x24, 0xEB, 0xB9, 0x53, 0xC6, 0xE6, 0xF7, 0x99, 0x8B,
-    0x19, 0x18, 0xD3, 0x9B, 0x3E, 0xC9, 0x23, 0xDB, 0xF8, 0x2D, 0x16, 0x5A, 0x98, 0xB0, 0xD6, 0x40,
-    0x88, 0x87, 0x03, 0x82, 0xA4, 0x0F, 0xF1, 0x4E, 0x34, 0x7D, 0xAF, 0xAC, 0x49, 0x4A, 0x81, 0x6B,
-    0xB6, 0xF6, 0xC8, 0xC8, 0xAF, 0xE5, 0xBE, 0x05, 0x66, 0x85, 0x19, 0xA2, 0xFA, 0x84, 0x0F, 0x52,
-    0x5C, 0x32, 0x3B, 0x36, 0x2F, 0x2F, 0xD4, 0x85, 0xDF, 0xA5, 0xF9, 0xA5, 0xB0, 0x2D, 0x76, 0x81,
-    0x5E, 0xDC, 0x3F, 0x39, 0x6B, 0xD0, 0xDE, 0xDE, 0x50, 0xD8, 0x29, 0xB1, 0xD7, 0x21, 0x18, 0xB9,
-    0xF9, 0x12, 0x24, 0x31, 0x6A, 0x20, 0x43, 0xFB, 0x50, 0xD7, 0xB8, 0x05, 0x99, 0x2D, 0x38, 0x92,
-    0x74, 0xD1, 0x00, 0xC2, 0xA7, 0x35, 0x88, 0x59, 0x54, 0x90, 0xB8, 0xA2, 0x8A, 0x3A, 0x40, 0x01,
-    0x65, 0xC8, 0x96, 0xD4, 0x33, 0x2A, 0x5B, 0xE2, 0x88, 0x63, 0xCC, 0xBD, 0x8B, 0xC5, 0x82, 0x7A,
-    0xF1, 0x06, 0xFE, 0x7B, 0x9C, 0xEF, 0xCF, 0x6A, 0xAB, 0xC7, 0x44, 0xF5, 0xB4, 0x6E, 0xDC, 0xBB,
-    0xC8, 0xB1, 0x30, 0xFE, 0x32, 0x3B, 0x1A, 0x43, 0x49, 0x39, 0x0E, 0x4D, 0x34, 0x20, 0x3A, 0x47,
-    0x46, 0x15, 0x5E, 0xF1, 0xDA, 0x13, 0xD1, 0x94, 0xBF, 0x70, 0x32, 0x7A, 0xBB, 0x3E, 0xF9, 0x78,
-    0x70, 0xB9, 0xF9, 0xEC, 0xF3, 0x38, 0xC4, 0x6D, 0x70, 0xB5, 0xC2, 0xC1, 0x42, 0x7F, 0x83, 0x97,
-    0x4D, 0xFC, 0x3C, 0x2F, 0xF1, 0xB4, 0x7D, 0xE0, 0x64, 0xDC, 0x5D, 0x3A, 0x79, 0x62, 0xEB, 0xCC,
-    0x3D, 0x8F, 0xC7, 0xE0, 0x72, 0xCB, 0x59, 0x6A, 0xCD, 0x07, 0x6D, 0xA1, 0xFE, 0x2F, 0x04, 0x1E,
-    0x40, 0xFB, 0xA5, 0xB5, 0x07, 0x16, 0xAB, 0x6E, 0xF1, 0xC9, 0x32, 0x04, 0xF9, 0xC6, 0xB0, 0x4B,
-    0x4D, 0x7C, 0xA5, 0x35, 0xC3, 0x69, 0x13, 0xE1, 0x0B, 0x6C, 0x88, 0x2F, 0x0F, 0x7E, 0x87, 0xC1,
-    0xD0, 0x87, 0x25, 0xA8, 0x3A, 0x93, 0xEB, 0x12, 0xB5, 0x08, 0x17, 0x98, 0xD9, 0x90, 0xBA, 0xAB,
-    0x1B, 0x8B, 0x47, 0xDF, 0x3C, 0x4B, 0xC5, 0x79, 0x9A, 0x96, 0xEC, 0xC8, 0x11, 0x87, 0x37, 0x36,
-    0x3E, 0x7F, 0xB6, 0xB7, 0xB7, 0xF7, 0xF4, 0x8A, 0x56, 0xBC, 0x91, 0xD8, 0x3C, 0xB6, 0x63, 0x30,
-    0x3E, 0xD6, 0x42, 0x10, 0xFE, 0xAA, 0x09, 0xBA, 0x13, 0xE0, 0x88, 0xAC, 0xCE, 0x28, 0xBE, 0x43,
-    0x11, 0xA1, 0x85, 0x1E, 0x18, 0x5E, 0xE4, 0xB4, 0x48, 0x21, 0x2C, 0x17, 0x4C, 0xC5, 0x65, 0x5A,
-    0xB1, 0xBB, 0x60, 0x97, 0x7B, 0x28, 0x55, 0x35, 0x85, 0xDD, 0x29, 0xB3, 0xEF, 0x71, 0x55, 0x0C,
-    0x49, 0x2B, 0xDF, 0xD6, 0x06, 0x48, 0x3E, 0xB8, 0xD3, 0x48, 0x8E, 0x33, 0xD9, 0xB2, 0xA4, 0xF6,
-    0x8A, 0xB6, 0xB0, 0x4D, 0x6C, 0x77, 0x8D, 0xD3, 0x88, 0x2F, 0x99, 0x21, 0x18, 0xC3, 0x21, 0x6E,
-    0xB3, 0x8A, 0x46, 0x1B, 0xEA, 0xB0, 0x6B, 0xBC, 0xE7, 0x60, 0x34, 0x68, 0x29, 0x33, 0x77, 0xAC,
-    0xDE, 0xC7, 0xB1, 0x36, 0x09, 0x8E, 0x8D, 0xC9, 0x5A, 0xFD, 0x41, 0x82, 0x06, 0x33, 0x0D, 0xA0,
-    0xEF, 0xF7, 0x07, 0xFB, 0x0F, 0x59, 0x69, 0x5B, 0x3B, 0x66, 0x89, 0xAD, 0xB2, 0x3E, 0x7B, 0xE8,
-    0x59, 0xB3, 0x9D, 0xCB, 0xE8, 0xCE, 0x66, 0x66, 0x3E, 0x56, 0x47, 0x1F, 0x1F, 0x5C, 0x79, 0x83,
-    0xC5, 0x59, 0xDA, 0xAD, 0x01, 0x1A, 0x61, 0xBB, 0xC0, 0x4E, 0x25, 0x98, 0x3D, 0x9E, 0x06, 0x4D,
-    0x71, 0x48, 0x79, 0xC8, 0xEE, 0x74, 0x48, 0xD7, 0xE3, 0x22, 0x1E, 0x02, 0x1E, 0x4C, 0xC9, 0xC3,
-    0xB1, 0x53, 0x14, 0xD7, 0xF7, 0x70, 0x38, 0xC5, 0x03, 0xC5, 0x9A, 0x27, 0x22, 0xA7, 0xB9, 0x1B,
-    0x84, 0xBF, 0x32, 0x15, 0xEF, 0x4E, 0x29, 0xD1, 0x49, 0x9B, 0xAC, 0xFF, 0x83, 0xC1, 0x1B, 0x82,
-    0x3E, 0x6A, 0xD3, 0xEA, 0xB4, 0xDC, 0xEE, 0x0B, 0x5E, 0xD9, 0xA6, 0x76, 0xB9, 0x33, 0x19, 0x18,
-    0xC4, 0x08, 0x82, 0xB4, 0x84, 0x26, 0xDE, 0x76, 0x5A, 0xFC, 0x5B, 0x46, 0x01, 0xAE, 0xCD, 0xD7,
-    0x76, 0x01, 0x7E, 0x15, 0xFF, 0xDC, 0x06, 0x6D, 0xD0, 0x3D, 0x69, 0xD2, 0x97, 0x1A, 0x6F, 0xB8,
-    0x64, 0xE2, 0x97, 0x1A, 0x33, 0xEC, 0x9B, 0xE4, 0x6A, 0xEB, 0x77, 0x60, 0x25, 0xCC, 0x19, 0x24,
-    0x00, 0xCA, 0x97, 0xCF, 0x0A, 0xDF, 0xC2, 0x14, 0x7A, 0x76, 0x5A, 0xDE, 0x47, 0x8D, 0x87, 0xA3,
-    0x84, 0x3B, 0xAA, 0x21, 0x17, 0x90, 0xAB, 0x92, 0xC6, 0x1D, 0xFC, 0x86, 0x92, 0x77, 0x26, 0x6D,
-    0x83, 0x11, 0x1C, 0xC3, 0x21, 0x6B, 0xA8, 0xFF, 0x79, 0xD2, 0xFA, 0x38, 0xA7, 0xEA, 0x4F, 0x10,
-    0x20, 0xB8, 0x98, 0xD3, 0x30, 0x4D, 0xE6, 0xA8, 0x0F, 0xE3, 0x84, 0x6D, 0x67, 0x2A, 0xE1, 0x22,
-    0x28, 0xD8, 0x14, 0x7E, 0xF9, 0x69, 0x9A, 0xB2, 0x63, 0x34, 0xF2, 0xB2, 0x8F, 0xD1, 0xCA, 0x26,
-    0xF8, 0x3C, 0xC8, 0xE1, 0xD2, 0x5C, 0x3C, 0x21, 0x1F, 0xBD, 0x94, 0xA8, 0xBA, 0x41, 0x49, 0x3E,
-    0x0F, 0x82, 0x59, 0x48, 0x35, 0x28, 0xA4, 0x64, 0x73, 0x10, 0xF4, 0x1C, 0x72, 0x85, 0x41, 0x98,
-    0x31, 0x1E, 0x34, 0x08, 0x8E, 0xD6, 0xC2, 0x8C, 0xEF, 0x9A, 0x8B, 0x26, 0x7A, 0xAD, 0x8A, 0x21,
-    0xFB, 0x4F, 0x98, 0xF0, 0x8D, 0x16, 0xCA, 0x92, 0x83, 0xB9, 0xAD, 0xD6, 0x81, 0xBD, 0x6A, 0x35,
-    0x7D, 0xBC, 0x84, 0x9E, 0xCB, 0xB7, 0xC3, 0x29, 0xCB, 0xD2, 0x62, 0x46, 0xAB, 0x78, 0x02, 0x57,
-    0x29, 0xE5, 0xC9, 0xC0, 0xA6, 0xFB, 0x7B, 0x17, 0xDE, 0x9A, 0x61, 0xD4, 0x20, 0xAA, 0xB5, 0xAE,
-    0x34, 0x49, 0x36, 0x2B, 0xB9, 0xD9, 0x06, 0xD4, 0xE1, 0xF2, 0x48, 0xAA, 0xAC, 0x6C, 0x88, 0x39,
-    0xB7, 0x22, 0x0F, 0xDF, 0x12, 0x79, 0x60, 0xDB, 0x1D, 0x79, 0x08, 0x88, 0xC8, 0x13, 0x36, 0x33,
-    0xE6, 0x5A, 0x8C, 0x48, 0x79, 0xDD, 0x8A, 0x3C, 0xC3, 0x8A, 0x3C, 0x17, 0x57, 0xE4, 0x91, 0xF4,
-    0x70, 0x50, 0x6A, 0x8E, 0x4F, 0x1A, 0x14, 0xE7, 0x29, 0x30, 0xC0, 0xA0, 0xA8, 0x4A, 0x7F, 0x6E,
-    0x39, 0x28, 0xA8, 0x93, 0x2A, 0xA9, 0x30, 0x28, 0x68, 0xC2, 0x06, 0x3E, 0xD7, 0xEE, 0x22, 0xCA,
-    0x43, 0x74, 0x40, 0xF2, 0x10, 0x86, 0x92, 0xE4, 0xB9, 0xB8, 0x8A, 0x76, 0x4E, 0xAF, 0xB4, 0x2E,
-    0x5D, 0x9D, 0x90, 0x05, 0x3A, 0x21, 0x8C, 0x3A, 0x21, 0xF7, 0x8B, 0x7C, 0x26, 0x88, 0x4E, 0x68,
-    0xDF, 0x0A, 0x05, 0x0E, 0x0C, 0x4B, 0x44, 0xC3, 0x41, 0xF1, 0x01, 0xEE, 0xAF, 0x3C, 0x8E, 0x89,
-    0xCC, 0x1D, 0x3F, 0xDE, 0x99, 0x39, 0xC2, 0xDC, 0xB6, 0x33, 0x7D, 0x7C, 0xCD, 0x46, 0xF1, 0xC9,
-    0x1E, 0x1A, 0x1D, 0xEE, 0x41, 0x45, 0x94, 0x09, 0xD7, 0x5D, 0xE4, 0x82, 0x73, 0x3B, 0x8C, 0xCE,
-    0x44, 0x17, 0xDA, 0x4A, 0x49, 0x4B, 0x3A, 0xCE, 0xC4, 0x0B, 0x68, 0x5A, 0x25, 0x52, 0xB4, 0x80,
-    0x10, 0xA0, 0xE3, 0x4B, 0xBA, 0x51, 0x60, 0x4F, 0x2F, 0x8A, 0x21, 0xC0, 0xD5, 0xEA, 0x16, 0x02,
-    0xCF, 0x8C, 0x80, 0xD7, 0xA0, 0x4B, 0x84, 0x5B, 0x3B, 0x08, 0x1E, 0x8C, 0x37, 0xF6, 0x74, 0x11,
-    0x40, 0x36, 0x4B, 0x96, 0xD9, 0x44, 0xD4, 0xE2, 0x57, 0x7A, 0xDA, 0xCC, 0x04, 0x24, 0x27, 0xE7,
-    0x08, 0x42, 0x21, 0x2F, 0x0E, 0x8E, 0xC4, 0x95, 0x6E, 0x41, 0xAA, 0x18, 0x1C, 0x6B, 0xFE, 0x84,
-    0xCE, 0x46, 0x20, 0x7C, 0x6D, 0x6F, 0x5A, 0x3A, 0x02, 0x8A, 0xE5, 0x72, 0x07, 0x7A, 0x51, 0x42,
-    0xC4, 0x5B, 0xC4, 0xD4, 0x78, 0xCF, 0xE2, 0xF0, 0xF8, 0x91, 0x14, 0x02, 0x99, 0x21, 0xE4, 0x06,
-    0x44, 0x61, 0xE4, 0x77, 0xE2, 0xA6, 0x67, 0x51, 0x2E, 0xBA, 0x63, 0x7A, 0xA8, 0x33, 0x8C, 0xBE,
-    0x6F, 0x47, 0x2A, 0x7F, 0x66, 0x77, 0xA3, 0x59, 0x28, 0x1C, 0x91, 0xB8, 0x46, 0xE1, 0xC2, 0xB9,
-    0xA4, 0xF3, 0xF3, 0xD2, 0x0E, 0xA4, 0x72, 0x08, 0x41, 0x0F, 0xA7, 0x9B, 0x26, 0xFC, 0x3B, 0xF7,
-    0x65, 0xE7, 0x2F, 0xA7, 0xEC, 0x85, 0x8B, 0x02, 0xE1, 0xA9, 0x5C, 0x20, 0x57, 0x39, 0xCE, 0xE5,
-    0x47, 0x00, 0xBB, 0x3D, 0xC3, 0xEC, 0xF4, 0x41, 0xF1, 0x24, 0xD4, 0x52, 0xD3, 0x04, 0xD6, 0x85,
-    0x94, 0x14, 0x11, 0x40, 0xF4, 0x53, 0x09, 0x77, 0x7C, 0xC5, 0xA9, 0xE6, 0x53, 0xFA, 0xCA, 0xBC,
-    0x51, 0x6F, 0xBB, 0xF5, 0x2F, 0xB9, 0xAF, 0x41, 0xB3, 0x41, 0x8A, 0x69, 0xFA, 0x61, 0x83, 0x60,
-    0xAD, 0x18, 0xF3, 0x26, 0x8D, 0x3C, 0x3B, 0x67, 0x8B, 0x15, 0xD2, 0x9B, 0xF4, 0xAD, 0xBD, 0xF3,
-    0x83, 0x84, 0x19, 0x51, 0x0B, 0xD1, 0xF5, 0x27, 0x85, 0xAE, 0x08, 0x95, 0x15, 0xCC, 0xD9, 0x5C,
-    0x01, 0x7E, 0xB9, 0x0C, 0xC7, 0x1C, 0xC4, 0xBA, 0x56, 0x2A, 0xB6, 0xD6, 0x14, 0x90, 0xE0, 0xDB,
-    0x88, 0xE0, 0xB2, 0x01, 0x93, 0xB8, 0xAF, 0xB2, 0x77, 0xC0, 0x0B, 0x95, 0xE8, 0xC0, 0x21, 0x7B,
-    0x14, 0x05, 0x3E, 0xDA, 0x24, 0xB8, 0xE4, 0x58, 0x6B, 0x05, 0x7C, 0xE8, 0xC0, 0x8D, 0xDF, 0x16,
-    0xEE, 0xD9, 0xB7, 0x46, 0x97, 0x0B, 0x14, 0x46, 0xA6, 0xE9, 0x81, 0x8F, 0x19, 0xEE, 0xF7, 0xE7,
-    0xF7, 0xB8, 0x34, 0x45, 0xEE, 0xDB, 0x0E, 0xB4, 0xBB, 0xDE, 0xA4, 0x48, 0xDB, 0x6B, 0x33, 0x01,
-    0xF8, 0x9C, 0x92, 0xC1, 0x3B, 0x7C, 0x3E, 0xCA, 0xB8, 0x7F, 0xD9, 0x7C, 0x85, 0x12, 0x3F, 0x31,
-    0xAB, 0x04, 0x98, 0xFE, 0xC6, 0x17, 0xDE, 0x1F, 0x3F, 0x9E, 0x48, 0x1B, 0x97, 0xAC, 0x06, 0x4E,
-    0xD8, 0x63, 0x07, 0x6E, 0x26, 0x07, 0x62, 0x4E, 0x3B, 0xDF, 0x3B, 0x7F, 0x65, 0x0A, 0x5D, 0x4C,
-    0xFA, 0xB6, 0xD3, 0x87, 0x19, 0xCD, 0x7F, 0xF9, 0xF8, 0x50, 0x62, 0x0B, 0x59, 0xDB, 0xE2, 0x8C,
-    0x32, 0x4B, 0x57, 0x05, 0xF0, 0xF8, 0x2D, 0x20, 0x0A, 0x8B, 0x84, 0x91, 0xD0, 0xBF, 0xDB, 0x3B,
-    0xE7, 0x9A, 0xFC, 0x63, 0xE3, 0xEA, 0x35, 0x43, 0xA1, 0xC8, 0xCC, 0x44, 0xAF, 0x60, 0xA9, 0x3F,
-    0x21, 0x12, 0xA1, 0x73, 0x14, 0x7E, 0x97, 0xB8, 0xC4, 0x30, 0xA9, 0x66, 0x72, 0x8C, 0x9E, 0x73,
-    0x33, 0x61, 0x13, 0x4E, 0x8A, 0x7A, 0x32, 0xBA, 0xC8, 0x5E, 0xC8, 0x15, 0x72, 0x9A, 0x71, 0x35,
-    0x0F, 0x29, 0xE7, 0xBC, 0x28, 0x54, 0x5E, 0xC5, 0xA1, 0x7B, 0x7B, 0x0C, 0x8F, 0x88, 0x09, 0x87,
-    0x7C, 0x82, 0x65, 0x0F, 0x2E, 0x74, 0x8E, 0xC1, 0x2B, 0x16, 0x62, 0x24, 0x2C, 0xBA, 0x27, 0x15,
-    0x62, 0x14, 0x0E, 0xD9, 0xF7, 0xA7, 0x9C, 0xF3, 0xDB, 0xBE, 0x54, 0x91, 0xC9, 0xDA, 0x57, 0xAD,
-    0x5D, 0x66, 0x33, 0x46, 0xDB, 0xFB, 0xCF, 0x18, 0x26, 0x0D, 0x9D, 0x2A, 0x1E, 0x70, 0xDA, 0xDF,
-    0x45, 0x40, 0x06, 0x9F, 0x96, 0x2D, 0x31, 0x99, 0xDF, 0x93, 0x82, 0xC9, 0xB2, 0x84, 0x69, 0xEF,
-    0x58, 0x2E, 0xFA, 0xA4, 0x03, 0x8B, 0xA4, 0x17, 0x71, 0xE7, 0x0C, 0xE4, 0x0E, 0xA7, 0x62, 0x62,
-    0x46, 0xB0, 0xA5, 0x3B, 0x26, 0xE9, 0xD7, 0x6E, 0x34, 0x94, 0x98, 0xA5, 0x08, 0x51, 0xFF, 0x56,
-    0x54, 0xAE, 0x3D, 0xD5, 0xA0, 0x7C, 0x17, 0x29, 0x3C, 0xF2, 0xCC, 0x5A, 0x90, 0x84, 0x6C, 0xAC,
-    0xD7, 0x1F, 0x6B, 0x9D, 0x50, 0xCC, 0xA5, 0x2B, 0xE3, 0x6B, 0x7E, 0xC2, 0xE6, 0xEA, 0x63, 0xEE,
-    0xA3, 0x41, 0x49, 0xBD, 0xB6, 0xDB, 0xB1, 0xFC, 0x74, 0x2A, 0xB8, 0x93, 0x6E, 0x43, 0x36, 0xE7,
-    0x0F, 0xD3, 0xF5, 0x05, 0xC9, 0x6B, 0x7B, 0xD6, 0x9C, 0xEC, 0x32, 0xB9, 0xBE, 0x77, 0x9E, 0x79,
-    0x3F, 0xF0, 0xE6, 0x32, 0x3A, 0x8D, 0x73, 0x9E, 0x9E, 0x71, 0x82, 0xA8, 0xC5, 0x6F, 0x3A, 0xBD,
-    0x60, 0x3B, 0x09, 0x5F, 0xEE, 0xE2, 0xE6, 0xDB, 0x07, 0xAC, 0x4E, 0xEF, 0xE1, 0x69, 0x50, 0xF3,
-    0xF4, 0x09, 0x9E, 0x46, 0x3A, 0x1D, 0xB7, 0xB9, 0xF0, 0x15, 0x1E, 0x06, 0x07, 0xC3, 0x1A, 0xBA,
-    0xE7, 0xE6, 0x98, 0x07, 0x18, 0x74, 0x0A, 0x3A, 0x88, 0xAC, 0x9E, 0x0B, 0xAD, 0x4F, 0x9A, 0x8F,
-    0x02, 0x2E, 0xC7, 0x15, 0x23, 0x5A, 0xE7, 0x48, 0x28, 0x12, 0xAF, 0xB5, 0x8C, 0x53, 0x21, 0x24,
-    0xBE, 0xCC, 0x69, 0x8A, 0x90, 0x76, 0x33, 0x08, 0x96, 0xFA, 0xE9, 0xE5, 0x6F, 0x0B, 0x17, 0xCF,
-    0x52, 0xE8, 0x31, 0xBB, 0xE7, 0x10, 0x10, 0x2E, 0x1D, 0x4F, 0xB7, 0xEE, 0x04, 0xDF, 0xF5, 0x19,
-    0x01, 0x87, 0x8B, 0xB9, 0x13, 0xB2, 0x8C, 0xDB, 0x78, 0x7A, 0x8A, 0xA7, 0xA1, 0x10, 0x90, 0xB5,
-    0x89, 0xEB, 0x1D, 0x22, 0x20, 0x25, 0xB9, 0x2A, 0x18, 0xCC, 0xFD, 0xE6, 0x58, 0x6E, 0xC2, 0x81,
-    0x42, 0x5D, 0xD6, 0x05, 0x94, 0x5E, 0xA7, 0x69, 0x9E, 0xDE, 0x9E, 0xEC, 0xFC, 0xAE, 0x8A, 0xD4,
-    0x67, 0x64, 0x14, 0x0B, 0x58, 0xBB, 0xD1, 0x85, 0xF7, 0xB5, 0xF1, 0x96, 0x6B, 0x90, 0x55, 0x8D,
-    0x02, 0xAD, 0x73, 0xE3, 0xE8, 0xF5, 0x9E, 0xFE, 0xB6, 0xED, 0x35, 0x10, 0xAD, 0x70, 0x15, 0x39,
-    0x2C, 0x08, 0x43, 0x8E, 0xD8, 0xBB, 0x18, 0x3C, 0xDB, 0x80, 0x5C, 0x7E, 0x6E, 0x3E, 0xA8, 0xE5,
-    0x60, 0x01, 0x28, 0x61, 0x25, 0x32, 0x96, 0xD7, 0x5A, 0xC8, 0xD6, 0xE5, 0xC1, 0x4C, 0xA9, 0xF1,
-    0x57, 0xF9, 0xF9, 0x62, 0x71, 0x16, 0x26, 0xF0, 0x9B, 0x34, 0xA2, 0x45, 0x2D, 0x23, 0x05, 0xE9,
-    0x7B, 0x9F, 0x5F, 0xC7, 0xED, 0x2E, 0x38, 0xF4, 0x22, 0xB8, 0x7C, 0x2C, 0x3F, 0xF6, 0xF0, 0x10,
-    0x4C, 0x45, 0x9D, 0xBD, 0x3B, 0x06, 0x53, 0xBA, 0x4C, 0x36, 0x64, 0x02, 0xCE, 0xE4, 0x21, 0x0C,
-    0x49, 0x98, 0x42, 0x8D, 0xBF, 0x89, 0x65, 0xF1, 0xE5, 0x95, 0x07, 0x10, 0x8B, 0x81, 0x25, 0x5D,
-    0xEF, 0x91, 0xF2, 0x87, 0xCE, 0x3D, 0xA8, 0xA6, 0xAD, 0xAF, 0xA4, 0xDD, 0xA2, 0x5B, 0xB1, 0xCA,
-    0x55, 0x28, 0x0D, 0x65, 0xC3, 0x0B, 0xDF, 0xEA, 0x22, 0x96, 0xF8, 0xC1, 0xC6, 0xAB, 0xFE, 0x3F,
-    0xE8, 0x22, 0x93, 0xD0, 0xF8, 0xD3, 0xC2, 0xC2, 0xEF, 0xA5, 0xEF, 0x70, 0x16, 0x7F, 0x92, 0xFA,
-    0xA4, 0x8D, 0x7B, 0xB2, 0x31, 0x6C, 0x7E, 0xA7, 0xD0, 0x04, 0x91, 0xF4, 0xD0, 0x73, 0x53, 0x67,
-    0xB5, 0x84, 0xBC, 0xE3, 0x45, 0x32, 0x81, 0x3B, 0x6F, 0xB1, 0xC4, 0xBD, 0x86, 0x6D, 0xDA, 0xC8,
-    0x10, 0x8E, 0x2D, 0xEF, 0x72, 0x7E, 0xCD, 0x73, 0xE2, 0x3C, 0x3A, 0xBB, 0xFE, 0x8E, 0x8B, 0x0A,
-    0xFA, 0x54, 0xB6, 0x3D, 0x74, 0xA6, 0xEF, 0xE8, 0x54, 0x99, 0x1E, 0xFA, 0xDE, 0xC5, 0xD9, 0x02,
-    0x73, 0x87, 0x14, 0x75, 0xFA, 0x7A, 0xDB, 0x79, 0x74, 0x93, 0x70, 0x5D, 0x32, 0xFB, 0xFB, 0xCE,
-    0xE0, 0x44, 0xBC, 0x6C, 0x75, 0x39, 0x42, 0xEC, 0x79, 0xF9, 0xEA, 0xE0, 0x2E, 0x5D, 0xE5, 0x24,
-    0xAE, 0xCB, 0xA5, 0x2E, 0x21, 0xA3, 0xBA, 0x4C, 0x5A, 0x5D, 0xC2, 0xFB, 0xE8, 0x12, 0xB7, 0x75,
-    0x99, 0xB4, 0xBA, 0x04, 0xED, 0x74, 0x19, 0x4C, 0xEE, 0x32, 0x6E, 0x75, 0x69, 0x8A, 0x97, 0x74,
-    0x19, 0x4C, 0xEE, 0x92, 0x31, 0x54, 0xCC, 0x54, 0x73, 0xD2, 0x25, 0x6B, 0x50, 0x3B, 0x07, 0xAC,
-    0xAB, 0x23, 0xDA, 0x20, 0xB0, 0x4D, 0xC8, 0xE0, 0xC2, 0x9F, 0x36, 0x5A, 0x39, 0xF3, 0xC7, 0xC5,
-    0x0B, 0x73, 0x78, 0x9D, 0xBA, 0x30, 0xA2, 0x70, 0x99, 0x97, 0x23, 0x0C, 0xAC, 0x8F, 0x99, 0x6B,
-    0x96, 0xB7, 0x7D, 0x2E, 0x88, 0xCC, 0x85, 0xE2, 0x85, 0xC8, 0x45, 0x44, 0xF6, 0x9A, 0x47, 0x73,
-    0xC2, 0x45, 0x5B, 0x25, 0xAC, 0x45, 0x1B, 0x2A, 0x04, 0xAA, 0xE5, 0x9D, 0x6D, 0x65, 0xE5, 0xA3,
-    0x35, 0x69, 0x30, 0xEA, 0x5E, 0xDC, 0xCB, 0xC1, 0x64, 0x6F, 0xB8, 0xA6, 0xD1, 0xD3, 0x72, 0xB8,
-    0x56, 0x7E, 0x3D, 0x72, 0x8F, 0xD2, 0x37, 0x04, 0x8A, 0xFD, 0x42, 0xAF, 0xB7, 0x52, 0x45, 0x43,
-    0x6D, 0x51, 0xC9, 0x69, 0xD3, 0xDE, 0x04, 0x48, 0xAB, 0x59, 0x33, 0x69, 0x02, 0x27, 0x7C, 0x21,
-    0xAE, 0x52, 0xC6, 0x19, 0x6F, 0x3E, 0xEA, 0x78, 0x46, 0x9E, 0xCC, 0x1E, 0xDF, 0xDC, 0xFF, 0xC3,
-    0x9B, 0xB1, 0x70, 0x24, 0x50, 0x9F, 0x6A, 0x76, 0x1D, 0x33, 0x05, 0x62, 0xE7, 0x1D, 0x8B, 0x5D,
-    0xDD, 0xDB, 0x35, 0x1F, 0x37, 0x02, 0x3C, 0xE1, 0x42, 0xC3, 0xB9, 0xC9, 0xA4, 0xAF, 0xE0, 0xBA,
-    0xEB, 0xC2, 0xBD, 0xA8, 0x02, 0xE2, 0xA0, 0x20, 0x36, 0x5E, 0x9A, 0xDB, 0xB3, 0xAF, 0x3F, 0xB7,
-    0xBB, 0x0A, 0x12, 0x14, 0x4B, 0x5A, 0x4D, 0x9C, 0x1D, 0x98, 0x62, 0x14, 0x05, 0x91, 0xBA, 0x13,
-    0xC4, 0x64, 0x50, 0x5A, 0x93, 0x76, 0xB1, 0xEA, 0x2E, 0xAD, 0x30, 0x2A, 0x2F, 0xDB, 0x0D, 0x54,
-    0xA6, 0xAC, 0x76, 0x04, 0x10, 0x0B, 0x66, 0x02, 0xBC, 0x2C, 0x02, 0xB8, 0x47, 0x33, 0x01, 0xB2,
-    0x57, 0x05, 0x97, 0xFD, 0x3C, 0x47, 0x84, 0x43, 0xD2, 0xBA, 0xAA, 0xAE, 0x28, 0x6A, 0xD8, 0x9A,
-    0xA1, 0xA9, 0xA9, 0x68, 0x6A, 0x18, 0xFA, 0x47, 0xB0, 0xFF, 0xF6, 0xE0, 0x8B, 0x38, 0x73, 0xB1,
-    0x9E, 0x82, 0x5B, 0x95, 0x0C, 0xD5, 0xB8, 0x99, 0x33, 0x4E, 0xCF, 0x56, 0xEA, 0x73, 0xDA, 0x9F,
-    0x72, 0xB6, 0xA2, 0x14, 0xB7, 0xBB, 0x8C, 0x24, 0xF2, 0xAA, 0xB4, 0xBE, 0x93, 0x35, 0xF8, 0x48,
-    0x63, 0xFE, 0x15, 0xF3, 0x69, 0xA9, 0xB4, 0x62, 0xE7, 0xAC, 0x55, 0xA4, 0x57, 0x56, 0x12, 0xA4,
-    0x71, 0xAE, 0x41, 0x1C, 0xF1, 0x39, 0xC6, 0x06, 0x28, 0xA5, 0x68, 0x9A, 0x33, 0x95, 0x1C, 0xA6,
-    0x25, 0x67, 0x59, 0xCA, 0xB2, 0x2F, 0x22, 0x13, 0x81, 0x2F, 0x4E, 0x13, 0xC1, 0x2B, 0x11, 0xAF,
-    0x41, 0xB1, 0x43, 0xDA, 0xAA, 0x66, 0xB5, 0xC2, 0xE1, 0xE9, 0xCE, 0x61, 0x3E, 0x4B, 0xB6, 0x30,
-    0xFF, 0xE5, 0x2C, 0xF4, 0xDD, 0x21, 0xE6, 0x71, 0x27, 0x56, 0x64, 0x3F, 0x51, 0x1A, 0x6C, 0xA5,
-    0x3E, 0x51, 0xEF, 0x48, 0x59, 0x11, 0x64, 0x2C, 0x91, 0xB5, 0x9C, 0xDD, 0x14, 0x9D, 0xA1, 0xE0,
-    0x97, 0xD3, 0xA2, 0x74, 0xF5, 0x50, 0x91, 0x5D, 0x89, 0x8D, 0xF1, 0xF6, 0x66, 0x95, 0xFD, 0x23,
-    0x04, 0xB7, 0x19, 0x02, 0xC0, 0xA4, 0x0A, 0xDB, 0xB0, 0x4D, 0x2A, 0x7F, 0x28, 0xD8, 0x72, 0x70,
-    0x81, 0x2E, 0x09, 0x0A, 0x75, 0xF7, 0xC6, 0xD2, 0x84, 0x5D, 0x5A, 0x25, 0x35, 0x3C, 0x3A, 0xB2,
-    0xB6, 0xCF, 0x1A, 0xF3, 0xBC, 0x7B, 0xDB, 0x87, 0x07, 0xDC, 0x72, 0x0C, 0x0F, 0x6B, 0xCE, 0x4D,
-    0x79, 0x21, 0xC7, 0xAD, 0x9A, 0x2B, 0x1E, 0x6B, 0xBF, 0x62, 0xB9, 0xA6, 0x8A, 0x6C, 0x4E, 0x40,
-    0x23, 0xDB, 0x92, 0xC4, 0xD1, 0x8D, 0x81, 0xF9, 0x48, 0xD4, 0xDA, 0x9C, 0xDE, 0xA0, 0xCD, 0x1A,
-    0x20, 0x18, 0xB5, 0x71, 0x0F, 0xEA, 0x44, 0xAD, 0x3F, 0x61, 0x4C, 0x44, 0x2B, 0xA1, 0xAA, 0x31,
-    0xB8, 0xCA, 0x72, 0x2B, 0x30, 0xED, 0x58, 0x43, 0x1E, 0x65, 0xF3, 0x11, 0x7C, 0xDB, 0x97, 0xD8,
-    0x1B, 0xAD, 0xD2, 0x1B, 0x2C, 0xC5, 0x36, 0xCA, 0x69, 0xF1, 0x7A, 0xE9, 0xFC, 0x2B, 0x0D, 0x0D,
-    0xC8, 0x1F, 0x39, 0xDE, 0xC3, 0x06, 0x7D, 0x77, 0x07, 0x5F, 0xAF, 0xBB, 0x14, 0xA7, 0x51, 0xB6,
-    0x65, 0xEE, 0x5E, 0x71, 0x7F, 0xFE, 0x04, 0x2E, 0x66, 0xF0, 0xE6, 0xF2, 0x42, 0xD1, 0xCC, 0xDD,
-    0xBA, 0x7C, 0xA3, 0xE0, 0x66, 0xBC, 0xB9, 0x30, 0xE7, 0x2D, 0x6F, 0x77, 0x87, 0x8B, 0x1C, 0xEE,
-    0xF0, 0x0C, 0x35, 0x20, 0x61, 0x53, 0xB1, 0x37, 0xAC, 0xDA, 0x22, 0xD8, 0x31, 0xC7, 0x5D, 0x10,
-    0x40, 0x87, 0x35, 0xB8, 0xF2, 0x36, 0x67, 0x61, 0x73, 0xD8, 0x25, 0xD2, 0xBF, 0x99, 0x87, 0xF0,
-    0xD4, 0x4C, 0xC5, 0xD8, 0x70, 0x73, 0x89, 0x79, 0xD4, 0xAB, 0x6A, 0x28, 0x90, 0x27, 0x97, 0x07,
-    0x5A, 0xB1, 0x42, 0x79, 0x99, 0x9D, 0xCE, 0x53, 0x41, 0xE2, 0x39, 0x34, 0x2D, 0x9C, 0x42, 0x98,
-    0x2F, 0x3E, 0x73, 0x33, 0x5A, 0x73, 0x62, 0x10, 0xBA, 0xBE, 0x61, 0x34, 0xCE, 0xA5, 0x57, 0xE7,
-    0x1C, 0x9C, 0x8D, 0x74, 0x49, 0xDD, 0x61, 0x6C, 0xF9, 0xB1, 0xA5, 0xC9, 0x71, 0xC7, 0xF4, 0x78,
-    0x30, 0x1B, 0x75, 0x97, 0xF8, 0xDD, 0xB9, 0xEA, 0xEF, 0xF4, 0x57, 0xD9, 0x3F, 0xEB, 0xF1, 0x27,
-    0x6F, 0x25, 0x06, 0xE2, 0x50, 0x86, 0xC1, 0x0F, 0x2B, 0x04, 0xB6, 0x3D, 0xBF, 0x12, 0x17, 0x7F,
-    0x9B, 0x9D, 0xE6, 0x37, 0x8B, 0xF6, 0x91, 0x0F, 0x21, 0xD8, 0x4A, 0xD8, 0x0B, 0xB3, 0xA6, 0x49,
-    0xA3, 0x18, 0x87, 0x96, 0x84, 0xA5, 0x78, 0xE0, 0xCC, 0xB7, 0x11, 0xE0, 0xD0, 0xF9, 0x05, 0xF6,
-    0xFA, 0x05, 0x85, 0x9C, 0xCE, 0xBE, 0x79, 0xB3, 0x97, 0xF4, 0x1E, 0x39, 0x23, 0x6C, 0x94, 0x8D,
-    0xD1, 0x4E, 0xC4, 0x9D, 0xE4, 0x42, 0xFE, 0xD2, 0xB7, 0x9E, 0x73, 0xCC, 0x47, 0x25, 0x65, 0xAB,
-    0xC4, 0xE3, 0x2C, 0xC5, 0x22, 0x66, 0xE4, 0xAC, 0xB6, 0xF3, 0x12, 0xC4, 0x68, 0x18, 0x98, 0x7B,
-    0x08, 0x01, 0x3F, 0x08, 0x19, 0xB8, 0xF9, 0x21, 0x04, 0x19, 0x11, 0xB3, 0xFA, 0x13, 0x2B, 0x62,
-    0x2C, 0x15, 0xE6, 0xD0, 0x4C, 0xB1, 0xB9, 0x3D, 0xB9, 0xAC, 0x0E, 0x86, 0x93, 0xD5, 0x92, 0xD8,
-    0xBE, 0x55, 0xAA, 0x64, 0xE5, 0xCA, 0x40, 0xA1, 0x2C, 0x07, 0x78, 0xF9, 0xD5, 0x9B, 0x84, 0xFD,
-    0x81, 0x8D, 0x70, 0xD1, 0xC5, 0x4A, 0xBE, 0x0B, 0xA3, 0xDD, 0xE8, 0xF4, 0xDA, 0xD1, 0xA1, 0x12,
-    0x69, 0xB1, 0x58, 0x7C, 0xDE, 0xB2, 0x07, 0xCE, 0x5C, 0x0C, 0x4E, 0xA4, 0xDA, 0xE9, 0x94, 0x63,
-    0x80, 0x2C, 0xA1, 0xE3, 0x8C, 0x93, 0x52, 0x76, 0x97, 0xAC, 0x76, 0xD5, 0x44, 0xEA, 0x92, 0x62,
-    0x0C, 0x23, 0x5B, 0x6F, 0x52, 0xDF, 0x32, 0x76, 0x8D, 0xC4, 0xEC, 0x25, 0x95, 0x7A, 0xC6, 0x61,
-    0xC3, 0x70, 0x15, 0x0E, 0x28, 0xA7, 0xB7, 0xAE, 0x5B, 0xED, 0x2A, 0x44, 0xFF, 0xE7, 0xC5, 0x71,
-    0xFB, 0xCC, 0xDA, 0x6B, 0x04, 0xE2, 0x3E, 0xE1, 0xA5, 0xC5, 0xCF, 0x71, 0xCD, 0x10, 0xCF, 0x0D,
-    0x17, 0xBE, 0xD9, 0xBF, 0xE6, 0xD2, 0x9B, 0x6B, 0xDA, 0xD0, 0x84, 0x2C, 0x64, 0xB1, 0xC3, 0x56,
-    0xAD, 0x4B, 0x72, 0xE2, 0x2E, 0x50, 0xB1, 0xCC, 0x72, 0x6A, 0xF5, 0xE2, 0x71, 0x33, 0xE8, 0xD7,
-    0x37, 0xAD, 0x46, 0x22, 0x33, 0x47, 0xEC, 0x11, 0x4C, 0x17, 0x80, 0xBB, 0x52, 0x95, 0xEC, 0xAD,
-    0x67, 0xE7, 0x64, 0x5B, 0x0B, 0x49, 0xB4, 0x62, 0xEB, 0x02, 0x37, 0xC5, 0x21, 0x5B, 0x3F, 0x14,
-    0xA5, 0x15, 0xE2, 0x51, 0x90, 0x02, 0x24, 0xDD, 0x78, 0xAD, 0x72, 0x75, 0x46, 0xBC, 0x24, 0x7F,
-    0x42, 0x01, 0x48, 0x2B, 0x9A, 0xF5, 0x89, 0x57, 0x91, 0xB6, 0x65, 0x69, 0x9B, 0x16, 0xD8, 0x0D,
-    0x5B, 0xB0, 0x2F, 0xAD, 0xA5, 0xE3, 0xAC, 0x48, 0xE5, 0x92, 0x46, 0xC3, 0xE7, 0x76, 0x13, 0xDE,
-    0xB6, 0x6C, 0xF2, 0xF2, 0x58, 0x02, 0x31, 0xB8, 0x48, 0x2C, 0x57, 0x45, 0x74, 0x6F, 0x4B, 0x4C,
-    0x82, 0x75, 0x4A, 0x9A, 0x13, 0x56, 0x33, 0x43, 0xE4, 0xBC, 0x8F, 0x83, 0x4D, 0xE9, 0x95, 0xD6,
-    0x4C, 0x9E, 0x85, 0xB3, 0x6A, 0x0B, 0xE6, 0x87, 0x0F, 0xDB, 0x36, 0x55, 0xE1, 0x70, 0x6B, 0x6D,
-    0x58, 0xBF, 0xB1, 0xDA, 0x0A, 0xE6, 0x4F, 0xEB, 0x22, 0x19, 0x4D, 0xA2, 0x44, 0x70, 0xEE, 0xF3,
-    0x1C, 0xD1, 0x7B, 0x53, 0xD5, 0x89, 0xF2, 0x17, 0x4E, 0x17, 0x88, 0x1A, 0xE4, 0x37, 0xA9, 0xDD,
-    0x86, 0xAD, 0x89, 0x5D, 0x5F, 0xBB, 0x66, 0x06, 0x0E, 0xDB, 0x25, 0x68, 0x80, 0x98, 0x04, 0x6F,
-    0x5D, 0xB7, 0xB4, 0xD0, 0xA2, 0xB1, 0x65, 0xDB, 0x74, 0x75, 0x56, 0x43, 0x52, 0xD3, 0x83, 0x1D,
-    0xFB, 0x16, 0x68, 0x9A, 0x4D, 0x81, 0xED, 0x30, 0xEA, 0x6F, 0x72, 0x6F, 0x6D, 0xF8, 0xF3, 0x55,
-    0x7B, 0x5C, 0x60, 0x29, 0x04, 0xA1, 0xAA, 0xA8, 0x00, 0xE9, 0x8C, 0x5C, 0xFD, 0x61, 0x02, 0x79,
-    0xF7, 0x4A, 0x2E, 0x22, 0x2B, 0x8F, 0xC4, 0x66, 0xFD, 0x05, 0x36, 0xF9, 0xC9, 0x9E, 0x01, 0x00,
-    0xE2, 0xAF, 0xA7, 0x9F, 0x3E, 0xF3, 0xE1, 0x11, 0xD1, 0xE6, 0xCF, 0xB1, 0x47, 0xD7, 0xE3, 0x70,
-    0x03, 0xAE, 0xEF, 0x75, 0xAC, 0x1B, 0x54, 0xD4, 0xC8, 0xFC, 0x88, 0x5E, 0xDD, 0x6F, 0x15, 0x34,
-    0x6E, 0x3E, 0x43, 0x84, 0xC4, 0x18, 0x89, 0x87, 0xB0, 0x0B, 0xFA, 0xA3, 0xED, 0xF5, 0x6F, 0x0F,
-    0x2A, 0xF2, 0x29, 0x52, 0x31, 0x9E, 0x4B, 0x5E, 0x62, 0xAB, 0x98, 0xA1, 0xA5, 0xE9, 0x29, 0x67,
-    0x03, 0xCF, 0xF6, 0xD5, 0xF8, 0xA7, 0xBA, 0x27, 0xE3, 0x87, 0xA9, 0x1A, 0xAE, 0xB5, 0xCD, 0x9A,
-    0xC6, 0x04, 0x53, 0x64, 0x92, 0xEB, 0xE5, 0xCF, 0xA6, 0x12, 0x36, 0x0D, 0x46, 0xDF, 0x9F, 0xE0,
-    0x60, 0xB8, 0xB9, 0xA8, 0x1A, 0x18, 0x87, 0x46, 0xED, 0xFD, 0x2A, 0x17, 0x8D, 0x5A, 0x7A, 0x8B,
-    0x7E, 0xB7, 0x78, 0x87, 0xD6, 0x6B, 0x47, 0xED, 0x0E, 0xE6, 0x0E, 0xFF, 0xC4, 0xAD, 0x8E, 0xBB,
-    0x04, 0x2E, 0x9C, 0x3B, 0x2B, 0x83, 0xF3, 0x24, 0x93, 0x53, 0x35, 0xDC, 0xA2, 0x71, 0x80, 0x9B,
-    0x65, 0x19, 0xE3, 0x73, 0xF6, 0x7B, 0x78, 0xE7, 0x42, 0x9B, 0xD9, 0x09, 0xB0, 0xF5, 0x81, 0x3D,
-    0x80, 0xD3, 0xE8, 0xCC, 0xA7, 0xCE, 0x18, 0x6F, 0xED, 0x92, 0x10, 0xAA, 0xC2, 0x28, 0x02, 0x07,
-    0xCB, 0x84, 0xC6, 0x3E, 0x05, 0x48, 0x5E, 0x87, 0x2F, 0xEC, 0x60, 0xAB, 0x9E, 0xE5, 0xB6, 0x09,
-    0x3A, 0x0E, 0xC6, 0x73, 0x82, 0x8A, 0x1D, 0x11, 0xB6, 0x47, 0x82, 0x61, 0x2E, 0x69, 0x2B, 0x93,
-    0x00, 0x3D, 0xCF, 0x94, 0xF6, 0xC2, 0x10, 0xD1, 0xF9, 0xEF, 0xD0, 0xF6, 0xCF, 0x6E, 0x5F, 0x01,
-    0x14, 0xED, 0xA1, 0x79, 0xB4, 0x9B, 0x37, 0x82, 0x94, 0x73, 0x81, 0x9C, 0xC8, 0xAD, 0xB6, 0x03,
-    0xF8, 0xD5, 0xBC, 0x53, 0x44, 0xD1, 0x01, 0xF3, 0x31, 0x35, 0x20, 0x94, 0xB3, 0x68, 0x2B, 0xE7,
-    0x67, 0x6F, 0x97, 0xB3, 0x5D, 0xDA, 0xF5, 0xA5, 0x6F, 0xCF, 0x4F, 0xDC, 0xFA, 0xD7, 0x61, 0x58,
-    0xF6, 0x4D, 0x5A, 0x71, 0x80, 0x9C, 0x5E, 0x81, 0x26, 0xAB, 0x8C, 0x7A, 0x55, 0xF5, 0xD4, 0xBD,
-    0xBD, 0xBD, 0x6F, 0x77, 0xF3, 0xB2, 0x41, 0x3F, 0x7B, 0x2C, 0xAD, 0x00, 0xC1, 0xF0, 0xF2, 0xD2,
-    0x9E, 0xE7, 0x36, 0x34, 0x9B, 0xCB, 0x51, 0x1C, 0x12, 0xC6, 0xFC, 0xDE, 0xCA, 0x74, 0xD1, 0x90,
-    0xD1, 0xAC, 0xC9, 0x2F, 0x12, 0x70, 0xD2, 0xE4, 0xF6, 0x7C, 0xFE, 0x83, 0x06, 0x8A, 0x15, 0x38,
-    0x11, 0x9F, 0xF2, 0xCB, 0xD4, 0x2B, 0x7E, 0x8D, 0x8E, 0x11, 0x93, 0x97, 0x20, 0x6D, 0x5C, 0x41,
-    0xE8, 0xBF, 0x34, 0xB7, 0x05, 0x67, 0xD6, 0x1E, 0x18, 0x6D, 0xCF, 0x4C, 0xAF, 0x97, 0x0D, 0x58,
-    0x68, 0xF3, 0x09, 0xC3, 0xE1, 0xB5, 0x32, 0xC0, 0xE2, 0x13, 0xA8, 0xE4, 0xEA, 0xAA, 0xE0, 0x7C,
-    0xF5, 0xFA, 0xDE, 0xDE, 0x3F, 0x13, 0x16, 0x85, 0xEE, 0xD9, 0x72, 0x66, 0x31, 0x93, 0x32, 0xA6,
-    0xC4, 0xF7, 0x40, 0xFA, 0xCB, 0x65, 0x4A, 0xA5, 0x29, 0xC8, 0xDF, 0x4F, 0xCD, 0xEE, 0x29, 0xA9,
-    0x13, 0x48, 0x0E, 0xE4, 0x1F, 0x49, 0x19, 0xF4, 0xC8, 0x3B, 0xB2, 0xD9, 0xFA, 0x41, 0x83, 0xF1,
-    0xFB, 0x8A, 0xDA, 0xB8, 0x8B, 0xBA, 0xA5, 0x16, 0xD1, 0x4F, 0x22, 0x50, 0x8B, 0x37, 0x12, 0x8B,
-    0xAF, 0xE7, 0xA9, 0xCD, 0x61, 0x0A, 0xB6, 0x58, 0xD8, 0xFC, 0xB5, 0xFE, 0x3C, 0x7B, 0x0D, 0xCB,
-    0x64, 0x73, 0x61, 0xFC, 0x07, 0x94, 0x5D, 0x16, 0x1B, 0x95, 0x9F, 0x52, 0xC7, 0x6E, 0xF2, 0xB9,
-    0xEF, 0x6B, 0x7E, 0x4F, 0xFD, 0x39, 0x64, 0x09, 0xC8, 0x10, 0xA2, 0x77, 0xFB, 0xA0, 0x2B, 0x1E,
-    0xEE, 0xC2, 0xFF, 0xEE, 0xCD, 0xC5, 0x3F, 0x35, 0x9F, 0x58, 0xE5, 0x02, 0x3F, 0x42, 0x60, 0x95,
-    0xC7, 0x20, 0xC0, 0x63, 0x9D, 0xF4, 0x90, 0x9B, 0x29, 0x6B, 0xD2, 0xE8, 0x7F, 0xBD, 0xC0, 0x1A,
-    0x91, 0x9A, 0x0A, 0x8A, 0xF3, 0x10, 0x77, 0x64, 0x75, 0xF6, 0x8B, 0x91, 0xA5, 0x83, 0xB4, 0xBA,
-    0x25, 0xD9, 0xF8, 0x91, 0x92, 0x5F, 0x90, 0xD4, 0x83, 0xF5, 0xE0, 0x3C, 0xC9, 0xAF, 0xFD, 0x55,
-    0xD0, 0xA6, 0x0C, 0xF1, 0xBA, 0x0B, 0x16, 0xE7, 0x09, 0x53, 0xEC, 0x89, 0xE1, 0x6F, 0x37, 0x37,
-    0x93, 0x3D, 0x6D, 0x8A, 0x62, 0x90, 0x9B, 0xB1, 0x63, 0xFC, 0x99, 0x9B, 0xB7, 0xA9, 0xFB, 0xFB,
-    0x50, 0x94, 0xD4, 0xFE, 0xA2, 0x55, 0x07, 0x28, 0x60, 0xFF, 0x21, 0x66, 0xF5, 0x0F, 0x0B, 0x04,
-    0x63, 0xCA, 0x92, 0x2B, 0x75, 0x63, 0xA2, 0x34, 0xD8, 0x62, 0x75, 0x98, 0xDC, 0x41, 0x0F, 0x70,
-    0x18, 0x11, 0x71, 0xF8, 0x43, 0x4A, 0x7D, 0x20, 0x29, 0x61, 0x2B, 0xFF, 0xBE, 0xAC, 0xFD, 0xB9,
-    0x92, 0xCD, 0xDD, 0x68, 0x1B, 0xC9, 0x7B, 0x5A, 0xFF, 0xB1, 0xD2, 0xD1, 0x48, 0xC9, 0xDB, 0xDB,
-    0xDA, 0x38, 0xA7, 0x78, 0xFD, 0x79, 0xE5, 0x6A, 0x77, 0x99, 0x2F, 0x1F, 0xBD, 0x5B, 0xA0, 0x39,
-    0xCE, 0xD9, 0x06, 0xCE, 0x97, 0x59, 0x66, 0x7B, 0xF0, 0x0D, 0xBB, 0xF0, 0xCF, 0x48, 0x66, 0x5C,
-    0x70, 0x4A, 0xDB, 0xE0, 0x18, 0xE0, 0x78, 0x30, 0xB3, 0xC1, 0xB1, 0xE5, 0xFF, 0xF1, 0x80, 0x85,
-    0xC7, 0xF2, 0x5A, 0xA2, 0x7D, 0x4E, 0xDF, 0x81, 0xCB, 0x98, 0x7B, 0xC9, 0x73, 0xD1, 0x41, 0x26,
-    0xC9, 0xF5, 0x13, 0xB3, 0x76, 0x9D, 0x42, 0x30, 0x3B, 0x9B, 0xAB, 0x11, 0xD1, 0x11, 0x45, 0xF8,
-    0x6D, 0xAB, 0xF4, 0x04, 0x4C, 0x4E, 0x68, 0xA4, 0xE3, 0x0E, 0xEA, 0xC4, 0x58, 0x7B, 0xA0, 0xA2,
-    0xD9, 0xCF, 0x0D, 0x2B, 0x96, 0x0D, 0xA2, 0x32, 0xAD, 0x4C, 0x76, 0x95, 0x6F, 0xFC, 0x17, 0x73,
-    0xBB, 0x81, 0x64, 0xB6, 0xEA, 0x18, 0x3C, 0xC5, 0x8A, 0x4F, 0x55, 0x22, 0x2A, 0x6F, 0x44, 0x67,
-    0xC8, 0x18, 0x72, 0x10, 0x69, 0xA4, 0x27, 0x30, 0x37, 0x09, 0x6D, 0xEE, 0x33, 0xF3, 0xFE, 0x3B,
-    0x67, 0xD9, 0x65, 0xD0, 0x83, 0xF5, 0xC1, 0xFD, 0xC0, 0xE1, 0xA4, 0xF9, 0xF0, 0xA1, 0xF5, 0xD6,
-    0x4D, 0xE8, 0x78, 0x94, 0x21, 0x67, 0xEA, 0xC7, 0x4C, 0x3D, 0xE8, 0x20, 0xA4, 0x7E, 0x1F, 0xAA,
-    0x97, 0x79, 0xD1, 0x98, 0x4F, 0xDF, 0x54, 0xF7, 0x67, 0xD6, 0xD3, 0x28, 0x9B, 0x50, 0xBF, 0x04,
-    0x62, 0x51, 0x83, 0x75, 0x32, 0x44, 0x92, 0x5D, 0x3A, 0xE6, 0xF2, 0x29, 0x6E, 0x5B, 0x6B, 0x1D,
-    0x60, 0xB7, 0x40, 0xCB, 0x4E, 0xE0, 0x20, 0xD9, 0x26, 0x79, 0x4A, 0x5A, 0xFF, 0x6C, 0xA9, 0x70,
-    0x40, 0xE2, 0xCB, 0x2A, 0x61, 0x2D, 0x8F, 0x02, 0x8A, 0xAC, 0xEB, 0xED, 0x61, 0x0F, 0x29, 0x08,
-    0xED, 0x8B, 0x2D, 0xBC, 0xC5, 0x04, 0x68, 0x2F, 0xA6, 0x78, 0xED, 0x01, 0x55, 0xAE, 0xCD, 0x1F,
-    0x1E, 0x41, 0xCB, 0x1D, 0x17, 0xED, 0x8C, 0x2A, 0x66, 0x36, 0xDC, 0x17, 0x3B, 0x2A, 0x8B, 0xAA,
-    0xB8, 0x35, 0xAF, 0x93, 0x7A, 0xD1, 0xC7, 0x16, 0x57, 0x36, 0x08, 0x78, 0x08, 0x27, 0x7F, 0x92,
-    0xD1, 0x12, 0xCE, 0x5E, 0x0A, 0x16, 0x29, 0xC5, 0xB4, 0x0C, 0x7B, 0x92, 0xE9, 0x2F, 0x6D, 0xEE,
-    0x34, 0x2C, 0x91, 0x99, 0xBC, 0xFF, 0xD9, 0xB5, 0x82, 0x55, 0x40, 0x3F, 0x66, 0xB1, 0x31, 0x98,
-    0x02, 0xE5, 0x4E, 0xE5, 0x9D, 0xBA, 0x42, 0xE5, 0x34, 0xEF, 0xB7, 0x64, 0x79, 0x7D, 0x09, 0x13,
-    0x5B, 0x30, 0xFB, 0x0B, 0x2C, 0x25, 0x39, 0xAB, 0x4B, 0x46, 0x10, 0xDC, 0x17, 0x61, 0xE3, 0x5B,
-    0x79, 0x2C, 0x10, 0xC9, 0x63, 0xEE, 0x44, 0x89, 0x1B, 0xFE, 0x04, 0xA4, 0x95, 0xFA, 0x43, 0x1D,
-    0xB8, 0xEF, 0xFF, 0xE0, 0xB8, 0x2A, 0x79, 0xA3, 0x73, 0x3D, 0x86, 0x7B, 0x8F, 0xE7, 0xA8, 0xD1,
-    0x35, 0xC3, 0x66, 0x8F, 0x7E, 0xCB, 0x06, 0xF7, 0xD5, 0x9E, 0xF8, 0xD7, 0x17, 0x8B, 0xC5, 0xD9,
-    0xC3, 0xDB, 0x4F, 0x6C, 0xBC, 0x22, 0x21, 0xFE, 0xF2, 0x86, 0x04, 0xD4, 0xF7, 0x51, 0x54, 0x7F,
-    0x0A, 0xD6, 0xBF, 0x63, 0xB9, 0xEF, 0x38, 0xB2, 0xCE, 0x17, 0xB1, 0x76, 0x60, 0xF3, 0x12, 0x6C,
-    0xEA, 0x01, 0xFD, 0x7E, 0x56, 0x8D, 0x26, 0x7D, 0x0A, 0x46, 0x2D, 0x6A, 0xB2, 0x17, 0x47, 0x6E,
-    0xD5, 0x48, 0xEA, 0x7D, 0x36, 0x09, 0xD2, 0x65, 0x30, 0xC4, 0x37, 0x10, 0x2A, 0x2C, 0x59, 0xF0,
-    0x6A, 0x23, 0xED, 0x7E, 0xC9, 0xF8, 0x0B, 0x1C, 0xD8, 0xE4, 0xA4, 0x73, 0xE5, 0xF1, 0x13, 0xA2,
-    0x71, 0xBE, 0xBD, 0xD1, 0x76, 0xF9, 0x86, 0x59, 0xEF, 0xAF, 0x70, 0xDA, 0xAF, 0x86, 0xE5, 0x2A,
-    0x3B, 0x74, 0x70, 0xAE, 0xB6, 0xA2, 0x7B, 0xCD, 0xD1, 0xE4, 0xFF, 0x31, 0x7D, 0x97, 0x7E, 0x54,
-    0xD0, 0x44, 0xB6, 0x61, 0xD3, 0xE5, 0xD1, 0xDE, 0x6C, 0xBF, 0x17, 0x9B, 0xB5, 0x7A, 0xB0, 0xE4,
-    0x5D, 0xE0, 0x8B, 0xBB, 0x81, 0x7C, 0xA6, 0x61, 0x0C, 0x83, 0x9C, 0x7A, 0xDA, 0xB1, 0x07, 0x6C,
-    0x2E, 0xFE, 0x92, 0x5D, 0x4A, 0x5B, 0xB3, 0x4E, 0xF2, 0x55, 0xB3, 0xB5, 0x61, 0x2C, 0x94, 0x42,
-    0xBA, 0x9D, 0xD5, 0xAB, 0xC2, 0xA9, 0x2B, 0x4A, 0x94, 0xCB, 0xC3, 0xBD, 0x49, 0x6E, 0x97, 0x7D,
-    0x9C, 0xFF, 0x2E, 0xA3, 0x93, 0x1F, 0x16, 0x47, 0x7C, 0x79, 0x45, 0xCF, 0x6D, 0x0A, 0x9A, 0xA4,
-    0x05, 0xA5, 0xC2, 0xF5, 0x42, 0xFB, 0xD2, 0x32, 0xFD, 0xD2, 0x64, 0xFB, 0xB6, 0xDD, 0xA8, 0xDB,
-    0x2F, 0xD0, 0x25, 0x23, 0x82, 0x07, 0x2E, 0x29, 0xD1, 0xA9, 0xBD, 0x9D, 0xC6, 0x1C, 0x7F, 0xEF,
-    0x1E, 0x65, 0xFE, 0x05, 0x46, 0xE6, 0xD0, 0x61, 0x8D, 0x85, 0xB8, 0x30, 0x2F, 0x2A, 0x0F, 0x4A,
-    0xFB, 0x26, 0x05, 0xF8, 0x65, 0x4B, 0x83, 0xF3, 0x39, 0x38, 0x69, 0xEF, 0x59, 0x73, 0xEF, 0x9A,
-    0x29, 0x4A, 0xF5, 0x7C, 0xB7, 0x9B, 0xAE, 0xA4, 0x29, 0xC5, 0x0C, 0x71, 0x73, 0xE7, 0x3D, 0x75,
-    0xE6, 0xEB, 0x4B, 0xF3, 0x08, 0x74, 0x01, 0xD4, 0x47, 0x00, 0xDB, 0xB3, 0xA7, 0xF3, 0x29, 0x04,
-    0x39, 0xEF, 0xC7, 0x33, 0x3A, 0xEA, 0xF7, 0xBA, 0x6B, 0x25, 0x14, 0x59, 0xAD, 0x3E, 0x8D, 0xFD,
-    0xBE, 0x9D, 0xCE, 0xB0, 0xB3, 0x6E, 0xA9, 0xEB, 0x5D, 0xAA, 0x7D, 0x90, 0xDE, 0x46, 0x06, 0xFF,
-    0x03, 0x29, 0x42, 0x7B, 0xB8, 0xC5, 0xC9, 0x6D, 0x2B, 0x6A, 0xD6, 0x3F, 0x0B, 0x53, 0xC5, 0xE2,
-    0x96, 0x6D, 0xC9, 0xEB, 0x72, 0xDB, 0x99, 0xAD, 0xC5, 0x42, 0xFB, 0x91, 0xFF, 0x03, 0xF3, 0xEF,
-    0x4C, 0xEE, 0x47, 0x6B, 0xAC, 0x03, 0x16, 0x4C, 0xBE, 0x02, 0x95, 0xA4, 0xF5, 0xCB, 0x14, 0xE6,
-    0x2E, 0x59, 0xC5, 0xA2, 0x50, 0xA9, 0xD2, 0xDB, 0xA4, 0xFE, 0xF1, 0xC0, 0x85, 0xC3, 0x96, 0xDB,
-    0xEC, 0xE3, 0x86, 0xD2, 0x90, 0xE8, 0xE7, 0x8A, 0x59, 0x71, 0xD8, 0x20, 0x50, 0x4D, 0xD8, 0xF9,
-    0x6F, 0x57, 0x32, 0x77, 0x81, 0xD9, 0x78, 0xB8, 0x6F, 0x44, 0xDB, 0xA5, 0xB8, 0x8B, 0xD7, 0x7B,
-    0xD4, 0xC5, 0x50, 0xA3, 0xCA, 0x17, 0xD5, 0x61, 0x9D, 0x50, 0x0E, 0x29, 0x1D, 0xD6, 0x5B, 0xF4,
-    0x22, 0x57, 0x68, 0x2E, 0x0F, 0x77, 0x01, 0xBB, 0x4A, 0x63, 0x7A, 0xFB, 0x6D, 0x36, 0xA7, 0xD3,
-    0xAB, 0x6C, 0xF7, 0x94, 0xCC, 0x70, 0x7D, 0xFB, 0xAB, 0xC4, 0xAA, 0x03, 0x32, 0x28, 0x24, 0x55,
-    0xE9, 0x30, 0x69, 0x7D, 0xED, 0x63, 0xE0, 0x24, 0x96, 0x93, 0x40, 0xB0, 0x4B, 0x42, 0x77, 0x78,
-    0x7B, 0xE2, 0x6D, 0xC0, 0x5F, 0xF2, 0x86, 0xAF, 0x48, 0x08, 0xB7, 0x61, 0x2B, 0xD3, 0xE9, 0xBC,
-    0x55, 0xAF, 0x8B, 0xBE, 0x0A, 0xB9, 0x27, 0x6E, 0xDF, 0x73, 0x34, 0x24, 0x6B, 0x00, 0x43, 0x21,
-    0xA8, 0xAE, 0x9B, 0xBF, 0xB7, 0xB7, 0x51, 0x03, 0x9D, 0xF8, 0x42, 0x38, 0xD0, 0xC4, 0x25, 0x2D,
-    0x7B, 0x08, 0xF0, 0x94, 0xD5, 0x9D, 0x64, 0x70, 0xB1, 0xC8, 0xEF, 0x5D, 0xFC, 0xB5, 0x22, 0xA7,
-    0xEF, 0xD8, 0xCE, 0x2B, 0xFB, 0x50, 0x1B, 0x0C, 0xA3, 0x8E, 0x31, 0x07, 0x77, 0x1B, 0x34, 0x73,
-    0x10, 0x5F, 0xE4, 0xB4, 0x37, 0x96, 0x31, 0x0A, 0x40, 0xD1, 0x26, 0x73, 0x55, 0x4D, 0x5B, 0xB2,
-    0x31, 0xA9, 0xD8, 0xCC, 0xCB, 0x9E, 0x92, 0xBE, 0x6A, 0x8F, 0x88, 0x6A, 0xA5, 0xFA, 0x71, 0xCA,
-    0xCC, 0x35, 0x57, 0xDC, 0x57, 0xE4, 0xE0, 0x10, 0x72, 0x0E, 0x45, 0x90, 0xB9, 0xFD, 0x6E, 0xAC,
-    0xDF, 0x6C, 0xED, 0xB8, 0x8E, 0x9A, 0xF2, 0x3D, 0xBD, 0x57, 0x0A, 0xB3, 0xFF, 0x01, 0xDD, 0x5C,
-    0x3F, 0xAC, 0x1D, 0xD5, 0x99, 0x3F, 0x33, 0xC3, 0x7B, 0xD7, 0x64, 0xB4, 0x0C, 0x85, 0x1D, 0x12,
-    0x5B, 0x61, 0x28, 0x28, 0x56, 0xDA, 0x84, 0x69, 0x52, 0xA4, 0x20, 0x9E, 0x01, 0xA4, 0xA5, 0xA0,
-    0xC8, 0x5B, 0xC9, 0x8F, 0x55, 0x70, 0x41, 0x8A, 0x14, 0x21, 0x48, 0x79, 0x4D, 0x8A, 0x14, 0x90,
-    0x19, 0x44, 0x41, 0xC9, 0x5B, 0xC9, 0x6C, 0xBB, 0x14, 0x44, 0x5A, 0x9E, 0xB5, 0x71, 0x0A, 0x0A,
-    0x56, 0x32, 0x9E, 0xC1, 0x68, 0x95, 0xC2, 0x85, 0x27, 0x61, 0xA5, 0x14, 0x29, 0xB8, 0xD9, 0x98,
-    0x5D, 0x61, 0x0A, 0x06, 0x7C, 0x49, 0xE6, 0x3D, 0x66, 0xE6, 0xEC, 0xF7, 0xFB, 0x7D, 0x67, 0xEE,
-    0xBD, 0xEF, 0xF9, 0x19, 0xFC, 0x97, 0xD8, 0x3C, 0xD9, 0x77, 0xEE, 0xB9, 0xF7, 0xCE, 0x99, 0xEF,
-    0x7C, 0xFF, 0xFF, 0x9D, 0x63, 0x4C, 0x69, 0x07, 0x63, 0x8C, 0x67, 0xC7, 0x4B, 0x2F, 0x17, 0xB3,
-    0xBE, 0x7E, 0xCC, 0x5C, 0xF1, 0x6F, 0x55, 0x2F, 0x79, 0xC1, 0x8B, 0xAD, 0x0C, 0x6F, 0xAC, 0x71,
-    0x09, 0xEC, 0x54, 0x2F, 0x0D, 0x2E, 0xE1, 0x1F, 0x66, 0xB8, 0x44, 0xEF, 0x74, 0xB8, 0xC4, 0x2F,
-    0xF2, 0x92, 0x7A, 0x7C, 0x42, 0x6E, 0x2C, 0x2E, 0x6F, 0xE9, 0xA5, 0xE3, 0x6C, 0x7E, 0x6B, 0x52,
-    0x99, 0x2D, 0x98, 0x99, 0x44, 0x66, 0x9B, 0x34, 0x26, 0x96, 0xD9, 0x22, 0x6B, 0x31, 0x1B, 0x2E,
-    0x32, 0x5B, 0x72, 0x71, 0xEB, 0xA4, 0x4C, 0x93, 0x66, 0x26, 0xE8, 0x30, 0x89, 0xF1, 0x05, 0xEC,
-    0x01, 0xCF, 0x37, 0x1E, 0xA6, 0xB7, 0x99, 0x8F, 0x4B, 0x59, 0x4C, 0xFA, 0xCC, 0xF8, 0xF6, 0x42,
-    0x29, 0xF7, 0xA6, 0x96, 0x53, 0xE4, 0x96, 0x8F, 0x12, 0xE0, 0x6C, 0x87, 0x97, 0xD6, 0x4C, 0x38,
-    0xE5, 0x7E, 0x7F, 0xA1, 0x15, 0x70, 0xF0, 0xED, 0x64, 0x38, 0xD5, 0x99, 0xA8, 0xF1, 0x7B, 0x13,
-    0xD7, 0xF2, 0x9C, 0xA8, 0x92, 0x97, 0xD5, 0x42, 0x81, 0x1E, 0x5F, 0x56, 0x4B, 0x79, 0x78, 0x29,
-    0xB3, 0x87, 0x76, 0xC7, 0x9A, 0x78, 0x26, 0x9F, 0xC9, 0x32, 0xE4, 0xA5, 0x98, 0xBF, 0xAB, 0x03,
-    0x6B, 0x92, 0xED, 0x0D, 0x7B, 0x51, 0x96, 0x91, 0x0E, 0x81, 0x9D, 0xC9, 0xAF, 0x7E, 0x98, 0x79,
-    0x72, 0xFF, 0x9A, 0xB9, 0x0B, 0xE8, 0x6B, 0xCC, 0x3D, 0x72, 0x91, 0xC7, 0x1C, 0xE5, 0xA4, 0x17,
-    0x89, 0xAA, 0x5C, 0xC1, 0x3B, 0xA2, 0x28, 0x36, 0xC7, 0xBE, 0x82, 0xC4, 0xF0, 0x2B, 0xF3, 0x20,
-    0x26, 0xFF, 0x85, 0x09, 0x7A, 0x7F, 0x26, 0x3F, 0xC2, 0xF4, 0x25, 0x96, 0x11, 0x6E, 0xFF, 0x2D,
-    0xC9, 0x72, 0xA7, 0xE3, 0x35, 0xCF, 0x88, 0xDD, 0x96, 0x83, 0x49, 0xA3, 0xD8, 0xD3, 0x4B, 0x34,
-    0x73, 0xB8, 0x9C, 0xE9, 0x2A, 0x74, 0x58, 0xD6, 0x5F, 0x26, 0x8A, 0x23, 0xE0, 0x33, 0x55, 0xDC,
-    0xC8, 0x1F, 0x91, 0x35, 0x70, 0xD2, 0x0F, 0x00, 0x3C, 0xDE, 0x86, 0xED, 0x82, 0xEC, 0x5C, 0x04,
-    0xE0, 0xF4, 0x01, 0x9D, 0x47, 0xC4, 0x97, 0xED, 0x7C, 0x2D, 0x9B, 0x7B, 0x65, 0xE2, 0xCC, 0x09,
-    0x2C, 0x44, 0x16, 0x21, 0x2F, 0xB6, 0xF0, 0xED, 0x2B, 0x1B, 0xAD, 0x29, 0x2B, 0x01, 0x4B, 0x70,
-    0xED, 0xB7, 0x40, 0x6A, 0x5C, 0x94, 0x82, 0xA1, 0x59, 0x24, 0x33, 0xDD, 0xED, 0xF1, 0xC9, 0xA0,
-    0x06, 0xF1, 0x6D, 0x48, 0x9F, 0x2B, 0xBD, 0x25, 0xA8, 0xE9, 0x94, 0xB0, 0x90, 0xE0, 0x04, 0x93,
-    0x8C, 0x31, 0x01, 0x70, 0x26, 0xB1, 0x9B, 0xE6, 0x67, 0xC2, 0xC2, 0xD6, 0xD6, 0xA2, 0x4D, 0x45,
-    0xD5, 0xF8, 0xAA, 0x53, 0x9F, 0x3A, 0x31, 0x82, 0xF7, 0x5D, 0xFC, 0x4A, 0x9E, 0x4E, 0xC2, 0xCF,
-    0xF4, 0x3F, 0x56, 0x17, 0x60, 0x31, 0x7B, 0x15, 0x92, 0x2F, 0xCC, 0x26, 0xAB, 0xC8, 0x04, 0x7D,
-    0x4D, 0xD4, 0x04, 0x83, 0x40, 0x9C, 0xBE, 0x34, 0x33, 0xD1, 0xEF, 0x65, 0xE2, 0x4D, 0x00, 0x9E,
-    0x62, 0xA6, 0x5A, 0x67, 0xE0, 0x4A, 0xC0, 0x64, 0x58, 0x17, 0x41, 0x05, 0x59, 0xA3, 0xC1, 0x78,
-    0x8F, 0xDA, 0xA1, 0x6C, 0x12, 0x51, 0x7A, 0x42, 0xAE, 0x99, 0xF1, 0x9E, 0x01, 0x7B, 0x78, 0x6F,
-    0x72, 0x2D, 0x40, 0x66, 0x04, 0x06, 0xF7, 0x7B, 0xAC, 0xA8, 0xC4, 0x6A, 0x93, 0x2A, 0xAA, 0x8D,
-    0xDF, 0x98, 0xEF, 0xEF, 0x06, 0xE6, 0xD9, 0x0F, 0x32, 0x48, 0xA7, 0xCD, 0xF0, 0xD2, 0x0A, 0x5D,
-    0x9F, 0xB4, 0x45, 0x28, 0xCA, 0xB4, 0xC5, 0x83, 0x93, 0x42, 0x30, 0xE4, 0xB5, 0x21, 0x56, 0x94,
-    0x61, 0xA6, 0xCD, 0x78, 0xAA, 0x3A, 0xED, 0x0B, 0x50, 0xAA, 0x6F, 0x89, 0x7E, 0xA5, 0x44, 0x43,
-    0x59, 0x03, 0x32, 0x23, 0x15, 0xA3, 0x96, 0x88, 0xD8, 0x36, 0xAB, 0x53, 0x10, 0x54, 0x38, 0x52,
-    0x5E, 0x2B, 0xC1, 0x34, 0xD0, 0xBE, 0xF2, 0x3A, 0xD6, 0x72, 0x97, 0x9B, 0x2D, 0x91, 0x9F, 0xC6,
-    0x02, 0x5F, 0xF4, 0xC7, 0xC6, 0x84, 0x53, 0x2B, 0xAC, 0x1F, 0xD5, 0x41, 0x63, 0x5A, 0xF3, 0x23,
-    0x73, 0x70, 0xB7, 0x1E, 0x49, 0x64, 0x1E, 0x11, 0x9A, 0x2A, 0xAD, 0xA2, 0x56, 0xEE, 0x1C, 0x04,
-    0x87, 0xE9, 0x13, 0x8D, 0xF9, 0xDA, 0x63, 0xAD, 0x63, 0xC8, 0x7C, 0x44, 0x6C, 0xEB, 0x10, 0x8B,
-    0xF9, 0x41, 0x2B, 0x5F, 0xE6, 0x37, 0x69, 0x6B, 0x56, 0xC0, 0xF5, 0x95, 0x60, 0x62, 0xBA, 0x0A,
-    0x48, 0x56, 0x7E, 0x65, 0xA8, 0xCF, 0xC7, 0xC5, 0x4C, 0xB8, 0x98, 0x12, 0x38, 0x98, 0x70, 0x19,
-    0x87, 0xB3, 0xFD, 0x14, 0xF8, 0xED, 0x8B, 0xD3, 0x9F, 0xE0, 0x67, 0x95, 0x72, 0x48, 0xD4, 0x39,
-    0x24, 0x5C, 0xF6, 0x27, 0x72, 0x28, 0x1C, 0x5E, 0xC3, 0xAA, 0xCA, 0x53, 0xAD, 0xE8, 0xBF, 0xE8,
-    0x4F, 0xBD, 0xF0, 0x72, 0x69, 0xCC, 0x6B, 0x29, 0x58, 0x71, 0xE4, 0xCD, 0xDE, 0xF1, 0x26, 0x56,
-    0x10, 0xA8, 0x1A, 0x13, 0xB8, 0xC0, 0xF7, 0x02, 0xD6, 0x5A, 0x69, 0x4F, 0x75, 0x21, 0x9C, 0x90,
-    0x0D, 0x48, 0xCB, 0x53, 0x6B, 0xE3, 0xF4, 0xA7, 0x85, 0x8C, 0xA2, 0xB9, 0xA0, 0xF0, 0xD2, 0xAA,
-    0xC4, 0x5D, 0x1B, 0xF5, 0xA8, 0xB5, 0x74, 0x25, 0x49, 0x76, 0x87, 0x48, 0xFF, 0x9A, 0xF9, 0x7B,
-    0x51, 0x77, 0x49, 0x11, 0x57, 0x49, 0xE5, 0x77, 0xB1, 0x40, 0x74, 0xBE, 0x56, 0x63, 0x92, 0x37,
-    0x73, 0x25, 0xFD, 0xA5, 0x30, 0x29, 0x15, 0xFF, 0x94, 0x98, 0x4B, 0x0B, 0x60, 0xC1, 0x1B, 0xB8,
-    0xCA, 0x49, 0xAF, 0xAB, 0x52, 0x73, 0x97, 0x2B, 0x44, 0xDD, 0x5E, 0x8A, 0x7B, 0x4F, 0x95, 0xAF,
-    0x63, 0xBD, 0x16, 0x4C, 0x9B, 0xEB, 0x25, 0x6E, 0x56, 0xCA, 0x81, 0x36, 0x41, 0x18, 0x0B, 0x33,
-    0x0A, 0xDF, 0x5B, 0x62, 0x09, 0x83, 0xA8, 0xA5, 0xC9, 0x28, 0x2B, 0xEA, 0xA5, 0x8E, 0x83, 0xB4,
-    0xC6, 0x40, 0x2C, 0x1B, 0x06, 0xC9, 0xF4, 0x4A, 0x03, 0xFD, 0x99, 0xBB, 0x27, 0xE7, 0x04, 0x21,
-    0xEC, 0x0C, 0x8C, 0x21, 0x06, 0xC2, 0xE3, 0x32, 0x10, 0xA3, 0x22, 0x83, 0x58, 0x2C, 0x94, 0xBD,
-    0x28, 0xE0, 0x04, 0x73, 0xD8, 0x86, 0x5D, 0xCC, 0x41, 0xAE, 0x9A, 0xD8, 0xEC, 0x34, 0x39, 0x08,
-    0x9C, 0x99, 0xD8, 0xAC, 0xA7, 0x71, 0xA1, 0x45, 0xCA, 0xB3, 0x4E, 0x07, 0xB8, 0x2B, 0x7F, 0xA4,
-    0xE1, 0xE0, 0x7E, 0xB5, 0xA7, 0x85, 0xCC, 0x6D, 0xC9, 0xAD, 0x98, 0xDA, 0x53, 0x4B, 0x9D, 0x4E,
-    0x3D, 0xE1, 0x24, 0xC1, 0xB7, 0x70, 0x38, 0xD0, 0x2F, 0xE4, 0x48, 0x2A, 0x0C, 0x68, 0xB8, 0x33,
-    0x18, 0x42, 0x19, 0x80, 0x38, 0x32, 0xC8, 0x2F, 0x1F, 0x8C, 0x3F, 0xAB, 0x31, 0x00, 0x4B, 0xC9,
-    0x6C, 0xC2, 0x53, 0xA9, 0x4C, 0x5D, 0xEE, 0x94, 0xF6, 0x7D, 0x3C, 0xED, 0xAF, 0xE4, 0xE4, 0x36,
-    0x91, 0x6F, 0x57, 0x4E, 0xC0, 0x09, 0xBC, 0xB9, 0xF8, 0x5F, 0xB7, 0xEB, 0x6B, 0x26, 0xF9, 0x08,
-    0xB3, 0xF8, 0x03, 0x57, 0x75, 0x6B, 0xF1, 0xAF, 0x4E, 0x54, 0x0A, 0xF6, 0x34, 0xCF, 0xF6, 0x73,
-    0xCB, 0x4E, 0x2E, 0x36, 0x8C, 0x42, 0x26, 0xD0, 0x83, 0x66, 0xE5, 0xF8, 0xF6, 0xDA, 0xF8, 0xF1,
-    0x5A, 0x9E, 0x39, 0x41, 0xCA, 0x55, 0xAE, 0x4F, 0xCA, 0x24, 0x79, 0x2D, 0xD8, 0x12, 0xC0, 0x3C,
-    0x7A, 0x28, 0x13, 0x02, 0x15, 0xD7, 0x01, 0xD1, 0x2B, 0x92, 0x2E, 0x1F, 0x13, 0xC7, 0x20, 0x4B,
-    0x5C, 0x2B, 0xD6, 0xE3, 0x06, 0x1F, 0xA7, 0xA4, 0x10, 0xA4, 0x4B, 0x64, 0xB4, 0x08, 0x00, 0xAE,
-    0x00, 0x7D, 0x42, 0x51, 0xED, 0xDB, 0x21, 0x14, 0xF6, 0xFF, 0x61, 0xB6, 0x02, 0xC9, 0x82, 0x4A,
-    0x64, 0xBC, 0x00, 0x29, 0x2C, 0x8C, 0xB7, 0xBE, 0xBE, 0x76, 0x99, 0x02, 0x94, 0x0F, 0xE5, 0x63,
-    0xD2, 0xE1, 0x25, 0xBC, 0xB4, 0x9E, 0xDD, 0xDA, 0x2A, 0x21, 0x56, 0x1E, 0xD1, 0x1E, 0x51, 0xC2,
-    0x08, 0xDE, 0x0A, 0x51, 0xE6, 0xFC, 0xA7, 0xE5, 0xB7, 0x3B, 0x40, 0x17, 0x91, 0x0F, 0x17, 0x70,
-    0x9F, 0x1F, 0x8C, 0x6F, 0xBD, 0x0C, 0x6F, 0xBF, 0x8F, 0xB7, 0x13, 0x52, 0x86, 0xBE, 0x65, 0x54,
-    0x6F, 0x40, 0xD9, 0xD0, 0x07, 0xFC, 0x2D, 0x61, 0x50, 0x4F, 0x4F, 0xA4, 0x9E, 0x11, 0x5D, 0x62,
-    0x5D, 0x08, 0xB1, 0x57, 0xC3, 0x6C, 0x02, 0xD9, 0xA2, 0x22, 0x4F, 0x0E, 0x82, 0x9D, 0x68, 0x16,
-    0x4D, 0x4D, 0xFA, 0x82, 0xD8, 0x9E, 0x4E, 0xF8, 0x36, 0x79, 0xA7, 0x15, 0x6F, 0x33, 0x77, 0x33,
-    0x76, 0xF9, 0xD6, 0xD6, 0xD6, 0x4B, 0x33, 0xA7, 0x71, 0x80, 0x64, 0x6A, 0x1A, 0x6A, 0xC1, 0xB8,
-    0x17, 0xB0, 0x4A, 0x7B, 0xB2, 0xF5, 0x41, 0xF5, 0x09, 0xD4, 0x0C, 0x1D, 0x8C, 0x03, 0xC6, 0x64,
-    0x50, 0x33, 0xDF, 0x86, 0x96, 0x09, 0x81, 0xC8, 0x93, 0x2D, 0x81, 0xA2, 0x9E, 0x04, 0xFD, 0x0F,
-    0xDD, 0x29, 0x88, 0x34, 0xA6, 0x12, 0x5F, 0xFA, 0x3B, 0x26, 0xBE, 0x20, 0x6A, 0x1B, 0x9F, 0x06,
-    0x60, 0xD4, 0xD5, 0xE1, 0x4B, 0xC6, 0xA8, 0xAC, 0x7B, 0x6E, 0x90, 0x72, 0x58, 0xA1, 0x90, 0x10,
-    0xE4, 0x90, 0x11, 0xEF, 0x35, 0x73, 0xA7, 0xB0, 0xE6, 0x4F, 0x9C, 0x43, 0x12, 0x58, 0xE7, 0x7F,
-    0x6A, 0xB4, 0x74, 0xB9, 0x6B, 0xB1, 0x0D, 0x81, 0x17, 0x9F, 0x68, 0xA7, 0x9C, 0x42, 0x62, 0xB3,
-    0x41, 0xF0, 0x04, 0xBB, 0x29, 0x88, 0xF4, 0x81, 0xD1, 0x58, 0x11, 0x89, 0xA9, 0x77, 0xB6, 0xB6,
-    0xFE, 0x1D, 0x88, 0xA4, 0x32, 0x81, 0xDF, 0x41, 0x2C, 0xE1, 0x29, 0x50, 0x38, 0x07, 0xC5, 0x0A,
-    0x96, 0x45, 0x82, 0x55, 0xE4, 0x50, 0x23, 0x5F, 0x3F, 0x61, 0x0E, 0x01, 0x37, 0x54, 0xA2, 0x2D,
-    0x11, 0x54, 0xC4, 0x3B, 0x5B, 0x27, 0x89, 0x95, 0x98, 0x58, 0x51, 0x04, 0x71, 0x4D, 0x6B, 0x57,
-    0x5A, 0xF4, 0x29, 0x87, 0x15, 0x22, 0xA8, 0xB9, 0x12, 0x06, 0xE5, 0xED, 0x41, 0xBC, 0x0D, 0x88,
-    0x95, 0xE7, 0xF1, 0x36, 0xE4, 0xDB, 0x7E, 0x15, 0x0F, 0x7E, 0xC7, 0x8E, 0x8B, 0xA0, 0x07, 0xF1,
-    0x4B, 0xE3, 0x9C, 0x7A, 0x38, 0x3E, 0x63, 0x58, 0xE4, 0xA6, 0xB3, 0x34, 0x5F, 0x78, 0x3F, 0x8F,
-    0x8E, 0x6F, 0x21, 0x8E, 0xE0, 0x6D, 0xC1, 0x2C, 0xFA, 0x33, 0x17, 0xAC, 0x29, 0x93, 0xEE, 0xC0,
-    0xFA, 0xB5, 0x1A, 0x94, 0x2A, 0xD3, 0x57, 0xE6, 0x8C, 0x00, 0x02, 0xCB, 0x17, 0x74, 0x08, 0x32,
-    0xA3, 0xBF, 0x74, 0x54, 0xF1, 0x73, 0xDF, 0x28, 0xD8, 0x1D, 0xD5, 0xDC, 0x9E, 0xA8, 0x87, 0x7B,
-    0x96, 0x08, 0xBF, 0x7A, 0x9D, 0x0F, 0x13, 0x2A, 0x61, 0x77, 0xFA, 0xB2, 0x38, 0xDF, 0x30, 0xF3,
-    0x74, 0xE5, 0xE3, 0xEA, 0x4B, 0xE5, 0x4F, 0xF9, 0xFB, 0x99, 0x99, 0x07, 0x68, 0x0E, 0x9B, 0xE9,
-    0x7B, 0x18, 0x24, 0x15, 0x55, 0x28, 0x62, 0x34, 0x20, 0xBF, 0xB9, 0x2C, 0xA4, 0xD8, 0x59, 0x53,
-    0xFF, 0xA0, 0x70, 0x89, 0x85, 0x78, 0x58, 0x3F, 0xDE, 0xD1, 0x59, 0x2D, 0xC5, 0x53, 0xC0, 0x52,
-    0x68, 0xD4, 0xA7, 0x21, 0x23, 0x4E, 0x42, 0x72, 0xD0, 0x79, 0xF7, 0x65, 0x36, 0xF7, 0x76, 0x1D,
-    0x26, 0x55, 0xDD, 0x50, 0x47, 0xAC, 0xAF, 0xCB, 0x17, 0xE2, 0x55, 0x9F, 0x6F, 0x60, 0x8E, 0xDF,
-    0x15, 0x40, 0xBD, 0x8D, 0x29, 0xB8, 0x76, 0x32, 0xE3, 0x4A, 0xFA, 0x89, 0xFA, 0xA4, 0x20, 0x7A,
-    0x5C, 0x8B, 0x16, 0x93, 0x2F, 0x7C, 0x59, 0x93, 0x0F, 0x13, 0x34, 0x94, 0x36, 0x83, 0xDB, 0x24,
-    0x5F, 0x2A, 0x6C, 0x66, 0xE5, 0x19, 0x5A, 0x53, 0x6F, 0xF1, 0x14, 0x66, 0x56, 0x10, 0xBF, 0x99,
-    0x80, 0x3C, 0x74, 0x26, 0x22, 0xB4, 0xC8, 0x84, 0x20, 0x88, 0x33, 0xDF, 0x50, 0x0D, 0xB8, 0xF8,
-    0x4B, 0x86, 0xE3, 0x34, 0x6F, 0x76, 0x1A, 0x0E, 0xA7, 0x86, 0x1E, 0xBE, 0xC0, 0x14, 0x31, 0x53,
-    0x09, 0x9E, 0x13, 0x5C, 0xCB, 0x9D, 0x69, 0x26, 0x6F, 0xE5, 0x9F, 0x20, 0x3D, 0x07, 0x24, 0x32,
-    0x65, 0xB4, 0x7D, 0x5C, 0x7D, 0x89, 0x0C, 0x08, 0x12, 0xBB, 0xDE, 0x1E, 0x1A, 0x85, 0x4E, 0x59,
-    0x55, 0x23, 0x27, 0x99, 0xF6, 0x02, 0xE3, 0xA2, 0x86, 0x70, 0x67, 0x42, 0xBF, 0x23, 0x1D, 0x1C,
-    0x92, 0x14, 0xC9, 0x9E, 0xA0, 0x05, 0x19, 0xD3, 0xC7, 0x10, 0x4F, 0x4C, 0x25, 0x8E, 0x89, 0x3B,
-    0xB0, 0xE2, 0x80, 0xDB, 0xC4, 0xEB, 0xF1, 0x4B, 0x4A, 0xE8, 0x03, 0x5C, 0xDD, 0x51, 0xE4, 0xB9,
-    0x4C, 0x34, 0xF5, 0xA9, 0xF4, 0x4E, 0x52, 0x8C, 0xE0, 0x54, 0x18, 0x5F, 0xB3, 0x2F, 0x2B, 0x97,
-    0x47, 0x86, 0x77, 0x18, 0x0D, 0x5D, 0x2E, 0xEF, 0xBB, 0xD0, 0x5F, 0xA1, 0xB8, 0x5D, 0x48, 0xE6,
-    0xC1, 0x67, 0xA2, 0xD6, 0x42, 0xCE, 0xA6, 0xDC, 0xDC, 0x47, 0xC1, 0xFB, 0xF6, 0xFD, 0xB2, 0xF6,
-    0x89, 0xB5, 0xF2, 0xA2, 0xFD, 0xA8, 0x8E, 0x6B, 0x6F, 0x38, 0x20, 0xB0, 0x8A, 0x12, 0x11, 0x62,
-    0xE4, 0x23, 0xE1, 0x48, 0xC3, 0x16, 0x11, 0x52, 0x42, 0x6F, 0xD3, 0xBE, 0x52, 0xD6, 0x2E, 0x79,
-    0x4B, 0x7B, 0x12, 0xBF, 0xB0, 0x36, 0x27, 0x5C, 0xB6, 0x08, 0xD3, 0x40, 0x07, 0x02, 0x4B, 0x1A,
-    0xCE, 0xE0, 0xA2, 0x97, 0x6F, 0xF7, 0x40, 0x06, 0x50, 0x93, 0xBE, 0xD8, 0xE2, 0x26, 0xC4, 0xD7,
-    0x83, 0x8F, 0x55, 0x55, 0xC0, 0xF3, 0x14, 0xB7, 0x5D, 0x30, 0xE6, 0x1F, 0xAC, 0xC2, 0xAB, 0x49,
-    0x03, 0x45, 0xA5, 0x06, 0x7B, 0x6A, 0x72, 0x3D, 0xFA, 0x2F, 0x57, 0x08, 0xE9, 0xEF, 0x3C, 0xF2,
-    0x1D, 0xE6, 0xCA, 0xBA, 0x79, 0xAA, 0x33, 0xEA, 0x16, 0x49, 0xC4, 0x7D, 0xFF, 0x6E, 0x77, 0xB9,
-    0xF3, 0x4E, 0x7D, 0xA0, 0xFE, 0xFB, 0x40, 0x46, 0x90, 0x45, 0xE5, 0xDB, 0xEB, 0x1B, 0x0D, 0xBC,
-    0x26, 0xBF, 0x63, 0x56, 0x23, 0xD7, 0x50, 0xB9, 0x40, 0xE4, 0xAF, 0xE6, 0xC1, 0xAC, 0x4D, 0x48,
-    0x61, 0xCD, 0xAE, 0xA8, 0x05, 0xB9, 0x8C, 0x0C, 0x87, 0xD6, 0x8F, 0x59, 0xB8, 0xAF, 0x56, 0xC9,
-    0xF0, 0x03, 0x01, 0x7B, 0xA5, 0x7C, 0x91, 0xF6, 0xA1, 0x2E, 0x2B, 0x60, 0x3B, 0x66, 0xB2, 0x23,
-    0x00, 0x83, 0xE4, 0x59, 0x3E, 0xC3, 0x17, 0xA1, 0x20, 0x5C, 0x08, 0x5D, 0x4A, 0x28, 0xDE, 0x8F,
-    0x81, 0x9B, 0xC2, 0x66, 0x0E, 0xFD, 0x6A, 0x09, 0xC9, 0x11, 0x93, 0xB0, 0x13, 0x47, 0xED, 0x6C,
-    0x9E, 0x98, 0x70, 0xA9, 0x5B, 0xC5, 0x91, 0x4B, 0xEA, 0xBE, 0xA1, 0xA9, 0x5D, 0x80, 0xE7, 0xF1,
-    0x13, 0xA6, 0x53, 0xD5, 0x67, 0xE0, 0x02, 0x68, 0xAF, 0xD4, 0xB3, 0x8A, 0x9B, 0x39, 0x65, 0xF7,
-    0x98, 0xE2, 0x3B, 0x40, 0x04, 0x63, 0x4D, 0xC1, 0x07, 0xCE, 0xDD, 0xB0, 0x8A, 0x9D, 0xF4, 0xA3,
-    0x46, 0x09, 0xC3, 0x0C, 0xBD, 0x00, 0xCC, 0x8F, 0x8F, 0x9A, 0xA0, 0xDA, 0xC7, 0x09, 0xCE, 0x40,
-    0x36, 0x18, 0xD6, 0x90, 0x4E, 0x68, 0x21, 0x94, 0x98, 0x51, 0x82, 0x37, 0xD4, 0x73, 0xF0, 0x34,
-    0x74, 0x46, 0x6A, 0xEA, 0xDA, 0x86, 0x96, 0x88, 0x03, 0xFF, 0x01, 0xEE, 0xF9, 0xF0, 0x7A, 0xA6,
-    0xDA, 0x3D, 0xDC, 0x10, 0x2F, 0x6B, 0x62, 0x5F, 0x4B, 0x65, 0xBA, 0x09, 0x61, 0x16, 0xAC, 0xCB,
-    0xCA, 0x57, 0xC9, 0x13, 0x81, 0x63, 0x50, 0xA2, 0x3B, 0xD1, 0xEC, 0x53, 0x53, 0x32, 0x57, 0x43,
-    0xE6, 0x48, 0x85, 0xAD, 0x0D, 0x82, 0xAF, 0xE5, 0xBF, 0x83, 0x4A, 0xED, 0x6A, 0x81, 0xC3, 0x50,
-    0x07, 0x4E, 0xB9, 0xA4, 0x5F, 0x38, 0x60, 0x69, 0x20, 0xFD, 0x2D, 0x98, 0x37, 0x18, 0x5C, 0x50,
-    0xFC, 0x48, 0x89, 0x14, 0x56, 0x86, 0xA8, 0x45, 0x7E, 0x26, 0x8B, 0xC0, 0x3D, 0x3A, 0x08, 0x75,
-    0x50, 0x5E, 0xDF, 0x20, 0x17, 0x0D, 0xB0, 0x2D, 0x31, 0xD0, 0x34, 0xB2, 0x7D, 0x24, 0x58, 0x10,
-    0x11, 0x16, 0x1A, 0x82, 0x98, 0x8F, 0x03, 0x19, 0x25, 0xDC, 0xAA, 0x96, 0x99, 0x71, 0xC8, 0xDB,
-    0xAA, 0xDD, 0x8B, 0xC8, 0x2D, 0x89, 0x74, 0xB6, 0xCA, 0x9D, 0x7F, 0x23, 0x69, 0xEC, 0xE0, 0x86,
-    0x9B, 0x57, 0xC2, 0xFA, 0x1E, 0x02, 0xBA, 0xE1, 0x8D, 0xB0, 0x86, 0x0E, 0x57, 0xAD, 0x84, 0x65,
-    0xF9, 0xCE, 0x63, 0x98, 0x2E, 0x07, 0xCC, 0x3D, 0x1E, 0x52, 0xA9, 0x1B, 0xA3, 0xD4, 0x70, 0x75,
-    0xA4, 0x93, 0xDD, 0x5E, 0xAD, 0x13, 0x68, 0xF8, 0xC9, 0xA8, 0xCB, 0x1C, 0xB2, 0xEB, 0xD9, 0xB2,
-    0x3A, 0x82, 0xB8, 0x75, 0x47, 0x40, 0x7B, 0x8B, 0x24, 0xA1, 0x53, 0x72, 0x91, 0xF8, 0xD2, 0x08,
-    0x4E, 0x91, 0x9D, 0x71, 0x64, 0x50, 0xB2, 0xC8, 0x3F, 0xBF, 0x1B, 0x71, 0x0B, 0x05, 0x56, 0x39,
-    0x74, 0x7F, 0xC1, 0x17, 0x13, 0xC8, 0xEF, 0x89, 0xC4, 0xB6, 0x02, 0xCC, 0x0F, 0x94, 0x0C, 0x5F,
-    0x2B, 0x0E, 0x44, 0xFD, 0xE4, 0x9C, 0x7D, 0xF7, 0xD2, 0x8E, 0xED, 0xBA, 0x78, 0xF8, 0xBB, 0xE5,
-    0xBC, 0xF0, 0x0A, 0xE9, 0xF3, 0x27, 0x26, 0x1E, 0xB2, 0xCB, 0x58, 0xE2, 0x5A, 0x07, 0x5E, 0xB9,
-    0x2D, 0xCF, 0xFD, 0x58, 0xF1, 0x10, 0xB6, 0xC1, 0xE3, 0xF6, 0x85, 0x4B, 0x76, 0xE8, 0x24, 0x9A,
-    0x7C, 0xC8, 0xB7, 0x8F, 0x98, 0x6F, 0x2E, 0xB1, 0xF7, 0xD7, 0xDF, 0x30, 0x25, 0x72, 0xA5, 0x99,
-    0x97, 0x33, 0x19, 0x04, 0xC5, 0x27, 0x76, 0x23, 0xFE, 0x82, 0xC1, 0xC4, 0x6E, 0x8A, 0x2E, 0x87,
-    0x31, 0x12, 0x05, 0x75, 0x56, 0x03, 0xD5, 0x6A, 0x77, 0x96, 0x67, 0x7D, 0xFD, 0x98, 0x7C, 0xF7,
-    0x02, 0x29, 0x58, 0x13, 0xB0, 0xB4, 0xBA, 0xD1, 0xCB, 0x11, 0xBB, 0x29, 0xCF, 0x7C, 0x5B, 0x17,
-    0x26, 0xB3, 0x9F, 0xB7, 0xF6, 0xD2, 0x98, 0x6C, 0x98, 0xEB, 0xAD, 0x67, 0xB3, 0x10, 0x79, 0xF5,
-    0x99, 0xB9, 0xEF, 0xEA, 0xD6, 0xE2, 0x06, 0xF9, 0x36, 0xAA, 0xA8, 0x32, 0xDB, 0x01, 0x63, 0x1E,
-    0x9B, 0x9A, 0x6F, 0xA7, 0xC5, 0xE4, 0xAC, 0x3D, 0xD9, 0x45, 0x54, 0xC2, 0xC5, 0x92, 0x03, 0x7D,
-    0xCB, 0x17, 0xF6, 0x2D, 0xE3, 0x9D, 0xAF, 0xCD, 0xA5, 0x01, 0x49, 0x8F, 0x7E, 0x82, 0x1A, 0x43,
-    0x7B, 0x33, 0x29, 0x26, 0x61, 0x64, 0x6E, 0x87, 0x1C, 0x59, 0x8D, 0xCC, 0x28, 0xBF, 0x5F, 0xD7,
-    0xBF, 0x55, 0x7B, 0x41, 0xA8, 0x2E, 0x53, 0x89, 0xEF, 0xEA, 0xD3, 0xC6, 0x09, 0xFB, 0x87, 0x48,
-    0x33, 0xCE, 0x80, 0x7D, 0x66, 0x57, 0x44, 0x3A, 0x3C, 0x5B, 0x88, 0x85, 0x42, 0x0D, 0xA5, 0xDC,
-    0x4B, 0xA7, 0xC4, 0x66, 0xB2, 0x8E, 0x15, 0xA4, 0x3C, 0xAF, 0xEA, 0x9F, 0x67, 0x2F, 0xC0, 0x83,
-    0x90, 0x27, 0x86, 0xB4, 0xAD, 0xBF, 0xA4, 0xC9, 0x46, 0xFA, 0xF7, 0x22, 0x02, 0xBD, 0xB0, 0x85,
-    0xB6, 0x86, 0x41, 0x2C, 0xF0, 0x38, 0x99, 0xF6, 0x99, 0x5D, 0xC1, 0xF3, 0xCD, 0x5D, 0xF5, 0x8D,
-    0xC0, 0x2F, 0xC0, 0xA8, 0xC4, 0x4F, 0xAD, 0xED, 0x05, 0x26, 0x0A, 0xD2, 0x6C, 0x54, 0xC7, 0xAA,
-    0x06, 0x9D, 0x52, 0xFC, 0xD2, 0x07, 0xAB, 0x70, 0x22, 0xA7, 0x01, 0xBC, 0xC8, 0xDE, 0x80, 0xBA,
-    0xEA, 0x4A, 0xED, 0x32, 0x6A, 0xF4, 0xBE, 0xA9, 0x2C, 0xE7, 0x25, 0xF0, 0x52, 0xAD, 0xAA, 0x9A,
-    0xD8, 0xFF, 0x5C, 0x38, 0xBC, 0x2C, 0x20, 0x49, 0xAC, 0x3F, 0x9B, 0x58, 0x13, 0xF5, 0x4C, 0x1C,
-    0xEB, 0x87, 0xFB, 0xFA, 0xC7, 0xC2, 0xDC, 0x87, 0x1B, 0x61, 0x6F, 0x28, 0x94, 0x2C, 0xB7, 0xC2,
-    0xE2, 0x5E, 0x59, 0x4D, 0x90, 0x25, 0x17, 0x60, 0x04, 0x84, 0x1C, 0xB4, 0x43, 0x35, 0xE7, 0x5A,
-    0x3F, 0x14, 0xF6, 0x0F, 0x3A, 0x41, 0xBE, 0xA1, 0x08, 0x70, 0x15, 0x74, 0x4E, 0x99, 0x9B, 0x51,
-    0x4D, 0x4C, 0xF6, 0x84, 0x2F, 0xCA, 0x17, 0x1F, 0x36, 0x82, 0x2F, 0xE6, 0x68, 0xA6, 0x45, 0x5F,
-    0xE4, 0xDD, 0x50, 0xF1, 0x4D, 0xDE, 0x6B, 0x50, 0xEE, 0x15, 0x35, 0xDF, 0xEF, 0xAA, 0xF5, 0x8A,
-    0x62, 0x10, 0x15, 0xD2, 0xF9, 0x70, 0xC3, 0xEE, 0xEB, 0x15, 0x65, 0xB7, 0xEA, 0x3F, 0x5C, 0x6E,
-    0x96, 0x37, 0xB5, 0x96, 0x00, 0x7E, 0x8F, 0xB5, 0x8A, 0x61, 0xEE, 0x27, 0x6A, 0xEF, 0x45, 0xE0,
-    0xCC, 0xCC, 0xC0, 0x44, 0x16, 0x91, 0xE6, 0x15, 0xFC, 0xFF, 0xB8, 0x4A, 0xC5, 0xE1, 0x7B, 0xDE,
-    0x2B, 0xCC, 0x5C, 0x53, 0x7B, 0xBF, 0x96, 0x9B, 0xC5, 0x6F, 0x15, 0x6B, 0xEA, 0x61, 0xDD, 0x56,
-    0xE7, 0xE7, 0xBC, 0x57, 0x3D, 0x9C, 0x6A, 0x6E, 0x66, 0x50, 0x7C, 0x22, 0xE4, 0xB0, 0xDA, 0x89,
-    0x00, 0x6C, 0xA1, 0x6B, 0xA8, 0x32, 0x93, 0x0B, 0x0C, 0x02, 0x04, 0x49, 0x8F, 0x88, 0x96, 0x9B,
-    0x30, 0xB3, 0x5A, 0x84, 0xA2, 0xEF, 0xA0, 0x43, 0x95, 0x05, 0xD3, 0x29, 0x66, 0x83, 0x97, 0x86,
-    0x6A, 0x3D, 0xE2, 0x96, 0x4A, 0x0B, 0x9E, 0x0C, 0x3C, 0x82, 0x8E, 0x0E, 0xBE, 0xF3, 0x5C, 0xD3,
-    0x73, 0x5A, 0x42, 0x64, 0xD0, 0x17, 0xA8, 0x63, 0x16, 0xE9, 0x25, 0x3D, 0xAF, 0x01, 0x19, 0x83,
-    0xB1, 0xA0, 0x8B, 0xF4, 0xAE, 0x98, 0xB9, 0xB5, 0x2A, 0xD6, 0x09, 0x63, 0x45, 0x63, 0xAC, 0xCF,
-    0xC2, 0x45, 0x96, 0x13, 0xAB, 0xDF, 0x11, 0xDB, 0x0C, 0x7A, 0x38, 0x06, 0x84, 0xB5, 0x4C, 0xAA,
-    0xD5, 0xD1, 0x45, 0x1C, 0xEE, 0x02, 0x09, 0xD7, 0x0F, 0x92, 0x4C, 0x97, 0x1A, 0x5E, 0x3C, 0x15,
-    0x92, 0xD0, 0x7D, 0xA6, 0x3F, 0xE7, 0x80, 0xE6, 0x23, 0xE9, 0xE6, 0x7E, 0x8B, 0x73, 0x22, 0xED,
-    0x42, 0xB4, 0x34, 0x56, 0x4A, 0x2F, 0xFF, 0x58, 0x34, 0x85, 0x7C, 0x8C, 0xC4, 0x87, 0x35, 0x1B,
-    0x62, 0xD9, 0x3A, 0x3C, 0x33, 0x6A, 0x02, 0x02, 0x4D, 0x2A, 0x4C, 0xB8, 0x1A, 0x36, 0x30, 0x7C,
-    0xC6, 0x3C, 0x19, 0xF3, 0x41, 0x16, 0x28, 0x94, 0x88, 0xA1, 0x26, 0xD2, 0x2A, 0x16, 0x82, 0x49,
-    0xB3, 0x92, 0x66, 0x07, 0x6B, 0x6B, 0xF0, 0x9A, 0xFF, 0xB7, 0x70, 0x89, 0xB8, 0x2A, 0x06, 0xD6,
-    0x6F, 0xAA, 0xB9, 0xA4, 0x85, 0xE6, 0x0C, 0x9A, 0x45, 0x24, 0xA4, 0xC0, 0x51, 0x4E, 0x7C, 0x05,
-    0x8E, 0x1F, 0x9C, 0xE1, 0xEF, 0x6A, 0xAA, 0xF4, 0x43, 0xEB, 0x6B, 0xA2, 0x15, 0x25, 0x4E, 0x10,
-    0xF9, 0x4D, 0xEC, 0x54, 0x74, 0xE3, 0xA4, 0x77, 0x25, 0x24, 0x84, 0x75, 0x05, 0xEA, 0x83, 0xEC,
-    0xB6, 0x78, 0x1C, 0x58, 0xCC, 0x37, 0xA6, 0xEC, 0xD7, 0x02, 0xF2, 0x72, 0xEA, 0x91, 0xFC, 0x69,
-    0xA6, 0xF6, 0x9F, 0x60, 0x34, 0xFE, 0x98, 0x06, 0x83, 0x10, 0xC2, 0x3C, 0x43, 0x71, 0x2F, 0xCF,
-    0xD0, 0x94, 0x21, 0xA2, 0x0C, 0xBF, 0x43, 0x96, 0x30, 0x4B, 0xE4, 0x95, 0x58, 0x35, 0xDE, 0xE6,
-    0x22, 0x9D, 0x32, 0xC6, 0x6F, 0x6C, 0x22, 0xC8, 0x99, 0x30, 0x1C, 0xE6, 0xFE, 0xFF, 0x83, 0x7B,
-    0x54, 0x8E, 0xE8, 0x62, 0xA6, 0x1C, 0x00, 0xA0, 0x45, 0x10, 0x1C, 0xCF, 0xAE, 0x94, 0x13, 0xBD,
-    0xF1, 0xB7, 0x0F, 0x2F, 0xB2, 0xAA, 0x2E, 0xCD, 0x0F, 0xA5, 0xDB, 0xED, 0xCD, 0xAA, 0x66, 0x2E,
-    0x54, 0x15, 0x11, 0xCA, 0xBB, 0x89, 0x9D, 0x09, 0x4B, 0xDE, 0x3F, 0x67, 0xC0, 0x15, 0x61, 0x1E,
-    0x98, 0x3B, 0x54, 0x36, 0xCB, 0x9B, 0xF0, 0x8F, 0x8E, 0xAA, 0x58, 0xC6, 0xE1, 0xF6, 0xC5, 0x84,
-    0xFB, 0xD3, 0x5A, 0xBF, 0x2D, 0xF6, 0x74, 0x17, 0xB4, 0x73, 0x61, 0x63, 0x22, 0xC0, 0x9B, 0xDE,
-    0x52, 0x2C, 0x39, 0x58, 0xCE, 0x30, 0xD3, 0x20, 0x0C, 0x2D, 0x8A, 0x4F, 0x5C, 0x91, 0x33, 0x28,
-    0xF8, 0xAB, 0xA8, 0x3B, 0xC3, 0xA7, 0x99, 0x07, 0x94, 0x3E, 0x53, 0xB1, 0x64, 0x36, 0x10, 0x13,
-    0x64, 0x37, 0x53, 0x64, 0xC0, 0x02, 0x4A, 0xDE, 0x73, 0x40, 0xC6, 0xA4, 0xC0, 0xDB, 0x07, 0x6E,
-    0x12, 0x66, 0x83, 0x6A, 0x5E, 0x4A, 0x72, 0xE9, 0x7A, 0x5A, 0xF6, 0x6A, 0x4F, 0x29, 0x69, 0x26,
-    0xC8, 0x11, 0x1F, 0xD9, 0xB4, 0x82, 0x1E, 0xB1, 0x89, 0x02, 0x78, 0xE9, 0xE1, 0x7F, 0x2B, 0xFF,
-    0xC5, 0xB2, 0xC9, 0x2A, 0x4A, 0x11, 0xA2, 0xD2, 0x53, 0x8F, 0xED, 0x06, 0xFF, 0x0B, 0xDE, 0x90,
-    0x41, 0xA3, 0x27, 0x71, 0x5D, 0x0C, 0x16, 0xA2, 0x29, 0x2E, 0x60, 0xD5, 0x3C, 0x6F, 0xE6, 0x6F,
-    0x35, 0x9D, 0x72, 0xEF, 0xCD, 0x60, 0x30, 0xA8, 0xE6, 0xB2, 0xD1, 0x52, 0x81, 0xAF, 0x3D, 0x72,
-    0x63, 0xEA, 0xE8, 0x8B, 0xDF, 0xAC, 0xC9, 0x9B, 0xB4, 0x0A, 0x9B, 0xC9, 0x20, 0x6F, 0xF2, 0x3A,
-    0x6C, 0x84, 0x31, 0x4B, 0x30, 0xDF, 0x55, 0xDC, 0x2E, 0x81, 0x3A, 0x51, 0x33, 0x81, 0xDA, 0xD5,
-    0x1A, 0xB9, 0x22, 0x07, 0x9C, 0x32, 0xC7, 0x4E, 0xD4, 0x7C, 0xFE, 0xEB, 0xDD, 0x7C, 0x65, 0xD1,
-    0xE9, 0xB3, 0x9E, 0x56, 0xB0, 0x1E, 0x7B, 0x7C, 0x3C, 0x2C, 0x4B, 0x0C, 0x59, 0x33, 0x2F, 0x81,
-    0x7C, 0x6B, 0xEF, 0x0C, 0x0F, 0x1B, 0x65, 0x19, 0x45, 0x93, 0xF2, 0x0C, 0xF1, 0x64, 0xC8, 0x34,
-    0xEC, 0x48, 0xE8, 0x26, 0xCA, 0x35, 0x5E, 0x06, 0x5D, 0x0B, 0x0F, 0xA8, 0x64, 0xAF, 0x1B, 0x8D,
-    0xC0, 0xDE, 0x4B, 0xE6, 0x77, 0xDF, 0x17, 0x0F, 0xA9, 0x06, 0x26, 0x93, 0x96, 0x3A, 0x57, 0xEC,
-    0x8D, 0x28, 0xE1, 0xC4, 0x56, 0xC1, 0x27, 0x9D, 0xF9, 0xC6, 0x15, 0xEE, 0x93, 0x90, 0x79, 0x2D,
-    0x64, 0x58, 0xB5, 0x1C, 0xEC, 0xB8, 0xB4, 0xD4, 0x58, 0xE8, 0x74, 0xDD, 0x96, 0x79, 0xE7, 0x92,
-    0xA9, 0xAA, 0x15, 0xDC, 0x97, 0x0F, 0xEE, 0xE3, 0x4F, 0x1E, 0x5A, 0x37, 0x9A, 0xFB, 0x80, 0xF1,
-    0x80, 0x0C, 0x54, 0x40, 0x6E, 0x16, 0x0F, 0x2E, 0xE9, 0x30, 0xA3, 0xB1, 0x66, 0x1B, 0xDF, 0x19,
-    0x2D, 0x14, 0x62, 0xF8, 0x5E, 0xCB, 0x61, 0x8F, 0x88, 0x5E, 0x86, 0xBF, 0xB3, 0x3A, 0x14, 0x6D,
-    0x8C, 0x61, 0x2D, 0x16, 0x15, 0x43, 0x71, 0x7F, 0x39, 0x94, 0x8F, 0x31, 0x14, 0x8F, 0x85, 0x43,
-    0xF9, 0x98, 0xC3, 0xB0, 0xE3, 0x50, 0xBC, 0x9A, 0x33, 0x1A, 0xA6, 0xE8, 0x70, 0xD2, 0xE9, 0x30,
-    0xFD, 0x90, 0x43, 0x03, 0x85, 0x82, 0x6C, 0xB3, 0xD5, 0x61, 0x02, 0x1F, 0x64, 0x13, 0x7E, 0x5B,
-    0x80, 0xC4, 0xC4, 0x04, 0x82, 0xD3, 0xCD, 0xBD, 0x0C, 0xB3, 0x1C, 0x60, 0xBF, 0xBA, 0xE4, 0x64,
-    0xA8, 0x65, 0x66, 0x87, 0x95, 0xB3, 0xD5, 0xD1, 0x74, 0xE1, 0x89, 0x2C, 0xEB, 0xA5, 0xE5, 0xBF,
-    0x9F, 0x79, 0x25, 0x02, 0x43, 0xA4, 0xF6, 0x02, 0xFB, 0x57, 0x90, 0xF8, 0x59, 0xBB, 0x3D, 0xB1,
-    0x2C, 0x92, 0xC3, 0x1F, 0x9A, 0xC2, 0xC5, 0xD4, 0x40, 0x72, 0x0C, 0x92, 0x19, 0x4E, 0xBA, 0x88,
-    0xF2, 0x1A, 0xBE, 0xC8, 0x25, 0x2C, 0x1C, 0xC4, 0xF1, 0xAB, 0xC4, 0xCF, 0x28, 0x6D, 0x13, 0xC1,
-    0xD8, 0x7C, 0x75, 0x29, 0x33, 0x26, 0x8B, 0x73, 0xE5, 0x5E, 0x97, 0x77, 0xD4, 0x9E, 0x9C, 0xD1,
-    0x75, 0x72, 0x09, 0xDF, 0xB9, 0xB3, 0xE8, 0x12, 0xD3, 0xFA, 0x77, 0xA4, 0xD8, 0x10, 0x04, 0x22,
-    0x83, 0x23, 0xFE, 0x58, 0x8F, 0x56, 0x94, 0xC3, 0x56, 0xD0, 0x57, 0x21, 0x13, 0x20, 0xD2, 0x29,
-    0xCE, 0xBF, 0x7F, 0xC3, 0x24, 0xD1, 0x2F, 0xC4, 0xF5, 0xF5, 0xED, 0x66, 0x6E, 0x9B, 0xD0, 0x0E,
-    0x09, 0xE5, 0x7D, 0x4F, 0x60, 0x16, 0x2E, 0x47, 0x7F, 0x5A, 0x62, 0x71, 0xE9, 0xF6, 0x66, 0xE1,
-    0x0C, 0x3B, 0xBF, 0xF7, 0x8D, 0x5D, 0xA5, 0x0E, 0xFD, 0xCE, 0xEF, 0xD4, 0x61, 0x8C, 0x1A, 0xE5,
-    0xD1, 0x9C, 0x7A, 0x88, 0x31, 0x87, 0xF6, 0x51, 0x67, 0x4B, 0x29, 0xFC, 0xAF, 0xBC, 0xF0, 0x8A,
-    0x4D, 0xFD, 0xB1, 0x41, 0xA5, 0x3E, 0x27, 0x03, 0xE4, 0x6C, 0xE3, 0x22, 0x23, 0x94, 0x49, 0x31,
-    0x36, 0x14, 0x8F, 0x7D, 0xF3, 0xD1, 0xFE, 0x62, 0xEB, 0xBD, 0xB9, 0x2A, 0x2A, 0x3E, 0xB6, 0xB1,
-    0x3C, 0x3D, 0xB2, 0xEF, 0xA1, 0x65, 0xF2, 0x94, 0xBD, 0x20, 0x11, 0x0D, 0x93, 0x1E, 0x0C, 0x45,
-    0x92, 0xEB, 0x67, 0x88, 0xE5, 0x2F, 0x50, 0x62, 0x4F, 0x44, 0x21, 0x48, 0xC8, 0x60, 0xFF, 0x07,
-    0xED, 0x94, 0x0B, 0xDD, 0x3C, 0xB6, 0x5D, 0x06, 0xD6, 0xEC, 0xE2, 0x75, 0x67, 0x5A, 0x16, 0x5C,
-    0x3E, 0xCF, 0xFA, 0x38, 0x76, 0x77, 0x31, 0x03, 0x19, 0xEB, 0x48, 0xB6, 0xB1, 0x2D, 0x01, 0x86,
-    0xC7, 0xC4, 0xA7, 0x84, 0xD2, 0x76, 0x5B, 0xBB, 0x3E, 0x8F, 0xD8, 0x5E, 0x73, 0xBC, 0x62, 0x40,
-    0xA8, 0xCD, 0x84, 0x4A, 0xE4, 0x40, 0x94, 0x98, 0xC8, 0x83, 0x65, 0xA6, 0xD2, 0x94, 0xD4, 0xDA,
-    0x19, 0x10, 0x6A, 0xB6, 0x8B, 0x3F, 0xC8, 0xAF, 0xEB, 0x07, 0xB1, 0x40, 0x02, 0xDA, 0xA9, 0x28,
-    0xA0, 0x3E, 0x00, 0x61, 0xC8, 0xAE, 0x91, 0x07, 0x07, 0xC7, 0x83, 0xB3, 0xDD, 0x3C, 0x38, 0xE8,
-    0x50, 0x42, 0x46, 0xE5, 0xC1, 0x4A, 0x79, 0x70, 0x70, 0x3C, 0x38, 0x73, 0x3C, 0x58, 0xED, 0xE6,
-    0xC1, 0x99, 0xE3, 0xC1, 0x6A, 0x37, 0x0F, 0xCE, 0x1C, 0x0F, 0x9E, 0x73, 0x3C, 0x78, 0x66, 0x7F,
-    0x1E, 0xAC, 0x95, 0x07, 0x7B, 0xC7, 0x83, 0x4E, 0xBE, 0x1C, 0x55, 0xB4, 0x29, 0xE3, 0x61, 0x95,
-    0xDE, 0x70, 0xAA, 0x15, 0x4B, 0xAB, 0xA1, 0x5F, 0x68, 0x77, 0x99, 0xD7, 0xA5, 0x6E, 0xB3, 0xD5,
-    0xE9, 0x11, 0x59, 0x3A, 0x18, 0x4F, 0xCD, 0x85, 0x2A, 0x25, 0x61, 0xF3, 0xA0, 0x53, 0xAE, 0x53,
-    0xE6, 0x21, 0x3B, 0x5D, 0xF3, 0x5B, 0x30, 0x5B, 0xFC, 0x3B, 0x81, 0xD9, 0xEB, 0x11, 0xD5, 0x91,
-    0x38, 0x6A, 0xF7, 0x93, 0xA5, 0x76, 0xE2, 0x62, 0x8C, 0xBC, 0xD9, 0x5B, 0x32, 0x21, 0x97, 0x10,
-    0x6C, 0xAA, 0x51, 0xDD, 0x94, 0xA5, 0x9D, 0x87, 0xC8, 0x0F, 0xD7, 0x63, 0x7C, 0xB7, 0xFF, 0x9F,
-    0x16, 0x3D, 0x3D, 0x2D, 0xE9, 0x26, 0xAC, 0xEF, 0x0A, 0x0F, 0x30, 0x5F, 0x22, 0x2E, 0x90, 0xAD,
-    0x7C, 0xF6, 0x6B, 0x56, 0x60, 0x41, 0xDF, 0x66, 0xF8, 0x51, 0x60, 0x09, 0x47, 0xD8, 0xB1, 0x31,
-    0x3C, 0x9A, 0x51, 0x5B, 0xA6, 0x7F, 0x26, 0x98, 0xF6, 0x65, 0x7C, 0xE6, 0x0F, 0xD4, 0x73, 0x61,
-    0x47, 0xC1, 0x48, 0xF4, 0xAB, 0xF2, 0xE5, 0x19, 0xED, 0x00, 0x0D, 0x74, 0x34, 0x63, 0x92, 0x29,
-    0x7F, 0xDB, 0xF2, 0xE7, 0x2C, 0xD0, 0x45, 0x4D, 0xD8, 0x33, 0xB4, 0x41, 0xB6, 0x22, 0xD4, 0xC4,
-    0x84, 0x38, 0x3B, 0x89, 0x7D, 0x45, 0x0C, 0x81, 0xEB, 0x31, 0xD7, 0xE6, 0x6C, 0xF9, 0xFB, 0xE9,
-    0xA2, 0x65, 0x8D, 0x6B, 0x0C, 0xE1, 0x34, 0xFA, 0xD6, 0x76, 0x57, 0xDA, 0x78, 0x66, 0xB5, 0x7F,
-    0xB0, 0xD6, 0xE2, 0x69, 0x34, 0x13, 0x54, 0xA3, 0xB6, 0xD1, 0x81, 0xF1, 0xED, 0xA3, 0xD4, 0x50,
-    0xE8, 0x1F, 0x45, 0xEB, 0x8D, 0xB1, 0xE8, 0x33, 0x4F, 0x7F, 0x8B, 0x3B, 0x3E, 0x1E, 0x98, 0x56,
-    0x40, 0xCE, 0x80, 0x09, 0x9F, 0x17, 0x7B, 0xD0, 0x42, 0x80, 0x8F, 0xA6, 0x11, 0xF6, 0xB8, 0x78,
-    0xF6, 0xC2, 0xC6, 0xCC, 0xB0, 0xFB, 0xC6, 0x23, 0xEF, 0x78, 0x5B, 0x99, 0xA6, 0x9E, 0x3C, 0x4D,
-    0x08, 0x3C, 0x4C, 0xA3, 0xC7, 0x0C, 0x42, 0xBA, 0x43, 0xB9, 0xCD, 0x55, 0x83, 0x68, 0x1B, 0xE3,
-    0x7E, 0xFD, 0x1B, 0xAE, 0x7C, 0x19, 0xD3, 0x0D, 0xF4, 0xD9, 0x61, 0x6F, 0xD2, 0x6D, 0x93, 0xF7,
-    0xD4, 0x34, 0xA2, 0xE4, 0x80, 0xF8, 0xB8, 0x63, 0xEA, 0x31, 0x99, 0x45, 0x2C, 0xDB, 0xA9, 0x65,
-    0x29, 0xCF, 0x6A, 0xE3, 0xD4, 0x0F, 0x5A, 0x56, 0x3D, 0x59, 0x12, 0x8F, 0x5A, 0x47, 0x05, 0xA2,
-    0xA6, 0x3C, 0xEF, 0x08, 0x54, 0x53, 0xA5, 0x10, 0x86, 0xF4, 0x5D, 0xDD, 0x3F, 0xF3, 0x04, 0x3B,
-    0x98, 0x3B, 0x6A, 0x9B, 0x64, 0x4A, 0x3A, 0x59, 0xDD, 0x05, 0xD2, 0x52, 0x1B, 0x97, 0x15, 0xF8,
-    0x33, 0x84, 0xB5, 0xDC, 0x7E, 0x12, 0x7D, 0x85, 0x56, 0xF1, 0x5D, 0x6A, 0x88, 0xBA, 0xBA, 0x35,
-    0x5F, 0xCA, 0x3D, 0xC6, 0x54, 0x50, 0x6E, 0x42, 0x92, 0xC1, 0x63, 0xB1, 0x8F, 0xD2, 0x49, 0xBD,
-    0xD6, 0xEE, 0x43, 0x9D, 0x0D, 0xDD, 0x39, 0xD4, 0x73, 0x4A, 0x31, 0xF7, 0x59, 0xCC, 0xA8, 0xCD,
-    0x56, 0x39, 0x3A, 0xA4, 0xE1, 0x1F, 0x0F, 0x30, 0x04, 0xF9, 0x3B, 0x4B, 0x24, 0x59, 0xD0, 0x89,
-    0xC9, 0x38, 0xCB, 0xEA, 0x7E, 0x2D, 0x3A, 0x17, 0xBD, 0x08, 0x03, 0x00, 0xB6, 0x26, 0x1E, 0xFE,
-    0x11, 0x05, 0x46, 0xAD, 0x99, 0x63, 0x91, 0x87, 0x95, 0x6D, 0x0E, 0xA0, 0xC1, 0x14, 0xB5, 0xEF,
-    0xD3, 0xF4, 0x15, 0x21, 0x4C, 0x62, 0x38, 0x2C, 0x37, 0x81, 0x80, 0xFB, 0x84, 0xE9, 0x01, 0x51,
-    0xAC, 0xB5, 0xFD, 0xEF, 0x99, 0xEF, 0x5C, 0x0E, 0xF2, 0xA9, 0x41, 0x69, 0x09, 0x9A, 0x87, 0xDA,
-    0xD1, 0x6D, 0x2F, 0xA0, 0xE3, 0x0B, 0xF7, 0x4B, 0x90, 0x06, 0xFE, 0xCE, 0x1B, 0xA6, 0xEB, 0xCA,
-    0x5A, 0x71, 0xC9, 0xD6, 0x2B, 0xDF, 0xB2, 0x57, 0x62, 0x94, 0x03, 0x47, 0x01, 0x47, 0x1C, 0x95,
-    0x1E, 0xAB, 0xD2, 0xA3, 0x5F, 0x39, 0xE9, 0x71, 0x24, 0xED, 0x29, 0x73, 0x31, 0x53, 0x59, 0xA6,
-    0x2C, 0x28, 0x8E, 0x9D, 0xF6, 0xEB, 0x4F, 0x03, 0x6D, 0xDA, 0x9E, 0xC8, 0x28, 0x41, 0x05, 0xE2,
-    0xFD, 0xE3, 0x36, 0x63, 0xC7, 0x00, 0x45, 0x57, 0x37, 0x67, 0x1E, 0x7E, 0x9D, 0xC0, 0x3F, 0xE0,
-    0x61, 0xFF, 0x44, 0x06, 0x6C, 0x4E, 0x4B, 0x18, 0x06, 0x54, 0x61, 0x5A, 0xC6, 0x21, 0xD0, 0x9F,
-    0x30, 0xFC, 0xE6, 0x39, 0x78, 0xCC, 0x77, 0x21, 0x87, 0xBA, 0xEC, 0x94, 0x61, 0xB9, 0xA9, 0x6B,
-    0xD0, 0x6E, 0xC5, 0x63, 0x90, 0xA7, 0xA1, 0x50, 0xD8, 0x88, 0xAA, 0x0A, 0x7A, 0x44, 0x75, 0x25,
-    0x0A, 0xF3, 0x71, 0xB3, 0x97, 0x46, 0x24, 0x9C, 0x1D, 0xAB, 0xF7, 0x03, 0x30, 0x5E, 0xB2, 0xF2,
-    0x5B, 0x88, 0x9A, 0x49, 0xAB, 0x89, 0xFD, 0x97, 0x12, 0x95, 0x59, 0xED, 0x2E, 0x91, 0xDB, 0x56,
-    0x5F, 0x77, 0xE9, 0xE4, 0x75, 0x94, 0xE0, 0xB9, 0x2B, 0x02, 0x4F, 0x4D, 0x78, 0x45, 0x23, 0xC4,
-    0xFB, 0x4F, 0xEF, 0x6C, 0x9D, 0x9C, 0x21, 0xBD, 0x25, 0x6A, 0x3D, 0xAC, 0x27, 0x6A, 0x15, 0xE3,
-    0x0C, 0x2C, 0xD0, 0x43, 0xAD, 0x0F, 0x9A, 0x1C, 0x5E, 0x03, 0x09, 0xA9, 0xF9, 0x01, 0x0D, 0x04,
-    0x10, 0x5F, 0xB3, 0x4F, 0xC3, 0x35, 0xA4, 0xBB, 0xDD, 0x3F, 0x9F, 0x59, 0x6D, 0x54, 0x97, 0x47,
-    0x21, 0x80, 0xA5, 0xE0, 0x55, 0xBB, 0x7F, 0x52, 0xBB, 0xD6, 0x0A, 0xCE, 0x32, 0xB8, 0x59, 0x40,
-    0x62, 0xFC, 0xE4, 0x20, 0x04, 0x11, 0x3F, 0x69, 0x10, 0xB3, 0xCA, 0x4F, 0x26, 0x75, 0x42, 0x1F,
-    0x55, 0xAC, 0x7E, 0xDA, 0xD3, 0xF8, 0x22, 0x00, 0x7C, 0x3F, 0xD7, 0x9E, 0x1E, 0x2D, 0x2E, 0x57,
-    0x66, 0xD5, 0xAD, 0x48, 0x5D, 0xBD, 0x5D, 0x1A, 0xAB, 0xA6, 0xF9, 0xC9, 0xE1, 0x08, 0xB0, 0x19,
-    0xDB, 0x3E, 0x31, 0x94, 0x33, 0x79, 0x5C, 0xF9, 0x51, 0x3D, 0xE9, 0x90, 0xB2, 0xB5, 0x99, 0xD7,
-    0xC7, 0xD0, 0x7D, 0x82, 0x51, 0x50, 0x10, 0xC6, 0x58, 0xF4, 0x17, 0x7C, 0x6D, 0x2B, 0xAB, 0xC5,
-    0x0A, 0x70, 0xC5, 0xAD, 0x03, 0xAE, 0xC3, 0xD6, 0xD6, 0xEB, 0xB8, 0x76, 0xEA, 0xAB, 0x10, 0x7C,
-    0x77, 0x1F, 0x72, 0xCD, 0xF4, 0x63, 0x84, 0xC1, 0x98, 0x97, 0x45, 0xBD, 0x42, 0xB8, 0xF9, 0xAE,
-    0xD0, 0xFE, 0x93, 0x3D, 0x65, 0x3F, 0xEC, 0xD1, 0x22, 0x13, 0x42, 0xDE, 0xD9, 0xFF, 0x20, 0x6C,
-    0x00, 0x0A, 0xAD, 0xBC, 0xB2, 0x64, 0x48, 0xD4, 0xA7, 0x71, 0x7D, 0x48, 0xB4, 0xA2, 0xA9, 0x76,
-    0x90, 0x0C, 0x4B, 0x3D, 0x18, 0x97, 0x07, 0xA8, 0xDE, 0x53, 0xE5, 0x6B, 0xDA, 0xEF, 0xD4, 0x52,
-    0x9E, 0x20, 0x49, 0x71, 0xC3, 0xAA, 0x83, 0xD5, 0x72, 0x83, 0x36, 0x5A, 0x58, 0xE2, 0x3E, 0x62,
-    0x79, 0xCD, 0xE8, 0x76, 0x87, 0x88, 0xE5, 0x36, 0x0C, 0x06, 0xCD, 0x97, 0x33, 0xB5, 0x8B, 0x7D,
-    0x41, 0xD1, 0x5F, 0x4A, 0xDA, 0x12, 0xAB, 0xD9, 0x00, 0xD5, 0x8A, 0x81, 0x66, 0xC1, 0x13, 0x55,
-    0x6C, 0x96, 0x7B, 0xDD, 0x18, 0x97, 0x70, 0xFF, 0x21, 0x26, 0x28, 0xDD, 0x43, 0x39, 0x75, 0xD4,
-    0x33, 0x15, 0x9E, 0xA3, 0x7E, 0x2D, 0xE8, 0x9F, 0xE5, 0x6C, 0x14, 0xAA, 0x76, 0x65, 0xC2, 0x6B,
-    0x97, 0xFA, 0x65, 0x6A, 0xB9, 0x56, 0x37, 0x97, 0x7B, 0xF3, 0x6A, 0xCD, 0x06, 0xEF, 0x0E, 0x35,
-    0x4D, 0xF9, 0xB8, 0x3D, 0x6B, 0x2F, 0xD9, 0x4F, 0x6C, 0xF7, 0x6C, 0x8F, 0x7C, 0x50, 0xEB, 0xB3,
-    0xAE, 0xC9, 0x1D, 0x38, 0xBB, 0xB6, 0xE4, 0xCC, 0x3E, 0xEF, 0x83, 0x7C, 0x27, 0xA3, 0xA5, 0x43,
-    0x75, 0xFF, 0x8E, 0xC6, 0x1E, 0x36, 0xA9, 0x2D, 0x05, 0x87, 0x2E, 0x46, 0x18, 0x96, 0x02, 0x45,
-    0x57, 0x67, 0xD0, 0x00, 0x3F, 0x2C, 0x16, 0xB1, 0x61, 0xF2, 0x3B, 0xDB, 0x94, 0x9D, 0xED, 0x4A,
-    0x7B, 0xD8, 0xE6, 0xB6, 0x10, 0x1E, 0x2B, 0x26, 0xC3, 0xB8, 0x8B, 0xF1, 0xAA, 0xB0, 0x88, 0x0F,
-    0xE2, 0x61, 0x13, 0xF2, 0xCE, 0x7D, 0x52, 0x0B, 0x86, 0xD4, 0x0D, 0xB2, 0xAA, 0x1F, 0xE8, 0xC2,
-    0x0F, 0xAE, 0x45, 0x0A, 0xEE, 0xFB, 0xFD, 0xEE, 0x47, 0x00, 0x91, 0x3F, 0x55, 0x07, 0x0E, 0x66,
-    0x8A, 0x9B, 0x53, 0x3E, 0xD4, 0x74, 0x5E, 0xAF, 0x81, 0x41, 0xB1, 0x1C, 0xDD, 0xDE, 0xE9, 0x3C,
-    0x2F, 0x46, 0xE3, 0x47, 0x1E, 0xFC, 0xF4, 0x54, 0x02, 0x9A, 0x10, 0x5D, 0xCE, 0x36, 0x45, 0x37,
-    0x5E, 0xA1, 0xC1, 0x5A, 0x5C, 0xEF, 0x8D, 0xD1, 0xFC, 0x3E, 0xB6, 0xA1, 0x3D, 0x6F, 0xCF, 0xD9,
-    0x8F, 0x4F, 0xFD, 0x15, 0x55, 0xE7, 0xE9, 0x01, 0xEE, 0x3D, 0x80, 0x84, 0x7C, 0x31, 0x71, 0xC6,
-    0x0F, 0x3C, 0xFB, 0x01, 0xDD, 0xBB, 0x60, 0xC9, 0xBB, 0x0B, 0x0A, 0x47, 0x1A, 0xFA, 0x25, 0x9D,
-    0xAA, 0x1A, 0x36, 0xB6, 0xEF, 0x52, 0x30, 0xDE, 0xD6, 0x26, 0xB4, 0x60, 0x0B, 0x51, 0xA9, 0xD3,
-    0xD9, 0x7D, 0xBD, 0xE0, 0x31, 0xAA, 0x2D, 0xC2, 0x10, 0x89, 0x14, 0xDE, 0x16, 0x0C, 0x9E, 0x16,
-    0x6F, 0x67, 0xC5, 0xA8, 0x67, 0x99, 0xB9, 0x56, 0x69, 0x78, 0x0A, 0xBE, 0xEE, 0x26, 0xA2, 0xDB,
-    0x32, 0x73, 0x4E, 0x76, 0x38, 0xAC, 0x08, 0x93, 0x5E, 0x42, 0x45, 0x51, 0xB8, 0x21, 0xBA, 0x84,
-    0x52, 0x31, 0xF6, 0x66, 0xBC, 0x8B, 0x58, 0x39, 0xDD, 0xFE, 0x67, 0xFB, 0x18, 0x1E, 0x13, 0x32,
-    0x93, 0xB9, 0x35, 0xF2, 0xF8, 0x8F, 0xB4, 0x7C, 0xC4, 0xFA, 0xA4, 0x19, 0x89, 0x8A, 0xC8, 0xF1,
-    0xFE, 0xDD, 0xD8, 0xCA, 0x07, 0xEC, 0xD3, 0x2D, 0x86, 0xE3, 0x36, 0xAC, 0xFD, 0x36, 0x35, 0xC1,
-    0xB4, 0x33, 0x21, 0xD2, 0xFA, 0x11, 0x9D, 0x5F, 0xEC, 0xE7, 0x9B, 0xCA, 0x75, 0x46, 0x78, 0xBC,
-    0xB2, 0xD9, 0x94, 0xE0, 0xA7, 0x30, 0xF9, 0x86, 0x58, 0xEB, 0x33, 0x26, 0xFC, 0x64, 0x30, 0xE5,
-    0x13, 0xB2, 0x50, 0x34, 0x35, 0x79, 0x3F, 0x85, 0xDF, 0xF0, 0xBC, 0xEB, 0x3A, 0xE5, 0x26, 0xC1,
-    0x41, 0xD8, 0x39, 0x7D, 0x41, 0xDC, 0xDE, 0xE9, 0x04, 0xBD, 0xD0, 0xF7, 0x2C, 0x3D, 0x17, 0x1E,
-    0x81, 0x58, 0xD5, 0x42, 0x1E, 0x2E, 0x3A, 0xFE, 0x91, 0xBC, 0x16, 0x1E, 0xEB, 0xC1, 0x09, 0xB5,
-    0x20, 0xA0, 0x43, 0xFA, 0x0B, 0x3E, 0xFA, 0x1A, 0x2B, 0x88, 0xE5, 0xCC, 0x95, 0xEE, 0x22, 0x4C,
-    0x9A, 0x70, 0xFB, 0x21, 0x0B, 0x53, 0xAC, 0x51, 0xF1, 0x17, 0xD3, 0x35, 0x41, 0xDD, 0x51, 0xC5,
-    0x0E, 0xD1, 0x14, 0xFF, 0x19, 0x46, 0x50, 0x96, 0x5F, 0xBE, 0x63, 0x5F, 0xC9, 0x67, 0x29, 0xD8,
-    0x93, 0x21, 0x8A, 0xBA, 0x22, 0x6A, 0x4D, 0xC1, 0x7D, 0x82, 0x7A, 0xAF, 0xB7, 0x12, 0x28, 0xF6,
-    0x46, 0x7C, 0xC6, 0x89, 0xC4, 0xC2, 0x77, 0x1B, 0x3F, 0x5B, 0x38, 0xF9, 0x9B, 0x60, 0xC9, 0xF4,
-    0x5F, 0xED, 0x59, 0xE1, 0x40, 0x89, 0x9F, 0x05, 0x45, 0x7E, 0x35, 0x68, 0xF2, 0x64, 0xC2, 0x8D,
-    0xCE, 0x2D, 0xE9, 0xE5, 0x81, 0x66, 0x1B, 0xDD, 0x83, 0x26, 0xFA, 0x44, 0xF0, 0xF5, 0x47, 0xF1,
-    0x4D, 0x92, 0xC2, 0xEF, 0xCA, 0x22, 0xF9, 0xBD, 0x18, 0x30, 0xEC, 0x36, 0x35, 0x4F, 0x6D, 0xDE,
-    0x16, 0x8C, 0x01, 0x91, 0xA4, 0x68, 0xDD, 0xD7, 0xB9, 0xF8, 0x8E, 0x45, 0x9C, 0xD2, 0xB5, 0xB2,
-    0x8E, 0xF9, 0x4A, 0xCF, 0x6E, 0xCB, 0xC3, 0x87, 0x60, 0x7B, 0xA3, 0x4B, 0xB2, 0x50, 0x98, 0x22,
-    0x7A, 0xB1, 0x31, 0xDF, 0x66, 0xB5, 0x79, 0xA6, 0xDB, 0xDD, 0x4B, 0x61, 0x8E, 0x9C, 0x81, 0x4D,
-    0x2D, 0xC2, 0x7B, 0x36, 0x33, 0xF6, 0x21, 0xC1, 0xE4, 0x69, 0x13, 0x7C, 0x22, 0x26, 0xFC, 0x5C,
-    0xEB, 0x4B, 0x28, 0x89, 0xDA, 0x66, 0x6F, 0x56, 0x5E, 0x77, 0xB8, 0x9C, 0x69, 0xB2, 0x7F, 0x43,
-    0x4B, 0xD6, 0x9E, 0x56, 0xAF, 0xA1, 0x3A, 0xC3, 0x11, 0xB8, 0xA3, 0xC6, 0x9F, 0x05, 0xD8, 0x4B,
-    0x11, 0x23, 0xB0, 0x40, 0xBE, 0x8A, 0xC9, 0x2A, 0xE4, 0x45, 0xE7, 0xC9, 0x8B, 0xBF, 0xBD, 0x84,
-    0x1D, 0x10, 0x06, 0xE9, 0x4C, 0xEA, 0xB7, 0x81, 0x00, 0x9B, 0x14, 0x93, 0x4F, 0x3B, 0xFA, 0x2E,
-    0x08, 0x23, 0xC3, 0xDD, 0x3B, 0x1B, 0x6E, 0x2E, 0xFB, 0x70, 0x13, 0xCA, 0x31, 0x96, 0x4E, 0x7A,
-    0xF7, 0xBA, 0x75, 0x6A, 0x67, 0xAB, 0xFF, 0x25, 0x32, 0x35, 0xFD, 0x5B, 0x78, 0xED, 0x9E, 0xC3,
-    0xEB, 0x69, 0xBE, 0xBE, 0x79, 0x10, 0xAF, 0xF7, 0x8E, 0x59, 0xE9, 0x5B, 0xF1, 0x9A, 0xEF, 0x6C,
-    0x32, 0x60, 0x6C, 0x28, 0xCC, 0x7B, 0x77, 0x75, 0xA8, 0x61, 0x4D, 0xA9, 0x3D, 0xC9, 0x6D, 0x2E,
-    0x33, 0xA5, 0xF9, 0x84, 0x70, 0xD1, 0x3E, 0x6D, 0x1E, 0xC2, 0xCB, 0x37, 0xD5, 0xEE, 0x2E, 0x75,
-    0x34, 0x4C, 0xB6, 0xD1, 0xA8, 0x63, 0x45, 0x78, 0xBB, 0x27, 0xED, 0xFA, 0x5A, 0xD0, 0x5E, 0xD6,
-    0xEF, 0xF0, 0x39, 0x43, 0xB0, 0xD7, 0x70, 0xB2, 0x42, 0xE3, 0x09, 0x54, 0xC6, 0xEA, 0x09, 0x33,
-    0x36, 0xCE, 0xA0, 0xAF, 0x60, 0xB5, 0xD7, 0x5C, 0x31, 0xB2, 0x31, 0xBD, 0x9A, 0x86, 0x37, 0xE7,
-    0x80, 0x3F, 0xC4, 0x0D, 0x44, 0xBA, 0xCF, 0x98, 0x9C, 0xE8, 0xB6, 0x19, 0xBB, 0xCC, 0xA9, 0xEE,
-    0x32, 0xDE, 0x9B, 0x36, 0xBD, 0x53, 0xA8, 0x93, 0xA8, 0xEF, 0x88, 0x15, 0x42, 0xA4, 0x52, 0xE3,
-    0x6D, 0xCE, 0x4C, 0xF2, 0x62, 0x65, 0x86, 0x7B, 0xE6, 0x38, 0xCC, 0x5F, 0xC1, 0x42, 0x2E, 0xC9,
-    0x22, 0xFE, 0x6B, 0xE3, 0xD3, 0xF5, 0xAB, 0x44, 0xF8, 0x38, 0x84, 0x67, 0x70, 0xF1, 0x34, 0x3A,
-    0xFA, 0x28, 0x6B, 0xCF, 0x64, 0x37, 0x0D, 0x33, 0x2B, 0x4F, 0x7F, 0xBA, 0x36, 0xAE, 0x48, 0x5F,
-    0x6F, 0x16, 0x66, 0xAE, 0x83, 0xF7, 0x10, 0x95, 0xE0, 0x66, 0xEF, 0x2A, 0x79, 0xCF, 0x7F, 0xD5,
-    0xD3, 0xBD, 0xDC, 0x1E, 0x9B, 0x9F, 0xEC, 0xA7, 0xE4, 0xA5, 0x41, 0x1D, 0xA6, 0xA3, 0x54, 0x52,
-    0x66, 0x72, 0xE5, 0x0D, 0x0C, 0x68, 0x45, 0x91, 0xB8, 0xD4, 0xB5, 0xE5, 0xB6, 0x96, 0x66, 0xB9,
-    0xD5, 0x96, 0xF0, 0xE9, 0x78, 0x3E, 0x0B, 0xF3, 0x06, 0xBD, 0x0A, 0x58, 0xCA, 0x5E, 0x3B, 0xCD,
-    0x62, 0xDE, 0x84, 0x2F, 0xC5, 0x25, 0x62, 0xE0, 0x96, 0x6B, 0x1C, 0x2A, 0x72, 0x03, 0xF1, 0x16,
-    0x7D, 0xC7, 0x0E, 0x98, 0x96, 0xBD, 0x01, 0x3C, 0x87, 0xA3, 0x67, 0x7E, 0x30, 0xB0, 0x3B, 0xA7,
-    0xAC, 0xEB, 0xA7, 0x5F, 0x3A, 0xA5, 0xC9, 0x7B, 0x6A, 0xB9, 0x58, 0x63, 0xB3, 0xDF, 0xB0, 0x29,
-    0xFC, 0x28, 0x7F, 0x08, 0xDF, 0x37, 0x7E, 0x09, 0x86, 0x3D, 0xA8, 0xB8, 0x55, 0xF4, 0x5E, 0x6F,
-    0x6D, 0x5F, 0x54, 0x1C, 0x9E, 0x9A, 0xAF, 0xBF, 0x81, 0x0D, 0x7D, 0x62, 0x86, 0xCA, 0x01, 0xF1,
-    0xE8, 0x8A, 0xDC, 0xBB, 0x71, 0x03, 0x89, 0xF7, 0x96, 0x9F, 0xEA, 0x6E, 0x78, 0xE4, 0x15, 0x6A,
-    0x24, 0x3A, 0x73, 0xEC, 0x6F, 0xFF, 0x5F, 0x6B, 0x4F, 0x60, 0x11, 0x29, 0x12, 0x3A, 0x3D, 0xD4,
-    0xBC, 0x84, 0x11, 0xC7, 0x8C, 0xDB, 0x68, 0x4D, 0x87, 0xB7, 0x59, 0x34, 0x3E, 0x7F, 0xDE, 0x29,
-    0x54, 0x28, 0x32, 0xAF, 0xAC, 0x1F, 0x73, 0xFD, 0xF1, 0x2F, 0x5B, 0x74, 0xD3, 0xB0, 0xF5, 0x10,
-    0x9B, 0x72, 0x6F, 0x05, 0xC5, 0xF6, 0x7C, 0x29, 0x4B, 0x75, 0xC7, 0xF7, 0x40, 0xF3, 0x8A, 0xF5,
-    0xE5, 0x6E, 0xC8, 0xD2, 0x05, 0x91, 0x05, 0xB2, 0x6D, 0xB8, 0x1B, 0xD1, 0x40, 0xCE, 0x6C, 0xCB,
-    0x96, 0x6D, 0x74, 0x67, 0xCB, 0x74, 0x91, 0xD1, 0x35, 0x87, 0x7E, 0xB5, 0x54, 0x6B, 0xA3, 0x67,
-    0xEC, 0xCE, 0xE1, 0xCA, 0xF7, 0x34, 0x8C, 0xEC, 0x71, 0xCA, 0x7F, 0x8D, 0x0E, 0x25, 0xF1, 0x27,
-    0xC5, 0xE8, 0x85, 0x74, 0xF1, 0xCD, 0xF1, 0x16, 0x4A, 0xF8, 0xFA, 0x2B, 0x69, 0x05, 0x3E, 0x15,
-    0xA1, 0xD3, 0x33, 0x09, 0x98, 0x7C, 0xC8, 0x98, 0x84, 0x1A, 0x36, 0xEC, 0x36, 0xF6, 0xF3, 0x5F,
-    0xC2, 0xC1, 0x00, 0xB6, 0x86, 0x9B, 0xFE, 0x8C, 0xE6, 0x3B, 0x0F, 0xE8, 0x0E, 0x83, 0xA8, 0x30,
-    0xBF, 0xD1, 0xE6, 0x95, 0xD3, 0x7A, 0x74, 0x95, 0x6E, 0x58, 0x75, 0xFD, 0x25, 0xA5, 0x46, 0x85,
-    0xFB, 0xF0, 0xDE, 0x57, 0x50, 0x04, 0x79, 0x98, 0x15, 0x98, 0xE1, 0x21, 0xDA, 0x62, 0x1C, 0xAF,
-    0x11, 0x2A, 0x63, 0xF3, 0x44, 0x2B, 0x61, 0xCD, 0xEC, 0xF6, 0x15, 0xC1, 0xB1, 0x31, 0x3C, 0x71,
-    0xFD, 0xB1, 0x1A, 0x30, 0xC6, 0x8F, 0xCE, 0x74, 0x8B, 0xEF, 0x51, 0xED, 0xA1, 0xE3, 0xC6, 0x12,
-    0x73, 0x5A, 0xD3, 0x22, 0xF1, 0x87, 0x5A, 0x3A, 0x75, 0x47, 0x48, 0x1D, 0x79, 0xF5, 0x2B, 0x2A,
-    0x9F, 0x9E, 0x56, 0x8B, 0x1D, 0x63, 0xB3, 0x48, 0x53, 0x33, 0xFF, 0x3B, 0x8D, 0xF1, 0x4D, 0x4B,
-    0x6C, 0xA4, 0x1E, 0x8F, 0xA4, 0x99, 0x76, 0xE4, 0x0E, 0x4D, 0x9A, 0xF5, 0xB7, 0xA5, 0xE0, 0x1A,
-    0x5F, 0x57, 0x14, 0x70, 0x3F, 0x2A, 0x72, 0xCF, 0x2C, 0x41, 0x0D, 0x3C, 0x7A, 0x60, 0x32, 0xB0,
-    0x92, 0x3D, 0xE9, 0x99, 0xEB, 0x0B, 0x5A, 0xDD, 0x0C, 0x37, 0x35, 0x3F, 0xBF, 0xC2, 0xB6, 0xAA,
-    0x35, 0x6D, 0x31, 0x1D, 0x52, 0xFA, 0xDE, 0x03, 0xBB, 0xE5, 0x8F, 0xB4, 0xB7, 0x52, 0x70, 0xC7,
-    0x2F, 0x65, 0xF5, 0xA3, 0xE0, 0x3A, 0x4A, 0xB7, 0xF4, 0x89, 0x59, 0x52, 0x19, 0xB4, 0x89, 0xC4,
-    0x32, 0x60, 0xE1, 0xB9, 0x47, 0x76, 0x38, 0x09, 0x96, 0x8E, 0xDC, 0x36, 0xFB, 0x51, 0xC3, 0x3E,
-    0x79, 0xC2, 0xF5, 0x22, 0x3E, 0x40, 0x8C, 0x24, 0xF4, 0xAB, 0x59, 0xB0, 0x1E, 0xE8, 0x53, 0x97,
-    0xBA, 0xE9, 0xFD, 0x51, 0xC6, 0x77, 0x3C, 0x1E, 0x26, 0x2A, 0x9E, 0x63, 0xD0, 0x7B, 0xD7, 0xDE,
-    0xEA, 0xD4, 0x9B, 0x66, 0xE5, 0x3F, 0x20, 0xC2, 0x42, 0xDF, 0x04, 0x24, 0xAE, 0x3D, 0x51, 0x64,
-    0x47, 0x6E, 0xA0, 0x76, 0x3D, 0x8C, 0x67, 0xC8, 0xC4, 0x6C, 0xB4, 0x13, 0x11, 0x16, 0xFA, 0xB2,
-    0xA2, 0xB6, 0x8D, 0xB3, 0x61, 0x22, 0xEC, 0x1B, 0x41, 0xC2, 0xFD, 0x51, 0xF4, 0x3C, 0xBF, 0x66,
-    0x0E, 0x19, 0xB7, 0x43, 0x0A, 0x39, 0x08, 0x11, 0xB7, 0x3F, 0x5B, 0x06, 0x95, 0x53, 0xA4, 0xD5,
-    0xBD, 0xB2, 0xB8, 0x95, 0xE2, 0xE6, 0xBE, 0x14, 0xB8, 0x47, 0x71, 0x1B, 0x55, 0x6B, 0xC1, 0xB0,
-    0x18, 0x8E, 0xA2, 0x20, 0x15, 0x3C, 0xC5, 0xAA, 0xC1, 0x8C, 0x69, 0x8D, 0xC8, 0x5E, 0x2C, 0x3B,
-    0xDD, 0xE1, 0xC4, 0xAA, 0x95, 0x2B, 0x0B, 0xAE, 0x6C, 0xD4, 0xCB, 0xAD, 0x14, 0x2E, 0xF3, 0x36,
-    0xF6, 0xA2, 0xB8, 0x3A, 0xBD, 0xD3, 0x4F, 0x13, 0xE7, 0x89, 0x43, 0x77, 0xFF, 0x0D, 0xA5, 0x2B,
-    0xA7, 0x74, 0x29, 0x88, 0xC1, 0x74, 0xD1, 0x6E, 0xEC, 0xCA, 0xD4, 0xB9, 0x53, 0x20, 0x9B, 0x0B,
-    0x6D, 0xA9, 0x25, 0x34, 0x6F, 0xB1, 0x1B, 0x33, 0x9F, 0x27, 0x18, 0xA3, 0x79, 0xEB, 0x4A, 0xB0,
-    0x33, 0xDF, 0x5A, 0x35, 0x4C, 0xC6, 0x9A, 0x1B, 0xBA, 0xDF, 0xE7, 0x47, 0x38, 0x7D, 0xEF, 0x8A,
-    0x3E, 0x82, 0xDB, 0xC4, 0x74, 0x08, 0x4A, 0x58, 0x20, 0x3E, 0x06, 0xE5, 0xF6, 0x2E, 0x77, 0xB5,
-    0xE1, 0x94, 0xAF, 0x16, 0x55, 0x40, 0x10, 0x09, 0xFB, 0x5C, 0xBA, 0xB9, 0xB0, 0xE4, 0x95, 0x66,
-    0x2E, 0xA7, 0x5C, 0x6B, 0xAE, 0xBD, 0x06, 0xC9, 0x54, 0xCF, 0xA2, 0xAA, 0x74, 0x57, 0x59, 0xA7,
-    0x0E, 0x7A, 0x63, 0xE2, 0x53, 0x15, 0xB3, 0xA9, 0x62, 0x49, 0x3E, 0xED, 0x19, 0xAC, 0x0B, 0x8C,
-    0xA9, 0x7C, 0xA1, 0xE7, 0x50, 0x05, 0x4D, 0xA9, 0x29, 0xF4, 0xCE, 0xBC, 0x35, 0x99, 0x31, 0x21,
-    0x1B, 0xD7, 0x51, 0x95, 0x16, 0xCC, 0x17, 0x0F, 0xA6, 0xF3, 0x3B, 0x22, 0x2C, 0x6A, 0xE2, 0x22,
-    0xAE, 0xB9, 0x7B, 0xB5, 0x14, 0xAC, 0x0D, 0xEC, 0xC8, 0x08, 0x66, 0xA9, 0xCC, 0xC8, 0xC3, 0x01,
-    0xD3, 0x97, 0xC4, 0x41, 0x60, 0xBE, 0xC2, 0xEF, 0x4E, 0xCB, 0xB3, 0xF5, 0x9C, 0xC5, 0xF7, 0xB0,
-    0x7D, 0x81, 0x78, 0x12, 0xC5, 0xE3, 0xB9, 0xA3, 0x18, 0xB9, 0xAF, 0xD8, 0x8C, 0x51, 0xA5, 0x3B,
-    0xA6, 0x71, 0x98, 0x77, 0xD6, 0x25, 0xF5, 0xD8, 0x60, 0xB6, 0xEB, 0x6F, 0xAC, 0x8E, 0xB9, 0xB3,
-    0x1E, 0x9D, 0xA2, 0x5F, 0xD8, 0x35, 0x6C, 0x3A, 0xD0, 0x2F, 0xA6, 0x83, 0x6B, 0x09, 0x71, 0xD4,
-    0x4D, 0x0D, 0x0D, 0x80, 0x59, 0xDE, 0x87, 0xB0, 0x9B, 0x06, 0xA2, 0x58, 0x3C, 0x44, 0x6B, 0xC8,
-    0xD8, 0xE5, 0xF6, 0x2C, 0xF6, 0x40, 0x55, 0x32, 0xAF, 0xF8, 0x18, 0xD0, 0x54, 0x1D, 0x8D, 0xF3,
-    0xD4, 0x24, 0x85, 0x07, 0x3B, 0xE9, 0x84, 0xAB, 0x6C, 0x28, 0x39, 0xE0, 0x83, 0x10, 0xAC, 0xE7,
-    0xED, 0x70, 0x77, 0x6B, 0x5A, 0x25, 0x71, 0x15, 0x57, 0x7C, 0xFA, 0xC0, 0x80, 0xB3, 0x7E, 0x3E,
-    0x6C, 0x52, 0x6A, 0xAA, 0x2A, 0x0F, 0xE8, 0xBC, 0xB4, 0x41, 0x8B, 0x9C, 0x61, 0xFA, 0x74, 0x96,
-    0x9C, 0x87, 0xB0, 0xEE, 0x48, 0x48, 0xD8, 0x6A, 0xF9, 0x26, 0xA2, 0xBE, 0x83, 0xBD, 0x6B, 0x74,
-    0xAF, 0xB7, 0x16, 0x73, 0xF2, 0x42, 0xDB, 0x12, 0x16, 0x40, 0xCF, 0x96, 0xD8, 0x51, 0x59, 0xD1,
-    0xB1, 0xA1, 0xB2, 0xA0, 0xB2, 0x9F, 0x3C, 0xEE, 0x17, 0x97, 0xDB, 0x03, 0xB1, 0xF8, 0x25, 0x37,
-    0x09, 0xFE, 0x1F, 0xF7, 0x44, 0x74, 0xAB, 0x96, 0x47, 0x58, 0xC2, 0xD8, 0xE6, 0x64, 0x2E, 0xD5,
-    0x01, 0x9E, 0xEE, 0xBC, 0x00, 0xEF, 0x94, 0x45, 0xA8, 0xC7, 0x4B, 0xF5, 0xDC, 0x36, 0x49, 0xD6,
-    0xB0, 0x81, 0x9A, 0x25, 0xB6, 0xE3, 0x27, 0xEF, 0x55, 0x8B, 0xBD, 0xAE, 0x13, 0xB7, 0x3B, 0xB2,
-    0xBE, 0xA6, 0x7D, 0xAB, 0x84, 0xAE, 0xDC, 0xCE, 0xE6, 0x15, 0xD4, 0x54, 0xCD, 0xBB, 0xB7, 0xD0,
-    0x27, 0x3A, 0x71, 0x3A, 0xB0, 0xB1, 0x86, 0xA0, 0x9C, 0xC5, 0x6D, 0x3D, 0xC3, 0x58, 0x16, 0xFE,
-    0xBF, 0x29, 0x56, 0x73, 0xB7, 0xFB, 0x7A, 0xCC, 0xC3, 0x4E, 0xAC, 0x26, 0x42, 0x23, 0x60, 0x76,
-    0xC4, 0x16, 0x90, 0x9D, 0x19, 0xEB, 0x97, 0x95, 0xC7, 0xF3, 0x3A, 0xE5, 0xC9, 0xC2, 0xCB, 0xA2,
-    0x3A, 0x12, 0x36, 0x47, 0xB3, 0x3B, 0x14, 0xCC, 0x9D, 0x16, 0x5C, 0x39, 0xEB, 0x0E, 0x1D, 0xDA,
-    0xD2, 0x82, 0x16, 0x54, 0x9C, 0x7C, 0xCC, 0x13, 0x2D, 0xB9, 0x5E, 0x6D, 0x59, 0x49, 0x17, 0xDB,
-    0xB6, 0xB5, 0x81, 0x44, 0x13, 0x62, 0xBA, 0xC1, 0xBA, 0x9B, 0xEF, 0x0E, 0x27, 0xF0, 0x4F, 0xBA,
-    0x0A, 0x71, 0xB6, 0xE7, 0x84, 0x18, 0xEF, 0x55, 0xEF, 0x55, 0xEE, 0x04, 0x02, 0x0F, 0x47, 0x9D,
-    0x76, 0x67, 0x70, 0x10, 0x34, 0xFE, 0xFE, 0xA7, 0xDF, 0xEA, 0xEE, 0x96, 0x27, 0x2C, 0xF6, 0xDE,
-    0x62, 0xA3, 0x19, 0xBC, 0xD7, 0x8D, 0x19, 0xF1, 0x29, 0xEC, 0x30, 0x51, 0x0F, 0x59, 0x0D, 0x6C,
-    0xCC, 0xC2, 0x05, 0xC4, 0x58, 0x8C, 0x2F, 0xB3, 0x9E, 0x3C, 0x94, 0xC4, 0x1B, 0x58, 0xF3, 0x89,
-    0xC8, 0x9D, 0x6C, 0xF0, 0x01, 0x5E, 0xDD, 0xDE, 0x96, 0x6C, 0x91, 0xF5, 0x71, 0x35, 0xA3, 0xAB,
-    0x23, 0xA1, 0x1B, 0x1C, 0xB1, 0x27, 0xD8, 0x78, 0xC1, 0xD0, 0xD6, 0x79, 0xE1, 0x4B, 0xC7, 0x84,
-    0xD2, 0x74, 0x27, 0xED, 0x58, 0xB8, 0xE4, 0x31, 0x87, 0xAC, 0xD2, 0xDF, 0xBD, 0x37, 0x80, 0x14,
-    0x7E, 0x65, 0xD5, 0x06, 0xE5, 0xE8, 0x21, 0x1C, 0xB6, 0xB6, 0xEC, 0xA3, 0x38, 0x9D, 0xA1, 0x40,
-    0xE9, 0xBF, 0x4A, 0xC1, 0x65, 0x61, 0xA1, 0xB7, 0x32, 0xCD, 0x11, 0x35, 0x63, 0xC7, 0x4E, 0xD8,
-    0x8D, 0x9B, 0xF4, 0x09, 0xBF, 0x3F, 0xCC, 0xB7, 0x90, 0xA9, 0x88, 0x15, 0xE3, 0xF6, 0x2B, 0x94,
-    0x65, 0x2B, 0x99, 0xC1, 0xE3, 0xD1, 0x0C, 0x6F, 0x61, 0x9A, 0x14, 0x33, 0x24, 0xE7, 0x90, 0xB7,
-    0xF9, 0x84, 0xCD, 0xC8, 0xA9, 0xDD, 0xDB, 0xEF, 0x72, 0x2D, 0xE5, 0x48, 0x24, 0x83, 0x42, 0xD7,
-    0x07, 0x3E, 0xEB, 0xB3, 0xB0, 0x3D, 0x2A, 0x80, 0x45, 0x59, 0xD0, 0x05, 0x15, 0x60, 0xF3, 0xC7,
-    0x6A, 0x9A, 0x1D, 0xFF, 0x67, 0x6A, 0x92, 0x65, 0xEE, 0xA9, 0x40, 0xF7, 0x1C, 0xD4, 0x0F, 0x7A,
-    0xEC, 0x3E, 0xDA, 0xD9, 0x2A, 0x3F, 0x94, 0x39, 0x3E, 0x5D, 0x82, 0xE6, 0xE0, 0x5C, 0xD4, 0xE2,
-    0x6E, 0x2E, 0x22, 0x5C, 0xDC, 0x3E, 0xA7, 0x5E, 0xF0, 0xA4, 0x29, 0x3D, 0x5A, 0x02, 0x65, 0xFE,
-    0x36, 0xD9, 0xD9, 0x3A, 0xD9, 0x8B, 0xF6, 0xF2, 0x87, 0x00, 0x69, 0x67, 0x30, 0xBF, 0xCD, 0x1E,
-    0x72, 0xF7, 0xE7, 0xD5, 0x48, 0x4D, 0x4E, 0x9F, 0xCC, 0x53, 0x4F, 0x8A, 0xDE, 0x76, 0x17, 0x7A,
-    0xA9, 0xA6, 0xFC, 0xF1, 0xC4, 0xD9, 0x88, 0x2C, 0x88, 0x93, 0x16, 0xFC, 0x19, 0xA6, 0xE1, 0xAE,
-    0xA0, 0x92, 0x1D, 0x05, 0x44, 0x6A, 0xAD, 0xC7, 0xE0, 0x3A, 0xA0, 0x5E, 0x75, 0x84, 0x01, 0x35,
-    0x12, 0xB5, 0x4F, 0xFB, 0xC5, 0xA1, 0xEB, 0x8F, 0x5A, 0xEE, 0x98, 0xB5, 0x7D, 0xBA, 0xE6, 0x0F,
-    0x91, 0xF8, 0x4E, 0x01, 0xBA, 0xF2, 0x9B, 0x05, 0xBA, 0x0A, 0x85, 0x37, 0x5D, 0x26, 0x49, 0x63,
-    0xBE, 0x07, 0x23, 0x08, 0xC7, 0xEC, 0x9C, 0xF8, 0x0D, 0x9F, 0x0D, 0x5B, 0xA7, 0x76, 0xC6, 0xA4,
-    0xDC, 0x1C, 0x2D, 0xC6, 0x3C, 0xC7, 0x33, 0x7E, 0xB1, 0x79, 0x2F, 0x40, 0x5E, 0x5D, 0x8B, 0x8B,
-    0x7A, 0x7E, 0x65, 0xDA, 0x2E, 0xAA, 0xA3, 0xB7, 0x31, 0x5F, 0x4A, 0xB0, 0xF0, 0x63, 0x57, 0x32,
-    0xCC, 0x0D, 0x2D, 0xCE, 0xE7, 0x96, 0x0C, 0x91, 0x9E, 0x04, 0xEC, 0xF0, 0xB4, 0xDF, 0xFD, 0x54,
-    0x70, 0x85, 0xDE, 0x47, 0x34, 0xE6, 0x47, 0x04, 0x33, 0x74, 0xB5, 0xF2, 0xF9, 0x26, 0xC0, 0x91,
-    0x4F, 0x45, 0x8F, 0x14, 0xD6, 0x78, 0x68, 0x02, 0xEA, 0x44, 0x8B, 0xE6, 0xE5, 0xC5, 0x2D, 0x7B,
-    0x4A, 0xE6, 0xF8, 0xC3, 0x82, 0xA2, 0x48, 0xFD, 0xC5, 0x7A, 0xB0, 0xA7, 0xE8, 0xD8, 0xC7, 0x3B,
-    0x9C, 0x2B, 0x07, 0x03, 0x72, 0x2F, 0x5D, 0x0E, 0x88, 0x3E, 0xF5, 0x24, 0x20, 0xBA, 0xA9, 0x6F,
-    0xF2, 0x6D, 0xF6, 0xCA, 0xF0, 0x40, 0x3D, 0xF3, 0xFF, 0x6D, 0x92, 0xB1, 0x72, 0xD4, 0x30, 0x10,
-    0x86, 0x7F, 0x5B, 0xC9, 0x39, 0x41, 0x85, 0x28, 0x52, 0x30, 0x34, 0xE2, 0x09, 0x70, 0x43, 0x4B,
-    0x56, 0xC9, 0x95, 0x34, 0x37, 0x3C, 0x03, 0x05, 0x3D, 0x29, 0x28, 0x32, 0x27, 0x03, 0x05, 0x4F,
-    0x40, 0x4F, 0x99, 0x92, 0x19, 0xDA, 0xCB, 0xD9, 0xC9, 0x15, 0x29, 0x68, 0x34, 0x34, 0x69, 0xCD,
-    0xA4, 0xC8, 0x0C, 0x34, 0x1A, 0xC6, 0x85, 0x2F, 0x23, 0x79, 0x91, 0x1D, 0xE8, 0xD8, 0x4E, 0xAB,
-    0xD5, 0xEA, 0xDF, 0xFF, 0x5B, 0x40, 0x18, 0xE1, 0x33, 0x06, 0x79, 0x31, 0x80, 0x5C, 0x1E, 0xA0,
-    0x30, 0xC5, 0xE7, 0x2C, 0x88, 0x20, 0x7B, 0xED, 0xA9, 0x59, 0xE3, 0xED, 0x98, 0xC9, 0x00, 0xE9,
-    0x51, 0x30, 0x04, 0xFB, 0x3C, 0x0E, 0x59, 0xD0, 0x4D, 0xCC, 0xFB, 0x73, 0xD0, 0x3E, 0xF2, 0xE9,
-    0x49, 0x6D, 0x4E, 0xCA, 0x41, 0x6E, 0xF8, 0x2E, 0x90, 0xE2, 0xF7, 0x8E, 0xFC, 0x0E, 0x5E, 0x8D,
-    0xF9, 0x9C, 0x39, 0x10, 0xF3, 0x86, 0xB9, 0x4F, 0xA7, 0xC2, 0xE0, 0x8D, 0xC7, 0x29, 0x9B, 0xA5,
-    0x66, 0xCE, 0x98, 0x8D, 0xDC, 0xE2, 0xC1, 0x3C, 0xDA, 0xDB, 0x48, 0xCD, 0x58, 0x2D, 0x42, 0x1E,
-    0xAC, 0xA3, 0xEB, 0x58, 0x44, 0xAA, 0xA6, 0xD4, 0x6C, 0x8B, 0x9A, 0xE5, 0xDD, 0x40, 0x59, 0x58,
-    0x09, 0xBF, 0xD0, 0x55, 0x16, 0x50, 0x57, 0xC2, 0x43, 0x56, 0xD8, 0x49, 0xF7, 0x0B, 0xD4, 0xBE,
-    0xE4, 0xAB, 0xF6, 0x7C, 0x25, 0x7E, 0x35, 0x87, 0x2B, 0x71, 0xEB, 0xCF, 0x89, 0x2B, 0x6E, 0xC7,
-    0x6E, 0x66, 0x0F, 0x41, 0x38, 0x3B, 0x0F, 0x74, 0x31, 0x68, 0xC7, 0xAA, 0xB5, 0x45, 0x4B, 0xC7,
-    0x5E, 0x99, 0x87, 0x30, 0x78, 0x84, 0xD9, 0xBC, 0xCD, 0x02, 0x19, 0xCA, 0xA2, 0x72, 0xF2, 0x77,
-    0x8F, 0x92, 0x01, 0x76, 0x10, 0xFD, 0x34, 0xD0, 0x1E, 0x8C, 0x46, 0x50, 0xDE, 0x1E, 0x47, 0xE5,
-    0xE9, 0x22, 0x8A, 0xAE, 0x6C, 0x6C, 0xDE, 0x15, 0xCD, 0x21, 0x4C, 0x36, 0x55, 0xC8, 0x24, 0x7F,
-    0x9A, 0xA2, 0x27, 0xD0, 0xA6, 0x41, 0x78, 0x92, 0xBC, 0xC8, 0x5D, 0x28, 0x3F, 0xF8, 0xB5, 0x6A,
-    0x59, 0x75, 0xF5, 0x65, 0x6A, 0x25, 0xAB, 0xBA, 0xE1, 0xA3, 0x41, 0xF4, 0xCA, 0x59, 0xD1, 0xE9,
-    0x6A, 0xEC, 0x2E, 0x2B, 0xFE, 0x18, 0x4A, 0x57, 0x27, 0x9B, 0xBB, 0xC2, 0x4B, 0x27, 0xD3, 0xA4,
-    0x07, 0x6A, 0xE3, 0x83, 0xD5, 0x2F, 0x2E, 0xDB, 0x2F, 0x3B, 0xD0, 0xEF, 0x06, 0xF5, 0x23, 0x96,
-    0x57, 0x7E, 0xB5, 0x9F, 0xCA, 0x1F, 0xFF, 0x73, 0x68, 0x17, 0xBB, 0x22, 0x91, 0xB1, 0xCE, 0x5E,
-    0x87, 0x22, 0x96, 0x55, 0x59, 0xDD, 0xF3, 0xB2, 0x4E, 0xF3, 0xBC, 0x0D, 0xCF, 0x8B, 0x8D, 0x3B,
-    0x25, 0x75, 0xC1, 0x7E, 0x36, 0xFE, 0x52, 0x56, 0x7C, 0x94, 0x64, 0xAB, 0x66, 0x5D, 0xF8, 0xA7,
-    0xE3, 0xB9, 0xA5, 0x30, 0x8B, 0x88, 0x59, 0x28, 0xBA, 0xD2, 0xA5, 0xCC, 0x81, 0x74, 0x64, 0x96,
-    0x88, 0x60, 0xD4, 0x3F, 0x89, 0x65, 0xBF, 0xAC, 0xA7, 0x58, 0x4E, 0x40, 0x91, 0xB1, 0x4B, 0xB4,
-    0xD5, 0x4D, 0x28, 0x9B, 0xC1, 0x82, 0x5E, 0x63, 0xD4, 0x22, 0x0D, 0xBE, 0x76, 0x89, 0xE0, 0xA7,
-    0xF5, 0x44, 0x70, 0xC0, 0xEC, 0xEC, 0x5E, 0x82, 0x39, 0xD1, 0x31, 0xF1, 0xDF, 0x06, 0xD2, 0xBC,
-    0x99, 0xF8, 0x9F, 0x25, 0x47, 0x47, 0xF0, 0x23, 0xFF, 0xBF, 0x42, 0xFF, 0xEF, 0x19, 0xF0, 0x2C,
-    0xAD, 0x46, 0x42, 0x96, 0x00, 0xE8, 0x04, 0x20, 0xA4, 0x76, 0x80, 0x4A, 0xA6, 0x74, 0xD3, 0xE6,
-    0x2D, 0xB0, 0xA0, 0x86, 0xBE, 0xC5, 0x62, 0xA8, 0x1B, 0x7B, 0xD3, 0x8F, 0xF7, 0x49, 0x7C, 0xDE,
-    0xA9, 0x24, 0x9F, 0x5F, 0xF2, 0xF7, 0x08, 0xFC, 0x01, 0xED, 0x7D, 0x3D, 0x90, 0xE5, 0xD6, 0x95,
-    0xDE, 0xC5, 0x83, 0xBA, 0x61, 0x0D, 0x4A, 0x06, 0x03, 0x8E, 0x2C, 0x71, 0x56, 0x0B, 0x05, 0x0E,
-    0x24, 0x95, 0x24, 0x24, 0x76, 0x95, 0x02, 0x72, 0x00, 0x8A, 0xB6, 0x19, 0x28, 0x50, 0xDB, 0x9E,
-    0x26, 0xD7, 0x9A, 0x80, 0x0E, 0xE8, 0x2A, 0x89, 0xAA, 0x72, 0x6F, 0xE0, 0x40, 0x01, 0x39, 0x00,
-    0x8B, 0x2E, 0x33, 0xD8, 0x40, 0x6D, 0x17, 0xE9, 0x2A, 0x97, 0x03, 0x31, 0x18, 0xD6, 0x92, 0x6F,
-    0xCA, 0xDB, 0x0E, 0x36, 0xA0, 0xB7, 0x66, 0x06, 0x20, 0x19, 0x4C, 0xA0, 0xC0, 0x4F, 0xE2, 0x72,
-    0x19, 0x38, 0x10, 0xE4, 0x1D, 0xAD, 0xCC, 0x51, 0x40, 0x48, 0x7A, 0x5C, 0xA1, 0x9B, 0x00, 0xAE,
-    0xCF, 0xF7, 0x9D, 0x0B, 0xBC, 0xD7, 0x3D, 0x3D, 0xE4, 0x50, 0x43, 0x0E, 0x39, 0xDC, 0x6D, 0x72,
-    0xF0, 0xFF, 0x80, 0x8B, 0x7B, 0xCF, 0x3D, 0x3F, 0xDF, 0xF9, 0x81, 0x31, 0xFC, 0x6B, 0xB0, 0x88,
-    0x17, 0xB2, 0xF0, 0x6C, 0x21, 0xCB, 0xC8, 0x66, 0xB2, 0x4C, 0x06, 0x1E, 0x5E, 0x62, 0xB9, 0x69,
-    0xD6, 0xFF, 0x4E, 0x6E, 0xCB, 0x5F, 0x60, 0xE5, 0xAF, 0xCD, 0xB1, 0x2C, 0xE2, 0x83, 0xF9, 0x85,
-    0xD6, 0x58, 0xB9, 0xBA, 0x88, 0xE4, 0x66, 0xDC, 0x8C, 0x32, 0x6C, 0x6E, 0x61, 0x53, 0x76, 0xF8,
-    0x88, 0xF5, 0xCD, 0x3D, 0xBB, 0x94, 0xE7, 0x58, 0x79, 0x92, 0x2C, 0x9A, 0x63, 0x2E, 0x18, 0x37,
-    0xEF, 0xC6, 0xA6, 0xBF, 0xC0, 0xE6, 0x13, 0xD8, 0x0C, 0xB9, 0xD9, 0x6F, 0xE2, 0xC1, 0xAF, 0x62,
-    0xD1, 0x69, 0x1B, 0xCC, 0x3D, 0xE6, 0x44, 0x66, 0x82, 0xCE, 0xEF, 0x8D, 0x29, 0x17, 0x79, 0x6D,
-    0x42, 0x6E, 0x26, 0x59, 0x52, 0x98, 0xA3, 0x7F, 0x1F, 0xCB, 0x17, 0x60, 0xA3, 0xCE, 0x98, 0x18,
-    0x3B, 0xD6, 0xB0, 0x75, 0xB6, 0xF2, 0x86, 0xB9, 0x9D, 0xEF, 0x35, 0xE6, 0x9C, 0x49, 0x16, 0xA6,
-    0x93, 0xB7, 0x09, 0x97, 0xE6, 0xB4, 0x09, 0xAA, 0x59, 0x6F, 0xA2, 0xC2, 0x6B, 0x4C, 0x99, 0xF9,
-    0x95, 0x3C, 0x21, 0x59, 0xF0, 0xBD, 0x42, 0x0E, 0x96, 0x91, 0x93, 0xFC, 0x2B, 0xFF, 0xF9, 0x19,
-    0xAC, 0x12, 0x6B, 0xF7, 0x71, 0x52, 0xEE, 0x57, 0xCB, 0x49, 0x3B, 0xB7, 0x68, 0x5B, 0x99, 0x79,
-    0xD8, 0x95, 0x5F, 0x46, 0x9D, 0xFE, 0x52, 0xFA, 0x10, 0xBF, 0x4C, 0x1A, 0x9C, 0x34, 0x7E, 0xC7,
-    0x93, 0x6C, 0xB1, 0x9C, 0x4C, 0x2B, 0x9E, 0x8C, 0xA6, 0x93, 0x5E, 0xB9, 0x8F, 0x93, 0x01, 0x5E,
-    0x3E, 0x2D, 0x66, 0xD2, 0x95, 0x4A, 0x42, 0xE3, 0xFB, 0x9B, 0xA0, 0xE5, 0x0A, 0xF7, 0xC1, 0x4A,
-    0xDB, 0x14, 0x92, 0xA8, 0x4E, 0x94, 0x5C, 0xCD, 0xAC, 0x1E, 0xBC, 0x67, 0x77, 0x35, 0x34, 0x5F,
-    0xC5, 0x62, 0x18, 0xAF, 0x4C, 0x7B, 0xD0, 0xA4, 0x34, 0xD3, 0xC7, 0xDE, 0x2C, 0x3B, 0x3A, 0x88,
-    0x67, 0xD0, 0x75, 0x03, 0x17, 0x9E, 0x9D, 0x5F, 0xE8, 0xD1, 0xDA, 0xD5, 0xA2, 0xC3, 0xE2, 0x22,
-    0x16, 0x8F, 0x63, 0x71, 0x97, 0x8E, 0xC9, 0xAD, 0x2E, 0x36, 0xED, 0x9B, 0xD2, 0x30, 0x0C, 0x7C,
-    0xCE, 0x8E, 0x34, 0x9B, 0x7F, 0x21, 0xED, 0x97, 0x7E, 0x90, 0xB6, 0x5A, 0x2C, 0xA3, 0xE1, 0xFE,
-    0x7C, 0x89, 0xDE, 0x8C, 0x17, 0xA1, 0xF4, 0x41, 0x9A, 0xE5, 0x42, 0x81, 0x3D, 0xFA, 0x61, 0xD6,
-    0xA0, 0x6F, 0x82, 0x2A, 0xC7, 0x8B, 0xCC, 0xBA, 0x55, 0x67, 0xA5, 0x7F, 0x35, 0xBF, 0xC4, 0x5F,
-    0xB7, 0xC6, 0xC7, 0xB0, 0x8F, 0x87, 0xAB, 0xE9, 0xC9, 0xDA, 0x7F, 0x21, 0xFB, 0x34, 0xC6, 0xC9,
-    0x3A, 0x6D, 0x40, 0x4B, 0xA5, 0x74, 0x4E, 0x5E, 0xC8, 0x18, 0x84, 0xF2, 0xCA, 0xC3, 0x43, 0xB2,
-    0x51, 0x82, 0x7C, 0x30, 0xE8, 0xD2, 0x2A, 0xEF, 0x7B, 0xF2, 0x24, 0x6F, 0xBE, 0x6B, 0x38, 0x3E,
-    0x72, 0x62, 0x91, 0x2E, 0xFF, 0x51, 0x2F, 0xE3, 0x19, 0x2D, 0xD0, 0x49, 0x51, 0x6D, 0xA2, 0x97,
-    0xA5, 0x67, 0x2F, 0xCA, 0x1D, 0x37, 0x8C, 0x3C, 0x56, 0x88, 0x24, 0xC3, 0xCB, 0xE1, 0xA9, 0x03,
-    0x06, 0x68, 0xC0, 0x9B, 0xF5, 0x58, 0x2C, 0xB1, 0xC0, 0x15, 0xC3, 0x86, 0xDC, 0xFD, 0xB7, 0xF2,
-    0x58, 0x9B, 0x4A, 0xF3, 0x7F, 0xDB, 0x18, 0x6F, 0x48, 0x0B, 0x93, 0xBC, 0xD6, 0xCB, 0x8C, 0x4B,
-    0xF7, 0x1F, 0xB6, 0x0F, 0xE0, 0x31, 0x21, 0x68, 0x0D, 0x0F, 0x96, 0x51, 0xCA, 0x31, 0x42, 0xAD,
-    0x87, 0x99, 0x62, 0x7E, 0xEF, 0xFF, 0x37, 0xED, 0x55, 0xE9, 0x73, 0xB9, 0xD5, 0x89, 0xEC, 0xC4,
-    0x03, 0x9D, 0x3F, 0xE4, 0x8B, 0xF4, 0x77, 0xBD, 0x3F, 0x24, 0x45, 0xBC, 0x36, 0xBD, 0x37, 0xB6,
-    0xB7, 0xEF, 0x97, 0x17, 0x8D, 0xA5, 0xD9, 0x41, 0xCF, 0xEE, 0x43, 0xAF, 0xDF, 0xDA, 0x0A, 0x74,
-    0x2E, 0x73, 0x34, 0x06, 0x8B, 0x11, 0x82, 0x93, 0x17, 0x6B, 0x12, 0x3B, 0x64, 0x1B, 0x56, 0xA7,
-    0x08, 0x06, 0x0A, 0xC3, 0x64, 0xCD, 0x07, 0xB5, 0xEB, 0x0D, 0xD3, 0x8C, 0xC3, 0xA0, 0x0B, 0x27,
-    0x8B, 0x2D, 0x27, 0x81, 0xF7, 0xFF, 0xDC, 0x3B, 0x6E, 0x6F, 0x6F, 0x91, 0x4B, 0x93, 0xF1, 0xB8,
-    0x8D, 0x1A, 0xE7, 0x76, 0xDE, 0xDC, 0xD3, 0x19, 0x15, 0x57, 0x6E, 0xF6, 0xC5, 0xC5, 0x7B, 0x6F,
-    0x24, 0xD9, 0xD1, 0x8D, 0xD4, 0x04, 0xC3, 0xF3, 0x99, 0x6E, 0x90, 0xAE, 0x75, 0xC3, 0xCA, 0xFC,
-    0xCE, 0x85, 0xC5, 0x9E, 0x2C, 0xE5, 0xB1, 0x97, 0x31, 0xC1, 0xC1, 0x3A, 0x2E, 0x61, 0x03, 0xED,
-    0xEF, 0xB0, 0x21, 0x4C, 0xC2, 0xE3, 0x86, 0xBC, 0xC6, 0xAC, 0x75, 0x1B, 0x7E, 0xC3, 0x0D, 0xA1,
-    0x90, 0x46, 0x2F, 0xFE, 0xC7, 0xC2, 0x2A, 0x64, 0x23, 0xE8, 0xD2, 0xB2, 0xC0, 0x46, 0xB2, 0xCC,
-    0xC1, 0x7C, 0x87, 0x0B, 0x76, 0x51, 0xF6, 0x9C, 0x02, 0x36, 0xCB, 0x1B, 0x6E, 0x5C, 0x35, 0xF7,
-    0x64, 0xD3, 0x8C, 0x3F, 0xC3, 0x7F, 0xE0, 0x91, 0x59, 0x82, 0x19, 0x28, 0x8D, 0x2A, 0x42, 0x8C,
-    0x0C, 0xC7, 0xFB, 0x54, 0xE7, 0xA6, 0x8B, 0x37, 0x8C, 0xB3, 0x27, 0x2F, 0xDC, 0x1C, 0x8B, 0x6B,
-    0xC7, 0x8B, 0xF4, 0x15, 0x6F, 0xEE, 0x22, 0xFE, 0xE9, 0x6C, 0xA7, 0xB0, 0xD0, 0xAE, 0xC6, 0x04,
-    0x75, 0x17, 0x25, 0xDD, 0x78, 0x27, 0x3B, 0xDE, 0x29, 0x59, 0xB8, 0x3B, 0x05, 0xAD, 0xBB, 0x48,
-    0x4E, 0xBB, 0x8B, 0xF2, 0xCC, 0x5D, 0x94, 0x8E, 0x17, 0xC5, 0xCD, 0x78, 0xA7, 0xE5, 0xA6, 0x3D,
-    0x2F, 0x54, 0x3E, 0xB7, 0xCB, 0x08, 0x02, 0x49, 0x1E, 0xB2, 0x0C, 0x74, 0x22, 0xD9, 0xDD, 0x23,
-    0x92, 0xEB, 0x8C, 0x90, 0x83, 0x0E, 0xBE, 0x93, 0x12, 0x26, 0xBE, 0xB6, 0x77, 0x30, 0x97, 0x87,
-    0x38, 0x31, 0x31, 0x5B, 0x42, 0x30, 0xD4, 0xA3, 0x9C, 0x30, 0x31, 0x08, 0xEA, 0x5E, 0xB3, 0x12,
-    0x14, 0xE0, 0xE1, 0xEB, 0x92, 0x22, 0x5C, 0x6E, 0xA8, 0xA8, 0x78, 0xCB, 0x52, 0xF6, 0x97, 0x94,
-    0xA8, 0x32, 0xFF, 0x0F, 0xF6, 0xB0, 0x1F, 0x82, 0x2D, 0x19, 0xCA, 0x03, 0xB2, 0x73, 0xF9, 0x35,
-    0x28, 0x94, 0xD2, 0x62, 0xA1, 0xD4, 0x8A, 0x3E, 0x94, 0x6D, 0x76, 0xAA, 0x9C, 0x46, 0x07, 0xE2,
-    0x34, 0x7A, 0xD4, 0x9D, 0xC6, 0x44, 0x0A, 0xE4, 0x5D, 0x72, 0xF0, 0x6A, 0x5B, 0x0B, 0x47, 0x5A,
-    0x86, 0xFA, 0x34, 0xF7, 0x17, 0x70, 0x5B, 0xD9, 0xA2, 0x67, 0xC9, 0xFA, 0x4A, 0x8E, 0x43, 0xAA,
-    0xBC, 0x6F, 0x9F, 0x57, 0xFD, 0xDB, 0xEB, 0x85, 0xB9, 0xF4, 0xC7, 0x73, 0x01, 0xA6, 0x80, 0xAD,
-    0x84, 0xD1, 0x60, 0x50, 0x44, 0x6B, 0x01, 0xB3, 0x92, 0x36, 0x0F, 0x7F, 0x84, 0x91, 0x85, 0x0E,
-    0x60, 0x41, 0x86, 0xD8, 0xB9, 0xC4, 0xF1, 0x8F, 0x2A, 0xEC, 0xE0, 0x90, 0xEC, 0x9C, 0x23, 0x01,
-    0xE0, 0x90, 0xC1, 0x30, 0x73, 0x4E, 0x71, 0xE7, 0xB1, 0x5E, 0xCF, 0xE8, 0x65, 0x78, 0x49, 0xF9,
-    0x4D, 0xCF, 0x9D, 0x58, 0xEF, 0x56, 0xEA, 0xAD, 0x55, 0x36, 0x42, 0x76, 0x82, 0x5D, 0x91, 0x81,
-    0x07, 0xE0, 0x5A, 0xE7, 0xA5, 0x39, 0x3E, 0xDA, 0x56, 0x36, 0xB9, 0xCC, 0xA4, 0x99, 0xBE, 0xD7,
-    0xEC, 0xFC, 0xAA, 0xFD, 0xB5, 0xAE, 0x92, 0x4A, 0x47, 0xC4, 0x2A, 0x3F, 0x8B, 0xAD, 0x3B, 0xEC,
-    0x46, 0x28, 0x51, 0xA1, 0x7A, 0x44, 0x13, 0x5B, 0x75, 0xC0, 0xF6, 0xF6, 0x83, 0x98, 0x9F, 0xD4,
-    0x26, 0x5A, 0xC8, 0xFA, 0x0C, 0x9A, 0xDB, 0x6C, 0x50, 0xF1, 0x21, 0xD3, 0x0D, 0xAF, 0x80, 0x56,
-    0x92, 0xB7, 0xEB, 0x6E, 0xAA, 0xBB, 0x91, 0xEE, 0xFA, 0x83, 0xEE, 0x5A, 0xBD, 0x38, 0x7D, 0x99,
-    0xBB, 0x51, 0xC3, 0x5D, 0xBF, 0xF3, 0xB8, 0x5B, 0xEA, 0xAD, 0x92, 0x8A, 0xBB, 0x32, 0x9D, 0xB1,
-    0xFB, 0x9B, 0xCE, 0x70, 0xB7, 0xD4, 0x07, 0xC9, 0x2B, 0x72, 0xB7, 0xD1, 0x5D, 0x19, 0x4F, 0xAF,
-    0x3F, 0xD4, 0x0C, 0xD9, 0x45, 0xC7, 0x98, 0xFC, 0xC0, 0x47, 0x9B, 0x4B, 0xB4, 0xB9, 0x77, 0x5D,
-    0xFE, 0xA8, 0xF9, 0x34, 0x7A, 0x41, 0x94, 0x89, 0x8A, 0xB4, 0x80, 0x6E, 0x11, 0xA2, 0xCA, 0x2B,
-    0xA5, 0x4A, 0xED, 0x1A, 0xE5, 0x52, 0x27, 0x8F, 0xD3, 0xEB, 0x84, 0x3F, 0x9E, 0x29, 0x85, 0xFF,
-    0xA7, 0xB8, 0xA9, 0xFC, 0xDC, 0xB6, 0x9B, 0xA0, 0x31, 0x21, 0x49, 0xAC, 0x30, 0x07, 0x2B, 0x30,
-    0x28, 0x99, 0x81, 0xC6, 0x6F, 0x29, 0x4A, 0x03, 0x8C, 0xA3, 0x48, 0xC4, 0x9A, 0xF3, 0x10, 0x8F,
-    0x15, 0x1A, 0x07, 0xC1, 0xC8, 0x63, 0x53, 0xE5, 0x15, 0x97, 0xB1, 0xCA, 0x0B, 0x52, 0x66, 0xFA,
-    0x8A, 0xCA, 0xE0, 0xBF, 0xE6, 0x80, 0x84, 0xEF, 0x70, 0xF8, 0x7C, 0x37, 0xAC, 0x8E, 0x9C, 0xDD,
-    0xD8, 0x5D, 0xD2, 0x15, 0x7F, 0xF6, 0xA9, 0x19, 0x75, 0xB3, 0xAF, 0x87, 0xBC, 0x3E, 0xD5, 0xEB,
-    0x53, 0xBD, 0x30, 0x51, 0x15, 0x69, 0x73, 0x77, 0xC5, 0xE4, 0xB6, 0xD1, 0x23, 0x29, 0x05, 0xA7,
-    0xAC, 0x28, 0x3C, 0x9D, 0x00, 0x75, 0x12, 0xF1, 0x23, 0x5F, 0x51, 0x7F, 0xA5, 0x50, 0x1E, 0x55,
-    0x30, 0x0B, 0x6D, 0x61, 0x7C, 0xF7, 0xC3, 0xAB, 0xCB, 0xBA, 0x3A, 0xA7, 0xAB, 0x27, 0x74, 0x75,
-    0xEF, 0xA1, 0x95, 0x39, 0x44, 0xDF, 0xB9, 0xCE, 0x02, 0xED, 0x26, 0xCF, 0x2E, 0xB4, 0x93, 0x5D,
-    0x5F, 0x6B, 0xCF, 0xBF, 0xC1, 0x0E, 0x8D, 0x5E, 0x65, 0xE7, 0xC5, 0x4F, 0xE9, 0xE0, 0x78, 0x9C,
-    0x2E, 0xB9, 0x3E, 0xF7, 0x92, 0xAE, 0x3A, 0xDE, 0x4D, 0x48, 0x0A, 0xCC, 0xD7, 0x5F, 0x92, 0x65,
-    0xC9, 0xA0, 0x83, 0x35, 0x45, 0x2A, 0x42, 0xB1, 0x92, 0xBB, 0x25, 0xD7, 0xE6, 0x17, 0x40, 0x1A,
-    0x2A, 0xD9, 0x73, 0x9D, 0x3E, 0x03, 0x9E, 0x4F, 0x92, 0x11, 0x0A, 0x22, 0x73, 0x2A, 0x8B, 0xA0,
-    0xCF, 0x64, 0xAC, 0xAF, 0x96, 0x50, 0x7D, 0x95, 0x11, 0xCB, 0xFB, 0x53, 0x1F, 0x25, 0x43, 0xAE,
-    0x73, 0xEA, 0x81, 0x62, 0x54, 0x94, 0x0B, 0x55, 0x46, 0x85, 0xEA, 0xC3, 0x4A, 0x15, 0x51, 0xCC,
-    0xB4, 0xEC, 0x7A, 0x43, 0xE1, 0xED, 0x6D, 0x15, 0x38, 0xBB, 0x6C, 0x8C, 0x5C, 0xBB, 0xBD, 0x87,
-    0xC9, 0x67, 0x62, 0x4A, 0x18, 0xCA, 0x8B, 0x19, 0xE5, 0x48, 0x5C, 0x47, 0x8D, 0x13, 0x29, 0xDC,
-    0xF4, 0xA9, 0xEA, 0xE6, 0x15, 0xB8, 0x8F, 0xC8, 0x90, 0x79, 0xD9, 0x3B, 0xF1, 0xA9, 0xC3, 0xC1,
-    0xFE, 0xFB, 0x4E, 0x79, 0x9E, 0xA2, 0xA2, 0x45, 0x3B, 0xA5, 0xB5, 0x71, 0x03, 0x36, 0x23, 0xCA,
-    0x7B, 0x47, 0xA6, 0x85, 0x46, 0x7A, 0x6C, 0x64, 0xB4, 0xDA, 0x8C, 0xD1, 0x5E, 0x99, 0x22, 0x60,
-    0x71, 0x6C, 0x59, 0xC5, 0x96, 0xC9, 0xCF, 0xE6, 0xA2, 0xBD, 0xF3, 0x69, 0x78, 0x70, 0x89, 0x07,
-    0xFB, 0x6C, 0x64, 0x82, 0xCD, 0x99, 0xB6, 0x77, 0x75, 0xD4, 0xC2, 0xA2, 0xCA, 0x9B, 0x55, 0xCB,
-    0xCC, 0x5A, 0xCB, 0x3E, 0x2E, 0x3A, 0xBC, 0xA7, 0x4A, 0x55, 0xB4, 0x26, 0xE5, 0x85, 0x3A, 0x1E,
-    0xB9, 0x76, 0x81, 0xEC, 0xBF, 0xE2, 0xB0, 0x8F, 0xAB, 0x82, 0xAB, 0xD8, 0xAD, 0x94, 0x24, 0x12,
-    0x5D, 0xA5, 0xE6, 0x98, 0xD5, 0x39, 0x5D, 0x5D, 0xD2, 0x55, 0xB7, 0xBE, 0xF2, 0x5A, 0xAE, 0x84,
-    0x35, 0x60, 0xE5, 0xB3, 0xF7, 0x8C, 0x70, 0x08, 0xAC, 0x64, 0x28, 0xB0, 0x12, 0xFE, 0x87, 0x55,
-    0x4E, 0x9A, 0x3C, 0xC5, 0x59, 0x76, 0x5E, 0xE7, 0x5C, 0x37, 0xAE, 0x2A, 0x2A, 0x2D, 0x6E, 0x95,
-    0xB8, 0x55, 0x41, 0x2E, 0x1A, 0x83, 0x1F, 0x79, 0x4B, 0xB7, 0x8A, 0xD4, 0xDA, 0xFF, 0xB4, 0xCA,
-    0xD1, 0x8F, 0xA7, 0x15, 0x7F, 0x1E, 0x0A, 0xAE, 0x91, 0x95, 0x98, 0x37, 0x24, 0xD8, 0x85, 0x2F,
-    0x14, 0x24, 0x04, 0x13, 0xF7, 0x90, 0x57, 0x3E, 0xB4, 0xC3, 0x85, 0x77, 0xB6, 0x41, 0xC7, 0x94,
-    0x7F, 0x24, 0xFD, 0x83, 0x71, 0xA0, 0xE0, 0x86, 0xAC, 0x20, 0x93, 0x0D, 0x6A, 0x39, 0x94, 0xAB,
-    0x1E, 0x2B, 0x34, 0x49, 0x16, 0xD2, 0xCD, 0x3A, 0x8F, 0x7C, 0x3B, 0x5C, 0x24, 0x55, 0xAA, 0x4A,
-    0xEE, 0xAC, 0x0B, 0x16, 0xCA, 0x5E, 0xE4, 0xF1, 0x7A, 0x48, 0x75, 0x5C, 0xB9, 0xC5, 0x41, 0x7E,
-    0x4D, 0x59, 0x97, 0x95, 0xAB, 0xF8, 0xC3, 0x04, 0x3F, 0xC4, 0xBD, 0x02, 0xDC, 0xCB, 0x51, 0x52,
-    0x52, 0xD1, 0xE4, 0x4E, 0xF0, 0x44, 0x9C, 0x0C, 0xD8, 0x08, 0x32, 0x48, 0xB6, 0x0B, 0xE6, 0x1F,
-    0x9B, 0x9A, 0x2F, 0x60, 0xA0, 0xC9, 0x21, 0x5F, 0x98, 0x88, 0xBC, 0xA6, 0xE8, 0x42, 0x91, 0xD0,
-    0x77, 0xAD, 0xEF, 0xB8, 0x4C, 0x49, 0x74, 0x85, 0x67, 0x7F, 0xFE, 0x82, 0x9B, 0xB2, 0xE7, 0x65,
-    0xB0, 0x6B, 0x98, 0x6D, 0x83, 0x32, 0x04, 0xB9, 0x55, 0x59, 0xCB, 0xBB, 0xC4, 0x4D, 0x0C, 0xE5,
-    0x42, 0xAC, 0x9E, 0xB0, 0x89, 0x32, 0xD9, 0xDA, 0x74, 0x7D, 0x4D, 0xDD, 0x95, 0x0D, 0x84, 0x76,
-    0x06, 0xA5, 0x9D, 0xDA, 0x95, 0xAF, 0xA6, 0x41, 0x8E, 0x66, 0x42, 0x14, 0x53, 0x51, 0x56, 0x6B,
-    0xD2, 0xEF, 0x3F, 0x83, 0x45, 0x0A, 0x7A, 0x11, 0xFA, 0x0A, 0x3B, 0xE1, 0x56, 0x71, 0x93, 0xF6,
-    0xC2, 0x6E, 0xA1, 0x7E, 0x66, 0xB4, 0x19, 0xCD, 0x67, 0x5F, 0xFC, 0x84, 0x69, 0x18, 0x9F, 0x33,
-    0x9B, 0x19, 0xA7, 0xB3, 0x4A, 0xA5, 0x9E, 0x92, 0x5F, 0x34, 0x00, 0xD5, 0x85, 0x53, 0xAB, 0x0A,
-    0x58, 0xA9, 0x84, 0x70, 0x8C, 0x92, 0x81, 0x9E, 0xC8, 0xD0, 0x25, 0xEE, 0x96, 0x57, 0xF0, 0x8B,
-    0xD2, 0x2E, 0x21, 0x9F, 0x85, 0x12, 0xC6, 0xE7, 0xB3, 0x39, 0xA9, 0x36, 0x27, 0xD2, 0x5D, 0xDF,
-    0xF5, 0x8A, 0xD5, 0xDD, 0xF4, 0x2D, 0xEE, 0x46, 0xBF, 0xE6, 0xAE, 0xDF, 0x69, 0xDB, 0xAD, 0xFE,
-    0x36, 0xAD, 0xB8, 0x1B, 0x36, 0xDC, 0x15, 0xC2, 0xE1, 0x6E, 0xA9, 0x77, 0x16, 0x82, 0xC2, 0xEE,
-    0x3B, 0x8D, 0xEE, 0x76, 0xAE, 0x57, 0xDC, 0x73, 0xAB, 0xF5, 0x6E, 0x18, 0x7B, 0x65, 0xE7, 0x00,
-    0xD6, 0xD2, 0x73, 0xA9, 0x3C, 0x3B, 0x64, 0x9B, 0x39, 0x92, 0x77, 0xA8, 0xEE, 0xEC, 0x6C, 0xE0,
-    0x54, 0xF9, 0xB4, 0xD3, 0x3C, 0x4E, 0x1D, 0x3C, 0x86, 0x11, 0x88, 0x69, 0x9B, 0x49, 0xAB, 0xD8,
-    0x01, 0x2A, 0xF4, 0x83, 0x5A, 0xBB, 0xA1, 0xF0, 0x95, 0x13, 0xE3, 0x94, 0xB0, 0x0A, 0x9C, 0x8A,
-    0x2A, 0x1D, 0x28, 0x35, 0x6C, 0x28, 0x0F, 0xA1, 0x1C, 0xE0, 0x54, 0x52, 0xF0, 0xD4, 0x25, 0x9E,
-    0xF2, 0x95, 0xBB, 0xC9, 0xE4, 0xC3, 0xA9, 0xCB, 0x3A, 0x9E, 0x8D, 0xA2, 0x64, 0x68, 0xF1, 0xEC,
-    0x7E, 0x02, 0x0E, 0xD1, 0x5B, 0x35, 0x5F, 0x56, 0xCE, 0x9E, 0xB2, 0xFF, 0xC5, 0xA2, 0x2B, 0xED,
-    0x2F, 0x2D, 0xC9, 0xEA, 0x5F, 0xEC, 0x3A, 0xEA, 0x81, 0xA5, 0x25, 0x8B, 0x1C, 0x14, 0x96, 0xDA,
-    0xDA, 0x47, 0xE3, 0x7D, 0x19, 0xC4, 0x19, 0xE8, 0x19, 0x16, 0x4F, 0x2C, 0xEF, 0x01, 0x0C, 0xD6,
-    0x7B, 0x47, 0x76, 0xF0, 0x2F, 0x16, 0xA5, 0x35, 0x91, 0x0E, 0x9C, 0xFD, 0xAD, 0x30, 0x90, 0xDF,
-    0xC8, 0x81, 0x44, 0xA4, 0xC3, 0x69, 0x79, 0xAE, 0xDF, 0x58, 0x13, 0xBE, 0x02, 0x9D, 0x45, 0x26,
-    0x4A, 0x17, 0xE3, 0x40, 0x9A, 0x45, 0x4F, 0xE2, 0x80, 0xDF, 0xCE, 0x1A, 0x1E, 0x88, 0x85, 0xDF,
-    0xF5, 0xE8, 0x90, 0x3E, 0x58, 0xC8, 0xCF, 0x82, 0x3A, 0xAA, 0x2F, 0xEA, 0x81, 0x3C, 0x2A, 0x84,
-    0xF6, 0xC3, 0x85, 0xFF, 0xF6, 0x12, 0x6A, 0xCE, 0x25, 0x93, 0xEC, 0x61, 0x32, 0x44, 0x0B, 0xA0,
-    0x0D, 0x94, 0xBD, 0x11, 0x4D, 0x76, 0xE9, 0xA3, 0xB2, 0x82, 0x16, 0x40, 0xC3, 0x5E, 0x0F, 0x88,
-    0x92, 0x94, 0x9B, 0xCD, 0x61, 0xCB, 0x7B, 0x4E, 0xCC, 0xF6, 0x07, 0x39, 0x69, 0x12, 0x3B, 0x94,
-    0x50, 0xA3, 0x30, 0xE5, 0xD6, 0x39, 0x46, 0x79, 0x98, 0x63, 0x6C, 0x3A, 0x15, 0x32, 0x76, 0x53,
-    0x65, 0x78, 0xBF, 0xBB, 0x3A, 0xEA, 0x91, 0x1B, 0xF6, 0x71, 0xF7, 0xF7, 0xBA, 0xD5, 0xA1, 0x5D,
-    0xC7, 0x31, 0x1E, 0xC0, 0xED, 0xF2, 0x75, 0x8E, 0x71, 0xC2, 0x5E, 0x35, 0x44, 0xF8, 0x06, 0x67,
-    0x1A, 0xCB, 0xF0, 0x0C, 0x19, 0x46, 0x49, 0xCE, 0x0A, 0xA5, 0x86, 0x30, 0xE1, 0x2D, 0x6D, 0x94,
-    0xB0, 0x27, 0x52, 0x19, 0x75, 0xA4, 0xFA, 0xA4, 0x29, 0x41, 0xB2, 0xE9, 0x6B, 0xD4, 0x77, 0xEC,
-    0x0F, 0xC1, 0x84, 0xFD, 0x81, 0x4C, 0x3A, 0x6C, 0x29, 0x42, 0x92, 0xDF, 0x52, 0xF2, 0x94, 0x3C,
-    0x35, 0x1B, 0xD2, 0x05, 0x59, 0x11, 0x59, 0x50, 0xFA, 0x53, 0x6A, 0x26, 0x36, 0xE8, 0x78, 0x39,
-    0x64, 0x89, 0x10, 0x58, 0xB2, 0x24, 0x18, 0x0A, 0xF0, 0x4F, 0x26, 0x8C, 0xB0, 0x75, 0xD8, 0x1C,
-    0xE5, 0xB0, 0x5D, 0xC2, 0xC8, 0x26, 0xF2, 0x07, 0xE8, 0x8F, 0x58, 0xFE, 0x7C, 0xD7, 0xE1, 0x05,
-    0xDB, 0xDB, 0x0A, 0x2A, 0x63, 0xDA, 0xE3, 0x6F, 0x11, 0x0C, 0xF3, 0x87, 0x2E, 0xB8, 0x61, 0x00,
-    0x1A, 0x51, 0x4D, 0xDD, 0xE0, 0xA0, 0x9C, 0xB1, 0x73, 0x6E, 0xF3, 0x49, 0x8C, 0x80, 0x67, 0xDF,
-    0x84, 0x28, 0x0C, 0x94, 0x49, 0x89, 0x0C, 0x6A, 0xA8, 0xBE, 0x8E, 0x80, 0x08, 0x4E, 0x89, 0x74,
-    0x87, 0x72, 0xE2, 0x13, 0x73, 0xA1, 0x6A, 0x1C, 0x2E, 0x81, 0xD4, 0x51, 0x29, 0x26, 0xC6, 0x42,
-    0x10, 0x06, 0x32, 0x05, 0x37, 0xA7, 0x9E, 0x9B, 0x56, 0xA7, 0x38, 0x9C, 0x44, 0x97, 0xA4, 0x2B,
-    0xED, 0x3C, 0x73, 0xE2, 0x92, 0x23, 0xE5, 0x77, 0x93, 0xBA, 0x72, 0xE4, 0xE0, 0xA6, 0x7D, 0xD1,
-    0xB1, 0xB4, 0x40, 0xE1, 0x36, 0xB3, 0x79, 0xF9, 0x19, 0x0A, 0xD7, 0x25, 0x21, 0xF5, 0x62, 0x66,
-    0x9F, 0xDD, 0x69, 0x31, 0x41, 0xD2, 0x42, 0x5E, 0x68, 0x46, 0xD4, 0x27, 0x2E, 0x00, 0xB0, 0x2C,
-    0x71, 0x97, 0x4F, 0x2B, 0xCE, 0x44, 0xE0, 0x45, 0x9F, 0xE2, 0x34, 0xB5, 0x63, 0x37, 0x55, 0x06,
-    0xD5, 0xB4, 0x25, 0x69, 0xD7, 0x28, 0x10, 0xB5, 0x20, 0xFD, 0x15, 0x1C, 0xDC, 0x5D, 0xF3, 0xEF,
-    0x49, 0x84, 0x0B, 0xD5, 0x5B, 0x66, 0x0A, 0xD0, 0x7D, 0xE7, 0x19, 0x87, 0x0D, 0x51, 0x8F, 0xEA,
-    0xDD, 0x72, 0xBE, 0x77, 0x30, 0xEF, 0xCF, 0x81, 0xDD, 0xF6, 0x97, 0xB0, 0xEC, 0x1E, 0xC7, 0xF2,
-    0x22, 0x97, 0x2F, 0xDD, 0x8D, 0xE5, 0x5D, 0x0E, 0x4E, 0xFE, 0x50, 0x96, 0xF9, 0xC1, 0x2E, 0xC1,
-    0xBA, 0x86, 0x44, 0xD9, 0x7C, 0x22, 0xEC, 0x73, 0xD5, 0x86, 0x78, 0xD2, 0x29, 0x0C, 0xED, 0xFA,
-    0x3D, 0x4B, 0x05, 0xA2, 0xED, 0x16, 0x49, 0x87, 0xCA, 0x17, 0x4D, 0x1B, 0x79, 0xF6, 0x6E, 0xB9,
-    0x69, 0x17, 0xC2, 0x2B, 0x4A, 0x99, 0xBD, 0x31, 0xAC, 0xAA, 0xA8, 0x93, 0xB7, 0x2C, 0x55, 0x77,
-    0x97, 0x55, 0x2F, 0xD3, 0xA2, 0x14, 0x26, 0x70, 0x68, 0xD5, 0xE7, 0x7A, 0x8E, 0x57, 0x06, 0x5D,
-    0xC2, 0xDF, 0x2D, 0x23, 0xBD, 0x8B, 0x2F, 0xF7, 0x84, 0x54, 0x2C, 0x69, 0x6F, 0x92, 0x1C, 0x41,
-    0x29, 0x27, 0xED, 0x99, 0xB5, 0xB6, 0xB8, 0x55, 0xA8, 0xED, 0xCC, 0xB5, 0xD5, 0x5F, 0x99, 0xBF,
-    0x40, 0x28, 0x59, 0xFE, 0x6D, 0xC9, 0xD0, 0x14, 0xA9, 0x5D, 0x02, 0x35, 0x4F, 0x6C, 0xED, 0x95,
-    0x35, 0x91, 0xBB, 0x94, 0x50, 0x2D, 0x54, 0x58, 0xCE, 0xD1, 0x9E, 0x48, 0x8C, 0x10, 0x25, 0x7D,
-    0x17, 0xB6, 0x50, 0x3B, 0xFB, 0x35, 0x55, 0x8D, 0xDF, 0x61, 0x5F, 0x47, 0xDA, 0x69, 0xBE, 0x76,
-    0xB2, 0xEB, 0xEB, 0x40, 0x0F, 0x46, 0x3A, 0x75, 0x12, 0xF2, 0x39, 0x93, 0x93, 0xA7, 0x99, 0x9E,
-    0x34, 0x2E, 0xC3, 0x0C, 0xCA, 0x16, 0xB1, 0x22, 0x4A, 0x32, 0xC6, 0x17, 0x8A, 0x40, 0x5A, 0x50,
-    0xAD, 0xB3, 0x7C, 0x72, 0x28, 0xBD, 0x19, 0xD8, 0xF3, 0x10, 0x22, 0xA5, 0xED, 0x4B, 0x7A, 0x32,
-    0x3A, 0x87, 0x93, 0x00, 0x0A, 0x96, 0xD9, 0xF9, 0xB4, 0xBC, 0x83, 0x0F, 0xDE, 0xD0, 0xAB, 0x86,
-    0xEB, 0xA0, 0x0A, 0x4C, 0xAA, 0x54, 0xBD, 0x29, 0x6A, 0x90, 0xF2, 0xDF, 0x47, 0x70, 0x52, 0xD1,
-    0x92, 0x37, 0xA3, 0x43, 0x7C, 0xB8, 0x59, 0x77, 0x90, 0x8D, 0x04, 0xE4, 0x70, 0x40, 0xA5, 0x43,
-    0xA3, 0x46, 0x8B, 0x31, 0xF7, 0xE9, 0x2A, 0x72, 0x1A, 0x68, 0x21, 0xB3, 0x48, 0xC4, 0xEB, 0x03,
-    0x70, 0xE8, 0xD8, 0x5E, 0x48, 0x10, 0xEF, 0x2E, 0xC2, 0x95, 0x18, 0x51, 0x46, 0xAD, 0x72, 0xA9,
-    0xDA, 0xD4, 0xF5, 0x3B, 0xA1, 0xEE, 0x94, 0xBA, 0xD3, 0x6A, 0x9B, 0x55, 0x3F, 0xB7, 0xBB, 0x9E,
-    0x9D, 0x40, 0x11, 0x27, 0x4D, 0x76, 0x86, 0x1F, 0x35, 0x6B, 0xED, 0x8B, 0x6E, 0x6E, 0x07, 0xEA,
-    0x26, 0x64, 0x73, 0x4F, 0xBC, 0x8E, 0xFA, 0x80, 0xB4, 0xD7, 0x6C, 0x6F, 0x3F, 0x2C, 0x9C, 0x54,
-    0x58, 0x67, 0x02, 0x5F, 0xCE, 0x52, 0xEC, 0x3A, 0x61, 0x5F, 0x0B, 0x4C, 0xF2, 0xDE, 0x78, 0x65,
-    0xA1, 0x28, 0x82, 0x09, 0x96, 0x46, 0x91, 0x04, 0x10, 0xDB, 0x9D, 0x73, 0x68, 0xD3, 0x39, 0x07,
-    0x86, 0x07, 0xEC, 0xF8, 0x97, 0x8F, 0x1B, 0xF5, 0xD4, 0x01, 0xFF, 0x52, 0x3A, 0x57, 0xC6, 0x4C,
-    0x95, 0xF0, 0x4C, 0xCE, 0x24, 0xD2, 0x49, 0x32, 0xC9, 0x65, 0xF4, 0x36, 0x55, 0x3C, 0xEA, 0x6D,
-    0x41, 0x16, 0xE5, 0xA8, 0xC9, 0xBB, 0x67, 0x0A, 0x59, 0x85, 0xCD, 0xA8, 0xD5, 0x7F, 0x5C, 0x2F,
-    0x9B, 0xBA, 0x61, 0x77, 0xEA, 0x86, 0x37, 0xA6, 0xAD, 0x11, 0xEE, 0x77, 0xEE, 0x60, 0xC3, 0x79,
-    0x6F, 0x0E, 0x51, 0x3E, 0xF1, 0xBB, 0xF1, 0xAF, 0x1D, 0x37, 0xFC, 0x7A, 0xDC, 0x8A, 0x26, 0x97,
-    0xC1, 0xE7, 0x28, 0xF2, 0x32, 0xF5, 0x86, 0x64, 0x0E, 0xE1, 0x32, 0xF1, 0xB5, 0x0B, 0x2B, 0x03,
-    0xC0, 0x69, 0xF9, 0x81, 0x6A, 0xF9, 0xB1, 0x4E, 0xB6, 0xBB, 0x47, 0x5A, 0x55, 0xFF, 0xAA, 0x23,
-    0x59, 0x5F, 0x5D, 0x5E, 0x91, 0x1A, 0x31, 0xA9, 0xD2, 0xAE, 0xDD, 0xD8, 0xE9, 0x39, 0x45, 0x43,
-    0x75, 0xD0, 0x45, 0xEA, 0x98, 0x8B, 0xEB, 0x71, 0xAA, 0xBB, 0x89, 0x8F, 0xD9, 0xD3, 0xF2, 0x80,
-    0xFA, 0xCC, 0x3D, 0xF5, 0xE9, 0x25, 0x2D, 0xA6, 0xC2, 0x1E, 0x7C, 0xC1, 0x0A, 0x31, 0x96, 0xEA,
-    0x8B, 0x5F, 0xC9, 0x11, 0x55, 0x92, 0x71, 0x3B, 0xD5, 0x92, 0x89, 0x03, 0x30, 0xE8, 0x62, 0xD4,
-    0x93, 0x47, 0x35, 0x69, 0xD2, 0x9E, 0x6E, 0xF2, 0xC0, 0xC1, 0xF3, 0x93, 0xBE, 0x5C, 0xF0, 0x00,
-    0x36, 0x78, 0xE0, 0xFE, 0x9D, 0xC1, 0xFD, 0x24, 0x5E, 0xBA, 0x9F, 0x94, 0x85, 0x1E, 0x10, 0x2B,
-    0x7C, 0x70, 0xAF, 0x76, 0x83, 0x03, 0x41, 0xEB, 0x0E, 0x88, 0x36, 0xCF, 0x03, 0x79, 0x4D, 0xCD,
-    0x6D, 0x2E, 0xD2, 0x9C, 0xCA, 0xB3, 0x88, 0x91, 0x92, 0x0A, 0xC8, 0xFE, 0x68, 0x09, 0xAE, 0xDE,
-    0x36, 0x70, 0x02, 0xB1, 0x9D, 0x22, 0x4B, 0x6E, 0x00, 0x2C, 0x1D, 0xDD, 0x3C, 0xC0, 0xD8, 0x4C,
-    0x7A, 0xBF, 0xD8, 0xAE, 0xF7, 0x9F, 0xB5, 0x80, 0xA6, 0xA2, 0x15, 0x3C, 0xEA, 0xFD, 0xBE, 0xF0,
-    0xA8, 0xD9, 0xFC, 0xB3, 0x75, 0x07, 0x3E, 0x14, 0xCB, 0x67, 0x77, 0xE4, 0xEE, 0x0B, 0x28, 0xF5,
-    0x29, 0x55, 0x7B, 0x28, 0xF8, 0x3D, 0x4D, 0xE0, 0x16, 0xE0, 0x41, 0xBC, 0xEE, 0x9D, 0xCF, 0x48,
-    0x3B, 0x8E, 0xFA, 0x22, 0xB6, 0x31, 0x55, 0xF7, 0x99, 0x73, 0xAF, 0x45, 0xCB, 0x23, 0xBE, 0xFC,
-    0xB0, 0x0D, 0x79, 0xA0, 0x87, 0xCA, 0x4F, 0x0B, 0xB2, 0x89, 0xA0, 0xC8, 0x65, 0xE9, 0xF0, 0x90,
-    0x10, 0x49, 0x4A, 0xC6, 0x1B, 0x3B, 0x07, 0xFE, 0x96, 0xEB, 0xBA, 0xCD, 0xBF, 0x28, 0xF0, 0x8C,
-    0x05, 0xA4, 0xFC, 0x82, 0x5D, 0x18, 0xA8, 0xEB, 0x0F, 0x26, 0xC0, 0x5F, 0xEE, 0x28, 0xB1, 0x88,
-    0x04, 0x4D, 0x68, 0xC3, 0x32, 0x4E, 0x63, 0xE1, 0x8C, 0x6B, 0x9F, 0x48, 0x32, 0xCC, 0x93, 0x18,
-    0x98, 0x2D, 0x21, 0x2B, 0xC2, 0xB2, 0x96, 0x70, 0x96, 0xB3, 0xC7, 0xD9, 0x49, 0x54, 0x56, 0x01,
-    0xDC, 0x2A, 0x6C, 0x24, 0x1D, 0xAB, 0xF3, 0x00, 0xDD, 0xE8, 0x0E, 0xC9, 0x55, 0xB3, 0xF1, 0x2A,
-    0xE0, 0x1D, 0xEE, 0xD0, 0xE1, 0x7B, 0x95, 0xBC, 0x7D, 0xC6, 0x41, 0xB4, 0x8A, 0xD0, 0x0C, 0x4A,
-    0x2C, 0x14, 0x36, 0x96, 0x5A, 0x82, 0xEA, 0x16, 0xD1, 0x80, 0x06, 0x42, 0xF5, 0xCF, 0x87, 0xB3,
-    0xB6, 0xF2, 0x15, 0x9A, 0x50, 0x1B, 0x0C, 0x53, 0x7B, 0x9C, 0xF8, 0xDF, 0xD9, 0x1A, 0x21, 0x63,
-    0x9D, 0xEA, 0x0D, 0x3B, 0xFB, 0xAA, 0xFC, 0x7E, 0x5B, 0x24, 0x87, 0xDC, 0x2B, 0xA1, 0x4F, 0x39,
-    0x24, 0x7B, 0x9A, 0xF5, 0xA3, 0x90, 0xD3, 0x29, 0xA9, 0x72, 0xCF, 0x9D, 0x90, 0xCB, 0xCB, 0xCC,
-    0xFD, 0x42, 0xCC, 0x8D, 0xB3, 0x4B, 0x63, 0xDC, 0x6B, 0x96, 0xE4, 0x50, 0xE9, 0xEB, 0x3B, 0xD0,
-    0x44, 0x1A, 0x74, 0x94, 0xE2, 0x42, 0x22, 0x26, 0x35, 0xEA, 0x05, 0x1E, 0xD0, 0x01, 0xB7, 0x92,
-    0xF7, 0x9D, 0xF5, 0x6A, 0x7C, 0x11, 0xD0, 0xCB, 0xF7, 0x67, 0xD4, 0x40, 0x7E, 0x6B, 0x33, 0x69,
-    0x73, 0xFB, 0xBD, 0x35, 0xBC, 0x28, 0x04, 0x2D, 0x60, 0xF6, 0x07, 0xC3, 0x1E, 0x06, 0x47, 0x7E,
-    0x27, 0x9C, 0x73, 0x80, 0x15, 0x2D, 0x13, 0xA7, 0x38, 0x0C, 0x4D, 0x6F, 0x96, 0xC2, 0x3C, 0xE0,
-    0xE8, 0x0A, 0xED, 0x81, 0xD5, 0xF1, 0x4A, 0xC1, 0xBC, 0xD2, 0x62, 0xDA, 0x5A, 0x48, 0x77, 0x25,
-    0xFB, 0x3B, 0xF6, 0x9A, 0x34, 0x3A, 0x1D, 0x7C, 0xD1, 0xDC, 0x96, 0xE6, 0xDF, 0x64, 0x1E, 0x9F,
-    0xF5, 0x29, 0x2C, 0x1E, 0x37, 0xE6, 0xFB, 0xD2, 0x77, 0xA1, 0xA5, 0xF3, 0x08, 0x21, 0x21, 0xD9,
-    0x4E, 0x41, 0x0F, 0x86, 0xBF, 0x1C, 0x39, 0x6E, 0xB4, 0x60, 0x98, 0x00, 0xD9, 0xEE, 0x3D, 0x5B,
-    0x26, 0x7D, 0x1A, 0xFE, 0x26, 0x79, 0x6E, 0x95, 0xDA, 0x6D, 0x5B, 0xE7, 0x60, 0x0D, 0xA2, 0x80,
-    0x86, 0x1D, 0x81, 0x67, 0x59, 0x88, 0x22, 0x2A, 0x8C, 0x16, 0x4A, 0x29, 0xC3, 0x3D, 0x3C, 0x58,
-    0xB1, 0x5E, 0x8F, 0xA8, 0xA0, 0x4E, 0x68, 0xC0, 0xEF, 0xC8, 0x19, 0x42, 0xBC, 0x9E, 0x6F, 0xFF,
-    0x73, 0xC9, 0x11, 0xCC, 0xA0, 0xDD, 0xC3, 0x0E, 0xCD, 0xCC, 0xC9, 0xF9, 0x1C, 0x70, 0xA2, 0x5A,
-    0x70, 0x4B, 0xE1, 0xEF, 0x71, 0xE3, 0x01, 0x2A, 0x05, 0xD2, 0x92, 0x49, 0x2B, 0x80, 0xD7, 0x06,
-    0x8D, 0xD7, 0x9F, 0x61, 0x9C, 0x41, 0x0B, 0xE2, 0x6F, 0x71, 0x55, 0xEB, 0xE1, 0x8E, 0x70, 0xD6,
-    0x54, 0x72, 0x55, 0x2E, 0xFF, 0xCD, 0x3A, 0x39, 0x14, 0xD7, 0xA1, 0xCC, 0x65, 0x4C, 0xE4, 0x26,
-    0xB1, 0x2E, 0x88, 0x88, 0xB2, 0x20, 0x71, 0xC2, 0x66, 0x19, 0xEC, 0x6F, 0xF7, 0x22, 0x8B, 0x12,
-    0x91, 0x4C, 0x61, 0x15, 0x2F, 0xBC, 0x46, 0xA4, 0xD6, 0x37, 0xE8, 0x1C, 0x82, 0xFE, 0x8A, 0x40,
-    0x25, 0x39, 0x60, 0x8E, 0x3D, 0xE0, 0x95, 0x6F, 0xC2, 0x46, 0x14, 0x8A, 0x06, 0xB0, 0x76, 0x92,
-    0x48, 0x53, 0xA9, 0xCD, 0x26, 0xEB, 0xF1, 0x5A, 0xFE, 0x6C, 0xB9, 0x5A, 0x7A, 0xBA, 0x24, 0x54,
-    0x37, 0xE3, 0xD2, 0xD7, 0x65, 0xBD, 0x5A, 0x06, 0x0B, 0x2C, 0x23, 0xA2, 0x9A, 0x71, 0x81, 0x65,
-    0xCA, 0xA7, 0x9D, 0x53, 0x91, 0x39, 0xBF, 0x60, 0x9F, 0x49, 0x57, 0xA8, 0x3E, 0xD1, 0xFC, 0x59,
-    0x97, 0xC2, 0xCA, 0xE9, 0x12, 0xC4, 0xF0, 0x74, 0xC4, 0xF0, 0xDB, 0x98, 0x42, 0x91, 0x6A, 0xE0,
-    0x9F, 0x7F, 0x06, 0xCB, 0x3F, 0x76, 0x3A, 0xFE, 0xBE, 0xB2, 0xD5, 0xE4, 0xA0, 0xAC, 0xE5, 0x45,
-    0x6C, 0x26, 0x93, 0xAA, 0x05, 0x58, 0xF5, 0x6A, 0xAB, 0xF7, 0x89, 0xAF, 0x8C, 0x20, 0xFB, 0x95,
-    0x83, 0xF9, 0xFC, 0x05, 0xBC, 0x34, 0x5E, 0x18, 0x74, 0xA5, 0x42, 0x11, 0x5A, 0x37, 0x1C, 0x6D,
-    0x77, 0x0B, 0xE1, 0x95, 0x45, 0xA2, 0xEF, 0x2B, 0x0D, 0xFC, 0xEC, 0x33, 0x13, 0x21, 0xA7, 0x50,
-    0x3B, 0xE1, 0x55, 0x13, 0x73, 0xA1, 0x8E, 0x3A, 0xDF, 0x16, 0x39, 0x30, 0xEC, 0x4F, 0xE5, 0x32,
-    0x84, 0x61, 0x23, 0x53, 0x4D, 0xC6, 0x07, 0x16, 0xD9, 0x13, 0x5E, 0x37, 0x03, 0x8D, 0x75, 0x01,
-    0x20, 0x6A, 0xF8, 0x1F, 0xAA, 0x8B, 0x20, 0xBE, 0x26, 0x27, 0xE0, 0x1E, 0xAA, 0x62, 0x09, 0xD2,
-    0x64, 0x54, 0x57, 0x17, 0xBF, 0x4C, 0x35, 0x71, 0x91, 0xB3, 0x21, 0xD6, 0xEB, 0xD0, 0xB2, 0x70,
-    0x19, 0x34, 0x21, 0x2D, 0x81, 0xD8, 0x39, 0x93, 0x72, 0x70, 0x9B, 0xB4, 0x96, 0xE9, 0xC3, 0x29,
-    0x50, 0x0A, 0xBF, 0x5C, 0xA4, 0xB5, 0x0F, 0xC2, 0xAD, 0x1F, 0x65, 0x03, 0x3F, 0xAF, 0xED, 0xDC,
-    0x19, 0x32, 0x08, 0x9A, 0x78, 0xB0, 0xCB, 0x34, 0x0B, 0xDB, 0x6F, 0x50, 0x34, 0xF3, 0xDF, 0x92,
-    0xE0, 0xDE, 0xC9, 0x1D, 0xE9, 0x18, 0x99, 0x94, 0x09, 0xD4, 0x5C, 0x08, 0x76, 0xF2, 0xE9, 0x41,
-    0xE6, 0xCE, 0x70, 0xAF, 0x0C, 0xC7, 0x65, 0x79, 0x58, 0xF9, 0x8B, 0x9D, 0x65, 0xCA, 0xF0, 0x8B,
-    0x81, 0x9C, 0xE7, 0xE4, 0xF6, 0x96, 0x48, 0xEA, 0xD2, 0xD6, 0x21, 0x94, 0xBA, 0x22, 0xB0, 0x24,
-    0x82, 0x94, 0x03, 0x99, 0x63, 0xE9, 0x59, 0x2C, 0x03, 0x2E, 0xE3, 0x12, 0xCB, 0xCB, 0x38, 0x3B,
-    0x6B, 0xB1, 0x0C, 0x6B, 0x2C, 0x93, 0x0C, 0xCB, 0x1E, 0xBF, 0x02, 0x97, 0x2F, 0xD0, 0xDB, 0x58,
-    0x66, 0xEE, 0x3E, 0x69, 0x01, 0x05, 0x30, 0xBF, 0x9A, 0x5A, 0x99, 0x43, 0xB6, 0xB4, 0x4D, 0x20,
-    0x0F, 0x17, 0x71, 0x03, 0x1B, 0xBA, 0x9A, 0xB5, 0x23, 0xB4, 0x19, 0xD7, 0xB0, 0xCB, 0xC2, 0x61,
-    0x87, 0x03, 0x46, 0x39, 0xB3, 0x36, 0x46, 0x6E, 0x2A, 0x7C, 0x44, 0xAD, 0xD5, 0x00, 0xA5, 0x33,
-    0x26, 0x47, 0xBF, 0xE5, 0x3F, 0x87, 0x9D, 0x8F, 0xB9, 0x91, 0xFE, 0x47, 0x99, 0x65, 0x42, 0xC0,
-    0xF1, 0x22, 0x12, 0x21, 0xB6, 0x0C, 0xC1, 0x3A, 0x40, 0x0A, 0xF9, 0x03, 0x8D, 0x73, 0xE7, 0x07,
-    0x96, 0xE8, 0x35, 0xC4, 0x56, 0x0E, 0x24, 0x35, 0x5E, 0x50, 0xD3, 0xF4, 0x89, 0xFB, 0x0B, 0xBF,
-    0xCE, 0x33, 0x91, 0xA2, 0x49, 0x2D, 0x6A, 0x95, 0xB0, 0xA8, 0x78, 0x29, 0x8F, 0x23, 0xDC, 0x8E,
-    0xEE, 0x21, 0x16, 0x4C, 0xA1, 0x5E, 0x85, 0xAA, 0x01, 0x9E, 0x63, 0xBC, 0xCD, 0x92, 0x91, 0x35,
-    0x15, 0x51, 0x5B, 0x4A, 0x5F, 0x7A, 0x11, 0x67, 0x0C, 0xB8, 0x89, 0x78, 0xF8, 0x34, 0xC3, 0xAD,
-    0xE8, 0xC6, 0x0C, 0xD9, 0xB5, 0xA9, 0x51, 0xC7, 0x17, 0x74, 0x59, 0x08, 0xA9, 0xFB, 0x60, 0x9C,
-    0xE3, 0xF5, 0xE3, 0xFD, 0x80, 0x81, 0x46, 0x11, 0x18, 0x6A, 0xF7, 0x79, 0xD7, 0xC9, 0xC0, 0x71,
-    0xB7, 0xF0, 0xD6, 0x91, 0x7D, 0x19, 0xBC, 0x42, 0x66, 0x43, 0x8E, 0x48, 0x99, 0xC2, 0x13, 0x83,
-    0x38, 0xBE, 0x6C, 0x82, 0x9F, 0x2D, 0xCC, 0xBE, 0x30, 0xB3, 0x47, 0xAA, 0xE0, 0x4A, 0x6D, 0x9E,
-    0x48, 0xB3, 0xD3, 0x32, 0xF3, 0x97, 0xE7, 0xBC, 0xE6, 0x9C, 0xB0, 0x83, 0x2E, 0x7A, 0x52, 0x4E,
-    0x7D, 0xB3, 0x7D, 0x3C, 0x90, 0x53, 0xFE, 0x6F, 0x1B, 0x9C, 0x0A, 0xDF, 0xCA, 0x70, 0x2A, 0x86,
-    0xAF, 0x2A, 0x16, 0xEA, 0xC6, 0x29, 0xB0, 0x41, 0x39, 0x65, 0x96, 0xF2, 0x5A, 0xE1, 0x55, 0x79,
-    0x63, 0x31, 0x2F, 0x30, 0x80, 0xF6, 0x47, 0x04, 0xA0, 0x06, 0x19, 0xEB, 0x0D, 0x8C, 0x75, 0x13,
-    0x61, 0xAC, 0x85, 0x60, 0xA9, 0x9F, 0xE5, 0xC5, 0x6A, 0xC4, 0x8F, 0x2C, 0x07, 0x2E, 0x89, 0xA4,
-    0xB9, 0xE5, 0xB0, 0xBD, 0xFD, 0x2E, 0xD7, 0x73, 0x39, 0x13, 0x65, 0xA4, 0xC4, 0x58, 0x07, 0x1C,
-    0xEB, 0xD0, 0x3A, 0x6B, 0xD5, 0x2B, 0x09, 0x5E, 0x2B, 0xD0, 0x2D, 0x02, 0x50, 0x7A, 0x00, 0xFD,
-    0xEE, 0xD3, 0x8B, 0x91, 0x2E, 0x4A, 0x88, 0x4E, 0x88, 0x0B, 0x0B, 0xF8, 0x26, 0xBD, 0x02, 0xFD,
-    0xF6, 0xD7, 0x03, 0x1D, 0x4E, 0x90, 0x89, 0x50, 0x15, 0x52, 0x38, 0xF0, 0xA3, 0x5A, 0x46, 0x33,
-    0x6C, 0x12, 0x68, 0xD1, 0xBE, 0xE5, 0x64, 0xDF, 0x3F, 0x45, 0x4F, 0x45, 0x3F, 0xAA, 0x8B, 0x8F,
-    0x4D, 0x68, 0x66, 0xB9, 0x8A, 0x38, 0xA0, 0xFA, 0x5A, 0x66, 0xA4, 0xEB, 0x0F, 0x6C, 0x39, 0xBD,
-    0x6B, 0x08, 0x40, 0x5B, 0xFA, 0xD5, 0x09, 0x98, 0x7B, 0xAA, 0x9D, 0x7D, 0x51, 0xAF, 0x44, 0xA8,
-    0x85, 0xF6, 0x67, 0x22, 0x20, 0x4E, 0xD9, 0xFD, 0x53, 0xA2, 0x26, 0x76, 0xEB, 0x4A, 0xA8, 0xAA,
-    0x9B, 0x47, 0x95, 0x50, 0xB3, 0xA6, 0x9A, 0xF6, 0x93, 0xAB, 0xDC, 0x6F, 0x55, 0x45, 0x81, 0x6A,
-    0x5A, 0x1B, 0x7B, 0x0D, 0xCA, 0x81, 0x83, 0xB4, 0x41, 0x53, 0xF5, 0x5D, 0x2E, 0x12, 0x56, 0x1D,
-    0x54, 0xD7, 0xE9, 0xC4, 0xF4, 0x50, 0xE5, 0xB8, 0x74, 0x73, 0x3E, 0x9F, 0x82, 0x20, 0xCB, 0x16,
-    0x88, 0xA0, 0xF0, 0x47, 0xDB, 0x41, 0x41, 0x7B, 0x4A, 0xEE, 0xF9, 0xF3, 0x5E, 0x18, 0x9F, 0x8C,
-    0xC4, 0x79, 0xF0, 0xFA, 0xE8, 0x90, 0xE8, 0x2B, 0xD4, 0x6F, 0xA8, 0x7C, 0x17, 0xEE, 0x2B, 0xC2,
-    0xF7, 0x85, 0xD9, 0x2A, 0xED, 0x5E, 0x17, 0xA2, 0x1D, 0x3B, 0x78, 0x7B, 0x32, 0x40, 0xF9, 0x43,
-    0x97, 0xBF, 0x83, 0xC5, 0x5B, 0xCF, 0x96, 0xCF, 0xE6, 0x97, 0xE4, 0x1E, 0x07, 0x22, 0x58, 0xFD,
-    0x5F, 0x89, 0x84, 0x8D, 0x1E, 0x91, 0x9E, 0xBB, 0x57, 0x6F, 0x4B, 0xC1, 0xC2, 0x60, 0x60, 0x88,
-    0x99, 0x1B, 0x1D, 0x3A, 0x35, 0xC0, 0x4F, 0x29, 0x1A, 0x2C, 0x5C, 0xF0, 0x4A, 0xC5, 0x54, 0x3F,
-    0xFE, 0xAF, 0x3C, 0x71, 0x67, 0x20, 0x10, 0xB1, 0x00, 0x63, 0xCE, 0x09, 0x10, 0xB7, 0x2E, 0x26,
-    0x41, 0xEE, 0x71, 0x19, 0x1A, 0x27, 0x94, 0xF1, 0x92, 0x0A, 0xCC, 0x00, 0x67, 0xC6, 0xAC, 0x0B,
-    0xE8, 0xB8, 0x81, 0xAC, 0x8C, 0x6A, 0x7A, 0xE6, 0xAF, 0x50, 0x35, 0xCD, 0x57, 0x61, 0x64, 0xB4,
-    0x45, 0x08, 0xCF, 0x6B, 0x73, 0x54, 0xFD, 0x51, 0xF8, 0x4F, 0xE1, 0x16, 0x20, 0x65, 0xFF, 0x01,
-    0x42, 0xC7, 0x3F, 0xA0, 0xEE, 0x6A, 0x97, 0x13, 0x08, 0x98, 0x8C, 0x41, 0x78, 0x77, 0xD3, 0x62,
-    0xE0, 0xBD, 0x3C, 0x75, 0x1B, 0x9F, 0x28, 0xAB, 0x55, 0xE0, 0x9A, 0xB3, 0x62, 0x6F, 0xBC, 0xB3,
-    0x03, 0x2F, 0x83, 0xA7, 0x8C, 0x4A, 0xD5, 0x8A, 0x74, 0x99, 0xBC, 0x22, 0x13, 0xB7, 0x9D, 0x75,
-    0x33, 0x2B, 0x44, 0x93, 0x54, 0x61, 0x9B, 0x20, 0xD6, 0x00, 0xB2, 0x5B, 0x36, 0x44, 0xF1, 0x82,
-    0xFB, 0xEF, 0x0D, 0xE1, 0x7F, 0xA2, 0x3D, 0x1C, 0xDE, 0x81, 0x93, 0x39, 0x7E, 0x95, 0x4E, 0xE7,
-    0x2E, 0x5D, 0xE0, 0x37, 0x4F, 0xDA, 0x0C, 0xC4, 0x15, 0x0E, 0xD2, 0x23, 0xA2, 0xFF, 0xD8, 0xF2,
-    0x57, 0x1A, 0xE4, 0x80, 0x06, 0xEF, 0x68, 0x28, 0xE1, 0x4D, 0x36, 0x34, 0xA6, 0xE6, 0x1D, 0xA9,
-    0xCD, 0x3E, 0x9F, 0x3F, 0x67, 0x74, 0x90, 0xB6, 0x2C, 0x3C, 0x85, 0xAF, 0xC8, 0x20, 0x95, 0x1D,
-    0x50, 0xEF, 0x1C, 0x64, 0xC4, 0xD1, 0xC8, 0x52, 0x00, 0xB9, 0xC4, 0x51, 0x2D, 0xA3, 0x72, 0xED,
-    0xAA, 0xDB, 0x1D, 0x9A, 0xCD, 0xCE, 0x1F, 0xE8, 0x17, 0x7C, 0x05, 0x4B, 0x46, 0x45, 0x47, 0x75,
-    0x40, 0x3C, 0x21, 0xA4, 0xF2, 0x1E, 0xED, 0x8B, 0x44, 0x17, 0x12, 0x8E, 0x81, 0x48, 0x76, 0x7C,
-    0xE4, 0x99, 0xC4, 0x76, 0xC2, 0x5E, 0x1E, 0xB4, 0x08, 0x71, 0x46, 0x8C, 0xEA, 0x4C, 0xDD, 0xC1,
-    0x25, 0xA9, 0x49, 0x9D, 0xA1, 0x88, 0x2C, 0x5D, 0xDE, 0xD2, 0x89, 0xF2, 0xDA, 0xBC, 0xDC, 0xA7,
-    0x1C, 0xB1, 0xBF, 0xD1, 0xC8, 0x8A, 0x35, 0x70, 0x40, 0x93, 0x08, 0x02, 0x52, 0x89, 0xB7, 0x5C,
-    0x83, 0xE4, 0x14, 0x91, 0xF3, 0xAA, 0x93, 0xDB, 0xD9, 0xC9, 0xED, 0xB3, 0xC0, 0x75, 0x84, 0x33,
-    0x15, 0xB9, 0x85, 0x17, 0x22, 0x87, 0xBF, 0xD1, 0x27, 0x02, 0x91, 0x66, 0xBA, 0x99, 0x60, 0x73,
-    0x86, 0x09, 0x49, 0x0F, 0xB8, 0x58, 0x0F, 0x07, 0x25, 0x8C, 0x09, 0xF4, 0xF2, 0xCC, 0xFE, 0xA9,
-    0x5A, 0x8A, 0xD9, 0xA8, 0xA9, 0xAF, 0x6D, 0x7A, 0xE5, 0x55, 0xF4, 0x22, 0xC6, 0x24, 0x05, 0xD3,
-    0xCF, 0xB6, 0xB7, 0xA5, 0x63, 0x52, 0xBB, 0xB0, 0x43, 0x04, 0xA5, 0xB1, 0xB0, 0x32, 0x5F, 0x6B,
-    0xA8, 0xCB, 0xB5, 0xBC, 0xCC, 0xED, 0x5A, 0xCF, 0x86, 0xE7, 0x1F, 0xF9, 0xC5, 0x77, 0xEC, 0xAE,
-    0x0B, 0x90, 0xED, 0x4A, 0xB7, 0xFE, 0x98, 0xB5, 0xCF, 0x45, 0xCC, 0x80, 0x9D, 0x4F, 0x71, 0x6A,
-    0x63, 0x9E, 0x81, 0xC6, 0x00, 0x1C, 0x72, 0x08, 0x98, 0x8B, 0x6E, 0xFD, 0xB8, 0x39, 0x1C, 0xA2,
-    0xF6, 0xA5, 0x93, 0x63, 0xF0, 0x6D, 0x6D, 0xC8, 0x1D, 0x4D, 0xF2, 0x2C, 0x78, 0xE8, 0x25, 0xDC,
-    0x49, 0x34, 0x8B, 0x96, 0x0A, 0x87, 0x0C, 0xD1, 0x09, 0xEA, 0xD5, 0xCE, 0x21, 0xEE, 0x53, 0x8A,
-    0x45, 0xFB, 0xDF, 0x87, 0x86, 0xC1, 0xA0, 0xEB, 0x01, 0xC4, 0xE7, 0xD3, 0x99, 0x21, 0x57, 0xE7,
-    0x14, 0xB0, 0x1D, 0x0E, 0x83, 0x2C, 0xF7, 0x1F, 0xB6, 0x24, 0x88, 0x06, 0x56, 0xD0, 0xFE, 0x4A,
-    0xA3, 0x03, 0x5C, 0x9F, 0xA8, 0xFF, 0xEA, 0x0D, 0xDC, 0xB0, 0xB4, 0xBB, 0x64, 0x63, 0x1A, 0x13,
-    0xC0, 0x20, 0x93, 0x8C, 0xC6, 0x1D, 0xD8, 0xAC, 0xDC, 0x6E, 0x3C, 0x39, 0x08, 0xE5, 0x24, 0xE4,
-    0xB2, 0x15, 0x4E, 0x1E, 0xEC, 0x75, 0x7A, 0xB2, 0xCC, 0xF8, 0xCB, 0xA8, 0xE6, 0x2F, 0x67, 0x9D,
-    0xFE, 0xF2, 0xB2, 0x9E, 0x4C, 0x0B, 0x9E, 0x4C, 0x2A, 0x84, 0xD9, 0x3C, 0x5B, 0xD6, 0xF1, 0x3E,
-    0x90, 0x9D, 0x3A, 0xB5, 0x7F, 0x0B, 0x31, 0x3F, 0x89, 0x44, 0x6D, 0x18, 0x04, 0x8E, 0xA6, 0x09,
-    0xDC, 0x90, 0xE1, 0x5B, 0xC5, 0x2B, 0x44, 0xDB, 0x7C, 0xF3, 0xAC, 0x08, 0x77, 0x99, 0xC4, 0x8C,
-    0x06, 0x97, 0xAB, 0x62, 0x04, 0x3A, 0xE4, 0x6C, 0x01, 0x94, 0xD1, 0x45, 0xB8, 0xFF, 0xD0, 0x64,
-    0xD9, 0xED, 0xAF, 0xE9, 0xB4, 0xA7, 0x18, 0x3A, 0x6C, 0x4D, 0xFE, 0x8E, 0x6D, 0x44, 0xAB, 0x1F,
-    0xFE, 0x21, 0x5D, 0x45, 0x04, 0x57, 0x08, 0x5A, 0xA4, 0x95, 0xB7, 0xFD, 0x08, 0x54, 0xD1, 0x8E,
-    0x71, 0xA2, 0x1B, 0x5B, 0xF4, 0xEE, 0x43, 0xB8, 0x2D, 0xBF, 0x28, 0xF4, 0x70, 0xAF, 0x86, 0x4D,
-    0x94, 0xDF, 0x1A, 0x1E, 0x12, 0x5A, 0x64, 0xD8, 0xF8, 0x70, 0x48, 0x71, 0x06, 0x3A, 0x0B, 0x55,
-    0x8F, 0xAA, 0x25, 0x0C, 0xD5, 0x1E, 0x8F, 0x82, 0xD5, 0x86, 0x68, 0x39, 0x69, 0x98, 0x8F, 0x78,
-    0x1E, 0xD9, 0x25, 0xD6, 0x29, 0xED, 0x24, 0x36, 0xD6, 0x63, 0xE4, 0x93, 0x85, 0xC8, 0xBF, 0x5A,
-    0xDE, 0xDB, 0x23, 0x4D, 0xC4, 0x08, 0x9F, 0x91, 0x07, 0xF7, 0xDE, 0x30, 0xD7, 0x5D, 0x77, 0xD6,
-    0x89, 0xFE, 0x78, 0x11, 0xB9, 0xDF, 0xE6, 0x50, 0x6C, 0xE5, 0xCE, 0x08, 0xB8, 0x13, 0xAD, 0x23,
-    0x6E, 0x03, 0xA0, 0x53, 0x44, 0x21, 0xB4, 0x19, 0x1A, 0xFE, 0x08, 0x57, 0x25, 0x7D, 0x67, 0xA0,
-    0x3C, 0xB8, 0x44, 0x65, 0x31, 0x80, 0x37, 0x10, 0x43, 0xC8, 0x11, 0x87, 0x40, 0x1B, 0x1A, 0xAC,
-    0xC6, 0x85, 0x67, 0x88, 0xC2, 0xDA, 0x18, 0xB5, 0x60, 0x23, 0xE8, 0x6A, 0xBE, 0xD8, 0x60, 0x42,
-    0x14, 0xE0, 0xD3, 0xBD, 0x21, 0x64, 0x99, 0x52, 0xF5, 0x00, 0x93, 0x0A, 0x0F, 0xB2, 0x5C, 0xE4,
-    0xEE, 0xB2, 0xAC, 0x62, 0xDB, 0x9F, 0x58, 0x05, 0x64, 0xCF, 0x2A, 0x17, 0xB9, 0x49, 0x00, 0xAB,
-    0x5C, 0x38, 0x2E, 0x4E, 0xDF, 0x0D, 0x55, 0x92, 0xAF, 0x1D, 0x8D, 0x8C, 0x09, 0x65, 0x8C, 0x02,
-    0xBA, 0x44, 0x2F, 0x0C, 0x54, 0xD9, 0xE5, 0xB2, 0xF4, 0xC9, 0x0E, 0x1E, 0x2E, 0xB1, 0xB6, 0x44,
-    0x9C, 0x79, 0x6A, 0x81, 0xD2, 0x14, 0x9D, 0xCF, 0xE7, 0x4F, 0x2F, 0x1D, 0x7D, 0xF8, 0xAD, 0x43,
-    0xC8, 0xF8, 0x84, 0x58, 0xF4, 0x5B, 0xE9, 0x80, 0x0B, 0x2D, 0xF9, 0x22, 0x41, 0x2F, 0x26, 0xB2,
-    0x68, 0x9A, 0x9A, 0xF4, 0x97, 0x85, 0xEB, 0xB7, 0x4E, 0x9B, 0x59, 0xEF, 0xF5, 0xE6, 0x98, 0xBF,
-    0x0F, 0xD7, 0x1A, 0xDE, 0xE0, 0x23, 0x9A, 0x51, 0x35, 0x98, 0xED, 0x1D, 0x81, 0x2C, 0x69, 0xD7,
-    0xFA, 0x64, 0x12, 0x27, 0x2D, 0x82, 0xD9, 0xAE, 0xC7, 0x34, 0x03, 0x44, 0x02, 0xFD, 0x8E, 0x71,
-    0x9E, 0x1A, 0xE1, 0x55, 0x68, 0xC6, 0x10, 0x51, 0xB9, 0x60, 0x2D, 0x84, 0x52, 0x49, 0x86, 0xD1,
-    0x9F, 0xAA, 0x59, 0x2E, 0x26, 0x1D, 0x72, 0x6D, 0x53, 0x68, 0x6A, 0x1F, 0x40, 0x0C, 0xF0, 0x9E,
-    0x57, 0xA1, 0x86, 0xB7, 0x93, 0xF0, 0x08, 0x56, 0xCF, 0x8E, 0x27, 0x17, 0x34, 0x6D, 0xA7, 0x0D,
-    0xCA, 0x77, 0xAA, 0x38, 0xC1, 0x04, 0xB3, 0x7B, 0x95, 0x63, 0x87, 0x08, 0xCD, 0xC1, 0xFC, 0x42,
-    0x44, 0x02, 0x20, 0x6D, 0xC4, 0xF7, 0xF8, 0xD5, 0xF5, 0x69, 0x74, 0x1F, 0x3C, 0xE2, 0xA2, 0x26,
-    0x3C, 0xEC, 0x4C, 0x21, 0xDC, 0x78, 0x7F, 0xA7, 0xF3, 0x61, 0x90, 0xC9, 0x44, 0x42, 0x7C, 0x4B,
-    0xF8, 0x54, 0xEB, 0xDE, 0x8C, 0x52, 0x11, 0x4C, 0x2D, 0xC0, 0xAF, 0x84, 0x9A, 0xB2, 0xEB, 0x47,
-    0x10, 0x8E, 0xF3, 0x4F, 0x61, 0x04, 0xAB, 0x04, 0x0C, 0x68, 0x67, 0x6D, 0xCA, 0x7B, 0xC2, 0x5C,
-    0x44, 0x90, 0xFA, 0x72, 0xFF, 0x24, 0x0B, 0x45, 0x63, 0x8C, 0x9E, 0x6A, 0xCC, 0x57, 0x69, 0xA5,
-    0x20, 0x92, 0x02, 0x66, 0x05, 0x50, 0x3D, 0xB9, 0x41, 0x2C, 0xFF, 0x36, 0xED, 0x2B, 0x99, 0xB1,
-    0x5F, 0x97, 0xD6, 0x5E, 0x64, 0x00, 0x4E, 0xF2, 0xE3, 0x76, 0xD6, 0x27, 0xCE, 0x79, 0xB3, 0xF1,
-    0xE2, 0xE8, 0x67, 0x85, 0x59, 0x6D, 0x2B, 0x24, 0x51, 0x96, 0x87, 0x23, 0xC6, 0xBE, 0x9F, 0x25,
-    0xA2, 0x11, 0x58, 0x66, 0x0D, 0xE5, 0x37, 0xF5, 0xBF, 0x67, 0xAF, 0xCA, 0xFD, 0x53, 0x87, 0x90,
-    0x40, 0xBB, 0x4B, 0x7F, 0xD9, 0x23, 0x76, 0x24, 0x39, 0x32, 0x08, 0x1B, 0xFF, 0x43, 0xA6, 0xDD,
-    0x02, 0x31, 0x65, 0x5E, 0xBE, 0x60, 0x77, 0xC6, 0x37, 0xBD, 0xCA, 0xF7, 0x11, 0x9C, 0x13, 0xB9,
-    0x90, 0x37, 0xCD, 0xE7, 0xD1, 0xFF, 0x55, 0x41, 0x5E, 0x45, 0x65, 0xBF, 0x24, 0xBA, 0xEE, 0x4C,
-    0xFA, 0xF9, 0x14, 0x26, 0xF3, 0x4D, 0xFF, 0xDF, 0xAE, 0xFE, 0x57, 0x47, 0x19, 0xEC, 0x1C, 0xB1,
-    0xD2, 0x4D, 0x2A, 0x6A, 0xAB, 0xA8, 0xA2, 0x2E, 0x95, 0x89, 0x5E, 0xD1, 0x55, 0xD6, 0x89, 0xD8,
-    0xBB, 0x04, 0xCB, 0xC5, 0x82, 0x57, 0x57, 0xBE, 0x0A, 0x53, 0xAF, 0xD1, 0xDD, 0x44, 0x77, 0x67,
-    0x8D, 0x86, 0x36, 0xA6, 0xA0, 0x93, 0x85, 0xF1, 0x6B, 0x7F, 0x38, 0x6B, 0x11, 0x5D, 0x4A, 0x11,
-    0x2B, 0xF6, 0x3C, 0x94, 0x67, 0x61, 0x75, 0x29, 0x90, 0xCF, 0xA8, 0xA0, 0xB4, 0x85, 0x37, 0x48,
-    0x24, 0x2D, 0xCC, 0xFA, 0xD6, 0xE4, 0x0F, 0x02, 0x47, 0x7F, 0x3D, 0x6F, 0x72, 0xB8, 0x95, 0xC5,
-    0x5C, 0x62, 0xA4, 0xE5, 0xFE, 0x08, 0x22, 0xA9, 0xB6, 0x7B, 0x06, 0x4C, 0xB4, 0x2A, 0x99, 0x6A,
-    0xD3, 0x7A, 0x1C, 0x0D, 0xF5, 0x75, 0x4D, 0xB1, 0x75, 0xCE, 0x1D, 0x36, 0x86, 0xDC, 0x1D, 0x3A,
-    0xFD, 0xD8, 0xAE, 0xCB, 0xD0, 0xE9, 0x5C, 0x5A, 0xA7, 0x10, 0xEA, 0xB3, 0xDB, 0xB9, 0x28, 0xF8,
-    0xFA, 0x6B, 0x0A, 0x40, 0xF9, 0x75, 0xAC, 0xC1, 0x7E, 0x14, 0x83, 0xF2, 0xEB, 0x99, 0x0B, 0x85,
-    0x8C, 0xEB, 0xB0, 0x37, 0x41, 0x4F, 0x79, 0x68, 0x54, 0x24, 0x42, 0x0F, 0x5E, 0x93, 0x8A, 0x1B,
-    0xEA, 0x69, 0xAF, 0x56, 0x61, 0xF1, 0x17, 0xD6, 0xB5, 0x56, 0x8D, 0x29, 0xB1, 0xCE, 0xBF, 0x04,
-    0x5D, 0x44, 0x19, 0x92, 0x73, 0x46, 0x28, 0x33, 0x72, 0xFE, 0x67, 0x3B, 0x63, 0x6F, 0xFE, 0x98,
-    0xD1, 0x4D, 0x54, 0x3F, 0x7C, 0x7B, 0x15, 0x49, 0x98, 0x88, 0xE0, 0xAA, 0x9C, 0x47, 0x5B, 0x81,
-    0x38, 0xE7, 0xFE, 0x53, 0x77, 0xA0, 0xFA, 0xFD, 0xD4, 0x0F, 0x78, 0xC3, 0x13, 0xC1, 0x20, 0x04,
-    0xFD, 0x4C, 0x42, 0x3F, 0xF5, 0xB7, 0xA5, 0x17, 0xD7, 0xFC, 0x42, 0x9F, 0x99, 0xCC, 0x2F, 0x0A,
-    0x16, 0x3A, 0x06, 0xE9, 0x5F, 0xD0, 0xB8, 0x19, 0x2E, 0xBE, 0x76, 0x5C, 0xD2, 0xCB, 0x96, 0x07,
-    0x86, 0xE7, 0xD9, 0xA7, 0x11, 0x0F, 0xB0, 0x90, 0x8E, 0x1C, 0xEE, 0x92, 0x6E, 0x7B, 0x02, 0x23,
-    0x70, 0x9A, 0x00, 0x12, 0xC6, 0x26, 0xCE, 0x80, 0x2A, 0x21, 0xE9, 0x0A, 0x6F, 0x17, 0x83, 0xBF,
-    0x04, 0x4B, 0x42, 0xD7, 0xA0, 0xF0, 0x3C, 0x2B, 0x1D, 0x1F, 0x0D, 0x96, 0xF2, 0x4C, 0x20, 0x55,
-    0x0B, 0x84, 0xF7, 0x23, 0xEA, 0xD0, 0xE4, 0x3F, 0x05, 0x73, 0xE9, 0xD7, 0x70, 0xC5, 0x31, 0x59,
-    0x47, 0x75, 0x73, 0x8D, 0x61, 0xF0, 0x5D, 0x98, 0x30, 0x67, 0x10, 0xBD, 0x21, 0x8E, 0xE5, 0x9A,
-    0xE6, 0x38, 0xC9, 0xF4, 0x91, 0x21, 0x73, 0x9F, 0x07, 0x54, 0x86, 0x1C, 0x08, 0xE0, 0x2C, 0x86,
-    0x6A, 0x09, 0x7A, 0x20, 0xFD, 0x9B, 0x92, 0x91, 0x7B, 0x98, 0x59, 0x1B, 0xCF, 0x1F, 0x6E, 0xEB,
-    0x36, 0x4C, 0x9A, 0x87, 0x49, 0x7A, 0x7F, 0x62, 0x97, 0x5E, 0xD9, 0x06, 0x4C, 0x8E, 0x10, 0x1B,
-    0x8D, 0x10, 0x3C, 0x74, 0x80, 0x54, 0xED, 0xBF, 0x6C, 0xD6, 0x3A, 0xBD, 0x43, 0x23, 0xAF, 0xFD,
-    0x16, 0x5D, 0x14, 0x22, 0xFE, 0x50, 0x68, 0x1B, 0x5A, 0x75, 0xFA, 0x14, 0xE7, 0x06, 0xCD, 0xC2,
-    0xBE, 0x23, 0xD1, 0xD6, 0x53, 0xEF, 0x45, 0xED, 0x24, 0x9E, 0xD4, 0xF5, 0xEB, 0x37, 0x93, 0xCD,
-    0xC5, 0x30, 0x79, 0x80, 0x81, 0x26, 0xFA, 0x15, 0x13, 0x11, 0x19, 0xE1, 0xA2, 0x72, 0xE2, 0x72,
-    0xB6, 0x9A, 0xA7, 0xF2, 0x9A, 0x31, 0xBC, 0x8E, 0x8B, 0xC8, 0x5E, 0x25, 0x28, 0xE4, 0xCC, 0xBA,
-    0x0F, 0x6A, 0x39, 0xB3, 0xF3, 0xB9, 0x83, 0xE8, 0xFB, 0xD2, 0x59, 0x87, 0x8A, 0xCB, 0xB8, 0xE5,
-    0x42, 0xA3, 0xCB, 0x49, 0x00, 0xD5, 0x6A, 0xE9, 0x64, 0x66, 0xB6, 0x32, 0xA5, 0x5D, 0xDC, 0xD0,
-    0xF7, 0x87, 0x6C, 0x2D, 0x6A, 0x82, 0x13, 0xF2, 0xE4, 0xB6, 0xCC, 0xCE, 0x4C, 0x4D, 0xD0, 0xC2,
-    0xC5, 0x37, 0xA6, 0xDB, 0xF9, 0xEB, 0x0F, 0x2D, 0x19, 0x8C, 0x1F, 0x2C, 0x7C, 0x28, 0xA1, 0xB1,
-    0xD8, 0x9C, 0xF2, 0xAB, 0x1F, 0x98, 0x4F, 0x1D, 0xF1, 0x5F, 0xEB, 0x3C, 0x96, 0xDF, 0x9D, 0x5F,
-    0xF3, 0x5F, 0x93, 0xB3, 0x22, 0x75, 0x60, 0xE0, 0xB3, 0x02, 0xCD, 0x6B, 0x75, 0x01, 0x21, 0x2E,
-    0x9F, 0x4F, 0x43, 0x41, 0x66, 0xFD, 0x14, 0xB7, 0x42, 0x87, 0xF0, 0xE8, 0xF5, 0x4E, 0x0E, 0x2E,
-    0x40, 0x5B, 0xD1, 0x57, 0x16, 0x81, 0x7B, 0xB0, 0x26, 0x16, 0x9E, 0x33, 0x1A, 0xAD, 0x2A, 0xDD,
-    0x83, 0x39, 0xB1, 0x51, 0x1E, 0x63, 0xBA, 0x7A, 0xDB, 0xE5, 0xB3, 0x67, 0x34, 0x62, 0x2D, 0x64,
-    0x9C, 0xD2, 0x45, 0x7F, 0xE9, 0x2F, 0xC2, 0x2A, 0xCD, 0xEE, 0x35, 0xDF, 0x90, 0xCD, 0xE2, 0xB0,
-    0xC5, 0x3B, 0x7F, 0x91, 0x2C, 0x0B, 0xED, 0x1C, 0xC0, 0x84, 0x96, 0x68, 0x4A, 0x0A, 0xD4, 0xC3,
-    0x5F, 0x32, 0xFC, 0x36, 0xF3, 0x56, 0x96, 0xB4, 0xB0, 0x71, 0xD8, 0x0B, 0x1A, 0x22, 0xEF, 0xAD,
-    0xA7, 0x4A, 0x1E, 0x8A, 0xD9, 0xB4, 0xC7, 0xC4, 0x6C, 0xB6, 0x53, 0xCC, 0xA6, 0x28, 0xDD, 0x44,
-    0x24, 0x3A, 0x7A, 0x2E, 0xE3, 0xA6, 0x64, 0xF4, 0xE5, 0x6B, 0xBD, 0xC6, 0x6C, 0x36, 0x1A, 0x98,
-    0x79, 0x4D, 0xD4, 0xD5, 0xBD, 0x56, 0xCD, 0xC7, 0xBF, 0xD6, 0xD5, 0x78, 0x8A, 0xE1, 0x9C, 0x4B,
-    0x1D, 0xDB, 0x57, 0x35, 0xD2, 0x33, 0x74, 0x31, 0x9B, 0x4B, 0x8D, 0xD9, 0x6C, 0xC8, 0xD2, 0x56,
-    0x31, 0x9B, 0xBE, 0xC6, 0x6C, 0xDA, 0xE3, 0x63, 0x36, 0xDF, 0x15, 0x59, 0x9D, 0x59, 0x8D, 0x8E,
-    0x2B, 0x21, 0xAF, 0xD1, 0x6F, 0x16, 0x94, 0x97, 0x32, 0xA2, 0xE8, 0xD7, 0x9A, 0x48, 0xF1, 0xEC,
-    0xF6, 0xB6, 0x05, 0xAA, 0x37, 0x22, 0xAB, 0xC4, 0xC5, 0x88, 0xAC, 0x0E, 0x9C, 0x9F, 0x37, 0x40,
-    0x56, 0x0D, 0x35, 0x48, 0xE9, 0x1D, 0x5F, 0xC3, 0xC3, 0x45, 0xA0, 0x9C, 0x02, 0xB2, 0x26, 0x43,
-    0x81, 0x77, 0xB3, 0x9F, 0x66, 0x5C, 0x62, 0xA9, 0x8C, 0x2F, 0x65, 0xE4, 0x36, 0x11, 0x34, 0x61,
-    0x7A, 0x80, 0xCC, 0x82, 0x4E, 0xB5, 0x78, 0x97, 0x2B, 0x95, 0x2C, 0xA8, 0x03, 0x49, 0x8B, 0x39,
-    0xB8, 0x1A, 0x33, 0x0E, 0xA6, 0xC3, 0xC0, 0xCA, 0x56, 0x07, 0xBB, 0x54, 0xF0, 0x2D, 0x5E, 0xE8,
-    0xAC, 0x6F, 0x13, 0x4E, 0x89, 0x52, 0x53, 0x36, 0xE2, 0x37, 0x54, 0x3C, 0x1D, 0xA8, 0x2A, 0x52,
-    0x8E, 0xE4, 0x6D, 0xD6, 0x82, 0xCC, 0x34, 0x2F, 0x70, 0x9A, 0x45, 0x87, 0x19, 0xAD, 0x30, 0xF5,
-    0x1C, 0x56, 0xB4, 0xBC, 0x95, 0x30, 0xC8, 0x8E, 0x20, 0x13, 0x6B, 0x42, 0x74, 0x77, 0x09, 0x87,
-    0xF0, 0xDA, 0x31, 0xAC, 0xBD, 0xCC, 0x80, 0xEB, 0xA4, 0x05, 0x26, 0xAF, 0xE6, 0x8B, 0x88, 0x91,
-    0x01, 0xA8, 0xB4, 0x4E, 0xE9, 0x2D, 0x3D, 0x4D, 0xE2, 0xBC, 0xC4, 0x84, 0x1A, 0x6A, 0xCF, 0xBD,
-    0xE2, 0x5A, 0xCD, 0x64, 0x07, 0x50, 0x4B, 0x5E, 0x0F, 0x60, 0xF9, 0xBB, 0x9D, 0x65, 0x70, 0xDE,
-    0x65, 0x19, 0xBC, 0xE1, 0xB2, 0x0C, 0xCC, 0x7A, 0xB0, 0xCD, 0xA8, 0x59, 0x3A, 0x07, 0x82, 0xF2,
-    0xCD, 0x29, 0xCE, 0x2D, 0x71, 0xD1, 0x3E, 0x2E, 0x4D, 0xF9, 0x4B, 0xC6, 0x39, 0xC0, 0x84, 0x6C,
-    0x2E, 0xC3, 0x0B, 0xEA, 0xB2, 0xAC, 0x99, 0x56, 0x4C, 0x0F, 0x98, 0x0A, 0xF6, 0x95, 0x7D, 0xB8,
-    0x2A, 0x05, 0x70, 0x46, 0x04, 0xD8, 0xB7, 0x18, 0x8C, 0xF2, 0x6B, 0xA4, 0x0F, 0xD9, 0x5A, 0x65,
-    0x23, 0x54, 0x2C, 0x24, 0x5E, 0x2F, 0x10, 0x5B, 0x0B, 0xFC, 0x81, 0x72, 0x3F, 0xA6, 0x8F, 0x29,
-    0xF9, 0x21, 0x4E, 0x24, 0x4F, 0xE1, 0x44, 0x52, 0xE0, 0x04, 0x64, 0xAD, 0xC9, 0xC5, 0x94, 0x45,
-    0x16, 0x3E, 0xD8, 0x4D, 0x60, 0x61, 0x76, 0xAB, 0xB0, 0xC5, 0xAD, 0xE4, 0xC4, 0x4E, 0x0D, 0xFD,
-    0x06, 0x39, 0x3A, 0x00, 0xC0, 0x9A, 0xC0, 0xF9, 0x46, 0x14, 0x01, 0x52, 0x5A, 0x56, 0xE0, 0x70,
-    0xD6, 0xAC, 0xC5, 0x34, 0x29, 0xB6, 0xF4, 0x85, 0xF7, 0x8E, 0x8B, 0x29, 0x9D, 0x46, 0x26, 0xE7,
-    0xE6, 0x8C, 0x5A, 0xBE, 0x5D, 0x71, 0x31, 0xDE, 0xDC, 0x41, 0xE7, 0x01, 0x1A, 0xB7, 0xC1, 0x94,
-    0xCC, 0xC1, 0x38, 0x63, 0x3D, 0xE2, 0xA1, 0xD7, 0x99, 0x84, 0x51, 0x8D, 0x1E, 0x8B, 0xF1, 0xAD,
-    0x0F, 0x5D, 0x05, 0x33, 0x8B, 0xF9, 0x61, 0x95, 0x0F, 0xEC, 0x85, 0xB8, 0x9C, 0x5C, 0x05, 0xE4,
-    0x44, 0xF8, 0x80, 0xD8, 0x1C, 0x40, 0x47, 0xD2, 0x0C, 0x8A, 0xB9, 0x67, 0xB7, 0xCB, 0x85, 0xBC,
-    0x2F, 0xDB, 0x52, 0xAC, 0x72, 0x17, 0xDF, 0x57, 0xF0, 0xF7, 0x73, 0x50, 0xE8, 0x2E, 0x21, 0xF8,
-    0x3B, 0xBA, 0x82, 0x2B, 0xDF, 0x01, 0xD1, 0x24, 0xAB, 0xE0, 0x6F, 0x44, 0xCA, 0xCC, 0x1F, 0xA4,
-    0xEE, 0x72, 0x91, 0x33, 0x83, 0x59, 0x21, 0xC5, 0x4D, 0x06, 0x7F, 0x7F, 0x00, 0x8E, 0xA0, 0x0C,
-    0x9B, 0x5F, 0x87, 0xE5, 0xEE, 0x2D, 0x89, 0xD5, 0xBF, 0x8A, 0x9F, 0x9D, 0x2E, 0xE5, 0xB9, 0x4C,
-    0xBC, 0xB8, 0xB6, 0xA7, 0x71, 0x44, 0x74, 0x04, 0x21, 0xF0, 0xF9, 0xAE, 0x10, 0x91, 0x22, 0xE6,
-    0x34, 0xBA, 0xD3, 0x2B, 0x6E, 0xCA, 0x11, 0x74, 0xD7, 0x44, 0x62, 0x17, 0x27, 0x80, 0xB3, 0x17,
-    0x26, 0xFF, 0x10, 0x23, 0xC3, 0x89, 0x7C, 0x48, 0x6F, 0xCF, 0xE7, 0x2F, 0x7C, 0x30, 0xF9, 0x94,
-    0xEF, 0xB3, 0x62, 0x8A, 0xCE, 0x71, 0x04, 0x37, 0x34, 0xAE, 0x85, 0xE9, 0xC6, 0xF6, 0xF6, 0xCE,
-    0x15, 0x27, 0xC3, 0x3A, 0x78, 0x24, 0x49, 0x49, 0xC4, 0xEF, 0x5A, 0x47, 0x51, 0x37, 0x77, 0x20,
-    0x39, 0xC8, 0xC8, 0x73, 0xF8, 0xA8, 0x5B, 0xC9, 0x2F, 0x15, 0x65, 0x6C, 0x4B, 0xD3, 0x1A, 0x35,
-    0x1E, 0xF6, 0x16, 0xDE, 0xF8, 0xE6, 0x80, 0x92, 0x44, 0x3D, 0xD8, 0x1A, 0x77, 0xFD, 0xDE, 0x40,
-    0x09, 0xDF, 0x8D, 0x1E, 0xDC, 0x96, 0x53, 0x43, 0x8C, 0xD9, 0x6B, 0x73, 0xCD, 0x11, 0x57, 0xEB,
-    0xBB, 0x71, 0x69, 0xC7, 0x42, 0xD3, 0x7F, 0x38, 0x56, 0x91, 0x59, 0xAF, 0x39, 0xF3, 0xB2, 0x4B,
-    0x39, 0xAE, 0x39, 0x2B, 0x84, 0xD0, 0x86, 0x0B, 0x96, 0xBE, 0xEF, 0x92, 0x2E, 0xF1, 0x9C, 0x9E,
-    0xF2, 0x9C, 0x89, 0x9A, 0x16, 0x16, 0xF9, 0xCC, 0x32, 0x1E, 0xBB, 0xD3, 0x5A, 0x25, 0x5A, 0xAD,
-    0x84, 0xE5, 0x4B, 0x10, 0xBB, 0x15, 0xB4, 0x8C, 0xDB, 0x21, 0xCB, 0x2F, 0x57, 0x8F, 0x4A, 0xB4,
-    0xAA, 0xD4, 0x94, 0x12, 0xC0, 0xA8, 0xF0, 0xAF, 0x50, 0x59, 0x54, 0x3E, 0xF3, 0x58, 0xA6, 0xDD,
-    0x83, 0x7A, 0x1E, 0x3A, 0xC7, 0xC5, 0xFA, 0xD9, 0xDF, 0xDE, 0xC1, 0xFB, 0x06, 0x84, 0xB4, 0x15,
-    0xD0, 0x56, 0xB9, 0xE1, 0x0D, 0xDF, 0x79, 0x81, 0x3A, 0x53, 0x4D, 0x9E, 0x80, 0x9E, 0xCA, 0x21,
-    0xBB, 0x7C, 0xC2, 0xB2, 0xB9, 0x4A, 0x33, 0xDA, 0xD4, 0xD4, 0xDA, 0x33, 0x40, 0xDF, 0xAF, 0x22,
-    0x98, 0xEA, 0x37, 0xD2, 0xB7, 0xB3, 0xB5, 0x1C, 0x8F, 0x62, 0x34, 0x38, 0x18, 0x0C, 0xC5, 0x7B,
-    0x43, 0x3F, 0xF0, 0x76, 0xB0, 0x20, 0x1B, 0x4E, 0xA0, 0x3F, 0xDE, 0x69, 0xD9, 0xA8, 0xD1, 0x87,
-    0x93, 0x8D, 0x3A, 0x9B, 0x66, 0xED, 0x4A, 0xD1, 0x9A, 0xA2, 0x27, 0xC3, 0x85, 0x39, 0xE2, 0x3E,
-    0x71, 0xA6, 0xCF, 0xA1, 0xE4, 0x7E, 0xAF, 0xF8, 0xE8, 0xA3, 0x88, 0xEA, 0xE3, 0xA3, 0x88, 0xF2,
-    0x5A, 0xA3, 0x88, 0xF2, 0xE6, 0xD1, 0x43, 0x71, 0xC8, 0x2E, 0x0A, 0xD9, 0xEB, 0x0E, 0x47, 0x20,
-    0x47, 0xEE, 0x4D, 0x46, 0x50, 0xE2, 0x8F, 0x3F, 0xA2, 0x4C, 0xDD, 0xE5, 0x75, 0x99, 0xBA, 0x7B,
-    0xD5, 0xA8, 0x70, 0x4C, 0x8B, 0x2F, 0xEF, 0x00, 0xC3, 0x65, 0x50, 0x23, 0x6E, 0x74, 0xE2, 0x39,
-    0xF3, 0x41, 0x87, 0x48, 0xD5, 0x74, 0xA4, 0x9C, 0x6D, 0x94, 0x99, 0xCB, 0x3F, 0x4F, 0x46, 0xCD,
-    0x7F, 0xAB, 0x66, 0xCE, 0xCD, 0x6C, 0xB8, 0x23, 0x6B, 0xB4, 0x2C, 0xD6, 0x42, 0xD4, 0x15, 0x96,
-    0x70, 0x44, 0xA0, 0xD3, 0xD7, 0x1C, 0xDA, 0x79, 0x49, 0xA7, 0x48, 0x76, 0x7B, 0x83, 0x9F, 0x26,
-    0x3D, 0x65, 0xD6, 0x4E, 0x05, 0x36, 0x18, 0x22, 0xA8, 0xAA, 0x33, 0xA7, 0xE9, 0x1F, 0x50, 0xB7,
-    0xFC, 0x1E, 0x9D, 0x6F, 0x11, 0x90, 0xC3, 0x02, 0xE6, 0x4A, 0xBE, 0x18, 0xFB, 0x3D, 0xFD, 0x2B,
-    0x57, 0xB7, 0xC9, 0x09, 0x0A, 0x11, 0x09, 0x19, 0x66, 0x9E, 0x8D, 0xBE, 0x89, 0x38, 0x90, 0xEE,
-    0x3E, 0xED, 0xFF, 0xE5, 0x13, 0xB4, 0x6C, 0x5F, 0x63, 0xFF, 0x02, 0x15, 0x77, 0x5A, 0x94, 0xD8,
-    0x14, 0x07, 0xBD, 0x9E, 0xE2, 0x8C, 0x8B, 0x1E, 0x6C, 0xF5, 0x57, 0xEC, 0xF4, 0x25, 0x83, 0x7B,
-    0x5E, 0xD9, 0x4D, 0xB5, 0x86, 0x5C, 0xEE, 0x42, 0xE5, 0xD9, 0xEB, 0x40, 0xC8, 0x29, 0x50, 0x32,
-    0x74, 0xBE, 0x8F, 0x34, 0x08, 0x18, 0xC5, 0x0F, 0xAA, 0x1F, 0x31, 0x73, 0x09, 0xF0, 0xA3, 0x57,
-    0x2E, 0xAC, 0x4B, 0x94, 0x0B, 0x7A, 0x10, 0xC2, 0x09, 0x61, 0xA3, 0xD1, 0x4F, 0x60, 0x77, 0x02,
-    0x85, 0xBA, 0x2B, 0x41, 0x9C, 0xC7, 0x53, 0x0B, 0xD9, 0xFC, 0xC1, 0x45, 0x6C, 0xFE, 0x90, 0xC9,
-    0x00, 0x4B, 0x46, 0x4F, 0x23, 0x8F, 0xEC, 0x07, 0xE8, 0xCD, 0x2B, 0x7F, 0xD2, 0x60, 0x53, 0xEC,
-    0xD0, 0xF8, 0x95, 0x6F, 0x76, 0xCE, 0x37, 0x2C, 0x77, 0x28, 0xE9, 0x88, 0xEF, 0x90, 0x7F, 0x9B,
-    0x34, 0x25, 0x86, 0x9F, 0x5D, 0xF7, 0xE8, 0x4D, 0x12, 0xAB, 0x90, 0x8A, 0x50, 0x26, 0xA2, 0xB1,
-    0x85, 0x58, 0x1F, 0xB3, 0x2F, 0x7C, 0xC4, 0x49, 0xD1, 0xD4, 0xD6, 0x43, 0xEC, 0x05, 0xD4, 0x54,
-    0x1F, 0x3E, 0x2E, 0xA3, 0xF1, 0xE1, 0x7E, 0xCB, 0x6F, 0x52, 0xDB, 0x05, 0x83, 0x08, 0x31, 0x88,
-    0xB2, 0xC6, 0x6F, 0x33, 0xBF, 0x53, 0x5B, 0x98, 0xD0, 0xD0, 0x45, 0x5C, 0x79, 0x8E, 0x05, 0x25,
-    0xD8, 0x76, 0xA0, 0x33, 0xE8, 0xD0, 0xA8, 0x21, 0x8E, 0xC4, 0xC4, 0x07, 0x2D, 0x8E, 0x46, 0xAC,
-    0x48, 0x83, 0xAA, 0x11, 0xF3, 0x9C, 0xC5, 0x4D, 0x88, 0xC0, 0x8D, 0x07, 0x50, 0x9B, 0x6B, 0xE9,
-    0x3A, 0x12, 0xC2, 0xF3, 0x25, 0x4F, 0xAB, 0xA1, 0x50, 0x4B, 0x91, 0x2E, 0xAD, 0xE3, 0x6B, 0x7B,
-    0xA8, 0x1A, 0x51, 0x9C, 0x23, 0x7C, 0xF8, 0xDF, 0x66, 0xD0, 0x36, 0x84, 0xED, 0x04, 0x95, 0xE6,
-    0xF5, 0xC5, 0x68, 0x6A, 0x87, 0x40, 0x9B, 0xB4, 0x52, 0xD9, 0x62, 0x35, 0xCF, 0xCF, 0xEF, 0x34,
-    0x47, 0x8F, 0x3C, 0x95, 0x9C, 0xDF, 0x21, 0xD7, 0x54, 0x27, 0x8C, 0x3F, 0xA8, 0x23, 0x4E, 0x3A,
-    0x57, 0x73, 0xF8, 0xAA, 0x64, 0xFC, 0xB5, 0xCB, 0xB2, 0x2C, 0x5D, 0x9D, 0x2F, 0x85, 0x6A, 0x54,
-    0x32, 0xAA, 0x29, 0xC1, 0xD3, 0xC1, 0xA0, 0xA7, 0x43, 0xA7, 0x69, 0xC1, 0x9E, 0xC6, 0x33, 0x22,
-    0xD8, 0x7B, 0x0C, 0x37, 0x5F, 0x43, 0xBD, 0x5C, 0x24, 0x7A, 0xD0, 0xC0, 0x05, 0x15, 0xB7, 0x30,
-    0xD2, 0xD2, 0xE5, 0x65, 0xE9, 0xF4, 0xE1, 0xAE, 0x4B, 0x7E, 0x2B, 0x1D, 0x7A, 0x51, 0x8C, 0x9B,
-    0x06, 0x4B, 0x99, 0x58, 0x8F, 0xFB, 0x2D, 0x9A, 0xEC, 0xB7, 0x29, 0xA1, 0x8B, 0x41, 0x51, 0x79,
-    0xFA, 0x3D, 0x59, 0x93, 0xA6, 0x65, 0x10, 0x56, 0xCB, 0x02, 0x0A, 0x44, 0x59, 0xFD, 0x16, 0xFC,
-    0x16, 0x01, 0x62, 0x19, 0xC4, 0x00, 0x72, 0x00, 0xED, 0x02, 0x05, 0x57, 0xEC, 0x22, 0x54, 0xB6,
-    0xF4, 0xE8, 0x9D, 0x9F, 0x61, 0x3D, 0x38, 0x68, 0x43, 0xE5, 0xEA, 0x28, 0x2A, 0x5C, 0x11, 0xC9,
-    0xD1, 0xB1, 0xEB, 0x98, 0xAC, 0x63, 0xB9, 0xD3, 0xEE, 0x4B, 0x4E, 0x31, 0xC9, 0x34, 0x70, 0x2C,
-    0xB1, 0x98, 0x13, 0x57, 0x10, 0x94, 0x64, 0x0B, 0x2D, 0xB9, 0xB6, 0xB2, 0xF6, 0x23, 0x5A, 0xFB,
-    0xEA, 0x83, 0x82, 0xED, 0x3E, 0xE8, 0x09, 0x3B, 0x6A, 0x91, 0x2D, 0x14, 0xCE, 0xED, 0x77, 0xFB,
-    0x85, 0x9E, 0x80, 0x32, 0x89, 0xB6, 0xCB, 0x4F, 0x0F, 0x64, 0xD0, 0x13, 0x67, 0x28, 0xE7, 0xD9,
-    0x0A, 0xC7, 0x50, 0xE0, 0xDA, 0xC5, 0x8F, 0x28, 0x96, 0x11, 0xA8, 0xBA, 0x50, 0xBB, 0xF1, 0x42,
-    0xFE, 0xD7, 0xD2, 0x38, 0x63, 0xA0, 0xD0, 0x6C, 0x72, 0xE4, 0x3D, 0x9E, 0x1A, 0xE6, 0xBD, 0xEB,
-    0x2D, 0x9F, 0x8A, 0xB7, 0xF0, 0x06, 0x8D, 0x52, 0x65, 0x9A, 0x2B, 0xD5, 0xB9, 0x56, 0x5E, 0x5B,
-    0x2F, 0xF1, 0x32, 0x77, 0x89, 0x99, 0x7A, 0x7A, 0xBC, 0x64, 0x1A, 0x2F, 0xE3, 0x80, 0x64, 0x33,
-    0x0D, 0xE4, 0xDA, 0x25, 0x66, 0x2D, 0xF0, 0xEF, 0x06, 0x77, 0x79, 0xCF, 0x4B, 0xDC, 0x68, 0x66,
-    0xC6, 0x45, 0xEC, 0x6B, 0x7A, 0x8A, 0x8B, 0x9A, 0xC7, 0xA8, 0x9C, 0xD1, 0xA8, 0xD4, 0x81, 0x61,
-    0xA9, 0xB6, 0x67, 0x5C, 0xEA, 0xEB, 0x97, 0xB4, 0x37, 0x9F, 0x38, 0xB4, 0xBA, 0x57, 0x57, 0xDF,
-    0x70, 0x63, 0xA3, 0x71, 0xA9, 0xD3, 0x8A, 0xF1, 0xA9, 0xE3, 0x28, 0xBC, 0xDB, 0x4A, 0x23, 0x37,
-    0x8D, 0x86, 0xA9, 0x1A, 0x17, 0xA7, 0xAA, 0x41, 0xA3, 0x5B, 0xC6, 0xB9, 0xE2, 0xD0, 0x21, 0xF9,
-    0xD8, 0x45, 0x26, 0x3E, 0x78, 0xFE, 0xB1, 0xD2, 0xB1, 0x89, 0x35, 0xEB, 0x68, 0x4A, 0xD6, 0x79,
-    0xDF, 0x87, 0xD4, 0xA8, 0xD2, 0xCE, 0xCF, 0xF4, 0x90, 0x9A, 0xF2, 0x60, 0x50, 0x17, 0x6C, 0xE7,
-    0x7E, 0xE8, 0xD9, 0xC6, 0xFD, 0x70, 0x46, 0xBC, 0x86, 0xC8, 0x7B, 0x37, 0xDE, 0x8B, 0xB0, 0x8C,
-    0xCB, 0x2E, 0x73, 0x87, 0xB4, 0x62, 0xA0, 0x56, 0x61, 0x75, 0x87, 0x92, 0xE9, 0x50, 0x87, 0xA1,
-    0x40, 0xF0, 0x05, 0xBC, 0xFF, 0x35, 0x74, 0x77, 0x9F, 0xE5, 0x0B, 0x98, 0x00, 0x32, 0x2A, 0xDE,
-    0xE1, 0xE4, 0xD2, 0x9D, 0xB4, 0xF9, 0x74, 0x54, 0xDD, 0xC3, 0x31, 0x00, 0x20, 0x18, 0xE3, 0x7A,
-    0xF7, 0x1C, 0xFE, 0x62, 0x12, 0x3B, 0x5E, 0xB4, 0x8A, 0xC0, 0x55, 0xED, 0x7B, 0x4A, 0x6E, 0x26,
-    0xFF, 0x15, 0x5A, 0xE1, 0x13, 0x34, 0x86, 0x56, 0x27, 0x72, 0x70, 0xFD, 0x81, 0x8D, 0x5D, 0x3D,
-    0xF0, 0x88, 0xE5, 0x1C, 0x63, 0x55, 0x49, 0x1E, 0x18, 0xF6, 0x2C, 0x0F, 0x40, 0x52, 0xB8, 0x9F,
-    0xD0, 0x9E, 0x83, 0x35, 0xD7, 0xBB, 0x03, 0x71, 0xAD, 0x07, 0xBC, 0xC1, 0x1D, 0x88, 0xEA, 0x64,
-    0x9F, 0xFC, 0x7A, 0x60, 0xB8, 0xAE, 0xF4, 0xEE, 0xAF, 0xE8, 0xAF, 0xAA, 0xA6, 0xB8, 0x10, 0xC7,
-    0x4E, 0xC6, 0xD0, 0x46, 0x33, 0xF5, 0xC7, 0xE4, 0xE1, 0x1E, 0x7B, 0xC3, 0x41, 0xC9, 0x1B, 0xE5,
-    0x08, 0x50, 0xBA, 0x5F, 0x04, 0xFB, 0x0A, 0xC7, 0xBB, 0x74, 0x66, 0x95, 0x35, 0x76, 0xD7, 0x63,
-    0x58, 0x53, 0xC1, 0xE4, 0x9E, 0x1C, 0x59, 0x4B, 0x2A, 0x5A, 0xBE, 0x45, 0xDB, 0x3B, 0x41, 0xB2,
-    0x5C, 0x9E, 0xF9, 0x4B, 0xD6, 0xB7, 0x41, 0xE6, 0x36, 0x32, 0xAB, 0x10, 0xEB, 0x95, 0x25, 0x0B,
-    0x05, 0xBE, 0x3A, 0xB0, 0x8C, 0x54, 0xEC, 0x6A, 0x98, 0xAF, 0xD8, 0x8D, 0x8F, 0xEC, 0x12, 0x14,
-    0x03, 0xF0, 0x13, 0x34, 0x0C, 0x10, 0x92, 0xBB, 0x24, 0xC0, 0xCE, 0x22, 0x28, 0x82, 0xD2, 0xFA,
-    0x0E, 0x5E, 0x1C, 0x11, 0x72, 0xC2, 0x44, 0xE4, 0x47, 0xA8, 0x45, 0x02, 0x87, 0x72, 0x4F, 0x1C,
-    0x38, 0xA5, 0xDC, 0x1E, 0xEE, 0x97, 0x4E, 0xCE, 0xC8, 0x63, 0x0E, 0x00, 0x7E, 0xDB, 0xBF, 0x21,
-    0x17, 0x38, 0xB9, 0x65, 0xB6, 0x27, 0x4B, 0x8D, 0xB6, 0x13, 0xDD, 0x26, 0x49, 0x95, 0xB4, 0x0C,
-    0xBF, 0x86, 0x14, 0x4E, 0x85, 0xF9, 0x89, 0xB8, 0xF5, 0x9B, 0x50, 0x4C, 0x99, 0xA8, 0x4E, 0x33,
-    0x31, 0x9B, 0x8A, 0x5E, 0x54, 0xA7, 0x52, 0xEC, 0x29, 0xB1, 0x2F, 0xE3, 0x2A, 0xA9, 0xC2, 0x3A,
-    0x47, 0x9B, 0x9E, 0xC4, 0xE1, 0x1E, 0xD2, 0xCE, 0x6F, 0x20, 0x7B, 0x93, 0x22, 0x5E, 0xC4, 0x15,
-    0x2C, 0xD0, 0xF4, 0x87, 0x0B, 0xD1, 0x36, 0x53, 0x8E, 0xAE, 0xDD, 0xFF, 0x33, 0x72, 0xBD, 0xC6,
-    0x6C, 0x3E, 0x4F, 0xDD, 0xEE, 0x63, 0x52, 0x45, 0xA1, 0x3E, 0x54, 0x45, 0x21, 0x7F, 0x66, 0x8A,
-    0xEF, 0xA4, 0x8E, 0x41, 0x2B, 0xFD, 0x9F, 0x32, 0x3C, 0x88, 0x4A, 0x55, 0x4E, 0xFC, 0xFF, 0x45,
-    0xF3, 0x61, 0x45, 0x5B, 0x23, 0x9C, 0xC4, 0xEC, 0xEC, 0x3A, 0x63, 0x13, 0x0F, 0x3F, 0x2D, 0x97,
-    0xD1, 0x4C, 0x2C, 0x5C, 0xAA, 0xE1, 0x54, 0x04, 0xF4, 0xE3, 0x5C, 0xE8, 0x61, 0x42, 0x0A, 0xDC,
-    0xB2, 0x5E, 0x01, 0x05, 0xEB, 0x2E, 0x52, 0x75, 0x8E, 0x7A, 0xC5, 0x87, 0x12, 0x5D, 0xBE, 0x6B,
-    0x42, 0xD5, 0x33, 0xEC, 0x04, 0x49, 0x2F, 0x47, 0x41, 0x9D, 0x4C, 0xF0, 0x28, 0x4D, 0xA8, 0x82,
-    0x06, 0x2A, 0xDC, 0x05, 0xE0, 0x9E, 0x83, 0x16, 0x1A, 0xA8, 0x76, 0x34, 0xD7, 0x57, 0x7E, 0x1E,
-    0xA8, 0xE3, 0x74, 0x20, 0x51, 0xC5, 0xAC, 0xD8, 0x4B, 0x07, 0x77, 0x4B, 0xA8, 0x2B, 0xAD, 0x70,
-    0x4F, 0x6F, 0xA0, 0x25, 0x16, 0x35, 0xD4, 0x55, 0xD3, 0x1F, 0x93, 0xFA, 0x7A, 0x15, 0x0C, 0x3A,
-    0x70, 0x79, 0xB3, 0x66, 0x56, 0xAA, 0xEC, 0x70, 0x3E, 0xDB, 0xF7, 0xDA, 0x39, 0x65, 0x9F, 0x99,
-    0x7C, 0x84, 0x1A, 0x4D, 0x7A, 0xAB, 0xF1, 0xF2, 0xFE, 0xEF, 0x15, 0x2F, 0xBF, 0x98, 0xF4, 0x1D,
-    0xE5, 0xAF, 0xD7, 0x1D, 0x3E, 0xA5, 0x15, 0xC6, 0xF1, 0xCB, 0xCD, 0xF9, 0xDC, 0xBC, 0x6B, 0xB7,
-    0x66, 0xEF, 0xD2, 0xAD, 0xF9, 0x5A, 0xB7, 0x7A, 0xEB, 0xDD, 0xFA, 0x34, 0xBB, 0xB5, 0x5B, 0x75,
-    0xAB, 0x37, 0xB7, 0x07, 0x2F, 0x90, 0xF6, 0xF0, 0xD0, 0x79, 0x79, 0xED, 0x85, 0x8F, 0xA2, 0x5B,
-    0x51, 0xE0, 0x5B, 0xD3, 0x10, 0xFC, 0xEB, 0xBA, 0x15, 0xBD, 0x93, 0x92, 0xE0, 0x2E, 0x4F, 0xDD,
-    0x3A, 0x1B, 0xEB, 0x75, 0xC8, 0x91, 0x8D, 0x9D, 0x5F, 0x64, 0xEF, 0xB3, 0x5B, 0xEF, 0xE4, 0xC2,
-    0x1D, 0xFD, 0x7A, 0xFE, 0xBF, 0x93, 0xCA, 0x6E, 0x35, 0x22, 0x6D, 0xED, 0xA1, 0x95, 0x13, 0xC7,
-    0x5F, 0xBC, 0x4D, 0xD9, 0x07, 0x0F, 0xAC, 0x65, 0x1F, 0xAC, 0xEA, 0x13, 0x68, 0xAA, 0x48, 0xBE,
-    0x6A, 0x97, 0xA2, 0x81, 0x21, 0xBB, 0xEA, 0x0F, 0x34, 0x4B, 0x74, 0x43, 0xEB, 0x2C, 0xA9, 0x25,
-    0x62, 0xA9, 0x87, 0xFC, 0xA4, 0x7F, 0xE4, 0xED, 0x9D, 0x4A, 0x4C, 0x9B, 0x73, 0x3E, 0x28, 0xA3,
-    0xCC, 0x92, 0x0C, 0x76, 0x76, 0xB2, 0x08, 0xC4, 0x7C, 0x3E, 0x2D, 0x0F, 0xF4, 0x20, 0x32, 0x81,
-    0x43, 0xDC, 0x2D, 0x56, 0x78, 0xC6, 0xB2, 0xCC, 0xAE, 0xD0, 0x32, 0x69, 0x94, 0x19, 0xC8, 0x8D,
-    0xA2, 0x6F, 0x63, 0xE5, 0xE5, 0x0F, 0xF1, 0x82, 0xD0, 0x15, 0xBC, 0x76, 0xE1, 0xF2, 0x0B, 0x57,
-    0x36, 0x6A, 0x79, 0xA4, 0x66, 0x43, 0x39, 0xC6, 0xE2, 0x3A, 0x63, 0x2C, 0x18, 0x41, 0xE1, 0x51,
-    0xC7, 0x3A, 0x3D, 0xAA, 0x95, 0xA3, 0x53, 0xB6, 0x00, 0x7F, 0x67, 0x94, 0x8E, 0xB5, 0x91, 0xA6,
-    0x09, 0x04, 0xF6, 0x6A, 0x17, 0x35, 0xA7, 0x81, 0x3B, 0xE8, 0xEA, 0xA5, 0xA8, 0xB9, 0x4F, 0x57,
-    0xF7, 0xCA, 0xEA, 0xAE, 0xA8, 0xB9, 0xCB, 0x15, 0x56, 0xB8, 0x95, 0x55, 0x72, 0x30, 0x9F, 0xDB,
-    0xAB, 0x33, 0x7D, 0x0F, 0x35, 0x88, 0xEC, 0x21, 0xFC, 0x7A, 0x38, 0x04, 0x5D, 0x3F, 0x71, 0x28,
-    0xEE, 0xDF, 0x81, 0xD7, 0x5F, 0xD5, 0x62, 0x2B, 0x00, 0xA9, 0x44, 0xB5, 0x7E, 0x80, 0x93, 0xAE,
-    0x25, 0x8C, 0xD6, 0x8F, 0x35, 0x55, 0xFC, 0x7E, 0x3D, 0xAC, 0x26, 0xD5, 0xB0, 0x1A, 0xBB, 0x1E,
-    0x56, 0xE3, 0xAA, 0xAE, 0x30, 0x57, 0x7A, 0xF2, 0xD8, 0xDB, 0xAB, 0xD4, 0x3A, 0xB5, 0x51, 0x23,
-    0xF0, 0x3F, 0x15, 0x5C, 0x39, 0x36, 0xBA, 0xE7, 0xC6, 0xA7, 0x76, 0x06, 0x8D, 0x2E, 0x02, 0xC5,
-    0x7B, 0xE3, 0x6B, 0x06, 0x87, 0x7F, 0x56, 0xAC, 0xA5, 0x3B, 0x28, 0x98, 0x32, 0x62, 0xF5, 0xD1,
-    0xE8, 0x70, 0x67, 0x22, 0xCB, 0xBF, 0xB2, 0xF6, 0x9B, 0x28, 0xAA, 0xD3, 0x42, 0xDF, 0xB5, 0x2C,
-    0xE1, 0xDE, 0xB9, 0x9C, 0x15, 0x68, 0xAD, 0x2C, 0xFF, 0x56, 0xE2, 0x46, 0x9A, 0xCA, 0xA2, 0xCA,
-    0x6C, 0x68, 0x2F, 0xD8, 0xCC, 0x45, 0x96, 0x8C, 0xB9, 0x2C, 0x6A, 0x16, 0x33, 0x04, 0x44, 0x1F,
-    0xAB, 0x81, 0x1F, 0x2C, 0x0F, 0xC3, 0x0A, 0xEE, 0x23, 0x47, 0x08, 0xD6, 0xA6, 0x59, 0xBA, 0x22,
-    0xA6, 0x99, 0x4E, 0xB3, 0x42, 0x23, 0x05, 0x6F, 0xA9, 0xEA, 0x8D, 0xA7, 0xD9, 0x76, 0x2D, 0xAB,
-    0xDE, 0x44, 0x05, 0xAB, 0x25, 0xB4, 0xAC, 0x7A, 0xF3, 0xA3, 0x27, 0x6F, 0x54, 0xF5, 0x86, 0x97,
-    0x21, 0xE1, 0xFA, 0xBA, 0x9D, 0x9B, 0xAC, 0x7A, 0x73, 0x93, 0x49, 0x41, 0xCF, 0x21, 0x29, 0x28,
-    0x62, 0x07, 0x37, 0x29, 0x35, 0xF6, 0x23, 0x49, 0x41, 0x38, 0x6A, 0x22, 0x76, 0x5E, 0x7D, 0xE3,
-    0xA4, 0xA0, 0x33, 0x66, 0x0C, 0x25, 0x70, 0xB1, 0x04, 0x2E, 0x98, 0xE0, 0xA6, 0x6B, 0xF7, 0x6C,
-    0x22, 0xFE, 0x48, 0x23, 0x09, 0x8C, 0xDA, 0xCA, 0xD1, 0xB0, 0xBD, 0xE3, 0x02, 0x49, 0x9A, 0x71,
-    0x52, 0xE9, 0xF4, 0x7A, 0x5F, 0x3B, 0xC4, 0x2D, 0x51, 0x18, 0x67, 0xC1, 0x28, 0x3D, 0xF0, 0xC8,
-    0xEA, 0x98, 0xE8, 0xD5, 0xF2, 0xBA, 0xE8, 0xD5, 0x23, 0x41, 0xAA, 0x87, 0x4E, 0x24, 0x9A, 0x49,
-    0x0A, 0xFE, 0x64, 0x59, 0x1B, 0x3C, 0xB5, 0xF7, 0x8B, 0x31, 0x8F, 0xA2, 0x85, 0xDD, 0x58, 0x98,
-    0x45, 0xAB, 0xB4, 0xDC, 0x54, 0x90, 0xEA, 0xFB, 0x8C, 0x5E, 0xE5, 0x07, 0x50, 0x46, 0x51, 0x3E,
-    0x66, 0xF4, 0x99, 0xFC, 0x2A, 0xAB, 0x55, 0xC7, 0x4B, 0xC2, 0x8A, 0x44, 0x71, 0xDB, 0x59, 0x06,
-    0xE4, 0xB1, 0xAC, 0x68, 0xC9, 0xF8, 0x5D, 0xA2, 0x28, 0xCA, 0xAB, 0x0D, 0x58, 0xB0, 0xDF, 0xA5,
-    0x0F, 0x74, 0x1A, 0x39, 0x56, 0xBE, 0xBE, 0xBD, 0xFD, 0x30, 0x42, 0xB0, 0x98, 0xCB, 0x5C, 0xBA,
-    0x80, 0xE1, 0xB3, 0xBD, 0x5A, 0xDC, 0x6E, 0xCA, 0xFB, 0x87, 0xA3, 0x69, 0xFC, 0xC3, 0xE5, 0xE1,
-    0x3D, 0x67, 0x22, 0x44, 0xEE, 0xAA, 0xDC, 0x7D, 0x10, 0xC6, 0xEE, 0x9B, 0xCD, 0xA5, 0xE3, 0xEF,
-    0x4A, 0x9B, 0x34, 0x86, 0x12, 0x07, 0xBE, 0x6D, 0xBC, 0xB8, 0x8A, 0x9E, 0x41, 0x6A, 0x82, 0xE2,
-    0x9D, 0x26, 0x3E, 0x28, 0x19, 0xBD, 0x90, 0xD4, 0xF7, 0x22, 0x44, 0xE3, 0x95, 0x26, 0x47, 0x70,
-    0xD6, 0x2B, 0x70, 0x4B, 0xA4, 0x8C, 0x99, 0x65, 0x13, 0x7F, 0xA2, 0x4C, 0xF5, 0xFB, 0x03, 0xA2,
-    0x09, 0xDC, 0x7C, 0x2F, 0x8E, 0x7E, 0xB7, 0x44, 0x15, 0xB6, 0x1E, 0x81, 0x90, 0xB1, 0xBD, 0xA6,
-    0xDF, 0x27, 0x69, 0xA1, 0xD8, 0x50, 0x87, 0xD3, 0xE0, 0x9D, 0x4F, 0x50, 0x87, 0x86, 0x7D, 0xB6,
-    0xCE, 0x70, 0x7D, 0xA7, 0xCA, 0xA4, 0xEE, 0xAB, 0x0B, 0x4E, 0x5E, 0xC6, 0xC6, 0xAC, 0x47, 0x0A,
-    0x9F, 0x58, 0x0B, 0x5F, 0xFA, 0x28, 0x46, 0x61, 0x58, 0x45, 0x61, 0xEA, 0x0D, 0x92, 0x15, 0x98,
-    0xE9, 0x35, 0x6B, 0xF6, 0x9A, 0xF9, 0xE0, 0xBF, 0xEA, 0xC2, 0x20, 0x6B, 0xE7, 0x43, 0x0B, 0xEB,
-    0xD1, 0xF5, 0x5A, 0x8E, 0xD5, 0xA1, 0x82, 0xD6, 0x1B, 0xCB, 0xA3, 0x4D, 0xA1, 0xE3, 0xF9, 0x54,
-    0x19, 0x66, 0x23, 0x33, 0xC7, 0xFF, 0x9D, 0x40, 0x75, 0x80, 0x2D, 0x59, 0xF9, 0x0C, 0x11, 0x45,
-    0x75, 0xB8, 0x14, 0x3A, 0xA8, 0x18, 0xFD, 0x0B, 0x84, 0xC9, 0x89, 0x18, 0x4E, 0x7B, 0x73, 0xB2,
-    0xC4, 0x24, 0x0F, 0xDF, 0x2E, 0xE0, 0x4B, 0x63, 0xCE, 0x80, 0x2B, 0xF6, 0xCD, 0x70, 0xC4, 0x73,
-    0x5A, 0xA6, 0x04, 0xD8, 0xAE, 0x1C, 0xD2, 0x1E, 0xAC, 0x92, 0x4A, 0x5D, 0x10, 0x97, 0x54, 0xE1,
-    0xC7, 0xC9, 0xA4, 0x7A, 0xC2, 0x7D, 0xB8, 0xC1, 0x8E, 0xEA, 0xF4, 0xA8, 0xEC, 0xE6, 0x7F, 0x3A,
-    0xB9, 0x26, 0x92, 0x2A, 0xD7, 0xC2, 0x40, 0xB3, 0x4E, 0x09, 0x2F, 0xC7, 0xBD, 0x28, 0x5D, 0x70,
-    0x7B, 0x68, 0x56, 0x33, 0xA4, 0x00, 0x2B, 0xEA, 0xCA, 0x46, 0xB0, 0xEA, 0x10, 0xDA, 0x25, 0xDC,
-    0x58, 0xDE, 0x03, 0xFC, 0x88, 0x9F, 0xB8, 0x22, 0x97, 0x5A, 0xA2, 0xC4, 0x14, 0x90, 0x3F, 0xBB,
-    0x88, 0x06, 0x7D, 0x47, 0xD1, 0x50, 0x0A, 0x85, 0x64, 0x87, 0x7B, 0x1C, 0xD6, 0x85, 0x2F, 0xA8,
-    0x8C, 0xDD, 0xDB, 0xA9, 0x90, 0x0D, 0x1A, 0x0D, 0xD3, 0x88, 0x6A, 0x97, 0x55, 0xB1, 0x5F, 0x56,
-    0xEB, 0x1F, 0x57, 0xF0, 0x9E, 0x3F, 0xA6, 0x3F, 0xEF, 0x80, 0x02, 0x20, 0x14, 0x82, 0xFF, 0x2B,
-    0x66, 0xF8, 0xC2, 0x15, 0xE2, 0x4A, 0x0D, 0x6A, 0xCB, 0x21, 0x88, 0x55, 0x96, 0x9B, 0x86, 0x88,
-    0x9A, 0x2B, 0x6A, 0xEF, 0x6B, 0x60, 0x86, 0xE5, 0xBC, 0x24, 0x92, 0x06, 0xDF, 0x52, 0x35, 0xFA,
-    0xB9, 0x5C, 0xC5, 0x23, 0x2D, 0xE6, 0x14, 0xD9, 0x3D, 0xCB, 0x3A, 0xA5, 0xA1, 0x52, 0x7C, 0xCA,
-    0x1A, 0xC1, 0xFE, 0xA0, 0x95, 0x96, 0xB4, 0x30, 0xC7, 0x08, 0xE9, 0x32, 0x28, 0xC6, 0xA1, 0xBA,
-    0x1A, 0x2C, 0x43, 0x37, 0x27, 0x13, 0x6D, 0xBC, 0x81, 0x28, 0xB9, 0xAA, 0xD0, 0xCA, 0x73, 0x34,
-    0x6B, 0xC0, 0xC1, 0x29, 0xCB, 0x89, 0xCB, 0x3C, 0xA6, 0xB0, 0xAA, 0x52, 0xF9, 0x3C, 0x5B, 0xCF,
-    0x7B, 0x40, 0xFE, 0x80, 0x48, 0xD1, 0x22, 0x06, 0x30, 0x9A, 0xFE, 0x33, 0x59, 0x5C, 0x42, 0x7E,
-    0x21, 0x3E, 0xB1, 0xE3, 0x37, 0xEA, 0x5E, 0x66, 0xD6, 0x83, 0x67, 0xB5, 0x54, 0x04, 0xBE, 0x23,
-    0xF6, 0x90, 0x45, 0xA0, 0x0C, 0xB1, 0xD5, 0xA0, 0x63, 0xC8, 0x0C, 0xB2, 0x0D, 0x06, 0x2E, 0xF8,
-    0x9D, 0x83, 0x54, 0x98, 0x0D, 0xEA, 0x1D, 0x90, 0x99, 0xD2, 0x10, 0xA5, 0x59, 0x46, 0xF2, 0xA0,
-    0x45, 0xAA, 0xE9, 0x2D, 0xD2, 0xE4, 0xB3, 0xD4, 0xDB, 0x48, 0xA1, 0xBB, 0xE6, 0x0E, 0x2B, 0xC6,
-    0xFC, 0x3B, 0x2D, 0xC6, 0xFC, 0x9F, 0x76, 0x57, 0x5F, 0xBF, 0x19, 0x95, 0xE3, 0x6C, 0xCD, 0x06,
-    0x75, 0x41, 0x2D, 0xA7, 0xD7, 0x19, 0x34, 0xE6, 0xCF, 0xED, 0x29, 0x36, 0xF2, 0x20, 0x8B, 0x8D,
-    0x7C, 0x7B, 0x2A, 0x36, 0xA2, 0x5C, 0x30, 0xCD, 0x26, 0xB5, 0x58, 0x43, 0x85, 0xD2, 0x55, 0xE3,
-    0xFC, 0xC2, 0xDC, 0xB1, 0x0E, 0xC1, 0xB8, 0xA6, 0x3F, 0x1B, 0xF9, 0xB0, 0xD6, 0x7D, 0x51, 0x68,
-    0x0D, 0xB0, 0x77, 0x22, 0xD4, 0xC1, 0xF5, 0xA3, 0x18, 0x50, 0x66, 0xF5, 0x15, 0xD5, 0x1A, 0x7D,
-    0xC7, 0xB3, 0x4E, 0x9C, 0x1F, 0xD3, 0x41, 0x6E, 0x4B, 0x3D, 0x94, 0xB4, 0x48, 0xF9, 0xED, 0x3B,
-    0x7E, 0x06, 0xA4, 0x58, 0xB9, 0x02, 0xCB, 0x95, 0xAA, 0xAA, 0xA8, 0xB5, 0x73, 0x0F, 0xA1, 0x91,
-    0x9F, 0xD5, 0x1A, 0x6A, 0x84, 0x24, 0xE1, 0x74, 0xB9, 0xF3, 0xBD, 0xB8, 0xFD, 0xAA, 0x4E, 0xF6,
-    0x9A, 0x36, 0x95, 0x67, 0x87, 0x8A, 0x3B, 0x1E, 0x76, 0xE6, 0x7A, 0xEE, 0xE8, 0xD7, 0xA7, 0xD0,
-    0xB0, 0xDB, 0xEC, 0xC5, 0xDD, 0x67, 0x7E, 0x17, 0xCA, 0x3C, 0x54, 0x89, 0x73, 0xF3, 0x0C, 0x66,
-    0x35, 0xA3, 0x54, 0xB6, 0x87, 0xD5, 0x5A, 0xD4, 0x97, 0xB6, 0xF8, 0x9F, 0x98, 0x3B, 0xA2, 0xEE,
-    0xAA, 0xE7, 0xBE, 0xD9, 0x46, 0x9D, 0xD4, 0x31, 0xB9, 0xE4, 0xE6, 0xC3, 0x98, 0x6E, 0x6F, 0x29,
-    0x8B, 0xC9, 0x73, 0x53, 0x4C, 0xC1, 0x4C, 0xFA, 0xB9, 0x92, 0x66, 0x05, 0x4B, 0xFC, 0xCF, 0x4F,
-    0x76, 0xD9, 0x7C, 0x3B, 0x96, 0xCD, 0x77, 0x0A, 0xED, 0xF8, 0x55, 0xB6, 0xD1, 0x26, 0x59, 0xF9,
-    0x2A, 0xC7, 0xB4, 0xE2, 0x31, 0x0C, 0x62, 0xAA, 0x8F, 0x3A, 0x9A, 0x12, 0x66, 0x77, 0xAC, 0x4B,
-    0x95, 0x52, 0x5D, 0x6C, 0x62, 0xC6, 0xAE, 0xB3, 0x69, 0x88, 0x63, 0xD1, 0xC2, 0x54, 0xDE, 0xEF,
-    0x96, 0xE6, 0xF4, 0x39, 0xE3, 0xBD, 0xDD, 0x99, 0xC7, 0x65, 0xB5, 0xEC, 0x4D, 0x8B, 0x15, 0x2B,
-    0x53, 0x79, 0xCB, 0xD4, 0xAF, 0xB1, 0x4A, 0x9E, 0xAE, 0xB0, 0x8A, 0xFE, 0x37, 0x57, 0x2C, 0x4D,
-    0xE5, 0x2D, 0x03, 0x84, 0x36, 0x89, 0xB4, 0xEB, 0xB9, 0x12, 0x72, 0xC2, 0x8A, 0xB5, 0xA9, 0x66,
-    0xFB, 0x18, 0xD9, 0xDD, 0x94, 0x19, 0xD3, 0x1D, 0x46, 0x69, 0x9C, 0x5A, 0xCE, 0xFA, 0xF1, 0x97,
-    0xEB, 0x60, 0x61, 0x58, 0xAD, 0x07, 0x53, 0x46, 0x63, 0x2E, 0x28, 0x3F, 0x79, 0xD5, 0xDF, 0x03,
-    0x3F, 0xBE, 0xB9, 0xF5, 0xFF, 0x69, 0xB5, 0x0F, 0x34, 0x2F, 0x76, 0x99, 0xC4, 0xE9, 0x93, 0x50,
-    0xB5, 0xC0, 0x85, 0x56, 0xB0, 0xD4, 0xE9, 0xA2, 0xCE, 0x45, 0xA6, 0x8C, 0x19, 0x73, 0xE6, 0x38,
-    0x53, 0xE2, 0xCE, 0xFD, 0x2E, 0x95, 0xB0, 0xD7, 0x47, 0x61, 0xD0, 0x31, 0xEC, 0x0D, 0x84, 0x09,
-    0xA8, 0x63, 0xD8, 0x69, 0x5D, 0xE2, 0xC0, 0xC6, 0xF9, 0x23, 0x25, 0x1C, 0x6E, 0x57, 0xB1, 0xCA,
-    0x47, 0xCD, 0x77, 0x19, 0xF6, 0x43, 0x91, 0xEE, 0xDB, 0xD9, 0xDA, 0x0A, 0x0E, 0x65, 0x73, 0xC3,
-    0xBF, 0x3B, 0x77, 0x28, 0xDC, 0x74, 0x40, 0xD6, 0x62, 0x17, 0x76, 0xBA, 0x08, 0x96, 0x7E, 0x7B,
-    0xFC, 0x7B, 0xDE, 0xC6, 0xBA, 0xA1, 0xD3, 0x47, 0x45, 0x4B, 0xFD, 0x9E, 0xA4, 0xFB, 0xC0, 0xA4,
-    0x9A, 0xD9, 0xF3, 0x39, 0xED, 0x80, 0xDF, 0xB5, 0x1A, 0xDE, 0x14, 0xFF, 0xA8, 0xD6, 0xD9, 0x8B,
-    0x1A, 0x6E, 0x80, 0x08, 0xC2, 0x9F, 0x48, 0x07, 0x7C, 0x11, 0x5D, 0xEB, 0xEA, 0x48, 0xCC, 0x96,
-    0x71, 0xED, 0x1C, 0x04, 0x6E, 0x90, 0x7A, 0x55, 0x84, 0x84, 0x8B, 0x06, 0x03, 0xBF, 0xFD, 0x9B,
-    0x6A, 0x89, 0x4F, 0x74, 0x79, 0x4E, 0x31, 0x15, 0x55, 0xEE, 0x92, 0x52, 0x61, 0x1F, 0x13, 0x8C,
-    0x1F, 0x35, 0x4D, 0xE7, 0x73, 0x06, 0xEE, 0x79, 0x4C, 0xF2, 0x31, 0xFF, 0x00, 0xB4, 0x8C, 0x07,
-    0x3D, 0xCE, 0x12, 0xD4, 0xB5, 0x34, 0xCA, 0xD7, 0x0F, 0x4C, 0x0A, 0xC7, 0x2E, 0x78, 0xC9, 0xE5,
-    0xD9, 0x90, 0xA9, 0x4E, 0xA0, 0x89, 0xD6, 0xD6, 0xBE, 0x46, 0xD0, 0xDE, 0xAE, 0x65, 0x9F, 0xCC,
-    0x50, 0x48, 0x05, 0xDA, 0x11, 0xEC, 0x31, 0x60, 0x2C, 0xFF, 0x67, 0x28, 0x1B, 0x54, 0x61, 0x69,
-    0x66, 0x03, 0xD8, 0x03, 0xAC, 0x0E, 0x86, 0xCC, 0x87, 0xCD, 0x3D, 0x46, 0x23, 0x71, 0xD1, 0xCF,
-    0xCC, 0x70, 0xCD, 0xDF, 0x42, 0x93, 0x77, 0x38, 0xAC, 0xC8, 0x30, 0x7D, 0x1E, 0xA8, 0xF7, 0xAE,
-    0xD5, 0x12, 0x0A, 0xA9, 0x7E, 0xA0, 0x80, 0x9A, 0xCF, 0x30, 0x05, 0x4C, 0xC1, 0x43, 0x26, 0xDA,
-    0x00, 0xEA, 0x4A, 0x7C, 0xD3, 0xFE, 0x57, 0xF9, 0xCD, 0x5E, 0x93, 0xA2, 0x32, 0x12, 0x34, 0x08,
-    0x14, 0x61, 0x58, 0x9A, 0xCF, 0x6E, 0x29, 0x0E, 0xF6, 0x39, 0xC8, 0xE0, 0x10, 0x25, 0x71, 0xB4,
-    0x4C, 0x50, 0x48, 0xFD, 0x55, 0x61, 0xFD, 0x5C, 0xCB, 0xFB, 0x67, 0x47, 0xF2, 0x04, 0x65, 0xE8,
-    0x18, 0x06, 0xF0, 0x34, 0x93, 0x41, 0x90, 0xD6, 0xC3, 0xF2, 0xBB, 0x9E, 0x7E, 0xC1, 0x8B, 0x1F,
-    0xF3, 0xA2, 0xDD, 0xB1, 0x71, 0xC3, 0xEA, 0xCA, 0xEE, 0x0B, 0x5E, 0xCB, 0x31, 0xEF, 0xE8, 0x46,
-    0x95, 0x98, 0x3D, 0x5A, 0xB5, 0xF7, 0xD1, 0xBD, 0xC7, 0xE8, 0x23, 0xCE, 0x9F, 0x68, 0xB1, 0x33,
-    0x55, 0x2E, 0xBD, 0xA2, 0x9F, 0x50, 0x7B, 0xCE, 0x7C, 0x09, 0x66, 0x1C, 0x86, 0x26, 0x67, 0x29,
-    0x13, 0xCF, 0xFE, 0x77, 0x66, 0x5F, 0xC9, 0x3D, 0xFE, 0xDD, 0xED, 0x2B, 0xD5, 0x32, 0xA3, 0x27,
-    0x3B, 0xD7, 0x74, 0x56, 0x86, 0x41, 0xC3, 0xA9, 0xCB, 0xBC, 0x67, 0xAB, 0xA1, 0xCE, 0xD5, 0x57,
-    0xC7, 0x50, 0x11, 0x67, 0x81, 0x6B, 0xB5, 0x66, 0x0D, 0x88, 0x72, 0x29, 0xFE, 0x6E, 0x09, 0x27,
-    0xDF, 0xD9, 0xEE, 0x50, 0x95, 0x56, 0x02, 0x8C, 0x68, 0x49, 0x80, 0x2A, 0x87, 0xA2, 0xE2, 0xD1,
-    0x8A, 0x6D, 0xF4, 0xE3, 0x26, 0x88, 0xAE, 0x4A, 0x51, 0xDC, 0x1E, 0xD5, 0x90, 0xA1, 0xA7, 0x08,
-    0x4D, 0x3F, 0xBB, 0xD3, 0xB9, 0xFA, 0x51, 0xCE, 0xFD, 0xB1, 0xCA, 0xF8, 0x15, 0x6E, 0x41, 0x1D,
-    0xC0, 0xB3, 0xBF, 0xB2, 0x55, 0x9A, 0x05, 0x83, 0xD8, 0x74, 0x6A, 0x72, 0x4F, 0x6F, 0x5A, 0x39,
-    0xB3, 0x08, 0x39, 0x2D, 0x53, 0x9F, 0x5C, 0x40, 0x4A, 0x40, 0x72, 0x65, 0x89, 0x60, 0x52, 0xD1,
-    0x7B, 0xE1, 0x8B, 0xA9, 0xE3, 0x65, 0xA0, 0x19, 0x50, 0x5A, 0x20, 0x14, 0x74, 0x75, 0x22, 0x43,
-    0x42, 0x6A, 0xBA, 0xA0, 0x93, 0x96, 0x1F, 0x8F, 0xD6, 0x65, 0x5C, 0x44, 0xD5, 0x71, 0xDC, 0xE7,
-    0x4E, 0xEA, 0xBA, 0x52, 0x88, 0x2C, 0xC2, 0x17, 0x72, 0x6C, 0x21, 0x96, 0x73, 0x13, 0x1E, 0x57,
-    0x7A, 0xE1, 0x43, 0xEE, 0xDE, 0xB1, 0x83, 0x09, 0xB6, 0xFA, 0xCE, 0xAB, 0x98, 0xB3, 0x87, 0x99,
-    0xCA, 0x31, 0x1E, 0x3A, 0xFC, 0xC1, 0xEA, 0xE3, 0xFF, 0xFE, 0xFE, 0x1B, 0x78, 0x66, 0x2D, 0x05,
-    0x60, 0x1C, 0x61, 0xAD, 0xB3, 0xAE, 0xFD, 0x18, 0xE9, 0xE7, 0x90, 0xB4, 0x3E, 0xD9, 0x7B, 0xFD,
-    0xDD, 0x09, 0x65, 0x8B, 0xBF, 0x6B, 0xBE, 0x0C, 0x1D, 0x02, 0x1D, 0xE3, 0x01, 0xB4, 0x84, 0x41,
-    0xD9, 0x8F, 0x9F, 0x4D, 0x3D, 0x54, 0x05, 0xED, 0x63, 0xF3, 0x51, 0x40, 0x45, 0x8F, 0xA3, 0x3A,
-    0x69, 0xF4, 0x3F, 0x56, 0x39, 0x3B, 0xFA, 0xF7, 0x21, 0x94, 0x62, 0x86, 0xAE, 0xB2, 0xC5, 0x40,
-    0x0B, 0x2E, 0x92, 0x83, 0xF9, 0x5E, 0x8B, 0xB4, 0x81, 0x3A, 0x11, 0xDB, 0xAA, 0x48, 0x20, 0x36,
-    0xFF, 0x50, 0x27, 0xB4, 0x56, 0xE3, 0xAA, 0x9C, 0x14, 0xF3, 0xED, 0xAE, 0xFB, 0x98, 0xBD, 0xCF,
-    0x59, 0xEB, 0xB1, 0x0F, 0xE8, 0xE7, 0x21, 0x31, 0x69, 0xF9, 0x99, 0xB5, 0xC5, 0x17, 0xC1, 0xCB,
-    0x98, 0x0F, 0x81, 0x4A, 0x50, 0x75, 0x89, 0xEA, 0xF4, 0x09, 0xFA, 0x3E, 0xA0, 0x2A, 0x78, 0xCF,
-    0x8B, 0xAA, 0x37, 0xDD, 0x3F, 0x36, 0xE5, 0xA7, 0xFB, 0x72, 0x7D, 0x02, 0x38, 0xB5, 0x96, 0x86,
-    0x7C, 0x41, 0x53, 0x53, 0x3B, 0xF7, 0x74, 0xD0, 0x69, 0xD8, 0x38, 0x2F, 0x0B, 0xDE, 0x78, 0x86,
-    0x81, 0xF0, 0x76, 0xA8, 0x1F, 0x2C, 0x9D, 0x1E, 0xCB, 0xAB, 0xD3, 0xD1, 0x68, 0x4F, 0x16, 0x8E,
-    0x1F, 0xA5, 0x2F, 0x57, 0xE0, 0x92, 0xD2, 0x62, 0x7F, 0xB8, 0xBF, 0x5C, 0x38, 0x11, 0x27, 0x6D,
-    0x7E, 0xEC, 0xBC, 0x73, 0x89, 0x14, 0x66, 0x2C, 0x9A, 0x41, 0x96, 0x9D, 0xA9, 0x5E, 0xB0, 0x75,
-    0xA3, 0x19, 0xF1, 0x09, 0xFA, 0x82, 0xE1, 0xE4, 0x2F, 0x73, 0x4A, 0xBA, 0x2E, 0xEB, 0x1B, 0x32,
-    0x83, 0x8F, 0xAE, 0x34, 0xF6, 0x3D, 0xF2, 0x1F, 0x9D, 0x70, 0xEE, 0x5B, 0x63, 0x15, 0xE3, 0xCE,
-    0xA3, 0x4E, 0x25, 0x65, 0x9A, 0x25, 0xD9, 0x8D, 0xDB, 0xFC, 0x09, 0xFA, 0xFC, 0xA6, 0xC3, 0x05,
-    0x43, 0x7E, 0xD5, 0x0B, 0x13, 0x2F, 0xE6, 0x32, 0x3A, 0x5E, 0x6A, 0x7F, 0xD4, 0x83, 0xF6, 0x5D,
-    0x94, 0xA0, 0x18, 0xC7, 0x2C, 0x6D, 0x98, 0xD8, 0x54, 0x56, 0xB9, 0x56, 0xC9, 0xBB, 0x74, 0xA3,
-    0xF6, 0xDE, 0xC1, 0x1F, 0x0C, 0x1C, 0x3F, 0xC5, 0x83, 0x91, 0xC4, 0x2D, 0x54, 0xE2, 0x96, 0x47,
-    0x0A, 0xDA, 0xAD, 0xB1, 0x92, 0xDB, 0x5A, 0x00, 0xFC, 0xEF, 0xEB, 0xFA, 0xBC, 0xCF, 0xBA, 0x3E,
-    0x1F, 0x08, 0x05, 0xDF, 0x89, 0xDD, 0x7C, 0xCB, 0x14, 0xFC, 0x61, 0x0D, 0xC8, 0x97, 0x44, 0xD3,
-    0x43, 0xD6, 0x29, 0x3C, 0x5D, 0xE4, 0x7C, 0xF9, 0x02, 0x36, 0xD4, 0x65, 0xA6, 0x8C, 0x5E, 0x8F,
-    0x75, 0x7D, 0xCC, 0x3F, 0x4D, 0xE4, 0x00, 0xAD, 0x8E, 0x1A, 0xAB, 0x90, 0xD5, 0x02, 0x1A, 0xA1,
-    0x39, 0x46, 0x6D, 0x3D, 0xB6, 0x78, 0x6F, 0xF8, 0x3E, 0x8B, 0xF7, 0x3E, 0x78, 0x4C, 0xF1, 0x5E,
-    0x07, 0xAB, 0x95, 0xBA, 0x72, 0x3A, 0xBA, 0xFB, 0x44, 0xE3, 0xB1, 0xA2, 0xE4, 0x93, 0xF0, 0x09,
-    0x4A, 0x33, 0xBD, 0xB2, 0x3F, 0xD6, 0xF8, 0x5D, 0xBC, 0x8B, 0xF0, 0xBC, 0x33, 0x4A, 0xEB, 0x7F,
-    0x59, 0xEB, 0x2C, 0xDA, 0x4C, 0xB5, 0xF3, 0x42, 0x71, 0x48, 0xEE, 0xDD, 0x68, 0x7A, 0x7C, 0xB2,
-    0x06, 0x74, 0xD0, 0xEA, 0x6A, 0x30, 0xC6, 0xC4, 0xA2, 0x43, 0x9A, 0x44, 0x91, 0xDE, 0xD0, 0xBC,
-    0xBD, 0x43, 0xAA, 0x33, 0x1A, 0x20, 0xB6, 0x33, 0x8D, 0x26, 0xA3, 0x5F, 0xCF, 0x66, 0x98, 0xF9,
-    0x00, 0xFA, 0x41, 0x06, 0x1D, 0xD3, 0x99, 0xF3, 0x3A, 0x51, 0xB8, 0x94, 0x46, 0xFE, 0x9F, 0x9B,
-    0x6F, 0x7C, 0x32, 0x07, 0xF9, 0x6E, 0x53, 0x10, 0x5E, 0x58, 0xB8, 0x22, 0xA4, 0xA2, 0x82, 0x0F,
-    0x63, 0xE1, 0x87, 0xA8, 0x46, 0xDF, 0x9E, 0xC3, 0xC8, 0xCC, 0x6A, 0xC2, 0x0F, 0xFA, 0xA5, 0x89,
-    0xF5, 0x82, 0x66, 0x1E, 0xA2, 0xEE, 0x9A, 0x08, 0xB0, 0x76, 0x76, 0xCA, 0x16, 0x28, 0xA9, 0x80,
-    0x32, 0xEE, 0xF2, 0x6A, 0x1E, 0xBD, 0x10, 0xC8, 0x61, 0xE7, 0x47, 0x0D, 0x92, 0xC2, 0xE5, 0xD0,
-    0x6B, 0xE8, 0x9A, 0x90, 0x11, 0x7A, 0x0A, 0xBD, 0xE3, 0x75, 0x88, 0x6C, 0xD1, 0x44, 0xF4, 0xE0,
-    0xD7, 0xCC, 0xAC, 0xF9, 0x19, 0x5A, 0x9C, 0x70, 0xEE, 0x2A, 0x5A, 0xC5, 0x09, 0xE7, 0xAD, 0x45,
-    0x65, 0xB3, 0xB3, 0x66, 0xED, 0x58, 0x1B, 0xE5, 0x0B, 0x34, 0x4A, 0x87, 0x92, 0x59, 0x33, 0xFD,
-    0x94, 0x3F, 0x12, 0x5E, 0x1D, 0xD1, 0x2B, 0xD6, 0x9F, 0xAC, 0xA0, 0x9A, 0x3A, 0xDC, 0x4B, 0x45,
-    0xDC, 0xAC, 0xF5, 0x8E, 0xF7, 0x74, 0xDC, 0x69, 0x1F, 0x33, 0x35, 0x2B, 0x3F, 0x8E, 0xAA, 0x52,
-    0x74, 0xE4, 0xA0, 0xF8, 0x58, 0x71, 0x23, 0x7B, 0xFB, 0x0C, 0xED, 0x97, 0x45, 0x69, 0x7F, 0xC9,
-    0x98, 0x7A, 0xFD, 0x30, 0xF5, 0x9A, 0x33, 0x9D, 0x9B, 0x5A, 0xE3, 0x52, 0xCC, 0xFE, 0x34, 0xD3,
-    0x54, 0x28, 0x8D, 0xA8, 0x4F, 0xD4, 0xF3, 0x74, 0x90, 0x1F, 0xE7, 0x4C, 0xD7, 0x4D, 0x7C, 0x4B,
-    0xC5, 0x24, 0xEA, 0x11, 0xC7, 0xB7, 0x46, 0x7F, 0xFF, 0xAA, 0x57, 0x1F, 0x58, 0x9D, 0xAF, 0x6C,
-    0x54, 0x40, 0x18, 0xEA, 0x96, 0x4F, 0xDC, 0x23, 0x9D, 0xE2, 0xAA, 0xBE, 0xA6, 0xCC, 0xE1, 0xC3,
-    0x2A, 0x23, 0x3E, 0xA2, 0x2E, 0xC1, 0x98, 0x4A, 0x79, 0x9F, 0x73, 0x34, 0xB3, 0xC6, 0xB9, 0x79,
-    0xCE, 0x9C, 0x77, 0x3E, 0x76, 0xCD, 0x82, 0x0E, 0x47, 0x88, 0x56, 0x89, 0xF5, 0x5D, 0xC8, 0x75,
-    0xCD, 0x2A, 0xFF, 0xBB, 0xF3, 0xF9, 0xCE, 0xE9, 0x0F, 0x05, 0xF8, 0x15, 0x81, 0xED, 0x14, 0x90,
-    0xB5, 0x6B, 0xF8, 0xEC, 0xBB, 0xFC, 0x6D, 0x28, 0x88, 0xF1, 0x2D, 0x75, 0x35, 0xBD, 0xAD, 0x9F,
-    0x07, 0xBC, 0xFA, 0xEE, 0x9F, 0xAE, 0x18, 0x4F, 0xEE, 0xED, 0xF3, 0x24, 0xC6, 0x16, 0xD1, 0xF8,
-    0x17, 0xAC, 0x9E, 0x04, 0x1C, 0x8D, 0x2C, 0xEB, 0x56, 0x7F, 0x59, 0xEA, 0x2F, 0x93, 0x62, 0xFD,
-    0xBB, 0x16, 0x44, 0x1A, 0x92, 0x5F, 0xEC, 0xB4, 0xC1, 0xB0, 0x05, 0x35, 0x38, 0x62, 0xF9, 0xDE,
-    0xDA, 0x5F, 0x7D, 0x8A, 0xF6, 0xFA, 0xD9, 0xB2, 0x77, 0x9B, 0x6A, 0xC4, 0x3D, 0xEF, 0x62, 0x74,
-    0x72, 0x4D, 0x99, 0x9D, 0x1D, 0x5E, 0x30, 0x93, 0xF0, 0x6C, 0xA3, 0xF0, 0x0D, 0xC3, 0x4E, 0x89,
-    0x88, 0x7F, 0x50, 0xB5, 0xE4, 0x4C, 0xF9, 0x97, 0xEB, 0xB3, 0x05, 0x22, 0x87, 0xA5, 0x83, 0x96,
-    0x9A, 0x06, 0x75, 0xBA, 0xD4, 0x04, 0xCB, 0x31, 0x00, 0xDE, 0xA5, 0x1C, 0x96, 0x4C, 0x7F, 0xF8,
-    0x89, 0x45, 0x41, 0x9E, 0xC1, 0x30, 0x88, 0x20, 0x1B, 0x33, 0x0E, 0xD3, 0x5A, 0xAB, 0x73, 0x2E,
-    0xD4, 0x05, 0x5E, 0x91, 0x4E, 0x34, 0xE1, 0xD0, 0xB3, 0xDF, 0xD6, 0x6C, 0xEC, 0x72, 0xCD, 0x3D,
-    0xEF, 0xF2, 0x0D, 0x5D, 0x41, 0x93, 0xDC, 0x95, 0xD3, 0xD6, 0xB2, 0x71, 0x3F, 0x6C, 0xE9, 0xF1,
-    0xD5, 0xC8, 0xE8, 0x85, 0xD3, 0x0E, 0x30, 0x2F, 0x5D, 0xB6, 0x61, 0xCE, 0x10, 0x40, 0x30, 0x60,
-    0x2D, 0x25, 0x24, 0xCD, 0x44, 0xB2, 0x21, 0xCC, 0x10, 0xD4, 0xB3, 0x43, 0x36, 0x75, 0x31, 0x56,
-    0x35, 0x70, 0xCE, 0xE8, 0x43, 0xC9, 0x4F, 0x0E, 0x6C, 0xA2, 0xAD, 0xBA, 0xA9, 0x59, 0x27, 0xB1,
-    0x56, 0x3C, 0x40, 0x89, 0x2C, 0xAA, 0xCC, 0xFF, 0xDA, 0xE2, 0x66, 0x09, 0x80, 0x67, 0x98, 0xA0,
-    0x71, 0xA5, 0x99, 0x86, 0x33, 0x26, 0x7A, 0x86, 0x54, 0x87, 0x53, 0x2A, 0xC2, 0xB4, 0xED, 0x74,
-    0x1A, 0xB0, 0xA1, 0x9A, 0x62, 0xCE, 0x3C, 0xC3, 0x94, 0xD9, 0x75, 0x0B, 0x44, 0x0A, 0x33, 0x82,
-    0x9D, 0x69, 0x86, 0x60, 0xF0, 0x0B, 0x68, 0x4A, 0x16, 0x68, 0xB4, 0x7A, 0x56, 0xB4, 0xE0, 0x7D,
-    0xBF, 0x8A, 0xBD, 0xEF, 0x27, 0x2D, 0x9A, 0x70, 0xCE, 0x59, 0x3B, 0xC9, 0xD9, 0x74, 0xF7, 0xD6,
-    0xF3, 0x3F, 0x53, 0xCD, 0xFF, 0x8C, 0xD7, 0xF3, 0x3F, 0xBF, 0x72, 0xC1, 0x22, 0x79, 0x36, 0x55,
-    0x4F, 0x90, 0x5B, 0xC9, 0xB9, 0xFA, 0x7D, 0xE7, 0x7F, 0xB6, 0xEF, 0xF1, 0xE1, 0xF6, 0x9B, 0xCF,
-    0xE3, 0x44, 0x93, 0x07, 0x50, 0xF0, 0x43, 0xF6, 0xF5, 0x2D, 0x17, 0x5A, 0x7F, 0x72, 0xC7, 0x22,
-    0xC2, 0xA9, 0xD7, 0x3C, 0xCE, 0x6E, 0xCC, 0xE3, 0x0C, 0x6B, 0xFF, 0x86, 0x5F, 0x91, 0xFA, 0xFF,
-    0xC5, 0x57, 0xBF, 0x6F, 0xE5, 0xC6, 0x11, 0x9E, 0xE5, 0xEA, 0x44, 0x24, 0x04, 0xB4, 0x2A, 0x2C,
-    0xC0, 0x0E, 0xEE, 0xCC, 0xC2, 0x8D, 0x0B, 0xC9, 0x6C, 0xAE, 0x70, 0x21, 0x69, 0x89, 0xDC, 0x1F,
-    0x10, 0x15, 0x67, 0x04, 0x41, 0x5A, 0xC7, 0x40, 0x0E, 0x70, 0x77, 0x85, 0x80, 0xDC, 0x89, 0x8C,
-    0xDD, 0xB8, 0xB3, 0x02, 0xC4, 0xFD, 0x15, 0x2E, 0x1C, 0xA5, 0x88, 0x8A, 0x2B, 0x02, 0x44, 0x7A,
-    0x5C, 0xF8, 0x80, 0xA4, 0x65, 0xF2, 0x17, 0x30, 0x40, 0x8C, 0x00, 0x31, 0x82, 0xDB, 0x82, 0x80,
-    0x19, 0x63, 0xC9, 0xC9, 0x37, 0xCB, 0xF7, 0x74, 0x4F, 0x89, 0x0B, 0xDB, 0x38, 0x9F, 0x57, 0x9A,
-    0x25, 0xB9, 0x3B, 0x3F, 0x77, 0x67, 0xBE, 0xDD, 0xF7, 0xFB, 0x3F, 0x5D, 0x6B, 0xB4, 0xBD, 0x71,
-    0xFF, 0xD6, 0xC1, 0xB1, 0xE9, 0xD2, 0x36, 0xEF, 0x7F, 0xF5, 0xEF, 0xD7, 0x3E, 0xD0, 0xF5, 0x37,
-    0xFD, 0x23, 0xA2, 0x1B, 0xA0, 0x63, 0x22, 0xD5, 0x11, 0xA5, 0x8E, 0xC8, 0x24, 0x67, 0x67, 0xC1,
-    0x32, 0x3F, 0x29, 0xC9, 0xDF, 0xA6, 0x37, 0x75, 0xF9, 0x2A, 0xDD, 0x4E, 0x6B, 0x5D, 0x1E, 0xD1,
-    0x6D, 0x22, 0x5D, 0xD2, 0xF3, 0x7B, 0x28, 0x9A, 0xAD, 0x27, 0x2D, 0xD1, 0x63, 0xA2, 0x03, 0xD8,
-    0xC6, 0xDC, 0x97, 0x67, 0x9F, 0xC0, 0xBA, 0x3B, 0xA7, 0x9B, 0x49, 0xAB, 0x5C, 0x56, 0xDE, 0xA4,
-    0x3D, 0xE5, 0xE8, 0xE8, 0x26, 0xF8, 0xE1, 0xDD, 0x73, 0x7D, 0x6C, 0xEC, 0xBC, 0x55, 0x56, 0x3C,
-    0xE1, 0xDF, 0xF2, 0xB8, 0xFE, 0x2E, 0x8E, 0x19, 0x66, 0x9E, 0x40, 0xFC, 0xD9, 0x5B, 0x68, 0x32,
-    0xA2, 0x79, 0xD5, 0xFE, 0x75, 0x86, 0x46, 0xAB, 0x66, 0xF8, 0xFF, 0xDA, 0x97, 0x67, 0xAB, 0xF6,
-    0xF5, 0xB8, 0x76, 0x68, 0xC7, 0xB4, 0xF9, 0x93, 0x3E, 0xF5, 0xA3, 0x0A, 0xB6, 0xAC, 0x5E, 0xE0,
-    0xC7, 0xA7, 0x8F, 0x92, 0x47, 0x5F, 0x2F, 0x3A, 0x59, 0x87, 0xBB, 0xB2, 0x5D, 0x85, 0x1A, 0x8C,
-    0xAB, 0xF4, 0x60, 0x3A, 0xEB, 0x58, 0xB3, 0x1E, 0x84, 0xAF, 0xD2, 0x9C, 0x06, 0xE3, 0x0B, 0xD7,
-    0xE8, 0xDE, 0xB8, 0x4B, 0xED, 0x0B, 0x0C, 0x6E, 0x96, 0xFC, 0x63, 0xD6, 0x21, 0xC3, 0xF0, 0x42,
-    0xFB, 0xBC, 0x0E, 0x69, 0xFB, 0x0A, 0x86, 0xED, 0x1D, 0x36, 0xBD, 0x75, 0x93, 0x1E, 0x52, 0x6F,
-    0x5C, 0x5E, 0x5B, 0x3A, 0x9C, 0x8D, 0x25, 0xAD, 0x76, 0x05, 0x59, 0x35, 0x24, 0x32, 0xEE, 0x2A,
-    0xBA, 0xD4, 0x03, 0xD4, 0x75, 0xB9, 0xB3, 0xAE, 0x29, 0x39, 0x81, 0xB5, 0x74, 0xD4, 0x43, 0xD6,
-    0x2F, 0x9D, 0x53, 0x21, 0x19, 0xAC, 0xAF, 0xFE, 0xCA, 0xC9, 0x64, 0xBC, 0xF1, 0x0D, 0x4D, 0x99,
-    0x37, 0xED, 0x48, 0xC1, 0xB8, 0xE2, 0xBD, 0x5E, 0x7B, 0x4B, 0x0F, 0x33, 0x67, 0x4A, 0x8A, 0xAE,
-    0x6C, 0xEA, 0x31, 0x0D, 0x85, 0xB7, 0x1D, 0x2B, 0x06, 0x5B, 0x27, 0xDC, 0x9D, 0x71, 0x41, 0x05,
-    0x78, 0x70, 0xC7, 0xEB, 0xEE, 0x21, 0x85, 0xCD, 0xF2, 0x87, 0x51, 0xB1, 0x2D, 0x4F, 0x10, 0xD8,
-    0x64, 0x7A, 0xF0, 0xC3, 0xF2, 0xA4, 0x82, 0x38, 0x02, 0x6F, 0x5B, 0xF1, 0x57, 0x3C, 0x16, 0x9F,
-    0x0F, 0xE9, 0x41, 0xE4, 0xDE, 0xFC, 0x07, 0x5C, 0x9F, 0x64, 0x11, 0x60, 0x2A, 0x47, 0x3A, 0xA7,
-    0x1E, 0x1F, 0x41, 0xF4, 0x90, 0x9A, 0x7E, 0xF2, 0xE7, 0xB1, 0xC1, 0xF2, 0xFD, 0x01, 0xF4, 0xCF,
-    0x53, 0xAB, 0x1E, 0x93, 0x41, 0xEE, 0xE9, 0x67, 0x1C, 0xF4, 0xD5, 0x03, 0x29, 0x82, 0x54, 0xE3,
-    0x9A, 0x52, 0x2A, 0xBF, 0xBD, 0xA9, 0x6B, 0x8A, 0x44, 0x33, 0x44, 0x36, 0x4B, 0x4B, 0xEF, 0xF0,
-    0xD3, 0xA7, 0x53, 0x14, 0xF9, 0xCF, 0xD8, 0xFC, 0x1D, 0x3A, 0xB6, 0x67, 0xDB, 0xEB, 0x22, 0x45,
-    0xB7, 0x14, 0x39, 0xD2, 0x7C, 0x87, 0x3D, 0x8F, 0x96, 0x3F, 0xE4, 0xBF, 0xB1, 0x97, 0x71, 0xDA,
-    0x98, 0xE7, 0xAA, 0x8E, 0x52, 0xEE, 0xA8, 0xE2, 0x2E, 0x65, 0xEE, 0x2A, 0xE6, 0xBF, 0x30, 0x87,
-    0x8A, 0xC7, 0x14, 0xC5, 0x54, 0x8D, 0x94, 0x8E, 0xB1, 0xBE, 0xE3, 0x5A, 0xDD, 0x99, 0xAA, 0x2F,
-    0xD8, 0xB6, 0x47, 0x3F, 0x22, 0xF5, 0x1B, 0x26, 0xFB, 0x74, 0x54, 0xCC, 0x7D, 0xCA, 0x8D, 0x33,
-    0xFD, 0x5D, 0xC0, 0xC1, 0x66, 0x49, 0xEA, 0x94, 0xD4, 0x23, 0xDB, 0x91, 0xE9, 0x29, 0x0B, 0x95,
-    0xA7, 0x62, 0x20, 0x33, 0xAE, 0x9E, 0xB6, 0xA5, 0xDC, 0x63, 0x1C, 0xC0, 0xA1, 0xC0, 0x7A, 0x94,
-    0x3F, 0x81, 0xBE, 0xA9, 0xA8, 0xBF, 0x02, 0xC8, 0xEA, 0x7B, 0x61, 0x3F, 0xFD, 0xFE, 0x80, 0xEC,
-    0xF4, 0x75, 0x3B, 0xEA, 0x17, 0x03, 0x64, 0xF4, 0x3A, 0xD1, 0x82, 0x12, 0xAE, 0xB3, 0x77, 0xBB,
-    0xBD, 0xDD, 0xE3, 0xFB, 0xBB, 0xB7, 0x8E, 0x76, 0x6F, 0xD0, 0x2E, 0x3D, 0xE7, 0x7F, 0xB4, 0xED,
-    0x6D, 0xA2, 0xFD, 0x3D, 0x44, 0x98, 0x95, 0xA4, 0x3F, 0x45, 0xC0, 0xFD, 0xE3, 0x7B, 0x67, 0x61,
-    0xAF, 0xE1, 0xB0, 0x77, 0x4E, 0xFE, 0xF1, 0x39, 0xC6, 0xCE, 0x31, 0x77, 0x0E, 0x9E, 0x73, 0xF0,
-    0x9E, 0x43, 0xE4, 0xBB, 0xA2, 0xD8, 0x36, 0x90, 0x80, 0xC7, 0xFB, 0xD8, 0x74, 0x4F, 0xE9, 0xFB,
-    0x8E, 0x5E, 0xC5, 0xCA, 0x1F, 0xDB, 0xB3, 0xDF, 0x1D, 0x5B, 0x9E, 0xF0, 0xBE, 0x85, 0xB1, 0x2D,
-    0xCC, 0x6D, 0x81, 0x67, 0x0B, 0xBC, 0x5B, 0x90, 0xF8, 0x2E, 0x69, 0x89, 0x4A, 0xAB, 0xA7, 0x14,
-    0x6C, 0xBF, 0x82, 0x51, 0x7C, 0x5C, 0xCE, 0xEF, 0x39, 0x03, 0x31, 0x4F, 0x96, 0xE3, 0x6D, 0x33,
-    0x97, 0x3C, 0x5A, 0xD6, 0x66, 0x1D, 0xE5, 0x75, 0x7C, 0x47, 0xD1, 0x86, 0x58, 0x8A, 0xA2, 0x67,
-    0x00, 0x47, 0xD6, 0xCE, 0x4C, 0x0B, 0x88, 0xE8, 0x6E, 0x7E, 0x2F, 0x4A, 0xDD, 0x27, 0x7E, 0x25,
-    0x4C, 0xE3, 0xCA, 0x58, 0x22, 0x02, 0x17, 0x74, 0x25, 0xE0, 0x1E, 0xD0, 0x3D, 0x98, 0xFF, 0x25,
-    0xE5, 0x2E, 0xEB, 0x0E, 0x15, 0x07, 0xA4, 0x4A, 0x0F, 0x40, 0xF3, 0x39, 0x6A, 0xCF, 0x01, 0xF9,
-    0xCB, 0xEA, 0xF3, 0xDE, 0x94, 0x40, 0xD6, 0x64, 0xC8, 0x7C, 0xCA, 0x7D, 0xE6, 0x2E, 0xA9, 0x82,
-    0x03, 0x13, 0x8A, 0x3F, 0x6D, 0x2D, 0x4C, 0x2E, 0x20, 0x0B, 0xAF, 0x80, 0xC4, 0x49, 0x6F, 0xCB,
-    0x08, 0x29, 0x3E, 0xED, 0x68, 0x01, 0x17, 0x05, 0x7C, 0x20, 0x48, 0xC5, 0xFB, 0x3E, 0x46, 0x72,
-    0x01, 0x93, 0x59, 0x3B, 0x7B, 0xFF, 0x10, 0x62, 0x1A, 0x02, 0x02, 0x28, 0x56, 0x60, 0x25, 0x98,
-    0x16, 0xAC, 0xF0, 0x1C, 0xDE, 0x9E, 0xA8, 0x20, 0xC2, 0xE0, 0x2B, 0x00, 0xF5, 0xB6, 0x5E, 0xC4,
-    0x77, 0x71, 0x07, 0x20, 0x82, 0x22, 0x46, 0x94, 0x05, 0x96, 0xAD, 0x02, 0xDC, 0xC5, 0x28, 0x7F,
-    0x01, 0xA3, 0x1F, 0xE3, 0xF9, 0x12, 0xAD, 0xB7, 0x3F, 0xD2, 0xA4, 0x26, 0x1D, 0xD2, 0x01, 0x27,
-    0x40, 0x57, 0x38, 0x40, 0x3E, 0xBD, 0xF9, 0x6C, 0xCE, 0xD3, 0x94, 0x04, 0x99, 0x17, 0x8E, 0xC8,
-    0xE3, 0xF3, 0x4E, 0x0E, 0x2E, 0x70, 0x02, 0xFF, 0x16, 0xE0, 0x0E, 0xE0, 0x3F, 0x5F, 0x53, 0x98,
-    0x74, 0xDA, 0x99, 0x3A, 0xEA, 0x2A, 0xAB, 0x9A, 0x93, 0x71, 0x56, 0x9E, 0x43, 0xA8, 0xA9, 0x39,
-    0xEA, 0x92, 0xCF, 0x56, 0xE6, 0x27, 0xC2, 0x09, 0x94, 0xFA, 0x14, 0xC7, 0x42, 0x51, 0x6E, 0xA1,
-    0x46, 0xEE, 0x5F, 0xA9, 0x79, 0x83, 0x1A, 0x6A, 0x4A, 0xEB, 0x6C, 0x6B, 0xBA, 0xCC, 0xE3, 0x90,
-    0x0C, 0xB0, 0xB5, 0xBB, 0x9A, 0xCB, 0x31, 0x5B, 0x95, 0x0D, 0x0C, 0x80, 0x03, 0x3C, 0xE2, 0x94,
-    0xF1, 0x58, 0x7C, 0xEC, 0x4B, 0x22, 0xCB, 0x32, 0x82, 0xFB, 0x10, 0xFC, 0xB7, 0x68, 0x4D, 0x63,
-    0xBE, 0x94, 0xB3, 0xF5, 0x95, 0xA4, 0x2B, 0xDA, 0x28, 0xED, 0xA3, 0x7C, 0x1F, 0x35, 0x04, 0xD1,
-    0xA1, 0x66, 0x2D, 0x8B, 0xA8, 0xC7, 0x46, 0x4D, 0x57, 0x29, 0x5A, 0x2F, 0xCF, 0x0C, 0xC6, 0x16,
-    0x8D, 0x78, 0x09, 0xD8, 0x5C, 0xDC, 0x08, 0xC0, 0x9E, 0x63, 0xE7, 0x91, 0x6F, 0x49, 0x89, 0xF9,
-    0x0A, 0xA7, 0x45, 0x36, 0xE0, 0xB4, 0x69, 0x1C, 0x4E, 0xDC, 0xCA, 0x29, 0x26, 0x84, 0x61, 0x3A,
-    0xD9, 0x3D, 0x39, 0xF8, 0x5E, 0x26, 0xDD, 0x23, 0x35, 0xB0, 0x73, 0x48, 0x94, 0x34, 0x50, 0xE1,
-    0xC1, 0x61, 0x3B, 0xD3, 0x27, 0x23, 0x22, 0xC7, 0xC6, 0xC7, 0x34, 0xDD, 0x8E, 0x65, 0x7A, 0x2C,
-    0xFD, 0xFE, 0xA1, 0xD4, 0xC6, 0x60, 0x4A, 0x49, 0x61, 0x2D, 0xEB, 0x52, 0x53, 0x6F, 0x5A, 0xDC,
-    0x14, 0x0E, 0x54, 0x89, 0x7C, 0xCD, 0xE3, 0x3E, 0xA7, 0x4E, 0xE0, 0x5B, 0xF9, 0x5C, 0x44, 0x2E,
-    0x60, 0x28, 0x6D, 0x0B, 0x64, 0x24, 0xA2, 0x6B, 0xE1, 0x8F, 0xC4, 0xD9, 0x26, 0xF5, 0xE1, 0x80,
-    0x83, 0x82, 0x06, 0xB9, 0x37, 0xE8, 0xCE, 0x20, 0x9E, 0xAC, 0xD6, 0xAD, 0x2C, 0x91, 0xD4, 0xC0,
-    0x45, 0x5A, 0x1F, 0x40, 0x15, 0xEE, 0x0D, 0x50, 0x86, 0xEB, 0xB1, 0x93, 0xA7, 0xF2, 0xF1, 0xB0,
-    0x7E, 0x70, 0x5B, 0xFA, 0xE5, 0x3E, 0xDC, 0x28, 0xE9, 0xAE, 0xAD, 0x93, 0xD0, 0x94, 0x69, 0x40,
-    0xD6, 0x0D, 0x4C, 0x99, 0x50, 0xFF, 0x8C, 0x52, 0x2F, 0x34, 0x2D, 0x69, 0x71, 0x8D, 0xB4, 0x3F,
-    0x59, 0xA3, 0xC3, 0x48, 0x89, 0xDF, 0x9E, 0xEB, 0x7E, 0x46, 0x27, 0x84, 0x6F, 0x9D, 0x0E, 0x8D,
-    0x4B, 0x27, 0x06, 0x35, 0x78, 0xC7, 0x05, 0xE8, 0xF4, 0xFA, 0x3D, 0xD0, 0xED, 0xDC, 0xCD, 0xF9,
-    0x0B, 0x0E, 0x2C, 0xE7, 0x7A, 0x3C, 0xE5, 0x65, 0x01, 0x62, 0x2D, 0xA9, 0x61, 0x79, 0x1B, 0xC0,
-    0x2E, 0x2E, 0xEF, 0x08, 0xB9, 0x30, 0xC8, 0x70, 0x26, 0xC3, 0xB2, 0x00, 0xB1, 0x38, 0xE2, 0x2D,
-    0x47, 0x6A, 0x5E, 0x96, 0x21, 0x0E, 0xAB, 0x38, 0x5C, 0xAF, 0x0F, 0xCB, 0x9D, 0x4C, 0xF5, 0x2B,
-    0x95, 0x97, 0x2B, 0x95, 0xC5, 0x35, 0x4B, 0x11, 0x99, 0x9E, 0x15, 0x84, 0xFA, 0x6D, 0x24, 0x05,
-    0xD0, 0x12, 0xB2, 0xDC, 0x83, 0x3C, 0xAA, 0xB4, 0x05, 0xB9, 0x37, 0x7E, 0xCA, 0x74, 0xF8, 0x73,
-    0xA9, 0xD6, 0x61, 0x26, 0x51, 0x21, 0x50, 0xB1, 0x98, 0x0D, 0x88, 0x7E, 0xC9, 0x03, 0x3B, 0x07,
-    0x24, 0x38, 0x80, 0xBA, 0x56, 0x88, 0x14, 0x94, 0x72, 0x4B, 0x19, 0xBB, 0x02, 0x6A, 0x41, 0x29,
-    0xCB, 0xC8, 0x14, 0xEB, 0x1D, 0xA4, 0x71, 0x67, 0x90, 0x7B, 0xC3, 0x52, 0x52, 0x82, 0x14, 0x65,
-    0xF9, 0xD2, 0xDF, 0x72, 0x49, 0xD7, 0x9B, 0x9A, 0x69, 0xA9, 0x9F, 0xAC, 0x8F, 0xA4, 0x99, 0x22,
-    0x15, 0x7E, 0xBE, 0xCD, 0xBC, 0x4D, 0x33, 0x49, 0xDB, 0x11, 0x58, 0x21, 0xFB, 0x6B, 0xC1, 0xE4,
-    0xA2, 0x43, 0x54, 0xB8, 0x76, 0xC8, 0x4F, 0x00, 0x3D, 0x66, 0x1F, 0xA1, 0x3C, 0xE6, 0xC8, 0xAC,
-    0x13, 0x1F, 0x0C, 0xC4, 0xB3, 0x4E, 0x87, 0x58, 0x3C, 0x1C, 0xDD, 0xB2, 0x31, 0x5A, 0xC0, 0x36,
-    0xE5, 0x5D, 0x22, 0x0B, 0xD4, 0x23, 0xF0, 0x18, 0x4F, 0x2D, 0x28, 0x9F, 0x75, 0x72, 0x2B, 0xC2,
-    0xD2, 0x0A, 0xFA, 0x9F, 0xCC, 0x57, 0xBB, 0x3A, 0x8B, 0x40, 0x1A, 0x77, 0x67, 0x88, 0xD5, 0xB1,
-    0x7D, 0x3D, 0x86, 0xED, 0x08, 0x71, 0x15, 0x36, 0x0E, 0xE5, 0x2D, 0x1E, 0x7B, 0x03, 0x93, 0x59,
-    0x48, 0x60, 0x12, 0x05, 0x26, 0x17, 0xE8, 0x57, 0x24, 0x73, 0xC5, 0x81, 0x9A, 0x7E, 0x46, 0xA8,
-    0x35, 0x0D, 0xBB, 0x5C, 0x66, 0x58, 0x3C, 0x64, 0x2D, 0x73, 0x8D, 0x9C, 0xFD, 0xAC, 0x69, 0xC5,
-    0x45, 0xE3, 0xA5, 0xD7, 0x83, 0xF4, 0x14, 0xE6, 0x3E, 0xA6, 0xD9, 0x45, 0xEC, 0x83, 0x6C, 0x53,
-    0x2A, 0xBD, 0x6A, 0x06, 0xF4, 0x15, 0x23, 0xAF, 0x09, 0xFB, 0x8A, 0x24, 0xC0, 0x22, 0x48, 0x5F,
-    0x4B, 0x7F, 0x19, 0x53, 0xEA, 0x61, 0xEC, 0x0F, 0xA2, 0x8B, 0xFF, 0xE3, 0xF4, 0x46, 0x5C, 0x77,
-    0x2C, 0x07, 0xFE, 0x1B, 0x47, 0x55, 0x2B, 0xD8, 0x82, 0xBE, 0x89, 0x23, 0xF0, 0xF9, 0x07, 0x60,
-    0xC2, 0x21, 0x94, 0x20, 0x79, 0x4E, 0xE9, 0x01, 0x7E, 0x55, 0xB4, 0xC5, 0x7B, 0xD8, 0x72, 0xF6,
-    0xA8, 0x54, 0xAC, 0x54, 0x4D, 0xEA, 0xED, 0x2B, 0x65, 0x59, 0x6D, 0xE2, 0xDD, 0x1A, 0xD0, 0x8D,
-    0xDB, 0xFF, 0x8C, 0xBC, 0xE5, 0x12, 0xE3, 0x8B, 0x56, 0x30, 0x19, 0x1F, 0xEB, 0xE3, 0xBD, 0xFC,
-    0xF0, 0xB0, 0xF1, 0x9A, 0xEE, 0x33, 0xF9, 0xB5, 0x50, 0x02, 0xD6, 0x93, 0x1E, 0x20, 0x53, 0x67,
-    0xC0, 0xBD, 0xFD, 0x2B, 0xCD, 0xFF, 0x05, 0x7D, 0x93, 0x2F, 0x73, 0xD4, 0x40, 0x18, 0xC6, 0x9F,
-    0x24, 0x94, 0x88, 0x88, 0xC5, 0xA0, 0x8E, 0x99, 0x78, 0x4C, 0x3E, 0x01, 0xEC, 0x2A, 0x34, 0xA2,
-    0x9D, 0x8A, 0x8A, 0xF3, 0x98, 0xFB, 0x06, 0xDD, 0x30, 0x48, 0x0C, 0x9E, 0x4F, 0x40, 0xCD, 0x99,
-    0x0A, 0x0C, 0x97, 0x0C, 0x15, 0x15, 0x35, 0x11, 0x9D, 0xC1, 0x86, 0x19, 0x5C, 0xCD, 0xC2, 0xA4,
-    0xD3, 0xBD, 0xCE, 0xEE, 0xBE, 0xBC, 0x9B, 0xDC, 0x1D, 0x2D, 0x9D, 0x69, 0x12, 0x91, 0xC9, 0xBE,
-    0x7F, 0x9F, 0xE7, 0x17, 0x00, 0x48, 0x68, 0x80, 0x24, 0x9B, 0x85, 0xF9, 0x50, 0xB6, 0xC2, 0x78,
-    0x94, 0x67, 0x06, 0x72, 0xDE, 0x22, 0xAC, 0x90, 0xDE, 0x5A, 0x14, 0x57, 0x3D, 0xE4, 0xB2, 0x85,
-    0xD7, 0xC8, 0x7E, 0x3B, 0x3E, 0xB5, 0x08, 0xF9, 0x7A, 0x61, 0x0A, 0x22, 0x14, 0xD4, 0x23, 0xD9,
-    0xC7, 0x74, 0x25, 0x16, 0x28, 0x7B, 0x80, 0x6A, 0x88, 0x00, 0x34, 0x16, 0xF9, 0x0D, 0xA7, 0x96,
-    0x75, 0x36, 0x1C, 0xA3, 0x7A, 0x6F, 0x13, 0x9B, 0xF7, 0xA2, 0x2D, 0x6B, 0x4D, 0x64, 0x89, 0xA8,
-    0x3F, 0x38, 0xBA, 0xE6, 0x84, 0x1A, 0x38, 0x9E, 0x72, 0x13, 0x85, 0x8C, 0x7C, 0x1E, 0x1F, 0x97,
-    0x77, 0x28, 0x5A, 0x14, 0x97, 0x10, 0x54, 0x0B, 0x1E, 0x70, 0xE6, 0x00, 0x3F, 0x46, 0xF2, 0xF3,
-    0x0D, 0xA9, 0xC3, 0x62, 0xD0, 0xD4, 0xC9, 0x80, 0x3D, 0x35, 0x75, 0xAF, 0x0C, 0xAA, 0xA0, 0xC4,
-    0x1A, 0x19, 0xC7, 0x11, 0x17, 0x6E, 0xB9, 0x5A, 0x80, 0x26, 0x5F, 0xF0, 0xB0, 0x2B, 0xC8, 0x8F,
-    0x7D, 0xE2, 0x56, 0x10, 0xE7, 0x26, 0x71, 0x52, 0x55, 0x1F, 0xC2, 0x6C, 0x10, 0x7C, 0x5E, 0x91,
-    0xC2, 0x73, 0x70, 0x58, 0xA8, 0x88, 0x2E, 0x88, 0xFE, 0xF4, 0xE9, 0x70, 0x9A, 0xD8, 0x17, 0x70,
-    0xB1, 0x0F, 0x34, 0x20, 0xC7, 0x5A, 0xA2, 0x43, 0x66, 0x90, 0xF2, 0x98, 0x6E, 0xFA, 0x54, 0x23,
-    0xEB, 0x80, 0x67, 0x53, 0x73, 0xED, 0xD1, 0x50, 0xA7, 0x53, 0x27, 0x21, 0x45, 0x2B, 0xBE, 0xDB,
-    0xDC, 0xC8, 0x1F, 0x26, 0x23, 0x83, 0xC6, 0x23, 0x34, 0x9D, 0x4F, 0x1D, 0x4B, 0xB0, 0x54, 0xF9,
-    0x55, 0x9F, 0x5E, 0xFB, 0xC4, 0x55, 0xE4, 0x53, 0xB2, 0xD8, 0x7B, 0x3B, 0x66, 0xB3, 0x52, 0x44,
-    0x6D, 0x73, 0x18, 0xB3, 0xE7, 0x2D, 0xEB, 0x9D, 0x78, 0x07, 0x2D, 0x55, 0x79, 0x11, 0xE6, 0x7D,
-    0x43, 0x03, 0xEB, 0xC1, 0x41, 0xDC, 0x45, 0x41, 0xD7, 0x09, 0xD5, 0x55, 0xD4, 0x44, 0x21, 0xEA,
-    0xAE, 0xF6, 0xA1, 0x2F, 0x88, 0xD3, 0xA9, 0x2D, 0x07, 0xD1, 0x15, 0x8F, 0xDC, 0x95, 0xAD, 0x7C,
-    0xE3, 0xA4, 0xC7, 0xD6, 0x2E, 0xFA, 0xC5, 0xDB, 0xB3, 0xEF, 0xCB, 0xA1, 0xEC, 0x84, 0x09, 0xFF,
-    0x7C, 0x6F, 0x76, 0xBE, 0x57, 0xCB, 0x7A, 0xF4, 0xFD, 0x7A, 0xE3, 0x7B, 0x61, 0x4B, 0x23, 0xFE,
-    0xF3, 0xFD, 0x2B, 0x1A, 0xC3, 0x13, 0xE9, 0x10, 0xD5, 0x29, 0x38, 0xA7, 0xC6, 0xEA, 0xE1, 0xAB,
-    0xBE, 0x94, 0xB4, 0x66, 0xD3, 0x63, 0xC6, 0x2C, 0x16, 0xF0, 0x69, 0x58, 0x18, 0x09, 0x9D, 0xF7,
-    0xD9, 0xF0, 0x3A, 0x2A, 0x9A, 0x9B, 0xD1, 0x62, 0xC9, 0xF4, 0xF4, 0xC8, 0x58, 0xE8, 0x30, 0x6E,
-    0x5C, 0x76, 0xC8, 0x89, 0x1C, 0x43, 0x73, 0xC6, 0xDC, 0x4C, 0x72, 0x25, 0xBC, 0x6E, 0x38, 0x1C,
-    0x5E, 0x61, 0xF5, 0x14, 0x95, 0x8A, 0xF6, 0x54, 0x5D, 0xD2, 0x74, 0x60, 0x3F, 0x5F, 0x2E, 0xBB,
-    0x48, 0xC7, 0xD6, 0xB5, 0x1E, 0x0B, 0xA3, 0x89, 0x67, 0xEE, 0x70, 0x70, 0x07, 0x53, 0x31, 0x61,
-    0x5A, 0xC4, 0x16, 0x16, 0xD9, 0x84, 0x69, 0xBA, 0xC1, 0xD4, 0xDD, 0xC3, 0xF4, 0x27, 0x63, 0xAA,
-    0xEE, 0x62, 0x9A, 0x7E, 0x42, 0x7A, 0xF2, 0x25, 0x9F, 0x48, 0x9D, 0x30, 0xED, 0xB6, 0x98, 0x2E,
-    0xEE, 0x62, 0xBA, 0x42, 0xC2, 0xB2, 0x59, 0x4D, 0xBD, 0x26, 0xB5, 0xB1, 0x7A, 0xC4, 0x94, 0x94,
-    0xF0, 0xF7, 0x30, 0x5D, 0xF3, 0x0F, 0xE8, 0xF2, 0xDB, 0x86, 0x31, 0xD5, 0x3B, 0x4C, 0x11, 0x31,
-    0x3D, 0xF3, 0xC5, 0x88, 0xA9, 0x8C, 0x98, 0x2A, 0xBC, 0x3B, 0x39, 0xD9, 0x61, 0x6A, 0x4F, 0x13,
-    0xB7, 0xC5, 0x94, 0xB7, 0x95, 0xEA, 0x11, 0x4C, 0x37, 0xCD, 0x79, 0xD7, 0x88, 0xE9, 0x1B, 0x57,
-    0x6D, 0x30, 0xCD, 0x8C, 0x3C, 0x37, 0xF9, 0x84, 0x29, 0x35, 0x5D, 0xC8, 0x18, 0x53, 0x39, 0x61,
-    0xBA, 0x66, 0x4C, 0x65, 0xC4, 0xD4, 0x6F, 0x31, 0xD5, 0xC3, 0x88, 0xE9, 0x67, 0xFB, 0x00, 0xD3,
-    0xF5, 0x51, 0xCF, 0x62, 0x45, 0x4C, 0x9F, 0x34, 0xE3, 0x24, 0xBA, 0x46, 0xD3, 0xCE, 0x76, 0x98,
-    0xFE, 0x05, 0x5D, 0x52, 0xB1, 0x6E, 0xD4, 0x40, 0x14, 0x9C, 0x3D, 0x13, 0x5C, 0x58, 0xC2, 0x15,
-    0x08, 0x92, 0xC2, 0x9F, 0xE0, 0x96, 0x26, 0xB1, 0x3F, 0x21, 0x05, 0x09, 0x25, 0x9F, 0x40, 0x93,
-    0xDE, 0xCE, 0x1F, 0x5C, 0x43, 0x9A, 0xB4, 0x29, 0x22, 0xA5, 0xA0, 0xA1, 0x0D, 0x6B, 0xF1, 0x03,
-    0x9C, 0xC4, 0x0F, 0x58, 0x88, 0x2A, 0x0D, 0x2E, 0x5C, 0x98, 0xD3, 0x9D, 0x27, 0x6F, 0xD6, 0x7B,
-    0x0D, 0x2B, 0xF9, 0xE9, 0xE9, 0xBD, 0x79, 0x6F, 0x67, 0x66, 0xDD, 0x90, 0xDC, 0xDA, 0xC7, 0xDF,
-    0xDE, 0x42, 0x57, 0xB5, 0x68, 0x30, 0x03, 0xBB, 0x64, 0x42, 0xD2, 0xE7, 0x3D, 0xB2, 0xDA, 0x4A,
-    0x50, 0x09, 0x56, 0x02, 0xAC, 0x04, 0x54, 0xE4, 0x00, 0xC1, 0x13, 0x72, 0x8E, 0xA5, 0x88, 0x72,
-    0x0F, 0xF3, 0x3D, 0x32, 0xF5, 0x8F, 0xFD, 0x53, 0xFB, 0xDF, 0xA0, 0xF3, 0x4F, 0x35, 0x1A, 0x12,
-    0x2B, 0x72, 0x07, 0x9D, 0x23, 0x05, 0x2F, 0x90, 0x46, 0xC0, 0x5B, 0x4B, 0x3D, 0xAA, 0x0E, 0x55,
-    0x9D, 0x0E, 0x28, 0x3A, 0x4C, 0x1A, 0x7C, 0x8F, 0x64, 0x34, 0x88, 0x0B, 0x33, 0x8D, 0x42, 0xD9,
-    0x1D, 0x21, 0x15, 0x03, 0xDB, 0xA4, 0x41, 0x6D, 0xB0, 0x19, 0xE0, 0xD5, 0xD7, 0x2D, 0xEB, 0xD0,
-    0x71, 0x37, 0xFB, 0x8B, 0x73, 0xE0, 0xFB, 0xA1, 0x83, 0xBC, 0xB3, 0x90, 0x89, 0xAC, 0xB6, 0xBD,
-    0xA8, 0xA4, 0x3A, 0x57, 0xF8, 0x31, 0x3F, 0x90, 0xFD, 0x29, 0x70, 0xB9, 0x06, 0x3E, 0x20, 0x9E,
-    0x13, 0xD3, 0x56, 0x2F, 0xA9, 0x50, 0x0B, 0x5F, 0x93, 0xF0, 0xEF, 0x92, 0x5D, 0xCC, 0x67, 0x64,
-    0xB1, 0x8C, 0xA6, 0x05, 0x63, 0x5A, 0xF4, 0x28, 0x36, 0x4B, 0x9A, 0x4E, 0x12, 0xBF, 0x8E, 0x60,
-    0xEC, 0x31, 0x1D, 0xC0, 0x55, 0x7D, 0x76, 0x00, 0x97, 0x5D, 0xD1, 0x46, 0x70, 0x3E, 0x9C, 0x6C,
-    0xEF, 0xE1, 0xFF, 0x18, 0x38, 0x1F, 0xEC, 0x52, 0x47, 0xB6, 0x4D, 0xFB, 0x79, 0x2C, 0xC9, 0xEB,
-    0x7D, 0xDA, 0x17, 0xE4, 0x88, 0xB2, 0xC5, 0x23, 0xBE, 0x99, 0xC4, 0x5E, 0x62, 0xAA, 0xFA, 0xAD,
-    0xE3, 0x17, 0x60, 0x35, 0x21, 0x1B, 0xC2, 0x66, 0x49, 0x76, 0x5C, 0x6B, 0x33, 0x04, 0x2E, 0xCD,
-    0x8F, 0x69, 0x51, 0xEE, 0xB8, 0x13, 0x0D, 0x81, 0xF1, 0x52, 0x9B, 0xB1, 0xF8, 0x93, 0x0D, 0x07,
-    0xF0, 0x15, 0x76, 0x0B, 0x78, 0xC0, 0x29, 0x9A, 0x94, 0x77, 0x22, 0xEE, 0xF2, 0xB6, 0xFA, 0x44,
-    0xA9, 0xAE, 0xF8, 0x8B, 0xFC, 0xA9, 0xAB, 0xCD, 0xFD, 0xDE, 0xC8, 0x2D, 0x32, 0x5F, 0xD7, 0xEE,
-    0x22, 0x68, 0x3C, 0xD7, 0x72, 0xD2, 0x6C, 0xF3, 0x6A, 0xE6, 0xFC, 0x6B, 0xD7, 0x71, 0xB3, 0x1A,
-    0x91, 0x1B, 0xBF, 0x0D, 0xBC, 0xD1, 0x41, 0x62, 0x9E, 0x5D, 0xA1, 0x0C, 0x16, 0x31, 0x0A, 0x47,
-    0x78, 0x4D, 0xF3, 0xC2, 0x22, 0x02, 0xC2, 0x5C, 0x1F, 0xA2, 0xF5, 0xAD, 0x7E, 0xB8, 0x3D, 0xF0,
-    0x71, 0xD6, 0x83, 0x66, 0x63, 0xF4, 0x4D, 0xEF, 0x1A, 0x5E, 0xC2, 0x07, 0x1A, 0x81, 0xCC, 0x8A,
-    0x1B, 0xBC, 0xB3, 0x38, 0xFB, 0x51, 0x44, 0x54, 0xF3, 0xD4, 0xC0, 0x9B, 0x3B, 0x3C, 0x03, 0x9D,
-    0x54, 0xB1, 0x6E, 0xD4, 0x40, 0x10, 0x5D, 0x7B, 0xA5, 0x38, 0xC2, 0x20, 0x37, 0x94, 0x48, 0xA6,
-    0x8E, 0x84, 0xDC, 0xA4, 0xC5, 0x6B, 0x89, 0x6F, 0x30, 0x94, 0x69, 0x11, 0x35, 0x05, 0x4D, 0x62,
-    0x4B, 0xF9, 0x00, 0xF2, 0x07, 0xB4, 0x64, 0xAF, 0xA5, 0xF4, 0x71, 0x4B, 0xAE, 0xA0, 0xA0, 0x88,
-    0x25, 0x44, 0x9D, 0x43, 0x74, 0x34, 0x58, 0x9C, 0x25, 0x4E, 0x61, 0xEF, 0x96, 0x79, 0xBB, 0xBE,
-    0xE5, 0x12, 0x92, 0xE2, 0x58, 0x69, 0xE6, 0x56, 0x3B, 0xEB, 0xD9, 0x37, 0x6F, 0xE6, 0x1D, 0x63,
-    0x58, 0xC1, 0x0C, 0xBE, 0x82, 0x4B, 0x14, 0x39, 0xDE, 0x61, 0xAB, 0xE1, 0x44, 0x59, 0x3E, 0x95,
-    0x6F, 0x0C, 0xD6, 0x04, 0xEE, 0x67, 0x4F, 0x87, 0xF7, 0xE3, 0xD6, 0xC6, 0x0A, 0xF8, 0x25, 0xF3,
-    0x5F, 0xDC, 0x63, 0x57, 0x16, 0xA7, 0x5C, 0x29, 0x05, 0xAA, 0x25, 0x0B, 0x8C, 0x29, 0xA2, 0xF9,
-    0x79, 0x9B, 0x4E, 0xA7, 0xBD, 0xE0, 0x4A, 0x3F, 0xE0, 0x6A, 0xDF, 0xC6, 0x61, 0xD1, 0xDA, 0xDA,
-    0xED, 0x6C, 0xBD, 0xDE, 0x59, 0xE0, 0x0E, 0x12, 0xF3, 0xC8, 0x79, 0xF7, 0xE2, 0xB4, 0x2C, 0x0F,
-    0xCE, 0x8D, 0x5F, 0x5F, 0x09, 0x6F, 0xB0, 0x40, 0xEC, 0x08, 0x2E, 0x45, 0xA9, 0xD1, 0xDF, 0x52,
-    0xA3, 0x4D, 0xEC, 0xDB, 0x62, 0x59, 0xD7, 0x30, 0xD4, 0xF4, 0x88, 0xAB, 0x57, 0xE2, 0xC9, 0x07,
-    0x9D, 0x4C, 0x3F, 0x76, 0xFC, 0xD7, 0x85, 0x62, 0xC6, 0x10, 0x38, 0x7A, 0x26, 0xA1, 0xF7, 0xC2,
-    0xDA, 0x3E, 0x41, 0x68, 0xE2, 0x02, 0xD4, 0x67, 0x35, 0x27, 0x54, 0xEF, 0x19, 0x1B, 0xB3, 0x90,
-    0x36, 0x59, 0x11, 0xD1, 0x61, 0xDC, 0xA6, 0x5F, 0xCA, 0xF2, 0x59, 0x2F, 0x80, 0x5C, 0x3B, 0x8F,
-    0xE6, 0xF0, 0x0E, 0x5C, 0x27, 0x2A, 0xD0, 0xB6, 0xDA, 0xCA, 0x82, 0x4F, 0x15, 0xEF, 0x6D, 0x01,
-    0x9E, 0x95, 0x00, 0xD9, 0x91, 0x9B, 0x12, 0x4E, 0x56, 0x2C, 0xFC, 0xFD, 0xA3, 0x8E, 0xBF, 0x7D,
-    0x9A, 0x89, 0xE3, 0x33, 0x9D, 0x73, 0xD5, 0xEC, 0x72, 0xF5, 0xD0, 0xF3, 0x7F, 0x8B, 0xA1, 0x47,
-    0xE8, 0x15, 0x7A, 0x86, 0xDE, 0xA1, 0x87, 0xE8, 0x25, 0x4B, 0xFB, 0xAB, 0xFC, 0x63, 0x8F, 0x33,
-    0x8A, 0x85, 0xC6, 0xD8, 0x77, 0xB2, 0xE3, 0xB3, 0x05, 0xBE, 0xBD, 0xED, 0x1D, 0x9C, 0x03, 0x07,
-    0xEE, 0xE1, 0x3E, 0xF0, 0x01, 0xA7, 0xC5, 0x4B, 0xF9, 0xE4, 0xE8, 0xBB, 0x5C, 0xB7, 0x6D, 0x78,
-    0x65, 0xB9, 0x61, 0xE3, 0x0D, 0x6B, 0xBC, 0xED, 0x90, 0xA5, 0x75, 0x43, 0x9C, 0x34, 0x44, 0x4A,
-    0x43, 0x3C, 0x35, 0xC4, 0x58, 0x43, 0xDC, 0xE9, 0x0A, 0x1C, 0x4A, 0xF9, 0xD6, 0x32, 0xD8, 0x0F,
-    0x59, 0x30, 0xBF, 0x09, 0x66, 0xC2, 0x3D, 0x50, 0x0D, 0x83, 0x71, 0x93, 0xE5, 0xDE, 0x4E, 0x58,
-    0x1E, 0xF6, 0xF4, 0xBB, 0x24, 0x13, 0x64, 0x89, 0x7A, 0x4C, 0x3D, 0x11, 0xAE, 0x47, 0xCB, 0x3D,
-    0x39, 0xD2, 0x6E, 0xA8, 0x30, 0x5D, 0x94, 0x11, 0x6D, 0x0A, 0x3A, 0xD7, 0x6D, 0x5A, 0x7B, 0x5E,
-    0x68, 0x15, 0xD4, 0x82, 0x14, 0x36, 0x17, 0xCB, 0xD1, 0xD5, 0x1C, 0xF0, 0x72, 0xC0, 0xCA, 0x51,
-    0xF8, 0x0A, 0x6E, 0x69, 0x55, 0xF6, 0x8F, 0x2C, 0x6F, 0x90, 0x1B, 0xDB, 0xBF, 0x26, 0x60, 0x3B,
-    0xEA, 0x76, 0x72, 0x12, 0xB8, 0xF9, 0xA5, 0x94, 0xF2, 0x14, 0x54, 0x31, 0xA7, 0xDF, 0x0C, 0xA7,
-    0x33, 0x2B, 0x6B, 0x7E, 0x39, 0xA2, 0xAD, 0xFD, 0x76, 0x90, 0xB5, 0x7D, 0x26, 0x74, 0x89, 0x91,
-    0x4D, 0x50, 0x2C, 0x31, 0x48, 0x4D, 0x11, 0x43, 0x63, 0x2C, 0x3A, 0xA3, 0xD2, 0x49, 0x62, 0xF8,
-    0xBC, 0xD3, 0xFA, 0xAE, 0x48, 0xA6, 0x2E, 0x24, 0x28, 0xC9, 0x56, 0x9B, 0xF0, 0xE4, 0xB9, 0xAF,
-    0x20, 0x50, 0xD7, 0x44, 0x1C, 0x76, 0x16, 0xBA, 0xB2, 0x83, 0xB0, 0x43, 0xF8, 0xA5, 0xD3, 0xB6,
-    0xFD, 0xC3, 0x3A, 0xB2, 0xD0, 0x5F, 0x0F, 0x55, 0xAC, 0x5C, 0xA8, 0xF2, 0xD2, 0x76, 0x24, 0xEC,
-    0xA2, 0x6B, 0xB1, 0xFA, 0x3F, 0x70, 0xC1, 0xE7, 0x4E, 0xBF, 0x14, 0x55, 0x72, 0xA1, 0x4C, 0x67,
-    0x3A, 0x6E, 0x12, 0x4D, 0x02, 0x26, 0x12, 0xB2, 0x03, 0x92, 0xF0, 0x84, 0x40, 0x40, 0xAF, 0xEC,
-    0x8E, 0xC7, 0x1F, 0xD6, 0xD0, 0x76, 0xDC, 0x46, 0x56, 0xD5, 0x08, 0x8E, 0x31, 0x3F, 0x21, 0x20,
-    0xD6, 0xB1, 0x05, 0x9A, 0xA1, 0x88, 0xC5, 0x21, 0x6E, 0x1F, 0x62, 0xA2, 0x58, 0x93, 0xE2, 0xBC,
-    0x8F, 0xE0, 0xDB, 0x60, 0x25, 0xE5, 0xA4, 0xC0, 0xC8, 0x8D, 0xBD, 0xAA, 0x5B, 0xE8, 0x2B, 0x28,
-    0x48, 0xD1, 0x7F, 0x00, 0xCD, 0x59, 0x3D, 0x90, 0xE4, 0xC4, 0x15, 0x7E, 0x1A, 0xB1, 0xAB, 0xAA,
-    0x53, 0x20, 0x02, 0x96, 0x00, 0xCA, 0x56, 0x4E, 0x80, 0x1C, 0x3A, 0xD8, 0xBD, 0x56, 0x99, 0xE0,
-    0x02, 0x07, 0x5C, 0xB9, 0x6E, 0x70, 0xE0, 0xC0, 0x0E, 0x48, 0x6C, 0x02, 0x12, 0x07, 0x0E, 0xF6,
-    0x4E, 0x2A, 0x3B, 0x20, 0xB8, 0x80, 0x8D, 0x4D, 0x60, 0x42, 0x98, 0x0B, 0x36, 0x25, 0xD8, 0x5B,
-    0x89, 0xBB, 0x80, 0xC0, 0x81, 0xC7, 0xB8, 0x6C, 0x42, 0x64, 0x83, 0x09, 0xB8, 0x00, 0x51, 0x35,
-    0x55, 0x68, 0x0F, 0x49, 0xED, 0xEF, 0x7B, 0xDD, 0xBB, 0xD2, 0xEE, 0x1E, 0x18, 0x83, 0xC1, 0x56,
-    0xED, 0x76, 0xCF, 0xA8, 0xBB, 0x5F, 0x7F, 0xEF, 0xB7, 0xDF, 0xEB, 0xD9, 0xC9, 0x45, 0x64, 0xEB,
-    0xB9, 0x01, 0xED, 0xA2, 0xCF, 0x1A, 0x74, 0xA6, 0xB4, 0x68, 0xA3, 0x36, 0xD9, 0xA0, 0x1B, 0xA5,
-    0xA8, 0x45, 0x92, 0x75, 0xD8, 0x73, 0x5C, 0x38, 0xC1, 0xE4, 0x81, 0xE5, 0xB8, 0x24, 0xD6, 0xDA,
-    0x51, 0xA4, 0x42, 0x57, 0x4B, 0x68, 0x57, 0x77, 0x30, 0x27, 0x5B, 0x63, 0x5C, 0x30, 0x01, 0xE3,
-    0x92, 0xB4, 0x72, 0x0C, 0x1A, 0x55, 0x99, 0x80, 0x46, 0xD8, 0x07, 0x1D, 0xA9, 0xD7, 0x18, 0x97,
-    0x60, 0x0C, 0x31, 0x8E, 0x09, 0x77, 0x85, 0x13, 0x9E, 0xC7, 0xB8, 0x84, 0x27, 0x1C, 0x17, 0xC3,
-    0xDD, 0x41, 0x81, 0xE3, 0x92, 0x10, 0x17, 0x26, 0x70, 0x5C, 0x49, 0xE2, 0x79, 0x5C, 0xDB, 0x2D,
-    0xFC, 0x3F, 0x6D, 0xD7, 0xB2, 0xB0, 0x98, 0x99, 0xFE, 0xB5, 0x68, 0xE4, 0xD7, 0x62, 0xD6, 0xBA,
-    0x01, 0x17, 0x90, 0x04, 0xD7, 0x86, 0x64, 0x22, 0x01, 0xEA, 0x1B, 0xA6, 0x94, 0x02, 0x70, 0x01,
-    0xBA, 0x13, 0x9B, 0x57, 0x0D, 0x5E, 0x16, 0x25, 0xE0, 0x8F, 0x20, 0x1B, 0x6E, 0x30, 0x9A, 0xBC,
-    0x0D, 0xFC, 0x45, 0xDC, 0x82, 0x4F, 0x7E, 0x5B, 0x63, 0xCC, 0x84, 0x1D, 0xBE, 0x61, 0x66, 0x52,
-    0xE3, 0xD5, 0xB1, 0x90, 0xAD, 0xC5, 0x20, 0x45, 0x1E, 0x8E, 0x3F, 0xDB, 0x48, 0x64, 0x6D, 0x8E,
-    0x86, 0x32, 0xBB, 0x8E, 0xFF, 0x9D, 0xE5, 0x72, 0x19, 0x42, 0x16, 0xBD, 0x41, 0xF3, 0x17, 0x88,
-    0x83, 0xFB, 0x43, 0x1E, 0xB2, 0xF8, 0xB2, 0x0F, 0xA9, 0x5D, 0x55, 0xEF, 0x62, 0xC1, 0x90, 0xA1,
-    0xF9, 0x77, 0x93, 0xCF, 0x3E, 0x14, 0x98, 0xFC, 0x1E, 0x57, 0xF1, 0x43, 0xA9, 0x02, 0x91, 0xC7,
-    0x44, 0xB6, 0x8F, 0x0F, 0x64, 0x4F, 0x35, 0x92, 0x8F, 0x84, 0x67, 0x3F, 0xEB, 0x24, 0x1B, 0x97,
-    0x2F, 0x03, 0x63, 0xD5, 0x40, 0x54, 0x25, 0x35, 0x27, 0xB6, 0xA6, 0x36, 0x43, 0xBB, 0x8E, 0x21,
-    0x9C, 0xD8, 0xB6, 0x50, 0x93, 0x64, 0xEF, 0x6C, 0x52, 0x50, 0xAE, 0xC2, 0x2E, 0xAB, 0xC1, 0xB2,
-    0x76, 0x71, 0x0B, 0x49, 0xD4, 0x92, 0xD6, 0x2A, 0x90, 0x42, 0xE5, 0x12, 0xF4, 0xDA, 0x45, 0x1B,
-    0xE8, 0xD3, 0x94, 0x58, 0xC2, 0x99, 0xD0, 0x68, 0xB8, 0x49, 0x6B, 0xC0, 0x8B, 0xDB, 0xE4, 0x83,
-    0x0D, 0xF5, 0x9A, 0x90, 0x97, 0x6C, 0x1D, 0x11, 0x5C, 0x51, 0x2F, 0x2C, 0x35, 0xCA, 0x2D, 0x25,
-    0x1D, 0xA0, 0x82, 0xF1, 0xF7, 0x76, 0x23, 0xE6, 0xB6, 0x1A, 0x4E, 0x05, 0xB8, 0x27, 0x22, 0xBB,
-    0x12, 0xFC, 0x32, 0x97, 0xE9, 0x09, 0x5E, 0x67, 0x9B, 0xD5, 0x6A, 0x0B, 0x1C, 0x48, 0xD4, 0x2E,
-    0x4C, 0x4F, 0x43, 0xFD, 0x9C, 0x96, 0x92, 0xFC, 0x89, 0xF6, 0x70, 0x8B, 0x02, 0x09, 0x5B, 0x00,
-    0x04, 0x50, 0x4E, 0xB9, 0x4B, 0x31, 0x85, 0x2D, 0x34, 0x27, 0x59, 0x49, 0xD6, 0x06, 0xCA, 0x0C,
-    0x4A, 0x06, 0x2B, 0x59, 0x09, 0x15, 0x4A, 0x0F, 0xF3, 0x93, 0xB8, 0x01, 0x07, 0xB4, 0xD5, 0x64,
-    0x03, 0x9E, 0x24, 0xA5, 0x3D, 0xD0, 0x38, 0x29, 0x9F, 0x1F, 0xF5, 0xB4, 0xD0, 0x84, 0x84, 0xFB,
-    0xC2, 0x7E, 0x7C, 0x68, 0x3F, 0xB3, 0x7C, 0x3E, 0xD1, 0xB6, 0xA6, 0x9E, 0x97, 0xD7, 0x29, 0x78,
-    0xDB, 0x6B, 0x3B, 0x14, 0x1F, 0x2F, 0x97, 0x2F, 0xF5, 0x46, 0xE7, 0xA7, 0x2D, 0x8D, 0x8E, 0xFB,
-    0xC6, 0x6D, 0xDC, 0xD1, 0xF6, 0x22, 0x92, 0xAF, 0xC3, 0x81, 0x9E, 0xB5, 0xA0, 0x51, 0xE5, 0x04,
-    0x01, 0x0B, 0xAD, 0x72, 0x60, 0x83, 0x74, 0xB8, 0xBF, 0xA9, 0x17, 0x04, 0xDC, 0x84, 0xEA, 0x36,
-    0x11, 0xB0, 0x24, 0x1B, 0x02, 0x88, 0x3A, 0xE7, 0x3B, 0x59, 0x4E, 0xB5, 0x13, 0x9D, 0x8C, 0xB7,
-    0xD8, 0x5A, 0x0A, 0x42, 0x0A, 0x6D, 0xCD, 0x46, 0x65, 0xA5, 0xEE, 0x91, 0xD6, 0xDE, 0x16, 0xC4,
-    0x99, 0x24, 0xE6, 0x00, 0x22, 0xD4, 0xCC, 0x16, 0xCC, 0xAC, 0x56, 0x81, 0x3D, 0xA0, 0x63, 0xA8,
-    0x67, 0x25, 0x6E, 0xCD, 0x5A, 0x4E, 0x1D, 0x87, 0xE8, 0x48, 0xD7, 0xB9, 0x9D, 0xB6, 0x76, 0xC5,
-    0x47, 0x79, 0x1F, 0x5D, 0x8B, 0xF7, 0xCB, 0xE5, 0x0D, 0x37, 0xEA, 0x66, 0x9A, 0x72, 0xA2, 0x90,
-    0xD2, 0x21, 0x24, 0x56, 0x67, 0x0E, 0x47, 0x47, 0xE2, 0x43, 0x05, 0xA8, 0x18, 0x22, 0x6D, 0xE1,
-    0xBB, 0x56, 0x15, 0x9A, 0xEA, 0x4A, 0xB2, 0x27, 0x3B, 0xC5, 0x25, 0xB4, 0xA3, 0xA2, 0xED, 0x89,
-    0x16, 0xF2, 0x01, 0x5A, 0xC8, 0x87, 0x46, 0xA7, 0xDA, 0x84, 0x0A, 0xA9, 0xBF, 0x9A, 0x18, 0x12,
-    0x1A, 0x92, 0xEA, 0x77, 0xB5, 0xAA, 0x3E, 0x3E, 0x87, 0xD6, 0xCA, 0xD6, 0xA0, 0x68, 0xE9, 0xDE,
-    0xC2, 0x20, 0x64, 0x4A, 0x86, 0x05, 0x53, 0x53, 0xD8, 0x69, 0xA3, 0xC2, 0xEE, 0x62, 0x6A, 0x6F,
-    0xA4, 0xB0, 0xC5, 0x79, 0x94, 0x99, 0xA3, 0x55, 0x54, 0xA2, 0xC1, 0x4A, 0x54, 0xE4, 0x41, 0x3F,
-    0xB3, 0x55, 0x5A, 0x84, 0xC7, 0xCC, 0x60, 0x68, 0x43, 0x8A, 0x79, 0xE5, 0x62, 0x97, 0x86, 0x54,
-    0x2F, 0x99, 0x22, 0x9F, 0x4B, 0xF5, 0x10, 0x91, 0x48, 0x11, 0xF6, 0xAE, 0xAD, 0x66, 0x32, 0xF7,
-    0xF2, 0x54, 0xBD, 0x68, 0x1C, 0x06, 0x90, 0x03, 0x75, 0x05, 0xDD, 0xC5, 0x49, 0x32, 0x00, 0x85,
-    0x11, 0x8A, 0x50, 0xC8, 0x76, 0xD0, 0x16, 0x9E, 0xBE, 0x5A, 0xDD, 0xB1, 0xBA, 0xF5, 0xB6, 0x75,
-    0xBA, 0xAC, 0x27, 0x4D, 0x47, 0x4A, 0x2B, 0x9C, 0xB3, 0xE0, 0x22, 0xEC, 0xA8, 0x4A, 0x1E, 0x15,
-    0xBE, 0x75, 0xAD, 0x1A, 0x8F, 0xD3, 0xDF, 0x38, 0xCD, 0x5C, 0xF4, 0x13, 0x85, 0x78, 0x33, 0x71,
-    0xA8, 0x21, 0xFA, 0x69, 0xAB, 0x18, 0x3A, 0x6D, 0xD7, 0x6C, 0xA1, 0xF8, 0x85, 0xEE, 0xAC, 0xC1,
-    0x5F, 0x96, 0xC3, 0x25, 0xB4, 0x95, 0xA2, 0x35, 0x8A, 0x16, 0xFA, 0x03, 0x5A, 0x28, 0x01, 0x68,
-    0xD1, 0x02, 0xAD, 0x73, 0x53, 0x28, 0x2A, 0xD0, 0x56, 0xD4, 0x0E, 0x80, 0xF6, 0xCE, 0x78, 0x09,
-    0x6D, 0x71, 0x9D, 0x7E, 0x65, 0x14, 0x6D, 0xA6, 0xAE, 0xC5, 0xC8, 0x45, 0xD3, 0x20, 0xDA, 0x58,
-    0xA3, 0x5D, 0xD4, 0xD0, 0x4B, 0xC2, 0x96, 0x68, 0x71, 0x72, 0x28, 0x86, 0x7E, 0x42, 0xEB, 0x64,
-    0x71, 0xCB, 0xA9, 0x40, 0x26, 0x77, 0x20, 0x72, 0x15, 0xB4, 0xC3, 0xAC, 0x66, 0x05, 0x39, 0x43,
-    0xD0, 0x4E, 0xAF, 0xED, 0xCC, 0xE2, 0x9D, 0x6C, 0xBD, 0x54, 0xA1, 0xA8, 0x87, 0x2B, 0xAB, 0xA6,
-    0xE4, 0xDB, 0x47, 0xCB, 0x33, 0xD2, 0x96, 0xB1, 0x03, 0x72, 0x58, 0xEB, 0xC4, 0xDC, 0x49, 0x12,
-    0xDC, 0x3D, 0xCC, 0xD5, 0xC2, 0xF0, 0xA4, 0x3A, 0x62, 0xDF, 0x71, 0xDD, 0x3A, 0x1A, 0x57, 0x2F,
-    0xDC, 0x01, 0x45, 0x12, 0x2D, 0x4A, 0x35, 0x32, 0x38, 0x1F, 0x35, 0x1D, 0x75, 0x0A, 0x04, 0x71,
-    0xEE, 0xFF, 0x7D, 0xF0, 0xE5, 0xB1, 0x94, 0xD4, 0x1E, 0x90, 0xD5, 0x82, 0xF1, 0x74, 0xA0, 0x71,
-    0x4B, 0x40, 0x6E, 0x73, 0x95, 0x58, 0x6D, 0x9D, 0x4B, 0x41, 0xDA, 0x7D, 0x34, 0x52, 0x79, 0xF1,
-    0x40, 0xA5, 0x26, 0xCC, 0x36, 0x84, 0xED, 0xAE, 0xA4, 0x2A, 0xFA, 0x4C, 0xCD, 0xD1, 0xA8, 0x32,
-    0x8C, 0x1A, 0x65, 0xB1, 0x9E, 0xB2, 0x07, 0xA7, 0x2A, 0x75, 0x09, 0xA7, 0x23, 0x1E, 0x1C, 0x0A,
-    0xE8, 0xD4, 0x39, 0xEC, 0x64, 0xD3, 0x45, 0x79, 0x36, 0x8D, 0x38, 0x7F, 0xA1, 0x67, 0x4A, 0xC3,
-    0xC8, 0x96, 0x68, 0x76, 0x74, 0x9C, 0x68, 0x98, 0x47, 0xA4, 0x59, 0x55, 0xF7, 0x15, 0xA0, 0xBA,
-    0x7F, 0x97, 0x38, 0x53, 0x3A, 0x7B, 0xF8, 0xFD, 0x03, 0x0E, 0x90, 0x1F, 0x46, 0x0A, 0x1F, 0xA1,
-    0xF5, 0x6C, 0x01, 0x09, 0x1A, 0xB3, 0x06, 0x94, 0x5B, 0xDE, 0xD6, 0x1E, 0x39, 0x78, 0xEC, 0xCD,
-    0xF1, 0x74, 0x90, 0x89, 0xD0, 0x62, 0xF3, 0x25, 0x83, 0xE1, 0xC5, 0xC1, 0xA7, 0x4A, 0xBF, 0x39,
-    0x67, 0xA8, 0xE3, 0xF3, 0x6D, 0xDC, 0xF8, 0x69, 0xF0, 0x3B, 0xDD, 0x51, 0x4D, 0x92, 0x84, 0x94,
-    0x00, 0x17, 0x33, 0x20, 0x2A, 0x0E, 0x73, 0x6E, 0x71, 0xEE, 0xB3, 0xB1, 0x73, 0x8B, 0xEF, 0xCE,
-    0x17, 0x17, 0x17, 0x17, 0x5F, 0x39, 0x70, 0x67, 0xFA, 0x3E, 0x67, 0xD1, 0xE4, 0x6B, 0xF9, 0x5E,
-    0xD0, 0xC6, 0x49, 0xB3, 0x9F, 0xFE, 0xDD, 0xFE, 0x21, 0xDB, 0xC4, 0x14, 0x5C, 0xA6, 0x19, 0x55,
-    0x89, 0x60, 0x3A, 0x4A, 0xF6, 0xF9, 0xFB, 0x1B, 0xF3, 0xE7, 0xB6, 0x7A, 0xA5, 0xDC, 0x8F, 0xEA,
-    0x3C, 0x45, 0xDE, 0x87, 0x25, 0x12, 0xB4, 0x9E, 0xC6, 0x33, 0x88, 0xF5, 0x23, 0x5C, 0xB1, 0x3D,
-    0x16, 0x9C, 0x8B, 0xC9, 0xFB, 0x65, 0xF8, 0xD9, 0x5A, 0x86, 0x4E, 0x8C, 0x91, 0xF4, 0x36, 0xB2,
-    0x11, 0x90, 0x8B, 0x41, 0x09, 0x27, 0x61, 0x76, 0x7B, 0xB0, 0x0F, 0x06, 0xE3, 0xD3, 0xA4, 0x37,
-    0xA6, 0xD8, 0xE7, 0x63, 0x59, 0x37, 0x25, 0x97, 0xB1, 0xCB, 0x3A, 0xD5, 0x78, 0x92, 0x7A, 0x3A,
-    0x4F, 0x7D, 0x3C, 0x9E, 0x9D, 0x8D, 0xC7, 0xDE, 0x85, 0x77, 0x6E, 0x90, 0x18, 0x90, 0x2C, 0x18,
-    0xF5, 0xC8, 0x7B, 0x65, 0x55, 0x1C, 0x45, 0x4E, 0x92, 0xA6, 0xE4, 0xC1, 0x62, 0x6A, 0x12, 0xCB,
-    0x6A, 0xA7, 0x23, 0x0A, 0x2C, 0x69, 0x54, 0x01, 0xAD, 0xD1, 0xA0, 0x7C, 0xAC, 0x30, 0x5C, 0x0E,
-    0xDE, 0xAB, 0x55, 0x2A, 0x26, 0xAB, 0xB6, 0x58, 0x29, 0xA6, 0xA2, 0x99, 0x4E, 0x04, 0x33, 0x43,
-    0xB6, 0xE5, 0x2D, 0xED, 0xC5, 0xC8, 0xE6, 0xF1, 0xBA, 0xB0, 0x65, 0xF5, 0xDC, 0x49, 0xF5, 0x4A,
-    0x93, 0xE5, 0xE6, 0xA6, 0x40, 0x18, 0x4D, 0x88, 0x34, 0x17, 0x46, 0x0B, 0x4D, 0x5D, 0xC5, 0x29,
-    0x07, 0xC0, 0x43, 0x17, 0xD8, 0xC3, 0x7B, 0x43, 0x68, 0xFB, 0xC5, 0x80, 0x8C, 0x50, 0xED, 0x48,
-    0x7C, 0x94, 0x0B, 0x98, 0x21, 0x96, 0xB1, 0x85, 0x32, 0xDA, 0xF4, 0xA3, 0x3E, 0x7B, 0xAD, 0x33,
-    0x62, 0x8E, 0xA4, 0xBF, 0xCA, 0xD0, 0x74, 0xB4, 0x87, 0x20, 0x2A, 0xFB, 0x37, 0x29, 0xA4, 0x23,
-    0xBC, 0xD9, 0xC8, 0x91, 0x91, 0x9B, 0x43, 0xD0, 0x65, 0x0F, 0x3A, 0xF3, 0x00, 0x19, 0x5F, 0x83,
-    0xA4, 0x6F, 0x61, 0xF3, 0x85, 0xF5, 0xD4, 0x9E, 0x98, 0x09, 0xEA, 0x7F, 0xDB, 0x56, 0x74, 0xBF,
-    0x1B, 0x95, 0x3B, 0x66, 0x67, 0xED, 0xEC, 0x0C, 0xFF, 0xBE, 0x4C, 0xB6, 0x20, 0x2E, 0xA5, 0x76,
-    0x07, 0x9B, 0x0B, 0xCD, 0x2E, 0x38, 0x78, 0xF9, 0xBB, 0x48, 0x1F, 0xF8, 0x57, 0xF5, 0x74, 0x48,
-    0x2F, 0xC6, 0x59, 0xB9, 0xA2, 0xD1, 0xDC, 0xE7, 0x59, 0xA7, 0x14, 0xDB, 0x39, 0xC5, 0xFC, 0x8B,
-    0x28, 0xFE, 0x93, 0x70, 0x35, 0x94, 0xD8, 0x7F, 0xF8, 0x8C, 0x4B, 0xBB, 0x66, 0x27, 0xB9, 0xDF,
-    0xF6, 0xE6, 0x2B, 0x37, 0xF7, 0x5E, 0xDF, 0x09, 0x7E, 0xD2, 0x27, 0x0F, 0x5A, 0x73, 0x58, 0x8F,
-    0x55, 0xF8, 0xF0, 0xDB, 0xFB, 0xF8, 0xD1, 0xC1, 0x53, 0xAC, 0xEA, 0xAE, 0x4F, 0xC1, 0x34, 0x71,
-    0x21, 0xD9, 0x85, 0x50, 0x95, 0x41, 0xA1, 0xBA, 0x38, 0xD6, 0x73, 0xB5, 0xD7, 0x22, 0xB0, 0x77,
-    0xD1, 0x42, 0x33, 0xDC, 0x96, 0x4E, 0x17, 0x37, 0x5A, 0x36, 0xAE, 0x19, 0x41, 0xDC, 0xE1, 0xAD,
-    0x15, 0x87, 0x3F, 0xD4, 0x2B, 0xFD, 0x1B, 0xB4, 0x02, 0xD5, 0x21, 0xC6, 0x16, 0x64, 0xD6, 0x2C,
-    0x38, 0xD6, 0x91, 0x66, 0xDC, 0x24, 0x82, 0xCA, 0x95, 0x01, 0x94, 0x15, 0x8C, 0x2B, 0xE5, 0xB0,
-    0x46, 0x7D, 0x76, 0xDC, 0xD1, 0x64, 0x4D, 0xB3, 0xB0, 0x91, 0xEF, 0x83, 0xDE, 0xCD, 0xD1, 0xF9,
-    0x1B, 0xFA, 0x7E, 0xD4, 0x2A, 0x80, 0x86, 0x76, 0x90, 0xAC, 0x09, 0x00, 0x33, 0x74, 0x2F, 0x02,
-    0x28, 0xF4, 0xAF, 0xD2, 0x40, 0x30, 0x30, 0xF0, 0x05, 0x2E, 0xB5, 0xD7, 0xC9, 0xA1, 0x2E, 0x8F,
-    0x35, 0xBD, 0x20, 0xC1, 0x85, 0x66, 0xEE, 0xD8, 0x42, 0x01, 0x68, 0xE8, 0x38, 0x56, 0x18, 0x66,
-    0x3C, 0x2B, 0x64, 0x24, 0xED, 0x27, 0xE3, 0x89, 0xDD, 0xE9, 0x7F, 0xC2, 0x5C, 0x0F, 0xC7, 0xE0,
-    0x42, 0x8F, 0xFF, 0xE2, 0xE4, 0x05, 0xBB, 0xC6, 0x78, 0x60, 0x09, 0x26, 0xEC, 0x08, 0x3B, 0xBB,
-    0xBF, 0x21, 0x61, 0x8D, 0xB0, 0xEF, 0x69, 0xD4, 0x66, 0xD2, 0x08, 0x75, 0x90, 0xAF, 0xFF, 0xFE,
-    0xC7, 0x86, 0x62, 0xDB, 0xFA, 0xF1, 0xB7, 0x44, 0xDD, 0x7D, 0x9C, 0xF1, 0xA2, 0xA7, 0xE0, 0xFD,
-    0x5E, 0x6B, 0xA9, 0x35, 0xC3, 0x28, 0x5C, 0x27, 0x6B, 0x91, 0x52, 0x57, 0xBD, 0x30, 0xFF, 0xC9,
-    0x99, 0x20, 0x40, 0x0A, 0xDB, 0x6F, 0xAA, 0xB3, 0xD0, 0xEE, 0x16, 0x0C, 0x94, 0x09, 0xB3, 0xB7,
-    0xEC, 0x5D, 0x35, 0x8F, 0x7D, 0x6A, 0xE9, 0x71, 0xEF, 0xB4, 0x53, 0x33, 0x7E, 0xF7, 0xCD, 0xE0,
-    0x0F, 0x9B, 0x5D, 0xAA, 0xAF, 0xBA, 0xB6, 0x61, 0x71, 0xCE, 0x42, 0x53, 0x39, 0x78, 0x63, 0x16,
-    0x7F, 0xDC, 0xC9, 0xE3, 0x13, 0x19, 0x6D, 0x53, 0x67, 0x15, 0x8D, 0x7C, 0xA3, 0x67, 0x9B, 0x86,
-    0x77, 0x9D, 0xE9, 0x50, 0xD4, 0x33, 0x4F, 0x4D, 0x06, 0xD7, 0x32, 0xEE, 0xC4, 0x3D, 0x4F, 0x0F,
-    0xE7, 0xB5, 0xAE, 0x0A, 0x84, 0x81, 0xD1, 0x8F, 0x4E, 0xE7, 0x30, 0xDF, 0xE9, 0x59, 0xA1, 0xE9,
-    0x91, 0xFE, 0x0D, 0x9E, 0xE0, 0x60, 0xB2, 0xF3, 0x6C, 0xCE, 0xA3, 0xAB, 0x0D, 0x80, 0xF1, 0xCA,
-    0xB5, 0xA1, 0x7A, 0x30, 0x16, 0xF5, 0xF5, 0x73, 0xEB, 0xC2, 0xBE, 0xFA, 0x64, 0xAC, 0xDE, 0xFD,
-    0xF0, 0xDB, 0x46, 0xF8, 0x95, 0xA4, 0xF4, 0xAB, 0x5C, 0x16, 0xD0, 0xDC, 0x81, 0xEC, 0x23, 0x36,
-    0xAF, 0xB3, 0xDF, 0x76, 0xF0, 0xD3, 0x76, 0x0F, 0xD6, 0xD7, 0x49, 0x29, 0xC1, 0x8B, 0xA7, 0x8A,
-    0x84, 0x03, 0xFF, 0x20, 0x82, 0x31, 0xC6, 0xB5, 0xAD, 0xC6, 0x6B, 0x1B, 0x93, 0x67, 0x76, 0x5C,
-    0xD4, 0xB0, 0xDD, 0x12, 0xB9, 0xC8, 0x56, 0x7E, 0x69, 0xEF, 0x67, 0x58, 0x79, 0xFD, 0xCE, 0x9E,
-    0xDE, 0x1C, 0xB9, 0x3C, 0xF5, 0xD2, 0x13, 0x4E, 0x13, 0xEE, 0x71, 0x81, 0xB3, 0x1D, 0x64, 0x05,
-    0x3F, 0x4C, 0x6D, 0x13, 0xBF, 0x67, 0xED, 0xDF, 0xFA, 0x63, 0x84, 0x8C, 0xDB, 0x75, 0x64, 0x9B,
-    0x27, 0x64, 0xFB, 0x43, 0xB9, 0x92, 0xCB, 0xE3, 0xB1, 0xCD, 0x43, 0xA4, 0xA7, 0xF9, 0x50, 0x1C,
-    0xDA, 0xEA, 0x8F, 0xEB, 0xD4, 0x6E, 0x7E, 0x23, 0xD9, 0xA0, 0xA9, 0xA0, 0xDE, 0xA2, 0x3D, 0x77,
-    0x92, 0xCB, 0x93, 0x8E, 0xE8, 0xDB, 0x95, 0x56, 0x6B, 0x4F, 0xAE, 0xDE, 0xBC, 0x8C, 0x50, 0x5E,
-    0xB2, 0xE3, 0xC1, 0x42, 0x13, 0x5C, 0x9D, 0x7B, 0x1F, 0xFA, 0x08, 0x8E, 0xCE, 0x46, 0xA9, 0xB2,
-    0x3D, 0xCD, 0xF2, 0x56, 0xAB, 0xC3, 0x37, 0x39, 0xE3, 0x55, 0x2D, 0x93, 0xB4, 0xA4, 0x6E, 0x5C,
-    0x72, 0x88, 0xB4, 0x8D, 0x1C, 0xB0, 0xE0, 0x1D, 0x39, 0xA3, 0xBC, 0x4A, 0x1B, 0x20, 0x5F, 0xB3,
-    0x02, 0x6B, 0x79, 0xC3, 0x9E, 0x3D, 0x4B, 0x9F, 0x31, 0xCF, 0x9F, 0xE9, 0x22, 0x62, 0x2A, 0xA5,
-    0x2E, 0x3C, 0xD3, 0xA8, 0x4E, 0x3E, 0xD5, 0x49, 0xED, 0xAA, 0x83, 0xAA, 0x83, 0xB6, 0x00, 0x8C,
-    0x21, 0x05, 0x62, 0xA8, 0x36, 0xAE, 0x50, 0x48, 0xE8, 0xAA, 0x45, 0x27, 0x3A, 0xA8, 0xA3, 0x92,
-    0xF1, 0x15, 0xC7, 0xA3, 0xC1, 0xE7, 0xAB, 0xE7, 0x15, 0xF6, 0xEA, 0x69, 0x62, 0x2F, 0x2E, 0x95,
-    0x75, 0x47, 0x7F, 0x35, 0xD1, 0x00, 0x5B, 0x2A, 0x69, 0xD2, 0x58, 0x90, 0x22, 0xCD, 0x16, 0x5F,
-    0xB6, 0x79, 0x07, 0x86, 0xD1, 0x62, 0x40, 0x4C, 0x27, 0x24, 0x08, 0x29, 0xC9, 0x1F, 0x61, 0x12,
-    0xE7, 0x76, 0x70, 0x0F, 0xF7, 0xD9, 0x77, 0x90, 0x50, 0xD9, 0x44, 0xA0, 0x04, 0x2A, 0xF3, 0xEE,
-    0x44, 0xAF, 0x09, 0xC0, 0x09, 0x73, 0x68, 0x32, 0x84, 0x8E, 0x07, 0x31, 0x19, 0x24, 0xAC, 0x14,
-    0x69, 0xAA, 0x5E, 0xCC, 0x5D, 0xEE, 0x43, 0xED, 0x1D, 0x1D, 0x9A, 0x15, 0x4B, 0x2D, 0xDD, 0xAC,
-    0x76, 0xE9, 0xE1, 0x63, 0xA7, 0x76, 0xB8, 0x76, 0xCA, 0x26, 0x80, 0x41, 0x4E, 0x77, 0x3F, 0xEB,
-    0xB7, 0x7D, 0x4F, 0xB2, 0x2F, 0xFB, 0x3E, 0xD3, 0xDE, 0x65, 0x3F, 0x48, 0x66, 0x63, 0xAB, 0x82,
-    0xA2, 0x88, 0x8A, 0x4E, 0xA5, 0x7D, 0xA1, 0x1B, 0xB4, 0x63, 0x95, 0x57, 0xB9, 0xCD, 0xB8, 0x67,
-    0xE0, 0x6F, 0x7E, 0x59, 0x17, 0xCA, 0x54, 0xB1, 0x23, 0xF1, 0xAE, 0xCE, 0x9C, 0xA6, 0x6A, 0xA6,
-    0x28, 0x73, 0xBE, 0x0E, 0x9F, 0xB5, 0x76, 0xD6, 0xCE, 0xDE, 0xEB, 0xE5, 0xEA, 0x69, 0x1D, 0xBE,
-    0xD1, 0x64, 0xAC, 0x99, 0xD7, 0xE1, 0xDC, 0x6A, 0xAE, 0x26, 0x33, 0xBB, 0xFD, 0x9A, 0xDD, 0x0B,
-    0x69, 0x1B, 0xBC, 0x70, 0xB2, 0xF4, 0x37, 0x47, 0xFE, 0x3E, 0x88, 0xAB, 0x93, 0x81, 0x05, 0x54,
-    0xAA, 0x37, 0x1B, 0xBC, 0x56, 0x2D, 0x79, 0x1F, 0x84, 0xD3, 0xAE, 0x52, 0x62, 0x95, 0xD6, 0x80,
-    0x56, 0x4F, 0x0C, 0xBD, 0xA3, 0xC4, 0x1B, 0xDE, 0x99, 0x54, 0x1A, 0xD9, 0x8A, 0x92, 0x4E, 0x64,
-    0xD6, 0xBC, 0xAB, 0x4A, 0x37, 0x74, 0xAC, 0x78, 0x7C, 0xDE, 0xDD, 0x61, 0x70, 0x17, 0x77, 0x57,
-    0x15, 0x54, 0xEE, 0xAE, 0xEA, 0x22, 0x26, 0x5F, 0xEC, 0xB8, 0xEB, 0x89, 0xF6, 0xB2, 0xCF, 0xA4,
-    0xB3, 0xE2, 0xC6, 0xCC, 0x6E, 0x40, 0xEE, 0xAA, 0xB4, 0xFB, 0xB9, 0xB4, 0x87, 0x33, 0x69, 0x47,
-    0x0D, 0xEB, 0x92, 0x98, 0xB9, 0x89, 0xBF, 0x61, 0x49, 0x6B, 0x4A, 0x3B, 0xCB, 0x29, 0x4F, 0x23,
-    0xFE, 0x2E, 0xC6, 0x6A, 0x0A, 0xEE, 0x18, 0x1A, 0x7D, 0x0B, 0x24, 0x90, 0x36, 0x90, 0x44, 0x7A,
-    0xA7, 0x93, 0xF2, 0x96, 0xE7, 0xD1, 0xD2, 0xBE, 0x8C, 0x69, 0x98, 0xB1, 0xD5, 0xCD, 0x99, 0xD8,
-    0x62, 0xB8, 0x38, 0x27, 0xF3, 0x87, 0x67, 0x77, 0x70, 0xEE, 0x94, 0xB9, 0x7C, 0x07, 0x57, 0x5D,
-    0x32, 0x88, 0x2F, 0xBA, 0x83, 0x4B, 0xFD, 0x1D, 0x5C, 0x7E, 0xE9, 0x0E, 0xAE, 0x7A, 0x64, 0x20,
-    0xD2, 0x41, 0x3B, 0x6F, 0x79, 0x67, 0x7C, 0xDE, 0x6E, 0x01, 0xEF, 0x70, 0x7E, 0x7F, 0xF4, 0x35,
-    0xED, 0xB6, 0xBF, 0x64, 0xB7, 0xEB, 0x2F, 0xB3, 0xDB, 0x73, 0x81, 0xB2, 0x9B, 0xB7, 0xEE, 0xE7,
-    0x03, 0xB2, 0xCF, 0x5F, 0x75, 0x60, 0x60, 0xC7, 0xF4, 0x27, 0x53, 0x6A, 0xEA, 0xD2, 0xCB, 0x2E,
-    0x0C, 0x0B, 0xDA, 0xDA, 0x85, 0xB6, 0x11, 0x4E, 0x77, 0x11, 0xD9, 0x11, 0xB6, 0x76, 0x11, 0xD8,
-    0x33, 0xDE, 0xC0, 0x48, 0xB7, 0xA7, 0xDD, 0xFE, 0xBE, 0x76, 0x7B, 0x47, 0xDA, 0x5D, 0x45, 0x77,
-    0x13, 0x5D, 0x35, 0xAF, 0x62, 0xC6, 0x69, 0x8C, 0x9D, 0x5F, 0xE0, 0x96, 0x1F, 0x79, 0x62, 0x9E,
-    0xB4, 0xDF, 0xC8, 0x6F, 0x0B, 0xE5, 0x13, 0x04, 0x54, 0xB2, 0x4B, 0x7E, 0x3D, 0x40, 0x0F, 0x57,
-    0x82, 0x95, 0xB2, 0x79, 0x81, 0x87, 0xA5, 0xE3, 0x41, 0x1C, 0x0F, 0xE2, 0x78, 0x10, 0xC7, 0x83,
-    0x38, 0x1E, 0xC4, 0xF1, 0x20, 0x8E, 0x07, 0x71, 0x3C, 0x88, 0xE3, 0x41, 0x1C, 0x4E, 0x79, 0x14,
-    0x0F, 0xB3, 0x31, 0xBF, 0xC0, 0x2D, 0x3F, 0xF2, 0xC4, 0x3C, 0x69, 0xBF, 0x91, 0xDF, 0x56, 0x0D,
-    0x58, 0x79, 0x10, 0xC7, 0xC3, 0xEA, 0x3F, 0xE7, 0xC1, 0x38, 0x23, 0x29, 0xEA, 0x58, 0x7F, 0x56,
-    0x69, 0x12, 0x44, 0x82, 0xE8, 0xD3, 0x36, 0xA3, 0x2F, 0xD5, 0xE0, 0xA1, 0xC7, 0x06, 0xE0, 0xC1,
-    0xC0, 0xEF, 0xC1, 0x43, 0xF2, 0x4E, 0x2B, 0x57, 0xDF, 0x42, 0x7C, 0xAF, 0xE5, 0xD9, 0xB7, 0xD4,
-    0x80, 0xD0, 0xB1, 0xD2, 0x7C, 0xF6, 0x08, 0x06, 0x5D, 0x93, 0x87, 0xF4, 0x7E, 0x4B, 0x1E, 0x0A,
-    0xAC, 0xDC, 0xDB, 0xC3, 0x2A, 0x23, 0xFB, 0x19, 0x7F, 0xDF, 0xAB, 0xBB, 0xE4, 0xE7, 0xB5, 0x84,
-    0x9F, 0xB6, 0xB1, 0xFE, 0x6C, 0xD4, 0xE8, 0xB6, 0x66, 0xCE, 0xC3, 0xF6, 0xD7, 0xE5, 0xC1, 0xEB,
-    0xC1, 0x38, 0x3D, 0x58, 0xD5, 0x03, 0x36, 0xCA, 0x54, 0x48, 0x9D, 0xCB, 0x26, 0x54, 0x0F, 0xCA,
-    0x03, 0x27, 0x53, 0xD6, 0x89, 0xE3, 0xC1, 0x28, 0x0F, 0xA4, 0x03, 0x1E, 0x48, 0x07, 0x63, 0x2C,
-    0xB6, 0xC0, 0x83, 0x71, 0x7A, 0xE0, 0x16, 0xFB, 0x99, 0x6E, 0xD1, 0x51, 0x3C, 0xD4, 0x83, 0x75,
-    0x7A, 0xE8, 0xBF, 0xBA, 0x1E, 0xB6, 0xA6, 0xB8, 0xA9, 0x55, 0xDC, 0x77, 0xF9, 0x71, 0x6B, 0xF9,
-    0xD3, 0x61, 0xB9, 0xB4, 0x17, 0x9E, 0xF6, 0xA9, 0x6B, 0xBD, 0x7D, 0x7F, 0x40, 0x9A, 0x7C, 0x05,
-    0xB2, 0xE4, 0x8D, 0x9A, 0x71, 0x01, 0x94, 0x59, 0x2B, 0x52, 0x6A, 0xCD, 0x5B, 0xB5, 0x07, 0x63,
-    0x28, 0xC4, 0xA3, 0x6E, 0xCB, 0xA5, 0xD7, 0xF9, 0xBF, 0x00, 0x4D, 0x90, 0xB1, 0x11, 0x83, 0x30,
-    0x10, 0x04, 0x0F, 0x12, 0x02, 0x02, 0x27, 0xCE, 0x95, 0x3A, 0xA3, 0x04, 0xA8, 0xC2, 0xDD, 0x78,
-    0xAC, 0x2E, 0x5C, 0x83, 0x9B, 0x30, 0x94, 0x80, 0x3B, 0x50, 0xEE, 0xC4, 0x01, 0x01, 0x01, 0xD2,
-    0xF9, 0x4F, 0x82, 0x19, 0x2B, 0x78, 0xED, 0xCC, 0xAF, 0x4E, 0xD2, 0x03, 0x7F, 0xEB, 0x72, 0xC0,
-    0x6B, 0xDF, 0x6B, 0xFA, 0x02, 0x2D, 0x43, 0x81, 0x8E, 0xEB, 0xAE, 0x5C, 0x53, 0x51, 0x02, 0xBA,
-    0x2C, 0xB5, 0x13, 0x9A, 0x2C, 0x75, 0x13, 0xAA, 0x2C, 0x8D, 0xEF, 0x67, 0x4E, 0xAA, 0x49, 0xCE,
-    0xBD, 0x57, 0x0A, 0xF9, 0xED, 0x82, 0x52, 0xC8, 0xD5, 0x99, 0x34, 0x1A, 0x6C, 0xA7, 0x94, 0x15,
-    0x03, 0x7A, 0x29, 0x5C, 0x1C, 0x83, 0x94, 0x34, 0x38, 0xAE, 0x77, 0x03, 0x8F, 0x9E, 0xD1, 0x51,
-    0x77, 0x5B, 0xB7, 0x11, 0x58, 0x99, 0x2B, 0x81, 0x45, 0x0C, 0xB8, 0x73, 0xB3, 0x93, 0x11, 0x70,
-    0x4A, 0xE1, 0x02, 0xEB, 0x47, 0x83, 0x19, 0xA8, 0x98, 0x9C, 0x14, 0x40, 0x49, 0x51, 0x0F, 0x73,
-    0xFC, 0x48, 0x91, 0x04, 0x29, 0x26, 0x25, 0x64, 0xC5, 0x24, 0xC4, 0xF2, 0x41, 0xF7, 0x58, 0x0A,
-    0x34, 0x45, 0x51, 0xD2, 0xB0, 0xCF, 0xE5, 0x76, 0x0C, 0xEA, 0xAC, 0xF2, 0x03,
+static const uint8_t bookerly_18_regularBitmaps[39569] = {
+    0xDD, 0x9C, 0xBD, 0xB3, 0xEF, 0xC6, 0x7D, 0xDE, 0x3F, 0xC0, 0xF2, 0x1C, 0xC4, 0xC4, 0xC4, 0xAB,
+    0x42, 0xD7, 0x71, 0x78, 0x27, 0x41, 0xE3, 0xC2, 0x71, 0x1C, 0xE1, 0x1F, 0x90, 0xB9, 0xA0, 0x6E,
+    0xC1, 0x42, 0x05, 0x4F, 0x66, 0xEE, 0x4F, 0x1E, 0x93, 0x85, 0x54, 0xD8, 0x33, 0x96, 0x34, 0x93,
+    0x93, 0x22, 0x85, 0x0A, 0x92, 0x80, 0xCC, 0x82, 0x85, 0x0B, 0xDE, 0xCC, 0xD0, 0x69, 0x32, 0xE3,
+    0x51, 0x41, 0xCF, 0x98, 0x87, 0xE3, 0xDC, 0x14, 0x29, 0x54, 0x5C, 0x5E, 0xAC, 0xC8, 0x82, 0x85,
+    0x0A, 0x42, 0x66, 0x66, 0x54, 0xA4, 0x10, 0x14, 0x5E, 0x45, 0xD6, 0x65, 0xA1, 0x95, 0x04, 0x89,
+    0x38, 0x97, 0x0B, 0x3C, 0x29, 0x16, 0xBF, 0x73, 0xCE, 0x7D, 0xA1, 0xDE, 0x48, 0x5A, 0x2F, 0x38,
+    0x98, 0x03, 0xEC, 0x02, 0x3F, 0x60, 0x5F, 0xBF, 0xFB, 0xEC, 0xF3, 0x7D, 0x16, 0x07, 0x57, 0xE6,
+    0xFE, 0x89, 0x49, 0x36, 0xA4, 0x7D, 0xB5, 0xE3, 0xCD, 0x72, 0xBC, 0x59, 0x8E, 0xCF, 0x16, 0xE3,
+    0xB3, 0x66, 0x7C, 0x34, 0x03, 0x78, 0xC8, 0xC4, 0xFE, 0xCD, 0xD8, 0x7F, 0xED, 0x1A, 0x50, 0x35,
+    0x37, 0xDC, 0x63, 0xD1, 0x7D, 0x2A, 0xBA, 0x4F, 0x45, 0x97, 0x45, 0x97, 0xCD, 0x67, 0x7B, 0xCD,
+    0xF4, 0x09, 0x26, 0xCE, 0x37, 0xC7, 0xA3, 0xC0, 0xA3, 0xFC, 0x09, 0xF0, 0x0C, 0x4F, 0x03, 0x37,
+    0xB8, 0x01, 0x44, 0x66, 0xB2, 0xDD, 0xE9, 0xEE, 0xF4, 0xAA, 0x91, 0xA4, 0x58, 0x48, 0xD2, 0x8C,
+    0x09, 0x66, 0x04, 0x33, 0x9A, 0x01, 0x8A, 0xA1, 0xF0, 0x50, 0xF8, 0xD2, 0x43, 0xE9, 0x6D, 0x07,
+    0xB6, 0xB3, 0x0D, 0x7F, 0x74, 0xFD, 0x76, 0x7F, 0xBB, 0x73, 0x92, 0xE4, 0xFF, 0xA8, 0x3F, 0xE9,
+    0x4F, 0x1A, 0x1E, 0xE5, 0x51, 0xE0, 0x4F, 0x78, 0x06, 0x78, 0x9A, 0x1B, 0xC0, 0x0D, 0x22, 0x30,
+    0x33, 0x03, 0x5F, 0xE1, 0x2B, 0xFB, 0xD4, 0x18, 0x0F, 0x3C, 0x0D, 0x14, 0x17, 0x4F, 0x0E, 0x35,
+    0x52, 0x48, 0x63, 0xAE, 0x55, 0x5D, 0xFB, 0xFC, 0xEB, 0xD1, 0x8E, 0x5F, 0xB2, 0x43, 0x2C, 0xBA,
+    0x1B, 0x95, 0xFF, 0x52, 0xF9, 0xE5, 0x58, 0x76, 0xD8, 0xF1, 0xAB, 0xA0, 0xBF, 0xEE, 0x30, 0x9A,
+    0xA0, 0xD2, 0x00, 0xB5, 0x46, 0xA8, 0xE4, 0xE1, 0x3D, 0x81, 0x2D, 0xE3, 0x43, 0x84, 0xFA, 0xB5,
+    0xC1, 0xB2, 0x3C, 0x4A, 0xB0, 0xDF, 0x0C, 0x96, 0xD8, 0x37, 0xA1, 0x7E, 0x63, 0xB1, 0xC5, 0xE4,
+    0xEE, 0xBC, 0xB7, 0x22, 0xA9, 0xC9, 0x7A, 0x35, 0x50, 0x03, 0x79, 0xE0, 0x9E, 0x13, 0x13, 0x80,
+    0x47, 0x2F, 0x94, 0x1D, 0x19, 0x90, 0x35, 0xC0, 0x04, 0x56, 0x0D, 0xBC, 0x0A, 0x95, 0x66, 0x78,
+    0x16, 0xEC, 0xD0, 0x83, 0x83, 0x72, 0x28, 0x47, 0xAA, 0x0E, 0x13, 0x88, 0x58, 0x4F, 0x36, 0xE3,
+    0x28, 0x07, 0xB8, 0x89, 0x1D, 0xCC, 0x08, 0x75, 0x63, 0xA6, 0x3C, 0x40, 0x39, 0xB0, 0x30, 0x41,
+    0x3E, 0xE3, 0xB8, 0x01, 0xDC, 0xC4, 0xFA, 0xA7, 0xF9, 0x42, 0x53, 0xF9, 0x72, 0x7C, 0x34, 0x53,
+    0x34, 0xB3, 0x09, 0x55, 0x26, 0xF9, 0xF6, 0x9D, 0xC9, 0x36, 0x8B, 0x99, 0x0B, 0x4D, 0xA5, 0x7F,
+    0x95, 0x96, 0x7A, 0x2C, 0x06, 0x87, 0x1D, 0xC0, 0x8C, 0x95, 0xCF, 0x27, 0xC8, 0x42, 0x31, 0x72,
+    0x13, 0x98, 0xF3, 0x99, 0xBA, 0x83, 0x1B, 0xDC, 0xA4, 0x1C, 0xE0, 0x19, 0x2A, 0x6F, 0x26, 0x70,
+    0x14, 0x81, 0x08, 0x75, 0xC3, 0xC2, 0xB3, 0x60, 0x3D, 0xB5, 0x6F, 0xC1, 0x7A, 0x8C, 0xD4, 0x50,
+    0x8C, 0x50, 0xAB, 0x49, 0xB9, 0xFF, 0x0B, 0xE0, 0xE3, 0xFB, 0x4C, 0x1F, 0x1E, 0x01, 0x64, 0x5A,
+    0x01, 0x4A, 0xA9, 0x03, 0xAA, 0xC1, 0x79, 0xC0, 0x35, 0xD6, 0x03, 0x2D, 0x76, 0x00, 0x7A, 0xAC,
+    0xBF, 0x78, 0xA8, 0x1B, 0xA0, 0xE7, 0x59, 0x80, 0xF6, 0xB1, 0x19, 0xC0, 0x75, 0x23, 0x80, 0xF3,
+    0xE9, 0x91, 0x63, 0x26, 0x75, 0x85, 0x42, 0x2E, 0x75, 0xD5, 0x77, 0x63, 0x76, 0xFD, 0x76, 0xE3,
+    0x5E, 0x5B, 0x29, 0x07, 0x5A, 0xD4, 0x94, 0x03, 0x3D, 0x6E, 0x28, 0x06, 0x84, 0x9D, 0x8A, 0x81,
+    0x95, 0x62, 0x2D, 0x07, 0x04, 0x7A, 0xD3, 0x23, 0x70, 0xF2, 0xB4, 0x1D, 0xA5, 0x3A, 0xDC, 0x48,
+    0xAE, 0x89, 0x6A, 0x6D, 0x8E, 0xA5, 0x6B, 0x85, 0xA4, 0xEF, 0x6A, 0xA5, 0xD7, 0xCA, 0x71, 0x24,
+    0xFB, 0x7C, 0x43, 0x76, 0x8D, 0xE2, 0xAD, 0x69, 0x71, 0x4F, 0xBC, 0x1E, 0xA2, 0xB3, 0xAF, 0x85,
+    0xAF, 0x6E, 0xD9, 0xFB, 0x24, 0x2C, 0x98, 0x99, 0x72, 0xA4, 0xF2, 0x38, 0x58, 0xC9, 0x22, 0x66,
+    0xA6, 0x08, 0x94, 0x23, 0x76, 0xA0, 0xF2, 0xD4, 0x1E, 0xD7, 0xE1, 0x3A, 0x5C, 0x73, 0x61, 0x4F,
+    0x31, 0x9E, 0xDA, 0x53, 0x0D, 0xD8, 0x11, 0x1B, 0x28, 0x26, 0x4C, 0x24, 0x5B, 0x41, 0xE0, 0x3C,
+    0xD5, 0x48, 0x39, 0x93, 0xAF, 0xF0, 0xCC, 0x59, 0x93, 0x37, 0x11, 0x5C, 0x3A, 0xB4, 0x9E, 0x72,
+    0x06, 0x41, 0x35, 0xA6, 0x88, 0x0E, 0x1B, 0xC8, 0x23, 0xB8, 0x0E, 0x9B, 0xE2, 0x7A, 0xA8, 0x3D,
+    0x65, 0x8A, 0xDE, 0x02, 0x23, 0x66, 0x82, 0x05, 0x5A, 0xA8, 0x3B, 0xEC, 0x40, 0x19, 0x30, 0x13,
+    0x79, 0x84, 0x08, 0x2B, 0xF4, 0xD0, 0x42, 0x0B, 0x55, 0x6A, 0xB8, 0x1C, 0x80, 0x99, 0x8C, 0x8F,
+    0x79, 0x7C, 0x86, 0xFE, 0x6F, 0xC9, 0xF5, 0x45, 0x6F, 0x15, 0xEA, 0x9F, 0xC4, 0xFE, 0x6F, 0xB3,
+    0xFA, 0x0D, 0x6F, 0xBE, 0x36, 0x83, 0x83, 0x87, 0xF7, 0x15, 0xFF, 0x2A, 0x50, 0x37, 0x50, 0x0E,
+    0x90, 0x4F, 0x77, 0x47, 0x38, 0x49, 0x2F, 0x48, 0xFA, 0xF6, 0xAE, 0xFD, 0x9B, 0xAB, 0x0F, 0xBC,
+    0x23, 0x45, 0x00, 0x7C, 0xAE, 0x88, 0x66, 0x31, 0x8B, 0x89, 0x66, 0x2E, 0x26, 0x1B, 0xAC, 0x77,
+    0xDD, 0xB3, 0x7C, 0x89, 0x4B, 0xBB, 0xA6, 0xD5, 0xDA, 0x6A, 0x75, 0x5A, 0x0E, 0xAE, 0x2C, 0xED,
+    0xBB, 0x72, 0xC3, 0x11, 0x70, 0x09, 0xA8, 0x3C, 0xA9, 0x79, 0x07, 0xC8, 0x67, 0x20, 0x02, 0xCF,
+    0x02, 0xAE, 0x79, 0x9F, 0x8B, 0x37, 0x01, 0x77, 0xE1, 0x97, 0x45, 0xD8, 0x52, 0xF0, 0x7E, 0x17,
+    0xCD, 0xBD, 0x17, 0x1F, 0xE9, 0xCE, 0xFA, 0x38, 0xBD, 0x1A, 0x32, 0x29, 0x92, 0x4B, 0xF2, 0x99,
+    0x9A, 0x2A, 0x22, 0x50, 0xD3, 0x37, 0xD4, 0xC1, 0x79, 0x4C, 0xAC, 0x46, 0xE8, 0x3F, 0x3D, 0x41,
+    0xF5, 0x76, 0x84, 0x22, 0x0A, 0x90, 0xF3, 0xE0, 0xDE, 0x0C, 0x60, 0xDF, 0x8D, 0x60, 0x96, 0xB3,
+    0xC8, 0xF6, 0xCD, 0xB0, 0xDD, 0x59, 0x4E, 0x6A, 0x30, 0xB1, 0x1E, 0x41, 0x45, 0x84, 0xBE, 0x51,
+    0x87, 0xF3, 0xD5, 0x4C, 0x3B, 0xE4, 0xBA, 0xAD, 0x81, 0x5A, 0x1A, 0xC8, 0xA4, 0x0E, 0xB2, 0xBF,
+    0xD8, 0x77, 0xC2, 0x81, 0x5C, 0xDD, 0xA1, 0x56, 0x9C, 0x66, 0xA4, 0x11, 0xDA, 0x8E, 0x6C, 0x85,
+    0x62, 0x86, 0xEA, 0x97, 0x0B, 0x66, 0xBD, 0x6E, 0xB5, 0xD2, 0x0F, 0x25, 0xF9, 0xD4, 0xE1, 0x5B,
+    0x0D, 0x54, 0xD2, 0x98, 0xE9, 0xB6, 0x06, 0x1B, 0x90, 0xEF, 0x41, 0x57, 0x66, 0xCC, 0x62, 0x07,
+    0xCA, 0xB9, 0x6E, 0xA8, 0x87, 0x87, 0x40, 0x0D, 0x98, 0x08, 0xD4, 0x23, 0x20, 0xC0, 0x4E, 0x80,
+    0x3A, 0x28, 0x67, 0xA0, 0xEF, 0xA0, 0x8C, 0xFB, 0x93, 0xB3, 0x98, 0x09, 0xE8, 0x1B, 0xB0, 0xEB,
+    0xC9, 0xC9, 0xCB, 0x4E, 0x52, 0xEC, 0x25, 0x7D, 0x5B, 0x92, 0x80, 0x23, 0xA8, 0x34, 0xD2, 0x4A,
+    0x4D, 0x7F, 0xA7, 0x0F, 0xED, 0x60, 0x96, 0xDA, 0xD3, 0x3E, 0xE7, 0xB1, 0xE3, 0xC7, 0x30, 0x33,
+    0x64, 0x4B, 0x7A, 0x5B, 0xA6, 0x86, 0x5C, 0x0D, 0x95, 0x1A, 0x9C, 0x22, 0x56, 0xF2, 0x34, 0x55,
+    0x24, 0xA5, 0xAC, 0x1E, 0xD3, 0x4B, 0xF3, 0x65, 0x8B, 0xE8, 0x3D, 0xF4, 0x03, 0x99, 0xC6, 0x83,
+    0x63, 0x8D, 0xB5, 0x34, 0x18, 0xA9, 0xE1, 0x91, 0x17, 0xCF, 0x4D, 0x7B, 0x3D, 0x00, 0xF5, 0x04,
+    0x54, 0x0B, 0x9B, 0x75, 0xB7, 0x1A, 0xA0, 0x7C, 0x6F, 0x82, 0xE2, 0x74, 0x01, 0x13, 0xDB, 0x86,
+    0x3C, 0x56, 0x03, 0xD9, 0x52, 0x4C, 0xB0, 0x66, 0x0B, 0x88, 0xB6, 0xA1, 0xA7, 0x1A, 0x68, 0x9B,
+    0x62, 0xC2, 0x75, 0xD9, 0x42, 0xED, 0x69, 0x9B, 0xEA, 0x3B, 0xBB, 0xE3, 0xEF, 0x3C, 0x2E, 0x49,
+    0xB3, 0x24, 0xAD, 0x95, 0x24, 0x75, 0x50, 0x0D, 0x40, 0x31, 0xB1, 0xE5, 0x86, 0xB6, 0xE1, 0x62,
+    0x24, 0x7F, 0x0F, 0xAD, 0x34, 0x96, 0xD2, 0x4A, 0x2F, 0x8D, 0x76, 0x04, 0x56, 0x52, 0xC3, 0x65,
+    0xD9, 0x9F, 0xAC, 0x0D, 0x54, 0xBA, 0x45, 0x26, 0x05, 0x2A, 0x69, 0xE0, 0x52, 0x2F, 0xA0, 0x9D,
+    0x49, 0xF9, 0x35, 0x0B, 0xE0, 0x86, 0xFD, 0x89, 0x87, 0x22, 0x6E, 0x55, 0xE4, 0x02, 0xD4, 0x0B,
+    0x97, 0x7A, 0x35, 0x4E, 0xF2, 0x99, 0xD4, 0x91, 0xFD, 0x5D, 0x2A, 0x87, 0x03, 0xE0, 0xB2, 0x3C,
+    0x46, 0xEA, 0xE8, 0xD7, 0x86, 0x52, 0x0D, 0x68, 0xD8, 0xEA, 0xB3, 0xDD, 0x3F, 0xB9, 0x1A, 0x01,
+    0x65, 0x60, 0xA4, 0x53, 0x6A, 0x69, 0x45, 0xB7, 0x7B, 0x99, 0x48, 0xB9, 0xDA, 0x40, 0x19, 0x9D,
+    0xC7, 0x4E, 0x82, 0xFA, 0xED, 0x08, 0xED, 0x0B, 0x81, 0x6C, 0xAD, 0x47, 0x8A, 0xB9, 0xF5, 0xD4,
+    0x83, 0x3A, 0x94, 0xAB, 0x29, 0x67, 0xA3, 0xFF, 0x27, 0x6F, 0xB6, 0x9E, 0xD6, 0xC0, 0x93, 0x0D,
+    0xB5, 0xA4, 0x51, 0x92, 0xDE, 0x92, 0xA4, 0x27, 0x6E, 0x9F, 0xBC, 0x12, 0x1D, 0xD4, 0x43, 0x84,
+    0xD5, 0x0C, 0xD8, 0x50, 0xA6, 0x42, 0x4B, 0xED, 0xCF, 0x6F, 0xA5, 0x53, 0x06, 0xA0, 0xED, 0xB6,
+    0xE8, 0x6A, 0xDF, 0x2C, 0xCD, 0xBC, 0xAF, 0x5B, 0x91, 0x9A, 0xFF, 0x79, 0xC8, 0xCC, 0xFB, 0x3B,
+    0xDB, 0x66, 0xB3, 0x05, 0x7C, 0x0E, 0x36, 0x13, 0x54, 0x27, 0x10, 0x12, 0x68, 0x6F, 0xF7, 0xC1,
+    0x44, 0xDC, 0x58, 0x0D, 0x38, 0xDF, 0x83, 0x4C, 0xC4, 0x44, 0x1B, 0xB0, 0x63, 0x15, 0xE8, 0x71,
+    0x53, 0x39, 0xE1, 0x4E, 0xD5, 0xE0, 0x14, 0xC0, 0xA9, 0xC3, 0x48, 0x03, 0xED, 0x6B, 0x1A, 0x8B,
+    0x19, 0x8D, 0xCE, 0xD3, 0xBF, 0xB6, 0x80, 0x5E, 0x08, 0x64, 0xAB, 0xF3, 0x98, 0x59, 0x50, 0xBD,
+    0xBD, 0x40, 0x5F, 0x2C, 0x94, 0xB3, 0xD5, 0x67, 0xE4, 0xAD, 0x14, 0x29, 0xA4, 0x06, 0x3E, 0xDF,
+    0xA4, 0xEE, 0x40, 0xAF, 0x86, 0x4A, 0xF2, 0x99, 0xBE, 0x2F, 0x6F, 0xA7, 0x5C, 0xBE, 0x6F, 0x32,
+    0x5D, 0x89, 0x98, 0xD5, 0x8E, 0x14, 0xB1, 0xED, 0xB0, 0x3F, 0x58, 0xC1, 0x7D, 0x33, 0x42, 0xFF,
+    0x44, 0x20, 0x5F, 0xDC, 0x48, 0x39, 0xB5, 0x23, 0xCE, 0xF7, 0xA7, 0x9F, 0x11, 0xBD, 0x14, 0x69,
+    0xA5, 0x91, 0x83, 0x9D, 0xD8, 0x1A, 0x81, 0x1B, 0x20, 0x17, 0x50, 0x07, 0x30, 0x6A, 0xA0, 0x9F,
+    0xE0, 0x58, 0x20, 0x8D, 0x18, 0xCD, 0x9B, 0xE5, 0xB9, 0xFC, 0xDC, 0xDA, 0xBE, 0xBB, 0xA6, 0xD1,
+    0xFA, 0x6C, 0x3B, 0xB3, 0xD5, 0xF9, 0x54, 0x46, 0xBB, 0xD8, 0x58, 0xCC, 0xDC, 0xBF, 0xBD, 0x8F,
+    0xD1, 0xDF, 0xB6, 0xA2, 0x83, 0x2A, 0x40, 0x1B, 0xC9, 0x34, 0x51, 0xA8, 0xA3, 0x5A, 0x53, 0xE3,
+    0x75, 0x23, 0xD8, 0x85, 0x94, 0xA4, 0x5C, 0x03, 0xA9, 0x05, 0xB6, 0x0B, 0x64, 0x9A, 0xA0, 0x58,
+    0x80, 0x0A, 0x80, 0x3F, 0x3A, 0x39, 0x39, 0x79, 0x42, 0xD2, 0xDB, 0x92, 0xEE, 0x4F, 0x83, 0xA4,
+    0x75, 0x3F, 0x4C, 0x8D, 0x00, 0xA6, 0x83, 0x7C, 0xDD, 0x9E, 0x5C, 0x68, 0x80, 0xEA, 0xFC, 0xC9,
+    0x01, 0x8A, 0x7D, 0xDF, 0xE8, 0x27, 0x72, 0x0D, 0x94, 0x6A, 0xA8, 0x97, 0xF4, 0xD6, 0x7E, 0x00,
+    0xDB, 0x6C, 0xA3, 0x43, 0xF6, 0x22, 0x99, 0x66, 0x9C, 0x26, 0x23, 0x0D, 0x9F, 0xF8, 0x53, 0xA5,
+    0x96, 0x65, 0x3D, 0xDC, 0x4C, 0xC3, 0x92, 0x83, 0x22, 0x90, 0xAD, 0x14, 0x1A, 0x6A, 0xCD, 0x85,
+    0x56, 0xDA, 0x15, 0xB3, 0x80, 0x4B, 0x00, 0xB3, 0x02, 0x9A, 0x8B, 0xB8, 0x32, 0x5B, 0xC1, 0x05,
+    0x8C, 0x52, 0xA5, 0xFC, 0x79, 0xB2, 0xFA, 0xFD, 0xF7, 0x92, 0x71, 0x92, 0xD6, 0x26, 0x1D, 0x25,
+    0xA0, 0x5A, 0x1B, 0x8E, 0x17, 0x28, 0xD7, 0x54, 0x87, 0xB9, 0x48, 0x7D, 0xB3, 0xED, 0x80, 0x6C,
+    0xC5, 0x8E, 0x00, 0x45, 0x30, 0x91, 0x43, 0x75, 0xB8, 0xAE, 0x6D, 0x8C, 0x44, 0x1E, 0x6D, 0xC8,
+    0xD6, 0xA7, 0x26, 0xAC, 0x5F, 0x70, 0x8D, 0xEB, 0x58, 0x2A, 0x9F, 0x87, 0x3C, 0x62, 0xFF, 0x31,
+    0x72, 0x40, 0xE5, 0x59, 0x5C, 0x07, 0x59, 0xC4, 0xBE, 0x35, 0xC1, 0x23, 0xF2, 0x2C, 0xAE, 0xA1,
+    0x56, 0xC4, 0xBE, 0x3E, 0x61, 0x4F, 0x8F, 0x7D, 0x16, 0x5D, 0x63, 0xA6, 0x2C, 0x52, 0x5F, 0x99,
+    0x70, 0x54, 0xBE, 0x08, 0xAE, 0x2B, 0x42, 0x1E, 0x59, 0x4C, 0xC4, 0x75, 0xFD, 0x8F, 0xFB, 0xAE,
+    0xF6, 0x46, 0xEA, 0x35, 0x66, 0x2B, 0x56, 0xCF, 0x69, 0xC2, 0x06, 0x1E, 0xE9, 0xB2, 0xA3, 0xD4,
+    0x43, 0x01, 0xCC, 0xBA, 0x65, 0xDD, 0xEE, 0x2B, 0xCE, 0x4D, 0xC0, 0xEF, 0x02, 0x3A, 0x85, 0xE3,
+    0x00, 0xB9, 0x24, 0x2D, 0xA4, 0x93, 0x15, 0x20, 0x3B, 0xD6, 0xAD, 0xBB, 0xEB, 0xF8, 0x30, 0x1D,
+    0xB6, 0xA7, 0x6A, 0x83, 0x95, 0x03, 0x80, 0xD9, 0x2A, 0x5D, 0x01, 0xA0, 0xFC, 0xE6, 0x04, 0x60,
+    0x5F, 0x8F, 0x00, 0xD5, 0x73, 0x11, 0xC0, 0x6D, 0x16, 0x18, 0x25, 0xB8, 0x23, 0x80, 0x48, 0xDB,
+    0x25, 0x50, 0xEE, 0xC1, 0x4C, 0xD4, 0x09, 0x2F, 0x54, 0x23, 0x58, 0x49, 0x21, 0x1D, 0x26, 0xA8,
+    0x6F, 0x9F, 0xBC, 0x12, 0xC1, 0x35, 0x09, 0xB7, 0xA5, 0xB6, 0xB5, 0x42, 0x26, 0xB2, 0x34, 0x12,
+    0xE5, 0x69, 0x04, 0x2C, 0x96, 0x86, 0x5C, 0xB7, 0x7A, 0x05, 0x9C, 0x24, 0x05, 0x5A, 0x29, 0x7B,
+    0xB2, 0x7F, 0x89, 0x42, 0xD2, 0x4C, 0x2B, 0x29, 0x50, 0x85, 0x5C, 0x1D, 0xA2, 0x88, 0xD8, 0x40,
+    0x3D, 0x20, 0xB2, 0x05, 0x1B, 0xB0, 0xE7, 0xA7, 0x95, 0x47, 0x98, 0x19, 0x1B, 0xE8, 0x41, 0x92,
+    0xC7, 0x4A, 0xEA, 0xD0, 0x49, 0xBF, 0x62, 0x03, 0xF5, 0x84, 0xA0, 0xF7, 0x36, 0x60, 0x22, 0x82,
+    0xDA, 0x27, 0x34, 0x29, 0x70, 0xE7, 0xB1, 0xEA, 0x6C, 0xA0, 0x0D, 0x87, 0x3A, 0xE9, 0x17, 0x23,
+    0x49, 0xB4, 0x5B, 0x11, 0xA7, 0x52, 0xBD, 0xF9, 0x22, 0x94, 0xD2, 0x44, 0x29, 0xA9, 0xCB, 0xF5,
+    0x37, 0xC7, 0x33, 0xBD, 0xC7, 0x75, 0xD5, 0x48, 0x3E, 0x9B, 0x08, 0x55, 0xD7, 0x37, 0x30, 0xD9,
+    0x00, 0xBF, 0x93, 0xAD, 0x67, 0x03, 0xA8, 0x89, 0x67, 0xF0, 0xFE, 0x7D, 0x4E, 0x17, 0x48, 0x7D,
+    0x7C, 0x6B, 0xB4, 0xD5, 0x0C, 0x69, 0x7C, 0x49, 0xFD, 0x8F, 0x5A, 0xD7, 0xF8, 0x4F, 0xF4, 0x92,
+    0x86, 0x4C, 0xDB, 0xC0, 0xB0, 0x00, 0x4F, 0xBE, 0x48, 0xF6, 0x64, 0xFF, 0x32, 0x14, 0x92, 0xD4,
+    0xD0, 0xA6, 0x43, 0x15, 0x0E, 0xFA, 0x04, 0xB6, 0xDB, 0x19, 0x1B, 0xA0, 0x1F, 0x11, 0xE4, 0xC2,
+    0x06, 0xB0, 0x33, 0x62, 0x2B, 0x90, 0x2D, 0xEF, 0xB8, 0xC1, 0x06, 0xC8, 0x57, 0x04, 0xD4, 0xE3,
+    0xFB, 0x05, 0xD2, 0x6D, 0xDB, 0x6F, 0x5A, 0x6F, 0x03, 0x94, 0x53, 0x02, 0x1F, 0xD8, 0x00, 0x6E,
+    0x40, 0x50, 0x4D, 0xD8, 0x40, 0xB5, 0x72, 0xA8, 0xDB, 0x52, 0x63, 0xCE, 0xD2, 0xB6, 0x9E, 0xF5,
+    0xEE, 0x4B, 0xBB, 0xDD, 0x6E, 0x97, 0xA6, 0xD3, 0xAD, 0x24, 0x75, 0xD5, 0x9D, 0x93, 0x57, 0x66,
+    0x04, 0x55, 0x67, 0x03, 0xCC, 0x08, 0x6C, 0x63, 0x03, 0x1C, 0xA5, 0x26, 0x68, 0x03, 0xDB, 0x10,
+    0xB5, 0x3F, 0xBD, 0xAE, 0x09, 0x2B, 0xA9, 0x41, 0x52, 0x78, 0xC0, 0x0D, 0xFB, 0xD3, 0x8F, 0x23,
+    0x30, 0x83, 0x0D, 0xF0, 0x0C, 0x82, 0x72, 0xB0, 0x01, 0x96, 0x43, 0x49, 0x7A, 0x5D, 0x92, 0x62,
+    0x4A, 0xC3, 0xA5, 0xDD, 0x6E, 0x77, 0xB5, 0x95, 0xB4, 0xB4, 0x92, 0x96, 0x4C, 0x27, 0xAF, 0x2C,
+    0x68, 0xEB, 0x04, 0xCF, 0x20, 0xF8, 0x24, 0x82, 0x3F, 0x48, 0x4F, 0xBE, 0xF7, 0xDF, 0x6E, 0x77,
+    0x0D, 0x49, 0xE3, 0xF6, 0xEF, 0xE4, 0xA4, 0x7B, 0xF0, 0x7D, 0xF7, 0xFF, 0x3B, 0xD4, 0xF7, 0xC0,
+    0x6D, 0x65, 0x04, 0x90, 0x5D, 0xFF, 0x5E, 0x03, 0x95, 0xB4, 0x82, 0x93, 0xE4, 0x69, 0x4F, 0x77,
+    0xC7, 0x81, 0x76, 0x24, 0x8F, 0xB4, 0x1E, 0x5A, 0x9C, 0x07, 0xDB, 0xD5, 0xC3, 0x3E, 0x67, 0x1C,
+    0xA5, 0x21, 0x27, 0x5F, 0x38, 0x7B, 0xF8, 0x36, 0xA7, 0x4C, 0xC5, 0x61, 0x22, 0x5C, 0xDA, 0x5D,
+    0x15, 0xD4, 0x92, 0xF3, 0x94, 0xD2, 0x13, 0x13, 0x1C, 0xF4, 0xCF, 0xAD, 0x40, 0x35, 0xF4, 0x1E,
+    0x8A, 0xA9, 0x9A, 0x20, 0x5B, 0x8C, 0x1A, 0x68, 0x9B, 0x76, 0x82, 0x6A, 0x28, 0x35, 0x50, 0x4E,
+    0xF4, 0xBA, 0xA3, 0x65, 0xDF, 0xD0, 0x52, 0xDA, 0xB8, 0xF4, 0x77, 0x0D, 0x97, 0x76, 0x57, 0xC9,
+    0x76, 0xBB, 0xC7, 0xA5, 0x81, 0x5E, 0xB1, 0xD5, 0x4C, 0x29, 0x35, 0xD5, 0x04, 0x87, 0x4A, 0x09,
+    0xA9, 0x46, 0x6C, 0x60, 0x3F, 0x01, 0xFC, 0x05, 0x82, 0x92, 0x34, 0x62, 0x95, 0x8C, 0xDD, 0x3E,
+    0xF8, 0x4B, 0x3D, 0xEA, 0xAE, 0xE0, 0xA1, 0x5E, 0x82, 0xF6, 0xCE, 0x15, 0x69, 0xA4, 0x55, 0x6C,
+    0xB5, 0x60, 0x25, 0x7F, 0x69, 0xB7, 0x6B, 0xB5, 0xB6, 0x9A, 0x33, 0x35, 0xA4, 0xB4, 0xFF, 0x52,
+    0xFB, 0xA1, 0x6E, 0x39, 0xA9, 0xD5, 0xCA, 0x6E, 0x77, 0xB5, 0x94, 0x42, 0xAD, 0xB5, 0x39, 0x50,
+    0x32, 0x8A, 0x36, 0xA4, 0x7A, 0x11, 0x1F, 0x56, 0x30, 0x5B, 0xD3, 0x34, 0xC2, 0x79, 0xCC, 0x02,
+    0xED, 0x48, 0x25, 0x32, 0x8D, 0x64, 0xFF, 0x04, 0x5C, 0xDA, 0x5D, 0x65, 0xB7, 0x7B, 0x4C, 0x9A,
+    0x0B, 0xE9, 0x79, 0xA9, 0x2B, 0x35, 0xD3, 0x0E, 0x98, 0x6D, 0x3A, 0x3E, 0x62, 0x22, 0x66, 0x01,
+    0x1B, 0x70, 0x03, 0x38, 0x6F, 0x22, 0xA0, 0x04, 0x6B, 0x63, 0x11, 0x01, 0x1B, 0xDA, 0x0E, 0x70,
+    0x5F, 0x4F, 0x86, 0xA9, 0x6F, 0x00, 0xA3, 0x08, 0x60, 0xD3, 0xC1, 0xBD, 0x19, 0x01, 0x64, 0x23,
+    0x60, 0xA2, 0x4D, 0xBF, 0xAA, 0x22, 0xE0, 0x7C, 0x9A, 0x84, 0x50, 0x45, 0x30, 0x91, 0x2A, 0xBD,
+    0xAB, 0x5A, 0x12, 0x17, 0x90, 0x6A, 0xA3, 0x52, 0x23, 0xCD, 0x54, 0x7A, 0x5E, 0x1A, 0xB0, 0xA9,
+    0xF9, 0x1E, 0x5E, 0xBB, 0xB4, 0xDB, 0x91, 0x10, 0x27, 0xAD, 0x4E, 0x81, 0x6A, 0x7A, 0xBF, 0x5E,
+    0xFE, 0xC1, 0x4F, 0x3F, 0x79, 0x6E, 0x27, 0x5E, 0x45, 0x60, 0x07, 0x1B, 0xC8, 0xE2, 0xBD, 0x76,
+    0xA2, 0xC9, 0x76, 0x57, 0x81, 0xDD, 0x55, 0x5A, 0x0D, 0xE0, 0x34, 0x1A, 0xAD, 0xA9, 0x3C, 0x72,
+    0x05, 0xE8, 0xE7, 0x04, 0xA2, 0xAC, 0x1A, 0xB2, 0xF7, 0x66, 0x78, 0x6F, 0x86, 0xAA, 0xF5, 0xD4,
+    0x6D, 0x47, 0xFE, 0x93, 0x88, 0xF9, 0xE1, 0x0C, 0xB5, 0x1D, 0x78, 0xB4, 0xF6, 0x98, 0x20, 0xCA,
+    0xD7, 0x22, 0xB8, 0x32, 0x10, 0x2B, 0x8F, 0x09, 0xAE, 0xB1, 0x5F, 0x8E, 0xE0, 0xCC, 0x9C, 0x87,
+    0xCA, 0x63, 0x42, 0xE5, 0x1D, 0x0B, 0x3C, 0xCB, 0x52, 0x0C, 0x76, 0xA0, 0x18, 0xED, 0x78, 0x23,
+    0x45, 0xB4, 0xB6, 0xB3, 0x23, 0xE5, 0x60, 0x7E, 0x3C, 0xB1, 0xC2, 0xAB, 0xD4, 0xD7, 0xB1, 0x23,
+    0x76, 0xC8, 0x34, 0x22, 0x88, 0xD8, 0x85, 0x32, 0x60, 0x3D, 0xBD, 0xA7, 0x87, 0x48, 0x31, 0x6F,
+    0x11, 0xAE, 0xA1, 0xE5, 0x70, 0x3D, 0xCA, 0xBE, 0x42, 0xB5, 0x3E, 0x2E, 0x75, 0x50, 0x6B, 0xED,
+    0x35, 0x81, 0x91, 0x86, 0x4B, 0x3B, 0x52, 0xBF, 0x9E, 0xA0, 0x55, 0x74, 0xF2, 0x14, 0x52, 0x53,
+    0xAD, 0x5B, 0x87, 0x9A, 0xA0, 0x1C, 0xB1, 0x4A, 0x00, 0x4F, 0x4A, 0xC1, 0x6F, 0xCD, 0x70, 0x13,
+    0x16, 0xE7, 0x29, 0x47, 0xEC, 0x37, 0x94, 0x82, 0xE5, 0x9C, 0x78, 0x23, 0x37, 0x70, 0x13, 0x96,
+    0x4C, 0x29, 0x58, 0xCE, 0xDC, 0x84, 0x05, 0x37, 0x94, 0x29, 0xD1, 0x29, 0x58, 0xC6, 0x44, 0x32,
+    0xB9, 0xF1, 0x26, 0x2C, 0xA0, 0x14, 0x2C, 0x62, 0x0A, 0xBA, 0x77, 0x46, 0xEC, 0x00, 0x5A, 0x61,
+    0x81, 0x42, 0x29, 0x58, 0xAF, 0x1C, 0xEA, 0x1A, 0x68, 0x34, 0x92, 0xA7, 0x58, 0x69, 0x15, 0xB7,
+    0xD9, 0xF8, 0x36, 0x75, 0x78, 0x58, 0xB7, 0x80, 0x22, 0x19, 0xAF, 0x5E, 0x52, 0x83, 0x5D, 0x9B,
+    0x4A, 0x0D, 0xF2, 0x14, 0xA2, 0x8C, 0x50, 0xA4, 0x96, 0x5F, 0x2E, 0x66, 0x05, 0x6C, 0xB4, 0x01,
+    0xA8, 0x43, 0xEF, 0x01, 0xF7, 0xD6, 0x0A, 0xA0, 0x17, 0x26, 0xC0, 0xA4, 0x49, 0x40, 0x39, 0x0B,
+    0xA0, 0xFE, 0x51, 0x04, 0xE8, 0x5F, 0x98, 0x80, 0x7C, 0x75, 0x03, 0x60, 0x27, 0x75, 0x80, 0xFB,
+    0x47, 0x01, 0x99, 0x8A, 0x08, 0x94, 0xB3, 0x9D, 0x01, 0xE7, 0xEB, 0x09, 0xCC, 0x9A, 0xE6, 0x9D,
+    0x81, 0x76, 0x22, 0x57, 0x43, 0xBF, 0xEE, 0xFA, 0x09, 0xDA, 0x04, 0x69, 0x6B, 0x69, 0x00, 0xB2,
+    0x93, 0x6B, 0x90, 0x3D, 0xD9, 0xBF, 0x44, 0x25, 0x69, 0x2A, 0x24, 0xA9, 0x2B, 0x22, 0xED, 0x8C,
+    0x30, 0xC2, 0xF9, 0x34, 0x30, 0x97, 0x53, 0x62, 0xD9, 0x04, 0x6D, 0xE3, 0x3C, 0xF5, 0x60, 0x03,
+    0x36, 0x98, 0x48, 0x31, 0x27, 0x10, 0xE5, 0xFC, 0xE5, 0x05, 0x2B, 0x2D, 0x18, 0x69, 0x06, 0x9D,
+    0x34, 0xDB, 0x20, 0x61, 0xC3, 0x19, 0x26, 0xD1, 0xD9, 0xC8, 0x71, 0x1E, 0x79, 0xA8, 0x97, 0x49,
+    0x8C, 0x42, 0xEA, 0x8C, 0x70, 0x78, 0xF3, 0xDA, 0xC6, 0x7D, 0x4E, 0xE9, 0xA0, 0x00, 0xB9, 0x6E,
+    0x5D, 0xD6, 0x00, 0x1A, 0x28, 0x37, 0xD0, 0x5E, 0xC7, 0x34, 0xBD, 0xEA, 0x07, 0xFA, 0x0E, 0x4C,
+    0x02, 0x0A, 0xD4, 0x21, 0x4B, 0xE3, 0x5F, 0x53, 0x8F, 0x80, 0x9D, 0x13, 0x08, 0x52, 0xB7, 0x95,
+    0x69, 0x4A, 0x4A, 0xEF, 0xF7, 0xC1, 0x05, 0xA0, 0xEF, 0xB6, 0x62, 0x4D, 0x48, 0x59, 0xB8, 0x00,
+    0x54, 0x21, 0x17, 0x90, 0xAF, 0x6C, 0x25, 0x9B, 0x26, 0x26, 0x33, 0x46, 0x0D, 0xB9, 0xA0, 0x5A,
+    0x13, 0x0C, 0x6E, 0xD7, 0xFF, 0xA6, 0x90, 0x26, 0x41, 0x13, 0x90, 0xF5, 0x4A, 0x6C, 0x9C, 0xDB,
+    0x5A, 0x48, 0x3F, 0x70, 0x01, 0x2B, 0x63, 0x36, 0x60, 0x5D, 0x6E, 0x13, 0xA9, 0x52, 0x09, 0x4B,
+    0x97, 0xA9, 0x00, 0xC8, 0xAE, 0xA6, 0x4A, 0xD9, 0x10, 0x2B, 0x6D, 0x7A, 0x6E, 0x15, 0x72, 0x0D,
+    0xA4, 0x9A, 0xC1, 0x26, 0x5C, 0x22, 0x50, 0x83, 0x0D, 0x94, 0x13, 0x08, 0xFA, 0x14, 0x48, 0x57,
+    0xD6, 0x64, 0x7A, 0x3D, 0x88, 0x7A, 0x02, 0xFB, 0x93, 0x7E, 0x01, 0x12, 0xC2, 0xB3, 0x09, 0x11,
+    0xC8, 0x24, 0x83, 0xBA, 0x51, 0x4B, 0xEA, 0xC0, 0x06, 0x93, 0x98, 0x9F, 0x6A, 0x02, 0x1B, 0xE8,
+    0xB7, 0x97, 0x36, 0xD8, 0x80, 0x5D, 0x38, 0xD4, 0x4B, 0xB4, 0xB3, 0x91, 0xC6, 0x4C, 0x53, 0xAB,
+    0x15, 0x93, 0x92, 0x7F, 0x78, 0x8D, 0xEC, 0xE4, 0x1A, 0xB9, 0x34, 0x23, 0x69, 0x70, 0xD3, 0xBF,
+    0x5A, 0xCA, 0x09, 0x3B, 0x08, 0x16, 0x3B, 0x62, 0xBF, 0xB6, 0xC2, 0x8D, 0x2A, 0x70, 0x80, 0xFC,
+    0x36, 0xD1, 0x74, 0x22, 0x75, 0xB7, 0x5C, 0x2B, 0x14, 0x5A, 0xA0, 0xD0, 0x04, 0x85, 0x3C, 0x94,
+    0xEB, 0x01, 0xD4, 0x3F, 0x1A, 0x41, 0x0E, 0xEC, 0x8F, 0x02, 0xD9, 0xEA, 0x3A, 0xEA, 0xB7, 0x16,
+    0xCA, 0xE8, 0x4E, 0xFF, 0x54, 0x57, 0x24, 0x0D, 0xA5, 0x34, 0x92, 0x9D, 0x5C, 0x4B, 0xD0, 0xEF,
+    0x6A, 0xAB, 0x3D, 0xCE, 0xD2, 0xD2, 0x9E, 0x5C, 0xBF, 0x73, 0xB2, 0x3C, 0x4B, 0x15, 0x58, 0x5E,
+    0xA5, 0x0A, 0xC4, 0xA7, 0xA9, 0x02, 0x37, 0x9E, 0xA6, 0x0A, 0x7C, 0xF5, 0xE3, 0x54, 0x81, 0x8F,
+    0xA5, 0xA9, 0xF1, 0x47, 0xF3, 0xBF, 0xBD, 0x73, 0x0D, 0x2A, 0x29, 0x40, 0x2D, 0x85, 0x3D, 0xA2,
+    0xB1, 0x52, 0x97, 0x49, 0x6F, 0x4B, 0x1D, 0xAD, 0xC6, 0x62, 0x81, 0xAC, 0x4F, 0xA0, 0xCE, 0x0E,
+    0xFB, 0x99, 0x90, 0x0D, 0xC0, 0x92, 0x3A, 0x89, 0x6B, 0x3E, 0x9C, 0x8B, 0xC5, 0x44, 0x39, 0x41,
+    0x16, 0x13, 0x98, 0x6B, 0x13, 0x51, 0x58, 0x7B, 0xAA, 0x00, 0x76, 0xC4, 0xA4, 0x16, 0x43, 0x3F,
+    0x51, 0xCD, 0x60, 0x75, 0xBB, 0x8F, 0xA9, 0x59, 0xCF, 0xC9, 0xBA, 0x4D, 0x00, 0x07, 0x9F, 0x6F,
+    0xE0, 0xD2, 0x6E, 0xC7, 0xC1, 0xEE, 0x6A, 0x2F, 0xE1, 0xB4, 0xB4, 0x5A, 0xA8, 0x34, 0x1F, 0xAA,
+    0x81, 0xBE, 0x4B, 0x2C, 0x60, 0x62, 0xBF, 0x56, 0x68, 0x3D, 0xD9, 0x39, 0x07, 0x5F, 0x27, 0x2E,
+    0xBD, 0x0A, 0x14, 0x21, 0x35, 0xE3, 0x11, 0xCA, 0x29, 0x71, 0xCC, 0x91, 0xCA, 0x83, 0x89, 0xB8,
+    0x0E, 0xB2, 0x05, 0xD7, 0x24, 0xC0, 0x00, 0xD0, 0xB3, 0x26, 0x06, 0x2F, 0xC1, 0x82, 0x2F, 0x47,
+    0x80, 0xFA, 0xF5, 0x09, 0xA0, 0x7A, 0x2B, 0x00, 0xD8, 0x77, 0xC6, 0xD4, 0x8F, 0xB6, 0x39, 0xA9,
+    0x4F, 0x87, 0x2E, 0x75, 0x3E, 0x2E, 0xE0, 0xD7, 0xFD, 0x5C, 0x01, 0x20, 0xDB, 0xED, 0xAE, 0x48,
+    0x13, 0x07, 0x0D, 0x4E, 0x8B, 0xD3, 0x0A, 0x91, 0x5C, 0xEA, 0xAA, 0x25, 0x4D, 0xB4, 0xFA, 0x86,
+    0xDE, 0xEF, 0x0B, 0xA7, 0x88, 0x89, 0xB6, 0x58, 0xC1, 0x0D, 0x14, 0x6A, 0xA8, 0x06, 0xF2, 0x15,
+    0xFA, 0x99, 0x3C, 0x42, 0x15, 0xB0, 0xF2, 0xB8, 0x0E, 0x44, 0x76, 0x27, 0x62, 0x26, 0xB0, 0x13,
+    0xF5, 0x67, 0x07, 0x7A, 0xA0, 0xED, 0x4C, 0x10, 0x76, 0x4C, 0xD9, 0x2C, 0x03, 0x89, 0x30, 0x2C,
+    0x87, 0xB6, 0xA9, 0x3C, 0x64, 0x0B, 0xD1, 0xCC, 0xF9, 0x0C, 0xD8, 0xD1, 0xFA, 0xDA, 0xA7, 0x22,
+    0xC8, 0xE6, 0x6C, 0x31, 0x01, 0x28, 0x83, 0xC3, 0x8E, 0x2D, 0x80, 0xBB, 0x12, 0xE8, 0xCB, 0x01,
+    0x30, 0xF3, 0xB3, 0x14, 0x21, 0x15, 0xC8, 0xD7, 0x3D, 0xEE, 0x05, 0x0F, 0x64, 0x4B, 0x24, 0x5F,
+    0xE6, 0x04, 0xA5, 0x3A, 0xAA, 0x94, 0xF1, 0x7E, 0x82, 0x64, 0x66, 0x0A, 0x81, 0x5D, 0xCF, 0xEC,
+    0x54, 0x3B, 0xEC, 0x41, 0x7E, 0xB2, 0x90, 0xE7, 0x0C, 0xD4, 0x6E, 0xC7, 0xC1, 0xEE, 0xA8, 0x96,
+    0x3A, 0xA7, 0xA9, 0xD2, 0x4A, 0xAD, 0x31, 0xEB, 0x47, 0xF2, 0x05, 0x5C, 0x48, 0x64, 0x4C, 0x9A,
+    0x0D, 0x16, 0x0B, 0xB5, 0x87, 0x5C, 0x89, 0xE3, 0x53, 0x97, 0x66, 0xFC, 0x6F, 0xCD, 0x00, 0xF5,
+    0x7B, 0xA9, 0x8E, 0xF6, 0xB5, 0xD2, 0x00, 0xE4, 0xE9, 0x50, 0xA4, 0x48, 0x9B, 0x52, 0x56, 0xBF,
+    0x30, 0x01, 0xB4, 0x45, 0x04, 0x58, 0xF2, 0x8D, 0x3E, 0x54, 0x07, 0x65, 0xA0, 0x1D, 0xA0, 0xF2,
+    0xD4, 0x21, 0x39, 0x6D, 0x22, 0x08, 0x8A, 0x85, 0x52, 0x47, 0x14, 0x7A, 0xA9, 0xD5, 0x4C, 0xAF,
+    0xA5, 0xD7, 0x8C, 0x14, 0x13, 0x46, 0xFD, 0xB4, 0x34, 0x5A, 0xAD, 0xE9, 0x92, 0x3F, 0x4E, 0x88,
+    0x56, 0x1D, 0x45, 0xAA, 0xCE, 0x15, 0xDC, 0x48, 0xE5, 0x41, 0x98, 0x09, 0xCA, 0x99, 0x1E, 0x70,
+    0xDE, 0x0E, 0x90, 0xAD, 0xA9, 0x32, 0x82, 0x03, 0x70, 0x5F, 0x1F, 0x81, 0x7C, 0xD9, 0x10, 0x6A,
+    0x03, 0xD0, 0xA6, 0x59, 0xD0, 0x72, 0x61, 0x62, 0xB4, 0x15, 0xE1, 0xCF, 0x0A, 0x5C, 0xD6, 0x8B,
+    0x67, 0x83, 0xB1, 0x91, 0x16, 0x38, 0xD8, 0xED, 0x76, 0x57, 0x0B, 0x49, 0xFA, 0x94, 0x24, 0x8D,
+    0xFD, 0xED, 0x93, 0xEB, 0x53, 0xDD, 0x51, 0xCE, 0xD6, 0x53, 0x44, 0x13, 0x30, 0x0B, 0x5F, 0x4D,
+    0x84, 0x4E, 0x76, 0x61, 0xB2, 0xD7, 0x6C, 0x3C, 0x34, 0xAD, 0xDF, 0x18, 0xC7, 0x04, 0x4F, 0xAA,
+    0xB0, 0xF7, 0x16, 0xD8, 0x99, 0x8D, 0x55, 0x36, 0x11, 0x3E, 0x69, 0x56, 0xA8, 0x3E, 0x25, 0x28,
+    0xBF, 0x21, 0x30, 0x41, 0x0D, 0x79, 0xEC, 0x25, 0xA9, 0x96, 0xA4, 0x2B, 0xD2, 0x36, 0x28, 0xE1,
+    0x56, 0xB7, 0xBA, 0x9D, 0xE3, 0x03, 0xFC, 0x5D, 0x75, 0xAB, 0x5B, 0x3F, 0x4E, 0x22, 0xED, 0xCC,
+    0x94, 0x4C, 0x0F, 0x76, 0x80, 0x6C, 0xDE, 0xFC, 0x41, 0xE5, 0xB8, 0x91, 0xC2, 0x75, 0x93, 0x3C,
+    0x46, 0x2C, 0x9B, 0x0B, 0xC9, 0x84, 0xCD, 0x6D, 0x64, 0xFD, 0xE6, 0x81, 0x3A, 0xFB, 0xF1, 0x66,
+    0xE1, 0x2E, 0xFC, 0xB8, 0xDB, 0xEE, 0x3F, 0xFB, 0xF1, 0xB4, 0xB9, 0xB2, 0x1E, 0xEE, 0xDC, 0xEA,
+    0x74, 0xA9, 0xA7, 0xFD, 0xE5, 0xFF, 0x2E, 0xF5, 0x4E, 0x6E, 0xB3, 0x1F, 0xAE, 0xDB, 0x53, 0xFC,
+    0x23, 0x58, 0x41, 0xFE, 0x93, 0x09, 0x5C, 0xE5, 0x29, 0xC6, 0x08, 0xB1, 0x1C, 0xA9, 0xBC, 0x23,
+    0x9F, 0x4C, 0xE2, 0xED, 0xCA, 0x91, 0xC8, 0x42, 0x39, 0x56, 0x1E, 0x97, 0x4F, 0x98, 0xC9, 0x41,
+    0xF5, 0xC6, 0xB8, 0x31, 0xE1, 0x46, 0xFB, 0xED, 0xF6, 0xC9, 0xC9, 0xC9, 0x09, 0x98, 0xCE, 0x4C,
+    0x08, 0x17, 0xCC, 0x4A, 0x3D, 0x66, 0x11, 0x7B, 0xD6, 0x21, 0x4B, 0x75, 0x20, 0x4D, 0x14, 0xEB,
+    0xF5, 0x88, 0x0D, 0xF9, 0x42, 0x35, 0xB0, 0x62, 0x3D, 0x2B, 0x87, 0xF7, 0x90, 0x03, 0x87, 0xBD,
+    0xC8, 0x7A, 0x89, 0x52, 0x77, 0x44, 0x35, 0x21, 0x9C, 0x47, 0xB8, 0xEE, 0xEC, 0x6C, 0x30, 0xA2,
+    0x3E, 0x3D, 0xD6, 0x6D, 0x2B, 0xB9, 0xD5, 0x68, 0xAA, 0x26, 0xFE, 0xAC, 0xC9, 0x92, 0x77, 0x82,
+    0x3A, 0x9E, 0xF1, 0x7A, 0x65, 0x6A, 0x11, 0x3D, 0x40, 0x1E, 0xD9, 0xFB, 0x01, 0x92, 0x5B, 0xE0,
+    0xEE, 0xE8, 0x7A, 0x85, 0xFA, 0x0D, 0xA9, 0xA1, 0xEF, 0x25, 0x72, 0xFD, 0xB8, 0x12, 0xE5, 0x42,
+    0xB9, 0x50, 0x0F, 0xD8, 0x99, 0x1E, 0xAA, 0x90, 0x47, 0x70, 0x3E, 0xA1, 0x95, 0xDA, 0x63, 0x22,
+    0x3D, 0xD8, 0x7B, 0xA3, 0x8B, 0x39, 0xB9, 0x61, 0xF3, 0x08, 0x2B, 0x65, 0xA0, 0x0A, 0xB8, 0xD3,
+    0x3F, 0x4D, 0xF4, 0xCC, 0x44, 0x96, 0x40, 0xF7, 0xC1, 0xCB, 0x67, 0x1C, 0x50, 0x3F, 0x93, 0x27,
+    0xAF, 0x53, 0x34, 0x11, 0x3D, 0x17, 0xB1, 0xDF, 0x5E, 0x30, 0x53, 0x0F, 0x2F, 0xB9, 0x6E, 0x73,
+    0x4A, 0x4E, 0x9B, 0x4B, 0xA8, 0xED, 0x92, 0x5B, 0xC2, 0x9C, 0xF9, 0xB3, 0xA6, 0x34, 0x66, 0x1C,
+    0xF5, 0xBA, 0x1E, 0x4B, 0x69, 0xE5, 0x58, 0x0B, 0x3C, 0x79, 0x74, 0x06, 0xF6, 0x13, 0x8E, 0x73,
+    0xA9, 0xD3, 0x2D, 0x9C, 0x39, 0x93, 0xAA, 0xE1, 0xCC, 0xC5, 0x94, 0xDD, 0x13, 0x7D, 0x2C, 0x35,
+    0x09, 0x1F, 0x67, 0x92, 0x26, 0xEC, 0xCC, 0xF1, 0x80, 0x1A, 0xDA, 0xA6, 0x98, 0x49, 0x5E, 0xAC,
+    0x62, 0x42, 0x50, 0x0D, 0x66, 0x86, 0xB6, 0xA9, 0x46, 0xB2, 0x85, 0xB6, 0xA3, 0x98, 0xB2, 0x15,
+    0xAA, 0xA1, 0x98, 0xA1, 0x6D, 0x6C, 0x20, 0x5B, 0x70, 0x03, 0xC5, 0x44, 0xEF, 0xA9, 0x87, 0x4C,
+    0x9D, 0x51, 0x93, 0xEB, 0xB6, 0xF4, 0xA2, 0x91, 0xDE, 0xD5, 0x94, 0x6B, 0x2D, 0xE5, 0xF9, 0xB3,
+    0xE6, 0x60, 0x5F, 0x22, 0xFD, 0x29, 0xB4, 0x9A, 0xA9, 0xEF, 0xF4, 0x63, 0x31, 0xA1, 0x66, 0xC5,
+    0xCC, 0x95, 0xC7, 0xBD, 0x3E, 0x93, 0x47, 0xD7, 0x51, 0xBD, 0xB1, 0x9F, 0x84, 0xBE, 0x71, 0xE7,
+    0xE4, 0xE4, 0xEF, 0xDB, 0x66, 0x4B, 0xBB, 0xDB, 0xBB, 0x78, 0xEA, 0x90, 0xB2, 0xFD, 0xF1, 0x52,
+    0x77, 0xFA, 0xAE, 0x96, 0x26, 0x5A, 0x2D, 0xF0, 0x7B, 0x2F, 0x02, 0xD9, 0xDF, 0x41, 0xB6, 0x91,
+    0x37, 0x64, 0xEB, 0xE3, 0x11, 0x3B, 0xE6, 0x23, 0x2D, 0x59, 0xF2, 0xFA, 0xD8, 0xBD, 0xD7, 0x27,
+    0x5B, 0x80, 0xF2, 0x74, 0xD7, 0x94, 0x92, 0x70, 0x52, 0xE4, 0x33, 0xEB, 0xAE, 0x49, 0xEF, 0xAA,
+    0x86, 0x8B, 0x77, 0xFD, 0x02, 0x51, 0xED, 0x69, 0x72, 0xDB, 0x70, 0x91, 0x55, 0xAD, 0xD7, 0xA7,
+    0x96, 0xE4, 0xDC, 0x2A, 0xD7, 0xEB, 0xEB, 0x92, 0x2D, 0x54, 0x63, 0xE7, 0x3C, 0x3D, 0x66, 0xA2,
+    0x98, 0x92, 0xA8, 0xC0, 0x4C, 0x98, 0x09, 0xD7, 0xD1, 0x92, 0x27, 0xF6, 0xF7, 0xF4, 0xA9, 0x05,
+    0xDA, 0xAD, 0xB2, 0x3A, 0xB2, 0xF9, 0xD2, 0x66, 0x62, 0x92, 0x25, 0x49, 0x96, 0xD5, 0x48, 0xBA,
+    0x45, 0x25, 0x29, 0x64, 0x92, 0xD4, 0xB4, 0x0D, 0x97, 0x63, 0x35, 0x80, 0x7B, 0x3D, 0x82, 0x99,
+    0x5D, 0x07, 0xEE, 0x4A, 0x84, 0x6A, 0xAC, 0x27, 0xAA, 0x88, 0xA4, 0x15, 0x23, 0xAD, 0x0D, 0x79,
+    0x7F, 0xBA, 0x39, 0xFE, 0xC8, 0xE5, 0xCF, 0x39, 0xF3, 0x3E, 0xFE, 0x14, 0x7A, 0xED, 0xBE, 0x0B,
+    0xF5, 0x0A, 0x26, 0xB6, 0x9A, 0x40, 0xBD, 0x04, 0x4E, 0x8F, 0xF5, 0x03, 0x76, 0xA1, 0x8C, 0x98,
+    0xB8, 0x67, 0x8C, 0x9C, 0xC7, 0x79, 0xCA, 0xB0, 0xA9, 0x1C, 0x36, 0x79, 0x83, 0xA0, 0xFE, 0x39,
+    0x2F, 0x14, 0x6B, 0x93, 0xE9, 0xC5, 0x5A, 0xB3, 0x91, 0x9E, 0xD0, 0x8A, 0xF6, 0x26, 0x20, 0x53,
+    0x97, 0xC9, 0x67, 0xEA, 0x52, 0xBF, 0x3F, 0x77, 0xAE, 0x7C, 0xB1, 0xA9, 0xD5, 0x38, 0x35, 0x07,
+    0x6A, 0x68, 0x7F, 0xAE, 0x3D, 0xD3, 0xAD, 0x5A, 0x72, 0xA9, 0xF2, 0x8A, 0x19, 0x1B, 0xB7, 0xBD,
+    0x98, 0xEE, 0x76, 0x3F, 0x7C, 0x35, 0x53, 0xCC, 0x15, 0xB9, 0x1C, 0x31, 0x3F, 0xFF, 0x3E, 0x9F,
+    0xEF, 0xC5, 0x84, 0x0D, 0xD4, 0x23, 0xF2, 0xA5, 0x70, 0x91, 0xEA, 0xDA, 0xFB, 0x5A, 0x39, 0x9D,
+    0x97, 0x7D, 0xAA, 0x07, 0x77, 0x7F, 0xF4, 0xC1, 0x6E, 0x87, 0xF3, 0x4E, 0x11, 0x71, 0xAC, 0xC1,
+    0x44, 0xEA, 0x71, 0x9B, 0x3E, 0x39, 0xEF, 0xFC, 0xA6, 0x39, 0x30, 0xB1, 0xED, 0xC0, 0xBE, 0x37,
+    0x01, 0x4E, 0x23, 0x20, 0x37, 0x80, 0x89, 0x6E, 0x00, 0x1B, 0x5A, 0x0F, 0xCE, 0xF7, 0x1E, 0x44,
+    0xEF, 0x31, 0x11, 0x0D, 0xD8, 0x80, 0x06, 0xDA, 0xFF, 0x8D, 0xC6, 0x5A, 0x33, 0x0A, 0xD2, 0x48,
+    0xF2, 0xB1, 0x7C, 0x1E, 0x0E, 0x28, 0x85, 0x13, 0xB5, 0xA0, 0xFF, 0x10, 0xF6, 0x4C, 0x2F, 0xD6,
+    0x5A, 0xDB, 0x0B, 0xDD, 0x87, 0xC3, 0xF1, 0xF2, 0x9A, 0x3C, 0x85, 0xB2, 0x5A, 0x0A, 0x09, 0xA3,
+    0x77, 0xA5, 0x1F, 0x4A, 0x91, 0x47, 0xB4, 0x1C, 0x4A, 0x8F, 0x25, 0x2A, 0xA4, 0x54, 0x63, 0x56,
+    0x68, 0x3B, 0xDC, 0x40, 0x35, 0x6E, 0x92, 0x9C, 0x44, 0x15, 0x50, 0xFB, 0x4D, 0xA5, 0x93, 0x7F,
+    0xE8, 0x51, 0x99, 0x06, 0xDA, 0x5B, 0x54, 0xA7, 0x99, 0xE4, 0x9D, 0x82, 0x55, 0xAC, 0x15, 0x8D,
+    0xD6, 0x6C, 0x0F, 0x5C, 0xE0, 0x72, 0x77, 0xBC, 0x90, 0xE9, 0x07, 0xD2, 0x88, 0x16, 0x69, 0xE1,
+    0x11, 0xAD, 0x8F, 0xC9, 0x53, 0xCD, 0xD8, 0x40, 0x31, 0x93, 0x2F, 0x64, 0x0B, 0x5B, 0x53, 0xAC,
+    0x06, 0xAA, 0x81, 0x62, 0xA2, 0x98, 0xC8, 0x7E, 0xB1, 0x0B, 0xD5, 0x42, 0xAE, 0x6B, 0xAD, 0x42,
+    0xA9, 0xB5, 0x56, 0x34, 0x49, 0xB8, 0x05, 0x64, 0xFD, 0x0A, 0x46, 0x9A, 0x28, 0x24, 0x75, 0x66,
+    0xA1, 0x9D, 0x4C, 0xC4, 0x28, 0x5B, 0xC0, 0x0D, 0x3D, 0x94, 0xB3, 0xEB, 0xC8, 0x64, 0x47, 0x70,
+    0x6F, 0xCC, 0x24, 0x17, 0x73, 0x6A, 0x33, 0xAA, 0xC2, 0x66, 0x53, 0xEC, 0xA8, 0x86, 0x32, 0xD4,
+    0x01, 0x33, 0x1B, 0x61, 0x22, 0xED, 0xE9, 0xE5, 0x85, 0x52, 0x5A, 0x92, 0x69, 0x87, 0x2F, 0x5C,
+    0xDB, 0xD7, 0xDD, 0x23, 0xFE, 0xF8, 0x94, 0x3A, 0xD6, 0x9A, 0x4B, 0x7D, 0x4B, 0x0A, 0x97, 0x75,
+    0x7A, 0x59, 0x4D, 0xEA, 0x53, 0xDA, 0x7C, 0x2D, 0x66, 0x49, 0x32, 0x28, 0x1B, 0x36, 0x62, 0xA7,
+    0x1A, 0x6D, 0x80, 0xF3, 0xD3, 0x6C, 0x39, 0xF3, 0x68, 0x99, 0x39, 0x51, 0x0B, 0x5B, 0xDF, 0xB9,
+    0x7D, 0x3D, 0x62, 0x37, 0xDE, 0x7C, 0x05, 0x3B, 0x7E, 0x6C, 0x53, 0x05, 0x6C, 0x8E, 0xD0, 0x7B,
+    0x19, 0xD0, 0x5E, 0x03, 0xB4, 0x5A, 0xE1, 0xF0, 0xE4, 0xA4, 0x3B, 0x6B, 0x61, 0xC7, 0x7A, 0x09,
+    0x9C, 0x34, 0x51, 0x49, 0x6A, 0xCC, 0x4A, 0x35, 0xA5, 0x11, 0xB1, 0x1A, 0x29, 0xA6, 0x3C, 0x6E,
+    0x64, 0x53, 0x31, 0xA5, 0x01, 0xB1, 0xED, 0x28, 0xA6, 0xE2, 0xDE, 0xD3, 0x74, 0xC3, 0x02, 0x7D,
+    0x53, 0x07, 0xAA, 0x09, 0xF9, 0x52, 0x4D, 0x29, 0x69, 0xA2, 0xD6, 0xDA, 0x36, 0xB4, 0xEB, 0xE3,
+    0x13, 0x3C, 0x94, 0xC6, 0xE5, 0x64, 0x52, 0x1E, 0x78, 0x7A, 0x59, 0x33, 0x94, 0xD2, 0x00, 0x5F,
+    0x38, 0xF9, 0xFB, 0xAD, 0xFD, 0xD4, 0xDF, 0x50, 0xE8, 0xA3, 0x62, 0xAF, 0x47, 0xD4, 0xAA, 0xAB,
+    0x56, 0xBA, 0x62, 0xE3, 0x29, 0x69, 0x9B, 0x34, 0x1C, 0x9D, 0x43, 0x89, 0xF7, 0x8B, 0xA8, 0xD6,
+    0x6B, 0xA4, 0x99, 0xF2, 0xD6, 0x34, 0x33, 0x9D, 0xE2, 0xB4, 0x9A, 0xD3, 0xE3, 0x58, 0x37, 0xE5,
+    0x18, 0xB1, 0xCF, 0x05, 0xFE, 0xD8, 0x8E, 0xC9, 0x31, 0xDB, 0xAE, 0xD0, 0xAB, 0xDB, 0xF4, 0x41,
+    0x03, 0x87, 0x7A, 0xAD, 0x41, 0x9F, 0x20, 0x5B, 0x6E, 0x60, 0x7E, 0x38, 0x53, 0x7F, 0x7D, 0xCE,
+    0x97, 0x5A, 0x1A, 0x6B, 0x2D, 0x1C, 0xBC, 0x0C, 0xFC, 0xEB, 0x84, 0x8C, 0xED, 0x98, 0x86, 0xEC,
+    0x15, 0x8A, 0xD3, 0xDD, 0xE3, 0x92, 0x9C, 0x14, 0x3F, 0xA3, 0xDD, 0x91, 0xB9, 0xFB, 0xEA, 0xCF,
+    0x08, 0x46, 0xB0, 0xEB, 0x2B, 0xBE, 0x96, 0xA8, 0x35, 0x72, 0xF8, 0x22, 0xD9, 0xFF, 0x20, 0xFB,
+    0x62, 0x53, 0xA9, 0x2B, 0x34, 0x96, 0x1A, 0x33, 0x4D, 0x3C, 0x35, 0x73, 0xF8, 0x41, 0x7A, 0x4F,
+    0xB7, 0xC9, 0xF8, 0x92, 0xC1, 0x30, 0x0B, 0xA8, 0x29, 0xD4, 0x50, 0xAF, 0xC7, 0x3A, 0x6D, 0x8C,
+    0xF4, 0x23, 0x4D, 0xD4, 0x1A, 0xFA, 0x08, 0x9F, 0xE7, 0xA0, 0xE1, 0xD2, 0xEE, 0xE8, 0x60, 0xB7,
+    0x93, 0xBC, 0xD3, 0xFF, 0xD5, 0xC2, 0xF1, 0x9A, 0x09, 0xEC, 0x90, 0x2F, 0xD0, 0x52, 0xCC, 0x9B,
+    0xAB, 0xB6, 0xF2, 0x54, 0x03, 0x37, 0xC1, 0x79, 0x33, 0x41, 0x4F, 0xE5, 0x61, 0x65, 0x01, 0x13,
+    0x8B, 0x00, 0x45, 0xA8, 0x1B, 0xB0, 0x63, 0x04, 0xEA, 0x37, 0x46, 0xC0, 0xB5, 0x1B, 0x68, 0xDC,
+    0x23, 0x3B, 0xA3, 0x73, 0xF0, 0x96, 0x78, 0x82, 0x23, 0x8E, 0xB8, 0xB4, 0x7B, 0x5C, 0xC2, 0x76,
+    0x85, 0x62, 0xAD, 0x21, 0x8B, 0xD4, 0x6A, 0xDA, 0x24, 0x47, 0xF4, 0x26, 0x62, 0x56, 0xF2, 0x99,
+    0x6A, 0xA4, 0x0D, 0x89, 0x75, 0x29, 0x45, 0x11, 0x28, 0x03, 0x9A, 0xB9, 0x09, 0x6D, 0x53, 0x5D,
+    0xF7, 0xD6, 0x63, 0x62, 0xFE, 0x83, 0x98, 0x45, 0xA8, 0xBD, 0xB3, 0x63, 0xDD, 0xC0, 0x52, 0x0C,
+    0xBD, 0x09, 0x60, 0xC7, 0x1B, 0x45, 0x78, 0x14, 0xE8, 0x6D, 0xE7, 0x9E, 0x1F, 0xC0, 0xFC, 0x78,
+    0xCA, 0x63, 0x04, 0xDC, 0x75, 0xEC, 0xB7, 0x3A, 0xC8, 0x34, 0xA2, 0x09, 0xB0, 0x0B, 0x45, 0xEA,
+    0x5B, 0x3E, 0x91, 0x8C, 0xC5, 0xBC, 0x41, 0xEF, 0xF3, 0x24, 0x1F, 0xEC, 0x8E, 0x24, 0xDF, 0xEA,
+    0x35, 0x2D, 0xF4, 0x91, 0xDE, 0xD3, 0x26, 0xF6, 0x01, 0xFA, 0xC6, 0x35, 0xD0, 0xE7, 0x13, 0xA0,
+    0xAA, 0x03, 0x12, 0x11, 0x29, 0x7F, 0xEE, 0x29, 0x5E, 0x01, 0xD6, 0x05, 0xB0, 0xAF, 0x2D, 0xC0,
+    0x62, 0x22, 0xD8, 0xB1, 0x88, 0xD0, 0x53, 0xCE, 0x94, 0x13, 0xF6, 0xD4, 0x68, 0xC9, 0xA5, 0x4A,
+    0x53, 0xA5, 0xF8, 0x8B, 0x57, 0x4F, 0xB8, 0xAB, 0x7A, 0xF2, 0xFB, 0xAA, 0xA7, 0xBA, 0xB7, 0x7A,
+    0xD8, 0x00, 0xD3, 0x79, 0xF5, 0xA4, 0xA9, 0xC7, 0x72, 0x6E, 0x71, 0xFA, 0x06, 0xA8, 0x22, 0x64,
+    0x4F, 0x25, 0x92, 0x71, 0x61, 0xD3, 0x29, 0x53, 0xDF, 0xDA, 0x3B, 0x88, 0xCB, 0xCD, 0xEF, 0x32,
+    0x2D, 0x4D, 0x39, 0x3F, 0x4A, 0x11, 0x6D, 0x63, 0xA2, 0xF1, 0x66, 0x49, 0xB2, 0x82, 0x6C, 0xDD,
+    0x4C, 0x97, 0xF6, 0x8A, 0xB6, 0x0E, 0x5A, 0xCF, 0xE8, 0x3C, 0x4F, 0x3B, 0x8F, 0xAB, 0x07, 0xAA,
+    0xEF, 0xDF, 0x39, 0xE9, 0xDF, 0x91, 0xF4, 0x63, 0x49, 0xE7, 0x25, 0x5F, 0x46, 0xDA, 0x98, 0xE9,
+    0xC8, 0x44, 0x12, 0xB8, 0xDC, 0xF6, 0x19, 0x13, 0xC9, 0x23, 0x59, 0x84, 0x65, 0xDB, 0xF3, 0x88,
+    0x9D, 0x71, 0x03, 0x6E, 0xC0, 0xA6, 0x51, 0x73, 0x7F, 0x29, 0x8B, 0xE4, 0x67, 0xD0, 0xE5, 0xE2,
+    0x73, 0x22, 0x99, 0x1A, 0xFA, 0x95, 0x6A, 0x81, 0xA3, 0x67, 0x7F, 0xD6, 0xF6, 0xEF, 0xC0, 0xA8,
+    0xB3, 0xF2, 0x97, 0x7A, 0x4F, 0xDB, 0xB0, 0x92, 0x47, 0xCA, 0x80, 0xEB, 0x58, 0x31, 0x13, 0x95,
+    0xA7, 0x27, 0x8F, 0xD8, 0x31, 0xC9, 0xE8, 0x50, 0x83, 0xBA, 0x7C, 0xC5, 0x8D, 0xD9, 0xB2, 0xDD,
+    0xD8, 0x93, 0x47, 0x8A, 0x80, 0x1D, 0xD2, 0xCF, 0xF6, 0x4F, 0xC8, 0x16, 0xAA, 0x60, 0x45, 0x3B,
+    0x72, 0x04, 0xF9, 0x29, 0x79, 0xA3, 0xC8, 0x33, 0x4E, 0xB3, 0xFD, 0x3F, 0x53, 0xAF, 0x78, 0x83,
+    0x5E, 0xA6, 0xA3, 0xDF, 0x2C, 0x7E, 0xDE, 0xF0, 0x39, 0x1C, 0xE5, 0x58, 0x04, 0x6E, 0xD2, 0x36,
+    0x36, 0x94, 0x33, 0xA2, 0xEF, 0xAA, 0xA9, 0x8C, 0xA8, 0xAB, 0x07, 0x13, 0x69, 0xBD, 0x9D, 0x69,
+    0x7D, 0x39, 0xE1, 0xBA, 0x32, 0xE0, 0xBA, 0x22, 0x50, 0x37, 0x45, 0xA0, 0xC2, 0x24, 0x2E, 0xFD,
+    0xF7, 0xC9, 0x1B, 0x5C, 0x53, 0x8C, 0xD8, 0x21, 0x29, 0x87, 0x7B, 0x58, 0xA9, 0x07, 0x5A, 0x6F,
+    0x27, 0xEA, 0x60, 0x16, 0xAA, 0x60, 0x16, 0xDC, 0x58, 0x46, 0xD4, 0x54, 0x21, 0x5F, 0x70, 0xBE,
+    0x9C, 0x58, 0x93, 0x36, 0xFB, 0x51, 0x8A, 0xE1, 0x1E, 0xED, 0xD2, 0x7F, 0xB9, 0x8B, 0x19, 0xDC,
+    0x48, 0xFA, 0x36, 0x49, 0x65, 0xAA, 0xC4, 0xF1, 0x24, 0x72, 0x65, 0xD3, 0xA3, 0xDF, 0xBB, 0xFD,
+    0xE6, 0xEA, 0x62, 0xEE, 0x2B, 0x84, 0xCD, 0x88, 0x54, 0x91, 0xF3, 0x4E, 0x67, 0x52, 0x56, 0xCA,
+    0xD3, 0x94, 0xD9, 0x07, 0x95, 0xC0, 0x6F, 0x76, 0x11, 0xBC, 0xBA, 0x8D, 0xC9, 0x5D, 0xA2, 0x22,
+    0xC7, 0x44, 0x25, 0x27, 0x09, 0xFD, 0x5F, 0x2D, 0x00, 0x2B, 0x2D, 0x90, 0x4D, 0xFC, 0xDB, 0xDF,
+    0xB2, 0xBC, 0xFF, 0x39, 0x7F, 0x09, 0xE4, 0x6B, 0x26, 0xC0, 0x28, 0xBF, 0x70, 0xC8, 0x62, 0xB2,
+    0xAB, 0x0F, 0xDE, 0x7E, 0x93, 0x33, 0xFD, 0xEB, 0xAA, 0xB8, 0x3A, 0xE3, 0xAF, 0x3A, 0xD8, 0x94,
+    0x0A, 0x9F, 0x4D, 0x7E, 0xA4, 0xB3, 0xF1, 0x2D, 0x89, 0x70, 0xFA, 0x06, 0x28, 0xCF, 0xA1, 0x74,
+    0x38, 0x63, 0x9F, 0x52, 0x23, 0x4E, 0xC4, 0x74, 0xBD, 0x72, 0xA6, 0x6B, 0x38, 0xBC, 0xAB, 0xF2,
+    0x7E, 0x2D, 0x45, 0x52, 0x67, 0xA9, 0xFB, 0x9F, 0x67, 0xB8, 0x3C, 0x29, 0xC4, 0xB5, 0xE7, 0x3C,
+    0x13, 0xCD, 0xFD, 0x3B, 0xFC, 0x26, 0xE4, 0xE5, 0x72, 0x77, 0x86, 0x54, 0x14, 0x01, 0xF7, 0xAD,
+    0x00, 0x65, 0x70, 0x9E, 0x3C, 0xB2, 0x40, 0x9D, 0x56, 0x63, 0x9D, 0xD1, 0x26, 0xBB, 0xDD, 0x6E,
+    0x77, 0xD4, 0x4A, 0xD2, 0xF3, 0x92, 0x34, 0x67, 0x3A, 0x39, 0xE9, 0x3B, 0x1B, 0xC8, 0x52, 0x06,
+    0x3A, 0x1B, 0x60, 0x42, 0x70, 0xF0, 0x7E, 0xE9, 0xBB, 0xA3, 0x3D, 0x25, 0x6A, 0x25, 0xFD, 0x14,
+    0x51, 0x4A, 0xD6, 0xD8, 0x00, 0x7F, 0x82, 0xA0, 0xB8, 0x28, 0x4A, 0x39, 0x96, 0x14, 0x9D, 0x24,
+    0xBD, 0x91, 0xD6, 0xA3, 0x3D, 0xC2, 0xC3, 0x0D, 0x45, 0x34, 0x0B, 0xF4, 0x43, 0x3B, 0x52, 0x46,
+    0xB3, 0x40, 0xDD, 0xD4, 0xDD, 0x7D, 0xF6, 0xE0, 0xD7, 0xB5, 0x49, 0xFD, 0x31, 0xB8, 0x86, 0x36,
+    0xE0, 0x16, 0x4A, 0x75, 0x1C, 0x0F, 0x64, 0xDD, 0x59, 0x92, 0x3F, 0x64, 0x51, 0x16, 0xC0, 0x1F,
+    0x93, 0x2D, 0x94, 0x2B, 0x6D, 0xCC, 0x34, 0x9A, 0x85, 0xBC, 0xE1, 0xA3, 0x7A, 0x5D, 0xD9, 0x61,
+    0x04, 0x7D, 0xA4, 0xFE, 0x56, 0x28, 0x83, 0x7B, 0x2D, 0xB2, 0xD6, 0xE4, 0x7B, 0x78, 0xB3, 0xDB,
+    0x5D, 0xAD, 0xA4, 0x2F, 0x4B, 0x23, 0xED, 0x70, 0x71, 0x19, 0xD4, 0x07, 0x38, 0x5C, 0xD6, 0x35,
+    0x2B, 0x7D, 0x4D, 0x9A, 0x1F, 0x6E, 0x1E, 0xBE, 0x12, 0xCD, 0xDA, 0x0E, 0xEE, 0xDD, 0xC5, 0xAC,
+    0x75, 0x57, 0x75, 0x77, 0xB9, 0x0C, 0x1F, 0x93, 0xE6, 0x4A, 0x2B, 0xC5, 0xF2, 0x61, 0xBC, 0xD6,
+    0x44, 0xB2, 0xFE, 0x14, 0x29, 0x56, 0x52, 0x07, 0x0F, 0x77, 0x0F, 0xA5, 0xB1, 0x3A, 0x4B, 0x0D,
+    0x63, 0x49, 0x16, 0xF2, 0xFB, 0x69, 0xC8, 0x99, 0xEB, 0xC4, 0xBE, 0x27, 0x23, 0xF2, 0xC0, 0x2D,
+    0xDB, 0x1D, 0xC1, 0xA5, 0xDD, 0xD5, 0x56, 0x0D, 0x85, 0xF4, 0xBA, 0x22, 0xB4, 0x9A, 0x32, 0x8D,
+    0x49, 0xCD, 0xA7, 0x26, 0x89, 0x8F, 0xE2, 0xA6, 0x45, 0x0A, 0x49, 0x6D, 0xA4, 0x8E, 0x72, 0xC4,
+    0xBE, 0x15, 0x53, 0xB0, 0xDA, 0x16, 0xAD, 0xF5, 0x1D, 0x37, 0x61, 0x31, 0x4B, 0x0A, 0x56, 0x21,
+    0xA9, 0x8D, 0xFA, 0xAE, 0x1C, 0xB1, 0x83, 0x59, 0x52, 0xB0, 0x0A, 0x49, 0x6D, 0xD4, 0xFB, 0x9B,
+    0xB0, 0x60, 0xD6, 0x14, 0xB4, 0x21, 0x89, 0x8F, 0xDA, 0xAF, 0x8F, 0xD8, 0x01, 0xB3, 0xA6, 0xA0,
+    0xDD, 0xC4, 0x47, 0x6D, 0xD2, 0x22, 0xE5, 0x1A, 0x39, 0x3E, 0x05, 0xBB, 0xE2, 0x14, 0xA1, 0x1D,
+    0x0B, 0xC9, 0x27, 0x85, 0xFD, 0x9E, 0x4F, 0xDE, 0xB6, 0x04, 0x94, 0x93, 0x6B, 0x86, 0x3A, 0xC1,
+    0xD8, 0x36, 0x01, 0xBA, 0x54, 0x30, 0xC9, 0x0D, 0x78, 0xB6, 0xFE, 0xE2, 0xAE, 0xED, 0xFA, 0xDA,
+    0x90, 0xD6, 0xC4, 0x24, 0xED, 0xCD, 0x04, 0xBA, 0x95, 0x69, 0xC2, 0x46, 0x68, 0x03, 0xBD, 0x87,
+    0x36, 0x6C, 0xC2, 0x1B, 0x37, 0x02, 0xF2, 0x02, 0x72, 0x25, 0xDF, 0xE2, 0xE2, 0x92, 0xEA, 0x46,
+    0x0D, 0xE0, 0xDE, 0xDE, 0xA4, 0x4B, 0x01, 0xC8, 0xB5, 0x57, 0x35, 0x35, 0x40, 0xFD, 0x76, 0x92,
+    0xE5, 0x3C, 0x31, 0x03, 0x66, 0xA9, 0x93, 0xDE, 0xA6, 0xF5, 0x40, 0xDF, 0xA9, 0x03, 0x13, 0x73,
+    0x35, 0xE0, 0x46, 0x93, 0x04, 0xC6, 0x85, 0x1A, 0xEA, 0x89, 0x52, 0xDF, 0x79, 0x2A, 0xD5, 0x59,
+    0x92, 0x05, 0x69, 0x01, 0x78, 0xE4, 0xE5, 0xBB, 0x73, 0x91, 0x8A, 0xA0, 0xDE, 0x3C, 0xCD, 0x17,
+    0x4A, 0xC0, 0xA6, 0x71, 0xA6, 0x4D, 0x5C, 0xD9, 0x35, 0x7E, 0xDB, 0x0A, 0x20, 0x2D, 0x7B, 0x2C,
+    0x36, 0xB7, 0xFE, 0x0A, 0x60, 0xEE, 0xAC, 0x00, 0xEE, 0x6B, 0x2B, 0x60, 0x62, 0x16, 0x01, 0xDB,
+    0x25, 0xCC, 0x70, 0xD7, 0xF6, 0xEF, 0x75, 0x0D, 0xA8, 0xA4, 0x39, 0xAD, 0x02, 0x58, 0xC0, 0x9D,
+    0xD2, 0x2E, 0x18, 0x41, 0x15, 0xA9, 0x03, 0x54, 0x31, 0x13, 0x50, 0x4F, 0x49, 0x11, 0x15, 0x9C,
+    0x07, 0xFA, 0xD7, 0x74, 0x21, 0x2B, 0x9B, 0x42, 0x6D, 0x13, 0xAF, 0x6D, 0x05, 0xF0, 0x66, 0x38,
+    0x17, 0xAF, 0x6D, 0x05, 0xB0, 0x97, 0xBC, 0x7D, 0x3A, 0x02, 0x45, 0xAC, 0x02, 0x50, 0x8F, 0xA9,
+    0x44, 0xF7, 0x42, 0x2B, 0x79, 0xE8, 0x7D, 0xA6, 0x81, 0x72, 0x21, 0xD7, 0xE9, 0x67, 0xD2, 0x5A,
+    0x3D, 0xC5, 0xA4, 0xB2, 0x6B, 0x80, 0xC3, 0x93, 0x06, 0xE0, 0x2F, 0xF9, 0x43, 0xA0, 0x8C, 0x49,
+    0xF5, 0x12, 0xEA, 0x09, 0xE8, 0x7D, 0xEB, 0x81, 0x65, 0x03, 0xF8, 0x0F, 0xD8, 0x7E, 0x83, 0x65,
+    0x7B, 0x67, 0x9B, 0xD9, 0x56, 0x52, 0x6E, 0x60, 0xBD, 0x4D, 0x6D, 0xDF, 0xEE, 0xE7, 0xAD, 0x33,
+    0x17, 0xD5, 0x2F, 0x59, 0x77, 0xBF, 0x25, 0xDC, 0x35, 0x5C, 0xDA, 0x1D, 0x25, 0x91, 0xEC, 0xEA,
+    0x34, 0x53, 0x68, 0xA5, 0x1D, 0xE0, 0xF2, 0xFC, 0x91, 0xA8, 0x90, 0xEE, 0xB9, 0xD8, 0x36, 0xF4,
+    0x69, 0x9D, 0xE9, 0x06, 0xF8, 0xCB, 0x19, 0xF2, 0x98, 0x92, 0x9C, 0xA4, 0x19, 0x08, 0x4A, 0x35,
+    0x99, 0x3A, 0xD0, 0xFA, 0x8A, 0x3C, 0xDB, 0x4A, 0x8C, 0xCD, 0x57, 0x07, 0x7C, 0xE6, 0xC5, 0xBB,
+    0xB3, 0xB5, 0xA1, 0xAB, 0x8D, 0xC4, 0x2B, 0x97, 0x6D, 0x32, 0xBF, 0xF9, 0x06, 0x39, 0x47, 0xC6,
+    0xE7, 0x03, 0xF4, 0x6F, 0x6D, 0x99, 0x5C, 0x4E, 0x95, 0x6E, 0x23, 0x17, 0x04, 0x38, 0xF6, 0xDD,
+    0xCD, 0x55, 0x9F, 0x1A, 0x6D, 0x30, 0x13, 0x60, 0x46, 0x3E, 0x79, 0x6F, 0x61, 0x1C, 0xEC, 0x76,
+    0xB0, 0xDB, 0x6D, 0x92, 0xF6, 0x59, 0x1A, 0xA9, 0x12, 0x88, 0xE1, 0x78, 0xFC, 0x28, 0xD5, 0x6A,
+    0xDB, 0xC5, 0x6C, 0x39, 0x57, 0xAB, 0x6D, 0x65, 0x32, 0x42, 0x99, 0xA4, 0x3B, 0x66, 0x06, 0x75,
+    0x49, 0x58, 0xB6, 0x50, 0xAC, 0x60, 0x74, 0xE7, 0xBA, 0x00, 0x97, 0x3A, 0x75, 0xB6, 0x19, 0xC8,
+    0x6C, 0xF3, 0xDF, 0x3F, 0xC2, 0xC3, 0x0D, 0x50, 0x05, 0x3B, 0x01, 0xE5, 0x52, 0xAC, 0x40, 0xAE,
+    0x2C, 0xD9, 0xE4, 0x07, 0x21, 0xDB, 0x3D, 0x7A, 0xFB, 0xAD, 0x91, 0xEE, 0xA5, 0xED, 0x3F, 0xB3,
+    0x09, 0x68, 0xF2, 0xF5, 0x6C, 0xDE, 0xD8, 0x0E, 0x7B, 0xC9, 0x50, 0xE2, 0x81, 0xBE, 0x74, 0x7F,
+    0x39, 0xFC, 0xB3, 0x89, 0x4F, 0xB6, 0x6E, 0xDC, 0xEC, 0xB5, 0x41, 0x55, 0xD8, 0xBB, 0xDF, 0xFB,
+    0x6E, 0xA3, 0x68, 0x53, 0x93, 0x1D, 0x7E, 0x95, 0x89, 0xFC, 0xD8, 0x7E, 0xFA, 0x5F, 0x0A, 0xA8,
+    0xD4, 0x81, 0xBB, 0x3E, 0x40, 0x5F, 0x06, 0xB2, 0x98, 0x48, 0xDB, 0x99, 0xAC, 0xE3, 0xE8, 0x57,
+    0x56, 0x88, 0x66, 0x36, 0x33, 0x65, 0x2C, 0x63, 0xFA, 0x97, 0xDC, 0x69, 0x0F, 0xDA, 0xFE, 0x79,
+    0xAB, 0xF6, 0xA3, 0x14, 0xE9, 0x50, 0xCE, 0x9B, 0xFC, 0xF3, 0xA9, 0xFD, 0x77, 0x07, 0xFA, 0x8D,
+    0x53, 0xE8, 0x1B, 0xF8, 0xC4, 0x96, 0x84, 0xDC, 0xEF, 0x95, 0x65, 0xD3, 0x26, 0xD2, 0xCE, 0xCF,
+    0x16, 0xED, 0xDA, 0x11, 0xF8, 0x0F, 0xF7, 0x17, 0xD1, 0x35, 0x0A, 0xA9, 0xCB, 0xF5, 0xCA, 0x4A,
+    0xDB, 0xD8, 0xC9, 0x8E, 0xB8, 0x2F, 0x47, 0x4C, 0x74, 0x1D, 0xF5, 0xEB, 0x33, 0x59, 0x12, 0xD1,
+    0x48, 0x8A, 0xED, 0xC9, 0xC9, 0xC9, 0xF3, 0xD3, 0xF6, 0x5A, 0xB3, 0x09, 0xC8, 0xD3, 0x1B, 0xAA,
+    0x85, 0xAC, 0xE9, 0xF5, 0xCA, 0x9C, 0x4B, 0x6A, 0x0A, 0x69, 0x20, 0x3B, 0xEF, 0x99, 0xFF, 0x72,
+    0xDF, 0xB4, 0xFB, 0x6D, 0xDD, 0xAE, 0x59, 0xF6, 0x2B, 0xF9, 0x87, 0x3D, 0xD9, 0xF3, 0xCF, 0x99,
+    0xA8, 0x87, 0xB6, 0x85, 0xDB, 0x46, 0x5D, 0xD2, 0x3B, 0xD9, 0x6F, 0x85, 0x24, 0x72, 0xE9, 0x89,
+    0x58, 0x5F, 0x0C, 0x7C, 0xEE, 0xFC, 0x03, 0x26, 0x1F, 0xBD, 0xDC, 0x08, 0xA8, 0x86, 0x6A, 0x30,
+    0x32, 0xC2, 0x8D, 0x2E, 0xE4, 0x4B, 0xF6, 0x40, 0xA2, 0xF2, 0xA3, 0x4E, 0xC6, 0xEF, 0x82, 0x6B,
+    0x70, 0x1E, 0x17, 0xB0, 0xE9, 0xAB, 0x23, 0x2D, 0x17, 0x74, 0x7A, 0x1F, 0x58, 0x0B, 0xC3, 0x57,
+    0x20, 0x62, 0x16, 0xCA, 0x48, 0x15, 0x70, 0x9E, 0xF6, 0x2E, 0x9B, 0xFC, 0x81, 0x9E, 0x9F, 0x41,
+    0x3D, 0x60, 0x23, 0x56, 0xBE, 0x7C, 0x77, 0x36, 0x53, 0x7B, 0x65, 0x2A, 0x7E, 0x38, 0x73, 0xE3,
+    0x0F, 0xF8, 0x17, 0xFB, 0x91, 0xFF, 0x1F, 0xA8, 0xD5, 0x58, 0x0D, 0x7C, 0x76, 0xDA, 0xBB, 0x6D,
+    0x93, 0x27, 0xF7, 0xA7, 0x06, 0x32, 0xDD, 0x2A, 0xA5, 0xD7, 0xD3, 0x3A, 0xF0, 0x3C, 0xE6, 0xD1,
+    0x0D, 0xEE, 0xBB, 0x8B, 0x59, 0x9D, 0xAF, 0xFD, 0x3D, 0xD0, 0xE2, 0x1F, 0x28, 0x35, 0xA0, 0x85,
+    0xAC, 0x1D, 0xC8, 0x16, 0xA8, 0x7E, 0xEE, 0x43, 0x7B, 0x4A, 0xAF, 0x68, 0x2F, 0x10, 0x87, 0xF5,
+    0xF0, 0x6F, 0x80, 0x7A, 0x2D, 0x3D, 0x58, 0xBD, 0x13, 0xC0, 0x04, 0xCD, 0xC0, 0xFF, 0xB2, 0x11,
+    0x78, 0x68, 0x5B, 0xE6, 0x7D, 0x1F, 0x93, 0x3D, 0x5E, 0x56, 0x43, 0x1B, 0x5B, 0xCD, 0x38, 0xB5,
+    0x52, 0x73, 0xD8, 0xEB, 0x5A, 0x1B, 0x28, 0xD6, 0xFD, 0xC7, 0x65, 0xFA, 0x0F, 0x2A, 0x0F, 0x49,
+    0x17, 0x0A, 0x35, 0xF4, 0xB7, 0x2A, 0xC5, 0x5C, 0xFA, 0x6B, 0x89, 0x6D, 0xA5, 0xFC, 0x06, 0xE1,
+    0x93, 0xC0, 0x2C, 0x4D, 0x8D, 0xC2, 0xD9, 0xBC, 0xB5, 0x1E, 0xCF, 0xB0, 0x7D, 0xF9, 0x00, 0x36,
+    0xE3, 0x50, 0x33, 0x58, 0xA5, 0x0F, 0x89, 0xAC, 0xD8, 0x29, 0xD3, 0x60, 0x03, 0x36, 0x16, 0x13,
+    0xE8, 0x53, 0x11, 0xEA, 0x71, 0x85, 0x22, 0xBA, 0x0E, 0x54, 0xDD, 0xAB, 0x31, 0xF1, 0x20, 0x1B,
+    0xC0, 0x3D, 0xB7, 0x40, 0xED, 0x7B, 0x8F, 0x1D, 0x6D, 0xC4, 0x86, 0x4C, 0xB7, 0x8E, 0x27, 0xEA,
+    0x4D, 0x5F, 0x39, 0x42, 0x76, 0x72, 0xE1, 0xED, 0xBF, 0xCF, 0x26, 0xC7, 0x4D, 0x96, 0xB3, 0xD8,
+    0xAB, 0x8A, 0xD3, 0xBF, 0x2C, 0x6E, 0x5F, 0xFA, 0xF9, 0x95, 0xA7, 0x36, 0x3B, 0xE3, 0xC5, 0xED,
+    0xB2, 0x57, 0x76, 0x15, 0xEF, 0x46, 0x30, 0x93, 0x6B, 0xC8, 0xE7, 0x22, 0x90, 0xCD, 0xDC, 0x80,
+    0x3F, 0xBC, 0x8B, 0x40, 0x81, 0xCB, 0x1A, 0xCF, 0x17, 0xCE, 0xCE, 0xB8, 0xA1, 0x50, 0xE3, 0x3C,
+    0x2E, 0x54, 0x03, 0x66, 0x29, 0x03, 0xF4, 0xCF, 0xCD, 0x50, 0x85, 0x0B, 0x52, 0x9D, 0xF3, 0xD4,
+    0x0A, 0x4C, 0x74, 0x1E, 0x56, 0x3B, 0x41, 0x9F, 0x0B, 0x5C, 0xE7, 0x02, 0xCE, 0x17, 0xFA, 0xAF,
+    0xFD, 0x40, 0x2F, 0x0D, 0x14, 0x52, 0x07, 0x87, 0x67, 0xC4, 0x45, 0xED, 0xAB, 0x01, 0x3B, 0xDB,
+    0x19, 0xB3, 0x9A, 0x15, 0xFA, 0x7B, 0x84, 0x75, 0x17, 0xBA, 0xFD, 0xAF, 0x40, 0x52, 0x94, 0xF0,
+    0xE2, 0xE6, 0x89, 0xD8, 0x56, 0xBE, 0x15, 0xC9, 0xEA, 0xA6, 0x85, 0x03, 0x45, 0x3C, 0x93, 0x45,
+    0x43, 0x36, 0x3E, 0x38, 0xE1, 0xBF, 0x06, 0x22, 0x12, 0xEE, 0x42, 0x96, 0x49, 0x4F, 0xBE, 0x9F,
+    0x1D, 0xA7, 0x59, 0x53, 0x72, 0x58, 0x27, 0xC7, 0x96, 0x6B, 0x20, 0x7D, 0x8A, 0xE2, 0xD7, 0x37,
+    0x3B, 0xCD, 0xB9, 0x22, 0x31, 0x57, 0x07, 0x64, 0x49, 0xCC, 0xB1, 0xF6, 0x90, 0x80, 0x28, 0xB4,
+    0x69, 0x95, 0x09, 0xB6, 0x83, 0xC3, 0xFB, 0x9C, 0xD8, 0x87, 0x5F, 0xE5, 0xE0, 0x1F, 0x68, 0x57,
+    0x2A, 0x75, 0xB5, 0xBA, 0x42, 0x43, 0x76, 0x3C, 0x72, 0xF9, 0x97, 0x37, 0x74, 0xD9, 0x0A, 0x6D,
+    0x83, 0x4B, 0xD9, 0x09, 0xD8, 0x09, 0xB3, 0x50, 0x2D, 0xD0, 0x9F, 0xF6, 0xFA, 0x0E, 0x56, 0x7A,
+    0x53, 0x03, 0xBD, 0x3E, 0xA5, 0x40, 0xF6, 0x12, 0x97, 0xCE, 0x2A, 0x65, 0x32, 0x33, 0xE4, 0xC9,
+    0x01, 0xD9, 0xFB, 0xDE, 0x43, 0x35, 0xD8, 0xF1, 0xFD, 0xDD, 0x90, 0x7C, 0xB1, 0xE3, 0xC9, 0xA1,
+    0xD0, 0x98, 0x69, 0xCE, 0x35, 0xD3, 0x2E, 0xFC, 0xDE, 0x4A, 0xF6, 0x41, 0x0C, 0x76, 0x2A, 0xFD,
+    0x99, 0xF4, 0xBD, 0x21, 0xD4, 0xE0, 0x86, 0x4C, 0x03, 0xA5, 0xFE, 0xBB, 0xD6, 0x23, 0xA4, 0xA8,
+    0x85, 0x52, 0x53, 0x2D, 0x78, 0xA4, 0xC9, 0x8E, 0x12, 0xD5, 0xBE, 0xDB, 0xED, 0x9A, 0x44, 0x21,
+    0x49, 0xE9, 0xAB, 0x3A, 0xD2, 0x42, 0xA1, 0xEF, 0x7C, 0xF6, 0xCE, 0xC9, 0x2B, 0x13, 0xFD, 0x48,
+    0x3D, 0x50, 0x0E, 0xC5, 0x02, 0x7D, 0x43, 0xD5, 0xB8, 0x81, 0x7C, 0x81, 0x4F, 0xE6, 0xDB, 0x12,
+    0xEB, 0x23, 0x1B, 0x36, 0x1F, 0x63, 0xDB, 0x25, 0xB0, 0x97, 0x2F, 0x9B, 0xBB, 0x6F, 0xFB, 0x18,
+    0x42, 0x82, 0x6A, 0xF5, 0x7B, 0x4A, 0x1F, 0x49, 0xE8, 0xA5, 0x60, 0x62, 0x62, 0xEA, 0xFC, 0xDD,
+    0xB7, 0x0C, 0x7B, 0xD9, 0x4A, 0x93, 0x66, 0x77, 0xF9, 0xB2, 0x75, 0xD0, 0x72, 0x82, 0x8F, 0xDB,
+    0x39, 0xDD, 0x12, 0xAA, 0x09, 0xFA, 0x86, 0x62, 0xA8, 0xE7, 0xB4, 0x96, 0xA7, 0x71, 0x0B, 0xE5,
+    0x44, 0x16, 0xA9, 0xF5, 0x9D, 0xED, 0x3B, 0x19, 0x69, 0x51, 0x82, 0xE7, 0x50, 0xFB, 0x0F, 0x84,
+    0x5C, 0xDA, 0xDD, 0x63, 0xD3, 0x07, 0xEA, 0x15, 0x5A, 0x2D, 0xB9, 0x34, 0x66, 0x92, 0x3E, 0xBD,
+    0xF6, 0x53, 0x11, 0xE9, 0xBF, 0x3F, 0x14, 0xD1, 0x06, 0x2A, 0x35, 0xD9, 0x52, 0xA5, 0x85, 0x9B,
+    0xAB, 0x4B, 0x0B, 0xA9, 0xE4, 0xBA, 0xD4, 0xBC, 0xDB, 0x2E, 0x7D, 0x7A, 0xA4, 0xED, 0xC8, 0x24,
+    0xAD, 0x6D, 0x47, 0xB6, 0x9E, 0x9C, 0xBC, 0xDC, 0x76, 0x69, 0x1C, 0x69, 0x7D, 0x4A, 0xFE, 0xF6,
+    0x3B, 0xDC, 0x90, 0x06, 0xC6, 0x3A, 0x24, 0x73, 0x5E, 0xCD, 0xD4, 0x9A, 0x78, 0xA8, 0xD4, 0x7F,
+    0xD4, 0x75, 0xBD, 0xB3, 0x18, 0x69, 0x2D, 0xA5, 0x48, 0xAF, 0x29, 0x93, 0x46, 0x0E, 0x5F, 0x86,
+    0x83, 0xBF, 0xE1, 0x81, 0x8B, 0x2C, 0xF6, 0x5F, 0x45, 0xD1, 0x7D, 0xDB, 0x9D, 0x93, 0xFD, 0x06,
+    0xF9, 0x50, 0x67, 0xB3, 0xF5, 0xAD, 0x99, 0xED, 0xE8, 0xBC, 0x8C, 0xD2, 0x04, 0xAA, 0x35, 0x2A,
+    0xA2, 0x0D, 0xB5, 0xEF, 0xCD, 0x64, 0xFD, 0xAB, 0x26, 0xD4, 0xFB, 0x69, 0xC5, 0x60, 0x7C, 0x8D,
+    0xCB, 0xE6, 0x3C, 0x58, 0x5F, 0xF9, 0x96, 0x57, 0xCD, 0x6C, 0x26, 0x3B, 0x56, 0xDE, 0xF9, 0xBE,
+    0x51, 0x2E, 0xA3, 0x62, 0x31, 0x73, 0xB9, 0xD7, 0x97, 0x65, 0x31, 0x9F, 0x5D, 0x68, 0xBF, 0xA1,
+    0x7C, 0xB5, 0xC1, 0x86, 0x9E, 0xB5, 0x0C, 0x76, 0x58, 0x88, 0xD6, 0xD7, 0x7F, 0x35, 0x99, 0xE0,
+    0x78, 0xA6, 0xF4, 0xC9, 0x06, 0x1D, 0x36, 0x64, 0xD7, 0xC8, 0xBE, 0xE2, 0x46, 0xEC, 0x44, 0x19,
+    0xDB, 0x40, 0x3D, 0x63, 0x97, 0xFD, 0xD1, 0x0D, 0x54, 0x81, 0x32, 0x1E, 0x40, 0xD6, 0x90, 0x1D,
+    0xFD, 0x7F, 0xD5, 0x9A, 0x31, 0x8C, 0x3F, 0xC7, 0x75, 0xDF, 0x3F, 0xB3, 0xAB, 0xFF, 0x2D, 0xCC,
+    0x85, 0x33, 0x2A, 0x78, 0x86, 0xAD, 0x7F, 0xB1, 0x29, 0x83, 0x14, 0xD9, 0xD6, 0x85, 0xAC, 0x59,
+    0x99, 0x40, 0x54, 0xA4, 0xB9, 0x00, 0xB7, 0xB2, 0x43, 0x16, 0x4C, 0x91, 0xC6, 0x32, 0x90, 0x4B,
+    0x91, 0x92, 0xFC, 0xEF, 0x0A, 0x0E, 0xE0, 0x52, 0x17, 0x43, 0xAC, 0xAD, 0xE2, 0x2F, 0x44, 0x3E,
+    0x02, 0x61, 0x93, 0x22, 0x08, 0xF8, 0xE7, 0x8E, 0xC8, 0x82, 0xED, 0x22, 0x4E, 0xA0, 0xD2, 0xAB,
+    0x84, 0x46, 0x40, 0xBA, 0xD0, 0x58, 0x5A, 0x1B, 0x7B, 0xC7, 0x99, 0xFD, 0xBA, 0x98, 0xFD, 0xDD,
+    0xFF, 0xFE, 0x22, 0x65, 0x28, 0x76, 0x6C, 0x2B, 0x07, 0xDC, 0xBC, 0x79, 0x33, 0xFB, 0x9B, 0x7D,
+    0xFB, 0x66, 0xE6, 0xBD, 0xEF, 0x7B, 0x33, 0x7C, 0x89, 0x97, 0x3A, 0xAA, 0x58, 0x26, 0x98, 0xE6,
+    0x61, 0xA1, 0x8E, 0x65, 0x82, 0xB6, 0x6B, 0x47, 0x7E, 0xFA, 0xEF, 0xBC, 0xEF, 0xFB, 0xBE, 0x92,
+    0xA4, 0x6D, 0x90, 0xA4, 0xB1, 0xB9, 0xBB, 0x79, 0x7B, 0x43, 0xD0, 0x8C, 0x36, 0xC0, 0x86, 0xC0,
+    0x76, 0x36, 0xC0, 0x05, 0x02, 0xB0, 0x01, 0x78, 0xA1, 0xFA, 0x8E, 0x56, 0xAC, 0xA4, 0x0E, 0x49,
+    0xE1, 0x73, 0x1E, 0x38, 0x55, 0x5F, 0x46, 0x50, 0xCE, 0x36, 0xC0, 0x9B, 0x08, 0xEA, 0xD9, 0x06,
+    0x48, 0x67, 0x92, 0xF4, 0x81, 0x24, 0xC5, 0x2C, 0x03, 0x70, 0x96, 0xC5, 0x1B, 0xB2, 0xC4, 0xF2,
+    0x00, 0x46, 0x33, 0x40, 0xA9, 0x25, 0x93, 0x00, 0x50, 0xFF, 0x60, 0x05, 0xB0, 0x1F, 0x44, 0x80,
+    0xE6, 0xF7, 0x22, 0x80, 0x33, 0x09, 0x60, 0xC8, 0xAF, 0x7E, 0x96, 0x49, 0x64, 0x18, 0xA1, 0xD8,
+    0x70, 0x1E, 0xCA, 0x95, 0x76, 0x86, 0x2A, 0xD0, 0x2C, 0x60, 0x25, 0x85, 0x4C, 0x56, 0x68, 0x3F,
+    0xB9, 0x79, 0x3B, 0x82, 0xEB, 0x28, 0x23, 0x0C, 0x50, 0xEC, 0xB0, 0x83, 0x11, 0x26, 0x02, 0xEA,
+    0x8A, 0x08, 0x4C, 0x63, 0x95, 0x3A, 0x0A, 0x7D, 0x34, 0x29, 0xE0, 0x24, 0x29, 0x30, 0x48, 0xE7,
+    0x7D, 0xDF, 0x5F, 0x56, 0x92, 0xB4, 0x0C, 0x92, 0x12, 0xCD, 0xDD, 0xCD, 0x34, 0x23, 0x48, 0xD8,
+    0x40, 0xED, 0x11, 0xBC, 0x81, 0x0D, 0x94, 0xDD, 0x67, 0xB5, 0xF4, 0x17, 0x3D, 0x20, 0xE9, 0x1A,
+    0x2B, 0xC9, 0xA3, 0xFE, 0x1D, 0x61, 0x03, 0x4D, 0x44, 0xE0, 0x66, 0x1B, 0x28, 0x76, 0x04, 0xCD,
+    0x62, 0x03, 0xE6, 0x79, 0xB5, 0x4C, 0x08, 0x06, 0x6F, 0x03, 0xED, 0x7A, 0xA6, 0x9B, 0x29, 0x95,
+    0x92, 0xD4, 0x0D, 0xD2, 0x7E, 0xCC, 0xB5, 0x79, 0x75, 0x7A, 0x4A, 0x25, 0x69, 0x63, 0x90, 0x14,
+    0x68, 0x42, 0xA1, 0x11, 0x51, 0x45, 0x6C, 0xA0, 0x9D, 0x11, 0x26, 0x61, 0x03, 0xF6, 0x79, 0xB5,
+    0xF1, 0x88, 0x72, 0xC3, 0x06, 0x26, 0x90, 0xE4, 0xB1, 0x92, 0x46, 0x74, 0x33, 0xED, 0xD8, 0x40,
+    0xBB, 0x22, 0x98, 0xBC, 0x0D, 0x94, 0x11, 0x41, 0xEB, 0x6D, 0xA0, 0xC8, 0xF2, 0x3E, 0x6F, 0xD5,
+    0x68, 0x03, 0x43, 0x78, 0x2E, 0x19, 0x0F, 0x24, 0x3B, 0xEF, 0xFB, 0xFE, 0x72, 0x90, 0xB4, 0x0F,
+    0x92, 0x76, 0xA3, 0x9B, 0xB7, 0x53, 0xD6, 0xD8, 0xA9, 0x88, 0x08, 0xDE, 0xCD, 0xAA, 0x13, 0x7C,
+    0x31, 0xAB, 0xEB, 0x6F, 0x5B, 0x9C, 0xE9, 0x63, 0x70, 0x52, 0xC7, 0x20, 0x01, 0xA6, 0xEF, 0xFB,
+    0xFE, 0x02, 0x2B, 0x49, 0x5B, 0x26, 0x0B, 0xBC, 0xFE, 0xC9, 0xDB, 0x09, 0xB0, 0xBE, 0x88, 0x0F,
+    0xC8, 0x58, 0x44, 0xA0, 0x39, 0x48, 0x5E, 0x12, 0x6D, 0x26, 0x8E, 0xCF, 0x21, 0x4F, 0x32, 0x79,
+    0x96, 0x49, 0x7C, 0x48, 0xCC, 0x46, 0x11, 0xA1, 0x58, 0x29, 0x22, 0x94, 0x81, 0x22, 0x42, 0xBD,
+    0x50, 0x44, 0xB0, 0x33, 0x45, 0x84, 0xD6, 0x53, 0x44, 0x18, 0x3A, 0xCA, 0xC8, 0x63, 0x49, 0xD2,
+    0x53, 0x27, 0x49, 0x8A, 0x27, 0xE2, 0x81, 0xF2, 0x44, 0xDA, 0x83, 0x8C, 0x40, 0xB1, 0x35, 0x1D,
+    0x60, 0xD6, 0x83, 0x58, 0x00, 0xC2, 0x2F, 0x01, 0xF0, 0xAF, 0x7F, 0x31, 0x2D, 0xC0, 0x53, 0x1E,
+    0xF5, 0x3D, 0x3C, 0xC5, 0x05, 0xA4, 0x8D, 0x61, 0x2E, 0x35, 0x5A, 0xED, 0x34, 0x09, 0x97, 0x28,
+    0x13, 0xA5, 0x66, 0xF3, 0x5A, 0xA0, 0xF5, 0x4C, 0xBF, 0x0D, 0xED, 0x58, 0x44, 0xAC, 0x07, 0x22,
+    0xAD, 0x2F, 0x56, 0xA0, 0x5A, 0x8A, 0xC8, 0x00, 0xE0, 0x68, 0xBD, 0xF5, 0x00, 0xB1, 0x88, 0x66,
+    0x03, 0xA8, 0xE7, 0xD6, 0x3B, 0x00, 0x5C, 0x11, 0xAB, 0x39, 0x9B, 0x17, 0x29, 0xE6, 0x26, 0x29,
+    0x9B, 0x9A, 0xEA, 0x6E, 0xF8, 0x44, 0xD9, 0x02, 0x15, 0xB1, 0xDA, 0x00, 0xDA, 0xB9, 0xF5, 0xCE,
+    0x03, 0x55, 0x2C, 0xA2, 0x39, 0x56, 0x52, 0xEB, 0xEB, 0x15, 0x68, 0x97, 0x22, 0xE2, 0x3C, 0x54,
+    0x91, 0xD6, 0x17, 0x02, 0x34, 0x16, 0x11, 0xBB, 0x81, 0x0B, 0xB4, 0x9E, 0x61, 0xA6, 0x4E, 0x14,
+    0x91, 0x52, 0x5D, 0xA1, 0x91, 0xE9, 0x16, 0x9B, 0xD0, 0x92, 0xBF, 0x71, 0x75, 0x1B, 0x56, 0x1A,
+    0x8D, 0x7E, 0xF8, 0xBD, 0x63, 0xCB, 0x3E, 0xE5, 0xB1, 0x16, 0x0A, 0x69, 0xCF, 0x06, 0xC1, 0x6E,
+    0x4C, 0x8B, 0xF5, 0x34, 0xA1, 0xF1, 0xD8, 0xD0, 0x8C, 0xD4, 0xC1, 0x76, 0xD8, 0x70, 0x76, 0xE8,
+    0xBA, 0x59, 0x00, 0xE7, 0x81, 0xA9, 0xA3, 0x56, 0x82, 0x5A, 0xEA, 0x28, 0xA5, 0x05, 0x18, 0x56,
+    0xC0, 0x46, 0xA0, 0x4A, 0x40, 0x99, 0x8B, 0x5F, 0x86, 0x32, 0x39, 0x28, 0xE3, 0xD0, 0x51, 0xC7,
+    0x69, 0xA6, 0x09, 0x2E, 0x19, 0xCD, 0x8D, 0xA4, 0xAE, 0x90, 0x36, 0xF8, 0x95, 0x3F, 0x82, 0xF3,
+    0xFE, 0x12, 0xD3, 0xF7, 0x5F, 0x93, 0x66, 0xA4, 0x38, 0x68, 0xA3, 0x96, 0xBA, 0x66, 0xCD, 0x26,
+    0x52, 0x40, 0x33, 0x63, 0x43, 0x1E, 0x58, 0x80, 0x32, 0xEB, 0x32, 0x6B, 0x33, 0x5B, 0xEE, 0x99,
+    0x55, 0x7E, 0xD8, 0x7D, 0x3F, 0x81, 0xB0, 0xA1, 0x99, 0xB1, 0xA1, 0x8C, 0x26, 0x81, 0x98, 0xF2,
+    0x50, 0xAD, 0x37, 0x09, 0x54, 0x07, 0x9A, 0x19, 0xFB, 0xE3, 0x88, 0x49, 0xA0, 0x29, 0xBF, 0x48,
+    0x3E, 0xB3, 0x21, 0xB3, 0x91, 0xCC, 0x3E, 0x17, 0xC3, 0x24, 0xCE, 0xF4, 0x14, 0x86, 0xBB, 0x52,
+    0x9A, 0x99, 0x14, 0x07, 0x25, 0xAC, 0xE4, 0xE1, 0x57, 0x39, 0xEB, 0x00, 0xEB, 0x79, 0x0F, 0x20,
+    0x61, 0x17, 0xC0, 0xAE, 0x45, 0x3A, 0x96, 0xC0, 0x08, 0x30, 0xE5, 0x85, 0xC0, 0xF9, 0x67, 0x3C,
+    0x27, 0xA6, 0xEF, 0x3B, 0xCE, 0xFB, 0xCB, 0x63, 0xC8, 0x0F, 0xA5, 0x91, 0x49, 0xAB, 0x51, 0x07,
+    0xED, 0x72, 0x7A, 0x3F, 0x02, 0x5C, 0x16, 0xC7, 0x66, 0xB6, 0x3C, 0xB4, 0xA2, 0xCC, 0xBA, 0x1F,
+    0xCD, 0xD8, 0x80, 0xFD, 0xF3, 0x04, 0xA2, 0x8C, 0x59, 0x76, 0xE5, 0xDF, 0x3A, 0xDF, 0xCC, 0xD8,
+    0x50, 0x07, 0x93, 0x40, 0x45, 0xCC, 0x5F, 0x36, 0xE5, 0x91, 0x5B, 0x4F, 0x33, 0x63, 0x3F, 0x0D,
+    0x99, 0x8D, 0x87, 0x56, 0x8E, 0xF7, 0xFA, 0x87, 0x6A, 0x38, 0x69, 0xE5, 0xEA, 0xAE, 0xA3, 0xD2,
+    0x77, 0x9C, 0x12, 0xB5, 0xF4, 0xE1, 0x31, 0x93, 0xE7, 0xFD, 0x25, 0xE6, 0x3B, 0x95, 0xB4, 0x20,
+    0x3F, 0x68, 0xA3, 0x8D, 0x34, 0x2B, 0x95, 0x3C, 0x82, 0xFD, 0xB7, 0xB1, 0x81, 0x76, 0x04, 0x51,
+    0x06, 0xB0, 0x81, 0x67, 0x80, 0xB0, 0x1E, 0x6C, 0x28, 0x03, 0x20, 0x9E, 0x00, 0x36, 0x58, 0x0F,
+    0x48, 0x1B, 0x1C, 0x6A, 0x46, 0xDF, 0x48, 0xB9, 0x27, 0x3F, 0x36, 0x8C, 0x60, 0x43, 0x99, 0x00,
+    0xD1, 0xE4, 0xD1, 0xA6, 0x3C, 0x74, 0x02, 0x1B, 0x68, 0x43, 0x5E, 0x1C, 0x1E, 0x1B, 0xA8, 0xC4,
+    0x99, 0x9E, 0xD2, 0xC6, 0x52, 0x5A, 0x98, 0xC2, 0xA0, 0x44, 0x91, 0xD1, 0x40, 0xF1, 0x94, 0x47,
+    0xD9, 0x5C, 0xBB, 0x6C, 0xA7, 0x25, 0x69, 0x87, 0xC7, 0x77, 0xDF, 0x50, 0x07, 0x8D, 0x2F, 0xB3,
+    0xD5, 0xB5, 0x01, 0x4C, 0x76, 0xFA, 0xD5, 0x92, 0xD5, 0x30, 0x96, 0xD9, 0x12, 0xDB, 0x00, 0xC5,
+    0x8A, 0xF3, 0x60, 0x7D, 0x9E, 0x28, 0xCA, 0x6C, 0x96, 0x6D, 0x80, 0x2A, 0xE0, 0x3C, 0xB4, 0x23,
+    0x02, 0x9E, 0x51, 0x66, 0xE3, 0x6C, 0x03, 0x34, 0x1E, 0xE7, 0xE1, 0xBD, 0x3C, 0x9F, 0x81, 0x32,
+    0x9B, 0x68, 0x1B, 0x8A, 0xAF, 0x26, 0x70, 0xDE, 0xFE, 0x68, 0x01, 0x31, 0x08, 0x1E, 0xEB, 0x0F,
+    0xB4, 0x52, 0x49, 0xFF, 0x47, 0xE0, 0xA4, 0x7F, 0x7E, 0x7D, 0xAC, 0x9E, 0x4B, 0xA0, 0xBF, 0x64,
+    0xD0, 0x0C, 0x4E, 0x4B, 0xA9, 0x1D, 0x4A, 0x45, 0x0A, 0x05, 0x98, 0x36, 0x68, 0xD4, 0x61, 0xD5,
+    0x61, 0x3E, 0xDD, 0xE0, 0xD3, 0x0D, 0x9A, 0xC1, 0xD3, 0x0E, 0x23, 0xC5, 0x5F, 0x46, 0xCA, 0x1F,
+    0x6F, 0xD0, 0xDA, 0x99, 0xAF, 0xB4, 0x9E, 0x32, 0x88, 0xFA, 0xFD, 0x08, 0xAE, 0x0E, 0xC4, 0xC6,
+    0x53, 0x06, 0xD7, 0xD9, 0x6F, 0x46, 0x70, 0xE5, 0x56, 0x84, 0xC6, 0x53, 0x86, 0xC6, 0x3B, 0x12,
+    0x3C, 0x21, 0x55, 0xB3, 0x9D, 0xA9, 0x16, 0xBB, 0xBC, 0x9B, 0x1B, 0x06, 0x3B, 0xDA, 0x85, 0x7A,
+    0x2E, 0xFF, 0x62, 0x65, 0x87, 0x67, 0xB4, 0xEF, 0x60, 0x17, 0xEC, 0x6C, 0xB4, 0x64, 0xDF, 0x6B,
+    0x13, 0x75, 0xC0, 0x7A, 0x26, 0xCF, 0x04, 0x91, 0x6A, 0x3B, 0x1A, 0x5C, 0xC7, 0xC0, 0xD9, 0x7E,
+    0x61, 0xBE, 0x43, 0xB3, 0x7F, 0x4D, 0x1A, 0xA1, 0xD5, 0x3E, 0x69, 0x85, 0x52, 0x9A, 0x1F, 0x5A,
+    0x8C, 0xE9, 0x45, 0x8B, 0x71, 0xA6, 0x63, 0x51, 0x1E, 0x5B, 0x65, 0xFF, 0xBF, 0x65, 0xF3, 0xAC,
+    0xDB, 0x63, 0xDA, 0x4F, 0xEC, 0xDF, 0x68, 0xA8, 0x17, 0xD8, 0xC3, 0x62, 0xBC, 0x22, 0x2D, 0x0C,
+    0x0F, 0x2D, 0xC6, 0x4B, 0xFA, 0x08, 0xA8, 0x32, 0x6C, 0x99, 0x24, 0x75, 0xD8, 0xBD, 0x6B, 0xD4,
+    0x21, 0x4F, 0x25, 0xEA, 0x08, 0x95, 0x18, 0x3C, 0xD4, 0xA9, 0xDC, 0x01, 0x1B, 0x6D, 0x00, 0xDA,
+    0x30, 0x79, 0xC0, 0xFD, 0xF1, 0x0E, 0xA0, 0x6F, 0xAD, 0x40, 0xB9, 0x3B, 0x0F, 0xD4, 0x9B, 0x00,
+    0xDA, 0x9F, 0x44, 0x80, 0xE9, 0x5B, 0x2B, 0x50, 0xEC, 0x6E, 0x06, 0xEC, 0xAA, 0x11, 0x70, 0xFF,
+    0x5D, 0x80, 0x51, 0x15, 0x81, 0x7A, 0xB3, 0x1B, 0xE0, 0x7C, 0xBB, 0x42, 0xB9, 0xE3, 0x02, 0xB4,
+    0x81, 0x61, 0xA5, 0x50, 0xC7, 0xB4, 0xF7, 0xD3, 0x0A, 0x83, 0x24, 0xA0, 0xCD, 0x4E, 0xCC, 0xDC,
+    0x5C, 0x1F, 0x30, 0xBF, 0xEF, 0x1B, 0x49, 0x92, 0x3E, 0xCC, 0x64, 0xAE, 0xF6, 0x9B, 0xAF, 0xBF,
+    0x7D, 0x4C, 0xC3, 0x30, 0xE2, 0xFC, 0xBD, 0x1A, 0xAA, 0x8D, 0x32, 0x3E, 0x57, 0xCE, 0xDF, 0x73,
+    0xE7, 0x99, 0x9E, 0x62, 0xF4, 0xB1, 0x95, 0xC6, 0x2A, 0x1B, 0xA9, 0x42, 0x0A, 0xE6, 0xD5, 0xE9,
+    0x29, 0x8D, 0xA4, 0xB5, 0x92, 0xA4, 0xB1, 0x8A, 0x0C, 0x1B, 0xA2, 0x14, 0xCE, 0x67, 0x68, 0x5C,
+    0xAF, 0x65, 0x3C, 0x40, 0xF1, 0xD0, 0x39, 0x4F, 0x3B, 0xDB, 0x80, 0x0D, 0x65, 0xA4, 0xDA, 0x32,
+    0xCE, 0x75, 0xFE, 0x71, 0xC2, 0x4A, 0x89, 0x52, 0xDA, 0x40, 0x37, 0xDD, 0xE1, 0x2E, 0x6D, 0x80,
+    0xBC, 0xFB, 0x33, 0x5C, 0xF9, 0xA9, 0xC6, 0x33, 0xFD, 0xD1, 0x61, 0xD2, 0x2A, 0xE5, 0xC8, 0xE3,
+    0xEC, 0xBD, 0x6F, 0x43, 0x2D, 0xAD, 0xD4, 0x92, 0xC6, 0x42, 0x6F, 0x5D, 0x6D, 0x4C, 0x1E, 0x37,
+    0x36, 0x0B, 0xC5, 0x56, 0x46, 0x68, 0xC6, 0xA9, 0x83, 0xD5, 0x06, 0xF8, 0x25, 0xB3, 0x67, 0xF8,
+    0x70, 0xFF, 0x96, 0x03, 0xA9, 0x7D, 0x6E, 0x35, 0xFB, 0xA0, 0x05, 0x28, 0x04, 0xD0, 0x6C, 0x64,
+    0x6F, 0x0A, 0x95, 0x46, 0xA0, 0xD5, 0x35, 0xFF, 0x96, 0x49, 0xD2, 0x9C, 0x71, 0x4B, 0x21, 0x25,
+    0xE0, 0xD5, 0x6F, 0xE7, 0xB9, 0xBE, 0x1C, 0x24, 0x29, 0x1D, 0xE5, 0xCD, 0x3B, 0x77, 0x37, 0xE9,
+    0x09, 0x4D, 0x20, 0x3D, 0xA3, 0x09, 0xC4, 0x37, 0x68, 0x02, 0xEF, 0xBE, 0x41, 0x13, 0xF8, 0xAF,
+    0x2F, 0xD3, 0x04, 0xBE, 0x08, 0x4D, 0x80, 0xBF, 0x9B, 0x72, 0xB8, 0xBB, 0x86, 0x46, 0x0A, 0xD0,
+    0x4A, 0x81, 0xF3, 0xBE, 0xE7, 0x51, 0x7F, 0x39, 0x69, 0xC7, 0x29, 0x0E, 0x8A, 0xB4, 0xDA, 0xCE,
+    0xD4, 0xC1, 0xD4, 0xA1, 0x0E, 0x76, 0x18, 0x3C, 0x26, 0x82, 0x9B, 0x29, 0x37, 0x68, 0x02, 0x55,
+    0x00, 0xBB, 0x62, 0x17, 0xA8, 0x36, 0x1A, 0x0F, 0x65, 0xA4, 0x1D, 0xC1, 0xEC, 0xB8, 0x3C, 0x6B,
+    0xEF, 0xE5, 0x90, 0x31, 0xEB, 0xF1, 0xFD, 0x0D, 0xA0, 0xF9, 0xDF, 0x39, 0x4A, 0xFC, 0xF4, 0x88,
+    0x19, 0xB3, 0xEB, 0x50, 0xC7, 0xFD, 0x3C, 0xC3, 0xB3, 0x4C, 0x22, 0xC0, 0x17, 0x8A, 0x15, 0xE0,
+    0x9F, 0xD5, 0x4B, 0x46, 0x01, 0x3E, 0x13, 0x00, 0xDA, 0x8C, 0x0E, 0xCF, 0xAE, 0x4F, 0x41, 0xCB,
+    0x65, 0xEE, 0x3C, 0x00, 0xC3, 0xF6, 0x70, 0xCC, 0x09, 0x80, 0x47, 0xBA, 0x00, 0xCE, 0x72, 0x18,
+    0x31, 0x48, 0xDA, 0x29, 0x74, 0x3D, 0x9D, 0x69, 0xAE, 0x23, 0x13, 0x2E, 0x34, 0x81, 0x09, 0x1B,
+    0xDD, 0xCC, 0x94, 0xB1, 0xFB, 0x44, 0x99, 0x86, 0x91, 0x89, 0x62, 0x7F, 0x81, 0xA4, 0x21, 0xF7,
+    0xB9, 0x99, 0x89, 0x2A, 0xB6, 0x81, 0x09, 0xBB, 0xDA, 0x3C, 0x4A, 0xA9, 0xEB, 0xA9, 0x90, 0x67,
+    0x92, 0x0E, 0xC0, 0xA7, 0x19, 0x38, 0xD7, 0xE5, 0x03, 0x59, 0x0E, 0x52, 0x67, 0x39, 0x87, 0x2C,
+    0xF5, 0x3F, 0xBD, 0xF9, 0x1E, 0x3C, 0xEA, 0x7B, 0x1E, 0xF5, 0x17, 0xAD, 0x34, 0x3A, 0xAD, 0x8D,
+    0x76, 0x5A, 0x2D, 0x66, 0x5A, 0x28, 0x12, 0xB8, 0x40, 0xB5, 0x81, 0xDD, 0xF2, 0x1E, 0x4D, 0xB4,
+    0x1E, 0x0A, 0x31, 0x74, 0x80, 0xC6, 0x1C, 0x67, 0xFF, 0x71, 0x86, 0xC6, 0x9F, 0x06, 0x00, 0x9B,
+    0x95, 0x56, 0x66, 0x25, 0x1F, 0xBA, 0xAE, 0x72, 0xA3, 0xCD, 0x5B, 0xA7, 0xFD, 0xD6, 0x0A, 0x30,
+    0x54, 0x11, 0x20, 0x15, 0x02, 0xCA, 0x0D, 0x8D, 0x50, 0x07, 0x86, 0x19, 0x1A, 0x4F, 0x1B, 0xC0,
+    0x8D, 0xD8, 0x08, 0x82, 0x2A, 0x51, 0xEB, 0x82, 0x4A, 0x4F, 0x07, 0x6D, 0x4C, 0x4A, 0x93, 0xB6,
+    0x13, 0x74, 0x39, 0xEF, 0xFB, 0x46, 0xEA, 0xAC, 0xF4, 0xFB, 0xD2, 0x58, 0x4A, 0x63, 0x95, 0x32,
+    0xC2, 0x55, 0x9E, 0x11, 0xE7, 0xC1, 0xF9, 0x8C, 0xC1, 0xB2, 0xB3, 0x2E, 0xE3, 0x3F, 0x48, 0xE7,
+    0x99, 0x24, 0xE9, 0x63, 0xFB, 0x82, 0x1D, 0x0E, 0x70, 0xBF, 0xFD, 0xEF, 0x17, 0x50, 0xEB, 0xF3,
+    0x74, 0x2D, 0x19, 0x2D, 0xE4, 0xC5, 0xC5, 0x6F, 0x64, 0x62, 0x0F, 0x04, 0x3A, 0x3E, 0xEA, 0x2F,
+    0x4D, 0xDF, 0xBF, 0x22, 0xCD, 0x4E, 0xC9, 0x69, 0x2B, 0xA5, 0xB1, 0x59, 0x31, 0xEA, 0x50, 0x87,
+    0x0D, 0xD8, 0x35, 0xA3, 0xA9, 0xCF, 0x32, 0x75, 0x66, 0xA6, 0xCC, 0x6C, 0x59, 0xE6, 0x8C, 0xCF,
+    0x75, 0x6D, 0x74, 0x9F, 0x14, 0x39, 0xBC, 0xC9, 0xD5, 0xFE, 0x87, 0xE1, 0x81, 0x7C, 0xF6, 0xE7,
+    0x63, 0xAE, 0xEE, 0x3A, 0x20, 0x9B, 0xA6, 0x26, 0xE3, 0x01, 0xD3, 0xF7, 0xF4, 0xFD, 0x6F, 0x49,
+    0x5E, 0x5A, 0x5B, 0x69, 0xD0, 0x6A, 0xB5, 0x17, 0xD2, 0xDC, 0x04, 0xAA, 0x84, 0x99, 0xC6, 0x9C,
+    0x45, 0xA0, 0x5A, 0xC9, 0x99, 0x04, 0x86, 0xEE, 0xFF, 0xA3, 0xA6, 0x3C, 0xC7, 0xD2, 0xFE, 0x8A,
+    0x4E, 0x7F, 0xC3, 0xA9, 0xB2, 0xDC, 0x2B, 0xE0, 0x5F, 0x4A, 0xC1, 0x29, 0x65, 0x10, 0xDE, 0x49,
+    0x4B, 0xAB, 0xC4, 0xE0, 0x69, 0x56, 0xCE, 0xB2, 0x7B, 0xCC, 0xC3, 0x96, 0x11, 0xA6, 0x13, 0x92,
+    0x3F, 0xDE, 0xE9, 0x3C, 0x75, 0x38, 0xA1, 0xFA, 0x5F, 0xD4, 0xC7, 0xEE, 0xD5, 0x70, 0x7D, 0xAF,
+    0x86, 0x1F, 0xDC, 0xD7, 0xBA, 0x23, 0x86, 0xCA, 0x8E, 0x0E, 0xA0, 0x0E, 0xA7, 0xDA, 0xB1, 0xF2,
+    0x21, 0x07, 0xEF, 0x00, 0x6C, 0xA7, 0x4A, 0xB9, 0x9C, 0x6A, 0xF6, 0x34, 0x06, 0xBF, 0xCA, 0x79,
+    0xDF, 0xF7, 0x1D, 0x26, 0x8F, 0x9C, 0x33, 0x5C, 0x34, 0x9F, 0xBC, 0xFD, 0x3C, 0x00, 0x38, 0x50,
+    0x7E, 0x95, 0x51, 0x7E, 0x93, 0x37, 0xDB, 0xCB, 0xA7, 0xB5, 0xEA, 0xFC, 0x83, 0x25, 0x5B, 0xEE,
+    0xDF, 0xED, 0x72, 0xF4, 0xB2, 0xE5, 0x38, 0x30, 0x01, 0x7A, 0x74, 0x95, 0xA0, 0x8C, 0xD4, 0x91,
+    0xD3, 0x4E, 0x72, 0x9E, 0x66, 0x39, 0x6D, 0xF5, 0x63, 0xE3, 0xDB, 0x40, 0xB9, 0x81, 0xF3, 0xB4,
+    0x33, 0x08, 0xA3, 0xEC, 0xA6, 0x36, 0xB8, 0xBA, 0x7B, 0x47, 0x63, 0xC6, 0x2F, 0x30, 0x49, 0xB7,
+    0xCF, 0x53, 0xB0, 0x97, 0x1C, 0x20, 0x79, 0xE1, 0x14, 0x57, 0x63, 0xF3, 0x4E, 0x7E, 0x8E, 0x93,
+    0x4F, 0x30, 0xE9, 0x1E, 0x3D, 0xFD, 0x9C, 0x0D, 0x77, 0xDF, 0xBD, 0xC7, 0xCB, 0x23, 0x4D, 0x06,
+    0xCC, 0xA3, 0xD9, 0x41, 0x5F, 0xBD, 0xDA, 0x8F, 0x9F, 0x34, 0xEB, 0xF1, 0x93, 0x69, 0xCC, 0x0D,
+    0x65, 0x3C, 0x1A, 0x9C, 0xFF, 0x19, 0x0D, 0xD5, 0x76, 0x34, 0xA8, 0xCB, 0x0D, 0xC3, 0x62, 0x76,
+    0xCE, 0x74, 0xA3, 0x98, 0xC1, 0xB3, 0x76, 0x26, 0xA5, 0x41, 0xBA, 0x3D, 0x45, 0x82, 0xCF, 0xBF,
+    0xB6, 0x3A, 0x1C, 0xE2, 0x06, 0x34, 0xEB, 0xCF, 0x4A, 0x16, 0x7D, 0x4E, 0xF5, 0xEE, 0xBB, 0x1D,
+    0xDC, 0xE3, 0xFE, 0x19, 0x7D, 0xF5, 0x35, 0x75, 0x36, 0x60, 0x9F, 0xA7, 0x47, 0xCD, 0xDF, 0x34,
+    0x3D, 0xCA, 0xD9, 0x7F, 0xBE, 0x86, 0x4A, 0x4A, 0x39, 0x9A, 0xA0, 0xD4, 0x5B, 0x57, 0xEA, 0xEC,
+    0x4C, 0x25, 0x1C, 0x54, 0x22, 0x42, 0x95, 0xCA, 0x00, 0x76, 0x3B, 0xEB, 0x4E, 0xE8, 0x26, 0xAF,
+    0x1E, 0x75, 0x40, 0xB9, 0x1F, 0xAB, 0xCF, 0x4A, 0x5A, 0x70, 0x47, 0x32, 0x3B, 0xA7, 0x14, 0xEC,
+    0xFA, 0xE0, 0x69, 0x80, 0x7A, 0xAB, 0x01, 0xE7, 0x13, 0x14, 0x7B, 0x19, 0xA1, 0x0D, 0x36, 0x52,
+    0xA8, 0x73, 0xFB, 0xD7, 0xB5, 0xE2, 0x24, 0x41, 0x23, 0x5D, 0x83, 0xF9, 0x9D, 0x8B, 0x43, 0x75,
+    0x67, 0xFF, 0x6D, 0xA4, 0x92, 0x66, 0x6A, 0x69, 0x66, 0xD0, 0x46, 0x25, 0xC9, 0xD3, 0xAC, 0x14,
+    0xFA, 0x1F, 0x57, 0x79, 0xB1, 0x0C, 0x33, 0x6D, 0xC4, 0xE6, 0x58, 0x75, 0x9A, 0x8F, 0xE0, 0xBA,
+    0x14, 0x36, 0x30, 0x78, 0x68, 0x56, 0x44, 0xBD, 0x72, 0xA4, 0x65, 0x05, 0x54, 0xF1, 0x88, 0xC7,
+    0x19, 0xBC, 0x0D, 0x66, 0xCF, 0x1E, 0x29, 0x23, 0x17, 0xDC, 0x6C, 0xF3, 0x3E, 0x28, 0xD3, 0x7D,
+    0x93, 0xB7, 0xA1, 0x38, 0x3D, 0x45, 0x7B, 0xDF, 0xF4, 0xE2, 0x58, 0xD3, 0x68, 0x03, 0xEA, 0xC0,
+    0x06, 0x94, 0x33, 0x34, 0x7B, 0x5E, 0x2C, 0xE0, 0x66, 0x44, 0xA9, 0xEE, 0xC0, 0x16, 0x76, 0xA7,
+    0xCC, 0xD1, 0xFE, 0xB0, 0xBF, 0x26, 0x5F, 0xE6, 0xD4, 0x44, 0x8E, 0xC1, 0x30, 0xF9, 0xA5, 0x00,
+    0xAF, 0x5E, 0x9C, 0x52, 0xC6, 0x79, 0xAB, 0x07, 0xAC, 0xA4, 0x8F, 0xB0, 0x7B, 0x3F, 0x8D, 0xD8,
+    0x8D, 0x76, 0xA6, 0xDA, 0xA8, 0x57, 0xCA, 0x48, 0x91, 0x4E, 0x4E, 0x2E, 0x6F, 0xC9, 0xEC, 0xF7,
+    0x8E, 0x8E, 0x69, 0x64, 0xEA, 0x8E, 0x5F, 0x18, 0x7D, 0xFC, 0xDA, 0x0A, 0xC7, 0x67, 0x4E, 0x52,
+    0x07, 0xEE, 0x7F, 0x5E, 0xCD, 0xD0, 0x84, 0x7A, 0x3D, 0xE5, 0x85, 0xEA, 0x8D, 0xA9, 0xA3, 0x8C,
+    0xB4, 0x33, 0xE5, 0x4E, 0xBD, 0x52, 0x88, 0x22, 0xE5, 0xE0, 0xAB, 0x2B, 0x34, 0x32, 0xDC, 0x16,
+    0x1A, 0x4B, 0xE9, 0x27, 0xEA, 0x8C, 0xB4, 0xFD, 0xCE, 0x83, 0x7C, 0x51, 0xAD, 0x11, 0xA4, 0x95,
+    0x6A, 0x7F, 0x27, 0x62, 0x43, 0x91, 0x68, 0x66, 0x76, 0xAC, 0x67, 0xE7, 0x6C, 0x7C, 0x31, 0x35,
+    0x7D, 0x36, 0x09, 0x33, 0x49, 0xD4, 0xBA, 0x53, 0x9E, 0x2F, 0xE7, 0x11, 0x6E, 0xBC, 0xAF, 0xCD,
+    0xA5, 0x68, 0x6F, 0xAF, 0xF4, 0x89, 0x95, 0xDC, 0x5E, 0x6A, 0x6D, 0x56, 0xFE, 0x55, 0x67, 0x00,
+    0xF8, 0x02, 0xC0, 0x1B, 0xF0, 0xBB, 0x8A, 0xD4, 0xD2, 0x86, 0x93, 0x02, 0x53, 0x77, 0x35, 0x9A,
+    0x08, 0x94, 0xEB, 0xC9, 0xE2, 0xDA, 0x19, 0x68, 0x3C, 0xD0, 0xFA, 0x2F, 0x5D, 0xE0, 0x7E, 0x5F,
+    0x09, 0x37, 0x49, 0xDE, 0xA9, 0xD7, 0x32, 0x04, 0x9A, 0x75, 0x18, 0xA9, 0xE3, 0xD0, 0xE5, 0xEC,
+    0x60, 0x91, 0x86, 0x0E, 0xB3, 0x0F, 0x23, 0x66, 0x77, 0x23, 0x66, 0x77, 0x1E, 0x93, 0x9C, 0xA7,
+    0x88, 0xED, 0x42, 0x19, 0x6D, 0xA0, 0xDA, 0xEA, 0x88, 0x0D, 0xA5, 0xFE, 0xE3, 0x34, 0x23, 0xA9,
+    0xA3, 0xD5, 0x06, 0xE6, 0xA6, 0xE3, 0xFC, 0xE6, 0xA6, 0x2B, 0x4E, 0x11, 0xDC, 0xCA, 0x40, 0x13,
+    0x4C, 0xA4, 0xF5, 0x55, 0xC0, 0x75, 0x8D, 0x27, 0x32, 0x50, 0x05, 0x93, 0x2E, 0x1D, 0x95, 0xB4,
+    0xD1, 0x48, 0x1B, 0x03, 0xCD, 0x66, 0x22, 0x36, 0x54, 0x81, 0xC6, 0x37, 0x9E, 0x81, 0x81, 0x22,
+    0x9A, 0x48, 0xB3, 0xD4, 0xEB, 0x99, 0x4A, 0x49, 0xA1, 0xCD, 0x13, 0x77, 0x9C, 0x25, 0xB4, 0x87,
+    0xB3, 0x59, 0xAB, 0xDB, 0x3E, 0x99, 0x44, 0xCB, 0xD0, 0xD5, 0xBE, 0x99, 0x4D, 0xA8, 0x56, 0x7E,
+    0xDD, 0x24, 0x60, 0xE8, 0xA0, 0x99, 0xA1, 0x5A, 0x73, 0x7E, 0xEC, 0x33, 0x0D, 0x66, 0xFA, 0x98,
+    0x52, 0x0A, 0x85, 0x14, 0xF3, 0xA8, 0x17, 0x4C, 0x59, 0x6C, 0x49, 0x33, 0x66, 0x33, 0x09, 0x58,
+    0x9F, 0x97, 0x26, 0x97, 0xC1, 0x24, 0x28, 0x82, 0x49, 0x50, 0xE6, 0x72, 0x79, 0x5E, 0x56, 0xB3,
+    0x49, 0x60, 0xBD, 0x49, 0xD0, 0x8C, 0x26, 0x81, 0xC3, 0x24, 0x78, 0x92, 0x5D, 0xE6, 0xCD, 0xDB,
+    0xFA, 0xB6, 0x7B, 0x9E, 0xD5, 0x8F, 0xCE, 0x43, 0x11, 0xDD, 0x08, 0x26, 0xB6, 0x1D, 0x98, 0xD8,
+    0x74, 0xC0, 0xD6, 0x00, 0x6C, 0x16, 0xE0, 0xBF, 0xFC, 0x32, 0xC0, 0xBF, 0x3B, 0x30, 0xFE, 0x6D,
+    0x36, 0xAB, 0xED, 0xDD, 0xB4, 0x54, 0x2B, 0xEA, 0x76, 0xCA, 0xAD, 0xF1, 0xB8, 0x0F, 0xB6, 0x3C,
+    0x4E, 0xF3, 0xE1, 0x29, 0xC9, 0xFE, 0xE1, 0xDD, 0xCD, 0xCD, 0xF7, 0x86, 0x2E, 0x7F, 0x30, 0x6E,
+    0x3C, 0x10, 0x68, 0x1B, 0xF2, 0x41, 0xDB, 0xCB, 0xB5, 0xEE, 0xA6, 0xB1, 0xCD, 0xDF, 0x9B, 0xE0,
+    0x57, 0xBE, 0x7D, 0xBF, 0x90, 0xDD, 0xF8, 0xA8, 0xBF, 0xE4, 0x19, 0x1A, 0x9D, 0x16, 0x1B, 0x4B,
+    0x8D, 0x43, 0x42, 0xCB, 0x17, 0x86, 0xAE, 0xF1, 0x75, 0xE8, 0x70, 0x0C, 0x38, 0xE0, 0x4D, 0x13,
+    0x8B, 0x00, 0xC4, 0x2A, 0xD8, 0x0E, 0xCC, 0xDA, 0xF8, 0x77, 0x81, 0x32, 0x0C, 0xD5, 0x4C, 0x0E,
+    0x53, 0x8E, 0x54, 0xEB, 0x0E, 0x14, 0xB1, 0xF9, 0x7E, 0x02, 0x9A, 0x79, 0x28, 0x23, 0x20, 0x13,
+    0xAB, 0x15, 0xEA, 0xB5, 0x0A, 0x75, 0x00, 0x37, 0x36, 0xC7, 0x61, 0xD2, 0x40, 0xBB, 0xE0, 0x96,
+    0x22, 0xE5, 0x2D, 0x30, 0xA9, 0x73, 0xB3, 0x5B, 0x4A, 0x25, 0xDC, 0xF2, 0x6F, 0x00, 0xF8, 0xB5,
+    0x2C, 0xE7, 0xD5, 0xDE, 0x55, 0xD2, 0xD2, 0xEC, 0x5A, 0x5D, 0x57, 0x6F, 0xBF, 0x4E, 0xB9, 0x91,
+    0xFF, 0x57, 0xA8, 0x02, 0xE7, 0x57, 0x1E, 0xA7, 0x91, 0x56, 0x01, 0xEA, 0x78, 0xD8, 0xE9, 0xFD,
+    0x0B, 0xB0, 0x7F, 0x19, 0x93, 0xDE, 0xA3, 0x8C, 0xD3, 0x9F, 0x5E, 0xAD, 0x4E, 0x9A, 0x6B, 0xED,
+    0xF0, 0xEA, 0x05, 0xE7, 0xFD, 0x85, 0xE9, 0xFB, 0x49, 0x4B, 0x2D, 0x0D, 0x1A, 0x2B, 0x6D, 0x26,
+    0x81, 0x1B, 0x4D, 0x82, 0x61, 0x34, 0x09, 0xA3, 0xD1, 0x24, 0x2A, 0x8D, 0x26, 0xD1, 0x4C, 0xA3,
+    0x49, 0xBC, 0xE7, 0x46, 0x93, 0x8A, 0xCD, 0x8D, 0x26, 0xD5, 0x8B, 0x1B, 0x4D, 0x6A, 0x3B, 0x37,
+    0x9A, 0x94, 0x70, 0xA3, 0xD1, 0x8A, 0x1B, 0x8D, 0x66, 0xDC, 0x68, 0xD4, 0x1D, 0xE3, 0xB8, 0xF1,
+    0x6C, 0x87, 0xE1, 0x23, 0xA7, 0x50, 0x4A, 0x93, 0x42, 0xA5, 0x9D, 0xB3, 0x8E, 0x6B, 0x68, 0x7C,
+    0xB1, 0x9D, 0x52, 0x9B, 0xCD, 0x52, 0x6D, 0x50, 0xEF, 0x57, 0x01, 0x4C, 0xF6, 0x33, 0x0F, 0xE6,
+    0xE8, 0xD8, 0x0A, 0xFF, 0x40, 0xD2, 0x02, 0x3C, 0xEA, 0x2F, 0x19, 0x6A, 0xED, 0x0C, 0x3F, 0xD4,
+    0x8E, 0x5B, 0x4D, 0xC2, 0xFD, 0x07, 0x86, 0xAE, 0xE9, 0x68, 0x66, 0x3B, 0x52, 0xAD, 0xB5, 0xC7,
+    0xA4, 0x6A, 0x86, 0xE1, 0x95, 0x00, 0x8D, 0x36, 0xA8, 0x24, 0x30, 0xC9, 0x06, 0x18, 0xBE, 0x9A,
+    0xA0, 0x99, 0x5B, 0x4F, 0xB5, 0x96, 0x11, 0x93, 0x98, 0x46, 0x86, 0xCE, 0xAE, 0xB4, 0x8B, 0x11,
+    0x92, 0x6F, 0xD6, 0x49, 0xC1, 0xA8, 0x03, 0xCE, 0x3A, 0xFA, 0xBE, 0xEF, 0x2F, 0x4A, 0x49, 0xF2,
+    0x75, 0x46, 0x80, 0x4F, 0x10, 0x98, 0xB5, 0x8C, 0x50, 0x79, 0x1B, 0xA0, 0xC1, 0xF9, 0xE3, 0x14,
+    0xB1, 0x08, 0x65, 0x04, 0xEB, 0x6D, 0x80, 0xAF, 0xE0, 0x3C, 0x66, 0x45, 0x50, 0xFB, 0x32, 0x82,
+    0x23, 0x1F, 0x7C, 0x39, 0x4F, 0x3D, 0x23, 0x7E, 0x63, 0xA2, 0x8C, 0x46, 0x2B, 0xCD, 0x6D, 0xA5,
+    0xB1, 0x96, 0xEC, 0x86, 0x53, 0xFC, 0xB5, 0x43, 0xC9, 0x40, 0x7F, 0xA1, 0x1D, 0xAC, 0xBE, 0xAF,
+    0x08, 0x43, 0x62, 0xD8, 0x28, 0x35, 0x9A, 0x4F, 0x03, 0xCD, 0x7B, 0x54, 0x7F, 0x32, 0x73, 0xBB,
+    0xD1, 0xBC, 0xEE, 0xAB, 0x0F, 0x17, 0xDE, 0x74, 0xDD, 0x57, 0x9A, 0xD1, 0xAC, 0x4F, 0x4C, 0x78,
+    0x42, 0x35, 0x47, 0xFB, 0xCD, 0x8D, 0xE6, 0x37, 0xB7, 0x37, 0xAA, 0x85, 0x37, 0xCB, 0x9F, 0x84,
+    0x66, 0x34, 0x6B, 0xFD, 0xA3, 0xEE, 0x09, 0xD5, 0xDC, 0x44, 0xB3, 0xD1, 0x74, 0x6E, 0xAE, 0x16,
+    0xDE, 0x64, 0xA0, 0x19, 0xCD, 0xCA, 0xCA, 0x13, 0xEA, 0x8F, 0xE0, 0x6C, 0x7F, 0x45, 0x09, 0x23,
+    0xFD, 0xA1, 0x56, 0x6A, 0xED, 0xE7, 0xFD, 0xC5, 0xA3, 0xBE, 0x9F, 0x14, 0xAC, 0x34, 0x68, 0xAE,
+    0xB5, 0x99, 0xFD, 0x98, 0xE5, 0xFB, 0x99, 0x7A, 0xA1, 0xDC, 0xC1, 0x8D, 0x46, 0x92, 0x4E, 0xE5,
+    0xDE, 0xF7, 0x7F, 0xCD, 0xF3, 0x09, 0xDC, 0x58, 0xE8, 0x9A, 0xE9, 0x23, 0xA7, 0x50, 0x49, 0x93,
+    0x42, 0xAD, 0x23, 0x5A, 0x35, 0xD3, 0x0E, 0xA5, 0x72, 0xA2, 0x5B, 0x63, 0x99, 0x18, 0xD6, 0x32,
+    0x52, 0xCA, 0x24, 0x70, 0xF3, 0x04, 0xF5, 0xE6, 0x46, 0x8C, 0xEC, 0x02, 0xEE, 0xC3, 0x0D, 0xEC,
+    0x9F, 0xEF, 0x50, 0xC6, 0x61, 0x04, 0x35, 0x01, 0xDC, 0x07, 0x11, 0xEC, 0xA2, 0x8E, 0x3A, 0xB4,
+    0x81, 0x72, 0x2B, 0x45, 0x19, 0x19, 0x6E, 0x1F, 0x27, 0x6A, 0x29, 0x9D, 0xE0, 0xE2, 0x37, 0xEE,
+    0xB3, 0x99, 0x93, 0x4E, 0x07, 0xC6, 0x5A, 0xCD, 0x0E, 0x53, 0x67, 0x12, 0x0C, 0xFF, 0xCF, 0xCA,
+    0xFB, 0x6F, 0xAD, 0xB5, 0x4F, 0x0A, 0xF6, 0xE4, 0x60, 0xBE, 0xE4, 0xAF, 0x6E, 0x69, 0x63, 0xAB,
+    0xAD, 0xD6, 0x9F, 0x48, 0xE1, 0xB1, 0x6E, 0x1F, 0xAB, 0xB3, 0xF1, 0x21, 0x08, 0xCD, 0x70, 0xF3,
+    0xA7, 0x41, 0x28, 0x0F, 0xA0, 0x69, 0xBA, 0x3F, 0x2A, 0x2F, 0xB7, 0x0C, 0x51, 0x6C, 0xA0, 0x5D,
+    0xD0, 0x27, 0xEF, 0x44, 0xEC, 0x91, 0xD2, 0xDE, 0xC1, 0x2E, 0x5F, 0x04, 0x76, 0x20, 0x1F, 0x50,
+    0x7D, 0x06, 0x13, 0x4F, 0x9A, 0x61, 0xD0, 0x0E, 0x67, 0x37, 0x37, 0xF7, 0x17, 0x3C, 0xA6, 0x8D,
+    0x42, 0x9A, 0x4B, 0x29, 0x96, 0x11, 0xFD, 0x5E, 0xC4, 0xFE, 0x30, 0x51, 0xAE, 0x13, 0x3C, 0x75,
+    0x63, 0xF6, 0xFB, 0xCF, 0x5D, 0xDF, 0x98, 0xCF, 0x0D, 0xB3, 0xDD, 0xED, 0xA0, 0x5D, 0xA1, 0xD4,
+    0xC8, 0xC5, 0xA4, 0x77, 0x62, 0x2D, 0xED, 0x5C, 0x29, 0x1D, 0x06, 0xB0, 0xEF, 0x7B, 0x49, 0xFA,
+    0x54, 0x92, 0x7E, 0xF4, 0xD6, 0xF4, 0xD6, 0xF0, 0xCC, 0x24, 0xEE, 0x42, 0xB5, 0x96, 0x7F, 0xE6,
+    0x9B, 0xD9, 0xBE, 0xCE, 0xD0, 0x7D, 0x39, 0x0F, 0x5B, 0xAD, 0xF9, 0xCC, 0x29, 0xFB, 0xD6, 0x9F,
+    0xD5, 0xF4, 0x78, 0xEF, 0xA8, 0x25, 0xCF, 0x20, 0x91, 0x57, 0xB1, 0xE4, 0x9D, 0xFE, 0x97, 0x12,
+    0x57, 0xBB, 0x11, 0xD8, 0xB9, 0x48, 0x30, 0x50, 0x6D, 0xC7, 0x45, 0x84, 0xC6, 0xD3, 0xCC, 0xBC,
+    0x07, 0xCE, 0x97, 0x01, 0x26, 0x1A, 0x0F, 0x3B, 0x09, 0x8A, 0x58, 0x05, 0xA8, 0x42, 0xDB, 0x81,
+    0x5D, 0x22, 0xD0, 0x7C, 0xB8, 0x00, 0x6E, 0x38, 0x94, 0x72, 0xBA, 0x4C, 0x52, 0xEE, 0x9C, 0xC4,
+    0xC9, 0xF0, 0x27, 0xA7, 0xFF, 0x72, 0xBA, 0x65, 0x02, 0xFE, 0x7D, 0x1D, 0xA0, 0xBC, 0x53, 0x07,
+    0x56, 0xEB, 0x7D, 0x12, 0xB0, 0x3D, 0x92, 0x7F, 0xBC, 0x0C, 0x70, 0x26, 0x0F, 0x98, 0x7C, 0x6C,
+    0xFC, 0xD2, 0x94, 0x93, 0x8B, 0xF1, 0x41, 0x14, 0xFB, 0xB3, 0x99, 0x2B, 0x3D, 0xCD, 0x47, 0xCE,
+    0x1B, 0x07, 0xAC, 0x70, 0x6B, 0xFB, 0xBE, 0xE6, 0x7A, 0x2B, 0x62, 0x21, 0xB3, 0xD3, 0xFA, 0x7A,
+    0x6B, 0x7D, 0x11, 0x71, 0x1F, 0x6C, 0xB4, 0xBE, 0x48, 0x43, 0x57, 0x44, 0x9A, 0x1F, 0xAC, 0xB4,
+    0xDE, 0xFC, 0x14, 0x33, 0x16, 0x91, 0xE6, 0x83, 0x48, 0xEB, 0x8B, 0xE8, 0xE6, 0x22, 0xE2, 0xBE,
+    0xA9, 0xAE, 0xF5, 0x36, 0xD4, 0x7B, 0x11, 0xAB, 0x44, 0xAB, 0xE9, 0xCF, 0xF2, 0x25, 0x07, 0x79,
+    0xB8, 0x92, 0xAE, 0x7F, 0x7E, 0x41, 0x1B, 0x2D, 0x39, 0x1C, 0xEE, 0x80, 0x9B, 0x9B, 0xEF, 0x90,
+    0x27, 0xE9, 0x42, 0xF2, 0x83, 0xDE, 0x57, 0x62, 0x8A, 0x4C, 0x9E, 0x01, 0x86, 0xB1, 0x0C, 0x30,
+    0x75, 0xAE, 0x83, 0xA9, 0x58, 0x01, 0x35, 0x23, 0xA0, 0xE7, 0x6A, 0x3F, 0xB2, 0xD9, 0x3B, 0xC0,
+    0x9E, 0x00, 0xFB, 0x7E, 0x02, 0x52, 0x19, 0xC1, 0x2E, 0x55, 0x84, 0x89, 0x7A, 0xA3, 0x5E, 0xB1,
+    0xB7, 0xA5, 0x52, 0x21, 0x35, 0x5A, 0x1B, 0xC5, 0xF3, 0xFE, 0xE2, 0x51, 0x7F, 0xD9, 0x2A, 0x56,
+    0xD2, 0xD7, 0x94, 0xD0, 0xDE, 0x55, 0x1B, 0x45, 0x3E, 0x0E, 0x9E, 0x60, 0xE8, 0xC8, 0x87, 0xA1,
+    0x75, 0xA0, 0x5A, 0xFF, 0x56, 0x1D, 0xD3, 0x27, 0x37, 0xD3, 0x6D, 0x29, 0x49, 0xFA, 0x71, 0xBE,
+    0x59, 0xF1, 0x20, 0x39, 0x90, 0x6F, 0x50, 0x55, 0x0B, 0x80, 0x59, 0x1F, 0xA4, 0xE4, 0x72, 0x46,
+    0xCE, 0xF8, 0xF3, 0xBE, 0x3B, 0xEF, 0x5F, 0x53, 0xAA, 0xB5, 0x0F, 0x1A, 0x07, 0x75, 0xCE, 0x33,
+    0x8C, 0x65, 0xA4, 0x5C, 0x71, 0x1E, 0xD7, 0xE5, 0x6A, 0xEB, 0x71, 0x5D, 0x91, 0x28, 0x57, 0x6C,
+    0xC0, 0x75, 0x4C, 0x77, 0xD3, 0x4A, 0x21, 0xA9, 0xA3, 0xD0, 0x7F, 0xCA, 0x91, 0x62, 0x77, 0x42,
+    0xEA, 0x0F, 0xAA, 0x66, 0xFA, 0x08, 0x0A, 0x69, 0x01, 0xA7, 0xFD, 0xBC, 0xEF, 0xFA, 0xFE, 0x51,
+    0x7F, 0xE9, 0x34, 0x6B, 0xB7, 0x8A, 0x4E, 0xA3, 0x62, 0xAD, 0xC5, 0x44, 0xEC, 0xC2, 0xC4, 0xDF,
+    0x17, 0x2D, 0xF6, 0xEF, 0xBE, 0xFE, 0xA7, 0xAF, 0xEA, 0x3A, 0x5F, 0x45, 0x51, 0x9C, 0x0E, 0xFA,
+    0x0B, 0x26, 0xDF, 0x71, 0x63, 0x46, 0xFB, 0x21, 0xDF, 0x29, 0xF2, 0x3F, 0xD1, 0x53, 0x32, 0xEA,
+    0x38, 0x10, 0xE0, 0xDD, 0x83, 0xBE, 0x71, 0xD0, 0x2F, 0x1F, 0xF4, 0x9F, 0x9C, 0xF7, 0xFD, 0x25,
+    0x46, 0xD2, 0x42, 0x2D, 0xED, 0xD0, 0xBE, 0x35, 0x8C, 0xF0, 0x8C, 0x1D, 0x8A, 0x50, 0x6E, 0x50,
+    0x79, 0xBB, 0xC0, 0x4B, 0xB8, 0x91, 0xD3, 0x81, 0x78, 0x29, 0x25, 0xB0, 0xB7, 0xBF, 0x1B, 0xC1,
+    0x8D, 0xD5, 0x06, 0x3B, 0x75, 0xA0, 0xDC, 0x68, 0x3C, 0x76, 0x61, 0x00, 0x37, 0x16, 0x11, 0x76,
+    0x9A, 0x99, 0xFA, 0xF6, 0xB7, 0x44, 0x91, 0xAF, 0x69, 0x3D, 0x4F, 0x16, 0x9D, 0xF7, 0x17, 0x3C,
+    0xEA, 0xFB, 0x36, 0x9F, 0x5F, 0xFD, 0x40, 0x09, 0x26, 0x5D, 0x57, 0x2B, 0x90, 0xEF, 0x04, 0xD0,
+    0x7A, 0x86, 0x0E, 0xF2, 0x85, 0x09, 0x8A, 0xC8, 0xA9, 0x73, 0x9F, 0x3E, 0xA2, 0xF5, 0x0C, 0x92,
+    0xAF, 0x03, 0xCD, 0xDD, 0x3B, 0x31, 0x77, 0x4E, 0xDD, 0x84, 0x49, 0xD8, 0xA5, 0xF5, 0x0C, 0x5D,
+    0x11, 0xF3, 0x2F, 0xDF, 0xCB, 0x9D, 0x6E, 0x9C, 0x30, 0x89, 0xD6, 0xB7, 0x9E, 0xE9, 0xAD, 0x69,
+    0x69, 0x6E, 0x5F, 0x91, 0xB4, 0x38, 0xFD, 0xA5, 0xA4, 0xF1, 0xDE, 0x25, 0x66, 0xC1, 0x0A, 0x69,
+    0xA6, 0x52, 0xFA, 0x6B, 0x0C, 0xBE, 0x72, 0xBE, 0x22, 0xD1, 0x7C, 0xFC, 0x5A, 0x64, 0xE8, 0xAA,
+    0xCD, 0x24, 0xEA, 0x50, 0xAD, 0x34, 0xBE, 0x99, 0x19, 0x18, 0xBA, 0x22, 0x9A, 0x44, 0x33, 0xD7,
+    0xB7, 0x5F, 0xBF, 0x8F, 0xEC, 0x6E, 0x1F, 0x60, 0xDA, 0xC7, 0xBA, 0x66, 0x90, 0x18, 0x3E, 0x55,
+    0x70, 0x5D, 0xBD, 0xFF, 0x23, 0x18, 0x7C, 0x4E, 0xAE, 0x98, 0x1D, 0x70, 0xDE, 0xF4, 0xAF, 0x87,
+    0x52, 0x8A, 0x4C, 0x12, 0x8F, 0x2E, 0x9C, 0xCF, 0x9E, 0xB3, 0x5C, 0xFF, 0x31, 0x26, 0x7E, 0x39,
+    0x5F, 0x9B, 0x98, 0xFE, 0xC5, 0xFE, 0x75, 0x8D, 0x92, 0xC6, 0x5A, 0xFB, 0x0B, 0xC0, 0xD9, 0xF4,
+    0x3D, 0x46, 0x2B, 0x93, 0x82, 0x91, 0xD6, 0x4A, 0x89, 0xE1, 0x53, 0xCD, 0x26, 0xD1, 0x84, 0x42,
+    0x34, 0x73, 0x19, 0xB1, 0x9B, 0x49, 0x39, 0xD7, 0xD9, 0xCC, 0x75, 0xA0, 0x8C, 0x26, 0xB1, 0x43,
+    0x3B, 0x37, 0xB3, 0x5D, 0x30, 0xC9, 0x48, 0x3B, 0x34, 0x73, 0x23, 0x2D, 0x90, 0xCC, 0x7E, 0x93,
+    0xD9, 0xA3, 0xF7, 0x70, 0xFD, 0xCD, 0x6C, 0x8F, 0xDF, 0x0E, 0x23, 0x43, 0xD7, 0xCC, 0x65, 0xC2,
+    0x86, 0x42, 0xD7, 0xCD, 0x56, 0xA5, 0x52, 0x62, 0x92, 0xBA, 0x2C, 0x46, 0xBE, 0xFE, 0x78, 0xD3,
+    0xE5, 0xF0, 0x16, 0xA3, 0x7C, 0x24, 0xAA, 0xB9, 0xD8, 0x71, 0x5D, 0xCE, 0x21, 0x0C, 0x94, 0x81,
+    0xC6, 0x93, 0x4D, 0xCD, 0x71, 0x3D, 0xA3, 0xB9, 0xAD, 0x02, 0x39, 0x82, 0xB5, 0x12, 0x94, 0x6B,
+    0xE3, 0x29, 0x62, 0x19, 0x20, 0x11, 0x41, 0x38, 0x98, 0x3A, 0xEB, 0x19, 0xC6, 0xFA, 0xAE, 0x1B,
+    0xBC, 0xD3, 0x3A, 0xF9, 0x46, 0xE9, 0xA5, 0xFB, 0xEC, 0x2A, 0xCD, 0xDC, 0xCC, 0xA5, 0x4A, 0xE1,
+    0x16, 0x17, 0x8A, 0x64, 0x12, 0x9F, 0xF3, 0xF7, 0x77, 0x1A, 0x78, 0xFE, 0x15, 0xDD, 0xBD, 0x4F,
+    0xB0, 0x25, 0x57, 0x7D, 0xE7, 0xF9, 0xC9, 0x4C, 0xBD, 0x97, 0x40, 0x46, 0xFB, 0x68, 0xA1, 0x32,
+    0x58, 0x35, 0x26, 0x59, 0xB0, 0x68, 0xF7, 0xD8, 0xCA, 0x8D, 0x17, 0x2C, 0xA4, 0x3A, 0x29, 0x14,
+    0x33, 0x2C, 0x58, 0xB8, 0x62, 0xA2, 0x2E, 0xDD, 0x0D, 0x0B, 0x7B, 0xE1, 0x85, 0x81, 0x08, 0xBF,
+    0x89, 0x18, 0x2F, 0x58, 0x08, 0x65, 0xD2, 0x5A, 0xB0, 0x98, 0x05, 0xD5, 0x11, 0xC2, 0x11, 0x13,
+    0xBD, 0x68, 0x16, 0x22, 0x02, 0x9E, 0xA2, 0x2D, 0x22, 0x86, 0x05, 0x33, 0x51, 0xAA, 0x3C, 0x52,
+    0x45, 0x87, 0x16, 0x5A, 0x90, 0x98, 0xF6, 0xB0, 0xF0, 0x42, 0x49, 0x23, 0xDB, 0x8D, 0x58, 0x70,
+    0x80, 0xC4, 0xE4, 0x2B, 0x9D, 0xCC, 0xEF, 0x2C, 0xCE, 0xB9, 0xF7, 0xBD, 0x2A, 0x95, 0x8C, 0x00,
+    0x89, 0x7F, 0x37, 0xDE, 0xCB, 0x9B, 0x79, 0x33, 0x6F, 0xDE, 0x3C, 0xBF, 0xF3, 0x3B, 0xE7, 0xF7,
+    0xFF, 0x7B, 0x28, 0x96, 0xE1, 0xEB, 0x61, 0x78, 0x61, 0x02, 0xE0, 0xAB, 0xF5, 0xA3, 0x4B, 0xFD,
+    0x99, 0x50, 0x3F, 0x7F, 0xFE, 0xD7, 0xBC, 0xB0, 0x36, 0xDF, 0x5C, 0xED, 0x37, 0x83, 0x7D, 0x31,
+    0x5E, 0x43, 0xE6, 0x81, 0x06, 0xC8, 0x0F, 0x3B, 0x13, 0xF0, 0x50, 0xDA, 0xC9, 0x86, 0xFF, 0x41,
+    0x2E, 0x2D, 0x48, 0x1A, 0xED, 0xAD, 0xBF, 0xDD, 0x2A, 0xFF, 0x48, 0x35, 0x85, 0xC2, 0x3D, 0xDE,
+    0xF4, 0x0F, 0xE7, 0xC5, 0x5C, 0x38, 0x6C, 0xFB, 0x30, 0xA5, 0x2F, 0x1C, 0x1D, 0xFB, 0x9D, 0xF6,
+    0x61, 0xCA, 0xA5, 0x70, 0x58, 0xF7, 0x30, 0xC5, 0x5A, 0x38, 0xEA, 0xF9, 0x71, 0xEE, 0xD7, 0x6B,
+    0xCF, 0x0F, 0x85, 0xA4, 0xA9, 0x92, 0x16, 0x8E, 0xF5, 0x0A, 0x54, 0x0E, 0xF8, 0x1A, 0x50, 0xF5,
+    0x77, 0xEF, 0x98, 0x1E, 0x58, 0xD8, 0xBF, 0x8E, 0x00, 0x86, 0x0D, 0x90, 0x3C, 0xE8, 0x3F, 0x6D,
+    0x30, 0x60, 0x1D, 0xB6, 0x2D, 0x3D, 0x8D, 0x63, 0xC1, 0x4C, 0x7C, 0x80, 0x62, 0x06, 0xB2, 0x00,
+    0x30, 0x00, 0x34, 0x0E, 0x30, 0x1E, 0x0A, 0x49, 0x33, 0x92, 0x02, 0x97, 0x86, 0xCF, 0xEF, 0xA0,
+    0x76, 0x40, 0xE5, 0x81, 0x3C, 0x00, 0x6C, 0x00, 0xB6, 0xE5, 0xE2, 0x99, 0x62, 0x86, 0xFB, 0xAC,
+    0x24, 0x19, 0x49, 0x7A, 0x61, 0x7B, 0x46, 0x9A, 0x1E, 0x81, 0x8F, 0x5C, 0xBF, 0x0F, 0xC8, 0xAA,
+    0x1E, 0x8A, 0xBF, 0x5D, 0x2E, 0x6F, 0x8F, 0xCD, 0xCD, 0xF7, 0xF5, 0x9A, 0xCF, 0xF4, 0x8F, 0x9A,
+    0x68, 0x5C, 0x39, 0x63, 0x1C, 0x4F, 0x50, 0x4C, 0x18, 0x97, 0x2D, 0x14, 0x9E, 0x27, 0x20, 0x50,
+    0xF7, 0x58, 0x0A, 0x4F, 0xDD, 0xB3, 0x61, 0x1C, 0xF6, 0xC7, 0x27, 0x0B, 0x9D, 0x24, 0x37, 0x54,
+    0xFA, 0x46, 0xB0, 0x40, 0xFD, 0x1F, 0x00, 0xFA, 0x4E, 0x1E, 0xAB, 0x13, 0x05, 0x6A, 0x7D, 0x43,
+    0xAF, 0x40, 0xD7, 0x9B, 0x05, 0x6A, 0x97, 0x09, 0xCC, 0x48, 0x33, 0x51, 0x7A, 0x8A, 0x40, 0x31,
+    0x43, 0xD7, 0x67, 0x01, 0xCC, 0x4C, 0x00, 0xC4, 0x13, 0x40, 0x33, 0x5A, 0xC8, 0x15, 0x1A, 0xB5,
+    0x74, 0xFA, 0x13, 0x39, 0x8E, 0xFE, 0xF4, 0xB5, 0xBF, 0x6B, 0x01, 0x4D, 0xC0, 0xAE, 0xFB, 0xF1,
+    0x0E, 0xAC, 0xA4, 0x96, 0x4A, 0x92, 0x03, 0x6C, 0x0F, 0x60, 0x26, 0x80, 0x22, 0x12, 0x7E, 0x83,
+    0xC3, 0x89, 0x93, 0xDB, 0x2D, 0x14, 0xD2, 0x02, 0x99, 0xB4, 0xC1, 0x13, 0x17, 0x5F, 0x0F, 0xC4,
+    0x5E, 0xFA, 0x83, 0x8B, 0x9F, 0xFD, 0x41, 0xFC, 0x6C, 0x98, 0xC8, 0xA5, 0xB6, 0x38, 0x3B, 0xF1,
+    0x85, 0xCF, 0x42, 0xBE, 0xD0, 0xB0, 0x52, 0x32, 0xF4, 0x60, 0x67, 0x30, 0x43, 0x4F, 0xF9, 0xF7,
+    0x2B, 0x99, 0x1F, 0x3C, 0x9F, 0x2E, 0xD5, 0x9B, 0xBE, 0x59, 0x0A, 0x8F, 0xFA, 0xAE, 0x2D, 0xE7,
+    0x6A, 0xA1, 0x43, 0x63, 0x39, 0x56, 0x62, 0xA1, 0x9B, 0xAF, 0x90, 0xEB, 0x73, 0x3D, 0xE6, 0x27,
+    0x13, 0x0C, 0x33, 0x54, 0xA1, 0x86, 0xCD, 0x8C, 0xD8, 0x22, 0xD0, 0xF4, 0x1A, 0x9B, 0xBE, 0x96,
+    0x7A, 0x06, 0xB5, 0x64, 0xD7, 0x88, 0x8D, 0x29, 0x96, 0xC1, 0x0D, 0x2F, 0x85, 0x2A, 0x74, 0x6D,
+    0x6C, 0x0C, 0xC7, 0x37, 0xAF, 0xB3, 0x6F, 0x08, 0x66, 0xDB, 0x0D, 0x13, 0x74, 0x3D, 0x79, 0x88,
+    0xBC, 0xD3, 0x51, 0x4C, 0x80, 0x71, 0xC6, 0xF1, 0x37, 0xD7, 0x8B, 0xA9, 0xA6, 0x92, 0xCF, 0xFD,
+    0x15, 0xEC, 0x5F, 0x7B, 0x96, 0x47, 0x08, 0x78, 0x6E, 0x3C, 0x9E, 0xCD, 0x7C, 0x85, 0xC7, 0xBF,
+    0x96, 0x7B, 0xE0, 0x91, 0xA5, 0xF0, 0xC0, 0x95, 0xA5, 0x98, 0xEE, 0x78, 0xF3, 0xC0, 0x23, 0x5F,
+    0x8B, 0x6F, 0x8F, 0x67, 0x0B, 0xF0, 0xF8, 0x23, 0xA8, 0x7D, 0x0F, 0x37, 0x2C, 0x9D, 0x16, 0x96,
+    0xBA, 0xAD, 0x34, 0xE5, 0xDE, 0x38, 0x76, 0x94, 0x63, 0xE1, 0x81, 0xBA, 0x27, 0x3E, 0x04, 0xB6,
+    0xA7, 0x5C, 0xA0, 0xDA, 0xFE, 0x7A, 0x18, 0x81, 0x41, 0x1B, 0xC0, 0xD1, 0x69, 0x0B, 0x7C, 0xA2,
+    0xCD, 0xB5, 0x14, 0x4B, 0x47, 0xA8, 0xC6, 0x87, 0xF2, 0x19, 0x9E, 0xE3, 0x44, 0xED, 0xF0, 0xEC,
+    0xD8, 0xE5, 0x73, 0xD3, 0x3E, 0x57, 0xFA, 0xEE, 0xBA, 0xB4, 0x99, 0xE5, 0x89, 0x34, 0x82, 0x4E,
+    0x4F, 0x43, 0xA7, 0xAD, 0xD6, 0x6D, 0x2E, 0xED, 0x76, 0x3B, 0x23, 0xE9, 0x3B, 0x92, 0x96, 0xDD,
+    0x6E, 0x77, 0x33, 0x0D, 0xB7, 0x62, 0x4A, 0x43, 0xEE, 0x0A, 0x60, 0xFA, 0x4B, 0xBB, 0xB6, 0xD3,
+    0xD6, 0x69, 0xB3, 0x5A, 0xE1, 0x01, 0xE0, 0xB2, 0x66, 0xD8, 0x76, 0x03, 0xC5, 0x44, 0xE5, 0x4C,
+    0x4F, 0xE6, 0x1F, 0xAA, 0xB6, 0xF6, 0x6B, 0x0F, 0x57, 0xDF, 0x1B, 0x1F, 0xFE, 0x54, 0xF1, 0xC2,
+    0xF4, 0x47, 0x5F, 0x2D, 0x5E, 0x98, 0x8C, 0x2F, 0x5E, 0x74, 0xC6, 0x17, 0xC2, 0xF8, 0xE2, 0xEB,
+    0x98, 0xAF, 0x16, 0x2F, 0x3A, 0xF3, 0xA9, 0xE2, 0x05, 0xFF, 0xDE, 0x87, 0xCD, 0xFC, 0xDC, 0xC3,
+    0x0F, 0x1D, 0x5D, 0x7D, 0xE0, 0x53, 0xA6, 0x25, 0xF3, 0xC5, 0x44, 0x35, 0xB2, 0xED, 0x06, 0xA8,
+    0x35, 0x03, 0x3B, 0x00, 0x8C, 0xF4, 0x23, 0xE9, 0x4C, 0x5A, 0x39, 0x82, 0x5A, 0x7D, 0xA9, 0x8D,
+    0xB5, 0x9C, 0x1B, 0xCC, 0x2D, 0x4F, 0xB8, 0x42, 0x75, 0xCB, 0x73, 0xC3, 0x62, 0x5E, 0x08, 0xF9,
+    0x6C, 0x24, 0xAC, 0x7A, 0x3E, 0xD1, 0xA6, 0x66, 0x3E, 0x07, 0x34, 0x2D, 0x54, 0x23, 0xE4, 0xF3,
+    0xF9, 0x07, 0xBB, 0x8F, 0xFD, 0xC3, 0x35, 0x2B, 0xE9, 0x73, 0x92, 0xA6, 0x7B, 0x5E, 0x71, 0xFE,
+    0xC1, 0x85, 0xD7, 0xBF, 0x39, 0x3D, 0x3D, 0xFD, 0xDC, 0x9E, 0x56, 0x00, 0xB5, 0x5A, 0xA3, 0xB5,
+    0x58, 0xFF, 0xD4, 0x5B, 0xBA, 0x0F, 0x4D, 0xC5, 0xFC, 0x10, 0x36, 0xCE, 0x16, 0x2B, 0xD8, 0x1E,
+    0x33, 0x51, 0x2C, 0x64, 0x1B, 0x74, 0x2D, 0xB5, 0xA3, 0x94, 0x42, 0x27, 0xBD, 0x20, 0xCD, 0xDC,
+    0x47, 0x36, 0x2C, 0xB9, 0xE4, 0xB6, 0x72, 0x7E, 0x84, 0x9B, 0x19, 0x4D, 0x4B, 0xED, 0x68, 0x5C,
+    0xAE, 0x11, 0x6D, 0xFC, 0xC1, 0xC9, 0x44, 0x16, 0xC0, 0x42, 0xED, 0xA8, 0xC7, 0xAC, 0xF3, 0x9D,
+    0x26, 0xA3, 0xEB, 0x44, 0x4E, 0xFE, 0x33, 0x42, 0xB1, 0x96, 0xC1, 0x78, 0xEB, 0x3A, 0x1E, 0x06,
+    0x8E, 0xAF, 0x93, 0x7D, 0x85, 0x66, 0xC4, 0x78, 0x6C, 0xDC, 0xBA, 0x5F, 0x60, 0x3B, 0x52, 0x7B,
+    0xEC, 0x84, 0xF5, 0x58, 0x8F, 0x9D, 0xB1, 0x81, 0x2D, 0x60, 0xF5, 0x9F, 0x82, 0xFE, 0x2F, 0x3B,
+    0xC8, 0x6B, 0xB5, 0xB5, 0x9C, 0x5D, 0xEC, 0xA3, 0x4F, 0x73, 0xDC, 0xDA, 0xF6, 0x7C, 0x7A, 0x48,
+    0x5B, 0x77, 0xEF, 0xED, 0x1F, 0xEC, 0x67, 0xF1, 0xDD, 0x35, 0x2A, 0x29, 0x30, 0x48, 0x73, 0xA1,
+    0x6D, 0xC0, 0x68, 0xBD, 0x42, 0xAD, 0xF5, 0x0A, 0x8D, 0xD6, 0x2B, 0xD8, 0x37, 0xDA, 0x34, 0x87,
+    0xEB, 0x2A, 0xAD, 0x57, 0x28, 0xB4, 0x5E, 0x81, 0x61, 0xBD, 0x02, 0xEF, 0x7A, 0xE4, 0x0A, 0xF0,
+    0x73, 0x6C, 0x1E, 0x01, 0x1E, 0x79, 0x00, 0x78, 0x04, 0xE0, 0x61, 0x80, 0xFB, 0xA1, 0xBE, 0xB5,
+    0x75, 0x3F, 0xD9, 0x9A, 0x1E, 0x68, 0x26, 0xBB, 0xBC, 0x3B, 0x64, 0xA1, 0x58, 0x2A, 0xDF, 0xB8,
+    0x2B, 0x00, 0xD9, 0xD7, 0xB2, 0xC1, 0x37, 0xEA, 0x4F, 0x36, 0xF2, 0x85, 0x6A, 0xA2, 0xE9, 0xB9,
+    0xF9, 0xFA, 0xDD, 0xEE, 0xBF, 0x59, 0x9D, 0x49, 0x23, 0x9F, 0xB8, 0x8E, 0x95, 0x33, 0xFF, 0xA8,
+    0xC2, 0x17, 0xF3, 0x13, 0x34, 0x2F, 0x4D, 0x59, 0x78, 0x0E, 0xF3, 0xD2, 0x44, 0xB8, 0x49, 0xFD,
+    0xA2, 0xCF, 0x67, 0xEB, 0xBA, 0x4C, 0x72, 0xB9, 0x26, 0x68, 0xD3, 0x40, 0xF5, 0xB5, 0x94, 0x69,
+    0xEB, 0xEF, 0x64, 0x45, 0x1E, 0x02, 0x8E, 0xE3, 0xBC, 0x04, 0x27, 0x0B, 0x91, 0x63, 0x87, 0x0D,
+    0x28, 0x3C, 0xBC, 0x6B, 0xE8, 0x93, 0x18, 0xAF, 0xF6, 0x03, 0x39, 0x5F, 0x80, 0x00, 0x70, 0x13,
+    0xF8, 0x34, 0x40, 0xD3, 0x83, 0x25, 0x5D, 0x54, 0xB7, 0xE9, 0x22, 0xD3, 0xD3, 0xC0, 0x4D, 0x28,
+    0x1D, 0x8D, 0xA3, 0xE9, 0x29, 0x26, 0x6A, 0x4F, 0x35, 0x91, 0x7B, 0x4C, 0x20, 0x5F, 0x60, 0xC6,
+    0x88, 0x4C, 0xD7, 0xB9, 0x41, 0xF5, 0xB2, 0x33, 0xDA, 0xF8, 0x34, 0xE5, 0x77, 0x7C, 0x29, 0xB5,
+    0x57, 0x28, 0x7C, 0x00, 0xA8, 0x29, 0xBC, 0x05, 0x30, 0x7D, 0x3E, 0x1B, 0x07, 0x54, 0x2E, 0x8B,
+    0xD3, 0x60, 0x31, 0x21, 0xC9, 0x43, 0xE1, 0x69, 0xA4, 0x00, 0xD9, 0x4C, 0x7E, 0xFA, 0xEC, 0xAB,
+    0xE9, 0x19, 0x0B, 0x9F, 0xC6, 0x22, 0x81, 0xF4, 0x8C, 0x36, 0x8D, 0x4C, 0x8E, 0x7B, 0x28, 0xEF,
+    0xA6, 0x47, 0x7C, 0xED, 0x07, 0x3E, 0x8F, 0xEF, 0xC9, 0x63, 0x49, 0xE4, 0xA9, 0xFB, 0x44, 0x1E,
+    0xE3, 0x12, 0x79, 0xCA, 0x29, 0xB5, 0xBC, 0xF0, 0xA9, 0xE5, 0xD9, 0xBC, 0x27, 0x4F, 0xD8, 0x93,
+    0xE7, 0xC6, 0x9E, 0x3C, 0x57, 0x48, 0x17, 0x35, 0x5C, 0xDE, 0xE0, 0x26, 0x98, 0xB6, 0x91, 0xA7,
+    0xE9, 0xA9, 0x5C, 0xF3, 0x8F, 0xA2, 0x9A, 0x28, 0xC6, 0xDA, 0xD5, 0x2E, 0x5F, 0x28, 0xA6, 0x72,
+    0x2A, 0x7C, 0xA6, 0xEB, 0x99, 0x67, 0x26, 0x18, 0x6D, 0x2C, 0xC0, 0x50, 0x4A, 0xED, 0x8D, 0xBD,
+    0x6A, 0x71, 0x65, 0x3F, 0x54, 0x9A, 0xFD, 0x4E, 0xDD, 0xA6, 0x1D, 0xE3, 0xD2, 0x4E, 0x39, 0x42,
+    0xD7, 0x26, 0x82, 0x74, 0x2D, 0x71, 0x52, 0xEA, 0x24, 0x07, 0x0B, 0xD4, 0x92, 0x87, 0x00, 0x85,
+    0x34, 0xC3, 0x7E, 0x7A, 0xA7, 0xE2, 0x0D, 0x5F, 0xD9, 0xD5, 0xA4, 0xCE, 0x1D, 0x2B, 0xD1, 0x27,
+    0x97, 0x5C, 0x64, 0x1F, 0xFB, 0xE8, 0x1A, 0xDB, 0x5E, 0xB8, 0x6A, 0x8A, 0xCF, 0x75, 0x1F, 0xCF,
+    0x25, 0x61, 0x40, 0xED, 0x12, 0x5D, 0x2A, 0x9F, 0xB8, 0xA5, 0x59, 0x13, 0xF1, 0x0A, 0x2D, 0x89,
+    0xA5, 0xFE, 0xE0, 0x64, 0xC2, 0xF4, 0x5C, 0xEE, 0xA1, 0x23, 0xF3, 0x94, 0x0B, 0x14, 0x9E, 0x2B,
+    0xA0, 0x1E, 0x3A, 0x2A, 0x87, 0x5D, 0xA0, 0x1E, 0x99, 0xA9, 0xD4, 0x73, 0x12, 0x68, 0xC8, 0xD6,
+    0xA5, 0xD4, 0x46, 0x39, 0x62, 0xEB, 0xDE, 0x6E, 0xB0, 0x60, 0xBE, 0xB1, 0x70, 0x0D, 0x6A, 0xF2,
+    0xA5, 0xEE, 0x23, 0xC3, 0x74, 0xD9, 0x02, 0x70, 0x03, 0xE3, 0xEA, 0x3E, 0x72, 0x95, 0xA4, 0x11,
+    0x0A, 0x4F, 0x2D, 0xAD, 0x91, 0xAB, 0x3F, 0x71, 0xBA, 0xF5, 0x91, 0x80, 0xD4, 0x7D, 0x9A, 0xC3,
+    0xB3, 0x65, 0xCF, 0x44, 0x75, 0x1F, 0x5B, 0x4A, 0xF6, 0x34, 0xF0, 0xA9, 0x7B, 0x52, 0xA8, 0x6B,
+    0x31, 0x01, 0xE4, 0x30, 0x4B, 0x1C, 0x68, 0xE7, 0xAF, 0xAA, 0x85, 0x05, 0x8C, 0x23, 0x0B, 0xE4,
+    0x1A, 0x73, 0xAD, 0x99, 0xE4, 0xAC, 0xAE, 0x57, 0x89, 0x29, 0x22, 0x91, 0xAA, 0x11, 0xBA, 0xA8,
+    0x3B, 0xD5, 0x73, 0xDE, 0x0E, 0x0A, 0xB9, 0xE4, 0x4A, 0x05, 0xCA, 0xA8, 0x48, 0xF1, 0x60, 0xFB,
+    0x40, 0xD4, 0x88, 0x1E, 0x01, 0x50, 0xB8, 0x09, 0x64, 0x9B, 0x36, 0x20, 0xF3, 0x36, 0x00, 0x7C,
+    0xA5, 0xF2, 0x6F, 0xDC, 0x8F, 0xC7, 0xE9, 0x61, 0xE3, 0x40, 0x90, 0x03, 0xC8, 0x34, 0x02, 0x14,
+    0x8A, 0x8A, 0x9B, 0x3C, 0x40, 0xF5, 0xAD, 0x19, 0xC0, 0xDC, 0x8A, 0x63, 0xF2, 0xC9, 0x00, 0x60,
+    0xB3, 0x15, 0xA0, 0x43, 0x51, 0x4E, 0x2A, 0x0E, 0xB5, 0xAE, 0x87, 0x7C, 0xC1, 0x3A, 0x28, 0x66,
+    0x9A, 0x11, 0x4A, 0x4F, 0x3D, 0x81, 0x89, 0xA3, 0xD5, 0x48, 0x9A, 0xA1, 0x79, 0xF5, 0xF4, 0x99,
+    0x00, 0xB6, 0xA5, 0x08, 0xD0, 0x41, 0xBE, 0xC1, 0x06, 0x99, 0xA2, 0xCA, 0xA4, 0x36, 0x0F, 0xC0,
+    0xD0, 0x97, 0x6B, 0x4B, 0xAE, 0x57, 0x06, 0x79, 0xAC, 0x24, 0x79, 0x3A, 0x89, 0xA8, 0x40, 0x40,
+    0xA1, 0xA8, 0x66, 0xC6, 0xC7, 0xB5, 0x85, 0x07, 0xB8, 0x12, 0x07, 0x61, 0x7A, 0xB3, 0xB9, 0x07,
+    0x68, 0xBE, 0x37, 0xC5, 0x2B, 0x63, 0x33, 0xFF, 0x9F, 0xDF, 0x1E, 0x4A, 0x1C, 0xED, 0x76, 0xBB,
+    0xDD, 0x55, 0x60, 0x50, 0xD4, 0xBD, 0x33, 0x49, 0x12, 0x40, 0xA7, 0xD3, 0xD3, 0x00, 0x14, 0x3F,
+    0x59, 0xE2, 0x28, 0xAB, 0xFF, 0xF3, 0x14, 0xAD, 0xA4, 0xD0, 0xF5, 0x34, 0x40, 0xF5, 0x8D, 0x0D,
+    0xDE, 0x07, 0xD8, 0x32, 0x2A, 0xE9, 0xF9, 0x5C, 0x47, 0x5B, 0xAE, 0x76, 0x89, 0x1C, 0x6B, 0x16,
+    0xF9, 0xAD, 0x9C, 0xCA, 0x6D, 0xD8, 0x00, 0x4B, 0x2D, 0x2D, 0x90, 0x2F, 0x74, 0xD2, 0x08, 0xC6,
+    0xA5, 0x4B, 0x86, 0xA4, 0xD5, 0x94, 0x52, 0xEA, 0x91, 0xD3, 0xD3, 0xA1, 0x8F, 0x26, 0x54, 0xB6,
+    0xC1, 0x3B, 0x30, 0x23, 0xE5, 0x02, 0x8F, 0x33, 0x40, 0x3D, 0x51, 0xF8, 0x68, 0x71, 0x50, 0x3B,
+    0xDB, 0x93, 0x6D, 0x70, 0x33, 0xDF, 0x5A, 0x6A, 0x49, 0xCB, 0xA0, 0xA9, 0x92, 0xA4, 0x6F, 0x4A,
+    0xBD, 0x95, 0x24, 0xB2, 0x8F, 0x0E, 0x5F, 0x8E, 0x37, 0x57, 0x4B, 0x17, 0xDF, 0x6A, 0x7F, 0x34,
+    0x6C, 0x20, 0xE8, 0x16, 0x8C, 0x87, 0x61, 0x42, 0x90, 0x0B, 0xE3, 0xC1, 0x2C, 0x08, 0x18, 0x9C,
+    0xF1, 0x50, 0x04, 0x04, 0xD8, 0xD1, 0x78, 0xC8, 0xB7, 0x9D, 0x76, 0x57, 0x69, 0xBE, 0x2F, 0xA9,
+    0xCD, 0x37, 0x49, 0x33, 0xCD, 0x14, 0xCF, 0x5C, 0xB8, 0x2C, 0x7D, 0xA7, 0x73, 0xC6, 0x43, 0x35,
+    0x23, 0xC8, 0xE2, 0xAD, 0xED, 0x88, 0xA0, 0x9E, 0x31, 0x9E, 0x7A, 0xE3, 0x58, 0xAF, 0x4A, 0x6D,
+    0x71, 0x78, 0xB6, 0xAD, 0x3D, 0x67, 0xAF, 0x38, 0x50, 0x33, 0xB9, 0xAF, 0x01, 0x46, 0xDF, 0xF2,
+    0x40, 0x37, 0xA8, 0x07, 0x66, 0xBB, 0x02, 0x99, 0x6B, 0xC6, 0x37, 0x1A, 0xA5, 0xFF, 0xB3, 0xAE,
+    0xC3, 0x9E, 0xE2, 0x92, 0x56, 0xB0, 0x67, 0x74, 0x2B, 0x85, 0xA0, 0x0E, 0x34, 0x1E, 0xEA, 0x90,
+    0x09, 0x68, 0x66, 0xB3, 0x00, 0xD6, 0x5B, 0x07, 0x0C, 0x2F, 0x08, 0x40, 0x7F, 0xB2, 0x00, 0xC5,
+    0x66, 0x47, 0xC0, 0x2C, 0x02, 0x68, 0xBE, 0x13, 0x4D, 0xDA, 0xAF, 0x7B, 0x20, 0x8F, 0xA7, 0xAA,
+    0x45, 0x2D, 0x60, 0xBF, 0xB9, 0x01, 0xE8, 0xC3, 0x01, 0x28, 0x43, 0xED, 0xA3, 0xE6, 0x32, 0x01,
+    0x62, 0x18, 0x23, 0x49, 0x1D, 0x0C, 0x2E, 0xD3, 0x48, 0xB5, 0x92, 0xEB, 0xEC, 0x23, 0x1A, 0xC9,
+    0x24, 0x85, 0xC8, 0x02, 0x2D, 0x70, 0x7C, 0x9A, 0xDA, 0xFF, 0x3F, 0xC1, 0x57, 0x2C, 0x79, 0xA8,
+    0x5D, 0xE9, 0x4B, 0x5F, 0xBB, 0x3C, 0x74, 0x30, 0xAC, 0xD0, 0xCC, 0x50, 0x7B, 0xE8, 0x02, 0xD9,
+    0x3A, 0x50, 0xCE, 0x8D, 0xAB, 0xC7, 0xCA, 0xDB, 0x36, 0x0F, 0x7F, 0x04, 0x5F, 0x8D, 0xDF, 0xCE,
+    0x87, 0xB3, 0xA8, 0xB5, 0x6B, 0x29, 0x47, 0x1A, 0x49, 0xDF, 0xF2, 0xD8, 0x33, 0x3A, 0x79, 0xAC,
+    0x27, 0x93, 0x4F, 0xED, 0xA7, 0xF6, 0x50, 0xA9, 0x35, 0x0B, 0x54, 0xF2, 0x45, 0x80, 0xEA, 0xB5,
+    0x90, 0x0B, 0x2A, 0xAF, 0x56, 0x3D, 0x95, 0xB7, 0x93, 0x1D, 0xA9, 0xBC, 0x59, 0x8C, 0xA7, 0xF2,
+    0xF9, 0x56, 0x04, 0x2A, 0xCF, 0xE0, 0x44, 0x35, 0xD1, 0x4C, 0xD6, 0x55, 0x13, 0xD5, 0x62, 0xE6,
+    0x6A, 0xA2, 0x58, 0x8B, 0xAD, 0x9A, 0x40, 0xAD, 0x5E, 0x9A, 0xA0, 0x73, 0xCD, 0x6B, 0x13, 0x34,
+    0x53, 0xA1, 0x09, 0x8C, 0x67, 0x88, 0xAC, 0x65, 0x02, 0x54, 0x81, 0x2A, 0x12, 0xA2, 0x92, 0x3E,
+    0x7F, 0xB2, 0x52, 0x7D, 0x5B, 0x52, 0x20, 0x9F, 0x2A, 0x69, 0x86, 0xFB, 0xCF, 0x49, 0x11, 0x5F,
+    0xEF, 0x65, 0x2F, 0x00, 0xA1, 0x10, 0x40, 0x1E, 0xE7, 0x16, 0xCD, 0x00, 0xCD, 0x2B, 0x00, 0x5C,
+    0xBF, 0x9B, 0x0D, 0x2E, 0xED, 0xAE, 0xB1, 0xDB, 0x7D, 0x58, 0x9A, 0x8C, 0xB6, 0x4E, 0x0B, 0x83,
+    0xDC, 0xC9, 0x0C, 0xD6, 0xA1, 0x9E, 0xD2, 0x53, 0x06, 0xD8, 0xC0, 0x4E, 0xD4, 0x0E, 0x44, 0x31,
+    0x43, 0xB5, 0x30, 0x00, 0xD6, 0x99, 0x11, 0xB2, 0x2D, 0x5F, 0x00, 0x13, 0x15, 0x2A, 0xFB, 0xD2,
+    0x04, 0xE4, 0x6B, 0x88, 0xB3, 0x62, 0x0B, 0xD0, 0xC5, 0x87, 0x5A, 0x39, 0x57, 0xB5, 0x8B, 0xF0,
+    0xA6, 0x0E, 0x2E, 0xEB, 0x29, 0xA0, 0x89, 0xB2, 0x54, 0x5A, 0xE3, 0xF3, 0x52, 0x4B, 0x2D, 0x85,
+    0xB6, 0x76, 0x7F, 0xB9, 0x00, 0xEC, 0x7F, 0x6D, 0xC1, 0x48, 0xAF, 0x50, 0x48, 0x1A, 0xD1, 0xEE,
+    0x64, 0xC5, 0xBA, 0x38, 0x4A, 0xCD, 0x5C, 0x04, 0xB2, 0x0D, 0x81, 0x75, 0xD6, 0x61, 0xBC, 0xF1,
+    0x14, 0xCB, 0xE1, 0x43, 0x61, 0x1D, 0x43, 0x6F, 0x7C, 0x26, 0x57, 0x6C, 0xCF, 0xAA, 0x47, 0xDA,
+    0x5A, 0xEC, 0xAB, 0x4F, 0x47, 0xC7, 0x4C, 0xFC, 0xA1, 0x4C, 0xF1, 0x27, 0x5A, 0x4A, 0xC5, 0x79,
+    0xFC, 0xE8, 0xCB, 0x40, 0x2E, 0xB5, 0x60, 0xA5, 0x9E, 0x62, 0x3D, 0x56, 0x8B, 0x75, 0x71, 0x9A,
+    0x2D, 0x02, 0xC6, 0x53, 0x79, 0x6C, 0x4B, 0xE3, 0xB2, 0x15, 0x36, 0x2A, 0x4F, 0xE5, 0x69, 0x1C,
+    0x1B, 0x0C, 0x98, 0x89, 0x3C, 0x70, 0x13, 0x2A, 0x5F, 0x78, 0x68, 0x5C, 0xED, 0x60, 0xA0, 0x6B,
+    0xC9, 0x03, 0xEA, 0xA9, 0x7C, 0x21, 0x47, 0xE3, 0x0A, 0x39, 0x06, 0x0A, 0xB9, 0x3C, 0x90, 0xCB,
+    0x55, 0x9E, 0x4C, 0x7D, 0xE3, 0xC8, 0xC4, 0x00, 0x79, 0xC8, 0x03, 0x94, 0xBE, 0xF2, 0x9F, 0xA2,
+    0x76, 0xCD, 0x2D, 0xCF, 0x96, 0xC9, 0xCC, 0x95, 0xEF, 0x42, 0x2D, 0x3D, 0x26, 0xDF, 0x68, 0x02,
+    0x8E, 0x9E, 0xDA, 0x77, 0xBB, 0xDA, 0xAF, 0x50, 0x68, 0x5C, 0x28, 0xF4, 0xDA, 0x42, 0xF9, 0x6D,
+    0xCD, 0x14, 0xAE, 0xF3, 0xD0, 0x1E, 0xB7, 0xAF, 0x9B, 0x2A, 0x2A, 0xF5, 0x20, 0xCD, 0x94, 0xDB,
+    0xB3, 0x01, 0xE3, 0xF3, 0x95, 0x7A, 0x8C, 0xBE, 0xA1, 0x8D, 0xE3, 0x3E, 0x52, 0x7F, 0xBF, 0x39,
+    0x1E, 0x44, 0x36, 0x48, 0x54, 0xBA, 0x2D, 0xEA, 0x39, 0x52, 0x56, 0xD8, 0xFE, 0xB0, 0x37, 0x16,
+    0xA2, 0x39, 0x3B, 0xD1, 0xAB, 0x46, 0xB2, 0x5B, 0xA1, 0xB9, 0x9E, 0xF9, 0xF7, 0x6D, 0x06, 0x5C,
+    0x05, 0xAA, 0x0D, 0xB0, 0xEA, 0xE1, 0x39, 0xE3, 0x60, 0x29, 0x47, 0x58, 0x8A, 0x11, 0x42, 0x39,
+    0xC2, 0x4D, 0xE3, 0xC0, 0xAA, 0x85, 0x7A, 0xFD, 0x15, 0x3D, 0x64, 0x9A, 0x42, 0x34, 0xE6, 0x9A,
+    0x30, 0xDA, 0x4A, 0x89, 0xFA, 0xF6, 0xF0, 0xF7, 0xDB, 0xE0, 0x8D, 0xCF, 0xE5, 0xF3, 0xAD, 0x9C,
+    0xB1, 0x1E, 0xEB, 0x02, 0x66, 0xA1, 0xF2, 0x0F, 0x52, 0x04, 0xB2, 0x15, 0x10, 0x47, 0x43, 0x0B,
+    0xDD, 0xF7, 0xA5, 0x91, 0x13, 0x49, 0xF2, 0xA5, 0xB4, 0x7D, 0xB1, 0xA5, 0xD2, 0x75, 0x01, 0x65,
+    0x12, 0xEC, 0x21, 0x8E, 0xE4, 0x8D, 0x6C, 0x8B, 0x83, 0xA1, 0x1B, 0xC1, 0xCC, 0x74, 0x1B, 0x7C,
+    0x50, 0x7F, 0x2D, 0x6D, 0xCF, 0x7A, 0xAB, 0xCD, 0x48, 0x4B, 0xA1, 0x33, 0x06, 0xCD, 0xFC, 0xEE,
+    0x55, 0xB2, 0x8F, 0xEF, 0x3B, 0xCF, 0xB4, 0x35, 0x34, 0xD3, 0x06, 0xA5, 0xE6, 0xA4, 0x7B, 0x64,
+    0x72, 0x50, 0xC9, 0x83, 0x7D, 0x32, 0xC0, 0x1F, 0xDE, 0xE9, 0x4B, 0xCC, 0x6F, 0x9A, 0x89, 0x46,
+    0xFF, 0xE4, 0x91, 0x34, 0x17, 0x1B, 0x5D, 0x30, 0x33, 0x26, 0xD4, 0x23, 0xC5, 0xDA, 0x38, 0xF2,
+    0xCD, 0x3A, 0xD8, 0x6C, 0x0F, 0xEA, 0xF6, 0x9B, 0x2D, 0x6E, 0x1C, 0x6C, 0xD6, 0xC1, 0x6A, 0x47,
+    0xF2, 0xD0, 0x78, 0x8A, 0xC5, 0x04, 0x8C, 0x2F, 0xF5, 0x1F, 0x87, 0x31, 0x4F, 0xA2, 0x6B, 0x81,
+    0xEC, 0x30, 0x65, 0x95, 0x4B, 0xD1, 0x53, 0xEA, 0x79, 0x4F, 0xAE, 0x6D, 0x85, 0x1B, 0x8D, 0xE0,
+    0xBD, 0xB9, 0x5A, 0xE0, 0xF7, 0xEE, 0x21, 0xAD, 0x4E, 0x62, 0xEF, 0xAE, 0x64, 0x92, 0x26, 0xD4,
+    0xD6, 0x2B, 0x02, 0xB9, 0xAE, 0xC5, 0xCC, 0x8D, 0x23, 0xDF, 0xCC, 0x04, 0xDD, 0xAD, 0x05, 0xCC,
+    0x0F, 0x36, 0x28, 0x42, 0xD7, 0x83, 0xEA, 0x09, 0xEC, 0x8B, 0x01, 0x8C, 0x17, 0x14, 0x8B, 0x1D,
+    0xC9, 0x43, 0x15, 0x60, 0x43, 0x0E, 0x51, 0x6F, 0xFF, 0xAB, 0xDA, 0xF8, 0x84, 0xB5, 0x36, 0xE0,
+    0xC1, 0xA7, 0x49, 0x7C, 0x18, 0xE5, 0x73, 0x14, 0x26, 0xC5, 0x5D, 0xFE, 0x96, 0xBD, 0x8B, 0xE6,
+    0xDB, 0xBB, 0xDD, 0xEE, 0xDA, 0xF9, 0xC7, 0x9F, 0xBE, 0xF0, 0x95, 0x32, 0x00, 0x7F, 0x7E, 0x38,
+    0x75, 0x59, 0xE3, 0x7B, 0x30, 0xD2, 0xB7, 0xC6, 0x52, 0xDF, 0x57, 0x40, 0x6D, 0x25, 0xAC, 0xC3,
+    0xFA, 0x72, 0xA6, 0x52, 0x3B, 0x90, 0x6B, 0x31, 0x13, 0x37, 0xAD, 0x5B, 0x69, 0x9E, 0x0C, 0xF5,
+    0x58, 0x4D, 0xF6, 0xF9, 0x35, 0x5F, 0x8A, 0x50, 0x8F, 0x37, 0xB1, 0xCF, 0x6F, 0x4D, 0x5F, 0x04,
+    0xF3, 0xDA, 0x84, 0xED, 0xB5, 0x50, 0xFA, 0x6A, 0x83, 0x0D, 0x3B, 0xD1, 0xB8, 0x4A, 0x63, 0x3D,
+    0x47, 0x19, 0xFE, 0x50, 0xAD, 0x0D, 0xDA, 0xE3, 0x2F, 0x5F, 0x78, 0xD8, 0x2F, 0x00, 0x94, 0xFE,
+    0x30, 0xAB, 0x16, 0x1B, 0x40, 0x54, 0xC7, 0xB6, 0xBD, 0x11, 0x79, 0xB7, 0x39, 0x71, 0x10, 0x0F,
+    0x57, 0x8F, 0x76, 0x3B, 0xC9, 0x59, 0xFD, 0x77, 0xAD, 0x9C, 0x6C, 0xD1, 0xB3, 0x9B, 0xAF, 0xD0,
+    0x51, 0x2E, 0x14, 0x0B, 0xC6, 0x47, 0x37, 0x10, 0x37, 0xC1, 0xBA, 0xC2, 0xC3, 0x40, 0xED, 0x60,
+    0x63, 0x85, 0x3C, 0x94, 0x1E, 0x4A, 0xDF, 0xB4, 0x60, 0xA6, 0x00, 0xD4, 0x2F, 0x4E, 0x80, 0xED,
+    0x00, 0x86, 0xE5, 0xA0, 0x17, 0x47, 0x91, 0x55, 0xCE, 0x07, 0x6F, 0x38, 0x2B, 0xC9, 0x27, 0x0E,
+    0x43, 0x0B, 0xD4, 0x01, 0xB2, 0x8F, 0x45, 0x1E, 0x5E, 0x81, 0x5A, 0xEE, 0x5C, 0xAE, 0x1D, 0x01,
+    0x34, 0xE1, 0xA0, 0x51, 0x57, 0x51, 0xD9, 0x1E, 0x38, 0x38, 0xCE, 0xA3, 0x64, 0x6C, 0x5E, 0xFF,
+    0x71, 0xB3, 0x42, 0xF3, 0xA2, 0x04, 0xC3, 0x20, 0x91, 0xEB, 0xC7, 0xB5, 0xA8, 0x56, 0xAA, 0x40,
+    0x33, 0x62, 0x16, 0x06, 0xA8, 0x7D, 0x1E, 0xC0, 0xBA, 0xCA, 0x83, 0x68, 0x1C, 0x45, 0x60, 0x00,
+    0x73, 0xE1, 0xE3, 0x8D, 0xC6, 0x51, 0xCE, 0x0C, 0x60, 0x5D, 0x1E, 0xC8, 0x36, 0x2A, 0x4F, 0xED,
+    0x69, 0xB6, 0x67, 0x04, 0x83, 0xE4, 0xC9, 0xA5, 0x33, 0xA8, 0xFC, 0x03, 0xF7, 0x7E, 0x92, 0xC3,
+    0x03, 0x96, 0x5A, 0x01, 0x29, 0x40, 0x7E, 0x7A, 0x7A, 0x41, 0x66, 0x6F, 0x0C, 0x50, 0x86, 0x72,
+    0x85, 0xDA, 0xD7, 0x33, 0xD8, 0x3E, 0x0A, 0xCA, 0x7B, 0xBD, 0x76, 0xBB, 0xF6, 0xD2, 0xEE, 0xDF,
+    0x4A, 0x48, 0xFF, 0xA7, 0xE6, 0x6C, 0x58, 0xCA, 0x00, 0xB6, 0xAD, 0x66, 0xB2, 0x40, 0x3D, 0x61,
+    0x26, 0xAC, 0xA3, 0x83, 0xAE, 0xCD, 0x17, 0x10, 0xC6, 0x91, 0x87, 0x68, 0x1C, 0x16, 0x33, 0x54,
+    0xBE, 0x76, 0x50, 0xBB, 0xE7, 0x00, 0xFB, 0xA4, 0x07, 0xBA, 0xBA, 0x07, 0xD6, 0x00, 0xE4, 0x9A,
+    0x0E, 0xBD, 0x66, 0xA2, 0xD5, 0x32, 0x1E, 0x1A, 0x14, 0x87, 0x8B, 0x75, 0x40, 0xBE, 0xEE, 0x35,
+    0x80, 0xA3, 0x13, 0x01, 0x8D, 0x66, 0xA0, 0x13, 0xC0, 0x90, 0x5A, 0x16, 0x1D, 0xC6, 0xC9, 0xCD,
+    0x9D, 0x45, 0x7B, 0x99, 0x3B, 0x06, 0xD6, 0x6F, 0x95, 0x89, 0x09, 0x85, 0x14, 0x62, 0x94, 0xA2,
+    0x94, 0xE6, 0x7B, 0x37, 0xF1, 0x97, 0x29, 0x74, 0xEF, 0x8B, 0x21, 0xB6, 0xDF, 0x89, 0xFD, 0x75,
+    0x05, 0x40, 0xAF, 0x86, 0x68, 0xE9, 0xCD, 0x71, 0xF6, 0x8A, 0x5C, 0x76, 0xED, 0xB7, 0xB0, 0x33,
+    0x72, 0xC7, 0xFB, 0x29, 0x3D, 0x9F, 0xA2, 0x58, 0xF3, 0x99, 0x5C, 0xF2, 0x30, 0xC8, 0x41, 0x75,
+    0xF6, 0xAB, 0xEC, 0x96, 0xDF, 0x74, 0xBA, 0x76, 0xED, 0xDE, 0x2F, 0x79, 0x10, 0x3F, 0x69, 0x8E,
+    0xC3, 0xCC, 0x89, 0x96, 0x73, 0x6C, 0x45, 0x3C, 0x1C, 0xC6, 0x5F, 0x26, 0x89, 0x8D, 0xDB, 0x7B,
+    0xDE, 0x9E, 0x3B, 0x48, 0x9B, 0x68, 0xA2, 0x7E, 0x17, 0xE8, 0x36, 0xA0, 0x3A, 0x0F, 0xEC, 0x56,
+    0x07, 0xE9, 0x94, 0xAB, 0x87, 0x4C, 0x7E, 0x2F, 0xBE, 0x62, 0x5B, 0xEE, 0xB6, 0xAB, 0x8E, 0x6F,
+    0x3E, 0x05, 0x95, 0x34, 0x53, 0x49, 0xEA, 0x73, 0x7D, 0xFE, 0x64, 0x61, 0x70, 0xD8, 0xBE, 0x9E,
+    0xC8, 0x97, 0x22, 0x40, 0xDD, 0x0F, 0x2D, 0xCC, 0xC6, 0xC3, 0x3B, 0xA3, 0x9F, 0xA3, 0x19, 0x0F,
+    0xF6, 0x4F, 0x14, 0xD4, 0xF7, 0xDE, 0x5D, 0x01, 0xEC, 0x04, 0xE4, 0x02, 0xA8, 0xA3, 0x14, 0x1D,
+    0x81, 0x52, 0x3D, 0xD0, 0xE8, 0x3A, 0x7F, 0xC9, 0x20, 0x69, 0x8C, 0xE6, 0x73, 0x1E, 0xE7, 0xD4,
+    0x8F, 0x1E, 0xD4, 0xFF, 0x3F, 0x4E, 0x1E, 0xEB, 0x7A, 0x8A, 0x0D, 0x30, 0x73, 0x6C, 0x5D, 0x31,
+    0x03, 0x77, 0x4F, 0x48, 0xB9, 0x26, 0x2A, 0xA9, 0x35, 0x92, 0x37, 0xBE, 0xD8, 0x8C, 0xC7, 0x7E,
+    0x76, 0xC6, 0xFC, 0x6D, 0x20, 0xBF, 0xBE, 0x25, 0x15, 0xB2, 0x1E, 0xE3, 0x1D, 0xB2, 0x2D, 0xB1,
+    0xAC, 0xF1, 0xE9, 0x51, 0x87, 0x11, 0xCC, 0x46, 0xF6, 0x41, 0x6D, 0x83, 0x6F, 0xA4, 0x25, 0x1B,
+    0x34, 0x27, 0x55, 0x35, 0xFB, 0x1A, 0x80, 0xF5, 0x7B, 0x0F, 0x5A, 0xBE, 0x0A, 0x18, 0x8A, 0x00,
+    0x8D, 0x33, 0x23, 0xB9, 0x8F, 0x61, 0x8F, 0xF3, 0xD7, 0x27, 0xBF, 0xDB, 0x26, 0x67, 0xC0, 0x20,
+    0x2D, 0x34, 0x67, 0x1F, 0x51, 0x5F, 0x05, 0x8A, 0x25, 0xDB, 0xA0, 0xE9, 0xAD, 0x23, 0x5B, 0xAA,
+    0x19, 0x4C, 0x2B, 0xE0, 0x7A, 0x3D, 0x1D, 0x64, 0xD0, 0xBF, 0x44, 0xD2, 0xB8, 0x3B, 0x1E, 0x94,
+    0xA3, 0xC6, 0x03, 0x99, 0x7A, 0xC0, 0xC4, 0x61, 0xB4, 0x00, 0xB9, 0xCE, 0x38, 0x9E, 0x2A, 0x49,
+    0x2B, 0xB5, 0x24, 0x97, 0x2C, 0xD3, 0xA3, 0x2F, 0xB7, 0xC0, 0x7D, 0xE9, 0x6E, 0xCD, 0x02, 0xB5,
+    0x5A, 0xCC, 0xDF, 0x7B, 0xAA, 0x49, 0x94, 0xDE, 0x8C, 0x85, 0x67, 0xE1, 0xCF, 0x92, 0x73, 0xF1,
+    0xC0, 0xE4, 0x8D, 0x56, 0xAC, 0xE4, 0xAC, 0x33, 0x8B, 0x75, 0x6C, 0xF5, 0x88, 0xFD, 0xB0, 0xE7,
+    0x5D, 0x8F, 0x2D, 0x89, 0x21, 0xBB, 0x3D, 0x61, 0x17, 0x0E, 0x86, 0x00, 0x66, 0x86, 0x5C, 0x2D,
+    0xD8, 0x85, 0xA3, 0x4A, 0xB7, 0xE5, 0x06, 0x69, 0x3A, 0x96, 0x46, 0x8E, 0xBE, 0xB8, 0x57, 0x5E,
+    0x63, 0x63, 0xA2, 0x47, 0x77, 0x98, 0x80, 0x72, 0x8D, 0x1E, 0xA3, 0x7B, 0x4D, 0xE0, 0xBF, 0xBE,
+    0x34, 0xFD, 0x8B, 0xA4, 0x50, 0x5B, 0x1F, 0xB5, 0x8C, 0xE4, 0x0F, 0xBC, 0xEB, 0x35, 0x2C, 0xE4,
+    0xD2, 0x58, 0x48, 0xA1, 0x08, 0xE8, 0xC9, 0x80, 0xF9, 0xF6, 0x4A, 0x31, 0x0F, 0xF0, 0xB4, 0xED,
+    0xC1, 0xEC, 0x79, 0x73, 0x4D, 0xBC, 0x59, 0x4F, 0xE9, 0xF9, 0xD4, 0x46, 0x87, 0x51, 0xA1, 0x9E,
+    0xAB, 0x83, 0x9E, 0x0D, 0x95, 0xB4, 0x71, 0xA2, 0x15, 0x3E, 0x7A, 0x75, 0x7F, 0xFB, 0x1B, 0x54,
+    0x13, 0x55, 0x52, 0xF5, 0x06, 0x40, 0x27, 0xE3, 0x7E, 0xD6, 0x8A, 0x2D, 0x69, 0xDA, 0xDF, 0x90,
+    0xD1, 0x7F, 0x95, 0x7F, 0xCD, 0x73, 0x34, 0x7D, 0xED, 0x1A, 0x97, 0x87, 0xDA, 0x61, 0xBF, 0x3E,
+    0x46, 0x61, 0xD2, 0xF9, 0xC3, 0x24, 0xFD, 0x4B, 0x61, 0x52, 0x62, 0xE4, 0xA4, 0x69, 0xC1, 0xF6,
+    0xC6, 0x43, 0xB6, 0x15, 0x01, 0x28, 0xD7, 0xD8, 0xAA, 0x28, 0xEE, 0xA2, 0xE7, 0x28, 0xC6, 0x76,
+    0xEE, 0x08, 0x15, 0xBD, 0xA5, 0x1E, 0x5B, 0x04, 0x77, 0x3A, 0x69, 0xDF, 0x2E, 0x8F, 0x6D, 0x1A,
+    0x9C, 0xA5, 0xDA, 0x1B, 0x50, 0x68, 0x36, 0x23, 0x34, 0x6A, 0x57, 0xA0, 0x8C, 0x71, 0xC8, 0xAE,
+    0x0D, 0xF1, 0xA0, 0x05, 0xBA, 0x47, 0x3D, 0x50, 0xCE, 0xEF, 0x8D, 0xF2, 0xB4, 0xE7, 0x58, 0x9A,
+    0x63, 0x92, 0x50, 0x4B, 0x16, 0x25, 0xB5, 0x9D, 0xB2, 0xA1, 0xC5, 0xCC, 0x94, 0xF3, 0x3E, 0x9E,
+    0x1F, 0x0D, 0x91, 0x22, 0x40, 0xD7, 0x62, 0x7B, 0xCA, 0x99, 0x72, 0x81, 0xAE, 0xA5, 0x7B, 0xFD,
+    0xC1, 0xFE, 0xB2, 0x91, 0x72, 0x26, 0x17, 0x0C, 0x2D, 0xF5, 0x82, 0x9D, 0x61, 0xB8, 0x3D, 0xE8,
+    0x1F, 0x28, 0xA4, 0x9F, 0x68, 0xA6, 0xD2, 0xD2, 0x08, 0x8E, 0x9E, 0xE2, 0x1A, 0xBF, 0xB1, 0x1E,
+    0xF3, 0x48, 0xFF, 0xA8, 0x44, 0x59, 0xB5, 0xC0, 0x27, 0xD7, 0x73, 0xBB, 0xB3, 0x1E, 0x01, 0x69,
+    0x83, 0x52, 0x5A, 0xE0, 0xE8, 0x63, 0x67, 0x57, 0xF7, 0x1F, 0x5F, 0xED, 0xDA, 0x34, 0x90, 0xBA,
+    0x38, 0xAE, 0x9F, 0xD1, 0x48, 0x37, 0x32, 0xB4, 0xD1, 0xB7, 0x53, 0x8F, 0x94, 0x33, 0x82, 0x7A,
+    0x2C, 0x16, 0xE8, 0xDA, 0x7A, 0x22, 0x5B, 0x23, 0x8D, 0xB3, 0x0D, 0xEA, 0x31, 0x52, 0xBD, 0xF6,
+    0x64, 0x2B, 0xD6, 0x51, 0xCE, 0xA8, 0xA7, 0x19, 0x33, 0xF5, 0x85, 0xDA, 0x42, 0xAF, 0x4A, 0x4F,
+    0x45, 0x52, 0xE7, 0xDA, 0x2A, 0x39, 0xFE, 0x7D, 0x7B, 0xD4, 0x42, 0x2D, 0xB9, 0x68, 0x2F, 0x44,
+    0xFF, 0x62, 0x16, 0x63, 0x32, 0x77, 0x0D, 0x87, 0xDD, 0x6E, 0xB7, 0xBB, 0xDA, 0x49, 0xD2, 0x67,
+    0x25, 0x69, 0xC9, 0x74, 0x7A, 0x3A, 0xF4, 0xC6, 0x93, 0x2D, 0x08, 0x4C, 0x6F, 0x3C, 0xCC, 0x08,
+    0x8E, 0x92, 0x49, 0xAD, 0x73, 0xEB, 0x3A, 0xEE, 0xDE, 0x96, 0x5A, 0x24, 0xCD, 0x18, 0x49, 0xF7,
+    0xB8, 0x60, 0xBF, 0x9B, 0xB5, 0xC6, 0xC3, 0x23, 0x08, 0xCA, 0xD1, 0xF8, 0xA4, 0x5B, 0x9A, 0xF1,
+    0x44, 0x52, 0xB0, 0x92, 0xF4, 0xA2, 0xF6, 0x69, 0x28, 0x18, 0x69, 0xCA, 0xA4, 0x95, 0x46, 0x72,
+    0xF7, 0xB4, 0x72, 0xAE, 0x53, 0x4A, 0x7D, 0xAE, 0x67, 0x36, 0xBA, 0xD6, 0xCC, 0x66, 0xC2, 0x7E,
+    0x26, 0x50, 0x04, 0xDB, 0xD3, 0xDC, 0x5A, 0xC8, 0x42, 0x97, 0xEE, 0x18, 0xBA, 0xD3, 0xD3, 0xD3,
+    0xCF, 0xCE, 0x69, 0xC6, 0x29, 0x96, 0x34, 0xD3, 0xE4, 0x02, 0xEA, 0x95, 0xAC, 0x1D, 0xF4, 0xCC,
+    0x92, 0x4B, 0x6A, 0x4B, 0x69, 0x8C, 0x0A, 0xC6, 0x3B, 0xA0, 0xA5, 0x98, 0xF8, 0x43, 0xB0, 0x7D,
+    0xE5, 0x28, 0xF4, 0xCC, 0x02, 0x46, 0xD1, 0x12, 0x6D, 0x81, 0x4B, 0xBF, 0x29, 0x84, 0x04, 0x97,
+    0x2F, 0xFC, 0x11, 0xF5, 0x2B, 0xB5, 0x43, 0x5A, 0x28, 0xB4, 0xC1, 0xF1, 0xF6, 0x4B, 0xA6, 0x68,
+    0xF4, 0xB4, 0x44, 0x81, 0xD4, 0x4D, 0x7B, 0x77, 0x2D, 0xDD, 0x21, 0x72, 0xFD, 0x9B, 0xC1, 0x9A,
+    0x7F, 0x91, 0x14, 0x92, 0x42, 0x49, 0xFF, 0xCC, 0xD6, 0x7B, 0x5A, 0xE1, 0xC3, 0x19, 0x74, 0x5A,
+    0x68, 0x6E, 0x0F, 0x53, 0x39, 0xA3, 0x76, 0xA3, 0x58, 0x6A, 0x87, 0xBD, 0xB5, 0x90, 0x07, 0xDB,
+    0x53, 0x47, 0x42, 0x4A, 0x7A, 0xF1, 0xF6, 0xE9, 0xE9, 0x97, 0xBA, 0x36, 0x4D, 0x26, 0xB6, 0x4F,
+    0x54, 0x6A, 0x7C, 0x9C, 0x70, 0x1E, 0xA8, 0x74, 0x7B, 0xE8, 0x1B, 0x69, 0xA6, 0xD3, 0x0A, 0xBF,
+    0xFB, 0x14, 0x97, 0x76, 0xBB, 0xDD, 0xAE, 0x94, 0xA4, 0xA5, 0x93, 0xA4, 0xBE, 0xBE, 0x7D, 0xFA,
+    0xCC, 0x82, 0xA0, 0xEE, 0x8D, 0x87, 0x48, 0xA0, 0xD6, 0x78, 0xB8, 0xFA, 0x46, 0x8D, 0x7E, 0x36,
+    0x51, 0xA5, 0x8D, 0x59, 0x2B, 0x6F, 0x40, 0x41, 0x0F, 0x0F, 0x20, 0x28, 0x46, 0xE3, 0xE1, 0xD3,
+    0x08, 0xAA, 0xD1, 0x78, 0x58, 0x8F, 0x25, 0xE9, 0x96, 0xF6, 0x8D, 0x50, 0x4F, 0x4A, 0xD6, 0xB0,
+    0xED, 0xC1, 0x33, 0xB8, 0x5D, 0xB8, 0x9D, 0x80, 0x32, 0xBA, 0xD8, 0xCE, 0xDE, 0x7E, 0x1A, 0x0D,
+    0x29, 0xE3, 0x24, 0x9F, 0x93, 0xB1, 0x16, 0x99, 0xF4, 0x76, 0x4B, 0xA6, 0x25, 0x1A, 0xA5, 0x91,
+    0xE9, 0x1D, 0x37, 0x61, 0x88, 0x9E, 0xB9, 0xCA, 0x83, 0xF9, 0xE7, 0x00, 0x58, 0x1D, 0x74, 0xA3,
+    0xBB, 0x3C, 0xB8, 0xBF, 0x9E, 0xA4, 0xBF, 0xCA, 0xBF, 0xA6, 0xC1, 0x8C, 0x59, 0xC8, 0x17, 0x8C,
+    0xEF, 0xC0, 0x7E, 0xCE, 0x91, 0x69, 0x4E, 0xAA, 0x7C, 0xED, 0x7E, 0xA9, 0xFC, 0x09, 0xFC, 0x25,
+    0x07, 0x03, 0x2D, 0x51, 0xD3, 0xBE, 0xEC, 0x81, 0xC6, 0x89, 0x64, 0xA3, 0x51, 0x39, 0x5E, 0x97,
+    0x0D, 0xF2, 0xC9, 0xDB, 0x57, 0xA3, 0x7E, 0xD0, 0x27, 0xC7, 0x42, 0xBD, 0xED, 0x3E, 0x16, 0xA8,
+    0x17, 0x18, 0xA8, 0x3D, 0xD4, 0x51, 0x11, 0x98, 0xAA, 0x19, 0x98, 0x8B, 0x00, 0x3C, 0xB0, 0x8F,
+    0xF6, 0xB7, 0xE7, 0x01, 0xC0, 0x48, 0xC9, 0x14, 0x13, 0x14, 0x1C, 0xED, 0x76, 0xD6, 0x51, 0x49,
+    0x5F, 0xF7, 0xE4, 0xD2, 0x37, 0x57, 0xC8, 0x4E, 0x26, 0xF5, 0x50, 0xCE, 0x8D, 0x87, 0x6C, 0x2D,
+    0xA3, 0x4E, 0xAA, 0x11, 0xEA, 0xB1, 0x5E, 0xA1, 0x9C, 0x73, 0xCD, 0xE4, 0x2B, 0x8D, 0xB6, 0x41,
+    0x6D, 0x26, 0x49, 0x63, 0x7A, 0x36, 0x8E, 0x3E, 0x7E, 0x15, 0x20, 0x3B, 0xFF, 0x15, 0x4D, 0x31,
+    0x7D, 0x12, 0x8A, 0x7F, 0x0E, 0xC0, 0x4D, 0xE3, 0xA1, 0x76, 0xB6, 0xA5, 0xF0, 0x2C, 0xF0, 0x9E,
+    0x38, 0x03, 0x9E, 0xBF, 0x9A, 0xED, 0x63, 0x2B, 0x8D, 0xA4, 0xA9, 0xDA, 0x9E, 0xDD, 0xD6, 0x6C,
+    0xA5, 0x9E, 0x7A, 0xEB, 0x18, 0x28, 0x66, 0xCA, 0x19, 0xDB, 0x62, 0xDB, 0x62, 0xA6, 0x98, 0xB1,
+    0x3D, 0x1D, 0xF9, 0x8A, 0xF1, 0x98, 0xB3, 0x8F, 0x45, 0x5D, 0xA2, 0xC5, 0x48, 0x3D, 0xD9, 0x72,
+    0x69, 0x3F, 0xE8, 0x92, 0xF7, 0x74, 0x8C, 0x8E, 0x42, 0xBD, 0x42, 0x2D, 0xC9, 0x67, 0x92, 0xD4,
+    0x76, 0x2D, 0x97, 0x43, 0x3D, 0x82, 0xBD, 0x15, 0xA0, 0x58, 0x6C, 0x0F, 0xF6, 0xB1, 0x00, 0xF5,
+    0xD4, 0xCC, 0xD4, 0x01, 0x49, 0x1B, 0x85, 0xB4, 0xB5, 0xE4, 0xC3, 0x19, 0xC0, 0xFB, 0xC8, 0x80,
+    0x2B, 0xE4, 0x0E, 0xCC, 0x94, 0x7B, 0x92, 0x14, 0xC4, 0x2A, 0x3A, 0x72, 0x67, 0x80, 0xA3, 0xD7,
+    0x5B, 0x86, 0xBF, 0x61, 0x7D, 0x98, 0x7C, 0x79, 0x7F, 0x0C, 0x4F, 0x50, 0xF5, 0x94, 0x6B, 0x3E,
+    0x83, 0x95, 0x00, 0xA9, 0x87, 0x6C, 0xB8, 0x7E, 0x8F, 0x09, 0x3E, 0xD7, 0x3F, 0xC4, 0x10, 0xD5,
+    0xC6, 0xF0, 0xAA, 0xBE, 0x3F, 0xD6, 0x63, 0xB6, 0xBD, 0x23, 0x86, 0xDF, 0x6C, 0x4B, 0xB7, 0xEF,
+    0xB8, 0x16, 0xDB, 0x16, 0x0B, 0xA5, 0xA7, 0x19, 0x11, 0xE8, 0xF3, 0xC3, 0x98, 0x9C, 0xB7, 0xD2,
+    0x02, 0xF5, 0x67, 0xAE, 0x1E, 0x3A, 0xAE, 0x3D, 0x37, 0xD3, 0xA4, 0x2D, 0x3E, 0x2C, 0xB5, 0xA4,
+    0xB9, 0x9C, 0xC9, 0x86, 0xE7, 0x57, 0x28, 0x82, 0x75, 0x60, 0x9F, 0x5C, 0xA0, 0x98, 0xAD, 0x23,
+    0xDB, 0x72, 0xB5, 0x99, 0x9C, 0x91, 0x34, 0x61, 0xA5, 0x57, 0xF6, 0x09, 0x1A, 0xFB, 0x8C, 0xA4,
+    0x48, 0xCA, 0x68, 0xEC, 0x45, 0x91, 0x9B, 0xC5, 0xE0, 0xFA, 0xBD, 0x4D, 0xFA, 0xDF, 0xBC, 0xEE,
+    0x7B, 0x10, 0xA0, 0x0A, 0x07, 0x57, 0x67, 0x0C, 0x2A, 0x74, 0xED, 0x1B, 0xC6, 0x00, 0x7E, 0xDD,
+    0xC7, 0x5D, 0xF6, 0xEC, 0x77, 0xA3, 0xFE, 0xBE, 0xC5, 0x78, 0xA1, 0xA3, 0x3B, 0xDB, 0x9D, 0x78,
+    0xBA, 0x89, 0x3C, 0xD0, 0x39, 0xE8, 0xA2, 0xA9, 0xDC, 0x37, 0xE3, 0x5E, 0x3C, 0x70, 0x35, 0xA6,
+    0x4B, 0x45, 0xEF, 0x4A, 0x94, 0x20, 0xAF, 0xEB, 0x86, 0x4B, 0xBB, 0x6B, 0x82, 0x46, 0x8A, 0xDD,
+    0xF0, 0x27, 0x33, 0x1C, 0x0D, 0x4F, 0x6E, 0x40, 0x3D, 0x0E, 0x0E, 0xCA, 0xB9, 0x9E, 0x21, 0x5B,
+    0x0B, 0xB5, 0xD0, 0xB5, 0xDD, 0x0C, 0xF5, 0x58, 0x69, 0xA4, 0x9A, 0x19, 0x74, 0x5B, 0xEB, 0xDE,
+    0x70, 0x8B, 0xCF, 0xC6, 0xA5, 0x2F, 0x5E, 0x20, 0xB2, 0x19, 0x21, 0x05, 0x2F, 0xA3, 0x7B, 0x24,
+    0x39, 0x26, 0xF6, 0x99, 0x25, 0xF3, 0x05, 0xA7, 0x6E, 0x4C, 0xA6, 0x29, 0xDD, 0x3E, 0x8F, 0xF1,
+    0x3C, 0x63, 0x37, 0xF9, 0x53, 0x6B, 0xC7, 0x5E, 0xB3, 0xAA, 0xFD, 0x79, 0xA8, 0x6F, 0xFE, 0x4D,
+    0x1B, 0x82, 0x75, 0x74, 0xC1, 0x17, 0x49, 0xDD, 0x50, 0x4A, 0x51, 0xF9, 0xBE, 0x8F, 0x1D, 0xD3,
+    0xF5, 0xB1, 0x67, 0x02, 0xC0, 0x15, 0x0A, 0x77, 0x0F, 0x25, 0xB8, 0xE5, 0xD2, 0xEE, 0x5A, 0xA7,
+    0x95, 0x4A, 0x7A, 0x31, 0x96, 0x7E, 0xCC, 0x99, 0x5A, 0x38, 0x89, 0x9A, 0x43, 0x16, 0x4D, 0x67,
+    0xEA, 0xE9, 0x67, 0x3C, 0x94, 0xA4, 0x0D, 0x24, 0x49, 0x17, 0x0E, 0x7F, 0x9E, 0x5B, 0xDD, 0x79,
+    0x78, 0x72, 0xBB, 0xA5, 0xD4, 0xD3, 0x56, 0x1B, 0xA5, 0xF4, 0xA2, 0x34, 0x22, 0x05, 0x62, 0x7E,
+    0x48, 0x4A, 0xE6, 0x49, 0xB9, 0x45, 0xD1, 0xFB, 0xE4, 0x07, 0x80, 0x90, 0xC7, 0x94, 0x56, 0xD3,
+    0x5F, 0xCC, 0x7A, 0x3E, 0x9F, 0xC9, 0xF2, 0x68, 0x07, 0x46, 0x1A, 0xA6, 0x30, 0xED, 0x9B, 0xCC,
+    0x06, 0x2A, 0x42, 0xA5, 0x1E, 0xEC, 0x8B, 0x52, 0x4B, 0xB1, 0x25, 0xA3, 0xF8, 0xD1, 0x61, 0xA4,
+    0x50, 0x9B, 0x8B, 0x54, 0x20, 0x50, 0x04, 0x62, 0x9A, 0x0F, 0x55, 0x3C, 0x18, 0x7E, 0xBE, 0x83,
+    0xEE, 0x15, 0xEA, 0xB3, 0x76, 0xD0, 0x64, 0xB4, 0x1A, 0x6D, 0x48, 0xEE, 0xD2, 0xEE, 0x1A, 0xD9,
+    0x6E, 0xF7, 0x21, 0x69, 0x64, 0x50, 0xE8, 0xB4, 0x50, 0x49, 0x6D, 0x3D, 0xC3, 0xB1, 0xEE, 0x26,
+    0xE4, 0xA9, 0x4E, 0x4F, 0x4F, 0x87, 0xDB, 0xFF, 0x59, 0x92, 0xA4, 0x2D, 0x1D, 0x5E, 0x7F, 0x23,
+    0xAA, 0xDF, 0xD5, 0x81, 0xE9, 0xF0, 0x17, 0x61, 0x8D, 0x78, 0x78, 0xAC, 0xA7, 0xA1, 0xBB, 0xFD,
+    0x98, 0x34, 0xD1, 0x29, 0x74, 0x5A, 0x31, 0x92, 0x8B, 0x6A, 0x4C, 0x9E, 0x82, 0xEF, 0x1E, 0xE0,
+    0x99, 0x70, 0xF7, 0xAC, 0x13, 0x2B, 0xA9, 0x88, 0x69, 0x9F, 0x97, 0xB4, 0x6B, 0x2F, 0x4E, 0x47,
+    0x57, 0xA1, 0x08, 0x97, 0x35, 0x82, 0x1A, 0xAD, 0xFB, 0x49, 0xCE, 0xA8, 0xAF, 0x17, 0x0A, 0x91,
+    0x69, 0xDF, 0x0D, 0xB1, 0x5B, 0x8C, 0x27, 0x0F, 0x7B, 0xDA, 0x0A, 0x1A, 0x97, 0xC8, 0xFD, 0x53,
+    0x4E, 0x94, 0x5B, 0x9B, 0xE9, 0xA9, 0x46, 0x4B, 0x21, 0xFD, 0x49, 0xEC, 0x86, 0x77, 0xF5, 0xEF,
+    0x30, 0x6B, 0xF9, 0x92, 0xBE, 0xF9, 0xA3, 0xDB, 0x0A, 0xA1, 0xDE, 0xFE, 0xD5, 0x45, 0xBF, 0xF0,
+    0xD1, 0x6E, 0xF7, 0x21, 0xE9, 0xDB, 0xD2, 0x94, 0xA9, 0x7D, 0x1D, 0x4B, 0xFC, 0xAC, 0x07, 0xD9,
+    0x70, 0x56, 0x48, 0x3F, 0x88, 0x74, 0xA8, 0x96, 0xE2, 0x43, 0xFA, 0xCC, 0x8F, 0xB4, 0x85, 0x60,
+    0xF5, 0x50, 0xAE, 0x47, 0xEF, 0xC8, 0x55, 0xF9, 0xDD, 0xAF, 0x32, 0xAC, 0x58, 0xB5, 0x59, 0x37,
+    0x52, 0xCE, 0x64, 0x6B, 0xAC, 0xAE, 0xF9, 0x29, 0x07, 0xA5, 0xAE, 0x37, 0x92, 0x91, 0xFA, 0x5A,
+    0x7A, 0x21, 0x1A, 0xAA, 0xEE, 0x4E, 0x2F, 0xCF, 0x6E, 0x77, 0xAD, 0x96, 0x3E, 0x23, 0x4D, 0x74,
+    0x23, 0x45, 0x00, 0xEB, 0x7E, 0xD1, 0xB7, 0xCB, 0xBA, 0x6E, 0xA4, 0xE7, 0x63, 0xC3, 0x6A, 0xE9,
+    0xEB, 0xD2, 0x8F, 0xF6, 0xCE, 0x86, 0xC3, 0xBC, 0xF5, 0xC9, 0xB6, 0xD2, 0x58, 0x68, 0xE6, 0xDD,
+    0x6F, 0xAE, 0x2D, 0xE9, 0xA0, 0x3B, 0xCB, 0x25, 0x2F, 0x2D, 0xEF, 0x80, 0xC7, 0x26, 0xFE, 0xD0,
+    0xF6, 0xE5, 0x0B, 0x7A, 0x26, 0x18, 0x89, 0x5A, 0xFD, 0x05, 0x05, 0xFA, 0x6D, 0x6F, 0xD8, 0xEF,
+    0x93, 0x7D, 0x7D, 0xE4, 0x47, 0x5B, 0x16, 0x3A, 0xAD, 0xA5, 0xD6, 0xA4, 0x41, 0xBD, 0x55, 0x3D,
+    0x76, 0x69, 0xB7, 0xEB, 0xB4, 0x75, 0x5A, 0x32, 0xB5, 0x31, 0x8B, 0xF0, 0xE7, 0xFB, 0x3B, 0xD6,
+    0x2B, 0x56, 0xEA, 0xB4, 0xF1, 0x04, 0xF9, 0x42, 0xE9, 0xA9, 0x3C, 0xD5, 0x4C, 0xA5, 0xB9, 0xD0,
+    0x1C, 0xBD, 0x2B, 0x0C, 0x64, 0xEA, 0x33, 0xB9, 0x4C, 0x7D, 0x4C, 0xB3, 0xB8, 0xD8, 0x4F, 0x8D,
+    0x5A, 0xAB, 0xF6, 0x48, 0x2D, 0xDD, 0x9B, 0xFA, 0xCB, 0xF4, 0x4A, 0x23, 0x59, 0x6D, 0x54, 0x33,
+    0xB6, 0xE5, 0x09, 0x58, 0x41, 0x30, 0xBC, 0x8A, 0x15, 0xD5, 0xC2, 0x03, 0xA0, 0x36, 0x53, 0x9F,
+    0xA9, 0x47, 0x2D, 0x1F, 0xBF, 0xC3, 0x78, 0x7E, 0x6B, 0x5B, 0xFD, 0x8B, 0x3C, 0xFF, 0xA5, 0xDD,
+    0x2E, 0x8E, 0xF8, 0x49, 0x5A, 0x3B, 0x2D, 0x46, 0xEA, 0xEB, 0x79, 0x3F, 0x1D, 0xC7, 0x69, 0x30,
+    0x4D, 0x8A, 0xBF, 0xF4, 0x83, 0x63, 0xBD, 0x42, 0x3D, 0x15, 0x92, 0xCF, 0x56, 0x3A, 0x6D, 0x49,
+    0x95, 0xBA, 0x43, 0xA8, 0x55, 0x73, 0x54, 0xE6, 0x2F, 0x84, 0xC0, 0x87, 0x28, 0x55, 0xA3, 0x88,
+    0x3D, 0xAF, 0x28, 0x68, 0x1C, 0xB6, 0xAF, 0x17, 0x9A, 0xB9, 0x14, 0x66, 0xCD, 0xD4, 0x17, 0x8A,
+    0x1F, 0xDE, 0x53, 0x3F, 0xFE, 0xDD, 0xAF, 0xF2, 0xA0, 0x1F, 0x56, 0x14, 0xAC, 0xDA, 0x4E, 0x59,
+    0x37, 0x66, 0x83, 0x2B, 0x67, 0x8C, 0xCF, 0x56, 0x8A, 0x40, 0xD7, 0x22, 0xEA, 0x11, 0xFB, 0xB3,
+    0x7E, 0x58, 0xEA, 0x7A, 0x11, 0x1A, 0x09, 0x19, 0x29, 0xE6, 0x1F, 0xC5, 0x0C, 0xD9, 0x85, 0x7D,
+    0x84, 0x6E, 0x00, 0x18, 0x5C, 0xDA, 0xE4, 0x1A, 0xD3, 0x86, 0x2B, 0x6D, 0x0C, 0xFA, 0x16, 0x8A,
+    0x11, 0xDF, 0xE6, 0x65, 0xCF, 0x50, 0x84, 0x3C, 0xB0, 0xDE, 0x11, 0xEB, 0xDD, 0xED, 0xAE, 0xE5,
+    0x52, 0xC8, 0xA5, 0x57, 0x78, 0xF7, 0x1A, 0x49, 0xF6, 0x76, 0xFD, 0x97, 0x4B, 0xEC, 0x85, 0x14,
+    0x4B, 0xC8, 0xD4, 0x53, 0xC7, 0x28, 0x06, 0xEF, 0xED, 0x53, 0xBD, 0x9D, 0x99, 0x40, 0x13, 0xA5,
+    0x46, 0x6C, 0xE7, 0x8A, 0xC5, 0xF6, 0xB5, 0xB3, 0x04, 0x3E, 0x9D, 0xF5, 0x1C, 0x66, 0xEA, 0xEC,
+    0x6F, 0xC8, 0x14, 0xA8, 0xE4, 0xC9, 0x06, 0x07, 0x8A, 0xF7, 0x37, 0x3E, 0xF6, 0xF5, 0x9B, 0x3B,
+    0x9C, 0xA2, 0x6F, 0x66, 0x4B, 0x25, 0x3A, 0x23, 0x28, 0x66, 0x22, 0xC8, 0xD1, 0x04, 0x0A, 0x39,
+    0xCA, 0x57, 0xF6, 0x79, 0xDB, 0x8F, 0x4A, 0x4B, 0x29, 0x7D, 0x56, 0xEA, 0x2B, 0x2D, 0x74, 0x23,
+    0x45, 0x64, 0x41, 0x3B, 0x51, 0x04, 0x8A, 0x95, 0x54, 0x31, 0x89, 0x75, 0x31, 0xE0, 0x49, 0xE7,
+    0xA0, 0x08, 0x65, 0x38, 0xD7, 0x5C, 0xED, 0x4B, 0x31, 0x84, 0x38, 0xB4, 0x40, 0xA1, 0x94, 0xB9,
+    0x1D, 0x43, 0x8E, 0x5F, 0x8F, 0x06, 0x99, 0x09, 0x40, 0x11, 0x4C, 0xFC, 0x56, 0x1D, 0x00, 0xEB,
+    0xEA, 0x78, 0xC3, 0x3A, 0x92, 0xB1, 0x8E, 0xBF, 0x55, 0xAF, 0x60, 0x5D, 0x8C, 0xC3, 0x3C, 0x4D,
+    0xAD, 0x56, 0x5A, 0xA8, 0xF5, 0x59, 0x69, 0xC4, 0x44, 0x26, 0x3F, 0x3E, 0xB7, 0xC3, 0x93, 0x21,
+    0x91, 0xF2, 0x41, 0x9A, 0xE9, 0x42, 0xC2, 0x4B, 0xAC, 0x8E, 0x4F, 0xD6, 0x04, 0x5D, 0xBC, 0x7C,
+    0xFA, 0x17, 0x72, 0xFD, 0x74, 0x3E, 0xB4, 0xCC, 0x79, 0xB2, 0xE3, 0x9D, 0x1F, 0x1F, 0xED, 0x76,
+    0x58, 0x67, 0x15, 0x10, 0x27, 0x1A, 0x8B, 0x40, 0x33, 0x61, 0x7C, 0xB1, 0xA6, 0xAC, 0x70, 0x54,
+    0x86, 0x7D, 0xEE, 0xA8, 0x79, 0x6D, 0x06, 0xAC, 0x26, 0x40, 0x76, 0x84, 0x22, 0xD8, 0x11, 0x8C,
+    0xEF, 0x1C, 0x58, 0x17, 0x3B, 0x78, 0x70, 0x14, 0x01, 0x8D, 0x18, 0x8F, 0x46, 0xBA, 0xFF, 0x86,
+    0xA6, 0x46, 0x0B, 0xF2, 0xD2, 0x14, 0x7D, 0x49, 0xE7, 0x33, 0x67, 0x2C, 0x23, 0xAA, 0x2F, 0x3C,
+    0xDC, 0x85, 0xF4, 0x3F, 0xE3, 0xF6, 0x15, 0x7E, 0x14, 0x23, 0x64, 0x9F, 0x6C, 0x2F, 0xED, 0xAE,
+    0x36, 0x6A, 0x07, 0xCD, 0x56, 0x6D, 0xA3, 0xE9, 0x48, 0x6D, 0xB9, 0xA6, 0x10, 0x12, 0x5D, 0xDB,
+    0xF5, 0xD0, 0x3D, 0xBA, 0x01, 0xDD, 0x87, 0x16, 0xA0, 0x3B, 0x99, 0x80, 0x4E, 0x3D, 0xD0, 0x0D,
+    0x23, 0xD0, 0xFD, 0xE9, 0x0C, 0x74, 0x1F, 0x5E, 0x81, 0xEE, 0xB1, 0x68, 0x0C, 0x6A, 0x84, 0xAE,
+    0xB5, 0x33, 0x74, 0xAD, 0xD9, 0xC8, 0x74, 0xBD, 0x50, 0x5F, 0x2B, 0xA0, 0xB9, 0x51, 0x88, 0x54,
+    0x25, 0xBB, 0x7E, 0xEE, 0x4E, 0xD9, 0xDB, 0x6F, 0xC3, 0x04, 0x74, 0x01, 0x68, 0xB6, 0x83, 0xFE,
+    0xFF, 0xFE, 0xD7, 0x65, 0x8B, 0xEE, 0xA0, 0x94, 0x3C, 0x74, 0x3A, 0x03, 0xEA, 0xF9, 0x8D, 0x7C,
+    0xA2, 0xBF, 0xF8, 0xEE, 0xC3, 0xE7, 0x5E, 0xD5, 0xE4, 0xE6, 0x37, 0x9E, 0x2C, 0xDC, 0xED, 0x55,
+    0x6D, 0x93, 0xA9, 0x5A, 0x2D, 0x74, 0xA1, 0xD4, 0x5C, 0xAB, 0x7D, 0xEF, 0xF5, 0x73, 0xBC, 0x86,
+    0x4A, 0x58, 0xD1, 0x08, 0x86, 0xB7, 0xE0, 0x2F, 0xD3, 0x53, 0x8D, 0xB6, 0x4E, 0xDB, 0xAF, 0x2F,
+    0x25, 0xF6, 0x09, 0xD8, 0xF1, 0x16, 0xFD, 0x5D, 0xD9, 0x05, 0xCB, 0x61, 0xB0, 0x99, 0x11, 0xC8,
+    0xA6, 0xB7, 0x95, 0x4A, 0xE9, 0x59, 0x6E, 0x82, 0x5A, 0xBA, 0x1E, 0xDB, 0x63, 0x5B, 0x6E, 0x42,
+    0x48, 0x43, 0x3D, 0x09, 0xBE, 0xE8, 0x79, 0xC8, 0x76, 0xBB, 0xAB, 0xB6, 0xED, 0xA4, 0xC2, 0x97,
+    0xD2, 0x75, 0x4B, 0xA6, 0xB6, 0x18, 0x31, 0x9E, 0xC7, 0x41, 0x94, 0x3D, 0xC6, 0xF3, 0xBE, 0xB7,
+    0x88, 0xB2, 0x85, 0x3B, 0x84, 0x92, 0x92, 0xBB, 0x1E, 0x41, 0xED, 0xEE, 0x0A, 0x25, 0xCD, 0x1C,
+    0xD1, 0x56, 0x62, 0xB1, 0x22, 0x34, 0x22, 0x30, 0x64, 0x81, 0x21, 0x5B, 0x18, 0x32, 0xCF, 0x90,
+    0x4F, 0x0C, 0xB9, 0x63, 0xC8, 0xA2, 0xC6, 0xF6, 0x0B, 0xFE, 0x67, 0x7A, 0x8A, 0x46, 0x1B, 0x9D,
+    0xB6, 0x9F, 0x6F, 0xA8, 0x55, 0x3D, 0xA2, 0x10, 0xC6, 0xD3, 0xF9, 0xC3, 0x6E, 0x74, 0xA7, 0xDC,
+    0xFF, 0x56, 0x30, 0xD8, 0x11, 0x30, 0xF8, 0x18, 0x2A, 0x88, 0xE5, 0x47, 0xC3, 0xDE, 0x75, 0xF4,
+    0xD3, 0x77, 0xAE, 0x32, 0x60, 0x5D, 0xE5, 0xCB, 0x8D, 0x81, 0x6E, 0xAC, 0x7C, 0x11, 0x18, 0x38,
+    0x7A, 0x53, 0x5F, 0xAF, 0xCF, 0x5A, 0x9A, 0xE8, 0xA9, 0x98, 0x52, 0x8C, 0x3C, 0x12, 0xA7, 0x54,
+    0xAC, 0x73, 0x9B, 0xCF, 0x9B, 0xF5, 0xC6, 0xDB, 0x77, 0x02, 0xC6, 0x0F, 0x80, 0x79, 0x6D, 0x05,
+    0x8C, 0xC6, 0x7D, 0x8E, 0x4F, 0x36, 0x78, 0xA0, 0x96, 0x3F, 0x84, 0x40, 0x7E, 0xFF, 0xEE, 0x3B,
+    0x3C, 0x4C, 0x64, 0x99, 0x48, 0xA6, 0xC8, 0x33, 0xC6, 0x93, 0x05, 0x4E, 0x24, 0x85, 0x42, 0x92,
+    0x42, 0x19, 0xB9, 0x26, 0x6B, 0x69, 0x02, 0x46, 0x8E, 0x21, 0x40, 0xE3, 0xC8, 0xEF, 0xF1, 0xD6,
+    0xE6, 0xE1, 0x11, 0x9A, 0x97, 0xC7, 0x5C, 0x9E, 0x66, 0xA1, 0x58, 0x61, 0x70, 0x74, 0x81, 0x46,
+    0xAE, 0xF8, 0x61, 0xE0, 0x3D, 0x6F, 0xF0, 0x3D, 0xCA, 0xED, 0x6A, 0x25, 0x7D, 0xE6, 0x4E, 0x73,
+    0x2E, 0xB9, 0xA5, 0xF6, 0x81, 0xCE, 0x94, 0x6D, 0xD9, 0x85, 0xE4, 0x4C, 0x8D, 0xB3, 0x42, 0x3A,
+    0xF9, 0xFE, 0x7B, 0x96, 0x02, 0x10, 0x7D, 0x1F, 0x33, 0x74, 0x0A, 0x56, 0x8E, 0x52, 0x6A, 0xEB,
+    0x2D, 0x39, 0x1D, 0x66, 0xA8, 0xA6, 0x98, 0xC6, 0x77, 0x33, 0x06, 0x0A, 0xAB, 0x09, 0xF3, 0xF2,
+    0x02, 0x37, 0x61, 0xB5, 0x8E, 0x6A, 0xC2, 0x7C, 0x43, 0xF1, 0xB0, 0x5A, 0xA8, 0x26, 0xCC, 0x68,
+    0x47, 0x6E, 0xC2, 0x9A, 0x29, 0x1E, 0x56, 0x0B, 0x37, 0x61, 0xC5, 0x8E, 0xD5, 0x84, 0x19, 0x33,
+    0xC5, 0xC3, 0x2A, 0x54, 0x13, 0x66, 0xC4, 0x4E, 0x37, 0xA3, 0x99, 0x12, 0x0F, 0xCB, 0x10, 0x0F,
+    0xED, 0xF7, 0x26, 0xCC, 0x08, 0xDA, 0x60, 0x85, 0x52, 0xF1, 0xB0, 0xD9, 0x38, 0xD6, 0x75, 0xD0,
+    0x54, 0x48, 0x8E, 0x72, 0xA3, 0x53, 0x38, 0x68, 0x19, 0x5C, 0xBD, 0xBB, 0x44, 0x22, 0x29, 0x19,
+    0x09, 0x11, 0x62, 0x3A, 0x97, 0xD5, 0x11, 0x6D, 0x26, 0x6A, 0x22, 0x17, 0xE7, 0xA5, 0x8B, 0xAF,
+    0xBF, 0xCC, 0x86, 0x99, 0x52, 0x2F, 0x4A, 0x7D, 0xA1, 0x9F, 0x48, 0x33, 0x9F, 0xD4, 0x59, 0x29,
+    0xE8, 0x26, 0xAC, 0xA3, 0x9E, 0xA8, 0xE6, 0x64, 0x48, 0xEE, 0x8D, 0xE4, 0x96, 0x7A, 0xDC, 0x5B,
+    0x94, 0x3F, 0xC3, 0x89, 0x6E, 0xA6, 0xDA, 0x1E, 0x95, 0x5C, 0xA3, 0x65, 0x90, 0x37, 0xDA, 0x7E,
+    0x9B, 0x7B, 0x66, 0xEF, 0x2C, 0xEE, 0x22, 0xF7, 0x26, 0xBF, 0x63, 0x2A, 0x36, 0x48, 0xAA, 0x53,
+    0x72, 0xF8, 0x1E, 0x94, 0xC5, 0x7D, 0x95, 0x67, 0x2C, 0xBC, 0xE9, 0x4F, 0x56, 0x32, 0xFD, 0x40,
+    0x9A, 0xD0, 0x2A, 0xAD, 0x3C, 0xA8, 0xED, 0x51, 0x39, 0xEA, 0x05, 0xE3, 0x29, 0x17, 0xF2, 0x5F,
+    0xB8, 0x4B, 0xE2, 0x89, 0x7A, 0x25, 0xD7, 0xF5, 0x4E, 0xBE, 0xD2, 0xD6, 0x28, 0x14, 0x31, 0x98,
+    0x7E, 0x31, 0x35, 0xE3, 0xA2, 0xF5, 0x17, 0x43, 0x2C, 0xC9, 0xDD, 0xEE, 0xCF, 0x95, 0xE1, 0xA4,
+    0xF7, 0x7E, 0xF5, 0x8E, 0x50, 0x47, 0x3C, 0x97, 0x87, 0xA8, 0x30, 0x9A, 0x58, 0x88, 0x4B, 0xF7,
+    0xB2, 0x8F, 0xB6, 0x63, 0x48, 0x55, 0x05, 0xED, 0x05, 0x17, 0xFE, 0x6F, 0xFD, 0xE0, 0xCD, 0x7A,
+    0xFE, 0x1C, 0x58, 0xE8, 0x00, 0xDB, 0x76, 0x40, 0x39, 0xDB, 0x16, 0x18, 0x9A, 0xFE, 0xBC, 0x24,
+    0x3F, 0x6E, 0xCD, 0xBD, 0x87, 0x6D, 0xF6, 0xB5, 0x63, 0x8D, 0xD4, 0xAA, 0xB5, 0x61, 0xF4, 0xB2,
+    0x34, 0x66, 0xCF, 0xEA, 0x95, 0x3A, 0x90, 0xA9, 0x47, 0xD0, 0xF5, 0x34, 0x3F, 0x3F, 0x43, 0x5C,
+    0x3C, 0x91, 0x69, 0xA4, 0x39, 0x2B, 0x25, 0x06, 0xFD, 0x77, 0xC9, 0xD9, 0xF3, 0xB9, 0x79, 0x9F,
+    0x76, 0x19, 0x8B, 0x69, 0xCE, 0x79, 0x3D, 0x89, 0x96, 0x73, 0x2E, 0x3F, 0x78, 0x7D, 0x12, 0xBB,
+    0x27, 0x9B, 0x01, 0xAA, 0x91, 0xCB, 0xED, 0xC9, 0x19, 0x85, 0xCF, 0xF4, 0x6D, 0x69, 0xCA, 0x3D,
+    0x11, 0x99, 0x08, 0x2E, 0x6B, 0x8D, 0x3E, 0xDE, 0x66, 0x89, 0xB3, 0x59, 0xB5, 0x44, 0x0E, 0xCC,
+    0xD7, 0xC4, 0x83, 0x43, 0x1B, 0x47, 0x53, 0x33, 0xC6, 0xCC, 0x80, 0x2A, 0x7A, 0xBB, 0xC8, 0xD7,
+    0x14, 0x7E, 0xFB, 0x99, 0x2F, 0xA8, 0xCF, 0x28, 0x74, 0x1D, 0xE2, 0x50, 0x80, 0x38, 0x18, 0xDA,
+    0x9F, 0x91, 0x07, 0xB7, 0xC4, 0x83, 0xF3, 0x9D, 0x3C, 0x18, 0xC1, 0x2C, 0x56, 0x33, 0x27, 0x1E,
+    0x74, 0x91, 0x07, 0xB7, 0xC4, 0x83, 0x73, 0xE2, 0x41, 0x77, 0x27, 0x0F, 0xCE, 0x89, 0x07, 0xDD,
+    0x9D, 0x3C, 0x38, 0x27, 0x1E, 0x7C, 0x29, 0xF1, 0xE0, 0xCD, 0x7B, 0xF3, 0xE0, 0x18, 0x79, 0x70,
+    0x4D, 0x3C, 0x98, 0xC6, 0x57, 0xEA, 0x95, 0x98, 0x94, 0xF1, 0x70, 0x1C, 0xBD, 0xD5, 0x14, 0x23,
+    0x96, 0x09, 0xA7, 0xA0, 0xD2, 0x1D, 0xE2, 0xF5, 0x42, 0xB6, 0xD9, 0xF1, 0x74, 0x59, 0x6D, 0xAD,
+    0x5A, 0x5B, 0x14, 0x17, 0x71, 0x52, 0x2A, 0x37, 0x8A, 0x10, 0xB9, 0x2E, 0x32, 0x4F, 0xD7, 0x52,
+    0xFF, 0xEC, 0xBB, 0x99, 0x46, 0xEA, 0x6F, 0x48, 0x2E, 0x5B, 0x1B, 0x85, 0xD8, 0x39, 0x51, 0xEE,
+    0x37, 0x17, 0xD2, 0x89, 0xFB, 0xBD, 0xE5, 0x5D, 0x6E, 0x40, 0x29, 0xB7, 0xCF, 0x7E, 0xA8, 0xA6,
+    0x43, 0x51, 0x56, 0xCC, 0x3C, 0xA4, 0x8E, 0xD5, 0xCE, 0x97, 0x76, 0xBB, 0x37, 0x8A, 0xC6, 0xC6,
+    0xA0, 0x67, 0x16, 0x43, 0xBA, 0x8D, 0xA4, 0x91, 0x42, 0xD7, 0x4B, 0x8D, 0xB1, 0x9E, 0xDE, 0xE5,
+    0x82, 0x4C, 0xAE, 0xF6, 0x90, 0xAB, 0x55, 0x0F, 0x85, 0x8A, 0x00, 0x54, 0xA1, 0xF1, 0x80, 0x99,
+    0xD5, 0x03, 0xF6, 0x3B, 0x2B, 0x80, 0x3E, 0x97, 0x10, 0x04, 0x1C, 0x50, 0x85, 0x04, 0x2E, 0x10,
+    0x0D, 0xD1, 0xCF, 0xCD, 0x40, 0xB1, 0xDA, 0x09, 0x30, 0xF3, 0xE0, 0x80, 0xEE, 0x79, 0x01, 0xF9,
+    0x56, 0x6C, 0x80, 0xF1, 0xD5, 0x0A, 0xA8, 0x4F, 0x65, 0xF4, 0xF5, 0x0A, 0xC3, 0x48, 0xA3, 0xCF,
+    0x9F, 0xAC, 0xA4, 0x1C, 0xF3, 0x98, 0x9C, 0x0D, 0x7C, 0xE2, 0x3C, 0x65, 0xAD, 0x96, 0x46, 0xAA,
+    0x54, 0xA6, 0x17, 0xDE, 0xA8, 0xF0, 0x4C, 0x31, 0x7F, 0x70, 0x8C, 0xC1, 0x53, 0x33, 0x67, 0x1A,
+    0x8D, 0xC7, 0x84, 0x72, 0x06, 0x7D, 0x30, 0xEC, 0x8B, 0x6E, 0x83, 0x3D, 0xAF, 0x3E, 0xBD, 0x50,
+    0x92, 0xEA, 0x40, 0xC6, 0x83, 0x7D, 0x72, 0x85, 0xC6, 0x0D, 0x0E, 0x33, 0x99, 0x80, 0xF1, 0x99,
+    0x5E, 0x39, 0x99, 0x69, 0xA4, 0x99, 0x4C, 0x9A, 0x0E, 0xA5, 0xB2, 0xF7, 0x93, 0x45, 0x87, 0xC0,
+    0xC3, 0x40, 0x1D, 0x81, 0xD7, 0xEC, 0xED, 0xA1, 0x25, 0xA6, 0xFD, 0x1C, 0xD2, 0x18, 0xEF, 0x95,
+    0xBF, 0xF1, 0x9B, 0x0E, 0xF1, 0x00, 0xBF, 0x03, 0x8E, 0x6A, 0xC4, 0x93, 0x6F, 0x59, 0x00, 0xAB,
+    0x75, 0x5F, 0x1C, 0x79, 0x79, 0xF9, 0xD5, 0x57, 0x09, 0xF3, 0x0E, 0xDE, 0x11, 0x63, 0xDF, 0x37,
+    0x80, 0xDA, 0x9B, 0x19, 0x32, 0xF5, 0x72, 0xD0, 0x2C, 0x26, 0x40, 0x2E, 0xD4, 0x43, 0x1D, 0x63,
+    0xFB, 0x1F, 0xE0, 0x8F, 0x5E, 0xFF, 0xC8, 0xCF, 0x6E, 0xB1, 0x2F, 0x35, 0x41, 0x15, 0x33, 0xBA,
+    0xF5, 0x4A, 0xA6, 0x19, 0x13, 0xA0, 0xF3, 0x0C, 0x0E, 0x3A, 0x5F, 0x06, 0x60, 0x18, 0x23, 0x2D,
+    0x9D, 0x80, 0x5C, 0x55, 0xB8, 0x30, 0x0E, 0x52, 0x0F, 0xA4, 0xCE, 0x89, 0xA3, 0x47, 0x71, 0xF4,
+    0xC4, 0x53, 0x69, 0xF4, 0xA4, 0x2E, 0x5D, 0x1B, 0x0F, 0xD4, 0xBE, 0x73, 0xC0, 0xD0, 0xAB, 0x87,
+    0x22, 0xC4, 0x7C, 0xFD, 0xA9, 0x88, 0x49, 0xDB, 0xA5, 0x5A, 0x9A, 0x99, 0x4A, 0xFF, 0xF0, 0xB1,
+    0x08, 0x77, 0x20, 0xCF, 0xBE, 0x94, 0x80, 0x07, 0x63, 0x7D, 0xF1, 0xFB, 0xB2, 0x16, 0x9A, 0x76,
+    0x01, 0x33, 0x0D, 0x50, 0xCD, 0xD6, 0x51, 0x2C, 0x8D, 0x23, 0x0F, 0x66, 0x84, 0x50, 0x4D, 0xF0,
+    0x78, 0x3E, 0xC1, 0x7D, 0xDC, 0x7F, 0x47, 0xAB, 0x2F, 0x6B, 0x02, 0x9B, 0x12, 0xB4, 0x17, 0xEC,
+    0x58, 0xAA, 0xB5, 0x0E, 0xEB, 0xEB, 0x91, 0x62, 0xAD, 0x3C, 0x0C, 0x4F, 0x2E, 0x50, 0xFB, 0xBB,
+    0xFB, 0x68, 0x01, 0xF3, 0x03, 0xED, 0xA3, 0xF7, 0x9B, 0x99, 0x61, 0xC8, 0x05, 0xB6, 0xB7, 0x1E,
+    0xEB, 0x4A, 0xFD, 0xC7, 0x61, 0x64, 0x48, 0xD9, 0x25, 0x3D, 0xDC, 0x51, 0x08, 0x9D, 0xBB, 0x0B,
+    0x78, 0x91, 0x43, 0x04, 0x92, 0x89, 0xC9, 0x09, 0xDB, 0x85, 0xF0, 0xFE, 0xEB, 0x6D, 0x9F, 0xEC,
+    0xA3, 0xC3, 0xD3, 0x31, 0x95, 0x66, 0x81, 0x2E, 0x76, 0x52, 0xED, 0x73, 0x8D, 0x44, 0x1B, 0x3A,
+    0x45, 0x37, 0x11, 0xA8, 0xC5, 0x78, 0xAA, 0x39, 0x86, 0x52, 0xDA, 0x84, 0xFE, 0x80, 0x60, 0x23,
+    0x41, 0xD8, 0x21, 0x9A, 0x19, 0xCC, 0x3F, 0x0F, 0xB1, 0xC8, 0x37, 0x1A, 0x9A, 0x71, 0xC0, 0x15,
+    0xD1, 0xC1, 0xDA, 0xC4, 0x31, 0xA3, 0x9E, 0xE4, 0x9C, 0x44, 0xD4, 0xD1, 0x43, 0x3D, 0xA4, 0x1F,
+    0x6D, 0x31, 0x1E, 0xB3, 0x72, 0xAC, 0xA7, 0xE9, 0x96, 0x42, 0x9A, 0x32, 0xCD, 0x9D, 0x36, 0x8A,
+    0xA8, 0xF0, 0x1C, 0x9C, 0xAC, 0x63, 0xF2, 0x2A, 0x76, 0x2E, 0xE6, 0xB6, 0x34, 0x53, 0x2A, 0xFB,
+    0x1A, 0xA3, 0xA3, 0xF1, 0x4E, 0x2B, 0x86, 0xE1, 0x43, 0x7A, 0x41, 0x3F, 0xD2, 0x0F, 0x15, 0x3E,
+    0xB9, 0x6A, 0xA3, 0x5B, 0x72, 0xEA, 0x25, 0x15, 0x77, 0xDC, 0x51, 0xED, 0x31, 0xFF, 0x4B, 0x1F,
+    0x74, 0xB7, 0xDB, 0x5C, 0x0A, 0x24, 0x74, 0x9D, 0xDF, 0x5C, 0xEA, 0x45, 0xA8, 0xB5, 0x83, 0xDD,
+    0x91, 0xD4, 0xCF, 0xED, 0x82, 0x0D, 0x92, 0x5C, 0xD8, 0xD1, 0x76, 0xAC, 0xFA, 0x73, 0xB3, 0xA3,
+    0xF9, 0x86, 0xFC, 0x10, 0x14, 0x06, 0x3D, 0xA8, 0x4E, 0x7D, 0xBD, 0xD1, 0x97, 0xDB, 0xBE, 0x40,
+    0xEE, 0x4D, 0x51, 0xB1, 0x1E, 0xA1, 0xDE, 0xAE, 0x33, 0x48, 0xD8, 0x8B, 0xF9, 0xF3, 0x59, 0xAC,
+    0xBD, 0x8C, 0x1A, 0x62, 0x1E, 0xD2, 0x13, 0xD9, 0xA4, 0x19, 0xBE, 0x37, 0x5D, 0x04, 0xD4, 0x64,
+    0x81, 0xA4, 0x1B, 0x60, 0xE6, 0x66, 0x04, 0xEC, 0xF7, 0xA2, 0xA7, 0x68, 0xBD, 0x00, 0x74, 0x55,
+    0x4D, 0xBF, 0x1D, 0x3C, 0x9F, 0xB5, 0xFC, 0x59, 0x36, 0x73, 0x13, 0xCB, 0x40, 0xE5, 0x3B, 0x90,
+    0x6D, 0x31, 0xEA, 0xA3, 0x1D, 0x50, 0x8F, 0x77, 0xAB, 0xFF, 0xF9, 0x5A, 0xAB, 0xD2, 0xD7, 0xF5,
+    0x92, 0x7E, 0xF0, 0xEC, 0x4F, 0xB4, 0x64, 0x9A, 0xDE, 0x41, 0x97, 0x46, 0xC8, 0x4F, 0xEF, 0x9C,
+    0xFD, 0x07, 0x99, 0xBE, 0x4B, 0x25, 0xF9, 0xE2, 0x82, 0xE2, 0x50, 0xF4, 0xA9, 0x6B, 0xE4, 0x60,
+    0x08, 0x71, 0xAA, 0xA9, 0xCE, 0xEE, 0x9E, 0x60, 0xB2, 0xD3, 0xEB, 0x17, 0xA0, 0x8B, 0xE7, 0x77,
+    0xAF, 0xD5, 0x8C, 0x19, 0x05, 0xAB, 0x99, 0x30, 0xCF, 0x6F, 0x70, 0xA3, 0xF6, 0x1C, 0x11, 0x95,
+    0x96, 0x36, 0x65, 0xE1, 0x6A, 0x83, 0x3C, 0x16, 0xAA, 0xAC, 0x09, 0xE2, 0xA3, 0x94, 0x83, 0x6A,
+    0x3B, 0x82, 0xE6, 0x47, 0x13, 0xC8, 0x82, 0xF9, 0x91, 0x27, 0xDB, 0x6C, 0x4F, 0xF3, 0xCD, 0x95,
+    0x2A, 0xD8, 0xB3, 0x7F, 0xAB, 0xC7, 0x24, 0x8D, 0x95, 0x34, 0x91, 0x1D, 0x70, 0x05, 0xFE, 0x2C,
+    0x46, 0x26, 0xEC, 0x48, 0x16, 0xFB, 0x15, 0x45, 0xA3, 0xE4, 0xBD, 0x77, 0xA1, 0xCF, 0x6D, 0xAD,
+    0x91, 0xFA, 0xED, 0x63, 0xAA, 0xC6, 0x7C, 0xB1, 0x14, 0x53, 0xA0, 0x2A, 0x96, 0xE8, 0x20, 0xAB,
+    0xD5, 0xD3, 0x68, 0xA2, 0xD6, 0x4C, 0xA9, 0x99, 0x6C, 0xF0, 0xD7, 0xB1, 0x2F, 0xF5, 0x74, 0x27,
+    0x10, 0x6E, 0x52, 0xFD, 0x70, 0x63, 0xF8, 0xB0, 0xB4, 0x54, 0x52, 0x9B, 0x7D, 0xA2, 0x4D, 0x68,
+    0x19, 0xF5, 0x92, 0x8A, 0x99, 0xB7, 0xA1, 0xC7, 0x7E, 0x66, 0xC3, 0x4C, 0xA5, 0x67, 0xE1, 0x77,
+    0x2E, 0xFC, 0xEE, 0x83, 0x5F, 0x86, 0x46, 0xEA, 0x8D, 0xB4, 0x16, 0x7A, 0xB4, 0x1B, 0x87, 0x96,
+    0xD5, 0x78, 0xCC, 0xB8, 0x41, 0xA8, 0x27, 0xAA, 0xE7, 0x05, 0x57, 0x4D, 0x48, 0xA1, 0xD3, 0x22,
+    0xD6, 0x31, 0x4F, 0xD0, 0x68, 0x82, 0x4E, 0x23, 0x74, 0x6A, 0x93, 0xAF, 0x6B, 0x98, 0xAE, 0x92,
+    0xEB, 0x4A, 0xA4, 0x0E, 0xB2, 0x50, 0x7F, 0x67, 0x21, 0x5F, 0xED, 0xC8, 0x70, 0x4B, 0x9F, 0xEF,
+    0x66, 0x2B, 0xAD, 0x51, 0xFB, 0x8D, 0x52, 0xAE, 0x85, 0xA1, 0xA5, 0x50, 0x8B, 0x15, 0xD9, 0x2A,
+    0xCC, 0x37, 0x56, 0xB6, 0x2C, 0x94, 0x53, 0xEE, 0xDF, 0x49, 0xDE, 0x9E, 0xEB, 0x8F, 0xD7, 0x0B,
+    0x69, 0xB2, 0x7F, 0xAD, 0x17, 0x66, 0x6E, 0x1A, 0xC7, 0x62, 0xC9, 0xDD, 0x16, 0xED, 0xF2, 0x52,
+    0x13, 0x95, 0x16, 0x4A, 0xAD, 0x64, 0x5A, 0xE1, 0x24, 0xBC, 0x1F, 0xF3, 0xC3, 0x89, 0xFA, 0xEF,
+    0x1D, 0xB6, 0xE9, 0xF3, 0x30, 0xF4, 0xCD, 0xDF, 0x4A, 0x5B, 0x2E, 0x8D, 0x7C, 0xF4, 0xFA, 0xAF,
+    0x05, 0x63, 0x34, 0x13, 0x71, 0x68, 0xBD, 0x3B, 0x24, 0xD3, 0xA1, 0x58, 0x92, 0x15, 0x6A, 0xC7,
+    0x73, 0x57, 0x58, 0xA6, 0x33, 0xAC, 0xB6, 0xE2, 0xEC, 0x24, 0x34, 0x6D, 0x35, 0x05, 0xCC, 0x93,
+    0x9E, 0x3F, 0x34, 0x53, 0x04, 0x4E, 0xEE, 0x36, 0x18, 0xD4, 0xD3, 0x69, 0xA4, 0xD6, 0xC8, 0xB1,
+    0x5E, 0x68, 0xD1, 0x43, 0x64, 0xEB, 0x0D, 0x8A, 0x1F, 0x2E, 0x34, 0x2F, 0x2D, 0xF9, 0xDA, 0x48,
+    0x53, 0xA3, 0x35, 0xA2, 0x29, 0x25, 0x77, 0xED, 0xE0, 0xE1, 0x24, 0x46, 0x43, 0xB3, 0x18, 0x18,
+    0xCD, 0x36, 0xA8, 0xF6, 0x0F, 0x77, 0x85, 0x7C, 0x2E, 0x16, 0x44, 0xED, 0xAD, 0xA3, 0x7B, 0xD9,
+    0x47, 0x3F, 0x48, 0xA9, 0x0B, 0x76, 0xF1, 0xAF, 0x7E, 0x84, 0xBD, 0x83, 0xBC, 0x0D, 0xD8, 0x7C,
+    0x29, 0xE6, 0x62, 0x69, 0xFA, 0xF2, 0xC7, 0x81, 0x4A, 0x8E, 0x6A, 0x3D, 0xD4, 0xC2, 0xBF, 0x3D,
+    0xEC, 0x73, 0x69, 0xB7, 0xDB, 0xED, 0xAE, 0x75, 0x92, 0xB4, 0xA6, 0xED, 0xE9, 0xB3, 0xB7, 0x4F,
+    0xD7, 0x27, 0xA8, 0x3D, 0xEB, 0x73, 0xD4, 0x9E, 0xF0, 0x38, 0xB5, 0xE7, 0xC6, 0xE3, 0xD4, 0x9E,
+    0xAF, 0x3D, 0x40, 0xED, 0xB9, 0x7F, 0xEF, 0xF0, 0x7C, 0x3B, 0xB6, 0xDD, 0xED, 0xEB, 0x7B, 0x54,
+    0xD0, 0x46, 0xBA, 0xBB, 0x60, 0x20, 0x0A, 0xD6, 0x08, 0x2E, 0xF9, 0xEE, 0x70, 0xEE, 0xF4, 0x88,
+    0xA6, 0x6A, 0x75, 0x9E, 0x99, 0x1B, 0x61, 0x6A, 0x7E, 0x2F, 0xE1, 0xC1, 0x9E, 0x07, 0xCB, 0xCB,
+    0xB3, 0xDD, 0x87, 0x24, 0x59, 0x29, 0x7C, 0x44, 0xBB, 0xAB, 0xC5, 0xF2, 0xBA, 0x50, 0xFA, 0xBF,
+    0x70, 0x18, 0xC0, 0x6C, 0xCF, 0xB8, 0x46, 0xA2, 0xD1, 0xC4, 0xF1, 0x53, 0xEC, 0x73, 0x32, 0x8C,
+    0xE0, 0x78, 0x8D, 0x6E, 0xC8, 0xDA, 0xC1, 0x1A, 0x45, 0xC3, 0xD7, 0x0E, 0x0F, 0xFE, 0x10, 0xF9,
+    0xBC, 0x2F, 0x61, 0xAD, 0xBD, 0x75, 0xFB, 0x0A, 0xD6, 0xE4, 0x94, 0x8B, 0x05, 0xAC, 0x77, 0x7B,
+    0xE4, 0x7E, 0x53, 0x7A, 0xA7, 0x89, 0xBA, 0x63, 0x3E, 0x27, 0xDC, 0x57, 0xB2, 0xEB, 0x33, 0xCD,
+    0x93, 0x8E, 0xED, 0x77, 0x0E, 0x34, 0xEC, 0x3E, 0x7F, 0xAD, 0x93, 0x7E, 0x24, 0xE9, 0xBF, 0x9E,
+    0xFC, 0x78, 0xF7, 0x26, 0x09, 0xBE, 0x3F, 0x74, 0xA0, 0x57, 0x6F, 0xE4, 0x92, 0xCF, 0xB5, 0xC1,
+    0xC7, 0xDB, 0xB7, 0x8C, 0x32, 0x47, 0x7F, 0xFA, 0xE3, 0xAB, 0xFB, 0x16, 0xC5, 0xED, 0x5B, 0x45,
+    0x99, 0x9F, 0x83, 0xF7, 0x2A, 0x29, 0x34, 0x92, 0xCF, 0xDE, 0x24, 0xEF, 0xE5, 0x5F, 0xC8, 0x62,
+    0x99, 0x70, 0xE6, 0x81, 0x42, 0x3F, 0x8E, 0xD0, 0xFF, 0x51, 0x61, 0xBA, 0x52, 0xA9, 0x05, 0xCA,
+    0x37, 0xCE, 0x8D, 0x3F, 0xDA, 0xED, 0x60, 0xB7, 0x4B, 0x19, 0x9F, 0x8B, 0x34, 0x51, 0xC7, 0x64,
+    0x2D, 0x4E, 0xA6, 0x3D, 0xF4, 0x87, 0xF1, 0xC0, 0x1A, 0x07, 0x98, 0x6D, 0x51, 0x64, 0xD3, 0xB7,
+    0xE4, 0x64, 0xB6, 0xC6, 0x04, 0xF6, 0x2E, 0x7A, 0x18, 0x6B, 0x47, 0x33, 0x41, 0x15, 0xB1, 0x04,
+    0x8B, 0x05, 0xD4, 0x53, 0x04, 0x68, 0x56, 0xCA, 0x0D, 0x0A, 0xDD, 0x7E, 0x56, 0x29, 0x55, 0xFB,
+    0x02, 0x00, 0x50, 0xF6, 0xD1, 0x8B, 0x71, 0x00, 0xB5, 0x5F, 0x01, 0x34, 0x5F, 0x01, 0xAC, 0x86,
+    0x1E, 0xEA, 0xCF, 0x6A, 0x84, 0xC2, 0x75, 0x13, 0x70, 0x7F, 0x76, 0xF5, 0x9E, 0xA4, 0x78, 0x70,
+    0xE2, 0x77, 0xBF, 0x9A, 0x69, 0xA1, 0xDB, 0x18, 0x36, 0x6A, 0xB5, 0x47, 0x43, 0xCF, 0xC9, 0x2F,
+    0xE0, 0xD3, 0x5D, 0x88, 0x30, 0x7E, 0x74, 0x2D, 0xD6, 0x61, 0x47, 0xCC, 0x4C, 0x37, 0x93, 0xEB,
+    0x1F, 0xA5, 0xA7, 0xB0, 0x92, 0x55, 0x9B, 0x6B, 0xAD, 0xE4, 0x38, 0x8E, 0x90, 0xE8, 0x75, 0xD4,
+    0xDD, 0x4D, 0x64, 0xC3, 0x94, 0x53, 0xFB, 0x2F, 0x01, 0x1C, 0xED, 0x76, 0x57, 0x39, 0xDA, 0x5D,
+    0x4B, 0xA9, 0xD7, 0x9F, 0xD3, 0x46, 0x16, 0xB3, 0xDA, 0x38, 0xDE, 0xDE, 0x96, 0x1E, 0xBB, 0xEB,
+    0x64, 0x3D, 0xEE, 0x91, 0x61, 0xAA, 0x19, 0xB2, 0x10, 0x0B, 0xED, 0x86, 0x64, 0x44, 0xF6, 0x98,
+    0x05, 0xAC, 0x23, 0xD7, 0x48, 0x37, 0x81, 0xD5, 0xA9, 0x7C, 0x2C, 0x9A, 0x98, 0xCE, 0x9D, 0x85,
+    0x5C, 0xFA, 0xE2, 0x85, 0x30, 0x4E, 0x44, 0xD2, 0x8E, 0x3D, 0xDC, 0xDD, 0x95, 0x8B, 0x70, 0x97,
+    0x52, 0xFE, 0x37, 0x64, 0x9F, 0x6C, 0x6B, 0xF5, 0xA5, 0xA6, 0x4A, 0x53, 0xA6, 0x99, 0x8F, 0x2D,
+    0x1C, 0xFF, 0x22, 0x41, 0x9A, 0x9E, 0x7A, 0xC4, 0x4C, 0xA9, 0xDC, 0xBD, 0x58, 0x41, 0x6D, 0xA9,
+    0x96, 0x66, 0x3B, 0xD1, 0x59, 0x5B, 0x48, 0x3F, 0xD2, 0x4C, 0xA3, 0x71, 0x08, 0xF0, 0xF1, 0xE8,
+    0x4A, 0x7B, 0x47, 0x4C, 0x5E, 0x37, 0x3D, 0x5F, 0x89, 0x79, 0x11, 0x37, 0x22, 0x2A, 0x52, 0xAC,
+    0x85, 0x4C, 0xA9, 0x0B, 0x43, 0xB4, 0x0A, 0xEF, 0xC1, 0x7B, 0xBF, 0x85, 0x43, 0x30, 0x77, 0xBC,
+    0x1F, 0xB2, 0xC0, 0x43, 0x80, 0x1D, 0x9B, 0x16, 0xAA, 0xC8, 0xD8, 0x83, 0x1C, 0x70, 0xBC, 0xB5,
+    0xBF, 0xBE, 0x43, 0x70, 0x9F, 0x73, 0xDC, 0xA4, 0xD4, 0xCB, 0x68, 0x30, 0xD6, 0x1F, 0x9C, 0x63,
+    0xF5, 0xE8, 0x95, 0x98, 0x9E, 0x65, 0x7A, 0x80, 0x1B, 0xD1, 0x2D, 0x52, 0x7F, 0x2F, 0x46, 0xE5,
+    0x12, 0x3A, 0xD1, 0xE5, 0x2F, 0xFC, 0x96, 0x8E, 0xCF, 0x2C, 0x06, 0x22, 0x13, 0x63, 0x4F, 0x40,
+    0x35, 0x06, 0xA0, 0x98, 0xEA, 0x96, 0x04, 0xBD, 0x89, 0xCD, 0x66, 0xF6, 0x08, 0x7E, 0x59, 0x64,
+    0x8E, 0x7A, 0xFD, 0xB5, 0x1C, 0xB8, 0xE4, 0xB1, 0x45, 0xC5, 0x94, 0x7B, 0xA0, 0x08, 0xF9, 0x06,
+    0x94, 0x5B, 0x2E, 0xA0, 0xDC, 0x0A, 0xB5, 0x50, 0xAE, 0xC5, 0x06, 0x14, 0x4B, 0xAC, 0xB3, 0x9A,
+    0xF8, 0xAB, 0x37, 0xA8, 0xD8, 0xB9, 0x1A, 0xB3, 0x17, 0x37, 0xAB, 0x85, 0x52, 0x1B, 0xDD, 0x08,
+    0x97, 0x97, 0xB7, 0x73, 0xE0, 0xEE, 0x4F, 0x76, 0xED, 0x61, 0xE0, 0xA6, 0x9E, 0x5E, 0x20, 0x0F,
+    0x31, 0x51, 0x38, 0xE2, 0xF1, 0x22, 0xA8, 0xD4, 0x66, 0xEA, 0x41, 0xDB, 0x33, 0x72, 0x11, 0xBD,
+    0xAB, 0xBF, 0x30, 0xC3, 0x7E, 0xE4, 0xA9, 0x94, 0xE6, 0xF6, 0x3E, 0xA0, 0x98, 0x1A, 0x20, 0x0F,
+    0x66, 0x02, 0xB6, 0x6A, 0x06, 0x86, 0x58, 0x4F, 0xFD, 0xC1, 0x00, 0x34, 0x6D, 0x00, 0x4C, 0xFF,
+    0x38, 0x40, 0x7B, 0xDF, 0xDD, 0x81, 0x8F, 0xAF, 0x71, 0xF4, 0x5F, 0xE8, 0x36, 0x6A, 0xF5, 0x8D,
+    0xFA, 0x52, 0x63, 0x76, 0x32, 0x71, 0xF9, 0x17, 0x08, 0x8B, 0x6E, 0x7B, 0x78, 0x92, 0x7A, 0xC4,
+    0x78, 0xCC, 0x4C, 0xB1, 0xC6, 0x60, 0xCD, 0xD9, 0xA0, 0x7F, 0xC0, 0x48, 0x5F, 0xD7, 0xC8, 0xA0,
+    0x0F, 0xCA, 0x93, 0x3D, 0xCD, 0x25, 0x52, 0xF1, 0x8D, 0x91, 0xFA, 0x4C, 0xFA, 0x8E, 0xD4, 0xD3,
+    0x69, 0x2A, 0x57, 0xC8, 0x86, 0xFE, 0xED, 0x1C, 0x6E, 0xE9, 0x64, 0x39, 0x1F, 0x86, 0xDB, 0x7E,
+    0x6A, 0xED, 0xA1, 0x71, 0xD4, 0x1E, 0xCC, 0x44, 0xB1, 0xC5, 0x78, 0xDA, 0x30, 0x53, 0x2F, 0x60,
+    0xF4, 0xEA, 0x10, 0x62, 0xF1, 0x4C, 0x80, 0x03, 0xD2, 0xDF, 0xD1, 0xC9, 0x78, 0x31, 0x4A, 0x9F,
+    0x3C, 0x6F, 0xFB, 0x34, 0x87, 0x14, 0x02, 0x4E, 0xF3, 0x53, 0x99, 0x34, 0xF1, 0x66, 0xFA, 0x95,
+    0x8E, 0xAE, 0x2E, 0xC0, 0xC7, 0xD3, 0x23, 0xC6, 0x05, 0x17, 0x8A, 0x8B, 0xB8, 0x3C, 0x5D, 0x9A,
+    0x40, 0xAE, 0x9F, 0xCF, 0x96, 0x31, 0x3A, 0x93, 0x9D, 0x17, 0xFA, 0x75, 0x07, 0x07, 0xA3, 0x39,
+    0x64, 0x45, 0x14, 0xB7, 0x0F, 0x55, 0x3B, 0x5B, 0xB9, 0x0F, 0xE7, 0xD8, 0x7E, 0x5F, 0xE4, 0x5E,
+    0x4C, 0x7C, 0xE0, 0x0D, 0x75, 0x84, 0x54, 0x1F, 0x73, 0x69, 0x77, 0xCD, 0x4A, 0x2D, 0xD7, 0x28,
+    0xA4, 0x6F, 0x4A, 0x13, 0xC6, 0xD1, 0x68, 0xC9, 0x34, 0x92, 0xAF, 0x50, 0xCD, 0x54, 0xE1, 0x30,
+    0x58, 0x3A, 0x17, 0x3D, 0x97, 0x13, 0xC5, 0x0A, 0x5D, 0x0C, 0x63, 0x37, 0x53, 0x84, 0x39, 0x72,
+    0xB1, 0x60, 0x29, 0x44, 0x05, 0xDD, 0x53, 0x3F, 0xEB, 0xB0, 0x2D, 0xA8, 0xCD, 0x7F, 0xBC, 0x52,
+    0xF9, 0x88, 0xCD, 0x6B, 0x7C, 0x74, 0xB5, 0xBA, 0xC2, 0x0F, 0xD1, 0x85, 0x1E, 0x78, 0xAE, 0x9C,
+    0xB3, 0x00, 0xD4, 0xA3, 0x71, 0xB6, 0x6F, 0x7A, 0x60, 0x23, 0xE4, 0xA1, 0x98, 0x63, 0xB6, 0x74,
+    0x5F, 0x8F, 0x16, 0x60, 0x28, 0x3C, 0x5B, 0xE9, 0x81, 0x62, 0xB6, 0x54, 0xFE, 0x39, 0x00, 0xFB,
+    0xD9, 0x89, 0xCE, 0x38, 0x20, 0x0F, 0x37, 0x28, 0x96, 0x08, 0xE1, 0xF7, 0xB2, 0xA3, 0x79, 0xB9,
+    0x07, 0xD0, 0x92, 0xC0, 0xE6, 0xA8, 0xD4, 0xEE, 0x33, 0xA8, 0x3B, 0x9F, 0x22, 0xB5, 0x14, 0xDB,
+    0x21, 0x69, 0xAB, 0x19, 0xF7, 0xB9, 0x4B, 0x77, 0xBC, 0xF6, 0x81, 0x97, 0x04, 0x23, 0x98, 0x26,
+    0xFA, 0x73, 0xB9, 0x86, 0x4D, 0xE9, 0x06, 0x66, 0xDA, 0x52, 0xB6, 0x41, 0xEA, 0x5D, 0x1B, 0x97,
+    0xD2, 0xE0, 0x62, 0x8A, 0xFB, 0x9D, 0x7D, 0xC0, 0x11, 0xD9, 0xEE, 0x5A, 0x27, 0xCF, 0x42, 0xA7,
+    0x17, 0xB4, 0x52, 0xBB, 0x5C, 0x73, 0x19, 0xD2, 0x12, 0x55, 0xD6, 0x61, 0x27, 0x9A, 0x3E, 0xDB,
+    0x28, 0x95, 0x06, 0xD7, 0xE0, 0xE9, 0x60, 0xC0, 0xA8, 0xAF, 0x26, 0xCA, 0x39, 0xBB, 0x1D, 0x08,
+    0x60, 0x5D, 0x53, 0xBB, 0xDA, 0x91, 0x87, 0xC2, 0x6F, 0xF9, 0x0C, 0x66, 0xFC, 0x74, 0xE5, 0x2D,
+    0xB0, 0x55, 0xAE, 0x2B, 0x26, 0xA8, 0xFC, 0x52, 0x2C, 0x9F, 0x06, 0xEC, 0x9F, 0xB6, 0xCD, 0xD7,
+    0x1D, 0x14, 0xB7, 0x3D, 0xEB, 0x12, 0xC3, 0x37, 0x11, 0x69, 0x5C, 0x63, 0x34, 0xB8, 0xAB, 0x90,
+    0x82, 0x39, 0x5D, 0x9F, 0x70, 0x56, 0x0F, 0x0F, 0x3D, 0x5F, 0x60, 0xC7, 0xC8, 0x8A, 0x89, 0x0D,
+    0x23, 0x0B, 0x46, 0xF6, 0x2B, 0xA6, 0xBB, 0x17, 0xE0, 0xC8, 0x76, 0xBB, 0xF6, 0x68, 0x77, 0x6D,
+    0xD0, 0x86, 0xF4, 0x4F, 0x52, 0x5F, 0x29, 0x1C, 0xAB, 0xA5, 0x08, 0x98, 0x05, 0x3A, 0xE8, 0x5C,
+    0x9A, 0x03, 0xB2, 0x98, 0xD4, 0x6F, 0x5B, 0x18, 0xFA, 0x2A, 0x22, 0x17, 0xAD, 0x40, 0x3D, 0x35,
+    0x3D, 0xA0, 0xB8, 0x2C, 0x49, 0xB8, 0x09, 0xD0, 0xBC, 0xEC, 0xCE, 0xCB, 0x28, 0xCB, 0x54, 0x78,
+    0x37, 0xFE, 0x4C, 0x25, 0x91, 0x00, 0xD9, 0x70, 0xD6, 0x1E, 0x82, 0x73, 0x36, 0x8A, 0xF7, 0xEC,
+    0x7C, 0x3E, 0x89, 0x37, 0xB6, 0x1B, 0x90, 0xAF, 0x2B, 0x50, 0xBF, 0x10, 0x80, 0x35, 0x5F, 0xC0,
+    0x8C, 0x85, 0x87, 0xDF, 0x23, 0xBF, 0x4B, 0x7D, 0xBD, 0x96, 0xED, 0x76, 0x9D, 0xBC, 0xD1, 0x32,
+    0xA8, 0xBD, 0xAC, 0xBE, 0x73, 0x14, 0x33, 0x43, 0x4B, 0xED, 0xB2, 0x0D, 0x36, 0x8A, 0x40, 0xE9,
+    0x29, 0x67, 0x9A, 0x1E, 0xE3, 0x09, 0xD0, 0xB8, 0xD2, 0x83, 0xED, 0x6D, 0x0B, 0x43, 0x16, 0x20,
+    0x0B, 0xD5, 0x08, 0xC5, 0x62, 0x81, 0xF2, 0x07, 0x0B, 0x60, 0x5E, 0x76, 0x87, 0x6C, 0x08, 0x7B,
+    0x5E, 0x11, 0x1C, 0x73, 0x13, 0xA2, 0x43, 0x2C, 0xD6, 0xEE, 0x86, 0x43, 0xE1, 0x71, 0x29, 0xE0,
+    0x23, 0x29, 0xF8, 0xD8, 0xDE, 0x05, 0x3E, 0x92, 0x7D, 0x21, 0xFB, 0x02, 0x30, 0xB8, 0xCE, 0x81,
+    0x09, 0x31, 0xF0, 0xEF, 0x3A, 0x07, 0x85, 0xCF, 0xEF, 0x0D, 0xAC, 0xFA, 0x9B, 0x06, 0x78, 0x7F,
+    0x48, 0x1E, 0x3B, 0xA4, 0x31, 0x35, 0xCB, 0x3E, 0x70, 0xD9, 0x2D, 0xFB, 0x4C, 0xC5, 0x77, 0xDE,
+    0x6D, 0x40, 0xEE, 0x76, 0x6D, 0x27, 0x69, 0x6E, 0x24, 0x6D, 0xD5, 0x76, 0x7A, 0xAA, 0x0F, 0x2E,
+    0x30, 0xF4, 0x01, 0x3A, 0x67, 0xC1, 0x8E, 0x55, 0x1F, 0xBF, 0x5A, 0xFB, 0x7D, 0xAA, 0x91, 0x99,
+    0xF7, 0x25, 0xF8, 0x65, 0xD8, 0x3F, 0x7F, 0xBE, 0x1D, 0xAA, 0x93, 0xE2, 0x10, 0xEB, 0xF7, 0x95,
+    0x3D, 0xD6, 0x51, 0x38, 0x3B, 0x91, 0xCD, 0x8D, 0x87, 0xE7, 0x6A, 0x0F, 0xD6, 0xCC, 0xD0, 0xBC,
+    0x24, 0x49, 0x3F, 0x94, 0xA4, 0xD9, 0xEA, 0xEE, 0x54, 0x8A, 0x9F, 0x25, 0x1C, 0x79, 0x69, 0xB7,
+    0xDB, 0x55, 0x29, 0xC5, 0x78, 0x5E, 0xDB, 0x6A, 0xB9, 0x42, 0x19, 0x4C, 0x5B, 0x84, 0xC2, 0x15,
+    0x6B, 0x7C, 0xB4, 0x6C, 0x4B, 0x4C, 0xAE, 0xF4, 0x80, 0x43, 0x0F, 0x9D, 0x63, 0xB2, 0x8E, 0xC7,
+    0xAD, 0xC3, 0x36, 0x23, 0xF5, 0xF7, 0x6F, 0x9F, 0x0E, 0xDF, 0x93, 0xF4, 0xE3, 0x0B, 0x4F, 0xF3,
+    0xC0, 0x61, 0xA8, 0xD5, 0xE1, 0x30, 0x44, 0xD4, 0xDF, 0x1B, 0x50, 0x21, 0xDB, 0xED, 0x76, 0xBB,
+    0x88, 0x5A, 0x30, 0x48, 0x5A, 0x9A, 0xDB, 0xA7, 0xCF, 0xAC, 0xD5, 0x44, 0xBE, 0x15, 0x9E, 0x4C,
+    0x04, 0x50, 0xFB, 0x50, 0xFA, 0x7E, 0xE7, 0xF6, 0xBD, 0x69, 0xC7, 0x3D, 0xEC, 0x61, 0x7D, 0x4E,
+    0xDE, 0xE5, 0x0E, 0xF2, 0x16, 0xDB, 0x01, 0xC8, 0x4F, 0x60, 0x50, 0x4F, 0x39, 0x0E, 0x8E, 0x7C,
+    0xEE, 0x1C, 0x04, 0x3B, 0xC2, 0xD0, 0x48, 0xD2, 0x4B, 0x92, 0x34, 0x46, 0x84, 0xD5, 0xF4, 0x50,
+    0x5F, 0x48, 0x1D, 0x33, 0xB8, 0xF8, 0x2B, 0xE5, 0x72, 0x4F, 0x57, 0xD0, 0xEE, 0x83, 0x92, 0xBC,
+    0xA4, 0xD5, 0x5E, 0xCD, 0x37, 0xD3, 0x67, 0x2A, 0x46, 0x84, 0x3F, 0x27, 0x57, 0x1F, 0x9F, 0xD7,
+    0x5E, 0xEC, 0x12, 0xCF, 0x07, 0x8C, 0xA7, 0x36, 0x1E, 0xF3, 0xD2, 0x4C, 0xF9, 0xDA, 0x76, 0xFA,
+    0xEC, 0xED, 0xBD, 0x53, 0xEE, 0x40, 0x16, 0x78, 0x9C, 0xD2, 0x53, 0xBB, 0x72, 0xA6, 0x58, 0xAB,
+    0x39, 0x05, 0x17, 0x23, 0x34, 0xA2, 0x5D, 0xCE, 0xA3, 0xA3, 0xBF, 0xC6, 0x7C, 0x99, 0xB5, 0xFC,
+    0x79, 0x0A, 0x19, 0x76, 0x54, 0xDE, 0xFE, 0x94, 0x90, 0xE1, 0x6E, 0xB7, 0xBB, 0xD6, 0xA4, 0x95,
+    0x36, 0xBF, 0xF9, 0x63, 0x9A, 0x69, 0xA1, 0xF6, 0x8F, 0x60, 0xBC, 0xC1, 0xC4, 0x89, 0x22, 0x2E,
+    0x2C, 0xB5, 0xAF, 0x2F, 0xDB, 0xF3, 0xA9, 0x28, 0x7A, 0x91, 0x79, 0x41, 0x18, 0x5A, 0xBA, 0xE1,
+    0xD5, 0x53, 0x3D, 0x2B, 0xE9, 0x5B, 0xE7, 0x3D, 0x7A, 0xFC, 0x54, 0x5C, 0x61, 0xB0, 0x92, 0x5C,
+    0xB6, 0x7D, 0x28, 0x60, 0xFB, 0xAA, 0xAF, 0x3C, 0xF7, 0xB3, 0xA5, 0xA1, 0x9F, 0xAD, 0x29, 0xEC,
+    0xFC, 0x96, 0xEE, 0x74, 0x67, 0x2D, 0x9D, 0x84, 0x89, 0xE6, 0x61, 0xD1, 0x16, 0x3E, 0x13, 0xD6,
+    0x17, 0x1B, 0x76, 0xCC, 0x03, 0x26, 0xE5, 0x48, 0x67, 0xA1, 0x08, 0xD5, 0x52, 0x7B, 0xEB, 0x6E,
+    0x46, 0xF1, 0x98, 0x45, 0x8F, 0x82, 0x28, 0xE4, 0xF3, 0x75, 0xCB, 0x42, 0xED, 0xD6, 0x7C, 0x79,
+    0x0E, 0xFB, 0xCE, 0x24, 0x4E, 0x86, 0xF6, 0xAF, 0x9A, 0xAD, 0xBA, 0xA5, 0xDB, 0xC1, 0x1A, 0xFD,
+    0x87, 0xD1, 0xFA, 0xFB, 0x22, 0x22, 0x7E, 0x1E, 0x6B, 0x28, 0x6E, 0x45, 0x4F, 0x58, 0xD9, 0xF2,
+    0x7F, 0x78, 0x1E, 0x57, 0xFB, 0x44, 0x2D, 0x65, 0x52, 0x5B, 0x9D, 0xF1, 0xAE, 0xC7, 0xD6, 0xEE,
+    0x9F, 0xD6, 0xFD, 0x04, 0x99, 0x87, 0x6E, 0xB4, 0xDF, 0x5A, 0xCB, 0x35, 0xC1, 0x9D, 0x1F, 0x9F,
+    0x31, 0xA8, 0xBA, 0xBD, 0xD9, 0x2C, 0xDC, 0x28, 0xFC, 0xD5, 0xBA, 0xCF, 0x02, 0x43, 0x5F, 0x78,
+    0xAA, 0x9E, 0xFB, 0x80, 0xAB, 0x0C, 0xBE, 0xD1, 0x8B, 0xD3, 0x73, 0x37, 0x8A, 0xEF, 0xB9, 0x2B,
+    0x37, 0x8A, 0x7F, 0xF2, 0xCF, 0x59, 0xF5, 0x51, 0x63, 0x6A, 0xDF, 0x41, 0x28, 0xC6, 0xEE, 0xB1,
+    0x60, 0x9F, 0xDF, 0xEA, 0x51, 0x66, 0xEA, 0xCA, 0xC9, 0x7E, 0xD0, 0x9B, 0xF6, 0x7E, 0x5A, 0xDE,
+    0xC3, 0xF1, 0x63, 0x53, 0x16, 0x6C, 0x6B, 0xB3, 0xD5, 0x8C, 0xD5, 0x0F, 0x17, 0x1A, 0x81, 0xC6,
+    0xFD, 0x52, 0xA3, 0xEF, 0xA0, 0xAD, 0x09, 0xC6, 0x77, 0x1F, 0x5C, 0x8D, 0xB7, 0xCF, 0xAF, 0xC5,
+    0xDC, 0xB8, 0x2E, 0x9F, 0x4B, 0x77, 0x85, 0xB4, 0x34, 0x44, 0xA5, 0xB6, 0x92, 0x32, 0x69, 0xB1,
+    0xD8, 0x5B, 0x8E, 0xF0, 0x3E, 0x72, 0xF2, 0x31, 0x34, 0x4F, 0xFA, 0x9B, 0x66, 0x92, 0x99, 0x87,
+    0x17, 0x16, 0xA8, 0xFA, 0xC1, 0xE9, 0xD1, 0xAD, 0x58, 0xCC, 0xD8, 0x15, 0x73, 0xDD, 0x2F, 0x40,
+    0xD5, 0xEB, 0xB3, 0xA1, 0x19, 0x87, 0x2C, 0x14, 0x73, 0xE9, 0xAB, 0xB1, 0x72, 0xF0, 0x80, 0xB9,
+    0xE5, 0x43, 0x57, 0x7F, 0xF8, 0x85, 0xE9, 0x2B, 0xF7, 0x51, 0x7F, 0x66, 0x33, 0xDF, 0x5E, 0x9B,
+    0x17, 0xFD, 0x8D, 0x77, 0x02, 0x0F, 0xEE, 0x29, 0x74, 0xC4, 0x51, 0x11, 0x8A, 0xD0, 0x8D, 0xDD,
+    0xB7, 0x42, 0xB9, 0x36, 0x51, 0x01, 0x05, 0xBA, 0xB1, 0xD6, 0x63, 0x53, 0x78, 0xA4, 0xBC, 0x35,
+    0x3E, 0x6E, 0xCD, 0xF3, 0xF2, 0xC7, 0x0B, 0xD0, 0xF4, 0x7A, 0x74, 0x2D, 0x66, 0xE3, 0x6E, 0x96,
+    0xFE, 0xA1, 0x98, 0xA0, 0x15, 0x8E, 0x57, 0xD6, 0x2C, 0x94, 0x73, 0x33, 0x3E, 0x04, 0x0F, 0x54,
+    0xA3, 0x6D, 0x9F, 0x60, 0x45, 0x0C, 0xAF, 0x5A, 0x55, 0xCB, 0x13, 0xC3, 0x30, 0x0C, 0xC3, 0xF0,
+    0xC4, 0xBE, 0x04, 0x79, 0x2C, 0xE4, 0xCD, 0x77, 0x42, 0xE3, 0xB6, 0x0E, 0xFB, 0x17, 0xBC, 0x13,
+    0xA8, 0x5A, 0xFE, 0xEF, 0x99, 0xC7, 0xF5, 0xF9, 0x9B, 0x71, 0x49, 0x40, 0x8E, 0xBF, 0x94, 0x2C,
+    0x83, 0xBF, 0xAA, 0xD7, 0xEA, 0x96, 0xCE, 0x82, 0xAD, 0x75, 0x6B, 0xB4, 0xFE, 0x3E, 0xBE, 0x44,
+    0x23, 0xDD, 0x8A, 0xFD, 0xDF, 0x1F, 0x20, 0xEB, 0xEE, 0x41, 0x33, 0xF8, 0xE3, 0xB8, 0x10, 0x9E,
+    0xA0, 0x1E, 0xF7, 0x30, 0xD4, 0xC6, 0xC1, 0x0C, 0x19, 0x5C, 0xE5, 0xAA, 0x75, 0xF6, 0xA5, 0xB5,
+    0xDC, 0x06, 0xD7, 0x7D, 0x67, 0x89, 0x52, 0xF4, 0x81, 0x7C, 0x36, 0xA3, 0x6D, 0xF5, 0xBF, 0xE9,
+    0x6F, 0xCF, 0x45, 0xA7, 0x3F, 0x24, 0x6B, 0x24, 0xF4, 0xD9, 0x98, 0x10, 0xB5, 0x71, 0xA8, 0x0B,
+    0x39, 0xFE, 0xF5, 0xC7, 0x06, 0x8B, 0x81, 0x11, 0xEA, 0xB8, 0x06, 0x57, 0x29, 0x49, 0x72, 0xD9,
+    0x76, 0xAA, 0xD3, 0x67, 0x3D, 0x4F, 0xD0, 0x8C, 0x04, 0x9A, 0xB6, 0x9A, 0xB9, 0x42, 0xE9, 0xF2,
+    0x15, 0xD3, 0x67, 0x9E, 0xA1, 0x2D, 0x1C, 0x0F, 0xEC, 0x13, 0x56, 0x63, 0x14, 0x6D, 0x8F, 0x2D,
+    0xC3, 0xF0, 0xBF, 0x5C, 0x8B, 0xF9, 0x83, 0x3A, 0x23, 0xE6, 0x9E, 0x4D, 0x90, 0xEB, 0x54, 0x02,
+    0x86, 0x36, 0xD3, 0x04, 0xCD, 0x18, 0x17, 0x23, 0x9A, 0x41, 0x3D, 0xF9, 0x1A, 0x05, 0xCD, 0x10,
+    0x51, 0xC1, 0x9B, 0x54, 0x9B, 0x1A, 0x95, 0xA7, 0x3C, 0xD6, 0x7F, 0xA6, 0x93, 0xD9, 0x70, 0x06,
+    0x8A, 0x35, 0x38, 0xB6, 0xCF, 0xA5, 0x65, 0x3F, 0x93, 0xA6, 0xA4, 0xE6, 0x24, 0xAC, 0x92, 0xF2,
+    0x93, 0x54, 0xA5, 0x08, 0x6C, 0xF4, 0xAE, 0x61, 0x8B, 0x93, 0x44, 0xFC, 0xF0, 0xC1, 0x0B, 0xB0,
+    0x4D, 0x7F, 0xB8, 0xCF, 0xBE, 0x89, 0x8B, 0xC4, 0xAC, 0x90, 0x69, 0xDA, 0x4B, 0xD1, 0xF6, 0xEE,
+    0x4E, 0xBC, 0xD6, 0x49, 0xDA, 0x3A, 0x49, 0x5B, 0xA6, 0xD3, 0x67, 0x56, 0x94, 0xCA, 0xB8, 0x56,
+    0x04, 0x01, 0xC1, 0x0D, 0x04, 0x8F, 0xC7, 0xFA, 0xA7, 0x3B, 0x70, 0xC5, 0x7F, 0xDE, 0xCD, 0xB1,
+    0xBE, 0x7B, 0x9E, 0xD9, 0x06, 0x70, 0xFC, 0xFF, 0x5E, 0x87, 0x52, 0x5A, 0x41, 0xD2, 0x8A, 0xD9,
+    0x1E, 0xED, 0x66, 0xD4, 0x53, 0x8F, 0xD5, 0x02, 0xB6, 0xED, 0x7A, 0x58, 0x8B, 0x00, 0xB9, 0x37,
+    0x1E, 0x4A, 0x17, 0x17, 0x53, 0xBC, 0x58, 0xC8, 0xFA, 0xFF, 0x9D, 0x3E, 0x07, 0x8A, 0xA0, 0x8F,
+    0x92, 0xBB, 0x47, 0x7D, 0x6B, 0x54, 0xA0, 0x97, 0x43, 0xD8, 0x6A, 0xB2, 0x1E, 0xAA, 0x31, 0x2E,
+    0x18, 0x2C, 0x4F, 0xB5, 0xA2, 0xED, 0x23, 0xF2, 0x0C, 0x52, 0x04, 0x0F, 0xBA, 0x4E, 0x04, 0x74,
+    0xFC, 0x95, 0x86, 0xC7, 0xDF, 0x72, 0x24, 0x81, 0x77, 0xB5, 0xEF, 0x7A, 0x2C, 0x14, 0x5B, 0x37,
+    0xDA, 0x9F, 0xAC, 0xC5, 0xD6, 0xF4, 0x75, 0x7F, 0x87, 0x2E, 0xF4, 0xA8, 0xB4, 0xD4, 0xDA, 0x28,
+    0xD7, 0xB7, 0x02, 0x69, 0x22, 0xF1, 0xB9, 0x14, 0x6A, 0xA9, 0x67, 0xB7, 0xBB, 0x56, 0x49, 0xBE,
+    0xD1, 0xD6, 0x1E, 0x45, 0xD3, 0xF0, 0x67, 0x2C, 0xFD, 0x7E, 0x33, 0x87, 0xD9, 0x76, 0x18, 0x71,
+    0xC5, 0x0A, 0xDD, 0x44, 0x2D, 0x32, 0x4D, 0x64, 0xFF, 0x63, 0xAF, 0xEF, 0xED, 0xAE, 0xC6, 0x60,
+    0x53, 0x54, 0x2C, 0x8C, 0xF6, 0x8B, 0xE6, 0x9D, 0x7C, 0xF7, 0xD9, 0x35, 0x65, 0xAC, 0xA7, 0xD1,
+    0x57, 0xF7, 0x3F, 0x7D, 0xA7, 0x69, 0xEF, 0xDE, 0xB1, 0x94, 0xDB, 0x17, 0xDB, 0xB8, 0x93, 0x4C,
+    0x4E, 0xCA, 0xB8, 0xDE, 0x65, 0x47, 0x19, 0x2E, 0x0D, 0x1E, 0x6E, 0x52, 0xC6, 0x75, 0xCC, 0x9E,
+    0xA3, 0x8C, 0x05, 0x07, 0x61, 0x5F, 0x6A, 0x13, 0x28, 0x17, 0xB2, 0x8D, 0x7C, 0x49, 0x3B, 0x85,
+    0x4F, 0x2E, 0xFD, 0xCA, 0xC7, 0x8B, 0xDF, 0x5F, 0x8F, 0x94, 0x0B, 0x65, 0xB0, 0x43, 0x4F, 0xB9,
+    0xD0, 0xCC, 0x9D, 0xA0, 0xDE, 0x9E, 0xD1, 0x38, 0xAC, 0x44, 0x64, 0xDF, 0xCE, 0x27, 0x90, 0xAE,
+    0x83, 0xBA, 0x7E, 0x69, 0x77, 0xED, 0x7C, 0x75, 0xB0, 0x26, 0xAD, 0xD1, 0xD5, 0x57, 0x52, 0x1F,
+    0x5D, 0x24, 0x97, 0xF7, 0x2B, 0x85, 0x45, 0x88, 0x02, 0xEB, 0x92, 0x4F, 0xC4, 0xF8, 0xB4, 0x18,
+    0xCE, 0x1E, 0x0B, 0xE0, 0xCD, 0x5E, 0x24, 0x49, 0x69, 0xB4, 0x47, 0x54, 0x51, 0x13, 0x77, 0xE4,
+    0xD2, 0x45, 0x4D, 0xD8, 0xDF, 0x49, 0xFB, 0x3B, 0x35, 0x63, 0xBA, 0x53, 0xB9, 0xA4, 0x8B, 0xE2,
+    0xF2, 0x63, 0xD1, 0x1B, 0x9A, 0x2E, 0xB2, 0xFB, 0x8B, 0x6A, 0xBF, 0xBF, 0xD3, 0x7C, 0xAC, 0xA7,
+    0x39, 0xD6, 0xA9, 0xE6, 0x04, 0x14, 0xA3, 0xB9, 0x8C, 0x03, 0x49, 0xD7, 0xEF, 0xCE, 0x2B, 0x48,
+    0x0B, 0x35, 0xFA, 0xBD, 0x94, 0xA0, 0x7E, 0xF5, 0xD9, 0xDB, 0xA7, 0x62, 0x2F, 0x26, 0xF2, 0x99,
+    0xA1, 0x2D, 0xA6, 0xBD, 0x9C, 0xA0, 0xA6, 0x9A, 0x79, 0x98, 0x73, 0x41, 0x91, 0x6A, 0x93, 0x0E,
+    0x92, 0xA2, 0x9A, 0x8F, 0xA2, 0xA8, 0xF8, 0x7E, 0x74, 0x2B, 0x0F, 0xD1, 0xCB, 0x9C, 0xEB, 0xF6,
+    0xB3, 0x6A, 0x63, 0x45, 0x89, 0xA2, 0xB9, 0x5E, 0x84, 0xF8, 0xED, 0x6A, 0x8E, 0xDF, 0x6E, 0xC6,
+    0xC8, 0xAD, 0x5D, 0x0F, 0xCD, 0x18, 0x89, 0x3A, 0xB4, 0x94, 0x4B, 0x3C, 0x5D, 0x4F, 0x87, 0xD3,
+    0xD9, 0x70, 0x46, 0xA9, 0xEB, 0x74, 0xDA, 0x32, 0x69, 0xCA, 0xA5, 0xB9, 0xBA, 0x23, 0x4C, 0x58,
+    0xB6, 0xE7, 0x59, 0x21, 0x59, 0x5A, 0xDD, 0x67, 0x39, 0x4F, 0xE1, 0x4D, 0x0E, 0x81, 0x3F, 0xBB,
+    0x97, 0xB9, 0x9F, 0x7D, 0xA1, 0x94, 0x26, 0xE4, 0x3A, 0x2D, 0x34, 0x81, 0x7A, 0xA6, 0x94, 0x43,
+    0xB0, 0xFD, 0x3B, 0x8C, 0xA7, 0xE9, 0x41, 0x14, 0x1E, 0x8C, 0xE7, 0x39, 0xD2, 0x52, 0x38, 0x18,
+    0x5F, 0x78, 0xF6, 0x4B, 0xD5, 0x1B, 0x6F, 0x1C, 0x09, 0x69, 0x2C, 0xE2, 0x27, 0x81, 0x3E, 0xB1,
+    0xC6, 0x33, 0xF1, 0xB2, 0xEE, 0x8E, 0xD4, 0xC5, 0x78, 0xB7, 0x21, 0xDE, 0x3A, 0xCA, 0xC6, 0x26,
+    0xE5, 0x4B, 0x3A, 0x8C, 0xA7, 0x14, 0xC7, 0x7A, 0x9A, 0x26, 0x14, 0xD2, 0xC4, 0xE0, 0x3B, 0xAD,
+    0x7B, 0x6C, 0xAC, 0xFC, 0x02, 0x8E, 0xEE, 0x74, 0xC0, 0xFE, 0x88, 0x32, 0xB1, 0x4F, 0xC9, 0x42,
+    0xE9, 0xE3, 0xD4, 0x43, 0xCD, 0xDE, 0x84, 0xB8, 0xB7, 0xBF, 0x63, 0x0F, 0x59, 0xA5, 0x3B, 0x21,
+    0xAB, 0xF2, 0x3D, 0x56, 0xD4, 0x78, 0x58, 0xAD, 0x41, 0xD1, 0x8B, 0x66, 0x7C, 0xA4, 0xAB, 0x62,
+    0x0D, 0xAC, 0xF1, 0x14, 0x5B, 0x3C, 0x54, 0xBC, 0xD8, 0x3E, 0xBF, 0x82, 0x30, 0xBE, 0x1E, 0x31,
+    0xBE, 0x08, 0xD9, 0x0A, 0x62, 0x88, 0xB7, 0x8A, 0x2B, 0xDD, 0xA9, 0xF2, 0xD4, 0x23, 0xE6, 0x87,
+    0x71, 0xED, 0x33, 0x0D, 0xF1, 0x87, 0xE4, 0xE2, 0xA1, 0x8F, 0x87, 0x31, 0x3D, 0xF5, 0xE2, 0x63,
+    0x64, 0xEB, 0x1E, 0xB2, 0xAA, 0x38, 0xC0, 0x6C, 0x25, 0xC8, 0x2A, 0xFE, 0x9C, 0x77, 0x46, 0xA3,
+    0xB2, 0x76, 0x90, 0x07, 0x1A, 0x07, 0xD9, 0x16, 0x4D, 0xEE, 0x41, 0x09, 0x39, 0x7E, 0xB9, 0xAB,
+    0xD4, 0xE6, 0x22, 0x3A, 0x41, 0xF2, 0xE1, 0x59, 0x85, 0x4E, 0x81, 0x46, 0xCB, 0xB1, 0x62, 0x7E,
+    0x9F, 0xDA, 0x18, 0x51, 0x74, 0x71, 0x69, 0xF3, 0xA8, 0xF1, 0xD7, 0x9E, 0xD2, 0x83, 0x99, 0x31,
+    0x13, 0x94, 0xF1, 0x67, 0x8B, 0x40, 0xD3, 0x43, 0xB6, 0x45, 0xB8, 0x3B, 0x45, 0xCC, 0x86, 0xAE,
+    0x8F, 0x45, 0x35, 0x2F, 0x44, 0x19, 0xFC, 0x9D, 0xE8, 0xB2, 0x7D, 0x2D, 0x3A, 0x69, 0x53, 0xB7,
+    0x26, 0x76, 0x4E, 0x7D, 0xF7, 0xDC, 0x85, 0x2A, 0xA2, 0xFB, 0xA2, 0xB3, 0xEA, 0xA1, 0x18, 0x0D,
+    0x48, 0xDE, 0xFF, 0x88, 0xB7, 0xBA, 0x0F, 0x59, 0xC6, 0x94, 0xE4, 0x38, 0xC9, 0xED, 0x3A, 0xAD,
+    0xD8, 0xE8, 0xBE, 0xB2, 0x51, 0x78, 0x26, 0x01, 0x9A, 0x24, 0xE2, 0xAF, 0xFC, 0xED, 0x58, 0x92,
+    0xF4, 0x4A, 0x9C, 0x1A, 0xB7, 0x4E, 0x09, 0xD5, 0x6C, 0xDF, 0xF6, 0x3B, 0xDF, 0x6E, 0xC6, 0xB7,
+    0xB4, 0x46, 0xF4, 0xA7, 0xE3, 0xDB, 0xC3, 0x77, 0xBC, 0xDD, 0x99, 0xC3, 0x7F, 0x73, 0xEF, 0x14,
+    0x18, 0xC6, 0xE4, 0x3D, 0x89, 0x78, 0x26, 0x13, 0xBC, 0xBE, 0xC6, 0xE2, 0x6D, 0x06, 0xC4, 0x3E,
+    0x22, 0xD5, 0xBC, 0xC7, 0xFE, 0xCA, 0x9F, 0xBD, 0x4B, 0xD5, 0xB7, 0x09, 0x18, 0x52, 0x13, 0x97,
+    0xB4, 0xDB, 0xDD, 0xCB, 0x58, 0x28, 0x35, 0x62, 0x7E, 0x22, 0xB9, 0x88, 0x22, 0x69, 0xD4, 0x47,
+    0x0D, 0x51, 0xBD, 0xF1, 0x94, 0x21, 0x42, 0x92, 0x19, 0x4F, 0xB1, 0x22, 0xA2, 0x08, 0xC9, 0x23,
+    0x1C, 0xC1, 0x68, 0x3C, 0xD9, 0xDD, 0xBB, 0x8D, 0xAB, 0xCF, 0xC8, 0x43, 0xA3, 0x05, 0x7B, 0x4B,
+    0xEA, 0xA3, 0xED, 0x6A, 0xDB, 0x73, 0xD4, 0x87, 0x83, 0x41, 0x74, 0xBE, 0xA8, 0xE5, 0x51, 0xC4,
+    0x39, 0x99, 0xB9, 0xE8, 0x47, 0xCA, 0x5C, 0x42, 0x72, 0x4C, 0x5E, 0xB5, 0xE8, 0x1E, 0x1A, 0xA3,
+    0x19, 0x76, 0x37, 0xCC, 0xE1, 0xA5, 0xDD, 0x6E, 0xD7, 0x24, 0x8F, 0xC6, 0x5C, 0x9E, 0xED, 0xD6,
+    0x6C, 0xA5, 0xA1, 0x6B, 0x2B, 0x57, 0x8F, 0x99, 0x2F, 0x67, 0x3E, 0xF0, 0x26, 0x93, 0xA9, 0x87,
+    0xEF, 0x52, 0x48, 0xFE, 0x42, 0x15, 0xD6, 0x89, 0x5A, 0xAC, 0x44, 0x7D, 0x76, 0x12, 0x8A, 0x05,
+    0xEB, 0x36, 0x08, 0xB5, 0xA3, 0x7A, 0x72, 0x49, 0x2D, 0x2B, 0xE2, 0xAA, 0x62, 0x72, 0xA5, 0x14,
+    0xE8, 0x4E, 0x4F, 0xDB, 0xD7, 0xA3, 0x1C, 0xA3, 0x91, 0xFB, 0x2A, 0xDD, 0x1E, 0x5C, 0x23, 0x2D,
+    0x9C, 0x68, 0xDB, 0xA3, 0x1C, 0xBF, 0x1D, 0x29, 0xAC, 0x6F, 0x13, 0x5A, 0x57, 0x5C, 0xEB, 0xD3,
+    0x8E, 0xF6, 0x9F, 0xD6, 0x62, 0xB3, 0xAE, 0xB9, 0xAB, 0x13, 0x8E, 0xFE, 0x0B, 0x95, 0x46, 0xB4,
+    0x92, 0x75, 0x23, 0xD9, 0x0A, 0xF5, 0x9B, 0x7E, 0xEB, 0xCE, 0x18, 0x14, 0x4C, 0xB2, 0xCB, 0xA3,
+    0xFE, 0x16, 0xFF, 0xCA, 0xF9, 0xAE, 0x58, 0x70, 0xA6, 0x90, 0x2B, 0x70, 0x39, 0x50, 0xBC, 0xF9,
+    0xBF, 0xE5, 0xFC, 0xAF, 0x9C, 0x31, 0x9E, 0x66, 0x42, 0xAE, 0x12, 0x36, 0x50, 0x5F, 0x8F, 0xCE,
+    0xC1, 0xAB, 0x49, 0x61, 0x3D, 0xD7, 0x32, 0xA8, 0xA3, 0xCF, 0x27, 0x9B, 0x23, 0x1F, 0xD7, 0xB1,
+    0x70, 0x31, 0xF3, 0xF1, 0xB0, 0x89, 0x87, 0xB9, 0x2F, 0xA4, 0x09, 0x6C, 0x0C, 0x7F, 0x14, 0x53,
+    0xB1, 0x7D, 0x4C, 0xF0, 0x69, 0x6C, 0x5F, 0x2E, 0x54, 0xAE, 0x58, 0x68, 0x1C, 0x01, 0xDB, 0x67,
+    0x01, 0xD3, 0x17, 0x0B, 0xB5, 0xCB, 0x67, 0x6C, 0x9F, 0x87, 0x47, 0x06, 0x8A, 0x85, 0xEE, 0x43,
+    0x1A, 0xE9, 0xFE, 0xAE, 0xF3, 0xDD, 0xC2, 0x20, 0x85, 0x62, 0xC3, 0x48, 0x67, 0x07, 0x80, 0xBF,
+    0x4B, 0xBB, 0xAB, 0x47, 0xBB, 0x6B, 0xE4, 0x92, 0x1B, 0xE4, 0x29, 0xB5, 0x64, 0x4A, 0x95, 0x1C,
+    0xD6, 0x9D, 0xCB, 0xB0, 0xB4, 0xA0, 0xC6, 0x5E, 0x96, 0xDD, 0x71, 0xFA, 0x13, 0xD7, 0x93, 0x46,
+    0x16, 0x92, 0x19, 0x1F, 0xE8, 0x3E, 0xBF, 0xEB, 0x5C, 0xB5, 0xC4, 0x6F, 0x57, 0x3E, 0x7E, 0xBB,
+    0x76, 0xF1, 0xDB, 0x5D, 0xFC, 0x76, 0x9E, 0x84, 0x6B, 0x3D, 0x55, 0x2B, 0xE5, 0xFA, 0x11, 0x15,
+    0x12, 0x92, 0x7C, 0xA3, 0x50, 0x46, 0xE3, 0xFD, 0x80, 0x66, 0xF3, 0xA6, 0x10, 0x1D, 0x35, 0x25,
+    0x63, 0x32, 0x4D, 0x48, 0xF7, 0xC4, 0xF9, 0xCD, 0x35, 0x81, 0x7D, 0x29, 0xE1, 0xE4, 0xCA, 0x53,
+    0xE8, 0x95, 0x6A, 0x03, 0x8D, 0x0C, 0x17, 0x10, 0x1D, 0x8B, 0xB7, 0x08, 0xD1, 0x71, 0xDF, 0x84,
+    0x7F, 0x75, 0x88, 0x89, 0xDF, 0xED, 0xEA, 0xDD, 0x0E, 0x85, 0x37, 0x7F, 0x74, 0x2F, 0x25, 0xE7,
+    0x6A, 0x16, 0x1A, 0x2D, 0x99, 0x3E, 0xAB, 0x05, 0x8D, 0xE5, 0xCC, 0x76, 0x7F, 0xB6, 0xF2, 0x69,
+    0xE8, 0xDA, 0x2B, 0x50, 0x8F, 0x0D, 0x94, 0x73, 0xDD, 0x92, 0xAD, 0xC6, 0x41, 0xA7, 0x09, 0x6A,
+    0x05, 0x28, 0x67, 0xEB, 0xC8, 0xD6, 0x72, 0x86, 0xAE, 0x1D, 0xD2, 0x3C, 0x5A, 0xCE, 0xF9, 0x46,
+    0xB6, 0x62, 0x47, 0x86, 0xBE, 0x0C, 0x85, 0x44, 0xF7, 0xB7, 0x92, 0x8B, 0x91, 0xD6, 0xDF, 0xBB,
+    0x53, 0x39, 0x8B, 0x71, 0xF1, 0x88, 0x98, 0x9B, 0x4A, 0xB8, 0xE3, 0x08, 0x8A, 0x39, 0xCD, 0xA9,
+    0xBA, 0xDB, 0xDF, 0x3B, 0x16, 0x75, 0x35, 0xDB, 0xED, 0xE2, 0x82, 0xE4, 0x9D, 0xFA, 0x52, 0x4B,
+    0xB6, 0x82, 0xED, 0xB3, 0x15, 0xBA, 0x3E, 0x5B, 0xC9, 0xD4, 0x67, 0x2B, 0xA5, 0xFA, 0x6C, 0xA5,
+    0x1E, 0xFA, 0x6C, 0xE5, 0xA6, 0xED, 0xB3, 0x35, 0x5F, 0x6C, 0x9F, 0xAD, 0xD5, 0x64, 0xFB, 0x6C,
+    0x6D, 0x5A, 0xDB, 0x67, 0xEB, 0x8A, 0xED, 0x33, 0xCD, 0xD8, 0x3E, 0xD3, 0x88, 0xED, 0x33, 0xB5,
+    0xE9, 0x3E, 0xB6, 0x3F, 0xDE, 0xA0, 0x7B, 0xC5, 0xCA, 0x17, 0xD2, 0x20, 0x5F, 0x6A, 0xE3, 0xF7,
+    0x38, 0x6E, 0xC9, 0x17, 0x6C, 0x4B, 0xE5, 0x89, 0xCB, 0x93, 0xCC, 0x60, 0xFF, 0x71, 0xE8, 0xA1,
+    0xD1, 0x02, 0x17, 0x96, 0xE9, 0xD9, 0x3B, 0xBE, 0x7F, 0x59, 0xAB, 0x49, 0x2E, 0xE7, 0xC5, 0x55,
+    0xDD, 0x79, 0xB2, 0x41, 0xD3, 0x27, 0xF5, 0x3F, 0x1B, 0x1B, 0x07, 0xE6, 0x7B, 0x31, 0xD6, 0x39,
+    0xB2, 0xC7, 0x92, 0xBD, 0xD9, 0x9E, 0x8F, 0xD3, 0x41, 0xBE, 0xD6, 0xDA, 0x69, 0x34, 0x7A, 0x25,
+    0xDB, 0x60, 0x20, 0x5B, 0xDF, 0xCA, 0x6D, 0xAE, 0xD3, 0x53, 0x3D, 0x65, 0x25, 0x69, 0x1D, 0xE2,
+    0x50, 0x4E, 0x10, 0x03, 0x69, 0x3B, 0x9E, 0xE3, 0x3D, 0x94, 0xEE, 0x7C, 0x9B, 0x64, 0x66, 0x4B,
+    0x5A, 0x45, 0x3A, 0x95, 0xB4, 0xC2, 0x27, 0x63, 0xF2, 0x5C, 0x72, 0x8E, 0x59, 0x07, 0x5C, 0xDA,
+    0x69, 0xB7, 0x8B, 0xEB, 0xD8, 0xA8, 0x4F, 0xB0, 0xB0, 0x76, 0xD7, 0xFD, 0xDD, 0x47, 0x66, 0x16,
+    0x44, 0x39, 0x16, 0x63, 0x11, 0xA8, 0x31, 0x18, 0xCF, 0xA7, 0xB8, 0x6F, 0x1F, 0xFC, 0xD7, 0x45,
+    0xC7, 0x9A, 0x91, 0x9E, 0x8E, 0x4A, 0xC8, 0x9A, 0x4C, 0x56, 0x28, 0x02, 0x97, 0x63, 0x65, 0x56,
+    0x19, 0xFD, 0x18, 0x26, 0x96, 0x6E, 0x25, 0xFB, 0x2D, 0x56, 0x70, 0xE5, 0xEB, 0x1E, 0x07, 0x15,
+    0xC1, 0xD0, 0x53, 0x04, 0xAA, 0x00, 0xCD, 0xED, 0x67, 0x34, 0x62, 0x62, 0x93, 0x3B, 0xE9, 0xF6,
+    0x05, 0xB1, 0xF0, 0x05, 0x12, 0x72, 0x7E, 0xCC, 0x2D, 0x38, 0x8A, 0x80, 0x72, 0x17, 0x10, 0x99,
+    0x67, 0xC8, 0x76, 0xC3, 0xE7, 0xAF, 0xC5, 0xD5, 0xA9, 0xE2, 0xA2, 0x5F, 0x37, 0x8A, 0xB9, 0x18,
+    0x2B, 0x67, 0xDB, 0x87, 0xF9, 0x40, 0x31, 0x17, 0xFD, 0x9D, 0x60, 0xDC, 0xA7, 0x5F, 0xDE, 0xE7,
+    0x8E, 0xDA, 0x4D, 0x9E, 0x62, 0x66, 0xE8, 0xB1, 0x6D, 0x1E, 0x28, 0x66, 0x6A, 0x87, 0x6D, 0xB3,
+    0x40, 0x31, 0xD3, 0xB8, 0x88, 0x0E, 0x5D, 0x9D, 0x7D, 0x44, 0x18, 0x49, 0x2E, 0xBB, 0x68, 0x1A,
+    0xBF, 0x4B, 0xAF, 0xC4, 0x14, 0x9C, 0x2D, 0x51, 0xA1, 0xC5, 0x6C, 0x6D, 0xAD, 0x16, 0x39, 0x4A,
+    0xC5, 0xB0, 0x4D, 0xC4, 0xC6, 0x2B, 0xD7, 0x62, 0x05, 0x4C, 0xAC, 0x5F, 0xAE, 0xFD, 0xD0, 0x03,
+    0xF6, 0x9B, 0x77, 0x96, 0xA5, 0xBF, 0x7A, 0x7A, 0x7A, 0xFA, 0xEC, 0x12, 0xAD, 0xFD, 0xEF, 0xC4,
+    0xB7, 0x3B, 0x2A, 0xD6, 0xE7, 0xD8, 0xB7, 0xB7, 0x62, 0x41, 0x74, 0x15, 0x80, 0x6A, 0x31, 0x33,
+    0x60, 0x5D, 0xE3, 0x21, 0xDF, 0xB0, 0x1E, 0x1A, 0x4F, 0x37, 0x53, 0xA8, 0x65, 0xD8, 0x76, 0x11,
+    0x16, 0x21, 0x2D, 0x4D, 0x13, 0x43, 0xF8, 0xE7, 0x4B, 0xBF, 0x66, 0xC3, 0x06, 0x85, 0x34, 0x47,
+    0xD4, 0xF4, 0x62, 0xA5, 0x9B, 0x8B, 0x40, 0xAE, 0x68, 0xAD, 0x0C, 0x50, 0x2E, 0xB6, 0x05, 0x99,
+    0x31, 0x02, 0x24, 0x4B, 0x3F, 0x88, 0xDE, 0xE3, 0xCF, 0xEF, 0x76, 0xB1, 0x76, 0xF6, 0x56, 0x00,
+    0x33, 0x09, 0x4A, 0xDF, 0x78, 0x8A, 0xA5, 0xD8, 0xC8, 0x03, 0xDD, 0xD9, 0xE5, 0x95, 0x2A, 0x2D,
+    0x6C, 0xB4, 0x00, 0x9F, 0xB8, 0x9E, 0xEA, 0xFC, 0xF3, 0xD0, 0xC4, 0xB5, 0x87, 0x5E, 0x8C, 0xC5,
+    0xFC, 0xFE, 0xF2, 0x0A, 0xB9, 0x02, 0x6A, 0x41, 0xEF, 0xC4, 0x4E, 0xC4, 0xD5, 0x68, 0xA3, 0x9A,
+    0xA5, 0x58, 0x20, 0xD1, 0x4C, 0x31, 0x57, 0x26, 0xE6, 0xD1, 0x90, 0x96, 0x8B, 0x6C, 0x46, 0x86,
+    0xC8, 0x94, 0xB6, 0x3D, 0xD8, 0xD7, 0xD4, 0x63, 0xCC, 0x86, 0x59, 0x62, 0x67, 0x0F, 0xA4, 0x75,
+    0x64, 0xE3, 0xA8, 0x5F, 0xE2, 0xAA, 0x6A, 0x43, 0x2C, 0xE6, 0xA9, 0xBF, 0x15, 0xC5, 0xD3, 0xED,
+    0xB4, 0x56, 0xE4, 0x9E, 0xBD, 0xEF, 0x40, 0x3E, 0xD9, 0x67, 0xB2, 0xF8, 0x7B, 0x4C, 0xB4, 0x94,
+    0x73, 0x27, 0x4F, 0x1D, 0x1A, 0x8D, 0xD8, 0x50, 0x06, 0x18, 0x42, 0xB1, 0x42, 0xB8, 0x3F, 0xDB,
+    0xC8, 0x96, 0xBD, 0x0B, 0x60, 0x68, 0xCB, 0x09, 0x6C, 0x5F, 0x8D, 0xD0, 0x38, 0xE3, 0xA0, 0x1E,
+    0xEB, 0x1E, 0xCC, 0x64, 0x81, 0xCA, 0x5F, 0x01, 0x8A, 0xF9, 0x39, 0x20, 0x5F, 0x02, 0x90, 0xAD,
+    0xD1, 0x1B, 0xE4, 0x0F, 0x76, 0x40, 0xCA, 0xE0, 0xB8, 0xA8, 0x9A, 0xBD, 0x27, 0xC2, 0x66, 0x1B,
+    0x17, 0x6D, 0x9D, 0x35, 0x4E, 0x13, 0x66, 0xCE, 0xF7, 0x18, 0xE5, 0x3D, 0xC0, 0x10, 0xF3, 0x32,
+    0xEF, 0x61, 0xBA, 0xDE, 0x81, 0x20, 0x6E, 0xEE, 0x42, 0x10, 0x6F, 0xA6, 0xBD, 0xDD, 0x9C, 0x96,
+    0xCB, 0x8A, 0x0B, 0x6E, 0xC5, 0xC3, 0x22, 0x59, 0xF3, 0x8A, 0x87, 0xF6, 0xFB, 0x31, 0xD9, 0xEE,
+    0x07, 0x2B, 0x88, 0x22, 0x44, 0x4D, 0x43, 0xF1, 0xBB, 0x36, 0x2A, 0x1E, 0x95, 0xCF, 0x56, 0x50,
+    0x1E, 0xA2, 0x16, 0x13, 0xE7, 0x3C, 0x35, 0x8E, 0x7A, 0xC4, 0xBC, 0xE6, 0xE3, 0x61, 0x48, 0xD6,
+    0x7C, 0xFA, 0x5D, 0x77, 0xD1, 0x7C, 0xDF, 0x5B, 0xF3, 0x07, 0x04, 0xF1, 0x95, 0x4A, 0xFA, 0xD6,
+    0x1E, 0x41, 0xFC, 0x42, 0xBA, 0xC3, 0x41, 0xB3, 0x4C, 0x96, 0x60, 0x4A, 0x8A, 0xCB, 0x96, 0x0B,
+    0xC0, 0x6F, 0xE7, 0x79, 0x01, 0xFF, 0x1A, 0x8E, 0x5B, 0xAE, 0x43, 0xE9, 0xB9, 0x49, 0x4A, 0x30,
+    0xA2, 0xEB, 0xEB, 0x09, 0xAA, 0xED, 0xC4, 0x93, 0x04, 0xFB, 0x85, 0x75, 0xD0, 0xCF, 0xF3, 0x59,
+    0xD8, 0xED, 0x3E, 0xAC, 0x8D, 0x41, 0x3F, 0xD0, 0x46, 0xAD, 0x29, 0xCA, 0x46, 0xBA, 0x96, 0x7A,
+    0xA2, 0x1E, 0xA9, 0x17, 0xCA, 0x99, 0x7A, 0x23, 0x8A, 0x5A, 0xBA, 0xB6, 0xF9, 0xDC, 0x44, 0x3D,
+    0x36, 0x4F, 0x2E, 0x94, 0x73, 0xD3, 0x6F, 0x44, 0x59, 0x4B, 0xD7, 0xB5, 0x66, 0xA2, 0x56, 0x5B,
+    0x2C, 0x94, 0x6A, 0xD9, 0x88, 0xC2, 0x96, 0xAE, 0xC5, 0x4C, 0x9C, 0x4C, 0x94, 0x5B, 0x2B, 0x39,
+    0xA3, 0x30, 0xC8, 0x97, 0x29, 0x5C, 0x1E, 0x41, 0x5A, 0x23, 0x2F, 0x97, 0x11, 0x49, 0x2A, 0x72,
+    0x69, 0x6C, 0xEA, 0xE3, 0x00, 0xFC, 0x7E, 0x74, 0x60, 0x96, 0x8A, 0x75, 0x8B, 0xCB, 0x3D, 0x60,
+    0xDD, 0x86, 0xA4, 0x91, 0x2D, 0x70, 0xAA, 0xD3, 0xF6, 0xAE, 0x85, 0x92, 0xBE, 0xD8, 0xC2, 0x01,
+    0x46, 0x7C, 0x44, 0x8F, 0x7E, 0x4C, 0xAD, 0xF1, 0x98, 0x68, 0x43, 0x8E, 0x11, 0x95, 0x56, 0x50,
+    0x4F, 0x77, 0xEE, 0x46, 0xCB, 0xB2, 0x73, 0xC6, 0xD3, 0xCC, 0xC7, 0x3A, 0x1D, 0xD6, 0xE4, 0x65,
+    0xD5, 0x01, 0xA4, 0x2F, 0x3B, 0x4D, 0x1E, 0xB7, 0x52, 0x13, 0x1C, 0x75, 0x7D, 0x52, 0xC7, 0x8A,
+    0x25, 0x49, 0xBD, 0xA3, 0xEE, 0xEF, 0xAE, 0xC6, 0x32, 0x65, 0x69, 0x4B, 0x82, 0xD0, 0xBE, 0xEE,
+    0x2A, 0xAC, 0xB6, 0x16, 0x49, 0xAE, 0xD8, 0x3E, 0xA2, 0xDE, 0x4C, 0x0C, 0xD8, 0x9E, 0x95, 0x8D,
+    0x62, 0x29, 0x16, 0xCC, 0x68, 0x26, 0x6C, 0x6B, 0xFB, 0x3C, 0x64, 0xDA, 0x0D, 0xE3, 0x20, 0xAD,
+    0x85, 0xF6, 0xB1, 0xC2, 0xEC, 0xA3, 0xC3, 0xD3, 0xEC, 0xBD, 0x9F, 0x52, 0x5F, 0x06, 0xBA, 0x25,
+    0x16, 0x24, 0x5B, 0x17, 0x1B, 0x58, 0xCD, 0x45, 0x48, 0x4D, 0xEB, 0x5A, 0xEB, 0xBE, 0x50, 0x8F,
+    0xC6, 0x3F, 0x67, 0x7C, 0x11, 0xCC, 0x8B, 0x0B, 0xE2, 0xB5, 0x80, 0x75, 0xCD, 0x8A, 0x91, 0xA2,
+    0x2B, 0x19, 0x74, 0xFA, 0xA1, 0x09, 0xEB, 0xB8, 0x81, 0xF1, 0x98, 0xBE, 0x08, 0x90, 0x16, 0x99,
+    0xBD, 0x80, 0x6D, 0x1B, 0x80, 0x63, 0x7D, 0x39, 0xF9, 0xFE, 0xCA, 0x0B, 0x15, 0x6C, 0x0F, 0xBA,
+    0x93, 0x33, 0x9A, 0xD0, 0x68, 0xA9, 0xF4, 0xB2, 0xE4, 0x2F, 0xEB, 0xEC, 0xB2, 0xDA, 0x68, 0x38,
+    0xED, 0xA9, 0x1E, 0xE9, 0x7B, 0x37, 0xD5, 0xD9, 0x10, 0x6D, 0x3D, 0x19, 0xFF, 0x50, 0xB6, 0xA2,
+    0x6C, 0x6E, 0x9C, 0xF1, 0xD5, 0xAD, 0x80, 0xB8, 0x32, 0x60, 0x7C, 0xA6, 0x09, 0xBD, 0xFA, 0xEC,
+    0xB2, 0x5F, 0xF6, 0x4A, 0xDB, 0x8C, 0x99, 0xEE, 0xAF, 0x1C, 0x1B, 0x5C, 0xC1, 0x4C, 0x64, 0xFD,
+    0xEB, 0x82, 0x8A, 0x43, 0x2C, 0x77, 0xDD, 0xE0, 0xF8, 0xF4, 0xB4, 0xBF, 0x90, 0x03, 0xF8, 0x38,
+    0x10, 0xAB, 0x18, 0x56, 0x80, 0xF5, 0xD2, 0x6E, 0xF7, 0x91, 0xB5, 0xDB, 0x47, 0x18, 0x43, 0xA6,
+    0xD3, 0xD3, 0x2F, 0xBD, 0x35, 0x31, 0xB0, 0x9F, 0x31, 0x42, 0x76, 0x28, 0x97, 0xCE, 0x7C, 0x7A,
+    0x42, 0x7B, 0xB4, 0xDB, 0x9D, 0xBC, 0x98, 0x64, 0x58, 0xC8, 0xB6, 0x5D, 0xAC, 0x2B, 0x33, 0x53,
+    0x62, 0xA4, 0x2D, 0xB1, 0xD6, 0x4F, 0xFF, 0xA0, 0xB9, 0xDD, 0x22, 0x85, 0xF8, 0x53, 0xBF, 0x48,
+    0x4C, 0x70, 0xA7, 0xDD, 0xD5, 0x18, 0xCB, 0x8D, 0x71, 0x95, 0x5F, 0xA0, 0xC5, 0x6F, 0xCE, 0x51,
+    0xD2, 0x48, 0xAE, 0x92, 0xFC, 0x1B, 0x43, 0x2F, 0xDC, 0xE1, 0x28, 0xB9, 0xB4, 0xDB, 0xED, 0xAE,
+    0x65, 0x52, 0x04, 0x04, 0x96, 0x46, 0xBA, 0x57, 0x4F, 0xA3, 0x4F, 0x30, 0x5A, 0xDF, 0x1E, 0xE3,
+    0xA9, 0x1C, 0xD6, 0xF1, 0xDE, 0x7B, 0x81, 0xE5, 0x3E, 0xBF, 0x23, 0xCD, 0x1D, 0x45, 0x5C, 0x6A,
+    0x6D, 0x7B, 0x46, 0x0B, 0xD6, 0x31, 0xCC, 0x08, 0x3A, 0x5F, 0x04, 0xE8, 0x46, 0xE3, 0x41, 0xBD,
+    0x75, 0xE4, 0x42, 0x50, 0x86, 0x18, 0x9B, 0x8A, 0xD1, 0x29, 0xEB, 0x40, 0xC7, 0x7A, 0x9A, 0x72,
+    0x91, 0x16, 0xEA, 0x6F, 0x49, 0x63, 0x5A, 0x11, 0xFE, 0x3C, 0xA1, 0x2F, 0x26, 0xED, 0xD4, 0x7E,
+    0xEF, 0x11, 0xFD, 0x37, 0x9A, 0x53, 0x40, 0x11, 0x3E, 0xD1, 0x46, 0xF2, 0xB4, 0xCD, 0x7E, 0x8C,
+    0xAF, 0x94, 0x67, 0xBB, 0x13, 0xB2, 0x95, 0xD2, 0xD1, 0xB5, 0xF8, 0x68, 0x19, 0x94, 0x33, 0x90,
+    0x6D, 0x1F, 0xFD, 0x52, 0xC2, 0x4E, 0xA9, 0x25, 0x51, 0x2E, 0x74, 0x3E, 0x5B, 0x29, 0x56, 0xBA,
+    0x96, 0x2E, 0x4A, 0xB3, 0x72, 0x26, 0xBA, 0xA7, 0x87, 0x76, 0x78, 0x85, 0xE6, 0x96, 0x44, 0xF5,
+    0x43, 0xC9, 0xE5, 0xE1, 0xD0, 0x47, 0xB6, 0xDF, 0x1B, 0x1C, 0x95, 0xDF, 0xDF, 0xBB, 0x0C, 0x90,
+    0x9D, 0x04, 0xE2, 0x42, 0x63, 0x34, 0xAF, 0x00, 0x4F, 0xC7, 0xB2, 0x9E, 0xA7, 0xB1, 0x1E, 0x69,
+    0xA1, 0x1B, 0x0B, 0xF5, 0x46, 0x1B, 0xF5, 0x8A, 0x5D, 0x29, 0x56, 0x0A, 0x8D, 0xD9, 0xC7, 0x3C,
+    0x8D, 0x63, 0xF8, 0x77, 0xD0, 0xF4, 0x79, 0x88, 0x53, 0x7E, 0xA0, 0x71, 0xF9, 0x0C, 0x94, 0x53,
+    0xB4, 0x89, 0xC0, 0x26, 0xED, 0x02, 0x42, 0x1E, 0xA2, 0xC0, 0xAB, 0xC6, 0xC6, 0xD9, 0x28, 0x2D,
+    0xF2, 0x50, 0x8E, 0x24, 0x40, 0xA5, 0x7D, 0xC9, 0x4A, 0x2A, 0xDB, 0x28, 0x6F, 0x77, 0xAF, 0x26,
+    0x33, 0x33, 0x0F, 0xD1, 0x57, 0xD7, 0x8C, 0x8D, 0xB3, 0x0E, 0x28, 0x43, 0x1E, 0x52, 0x52, 0x14,
+    0x8D, 0x33, 0x33, 0xD0, 0x4C, 0x79, 0x94, 0x93, 0x65, 0xA0, 0x71, 0xB9, 0x00, 0xF5, 0x79, 0x4C,
+    0x5B, 0xB5, 0x9E, 0xC6, 0xD1, 0x45, 0x30, 0x9E, 0x10, 0x57, 0xD1, 0xE8, 0x19, 0xCE, 0x30, 0x2B,
+    0x9A, 0x62, 0x1B, 0x67, 0xBB, 0x10, 0x53, 0xEE, 0xBF, 0xFD, 0xA5, 0x7D, 0xE6, 0xF0, 0x21, 0x97,
+    0xFB, 0x30, 0x09, 0x6E, 0x77, 0x62, 0xDC, 0x5D, 0xF0, 0x6F, 0xEF, 0x4D, 0x9F, 0x3B, 0x9C, 0xB9,
+    0xD9, 0x21, 0x2C, 0x6B, 0xFB, 0xA3, 0xDD, 0x35, 0x9E, 0x43, 0xBD, 0xD5, 0x64, 0x42, 0xA1, 0xBE,
+    0x5B, 0xD1, 0x74, 0x5F, 0xD7, 0xD6, 0xAE, 0xF2, 0x2D, 0x96, 0x0E, 0x0B, 0x7C, 0x3A, 0x0B, 0xB9,
+    0x07, 0x42, 0xE9, 0x4D, 0x0B, 0xD9, 0x5C, 0xBB, 0x1B, 0x40, 0xE1, 0xBB, 0x72, 0x4C, 0xE9, 0x0B,
+    0x9C, 0x17, 0x30, 0xE5, 0xA1, 0x7E, 0x3E, 0xE6, 0x38, 0x75, 0x11, 0xF6, 0x3A, 0x0B, 0xE5, 0x0C,
+    0xD5, 0x5C, 0xFA, 0xCA, 0xC7, 0x2C, 0x5F, 0x33, 0x51, 0x04, 0x3A, 0x9A, 0x09, 0x3B, 0xE5, 0x6B,
+    0x5C, 0x26, 0x7C, 0x50, 0xDB, 0x4D, 0x76, 0x2A, 0xB4, 0xD2, 0xF9, 0x3F, 0xBF, 0x18, 0x79, 0x49,
+    0x00, 0x1F, 0x7B, 0x78, 0xBE, 0x94, 0x07, 0x4F, 0x5C, 0xE6, 0xE4, 0x82, 0x53, 0xE2, 0x7F, 0xFF,
+    0xFF, 0x01, 0xDD, 0xBD, 0x4D, 0xB0, 0xE6, 0xD6, 0x79, 0xE7, 0xF7, 0x03, 0x0E, 0xFB, 0xC2, 0x23,
+    0xC4, 0x3A, 0x5C, 0xA8, 0x95, 0x11, 0x29, 0x19, 0xAE, 0x4A, 0x16, 0xB2, 0x4A, 0x12, 0xB2, 0x50,
+    0xAA, 0xB4, 0xE8, 0xBE, 0x07, 0x12, 0x53, 0xD1, 0xC2, 0x0B, 0x75, 0x26, 0xFD, 0x8A, 0x33, 0xE6,
+    0x82, 0x5E, 0x68, 0x52, 0x36, 0xA7, 0x92, 0xDE, 0x68, 0xC1, 0xAA, 0x34, 0x1B, 0x70, 0x94, 0x8A,
+    0x53, 0xA5, 0x85, 0x6E, 0x52, 0xD2, 0xA4, 0x12, 0x2F, 0xCC, 0x05, 0x5D, 0x43, 0xBD, 0xAC, 0x9A,
+    0xD6, 0x42, 0x0B, 0xA6, 0xD2, 0x7D, 0x01, 0xB1, 0xAB, 0xC2, 0x85, 0x16, 0x82, 0x24, 0x7B, 0xBC,
+    0xC8, 0xC2, 0xD0, 0x88, 0x9C, 0x29, 0x93, 0x95, 0xE2, 0x91, 0x0D, 0x45, 0xE8, 0xD6, 0x01, 0xFE,
+    0x59, 0x1C, 0xE0, 0xBD, 0xB7, 0xD9, 0x4D, 0x5A, 0x1F, 0x96, 0x3C, 0x36, 0xEE, 0x05, 0xF0, 0xE2,
+    0xFB, 0x9C, 0xE7, 0x3C, 0xE7, 0x39, 0xCF, 0xF7, 0xE1, 0x71, 0x0D, 0xA4, 0xD2, 0x82, 0x95, 0xD4,
+    0xD9, 0x89, 0x76, 0xB0, 0x1D, 0x85, 0x2F, 0x3A, 0xAC, 0x2F, 0x1A, 0x72, 0x6F, 0x2B, 0xAC, 0x3F,
+    0x02, 0xEB, 0x81, 0x62, 0x00, 0x5C, 0x07, 0xB4, 0x15, 0xB9, 0x66, 0xC8, 0xA5, 0x0A, 0x23, 0x0D,
+    0x40, 0x3D, 0x02, 0x36, 0x00, 0xD9, 0x0C, 0x98, 0xB8, 0xF9, 0x75, 0x30, 0xB3, 0x03, 0x13, 0xEA,
+    0x8A, 0x3C, 0xB4, 0x3D, 0xC5, 0xE8, 0xE6, 0x44, 0x7D, 0x21, 0xA9, 0x4A, 0xA5, 0x09, 0xDE, 0x7F,
+    0xB3, 0x03, 0xEC, 0x7D, 0x9B, 0xDF, 0xBA, 0xD6, 0x81, 0x53, 0x05, 0x6E, 0x06, 0xDE, 0xF3, 0x3C,
+    0x71, 0xB9, 0xB6, 0x54, 0x99, 0x34, 0x14, 0x8B, 0x46, 0x57, 0xE5, 0xD3, 0x27, 0x31, 0x13, 0x71,
+    0x1D, 0x21, 0xF3, 0x5C, 0xBC, 0xD6, 0xE1, 0xD4, 0x50, 0xCA, 0x43, 0x1E, 0x20, 0x9D, 0x81, 0xE5,
+    0x11, 0x58, 0x2E, 0x91, 0xCC, 0xA7, 0x98, 0xD0, 0xBE, 0x7E, 0x6D, 0x74, 0xD2, 0x90, 0x6B, 0x81,
+    0xA7, 0x3C, 0x24, 0x71, 0x4D, 0x52, 0x8F, 0x79, 0x6B, 0xC0, 0xA8, 0x23, 0x5D, 0xE2, 0xE7, 0x2E,
+    0xEE, 0xAE, 0x92, 0x3C, 0x9F, 0x49, 0x03, 0xEA, 0x6A, 0x4D, 0x94, 0x81, 0x62, 0x24, 0x53, 0x87,
+    0x60, 0xF9, 0xA7, 0x58, 0x4F, 0xD9, 0x80, 0x30, 0x1E, 0xAC, 0xE7, 0x36, 0x20, 0x6C, 0x07, 0xD6,
+    0x1B, 0x0F, 0x88, 0x1B, 0x80, 0xF5, 0xB6, 0x03, 0xA4, 0x09, 0xB0, 0x52, 0x07, 0xE8, 0x99, 0x39,
+    0x5E, 0x89, 0xB7, 0xD5, 0x0D, 0x58, 0x6F, 0x66, 0x40, 0x14, 0xF1, 0x6D, 0x6D, 0x7C, 0xF5, 0x0C,
+    0xD6, 0x53, 0x7A, 0x10, 0xA8, 0xC3, 0x7A, 0x32, 0x71, 0xA4, 0x17, 0x28, 0x83, 0x91, 0x06, 0x5A,
+    0x5F, 0x6B, 0x26, 0x55, 0xCF, 0x06, 0x79, 0x28, 0x7A, 0x80, 0x24, 0xC0, 0x06, 0x57, 0xB8, 0xEF,
+    0xE0, 0x65, 0x00, 0xD2, 0x0A, 0x80, 0x0B, 0xBB, 0xAB, 0xD4, 0xB9, 0x16, 0xEA, 0xEF, 0x6B, 0xC1,
+    0x8D, 0xC9, 0x8C, 0xFB, 0x1F, 0xA9, 0xAB, 0xA2, 0xA2, 0xE8, 0x6D, 0x43, 0x36, 0xE6, 0x1D, 0xC9,
+    0x9C, 0xF5, 0x50, 0x3F, 0xE1, 0xA1, 0xD0, 0x04, 0x99, 0x04, 0xC9, 0x6C, 0x3D, 0xD4, 0x9F, 0x9A,
+    0xA1, 0xE8, 0xCB, 0x8E, 0x6C, 0x34, 0x81, 0x64, 0xA6, 0x6D, 0xA8, 0x2B, 0x3B, 0x52, 0x0E, 0x89,
+    0x90, 0xBA, 0x62, 0x6C, 0xE5, 0x13, 0x75, 0xAC, 0xD8, 0x94, 0x4E, 0x00, 0xA7, 0x00, 0x45, 0x05,
+    0x98, 0x1E, 0xC0, 0x03, 0x7C, 0xF0, 0xE2, 0xEE, 0x2A, 0xFC, 0x7E, 0x22, 0x4D, 0xD8, 0x90, 0x49,
+    0x0D, 0xAD, 0xA7, 0xEE, 0x37, 0xB8, 0xBB, 0x7F, 0x83, 0x09, 0x10, 0xC0, 0x7A, 0xF2, 0x0E, 0xDC,
+    0x37, 0x2B, 0x07, 0xC8, 0x7E, 0x7A, 0x04, 0x13, 0x2E, 0x47, 0xF8, 0x8F, 0xCF, 0x01, 0xEE, 0xCE,
+    0xF7, 0x3C, 0xA0, 0x56, 0x0D, 0x18, 0x49, 0x80, 0xFD, 0xE1, 0xBD, 0x39, 0x5E, 0x0A, 0x80, 0xEC,
+    0x67, 0xA6, 0xF8, 0x94, 0x07, 0xEB, 0xC7, 0xC2, 0x83, 0x7B, 0xE5, 0xC4, 0xF5, 0x20, 0xA8, 0x3B,
+    0x4C, 0xD8, 0xA0, 0x9E, 0xA8, 0xC1, 0x75, 0xA4, 0xAA, 0x8E, 0xF4, 0x02, 0x46, 0x95, 0x34, 0x62,
+    0xF4, 0x19, 0xA9, 0x27, 0x53, 0x05, 0x90, 0xBC, 0x00, 0x40, 0xB2, 0xDB, 0x91, 0x0F, 0xAD, 0x86,
+    0x54, 0x9F, 0xD1, 0x84, 0xF3, 0x49, 0xC0, 0x7E, 0x87, 0xA2, 0x63, 0x24, 0x09, 0x8F, 0x96, 0x50,
+    0xBC, 0xFA, 0xC5, 0x9E, 0x24, 0x3C, 0x7B, 0x0B, 0x8A, 0x57, 0xBF, 0x5C, 0x91, 0x48, 0x23, 0x14,
+    0x52, 0x47, 0x12, 0x9E, 0x9D, 0xA1, 0x78, 0xF5, 0x4B, 0x9E, 0x24, 0x3C, 0xEB, 0x2A, 0x8A, 0x57,
+    0x3E, 0x1D, 0x48, 0x02, 0x76, 0xA0, 0xE8, 0x68, 0xAB, 0x74, 0xC6, 0x04, 0xA3, 0x85, 0xD2, 0xB7,
+    0x1A, 0x68, 0x7B, 0x80, 0xCF, 0xFF, 0x94, 0xC8, 0x5A, 0x6B, 0x36, 0x9E, 0x5C, 0xEA, 0x6F, 0xC3,
+    0x33, 0x7A, 0xF1, 0xEF, 0x0A, 0x59, 0x3B, 0x80, 0xF4, 0x85, 0x64, 0x0F, 0xE4, 0xEA, 0x20, 0x93,
+    0x07, 0x9E, 0x0C, 0x00, 0x62, 0xA3, 0x35, 0xD6, 0x03, 0x4F, 0xCE, 0x57, 0x8C, 0x77, 0x0A, 0xD9,
+    0x62, 0xB5, 0x18, 0x35, 0xD6, 0x9B, 0xA9, 0x32, 0x21, 0x99, 0x40, 0x04, 0x70, 0xDD, 0x2D, 0xB0,
+    0xFE, 0x06, 0x98, 0xE0, 0x00, 0xA9, 0x01, 0xA7, 0x11, 0xAC, 0x17, 0x98, 0x50, 0x0C, 0x20, 0x13,
+    0xC0, 0x75, 0xAE, 0xC3, 0xFA, 0x7C, 0xC4, 0x04, 0x54, 0x25, 0xAA, 0x0A, 0x9F, 0x6B, 0x4E, 0xF5,
+    0x84, 0x54, 0x95, 0xE3, 0x0A, 0xC8, 0xDD, 0x0E, 0x5E, 0x4E, 0x24, 0xCD, 0x14, 0x53, 0x26, 0x69,
+    0x40, 0x43, 0xF1, 0xC6, 0xCD, 0x11, 0xAB, 0xE6, 0x06, 0xAE, 0xA3, 0xFE, 0xDF, 0xD3, 0x11, 0x61,
+    0x46, 0xB2, 0xCE, 0x04, 0xCA, 0x86, 0x02, 0xEB, 0x09, 0xF0, 0x3E, 0x5C, 0x97, 0xF7, 0xB1, 0x12,
+    0x0E, 0xC0, 0x84, 0x74, 0x04, 0x22, 0x4D, 0x05, 0x9C, 0x62, 0x3F, 0x94, 0x46, 0x00, 0xB3, 0xDC,
+    0xF4, 0xF1, 0xB2, 0x1D, 0x62, 0xAD, 0xCB, 0xED, 0xE9, 0x0E, 0x30, 0x81, 0xB6, 0x89, 0x70, 0x50,
+    0x05, 0xB8, 0x2E, 0x55, 0xBC, 0x6C, 0x14, 0x2F, 0x67, 0x4B, 0xBC, 0x9C, 0xCF, 0x90, 0xB4, 0x7F,
+    0x89, 0x9D, 0xE3, 0x37, 0xEC, 0x42, 0x22, 0x79, 0xAC, 0x22, 0x31, 0x3B, 0x7A, 0x7E, 0x23, 0x6A,
+    0xBB, 0x2A, 0xF3, 0xB5, 0xD4, 0x15, 0x53, 0x2B, 0x55, 0x6E, 0x3C, 0x7D, 0x32, 0xB0, 0x3C, 0x7A,
+    0xDB, 0x4C, 0xC9, 0xC4, 0x2D, 0x33, 0x19, 0xCF, 0x2D, 0x33, 0xE5, 0x1D, 0xD7, 0xCD, 0x54, 0x34,
+    0x60, 0x26, 0x07, 0x18, 0x2D, 0x80, 0x91, 0x2A, 0x30, 0x93, 0xEB, 0xC0, 0x4C, 0xC5, 0x00, 0x66,
+    0xB2, 0x1E, 0xCC, 0x94, 0x05, 0x30, 0x53, 0x3A, 0x83, 0x99, 0x50, 0x45, 0x36, 0x53, 0x77, 0xB4,
+    0xEA, 0xCB, 0x11, 0xA9, 0xCF, 0x23, 0x59, 0x8A, 0x58, 0xBA, 0xDB, 0x7D, 0x46, 0xEA, 0x69, 0x15,
+    0x6A, 0x4D, 0xE4, 0x52, 0x55, 0x8C, 0x70, 0xA4, 0xD8, 0xF0, 0xC5, 0x80, 0xF5, 0x90, 0x2C, 0x3F,
+    0xEB, 0xA1, 0x24, 0x0D, 0x58, 0x49, 0x3A, 0x77, 0xF8, 0x73, 0xBD, 0xEA, 0xBE, 0xC3, 0x23, 0xBD,
+    0x00, 0xF5, 0xBD, 0x27, 0xA4, 0x81, 0x5A, 0x4B, 0xAD, 0x19, 0x1B, 0x47, 0x3D, 0x0E, 0x43, 0x45,
+    0xA4, 0xB7, 0x24, 0xB1, 0x9A, 0x1B, 0x91, 0x5D, 0x49, 0xEE, 0xE1, 0x30, 0x12, 0x5D, 0xD2, 0xEA,
+    0xE2, 0xEE, 0xCA, 0x85, 0xDD, 0xAE, 0x54, 0x30, 0xD2, 0xAB, 0x9A, 0x69, 0xD5, 0x64, 0x13, 0xC9,
+    0x42, 0x32, 0x83, 0x6B, 0xA8, 0x2B, 0xEC, 0x40, 0xD1, 0x63, 0x26, 0xB2, 0x11, 0x16, 0x92, 0x25,
+    0x5E, 0x90, 0x34, 0x50, 0x48, 0x9A, 0xC8, 0xEE, 0xEE, 0x76, 0xEF, 0xF6, 0x44, 0xBC, 0xD0, 0xBE,
+    0x46, 0x79, 0xEF, 0x09, 0x89, 0x5A, 0xF7, 0xA4, 0xAE, 0x54, 0x2C, 0x71, 0x5D, 0x01, 0xD8, 0x38,
+    0x66, 0x78, 0x00, 0x6E, 0x01, 0x50, 0x02, 0x90, 0x35, 0x00, 0x0C, 0x6B, 0x7B, 0xED, 0xFE, 0x2B,
+    0x69, 0xA4, 0x94, 0xF4, 0xE7, 0x52, 0x43, 0x2B, 0xA9, 0xAA, 0x7B, 0x78, 0x7C, 0xD9, 0xCF, 0x2B,
+    0xB4, 0x8C, 0x37, 0x01, 0xA8, 0x1B, 0xDB, 0xAD, 0x70, 0x73, 0xB8, 0x0E, 0xB2, 0x89, 0x97, 0xD7,
+    0x5B, 0x92, 0x6A, 0xBD, 0x85, 0x03, 0xA4, 0xB7, 0x5B, 0x0E, 0xED, 0x85, 0x91, 0x24, 0x35, 0x1C,
+    0x1A, 0xF2, 0xDC, 0x2D, 0x2B, 0x1B, 0xF2, 0x6E, 0x6F, 0xF9, 0x1B, 0x6F, 0x59, 0x5B, 0xB3, 0x42,
+    0x9A, 0x28, 0x24, 0x32, 0xA9, 0x47, 0x0A, 0x10, 0x5B, 0xE5, 0x6A, 0x2B, 0x6F, 0xA5, 0xA5, 0x56,
+    0x9F, 0x4B, 0x73, 0xB2, 0x40, 0xFD, 0x67, 0xB7, 0x23, 0x34, 0x9F, 0xBB, 0x6F, 0x77, 0x29, 0xEE,
+    0x3E, 0xB9, 0xB6, 0x4D, 0x12, 0x0B, 0xBE, 0xED, 0x96, 0xDD, 0xAE, 0x6E, 0xB6, 0x56, 0x78, 0xB7,
+    0x5D, 0xAA, 0x13, 0xDA, 0xD7, 0x70, 0xF2, 0x99, 0x44, 0x2B, 0x9F, 0x4B, 0x5C, 0xDC, 0xED, 0x76,
+    0xBB, 0xDD, 0x15, 0xC8, 0xB4, 0x01, 0xA4, 0xDE, 0x40, 0x44, 0x71, 0xEF, 0x4F, 0x9E, 0x69, 0x57,
+    0x32, 0x11, 0xAB, 0x8A, 0xF5, 0x2B, 0xC5, 0xFC, 0xB9, 0x4E, 0x7D, 0x73, 0xB7, 0x9E, 0x92, 0x54,
+    0xC5, 0x53, 0x52, 0xEC, 0x8F, 0x66, 0x79, 0x49, 0x61, 0x7D, 0x30, 0x91, 0x5F, 0x1F, 0x4C, 0x55,
+    0xAD, 0xEF, 0xB2, 0x61, 0x7B, 0x57, 0xDD, 0xAD, 0xA7, 0xCC, 0xE1, 0x94, 0xEB, 0xD7, 0x53, 0xE9,
+    0xBC, 0x9D, 0x2A, 0x0F, 0xA7, 0xC2, 0x91, 0x5E, 0x20, 0xD7, 0x09, 0xEE, 0x8E, 0x34, 0x58, 0xA9,
+    0x31, 0xA1, 0xD6, 0x8C, 0x34, 0xE1, 0x9A, 0x95, 0xE5, 0xCB, 0xC7, 0xF5, 0x07, 0xDA, 0x7E, 0xB8,
+    0x7E, 0xBB, 0x36, 0xAD, 0x3F, 0xB2, 0xF5, 0x5A, 0x72, 0x53, 0xEB, 0x73, 0xA5, 0xB6, 0x9B, 0x9E,
+    0x39, 0x61, 0x05, 0x26, 0xE4, 0x1B, 0x04, 0x6B, 0x29, 0xD2, 0xDF, 0x62, 0x88, 0x5F, 0x48, 0xE6,
+    0xB5, 0x4B, 0x14, 0x3D, 0xD9, 0x83, 0x27, 0x2E, 0x9C, 0xC4, 0x13, 0x4F, 0x6B, 0xA0, 0xE8, 0xC9,
+    0x24, 0xF5, 0xC9, 0x0C, 0xF5, 0x72, 0x53, 0x14, 0x3D, 0xD9, 0x4C, 0x31, 0xAD, 0x8F, 0xD4, 0x5D,
+    0x7C, 0x87, 0x99, 0xD7, 0x13, 0xC5, 0x10, 0x4F, 0x24, 0xCB, 0x7A, 0xC2, 0x0E, 0xE5, 0x5D, 0xF2,
+    0x19, 0x16, 0x27, 0x9F, 0x2B, 0x60, 0xDF, 0x94, 0x90, 0xBA, 0x8D, 0x7C, 0x6C, 0xE4, 0x84, 0x34,
+    0x6C, 0x75, 0x5E, 0xEB, 0x95, 0x8D, 0x6F, 0x83, 0x46, 0x1D, 0x49, 0xCB, 0x85, 0x76, 0xBD, 0xB0,
+    0x8E, 0x2E, 0x64, 0x77, 0x01, 0x92, 0xB6, 0x8A, 0xF0, 0x89, 0x63, 0x8D, 0x4E, 0x92, 0x0A, 0x12,
+    0x35, 0xB9, 0x1A, 0xA8, 0x3B, 0x23, 0xC5, 0xA1, 0xE5, 0xB7, 0x03, 0x26, 0x50, 0x76, 0xC5, 0x40,
+    0x5D, 0x99, 0x11, 0x61, 0x3D, 0x2D, 0x99, 0x4F, 0x16, 0xEC, 0x40, 0x5D, 0x95, 0x3D, 0x0B, 0x66,
+    0x32, 0x01, 0xDB, 0xE3, 0x1A, 0xD7, 0x25, 0x73, 0x3C, 0x2C, 0xDE, 0x76, 0x38, 0xE0, 0x2A, 0xD7,
+    0xB1, 0x90, 0x79, 0x33, 0xC7, 0xB7, 0x94, 0x03, 0x2D, 0x76, 0x48, 0x44, 0x36, 0x12, 0xB0, 0x23,
+    0xAE, 0x2B, 0x1B, 0xDA, 0x2E, 0x99, 0x8D, 0xC7, 0x88, 0xDC, 0xCF, 0x60, 0x67, 0x9C, 0x1A, 0x70,
+    0xCB, 0xA7, 0x34, 0x50, 0xD1, 0x4A, 0xBA, 0x17, 0xA0, 0xD5, 0xBF, 0xD3, 0x02, 0x5C, 0xBC, 0xC2,
+    0x6E, 0xC3, 0x80, 0x6C, 0x01, 0x52, 0x9D, 0x00, 0x65, 0x57, 0x4E, 0x98, 0xC9, 0x28, 0x50, 0x36,
+    0xCE, 0x4C, 0x84, 0x74, 0x34, 0x3E, 0x1F, 0x6C, 0x67, 0x07, 0x57, 0xD5, 0x94, 0xCD, 0x9C, 0x04,
+    0xDA, 0xCC, 0xE7, 0x43, 0x1A, 0x8A, 0xAE, 0xEC, 0xF2, 0xA1, 0xA6, 0xA5, 0xFC, 0x83, 0x39, 0x09,
+    0xCC, 0x66, 0x32, 0xDE, 0x78, 0xEB, 0xED, 0x50, 0x36, 0x45, 0x5F, 0x74, 0x01, 0xD7, 0xB9, 0x2F,
+    0xF7, 0xD4, 0xBD, 0x9B, 0xA1, 0x5E, 0x74, 0xF7, 0x5F, 0x53, 0x4A, 0xF2, 0x1C, 0xFD, 0x49, 0xF2,
+    0x02, 0x70, 0x74, 0xFA, 0x15, 0xC8, 0xA5, 0x91, 0x5C, 0x52, 0x93, 0xEA, 0xAB, 0xD7, 0x26, 0xDA,
+    0x0E, 0xD7, 0x14, 0x03, 0xE9, 0x64, 0x02, 0x14, 0x4D, 0x5B, 0xC1, 0x68, 0x3D, 0xFC, 0xA3, 0x64,
+    0x01, 0x28, 0x7B, 0xB6, 0xDE, 0xB6, 0x0D, 0xEA, 0x0F, 0xFB, 0x39, 0x03, 0xB8, 0x01, 0x88, 0x63,
+    0x7C, 0x31, 0x01, 0xA8, 0x07, 0x32, 0x35, 0x40, 0xA9, 0x13, 0xFE, 0x3B, 0x5A, 0x49, 0x43, 0x22,
+    0x29, 0x90, 0x4A, 0x33, 0x50, 0x7F, 0x05, 0x48, 0x46, 0x80, 0xA2, 0x01, 0x92, 0x09, 0xF8, 0xCF,
+    0xEB, 0x6A, 0x63, 0xAA, 0xEA, 0x00, 0x24, 0x5F, 0xDB, 0xA0, 0x47, 0x3B, 0x91, 0x4A, 0xBD, 0x91,
+    0x82, 0x09, 0xE8, 0x8B, 0x01, 0xFB, 0xFD, 0x19, 0x33, 0xB6, 0xF0, 0x82, 0x6B, 0xE2, 0xA8, 0x90,
+    0x8D, 0xEB, 0x68, 0x56, 0x37, 0xE7, 0x28, 0xAA, 0x2A, 0x28, 0x47, 0x30, 0x6A, 0xB8, 0xD2, 0xEA,
+    0x66, 0xC8, 0xA5, 0x85, 0x52, 0x33, 0x5C, 0x3B, 0x01, 0x33, 0x00, 0x13, 0x70, 0x0C, 0x65, 0x5B,
+    0x91, 0xAB, 0x89, 0xCF, 0xAC, 0x8C, 0xC7, 0x6E, 0x77, 0xB5, 0x96, 0xA4, 0x79, 0xDD, 0xEE, 0x6F,
+    0xDE, 0xDB, 0xCF, 0x37, 0x28, 0x3C, 0xF3, 0x6D, 0x0A, 0x4F, 0xB8, 0x4E, 0xE1, 0xB9, 0x75, 0x9D,
+    0xC2, 0xF3, 0xF2, 0xFB, 0x28, 0x3C, 0x8F, 0x42, 0xE1, 0xE1, 0x97, 0xB3, 0xAD, 0xEF, 0x9D, 0x40,
+    0x21, 0x79, 0x28, 0x25, 0xBF, 0x51, 0xC3, 0xC3, 0x76, 0x00, 0x88, 0xCC, 0x5C, 0xDC, 0x66, 0x1D,
+    0x80, 0xE9, 0x00, 0x92, 0x26, 0xD6, 0x48, 0x92, 0x7E, 0x22, 0x49, 0x6F, 0x7D, 0xB5, 0xFD, 0x6A,
+    0x7D, 0x3B, 0x99, 0xB9, 0xE7, 0xB3, 0xD1, 0xBC, 0xD9, 0x15, 0xBD, 0x7D, 0x9A, 0xBA, 0xBA, 0x14,
+    0xC1, 0x98, 0x8D, 0x5B, 0xB7, 0xAE, 0x2B, 0xDE, 0xF1, 0xD4, 0xE3, 0xCB, 0x09, 0x79, 0xE4, 0x33,
+    0xD4, 0x00, 0x0B, 0x51, 0xB6, 0x8D, 0x03, 0x75, 0x09, 0x70, 0x7D, 0x13, 0x94, 0xD2, 0x86, 0x8B,
+    0xBB, 0xAB, 0xEC, 0x76, 0xBF, 0x2D, 0x0D, 0x56, 0x4B, 0xAD, 0x89, 0x56, 0xDD, 0xB5, 0x11, 0x5C,
+    0x87, 0x1A, 0x32, 0x4F, 0x16, 0x60, 0x01, 0x37, 0x50, 0x74, 0x44, 0x86, 0x95, 0x7C, 0xA2, 0x05,
+    0x5C, 0x67, 0x7B, 0x48, 0x96, 0x74, 0x02, 0xAC, 0x77, 0x00, 0xEE, 0x5B, 0x03, 0x90, 0xCE, 0x71,
+    0x60, 0x88, 0x0D, 0x57, 0xFB, 0x73, 0x62, 0x65, 0x1C, 0x3B, 0x22, 0xD2, 0xFE, 0x8D, 0x07, 0x8F,
+    0xEB, 0x2B, 0x40, 0x29, 0xF5, 0x60, 0xA4, 0x79, 0x1B, 0x60, 0xA5, 0xCE, 0xE9, 0xDF, 0x6A, 0xE6,
+    0xDA, 0x92, 0x08, 0x6C, 0x9F, 0xCE, 0x50, 0x93, 0x4D, 0x98, 0x09, 0xEB, 0x29, 0x3A, 0x8A, 0x9E,
+    0x53, 0x70, 0x9D, 0xF1, 0xD0, 0x52, 0x74, 0xB0, 0x30, 0x83, 0x09, 0x99, 0x87, 0xCC, 0x97, 0x15,
+    0xD8, 0x21, 0x00, 0xC5, 0xAB, 0x03, 0xE0, 0xEA, 0x15, 0xAD, 0x01, 0x75, 0x80, 0x59, 0xCE, 0x88,
+    0x65, 0xA4, 0xA5, 0x75, 0x75, 0x60, 0xCF, 0x1E, 0x38, 0xFD, 0xB8, 0x06, 0x48, 0xA5, 0x0E, 0x8E,
+    0xF6, 0x7B, 0xDE, 0x15, 0xAC, 0xD5, 0xBB, 0x80, 0xB5, 0x3E, 0x07, 0xD6, 0xE4, 0x3C, 0x58, 0xFF,
+    0x70, 0x00, 0xD2, 0x70, 0x06, 0xD6, 0x64, 0xAF, 0x7B, 0x2F, 0x42, 0x21, 0xA9, 0x83, 0x7D, 0xFB,
+    0xC6, 0x8B, 0x7F, 0x17, 0x60, 0x6D, 0x60, 0x66, 0x86, 0x34, 0x98, 0x07, 0xC0, 0xDA, 0x03, 0xAE,
+    0x04, 0x38, 0x3D, 0x80, 0x35, 0x92, 0x9B, 0x5C, 0x9A, 0xE0, 0xC2, 0xB5, 0xD7, 0xAB, 0x9F, 0x11,
+    0xAC, 0x17, 0x76, 0x3B, 0x2E, 0xEC, 0xAE, 0x94, 0x52, 0xE3, 0x34, 0x16, 0x5A, 0x28, 0x35, 0x24,
+    0xED, 0x40, 0x3A, 0x83, 0xF3, 0x64, 0x13, 0xD8, 0x09, 0xEB, 0x21, 0x9B, 0x29, 0x3B, 0x48, 0x15,
+    0xDF, 0xA4, 0x66, 0x06, 0xA8, 0xBF, 0x37, 0x01, 0x94, 0x3F, 0x89, 0xDD, 0x33, 0xCA, 0x90, 0x26,
+    0xA2, 0x69, 0xAA, 0x75, 0xA4, 0xEB, 0xE2, 0x35, 0x0F, 0x50, 0x7E, 0x79, 0x04, 0xA8, 0xB3, 0x00,
+    0x30, 0xA7, 0x22, 0x8A, 0x27, 0x0D, 0xE4, 0x9E, 0xBA, 0x87, 0xA2, 0xA3, 0xF4, 0xE0, 0x1A, 0x6C,
+    0x00, 0x41, 0x36, 0x93, 0xEB, 0x0A, 0x99, 0x5E, 0x88, 0x0D, 0x3F, 0xB7, 0x9A, 0x88, 0x64, 0xF6,
+    0xD0, 0x0B, 0xD6, 0x51, 0x79, 0xDD, 0xAD, 0x4A, 0x16, 0xA6, 0xFB, 0x76, 0xEB, 0x70, 0xFC, 0x9B,
+    0x17, 0x77, 0x57, 0x2E, 0xEC, 0xAE, 0x48, 0x5D, 0xAD, 0x57, 0x34, 0xD3, 0x06, 0xDA, 0x8E, 0x1A,
+    0xEA, 0xC6, 0x78, 0x68, 0x2B, 0x57, 0x41, 0x9B, 0x8E, 0x80, 0x8A, 0x06, 0xD0, 0x19, 0x12, 0xAF,
+    0xA3, 0xC0, 0x02, 0xB0, 0xCC, 0x80, 0x7D, 0x65, 0x06, 0x66, 0x13, 0xC0, 0x0E, 0x59, 0x80, 0x96,
+    0x7C, 0x22, 0x1F, 0xB1, 0x77, 0x9F, 0xD0, 0x9C, 0x4A, 0x85, 0xC6, 0x22, 0x32, 0x00, 0x79, 0x24,
+    0x73, 0x1D, 0x40, 0x7D, 0x56, 0x2E, 0x13, 0x49, 0x5A, 0x05, 0xF0, 0x41, 0x2E, 0xEE, 0x76, 0xBB,
+    0x2B, 0x17, 0x76, 0xBB, 0x42, 0x5A, 0x25, 0x11, 0x49, 0x48, 0xDF, 0x99, 0x9F, 0xFE, 0xD1, 0xB5,
+    0x2E, 0x5D, 0xB8, 0x61, 0x82, 0xF1, 0xB4, 0x55, 0x59, 0x89, 0x40, 0xD9, 0x67, 0x9D, 0xEB, 0x8E,
+    0xC9, 0xC7, 0xC4, 0x5B, 0x6F, 0xAB, 0x74, 0xE6, 0x7D, 0x26, 0x24, 0x15, 0x6D, 0x15, 0xF9, 0x91,
+    0xB2, 0x8F, 0x38, 0x9A, 0x8F, 0x91, 0x84, 0xA6, 0xF3, 0x8A, 0xBA, 0xBF, 0xDC, 0x1B, 0x22, 0x57,
+    0xF7, 0x97, 0xB8, 0xC8, 0x29, 0xF7, 0x45, 0xDC, 0xAF, 0x2D, 0x60, 0x36, 0x9E, 0xAA, 0x5D, 0xC7,
+    0xA1, 0x62, 0x15, 0xC6, 0x32, 0xCF, 0x7D, 0x42, 0x1A, 0xC7, 0x1B, 0x5B, 0xB9, 0xDE, 0x48, 0xB3,
+    0xDB, 0xED, 0x76, 0x17, 0x76, 0x57, 0x5B, 0x49, 0x56, 0xA1, 0x95, 0x94, 0xE9, 0xB5, 0x60, 0xFD,
+    0x31, 0x62, 0xDD, 0xBD, 0x6C, 0xFD, 0xE5, 0xB8, 0xBB, 0x84, 0x78, 0xD4, 0xFA, 0x47, 0x89, 0x3C,
+    0xD5, 0x2F, 0xB2, 0x2B, 0xEF, 0xED, 0xF7, 0x7A, 0x2D, 0x8D, 0xF5, 0x88, 0x02, 0xD1, 0xCA, 0xEF,
+    0x2D, 0xF7, 0xED, 0x6E, 0xC7, 0xDD, 0x73, 0x71, 0x77, 0x3D, 0xEE, 0x2E, 0xC5, 0xDD, 0x47, 0x2F,
+    0xEC, 0xAE, 0x26, 0xBB, 0x5D, 0x25, 0x8D, 0x56, 0x7A, 0x42, 0x6A, 0x9C, 0x26, 0xEA, 0x9E, 0x6C,
+    0x86, 0xC8, 0xE4, 0x9B, 0x39, 0x72, 0xF0, 0x23, 0x08, 0x5C, 0x1F, 0x75, 0x5D, 0x15, 0xD6, 0xC7,
+    0x2E, 0xD9, 0x91, 0xC7, 0x4B, 0xE5, 0xB0, 0x72, 0xF3, 0xB1, 0x80, 0xAF, 0x51, 0x77, 0x51, 0x60,
+    0x83, 0xC8, 0x88, 0xC0, 0xB5, 0xE5, 0x8F, 0xFD, 0x39, 0x22, 0xB5, 0xF2, 0xA7, 0x2B, 0xE1, 0xB2,
+    0xEF, 0x7C, 0xE9, 0xDA, 0x52, 0x01, 0x4E, 0xEA, 0xE2, 0xBB, 0x62, 0xD3, 0xDC, 0xFF, 0x58, 0xE4,
+    0x7D, 0xD7, 0xBE, 0x17, 0x9B, 0x35, 0x8E, 0xC4, 0xD8, 0x58, 0xD7, 0x0F, 0x73, 0x71, 0x57, 0x5D,
+    0xDC, 0xFD, 0x13, 0xE9, 0xD3, 0xD2, 0x1F, 0x6A, 0xCA, 0x34, 0x22, 0x92, 0x05, 0x13, 0x30, 0x23,
+    0xD6, 0x63, 0x7B, 0x5C, 0x87, 0xAB, 0x68, 0x61, 0x26, 0x9D, 0x31, 0x23, 0x91, 0x99, 0xCD, 0xF5,
+    0x92, 0x2A, 0x72, 0x69, 0x86, 0x54, 0xFF, 0x6A, 0x3C, 0x13, 0x8B, 0x5D, 0x75, 0xF8, 0xAC, 0x19,
+    0x01, 0xAE, 0xDD, 0xAB, 0xA0, 0x94, 0x2A, 0x36, 0x8A, 0x90, 0x9D, 0xEB, 0x66, 0xEE, 0x0C, 0x99,
+    0xD2, 0xD8, 0xCD, 0x1A, 0x80, 0x5F, 0x27, 0x36, 0xC4, 0x13, 0x52, 0xEF, 0x34, 0x3B, 0x4D, 0x46,
+    0x6A, 0x8A, 0x91, 0x44, 0xD5, 0x0A, 0xEC, 0xB5, 0x01, 0x1E, 0x72, 0x90, 0x8F, 0x09, 0x82, 0xB6,
+    0x9A, 0xAC, 0x27, 0x9F, 0x6C, 0x23, 0xA8, 0xFB, 0xC9, 0x7A, 0x8C, 0xFE, 0xF8, 0x0F, 0x14, 0x85,
+    0x64, 0x1F, 0xE5, 0x99, 0xB3, 0x46, 0xB0, 0x8D, 0x00, 0x26, 0xFB, 0xC0, 0xC1, 0x06, 0xFC, 0xFB,
+    0x0E, 0xAE, 0xDD, 0xAB, 0xD8, 0x6A, 0x54, 0x48, 0xFD, 0xC5, 0x5D, 0x75, 0x71, 0xF7, 0x94, 0xE6,
+    0x5C, 0x4B, 0xAD, 0xA6, 0x56, 0xE5, 0x3A, 0xEA, 0x26, 0x82, 0xD2, 0x75, 0xB8, 0x2A, 0xFE, 0x2C,
+    0xBB, 0xE7, 0x5D, 0x95, 0xCE, 0xD6, 0x8C, 0x58, 0xEF, 0x5D, 0x45, 0x2B, 0x8D, 0xA4, 0x92, 0xAA,
+    0x0D, 0x90, 0xDE, 0x55, 0x60, 0xCD, 0x08, 0x0C, 0xAE, 0xDA, 0xE0, 0x98, 0xB4, 0xAF, 0x41, 0x2A,
+    0x0D, 0xE0, 0xB4, 0x5C, 0xDC, 0x5D, 0x05, 0xB2, 0xD5, 0x8C, 0x10, 0xC9, 0x5F, 0x31, 0xBE, 0x53,
+    0x59, 0x1F, 0x7A, 0x70, 0xB4, 0x3F, 0x89, 0x90, 0xE8, 0x23, 0x56, 0x36, 0xD8, 0x65, 0x77, 0x6D,
+    0x8E, 0x58, 0xED, 0xB7, 0x4E, 0x15, 0xBB, 0xD7, 0xCF, 0x74, 0x70, 0xA4, 0x17, 0x28, 0x97, 0x27,
+    0xA4, 0xBE, 0xD0, 0x5C, 0x2B, 0x18, 0xA9, 0xE3, 0x42, 0x1C, 0x6E, 0x3A, 0xC0, 0xC4, 0x61, 0xA6,
+    0x0D, 0xE7, 0x0A, 0x15, 0x91, 0x3C, 0x16, 0xCD, 0x3C, 0xEC, 0x42, 0xB9, 0x80, 0x09, 0xB5, 0x46,
+    0x50, 0x2B, 0x81, 0xD3, 0xA7, 0xDA, 0x1E, 0x3B, 0x93, 0x87, 0xD8, 0x03, 0x63, 0xC1, 0x3B, 0x5C,
+    0x47, 0xEE, 0xB1, 0x9E, 0x34, 0x5E, 0x68, 0x63, 0x67, 0xFC, 0x29, 0x2F, 0x64, 0x4B, 0x95, 0xE8,
+    0x2B, 0xA5, 0x26, 0x23, 0x7D, 0x56, 0x0B, 0x51, 0x95, 0x9B, 0xB4, 0x77, 0x63, 0xF9, 0x35, 0x13,
+    0x7B, 0xDC, 0x04, 0xD4, 0xAF, 0x25, 0xEA, 0xA1, 0x18, 0x31, 0x8A, 0x24, 0xD3, 0x4E, 0x69, 0xD5,
+    0x36, 0xD0, 0x76, 0xA3, 0xF5, 0x60, 0x42, 0x19, 0xB5, 0x28, 0x77, 0x7C, 0xD9, 0x83, 0x09, 0xEE,
+    0x89, 0x00, 0xB8, 0x3B, 0x4B, 0xFB, 0x67, 0xBB, 0xDD, 0x93, 0xA1, 0x8C, 0x44, 0xAA, 0x6B, 0x25,
+    0x49, 0x81, 0xA7, 0xE6, 0x28, 0x71, 0xAF, 0x5D, 0x7E, 0x05, 0xC4, 0xE1, 0x70, 0xA5, 0xC9, 0x65,
+    0x6C, 0xC0, 0x64, 0x15, 0x11, 0xEC, 0x7A, 0x57, 0x1D, 0x9B, 0x3F, 0xD5, 0x5D, 0x8E, 0xC6, 0x95,
+    0xBE, 0x47, 0xDC, 0x54, 0x1F, 0x59, 0x9F, 0x01, 0xE0, 0xC2, 0xD7, 0xAA, 0x83, 0x48, 0x93, 0xA9,
+    0x27, 0xEA, 0x3B, 0x29, 0xEE, 0xB5, 0x9E, 0x64, 0xA1, 0x1C, 0x2E, 0xD9, 0x01, 0xF7, 0x8A, 0xAF,
+    0xA1, 0xB5, 0xAF, 0x04, 0x92, 0xD9, 0x59, 0x4F, 0x36, 0x4A, 0x92, 0xBE, 0x13, 0x89, 0xEA, 0xBF,
+    0x58, 0xF6, 0xFB, 0x17, 0xB7, 0xFE, 0xDE, 0x1C, 0x1A, 0x2B, 0x16, 0x30, 0x8F, 0x0C, 0xDB, 0x0C,
+    0x15, 0x85, 0xDE, 0x10, 0x94, 0xD2, 0x04, 0x8F, 0x4B, 0x15, 0x24, 0xBF, 0x1F, 0x55, 0xFE, 0xFF,
+    0x70, 0x00, 0x9A, 0xCF, 0xD5, 0x79, 0x82, 0x6B, 0x56, 0x56, 0x26, 0xD2, 0x41, 0xD2, 0x75, 0xBC,
+    0x2C, 0x56, 0x90, 0xAF, 0x87, 0xEF, 0x81, 0xBF, 0xD3, 0x56, 0x58, 0x0E, 0x74, 0x65, 0x7D, 0x41,
+    0x79, 0xA6, 0xCC, 0x4C, 0xFC, 0x39, 0x79, 0x0D, 0x2E, 0xEE, 0x76, 0xB5, 0x96, 0x5A, 0x53, 0xA2,
+    0x6A, 0xED, 0x65, 0x3F, 0xD7, 0xFF, 0x91, 0x5E, 0x73, 0x52, 0xAD, 0x05, 0xF8, 0xC0, 0x66, 0x43,
+    0xCB, 0x87, 0x95, 0xD1, 0xA2, 0x5D, 0xB9, 0x2F, 0xB2, 0x29, 0xD1, 0xA6, 0x8E, 0xD2, 0xCA, 0x75,
+    0xD4, 0xAB, 0xE2, 0x18, 0x2E, 0x54, 0x3C, 0x7C, 0x79, 0x4F, 0xC5, 0x6E, 0x77, 0x85, 0xF7, 0x54,
+    0x46, 0x58, 0xA9, 0xC9, 0x66, 0xDC, 0x84, 0x34, 0x24, 0xEA, 0x8D, 0x7A, 0x5C, 0x8F, 0x9B, 0xB9,
+    0xD8, 0x92, 0x06, 0xF2, 0x1F, 0x35, 0xA4, 0x13, 0x65, 0x47, 0x00, 0x6C, 0x97, 0x06, 0xCA, 0x0A,
+    0xB8, 0x41, 0xD9, 0x65, 0x1E, 0x30, 0x3E, 0x0D, 0x71, 0x50, 0xB2, 0x5D, 0xD9, 0x45, 0x13, 0xC4,
+    0xED, 0xC8, 0xF0, 0x83, 0xF1, 0x65, 0x17, 0x99, 0x87, 0x55, 0x12, 0x89, 0x1A, 0xC0, 0x88, 0x4C,
+    0xF5, 0xBF, 0x3A, 0x98, 0x26, 0xCA, 0xAE, 0x6E, 0x80, 0x74, 0x4E, 0x43, 0x44, 0xBC, 0xBA, 0x2B,
+    0xBB, 0xC2, 0x03, 0xD6, 0xA7, 0x81, 0xB6, 0x82, 0x74, 0xA1, 0xEC, 0xA2, 0xD6, 0xB5, 0x4B, 0x03,
+    0xA5, 0x07, 0x3B, 0x51, 0x76, 0xA8, 0xC1, 0x88, 0x34, 0x90, 0xCD, 0xD0, 0xF6, 0x94, 0x1D, 0x6E,
+    0xA4, 0x9C, 0xC8, 0x75, 0x82, 0x7A, 0xBB, 0xC4, 0x3A, 0xEA, 0x09, 0x35, 0x51, 0x25, 0xBB, 0x3C,
+    0xB6, 0xEA, 0xBA, 0x1E, 0xAB, 0xCE, 0xC0, 0x1B, 0xE2, 0x20, 0x9B, 0x79, 0xDA, 0x28, 0x9A, 0x47,
+    0xE4, 0x2C, 0xEF, 0xB6, 0x5D, 0x2C, 0x7E, 0xC4, 0xD5, 0xE4, 0x4F, 0x1E, 0x02, 0x4F, 0xD7, 0x5C,
+    0xD8, 0x5D, 0xE5, 0x36, 0x6A, 0x9C, 0x06, 0x1B, 0x8C, 0x9A, 0x7A, 0x46, 0xC3, 0x23, 0x75, 0x55,
+    0x74, 0xB9, 0xAF, 0x70, 0xD4, 0x38, 0xE0, 0xB9, 0x24, 0xA4, 0x1E, 0x08, 0x99, 0xB7, 0x15, 0x24,
+    0x63, 0xD1, 0xDD, 0x02, 0x8C, 0xAF, 0xB3, 0x9E, 0xD8, 0x6B, 0xA2, 0x01, 0x47, 0x0B, 0x90, 0x86,
+    0xE2, 0x9B, 0x33, 0x50, 0xF4, 0x75, 0x54, 0x8D, 0x24, 0x21, 0x1B, 0x21, 0x1F, 0x33, 0x9F, 0x7B,
+    0x70, 0x4D, 0xD1, 0x59, 0x8F, 0x09, 0xD4, 0x94, 0x03, 0x6E, 0x48, 0x67, 0x5C, 0x6F, 0x44, 0xAB,
+    0xCA, 0xF5, 0x6E, 0x30, 0x9A, 0x71, 0xC3, 0xE7, 0x01, 0xF8, 0x00, 0x17, 0x77, 0x57, 0xE1, 0xFF,
+    0x2C, 0xA4, 0x26, 0xD1, 0xAB, 0x52, 0x93, 0xCA, 0x67, 0x33, 0x89, 0x02, 0x22, 0xD1, 0x11, 0xAE,
+    0x63, 0x89, 0x66, 0x36, 0xE2, 0x2B, 0x41, 0xB8, 0x8A, 0xA8, 0x49, 0xC3, 0xFA, 0xA2, 0xDB, 0xEC,
+    0x5C, 0x68, 0x1D, 0x59, 0xA5, 0x06, 0xAB, 0x9B, 0x9A, 0x30, 0x81, 0x3C, 0x62, 0xBC, 0xF3, 0xB8,
+    0x0E, 0xB3, 0x60, 0x3D, 0xB4, 0x9D, 0x09, 0x50, 0x6C, 0x2A, 0x5D, 0xD7, 0xC1, 0xA6, 0xD5, 0x35,
+    0x01, 0xAC, 0x3F, 0xD2, 0x0B, 0x98, 0x60, 0xA5, 0x26, 0x59, 0x32, 0xA9, 0x5F, 0x59, 0xE8, 0x48,
+    0x73, 0xCA, 0xE1, 0x9C, 0x3A, 0x65, 0x3C, 0x50, 0x99, 0x67, 0xA2, 0x5A, 0x35, 0x62, 0xF9, 0x7E,
+    0x43, 0xF1, 0x8B, 0xBB, 0x2B, 0x49, 0x68, 0x35, 0xE4, 0x73, 0xAD, 0xA6, 0x98, 0x93, 0x19, 0xF7,
+    0x5F, 0x24, 0x33, 0xB7, 0x49, 0xE6, 0x64, 0x22, 0x99, 0x8D, 0x8F, 0xE6, 0xE5, 0x64, 0xB6, 0x1D,
+    0x89, 0x34, 0x93, 0x48, 0xEA, 0x92, 0xE5, 0x73, 0xF2, 0xC9, 0xAA, 0x5B, 0xCD, 0x42, 0x32, 0x47,
+    0xA5, 0x6A, 0xB2, 0x24, 0x33, 0xC9, 0x92, 0x2E, 0x51, 0x83, 0xCA, 0xD2, 0xCA, 0x27, 0xCB, 0x26,
+    0x88, 0xA6, 0x61, 0xA3, 0x5D, 0xD9, 0xB8, 0x8D, 0xC4, 0x75, 0x07, 0x4F, 0xA9, 0x5A, 0xD5, 0xA3,
+    0xF5, 0x09, 0x5C, 0x88, 0xEA, 0x75, 0x17, 0x15, 0xC2, 0xAB, 0xA9, 0xE1, 0xF1, 0x7B, 0xCF, 0xA8,
+    0x82, 0x22, 0x22, 0xF2, 0x8D, 0x68, 0x3C, 0x98, 0xA2, 0xE9, 0x60, 0x88, 0xB6, 0x85, 0xC6, 0x04,
+    0xE0, 0x76, 0x14, 0x3E, 0x46, 0x5C, 0x07, 0xB6, 0x43, 0x80, 0x8B, 0x44, 0x39, 0xEA, 0xCA, 0x33,
+    0x8F, 0xEB, 0xA0, 0x6C, 0x10, 0x70, 0x1B, 0x13, 0xC0, 0x44, 0xB6, 0xA2, 0xE8, 0x70, 0x1D, 0x9C,
+    0x46, 0xED, 0xBA, 0x8F, 0x4A, 0xF1, 0x0E, 0xEB, 0xD3, 0x4F, 0xCD, 0xE0, 0x3A, 0xFB, 0xD6, 0x00,
+    0xA2, 0x16, 0x3C, 0xAE, 0xFF, 0x55, 0x23, 0x99, 0xF4, 0x63, 0x81, 0x93, 0xFE, 0xA7, 0x13, 0x56,
+    0x9F, 0x86, 0x33, 0xE6, 0xB8, 0x3A, 0x27, 0x83, 0x46, 0x2D, 0xD5, 0x26, 0xC8, 0xF8, 0x83, 0x89,
+    0x7F, 0xB7, 0xDB, 0xED, 0xAE, 0x18, 0x49, 0xEA, 0xF2, 0x38, 0x40, 0xDD, 0x40, 0x90, 0x8C, 0x26,
+    0x40, 0xD6, 0x59, 0x0F, 0x05, 0xAE, 0x83, 0x5B, 0x08, 0x52, 0x6F, 0x02, 0x44, 0x33, 0xCE, 0x31,
+    0xAE, 0x23, 0x19, 0x11, 0xE4, 0x9D, 0x09, 0xE0, 0xB0, 0x1E, 0x26, 0x5C, 0x47, 0xDE, 0x23, 0x2E,
+    0xB7, 0x98, 0x90, 0x68, 0xA4, 0xB8, 0xFB, 0x19, 0x35, 0xB9, 0xF4, 0xD9, 0x09, 0xA7, 0xF0, 0x81,
+    0x83, 0x0C, 0xEA, 0xAA, 0x03, 0x5B, 0x9C, 0xF5, 0x67, 0x7C, 0x72, 0xA4, 0x3F, 0x51, 0x85, 0xF5,
+    0xF7, 0xD2, 0x20, 0x58, 0x0C, 0x46, 0x1A, 0x48, 0x66, 0x6A, 0xCD, 0xAB, 0x8E, 0xF7, 0x4C, 0x61,
+    0xBF, 0x0E, 0xA1, 0xAB, 0xBA, 0x7E, 0x1B, 0x06, 0x22, 0xB1, 0xFA, 0x48, 0xE4, 0x1A, 0xCD, 0x4A,
+    0xB3, 0xDE, 0xF3, 0x02, 0x9B, 0x0A, 0x27, 0x5A, 0x9E, 0x6A, 0xF5, 0xB9, 0xA6, 0x64, 0x81, 0xBA,
+    0x89, 0x26, 0xA2, 0x87, 0x6C, 0x17, 0x70, 0x4D, 0x34, 0x35, 0xAD, 0xDB, 0x65, 0xB7, 0x7B, 0x97,
+    0xFB, 0x67, 0x70, 0x4D, 0xAA, 0x13, 0x5C, 0xE3, 0xE4, 0x71, 0x4D, 0x2B, 0xBF, 0x96, 0x32, 0x9A,
+    0x02, 0xDB, 0x33, 0x56, 0x35, 0x6A, 0xAD, 0x57, 0xF3, 0xD0, 0x04, 0xBC, 0x5F, 0x03, 0x44, 0xF5,
+    0x3C, 0xF9, 0x04, 0x7F, 0xFF, 0xAD, 0xB8, 0xF3, 0x6A, 0xC5, 0xBD, 0x9F, 0x9B, 0xAA, 0xD7, 0xA1,
+    0x7C, 0x65, 0x6D, 0xEE, 0x37, 0xE6, 0x26, 0xEB, 0xD9, 0x8F, 0xAF, 0xB6, 0xA6, 0x86, 0x5F, 0xB1,
+    0x15, 0xF7, 0xAE, 0x91, 0xA8, 0xF5, 0x57, 0x52, 0x57, 0xAE, 0x66, 0x9E, 0xA8, 0x07, 0x88, 0x3D,
+    0x2A, 0x8E, 0xED, 0x79, 0x77, 0xA6, 0xE7, 0x59, 0x29, 0xC0, 0x27, 0x7E, 0x31, 0x09, 0x94, 0x28,
+    0x81, 0x62, 0x3D, 0xF9, 0xB4, 0x69, 0x0A, 0xAC, 0xC7, 0xE8, 0x24, 0x79, 0x27, 0x09, 0xF4, 0xA7,
+    0x97, 0xDD, 0xCE, 0x24, 0xD0, 0x24, 0x32, 0x1E, 0x4E, 0xEA, 0x0F, 0x44, 0xAE, 0xFC, 0xE9, 0xDD,
+    0x98, 0x7E, 0x6A, 0xA9, 0x15, 0x57, 0x45, 0xF9, 0xDF, 0x7A, 0x5C, 0x45, 0x7B, 0xAF, 0x7D, 0x9B,
+    0xD4, 0xCA, 0x99, 0xA8, 0xCA, 0x3B, 0x49, 0xAD, 0x07, 0xCB, 0x4D, 0x73, 0x70, 0x66, 0x2A, 0xAA,
+    0x03, 0x92, 0x44, 0xB5, 0xC4, 0xD7, 0x21, 0xD9, 0x5D, 0x05, 0x76, 0x57, 0xA9, 0xD5, 0x83, 0xD3,
+    0x60, 0xB4, 0x80, 0x51, 0x20, 0x95, 0x8F, 0x1A, 0xEB, 0x42, 0x15, 0x56, 0x15, 0xC9, 0x4F, 0x26,
+    0xF8, 0xC9, 0x04, 0x45, 0xDD, 0x51, 0xD6, 0x0D, 0xE9, 0xFF, 0x17, 0x30, 0x7F, 0x35, 0x41, 0x69,
+    0x7B, 0x8E, 0xCB, 0x0E, 0xE3, 0x45, 0xFE, 0x4A, 0x00, 0x97, 0x7B, 0x42, 0xD1, 0x61, 0xBC, 0xAB,
+    0xEC, 0x1F, 0x04, 0x70, 0x66, 0x4A, 0x7D, 0xD1, 0x61, 0x7C, 0xD1, 0x39, 0x66, 0xB8, 0xC1, 0x9C,
+    0xF5, 0xB6, 0x27, 0x1B, 0xEC, 0x70, 0x2B, 0x9E, 0xA8, 0x6D, 0x63, 0x07, 0xF2, 0xDE, 0xFC, 0x68,
+    0x64, 0x81, 0xDB, 0x94, 0x37, 0xB1, 0x03, 0xB6, 0x4F, 0x34, 0x20, 0x08, 0xD8, 0x99, 0xDC, 0x63,
+    0x3B, 0xDA, 0x8E, 0x16, 0x02, 0xD9, 0xB4, 0x9E, 0x70, 0x15, 0x35, 0x47, 0xCB, 0x95, 0xE4, 0x79,
+    0x8A, 0xE5, 0x33, 0x52, 0x03, 0xA5, 0xD4, 0x6A, 0x64, 0xF3, 0xFF, 0x3B, 0x1B, 0x97, 0x0E, 0x32,
+    0xC9, 0x99, 0xAD, 0xB2, 0xE5, 0x7E, 0x37, 0x88, 0x4D, 0x47, 0x7A, 0x10, 0x25, 0x38, 0xE1, 0xE2,
+    0x0E, 0xD8, 0x5D, 0x71, 0x6A, 0x30, 0xF2, 0x85, 0x3A, 0x32, 0xF5, 0x89, 0x06, 0xEC, 0x42, 0xF2,
+    0x13, 0x4F, 0x71, 0x4A, 0xF2, 0xE3, 0x91, 0xE3, 0x1B, 0x24, 0x3F, 0x0A, 0x5C, 0xBF, 0x41, 0x32,
+    0xCE, 0x4C, 0x37, 0x48, 0xC6, 0x1B, 0x89, 0xBF, 0x41, 0x32, 0x3A, 0x33, 0xDC, 0x20, 0x19, 0xCB,
+    0x3F, 0xEC, 0x6E, 0x90, 0x8C, 0xF6, 0xDB, 0xDD, 0x0D, 0x92, 0x31, 0x7F, 0xAB, 0xBA, 0x41, 0x32,
+    0x66, 0xE2, 0x06, 0xC9, 0x68, 0x66, 0x6E, 0x90, 0x8C, 0x49, 0xE0, 0x06, 0xC9, 0xC8, 0xC8, 0x0D,
+    0xD2, 0xBB, 0x90, 0xB4, 0x27, 0x4E, 0x3D, 0x85, 0x42, 0xAD, 0x9E, 0xAD, 0x6B, 0xAD, 0xD2, 0x8F,
+    0x19, 0xCF, 0x2B, 0x0B, 0xF3, 0x55, 0xED, 0xD4, 0x9C, 0xD7, 0x3E, 0xFD, 0x3A, 0x4E, 0x4B, 0xAD,
+    0xF9, 0x31, 0x9D, 0xD0, 0xF2, 0x8B, 0xFF, 0x27, 0xFA, 0x4A, 0xA9, 0xA5, 0xD6, 0x02, 0x27, 0x7C,
+    0x20, 0xFA, 0x67, 0xB8, 0x0A, 0xB2, 0x11, 0xD7, 0x10, 0x3D, 0x97, 0x20, 0x89, 0x6C, 0x28, 0xA5,
+    0x5E, 0x03, 0xE0, 0xEA, 0xC3, 0x44, 0x89, 0xA3, 0x95, 0xAE, 0xC5, 0xF2, 0x46, 0x6A, 0x97, 0xAC,
+    0x8E, 0x82, 0xB1, 0xDD, 0x56, 0x15, 0x46, 0xFE, 0xE7, 0x51, 0x82, 0xBA, 0x13, 0x00, 0x8A, 0x2F,
+    0x46, 0xE4, 0x8E, 0x8A, 0xFD, 0x3A, 0xF6, 0xD2, 0xDB, 0x71, 0x17, 0xA8, 0x1B, 0x48, 0x23, 0x57,
+    0x64, 0x46, 0xCA, 0x1E, 0x32, 0x4F, 0x31, 0x1C, 0x48, 0x81, 0x8D, 0xCA, 0xD7, 0xF2, 0x8D, 0xFD,
+    0x4B, 0x01, 0x5C, 0x15, 0x9D, 0x03, 0xA2, 0xAF, 0xCC, 0x02, 0x89, 0x62, 0x87, 0x56, 0x95, 0x06,
+    0xA0, 0x6D, 0xB2, 0xB9, 0x22, 0xD5, 0x6B, 0xAD, 0x7C, 0x64, 0xC7, 0x3C, 0xB5, 0x94, 0x34, 0x7C,
+    0x1E, 0xDB, 0x13, 0xB0, 0x03, 0x33, 0xB9, 0x4F, 0x03, 0x66, 0xB9, 0x36, 0x41, 0xAB, 0x1E, 0x2E,
+    0xBC, 0x70, 0x5F, 0x3D, 0xA3, 0xA1, 0x51, 0x23, 0xD9, 0x72, 0x33, 0x60, 0x7D, 0x3A, 0x53, 0xF4,
+    0x2C, 0xD8, 0x8E, 0x85, 0xA3, 0xC8, 0x84, 0x1D, 0x36, 0x47, 0xAD, 0x48, 0x5A, 0x89, 0x5C, 0xF7,
+    0x44, 0x31, 0x46, 0x5F, 0x2B, 0xE1, 0x9A, 0xC3, 0xAF, 0xDE, 0x88, 0xF2, 0xEE, 0x35, 0xBD, 0x61,
+    0x25, 0xB7, 0x18, 0x8D, 0xC5, 0xC8, 0x3F, 0xAB, 0x12, 0xE0, 0xF3, 0xFC, 0x1E, 0x90, 0x2E, 0x89,
+    0x00, 0xA3, 0xF4, 0xDC, 0x2E, 0x09, 0xDB, 0x88, 0xF1, 0x0F, 0xAB, 0x29, 0xD6, 0xEE, 0x60, 0x26,
+    0xF2, 0x90, 0x87, 0xB8, 0xC9, 0xC6, 0x4D, 0x3B, 0xF0, 0xF6, 0xE5, 0x57, 0xD7, 0x14, 0x1B, 0x0F,
+    0x0F, 0xAD, 0x74, 0x50, 0x20, 0xC7, 0xF2, 0xD6, 0xDA, 0xEF, 0x03, 0x60, 0x7E, 0x3C, 0x45, 0xF7,
+    0xA6, 0xE2, 0x8F, 0x87, 0xD8, 0x7B, 0x43, 0xDD, 0x50, 0x02, 0xF9, 0x77, 0x16, 0xF8, 0x4D, 0xC0,
+    0x65, 0xD3, 0xAA, 0x59, 0x2E, 0x86, 0xD5, 0x40, 0xB0, 0x36, 0xD2, 0x1C, 0x19, 0x21, 0xB2, 0x21,
+    0x5B, 0xDA, 0x05, 0x70, 0x14, 0xD2, 0x04, 0xE9, 0x44, 0x2D, 0xF5, 0x60, 0xBB, 0xF5, 0x96, 0x36,
+    0xAA, 0x7D, 0xC8, 0x56, 0x0F, 0x1D, 0xDC, 0x7E, 0xDF, 0x36, 0x11, 0x29, 0x92, 0x05, 0x7E, 0x0D,
+    0xDB, 0x93, 0x4D, 0x70, 0x9D, 0x16, 0x8A, 0x01, 0xE3, 0xCD, 0x08, 0x75, 0x43, 0xD1, 0xB9, 0x86,
+    0x64, 0x81, 0xD3, 0x74, 0xA9, 0x22, 0x4F, 0xD0, 0x6A, 0xC8, 0x25, 0xE9, 0x7B, 0x52, 0xE3, 0xCE,
+    0x74, 0xFF, 0x40, 0xAA, 0x3E, 0xD5, 0x80, 0xD5, 0x92, 0x49, 0x14, 0xF7, 0xDA, 0xFF, 0x67, 0x69,
+    0xBD, 0xF5, 0xA9, 0x7C, 0xBA, 0x64, 0x63, 0x14, 0xEF, 0x02, 0x76, 0x22, 0xF7, 0x8F, 0x11, 0x3D,
+    0x71, 0x41, 0x5C, 0x68, 0x2B, 0xA8, 0xDF, 0x92, 0x7A, 0xAE, 0x49, 0x92, 0xCF, 0xA4, 0xE5, 0x4F,
+    0x2A, 0x72, 0x9D, 0x08, 0xC8, 0x56, 0x0C, 0x0A, 0x91, 0xF3, 0x59, 0x0E, 0x0E, 0x53, 0x75, 0x0F,
+    0x76, 0xA4, 0x5E, 0xE0, 0xD3, 0xFA, 0x97, 0xD2, 0x72, 0xD3, 0x3B, 0x2D, 0x56, 0x9A, 0x8C, 0xEE,
+    0xD2, 0x6A, 0xE4, 0xFD, 0x57, 0xA2, 0x1E, 0xEC, 0x1F, 0x93, 0x56, 0xE4, 0x3D, 0x35, 0x2C, 0xE4,
+    0x9E, 0x7C, 0x4A, 0x96, 0x4D, 0xAD, 0x5F, 0xAB, 0x07, 0x2E, 0xDE, 0xA7, 0xEE, 0x48, 0x76, 0xBB,
+    0xDD, 0xEE, 0x4A, 0x2D, 0x49, 0x7F, 0x28, 0x49, 0x53, 0xA2, 0xFD, 0xBE, 0x6D, 0xAC, 0x27, 0x99,
+    0x10, 0xD8, 0xC6, 0x7A, 0x18, 0x11, 0x5C, 0x58, 0x79, 0x05, 0x9D, 0xB1, 0x0D, 0xF1, 0xE7, 0x3D,
+    0xA9, 0x42, 0xD2, 0x88, 0xDD, 0x9C, 0x95, 0x78, 0xE8, 0xBD, 0x49, 0x65, 0x3D, 0x5C, 0x46, 0x90,
+    0xF5, 0xD6, 0xAF, 0xFD, 0xC7, 0xF6, 0xD7, 0x24, 0x05, 0x27, 0xAD, 0x96, 0xAF, 0x89, 0xE7, 0xF9,
+    0x30, 0x2E, 0x36, 0x4D, 0x8D, 0xEB, 0xAC, 0x4F, 0xF4, 0x47, 0x33, 0x46, 0x82, 0xE4, 0x9F, 0x9F,
+    0x2F, 0x7E, 0x7B, 0x37, 0xEA, 0xAA, 0xCB, 0x7B, 0xED, 0x90, 0x8D, 0xA8, 0x5A, 0x30, 0x53, 0xD1,
+    0xE1, 0xEE, 0x4C, 0xA4, 0xC1, 0x35, 0x14, 0xAF, 0x4A, 0x0A, 0xB5, 0xA4, 0x57, 0xEF, 0xED, 0xF7,
+    0x2F, 0xD6, 0xD5, 0x3A, 0x1C, 0xAE, 0x04, 0x3C, 0x6A, 0xEA, 0x12, 0xF5, 0xBC, 0x2F, 0xD7, 0xBD,
+    0xB6, 0x29, 0xA5, 0x31, 0xCA, 0x11, 0xEF, 0xFF, 0x0A, 0xA4, 0xED, 0x04, 0x11, 0xC3, 0x8C, 0xA4,
+    0x09, 0x3B, 0x73, 0x6D, 0xA1, 0xEC, 0x31, 0x8A, 0xAE, 0xCE, 0xDD, 0x47, 0x37, 0x57, 0x91, 0x55,
+    0x02, 0xB7, 0xE3, 0x99, 0x43, 0x54, 0xB4, 0x9E, 0x98, 0x75, 0x7B, 0x71, 0xB7, 0xDB, 0x3D, 0x15,
+    0x6B, 0xB9, 0x6D, 0xFF, 0x6C, 0xB7, 0x7B, 0x32, 0xB8, 0x06, 0xB2, 0xC9, 0x35, 0x90, 0x8F, 0xAE,
+    0x03, 0xEB, 0x5D, 0x07, 0xC5, 0xE0, 0x7A, 0x70, 0x7D, 0xE1, 0xA1, 0x6D, 0x6C, 0x20, 0x15, 0x99,
+    0xBE, 0x7A, 0x2D, 0x90, 0x44, 0xCC, 0x8E, 0xE6, 0x8F, 0x64, 0x7F, 0x72, 0xC0, 0xC8, 0xD7, 0x30,
+    0xD2, 0x90, 0xE8, 0x4D, 0x75, 0xAE, 0xCA, 0x16, 0xD3, 0xAC, 0x22, 0xF7, 0xA1, 0xA6, 0xDD, 0x2A,
+    0x16, 0x95, 0x77, 0xCE, 0xC1, 0xE4, 0xA5, 0x50, 0x57, 0x94, 0xAF, 0x8E, 0x98, 0xC9, 0x35, 0xD4,
+    0x26, 0x60, 0x87, 0x62, 0xCC, 0x02, 0xB5, 0x44, 0x22, 0x35, 0xF0, 0xFB, 0x15, 0xBC, 0xA7, 0x3A,
+    0xAA, 0xC0, 0xF5, 0xA5, 0x07, 0x37, 0xB8, 0xC3, 0xB6, 0x68, 0x0E, 0xCC, 0xC4, 0x7D, 0xCB, 0xDF,
+    0x27, 0xD0, 0xB5, 0xD4, 0xD8, 0xC9, 0x4E, 0xA8, 0x51, 0x93, 0xFB, 0x4D, 0xEA, 0xB8, 0xBF, 0x3E,
+    0xBF, 0x5C, 0xF0, 0x6E, 0x00, 0x06, 0xCC, 0x6C, 0x56, 0xAB, 0x62, 0x3D, 0xB8, 0x55, 0x7F, 0x79,
+    0x38, 0x55, 0x36, 0x45, 0xC3, 0xDF, 0xB0, 0xBC, 0xC0, 0x85, 0xDD, 0x0E, 0x5E, 0xC0, 0x79, 0xA4,
+    0x89, 0xBA, 0x37, 0x6A, 0xAC, 0x16, 0x8A, 0x19, 0x37, 0x63, 0x66, 0x8C, 0xFA, 0xE4, 0x29, 0x4F,
+    0xD9, 0xD1, 0xFE, 0x53, 0x28, 0x9B, 0x34, 0x44, 0x96, 0x30, 0x50, 0x76, 0xE9, 0x08, 0x64, 0x43,
+    0x1A, 0x95, 0x5B, 0x38, 0xCA, 0x2E, 0xB6, 0x70, 0x48, 0x43, 0x32, 0x45, 0xE5, 0x46, 0xD9, 0x45,
+    0x49, 0xC7, 0xA5, 0x21, 0xAA, 0x12, 0x36, 0xE3, 0x63, 0x54, 0x77, 0x45, 0x17, 0x9D, 0x7B, 0xF5,
+    0x1B, 0x91, 0x5E, 0x2A, 0x0D, 0x91, 0xB2, 0x97, 0x7D, 0xD9, 0xB9, 0x0E, 0xC8, 0x42, 0x1A, 0x92,
+    0x75, 0xE8, 0x29, 0xBB, 0x7C, 0x04, 0xCA, 0x21, 0x8D, 0x9A, 0xAF, 0x2C, 0x50, 0x46, 0xDF, 0x6A,
+    0x35, 0x69, 0xC0, 0x4E, 0xE0, 0x3C, 0x65, 0x47, 0xDD, 0x93, 0xCF, 0xA4, 0x01, 0xA3, 0x2A, 0x55,
+    0x43, 0x7B, 0x17, 0x3B, 0xA3, 0x21, 0xD6, 0x71, 0x74, 0x13, 0x56, 0x6A, 0x12, 0x7D, 0xFF, 0xC5,
+    0x95, 0xB2, 0x9D, 0xE3, 0x4C, 0xDA, 0x28, 0x51, 0x9A, 0x25, 0xC2, 0xD1, 0x4E, 0x36, 0x16, 0xA8,
+    0x2B, 0xBB, 0xBF, 0x09, 0x9A, 0x7F, 0x1F, 0xB4, 0x96, 0xFC, 0x1E, 0xBF, 0x45, 0x22, 0x54, 0xA5,
+    0x4A, 0xD4, 0xA4, 0x4A, 0x54, 0x31, 0xC7, 0xA8, 0x8E, 0xFB, 0x96, 0xBF, 0x9B, 0x50, 0x23, 0xFF,
+    0x40, 0xA8, 0xD1, 0xEA, 0x02, 0x67, 0x07, 0x3B, 0x94, 0x3E, 0xFE, 0x15, 0xBD, 0x1D, 0x1E, 0x28,
+    0xEF, 0xDF, 0x5E, 0x9C, 0x51, 0x9F, 0x6B, 0x81, 0xDF, 0xB9, 0xC2, 0x85, 0xDD, 0x6E, 0x77, 0xA5,
+    0x90, 0x14, 0x0A, 0x49, 0xA1, 0xBC, 0xB7, 0xBF, 0x39, 0x95, 0x0D, 0xC5, 0x50, 0x56, 0xD4, 0x4D,
+    0x09, 0x0B, 0xBF, 0x11, 0x3B, 0xB4, 0xF5, 0x5B, 0xED, 0x23, 0x6F, 0x79, 0x02, 0x99, 0x66, 0x30,
+    0x52, 0x03, 0x89, 0x86, 0xCD, 0xCE, 0x63, 0xA7, 0x8D, 0x62, 0x99, 0x73, 0x9B, 0xDF, 0x84, 0x7C,
+    0xBA, 0x05, 0xD6, 0xAB, 0xA1, 0x1E, 0xDA, 0xE5, 0x29, 0x75, 0xA5, 0xB4, 0x90, 0x49, 0x23, 0x3C,
+    0xF6, 0xB5, 0xC8, 0x37, 0x7D, 0x6A, 0x2B, 0xCA, 0x77, 0xEF, 0x92, 0x4F, 0x25, 0xC9, 0x92, 0x0E,
+    0xD4, 0xCD, 0x87, 0xB0, 0x07, 0x5F, 0xBF, 0x95, 0xB8, 0xE4, 0x7E, 0xB5, 0xB2, 0x38, 0x35, 0xA4,
+    0x52, 0x45, 0x72, 0x6D, 0x01, 0xDC, 0xB8, 0xF2, 0xB1, 0x26, 0xAC, 0x4E, 0xB9, 0xE9, 0xBC, 0x8A,
+    0xEC, 0x69, 0x00, 0xDC, 0x37, 0x3B, 0xB2, 0xC9, 0x91, 0xC8, 0x2C, 0x9F, 0x6A, 0xFB, 0x75, 0x88,
+    0x9B, 0xE0, 0x99, 0x17, 0x56, 0x93, 0x48, 0x13, 0xED, 0x0D, 0xD1, 0xA2, 0x20, 0x55, 0x91, 0x2F,
+    0xB8, 0xF2, 0x4E, 0x3D, 0x22, 0xD9, 0xED, 0x2A, 0x2E, 0xEE, 0xAE, 0xAE, 0xAA, 0x9B, 0x57, 0xA3,
+    0x27, 0xFA, 0x98, 0xA8, 0x82, 0x72, 0xD5, 0xF3, 0x44, 0xA3, 0xEF, 0xE6, 0xA9, 0x60, 0xE7, 0xD5,
+    0xAB, 0x79, 0x75, 0x5C, 0x58, 0x4D, 0xC2, 0x6F, 0xF5, 0x58, 0x8F, 0xFD, 0xE1, 0x0C, 0xC2, 0x84,
+    0xA2, 0xC7, 0x7A, 0x14, 0x9F, 0x75, 0x5D, 0xD1, 0x63, 0x7D, 0xEE, 0x93, 0x19, 0x94, 0x06, 0x8A,
+    0x1E, 0xEB, 0xDB, 0xF8, 0xE6, 0xB2, 0xA3, 0xE8, 0xB1, 0x3F, 0xF1, 0xF1, 0x30, 0x40, 0xD1, 0x63,
+    0xB5, 0x7E, 0xB7, 0x8B, 0x87, 0xE7, 0x8A, 0x51, 0xF4, 0x5C, 0xBB, 0x57, 0x91, 0xE9, 0x79, 0xA7,
+    0x99, 0x5C, 0x7A, 0xF5, 0xE0, 0x6B, 0xBE, 0xDA, 0xCB, 0x56, 0x26, 0x3D, 0x6E, 0x87, 0x77, 0x24,
+    0x06, 0x17, 0x77, 0x57, 0x92, 0xDD, 0x2E, 0xF2, 0x85, 0xB5, 0x9A, 0x4C, 0xD3, 0x99, 0x5A, 0xAF,
+    0x6E, 0x92, 0x99, 0x44, 0x4D, 0x32, 0x93, 0xA9, 0x49, 0x66, 0x8A, 0xB6, 0x49, 0x66, 0x4E, 0x5D,
+    0x93, 0xCC, 0xE9, 0xE4, 0x9A, 0x64, 0xCE, 0x07, 0xD7, 0x24, 0x73, 0x59, 0xB9, 0x26, 0x99, 0x67,
+    0x5C, 0x93, 0x68, 0xC4, 0x35, 0x89, 0x7A, 0x5C, 0x93, 0xA8, 0x3A, 0xA8, 0x07, 0x8F, 0x16, 0xA8,
+    0x5F, 0x73, 0xF2, 0x46, 0x6A, 0xE5, 0x33, 0x2D, 0xF0, 0x18, 0x8F, 0x45, 0x23, 0x5C, 0x1C, 0x14,
+    0xD5, 0xB5, 0x3D, 0x60, 0x43, 0x1C, 0x29, 0x5D, 0x55, 0x56, 0xEF, 0x5C, 0xE6, 0x33, 0x25, 0xA1,
+    0xEE, 0x57, 0x12, 0xA6, 0xCB, 0x01, 0x3E, 0xD6, 0xC7, 0x2E, 0xAC, 0xE8, 0xEA, 0x6A, 0x7D, 0x8C,
+    0xF9, 0x13, 0xD8, 0x78, 0x68, 0x96, 0x78, 0xA8, 0x78, 0xB3, 0xFB, 0xE6, 0x0C, 0xC2, 0xFA, 0xA2,
+    0xC7, 0x7A, 0x13, 0x22, 0xA8, 0xDB, 0xF8, 0xAA, 0xB2, 0x4B, 0x66, 0x50, 0xEE, 0x29, 0x7A, 0xEC,
+    0x5F, 0x45, 0xFE, 0x57, 0xED, 0xDA, 0x4C, 0x5D, 0x3C, 0xF4, 0xF1, 0x30, 0xDC, 0xD7, 0x4C, 0x6B,
+    0xAB, 0xAD, 0x4A, 0x42, 0x73, 0x50, 0x6C, 0x9E, 0x53, 0x12, 0x42, 0x1C, 0xA3, 0xED, 0x68, 0x27,
+    0x28, 0x46, 0x3B, 0x81, 0x7D, 0xF8, 0xA8, 0xFD, 0x77, 0xDD, 0x68, 0xBF, 0xC7, 0x87, 0xCF, 0xDA,
+    0xCC, 0xF9, 0x72, 0x04, 0xDA, 0xAE, 0xEE, 0x80, 0x79, 0x73, 0x1A, 0x7A, 0x88, 0xDD, 0x51, 0xAF,
+    0x45, 0x9C, 0x5C, 0x56, 0x91, 0xAA, 0xC2, 0x2E, 0x55, 0xA1, 0x0A, 0x75, 0x64, 0x22, 0x0F, 0x90,
+    0x89, 0xBA, 0x83, 0x3C, 0x72, 0x06, 0x36, 0x58, 0x0F, 0x94, 0xBE, 0xED, 0x00, 0xF7, 0xBD, 0x05,
+    0x40, 0x5F, 0x1E, 0x01, 0xB3, 0xB8, 0x0E, 0xC8, 0x27, 0x01, 0x94, 0x7F, 0x1D, 0x00, 0xDA, 0x2F,
+    0x8F, 0x40, 0xBA, 0xB8, 0x1E, 0xB0, 0xA3, 0x1A, 0xC0, 0x7D, 0x57, 0x40, 0xA2, 0x2C, 0x00, 0x79,
+    0x1C, 0x21, 0x5D, 0x57, 0x8E, 0x60, 0x16, 0x9C, 0x87, 0xD2, 0x53, 0x8F, 0xA4, 0xAA, 0x68, 0x97,
+    0x5D, 0x3B, 0x1E, 0x54, 0x8D, 0xD1, 0x03, 0xF2, 0x1C, 0x3F, 0x45, 0xD9, 0x15, 0x7D, 0x1C, 0x64,
+    0xE3, 0x88, 0xDB, 0x1E, 0x34, 0x4F, 0x0F, 0x90, 0x92, 0x76, 0x01, 0xA3, 0x68, 0x5C, 0x51, 0x63,
+    0x66, 0xEA, 0xD1, 0x04, 0x8C, 0x92, 0x19, 0x5C, 0xDF, 0x42, 0x3E, 0xB9, 0x86, 0x44, 0x76, 0x00,
+    0xF7, 0xEA, 0x04, 0xF6, 0x87, 0xD1, 0x6D, 0xA3, 0x01, 0x15, 0x1E, 0xDC, 0x9D, 0x00, 0x76, 0x50,
+    0x45, 0xEE, 0x4B, 0x8F, 0x99, 0x8C, 0x30, 0x81, 0xFA, 0xEE, 0xE3, 0xF3, 0xEA, 0x4C, 0x14, 0x7D,
+    0x59, 0x9E, 0x39, 0x79, 0x00, 0xB4, 0x7A, 0x08, 0x68, 0xA7, 0x03, 0x68, 0xB3, 0xD9, 0xCC, 0x80,
+    0x0D, 0x85, 0x07, 0x0A, 0xDF, 0x36, 0x80, 0xFB, 0xDE, 0x1C, 0x41, 0xEB, 0x23, 0xFC, 0xDE, 0xD8,
+    0xEF, 0xF7, 0x37, 0xA7, 0xE8, 0x22, 0xF0, 0x83, 0xB8, 0xDB, 0x2E, 0x75, 0x40, 0x3E, 0xC6, 0x60,
+    0xB1, 0x3B, 0xB1, 0x41, 0xF2, 0x15, 0xB4, 0x63, 0x04, 0xAD, 0x87, 0xF4, 0x3C, 0x68, 0x4D, 0x04,
+    0xAD, 0xDE, 0x0D, 0xB4, 0xEF, 0x00, 0xB0, 0x54, 0x49, 0x58, 0x01, 0x96, 0x4D, 0xAE, 0x02, 0xD9,
+    0x1E, 0xDC, 0xAB, 0x92, 0xF4, 0x43, 0x49, 0x0A, 0xF5, 0x57, 0x77, 0x3B, 0x15, 0xC3, 0x19, 0xC0,
+    0x20, 0x5B, 0x01, 0xB6, 0x90, 0xBE, 0x23, 0xC0, 0xFE, 0x16, 0x30, 0xF8, 0xEF, 0x23, 0x98, 0x7F,
+    0x61, 0x0C, 0xFE, 0x65, 0x35, 0xC8, 0x87, 0xF9, 0x2D, 0x30, 0xC1, 0xCC, 0x50, 0x8E, 0x76, 0x82,
+    0xBA, 0x77, 0x03, 0x9C, 0x72, 0xE3, 0xA1, 0xBA, 0xAE, 0x7F, 0x7D, 0x02, 0x99, 0x34, 0xAF, 0x5E,
+    0x82, 0x46, 0x5F, 0xBD, 0xA6, 0xCA, 0xF6, 0x64, 0xC2, 0x41, 0x26, 0x02, 0x64, 0xB3, 0xF1, 0x60,
+    0xA7, 0xA3, 0x6A, 0x93, 0xC4, 0xD6, 0xC8, 0xA4, 0xC8, 0x32, 0x93, 0x45, 0xF9, 0x4D, 0xD2, 0xB0,
+    0x5A, 0xB3, 0x37, 0x1D, 0x73, 0x94, 0xD8, 0x0E, 0x71, 0x4C, 0x90, 0x4F, 0x39, 0xE0, 0xBA, 0x19,
+    0xD2, 0xC5, 0x04, 0x28, 0xBD, 0x0D, 0xA4, 0xAA, 0xDC, 0xF2, 0x39, 0x8D, 0x6B, 0x2C, 0x53, 0x21,
+    0x9D, 0x40, 0xF2, 0xFB, 0x2B, 0x7F, 0x61, 0x26, 0x13, 0x52, 0x25, 0xAA, 0xDA, 0xAE, 0xEE, 0xED,
+    0xF0, 0x10, 0x2E, 0x90, 0xC7, 0x75, 0x42, 0x2D, 0x51, 0xFF, 0x44, 0xDE, 0x55, 0xF9, 0xF2, 0xDE,
+    0x68, 0x48, 0xCE, 0xC7, 0x43, 0x48, 0x59, 0xB2, 0x7B, 0xDA, 0x1B, 0x29, 0xD0, 0x4A, 0x5C, 0xB8,
+    0xE2, 0xBA, 0x18, 0x35, 0x60, 0xC6, 0xDF, 0x24, 0x09, 0x97, 0x22, 0xC7, 0xD0, 0x7E, 0x66, 0xF9,
+    0x9C, 0x1A, 0x49, 0x4D, 0xAE, 0x25, 0x0A, 0xF8, 0x6C, 0x6A, 0xB5, 0x36, 0xEE, 0x56, 0x1E, 0x3D,
+    0xBA, 0xC2, 0x3D, 0x7C, 0x28, 0xD9, 0x71, 0x61, 0x77, 0xB5, 0xD5, 0x82, 0x53, 0xA8, 0x15, 0x28,
+    0x35, 0x1D, 0xA9, 0x82, 0xB6, 0x42, 0x15, 0x2C, 0x50, 0x77, 0xC4, 0xB6, 0xC7, 0x4C, 0x50, 0x78,
+    0x32, 0x0F, 0x76, 0xC4, 0x0E, 0x90, 0x4D, 0x44, 0x0F, 0x01, 0xCA, 0x66, 0x8D, 0xCD, 0x03, 0x14,
+    0x59, 0xF5, 0xBA, 0x89, 0x63, 0xF9, 0x2B, 0xD1, 0x8C, 0xF1, 0x83, 0xA8, 0x85, 0xFC, 0xC9, 0xAA,
+    0x93, 0xEC, 0xCE, 0x79, 0x57, 0x6F, 0x51, 0x47, 0xB7, 0xCF, 0x39, 0xCE, 0x3E, 0x12, 0x3D, 0x32,
+    0x3F, 0x9E, 0x47, 0xB5, 0x57, 0xBC, 0xDF, 0xC5, 0x1B, 0xCB, 0xC8, 0xE8, 0x1C, 0x9D, 0x9C, 0x57,
+    0x9D, 0x48, 0x1B, 0xD7, 0x67, 0x75, 0x88, 0xD2, 0x7A, 0xD8, 0xE0, 0xF9, 0x0B, 0x85, 0x0A, 0xA4,
+    0x3F, 0x57, 0xA8, 0x40, 0x77, 0xA8, 0x56, 0xAC, 0x4E, 0x0B, 0x7C, 0x21, 0xF7, 0x60, 0xEE, 0xA9,
+    0x02, 0xAB, 0xF1, 0x50, 0xB9, 0x72, 0xAD, 0xD4, 0x6F, 0xF1, 0x81, 0x88, 0xB5, 0x91, 0x3B, 0x6F,
+    0xA2, 0x1E, 0xB2, 0x52, 0xC3, 0x3B, 0x76, 0x8F, 0x7F, 0x58, 0x0D, 0xBA, 0xD0, 0x42, 0x16, 0xB2,
+    0x19, 0x0A, 0x5F, 0x8C, 0xE0, 0x1A, 0xF7, 0x8E, 0xE2, 0xED, 0x6E, 0x57, 0x5D, 0xDC, 0x3D, 0x29,
+    0x21, 0x7D, 0x49, 0x63, 0xD2, 0x4E, 0x59, 0x00, 0x57, 0xE5, 0x23, 0x49, 0xA0, 0x18, 0xB0, 0x03,
+    0x2E, 0xFA, 0xC7, 0x57, 0xE9, 0xB4, 0x26, 0x53, 0x88, 0x3A, 0x01, 0x33, 0x99, 0x11, 0x72, 0x5F,
+    0x74, 0x50, 0x74, 0xB7, 0x01, 0xF7, 0x45, 0x0F, 0xD4, 0x45, 0x03, 0xCC, 0x01, 0x48, 0x35, 0x40,
+    0x0C, 0x8C, 0x8E, 0xC2, 0xD1, 0x16, 0x8D, 0x70, 0x16, 0xE4, 0x5A, 0x36, 0xAB, 0x91, 0x3E, 0xE9,
+    0xCB, 0x0E, 0xEC, 0x9B, 0xD1, 0xE4, 0xD8, 0x1F, 0x22, 0xE7, 0x4E, 0x37, 0x7E, 0xF6, 0xD7, 0x48,
+    0xA3, 0x37, 0x59, 0x51, 0x01, 0xAA, 0xEA, 0x2E, 0x2A, 0xFA, 0x2B, 0xB0, 0x21, 0x9F, 0x81, 0x7A,
+    0x28, 0xA3, 0xBA, 0xB4, 0xAE, 0x80, 0x6F, 0xF0, 0xC9, 0x7F, 0x98, 0x8D, 0xFC, 0x3E, 0x1A, 0x20,
+    0x64, 0x3D, 0x64, 0xA3, 0xEB, 0xC0, 0x7D, 0x73, 0xD9, 0x12, 0x3F, 0xD8, 0xA1, 0x06, 0x6E, 0x98,
+    0x11, 0xD2, 0xC1, 0x56, 0x90, 0xF0, 0xBE, 0xFB, 0x40, 0x10, 0x2D, 0xCF, 0xB5, 0xBC, 0xD5, 0xD4,
+    0xAA, 0x7A, 0x5C, 0x4D, 0xDD, 0x61, 0x46, 0xDA, 0x8A, 0xA2, 0x4B, 0x16, 0x58, 0x30, 0x81, 0xCC,
+    0x93, 0x8D, 0x94, 0xCD, 0x1A, 0x43, 0x1F, 0x5D, 0xD7, 0x5C, 0xE3, 0x2A, 0x68, 0x93, 0x00, 0x49,
+    0xC8, 0xFB, 0x2D, 0x10, 0x3D, 0xFB, 0xE1, 0x04, 0xD8, 0xBF, 0xE8, 0x80, 0x72, 0x01, 0x88, 0xDA,
+    0x2A, 0x35, 0x67, 0x91, 0x28, 0xFE, 0x60, 0x15, 0x4F, 0x57, 0x85, 0x0B, 0x7C, 0x28, 0x0D, 0xC0,
+    0xD2, 0xF6, 0x60, 0x34, 0x1F, 0xE2, 0x47, 0xF2, 0xD7, 0x36, 0xED, 0xD5, 0x0B, 0x80, 0xEB, 0x5C,
+    0x7F, 0xD0, 0x7B, 0xC5, 0x21, 0x2E, 0x9D, 0x92, 0x87, 0x5B, 0x3A, 0xFE, 0x5E, 0x18, 0xD5, 0xCF,
+    0xB9, 0x75, 0x73, 0x66, 0xC7, 0x89, 0xAC, 0x54, 0x1E, 0xF2, 0x00, 0x75, 0xE5, 0x9A, 0x77, 0x92,
+    0xB7, 0xAF, 0x26, 0xBB, 0x5D, 0xAB, 0xBE, 0xD5, 0xBF, 0xD7, 0x94, 0x69, 0x34, 0x61, 0x35, 0x15,
+    0x6C, 0xC6, 0x74, 0xD7, 0xE1, 0xAA, 0x34, 0xAC, 0xB6, 0x27, 0x57, 0xC5, 0x50, 0xA8, 0xE8, 0x51,
+    0x5F, 0x46, 0xCB, 0xD3, 0xBD, 0xFA, 0x61, 0xC6, 0xF4, 0xF8, 0xF3, 0xF1, 0xA5, 0x82, 0x32, 0x5A,
+    0xC4, 0x35, 0x5C, 0xDC, 0xC2, 0x03, 0x97, 0x5A, 0xD2, 0x92, 0x68, 0xFF, 0xD2, 0x8C, 0xE0, 0x6C,
+    0x13, 0xD0, 0xEA, 0xA2, 0x74, 0x1D, 0xC1, 0xA3, 0xF7, 0xDB, 0x92, 0x7E, 0xDE, 0xCD, 0x91, 0xFE,
+    0x12, 0x9C, 0x54, 0x6D, 0x3A, 0x08, 0x55, 0x5B, 0xB4, 0x48, 0x7D, 0xA0, 0x1E, 0xEE, 0xE0, 0x57,
+    0xF5, 0xB1, 0x48, 0x1C, 0xB8, 0xB8, 0xDB, 0xED, 0xD6, 0x80, 0x78, 0x8D, 0xD9, 0xDD, 0xDD, 0x9C,
+    0xCC, 0x94, 0xD4, 0x55, 0xDE, 0x15, 0x7D, 0xE2, 0xB3, 0x91, 0x4F, 0xC6, 0xF0, 0xC9, 0x2A, 0x52,
+    0xA1, 0xB3, 0x78, 0xCA, 0xB7, 0x9D, 0x48, 0xDA, 0xBF, 0xC4, 0x48, 0x3E, 0x8D, 0x6A, 0x81, 0x4D,
+    0xEB, 0x92, 0x6D, 0xA1, 0x94, 0x97, 0x57, 0x43, 0x73, 0xD2, 0x01, 0x3C, 0xCF, 0x0B, 0xAB, 0x8D,
+    0x3D, 0x46, 0x41, 0xE7, 0x9B, 0x8A, 0x36, 0x22, 0xEB, 0xBB, 0xA0, 0xEB, 0x39, 0xA9, 0x7C, 0x15,
+    0xCB, 0x07, 0x36, 0xB9, 0x1C, 0x1B, 0x71, 0xF7, 0xCC, 0x7D, 0x67, 0x73, 0x9C, 0x39, 0x38, 0xD2,
+    0xFC, 0x94, 0x27, 0xEE, 0xFD, 0xC9, 0xC1, 0x8D, 0xA7, 0xA1, 0x88, 0x7E, 0x3C, 0x4D, 0xB2, 0x80,
+    0x3E, 0x75, 0x6D, 0x59, 0x1F, 0x29, 0xC6, 0xF5, 0x91, 0xB6, 0x89, 0x27, 0x4C, 0x58, 0x4F, 0xB8,
+    0xEE, 0x1D, 0x4E, 0x64, 0xD3, 0x7A, 0x42, 0x55, 0x3C, 0x51, 0x0F, 0xC9, 0xC2, 0x91, 0xF6, 0x0A,
+    0xD1, 0xA7, 0x47, 0x0B, 0xAD, 0xE6, 0x5A, 0xBA, 0x7B, 0x5E, 0x60, 0x3F, 0x5B, 0x8A, 0xBE, 0xE8,
+    0xA3, 0x06, 0x36, 0x44, 0x85, 0xAC, 0xCE, 0xE9, 0x67, 0xDF, 0x65, 0xB9, 0x10, 0x95, 0x18, 0xBF,
+    0x1D, 0x4D, 0x4D, 0x3F, 0x92, 0x2A, 0x4A, 0xBD, 0x96, 0xCC, 0xB1, 0x95, 0xEA, 0x0A, 0xA2, 0xB2,
+    0x81, 0x34, 0x44, 0x1E, 0x22, 0x6A, 0x8A, 0x28, 0x3B, 0xEA, 0x9B, 0x77, 0xC9, 0x3D, 0x85, 0xE4,
+    0xD3, 0x40, 0xB6, 0xBC, 0xA4, 0x78, 0xB1, 0xEC, 0xCB, 0x8E, 0xBA, 0x32, 0x53, 0x7C, 0xB2, 0x8D,
+    0x4F, 0x96, 0x4D, 0x4B, 0x32, 0x63, 0x87, 0xB2, 0xA3, 0xAE, 0x72, 0x9F, 0x7B, 0xCA, 0xD7, 0xAF,
+    0x4D, 0xD9, 0x72, 0x45, 0xD2, 0x64, 0x35, 0xB7, 0xD2, 0x10, 0xD3, 0x6F, 0x1C, 0xA2, 0x69, 0xEF,
+    0xEF, 0x2D, 0x37, 0x7F, 0xEA, 0xDE, 0xB2, 0xD3, 0xEE, 0x0A, 0x92, 0x7C, 0xDC, 0xFC, 0x8C, 0xBD,
+    0xE5, 0x4F, 0x56, 0x1F, 0x9D, 0x3A, 0x86, 0xCC, 0xA6, 0xF7, 0x6F, 0x8C, 0x87, 0xEC, 0x29, 0x1F,
+    0xD5, 0x37, 0xE4, 0xAA, 0xA2, 0x46, 0xFC, 0xA7, 0xEB, 0x2D, 0x65, 0x74, 0x50, 0x8C, 0xA1, 0x80,
+    0x0F, 0xEF, 0x3E, 0xED, 0x9F, 0x9E, 0xEF, 0x2D, 0xB6, 0x5A, 0x53, 0x07, 0x8D, 0x31, 0x0C, 0xEA,
+    0xB8, 0x8D, 0x01, 0x96, 0x9B, 0x03, 0xFC, 0x1A, 0x72, 0xD8, 0x6A, 0x41, 0xFA, 0x8E, 0x34, 0xA4,
+    0x5A, 0xB8, 0x36, 0x41, 0x5B, 0x6D, 0x11, 0x87, 0x6E, 0xC0, 0x75, 0x50, 0xF7, 0xD1, 0x04, 0xDE,
+    0x15, 0xFD, 0x21, 0xE0, 0x30, 0xD1, 0x67, 0x63, 0x34, 0x76, 0x7B, 0xCE, 0x3C, 0xBF, 0xC6, 0x1B,
+    0xAE, 0x09, 0x4D, 0xEA, 0x68, 0x2A, 0x8A, 0xBC, 0x43, 0xF9, 0xE5, 0x09, 0x48, 0xA2, 0x48, 0x69,
+    0xFB, 0x95, 0x3B, 0x70, 0xC3, 0x21, 0xDA, 0xB0, 0x86, 0xB6, 0xC3, 0x4C, 0x10, 0x53, 0x09, 0x25,
+    0xAA, 0x72, 0x5D, 0x21, 0x55, 0x22, 0x0D, 0x98, 0x90, 0x4B, 0xCD, 0x96, 0xD5, 0x60, 0x35, 0x46,
+    0xDF, 0x17, 0xFC, 0xB4, 0x2A, 0x9B, 0xDA, 0x06, 0x38, 0x8A, 0x51, 0x27, 0x45, 0xCC, 0x78, 0xF0,
+    0x9E, 0xE7, 0x57, 0x96, 0xF9, 0xBF, 0x96, 0x12, 0xA9, 0x54, 0x9F, 0xAB, 0x2B, 0x3D, 0x45, 0x17,
+    0x23, 0x0D, 0xD3, 0x99, 0x19, 0x72, 0x5F, 0x56, 0xE0, 0x5E, 0x1D, 0xB6, 0x40, 0xC3, 0xD8, 0x0D,
+    0x4A, 0x7F, 0x08, 0x31, 0x5F, 0x66, 0xC0, 0xE5, 0x23, 0xD8, 0xDE, 0x75, 0x98, 0x29, 0xD1, 0x1A,
+    0x66, 0x58, 0xF6, 0xB8, 0xDE, 0xA9, 0x47, 0x99, 0xE6, 0x98, 0x6C, 0x23, 0x8A, 0x60, 0x71, 0xCC,
+    0x8D, 0xBE, 0xF7, 0xF3, 0x81, 0x8B, 0xCE, 0x02, 0xF0, 0x94, 0x0E, 0xE3, 0xAC, 0x3B, 0xF9, 0xC5,
+    0xE3, 0x3F, 0x5D, 0x8C, 0xFF, 0x2C, 0xCE, 0xC7, 0x7F, 0x7E, 0xE4, 0x25, 0xBD, 0xF1, 0x62, 0xB4,
+    0xFF, 0x84, 0xC3, 0x0E, 0x1B, 0x75, 0xA9, 0x3F, 0x53, 0xFC, 0xE7, 0xF4, 0x6E, 0xF1, 0x9F, 0xE1,
+    0x67, 0x89, 0xE3, 0xAC, 0x80, 0x65, 0x82, 0xE4, 0x73, 0xFA, 0xB3, 0x2B, 0xAB, 0x6B, 0xFD, 0xC5,
+    0x6B, 0xDA, 0x01, 0x73, 0x8C, 0xE3, 0x0C, 0x5B, 0x1C, 0x67, 0x3E, 0x98, 0xFB, 0xE2, 0x38, 0xCD,
+    0xB9, 0x38, 0xCE, 0x97, 0xFE, 0xAF, 0xFB, 0x16, 0x1E, 0x7D, 0xE4, 0x0B, 0x1F, 0xBA, 0xFC, 0xAC,
+    0x1D, 0xB2, 0xBE, 0x18, 0xFF, 0xFB, 0xFF, 0xF7, 0x3F, 0xF9, 0x9F, 0x4D, 0xF3, 0xB3, 0xFE, 0x01,
+    0x17, 0x80, 0x67, 0x21, 0x19, 0x62, 0x0C, 0x9D, 0x4D, 0xF7, 0xFB, 0xE0, 0xA4, 0x3B, 0x15, 0xFE,
+    0x13, 0x7C, 0xD2, 0x54, 0xBF, 0xC1, 0x27, 0xB2, 0xC6, 0x54, 0x57, 0xF8, 0x04, 0x98, 0x8A, 0xBF,
+    0xBD, 0x5D, 0xF4, 0xD8, 0x80, 0xB4, 0x87, 0x6F, 0xC0, 0x65, 0xB0, 0x60, 0xEE, 0xED, 0x5F, 0x74,
+    0x52, 0xF7, 0x75, 0x3E, 0x98, 0xF6, 0x49, 0x97, 0x57, 0x1F, 0xE4, 0x63, 0x49, 0xC7, 0x95, 0x0F,
+    0xC6, 0xF1, 0xEE, 0x6F, 0x75, 0xF7, 0xC8, 0xC5, 0x5D, 0x55, 0x6B, 0xA9, 0xB5, 0x38, 0xCD, 0xE7,
+    0x7F, 0x47, 0x64, 0x92, 0x16, 0x49, 0x7A, 0x3D, 0x86, 0xD9, 0x6C, 0x1E, 0x6B, 0x7A, 0x60, 0xB9,
+    0xB7, 0xDF, 0x96, 0x8B, 0x5C, 0xB4, 0x7D, 0x71, 0x67, 0xCC, 0xFC, 0x9C, 0x04, 0x57, 0xD5, 0xBF,
+    0xC2, 0x83, 0x57, 0x9E, 0x4F, 0x9F, 0xDF, 0xA2, 0x35, 0xE2, 0xF2, 0xC6, 0x7E, 0xBF, 0xDF, 0x3F,
+    0xA4, 0xDC, 0xBB, 0xDD, 0x6E, 0x77, 0xF5, 0xA8, 0xD2, 0xA7, 0x65, 0x42, 0xEE, 0xCB, 0xEE, 0xD4,
+    0xF8, 0xA2, 0x09, 0x59, 0xFF, 0x01, 0xC0, 0x3D, 0x21, 0x3B, 0xBA, 0x6E, 0x31, 0x53, 0xE6, 0x6D,
+    0x57, 0x34, 0x8E, 0x63, 0x38, 0xAA, 0x8E, 0xCC, 0x9C, 0x85, 0xD2, 0xBB, 0x41, 0x89, 0x72, 0x6F,
+    0x87, 0x96, 0x25, 0x1F, 0x6C, 0x17, 0x92, 0x50, 0x34, 0xEE, 0x09, 0x6F, 0x86, 0xE7, 0x08, 0x47,
+    0xD5, 0x7B, 0x56, 0xF7, 0xF3, 0x1B, 0x46, 0x66, 0xB1, 0x63, 0xE9, 0x5D, 0xD7, 0x56, 0x4B, 0x12,
+    0xCC, 0x64, 0xC6, 0xCC, 0xDB, 0xDE, 0x76, 0x45, 0x53, 0x34, 0x0E, 0xC7, 0x31, 0xC7, 0x6B, 0x6C,
+    0xEA, 0xD1, 0x6B, 0x6B, 0xC6, 0xA4, 0x03, 0x59, 0xF7, 0xAB, 0x40, 0xE2, 0x48, 0x96, 0xCF, 0xFE,
+    0xDF, 0x73, 0x2B, 0xE9, 0xA6, 0xA4, 0x7F, 0x7F, 0xE2, 0x92, 0x6F, 0x60, 0xBB, 0x55, 0x6C, 0x0B,
+    0x2B, 0x07, 0xF6, 0xD0, 0x13, 0x0F, 0x70, 0x56, 0x54, 0x3F, 0xFF, 0xA7, 0x1E, 0x18, 0x74, 0x08,
+    0x1C, 0x55, 0x8E, 0xFF, 0x46, 0x6F, 0xBD, 0xB5, 0xB4, 0x92, 0x6E, 0xDE, 0x9D, 0xDB, 0xEF, 0xE3,
+    0x78, 0x34, 0x7E, 0xFB, 0xFC, 0x23, 0xE5, 0xB0, 0x3E, 0x72, 0xC5, 0xE8, 0x09, 0x79, 0xCD, 0x4E,
+    0x5F, 0xD6, 0x77, 0xE5, 0xCB, 0x01, 0x78, 0x24, 0x5E, 0xAB, 0x07, 0x32, 0x0D, 0xD4, 0x1A, 0x32,
+    0x69, 0xA8, 0xA5, 0x57, 0xA5, 0x50, 0x6B, 0xCE, 0x34, 0x53, 0xCF, 0x64, 0x73, 0x64, 0xF8, 0x80,
+    0xA3, 0x27, 0x96, 0xFA, 0xC7, 0x72, 0xFD, 0x95, 0xC7, 0x48, 0xFE, 0x17, 0xE1, 0xDE, 0x9A, 0x13,
+    0x69, 0xCC, 0xD4, 0x76, 0x76, 0xBC, 0xCA, 0x05, 0x8A, 0x3B, 0x4B, 0xFD, 0xE3, 0xA5, 0x6C, 0x1E,
+    0xD2, 0xA5, 0x9B, 0x67, 0xC2, 0xA5, 0xEC, 0xEF, 0xAE, 0x4B, 0x9F, 0x7C, 0xD8, 0xCD, 0xE6, 0x57,
+    0xD3, 0xA5, 0xF9, 0x30, 0x9C, 0x92, 0xAA, 0xC9, 0xFF, 0xDB, 0xE1, 0x63, 0x1F, 0x7D, 0xF6, 0x0B,
+    0x1F, 0xFD, 0xD0, 0x95, 0x8F, 0x5E, 0xE0, 0xA3, 0xFC, 0x2D, 0xFF, 0x03, 0x8F, 0x3E, 0x0A, 0x97,
+    0x3E, 0x06, 0x36, 0xAF, 0x30, 0xAF, 0xF4, 0x30, 0x7E, 0xE3, 0x99, 0x7D, 0xF8, 0x58, 0xAB, 0xF0,
+    0xB1, 0xAF, 0xE3, 0xBF, 0xF1, 0x75, 0xF3, 0x4A, 0xFF, 0x75, 0x9B, 0x57, 0x5F, 0xBF, 0xF4, 0x31,
+    0xBE, 0xFE, 0xE8, 0xA3, 0x7C, 0x3D, 0xFA, 0xFF, 0xFE, 0x52, 0x56, 0x00, 0x1E, 0x79, 0x04, 0x9E,
+    0xBD, 0x44, 0x32, 0x78, 0xB2, 0x2F, 0x76, 0xFC, 0x86, 0x85, 0x67, 0xDD, 0xFE, 0x6B, 0xCF, 0x3A,
+    0x2D, 0xBF, 0x61, 0x79, 0x6F, 0xF6, 0xC5, 0xEE, 0xBD, 0xC9, 0xE0, 0xDF, 0xCB, 0xB3, 0x97, 0xDE,
+    0xCB, 0x23, 0x8F, 0xBC, 0x17, 0xF8, 0x65, 0xAE, 0xAB, 0xC0, 0xB8, 0xED, 0xAB, 0xB3, 0x04, 0x08,
+    0x56, 0xD5, 0x41, 0xF3, 0x50, 0xC4, 0xC8, 0x93, 0x78, 0xBE, 0x6F, 0x37, 0xC7, 0x75, 0xF2, 0x3E,
+    0x1F, 0x56, 0xF7, 0x75, 0x8C, 0x27, 0x1C, 0x3C, 0xEE, 0x27, 0xDC, 0x16, 0xD3, 0xC2, 0x29, 0xB6,
+    0x5F, 0xDD, 0xDA, 0x29, 0x2B, 0x33, 0x6E, 0xE1, 0x88, 0x79, 0xCF, 0xBC, 0x7D, 0x2C, 0x9D, 0x70,
+    0x6B, 0x1A, 0x33, 0x38, 0xC5, 0x76, 0xD7, 0x79, 0xA6, 0x82, 0xDF, 0xA7, 0xE8, 0xF2, 0xE1, 0x38,
+    0x51, 0x20, 0xD5, 0x68, 0x26, 0xE3, 0x8B, 0x44, 0xEA, 0x8C, 0x54, 0xD5, 0x6F, 0x8E, 0xB6, 0x9A,
+    0xCD, 0x94, 0x4E, 0xB9, 0xCF, 0x34, 0xE6, 0xDD, 0x6D, 0x6A, 0x02, 0x0B, 0xE5, 0x90, 0xF5, 0x0E,
+    0xDB, 0x9F, 0x46, 0x15, 0xCC, 0x50, 0x74, 0xE9, 0xE8, 0x2A, 0xE3, 0x21, 0xF1, 0xD9, 0xC0, 0xA9,
+    0x8D, 0x11, 0x77, 0x53, 0x3A, 0x51, 0x7E, 0xD1, 0xE3, 0x80, 0x5B, 0x9C, 0x92, 0xF7, 0xB1, 0xF4,
+    0xCF, 0x51, 0x74, 0x66, 0x74, 0x55, 0xE6, 0xC1, 0x91, 0x79, 0x82, 0xED, 0xD3, 0x09, 0xCA, 0x8A,
+    0x99, 0x1B, 0x49, 0x20, 0x80, 0xED, 0x28, 0xBB, 0x1A, 0xD7, 0x9C, 0x82, 0xED, 0x30, 0x52, 0x95,
+    0x49, 0x51, 0xF4, 0x2B, 0x55, 0x51, 0x2F, 0x2B, 0x4F, 0xFD, 0xCF, 0x57, 0xAF, 0x92, 0xFB, 0x55,
+    0x2B, 0x2F, 0xB3, 0x24, 0x8B, 0x09, 0xD9, 0x64, 0xBD, 0x1D, 0xCA, 0xCE, 0xF1, 0xDC, 0x99, 0x06,
+    0xEA, 0x65, 0x3C, 0x4B, 0x1A, 0x92, 0xC5, 0x04, 0x13, 0xB2, 0x29, 0x9B, 0xAC, 0xB7, 0xBE, 0x18,
+    0xEC, 0xE0, 0xBA, 0xB2, 0x73, 0x95, 0xE3, 0x94, 0xE7, 0x08, 0x7C, 0xF2, 0x0C, 0x9F, 0x80, 0x74,
+    0x30, 0x9D, 0x6D, 0xEC, 0x50, 0x76, 0xAE, 0xAA, 0x1B, 0xA5, 0x73, 0x7C, 0x79, 0x31, 0xB8, 0xAE,
+    0x6D, 0x94, 0x2C, 0x26, 0x98, 0xC9, 0xFA, 0xA2, 0x2F, 0x3B, 0x57, 0x2D, 0x84, 0x74, 0xCA, 0x7C,
+    0xD6, 0xDB, 0xAE, 0xAC, 0xDE, 0xCB, 0x47, 0xF9, 0xC2, 0xE1, 0x35, 0x1F, 0xA7, 0xA5, 0xAD, 0x5C,
+    0xE7, 0x7A, 0x3B, 0xE4, 0xDE, 0x4C, 0x04, 0x9E, 0x5B, 0x3B, 0x11, 0x1F, 0xA7, 0xA0, 0xA5, 0xAE,
+    0xDA, 0xAA, 0x6E, 0x5C, 0xE7, 0x3A, 0xD7, 0x17, 0x83, 0x1D, 0xAC, 0xCF, 0x7D, 0x36, 0x9A, 0x29,
+    0x0D, 0x04, 0x66, 0x9E, 0xE3, 0x98, 0x8F, 0xF2, 0x21, 0xCE, 0xBD, 0xB1, 0x58, 0x9F, 0x73, 0xCD,
+    0xE1, 0xC9, 0xAE, 0xEC, 0x5D, 0x5F, 0x0C, 0xD6, 0xDB, 0xC1, 0xFA, 0x7C, 0xCC, 0x7D, 0x36, 0x9A,
+    0x60, 0xA6, 0x34, 0x24, 0xF1, 0x2D, 0xA7, 0x3C, 0xC7, 0x31, 0x8E, 0x8F, 0xF2, 0xA1, 0x33, 0x14,
+    0x6D, 0xD6, 0x31, 0x40, 0x5D, 0x54, 0x19, 0x86, 0xA2, 0x63, 0x4E, 0x02, 0x33, 0x45, 0x77, 0x9B,
+    0x64, 0x22, 0xAD, 0x08, 0xD4, 0x14, 0x7D, 0x3E, 0xA5, 0x0B, 0x6D, 0x97, 0x8F, 0xD4, 0x5D, 0x22,
+    0xCC, 0x84, 0x1D, 0x28, 0x2B, 0xAE, 0x03, 0xFF, 0x18, 0x33, 0xC6, 0x3C, 0x58, 0x2C, 0x64, 0x81,
+    0xD2, 0x27, 0xC2, 0x0D, 0x76, 0x4C, 0x67, 0xDA, 0xAA, 0xE8, 0x22, 0x9A, 0x3E, 0x0A, 0xF0, 0xC8,
+    0xB3, 0x00, 0x97, 0x8E, 0x49, 0x60, 0xB2, 0x95, 0xED, 0xCD, 0x60, 0x7A, 0x3B, 0xE4, 0x0D, 0xA3,
+    0xED, 0x4B, 0xB8, 0x9C, 0x54, 0xB7, 0xA0, 0x20, 0xF5, 0x90, 0x75, 0x59, 0x07, 0x89, 0x2F, 0x00,
+    0x6E, 0x5D, 0x87, 0xAC, 0x2F, 0xC7, 0xBC, 0xB3, 0x3E, 0xEF, 0x8B, 0x3E, 0xF7, 0x76, 0xB0, 0x7D,
+    0xDA, 0x1C, 0x4F, 0x47, 0x15, 0x4C, 0xC7, 0x80, 0x19, 0x6C, 0x03, 0x79, 0x63, 0x7A, 0xF8, 0x38,
+    0x8C, 0x70, 0x2B, 0x6B, 0x2E, 0x93, 0x7A, 0x3B, 0x14, 0x64, 0x9D, 0x1D, 0xB2, 0xAE, 0x20, 0xEB,
+    0x12, 0x7F, 0x1D, 0xE0, 0xFA, 0x27, 0x60, 0x23, 0x66, 0x5C, 0xA8, 0xB8, 0xEA, 0x9A, 0x34, 0xB4,
+    0x55, 0x16, 0x54, 0x65, 0x93, 0xC8, 0x27, 0x91, 0x8F, 0x67, 0x6B, 0xE6, 0x45, 0xE6, 0x97, 0x75,
+    0x3D, 0xBD, 0x6F, 0x35, 0xFE, 0xC6, 0xB9, 0xF5, 0x18, 0xE3, 0x8F, 0x49, 0xFD, 0xA3, 0xB1, 0xDF,
+    0x47, 0xEA, 0x04, 0x8F, 0xBA, 0xCE, 0x84, 0xB6, 0xCB, 0x16, 0x75, 0xD9, 0xD2, 0x76, 0x26, 0x7C,
+    0x00, 0x4E, 0xEE, 0x67, 0xA5, 0xBA, 0x8B, 0x57, 0x0B, 0xFD, 0x58, 0x21, 0x3A, 0xB2, 0x57, 0x5B,
+    0x5A, 0x07, 0xB7, 0xA5, 0xB0, 0xB2, 0xDD, 0x9A, 0xDC, 0x22, 0x7A, 0xF0, 0x56, 0xAB, 0x46, 0x24,
+    0xEF, 0x56, 0x5D, 0x4C, 0xEA, 0x57, 0x11, 0x90, 0x5B, 0xAC, 0x72, 0xE0, 0xF1, 0x16, 0x83, 0x61,
+    0x9B, 0xF3, 0xA7, 0xCB, 0x2D, 0x41, 0x96, 0xED, 0x56, 0x45, 0xA8, 0xF1, 0xDB, 0xE9, 0xC3, 0x97,
+    0x6E, 0x70, 0x9E, 0xC0, 0x92, 0x7C, 0x05, 0x92, 0xAF, 0x90, 0x68, 0x22, 0xD1, 0x84, 0xD3, 0x48,
+    0xB4, 0xB2, 0xF7, 0x46, 0xEA, 0x3E, 0xFE, 0xA4, 0x38, 0x7E, 0x4A, 0x31, 0xA7, 0x60, 0x36, 0xC5,
+    0x57, 0x14, 0x31, 0xAE, 0x8F, 0xDB, 0xF1, 0xFD, 0x66, 0x88, 0x95, 0x71, 0x91, 0x51, 0xC8, 0x06,
+    0x92, 0x05, 0x92, 0x85, 0x4C, 0x3D, 0xB9, 0xBA, 0x52, 0x13, 0xA5, 0xA6, 0x4C, 0x0B, 0x99, 0x16,
+    0xEA, 0x05, 0xEA, 0x05, 0x33, 0x47, 0xCF, 0xA6, 0xF5, 0xC9, 0xD4, 0xC7, 0x97, 0x15, 0x6B, 0x79,
+    0xAB, 0x75, 0x7D, 0x9B, 0xAE, 0x2E, 0xAE, 0xEB, 0xFB, 0x71, 0x1E, 0x9C, 0x8F, 0xB1, 0xE7, 0x8A,
+    0x02, 0x5E, 0x39, 0xC0, 0xE7, 0x89, 0x2B, 0xC0, 0x45, 0xFE, 0x39, 0xE0, 0xFE, 0x40, 0x13, 0x94,
+    0x83, 0xD4, 0x63, 0x47, 0xA7, 0x19, 0x33, 0xE7, 0x5F, 0x8D, 0x39, 0x63, 0x57, 0xB7, 0xE0, 0x18,
+    0xF1, 0x17, 0x05, 0x95, 0xA8, 0x54, 0x58, 0x33, 0x3B, 0x16, 0x5D, 0x3E, 0x40, 0x31, 0xA4, 0x13,
+    0x89, 0x46, 0x4E, 0x29, 0x35, 0x51, 0x36, 0x85, 0x26, 0xF2, 0x21, 0xD3, 0x40, 0x32, 0xA1, 0x0A,
+    0x6E, 0x44, 0x56, 0xAD, 0xC9, 0x3B, 0x30, 0x43, 0xE2, 0x81, 0x89, 0x47, 0xB7, 0x1E, 0x72, 0xB6,
+    0x3C, 0x0A, 0xBC, 0x8F, 0xBA, 0x01, 0xD7, 0x45, 0xB3, 0xA9, 0x0D, 0x90, 0x87, 0x54, 0x90, 0x88,
+    0x0F, 0x00, 0x1F, 0x58, 0xA3, 0xA6, 0x5D, 0xC3, 0x3F, 0x83, 0xB6, 0x32, 0x1A, 0x51, 0x95, 0x6B,
+    0x41, 0xE4, 0x52, 0x23, 0xB2, 0xD7, 0xDB, 0x5E, 0xAC, 0x99, 0x5F, 0x31, 0xD1, 0xFD, 0x20, 0xC4,
+    0xED, 0x02, 0x70, 0x6B, 0x01, 0x08, 0xA7, 0x40, 0x16, 0x4E, 0x21, 0x69, 0xA7, 0x53, 0xA8, 0xE5,
+    0x4F, 0x41, 0xEA, 0x6E, 0x80, 0x66, 0x6E, 0x80, 0x1A, 0x6E, 0xC0, 0x6D, 0x38, 0x8E, 0x9A, 0x05,
+    0xB8, 0x0C, 0x8F, 0x3E, 0x50, 0xE8, 0x47, 0x20, 0xD9, 0x92, 0x35, 0xB4, 0x1D, 0x75, 0x8F, 0x3A,
+    0xEA, 0x9E, 0xB6, 0xC3, 0x75, 0x7C, 0x00, 0xFE, 0x11, 0xF0, 0x4C, 0x45, 0x8A, 0xD3, 0x09, 0xD7,
+    0xAD, 0xD4, 0x97, 0xFF, 0xC3, 0x94, 0x49, 0xFE, 0x32, 0xA9, 0x26, 0x1A, 0x92, 0xCF, 0x9F, 0xF9,
+    0xCE, 0x37, 0x96, 0x63, 0xAE, 0xB3, 0xA4, 0xC1, 0x8C, 0x2B, 0xE5, 0xAD, 0x56, 0x1A, 0x5F, 0xF6,
+    0x75, 0xA3, 0x74, 0x31, 0xE1, 0xFC, 0xF9, 0xD1, 0xFA, 0xB2, 0x73, 0xD5, 0x92, 0x04, 0xE3, 0xF3,
+    0xA1, 0xE8, 0x5C, 0xF5, 0x1C, 0x21, 0x1D, 0xCD, 0x60, 0x9A, 0x9C, 0x0F, 0x6D, 0xA9, 0x60, 0x36,
+    0x1C, 0xD1, 0x88, 0xD3, 0x64, 0x96, 0xA7, 0xC7, 0xA2, 0xB3, 0x7E, 0xA6, 0xB8, 0xE3, 0x71, 0x4F,
+    0x77, 0x2C, 0xA7, 0xA4, 0xF7, 0x26, 0xF2, 0x37, 0x07, 0xDC, 0xCD, 0x8E, 0xB9, 0xC6, 0xFC, 0x30,
+    0x50, 0xDC, 0x99, 0x58, 0xB2, 0xBB, 0xD7, 0x7C, 0x2E, 0x91, 0x6B, 0x20, 0xD9, 0xAC, 0x93, 0xC9,
+    0x14, 0xD5, 0x13, 0x6A, 0xB0, 0x0B, 0xB4, 0x13, 0xD9, 0x8F, 0x07, 0x5C, 0xD1, 0x98, 0xF1, 0x06,
+    0xE5, 0x1F, 0x4C, 0xC9, 0x94, 0x0D, 0xB6, 0x2B, 0x9A, 0x5A, 0x9A, 0x24, 0x0D, 0xBB, 0xA7, 0x7E,
+    0x14, 0xC3, 0xD3, 0x6E, 0xC4, 0x67, 0x93, 0x0A, 0xA3, 0x39, 0xD3, 0x9C, 0x29, 0x64, 0x3D, 0x79,
+    0x47, 0xFE, 0xA7, 0x58, 0x35, 0x56, 0x23, 0x8F, 0x07, 0x62, 0xBC, 0x52, 0x84, 0x7E, 0x1A, 0xB8,
+    0x36, 0xD6, 0xEA, 0xDD, 0x72, 0x88, 0x97, 0x2F, 0x3D, 0xE5, 0x52, 0xD9, 0xBB, 0x9B, 0xDB, 0x50,
+    0xD1, 0x61, 0xB4, 0x50, 0x6B, 0xCE, 0xEF, 0x5E, 0xF3, 0xA7, 0xB8, 0x2F, 0x0D, 0x49, 0x38, 0xC5,
+    0xBE, 0xEA, 0x93, 0xE0, 0xAA, 0xF2, 0x8B, 0xCB, 0xE3, 0xA3, 0xD5, 0x42, 0xA9, 0x8A, 0x8B, 0x50,
+    0x6B, 0x29, 0xA5, 0x6F, 0x49, 0x7F, 0x35, 0xA4, 0xE3, 0x37, 0x92, 0xE9, 0x83, 0x04, 0xB8, 0x0D,
+    0x35, 0x38, 0x28, 0x3A, 0x6C, 0x8F, 0xF1, 0xA4, 0x13, 0x84, 0x78, 0xAA, 0xC1, 0xF4, 0x87, 0x66,
+    0xAF, 0x67, 0x5A, 0xF5, 0x75, 0x1A, 0x1C, 0xCE, 0x76, 0xF6, 0x95, 0x29, 0xF3, 0xEE, 0xCF, 0xBD,
+    0x91, 0xA7, 0x9D, 0x59, 0xDA, 0x7E, 0x4E, 0xC3, 0x0D, 0xCA, 0x9B, 0x55, 0xF6, 0xE6, 0x90, 0xFE,
+    0x68, 0x4E, 0x42, 0xA9, 0x39, 0xD5, 0xC4, 0x85, 0x2B, 0x5B, 0xE2, 0x3D, 0xA9, 0x6B, 0x9F, 0x0C,
+    0x0E, 0xF7, 0x74, 0x97, 0xBF, 0x39, 0x24, 0x73, 0xA0, 0x76, 0x55, 0xF1, 0xAD, 0xE5, 0xE9, 0xA1,
+    0xD5, 0x98, 0x29, 0x26, 0xF3, 0xA8, 0x2B, 0xEA, 0x26, 0x51, 0x53, 0xAA, 0xB1, 0xAA, 0xB8, 0x0A,
+    0x54, 0x57, 0xA9, 0xBF, 0x25, 0x24, 0x75, 0xC5, 0x68, 0xFB, 0xFC, 0x5D, 0xFE, 0xCA, 0xA9, 0x9C,
+    0xDB, 0xE0, 0xE6, 0xB3, 0x76, 0x7F, 0x8D, 0x52, 0x93, 0x59, 0x6E, 0x8E, 0x45, 0x6F, 0xFD, 0x72,
+    0xD6, 0xEE, 0xED, 0xA1, 0xDD, 0xCB, 0x9B, 0x0D, 0x73, 0x8D, 0xF9, 0xD1, 0xDA, 0xEE, 0xF9, 0x54,
+    0x78, 0xFB, 0xB6, 0x76, 0x7F, 0x99, 0xD6, 0x97, 0x6A, 0xEA, 0x85, 0x74, 0x22, 0x1F, 0x28, 0x1B,
+    0x4E, 0x1F, 0xFC, 0x59, 0xFF, 0xA9, 0xD3, 0xDD, 0xD5, 0x97, 0xED, 0x71, 0x91, 0x6B, 0x4E, 0x97,
+    0x6B, 0xDE, 0x51, 0x67, 0x83, 0x19, 0x8F, 0x37, 0x5A, 0x18, 0xA3, 0x1A, 0xED, 0x80, 0x99, 0xA2,
+    0x19, 0xAC, 0x5A, 0xF3, 0x6A, 0x86, 0x5A, 0xBA, 0xB3, 0x06, 0x53, 0xB4, 0x53, 0x22, 0x75, 0xCB,
+    0x93, 0xE3, 0x65, 0x4E, 0x8F, 0x28, 0x2B, 0x8A, 0x8E, 0xB2, 0x4F, 0xDA, 0x1E, 0x2D, 0x7C, 0xE4,
+    0x66, 0x4F, 0x1A, 0x0E, 0xAD, 0x36, 0x70, 0xCD, 0xD7, 0xF2, 0x56, 0xFD, 0x21, 0x4D, 0x64, 0x32,
+    0x45, 0x6B, 0xBC, 0x1A, 0xF2, 0x05, 0xEA, 0x09, 0x13, 0xD1, 0x34, 0x5D, 0xD1, 0x34, 0xDC, 0x87,
+    0xA6, 0xDF, 0xDF, 0x3D, 0xF5, 0xA3, 0xEA, 0x3C, 0x9A, 0xA6, 0x27, 0xA4, 0xFB, 0xAF, 0x65, 0x11,
+    0x53, 0x23, 0x9A, 0xF6, 0x1B, 0x9A, 0x5E, 0x3B, 0x8F, 0xA6, 0xA7, 0x24, 0x81, 0x62, 0xAA, 0x35,
+    0xD4, 0xAA, 0xD6, 0xA6, 0xA6, 0xF4, 0x94, 0xAA, 0xEC, 0x7C, 0x1F, 0x9A, 0xDE, 0xC5, 0x29, 0x64,
+    0xF7, 0x5A, 0x7F, 0x4A, 0x7D, 0x40, 0x53, 0x82, 0xAB, 0xCA, 0x3B, 0x73, 0x3E, 0x5A, 0x2D, 0x38,
+    0x55, 0x5C, 0xAC, 0x78, 0x66, 0xBF, 0x3F, 0xA0, 0xE9, 0xF4, 0x8D, 0x24, 0x6C, 0x68, 0xEA, 0xC0,
+    0x55, 0xEF, 0x82, 0xA6, 0xEB, 0xC7, 0xEB, 0x89, 0x56, 0x7D, 0xFD, 0x5F, 0x86, 0x72, 0x45, 0x53,
+    0xE3, 0xDD, 0xAB, 0x3E, 0x8B, 0x68, 0xAA, 0xB6, 0x5F, 0x4C, 0xB8, 0x81, 0x8B, 0x68, 0x7A, 0x77,
+    0x4E, 0x82, 0xD3, 0x9C, 0x6A, 0xDE, 0xD0, 0xB4, 0x1E, 0x91, 0xBA, 0xF6, 0x8F, 0xA6, 0x07, 0xD0,
+    0xF4, 0xEE, 0x53, 0x83, 0x34, 0x65, 0x0A, 0x3C, 0xD2, 0x82, 0xAB, 0xA8, 0x1B, 0xDA, 0xEE, 0xF1,
+    0x03, 0x9A, 0xD6, 0x92, 0xEE, 0x49, 0xD2, 0xBF, 0x6D, 0x25, 0x75, 0xAE, 0xA1, 0x66, 0x81, 0x60,
+    0x26, 0xCC, 0x60, 0x07, 0xF2, 0x68, 0x6C, 0x5A, 0xB6, 0xF8, 0x3A, 0x1B, 0xE3, 0x8A, 0xA3, 0x26,
+    0xBA, 0x33, 0xD2, 0xB2, 0x9E, 0x5A, 0xEF, 0x4A, 0x5E, 0x5A, 0x5E, 0x24, 0x97, 0x3C, 0x8F, 0xB5,
+    0x6F, 0x34, 0x6F, 0x7B, 0x30, 0x69, 0xDF, 0xA8, 0xA8, 0x25, 0xD2, 0xCD, 0xA3, 0xF2, 0x02, 0x40,
+    0x1B, 0x9D, 0x7F, 0x3C, 0xE8, 0x8F, 0x16, 0x68, 0xA3, 0x95, 0x2A, 0xF3, 0x14, 0x1D, 0x13, 0x76,
+    0xE0, 0x93, 0x6B, 0x40, 0x67, 0x38, 0x58, 0x77, 0xCA, 0xEE, 0x02, 0x99, 0xA4, 0x2E, 0x8D, 0x0A,
+    0xF1, 0x65, 0x33, 0x51, 0xBD, 0xF7, 0xE6, 0x3D, 0x55, 0x99, 0xA4, 0x2E, 0xF9, 0x97, 0xF3, 0xEE,
+    0xCA, 0x9A, 0xB1, 0xDE, 0x55, 0x1B, 0xCB, 0x90, 0x0F, 0xAB, 0x45, 0xEB, 0x11, 0x27, 0x49, 0x56,
+    0x92, 0x5E, 0x59, 0x5E, 0x92, 0x86, 0xCB, 0xF0, 0xB9, 0x93, 0x73, 0x51, 0x79, 0x8F, 0x4B, 0x4B,
+    0x75, 0xA6, 0x9C, 0x09, 0x9B, 0x17, 0xCF, 0xDD, 0xCF, 0x6D, 0xD6, 0x8A, 0x64, 0x59, 0x53, 0x9D,
+    0x44, 0xEF, 0xFE, 0x2D, 0xE8, 0xA7, 0x18, 0x0E, 0xD9, 0x60, 0xA3, 0xDB, 0xC3, 0xC9, 0x16, 0xA2,
+    0x3D, 0xAF, 0x71, 0x94, 0x75, 0x83, 0xAB, 0x8E, 0xB7, 0x9B, 0xB7, 0x24, 0x1F, 0xD9, 0x84, 0xF5,
+    0x8F, 0xDF, 0x7B, 0x91, 0xF6, 0xB5, 0x64, 0xC1, 0x7A, 0x49, 0x89, 0xD4, 0xD4, 0xCD, 0xB5, 0xB1,
+    0x94, 0xFE, 0x60, 0xCE, 0x86, 0x42, 0x1A, 0x29, 0x1B, 0x6E, 0xF3, 0x8D, 0x4C, 0x1A, 0xC8, 0x07,
+    0x5C, 0xF5, 0x8F, 0x13, 0x7D, 0x15, 0xD2, 0x89, 0xDC, 0xAF, 0xC1, 0x6A, 0xA7, 0x24, 0x3A, 0x89,
+    0xEA, 0xE8, 0xB2, 0xA1, 0x54, 0x95, 0x4D, 0xB1, 0xE6, 0x89, 0x42, 0xB2, 0xAC, 0x36, 0xD6, 0x23,
+    0x35, 0xEB, 0xCD, 0x90, 0xFB, 0xED, 0xE6, 0x2F, 0x10, 0x5D, 0xF0, 0x73, 0xCF, 0x65, 0xEA, 0x4C,
+    0x2F, 0x40, 0xB2, 0x24, 0xB6, 0x71, 0x4F, 0x4B, 0x1D, 0x38, 0x7D, 0x4F, 0xFA, 0xB6, 0x34, 0x40,
+    0xA6, 0x41, 0x5B, 0xEE, 0xDE, 0x8B, 0x55, 0xB2, 0x03, 0x48, 0xAE, 0xC4, 0xBC, 0x3A, 0x15, 0xB4,
+    0x31, 0x99, 0xC5, 0x5B, 0x0B, 0xA8, 0x4F, 0x47, 0xEC, 0x44, 0xDE, 0xD3, 0x36, 0x94, 0x98, 0x00,
+    0x5F, 0x60, 0x4B, 0x9A, 0xCE, 0x9A, 0x07, 0x3A, 0xC6, 0x61, 0x95, 0xD2, 0x7D, 0x79, 0x8E, 0xA3,
+    0x39, 0x0A, 0x27, 0xCD, 0xF0, 0xE4, 0xB2, 0xBB, 0xB2, 0xE5, 0x17, 0x8E, 0xCA, 0xF6, 0xE8, 0xB6,
+    0xD0, 0x36, 0x07, 0x73, 0x72, 0xAA, 0x9E, 0x0F, 0x90, 0x6A, 0x59, 0x43, 0x84, 0x1B, 0x68, 0x35,
+    0x02, 0xEF, 0xDF, 0x9C, 0xFC, 0x93, 0xE1, 0x80, 0x44, 0xB6, 0x3B, 0x78, 0x19, 0x44, 0xCB, 0xFC,
+    0x6E, 0xF7, 0xB9, 0xFD, 0x1F, 0x4B, 0x92, 0x5A, 0x49, 0xFA, 0xAB, 0x11, 0x78, 0x5F, 0xFE, 0x40,
+    0x6A, 0x31, 0x1F, 0x63, 0x48, 0xEF, 0x5B, 0x4C, 0x17, 0x7D, 0xA2, 0xEA, 0x99, 0x44, 0xAA, 0xB2,
+    0xBF, 0xFE, 0x76, 0x5F, 0xDC, 0xB9, 0x33, 0x3A, 0xD3, 0x85, 0x0F, 0x9A, 0xEE, 0x13, 0x98, 0x2E,
+    0xDE, 0x93, 0x6D, 0x6B, 0xFF, 0xB3, 0xAD, 0xDB, 0xF2, 0x8D, 0x73, 0xD9, 0xCE, 0xCE, 0x9C, 0x03,
+    0x8C, 0x7F, 0xE6, 0x6B, 0xBB, 0xDD, 0xD3, 0xDF, 0x3E, 0xE3, 0xD4, 0xBF, 0x5F, 0xAD, 0x8C, 0x72,
+    0x64, 0x92, 0xB7, 0x5C, 0x2C, 0x87, 0xC4, 0x0E, 0xE7, 0xCB, 0xFE, 0xB3, 0x96, 0x65, 0xAB, 0xC3,
+    0x5A, 0xA7, 0x8F, 0x99, 0xEE, 0x59, 0xF7, 0xC4, 0x37, 0x83, 0xBD, 0xF3, 0xAA, 0x37, 0x3F, 0xFE,
+    0x8B, 0x0E, 0x09, 0x5C, 0x58, 0xD3, 0xFD, 0x45, 0x14, 0xA9, 0x20, 0xAF, 0x92, 0x01, 0xCA, 0xC6,
+    0x4C, 0x70, 0x0A, 0xB7, 0x89, 0xD2, 0x75, 0x36, 0x40, 0xDE, 0x17, 0x7F, 0xB6, 0xDB, 0x3D, 0x39,
+    0x9E, 0x0F, 0xDC, 0x89, 0xFA, 0x3D, 0xE3, 0xC1, 0x76, 0x49, 0xA4, 0x98, 0x35, 0x04, 0x28, 0x3A,
+    0x33, 0x42, 0x06, 0x07, 0xA8, 0x24, 0x55, 0xEC, 0xD7, 0xE5, 0x04, 0xED, 0x42, 0xFA, 0x93, 0xB7,
+    0x9A, 0xFC, 0x07, 0xDF, 0x1A, 0xDC, 0x17, 0x5F, 0x09, 0xC7, 0xA6, 0xBB, 0xF5, 0x6B, 0xA6, 0xFB,
+    0xCD, 0x03, 0xFC, 0xDF, 0x61, 0xFD, 0xA0, 0xE9, 0x3E, 0xE1, 0x4C, 0x17, 0x8A, 0x3B, 0x77, 0xC6,
+    0xEC, 0xAF, 0xBF, 0xDD, 0x27, 0x52, 0x45, 0x3D, 0xC7, 0x44, 0x29, 0xE7, 0xE1, 0x9F, 0xC5, 0x1C,
+    0x51, 0xD4, 0x33, 0xA9, 0xD4, 0xE4, 0x3F, 0xF8, 0xD6, 0x50, 0x7E, 0xF1, 0x95, 0xC9, 0x99, 0x2E,
+    0xBC, 0xD3, 0x77, 0x7E, 0xCD, 0x74, 0xBF, 0x79, 0x6C, 0xBA, 0x5B, 0xE5, 0x17, 0x5F, 0x99, 0xF2,
+    0x1F, 0x7C, 0x6B, 0x48, 0x7F, 0xF2, 0x56, 0x43, 0xBB, 0xC4, 0xF2, 0x66, 0x3D, 0xFB, 0x97, 0xDE,
+    0xD8, 0x6F, 0xCD, 0xC6, 0x59, 0x1E, 0x83, 0x6D, 0xBD, 0x7D, 0x6E, 0xBD, 0x75, 0x58, 0x8F, 0xB8,
+    0x45, 0xD1, 0xDC, 0xA2, 0xE6, 0x16, 0x81, 0x5B, 0xC6, 0x73, 0xCB, 0x76, 0xDC, 0x72, 0x71, 0x3C,
+    0x0E, 0x6E, 0xBF, 0x7F, 0xD1, 0x76, 0xAB, 0xED, 0x7E, 0x5E, 0xF1, 0x37, 0xBA, 0x7B, 0xB0, 0xE1,
+    0xFF, 0x8D, 0x77, 0x58, 0x8F, 0x0F, 0xEB, 0x09, 0xC7, 0xE9, 0xC8, 0x31, 0x33, 0xC7, 0x38, 0x8E,
+    0xB1, 0xDD, 0x65, 0x8C, 0x77, 0xB1, 0x8D, 0xE6, 0x8F, 0xEC, 0x5F, 0x0A, 0x11, 0xA9, 0x8A, 0x0E,
+    0xEA, 0x48, 0x9F, 0x13, 0x7F, 0x90, 0x76, 0x3E, 0xC2, 0x99, 0x41, 0xFE, 0xD7, 0xE1, 0x18, 0x07,
+    0xC7, 0xCC, 0x70, 0x6C, 0x3C, 0x1C, 0xDB, 0x0E, 0x8E, 0x5D, 0x05, 0xC7, 0xDA, 0x54, 0xF9, 0xF3,
+    0x19, 0x9D, 0x3E, 0xDF, 0x2D, 0x1F, 0xD2, 0xDD, 0xF8, 0xC4, 0xDB, 0x3A, 0xF0, 0xB4, 0xC5, 0x14,
+    0x45, 0x92, 0xFE, 0xD7, 0xF7, 0xF6, 0xFB, 0xFD, 0xD7, 0x6E, 0x9D, 0xA5, 0x58, 0x29, 0x25, 0x69,
+    0x68, 0x25, 0xC9, 0xDC, 0x7B, 0x49, 0x1A, 0xA2, 0xC6, 0xEA, 0x5C, 0xAE, 0x93, 0xF4, 0x2C, 0x07,
+    0x8B, 0xEB, 0xC0, 0x0A, 0x8C, 0x0F, 0x20, 0xEB, 0x71, 0x5E, 0x5D, 0xD1, 0x5A, 0x99, 0xBF, 0xF6,
+    0x21, 0xFC, 0x47, 0xCE, 0xDE, 0x89, 0x97, 0x9C, 0xED, 0x7E, 0xB6, 0x1F, 0xE9, 0xC9, 0xEF, 0x9D,
+    0x31, 0xF7, 0x0F, 0xE4, 0x20, 0xF4, 0x56, 0x92, 0x3A, 0x49, 0xD2, 0xD1, 0x7E, 0x1F, 0xE3, 0x61,
+    0xD7, 0xCC, 0x10, 0x37, 0x5A, 0x49, 0xFA, 0xF2, 0x5A, 0x8B, 0x65, 0x7F, 0x36, 0x14, 0x16, 0x67,
+    0x40, 0xF8, 0x35, 0xE0, 0x38, 0xEF, 0x7E, 0xBE, 0xC2, 0x25, 0xDF, 0xF3, 0xE1, 0x0B, 0xAE, 0xB6,
+    0x7F, 0xD1, 0xC9, 0xCB, 0x1B, 0xD9, 0x10, 0x45, 0xB2, 0xF2, 0xE9, 0x06, 0xDA, 0x61, 0xF5, 0xCC,
+    0x39, 0x4B, 0x1E, 0x96, 0x36, 0x69, 0x03, 0x79, 0x9F, 0x0D, 0x50, 0x36, 0xE9, 0x04, 0xB7, 0xE1,
+    0x06, 0xA9, 0xA2, 0xE3, 0xA4, 0xA4, 0xA1, 0xDC, 0xEF, 0xF7, 0xFB, 0xE9, 0x39, 0x80, 0xE7, 0x8E,
+    0x01, 0x6E, 0x15, 0x92, 0x34, 0x66, 0x92, 0xD4, 0x27, 0xCB, 0x7E, 0xDF, 0x56, 0xAB, 0xCC, 0xB6,
+    0xF6, 0xEA, 0x3E, 0xEB, 0x21, 0xA9, 0x92, 0x2A, 0x46, 0x9F, 0x5E, 0x78, 0x22, 0xE6, 0x07, 0x2A,
+    0x23, 0x8B, 0x21, 0x20, 0xF3, 0x76, 0x8C, 0x3E, 0x5C, 0x1D, 0xD8, 0xDE, 0x04, 0x48, 0x03, 0xE5,
+    0x00, 0xAE, 0x4A, 0x04, 0x99, 0x8F, 0xA6, 0xA1, 0xE8, 0x10, 0xDF, 0x61, 0xB4, 0x7F, 0x29, 0xB0,
+    0x7A, 0xBB, 0x24, 0x8A, 0xDE, 0x5A, 0x9E, 0x53, 0xA0, 0x6D, 0x6C, 0x07, 0x71, 0x5A, 0x12, 0x5C,
+    0xE7, 0x2A, 0x48, 0x16, 0x13, 0x93, 0x64, 0xDD, 0x06, 0x68, 0x3F, 0xDB, 0x01, 0xE6, 0xEE, 0x74,
+    0xE6, 0x6B, 0x95, 0xAC, 0x59, 0xA7, 0xE7, 0x73, 0xE9, 0x61, 0xD6, 0x54, 0x03, 0x8F, 0x1E, 0x38,
+    0x9A, 0xC7, 0xD5, 0x93, 0x4A, 0x9E, 0xE2, 0xCF, 0xEA, 0x81, 0x2F, 0xC4, 0xFC, 0xF7, 0x31, 0x3C,
+    0x6A, 0x33, 0xBF, 0xC6, 0x1C, 0xD1, 0x03, 0x5C, 0x75, 0x0D, 0x75, 0x0C, 0xB4, 0x9A, 0x50, 0xD5,
+    0x0E, 0x76, 0xA0, 0x6E, 0x16, 0x58, 0x32, 0x8F, 0x19, 0x5D, 0x83, 0xFD, 0x66, 0x80, 0x3A, 0xF7,
+    0x31, 0x4E, 0xD5, 0xF6, 0x0B, 0x38, 0x33, 0x91, 0x06, 0x3B, 0x60, 0x3B, 0xD7, 0x70, 0x8A, 0xC8,
+    0x7C, 0x3A, 0x53, 0x57, 0x66, 0x79, 0x6A, 0x24, 0x93, 0x2A, 0x32, 0x0D, 0x44, 0xEE, 0xF2, 0xE2,
+    0x6E, 0xB7, 0x33, 0x1B, 0x61, 0xFD, 0x9E, 0xF6, 0x2F, 0x1D, 0x82, 0x7E, 0xDE, 0xED, 0x47, 0xA1,
+    0x7D, 0xFB, 0x5D, 0x49, 0x73, 0xA9, 0xB3, 0xFC, 0x1E, 0x7F, 0xE3, 0x53, 0xF5, 0xEA, 0x31, 0x30,
+    0xD7, 0x3A, 0x70, 0x07, 0x8F, 0xC0, 0xD1, 0xE9, 0x09, 0x97, 0xA1, 0x95, 0xAA, 0xE8, 0x26, 0xFC,
+    0xE3, 0x89, 0x72, 0xD9, 0x5D, 0xD3, 0x40, 0x3B, 0x90, 0xAA, 0x49, 0x04, 0xA8, 0x33, 0x01, 0x8C,
+    0xFA, 0x7C, 0x84, 0x5C, 0xDE, 0x7A, 0x28, 0x5F, 0x1D, 0x8B, 0x1E, 0x5A, 0x33, 0x95, 0x1D, 0x69,
+    0x30, 0x53, 0xD9, 0x91, 0xFB, 0x34, 0xB8, 0x8E, 0xA2, 0x4B, 0x83, 0x6B, 0xA8, 0x49, 0x83, 0x6B,
+    0x92, 0x40, 0x1A, 0x5C, 0x93, 0x8D, 0x98, 0xE0, 0x9A, 0xA2, 0xC7, 0x4C, 0x65, 0xE7, 0x2A, 0xCC,
+    0x58, 0x74, 0x33, 0xE4, 0xDE, 0xFE, 0x60, 0x04, 0xEB, 0xAD, 0x7A, 0x28, 0xFB, 0x2C, 0xA6, 0xD3,
+    0x5F, 0x15, 0x15, 0x46, 0x3D, 0xC5, 0x8C, 0xD5, 0xF2, 0x7F, 0x68, 0xC4, 0x7D, 0x49, 0x52, 0x47,
+    0x4B, 0xAB, 0xBB, 0x70, 0x69, 0x4B, 0x1B, 0xB8, 0x75, 0xDB, 0xE7, 0x37, 0xFF, 0xB4, 0xD5, 0x67,
+    0x21, 0x4E, 0xD7, 0xE2, 0x02, 0x90, 0xFE, 0x64, 0x02, 0xEC, 0xB7, 0x3D, 0x70, 0xA3, 0xEC, 0xC1,
+    0x78, 0xD7, 0x40, 0xD1, 0x09, 0xB8, 0x9D, 0xCE, 0x60, 0xBC, 0x99, 0xA0, 0x6C, 0xAC, 0x87, 0x99,
+    0xB2, 0x5F, 0xD3, 0x4E, 0xC5, 0xAC, 0x53, 0x81, 0x64, 0x21, 0x1F, 0x30, 0x01, 0x57, 0x61, 0xC7,
+    0x24, 0x40, 0x31, 0xD8, 0x01, 0x5C, 0xE7, 0x00, 0x7D, 0x3A, 0x40, 0xB2, 0xD8, 0x3E, 0xA6, 0xA3,
+    0x7C, 0xE3, 0xA6, 0x7E, 0x2C, 0x49, 0x7A, 0x6B, 0xD5, 0xCD, 0x9D, 0x45, 0x68, 0x87, 0x35, 0x5D,
+    0xFB, 0x1B, 0xBB, 0xDD, 0xBF, 0x08, 0xAE, 0x07, 0x13, 0x0A, 0x0F, 0x66, 0xB4, 0x1E, 0x72, 0x9F,
+    0x4F, 0x5B, 0x3E, 0xE2, 0xA2, 0x33, 0x31, 0xCF, 0xD0, 0x42, 0xF4, 0x06, 0xA3, 0x85, 0xB6, 0x62,
+    0x86, 0x3A, 0x0E, 0xBB, 0x5D, 0x3A, 0x41, 0x39, 0xC4, 0xF9, 0xB2, 0xB2, 0x01, 0xEC, 0x68, 0x7B,
+    0xC8, 0xA6, 0xD8, 0x77, 0xCA, 0x0A, 0xD2, 0xD9, 0x01, 0x2C, 0x37, 0x38, 0x38, 0x65, 0x46, 0x2F,
+    0x0B, 0x37, 0x9E, 0xA5, 0x38, 0x8C, 0x9E, 0xBA, 0x8F, 0x9C, 0xF9, 0x59, 0x46, 0x5F, 0xB9, 0x98,
+    0xD9, 0xB0, 0xD6, 0x1B, 0xFB, 0x7D, 0xA2, 0x93, 0x43, 0x0A, 0xC1, 0xE8, 0x17, 0x17, 0xD9, 0x68,
+    0x77, 0x8E, 0x52, 0xD7, 0xE7, 0xD2, 0x93, 0x68, 0xBF, 0xDF, 0xEF, 0xE3, 0xC8, 0xB9, 0xC4, 0x6D,
+    0x0B, 0xBB, 0xDD, 0xD5, 0x96, 0xB3, 0x3B, 0xA3, 0x33, 0x46, 0x7C, 0x43, 0x64, 0x19, 0xA3, 0xB3,
+    0xC6, 0xEA, 0x83, 0x15, 0x33, 0x71, 0x94, 0x52, 0x9C, 0x55, 0x44, 0x82, 0xC7, 0xD7, 0x51, 0x38,
+    0xF2, 0xE4, 0x65, 0x05, 0x5C, 0xAC, 0x1F, 0x28, 0xED, 0xB2, 0x4F, 0x74, 0x42, 0xC0, 0xCC, 0xA4,
+    0x13, 0xD6, 0x63, 0x3C, 0x45, 0x8F, 0xF1, 0xB8, 0x2E, 0xB2, 0xE5, 0xD8, 0x8E, 0x1A, 0x6C, 0x47,
+    0x1B, 0xB3, 0x8A, 0xED, 0xF7, 0xED, 0x1B, 0xF7, 0x95, 0x56, 0x5C, 0x98, 0x77, 0x57, 0x5B, 0x08,
+    0x50, 0x93, 0x4C, 0xE0, 0x1A, 0x33, 0x6E, 0x9E, 0xD1, 0xC5, 0x90, 0x0D, 0x60, 0xA7, 0xBC, 0x07,
+    0xB3, 0xAC, 0x33, 0x3C, 0x35, 0xDB, 0x20, 0xB7, 0x95, 0x36, 0xFA, 0x1B, 0xDE, 0x3E, 0x1B, 0x44,
+    0xB6, 0xDC, 0xD6, 0x07, 0x97, 0xA3, 0xB5, 0xCC, 0x71, 0xE4, 0xD3, 0x1B, 0xFB, 0xFD, 0x3E, 0xD2,
+    0xAE, 0xF2, 0x1C, 0x03, 0x7D, 0x5F, 0x3E, 0xA9, 0xFD, 0xCD, 0x28, 0x5D, 0x4B, 0x21, 0x6E, 0xDB,
+    0x73, 0x30, 0x5F, 0xE1, 0xD9, 0x9F, 0x39, 0xF5, 0x67, 0x3A, 0xE1, 0x90, 0xC7, 0x21, 0x42, 0x32,
+    0xB9, 0x29, 0x2D, 0xBB, 0xDD, 0xD5, 0xE8, 0x27, 0xBF, 0x86, 0x14, 0x0C, 0xEC, 0xF7, 0x2F, 0x45,
+    0xD3, 0xFD, 0xD1, 0x9A, 0xA7, 0xFE, 0x5C, 0xDE, 0xD5, 0xE8, 0xCD, 0x6D, 0xCE, 0x57, 0x21, 0x52,
+    0xD8, 0x65, 0xBF, 0xDF, 0xEF, 0xF7, 0x4B, 0x7B, 0xC6, 0x95, 0xEB, 0xE2, 0x6E, 0xB7, 0xE5, 0x51,
+    0x5A, 0xCE, 0xEE, 0x4C, 0xCF, 0x05, 0x82, 0x47, 0x11, 0x21, 0xD6, 0xB0, 0xED, 0xA2, 0x5A, 0x23,
+    0xE6, 0x0B, 0x90, 0x62, 0x70, 0x9B, 0x5E, 0xDB, 0xD2, 0x63, 0x46, 0x26, 0x79, 0x37, 0x3F, 0x50,
+    0xDA, 0xF6, 0x25, 0xCD, 0xE0, 0x38, 0x52, 0x45, 0xD9, 0x50, 0x77, 0xD8, 0x0E, 0xEB, 0xB1, 0x1D,
+    0xD9, 0xB8, 0x76, 0x53, 0xE3, 0x49, 0x02, 0xC6, 0xC3, 0x4C, 0x3A, 0xC1, 0xB2, 0x7F, 0x69, 0x79,
+    0xA0, 0xB4, 0xF5, 0x15, 0x04, 0x0E, 0x96, 0xD5, 0x9A, 0x44, 0xD1, 0xA5, 0x01, 0x6C, 0x67, 0x02,
+    0xE4, 0x7D, 0x3E, 0x42, 0x36, 0x94, 0x1E, 0x8C, 0x6F, 0x3B, 0x48, 0x15, 0x4B, 0x1B, 0xCE, 0x4A,
+    0x1B, 0x61, 0x71, 0xE3, 0x5C, 0xEE, 0x28, 0x57, 0x1D, 0xFC, 0xB3, 0x77, 0x57, 0xB7, 0x32, 0xC7,
+    0x14, 0x5C, 0xFB, 0xFD, 0xFE, 0xA5, 0x28, 0xA2, 0xC6, 0x99, 0x00, 0x56, 0x8C, 0x8F, 0xB0, 0x5D,
+    0xA1, 0x5A, 0x4A, 0xF7, 0xF6, 0x8A, 0xF9, 0xB7, 0xDD, 0x19, 0xE7, 0xF9, 0x00, 0x3C, 0xA3, 0x1F,
+    0x4E, 0xE1, 0x81, 0x23, 0xF5, 0x92, 0xA4, 0x2A, 0x42, 0xB2, 0x95, 0xEE, 0x55, 0xEB, 0x3C, 0x2D,
+    0xBB, 0x35, 0x81, 0xF7, 0xAB, 0x6B, 0x3E, 0xEF, 0x6C, 0xD9, 0x7F, 0xEE, 0xA5, 0xD5, 0x2F, 0xB1,
+    0x6E, 0xA2, 0xEA, 0x39, 0xFA, 0x1E, 0x66, 0x13, 0x26, 0x9C, 0x79, 0x20, 0xFE, 0x07, 0x7C, 0xF1,
+    0xDA, 0xD2, 0x50, 0xE8, 0x44, 0x9A, 0xA8, 0x63, 0x5C, 0x61, 0x29, 0xC5, 0x2C, 0x18, 0x95, 0x3B,
+    0xE3, 0xD3, 0x8C, 0xF6, 0xFB, 0x97, 0x42, 0xB6, 0x80, 0xF1, 0xF9, 0x0C, 0xB6, 0xB3, 0x01, 0x4A,
+    0x6C, 0x80, 0x4B, 0xEB, 0x84, 0x20, 0x71, 0x9A, 0xB2, 0xE8, 0xF4, 0x1C, 0x7D, 0x3E, 0xEB, 0xFE,
+    0x8C, 0x7B, 0xD0, 0xB9, 0x18, 0x9A, 0x70, 0x48, 0xA1, 0x15, 0xB3, 0x94, 0x9C, 0xCB, 0x8D, 0x11,
+    0x71, 0xBA, 0x6E, 0x38, 0x3F, 0x05, 0xC9, 0xEF, 0xA6, 0x33, 0x98, 0xA1, 0x18, 0xB6, 0xAC, 0xD1,
+    0xA7, 0xD6, 0x83, 0x19, 0xDB, 0x37, 0xF6, 0xFB, 0xF6, 0x8E, 0x24, 0x29, 0x57, 0x74, 0x47, 0xD4,
+    0x7D, 0xA1, 0x1B, 0x76, 0x8D, 0x8F, 0x9A, 0x56, 0xE7, 0x99, 0x8B, 0x2B, 0x85, 0xB6, 0x7D, 0xE4,
+    0x25, 0xD3, 0x69, 0x25, 0x28, 0x37, 0x56, 0x5C, 0x7B, 0xE8, 0xC5, 0xD3, 0x15, 0x1D, 0xB7, 0x8B,
+    0x99, 0x5F, 0xD3, 0x7D, 0xBF, 0xD3, 0x45, 0xF3, 0xF6, 0x8B, 0x8F, 0x35, 0xEB, 0xC7, 0x6D, 0xBF,
+    0x76, 0x7C, 0xB7, 0x29, 0x69, 0xC2, 0xEA, 0xFC, 0x6F, 0xFC, 0x8A, 0x92, 0xC5, 0x26, 0xCF, 0x9C,
+    0xAE, 0xAC, 0x7F, 0x3A, 0x6D, 0x4E, 0x25, 0x87, 0x87, 0xAB, 0x73, 0x6E, 0x23, 0x87, 0x87, 0x6F,
+    0x9F, 0x7F, 0xB8, 0x7E, 0xFB, 0xC3, 0xEF, 0x39, 0x89, 0x63, 0xFA, 0xF5, 0x35, 0xBD, 0x55, 0xD6,
+    0xF1, 0xA1, 0xC4, 0xE7, 0x76, 0xB8, 0x5E, 0x7C, 0x5F, 0x7F, 0x5C, 0x8E, 0xB9, 0xD4, 0x53, 0xAA,
+    0x22, 0x53, 0x43, 0xAE, 0x85, 0xF2, 0x27, 0x7F, 0x31, 0xBA, 0xEF, 0xF8, 0xF6, 0x0F, 0x9B, 0xEB,
+    0x59, 0x57, 0x15, 0x3C, 0x4A, 0xB4, 0x02, 0xAE, 0xEF, 0xF8, 0x48, 0x83, 0x16, 0x24, 0x7F, 0xCA,
+    0xEC, 0xB0, 0x7F, 0xD1, 0x98, 0x1F, 0xF7, 0xCC, 0x13, 0xCE, 0x51, 0x7C, 0x69, 0x2C, 0x3A, 0xA9,
+    0xCF, 0xD5, 0xF0, 0x08, 0x94, 0x5F, 0x9A, 0xF5, 0xE6, 0xBC, 0x39, 0x73, 0xBF, 0x78, 0x46, 0xFB,
+    0x56, 0x5A, 0x36, 0x9D, 0x31, 0x97, 0xD1, 0x8F, 0x30, 0x86, 0x3C, 0x45, 0xC9, 0x65, 0x4D, 0x61,
+    0xDE, 0xBC, 0x7D, 0x6C, 0x3C, 0x5D, 0xBB, 0xF0, 0xC5, 0xAB, 0x24, 0x01, 0x2D, 0xA4, 0x13, 0x12,
+    0x66, 0xA4, 0x8D, 0xB3, 0x5E, 0xD6, 0xD1, 0xC4, 0xDD, 0xE4, 0x3D, 0xB8, 0xCE, 0x76, 0x50, 0x76,
+    0xB1, 0x8D, 0xCA, 0x06, 0xEC, 0xE0, 0x80, 0xDC, 0x3B, 0x20, 0x1B, 0x4F, 0x01, 0x33, 0x45, 0x1E,
+    0x3C, 0x00, 0xC9, 0x12, 0xC3, 0x70, 0x46, 0x80, 0xD6, 0xC7, 0xDC, 0x13, 0x67, 0x23, 0x82, 0x3B,
+    0x57, 0xB2, 0x0B, 0x2B, 0xA6, 0x7D, 0x3E, 0x53, 0x95, 0xF7, 0xB5, 0x9A, 0xF6, 0x89, 0xBB, 0xED,
+    0x1F, 0x0E, 0x65, 0xE5, 0x9E, 0x63, 0xC2, 0x0D, 0x66, 0xA0, 0xC6, 0x36, 0x04, 0x8E, 0xB1, 0x13,
+    0x33, 0xF3, 0x94, 0xE8, 0xE6, 0x2B, 0xB3, 0x51, 0x48, 0xE7, 0x54, 0x4D, 0x0C, 0x77, 0xA8, 0x36,
+    0x85, 0x78, 0x93, 0xA8, 0xC9, 0x35, 0xE6, 0xF2, 0xC5, 0xBF, 0x0B, 0xE5, 0x1F, 0x4D, 0x0E, 0x77,
+    0x8B, 0x70, 0x4C, 0xE1, 0xB9, 0x75, 0x99, 0xBC, 0xE7, 0xFA, 0x73, 0xE4, 0x9E, 0x5B, 0xC7, 0x14,
+    0x23, 0xB7, 0x1C, 0xCF, 0xCD, 0xC9, 0x54, 0xBE, 0x39, 0xB9, 0x37, 0xBD, 0xD5, 0x60, 0xD5, 0xA7,
+    0xAA, 0xB6, 0xE0, 0x8A, 0xD5, 0x2A, 0x7F, 0xFA, 0x1F, 0xC0, 0xB6, 0xDD, 0xED, 0x76, 0x71, 0xB6,
+    0x82, 0x38, 0x59, 0xC1, 0xB6, 0x3D, 0x37, 0x86, 0xFF, 0xC6, 0xF9, 0xDC, 0x66, 0x91, 0xA5, 0x8E,
+    0x03, 0x5B, 0x76, 0x5F, 0xAA, 0xF2, 0xFE, 0x8C, 0xD2, 0x27, 0xF7, 0x65, 0x2F, 0x1F, 0xE1, 0x30,
+    0xE9, 0xDD, 0x9A, 0x7A, 0x37, 0x7A, 0xC5, 0xCE, 0xE7, 0xDF, 0xE8, 0xCF, 0xBF, 0xB1, 0x7A, 0xA7,
+    0x37, 0xBE, 0xBE, 0xDB, 0xED, 0x76, 0xD1, 0x53, 0xED, 0xDF, 0xAE, 0x1C, 0x57, 0x4C, 0xF7, 0x78,
+    0xD1, 0xDE, 0xF1, 0xC1, 0xFD, 0xD4, 0x9B, 0x57, 0x9E, 0xBF, 0x98, 0xFC, 0x93, 0x60, 0xDF, 0xF4,
+    0xEE, 0x66, 0xB7, 0xB4, 0xE6, 0xDE, 0x2F, 0xEF, 0xE7, 0xBF, 0x3B, 0x79, 0xAC, 0x5A, 0xF5, 0x92,
+    0xDB, 0x1C, 0x41, 0xD3, 0x59, 0xC4, 0x4C, 0xB4, 0xB8, 0xD4, 0xA7, 0x00, 0xA7, 0x0E, 0x20, 0xB8,
+    0x0A, 0x92, 0x10, 0xA9, 0x45, 0x54, 0x41, 0xD9, 0x01, 0xF2, 0x21, 0xF3, 0x60, 0x7B, 0x33, 0x6E,
+    0x83, 0xB7, 0x6B, 0x56, 0xA5, 0xD4, 0xB2, 0xA5, 0x81, 0x9B, 0xC1, 0x55, 0x49, 0x00, 0xD7, 0xA4,
+    0xD3, 0x26, 0xD0, 0xDA, 0x3E, 0xF3, 0x90, 0x7B, 0x3B, 0x40, 0xE6, 0x6D, 0x0F, 0x66, 0x8A, 0xF9,
+    0x5F, 0x5C, 0x03, 0xCC, 0x35, 0xC0, 0x72, 0x11, 0xE0, 0x62, 0x5D, 0x01, 0x8B, 0x6B, 0x20, 0x09,
+    0xF1, 0x1E, 0xDB, 0x83, 0x19, 0x73, 0x0F, 0x99, 0xCF, 0xFC, 0x96, 0x44, 0xD9, 0xF6, 0x69, 0x4C,
+    0x40, 0x1B, 0x88, 0x0E, 0x0D, 0xD4, 0xD1, 0x51, 0x19, 0x5C, 0xC5, 0x0C, 0x65, 0x93, 0x44, 0xD6,
+    0x7E, 0x02, 0xDB, 0xC7, 0x99, 0x62, 0x72, 0x0F, 0xC6, 0xDB, 0x1E, 0xD2, 0xC9, 0x76, 0x90, 0x84,
+    0xB2, 0x01, 0xA2, 0xC6, 0xE5, 0x34, 0x46, 0x4C, 0x2C, 0x07, 0x41, 0x86, 0x22, 0x9C, 0x4B, 0xB4,
+    0x13, 0x47, 0xFF, 0xBB, 0x6B, 0x80, 0x68, 0x2A, 0x69, 0xA2, 0xBE, 0xFB, 0x39, 0xF5, 0x76, 0x24,
+    0x51, 0x1A, 0x88, 0x39, 0x6B, 0x28, 0xEF, 0x8C, 0x90, 0x84, 0x1A, 0xB0, 0x7F, 0xEE, 0x81, 0xB9,
+    0x05, 0xEC, 0x9B, 0x1E, 0x58, 0xFE, 0xF6, 0x7F, 0x0E, 0x17, 0x81, 0x0B, 0xBF, 0xFD, 0x4B, 0x7A,
+    0x7B, 0xFC, 0x79, 0xAE, 0x2E, 0xAE, 0x82, 0xE2, 0x4E, 0x20, 0xE6, 0x9F, 0xA0, 0xAE, 0xD4, 0x50,
+    0x7A, 0xA3, 0x37, 0xDA, 0x40, 0xA1, 0x18, 0x67, 0xA0, 0x06, 0x8E, 0x62, 0xCE, 0x92, 0xC7, 0x2A,
+    0x48, 0x35, 0x82, 0xD5, 0x0C, 0xE5, 0x77, 0x67, 0x70, 0xD5, 0x75, 0x68, 0x79, 0xF4, 0x01, 0x37,
+    0xFD, 0xE5, 0x57, 0xBF, 0x99, 0xD7, 0xC1, 0xE6, 0x52, 0x1A, 0xA0, 0xFD, 0xCC, 0x08, 0x6D, 0x4C,
+    0x94, 0xD9, 0xC0, 0xD1, 0x8B, 0xE7, 0xB3, 0xC3, 0x45, 0x49, 0x2C, 0xF6, 0x9A, 0x73, 0x73, 0x3D,
+    0xE4, 0x03, 0xBF, 0xD0, 0x72, 0x54, 0x01, 0x57, 0xDC, 0x00, 0x59, 0xA8, 0x3D, 0xD8, 0x39, 0x6E,
+    0x5D, 0x0F, 0x79, 0xB8, 0xB0, 0x59, 0x13, 0x56, 0x29, 0xD0, 0x4C, 0xCE, 0x43, 0xBE, 0xDD, 0x33,
+    0x80, 0x0D, 0x45, 0x73, 0x48, 0xF6, 0xF8, 0x73, 0x2F, 0xC9, 0xC9, 0x19, 0x9E, 0x97, 0xE7, 0xEB,
+    0xE8, 0x37, 0xC5, 0xF2, 0x7B, 0x3E, 0x33, 0xB7, 0x6F, 0x2E, 0x75, 0x77, 0x7F, 0x92, 0x13, 0x13,
+    0xDA, 0xB7, 0x96, 0xF6, 0xBB, 0xAF, 0xFD, 0xB2, 0x4B, 0xF8, 0x53, 0x41, 0xE9, 0xA7, 0x73, 0x56,
+    0xC8, 0xEF, 0xC2, 0x7F, 0x96, 0x69, 0x26, 0xEF, 0xD4, 0x2E, 0x9F, 0x19, 0x5D, 0x55, 0x6A, 0x49,
+    0x3B, 0x0A, 0x35, 0x8F, 0x3C, 0x34, 0xB7, 0xFD, 0x47, 0xF6, 0xFB, 0xFD, 0xFE, 0x8B, 0x67, 0x2A,
+    0xF9, 0x87, 0x87, 0x88, 0x9A, 0xB3, 0x1B, 0x5E, 0xD9, 0xEF, 0xF7, 0xFB, 0x17, 0xD7, 0x8C, 0x54,
+    0x7C, 0xB2, 0xD0, 0x90, 0xFF, 0xB9, 0xF4, 0x6F, 0xC2, 0x69, 0x2A, 0x7D, 0xA9, 0xCB, 0x34, 0xBC,
+    0x8F, 0xA3, 0xD7, 0x78, 0x4F, 0xC5, 0xA3, 0xB9, 0x2A, 0x73, 0x47, 0xAA, 0xE6, 0xFA, 0xA6, 0xDA,
+    0x6F, 0xF5, 0x85, 0xC6, 0x67, 0x29, 0x67, 0xE0, 0x62, 0xD4, 0xA2, 0x3D, 0x71, 0xB7, 0xE2, 0xFD,
+    0xF1, 0xA5, 0xDF, 0x6C, 0x25, 0xBD, 0xC6, 0xFB, 0xF7, 0x5F, 0x7B, 0x48, 0xE0, 0xCF, 0xBF, 0xD0,
+    0x72, 0x92, 0x4A, 0xD2, 0xE4, 0x24, 0xE9, 0xCE, 0x6B, 0x90, 0xDC, 0x3A, 0x5C, 0xBD, 0xB2, 0x06,
+    0x63, 0x39, 0xF6, 0xFB, 0x9B, 0x5F, 0x73, 0xAB, 0xFE, 0x74, 0x20, 0xEF, 0xA3, 0x56, 0x35, 0xFA,
+    0x06, 0xC6, 0xB4, 0x63, 0x92, 0x16, 0x27, 0xA9, 0x39, 0x5E, 0xBD, 0x76, 0xCC, 0x39, 0x01, 0x6B,
+    0x77, 0x55, 0xF7, 0xB9, 0x67, 0xEF, 0xDE, 0x56, 0x8C, 0x33, 0x45, 0x84, 0xEE, 0x4B, 0xFE, 0x77,
+    0x6E, 0x39, 0xBB, 0xBA, 0x3F, 0xE7, 0xF7, 0x9D, 0x77, 0x51, 0x3A, 0x68, 0x27, 0x52, 0x0D, 0xE4,
+    0x6A, 0x28, 0x67, 0x68, 0xC7, 0x28, 0x28, 0xD8, 0x25, 0x5A, 0x86, 0x63, 0x9C, 0x6C, 0xAE, 0x66,
+    0x0D, 0xA0, 0x6C, 0xC7, 0x35, 0x95, 0x52, 0xF1, 0x40, 0x83, 0x7D, 0x79, 0x63, 0xEC, 0x59, 0x9D,
+    0xB3, 0xD2, 0x65, 0x8D, 0x9E, 0x5E, 0xDF, 0x51, 0x11, 0x21, 0xDD, 0x8E, 0x90, 0xAA, 0x89, 0x72,
+    0x49, 0x3B, 0x72, 0xA4, 0x9E, 0x22, 0x1A, 0x3D, 0x12, 0x8D, 0xD0, 0xF6, 0xAB, 0xA7, 0xD6, 0xBB,
+    0x7E, 0x61, 0x35, 0x8A, 0x74, 0x70, 0x3D, 0x16, 0xA9, 0xEE, 0xC9, 0xD4, 0x53, 0xCF, 0xF7, 0xED,
+    0xEE, 0x92, 0xE9, 0x84, 0x7A, 0x22, 0x53, 0x43, 0x1D, 0xA3, 0x69, 0xEC, 0x14, 0x2B, 0xA8, 0x01,
+    0x8A, 0x25, 0xCE, 0x86, 0x5E, 0x3E, 0xB8, 0x37, 0xEA, 0xA1, 0x8C, 0xEF, 0xA1, 0x1E, 0xE2, 0x4C,
+    0x92, 0xD7, 0x57, 0xC7, 0xB3, 0xEA, 0xA0, 0x51, 0xC2, 0xF4, 0xB1, 0xB1, 0xD7, 0xF9, 0x92, 0xD6,
+    0xAF, 0x1F, 0xF6, 0x47, 0xEB, 0x3E, 0x55, 0xCF, 0xB5, 0x75, 0x5F, 0xCE, 0x71, 0xCA, 0xAE, 0xD2,
+    0x43, 0xEB, 0xC9, 0x05, 0xED, 0x44, 0xAE, 0x8A, 0x7A, 0x22, 0x8F, 0x25, 0x3D, 0xBF, 0x9B, 0xC9,
+    0xD5, 0x90, 0xC7, 0x59, 0x11, 0xB8, 0x1C, 0xBF, 0x99, 0xAC, 0x9A, 0xDF, 0xDD, 0x6E, 0x57, 0x71,
+    0x26, 0xB1, 0x6B, 0x39, 0xE4, 0xB8, 0x8C, 0xDA, 0xF3, 0x8D, 0xCA, 0xDC, 0x2F, 0x87, 0x9F, 0xDB,
+    0xEA, 0xDC, 0xF6, 0xDC, 0xF9, 0x98, 0x40, 0x61, 0x95, 0xC3, 0x47, 0x20, 0xD1, 0x70, 0x5E, 0x0E,
+    0xD7, 0x99, 0x99, 0xFA, 0x9C, 0x7A, 0xA0, 0x3E, 0x17, 0x3F, 0x1C, 0x0E, 0xDB, 0xE4, 0x73, 0x77,
+    0x77, 0xAB, 0xE6, 0xA8, 0x3D, 0x4C, 0x54, 0xB5, 0xD8, 0x19, 0xDB, 0x53, 0xC4, 0xBC, 0xC1, 0x1D,
+    0x45, 0x43, 0x5D, 0xAD, 0x13, 0x2F, 0x39, 0x68, 0xE1, 0x06, 0x31, 0x44, 0x2D, 0xEA, 0x28, 0x69,
+    0x49, 0x26, 0x68, 0x89, 0xE9, 0x30, 0x8D, 0x07, 0xD7, 0x67, 0x03, 0x14, 0x63, 0xDE, 0x43, 0xBE,
+    0x7C, 0x36, 0xEA, 0x30, 0x24, 0xAD, 0xBA, 0xAA, 0xA4, 0x8D, 0xBA, 0xAA, 0xB7, 0x97, 0x69, 0x15,
+    0x76, 0xA6, 0x33, 0xA3, 0xEA, 0xDB, 0x42, 0x00, 0xCF, 0x09, 0x37, 0xEE, 0x9C, 0x06, 0xE4, 0x36,
+    0xEC, 0x76, 0xBB, 0x70, 0x1E, 0xDA, 0xF3, 0x01, 0xDA, 0xD9, 0xD0, 0x7A, 0xC8, 0x7B, 0x3B, 0x6E,
+    0x1A, 0x96, 0xA2, 0x4B, 0x66, 0x28, 0x2B, 0x16, 0x70, 0xAC, 0xBA, 0x18, 0x6D, 0xF9, 0xFC, 0xE3,
+    0xC4, 0x80, 0x01, 0x16, 0xD2, 0x89, 0x74, 0xC6, 0x78, 0xB2, 0x80, 0xF1, 0x14, 0x23, 0xF9, 0xF0,
+    0x70, 0x68, 0x3F, 0x58, 0xA6, 0xF9, 0x5C, 0xB5, 0xA6, 0xFB, 0xE3, 0x11, 0x77, 0x6F, 0x83, 0xF9,
+    0xBD, 0x83, 0x0E, 0xEE, 0x7C, 0x12, 0x8D, 0xF3, 0x3A, 0xB8, 0xF6, 0x01, 0x84, 0x78, 0x27, 0x1D,
+    0x5C, 0xB1, 0xEA, 0xE0, 0xAA, 0x07, 0x74, 0x70, 0xED, 0x43, 0x09, 0x51, 0x9C, 0xA4, 0xE6, 0xFC,
+    0x36, 0x26, 0x64, 0x3D, 0x8F, 0xB7, 0xFB, 0xFD, 0xFE, 0xE6, 0x79, 0xFD, 0xD1, 0xCF, 0x89, 0xB7,
+    0xE1, 0x01, 0xBC, 0xED, 0xDF, 0x0D, 0x6F, 0xEF, 0x23, 0x94, 0xD3, 0xF9, 0x6D, 0x34, 0x1F, 0x00,
+    0xAD, 0x16, 0x20, 0x5F, 0x4E, 0xDB, 0x01, 0x5C, 0x73, 0x29, 0x0D, 0x10, 0xB8, 0x44, 0x8D, 0xF1,
+    0x5C, 0xC2, 0x76, 0x79, 0xC7, 0x25, 0xCC, 0x60, 0x2B, 0x2E, 0x91, 0xF8, 0x12, 0x2E, 0xC1, 0x74,
+    0x19, 0x2E, 0xC1, 0xF5, 0xEB, 0x70, 0x09, 0x2E, 0xDF, 0x82, 0x4B, 0x70, 0x7C, 0x6B, 0x0D, 0x3E,
+    0x3C, 0x2F, 0xC5, 0x2C, 0x67, 0xD7, 0x2E, 0xC1, 0xF1, 0xFA, 0x40, 0x7C, 0xFC, 0xD6, 0xFA, 0xB2,
+    0xF5, 0xD5, 0xEB, 0x87, 0xD6, 0xCF, 0x32, 0x73, 0x89, 0x1A, 0x5C, 0x7F, 0x29, 0x0B, 0x87, 0x02,
+    0xAE, 0xC5, 0x25, 0x89, 0x73, 0x6A, 0xBC, 0xAD, 0x0E, 0xBB, 0x58, 0x07, 0x62, 0x1D, 0x88, 0x75,
+    0x20, 0xD6, 0x81, 0x58, 0x07, 0x62, 0x1D, 0x88, 0x75, 0x20, 0xD6, 0x81, 0x58, 0x07, 0x62, 0x39,
+    0x79, 0x58, 0x1D, 0xCE, 0x5D, 0x5B, 0x1F, 0x88, 0x8F, 0xDF, 0x5A, 0x5F, 0xB6, 0xBE, 0x7A, 0xFD,
+    0xD0, 0xFA, 0x59, 0xE6, 0x48, 0x35, 0x5C, 0x4F, 0xAC, 0xC3, 0xFE, 0x67, 0xAF, 0xC3, 0x3A, 0x9F,
+    0x46, 0xDD, 0xE5, 0x82, 0x44, 0x83, 0xFD, 0x6C, 0x47, 0xF6, 0x43, 0x5F, 0x1A, 0x4F, 0xD1, 0x4D,
+    0x97, 0x09, 0xD4, 0x5C, 0xBF, 0x8E, 0x4B, 0x02, 0x97, 0x6F, 0x61, 0x5F, 0xF5, 0x1C, 0xBF, 0x8C,
+    0x51, 0xC7, 0xC7, 0x5F, 0x06, 0xC1, 0xC7, 0x5F, 0x26, 0x11, 0x7C, 0xFC, 0x16, 0x99, 0x3A, 0x8E,
+    0x6F, 0x51, 0xDC, 0xF1, 0x1C, 0x5F, 0xA7, 0x26, 0x70, 0xF9, 0x72, 0x12, 0x70, 0x5C, 0x2F, 0x33,
+    0x8F, 0xED, 0x26, 0xFB, 0x74, 0x87, 0xF9, 0xA1, 0xCF, 0x05, 0x28, 0x3A, 0xBA, 0xBA, 0xF3, 0x75,
+    0x38, 0xFA, 0x79, 0xEB, 0xB0, 0xB6, 0x83, 0x8B, 0xED, 0xA0, 0xC1, 0x56, 0x60, 0x7E, 0xE8, 0x4B,
+    0xC0, 0x76, 0x53, 0xE4, 0x26, 0xAE, 0x5F, 0x07, 0x02, 0x97, 0x6F, 0x81, 0xF1, 0x1C, 0xDF, 0x02,
+    0x1B, 0xEB, 0xE0, 0xE0, 0xE3, 0x2F, 0x43, 0x80, 0x8F, 0xDF, 0xC2, 0x78, 0x38, 0xBE, 0x85, 0xED,
+    0xE0, 0xF8, 0x3A, 0x2E, 0xB6, 0x43, 0x00, 0xAE, 0x97, 0xC6, 0x03, 0x93, 0xFD, 0x6C, 0x07, 0x49,
+    0xAC, 0x83, 0x89, 0x75, 0xF8, 0x29, 0xDB, 0xE1, 0xC2, 0xB9, 0x44, 0x09, 0xCD, 0xAF, 0xF8, 0xE7,
+    0x85, 0xDD, 0x93, 0x73, 0x9C, 0x43, 0xF7, 0xFC, 0xE2, 0x1F, 0xFB, 0x4C, 0xD0, 0x5F, 0xCC, 0x75,
+    0x77, 0xE5, 0x3D, 0x0D, 0xE9, 0x09, 0xC9, 0xF3, 0x2E, 0x12, 0xD0, 0x50, 0x7B, 0xCA, 0x29, 0xF2,
+    0xAD, 0xE5, 0x14, 0x39, 0x57, 0xEB, 0xC9, 0xA6, 0x0B, 0x91, 0xBD, 0x5E, 0x49, 0xC0, 0xEF, 0x03,
+    0x49, 0x7B, 0x52, 0xC4, 0x99, 0x7D, 0x97, 0x56, 0x31, 0x07, 0xEB, 0x92, 0x05, 0xCC, 0x4C, 0x3D,
+    0x32, 0xAE, 0x73, 0xBC, 0x3D, 0xBA, 0xFA, 0x0E, 0xC6, 0x79, 0x10, 0xFB, 0x48, 0x0E, 0xB7, 0x29,
+    0x79, 0xCB, 0x0E, 0x68, 0xBF, 0xBA, 0xAB, 0x5F, 0xBF, 0xBA, 0x52, 0xBA, 0x75, 0x08, 0xD2, 0xC2,
+    0xC5, 0xF5, 0xFC, 0xE1, 0xBE, 0x5F, 0xF2, 0x3E, 0xD1, 0x9F, 0x52, 0xFF, 0x65, 0x45, 0xA1, 0x39,
+    0x8B, 0x09, 0x91, 0xE6, 0x7C, 0x75, 0xB2, 0x7C, 0xE6, 0x4A, 0xF4, 0x77, 0xAA, 0x88, 0x56, 0x5F,
+    0xEC, 0xF8, 0x1F, 0xC7, 0x49, 0xEC, 0xCA, 0x8E, 0x6C, 0xC4, 0x0C, 0xA4, 0x01, 0x7E, 0x77, 0xA3,
+    0xA7, 0x71, 0x68, 0x88, 0xC6, 0xB0, 0xFC, 0xEE, 0xEE, 0x73, 0xB7, 0xE2, 0x48, 0x12, 0xAB, 0xD6,
+    0x5D, 0xB8, 0xF6, 0xFA, 0xEE, 0x69, 0x4F, 0x36, 0x92, 0xC6, 0xF4, 0x79, 0xED, 0x56, 0x86, 0xA2,
+    0x27, 0xFF, 0xF9, 0x2F, 0x64, 0xBA, 0x92, 0xE8, 0x85, 0x58, 0xFC, 0x2F, 0x4B, 0x9F, 0x8E, 0x85,
+    0x7F, 0xE6, 0xA4, 0x22, 0xDA, 0xB6, 0xC9, 0xA4, 0x00, 0xF9, 0x7C, 0x14, 0x3D, 0xCF, 0xCB, 0x6E,
+    0xCD, 0x47, 0x9D, 0xCE, 0xA4, 0x71, 0x52, 0xBC, 0x16, 0x5C, 0x73, 0xF6, 0xDE, 0xFC, 0xEE, 0xD5,
+    0x34, 0xD0, 0x4A, 0x5D, 0x8B, 0x93, 0x86, 0xB2, 0xBB, 0x70, 0xED, 0xF5, 0x2B, 0xF9, 0x2F, 0xB9,
+    0xEC, 0xDF, 0x3E, 0x94, 0x1D, 0xF8, 0x9D, 0xAF, 0x00, 0x3C, 0x7E, 0x77, 0xF5, 0x0A, 0x2B, 0xB5,
+    0xC4, 0xB4, 0xE0, 0x85, 0xA4, 0xF1, 0xF1, 0x38, 0xF1, 0x5B, 0x1D, 0xCE, 0xCD, 0x2C, 0x78, 0xBC,
+    0x39, 0xAB, 0xA6, 0x0D, 0x26, 0x6C, 0xE3, 0xFC, 0x86, 0x73, 0xEB, 0xE7, 0xD8, 0xD0, 0x6E, 0xF7,
+    0x3B, 0x3E, 0x3D, 0x48, 0x01, 0x6E, 0xEB, 0x1B, 0xC9, 0x53, 0x77, 0x77, 0x4F, 0x2E, 0xBB, 0x9D,
+    0xB6, 0xA2, 0x1E, 0xCA, 0x79, 0x56, 0xFA, 0x5F, 0xFE, 0xA9, 0x62, 0xAE, 0xB2, 0xE5, 0x0C, 0x2C,
+    0x9F, 0x92, 0x7E, 0x20, 0xF5, 0xAD, 0xFC, 0x1A, 0x50, 0x0B, 0x8F, 0x7D, 0xE5, 0xD1, 0x08, 0x1C,
+    0xB7, 0x26, 0x3B, 0x5B, 0xE2, 0x24, 0xDB, 0x85, 0xA4, 0xF9, 0x68, 0x05, 0xCE, 0x42, 0xBE, 0x02,
+    0xA7, 0xA1, 0x85, 0xA2, 0x23, 0xF7, 0xE4, 0x7E, 0x9B, 0x07, 0x31, 0x36, 0x79, 0x31, 0x6C, 0x85,
+    0x88, 0x2D, 0xD4, 0x7E, 0x75, 0x57, 0xBF, 0x7E, 0x25, 0xDF, 0x80, 0x13, 0xDB, 0x5F, 0xD2, 0x94,
+    0x6F, 0xC0, 0xF9, 0x55, 0x42, 0xE2, 0x5D, 0x80, 0xF3, 0x95, 0x07, 0x81, 0xB3, 0x1C, 0x12, 0xEB,
+    0x94, 0x51, 0x59, 0xEA, 0xA2, 0xE8, 0x53, 0x7E, 0x27, 0x9A, 0x68, 0x7A, 0x1B, 0xD5, 0x24, 0x09,
+    0xBF, 0x1B, 0xF5, 0xB4, 0x21, 0xB2, 0x83, 0x2E, 0xF6, 0xDC, 0xA2, 0x83, 0xA2, 0x27, 0xF3, 0xB1,
+    0xEF, 0x2E, 0xBB, 0x6A, 0x9D, 0x20, 0x70, 0x25, 0x4C, 0x17, 0xAE, 0xBD, 0xBE, 0x7B, 0xFA, 0xEE,
+    0x6E, 0x2B, 0xD4, 0x8A, 0xD2, 0x1B, 0x15, 0x89, 0x48, 0xFD, 0xF3, 0x5E, 0x1C, 0x21, 0x1B, 0x49,
+    0x16, 0xC8, 0x74, 0x85, 0xFA, 0xDE, 0x69, 0x11, 0xD3, 0x63, 0x7E, 0x36, 0x26, 0xC7, 0x68, 0x00,
+    0x2E, 0x7C, 0x35, 0x36, 0x7D, 0xF4, 0xE9, 0x59, 0xD3, 0x55, 0x14, 0x5B, 0x4E, 0xFC, 0xD7, 0xE3,
+    0x44, 0x84, 0xED, 0xCA, 0xC8, 0xCD, 0x2B, 0xB6, 0xAF, 0x79, 0xEA, 0x57, 0xE6, 0x19, 0x6E, 0xAD,
+    0xFB, 0xE7, 0xE2, 0xBE, 0x56, 0x95, 0x68, 0x77, 0xC5, 0x48, 0x43, 0x29, 0x8D, 0xF6, 0xF5, 0x76,
+    0x68, 0x25, 0x5F, 0x56, 0xF9, 0xB0, 0xD3, 0xEE, 0x8A, 0xC3, 0x0C, 0x91, 0x19, 0x4F, 0x3B, 0x96,
+    0x33, 0xDF, 0x61, 0x17, 0x1D, 0x7B, 0x62, 0x86, 0x84, 0x05, 0x72, 0x4D, 0xEB, 0xA4, 0x07, 0xAA,
+    0x58, 0x80, 0x42, 0x3D, 0x0B, 0x90, 0xB4, 0x9E, 0x05, 0xFE, 0x53, 0xAC, 0x67, 0x81, 0x97, 0xC9,
+    0x46, 0x16, 0xB8, 0x85, 0xF1, 0x91, 0xB1, 0xCF, 0x7D, 0xCC, 0x56, 0x52, 0xF6, 0xB4, 0x6F, 0xDC,
+    0x6A, 0xA5, 0x86, 0x5A, 0xA1, 0xD4, 0x0C, 0xA5, 0x7C, 0xF2, 0x4C, 0xF5, 0xE0, 0xC4, 0x73, 0x1F,
+    0xE6, 0x10, 0x85, 0xB8, 0xFA, 0x37, 0x6D, 0xFE, 0x2B, 0xF9, 0x46, 0x3C, 0xCA, 0x4D, 0xE6, 0x3D,
+    0xFD, 0xDC, 0xB2, 0xC6, 0xDF, 0xC5, 0xC1, 0x91, 0xBC, 0x8B, 0xE9, 0x5F, 0x28, 0xBB, 0x95, 0xFD,
+    0x6F, 0xBF, 0xF3, 0x35, 0x4E, 0x23, 0x44, 0xD5, 0xBB, 0x26, 0xA6, 0x75, 0xF6, 0xE5, 0x10, 0x59,
+    0xF0, 0xA9, 0x98, 0xA2, 0x7F, 0x52, 0xB0, 0x4B, 0x94, 0x95, 0x82, 0x5D, 0x9D, 0xA6, 0xC6, 0x42,
+    0x43, 0x29, 0x69, 0xA9, 0x0A, 0x4D, 0xF5, 0xEA, 0xFD, 0x3A, 0xC7, 0x59, 0x0C, 0xA2, 0xEB, 0xD4,
+    0x44, 0x26, 0xF5, 0xC9, 0x6A, 0x84, 0xAD, 0xA8, 0x15, 0x62, 0xF6, 0xBF, 0x42, 0xC1, 0x4A, 0x23,
+    0x64, 0x9A, 0x63, 0xA6, 0xB6, 0x44, 0x4B, 0x11, 0x9B, 0xB4, 0xDE, 0xAC, 0xC8, 0x85, 0xDE, 0xD4,
+    0x2A, 0x34, 0x10, 0x2D, 0x82, 0xC9, 0xB2, 0xAA, 0xFC, 0xA9, 0xB7, 0xE9, 0x30, 0x8A, 0xFF, 0x6D,
+    0xD5, 0x5A, 0x65, 0x9B, 0xD1, 0x30, 0x39, 0xE4, 0x31, 0x79, 0x6E, 0x03, 0xD4, 0xFB, 0x00, 0xFE,
+    0x7F,
 };
 
 static const EpdGlyph bookerly_18_regularGlyphs[] = {
@@ -2453,7 +2586,7 @@ static const EpdGlyph bookerly_18_regularGlyphs[] = {
     { 4, 34, 10, 3, 29, 34, 11963 }, // |
     { 11, 38, 15, 1, 31, 105, 11997 }, // }
     { 18, 7, 24, 3, 16, 32, 12102 }, // ~
-    { 0, 0, 8, 0, 0, 0, 0 }, //  
+    { 0, 0, 8, 0, 0, 0, 12134 }, //  
     { 6, 30, 10, 2, 21, 45, 0 }, // ¡
     { 18, 38, 24, 2, 30, 171, 45 }, // ¢
     { 21, 28, 24, 1, 27, 147, 216 }, // £
@@ -2464,642 +2597,649 @@ static const EpdGlyph bookerly_18_regularGlyphs[] = {
     { 14, 6, 26, 6, 29, 21, 787 }, // ¨
     { 28, 28, 30, 1, 27, 196, 808 }, // ©
     { 13, 18, 17, 2, 27, 59, 1004 }, // ª
-    { 19, 15, 20, 1, 17, 72, 1063 }, // «
-    { 17, 9, 24, 3, 18, 39, 1135 }, // ¬
-    { 12, 4, 14, 1, 12, 12, 1174 }, // ­
-    { 20, 21, 22, 1, 30, 105, 1186 }, // ®
-    { 13, 4, 26, 6, 28, 13, 1291 }, // ¯
-    { 14, 13, 20, 3, 27, 46, 1304 }, // °
-    { 17, 23, 24, 3, 23, 98, 1350 }, // ±
-    { 14, 18, 17, 2, 32, 63, 1448 }, // ²
-    { 13, 19, 17, 2, 32, 62, 1511 }, // ³
-    { 8, 10, 26, 9, 32, 20, 1573 }, // ´
-    { 24, 29, 25, 2, 20, 174, 1593 }, // µ
-    { 20, 33, 21, 0, 27, 165, 1767 }, // ¶
-    { 6, 6, 10, 2, 13, 9, 1932 }, // ·
-    { 8, 9, 26, 9, -1, 18, 1941 }, // ¸
-    { 11, 18, 17, 3, 32, 50, 1959 }, // ¹
-    { 14, 18, 17, 2, 27, 63, 2009 }, // º
-    { 20, 15, 20, 1, 17, 75, 2072 }, // »
-    { 37, 31, 41, 3, 28, 287, 2147 }, // ¼
-    { 37, 31, 41, 3, 28, 287, 2434 }, // ½
-    { 38, 31, 41, 2, 28, 295, 2721 }, // ¾
-    { 14, 30, 18, 2, 21, 105, 3016 }, // ¿
-    { 28, 37, 28, 0, 37, 259, 3121 }, // À
-    { 28, 37, 28, 0, 37, 259, 3380 }, // Á
-    { 28, 36, 28, 0, 36, 252, 3639 }, // Â
-    { 28, 36, 28, 0, 36, 252, 3891 }, // Ã
-    { 28, 35, 28, 0, 35, 245, 4143 }, // Ä
-    { 28, 38, 28, 0, 38, 266, 4388 }, // Å
-    { 35, 27, 35, -1, 27, 237, 4654 }, // Æ
-    { 22, 37, 24, 1, 27, 204, 4891 }, // Ç
-    { 22, 37, 24, 1, 37, 204, 5095 }, // È
-    { 22, 37, 24, 1, 37, 204, 5299 }, // É
-    { 22, 36, 24, 1, 36, 198, 5503 }, // Ê
-    { 22, 35, 24, 1, 35, 193, 5701 }, // Ë
-    { 12, 37, 14, 1, 37, 111, 5894 }, // Ì
-    { 12, 37, 14, 1, 37, 111, 6005 }, // Í
-    { 14, 36, 14, 0, 36, 126, 6116 }, // Î
-    { 14, 35, 14, 0, 35, 123, 6242 }, // Ï
-    { 26, 28, 28, 1, 27, 182, 6365 }, // Ð
-    { 30, 37, 31, 1, 36, 278, 6547 }, // Ñ
-    { 27, 38, 30, 1, 37, 257, 6825 }, // Ò
-    { 27, 38, 30, 1, 37, 257, 7082 }, // Ó
-    { 27, 37, 30, 1, 36, 250, 7339 }, // Ô
-    { 27, 37, 30, 1, 36, 250, 7589 }, // Õ
-    { 27, 36, 30, 1, 35, 243, 7839 }, // Ö
-    { 16, 16, 24, 4, 21, 64, 8082 }, // ×
-    { 29, 28, 30, 0, 27, 203, 8146 }, // Ø
-    { 29, 38, 29, 0, 37, 276, 8349 }, // Ù
-    { 29, 38, 29, 0, 37, 276, 8625 }, // Ú
-    { 29, 37, 29, 0, 36, 269, 8901 }, // Û
-    { 29, 36, 29, 0, 35, 261, 9170 }, // Ü
-    { 26, 37, 26, 0, 37, 241, 9431 }, // Ý
-    { 21, 27, 24, 1, 27, 142, 9672 }, // Þ
-    { 23, 31, 25, 1, 30, 179, 9814 }, // ß
-    { 20, 33, 21, 1, 32, 165, 9993 }, // à
-    { 20, 33, 21, 1, 32, 165, 10158 }, // á
-    { 20, 32, 21, 1, 31, 160, 10323 }, // â
-    { 20, 31, 21, 1, 30, 155, 10483 }, // ã
-    { 20, 30, 21, 1, 29, 150, 10638 }, // ä
-    { 20, 33, 21, 1, 32, 165, 10788 }, // å
-    { 29, 22, 31, 1, 21, 160, 10953 }, // æ
-    { 17, 31, 19, 1, 21, 132, 11113 }, // ç
-    { 18, 33, 20, 1, 32, 149, 11245 }, // è
-    { 18, 33, 20, 1, 32, 149, 11394 }, // é
-    { 18, 32, 20, 1, 31, 144, 11543 }, // ê
-    { 18, 30, 20, 1, 29, 135, 11687 }, // ë
-    { 12, 32, 13, 0, 32, 96, 11822 }, // ì
-    { 12, 32, 13, 0, 32, 96, 11918 }, // í
-    { 13, 31, 13, 0, 31, 101, 12014 }, // î
-    { 14, 29, 13, -1, 29, 102, 12115 }, // ï
-    { 20, 32, 23, 1, 31, 160, 12217 }, // ð
-    { 25, 30, 26, 0, 30, 188, 12377 }, // ñ
-    { 21, 33, 23, 1, 32, 174, 12565 }, // ò
-    { 21, 33, 23, 1, 32, 174, 12739 }, // ó
-    { 21, 32, 23, 1, 31, 168, 12913 }, // ô
-    { 21, 31, 23, 1, 30, 163, 13081 }, // õ
-    { 21, 30, 23, 1, 29, 158, 13244 }, // ö
-    { 17, 18, 24, 3, 22, 77, 13402 }, // ÷
-    { 22, 22, 23, 0, 21, 121, 13479 }, // ø
-    { 25, 33, 25, 0, 32, 207, 13600 }, // ù
-    { 25, 33, 25, 0, 32, 207, 13807 }, // ú
-    { 25, 32, 25, 0, 31, 200, 14014 }, // û
-    { 25, 30, 25, 0, 29, 188, 14214 }, // ü
-    { 23, 41, 23, 0, 32, 236, 14402 }, // ý
-    { 23, 39, 24, 0, 30, 225, 14638 }, // þ
-    { 23, 38, 23, 0, 29, 219, 14863 }, // ÿ
-    { 28, 34, 28, 0, 34, 238, 0 }, // Ā
-    { 20, 29, 21, 1, 28, 145, 238 }, // ā
-    { 28, 36, 28, 0, 36, 252, 383 }, // Ă
-    { 20, 31, 21, 1, 30, 155, 635 }, // ă
-    { 28, 35, 28, 0, 27, 245, 790 }, // Ą
-    { 20, 29, 21, 1, 21, 145, 1035 }, // ą
-    { 22, 38, 24, 1, 37, 209, 1180 }, // Ć
-    { 17, 33, 19, 1, 32, 141, 1389 }, // ć
-    { 22, 37, 24, 1, 36, 204, 1530 }, // Ĉ
-    { 17, 32, 19, 1, 31, 136, 1734 }, // ĉ
-    { 22, 37, 24, 1, 36, 204, 1870 }, // Ċ
-    { 17, 30, 19, 1, 29, 128, 2074 }, // ċ
-    { 22, 38, 24, 1, 37, 209, 2202 }, // Č
-    { 17, 32, 19, 1, 31, 136, 2411 }, // č
-    { 26, 38, 28, 1, 37, 247, 2547 }, // Ď
-    { 26, 31, 24, 1, 30, 202, 2794 }, // ď
-    { 26, 28, 28, 1, 27, 182, 2996 }, // Đ
-    { 23, 31, 24, 1, 30, 179, 3178 }, // đ
-    { 22, 34, 24, 1, 34, 187, 3357 }, // Ē
-    { 18, 29, 20, 1, 28, 131, 3544 }, // ē
-    { 22, 36, 24, 1, 36, 198, 3675 }, // Ĕ
-    { 18, 31, 20, 1, 30, 140, 3873 }, // ĕ
-    { 22, 36, 24, 1, 36, 198, 4013 }, // Ė
-    { 18, 30, 20, 1, 29, 135, 4211 }, // ė
-    { 22, 35, 24, 1, 27, 193, 4346 }, // Ę
-    { 18, 29, 20, 1, 21, 131, 4539 }, // ę
-    { 22, 37, 24, 1, 37, 204, 4670 }, // Ě
-    { 18, 32, 20, 1, 31, 144, 4874 }, // ě
-    { 25, 37, 28, 1, 36, 232, 5018 }, // Ĝ
-    { 22, 40, 22, 0, 31, 220, 5250 }, // ĝ
-    { 25, 37, 28, 1, 36, 232, 5470 }, // Ğ
-    { 22, 39, 22, 0, 30, 215, 5702 }, // ğ
-    { 25, 37, 28, 1, 36, 232, 5917 }, // Ġ
-    { 22, 38, 22, 0, 29, 209, 6149 }, // ġ
-    { 25, 37, 28, 1, 27, 232, 6358 }, // Ģ
-    { 22, 41, 22, 0, 32, 226, 6590 }, // ģ
-    { 30, 36, 32, 1, 36, 270, 6816 }, // Ĥ
-    { 26, 39, 25, -1, 39, 254, 7086 }, // ĥ
-    { 30, 27, 32, 1, 27, 203, 7340 }, // Ħ
-    { 25, 30, 25, 0, 30, 188, 7543 }, // ħ
-    { 13, 36, 14, 1, 36, 117, 7731 }, // Ĩ
-    { 13, 30, 13, 0, 30, 98, 7848 }, // ĩ
-    { 14, 34, 14, 0, 34, 119, 7946 }, // Ī
-    { 13, 28, 13, 0, 28, 91, 8065 }, // ī
-    { 14, 36, 14, 0, 36, 126, 8156 }, // Ĭ
-    { 13, 30, 13, 0, 30, 98, 8282 }, // ĭ
-    { 12, 35, 14, 1, 27, 105, 8380 }, // Į
-    { 12, 38, 13, 0, 30, 114, 8485 }, // į
-    { 12, 36, 14, 1, 36, 108, 8599 }, // İ
-    { 12, 20, 13, 0, 20, 60, 8707 }, // ı
-    { 26, 35, 27, 1, 27, 228, 8767 }, // Ĳ
-    { 21, 39, 23, 0, 30, 205, 8995 }, // ĳ
-    { 16, 44, 14, -2, 36, 176, 9200 }, // Ĵ
-    { 15, 40, 11, -3, 31, 150, 9376 }, // ĵ
-    { 27, 37, 28, 1, 27, 250, 9526 }, // Ķ
-    { 23, 40, 23, 0, 30, 230, 9776 }, // ķ
-    { 24, 21, 23, 0, 20, 126, 10006 }, // ĸ
-    { 22, 37, 23, 1, 37, 204, 10132 }, // Ĺ
-    { 12, 39, 12, 0, 39, 117, 10336 }, // ĺ
-    { 22, 37, 23, 1, 27, 204, 10453 }, // Ļ
-    { 12, 40, 12, 0, 30, 120, 10657 }, // ļ
-    { 22, 30, 23, 1, 30, 165, 10777 }, // Ľ
-    { 16, 30, 13, 0, 30, 120, 10942 }, // ľ
-    { 22, 27, 23, 1, 27, 149, 11062 }, // Ŀ
-    { 18, 30, 18, 0, 30, 135, 11211 }, // ŀ
-    { 24, 27, 23, -1, 27, 162, 11346 }, // Ł
-    { 14, 30, 12, -1, 30, 105, 11508 }, // ł
-    { 30, 38, 31, 1, 37, 285, 11613 }, // Ń
-    { 25, 32, 26, 0, 32, 200, 11898 }, // ń
-    { 30, 37, 31, 1, 27, 278, 12098 }, // Ņ
-    { 25, 31, 26, 0, 21, 194, 12376 }, // ņ
-    { 30, 38, 31, 1, 37, 285, 12570 }, // Ň
-    { 25, 31, 26, 0, 31, 194, 12855 }, // ň
-    { 33, 29, 34, 1, 29, 240, 13049 }, // ŉ
-    { 30, 35, 31, 1, 27, 263, 13289 }, // Ŋ
-    { 22, 30, 24, 0, 21, 165, 13552 }, // ŋ
-    { 27, 35, 30, 1, 34, 237, 13717 }, // Ō
-    { 21, 29, 23, 1, 28, 153, 13954 }, // ō
-    { 27, 37, 30, 1, 36, 250, 14107 }, // Ŏ
-    { 21, 31, 23, 1, 30, 163, 14357 }, // ŏ
-    { 27, 38, 30, 1, 37, 257, 14520 }, // Ő
-    { 21, 32, 23, 1, 31, 168, 14777 }, // ő
-    { 35, 28, 37, 1, 27, 245, 14945 }, // Œ
-    { 32, 22, 34, 1, 21, 176, 15190 }, // œ
-    { 26, 38, 26, 1, 37, 247, 15366 }, // Ŕ
-    { 17, 32, 18, 0, 32, 136, 15613 }, // ŕ
-    { 26, 37, 26, 1, 27, 241, 15749 }, // Ŗ
-    { 17, 31, 18, 0, 21, 132, 15990 }, // ŗ
-    { 26, 38, 26, 1, 37, 247, 16122 }, // Ř
-    { 17, 31, 18, 0, 31, 132, 16369 }, // ř
-    { 18, 38, 21, 1, 37, 171, 16501 }, // Ś
-    { 15, 33, 18, 2, 32, 124, 16672 }, // ś
-    { 18, 37, 21, 1, 36, 167, 16796 }, // Ŝ
-    { 15, 32, 18, 2, 31, 120, 16963 }, // ŝ
-    { 18, 37, 21, 1, 27, 167, 17083 }, // Ş
-    { 15, 31, 18, 2, 21, 117, 17250 }, // ş
-    { 18, 38, 21, 1, 37, 171, 17367 }, // Š
-    { 15, 32, 18, 2, 31, 120, 17538 }, // š
-    { 24, 37, 26, 1, 27, 222, 17658 }, // Ţ
-    { 15, 35, 16, 0, 25, 132, 17880 }, // ţ
-    { 24, 37, 26, 1, 37, 222, 18012 }, // Ť
-    { 15, 32, 16, 0, 31, 120, 18234 }, // ť
-    { 24, 27, 26, 1, 27, 162, 18354 }, // Ŧ
-    { 15, 26, 16, 0, 25, 98, 18516 }, // ŧ
-    { 29, 37, 29, 0, 36, 269, 18614 }, // Ũ
-    { 25, 31, 25, 0, 30, 194, 18883 }, // ũ
-    { 29, 35, 29, 0, 34, 254, 19077 }, // Ū
-    { 25, 29, 25, 0, 28, 182, 19331 }, // ū
-    { 29, 37, 29, 0, 36, 269, 19513 }, // Ŭ
-    { 25, 31, 25, 0, 30, 194, 19782 }, // ŭ
-    { 29, 39, 29, 0, 38, 283, 19976 }, // Ů
-    { 25, 33, 25, 0, 32, 207, 20259 }, // ů
-    { 29, 38, 29, 0, 37, 276, 20466 }, // Ű
-    { 25, 32, 25, 0, 31, 200, 20742 }, // ű
-    { 29, 35, 29, 0, 27, 254, 20942 }, // Ų
-    { 25, 28, 25, 0, 20, 175, 21196 }, // ų
-    { 42, 37, 42, 0, 36, 389, 21371 }, // Ŵ
-    { 34, 32, 34, 0, 31, 272, 21760 }, // ŵ
-    { 26, 36, 26, 0, 36, 234, 22032 }, // Ŷ
-    { 23, 40, 23, 0, 31, 230, 22266 }, // ŷ
-    { 26, 35, 26, 0, 35, 228, 22496 }, // Ÿ
-    { 21, 38, 23, 1, 37, 200, 22724 }, // Ź
-    { 17, 33, 19, 1, 32, 141, 22924 }, // ź
-    { 21, 37, 23, 1, 36, 195, 23065 }, // Ż
-    { 17, 30, 19, 1, 29, 128, 23260 }, // ż
-    { 21, 38, 23, 1, 37, 200, 23388 }, // Ž
-    { 17, 32, 19, 1, 31, 136, 23588 }, // ž
-    { 18, 30, 15, 1, 30, 135, 23724 }, // ſ
-    { 9, 10, 0, -6, 32, 23, 0 }, // ̀
-    { 8, 10, 0, -2, 32, 20, 23 }, // ́
-    { 13, 9, 0, -7, 31, 30, 43 }, // ̂
-    { 14, 7, 0, -7, 30, 25, 73 }, // ̃
-    { 14, 4, 0, -7, 28, 14, 98 }, // ̄
-    { 13, 7, 0, -7, 30, 23, 112 }, // ̆
-    { 6, 6, 0, -3, 29, 9, 135 }, // ̇
-    { 14, 6, 0, -7, 29, 21, 144 }, // ̈
-    { 11, 11, 0, -5, 33, 31, 165 }, // ̉
-    { 10, 11, 0, -5, 32, 28, 196 }, // ̊
-    { 13, 9, 0, -5, 31, 30, 224 }, // ̋
-    { 14, 9, 0, -7, 31, 32, 254 }, // ̌
-    { 13, 9, 0, -8, 31, 30, 286 }, // ̏
-    { 14, 7, 0, -7, 30, 25, 316 }, // ̑
-    { 6, 11, 0, -3, 32, 17, 341 }, // ̒
-    { 7, 11, 0, -3, 33, 20, 358 }, // ̓
-    { 7, 11, 0, -4, 33, 20, 378 }, // ̔
-    { 5, 10, 0, -2, 33, 13, 398 }, // ̕
-    { 6, 9, 0, -3, 24, 14, 411 }, // ̛
-    { 6, 6, 0, -3, -3, 9, 425 }, // ̣
-    { 14, 6, 0, -7, -3, 21, 434 }, // ̤
-    { 10, 9, 0, -5, -1, 23, 455 }, // ̥
-    { 7, 9, 0, -4, -1, 16, 478 }, // ̦
-    { 8, 9, 0, -4, -1, 18, 494 }, // ̧
-    { 8, 9, 0, -4, 1, 18, 512 }, // ̨
-    { 4, 8, 10, 3, -2, 8, 530 }, // ̩
-    { 12, 8, 0, -6, -2, 24, 538 }, // ̭
-    { 13, 7, 0, -7, -2, 23, 562 }, // ̮
-    { 14, 7, 0, -7, -2, 25, 585 }, // ̰
-    { 14, 4, 0, -7, -4, 14, 610 }, // ̱
-    { 14, 7, 0, -7, 30, 25, 624 }, // ͂
-    { 14, 15, 0, -7, 38, 53, 649 }, // ̈́
-    { 7, 8, 0, -2, -2, 14, 702 }, // ͅ
-    { 22, 37, 24, 1, 37, 204, 0 }, // Ѐ
-    { 22, 35, 24, 1, 35, 193, 204 }, // Ё
-    { 29, 35, 31, 1, 27, 254, 397 }, // Ђ
-    { 20, 37, 22, 1, 37, 185, 651 }, // Ѓ
-    { 23, 28, 25, 1, 27, 161, 836 }, // Є
-    { 18, 28, 21, 1, 27, 126, 997 }, // Ѕ
-    { 12, 27, 14, 1, 27, 81, 1123 }, // І
-    { 14, 35, 14, 0, 35, 123, 1204 }, // Ї
-    { 15, 35, 14, -2, 27, 132, 1327 }, // Ј
-    { 36, 28, 37, 0, 27, 252, 1459 }, // Љ
-    { 37, 28, 39, 1, 27, 259, 1711 }, // Њ
-    { 31, 27, 33, 1, 27, 210, 1970 }, // Ћ
-    { 26, 38, 27, 1, 37, 247, 2180 }, // Ќ
-    { 30, 37, 32, 1, 37, 278, 2427 }, // Ѝ
-    { 28, 37, 28, 0, 36, 259, 2705 }, // Ў
-    { 28, 36, 30, 1, 27, 252, 2964 }, // Џ
-    { 28, 27, 28, 0, 27, 189, 3216 }, // А
-    { 22, 28, 24, 1, 27, 154, 3405 }, // Б
-    { 22, 28, 24, 1, 27, 154, 3559 }, // В
-    { 20, 27, 22, 1, 27, 135, 3713 }, // Г
-    { 28, 35, 28, 0, 27, 245, 3848 }, // Д
-    { 22, 27, 24, 1, 27, 149, 4093 }, // Е
-    { 38, 28, 39, 0, 27, 266, 4242 }, // Ж
-    { 20, 28, 22, 1, 27, 140, 4508 }, // З
-    { 30, 27, 32, 1, 27, 203, 4648 }, // И
-    { 30, 36, 32, 1, 36, 270, 4851 }, // Й
-    { 26, 28, 27, 1, 27, 182, 5121 }, // К
-    { 27, 28, 28, 0, 27, 189, 5303 }, // Л
-    { 34, 27, 34, 0, 27, 230, 5492 }, // М
-    { 30, 27, 32, 1, 27, 203, 5722 }, // Н
-    { 27, 28, 30, 1, 27, 189, 5925 }, // О
-    { 29, 27, 31, 1, 27, 196, 6114 }, // П
-    { 21, 27, 23, 1, 27, 142, 6310 }, // Р
-    { 22, 28, 24, 1, 27, 154, 6452 }, // С
-    { 24, 27, 26, 1, 27, 162, 6606 }, // Т
-    { 28, 28, 28, 0, 27, 196, 6768 }, // У
-    { 28, 29, 30, 1, 28, 203, 6964 }, // Ф
-    { 28, 27, 28, 0, 27, 189, 7167 }, // Х
-    { 29, 35, 30, 1, 27, 254, 7356 }, // Ц
-    { 26, 27, 27, 0, 27, 176, 7610 }, // Ч
-    { 38, 27, 40, 1, 27, 257, 7786 }, // Ш
-    { 39, 35, 40, 1, 27, 342, 8043 }, // Щ
-    { 27, 28, 29, 1, 27, 189, 8385 }, // Ъ
-    { 34, 28, 36, 1, 27, 238, 8574 }, // Ы
-    { 22, 28, 24, 1, 27, 154, 8812 }, // Ь
-    { 23, 28, 25, 1, 27, 161, 8966 }, // Э
-    { 38, 28, 40, 1, 27, 266, 9127 }, // Ю
-    { 25, 28, 25, -1, 27, 175, 9393 }, // Я
-    { 20, 22, 21, 1, 21, 110, 9568 }, // а
-    { 20, 31, 22, 1, 30, 155, 9678 }, // б
-    { 19, 21, 21, 1, 20, 100, 9833 }, // в
-    { 17, 20, 19, 1, 20, 85, 9933 }, // г
-    { 24, 27, 24, 0, 20, 162, 10018 }, // д
-    { 18, 22, 20, 1, 21, 99, 10180 }, // е
-    { 31, 22, 31, 0, 21, 171, 10279 }, // ж
-    { 16, 22, 18, 1, 21, 88, 10450 }, // з
-    { 24, 20, 26, 1, 20, 120, 10538 }, // и
-    { 24, 29, 26, 1, 29, 174, 10658 }, // й
-    { 21, 22, 22, 1, 21, 116, 10832 }, // к
-    { 23, 21, 24, 0, 20, 121, 10948 }, // л
-    { 27, 20, 29, 1, 20, 135, 11069 }, // м
-    { 24, 20, 26, 1, 20, 120, 11204 }, // н
-    { 21, 22, 23, 1, 21, 116, 11324 }, // о
-    { 24, 20, 26, 1, 20, 120, 11440 }, // п
-    { 22, 30, 23, 0, 21, 165, 11560 }, // р
-    { 17, 22, 19, 1, 21, 94, 11725 }, // с
-    { 19, 20, 21, 1, 20, 95, 11819 }, // т
-    { 23, 29, 23, 0, 20, 167, 11914 }, // у
-    { 26, 39, 28, 1, 30, 254, 12081 }, // ф
-    { 23, 20, 23, 0, 20, 115, 12335 }, // х
-    { 25, 27, 26, 1, 20, 169, 12450 }, // ц
-    { 22, 20, 23, 0, 20, 110, 12619 }, // ч
-    { 32, 20, 34, 1, 20, 160, 12729 }, // ш
-    { 32, 27, 34, 1, 20, 216, 12889 }, // щ
-    { 23, 21, 24, 1, 20, 121, 13105 }, // ъ
-    { 29, 21, 31, 1, 20, 153, 13226 }, // ы
-    { 19, 21, 20, 1, 20, 100, 13379 }, // ь
-    { 17, 22, 20, 1, 21, 94, 13479 }, // э
-    { 30, 22, 32, 1, 21, 165, 13573 }, // ю
-    { 21, 21, 22, 0, 20, 111, 13738 }, // я
-    { 18, 33, 20, 1, 32, 149, 13849 }, // ѐ
-    { 18, 30, 20, 1, 29, 135, 13998 }, // ё
-    { 22, 39, 24, 0, 30, 215, 14133 }, // ђ
-    { 17, 32, 19, 1, 32, 136, 14348 }, // ѓ
-    { 18, 22, 20, 1, 21, 99, 14484 }, // є
-    { 15, 22, 18, 2, 21, 83, 14583 }, // ѕ
-    { 12, 30, 13, 0, 30, 90, 14666 }, // і
-    { 14, 29, 13, -1, 29, 102, 14756 }, // ї
-    { 12, 39, 11, -3, 30, 117, 14858 }, // ј
-    { 30, 21, 30, 0, 20, 158, 14975 }, // љ
-    { 31, 21, 32, 1, 20, 163, 15133 }, // њ
-    { 25, 30, 25, 0, 30, 188, 15296 }, // ћ
-    { 21, 33, 22, 1, 32, 174, 15484 }, // ќ
-    { 24, 32, 26, 1, 32, 192, 15658 }, // ѝ
-    { 23, 38, 23, 0, 29, 219, 15850 }, // ў
-    { 24, 28, 26, 1, 20, 168, 16069 }, // џ
-    { 27, 31, 28, 0, 30, 210, 16237 }, // Ѣ
-    { 22, 28, 23, 1, 27, 154, 16447 }, // ѣ
-    { 27, 28, 30, 1, 27, 189, 16601 }, // Ѳ
-    { 21, 22, 23, 1, 21, 116, 16790 }, // ѳ
-    { 29, 28, 28, 0, 27, 203, 16906 }, // Ѵ
-    { 24, 22, 23, 0, 21, 132, 17109 }, // ѵ
-    { 30, 44, 32, 1, 36, 330, 17241 }, // Ҋ
-    { 25, 36, 26, 1, 29, 225, 17571 }, // ҋ
-    { 22, 28, 24, 1, 27, 154, 17796 }, // Ҍ
-    { 19, 28, 20, 0, 27, 133, 17950 }, // ҍ
-    { 21, 27, 23, 1, 27, 142, 18083 }, // Ҏ
-    { 22, 30, 23, 0, 21, 165, 18225 }, // ҏ
-    { 20, 32, 21, 1, 32, 160, 18390 }, // Ґ
-    { 17, 25, 18, 1, 25, 107, 18550 }, // ґ
-    { 20, 27, 22, 1, 27, 135, 18657 }, // Ғ
-    { 17, 20, 19, 1, 20, 85, 18792 }, // ғ
-    { 23, 35, 25, 1, 27, 202, 18877 }, // Ҕ
-    { 21, 29, 23, 1, 20, 153, 19079 }, // ҕ
-    { 38, 35, 39, 0, 27, 333, 19232 }, // Җ
-    { 31, 28, 31, 0, 21, 217, 19565 }, // җ
-    { 20, 35, 22, 1, 27, 175, 19782 }, // Ҙ
-    { 16, 29, 18, 1, 21, 116, 19957 }, // ҙ
-    { 26, 35, 27, 1, 27, 228, 20073 }, // Қ
-    { 21, 28, 22, 1, 21, 147, 20301 }, // қ
-    { 27, 28, 28, 1, 27, 189, 20448 }, // Ҝ
-    { 22, 22, 23, 1, 21, 121, 20637 }, // ҝ
-    { 26, 28, 27, 1, 27, 182, 20758 }, // Ҟ
-    { 21, 28, 21, 0, 27, 147, 20940 }, // ҟ
-    { 31, 28, 32, 1, 27, 217, 21087 }, // Ҡ
-    { 24, 22, 25, 1, 21, 132, 21304 }, // ҡ
-    { 30, 35, 32, 1, 27, 263, 21436 }, // Ң
-    { 25, 27, 27, 1, 20, 169, 21699 }, // ң
-    { 35, 27, 37, 1, 27, 237, 21868 }, // Ҥ
-    { 28, 20, 30, 1, 20, 140, 22105 }, // ҥ
-    { 38, 35, 40, 1, 27, 333, 22245 }, // Ҧ
-    { 34, 29, 37, 1, 20, 247, 22578 }, // ҧ
-    { 30, 28, 31, 1, 27, 210, 22825 }, // Ҩ
-    { 23, 22, 24, 1, 21, 127, 23035 }, // ҩ
-    { 22, 35, 24, 1, 27, 193, 23162 }, // Ҫ
-    { 17, 29, 19, 1, 21, 124, 23355 }, // ҫ
-    { 24, 35, 26, 1, 27, 210, 23479 }, // Ҭ
-    { 19, 27, 21, 1, 20, 129, 23689 }, // ҭ
-    { 26, 27, 26, 0, 27, 176, 23818 }, // Ү
-    { 23, 29, 23, 0, 20, 167, 23994 }, // ү
-    { 26, 27, 26, 0, 27, 176, 24161 }, // Ұ
-    { 23, 29, 23, 0, 20, 167, 24337 }, // ұ
-    { 28, 35, 28, 0, 27, 245, 24504 }, // Ҳ
-    { 23, 27, 23, 0, 20, 156, 24749 }, // ҳ
-    { 33, 35, 35, 1, 27, 289, 24905 }, // Ҵ
-    { 28, 27, 30, 1, 20, 189, 25194 }, // ҵ
-    { 27, 35, 27, 0, 27, 237, 25383 }, // Ҷ
-    { 23, 27, 24, 0, 20, 156, 25620 }, // ҷ
-    { 26, 27, 27, 0, 27, 176, 25776 }, // Ҹ
-    { 22, 20, 23, 0, 20, 110, 25952 }, // ҹ
-    { 26, 27, 27, 1, 27, 176, 26062 }, // Һ
-    { 25, 30, 25, 0, 30, 188, 26238 }, // һ
-    { 30, 28, 31, 0, 27, 210, 26426 }, // Ҽ
-    { 23, 22, 24, 0, 21, 127, 26636 }, // ҽ
-    { 30, 35, 31, 0, 27, 263, 26763 }, // Ҿ
-    { 23, 29, 24, 0, 21, 167, 27026 }, // ҿ
-    { 12, 27, 14, 1, 27, 81, 27193 }, // Ӏ
-    { 38, 37, 38, 0, 36, 352, 27274 }, // Ӂ
-    { 31, 30, 31, 0, 29, 233, 27626 }, // ӂ
-    { 25, 35, 26, 1, 27, 219, 27859 }, // Ӄ
-    { 20, 30, 23, 1, 21, 150, 28078 }, // ӄ
-    { 27, 35, 28, 0, 27, 237, 28228 }, // Ӆ
-    { 23, 27, 24, 0, 20, 156, 28465 }, // ӆ
-    { 30, 35, 31, 1, 27, 263, 28621 }, // Ӈ
-    { 24, 29, 26, 1, 20, 174, 28884 }, // ӈ
-    { 30, 35, 32, 1, 27, 263, 29058 }, // Ӊ
-    { 25, 27, 26, 1, 20, 169, 29321 }, // ӊ
-    { 26, 35, 27, 0, 27, 228, 29490 }, // Ӌ
-    { 22, 27, 23, 0, 20, 149, 29718 }, // ӌ
-    { 34, 35, 34, 0, 27, 298, 29867 }, // Ӎ
-    { 28, 27, 29, 1, 20, 189, 30165 }, // ӎ
-    { 12, 29, 12, 0, 29, 87, 30354 }, // ӏ
-    { 28, 36, 28, 0, 36, 252, 30441 }, // Ӑ
-    { 20, 30, 21, 1, 29, 150, 30693 }, // ӑ
-    { 28, 35, 28, 0, 35, 245, 30843 }, // Ӓ
-    { 20, 30, 21, 1, 29, 150, 31088 }, // ӓ
-    { 35, 27, 35, -1, 27, 237, 31238 }, // Ӕ
-    { 29, 22, 31, 1, 21, 160, 31475 }, // ӕ
-    { 22, 36, 24, 1, 36, 198, 31635 }, // Ӗ
-    { 18, 30, 20, 1, 29, 135, 31833 }, // ӗ
-    { 24, 28, 26, 1, 27, 168, 31968 }, // Ә
-    { 18, 22, 20, 1, 21, 99, 32136 }, // ә
-    { 24, 36, 26, 1, 35, 216, 32235 }, // Ӛ
-    { 18, 30, 20, 1, 29, 135, 32451 }, // ӛ
-    { 38, 36, 38, 0, 35, 342, 32586 }, // Ӝ
-    { 31, 30, 31, 0, 29, 233, 32928 }, // ӝ
-    { 20, 36, 22, 1, 35, 180, 33161 }, // Ӟ
-    { 16, 30, 18, 1, 29, 120, 33341 }, // ӟ
-    { 20, 28, 22, 1, 27, 140, 33461 }, // Ӡ
-    { 18, 29, 19, 0, 20, 131, 33601 }, // ӡ
-    { 30, 34, 32, 1, 34, 255, 33732 }, // Ӣ
-    { 24, 28, 26, 1, 28, 168, 33987 }, // ӣ
-    { 30, 35, 32, 1, 35, 263, 34155 }, // Ӥ
-    { 24, 29, 26, 1, 29, 174, 34418 }, // ӥ
-    { 27, 36, 30, 1, 35, 243, 34592 }, // Ӧ
-    { 21, 30, 23, 1, 29, 158, 34835 }, // ӧ
-    { 27, 28, 30, 1, 27, 189, 34993 }, // Ө
-    { 21, 22, 23, 1, 21, 116, 35182 }, // ө
-    { 27, 36, 32, 1, 35, 243, 35298 }, // Ӫ
-    { 21, 30, 23, 1, 29, 158, 35541 }, // ӫ
-    { 23, 36, 25, 1, 35, 207, 35699 }, // Ӭ
-    { 17, 30, 20, 1, 29, 128, 35906 }, // ӭ
-    { 28, 35, 28, 0, 34, 245, 36034 }, // Ӯ
-    { 23, 37, 23, 0, 28, 213, 36279 }, // ӯ
-    { 28, 36, 28, 0, 35, 252, 36492 }, // Ӱ
-    { 23, 38, 23, 0, 29, 219, 36744 }, // ӱ
-    { 28, 38, 28, 0, 37, 266, 36963 }, // Ӳ
-    { 23, 40, 23, 0, 31, 230, 37229 }, // ӳ
-    { 26, 35, 27, 0, 35, 228, 37459 }, // Ӵ
-    { 22, 29, 24, 0, 29, 160, 37687 }, // ӵ
-    { 20, 35, 22, 1, 27, 175, 37847 }, // Ӷ
-    { 17, 27, 19, 1, 20, 115, 38022 }, // ӷ
-    { 34, 36, 37, 1, 35, 306, 38137 }, // Ӹ
-    { 29, 30, 31, 1, 29, 218, 38443 }, // ӹ
-    { 20, 35, 22, 1, 27, 175, 38661 }, // Ӻ
-    { 17, 28, 19, 1, 20, 119, 38836 }, // ӻ
-    { 27, 35, 27, 0, 27, 237, 38955 }, // Ӽ
-    { 22, 29, 22, 0, 20, 160, 39192 }, // ӽ
-    { 28, 27, 28, 0, 27, 189, 39352 }, // Ӿ
-    { 23, 20, 23, 0, 20, 115, 39541 }, // ӿ
-    { 0, 0, 19, 0, 0, 0, 0 }, //  
-    { 0, 0, 38, 0, 0, 0, 0 }, //  
-    { 0, 0, 19, 0, 0, 0, 0 }, //  
-    { 0, 0, 38, 0, 0, 0, 0 }, //  
-    { 0, 0, 13, 0, 0, 0, 0 }, //  
-    { 0, 0, 10, 0, 0, 0, 0 }, //  
-    { 0, 0, 6, 0, 0, 0, 0 }, //  
-    { 0, 0, 24, 0, 0, 0, 0 }, //  
-    { 0, 0, 10, 0, 0, 0, 0 }, //  
-    { 0, 0, 8, 0, 0, 0, 0 }, //  
-    { 0, 0, 2, 0, 0, 0, 0 }, //  
-    { 0, 0, 0, 0, 0, 0, 0 }, // ​
-    { 2, 31, 0, -1, 22, 16, 0 }, // ‌
-    { 8, 34, 0, -4, 25, 68, 16 }, // ‍
-    { 14, 36, 0, -7, 27, 126, 84 }, // ‎
-    { 14, 36, 0, -7, 27, 126, 210 }, // ‏
-    { 12, 4, 14, 1, 12, 12, 336 }, // ‐
-    { 12, 4, 14, 1, 12, 12, 348 }, // ‑
-    { 18, 4, 24, 3, 15, 18, 360 }, // ‒
-    { 19, 4, 19, 0, 12, 19, 378 }, // –
-    { 38, 4, 38, 0, 12, 38, 397 }, // —
-    { 38, 4, 38, 0, 12, 38, 435 }, // ―
-    { 13, 39, 19, 3, 30, 127, 473 }, // ‖
-    { 19, 9, 19, 0, -1, 43, 600 }, // ‗
-    { 7, 13, 9, 1, 29, 23, 643 }, // ‘
-    { 7, 13, 9, 1, 29, 23, 666 }, // ’
-    { 7, 12, 9, 1, 5, 21, 689 }, // ‚
-    { 7, 13, 9, 1, 29, 23, 710 }, // ‛
-    { 15, 13, 17, 1, 29, 49, 733 }, // “
-    { 14, 13, 17, 1, 29, 46, 782 }, // ”
-    { 14, 12, 17, 1, 5, 42, 828 }, // „
-    { 15, 13, 17, 1, 29, 49, 870 }, // ‟
-    { 17, 25, 19, 1, 27, 107, 919 }, // †
-    { 17, 29, 19, 1, 27, 124, 1026 }, // ‡
-    { 9, 9, 11, 1, 14, 21, 1150 }, // •
-    { 14, 14, 24, 5, 20, 49, 1171 }, // ‣
-    { 6, 6, 10, 2, 5, 9, 1220 }, // ․
-    { 15, 6, 19, 2, 5, 23, 1229 }, // ‥
-    { 32, 6, 38, 3, 5, 48, 1252 }, // …
-    { 6, 6, 10, 2, 13, 9, 1300 }, // ‧
-    { 0, 0, 0, 0, 0, 0, 1309 }, //  
-    { 0, 0, 0, 0, 0, 0, 1309 }, //  
-    { 14, 36, 0, -7, 27, 126, 1309 }, // ‪
-    { 14, 36, 0, -7, 27, 126, 1435 }, // ‫
-    { 12, 35, 0, -6, 26, 105, 1561 }, // ‬
-    { 16, 36, 0, -8, 27, 144, 1666 }, // ‭
-    { 16, 36, 0, -8, 27, 144, 1810 }, // ‮
-    { 0, 0, 4, 0, 0, 0, 1954 }, //  
-    { 49, 30, 52, 2, 28, 368, 1954 }, // ‰
-    { 8, 13, 10, 1, 27, 26, 2322 }, // ′
-    { 16, 13, 17, 1, 27, 52, 2348 }, // ″
-    { 23, 13, 25, 1, 27, 75, 2400 }, // ‴
-    { 8, 13, 10, 1, 27, 26, 2475 }, // ‵
-    { 16, 13, 18, 1, 27, 52, 2501 }, // ‶
-    { 24, 13, 27, 1, 27, 78, 2553 }, // ‷
-    { 17, 8, 19, 1, 0, 34, 2631 }, // ‸
-    { 10, 15, 12, 1, 17, 38, 2665 }, // ‹
-    { 10, 15, 12, 1, 17, 38, 2703 }, // ›
-    { 24, 26, 24, 0, 25, 156, 2741 }, // ※
-    { 16, 30, 21, 3, 29, 120, 2897 }, // ‼
-    { 19, 3, 19, 0, 31, 15, 3017 }, // ‾
-    { 9, 4, 11, 1, 12, 9, 3032 }, // ⁃
-    { 19, 31, 7, -6, 28, 148, 3041 }, // ⁄
-    { 30, 29, 34, 2, 28, 218, 3189 }, // ⁇
-    { 25, 30, 28, 2, 29, 188, 3407 }, // ⁈
-    { 24, 30, 28, 3, 29, 180, 3595 }, // ⁉
-    { 22, 6, 38, 8, 14, 33, 3775 }, // ⁓
-    { 30, 13, 32, 1, 27, 98, 3808 }, // ⁗
-    { 0, 0, 8, 0, 0, 0, 3906 }, //  
-    { 0, 0, 0, 0, 0, 0, 3906 }, // ⁠
-    { 0, 0, 0, 0, 0, 0, 3906 }, // ⁡
-    { 0, 0, 0, 0, 0, 0, 3906 }, // ⁢
-    { 0, 0, 0, 0, 0, 0, 3906 }, // ⁣
-    { 0, 0, 0, 0, 0, 0, 3906 }, // ⁤
-    { 15, 19, 17, 1, 32, 72, 0 }, // ⁰
-    { 15, 19, 17, 1, 32, 72, 72 }, // ⁴
-    { 12, 18, 17, 2, 31, 54, 144 }, // ⁵
-    { 14, 19, 17, 2, 32, 67, 198 }, // ⁶
-    { 13, 18, 17, 3, 31, 59, 265 }, // ⁷
-    { 13, 19, 17, 2, 32, 62, 324 }, // ⁸
-    { 13, 19, 17, 2, 32, 62, 386 }, // ⁹
-    { 16, 14, 22, 3, 27, 56, 448 }, // ⁿ
-    { 15, 19, 17, 1, 13, 72, 504 }, // ₀
-    { 11, 18, 17, 3, 13, 50, 576 }, // ₁
-    { 14, 18, 17, 2, 13, 63, 626 }, // ₂
-    { 13, 19, 17, 2, 13, 62, 689 }, // ₃
-    { 15, 19, 17, 1, 13, 72, 751 }, // ₄
-    { 12, 18, 17, 2, 12, 54, 823 }, // ₅
-    { 14, 19, 17, 2, 13, 67, 877 }, // ₆
-    { 13, 18, 17, 3, 12, 59, 944 }, // ₇
-    { 13, 19, 17, 2, 13, 62, 1003 }, // ₈
-    { 13, 19, 17, 2, 13, 62, 1065 }, // ₉
-    { 19, 26, 24, 2, 26, 124, 0 }, // ₣
-    { 21, 28, 24, 1, 27, 147, 124 }, // ₤
-    { 45, 28, 48, 1, 27, 315, 271 }, // ₧
-    { 23, 28, 24, 0, 27, 161, 586 }, // €
-    { 22, 16, 38, 8, 21, 88, 0 }, // ←
-    { 16, 25, 38, 11, 26, 100, 88 }, // ↑
-    { 22, 16, 38, 8, 21, 88, 188 }, // →
-    { 16, 25, 38, 11, 26, 100, 276 }, // ↓
-    { 24, 16, 38, 7, 21, 96, 376 }, // ↔
-    { 16, 26, 38, 11, 26, 104, 472 }, // ↕
-    { 16, 25, 38, 11, 26, 100, 576 }, // ↨
-    { 16, 25, 38, 11, 26, 100, 676 }, // ↲
-    { 16, 25, 38, 11, 26, 100, 776 }, // ↳
-    { 20, 18, 38, 9, 22, 90, 876 }, // ↵
-    { 22, 17, 38, 8, 22, 94, 966 }, // ⇐
-    { 18, 22, 38, 10, 24, 99, 1060 }, // ⇑
-    { 22, 17, 38, 8, 22, 94, 1159 }, // ⇒
-    { 18, 22, 38, 10, 24, 99, 1253 }, // ⇓
-    { 24, 17, 38, 7, 22, 102, 1352 }, // ⇔
-    { 26, 28, 38, 6, 27, 182, 0 }, // ∀
-    { 19, 31, 24, 2, 30, 148, 182 }, // ∂
-    { 18, 27, 38, 10, 27, 122, 330 }, // ∃
-    { 28, 30, 38, 5, 28, 210, 452 }, // ∅
-    { 23, 27, 25, 1, 27, 156, 662 }, // ∆
-    { 24, 28, 38, 7, 27, 168, 818 }, // ∇
-    { 24, 27, 38, 7, 27, 162, 986 }, // ∈
-    { 24, 33, 38, 7, 29, 198, 1148 }, // ∉
-    { 24, 21, 38, 7, 24, 126, 1346 }, // ∊
-    { 24, 27, 38, 7, 27, 162, 1472 }, // ∋
-    { 24, 33, 38, 7, 29, 198, 1634 }, // ∌
-    { 24, 21, 38, 7, 24, 126, 1832 }, // ∍
-    { 29, 33, 31, 1, 27, 240, 1958 }, // ∏
-    { 23, 34, 23, 0, 27, 196, 2198 }, // ∑
-    { 17, 4, 24, 3, 15, 17, 2394 }, // −
-    { 17, 30, 19, 1, 28, 128, 2411 }, // ∕
-    { 17, 30, 20, 2, 28, 128, 2539 }, // ∖
-    { 17, 18, 24, 3, 22, 77, 2667 }, // ∗
-    { 13, 13, 24, 5, 19, 43, 2744 }, // ∘
-    { 6, 6, 24, 9, 13, 9, 2787 }, // ∙
-    { 24, 36, 24, 0, 31, 216, 2796 }, // √
-    { 19, 14, 24, 2, 19, 67, 3012 }, // ∝
-    { 24, 14, 24, 0, 19, 84, 3079 }, // ∞
-    { 24, 27, 38, 7, 27, 162, 3163 }, // ∟
-    { 26, 27, 38, 5, 27, 176, 3325 }, // ∠
-    { 5, 39, 19, 7, 30, 49, 3501 }, // ∣
-    { 11, 39, 19, 4, 30, 108, 3550 }, // ∥
-    { 24, 27, 38, 7, 27, 162, 3658 }, // ∧
-    { 24, 27, 38, 7, 27, 162, 3820 }, // ∨
-    { 22, 27, 38, 8, 27, 149, 3982 }, // ∩
-    { 22, 28, 38, 8, 27, 154, 4131 }, // ∪
-    { 20, 39, 24, 2, 30, 195, 4285 }, // ∫
-    { 24, 22, 38, 7, 21, 132, 4480 }, // ∴
-    { 24, 22, 38, 7, 21, 132, 4612 }, // ∵
-    { 6, 20, 12, 3, 23, 30, 4744 }, // ∶
-    { 24, 22, 38, 7, 21, 132, 4774 }, // ∷
-    { 22, 6, 38, 8, 14, 33, 4906 }, // ∼
-    { 22, 20, 38, 8, 23, 110, 4939 }, // ≅
-    { 18, 14, 24, 3, 20, 63, 5049 }, // ≈
-    { 22, 13, 38, 8, 17, 72, 5112 }, // ≍
-    { 17, 17, 24, 3, 21, 73, 5184 }, // ≠
-    { 20, 17, 38, 9, 20, 85, 5257 }, // ≡
-    { 17, 23, 24, 3, 23, 98, 5342 }, // ≤
-    { 17, 23, 24, 3, 23, 98, 5440 }, // ≥
-    { 30, 18, 38, 4, 22, 135, 5538 }, // ≪
-    { 30, 18, 38, 4, 22, 135, 5673 }, // ≫
-    { 24, 21, 38, 7, 24, 126, 5808 }, // ⊃
-    { 24, 34, 38, 7, 30, 204, 5934 }, // ⊄
-    { 24, 34, 38, 7, 30, 204, 6138 }, // ⊅
-    { 24, 27, 38, 7, 27, 162, 6342 }, // ⊆
-    { 24, 27, 38, 7, 27, 162, 6504 }, // ⊇
-    { 28, 28, 38, 5, 27, 196, 6666 }, // ⊕
-    { 28, 28, 38, 5, 27, 196, 6862 }, // ⊖
-    { 28, 28, 38, 5, 27, 196, 7058 }, // ⊗
-    { 28, 28, 38, 5, 27, 196, 7254 }, // ⊘
-    { 22, 27, 38, 8, 27, 149, 7450 }, // ⊥
-    { 6, 6, 24, 9, 13, 9, 7599 }, // ⋅
-    { 32, 6, 38, 3, 13, 48, 7608 }, // ⋯
-    { 36, 36, 38, 1, 32, 324, 0 }, // �
+    { 19, 15, 20, 1, 17, 72, 12134 }, // «
+    { 17, 9, 24, 3, 18, 39, 1063 }, // ¬
+    { 12, 4, 14, 1, 12, 12, 1102 }, // ­
+    { 20, 21, 22, 1, 30, 105, 1114 }, // ®
+    { 13, 4, 26, 6, 28, 13, 1219 }, // ¯
+    { 14, 13, 20, 3, 27, 46, 1232 }, // °
+    { 17, 23, 24, 3, 23, 98, 1278 }, // ±
+    { 14, 18, 17, 2, 32, 63, 1376 }, // ²
+    { 13, 19, 17, 2, 32, 62, 1439 }, // ³
+    { 8, 10, 26, 9, 32, 20, 1501 }, // ´
+    { 24, 29, 25, 2, 20, 174, 1521 }, // µ
+    { 20, 33, 21, 0, 27, 165, 1695 }, // ¶
+    { 6, 6, 10, 2, 13, 9, 1860 }, // ·
+    { 8, 9, 26, 9, -1, 18, 1869 }, // ¸
+    { 11, 18, 17, 3, 32, 50, 1887 }, // ¹
+    { 14, 18, 17, 2, 27, 63, 1937 }, // º
+    { 20, 15, 20, 1, 17, 75, 12206 }, // »
+    { 37, 31, 41, 3, 28, 287, 2000 }, // ¼
+    { 37, 31, 41, 3, 28, 287, 2287 }, // ½
+    { 38, 31, 41, 2, 28, 295, 2574 }, // ¾
+    { 14, 30, 18, 2, 21, 105, 2869 }, // ¿
+    { 28, 37, 28, 0, 37, 259, 12281 }, // À
+    { 28, 37, 28, 0, 37, 259, 12540 }, // Á
+    { 28, 36, 28, 0, 36, 252, 12799 }, // Â
+    { 28, 36, 28, 0, 36, 252, 2974 }, // Ã
+    { 28, 35, 28, 0, 35, 245, 13051 }, // Ä
+    { 28, 38, 28, 0, 38, 266, 3226 }, // Å
+    { 35, 27, 35, -1, 27, 237, 3492 }, // Æ
+    { 22, 37, 24, 1, 27, 204, 13296 }, // Ç
+    { 22, 37, 24, 1, 37, 204, 13500 }, // È
+    { 22, 37, 24, 1, 37, 204, 13704 }, // É
+    { 22, 36, 24, 1, 36, 198, 13908 }, // Ê
+    { 22, 35, 24, 1, 35, 193, 14106 }, // Ë
+    { 12, 37, 14, 1, 37, 111, 14299 }, // Ì
+    { 12, 37, 14, 1, 37, 111, 14410 }, // Í
+    { 14, 36, 14, 0, 36, 126, 14521 }, // Î
+    { 14, 35, 14, 0, 35, 123, 14647 }, // Ï
+    { 26, 28, 28, 1, 27, 182, 3729 }, // Ð
+    { 30, 37, 31, 1, 36, 278, 14770 }, // Ñ
+    { 27, 38, 30, 1, 37, 257, 15048 }, // Ò
+    { 27, 38, 30, 1, 37, 257, 15305 }, // Ó
+    { 27, 37, 30, 1, 36, 250, 15562 }, // Ô
+    { 27, 37, 30, 1, 36, 250, 3911 }, // Õ
+    { 27, 36, 30, 1, 35, 243, 15812 }, // Ö
+    { 16, 16, 24, 4, 21, 64, 4161 }, // ×
+    { 29, 28, 30, 0, 27, 203, 4225 }, // Ø
+    { 29, 38, 29, 0, 37, 276, 16055 }, // Ù
+    { 29, 38, 29, 0, 37, 276, 16331 }, // Ú
+    { 29, 37, 29, 0, 36, 269, 16607 }, // Û
+    { 29, 36, 29, 0, 35, 261, 16876 }, // Ü
+    { 26, 37, 26, 0, 37, 241, 4428 }, // Ý
+    { 21, 27, 24, 1, 27, 142, 4669 }, // Þ
+    { 23, 31, 25, 1, 30, 179, 4811 }, // ß
+    { 20, 33, 21, 1, 32, 165, 17137 }, // à
+    { 20, 33, 21, 1, 32, 165, 17302 }, // á
+    { 20, 32, 21, 1, 31, 160, 17467 }, // â
+    { 20, 31, 21, 1, 30, 155, 4990 }, // ã
+    { 20, 30, 21, 1, 29, 150, 17627 }, // ä
+    { 20, 33, 21, 1, 32, 165, 5145 }, // å
+    { 29, 22, 31, 1, 21, 160, 5310 }, // æ
+    { 17, 31, 19, 1, 21, 132, 17777 }, // ç
+    { 18, 33, 20, 1, 32, 149, 17909 }, // è
+    { 18, 33, 20, 1, 32, 149, 18058 }, // é
+    { 18, 32, 20, 1, 31, 144, 18207 }, // ê
+    { 18, 30, 20, 1, 29, 135, 18351 }, // ë
+    { 12, 32, 13, 0, 32, 96, 18486 }, // ì
+    { 12, 32, 13, 0, 32, 96, 18582 }, // í
+    { 13, 31, 13, 0, 31, 101, 18678 }, // î
+    { 14, 29, 13, -1, 29, 102, 18779 }, // ï
+    { 20, 32, 23, 1, 31, 160, 5470 }, // ð
+    { 25, 30, 26, 0, 30, 188, 18881 }, // ñ
+    { 21, 33, 23, 1, 32, 174, 19069 }, // ò
+    { 21, 33, 23, 1, 32, 174, 19243 }, // ó
+    { 21, 32, 23, 1, 31, 168, 19417 }, // ô
+    { 21, 31, 23, 1, 30, 163, 5630 }, // õ
+    { 21, 30, 23, 1, 29, 158, 19585 }, // ö
+    { 17, 18, 24, 3, 22, 77, 5793 }, // ÷
+    { 22, 22, 23, 0, 21, 121, 5870 }, // ø
+    { 25, 33, 25, 0, 32, 207, 19743 }, // ù
+    { 25, 33, 25, 0, 32, 207, 19950 }, // ú
+    { 25, 32, 25, 0, 31, 200, 20157 }, // û
+    { 25, 30, 25, 0, 29, 188, 20357 }, // ü
+    { 23, 41, 23, 0, 32, 236, 5991 }, // ý
+    { 23, 39, 24, 0, 30, 225, 6227 }, // þ
+    { 23, 38, 23, 0, 29, 219, 6452 }, // ÿ
+    { 28, 34, 28, 0, 34, 238, 6671 }, // Ā
+    { 20, 29, 21, 1, 28, 145, 6909 }, // ā
+    { 28, 36, 28, 0, 36, 252, 7054 }, // Ă
+    { 20, 31, 21, 1, 30, 155, 7306 }, // ă
+    { 28, 35, 28, 0, 27, 245, 7461 }, // Ą
+    { 20, 29, 21, 1, 21, 145, 7706 }, // ą
+    { 22, 38, 24, 1, 37, 209, 7851 }, // Ć
+    { 17, 33, 19, 1, 32, 141, 8060 }, // ć
+    { 22, 37, 24, 1, 36, 204, 8201 }, // Ĉ
+    { 17, 32, 19, 1, 31, 136, 8405 }, // ĉ
+    { 22, 37, 24, 1, 36, 204, 8541 }, // Ċ
+    { 17, 30, 19, 1, 29, 128, 8745 }, // ċ
+    { 22, 38, 24, 1, 37, 209, 8873 }, // Č
+    { 17, 32, 19, 1, 31, 136, 9082 }, // č
+    { 26, 38, 28, 1, 37, 247, 9218 }, // Ď
+    { 26, 31, 24, 1, 30, 202, 9465 }, // ď
+    { 26, 28, 28, 1, 27, 182, 9667 }, // Đ
+    { 23, 31, 24, 1, 30, 179, 9849 }, // đ
+    { 22, 34, 24, 1, 34, 187, 10028 }, // Ē
+    { 18, 29, 20, 1, 28, 131, 10215 }, // ē
+    { 22, 36, 24, 1, 36, 198, 10346 }, // Ĕ
+    { 18, 31, 20, 1, 30, 140, 10544 }, // ĕ
+    { 22, 36, 24, 1, 36, 198, 10684 }, // Ė
+    { 18, 30, 20, 1, 29, 135, 10882 }, // ė
+    { 22, 35, 24, 1, 27, 193, 11017 }, // Ę
+    { 18, 29, 20, 1, 21, 131, 11210 }, // ę
+    { 22, 37, 24, 1, 37, 204, 11341 }, // Ě
+    { 18, 32, 20, 1, 31, 144, 11545 }, // ě
+    { 25, 37, 28, 1, 36, 232, 11689 }, // Ĝ
+    { 22, 40, 22, 0, 31, 220, 11921 }, // ĝ
+    { 25, 37, 28, 1, 36, 232, 12141 }, // Ğ
+    { 22, 39, 22, 0, 30, 215, 12373 }, // ğ
+    { 25, 37, 28, 1, 36, 232, 12588 }, // Ġ
+    { 22, 38, 22, 0, 29, 209, 12820 }, // ġ
+    { 25, 37, 28, 1, 27, 232, 13029 }, // Ģ
+    { 22, 41, 22, 0, 32, 226, 13261 }, // ģ
+    { 30, 36, 32, 1, 36, 270, 13487 }, // Ĥ
+    { 26, 39, 25, -1, 39, 254, 13757 }, // ĥ
+    { 30, 27, 32, 1, 27, 203, 14011 }, // Ħ
+    { 25, 30, 25, 0, 30, 188, 14214 }, // ħ
+    { 13, 36, 14, 1, 36, 117, 14402 }, // Ĩ
+    { 13, 30, 13, 0, 30, 98, 14519 }, // ĩ
+    { 14, 34, 14, 0, 34, 119, 14617 }, // Ī
+    { 13, 28, 13, 0, 28, 91, 14736 }, // ī
+    { 14, 36, 14, 0, 36, 126, 14827 }, // Ĭ
+    { 13, 30, 13, 0, 30, 98, 14953 }, // ĭ
+    { 12, 35, 14, 1, 27, 105, 15051 }, // Į
+    { 12, 38, 13, 0, 30, 114, 15156 }, // į
+    { 12, 36, 14, 1, 36, 108, 15270 }, // İ
+    { 12, 20, 13, 0, 20, 60, 15378 }, // ı
+    { 26, 35, 27, 1, 27, 228, 15438 }, // Ĳ
+    { 21, 39, 23, 0, 30, 205, 15666 }, // ĳ
+    { 16, 44, 14, -2, 36, 176, 15871 }, // Ĵ
+    { 15, 40, 11, -3, 31, 150, 16047 }, // ĵ
+    { 27, 37, 28, 1, 27, 250, 16197 }, // Ķ
+    { 23, 40, 23, 0, 30, 230, 16447 }, // ķ
+    { 24, 21, 23, 0, 20, 126, 16677 }, // ĸ
+    { 22, 37, 23, 1, 37, 204, 16803 }, // Ĺ
+    { 12, 39, 12, 0, 39, 117, 17007 }, // ĺ
+    { 22, 37, 23, 1, 27, 204, 17124 }, // Ļ
+    { 12, 40, 12, 0, 30, 120, 17328 }, // ļ
+    { 22, 30, 23, 1, 30, 165, 17448 }, // Ľ
+    { 16, 30, 13, 0, 30, 120, 17613 }, // ľ
+    { 22, 27, 23, 1, 27, 149, 17733 }, // Ŀ
+    { 18, 30, 18, 0, 30, 135, 17882 }, // ŀ
+    { 24, 27, 23, -1, 27, 162, 18017 }, // Ł
+    { 14, 30, 12, -1, 30, 105, 18179 }, // ł
+    { 30, 38, 31, 1, 37, 285, 18284 }, // Ń
+    { 25, 32, 26, 0, 32, 200, 18569 }, // ń
+    { 30, 37, 31, 1, 27, 278, 18769 }, // Ņ
+    { 25, 31, 26, 0, 21, 194, 19047 }, // ņ
+    { 30, 38, 31, 1, 37, 285, 19241 }, // Ň
+    { 25, 31, 26, 0, 31, 194, 19526 }, // ň
+    { 33, 29, 34, 1, 29, 240, 19720 }, // ŉ
+    { 30, 35, 31, 1, 27, 263, 19960 }, // Ŋ
+    { 22, 30, 24, 0, 21, 165, 20223 }, // ŋ
+    { 27, 35, 30, 1, 34, 237, 20388 }, // Ō
+    { 21, 29, 23, 1, 28, 153, 20625 }, // ō
+    { 27, 37, 30, 1, 36, 250, 20778 }, // Ŏ
+    { 21, 31, 23, 1, 30, 163, 21028 }, // ŏ
+    { 27, 38, 30, 1, 37, 257, 21191 }, // Ő
+    { 21, 32, 23, 1, 31, 168, 21448 }, // ő
+    { 35, 28, 37, 1, 27, 245, 20545 }, // Œ
+    { 32, 22, 34, 1, 21, 176, 20790 }, // œ
+    { 26, 38, 26, 1, 37, 247, 21616 }, // Ŕ
+    { 17, 32, 18, 0, 32, 136, 21863 }, // ŕ
+    { 26, 37, 26, 1, 27, 241, 21999 }, // Ŗ
+    { 17, 31, 18, 0, 21, 132, 22240 }, // ŗ
+    { 26, 38, 26, 1, 37, 247, 22372 }, // Ř
+    { 17, 31, 18, 0, 31, 132, 22619 }, // ř
+    { 18, 38, 21, 1, 37, 171, 22751 }, // Ś
+    { 15, 33, 18, 2, 32, 124, 22922 }, // ś
+    { 18, 37, 21, 1, 36, 167, 23046 }, // Ŝ
+    { 15, 32, 18, 2, 31, 120, 23213 }, // ŝ
+    { 18, 37, 21, 1, 27, 167, 23333 }, // Ş
+    { 15, 31, 18, 2, 21, 117, 23500 }, // ş
+    { 18, 38, 21, 1, 37, 171, 23617 }, // Š
+    { 15, 32, 18, 2, 31, 120, 23788 }, // š
+    { 24, 37, 26, 1, 27, 222, 23908 }, // Ţ
+    { 15, 35, 16, 0, 25, 132, 24130 }, // ţ
+    { 24, 37, 26, 1, 37, 222, 24262 }, // Ť
+    { 15, 32, 16, 0, 31, 120, 24484 }, // ť
+    { 24, 27, 26, 1, 27, 162, 24604 }, // Ŧ
+    { 15, 26, 16, 0, 25, 98, 24766 }, // ŧ
+    { 29, 37, 29, 0, 36, 269, 24864 }, // Ũ
+    { 25, 31, 25, 0, 30, 194, 25133 }, // ũ
+    { 29, 35, 29, 0, 34, 254, 25327 }, // Ū
+    { 25, 29, 25, 0, 28, 182, 25581 }, // ū
+    { 29, 37, 29, 0, 36, 269, 25763 }, // Ŭ
+    { 25, 31, 25, 0, 30, 194, 26032 }, // ŭ
+    { 29, 39, 29, 0, 38, 283, 26226 }, // Ů
+    { 25, 33, 25, 0, 32, 207, 26509 }, // ů
+    { 29, 38, 29, 0, 37, 276, 26716 }, // Ű
+    { 25, 32, 25, 0, 31, 200, 26992 }, // ű
+    { 29, 35, 29, 0, 27, 254, 27192 }, // Ų
+    { 25, 28, 25, 0, 20, 175, 27446 }, // ų
+    { 42, 37, 42, 0, 36, 389, 27621 }, // Ŵ
+    { 34, 32, 34, 0, 31, 272, 28010 }, // ŵ
+    { 26, 36, 26, 0, 36, 234, 28282 }, // Ŷ
+    { 23, 40, 23, 0, 31, 230, 28516 }, // ŷ
+    { 26, 35, 26, 0, 35, 228, 28746 }, // Ÿ
+    { 21, 38, 23, 1, 37, 200, 28974 }, // Ź
+    { 17, 33, 19, 1, 32, 141, 29174 }, // ź
+    { 21, 37, 23, 1, 36, 195, 29315 }, // Ż
+    { 17, 30, 19, 1, 29, 128, 29510 }, // ż
+    { 21, 38, 23, 1, 37, 200, 29638 }, // Ž
+    { 17, 32, 19, 1, 31, 136, 29838 }, // ž
+    { 18, 30, 15, 1, 30, 135, 29974 }, // ſ
+    { 9, 10, 0, -6, 32, 23, 30109 }, // ̀
+    { 8, 10, 0, -2, 32, 20, 30132 }, // ́
+    { 13, 9, 0, -7, 31, 30, 30152 }, // ̂
+    { 14, 7, 0, -7, 30, 25, 30182 }, // ̃
+    { 14, 4, 0, -7, 28, 14, 30207 }, // ̄
+    { 13, 7, 0, -7, 30, 23, 30221 }, // ̆
+    { 6, 6, 0, -3, 29, 9, 30244 }, // ̇
+    { 14, 6, 0, -7, 29, 21, 30253 }, // ̈
+    { 11, 11, 0, -5, 33, 31, 30274 }, // ̉
+    { 10, 11, 0, -5, 32, 28, 30305 }, // ̊
+    { 13, 9, 0, -5, 31, 30, 30333 }, // ̋
+    { 14, 9, 0, -7, 31, 32, 30363 }, // ̌
+    { 13, 9, 0, -8, 31, 30, 30395 }, // ̏
+    { 14, 7, 0, -7, 30, 25, 30425 }, // ̑
+    { 6, 11, 0, -3, 32, 17, 30450 }, // ̒
+    { 7, 11, 0, -3, 33, 20, 30467 }, // ̓
+    { 7, 11, 0, -4, 33, 20, 30487 }, // ̔
+    { 5, 10, 0, -2, 33, 13, 30507 }, // ̕
+    { 6, 9, 0, -3, 24, 14, 30520 }, // ̛
+    { 6, 6, 0, -3, -3, 9, 30534 }, // ̣
+    { 14, 6, 0, -7, -3, 21, 30543 }, // ̤
+    { 10, 9, 0, -5, -1, 23, 30564 }, // ̥
+    { 7, 9, 0, -4, -1, 16, 30587 }, // ̦
+    { 8, 9, 0, -4, -1, 18, 30603 }, // ̧
+    { 8, 9, 0, -4, 1, 18, 30621 }, // ̨
+    { 4, 8, 10, 3, -2, 8, 30639 }, // ̩
+    { 12, 8, 0, -6, -2, 24, 30647 }, // ̭
+    { 13, 7, 0, -7, -2, 23, 30671 }, // ̮
+    { 14, 7, 0, -7, -2, 25, 30694 }, // ̰
+    { 14, 4, 0, -7, -4, 14, 30719 }, // ̱
+    { 14, 7, 0, -7, 30, 25, 30733 }, // ͂
+    { 14, 15, 0, -7, 38, 53, 30758 }, // ̈́
+    { 7, 8, 0, -2, -2, 14, 30811 }, // ͅ
+    { 22, 37, 24, 1, 37, 204, 30825 }, // Ѐ
+    { 22, 35, 24, 1, 35, 193, 0 }, // Ё
+    { 29, 35, 31, 1, 27, 254, 31029 }, // Ђ
+    { 20, 37, 22, 1, 37, 185, 31283 }, // Ѓ
+    { 23, 28, 25, 1, 27, 161, 31468 }, // Є
+    { 18, 28, 21, 1, 27, 126, 31629 }, // Ѕ
+    { 12, 27, 14, 1, 27, 81, 31755 }, // І
+    { 14, 35, 14, 0, 35, 123, 31836 }, // Ї
+    { 15, 35, 14, -2, 27, 132, 31959 }, // Ј
+    { 36, 28, 37, 0, 27, 252, 32091 }, // Љ
+    { 37, 28, 39, 1, 27, 259, 32343 }, // Њ
+    { 31, 27, 33, 1, 27, 210, 32602 }, // Ћ
+    { 26, 38, 27, 1, 37, 247, 32812 }, // Ќ
+    { 30, 37, 32, 1, 37, 278, 33059 }, // Ѝ
+    { 28, 37, 28, 0, 36, 259, 33337 }, // Ў
+    { 28, 36, 30, 1, 27, 252, 33596 }, // Џ
+    { 28, 27, 28, 0, 27, 189, 193 }, // А
+    { 22, 28, 24, 1, 27, 154, 382 }, // Б
+    { 22, 28, 24, 1, 27, 154, 536 }, // В
+    { 20, 27, 22, 1, 27, 135, 690 }, // Г
+    { 28, 35, 28, 0, 27, 245, 825 }, // Д
+    { 22, 27, 24, 1, 27, 149, 1070 }, // Е
+    { 38, 28, 39, 0, 27, 266, 1219 }, // Ж
+    { 20, 28, 22, 1, 27, 140, 1485 }, // З
+    { 30, 27, 32, 1, 27, 203, 1625 }, // И
+    { 30, 36, 32, 1, 36, 270, 1828 }, // Й
+    { 26, 28, 27, 1, 27, 182, 2098 }, // К
+    { 27, 28, 28, 0, 27, 189, 2280 }, // Л
+    { 34, 27, 34, 0, 27, 230, 2469 }, // М
+    { 30, 27, 32, 1, 27, 203, 2699 }, // Н
+    { 27, 28, 30, 1, 27, 189, 2902 }, // О
+    { 29, 27, 31, 1, 27, 196, 3091 }, // П
+    { 21, 27, 23, 1, 27, 142, 3287 }, // Р
+    { 22, 28, 24, 1, 27, 154, 3429 }, // С
+    { 24, 27, 26, 1, 27, 162, 3583 }, // Т
+    { 28, 28, 28, 0, 27, 196, 3745 }, // У
+    { 28, 29, 30, 1, 28, 203, 3941 }, // Ф
+    { 28, 27, 28, 0, 27, 189, 4144 }, // Х
+    { 29, 35, 30, 1, 27, 254, 4333 }, // Ц
+    { 26, 27, 27, 0, 27, 176, 4587 }, // Ч
+    { 38, 27, 40, 1, 27, 257, 4763 }, // Ш
+    { 39, 35, 40, 1, 27, 342, 5020 }, // Щ
+    { 27, 28, 29, 1, 27, 189, 5362 }, // Ъ
+    { 34, 28, 36, 1, 27, 238, 5551 }, // Ы
+    { 22, 28, 24, 1, 27, 154, 5789 }, // Ь
+    { 23, 28, 25, 1, 27, 161, 5943 }, // Э
+    { 38, 28, 40, 1, 27, 266, 6104 }, // Ю
+    { 25, 28, 25, -1, 27, 175, 6370 }, // Я
+    { 20, 22, 21, 1, 21, 110, 6545 }, // а
+    { 20, 31, 22, 1, 30, 155, 6655 }, // б
+    { 19, 21, 21, 1, 20, 100, 6810 }, // в
+    { 17, 20, 19, 1, 20, 85, 6910 }, // г
+    { 24, 27, 24, 0, 20, 162, 6995 }, // д
+    { 18, 22, 20, 1, 21, 99, 7157 }, // е
+    { 31, 22, 31, 0, 21, 171, 7256 }, // ж
+    { 16, 22, 18, 1, 21, 88, 7427 }, // з
+    { 24, 20, 26, 1, 20, 120, 7515 }, // и
+    { 24, 29, 26, 1, 29, 174, 7635 }, // й
+    { 21, 22, 22, 1, 21, 116, 7809 }, // к
+    { 23, 21, 24, 0, 20, 121, 7925 }, // л
+    { 27, 20, 29, 1, 20, 135, 8046 }, // м
+    { 24, 20, 26, 1, 20, 120, 8181 }, // н
+    { 21, 22, 23, 1, 21, 116, 8301 }, // о
+    { 24, 20, 26, 1, 20, 120, 8417 }, // п
+    { 22, 30, 23, 0, 21, 165, 8537 }, // р
+    { 17, 22, 19, 1, 21, 94, 8702 }, // с
+    { 19, 20, 21, 1, 20, 95, 8796 }, // т
+    { 23, 29, 23, 0, 20, 167, 8891 }, // у
+    { 26, 39, 28, 1, 30, 254, 9058 }, // ф
+    { 23, 20, 23, 0, 20, 115, 9312 }, // х
+    { 25, 27, 26, 1, 20, 169, 9427 }, // ц
+    { 22, 20, 23, 0, 20, 110, 9596 }, // ч
+    { 32, 20, 34, 1, 20, 160, 9706 }, // ш
+    { 32, 27, 34, 1, 20, 216, 9866 }, // щ
+    { 23, 21, 24, 1, 20, 121, 10082 }, // ъ
+    { 29, 21, 31, 1, 20, 153, 10203 }, // ы
+    { 19, 21, 20, 1, 20, 100, 10356 }, // ь
+    { 17, 22, 20, 1, 21, 94, 10456 }, // э
+    { 30, 22, 32, 1, 21, 165, 10550 }, // ю
+    { 21, 21, 22, 0, 20, 111, 10715 }, // я
+    { 18, 33, 20, 1, 32, 149, 33848 }, // ѐ
+    { 18, 30, 20, 1, 29, 135, 10826 }, // ё
+    { 22, 39, 24, 0, 30, 215, 33997 }, // ђ
+    { 17, 32, 19, 1, 32, 136, 34212 }, // ѓ
+    { 18, 22, 20, 1, 21, 99, 34348 }, // є
+    { 15, 22, 18, 2, 21, 83, 34447 }, // ѕ
+    { 12, 30, 13, 0, 30, 90, 34530 }, // і
+    { 14, 29, 13, -1, 29, 102, 34620 }, // ї
+    { 12, 39, 11, -3, 30, 117, 34722 }, // ј
+    { 30, 21, 30, 0, 20, 158, 34839 }, // љ
+    { 31, 21, 32, 1, 20, 163, 34997 }, // њ
+    { 25, 30, 25, 0, 30, 188, 35160 }, // ћ
+    { 21, 33, 22, 1, 32, 174, 35348 }, // ќ
+    { 24, 32, 26, 1, 32, 192, 35522 }, // ѝ
+    { 23, 38, 23, 0, 29, 219, 35714 }, // ў
+    { 24, 28, 26, 1, 20, 168, 35933 }, // џ
+    { 27, 31, 28, 0, 30, 210, 36101 }, // Ѣ
+    { 22, 28, 23, 1, 27, 154, 36311 }, // ѣ
+    { 27, 28, 30, 1, 27, 189, 36465 }, // Ѳ
+    { 21, 22, 23, 1, 21, 116, 36654 }, // ѳ
+    { 29, 28, 28, 0, 27, 203, 36770 }, // Ѵ
+    { 24, 22, 23, 0, 21, 132, 36973 }, // ѵ
+    { 30, 44, 32, 1, 36, 330, 37105 }, // Ҋ
+    { 25, 36, 26, 1, 29, 225, 37435 }, // ҋ
+    { 22, 28, 24, 1, 27, 154, 37660 }, // Ҍ
+    { 19, 28, 20, 0, 27, 133, 37814 }, // ҍ
+    { 21, 27, 23, 1, 27, 142, 37947 }, // Ҏ
+    { 22, 30, 23, 0, 21, 165, 38089 }, // ҏ
+    { 20, 32, 21, 1, 32, 160, 38254 }, // Ґ
+    { 17, 25, 18, 1, 25, 107, 38414 }, // ґ
+    { 20, 27, 22, 1, 27, 135, 38521 }, // Ғ
+    { 17, 20, 19, 1, 20, 85, 38656 }, // ғ
+    { 23, 35, 25, 1, 27, 202, 38741 }, // Ҕ
+    { 21, 29, 23, 1, 20, 153, 38943 }, // ҕ
+    { 38, 35, 39, 0, 27, 333, 39096 }, // Җ
+    { 31, 28, 31, 0, 21, 217, 39429 }, // җ
+    { 20, 35, 22, 1, 27, 175, 0 }, // Ҙ
+    { 16, 29, 18, 1, 21, 116, 175 }, // ҙ
+    { 26, 35, 27, 1, 27, 228, 291 }, // Қ
+    { 21, 28, 22, 1, 21, 147, 519 }, // қ
+    { 27, 28, 28, 1, 27, 189, 666 }, // Ҝ
+    { 22, 22, 23, 1, 21, 121, 855 }, // ҝ
+    { 26, 28, 27, 1, 27, 182, 976 }, // Ҟ
+    { 21, 28, 21, 0, 27, 147, 1158 }, // ҟ
+    { 31, 28, 32, 1, 27, 217, 1305 }, // Ҡ
+    { 24, 22, 25, 1, 21, 132, 1522 }, // ҡ
+    { 30, 35, 32, 1, 27, 263, 1654 }, // Ң
+    { 25, 27, 27, 1, 20, 169, 1917 }, // ң
+    { 35, 27, 37, 1, 27, 237, 2086 }, // Ҥ
+    { 28, 20, 30, 1, 20, 140, 2323 }, // ҥ
+    { 38, 35, 40, 1, 27, 333, 2463 }, // Ҧ
+    { 34, 29, 37, 1, 20, 247, 2796 }, // ҧ
+    { 30, 28, 31, 1, 27, 210, 3043 }, // Ҩ
+    { 23, 22, 24, 1, 21, 127, 3253 }, // ҩ
+    { 22, 35, 24, 1, 27, 193, 3380 }, // Ҫ
+    { 17, 29, 19, 1, 21, 124, 3573 }, // ҫ
+    { 24, 35, 26, 1, 27, 210, 3697 }, // Ҭ
+    { 19, 27, 21, 1, 20, 129, 3907 }, // ҭ
+    { 26, 27, 26, 0, 27, 176, 4036 }, // Ү
+    { 23, 29, 23, 0, 20, 167, 4212 }, // ү
+    { 26, 27, 26, 0, 27, 176, 4379 }, // Ұ
+    { 23, 29, 23, 0, 20, 167, 4555 }, // ұ
+    { 28, 35, 28, 0, 27, 245, 4722 }, // Ҳ
+    { 23, 27, 23, 0, 20, 156, 4967 }, // ҳ
+    { 33, 35, 35, 1, 27, 289, 5123 }, // Ҵ
+    { 28, 27, 30, 1, 20, 189, 5412 }, // ҵ
+    { 27, 35, 27, 0, 27, 237, 5601 }, // Ҷ
+    { 23, 27, 24, 0, 20, 156, 5838 }, // ҷ
+    { 26, 27, 27, 0, 27, 176, 5994 }, // Ҹ
+    { 22, 20, 23, 0, 20, 110, 6170 }, // ҹ
+    { 26, 27, 27, 1, 27, 176, 6280 }, // Һ
+    { 25, 30, 25, 0, 30, 188, 6456 }, // һ
+    { 30, 28, 31, 0, 27, 210, 6644 }, // Ҽ
+    { 23, 22, 24, 0, 21, 127, 6854 }, // ҽ
+    { 30, 35, 31, 0, 27, 263, 6981 }, // Ҿ
+    { 23, 29, 24, 0, 21, 167, 7244 }, // ҿ
+    { 12, 27, 14, 1, 27, 81, 7411 }, // Ӏ
+    { 38, 37, 38, 0, 36, 352, 7492 }, // Ӂ
+    { 31, 30, 31, 0, 29, 233, 7844 }, // ӂ
+    { 25, 35, 26, 1, 27, 219, 8077 }, // Ӄ
+    { 20, 30, 23, 1, 21, 150, 8296 }, // ӄ
+    { 27, 35, 28, 0, 27, 237, 8446 }, // Ӆ
+    { 23, 27, 24, 0, 20, 156, 8683 }, // ӆ
+    { 30, 35, 31, 1, 27, 263, 8839 }, // Ӈ
+    { 24, 29, 26, 1, 20, 174, 9102 }, // ӈ
+    { 30, 35, 32, 1, 27, 263, 9276 }, // Ӊ
+    { 25, 27, 26, 1, 20, 169, 9539 }, // ӊ
+    { 26, 35, 27, 0, 27, 228, 9708 }, // Ӌ
+    { 22, 27, 23, 0, 20, 149, 9936 }, // ӌ
+    { 34, 35, 34, 0, 27, 298, 10085 }, // Ӎ
+    { 28, 27, 29, 1, 20, 189, 10383 }, // ӎ
+    { 12, 29, 12, 0, 29, 87, 10572 }, // ӏ
+    { 28, 36, 28, 0, 36, 252, 10659 }, // Ӑ
+    { 20, 30, 21, 1, 29, 150, 10911 }, // ӑ
+    { 28, 35, 28, 0, 35, 245, 11061 }, // Ӓ
+    { 20, 30, 21, 1, 29, 150, 11306 }, // ӓ
+    { 35, 27, 35, -1, 27, 237, 11456 }, // Ӕ
+    { 29, 22, 31, 1, 21, 160, 11693 }, // ӕ
+    { 22, 36, 24, 1, 36, 198, 11853 }, // Ӗ
+    { 18, 30, 20, 1, 29, 135, 12051 }, // ӗ
+    { 24, 28, 26, 1, 27, 168, 12186 }, // Ә
+    { 18, 22, 20, 1, 21, 99, 12354 }, // ә
+    { 24, 36, 26, 1, 35, 216, 12453 }, // Ӛ
+    { 18, 30, 20, 1, 29, 135, 12669 }, // ӛ
+    { 38, 36, 38, 0, 35, 342, 12804 }, // Ӝ
+    { 31, 30, 31, 0, 29, 233, 13146 }, // ӝ
+    { 20, 36, 22, 1, 35, 180, 13379 }, // Ӟ
+    { 16, 30, 18, 1, 29, 120, 13559 }, // ӟ
+    { 20, 28, 22, 1, 27, 140, 13679 }, // Ӡ
+    { 18, 29, 19, 0, 20, 131, 13819 }, // ӡ
+    { 30, 34, 32, 1, 34, 255, 13950 }, // Ӣ
+    { 24, 28, 26, 1, 28, 168, 14205 }, // ӣ
+    { 30, 35, 32, 1, 35, 263, 14373 }, // Ӥ
+    { 24, 29, 26, 1, 29, 174, 14636 }, // ӥ
+    { 27, 36, 30, 1, 35, 243, 14810 }, // Ӧ
+    { 21, 30, 23, 1, 29, 158, 15053 }, // ӧ
+    { 27, 28, 30, 1, 27, 189, 15211 }, // Ө
+    { 21, 22, 23, 1, 21, 116, 15400 }, // ө
+    { 27, 36, 32, 1, 35, 243, 15516 }, // Ӫ
+    { 21, 30, 23, 1, 29, 158, 15759 }, // ӫ
+    { 23, 36, 25, 1, 35, 207, 15917 }, // Ӭ
+    { 17, 30, 20, 1, 29, 128, 16124 }, // ӭ
+    { 28, 35, 28, 0, 34, 245, 16252 }, // Ӯ
+    { 23, 37, 23, 0, 28, 213, 16497 }, // ӯ
+    { 28, 36, 28, 0, 35, 252, 16710 }, // Ӱ
+    { 23, 38, 23, 0, 29, 219, 16962 }, // ӱ
+    { 28, 38, 28, 0, 37, 266, 17181 }, // Ӳ
+    { 23, 40, 23, 0, 31, 230, 17447 }, // ӳ
+    { 26, 35, 27, 0, 35, 228, 17677 }, // Ӵ
+    { 22, 29, 24, 0, 29, 160, 17905 }, // ӵ
+    { 20, 35, 22, 1, 27, 175, 18065 }, // Ӷ
+    { 17, 27, 19, 1, 20, 115, 18240 }, // ӷ
+    { 34, 36, 37, 1, 35, 306, 18355 }, // Ӹ
+    { 29, 30, 31, 1, 29, 218, 18661 }, // ӹ
+    { 20, 35, 22, 1, 27, 175, 18879 }, // Ӻ
+    { 17, 28, 19, 1, 20, 119, 19054 }, // ӻ
+    { 27, 35, 27, 0, 27, 237, 19173 }, // Ӽ
+    { 22, 29, 22, 0, 20, 160, 19410 }, // ӽ
+    { 28, 27, 28, 0, 27, 189, 19570 }, // Ӿ
+    { 23, 20, 23, 0, 20, 115, 19759 }, // ӿ
+    { 0, 0, 19, 0, 0, 0, 19874 }, //  
+    { 0, 0, 38, 0, 0, 0, 19874 }, //  
+    { 0, 0, 19, 0, 0, 0, 19874 }, //  
+    { 0, 0, 38, 0, 0, 0, 19874 }, //  
+    { 0, 0, 13, 0, 0, 0, 19874 }, //  
+    { 0, 0, 10, 0, 0, 0, 19874 }, //  
+    { 0, 0, 6, 0, 0, 0, 19874 }, //  
+    { 0, 0, 24, 0, 0, 0, 19874 }, //  
+    { 0, 0, 10, 0, 0, 0, 19874 }, //  
+    { 0, 0, 8, 0, 0, 0, 19874 }, //  
+    { 0, 0, 2, 0, 0, 0, 19874 }, //  
+    { 0, 0, 0, 0, 0, 0, 19874 }, // ​
+    { 2, 31, 0, -1, 22, 16, 19874 }, // ‌
+    { 8, 34, 0, -4, 25, 68, 19890 }, // ‍
+    { 14, 36, 0, -7, 27, 126, 19958 }, // ‎
+    { 14, 36, 0, -7, 27, 126, 20084 }, // ‏
+    { 12, 4, 14, 1, 12, 12, 20210 }, // ‐
+    { 12, 4, 14, 1, 12, 12, 20222 }, // ‑
+    { 18, 4, 24, 3, 15, 18, 20234 }, // ‒
+    { 19, 4, 19, 0, 12, 19, 20966 }, // –
+    { 38, 4, 38, 0, 12, 38, 20985 }, // —
+    { 38, 4, 38, 0, 12, 38, 20252 }, // ―
+    { 13, 39, 19, 3, 30, 127, 20290 }, // ‖
+    { 19, 9, 19, 0, -1, 43, 20417 }, // ‗
+    { 7, 13, 9, 1, 29, 23, 21023 }, // ‘
+    { 7, 13, 9, 1, 29, 23, 21046 }, // ’
+    { 7, 12, 9, 1, 5, 21, 20460 }, // ‚
+    { 7, 13, 9, 1, 29, 23, 20481 }, // ‛
+    { 15, 13, 17, 1, 29, 49, 21069 }, // “
+    { 14, 13, 17, 1, 29, 46, 21118 }, // ”
+    { 14, 12, 17, 1, 5, 42, 20504 }, // „
+    { 15, 13, 17, 1, 29, 49, 20546 }, // ‟
+    { 17, 25, 19, 1, 27, 107, 20595 }, // †
+    { 17, 29, 19, 1, 27, 124, 20702 }, // ‡
+    { 9, 9, 11, 1, 14, 21, 20826 }, // •
+    { 14, 14, 24, 5, 20, 49, 20847 }, // ‣
+    { 6, 6, 10, 2, 5, 9, 20896 }, // ․
+    { 15, 6, 19, 2, 5, 23, 20905 }, // ‥
+    { 32, 6, 38, 3, 5, 48, 21164 }, // …
+    { 6, 6, 10, 2, 13, 9, 20928 }, // ‧
+    { 0, 0, 0, 0, 0, 0, 20937 }, //  
+    { 0, 0, 0, 0, 0, 0, 20937 }, //  
+    { 14, 36, 0, -7, 27, 126, 20937 }, // ‪
+    { 14, 36, 0, -7, 27, 126, 21063 }, // ‫
+    { 12, 35, 0, -6, 26, 105, 21189 }, // ‬
+    { 16, 36, 0, -8, 27, 144, 21294 }, // ‭
+    { 16, 36, 0, -8, 27, 144, 21438 }, // ‮
+    { 0, 0, 4, 0, 0, 0, 21582 }, //  
+    { 49, 30, 52, 2, 28, 368, 21582 }, // ‰
+    { 8, 13, 10, 1, 27, 26, 21950 }, // ′
+    { 16, 13, 17, 1, 27, 52, 21976 }, // ″
+    { 23, 13, 25, 1, 27, 75, 22028 }, // ‴
+    { 8, 13, 10, 1, 27, 26, 22103 }, // ‵
+    { 16, 13, 18, 1, 27, 52, 22129 }, // ‶
+    { 24, 13, 27, 1, 27, 78, 22181 }, // ‷
+    { 17, 8, 19, 1, 0, 34, 22259 }, // ‸
+    { 10, 15, 12, 1, 17, 38, 22293 }, // ‹
+    { 10, 15, 12, 1, 17, 38, 22331 }, // ›
+    { 24, 26, 24, 0, 25, 156, 22369 }, // ※
+    { 16, 30, 21, 3, 29, 120, 22525 }, // ‼
+    { 19, 3, 19, 0, 31, 15, 22645 }, // ‾
+    { 9, 4, 11, 1, 12, 9, 22660 }, // ⁃
+    { 19, 31, 7, -6, 28, 148, 22669 }, // ⁄
+    { 30, 29, 34, 2, 28, 218, 22817 }, // ⁇
+    { 25, 30, 28, 2, 29, 188, 23035 }, // ⁈
+    { 24, 30, 28, 3, 29, 180, 23223 }, // ⁉
+    { 22, 6, 38, 8, 14, 33, 23403 }, // ⁓
+    { 30, 13, 32, 1, 27, 98, 23436 }, // ⁗
+    { 0, 0, 8, 0, 0, 0, 23534 }, //  
+    { 0, 0, 0, 0, 0, 0, 23534 }, // ⁠
+    { 0, 0, 0, 0, 0, 0, 23534 }, // ⁡
+    { 0, 0, 0, 0, 0, 0, 23534 }, // ⁢
+    { 0, 0, 0, 0, 0, 0, 23534 }, // ⁣
+    { 0, 0, 0, 0, 0, 0, 23534 }, // ⁤
+    { 15, 19, 17, 1, 32, 72, 23534 }, // ⁰
+    { 15, 19, 17, 1, 32, 72, 23606 }, // ⁴
+    { 12, 18, 17, 2, 31, 54, 23678 }, // ⁵
+    { 14, 19, 17, 2, 32, 67, 23732 }, // ⁶
+    { 13, 18, 17, 3, 31, 59, 23799 }, // ⁷
+    { 13, 19, 17, 2, 32, 62, 23858 }, // ⁸
+    { 13, 19, 17, 2, 32, 62, 23920 }, // ⁹
+    { 16, 14, 22, 3, 27, 56, 23982 }, // ⁿ
+    { 15, 19, 17, 1, 13, 72, 24038 }, // ₀
+    { 11, 18, 17, 3, 13, 50, 24110 }, // ₁
+    { 14, 18, 17, 2, 13, 63, 24160 }, // ₂
+    { 13, 19, 17, 2, 13, 62, 24223 }, // ₃
+    { 15, 19, 17, 1, 13, 72, 24285 }, // ₄
+    { 12, 18, 17, 2, 12, 54, 24357 }, // ₅
+    { 14, 19, 17, 2, 13, 67, 24411 }, // ₆
+    { 13, 18, 17, 3, 12, 59, 24478 }, // ₇
+    { 13, 19, 17, 2, 13, 62, 24537 }, // ₈
+    { 13, 19, 17, 2, 13, 62, 24599 }, // ₉
+    { 19, 26, 24, 2, 26, 124, 24661 }, // ₣
+    { 21, 28, 24, 1, 27, 147, 24785 }, // ₤
+    { 45, 28, 48, 1, 27, 315, 24932 }, // ₧
+    { 23, 28, 24, 0, 27, 161, 25247 }, // €
+    { 22, 16, 38, 8, 21, 88, 25408 }, // ←
+    { 16, 25, 38, 11, 26, 100, 25496 }, // ↑
+    { 22, 16, 38, 8, 21, 88, 25596 }, // →
+    { 16, 25, 38, 11, 26, 100, 25684 }, // ↓
+    { 24, 16, 38, 7, 21, 96, 25784 }, // ↔
+    { 16, 26, 38, 11, 26, 104, 25880 }, // ↕
+    { 16, 25, 38, 11, 26, 100, 25984 }, // ↨
+    { 16, 25, 38, 11, 26, 100, 26084 }, // ↲
+    { 16, 25, 38, 11, 26, 100, 26184 }, // ↳
+    { 20, 18, 38, 9, 22, 90, 26284 }, // ↵
+    { 22, 17, 38, 8, 22, 94, 26374 }, // ⇐
+    { 18, 22, 38, 10, 24, 99, 26468 }, // ⇑
+    { 22, 17, 38, 8, 22, 94, 26567 }, // ⇒
+    { 18, 22, 38, 10, 24, 99, 26661 }, // ⇓
+    { 24, 17, 38, 7, 22, 102, 26760 }, // ⇔
+    { 26, 28, 38, 6, 27, 182, 26862 }, // ∀
+    { 19, 31, 24, 2, 30, 148, 27044 }, // ∂
+    { 18, 27, 38, 10, 27, 122, 27192 }, // ∃
+    { 28, 30, 38, 5, 28, 210, 27314 }, // ∅
+    { 23, 27, 25, 1, 27, 156, 27524 }, // ∆
+    { 24, 28, 38, 7, 27, 168, 27680 }, // ∇
+    { 24, 27, 38, 7, 27, 162, 27848 }, // ∈
+    { 24, 33, 38, 7, 29, 198, 28010 }, // ∉
+    { 24, 21, 38, 7, 24, 126, 28208 }, // ∊
+    { 24, 27, 38, 7, 27, 162, 28334 }, // ∋
+    { 24, 33, 38, 7, 29, 198, 28496 }, // ∌
+    { 24, 21, 38, 7, 24, 126, 28694 }, // ∍
+    { 29, 33, 31, 1, 27, 240, 28820 }, // ∏
+    { 23, 34, 23, 0, 27, 196, 29060 }, // ∑
+    { 17, 4, 24, 3, 15, 17, 29256 }, // −
+    { 17, 30, 19, 1, 28, 128, 29273 }, // ∕
+    { 17, 30, 20, 2, 28, 128, 29401 }, // ∖
+    { 17, 18, 24, 3, 22, 77, 29529 }, // ∗
+    { 13, 13, 24, 5, 19, 43, 29606 }, // ∘
+    { 6, 6, 24, 9, 13, 9, 29649 }, // ∙
+    { 24, 36, 24, 0, 31, 216, 29658 }, // √
+    { 19, 14, 24, 2, 19, 67, 29874 }, // ∝
+    { 24, 14, 24, 0, 19, 84, 29941 }, // ∞
+    { 24, 27, 38, 7, 27, 162, 30025 }, // ∟
+    { 26, 27, 38, 5, 27, 176, 30187 }, // ∠
+    { 5, 39, 19, 7, 30, 49, 30363 }, // ∣
+    { 11, 39, 19, 4, 30, 108, 30412 }, // ∥
+    { 24, 27, 38, 7, 27, 162, 30520 }, // ∧
+    { 24, 27, 38, 7, 27, 162, 30682 }, // ∨
+    { 22, 27, 38, 8, 27, 149, 30844 }, // ∩
+    { 22, 28, 38, 8, 27, 154, 30993 }, // ∪
+    { 20, 39, 24, 2, 30, 195, 31147 }, // ∫
+    { 24, 22, 38, 7, 21, 132, 31342 }, // ∴
+    { 24, 22, 38, 7, 21, 132, 31474 }, // ∵
+    { 6, 20, 12, 3, 23, 30, 31606 }, // ∶
+    { 24, 22, 38, 7, 21, 132, 31636 }, // ∷
+    { 22, 6, 38, 8, 14, 33, 31768 }, // ∼
+    { 22, 20, 38, 8, 23, 110, 31801 }, // ≅
+    { 18, 14, 24, 3, 20, 63, 31911 }, // ≈
+    { 22, 13, 38, 8, 17, 72, 31974 }, // ≍
+    { 17, 17, 24, 3, 21, 73, 32046 }, // ≠
+    { 20, 17, 38, 9, 20, 85, 32119 }, // ≡
+    { 17, 23, 24, 3, 23, 98, 32204 }, // ≤
+    { 17, 23, 24, 3, 23, 98, 32302 }, // ≥
+    { 30, 18, 38, 4, 22, 135, 32400 }, // ≪
+    { 30, 18, 38, 4, 22, 135, 32535 }, // ≫
+    { 24, 21, 38, 7, 24, 126, 32670 }, // ⊃
+    { 24, 34, 38, 7, 30, 204, 32796 }, // ⊄
+    { 24, 34, 38, 7, 30, 204, 33000 }, // ⊅
+    { 24, 27, 38, 7, 27, 162, 33204 }, // ⊆
+    { 24, 27, 38, 7, 27, 162, 33366 }, // ⊇
+    { 28, 28, 38, 5, 27, 196, 33528 }, // ⊕
+    { 28, 28, 38, 5, 27, 196, 33724 }, // ⊖
+    { 28, 28, 38, 5, 27, 196, 33920 }, // ⊗
+    { 28, 28, 38, 5, 27, 196, 34116 }, // ⊘
+    { 22, 27, 38, 8, 27, 149, 34312 }, // ⊥
+    { 6, 6, 24, 9, 13, 9, 34461 }, // ⋅
+    { 32, 6, 38, 3, 13, 48, 34470 }, // ⋯
+    { 32, 30, 28, 0, 30, 240, 34518 }, // ﬀ
+    { 25, 30, 25, 0, 30, 188, 34758 }, // ﬁ
+    { 25, 30, 26, 0, 30, 188, 34946 }, // ﬂ
+    { 38, 30, 38, 0, 30, 285, 35134 }, // ﬃ
+    { 38, 30, 38, 0, 30, 285, 35419 }, // ﬄ
+    { 29, 31, 29, 0, 30, 225, 35704 }, // ﬅ
+    { 32, 31, 34, 2, 30, 248, 35929 }, // ﬆ
+    { 36, 36, 38, 1, 32, 324, 36177 }, // �
 };
 
 static const EpdUnicodeInterval bookerly_18_regularIntervals[] = {
@@ -3166,32 +3306,334 @@ static const EpdUnicodeInterval bookerly_18_regularIntervals[] = {
     { 0x22A5, 0x22A5, 0x2E7 },
     { 0x22C5, 0x22C5, 0x2E8 },
     { 0x22EF, 0x22EF, 0x2E9 },
-    { 0xFFFD, 0xFFFD, 0x2EA },
+    { 0xFB00, 0xFB06, 0x2EA },
+    { 0xFFFD, 0xFFFD, 0x2F1 },
 };
 
 static const EpdFontGroup bookerly_18_regularGroups[] = {
-    { 0, 5530, 12134, 100, 0 },
-    { 5530, 5572, 15082, 96, 100 },
-    { 11102, 7515, 23859, 128, 196 },
-    { 18617, 512, 716, 33, 324 },
-    { 19129, 11879, 39656, 220, 357 },
-    { 31008, 1687, 3906, 74, 577 },
-    { 32695, 635, 1127, 18, 651 },
-    { 33330, 429, 747, 4, 669 },
-    { 33759, 629, 1454, 15, 673 },
-    { 34388, 2886, 7656, 58, 688 },
-    { 37274, 179, 324, 1, 746 },
+    { 0, 7634, 21212, 151, 5 },
+    { 7634, 4555, 10961, 66, 358 },
+    { 12189, 13557, 39646, 263, 0 },
+    { 25746, 13823, 36501, 274, 473 },
+};
+
+static const uint8_t bookerly_18_regularGlyphGroups[754] = {
+    2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0,
+    2, 2, 2, 2, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0,
+    0, 2, 2, 2, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0,
+    0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 3, 3, 3, 0, 0, 3, 3, 0, 0, 3,
+    3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+};
+
+static const uint8_t bookerly_18_regularKernLeftClasses[754] = {
+    0, 0, 0, 0, 0, 0, 0, 92, 0, 0, 0, 0, 92, 72, 0, 71,
+    0, 3, 21, 3, 28, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 119,
+    119, 0, 0, 0, 0, 134, 2, 98, 39, 8, 0, 61, 83, 25, 25, 36,
+    58, 38, 101, 22, 8, 59, 64, 33, 62, 14, 4, 13, 13, 79, 5, 111,
+    91, 60, 0, 0, 0, 0, 32, 17, 78, 77, 50, 26, 45, 27, 77, 123,
+    66, 76, 27, 27, 17, 17, 113, 31, 48, 93, 41, 10, 10, 104, 10, 121,
+    84, 0, 0, 0, 0, 107, 0, 0, 0, 0, 0, 0, 0, 0, 0, 82,
+    0, 21, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 56,
+    0, 0, 0, 51, 2, 2, 2, 2, 2, 2, 0, 39, 0, 0, 0, 0,
+    25, 25, 25, 25, 8, 22, 8, 8, 8, 8, 8, 0, 90, 4, 4, 4,
+    4, 5, 54, 85, 32, 32, 32, 32, 32, 32, 50, 78, 50, 50, 50, 50,
+    77, 77, 37, 37, 105, 27, 17, 17, 17, 17, 17, 0, 17, 41, 41, 41,
+    41, 10, 17, 10, 2, 32, 2, 32, 53, 87, 39, 78, 39, 78, 39, 78,
+    39, 78, 8, 30, 8, 77, 0, 50, 0, 50, 0, 50, 138, 122, 0, 50,
+    83, 45, 83, 45, 83, 45, 83, 45, 25, 27, 25, 27, 25, 37, 25, 37,
+    25, 37, 103, 116, 25, 77, 36, 123, 36, 94, 58, 66, 66, 38, 76, 38,
+    76, 0, 30, 0, 0, 38, 75, 22, 27, 22, 27, 22, 27, 27, 22, 27,
+    8, 17, 8, 17, 8, 17, 0, 50, 33, 31, 33, 31, 33, 31, 62, 48,
+    62, 48, 62, 48, 62, 48, 14, 127, 14, 0, 14, 93, 4, 41, 4, 41,
+    4, 41, 4, 41, 4, 41, 4, 102, 13, 10, 5, 10, 5, 111, 121, 111,
+    121, 111, 121, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 129, 129, 81, 0, 130, 110, 12, 12, 46, 20, 20,
+    63, 9, 12, 1, 12, 19, 117, 47, 7, 24, 129, 9, 47, 12, 12, 9,
+    12, 96, 12, 6, 12, 34, 109, 7, 1, 67, 52, 24, 12, 12, 24, 20,
+    12, 20, 6, 6, 12, 55, 16, 128, 29, 57, 68, 49, 86, 88, 88, 49,
+    88, 88, 88, 16, 88, 16, 120, 29, 15, 16, 74, 57, 88, 88, 57, 35,
+    88, 35, 16, 16, 88, 68, 68, 95, 29, 137, 112, 125, 114, 132, 35, 35,
+    73, 49, 88, 15, 88, 97, 118, 6, 16, 43, 80, 24, 57, 20, 35, 34,
+    16, 40, 99, 42, 29, 0, 0, 44, 100, 47, 86, 44, 100, 9, 49, 9,
+    49, 9, 49, 24, 57, 0, 0, 0, 0, 106, 115, 109, 120, 7, 29, 23,
+    15, 23, 15, 65, 108, 24, 57, 24, 57, 12, 88, 69, 73, 124, 68, 124,
+    68, 12, 9, 49, 135, 133, 24, 57, 46, 89, 24, 57, 12, 88, 24, 57,
+    126, 19, 55, 19, 55, 129, 68, 129, 68, 6, 16, 6, 16, 9, 49, 47,
+    86, 136, 131, 12, 88, 12, 88, 6, 16, 6, 16, 6, 16, 6, 16, 1,
+    15, 1, 15, 1, 15, 12, 88, 7, 29, 12, 88, 42, 29, 70, 74, 52,
+    74, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 21, 21, 0, 21, 21, 21, 0, 0, 11, 18, 3, 11, 11, 18, 3,
+    11, 0, 0, 0, 0, 0, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 82, 56, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 77, 76, 77, 76, 93,
+    93, 0,
+};
+
+static const uint8_t bookerly_18_regularKernRightClasses[754] = {
+    0, 0, 0, 0, 0, 0, 102, 74, 0, 0, 0, 0, 74, 0, 77, 47,
+    0, 36, 14, 5, 38, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 95,
+    94, 0, 0, 0, 35, 0, 4, 8, 3, 8, 8, 8, 3, 8, 8, 70,
+    8, 8, 89, 8, 3, 8, 3, 8, 59, 29, 17, 34, 34, 91, 18, 110,
+    0, 28, 101, 0, 0, 0, 21, 83, 1, 1, 1, 53, 19, 31, 90, 88,
+    31, 31, 55, 55, 1, 93, 1, 55, 30, 42, 20, 23, 23, 79, 16, 67,
+    0, 0, 97, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45,
+    0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 69,
+    0, 0, 0, 104, 4, 4, 4, 4, 4, 4, 44, 3, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 3, 3, 3, 3, 3, 0, 68, 17, 17, 17,
+    17, 18, 8, 86, 21, 21, 21, 75, 76, 21, 21, 1, 1, 1, 1, 64,
+    107, 90, 61, 26, 1, 55, 1, 1, 1, 1, 1, 0, 65, 20, 20, 20,
+    20, 16, 31, 16, 4, 54, 4, 54, 4, 21, 3, 1, 3, 1, 3, 1,
+    3, 1, 8, 1, 8, 1, 8, 48, 8, 48, 8, 1, 8, 1, 8, 1,
+    3, 19, 3, 19, 3, 19, 3, 19, 8, 31, 8, 87, 8, 26, 8, 26,
+    8, 26, 8, 90, 8, 90, 8, 90, 70, 62, 8, 31, 55, 8, 31, 8,
+    31, 8, 31, 8, 31, 8, 71, 8, 55, 8, 55, 8, 55, 55, 8, 55,
+    3, 1, 3, 1, 3, 1, 3, 1, 8, 55, 8, 55, 8, 99, 59, 30,
+    59, 30, 59, 30, 59, 66, 29, 42, 29, 42, 29, 42, 17, 20, 17, 20,
+    17, 20, 17, 20, 17, 20, 17, 20, 34, 23, 18, 16, 18, 110, 67, 110,
+    67, 110, 92, 86, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 15, 15, 13, 15, 9, 103, 15, 15, 84, 41, 15,
+    13, 15, 15, 27, 15, 25, 15, 15, 15, 58, 15, 46, 106, 15, 15, 15,
+    41, 98, 15, 9, 15, 15, 9, 13, 27, 56, 63, 15, 33, 15, 15, 13,
+    15, 15, 109, 15, 81, 39, 100, 10, 10, 51, 2, 57, 52, 10, 10, 10,
+    32, 10, 10, 2, 10, 73, 2, 11, 7, 2, 43, 10, 12, 10, 10, 11,
+    10, 10, 52, 10, 49, 2, 2, 85, 10, 2, 80, 108, 72, 78, 32, 10,
+    85, 10, 10, 7, 10, 13, 11, 9, 2, 60, 7, 15, 10, 111, 112, 15,
+    73, 15, 10, 15, 10, 15, 10, 46, 57, 106, 52, 15, 10, 15, 10, 0,
+    0, 13, 11, 15, 10, 15, 10, 15, 10, 9, 2, 9, 2, 13, 11, 40,
+    7, 40, 7, 63, 43, 0, 11, 33, 12, 33, 12, 15, 85, 37, 24, 37,
+    24, 15, 46, 57, 15, 10, 41, 32, 15, 10, 15, 10, 33, 12, 0, 10,
+    85, 25, 39, 25, 39, 50, 39, 15, 2, 105, 82, 0, 82, 46, 57, 106,
+    52, 0, 96, 15, 10, 15, 10, 9, 2, 9, 2, 9, 2, 0, 52, 27,
+    7, 27, 7, 27, 7, 0, 12, 15, 10, 15, 10, 15, 10, 63, 43, 63,
+    43, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 14, 14, 0, 14, 14, 14, 0, 0, 6, 22, 5, 6, 6, 22, 5,
+    6, 0, 0, 0, 0, 0, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 69, 0, 102, 0, 0, 0,
+    35, 35, 102, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 53, 53, 53, 53, 53,
+    30, 0,
+};
+
+static const int8_t bookerly_18_regularKernMatrix[15707] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -4, 0, 0, -5, 0, -2, 0, -3, -3, -2, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 1, 0, -4, -6, 0, 1, 0, 0, 0, 0, -4, 0, 0, 0, -5, -1, -4, -4, 2, -4, 0, -2, 0, -3, -1, 0, 0, -6, -6, -5, -3, 0, 0, 0, -3, -2, -4, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 3, -1, 0, 0, 0, 0, 0, 0, -3, -3, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, -1, -1, 0, 0, -1, 0, 0, 0,
+    0, 0, 0, -1, 1, 0, -3, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, -2, -4, 0, -1, 0, -3, -2, 0, 0, 0, 0, -4, -4, 0, 0, 0, 0, -4, -2, 0, 0, 1, 0, 0, 0, -1, 0, 1, -1, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -1, -2, 1, 0, -3, -2, 0, -2, 0, -2, -2, -3, 0, 0, -2, -2, -3, 0, -1, 0, -2, -2, -2, 1, 0, -3, 0, -3, 0, 0, 0, -4, -3, 0, 0, -3, 0, 0, -3, 0, -1, 1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, -3, 0, -1, 0, -1, -1, 0, 0, -2, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, -1, -3, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, 0, 0, 0, 0, 2, 0, 0, 0, -1, 0, 0, 0, 0, 0, -2, 0, -2, 0, 0, 0, 0, 0, -3, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 2, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -3, 0, -2, -4, -3, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, 0, 1, -2, -1, -2, 1, -1, 0, 0, 3, 0, 0, 0, -3, 1, 0, 0, 1, 0, -3, 0, -4, 0, 0, 0, 0, 0, -4, -2, 0, 0, -3, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, 0, 2, 2, 0, -3, -3, -3, -1, -2, -2, 0, 1, 0, 0, 0, -2, -1, 0, 0, -1, 0, 0, 0, 1, 0, 0, 0, 1, 0, -1, 0, 0, -1, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0, -2, -1, 0, 0, -2, 0, -2, 0, -2, 0, 0, 0, 0, 0, -2, 0, 0, -2, -3, -2, 0, 0, 0, 0, 0, 0, -2, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, -3, 1, 0, 0, -1, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 1, 0, -4, -4, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, -3, -1, -5, -2, 0, -3, 0, 0, 0, -2, -1, 0, 0, -4, -4, -3, -1, 0, 0, 0, -1, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, -3, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, -2, 0, -2, 0, 0, 0, 1, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, -2, -2, 0, -2, 0, -3, -3, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -3, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, 0, -3, 2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, -2, 2, 0, 2, 1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -3, 0, -2, 0, 0, 0, 1, 0, 0, 0, 0, 2, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, -1, 0, 0, 0, -1, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -1, 0, -3, -3, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 1, -1, 0, 0, 0, 0, 0, -3, 2, 1, 0, 2, -1, 1, -2, 0, 1, 0, -3, 0, 0, 0, 1, -2, 0, 0, -4, 0, 0, 0, -1, -2, -4, -1, 0, 0, 0, 0, 0, 0, -2, 0, 1, 2, 2, 0, -1, -1, -1, 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 1, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -3, 0, -2, -4, -4, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, 0, 1, -3, -1, -2, 1, -1, 0, 0, 2, 0, 0, 0, -2, 1, 0, 0, 1, 0, -4, 0, -5, 0, 0, 0, 0, 0, -5, -2, 0, 2, -3, 0, 0, 0, 0, -1, -2, -1, 0, 0, 0, -1, 0, 2, 2, 0, -3, -3, -2, -1, -2, -1, 0, 1, 0, 0, 0, -2, -1, 0, 0, -1, 0, 0, 0, 1, 0, 0, 0, 1, 0, -1, 0, 0, -1, -1, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, -1, -4, -3, 1, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -2, 0, -2, 1, 0, 0, 0, 2, 0, 0, 0, -3, 0, 0, 0, 0, 0, -3, 0, -5, 0, 0, 0, 0, 0, -4, -2, 0, 0, -2, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, 2, 0, 0, -2, -2, -3, -1, -1, -1, 0, 0, 0, 0, 0, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, -3, 2, 1, 0, 0, 0, 0, 2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -3, 0, -2, -1, 0, 0, 0, 1, 0, 0, 0, 2, 0, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, -1, -1, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, -2, -2, -4, -3, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 1, -3, 0, -2, 0, 0, -2, -4, 1, 0, 0, 0, -3, 0, -3, 0, 1, 0, -3, 0, 0, -2, 1, -3, 0, 0, -6, 0, -1, 0, -2, -3, -6, -3, 0, 0, -2, 0, 0, 0, -3, -1, 1, 1, 2, 0, -2, -2, -3, -1, -2, 0, 0, 0, 1, 0, 0, -2, -2, 0, 0, 0, -3, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -3, -1, 0, -1, 0, -2, -3, -4, -1, 0, 0, 0, 0, 0, 0, 0, -3, 0, -2, 1, 0, -3, -4, 0, 0, 0, 1, -5, 0, -2, 0, -3, 1, 0, -3, 1, 0, 1, 0, -1, 1, -3, 0, 0, 1, 1, 0, 0, 0, 0, -2, 0, 1, 0, -4, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, -2, -1, 0, 0, 0, -1, -1, -2, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -3, -2, 0, 0, 0, 0, -3, 0, 0, 0, -1, 0, 1, -3, 0, 0, 0, 0, 0, -1, -2, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, -2, 0, 0, -1, 0, -2, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, -2, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 1, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, -1, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, -1, 0, -1, 0, 0, 2, 0, 0, 0, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 2, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, -3, 0, -1, 0, -2, -1, -2, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 1, 0, -3, -3, 0, 1, 0, 0, 0, 0, -3, 0, 0, 0, -3, -2, -4, -2, 1, -3, 0, -1, 0, -2, -1, 0, 0, -4, -4, -3, -2, 0, 0, 0, -1, -2, -2, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 3, -1, 0, 0, 0, 0, 0, 0, -2, -2, -2, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, 0, -1, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 4, 1, 0, 0, 5, 0, 3, 0, -1, 0, 0, 0, 0, 2, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 3, 4, 0, 1, -1, 1, 0, 0, 0, 0, 0, 0, 0, 4, 1, 2, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 1, 0, 1, 0, 1, 0, 0, 0, 0, 4, 0, 2, 0, 3, 2, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -3, -3, -2, -4, 0, 0, -1, 0, -2, -1, -1, 0, 0, 0, 0, -1, 0, 0, -3, -1, -4, 0, -1, -1, -4, 2, 0, 0, 0, -3, 0, -2, 0, 0, 0, 0, 0, 0, -4, 0, -3, 0, -2, -5, 0, 0, 0, -3, -3, -5, -4, -2, -2, -4, -2, -2, -2, -3, -1, 0, 2, 0, 0, -3, -3, -3, -2, -2, 0, 0, 0, 2, -2, 0, -4, -4, 0, 0, -2, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, 0, 0, -1, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0,
+    0, 0, -1, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -3, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 3, 1, 0, 0, 0, 0, 2, 0, 0, 4, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 2, 0, 0, 0, 0, 4, 0, 0, 0, 0, 2, 3, 0, 0, 0, 0, 0, 4, 0, 0, 0, 4, 2, 0, 2, 0, 1, 0, 0, 0, 0, 3, 0, 2, 0, 2, 1, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, 0, -2, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, 1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, -2, 0, -2, 0, 0, 0, 1, 0, 0, 0, 0, 1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 2, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, -3, 0, -1, 0, -2, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, -4, 1, 1, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, -4, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -4, 0, -4, -1, 0, -3, 0, 0, 0, 0, -1, 1, 0, -2, -5, -2, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, -3, 0, 0, 0, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, -1, 0, -1, 0, 0, 1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 2, 0, 1, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 2, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -3, 0, 0, 0, -1, -1, 0, 0, 0, 0, -4, -2, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -3, 0, 0, -3, 1, -1, 0, -2, -2, -2, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, -4, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, -3, -3, -4, -3, 0, -2, 0, -2, 0, 0, -1, 1, 0, -3, -5, -3, -2, 0, 0, 0, -2, -2, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -3, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, -2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, -3, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -2, -1, -3, -1, 0, -3, 0, 0, 0, 0, 0, 2, 0, -2, -4, -2, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -3, 0, 0, -3, 1, 0, 0, -1, -2, -1, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 1, 0, -3, -5, 0, 1, 0, 0, 0, 0, -3, 0, 0, 0, -3, -2, 0, -2, 2, -3, 0, -1, 0, -1, -1, 0, 0, -4, -6, -4, -3, 0, 0, 0, -2, -2, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, -1, 1, 0, -2, 0, -3, -3, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -3, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -3, 0, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, -1, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, -2, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, -2, -1, -1, 0, -2, 0, -1, 0, 0, 0, 0, 0, -2, -2, -1, -1, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -1, -1, 0, 0, 0, -1, -1, -1, 0, 0, 0, -2, 0, -1, -1, -1, -2, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, -2, -2, -1, 0, 0, -3, 0, 0, 0, 0, -1, -1, 0, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, -2, 0, 0, 0, -1, -1, -2, -1, -1, 0, 1, -1, 0, 0, 0, -1, -1, 0, 0, -1, -2, 0, 0, -1, 1, -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -2, 0, -1, 0, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, -3, 0, 0, 0, 1, 0, 1, 0, 0, 0, 1, 0, 0, 1, 1, 0, 0, 0, 0, -2, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 1, 0, -3, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, -2, -4, 0, -1, 0, -3, -2, 0, 0, 0, 0, -4, -4, 0, 0, 0, 0, -4, -2, 0, 0, 1, 0, 0, 0, -1, 0, 1, -1, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, -2, 0, 0, 0, 0, 1, 0, 0, 0, -1, 0, 0, 0, 0, 2, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -4, -3, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, -3, -1, 0, -1, 0, 0, 0, 0, 0, 0, -3, -1, -1, -1, 0, 0, -2, -1, -3, 0, -4, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, -1, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -2, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -2, -1, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, -4, 0, 0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, -1, -2, 0, -1, 0, 0, 0, -2, 0, 0, 0, -2, 0, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, -2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, -1, -1, 0, -2, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 1, 1, 0, -1, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, -4, -4, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, 1, -1, 1, 1, 0, 0, 1, 0, 0, 1, -1, 0, 0, 0, 0, 0, -4, 0, -4, 0, 0, 0, 1, 0, -5, 0, 0, 1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 1, 2, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -1, -1, 0, 0, 0, -1, 0, -1, 0, -1, -1, -3, 0, 0, -1, -2, -3, 1, -1, 0, 0, -1, 0, 0, 0, -2, 0, -3, 0, 0, 0, -4, -4, 0, 0, -2, 0, 0, -3, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, -3, -3, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, 1, 0, 0, 0, 2, 0, 0, 0, -1, 0, 0, 0, 0, 0, -3, 0, -3, 0, 0, 0, 0, 0, -4, 0, 0, 2, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 2, 2, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, -3, 0, -1, 0, -2, -3, -2, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2, 0, 0, -3, -4, 0, 0, 0, 0, -4, 0, 0, 0, -3, 0, 0, -2, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 2, -1, -2, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 1, 0, -2, 0, 0, 0, 1, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 3, 0, 0, -1, 0, 0, 1, 0, 0, 3, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 2, 0, -1, 0, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, -3, 0, 0, 0, 1, 0, 1, 0, 0, 1, 1, 0, 1, 1, 1, 0, 0, 0, 0, -2, 2, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 2, 0, 0, 2, 0, 0, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1,
+    0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2, 0, 0, 0, 0, -1, -1, 0, 0, -2, 0, -2, 0, -1, -2, 0, 0, 0, 0, -3, 0, 0, -1, -3, -2, 0, 0, 0, 0, 0, 0, -3, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -2, 0, -1, 0, -2, -2, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -3, -5, 0, 0, 0, 0, -4, 0, 0, 0, -2, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, -1, 0, -2, 0, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, -3, 0, -2, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 1, 1, -1, 0, 0, 0, -2, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -1, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, -3, 0, 0, -5, 0, 0, 0, -1, 0, -5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 2, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -1, -1, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, -1, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 1, 2, 0, -1, -1, 0, 0, -1, 0, 2, 0, 1, 0, 0, -1, -1, 0, 2, 0, 0, 0, 0, 0, 2, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -2, -2, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 2, 0, -1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, 0, 0, 2, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, -2, 0, 0, 2, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -3, 1, 2, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -3, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -2, -2, 0, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 2, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 2, 0, 1, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 2, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -1, 0, -1, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -3, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2, 0, 0, 0, 1, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 2, 0, 1, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 2, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -2, -2, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, 0, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1, 0, 0, 2, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -2, 0, 0, 0, -2, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 2, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -2, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint16_t bookerly_18_regularGlyphLookup[368] = {
+    0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0001, 0x0002, 0xFFFF, 0xFFFF, 0xFFFF, 0x0003, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0004, 0xFFFF, 0xFFFF,
+    0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, 0x0010, 0x0011, 0x0012, 0x0013, 0x0014,
+    0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, 0x0020, 0x0021, 0x0022, 0x0023, 0x0024,
+    0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, 0x0030, 0x0031, 0x0032, 0x0033, 0x0034,
+    0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, 0x0040, 0x0041, 0x0042, 0x0043, 0x0044,
+    0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051, 0x0052, 0x0053, 0x0054,
+    0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, 0x0060, 0x0061, 0x0062, 0x0063, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x0072, 0x0073,
+    0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, 0x0080, 0x0081, 0x0082, 0x0083,
+    0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F, 0x0090, 0x0091, 0x0092, 0x0093,
+    0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F, 0x00A0, 0x00A1, 0x00A2, 0x00A3,
+    0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF, 0x00B0, 0x00B1, 0x00B2, 0x00B3,
+    0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF, 0x00C0, 0x00C1, 0x00C2, 0x00C3,
+    0x0241, 0x0242, 0x0243, 0x0244, 0x0245, 0x0246, 0x0247, 0x0248, 0x0249, 0x024A, 0x024B, 0x024C, 0x024D, 0x024E, 0x024F, 0x0250,
+    0x0251, 0x0252, 0x0253, 0x0254, 0x0255, 0x0256, 0x0257, 0x0258, 0x0259, 0x025A, 0x025B, 0x025C, 0x025D, 0x025E, 0x025F, 0x0260,
+    0x0261, 0x0262, 0x0263, 0x0264, 0x0265, 0x0266, 0x0267, 0x0268, 0x0269, 0x026A, 0x026B, 0x026C, 0x026D, 0x026E, 0x026F, 0x0270,
+    0x0271, 0xFFFF, 0x0272, 0x0273, 0x0274, 0x0275, 0x0276, 0x0277, 0x0278, 0x0279, 0x027A, 0x027B, 0x027C, 0xFFFF, 0x027D, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x027E, 0x027F, 0xFFFF, 0xFFFF, 0x0280, 0x0281, 0x0282, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x0283, 0xFFFF, 0xFFFF, 0xFFFF, 0x0284, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0285,
+    0x0286, 0x0287, 0x0288, 0x0289, 0x028A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
 };
 
 static const EpdFontData bookerly_18_regular = {
     bookerly_18_regularBitmaps,
     bookerly_18_regularGlyphs,
     bookerly_18_regularIntervals,
-    64,
+    65,
     49,
     40,
     -10,
     true,
     bookerly_18_regularGroups,
-    11,
+    4,
+    bookerly_18_regularKernLeftClasses,
+    bookerly_18_regularKernRightClasses,
+    bookerly_18_regularKernMatrix,
+    113,
+    nullptr,
+    0,
+    0,
+    bookerly_18_regularGlyphLookup,
+    bookerly_18_regularGlyphGroups,
+    false,
+    nullptr,
 };
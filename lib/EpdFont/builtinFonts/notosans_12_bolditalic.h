@@ -3,1705 +3,1733 @@
  * name: notosans_12_bolditalic
  * size: 12
  * mode: 2-bit  compressed: true
- * Command used: fontconvert.py notosans_12_bolditalic 12 ../builtinFonts/source/NotoSans/NotoSans-BoldItalic.ttf --2bit --compress
+ * Command used: fontconvert.py notosans_12_bolditalic 12 ../builtinFonts/source/NotoSans/NotoSans-BoldItalic.ttf --2bit --compress --frequency-corpus ../../../test/hyphenation_eval/resources/english_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/french_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/german_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/italian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/russian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/spanish_hyphenation_tests.txt
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t notosans_12_bolditalicBitmaps[27086] = {
-    0x8D, 0x58, 0x3B, 0x8C, 0xDD, 0xC6, 0x15, 0xBD, 0x24, 0xED, 0x25, 0x60, 0x02, 0x19, 0x17, 0x4E,
-    0x23, 0xC3, 0x60, 0x93, 0x22, 0x70, 0xE1, 0x69, 0xD3, 0xC4, 0x43, 0x5B, 0x80, 0x85, 0x20, 0x85,
-    0x54, 0x58, 0x49, 0xE1, 0x62, 0x9B, 0x14, 0x8A, 0x11, 0x60, 0x1B, 0x37, 0x01, 0xA2, 0x1D, 0x4A,
-    0x42, 0x90, 0x42, 0x85, 0xD5, 0xB8, 0x09, 0x10, 0xC0, 0x85, 0x03, 0x08, 0x4A, 0xE1, 0x94, 0x29,
-    0xB4, 0x4B, 0x6A, 0xB7, 0x48, 0xA1, 0xC2, 0xB4, 0x84, 0x40, 0x85, 0x0B, 0x51, 0xB1, 0x60, 0xC7,
-    0x31, 0x02, 0x8D, 0x6C, 0xCA, 0x1A, 0xAF, 0x48, 0x4E, 0xCE, 0x19, 0xBE, 0xB7, 0xDA, 0x85, 0x63,
-    0x20, 0x4F, 0xBB, 0xAB, 0x47, 0x72, 0x3E, 0x77, 0xEE, 0xE7, 0x9C, 0x73, 0x99, 0xCC, 0xE9, 0x9C,
-    0x4E, 0xD9, 0x88, 0x7F, 0x3E, 0x1F, 0x0A, 0x57, 0x38, 0xD5, 0xAB, 0x4E, 0xB5, 0x82, 0x8F, 0x16,
-    0x5B, 0x37, 0xB5, 0x95, 0x67, 0x44, 0xFF, 0xFC, 0xF6, 0x30, 0x19, 0xB5, 0xDF, 0xFB, 0xF3, 0xE5,
-    0xA9, 0x1B, 0xEE, 0xDC, 0x09, 0x91, 0xAC, 0xF7, 0x92, 0x0C, 0x3F, 0x15, 0xB9, 0xAE, 0x45, 0x0C,
-    0x26, 0xA8, 0x93, 0x7D, 0x16, 0x42, 0x68, 0xF1, 0xEB, 0x5E, 0x9E, 0x9B, 0xAB, 0x72, 0x5E, 0x55,
-    0xA2, 0x8B, 0x36, 0xFD, 0xF0, 0xCB, 0x83, 0xD7, 0x78, 0xD3, 0x86, 0x30, 0xC6, 0xD1, 0xAF, 0xAA,
-    0x5A, 0xCA, 0x53, 0x9D, 0x14, 0x7B, 0x4E, 0x32, 0x37, 0x72, 0xAB, 0x77, 0x44, 0x0A, 0x6C, 0x18,
-    0x6A, 0x15, 0x26, 0xAC, 0xD2, 0xDA, 0x3F, 0xBD, 0x90, 0x7F, 0xD5, 0x8A, 0xBD, 0x2E, 0x59, 0x68,
-    0xA5, 0x0C, 0xB5, 0x98, 0x20, 0xD2, 0x0C, 0xA2, 0x6C, 0x2D, 0x9F, 0xFA, 0x77, 0x5E, 0x6A, 0x4E,
-    0xC5, 0x15, 0xC7, 0xA4, 0xF9, 0x56, 0xE4, 0x27, 0x22, 0x79, 0x25, 0xF2, 0xBC, 0x2C, 0x9F, 0x74,
-    0x86, 0x75, 0x0A, 0x6B, 0xB5, 0xE5, 0x83, 0x56, 0xD3, 0xB8, 0xF3, 0x62, 0x55, 0xEB, 0x65, 0x5B,
-    0xED, 0x3B, 0xD9, 0x29, 0x2F, 0x77, 0xB2, 0x63, 0x36, 0x2F, 0xF7, 0xB6, 0x31, 0x76, 0x34, 0xD3,
-    0x38, 0x4F, 0xE5, 0x57, 0x8F, 0xC6, 0x1D, 0xC9, 0x3F, 0x1D, 0x76, 0x04, 0x43, 0x76, 0xC4, 0xD0,
-    0xAC, 0x1D, 0xFC, 0x49, 0x7C, 0xF6, 0x78, 0xC8, 0x5C, 0x1A, 0x1C, 0x4E, 0x08, 0x2B, 0x9E, 0x7E,
-    0xEC, 0x40, 0x7B, 0x3B, 0xC9, 0xC3, 0x0C, 0xC3, 0x0A, 0x27, 0xAA, 0x6F, 0x44, 0x66, 0xD5, 0x4B,
-    0xF1, 0x18, 0x47, 0xA2, 0xB9, 0x45, 0xA8, 0xAE, 0x66, 0xC1, 0xE9, 0x36, 0x34, 0x97, 0x06, 0x7D,
-    0x6B, 0x0A, 0xD9, 0xA8, 0x42, 0x67, 0x6A, 0xEB, 0x33, 0x1C, 0x12, 0x43, 0xC2, 0x90, 0xD0, 0x63,
-    0x79, 0xB8, 0x17, 0xE2, 0x9A, 0xFA, 0xF4, 0x6D, 0x07, 0x0F, 0x6F, 0xD4, 0x92, 0xF7, 0x62, 0x24,
-    0x1B, 0x44, 0xD7, 0xC9, 0x28, 0xAA, 0x13, 0x2B, 0x99, 0x17, 0x98, 0x60, 0x25, 0xF5, 0xBC, 0x36,
-    0x95, 0x8C, 0xF0, 0x1D, 0x6F, 0xE1, 0xEB, 0xC4, 0xBB, 0x79, 0xBC, 0x2A, 0x2B, 0x2E, 0x84, 0x27,
-    0xCB, 0xCC, 0x16, 0xCF, 0x30, 0x7C, 0x57, 0x8A, 0x1E, 0x7F, 0x60, 0x1C, 0x2E, 0x5B, 0x3C, 0xD0,
-    0x35, 0x16, 0xB7, 0x78, 0x84, 0xEF, 0xA6, 0x52, 0x7D, 0x3A, 0xE2, 0x2A, 0x7E, 0xF2, 0x4E, 0x12,
-    0x2F, 0xF5, 0x75, 0xD9, 0xD6, 0x38, 0xDF, 0x7B, 0x17, 0xE0, 0xE6, 0x3C, 0x8C, 0x79, 0x78, 0x36,
-    0x7F, 0xDC, 0x67, 0xC3, 0x28, 0x3F, 0xD6, 0x55, 0x74, 0xF6, 0xAB, 0x22, 0x08, 0x63, 0xD6, 0x8B,
-    0x78, 0x9C, 0x16, 0x43, 0xC3, 0x27, 0x21, 0x3C, 0xBA, 0x36, 0x5F, 0x3D, 0xFE, 0x84, 0xC6, 0xF8,
-    0xB2, 0x6B, 0x32, 0x57, 0xD6, 0x8C, 0xF4, 0xB3, 0x6F, 0x9A, 0xC9, 0x8E, 0x76, 0x7C, 0x45, 0x3F,
-    0x38, 0x18, 0x5F, 0xE0, 0x7E, 0x0E, 0xD3, 0x6B, 0x81, 0x1D, 0x34, 0x54, 0xE0, 0xC3, 0x8C, 0x9E,
-    0x45, 0x02, 0x4E, 0x42, 0xAB, 0x69, 0x17, 0xCE, 0x2E, 0xE5, 0xEA, 0x0E, 0x87, 0x57, 0x92, 0x72,
-    0x38, 0xEE, 0xCC, 0x47, 0x22, 0x22, 0x0D, 0xFC, 0x14, 0xAA, 0x32, 0x20, 0x99, 0x75, 0xD7, 0x54,
-    0x93, 0x72, 0xEA, 0xDE, 0x24, 0xB3, 0x6E, 0xCB, 0xDB, 0x63, 0x32, 0x99, 0x56, 0xEF, 0xFB, 0x6C,
-    0x34, 0xB5, 0xD9, 0x47, 0xA6, 0x9B, 0x1A, 0xD1, 0xD0, 0xBD, 0x46, 0x4A, 0x86, 0x80, 0x24, 0x5B,
-    0x42, 0x0B, 0x63, 0x42, 0xAB, 0xE7, 0x3C, 0x0C, 0x4D, 0xE8, 0xA6, 0x26, 0xB9, 0x34, 0xD2, 0x67,
-    0xB6, 0x82, 0x75, 0xD8, 0xD8, 0xB4, 0xD8, 0x2F, 0x1F, 0x68, 0x5C, 0x88, 0xF1, 0xE8, 0x97, 0x7D,
-    0xF5, 0x84, 0x50, 0x4F, 0xD2, 0x60, 0xAD, 0x49, 0x0D, 0x49, 0x5D, 0xE2, 0x1C, 0xB6, 0x92, 0x0C,
-    0x36, 0x6A, 0x78, 0x13, 0xB1, 0x2D, 0x9D, 0xA4, 0xF8, 0x4F, 0xF7, 0x92, 0xC1, 0x62, 0xD3, 0x49,
-    0x36, 0x31, 0x45, 0x02, 0xBC, 0x3B, 0xE5, 0x48, 0x83, 0xB8, 0xCC, 0x46, 0xE8, 0x90, 0xFA, 0xB5,
-    0xC1, 0x32, 0x1D, 0xE7, 0x4D, 0xF1, 0xD0, 0x58, 0xE5, 0xAD, 0xC0, 0x54, 0x92, 0x00, 0x2F, 0x6C,
-    0xB9, 0xE8, 0x10, 0x18, 0x21, 0xCD, 0xCF, 0xB0, 0x2C, 0xE6, 0x2B, 0xCC, 0xB1, 0xEB, 0xD4, 0x2C,
-    0xF0, 0xC0, 0xB6, 0x48, 0x4A, 0x2C, 0x8F, 0x04, 0x09, 0x48, 0xA3, 0xA6, 0x4A, 0xA7, 0x51, 0xCA,
-    0x9B, 0x2E, 0xC1, 0xD9, 0x55, 0x37, 0xC9, 0x84, 0x3A, 0x3F, 0x68, 0xFE, 0x85, 0xED, 0x31, 0x3D,
-    0x5C, 0x38, 0xBB, 0x79, 0x3F, 0xAE, 0x19, 0x5D, 0xCA, 0xE5, 0x03, 0x6A, 0x67, 0x82, 0x57, 0xBA,
-    0xF2, 0x1F, 0x6F, 0xF2, 0x26, 0xDC, 0xCD, 0x90, 0x34, 0xA1, 0x52, 0xC8, 0xF5, 0xED, 0x06, 0x63,
-    0x60, 0x0D, 0x4D, 0xC0, 0x21, 0x95, 0xBB, 0x92, 0x86, 0x02, 0x83, 0x9B, 0x30, 0x6C, 0x04, 0x7F,
-    0xA4, 0x3E, 0x90, 0x51, 0xA1, 0x2D, 0x83, 0xCF, 0x71, 0x8E, 0xB0, 0x1C, 0xC5, 0xFF, 0x5A, 0x8C,
-    0xF5, 0x39, 0x47, 0x7F, 0x36, 0xAB, 0x41, 0xB9, 0x20, 0x01, 0x70, 0xD3, 0x87, 0x64, 0x2A, 0x9C,
-    0x69, 0x6D, 0xF0, 0x29, 0x76, 0xE0, 0x59, 0x99, 0x36, 0x21, 0xF8, 0x32, 0x84, 0xBE, 0x09, 0xA1,
-    0x3A, 0xFB, 0x16, 0xED, 0x68, 0x25, 0x99, 0x17, 0x1B, 0x9B, 0xC5, 0xBB, 0xC7, 0xEF, 0xE4, 0x63,
-    0x74, 0x6D, 0xFA, 0xF4, 0x4E, 0xFC, 0x24, 0x70, 0x42, 0x03, 0x4B, 0x9E, 0x00, 0xE5, 0x54, 0x6F,
-    0xAA, 0x39, 0xF3, 0xAA, 0xD7, 0xFB, 0x31, 0xEE, 0x79, 0xA8, 0x32, 0x66, 0xC0, 0x26, 0x77, 0x3F,
-    0x39, 0x64, 0xDE, 0x56, 0xE6, 0x0F, 0xCC, 0x8E, 0x83, 0x80, 0xCA, 0xEC, 0xF2, 0xD0, 0xAF, 0x8F,
-    0xA3, 0x3D, 0x8F, 0x63, 0x82, 0xD7, 0x1D, 0x4C, 0x2E, 0xEF, 0x0C, 0xF9, 0xA3, 0x31, 0x9D, 0x6C,
-    0x15, 0xCA, 0x87, 0x61, 0x9F, 0x50, 0xF4, 0xC4, 0xA7, 0x1F, 0x4C, 0x31, 0x7F, 0x81, 0x50, 0x16,
-    0x28, 0xD8, 0x99, 0xD0, 0xA9, 0x25, 0x2E, 0xC9, 0x50, 0xBA, 0xE6, 0xC2, 0x24, 0xD5, 0x7A, 0xB5,
-    0xB4, 0xD7, 0x7D, 0xB8, 0x38, 0x26, 0xB8, 0x51, 0x56, 0xA5, 0x2B, 0x3C, 0x82, 0xFD, 0x8C, 0x1C,
-    0xFB, 0xA8, 0x2E, 0x77, 0xC8, 0xB1, 0x11, 0x65, 0x6B, 0x0E, 0x6F, 0xA6, 0x1D, 0x23, 0x0C, 0x5B,
-    0x9A, 0x3E, 0x0D, 0x75, 0x3E, 0xE3, 0xB0, 0x15, 0xD3, 0x4F, 0x1A, 0x80, 0x71, 0x70, 0x42, 0x5F,
-    0x17, 0xDC, 0xE5, 0xED, 0x6B, 0xD7, 0x96, 0x8A, 0x1C, 0x56, 0xE6, 0xC7, 0x8B, 0x6F, 0x90, 0x2E,
-    0x78, 0xFA, 0x0A, 0x06, 0xF9, 0xE8, 0x97, 0x1C, 0xF6, 0x15, 0xF0, 0x97, 0x1E, 0x38, 0x55, 0xCF,
-    0x49, 0x33, 0xE4, 0xA1, 0xA3, 0x07, 0xFF, 0x76, 0x08, 0xA7, 0x69, 0xE8, 0x34, 0x23, 0x31, 0xFE,
-    0x20, 0x9D, 0x58, 0xA6, 0x48, 0x09, 0xCC, 0xB6, 0x7D, 0x02, 0xDF, 0x8D, 0xAC, 0x98, 0x62, 0xED,
-    0xA4, 0xA2, 0x66, 0x44, 0xF8, 0x53, 0x2F, 0xA7, 0xD9, 0xFA, 0x82, 0xD3, 0x69, 0xD7, 0xFC, 0xC7,
-    0x50, 0xC1, 0x72, 0xF2, 0x8B, 0xC8, 0x36, 0xC0, 0x60, 0x06, 0xCE, 0xEA, 0xB0, 0xE7, 0xBC, 0xBE,
-    0xE4, 0xAE, 0x9F, 0x2F, 0x6B, 0xAF, 0x41, 0x15, 0xE7, 0x8B, 0x8F, 0x70, 0x37, 0xFB, 0xDA, 0x79,
-    0x75, 0x63, 0x18, 0x4D, 0xD1, 0x8F, 0x1A, 0xD9, 0x3D, 0x15, 0x5D, 0x78, 0x77, 0x92, 0xF1, 0xD9,
-    0xEA, 0x4D, 0xE0, 0x16, 0x33, 0x63, 0x92, 0x97, 0x62, 0xF9, 0x54, 0x38, 0x44, 0xF4, 0xF0, 0x99,
-    0xB8, 0x7F, 0x89, 0xC3, 0x2A, 0xD8, 0xCE, 0x53, 0x65, 0x4F, 0x7A, 0x54, 0x10, 0x32, 0x62, 0x42,
-    0x6A, 0x5B, 0xC2, 0xE4, 0x25, 0x60, 0x62, 0xCB, 0x7A, 0x36, 0x55, 0xF1, 0xED, 0x26, 0x4B, 0x0D,
-    0xD9, 0x86, 0x74, 0x23, 0x02, 0x37, 0xB0, 0xCC, 0xD4, 0xE9, 0x88, 0xCA, 0x6E, 0x50, 0xD5, 0xC8,
-    0xD5, 0x06, 0x8E, 0xA5, 0xF7, 0xC0, 0x59, 0xC9, 0xFC, 0xCB, 0x31, 0x41, 0xB0, 0xD3, 0x31, 0x05,
-    0xB2, 0xE4, 0x3E, 0x8B, 0x90, 0x88, 0xF3, 0x60, 0x6F, 0xE5, 0xB6, 0x7A, 0xC0, 0x0C, 0x49, 0xD3,
-    0x95, 0x9D, 0x02, 0xD6, 0xDB, 0x1E, 0x86, 0x21, 0x51, 0x88, 0xEF, 0xF7, 0x57, 0x90, 0x0A, 0x4F,
-    0x93, 0xAA, 0xB0, 0x63, 0x16, 0x5E, 0xFB, 0xAB, 0xF2, 0x11, 0x10, 0x88, 0x0D, 0x74, 0x16, 0xBD,
-    0xC5, 0x4A, 0x8A, 0x09, 0xCB, 0x5F, 0x7E, 0xB7, 0xBC, 0xDF, 0x6F, 0x80, 0xF9, 0x58, 0xFB, 0x01,
-    0xE7, 0x9C, 0x56, 0x18, 0x47, 0xFC, 0x40, 0x9D, 0x29, 0xF2, 0xC6, 0xB7, 0x5B, 0x43, 0x32, 0x01,
-    0x5F, 0x1A, 0xAC, 0x63, 0x5A, 0x52, 0x77, 0x3A, 0xA2, 0x2E, 0x03, 0x42, 0x64, 0xDA, 0x80, 0x2A,
-    0xC0, 0xCD, 0x41, 0xF5, 0x30, 0x7A, 0xC8, 0xC0, 0xF2, 0x2F, 0x06, 0x1E, 0x16, 0xD3, 0x67, 0x4C,
-    0xA7, 0x6D, 0xA8, 0x59, 0x92, 0x2D, 0xD6, 0x12, 0xFB, 0xDE, 0x99, 0x64, 0x0D, 0xAF, 0xD8, 0x3B,
-    0x26, 0x7F, 0x90, 0x08, 0x8F, 0x67, 0xCF, 0xB0, 0xD6, 0x08, 0x76, 0xB0, 0x0C, 0x39, 0xC0, 0xBD,
-    0xC5, 0x44, 0xE0, 0x64, 0x99, 0x05, 0xF7, 0x3D, 0x6B, 0xC4, 0x48, 0xAC, 0xD6, 0x08, 0xFD, 0xD1,
-    0x35, 0x56, 0x48, 0xC3, 0x83, 0x1F, 0x02, 0x38, 0xC1, 0x83, 0x5E, 0x0B, 0x14, 0x00, 0xD5, 0x6F,
-    0x8A, 0xF1, 0xB8, 0x93, 0x6C, 0x1D, 0x46, 0x54, 0xDB, 0xD8, 0x54, 0xC1, 0x37, 0x55, 0x3E, 0xD8,
-    0xAA, 0x70, 0xB6, 0xC5, 0x09, 0x01, 0x1F, 0x70, 0x52, 0x47, 0x08, 0x4A, 0xC2, 0xBC, 0x54, 0x58,
-    0x83, 0xEA, 0x51, 0x0E, 0xB6, 0xCC, 0x08, 0x79, 0x89, 0xAD, 0xF1, 0xD5, 0xD4, 0xBA, 0x85, 0x1B,
-    0x80, 0x4A, 0x95, 0x59, 0x02, 0x08, 0xBF, 0xC1, 0x2E, 0xF5, 0xE8, 0x17, 0x00, 0x3B, 0x8C, 0x53,
-    0xAB, 0x71, 0xAD, 0x6E, 0x33, 0xBF, 0x8C, 0xAB, 0x0B, 0x96, 0x20, 0xC0, 0x8B, 0x69, 0x32, 0x13,
-    0x80, 0xF5, 0x3A, 0xBF, 0x01, 0x8A, 0x38, 0x49, 0x13, 0xA1, 0x6D, 0x26, 0x56, 0xA7, 0xB1, 0x32,
-    0x30, 0xAF, 0x9C, 0xC9, 0x42, 0x4D, 0x58, 0x22, 0x89, 0x09, 0x38, 0x2A, 0x0F, 0x3F, 0x1F, 0xBD,
-    0xF6, 0x11, 0xB8, 0x9A, 0xA3, 0xD7, 0x0B, 0x78, 0x98, 0x78, 0x9D, 0x7B, 0xA2, 0x19, 0xB6, 0x84,
-    0x8C, 0x60, 0x46, 0x3F, 0x1F, 0x0F, 0x65, 0x70, 0x5E, 0x35, 0x08, 0x14, 0x9B, 0x80, 0x51, 0x41,
-    0xE3, 0x70, 0x10, 0x81, 0x2C, 0x1B, 0xB1, 0x99, 0x69, 0xA8, 0x45, 0x3C, 0x03, 0x52, 0x23, 0x42,
-    0xD8, 0x30, 0xC0, 0x77, 0xC0, 0x56, 0xAC, 0xAC, 0x98, 0xFA, 0xB6, 0xA6, 0xCA, 0xA3, 0x1F, 0xBA,
-    0x6C, 0x88, 0xBB, 0x3F, 0x35, 0x3E, 0x59, 0x1B, 0x0F, 0x43, 0x72, 0x96, 0x29, 0x8D, 0xE0, 0x0F,
-    0x6A, 0xA1, 0x8B, 0x87, 0x0E, 0x63, 0xFC, 0xF1, 0x24, 0x59, 0x83, 0x88, 0x57, 0x29, 0x62, 0x3E,
-    0xD1, 0x38, 0x8B, 0x7B, 0xD0, 0x31, 0x10, 0x7F, 0x6D, 0xF1, 0xA0, 0xD6, 0x30, 0x73, 0x5B, 0xE6,
-    0x51, 0xC6, 0xB1, 0xB8, 0xDB, 0xE7, 0x5F, 0x3B, 0x63, 0x2A, 0xFD, 0xD1, 0xDE, 0xC3, 0x51, 0x66,
-    0x53, 0x5E, 0x76, 0x50, 0x10, 0xA3, 0xAE, 0xD5, 0xFE, 0xE3, 0x1E, 0x13, 0x8B, 0x90, 0x0D, 0xA9,
-    0xD7, 0xBE, 0x84, 0xEF, 0x1B, 0xD4, 0xA0, 0x79, 0x7D, 0x26, 0xE2, 0xE5, 0x2E, 0x0A, 0x01, 0xEA,
-    0x97, 0xD0, 0xC2, 0x2C, 0xD0, 0xA2, 0x07, 0xB8, 0x61, 0x2C, 0xC2, 0xE6, 0xD2, 0x27, 0x50, 0xA9,
-    0xD9, 0x37, 0x63, 0xD1, 0x67, 0x0F, 0x81, 0xE7, 0xB9, 0x9B, 0x54, 0x57, 0xB8, 0xC0, 0x35, 0x2C,
-    0x82, 0xD8, 0x99, 0x2D, 0xE8, 0x3E, 0x03, 0x19, 0x00, 0xEE, 0xA9, 0x70, 0x03, 0xA9, 0x5A, 0xF3,
-    0x4F, 0x05, 0x9C, 0xB3, 0x91, 0x77, 0x17, 0x52, 0xB8, 0xCF, 0xE4, 0xAC, 0x49, 0xBE, 0x28, 0x8D,
-    0x00, 0x5A, 0x36, 0x37, 0x50, 0x6A, 0x43, 0x53, 0x51, 0x29, 0x88, 0x3D, 0x8D, 0x93, 0xDF, 0x81,
-    0x27, 0xBE, 0x99, 0xE0, 0x16, 0xDC, 0x0C, 0xF0, 0x43, 0x73, 0x6A, 0x24, 0xB2, 0xD7, 0x4D, 0x47,
-    0x5E, 0x02, 0x78, 0xF4, 0x51, 0x99, 0xAE, 0xEA, 0xB2, 0x8A, 0xF5, 0x80, 0x1A, 0x4F, 0xE6, 0xB7,
-    0x56, 0x78, 0x91, 0x80, 0x72, 0x20, 0xAE, 0x91, 0x4D, 0x28, 0x55, 0x5F, 0x30, 0xDB, 0x80, 0x1B,
-    0xEA, 0xE0, 0x83, 0x58, 0x09, 0x94, 0x09, 0xD4, 0x39, 0x6B, 0x0C, 0x30, 0x6B, 0x7A, 0x38, 0x6E,
-    0xDC, 0xEB, 0xFF, 0x9F, 0x71, 0x01, 0xC6, 0x35, 0x6B, 0xE3, 0x3A, 0x18, 0xD7, 0xC1, 0xB8, 0x36,
-    0x22, 0x7D, 0x8C, 0x73, 0xAC, 0x26, 0xAA, 0x0F, 0xF9, 0x21, 0xAC, 0x3D, 0x20, 0xBD, 0x56, 0xB4,
-    0xC6, 0x5E, 0x9C, 0x69, 0x26, 0xC0, 0x03, 0x68, 0x61, 0xEA, 0x39, 0xA3, 0x20, 0x81, 0x2E, 0x22,
-    0x30, 0x76, 0x19, 0x6A, 0x8E, 0x29, 0x64, 0x5F, 0xC7, 0x69, 0x72, 0x4F, 0xA4, 0x43, 0xFE, 0x20,
-    0x76, 0xA6, 0x5D, 0x1B, 0x1A, 0x48, 0x0F, 0x63, 0x36, 0x6D, 0x54, 0xE0, 0xBD, 0x7C, 0x91, 0x1F,
-    0x48, 0x0F, 0x96, 0x41, 0xD4, 0xC8, 0xB0, 0x81, 0x4E, 0x2F, 0x09, 0xC7, 0x1B, 0x95, 0x81, 0x4E,
-    0x18, 0x8B, 0x88, 0x0A, 0xD1, 0x71, 0xE8, 0x09, 0x6E, 0x02, 0x62, 0x51, 0x8C, 0xBF, 0xDF, 0x7C,
-    0x74, 0x86, 0x76, 0xAA, 0x3E, 0x96, 0x82, 0x6E, 0xD7, 0x0C, 0x4F, 0xF1, 0x87, 0xC2, 0x21, 0xAA,
-    0x84, 0x88, 0x1B, 0xCC, 0x5D, 0x1C, 0x98, 0x28, 0x42, 0xD9, 0x5A, 0xB1, 0x78, 0x11, 0x63, 0xE0,
-    0x2F, 0x8F, 0x21, 0x73, 0xAC, 0xDD, 0x39, 0x66, 0x3C, 0x00, 0x19, 0xC9, 0x53, 0xB8, 0xE4, 0xF8,
-    0xCD, 0xB2, 0x07, 0x8A, 0x4F, 0xAC, 0xB0, 0x08, 0x85, 0xAC, 0x85, 0x55, 0x5E, 0xEC, 0x4A, 0x76,
-    0x00, 0x75, 0xFC, 0x09, 0x02, 0x59, 0x02, 0x2E, 0x2C, 0x1C, 0xCF, 0x28, 0x12, 0xE1, 0x3B, 0x5C,
-    0x9C, 0xF4, 0x32, 0x95, 0x6D, 0x36, 0x60, 0xD6, 0xE7, 0xA8, 0xA9, 0xA6, 0x96, 0x5D, 0x54, 0x4E,
-    0x24, 0x52, 0xD8, 0xE4, 0x97, 0x58, 0xEE, 0x82, 0x3F, 0x90, 0xA0, 0x04, 0x95, 0x9B, 0x0E, 0x9B,
-    0x40, 0x80, 0x6A, 0x24, 0x6E, 0x03, 0x57, 0x98, 0x3D, 0x1C, 0x3E, 0x8A, 0x9D, 0xEB, 0x85, 0xD3,
-    0x7B, 0x07, 0x83, 0xA9, 0xAC, 0xBA, 0x79, 0x0B, 0xE9, 0xB2, 0xAD, 0x4F, 0xA3, 0x5A, 0x86, 0x1D,
-    0x2B, 0xE5, 0xDD, 0xBD, 0xC7, 0xE0, 0xD7, 0x9D, 0xE2, 0x6E, 0x8B, 0xAC, 0x47, 0x3D, 0x41, 0xA4,
-    0xA0, 0xF1, 0x29, 0xC1, 0x1F, 0x08, 0x7D, 0xBF, 0xC8, 0x29, 0x06, 0x13, 0x49, 0x03, 0x9C, 0x20,
-    0x28, 0xC0, 0x1D, 0x86, 0xB5, 0x8E, 0x08, 0x50, 0x53, 0x49, 0xCE, 0x0E, 0x24, 0x23, 0xF7, 0x53,
-    0x01, 0xC2, 0xC0, 0x56, 0x62, 0x1F, 0x85, 0xB3, 0xE2, 0x8F, 0x7E, 0x40, 0x7D, 0xFA, 0x2E, 0xFD,
-    0x09, 0x77, 0xC1, 0x0F, 0x1E, 0x49, 0x42, 0xE0, 0x72, 0x19, 0xE1, 0x0F, 0xEE, 0x05, 0x7E, 0x3E,
-    0x84, 0x9E, 0x3D, 0xE9, 0xF3, 0x91, 0x59, 0xA1, 0xF7, 0xA6, 0x98, 0x73, 0x53, 0x88, 0x8B, 0x16,
-    0x08, 0x5D, 0xB9, 0x68, 0x2D, 0x46, 0x24, 0x8A, 0xF3, 0x95, 0x72, 0x5F, 0x61, 0x3C, 0xB3, 0x19,
-    0x38, 0x44, 0x11, 0x09, 0x7A, 0x02, 0x16, 0x9D, 0xDD, 0x1C, 0xA2, 0xFA, 0x45, 0x86, 0x46, 0x3D,
-    0xCC, 0x8C, 0x20, 0x0D, 0x6A, 0xB7, 0x50, 0xDD, 0xEA, 0x56, 0xB1, 0x62, 0x46, 0x13, 0x25, 0x2D,
-    0x72, 0x99, 0x14, 0x0F, 0xB5, 0x13, 0xFA, 0xFC, 0xA0, 0x02, 0xF5, 0xEF, 0xAC, 0x5A, 0x9E, 0xC3,
-    0x2E, 0x48, 0xA0, 0x8F, 0xD0, 0x2A, 0xE1, 0xD1, 0xC4, 0x47, 0xE0, 0xED, 0x5D, 0x49, 0xD1, 0x24,
-    0xFE, 0x5B, 0x0C, 0x20, 0x83, 0x03, 0x46, 0xC4, 0xAE, 0xD3, 0xD5, 0x76, 0xC2, 0x2F, 0xAD, 0xA9,
-    0x76, 0x52, 0x9F, 0xF3, 0x0B, 0x1E, 0x0C, 0x51, 0xB8, 0xC4, 0x81, 0x1B, 0x4D, 0x5C, 0xC9, 0x1D,
-    0xAE, 0x84, 0x4D, 0xB6, 0x0F, 0x37, 0x49, 0x96, 0x4D, 0x56, 0x2D, 0x57, 0xD9, 0x3E, 0x07, 0x24,
-    0x19, 0xA2, 0x53, 0x13, 0x1A, 0x1B, 0x55, 0x37, 0x83, 0x63, 0xAE, 0x4B, 0x71, 0xA7, 0x13, 0xFF,
-    0xAA, 0x98, 0xD4, 0x15, 0x5D, 0x89, 0xF1, 0xDE, 0x88, 0xDA, 0xBB, 0x22, 0xE7, 0xA0, 0xA0, 0xC8,
-    0x98, 0x68, 0x85, 0xDA, 0x9D, 0xB4, 0x97, 0xED, 0x37, 0xAE, 0xA0, 0xEF, 0x44, 0xF9, 0xDD, 0x08,
-    0xA7, 0x47, 0x48, 0x4F, 0x6A, 0xCE, 0x06, 0xA9, 0x00, 0x79, 0x14, 0xD0, 0x43, 0x22, 0x41, 0x43,
-    0x36, 0x15, 0xD4, 0x11, 0x33, 0xC2, 0xBE, 0x59, 0xAF, 0x58, 0x2D, 0xB2, 0xE6, 0x92, 0xFD, 0xEC,
-    0x97, 0xF4, 0xCD, 0x3E, 0x7B, 0x42, 0xAD, 0x31, 0xE5, 0x93, 0xEE, 0xC1, 0x8C, 0xAC, 0xCF, 0x19,
-    0xF3, 0x3B, 0x75, 0x0F, 0xB8, 0x83, 0xAA, 0xD8, 0x9F, 0x0B, 0xEC, 0x1B, 0x48, 0xD0, 0xE7, 0x8D,
-    0x8B, 0xAB, 0x6C, 0xDD, 0x4F, 0x03, 0x76, 0xF6, 0x7A, 0xF8, 0x11, 0xA1, 0xA4, 0x5E, 0xD1, 0xC0,
-    0xF2, 0xD3, 0x54, 0x95, 0x8D, 0xC2, 0xB5, 0x58, 0xE1, 0x1A, 0x85, 0x3F, 0x3B, 0xAF, 0xC3, 0xE0,
-    0x26, 0xDE, 0x54, 0x30, 0x9D, 0x1A, 0x08, 0xDD, 0x47, 0x1B, 0x92, 0x39, 0x87, 0xED, 0x60, 0x59,
-    0xE8, 0x8D, 0x86, 0x2F, 0x11, 0x58, 0x87, 0x10, 0x1F, 0x15, 0xBB, 0xA1, 0xF0, 0xC4, 0x25, 0xE1,
-    0xF4, 0xB2, 0x92, 0xBE, 0xCF, 0x0E, 0x02, 0x6A, 0xC1, 0x5E, 0x00, 0x86, 0xD9, 0xB2, 0xB3, 0x28,
-    0xFC, 0xDB, 0x08, 0x72, 0xF8, 0x33, 0xAB, 0x06, 0x35, 0x9A, 0x84, 0xBF, 0x60, 0x6B, 0x38, 0xF6,
-    0x48, 0x17, 0xA1, 0xB1, 0x69, 0x43, 0x2E, 0x1B, 0xA2, 0xF2, 0xA0, 0x0D, 0xF9, 0x5C, 0x53, 0x8A,
-    0x53, 0xD3, 0x47, 0x7F, 0xC4, 0xDF, 0xFF, 0x05, 0xA7, 0x6B, 0x59, 0xB5, 0xC2, 0x3F, 0xF8, 0x2D,
-    0x59, 0x2D, 0xC1, 0x15, 0xD9, 0xC6, 0x34, 0x34, 0x4D, 0x5F, 0xF8, 0x20, 0x0B, 0x77, 0xA9, 0xD8,
-    0x60, 0xEB, 0x48, 0xDF, 0xDB, 0x1A, 0x78, 0x97, 0x8C, 0x8C, 0x06, 0x21, 0x31, 0x10, 0x3D, 0xCA,
-    0xA1, 0x58, 0xA9, 0x9C, 0xF2, 0x6B, 0xBF, 0x6E, 0x55, 0xCF, 0xE4, 0x23, 0x80, 0xB6, 0x65, 0xF3,
-    0x17, 0x1D, 0xF6, 0xDD, 0x08, 0xFD, 0x7D, 0x15, 0xA1, 0x39, 0x9F, 0xD1, 0x02, 0xB4, 0x8C, 0x10,
-    0xE0, 0x74, 0x82, 0x66, 0xF9, 0x78, 0xA2, 0xDC, 0x34, 0xFB, 0x70, 0x19, 0x5A, 0xD2, 0x93, 0x43,
-    0xEE, 0x6C, 0x34, 0x55, 0x4A, 0x00, 0x14, 0x8C, 0x3C, 0x87, 0xAF, 0x27, 0xF8, 0x95, 0xBD, 0xC1,
-    0xC2, 0xFD, 0x4F, 0xBF, 0xA2, 0x13, 0x4F, 0x56, 0x88, 0x55, 0xD6, 0x6B, 0x81, 0x71, 0x2E, 0x5E,
-    0x9F, 0xA8, 0x8F, 0x08, 0x0A, 0x2B, 0xDF, 0x23, 0x30, 0x8E, 0x5D, 0xA3, 0x30, 0xC1, 0x5C, 0x06,
-    0xD9, 0x3E, 0xC8, 0x77, 0xFC, 0x95, 0x44, 0x98, 0x4D, 0xAF, 0xA2, 0x79, 0x42, 0x7F, 0x64, 0x3A,
-    0x26, 0x6A, 0xF1, 0x15, 0x98, 0xFF, 0x09, 0xEA, 0x0C, 0xE8, 0xA2, 0x30, 0xB5, 0x44, 0x78, 0xF4,
-    0x1D, 0x60, 0x11, 0xC4, 0x88, 0xB9, 0x00, 0x76, 0x00, 0x26, 0xDB, 0x25, 0xB7, 0x68, 0x6C, 0x3E,
-    0x1C, 0xDA, 0x9D, 0x0F, 0x24, 0xF4, 0x63, 0x5F, 0xD1, 0x2E, 0x83, 0x36, 0x92, 0xF7, 0x77, 0xD9,
-    0xE9, 0x98, 0xD1, 0x7A, 0x78, 0xEC, 0x41, 0x68, 0xED, 0xBD, 0x70, 0x6B, 0x2A, 0xB0, 0x69, 0xD9,
-    0x41, 0x14, 0x32, 0x1A, 0x65, 0xA7, 0xDB, 0x99, 0x12, 0x9C, 0x5F, 0xCC, 0xC5, 0xF8, 0xC2, 0x8A,
-    0xF1, 0xB1, 0xCB, 0x9B, 0x2B, 0x53, 0x01, 0x61, 0xF3, 0xA8, 0xC5, 0xB9, 0x18, 0x96, 0xC2, 0x42,
-    0x3D, 0x96, 0xC1, 0x22, 0x4B, 0x55, 0xA9, 0x0E, 0x54, 0x87, 0xC9, 0x7B, 0x58, 0x03, 0x13, 0x2F,
-    0xF9, 0x8C, 0xF8, 0x9B, 0xB3, 0x27, 0xD9, 0xEA, 0x25, 0x6A, 0x4F, 0xD7, 0xEC, 0xB3, 0x1E, 0x37,
-    0x3B, 0xF5, 0xA5, 0xCB, 0x1E, 0x03, 0xFA, 0x91, 0xD5, 0x18, 0x7A, 0xD3, 0xE9, 0x8F, 0xF1, 0x50,
-    0x07, 0x97, 0xAE, 0x5A, 0xC2, 0x73, 0xBA, 0xCE, 0x1E, 0xC7, 0x84, 0xA8, 0xEC, 0xAD, 0xF8, 0x06,
-    0x6D, 0x21, 0x47, 0x53, 0x43, 0x75, 0x62, 0x49, 0x94, 0x04, 0xAA, 0xE0, 0xE2, 0xCC, 0x42, 0x51,
-    0x0F, 0xE0, 0x0E, 0xED, 0x8E, 0xC8, 0xDE, 0xB5, 0x4C, 0x66, 0xBE, 0x8A, 0x7D, 0xA3, 0x5E, 0x83,
-    0x81, 0x3A, 0x04, 0x03, 0x39, 0x02, 0x06, 0x1D, 0xC1, 0x60, 0x66, 0x1A, 0x01, 0x0C, 0x30, 0x9B,
-    0x45, 0x69, 0xE5, 0x90, 0x11, 0x23, 0x61, 0x26, 0xEF, 0xEF, 0xC0, 0xDE, 0x8C, 0x6F, 0x6A, 0xAE,
-    0x42, 0x3B, 0x23, 0x92, 0xC7, 0xE4, 0xDB, 0x11, 0xCD, 0x8A, 0xDE, 0x31, 0x27, 0x02, 0x40, 0x3C,
-    0xBD, 0x00, 0x56, 0x56, 0x23, 0x73, 0x97, 0xC7, 0x32, 0x94, 0x7C, 0x90, 0xD5, 0xBB, 0x8D, 0x43,
-    0x6D, 0xD9, 0x45, 0x99, 0xFF, 0x4A, 0x54, 0x0D, 0x44, 0x6D, 0xBE, 0xB0, 0x68, 0x20, 0x91, 0xB7,
-    0xD8, 0x4A, 0xB7, 0xB1, 0xBF, 0x40, 0x0A, 0x59, 0xF6, 0x74, 0xCD, 0x7F, 0xD0, 0x32, 0xB2, 0x4E,
-    0xE5, 0xB9, 0xF7, 0x9F, 0xBB, 0x32, 0x83, 0x20, 0xBB, 0xF2, 0xC6, 0x78, 0x24, 0xB9, 0xED, 0x29,
-    0x44, 0xC7, 0x92, 0x6C, 0xCA, 0xBE, 0xC9, 0x66, 0x2A, 0x75, 0x9C, 0x17, 0xC5, 0x16, 0x35, 0xC4,
-    0xDB, 0xF2, 0xF2, 0x65, 0x97, 0x7B, 0xCB, 0xD8, 0x95, 0xBD, 0x01, 0x84, 0x40, 0xDB, 0x9B, 0xD3,
-    0x2E, 0x7B, 0x04, 0x32, 0xDA, 0x6A, 0x21, 0xF7, 0xA0, 0x15, 0x22, 0xBC, 0x92, 0x5F, 0x03, 0x27,
-    0x5C, 0x93, 0x6B, 0x36, 0x01, 0x8D, 0xDA, 0x0C, 0x9D, 0x8E, 0xCD, 0xA1, 0x22, 0x6D, 0xF1, 0x00,
-    0x09, 0xA0, 0x3E, 0x44, 0x73, 0xA7, 0xB7, 0xCA, 0xD6, 0x18, 0x8D, 0x48, 0x9C, 0xD7, 0x60, 0xEC,
-    0xEB, 0x1A, 0xA9, 0xE0, 0x61, 0x9E, 0x71, 0x20, 0x12, 0xD3, 0x83, 0x71, 0x4C, 0x47, 0x26, 0xC2,
-    0x22, 0x68, 0x2E, 0x1A, 0x50, 0x28, 0x08, 0x28, 0x98, 0x36, 0xAA, 0xA5, 0x2C, 0xB0, 0xAE, 0xC9,
-    0x60, 0x0C, 0x0E, 0x1B, 0x63, 0xEE, 0xFB, 0xF9, 0x10, 0x69, 0x95, 0xDD, 0x9D, 0x1A, 0xC0, 0x96,
-    0xC9, 0x55, 0xCC, 0x45, 0x84, 0x6A, 0xEC, 0xD4, 0xD2, 0x6A, 0x99, 0xF8, 0x76, 0x08, 0xE2, 0x40,
-    0xFD, 0x13, 0x72, 0xC0, 0x23, 0xB8, 0xBB, 0xA8, 0xA2, 0x92, 0xEF, 0x24, 0xC8, 0x12, 0x5C, 0x94,
-    0x0B, 0xB2, 0xBC, 0xC8, 0x96, 0x51, 0xB9, 0xC4, 0xC5, 0xF9, 0x8E, 0x50, 0x22, 0xB2, 0xC1, 0xA0,
-    0x6B, 0xE0, 0x3C, 0x08, 0xAF, 0x28, 0xFD, 0x29, 0xC5, 0x27, 0x3E, 0xC0, 0x38, 0xEA, 0x9D, 0x15,
-    0x42, 0x07, 0x34, 0x97, 0x68, 0xC5, 0x39, 0x7E, 0x87, 0xC3, 0x10, 0x3C, 0x06, 0x38, 0x86, 0xD6,
-    0xC4, 0xA4, 0xD8, 0x95, 0x17, 0x47, 0xB6, 0xF3, 0x20, 0xE7, 0x17, 0x1D, 0x33, 0x85, 0x3F, 0x7C,
-    0xCD, 0x1A, 0x3B, 0xF5, 0xF8, 0x86, 0x80, 0x4C, 0xBB, 0x23, 0xBF, 0xFB, 0x9E, 0xCF, 0x39, 0xF9,
-    0x2D, 0x29, 0x1A, 0x39, 0x84, 0x99, 0xEC, 0x9B, 0x89, 0x00, 0x45, 0xE4, 0x58, 0x7B, 0x05, 0xFC,
-    0xBD, 0x01, 0xF2, 0xEB, 0x8F, 0xBF, 0x8C, 0xB4, 0xB4, 0xC3, 0x76, 0x89, 0x8F, 0x32, 0x6F, 0x2B,
-    0x7C, 0xC6, 0x57, 0x0D, 0xD5, 0x56, 0x84, 0xF1, 0xFF, 0x02, 0xB5, 0x59, 0x31, 0x8C, 0x1E, 0xC5,
-    0x15, 0x7E, 0xBB, 0x6B, 0x7B, 0x89, 0x57, 0x62, 0x5C, 0xD8, 0x52, 0x64, 0x64, 0x6F, 0x13, 0x24,
-    0x82, 0x70, 0xB6, 0x49, 0xE9, 0xF3, 0xAC, 0xB1, 0x04, 0x05, 0xC5, 0x5D, 0xC1, 0x29, 0x05, 0x85,
-    0x8B, 0x34, 0x40, 0x11, 0x37, 0x48, 0x34, 0xF8, 0x76, 0x8D, 0xA5, 0xA4, 0xA0, 0xB0, 0x8B, 0xA0,
-    0x14, 0x91, 0xA2, 0x2B, 0x12, 0xC9, 0x18, 0x24, 0x28, 0x5C, 0x50, 0xDC, 0xDD, 0x8C, 0x7D, 0x52,
-    0x28, 0x2C, 0x85, 0x35, 0x56, 0x44, 0x41, 0xE1, 0xB5, 0x31, 0x89, 0x08, 0xC5, 0xAD, 0x61, 0xCF,
-    0x5E, 0xFB, 0x66, 0xF7, 0xE5, 0x7B, 0xB3, 0x7B, 0xE7, 0x83, 0xA0, 0x28, 0x39, 0xF0, 0xEF, 0xFF,
-    0xBF, 0xBB, 0x7F, 0x76, 0xF7, 0xBD, 0x99, 0x37, 0xDF, 0xFB, 0xDE, 0xF7, 0xC6, 0xF4, 0x72, 0x30,
-    0x84, 0x43, 0xD0, 0xD3, 0x1C, 0x51, 0x30, 0x17, 0x35, 0x71, 0x93, 0xD4, 0xAA, 0x56, 0x55, 0x6A,
-    0x33, 0xAB, 0xAD, 0x2E, 0x8B, 0xD2, 0xE4, 0xAF, 0x92, 0xBC, 0x12, 0x4B, 0xAA, 0x24, 0xD3, 0xC5,
-    0xEC, 0xD4, 0xD0, 0x66, 0x35, 0x69, 0x7C, 0xCB, 0x89, 0x49, 0xDE, 0x83, 0xFF, 0xC9, 0x67, 0x6C,
-    0xC1, 0x36, 0x63, 0x1B, 0x0F, 0x14, 0x55, 0x14, 0x59, 0x0A, 0x72, 0x1A, 0x5F, 0xE9, 0x90, 0x53,
-    0xC6, 0x0D, 0xA5, 0xDC, 0x92, 0x6A, 0x1F, 0xA3, 0xA8, 0x83, 0xBF, 0x1E, 0x17, 0x0A, 0x7C, 0x32,
-    0x8B, 0x67, 0xB9, 0xA2, 0x02, 0x17, 0x0F, 0x0E, 0x17, 0x88, 0x0C, 0x06, 0x35, 0x06, 0xD3, 0x6A,
-    0xFC, 0x64, 0xCC, 0xB5, 0x62, 0x6E, 0x23, 0x66, 0x47, 0xBB, 0x88, 0x66, 0x5E, 0x99, 0x29, 0x78,
-    0x48, 0xB9, 0x4B, 0xCF, 0x74, 0x19, 0x2D, 0xE1, 0x9D, 0xE6, 0x4E, 0x7D, 0xD5, 0x69, 0xEE, 0x8F,
-    0x99, 0xE5, 0xC7, 0x68, 0x7F, 0x6A, 0xE3, 0xB6, 0xC8, 0xB5, 0xED, 0x43, 0x17, 0x76, 0xAA, 0x8A,
-    0x1B, 0x26, 0xF5, 0x51, 0x43, 0xBA, 0xC8, 0xC9, 0x38, 0x0A, 0xD8, 0xD2, 0xFB, 0xBC, 0x08, 0x6B,
-    0x76, 0xB7, 0x79, 0x5B, 0xE6, 0x11, 0xE0, 0x4F, 0x38, 0xA0, 0x03, 0xC3, 0x1C, 0x45, 0x2D, 0x9C,
-    0xC2, 0xF9, 0x1B, 0x5B, 0x2F, 0x59, 0xC0, 0xFE, 0xAD, 0x6F, 0x2F, 0xFB, 0x68, 0x70, 0xA9, 0xB8,
-    0x4D, 0xD6, 0xDF, 0x90, 0xBB, 0xB1, 0xF4, 0xB4, 0xA3, 0x98, 0xAB, 0xF8, 0x9E, 0x8B, 0x1A, 0x9D,
-    0xBB, 0xA4, 0xD2, 0x27, 0x9A, 0x04, 0xAB, 0x31, 0x2D, 0x21, 0x16, 0xB2, 0xC0, 0xB8, 0x99, 0x89,
-    0x9D, 0x62, 0x17, 0x70, 0xE7, 0x03, 0xF2, 0xD4, 0x61, 0x3D, 0xFB, 0xF1, 0x6A, 0x33, 0x37, 0x37,
-    0xC6, 0xE7, 0x14, 0xEE, 0x4A, 0xBE, 0x34, 0x25, 0x75, 0x08, 0xB4, 0xA2, 0x57, 0x12, 0x7B, 0x29,
-    0xE5, 0xE4, 0xC4, 0x99, 0x76, 0xBF, 0x3A, 0xA4, 0x72, 0x7A, 0xE6, 0x83, 0xA3, 0x44, 0xAF, 0x5F,
-    0x6E, 0x88, 0xD6, 0x62, 0x4B, 0xD1, 0x7B, 0x8A, 0xE8, 0xD0, 0x6B, 0x33, 0x44, 0x97, 0xEA, 0x25,
-    0x8A, 0xAE, 0x58, 0xD3, 0xFD, 0x22, 0xB2, 0xA7, 0xCE, 0x34, 0x71, 0x45, 0x19, 0xC5, 0xF7, 0x5F,
-    0x6A, 0xB0, 0xA0, 0x9E, 0x36, 0x5F, 0xD9, 0x9F, 0x14, 0x5F, 0x6B, 0x97, 0x74, 0xBC, 0x5A, 0x2F,
-    0xCD, 0xA8, 0xB3, 0xB7, 0x5A, 0xCD, 0xF4, 0xE1, 0x22, 0xED, 0x0B, 0x88, 0xDA, 0x34, 0x57, 0x88,
-    0x0D, 0xAB, 0x46, 0xB5, 0x9C, 0x9B, 0x17, 0xDA, 0xC8, 0x69, 0x9B, 0x34, 0x86, 0x54, 0x3D, 0x50,
-    0x76, 0xC5, 0x51, 0x11, 0x37, 0x74, 0xFE, 0x27, 0xDE, 0x0A, 0xF3, 0x67, 0xCC, 0xEB, 0x17, 0x2F,
-    0x2E, 0x13, 0x61, 0x46, 0xD8, 0x5F, 0xC2, 0xD2, 0x67, 0x76, 0xBF, 0xA8, 0xFB, 0xC2, 0x15, 0xEE,
-    0xFB, 0x96, 0xB1, 0xF7, 0xF7, 0x58, 0x86, 0xEE, 0x93, 0x13, 0xE5, 0x9D, 0x25, 0x75, 0x28, 0xB2,
-    0xCD, 0x33, 0x1F, 0xA8, 0xC8, 0xBE, 0x6E, 0x67, 0x16, 0x68, 0x8D, 0xB8, 0x8E, 0xDE, 0x8B, 0x3E,
-    0x2B, 0x0F, 0xBD, 0xA6, 0x54, 0x7E, 0xA9, 0x3E, 0x9A, 0x62, 0x19, 0xCD, 0xCC, 0x2F, 0xA2, 0x2B,
-    0xF9, 0x93, 0xDF, 0xB7, 0x8C, 0x03, 0xF3, 0xF3, 0x9A, 0x87, 0x62, 0xFA, 0x1A, 0x0E, 0x11, 0xDF,
-    0x6A, 0x97, 0x3B, 0xB5, 0x1C, 0xAD, 0x5D, 0x5E, 0x67, 0x97, 0x3A, 0xC1, 0xEF, 0xCF, 0x49, 0x10,
-    0x1A, 0xD5, 0x04, 0xEF, 0x74, 0x6C, 0x9A, 0xF0, 0x5D, 0xC6, 0x33, 0xC7, 0xB6, 0x5F, 0x39, 0x40,
-    0x07, 0x2F, 0x5E, 0xFC, 0xE3, 0x74, 0x65, 0x3F, 0xE9, 0x2E, 0xE1, 0xEA, 0x97, 0x2B, 0x94, 0x54,
-    0x84, 0xE5, 0x62, 0xAB, 0x92, 0x3A, 0xE2, 0xAE, 0xE0, 0xDF, 0x5E, 0x5C, 0xF4, 0x57, 0xB1, 0xAD,
-    0xFB, 0x16, 0x28, 0xAE, 0xD2, 0x36, 0x1A, 0x28, 0xE8, 0x48, 0xAD, 0xFE, 0x01, 0x38, 0x0B, 0x56,
-    0x80, 0xEC, 0xC8, 0x25, 0x6D, 0x6A, 0x61, 0xFC, 0x55, 0x7A, 0x07, 0x20, 0x18, 0x08, 0x89, 0x14,
-    0x08, 0xE4, 0xF0, 0x2F, 0x72, 0x51, 0x37, 0xFE, 0x8B, 0xDB, 0xB8, 0x55, 0x4D, 0xD2, 0x48, 0x8C,
-    0xB5, 0xC0, 0xB8, 0x52, 0xBC, 0x61, 0xD3, 0xB5, 0x8F, 0xAD, 0xE0, 0x5E, 0x60, 0x8E, 0x4C, 0x22,
-    0x20, 0xD3, 0xC3, 0x5E, 0x3E, 0x40, 0x63, 0xCD, 0x82, 0xEF, 0xBB, 0x9F, 0xF3, 0x70, 0x58, 0xF3,
-    0xCD, 0x6F, 0xFF, 0xBA, 0x85, 0x5F, 0x8A, 0x6F, 0xD6, 0xC5, 0x70, 0x98, 0xE6, 0x6F, 0xD6, 0x74,
-    0xF8, 0x30, 0x05, 0xFF, 0xE5, 0x97, 0x64, 0xDF, 0x09, 0x57, 0xAC, 0xB6, 0xBB, 0x28, 0x29, 0x75,
-    0xA9, 0xC9, 0x99, 0x3B, 0x83, 0x8C, 0xAE, 0xC4, 0xBD, 0x76, 0x0B, 0xEE, 0xC9, 0x2E, 0x6C, 0xC3,
-    0x36, 0x6A, 0x90, 0xFC, 0xF5, 0x9E, 0xF3, 0x71, 0x97, 0x0D, 0x0B, 0x7A, 0x29, 0xEB, 0xB2, 0xEE,
-    0x98, 0x5B, 0x2E, 0x3A, 0xA4, 0x5F, 0xBE, 0x8B, 0x96, 0xB0, 0x9B, 0x40, 0x84, 0x49, 0x9A, 0xA8,
-    0xD3, 0xB9, 0x5E, 0x75, 0x82, 0x13, 0xA0, 0x26, 0xBB, 0xDE, 0x27, 0xAD, 0xC9, 0x17, 0xE2, 0x9A,
-    0xCA, 0x9F, 0x8E, 0x3B, 0x15, 0x38, 0x4A, 0xF3, 0xAC, 0x21, 0x27, 0x29, 0x62, 0x75, 0x4F, 0xCB,
-    0xF4, 0x6B, 0x58, 0x26, 0xFC, 0x8D, 0x95, 0x46, 0xD8, 0xD3, 0x2E, 0x7B, 0xD6, 0x25, 0xD7, 0xBA,
-    0xAC, 0xD6, 0xEA, 0x32, 0xE7, 0x17, 0x64, 0xF7, 0x92, 0xEA, 0x5E, 0x43, 0x0B, 0xEA, 0x9C, 0x8D,
-    0x9A, 0x7E, 0x25, 0xCF, 0x90, 0x99, 0x61, 0x8B, 0xFC, 0x4A, 0x4B, 0xC2, 0x74, 0x89, 0xFE, 0xBC,
-    0xC9, 0x22, 0x36, 0x68, 0x49, 0x6C, 0x83, 0x87, 0xF0, 0xC3, 0x1B, 0xDF, 0xA3, 0x69, 0x81, 0x46,
-    0xEB, 0xC8, 0xBD, 0x20, 0x87, 0xF9, 0x93, 0x18, 0x4F, 0xCF, 0xB1, 0x85, 0xFD, 0xB3, 0xCD, 0xDE,
-    0x73, 0x96, 0xC4, 0x01, 0xAD, 0x10, 0x66, 0xB1, 0x82, 0x9B, 0xB0, 0x51, 0xF8, 0xD1, 0x53, 0xD8,
-    0x02, 0x5E, 0xD8, 0x51, 0xC3, 0xB8, 0xE1, 0xE9, 0x8B, 0x25, 0xED, 0xF3, 0x89, 0x4D, 0x61, 0xA3,
-    0x40, 0x61, 0xF5, 0x2E, 0x65, 0x95, 0x70, 0x9E, 0x26, 0x6C, 0xFC, 0x32, 0xC5, 0x72, 0xAB, 0x5F,
-    0x00, 0x65, 0xCA, 0x0E, 0x5F, 0x98, 0xEC, 0x44, 0xCF, 0xFD, 0x42, 0xE2, 0x4E, 0x2D, 0xBA, 0xCC,
-    0xC1, 0xE2, 0x69, 0x60, 0xFE, 0xDA, 0x7A, 0x4B, 0xE9, 0xD9, 0x7F, 0xB4, 0xA4, 0x63, 0x1E, 0xC8,
-    0xC5, 0xDC, 0x87, 0x60, 0x80, 0x1A, 0x8E, 0xF7, 0x9C, 0x87, 0x5D, 0x4A, 0x6B, 0x32, 0x65, 0x30,
-    0x25, 0x0B, 0x40, 0x03, 0x6B, 0xDA, 0xC6, 0x58, 0x4E, 0x95, 0x00, 0x7C, 0x65, 0x88, 0x89, 0x36,
-    0xBB, 0xB3, 0x07, 0x4E, 0x73, 0x5B, 0x70, 0x7E, 0x60, 0x93, 0x3D, 0xE3, 0x76, 0x42, 0x06, 0x26,
-    0xE4, 0xD3, 0xCE, 0x07, 0x9A, 0x71, 0x99, 0x81, 0xE9, 0x42, 0xE6, 0xB5, 0x82, 0xE8, 0xDC, 0xC0,
-    0x74, 0x3F, 0x6D, 0x40, 0x35, 0x98, 0x4E, 0xA7, 0x29, 0x74, 0xB8, 0x7D, 0x00, 0x41, 0x99, 0xB7,
-    0x7B, 0xD2, 0xCC, 0xE5, 0x44, 0xA3, 0x2E, 0x69, 0xC8, 0x80, 0x80, 0x25, 0xBF, 0x93, 0x66, 0xA0,
-    0xAD, 0xF9, 0x44, 0xF2, 0x07, 0x4B, 0xAE, 0x03, 0x90, 0x48, 0xC2, 0x29, 0xE8, 0xF0, 0x17, 0x71,
-    0x39, 0xFA, 0x51, 0x6B, 0x25, 0xF8, 0x12, 0xF7, 0xE9, 0x93, 0xD6, 0x3B, 0xA2, 0x01, 0x4E, 0x32,
-    0x2B, 0x1E, 0x55, 0xE5, 0x3D, 0xC1, 0x43, 0x1D, 0x02, 0xBE, 0xE2, 0xB2, 0x11, 0x57, 0x88, 0x77,
-    0xD2, 0x00, 0xEB, 0xE2, 0x13, 0x74, 0x32, 0xBE, 0x0C, 0x26, 0x9E, 0xC2, 0x57, 0x7C, 0xA7, 0x03,
-    0x22, 0x12, 0xFB, 0x88, 0x7C, 0xA5, 0x25, 0xE2, 0xC1, 0x08, 0xCE, 0x03, 0x70, 0xFE, 0xE3, 0x61,
-    0xBD, 0x2D, 0x74, 0x1A, 0x2E, 0x62, 0xF1, 0x35, 0x74, 0x63, 0xEC, 0xA2, 0x75, 0xB8, 0x28, 0x64,
-    0xCF, 0x6B, 0x37, 0x06, 0x4F, 0x97, 0x3D, 0x25, 0xF7, 0x4F, 0x56, 0x24, 0x2E, 0x24, 0x7A, 0x00,
-    0x26, 0xC3, 0x09, 0x92, 0x19, 0x1B, 0xE9, 0x77, 0x0B, 0xB9, 0x2B, 0x25, 0xEC, 0x70, 0x92, 0xFB,
-    0x0A, 0x13, 0x61, 0x39, 0x34, 0xB7, 0x7F, 0xDA, 0xB6, 0x7E, 0x5C, 0x4D, 0x20, 0xBB, 0x24, 0x5E,
-    0x8A, 0x62, 0x5C, 0x4C, 0xBA, 0xDA, 0x78, 0x27, 0x78, 0xDC, 0xAF, 0x25, 0x1C, 0x7E, 0xD5, 0x7A,
-    0x1F, 0x06, 0xBB, 0x24, 0x4B, 0xC9, 0x2C, 0xFC, 0xD7, 0x92, 0x6F, 0x94, 0xAD, 0x8E, 0x2B, 0x09,
-    0x37, 0x43, 0xD3, 0xE0, 0xCB, 0x51, 0x94, 0x03, 0x25, 0x5C, 0xB8, 0x3C, 0x85, 0xB3, 0xA8, 0xC6,
-    0x05, 0xA5, 0xC3, 0x18, 0xB7, 0x18, 0xF9, 0x24, 0xEB, 0x09, 0x9C, 0x1E, 0xC3, 0x66, 0x04, 0x6A,
-    0x58, 0x4E, 0xF6, 0x45, 0x91, 0x4B, 0xD4, 0x12, 0xE6, 0x4E, 0x56, 0x83, 0x45, 0x64, 0x56, 0x82,
-    0x66, 0xB0, 0xE4, 0x69, 0x31, 0xE0, 0x1F, 0x16, 0x5A, 0x92, 0x6A, 0x8B, 0x84, 0x60, 0x59, 0xC2,
-    0x60, 0xE6, 0x41, 0xB1, 0xFA, 0xAA, 0xEC, 0x5F, 0xD2, 0x0A, 0x48, 0x82, 0x41, 0x49, 0x38, 0xF5,
-    0x65, 0xB9, 0x39, 0x69, 0x33, 0xB9, 0x99, 0x43, 0xF9, 0xA2, 0xBF, 0x28, 0xFE, 0x3E, 0x87, 0xD8,
-    0xFA, 0x52, 0x87, 0xC7, 0x73, 0x5F, 0x3D, 0xF0, 0x64, 0xDC, 0x79, 0x78, 0xB1, 0xEC, 0x1B, 0x65,
-    0x12, 0xD6, 0x06, 0x98, 0x4B, 0x79, 0x98, 0xE2, 0x85, 0x38, 0x15, 0x52, 0x22, 0x65, 0x6A, 0xC7,
-    0x3F, 0x50, 0xB2, 0x1E, 0x49, 0xB7, 0xEA, 0x3B, 0x34, 0x39, 0x7D, 0xE4, 0xEF, 0x42, 0xC6, 0xEB,
-    0x3D, 0xB0, 0xC1, 0x32, 0xD3, 0xB1, 0x60, 0xA4, 0x34, 0xDE, 0x8C, 0xA4, 0x97, 0x8F, 0x94, 0x7B,
-    0x1A, 0x36, 0xD1, 0x5C, 0x8F, 0x7A, 0x03, 0x61, 0x91, 0xB2, 0xE0, 0x33, 0x9E, 0x73, 0x8D, 0xC9,
-    0x63, 0x32, 0xF1, 0xFD, 0x79, 0xAF, 0x37, 0xCC, 0x98, 0x0B, 0x0A, 0xC6, 0x0A, 0x6E, 0x64, 0x4D,
-    0x6A, 0x7D, 0xDE, 0xCF, 0x61, 0x18, 0x93, 0x51, 0xA6, 0x24, 0x93, 0x9F, 0x64, 0xC3, 0xF8, 0xC2,
-    0x75, 0x44, 0xD3, 0x6B, 0x87, 0xEE, 0x47, 0xB5, 0x2C, 0x12, 0x02, 0x15, 0x36, 0xBE, 0xE3, 0xE8,
-    0x58, 0xD0, 0xFE, 0x58, 0x96, 0xE3, 0x37, 0x2B, 0x0F, 0x46, 0x87, 0x2D, 0xCF, 0xBD, 0x0C, 0x09,
-    0x7D, 0x6D, 0x62, 0x6C, 0xBC, 0x0B, 0x86, 0xF9, 0xDC, 0x3F, 0x64, 0x3D, 0x23, 0xE0, 0xA1, 0x3C,
-    0x85, 0x3F, 0x83, 0xE7, 0xFB, 0x79, 0x68, 0x06, 0x1F, 0x60, 0x11, 0x70, 0x49, 0x2B, 0x40, 0x71,
-    0x9B, 0x96, 0x47, 0xC1, 0x21, 0x29, 0x24, 0xDC, 0x36, 0x4E, 0x16, 0xDB, 0x2B, 0xEF, 0x4E, 0xC6,
-    0xB5, 0x24, 0x15, 0xE9, 0x5C, 0x36, 0xCF, 0x4C, 0xD2, 0x11, 0x66, 0x42, 0x49, 0x38, 0x99, 0x3F,
-    0xF0, 0x0B, 0xE2, 0x33, 0x3C, 0x32, 0x1F, 0xF0, 0x22, 0xB3, 0xC7, 0x13, 0x13, 0x1B, 0xC1, 0x8E,
-    0x02, 0x48, 0x60, 0x4B, 0x22, 0x0D, 0x63, 0xA2, 0x23, 0x61, 0x4D, 0xA6, 0x0A, 0x73, 0x32, 0xAF,
-    0xC1, 0x4B, 0x46, 0xB9, 0x0C, 0x77, 0x91, 0xF3, 0xC9, 0x07, 0x93, 0xA2, 0xC6, 0x46, 0xE2, 0x81,
-    0xB8, 0x00, 0x56, 0x6E, 0xA1, 0xE6, 0x8D, 0xAC, 0xF3, 0x03, 0x6D, 0x1E, 0xD9, 0x4B, 0xE9, 0xD5,
-    0x3A, 0xBE, 0xD5, 0x4E, 0x69, 0xAF, 0x45, 0x19, 0x82, 0x28, 0x6A, 0x1F, 0x86, 0xC6, 0x5B, 0xEB,
-    0x3D, 0x58, 0xB7, 0xBE, 0x4B, 0xDC, 0x0C, 0x4D, 0xDF, 0xB1, 0xE2, 0x94, 0x2B, 0x6F, 0xCA, 0xC8,
-    0x5A, 0x31, 0x0F, 0xEC, 0x81, 0x8D, 0xEF, 0x9F, 0x6A, 0xA1, 0x26, 0x84, 0x6D, 0xA0, 0xC3, 0xA1,
-    0xC9, 0x4E, 0xAE, 0x23, 0x3F, 0xB9, 0xE2, 0x94, 0x1B, 0xFD, 0x57, 0xBE, 0xA0, 0x1A, 0x0C, 0xB6,
-    0xAA, 0x8E, 0x5C, 0x0C, 0x61, 0x12, 0xF6, 0x4F, 0xB0, 0x64, 0x1A, 0x1E, 0x97, 0xD5, 0xDC, 0xF6,
-    0xBB, 0x70, 0x1C, 0x50, 0x37, 0x1B, 0x08, 0xDC, 0x06, 0xF6, 0x25, 0xA8, 0x7E, 0xB3, 0xC9, 0xBC,
-    0x52, 0x80, 0x18, 0x04, 0x43, 0x5C, 0x45, 0x5D, 0x80, 0x7D, 0x6B, 0x43, 0xC0, 0xA8, 0x09, 0x37,
-    0x5A, 0x94, 0xF7, 0xBB, 0x0E, 0xFA, 0xE7, 0x0E, 0xC8, 0x27, 0x6E, 0x7A, 0x55, 0x25, 0x0D, 0xA7,
-    0xA8, 0xFC, 0x45, 0x66, 0x55, 0xA5, 0x4F, 0x49, 0x3D, 0x07, 0x0E, 0x6C, 0xCA, 0x39, 0x06, 0xE0,
-    0xAC, 0x94, 0x1F, 0x79, 0x82, 0x3D, 0xA3, 0x68, 0x53, 0x6F, 0x4A, 0x56, 0x26, 0xC2, 0x12, 0x52,
-    0x4C, 0xD4, 0x54, 0xC1, 0x8A, 0xFB, 0x5E, 0xD4, 0x04, 0x22, 0xB9, 0xB8, 0x34, 0x16, 0x31, 0x6A,
-    0x0A, 0x1B, 0xF6, 0xC0, 0x64, 0x31, 0x8B, 0x18, 0x5C, 0x07, 0xC7, 0xAD, 0x03, 0x06, 0xBD, 0x74,
-    0x14, 0x32, 0xF8, 0x11, 0xEA, 0xFC, 0x35, 0x46, 0xFA, 0xEB, 0x3A, 0x6B, 0x3D, 0x93, 0x18, 0xEE,
-    0x3C, 0x41, 0x6C, 0x7F, 0xF1, 0x54, 0x16, 0x8B, 0xAD, 0x64, 0x7E, 0x54, 0xAE, 0xD2, 0x6E, 0x2C,
-    0x57, 0x29, 0x38, 0x3E, 0x2D, 0x4F, 0x3F, 0x22, 0x57, 0x41, 0x07, 0x61, 0xCF, 0x6B, 0x96, 0x56,
-    0xD0, 0x0D, 0x1D, 0x4D, 0xCE, 0x4F, 0xC5, 0xEA, 0xB6, 0x70, 0x69, 0x19, 0x4B, 0x03, 0x34, 0x84,
-    0x0C, 0x35, 0x02, 0xCE, 0x25, 0xD1, 0x5D, 0x41, 0x0F, 0xB8, 0x16, 0xB3, 0x35, 0xA5, 0x9F, 0xB6,
-    0x94, 0xDC, 0xED, 0x81, 0x4D, 0x0C, 0x32, 0xB0, 0x6A, 0x9E, 0x87, 0x9E, 0xC0, 0x84, 0x4C, 0x95,
-    0x8E, 0x25, 0x12, 0xF7, 0x48, 0xF1, 0xF0, 0x06, 0x17, 0x3F, 0x04, 0x24, 0x45, 0x8D, 0xA1, 0x2E,
-    0x04, 0xC7, 0xF3, 0x47, 0xE3, 0x85, 0xE8, 0x71, 0x3A, 0xAA, 0xCB, 0x41, 0x7D, 0xEE, 0x22, 0x70,
-    0x3F, 0x20, 0xC8, 0x25, 0xB2, 0x42, 0xDD, 0xEB, 0xB4, 0x1D, 0x32, 0x9A, 0xD9, 0x25, 0x8D, 0x1C,
-    0xED, 0x86, 0xE3, 0x7F, 0x56, 0xB1, 0xF0, 0x98, 0xB0, 0xBE, 0x38, 0x06, 0xE8, 0xAF, 0x81, 0x2E,
-    0x5A, 0x43, 0x3D, 0x1C, 0x2F, 0xEB, 0xD9, 0x7A, 0x01, 0x8E, 0x8F, 0x81, 0xFD, 0x74, 0xE8, 0x0A,
-    0x4D, 0xD0, 0xC5, 0xB9, 0x79, 0x9E, 0x4B, 0x38, 0xB6, 0x45, 0x35, 0x69, 0x9A, 0x2A, 0x59, 0x83,
-    0xE3, 0x45, 0xFA, 0x0F, 0x78, 0x08, 0x1B, 0x8B, 0x70, 0x43, 0x47, 0x31, 0x71, 0x93, 0xA8, 0x71,
-    0xE8, 0x73, 0x94, 0x22, 0xE4, 0xA1, 0xB6, 0xD2, 0xEB, 0x68, 0x19, 0xAC, 0x43, 0x27, 0xF5, 0x29,
-    0xC4, 0x60, 0x69, 0x50, 0x27, 0xB6, 0x0F, 0x06, 0x80, 0x78, 0xA9, 0xAB, 0x42, 0x98, 0x13, 0x54,
-    0x81, 0x0F, 0x9A, 0x86, 0xED, 0xAE, 0xF0, 0xD4, 0xD8, 0xCF, 0xCA, 0x67, 0xE9, 0x91, 0xBA, 0xD2,
-    0x42, 0xBE, 0xC2, 0x14, 0xB3, 0x10, 0x43, 0x53, 0xA5, 0xF9, 0xF1, 0x5D, 0x85, 0xD5, 0x22, 0xC4,
-    0x03, 0xDC, 0x2C, 0x80, 0x0A, 0x77, 0x4F, 0x7D, 0x3C, 0x0C, 0x54, 0xC2, 0x45, 0x23, 0xED, 0x90,
-    0x88, 0x07, 0x5D, 0xB2, 0x0C, 0x96, 0x49, 0x93, 0xD6, 0xD2, 0x0F, 0xD1, 0x10, 0x8A, 0x92, 0xDD,
-    0x3E, 0x18, 0x77, 0x70, 0xC4, 0xC7, 0xD9, 0x6B, 0xD0, 0x48, 0xD4, 0x44, 0xC6, 0xF9, 0xC3, 0xF5,
-    0xC4, 0x23, 0xEB, 0x86, 0x92, 0x61, 0x7E, 0x18, 0xEC, 0x01, 0x70, 0x25, 0xAD, 0x96, 0x2D, 0x8E,
-    0xD0, 0x4B, 0x65, 0x55, 0xDC, 0x82, 0xD6, 0x6E, 0x40, 0xC1, 0xE0, 0x41, 0x48, 0x7F, 0xA9, 0xE8,
-    0x42, 0x38, 0xDB, 0xEB, 0x50, 0x43, 0x9B, 0xC5, 0x4E, 0x18, 0x77, 0xAB, 0x1C, 0x8A, 0x3E, 0xE6,
-    0x52, 0xFA, 0xFB, 0x44, 0xB4, 0x15, 0x20, 0x0D, 0xB2, 0x8C, 0x5B, 0xE8, 0x15, 0xB0, 0x2A, 0x07,
-    0xC0, 0xB9, 0x41, 0xA7, 0xC1, 0x79, 0x01, 0xFC, 0x0E, 0x2F, 0x6E, 0x5A, 0xDC, 0x92, 0x0B, 0x93,
-    0x2A, 0xF1, 0x25, 0x0E, 0xC9, 0x2A, 0xE7, 0x1C, 0xE0, 0x64, 0x38, 0x44, 0x9B, 0x80, 0x22, 0x29,
-    0x2D, 0xA0, 0x17, 0xDB, 0x50, 0x99, 0x68, 0xA0, 0x29, 0x91, 0xCE, 0x0A, 0xA4, 0x09, 0x31, 0xD8,
-    0xA0, 0xD0, 0x60, 0x0F, 0xD0, 0x0F, 0x88, 0xB6, 0xCF, 0x2C, 0x66, 0xA3, 0x85, 0x74, 0xF5, 0xDF,
-    0xDE, 0xED, 0x48, 0x9F, 0x43, 0x4A, 0x14, 0xB3, 0x08, 0x85, 0xD9, 0x04, 0x6A, 0x28, 0x2E, 0xB5,
-    0x90, 0xA6, 0xE8, 0x38, 0xD2, 0xD5, 0x36, 0x51, 0x2E, 0x20, 0x46, 0x93, 0x13, 0x8E, 0xE2, 0x79,
-    0xE1, 0xB9, 0xF3, 0xBA, 0x77, 0x98, 0xF4, 0x65, 0x9E, 0x45, 0x1B, 0x56, 0xFC, 0x0E, 0x2D, 0xA6,
-    0xC9, 0x0B, 0xE9, 0x31, 0xB1, 0x3A, 0x85, 0x98, 0x23, 0x89, 0xB0, 0x5A, 0xAB, 0x07, 0x68, 0xA9,
-    0x93, 0x5B, 0xF9, 0x48, 0xC9, 0x58, 0x7A, 0xB0, 0xA1, 0x93, 0xDE, 0xDE, 0xB1, 0x25, 0x11, 0x79,
-    0xD8, 0x91, 0xEB, 0x0D, 0x7A, 0xA5, 0x72, 0xC7, 0x96, 0x50, 0xA1, 0x12, 0x5E, 0x46, 0x79, 0x2A,
-    0x0F, 0xED, 0xF1, 0x14, 0x18, 0xDF, 0x7E, 0x25, 0xE2, 0x1B, 0x16, 0xBA, 0x33, 0x6D, 0x79, 0x15,
-    0xC0, 0x29, 0xCA, 0xE2, 0x85, 0x56, 0x4E, 0x6F, 0x0C, 0xBA, 0xE7, 0x1A, 0x80, 0x45, 0xD9, 0xAB,
-    0x0C, 0x83, 0x51, 0xD6, 0x6C, 0xBA, 0x3E, 0x62, 0xFF, 0xC8, 0x41, 0x4A, 0x3E, 0x6F, 0x69, 0x45,
-    0x53, 0x30, 0xCA, 0x98, 0x1D, 0x59, 0x41, 0x8B, 0x26, 0xA8, 0x3A, 0x72, 0x84, 0xC2, 0x4F, 0x2A,
-    0x42, 0x4B, 0x2A, 0x01, 0xDF, 0xA9, 0xB1, 0xE2, 0xB9, 0x97, 0x6E, 0x13, 0xDF, 0x03, 0xAC, 0x50,
-    0x93, 0xB9, 0x29, 0x56, 0xF9, 0x8C, 0x04, 0xA5, 0x34, 0x69, 0x9D, 0x56, 0xC5, 0x55, 0xE1, 0xBA,
-    0x55, 0x07, 0xBA, 0x44, 0x9A, 0xF0, 0x5F, 0x48, 0xAE, 0x00, 0x2F, 0xBA, 0x09, 0x30, 0xC4, 0xEF,
-    0x22, 0x44, 0x42, 0x87, 0xFD, 0xE9, 0x4D, 0xC5, 0x42, 0xA7, 0x6E, 0x87, 0x8C, 0xD8, 0x76, 0x59,
-    0xFB, 0x33, 0x61, 0xE2, 0x72, 0x52, 0x4E, 0xE3, 0xDB, 0xE4, 0xC0, 0x6E, 0xA5, 0x45, 0x42, 0x94,
-    0x51, 0xED, 0x55, 0x8B, 0x93, 0x77, 0x06, 0xBD, 0x35, 0xD6, 0x15, 0x60, 0x5A, 0x5A, 0x3C, 0x34,
-    0x75, 0x23, 0x80, 0xC2, 0x41, 0x94, 0x0B, 0x36, 0x23, 0xEE, 0xD2, 0xEB, 0x2E, 0xBE, 0xD3, 0xC7,
-    0xCE, 0x70, 0x0F, 0xE1, 0xA1, 0x1E, 0xCC, 0x09, 0xDA, 0x0C, 0xED, 0x4B, 0x1F, 0x2C, 0x8B, 0xE4,
-    0xCB, 0x1E, 0x92, 0xB9, 0x00, 0x12, 0x25, 0x2C, 0xF5, 0xA7, 0x80, 0x3B, 0x35, 0x12, 0x31, 0xDE,
-    0x55, 0xD4, 0xBA, 0xA8, 0xF6, 0x56, 0xFE, 0x7F, 0x23, 0x4F, 0x1D, 0x46, 0xEE, 0x58, 0x00, 0x8F,
-    0xC6, 0x93, 0xB3, 0xE4, 0x3E, 0xC8, 0x04, 0x45, 0xC0, 0xA5, 0x35, 0x4A, 0x6E, 0xFA, 0x51, 0x9B,
-    0x7E, 0x8D, 0x02, 0x06, 0x2A, 0xD3, 0x5F, 0x8A, 0x4A, 0x45, 0xBE, 0xE5, 0xC5, 0xBF, 0x5A, 0x11,
-    0xC5, 0x66, 0x4A, 0x69, 0x39, 0xC2, 0x40, 0x78, 0x66, 0xC0, 0xD7, 0x17, 0xE4, 0x90, 0x06, 0x5C,
-    0x20, 0x47, 0x33, 0xD8, 0xCB, 0xB4, 0x1A, 0xCF, 0x3C, 0x75, 0x5E, 0x78, 0x1E, 0x2A, 0x24, 0x67,
-    0xB3, 0x72, 0x14, 0xB1, 0x07, 0x4B, 0x04, 0x1B, 0x4F, 0x4A, 0xD5, 0x93, 0x9C, 0x54, 0xD2, 0x4E,
-    0x21, 0x9B, 0x12, 0xE9, 0xE0, 0xE5, 0x44, 0xA1, 0xF5, 0x2A, 0x1C, 0xF6, 0xE1, 0xCA, 0x25, 0x37,
-    0xBB, 0xD3, 0x3E, 0xD8, 0xFF, 0xDB, 0x63, 0xC9, 0x9B, 0x95, 0x5B, 0x51, 0x57, 0x6B, 0xAF, 0x20,
-    0x0F, 0x96, 0x42, 0x15, 0x25, 0x36, 0xD2, 0xC8, 0xED, 0x68, 0x96, 0x6A, 0x3C, 0x30, 0x12, 0x48,
-    0x89, 0xFB, 0x8B, 0x89, 0x3B, 0x1F, 0x0F, 0xC1, 0x85, 0xC6, 0x6B, 0xD1, 0x98, 0xBD, 0x78, 0x0C,
-    0x6E, 0x22, 0x66, 0xD2, 0xEF, 0x7F, 0x26, 0x32, 0xBE, 0xE4, 0xB5, 0x21, 0x76, 0x0A, 0xE5, 0x36,
-    0xAB, 0x80, 0xD6, 0x13, 0x5D, 0x04, 0x55, 0x27, 0x55, 0x01, 0xE5, 0x73, 0x0D, 0xEC, 0x0F, 0xB4,
-    0x9B, 0x09, 0x61, 0x71, 0x7D, 0x94, 0x8A, 0x8D, 0x3A, 0xFA, 0x8A, 0x37, 0x7B, 0xE4, 0x3D, 0x6F,
-    0x82, 0xA4, 0xC0, 0x46, 0x03, 0x77, 0xF1, 0x90, 0x36, 0x19, 0xD4, 0x26, 0xF2, 0x18, 0xF1, 0x6A,
-    0x25, 0x4E, 0x45, 0x6E, 0xE4, 0x84, 0x4B, 0x82, 0x26, 0xE1, 0xEA, 0x03, 0x17, 0x37, 0xC9, 0x48,
-    0x4E, 0x20, 0x5C, 0xAF, 0x93, 0x73, 0x9A, 0x0C, 0x89, 0x1E, 0x6D, 0x30, 0x9D, 0xC4, 0x69, 0xA4,
-    0x0F, 0xE4, 0xD0, 0x00, 0x45, 0x5B, 0xD8, 0xF4, 0x46, 0x93, 0x7C, 0x03, 0x1B, 0x26, 0xEC, 0xA1,
-    0x1D, 0x42, 0xE9, 0x07, 0xB7, 0x71, 0xEE, 0x77, 0xC0, 0xB6, 0x23, 0x23, 0xDB, 0xC1, 0x96, 0xEF,
-    0xC8, 0x48, 0xF6, 0x6C, 0x25, 0x27, 0xB6, 0x1B, 0x9C, 0x3F, 0x33, 0xF6, 0x1F, 0x30, 0x11, 0x8D,
-    0xBD, 0x4E, 0xD6, 0xB0, 0x94, 0xC0, 0x22, 0xD7, 0x6F, 0x41, 0x3F, 0xB3, 0xE8, 0x3D, 0x61, 0x3A,
-    0x4E, 0x9A, 0xAC, 0x42, 0x0B, 0x1B, 0xFA, 0x76, 0xF4, 0x21, 0x64, 0x67, 0xB7, 0x41, 0xF6, 0x09,
-    0x44, 0x16, 0x3C, 0xC8, 0x0E, 0x36, 0x40, 0x8C, 0x9F, 0xB6, 0xD1, 0x03, 0x47, 0x3D, 0x4C, 0x14,
-    0x36, 0xFB, 0xB8, 0x51, 0x5F, 0xA3, 0x88, 0xC2, 0x42, 0xC2, 0xFE, 0x90, 0xCB, 0x13, 0x9C, 0x2F,
-    0x00, 0x72, 0x06, 0x70, 0xE9, 0x5B, 0x07, 0xB1, 0x17, 0x44, 0x41, 0xA9, 0xF1, 0x0A, 0x42, 0xBE,
-    0x6B, 0x52, 0x77, 0xE6, 0x3D, 0x39, 0x4C, 0x87, 0xFD, 0x44, 0x94, 0x96, 0xEA, 0xD3, 0x4F, 0xF8,
-    0x96, 0x3B, 0xDD, 0xEB, 0x1B, 0x27, 0xAF, 0xE3, 0x0F, 0xED, 0xF4, 0x15, 0x4E, 0xDA, 0x74, 0x83,
-    0xA5, 0x26, 0x6A, 0x54, 0x3D, 0xFB, 0x30, 0xEC, 0xBE, 0x62, 0x56, 0x9E, 0xFA, 0x02, 0xBF, 0x9D,
-    0x7B, 0x17, 0xF7, 0x9E, 0x1F, 0xA8, 0x4F, 0xAB, 0xF4, 0xB2, 0xD4, 0x61, 0x2B, 0x27, 0x7F, 0x1D,
-    0xEA, 0xF2, 0xF3, 0x48, 0x9A, 0x42, 0x56, 0x9B, 0xD6, 0x26, 0x1A, 0x12, 0xF1, 0xD7, 0x83, 0xD7,
-    0x67, 0xED, 0xF6, 0x5A, 0xE3, 0x5B, 0xB7, 0xDC, 0x77, 0xE1, 0x3F, 0xC4, 0xD2, 0x54, 0x6B, 0xB6,
-    0x1A, 0xB6, 0x9D, 0x59, 0x42, 0x9B, 0x16, 0x7F, 0x23, 0x55, 0x22, 0x9F, 0xAA, 0xC4, 0x45, 0x7A,
-    0x07, 0xE9, 0x70, 0x0D, 0xD8, 0x4D, 0x6D, 0x76, 0xC5, 0x1F, 0x68, 0xEA, 0xB3, 0x9D, 0x6C, 0xA9,
-    0x89, 0x41, 0x07, 0x26, 0x18, 0x12, 0xC8, 0x74, 0xD0, 0x91, 0xD0, 0x7F, 0xDA, 0xBA, 0x6F, 0x47,
-    0x49, 0x30, 0xEE, 0xCF, 0xCD, 0xC6, 0x2D, 0x42, 0xD2, 0xEE, 0x5D, 0x4C, 0x1A, 0x28, 0x1D, 0x18,
-    0xA2, 0x02, 0xC2, 0x40, 0x55, 0xC8, 0x77, 0x48, 0x18, 0x1A, 0xD0, 0xE6, 0x65, 0xE7, 0x90, 0xE3,
-    0x5F, 0x81, 0x86, 0x37, 0x5A, 0xDF, 0xC9, 0xFB, 0xB3, 0x9B, 0xC8, 0x1F, 0x85, 0xE4, 0xA3, 0xDE,
-    0x90, 0x3E, 0x1B, 0x74, 0x1D, 0xCA, 0x29, 0x89, 0x99, 0xCE, 0x3C, 0x1E, 0x76, 0xDF, 0xDD, 0xF8,
-    0xDF, 0x20, 0x85, 0xF8, 0x5D, 0x21, 0xB5, 0x26, 0x52, 0x0A, 0x32, 0xF9, 0xAD, 0x2E, 0xE9, 0xA4,
-    0x0F, 0xC4, 0x36, 0xCB, 0x39, 0x1F, 0x48, 0x14, 0xA9, 0x6E, 0x08, 0x9A, 0x06, 0xE3, 0xB2, 0xBB,
-    0x06, 0xAB, 0x33, 0x76, 0x9B, 0x34, 0xDA, 0x6C, 0xE9, 0xBD, 0xEA, 0xD8, 0x73, 0x06, 0x4D, 0xBA,
-    0x2C, 0x4C, 0xCE, 0x88, 0x76, 0xEF, 0x1E, 0x17, 0xF2, 0x2A, 0x3D, 0x5D, 0x66, 0x36, 0xAD, 0x25,
-    0x06, 0x81, 0xA8, 0x44, 0xFD, 0x2C, 0x58, 0xAB, 0x02, 0xF0, 0x3B, 0x3C, 0x84, 0xF0, 0x51, 0xF6,
-    0x3E, 0x20, 0xB7, 0x26, 0xC7, 0x2A, 0x62, 0x17, 0x06, 0x95, 0xB0, 0x8E, 0xE8, 0xDE, 0x61, 0x6A,
-    0xC7, 0x4C, 0x09, 0xF0, 0x43, 0xD1, 0xC9, 0x71, 0x80, 0x1C, 0xD4, 0xD0, 0xBF, 0x01, 0xBD, 0x5A,
-    0x31, 0xAC, 0xDE, 0xD6, 0x75, 0x3E, 0x24, 0x2B, 0x11, 0x15, 0x87, 0xDB, 0x21, 0x1E, 0x62, 0xA3,
-    0xE5, 0xD2, 0x21, 0x4D, 0xE1, 0x70, 0xED, 0xE0, 0x8A, 0x94, 0x0B, 0x34, 0x40, 0x3D, 0x58, 0x83,
-    0xD5, 0x8E, 0x5A, 0x34, 0x18, 0x41, 0x81, 0xB7, 0x74, 0xC8, 0x60, 0x8B, 0x54, 0x8C, 0xA0, 0x43,
-    0x87, 0x68, 0x49, 0xD6, 0x6A, 0x70, 0x00, 0xF5, 0x75, 0x50, 0x87, 0x0E, 0x19, 0xF4, 0x74, 0xA9,
-    0xAA, 0xA8, 0x06, 0x0D, 0xA1, 0xA2, 0x16, 0x19, 0x3C, 0x88, 0x51, 0x05, 0xA4, 0xA9, 0x11, 0x98,
-    0xB2, 0xA9, 0x94, 0xD2, 0x23, 0x79, 0xFB, 0x7D, 0xE7, 0x92, 0xFF, 0xFF, 0x3F, 0x5B, 0x75, 0x92,
-    0x07, 0xBD, 0x3E, 0xBD, 0xFF, 0xD7, 0xFB, 0xF9, 0x5F, 0x9E, 0x7B, 0xEE, 0xB9, 0xE7, 0x7C, 0xE7,
-    0x3B, 0xE7, 0x52, 0xE4, 0xEB, 0xFB, 0x85, 0x18, 0xD7, 0x48, 0xE4, 0x7A, 0xD1, 0x9F, 0x14, 0xFF,
-    0x9B, 0x59, 0x24, 0x76, 0x95, 0x44, 0x87, 0xAD, 0x04, 0xD3, 0x28, 0x32, 0x95, 0x22, 0xA5, 0xA9,
-    0x25, 0xFF, 0xA0, 0x93, 0xAC, 0x1E, 0xC5, 0xB4, 0x79, 0x91, 0x3C, 0xBB, 0xD8, 0x44, 0xCE, 0x0D,
-    0xA1, 0x73, 0xB3, 0x38, 0xE7, 0x6A, 0x2B, 0x49, 0x97, 0x57, 0xE1, 0x98, 0xD5, 0x62, 0x4D, 0x2B,
-    0x69, 0x0D, 0xE1, 0x92, 0xB8, 0x4E, 0xEC, 0xAC, 0x92, 0x2F, 0xFF, 0xF9, 0xD5, 0x7C, 0x1A, 0x8D,
-    0x73, 0xB7, 0xDD, 0xDB, 0x63, 0x5E, 0x97, 0x7F, 0x3B, 0xC4, 0xBD, 0x2D, 0x4A, 0xD3, 0x25, 0x9D,
-    0x93, 0xD9, 0x74, 0x69, 0xEB, 0xA2, 0x29, 0x81, 0xA0, 0x7C, 0x1E, 0x03, 0x77, 0xB1, 0x92, 0xCD,
-    0x4F, 0x52, 0xBF, 0x87, 0xF9, 0x2D, 0x14, 0x82, 0x34, 0x49, 0x1E, 0xCB, 0x56, 0xD5, 0x08, 0x6A,
-    0x4A, 0x39, 0x40, 0xE7, 0x4F, 0x2A, 0xAF, 0x6B, 0x7E, 0xB1, 0x96, 0xB8, 0xC3, 0x1F, 0x33, 0x14,
-    0xA6, 0xB2, 0xD1, 0x60, 0x1A, 0xB1, 0xDF, 0x9F, 0xB0, 0x4E, 0xD7, 0xAA, 0xB6, 0xB9, 0x73, 0x98,
-    0x54, 0xAC, 0xCC, 0x50, 0x99, 0xEA, 0x46, 0x03, 0x6E, 0xA1, 0x48, 0x53, 0xDD, 0x14, 0x6B, 0x8B,
-    0xC8, 0xB5, 0xEB, 0x34, 0xC7, 0xD3, 0xFA, 0x65, 0x5A, 0x51, 0xD2, 0xC2, 0xBF, 0x70, 0xAB, 0x44,
-    0xDC, 0x26, 0xAE, 0x39, 0x6D, 0xE5, 0x78, 0xFA, 0x45, 0x8D, 0x08, 0x84, 0xE4, 0x90, 0xF5, 0x14,
-    0xFF, 0x41, 0xCC, 0x2C, 0x3B, 0xA6, 0x1E, 0xBC, 0xE8, 0x1C, 0xF3, 0x1D, 0xF8, 0x4B, 0x31, 0x8C,
-    0x51, 0x3A, 0xDC, 0xEC, 0x86, 0xC8, 0x9D, 0xFB, 0x27, 0xC3, 0x11, 0x30, 0x56, 0x06, 0x39, 0x39,
-    0x34, 0xCA, 0xB9, 0x01, 0x18, 0x6D, 0x97, 0x17, 0xFF, 0x2E, 0x79, 0xBD, 0x3D, 0x2D, 0xA9, 0x73,
-    0xF0, 0x00, 0x27, 0x81, 0x9B, 0x36, 0x33, 0x84, 0xB3, 0xC4, 0x83, 0x60, 0x4B, 0xB2, 0x82, 0x1F,
-    0xF7, 0x1E, 0x87, 0x0E, 0xEA, 0x0F, 0x59, 0xFF, 0x87, 0x90, 0x56, 0x56, 0xD8, 0x15, 0x71, 0xEB,
-    0xAF, 0x2D, 0x8A, 0xD2, 0x35, 0xB9, 0x6B, 0x12, 0xB7, 0x75, 0x07, 0x57, 0x0B, 0xF7, 0xC7, 0x3C,
-    0xE8, 0x25, 0x93, 0xE1, 0x24, 0x54, 0xCC, 0x3B, 0x81, 0xA0, 0x61, 0x4A, 0x9A, 0x6F, 0x1C, 0x4F,
-    0x45, 0x18, 0x97, 0xE3, 0x74, 0xB2, 0x3F, 0x3A, 0x11, 0x2B, 0xC2, 0x17, 0xB0, 0x4D, 0xB8, 0xFB,
-    0xCC, 0xF1, 0xAC, 0x68, 0xEA, 0x03, 0x89, 0x3E, 0xEB, 0x25, 0x44, 0xEC, 0x8B, 0x2B, 0x4E, 0x42,
-    0xC5, 0x31, 0x69, 0xCC, 0x8F, 0x1B, 0x4E, 0x90, 0x37, 0xFC, 0x7C, 0x7A, 0x2E, 0x80, 0x06, 0x50,
-    0x32, 0x99, 0x7E, 0x37, 0x1A, 0x25, 0x80, 0xDB, 0x59, 0x95, 0x6C, 0x3A, 0xC1, 0x67, 0xAA, 0x99,
-    0xBA, 0x3E, 0x82, 0x84, 0x6C, 0xD7, 0x23, 0x47, 0xB8, 0x4A, 0xFA, 0xF7, 0xDC, 0x73, 0x48, 0x29,
-    0x1B, 0xEF, 0xA5, 0xD0, 0x14, 0x51, 0x53, 0x21, 0x62, 0x46, 0x29, 0x7F, 0xE0, 0x8A, 0xB4, 0x49,
-    0xE1, 0xF0, 0xD1, 0x08, 0x39, 0x8C, 0xEA, 0xAC, 0x2E, 0x0B, 0x83, 0xC8, 0x8E, 0x46, 0xC8, 0x76,
-    0xBC, 0x58, 0x20, 0xEA, 0x71, 0x31, 0x6F, 0xB3, 0xFB, 0x16, 0x3A, 0xB8, 0x0E, 0xB7, 0xB7, 0xE2,
-    0x66, 0xAE, 0x3C, 0xEA, 0x19, 0xA9, 0x84, 0x8C, 0xE4, 0x53, 0xC6, 0xED, 0x67, 0x98, 0x04, 0xA1,
-    0x27, 0x97, 0x0D, 0x71, 0xF1, 0x61, 0x4D, 0xE0, 0x80, 0xB9, 0x3B, 0xBC, 0x41, 0x46, 0x05, 0xF3,
-    0x62, 0xE9, 0x56, 0x4A, 0x1A, 0x57, 0xED, 0x8C, 0xDB, 0x5D, 0x80, 0x85, 0x23, 0xD2, 0xB0, 0x0C,
-    0x47, 0x10, 0x9A, 0x47, 0x82, 0xC0, 0xB0, 0x2E, 0x82, 0x10, 0x98, 0xBB, 0x41, 0x25, 0xC5, 0xCF,
-    0xF6, 0xFA, 0x60, 0x0A, 0x78, 0x6F, 0x5E, 0xE7, 0x75, 0xD2, 0x5D, 0x7C, 0x1A, 0x8E, 0xD8, 0x1D,
-    0x97, 0xBA, 0x2E, 0xFF, 0x37, 0x77, 0xDD, 0x74, 0xB8, 0xD8, 0x9B, 0x36, 0x1A, 0xE3, 0x3E, 0x9A,
-    0xC3, 0xE9, 0x35, 0x47, 0x60, 0xC0, 0xED, 0x33, 0x6E, 0x57, 0x50, 0x22, 0x08, 0xC4, 0x3D, 0xF6,
-    0xCB, 0xE1, 0x35, 0xCB, 0xA9, 0x8B, 0xB8, 0x6A, 0x1A, 0x44, 0x77, 0x8D, 0x4B, 0x35, 0xE6, 0xA8,
-    0xF2, 0xD6, 0x56, 0x39, 0xD4, 0x04, 0x12, 0xA8, 0xA6, 0xD4, 0xD1, 0xC9, 0xA4, 0x1A, 0x52, 0x41,
-    0xEA, 0xB7, 0x51, 0xEF, 0xF4, 0xFE, 0x35, 0x48, 0x87, 0x31, 0xFD, 0xDE, 0x59, 0x6E, 0x82, 0x8A,
-    0x91, 0xF2, 0xFB, 0xE7, 0xB9, 0x2E, 0x60, 0xA5, 0x7A, 0x80, 0x73, 0x0D, 0xE7, 0xCC, 0x20, 0xC0,
-    0x5D, 0x38, 0xCF, 0x3D, 0xA3, 0x99, 0x60, 0x8C, 0x10, 0x83, 0x8C, 0xEA, 0x88, 0x6F, 0x88, 0xD1,
-    0xDF, 0xDA, 0xC7, 0x28, 0x88, 0x50, 0x90, 0xCA, 0x1E, 0x43, 0x66, 0x61, 0x5D, 0x57, 0x5E, 0x99,
-    0x60, 0xC0, 0xB4, 0x29, 0xEF, 0x39, 0xF7, 0x00, 0x5A, 0xBA, 0x1F, 0x52, 0x6C, 0xD2, 0x05, 0x81,
-    0xFB, 0x47, 0xF8, 0x67, 0x1F, 0xBA, 0x8D, 0xC1, 0xE4, 0x0D, 0xE0, 0xD4, 0x6C, 0xE1, 0x9F, 0xBD,
-    0x04, 0xB7, 0x96, 0x4D, 0x77, 0xC5, 0x32, 0x41, 0xFC, 0xEC, 0x82, 0xA4, 0x8D, 0xFA, 0x8F, 0x6A,
-    0x01, 0xCD, 0x4B, 0xD7, 0x85, 0xD4, 0xFA, 0xE9, 0x05, 0x55, 0x75, 0x56, 0x0B, 0xA9, 0xEF, 0xFA,
-    0xCD, 0xD6, 0xF5, 0x78, 0xC1, 0xAD, 0xF9, 0xB8, 0x0B, 0x20, 0xF7, 0xB5, 0xD6, 0xE3, 0x11, 0xDC,
-    0xB2, 0x87, 0xF0, 0x78, 0x48, 0x1F, 0x8C, 0xF1, 0x93, 0x29, 0x1E, 0xAD, 0x9B, 0xB0, 0x59, 0xE6,
-    0xB9, 0x2E, 0xD1, 0xCA, 0xEF, 0xA5, 0xCF, 0x0F, 0x20, 0xA1, 0xC8, 0x76, 0x22, 0x3C, 0x60, 0xCA,
-    0x59, 0xCC, 0xF2, 0xEE, 0xCB, 0x54, 0x4F, 0x34, 0x12, 0x38, 0x28, 0xAC, 0x8E, 0xA7, 0xDE, 0xCB,
-    0xD8, 0xBF, 0xF7, 0xA1, 0x1F, 0x74, 0x3B, 0x0B, 0x71, 0xF8, 0x2A, 0x5A, 0xD4, 0xFD, 0xAD, 0x37,
-    0x33, 0xE8, 0xF9, 0xCB, 0x25, 0x21, 0x9F, 0x10, 0x4F, 0x96, 0xC0, 0x4E, 0xAB, 0x51, 0x92, 0x9F,
-    0x23, 0xEC, 0x11, 0x52, 0xC1, 0xB2, 0x6E, 0xA8, 0xAD, 0x73, 0xE3, 0x15, 0xCC, 0x17, 0x0A, 0xEA,
-    0x1D, 0x8E, 0xDE, 0x80, 0x5C, 0x5D, 0xBC, 0x20, 0x0C, 0x2D, 0x48, 0xC3, 0x53, 0x73, 0xDA, 0x58,
-    0xD1, 0x89, 0x1E, 0xBD, 0xBC, 0x3C, 0xB8, 0x4D, 0x72, 0xB9, 0x54, 0xE9, 0x69, 0xBF, 0x6A, 0x9D,
-    0x11, 0xFF, 0x5C, 0x30, 0xC7, 0x3D, 0xD4, 0x8E, 0xFB, 0xB4, 0x83, 0x19, 0x0D, 0x93, 0xEE, 0x0F,
-    0x55, 0x1E, 0xEC, 0x18, 0xCF, 0x37, 0xB0, 0x83, 0xFD, 0xCA, 0x57, 0xFC, 0x4F, 0x89, 0xE4, 0x8D,
-    0x6B, 0x84, 0x07, 0x53, 0xBD, 0xEF, 0xE3, 0x05, 0x2B, 0x03, 0x85, 0x80, 0xA6, 0x53, 0xE4, 0x8A,
-    0xBF, 0x4E, 0xC6, 0xA3, 0x38, 0x59, 0x56, 0x6E, 0x2C, 0x0B, 0x37, 0xDA, 0xC2, 0x0D, 0xB6, 0x88,
-    0xFB, 0xB2, 0x48, 0xBA, 0xB2, 0x46, 0x54, 0xB7, 0xA6, 0x05, 0x4E, 0x52, 0x0B, 0xC4, 0xEA, 0x5C,
-    0x6C, 0xB1, 0x1C, 0x02, 0x88, 0x0D, 0x0F, 0x3A, 0x19, 0x22, 0xEF, 0x93, 0xC3, 0xAB, 0x05, 0xB2,
-    0x3A, 0xD6, 0xDD, 0xA5, 0xBD, 0xAB, 0xA9, 0x35, 0xD2, 0x7A, 0xD6, 0xA4, 0x35, 0x50, 0x03, 0x28,
-    0x37, 0x30, 0xAF, 0xE7, 0xB7, 0xB9, 0x0F, 0xBA, 0x61, 0x81, 0x23, 0x38, 0xEB, 0x4E, 0x9F, 0x02,
-    0x26, 0x73, 0x83, 0x2D, 0xE0, 0xD2, 0xAE, 0xE1, 0x14, 0xD5, 0x67, 0x25, 0x7A, 0x3E, 0xEA, 0x4A,
-    0x64, 0xAF, 0x3A, 0x91, 0x55, 0xF4, 0x49, 0x1D, 0xCE, 0x93, 0x26, 0x91, 0xF0, 0x99, 0x9C, 0xC4,
-    0x2A, 0xE0, 0x36, 0x4B, 0x26, 0xC2, 0xEB, 0x8C, 0x9C, 0xC8, 0x2A, 0xA2, 0xE5, 0x66, 0x84, 0xAE,
-    0x7C, 0x78, 0x22, 0xAB, 0x78, 0x99, 0x1A, 0xBF, 0x52, 0xF8, 0xB4, 0x4C, 0xBE, 0x71, 0x73, 0xA3,
-    0x31, 0x7E, 0x06, 0xCF, 0x16, 0xCB, 0x85, 0x30, 0x9E, 0xC0, 0x5E, 0x44, 0x0C, 0x5B, 0xE2, 0x75,
-    0xFE, 0x77, 0x8D, 0x24, 0x4D, 0xB6, 0x04, 0x31, 0xF2, 0x90, 0xE9, 0x10, 0xBB, 0xCC, 0xC1, 0x29,
-    0x52, 0x18, 0xFE, 0xCC, 0xAB, 0xAC, 0x46, 0x26, 0x43, 0xA2, 0x2E, 0x48, 0xBC, 0x63, 0x26, 0x33,
-    0x8B, 0xEC, 0x6B, 0x9E, 0xFE, 0x25, 0x12, 0x12, 0xC6, 0x99, 0x65, 0x5C, 0x8D, 0x84, 0x3D, 0xF8,
-    0x71, 0x15, 0x92, 0xF9, 0x20, 0x1E, 0x19, 0xE2, 0x19, 0x7E, 0xDB, 0x49, 0x99, 0x56, 0x69, 0xF5,
-    0xDE, 0x32, 0x8B, 0x86, 0xEC, 0xAC, 0x08, 0x10, 0xC0, 0x80, 0xD9, 0xDD, 0x36, 0x3A, 0x04, 0xC5,
-    0x75, 0x73, 0x3C, 0x23, 0xB0, 0x6B, 0x67, 0x3A, 0xD3, 0x22, 0xDF, 0xC1, 0x64, 0xF7, 0x27, 0x72,
-    0xE9, 0xFC, 0x0E, 0x96, 0x98, 0x57, 0xF9, 0x9F, 0xF5, 0x71, 0xC7, 0x8C, 0xA8, 0x8A, 0x42, 0x7E,
-    0xDA, 0x9C, 0x71, 0xFB, 0xF6, 0xBF, 0x60, 0x58, 0x37, 0x66, 0x7C, 0x03, 0xE4, 0x94, 0x95, 0xEA,
-    0x10, 0x39, 0x4D, 0xAF, 0x1E, 0x76, 0x90, 0x7A, 0xA9, 0xAD, 0xE9, 0x42, 0xD2, 0x76, 0x7C, 0x9F,
-    0x36, 0x78, 0xA3, 0xBE, 0x50, 0x1B, 0xD0, 0x48, 0x85, 0xF1, 0xE6, 0x81, 0x84, 0xCA, 0x11, 0xF3,
-    0x01, 0xC2, 0xA7, 0xA7, 0x77, 0x30, 0x0A, 0x25, 0x08, 0x72, 0x83, 0x1D, 0x21, 0xAD, 0xB5, 0xCD,
-    0xCC, 0xE4, 0xFE, 0xA5, 0xCA, 0x65, 0xE7, 0xDA, 0xC4, 0x1D, 0x08, 0x56, 0xF4, 0xFB, 0xA7, 0x15,
-    0x0F, 0x8C, 0x72, 0x15, 0xFC, 0x57, 0xA9, 0xB4, 0x51, 0x77, 0x9D, 0x3B, 0x0B, 0xEC, 0x26, 0xB8,
-    0x3B, 0xC5, 0x43, 0x42, 0x26, 0xBE, 0x26, 0x6A, 0xC2, 0x93, 0x52, 0xF0, 0x6C, 0x82, 0x19, 0xC8,
-    0x5D, 0xDC, 0xBE, 0x91, 0xCE, 0xC3, 0x59, 0xDB, 0xFD, 0x49, 0xC2, 0xD8, 0x0F, 0xAE, 0x53, 0x04,
-    0x6B, 0x9E, 0x9E, 0x77, 0x1B, 0xFF, 0xDB, 0xD2, 0x98, 0x19, 0x29, 0x0E, 0x85, 0x03, 0xAF, 0xC9,
-    0xEF, 0x50, 0x1E, 0xA6, 0x4C, 0x1A, 0x5A, 0x1C, 0x69, 0xE5, 0x54, 0x51, 0x89, 0x85, 0xB7, 0xB5,
-    0xD4, 0x81, 0xB3, 0x6E, 0x3E, 0x43, 0x62, 0x38, 0xAE, 0x9F, 0x51, 0x96, 0x95, 0x4C, 0x4B, 0x20,
-    0xA9, 0xFB, 0x57, 0xDD, 0x94, 0x02, 0x8E, 0x39, 0x77, 0x4E, 0xAB, 0xD1, 0xAD, 0xA1, 0x36, 0x26,
-    0x9E, 0x31, 0x2F, 0xEE, 0xD1, 0xAB, 0x79, 0xB1, 0xA4, 0x99, 0x44, 0xEB, 0xB0, 0x8A, 0xF5, 0xDE,
-    0x52, 0x87, 0xE9, 0xF2, 0x5B, 0x7A, 0xDC, 0xB2, 0xBE, 0x68, 0xD0, 0xAC, 0xC2, 0x1B, 0x8E, 0xF8,
-    0x03, 0xBF, 0xF6, 0x46, 0x0A, 0x94, 0xCF, 0x32, 0x7D, 0x52, 0xC0, 0x7B, 0xD1, 0xED, 0xD9, 0x46,
-    0x4C, 0x2E, 0xFC, 0xF4, 0x2A, 0xE8, 0x0E, 0x45, 0xE0, 0x06, 0xCB, 0xB1, 0x86, 0xDB, 0x87, 0xA5,
-    0x70, 0x1B, 0x6B, 0x48, 0xC2, 0xC2, 0x98, 0x5D, 0x98, 0x1F, 0x66, 0x4E, 0xFA, 0x39, 0xC3, 0x78,
-    0x7A, 0x3D, 0x73, 0xF1, 0x98, 0x0F, 0xBF, 0x74, 0x89, 0x99, 0xB3, 0xC1, 0xDE, 0x48, 0x79, 0x31,
-    0xAC, 0x51, 0x49, 0x7A, 0x55, 0x4C, 0xBF, 0xC9, 0x9C, 0xE4, 0x0C, 0x58, 0xE5, 0x28, 0xAF, 0xF2,
-    0xC3, 0xB7, 0x8E, 0xAE, 0x1D, 0x6F, 0x15, 0x06, 0x5A, 0x7F, 0x15, 0x64, 0x0E, 0xCE, 0x56, 0x21,
-    0x19, 0xDC, 0x14, 0xF3, 0xEF, 0x62, 0x69, 0x9B, 0xB5, 0x7C, 0xEA, 0x59, 0x3E, 0x61, 0x68, 0x70,
-    0x75, 0x31, 0xCB, 0x31, 0x14, 0xBC, 0xCE, 0x88, 0x8F, 0xFB, 0xA4, 0x33, 0xFC, 0xD7, 0xA6, 0x0D,
-    0x9C, 0xB0, 0x86, 0x07, 0x16, 0xB8, 0xD3, 0xCD, 0x18, 0xED, 0x66, 0x8C, 0x67, 0x0D, 0x24, 0x99,
-    0xBA, 0x77, 0xBD, 0xBA, 0x77, 0x5E, 0x60, 0x97, 0xCB, 0x02, 0xB5, 0x87, 0xA5, 0x81, 0x18, 0xBE,
-    0x42, 0x6A, 0xAD, 0x71, 0xCE, 0xE0, 0x29, 0xC2, 0xD1, 0x5B, 0xD4, 0x71, 0x3E, 0xC7, 0x19, 0x67,
-    0x38, 0xE1, 0x39, 0x72, 0x4B, 0x3A, 0xAE, 0x10, 0xF0, 0xE8, 0x98, 0x9A, 0x29, 0xF0, 0x46, 0x24,
-    0x3B, 0xBF, 0x2C, 0xEE, 0x32, 0xD6, 0x0B, 0x68, 0x12, 0x07, 0x42, 0xF2, 0xAE, 0x47, 0xB3, 0xE0,
-    0x7A, 0xF8, 0xA1, 0x32, 0xE1, 0x21, 0xE9, 0xE2, 0x9E, 0x65, 0xAD, 0x69, 0x8D, 0xBE, 0xD2, 0xC6,
-    0xB4, 0x00, 0x99, 0x86, 0xB8, 0x01, 0xDD, 0xC9, 0xEE, 0x2B, 0x50, 0xEA, 0x02, 0x7C, 0xB7, 0x20,
-    0x72, 0x60, 0x9F, 0xE9, 0x9B, 0x4A, 0x92, 0x60, 0x3E, 0xCB, 0xD8, 0x5C, 0x09, 0x5C, 0xD9, 0x7D,
-    0x21, 0xAB, 0xFB, 0xDA, 0x46, 0xD4, 0x6E, 0xB2, 0x73, 0xFF, 0x86, 0x84, 0x40, 0x06, 0x2C, 0x2F,
-    0x49, 0xEF, 0x09, 0xD5, 0x11, 0x12, 0x52, 0x6F, 0x13, 0x13, 0x0A, 0x04, 0x52, 0x1A, 0xC7, 0xA2,
-    0x80, 0x89, 0x1D, 0x43, 0x7E, 0x67, 0x53, 0x5D, 0x33, 0x56, 0x40, 0x7D, 0x7E, 0x36, 0xC8, 0xFB,
-    0xA1, 0xC6, 0x14, 0x1D, 0x91, 0xB3, 0x51, 0x3A, 0x25, 0x95, 0x7E, 0x42, 0xA5, 0x96, 0x95, 0x1C,
-    0x21, 0x6F, 0xDB, 0x41, 0x0B, 0xAF, 0xCC, 0x50, 0x04, 0xE3, 0x6A, 0x3E, 0x2C, 0x15, 0x1C, 0xEB,
-    0x09, 0x98, 0xA6, 0x97, 0x39, 0xA4, 0x63, 0xD9, 0x3A, 0x18, 0x91, 0x59, 0xB2, 0x3B, 0xDC, 0x7C,
-    0x0C, 0xC8, 0x6D, 0x03, 0x73, 0xD3, 0x12, 0x88, 0x60, 0xA3, 0xBA, 0x21, 0xE9, 0x10, 0x8A, 0x82,
-    0xC9, 0xB0, 0x23, 0x41, 0xE0, 0x53, 0x47, 0xCC, 0x9A, 0xA8, 0x0F, 0x16, 0x12, 0x14, 0xBC, 0xB3,
-    0xD4, 0xB3, 0x49, 0xEB, 0xF3, 0x8A, 0xCF, 0xBC, 0xF6, 0xA8, 0x91, 0x08, 0xC2, 0xE1, 0x18, 0xC2,
-    0xAF, 0x0C, 0x76, 0x2A, 0x6F, 0xD8, 0x83, 0x48, 0x3E, 0x85, 0x0F, 0x1F, 0xF6, 0x1A, 0xB6, 0x06,
-    0x81, 0x8C, 0xE2, 0x4E, 0xB2, 0x9F, 0x22, 0x06, 0xA0, 0x50, 0x7E, 0x05, 0x4E, 0x83, 0x5D, 0x2A,
-    0xB5, 0x4C, 0xC6, 0xCF, 0x85, 0x45, 0x16, 0xE5, 0x60, 0xC1, 0xE4, 0xBE, 0xD8, 0xF9, 0xE3, 0xCB,
-    0xC3, 0x7F, 0xB9, 0xFE, 0xA6, 0x9A, 0x29, 0x13, 0x5F, 0x62, 0xCE, 0xBA, 0xCB, 0x69, 0x7D, 0xF4,
-    0x73, 0xB6, 0x29, 0x41, 0xB7, 0x9F, 0x9D, 0x23, 0x87, 0x76, 0xBE, 0x80, 0xF1, 0xF8, 0x80, 0xCB,
-    0x67, 0xD7, 0xF4, 0xB3, 0xC6, 0x96, 0x0F, 0xAF, 0x5F, 0x8B, 0xA6, 0x65, 0xB1, 0x7A, 0xD7, 0xE6,
-    0xC6, 0xF1, 0xD7, 0xDD, 0xE8, 0x46, 0xFD, 0xD5, 0xC0, 0x7F, 0x87, 0xE3, 0x01, 0x49, 0x00, 0x84,
-    0xD3, 0x05, 0xDD, 0x6D, 0xC5, 0x8B, 0x15, 0x46, 0x5B, 0x88, 0xF4, 0x57, 0x77, 0xC1, 0x95, 0x57,
-    0xE9, 0x2F, 0xE0, 0x09, 0x04, 0x57, 0x49, 0x6A, 0x8D, 0x29, 0x1B, 0xA1, 0x52, 0xCE, 0x2A, 0xD3,
-    0x22, 0x5C, 0xBF, 0x59, 0xD3, 0xE4, 0xAB, 0x8F, 0xAD, 0x65, 0xC9, 0xE2, 0x6E, 0x3B, 0x05, 0xC2,
-    0xB8, 0x5B, 0x20, 0xE0, 0x9A, 0x4D, 0x6B, 0xF3, 0xE9, 0x20, 0x73, 0x2E, 0xE9, 0x47, 0xF5, 0x92,
-    0x78, 0x96, 0xBC, 0xB4, 0x83, 0xC8, 0x47, 0xF2, 0xD2, 0xCE, 0xD7, 0xA5, 0x77, 0xD7, 0x6D, 0xD2,
-    0x08, 0xC6, 0xED, 0xE7, 0x03, 0x90, 0x9E, 0xEF, 0x8C, 0x69, 0xE3, 0xC2, 0xAB, 0x47, 0x92, 0x0A,
-    0xB8, 0x43, 0xCE, 0x26, 0xC7, 0xFC, 0x25, 0x3B, 0x70, 0x90, 0x3C, 0x99, 0x0D, 0x7E, 0xBB, 0x4B,
-    0x2F, 0xDE, 0x81, 0x65, 0xAB, 0x07, 0xD5, 0x09, 0xB1, 0x96, 0xFD, 0x2B, 0x43, 0x28, 0x72, 0x2D,
-    0x72, 0x45, 0xEC, 0x2A, 0x56, 0x0C, 0x20, 0xFC, 0xF1, 0xB0, 0xC9, 0x6A, 0x9C, 0xD0, 0x69, 0xAB,
-    0xA1, 0x2C, 0xB2, 0x5A, 0x59, 0xC9, 0xA4, 0x7F, 0x1A, 0xF6, 0x48, 0xDC, 0x23, 0x94, 0x3E, 0x75,
-    0xD9, 0x25, 0x03, 0xC6, 0x97, 0x9E, 0xCA, 0x6C, 0x4B, 0x58, 0x45, 0x9B, 0x79, 0xA9, 0xD7, 0xC1,
-    0x91, 0x36, 0x97, 0xB1, 0x5A, 0x57, 0x13, 0x65, 0x9B, 0x68, 0x00, 0xB5, 0x89, 0x50, 0x2B, 0x75,
-    0x71, 0x17, 0x1E, 0x02, 0x90, 0xA3, 0x5F, 0x8D, 0x49, 0x1B, 0x3D, 0x19, 0x4D, 0x1B, 0x77, 0x93,
-    0x69, 0x92, 0xCE, 0xC1, 0xD0, 0x6D, 0x09, 0xC9, 0x4D, 0xBE, 0x57, 0x19, 0x50, 0x9C, 0x22, 0xAD,
-    0x53, 0x47, 0x05, 0x1C, 0x11, 0x19, 0x6F, 0x45, 0x02, 0x5C, 0x97, 0x68, 0x6D, 0xBC, 0x94, 0x3E,
-    0x35, 0x66, 0x95, 0x96, 0x5E, 0x44, 0x18, 0x44, 0xEE, 0x88, 0x59, 0x0E, 0x5D, 0x9B, 0x0E, 0x65,
-    0x0D, 0x76, 0xE4, 0xF9, 0x1E, 0x24, 0x56, 0xE5, 0x39, 0x30, 0x10, 0xA6, 0x01, 0xC2, 0xFF, 0x2C,
-    0x53, 0x04, 0x0A, 0x92, 0xD6, 0xEC, 0x3D, 0x9E, 0xAC, 0x92, 0xA7, 0xCE, 0xFB, 0x1E, 0x96, 0xEA,
-    0xE9, 0xF1, 0x45, 0xBE, 0x46, 0xB4, 0xB9, 0x76, 0x4B, 0xF2, 0x7C, 0xA4, 0xAE, 0xE5, 0xCF, 0x5C,
-    0x32, 0x1A, 0xDF, 0xC4, 0x34, 0xCD, 0x1C, 0x4C, 0xC8, 0x52, 0xFF, 0x02, 0x7C, 0x82, 0xA6, 0x1F,
-    0x0C, 0x51, 0x8F, 0x5C, 0x15, 0xB3, 0x89, 0xBB, 0x08, 0x63, 0xEE, 0xAF, 0x15, 0x3A, 0xBE, 0xB6,
-    0xD3, 0x80, 0x62, 0x23, 0x93, 0x9D, 0xCC, 0x8C, 0xF3, 0x9A, 0xE1, 0xFF, 0x65, 0x03, 0xB2, 0x73,
-    0x28, 0xE5, 0x3E, 0x6A, 0xB5, 0xF5, 0x1B, 0x7A, 0x10, 0xE5, 0xAA, 0xA2, 0xCF, 0x5C, 0xCD, 0x65,
-    0x91, 0xA0, 0x72, 0x5D, 0x3E, 0x87, 0x81, 0x2D, 0x23, 0xFB, 0x32, 0xFF, 0x6A, 0x06, 0x66, 0x1E,
-    0x43, 0x16, 0xC6, 0xDA, 0x84, 0x44, 0x90, 0x7E, 0xC3, 0xC8, 0x50, 0x27, 0x2A, 0x29, 0xFB, 0x2F,
-    0xDE, 0x1C, 0xCC, 0xDD, 0x9F, 0xBB, 0x2B, 0x6F, 0x1E, 0xB2, 0x52, 0xFE, 0x09, 0x92, 0x6E, 0xC3,
-    0x4E, 0x57, 0x5A, 0x33, 0x99, 0x87, 0xA3, 0xA6, 0x5D, 0x20, 0x61, 0x55, 0xB2, 0x23, 0x56, 0xD3,
-    0x40, 0x9B, 0x8B, 0xBA, 0x6C, 0xB0, 0xF6, 0xA4, 0x35, 0xCC, 0xD5, 0x20, 0x67, 0x53, 0xC0, 0x55,
-    0x27, 0x0F, 0x91, 0x45, 0xF3, 0xBD, 0x7A, 0x96, 0x51, 0x19, 0xE8, 0x6C, 0xEA, 0xEC, 0xF6, 0x58,
-    0xCA, 0x0C, 0x4B, 0x44, 0x7D, 0x72, 0xD8, 0x1A, 0x2E, 0xB7, 0x94, 0x7C, 0x0C, 0x07, 0x24, 0x51,
-    0xC4, 0x15, 0x88, 0x76, 0x11, 0x61, 0xB8, 0x67, 0x36, 0xEC, 0x50, 0x33, 0x1A, 0x63, 0x8B, 0x4F,
-    0x29, 0x13, 0x51, 0xB9, 0x10, 0x9E, 0x75, 0x33, 0xDD, 0x6F, 0xBE, 0x99, 0x1E, 0x30, 0x42, 0x96,
-    0x91, 0x35, 0xE5, 0x30, 0xE1, 0x06, 0xFB, 0x1F, 0xFA, 0x74, 0x9A, 0x6F, 0xFA, 0x94, 0x57, 0x31,
-    0xD1, 0xCC, 0xA6, 0x63, 0x63, 0x06, 0xC8, 0x45, 0xA5, 0x10, 0x83, 0x8D, 0xC3, 0x1C, 0x71, 0xCF,
-    0x6C, 0xC6, 0x78, 0xBF, 0x88, 0xE0, 0xFF, 0x08, 0xC9, 0x02, 0x49, 0x23, 0x46, 0x41, 0x15, 0x4E,
-    0x29, 0x6A, 0x9A, 0x68, 0x0E, 0xB1, 0x14, 0x44, 0x73, 0xA2, 0x11, 0xBD, 0xD6, 0xF9, 0x47, 0xBA,
-    0x55, 0x7B, 0x58, 0x20, 0xAB, 0xB3, 0xCE, 0xDE, 0x61, 0x3F, 0xFD, 0x62, 0x63, 0x3E, 0xEE, 0xA2,
-    0xFF, 0x41, 0x81, 0x82, 0xAA, 0x05, 0xEA, 0xDE, 0xEB, 0xB2, 0xFB, 0xF8, 0x32, 0x63, 0x3F, 0xA7,
-    0xDD, 0xB6, 0x09, 0x3A, 0x83, 0x04, 0x7B, 0x03, 0x89, 0x85, 0x5D, 0xCA, 0xA5, 0xC2, 0x96, 0xF2,
-    0x19, 0xA8, 0x00, 0xB1, 0x85, 0xC5, 0x40, 0x85, 0xC0, 0x03, 0x83, 0x2A, 0xEB, 0x70, 0x42, 0xDA,
-    0x2D, 0xDF, 0x46, 0x02, 0x7B, 0x00, 0xC8, 0x7A, 0x0A, 0xFC, 0x9A, 0x6C, 0xA1, 0xB9, 0xB8, 0xBC,
-    0x8B, 0x8C, 0x76, 0x1F, 0xC4, 0x09, 0xD5, 0x5E, 0xD6, 0xA3, 0x5A, 0x80, 0xC1, 0xF1, 0x8A, 0x77,
-    0x27, 0xFA, 0xD3, 0xD0, 0xB7, 0xAF, 0x06, 0x79, 0xED, 0xB1, 0xEF, 0xAA, 0x32, 0x19, 0x02, 0xA4,
-    0x92, 0x11, 0x89, 0x90, 0xE2, 0x66, 0xF0, 0x80, 0xB2, 0x4E, 0x1F, 0x76, 0xC9, 0x67, 0xB0, 0xB0,
-    0xC5, 0xCA, 0x9D, 0x0B, 0xD9, 0xF6, 0xD9, 0x6D, 0x6B, 0x88, 0x45, 0x90, 0xC7, 0x4F, 0xE0, 0x5C,
-    0x67, 0x0D, 0xCF, 0x04, 0x7E, 0x24, 0x1B, 0x95, 0xD5, 0xB6, 0xAA, 0x33, 0x8D, 0x2B, 0x54, 0x9A,
-    0xD6, 0x6D, 0xA8, 0x60, 0x41, 0xF3, 0x2A, 0xD2, 0x12, 0x5C, 0x1B, 0xEA, 0xCD, 0xCD, 0x02, 0x3F,
-    0xC3, 0x27, 0x5A, 0x58, 0xA8, 0xB9, 0xD0, 0xC4, 0xAA, 0xFA, 0xD6, 0xC6, 0x9E, 0xFF, 0x7C, 0x0A,
-    0x16, 0x7A, 0x07, 0x2C, 0x12, 0xA1, 0xFF, 0xA3, 0x6F, 0xF8, 0x6B, 0x7B, 0x6C, 0xE5, 0x8E, 0x9A,
-    0x5D, 0x32, 0x38, 0x08, 0x79, 0xDC, 0xCA, 0xE4, 0x9C, 0x4E, 0x68, 0xE1, 0x15, 0x78, 0x0F, 0xD9,
-    0x44, 0x83, 0x1E, 0x2C, 0x09, 0x76, 0x1A, 0x71, 0xF4, 0x40, 0x9E, 0x9B, 0xB0, 0x52, 0x23, 0xDB,
-    0x44, 0x0D, 0x87, 0x5D, 0x9E, 0x2F, 0x14, 0x79, 0x9B, 0x90, 0xE4, 0x11, 0xF2, 0x41, 0xD9, 0xC8,
-    0x93, 0x6A, 0xF6, 0x91, 0xE8, 0x36, 0x54, 0xD7, 0xA2, 0x10, 0x6E, 0xA2, 0xE9, 0x02, 0xA6, 0xF0,
-    0x29, 0x8A, 0xA9, 0x89, 0x30, 0xCE, 0x55, 0x77, 0x5E, 0x28, 0x67, 0x73, 0xCA, 0x34, 0xDC, 0x66,
-    0xC6, 0xBD, 0xAB, 0xD9, 0x63, 0x78, 0x63, 0xE9, 0x2A, 0x4E, 0xD8, 0xD9, 0x0F, 0x5C, 0x3D, 0xE5,
-    0x00, 0x55, 0x38, 0x4A, 0xDA, 0x96, 0xF7, 0x58, 0xDE, 0x3E, 0x18, 0x61, 0xEE, 0xC6, 0x89, 0x76,
-    0xC4, 0xB4, 0x27, 0x96, 0xF7, 0x34, 0xA8, 0xF6, 0xC5, 0x3E, 0x61, 0x67, 0xEC, 0xFE, 0x4E, 0xA3,
-    0x53, 0x3C, 0xAD, 0x64, 0xA2, 0x65, 0xC9, 0xBD, 0x90, 0x51, 0xFB, 0x5C, 0xDB, 0x75, 0x78, 0x81,
-    0x89, 0x31, 0xBD, 0x44, 0x23, 0x23, 0x99, 0xC8, 0x0D, 0xEC, 0xA6, 0x6F, 0xB4, 0xF4, 0x61, 0x96,
-    0x99, 0xE6, 0xC9, 0xA4, 0x2C, 0x0E, 0x8C, 0xAF, 0x20, 0x89, 0xF3, 0x38, 0x92, 0xB5, 0xBE, 0x1C,
-    0x15, 0xCD, 0xAA, 0x30, 0x42, 0xAA, 0x25, 0x89, 0xE6, 0x83, 0xC6, 0x3C, 0xEC, 0x22, 0x36, 0xFA,
-    0xFF, 0x1B, 0xA5, 0x05, 0xBB, 0xF3, 0xDB, 0x9C, 0xF8, 0xF9, 0xCA, 0x8E, 0x8A, 0xD0, 0x6C, 0xD8,
-    0x9E, 0xA2, 0xFC, 0xCE, 0x4C, 0x3D, 0x36, 0xE9, 0x22, 0x9A, 0xA8, 0x46, 0xA6, 0x07, 0x57, 0x28,
-    0x87, 0x69, 0x48, 0xEC, 0xC0, 0x9B, 0xC8, 0x28, 0x31, 0xD3, 0x4B, 0x47, 0x25, 0x66, 0xE5, 0x15,
-    0xC0, 0xE8, 0x62, 0xD3, 0x8D, 0x60, 0x17, 0xE7, 0x12, 0x2E, 0xBD, 0x9B, 0x15, 0xF0, 0x53, 0xC3,
-    0x8E, 0xC0, 0xF5, 0xD0, 0x29, 0x87, 0x3D, 0x9A, 0xEF, 0xD5, 0x20, 0x28, 0xD3, 0x97, 0x02, 0xEA,
-    0x15, 0x4D, 0x16, 0xF0, 0x1C, 0x64, 0x52, 0x5F, 0xFC, 0x68, 0x39, 0x84, 0x6B, 0x39, 0x5E, 0x84,
-    0x5B, 0x59, 0x76, 0x29, 0x71, 0xD7, 0x54, 0x69, 0x5A, 0x4F, 0xA0, 0xB5, 0xB0, 0x48, 0xA0, 0xDA,
-    0x34, 0x1F, 0x80, 0x8D, 0x9E, 0x34, 0x4B, 0xA6, 0x25, 0xE5, 0x24, 0xD4, 0x9C, 0xB8, 0x44, 0xD5,
-    0x95, 0x05, 0x53, 0xF7, 0x68, 0x00, 0x76, 0xAF, 0xCA, 0xA7, 0x57, 0x46, 0x39, 0xF0, 0xFD, 0xC4,
-    0xAC, 0xF3, 0xC8, 0x76, 0xC0, 0x18, 0xA3, 0xDF, 0x96, 0xCF, 0x2B, 0x56, 0x34, 0x98, 0xEC, 0x68,
-    0x09, 0x7A, 0xB4, 0x42, 0xF5, 0xBA, 0x4E, 0xCA, 0x7C, 0xB0, 0xA2, 0x85, 0xFB, 0xA7, 0x33, 0xEC,
-    0x3A, 0xB1, 0x2F, 0x9C, 0x37, 0x97, 0xE8, 0x04, 0xF8, 0x36, 0xE6, 0xBD, 0xBD, 0xD6, 0xAE, 0xAC,
-    0x8D, 0xD8, 0x1B, 0xC4, 0x06, 0x05, 0x2A, 0xF8, 0x92, 0x3F, 0xC9, 0xB3, 0xC4, 0x9E, 0x1D, 0x07,
-    0x5A, 0xB8, 0x6E, 0xB1, 0x9C, 0xA8, 0x25, 0x74, 0x71, 0x20, 0x02, 0xD6, 0x7A, 0x8A, 0xF7, 0xE5,
-    0x3E, 0x60, 0x50, 0x03, 0x45, 0x1A, 0x05, 0x20, 0x87, 0xD9, 0x8D, 0x31, 0xE1, 0xFE, 0xEF, 0x08,
-    0xC9, 0xD9, 0xB3, 0xA8, 0xA2, 0x7E, 0x94, 0x9B, 0xBE, 0x07, 0xF9, 0x72, 0x94, 0xC3, 0x90, 0xC4,
-    0xD5, 0xC9, 0xA3, 0x7E, 0x69, 0x11, 0x1D, 0x4B, 0xB9, 0xC0, 0x3D, 0xA6, 0x8B, 0x65, 0xB8, 0x6B,
-    0x3A, 0x5D, 0x94, 0x0B, 0x87, 0xE4, 0x91, 0x50, 0xC1, 0x22, 0x53, 0x13, 0x0E, 0x4F, 0x05, 0x27,
-    0x3D, 0xBB, 0x0C, 0x30, 0x26, 0x6F, 0xAC, 0x1B, 0x13, 0xED, 0x75, 0xA3, 0x04, 0xF0, 0x54, 0x96,
-    0x6C, 0xE0, 0x96, 0x0E, 0x34, 0xDC, 0x11, 0x0B, 0xC2, 0x07, 0x72, 0x87, 0x44, 0xFF, 0x15, 0xDC,
-    0xA4, 0x7A, 0x56, 0x84, 0x74, 0x1A, 0xA2, 0x83, 0x1A, 0xB7, 0x6C, 0x67, 0xC1, 0xED, 0x66, 0x92,
-    0xEE, 0x58, 0x9B, 0xD8, 0x48, 0xC5, 0xA8, 0xB5, 0xB2, 0x66, 0x73, 0xBC, 0x15, 0x8C, 0x93, 0x1E,
-    0xA0, 0x2D, 0xA9, 0x9F, 0x6A, 0x6A, 0xE3, 0x1B, 0xB9, 0xA4, 0xFF, 0xAA, 0x16, 0x82, 0xF8, 0x82,
-    0x36, 0x33, 0xD4, 0x8C, 0x56, 0x9A, 0x7C, 0xB7, 0x97, 0x0A, 0xA4, 0xCA, 0xAC, 0x61, 0xB5, 0x90,
-    0xA7, 0xD1, 0xDA, 0x66, 0x6A, 0x77, 0xA9, 0x8B, 0xF9, 0x71, 0xAB, 0xEA, 0xB4, 0xC7, 0x32, 0x5B,
-    0x4A, 0x6C, 0x72, 0xEE, 0x8E, 0x73, 0xF3, 0xA9, 0x8B, 0x4F, 0xCF, 0xFF, 0x06, 0xEC, 0xDE, 0x97,
-    0x00, 0xC1, 0xCE, 0xA0, 0x37, 0x7C, 0x2D, 0x1A, 0x0E, 0x6A, 0x3B, 0x1A, 0x5B, 0x0D, 0x77, 0x09,
-    0x38, 0x12, 0x02, 0x40, 0x7F, 0x51, 0xBA, 0x8F, 0xDC, 0xB4, 0x94, 0x1E, 0xE1, 0xB6, 0xF4, 0xC0,
-    0x57, 0xBF, 0x8C, 0xB1, 0x5B, 0xA3, 0x68, 0x7B, 0x25, 0x97, 0xA8, 0x33, 0xF3, 0x5A, 0x7A, 0x67,
-    0x90, 0x36, 0xCE, 0x1A, 0xAD, 0x7E, 0x65, 0x40, 0xEC, 0x7B, 0x40, 0x5A, 0xA0, 0xE3, 0x77, 0xA9,
-    0xE7, 0x17, 0x2B, 0x06, 0x1F, 0x47, 0x3B, 0x8D, 0xAE, 0x6E, 0x71, 0x38, 0x55, 0x4E, 0x23, 0x2C,
-    0xAD, 0x4F, 0xBF, 0x5D, 0x47, 0xFF, 0xD9, 0x84, 0x3C, 0xCF, 0xFC, 0x30, 0x56, 0xAF, 0x2D, 0x3E,
-    0xDF, 0x8D, 0x5A, 0x3E, 0x13, 0xE3, 0x7E, 0x49, 0x9E, 0x12, 0xBA, 0xFA, 0xCB, 0x0D, 0x15, 0xEC,
-    0xFD, 0x87, 0x3F, 0x2A, 0x71, 0xAD, 0x82, 0xC9, 0xFF, 0x6D, 0x28, 0xF9, 0x2A, 0x2B, 0x63, 0xC0,
-    0x92, 0xFD, 0x05, 0x8A, 0x52, 0xEB, 0x1A, 0x6D, 0x25, 0xFD, 0xF1, 0xF3, 0x73, 0xCE, 0xC5, 0xDA,
-    0x44, 0x61, 0x97, 0x09, 0x13, 0xFE, 0x73, 0xCC, 0xFE, 0xED, 0x82, 0x5B, 0x7F, 0x00, 0x5D, 0x3F,
-    0x11, 0x39, 0x84, 0x25, 0xFE, 0x26, 0x5D, 0x4E, 0x6E, 0x56, 0xA0, 0xD2, 0xB3, 0x3F, 0xA4, 0x56,
-    0x56, 0x79, 0x04, 0x76, 0xB6, 0x17, 0xD9, 0x4D, 0x4D, 0x58, 0xDB, 0xB3, 0x43, 0xB9, 0x7B, 0x11,
-    0x59, 0x0B, 0x08, 0x7C, 0x8E, 0xC5, 0x19, 0x2B, 0x18, 0xF6, 0x08, 0x17, 0xA2, 0xF4, 0xC5, 0x46,
-    0xE2, 0xBE, 0xFC, 0x03, 0x68, 0xE7, 0xFD, 0x29, 0x18, 0xC1, 0xF2, 0x37, 0x04, 0x8C, 0x5D, 0x66,
-    0x1B, 0x03, 0xF5, 0x2C, 0x72, 0x0D, 0xB8, 0x87, 0x65, 0x6B, 0xFA, 0x61, 0x9D, 0xF6, 0xFE, 0x38,
-    0x25, 0xDC, 0xBF, 0x06, 0x5D, 0x47, 0x59, 0x0F, 0x46, 0xB4, 0xCD, 0xC3, 0xC4, 0xCA, 0x0C, 0xC3,
-    0x46, 0x28, 0x76, 0x66, 0xD6, 0x9E, 0xE9, 0xBC, 0xE0, 0x67, 0xD6, 0xB0, 0x5D, 0x13, 0x1C, 0xBD,
-    0x98, 0xB6, 0xF1, 0x80, 0x94, 0x41, 0x83, 0x12, 0x78, 0xC9, 0x48, 0xD7, 0x72, 0xE0, 0xEB, 0xFB,
-    0xC2, 0x1E, 0xA3, 0x55, 0xDB, 0x9C, 0xB9, 0x76, 0xE6, 0x2A, 0x4A, 0x11, 0x10, 0xD8, 0xDB, 0xE3,
-    0x4E, 0x7B, 0xB4, 0xFC, 0x26, 0x28, 0x6E, 0x29, 0x8E, 0x8B, 0xB6, 0xD1, 0xCC, 0x3E, 0x78, 0x3E,
-    0xC1, 0xDF, 0xDF, 0xAE, 0xB7, 0xCD, 0xFB, 0x16, 0x18, 0x63, 0x6D, 0xA1, 0x8D, 0x52, 0xB9, 0xE5,
-    0x8D, 0xC0, 0x06, 0x16, 0xFB, 0xB6, 0xEC, 0x27, 0x6B, 0x97, 0xD9, 0xF2, 0xC1, 0x0B, 0x5E, 0x6C,
-    0x99, 0xA8, 0x94, 0xC0, 0x90, 0x6E, 0xA4, 0x47, 0x2E, 0xC2, 0xA4, 0xC8, 0xA4, 0x0D, 0xF3, 0x13,
-    0xBB, 0x8E, 0x7C, 0x1E, 0xC4, 0x35, 0x3B, 0x44, 0xA6, 0x7A, 0xEF, 0x68, 0x7F, 0xF2, 0x98, 0x4A,
-    0x5F, 0xF6, 0xBD, 0x28, 0x79, 0xFD, 0x75, 0xC8, 0x7C, 0xAB, 0x00, 0x84, 0xD4, 0x3E, 0x41, 0x6A,
-    0xCF, 0x82, 0xD9, 0x56, 0xCF, 0xB3, 0xF3, 0xF5, 0x3C, 0x7B, 0x60, 0x73, 0x1D, 0x2B, 0xC1, 0x46,
-    0x71, 0x25, 0x05, 0x3B, 0x60, 0xF1, 0xD1, 0x8B, 0x65, 0x95, 0xB6, 0xA6, 0x4F, 0x79, 0xA8, 0x38,
-    0xE8, 0x99, 0x73, 0xB8, 0x3E, 0xDA, 0x23, 0x71, 0xAB, 0x13, 0x60, 0xB2, 0xF0, 0x27, 0x8D, 0xA4,
-    0xA3, 0x9F, 0xFF, 0x98, 0x5E, 0xE1, 0x25, 0x82, 0x6F, 0xCA, 0x84, 0x10, 0xCC, 0xE1, 0xFD, 0xF1,
-    0x95, 0x76, 0xEB, 0x1F, 0x79, 0xBD, 0xB4, 0xF0, 0xA9, 0x39, 0x1D, 0x44, 0xBB, 0xED, 0x34, 0xAF,
-    0x6A, 0x49, 0x0F, 0x51, 0x4F, 0xA6, 0xD1, 0xA9, 0xBB, 0xD0, 0x45, 0xD4, 0x95, 0x69, 0x75, 0x55,
-    0x5E, 0x7D, 0x64, 0xE3, 0xCB, 0x7E, 0x87, 0x07, 0xB8, 0x0E, 0x68, 0x73, 0xF6, 0x56, 0x23, 0xDF,
-    0x36, 0xB2, 0x5A, 0x1E, 0xDA, 0x37, 0x2C, 0x78, 0x58, 0xBA, 0x6E, 0x0B, 0x29, 0x12, 0x49, 0x7F,
-    0xF8, 0x4D, 0xCB, 0xC0, 0xFC, 0x70, 0x30, 0xEC, 0xF5, 0xC4, 0xA3, 0xEF, 0xF1, 0xE5, 0x7B, 0x32,
-    0x8F, 0x8E, 0x98, 0xD8, 0xB5, 0xEC, 0xA6, 0xF3, 0xF1, 0x58, 0x27, 0x5C, 0x8D, 0xF5, 0xDB, 0x3B,
-    0x08, 0xD3, 0x30, 0x0B, 0x79, 0xFF, 0xA0, 0x4E, 0xD6, 0x1D, 0x7D, 0x50, 0x47, 0x4F, 0x26, 0x45,
-    0xEB, 0x24, 0xFC, 0xC9, 0x22, 0x2C, 0x6A, 0xD3, 0xC5, 0x54, 0x49, 0xCB, 0x54, 0xB5, 0x57, 0xD3,
-    0xED, 0x61, 0x80, 0xDA, 0x3C, 0x02, 0x23, 0x95, 0x12, 0xC0, 0x82, 0xBD, 0xCD, 0x6A, 0x8B, 0xA5,
-    0xDA, 0xE8, 0xB0, 0xB6, 0xD0, 0xE3, 0x06, 0x4B, 0xBE, 0xF1, 0x20, 0xAB, 0xD3, 0xBB, 0x8F, 0x7A,
-    0xF8, 0x7C, 0xFE, 0xD6, 0x4F, 0xE1, 0x4C, 0x63, 0x56, 0x56, 0xF1, 0x61, 0x73, 0x00, 0x4B, 0xB9,
-    0xF0, 0x10, 0xCC, 0xA8, 0x4F, 0x5C, 0x01, 0xD7, 0x81, 0xCB, 0xC4, 0x33, 0x1F, 0xC2, 0x30, 0xDD,
-    0x7A, 0x6C, 0x4B, 0xD8, 0x42, 0x60, 0x84, 0xFA, 0x64, 0xD6, 0x23, 0x36, 0x28, 0x8B, 0x9B, 0x4B,
-    0x55, 0x05, 0xBF, 0xDA, 0x2F, 0x03, 0x04, 0x5D, 0x19, 0x01, 0xCA, 0xCA, 0xD8, 0x45, 0x7D, 0x99,
-    0x7C, 0x02, 0x57, 0x32, 0x37, 0x10, 0x81, 0xD9, 0x5E, 0x5A, 0xE7, 0x79, 0x86, 0x8D, 0x7A, 0x3F,
-    0x43, 0x75, 0x79, 0x33, 0x43, 0xB1, 0x38, 0x20, 0x69, 0xE4, 0x5D, 0x36, 0xB0, 0x8A, 0x40, 0x95,
-    0xD0, 0x64, 0xED, 0x66, 0x06, 0xB0, 0x08, 0xB9, 0x95, 0x56, 0xF1, 0x42, 0x23, 0x50, 0xFD, 0xA6,
-    0x4D, 0xD2, 0xC3, 0x80, 0x6C, 0x67, 0x60, 0x21, 0x4D, 0x0C, 0xF5, 0xC1, 0x6B, 0xB5, 0x4A, 0x44,
-    0x5E, 0x0C, 0x16, 0x42, 0xF0, 0x82, 0x4E, 0xEA, 0xEC, 0x3B, 0xA9, 0x9B, 0x4E, 0x30, 0x5C, 0xC2,
-    0x3F, 0x98, 0x75, 0x76, 0xED, 0x98, 0x54, 0x67, 0xAE, 0x25, 0x74, 0x46, 0xD6, 0xCE, 0x65, 0xC0,
-    0x7E, 0x3C, 0x8B, 0x71, 0x88, 0x99, 0x01, 0xF7, 0xD9, 0xF7, 0xA0, 0xCD, 0xC7, 0xC8, 0x42, 0x87,
-    0x64, 0x21, 0x4B, 0x76, 0xF7, 0xC7, 0x61, 0xCB, 0x71, 0x1C, 0x73, 0x02, 0x54, 0x57, 0x9B, 0xD8,
-    0xE5, 0x6C, 0x4F, 0xE4, 0xDB, 0xAF, 0x4B, 0x84, 0xFA, 0xC7, 0xDC, 0x6B, 0xE5, 0x2B, 0xA7, 0x16,
-    0xEF, 0xCB, 0xEF, 0xF6, 0x21, 0x0F, 0x82, 0x40, 0xA8, 0xE1, 0xA5, 0x49, 0xCF, 0xDA, 0x15, 0xC5,
-    0xA6, 0x3E, 0x92, 0xC7, 0x7A, 0x8D, 0xDA, 0x41, 0xEA, 0x8B, 0x72, 0x75, 0xB5, 0xEB, 0x0F, 0x2F,
-    0xAA, 0x20, 0xF4, 0x04, 0x0A, 0x35, 0x3E, 0x90, 0xFB, 0xC2, 0xC5, 0x5E, 0x35, 0x22, 0xDD, 0xE7,
-    0xC6, 0xA9, 0x61, 0x06, 0xEF, 0x54, 0xE5, 0x42, 0x07, 0xA6, 0xE5, 0xE1, 0x2F, 0xCA, 0x46, 0x12,
-    0x61, 0x09, 0x67, 0xDD, 0x12, 0x7C, 0x91, 0xA7, 0xE3, 0x99, 0x77, 0x4A, 0x22, 0xC6, 0x7E, 0x95,
-    0xEA, 0x43, 0x6B, 0x15, 0x6F, 0x88, 0x3C, 0x01, 0xC6, 0x32, 0x21, 0x41, 0xE9, 0x89, 0x6F, 0xB3,
-    0xF1, 0x41, 0x14, 0x37, 0xC4, 0x6E, 0x93, 0x8E, 0x8A, 0x4D, 0x8B, 0xDC, 0x1F, 0x82, 0xBC, 0x5C,
-    0x2D, 0x2F, 0xAF, 0x13, 0x07, 0xD7, 0x34, 0xE2, 0xF6, 0xAF, 0xC7, 0x6E, 0x56, 0x1D, 0x4B, 0xDF,
-    0x06, 0x64, 0xC9, 0xCA, 0x09, 0xC8, 0xF7, 0x7C, 0xB7, 0xD5, 0xCD, 0x50, 0xF2, 0x8A, 0x5B, 0xA0,
-    0x3D, 0xEC, 0x01, 0xBD, 0xF9, 0xDE, 0x52, 0x4C, 0xD8, 0xB5, 0x98, 0x70, 0x7C, 0x42, 0xAF, 0x57,
-    0x15, 0x5F, 0xF9, 0xAB, 0x49, 0x9F, 0x60, 0x13, 0x16, 0x2C, 0xC1, 0xBA, 0xE7, 0x3A, 0xBA, 0x5E,
-    0x9E, 0x86, 0xAA, 0x95, 0x13, 0xEB, 0x3A, 0xA8, 0x25, 0xF3, 0x47, 0xEC, 0x1F, 0xF0, 0x5B, 0x58,
-    0xE2, 0x90, 0xD6, 0xE1, 0xAF, 0x46, 0xAD, 0x26, 0x12, 0x8F, 0x0E, 0xD0, 0x14, 0x3C, 0xA8, 0x55,
-    0x55, 0xE3, 0x85, 0xF3, 0x4C, 0xEA, 0x36, 0x9C, 0x8A, 0x44, 0xD1, 0x2D, 0xFD, 0x54, 0xA5, 0x22,
-    0x30, 0xFD, 0xB4, 0x0D, 0x3D, 0x43, 0x7F, 0x1F, 0xBD, 0x8B, 0xBC, 0xF0, 0x00, 0x81, 0x4F, 0x36,
-    0x66, 0x5B, 0xB7, 0xDF, 0x7D, 0x30, 0xC5, 0x3F, 0xE8, 0xB7, 0xC6, 0x06, 0xAD, 0x34, 0xE9, 0x89,
-    0x85, 0x12, 0xDA, 0xFF, 0x05, 0x85, 0x54, 0x4F, 0x68, 0x1C, 0x55, 0x18, 0xFF, 0xCD, 0xCC, 0x4E,
-    0xC7, 0x76, 0x68, 0x26, 0xE8, 0x2E, 0x6A, 0x9B, 0x64, 0x72, 0xF0, 0x10, 0xEA, 0x36, 0x73, 0xC9,
-    0x61, 0xC5, 0xDD, 0x9D, 0x49, 0x73, 0xC8, 0xA1, 0x87, 0xAC, 0x90, 0xF5, 0x50, 0xD0, 0x2A, 0xF4,
-    0xA4, 0xD4, 0x06, 0x89, 0x10, 0x64, 0xD7, 0x99, 0x52, 0x25, 0x42, 0x0F, 0x06, 0xBC, 0x88, 0x7A,
-    0x08, 0xB4, 0x48, 0x5D, 0x91, 0x2C, 0x1A, 0x31, 0xD4, 0x4D, 0x76, 0x92, 0x05, 0x0B, 0xCD, 0x21,
-    0xD3, 0xEE, 0x21, 0x87, 0x82, 0x1D, 0x1B, 0x6B, 0xC1, 0x0A, 0x79, 0x21, 0x23, 0xDD, 0x6D, 0xDF,
-    0xCC, 0xF3, 0xBD, 0xD8, 0x8A, 0x45, 0xC1, 0x6F, 0x78, 0xC3, 0xBC, 0xF7, 0x7D, 0xF3, 0xFD, 0xFB,
-    0xFD, 0xBE, 0x07, 0xA5, 0x63, 0xFA, 0xCB, 0x72, 0x08, 0xE8, 0x1D, 0x23, 0xB4, 0x9D, 0x65, 0x70,
-    0x51, 0x18, 0xEC, 0x58, 0x89, 0x68, 0x11, 0x91, 0xE1, 0x11, 0xC6, 0xD6, 0xB7, 0xE3, 0xBC, 0x1E,
-    0x1C, 0xAA, 0x7D, 0xC4, 0xB6, 0x58, 0x04, 0x48, 0x8C, 0xDD, 0x65, 0xEC, 0x44, 0xED, 0x12, 0xB7,
-    0x0C, 0x86, 0xED, 0x85, 0x55, 0xD6, 0xD9, 0xD7, 0x05, 0x8C, 0x8D, 0x7B, 0x74, 0x08, 0x43, 0x03,
-    0xF6, 0xC4, 0x46, 0x9B, 0x94, 0x4A, 0x47, 0xC6, 0x93, 0xA7, 0x49, 0xD1, 0x6A, 0x71, 0xD7, 0x66,
-    0xC0, 0xD6, 0xC7, 0x4F, 0x1F, 0xB5, 0xC9, 0x5B, 0xC2, 0xBB, 0x16, 0x25, 0x46, 0x3B, 0xB2, 0x8E,
-    0x07, 0x33, 0xA6, 0xD8, 0x52, 0x63, 0xB5, 0x4B, 0x15, 0xE6, 0x6B, 0x14, 0xAA, 0xB6, 0x46, 0x3A,
-    0x05, 0x73, 0x7C, 0x75, 0x3E, 0xA5, 0x1A, 0xE7, 0x5B, 0xED, 0x9F, 0x49, 0xD4, 0xA8, 0x62, 0x4F,
-    0x62, 0x57, 0xA2, 0xCB, 0x32, 0xA1, 0x72, 0x40, 0xE0, 0x80, 0xC2, 0x7E, 0xEA, 0xEA, 0xAB, 0x4B,
-    0xA6, 0xC1, 0x9C, 0x15, 0xA1, 0x75, 0x89, 0xC5, 0x5A, 0xB7, 0x97, 0x67, 0x94, 0x40, 0x8A, 0x0C,
-    0xDF, 0x55, 0x22, 0xCB, 0x4F, 0xA4, 0x12, 0x94, 0xC8, 0xF4, 0x13, 0x85, 0x58, 0x1E, 0x95, 0x1C,
-    0xC4, 0x71, 0xBC, 0x5C, 0x2D, 0xA4, 0x1F, 0x3B, 0x83, 0x4E, 0x6C, 0x87, 0x6A, 0x3E, 0x2F, 0x84,
-    0x1A, 0xC4, 0xF2, 0x8B, 0x80, 0xD3, 0xF3, 0x7C, 0x9B, 0x2A, 0x7E, 0x3A, 0xA5, 0xF8, 0xC5, 0x59,
-    0x5A, 0x57, 0xD1, 0x4C, 0xDE, 0xF8, 0x1A, 0x59, 0xE4, 0x91, 0xC3, 0x08, 0xA6, 0x00, 0x39, 0x56,
-    0xA8, 0x16, 0xD9, 0xA1, 0xEB, 0x4C, 0x42, 0xD2, 0x5A, 0x41, 0x58, 0xD0, 0x1C, 0x48, 0xBE, 0x8E,
-    0xAA, 0x11, 0x03, 0xF6, 0xAF, 0xF7, 0x7B, 0xC0, 0x4B, 0x96, 0x30, 0x75, 0xE6, 0xB3, 0xA4, 0x07,
-    0x73, 0x99, 0x12, 0xE3, 0x5B, 0xA4, 0x79, 0xCE, 0x54, 0xA2, 0x72, 0xC7, 0x22, 0x76, 0x68, 0x7B,
-    0x19, 0x85, 0xB8, 0x5A, 0xB8, 0xA2, 0x27, 0x76, 0xF8, 0xA5, 0x6A, 0xDC, 0xE9, 0xC4, 0x29, 0x0C,
-    0xE8, 0x13, 0x57, 0x76, 0x77, 0x3A, 0xA5, 0xB4, 0x1E, 0xB2, 0xAD, 0xD6, 0x86, 0x61, 0x75, 0x2C,
-    0x47, 0x1D, 0xA5, 0xF6, 0x58, 0x78, 0x0A, 0xBA, 0xE7, 0x3A, 0x36, 0x68, 0xF3, 0x56, 0x02, 0x7D,
-    0x8D, 0x54, 0xB5, 0x5F, 0xDC, 0xEB, 0x14, 0x50, 0xF5, 0x56, 0x18, 0x15, 0x4C, 0x7D, 0x6D, 0xCE,
-    0x66, 0x77, 0x7E, 0x5B, 0xA9, 0x4B, 0x37, 0x91, 0x2D, 0x49, 0x4E, 0x6F, 0xEF, 0x61, 0xC3, 0xB0,
-    0x99, 0x5F, 0x2A, 0xF1, 0xB8, 0x1D, 0x63, 0xED, 0x51, 0x77, 0x45, 0xEB, 0x05, 0xB0, 0x1A, 0xA1,
-    0x45, 0x29, 0x12, 0xD8, 0x15, 0xFF, 0xC6, 0xEE, 0x9F, 0x2D, 0xD4, 0xC2, 0xBC, 0x99, 0x74, 0x8A,
-    0x4D, 0x92, 0xD3, 0xBD, 0x87, 0x98, 0xDB, 0x2C, 0x71, 0x59, 0xA2, 0x96, 0xCB, 0x0A, 0x63, 0x7E,
-    0xB9, 0xCC, 0x1B, 0x07, 0x9B, 0xC5, 0x07, 0x6A, 0x35, 0xFC, 0x65, 0x6C, 0x37, 0x49, 0x5E, 0xF7,
-    0xF6, 0x98, 0xF1, 0x80, 0xB1, 0x4F, 0x6B, 0x97, 0x32, 0xE5, 0x72, 0x79, 0xD2, 0x66, 0x8C, 0xD1,
-    0xBD, 0x17, 0x1E, 0xC9, 0x12, 0x5C, 0xDF, 0x22, 0x56, 0xA4, 0x74, 0xD0, 0xF7, 0xF0, 0xA8, 0xC1,
-    0x17, 0xE1, 0xD9, 0xF0, 0x2E, 0x09, 0x20, 0x0C, 0xEE, 0xC6, 0xE2, 0x47, 0x85, 0xFF, 0x50, 0x39,
-    0xFF, 0xAB, 0x4A, 0x0B, 0x8F, 0x05, 0xCB, 0x18, 0x5E, 0xE2, 0x60, 0x5D, 0x70, 0x7A, 0xA6, 0x71,
-    0x83, 0x51, 0x9E, 0xB0, 0x5A, 0x1E, 0x63, 0xC9, 0x08, 0x36, 0xD1, 0x77, 0xF9, 0xAB, 0xAB, 0xB5,
-    0x4B, 0xD2, 0xE8, 0x31, 0x96, 0x4C, 0xD5, 0xBF, 0x93, 0x24, 0xE0, 0x9B, 0xD5, 0x58, 0x09, 0xDF,
-    0x0D, 0x46, 0x81, 0xB9, 0xAA, 0x01, 0xA2, 0x39, 0x39, 0x4B, 0x76, 0x32, 0x22, 0x7B, 0x9A, 0x29,
-    0x8B, 0x16, 0x36, 0x59, 0x54, 0xAB, 0xCD, 0x0B, 0xAA, 0x78, 0x54, 0x0B, 0x78, 0x9C, 0x6B, 0xB1,
-    0x11, 0x34, 0x1E, 0xAB, 0x3C, 0x6D, 0xFD, 0x18, 0xE5, 0xFB, 0xB9, 0xAD, 0x5A, 0x92, 0xAF, 0x25,
-    0x43, 0xAE, 0xB5, 0x71, 0x63, 0x8B, 0xD0, 0x74, 0x45, 0x82, 0x2A, 0x47, 0xF6, 0x18, 0x35, 0x79,
-    0x8A, 0xB0, 0x58, 0x52, 0x28, 0x9F, 0xCE, 0x21, 0x3B, 0xC2, 0xE9, 0x04, 0xFC, 0x3B, 0x44, 0x2A,
-    0x55, 0x28, 0x56, 0x0A, 0x8D, 0x0A, 0xAD, 0x00, 0x87, 0x3E, 0x8E, 0xA5, 0x20, 0xAB, 0x88, 0xFF,
-    0x9E, 0xFC, 0xC0, 0x8C, 0xDA, 0xDB, 0xF4, 0xED, 0x9F, 0x44, 0x75, 0x69, 0x48, 0x1D, 0x1E, 0x1A,
-    0xE5, 0x94, 0x41, 0xC8, 0xF7, 0x6C, 0x6C, 0x74, 0x11, 0x15, 0xCE, 0x73, 0xD1, 0x04, 0xC9, 0x19,
-    0xB4, 0xEE, 0xAD, 0x6E, 0x52, 0x49, 0x72, 0x8C, 0x6B, 0x01, 0x4B, 0x14, 0x31, 0xD5, 0xC0, 0xE0,
-    0x6B, 0xE6, 0xC2, 0x39, 0x46, 0x0F, 0x1C, 0xDC, 0x23, 0xC0, 0x6C, 0x54, 0xCF, 0xF7, 0x80, 0x71,
-    0xBA, 0x27, 0x73, 0x87, 0x9C, 0x37, 0x79, 0x39, 0xA8, 0xE2, 0x44, 0x49, 0x43, 0x46, 0x75, 0xB0,
-    0x0F, 0xFB, 0xB9, 0x17, 0xA4, 0x0F, 0xF2, 0x28, 0xE3, 0xD7, 0x81, 0x27, 0xAA, 0x83, 0xC0, 0x2C,
-    0xB7, 0x49, 0x4D, 0x0D, 0x41, 0xF2, 0x50, 0xE2, 0x8F, 0xEA, 0x64, 0x10, 0xEC, 0xFF, 0x02, 0x62,
-    0x2E, 0xB5, 0xDB, 0xD2, 0xA4, 0xDA, 0x24, 0xB6, 0xCF, 0xBC, 0xE1, 0xD1, 0x1D, 0xCA, 0xC3, 0xA9,
-    0xC5, 0x99, 0xC5, 0x46, 0x5E, 0xA4, 0xE9, 0x46, 0xE6, 0x76, 0x2B, 0x38, 0x9A, 0xEB, 0x06, 0xA6,
-    0x87, 0x3A, 0xD0, 0xB7, 0x19, 0xD1, 0x1F, 0xDE, 0x77, 0xE4, 0x93, 0xEB, 0x67, 0x1B, 0xB2, 0x33,
-    0xA2, 0x87, 0x95, 0x95, 0x11, 0x04, 0x07, 0xB4, 0x30, 0x32, 0x4E, 0xCE, 0x6E, 0x7D, 0x1E, 0x4C,
-    0x05, 0xD0, 0xCF, 0x92, 0xBC, 0x25, 0xEE, 0x04, 0x73, 0x63, 0x97, 0xDF, 0x24, 0x40, 0xFD, 0xC5,
-    0xEB, 0x5D, 0x6B, 0xF5, 0x13, 0x48, 0x4A, 0x12, 0x4F, 0x91, 0xCB, 0xBA, 0xF6, 0xCE, 0x1F, 0xB7,
-    0xBA, 0x9D, 0xC1, 0x3E, 0xBD, 0xFB, 0x8A, 0xC2, 0xA9, 0x2D, 0xE8, 0xED, 0x8A, 0x19, 0xB6, 0xEE,
-    0x9F, 0x60, 0x9E, 0xC6, 0x18, 0x9F, 0xBF, 0x33, 0x6C, 0x6E, 0x8F, 0x1F, 0x55, 0xDB, 0xE3, 0x17,
-    0x8D, 0x91, 0xBC, 0xDC, 0x0C, 0x64, 0xC6, 0x12, 0xE0, 0x30, 0x9B, 0xC7, 0x91, 0x5A, 0xED, 0x02,
-    0x13, 0x54, 0x66, 0xC1, 0xC3, 0x4F, 0xCE, 0x4E, 0xAE, 0xBF, 0x08, 0x83, 0x13, 0x3B, 0x59, 0x38,
-    0xD7, 0x5D, 0x60, 0xCC, 0x0B, 0xB1, 0x6F, 0x85, 0xD3, 0x49, 0xB0, 0xFC, 0x0C, 0xFF, 0x93, 0x6B,
-    0x58, 0x60, 0x44, 0x38, 0x4C, 0x6C, 0x71, 0x5B, 0x4D, 0x3E, 0x62, 0xD9, 0x9E, 0x0C, 0xC9, 0xB5,
-    0x5A, 0x8D, 0x0F, 0x11, 0x17, 0x91, 0x0E, 0x16, 0xC5, 0xAB, 0x97, 0xAF, 0x62, 0xFB, 0x46, 0x7F,
-    0x76, 0x7A, 0x87, 0x9D, 0xFD, 0x50, 0x20, 0xBF, 0xB6, 0x39, 0xB1, 0xF4, 0x02, 0xEE, 0x3B, 0xA7,
-    0xF8, 0x88, 0x04, 0xBD, 0xF9, 0x1E, 0xED, 0x98, 0x4F, 0x84, 0x13, 0x7B, 0x6C, 0x9D, 0x5B, 0x91,
-    0x07, 0xCE, 0x3C, 0x67, 0xC5, 0x4E, 0xFB, 0x7C, 0x7F, 0xDE, 0x0D, 0x5F, 0xE7, 0x36, 0x74, 0xE6,
-    0x38, 0x88, 0x7E, 0xF1, 0x59, 0xE1, 0x2D, 0x8B, 0x9C, 0xB1, 0x98, 0xAF, 0x4F, 0xD7, 0xA7, 0x89,
-    0x1B, 0x3E, 0xC3, 0x93, 0xCA, 0x49, 0x81, 0xDE, 0x28, 0xD4, 0x6F, 0x5D, 0x99, 0xC8, 0xE6, 0x4A,
-    0x62, 0xE8, 0x6E, 0xBE, 0x37, 0x5C, 0xD9, 0xBD, 0x32, 0x91, 0xAB, 0x6F, 0x4D, 0xF4, 0x0F, 0xBE,
-    0xE4, 0x41, 0xFE, 0xBD, 0x38, 0xE6, 0x4D, 0xEB, 0x1C, 0x2C, 0x28, 0xE7, 0x28, 0xC7, 0x5B, 0x09,
-    0x4F, 0x85, 0x77, 0xB3, 0xDF, 0x8E, 0xD7, 0x2B, 0xB2, 0xA3, 0x0F, 0x28, 0x4B, 0x72, 0xA8, 0x91,
-    0x81, 0xE9, 0xF4, 0x73, 0x7F, 0x02, 0xCD, 0x7C, 0x4D, 0xAC, 0x16, 0xD7, 0x99, 0xE6, 0xA9, 0x2A,
-    0x73, 0x2B, 0x71, 0x4D, 0x4F, 0x79, 0x61, 0x2B, 0xDD, 0x58, 0x4A, 0x45, 0xA3, 0x2C, 0xD2, 0x4C,
-    0xDB, 0xB5, 0xE9, 0xC5, 0x8C, 0xE4, 0xCE, 0x29, 0x1B, 0xA9, 0x59, 0xB0, 0x00, 0xA9, 0x21, 0x59,
-    0x78, 0x41, 0x16, 0x59, 0x24, 0x9E, 0x19, 0x91, 0x45, 0x2F, 0xAC, 0x56, 0x37, 0x55, 0x60, 0xCD,
-    0x78, 0x61, 0x69, 0x8C, 0x46, 0xED, 0xE9, 0x45, 0xA4, 0x31, 0x0B, 0x22, 0xE1, 0x9B, 0x05, 0x96,
-    0xC6, 0x8B, 0xD6, 0xC8, 0xE6, 0x14, 0x5C, 0xB5, 0x58, 0xB0, 0xA0, 0x30, 0x4D, 0xB3, 0xC8, 0x82,
-    0x32, 0xD8, 0x71, 0xC7, 0x2C, 0x28, 0xA0, 0x30, 0x05, 0xB7, 0xEA, 0x9C, 0x79, 0x9E, 0xF7, 0xD4,
-    0xF7, 0xDD, 0x7B, 0x01, 0x33, 0x89, 0x7F, 0xA4, 0xC1, 0xFE, 0x3E, 0xB8, 0xF7, 0xAB, 0x3A, 0xF5,
-    0x9E, 0xF7, 0xF7, 0x79, 0x7F, 0xCE, 0xA7, 0x14, 0xFE, 0x64, 0x0D, 0x5E, 0xB5, 0x52, 0x39, 0xFE,
-    0xFD, 0x17, 0xFC, 0x85, 0x4A, 0x9C, 0x53, 0xDA, 0x8D, 0xCA, 0xB9, 0x2E, 0xBE, 0xB7, 0x5F, 0xE5,
-    0xF8, 0xD0, 0x29, 0x15, 0x0D, 0xB8, 0xCE, 0x4D, 0xAA, 0x74, 0x5D, 0xE8, 0x5C, 0x9D, 0xDE, 0xD9,
-    0xA7, 0x74, 0xA5, 0x82, 0x09, 0xD7, 0x77, 0xCA, 0x5F, 0xE4, 0xBA, 0x08, 0x9F, 0x64, 0xCE, 0x2A,
-    0x15, 0x60, 0x1D, 0x9D, 0x15, 0xC1, 0x38, 0xA9, 0xE8, 0x6A, 0xE7, 0x7F, 0xFE, 0x5A, 0x56, 0x2E,
-    0x9D, 0xBB, 0xEA, 0x9C, 0xDB, 0xE3, 0xDC, 0xF8, 0x4C, 0x79, 0x69, 0xEF, 0xF2, 0x7E, 0xEC, 0xC2,
-    0xB8, 0x0A, 0x57, 0x35, 0x29, 0xAE, 0xD4, 0x87, 0xDD, 0x8B, 0x93, 0xB2, 0x49, 0x17, 0x0D, 0xBA,
-    0xCE, 0x5A, 0xAB, 0xDC, 0xAE, 0xDE, 0x8D, 0xF9, 0x9A, 0xAB, 0x4D, 0x3A, 0xAA, 0x8D, 0x3F, 0xBA,
-    0x56, 0xE1, 0xE8, 0xF7, 0x3F, 0x3C, 0x8A, 0x42, 0x7E, 0x60, 0xF0, 0x04, 0x5C, 0x93, 0xB6, 0x4A,
-    0x95, 0x85, 0x5C, 0x9E, 0x82, 0x2C, 0x50, 0xA8, 0x40, 0x61, 0xDC, 0xAB, 0xCD, 0xDB, 0x48, 0x9B,
-    0x79, 0xE1, 0xD8, 0xB5, 0x20, 0x75, 0x0C, 0x9C, 0x1B, 0x22, 0xAB, 0xDE, 0x4D, 0x49, 0xE2, 0xBC,
-    0x19, 0xFD, 0xD9, 0x09, 0x7E, 0x24, 0x2F, 0xB3, 0x7A, 0x5C, 0x99, 0x42, 0x16, 0x56, 0x25, 0x3F,
-    0x6B, 0x57, 0xC0, 0x0A, 0x27, 0x64, 0x04, 0x60, 0xC9, 0xE2, 0x4F, 0xE0, 0x7A, 0x90, 0xD4, 0xE4,
-    0x6E, 0x8C, 0xA6, 0x95, 0xA2, 0xAC, 0xE4, 0xB9, 0xB8, 0x21, 0x72, 0x85, 0xCA, 0x70, 0x59, 0x89,
-    0x1F, 0x1D, 0x7E, 0xC4, 0x3F, 0xB3, 0x56, 0x05, 0x76, 0xA5, 0xD0, 0x8D, 0x71, 0x23, 0x97, 0xC9,
-    0x5D, 0x25, 0x4B, 0x18, 0x6C, 0x36, 0x6D, 0xE3, 0x1E, 0x1B, 0xC0, 0x16, 0xAB, 0x6C, 0xD3, 0x3F,
-    0x9B, 0xA4, 0x8F, 0x16, 0xFF, 0x14, 0xE2, 0x2F, 0x37, 0xF9, 0xC9, 0xEA, 0xFD, 0xF7, 0x55, 0x51,
-    0x28, 0x11, 0x02, 0xD8, 0x64, 0xF9, 0x48, 0x90, 0xEF, 0xB8, 0x4F, 0xF0, 0xA2, 0x2C, 0x70, 0x37,
-    0x18, 0xA1, 0x2B, 0x08, 0x2A, 0xEE, 0x96, 0x1F, 0xC9, 0x0A, 0x78, 0x23, 0x9F, 0x70, 0x1B, 0x99,
-    0x82, 0xCD, 0x91, 0x5C, 0xE3, 0x19, 0x67, 0xB7, 0x7C, 0x3C, 0x0A, 0x27, 0x1F, 0xFA, 0x38, 0x1E,
-    0x21, 0x05, 0x48, 0x13, 0xEB, 0x63, 0x81, 0xA7, 0x84, 0x03, 0x60, 0x01, 0x35, 0x81, 0x4C, 0xD1,
-    0xD8, 0x17, 0xAE, 0xBB, 0x44, 0x96, 0x25, 0x1D, 0x25, 0x13, 0x0D, 0x11, 0x3F, 0x9E, 0x02, 0xBB,
-    0x17, 0x0F, 0xA4, 0x2A, 0x80, 0x22, 0x0A, 0x32, 0x6D, 0xD3, 0x75, 0x57, 0xC5, 0x7D, 0xDC, 0xA7,
-    0x5D, 0x38, 0x86, 0xA3, 0x6C, 0xD4, 0xE0, 0x55, 0x56, 0xBA, 0xD6, 0xFF, 0x54, 0x82, 0x27, 0xE5,
-    0x45, 0xD7, 0xC6, 0x10, 0xB8, 0xA8, 0x5F, 0xAB, 0x5B, 0x3C, 0xE4, 0xE8, 0x82, 0xF1, 0x86, 0x1B,
-    0x93, 0x7B, 0xB0, 0x92, 0xDF, 0x8C, 0xA7, 0x5E, 0xC8, 0x15, 0xF2, 0x6B, 0x90, 0x0D, 0xEA, 0x1C,
-    0x9E, 0xC2, 0xF7, 0x3A, 0x97, 0x77, 0x70, 0xF3, 0xB4, 0xC3, 0x0D, 0x36, 0x9C, 0xB2, 0x26, 0xEE,
-    0x93, 0xDE, 0x14, 0x79, 0xA3, 0xCF, 0xE0, 0xC6, 0xD0, 0xA5, 0xD4, 0xE6, 0x4E, 0x57, 0xD0, 0xD4,
-    0x17, 0xA9, 0xF6, 0x47, 0x1F, 0xAF, 0xD5, 0x47, 0x71, 0x75, 0x8B, 0x6B, 0x1B, 0x68, 0xF5, 0x61,
-    0xEC, 0x30, 0xE9, 0xE2, 0x1E, 0x5A, 0xDD, 0x58, 0x65, 0x62, 0x08, 0x2E, 0xC7, 0x16, 0x8C, 0x68,
-    0x90, 0xFC, 0xC9, 0xC8, 0x0D, 0xE1, 0x05, 0x7F, 0x28, 0x36, 0xB6, 0x91, 0x76, 0x09, 0xC8, 0x09,
-    0x2C, 0x56, 0xD5, 0x75, 0x38, 0x52, 0x76, 0x67, 0x60, 0x9D, 0x03, 0xB4, 0x49, 0x83, 0xD1, 0x31,
-    0x98, 0x85, 0x87, 0xD5, 0x2A, 0xFD, 0x1C, 0x77, 0x5A, 0x7C, 0x9C, 0x35, 0x50, 0xC2, 0x29, 0x1E,
-    0xC8, 0xC9, 0x3A, 0x22, 0xE7, 0xBC, 0xDA, 0x90, 0x3A, 0x6F, 0x2C, 0x90, 0x97, 0xCA, 0xA9, 0x5E,
-    0xB4, 0xA9, 0x68, 0xD6, 0xFD, 0x53, 0xD0, 0xE2, 0xB4, 0x49, 0x2C, 0x84, 0xE1, 0x9A, 0xAC, 0xD6,
-    0x60, 0x7A, 0x02, 0x8B, 0xAC, 0x2C, 0x44, 0xA4, 0xCB, 0xAA, 0x4C, 0x6E, 0xF7, 0x71, 0x37, 0x42,
-    0x46, 0xFA, 0x8D, 0x2E, 0xFD, 0xB4, 0xC3, 0x75, 0x53, 0xDA, 0x64, 0xAE, 0x9A, 0x42, 0xD7, 0xE1,
-    0xF2, 0x09, 0x32, 0x72, 0x95, 0xAE, 0x74, 0x17, 0xF5, 0x31, 0xB8, 0xA3, 0xD4, 0x36, 0xB5, 0x4F,
-    0x05, 0x43, 0x0A, 0xCA, 0x2E, 0x53, 0x00, 0xD0, 0x10, 0xF5, 0xF3, 0x25, 0x01, 0xBA, 0x2E, 0x0B,
-    0xA8, 0x6F, 0x2F, 0xEA, 0x9B, 0x37, 0xB8, 0x19, 0x3A, 0x58, 0x43, 0x3A, 0x13, 0x18, 0x91, 0x5E,
-    0xE3, 0x9E, 0xA8, 0x7F, 0x8E, 0x26, 0x8B, 0x1F, 0x42, 0x5A, 0x03, 0x2D, 0x91, 0xA6, 0xA2, 0x4C,
-    0x0D, 0x4B, 0xC3, 0x0F, 0x86, 0xBE, 0xC6, 0xA9, 0xCD, 0x42, 0x17, 0xE1, 0x5A, 0x31, 0x89, 0x78,
-    0x80, 0xBC, 0xCB, 0x42, 0xD7, 0x74, 0x27, 0xA2, 0x39, 0xB4, 0x23, 0xA8, 0xBD, 0xBF, 0x2E, 0x94,
-    0xEB, 0x20, 0x8F, 0x68, 0x08, 0x41, 0x6F, 0x91, 0xF3, 0x3A, 0x27, 0x7E, 0x04, 0x4E, 0xC4, 0xD1,
-    0x1B, 0xD2, 0x59, 0x50, 0x9E, 0x22, 0x25, 0xE1, 0x9A, 0xCA, 0x20, 0xA2, 0xD4, 0xD2, 0x51, 0x54,
-    0x2A, 0x5A, 0x87, 0x06, 0x4D, 0xA0, 0xCE, 0x6A, 0x5C, 0x82, 0x8D, 0xEA, 0xD7, 0xC0, 0xFD, 0x7A,
-    0x82, 0xCA, 0xE9, 0x22, 0xB9, 0x77, 0xA0, 0xC1, 0x72, 0x43, 0xC8, 0x95, 0xA8, 0x59, 0x06, 0x2B,
-    0xE8, 0x2A, 0x84, 0xDC, 0x71, 0x6D, 0x4B, 0x17, 0x65, 0x5C, 0x3F, 0x3B, 0x3E, 0x55, 0xEE, 0xDF,
-    0xBB, 0xD9, 0x43, 0xE1, 0x16, 0x50, 0x50, 0x40, 0x25, 0x95, 0x8B, 0x6D, 0x34, 0xC4, 0x43, 0xD6,
-    0x64, 0x2D, 0x78, 0xFF, 0xD2, 0x98, 0x8C, 0xA2, 0x52, 0xCE, 0x42, 0x77, 0x71, 0xA5, 0xB1, 0x05,
-    0x9D, 0x1E, 0x5E, 0x63, 0x60, 0x5F, 0x1E, 0x83, 0x31, 0x9C, 0xBC, 0xB9, 0xC0, 0xB2, 0xFC, 0x3E,
-    0x0A, 0x78, 0x93, 0x2A, 0xED, 0x0E, 0xB6, 0x69, 0x87, 0xFF, 0xF0, 0x9E, 0x35, 0x69, 0x97, 0xD7,
-    0x65, 0xAB, 0xE9, 0x70, 0xF1, 0xB9, 0xA6, 0x85, 0x1A, 0xEF, 0xAA, 0x85, 0x96, 0xB7, 0xF6, 0x06,
-    0xA3, 0xDF, 0x2F, 0x4C, 0x9D, 0x96, 0xFD, 0x08, 0x6F, 0xF9, 0xB0, 0x4B, 0x25, 0x73, 0x48, 0x12,
-    0x96, 0x68, 0xE1, 0xE0, 0xB0, 0x68, 0x60, 0x7F, 0x4C, 0x39, 0xF2, 0x36, 0xD8, 0x2C, 0x3E, 0xC1,
-    0x1E, 0xE0, 0x73, 0xB0, 0x1A, 0x49, 0xE4, 0xCA, 0x8E, 0x0B, 0xE1, 0x13, 0x8A, 0x01, 0x16, 0x80,
-    0x47, 0x8A, 0xFC, 0x12, 0x8A, 0x0B, 0xA4, 0x39, 0xEE, 0xD5, 0x39, 0xB1, 0xCF, 0xC3, 0xF4, 0xF7,
-    0x8D, 0x21, 0x5D, 0xE2, 0xFD, 0x49, 0x84, 0x7D, 0x90, 0xEE, 0x4D, 0x24, 0x81, 0x3D, 0x4D, 0x2C,
-    0x7E, 0x14, 0x5E, 0x60, 0x7F, 0xB1, 0x34, 0x4B, 0xE5, 0xE9, 0xF6, 0xF1, 0x22, 0x20, 0xAD, 0x30,
-    0x85, 0x14, 0x2C, 0x81, 0xCA, 0xEA, 0x02, 0x4E, 0xDD, 0x06, 0x23, 0x6C, 0x07, 0xCA, 0xCF, 0xE7,
-    0x40, 0xF5, 0x5F, 0x13, 0x5E, 0xD8, 0x1C, 0x37, 0xA7, 0x97, 0xEF, 0x58, 0xEF, 0xC6, 0x3A, 0xF1,
-    0x69, 0xCE, 0x47, 0x1E, 0x5A, 0x51, 0x79, 0xE5, 0x3A, 0x98, 0x14, 0x8F, 0xE5, 0x1E, 0x3E, 0xFE,
-    0xC3, 0x91, 0xF7, 0xC2, 0x18, 0xC1, 0xA6, 0x1C, 0x52, 0x67, 0x54, 0x50, 0x13, 0x76, 0x96, 0xC2,
-    0x86, 0xB8, 0xBB, 0x8A, 0x1A, 0x28, 0x3C, 0x5B, 0x71, 0x83, 0x84, 0x14, 0xA8, 0x4A, 0x50, 0x65,
-    0x33, 0xCF, 0x9D, 0xF0, 0xFC, 0xD7, 0x74, 0xA5, 0xE0, 0x0B, 0x5E, 0xCF, 0x98, 0x66, 0xD6, 0x0C,
-    0x46, 0xB5, 0xA7, 0x15, 0xC2, 0xC4, 0x49, 0x17, 0x8A, 0x80, 0xED, 0x37, 0x64, 0xBE, 0xC1, 0xDE,
-    0x6D, 0x78, 0x64, 0x08, 0x61, 0xDD, 0xA3, 0xD3, 0x84, 0x87, 0x51, 0xDB, 0x8F, 0x7E, 0x43, 0xCF,
-    0xFA, 0xDA, 0xFD, 0x1C, 0x58, 0x33, 0x78, 0x4D, 0xA4, 0x86, 0x07, 0x13, 0x14, 0x11, 0x01, 0x87,
-    0x61, 0x8F, 0x81, 0x0F, 0x3E, 0x20, 0xE9, 0xC4, 0x09, 0x49, 0x84, 0x74, 0x60, 0x76, 0xC4, 0x65,
-    0xA0, 0x20, 0x70, 0xCE, 0xFC, 0x09, 0x8E, 0x03, 0x04, 0x69, 0x3A, 0x12, 0xD7, 0x05, 0x13, 0xB0,
-    0x80, 0x37, 0x7F, 0x7A, 0x99, 0x46, 0x95, 0xD0, 0xB9, 0x22, 0x82, 0xD6, 0x4D, 0x2A, 0xB3, 0x0C,
-    0xE2, 0xAE, 0x0F, 0x19, 0x8B, 0xEA, 0xF4, 0x46, 0xA5, 0x11, 0xB0, 0x0F, 0x05, 0xF7, 0x07, 0x35,
-    0x0E, 0xE9, 0xF9, 0x36, 0xBE, 0xDD, 0x1D, 0xD2, 0x45, 0xFE, 0xE6, 0xDA, 0x4D, 0x78, 0x1B, 0x9D,
-    0xBD, 0x81, 0x1D, 0x8F, 0x23, 0xC8, 0x5C, 0xBB, 0xDB, 0x62, 0xE3, 0xA9, 0x8B, 0xBA, 0x70, 0xC8,
-    0x87, 0xAC, 0x4E, 0x1B, 0x03, 0x07, 0xA1, 0x43, 0xD8, 0x7A, 0x00, 0xCD, 0x4B, 0x45, 0x53, 0x69,
-    0xA8, 0xE2, 0xA5, 0x48, 0x59, 0x44, 0x93, 0x01, 0xF9, 0xB5, 0xD0, 0x6A, 0x18, 0x7A, 0x68, 0xDD,
-    0x08, 0x8A, 0x8C, 0x32, 0x77, 0x7E, 0x34, 0x6D, 0x5C, 0x37, 0xD1, 0xA5, 0xD6, 0xB2, 0x0B, 0x03,
-    0xEB, 0x62, 0xDC, 0x59, 0xF8, 0x7E, 0x90, 0x29, 0x9E, 0x85, 0x71, 0x13, 0x8E, 0xC5, 0xC2, 0x9D,
-    0xEA, 0xD3, 0xD8, 0x5C, 0x6F, 0xC0, 0x4A, 0x30, 0xA3, 0x3C, 0xD0, 0xAA, 0xFC, 0x72, 0xAF, 0x92,
-    0x5B, 0x60, 0xFD, 0x68, 0x8A, 0xC0, 0x82, 0x27, 0x66, 0x17, 0xD9, 0xE1, 0x2A, 0x03, 0x19, 0xBA,
-    0x96, 0xC1, 0x16, 0x3A, 0x59, 0xCD, 0xDC, 0xF0, 0xC6, 0x37, 0x8A, 0x8B, 0xCB, 0x3E, 0x79, 0xF9,
-    0xD1, 0x3E, 0x97, 0x5C, 0xCD, 0x9B, 0xAD, 0x3E, 0x77, 0x5C, 0xF8, 0x5C, 0x0F, 0x61, 0x52, 0x52,
-    0x49, 0x83, 0xBE, 0x47, 0xCB, 0x6A, 0xF0, 0xC2, 0x6D, 0x07, 0x06, 0x71, 0x65, 0xDE, 0x9D, 0xE1,
-    0x95, 0x0C, 0xF1, 0x7D, 0xD3, 0x25, 0xDE, 0x69, 0x16, 0xE9, 0xFD, 0xA3, 0x1B, 0x30, 0xB8, 0xF6,
-    0x96, 0x43, 0x1B, 0x59, 0xC6, 0xD4, 0xC7, 0xA1, 0x39, 0xBC, 0xCA, 0xF9, 0x5A, 0x33, 0xBF, 0x1E,
-    0x87, 0xE6, 0xC0, 0xEE, 0x73, 0xD8, 0x26, 0x76, 0xF9, 0x5F, 0x0F, 0xDC, 0xD9, 0xEB, 0x71, 0x85,
-    0x60, 0xDD, 0x7C, 0x46, 0x43, 0x4B, 0xCC, 0x44, 0x45, 0x99, 0x3F, 0xC6, 0x76, 0x72, 0x8F, 0x99,
-    0xBE, 0xA1, 0x88, 0x37, 0xA3, 0xCC, 0xD1, 0x47, 0x3F, 0xA5, 0x9E, 0x75, 0xF7, 0x44, 0x24, 0x9D,
-    0x00, 0x1B, 0xE5, 0xFE, 0xC7, 0x58, 0x76, 0xA6, 0x38, 0x15, 0xC1, 0x1D, 0xE9, 0xA2, 0x3C, 0xD0,
-    0xC0, 0x0A, 0x2F, 0xD3, 0x03, 0xDD, 0xA4, 0x09, 0xE2, 0x97, 0x36, 0xB4, 0xE9, 0xA4, 0x77, 0x39,
-    0x25, 0x97, 0xA7, 0x12, 0xF4, 0x0E, 0xBA, 0x8F, 0x95, 0xB8, 0x56, 0xD0, 0x41, 0x46, 0x6E, 0xE3,
-    0x9B, 0xAE, 0x60, 0x67, 0x02, 0x99, 0x80, 0x86, 0x1A, 0x6C, 0xCE, 0xC0, 0x9D, 0x77, 0x20, 0x24,
-    0xB9, 0x8B, 0x87, 0x47, 0x8C, 0x20, 0x11, 0x5D, 0x69, 0x48, 0x37, 0x11, 0x91, 0x74, 0x71, 0x18,
-    0xF9, 0x0D, 0x86, 0x8A, 0x37, 0xC9, 0x11, 0xDC, 0x1A, 0xD1, 0x58, 0x13, 0x08, 0x12, 0xFB, 0xA2,
-    0xB5, 0xD6, 0xA1, 0x7D, 0x38, 0x68, 0xF7, 0x8F, 0x0D, 0xDA, 0xD1, 0x03, 0x0A, 0x84, 0xEB, 0x18,
-    0x43, 0x5D, 0xAF, 0xE7, 0x38, 0x21, 0x8E, 0x59, 0x79, 0xD8, 0x4F, 0xF1, 0xF0, 0x2E, 0x5C, 0x5C,
-    0x16, 0xE9, 0x55, 0x5C, 0xBF, 0x07, 0x1A, 0x08, 0x55, 0xBB, 0x09, 0xAD, 0x7F, 0x1D, 0x8B, 0xE6,
-    0x40, 0xD0, 0xE5, 0x27, 0xA6, 0xC6, 0x7D, 0xD4, 0x11, 0x75, 0xF2, 0xE4, 0xA6, 0x08, 0x31, 0x87,
-    0x91, 0x39, 0x9D, 0x81, 0x71, 0x16, 0xB4, 0x3E, 0x98, 0x6A, 0x9B, 0xB6, 0x34, 0x29, 0xDA, 0x57,
-    0x88, 0x80, 0x2B, 0x0E, 0xC4, 0x08, 0x2D, 0xBA, 0xCE, 0xE5, 0xE3, 0x74, 0xF9, 0x71, 0xE8, 0x3F,
-    0x76, 0x12, 0xE6, 0x68, 0x95, 0x9B, 0x3E, 0xC6, 0x0E, 0x42, 0xC0, 0x42, 0xE5, 0xB9, 0x0F, 0x87,
-    0xC8, 0xF7, 0x46, 0x22, 0x9E, 0x3C, 0x90, 0xF1, 0x88, 0x2B, 0xC2, 0x0D, 0xE0, 0x16, 0x3E, 0x92,
-    0x46, 0x80, 0x47, 0x4E, 0xF3, 0x23, 0xFD, 0x8A, 0x5F, 0xF8, 0xB1, 0x3C, 0x72, 0xBE, 0x1F, 0x1F,
-    0x77, 0xFE, 0x63, 0xFF, 0x48, 0xFE, 0x19, 0xE5, 0x81, 0x36, 0x93, 0x1F, 0xC4, 0x64, 0x68, 0x18,
-    0x0B, 0xA0, 0x13, 0xF9, 0x7C, 0xEB, 0x1D, 0x68, 0x7E, 0x15, 0xC2, 0x08, 0x52, 0x10, 0xF5, 0x4C,
-    0xB9, 0x29, 0xF3, 0xFB, 0x84, 0x9A, 0xD6, 0x08, 0x80, 0xB9, 0x4F, 0xE7, 0x0F, 0x4C, 0x1C, 0x4E,
-    0x70, 0xAB, 0x3D, 0xF9, 0x60, 0x63, 0x4B, 0x17, 0x93, 0x89, 0x7F, 0x3A, 0x2A, 0x4C, 0x4D, 0x16,
-    0xB0, 0xBB, 0x55, 0xC2, 0x0F, 0x25, 0xF8, 0x4C, 0x9C, 0x9C, 0xB0, 0xF7, 0x9F, 0x05, 0xAF, 0xC3,
-    0xAA, 0x09, 0xEA, 0x2B, 0xF8, 0x86, 0xEB, 0x0E, 0x9E, 0xCC, 0x41, 0x43, 0x3B, 0x02, 0x20, 0x0A,
-    0x9D, 0xD8, 0xB9, 0x2C, 0x90, 0x13, 0x22, 0xDE, 0x10, 0x3F, 0xE3, 0xD9, 0x0C, 0xE3, 0x08, 0xAC,
-    0x81, 0xDC, 0xF8, 0x85, 0x49, 0xDF, 0x25, 0xFA, 0x14, 0xE2, 0xFC, 0x0A, 0xAB, 0x16, 0x8E, 0x6E,
-    0x36, 0x1A, 0xC9, 0x97, 0xB2, 0xD8, 0x04, 0xA9, 0x26, 0x0F, 0xA9, 0x68, 0x51, 0xB0, 0x33, 0xEC,
-    0xAC, 0xA2, 0xAF, 0x0B, 0x8E, 0xE6, 0x58, 0x22, 0xE9, 0xFD, 0xB6, 0xF1, 0x7A, 0xE5, 0xD7, 0x03,
-    0xA3, 0x35, 0x3D, 0x94, 0x5A, 0x3D, 0xD9, 0xF9, 0x47, 0x10, 0xBE, 0xEB, 0xFA, 0x27, 0x01, 0x28,
-    0x27, 0x14, 0xC1, 0xC7, 0xB9, 0x6B, 0x36, 0x1B, 0x69, 0x5E, 0xD3, 0xF7, 0xA6, 0xF4, 0xD9, 0x58,
-    0x84, 0xCC, 0x61, 0x58, 0x89, 0xE1, 0x19, 0xE9, 0xAF, 0xC1, 0x32, 0xD8, 0x1F, 0xE0, 0x99, 0x29,
-    0x18, 0x1C, 0x61, 0x3B, 0x26, 0xA0, 0x1A, 0xE8, 0xDA, 0x30, 0x90, 0x75, 0xFA, 0x5F, 0x2C, 0xEE,
-    0x02, 0xBD, 0x55, 0x38, 0xC5, 0x3D, 0x1E, 0xE6, 0x02, 0x06, 0x3C, 0x53, 0x19, 0xBE, 0x70, 0x37,
-    0x77, 0x90, 0xB6, 0x02, 0x7A, 0xE0, 0xBD, 0x17, 0xDE, 0x59, 0xD1, 0x9C, 0x19, 0x03, 0x2D, 0x8D,
-    0xBB, 0x09, 0xDC, 0x4B, 0xA3, 0x3C, 0x8B, 0xBE, 0x54, 0x1C, 0x52, 0x34, 0xE2, 0xF2, 0xEC, 0xBE,
-    0x13, 0x20, 0xA5, 0x04, 0x4C, 0xB8, 0x83, 0x0D, 0x01, 0x0C, 0x0C, 0x15, 0x06, 0xEA, 0x24, 0x12,
-    0xC2, 0x64, 0xA8, 0xB0, 0xF4, 0xE2, 0x2A, 0x3F, 0x7C, 0x2C, 0x76, 0x57, 0x00, 0x1C, 0x11, 0x3D,
-    0xB2, 0x21, 0x6B, 0x73, 0x60, 0x32, 0x43, 0xC5, 0x82, 0x92, 0xB5, 0x50, 0xB8, 0xC2, 0x62, 0x5F,
-    0x88, 0xDE, 0xA9, 0x24, 0xFE, 0xA7, 0x54, 0x7E, 0xA7, 0xDF, 0x60, 0xC2, 0xCA, 0xFB, 0x70, 0x51,
-    0x75, 0xE2, 0xC6, 0xD0, 0xFD, 0xAE, 0x28, 0x1B, 0x72, 0x2E, 0x1C, 0x77, 0x28, 0x7D, 0x92, 0x7B,
-    0xEE, 0xCA, 0xD6, 0x25, 0x43, 0xD2, 0xB9, 0xA2, 0xA4, 0x3E, 0x3B, 0xFA, 0x0C, 0x30, 0x24, 0x1C,
-    0x63, 0x0B, 0xB9, 0x81, 0x3C, 0x33, 0xAF, 0xF4, 0x2C, 0x43, 0x3B, 0xCD, 0xBE, 0xC6, 0x7E, 0x40,
-    0xC1, 0x99, 0xE9, 0xE5, 0x81, 0xF4, 0xF8, 0x02, 0x02, 0x98, 0x0B, 0x15, 0x2C, 0x5F, 0xB2, 0x07,
-    0x40, 0xC3, 0x04, 0x31, 0xF8, 0x68, 0x70, 0xF0, 0x63, 0x25, 0x88, 0xBA, 0x0B, 0xC0, 0x6F, 0x6C,
-    0x24, 0x70, 0xF5, 0xB3, 0xCC, 0xCC, 0x2B, 0xE4, 0xE1, 0x10, 0x2E, 0xF6, 0x59, 0x98, 0x5F, 0x22,
-    0x5D, 0x1B, 0x02, 0x37, 0x2C, 0xC8, 0x4D, 0xC1, 0x47, 0xF1, 0x8B, 0xC3, 0x12, 0x0A, 0xA7, 0xDD,
-    0xCA, 0xC7, 0x00, 0x5E, 0xD7, 0x3B, 0x78, 0xD9, 0xAC, 0xD7, 0xB7, 0x60, 0x4D, 0xD0, 0xCC, 0x6B,
-    0x48, 0x21, 0xB0, 0xF7, 0x35, 0xD1, 0x53, 0x7C, 0x6C, 0xB8, 0x90, 0xCA, 0xA7, 0x25, 0xBD, 0x9A,
-    0x50, 0x7B, 0xC8, 0x1B, 0x87, 0xD4, 0xE0, 0x8D, 0x3E, 0xBF, 0x08, 0xBD, 0xA2, 0xCA, 0xFD, 0x8E,
-    0x4A, 0x2B, 0x8F, 0xFE, 0x0C, 0xC4, 0x42, 0x9E, 0xF2, 0x68, 0xEA, 0x18, 0x41, 0x4D, 0x9F, 0x74,
-    0x39, 0x18, 0x53, 0x5B, 0xC8, 0x33, 0x04, 0x82, 0x62, 0x54, 0xB9, 0x30, 0xD1, 0x48, 0x6D, 0xBE,
-    0x36, 0x08, 0x88, 0x75, 0x92, 0x61, 0xD3, 0x5F, 0xE4, 0xD7, 0xAD, 0x60, 0xC3, 0x52, 0xBC, 0xD5,
-    0x6E, 0xB8, 0xFD, 0xC0, 0xB4, 0x2E, 0xB2, 0x95, 0x86, 0x64, 0x72, 0xF0, 0x10, 0x18, 0xDD, 0xD4,
-    0xF3, 0xC6, 0x42, 0x73, 0x34, 0x65, 0x99, 0xC1, 0x06, 0x34, 0x67, 0xAB, 0x7E, 0x04, 0x81, 0xB4,
-    0x70, 0xE0, 0xC1, 0xCB, 0x03, 0xC9, 0x89, 0xC6, 0x53, 0x66, 0x80, 0x42, 0x94, 0xA2, 0x47, 0x4F,
-    0x1E, 0x7D, 0xF2, 0x28, 0x84, 0x9A, 0x35, 0xF9, 0x19, 0x09, 0x1A, 0xFA, 0x35, 0xC2, 0xBC, 0xA2,
-    0xDC, 0x05, 0xFA, 0x0C, 0x85, 0x94, 0xB7, 0x2E, 0x9E, 0x10, 0x2C, 0xEB, 0x72, 0xC4, 0x3A, 0x7B,
-    0xFC, 0x43, 0xF6, 0x06, 0x45, 0x5A, 0x8D, 0x6A, 0xCA, 0x2B, 0x06, 0xAE, 0x67, 0x19, 0x53, 0xBE,
-    0xDC, 0x4A, 0xE1, 0x89, 0xF0, 0x04, 0x54, 0x1F, 0xC8, 0x49, 0x37, 0x71, 0x67, 0xAA, 0xE4, 0x26,
-    0x94, 0x79, 0x7D, 0x14, 0x87, 0x94, 0x41, 0xB9, 0xF3, 0x2B, 0x08, 0x4A, 0x67, 0xC1, 0x62, 0x00,
-    0x75, 0x7D, 0x84, 0x99, 0x1C, 0x9D, 0x1F, 0xE2, 0xF9, 0xF6, 0xD5, 0x55, 0x48, 0xDF, 0xD2, 0x41,
-    0x28, 0x0D, 0xC5, 0x2F, 0xE9, 0x8C, 0xB1, 0xBB, 0x89, 0x18, 0x8B, 0x71, 0x86, 0x21, 0x86, 0x7E,
-    0x13, 0x4A, 0x46, 0x45, 0x83, 0x7B, 0x41, 0xB2, 0xEF, 0x9F, 0xB9, 0xAA, 0xB6, 0x9F, 0x00, 0xBA,
-    0x03, 0x0B, 0xFA, 0xD8, 0x1D, 0x86, 0xA4, 0x40, 0xD5, 0x61, 0xE4, 0xFE, 0xA7, 0xD2, 0x1B, 0xF5,
-    0x34, 0x1C, 0x3A, 0x15, 0xDF, 0xBE, 0x76, 0xBB, 0xCF, 0xCF, 0xBF, 0xFD, 0x66, 0x73, 0x4A, 0x8F,
-    0x65, 0xD4, 0xBB, 0xAB, 0x63, 0xBA, 0x06, 0xE1, 0x96, 0xE9, 0x80, 0x47, 0xE9, 0x7A, 0x24, 0xD9,
-    0xC7, 0xC0, 0x78, 0xD8, 0x98, 0x63, 0xAC, 0x65, 0xB9, 0x43, 0x5F, 0x32, 0x05, 0xDC, 0x2E, 0x6D,
-    0x3F, 0xBF, 0x54, 0x56, 0x8E, 0x86, 0xC2, 0xA7, 0x2F, 0x2E, 0x82, 0x48, 0x9F, 0xED, 0xB9, 0x2F,
-    0xBA, 0x1E, 0xF7, 0x1A, 0x55, 0xFB, 0xC3, 0x89, 0xB0, 0x2C, 0xBB, 0x38, 0x32, 0x6E, 0x7D, 0x81,
-    0x7E, 0x85, 0xC7, 0x80, 0xC7, 0x35, 0x97, 0x6D, 0xCA, 0x8F, 0x6C, 0x02, 0x2F, 0xE1, 0x80, 0x8F,
-    0xDB, 0xEC, 0xC2, 0xC4, 0x64, 0x93, 0xAC, 0x1E, 0x70, 0xEF, 0x6B, 0x30, 0x0B, 0x78, 0x3B, 0x41,
-    0xC1, 0x3F, 0x43, 0xF2, 0x3F, 0x4A, 0xD2, 0x08, 0x6D, 0xDF, 0x85, 0x90, 0x40, 0x84, 0x15, 0x7A,
-    0x8C, 0xD5, 0x93, 0x26, 0xF0, 0xA5, 0x4F, 0xFA, 0x74, 0xC8, 0x3A, 0xF1, 0x2B, 0x37, 0x5C, 0x91,
-    0x9D, 0x9B, 0x1E, 0xC2, 0x58, 0x66, 0x46, 0x1D, 0x2A, 0xC3, 0x32, 0x2E, 0x72, 0x53, 0x3A, 0x7C,
-    0x0B, 0xAE, 0x09, 0x97, 0xE1, 0x2A, 0x66, 0x75, 0x85, 0xBC, 0xD7, 0x4F, 0xE5, 0xEB, 0x9D, 0xEC,
-    0xAA, 0xF1, 0xD4, 0x06, 0x1F, 0x90, 0xDE, 0x92, 0x4E, 0xF0, 0x06, 0x44, 0x7D, 0xD5, 0x5D, 0x1C,
-    0x41, 0x35, 0x72, 0x52, 0x17, 0x58, 0xFA, 0x11, 0x24, 0x00, 0xA7, 0x09, 0x50, 0x06, 0x02, 0x7B,
-    0xB0, 0x13, 0x16, 0x8D, 0x1C, 0x0A, 0xC4, 0x53, 0x5C, 0xCC, 0xA9, 0x0C, 0x4B, 0x84, 0x4C, 0x64,
-    0x83, 0x13, 0xB0, 0x14, 0x46, 0x5E, 0xA8, 0x54, 0x13, 0xF5, 0xD8, 0x9A, 0x85, 0x3F, 0xA3, 0x26,
-    0x00, 0xE2, 0xC0, 0xB5, 0xC0, 0x60, 0x4B, 0xA4, 0x17, 0x80, 0xE5, 0x70, 0xE7, 0x8C, 0x5D, 0xF4,
-    0xD2, 0xF4, 0xE6, 0x83, 0x8F, 0x13, 0x8C, 0xEE, 0x21, 0x2C, 0x80, 0x4E, 0x22, 0xC1, 0x2B, 0xF0,
-    0xC9, 0x14, 0xC3, 0x87, 0xAF, 0xC3, 0xD4, 0x1E, 0x0C, 0xC8, 0x96, 0xFF, 0x13, 0x57, 0x83, 0x3E,
-    0x21, 0x2B, 0x07, 0x10, 0x35, 0x65, 0x6D, 0xD3, 0x8F, 0x6C, 0x5E, 0x4F, 0xC0, 0x6E, 0x59, 0x6D,
-    0xF5, 0x91, 0x31, 0xBD, 0x36, 0xE4, 0x87, 0x27, 0x48, 0x49, 0xAF, 0x4D, 0x7A, 0x4F, 0x9F, 0x11,
-    0x4E, 0xC1, 0x4D, 0x54, 0x3E, 0xAC, 0x70, 0x69, 0xE2, 0x7A, 0x41, 0x6B, 0x64, 0xA5, 0x54, 0x16,
-    0xB8, 0x30, 0x82, 0xEC, 0x2A, 0xD8, 0x84, 0x4C, 0xBD, 0x07, 0xAC, 0xB2, 0xF8, 0x55, 0x0E, 0x62,
-    0x63, 0x21, 0xB8, 0xF1, 0x04, 0x6B, 0x22, 0x4D, 0x16, 0xC7, 0x7E, 0x03, 0xA5, 0xFF, 0xC8, 0x32,
-    0x22, 0x30, 0x61, 0xEA, 0x7F, 0x3F, 0x93, 0xB2, 0x4C, 0x52, 0xCB, 0xC9, 0x9D, 0x81, 0xB0, 0xE5,
-    0x91, 0x2C, 0x34, 0x49, 0x8A, 0xF7, 0x64, 0xB5, 0xFD, 0x08, 0x75, 0x4B, 0xEE, 0x83, 0x9A, 0x98,
-    0x9D, 0x60, 0xA2, 0x5E, 0x73, 0x2C, 0x5D, 0xE5, 0x76, 0x52, 0x87, 0xB2, 0x7A, 0x6B, 0x49, 0x10,
-    0xCF, 0xAB, 0xB6, 0x57, 0x96, 0x2A, 0x8D, 0x67, 0xD6, 0xD8, 0xB5, 0xF7, 0xB7, 0x90, 0x0F, 0xFF,
-    0x81, 0xA4, 0x19, 0xD2, 0x71, 0xAC, 0xDA, 0xB1, 0xBA, 0x65, 0x89, 0x08, 0xF2, 0x16, 0x7B, 0x03,
-    0x0D, 0x2C, 0x6B, 0x32, 0xB2, 0x8F, 0xE6, 0x1E, 0xD2, 0xA5, 0xC8, 0xE6, 0x33, 0x4C, 0xFF, 0xCA,
-    0x4B, 0x0E, 0x5C, 0xD2, 0x1D, 0xC1, 0x92, 0x89, 0x44, 0x88, 0x72, 0x03, 0xC5, 0x88, 0x3C, 0xB7,
-    0x15, 0xDB, 0x57, 0x0B, 0x25, 0x21, 0x7D, 0x23, 0xBF, 0x86, 0xBA, 0x2A, 0x16, 0xA6, 0xCD, 0x75,
-    0x5A, 0xE1, 0xC0, 0xC5, 0x19, 0x10, 0xCD, 0x3F, 0x10, 0x84, 0x34, 0x8B, 0x20, 0x10, 0x1E, 0x87,
-    0x74, 0xB8, 0x73, 0x44, 0x5D, 0xC5, 0xCC, 0x4C, 0x49, 0x66, 0x8A, 0x00, 0x87, 0x00, 0x34, 0xA4,
-    0x0E, 0xEA, 0x86, 0xE8, 0x19, 0xB3, 0x9E, 0xB2, 0x1B, 0x22, 0x01, 0xC0, 0x44, 0xC4, 0x86, 0x45,
-    0xFF, 0xD6, 0x01, 0x5D, 0x38, 0x98, 0x1F, 0x9C, 0xAA, 0xAE, 0x97, 0x4B, 0x59, 0x31, 0x1C, 0x08,
-    0x9F, 0x6B, 0x80, 0x00, 0x06, 0xBD, 0xEB, 0xD0, 0x21, 0x7D, 0xBE, 0x83, 0x16, 0x45, 0x03, 0x9E,
-    0xCE, 0x98, 0xE5, 0x1F, 0xBE, 0xC2, 0xA0, 0xDD, 0xD0, 0x7B, 0xC6, 0xB3, 0x57, 0x8E, 0xE8, 0x3C,
-    0x46, 0x3A, 0x69, 0x46, 0xED, 0xEE, 0x6F, 0x60, 0xF0, 0xE0, 0xE7, 0xE4, 0xBD, 0x64, 0x60, 0x0A,
-    0x52, 0x44, 0x3F, 0xE9, 0x60, 0x30, 0xE5, 0x6B, 0xA0, 0x16, 0x2E, 0x26, 0xFD, 0x1C, 0xEA, 0x81,
-    0x45, 0xA1, 0x23, 0x08, 0xBB, 0x63, 0xFE, 0x29, 0xD8, 0xEC, 0x7D, 0xC2, 0xE9, 0x89, 0x05, 0x29,
-    0xF8, 0x12, 0xEC, 0x9A, 0xE5, 0xA9, 0xCC, 0x2E, 0xF2, 0x89, 0xD5, 0x77, 0xA0, 0x6C, 0x08, 0x17,
-    0x4C, 0xEB, 0x80, 0xAD, 0xE8, 0x30, 0xB9, 0x7F, 0x07, 0xB0, 0x53, 0x12, 0x94, 0x30, 0x16, 0xEF,
-    0x69, 0x99, 0x1B, 0x4A, 0x19, 0x13, 0x7B, 0xD6, 0x8D, 0x28, 0xB2, 0x54, 0x8A, 0x4E, 0x41, 0xCF,
-    0xB1, 0xE5, 0xDE, 0x03, 0xA9, 0x0A, 0x44, 0x43, 0x9B, 0x8E, 0x4C, 0x69, 0x07, 0xD4, 0x65, 0x5E,
-    0x9A, 0x10, 0xA9, 0x41, 0x4E, 0x64, 0xFF, 0x9E, 0xDC, 0xD0, 0xF5, 0x13, 0x89, 0x3D, 0x09, 0x3E,
-    0xD4, 0x0B, 0xCC, 0xF2, 0x27, 0x4F, 0xAA, 0xF4, 0x5C, 0x1B, 0xDF, 0xEA, 0xD5, 0x4F, 0x7E, 0xB0,
-    0xE4, 0x02, 0xDC, 0x07, 0x64, 0x0B, 0xCB, 0x4A, 0xAF, 0x4E, 0x49, 0x0F, 0x89, 0x6B, 0xD7, 0xA7,
-    0xF7, 0xF7, 0x52, 0x30, 0x4E, 0x3D, 0x95, 0xDF, 0x7F, 0x3F, 0x62, 0xA5, 0xC7, 0xCE, 0x55, 0x40,
-    0x72, 0x37, 0x95, 0xB4, 0xAF, 0x8E, 0xA7, 0x7D, 0xA2, 0xBB, 0xF7, 0x5C, 0xA1, 0x8D, 0xB8, 0x48,
-    0x73, 0xDA, 0xA6, 0xF0, 0xB9, 0xE0, 0x4C, 0xD6, 0x66, 0xA7, 0xC5, 0x45, 0xEA, 0x35, 0x71, 0x91,
-    0xB3, 0xCD, 0x18, 0x6F, 0xFF, 0x42, 0x9C, 0x32, 0xA3, 0xA4, 0x5B, 0xE5, 0x8C, 0xA7, 0xE8, 0x33,
-    0x9C, 0xD4, 0x4E, 0xA3, 0x76, 0x81, 0x2A, 0xB4, 0x6B, 0x00, 0x13, 0xD5, 0x13, 0x89, 0x2F, 0x86,
-    0x97, 0x1D, 0xC1, 0xA3, 0xB1, 0xAC, 0xEF, 0x13, 0x69, 0x60, 0x87, 0xA1, 0x3D, 0x58, 0xD1, 0x5F,
-    0x97, 0x76, 0x89, 0x07, 0x36, 0xBB, 0xCB, 0x86, 0x4B, 0x10, 0x20, 0xBC, 0xE5, 0x4B, 0x61, 0x4F,
-    0xE9, 0x75, 0x00, 0x67, 0x00, 0x45, 0xC1, 0x8F, 0xE6, 0x68, 0xCC, 0x32, 0xD8, 0x90, 0x35, 0xDF,
-    0xC3, 0x95, 0x19, 0xA1, 0x4F, 0x11, 0x3A, 0xD6, 0x20, 0xB0, 0xCD, 0x22, 0xED, 0xEE, 0x23, 0xCA,
-    0x43, 0x7A, 0x0B, 0xD9, 0xE5, 0x05, 0xE1, 0xB2, 0xFA, 0x29, 0xFE, 0xB9, 0x63, 0x23, 0x75, 0x5A,
-    0xB6, 0x10, 0x36, 0xFD, 0x33, 0x3A, 0x5B, 0x1D, 0x1A, 0xE3, 0x2B, 0xF5, 0xF7, 0x7F, 0x22, 0xD7,
-    0xE2, 0x26, 0xE4, 0xA7, 0x10, 0x2C, 0xB9, 0xC7, 0x22, 0x0C, 0xCB, 0x0D, 0x35, 0x61, 0x62, 0x05,
-    0xA1, 0x9A, 0xE5, 0xF2, 0xA2, 0xBA, 0xE0, 0xFB, 0x4F, 0xE5, 0xE7, 0x1D, 0x15, 0x99, 0x45, 0xDB,
-    0x10, 0x50, 0x45, 0x96, 0xF9, 0x9F, 0xC3, 0xF1, 0xE1, 0x9F, 0x9D, 0xF8, 0x9E, 0x1C, 0xC6, 0xD5,
-    0xB1, 0x68, 0xC2, 0x52, 0x2A, 0x82, 0xF4, 0x3B, 0x52, 0xAD, 0xA1, 0x9F, 0x63, 0x85, 0x07, 0xDA,
-    0xCB, 0xCC, 0x9C, 0x4F, 0x80, 0x76, 0x22, 0x75, 0x98, 0x88, 0xDA, 0x91, 0x27, 0x5F, 0x27, 0xC4,
-    0x84, 0xCB, 0xD7, 0x95, 0xA5, 0x32, 0xC2, 0xC6, 0xCE, 0x01, 0x21, 0xFE, 0x72, 0x34, 0xAC, 0xF2,
-    0x81, 0xF7, 0xCB, 0x8A, 0x44, 0x78, 0x62, 0xE5, 0x98, 0x92, 0x40, 0x8F, 0x0D, 0x31, 0x03, 0x67,
-    0xE9, 0x31, 0xC1, 0x9D, 0x44, 0xF4, 0xEE, 0xB8, 0xE4, 0x3E, 0x75, 0x49, 0xB7, 0x21, 0x71, 0x57,
-    0xD6, 0x44, 0x60, 0xC5, 0x8A, 0xC8, 0x8B, 0x0E, 0x20, 0x46, 0xE6, 0xFC, 0x24, 0x74, 0xFD, 0xB2,
-    0xAA, 0xFC, 0x95, 0xF5, 0x69, 0x59, 0xE0, 0xA7, 0x91, 0xC0, 0x3C, 0x82, 0x5E, 0x7D, 0x25, 0x64,
-    0x33, 0x6B, 0x22, 0xA3, 0xC9, 0x21, 0xAC, 0xD6, 0x7D, 0x69, 0x6C, 0xA5, 0x02, 0xF5, 0xB4, 0x8A,
-    0x3A, 0xAD, 0x88, 0xD3, 0xF0, 0xCC, 0x5A, 0x05, 0xA7, 0xBC, 0x57, 0xDE, 0x5E, 0xAD, 0x1C, 0x63,
-    0x0A, 0x1B, 0x4C, 0x4C, 0x4F, 0xF0, 0x60, 0xE6, 0x4A, 0xEC, 0xCA, 0x29, 0x03, 0x4E, 0xE6, 0xE7,
-    0x21, 0xD4, 0xBB, 0x6C, 0xFB, 0x0C, 0xBE, 0x5A, 0xC1, 0x92, 0x78, 0xC4, 0xBC, 0x1B, 0x01, 0x4C,
-    0x3C, 0x2C, 0xEB, 0x32, 0xC8, 0x9B, 0x84, 0x8D, 0xC4, 0xED, 0xDC, 0xFD, 0x97, 0xA0, 0xF1, 0x09,
-    0xDC, 0xE9, 0xC3, 0x15, 0x68, 0x8C, 0x3B, 0xE5, 0x6B, 0x46, 0x88, 0xED, 0xC8, 0xFB, 0xDE, 0xE8,
-    0xE9, 0x97, 0x98, 0x52, 0x33, 0x59, 0x00, 0x0A, 0x58, 0x63, 0xE9, 0x0B, 0xE9, 0x62, 0xDA, 0x33,
-    0x09, 0x35, 0x0D, 0x62, 0x44, 0x84, 0xAC, 0x14, 0x3E, 0x6A, 0x92, 0x84, 0xA2, 0x2F, 0xAB, 0xFC,
-    0xDC, 0x8D, 0x8B, 0x40, 0x82, 0xA5, 0x7E, 0x1B, 0xB9, 0xD2, 0xC0, 0x54, 0x0C, 0x41, 0x11, 0x98,
-    0x8B, 0x10, 0x5B, 0xE5, 0x7D, 0x46, 0xA5, 0x61, 0x51, 0x50, 0xED, 0x28, 0x5E, 0x51, 0xAF, 0xA4,
-    0x0C, 0x47, 0x6B, 0x20, 0x2E, 0xFD, 0x68, 0x22, 0x84, 0x2B, 0xE9, 0x0E, 0xB3, 0xBA, 0x3C, 0x3D,
-    0x81, 0x6C, 0x50, 0x3C, 0xE5, 0x23, 0x52, 0xF4, 0x03, 0x0E, 0x34, 0xDC, 0xB8, 0x72, 0x05, 0x3A,
-    0x73, 0x8D, 0x05, 0xA7, 0x0E, 0xE2, 0x4B, 0xFB, 0x9C, 0x51, 0x82, 0xEE, 0x70, 0x56, 0xA0, 0xED,
-    0xEE, 0x1D, 0xC9, 0x71, 0x80, 0xB9, 0xCB, 0x4B, 0x52, 0x8E, 0xD6, 0x92, 0x91, 0xD2, 0xCB, 0x02,
-    0xD3, 0xD4, 0xC2, 0x97, 0xEC, 0x02, 0x5D, 0xF4, 0x69, 0xB3, 0x26, 0x15, 0x0D, 0xA8, 0xFE, 0x3D,
-    0x15, 0x00, 0xDD, 0xA9, 0xE8, 0x36, 0xBB, 0x84, 0xEB, 0x2C, 0xDE, 0xD9, 0xAC, 0x53, 0x09, 0x63,
-    0x10, 0xF6, 0xF9, 0x49, 0xC1, 0x3C, 0x0B, 0x80, 0x0F, 0x81, 0x0C, 0x4C, 0xBD, 0x00, 0x42, 0x00,
-    0xA2, 0x24, 0x99, 0xD4, 0x55, 0xFE, 0xDB, 0x49, 0x17, 0xF8, 0xB4, 0x54, 0xF1, 0xD6, 0x4C, 0xD4,
-    0x48, 0x5D, 0xCC, 0x49, 0xD5, 0x99, 0x5D, 0x04, 0x3A, 0x77, 0xFB, 0xE2, 0xBB, 0xC1, 0xC8, 0xFA,
-    0x58, 0x38, 0x4A, 0x23, 0x8A, 0xF5, 0x6B, 0xB1, 0x97, 0x91, 0xE5, 0x42, 0x47, 0x2F, 0xC8, 0xF7,
-    0xF4, 0x8E, 0xD9, 0xBF, 0x97, 0xD5, 0x1F, 0x01, 0x49, 0xD4, 0xC4, 0xAC, 0xA1, 0x6F, 0x04, 0x9B,
-    0xDA, 0x15, 0xC8, 0x9D, 0x0D, 0x0B, 0xE9, 0x8F, 0x41, 0x65, 0x02, 0xD6, 0xA2, 0xBC, 0x92, 0x9D,
-    0x50, 0xD2, 0x7D, 0x60, 0xEF, 0x8C, 0xAD, 0xB3, 0x74, 0xF8, 0x63, 0xF0, 0x12, 0xFC, 0xBE, 0x6C,
-    0xF7, 0xD1, 0x1C, 0xA5, 0x82, 0x53, 0x67, 0x9F, 0xD8, 0xFD, 0xC8, 0x24, 0x19, 0xEA, 0xD2, 0xEE,
-    0x09, 0x44, 0xE3, 0x75, 0x04, 0xFE, 0xD2, 0x9D, 0x86, 0xDE, 0x2F, 0x1B, 0xAA, 0x6C, 0x02, 0x07,
-    0xC4, 0x45, 0xD4, 0xB9, 0x84, 0xDB, 0x9A, 0x3E, 0xC0, 0xD3, 0xCF, 0xB5, 0xAC, 0x13, 0x63, 0x67,
-    0x27, 0x3B, 0x29, 0xDC, 0x91, 0xD1, 0xAA, 0x34, 0xA6, 0x48, 0x6F, 0xDF, 0x86, 0x03, 0x2C, 0x01,
-    0x7F, 0xCF, 0x5D, 0x05, 0xA4, 0x45, 0xA4, 0xB5, 0xE9, 0x05, 0x30, 0x78, 0xCC, 0xD6, 0x06, 0xBC,
-    0x2B, 0xF5, 0x4A, 0xE5, 0x1B, 0xB0, 0x58, 0x2A, 0x5E, 0x47, 0x3E, 0x7A, 0x19, 0x56, 0x77, 0x16,
-    0x11, 0xEE, 0x7A, 0xC7, 0x84, 0x98, 0xCD, 0xCB, 0xE8, 0xFE, 0x7A, 0x1F, 0xDF, 0xFE, 0x7C, 0x48,
-    0xAF, 0xDD, 0x1A, 0xF3, 0xB3, 0x37, 0x47, 0xBD, 0xAB, 0xA3, 0x1B, 0x8D, 0x27, 0x0A, 0xD5, 0xB1,
-    0x60, 0x9C, 0xD3, 0x5B, 0x46, 0xEB, 0x2D, 0x80, 0x9D, 0x29, 0x59, 0x6F, 0xBA, 0x28, 0xA5, 0x16,
-    0xCD, 0xD2, 0xF3, 0xF5, 0x5E, 0x9A, 0x17, 0x08, 0xB0, 0xE0, 0x73, 0x7A, 0xA7, 0x74, 0x37, 0x2A,
-    0x9B, 0xDC, 0xFE, 0x7C, 0x4C, 0x1B, 0xAB, 0x0F, 0x9C, 0x96, 0x05, 0x91, 0xCA, 0x99, 0x74, 0x6D,
-    0x74, 0x49, 0x3B, 0x41, 0x2B, 0xA7, 0xF4, 0xE2, 0x5D, 0x7E, 0x1A, 0x1C, 0x57, 0x3B, 0x8E, 0xB2,
-    0x58, 0xD8, 0x46, 0x20, 0xA3, 0x8D, 0xBB, 0x68, 0x1D, 0x2A, 0x9C, 0xDC, 0xEE, 0xD2, 0x3B, 0x07,
-    0x3E, 0x25, 0x2A, 0x47, 0x00, 0xE4, 0x9A, 0xD9, 0x25, 0xEB, 0x88, 0x3A, 0xA7, 0x51, 0xBF, 0x76,
-    0x0F, 0x6F, 0xBB, 0x6F, 0x0D, 0xA3, 0x4E, 0x2F, 0xF6, 0xD8, 0xF4, 0x5A, 0x67, 0x45, 0x6C, 0xEC,
-    0xAE, 0x83, 0x50, 0x96, 0x05, 0x55, 0xF6, 0xC9, 0x01, 0xBA, 0x6F, 0x56, 0x2C, 0x24, 0x51, 0x4C,
-    0x3F, 0xED, 0x95, 0x37, 0xD2, 0x84, 0x35, 0xA0, 0x94, 0x35, 0x8D, 0xF8, 0xFE, 0xC4, 0x62, 0x83,
-    0xC9, 0xEB, 0x60, 0xD4, 0x60, 0x06, 0x60, 0x2E, 0x4C, 0x66, 0x57, 0x5F, 0x2A, 0x7D, 0x66, 0x64,
-    0x11, 0x46, 0xB0, 0x98, 0xAE, 0x21, 0x95, 0x1D, 0xAB, 0xAB, 0x15, 0x6B, 0xC2, 0x84, 0x8B, 0xEA,
-    0x10, 0xDB, 0x37, 0xB8, 0x3E, 0x60, 0x5B, 0x0C, 0xCA, 0xC2, 0xA1, 0x00, 0x29, 0x62, 0x8C, 0xA7,
-    0x3E, 0x50, 0xA7, 0xF4, 0x81, 0x4A, 0xA7, 0x67, 0x5B, 0xEE, 0x38, 0xFD, 0x70, 0x80, 0x35, 0x1B,
-    0x72, 0x06, 0xE0, 0xC1, 0x50, 0xB1, 0x58, 0x2D, 0x42, 0x92, 0xD1, 0xE8, 0x4B, 0x65, 0x13, 0x8C,
-    0x00, 0x5A, 0x6C, 0x5A, 0x03, 0x5E, 0xD3, 0xCF, 0x95, 0x8C, 0x8A, 0xCE, 0xF9, 0xCA, 0x35, 0xA1,
-    0x34, 0x99, 0x09, 0x4F, 0x79, 0xA7, 0xBC, 0x02, 0x31, 0x59, 0x78, 0x03, 0xE8, 0x79, 0x8B, 0x94,
-    0x98, 0x15, 0xBD, 0x35, 0x58, 0x64, 0x4E, 0x04, 0x0E, 0x09, 0x98, 0x9D, 0x4C, 0x7C, 0xDE, 0xEC,
-    0xCA, 0x9D, 0x43, 0x74, 0x87, 0x60, 0xA7, 0x0E, 0x8E, 0x93, 0x62, 0xBD, 0x13, 0x8F, 0x84, 0xD7,
-    0x63, 0xA1, 0x46, 0xC1, 0x9E, 0xC1, 0xD7, 0x8B, 0x90, 0xE5, 0x7E, 0x33, 0x4A, 0x4A, 0xDD, 0xF8,
-    0x6A, 0x68, 0xF6, 0x2F, 0xD6, 0xF5, 0xE1, 0xA0, 0x0F, 0xBC, 0x5D, 0xE9, 0xD7, 0xC1, 0xD5, 0xA8,
-    0x07, 0xA8, 0xAF, 0x75, 0xB6, 0xD6, 0x8D, 0xF1, 0xED, 0x81, 0xED, 0xBE, 0x40, 0xFD, 0xA9, 0x8A,
-    0x2E, 0x58, 0x15, 0xAE, 0xB3, 0x8D, 0x5F, 0x89, 0x42, 0x1A, 0x29, 0x0C, 0x4D, 0xEA, 0x55, 0xD6,
-    0x36, 0x99, 0x4E, 0x30, 0x30, 0xC6, 0x23, 0xD4, 0x12, 0xBE, 0xDC, 0x16, 0x34, 0x7A, 0xA0, 0x86,
-    0xCE, 0xE3, 0x53, 0xBA, 0x87, 0xB4, 0x17, 0xCC, 0x70, 0xD2, 0xB1, 0xB8, 0x0E, 0x7D, 0x87, 0xC8,
-    0xFF, 0xDE, 0x97, 0x30, 0xDD, 0xEA, 0x31, 0x59, 0x2E, 0x27, 0x1C, 0xDC, 0x0B, 0x4F, 0xF8, 0x6D,
-    0xF5, 0xBE, 0x7A, 0x1E, 0xA2, 0xFB, 0xE1, 0xA8, 0x56, 0xE4, 0x51, 0x52, 0xEF, 0x09, 0x0B, 0x40,
-    0x4A, 0x3C, 0x65, 0xDB, 0xC1, 0x96, 0x69, 0x02, 0x47, 0x0E, 0x98, 0x46, 0x0A, 0x88, 0x31, 0x55,
-    0x70, 0x92, 0x71, 0x0B, 0x6B, 0x83, 0xAC, 0xBD, 0x70, 0xF5, 0xF8, 0xFD, 0x67, 0xEF, 0x48, 0x53,
-    0x8C, 0x15, 0x95, 0x6D, 0x05, 0xF2, 0x9E, 0x36, 0x27, 0xD0, 0x66, 0x1A, 0x0A, 0xB7, 0x06, 0x37,
-    0x0F, 0xBC, 0xD7, 0xE7, 0xB5, 0x09, 0x58, 0x37, 0xA8, 0x0D, 0x3F, 0xD1, 0xF2, 0x49, 0xA3, 0x5F,
-    0x64, 0x1A, 0xDB, 0x99, 0x64, 0xF0, 0x9E, 0xA1, 0xE4, 0x46, 0x63, 0x96, 0xC2, 0xD4, 0xCA, 0x54,
-    0x2C, 0x92, 0x41, 0x01, 0x82, 0x32, 0x50, 0x11, 0xFB, 0x30, 0xC7, 0x24, 0x4A, 0x3E, 0x92, 0x92,
-    0xA2, 0xE4, 0x56, 0xC8, 0x0C, 0x77, 0x1C, 0x1E, 0x01, 0xFA, 0xE1, 0xF7, 0x01, 0xF5, 0x8F, 0x40,
-    0x08, 0x93, 0xFC, 0x13, 0xF2, 0x83, 0x07, 0x83, 0x6B, 0x81, 0x3D, 0xEF, 0x1C, 0xB2, 0x0F, 0x61,
-    0x0A, 0x48, 0x59, 0x4B, 0xB8, 0x70, 0xB6, 0xD4, 0xE4, 0x81, 0x86, 0x12, 0x2A, 0x45, 0x65, 0xFB,
-    0x45, 0xCD, 0xD2, 0xAA, 0x39, 0x9D, 0x92, 0x31, 0x86, 0x72, 0x63, 0xFC, 0xE2, 0x63, 0xD2, 0x47,
-    0x37, 0xDB, 0x47, 0x16, 0x39, 0x07, 0x72, 0xD8, 0xD3, 0x9C, 0x88, 0x60, 0xD5, 0x5D, 0x7F, 0xB6,
-    0xCA, 0xC6, 0xBD, 0xBB, 0x8C, 0xD7, 0xE7, 0xD3, 0xFE, 0x1F, 0x8F, 0xF8, 0xA5, 0x93, 0x6E, 0xC7,
-    0x20, 0xC9, 0x58, 0xF9, 0x88, 0x6E, 0xC7, 0x41, 0x0E, 0x19, 0x10, 0xB5, 0x9B, 0x23, 0x0C, 0x5F,
-    0x07, 0x9A, 0xF4, 0xBA, 0x73, 0x77, 0x41, 0x95, 0xDB, 0x4F, 0xB7, 0x7B, 0xAE, 0x83, 0x0F, 0x36,
-    0x5D, 0xCE, 0x89, 0x84, 0xD6, 0x37, 0xCA, 0x94, 0x31, 0xF0, 0x2E, 0x00, 0x55, 0x0E, 0xAE, 0xA1,
-    0x2D, 0x59, 0x74, 0x63, 0x53, 0x86, 0xF1, 0xEB, 0x45, 0x04, 0xD6, 0x9D, 0x78, 0xD6, 0x2E, 0xF8,
-    0x9B, 0x3D, 0x90, 0xDD, 0xDB, 0xB5, 0xCA, 0x11, 0x3E, 0x73, 0x16, 0xD9, 0x38, 0x4E, 0xC1, 0xE2,
-    0xE8, 0xE0, 0xAB, 0x8B, 0xAF, 0xA8, 0x27, 0x7F, 0xD9, 0x45, 0x16, 0xB7, 0x7E, 0xDA, 0x65, 0xBD,
-    0x66, 0x9A, 0x8E, 0x78, 0xB7, 0xA7, 0x83, 0x5A, 0x2B, 0x7D, 0xB0, 0xA6, 0x02, 0xE6, 0x4E, 0x3C,
-    0x63, 0x36, 0xA8, 0x45, 0xAF, 0x87, 0x41, 0x1A, 0xBE, 0x48, 0x45, 0x1F, 0x81, 0x4F, 0xDD, 0xAB,
-    0xEA, 0xEB, 0x24, 0x88, 0xD2, 0xBD, 0x05, 0x1D, 0x7A, 0xB3, 0x56, 0xE3, 0x0F, 0x55, 0x78, 0x5A,
-    0x7E, 0xF5, 0xA5, 0xA8, 0x9C, 0x1B, 0x35, 0x47, 0xE7, 0x2E, 0xCB, 0xE0, 0xE5, 0xE6, 0xBB, 0x2E,
-    0x94, 0x99, 0xB8, 0x7D, 0x28, 0xEF, 0xCA, 0xB1, 0xE0, 0x04, 0x42, 0x9F, 0xD9, 0xD5, 0x41, 0x19,
-    0xA0, 0x00, 0x3B, 0x25, 0xC8, 0xF3, 0x6F, 0xF8, 0xA2, 0x4A, 0x51, 0x5B, 0x1A, 0x18, 0x82, 0x79,
-    0x09, 0x18, 0x05, 0x81, 0xC9, 0x85, 0x23, 0xD2, 0x1A, 0x04, 0xA1, 0x60, 0x64, 0xCD, 0x38, 0x9C,
-    0xD8, 0xA8, 0x2F, 0x6B, 0x58, 0x22, 0x20, 0x8B, 0x6E, 0x73, 0x98, 0x99, 0xC4, 0x8A, 0x96, 0x35,
-    0x81, 0x44, 0xBC, 0x0A, 0x0C, 0x9A, 0x8F, 0x37, 0xB3, 0xAC, 0x67, 0xFA, 0x82, 0x39, 0xF8, 0xC4,
-    0xE3, 0xAC, 0x52, 0xDD, 0xFC, 0xB7, 0x8F, 0xA9, 0xBE, 0x62, 0x70, 0xB0, 0x45, 0x76, 0xF7, 0x0E,
-    0x33, 0x9D, 0x21, 0x44, 0xB2, 0xE5, 0xE8, 0xFF, 0xF3, 0xCE, 0xF9, 0x26, 0x72, 0xF9, 0xD2, 0x48,
-    0xF0, 0xA4, 0x0F, 0x43, 0xB5, 0xD9, 0x46, 0x18, 0xD9, 0x0F, 0x2E, 0x8B, 0xD1, 0x48, 0x95, 0x7E,
-    0xF2, 0xFD, 0x01, 0x3B, 0x4A, 0x21, 0xD8, 0xF8, 0x66, 0x30, 0xC0, 0x3D, 0xCD, 0xB3, 0x6C, 0xA4,
-    0x94, 0x3B, 0x27, 0x90, 0x73, 0x5B, 0xCB, 0xD3, 0x15, 0x79, 0xB2, 0xE6, 0x34, 0xD5, 0x6B, 0x9B,
-    0xB2, 0x72, 0xC5, 0x13, 0xFC, 0xB8, 0x55, 0x12, 0xF6, 0x63, 0xEF, 0x83, 0xF1, 0xBC, 0xEB, 0x37,
-    0x7A, 0xB0, 0xB1, 0x3C, 0x6D, 0x7D, 0x70, 0x87, 0xA1, 0x21, 0xD6, 0x33, 0x08, 0x9F, 0x65, 0xF1,
-    0x13, 0x6B, 0x6B, 0xFC, 0x23, 0x66, 0xB7, 0x95, 0x35, 0x5F, 0x24, 0xD8, 0x77, 0xAF, 0x48, 0x53,
-    0x8F, 0xAD, 0xC2, 0xC6, 0xC7, 0x5A, 0x66, 0x75, 0x8A, 0xD9, 0x42, 0x58, 0xC1, 0xB9, 0x17, 0xA1,
-    0x98, 0xC2, 0x88, 0x98, 0x7F, 0x71, 0x7C, 0xCA, 0x96, 0x45, 0x4A, 0x6F, 0x0C, 0xA0, 0x78, 0xA3,
-    0x0B, 0x26, 0x68, 0xD3, 0xB9, 0xCF, 0x7F, 0x83, 0x34, 0xCD, 0x09, 0x6A, 0xA6, 0xEF, 0x6E, 0xFC,
-    0x40, 0xD0, 0x3C, 0x04, 0x12, 0x49, 0x97, 0x29, 0x7E, 0xF1, 0x03, 0xF2, 0xF0, 0x79, 0xEF, 0x27,
-    0xE4, 0xFD, 0xDF, 0xCA, 0xFB, 0x9F, 0x2F, 0x55, 0x23, 0x9B, 0x02, 0x71, 0xF9, 0x11, 0x0B, 0x48,
-    0x36, 0x72, 0x43, 0x32, 0x7D, 0x2B, 0xD8, 0x45, 0x00, 0x84, 0xF4, 0x8A, 0x58, 0x85, 0x05, 0xD8,
-    0x4D, 0xEF, 0x15, 0x45, 0x86, 0x4C, 0xA6, 0x0D, 0xF1, 0x9E, 0xB6, 0xDC, 0x1A, 0xD3, 0x54, 0x40,
-    0xBF, 0xDA, 0xB7, 0x26, 0xB2, 0x4E, 0xB7, 0xA6, 0x91, 0x5E, 0x26, 0xC4, 0x9E, 0xB8, 0x75, 0xC4,
-    0x12, 0x48, 0x53, 0xE8, 0x99, 0x0D, 0x87, 0xA2, 0xFD, 0x3F, 0x16, 0x2B, 0x7D, 0xF4, 0x2C, 0xDE,
-    0x62, 0x6E, 0x3B, 0xAC, 0xFD, 0xBE, 0xE9, 0x85, 0xE7, 0x3F, 0xE5, 0xD1, 0x83, 0x08, 0xAD, 0x2D,
-    0x03, 0x71, 0x03, 0x36, 0xB4, 0xC5, 0x5F, 0xB1, 0x83, 0x1A, 0x58, 0xCA, 0xC9, 0x1A, 0xB5, 0x4F,
-    0x81, 0x0B, 0x40, 0x75, 0x56, 0x21, 0x29, 0x90, 0x72, 0x3D, 0xFC, 0x4F, 0xD2, 0x33, 0x78, 0x21,
-    0xF4, 0x18, 0x76, 0x8F, 0x93, 0x45, 0xD6, 0xA6, 0x56, 0xE1, 0xEB, 0xA5, 0xE3, 0x00, 0x06, 0xFC,
-    0x97, 0xBF, 0xC5, 0x2F, 0x9E, 0x7A, 0xAA, 0x58, 0xEA, 0x9F, 0xA1, 0x90, 0xD8, 0xF9, 0xCA, 0x1B,
-    0xE6, 0x6E, 0x6C, 0xFC, 0x40, 0x7C, 0xF8, 0xC0, 0xB1, 0x04, 0x44, 0x50, 0xAE, 0x9B, 0xBC, 0x71,
-    0x10, 0x09, 0x44, 0x97, 0x32, 0x39, 0xEA, 0x0C, 0xB6, 0x9A, 0xAF, 0x39, 0x04, 0x27, 0x93, 0x9B,
-    0x3D, 0x10, 0xC8, 0x68, 0x4B, 0xB8, 0xC1, 0x6B, 0xC4, 0x70, 0x8E, 0xC2, 0xD4, 0x03, 0x4D, 0xDA,
-    0x34, 0x25, 0x63, 0xB5, 0xD7, 0xA9, 0x6D, 0xFB, 0xF7, 0x0B, 0x0D, 0xD8, 0xE9, 0xE7, 0x77, 0xC1,
-    0x82, 0xA7, 0xBF, 0xF7, 0x93, 0x45, 0x81, 0x66, 0x7B, 0xB5, 0xFD, 0x35, 0xC2, 0xE0, 0x4E, 0xCA,
-    0x72, 0x52, 0xAD, 0xCC, 0x88, 0x32, 0xE3, 0x2E, 0xEB, 0xCA, 0x62, 0x4A, 0x99, 0xF4, 0xEC, 0x76,
-    0x69, 0x93, 0x5E, 0x76, 0xE7, 0x80, 0x54, 0xEE, 0x22, 0x35, 0x30, 0x03, 0x74, 0x33, 0x1B, 0x01,
-    0xD4, 0xB0, 0x6B, 0x26, 0x7F, 0x0B, 0x43, 0xDA, 0xD2, 0x95, 0x75, 0x2F, 0x6E, 0x74, 0x65, 0x9B,
-    0x07, 0xAA, 0x8B, 0x0F, 0x75, 0x65, 0x9F, 0x80, 0xC1, 0x12, 0x89, 0x0E, 0x3E, 0xC8, 0x25, 0x73,
-    0xEB, 0x45, 0x5E, 0xED, 0x9C, 0x72, 0xD4, 0xCC, 0xC9, 0x43, 0x9F, 0x31, 0xF7, 0xDF, 0xA7, 0x83,
-    0xA8, 0x18, 0x7B, 0xDC, 0xF2, 0xFF, 0x02, 0xCF, 0x2E, 0xB4, 0x93, 0xB4, 0xDE, 0xF2, 0xFF, 0x80,
-    0x85, 0x42, 0xA9, 0xAF, 0xD0, 0x96, 0xBE, 0x85, 0x75, 0x8B, 0x6F, 0x47, 0x75, 0x74, 0xB5, 0x61,
-    0xFE, 0x12, 0xF8, 0x21, 0xBD, 0x17, 0x9E, 0xFF, 0xEB, 0xE7, 0x54, 0x76, 0x45, 0x08, 0x4A, 0x80,
-    0x50, 0xAF, 0x34, 0x61, 0xFB, 0xAE, 0xC2, 0x73, 0xBF, 0xBF, 0xE1, 0xC3, 0x32, 0x0D, 0x55, 0x9A,
-    0xE8, 0x66, 0xCB, 0xFF, 0x66, 0x26, 0xB3, 0x7E, 0xFD, 0xE8, 0xF3, 0xDF, 0xCD, 0x7E, 0x73, 0xA1,
-    0x83, 0x5A, 0x3F, 0x9F, 0x5E, 0xE8, 0xFF, 0x96, 0x51, 0xF2, 0x63, 0x3C, 0xFC, 0xAF, 0xD6, 0xDD,
-    0x9B, 0x05, 0xD5, 0xFE, 0x4F, 0xE6, 0x61, 0xA8, 0x79, 0xB0, 0xB1, 0x79, 0x57, 0xFE, 0x7A, 0x22,
-    0x58, 0xD8, 0xF0, 0x36, 0x71, 0x7C, 0x70, 0x82, 0x2A, 0xB8, 0x80, 0xAD, 0xBD, 0xF7, 0x0B, 0xF5,
-    0xF4, 0xB6, 0xC5, 0xE7, 0x8F, 0xF9, 0x93, 0x89, 0x83, 0x72, 0x3B, 0xFF, 0x81, 0xCA, 0xFA, 0xDC,
-    0x7F, 0xFE, 0xDE, 0xB7, 0xA8, 0xB8, 0xAA, 0x7A, 0xFC, 0x4D, 0x31, 0x0D, 0x09, 0x0F, 0xBB, 0x0E,
-    0xFE, 0xFD, 0x4D, 0xA7, 0x7E, 0x00, 0x25, 0xFF, 0x76, 0x54, 0x6C, 0x7C, 0x1E, 0xCE, 0xD9, 0xF0,
-    0xEC, 0xF5, 0xFE, 0x4D, 0xBC, 0xF5, 0xF6, 0x6D, 0xFE, 0xAF, 0x3F, 0xF2, 0x7F, 0xFD, 0x99, 0xFF,
-    0xEB, 0x05, 0xBE, 0xFD, 0x42, 0x51, 0x9B, 0xD5, 0xAB, 0xEA, 0xA7, 0x2A, 0x2E, 0xE4, 0x57, 0x46,
-    0x2C, 0x9D, 0x0B, 0xA6, 0xF8, 0xE9, 0xF1, 0x74, 0x89, 0x43, 0x8B, 0x1B, 0x31, 0xC8, 0xD8, 0x06,
-    0x12, 0x24, 0xB6, 0x3F, 0xF6, 0x8E, 0x10, 0xAF, 0x77, 0x25, 0x69, 0x54, 0xBE, 0x14, 0x85, 0xE7,
-    0x07, 0xAD, 0x7A, 0xCE, 0x13, 0xF5, 0x82, 0x27, 0xF1, 0x05, 0x7F, 0xED, 0x5F, 0xFB, 0xBF, 0x7E,
-    0xE1, 0x8B, 0xE8, 0xE1, 0x31, 0x24, 0x98, 0x09, 0x32, 0x89, 0xA9, 0x64, 0x24, 0x60, 0xDB, 0x68,
-    0xFB, 0x71, 0xB5, 0x18, 0x78, 0x49, 0x64, 0x0E, 0x63, 0x50, 0xC8, 0x46, 0x06, 0x00, 0x7D, 0xD7,
-    0x07, 0x48, 0x50, 0xBB, 0x70, 0x88, 0xD7, 0x91, 0xBE, 0xA7, 0xBF, 0x69, 0x91, 0x10, 0x9E, 0x67,
-    0x12, 0x9F, 0x32, 0x3B, 0xCD, 0x6A, 0x96, 0x82, 0xEB, 0xF4, 0x0A, 0x87, 0x05, 0x6F, 0xD4, 0xBA,
-    0xC8, 0xA0, 0x72, 0x8C, 0xA1, 0xE5, 0x3E, 0xD8, 0x83, 0x99, 0x34, 0xA2, 0xCF, 0xC8, 0x81, 0xC5,
-    0x7E, 0x51, 0xA8, 0x14, 0xBC, 0x24, 0x50, 0x46, 0x4A, 0x4D, 0x8B, 0x69, 0x8D, 0x63, 0xC1, 0xB1,
-    0xB4, 0xC9, 0xEA, 0xFC, 0x12, 0xBB, 0x18, 0xAD, 0xFA, 0xF7, 0x3E, 0xA3, 0x5A, 0x65, 0x49, 0x32,
-    0xEA, 0x01, 0xC5, 0x19, 0xBB, 0x59, 0x37, 0x95, 0xEA, 0x65, 0x55, 0xBE, 0x08, 0xF3, 0x8C, 0x3B,
-    0x99, 0xEE, 0xAA, 0x0C, 0x83, 0xA7, 0xB3, 0xAF, 0xBB, 0x2B, 0x48, 0xA9, 0x75, 0xEF, 0xBD, 0xB7,
-    0xF5, 0x49, 0xF4, 0xDC, 0xD7, 0x5E, 0x56, 0x36, 0xD8, 0x1C, 0x4D, 0x5D, 0xBF, 0x9C, 0x65, 0xB0,
-    0xC5, 0xA6, 0xC4, 0xD4, 0x21, 0xA2, 0xB1, 0x99, 0xC0, 0x52, 0xDF, 0x22, 0x31, 0x8D, 0x90, 0xDB,
-    0x79, 0xA3, 0xF9, 0xCE, 0xB4, 0x57, 0x33, 0xAB, 0xED, 0x64, 0x76, 0x8B, 0x76, 0xC8, 0xF2, 0x40,
-    0xAD, 0xF4, 0x3F, 0x71, 0xAE, 0x0C, 0x97, 0x96, 0x47, 0xE0, 0x0B, 0x81, 0x37, 0x6C, 0x79, 0x79,
-    0xD4, 0xF0, 0xDE, 0x73, 0x55, 0x6B, 0x39, 0xB6, 0x36, 0x6C, 0x8C, 0xAD, 0xB1, 0x1F, 0xF2, 0xEF,
-    0xA6, 0x68, 0x70, 0x63, 0x7C, 0x8F, 0x57, 0xB2, 0xEC, 0x07, 0xC2, 0xEE, 0x9F, 0xAC, 0x90, 0xE2,
-    0x17, 0x0B, 0xF3, 0x5E, 0xF8, 0x08, 0x19, 0x4E, 0xF8, 0x59, 0x5E, 0x45, 0x77, 0x65, 0x02, 0xA5,
-    0x28, 0x3F, 0xB4, 0xA1, 0xEF, 0x3C, 0x76, 0x6C, 0x8C, 0x4F, 0xC8, 0x29, 0xBA, 0xDD, 0x7D, 0x7E,
-    0xCE, 0xD5, 0xEE, 0x6D, 0xF6, 0x06, 0xBB, 0xF4, 0x06, 0xC2, 0x60, 0xCE, 0x96, 0x3C, 0xF2, 0x9F,
-    0xA0, 0x7A, 0x60, 0x56, 0x19, 0x7F, 0x4E, 0xF8, 0x62, 0xBF, 0xB4, 0x79, 0x7B, 0x69, 0x88, 0x7A,
-    0x12, 0xBB, 0xC0, 0xEE, 0x2F, 0xA4, 0x55, 0x30, 0x7A, 0x10, 0xCB, 0x2B, 0xE2, 0xC7, 0x78, 0xA0,
-    0x25, 0x89, 0x95, 0x2F, 0x3F, 0xFB, 0x12, 0x3A, 0xEB, 0x18, 0xC1, 0x2A, 0xB0, 0x96, 0x34, 0x78,
-    0x54, 0xF9, 0x56, 0xB1, 0x18, 0x15, 0x79, 0x68, 0xBC, 0x76, 0x90, 0xED, 0xF9, 0xEA, 0xC1, 0xD6,
-    0x01, 0xB7, 0x69, 0x39, 0x98, 0xB7, 0xCD, 0xED, 0x63, 0x25, 0x96, 0xF1, 0x75, 0xC5, 0xAD, 0x7E,
-    0xD1, 0xAC, 0xB3, 0x44, 0x98, 0x57, 0x56, 0x2B, 0x2F, 0x65, 0x24, 0xD9, 0xFB, 0xF8, 0x29, 0x88,
-    0xCC, 0x25, 0x9E, 0xB2, 0xF4, 0xB8, 0x69, 0x84, 0x17, 0x6A, 0x28, 0xED, 0x89, 0xC7, 0x4F, 0x03,
-    0x4A, 0x4E, 0xC2, 0x21, 0x02, 0xB0, 0x3B, 0x03, 0xB6, 0x49, 0x59, 0x34, 0xFB, 0x70, 0xE4, 0xA0,
-    0x07, 0x03, 0x70, 0xDC, 0x4F, 0xE2, 0xCC, 0x39, 0x1D, 0x32, 0x04, 0xC0, 0x55, 0x2C, 0x69, 0xF3,
-    0x39, 0x33, 0x58, 0x09, 0x56, 0x57, 0x95, 0x8C, 0x1E, 0x76, 0xA0, 0x26, 0xE9, 0x7C, 0x51, 0xF5,
-    0x1E, 0x15, 0x3C, 0x73, 0x0C, 0x90, 0xAF, 0x8D, 0x2C, 0x15, 0x23, 0x8F, 0x73, 0x8C, 0x31, 0xDC,
-    0x54, 0xD2, 0x3F, 0x91, 0x8C, 0x52, 0x2F, 0x9F, 0x64, 0xB0, 0xD8, 0xCF, 0xA6, 0xE4, 0x55, 0xDE,
-    0xB0, 0x91, 0x1D, 0x73, 0x8E, 0x86, 0x25, 0x2A, 0x4A, 0x1C, 0x37, 0x20, 0x91, 0x10, 0x6A, 0xF7,
-    0xDC, 0x9C, 0x28, 0x2E, 0x4B, 0x8B, 0xCA, 0xAE, 0xDC, 0xF0, 0x23, 0x7B, 0xA3, 0x9F, 0xDF, 0xE3,
-    0x00, 0xF2, 0xDD, 0xFB, 0xA3, 0x20, 0x86, 0x37, 0x59, 0x98, 0x3B, 0xDB, 0x8B, 0x20, 0x4A, 0x96,
-    0x2A, 0x25, 0x55, 0x04, 0x0E, 0x84, 0x01, 0x35, 0x59, 0x87, 0xA8, 0x36, 0x46, 0x12, 0x6D, 0xEB,
-    0x4D, 0x73, 0x11, 0x1B, 0xE5, 0xEE, 0x45, 0xDE, 0xB3, 0xC0, 0xC5, 0xCB, 0xFE, 0x6D, 0x09, 0x9B,
-    0xC8, 0xC6, 0xD8, 0xD5, 0x48, 0x6E, 0x6B, 0x28, 0x66, 0xC3, 0xA1, 0xEF, 0x66, 0x22, 0x6B, 0xA6,
-    0x6C, 0x6D, 0x94, 0x71, 0x49, 0xF6, 0x9C, 0x9C, 0x8C, 0x48, 0xE7, 0xD7, 0xEF, 0x73, 0x78, 0x61,
-    0x28, 0x69, 0xA0, 0x6E, 0x77, 0x57, 0x56, 0xA1, 0x41, 0x1A, 0xE4, 0x5A, 0xE9, 0xDF, 0xDA, 0x88,
-    0xFD, 0xDB, 0xD2, 0x7B, 0xDF, 0x71, 0x23, 0xAD, 0xF2, 0xDD, 0xA9, 0x05, 0x39, 0x51, 0xFF, 0xB5,
-    0x8D, 0x14, 0x72, 0x02, 0x39, 0x17, 0xEF, 0xA9, 0xBE, 0xD3, 0x09, 0x66, 0x8F, 0x87, 0x3F, 0xB8,
-    0x77, 0xFC, 0x8F, 0xE2, 0x6A, 0x7F, 0xA8, 0xB6, 0x9D, 0x62, 0xE5, 0x26, 0x5D, 0x30, 0xAB, 0xAC,
-    0x68, 0xA4, 0x8A, 0xC3, 0x67, 0x6C, 0xB9, 0x06, 0x2C, 0x39, 0xE5, 0x67, 0x79, 0x2B, 0x2B, 0xC4,
-    0x86, 0xA8, 0x55, 0x26, 0x52, 0x0B, 0x95, 0xDE, 0x1D, 0x38, 0x5D, 0x0B, 0x25, 0xB8, 0x8A, 0xCC,
-    0x76, 0xE2, 0xF8, 0x11, 0x32, 0xB3, 0x08, 0x4C, 0xA5, 0x8D, 0xDB, 0xA8, 0x97, 0x3C, 0x6B, 0x9E,
-    0xF3, 0x99, 0x65, 0xC3, 0x2D, 0xCD, 0x72, 0x09, 0x58, 0x60, 0x1D, 0x53, 0x40, 0xA4, 0xBC, 0x01,
-    0x6E, 0x92, 0x02, 0x2B, 0x07, 0x96, 0x58, 0x60, 0x4D, 0x99, 0xD7, 0x2D, 0x0A, 0xAC, 0x6B, 0x2C,
-    0xB0, 0x62, 0xCD, 0x02, 0x74, 0x2B, 0x83, 0x25, 0x11, 0x07, 0xC4, 0x27, 0xD3, 0x69, 0xCA, 0x78,
-    0x59, 0x35, 0x4F, 0xB0, 0xED, 0x1E, 0x94, 0xFD, 0x0B, 0xAB, 0xB2, 0x8B, 0xC0, 0xD5, 0x93, 0xEE,
-    0x36, 0xD1, 0x7D, 0x72, 0x49, 0x37, 0x6E, 0xBB, 0xCD, 0x04, 0x87, 0x74, 0x5F, 0x23, 0xC0, 0x90,
-    0xEB, 0xC0, 0xF9, 0xF1, 0x7F, 0xCB, 0x8C, 0x62, 0x23, 0x93, 0x4D, 0xE1, 0xF1, 0x95, 0xE3, 0xE9,
-    0x25, 0xA4, 0x07, 0x25, 0x5C, 0x12, 0x6C, 0xED, 0xEE, 0xC4, 0x35, 0x02, 0x67, 0x65, 0xD2, 0x2B,
-    0xBF, 0xD2, 0xC2, 0x65, 0xD6, 0xD1, 0x7D, 0x57, 0x65, 0x57, 0xE0, 0x8B, 0xFF, 0xA3, 0x95, 0x09,
-    0x47, 0x5F, 0xC0, 0xEF, 0x52, 0x60, 0xCE, 0x0F, 0xA1, 0x91, 0xA3, 0x81, 0x61, 0x73, 0x13, 0x6B,
-    0x5B, 0xA8, 0x18, 0x66, 0xEE, 0x2D, 0xA9, 0xF8, 0xC8, 0x2E, 0xB8, 0x67, 0xC8, 0x3D, 0x19, 0x24,
-    0x04, 0x15, 0x81, 0xF5, 0xBA, 0x4B, 0x8A, 0x65, 0xC4, 0x67, 0x54, 0x2B, 0x76, 0x1F, 0xA7, 0x73,
-    0xFF, 0x00, 0xB6, 0x59, 0x29, 0x0F, 0x83, 0x6D, 0x15, 0x81, 0xD5, 0x39, 0xF8, 0xD9, 0xDE, 0xB9,
-    0xD0, 0x6E, 0x3B, 0xD0, 0x96, 0xB5, 0x7F, 0xE8, 0x45, 0xA6, 0x1A, 0x40, 0x4E, 0xFA, 0x06, 0x07,
-    0x83, 0xD9, 0x46, 0x64, 0xBB, 0x95, 0x83, 0x63, 0x2E, 0x6F, 0xFC, 0x18, 0x99, 0x9F, 0xE7, 0x84,
-    0xCE, 0xCB, 0x18, 0x67, 0x9D, 0x93, 0x38, 0xA7, 0xB6, 0xAF, 0x56, 0x3B, 0x8E, 0x40, 0xD7, 0x10,
-    0x47, 0xF0, 0x18, 0x49, 0x4E, 0xCA, 0x03, 0xDD, 0x7C, 0xAB, 0x10, 0x0D, 0xE5, 0x06, 0xCA, 0x56,
-    0xD9, 0x59, 0x4E, 0xEC, 0xB2, 0xEB, 0x7C, 0xDA, 0xFA, 0xF2, 0x56, 0x59, 0x08, 0xF0, 0xE3, 0x60,
-    0x6F, 0xB0, 0x31, 0x1A, 0x19, 0x8C, 0x32, 0x1A, 0x19, 0xC9, 0x80, 0x67, 0xA1, 0x1F, 0x39, 0x42,
-    0x99, 0xB6, 0x32, 0x43, 0xC5, 0xC9, 0x29, 0xA6, 0x71, 0x20, 0x56, 0x23, 0x4B, 0xB8, 0xD6, 0x2B,
-    0xB7, 0xB5, 0x23, 0x5C, 0x6F, 0x9A, 0x0D, 0x5F, 0xA8, 0x1A, 0x6E, 0x40, 0x60, 0xE6, 0x74, 0x17,
-    0xE7, 0x4B, 0xD3, 0x3B, 0x1C, 0x41, 0xF1, 0x67, 0x00, 0xB2, 0x4F, 0x0E, 0xD6, 0xAC, 0xCE, 0x32,
-    0x03, 0x01, 0xF3, 0x27, 0x5D, 0x94, 0x4C, 0x50, 0xC7, 0x2D, 0x21, 0x47, 0x82, 0xB3, 0xEF, 0xC1,
-    0x38, 0x12, 0xEE, 0x04, 0x74, 0x38, 0x92, 0x3E, 0xED, 0x15, 0xDA, 0x15, 0x89, 0x97, 0xA2, 0x58,
-    0xE1, 0xC7, 0x90, 0x85, 0x7E, 0xD9, 0x80, 0x92, 0x1D, 0xC8, 0x16, 0x14, 0xF7, 0xA0, 0x64, 0x13,
-    0xBC, 0x61, 0x58, 0xDC, 0x50, 0xD1, 0xDB, 0xCA, 0x2C, 0x28, 0xC8, 0x5D, 0x3D, 0x21, 0x0D, 0x45,
-    0xCE, 0x89, 0x0F, 0xA4, 0xD8, 0x8F, 0xC4, 0x26, 0xA0, 0xD9, 0x0F, 0xCE, 0x92, 0x6A, 0x45, 0xB2,
-    0x15, 0xE9, 0xF6, 0xB3, 0xB2, 0x0C, 0xAC, 0x10, 0x37, 0xD6, 0x02, 0x7F, 0xE7, 0xE9, 0x4F, 0x19,
-    0x84, 0x5E, 0xBC, 0x23, 0x52, 0x82, 0xEF, 0xC1, 0x38, 0x87, 0x21, 0x3F, 0x8E, 0xE5, 0x27, 0xC6,
-    0xFC, 0x1C, 0xB9, 0xB3, 0x88, 0x7A, 0x1C, 0xBB, 0x4E, 0x79, 0x6A, 0xA3, 0xE7, 0x44, 0x1F, 0x43,
-    0x08, 0xA8, 0x90, 0xF3, 0x16, 0x81, 0xCD, 0x6B, 0x30, 0xC1, 0x72, 0xFE, 0x8F, 0x9D, 0x70, 0xBA,
-    0x09, 0x56, 0xF7, 0x7C, 0xF2, 0xE0, 0x7D, 0xAF, 0x38, 0xA2, 0x22, 0xF3, 0xC7, 0x4A, 0x5A, 0x79,
-    0xA7, 0xF7, 0x33, 0xD3, 0xB2, 0x7D, 0xB9, 0x7A, 0xDC, 0x0F, 0xA0, 0xCB, 0x1B, 0x65, 0xE1, 0x87,
-    0x7F, 0xE5, 0xC8, 0x09, 0x8B, 0xE5, 0x15, 0xDF, 0x80, 0x9F, 0x72, 0x76, 0x68, 0xF5, 0x59, 0xA4,
-    0x6D, 0xFA, 0xB0, 0xE5, 0x84, 0x81, 0x65, 0xAB, 0xD9, 0xCA, 0x80, 0xC1, 0x22, 0xF5, 0xE7, 0x33,
-    0x9F, 0xC8, 0xE4, 0xA8, 0x13, 0xC7, 0xBC, 0xB8, 0xD3, 0x65, 0xA3, 0xD4, 0x17, 0x02, 0x5A, 0xB1,
-    0x38, 0xCE, 0x27, 0x47, 0x56, 0x6A, 0x16, 0xF7, 0x02, 0x64, 0xAB, 0x8D, 0xD9, 0x09, 0x8C, 0x77,
-    0x66, 0x2C, 0xD3, 0xD6, 0xA6, 0x67, 0x7B, 0xBD, 0xEB, 0xE6, 0x94, 0x9E, 0x1E, 0xCB, 0x9D, 0x9D,
-    0xCD, 0x9A, 0xB1, 0xDC, 0x35, 0x68, 0x20, 0xAB, 0xDD, 0x1C, 0x91, 0x72, 0x75, 0x28, 0xB5, 0x4F,
-    0xE9, 0x81, 0x65, 0xDD, 0xB2, 0xD0, 0xA4, 0xA5, 0xFD, 0x1B, 0xBA, 0x40, 0xE9, 0x33, 0x2E, 0xEE,
-    0x61, 0xEB, 0xD9, 0x95, 0xF3, 0xB7, 0x86, 0xD1, 0xE5, 0x7B, 0xCE, 0xDF, 0xBA, 0x33, 0x98, 0xCC,
-    0xC5, 0x56, 0x0E, 0x02, 0x54, 0xEC, 0xD3, 0xFA, 0xF3, 0x1C, 0x5F, 0x21, 0xB9, 0x7A, 0x60, 0xE4,
-    0x35, 0xA9, 0xFD, 0xC9, 0x10, 0x16, 0x12, 0x5E, 0x6E, 0x3D, 0xF0, 0x9F, 0x27, 0xA9, 0x96, 0x09,
-    0x56, 0xFE, 0xA8, 0x04, 0xCB, 0x14, 0x45, 0x49, 0xB2, 0x1A, 0x56, 0x2E, 0x20, 0xA3, 0xF7, 0x19,
-    0x43, 0xB6, 0x8D, 0xAC, 0x1E, 0x49, 0x0F, 0xE8, 0x4B, 0x4D, 0xD2, 0xC2, 0xD3, 0x91, 0xF5, 0xA1,
-    0x7B, 0xE8, 0x03, 0x2F, 0x74, 0x36, 0x49, 0x10, 0x63, 0xCE, 0xBB, 0x8C, 0x88, 0xC6, 0x72, 0xFF,
-    0xAF, 0xBB, 0xDD, 0x7D, 0x02, 0x27, 0xC6, 0x69, 0x72, 0xD6, 0xB8, 0x90, 0x7F, 0x32, 0x77, 0xF5,
-    0x73, 0x23, 0xEC, 0x09, 0x1A, 0x25, 0x93, 0x6A, 0x91, 0xB4, 0xFE, 0x80, 0xA5, 0x47, 0xCA, 0xBE,
-    0xBC, 0xE9, 0xC7, 0xEA, 0xD4, 0x3C, 0x00, 0x22, 0x15, 0xD3, 0x45, 0xAC, 0x35, 0x73, 0x70, 0x87,
-    0x79, 0x02, 0x5A, 0x98, 0x9D, 0x43, 0x3C, 0xB2, 0x0E, 0x9E, 0x9F, 0x41, 0x64, 0xDE, 0xD3, 0xD2,
-    0x11, 0x71, 0x10, 0x96, 0xFB, 0x66, 0xA9, 0x4C, 0x37, 0x6A, 0xCB, 0x79, 0xA0, 0x8D, 0xC9, 0x44,
-    0x0A, 0xE1, 0x15, 0xB5, 0xE3, 0x8D, 0x0E, 0x1E, 0x4D, 0x31, 0x87, 0x6E, 0xB7, 0xD6, 0xCA, 0x72,
-    0x5F, 0x2B, 0xCB, 0xAC, 0xC4, 0xDD, 0x74, 0x50, 0x9B, 0x99, 0xD4, 0x6C, 0x66, 0x12, 0x18, 0xC1,
-    0xBC, 0x9A, 0x53, 0xDE, 0x32, 0xAF, 0x5E, 0x87, 0x52, 0x1B, 0x03, 0x31, 0xC8, 0x3D, 0xFC, 0x58,
-    0x2E, 0x47, 0xCA, 0x48, 0x0E, 0x0B, 0x46, 0xCF, 0x00, 0x32, 0xE6, 0x7E, 0xD0, 0xB7, 0x0E, 0x4F,
-    0xDE, 0x3F, 0xE6, 0x0D, 0xCA, 0xCE, 0x41, 0x73, 0xE5, 0x58, 0x78, 0x22, 0x01, 0x4D, 0xCC, 0x20,
-    0x48, 0x54, 0x84, 0xF5, 0x48, 0x55, 0x04, 0x68, 0x44, 0xB2, 0xC2, 0xCF, 0x47, 0x29, 0x75, 0x53,
-    0xE3, 0xA5, 0x09, 0xE3, 0x3C, 0x78, 0x58, 0x1E, 0x8A, 0x73, 0xC3, 0x16, 0x84, 0xBC, 0x65, 0x68,
-    0x98, 0x8E, 0xBE, 0x2D, 0xE7, 0xA1, 0xE1, 0xF8, 0xF6, 0x63, 0x87, 0x86, 0x9D, 0x0C, 0x0D, 0xB7,
-    0xCB, 0xA1, 0xE1, 0x9E, 0x43, 0xC3, 0x40, 0x87, 0x9D, 0x0C, 0x53, 0xF8, 0xCA, 0x9B, 0x40, 0x76,
-    0x29, 0x8C, 0x09, 0xF4, 0x91, 0x64, 0xA0, 0x5C, 0xB4, 0x9B, 0xC2, 0x77, 0x02, 0x8B, 0x20, 0xC7,
-    0xDB, 0x8D, 0xB4, 0xD7, 0x0B, 0x5A, 0x93, 0xB0, 0x21, 0x67, 0xB9, 0x7D, 0x94, 0xFE, 0x04, 0xA0,
-    0x21, 0xC9, 0x01, 0xC7, 0xCA, 0xC1, 0x54, 0x7A, 0xC3, 0xFD, 0x8A, 0x90, 0xE4, 0xD5, 0x40, 0x59,
-    0x77, 0xDF, 0x02, 0xD0, 0xD5, 0xE7, 0xE1, 0x6C, 0xED, 0x33, 0xE5, 0xA5, 0x5D, 0x74, 0x9F, 0xE2,
-    0x53, 0x39, 0x9F, 0x4F, 0x5D, 0xE1, 0x01, 0x33, 0xFA, 0x3B, 0x99, 0x6E, 0xA7, 0xC7, 0xA2, 0xDF,
-    0xA5, 0xA7, 0xA5, 0xFB, 0x95, 0xC9, 0xFB, 0xFC, 0x9F, 0x65, 0x44, 0x39, 0x93, 0x53, 0x40, 0xFE,
-    0xD4, 0xC8, 0x46, 0x29, 0x9C, 0x16, 0x28, 0x01, 0x65, 0x86, 0x8F, 0x3B, 0x56, 0x7F, 0x75, 0xC2,
-    0xB8, 0x5B, 0xA3, 0x71, 0xB7, 0xFD, 0xD8, 0xFB, 0xB0, 0x0C, 0x27, 0x7C, 0xB5, 0xD0, 0x55, 0xBC,
-    0x74, 0x93, 0xB6, 0x46, 0x06, 0xEF, 0x13, 0x77, 0x7E, 0xF0, 0x83, 0x2F, 0x0C, 0x20, 0x54, 0x57,
-    0xD9, 0x85, 0x50, 0x9F, 0x35, 0xE1, 0x90, 0xD5, 0x9C, 0xA3, 0xE2, 0x3C, 0x0D, 0x87, 0xA8, 0x92,
-    0x8E, 0x84, 0x1A, 0x69, 0xE1, 0x11, 0x7B, 0x95, 0x24, 0x88, 0xA7, 0x80, 0xEA, 0xD4, 0x96, 0x9B,
-    0xC6, 0xBA, 0xA4, 0xFF, 0x30, 0xCA, 0x2B, 0x70, 0x8F, 0xCA, 0x78, 0xC4, 0x94, 0x77, 0x14, 0x3B,
-    0x0E, 0x34, 0xD9, 0xD9, 0x2E, 0xB9, 0xC5, 0xEA, 0x16, 0xB1, 0xBF, 0xDB, 0xD3, 0x33, 0x47, 0xEC,
-    0xCA, 0xF5, 0x61, 0xE5, 0xE3, 0x79, 0xDA, 0x85, 0xFA, 0x26, 0xA8, 0x13, 0xC4, 0x05, 0xF3, 0x58,
-    0x40, 0xE5, 0xA9, 0x03, 0x2A, 0x90, 0xB9, 0x6C, 0x24, 0x0E, 0x13, 0x88, 0xBB, 0x39, 0xFD, 0x99,
-    0x3E, 0xD7, 0x77, 0x36, 0x5F, 0x7B, 0xBD, 0x37, 0xFF, 0xAB, 0x3C, 0xE3, 0x38, 0x26, 0xC1, 0x99,
-    0x97, 0xB7, 0x5B, 0xF5, 0x6A, 0x59, 0x04, 0x9C, 0x4A, 0xC5, 0xD3, 0x5F, 0xD8, 0x38, 0x96, 0x24,
-    0x14, 0xA4, 0x97, 0xBB, 0xF8, 0x16, 0x41, 0xD4, 0x7F, 0x70, 0xFA, 0xBF, 0x9B, 0x37, 0xD7, 0xDD,
-    0x87, 0x52, 0x62, 0x1B, 0xC3, 0xC1, 0xAA, 0x3F, 0x82, 0x12, 0x66, 0x4D, 0xB0, 0xDB, 0xA7, 0x19,
-    0x8B, 0xAD, 0x6D, 0xEA, 0xCD, 0x88, 0xC6, 0x4E, 0xA6, 0xF5, 0x0F, 0x02, 0x3F, 0xA7, 0x78, 0xA2,
-    0x0C, 0x29, 0x4E, 0x86, 0x51, 0x3F, 0xE3, 0xC2, 0x22, 0x1B, 0x79, 0x08, 0x28, 0xC2, 0x98, 0xB4,
-    0xE5, 0xD0, 0x23, 0xF7, 0x94, 0x9F, 0x6D, 0xA3, 0x75, 0x32, 0xD2, 0xB2, 0x41, 0x6B, 0x6A, 0x19,
-    0x5D, 0x75, 0x6A, 0x5A, 0x8E, 0xE1, 0xCD, 0x33, 0x01, 0x7A, 0x67, 0x1F, 0x13, 0x62, 0x2E, 0x07,
-    0x62, 0xA9, 0xCC, 0x39, 0x2D, 0x81, 0xA9, 0x49, 0xE4, 0x5E, 0x9A, 0xB6, 0xC5, 0x40, 0x1F, 0x9A,
-    0x25, 0x3B, 0x9D, 0xB5, 0x31, 0x52, 0xE6, 0xCF, 0x38, 0xED, 0xE2, 0x51, 0x04, 0x19, 0x7A, 0xA9,
-    0x58, 0xA8, 0xFC, 0xD2, 0x02, 0xF2, 0x2E, 0x94, 0xD6, 0x5D, 0x25, 0xCD, 0x0E, 0x26, 0xD7, 0xCB,
-    0xE1, 0x5F, 0x02, 0x2E, 0x02, 0x37, 0xFB, 0xA7, 0x80, 0xF7, 0xEF, 0x97, 0x85, 0x7B, 0xDF, 0x84,
-    0xD6, 0xF8, 0xD9, 0xEF, 0x76, 0xC5, 0x1D, 0xF7, 0x31, 0xCE, 0xA9, 0xA7, 0x94, 0xFB, 0xCC, 0x0F,
-    0xF6, 0xA4, 0x1B, 0x87, 0x28, 0xBF, 0x51, 0xFA, 0xE4, 0x9A, 0x72, 0xD9, 0x35, 0x72, 0xCB, 0x69,
-    0xAD, 0xAF, 0x42, 0x78, 0xF4, 0xA0, 0x11, 0x37, 0x72, 0x96, 0x8E, 0xFF, 0x0F, 0x5B, 0xE6, 0x12,
-    0xD9, 0x29, 0x50, 0x3E, 0x7F, 0xF1, 0xF5, 0x3F, 0x5F, 0xCD, 0xE0, 0x69, 0x1E, 0x36, 0x6B, 0x49,
-    0xD6, 0xBE, 0xA0, 0x10, 0xFF, 0x2F, 0x63, 0x6A, 0xC9, 0x6F, 0x47, 0x3F, 0x10, 0x2C, 0x81, 0x60,
-    0xE5, 0xF8, 0x46, 0xBD, 0x89, 0x25, 0x21, 0x87, 0x87, 0x46, 0x3D, 0x6C, 0x10, 0xE2, 0xAE, 0x59,
-    0x53, 0xAF, 0x8D, 0x38, 0xE9, 0x9D, 0x9C, 0x97, 0x50, 0x86, 0xC9, 0x0B, 0xC2, 0x09, 0xCF, 0xD6,
-    0x48, 0x4F, 0x5D, 0x16, 0x92, 0x3E, 0x82, 0xC7, 0x4F, 0xF1, 0x64, 0x25, 0x16, 0x4B, 0x0E, 0x1A,
-    0xB1, 0x87, 0xC9, 0x80, 0xEC, 0x98, 0x8A, 0x3A, 0x01, 0xB3, 0x4C, 0x42, 0xB1, 0x92, 0x2B, 0x88,
-    0xB2, 0xD3, 0x41, 0xCE, 0xFF, 0x42, 0x7B, 0x0B, 0x29, 0xBB, 0x1D, 0x92, 0x10, 0x45, 0x07, 0xAD,
-    0xD4, 0xE2, 0xD4, 0xF0, 0xC1, 0xA5, 0x0C, 0xBF, 0xF9, 0x59, 0xE2, 0xDF, 0x2F, 0xA1, 0x93, 0xC3,
-    0x5B, 0x83, 0xDF, 0xB7, 0xFB, 0x91, 0x4C, 0xF9, 0x2F, 0x50, 0xB6, 0x60, 0x7E, 0x46, 0x64, 0xFC,
-    0xA3, 0x17, 0x8D, 0x11, 0x84, 0x47, 0x21, 0xE8, 0x4E, 0x4A, 0xBE, 0x81, 0x07, 0xFB, 0x95, 0xFA,
-    0xC2, 0xAC, 0x2E, 0x5D, 0xA6, 0x27, 0x93, 0xE0, 0x98, 0xFC, 0x92, 0x9B, 0xA1, 0x76, 0xCE, 0xF2,
-    0x5B, 0x5D, 0x6E, 0x3A, 0xF4, 0x13, 0x04, 0x3C, 0xBC, 0x65, 0x25, 0x15, 0x09, 0x97, 0xA3, 0x11,
-    0x72, 0x60, 0x91, 0xD4, 0x31, 0x05, 0x86, 0x14, 0xD8, 0x27, 0xEF, 0x39, 0xBB, 0xC4, 0xC9, 0x21,
-    0x30, 0x8F, 0xA0, 0x1A, 0xF7, 0x73, 0x00, 0xC9, 0x8F, 0x14, 0x71, 0x5A, 0x50, 0x11, 0x2A, 0xFA,
-    0x13, 0x8E, 0x16, 0xFF, 0x45, 0x53, 0x60, 0xF7, 0x19, 0x64, 0x2E, 0x23, 0x3B, 0x80, 0xBD, 0xA9,
-    0x65, 0xE0, 0xF0, 0x51, 0xC5, 0xBD, 0x60, 0xC3, 0x44, 0xEF, 0x29, 0x99, 0x0F, 0x95, 0x16, 0xFD,
-    0xEB, 0xD8, 0xFF, 0x11, 0x32, 0x83, 0x87, 0x01, 0x58, 0x49, 0x49, 0x1B, 0x56, 0xF4, 0x94, 0x25,
-    0x96, 0x2E, 0x90, 0x9D, 0xD7, 0xFA, 0x77, 0xEC, 0x5C, 0xE4, 0x40, 0x57, 0xB5, 0x5F, 0x98, 0xEA,
-    0x4E, 0xB5, 0x0F, 0xE7, 0x50, 0xBE, 0x35, 0xE7, 0x69, 0xA5, 0x72, 0xB1, 0x3C, 0x0E, 0xF6, 0xA8,
-    0x9C, 0xC7, 0x49, 0xCE, 0x13, 0x6D, 0xCD, 0x79, 0xE4, 0xD8, 0x98, 0xA4, 0xA9, 0xDE, 0x90, 0x42,
-    0xA4, 0xDF, 0x14, 0x39, 0x5D, 0x41, 0x48, 0x3B, 0x5F, 0x8C, 0xD5, 0x8B, 0x34, 0x7C, 0xF9, 0x51,
-    0x1F, 0x9E, 0x02, 0x1E, 0x00, 0xE9, 0xF4, 0x25, 0x60, 0x5B, 0x99, 0xC7, 0xEF, 0x99, 0x3F, 0xC8,
-    0xF9, 0x80, 0x88, 0x75, 0xA2, 0x16, 0xA9, 0x03, 0x6B, 0x94, 0x8B, 0xF2, 0x54, 0x10, 0xFB, 0x73,
-    0x25, 0x9A, 0xB8, 0xB1, 0x5D, 0x68, 0x53, 0xDA, 0xF8, 0x78, 0xDA, 0x86, 0x3E, 0xAC, 0x4A, 0xE2,
-    0xB3, 0x29, 0x9E, 0x4A, 0x43, 0x49, 0x4E, 0x76, 0xB2, 0xA9, 0xBD, 0xFF, 0x60, 0xE3, 0x21, 0xD9,
-    0xE2, 0x72, 0x46, 0xE1, 0xB7, 0x24, 0x79, 0x62, 0xDE, 0xD6, 0x4C, 0xB2, 0xBA, 0x07, 0x24, 0xCB,
-    0x5E, 0xB1, 0xD4, 0x5C, 0xCB, 0x5A, 0x7D, 0x89, 0xCC, 0xCD, 0x6E, 0x64, 0x6E, 0xD1, 0x22, 0x20,
-    0x2E, 0xCA, 0x7E, 0x15, 0x03, 0x6E, 0xA9, 0xE6, 0xA3, 0x46, 0xC1, 0x28, 0x21, 0x4D, 0xE9, 0x73,
-    0x10, 0x20, 0x05, 0x80, 0x0C, 0x79, 0x11, 0xD2, 0x22, 0x86, 0xB4, 0x4D, 0xB5, 0x3A, 0x76, 0x98,
-    0x65, 0x40, 0xB5, 0x7F, 0x54, 0x11, 0xEF, 0xF7, 0x0C, 0xB5, 0xD0, 0x09, 0x2A, 0x1C, 0xAB, 0x3F,
-    0xCA, 0x67, 0x81, 0x42, 0xE2, 0xE8, 0x0F, 0x2D, 0x6A, 0x1E, 0x5A, 0x0C, 0xE5, 0xD0, 0x62, 0x0A,
-    0x37, 0x07, 0x9E, 0xF5, 0x01, 0x0B, 0x37, 0x75, 0x72, 0xA3, 0xCA, 0x79, 0x68, 0x91, 0x3D, 0xC8,
-    0x71, 0x4C, 0xAE, 0xF0, 0xD0, 0xA2, 0xD6, 0x45, 0x7E, 0xFE, 0xCC, 0xE6, 0x43, 0x8B, 0x79, 0x95,
-    0xAE, 0xDD, 0x6D, 0x71, 0x63, 0xE2, 0xA2, 0x5E, 0x0E, 0x2D, 0x5E, 0x22, 0x04, 0x31, 0x93, 0x7E,
-    0x09, 0x92, 0xEE, 0x58, 0x77, 0x16, 0x03, 0xF5, 0x87, 0xD1, 0x3C, 0x3E, 0x58, 0x00, 0x66, 0xE5,
-    0xD1, 0xB0, 0x4F, 0xCE, 0x8A, 0x27, 0x4F, 0x28, 0xD7, 0x26, 0x4E, 0xE9, 0x81, 0x47, 0x28, 0xAD,
-    0x9C, 0x9C, 0xAC, 0x5C, 0x1F, 0xAE, 0x77, 0xA7, 0x46, 0x35, 0x8D, 0xBA, 0x54, 0x5A, 0xE7, 0x07,
-    0xAB, 0xEC, 0xFC, 0xF9, 0xF3, 0x4D, 0x72, 0x7B, 0xFD, 0x22, 0x9E, 0x66, 0x6E, 0xF2, 0x24, 0x41,
-    0x6F, 0x4E, 0xE8, 0x64, 0xD0, 0x36, 0x3B, 0x83, 0xEC, 0x63, 0x09, 0xCB, 0xC5, 0xBA, 0x44, 0xA0,
-    0x52, 0xFE, 0x92, 0x41, 0xC3, 0x2F, 0xE7, 0xF2, 0x9F, 0x86, 0xC7, 0x4F, 0x9A, 0x43, 0x60, 0xE5,
-    0xC1, 0xDA, 0xC3, 0xD3, 0xA5, 0xA3, 0xCF, 0xFA, 0x19, 0xA1, 0x96, 0x83, 0x1F, 0x27, 0x97, 0x73,
-    0xDF, 0xFA, 0x40, 0x0D, 0xFB, 0xE3, 0x49, 0xE6, 0x94, 0x59, 0x32, 0x5B, 0x48, 0xA0, 0xC6, 0xBC,
-    0x35, 0x49, 0x06, 0x2D, 0x27, 0xBF, 0x69, 0x6F, 0x92, 0xD1, 0x5B, 0xEF, 0x44, 0x38, 0xE0, 0x04,
-    0x93, 0xC5, 0xA3, 0xD2, 0xFA, 0x03, 0x75, 0x2A, 0x13, 0x89, 0x25, 0xBE, 0xB4, 0x76, 0xE8, 0x2F,
-    0x8F, 0xEA, 0x89, 0x67, 0x91, 0x4E, 0xBB, 0x3D, 0x9C, 0x76, 0x78, 0x1D, 0xD0, 0xCF, 0x2C, 0x0E,
-    0xC3, 0x58, 0xE4, 0x2D, 0x2D, 0x3B, 0x88, 0xC4, 0x6B, 0x16, 0x09, 0xCE, 0x81, 0xD9, 0x1D, 0x7E,
-    0x37, 0x29, 0x64, 0xEC, 0x26, 0xBA, 0xC9, 0x31, 0x91, 0xA7, 0xE7, 0x7E, 0xCE, 0xE4, 0xE9, 0x25,
-    0x56, 0x97, 0x21, 0x3D, 0x8E, 0xC1, 0x93, 0xDC, 0x6C, 0x8D, 0x45, 0x7A, 0x9E, 0x86, 0xD5, 0x42,
-    0x6D, 0x68, 0x7F, 0x4C, 0x93, 0xF2, 0x83, 0xEA, 0x24, 0x96, 0xFE, 0x18, 0xD2, 0x63, 0x09, 0x95,
-    0x81, 0x01, 0xB4, 0x3E, 0xB7, 0x5D, 0x25, 0xD7, 0x7A, 0x75, 0x4A, 0x23, 0xE2, 0xEC, 0x95, 0xC5,
-    0x3F, 0xFE, 0x79, 0xE4, 0xAE, 0xC0, 0xC4, 0xC7, 0xAC, 0x77, 0x6B, 0x23, 0xEB, 0x32, 0xE5, 0x6E,
-    0xE0, 0x1A, 0x38, 0x15, 0x81, 0x3D, 0x01, 0x68, 0x95, 0xEF, 0xB1, 0x88, 0xDC, 0x8D, 0x3A, 0xBB,
-    0x33, 0x2C, 0x12, 0x65, 0x09, 0x76, 0x5A, 0x6A, 0xB0, 0x32, 0x97, 0x04, 0x2F, 0xC8, 0x71, 0x32,
-    0x31, 0x10, 0x4E, 0x73, 0x78, 0xC7, 0xE8, 0x07, 0x44, 0x4E, 0xF3, 0xE2, 0xA4, 0xCF, 0x05, 0x84,
-    0x72, 0x92, 0x48, 0xE9, 0x4F, 0xF8, 0x0D, 0x0B, 0x7E, 0xDC, 0x44, 0xF9, 0x13, 0x6B, 0xB9, 0x44,
-    0xAB, 0xD8, 0xBB, 0x29, 0x49, 0x6B, 0x98, 0x1F, 0xF1, 0x5B, 0x47, 0x46, 0x99, 0xED, 0x56, 0xE5,
-    0x5F, 0xBE, 0xFC, 0xB1, 0xE2, 0x80, 0x46, 0x21, 0xA7, 0xEA, 0xCA, 0x35, 0x77, 0x98, 0x8C, 0xAD,
-    0x4C, 0x86, 0x8C, 0xAF, 0x3C, 0x47, 0x4F, 0xB8, 0x36, 0x86, 0x3C, 0x6D, 0xA1, 0xDC, 0xAF, 0xE8,
-    0xD1, 0x99, 0xA0, 0xE8, 0x2E, 0x60, 0x46, 0xFE, 0x6B, 0xB0, 0x99, 0xCE, 0x72, 0xFA, 0xBB, 0xE5,
-    0x28, 0x28, 0xBF, 0xD1, 0x20, 0xAB, 0x10, 0x69, 0x78, 0x42, 0x96, 0x9C, 0xFD, 0xF9, 0xE2, 0x10,
-    0x6C, 0xFF, 0x85, 0xAD, 0x02, 0xDF, 0x41, 0x97, 0xC4, 0x3A, 0xBD, 0xB3, 0x7F, 0x6B, 0xAB, 0x60,
-    0x1E, 0x7A, 0x5D, 0xBC, 0xA8, 0x15, 0x49, 0x33, 0x6B, 0x45, 0xBF, 0xD0, 0x8A, 0xFC, 0x63, 0x66,
-    0x44, 0xB8, 0x1F, 0x39, 0x0D, 0x0F, 0x36, 0xC5, 0x3D, 0x00, 0xA6, 0x9B, 0x52, 0x6A, 0xF8, 0xAF,
-    0x94, 0x3F, 0x3C, 0xF7, 0x54, 0x6C, 0x4F, 0xCA, 0x39, 0x7E, 0xB3, 0xA9, 0x34, 0x71, 0xD0, 0x15,
-    0x52, 0x20, 0x21, 0xC7, 0x1A, 0x76, 0x19, 0xD9, 0x3C, 0x10, 0xF7, 0x87, 0xD7, 0x33, 0x54, 0x7B,
-    0x4E, 0x5D, 0x61, 0xA1, 0xEB, 0x93, 0x6E, 0x39, 0x14, 0x00, 0xDB, 0xAA, 0x32, 0x0E, 0x2C, 0x20,
-    0x7D, 0x77, 0x55, 0x26, 0x21, 0x72, 0xE1, 0x95, 0x39, 0x6A, 0x84, 0xC4, 0xBE, 0xFB, 0xE3, 0xD0,
-    0x0F, 0x46, 0xA7, 0xDD, 0xB3, 0xC4, 0x62, 0x56, 0x7F, 0x62, 0xF6, 0x34, 0xFA, 0x2C, 0x74, 0xD3,
-    0x1E, 0x04, 0xE6, 0xEE, 0x16, 0x01, 0x35, 0x6C, 0xDE, 0x53, 0xD1, 0x2D, 0xE8, 0x0F, 0x5E, 0xB3,
-    0xDA, 0x7C, 0xAD, 0x04, 0x3D, 0x97, 0x14, 0x99, 0x1F, 0x13, 0xF7, 0x2A, 0x9F, 0xB3, 0xE4, 0x8D,
-    0xC8, 0x38, 0xAE, 0x28, 0x39, 0x9A, 0x0A, 0xE6, 0xAF, 0x38, 0x07, 0x8D, 0x78, 0xF3, 0xDE, 0xC1,
-    0x8B, 0x7D, 0x7A, 0x13, 0x5A, 0xAA, 0x7F, 0x39, 0xCA, 0x19, 0xAB, 0x85, 0x34, 0x9F, 0x7B, 0xD2,
-    0x17, 0xD0, 0x05, 0x38, 0x25, 0xD7, 0x24, 0xFD, 0xDA, 0x16, 0x6C, 0x34, 0x3D, 0x4F, 0xC9, 0xF9,
-    0x4B, 0xF8, 0x33, 0x8E, 0xC0, 0xF2, 0x0C, 0x0A, 0x50, 0x0D, 0x6D, 0x98, 0x58, 0xA4, 0x61, 0xC1,
-    0x92, 0x06, 0x42, 0xE0, 0xA6, 0x0F, 0x5C, 0x9E, 0x75, 0xD2, 0x0F, 0x4D, 0xCA, 0x01, 0x0F, 0x51,
-    0xCD, 0xC0, 0x95, 0x3C, 0x52, 0x9A, 0xDD, 0x9C, 0xA4, 0x04, 0xBF, 0x9B, 0xC9, 0x6F, 0xCA, 0xC9,
-    0x7B, 0x9E, 0xE8, 0xE5, 0x88, 0x72, 0x3C, 0xCA, 0xA9, 0x15, 0xCD, 0x26, 0x5F, 0x2B, 0x07, 0xEC,
-    0x04, 0x31, 0x07, 0xC7, 0xFE, 0x51, 0x9C, 0xA6, 0x4C, 0xE9, 0x46, 0x9D, 0xB8, 0xD4, 0x6D, 0xDB,
-    0x36, 0xBE, 0xFE, 0xA6, 0x42, 0xAE, 0x0E, 0xEB, 0x2A, 0x0C, 0x11, 0x01, 0xCC, 0x15, 0x49, 0x7E,
-    0xDE, 0xB0, 0xD6, 0xAA, 0xA6, 0xEC, 0x43, 0x06, 0x8E, 0xAB, 0xA3, 0x54, 0xF6, 0x9D, 0xAF, 0x59,
-    0x11, 0x3E, 0x01, 0x3D, 0xB3, 0x05, 0x02, 0x51, 0xF1, 0x2C, 0x66, 0x6F, 0x80, 0x56, 0x9F, 0xA5,
-    0x9D, 0xFE, 0x2B, 0x41, 0x21, 0x96, 0x29, 0x79, 0xA2, 0x7F, 0xF9, 0x1D, 0x3B, 0xC9, 0x4B, 0x95,
-    0x2A, 0xF3, 0x2A, 0x18, 0x3F, 0x58, 0x48, 0xEF, 0xEB, 0xFA, 0x9E, 0x82, 0x1F, 0x7C, 0x97, 0x53,
-    0x43, 0x9C, 0x4B, 0xDA, 0x2B, 0xEB, 0x9E, 0xE4, 0xB9, 0xBC, 0x3A, 0xC7, 0xAA, 0x7E, 0x3E, 0x7C,
-    0xDB, 0x41, 0x1E, 0x05, 0xA0, 0x9C, 0x7F, 0xB4, 0xD0, 0xB4, 0x53, 0x66, 0xC8, 0x99, 0x9C, 0x0D,
-    0xF3, 0x8C, 0xD0, 0xE8, 0x4F, 0x26, 0xE0, 0xE7, 0xFD, 0x65, 0x2B, 0x75, 0x2C, 0x2A, 0x12, 0xDB,
-    0x0B, 0x8C, 0x32, 0x3C, 0x2A, 0x23, 0x07, 0xD7, 0x18, 0xDF, 0x69, 0x62, 0xBE, 0x2B, 0xF7, 0x7D,
-    0x70, 0x5C, 0xDF, 0x60, 0xEB, 0x9F, 0x67, 0x02, 0x67, 0x2D, 0x7A, 0x65, 0xF5, 0xC4, 0x72, 0x2D,
-    0x95, 0xB7, 0x02, 0xD0, 0x08, 0xCD, 0xE2, 0xB9, 0x68, 0xA3, 0x3F, 0xF6, 0x5F, 0x5C, 0xB2, 0x63,
-    0xB1, 0x9E, 0xAE, 0x37, 0x1F, 0x1F, 0xFF, 0xF3, 0x90, 0xEB, 0xD1, 0xC9, 0x0F, 0xEA, 0xD9, 0xE5,
-    0x99, 0x4B, 0x4E, 0xB4, 0xA7, 0xE0, 0x85, 0x24, 0xCE, 0xDF, 0xC8, 0xD7, 0x25, 0xEC, 0x58, 0x95,
-    0x73, 0xE2, 0x46, 0x82, 0xE0, 0x93, 0xC7, 0x9E, 0x3C, 0x8A, 0x5B, 0xB2, 0x26, 0x3B, 0x3D, 0x3E,
-    0x38, 0x7D, 0x5E, 0x2A, 0x97, 0x40, 0x6D, 0x4D, 0xC4, 0x13, 0x40, 0x0D, 0x82, 0x4B, 0xB0, 0x18,
-    0xFC, 0x56, 0xEF, 0xFD, 0x00, 0x5B, 0x3C, 0xD7, 0x2A, 0x8A, 0x78, 0xA9, 0xF6, 0x49, 0x2B, 0x7D,
-    0x26, 0x03, 0x72, 0xB3, 0x29, 0x60, 0xBE, 0x80, 0x54, 0x06, 0xCB, 0xF1, 0x7B, 0x0D, 0x76, 0xDE,
-    0x85, 0x09, 0x18, 0xA0, 0x1F, 0x04, 0x9B, 0xE4, 0xF6, 0xC0, 0x3A, 0x29, 0x20, 0xDD, 0x95, 0x06,
-    0x9B, 0x42, 0x1C, 0xC9, 0x39, 0xE1, 0xE2, 0x58, 0x58, 0x23, 0x90, 0xE2, 0xFC, 0x6F, 0xD9, 0x10,
-    0x9A, 0xC2, 0xC8, 0xE2, 0xDB, 0x0C, 0x1E, 0xC5, 0xAC, 0x47, 0xAB, 0xEA, 0x1D, 0xDC, 0x76, 0x01,
-    0xAB, 0x67, 0xF5, 0xC6, 0x18, 0xB8, 0x9C, 0x4D, 0x63, 0xE1, 0xC9, 0xF0, 0x7B, 0x72, 0x74, 0x6B,
-    0xD8, 0x63, 0xBE, 0x52, 0x67, 0xFD, 0x3C, 0x75, 0xD5, 0xBE, 0xC7, 0x04, 0x8A, 0xDF, 0x4D, 0x05,
-    0x01, 0xCD, 0xC4, 0x3E, 0x34, 0xDD, 0x67, 0x19, 0x36, 0xA8, 0xDB, 0x85, 0xFF, 0x2E, 0x83, 0x3D,
-    0xAD, 0xCA, 0xE8, 0xA9, 0x3F, 0x9F, 0xBF, 0xCB, 0xC0, 0xFD, 0x3F, 0xBE, 0xCB, 0x00, 0xAA, 0x09,
-    0x8B, 0xDB, 0x50, 0xCD, 0xC5, 0xB9, 0x4D, 0x8E, 0x72, 0x21, 0xFA, 0x5E, 0xEE, 0xA3, 0xFB, 0x23,
-    0xAB, 0x7C, 0x65, 0x59, 0xE7, 0xE7, 0xBB, 0xF4, 0xD6, 0x98, 0xF4, 0x25, 0x0B, 0x30, 0x8B, 0x73,
-    0x9B, 0xFF, 0x7F, 0xCC, 0x1C, 0xAA, 0xF0, 0xC2, 0x31, 0xA4, 0xA5, 0xB0, 0x02, 0x44, 0xEC, 0xA5,
-    0x64, 0xBF, 0x76, 0xB2, 0x5E, 0x7D, 0x0E, 0xC2, 0xA8, 0xD3, 0xB3, 0xED, 0x2C, 0xD7, 0x0D, 0x66,
-    0xB5, 0x44, 0x01, 0x64, 0x16, 0x69, 0x74, 0xAE, 0xBC, 0x54, 0x2E, 0x98, 0x75, 0x63, 0x33, 0xB3,
-    0x9E, 0x8C, 0x2B, 0x71, 0x70, 0x1A, 0xD8, 0x69, 0xF6, 0x6D, 0x5F, 0xEB, 0xB1, 0xEB, 0xF7, 0x7E,
-    0x00, 0xD7, 0x1E, 0x0E, 0xA3, 0x0F, 0x10, 0x7F, 0xD0, 0x61, 0x2A, 0xB5, 0xC2, 0x71, 0x2C, 0x9F,
-    0x74, 0xB6, 0xDF, 0xE4, 0x37, 0x16, 0xF1, 0x39, 0x91, 0x40, 0x9C, 0x69, 0x31, 0x29, 0xBF, 0x2A,
-    0xF9, 0x34, 0x3B, 0xDF, 0x12, 0x70, 0x26, 0x3E, 0x79, 0xE7, 0x20, 0x39, 0x85, 0x17, 0x2A, 0xE7,
-    0x67, 0x4C, 0xB1, 0xF5, 0x78, 0x60, 0x3A, 0xB3, 0x89, 0xA8, 0x23, 0x94, 0xEC, 0xCC, 0x3F, 0x26,
-    0xF4, 0x67, 0xC3, 0x0E, 0xB7, 0xFE, 0x3B, 0x8A, 0xA8, 0xDA, 0xEA, 0xE9, 0xA7, 0x17, 0x89, 0x96,
-    0x9C, 0x4F, 0x30, 0x85, 0x96, 0x23, 0x43, 0xE1, 0x24, 0x69, 0xAD, 0x9C, 0x71, 0x4B, 0x2F, 0x58,
-    0xDF, 0x76, 0x4D, 0xEE, 0xB2, 0x5C, 0x2A, 0xA7, 0xE5, 0x6A, 0x89, 0xB1, 0x1C, 0x16, 0xF3, 0x6E,
-    0x36, 0x19, 0x7D, 0xAB, 0x53, 0x06, 0x3A, 0x4C, 0xB7, 0xDC, 0xD1, 0x61, 0x26, 0x1D, 0xF8, 0x6C,
-    0xD4, 0x1B, 0x21, 0xEB, 0x15, 0xB5, 0x83, 0x5F, 0x54, 0xD0, 0xD2, 0xC0, 0xE5, 0xDB, 0x75, 0x78,
-    0x1C, 0x17, 0x31, 0x94, 0x53, 0xE6, 0x54, 0xD3, 0x42, 0xE5, 0x27, 0x81, 0xA4, 0x6F, 0x34, 0x7E,
-    0xBC, 0x52, 0xA6, 0x55, 0xE6, 0x92, 0xB5, 0xC0, 0x03, 0xE3, 0x0F, 0x96, 0x30, 0xE7, 0x95, 0x5A,
-    0xB1, 0xD9, 0x08, 0xD2, 0xC8, 0x87, 0xE0, 0xC2, 0xE0, 0x19, 0x7E, 0x08, 0x35, 0x4A, 0x8E, 0x7C,
-    0xA3, 0xD2, 0xF2, 0x5D, 0xFE, 0xDB, 0x32, 0x38, 0x09, 0xB4, 0x9E, 0x02, 0x67, 0xBC, 0xD4, 0x6C,
-    0xC8, 0x8D, 0x3B, 0x94, 0x53, 0xF9, 0x52, 0x03, 0xA2, 0xE0, 0xB8, 0x45, 0xA6, 0x7E, 0x82, 0x9F,
-    0x45, 0x72, 0xB1, 0x7C, 0x21, 0x86, 0xE0, 0x42, 0x5F, 0xDE, 0xF0, 0x0F, 0x64, 0xC4, 0x64, 0x0A,
-    0x43, 0xD9, 0x49, 0x66, 0x6F, 0x66, 0xDD, 0xF7, 0xF0, 0x1E, 0x9E, 0x8F, 0xE8, 0x7E, 0x76, 0x7C,
-    0x90, 0xD7, 0x47, 0xC8, 0x2A, 0xDF, 0x60, 0x09, 0xAE, 0x4E, 0x10, 0x2E, 0x38, 0xB9, 0x69, 0xD9,
-    0x3D, 0x33, 0x05, 0x7C, 0xC1, 0xFF, 0x9C, 0x6B, 0xA6, 0x30, 0xD8, 0x53, 0xA6, 0x58, 0x7C, 0xFB,
-    0xC8, 0x83, 0x5F, 0xE5, 0x04, 0xF3, 0x4D, 0x2F, 0x77, 0x0A, 0x1B, 0x99, 0x57, 0x3D, 0x11, 0x9C,
-    0x40, 0x96, 0xBB, 0xB6, 0x38, 0x2C, 0x9C, 0xF4, 0x9A, 0xD3, 0x84, 0x1A, 0x98, 0x0E, 0xDE, 0xE2,
-    0x46, 0x13, 0x7F, 0x34, 0x6E, 0x74, 0x68, 0xE6, 0x6F, 0x7E, 0xFB, 0x92, 0x5F, 0x19, 0xC5, 0xE9,
-    0x43, 0xE7, 0xCB, 0xCB, 0xD2, 0x0D, 0x29, 0x96, 0x73, 0x38, 0xF3, 0xA0, 0xEB, 0xA3, 0x06, 0x44,
-    0xFC, 0xB7, 0x71, 0x49, 0x29, 0xC6, 0x0F, 0x8C, 0xF4, 0x94, 0x5B, 0xE6, 0x24, 0x09, 0x4C, 0x96,
-    0x89, 0xAE, 0xB4, 0x00, 0xE2, 0x23, 0x8D, 0x7C, 0x8D, 0x21, 0x57, 0x1B, 0x0F, 0xF1, 0x37, 0x33,
-    0x00, 0xF5, 0x06, 0xE2, 0xBF, 0x7A, 0xC9, 0xC9, 0x40, 0x0E, 0xAB, 0x1E, 0xFE, 0x8B, 0xA7, 0xE4,
-    0x18, 0x31, 0x3F, 0x77, 0x7B, 0xF9, 0x25, 0x54, 0x9C, 0x34, 0x21, 0xE2, 0x64, 0x77, 0xE5, 0xE4,
-    0xC8, 0x2F, 0xDA, 0xE3, 0xF7, 0x21, 0xB0, 0xF8, 0xCE, 0xD9, 0xDD, 0x72, 0xE7, 0x10, 0x4C, 0xEC,
-    0x58, 0x02, 0x0F, 0x02, 0x4F, 0x01, 0x9D, 0xEE, 0x24, 0x88, 0xE8, 0xF9, 0xF5, 0x0E, 0x93, 0x4F,
-    0xD9, 0x7F, 0xF6, 0x5D, 0xD6, 0xFC, 0xB4, 0xF2, 0x96, 0xB0, 0xB4, 0xBA, 0xAF, 0xF1, 0x40, 0xE9,
-    0x97, 0x1A, 0x0D, 0x72, 0xC7, 0xC5, 0xA7, 0xB1, 0x25, 0xE2, 0x36, 0x2A, 0x0C, 0x2C, 0xEF, 0x48,
-    0x33, 0xB9, 0x58, 0x4C, 0x69, 0xFC, 0xBE, 0x43, 0x43, 0x32, 0x36, 0x50, 0x0B, 0xD4, 0x99, 0xD5,
-    0xC2, 0xC9, 0x52, 0xD9, 0xB8, 0x51, 0xE3, 0xFA, 0xBA, 0xFA, 0x40, 0xF6, 0x18, 0xFB, 0x40, 0xDD,
-    0x17, 0xF4, 0x81, 0x4A, 0xB9, 0xAF, 0xF0, 0x67, 0xD1, 0xA4, 0x6B, 0x36, 0x0F, 0xCB, 0xD1, 0x32,
-    0x4D, 0x25, 0x5F, 0x24, 0xC5, 0x61, 0x88, 0x4C, 0xCE, 0xFB, 0xD4, 0x52, 0x13, 0x11, 0x0B, 0xE4,
-    0x31, 0x7A, 0xFE, 0x32, 0xFB, 0xB4, 0x97, 0x7E, 0x10, 0xBF, 0xF7, 0x29, 0xED, 0xC9, 0x0B, 0x29,
-    0x30, 0xC8, 0x41, 0x8D, 0xD1, 0xE3, 0x4A, 0x96, 0x1D, 0xA2, 0x87, 0xB7, 0x95, 0x3D, 0xB0, 0xAD,
-    0x5B, 0x8B, 0x6D, 0xFD, 0xDA, 0xDD, 0x2F, 0x24, 0x57, 0x0D, 0x24, 0x61, 0x3D, 0xE9, 0x3E, 0xDB,
-    0xF2, 0x9D, 0x38, 0xC9, 0x03, 0xDF, 0x89, 0xC3, 0x0A, 0x17, 0xB9, 0xF6, 0x48, 0x9A, 0xBF, 0xE3,
-    0x98, 0x08, 0xCA, 0xD7, 0xB9, 0xD5, 0x81, 0xB1, 0x47, 0x67, 0x9A, 0x39, 0x76, 0x37, 0x9F, 0x07,
-    0xEF, 0xB1, 0xD4, 0xFF, 0x05, 0x9D, 0x57, 0x3F, 0x6C, 0x16, 0xC9, 0x15, 0x7F, 0xBB, 0x8B, 0x59,
-    0x8E, 0x81, 0x1B, 0x0A, 0x53, 0x5C, 0x8E, 0xD3, 0xA6, 0x48, 0xE1, 0xA3, 0x60, 0xAF, 0x48, 0x24,
-    0x0A, 0xDB, 0xB3, 0xE4, 0x14, 0x5D, 0x91, 0x02, 0x17, 0x58, 0x8A, 0xD2, 0xD0, 0x50, 0xA0, 0x6B,
-    0x48, 0xC9, 0x49, 0xE0, 0x5D, 0x0E, 0x29, 0x2E, 0x88, 0x74, 0x34, 0xA9, 0xE3, 0x82, 0x02, 0x39,
-    0x05, 0x4D, 0x0A, 0x0A, 0x3E, 0x7F, 0x8B, 0xBF, 0x02, 0x29, 0x2E, 0xBC, 0x80, 0x22, 0xA4, 0x5C,
-    0x24, 0x86, 0x1C, 0x91, 0x25, 0x28, 0x98, 0x84, 0x25, 0x5E, 0x60, 0x76, 0x27, 0xBF, 0x37, 0xFB,
-    0x19, 0x63, 0x82, 0x29, 0x6E, 0xBE, 0xEF, 0xDB, 0x37, 0x3B, 0xEF, 0xCD, 0x7B, 0x6F, 0xDE, 0xBF,
-    0x79, 0x1F, 0xD1, 0x41, 0x3A, 0x98, 0xDA, 0xA5, 0x7B, 0x7F, 0xD8, 0x4F, 0x53, 0xB4, 0x14, 0x16,
-    0xEF, 0x01, 0xC4, 0xE3, 0x48, 0x50, 0xCA, 0xEE, 0xC8, 0xD4, 0x91, 0xF7, 0x93, 0xF4, 0x80, 0x26,
-    0x4E, 0xA9, 0x36, 0xB7, 0xB9, 0xDD, 0x82, 0xD8, 0x17, 0x3A, 0x67, 0x95, 0x73, 0xAB, 0xCB, 0xCB,
-    0xD7, 0xF1, 0xA6, 0x5C, 0x9B, 0x3B, 0xFB, 0xB5, 0x9F, 0xFB, 0x57, 0x0C, 0xAC, 0x60, 0x60, 0x71,
-    0x79, 0x79, 0xF7, 0xF5, 0x5B, 0xD1, 0xF7, 0xE5, 0xCC, 0x8F, 0x7C, 0x9C, 0x0D, 0xAF, 0x1E, 0x9E,
-    0x3F, 0x05, 0xD1, 0x13, 0xF3, 0xA7, 0xC0, 0x3C, 0x77, 0xCD, 0xD7, 0xCB, 0xD7, 0x42, 0x23, 0xCB,
-    0x36, 0x36, 0xEA, 0x52, 0x1B, 0xCC, 0x11, 0x60, 0xD9, 0x0A, 0xAD, 0x82, 0x26, 0xC8, 0x28, 0x6A,
-    0x92, 0xB2, 0x8B, 0x4C, 0x5A, 0xB0, 0xFA, 0x4A, 0x8E, 0x8C, 0x4D, 0x45, 0x39, 0x17, 0x9A, 0xD9,
-    0xC8, 0x58, 0x79, 0xD7, 0x26, 0xA3, 0x5A, 0x2D, 0x9A, 0xFC, 0xA4, 0x3E, 0x3C, 0x91, 0xC5, 0xA6,
-    0x93, 0x8F, 0xAC, 0x5C, 0x6D, 0xD2, 0xCB, 0x46, 0x09, 0xBD, 0x20, 0xCB, 0xC9, 0x09, 0xEC, 0x1F,
-    0x06, 0x56, 0x15, 0x5D, 0x52, 0x62, 0x09, 0x08, 0x79, 0xBB, 0xE6, 0x33, 0xE5, 0xF2, 0x81, 0x69,
-    0x95, 0xBC, 0x6F, 0x06, 0x69, 0xFC, 0xA8, 0x9E, 0x9D, 0x80, 0x24, 0x95, 0x91, 0xA5, 0x48, 0x93,
-    0xCC, 0xE8, 0x02, 0x39, 0xB7, 0xE1, 0xDC, 0x6F, 0x17, 0xCE, 0x92, 0xA1, 0xB8, 0xA4, 0x94, 0xA8,
-    0xA1, 0x58, 0x53, 0xEA, 0x49, 0x0C, 0x25, 0x25, 0xAD, 0x80, 0x33, 0xF8, 0xF0, 0x43, 0x11, 0xAF,
-    0xD1, 0x0C, 0x85, 0x7F, 0x7E, 0x52, 0x28, 0x67, 0x63, 0xE7, 0x0A, 0xD0, 0x53, 0x52, 0x50, 0x08,
-    0x80, 0xCD, 0xA1, 0xA1, 0xD4, 0xB5, 0x91, 0x73, 0xE5, 0xD1, 0xC1, 0x75, 0x12, 0x25, 0x81, 0x0D,
-    0x33, 0x61, 0xB4, 0xA8, 0x53, 0xAB, 0xBA, 0x1C, 0x1F, 0xD5, 0xA6, 0x76, 0xEF, 0xD2, 0x3E, 0xFA,
-    0x18, 0xA8, 0xD4, 0x28, 0x0B, 0xAF, 0xE9, 0x15, 0xEF, 0x70, 0x71, 0xB9, 0x55, 0xF7, 0xED, 0x1E,
-    0x3A, 0x46, 0x17, 0x87, 0x97, 0x9C, 0xFB, 0xD6, 0x0D, 0x83, 0x76, 0x92, 0x0E, 0x1D, 0xA3, 0x9B,
-    0xE1, 0x3F, 0x3B, 0x51, 0xAB, 0xF5, 0x46, 0x55, 0x2E, 0x2D, 0x87, 0x51, 0x33, 0x49, 0x73, 0x01,
-    0xC8, 0xAD, 0x1A, 0x35, 0x7B, 0xD8, 0xDD, 0x7F, 0xDF, 0x35, 0x8E, 0x18, 0x60, 0x04, 0x4E, 0x7F,
-    0x20, 0x86, 0x00, 0x88, 0xA4, 0xEB, 0xC7, 0x7E, 0x5A, 0x7A, 0xDF, 0x17, 0x04, 0x5D, 0x79, 0x80,
-    0x4A, 0xB9, 0x3B, 0x81, 0x70, 0xF4, 0x45, 0x84, 0x38, 0xDA, 0x95, 0x60, 0x3C, 0x86, 0xDE, 0x6E,
-    0xE4, 0x1A, 0xB6, 0x0F, 0xE5, 0x43, 0xBA, 0xE5, 0x9D, 0x5E, 0x5E, 0x04, 0x48, 0x46, 0x66, 0x16,
-    0x20, 0xD6, 0x56, 0x71, 0x20, 0xD7, 0x0B, 0x70, 0x06, 0xD1, 0x40, 0x9D, 0xBE, 0xA2, 0xC3, 0x26,
-    0x79, 0xB6, 0xFE, 0xD0, 0x45, 0x6E, 0xE4, 0x1E, 0xAE, 0x3F, 0xBB, 0xFF, 0xBA, 0xCE, 0xD7, 0x1E,
-    0xFC, 0xE7, 0x85, 0x5D, 0xA0, 0xF8, 0x87, 0x7A, 0x30, 0x48, 0x0A, 0x84, 0x4A, 0x9A, 0x8B, 0x2A,
-    0x32, 0x4A, 0xAE, 0x8F, 0x4C, 0x58, 0xCB, 0xD1, 0x73, 0x63, 0x83, 0x26, 0xDA, 0xAC, 0xDB, 0x16,
-    0x92, 0x86, 0x36, 0x75, 0x00, 0xB2, 0x89, 0x3A, 0xFA, 0xBF, 0x91, 0x6A, 0x9A, 0xF5, 0x13, 0xE9,
-    0x0A, 0x59, 0x7A, 0x8B, 0x75, 0x16, 0xFE, 0xA4, 0x6D, 0xCD, 0xA0, 0x14, 0x62, 0xB1, 0xF0, 0xB3,
-    0x05, 0x44, 0xA8, 0x9F, 0x88, 0xBB, 0xCD, 0xA0, 0xE7, 0x30, 0x56, 0x91, 0x56, 0xE2, 0xD7, 0xCF,
-    0x37, 0x5D, 0xE9, 0xBC, 0x67, 0x6D, 0xD7, 0xAA, 0xE1, 0x49, 0x77, 0xD7, 0xA5, 0xA7, 0xD7, 0x1E,
-    0xFC, 0xFB, 0xE5, 0x1B, 0x5D, 0x6F, 0x7C, 0xA5, 0xC9, 0x2A, 0xF1, 0x70, 0x75, 0xD3, 0x0C, 0x48,
-    0x41, 0x71, 0xAB, 0x94, 0xAC, 0x44, 0xC5, 0x9A, 0x6F, 0x2B, 0xAD, 0xF2, 0x42, 0x21, 0xA2, 0x84,
-    0x5B, 0x75, 0x48, 0x1C, 0x72, 0x85, 0xD2, 0xA2, 0x79, 0x4B, 0xE9, 0x16, 0x74, 0x46, 0x54, 0x12,
-    0x54, 0xA8, 0x03, 0xAD, 0x2C, 0x93, 0x6F, 0xEB, 0xC8, 0xE4, 0x34, 0x90, 0xA5, 0xBC, 0x84, 0xD9,
-    0x2C, 0x4D, 0xED, 0x2D, 0x18, 0x71, 0xBB, 0x09, 0x9A, 0xF4, 0x4B, 0x03, 0x9C, 0xD0, 0xA2, 0xB2,
-    0x1E, 0x9D, 0x42, 0xAE, 0xBE, 0xC8, 0x14, 0x67, 0x11, 0xF0, 0x39, 0xB5, 0xD4, 0x84, 0x26, 0xAA,
-    0xF6, 0x66, 0x20, 0x8C, 0xCD, 0x0A, 0xB3, 0x03, 0x55, 0x68, 0x14, 0xCD, 0xC4, 0xE5, 0xDE, 0xEC,
-    0x1A, 0x96, 0x73, 0xC2, 0xFE, 0x96, 0xF9, 0x59, 0x6A, 0x92, 0x5F, 0x1A, 0x20, 0x23, 0x1D, 0x55,
-    0x17, 0x04, 0xE3, 0xBD, 0x7F, 0x0F, 0x92, 0x2C, 0x62, 0x13, 0xFD, 0x23, 0xBC, 0x73, 0x42, 0x6B,
-    0x73, 0xFC, 0x2F, 0x92, 0xE8, 0x10, 0x32, 0x4D, 0x1A, 0x7C, 0x6A, 0xD1, 0x44, 0xF0, 0x02, 0x49,
-    0x1D, 0x5A, 0xCA, 0xE9, 0x23, 0xA2, 0x4C, 0x94, 0x52, 0x0B, 0x13, 0x61, 0x3D, 0xB2, 0xD2, 0xA4,
-    0xD5, 0x30, 0x5B, 0xA0, 0x7D, 0x60, 0x83, 0x98, 0x26, 0xB8, 0x61, 0x1F, 0xD9, 0xB8, 0x16, 0xA5,
-    0x2A, 0x2D, 0x88, 0xEC, 0x1E, 0x61, 0x48, 0x95, 0x78, 0x44, 0x78, 0x85, 0x57, 0xD6, 0x0C, 0xFD,
-    0x24, 0x72, 0xE6, 0x73, 0xA9, 0x95, 0x49, 0x46, 0x8D, 0x00, 0xED, 0x2D, 0xE1, 0xCA, 0x86, 0xC4,
-    0x26, 0xC2, 0x4A, 0x18, 0x55, 0x10, 0xF3, 0x26, 0xDE, 0x56, 0x08, 0x93, 0x42, 0x8C, 0x49, 0x2A,
-    0x45, 0x5F, 0xC4, 0x75, 0x84, 0x98, 0x3A, 0xC3, 0x2E, 0x8E, 0x1B, 0xD1, 0xA4, 0x55, 0x5A, 0x39,
-    0x72, 0x5E, 0x07, 0x2D, 0x75, 0x9E, 0xE5, 0x27, 0x6C, 0x08, 0x11, 0xCC, 0x41, 0x15, 0x38, 0x6E,
-    0x04, 0xC3, 0x25, 0xE5, 0xD8, 0xE6, 0xA1, 0x11, 0x45, 0xA2, 0x87, 0xD9, 0xF0, 0x72, 0x1B, 0xB0,
-    0x1E, 0xD9, 0x44, 0x1F, 0x3F, 0xAD, 0x70, 0x5D, 0x82, 0xAA, 0xBB, 0x51, 0xA7, 0x27, 0x4B, 0x9B,
-    0x47, 0x9B, 0x0D, 0x22, 0x49, 0x35, 0x81, 0x63, 0xF9, 0x3E, 0x86, 0x39, 0x5A, 0x0A, 0x1A, 0x66,
-    0x51, 0xCB, 0x4B, 0xD8, 0x76, 0x78, 0x7E, 0x5E, 0xB9, 0x2E, 0x77, 0x6D, 0x8F, 0x8C, 0x88, 0x0E,
-    0x1C, 0xA7, 0xE8, 0x92, 0x0E, 0xB4, 0x78, 0xD2, 0xD0, 0xA7, 0x2F, 0x89, 0xCE, 0x5D, 0x45, 0x85,
-    0xA2, 0x3A, 0xD0, 0x9A, 0x3E, 0x5B, 0xA2, 0xB0, 0x78, 0xE3, 0xF9, 0x69, 0x04, 0x2A, 0xF4, 0xD7,
-    0xFD, 0x2C, 0xDB, 0x9A, 0x09, 0xCC, 0x8C, 0xAF, 0x54, 0x6C, 0xA1, 0xCD, 0x8C, 0xA6, 0x7F, 0x4E,
-    0xF1, 0xE5, 0x82, 0xCC, 0x34, 0xCD, 0x84, 0xE5, 0x5B, 0x91, 0x13, 0x8C, 0xC3, 0x68, 0xC1, 0x3F,
-    0x7F, 0x9A, 0xF4, 0xA1, 0x7F, 0xC5, 0x93, 0x08, 0xF7, 0xAF, 0x39, 0x86, 0xE7, 0x9C, 0xF5, 0xCB,
-    0xD0, 0xC0, 0x17, 0x90, 0xDB, 0x7C, 0x88, 0xA0, 0xED, 0x77, 0x76, 0x9C, 0x9D, 0xF4, 0x89, 0x10,
-    0x1A, 0x76, 0x14, 0x55, 0x50, 0x71, 0x15, 0x34, 0x7E, 0xAA, 0x1B, 0x8A, 0xEE, 0x19, 0x72, 0x03,
-    0x0A, 0xBB, 0x06, 0xE1, 0xEB, 0x4A, 0xDC, 0x29, 0x80, 0x06, 0x97, 0x40, 0x29, 0xDB, 0xEB, 0xA4,
-    0x5E, 0x2C, 0x25, 0xCF, 0xA0, 0xE5, 0x80, 0xE4, 0x7D, 0x4D, 0xEA, 0xBB, 0x32, 0x30, 0x28, 0xB7,
-    0xAB, 0x28, 0xD8, 0xC7, 0xC0, 0xF3, 0xE2, 0xB6, 0x96, 0xAA, 0x55, 0xFD, 0x7D, 0x96, 0x64, 0xBE,
-    0xCC, 0x12, 0x67, 0x26, 0x97, 0xD5, 0xB8, 0x22, 0x2E, 0xE1, 0xBE, 0x1E, 0xB3, 0xD4, 0x80, 0x8B,
-    0x3D, 0x2B, 0xC6, 0xC4, 0x83, 0xF1, 0xB9, 0xD4, 0xF8, 0x97, 0xBE, 0xB5, 0x19, 0x6F, 0x0D, 0x39,
-    0x1D, 0xBF, 0xCA, 0xD2, 0x02, 0x84, 0xD8, 0x8F, 0xD5, 0x9C, 0x0B, 0xB4, 0x7C, 0x4C, 0xCA, 0xA3,
-    0x5E, 0x10, 0x50, 0xED, 0x9B, 0xF2, 0x1F, 0xD6, 0x24, 0x9F, 0x10, 0x3B, 0x12, 0x32, 0x3D, 0xD8,
-    0x3B, 0x64, 0x39, 0xB1, 0x79, 0x43, 0x27, 0xCB, 0x89, 0x15, 0xCA, 0x19, 0x15, 0xE4, 0x14, 0xD8,
-    0x9D, 0x37, 0xC8, 0xFE, 0x8E, 0xF2, 0x3A, 0x74, 0x5B, 0xC6, 0x17, 0x2E, 0x4B, 0x5B, 0x5C, 0xCF,
-    0x57, 0x5C, 0x87, 0xFB, 0x03, 0x01, 0xF3, 0x71, 0xD8, 0x1E, 0x17, 0x35, 0xB3, 0x4B, 0x2A, 0x4A,
-    0x4B, 0xE4, 0x47, 0xD8, 0x11, 0xB2, 0x3C, 0xD7, 0x81, 0x2B, 0xE2, 0x96, 0x92, 0x1A, 0x41, 0x4F,
-    0xCE, 0xF3, 0x35, 0x24, 0x34, 0x4B, 0x7D, 0x6B, 0x84, 0x9A, 0x83, 0xCA, 0x53, 0xE0, 0x8B, 0xFC,
-    0x42, 0xC0, 0x4B, 0x4D, 0x41, 0x9F, 0x43, 0x5B, 0x12, 0xEF, 0xE1, 0xAA, 0x72, 0x90, 0x17, 0xB1,
-    0x38, 0xA0, 0x63, 0x93, 0x67, 0x94, 0xAE, 0x5A, 0xC8, 0x42, 0xA0, 0xE4, 0x5A, 0xB1, 0xA4, 0x16,
-    0x6C, 0x22, 0x03, 0x39, 0x49, 0x09, 0x31, 0x2B, 0x3B, 0x64, 0x1C, 0x63, 0x9C, 0x85, 0x04, 0xC9,
-    0x19, 0xA5, 0x8A, 0x80, 0xF3, 0xBA, 0x8F, 0xA4, 0x2E, 0x74, 0x55, 0x88, 0xD0, 0x6F, 0xC0, 0xD9,
-    0x21, 0x87, 0x3E, 0x0E, 0x5A, 0x50, 0x22, 0x6B, 0x1A, 0x0A, 0x91, 0x92, 0x38, 0x0B, 0x27, 0x20,
-    0xB2, 0x09, 0xF5, 0x4B, 0x6A, 0x04, 0xBF, 0xAC, 0x62, 0xB6, 0x19, 0x64, 0xBC, 0x55, 0x7E, 0xF9,
-    0x14, 0x79, 0x91, 0x56, 0xB8, 0x1B, 0x54, 0x05, 0x8F, 0xC0, 0x12, 0x7B, 0x38, 0x47, 0xD0, 0x88,
-    0x9C, 0xF6, 0x97, 0x74, 0xC3, 0x16, 0x80, 0x8E, 0xC0, 0xF1, 0x15, 0x0E, 0x2B, 0xC0, 0x3D, 0x38,
-    0x0A, 0xD7, 0x83, 0x1A, 0x92, 0x3C, 0x1A, 0x5D, 0x06, 0x4E, 0x69, 0xBE, 0x19, 0xBA, 0xC5, 0x45,
-    0x67, 0xCF, 0xE7, 0xEE, 0xC1, 0xA2, 0x6B, 0xB7, 0xC1, 0x9D, 0x7E, 0xF1, 0xAB, 0x45, 0x57, 0x9D,
-    0xFF, 0x66, 0x2E, 0x5E, 0x2C, 0xE8, 0xFC, 0x79, 0xDA, 0x15, 0xF8, 0xD3, 0x2D, 0x2F, 0x17, 0x68,
-    0x87, 0x52, 0xF7, 0x74, 0xE4, 0xEC, 0x74, 0xEE, 0x46, 0x6B, 0x00, 0xC3, 0x37, 0xE0, 0x0E, 0x80,
-    0x72, 0x0F, 0x6E, 0x83, 0x24, 0xE4, 0x5B, 0x7F, 0xF9, 0x1A, 0x2E, 0x7F, 0x33, 0x0B, 0xCC, 0xC8,
-    0xB5, 0xC0, 0xFC, 0x30, 0x72, 0xDD, 0x0E, 0xD0, 0xCE, 0x80, 0x87, 0x73, 0xB5, 0x72, 0x7D, 0x1A,
-    0x71, 0x10, 0x5B, 0xCA, 0x66, 0x68, 0x36, 0xA1, 0xC4, 0xFD, 0xED, 0xC4, 0xD0, 0xD5, 0x11, 0x77,
-    0x10, 0xBF, 0x8A, 0x5E, 0x9B, 0xD0, 0x0E, 0xE8, 0x08, 0x0E, 0x19, 0x15, 0x88, 0x6F, 0x69, 0xF2,
-    0xB2, 0xA5, 0x6C, 0xDB, 0x62, 0x12, 0x95, 0xCC, 0xA2, 0xFA, 0x97, 0xA9, 0x7F, 0x45, 0xA5, 0xF0,
-    0x89, 0x8A, 0x5A, 0x41, 0x28, 0x16, 0xB4, 0xA3, 0x5A, 0xFC, 0xF8, 0x71, 0x80, 0x70, 0xA3, 0x17,
-    0x74, 0x9C, 0xCE, 0xE3, 0xC3, 0x55, 0x89, 0xCE, 0x3D, 0xDE, 0xC2, 0x5D, 0xEC, 0xF3, 0xAC, 0xB8,
-    0x85, 0x6A, 0x72, 0x0B, 0x3D, 0xC8, 0xCB, 0xDF, 0xC0, 0xFE, 0x88, 0x52, 0xFC, 0x12, 0x3B, 0x49,
-    0x39, 0x70, 0x2D, 0xF2, 0x6F, 0x8A, 0xF3, 0xEF, 0xB3, 0xB1, 0xD2, 0x7D, 0x1A, 0x4E, 0x02, 0xAA,
-    0x84, 0xDD, 0x35, 0x9F, 0x7D, 0xEA, 0x5C, 0x06, 0xCD, 0x33, 0x9C, 0x99, 0xE4, 0xB3, 0x92, 0x92,
-    0xB5, 0x8A, 0x62, 0xCE, 0xEB, 0xE8, 0x2A, 0xDB, 0xDF, 0x8A, 0x87, 0xB5, 0x52, 0xB7, 0xEB, 0x59,
-    0x6C, 0x5B, 0xE0, 0x5C, 0x07, 0xF4, 0x79, 0x8B, 0x8C, 0xF6, 0x19, 0xE6, 0x33, 0x2D, 0xD6, 0x37,
-    0x95, 0x78, 0xD1, 0xA4, 0xDF, 0x57, 0x39, 0x07, 0xE6, 0x32, 0x24, 0x4E, 0x0A, 0xE7, 0xAE, 0xD2,
-    0x05, 0x6E, 0x6A, 0x9F, 0x36, 0x0B, 0x27, 0x6E, 0xC0, 0x2F, 0x37, 0xB9, 0xA6, 0x6D, 0x59, 0x65,
-    0x62, 0x0E, 0x99, 0x51, 0x46, 0x8F, 0x13, 0x98, 0x6B, 0x1A, 0xB7, 0xE7, 0x2A, 0xE1, 0xE6, 0xE1,
-    0xEB, 0xAA, 0xCE, 0xE4, 0x77, 0xA7, 0xA9, 0x7B, 0x6D, 0x22, 0x67, 0x83, 0x73, 0xEE, 0x8F, 0x43,
-    0x1F, 0x7E, 0x5D, 0x00, 0x8F, 0xE5, 0x4E, 0xCB, 0x87, 0x79, 0xF6, 0xBB, 0xDA, 0x77, 0x8F, 0xC4,
-    0x55, 0xF2, 0x10, 0x2A, 0x22, 0x67, 0x6C, 0xD0, 0xF9, 0x1B, 0x65, 0x3C, 0x50, 0xC7, 0x86, 0x19,
-    0xB7, 0x39, 0x6A, 0x87, 0x35, 0x4F, 0x6D, 0x11, 0xB7, 0x4C, 0xDC, 0xAA, 0x93, 0xF7, 0xEB, 0xF8,
-    0x51, 0x93, 0xA3, 0x67, 0xE5, 0x86, 0x37, 0xAC, 0x07, 0xE9, 0xAF, 0x2B, 0x79, 0x59, 0x37, 0xB3,
-    0xE8, 0x0D, 0xB0, 0x12, 0x16, 0x4B, 0x53, 0xFE, 0x56, 0xE5, 0x54, 0x8B, 0xEB, 0xBE, 0x4B, 0x81,
-    0xD5, 0x38, 0x0A, 0xCE, 0xBC, 0xEB, 0x29, 0x88, 0x0C, 0xFF, 0x0B, 0xBE, 0xF2, 0x35, 0x08, 0xF3,
-    0xF5, 0xB2, 0xAF, 0x83, 0x3B, 0xC6, 0x61, 0x5F, 0xBF, 0xB9, 0x24, 0x70, 0xF0, 0xA1, 0xDC, 0xA0,
-    0x80, 0xF7, 0x75, 0xE2, 0x04, 0x72, 0x47, 0x3E, 0xE5, 0x1E, 0xF7, 0x19, 0x56, 0x1D, 0x56, 0x83,
-    0xA5, 0x77, 0x77, 0x73, 0x8F, 0x16, 0xFB, 0x8D, 0x7A, 0x5C, 0x58, 0x77, 0x8C, 0x09, 0xB6, 0x39,
-    0x54, 0x8B, 0x5E, 0xC1, 0x12, 0xC9, 0x26, 0x94, 0x50, 0xBF, 0xC7, 0xD2, 0xCF, 0xF6, 0x24, 0x6B,
-    0xAF, 0xDA, 0xA3, 0x3B, 0x48, 0xCF, 0x0C, 0xCF, 0x6D, 0xD4, 0x73, 0x84, 0x5E, 0x9C, 0x13, 0x18,
-    0x25, 0xA5, 0xFF, 0xBD, 0x13, 0xB0, 0xD0, 0xF6, 0x54, 0x9E, 0x05, 0xED, 0xB0, 0x08, 0x3B, 0x86,
-    0x9F, 0xBC, 0x7B, 0x68, 0xDF, 0xB3, 0x8E, 0xF7, 0x32, 0x1F, 0xE6, 0x47, 0x9F, 0x53, 0xAF, 0x5C,
-    0xA8, 0x55, 0xA8, 0xD1, 0x32, 0x8B, 0xDA, 0x3F, 0xF0, 0x5F, 0x23, 0x36, 0x63, 0xAD, 0x15, 0xDF,
-    0xBC, 0xF9, 0xFC, 0xBC, 0xFF, 0xA7, 0xE3, 0x1F, 0xFE, 0x75, 0x1B, 0x8B, 0x06, 0x32, 0xE6, 0xBD,
-    0xB2, 0xF6, 0x0F, 0xFF, 0x3A, 0xC6, 0xA2, 0x47, 0x4C, 0x93, 0x8D, 0xC6, 0xDF, 0xD8, 0x87, 0xD4,
-    0xE9, 0xCD, 0xE6, 0x26, 0xCF, 0xCE, 0xE6, 0x37, 0x36, 0xEA, 0xC9, 0x09, 0xB9, 0x61, 0xDD, 0x47,
-    0xC1, 0x97, 0x2F, 0x9D, 0x5A, 0xCD, 0xB2, 0x2E, 0x5F, 0x37, 0x57, 0x0F, 0xA9, 0x3F, 0x3D, 0xB7,
-    0x53, 0x24, 0x3A, 0xEE, 0x7F, 0x3F, 0xD0, 0x38, 0x4B, 0x57, 0x4E, 0x47, 0xE5, 0x07, 0x1A, 0x67,
-    0xD1, 0x21, 0x07, 0xE4, 0xFB, 0xB1, 0x7D, 0x67, 0x3D, 0x27, 0xC3, 0x46, 0xAD, 0x75, 0xBB, 0x13,
-    0x98, 0x5F, 0xFC, 0x75, 0xFF, 0xD1, 0x62, 0x77, 0x0E, 0x42, 0x7F, 0x58, 0xC9, 0xFF, 0x01, 0x45,
-    0x93, 0xAF, 0x6F, 0x23, 0x47, 0x14, 0xC7, 0xBF, 0x3B, 0x23, 0x7B, 0xD4, 0xAC, 0xD4, 0x09, 0x70,
-    0xC8, 0x49, 0xCD, 0x92, 0xA2, 0x4A, 0x97, 0xFD, 0x07, 0xEC, 0x9D, 0x69, 0x0F, 0x14, 0x1C, 0xA8,
-    0x41, 0x4E, 0x07, 0x0A, 0x42, 0xCA, 0x8F, 0x14, 0x1C, 0xF0, 0x8F, 0x49, 0x0C, 0x02, 0x0E, 0xD4,
-    0xA8, 0x34, 0x05, 0x07, 0xAA, 0x90, 0x92, 0x48, 0x35, 0xB0, 0xBD, 0x7B, 0x31, 0x30, 0x38, 0x90,
-    0x0D, 0x3A, 0x50, 0xD0, 0x6D, 0x0B, 0x42, 0x47, 0x97, 0xBD, 0x6A, 0x53, 0xCF, 0xFA, 0x75, 0x36,
-    0xB9, 0xAA, 0x03, 0xE6, 0xAD, 0xF6, 0xAB, 0x99, 0x79, 0xEF, 0xF3, 0x7D, 0x0F, 0xBB, 0xA0, 0x8C,
-    0xAA, 0xE5, 0x58, 0xC9, 0xDF, 0x27, 0x9B, 0xEB, 0x6D, 0xB9, 0x5C, 0xA8, 0x88, 0x26, 0x94, 0xC5,
-    0x26, 0x30, 0x49, 0x60, 0x3A, 0x61, 0x56, 0x49, 0x6D, 0x23, 0x66, 0x13, 0x9E, 0xC3, 0xAF, 0x1A,
-    0x2A, 0x93, 0x8E, 0x51, 0xB6, 0xA8, 0xA2, 0xE8, 0xC9, 0x4D, 0x99, 0xD2, 0x6F, 0xE4, 0x30, 0x42,
-    0xDB, 0x78, 0x51, 0x6D, 0x39, 0xE5, 0x03, 0xC8, 0x29, 0xC8, 0xEE, 0xA4, 0x06, 0x0E, 0xF2, 0xE4,
-    0x79, 0xA9, 0xB6, 0xC1, 0x52, 0xA3, 0x85, 0xD4, 0x52, 0xB5, 0x40, 0xB2, 0x1B, 0xA5, 0xAF, 0x36,
-    0xEF, 0xED, 0x70, 0x1E, 0x1D, 0x9D, 0xAD, 0x28, 0x8F, 0xFD, 0xC1, 0x80, 0xB6, 0x31, 0xE5, 0x81,
-    0x83, 0x82, 0x28, 0xF0, 0x7F, 0xD0, 0x6C, 0x0A, 0x74, 0x10, 0x39, 0xB1, 0x29, 0xE6, 0x89, 0xB8,
-    0xC9, 0x55, 0x29, 0xE8, 0xAB, 0x3B, 0xA7, 0xE4, 0xCA, 0xBA, 0x98, 0xF4, 0x78, 0x8A, 0x3E, 0xA3,
-    0x13, 0x2A, 0x5D, 0xD2, 0x93, 0x57, 0xA7, 0xB7, 0x54, 0x1D, 0x2C, 0xA0, 0xF6, 0xD2, 0xA7, 0xF4,
-    0xE5, 0x1D, 0x60, 0xF0, 0x3D, 0x3E, 0x03, 0x39, 0x45, 0xF7, 0x1F, 0x0C, 0x5F, 0x9C, 0x4B, 0xCA,
-    0x9E, 0x1D, 0x52, 0xFD, 0xEC, 0xF0, 0x61, 0x07, 0x1E, 0x0B, 0x63, 0x1F, 0xF3, 0xEC, 0x65, 0xA8,
-    0xAD, 0x84, 0x95, 0xFA, 0x82, 0x9B, 0x8E, 0x2F, 0x24, 0xD4, 0xFB, 0xE8, 0xC2, 0xF2, 0x4C, 0xA2,
-    0x1B, 0x14, 0xA1, 0xEE, 0xB2, 0xC2, 0xCB, 0x2D, 0x9F, 0x69, 0x0B, 0xBF, 0x3A, 0xF9, 0x2E, 0xAF,
-    0xBA, 0x91, 0xB8, 0xB4, 0xF3, 0x44, 0x4E, 0xF2, 0xB2, 0x2B, 0x81, 0x5D, 0x28, 0x2B, 0xE9, 0xA4,
-    0x7E, 0x48, 0x6D, 0x24, 0xD7, 0x7F, 0x54, 0x4B, 0xF5, 0x35, 0x59, 0xE5, 0xB0, 0x6C, 0xB0, 0x45,
-    0x59, 0x6C, 0xC7, 0x2E, 0x5E, 0xB2, 0x58, 0xCB, 0x8C, 0xDB, 0xA0, 0xF2, 0xC8, 0x62, 0xBD, 0x63,
-    0x3C, 0x96, 0xD8, 0x09, 0xB2, 0x9F, 0x2B, 0x70, 0x0B, 0x9F, 0xBC, 0x96, 0xB9, 0xB0, 0xAC, 0x49,
-    0xFA, 0xF2, 0xFC, 0xB5, 0xAF, 0x5D, 0x39, 0x4E, 0xC5, 0x6E, 0x02, 0x91, 0x47, 0x25, 0xDB, 0xC2,
-    0x1F, 0x94, 0xAB, 0x1F, 0x2B, 0x45, 0x0D, 0x52, 0xBF, 0x08, 0x71, 0x11, 0xD6, 0x01, 0x65, 0x43,
-    0x27, 0xBF, 0x99, 0xFC, 0xED, 0x85, 0x1B, 0xF2, 0x16, 0xA1, 0x01, 0x87, 0xD4, 0x49, 0x32, 0x25,
-    0x22, 0x30, 0xCA, 0x1F, 0xA5, 0xCD, 0x03, 0x6A, 0xE7, 0xDB, 0x82, 0x5C, 0xDB, 0xC3, 0x69, 0x79,
-    0xAA, 0x21, 0xBD, 0xA9, 0xA0, 0x3A, 0x9C, 0xEC, 0xF8, 0x97, 0xD3, 0xBC, 0x1A, 0xCA, 0xC9, 0x8D,
-    0x8D, 0xB7, 0x18, 0xE9, 0xFF, 0x1C, 0xF1, 0x1E, 0xC4, 0xFA, 0xDE, 0x0A, 0x1F, 0xEC, 0x7D, 0x60,
-    0x3F, 0xF9, 0x62, 0xFD, 0x7B, 0x5B, 0x37, 0x54, 0xD1, 0xD9, 0x09, 0x1D, 0xD3, 0xF5, 0x9D, 0x73,
-    0xF1, 0x58, 0xAE, 0xA9, 0x78, 0x31, 0x6D, 0xA4, 0x63, 0xAA, 0x9C, 0x4A, 0xC2, 0xAB, 0xF5, 0x2D,
-    0xB9, 0x78, 0xF4, 0xD1, 0x8E, 0x7F, 0xC0, 0x34, 0x37, 0xDC, 0x50, 0x9D, 0xD6, 0x4D, 0x64, 0xFA,
-    0xFC, 0x67, 0xAA, 0xF7, 0x0E, 0xD3, 0xED, 0xDE, 0xE1, 0xC3, 0x0E, 0x08, 0x33, 0xE0, 0xD9, 0x7E,
-    0x43, 0x7D, 0x1F, 0x17, 0x2C, 0x0F, 0xF5, 0x01, 0x5E, 0xC2, 0x06, 0x4D, 0x9D, 0x42, 0x7B, 0x23,
-    0x50, 0xF2, 0x5C, 0x6A, 0x6F, 0x8B, 0x30, 0xDE, 0x14, 0x89, 0x0B, 0x2F, 0xF1, 0xBF, 0x32, 0xCF,
-    0x4A, 0x9E, 0xE6, 0xE5, 0x40, 0x86, 0x97, 0x76, 0xB8, 0xF4, 0x0D, 0xF8, 0x49, 0x07, 0xAC, 0xE6,
-    0x9B, 0x55, 0xF1, 0xE1, 0x83, 0x4B, 0xAB, 0xD8, 0xA3, 0x33, 0x64, 0xDB, 0x53, 0xB0, 0x4A, 0x90,
-    0xFF, 0x69, 0x7B, 0x73, 0xF9, 0x42, 0xAC, 0xDF, 0x15, 0x54, 0xB4, 0xFB, 0x60, 0xC5, 0x8C, 0xBD,
-    0xB7, 0xD8, 0x64, 0x48, 0xB5, 0xB7, 0x8A, 0x11, 0xC4, 0x95, 0x89, 0x9E, 0x66, 0x7B, 0x81, 0x0E,
-    0xAB, 0x90, 0x0C, 0xB3, 0xED, 0xB9, 0xA2, 0x58, 0xFE, 0xF0, 0xEA, 0xD2, 0x43, 0xD4, 0x60, 0x16,
-    0x09, 0xFC, 0x28, 0x0C, 0xFD, 0x65, 0xF9, 0xBD, 0xFF, 0xB6, 0x69, 0x05, 0xDF, 0x9E, 0xF2, 0x58,
-    0xF7, 0xBD, 0x2A, 0x0D, 0x7A, 0x08, 0xEC, 0x20, 0x5C, 0xE7, 0xC9, 0xC0, 0x0F, 0x17, 0x27, 0x44,
-    0x0B, 0xCC, 0xE6, 0x3C, 0x2F, 0x5B, 0x41, 0xFF, 0x7E, 0x8E, 0x06, 0x22, 0x9B, 0x7D, 0x1C, 0xAA,
-    0x40, 0xF3, 0xA3, 0xD3, 0x22, 0xA6, 0x34, 0x9F, 0x2B, 0xF9, 0xA4, 0xA8, 0x7A, 0x92, 0x67, 0x76,
-    0xD0, 0xF4, 0xD6, 0xEC, 0x40, 0x4E, 0x8A, 0xB2, 0xD3, 0x0A, 0xF4, 0xA7, 0x23, 0x41, 0x7F, 0x96,
-    0x55, 0xE5, 0x7B, 0xFC, 0x48, 0xBC, 0x7D, 0x73, 0x5B, 0xCC, 0xFA, 0x1D, 0xF0, 0x33, 0x33, 0xAE,
-    0xC3, 0x55, 0x51, 0x26, 0x92, 0x5F, 0xDB, 0x41, 0x7C, 0x36, 0x21, 0xDB, 0xFB, 0x4E, 0x64, 0x18,
-    0x20, 0x34, 0x10, 0x55, 0xB4, 0x88, 0x11, 0xE5, 0xA2, 0x84, 0xEB, 0xBB, 0xB4, 0x7C, 0xA4, 0x03,
-    0xBD, 0xCF, 0xE8, 0xA8, 0x8E, 0x30, 0xF3, 0x10, 0x31, 0xD4, 0x84, 0xD7, 0xF8, 0x17, 0x4D, 0x56,
-    0x3D, 0x6C, 0x1D, 0xC7, 0x11, 0x9E, 0xBB, 0xB5, 0x78, 0x09, 0x0F, 0xF0, 0xBA, 0x50, 0x8A, 0x44,
-    0x30, 0xCF, 0x7D, 0x2C, 0x5D, 0x93, 0xC2, 0x85, 0x90, 0x3D, 0x8A, 0x85, 0xCB, 0xC7, 0x42, 0x8A,
-    0x4B, 0xA7, 0x8C, 0x83, 0x00, 0x4A, 0x91, 0x42, 0x85, 0x95, 0x3D, 0x59, 0x80, 0x53, 0xB8, 0xF0,
-    0x6B, 0x92, 0x32, 0x56, 0xE1, 0x00, 0x06, 0x13, 0x80, 0x2E, 0x5C, 0xA4, 0x20, 0x75, 0x2B, 0x31,
-    0x00, 0x0B, 0x22, 0xE0, 0xC9, 0x4E, 0x9C, 0xC2, 0x40, 0xB8, 0xFE, 0x01, 0x52, 0xB0, 0xE0, 0x91,
-    0x3C, 0xC1, 0x27, 0x6A, 0xEF, 0xC6, 0xDF, 0xEC, 0xA3, 0x14, 0x1F, 0xB1, 0xC7, 0x77, 0xEF, 0xED,
-    0xCD, 0xCE, 0x7C, 0xF3, 0x7D, 0xDF, 0x2E, 0x11, 0x51, 0xC6, 0xB5, 0xE2, 0x81, 0x98, 0xAB, 0xC2,
-    0xBF, 0xA4, 0x02, 0x91, 0x5D, 0xBD, 0xF1, 0x46, 0xD7, 0x4C, 0x8D, 0xE6, 0x2F, 0xBA, 0xE9, 0xBA,
-    0x9D, 0x39, 0xC5, 0xDC, 0x97, 0xCC, 0x64, 0xB9, 0x23, 0x83, 0x17, 0x3A, 0xA2, 0x66, 0xA4, 0x9C,
-    0x5B, 0x62, 0x4C, 0x27, 0xFD, 0x32, 0xD1, 0xCA, 0xAB, 0xB4, 0x84, 0x07, 0xC3, 0x23, 0x02, 0x05,
-    0xC5, 0xC7, 0x7D, 0x3E, 0x7E, 0xE5, 0xF4, 0xC9, 0x4E, 0x5D, 0x7E, 0xF6, 0x5E, 0x65, 0xF6, 0x66,
-    0x64, 0xF6, 0x57, 0xC8, 0xFC, 0xF9, 0x55, 0x32, 0x7F, 0xBB, 0x4A, 0x26, 0x7C, 0x42, 0xA6, 0x3F,
-    0xA6, 0x62, 0x62, 0xD2, 0x08, 0xAC, 0x64, 0x1C, 0xCC, 0x29, 0x9B, 0x11, 0x5D, 0xB8, 0x40, 0x8B,
-    0x6B, 0x89, 0xBF, 0x41, 0xBC, 0xB0, 0x88, 0x57, 0x7D, 0x92, 0x61, 0x29, 0x8D, 0x95, 0x0B, 0x4F,
-    0x54, 0x3E, 0x38, 0xEE, 0xCC, 0xC3, 0x6F, 0xBD, 0xD9, 0xE1, 0xD6, 0xDC, 0x1D, 0xC8, 0xDC, 0x45,
-    0x62, 0xBB, 0x18, 0x7B, 0x9E, 0xCA, 0xA3, 0xCF, 0x63, 0xCC, 0x0C, 0x23, 0x41, 0x3A, 0xF1, 0x32,
-    0x3C, 0x24, 0xCC, 0x6D, 0x8E, 0x22, 0xCD, 0xBF, 0xAF, 0xD3, 0x84, 0x22, 0x7A, 0x84, 0x71, 0x28,
-    0x64, 0x63, 0x8E, 0xD5, 0x6B, 0x8D, 0x99, 0xF6, 0x8F, 0xEB, 0x29, 0x16, 0x29, 0x1E, 0x57, 0x29,
-    0xDE, 0xCD, 0x81, 0xC9, 0xB3, 0x49, 0x4C, 0xCF, 0xAE, 0x62, 0xAA, 0xA8, 0x04, 0x0C, 0x05, 0xF7,
-    0xA4, 0xFB, 0x1F, 0x90, 0x1A, 0x88, 0x12, 0x2C, 0xB2, 0xCC, 0x1B, 0x15, 0xE2, 0xB4, 0xB4, 0x79,
-    0x76, 0x2F, 0x7E, 0x59, 0xF2, 0x24, 0x69, 0x54, 0x64, 0xF0, 0x7E, 0xD1, 0x2E, 0x06, 0x40, 0xF4,
-    0xF8, 0xB2, 0xC7, 0xCC, 0x10, 0xC3, 0x7D, 0x28, 0xB7, 0x52, 0x6E, 0x99, 0xA3, 0x9F, 0xE4, 0x9E,
-    0xBD, 0x3A, 0xE5, 0x23, 0xAE, 0x4D, 0x83, 0x19, 0xD9, 0x54, 0x8C, 0x65, 0xDB, 0x38, 0x5E, 0x1D,
-    0x75, 0xA7, 0xBB, 0xC2, 0x71, 0x32, 0xA6, 0x41, 0xFB, 0xD2, 0x99, 0x07, 0xA3, 0x0A, 0x6A, 0x28,
-    0x1D, 0xD7, 0x76, 0x2D, 0x94, 0x43, 0xD6, 0x99, 0xBB, 0x5C, 0x35, 0xAA, 0x67, 0xCC, 0xB3, 0x25,
-    0xA3, 0x40, 0xD5, 0x4A, 0xD4, 0x41, 0x6E, 0x2B, 0x71, 0xA9, 0x86, 0xB6, 0x88, 0x2B, 0xC0, 0xB0,
-    0xDA, 0xCB, 0x48, 0xF9, 0x9D, 0x4E, 0x1D, 0xDE, 0xED, 0x2E, 0xF1, 0xE1, 0x80, 0xB4, 0x42, 0xFE,
-    0xC5, 0x5E, 0x9B, 0xEF, 0xEE, 0x3B, 0xCB, 0xDC, 0xC9, 0x28, 0xD6, 0x0E, 0xAA, 0x52, 0x1D, 0x91,
-    0x51, 0x8C, 0x31, 0xD1, 0xCF, 0x31, 0x6E, 0x2B, 0x54, 0x6A, 0x25, 0xA6, 0x66, 0xB9, 0x4B, 0xBD,
-    0xA4, 0x3F, 0x07, 0x3A, 0x49, 0xC8, 0x3B, 0x81, 0xAA, 0xC9, 0x6B, 0x35, 0xE8, 0xE3, 0x9E, 0xCC,
-    0xEA, 0x64, 0xAE, 0x67, 0x67, 0x7C, 0xC0, 0x88, 0xF8, 0x2D, 0x0F, 0x39, 0x8F, 0xDA, 0x13, 0xFF,
-    0x85, 0x46, 0xD2, 0x2D, 0x69, 0x97, 0x04, 0xBC, 0x23, 0xD8, 0x96, 0x0E, 0x68, 0xA5, 0xD3, 0xDC,
-    0xD4, 0xC0, 0x56, 0x01, 0xEF, 0xA6, 0x3D, 0x87, 0x1A, 0xED, 0x27, 0x30, 0x43, 0x80, 0x2A, 0xE2,
-    0xBD, 0x79, 0x13, 0x3F, 0xAB, 0x50, 0xB4, 0xCD, 0x5C, 0x7B, 0x3B, 0x43, 0xEB, 0xAF, 0x8D, 0xCC,
-    0x49, 0x28, 0x4E, 0xFB, 0x8B, 0xE8, 0xEC, 0xAC, 0x45, 0x9B, 0x7B, 0xD3, 0x0A, 0x93, 0x1B, 0x9F,
-    0x3D, 0x1E, 0xA9, 0xF1, 0xE5, 0xCE, 0x40, 0xD6, 0x35, 0xE0, 0x8D, 0x05, 0x5C, 0xFF, 0x48, 0x80,
-    0x9E, 0xBD, 0x72, 0xB3, 0xB3, 0xAB, 0x63, 0xC3, 0xD7, 0x82, 0x7A, 0x82, 0x2E, 0x2E, 0x2E, 0xD5,
-    0x16, 0xF5, 0xED, 0xAC, 0x35, 0xF5, 0x96, 0xDC, 0x42, 0xD6, 0x36, 0x77, 0xFA, 0xCC, 0xF1, 0x5A,
-    0x97, 0x3D, 0x78, 0xBA, 0xE6, 0xF3, 0x9D, 0xA3, 0xD7, 0xDB, 0x7C, 0x67, 0x7F, 0xE6, 0x0C, 0x2F,
-    0xF0, 0x01, 0xD0, 0x07, 0xDA, 0x90, 0xDE, 0xD4, 0xB7, 0x49, 0x6F, 0xEB, 0x2D, 0xD2, 0x41, 0x0F,
-    0xA4, 0x87, 0x42, 0x68, 0x51, 0x74, 0x60, 0x2A, 0x78, 0xAA, 0xDB, 0x02, 0xCD, 0xB7, 0x5C, 0x67,
-    0x91, 0x79, 0xDB, 0x42, 0x65, 0xED, 0xF0, 0xE7, 0x43, 0x12, 0x2E, 0xDA, 0xC2, 0x95, 0xEF, 0xFF,
-    0xE7, 0x64, 0x48, 0xFB, 0xF0, 0x7B, 0x53, 0x99, 0x62, 0xEF, 0xEB, 0x4E, 0x9D, 0x0C, 0xA3, 0x21,
-    0x5B, 0xCE, 0x76, 0x7D, 0xFE, 0xF5, 0x71, 0xD8, 0xA6, 0xD1, 0x14, 0xEF, 0xB7, 0x7A, 0xF7, 0xA4,
-    0x0F, 0x14, 0xEE, 0xFF, 0xA8, 0xAC, 0xF1, 0x94, 0xF5, 0x69, 0xCF, 0x7F, 0x9D, 0xC8, 0xCC, 0x40,
-    0x5B, 0x75, 0xCC, 0x3C, 0x97, 0xFC, 0x85, 0xE7, 0xB6, 0x8A, 0x40, 0x65, 0x60, 0x5E, 0xF2, 0xC6,
-    0x93, 0xF8, 0x65, 0x36, 0x5A, 0x11, 0x82, 0x28, 0xD8, 0xAB, 0x29, 0x1F, 0x68, 0x02, 0x59, 0x9B,
-    0xCA, 0x02, 0xF6, 0xC2, 0x81, 0x54, 0x1E, 0x34, 0xEA, 0x89, 0xD1, 0xD7, 0x32, 0xCA, 0xF0, 0xC8,
-    0x91, 0xFD, 0xCC, 0xFF, 0x9F, 0xED, 0x2C, 0x32, 0x07, 0x89, 0x17, 0x57, 0xF3, 0x0D, 0x82, 0x85,
-    0xC8, 0x7D, 0xD3, 0xFE, 0x52, 0x54, 0x91, 0x40, 0x49, 0xF9, 0xF4, 0x11, 0xDE, 0x0E, 0x74, 0x09,
-    0xFF, 0x45, 0x30, 0x06, 0xF2, 0xB0, 0xEC, 0x49, 0x18, 0x21, 0x23, 0x1B, 0x92, 0x28, 0x70, 0x08,
-    0x10, 0x39, 0x4E, 0xE7, 0xA1, 0x90, 0x85, 0x71, 0x16, 0x50, 0x18, 0x97, 0xA1, 0x69, 0x49, 0x28,
-    0x3D, 0x35, 0xC0, 0xCC, 0xEC, 0x03, 0xBC, 0x43, 0x48, 0x19, 0x19, 0x17, 0x90, 0x0A, 0xDE, 0xFA,
-    0x17, 0x74, 0x8D, 0x2F, 0xBF, 0x44, 0x39, 0xBD, 0x71, 0x50, 0x40, 0x47, 0x9C, 0x8E, 0x64, 0x6A,
-    0x5B, 0xEB, 0x16, 0x0F, 0x99, 0xD0, 0x57, 0xA0, 0x65, 0x1E, 0x2E, 0xBC, 0xF9, 0x78, 0x9D, 0xF4,
-    0x89, 0x30, 0x14, 0x68, 0x00, 0x15, 0x84, 0x15, 0x09, 0xA6, 0xFC, 0x5F, 0x12, 0x8D, 0xFF, 0xD0,
-    0xE2, 0xB9, 0xA9, 0xF0, 0x2C, 0x5A, 0x26, 0xBA, 0x32, 0x2D, 0xF4, 0x9B, 0x06, 0x7A, 0x6E, 0x3B,
-    0x4F, 0xA2, 0x29, 0xB2, 0x8F, 0x0C, 0x17, 0xE9, 0x5F, 0x24, 0x79, 0x8B, 0x7E, 0x2D, 0xE6, 0x08,
-    0xE4, 0x6C, 0x8D, 0xF0, 0x5E, 0xBC, 0x48, 0xF5, 0xF2, 0x15, 0x88, 0xCC, 0xB1, 0x24, 0x53, 0xBF,
-    0x85, 0xB5, 0x8A, 0x2F, 0xB9, 0xD7, 0x3E, 0xEF, 0x98, 0xE5, 0xE7, 0xFB, 0xF9, 0xA3, 0xA0, 0x46,
-    0x93, 0xF4, 0x4D, 0x3E, 0x69, 0xB7, 0x6D, 0x78, 0xCA, 0x3A, 0x8B, 0x4C, 0x60, 0x31, 0x7F, 0x00,
-    0xC3, 0x27, 0xAE, 0xC5, 0x9E, 0x16, 0x68, 0xBB, 0x68, 0x04, 0x11, 0xFE, 0x74, 0x41, 0xCC, 0x45,
-    0x56, 0xE6, 0x79, 0x43, 0x52, 0x54, 0xA5, 0x80, 0x6F, 0x8A, 0x1E, 0x13, 0x17, 0x35, 0xD9, 0xD7,
-    0x3D, 0x15, 0x9F, 0xF6, 0x40, 0x06, 0x82, 0x1A, 0xEF, 0x0B, 0xFA, 0x52, 0xFB, 0x62, 0xE6, 0x2B,
-    0xD6, 0xD1, 0xCB, 0x42, 0xC6, 0x0F, 0x46, 0xF1, 0xA2, 0x3A, 0xE7, 0x7D, 0x9F, 0xED, 0xED, 0x04,
-    0xF5, 0xC8, 0x61, 0xC6, 0x4B, 0xE2, 0x4C, 0x3A, 0x36, 0x08, 0xAF, 0x01, 0x03, 0x8D, 0x98, 0xA9,
-    0x10, 0x09, 0xE2, 0x06, 0xEC, 0xE2, 0x82, 0x4E, 0x85, 0xB2, 0x45, 0x1B, 0x82, 0x58, 0x44, 0xD6,
-    0xE9, 0xB6, 0x3C, 0xDB, 0xF4, 0x46, 0xD8, 0xEF, 0xB1, 0x5D, 0x00, 0x9C, 0x12, 0x73, 0x4B, 0x50,
-    0x10, 0xF2, 0x25, 0x03, 0x9E, 0xD8, 0x08, 0xC4, 0xF7, 0x1D, 0x33, 0xC3, 0x2F, 0x37, 0x51, 0x25,
-    0x02, 0x20, 0xA8, 0x6C, 0x0F, 0x97, 0x88, 0xF7, 0x90, 0xF9, 0x0E, 0xF4, 0xDA, 0x8A, 0x52, 0xAE,
-    0x22, 0x83, 0x82, 0x1F, 0x8C, 0x39, 0x77, 0xCD, 0x1A, 0x96, 0x6A, 0xBB, 0x29, 0xEF, 0xDF, 0xB6,
-    0xAB, 0xBC, 0x02, 0xA7, 0x3B, 0x9C, 0x75, 0xE8, 0xED, 0x40, 0x0D, 0x2A, 0x16, 0x66, 0xD3, 0x15,
-    0xC4, 0xCC, 0x23, 0x23, 0x4B, 0xE9, 0x40, 0x44, 0xBE, 0x7B, 0x56, 0x33, 0x3E, 0x18, 0xC8, 0x20,
-    0x3F, 0xED, 0x85, 0x40, 0xD3, 0x52, 0x73, 0x38, 0xC1, 0x90, 0xCA, 0x7A, 0x09, 0x8A, 0xA9, 0xD0,
-    0xCC, 0x21, 0x1B, 0x7F, 0x21, 0xCC, 0x29, 0x5C, 0xDE, 0xA1, 0x6D, 0x13, 0x5C, 0x19, 0x1E, 0x34,
-    0x02, 0x01, 0xBD, 0xB0, 0x9D, 0x66, 0x88, 0x1A, 0xC2, 0x7E, 0x41, 0x1F, 0x16, 0xDD, 0xB9, 0xFB,
-    0x2F, 0x6F, 0x6C, 0x8E, 0x08, 0xD7, 0x0B, 0xF9, 0x2D, 0x57, 0x82, 0x05, 0xFC, 0xD9, 0x63, 0x45,
-    0x71, 0x7A, 0xDD, 0x2D, 0xD5, 0xE2, 0xF6, 0x26, 0x42, 0x51, 0x9F, 0x2B, 0x47, 0x28, 0xE4, 0x65,
-    0xFF, 0x42, 0xD1, 0x83, 0xE2, 0xAD, 0x8F, 0xF5, 0x70, 0x8B, 0x8A, 0xEE, 0xEF, 0x54, 0xB6, 0xC8,
-    0xCD, 0x81, 0xE0, 0x77, 0x20, 0x93, 0x6B, 0x1E, 0xA3, 0x25, 0xBB, 0x26, 0x03, 0xDA, 0xDB, 0x75,
-    0x64, 0x0E, 0xDF, 0xA5, 0x22, 0xEE, 0x3F, 0xE7, 0xFB, 0x17, 0x42, 0xC5, 0xA2, 0x7F, 0x8C, 0xDD,
-    0x42, 0xF9, 0xA2, 0xA2, 0x6D, 0xD5, 0x51, 0x79, 0xC6, 0x1F, 0x61, 0x16, 0x3F, 0x64, 0xD9, 0x1E,
-    0x87, 0x12, 0xEF, 0x5F, 0x83, 0xF4, 0x3B, 0xF4, 0xB4, 0x41, 0x52, 0xD8, 0x05, 0x2A, 0x02, 0xD3,
-    0x50, 0x5F, 0x43, 0x51, 0x31, 0xC6, 0xC9, 0xBC, 0x9C, 0x1D, 0xAC, 0x66, 0xA0, 0xEF, 0x5D, 0xB2,
-    0xA3, 0x29, 0xD1, 0xB8, 0x68, 0x98, 0x78, 0x75, 0x1E, 0x45, 0x1C, 0xB7, 0x2B, 0x58, 0xA7, 0xB4,
-    0x12, 0xB7, 0x44, 0x9C, 0x3E, 0xDE, 0xE2, 0x23, 0x36, 0x92, 0x5B, 0xBF, 0xBA, 0x35, 0x66, 0xFC,
-    0xF4, 0xB4, 0xBF, 0x7C, 0x72, 0x7A, 0xE0, 0xEC, 0xDE, 0x6C, 0x22, 0x1C, 0x19, 0x60, 0xF1, 0x48,
-    0x59, 0xED, 0xEE, 0x55, 0xB4, 0x72, 0xF9, 0xB2, 0x18, 0x08, 0x7F, 0x85, 0x3E, 0x00, 0xB1, 0x47,
-    0x37, 0x6E, 0x5C, 0x5F, 0xE8, 0x6A, 0x00, 0x76, 0xF0, 0xAE, 0x5E, 0x38, 0x82, 0x3D, 0x41, 0xD4,
-    0x87, 0xF4, 0x45, 0x80, 0x48, 0x5E, 0x00, 0x95, 0x06, 0xF6, 0x91, 0x46, 0x62, 0x5D, 0x8D, 0x88,
-    0x3B, 0xEE, 0xC1, 0xCB, 0x9B, 0x67, 0x00, 0xB3, 0xBB, 0x80, 0x6D, 0x40, 0xE4, 0x2F, 0xC7, 0x16,
-    0x2F, 0xC4, 0x13, 0x0D, 0x4A, 0xBA, 0xBC, 0xD8, 0xD5, 0x45, 0xED, 0xE3, 0x82, 0xD9, 0x76, 0xE1,
-    0x40, 0xD3, 0x12, 0xE8, 0xE1, 0x53, 0x1E, 0x52, 0x54, 0x60, 0xC2, 0x6F, 0xF0, 0xAE, 0xBB, 0xC4,
-    0x3E, 0x43, 0xD1, 0x9B, 0xDD, 0xF2, 0x7C, 0xA2, 0x51, 0x36, 0x55, 0xB0, 0xA0, 0x78, 0xC8, 0x20,
-    0x7D, 0x0B, 0x07, 0x53, 0xCF, 0x77, 0x86, 0x45, 0x88, 0x72, 0x8B, 0xE8, 0xEA, 0x55, 0xA2, 0xB7,
-    0x31, 0xEC, 0xFD, 0x8D, 0x39, 0xE8, 0x10, 0x50, 0xDC, 0x94, 0x9C, 0x6D, 0x34, 0x04, 0x12, 0xD3,
-    0xC9, 0x3F, 0x5F, 0x44, 0x72, 0x97, 0xD3, 0xE9, 0x69, 0x48, 0xBB, 0x3B, 0xF7, 0x64, 0x75, 0x33,
-    0xBC, 0x40, 0x2F, 0x48, 0x07, 0x1B, 0x24, 0x58, 0x3E, 0x33, 0x98, 0x44, 0x3E, 0x44, 0xBB, 0x49,
-    0xA5, 0x0F, 0x2A, 0xDE, 0xB0, 0x58, 0xB2, 0x39, 0x89, 0x7F, 0x63, 0x5D, 0xD9, 0xFB, 0x53, 0xFE,
-    0xE0, 0x7F, 0x93, 0x0A, 0xBA, 0xE5, 0xAC, 0x2F, 0xB0, 0xAD, 0x76, 0xD8, 0x5B, 0xE1, 0x95, 0x35,
-    0xEB, 0xD6, 0x54, 0x13, 0x9C, 0x22, 0x19, 0x41, 0xCD, 0x24, 0x48, 0xB1, 0x41, 0x30, 0x10, 0xDE,
-    0xCE, 0xA3, 0x1C, 0xE5, 0x0C, 0x66, 0xFE, 0x04, 0x3E, 0x56, 0x38, 0xB1, 0x01, 0x94, 0x06, 0x34,
-    0x87, 0xC3, 0x2F, 0x73, 0x23, 0x0E, 0xD9, 0x89, 0x11, 0x64, 0xE3, 0x7A, 0x5C, 0xF8, 0xA7, 0xD3,
-    0x3D, 0x4C, 0xC7, 0x99, 0xE9, 0x6C, 0x1E, 0xF1, 0xD2, 0xD1, 0x7B, 0x12, 0x39, 0x81, 0xFD, 0x56,
-    0xDC, 0xFB, 0x45, 0xD1, 0x94, 0x17, 0x7A, 0xB8, 0x44, 0x8E, 0x2C, 0x76, 0x84, 0x63, 0x3F, 0xDD,
-    0xA9, 0x53, 0x7E, 0xED, 0x77, 0x64, 0x76, 0xDE, 0x03, 0xF4, 0xAF, 0xDC, 0x23, 0xF1, 0xC3, 0xC8,
-    0x19, 0x31, 0x81, 0x73, 0x8F, 0x3C, 0xB7, 0x00, 0x35, 0xAD, 0x8B, 0x10, 0xE5, 0xC0, 0xC3, 0xF2,
-    0x01, 0x41, 0x93, 0x55, 0xA2, 0xD7, 0x3E, 0x26, 0x35, 0x03, 0xC3, 0x85, 0x2E, 0x0E, 0x66, 0x98,
-    0x8C, 0x37, 0x3D, 0x8E, 0x37, 0x72, 0xB8, 0x31, 0xEF, 0x8C, 0xC2, 0x46, 0x2B, 0x6E, 0x05, 0xB3,
-    0x28, 0xE0, 0x34, 0xB6, 0x1E, 0xD5, 0x50, 0x38, 0x10, 0xBC, 0xE8, 0xE0, 0x9F, 0x72, 0x5C, 0x33,
-    0xA8, 0xF5, 0x67, 0x70, 0x7E, 0x24, 0xB8, 0x5E, 0xD1, 0x77, 0x63, 0x0D, 0xB1, 0xFF, 0x5B, 0xFF,
-    0xA7, 0xFE, 0x0F, 0x00, 0x63, 0x60, 0x60, 0x66, 0x00, 0x01, 0x7B, 0x10, 0xC1, 0xFC, 0x1F, 0xCC,
-    0xFC, 0x0F, 0x66, 0x82, 0x48, 0x5B, 0x06, 0x7D, 0x20, 0xF3, 0x01, 0x88, 0xB4, 0x3F, 0x76, 0xA1,
-    0x1E, 0x24, 0x7A, 0xF0, 0x3F, 0x50, 0xC1, 0x3F, 0xF6, 0xFF, 0x40, 0xE6, 0x03, 0xFB, 0xFF, 0xFA,
-    0xFF, 0xFF, 0x31, 0xFF, 0xFF, 0x67, 0xFF, 0xFF, 0x03, 0x18, 0x35, 0xFD, 0x07, 0x49, 0xC6, 0xFF,
-    0xFF, 0x00, 0x24, 0x41, 0xFA, 0xED, 0xBF, 0x02, 0x99, 0x0C, 0xF6, 0x8E, 0x60, 0xA3, 0xD8, 0x81,
-    0x4C, 0x06, 0xBB, 0xFD, 0x60, 0x1B, 0x3E, 0xC0, 0xAD, 0x64, 0x50, 0x00, 0x62, 0x00,
+static const uint8_t notosans_12_bolditalicBitmaps[27527] = {
+    0xB5, 0x9A, 0x31, 0xAC, 0x25, 0xC7, 0x75, 0xA6, 0xBF, 0xEE, 0x12, 0xA7, 0xB1, 0x6C, 0xC0, 0xA5,
+    0x80, 0x06, 0x16, 0x14, 0xAC, 0x4E, 0x36, 0x10, 0x0C, 0x48, 0x95, 0x6E, 0xB0, 0x66, 0x35, 0x45,
+    0xC0, 0xC4, 0x42, 0xC1, 0x4C, 0x20, 0xAE, 0x03, 0x05, 0x93, 0x6C, 0x40, 0x13, 0x8B, 0x9D, 0xC4,
+    0xC9, 0x02, 0xCB, 0xA9, 0x26, 0x89, 0x85, 0x02, 0x05, 0x62, 0xA2, 0xC4, 0x80, 0x01, 0x06, 0x32,
+    0xC0, 0x1D, 0x07, 0xDE, 0x50, 0xC1, 0xCC, 0x74, 0x71, 0x5E, 0xC0, 0x80, 0x81, 0x9A, 0x1A, 0x2C,
+    0x18, 0x30, 0x60, 0x51, 0x22, 0xEC, 0x95, 0x85, 0xC5, 0x14, 0xC9, 0xA6, 0xD8, 0x9C, 0xA9, 0xEA,
+    0xDF, 0x41, 0xDF, 0x37, 0x7C, 0xE3, 0xB5, 0x00, 0xEF, 0x58, 0x6C, 0xBC, 0xE0, 0x76, 0xBD, 0xBE,
+    0xA7, 0x4E, 0x9F, 0xAA, 0xF3, 0x9F, 0xFF, 0xFC, 0x75, 0x9B, 0xBD, 0xDD, 0xDB, 0x6A, 0x8A, 0x29,
+    0x66, 0xEB, 0xD6, 0x3E, 0xF7, 0xD9, 0x26, 0xBB, 0xD8, 0x08, 0xE0, 0x08, 0xD3, 0x3C, 0x05, 0xBE,
+    0x86, 0xFB, 0xDE, 0xDD, 0xB5, 0x7A, 0x7B, 0x96, 0xB6, 0x97, 0x87, 0xE7, 0xDF, 0xCA, 0x2F, 0x3E,
+    0x0D, 0x26, 0x6D, 0x34, 0xEB, 0x9F, 0xC0, 0x4D, 0x07, 0xDE, 0x46, 0xEC, 0x73, 0xC9, 0x48, 0x8A,
+    0x92, 0xF2, 0x1F, 0xEF, 0xF3, 0x9B, 0xBC, 0x6C, 0x47, 0x5C, 0x1F, 0xDB, 0xBF, 0xFD, 0xCD, 0xFD,
+    0x67, 0x25, 0xE5, 0x20, 0x15, 0x6E, 0x3A, 0x78, 0xC6, 0x4E, 0x0C, 0xCF, 0x2F, 0xF4, 0x77, 0x32,
+    0x26, 0x17, 0x80, 0xBF, 0x80, 0x1E, 0x9C, 0x26, 0xAB, 0x6A, 0xA4, 0x18, 0xFE, 0xEA, 0xA9, 0xEE,
+    0x93, 0x48, 0xB8, 0x89, 0x51, 0x64, 0xD0, 0x84, 0x17, 0xCC, 0x2B, 0x36, 0x4C, 0xFC, 0x6A, 0xFB,
+    0x8B, 0x3F, 0x9A, 0x9F, 0x97, 0x72, 0x50, 0x69, 0xE6, 0x2F, 0xE0, 0xDF, 0x43, 0x37, 0xC2, 0xD7,
+    0x39, 0xAE, 0x76, 0xC7, 0x24, 0xAB, 0xC9, 0xC6, 0xE1, 0x5E, 0x74, 0x78, 0x1B, 0x5F, 0x26, 0xD8,
+    0xB8, 0x71, 0xDD, 0x9E, 0x65, 0x6E, 0x0D, 0x3F, 0x5A, 0xB8, 0xE5, 0xAF, 0xFE, 0x28, 0x85, 0xD9,
+    0x87, 0xE2, 0x6B, 0xD9, 0xEB, 0xF0, 0xC9, 0x67, 0xE5, 0x16, 0xDD, 0xAF, 0xD6, 0x5B, 0xD8, 0xB3,
+    0x7C, 0x0B, 0x6F, 0x72, 0xE1, 0x96, 0xC9, 0xA5, 0xD9, 0xCC, 0xE7, 0xAB, 0xC9, 0xAD, 0xB2, 0x8D,
+    0x68, 0xE2, 0xCB, 0x2B, 0xAC, 0xE0, 0xB4, 0xD0, 0x69, 0x87, 0xB9, 0xCF, 0xD8, 0x34, 0xC3, 0x6E,
+    0x13, 0xFD, 0xE7, 0x05, 0xBC, 0xA0, 0xD7, 0xF8, 0xA6, 0x51, 0x76, 0x51, 0xF3, 0x6B, 0xAB, 0xFB,
+    0x45, 0x95, 0x29, 0x56, 0x8B, 0x9F, 0xC2, 0x66, 0xAA, 0x11, 0x5E, 0x5A, 0x1B, 0x49, 0xB1, 0xD3,
+    0x87, 0x02, 0xC0, 0x5D, 0xBE, 0x9B, 0xB7, 0x97, 0x87, 0x4B, 0x13, 0x5D, 0xC2, 0x63, 0x56, 0xDC,
+    0xD4, 0x14, 0xEC, 0x42, 0xC0, 0x6C, 0xD8, 0x48, 0xA0, 0xDD, 0xB0, 0x0B, 0x7E, 0xA4, 0x60, 0x32,
+    0x36, 0xE2, 0x47, 0x2A, 0xED, 0x46, 0x97, 0xB1, 0x91, 0x61, 0x04, 0x30, 0xF9, 0xF4, 0xCD, 0x48,
+    0xC5, 0x2E, 0xDC, 0xA6, 0x4F, 0xDC, 0xC6, 0x26, 0x2A, 0x36, 0x36, 0x05, 0x37, 0x99, 0x95, 0x80,
+    0x5D, 0x9A, 0x82, 0x1F, 0x6D, 0x6A, 0x0B, 0xE1, 0x78, 0xAF, 0x6E, 0xA1, 0xD9, 0x98, 0x6E, 0x72,
+    0xDD, 0xE1, 0xF4, 0x93, 0x57, 0xA4, 0xDC, 0xA9, 0x74, 0x7A, 0xA2, 0xFB, 0x3C, 0x99, 0xB5, 0xF0,
+    0x2D, 0x37, 0xD2, 0x8D, 0xF0, 0x0C, 0xD8, 0x09, 0x93, 0x60, 0x03, 0x8F, 0x93, 0xDE, 0x97, 0x3E,
+    0xBB, 0xB1, 0xBF, 0xF9, 0xE8, 0x7F, 0x00, 0xB3, 0x0D, 0xCB, 0x6C, 0xF2, 0x30, 0x15, 0xE0, 0x89,
+    0xEF, 0xFB, 0x1A, 0x4A, 0x28, 0xDF, 0x71, 0xF7, 0xEE, 0x97, 0xA7, 0x80, 0x2E, 0x83, 0x9F, 0x68,
+    0x0A, 0xD8, 0x05, 0x66, 0x30, 0x2B, 0xB8, 0x08, 0x15, 0xFA, 0x04, 0x01, 0xCC, 0x06, 0xC3, 0x69,
+    0x24, 0x83, 0x1F, 0x69, 0x0B, 0xD8, 0x08, 0xFB, 0x85, 0x15, 0x61, 0x5E, 0x08, 0x1A, 0x07, 0x15,
+    0x53, 0xDC, 0x32, 0x8F, 0xD5, 0x66, 0xFB, 0x61, 0x65, 0x77, 0x71, 0xB8, 0x5B, 0x9A, 0xEA, 0xA3,
+    0x3B, 0xDB, 0x4C, 0xF1, 0x93, 0x3F, 0xDB, 0xBA, 0xD5, 0x4F, 0x32, 0xC5, 0x25, 0xA7, 0x82, 0x84,
+    0x39, 0x2D, 0x6D, 0x97, 0x51, 0x74, 0x7B, 0xA7, 0x75, 0xD6, 0x52, 0xE7, 0xE6, 0xB5, 0x82, 0x4D,
+    0x84, 0xB1, 0x29, 0xF4, 0x19, 0x1F, 0xD9, 0xE9, 0x56, 0x5C, 0x44, 0x98, 0x0D, 0x9B, 0x8E, 0x79,
+    0x5D, 0xA5, 0x57, 0x65, 0x56, 0xA1, 0xDA, 0xB5, 0x99, 0x86, 0x05, 0xC2, 0x88, 0x29, 0xE0, 0x16,
+    0x1A, 0xC1, 0x90, 0x69, 0x05, 0x2E, 0x61, 0x76, 0xF0, 0x0B, 0xA6, 0x82, 0x97, 0x5E, 0x91, 0x6A,
+    0x27, 0xAD, 0x00, 0x5C, 0xD2, 0x62, 0xA4, 0xC9, 0xAB, 0xB0, 0xB8, 0x85, 0xA6, 0xC2, 0x10, 0x31,
+    0x85, 0x1F, 0x88, 0x5E, 0x23, 0xDA, 0xE0, 0x5A, 0x86, 0x00, 0xDD, 0x0A, 0xF3, 0x7F, 0x64, 0xC8,
+    0x52, 0xB5, 0xD2, 0x14, 0xCE, 0xB7, 0x66, 0xBF, 0x42, 0x88, 0x74, 0x02, 0x5F, 0x30, 0x4A, 0xF8,
+    0x79, 0x6C, 0x6B, 0x61, 0x78, 0x27, 0x37, 0xC5, 0x4F, 0x76, 0xA9, 0xD4, 0x6E, 0xED, 0xEF, 0xCF,
+    0xFF, 0xC7, 0x4B, 0x59, 0xD2, 0x2B, 0x2F, 0x5C, 0xFD, 0x08, 0x02, 0x47, 0x48, 0x33, 0x04, 0x25,
+    0xAB, 0x8A, 0xB4, 0x0C, 0xFF, 0xFB, 0xFB, 0x6D, 0x01, 0x3F, 0x62, 0x56, 0x98, 0x35, 0x5A, 0xED,
+    0x5C, 0x9F, 0x33, 0x68, 0xA4, 0x5B, 0x21, 0x8C, 0xD8, 0xFC, 0x7A, 0xAB, 0x5E, 0x5A, 0x66, 0xAD,
+    0x97, 0xB4, 0x5D, 0xC8, 0x8F, 0x42, 0x50, 0x1C, 0xB4, 0x75, 0x15, 0x74, 0xBC, 0xCA, 0xF6, 0xE7,
+    0xF8, 0xB0, 0x75, 0xD2, 0x32, 0xFF, 0xDD, 0x6E, 0x57, 0x9B, 0x85, 0x6C, 0xB2, 0x49, 0x4D, 0xED,
+    0xB3, 0x8F, 0x41, 0x5B, 0xAB, 0x9D, 0x5E, 0xC7, 0x1E, 0x96, 0xB6, 0x41, 0x4A, 0xB3, 0x34, 0xBE,
+    0xF0, 0x83, 0x02, 0x3E, 0xD2, 0xEC, 0x87, 0x8F, 0xF3, 0x11, 0xDD, 0x47, 0x47, 0xBA, 0x02, 0x7E,
+    0xA1, 0xFD, 0x72, 0x04, 0x80, 0x46, 0x89, 0x59, 0x71, 0x78, 0x50, 0x4D, 0xB1, 0xC9, 0x8F, 0xBB,
+    0xD9, 0x6C, 0x72, 0x67, 0x05, 0x89, 0x4E, 0xA3, 0x51, 0x41, 0x57, 0xB3, 0x8F, 0xE1, 0xB9, 0xD5,
+    0x6C, 0x61, 0xF4, 0x3F, 0xDC, 0xBA, 0xD5, 0xDF, 0x57, 0x23, 0x2D, 0x9D, 0xD2, 0xF9, 0xEB, 0xB8,
+    0x8D, 0xA0, 0xE8, 0xB5, 0xB9, 0x45, 0x36, 0x0D, 0xEF, 0xAD, 0xDD, 0x67, 0xA5, 0xAD, 0x61, 0xD4,
+    0xF0, 0xB1, 0xCE, 0xA4, 0x1C, 0x1E, 0x6C, 0xED, 0x4F, 0x2B, 0xCC, 0x10, 0x26, 0x42, 0x94, 0x16,
+    0xAF, 0xC5, 0x1E, 0xEB, 0xD2, 0xAC, 0x43, 0x9E, 0x5F, 0xA9, 0x8C, 0xE7, 0xD6, 0xDA, 0xE4, 0x92,
+    0x5E, 0x2D, 0xCD, 0x08, 0xC3, 0x38, 0xE4, 0x7E, 0x6B, 0x2A, 0x5F, 0xE3, 0x91, 0xCB, 0x2E, 0x5D,
+    0x36, 0x1B, 0x85, 0xDB, 0xF8, 0x87, 0x83, 0xED, 0x42, 0xBF, 0xE2, 0x36, 0xE6, 0xD4, 0x6A, 0xEA,
+    0x76, 0xDA, 0x7D, 0xC4, 0x55, 0x98, 0x37, 0x1A, 0x65, 0xBA, 0x0A, 0xFD, 0x08, 0xBC, 0x74, 0xE3,
+    0xC6, 0x91, 0x91, 0xEB, 0xC9, 0x7D, 0xE9, 0x7D, 0xE9, 0xB7, 0x52, 0x1D, 0xE1, 0x3B, 0xD0, 0x6F,
+    0x34, 0x4A, 0x74, 0x9A, 0xE8, 0x77, 0x70, 0x2B, 0x5D, 0xC5, 0xED, 0xCD, 0xBC, 0x76, 0x5A, 0xDA,
+    0x1D, 0x7E, 0xF6, 0x10, 0x4E, 0x5B, 0x2D, 0x4E, 0xDB, 0xA0, 0xF2, 0x07, 0x6D, 0xA5, 0x29, 0xB4,
+    0x85, 0x7E, 0x23, 0xA4, 0x46, 0xA3, 0x29, 0x74, 0x99, 0xFE, 0x3C, 0x48, 0xFD, 0x84, 0x8F, 0xF8,
+    0x88, 0x9F, 0x8E, 0xB7, 0xB9, 0xF6, 0x6B, 0x68, 0xA5, 0x4C, 0xB7, 0xFF, 0xA5, 0xC6, 0x7E, 0xA5,
+    0xCF, 0x7D, 0x86, 0xEB, 0x26, 0x0F, 0xBB, 0x3D, 0xCB, 0x4E, 0x77, 0xF2, 0xE6, 0x5E, 0xCB, 0x37,
+    0x5F, 0x1E, 0xA6, 0xCD, 0xB9, 0x3E, 0xBE, 0xDC, 0xFF, 0xFC, 0x2C, 0x3B, 0xF3, 0x69, 0xDE, 0xEC,
+    0x5B, 0x6B, 0xF1, 0x7D, 0x2A, 0xCE, 0x4A, 0xB5, 0x5F, 0xF4, 0xE3, 0x4A, 0x79, 0x62, 0xFC, 0x3E,
+    0x6E, 0x02, 0x4C, 0xE5, 0x8F, 0xC0, 0x4B, 0x23, 0x8D, 0x34, 0x01, 0x57, 0x00, 0x18, 0x56, 0xB0,
+    0x3B, 0x74, 0x9A, 0x30, 0x0F, 0x12, 0x4D, 0x2D, 0x50, 0x03, 0x04, 0x1B, 0xF1, 0xAF, 0x65, 0x5C,
+    0x2C, 0xD8, 0xE4, 0xC7, 0xFE, 0x8B, 0xAB, 0x8B, 0x91, 0xB6, 0x56, 0xDA, 0x91, 0x14, 0x67, 0xFA,
+    0xEC, 0xA7, 0xB6, 0xB8, 0xC8, 0x6C, 0x13, 0x43, 0x64, 0xDE, 0x47, 0xA4, 0x15, 0xA9, 0x34, 0xFB,
+    0x9F, 0x95, 0xA6, 0xB4, 0xB5, 0x2D, 0x6D, 0x31, 0xA5, 0xDB, 0x8C, 0x94, 0x3B, 0x69, 0xEC, 0xA5,
+    0xC9, 0xE6, 0x6B, 0xC9, 0x66, 0x9B, 0x6D, 0xB2, 0x79, 0x58, 0x6C, 0x76, 0x31, 0x24, 0x2F, 0x45,
+    0x2F, 0xE1, 0xF5, 0xD1, 0x09, 0x52, 0x95, 0x08, 0x2A, 0x8D, 0xB4, 0x19, 0x3D, 0xFB, 0xBF, 0xEC,
+    0x06, 0x43, 0x06, 0xB7, 0x80, 0x8F, 0xE0, 0x27, 0x08, 0xE3, 0xB1, 0x61, 0xE7, 0xF1, 0xF8, 0x1C,
+    0x22, 0xF8, 0x74, 0x89, 0x41, 0xA2, 0x97, 0x68, 0x54, 0x4F, 0x18, 0xB7, 0x83, 0xD7, 0x86, 0x95,
+    0x62, 0xF7, 0xC5, 0xB5, 0xB5, 0xA9, 0x8D, 0x98, 0xF1, 0xD1, 0xC7, 0x3E, 0xDB, 0xD4, 0x96, 0x6E,
+    0x45, 0x6D, 0xC1, 0x47, 0x61, 0xB3, 0x8F, 0xFD, 0x6A, 0x93, 0x29, 0xDD, 0x6A, 0xF6, 0xB6, 0x7E,
+    0x43, 0x48, 0xC2, 0x6B, 0xC7, 0xEA, 0x23, 0x60, 0xD6, 0x6A, 0xA4, 0x68, 0x25, 0xC2, 0x4F, 0xAE,
+    0x34, 0xE7, 0xF0, 0x1A, 0x41, 0x5A, 0x3A, 0x09, 0xA7, 0x82, 0x5E, 0xB8, 0x62, 0x0A, 0xD8, 0x04,
+    0x61, 0xA4, 0xAD, 0x60, 0x25, 0xBC, 0x0A, 0x52, 0x86, 0x59, 0xF9, 0x77, 0xD8, 0xD8, 0xE1, 0xA1,
+    0x0D, 0xA5, 0x8B, 0x36, 0x4E, 0x48, 0xE3, 0xA7, 0x0B, 0x00, 0x7E, 0x49, 0x1B, 0x5E, 0x42, 0xAA,
+    0x46, 0xE3, 0x7F, 0xE9, 0xCB, 0xA3, 0x41, 0x0A, 0x93, 0x4A, 0x18, 0x55, 0xE6, 0x51, 0xDB, 0x3C,
+    0x76, 0x6B, 0x18, 0xFB, 0x1C, 0xA2, 0xCD, 0x3E, 0xD9, 0x34, 0x48, 0x4B, 0x2F, 0x2D, 0x8D, 0xF6,
+    0x23, 0xC3, 0x66, 0xEC, 0x62, 0x73, 0x53, 0xD9, 0x71, 0x71, 0x48, 0xA6, 0x34, 0x15, 0x3F, 0xB9,
+    0xD8, 0xAD, 0xA6, 0x10, 0x46, 0x7F, 0x2C, 0xA0, 0x98, 0xA5, 0x64, 0x3F, 0xFB, 0x4F, 0x15, 0xE1,
+    0xA2, 0x3D, 0x3D, 0x17, 0x5D, 0x34, 0xDB, 0xF1, 0xDC, 0xD4, 0x67, 0xB3, 0x21, 0xD0, 0x8E, 0x76,
+    0xB4, 0xE1, 0xCE, 0xF7, 0xB7, 0x1F, 0x09, 0x23, 0x33, 0x08, 0x76, 0x9A, 0x4A, 0x5B, 0x68, 0x0B,
+    0xA6, 0x30, 0xEC, 0x04, 0x8D, 0xB3, 0x8E, 0x95, 0x74, 0x11, 0x9B, 0x31, 0x05, 0xF6, 0x8B, 0xF7,
+    0x1B, 0xCD, 0x0E, 0xF3, 0xC5, 0xFB, 0x03, 0x3C, 0x7C, 0xC4, 0x66, 0xBA, 0x8D, 0xAE, 0xA0, 0x1D,
+    0x2F, 0xEC, 0x7E, 0xA4, 0xE2, 0x8C, 0x8F, 0x36, 0xDB, 0x95, 0xBD, 0xDD, 0x19, 0x96, 0x39, 0x36,
+    0x65, 0xC8, 0xB8, 0xB3, 0x82, 0x29, 0x1A, 0xF1, 0xF3, 0x42, 0xA7, 0x0D, 0x66, 0x4D, 0x58, 0x15,
+    0x90, 0x5B, 0xB0, 0x49, 0x34, 0xD5, 0x66, 0x5C, 0x0C, 0x93, 0x29, 0xA6, 0xE0, 0x27, 0xB7, 0x98,
+    0xB5, 0xD9, 0xB9, 0xE8, 0x7C, 0x73, 0xEE, 0xBC, 0xD9, 0xE8, 0x56, 0xFA, 0x8C, 0x3D, 0xFE, 0x12,
+    0xC3, 0x82, 0x8B, 0x78, 0x15, 0xAF, 0xE2, 0xB5, 0x31, 0x2F, 0xF8, 0x6C, 0x34, 0xB6, 0x8A, 0xB6,
+    0x62, 0x77, 0xC2, 0xC6, 0xBC, 0x36, 0x4A, 0x46, 0xB1, 0xBF, 0x37, 0xB9, 0x19, 0x7F, 0x9D, 0xBD,
+    0x50, 0x4A, 0xFF, 0x41, 0xEA, 0x3E, 0xCD, 0xDE, 0x8F, 0xEE, 0xE7, 0x77, 0x3E, 0x2E, 0xEC, 0x7E,
+    0xF8, 0x51, 0x36, 0x6B, 0x29, 0x6E, 0xB2, 0x67, 0x9F, 0xA7, 0x9D, 0xD0, 0xCB, 0xAC, 0xED, 0xE6,
+    0xB6, 0x21, 0xDA, 0x34, 0xC7, 0x19, 0xFF, 0xDD, 0xDD, 0x6C, 0x94, 0x2E, 0xDB, 0x05, 0xE6, 0xA9,
+    0x29, 0x28, 0xB6, 0x05, 0x2D, 0x66, 0x6B, 0x94, 0xCD, 0xDA, 0x2A, 0x77, 0xB9, 0x7D, 0xB0, 0xF6,
+    0xD9, 0xFC, 0xB6, 0xF4, 0xC9, 0x7C, 0x5C, 0x6C, 0xEA, 0x72, 0xB5, 0x4B, 0x9F, 0x35, 0x44, 0x9B,
+    0x82, 0x8B, 0x76, 0xF1, 0xD7, 0x26, 0x1B, 0xBD, 0xC6, 0x21, 0x0E, 0x1A, 0x5D, 0xB4, 0xC2, 0x4F,
+    0x56, 0xF8, 0xB1, 0xDF, 0x09, 0x98, 0x7A, 0x5E, 0x14, 0x3E, 0xA2, 0x93, 0xA6, 0x4E, 0x5A, 0xCD,
+    0xDE, 0xCA, 0xEC, 0xF8, 0xB7, 0x44, 0xBF, 0xCE, 0x63, 0x53, 0x7D, 0x24, 0x5C, 0x4E, 0x0C, 0xEF,
+    0xAD, 0xF4, 0xBF, 0xAD, 0x98, 0x32, 0x8F, 0x8D, 0x86, 0x85, 0xF9, 0xF9, 0x42, 0x88, 0x9A, 0xE6,
+    0x65, 0x90, 0x52, 0x2B, 0x25, 0x86, 0xF3, 0xC2, 0x7B, 0xE0, 0x45, 0x46, 0xDA, 0x9A, 0xFD, 0x07,
+    0x27, 0xBC, 0x68, 0xAA, 0x29, 0x6D, 0x35, 0x9B, 0x29, 0xDD, 0x17, 0xD7, 0xB6, 0x5E, 0x4A, 0x56,
+    0x1A, 0xED, 0xFD, 0x9F, 0x62, 0x13, 0x0C, 0xCB, 0xC1, 0x73, 0xCE, 0x31, 0xC0, 0x9F, 0x97, 0x87,
+    0x47, 0x9D, 0xFB, 0xEE, 0xBF, 0xCC, 0x39, 0x3D, 0x5F, 0x98, 0xCF, 0x9D, 0x5B, 0x5A, 0x69, 0x61,
+    0x50, 0x84, 0x7E, 0x03, 0xC4, 0x91, 0x4D, 0x66, 0x07, 0xFE, 0x10, 0xE6, 0xFB, 0x18, 0x69, 0xB4,
+    0xD2, 0x18, 0x5E, 0xDD, 0x9B, 0x6A, 0x4A, 0x9F, 0x6D, 0xF6, 0xD1, 0x4F, 0xBB, 0xA9, 0x9D, 0x94,
+    0x9C, 0x76, 0xA4, 0xC5, 0x94, 0x30, 0xDA, 0x24, 0xC2, 0x77, 0x6B, 0x5B, 0xBA, 0xCD, 0x66, 0x9B,
+    0xFD, 0xE4, 0xD2, 0x8E, 0x8F, 0xE7, 0x8E, 0x4A, 0x8B, 0x53, 0x31, 0xF5, 0xD2, 0x18, 0xA6, 0x83,
+    0x14, 0x44, 0x8C, 0x46, 0x86, 0xFD, 0xE0, 0xC8, 0x8A, 0x98, 0x0A, 0x43, 0xA2, 0xA9, 0x97, 0x46,
+    0xBF, 0xCC, 0x2A, 0xBD, 0x84, 0x3B, 0x02, 0x17, 0xA4, 0x77, 0xA4, 0x22, 0xE9, 0x7F, 0x5C, 0xFD,
+    0xEC, 0x0A, 0x02, 0x9B, 0x68, 0x2A, 0xB8, 0x78, 0x5E, 0xE1, 0xCD, 0x06, 0x61, 0xA4, 0xCF, 0x20,
+    0xB0, 0x99, 0x66, 0x87, 0x61, 0xA1, 0x2D, 0xD0, 0x16, 0xC2, 0x28, 0x5C, 0xF4, 0x93, 0xCD, 0xC3,
+    0x62, 0x4A, 0x9F, 0xD9, 0x4D, 0x21, 0x8C, 0x3B, 0x2E, 0x86, 0xC9, 0x66, 0xB7, 0x98, 0xAD, 0xCF,
+    0xCD, 0xA3, 0x83, 0x43, 0xEA, 0x36, 0x53, 0xBB, 0x82, 0xB4, 0x63, 0xB5, 0xC3, 0x7C, 0xDA, 0x17,
+    0xB7, 0x31, 0xF7, 0x0B, 0xEE, 0xFD, 0x8C, 0x86, 0xD8, 0xAD, 0x01, 0xFF, 0x56, 0x69, 0xAA, 0xC9,
+    0x36, 0xDB, 0x25, 0xE0, 0x9F, 0xDB, 0xA8, 0x43, 0x34, 0xEB, 0x8E, 0xFD, 0xFB, 0x8C, 0x9B, 0x27,
+    0x6E, 0x17, 0x5A, 0x25, 0x3A, 0xC1, 0xB0, 0x1D, 0x6B, 0x79, 0x9B, 0x21, 0x9A, 0xDF, 0x16, 0x84,
+    0x7B, 0x27, 0x77, 0x85, 0xDD, 0x45, 0x97, 0xBB, 0x3C, 0xA3, 0xE8, 0xEF, 0x94, 0xFE, 0x20, 0x3B,
+    0x37, 0xFB, 0xEC, 0xEE, 0xDC, 0x5F, 0xFD, 0x18, 0xEC, 0x3B, 0xBF, 0x28, 0x4D, 0xB9, 0xEE, 0x2E,
+    0xA7, 0xEE, 0xD3, 0xF5, 0x56, 0x60, 0xF8, 0xE0, 0xCE, 0xE7, 0x1B, 0xE1, 0x56, 0xFF, 0x41, 0x6C,
+    0x94, 0xDD, 0x4C, 0xA7, 0x71, 0x5E, 0x19, 0x4A, 0xA3, 0x48, 0x48, 0x07, 0x9D, 0x1A, 0x32, 0xE0,
+    0xA7, 0x6E, 0xC3, 0x47, 0x9B, 0x19, 0x16, 0xBF, 0x60, 0x53, 0x98, 0xB0, 0x59, 0xD0, 0x7D, 0x5E,
+    0xC0, 0x68, 0x05, 0xA3, 0x04, 0xAD, 0x22, 0x18, 0x45, 0xB0, 0x8A, 0xE0, 0xEE, 0x2D, 0x10, 0x7E,
+    0x9C, 0x41, 0x7D, 0xC6, 0xD4, 0x6E, 0xA3, 0xDF, 0x4C, 0x61, 0xC8, 0xA6, 0xE2, 0x63, 0xB3, 0x33,
+    0x63, 0x3F, 0xAE, 0xCC, 0xCF, 0x6D, 0x5D, 0xB1, 0xD9, 0x47, 0x77, 0xA7, 0x12, 0x2E, 0x27, 0xAA,
+    0x30, 0x5A, 0xE9, 0x35, 0x31, 0x1C, 0x5C, 0x0B, 0x9D, 0xC8, 0xF9, 0x89, 0xB9, 0x9F, 0x30, 0xDE,
+    0x4F, 0xC0, 0xAC, 0x8A, 0x54, 0x1B, 0xA9, 0xF0, 0xC2, 0xD5, 0x15, 0x5C, 0x82, 0x39, 0xD2, 0x08,
+    0x4C, 0x05, 0xBB, 0x81, 0xCB, 0x47, 0xA9, 0x3B, 0x0D, 0xF5, 0xA7, 0xCA, 0xE8, 0xA5, 0x29, 0x48,
+    0xD3, 0x2C, 0x8D, 0xB8, 0x0D, 0xA5, 0xEE, 0xFE, 0xE8, 0x26, 0x6E, 0x9D, 0x5A, 0x9E, 0x87, 0x5D,
+    0x10, 0x14, 0xBA, 0x84, 0x9B, 0xA8, 0x98, 0xCC, 0x10, 0xB9, 0x4D, 0xBB, 0x62, 0xFF, 0x01, 0xBF,
+    0x35, 0x5A, 0xF0, 0x14, 0x93, 0xED, 0xE2, 0xC6, 0xEB, 0x4D, 0x31, 0xD9, 0x46, 0x3F, 0xDE, 0x6A,
+    0xB7, 0x2E, 0xDB, 0xE8, 0x29, 0x66, 0xED, 0x13, 0x1C, 0x0F, 0x5E, 0x9A, 0xA1, 0xD0, 0xE5, 0x87,
+    0x96, 0x6C, 0xE4, 0xFA, 0xC3, 0x49, 0x9A, 0x63, 0x92, 0x53, 0xCB, 0x35, 0xC4, 0x27, 0x77, 0xC2,
+    0xDA, 0x2A, 0x42, 0x93, 0xC1, 0x43, 0xBF, 0xD2, 0x28, 0xE2, 0x6F, 0xD2, 0xBF, 0xB7, 0xB0, 0x3D,
+    0x83, 0x6F, 0x73, 0xBF, 0x0C, 0x14, 0x36, 0x8F, 0xBD, 0xF3, 0x3A, 0x2F, 0x3A, 0x6D, 0x5E, 0x05,
+    0xB3, 0x0D, 0xF1, 0x56, 0x9B, 0xB8, 0xFE, 0xA7, 0xAF, 0xFB, 0x5A, 0xAC, 0xF4, 0x96, 0x2E, 0x17,
+    0x1F, 0xC3, 0x0F, 0xB7, 0x6E, 0x9D, 0xC7, 0x60, 0x73, 0x9F, 0xC5, 0x6E, 0xF3, 0x90, 0x64, 0x6A,
+    0x2F, 0x45, 0xBF, 0x97, 0x46, 0x57, 0xA7, 0x53, 0x55, 0xC3, 0x66, 0x38, 0x76, 0x7F, 0x53, 0xC0,
+    0xBD, 0x93, 0xCC, 0x03, 0x45, 0xAF, 0xDA, 0x55, 0x97, 0xE6, 0x51, 0x36, 0xDB, 0xBC, 0xB3, 0xDB,
+    0xC5, 0x7E, 0x58, 0xDA, 0xEA, 0xA2, 0x3F, 0xDB, 0xFB, 0xCD, 0x4B, 0x46, 0x8A, 0x2F, 0xFB, 0x0C,
+    0xC0, 0xB5, 0x8F, 0x5A, 0x15, 0xAB, 0xCD, 0xAD, 0xFF, 0xCE, 0x47, 0xC2, 0x74, 0x2A, 0x03, 0xC7,
+    0xDF, 0x3C, 0x8E, 0x41, 0x8B, 0xD7, 0xD2, 0x9F, 0x70, 0xCD, 0xAC, 0x47, 0xE7, 0xF5, 0x70, 0x71,
+    0x9B, 0xCD, 0x8F, 0xBE, 0x16, 0x23, 0xE5, 0x21, 0x2B, 0xAA, 0xD9, 0xBB, 0xAD, 0x5B, 0x5D, 0x1C,
+    0xA2, 0x98, 0x4D, 0x31, 0x9B, 0xCD, 0xC3, 0xE2, 0xA3, 0xC6, 0x59, 0x05, 0x3D, 0xC8, 0x8D, 0x2E,
+    0x1F, 0x96, 0xDC, 0x47, 0xCC, 0x1A, 0x67, 0xE5, 0xF0, 0x4A, 0xF5, 0x31, 0x0C, 0x4B, 0x78, 0x47,
+    0xBA, 0x2B, 0x4D, 0xFA, 0x6B, 0x7C, 0xA4, 0xCF, 0x4D, 0xA3, 0xBF, 0x59, 0xBC, 0xD6, 0xF6, 0x62,
+    0x17, 0xE1, 0x0A, 0xCC, 0x05, 0xB4, 0xD2, 0xD6, 0xC3, 0x87, 0x6E, 0x9F, 0x08, 0x8A, 0xCC, 0x8A,
+    0xD8, 0x7C, 0xC4, 0xE4, 0x9F, 0x85, 0xD3, 0x73, 0x5A, 0x75, 0xC2, 0xBF, 0x1D, 0x9A, 0x93, 0x89,
+    0xB9, 0xC0, 0x9C, 0x61, 0x9E, 0x00, 0xF7, 0xCA, 0x4F, 0x8D, 0x3E, 0x88, 0x5E, 0x6A, 0x74, 0xB9,
+    0xD8, 0x3C, 0xA4, 0x30, 0x85, 0xEF, 0xD6, 0xA6, 0xD8, 0xDC, 0x67, 0x1F, 0xFD, 0xA4, 0x66, 0x37,
+    0x65, 0x58, 0xFB, 0x13, 0xCB, 0x19, 0x3E, 0xDD, 0xCE, 0x5B, 0xD5, 0x2B, 0x5D, 0x69, 0xA5, 0xD8,
+    0xAB, 0xD2, 0x6B, 0xFA, 0xE7, 0x56, 0xE8, 0xED, 0xD3, 0x0A, 0xED, 0xDD, 0x3E, 0xE4, 0x39, 0xCA,
+    0x66, 0x9B, 0x44, 0xB5, 0x69, 0x78, 0xB7, 0xB6, 0xC5, 0x45, 0x7F, 0x56, 0xCC, 0xE6, 0x27, 0xFF,
+    0xDC, 0xDA, 0xE5, 0xC0, 0x0C, 0x30, 0x4C, 0x36, 0x9B, 0xC2, 0x8B, 0xC0, 0xD3, 0x93, 0xCD, 0x66,
+    0x6B, 0xEA, 0xA9, 0xF6, 0x7F, 0xF9, 0x31, 0x99, 0xB5, 0x39, 0x21, 0xD6, 0x30, 0x9D, 0x13, 0x8C,
+    0x17, 0x01, 0x78, 0x7A, 0xBA, 0x40, 0x28, 0x02, 0xBF, 0x83, 0x60, 0x3C, 0x72, 0xEF, 0x12, 0xCA,
+    0xF8, 0x0D, 0xBB, 0xF2, 0xFF, 0xC4, 0xAB, 0x29, 0xD0, 0x96, 0xF6, 0x4D, 0x53, 0xEC, 0x6A, 0x36,
+    0xBF, 0x74, 0xEB, 0x3C, 0xF6, 0x9F, 0x54, 0xEC, 0x83, 0x15, 0xAB, 0x84, 0x55, 0x66, 0xD0, 0x8A,
+    0x7B, 0x6F, 0xC3, 0x9F, 0x15, 0xFC, 0x2B, 0x3B, 0x7E, 0x14, 0xE1, 0xD8, 0x5B, 0x3E, 0xDA, 0xD4,
+    0xAD, 0x0F, 0xFD, 0xEE, 0xD6, 0xB6, 0xA0, 0x47, 0x3E, 0x4E, 0xC3, 0xD2, 0xAD, 0x34, 0x6F, 0xDC,
+    0xE6, 0x36, 0xDE, 0x97, 0xB0, 0x99, 0x07, 0xBA, 0xA7, 0x18, 0x3E, 0xD4, 0x2F, 0x6A, 0x5F, 0xEC,
+    0x3A, 0x2C, 0x42, 0x4D, 0xB1, 0x79, 0x58, 0x5C, 0xDC, 0xDB, 0x62, 0xCA, 0xB0, 0xB8, 0xE8, 0x5F,
+    0x2D, 0x66, 0xEB, 0x56, 0x1F, 0xFD, 0x14, 0x0E, 0xE5, 0xCA, 0x8F, 0x33, 0xEA, 0xB2, 0xCD, 0x36,
+    0x35, 0x6F, 0xDC, 0xC6, 0xFB, 0x62, 0x1E, 0x28, 0x85, 0x0F, 0xD5, 0x17, 0x7B, 0x64, 0x95, 0x5D,
+    0xF6, 0xA6, 0x0E, 0x8B, 0xBB, 0x53, 0x4C, 0xF1, 0xD1, 0xBF, 0xB6, 0x99, 0xD5, 0x8F, 0xA1, 0xCB,
+    0x7D, 0xE6, 0x5A, 0x42, 0x42, 0xCA, 0xF3, 0x59, 0xF1, 0x31, 0x5C, 0x5D, 0xEC, 0x6F, 0xB2, 0xF9,
+    0xBC, 0x34, 0x55, 0xCC, 0x3E, 0xFA, 0x77, 0xB2, 0x7B, 0x57, 0xCA, 0x4E, 0xB9, 0x3D, 0xB5, 0x84,
+    0x2F, 0xBA, 0xC9, 0x7C, 0xAE, 0x68, 0xA5, 0x31, 0xFC, 0x62, 0x6F, 0xAB, 0x29, 0x47, 0x71, 0xF4,
+    0x53, 0x65, 0xEF, 0x72, 0xBF, 0xBA, 0xE8, 0xA3, 0x5E, 0xDD, 0x8D, 0x94, 0xED, 0x3D, 0x11, 0x5C,
+    0xBE, 0x40, 0x7B, 0xCF, 0x69, 0xB2, 0x8B, 0x40, 0xF8, 0xD3, 0xE9, 0x1C, 0x0C, 0xEC, 0x43, 0x30,
+    0xE0, 0x02, 0x18, 0x2C, 0x32, 0xB5, 0xDF, 0x15, 0xBD, 0x4A, 0x23, 0x3F, 0x61, 0x56, 0x08, 0x3C,
+    0xAC, 0x88, 0x89, 0xA6, 0xD2, 0xBC, 0x71, 0xCB, 0x7C, 0x5E, 0x8C, 0x4A, 0xA7, 0x37, 0xFB, 0x82,
+    0x5D, 0x1F, 0xA5, 0x6F, 0x17, 0x38, 0x2B, 0x73, 0xEA, 0x54, 0xAC, 0x8A, 0x4D, 0x4F, 0x0D, 0x09,
+    0x5B, 0xE8, 0x35, 0xB5, 0x4A, 0xF8, 0x8C, 0xCD, 0x63, 0x9F, 0x6F, 0xCF, 0x79, 0x56, 0x0C, 0x07,
+    0x33, 0xFF, 0xCF, 0xD8, 0xA9, 0x5D, 0x99, 0x7F, 0x1D, 0xF4, 0xBE, 0xAA, 0x4D, 0x4D, 0xC5, 0xC5,
+    0xB6, 0xE0, 0xA3, 0xD9, 0x08, 0x63, 0xBF, 0x32, 0xFF, 0xDF, 0x4E, 0x8B, 0x2B, 0xC0, 0x93, 0x6F,
+    0x3C, 0xF9, 0xFA, 0x4E, 0x1D, 0x96, 0xE1, 0xAD, 0x72, 0x61, 0x73, 0x87, 0xE7, 0xD7, 0x3E, 0x07,
+    0xD4, 0xE7, 0x21, 0xCD, 0x66, 0xEF, 0xA5, 0xC5, 0xD7, 0xD2, 0xE8, 0x72, 0x04, 0x78, 0x89, 0x3F,
+    0xFE, 0x51, 0xEE, 0xB6, 0x80, 0xBA, 0x3C, 0x24, 0x6F, 0x8A, 0x59, 0xC3, 0xE8, 0x2F, 0x67, 0xF3,
+    0x59, 0xC5, 0x5F, 0x8B, 0xED, 0x83, 0x15, 0x27, 0x1A, 0x45, 0x86, 0x0D, 0x04, 0x2F, 0x71, 0x83,
+    0x1B, 0xA1, 0x51, 0x53, 0x83, 0x51, 0x5B, 0x42, 0x27, 0xB3, 0x86, 0xFE, 0x5E, 0x9F, 0xBD, 0xFD,
+    0x5B, 0x9B, 0xBC, 0xBB, 0x36, 0x44, 0xEF, 0x9D, 0x9F, 0xFC, 0xCB, 0x2E, 0xE0, 0x6F, 0xBA, 0xDB,
+    0xF8, 0xCD, 0x15, 0x7C, 0x76, 0x1B, 0x3E, 0xB9, 0x8C, 0x5F, 0x5C, 0x82, 0x1B, 0xDC, 0xC0, 0x2D,
+    0xF3, 0xD4, 0x6D, 0x21, 0x22, 0x1F, 0x19, 0x14, 0x31, 0x5A, 0x60, 0x4E, 0xE0, 0x33, 0xB8, 0x1D,
+    0x9C, 0x22, 0xC3, 0xDF, 0xAF, 0xD8, 0x2C, 0x6C, 0x76, 0xD1, 0xAE, 0xDD, 0x46, 0xF3, 0x26, 0x37,
+    0x98, 0x09, 0xD3, 0x10, 0x7D, 0xEC, 0xF2, 0x90, 0xA8, 0x7D, 0xC6, 0x3F, 0xB7, 0x61, 0x7F, 0x59,
+    0x68, 0xB7, 0x0A, 0xB7, 0x67, 0x18, 0xE6, 0x91, 0x4E, 0x11, 0xB4, 0x1C, 0x06, 0xED, 0x7A, 0x54,
+    0xCB, 0xB6, 0x40, 0xBB, 0x83, 0x13, 0xF4, 0x82, 0xB6, 0x02, 0xDC, 0xB8, 0x31, 0x05, 0x25, 0xA7,
+    0x8D, 0xEE, 0xA0, 0xE2, 0x95, 0xB6, 0xD2, 0xEE, 0x34, 0xFB, 0x43, 0x84, 0x56, 0xF2, 0xDA, 0x06,
+    0x55, 0xE0, 0x16, 0x5D, 0xC1, 0x16, 0x86, 0x05, 0x37, 0xE1, 0x47, 0x3C, 0x04, 0xB8, 0xCD, 0x37,
+    0x0A, 0x6E, 0xC5, 0x2F, 0x7C, 0x23, 0x63, 0x56, 0xCC, 0x8A, 0xC9, 0x98, 0x4C, 0x97, 0xE9, 0x33,
+    0x5D, 0xC5, 0x54, 0xB8, 0xC5, 0x7F, 0xFF, 0x1D, 0xD7, 0x8B, 0xFC, 0x37, 0x1A, 0xD1, 0x17, 0xCC,
+    0x8A, 0x8D, 0x47, 0xF9, 0xEB, 0x13, 0x6E, 0x22, 0xBC, 0xCE, 0x1C, 0x2F, 0xED, 0x84, 0xF4, 0xA8,
+    0x18, 0x19, 0xB0, 0x85, 0xB0, 0x34, 0x1B, 0x0C, 0x89, 0x6B, 0xFA, 0xBB, 0xF7, 0xA5, 0xDF, 0x8E,
+    0xD7, 0x0E, 0x18, 0xFF, 0x7A, 0x03, 0xEB, 0x30, 0x1E, 0x5A, 0x4F, 0xB6, 0xAB, 0xC6, 0xF9, 0x7B,
+    0xAB, 0x29, 0x3E, 0xF6, 0x79, 0xC6, 0xA6, 0x1D, 0x77, 0xA7, 0x10, 0xBA, 0xCC, 0xEB, 0xFF, 0x06,
+    0xC6, 0xAF, 0x71, 0xB3, 0x8F, 0x36, 0xED, 0xCC, 0x7D, 0x36, 0x9B, 0x1F, 0xFD, 0x59, 0x31, 0xC5,
+    0x47, 0xD9, 0xEC, 0xEE, 0xD6, 0x7E, 0x9D, 0xC7, 0xEB, 0x5D, 0x62, 0xFA, 0xB7, 0xA7, 0xEA, 0xD0,
+    0x9D, 0xE3, 0x95, 0x8D, 0xC0, 0x7A, 0xCE, 0x9E, 0x47, 0x50, 0x82, 0xB0, 0x81, 0xBF, 0x0D, 0xC3,
+    0x07, 0x11, 0xFB, 0x5E, 0xA6, 0xCB, 0x05, 0xB3, 0x79, 0xDA, 0x62, 0x23, 0xBB, 0x59, 0x99, 0x7F,
+    0x52, 0xF1, 0xD2, 0xE4, 0x0E, 0x62, 0x5E, 0xFA, 0xCC, 0x6C, 0x36, 0xDC, 0x9D, 0x42, 0x9F, 0x77,
+    0x9A, 0x72, 0x9A, 0xC6, 0x94, 0x13, 0x24, 0xBA, 0x09, 0xBA, 0xE5, 0x34, 0x3A, 0xAC, 0x1C, 0xBA,
+    0x61, 0xD8, 0xC0, 0xDE, 0x9B, 0x0E, 0xB9, 0xC1, 0x5F, 0x8D, 0x74, 0xB9, 0xC0, 0x6E, 0x23, 0x2E,
+    0x16, 0xCC, 0x66, 0x17, 0xE6, 0x9F, 0x54, 0xEC, 0xD1, 0x33, 0xEC, 0x78, 0x29, 0xF7, 0x99, 0x99,
+    0x9D, 0x3E, 0xBB, 0xC8, 0x6C, 0x36, 0xBA, 0x7C, 0xAE, 0x61, 0x26, 0x18, 0x04, 0xDD, 0xC7, 0x1B,
+    0xCD, 0xD6, 0xC7, 0xAF, 0x68, 0xAE, 0x6F, 0xF6, 0x23, 0xF6, 0xED, 0x8C, 0xF9, 0x78, 0x83, 0x2B,
+    0x4F, 0x9D, 0xC2, 0x59, 0x8F, 0x59, 0x1A, 0x25, 0xD8, 0x37, 0x08, 0xE1, 0x98, 0x64, 0x38, 0xCB,
+    0xD8, 0x54, 0xE8, 0xB3, 0xC7, 0x6C, 0x76, 0x69, 0xF7, 0x3F, 0x5B, 0x91, 0x76, 0x66, 0x69, 0xF2,
+    0x52, 0x76, 0xB1, 0x2D, 0x36, 0x31, 0xF7, 0x19, 0x77, 0xF6, 0xF0, 0x6D, 0x7E, 0x5F, 0xBA, 0xC7,
+    0xC0, 0xF1, 0x70, 0xBF, 0x40, 0xBF, 0xD0, 0xE8, 0x82, 0xF0, 0x3B, 0xA4, 0x53, 0xD5, 0x07, 0x9E,
+    0x39, 0x54, 0x28, 0x69, 0x3C, 0xA9, 0x13, 0xDD, 0x17, 0x2F, 0x3C, 0x42, 0x4D, 0x55, 0x09, 0xCA,
+    0xAD, 0x14, 0xED, 0x67, 0x2F, 0x3C, 0xD4, 0x28, 0xD6, 0xC3, 0x25, 0x7D, 0x29, 0x64, 0x1C, 0x97,
+    0x8F, 0xB4, 0xE5, 0xA0, 0x3F, 0xDB, 0xEF, 0xD5, 0x72, 0xB7, 0x43, 0x28, 0x74, 0x1F, 0x17, 0x9E,
+    0x69, 0xD6, 0xDF, 0x97, 0xE5, 0xEE, 0xD5, 0x05, 0x7F, 0x35, 0x52, 0x02, 0x8C, 0x57, 0x0E, 0xE5,
+    0x4E, 0xCB, 0x49, 0xAB, 0x69, 0xF6, 0x17, 0xC6, 0xEE, 0xA4, 0xAB, 0x0B, 0x8C, 0x34, 0x0E, 0x2A,
+    0xCC, 0xCA, 0xA6, 0xBE, 0x30, 0x5E, 0xAC, 0x4A, 0x2B, 0xE7, 0xDA, 0x8E, 0x91, 0x8E, 0xED, 0xE7,
+    0x22, 0x36, 0x61, 0x32, 0x87, 0xB3, 0x8F, 0x29, 0x86, 0x00, 0xDD, 0x06, 0x3B, 0xF8, 0xE9, 0x3C,
+    0x8B, 0xB4, 0x63, 0x95, 0xD0, 0x46, 0xFB, 0x65, 0xB3, 0xE7, 0x0F, 0x71, 0xF9, 0x11, 0x32, 0xD5,
+    0x96, 0xF3, 0x96, 0xB0, 0x51, 0x22, 0x68, 0xEC, 0xCF, 0x95, 0xCD, 0x79, 0xC1, 0x89, 0xFE, 0x97,
+    0x6B, 0xBB, 0x1E, 0xD9, 0xF2, 0xAF, 0xB4, 0xF9, 0xED, 0x27, 0x19, 0xDE, 0x49, 0xDD, 0x2F, 0xD7,
+    0x53, 0x5A, 0x78, 0x4D, 0x56, 0xC9, 0x28, 0x7D, 0xC9, 0xA4, 0xA8, 0xFF, 0x44, 0xCA, 0x39, 0x98,
+    0xD4, 0x71, 0x3F, 0xEC, 0x0C, 0x5A, 0x0E, 0xF7, 0xDC, 0xB3, 0x09, 0xE6, 0x07, 0x0B, 0x3C, 0x50,
+    0xA4, 0x59, 0xFE, 0xEB, 0x79, 0x92, 0x7F, 0xA5, 0xDA, 0x06, 0x61, 0x3C, 0xC8, 0x01, 0x05, 0xB0,
+    0x27, 0x55, 0x21, 0x7C, 0x41, 0x23, 0xA5, 0x46, 0xAA, 0x68, 0x9A, 0xA3, 0x26, 0x9B, 0x43, 0x6C,
+    0xAB, 0x5B, 0x08, 0x97, 0x33, 0xC3, 0xDD, 0x8D, 0xEE, 0xB3, 0x4A, 0x5B, 0xE7, 0x11, 0xB9, 0x85,
+    0xF0, 0xF6, 0x8A, 0x7B, 0x57, 0x0C, 0xD9, 0x27, 0xB7, 0x76, 0xD2, 0xC6, 0xAC, 0x8D, 0x0B, 0x92,
+    0xF8, 0xB1, 0x82, 0x27, 0x04, 0x0E, 0x0F, 0xF3, 0xEF, 0xAB, 0x9A, 0x6A, 0xD8, 0x0E, 0x64, 0x1C,
+    0xDE, 0xCE, 0x0C, 0xD3, 0xCB, 0x5F, 0xD1, 0x54, 0xCD, 0x1B, 0x3F, 0x83, 0xEA, 0x8F, 0x23, 0xCD,
+    0xE6, 0xD9, 0xF1, 0xAB, 0x51, 0x8B, 0x1E, 0x86, 0x6E, 0x88, 0xD0, 0x6C, 0x80, 0x3B, 0xF5, 0x3B,
+    0xB1, 0x5B, 0x6D, 0x6E, 0x8B, 0xD9, 0x50, 0x53, 0xF1, 0x71, 0xC6, 0x26, 0x1F, 0xBB, 0xD5, 0xA6,
+    0xB6, 0x74, 0x1B, 0x6A, 0x2B, 0x7E, 0x9A, 0x19, 0x1E, 0x19, 0x6C, 0x76, 0xC2, 0xE4, 0x97, 0x10,
+    0xAD, 0x94, 0x90, 0x12, 0xBD, 0x96, 0x8B, 0xB1, 0x6B, 0xEB, 0x41, 0xE6, 0xA9, 0xC0, 0xCD, 0xAF,
+    0x74, 0x2A, 0x9F, 0xC1, 0xEF, 0xE0, 0x2F, 0x47, 0xDC, 0x09, 0x38, 0x7F, 0xFF, 0x53, 0xB5, 0xCB,
+    0x1B, 0x34, 0x65, 0x87, 0xEB, 0x7E, 0xE4, 0x89, 0xE6, 0x5C, 0xF6, 0x1D, 0x96, 0x43, 0x06, 0x37,
+    0x0F, 0x65, 0xF0, 0x49, 0x0C, 0x8B, 0x9F, 0xFA, 0x3C, 0x24, 0x53, 0xFA, 0x95, 0xBD, 0x2D, 0x84,
+    0x47, 0x06, 0xBB, 0xAD, 0xD9, 0xD1, 0xB3, 0xC2, 0x4B, 0x93, 0x91, 0x26, 0x9C, 0x1E, 0x1E, 0xD4,
+    0x60, 0x4E, 0x15, 0xE0, 0x3A, 0xB4, 0x47, 0x55, 0x7B, 0xAC, 0xDE, 0x1D, 0x8E, 0x33, 0x97, 0x0A,
+    0x7E, 0xE4, 0x54, 0xD6, 0x1F, 0xDB, 0x92, 0x22, 0x7E, 0xC7, 0xDE, 0xCD, 0x6D, 0xB6, 0xD3, 0x63,
+    0x5B, 0xFA, 0xF6, 0xD3, 0xF4, 0xBF, 0x5A, 0xB9, 0xED, 0x69, 0x8E, 0x7A, 0xD1, 0x7D, 0xF4, 0xE7,
+    0x46, 0x1F, 0x44, 0xA9, 0x0C, 0xAB, 0xCE, 0x4A, 0xB7, 0x85, 0x29, 0x7C, 0x6F, 0xED, 0xB2, 0x98,
+    0x6D, 0xB6, 0x49, 0xCD, 0x6E, 0xB3, 0x5F, 0x66, 0x15, 0xA3, 0x7B, 0x71, 0xF8, 0x6C, 0xFB, 0xFF,
+    0xD3, 0x13, 0x4C, 0xA2, 0x5B, 0xA1, 0x40, 0xC1, 0x6D, 0xB8, 0x23, 0xE3, 0x6C, 0x3E, 0x1A, 0xE5,
+    0xE9, 0x14, 0xDE, 0x76, 0x1F, 0x7B, 0xAD, 0xBD, 0xD4, 0x6D, 0xC3, 0xDD, 0xD2, 0x7D, 0x5C, 0xBB,
+    0x32, 0xAB, 0x7A, 0x6D, 0xF6, 0xFE, 0x15, 0x53, 0x60, 0xE6, 0xEB, 0xC3, 0xFD, 0x5B, 0x46, 0x1A,
+    0xDD, 0x85, 0x64, 0xF2, 0x0B, 0x6E, 0x61, 0x88, 0x1C, 0xE1, 0x78, 0x2C, 0x23, 0x46, 0x18, 0x2D,
+    0x66, 0x2D, 0x26, 0xD9, 0xE9, 0xB1, 0x8C, 0x7C, 0xEB, 0x9B, 0xF8, 0x1F, 0x47, 0x7B, 0x37, 0x73,
+    0xE5, 0x0A, 0x40, 0xFF, 0x05, 0x4E, 0x8B, 0x53, 0x19, 0x52, 0xB8, 0x9C, 0x87, 0xB7, 0xD7, 0xE1,
+    0x13, 0x69, 0x95, 0x92, 0xFF, 0xF5, 0x68, 0x33, 0x6D, 0x61, 0x0C, 0xFF, 0xB0, 0x5A, 0x55, 0xE6,
+    0x13, 0x9D, 0xE9, 0x8F, 0x23, 0xBF, 0x3F, 0x81, 0xE6, 0xCD, 0xF3, 0x5F, 0x64, 0x1C, 0xC7, 0x4B,
+    0xC3, 0xE2, 0xA2, 0x8F, 0x7E, 0xF2, 0x63, 0x18, 0x01, 0x42, 0x34, 0x05, 0x37, 0x1D, 0x15, 0xF9,
+    0xE9, 0xE9, 0x38, 0x90, 0x1E, 0x16, 0x66, 0x4C, 0xC1, 0x66, 0xFC, 0xD4, 0xD4, 0x87, 0x67, 0xD6,
+    0x66, 0x65, 0x58, 0x00, 0xFA, 0xCA, 0x5C, 0xFA, 0x0F, 0xB7, 0x97, 0xDB, 0xFC, 0x2F, 0xFE, 0x5A,
+    0xFF, 0xEA, 0x52, 0x6E, 0xDB, 0x77, 0xD2, 0x95, 0xA7, 0x80, 0xA7, 0x27, 0x53, 0xF0, 0x53, 0xB7,
+    0x32, 0x63, 0x33, 0xE2, 0xD4, 0x11, 0x9A, 0x82, 0x9F, 0xCC, 0x4A, 0x18, 0xA1, 0x4B, 0xFF, 0x81,
+    0xF0, 0x20, 0x99, 0xDF, 0x88, 0x3F, 0x68, 0x13, 0xC0, 0xA5, 0x57, 0x37, 0xBC, 0x2F, 0xEC, 0xDA,
+    0xBA, 0x7D, 0xC8, 0x2E, 0xFB, 0x28, 0x76, 0x53, 0xCC, 0x6A, 0xD3, 0xB0, 0x84, 0x71, 0x6E, 0x8B,
+    0x29, 0x36, 0xDB, 0xE4, 0x27, 0x3F, 0xD6, 0xA6, 0x74, 0xB9, 0x3F, 0x72, 0xCD, 0xA6, 0xA3, 0x4A,
+    0x8F, 0x9C, 0x0C, 0xED, 0x58, 0x65, 0x2B, 0xF5, 0xC5, 0x9F, 0x95, 0xEE, 0xB3, 0xCA, 0x3E, 0xE3,
+    0x43, 0x1C, 0x3E, 0xC8, 0xFD, 0xA7, 0xC5, 0x94, 0xB9, 0xAD, 0x83, 0xD4, 0x4A, 0xB8, 0x0B, 0xBF,
+    0x0C, 0xF8, 0x27, 0xBB, 0xE3, 0xB1, 0x8C, 0x5C, 0xDC, 0x1D, 0xE3, 0x63, 0x19, 0xF9, 0xD6, 0x37,
+    0xF1, 0x97, 0x2F, 0xEC, 0x8E, 0x6F, 0x6C, 0x78, 0x45, 0xAF, 0xE2, 0xB2, 0x6C, 0x1E, 0xDE, 0x5B,
+    0xCD, 0xFD, 0x42, 0x15, 0x21, 0x44, 0xF7, 0xF3, 0x6C, 0x3F, 0x29, 0xFD, 0x1A, 0x54, 0x7A, 0x15,
+    0xE6, 0xED, 0x22, 0x1A, 0xD9, 0x05, 0xAE, 0x1F, 0xD2, 0xE3, 0x63, 0xB6, 0xDC, 0xE7, 0x68, 0xC4,
+    0x7E, 0xA0, 0xD1, 0xF2, 0xAF, 0xB3, 0x74, 0x42, 0xA3, 0x87, 0x0C, 0xEC, 0xF1, 0x2C, 0x7D, 0xFB,
+    0x49, 0xBA, 0x4F, 0x57, 0x6E, 0xFB, 0xF1, 0x84, 0x46, 0x37, 0xF8, 0x9F, 0x36, 0xD9, 0x77, 0x6B,
+    0x53, 0x86, 0xF8, 0xA5, 0x64, 0xD3, 0xAD, 0x61, 0x9C, 0xBB, 0x6C, 0xF3, 0xDC, 0xEC, 0x7D, 0xF6,
+    0x69, 0x56, 0x35, 0xFA, 0x20, 0x0E, 0x6B, 0xB9, 0x48, 0x15, 0x8E, 0x5F, 0xD5, 0x48, 0x22, 0x48,
+    0x2A, 0x66, 0x6F, 0xF7, 0x17, 0x46, 0x9F, 0xFA, 0x4C, 0x23, 0x5C, 0xA4, 0x5F, 0x11, 0xF8, 0x68,
+    0xA4, 0x71, 0x67, 0x50, 0xE9, 0x56, 0x66, 0xE5, 0x61, 0x31, 0xF5, 0x05, 0xC2, 0x78, 0x48, 0x2A,
+    0x7E, 0xA2, 0xDB, 0x9A, 0x0A, 0x76, 0xEB, 0xF3, 0x61, 0xB4, 0xE0, 0x24, 0x65, 0x06, 0xE9, 0x21,
+    0x70, 0x5C, 0x7B, 0xDD, 0x7D, 0x84, 0xF6, 0xA0, 0x49, 0x92, 0xF2, 0xFC, 0x9A, 0x62, 0xF5, 0x71,
+    0x8E, 0xE1, 0xEA, 0x32, 0xA4, 0xF0, 0x4E, 0xEE, 0xA4, 0xBB, 0xA5, 0x95, 0x16, 0xA1, 0xBF, 0xC6,
+    0x47, 0x1F, 0xE9, 0xB3, 0x5F, 0x69, 0x24, 0xFD, 0xCD, 0xE2, 0x75, 0x4F, 0x6B, 0xAB, 0x77, 0x2F,
+    0x88, 0x9E, 0x5E, 0x35, 0xA8, 0xBC, 0x74, 0xE3, 0xCD, 0xF3, 0x5B, 0x49, 0x35, 0x48, 0x52, 0x79,
+    0xE9, 0xC6, 0x8D, 0x1B, 0x37, 0xDE, 0x6C, 0xB3, 0x8D, 0xB5, 0xCB, 0xFE, 0x95, 0xDA, 0x5C, 0xA1,
+    0xCB, 0x3E, 0xD6, 0x3E, 0xF9, 0x66, 0x6B, 0x46, 0xDA, 0xFC, 0x8C, 0xC9, 0xC5, 0xBE, 0x5B, 0x86,
+    0xB3, 0xD5, 0xFF, 0x30, 0x87, 0xCB, 0xE9, 0x0F, 0x9F, 0x18, 0xBB, 0xBC, 0xDB, 0x0F, 0x8B, 0xBD,
+    0xB3, 0xB9, 0xD7, 0xB2, 0xEF, 0xD3, 0x75, 0x1B, 0x9F, 0x7A, 0x82, 0xEF, 0xF0, 0xB3, 0xF6, 0x97,
+    0x7B, 0xBF, 0xFA, 0x9F, 0x6F, 0x7E, 0x91, 0x8B, 0xB3, 0xD9, 0x9E, 0xE2, 0x4A, 0xC3, 0x3F, 0x02,
+    0xB5, 0x57, 0xBD, 0xF3, 0x1E, 0x47, 0x52, 0x7E, 0x76, 0xA6, 0xEC, 0xA5, 0x34, 0xC1, 0x5C, 0xC0,
+    0x05, 0x48, 0xC1, 0xA6, 0x14, 0xC9, 0xFC, 0x09, 0xBD, 0x88, 0x40, 0xC1, 0x05, 0x52, 0xC0, 0xDD,
+    0x05, 0x0E, 0x7C, 0x21, 0x75, 0x04, 0xCE, 0x09, 0x3C, 0x2B, 0xAB, 0x28, 0x02, 0x07, 0x56, 0x51,
+    0x45, 0x5D, 0x40, 0x80, 0x03, 0x02, 0x5B, 0x17, 0x98, 0x3F, 0xE0, 0xD0, 0x8C, 0xAD, 0x80, 0xC0,
+    0x81, 0xF7, 0x6C, 0x8C, 0x03, 0x02, 0xAF, 0xBF, 0xB8, 0x3A, 0x14, 0x68, 0x6C, 0x8F, 0xEF, 0x46,
+    0x72, 0xCF, 0x3C, 0x04, 0xFB, 0xD3, 0x87, 0x81, 0xAB, 0xA2, 0xA0, 0x78, 0xB7, 0xDE, 0xA8, 0x7B,
+    0xFB, 0x6B, 0xBB, 0x9F, 0x7E, 0x1A, 0x13, 0x00, 0x59, 0xD6, 0x49, 0x3B, 0xEC, 0xA7, 0x05, 0x98,
+    0x00, 0x00, 0x8E, 0x84, 0x50, 0x41, 0x96, 0xF9, 0xE1, 0x0F, 0x11, 0x32, 0x40, 0xC0, 0x36, 0x60,
+    0x61, 0x47, 0x64, 0x31, 0x64, 0xF6, 0xDF, 0xFC, 0x29, 0x64, 0xC3, 0xD4, 0x01, 0x57, 0x70, 0x2A,
+    0xB1, 0x58, 0x32, 0x2F, 0x1C, 0x00, 0x96, 0x0A, 0xF8, 0x01, 0xCC, 0xDC, 0x60, 0xBF, 0x2D, 0x98,
+    0xBA, 0x02, 0x43, 0x80, 0xE8, 0x33, 0xE4, 0x56, 0xC1, 0x92, 0x3B, 0xFC, 0x21, 0xAB, 0x7B, 0xF8,
+    0xE2, 0x6E, 0xC9, 0x66, 0xC8, 0x01, 0x92, 0x39, 0xC1, 0x15, 0xD9, 0x8C, 0x86, 0x8C, 0xE8, 0x0F,
+    0x2C, 0x19, 0x89, 0xD5, 0x92, 0xBB, 0x27, 0x11, 0x7F, 0x78, 0xC3, 0x28, 0xE0, 0x0B, 0x20, 0x1B,
+    0xC0, 0x81, 0x99, 0x5C, 0x03, 0x09, 0xCE, 0xC3, 0xB6, 0xB9, 0x2D, 0xFB, 0x72, 0x44, 0xA4, 0xAB,
+    0xEA, 0xD4, 0x93, 0xBB, 0x70, 0x4C, 0xE4, 0x06, 0xA4, 0xB1, 0x82, 0x2C, 0x20, 0x75, 0x1A, 0x2F,
+    0xE8, 0xA4, 0xA6, 0x1B, 0x35, 0x6A, 0xD5, 0x36, 0x4B, 0x96, 0x99, 0x5C, 0x1D, 0xB9, 0xF9, 0xF2,
+    0xD2, 0xE1, 0x8B, 0x2F, 0xFE, 0xF0, 0x65, 0xD9, 0x7D, 0x09, 0x39, 0x1E, 0x42, 0x66, 0x21, 0x57,
+    0x61, 0x05, 0xD2, 0x99, 0xA4, 0x27, 0x11, 0xFF, 0xE6, 0xC6, 0xA4, 0x67, 0xFA, 0x92, 0x81, 0x01,
+    0xCC, 0x15, 0xCF, 0x96, 0xCB, 0xEF, 0x40, 0x5C, 0xF1, 0x6C, 0xC0, 0x1D, 0x00, 0xB0, 0x90, 0x1B,
+    0x3C, 0x79, 0xC0, 0x92, 0x15, 0xD3, 0xF8, 0xB1, 0x02, 0x09, 0x04, 0x24, 0xCB, 0x06, 0xBF, 0x2F,
+    0x07, 0xE6, 0x32, 0x57, 0x18, 0x35, 0x0A, 0x0C, 0x10, 0x88, 0xAB, 0x6C, 0x90, 0xBC, 0xEC, 0x58,
+    0x0E, 0x57, 0xE0, 0x8B, 0x55, 0xB8, 0x06, 0x42, 0x48, 0xAA, 0x27, 0xC9, 0x99, 0x24, 0x6F, 0x2A,
+    0xB0, 0xEC, 0x09, 0x70, 0x45, 0x32, 0x8C, 0xFA, 0x1D, 0x18, 0xFF, 0x39, 0xEE, 0x67, 0x42, 0x9A,
+    0xC8, 0x7D, 0x26, 0x11, 0xA8, 0xE0, 0x0F, 0x57, 0xDB, 0x80, 0x65, 0x07, 0x12, 0xCE, 0xB8, 0xCF,
+    0x5E, 0x98, 0xC8, 0x03, 0x08, 0x9B, 0xDF, 0x7D, 0x41, 0x84, 0xAC, 0x69, 0xC5, 0x98, 0x74, 0x6E,
+    0x30, 0xEA, 0x8A, 0x64, 0xD8, 0x2A, 0xB7, 0x14, 0x70, 0x65, 0x84, 0x1D, 0xF0, 0x1F, 0x7D, 0x33,
+    0x00, 0x08, 0x59, 0x00, 0x90, 0x3C, 0xBB, 0x4A, 0x01, 0xC4, 0x8F, 0xEF, 0x57, 0x60, 0xD6, 0x78,
+    0xBD, 0x00, 0xF2, 0xBE, 0x4A, 0x86, 0x1D, 0xBE, 0xC4, 0x15, 0xA1, 0xC8, 0x46, 0x4C, 0x44, 0xB7,
+    0x0A, 0x5F, 0xE7, 0xE2, 0x1A, 0xB8, 0x85, 0xEC, 0x0B, 0x00, 0xE0, 0x79, 0x36, 0x44, 0x2A, 0xC8,
+    0x36, 0x6D, 0xCB, 0x45, 0xCD, 0x09, 0xCC, 0x15, 0x3F, 0xE7, 0x66, 0xB9, 0x63, 0xE1, 0x8E, 0xEF,
+    0xA7, 0xFD, 0xA2, 0x33, 0x00, 0xAB, 0xBF, 0x0F, 0xD9, 0xD3, 0x5B, 0x34, 0x64, 0x99, 0x39, 0x00,
+    0x00, 0xB8, 0x0B, 0x39, 0xFC, 0xEE, 0x06, 0xFA, 0xC4, 0x7D, 0xC9, 0xA2, 0x46, 0x1D, 0xB3, 0x6C,
+    0xA3, 0xD9, 0x2A, 0x71, 0x8B, 0xEE, 0xEB, 0x3A, 0x17, 0x8D, 0x48, 0xF2, 0x6A, 0xF1, 0xBF, 0x2A,
+    0x03, 0xBD, 0xFB, 0x7D, 0xE1, 0xD6, 0x0D, 0xCB, 0x92, 0xA5, 0x1B, 0xB5, 0xDC, 0x64, 0x93, 0x62,
+    0xEB, 0xDC, 0x11, 0x81, 0xE9, 0xC6, 0x73, 0x80, 0x98, 0x0A, 0xF3, 0x30, 0x01, 0x9E, 0x19, 0xB8,
+    0x7C, 0xFB, 0xFF, 0xC9, 0x57, 0x42, 0xC8, 0xBE, 0xB8, 0x86, 0x31, 0x0D, 0x2C, 0xBB, 0x64, 0xA3,
+    0xBE, 0x40, 0xDE, 0xE9, 0xB0, 0x2D, 0x6E, 0x10, 0x16, 0xCC, 0x54, 0x20, 0x31, 0xC3, 0xFF, 0xA6,
+    0x03, 0xC3, 0x17, 0x2C, 0x3B, 0x31, 0xF5, 0xB9, 0x21, 0x64, 0xC9, 0x56, 0xAD, 0x42, 0xB6, 0xE5,
+    0x98, 0x2B, 0x08, 0x18, 0xB2, 0x9D, 0x9D, 0x28, 0xE4, 0x3A, 0xF5, 0x1F, 0x2B, 0x5C, 0xF1, 0x05,
+    0xB2, 0xC9, 0x36, 0xF5, 0xA9, 0xC3, 0x15, 0x57, 0x20, 0x59, 0x32, 0x06, 0x88, 0xB9, 0xDA, 0x86,
+    0x90, 0x97, 0x1D, 0x03, 0x09, 0x73, 0xB5, 0x8A, 0x98, 0x7D, 0x91, 0x01, 0xD9, 0x58, 0xA6, 0x6E,
+    0x07, 0xDC, 0xF9, 0xB9, 0x80, 0xB4, 0x23, 0x16, 0xCB, 0xD5, 0x32, 0xFB, 0x8E, 0x65, 0x20, 0x56,
+    0xB0, 0x1A, 0x1E, 0x33, 0xB3, 0x7F, 0xB0, 0x49, 0x82, 0xBC, 0x3C, 0x3D, 0x6A, 0xD0, 0xE6, 0xDF,
+    0x3B, 0xE6, 0xAF, 0xCB, 0xCB, 0xB2, 0x86, 0xD7, 0xEE, 0x7D, 0xA9, 0x18, 0xB2, 0xBC, 0x5A, 0x6C,
+    0x55, 0x95, 0x6D, 0xB9, 0xF7, 0xDB, 0xA3, 0x23, 0x7A, 0xDA, 0x62, 0x5A, 0x68, 0x4B, 0xF6, 0x7B,
+    0xCA, 0x09, 0x62, 0x86, 0x6D, 0x93, 0xBA, 0xE2, 0x77, 0x20, 0x61, 0xD9, 0x7D, 0x31, 0x8A, 0x81,
+    0x90, 0x97, 0xDD, 0xAA, 0x51, 0xC8, 0x26, 0x79, 0xAE, 0xB6, 0x21, 0x21, 0x9E, 0xD3, 0x4D, 0x24,
+    0xF2, 0xF0, 0xDF, 0xFC, 0xA8, 0x3F, 0xD5, 0xEB, 0x90, 0x2D, 0xE4, 0xB9, 0x5A, 0x45, 0x5A, 0x65,
+    0x73, 0xE5, 0xAC, 0x09, 0x00, 0x18, 0x1E, 0x98, 0xC9, 0x75, 0x26, 0xCB, 0x3C, 0xEC, 0xB0, 0x1D,
+    0xF2, 0xF6, 0x80, 0xAB, 0x09, 0x53, 0x97, 0x8C, 0xF8, 0xE2, 0x81, 0xF0, 0x51, 0x85, 0xFB, 0xAA,
+    0xC3, 0x6A, 0x5A, 0xA7, 0xB1, 0xEC, 0x48, 0xD7, 0x14, 0x31, 0x73, 0x4B, 0xFB, 0x42, 0x1E, 0x86,
+    0x3C, 0xB0, 0x70, 0xBB, 0xA8, 0xC6, 0x39, 0x7C, 0x0A, 0x92, 0x79, 0xF9, 0xE2, 0x85, 0x66, 0x14,
+    0x71, 0x95, 0xEC, 0x8A, 0x6D, 0x20, 0xE2, 0xE6, 0x8F, 0xB9, 0x4E, 0x03, 0x09, 0xE1, 0x71, 0x36,
+    0x92, 0x97, 0xDD, 0x9E, 0x7A, 0x21, 0xBB, 0x62, 0x15, 0x84, 0x6C, 0xBE, 0xCC, 0x15, 0x03, 0x48,
+    0x0F, 0x01, 0x72, 0x07, 0x59, 0xA7, 0xF1, 0x62, 0x33, 0x6A, 0xCF, 0xA7, 0x59, 0xB5, 0xCD, 0xB5,
+    0xF9, 0x51, 0x2A, 0xEE, 0x04, 0xCD, 0xD5, 0x3F, 0xBA, 0x8D, 0x65, 0x07, 0x96, 0x7C, 0xC2, 0x93,
+    0xE4, 0x73, 0x46, 0xE2, 0x7A, 0xF1, 0xA9, 0x66, 0x1E, 0x88, 0xD4, 0x89, 0x6C, 0x76, 0xE0, 0x1F,
+    0x7C, 0x03, 0x96, 0xF2, 0x54, 0x37, 0x5E, 0xE8, 0xA6, 0x8B, 0x7F, 0x5C, 0x81, 0x98, 0x01, 0x39,
+    0x9E, 0xC7, 0x42, 0xC2, 0x91, 0x98, 0x78, 0x42, 0x5B, 0x24, 0xDF, 0x25, 0x95, 0xE4, 0x5F, 0xBE,
+    0xF8, 0xCD, 0x0D, 0x10, 0xF0, 0x07, 0xA6, 0x0E, 0x84, 0x0C, 0xAB, 0x80, 0x64, 0xD8, 0x06, 0xC4,
+    0x15, 0xAE, 0xE0, 0xB1, 0x78, 0x00, 0x61, 0x87, 0x39, 0xC1, 0x54, 0x72, 0x5C, 0x5D, 0xB5, 0x15,
+    0x84, 0x6C, 0x61, 0x37, 0x6A, 0x1B, 0x96, 0x9C, 0x80, 0xBE, 0x1C, 0xF0, 0x9F, 0x29, 0x90, 0xE2,
+    0x8A, 0x99, 0x05, 0x10, 0x05, 0x0C, 0xB7, 0x33, 0x5A, 0xDB, 0x01, 0xA4, 0x0C, 0xC7, 0x02, 0xA4,
+    0x0E, 0xB8, 0x8B, 0x6F, 0xF9, 0xE4, 0x37, 0x29, 0x00, 0x24, 0x00, 0x57, 0xF8, 0x10, 0x48, 0x64,
+    0x99, 0x48, 0x12, 0xFC, 0x6B, 0x8D, 0x25, 0xAD, 0x77, 0xAD, 0x4A, 0x96, 0x35, 0xBE, 0xB8, 0xFB,
+    0x7D, 0xF9, 0xA8, 0xCE, 0xC5, 0x7D, 0xD9, 0x8D, 0x5A, 0x95, 0x3C, 0xCC, 0xF0, 0x5D, 0xAE, 0x11,
+    0x24, 0x09, 0x4F, 0x0E, 0xE0, 0x25, 0x7E, 0x0E, 0x60, 0x00, 0x80, 0xAC, 0x00, 0x9E, 0x5B, 0x01,
+    0xC8, 0x36, 0x37, 0x48, 0xF6, 0x05, 0x61, 0x97, 0x1D, 0xFE, 0x48, 0x1B, 0x7C, 0x21, 0xE0, 0x7E,
+    0xAB, 0x80, 0x65, 0x05, 0x2C, 0x0F, 0xC0, 0x30, 0x03, 0x96, 0xDB, 0x05, 0x60, 0x84, 0x07, 0x3B,
+    0x10, 0x5F, 0x2B, 0x00, 0x7D, 0x81, 0xED, 0x73, 0x83, 0x6B, 0x56, 0xB1, 0x14, 0xAB, 0x90, 0x6C,
+    0xC6, 0xE3, 0xD1, 0xB7, 0x8A, 0x01, 0xD9, 0x96, 0x7D, 0xAE, 0xFF, 0x6D, 0x03, 0xF5, 0xEF, 0xE8,
+    0x3D, 0x6D, 0x20, 0xC9, 0xAE, 0x5A, 0x92, 0x55, 0x2E, 0xF6, 0x44, 0x01, 0x40, 0x00, 0xFE, 0x00,
+    0xA6, 0x0E, 0x20, 0x64, 0xBF, 0xDB, 0x16, 0x57, 0xFF, 0xA9, 0x22, 0x5E, 0x2F, 0x46, 0x65, 0xF3,
+    0x5F, 0x76, 0xC8, 0x5F, 0xD5, 0xA9, 0x87, 0xDD, 0xD5, 0xF8, 0x45, 0xCA, 0x24, 0x27, 0xB2, 0xE1,
+    0xAD, 0xB7, 0x9E, 0xD9, 0x10, 0x17, 0x6B, 0xE4, 0x82, 0x08, 0x24, 0xC8, 0x2A, 0x9B, 0xE4, 0x25,
+    0xFB, 0xC3, 0x1F, 0xAE, 0xCC, 0x75, 0xAE, 0x56, 0x8D, 0x4E, 0x8A, 0x01, 0x22, 0x21, 0xAE, 0x92,
+    0x25, 0x87, 0xEC, 0x0F, 0x7F, 0xF8, 0x27, 0x62, 0x73, 0x8A, 0x89, 0xB8, 0xCA, 0x26, 0xDB, 0x77,
+    0xC4, 0xCD, 0xA8, 0xE9, 0xD3, 0xC0, 0x59, 0x7D, 0x6E, 0x42, 0x9E, 0x8D, 0x4D, 0x16, 0x20, 0x21,
+    0x42, 0x56, 0xC9, 0x21, 0x2F, 0xBB, 0x3F, 0x7C, 0x71, 0x65, 0xAE, 0xB6, 0x59, 0x35, 0x3A, 0xF5,
+    0x0B, 0x97, 0xA7, 0xC5, 0xDF, 0x29, 0x8E, 0xAB, 0x6C, 0x8F, 0xDF, 0x77, 0x65, 0x2E, 0xA7, 0xF8,
+    0x74, 0x49, 0x92, 0x2A, 0x24, 0x39, 0x16, 0x92, 0xE4, 0x0A, 0x9C, 0x83, 0x81, 0x0B, 0xA4, 0xB3,
+    0x0A, 0x00, 0x78, 0x13, 0x91, 0x9B, 0x61, 0x87, 0x67, 0xC1, 0xF7, 0xE3, 0x33, 0x9C, 0xE9, 0x0B,
+    0x20, 0x71, 0xB7, 0xE4, 0xEE, 0x1F, 0x31, 0xCB, 0xC6, 0x3F, 0xEE, 0xA6, 0xBB, 0xE2, 0xAA, 0x64,
+    0xC9, 0x63, 0x1E, 0x33, 0x59, 0x16, 0x12, 0x89, 0xB7, 0x81, 0x04, 0xB8, 0x72, 0xCE, 0x89, 0x3F,
+    0x00, 0x22, 0xAE, 0x98, 0x9B, 0x51, 0x60, 0xD9, 0xFD, 0x59, 0xDE, 0x7F, 0x86, 0x55, 0x90, 0xAB,
+    0x3F, 0x66, 0x72, 0x8B, 0x6B, 0xB8, 0x4F, 0xD3, 0x41, 0x33, 0x7C, 0xB1, 0x6D, 0x6E, 0x92, 0x97,
+    0x7D, 0xD9, 0x07, 0xE2, 0xCA, 0x6B, 0xD5, 0xA8, 0xD3, 0x90, 0x3D, 0xB9, 0x13, 0xC2, 0x6E, 0x75,
+    0x22, 0x57, 0x7F, 0x00, 0xE9, 0x0C, 0xDC, 0x1F, 0xDF, 0x65, 0x28, 0x1F, 0x02, 0xE4, 0x36, 0x93,
+    0x5B, 0xB8, 0xCF, 0x95, 0x66, 0xD8, 0x66, 0x75, 0xD9, 0xFD, 0x11, 0xD7, 0x67, 0x28, 0x55, 0x3F,
+    0x29, 0x15, 0x80, 0x29, 0x75, 0x58, 0x72, 0x33, 0xE4, 0x31, 0xDD, 0x0E, 0x05, 0x70, 0xF5, 0x4C,
+    0xDB, 0x36, 0xFC, 0xF4, 0xE7, 0x0D, 0x64, 0x03, 0x59, 0x71, 0xE7, 0xAD, 0x72, 0xBA, 0x58, 0x0E,
+    0x40, 0xF2, 0x4F, 0x26, 0x6E, 0x91, 0x44, 0x64, 0x43, 0xE0, 0xFE, 0xEC, 0x90, 0x86, 0x6C, 0x78,
+    0xC0, 0x97, 0x99, 0x84, 0x6D, 0x33, 0xCF, 0xB5, 0x32, 0x0F, 0x24, 0xD3, 0x21, 0x59, 0x32, 0xE1,
+    0x8B, 0x3F, 0xD2, 0x6A, 0xD4, 0x92, 0x19, 0x69, 0x22, 0x0B, 0x24, 0x27, 0x36, 0xF8, 0x22, 0xFF,
+    0x32, 0x60, 0x9B, 0x3F, 0xE2, 0x66, 0xFA, 0x5C, 0x97, 0x03, 0x9C, 0xD4, 0x2A, 0xD2, 0x96, 0x90,
+    0xB6, 0x94, 0x25, 0x7B, 0x72, 0xF7, 0xC7, 0x44, 0xEE, 0x73, 0x85, 0x7B, 0x8C, 0xCE, 0x00, 0x5E,
+    0xE2, 0x01, 0xE1, 0x80, 0x27, 0xF7, 0x89, 0x57, 0x15, 0x72, 0x6E, 0xCB, 0x06, 0xC9, 0x71, 0xB5,
+    0x3A, 0x57, 0x2C, 0x8F, 0x08, 0x24, 0x16, 0xCC, 0x1C, 0x00, 0x5F, 0xDA, 0x21, 0xEF, 0x2B, 0x5C,
+    0x93, 0x6C, 0x68, 0x15, 0x31, 0xCB, 0xE6, 0xEB, 0x5C, 0xED, 0x40, 0x02, 0xC2, 0xCD, 0xD7, 0x67,
+    0x7E, 0x9C, 0x85, 0xC3, 0x8E, 0xA5, 0x2D, 0x47, 0xD8, 0x13, 0x92, 0x55, 0xA3, 0xFE, 0x70, 0x87,
+    0x6C, 0xB2, 0x8E, 0xA9, 0x5B, 0xF5, 0xC5, 0x93, 0x79, 0xE1, 0x5D, 0x84, 0x6F, 0xEA, 0xD3, 0x22,
+    0x3C, 0xFF, 0x0B, 0x5C, 0x61, 0x76, 0x54, 0xC3, 0x5F, 0xAF, 0x71, 0x87, 0x2F, 0x30, 0xFA, 0x47,
+    0x90, 0xB7, 0xD4, 0x92, 0x25, 0x1E, 0x74, 0xCD, 0x15, 0xAE, 0xD1, 0x17, 0x57, 0x08, 0xFA, 0xE2,
+    0x8F, 0x64, 0x74, 0x1E, 0xDC, 0x02, 0x0B, 0xD2, 0x85, 0xA5, 0x2B, 0x0D, 0x9E, 0xD5, 0x92, 0x99,
+    0x57, 0x75, 0x39, 0xC2, 0x3B, 0xFD, 0x85, 0x26, 0x1C, 0x96, 0xCC, 0x72, 0x93, 0xB6, 0xCD, 0x55,
+    0x72, 0xBC, 0x3A, 0x5E, 0x2C, 0x9E, 0x1D, 0xE1, 0x6C, 0x6D, 0xBC, 0xF4, 0x39, 0xC8, 0x35, 0xB0,
+    0x4C, 0xA6, 0x03, 0x09, 0x13, 0xF3, 0x15, 0xEE, 0x81, 0xDB, 0xD2, 0xE1, 0x2A, 0xAC, 0x62, 0x4D,
+    0x7F, 0x7B, 0x78, 0xB6, 0x89, 0xED, 0x71, 0xB8, 0x9E, 0x1B, 0x48, 0x78, 0xB6, 0x27, 0x54, 0xD8,
+    0x97, 0xE7, 0x3F, 0xA7, 0xE1, 0xFD, 0x92, 0xC8, 0xA5, 0xCA, 0x57, 0x7D, 0x1A, 0x92, 0x97, 0xCF,
+    0x9A, 0xE9, 0xB2, 0xC9, 0xBD, 0x36, 0x37, 0xC9, 0x34, 0x4C, 0x87, 0x67, 0x43, 0xE8, 0x4F, 0xE2,
+    0x15, 0x66, 0x61, 0x0B, 0x3B, 0xFD, 0x21, 0xAF, 0xD6, 0xF0, 0x01, 0x79, 0x90, 0xBB, 0xFC, 0x7A,
+    0xF5, 0xC7, 0xE9, 0xFA, 0xDF, 0x8B, 0xA7, 0x22, 0x35, 0xE0, 0xEC, 0x31, 0x84, 0x2C, 0xD5, 0x95,
+    0xA0, 0x96, 0x79, 0x38, 0x6E, 0xA6, 0xFB, 0x9D, 0x80, 0xFF, 0x65, 0x0F, 0x19, 0x18, 0xE1, 0x5E,
+    0x03, 0x3C, 0x49, 0x60, 0x3A, 0xF1, 0x22, 0xDC, 0x1F, 0x04, 0xAC, 0x46, 0x57, 0x80, 0xF4, 0x83,
+    0x92, 0xD6, 0x29, 0x1D, 0xB4, 0x63, 0x13, 0xF5, 0x47, 0xD0, 0x79, 0xA0, 0x23, 0xE5, 0x8B, 0xC4,
+    0x4C, 0xBA, 0xED, 0xA9, 0x8E, 0x63, 0x02, 0x81, 0x81, 0x1F, 0xA9, 0xE1, 0x61, 0x79, 0x4C, 0x2F,
+    0x34, 0x58, 0x85, 0xD5, 0xBB, 0xA9, 0x25, 0x96, 0xC8, 0x0D, 0xC0, 0xA5, 0xDB, 0x97, 0x6E, 0x8F,
+    0xA9, 0x2F, 0x7B, 0x78, 0x47, 0xAD, 0x4A, 0x96, 0x5B, 0xCD, 0x56, 0x59, 0xE3, 0xB5, 0xEA, 0x4A,
+    0x02, 0x7D, 0x09, 0x07, 0xE7, 0xEE, 0xC8, 0x1C, 0x55, 0x0D, 0xAF, 0x9F, 0x4E, 0x6E, 0x4C, 0xAB,
+    0xDF, 0x14, 0x3D, 0x6C, 0x8E, 0x05, 0x57, 0x3E, 0xC7, 0xFF, 0xD6, 0x92, 0x79, 0xC3, 0xBC, 0x61,
+    0x9B, 0x2F, 0xB6, 0xCA, 0x3E, 0x97, 0xB4, 0xB9, 0x2F, 0x07, 0xFC, 0xB7, 0x0A, 0xCF, 0x82, 0x85,
+    0x07, 0xC2, 0xC7, 0x05, 0xE1, 0x9F, 0x1A, 0xE4, 0x96, 0x42, 0x5E, 0xE9, 0x88, 0x2B, 0x91, 0x90,
+    0x56, 0x5C, 0xBE, 0x73, 0x07, 0x81, 0x03, 0xC2, 0x0E, 0xB9, 0xAA, 0x88, 0x46, 0x31, 0xAC, 0xA2,
+    0xDB, 0x36, 0xE9, 0x5C, 0x8D, 0xBA, 0x62, 0x9B, 0x2B, 0x73, 0xF5, 0x47, 0x2A, 0xFE, 0x48, 0xFB,
+    0xB2, 0xA7, 0xF5, 0x84, 0x40, 0x73, 0x07, 0x97, 0xDF, 0xF0, 0x1D, 0x2C, 0xB1, 0xCE, 0xBC, 0xC9,
+    0x5D, 0xBA, 0xE3, 0x4D, 0x16, 0xB9, 0xEB, 0x1F, 0xE4, 0xDE, 0x5E, 0xBE, 0x3B, 0x7F, 0xFD, 0xD9,
+    0xD7, 0x35, 0xBC, 0xF7, 0x77, 0xAF, 0xED, 0x77, 0x45, 0xA3, 0xAD, 0xFC, 0x54, 0xFD, 0x3D, 0xFA,
+    0x23, 0xFA, 0x26, 0x57, 0x55, 0xB2, 0xC2, 0xBC, 0x61, 0x5E, 0xF7, 0x47, 0xC8, 0x71, 0xA5, 0x51,
+    0xAB, 0xAE, 0xF8, 0x43, 0x3E, 0x4C, 0x2B, 0xA9, 0x33, 0x59, 0xC2, 0x87, 0x71, 0xE3, 0xD4, 0xAD,
+    0xCE, 0xF5, 0xA9, 0x52, 0x03, 0xAE, 0x54, 0x78, 0x16, 0x4B, 0x6E, 0xBC, 0xA5, 0xCB, 0x11, 0xDE,
+    0xEF, 0x53, 0x97, 0xBC, 0x7C, 0xA0, 0x46, 0x7F, 0x67, 0x7F, 0x99, 0xD7, 0xEF, 0x42, 0x44, 0x67,
+    0x72, 0x8F, 0x9F, 0x0C, 0xD7, 0xFC, 0x41, 0x0C, 0x7F, 0x2C, 0xBF, 0xEC, 0x46, 0x43, 0x0E, 0xEF,
+    0xA8, 0x6D, 0xB2, 0xC9, 0xAD, 0x36, 0xD7, 0xB8, 0x26, 0x57, 0x7C, 0xC1, 0x9F, 0x85, 0x0D, 0xCA,
+    0x02, 0xB2, 0x4D, 0xBC, 0xA6, 0xA6, 0x5B, 0xB5, 0x6A, 0x4E, 0x8E, 0x55, 0xAD, 0xCE, 0xD5, 0x36,
+    0x57, 0x5D, 0xF5, 0x6D, 0x29, 0x9E, 0xDC, 0xFD, 0x03, 0xAE, 0xCB, 0xBB, 0xFD, 0xBF, 0x70, 0xAC,
+    0x74, 0xC1, 0x3A, 0xB0, 0xB4, 0x89, 0xB4, 0xEC, 0xBE, 0xFD, 0xDE, 0x72, 0x20, 0x64, 0x48, 0x86,
+    0x6C, 0x90, 0x15, 0xB2, 0x41, 0xF2, 0xF7, 0xC2, 0xB7, 0xC5, 0xB3, 0x58, 0xEE, 0x67, 0xB4, 0xD3,
+    0x3F, 0x42, 0x44, 0x63, 0x9B, 0xC9, 0x07, 0xCC, 0xF1, 0x53, 0x7E, 0xA0, 0xAE, 0xF9, 0x12, 0x32,
+    0xA7, 0x61, 0xD4, 0x1F, 0xCB, 0x2E, 0x6F, 0x77, 0xA3, 0xB6, 0x85, 0x2C, 0x59, 0xAE, 0xAA, 0x6D,
+    0x73, 0x91, 0x2D, 0xAE, 0xC9, 0x36, 0x57, 0x7C, 0x89, 0x6B, 0xC2, 0x70, 0xC5, 0x97, 0x65, 0x9F,
+    0xDE, 0xC0, 0x4F, 0x11, 0x57, 0xC9, 0xCB, 0x1E, 0x76, 0x5B, 0x7D, 0xC1, 0x98, 0x2B, 0xE4, 0x96,
+    0xC2, 0x7D, 0xD9, 0x61, 0x74, 0x00, 0x31, 0x02, 0xFE, 0xC1, 0x06, 0xCB, 0x0C, 0xF0, 0x00, 0xA4,
+    0x00, 0xAE, 0x9D, 0x7B, 0x62, 0xEA, 0x80, 0x21, 0x10, 0xB8, 0xC2, 0x71, 0xC5, 0x74, 0x1E, 0x53,
+    0xFE, 0xC0, 0x79, 0xD2, 0x2E, 0xF9, 0x24, 0x03, 0x90, 0x0D, 0xF8, 0xF3, 0x01, 0x44, 0x0E, 0x04,
+    0xB2, 0xB9, 0x96, 0x62, 0x1E, 0xFE, 0x93, 0x11, 0x72, 0xF7, 0x9F, 0xE9, 0x92, 0x87, 0xBC, 0xA2,
+    0xFE, 0xB3, 0x16, 0x6E, 0x76, 0xB9, 0xD7, 0xE4, 0x5E, 0x97, 0xEB, 0x75, 0x21, 0x07, 0x12, 0xB9,
+    0x9D, 0x6B, 0x65, 0xE0, 0xBC, 0x9C, 0x27, 0xBD, 0xD8, 0xB4, 0xB6, 0x5D, 0x18, 0xC6, 0x9B, 0xB8,
+    0x03, 0xC9, 0x5C, 0x5D, 0x4D, 0x1B, 0x86, 0x6C, 0x08, 0xCC, 0x98, 0x99, 0x01, 0xEE, 0x67, 0xC0,
+    0xD2, 0x81, 0xC0, 0x0D, 0xE1, 0x5F, 0x0B, 0x96, 0x4F, 0x06, 0x7C, 0x91, 0xEC, 0x8B, 0xAB, 0xFF,
+    0xB3, 0x91, 0x1A, 0x8E, 0xD4, 0xD8, 0xF9, 0x0E, 0xAF, 0x29, 0x20, 0x1B, 0x6C, 0xC5, 0x79, 0xE2,
+    0x5D, 0xDA, 0x2E, 0xBF, 0xA2, 0xE6, 0xE2, 0xBD, 0x26, 0x5B, 0xFA, 0x93, 0xEA, 0x8B, 0xDC, 0xA3,
+    0x25, 0x8F, 0x30, 0x3A, 0x5E, 0x5E, 0x32, 0xCC, 0xB3, 0xF4, 0xF6, 0xD2, 0xED, 0x4B, 0xDB, 0xE5,
+    0x6D, 0x18, 0xB5, 0xBA, 0xEC, 0x21, 0xCB, 0x2B, 0x7A, 0xE2, 0xAD, 0x6C, 0xD1, 0xB6, 0xB9, 0xBA,
+    0x22, 0x6B, 0x02, 0xE7, 0xEA, 0x8B, 0x3F, 0x12, 0x86, 0xE9, 0xAE, 0x84, 0x43, 0x32, 0xE7, 0xE1,
+    0xD4, 0x91, 0xE4, 0x16, 0x35, 0x3D, 0xAC, 0x86, 0x76, 0x84, 0x0B, 0x9A, 0xFE, 0x7F, 0x36, 0xD9,
+    0xA2, 0xA6, 0x87, 0x7C, 0x85, 0x76, 0xB8, 0x0A, 0x00, 0xF1, 0x29, 0x8B, 0x19, 0x00, 0xF0, 0xDC,
+    0x7A, 0xF9, 0xCE, 0x8A, 0xD4, 0x61, 0xF9, 0xF4, 0xBE, 0xB6, 0xEC, 0x58, 0x38, 0x90, 0xEE, 0x77,
+    0xAB, 0x73, 0xF3, 0xC5, 0x1F, 0x92, 0xE3, 0x9A, 0x7E, 0xA6, 0x20, 0xF7, 0xC7, 0x4B, 0xC0, 0xFC,
+    0x3D, 0xF0, 0xA6, 0x6D, 0x40, 0x9F, 0x2B, 0x26, 0x75, 0x05, 0x46, 0x7D, 0x81, 0x55, 0xCF, 0x6A,
+    0x9B, 0xE7, 0x98, 0xEB, 0xF2, 0x88, 0x73, 0x09, 0x39, 0xFE, 0xA0, 0x48, 0x8E, 0xD7, 0x8B, 0xE4,
+    0xE4, 0x8F, 0xF0, 0x6F, 0x5C, 0x76, 0x4F, 0x0D, 0xD9, 0xF2, 0x90, 0xFC, 0xC4, 0xD4, 0x00, 0xE2,
+    0x8A, 0x90, 0xE1, 0x0B, 0x2C, 0x3B, 0xC8, 0x12, 0xEF, 0x8F, 0x90, 0xE5, 0xBD, 0xE2, 0x3F, 0x53,
+    0xDB, 0xD2, 0xCF, 0xD4, 0xB3, 0xE3, 0x74, 0xFE, 0xFC, 0x80, 0xE7, 0xEE, 0x58, 0x30, 0x5F, 0xA0,
+    0xB2, 0xA5, 0xCE, 0xD4, 0xE9, 0x85, 0x86, 0xB9, 0x62, 0x29, 0x7F, 0xC1, 0x3D, 0x72, 0x8B, 0xFD,
+    0x44, 0xC9, 0x29, 0xAD, 0xB6, 0x79, 0x16, 0x5B, 0x85, 0x6D, 0x2E, 0xF1, 0x96, 0xBA, 0xC2, 0xA9,
+    0xFB, 0xDF, 0x8C, 0xA9, 0x7B, 0xF6, 0xA9, 0x2F, 0x54, 0xA3, 0xE1, 0x57, 0x6A, 0xF5, 0xC4, 0x84,
+    0xB7, 0xBB, 0x2B, 0xB2, 0x31, 0x1D, 0x71, 0x4D, 0xCC, 0x09, 0xCB, 0x78, 0x7C, 0x4F, 0xDC, 0x79,
+    0x13, 0x81, 0x1D, 0x89, 0x0A, 0x5A, 0x9D, 0xBA, 0x6D, 0x53, 0x9F, 0x2B, 0xF8, 0x56, 0x41, 0x64,
+    0x81, 0xB0, 0x20, 0x5D, 0x3F, 0xA6, 0xB1, 0xEC, 0x56, 0x43, 0xF6, 0x45, 0xB2, 0xEC, 0xB2, 0xE1,
+    0x0F, 0x2E, 0xC1, 0xBF, 0x7B, 0xCC, 0x5F, 0x55, 0xFC, 0xE4, 0x0F, 0x9F, 0x24, 0x50, 0x3C, 0x87,
+    0xAB, 0x72, 0xAF, 0xF9, 0x4F, 0xBB, 0xAB, 0x64, 0x13, 0x56, 0xFF, 0xE8, 0x86, 0x6D, 0x00, 0xF1,
+    0xBD, 0xF0, 0xE8, 0x17, 0x96, 0x44, 0x18, 0x00, 0xF0, 0x1F, 0xBD, 0xBC, 0x5D, 0xCC, 0x1D, 0xC7,
+    0x99, 0x26, 0xF6, 0x74, 0x17, 0xC9, 0xB6, 0xD5, 0x19, 0x95, 0x90, 0x50, 0xC8, 0x8E, 0x3C, 0x52,
+    0xF9, 0x62, 0x16, 0xF0, 0x68, 0x24, 0xD5, 0x8D, 0x2F, 0x1C, 0x84, 0x64, 0x35, 0x45, 0x60, 0x05,
+    0xC4, 0x17, 0x64, 0xB0, 0xE2, 0x2C, 0x30, 0x8B, 0x5D, 0x4E, 0x10, 0x5D, 0x78, 0x9C, 0x9D, 0xD0,
+    0x08, 0x14, 0xAC, 0xB0, 0x90, 0x58, 0x4D, 0x2B, 0xBB, 0x0E, 0xE0, 0x0B, 0x13, 0xC8, 0x4C, 0x36,
+    0xC8, 0x04, 0x31, 0x81, 0xD5, 0x04, 0xF4, 0x37, 0x13, 0x48, 0xD8, 0x28, 0x88, 0x31, 0x21, 0x59,
+    0x45, 0x7D, 0xC9, 0x12, 0x58, 0x01, 0x51, 0x53, 0x8C, 0xA3, 0x0B, 0x01, 0x61, 0xEB, 0xC7, 0xA3,
+    0x8C, 0x95, 0x05, 0x8B, 0x52, 0x51, 0x6A, 0x8A, 0x55, 0xF5, 0xE4, 0xA2, 0xFA, 0x7C, 0xFC, 0x28,
+    0x6B, 0xEC, 0x59, 0xAD, 0x9C, 0x23, 0x1D, 0x9E, 0xAF, 0xBB, 0xCF, 0xE9, 0x7E, 0xBB, 0xEA, 0xAD,
+    0xF7, 0xE7, 0x79, 0x9F, 0xB7, 0xF1, 0xAD, 0xA6, 0xB4, 0xA5, 0xC9, 0x38, 0x06, 0x34, 0xC7, 0x44,
+    0xE8, 0x42, 0x3F, 0xCB, 0x59, 0x4E, 0xCA, 0x6B, 0x6F, 0xBC, 0x19, 0xED, 0xE8, 0x86, 0x6F, 0x03,
+    0x00, 0x7A, 0x0F, 0x39, 0xC2, 0x2D, 0x1D, 0x93, 0x2C, 0x51, 0xCF, 0x30, 0x23, 0xDC, 0x00, 0x02,
+    0x04, 0x0A, 0x40, 0x80, 0xA7, 0xBD, 0xA5, 0xD7, 0xF4, 0x5D, 0x81, 0x98, 0x20, 0x3C, 0x9A, 0x01,
+    0xF5, 0xA5, 0xCA, 0x00, 0xCD, 0x00, 0xC5, 0x08, 0x19, 0xBF, 0x04, 0xB1, 0x00, 0x4D, 0x06, 0x60,
+    0x01, 0x68, 0x0F, 0x90, 0x13, 0x2C, 0x23, 0x1E, 0x28, 0xE7, 0x00, 0x07, 0xC0, 0x78, 0x40, 0x4D,
+    0xF5, 0xAD, 0xC9, 0x59, 0x92, 0x51, 0x90, 0x09, 0x7B, 0x80, 0x83, 0xBF, 0x7F, 0xD0, 0xB2, 0x28,
+    0x2E, 0xEA, 0xF4, 0xA2, 0x71, 0x5E, 0xE3, 0xBC, 0x1A, 0x92, 0x7C, 0x7F, 0x31, 0xCC, 0x87, 0xDC,
+    0x85, 0x2F, 0x61, 0xBF, 0xF2, 0x5D, 0xB4, 0x83, 0xF1, 0xB9, 0x4D, 0xED, 0x22, 0xA7, 0x2E, 0x10,
+    0xF2, 0x72, 0x80, 0xB1, 0x03, 0x5C, 0x42, 0x43, 0x8F, 0x17, 0x79, 0x56, 0x90, 0x7E, 0xAF, 0xFB,
+    0x23, 0x34, 0x19, 0x0D, 0xE9, 0x25, 0x89, 0xFB, 0xCB, 0x31, 0x88, 0x08, 0x28, 0x0F, 0x3C, 0xBB,
+    0xF3, 0x02, 0x80, 0xFD, 0x3B, 0x5B, 0xDF, 0x02, 0x80, 0x9E, 0xA3, 0x64, 0xEC, 0x6F, 0x3E, 0x2B,
+    0x22, 0x40, 0x40, 0x2D, 0xE8, 0x38, 0x75, 0x1F, 0x27, 0x11, 0xCC, 0x90, 0xFA, 0xC9, 0x1C, 0x09,
+    0x3D, 0x23, 0x5C, 0x44, 0x57, 0x00, 0xED, 0xD1, 0x85, 0x83, 0x5D, 0x92, 0x4C, 0x0D, 0x17, 0x00,
+    0xC0, 0xD7, 0x1E, 0x32, 0x47, 0x5F, 0xDB, 0x0E, 0xC7, 0x8E, 0xD5, 0xF1, 0x39, 0x59, 0x80, 0xFE,
+    0x2F, 0xDD, 0x88, 0x05, 0xBD, 0x97, 0xF8, 0xFD, 0xDE, 0xBF, 0xAC, 0xD8, 0x1F, 0x39, 0x1D, 0xF7,
+    0xCB, 0x07, 0xE5, 0x80, 0x47, 0x5E, 0x3A, 0x00, 0xFC, 0xC3, 0x4B, 0x01, 0xB8, 0xDE, 0x79, 0x88,
+    0x3F, 0x93, 0xC0, 0x83, 0x4F, 0x1F, 0x04, 0x5E, 0x9E, 0xCF, 0x43, 0xBC, 0xE2, 0xDD, 0xF2, 0x98,
+    0xF0, 0x27, 0x4F, 0x87, 0x6E, 0x82, 0x46, 0x77, 0xEB, 0xEF, 0x06, 0x34, 0xCC, 0xD8, 0xBC, 0xF4,
+    0x7F, 0x2F, 0x79, 0x25, 0x9E, 0x37, 0xDD, 0xF6, 0x7C, 0xFE, 0xA0, 0x7C, 0xFE, 0xED, 0x68, 0x88,
+    0x1F, 0x9F, 0x05, 0xA0, 0xC9, 0x37, 0xC9, 0x9B, 0x5B, 0x5B, 0x17, 0x00, 0x39, 0x40, 0x4C, 0x40,
+    0x04, 0x0E, 0xEE, 0x7D, 0xD2, 0x64, 0x9B, 0x6C, 0xFA, 0x2C, 0xC9, 0xEE, 0xF9, 0xC3, 0xDE, 0xBF,
+    0x6C, 0x72, 0x7F, 0x64, 0xBC, 0x71, 0x5E, 0x3E, 0x28, 0x7C, 0x78, 0xE4, 0x25, 0x29, 0xFC, 0x3F,
+    0xF4, 0x07, 0x4F, 0xE1, 0x3A, 0x38, 0x8B, 0x3F, 0x13, 0x6F, 0x8E, 0x0F, 0x3E, 0x2D, 0xE5, 0xF0,
+    0xF2, 0x7C, 0x40, 0x89, 0x57, 0x7C, 0x38, 0xF8, 0x98, 0x78, 0x65, 0xF8, 0x9B, 0x9F, 0x25, 0xD9,
+    0xFD, 0xC7, 0x8F, 0x1B, 0x16, 0xBB, 0x6E, 0xB6, 0x45, 0xF0, 0xED, 0x78, 0x61, 0x91, 0x17, 0xC4,
+    0xF5, 0x4B, 0x37, 0x99, 0x54, 0xC2, 0x31, 0xE0, 0xB7, 0x00, 0x39, 0x42, 0xCC, 0xC0, 0x02, 0x1C,
+    0x5A, 0x05, 0xFE, 0x88, 0xCC, 0x38, 0xB4, 0xFB, 0xC8, 0xFD, 0x78, 0x60, 0x6B, 0xEB, 0x8F, 0xD7,
+    0x23, 0xFB, 0x61, 0x96, 0x9E, 0xD3, 0xD7, 0x2F, 0xA2, 0x9F, 0x90, 0x60, 0xA1, 0x7D, 0x3F, 0x0B,
+    0x2E, 0x96, 0xFF, 0x64, 0xEB, 0x2C, 0xF6, 0xC3, 0x2C, 0x1D, 0xA7, 0xFB, 0x4E, 0xA1, 0x9B, 0x54,
+    0x14, 0x05, 0xCD, 0x02, 0xB9, 0xFD, 0x4F, 0x17, 0xC3, 0xE6, 0xE2, 0x00, 0x88, 0xD4, 0x47, 0xE5,
+    0x0F, 0x01, 0xDF, 0xC6, 0x8F, 0x40, 0x14, 0x94, 0x26, 0x37, 0xB9, 0x4D, 0x6D, 0x6A, 0x93, 0x48,
+    0x62, 0xA9, 0xFF, 0x75, 0xB1, 0x8B, 0x32, 0xF4, 0x41, 0x06, 0x19, 0xCD, 0x2C, 0xC9, 0x49, 0xF2,
+    0xB6, 0x57, 0xD7, 0x5F, 0xF3, 0xDA, 0x57, 0xCD, 0x35, 0x23, 0x60, 0x87, 0xAA, 0xC9, 0x0E, 0x40,
+    0x43, 0xCE, 0x64, 0x51, 0xFC, 0xE8, 0x1D, 0x96, 0x87, 0x0C, 0xDF, 0xBA, 0xFB, 0xE3, 0x6D, 0x96,
+    0x87, 0x24, 0xDF, 0x9A, 0x6D, 0x79, 0x08, 0xC7, 0xDF, 0x9A, 0xF1, 0xD0, 0x43, 0x68, 0x7E, 0xC1,
+    0x07, 0x00, 0x75, 0x24, 0xD9, 0xED, 0xB8, 0x07, 0xFD, 0x68, 0x46, 0x83, 0xE4, 0x6E, 0x14, 0x00,
+    0xB8, 0xD8, 0x65, 0x93, 0x4E, 0xA5, 0xBF, 0xB9, 0xB4, 0xB1, 0x8D, 0x22, 0x88, 0xD0, 0xCD, 0xFB,
+    0xCE, 0x74, 0x8B, 0x2E, 0xA7, 0xCC, 0x79, 0xBD, 0xE8, 0xE5, 0x50, 0xBA, 0x60, 0x17, 0x35, 0x01,
+    0x00, 0x9A, 0x04, 0x35, 0xE8, 0x80, 0xD4, 0x73, 0x94, 0xDE, 0x64, 0x5C, 0xC0, 0x7F, 0x1C, 0xBA,
+    0x19, 0xD2, 0x1B, 0xC0, 0x88, 0x80, 0x66, 0xD1, 0x8F, 0xA7, 0xFE, 0xCA, 0xA2, 0x67, 0x23, 0x2F,
+    0x71, 0x38, 0x97, 0x54, 0x42, 0x3F, 0x7D, 0x1C, 0x70, 0x4A, 0xFE, 0xC0, 0x8B, 0x90, 0x2F, 0x0E,
+    0x5A, 0x90, 0x6D, 0x94, 0x8C, 0x6A, 0x84, 0x41, 0x02, 0x5E, 0xD8, 0x2C, 0x77, 0xDF, 0x44, 0xE8,
+    0x80, 0x04, 0xB7, 0x20, 0xC1, 0x64, 0x5C, 0xC0, 0x3E, 0x83, 0x53, 0xA8, 0x67, 0x17, 0xC1, 0x34,
+    0x43, 0xB3, 0xE8, 0x13, 0x19, 0x17, 0xD4, 0x0F, 0xE8, 0x8D, 0xBC, 0xF4, 0x7C, 0xB8, 0xE7, 0x07,
+    0x1E, 0x09, 0xFD, 0x84, 0x8B, 0xE8, 0x66, 0x5C, 0x84, 0x08, 0x28, 0x10, 0x01, 0x19, 0x6D, 0x6C,
+    0x98, 0x9B, 0x05, 0x8E, 0x48, 0x78, 0x78, 0x6B, 0xC4, 0x7D, 0x00, 0x7A, 0xA2, 0x0D, 0x92, 0xBE,
+    0x9B, 0xF7, 0x48, 0x2F, 0x3D, 0xE4, 0x68, 0x20, 0x0A, 0x2E, 0xA0, 0xCB, 0xCD, 0x52, 0x6F, 0x00,
+    0x5A, 0xFA, 0xF2, 0x53, 0xA7, 0x8F, 0x64, 0xE6, 0x53, 0x7D, 0x3A, 0x79, 0x36, 0xE9, 0x04, 0x11,
+    0x9E, 0x5B, 0xD0, 0x5F, 0xB9, 0x19, 0xA1, 0x9E, 0xFF, 0x8B, 0x08, 0xD3, 0xB1, 0x20, 0x75, 0xCC,
+    0x6D, 0x44, 0x37, 0x77, 0x33, 0xF6, 0x9D, 0x41, 0x1B, 0xA0, 0x66, 0xB8, 0xB1, 0x59, 0x97, 0x00,
+    0x7E, 0x04, 0x11, 0x60, 0x7C, 0x97, 0xE0, 0xA6, 0x3E, 0xC1, 0x8E, 0x6D, 0x42, 0x1F, 0xF6, 0xEA,
+    0x4F, 0x92, 0x61, 0xB4, 0x1C, 0xEE, 0x1F, 0x00, 0xA8, 0x31, 0xA0, 0xE3, 0x45, 0xE0, 0x13, 0x7A,
+    0xDC, 0xDB, 0xCE, 0xF5, 0xA7, 0x0D, 0x07, 0xC0, 0x2C, 0x40, 0xC7, 0x11, 0x28, 0x0B, 0xA0, 0xAE,
+    0x79, 0x88, 0x9B, 0x09, 0xB0, 0xD2, 0x43, 0xCE, 0x09, 0x6D, 0x92, 0x1E, 0x66, 0xCC, 0xE8, 0x6F,
+    0x9D, 0x98, 0x40, 0x16, 0x68, 0x72, 0x16, 0x24, 0xE1, 0xD0, 0x07, 0x39, 0xC3, 0xB5, 0x09, 0x7D,
+    0x30, 0x23, 0x2C, 0x80, 0x36, 0x02, 0x82, 0x23, 0x10, 0x02, 0x70, 0xE0, 0x00, 0x20, 0x33, 0x80,
+    0x0B, 0xAB, 0xA8, 0x76, 0xAA, 0x97, 0x53, 0x05, 0x90, 0xD7, 0x47, 0x74, 0x1F, 0x07, 0x88, 0x9B,
+    0x09, 0x4D, 0x32, 0x40, 0x91, 0x1E, 0x4E, 0x04, 0x98, 0x31, 0x43, 0xFF, 0xD4, 0x0E, 0x92, 0x9C,
+    0x7B, 0x72, 0x11, 0x24, 0xDB, 0x04, 0xED, 0x0B, 0xFA, 0xE0, 0xD0, 0xA6, 0xF5, 0x52, 0x0D, 0x49,
+    0x0F, 0x18, 0x32, 0x01, 0x3D, 0xC9, 0x11, 0x4D, 0x71, 0xC7, 0x8F, 0x01, 0xE6, 0xD5, 0x00, 0xA0,
+    0x8F, 0x04, 0xD0, 0x14, 0x39, 0x03, 0x30, 0x97, 0x48, 0x8F, 0x3E, 0x6A, 0x26, 0x80, 0x2D, 0xE9,
+    0x61, 0x7E, 0x6A, 0x7F, 0x72, 0x0C, 0x1D, 0xB9, 0x00, 0x20, 0x39, 0x00, 0x9A, 0x0C, 0x40, 0xB7,
+    0x80, 0x00, 0x08, 0x49, 0x42, 0x4F, 0x20, 0x83, 0x48, 0x50, 0x2C, 0x80, 0x2B, 0x80, 0xE1, 0x02,
+    0x49, 0xFA, 0xEE, 0xD6, 0xC9, 0xD8, 0xE4, 0x86, 0x70, 0x30, 0xDE, 0xF8, 0x3E, 0x9C, 0xB8, 0xD9,
+    0x26, 0xC3, 0x89, 0x8A, 0xC1, 0xFC, 0x0B, 0x9E, 0x93, 0xC1, 0xF8, 0x3E, 0xCA, 0x59, 0xA4, 0x2E,
+    0x8A, 0xD2, 0xE6, 0xAF, 0x10, 0x24, 0x61, 0x58, 0x20, 0xF9, 0x2E, 0x80, 0x66, 0x91, 0x00, 0xAF,
+    0x7B, 0x5C, 0xE4, 0x84, 0x03, 0xFD, 0x99, 0x75, 0x4A, 0xDE, 0x45, 0x47, 0x8E, 0x1D, 0x19, 0x45,
+    0x69, 0x29, 0x0A, 0xCC, 0x25, 0xA2, 0x8F, 0x6E, 0x68, 0xB2, 0xF1, 0xB0, 0x47, 0x67, 0xA8, 0x37,
+    0x22, 0xFA, 0x8F, 0x32, 0x44, 0x72, 0x43, 0x43, 0x35, 0xC1, 0x3D, 0x91, 0x60, 0x3D, 0x47, 0x37,
+    0x29, 0x72, 0x6E, 0xC9, 0x19, 0x8A, 0xE3, 0xC6, 0xC4, 0xDE, 0x8B, 0x03, 0x66, 0x2C, 0xF2, 0x9D,
+    0x24, 0x18, 0x40, 0x0F, 0x8E, 0x82, 0xB3, 0xFC, 0x78, 0x31, 0xBE, 0x68, 0x1C, 0xDC, 0x83, 0x3D,
+    0x00, 0xF6, 0xA2, 0xE1, 0x7B, 0x53, 0x47, 0x86, 0x8E, 0x5C, 0x44, 0x69, 0x29, 0x72, 0xC3, 0x2B,
+    0x05, 0x8C, 0x0E, 0x39, 0x1B, 0x7F, 0xC1, 0x1C, 0x9D, 0x4F, 0xA9, 0x37, 0xE2, 0xA1, 0xEE, 0x46,
+    0x32, 0x6D, 0xB2, 0x06, 0x45, 0x71, 0x70, 0x4F, 0x70, 0xB4, 0x9E, 0xDE, 0x4E, 0xAB, 0x17, 0x9C,
+    0xFA, 0xEB, 0x1C, 0x71, 0x16, 0xBB, 0x5F, 0x5D, 0x02, 0x8C, 0x47, 0xBB, 0x00, 0x6A, 0x00, 0x80,
+    0x3E, 0x80, 0x6A, 0xEA, 0xA3, 0x19, 0xAD, 0xA7, 0x48, 0x6D, 0xD2, 0x53, 0x17, 0x0B, 0xE4, 0xB5,
+    0x00, 0xC3, 0x01, 0x6E, 0x41, 0x43, 0x0F, 0x91, 0x01, 0x19, 0x00, 0x33, 0xA2, 0xC9, 0x40, 0x1F,
+    0xAA, 0xF1, 0x2A, 0x80, 0x58, 0xAA, 0xE1, 0x12, 0x09, 0x90, 0x33, 0x60, 0x39, 0x36, 0xA4, 0xEF,
+    0xC9, 0xD1, 0x5C, 0x22, 0x4A, 0x9B, 0xBB, 0xD8, 0x47, 0xED, 0x8D, 0x67, 0x43, 0x51, 0x5C, 0x94,
+    0xE4, 0x60, 0x39, 0xB7, 0xE5, 0xC9, 0xCD, 0x19, 0x51, 0x76, 0xC9, 0xC7, 0x19, 0x30, 0x4C, 0x80,
+    0x63, 0x01, 0xD8, 0x10, 0x4D, 0x06, 0xD1, 0xA6, 0xA6, 0x40, 0xA4, 0x3E, 0x41, 0x2C, 0x26, 0xA0,
+    0x8B, 0x1C, 0xD0, 0xDF, 0x28, 0x40, 0x1F, 0x38, 0x40, 0x06, 0x37, 0x41, 0xCE, 0x26, 0x42, 0x4D,
+    0x7D, 0x82, 0xF6, 0x22, 0xC1, 0xF8, 0x36, 0xC1, 0xFC, 0x1F, 0x7F, 0xBA, 0xC0, 0xFC, 0x80, 0x01,
+    0xF6, 0x28, 0x47, 0x38, 0x00, 0x20, 0x80, 0xB6, 0x00, 0x30, 0x09, 0x75, 0x09, 0xC0, 0x4C, 0x00,
+    0xA0, 0x0F, 0xCF, 0x3D, 0x2F, 0xE0, 0x36, 0xC7, 0x07, 0xF7, 0xCD, 0x00, 0xD0, 0xBD, 0xFB, 0xFB,
+    0x82, 0xD7, 0x3C, 0x99, 0x54, 0xE4, 0x76, 0xEA, 0x16, 0x3B, 0xDA, 0x6F, 0xC6, 0x2E, 0x10, 0x4E,
+    0x06, 0x39, 0xB3, 0x29, 0x32, 0x98, 0xC9, 0x31, 0x09, 0x5E, 0xF7, 0xEA, 0x66, 0xF5, 0xD7, 0xDD,
+    0x8C, 0x86, 0x1E, 0x8F, 0x3E, 0x8A, 0xF6, 0xF5, 0x09, 0x2A, 0x01, 0xA7, 0xF0, 0xB9, 0x4F, 0x66,
+    0xFF, 0xD6, 0xDF, 0x7D, 0x17, 0xFC, 0x98, 0x1C, 0x48, 0x32, 0xD8, 0x6D, 0x9E, 0x4E, 0xC6, 0xDB,
+    0xD1, 0xA9, 0x59, 0x4D, 0xF6, 0xD5, 0xD0, 0x91, 0xDB, 0xA9, 0x25, 0x47, 0x82, 0x7F, 0x02, 0xE3,
+    0xED, 0x08, 0x19, 0x4C, 0x68, 0x5A, 0x92, 0x7F, 0xEA, 0x4D, 0x21, 0x43, 0x97, 0x9F, 0x63, 0xDC,
+    0xA5, 0x01, 0xF7, 0xB6, 0x03, 0x9C, 0x43, 0xC3, 0x19, 0x1D, 0x01, 0x57, 0xD0, 0xBC, 0x95, 0x00,
+    0x11, 0xE1, 0xDE, 0x9C, 0x24, 0x39, 0xF2, 0x7A, 0xE9, 0x92, 0x5C, 0x8C, 0xD7, 0x13, 0xE1, 0x8E,
+    0x2C, 0x22, 0xC9, 0x59, 0xCE, 0xC6, 0x73, 0x70, 0xD7, 0x17, 0x90, 0x1E, 0x6E, 0x3D, 0x9F, 0x7E,
+    0x7C, 0x92, 0x4C, 0xCD, 0x6D, 0x0E, 0x8F, 0x74, 0x13, 0x00, 0xEC, 0x2B, 0x10, 0x4C, 0x20, 0x83,
+    0x0E, 0x14, 0xA9, 0x8B, 0x76, 0x30, 0xDF, 0x0F, 0x22, 0x12, 0xF6, 0x68, 0xE8, 0x03, 0xC1, 0x3E,
+    0xE8, 0xC9, 0x32, 0xB5, 0x24, 0xFA, 0x75, 0x55, 0x3C, 0x0A, 0x28, 0x8F, 0x2E, 0x00, 0x2F, 0x63,
+    0x77, 0xAC, 0x71, 0x0E, 0x7B, 0x00, 0x59, 0x8F, 0x24, 0x60, 0xCF, 0x6A, 0x26, 0xDD, 0x9F, 0x81,
+    0x9C, 0x0C, 0x53, 0xBF, 0x18, 0x5F, 0x64, 0x56, 0xAF, 0xF3, 0xED, 0xF4, 0x5C, 0x36, 0xD7, 0x4E,
+    0x5C, 0xE5, 0xDB, 0xC9, 0x24, 0xF3, 0x0A, 0xFB, 0xA8, 0x6E, 0xB3, 0x21, 0xBD, 0xE1, 0xDC, 0xFA,
+    0xDD, 0xEA, 0x2F, 0x12, 0xD0, 0x26, 0xA0, 0x49, 0x00, 0xEA, 0x10, 0xE3, 0x81, 0xF1, 0x9E, 0xB3,
+    0x7D, 0xE8, 0x96, 0x26, 0x89, 0x04, 0xDB, 0x14, 0xC8, 0xC9, 0x41, 0x44, 0x33, 0xA2, 0x68, 0x0F,
+    0xFD, 0x83, 0x09, 0xFD, 0xFB, 0x01, 0xCD, 0xED, 0x08, 0xD8, 0x54, 0x8D, 0xA8, 0x20, 0x00, 0x0E,
+    0x55, 0x7B, 0xB5, 0x07, 0xF4, 0x8C, 0x96, 0x01, 0x70, 0x01, 0xD0, 0x55, 0x99, 0x3C, 0xC0, 0xBA,
+    0x3C, 0xD4, 0x04, 0x58, 0xA0, 0x4D, 0x17, 0x21, 0xAF, 0x13, 0x86, 0xB9, 0xE1, 0xF7, 0x97, 0x7E,
+    0x91, 0xC1, 0x78, 0xE3, 0x0B, 0x8A, 0x88, 0xDD, 0xA2, 0xBC, 0x9E, 0x1C, 0x28, 0x4A, 0xBF, 0x48,
+    0xD2, 0x1B, 0x97, 0x9B, 0xE4, 0xFC, 0xAE, 0x85, 0xD6, 0xC5, 0x7A, 0x52, 0x07, 0x00, 0xFB, 0x4E,
+    0xCF, 0x10, 0x31, 0x01, 0xC9, 0x00, 0x7B, 0xF7, 0xD6, 0x1B, 0xF9, 0x36, 0x1E, 0x1E, 0xB5, 0x57,
+    0x73, 0x17, 0x64, 0x68, 0x52, 0xB7, 0xC0, 0x3C, 0x9E, 0x20, 0xA7, 0x02, 0xB1, 0x38, 0xE0, 0xA2,
+    0x19, 0xA0, 0x5F, 0xF4, 0xE8, 0xAE, 0x4F, 0x68, 0x18, 0x00, 0x13, 0x01, 0x99, 0x00, 0x91, 0x51,
+    0x97, 0xA0, 0x03, 0xE0, 0x46, 0xF4, 0xF4, 0x68, 0xE9, 0x01, 0x57, 0x63, 0xF2, 0x87, 0xB7, 0x06,
+    0x48, 0x4E, 0x10, 0x1B, 0x35, 0x52, 0x11, 0x90, 0xA5, 0x3A, 0x2A, 0x71, 0x7B, 0x46, 0x93, 0x13,
+    0x90, 0x6D, 0xF5, 0x53, 0xE6, 0xF9, 0x00, 0xED, 0x13, 0xE4, 0x6C, 0x86, 0xFE, 0xD6, 0x89, 0x49,
+    0x90, 0x4B, 0x4B, 0x16, 0x90, 0xF4, 0x0E, 0x7D, 0x30, 0x63, 0x9B, 0xB4, 0x87, 0x93, 0x33, 0x94,
+    0xC7, 0xC3, 0x5B, 0xE8, 0x19, 0xE0, 0xAA, 0x09, 0x38, 0xF5, 0xB7, 0xCE, 0x98, 0x9C, 0x24, 0x79,
+    0x89, 0x47, 0x93, 0xF1, 0xF6, 0x7B, 0x4B, 0x17, 0xDD, 0x60, 0x65, 0xE8, 0x03, 0x51, 0x64, 0x50,
+    0x33, 0x45, 0xEE, 0x49, 0x6F, 0x4A, 0x6A, 0x78, 0x62, 0xBC, 0x33, 0xB1, 0xBD, 0x7F, 0x16, 0xB0,
+    0x6E, 0x84, 0x60, 0x00, 0xFA, 0x77, 0x71, 0x47, 0x54, 0xC1, 0x11, 0xB0, 0x4B, 0xF5, 0x72, 0x4D,
+    0x4E, 0x80, 0x39, 0xE1, 0xD1, 0x85, 0x54, 0xDD, 0x9C, 0xF6, 0x09, 0x62, 0x91, 0x13, 0xDC, 0x1F,
+    0x65, 0xC8, 0x6A, 0xB2, 0x0B, 0x0C, 0x19, 0xFA, 0x00, 0x87, 0x82, 0x3E, 0x68, 0x0F, 0x27, 0x16,
+    0x74, 0x01, 0x00, 0xE4, 0x78, 0x1E, 0xCE, 0x0D, 0x82, 0xF3, 0xE6, 0x32, 0x9F, 0x4F, 0xEA, 0x2F,
+    0x72, 0x14, 0xA1, 0x86, 0xFA, 0x96, 0x1E, 0x10, 0x11, 0x00, 0x47, 0x40, 0xAD, 0x91, 0xC5, 0xBF,
+    0xB6, 0x7C, 0x6B, 0x7C, 0x6F, 0x00, 0x71, 0x13, 0x30, 0xF3, 0x5D, 0x16, 0x1A, 0xFD, 0x52, 0x4F,
+    0x6D, 0x86, 0x9D, 0x60, 0xA2, 0xE3, 0x0C, 0xCB, 0xD4, 0x90, 0x8B, 0xE0, 0xE1, 0x97, 0xE4, 0x02,
+    0xA8, 0x75, 0x25, 0xDC, 0x15, 0xE3, 0xAE, 0x6F, 0x3B, 0x00, 0xD6, 0x03, 0x66, 0xDE, 0x07, 0x45,
+    0xA2, 0x27, 0xEF, 0xCA, 0x43, 0xDA, 0x82, 0x6E, 0x81, 0x9C, 0xA0, 0x07, 0x00, 0x38, 0xF9, 0x6E,
+    0xCB, 0x24, 0xB9, 0xE8, 0xF8, 0x9B, 0xC6, 0xC3, 0x8E, 0x70, 0x58, 0xB3, 0x49, 0x02, 0x6E, 0x18,
+    0x2C, 0x27, 0xC3, 0xA9, 0xBF, 0xE3, 0x64, 0x41, 0x0F, 0xC1, 0x19, 0xF2, 0x6A, 0x84, 0x5E, 0x97,
+    0xF9, 0x17, 0x2C, 0xA2, 0x09, 0xE0, 0x22, 0x96, 0xDC, 0x4F, 0x8F, 0x7D, 0x3E, 0x11, 0x0D, 0x00,
+    0x3B, 0xD6, 0x8B, 0xFD, 0xD6, 0xAF, 0x64, 0x14, 0xA5, 0x87, 0x9A, 0xA1, 0x27, 0xDC, 0xF3, 0xF9,
+    0x46, 0x51, 0xFA, 0x0B, 0x10, 0x1F, 0x46, 0xB4, 0x9C, 0xAA, 0xB1, 0xFB, 0xE2, 0x45, 0x4C, 0xFD,
+    0x24, 0x5F, 0x9B, 0x5A, 0x4E, 0xAB, 0x07, 0xDE, 0x57, 0x86, 0x9E, 0x41, 0x72, 0xE9, 0xF3, 0x97,
+    0x45, 0x42, 0x53, 0x00, 0x07, 0x18, 0x0F, 0x19, 0x20, 0x12, 0xE0, 0x86, 0x41, 0x31, 0x0A, 0x66,
+    0xE8, 0xDD, 0x1A, 0x99, 0xE4, 0x04, 0xF5, 0x43, 0x0F, 0xC1, 0xA9, 0xC6, 0xB5, 0x00, 0x7A, 0xCE,
+    0x10, 0xE4, 0x08, 0x32, 0xC1, 0xFE, 0xD7, 0x1C, 0xD4, 0xA4, 0x42, 0x1F, 0x44, 0x12, 0x09, 0x0E,
+    0x05, 0xDA, 0xDB, 0x41, 0x06, 0xED, 0x45, 0x92, 0x01, 0x14, 0x09, 0x6E, 0x28, 0x30, 0xDE, 0x0E,
+    0x66, 0xD6, 0x57, 0x5C, 0x90, 0x64, 0x10, 0xE4, 0x0C, 0x96, 0x01, 0x80, 0x88, 0x05, 0xD5, 0x64,
+    0xF4, 0x1F, 0x44, 0x40, 0x7E, 0x38, 0xD5, 0x68, 0xE7, 0x94, 0x9C, 0x20, 0x78, 0xCD, 0x43, 0x92,
+    0x1E, 0x2A, 0xD0, 0x57, 0x27, 0x6C, 0x47, 0x3B, 0xC0, 0xC1, 0x02, 0xAC, 0xE3, 0x5C, 0x00, 0x36,
+    0x19, 0xA0, 0xC8, 0x80, 0x63, 0x02, 0x4C, 0x49, 0x80, 0x8A, 0xCB, 0xE6, 0x26, 0xBE, 0xD0, 0x70,
+    0x16, 0x22, 0x02, 0x5D, 0x44, 0x47, 0xA2, 0x63, 0xC1, 0xDE, 0x13, 0xEF, 0x02, 0x72, 0x6A, 0x78,
+    0xC2, 0x77, 0x15, 0xC1, 0x18, 0xCD, 0xEC, 0x46, 0x33, 0xDA, 0xC1, 0x0D, 0x16, 0x0E, 0x16, 0x44,
+    0x01, 0x91, 0x41, 0x91, 0xE1, 0x98, 0x60, 0x4A, 0xBA, 0x23, 0xDE, 0xBE, 0xAD, 0xB3, 0x30, 0x1C,
+    0xB1, 0xCE, 0x9D, 0x63, 0x14, 0x2B, 0x10, 0x62, 0xFF, 0xE8, 0xD8, 0xEE, 0x88, 0x90, 0x9C, 0x3A,
+    0x12, 0x9A, 0x09, 0x3C, 0x7E, 0x6C, 0x27, 0x28, 0x1C, 0xD0, 0x66, 0x40, 0x92, 0x30, 0x35, 0x3E,
+    0x00, 0xBE, 0xBD, 0x05, 0x4D, 0x2F, 0x39, 0x03, 0x80, 0x7E, 0x17, 0x8E, 0x83, 0x63, 0xB0, 0xA7,
+    0xB3, 0xF1, 0x56, 0x4D, 0xF6, 0x55, 0xF2, 0x2A, 0x39, 0xF2, 0x4F, 0x60, 0x3C, 0xFA, 0xD0, 0x34,
+    0xFC, 0xD3, 0xC9, 0x30, 0xB6, 0xDC, 0x19, 0x30, 0x1C, 0x10, 0x13, 0x8A, 0x43, 0xCB, 0x88, 0xE6,
+    0xE2, 0x3A, 0xE9, 0x1C, 0xD6, 0x0B, 0x74, 0xB7, 0x8E, 0x43, 0x4D, 0x77, 0x42, 0x53, 0x66, 0x58,
+    0x86, 0x96, 0xF4, 0xF2, 0xE6, 0xF1, 0xBB, 0x7C, 0xEA, 0x04, 0xD4, 0xC9, 0xF6, 0x92, 0x5C, 0x4F,
+    0x3C, 0xCB, 0xF7, 0x43, 0xC3, 0x88, 0xAF, 0xCC, 0xD5, 0x1E, 0x0D, 0x3D, 0x63, 0x4F, 0x76, 0x8B,
+    0xBA, 0x9A, 0xBA, 0x1B, 0xB9, 0x4B, 0x8E, 0xD9, 0x70, 0x91, 0x9F, 0x1C, 0x13, 0x09, 0x70, 0xB8,
+    0x4F, 0x7D, 0x72, 0x41, 0x90, 0x83, 0xDE, 0xB5, 0xC2, 0x9B, 0x65, 0x8D, 0x99, 0x3D, 0xF0, 0xAD,
+    0x2F, 0x52, 0x3C, 0x24, 0xC0, 0x0D, 0x30, 0x1E, 0xED, 0xF8, 0xF9, 0xC4, 0xFB, 0x22, 0xE6, 0xEF,
+    0x39, 0xA0, 0x9B, 0x80, 0x43, 0x00, 0x32, 0x20, 0x56, 0x71, 0xFF, 0xB5, 0x27, 0xB3, 0x89, 0x68,
+    0x22, 0x90, 0x00, 0x33, 0x40, 0x2E, 0x3B, 0xAE, 0x46, 0x8D, 0x09, 0xFD, 0x7B, 0x01, 0x82, 0x1E,
+    0xCD, 0x7A, 0xDF, 0x8E, 0x11, 0x64, 0x00, 0x19, 0x9A, 0x72, 0x7C, 0x68, 0x72, 0x0D, 0xE6, 0x44,
+    0x02, 0x04, 0x39, 0x74, 0xAB, 0x85, 0x91, 0x37, 0x8F, 0x43, 0x86, 0x2A, 0xB9, 0x9A, 0x56, 0xEB,
+    0xC4, 0xB4, 0xF3, 0xAE, 0xC6, 0x2D, 0xE3, 0x94, 0x85, 0xA0, 0x87, 0x8A, 0x1B, 0xA9, 0x35, 0xA7,
+    0x9E, 0x6C, 0x4A, 0x17, 0x8D, 0xB7, 0x5D, 0x54, 0xC1, 0x31, 0x4B, 0x16, 0xF0, 0x4F, 0x20, 0x03,
+    0xE0, 0x70, 0x5F, 0x57, 0x5E, 0x1C, 0x0C, 0xE3, 0x26, 0x5E, 0x59, 0x33, 0xE9, 0x19, 0x0D, 0x23,
+    0xBA, 0x90, 0x20, 0xC7, 0xE7, 0xEA, 0x7A, 0xE1, 0x02, 0x43, 0x82, 0xCC, 0x82, 0xC3, 0x3F, 0xE8,
+    0xD3, 0xDD, 0x76, 0xD2, 0x8E, 0x4C, 0x76, 0x60, 0x72, 0x03, 0x17, 0x37, 0x74, 0xD1, 0x0E, 0x7D,
+    0xB0, 0x5E, 0x06, 0x33, 0xCB, 0x59, 0x91, 0x53, 0x4F, 0x4E, 0x4D, 0xB5, 0x3C, 0xAB, 0x2D, 0x4E,
+    0x00, 0x17, 0xC8, 0xAB, 0x01, 0x8B, 0xA8, 0x3A, 0xB9, 0x3C, 0x30, 0x98, 0x9C, 0x04, 0x19, 0x54,
+    0xA4, 0x67, 0x53, 0xBA, 0xA5, 0x8B, 0x7A, 0x52, 0x9E, 0x70, 0x22, 0x89, 0x45, 0x06, 0x35, 0x9B,
+    0x4B, 0x1C, 0x5C, 0x9D, 0xB0, 0x86, 0x66, 0x04, 0x32, 0xD0, 0x87, 0xBD, 0xB0, 0x5E, 0x33, 0xC1,
+    0x71, 0x82, 0xDB, 0x2C, 0x27, 0xE1, 0x0F, 0x41, 0x7C, 0x92, 0xD0, 0x30, 0x02, 0x27, 0xC7, 0x5F,
+    0xC9, 0x5D, 0xC4, 0xDE, 0xB7, 0x25, 0xA3, 0xE3, 0x8C, 0xF6, 0x16, 0x7E, 0x15, 0x77, 0x01, 0x35,
+    0xAE, 0x9E, 0xC8, 0x03, 0xF7, 0xE0, 0x57, 0x72, 0x17, 0x62, 0xFD, 0xB1, 0xC3, 0x06, 0xC6, 0xFA,
+    0xA2, 0xEF, 0xE2, 0x8B, 0x94, 0xF8, 0xFE, 0x35, 0x4B, 0x31, 0x00, 0xCE, 0xE3, 0x0E, 0xF0, 0x86,
+    0xA5, 0x46, 0x8B, 0x76, 0x0D, 0x18, 0x7F, 0x05, 0x73, 0x51, 0xB3, 0xA4, 0x05, 0x30, 0xDF, 0x9F,
+    0xD0, 0x4F, 0x7A, 0x5D, 0xC4, 0x90, 0x93, 0x0C, 0x4D, 0x46, 0x81, 0xF6, 0x6A, 0x16, 0xA9, 0xC9,
+    0x30, 0xA3, 0xF6, 0x5D, 0x14, 0x09, 0x76, 0x30, 0x15, 0xF6, 0x20, 0x1C, 0x39, 0xCB, 0x9B, 0xBF,
+    0x93, 0x41, 0x68, 0x2F, 0xD7, 0xEF, 0x79, 0xED, 0xC5, 0x52, 0xBF, 0x37, 0xF6, 0x41, 0x54, 0x70,
+    0x08, 0xE8, 0x0A, 0x1A, 0x06, 0x58, 0x35, 0xAA, 0xF1, 0xD9, 0xF5, 0x2A, 0x90, 0x01, 0x28, 0x80,
+    0x9A, 0xD0, 0x24, 0x40, 0x5F, 0x9E, 0xC5, 0x6D, 0x7A, 0xC3, 0xD2, 0x15, 0x15, 0x9C, 0xA7, 0x0C,
+    0x72, 0x26, 0xB2, 0x9C, 0xD5, 0x95, 0xDC, 0x26, 0xED, 0xCD, 0x76, 0x12, 0x8B, 0x19, 0xCD, 0x91,
+    0xD8, 0x05, 0x0B, 0x57, 0x05, 0x05, 0xA1, 0xA6, 0x7B, 0xB8, 0xE5, 0xFE, 0x1F, 0x45, 0x32, 0x69,
+    0x92, 0xA9, 0x4D, 0xB0, 0xA3, 0x48, 0xB0, 0x83, 0x20, 0x89, 0x8E, 0xD5, 0xEC, 0x14, 0xC8, 0x9B,
+    0xBF, 0x93, 0x21, 0x43, 0x9B, 0x20, 0x67, 0x91, 0xA0, 0x26, 0x91, 0xA0, 0xBD, 0x58, 0x60, 0x7C,
+    0x17, 0x61, 0xC6, 0x3E, 0xC0, 0x8C, 0xD5, 0x90, 0x40, 0x06, 0x48, 0x66, 0x90, 0x7E, 0x5F, 0x7E,
+    0x12, 0xDA, 0x43, 0x2C, 0x1C, 0x8C, 0x4B, 0x1D, 0x39, 0xBB, 0xA9, 0xF4, 0xF1, 0x97, 0x08, 0xB7,
+    0x83, 0x55, 0xF8, 0x15, 0xAB, 0x90, 0x9C, 0xC1, 0x02, 0xC9, 0x11, 0xDA, 0x43, 0x24, 0xC0, 0x8C,
+    0x10, 0x11, 0xB0, 0x03, 0xFA, 0x00, 0x10, 0x90, 0x33, 0x9A, 0x0C, 0x68, 0x8F, 0xB6, 0xA2, 0x40,
+    0xAA, 0xA0, 0x63, 0x84, 0xE3, 0x80, 0x6E, 0x3E, 0xA0, 0xCA, 0x72, 0xC8, 0x85, 0x6F, 0xF4, 0x23,
+    0x80, 0xE6, 0x1C, 0x44, 0x82, 0x58, 0xD0, 0x45, 0xF4, 0x01, 0xB2, 0xFE, 0x3F, 0x43, 0x4D, 0xD0,
+    0x1E, 0xC6, 0xC3, 0x8C, 0x30, 0x03, 0xEC, 0x00, 0x3C, 0xBC, 0x35, 0x28, 0x4E, 0x1D, 0x03, 0x00,
+    0xB0, 0xC0, 0x70, 0x94, 0x15, 0x6A, 0x31, 0x1E, 0x72, 0x86, 0x88, 0x68, 0x32, 0xEE, 0x6C, 0x77,
+    0x11, 0x6D, 0xDA, 0x6C, 0xDB, 0x05, 0x96, 0x83, 0xE6, 0x84, 0x7B, 0xB6, 0xCE, 0x30, 0x2B, 0x7A,
+    0xA0, 0x39, 0x07, 0xE3, 0xC5, 0x02, 0x3B, 0xF4, 0x01, 0x84, 0x0C, 0x28, 0x50, 0x53, 0x9B, 0xEA,
+    0x5E, 0x33, 0xAC, 0x6E, 0xA6, 0x1F, 0xCF, 0xC3, 0xB9, 0x51, 0x30, 0x6C, 0xF2, 0x30, 0x96, 0x3A,
+    0x0A, 0xCB, 0xE6, 0xFE, 0xC4, 0x02, 0x98, 0x01, 0x5D, 0xFC, 0x94, 0x3E, 0xB4, 0x09, 0xEB, 0x20,
+    0x35, 0x9C, 0x61, 0x39, 0xF4, 0x35, 0xB5, 0x7D, 0x56, 0x5C, 0x2A, 0x4E, 0x30, 0x34, 0xA5, 0xE2,
+    0x02, 0x20, 0xC4, 0x02, 0x35, 0xC1, 0x41, 0x24, 0xC8, 0x00, 0x33, 0x36, 0x19, 0x7D, 0x80, 0xF1,
+    0x28, 0x10, 0x11, 0x6A, 0x02, 0x58, 0xC0, 0x02, 0x2E, 0x9F, 0x1E, 0x18, 0xB7, 0xD6, 0xBB, 0x9A,
+    0x8C, 0x36, 0xA1, 0x4D, 0x10, 0x09, 0xAA, 0xC0, 0x72, 0x70, 0x1C, 0x9A, 0x88, 0xCE, 0x43, 0x8E,
+    0x50, 0x67, 0x20, 0xE3, 0x8E, 0xE7, 0x44, 0xB3, 0xC0, 0x78, 0x91, 0xF0, 0x40, 0xCD, 0xE7, 0xEF,
+    0xBA, 0xF7, 0x04, 0x33, 0x76, 0x11, 0xAE, 0xEE, 0x95, 0x53, 0x93, 0x21, 0x47, 0x31, 0xE3, 0x3C,
+    0xE4, 0xFF, 0x09, 0xE7, 0xC5, 0xCE, 0xBA, 0x6B, 0x23, 0xBA, 0x05, 0x5D, 0x44, 0x73, 0x66, 0x1D,
+    0x96, 0xCF, 0x21, 0xE0, 0x39, 0x91, 0xC4, 0xD2, 0xC5, 0x3E, 0xC8, 0x20, 0x83, 0x9C, 0xD5, 0x54,
+    0xCB, 0x7C, 0x66, 0xB0, 0x03, 0x58, 0xDA, 0x04, 0x16, 0x91, 0xC0, 0x45, 0x2C, 0xD0, 0xBE, 0x8B,
+    0x30, 0x7E, 0xA3, 0xDE, 0x66, 0x90, 0x33, 0xEC, 0xA0, 0x66, 0x38, 0xA8, 0x09, 0x84, 0xF6, 0x28,
+    0x30, 0xBE, 0xC9, 0x30, 0x63, 0x9B, 0x60, 0x87, 0x36, 0xD5, 0x11, 0x25, 0x54, 0x01, 0x61, 0x39,
+    0x14, 0x38, 0x1E, 0xCE, 0x2B, 0x40, 0x83, 0x3E, 0x01, 0x1D, 0xE3, 0x8A, 0x06, 0x76, 0x1C, 0x00,
+    0xAC, 0xE5, 0x2F, 0x9C, 0xC2, 0x79, 0xB0, 0x29, 0x60, 0x9B, 0xF1, 0xAD, 0x6A, 0xCD, 0x9A, 0x73,
+    0xED, 0x0B, 0x22, 0x75, 0x51, 0x2C, 0x7D, 0x58, 0xCB, 0x2D, 0xB3, 0x0C, 0x72, 0x96, 0x41, 0x4D,
+    0x72, 0xD6, 0x5E, 0x4D, 0xC6, 0x6B, 0x6F, 0x46, 0xE3, 0xED, 0x60, 0x46, 0x07, 0x33, 0x38, 0xD8,
+    0x81, 0x15, 0xF5, 0x68, 0x72, 0xBD, 0xA8, 0x5B, 0x2A, 0x7A, 0xE3, 0x36, 0x01, 0x9C, 0x0D, 0x3F,
+    0xE7, 0xD5, 0x77, 0x0A, 0x35, 0x5C, 0xDF, 0xEB, 0xEF, 0x77, 0x82, 0x90, 0x05, 0xE8, 0x16, 0xA0,
+    0x8F, 0x35, 0xA0, 0xBA, 0x2B, 0x08, 0xF1, 0x77, 0x1C, 0x93, 0x1D, 0xD1, 0x10, 0x60, 0x01, 0x98,
+    0x00, 0xCE, 0x3B, 0xE8, 0x16, 0xD0, 0x67, 0xC0, 0x25, 0xF4, 0x6F, 0x2D, 0x78, 0xAE, 0x0D, 0x2B,
+    0x40, 0xF5, 0xF3, 0x50, 0xD2, 0x67, 0xC2, 0xB1, 0xBB, 0xBE, 0xB4, 0xC6, 0x95, 0x7A, 0x86, 0x64,
+    0x05, 0x39, 0x39, 0x00, 0x70, 0x30, 0x5E, 0x06, 0x19, 0x51, 0xDA, 0x02, 0x35, 0x39, 0xDF, 0x24,
+    0x15, 0xA0, 0xB7, 0x13, 0x44, 0xE2, 0x00, 0xE3, 0x26, 0x74, 0x5C, 0x00, 0xC7, 0x11, 0x92, 0x09,
+    0xA0, 0x9E, 0x20, 0x67, 0xA2, 0xC9, 0x32, 0x40, 0x7B, 0x3B, 0x8A, 0x24, 0x12, 0xCC, 0xA8, 0x27,
+    0x11, 0x9B, 0x35, 0x08, 0x6A, 0x9E, 0x5C, 0xF3, 0xD9, 0x7E, 0x5E, 0x51, 0xB5, 0x7B, 0x56, 0x13,
+    0xBC, 0x7B, 0x90, 0x9A, 0x04, 0xB4, 0xA9, 0x3D, 0x27, 0x92, 0x8C, 0x62, 0x31, 0x53, 0x17, 0xDD,
+    0xD0, 0x7F, 0x90, 0x21, 0x6F, 0x47, 0x48, 0xCE, 0x90, 0x6B, 0xD1, 0x57, 0xBF, 0xB1, 0xC0, 0x6C,
+    0x27, 0x98, 0xD3, 0x05, 0x66, 0x20, 0x2C, 0x6C, 0x9D, 0x92, 0xE3, 0xEB, 0xB9, 0x12, 0xD0, 0x06,
+    0xA0, 0x1D, 0x81, 0xE6, 0xDC, 0xBF, 0xC1, 0xF9, 0xEC, 0x08, 0x33, 0xC2, 0x8C, 0x77, 0x80, 0x70,
+    0x91, 0x80, 0x02, 0xD8, 0x01, 0xCA, 0xDF, 0xBD, 0xAD, 0x77, 0x52, 0xD0, 0x3B, 0xDB, 0xA4, 0x20,
+    0x3D, 0x6B, 0x02, 0x53, 0xED, 0x83, 0xF6, 0x38, 0xB4, 0x71, 0x3F, 0x9B, 0xB5, 0x55, 0x97, 0xD7,
+    0x2F, 0xB5, 0xA6, 0x76, 0xD8, 0x68, 0xD7, 0xCE, 0x0F, 0xD3, 0x2F, 0xFB, 0x21, 0x93, 0x61, 0x32,
+    0x35, 0x23, 0x7A, 0x12, 0x4D, 0x82, 0x88, 0x10, 0x33, 0xF6, 0x0D, 0x58, 0x21, 0xF0, 0xB1, 0x8B,
+    0x3B, 0x66, 0x74, 0x6E, 0xF2, 0x06, 0x18, 0xDF, 0x65, 0x5C, 0xE7, 0x26, 0x43, 0x4D, 0x00, 0xEE,
+    0x1F, 0xC4, 0x02, 0x83, 0xDE, 0xE3, 0x05, 0x00, 0x4E, 0x04, 0x91, 0xF4, 0x28, 0xE7, 0x04, 0xFB,
+    0x84, 0x6F, 0xD2, 0x5D, 0x90, 0xFF, 0x06, 0x89, 0xE4, 0x2E, 0xD4, 0x7F, 0xA8, 0x3A, 0xB9, 0x93,
+    0x20, 0xCC, 0x80, 0x53, 0x5E, 0x7E, 0xB0, 0xA0, 0x18, 0xA8, 0x37, 0xFD, 0xEA, 0x78, 0x56, 0xBF,
+    0xB4, 0xCB, 0x22, 0xDF, 0xE5, 0x97, 0x76, 0x1D, 0xB6, 0x55, 0x5D, 0xEF, 0x38, 0x8D, 0x26, 0xDD,
+    0xD9, 0xBE, 0xD0, 0x45, 0xFB, 0xDD, 0xA4, 0x26, 0xB6, 0x67, 0xEE, 0x72, 0x2A, 0x64, 0x30, 0x4C,
+    0x92, 0xE5, 0x17, 0xCC, 0xC0, 0x85, 0xFE, 0x46, 0x91, 0x37, 0x8A, 0x0C, 0x4F, 0x7D, 0xF6, 0x0C,
+    0xAC, 0x53, 0xBD, 0xA0, 0xC9, 0x80, 0x05, 0xF4, 0xFF, 0x06, 0x49, 0x08, 0xCE, 0x0D, 0xE7, 0x8E,
+    0xA3, 0xA0, 0x87, 0x9D, 0xD1, 0x2D, 0x3B, 0x5E, 0x8D, 0xA9, 0xAA, 0xC2, 0x08, 0x3B, 0x68, 0xDF,
+    0x07, 0xB1, 0x20, 0xC3, 0x0E, 0xDA, 0xCB, 0x45, 0xF0, 0x30, 0xDF, 0xE6, 0x55, 0x7A, 0x1B, 0xFA,
+    0xA5, 0xC9, 0xB0, 0x35, 0x94, 0xB9, 0x93, 0xC2, 0xBA, 0x71, 0xC5, 0x5E, 0x45, 0x04, 0xD0, 0x4F,
+    0x3B, 0xBB, 0x9B, 0x04, 0xFA, 0x36, 0x81, 0x93, 0x58, 0x1A, 0x06, 0x11, 0x5B, 0x86, 0x2E, 0xB4,
+    0xB7, 0x63, 0x1F, 0xC4, 0x47, 0xA9, 0x9F, 0xC5, 0x8D, 0x24, 0xE7, 0x2E, 0x64, 0x39, 0xF5, 0x81,
+    0xCA, 0xCB, 0xD9, 0x6A, 0x2F, 0x27, 0x73, 0x72, 0x94, 0xDE, 0x70, 0x50, 0x5E, 0x71, 0xD0, 0x5E,
+    0x12, 0x66, 0x94, 0x84, 0x19, 0xFA, 0x02, 0x5B, 0x81, 0x5E, 0x00, 0xB0, 0xD5, 0x35, 0xEA, 0x11,
+    0x4D, 0x75, 0x3C, 0x0F, 0xF4, 0x33, 0x12, 0x83, 0xB8, 0xCD, 0x59, 0x2D, 0xD6, 0x3B, 0xCF, 0x1A,
+    0xEF, 0xC9, 0xC9, 0x8C, 0xF6, 0x70, 0x6E, 0x53, 0x1F, 0x64, 0x30, 0xDE, 0x8C, 0x05, 0x59, 0xC4,
+    0x2E, 0x28, 0xAF, 0xFD, 0xAF, 0x5A, 0xC8, 0xBD, 0xC7, 0x2A, 0x86, 0x05, 0xE8, 0x71, 0xB5, 0x2F,
+    0xF8, 0x1A, 0x80, 0xE6, 0xEC, 0x45, 0x18, 0x93, 0xC4, 0x6D, 0xCE, 0xF6, 0x2D, 0xF6, 0x49, 0x56,
+    0x10, 0x53, 0x4E, 0xA5, 0xC9, 0x6A, 0xD2, 0xAF, 0x24, 0x91, 0x8C, 0x37, 0xCF, 0x2F, 0x22, 0x9A,
+    0xC1, 0x76, 0xA1, 0x0F, 0x9B, 0x93, 0x15, 0x40, 0x79, 0xB4, 0xA1, 0x9E, 0x66, 0x03, 0x40, 0xCD,
+    0x80, 0x31, 0x03, 0xA0, 0x33, 0x00, 0xB9, 0xFC, 0xFF, 0x32, 0x01, 0xFA, 0xF0, 0x02, 0xF9, 0xE6,
+    0x8C, 0x8E, 0x63, 0xAD, 0x44, 0xD5, 0xBB, 0x12, 0x1F, 0xD2, 0x8B, 0xDB, 0x9C, 0xBB, 0xA2, 0x42,
+    0x9F, 0xAA, 0xDF, 0x95, 0x41, 0x4E, 0x72, 0x56, 0x93, 0x9A, 0x74, 0x25, 0xDA, 0x78, 0x33, 0x9A,
+    0xD1, 0x0C, 0x66, 0xB0, 0xB0, 0x70, 0x10, 0x71, 0x2D, 0x66, 0x94, 0x0D, 0x45, 0xE6, 0x3F, 0x78,
+    0x7C, 0x91, 0x97, 0xDF, 0xE3, 0xE9, 0xC7, 0x6F, 0x33, 0x80, 0xAF, 0x67, 0x98, 0xC9, 0x0E, 0x32,
+    0x28, 0xDF, 0xC5, 0x3E, 0xB4, 0x49, 0x24, 0x10, 0x05, 0x66, 0xB4, 0x83, 0x9A, 0x94, 0xEF, 0xC2,
+    0xAE, 0x9D, 0x70, 0x63, 0x93, 0x04, 0xD1, 0xCF, 0x32, 0xC3, 0x8C, 0x76, 0x41, 0x6E, 0x18, 0xBA,
+    0xD0, 0x5F, 0x9B, 0xB5, 0x37, 0x27, 0x7D, 0x41, 0x32, 0x47, 0x62, 0x17, 0x8A, 0xF4, 0xFA, 0x52,
+    0xB2, 0x28, 0xE2, 0xA3, 0x24, 0x62, 0x7F, 0x7B, 0x96, 0x5E, 0x71, 0xB0, 0x30, 0xA9, 0x5D, 0xE0,
+    0x82, 0x9C, 0x41, 0x6F, 0x06, 0x51, 0x90, 0x6A, 0x64, 0xA3, 0x7C, 0x75, 0x05, 0x9D, 0x8B, 0x80,
+    0xE2, 0x00, 0xD8, 0x35, 0xE0, 0xD9, 0x4C, 0x26, 0xFF, 0xFA, 0x93, 0x59, 0x0D, 0x46, 0x9B, 0xD1,
+    0xD1, 0xC3, 0x46, 0x74, 0x0B, 0xD0, 0x6C, 0xBD, 0x50, 0xDD, 0xA9, 0xD9, 0xC1, 0x29, 0xCF, 0x40,
+    0xB1, 0x40, 0x91, 0x93, 0x5C, 0xFA, 0x24, 0x17, 0xB0, 0x4B, 0xD0, 0xAF, 0x67, 0x74, 0x91, 0x68,
+    0xB2, 0x19, 0x61, 0x4F, 0x4C, 0xD0, 0x6F, 0x46, 0xC8, 0x0F, 0x32, 0xBA, 0x64, 0x87, 0x36, 0xAB,
+    0xD0, 0x50, 0x94, 0x96, 0x83, 0x25, 0xC7, 0x9E, 0x1C, 0x61, 0x37, 0x79, 0xFE, 0x5D, 0x68, 0xD5,
+    0xC9, 0x19, 0x24, 0xC8, 0xE0, 0xB6, 0x93, 0xF1, 0xF6, 0xC4, 0x24, 0xDF, 0x0F, 0xE2, 0xE3, 0xD4,
+    0x64, 0xC2, 0x19, 0x6F, 0x5E, 0x0D, 0xFA, 0x0A, 0x19, 0x34, 0x43, 0xCB, 0xF9, 0x0E, 0x4C, 0x10,
+    0xE4, 0x00, 0xF3, 0xA2, 0x47, 0xCF, 0x69, 0x27, 0xC3, 0x86, 0xBD, 0x85, 0x86, 0x9C, 0x1B, 0x32,
+    0x83, 0xA3, 0xF3, 0x1C, 0x65, 0xB0, 0xBE, 0xCD, 0x7A, 0x82, 0x3D, 0x1A, 0xA0, 0xAE, 0x2E, 0xE8,
+    0x6E, 0x66, 0xB4, 0xD9, 0x0D, 0xA0, 0x9E, 0x60, 0x2F, 0x47, 0xE8, 0x2B, 0x84, 0x0A, 0x66, 0xD6,
+    0xB1, 0x23, 0x17, 0x38, 0x2E, 0x35, 0x50, 0xDA, 0xBC, 0x0E, 0xB6, 0x15, 0xBE, 0x5A, 0xF0, 0x95,
+    0x77, 0xD7, 0xAA, 0x9C, 0x64, 0x90, 0x64, 0x9F, 0xCC, 0x76, 0xEA, 0x6E, 0x66, 0x14, 0x07, 0x63,
+    0xBD, 0xBA, 0x16, 0xFA, 0x0F, 0x93, 0x48, 0xAE, 0xCD, 0x8A, 0x6C, 0xC9, 0xBB, 0x51, 0x55, 0x38,
+    0xED, 0xD1, 0xDD, 0x48, 0xC0, 0x21, 0x39, 0x42, 0x4C, 0x3F, 0xC6, 0x8E, 0xC8, 0x50, 0x2C, 0x68,
+    0xC8, 0x0C, 0xB9, 0xF4, 0x09, 0x1C, 0x65, 0xE8, 0x12, 0xF4, 0xA4, 0x27, 0xD8, 0x81, 0x68, 0xB2,
+    0x58, 0xD0, 0x45, 0x35, 0x41, 0x4F, 0x6E, 0x00, 0xDB, 0x8C, 0x2E, 0x75, 0x11, 0x7A, 0x52, 0xA1,
+    0x21, 0xCC, 0xAC, 0x23, 0x2C, 0x39, 0xC2, 0x71, 0xC1, 0x9D, 0x31, 0xAE, 0xF1, 0xCF, 0x07, 0x09,
+    0x6A, 0x3B, 0xC0, 0x48, 0x8F, 0x1F, 0x3F, 0xB6, 0x32, 0x8B, 0x66, 0x08, 0xA6, 0x4A, 0x01, 0x08,
+    0x84, 0xF1, 0x76, 0xD8, 0x44, 0x72, 0x84, 0x1D, 0x08, 0x07, 0x82, 0x70, 0x6D, 0x86, 0x65, 0x82,
+    0x66, 0xC0, 0x6E, 0xA8, 0xBD, 0x06, 0x65, 0x72, 0xAE, 0x89, 0xF0, 0x1A, 0xCA, 0xB9, 0x4F, 0x2A,
+    0x95, 0x8C, 0x8C, 0x4D, 0xE9, 0x97, 0x26, 0x8B, 0x4A, 0xDC, 0x49, 0x62, 0x11, 0x8B, 0x8C, 0x5D,
+    0x25, 0x3C, 0x8C, 0x92, 0x19, 0xF2, 0x46, 0x86, 0x9C, 0x09, 0x35, 0xB9, 0x41, 0x7B, 0x3B, 0xD6,
+    0x55, 0xA8, 0xE7, 0x9A, 0xCC, 0x55, 0x06, 0x9A, 0xF6, 0x50, 0x1E, 0x72, 0xAC, 0xD6, 0x74, 0x92,
+    0xD7, 0x82, 0x60, 0x6A, 0xF8, 0x33, 0x38, 0x0F, 0x33, 0xED, 0xF2, 0x28, 0x9F, 0xCE, 0x8B, 0xE0,
+    0x3E, 0x81, 0x20, 0x07, 0x49, 0x0E, 0xF6, 0xBB, 0xA5, 0xC9, 0xE2, 0x8E, 0xB1, 0x15, 0xB9, 0x23,
+    0x67, 0xCD, 0x02, 0x72, 0x12, 0xC9, 0x0E, 0x72, 0x26, 0xEC, 0xE3, 0xB9, 0x4D, 0xDD, 0x22, 0x83,
+    0x0C, 0x66, 0xD4, 0x73, 0x81, 0xF1, 0x00, 0xB0, 0x77, 0xD8, 0xC9, 0xE5, 0xD5, 0x08, 0x3C, 0x05,
+    0xE0, 0x5B, 0x7A, 0x30, 0xD6, 0x4B, 0x86, 0x8E, 0xE7, 0x5A, 0x02, 0x1C, 0xEE, 0x4E, 0xC1, 0x08,
+    0x98, 0x11, 0x72, 0xDA, 0xA4, 0x1F, 0xF7, 0x03, 0x7A, 0x84, 0xF4, 0xE8, 0xA7, 0x35, 0x75, 0x00,
+    0xD0, 0x46, 0x3D, 0xC2, 0xE8, 0xB1, 0xD2, 0x52, 0xD6, 0x51, 0xED, 0x79, 0x16, 0x82, 0x1C, 0x40,
+    0x46, 0xD8, 0xEF, 0x16, 0xA8, 0xC9, 0xF8, 0x3E, 0xC8, 0x20, 0x92, 0x58, 0x50, 0x44, 0x86, 0x65,
+    0x81, 0x66, 0x81, 0x64, 0x86, 0x48, 0x76, 0x40, 0x91, 0x01, 0xF6, 0xF1, 0x0C, 0xED, 0xED, 0x28,
+    0x83, 0x0C, 0x62, 0x69, 0x0B, 0x36, 0xC2, 0xAB, 0xD3, 0x09, 0x17, 0x2A, 0x1A, 0xA7, 0x43, 0xB5,
+    0x0B, 0x17, 0x60, 0xAC, 0x17, 0x4C, 0xB0, 0x9F, 0x8C, 0x7D, 0x02, 0x38, 0x7C, 0x2A, 0x81, 0xBB,
+    0x3B, 0xBF, 0xAB, 0xB2, 0x66, 0xC0, 0x0E, 0x90, 0x13, 0xD6, 0xC8, 0x59, 0x95, 0x41, 0x32, 0xB7,
+    0xA4, 0x37, 0xD3, 0x53, 0xDD, 0x02, 0xD8, 0xA1, 0x32, 0x20, 0xE2, 0x5A, 0xFF, 0x1E, 0x20, 0x13,
+    0x60, 0x26, 0x34, 0x05, 0x50, 0xD3, 0x53, 0xB5, 0x0E, 0xE6, 0x18, 0x76, 0xE3, 0xCC, 0x9B, 0x48,
+    0x71, 0x58, 0xEB, 0x51, 0x7D, 0x81, 0x62, 0x90, 0x4C, 0x62, 0xD9, 0xDB, 0x14, 0xC0, 0x54, 0x75,
+    0x73, 0x0B, 0x04, 0x01, 0xE3, 0x87, 0x3E, 0xE8, 0x17, 0x53, 0x7F, 0x87, 0xC2, 0xB7, 0xA9, 0x18,
+    0x49, 0x8E, 0x22, 0x26, 0x9C, 0xAF, 0x08, 0xDE, 0x17, 0x23, 0x9C, 0x4C, 0xE8, 0xE9, 0xFB, 0xB7,
+    0xE3, 0x0A, 0xB0, 0x7C, 0x2E, 0xE1, 0x1A, 0xBE, 0x0B, 0x72, 0xD2, 0x4C, 0x22, 0xEF, 0x1B, 0xEC,
+    0x1A, 0x81, 0x79, 0x08, 0x0E, 0x50, 0xA5, 0x9A, 0xEB, 0x95, 0x05, 0xA2, 0x66, 0x34, 0x79, 0xDF,
+    0x60, 0x26, 0xC7, 0xD4, 0x93, 0xD0, 0x1C, 0xA1, 0x6A, 0x20, 0xD8, 0xCF, 0xC0, 0x45, 0x80, 0x1E,
+    0x32, 0x02, 0x70, 0x73, 0xC7, 0x24, 0x99, 0xE4, 0xBC, 0x5F, 0xCD, 0x55, 0xCE, 0xB1, 0xE5, 0x0C,
+    0x13, 0x20, 0xC3, 0xD0, 0x87, 0x8B, 0x2E, 0x38, 0x7A, 0x5B, 0x20, 0x66, 0x74, 0x11, 0x48, 0x68,
+    0x12, 0xCC, 0xB2, 0xD6, 0xCF, 0x81, 0xD4, 0x4F, 0x4D, 0xCA, 0x68, 0x39, 0x6D, 0x1C, 0x67, 0xC3,
+    0x77, 0x61, 0x18, 0x5B, 0xD2, 0xCB, 0xF8, 0xEB, 0xB0, 0x35, 0xFB, 0xE9, 0xD6, 0xA2, 0xBC, 0x2A,
+    0x80, 0xCA, 0x15, 0x2B, 0x95, 0xB1, 0xD6, 0x28, 0xED, 0xF0, 0x94, 0xC8, 0x2D, 0x19, 0x7A, 0x12,
+    0xFD, 0x2E, 0x23, 0x99, 0xFA, 0x59, 0xBE, 0x36, 0xB7, 0x9C, 0x61, 0xE6, 0xCF, 0x35, 0x6C, 0x8A,
+    0x0C, 0x8E, 0xDC, 0x26, 0xCB, 0xDE, 0x13, 0x37, 0x8F, 0xFD, 0x35, 0x62, 0xE3, 0x1A, 0x40, 0x37,
+    0xBB, 0xBE, 0x74, 0xA0, 0x66, 0x72, 0xED, 0x02, 0xF4, 0x33, 0x04, 0x87, 0x3A, 0x70, 0x4F, 0x41,
+    0x8E, 0x6D, 0x84, 0xFB, 0x4B, 0xCB, 0x37, 0x99, 0xD7, 0xC0, 0xBD, 0xBD, 0x13, 0xB8, 0x47, 0xB8,
+    0x7F, 0xD5, 0x71, 0xD2, 0x09, 0x0B, 0xD4, 0x04, 0x03, 0x11, 0x64, 0xD9, 0x24, 0xAE, 0xBA, 0x5D,
+    0x90, 0x0A, 0x3A, 0x8E, 0xEB, 0x9D, 0x59, 0xF2, 0x55, 0x32, 0x91, 0xFC, 0xC7, 0x27, 0x6E, 0x1E,
+    0xFB, 0x8C, 0x78, 0xBB, 0xAE, 0xA3, 0x5D, 0x30, 0x51, 0x58, 0x15, 0x0E, 0x6D, 0x02, 0x00, 0x33,
+    0x40, 0xF9, 0x7D, 0x47, 0xBD, 0x78, 0x67, 0x6A, 0x23, 0x5A, 0xBE, 0xD0, 0x31, 0xB7, 0xE4, 0xF0,
+    0x69, 0x2C, 0x67, 0xDD, 0xCE, 0x80, 0xFB, 0x57, 0x50, 0x1C, 0x5A, 0xFA, 0x5F, 0x3C, 0x50, 0xCD,
+    0xC9, 0x9F, 0xD4, 0x42, 0x03, 0x67, 0x41, 0x0E, 0xBF, 0x60, 0xA0, 0xF0, 0xEB, 0xC0, 0x82, 0x7E,
+    0x82, 0xFB, 0x4B, 0xC5, 0xE8, 0x38, 0x99, 0xB1, 0xC9, 0xF8, 0xED, 0x4F, 0x0E, 0x93, 0x1D, 0x97,
+    0x15, 0xA3, 0x19, 0x5A, 0xBE, 0xDC, 0x71, 0xEA, 0xB9, 0xDA, 0xAD, 0x87, 0xD0, 0xF2, 0x3A, 0x70,
+    0x9B, 0x23, 0x9E, 0x56, 0x6B, 0xDD, 0x63, 0x63, 0xA8, 0x66, 0x91, 0xBA, 0x08, 0xB6, 0x09, 0x66,
+    0x24, 0xD4, 0x64, 0xC6, 0x3E, 0xA8, 0x59, 0xA4, 0x3E, 0xA2, 0xB4, 0x09, 0xF6, 0xAE, 0x9D, 0xDD,
+    0xD2, 0x14, 0xF0, 0x30, 0x61, 0xC8, 0x51, 0x90, 0x23, 0xF4, 0x1A, 0x66, 0xFC, 0x3C, 0x0C, 0xB7,
+    0x85, 0x1F, 0xC9, 0x59, 0x5E, 0xC9, 0x4D, 0x52, 0xFE, 0x4E, 0xF8, 0xD2, 0x45, 0x3B, 0xB8, 0x2E,
+    0xC8, 0xE0, 0x9A, 0xD2, 0x07, 0x33, 0x3B, 0x66, 0xC1, 0x6B, 0x5E, 0xC5, 0x5A, 0x8C, 0x68, 0xB7,
+    0xCE, 0xA2, 0x65, 0xC2, 0xA6, 0xAC, 0xD0, 0x26, 0xD8, 0x81, 0xD0, 0xDE, 0x8C, 0x32, 0xA8, 0x49,
+    0xA4, 0x3E, 0xA0, 0x88, 0x04, 0x3B, 0x94, 0xD5, 0x7E, 0xEA, 0x49, 0x2C, 0x7D, 0x68, 0xEE, 0xDE,
+    0xA9, 0xE6, 0x6E, 0x11, 0xB9, 0x4B, 0x20, 0x0B, 0x6A, 0x12, 0xB4, 0x09, 0xA6, 0x1F, 0xDE, 0x42,
+    0xC7, 0x00, 0x47, 0x00, 0xB8, 0xE7, 0xEC, 0x3D, 0x67, 0x0A, 0xB2, 0x9A, 0xD4, 0xA5, 0xB4, 0x0B,
+    0x5C, 0xB4, 0x4F, 0xC4, 0x3E, 0x58, 0xB0, 0x0F, 0x6A, 0x76, 0xA2, 0xF4, 0xE4, 0x64, 0x72, 0x6A,
+    0x78, 0xF4, 0x0E, 0x83, 0x46, 0xCC, 0x1A, 0x70, 0x6E, 0x80, 0xE4, 0x08, 0x5C, 0xAC, 0x83, 0xA0,
+    0x7D, 0x17, 0x65, 0x68, 0x93, 0x58, 0xC0, 0x26, 0xC3, 0x78, 0x07, 0x39, 0x1B, 0xDF, 0x45, 0x39,
+    0xB7, 0xA9, 0x5B, 0xC0, 0x36, 0xC3, 0x8C, 0x0E, 0xEA, 0xAE, 0x9D, 0x4D, 0x81, 0x1D, 0xCD, 0x64,
+    0xBD, 0x24, 0x67, 0x90, 0x73, 0x8D, 0x8B, 0x76, 0xC2, 0x80, 0xF1, 0xD9, 0xBB, 0xD1, 0xBD, 0xCF,
+    0x29, 0xF4, 0xA9, 0x8A, 0xE4, 0xE0, 0xD1, 0x47, 0x81, 0xFE, 0x9B, 0x03, 0x1A, 0xFA, 0xEA, 0x20,
+    0x01, 0xF4, 0xA1, 0xC9, 0x6B, 0x35, 0xD8, 0x6C, 0xAA, 0xC1, 0x8B, 0x0C, 0x4D, 0x16, 0x0B, 0x5C,
+    0x53, 0x60, 0xBC, 0x1B, 0xE4, 0xAC, 0x7D, 0x77, 0xF7, 0x4E, 0x3B, 0xAA, 0x59, 0x46, 0x15, 0x04,
+    0xB9, 0xC0, 0x70, 0x41, 0xBB, 0xC3, 0xAF, 0xFA, 0xAB, 0xB8, 0x5F, 0x9F, 0x4B, 0x2B, 0xEA, 0x19,
+    0x6F, 0x66, 0x20, 0x9B, 0x01, 0xA6, 0x9F, 0xD0, 0x9D, 0x9E, 0xEF, 0xE8, 0x87, 0xF1, 0x2B, 0x00,
+    0x6E, 0x07, 0x19, 0xFA, 0x80, 0x02, 0x42, 0x4D, 0x72, 0x6E, 0x53, 0x53, 0x60, 0xBC, 0x9E, 0xC4,
+    0xD2, 0x26, 0xD8, 0xD1, 0xF8, 0x2E, 0x8A, 0x05, 0x0E, 0x76, 0x94, 0xA1, 0x5B, 0x9A, 0x02, 0x33,
+    0x59, 0x2F, 0xC8, 0xA5, 0xEA, 0xC8, 0x8E, 0x2E, 0xD7, 0x19, 0x5E, 0x0A, 0xE4, 0xD5, 0x05, 0xFA,
+    0x9B, 0x13, 0x9E, 0x91, 0xD8, 0x8C, 0xBC, 0x9C, 0xE5, 0xA4, 0x26, 0xE5, 0x95, 0xDF, 0x9D, 0x86,
+    0xD8, 0xC1, 0x0E, 0xB5, 0x74, 0xEC, 0x9A, 0x02, 0x27, 0x0A, 0x1C, 0x33, 0x4C, 0x4E, 0xD8, 0xD1,
+    0xEC, 0x2F, 0x52, 0x93, 0x45, 0xA8, 0xC8, 0x4F, 0x13, 0x51, 0x95, 0x4F, 0x05, 0xAC, 0x36, 0xEA,
+    0x73, 0x29, 0xC8, 0xCA, 0x09, 0xD7, 0x95, 0xE6, 0xA2, 0xC3, 0xDD, 0x34, 0x17, 0xC0, 0xCE, 0x00,
+    0x3A, 0x7A, 0x00, 0x56, 0x79, 0x40, 0xCC, 0x6A, 0x1D, 0xAA, 0x7E, 0x6E, 0x12, 0xCC, 0x49, 0x2F,
+    0x43, 0x9B, 0x1C, 0xAC, 0x97, 0x6F, 0xA7, 0x96, 0xB0, 0x7D, 0x90, 0x49, 0x24, 0xED, 0x5D, 0x50,
+    0x93, 0x13, 0xB7, 0xBD, 0x6B, 0x93, 0x7E, 0xF1, 0x48, 0xEC, 0x42, 0xBA, 0xA0, 0xBD, 0xBA, 0xFC,
+    0x76, 0x2C, 0xB0, 0xE6, 0x9B, 0x6F, 0x84, 0x26, 0x27, 0x6D, 0xC7, 0xEE, 0xF6, 0x74, 0x21, 0x41,
+    0xB1, 0xBD, 0x1D, 0x60, 0x63, 0xCF, 0xA1, 0xA1, 0x57, 0x09, 0x5D, 0x81, 0x9D, 0x20, 0xC3, 0xA6,
+    0xE8, 0x09, 0xC0, 0x4D, 0xA8, 0xF4, 0xB2, 0xFE, 0xED, 0x05, 0x50, 0xC3, 0xF9, 0x0D, 0xDF, 0x6B,
+    0x0B, 0x5B, 0xB6, 0x61, 0x93, 0xAD, 0x60, 0x9B, 0x6C, 0x47, 0x11, 0x6D, 0x7F, 0xBD, 0x0F, 0x46,
+    0xBE, 0x28, 0x67, 0xA3, 0x4F, 0x2A, 0x6F, 0x8C, 0x36, 0xA3, 0x79, 0x4E, 0x5B, 0x98, 0xF3, 0xFA,
+    0x22, 0xCC, 0xA2, 0x13, 0x4C, 0xD0, 0x0B, 0xCC, 0xAC, 0x03, 0xCC, 0xA4, 0xE7, 0x9D, 0x2B, 0xF4,
+    0xF4, 0xB8, 0xA8, 0xC6, 0x6E, 0x0D, 0x23, 0xBE, 0x08, 0x5A, 0xE8, 0x06, 0x47, 0x85, 0xC9, 0x95,
+    0xD6, 0x74, 0x68, 0x83, 0x37, 0xFC, 0x4A, 0x28, 0x77, 0xCF, 0x3C, 0x0A, 0xF1, 0x41, 0x82, 0x7C,
+    0x75, 0xC6, 0xFE, 0xBD, 0xAB, 0xF6, 0x99, 0xCB, 0xB1, 0xCD, 0x72, 0x56, 0xC1, 0x78, 0xC2, 0xF5,
+    0xB1, 0xC9, 0x66, 0x14, 0x1F, 0x27, 0x48, 0x4E, 0xD0, 0xA5, 0x4A, 0xC7, 0xE1, 0x33, 0x7D, 0xF5,
+    0x5D, 0xC4, 0xD4, 0xCF, 0xCA, 0x20, 0x98, 0x41, 0xE6, 0x86, 0x4C, 0x38, 0x7E, 0x22, 0x02, 0x7A,
+    0x06, 0x5C, 0xAD, 0x56, 0x8B, 0x5C, 0xC1, 0x04, 0x1D, 0x2A, 0x01, 0x66, 0xDD, 0xD5, 0xAF, 0x7C,
+    0x19, 0x43, 0x8E, 0x96, 0x1C, 0x1D, 0xD7, 0xC5, 0x27, 0x6A, 0x38, 0xAE, 0xAB, 0x52, 0x02, 0xD8,
+    0xDA, 0x1A, 0x15, 0x97, 0x96, 0x1C, 0xA1, 0x2A, 0xF0, 0xC8, 0x01, 0x7A, 0x42, 0xBF, 0xA0, 0x29,
+    0x3B, 0x94, 0x18, 0x72, 0x34, 0x5C, 0x3A, 0xEE, 0xB8, 0xA3, 0x61, 0x07, 0x60, 0xAE, 0x25, 0x84,
+    0x2F, 0x56, 0xCA, 0x53, 0x9B, 0x0B, 0x37, 0x67, 0x01, 0xE0, 0x9E, 0xAD, 0x73, 0x1D, 0x4B, 0x4B,
+    0x8E, 0xB0, 0x15, 0x44, 0x9B, 0xA0, 0x27, 0xE8, 0x19, 0x6A, 0xDE, 0x60, 0x95, 0x2C, 0x82, 0x3C,
+    0xCD, 0xD5, 0xB4, 0xB7, 0x51, 0x8D, 0x30, 0x27, 0xD7, 0x64, 0xC2, 0x6D, 0x92, 0x09, 0x4E, 0x82,
+    0x8C, 0x0D, 0x99, 0x70, 0xFF, 0xDF, 0xC9, 0x95, 0x9D, 0xDB, 0x12, 0xB5, 0xEE, 0xCF, 0xA1, 0xA6,
+    0x1D, 0xCE, 0xAF, 0x5C, 0x22, 0x5F, 0xF9, 0xBA, 0x7A, 0xAE, 0x52, 0x4A, 0x72, 0xEE, 0x2A, 0x3D,
+    0x6E, 0x8D, 0x12, 0x17, 0xE5, 0xDB, 0x8F, 0x12, 0x04, 0x3D, 0xFA, 0x6A, 0x1D, 0xEE, 0xD9, 0x3A,
+    0x07, 0xCB, 0xB9, 0x25, 0xC7, 0x0D, 0x03, 0x5A, 0x64, 0x40, 0x4F, 0x68, 0x4B, 0x0D, 0x14, 0xB9,
+    0xA2, 0x91, 0x9C, 0x05, 0x39, 0xAA, 0x1D, 0x8E, 0x92, 0x9B, 0x20, 0x39, 0xC0, 0xA5, 0xAA, 0x22,
+    0x9F, 0x09, 0xBF, 0x77, 0xA1, 0x6A, 0x64, 0xF9, 0x39, 0xF8, 0x5D, 0x56, 0x9A, 0xDC, 0x66, 0x6D,
+    0x58, 0x0F, 0x93, 0x01, 0xCE, 0x6B, 0x40, 0x2B, 0x16, 0xE5, 0x2F, 0xB4, 0x33, 0xD0, 0x2F, 0x72,
+    0x36, 0xC3, 0x85, 0xB5, 0x68, 0x6A, 0xB2, 0x88, 0xE9, 0x10, 0xA2, 0x1C, 0x03, 0xF9, 0xEA, 0xF5,
+    0x7C, 0xA0, 0x9F, 0x1E, 0xD8, 0xFA, 0x01, 0xDF, 0x61, 0x04, 0x1A, 0xF2, 0x7D, 0xF2, 0x77, 0xB7,
+    0xCE, 0x01, 0x62, 0x7A, 0xCC, 0xBC, 0x78, 0x89, 0xCB, 0xBE, 0x5B, 0x80, 0x7C, 0xED, 0xE3, 0xF4,
+    0xB5, 0xDA, 0x2A, 0x74, 0x35, 0x1C, 0x3B, 0xF6, 0xF0, 0x13, 0xE5, 0xDF, 0x0D, 0x87, 0xF4, 0xF6,
+    0x0C, 0xA8, 0x89, 0xAF, 0x3E, 0xF1, 0x07, 0x8F, 0x9A, 0xF0, 0x9F, 0x02, 0x40, 0x17, 0x8B, 0xBC,
+    0x1A, 0xF5, 0x37, 0xA7, 0x67, 0x54, 0x25, 0x4E, 0x5D, 0xBA, 0x95, 0x04, 0x7D, 0x97, 0xB0, 0xB7,
+    0x7B, 0x25, 0x2C, 0x07, 0xD5, 0x13, 0x97, 0xCE, 0xEE, 0xD9, 0x2B, 0xBF, 0xBF, 0x7D, 0xF5, 0xAD,
+    0x10, 0xCF, 0xAF, 0x8A, 0x9E, 0x6D, 0x93, 0x2E, 0xB4, 0x21, 0xB5, 0x53, 0xC0, 0x80, 0x04, 0xF3,
+    0xEF, 0xFC, 0xCB, 0xBF, 0xFF, 0x63, 0x25, 0x39, 0x5C, 0xAC, 0xEB, 0x5B, 0x73, 0xFB, 0xA7, 0x17,
+    0x9E, 0x11, 0x53, 0x13, 0xA5, 0xB7, 0x22, 0x6A, 0x5F, 0x9A, 0x63, 0x10, 0x51, 0xF9, 0x22, 0x82,
+    0x1E, 0x53, 0x33, 0x20, 0xE7, 0x7C, 0xE1, 0xB9, 0x83, 0xFB, 0xEF, 0xDA, 0x87, 0x3E, 0x98, 0x21,
+    0x75, 0x1E, 0x10, 0x49, 0x06, 0xED, 0x0F, 0x01, 0xC3, 0xBD, 0xBF, 0x7D, 0x35, 0x09, 0xBF, 0x7F,
+    0x8F, 0xF0, 0x87, 0xBE, 0x97, 0x5E, 0xDA, 0x0B, 0x57, 0xBE, 0xFD, 0x3F, 0xE2, 0x11, 0x1C, 0xC0,
+    0x37, 0xF0, 0x75, 0x7C, 0x07, 0x68, 0xB3, 0x48, 0x5D, 0x34, 0xB3, 0x1D, 0x9E, 0x44, 0xD3, 0x6D,
+    0x4F, 0xF3, 0xC1, 0x6E, 0x40, 0xE3, 0x7B, 0x3C, 0x27, 0x33, 0x60, 0xFE, 0xE2, 0x93, 0x7B, 0x31,
+    0x03, 0x0D, 0xBE, 0x73, 0xF2, 0x8F, 0xCB, 0xBD, 0x38, 0x73, 0xFF, 0x31, 0xCE, 0x00, 0xF6, 0x23,
+    0x21, 0x35, 0xA9, 0x5D, 0x74, 0x30, 0xB3, 0x19, 0xEF, 0x17, 0xC1, 0x76, 0xF3, 0xC5, 0xBE, 0x98,
+    0xF9, 0x47, 0x7B, 0xE5, 0x7B, 0x4B, 0xDE, 0x83, 0x87, 0xFA, 0xA3, 0x97, 0x3F, 0xBC, 0xB1, 0x1C,
+    0xDB, 0xDF, 0xCF, 0x7C, 0x67, 0xFB, 0x35, 0xA9, 0x17, 0x3D, 0xEC, 0x3D, 0x9C, 0xCC, 0x91, 0xF9,
+    0x29, 0xF4, 0xA3, 0x1D, 0x0C, 0x92, 0x7B, 0xBB, 0xA0, 0x7F, 0x25, 0x3C, 0xD7, 0xBD, 0x6B, 0x5F,
+    0x4F, 0xC0, 0xDE, 0x7E, 0x7B, 0x8E, 0x07, 0x55, 0xFF, 0xCA, 0x19, 0xC3, 0xF7, 0x7E, 0x76, 0xF1,
+    0xA5, 0xE6, 0x1A, 0x1E, 0x39, 0xD6, 0x0C, 0xF7, 0xDD, 0xF7, 0x15, 0x29, 0x0D, 0xFD, 0xB1, 0x63,
+    0x00, 0x16, 0xF9, 0xCA, 0x66, 0x74, 0x01, 0x74, 0x84, 0xC9, 0x5D, 0x48, 0x87, 0x9A, 0x08, 0x88,
+    0xE9, 0xD0, 0xCE, 0xDC, 0xED, 0x1E, 0xC2, 0xDD, 0x65, 0xD8, 0x75, 0xCE, 0x0D, 0x8B, 0x65, 0xD9,
+    0x7B, 0xFC, 0xB8, 0x20, 0xFD, 0xF1, 0xE3, 0x03, 0x00, 0xC3, 0x7C, 0xCF, 0xD6, 0xD6, 0x5A, 0xB3,
+    0x35, 0x2E, 0x1C, 0xE8, 0x47, 0xA0, 0x21, 0x6F, 0x93, 0xFF, 0xED, 0xD6, 0xB9, 0xFB, 0x8F, 0x1F,
+    0x3F, 0xFE, 0xA4, 0x21, 0x99, 0x0C, 0xC9, 0x3B, 0xB1, 0xC4, 0x8F, 0x61, 0xBD, 0x0E, 0x3A, 0x8A,
+    0x05, 0xBF, 0xB1, 0xEE, 0x3A, 0x0F, 0x20, 0x00, 0x62, 0x06, 0x3A, 0x0F, 0xC8, 0x11, 0xD0, 0x00,
+    0x0E, 0x7E, 0xC6, 0xA1, 0xE1, 0x97, 0x1E, 0xDA, 0x0F, 0x00, 0x07, 0xB5, 0x7C, 0xEC, 0xC7, 0xF8,
+    0x3A, 0xFE, 0xD9, 0x70, 0xEF, 0xD3, 0x78, 0x93, 0xE9, 0xF8, 0xF1, 0x61, 0xEF, 0xF1, 0x23, 0x2C,
+    0x5F, 0xC7, 0x1B, 0xF8, 0x8D, 0x3F, 0xFF, 0xD3, 0x7F, 0xB9, 0x75, 0xAE, 0x39, 0xFC, 0x38, 0xCB,
+    0x77, 0x5E, 0xFA, 0x9F, 0x9B, 0x06, 0xF8, 0xE7, 0x97, 0xB2, 0x98, 0xFF, 0xD1, 0x74, 0x18, 0x38,
+    0xF3, 0x9C, 0x44, 0xE8, 0x86, 0x6F, 0xE8, 0x76, 0xB8, 0xFF, 0xF8, 0x93, 0x86, 0xE9, 0xFE, 0xE3,
+    0xC7, 0x2A, 0xE3, 0x67, 0x6B, 0xEB, 0x2C, 0xFA, 0x60, 0xC6, 0xD4, 0x4D, 0x80, 0xBE, 0x92, 0xE5,
+    0x74, 0xFE, 0xAE, 0x3B, 0xDF, 0xAF, 0xFF, 0x45, 0x3C, 0xF0, 0x20, 0x80, 0xBD, 0xC7, 0xDA, 0x2B,
+    0xE5, 0x6B, 0x56, 0xBF, 0xF6, 0xE6, 0x3B, 0x21, 0xED, 0x7F, 0xB6, 0xC1, 0xDE, 0x36, 0x9A, 0x23,
+    0x49, 0x79, 0x00, 0x9A, 0xE5, 0xE0, 0xF1, 0x3F, 0xF8, 0x06, 0x1E, 0xF9, 0x3A, 0x1E, 0x01, 0xF0,
+    0xF3, 0x97, 0xD8, 0xB3, 0xE7, 0xE0, 0xA1, 0x67, 0x0F, 0x9E, 0x7F, 0x36, 0x3D, 0x0B, 0x3C, 0xF0,
+    0x5F, 0xE5, 0x66, 0x7A, 0x44, 0x78, 0x00, 0xFF, 0xF6, 0x3F, 0x56, 0xF1, 0xEA, 0xF5, 0xF4, 0x9F,
+    0xFD, 0xDF, 0xD8, 0x0F, 0xEC, 0x47, 0xB3, 0xA0, 0x9B, 0x71, 0x7C, 0x8F, 0x0C, 0xE1, 0x7F, 0xE1,
+    0x91, 0xC3, 0x2F, 0xE3, 0x59, 0x88, 0x88, 0xCE, 0xA3, 0x19, 0xBE, 0xAA, 0x3F, 0xBE, 0xF4, 0x46,
+    0x6A, 0x9A, 0x41, 0x5E, 0x99, 0x58, 0x44, 0xED, 0xEA, 0xF9, 0xEA, 0xEF, 0xA9, 0x17, 0x9F, 0x67,
+    0xBA, 0xE7, 0xD7, 0x00, 0xA0, 0xFB, 0x5E, 0x7C, 0xE9, 0xC0, 0xBD, 0xA0, 0x48, 0xB2, 0x9C, 0x79,
+    0x60, 0xF8, 0x4F, 0x26, 0x00, 0xCF, 0xE1, 0x77, 0x8F, 0x75, 0xB8, 0x7F, 0xEF, 0x80, 0x7D, 0xF8,
+    0x32, 0x9A, 0x01, 0xFB, 0x7F, 0x6D, 0x3F, 0x9A, 0x27, 0x5E, 0x07, 0xBE, 0xF4, 0xDC, 0x57, 0x81,
+    0xEF, 0x4D, 0xC0, 0x9E, 0xEF, 0x7C, 0x0D, 0xCD, 0x88, 0x63, 0x38, 0x86, 0xBD, 0xC3, 0xFD, 0x98,
+    0xBE, 0xFC, 0x3F, 0xE0, 0x39, 0x00, 0xDD, 0x4F, 0x9B, 0x27, 0xF7, 0xBA, 0x60, 0x3C, 0xC7, 0xC7,
+    0x0E, 0xDF, 0x48, 0x33, 0xB0, 0xF7, 0xD0, 0x33, 0x2F, 0x9F, 0x3F, 0x00, 0xEC, 0x87, 0x8D, 0xEA,
+    0xFA, 0xF6, 0xF4, 0xE8, 0x37, 0x6E, 0x4D, 0x6A, 0xC4, 0x4B, 0xC0, 0x6F, 0xBC, 0x11, 0xD3, 0xFF,
+    0xFA, 0x5F, 0x0C, 0xED, 0x89, 0x57, 0x4F, 0x9F, 0x6F, 0x87, 0xAF, 0xF7, 0xF3, 0xB3, 0x17, 0xBF,
+    0x8E, 0xE9, 0x9E, 0x6E, 0x8E, 0xF2, 0xC4, 0xF7, 0xDE, 0xF9, 0xEF, 0xA6, 0xEF, 0x4C, 0xE8, 0x4F,
+    0x87, 0x03, 0x5A, 0x01, 0x50, 0xAF, 0x7D, 0x98, 0xBE, 0x06, 0xE0, 0xA5, 0x7F, 0xFF, 0xF5, 0x5B,
+    0xFA, 0xD2, 0x7F, 0x83, 0x46, 0x94, 0xFC, 0x9D, 0xF0, 0xE7, 0x7D, 0xF7, 0x9F, 0xDF, 0x7C, 0xFB,
+    0xD6, 0xF2, 0xD5, 0xDF, 0xE8, 0x6F, 0xFD, 0x3D, 0x51, 0x8B, 0x7C, 0x8B, 0x05, 0xFA, 0xA0, 0x3F,
+    0xF9, 0x5D, 0x8E, 0x1D, 0x99, 0x81, 0x93, 0x3C, 0x83, 0x83, 0x00, 0x9E, 0x33, 0x23, 0xBA, 0x28,
+    0xCB, 0xEF, 0xB8, 0xA9, 0x25, 0x0B, 0xF0, 0x15, 0x9E, 0xC5, 0xC3, 0x5B, 0x5B, 0xFF, 0x8C, 0x2C,
+    0x96, 0x9C, 0xD6, 0x3F, 0x0D, 0x39, 0xB5, 0x7C, 0x01, 0x52, 0x90, 0xE5, 0xC5, 0xE7, 0x6F, 0xBD,
+    0x48, 0x8E, 0x33, 0xF6, 0x5D, 0x1C, 0x80, 0xE3, 0x03, 0x70, 0x92, 0x05, 0x82, 0xE4, 0x24, 0x23,
+    0xBE, 0x12, 0x0C, 0x80, 0xF4, 0xE4, 0x46, 0xCB, 0x6A, 0x63, 0x64, 0xBB, 0xB5, 0xB5, 0xF5, 0xE2,
+    0x25, 0xB2, 0x76, 0x0D, 0xD5, 0xEE, 0x81, 0xFB, 0x00, 0x1C, 0xBA, 0xFA, 0xE6, 0x83, 0x8F, 0x3C,
+    0x7D, 0x83, 0xA7, 0xFF, 0x4B, 0x00, 0xFA, 0x95, 0x37, 0x8E, 0xFE, 0xF8, 0xDF, 0xC3, 0x27, 0xC3,
+    0x53, 0x40, 0x33, 0xDD, 0x77, 0xE0, 0xDE, 0xEE, 0x71, 0x1F, 0xF6, 0x03, 0x30, 0x47, 0x5E, 0x7D,
+    0xF0, 0x91, 0xA7, 0xC3, 0xED, 0xE1, 0x2C, 0x1E, 0xF9, 0xFA, 0x8D, 0xAB, 0xDF, 0x7F, 0xF0, 0x80,
+    0x9D, 0xFF, 0x23, 0xA0, 0x49, 0xCF, 0x7C, 0x13, 0xA1, 0x7F, 0xE1, 0xD7, 0x01, 0xE0, 0x11, 0x7C,
+    0x43, 0xBE, 0x7C, 0xE0, 0xA5, 0xA7, 0x5F, 0x7A, 0x3A, 0xD8, 0xF9, 0x6F, 0x0C, 0xC0, 0x37, 0x9A,
+    0xA9, 0x3F, 0x7F, 0xF0, 0xA5, 0xB7, 0x2F, 0x1F, 0x7D, 0xE4, 0x1B, 0xC7, 0x46, 0xA0, 0xB9, 0x76,
+    0xEA, 0xB1, 0x67, 0x3F, 0xBC, 0x7C, 0xF4, 0x1B, 0x2F, 0xBD, 0x73, 0xF4, 0xC1, 0xAF, 0xFE, 0x87,
+    0x23, 0xDA, 0xFF, 0xF7, 0xD0, 0x91, 0xF1, 0xE9, 0x1E, 0xC7, 0x00, 0xF1, 0x7C, 0x7A, 0xE9, 0xC0,
+    0xBD, 0x62, 0x7E, 0x6A, 0x7E, 0xFF, 0x91, 0xFF, 0xE9, 0x89, 0x97, 0x9E, 0x6D, 0x87, 0xFE, 0x21,
+    0xF1, 0xE3, 0x76, 0xEE, 0xC2, 0x43, 0x4F, 0xEF, 0xFF, 0xCD, 0x0A, 0x22, 0x4C, 0x15, 0x1C, 0xDF,
+    0xAC, 0x2C, 0xA0, 0xBF, 0x43, 0xB1, 0xEB, 0x6E, 0x1D, 0xBF, 0xAB, 0x8B, 0x60, 0x37, 0x45, 0xF0,
+    0xC9, 0xDD, 0x21, 0x57, 0xED, 0x8A, 0x0D, 0x82, 0xF4, 0x8A, 0x05, 0x96, 0x7C, 0x9B, 0xE4, 0x51,
+    0x32, 0xDD, 0x6F, 0x7F, 0x72, 0xEC, 0xAE, 0xAA, 0x30, 0x47, 0x41, 0x4E, 0x92, 0xF4, 0xE6, 0x34,
+    0x0F, 0x67, 0x94, 0x3E, 0x88, 0xC5, 0x78, 0x35, 0x17, 0xF0, 0x89, 0xC8, 0xA4, 0xB7, 0xE9, 0x9D,
+    0xDC, 0x95, 0x7F, 0xC0, 0x54, 0xB6, 0x88, 0xF2, 0x9B, 0x7E, 0x89, 0x4F, 0x49, 0xA8, 0xFC, 0xDD,
+    0xED, 0x3F, 0x77, 0x07, 0x50, 0xF9, 0x6E, 0x44, 0x64, 0xA9, 0x2E, 0xF4, 0xE7, 0xA8, 0xC4, 0x05,
+    0x77, 0xA8, 0xC4, 0x1E, 0x30, 0x3F, 0x3B, 0x07, 0xCB, 0x04, 0xCB, 0x04, 0xB7, 0xF5, 0xC2, 0x5F,
+    0x8B, 0x4A, 0xDC, 0x30, 0xFE, 0xD5, 0x10, 0x56, 0xFE, 0x39, 0x08, 0xAB, 0x7C, 0x0A, 0xC2, 0xC2,
+    0xA6, 0x38, 0x3E, 0x77, 0xB1, 0x4D, 0x20, 0xCC, 0xA8, 0x76, 0xFD, 0x39, 0xF5, 0x51, 0x6C, 0xFE,
+    0x04, 0x80, 0xEE, 0x8D, 0x49, 0xBF, 0x38, 0x9E, 0x3F, 0x8F, 0x61, 0xA8, 0xC1, 0xB2, 0xF1, 0x28,
+    0xE8, 0x22, 0xB4, 0xAF, 0xA4, 0x11, 0x39, 0x57, 0x9E, 0xC3, 0x86, 0x34, 0xD2, 0x85, 0x9D, 0x43,
+    0x6A, 0xC2, 0xA7, 0x41, 0x4C, 0xFB, 0x57, 0x90, 0x54, 0xCC, 0x67, 0x55, 0x4C, 0xEB, 0xE1, 0x2E,
+    0xC1, 0x70, 0x14, 0x0C, 0x30, 0x4B, 0x55, 0xFB, 0x86, 0x8C, 0x00, 0x6A, 0x18, 0x64, 0x48, 0x00,
+    0xEA, 0x27, 0xD6, 0xA3, 0x76, 0x06, 0x42, 0x2C, 0x22, 0x02, 0xC8, 0x4D, 0x39, 0x06, 0x58, 0x38,
+    0x8E, 0xD0, 0xDE, 0x30, 0x41, 0xCE, 0xF2, 0x36, 0xC7, 0xDA, 0xA9, 0x5A, 0xBB, 0x57, 0x51, 0x11,
+    0x75, 0x3B, 0x1A, 0x6F, 0xFE, 0x77, 0xEB, 0xE5, 0x6C, 0xAF, 0x72, 0xEE, 0xC8, 0xC0, 0xD0, 0x92,
+    0xB3, 0x99, 0x41, 0x9E, 0xD9, 0x49, 0x4E, 0x56, 0x20, 0x89, 0x40, 0x2D, 0x6D, 0xDA, 0xA1, 0x4A,
+    0xEF, 0x00, 0x19, 0x2A, 0xC2, 0x24, 0x03, 0x1A, 0xB2, 0x76, 0xD2, 0x91, 0x5E, 0x93, 0xA4, 0x27,
+    0xCC, 0x25, 0x8A, 0x05, 0xA5, 0xCD, 0x6A, 0xEA, 0x62, 0x1F, 0xDD, 0xA0, 0x27, 0xF3, 0x4A, 0x82,
+    0x6B, 0x29, 0x83, 0x20, 0x83, 0x19, 0x25, 0x79, 0x38, 0xC3, 0xF2, 0xCC, 0x2F, 0xD6, 0xEA, 0x33,
+    0x62, 0xED, 0x78, 0x33, 0xA7, 0x79, 0x3A, 0x37, 0xA5, 0x0F, 0x5D, 0x34, 0x5E, 0x4D, 0x05, 0xAE,
+    0x8B, 0x22, 0x69, 0x2F, 0x67, 0x57, 0x2B, 0xCA, 0x40, 0x8D, 0xF7, 0xEA, 0x58, 0x60, 0xD3, 0x05,
+    0x57, 0x6F, 0x43, 0x86, 0x7E, 0x41, 0x69, 0x2A, 0x9C, 0xDD, 0x26, 0x19, 0x60, 0x5E, 0xC9, 0x10,
+    0x8B, 0x1D, 0x61, 0x18, 0xD0, 0xD5, 0xB6, 0x34, 0x0F, 0xF9, 0x51, 0x06, 0x8A, 0x0C, 0x50, 0x13,
+    0xD1, 0xE4, 0x6E, 0x81, 0xF6, 0xC6, 0xAF, 0xCC, 0x08, 0x35, 0x77, 0x11, 0x9B, 0xDC, 0xAD, 0x0F,
+    0x9B, 0xFA, 0x65, 0x02, 0x20, 0x56, 0xDD, 0xBF, 0x08, 0x33, 0xCB, 0xA9, 0x2F, 0xC8, 0x0D, 0x27,
+    0xE5, 0x4D, 0x6A, 0x53, 0x4F, 0x6F, 0xC6, 0xB2, 0x88, 0x68, 0xEC, 0x68, 0xFB, 0x0F, 0x63, 0x17,
+    0x92, 0x85, 0x33, 0xDF, 0x0F, 0xF2, 0xBD, 0x50, 0x90, 0xB3, 0x9C, 0x14, 0xC7, 0xDC, 0x32, 0x28,
+    0x6F, 0x72, 0x9B, 0x04, 0x47, 0x33, 0x9A, 0x20, 0x62, 0x97, 0x61, 0x81, 0xBD, 0x78, 0x12, 0xCD,
+    0x22, 0x3D, 0xE4, 0x1B, 0x9B, 0x82, 0xCA, 0xEF, 0xEF, 0x08, 0x60, 0xBC, 0x1D, 0xFA, 0x28, 0x22,
+    0x08, 0x33, 0xEA, 0xA9, 0x4D, 0x62, 0x81, 0xF2, 0x0E, 0xC8, 0x6A, 0x86, 0x7C, 0x27, 0x01, 0xCE,
+    0x0E, 0xE8, 0x18, 0x6A, 0x47, 0x5C, 0xCB, 0xB1, 0xAE, 0x44, 0x91, 0x01, 0x38, 0x8F, 0x9E, 0xA1,
+    0xE6, 0xDF, 0xFD, 0xAE, 0x8C, 0x14, 0xDA, 0xCB, 0x20, 0x12, 0x0A, 0xCC, 0xA8, 0xA6, 0x6E, 0xF9,
+    0x14, 0x24, 0x31, 0xCA, 0xB9, 0x8B, 0x4D, 0x5E, 0xBF, 0xD7, 0x26, 0x14, 0x18, 0xAF, 0x26, 0xB1,
+    0xB4, 0x79, 0x53, 0x25, 0xAF, 0x84, 0x75, 0x86, 0x8E, 0x2C, 0xD5, 0x58, 0x88, 0x65, 0xA5, 0xD8,
+    0xD4, 0x9A, 0x6D, 0x35, 0x1D, 0x17, 0x6B, 0x11, 0x38, 0xD6, 0xDE, 0xAF, 0x51, 0x30, 0x09, 0xF2,
+    0xBB, 0x59, 0x86, 0x22, 0x16, 0xF7, 0x78, 0x36, 0x2C, 0x92, 0x59, 0x94, 0x3F, 0x44, 0x01, 0x8C,
+    0xDF, 0xD3, 0x97, 0x17, 0x41, 0xFA, 0x7E, 0x67, 0x49, 0xD7, 0x2C, 0x24, 0x35, 0xA4, 0xEF, 0xF2,
+    0x93, 0x30, 0x1E, 0xE2, 0xD6, 0x86, 0x69, 0x37, 0xB9, 0x4B, 0x45, 0x46, 0x39, 0xB3, 0xC9, 0x6A,
+    0x56, 0x97, 0xF2, 0xA7, 0x61, 0x03, 0x07, 0x57, 0xAD, 0x5A, 0xCD, 0xB8, 0x5C, 0x42, 0x4F, 0x6C,
+    0xE8, 0x23, 0x3B, 0x39, 0xDB, 0xB8, 0xC9, 0xD9, 0x4E, 0xBE, 0x0B, 0xC3, 0xA9, 0x25, 0xB1, 0xA7,
+    0xAF, 0xCB, 0xD5, 0x86, 0xC6, 0x65, 0xB8, 0x02, 0x95, 0xD1, 0x66, 0xC0, 0xF8, 0x3D, 0x6D, 0x39,
+    0x39, 0x4A, 0x2E, 0x3B, 0x55, 0xAF, 0xAF, 0x2C, 0x20, 0x05, 0xB3, 0x5C, 0xBE, 0x54, 0xBB, 0x35,
+    0x0C, 0x27, 0x43, 0x6F, 0xFE, 0x68, 0x30, 0x23, 0x8C, 0xBF, 0xCF, 0xDC, 0x0E, 0x8A, 0xA1, 0xAB,
+    0x09, 0x94, 0x3B, 0xD3, 0x31, 0x49, 0x2E, 0x6A, 0xFA, 0xAA, 0x9E, 0xA0, 0x16, 0x48, 0x0E, 0x2D,
+    0x27, 0xD8, 0x00, 0x19, 0x06, 0x19, 0x3E, 0x71, 0x33, 0xE9, 0x77, 0xC8, 0xC9, 0x7A, 0x90, 0x41,
+    0x2C, 0x78, 0x0A, 0xC0, 0xC3, 0x77, 0x66, 0x64, 0xC7, 0xC8, 0xED, 0xFA, 0x53, 0x5C, 0x1E, 0x4F,
+    0xA5, 0xEE, 0x9A, 0xFF, 0xCD, 0xDF, 0x03, 0xF0, 0xF0, 0xB8, 0x21, 0x88, 0xB8, 0x9F, 0x63, 0xDF,
+    0x55, 0x06, 0xDA, 0x4E, 0xB6, 0x59, 0xEB, 0x5A, 0x78, 0xAA, 0x82, 0x8C, 0xE3, 0x86, 0xAA, 0xF1,
+    0x57, 0xF2, 0xFD, 0x3E, 0x5D, 0x7C, 0xD2, 0x53, 0xC3, 0x00, 0x1B, 0x2B, 0x09, 0xFB, 0x81, 0xAD,
+    0x1F, 0x01, 0x2D, 0xB9, 0xF2, 0xB5, 0x21, 0xA2, 0xF1, 0x80, 0x15, 0x0B, 0xD0, 0x07, 0xC3, 0x33,
+    0xC8, 0x1D, 0x39, 0x2A, 0xEF, 0xDE, 0x4F, 0x6D, 0x92, 0x41, 0x4D, 0x66, 0x2C, 0x4D, 0xEE, 0xA2,
+    0x9C, 0xF5, 0xAB, 0x04, 0xFF, 0x38, 0xB9, 0xA9, 0x23, 0xFB, 0x78, 0xA7, 0xE1, 0xB6, 0x3D, 0xB7,
+    0xEF, 0x2C, 0x50, 0x44, 0x02, 0xEC, 0x50, 0x00, 0xED, 0xCD, 0x88, 0x3E, 0xA8, 0x09, 0x82, 0xE4,
+    0x0B, 0x20, 0x49, 0x6F, 0x49, 0x2E, 0xDA, 0xDB, 0x81, 0x32, 0xA8, 0xC9, 0x6C, 0x2F, 0x5D, 0x94,
+    0x73, 0x01, 0x4F, 0x44, 0x3B, 0x68, 0x2E, 0xDA, 0xDF, 0x01, 0xF8, 0xBE, 0x00, 0x7D, 0xDA, 0x31,
+    0x41, 0x66, 0x04, 0x2E, 0x62, 0x43, 0xC1, 0x68, 0xCF, 0xB5, 0xE7, 0xC4, 0x22, 0x83, 0x88, 0x66,
+    0xEA, 0x82, 0x1B, 0xFB, 0x1B, 0x05, 0xF2, 0x76, 0x5A, 0x69, 0x4C, 0x33, 0xF4, 0xB5, 0x00, 0x7D,
+    0x79, 0x81, 0x79, 0x3E, 0xC1, 0x7C, 0x37, 0xAF, 0x65, 0xCF, 0xDA, 0xA2, 0xB7, 0x49, 0x4D, 0x4F,
+    0x01, 0x4D, 0x00, 0x80, 0x7B, 0xCE, 0xDC, 0x73, 0xE6, 0xB3, 0x2A, 0xE8, 0x55, 0x08, 0xCA, 0xA0,
+    0x67, 0x76, 0xB9, 0x27, 0xBD, 0x4D, 0xA9, 0xDD, 0x80, 0xA5, 0x0D, 0xF6, 0x43, 0x04, 0x03, 0x64,
+    0x3D, 0x42, 0xD1, 0xA3, 0x59, 0x11, 0xDE, 0x07, 0xC6, 0x7D, 0x67, 0xBB, 0x28, 0x52, 0x93, 0xDB,
+    0x0C, 0x33, 0x10, 0x72, 0xB6, 0x83, 0x58, 0x8C, 0x87, 0x53, 0x13, 0xF4, 0x6B, 0x33, 0xBA, 0x8F,
+    0x43, 0xED, 0x59, 0x37, 0xA9, 0x76, 0xB5, 0x09, 0xAE, 0xEC, 0x96, 0xCD, 0xD3, 0x39, 0x74, 0xA8,
+    0x38, 0xA9, 0x5B, 0x2B, 0x33, 0x9F, 0x43, 0xC6, 0x3D, 0x80, 0xAA, 0x9C, 0x56, 0x53, 0x93, 0x6E,
+    0x3B, 0x68, 0xDF, 0xDF, 0xC8, 0x20, 0xCC, 0xF7, 0xA3, 0x58, 0x9A, 0xAC, 0xBD, 0x9C, 0xFB, 0x40,
+    0xD8, 0xC1, 0x6C, 0xA7, 0x36, 0xA3, 0xC8, 0x20, 0x63, 0x1F, 0x8D, 0x77, 0x93, 0xF1, 0x14, 0x3C,
+    0x9C, 0x45, 0xD2, 0x59, 0x86, 0x3E, 0x30, 0xDA, 0x51, 0xBF, 0x7A, 0xFD, 0x6A, 0x82, 0xB5, 0xE6,
+    0x87, 0x73, 0xC3, 0x85, 0x84, 0xE0, 0x2B, 0x8C, 0x90, 0xA5, 0xE7, 0x08, 0x1D, 0x55, 0x02, 0xAC,
+    0x37, 0x1E, 0x78, 0x78, 0xF8, 0x36, 0xBE, 0x2D, 0x27, 0xED, 0xCD, 0x76, 0xEC, 0x83, 0x7C, 0x2B,
+    0x8B, 0xD4, 0x07, 0x0B, 0x8A, 0xA4, 0xBC, 0xBD, 0x94, 0x45, 0x34, 0xC1, 0x21, 0xEB, 0x64, 0x06,
+    0x73, 0x82, 0xDA, 0xCB, 0xEB, 0xD7, 0xAE, 0xF9, 0x96, 0xEF, 0x70, 0x86, 0x0D, 0x0C, 0x90, 0x51,
+    0x07, 0x88, 0xD4, 0xC5, 0x1D, 0x05, 0x7A, 0x80, 0x3F, 0x12, 0x64, 0xB0, 0x2C, 0x8D, 0xFD, 0xC9,
+    0x20, 0x16, 0xC0, 0x70, 0xEC, 0x48, 0x38, 0x26, 0x19, 0xAC, 0x2F, 0x4D, 0x56, 0x93, 0xBA, 0x92,
+    0xDA, 0xA4, 0x2F, 0xB9, 0x6D, 0x32, 0x1A, 0xE6, 0x8E, 0xB7, 0xD0, 0x9C, 0xBD, 0x08, 0x88, 0x0F,
+    0xE9, 0x21, 0x6E, 0x73, 0x46, 0x57, 0x54, 0x40, 0x9F, 0x64, 0x80, 0x0C, 0xF2, 0xA7, 0x83, 0x0C,
+    0x92, 0x8B, 0x9C, 0x15, 0x8B, 0x9A, 0xF4, 0x15, 0x6A, 0xAF, 0x3D, 0x8D, 0x37, 0x9E, 0x66, 0xD4,
+    0x7F, 0x91, 0xCD, 0x20, 0xB9, 0x58, 0x74, 0xBB, 0x51, 0x76, 0xC0, 0xA1, 0xE3, 0x0C, 0xC2, 0x32,
+    0xA1, 0x34, 0xE4, 0xD2, 0xE4, 0xAE, 0x1C, 0x7E, 0xA9, 0x49, 0x72, 0x01, 0xDA, 0xA4, 0x66, 0x40,
+    0x24, 0xE3, 0x01, 0x41, 0x32, 0xA1, 0x23, 0x99, 0xD0, 0x93, 0x4C, 0x90, 0x37, 0xDD, 0xF1, 0x63,
+    0x90, 0xB3, 0x03, 0x20, 0x67, 0x37, 0x00, 0x6A, 0xB2, 0x23, 0xA0, 0xBD, 0x99, 0xF7, 0xC1, 0x78,
+    0xCD, 0xCA, 0x7E, 0x21, 0xCC, 0xD0, 0xF0, 0xD6, 0x26, 0x4E, 0x3B, 0x87, 0x93, 0xB3, 0x0C, 0x92,
+    0xC1, 0x8C, 0xE4, 0xE1, 0x2C, 0x97, 0xBF, 0xD1, 0x07, 0x3B, 0x42, 0xBF, 0x51, 0x9E, 0x04, 0xEB,
+    0xA3, 0x5B, 0xE8, 0xD5, 0x4F, 0xCB, 0x71, 0x38, 0xB1, 0x40, 0x24, 0x19, 0xF6, 0xC8, 0xD9, 0xDC,
+    0x0E, 0x66, 0xB0, 0xBC, 0x94, 0x61, 0xF3, 0xEE, 0x9E, 0x88, 0x86, 0xBE, 0xEA, 0x5C, 0xCF, 0x09,
+    0xC8, 0x17, 0x00, 0xFD, 0xEA, 0x0C, 0xB1, 0x58, 0xC0, 0xBD, 0x18, 0xA0, 0x48, 0x08, 0x32, 0xC0,
+    0x3A, 0x37, 0xC8, 0x0F, 0x3F, 0x8C, 0x4D, 0xB6, 0x66, 0x34, 0xAF, 0xBE, 0xBD, 0xF4, 0xB1, 0x68,
+    0x5F, 0xE4, 0x95, 0xA4, 0x2F, 0x25, 0xB5, 0xBD, 0xE8, 0x4B, 0x09, 0xF8, 0xF6, 0xB8, 0x76, 0x0E,
+    0x4E, 0xE8, 0x6E, 0x4F, 0x90, 0x6F, 0xCC, 0xD0, 0x97, 0x03, 0xCC, 0xFB, 0x01, 0x8E, 0xA1, 0x21,
+    0xA3, 0xF8, 0xE4, 0x76, 0xEC, 0x3E, 0xFC, 0x68, 0x91, 0xEF, 0x7C, 0x90, 0xF4, 0xE5, 0x1B, 0xC9,
+    0x3C, 0x11, 0x12, 0x1C, 0xBA, 0x0C, 0x19, 0xC0, 0x09, 0x05, 0xBA, 0x40, 0x4D, 0xE2, 0xF6, 0xDC,
+    0x24, 0x38, 0x0B, 0xED, 0xE5, 0xD5, 0x20, 0x16, 0x91, 0x0C, 0x0C, 0xF9, 0x7E, 0xEC, 0x48, 0x72,
+    0x70, 0x24, 0x17, 0x79, 0xD3, 0xF2, 0xFA, 0x58, 0xFA, 0x0F, 0x3F, 0x4A, 0x72, 0x2A, 0xE6, 0xC4,
+    0xA5, 0xA4, 0x2F, 0xDF, 0x48, 0x7A, 0x7B, 0x71, 0x72, 0x3B, 0xB1, 0x9F, 0xB3, 0xF9, 0xE1, 0x9C,
+    0xE5, 0xD5, 0x8F, 0x93, 0x9C, 0x4A, 0xF3, 0x02, 0x1E, 0x3E, 0x23, 0x22, 0x38, 0x8B, 0xD0, 0x70,
+    0xEE, 0x82, 0xB8, 0x1D, 0xFA, 0xD0, 0x7F, 0x18, 0xE4, 0xCD, 0x13, 0xEF, 0x05, 0x49, 0x32, 0x4A,
+    0x92, 0x8B, 0xFA, 0x49, 0xE1, 0xA2, 0x4F, 0xE7, 0x9C, 0xCC, 0xF3, 0xB7, 0x72, 0x32, 0xDF, 0xFC,
+    0x60, 0x49, 0x46, 0x5E, 0x8D, 0xD9, 0x9A, 0xED, 0x50, 0xEA, 0x73, 0x19, 0x04, 0xC9, 0x09, 0x8E,
+    0x0C, 0x50, 0x3F, 0x3D, 0x11, 0x20, 0x16, 0x19, 0x00, 0xDB, 0x07, 0x40, 0xBE, 0x17, 0x51, 0x17,
+    0x69, 0x4F, 0x0E, 0x90, 0x64, 0x44, 0xF7, 0x49, 0x2E, 0x10, 0x8B, 0xD3, 0xBE, 0x49, 0xE6, 0x72,
+    0x40, 0x91, 0x6F, 0x25, 0xD8, 0x27, 0xA2, 0x85, 0x79, 0x25, 0xA9, 0x49, 0x4D, 0xEC, 0xA2, 0x0C,
+    0xC6, 0x67, 0xE0, 0xE1, 0xAD, 0xAD, 0x51, 0x55, 0x00, 0x6D, 0xC6, 0xA9, 0x3E, 0x40, 0x5E, 0x0E,
+    0x68, 0x6E, 0x07, 0x34, 0x4C, 0x68, 0x49, 0xDF, 0x90, 0x01, 0xE9, 0xE2, 0x05, 0x5C, 0x34, 0x27,
+    0x46, 0x23, 0x2F, 0xCF, 0xFA, 0xF2, 0x8D, 0x24, 0x5F, 0x5F, 0x0C, 0xE0, 0x3A, 0x92, 0x5E, 0x06,
+    0x47, 0x26, 0x94, 0x8E, 0xE4, 0xA0, 0x26, 0xF3, 0x13, 0x3B, 0x35, 0xA9, 0x49, 0x7D, 0x84, 0xF6,
+    0xF2, 0xAD, 0x02, 0x91, 0x60, 0xCD, 0x08, 0x43, 0x72, 0x46, 0x47, 0x56, 0x0A, 0x49, 0xA5, 0xDE,
+    0xDB, 0x6B, 0xEF, 0x07, 0x94, 0xFE, 0x46, 0x36, 0x83, 0x9C, 0x8B, 0xDE, 0x8E, 0x4D, 0xD6, 0xDB,
+    0xC9, 0x0C, 0x7A, 0x7B, 0x31, 0xDB, 0x8B, 0x48, 0xEE, 0xC8, 0x62, 0x46, 0xF3, 0x83, 0x60, 0x8F,
+    0x2C, 0xE2, 0x66, 0xEE, 0x83, 0xF1, 0xCD, 0x0B, 0x0F, 0x6F, 0x6D, 0x8D, 0xE6, 0x08, 0x99, 0x44,
+    0x30, 0x24, 0x2C, 0x92, 0xF2, 0x7D, 0xE8, 0xAF, 0x06, 0xF0, 0xB8, 0x4B, 0x90, 0xAC, 0x04, 0x11,
+    0x12, 0xEA, 0xFF, 0x2A, 0x8C, 0xED, 0x62, 0x4E, 0xFC, 0x70, 0x34, 0xDF, 0xFB, 0x60, 0x49, 0x22,
+    0x66, 0x73, 0xD4, 0x1B, 0xB5, 0x1D, 0x52, 0xF7, 0xE1, 0x62, 0xA5, 0x47, 0x83, 0xDF, 0x82, 0xB8,
+    0x52, 0xD0, 0xDE, 0x8E, 0x00, 0x47, 0xF4, 0x9C, 0xE0, 0xB8, 0x80, 0xCC, 0x78, 0xA6, 0x2D, 0x40,
+    0xB3, 0xF2, 0x60, 0xBB, 0x04, 0xC5, 0x00, 0x5D, 0x06, 0x18, 0x8E, 0xC0, 0xC9, 0x50, 0x03, 0x9E,
+    0x2E, 0xD6, 0xB2, 0xB5, 0x0D, 0xCD, 0x8B, 0x9C, 0x14, 0x39, 0x58, 0x46, 0xF0, 0x0F, 0x57, 0xB6,
+    0xF1, 0xD6, 0x59, 0x38, 0x2E, 0xD0, 0x5C, 0x80, 0x63, 0x7B, 0x80, 0x2F, 0xE3, 0x3C, 0x1E, 0x93,
+    0x01, 0x87, 0x12, 0xF6, 0x71, 0x82, 0xE3, 0xDC, 0x90, 0x53, 0x3B, 0xD8, 0x01, 0x4D, 0xC6, 0xDE,
+    0x93, 0x33, 0x4C, 0xAE, 0xCD, 0x3C, 0x5F, 0x89, 0x35, 0x88, 0x71, 0x63, 0xF3, 0x62, 0x6A, 0xC8,
+    0x49, 0x71, 0x01, 0x8F, 0x41, 0x04, 0x40, 0xFE, 0xEC, 0x47, 0xD0, 0x2B, 0x65, 0x66, 0xEF, 0x30,
+    0xA0, 0x9F, 0xF5, 0x68, 0xC5, 0x22, 0x67, 0xED, 0xB3, 0x88, 0x72, 0xB6, 0x4D, 0x16, 0x51, 0x7B,
+    0xD7, 0x24, 0x39, 0x6B, 0xEF, 0xC4, 0x22, 0x67, 0xE3, 0xB3, 0x88, 0x72, 0x32, 0x87, 0x53, 0x1F,
+    0x64, 0x70, 0xFD, 0x52, 0x2D, 0x83, 0x25, 0xF3, 0xFA, 0x00, 0x8F, 0x7D, 0x79, 0xE5, 0x6E, 0x56,
+    0x1F, 0x57, 0x53, 0xBE, 0x95, 0xA4, 0xA1, 0xFC, 0x7A, 0x48, 0x24, 0x54, 0xB1, 0x60, 0x06, 0x3C,
+    0x7C, 0x3A, 0x3D, 0x30, 0x96, 0x3E, 0xB8, 0x2E, 0x9A, 0xEF, 0x26, 0xE5, 0x73, 0x1F, 0x5C, 0x17,
+    0xF5, 0x76, 0xD2, 0x9E, 0x72, 0x76, 0x62, 0xB1, 0x47, 0x16, 0xF5, 0x7A, 0x92, 0x93, 0xEB, 0x83,
+    0x15, 0x49, 0xBF, 0x9E, 0x8C, 0xB7, 0x64, 0x86, 0xDB, 0x3C, 0x0D, 0x0A, 0x7D, 0x5C, 0x9B, 0xEE,
+    0x2B, 0x9D, 0x72, 0x59, 0xB3, 0x6B, 0xD8, 0xDD, 0x1C, 0x87, 0xBB, 0x1E, 0xE6, 0x91, 0xA1, 0x2F,
+    0x15, 0x74, 0xD1, 0x01, 0xD9, 0xFC, 0x6C, 0x8B, 0x47, 0x49, 0xBE, 0x41, 0xF2, 0xA3, 0x7C, 0xFC,
+    0xEF, 0x24, 0x07, 0xD4, 0x87, 0x79, 0x2C, 0x30, 0x9E, 0x83, 0xFD, 0x8C, 0x87, 0x79, 0xDC, 0x61,
+    0x81, 0x7D, 0x37, 0x19, 0x6F, 0x4E, 0x4C, 0xF2, 0x7D, 0xF2, 0x63, 0x32, 0xF3, 0x38, 0x37, 0x2C,
+    0x30, 0xB7, 0x8B, 0x05, 0x76, 0x11, 0x70, 0x0E, 0x82, 0x0E, 0x92, 0x16, 0x7A, 0xB6, 0x30, 0xDE,
+    0xC2, 0x0D, 0x06, 0x84, 0x39, 0x9C, 0x61, 0x8E, 0x2C, 0x30, 0x4F, 0x04, 0x98, 0xA3, 0x33, 0xCC,
+    0x0F, 0x3D, 0xB4, 0x1B, 0xA1, 0x1D, 0xA0, 0x0B, 0xA0, 0x12, 0xA0, 0xD6, 0x7E, 0xC2, 0x6F, 0xE3,
+    0x9E, 0x3F, 0x0E, 0xA2, 0x58, 0xB8, 0xF7, 0x82, 0x8A, 0x46, 0x24, 0x11, 0xED, 0x60, 0x8E, 0x06,
+    0x71, 0x33, 0xC3, 0x9C, 0xF4, 0xED, 0xED, 0x08, 0x4D, 0x34, 0xF4, 0x50, 0x0B, 0x36, 0x99, 0x88,
+    0x7E, 0x6D, 0x86, 0xBC, 0x1A, 0x20, 0xDE, 0x8A, 0x40, 0x78, 0x06, 0x5F, 0xA4, 0x40, 0x00, 0xBA,
+    0x0F, 0x12, 0xF4, 0x0F, 0x3C, 0xD2, 0x21, 0xB4, 0x97, 0x42, 0x2D, 0x4E, 0x7D, 0x0E, 0x29, 0x77,
+    0xB8, 0x7B, 0x95, 0xB8, 0xB0, 0xD4, 0x79, 0xAB, 0x59, 0xBE, 0x28, 0x2D, 0x51, 0x39, 0x9A, 0xDC,
+    0x77, 0xB6, 0x39, 0xA7, 0x02, 0xDC, 0x13, 0x41, 0x24, 0x3D, 0xC1, 0x1E, 0x89, 0x7D, 0x34, 0x1E,
+    0xF6, 0x48, 0x94, 0xC1, 0x8C, 0xB0, 0x47, 0x16, 0x35, 0xD9, 0x01, 0xEE, 0xF1, 0xC5, 0x78, 0x37,
+    0x80, 0x6D, 0xB2, 0x83, 0x1B, 0x1A, 0x36, 0xA9, 0xC0, 0x0E, 0x6D, 0x6E, 0x72, 0x82, 0xF5, 0x5D,
+    0x42, 0x59, 0x2A, 0x1B, 0x8D, 0x01, 0x8A, 0x9C, 0xC1, 0x19, 0x3D, 0x39, 0xD6, 0x02, 0xC9, 0x72,
+    0xA7, 0x1B, 0x60, 0x95, 0xAF, 0xC9, 0x77, 0x9E, 0xA2, 0x02, 0xD4, 0xC7, 0x28, 0x00, 0x68, 0x56,
+    0x9F, 0x5A, 0x09, 0xF1, 0x27, 0xE7, 0xF6, 0x05, 0xFC, 0x48, 0x30, 0x89, 0xA5, 0xCD, 0x92, 0x14,
+    0x8B, 0x48, 0x3A, 0xB0, 0x4D, 0x7D, 0x30, 0xDE, 0x3E, 0x9E, 0xE4, 0x6C, 0x07, 0x73, 0x3A, 0x69,
+    0xEF, 0x60, 0x86, 0x64, 0x46, 0xC2, 0x0E, 0xC9, 0x81, 0x70, 0xC8, 0x05, 0x04, 0x51, 0x12, 0x5C,
+    0x9B, 0xE1, 0x96, 0x8A, 0x82, 0x04, 0x68, 0x06, 0xD8, 0x09, 0x3D, 0xC7, 0x95, 0x30, 0xB5, 0x49,
+    0x66, 0xAB, 0x5C, 0x2B, 0x3D, 0x66, 0x65, 0xA6, 0xAC, 0x2C, 0x97, 0xDA, 0xFF, 0xB5, 0x07, 0x2B,
+    0x50, 0xCB, 0x09, 0x5D, 0xB5, 0xC1, 0x84, 0x7D, 0xFF, 0x7A, 0x94, 0x0B, 0xEC, 0xA5, 0x52, 0x9D,
+    0xBB, 0xDE, 0x4E, 0x68, 0x93, 0x1D, 0xA1, 0x2F, 0xC7, 0xCA, 0xD6, 0x32, 0x97, 0x23, 0xBA, 0xC5,
+    0x8E, 0xA0, 0x48, 0xD0, 0xB3, 0xF9, 0xF8, 0x5A, 0x02, 0x6B, 0x8B, 0xE5, 0x54, 0x7D, 0xAD, 0xF4,
+    0x00, 0x7E, 0x0F, 0x40, 0x3B, 0xA2, 0xE5, 0xD0, 0x92, 0xA8, 0x0D, 0x52, 0x57, 0xD3, 0x7D, 0xC5,
+    0x0E, 0xF2, 0xFD, 0x80, 0x42, 0xC8, 0xEB, 0xA1, 0xC9, 0x84, 0x79, 0xF5, 0xA3, 0x37, 0x17, 0x43,
+    0x36, 0xA4, 0xEF, 0x38, 0xA3, 0x9B, 0x2A, 0x64, 0xB1, 0xA6, 0xA9, 0x82, 0xEF, 0x02, 0xE8, 0x0E,
+    0x5F, 0x00, 0xD0, 0x54, 0xCE, 0x9F, 0x5A, 0x9F, 0x96, 0x03, 0x00, 0x5F, 0xDF, 0x51, 0x0D, 0x95,
+    0x1B, 0x8E, 0x70, 0x14, 0x0C, 0x82, 0x45, 0x70, 0xE9, 0xF3, 0x97, 0x9A, 0x27, 0x92, 0x0C, 0x40,
+    0x9B, 0xD5, 0x0C, 0x34, 0xC5, 0xF8, 0x5D, 0xFF, 0x8E, 0x40, 0x93, 0xED, 0xD0, 0xCF, 0x6D, 0xB6,
+    0x83, 0x9C, 0x45, 0xB2, 0x83, 0x9A, 0x44, 0xB2, 0xA3, 0xF6, 0x7D, 0x34, 0xDE, 0x78, 0x15, 0xCC,
+    0xEC, 0x26, 0x37, 0x29, 0x92, 0x1C, 0x7B, 0xDE, 0x66, 0x41, 0xC3, 0x89, 0xEF, 0xDE, 0x79, 0x26,
+    0xDA, 0x04, 0xE0, 0xCF, 0xCB, 0x08, 0xBC, 0xF5, 0x95, 0xB1, 0x02, 0xDE, 0x68, 0x7D, 0xBD, 0x6F,
+    0xE0, 0xCB, 0x3B, 0x55, 0xCE, 0x33, 0x27, 0x47, 0xC1, 0x99, 0x51, 0x72, 0x62, 0xD2, 0xF3, 0xF0,
+    0xB7, 0xB3, 0xF1, 0x68, 0x8A, 0x1D, 0x80, 0xE2, 0xF0, 0x24, 0x32, 0x51, 0x9A, 0x5C, 0x90, 0xDB,
+    0xC4, 0x26, 0x89, 0x44, 0x91, 0xFB, 0xE8, 0x48, 0x06, 0x43, 0x47, 0x2F, 0x73, 0xBF, 0x53, 0x6C,
+    0xDC, 0xDA, 0x3A, 0x8B, 0xDA, 0xBB, 0x8E, 0x7B, 0xFF, 0xE0, 0x59, 0x00, 0xF7, 0xDD, 0x37, 0xEC,
+    0xE8, 0x9F, 0x83, 0xBE, 0x1C, 0x45, 0x42, 0xD1, 0x93, 0x9C, 0xBB, 0xE8, 0x60, 0x46, 0xBD, 0x9D,
+    0x9A, 0x0C, 0xCA, 0xD0, 0x47, 0xB1, 0x18, 0x6F, 0x26, 0x3D, 0xB1, 0xE5, 0x40, 0x91, 0x64, 0xEE,
+    0xA2, 0x0C, 0x2E, 0x1A, 0xAF, 0xB7, 0x79, 0xA5, 0xC0, 0x69, 0x77, 0x34, 0x34, 0x39, 0x15, 0x3B,
+    0x76, 0x7C, 0x87, 0x09, 0x92, 0x3D, 0x27, 0x98, 0x45, 0x17, 0xC0, 0x4D, 0x36, 0xA0, 0x61, 0xD5,
+    0xA9, 0xBD, 0xC7, 0x8F, 0x03, 0x82, 0xF4, 0xC0, 0x47, 0x1F, 0x4F, 0xC0, 0xFE, 0xAF, 0xFE, 0xDE,
+    0x5A, 0x66, 0x3F, 0xF3, 0xC0, 0xF8, 0xC0, 0xF3, 0xB1, 0x0F, 0x32, 0xE4, 0x36, 0x89, 0xC5, 0x0E,
+    0x6C, 0x93, 0xF2, 0xC6, 0xB3, 0x0B, 0x2A, 0xD8, 0x21, 0xCB, 0xA4, 0xBD, 0xF9, 0x26, 0xE5, 0x24,
+    0xDF, 0xE0, 0xAB, 0x41, 0xDC, 0xFE, 0xF8, 0xE3, 0x00, 0xB7, 0x70, 0x81, 0x4A, 0x26, 0x41, 0xE4,
+    0x3E, 0xAD, 0xAD, 0xF0, 0xFF, 0x66, 0x0F, 0x14, 0xD8, 0x03, 0xC5, 0x84, 0x9E, 0x4B, 0x75, 0x72,
+    0x3B, 0xED, 0x36, 0x9F, 0x6A, 0xB9, 0xD9, 0x3C, 0xF5, 0x40, 0x7D, 0xD6, 0x53, 0x0F, 0x38, 0xC0,
+    0x72, 0x30, 0x44, 0x5F, 0x9F, 0x4C, 0x58, 0xEE, 0x6A, 0x15, 0x00, 0xBE, 0x04, 0xF4, 0xC3, 0x97,
+    0x85, 0x17, 0x6F, 0x4F, 0xD0, 0xA1, 0x36, 0x04, 0x44, 0x1C, 0x78, 0xEC, 0xE9, 0x47, 0xA1, 0xAE,
+    0x01, 0x6E, 0x40, 0xBF, 0x40, 0x5C, 0x9B, 0xDA, 0xF9, 0x25, 0x04, 0xE0, 0x37, 0xEF, 0xD8, 0x30,
+    0x65, 0x78, 0x9B, 0xF9, 0x19, 0x00, 0xF6, 0x9F, 0xB8, 0xEC, 0x6E, 0xBF, 0x7F, 0xE6, 0xB1, 0x87,
+    0xD4, 0x9B, 0x57, 0x82, 0x02, 0x1E, 0x93, 0x57, 0xE2, 0xB3, 0x0B, 0xB0, 0xEF, 0x5D, 0x58, 0xFE,
+    0xED, 0xDB, 0xFC, 0xC1, 0x70, 0xA1, 0x12, 0x9C, 0xB0, 0x76, 0x3E, 0x01, 0xC0, 0xF4, 0x12, 0x00,
+    0x60, 0x4F, 0xB3, 0x59, 0xC3, 0x7B, 0x6B, 0xA5, 0x56, 0x14, 0x34, 0x57, 0x26, 0xE0, 0xE5, 0xEF,
+    0x60, 0xFF, 0xDE, 0xCD, 0xF1, 0x5F, 0xF0, 0x52, 0xB5, 0x2B, 0xEF, 0xC8, 0x3F, 0x1D, 0x01, 0x3C,
+    0xFA, 0x0F, 0xBE, 0xFA, 0x25, 0x00, 0x2D, 0xC6, 0x5F, 0xFC, 0xA3, 0x6E, 0xAE, 0xCD, 0xEB, 0xEF,
+    0x7B, 0xE0, 0x1F, 0x05, 0x7C, 0xED, 0xCB, 0xC0, 0x97, 0xC5, 0x2E, 0x92, 0x48, 0xBB, 0x66, 0xC3,
+    0xAB, 0xD5, 0xFB, 0xB7, 0xBA, 0xBB, 0x7F, 0xBE, 0x3E, 0x8D, 0xE6, 0xD7, 0xEA, 0xC7, 0x23, 0x6B,
+    0xAF, 0x3E, 0x00, 0x7C, 0x07, 0xCF, 0x02, 0xC0, 0x33, 0x78, 0x0A, 0xDD, 0x80, 0x03, 0x35, 0x12,
+    0x50, 0xF5, 0x84, 0x12, 0xF8, 0x25, 0x72, 0x95, 0x01, 0x40, 0x37, 0xE9, 0x09, 0x40, 0x57, 0x2A,
+    0x41, 0xF5, 0x81, 0x5F, 0xF8, 0x8B, 0x16, 0xC0, 0x4B, 0x95, 0xEE, 0x53, 0x91, 0x24, 0x3C, 0x8B,
+    0x66, 0xC6, 0xA3, 0x55, 0xA8, 0x03, 0x55, 0xC4, 0x03, 0xF5, 0xBB, 0x4F, 0xD7, 0x8F, 0xEF, 0x00,
+    0x40, 0x7B, 0xB6, 0x3D, 0x8B, 0x2E, 0xF4, 0x33, 0x44, 0xB6, 0x1E, 0x0D, 0x39, 0x00, 0x0F, 0x6C,
+    0x3A, 0x67, 0x2F, 0xA2, 0x4F, 0x28, 0xD0, 0x0B, 0x32, 0xEC, 0xD2, 0x24, 0x30, 0x36, 0xA9, 0x65,
+    0x68, 0x97, 0xEE, 0x76, 0x10, 0x51, 0xBE, 0x39, 0x8B, 0x68, 0x5E, 0x9B, 0xBA, 0xE0, 0xA4, 0xEF,
+    0x6F, 0x64, 0xE5, 0xE5, 0x3B, 0x8B, 0xF6, 0xF2, 0x5A, 0x30, 0xA3, 0xBC, 0xEE, 0xCD, 0xA0, 0x38,
+    0x18, 0xE8, 0x02, 0xFB, 0xA4, 0x49, 0x70, 0xD9, 0x44, 0x30, 0x99, 0x19, 0x8C, 0x1B, 0xBC, 0x50,
+    0x4E, 0x9B, 0x50, 0xC6, 0x8E, 0x77, 0x7C, 0x4F, 0x7B, 0xB6, 0x39, 0x2B, 0x27, 0xE5, 0xF5, 0x4F,
+    0x0A, 0x0C, 0x67, 0xFC, 0xF6, 0xAD, 0x0D, 0xB5, 0x48, 0x2C, 0x22, 0xAA, 0x49, 0x79, 0x0B, 0xD7,
+    0x26, 0x91, 0x64, 0x90, 0xF3, 0xDA, 0xB6, 0xD1, 0x05, 0x19, 0xB4, 0xB7, 0xA3, 0x13, 0xA5, 0x25,
+    0xCB, 0xF7, 0x78, 0x8D, 0x5D, 0x36, 0xB1, 0x5A, 0xEF, 0x52, 0x93, 0xE8, 0x5A, 0x48, 0xF8, 0xFF,
+    0x00, 0xC5, 0xBC, 0x4F, 0xAC, 0x1F, 0xD7, 0x95, 0xE7, 0xF7, 0xA9, 0xBA, 0x22, 0xCB, 0xCD, 0xEA,
+    0xF6, 0xD5, 0x82, 0x42, 0xC7, 0x56, 0x5B, 0xD5, 0x08, 0x7A, 0x21, 0x6B, 0x5A, 0xAA, 0x5E, 0x74,
+    0x00, 0x07, 0xA0, 0x78, 0x4B, 0x22, 0x66, 0xBC, 0xD0, 0x82, 0x5C, 0x90, 0xEE, 0x20, 0x5E, 0x70,
+    0x16, 0x5E, 0xB8, 0x85, 0x00, 0x9C, 0x45, 0x2F, 0x34, 0x81, 0xC4, 0x5B, 0x12, 0x91, 0xD1, 0x42,
+    0x41, 0xC4, 0x8D, 0x7B, 0x13, 0x60, 0xC4, 0x85, 0x1A, 0x60, 0xD3, 0x01, 0xD8, 0x40, 0x0C, 0x44,
+    0x0B, 0x92, 0x75, 0xC9, 0x97, 0x84, 0x40, 0x88, 0x80, 0x25, 0x69, 0x34, 0x02, 0xE2, 0x60, 0x58,
+    0xB6, 0xE4, 0x51, 0xB7, 0xB4, 0xE0, 0x25, 0x55, 0x34, 0x4B, 0xE4, 0xAD, 0xFA, 0x66, 0x51, 0xBF,
+    0xDF, 0x23, 0x65, 0x5B, 0x3D, 0xDD, 0x46, 0x0F, 0xF2, 0xC3, 0xFB, 0x55, 0x3D, 0xBC, 0xBA, 0x55,
+    0xF7, 0xD4, 0x39, 0xE7, 0x9E, 0xBF, 0xDF, 0xFB, 0xE8, 0xC0, 0x46, 0xAC, 0x12, 0x52, 0x6B, 0x35,
+    0x52, 0x07, 0x4C, 0x02, 0xB7, 0x34, 0x85, 0x44, 0xA7, 0x64, 0xA3, 0x0F, 0xCA, 0x67, 0x3B, 0x54,
+    0xEF, 0xCE, 0x26, 0xD5, 0xA1, 0xDB, 0x91, 0x46, 0xA7, 0xD9, 0xE8, 0x0B, 0xF2, 0x84, 0x49, 0xFC,
+    0xFE, 0x7C, 0xC4, 0x29, 0x7A, 0xC5, 0x32, 0x62, 0x23, 0x76, 0xA0, 0xEA, 0xA9, 0x03, 0xEE, 0xFF,
+    0x68, 0x9C, 0x46, 0xA7, 0xD9, 0xBF, 0xB6, 0x74, 0xA8, 0x63, 0xF1, 0x1F, 0x26, 0xA7, 0xA9, 0x54,
+    0x0F, 0xD0, 0x2D, 0x0D, 0x52, 0x44, 0x9A, 0xB2, 0xE5, 0xFB, 0x29, 0x4B, 0xF9, 0x9C, 0xA7, 0x6C,
+    0x36, 0xE9, 0xBF, 0x9C, 0xCD, 0xA4, 0x54, 0x7C, 0xA1, 0xA9, 0x94, 0xA2, 0x95, 0x5A, 0x7B, 0xEF,
+    0x7C, 0x6B, 0x87, 0xB2, 0xA9, 0x7A, 0xA8, 0x03, 0xB8, 0x00, 0xAE, 0x05, 0xD7, 0x00, 0x3F, 0xAC,
+    0x5B, 0x73, 0x57, 0xC1, 0x4A, 0x8D, 0x7F, 0x6F, 0xC9, 0x67, 0x93, 0x6C, 0xB4, 0xD1, 0xB5, 0xAE,
+    0x9D, 0x59, 0x8A, 0xF8, 0xC2, 0x58, 0x5F, 0x53, 0xD0, 0x5B, 0x8B, 0x91, 0xA2, 0xBD, 0x29, 0x7C,
+    0x9D, 0xF2, 0xC4, 0x64, 0x63, 0xD6, 0xBA, 0x96, 0x6C, 0x86, 0x32, 0xAE, 0x8F, 0x05, 0xCE, 0x42,
+    0x9E, 0xC0, 0x4C, 0x60, 0x46, 0x3A, 0xC5, 0x0D, 0x89, 0x31, 0x5B, 0x8E, 0x35, 0xD9, 0xBC, 0xB9,
+    0xBA, 0x19, 0x51, 0x8C, 0xEB, 0xBD, 0x76, 0xFB, 0x1D, 0xE0, 0xD7, 0x48, 0x6C, 0x01, 0xF6, 0x34,
+    0xE4, 0x09, 0x5C, 0x8B, 0x19, 0xB3, 0x73, 0x5D, 0xE3, 0x14, 0x8D, 0x84, 0xFF, 0x51, 0x53, 0x46,
+    0xD0, 0x7A, 0xFB, 0x02, 0x55, 0xBF, 0x8E, 0x0B, 0x98, 0x09, 0x5C, 0x43, 0x31, 0x02, 0x9D, 0xA2,
+    0x91, 0x82, 0x95, 0xF0, 0x3F, 0x3A, 0x92, 0x6F, 0x28, 0x76, 0x81, 0x3D, 0x3A, 0x8A, 0x53, 0xCC,
+    0xA4, 0xB0, 0x57, 0xE7, 0x30, 0x69, 0xA5, 0xC1, 0xAF, 0xB3, 0xD9, 0xB8, 0x4E, 0xBF, 0x00, 0xBC,
+    0x78, 0xAE, 0x5D, 0xA5, 0x1C, 0xAA, 0x5F, 0x1C, 0xCD, 0x13, 0xD4, 0x81, 0x5A, 0xD1, 0x68, 0xC1,
+    0xA9, 0xA7, 0xDB, 0x25, 0xC1, 0xF6, 0x64, 0xE9, 0xD7, 0x26, 0xCD, 0xD2, 0xEE, 0xA4, 0x2C, 0x50,
+    0x68, 0xA2, 0xD6, 0x82, 0x34, 0x9B, 0x54, 0x25, 0x3B, 0xD8, 0xD1, 0x37, 0xF5, 0x7B, 0x09, 0xFF,
+    0x66, 0xCC, 0x16, 0xD7, 0x16, 0xE3, 0x4C, 0xDD, 0x83, 0xA0, 0x9C, 0x32, 0xBA, 0x60, 0x35, 0xE3,
+    0xD4, 0xA3, 0x09, 0x80, 0xEC, 0xDC, 0x39, 0xA4, 0xE0, 0x14, 0xAB, 0x5F, 0x1C, 0x2D, 0x23, 0x26,
+    0x81, 0xBE, 0xC0, 0x69, 0xA8, 0x34, 0x97, 0x63, 0x77, 0x2A, 0xD9, 0xB8, 0x98, 0xE4, 0x1A, 0x55,
+    0xC1, 0x05, 0xEC, 0x40, 0x39, 0x3E, 0x52, 0x26, 0xA3, 0x19, 0xCD, 0xB8, 0xF5, 0x21, 0xB8, 0xA6,
+    0x6E, 0xEB, 0xDE, 0x24, 0x33, 0x15, 0x13, 0x55, 0x70, 0x8D, 0x60, 0x29, 0xA2, 0x0B, 0x94, 0xB1,
+    0x2B, 0x23, 0xB8, 0xC3, 0xB7, 0x66, 0x30, 0x69, 0xF1, 0x2D, 0x54, 0x37, 0x6E, 0x46, 0x40, 0x4A,
+    0x80, 0x93, 0x02, 0x94, 0x77, 0xEF, 0x25, 0xC8, 0x16, 0xF7, 0xE6, 0x00, 0xEE, 0xEA, 0x28, 0xB0,
+    0xD1, 0x17, 0x23, 0xF9, 0x5C, 0x46, 0x17, 0xE8, 0xDA, 0x25, 0x57, 0x5F, 0x45, 0xDB, 0xDB, 0x64,
+    0x52, 0x36, 0xA3, 0x00, 0xAB, 0xFC, 0xD9, 0x8A, 0xB6, 0x18, 0x01, 0xE8, 0x80, 0x95, 0x87, 0x00,
+    0x98, 0x89, 0x17, 0xA9, 0x83, 0x8F, 0x65, 0xAC, 0x52, 0xA1, 0xB0, 0x14, 0x0A, 0x26, 0xD9, 0x5E,
+    0x0D, 0x55, 0x3F, 0xD7, 0x3D, 0xCC, 0xD5, 0x4E, 0x82, 0x4A, 0x52, 0x43, 0x26, 0x69, 0x84, 0xFA,
+    0xB3, 0x7B, 0x1D, 0x98, 0xC9, 0x17, 0x11, 0xF4, 0x42, 0xF4, 0x6D, 0xDE, 0x0D, 0x9D, 0xD1, 0xE0,
+    0x92, 0x1D, 0xEA, 0xC5, 0x2C, 0xCC, 0xF8, 0x1E, 0x80, 0x95, 0x82, 0x2A, 0xC0, 0xAA, 0x92, 0xBB,
+    0xE4, 0x98, 0x95, 0x9C, 0xBD, 0x9A, 0xF0, 0x4A, 0x48, 0x53, 0xD6, 0x56, 0x1B, 0xC1, 0x09, 0x8A,
+    0x91, 0x1F, 0xAB, 0x35, 0xEA, 0xA9, 0xD4, 0xF3, 0x58, 0xD7, 0xAF, 0xF7, 0x09, 0x4C, 0xDA, 0x8F,
+    0xEB, 0xBB, 0xF3, 0xCA, 0xA5, 0x58, 0x68, 0x81, 0xAA, 0x81, 0x1A, 0x78, 0x19, 0x7E, 0x3F, 0x92,
+    0x29, 0x50, 0x6C, 0x18, 0x9F, 0x77, 0xA7, 0xAD, 0x52, 0xA9, 0x25, 0x43, 0xB0, 0xF0, 0xBD, 0x94,
+    0x6B, 0x30, 0x1A, 0xB2, 0xEF, 0x4F, 0x98, 0x84, 0x49, 0x97, 0xBA, 0xA9, 0x53, 0xF4, 0x6A, 0x79,
+    0x07, 0x0E, 0xC0, 0x41, 0xF6, 0x5C, 0xC2, 0x26, 0xEC, 0x96, 0x59, 0xBE, 0xB5, 0xD1, 0x46, 0x16,
+    0x33, 0x53, 0xF5, 0x5D, 0x93, 0xA5, 0x6A, 0xA0, 0xBE, 0x9A, 0x30, 0x49, 0xE0, 0xBA, 0x9E, 0x42,
+    0x23, 0x74, 0x6A, 0xB0, 0x77, 0x27, 0x58, 0x5C, 0xC0, 0xFE, 0x7C, 0x26, 0x9B, 0x6D, 0xA4, 0x0E,
+    0x6A, 0x4C, 0x2A, 0x14, 0x5D, 0xEB, 0x16, 0x33, 0xE6, 0x1A, 0x20, 0x9B, 0x59, 0xD7, 0x9D, 0x49,
+    0x1B, 0x56, 0x6C, 0xE4, 0x92, 0x9D, 0xCD, 0xCF, 0x9A, 0x64, 0x47, 0x33, 0xD5, 0x7D, 0x31, 0x76,
+    0x6D, 0x79, 0x6B, 0xA1, 0xBC, 0x9B, 0xB0, 0x8A, 0x58, 0x0D, 0x54, 0x37, 0x22, 0xF5, 0xD5, 0x09,
+    0xB7, 0x93, 0x70, 0xAF, 0x29, 0xBA, 0x46, 0xD1, 0xD3, 0x0D, 0x50, 0x0E, 0x60, 0x7B, 0xB0, 0x61,
+    0x65, 0x74, 0xDD, 0xD2, 0x51, 0xF7, 0x36, 0xBE, 0x30, 0xB1, 0x3C, 0xBB, 0x50, 0xBD, 0xAF, 0x90,
+    0xCD, 0x2E, 0x3E, 0x44, 0xF7, 0xF9, 0x5D, 0xBA, 0xC1, 0x7E, 0x3E, 0x81, 0x5C, 0xC0, 0x7E, 0xB4,
+    0xB0, 0x19, 0xA7, 0xD6, 0xA4, 0xFF, 0x35, 0xE1, 0xDA, 0xAA, 0x37, 0x13, 0x22, 0x7F, 0x7B, 0xEF,
+    0xDB, 0xF6, 0x03, 0x17, 0xBC, 0x4F, 0x79, 0x52, 0xB0, 0x77, 0x67, 0xDC, 0xF9, 0x3E, 0xD3, 0x42,
+    0xA9, 0x48, 0x7D, 0x63, 0x60, 0xF1, 0xC1, 0xDC, 0x53, 0x5B, 0xDD, 0x10, 0xDD, 0x7F, 0xBD, 0x98,
+    0x64, 0x12, 0x74, 0xB8, 0x60, 0xA3, 0x1D, 0xAD, 0xDE, 0x9B, 0x51, 0xEA, 0x5A, 0xAB, 0x1B, 0x91,
+    0x7A, 0xE7, 0x4B, 0x54, 0x4C, 0x1B, 0xEE, 0xED, 0x52, 0xF1, 0xB3, 0x65, 0xCB, 0xBD, 0xAE, 0x31,
+    0xA9, 0x48, 0xB8, 0xD6, 0xF5, 0x66, 0xCA, 0x96, 0x55, 0x77, 0x05, 0x56, 0x33, 0x56, 0x89, 0xBD,
+    0xCB, 0x51, 0xF2, 0xF4, 0x8F, 0x61, 0xDB, 0x82, 0x6B, 0x84, 0xA7, 0x6B, 0xBD, 0x1A, 0x77, 0x4D,
+    0xD1, 0x8E, 0x52, 0xBE, 0xEC, 0x39, 0x3E, 0xF8, 0xB0, 0x4E, 0xFA, 0x7E, 0x22, 0x4F, 0x5D, 0x83,
+    0xBB, 0x39, 0x60, 0x34, 0x81, 0x57, 0x43, 0x79, 0x37, 0x81, 0xEA, 0x1E, 0x1B, 0x05, 0x8B, 0x8D,
+    0x54, 0xBD, 0x6F, 0xF3, 0x64, 0x12, 0x2E, 0xD4, 0xBD, 0x99, 0x32, 0xF1, 0xCD, 0x73, 0xED, 0x53,
+    0xAF, 0x29, 0x95, 0xA3, 0xD3, 0x6B, 0x0B, 0xC5, 0xE4, 0x5B, 0xFC, 0xF1, 0xB8, 0xB9, 0x55, 0x60,
+    0x15, 0x61, 0x16, 0x54, 0x57, 0x27, 0xF2, 0xE4, 0x02, 0xEE, 0xF2, 0x82, 0x99, 0x6C, 0xC4, 0x37,
+    0xBE, 0xA5, 0xC3, 0xF6, 0x36, 0x66, 0x33, 0x0B, 0x75, 0xA8, 0x7A, 0x93, 0xB2, 0x84, 0x6B, 0xEB,
+    0x60, 0x46, 0x93, 0xF0, 0x8D, 0x93, 0x62, 0x21, 0x89, 0x4E, 0x1A, 0xEC, 0x9D, 0xEF, 0xAD, 0xE3,
+    0xEC, 0x90, 0xA7, 0x6C, 0xC6, 0x85, 0x3A, 0x98, 0xC9, 0x24, 0xBC, 0x5C, 0x5B, 0xEA, 0xA3, 0x11,
+    0xCD, 0x9B, 0x55, 0x97, 0x27, 0xD6, 0x35, 0x65, 0x26, 0xC0, 0x37, 0x0F, 0x54, 0xCD, 0x4C, 0x66,
+    0x32, 0x63, 0x31, 0x16, 0x63, 0x19, 0xCB, 0x68, 0xEF, 0x1C, 0x8F, 0x56, 0x1A, 0xAC, 0xD4, 0x57,
+    0xBF, 0x38, 0x11, 0xEA, 0x50, 0x07, 0x17, 0x5C, 0x70, 0xAD, 0x9B, 0x5D, 0xE3, 0x93, 0x6F, 0xBA,
+    0xF4, 0x25, 0x97, 0x43, 0x11, 0xA1, 0x8C, 0x74, 0x58, 0xF5, 0x36, 0x66, 0x4A, 0x2C, 0xD4, 0x0A,
+    0x55, 0x6F, 0xE6, 0x23, 0x59, 0xC2, 0xB5, 0xD4, 0xC1, 0x8C, 0x98, 0x84, 0x6F, 0x70, 0x52, 0xA4,
+    0x90, 0x04, 0x9D, 0x34, 0x60, 0xEF, 0x7C, 0x6F, 0x86, 0x85, 0x3A, 0x60, 0x87, 0x3C, 0x91, 0xCD,
+    0xB8, 0x40, 0x1D, 0xCC, 0xB4, 0xBD, 0xA1, 0x2D, 0x23, 0x66, 0x44, 0x90, 0x9D, 0xCD, 0xCF, 0x9D,
+    0x35, 0xC9, 0x28, 0x99, 0xC9, 0x68, 0x2A, 0xC6, 0x62, 0xA4, 0x8C, 0x65, 0xA4, 0xBC, 0x73, 0x3C,
+    0x62, 0xA5, 0x01, 0x2B, 0xF5, 0x54, 0xBF, 0x38, 0x11, 0xA8, 0x43, 0x1D, 0x70, 0xC1, 0x05, 0x5C,
+    0xEB, 0x5A, 0x5C, 0xE3, 0x1B, 0x7C, 0xE3, 0x81, 0x4E, 0x0A, 0xA0, 0x07, 0xC7, 0x6C, 0x39, 0xE6,
+    0x5B, 0xB2, 0xB4, 0x71, 0x43, 0x1D, 0x98, 0x84, 0xC0, 0x4C, 0x2C, 0x50, 0x8C, 0x68, 0x69, 0xCA,
+    0x98, 0x49, 0x83, 0x8D, 0xB9, 0x34, 0xDA, 0xB8, 0xBA, 0x10, 0x33, 0x99, 0xB9, 0xEA, 0x8B, 0x31,
+    0x5B, 0xEA, 0x50, 0x44, 0x16, 0x17, 0xCA, 0xC8, 0xE2, 0x5A, 0x1B, 0x59, 0x5C, 0x63, 0x87, 0x6C,
+    0x7E, 0x60, 0x7B, 0x8B, 0x09, 0x68, 0xAA, 0x11, 0x90, 0x06, 0x40, 0x6A, 0x81, 0x6E, 0xDE, 0x98,
+    0xDF, 0xEC, 0xDC, 0xB9, 0xB7, 0x31, 0xD2, 0xB8, 0x1E, 0x8A, 0xB1, 0x8C, 0x94, 0xD1, 0x46, 0xCA,
+    0x68, 0x07, 0xEC, 0x50, 0xA9, 0xB5, 0x43, 0xA5, 0xB1, 0xEA, 0x6B, 0xA5, 0x3A, 0xB8, 0xAB, 0xB3,
+    0x0B, 0xEE, 0xD5, 0xC5, 0xB5, 0xBE, 0x59, 0x5C, 0xD3, 0xB1, 0xF8, 0xA6, 0x63, 0x61, 0x63, 0x57,
+    0x4C, 0x82, 0x47, 0xAA, 0x09, 0x2A, 0x45, 0xA8, 0x14, 0xA0, 0x5A, 0x78, 0xF0, 0xC9, 0x34, 0x50,
+    0x68, 0xA2, 0x50, 0xC2, 0x2C, 0x60, 0x96, 0xFC, 0x8B, 0x4C, 0x46, 0x7D, 0x77, 0x48, 0xC9, 0x5D,
+    0x49, 0xDE, 0x0E, 0x8B, 0xBD, 0x3A, 0xBA, 0xEF, 0xDE, 0x9A, 0xED, 0xE5, 0xE4, 0x0F, 0xC5, 0xA5,
+    0xEA, 0x93, 0xFF, 0xEE, 0xE4, 0x7C, 0xD0, 0x0B, 0x0A, 0x95, 0x14, 0x72, 0x49, 0x4D, 0x25, 0xF5,
+    0x50, 0x6D, 0x7C, 0xC8, 0x89, 0x01, 0xB7, 0x60, 0xD5, 0xE7, 0xCA, 0x70, 0x57, 0x54, 0x8C, 0x4A,
+    0x5D, 0x75, 0xE3, 0xFA, 0xED, 0x29, 0xA9, 0x3E, 0x7C, 0xFD, 0xF6, 0x9D, 0xA9, 0xAB, 0x54, 0x2C,
+    0xEA, 0x9D, 0x96, 0xB6, 0x53, 0x82, 0xBA, 0x05, 0xA0, 0xD0, 0x80, 0x57, 0xCA, 0xA4, 0xC9, 0xE8,
+    0xB9, 0xBF, 0xB1, 0xD3, 0xFA, 0xCC, 0xBA, 0x7F, 0x10, 0x95, 0xF8, 0x06, 0xBA, 0xCD, 0xD7, 0x37,
+    0xE0, 0x03, 0xB8, 0x61, 0x2F, 0x95, 0x44, 0x29, 0x91, 0x69, 0x86, 0x32, 0x80, 0xE9, 0xC1, 0x0C,
+    0xF0, 0xFD, 0x01, 0xD4, 0x83, 0x9A, 0x0D, 0x71, 0x1F, 0xE7, 0x4A, 0x56, 0x53, 0x3D, 0xFE, 0x91,
+    0x0B, 0xF8, 0x96, 0x0E, 0xB4, 0xFD, 0xE9, 0x9A, 0xC6, 0xAB, 0x77, 0xEA, 0x4B, 0xB5, 0x8C, 0x70,
+    0x01, 0x5E, 0x66, 0x4F, 0xA2, 0x4A, 0x54, 0x03, 0x80, 0x97, 0xAE, 0x49, 0x49, 0xD2, 0xFF, 0x70,
+    0xFC, 0xCE, 0x11, 0x04, 0x76, 0x20, 0x9B, 0xD9, 0x8D, 0x3E, 0xD7, 0xF8, 0xC7, 0x37, 0x6C, 0xC3,
+    0xA3, 0x01, 0x94, 0xA8, 0x14, 0x72, 0xFD, 0xDA, 0x85, 0x55, 0xE8, 0xD9, 0x99, 0x4B, 0x5C, 0xC2,
+    0x5E, 0x57, 0xB5, 0xE0, 0xB4, 0x28, 0x65, 0x7A, 0x5D, 0x2F, 0x8C, 0x65, 0xB2, 0x63, 0xD5, 0xBB,
+    0xE0, 0x82, 0x47, 0xD9, 0x9C, 0x27, 0x33, 0x95, 0xD1, 0xC6, 0xAA, 0xAF, 0x83, 0x6B, 0x3B, 0x96,
+    0x6C, 0x36, 0xC9, 0x4C, 0xC5, 0x68, 0x87, 0xAA, 0xAF, 0x92, 0x6B, 0x3A, 0xFC, 0xAD, 0x64, 0x12,
+    0x5D, 0x0B, 0x9B, 0x47, 0x9B, 0xF8, 0xC0, 0xD7, 0x76, 0x1B, 0xE7, 0xDE, 0x61, 0x6F, 0xCD, 0x74,
+    0x87, 0xA6, 0x22, 0xD9, 0xE8, 0x42, 0x7D, 0x65, 0xC6, 0x1F, 0x1E, 0x98, 0x85, 0xD1, 0x48, 0xA9,
+    0x96, 0x2A, 0x81, 0x5B, 0x43, 0x20, 0x33, 0xAD, 0x71, 0xE1, 0xBA, 0x14, 0xB0, 0xC3, 0x2A, 0x84,
+    0x17, 0x79, 0xEA, 0x8D, 0x58, 0x4C, 0x1E, 0x15, 0xB1, 0x1A, 0x9C, 0x49, 0x66, 0xF4, 0x8D, 0x3B,
+    0x1C, 0xCD, 0x9D, 0x99, 0xFA, 0x44, 0xC8, 0xEF, 0x8F, 0x54, 0x0B, 0x99, 0x02, 0x76, 0xE2, 0x61,
+    0x26, 0xF5, 0x0F, 0x33, 0xA9, 0x8C, 0x28, 0x9B, 0xE9, 0x1A, 0xD7, 0xFA, 0x60, 0xA3, 0x0B, 0x79,
+    0xAA, 0x7B, 0xFC, 0xE1, 0x01, 0x7B, 0x23, 0x62, 0x34, 0x42, 0x37, 0x41, 0x95, 0xC0, 0xCC, 0xF0,
+    0x98, 0x8E, 0x52, 0x4B, 0x58, 0x29, 0xE4, 0xE7, 0xEF, 0x9D, 0x59, 0x17, 0xD4, 0xB2, 0x71, 0x9A,
+    0x7B, 0xCF, 0xE4, 0x67, 0xCB, 0x58, 0x4C, 0x45, 0xB4, 0xB1, 0x88, 0xD5, 0x60, 0xA2, 0x0B, 0x66,
+    0xF4, 0x8D, 0x19, 0x85, 0xB9, 0x33, 0x93, 0xFF, 0x32, 0x91, 0xDF, 0x1F, 0xC9, 0x34, 0x90, 0x29,
+    0x80, 0xD6, 0xE0, 0xC1, 0x2B, 0xE1, 0x95, 0xE8, 0x34, 0x7D, 0x29, 0x42, 0xC6, 0xB5, 0xC5, 0x84,
+    0x0B, 0x36, 0x52, 0xF7, 0x75, 0x8F, 0x1D, 0x7C, 0xBB, 0x5A, 0xFB, 0xE2, 0xF3, 0xC4, 0x4A, 0x9D,
+    0xD1, 0x00, 0xB9, 0x02, 0x18, 0xB5, 0x60, 0x15, 0xA0, 0x56, 0x0F, 0xFE, 0xCD, 0x01, 0x64, 0x23,
+    0x66, 0x2E, 0x46, 0xCA, 0xC9, 0x68, 0xA8, 0xA2, 0xD1, 0xE0, 0x42, 0xA6, 0x7E, 0xE3, 0xEE, 0x71,
+    0x61, 0x1B, 0xFA, 0xB8, 0x06, 0xF0, 0x6C, 0xBD, 0xFE, 0x5F, 0x67, 0x4B, 0x91, 0x90, 0x8D, 0x74,
+    0x75, 0x8F, 0x53, 0x83, 0x5B, 0x56, 0x36, 0xD4, 0x23, 0xF8, 0x44, 0xA6, 0x84, 0x49, 0x0B, 0x36,
+    0x2A, 0xD5, 0xBD, 0x9F, 0xBA, 0xD6, 0x3D, 0x30, 0xBF, 0xD8, 0x61, 0xF3, 0xED, 0xBD, 0xF4, 0xC2,
+    0x6D, 0x69, 0x76, 0xD7, 0xA5, 0xB8, 0x3C, 0xE6, 0x3F, 0xF8, 0xEE, 0x88, 0x56, 0x9B, 0xDA, 0x51,
+    0xF5, 0x26, 0xD1, 0x61, 0x07, 0x93, 0xF0, 0x8D, 0x8D, 0x79, 0xC2, 0xB5, 0x36, 0x66, 0xF3, 0x6A,
+    0x69, 0x67, 0x5C, 0x28, 0x46, 0x44, 0xFD, 0xEF, 0x8C, 0xA4, 0xB1, 0x92, 0x14, 0x3A, 0x49, 0x5B,
+    0x4B, 0x66, 0x87, 0x8D, 0xFB, 0xC8, 0xD3, 0x83, 0xF0, 0xF1, 0xA9, 0x73, 0x7F, 0x75, 0xB6, 0xD3,
+    0xED, 0xD4, 0xE9, 0xF3, 0xB4, 0x3A, 0x94, 0x5D, 0x77, 0x12, 0xCB, 0x68, 0x07, 0x3B, 0x54, 0x83,
+    0x1D, 0x5C, 0x6F, 0x87, 0x2E, 0x58, 0x29, 0x95, 0xBA, 0x3E, 0x99, 0xA5, 0x1C, 0x57, 0x07, 0x62,
+    0xE2, 0xE6, 0x2D, 0x06, 0xB0, 0x7D, 0xD5, 0xE7, 0x53, 0x15, 0xCC, 0x54, 0x87, 0x62, 0x74, 0xA1,
+    0x88, 0xAE, 0x2D, 0xA3, 0x6F, 0x6C, 0xEC, 0xB0, 0x43, 0x47, 0xD5, 0x77, 0x8D, 0x0F, 0x9D, 0x14,
+    0x9C, 0x14, 0xEC, 0xE2, 0xB7, 0xB6, 0x61, 0x8D, 0x08, 0x50, 0x02, 0xAD, 0xAC, 0xFA, 0xF5, 0x8C,
+    0x67, 0x00, 0x78, 0xAA, 0x79, 0xEA, 0x78, 0x5F, 0x5D, 0x8D, 0xE5, 0xED, 0x64, 0x92, 0xB2, 0xC5,
+    0xB5, 0x3A, 0x3C, 0x76, 0x3B, 0x52, 0xF4, 0xF7, 0xA7, 0xBD, 0x1F, 0x2F, 0xE0, 0x1B, 0x6A, 0x61,
+    0xD7, 0xA8, 0xD3, 0x44, 0xB2, 0x04, 0x1D, 0xB8, 0x76, 0xA5, 0x2E, 0x75, 0x8D, 0xFD, 0xF9, 0x9A,
+    0x38, 0xCC, 0xAE, 0x2D, 0x6F, 0xCD, 0x7F, 0xEC, 0xAE, 0x8D, 0x71, 0xA9, 0x77, 0x5E, 0x1F, 0xBB,
+    0x7F, 0xEB, 0xAF, 0x48, 0x32, 0x52, 0x2A, 0xF4, 0xD6, 0xC0, 0x4B, 0xBE, 0xC9, 0xDE, 0x4B, 0x94,
+    0x36, 0x72, 0x60, 0x9B, 0x88, 0x8C, 0x2B, 0x05, 0xF6, 0xC3, 0x58, 0xDC, 0x4E, 0x79, 0xD2, 0x77,
+    0xE4, 0xFE, 0xA7, 0xEE, 0xCD, 0xFB, 0x7A, 0x4F, 0x8A, 0x4E, 0x29, 0x9F, 0x16, 0x7E, 0xCF, 0xB5,
+    0x45, 0xD5, 0x67, 0x2F, 0xAC, 0x69, 0xC6, 0xF6, 0xD5, 0x16, 0xC8, 0x96, 0xD5, 0xC0, 0xE7, 0x09,
+    0xCC, 0xDC, 0x0D, 0xEB, 0x44, 0x4A, 0xE5, 0x5C, 0xCC, 0x36, 0x66, 0xB3, 0x8D, 0x79, 0xB2, 0x43,
+    0x9E, 0xAA, 0xDE, 0xA4, 0x3A, 0x98, 0xC9, 0x85, 0x62, 0x74, 0xA1, 0x1C, 0x5D, 0x6B, 0xE3, 0x43,
+    0x19, 0x53, 0xB5, 0x66, 0x4C, 0xF5, 0xD5, 0xC1, 0xDC, 0x57, 0x70, 0x5A, 0x8A, 0xA5, 0x8A, 0x5D,
+    0x90, 0x8D, 0x76, 0x10, 0x6B, 0xE6, 0x9C, 0xA7, 0x3A, 0xB8, 0x9D, 0x64, 0x26, 0xD7, 0xBA, 0x43,
+    0x63, 0x11, 0xFD, 0x26, 0x61, 0x00, 0xF6, 0xAA, 0x87, 0x5A, 0xE3, 0x9A, 0x9A, 0x18, 0x3D, 0x3F,
+    0xEF, 0x29, 0x52, 0x36, 0xBB, 0xC3, 0x31, 0x9B, 0x5D, 0x35, 0x14, 0xC9, 0xE9, 0x53, 0x4D, 0x4E,
+    0x6B, 0x14, 0xB1, 0x80, 0xFF, 0xA0, 0xD9, 0xAA, 0xFC, 0xEE, 0x0A, 0xA8, 0x63, 0xDE, 0x60, 0xA5,
+    0x96, 0x42, 0x6A, 0xA1, 0xDB, 0xF5, 0x4F, 0x27, 0x06, 0x8C, 0x12, 0x56, 0xCB, 0xB7, 0x5D, 0xDF,
+    0x5D, 0xF0, 0x8D, 0x2E, 0x74, 0xF9, 0xD2, 0x49, 0xC9, 0x49, 0xC3, 0x5E, 0xBD, 0xBD, 0xFA, 0x38,
+    0xF1, 0x28, 0xFA, 0x34, 0xE2, 0x14, 0xB1, 0x3A, 0xFD, 0x90, 0x77, 0xFB, 0xCF, 0x47, 0x9F, 0x6B,
+    0xB7, 0xB1, 0x53, 0xC7, 0x46, 0x2A, 0x3C, 0xF0, 0xAB, 0xBF, 0x25, 0xE1, 0xE6, 0x57, 0x17, 0x71,
+    0x0F, 0x5A, 0xD0, 0x82, 0x26, 0xEA, 0x80, 0x0B, 0xB8, 0x16, 0xD7, 0xE0, 0x9B, 0x8D, 0xD3, 0x5A,
+    0xC8, 0x66, 0xF2, 0xB4, 0xA9, 0x66, 0x54, 0x0B, 0x5E, 0x4D, 0xA7, 0x06, 0x38, 0x9A, 0x35, 0x80,
+    0x89, 0x75, 0x03, 0x94, 0xFF, 0x31, 0xC1, 0xC6, 0x3E, 0xC1, 0xDE, 0xB7, 0x77, 0x09, 0xCD, 0x27,
+    0x66, 0x44, 0x11, 0xCD, 0x58, 0x8E, 0xD8, 0xA1, 0x0A, 0xBE, 0xA5, 0x0E, 0x9D, 0x49, 0xE0, 0x0E,
+    0x4D, 0x2E, 0x40, 0x67, 0x7F, 0x3E, 0x03, 0xB3, 0x3F, 0x3E, 0x80, 0x59, 0xD7, 0xBF, 0x95, 0xE2,
+    0x6E, 0xFC, 0x54, 0xCC, 0x4B, 0xD7, 0x80, 0xBF, 0x3A, 0x0A, 0xCC, 0x5C, 0xEF, 0x24, 0x70, 0x83,
+    0x8A, 0x91, 0x5C, 0x66, 0xB2, 0x91, 0x2A, 0xDA, 0xDE, 0x05, 0xD4, 0x78, 0xBA, 0xD6, 0x4E, 0x79,
+    0x42, 0x40, 0xD6, 0xEC, 0x01, 0x38, 0x69, 0x22, 0x60, 0xEE, 0xCC, 0x00, 0xB5, 0x5A, 0x80, 0x13,
+    0xBB, 0x32, 0xDC, 0xE4, 0xA2, 0x6E, 0x2C, 0x63, 0x9D, 0x8C, 0xC2, 0x52, 0xAA, 0xCD, 0x67, 0xDB,
+    0x0B, 0xEC, 0xBB, 0x73, 0x1D, 0x60, 0xA9, 0x77, 0x26, 0xB0, 0x92, 0x20, 0x93, 0x14, 0xA1, 0xFE,
+    0x6C, 0x11, 0x98, 0xE4, 0xCB, 0x08, 0xDD, 0x0B, 0xB1, 0x6B, 0xB2, 0x6E, 0x90, 0x59, 0x5A, 0x97,
+    0xEC, 0x50, 0xA7, 0x62, 0x61, 0xA6, 0x0B, 0xDB, 0x29, 0xFE, 0x41, 0x09, 0x5D, 0x82, 0x4E, 0xD3,
+    0xFA, 0xDE, 0xFA, 0x9E, 0x1A, 0x3B, 0x14, 0xDB, 0x28, 0x3B, 0x4F, 0x26, 0x51, 0x07, 0xD7, 0xE6,
+    0xC9, 0x8C, 0xB8, 0xB0, 0x89, 0xF0, 0xD4, 0x80, 0x8B, 0x54, 0x4A, 0x64, 0x6B, 0xB0, 0xDF, 0xF2,
+    0x95, 0x59, 0x9D, 0xDD, 0x4D, 0x4F, 0x66, 0x2A, 0x89, 0xFA, 0x03, 0x6D, 0x42, 0xED, 0x3A, 0xB8,
+    0xA6, 0x0A, 0x7E, 0xB7, 0x2E, 0xE3, 0xDB, 0x2C, 0x53, 0x63, 0xB4, 0x60, 0x34, 0x91, 0xAF, 0xE5,
+    0x28, 0x40, 0x1A, 0xC9, 0xA4, 0x48, 0x2E, 0x45, 0xCC, 0x7C, 0x3C, 0x62, 0x46, 0x3B, 0x50, 0xC4,
+    0xAA, 0xA7, 0x8C, 0x75, 0xC0, 0x0E, 0x2E, 0x50, 0xF5, 0xAE, 0xA5, 0x0E, 0xAE, 0xC5, 0x05, 0xDF,
+    0xE0, 0x9B, 0x0E, 0xBA, 0x55, 0x91, 0x16, 0xCC, 0x9C, 0x2D, 0x47, 0xBB, 0x29, 0x53, 0x52, 0xCC,
+    0x35, 0x76, 0xC1, 0x28, 0xB2, 0x6A, 0xE1, 0xEA, 0xB0, 0x7C, 0xBB, 0x51, 0xF5, 0xEC, 0xC1, 0x12,
+    0xFD, 0x82, 0x4C, 0x6A, 0x91, 0x7A, 0xBA, 0xD7, 0x47, 0xDC, 0x6B, 0x89, 0x3A, 0x08, 0x1B, 0x5D,
+    0x5B, 0x8C, 0xB6, 0xCF, 0x53, 0x11, 0x59, 0xF2, 0x44, 0xD7, 0x28, 0x57, 0x70, 0x7F, 0xD7, 0xF5,
+    0x95, 0xEA, 0xBE, 0x54, 0x58, 0x1F, 0x5C, 0xC4, 0xD5, 0xF2, 0xE7, 0x1B, 0x57, 0xFE, 0xE5, 0x9C,
+    0x67, 0x30, 0x29, 0x9B, 0x71, 0x6D, 0x1D, 0x8A, 0xAF, 0xCA, 0x79, 0x44, 0x1D, 0xEC, 0x66, 0xDC,
+    0x6E, 0xCE, 0xD3, 0xB8, 0xB6, 0x8C, 0x66, 0x42, 0x1B, 0x37, 0x95, 0xCF, 0x64, 0x74, 0x81, 0x5A,
+    0x23, 0xB9, 0x16, 0xA8, 0xB7, 0xC1, 0x60, 0x76, 0x36, 0x3F, 0x6B, 0xA3, 0x1D, 0x5C, 0xEB, 0x5E,
+    0x9D, 0xB3, 0xB9, 0x8C, 0x65, 0x74, 0x1F, 0xF8, 0x20, 0x2D, 0x46, 0x1A, 0xAB, 0x5F, 0x9C, 0x08,
+    0x1D, 0x9D, 0x49, 0x26, 0xD9, 0xC1, 0x0E, 0xAE, 0xF1, 0xCF, 0xCD, 0x0F, 0xCA, 0x53, 0x59, 0x31,
+    0x63, 0x15, 0x71, 0x82, 0x6E, 0xD8, 0x6A, 0x93, 0xED, 0x57, 0x7F, 0x3A, 0xE4, 0xAB, 0x5B, 0xCD,
+    0xD2, 0x97, 0xFD, 0xA9, 0x14, 0x0A, 0x49, 0xD4, 0xD2, 0x84, 0x8E, 0x9D, 0xE8, 0xD7, 0x90, 0x6C,
+    0x3B, 0x3C, 0x4F, 0xB8, 0x1F, 0xD9, 0x98, 0x29, 0xB9, 0xB6, 0x54, 0x3F, 0xE3, 0xC4, 0x26, 0x20,
+    0xA9, 0xC3, 0xC6, 0xC8, 0x94, 0x91, 0x35, 0xEE, 0xFD, 0xC7, 0x67, 0x6E, 0xCB, 0x83, 0xCC, 0xCD,
+    0x6C, 0x1D, 0xE2, 0xB6, 0xEC, 0xD7, 0x56, 0x7D, 0x3E, 0x79, 0xEC, 0xCF, 0x13, 0xFE, 0x70, 0xCC,
+    0x92, 0x6B, 0xCB, 0x5B, 0x33, 0xEE, 0x5A, 0x64, 0xA9, 0x43, 0x31, 0x76, 0xED, 0xAE, 0x4B, 0x33,
+    0x7A, 0xEB, 0x4B, 0xB5, 0xBA, 0x4A, 0x2D, 0xDD, 0x8C, 0xD1, 0xF8, 0x9B, 0x8A, 0x78, 0xFF, 0x40,
+    0x57, 0x5B, 0x2A, 0x18, 0x45, 0x34, 0xE1, 0x59, 0xB3, 0x40, 0xCC, 0xB8, 0x96, 0x8B, 0xBA, 0x1E,
+    0x17, 0x8D, 0x9A, 0x5C, 0xC1, 0xCE, 0xD8, 0x05, 0x3F, 0xD1, 0x8D, 0x99, 0x06, 0xA3, 0x50, 0xDE,
+    0x6C, 0xEB, 0x0E, 0x77, 0x92, 0x25, 0x91, 0x52, 0x79, 0x63, 0x28, 0x3E, 0x8F, 0xCE, 0x35, 0xF5,
+    0xF5, 0x2B, 0xB7, 0x12, 0x8B, 0xAB, 0xDE, 0x88, 0x66, 0x4C, 0xA9, 0x6E, 0xED, 0xCE, 0xDD, 0x61,
+    0xC1, 0x97, 0x32, 0x63, 0x3E, 0xD5, 0x53, 0xF5, 0x81, 0x1D, 0xBA, 0xD0, 0xCD, 0xEE, 0xF9, 0xC5,
+    0x28, 0xA6, 0x22, 0xAE, 0x0B, 0x34, 0x5B, 0x0D, 0xE5, 0xF0, 0x70, 0xC0, 0xCC, 0x1A, 0x0D, 0xAF,
+    0xC9, 0x59, 0xB3, 0xEF, 0x2C, 0x1A, 0x4A, 0xE1, 0x26, 0xA3, 0x60, 0x97, 0x5C, 0x43, 0xA1, 0x56,
+    0x63, 0x7E, 0x3F, 0x5E, 0x4A, 0xCC, 0xC9, 0x79, 0x9C, 0xAB, 0x4F, 0xB4, 0xD5, 0xF5, 0xEB, 0xD7,
+    0xFB, 0xF2, 0xF3, 0xFB, 0xEF, 0x8F, 0xF9, 0xD4, 0xDD, 0x4A, 0xCC, 0xF5, 0xD8, 0x9D, 0x75, 0xE5,
+    0xE4, 0x96, 0xEA, 0x4A, 0xB2, 0xDA, 0x0D, 0xCB, 0x6D, 0xBF, 0x15, 0xA8, 0x19, 0x37, 0x05, 0xB1,
+    0xDF, 0xD2, 0xE4, 0xEF, 0xCF, 0x1A, 0xCA, 0xFE, 0x24, 0xF8, 0x13, 0x61, 0x0D, 0x4F, 0x77, 0x0D,
+    0x7D, 0x35, 0x6E, 0x22, 0x54, 0x3F, 0x81, 0xBD, 0xD9, 0x92, 0xCD, 0x09, 0xDC, 0xF1, 0x40, 0x11,
+    0x13, 0x2C, 0x36, 0x50, 0x87, 0x84, 0x99, 0x6C, 0x4F, 0xF7, 0xA3, 0x19, 0x2B, 0x0D, 0xB9, 0xB4,
+    0xE0, 0xA4, 0x58, 0x46, 0x3A, 0x96, 0xD5, 0x88, 0x74, 0x66, 0xA2, 0x88, 0xEC, 0xCF, 0x1A, 0x1B,
+    0x2E, 0x72, 0xA9, 0x0A, 0x46, 0x91, 0x72, 0x2D, 0xAD, 0x9D, 0xFC, 0x17, 0xA7, 0xDD, 0x9C, 0xAC,
+    0x74, 0x59, 0x87, 0x93, 0x0B, 0xFE, 0xF5, 0xA9, 0x18, 0xBB, 0xC6, 0xDB, 0x58, 0x46, 0xB1, 0xD8,
+    0x58, 0x0D, 0x32, 0x73, 0x29, 0x05, 0xB7, 0xA4, 0x4C, 0xC7, 0x37, 0xE6, 0xF0, 0x89, 0xB2, 0xC1,
+    0x5E, 0x8D, 0x98, 0x5B, 0x13, 0x1C, 0xD9, 0xBF, 0xFE, 0xB1, 0x98, 0x57, 0x7A, 0x33, 0x0D, 0xB0,
+    0x4C, 0xE0, 0xFD, 0x4A, 0x6E, 0xB5, 0x13, 0xB1, 0x43, 0xA2, 0x8C, 0x0E, 0x33, 0xD9, 0x3E, 0x5F,
+    0xFE, 0x6C, 0x44, 0x5A, 0xE8, 0xA4, 0xD6, 0x49, 0xB1, 0x0E, 0x79, 0xB2, 0x03, 0x5D, 0x19, 0xA9,
+    0x77, 0x26, 0x8A, 0xC8, 0xD3, 0xDF, 0xA4, 0xFC, 0x68, 0xE4, 0x92, 0x23, 0x6B, 0x8E, 0x00, 0x14,
+    0x1F, 0xFF, 0xB9, 0xD1, 0x8D, 0x20, 0xA5, 0x6A, 0xD4, 0x4E, 0x2A, 0x26, 0xDF, 0xFA, 0x17, 0xC6,
+    0x22, 0x8A, 0xCE, 0x46, 0x3B, 0x28, 0x5B, 0x6C, 0x74, 0x7D, 0xA7, 0x64, 0x74, 0x33, 0x54, 0x77,
+    0xA6, 0x6D, 0xA2, 0x2C, 0x05, 0x70, 0x52, 0x82, 0x52, 0x52, 0x4B, 0xB6, 0x74, 0xC7, 0x8E, 0x80,
+    0xBB, 0x16, 0x81, 0x72, 0x5C, 0x0D, 0xA3, 0x1D, 0x00, 0x77, 0x59, 0x0A, 0x94, 0x63, 0xAD, 0x04,
+    0xCA, 0xA5, 0x80, 0xFB, 0x85, 0xFF, 0xE0, 0x08, 0x85, 0x34, 0x01, 0x92, 0x1A, 0xA8, 0xA5, 0x08,
+    0xC5, 0x6A, 0xA6, 0x84, 0x95, 0xA8, 0x7B, 0xA4, 0x68, 0x12, 0x95, 0x16, 0xF0, 0xFF, 0xE2, 0xFB,
+    0x1F, 0xA3, 0xBB, 0x52, 0x23, 0x49, 0xD1, 0xEF, 0xE8, 0xD5, 0xE4, 0x82, 0x6F, 0xBB, 0x6A, 0xA8,
+    0x7A, 0x7F, 0x2D, 0x16, 0xD2, 0x4E, 0xCA, 0xA5, 0x56, 0xE8, 0xAF, 0x70, 0xC1, 0xB7, 0xD8, 0xE8,
+    0x62, 0x96, 0x4B, 0xFA, 0x71, 0x70, 0x8B, 0x14, 0x8B, 0xF9, 0x15, 0x8D, 0x1B, 0x2D, 0xD8, 0xC3,
+    0x51, 0xAA, 0x36, 0x61, 0x3F, 0x1C, 0x29, 0x35, 0xC0, 0x9F, 0x6F, 0x6C, 0x96, 0xC6, 0xAF, 0x6C,
+    0x15, 0x48, 0x4D, 0xB1, 0x49, 0xAC, 0xED, 0x9D, 0x63, 0x5F, 0x6E, 0x15, 0xF4, 0xE0, 0x94, 0x76,
+    0xBF, 0xEC, 0xCF, 0x9A, 0xB2, 0xDF, 0x68, 0xC5, 0xB8, 0xD5, 0x8A, 0xFA, 0x63, 0x6A, 0xF5, 0xA5,
+    0x94, 0x2D, 0xC5, 0xE8, 0x82, 0x2F, 0xC6, 0x2A, 0x76, 0x9A, 0xAD, 0x16, 0xF4, 0x57, 0xD8, 0x08,
+    0x1D, 0x8F, 0x16, 0xCB, 0xF9, 0xC6, 0x69, 0x7C, 0x28, 0xF4, 0x83, 0x13, 0x6A, 0x90, 0x06, 0xA4,
+    0x89, 0xBE, 0x4C, 0x90, 0xCF, 0x1B, 0xF3, 0xB7, 0xC0, 0x63, 0x0B, 0x5E, 0x4B, 0x21, 0xCD, 0x56,
+    0x9F, 0xCD, 0x6E, 0x30, 0xC9, 0x85, 0x72, 0x72, 0x6D, 0x15, 0x5D, 0xF0, 0xBD, 0x93, 0xDA, 0x4A,
+    0xCB, 0x9A, 0x9E, 0x01, 0x74, 0x43, 0x26, 0x35, 0x5E, 0xF1, 0xBF, 0xC8, 0x17, 0x70, 0x01, 0x1B,
+    0x1F, 0x57, 0x72, 0x5A, 0xDC, 0x2F, 0xBA, 0xC3, 0xBD, 0xBB, 0x1A, 0xAB, 0x61, 0x39, 0x11, 0x9D,
+    0xE2, 0xD6, 0xA1, 0xE6, 0xFD, 0x4F, 0x30, 0xB7, 0x27, 0x8A, 0xDB, 0xD3, 0x56, 0x6D, 0xFE, 0x49,
+    0x09, 0x7A, 0xBA, 0x6C, 0xAA, 0x6B, 0x43, 0x71, 0x7B, 0xDC, 0xA8, 0x7C, 0x3D, 0xE1, 0xD5, 0x57,
+    0x4A, 0x7B, 0xE9, 0x5A, 0x6C, 0xC4, 0xA4, 0xBD, 0x92, 0x95, 0xDE, 0xFC, 0xE2, 0xC4, 0xFB, 0xA3,
+    0xBD, 0x95, 0x8A, 0xC9, 0xFD, 0xCF, 0xC9, 0x2A, 0xD1, 0x6D, 0xA5, 0xF9, 0xF4, 0xBE, 0xB5, 0x80,
+    0x3E, 0x03, 0x94, 0x1F, 0x45, 0x80, 0x3D, 0x59, 0xB3, 0xCB, 0xBF, 0x4B, 0xB8, 0xC6, 0x85, 0x2C,
+    0x31, 0xE7, 0x33, 0x66, 0x2A, 0x62, 0x35, 0x50, 0xC6, 0x3A, 0x08, 0x6C, 0xBF, 0xD8, 0x08, 0xF5,
+    0xCE, 0xD4, 0x35, 0xE0, 0x8E, 0x7F, 0xB8, 0xD1, 0xC9, 0x00, 0x66, 0xED, 0x31, 0xAC, 0xAA, 0x99,
+    0xC9, 0x9F, 0xEF, 0xA1, 0xBA, 0x35, 0xBB, 0x00, 0x7A, 0x21, 0x0A, 0xEC, 0xE4, 0x2E, 0xCF, 0xD0,
+    0x85, 0xC5, 0x24, 0x8A, 0x64, 0x46, 0x1B, 0x71, 0x7D, 0x15, 0xEA, 0xC1, 0x2C, 0x74, 0x6B, 0xC4,
+    0x9C, 0x9D, 0x79, 0x07, 0xC0, 0x1D, 0x0E, 0x80, 0x89, 0x09, 0x60, 0xCF, 0x9E, 0x5D, 0xCA, 0x5C,
+    0xBB, 0xF7, 0x4C, 0x9E, 0x8C, 0x9A, 0x2E, 0x57, 0x70, 0xC9, 0x0E, 0xDD, 0x44, 0xDD, 0xCF, 0x36,
+    0xC2, 0x5C, 0xBD, 0x97, 0xC0, 0xFE, 0x3C, 0xB9, 0x16, 0xD6, 0x68, 0xAE, 0x92, 0x04, 0xF9, 0xD2,
+    0xDD, 0x8C, 0xE0, 0xAE, 0xC6, 0x0E, 0xCA, 0xB1, 0x2B, 0x47, 0x1E, 0x5F, 0x6C, 0x74, 0x7F, 0x6B,
+    0x14, 0x96, 0x5C, 0xC1, 0x0F, 0xB6, 0x2F, 0xD3, 0x76, 0x86, 0xF2, 0xF9, 0x16, 0x5F, 0xB7, 0x59,
+    0xBA, 0xB8, 0x95, 0xDE, 0x3F, 0x45, 0x53, 0x01, 0xE0, 0xC9, 0x27, 0xA8, 0xDF, 0x0C, 0xF6, 0xFD,
+    0xC8, 0x91, 0x23, 0x00, 0xE7, 0x3F, 0x46, 0x0A, 0xB5, 0xA6, 0x0C, 0x81, 0x6B, 0xF7, 0x9C, 0x08,
+    0xA5, 0x5A, 0xA3, 0x81, 0xEF, 0x6D, 0x35, 0xED, 0x52, 0x37, 0xD5, 0x4A, 0xC5, 0xA6, 0x7D, 0xB4,
+    0x96, 0x1A, 0x12, 0xD2, 0xC4, 0x31, 0x3F, 0x40, 0xD7, 0x90, 0xCF, 0x60, 0xC7, 0xD5, 0xCB, 0xB8,
+    0x19, 0xBC, 0xDA, 0xD5, 0xBF, 0xD7, 0xFD, 0xB6, 0x2B, 0xF7, 0x47, 0x74, 0xC1, 0xDD, 0x54, 0xE3,
+    0x34, 0x53, 0x6F, 0xB5, 0xE8, 0xC5, 0x73, 0x67, 0x77, 0x9F, 0x45, 0x3D, 0x80, 0x6F, 0xC9, 0x96,
+    0x35, 0x00, 0xAD, 0x7A, 0x70, 0x1F, 0x83, 0x5F, 0xE0, 0xA9, 0xED, 0xF3, 0x5C, 0xE0, 0xA1, 0x48,
+    0xF2, 0x4F, 0x73, 0x35, 0x4E, 0x0B, 0x4E, 0x13, 0x8F, 0x6F, 0xC3, 0x53, 0xCE, 0xFD, 0x35, 0x58,
+    0xF5, 0x6B, 0xE2, 0xBC, 0x51, 0xA4, 0xC1, 0xF6, 0xE5, 0xC2, 0x9C, 0xA9, 0xAF, 0x82, 0x4B, 0x79,
+    0x2A, 0x15, 0x5C, 0xBB, 0x4C, 0x66, 0x74, 0xBE, 0xF5, 0xE5, 0xE7, 0x63, 0x11, 0x93, 0xA7, 0x73,
+    0x6F, 0x44, 0xFB, 0x49, 0x5C, 0x98, 0x67, 0xDB, 0x57, 0x6A, 0xE7, 0x5C, 0xB1, 0x0A, 0x6E, 0xCE,
+    0x93, 0x51, 0xEB, 0x5A, 0x17, 0xCD, 0x58, 0xCC, 0x78, 0x78, 0xEA, 0x1C, 0x85, 0x22, 0x9D, 0x00,
+    0xF6, 0x9D, 0xD9, 0x77, 0x7A, 0x61, 0xAE, 0xFA, 0xEA, 0x72, 0x7A, 0x28, 0xD3, 0xF4, 0xDF, 0x1D,
+    0xCB, 0xE8, 0x51, 0x19, 0xAB, 0xA1, 0x33, 0x4B, 0x29, 0xF5, 0x6E, 0x4E, 0x99, 0x0E, 0x6F, 0xE2,
+    0xF6, 0x9F, 0x3C, 0x09, 0xD5, 0xB5, 0x81, 0x2C, 0x5D, 0x7C, 0xA0, 0xF6, 0xE5, 0x60, 0x16, 0x66,
+    0xBA, 0xC1, 0xF6, 0xD5, 0x9C, 0x25, 0xA3, 0x50, 0x87, 0x2E, 0x99, 0xC9, 0xDE, 0x6C, 0xDD, 0xA1,
+    0xBB, 0x53, 0x11, 0x3B, 0xD7, 0x78, 0x7B, 0x35, 0x96, 0x9F, 0x4F, 0x1D, 0x8B, 0xB7, 0x83, 0xBD,
+    0xD1, 0xCF, 0x99, 0x26, 0xDB, 0xD7, 0xCA, 0x92, 0x51, 0x5F, 0x07, 0x37, 0x99, 0xC9, 0x08, 0xD7,
+    0xF8, 0xBE, 0x88, 0xF0, 0xF4, 0x3E, 0x8A, 0xCF, 0x47, 0x2E, 0xB9, 0x66, 0xA3, 0x47, 0xE7, 0xF8,
+    0x6B, 0x3B, 0xD8, 0x77, 0xE7, 0x2C, 0x55, 0xA1, 0xBE, 0x92, 0x4C, 0x72, 0xC1, 0x9D, 0x9A, 0x8A,
+    0xD1, 0x37, 0x5D, 0x11, 0x6D, 0xEC, 0xB2, 0xA5, 0x8C, 0x6E, 0xE8, 0x34, 0x1B, 0xDD, 0x08, 0xD5,
+    0xB8, 0xB2, 0x30, 0x1B, 0x7E, 0x02, 0xB3, 0x07, 0x57, 0xB5, 0x64, 0x1B, 0x62, 0x33, 0x7D, 0x4C,
+    0x21, 0xB5, 0x85, 0x34, 0x9A, 0x25, 0x97, 0x59, 0x70, 0x97, 0x45, 0x39, 0x76, 0x4D, 0x36, 0xBB,
+    0x80, 0x3F, 0x3C, 0x50, 0x7D, 0x38, 0x52, 0xFE, 0x72, 0xC6, 0xA4, 0xAE, 0xC9, 0x54, 0xF5, 0x74,
+    0xDF, 0x4D, 0xF8, 0xA0, 0xB6, 0xEB, 0xAB, 0xD5, 0x45, 0x0F, 0x54, 0x5B, 0xC9, 0x3D, 0xF9, 0x04,
+    0xEE, 0xF0, 0x43, 0xAA, 0xF9, 0xF8, 0x84, 0x53, 0x70, 0x4A, 0x75, 0x94, 0x8D, 0xD5, 0x87, 0xA3,
+    0xB9, 0x97, 0x98, 0x85, 0xF7, 0xA1, 0xBE, 0x1E, 0xED, 0xED, 0x54, 0x8E, 0x5E, 0xA9, 0x54, 0xA2,
+    0x9B, 0x1E, 0xAA, 0x07, 0xFF, 0x0A, 0x55, 0x33, 0xF5, 0xE5, 0x85, 0x62, 0xEC, 0x60, 0x76, 0x9F,
+    0x9E, 0xD3, 0x61, 0x49, 0x1F, 0x4A, 0xFA, 0xE5, 0x7C, 0xEC, 0xCF, 0x52, 0x07, 0x2B, 0x55, 0x13,
+    0x2E, 0xA8, 0xF1, 0xBF, 0x81, 0xAA, 0x13, 0x03, 0x12, 0x52, 0xEC, 0x5E, 0x4B, 0x2E, 0xB8, 0xE3,
+    0xBD, 0xFD, 0x4C, 0xBA, 0x2B, 0xCD, 0x3A, 0x26, 0x17, 0xDC, 0xB5, 0x58, 0xBF, 0xAB, 0x2E, 0xD6,
+    0x8A, 0xF9, 0x46, 0xAB, 0xF3, 0x77, 0xCF, 0x90, 0x4F, 0x33, 0x5C, 0x72, 0x0F, 0x24, 0xFB, 0x4F,
+    0x4E, 0xD6, 0x4B, 0x4F, 0xE3, 0xAA, 0x60, 0xAF, 0x0E, 0x1B, 0xB9, 0x3E, 0x60, 0xD6, 0xD0, 0xD9,
+    0x68, 0x3F, 0x1C, 0xCD, 0x3D, 0x69, 0x96, 0xE4, 0x3F, 0xF0, 0x5B, 0x66, 0xDD, 0x7C, 0x98, 0x59,
+    0xFB, 0x8A, 0x16, 0x77, 0x38, 0xE0, 0x6C, 0xD8, 0xDA, 0xB6, 0xAC, 0x9B, 0x31, 0x52, 0x9B, 0x4B,
+    0x43, 0x76, 0xBA, 0x8E, 0x50, 0x8E, 0x9B, 0xE6, 0xC8, 0xC4, 0x8B, 0x3F, 0x9E, 0x90, 0x26, 0xA4,
+    0x91, 0x73, 0xE7, 0x37, 0x75, 0xA8, 0x6A, 0x00, 0x17, 0xFE, 0x65, 0xA6, 0xD6, 0x4B, 0x78, 0x4D,
+    0x6B, 0xF5, 0x70, 0x55, 0xF0, 0x3C, 0xCD, 0xF9, 0x94, 0x56, 0x07, 0xB1, 0x77, 0xC1, 0xAA, 0x2F,
+    0x15, 0x29, 0x36, 0x6D, 0x4A, 0xA3, 0x54, 0x28, 0x65, 0xDF, 0x9F, 0x28, 0x46, 0xAA, 0xF8, 0xDF,
+    0xAB, 0xF7, 0x6A, 0xFD, 0x5A, 0x4F, 0xDE, 0x7B, 0xEE, 0xCC, 0xB6, 0xC3, 0xB4, 0xF2, 0xB4, 0x8C,
+    0xB8, 0xE0, 0x9B, 0x72, 0x34, 0x23, 0xC2, 0xB5, 0x75, 0x9F, 0x27, 0x33, 0x51, 0x85, 0x0E, 0xE6,
+    0x6A, 0xC0, 0x7E, 0x94, 0xA0, 0xF3, 0x0D, 0x85, 0x22, 0xB8, 0x04, 0xB9, 0xDA, 0xB5, 0xF4, 0x6E,
+    0x66, 0xA0, 0x0B, 0x94, 0x8A, 0x6B, 0x93, 0xA2, 0xD4, 0x83, 0xF2, 0xCA, 0xB9, 0x33, 0x18, 0x25,
+    0xD6, 0xDE, 0x12, 0x64, 0x67, 0x39, 0x47, 0x87, 0x6F, 0xAB, 0xE0, 0x42, 0x11, 0xAB, 0x81, 0xB9,
+    0x8C, 0xB8, 0x43, 0x13, 0xF6, 0xE7, 0x69, 0x23, 0xD4, 0x0E, 0xAA, 0xAE, 0xA1, 0x50, 0x58, 0xAB,
+    0xF2, 0x2E, 0xAE, 0xB6, 0xCF, 0x4C, 0x6B, 0xD4, 0x91, 0x2F, 0x50, 0x6B, 0x9D, 0x26, 0x9F, 0x01,
+    0xF2, 0x57, 0x07, 0x58, 0x1C, 0xD8, 0xF7, 0x23, 0xEC, 0xDF, 0xBF, 0x4D, 0xB4, 0x4C, 0x2A, 0x46,
+    0xBA, 0xC6, 0x35, 0x36, 0x9A, 0x29, 0x9F, 0xA9, 0x83, 0x6B, 0xB3, 0x54, 0x46, 0xEC, 0xBB, 0xCB,
+    0xDA, 0x76, 0x2D, 0xEF, 0x8E, 0xE0, 0x05, 0x46, 0x01, 0xEA, 0x09, 0x32, 0x6D, 0x82, 0xF9, 0x32,
+    0xAD, 0xAD, 0xCE, 0x52, 0x3D, 0x74, 0x71, 0xF7, 0x8D, 0x5E, 0x1D, 0x30, 0x63, 0x82, 0xE4, 0x1E,
+    0xB8, 0xAC, 0x17, 0x79, 0xAA, 0xAD, 0x43, 0x35, 0x14, 0xD1, 0xC6, 0x2C, 0x15, 0x13, 0xEE, 0xF9,
+    0x84, 0xED, 0x17, 0xCC, 0xD4, 0xC1, 0x25, 0xD7, 0x50, 0x9F, 0x0F, 0x14, 0x37, 0x7B, 0x32, 0x45,
+    0x70, 0x23, 0xD8, 0x4D, 0xC9, 0x9A, 0x65, 0x93, 0x47, 0x74, 0x2D, 0xA5, 0xC2, 0x5A, 0x2B, 0xEE,
+    0x1E, 0x38, 0xE9, 0xF2, 0x76, 0x22, 0x4B, 0x1E, 0x0E, 0xDA, 0x40, 0xF9, 0xDA, 0x7F, 0x56, 0x69,
+    0xAD, 0x5D, 0xFE, 0xCF, 0x13, 0x79, 0xF2, 0x70, 0xD2, 0xB6, 0xD8, 0xE7, 0xFB, 0x07, 0x72, 0xAB,
+    0x43, 0x35, 0x64, 0xC9, 0x24, 0xAA, 0xE0, 0x5B, 0xE6, 0x32, 0x62, 0xFB, 0x05, 0x96, 0x3A, 0x50,
+    0x7E, 0x34, 0xAE, 0x92, 0x2B, 0x6E, 0xF6, 0xE0, 0x13, 0x98, 0x4D, 0x79, 0x63, 0x9D, 0xD0, 0xB5,
+    0x6B, 0x0A, 0x93, 0x2F, 0x50, 0x2A, 0xAC, 0x0C, 0x2D, 0xC7, 0x6D, 0x78, 0x3F, 0x7B, 0xCC, 0xAD,
+    0x69, 0x6B, 0xF8, 0x5C, 0x63, 0x7F, 0x36, 0xE3, 0xDE, 0x88, 0xD9, 0xEC, 0x42, 0x19, 0x17, 0xDC,
+    0xD5, 0x91, 0xA5, 0xEA, 0x8B, 0xB1, 0x6B, 0xEA, 0x77, 0xF5, 0x97, 0x9B, 0x9A, 0xA9, 0x86, 0xFC,
+    0x52, 0xB7, 0xE6, 0x91, 0x0F, 0x83, 0x37, 0xC6, 0xD5, 0x81, 0xBD, 0xF4, 0x34, 0xF6, 0xC3, 0x48,
+    0xF2, 0xDB, 0xA7, 0x9E, 0xCD, 0xCE, 0xD6, 0xA1, 0xDE, 0x54, 0x29, 0x4F, 0x4D, 0xE5, 0xE8, 0x1A,
+    0x99, 0xE4, 0xA2, 0xD3, 0x92, 0xEB, 0x66, 0x5F, 0xFC, 0x2C, 0x3D, 0xE8, 0xD0, 0xB4, 0x14, 0xE3,
+    0x7F, 0x0A, 0x24, 0xB2, 0x99, 0x67, 0xD3, 0x01, 0xB1, 0xFD, 0x83, 0xA4, 0x56, 0x3D, 0x4E, 0x6B,
+    0x79, 0xD9, 0x0E, 0xE0, 0x9A, 0x5D, 0x1C, 0x8E, 0x0B, 0x5F, 0x09, 0x10, 0x59, 0xC0, 0xB5, 0x54,
+    0x3D, 0x5B, 0xC0, 0xC8, 0x88, 0x4B, 0x54, 0x82, 0x2A, 0x50, 0xEE, 0x26, 0xBA, 0x1E, 0xA0, 0x78,
+    0xAD, 0x07, 0x5C, 0x15, 0x80, 0x74, 0x12, 0x60, 0x13, 0x80, 0xAE, 0x0B, 0xA4, 0x0E, 0x36, 0x82,
+    0x70, 0x2D, 0x26, 0x65, 0x33, 0x54, 0x43, 0x19, 0xC1, 0x37, 0x2E, 0x90, 0x27, 0x74, 0x04, 0x1B,
+    0x8D, 0x66, 0x5C, 0x5B, 0x69, 0xC9, 0x66, 0xBA, 0xF3, 0xA9, 0x1C, 0x4D, 0x2A, 0x27, 0x17, 0xEC,
+    0x50, 0x0D, 0xC2, 0x37, 0xFE, 0xD0, 0x94, 0xCD, 0x66, 0xAE, 0xFA, 0x32, 0xD6, 0xB1, 0xC3, 0x49,
+    0x87, 0x12, 0xD2, 0x68, 0x63, 0xA1, 0x79, 0x4D, 0xD9, 0x7F, 0xF8, 0x04, 0x30, 0x3B, 0xD6, 0x95,
+    0xB0, 0xBB, 0xEA, 0xF2, 0xB7, 0xE1, 0xAF, 0xCD, 0x04, 0x73, 0x31, 0x92, 0xA5, 0x32, 0x92, 0x27,
+    0x1B, 0x31, 0xC9, 0x6A, 0x34, 0x93, 0xD5, 0x52, 0x8C, 0xD5, 0x3D, 0x15, 0xB1, 0x0E, 0xFE, 0x85,
+    0xE8, 0x82, 0x3F, 0x1C, 0x5D, 0xE8, 0xEC, 0x50, 0xFF, 0x47, 0x55, 0xBD, 0x55, 0xAA, 0x83, 0xD1,
+    0xB0, 0x61, 0xD3, 0x6F, 0x05, 0x0D, 0xD2, 0xDB, 0x58, 0x0D, 0x38, 0x35, 0xAB, 0x00, 0xD6, 0x0A,
+    0x43, 0x3E, 0x93, 0x29, 0x52, 0xA8, 0xD9, 0xA2, 0x34, 0xFE, 0xA1, 0xA0, 0x21, 0xCD, 0x58, 0x85,
+    0x4C, 0x0F, 0xD4, 0x42, 0x64, 0x8A, 0x54, 0xE9, 0x41, 0x8D, 0xEB, 0x9F, 0xAA, 0x0F, 0xB4, 0x9C,
+    0x29, 0x27, 0xA3, 0xF8, 0x15, 0x7D, 0x20, 0xDF, 0x82, 0x55, 0x03, 0x76, 0x01, 0xEC, 0xD6, 0x23,
+    0x9F, 0xE3, 0x1C, 0x75, 0xE8, 0x5A, 0x33, 0xF9, 0x16, 0xB9, 0x40, 0xA5, 0xB0, 0x9A, 0xB3, 0x6E,
+    0x63, 0x3C, 0xEB, 0x79, 0xED, 0xEB, 0x56, 0x9F, 0x8C, 0xD8, 0xA8, 0x64, 0xA3, 0x5B, 0xEC, 0x58,
+    0xA8, 0x59, 0x0B, 0x0C, 0x65, 0x84, 0x22, 0xAD, 0x71, 0xA5, 0x15, 0x98, 0x5F, 0x7F, 0xAD, 0xEA,
+    0x57, 0x5E, 0xEB, 0xF6, 0xF6, 0xB5, 0x7E, 0xAC, 0x7B, 0x0D, 0x92, 0x9A, 0x4C, 0x52, 0xC3, 0x79,
+    0x7D, 0x0A, 0xF5, 0xCD, 0x1E, 0xFC, 0x9B, 0x11, 0x54, 0x46, 0xCC, 0x5C, 0x4C, 0x94, 0x93, 0x49,
+    0x54, 0xD1, 0xCC, 0xB8, 0x90, 0x2D, 0x5F, 0x41, 0xF3, 0xEF, 0xEB, 0x63, 0x6A, 0xA9, 0x29, 0xA5,
+    0x90, 0x75, 0xCB, 0xE9, 0x0D, 0xCD, 0x11, 0x1B, 0x17, 0x6C, 0x74, 0xC1, 0x8E, 0xC5, 0x04, 0xFC,
+    0x1E, 0xBF, 0x57, 0xA7, 0x33, 0xEF, 0xFD, 0x8F, 0xFB, 0x78, 0x92, 0x33, 0x79, 0xFB, 0x1B, 0x4E,
+    0x00, 0xFC, 0x41, 0x16, 0xEC, 0xF2, 0x07, 0x4F, 0xFE, 0xC1, 0x6F, 0x1E, 0xB2, 0x9E, 0xD8, 0x73,
+    0xD4, 0xCD, 0x3E, 0xF9, 0xB4, 0x3D, 0x03, 0xF9, 0x5A, 0x83, 0xBF, 0x72, 0xEE, 0xDC, 0xD9, 0x0D,
+    0x1B, 0x24, 0x69, 0xF6, 0x92, 0x94, 0x5E, 0x3C, 0x77, 0xEE, 0xDC, 0xB9, 0xB3, 0x17, 0xCC, 0x4F,
+    0xC3, 0xB3, 0xBF, 0xE5, 0xE1, 0x87, 0xF9, 0xE9, 0xC7, 0x8E, 0x1D, 0x75, 0x9A, 0xF7, 0x1C, 0x3B,
+    0x0A, 0x78, 0x4D, 0x2F, 0x9E, 0x7B, 0xDB, 0x4C, 0x55, 0x58, 0x4C, 0xAC, 0xDB, 0x04, 0x38, 0xBB,
+    0x13, 0x53, 0x5D, 0x86, 0x23, 0x66, 0xEA, 0xB2, 0xE4, 0xDA, 0xA5, 0x0A, 0xAE, 0x1C, 0xEA, 0x53,
+    0xD1, 0x5E, 0x1E, 0x01, 0xBC, 0xFD, 0x30, 0xCE, 0xCE, 0xBE, 0x1F, 0x2F, 0xD6, 0xC5, 0xCF, 0xC6,
+    0x83, 0x7B, 0xB2, 0x06, 0xD7, 0x90, 0x30, 0x03, 0xB6, 0xE1, 0x65, 0xA4, 0x4F, 0xA4, 0xFF, 0xF6,
+    0xE4, 0x0F, 0x89, 0x14, 0x81, 0x1A, 0x26, 0x8A, 0x81, 0xBA, 0x21, 0x61, 0x22, 0x55, 0xE0, 0xD2,
+    0x5A, 0xB2, 0x32, 0x13, 0xB8, 0xB5, 0xA3, 0xF6, 0x2C, 0xF9, 0x8F, 0x3F, 0x6D, 0x9D, 0x52, 0x21,
+    0xB5, 0x4C, 0x50, 0xB5, 0xE4, 0x13, 0xD4, 0x90, 0x47, 0x6A, 0xCD, 0x46, 0x0A, 0x4F, 0x5D, 0x3C,
+    0x4B, 0x19, 0x20, 0x41, 0x15, 0xC8, 0x27, 0x28, 0xC7, 0x3A, 0xB9, 0xC5, 0x2F, 0x7E, 0x71, 0x73,
+    0x9D, 0xF6, 0x9E, 0xF9, 0x1A, 0x5F, 0xA7, 0x0A, 0x75, 0x74, 0xC9, 0xCD, 0x7E, 0xB8, 0xC4, 0x19,
+    0xA0, 0x3C, 0x35, 0xBB, 0xF7, 0xD3, 0x23, 0x3C, 0xC3, 0x2B, 0xDD, 0xAB, 0xD2, 0x6B, 0xEA, 0xB2,
+    0x79, 0x3F, 0x8F, 0x96, 0xA7, 0x92, 0xDB, 0x99, 0x1E, 0x81, 0x5C, 0xFF, 0xCF, 0x57, 0xCA, 0x31,
+    0x6F, 0xF7, 0x6D, 0x10, 0x08, 0x7F, 0x8F, 0x0C, 0xCF, 0xE4, 0xED, 0x5A, 0xDD, 0x97, 0xA4, 0x7D,
+    0x9C, 0xF9, 0x4D, 0x3F, 0x60, 0x97, 0xF0, 0xBB, 0x04, 0xFB, 0xD5, 0x03, 0x4A, 0xF1, 0x27, 0x06,
+    0xF7, 0xD5, 0x03, 0xB6, 0xCD, 0x80, 0x96, 0x09, 0xD0, 0x44, 0x02, 0x7C, 0xC7, 0x05, 0xC0, 0xD9,
+    0xF0, 0x0A, 0x50, 0xED, 0xC4, 0x83, 0x40, 0x31, 0x24, 0x07, 0xE4, 0xE3, 0xC9, 0xBA, 0x01, 0x2E,
+    0xBA, 0xE3, 0x6F, 0x0C, 0xF9, 0x54, 0xDD, 0xBC, 0x7E, 0x43, 0x46, 0x3B, 0xBA, 0x71, 0xFD, 0xE6,
+    0xFB, 0xF7, 0x47, 0x7F, 0xED, 0xC3, 0xDB, 0x77, 0xD2, 0x49, 0x8A, 0x8F, 0xC6, 0x8B, 0x17, 0xAB,
+    0xD6, 0xC4, 0x54, 0xFB, 0xB2, 0x37, 0xD1, 0xD9, 0xEB, 0x3B, 0x31, 0x1F, 0xED, 0xCE, 0xE7, 0x31,
+    0x65, 0x93, 0xB9, 0x3B, 0xCE, 0x33, 0x89, 0x2E, 0xD5, 0x22, 0x61, 0x27, 0xB3, 0xF0, 0x6B, 0x9F,
+    0x7A, 0xE0, 0xE0, 0xEA, 0xBA, 0xD5, 0xDA, 0x00, 0x90, 0x2D, 0x29, 0x5F, 0x23, 0x96, 0x0D, 0x65,
+    0x50, 0xC4, 0x64, 0xD7, 0xC8, 0xF6, 0xA4, 0xDD, 0x59, 0xAF, 0x95, 0xEF, 0x4E, 0x17, 0xD7, 0x27,
+    0x6C, 0x48, 0xE4, 0x52, 0x71, 0xFF, 0xF3, 0xBB, 0x0A, 0x8A, 0x2E, 0xB9, 0x39, 0x2D, 0xB3, 0xEB,
+    0x0E, 0xEB, 0x5D, 0xD5, 0xC7, 0xAF, 0x7D, 0x78, 0xEB, 0x8B, 0x5D, 0x5A, 0xCF, 0x7F, 0x77, 0x20,
+    0xB9, 0xF2, 0xC6, 0x95, 0xBB, 0xF1, 0x22, 0xCE, 0xC4, 0x94, 0x9C, 0xB3, 0x7D, 0xD9, 0x3B, 0x7B,
+    0xFD, 0x21, 0xA2, 0x9D, 0x6F, 0x1D, 0xB5, 0x4A, 0x5D, 0x51, 0xB4, 0x01, 0xB5, 0x6E, 0x28, 0xA7,
+    0x87, 0x88, 0x9E, 0xB3, 0xC9, 0xC4, 0xB2, 0xB7, 0xAD, 0xE3, 0x49, 0x98, 0x6D, 0xA8, 0x5E, 0x1B,
+    0x4D, 0xF4, 0x5C, 0xB4, 0xC1, 0xBE, 0x3A, 0x9A, 0x78, 0x90, 0x27, 0xF7, 0xB6, 0x30, 0xDB, 0xCB,
+    0x53, 0x36, 0xD5, 0x87, 0xA2, 0x89, 0xBE, 0x1C, 0xCA, 0x3E, 0xD9, 0x60, 0x5F, 0x1D, 0x6B, 0x9C,
+    0x19, 0x5E, 0xE1, 0xC9, 0xBD, 0xED, 0x0F, 0xA9, 0x1B, 0xCF, 0xCC, 0x94, 0x47, 0xD3, 0xEF, 0x6D,
+    0xEA, 0x43, 0xB1, 0x88, 0x97, 0x98, 0x6D, 0xB0, 0xAF, 0x8E, 0x79, 0x74, 0x3C, 0x5B, 0x84, 0xBD,
+    0xCD, 0xDB, 0xF5, 0xA1, 0xE8, 0xF1, 0xE5, 0x30, 0x33, 0xDB, 0xCB, 0x89, 0xA9, 0x7A, 0x3E, 0xE6,
+    0xD1, 0x99, 0xC1, 0xF4, 0x2F, 0x97, 0x61, 0x6F, 0xF3, 0xF6, 0x3E, 0x80, 0xDF, 0xC3, 0xB6, 0x45,
+    0x34, 0xFF, 0x6F, 0x7E, 0xF5, 0xB9, 0x61, 0x88, 0xDF, 0xF9, 0x89, 0x85, 0x47, 0xB1, 0x8D, 0x8D,
+    0x36, 0xDA, 0xB1, 0x9C, 0x36, 0xAD, 0xF0, 0x3C, 0xE1, 0xF9, 0x1D, 0x68, 0xCA, 0x60, 0x87, 0x32,
+    0x9A, 0xC9, 0x24, 0x93, 0x6C, 0xAC, 0xFB, 0xAE, 0x39, 0xC9, 0xD7, 0x80, 0x47, 0x80, 0xD6, 0x86,
+    0xAF, 0x91, 0x8A, 0xB1, 0x0C, 0x2E, 0xA4, 0x32, 0x9A, 0xF4, 0x48, 0x19, 0x71, 0xA1, 0x8C, 0x98,
+    0x54, 0xC6, 0xB5, 0x20, 0xF8, 0x4D, 0xA3, 0xF8, 0x6D, 0x3B, 0xB8, 0x58, 0xED, 0x4C, 0x65, 0x2A,
+    0xC6, 0x0B, 0xA5, 0xC2, 0xB4, 0x42, 0xBF, 0xCA, 0xE8, 0x5A, 0xCA, 0x68, 0x26, 0xCA, 0x88, 0x6B,
+    0xCB, 0x58, 0x9B, 0xC9, 0xC4, 0xAA, 0x77, 0xFC, 0x49, 0x31, 0x9A, 0x06, 0x7E, 0x00, 0xD9, 0x52,
+    0x4C, 0xE5, 0x54, 0xF7, 0x75, 0x2F, 0xB4, 0x6D, 0x3F, 0xF8, 0xC6, 0x3F, 0x97, 0xF2, 0x54, 0xC6,
+    0x72, 0x03, 0x11, 0x9E, 0x4D, 0x34, 0xB1, 0xDA, 0x76, 0xB2, 0xF2, 0x58, 0xB6, 0xD5, 0xD0, 0x35,
+    0xDD, 0xA9, 0x39, 0x4B, 0x65, 0x64, 0xED, 0xAF, 0x51, 0xCF, 0xA5, 0x96, 0x4A, 0xC9, 0x7D, 0x32,
+    0xD6, 0x87, 0x43, 0xF2, 0xE6, 0xEE, 0x64, 0xD5, 0xBA, 0x29, 0x13, 0x65, 0xA4, 0xDE, 0xC4, 0xA2,
+    0x65, 0x4B, 0xD7, 0x98, 0x99, 0x32, 0xB2, 0x07, 0x1E, 0x3B, 0x76, 0xCC, 0x69, 0xF1, 0x9B, 0xB0,
+    0x1E, 0x03, 0xBF, 0xFB, 0x1D, 0xCC, 0xAB, 0x43, 0x36, 0x94, 0x9F, 0x4E, 0x3C, 0xFE, 0x05, 0x9C,
+    0x38, 0x8D, 0xC4, 0x98, 0x0D, 0x03, 0xDF, 0x3A, 0x43, 0xDE, 0xEE, 0x4A, 0xFE, 0x00, 0x58, 0xC8,
+    0x86, 0xF5, 0xB7, 0x66, 0xFB, 0x5B, 0xD9, 0x90, 0x45, 0x70, 0xAB, 0x43, 0xBA, 0xDB, 0x70, 0xE0,
+    0x4F, 0x29, 0x4E, 0xB5, 0xC4, 0x03, 0x3C, 0x9B, 0x87, 0x87, 0x01, 0x49, 0x1B, 0x35, 0x3A, 0x09,
+    0xC0, 0x1F, 0x56, 0xAB, 0xEA, 0xBF, 0x11, 0x00, 0x4A, 0xFD, 0xE2, 0xC8, 0x5A, 0x89, 0x4B, 0x9B,
+    0xA6, 0xD7, 0x6A, 0x40, 0x2E, 0x37, 0x40, 0x36, 0xAF, 0x77, 0x2E, 0x0E, 0xE0, 0x1B, 0x65, 0x39,
+    0xFC, 0x00, 0xCA, 0x3E, 0xEB, 0xAB, 0x96, 0x3C, 0x42, 0xD9, 0x67, 0xC3, 0x84, 0x79, 0x2F, 0xA2,
+    0x8B, 0xE4, 0xCB, 0x44, 0x2D, 0x05, 0x2F, 0x51, 0x2B, 0xE2, 0x15, 0xEC, 0x7C, 0x16, 0x77, 0xE7,
+    0x4C, 0x75, 0x13, 0xDC, 0x45, 0xEC, 0xFB, 0x03, 0xEE, 0xCD, 0x90, 0xC5, 0x84, 0xB9, 0x32, 0xC2,
+    0x33, 0xC0, 0x2B, 0x0F, 0xA8, 0x74, 0xB3, 0x5B, 0xFD, 0x49, 0xD5, 0x40, 0xD5, 0xAE, 0x48, 0xCB,
+    0x32, 0x40, 0xB1, 0x01, 0x1D, 0x99, 0x08, 0x79, 0x84, 0x6C, 0x04, 0xA6, 0x0D, 0xEA, 0xF5, 0xE2,
+    0xE6, 0xBD, 0xDC, 0xE6, 0x5B, 0x3F, 0x74, 0x33, 0xD4, 0x13, 0x1A, 0x8A, 0x7B, 0x4D, 0xDD, 0x72,
+    0x11, 0x13, 0xB1, 0x01, 0x4F, 0x3E, 0x61, 0x3F, 0xC6, 0x4D, 0x68, 0x28, 0xEE, 0x50, 0xB7, 0xCC,
+    0xBB, 0x66, 0x3E, 0x1F, 0xB1, 0x9F, 0xE2, 0xA6, 0x4C, 0x3D, 0xEB, 0x69, 0x6F, 0x07, 0x89, 0x22,
+    0xEE, 0x8E, 0xB3, 0x61, 0xCF, 0x25, 0xFC, 0x94, 0xA9, 0xCF, 0x3C, 0x59, 0xFA, 0xB2, 0xA7, 0xD8,
+    0xB7, 0xE0, 0xC7, 0x5C, 0x5B, 0xE6, 0x97, 0x6A, 0xEA, 0x39, 0x97, 0xDE, 0xD0, 0x52, 0x48, 0x95,
+    0xD2, 0xD7, 0xF3, 0xF9, 0x3B, 0xE5, 0x48, 0x11, 0x37, 0x98, 0xF8, 0x8E, 0x7C, 0xA1, 0x9C, 0xF0,
+    0x43, 0xA6, 0xB6, 0x98, 0xA9, 0x46, 0x5C, 0x40, 0x64, 0x89, 0x22, 0x52, 0x0E, 0x5B, 0x0C, 0xD7,
+    0x56, 0x1D, 0x07, 0xCA, 0x76, 0x1D, 0x81, 0x30, 0x09, 0x33, 0x61, 0x07, 0xB2, 0x75, 0x0D, 0x6D,
+    0x67, 0x7C, 0x4F, 0x6A, 0x55, 0x48, 0x26, 0x7D, 0x3D, 0x9F, 0xED, 0x40, 0x11, 0x7D, 0x43, 0x7D,
+    0x25, 0x91, 0x2F, 0x65, 0xC4, 0x0F, 0xAE, 0x2D, 0x66, 0x66, 0x5C, 0x30, 0x31, 0x4B, 0x54, 0xA1,
+    0x1C, 0xB8, 0xF4, 0xA5, 0x39, 0x9E, 0xC1, 0x05, 0x93, 0x10, 0x36, 0x9A, 0x09, 0xD7, 0x66, 0xF0,
+    0xE8, 0x46, 0x93, 0x96, 0x5C, 0x7D, 0xBE, 0x54, 0x9A, 0xF2, 0xD9, 0x2A, 0x99, 0xF4, 0xF5, 0x6C,
+    0x36, 0x09, 0x66, 0x33, 0x91, 0xA7, 0x62, 0xA4, 0x9C, 0xCA, 0x88, 0x8B, 0x65, 0x44, 0xAD, 0x1D,
+    0xCC, 0x8C, 0xED, 0x8B, 0x88, 0x0D, 0xE5, 0xF0, 0xB0, 0xF9, 0xA5, 0x6C, 0xF1, 0x6D, 0xDD, 0xD3,
+    0xB5, 0xAE, 0xC7, 0x53, 0x07, 0x1E, 0x61, 0x0F, 0xBC, 0x78, 0xEE, 0xDC, 0x71, 0xE9, 0x13, 0x69,
+    0x22, 0x4B, 0x30, 0x83, 0x07, 0xD7, 0x50, 0xB7, 0x54, 0x2B, 0xEC, 0x3B, 0x62, 0x46, 0xF2, 0x44,
+    0x96, 0xC0, 0x6B, 0x2A, 0xA4, 0xF8, 0xAF, 0x3B, 0xBD, 0xFE, 0xBA, 0xD2, 0x4B, 0x5E, 0x1F, 0xBE,
+    0xAE, 0xF9, 0xC1, 0xE9, 0xEA, 0xFA, 0xC7, 0xEF, 0xBE, 0xAE, 0xFE, 0xA5, 0x7F, 0x7D, 0xA4, 0x78,
+    0xBD, 0xE5, 0xA5, 0x97, 0xF8, 0xCA, 0xD3, 0x26, 0xCB, 0x68, 0xA5, 0x54, 0xEB, 0xB3, 0x1D, 0xA5,
+    0x03, 0x5E, 0x3B, 0xD7, 0x94, 0x0E, 0x74, 0xBB, 0xA7, 0xAB, 0x4A, 0x07, 0x9C, 0x3E, 0xBC, 0x2C,
+    0xA5, 0x5C, 0x0A, 0x4F, 0x9D, 0x7B, 0xDB, 0x48, 0xF1, 0x60, 0xA7, 0x9D, 0x1D, 0xCD, 0x07, 0x9C,
+    0x3E, 0xDA, 0xD1, 0xF2, 0xA5, 0xD3, 0xFC, 0xAC, 0xD7, 0xBA, 0x3D, 0x62, 0x5D, 0x46, 0x66, 0x80,
+    0x44, 0xF3, 0x2C, 0x07, 0x2B, 0x2A, 0x7D, 0xF0, 0x5C, 0xA7, 0xD1, 0x68, 0x36, 0xFA, 0xE7, 0xE6,
+    0x7E, 0xCC, 0xD3, 0x45, 0xFE, 0xA0, 0x0A, 0x98, 0x96, 0x6C, 0xB4, 0xD1, 0x87, 0x99, 0xE6, 0xA1,
+    0x14, 0xB3, 0x77, 0x24, 0x13, 0xCB, 0x50, 0xB3, 0x6D, 0xE6, 0x4B, 0x30, 0x66, 0x03, 0x03, 0xDF,
+    0xE2, 0x4B, 0xD6, 0xE2, 0xB7, 0xFF, 0xFC, 0x2E, 0xFC, 0x89, 0x69, 0xF9, 0x0E, 0x2F, 0xF1, 0x12,
+    0xE5, 0xA7, 0x13, 0x9C, 0xF8, 0x78, 0x7B, 0xED, 0x95, 0x75, 0x9D, 0xB5, 0x17, 0xC8, 0xA6, 0x0B,
+    0xE4, 0xFA, 0xE2, 0xBF, 0xC1, 0x2B, 0x51, 0x28, 0x51, 0xA5, 0xFD, 0xF8, 0x93, 0x6B, 0x6A, 0xF3,
+    0x64, 0xDD, 0xC0, 0xB7, 0x36, 0x44, 0xAF, 0xCB, 0x70, 0xBF, 0x6D, 0x71, 0x15, 0x78, 0x1D, 0x6B,
+    0x1E, 0x97, 0x1A, 0xA4, 0xC6, 0xE8, 0x9F, 0x63, 0x6F, 0x06, 0xAA, 0x6B, 0x3D, 0x85, 0x89, 0x60,
+    0x4E, 0x03, 0x59, 0x2A, 0x6F, 0x8C, 0xCE, 0x5D, 0x1E, 0x0F, 0xDA, 0xC0, 0x49, 0xF2, 0x88, 0x0D,
+    0xEB, 0xBA, 0xAD, 0xDA, 0x75, 0x85, 0xD5, 0x0D, 0x89, 0x62, 0x78, 0xC7, 0x95, 0x77, 0xA6, 0xFA,
+    0xA7, 0xBD, 0x87, 0x47, 0x39, 0xD7, 0xC0, 0xFE, 0x52, 0x3A, 0xCD, 0xCB, 0x4E, 0xD2, 0x67, 0xD3,
+    0xC9, 0xE7, 0xCE, 0x4B, 0xF1, 0x1D, 0x38, 0xB1, 0x5B, 0x80, 0xDD, 0x73, 0x84, 0x52, 0xC1, 0x7C,
+    0x5C, 0x31, 0x70, 0xE0, 0x49, 0xB8, 0x02, 0x5F, 0xC3, 0xC2, 0xA3, 0x63, 0x63, 0xDF, 0x3C, 0xCE,
+    0x72, 0x3F, 0x1A, 0xA5, 0xEC, 0x84, 0x7E, 0xD4, 0x49, 0x9F, 0x48, 0x4B, 0xA6, 0x09, 0xAF, 0xC1,
+    0xDE, 0xF0, 0xCD, 0xBF, 0x1A, 0x07, 0x6C, 0x03, 0x47, 0x80, 0x47, 0xC9, 0x66, 0xF2, 0x85, 0x6C,
+    0x81, 0x1F, 0xEC, 0xB2, 0xED, 0x19, 0xE8, 0x1A, 0xBA, 0x16, 0xF7, 0x25, 0x6E, 0x1E, 0xDD, 0x0E,
+    0x9E, 0xE1, 0x07, 0xCC, 0xEE, 0xF0, 0xFB, 0x63, 0xF1, 0xB3, 0xC9, 0x57, 0xC1, 0xD9, 0x9D, 0x98,
+    0xF2, 0xF1, 0x62, 0xFD, 0x42, 0x6F, 0x4F, 0x0D, 0xD3, 0x41, 0x92, 0xB3, 0x3B, 0x31, 0x6F, 0xCF,
+    0x3C, 0xB9, 0x0F, 0xD6, 0xA5, 0x56, 0x8C, 0x6B, 0x94, 0xB2, 0xC1, 0xC3, 0xFC, 0xE0, 0x57, 0x25,
+    0xF5, 0x0C, 0xE4, 0xBF, 0x9C, 0xC1, 0xDE, 0x1F, 0xC1, 0x5F, 0x0F, 0xAB, 0x1D, 0xFC, 0xD2, 0xE7,
+    0xB1, 0x2D, 0x5C, 0xB5, 0x9C, 0x58, 0x4B, 0xD7, 0x7C, 0x63, 0xB5, 0x13, 0xCF, 0x25, 0xB0, 0x9F,
+    0x4D, 0xE0, 0x6E, 0xF6, 0xA0, 0x6F, 0x40, 0x76, 0xE6, 0x57, 0xEF, 0xBE, 0xB0, 0x45, 0xD5, 0x56,
+    0xC3, 0xC6, 0xB0, 0x7E, 0xE9, 0xB3, 0xA7, 0x81, 0xFD, 0xBE, 0xC1, 0xDC, 0x5B, 0xA0, 0xBA, 0x3B,
+    0x82, 0xFB, 0x37, 0x0D, 0xFC, 0xD1, 0x23, 0xD5, 0xB5, 0x7B, 0xF3, 0x53, 0x5F, 0x1A, 0xFA, 0x83,
+    0xEE, 0xC4, 0x27, 0xE3, 0x11, 0xB2, 0x66, 0x83, 0xBF, 0xD9, 0x94, 0xE9, 0x7E, 0x45, 0x61, 0x1F,
+    0x83, 0xA3, 0xBE, 0xC9, 0xE6, 0xAE, 0xCD, 0x17, 0xDF, 0x64, 0xF3, 0x37, 0x7E, 0xF5, 0xA5, 0xF3,
+    0xF6, 0xCB, 0x1B, 0x6B, 0xB2, 0x06, 0xF8, 0x36, 0x2B, 0x71, 0xF9, 0xE0, 0xF2, 0xA1, 0x1C, 0x5D,
+    0x39, 0x96, 0xA3, 0x2B, 0xC7, 0x22, 0xBA, 0x22, 0x6E, 0xA8, 0x76, 0xF0, 0xD8, 0x31, 0x7F, 0xEC,
+    0x98, 0x97, 0x24, 0x2F, 0x49, 0x8F, 0x1D, 0xF3, 0xC7, 0x8E, 0x3D, 0xB8, 0x6A, 0xA2, 0x2B, 0x86,
+    0x72, 0x74, 0x76, 0x2C, 0x47, 0x67, 0x47, 0x13, 0x5D, 0x31, 0x6C, 0xAE, 0x1E, 0x84, 0xBA, 0xFA,
+    0x64, 0x9A, 0x01, 0x1E, 0x75, 0xC7, 0xEF, 0x4E, 0xEF, 0x00, 0xFC, 0xD0, 0x9F, 0xFF, 0x64, 0xDC,
+    0xBF, 0xC7, 0x7E, 0x92, 0xF4, 0x3B, 0xD9, 0xA1, 0x2F, 0xE4, 0xAE, 0x34, 0xCD, 0xE2, 0xAF, 0xC7,
+    0xD3, 0x8F, 0xBA, 0xB7, 0x3E, 0x4F, 0x4F, 0x52, 0x2E, 0xFB, 0x38, 0xB3, 0xEF, 0xEF, 0x09, 0x9C,
+    0xAD, 0xC2, 0x01, 0x13, 0xFE, 0x9E, 0xC0, 0xB9, 0x5C, 0xDC, 0xE5, 0xD1, 0xFE, 0xE6, 0xAB, 0x6B,
+    0x64, 0x7D, 0xC4, 0xE6, 0x93, 0xBB, 0xB6, 0x7C, 0xF5, 0x80, 0xF8, 0x5F, 0xFD, 0x5F, 0xFB, 0x9E,
+    0x6A, 0xBF, 0xFA, 0x09, 0xE5, 0xF0, 0x9F, 0x20, 0xF2, 0x51, 0x14, 0x34, 0x5D, 0xF2, 0xCE, 0xDE,
+    0x38, 0x75, 0xFF, 0xDD, 0x65, 0xBC, 0x74, 0xD1, 0x55, 0x3A, 0xA5, 0x50, 0xB7, 0x59, 0x7B, 0x30,
+    0x6B, 0xF7, 0x97, 0x61, 0xB2, 0x4D, 0xAC, 0xF2, 0x78, 0xD0, 0xF4, 0x2B, 0x34, 0xD6, 0x05, 0x9B,
+    0x72, 0x85, 0x8B, 0x53, 0x55, 0x1D, 0xFA, 0x64, 0xEC, 0xF4, 0x53, 0x25, 0x4E, 0xB2, 0xB7, 0x05,
+    0xDC, 0x62, 0xD4, 0xBF, 0x8C, 0x3D, 0x8D, 0xE2, 0xBE, 0xAE, 0x25, 0x61, 0x5F, 0xFB, 0xB3, 0xD1,
+    0x2D, 0xD9, 0xA5, 0x86, 0x3D, 0x74, 0x51, 0xD3, 0x45, 0x0E, 0x3E, 0x5A, 0x75, 0x6F, 0xDC, 0xBF,
+    0x1D, 0x5F, 0xB9, 0x50, 0x1D, 0x7F, 0x6B, 0x47, 0x7D, 0xDD, 0x42, 0xA6, 0xA5, 0x56, 0x9F, 0x25,
+    0x1C, 0xC5, 0xC0, 0x83, 0x53, 0x93, 0x9F, 0x86, 0xFD, 0x54, 0xA9, 0xB8, 0x3F, 0x5C, 0x38, 0x58,
+    0x7C, 0xD2, 0xBB, 0xB1, 0xD0, 0xF3, 0x5F, 0xA4, 0x35, 0x11, 0x54, 0xE3, 0x4F, 0x73, 0x24, 0xD7,
+    0x6B, 0x1A, 0xD3, 0xC1, 0x67, 0xED, 0xF5, 0xD7, 0x3F, 0xD7, 0xF4, 0xCC, 0x45, 0xDC, 0x63, 0xDD,
+    0x0B, 0x7A, 0xEE, 0x0B, 0x68, 0xF9, 0x0B, 0xBE, 0x85, 0x92, 0x13, 0x7F, 0xC1, 0xB7, 0xC8, 0x79,
+    0xEA, 0x9C, 0x55, 0x38, 0x76, 0x54, 0xF3, 0xB1, 0xA3, 0xEB, 0x11, 0x9E, 0x2E, 0xDA, 0xF8, 0xB4,
+    0x09, 0x2F, 0x95, 0x4D, 0xB4, 0x44, 0xDB, 0xFC, 0xC4, 0xB4, 0xFB, 0x81, 0xB2, 0x79, 0x82, 0x03,
+    0x44, 0x13, 0x2C, 0x07, 0xB2, 0xA1, 0x6C, 0x0E, 0xE4, 0x83, 0x25, 0xEE, 0x81, 0x6C, 0x0F, 0xFF,
+    0x5B, 0xB2, 0x1F, 0xF6, 0xD3, 0x81, 0xAA, 0xB8, 0x12, 0x2F, 0x1C, 0xB4, 0xA7, 0xFA, 0xF1, 0x80,
+    0x85, 0x47, 0x71, 0xD1, 0xEA, 0xB5, 0x79, 0x25, 0xED, 0xA4, 0xBD, 0xFA, 0xB3, 0xE9, 0x92, 0xFB,
+    0xAE, 0xA2, 0x4B, 0xAB, 0xCF, 0xAD, 0x42, 0x1D, 0x7D, 0xAA, 0x2F, 0xE5, 0x75, 0x63, 0x83, 0x89,
+    0xD9, 0xC4, 0x49, 0xEA, 0x66, 0x5F, 0xCB, 0x1E, 0xEA, 0x54, 0x28, 0xFE, 0x91, 0xC3, 0x44, 0x2E,
+    0xE2, 0x1A, 0xDB, 0x17, 0x31, 0x57, 0x72, 0xBA, 0x72, 0xEE, 0x6D, 0xF6, 0xE3, 0x92, 0xD1, 0xF0,
+    0xE8, 0x41, 0x8A, 0xBE, 0x1A, 0xF3, 0x85, 0x6C, 0xC2, 0xEE, 0xFC, 0xE5, 0xE4, 0x94, 0x5D, 0x6A,
+    0x56, 0xF0, 0x5C, 0x3D, 0x94, 0x73, 0xA6, 0xF0, 0x4A, 0xB2, 0x87, 0x4F, 0xFD, 0x72, 0x72, 0xFA,
+    0x44, 0x33, 0x8E, 0xFC, 0x34, 0xD0, 0x25, 0xAB, 0x76, 0xA4, 0x22, 0x57, 0xFF, 0xCD, 0x0E, 0x13,
+    0x71, 0xFB, 0xBE, 0x3F, 0x28, 0xED, 0xFD, 0x02, 0xF6, 0x50, 0xA5, 0x52, 0x97, 0x27, 0xDC, 0x7E,
+    0xA3, 0xE8, 0xCF, 0xBF, 0xDE, 0x4F, 0xAF, 0xD8, 0x53, 0x9F, 0xC4, 0x7A, 0xE1, 0x64, 0xB3, 0x95,
+    0x08, 0x89, 0xBA, 0x29, 0x86, 0xF5, 0x14, 0x49, 0xD4, 0x4D, 0x7E, 0x06, 0x1E, 0xCD, 0x14, 0x96,
+    0xF4, 0x8A, 0xAB, 0xDE, 0x7A, 0x4D, 0xAF, 0xEA, 0xDD, 0x2F, 0x52, 0xAA, 0xBD, 0xBD, 0xAA, 0xE1,
+    0xC4, 0x69, 0x1E, 0xCD, 0xF4, 0xAA, 0xA6, 0xE4, 0x0E, 0x96, 0xD7, 0xAF, 0x7E, 0xAE, 0x54, 0x9F,
+    0xDC, 0x88, 0xE3, 0x1E, 0x79, 0x63, 0x5A, 0xD3, 0x6A, 0xEE, 0x66, 0xD3, 0x9A, 0x36, 0x6F, 0xCE,
+    0x9D, 0xD5, 0xFC, 0xD8, 0xD1, 0x6E, 0x79, 0xEC, 0xE8, 0x7A, 0x84, 0xA2, 0x7D, 0xD9, 0x84, 0x27,
+    0x88, 0x26, 0x3C, 0xC1, 0x4F, 0xF2, 0xBE, 0x6C, 0x9E, 0xE1, 0x25, 0x62, 0xD6, 0x00, 0x45, 0x63,
+    0x39, 0xC0, 0x68, 0x7A, 0xDB, 0x1C, 0x20, 0x16, 0xED, 0x81, 0x6C, 0xB0, 0xFC, 0x24, 0x6B, 0x30,
+    0x1F, 0x05, 0x25, 0x67, 0x5F, 0xEF, 0xC7, 0x97, 0x6D, 0x79, 0x25, 0xBE, 0x72, 0xC9, 0xA8, 0xFF,
+    0x9D, 0xFD, 0xE4, 0xB3, 0xB9, 0xBF, 0x33, 0xDC, 0xB9, 0x93, 0xBA, 0xA9, 0xA6, 0xE8, 0x5B, 0xC5,
+    0xBD, 0xA7, 0xC9, 0xA7, 0x42, 0x3B, 0xC3, 0x9D, 0xF8, 0xEC, 0x05, 0x7B, 0xA2, 0xB8, 0xFA, 0xE1,
+    0xA0, 0x61, 0xEF, 0x11, 0xF2, 0xE1, 0x9D, 0xFC, 0x76, 0xE4, 0x7E, 0xA0, 0x6B, 0xB8, 0x44, 0x2E,
+    0x8A, 0xEB, 0x6D, 0xF5, 0x42, 0x78, 0x2C, 0x6B, 0xCA, 0xA9, 0x54, 0x9B, 0xC7, 0xBD, 0x17, 0x9C,
+    0x6A, 0xFB, 0xE6, 0x1B, 0x57, 0xD4, 0x7F, 0xB3, 0x21, 0x8F, 0x1C, 0xC4, 0xF4, 0xBC, 0x32, 0x15,
+    0xEA, 0x2F, 0x1C, 0xB4, 0xA7, 0xFA, 0x78, 0xA0, 0x2A, 0xAE, 0x0C, 0x17, 0x0E, 0xDA, 0x57, 0x9B,
+    0x23, 0x79, 0xC4, 0xB6, 0x3C, 0x4B, 0x16, 0x5F, 0x2E, 0xAF, 0xF6, 0x07, 0x5F, 0x46, 0xC1, 0x88,
+    0xEA, 0x22, 0xEF, 0x5C, 0x30, 0xFD, 0xB8, 0x27, 0x3B, 0x92, 0xC7, 0x83, 0xA6, 0x7F, 0xB9, 0x08,
+    0xEF, 0x6C, 0x16, 0x55, 0xD6, 0x98, 0xE3, 0xAF, 0x0F, 0xB5, 0xBA, 0xFE, 0x82, 0xB3, 0x87, 0x86,
+    0xE9, 0x59, 0x6B, 0x42, 0x7C, 0xB9, 0x2A, 0xAE, 0xC4, 0x77, 0x9E, 0xB1, 0xA7, 0x86, 0x71, 0xFF,
+    0x9E, 0xAC, 0xF9, 0xFA, 0xC9, 0x42, 0x3F, 0x1F, 0xA7, 0xE9, 0xE0, 0xB3, 0xF6, 0x78, 0x71, 0xED,
+    0xF2, 0xE7, 0xC3, 0x3B, 0x47, 0xF6, 0x63, 0xDE, 0x6A, 0xFD, 0x5C, 0xEE, 0x0C, 0xE3, 0x41, 0x6B,
+    0xDE, 0x8D, 0x2F, 0xD7, 0x6F, 0x9D, 0x52, 0x7C, 0xF6, 0x07, 0x45, 0xE0, 0x65, 0xCA, 0x96, 0x62,
+    0xAA, 0x2E, 0xD6, 0x54, 0x7D, 0x31, 0x92, 0x8E, 0xA4, 0x6E, 0xFC, 0x66, 0x93, 0x35, 0x4F, 0xE4,
+    0x3A, 0x3E, 0x57, 0xBC, 0x63, 0x7A, 0xCB, 0x2B, 0x8D, 0x78, 0x7B, 0xB3, 0x6B, 0xA0, 0x35, 0x9A,
+    0x90, 0x9A, 0x6A, 0x78, 0xD4, 0x24, 0xF0, 0xCF, 0x1D, 0xFB, 0xB3, 0xD8, 0x2D, 0x9D, 0xD5, 0x4F,
+    0xE3, 0x72, 0xD4, 0x1F, 0x0E, 0x46, 0x1A, 0x6B, 0x09, 0xAF, 0x88, 0x5B, 0x51, 0x67, 0xDD, 0x4C,
+    0xA9, 0x1E, 0x25, 0xC0, 0x7E, 0x0B, 0x9E, 0xF8, 0x63, 0xF6, 0x2A, 0xE1, 0x34, 0x23, 0x25, 0xA3,
+    0x5B, 0x63, 0x39, 0xFF, 0x3C, 0xD8, 0xDB, 0x3B, 0x6D, 0xFD, 0xFE, 0x1B, 0x8D, 0xBB, 0x76, 0x18,
+    0x77, 0xFD, 0x09, 0xDC, 0xBF, 0xFD, 0x63, 0xDC, 0xFF, 0x72, 0x00, 0x97, 0x7E, 0x82, 0x1B, 0x6F,
+    0x51, 0x2D, 0x2B, 0x70, 0xC3, 0x48, 0x98, 0x1B, 0xA7, 0x29, 0x0E, 0x3F, 0xD4, 0xEA, 0xDE, 0xAB,
+    0x8F, 0x71, 0x4A, 0xEB, 0xF3, 0x9A, 0x9F, 0x14, 0xE9, 0x41, 0xD7, 0xA7, 0xBE, 0x7C, 0x2B, 0xBA,
+    0x2B, 0x77, 0x07, 0xB7, 0xA3, 0xDE, 0x9D, 0x9A, 0x70, 0xA7, 0x22, 0xEE, 0x6A, 0xC4, 0x5D, 0x1B,
+    0xA8, 0x6F, 0xFE, 0x7B, 0xAC, 0x44, 0xB1, 0xDD, 0xCD, 0xB0, 0xD6, 0xA9, 0xA6, 0x4C, 0xEA, 0x4B,
+    0xA9, 0x71, 0x1F, 0x1C, 0x7D, 0xB8, 0x46, 0xDD, 0x9D, 0x3B, 0x6D, 0xA4, 0xD6, 0x6A, 0xC6, 0xFF,
+    0xE8, 0x48, 0x9E, 0xA0, 0xBA, 0xD3, 0xE4, 0x12, 0xA5, 0xA6, 0x87, 0x0B, 0xD9, 0x5B, 0x2C, 0xD0,
+    0xD2, 0x50, 0x2B, 0x52, 0x69, 0xC4, 0x8E, 0x5F, 0xC3, 0x4C, 0xAB, 0xEF, 0xDD, 0xA7, 0x73, 0x8D,
+    0x91, 0x7A, 0xCE, 0xDF, 0x3B, 0x83, 0x99, 0xA0, 0xD6, 0x82, 0x95, 0x1A, 0x5C, 0x58, 0x7D, 0x72,
+    0xD5, 0x43, 0xBD, 0xC2, 0xCA, 0xC6, 0x0D, 0x4E, 0x80, 0x55, 0x02, 0x35, 0x40, 0x11, 0xF8, 0x66,
+    0x39, 0x68, 0x30, 0x9F, 0xEB, 0xA6, 0x5A, 0xD7, 0x49, 0xA9, 0x58, 0xAA, 0xB9, 0xEE, 0xBB, 0xA0,
+    0xE7, 0x66, 0x1B, 0x6D, 0xAC, 0x82, 0xB2, 0x39, 0x4F, 0x76, 0xA8, 0x83, 0xBB, 0x3C, 0x9B, 0x64,
+    0xA6, 0x3A, 0xA8, 0xF5, 0x87, 0x52, 0x3D, 0x15, 0xD1, 0x9D, 0x52, 0xD3, 0x99, 0x51, 0xD1, 0x46,
+    0x5F, 0x8B, 0x85, 0xD5, 0x56, 0x4F, 0x00, 0x4F, 0x6C, 0x5A, 0x3E, 0x17, 0x50, 0x33, 0x65, 0x7A,
+    0x6E, 0xCC, 0xF4, 0xDC, 0x98, 0xEB, 0xB5, 0x68, 0x3E, 0x3B, 0x15, 0x1F, 0xD7, 0x67, 0x53, 0x2D,
+    0xA5, 0xF2, 0xA7, 0xD7, 0xFA, 0xF2, 0xEA, 0xF5, 0xE0, 0xA5, 0xE8, 0xA5, 0x58, 0x1D, 0xBA, 0xD1,
+    0xD4, 0xE6, 0x26, 0xCE, 0x08, 0x67, 0x16, 0x0E, 0x9A, 0x85, 0x57, 0xCC, 0xBC, 0x82, 0xA0, 0xB0,
+    0x1B, 0x20, 0x4E, 0x0F, 0xF6, 0xDF, 0x8B, 0xB5, 0x98, 0x4D, 0x1D, 0xBA, 0xB2, 0x35, 0x93, 0xBD,
+    0x35, 0xE2, 0x9E, 0x5B, 0xDC, 0xD1, 0xE2, 0x9E, 0x6E, 0x28, 0x78, 0xDD, 0xD5, 0x54, 0x6A, 0xB6,
+    0x03, 0xFA, 0x2B, 0x66, 0x6C, 0x8F, 0x0D, 0x59, 0x22, 0x4B, 0xD4, 0x9B, 0x2D, 0x4A, 0xF9, 0x72,
+    0xDA, 0xB5, 0x54, 0x8B, 0x19, 0xD7, 0xCA, 0xEC, 0x9A, 0x9F, 0x7E, 0x0C, 0x6B, 0x83, 0x8C, 0x4A,
+    0x09, 0xE8, 0x8E, 0x8F, 0x60, 0x52, 0xD5, 0x77, 0xA7, 0xED, 0xE0, 0x0F, 0xAB, 0x77, 0xCF, 0xCF,
+    0x52, 0x96, 0xAA, 0xCF, 0xC7, 0xFD, 0xA5, 0x74, 0xB8, 0xC7, 0x69, 0x74, 0x3D, 0x52, 0xD3, 0x0D,
+    0xC5, 0x9D, 0x99, 0x6E, 0xA8, 0x77, 0x26, 0x7C, 0xE8, 0x6C, 0xC4, 0x9B, 0xA9, 0xFE, 0xDF, 0xB3,
+    0x64, 0x07, 0xFF, 0xCC, 0x89, 0xE8, 0x9F, 0x9B, 0x3B, 0x3D, 0x9F, 0xCC, 0x17, 0xBB, 0xE8, 0x1E,
+    0xD3, 0x57, 0xED, 0x2B, 0x45, 0xEF, 0xDA, 0x0B, 0x45, 0xEF, 0xDA, 0x54, 0xF4, 0xDD, 0xAB, 0x63,
+    0x11, 0x74, 0x28, 0x16, 0x97, 0xEF, 0x1F, 0x1A, 0xCA, 0x9D, 0x9B, 0xDF, 0xED, 0xCB, 0x9D, 0xEB,
+    0x87, 0x83, 0xD3, 0xCA, 0x1F, 0x45, 0x7B, 0xC3, 0x3A, 0xEC, 0x79, 0xFB, 0x0A, 0xF6, 0xA2, 0xBD,
+    0x80, 0x4D, 0x76, 0xC2, 0x4E, 0xD5, 0x88, 0x1D, 0xAB, 0x88, 0x8D, 0xD5, 0x80, 0xED, 0xAB, 0x00,
+    0x5E, 0x6D, 0xD1, 0x97, 0x52, 0x73, 0x11, 0x29, 0xD9, 0x60, 0x83, 0x1D, 0x52, 0x96, 0xF6, 0xFB,
+    0x2A, 0xD4, 0x6F, 0x7E, 0x78, 0x7B, 0xCA, 0xC7, 0x74, 0xD2, 0x35, 0xAE, 0xBA, 0xF6, 0x51, 0x34,
+    0xB7, 0xA7, 0xD9, 0xE1, 0xEB, 0xC3, 0x57, 0x87, 0xF2, 0xA3, 0x5B, 0xE9, 0x22, 0xB3, 0xAB, 0xDE,
+    0xEC, 0xED, 0xD5, 0xDB, 0x63, 0x22, 0x5D, 0x7A, 0xAC, 0x6E, 0xAB, 0x37, 0xFB, 0x62, 0xCC, 0x47,
+    0xFD, 0x78, 0xC1, 0x1D, 0x96, 0x5A, 0x73, 0x4B, 0x2B, 0x64, 0x7B, 0x5E, 0x03, 0xC8, 0x4A, 0x89,
+    0x42, 0x0B, 0xD9, 0x9F, 0x7D, 0x01, 0xCC, 0x14, 0xB3, 0xA7, 0x90, 0x82, 0x91, 0x06, 0xB3, 0x94,
+    0x13, 0x4B, 0x36, 0xD3, 0x35, 0x9E, 0x3A, 0x54, 0xC1, 0x46, 0x3B, 0x98, 0x64, 0x46, 0x64, 0x66,
+    0x6A, 0x09, 0xA3, 0x9B, 0x01, 0xFF, 0xFE, 0x83, 0x04, 0xAE, 0xD2, 0x4C, 0xA9, 0x2D, 0xDA, 0x93,
+    0xEE, 0xE3, 0x35, 0x0B, 0xD0, 0x88, 0xEB, 0xFF, 0x25, 0x5A, 0xA1, 0xAC, 0xE5, 0x72, 0x96, 0x5A,
+    0x89, 0xC7, 0x97, 0xB3, 0x14, 0x23, 0x38, 0x45, 0xBC, 0x06, 0xCA, 0x0D, 0x16, 0xBB, 0x98, 0x32,
+    0x8C, 0xB4, 0x02, 0x79, 0xFD, 0xB2, 0x6D, 0x40, 0x76, 0x8D, 0x0B, 0x3E, 0xD8, 0xC1, 0x85, 0x62,
+    0x74, 0x7D, 0x96, 0xEA, 0x81, 0xAE, 0x1A, 0x70, 0xD7, 0x23, 0xF6, 0xB3, 0x88, 0x93, 0x86, 0x4A,
+    0x1A, 0x33, 0xE9, 0xDF, 0xE1, 0xAE, 0x45, 0xEC, 0xCF, 0x66, 0x8A, 0xD1, 0x85, 0x3C, 0xD9, 0x88,
+    0xF2, 0x19, 0xD7, 0xFA, 0xD6, 0xF6, 0x36, 0x52, 0x48, 0xA9, 0x94, 0x92, 0x95, 0xA6, 0x3D, 0xC7,
+    0xEF, 0x1C, 0xC1, 0xDE, 0x5E, 0xBB, 0x01, 0xD5, 0xBC, 0x86, 0xD6, 0x2E, 0x90, 0xEB, 0x3F, 0x60,
+    0x35, 0xF3, 0x3B, 0x5B, 0xD0, 0x88, 0xD6, 0xAD, 0x5C, 0xCF, 0x3C, 0xB4, 0x13, 0x60, 0x6B, 0x76,
+    0xBE, 0x00, 0x8A, 0xED, 0xEE, 0x32, 0x01, 0xFB, 0xF1, 0x03, 0xF0, 0xA2, 0x49, 0x40, 0x1D, 0x7C,
+    0x0B, 0x76, 0xB0, 0x11, 0xCC, 0x68, 0x12, 0x64, 0x2B, 0x24, 0xBB, 0xC3, 0xB5, 0x7F, 0x8E, 0x0B,
+    0xD5, 0xCF, 0x34, 0xDA, 0xA1, 0x8C, 0x92, 0x19, 0x4D, 0xBA, 0x54, 0xBE, 0x9B, 0xCC, 0xEC, 0xB2,
+    0xB1, 0x2B, 0x17, 0x1B, 0x2E, 0x3A, 0x2D, 0x45, 0xF4, 0x56, 0x73, 0x2E, 0xBD, 0xAE, 0x8F, 0x59,
+    0xD4, 0xEE, 0x46, 0xDD, 0x6B, 0x2D, 0xAA, 0x18, 0x00, 0xF2, 0xF1, 0xA1, 0xDD, 0xBE, 0x0F, 0x82,
+    0xF2, 0x5C, 0x0D, 0x46, 0x71, 0x85, 0xE1, 0xAA, 0x6A, 0xF1, 0xDF, 0x1D, 0xA8, 0xDE, 0x1B, 0x29,
+    0xC6, 0x44, 0x36, 0x5F, 0x02, 0xA7, 0xB5, 0x53, 0x91, 0xAB, 0xE1, 0x0F, 0x7D, 0xE0, 0x5B, 0x55,
+    0xC4, 0xBE, 0x35, 0x63, 0xA5, 0xB6, 0xD4, 0xF5, 0xA1, 0xB8, 0xB6, 0x93, 0xCC, 0xBB, 0x41, 0xF0,
+    0xA8, 0x0B, 0xAB, 0x45, 0x2D, 0xA6, 0x4D, 0x83, 0x63, 0xD9, 0x34, 0x8D, 0x35, 0x91, 0x49, 0x4D,
+    0x2E, 0x05, 0x93, 0xEA, 0xBE, 0x92, 0x52, 0x2D, 0xA5, 0x22, 0xDA, 0xBE, 0xBE, 0x77, 0x7E, 0x70,
+    0x52, 0xB4, 0x83, 0x9A, 0x4A, 0xA2, 0xD6, 0x44, 0xAD, 0xD3, 0xBB, 0x9B, 0xF2, 0x3D, 0x0F, 0x36,
+    0x5A, 0x6C, 0xD0, 0x88, 0xED, 0x9A, 0x9E, 0x49, 0x29, 0x93, 0x66, 0xA4, 0xC7, 0xD1, 0xB5, 0x16,
+    0xBF, 0xD3, 0xE3, 0xFA, 0x88, 0x8D, 0x07, 0x28, 0xA6, 0x4A, 0x97, 0xE7, 0x52, 0xB1, 0x3B, 0xA4,
+    0x54, 0xF7, 0x71, 0x29, 0xC7, 0x97, 0xFD, 0x73, 0x7A, 0xA2, 0x0E, 0xEE, 0xB3, 0xC3, 0xB1, 0x94,
+    0x26, 0x3A, 0x2D, 0x14, 0x5A, 0xD6, 0x5A, 0x52, 0xD9, 0x00, 0xD4, 0x11, 0x8C, 0x58, 0x1B, 0xA6,
+    0xEB, 0x3B, 0x47, 0x70, 0xBE, 0xA1, 0xFC, 0x7C, 0xC4, 0x49, 0xCB, 0xDE, 0xEE, 0xB3, 0xA5, 0x35,
+    0x53, 0xDD, 0xEE, 0xD5, 0x8F, 0x97, 0x46, 0xD2, 0x54, 0xCC, 0xDF, 0x9B, 0x71, 0x6D, 0x15, 0xCA,
+    0x98, 0x25, 0x16, 0xAA, 0xBE, 0x0E, 0xCC, 0xC5, 0xB4, 0x22, 0x49, 0xA1, 0x9B, 0xA8, 0x94, 0x70,
+    0x9A, 0x78, 0xBB, 0xDA, 0xFC, 0x77, 0x00, 0xED, 0x3B, 0x77, 0x7E, 0x76, 0xD2, 0x58, 0x28, 0xE1,
+    0xD5, 0xD4, 0x52, 0xEA, 0xA4, 0x61, 0xDB, 0xDE, 0x8C, 0x7B, 0xDB, 0x7A, 0x03, 0x04, 0xAA, 0xB7,
+    0x79, 0x68, 0xB5, 0xEE, 0xC6, 0x73, 0xDB, 0xDD, 0x78, 0x17, 0xFE, 0xC6, 0x4E, 0x2F, 0x51, 0xC5,
+    0x77, 0xA8, 0xFB, 0x11, 0x17, 0x22, 0xEE, 0xD5, 0x88, 0x7F, 0x7E, 0xC0, 0x3F, 0xDF, 0xE3, 0x0F,
+    0xF5, 0xF8, 0x43, 0x01, 0x7F, 0x35, 0xE0, 0x3E, 0xFB, 0x37, 0x5F, 0xDE, 0x8D, 0x57, 0xAD, 0x59,
+    0x20, 0xDF, 0xE0, 0x6D, 0xCC, 0x50, 0x35, 0x5C, 0x34, 0x91, 0xFA, 0x9E, 0xCE, 0x56, 0x92, 0xAE,
+    0x48, 0x4A, 0x66, 0xAA, 0x7B, 0xFC, 0xF3, 0x89, 0x22, 0xBA, 0x15, 0x65, 0x6A, 0xA3, 0x6F, 0x58,
+    0x8A, 0x48, 0xD5, 0x77, 0x6B, 0x93, 0xD1, 0x05, 0x25, 0x33, 0x95, 0x0A, 0xAE, 0x71, 0x0F, 0xD7,
+    0x9A, 0xA9, 0x96, 0x06, 0x23, 0x35, 0xAC, 0x70, 0xCB, 0xE7, 0x4E, 0xAF, 0x29, 0x69, 0xD5, 0x6F,
+    0x51, 0xD2, 0x0A, 0x90, 0xA9, 0xDF, 0x1C, 0xD6, 0x9D, 0xF0, 0x6A, 0x5E, 0xFA, 0xE1, 0x4B, 0x73,
+    0xA1, 0xFB, 0x9F, 0x8F, 0x4F, 0xDF, 0xFE, 0xFC, 0x46, 0xF0, 0xD7, 0x0E, 0x2F, 0x74, 0x4B, 0x37,
+    0x20, 0xCD, 0x98, 0xAB, 0xD7, 0x1A, 0x9E, 0x78, 0xFA, 0x69, 0xA8, 0xA4, 0x9F, 0x4B, 0x4B, 0x2D,
+    0xBD, 0x7B, 0xEC, 0xD8, 0xD1, 0x75, 0x5D, 0x4D, 0x9D, 0x74, 0x58, 0x1A, 0xBF, 0xBC, 0xB1, 0x2D,
+    0xFF, 0xF2, 0xEE, 0xBF, 0x11, 0x3A, 0x28, 0xA4, 0xD0, 0x29, 0x95, 0x0A, 0x20, 0xF6, 0x9D, 0xBF,
+    0x97, 0x49, 0x71, 0xCF, 0xF1, 0x91, 0x7C, 0xC6, 0xAD, 0x40, 0x31, 0xD7, 0x62, 0xD2, 0x4A, 0xEE,
+    0x0A, 0x48, 0xC3, 0x85, 0x15, 0x12, 0x16, 0xC1, 0xAF, 0x16, 0x68, 0xD9, 0x8B, 0xD5, 0x90, 0x6B,
+    0xCA, 0xD5, 0xE3, 0xD2, 0x7F, 0x87, 0x53, 0x78, 0x5C, 0x43, 0xA1, 0x86, 0xF3, 0x71, 0xDF, 0xE9,
+    0x85, 0xD9, 0x0E, 0x75, 0x98, 0x8B, 0xA9, 0xBA, 0xA2, 0x5C, 0xEA, 0x9D, 0xA2, 0xD9, 0xF5, 0x0C,
+    0x9B, 0xFF, 0x12, 0x71, 0x01, 0x0E, 0x1C, 0x80, 0x97, 0x0F, 0x80, 0xBF, 0x74, 0xEE, 0xB4, 0x93,
+    0x52, 0x25, 0x2D, 0xD9, 0xBD, 0x73, 0x1D, 0x11, 0xCB, 0xED, 0xFF, 0xFB, 0xEB, 0x99, 0xF4, 0x74,
+    0xBE, 0xDC, 0x4F, 0x79, 0x7C, 0xF5, 0x8C, 0x8D, 0xE0, 0xA6, 0x47, 0x78, 0x44, 0x33, 0x74, 0x09,
+    0xEA, 0xAD, 0x81, 0xC9, 0xD2, 0x76, 0xE7, 0x7E, 0xBE, 0xED, 0x34, 0x61, 0x46, 0xC8, 0xCE, 0x2F,
+    0x0D, 0x95, 0x34, 0xD2, 0x49, 0x29, 0xD7, 0x5B, 0x9F, 0x2C, 0x26, 0xD9, 0x5E, 0xC5, 0x58, 0x85,
+    0xAE, 0x8C, 0x75, 0xE8, 0xEC, 0xE0, 0x5A, 0xD9, 0xDE, 0x35, 0x4B, 0x15, 0xC8, 0xE6, 0x3A, 0x90,
+    0x25, 0x17, 0xC8, 0x93, 0x6B, 0x31, 0x13, 0x95, 0x4E, 0x53, 0x6B, 0xC2, 0x69, 0xC6, 0xFD, 0xE5,
+    0x76, 0x67, 0xB6, 0xE8, 0x58, 0x90, 0x99, 0xF7, 0xA9, 0x4B, 0x76, 0xF3, 0x6F, 0x35, 0x8A, 0xF9,
+    0x08, 0x66, 0x82, 0x7F, 0xB6, 0x9C, 0xC1, 0x69, 0xA0, 0xBE, 0x77, 0xFA, 0xA1, 0x9D, 0x5D, 0xD9,
+    0x1E, 0xE0, 0x5F, 0x45, 0x28, 0xBF, 0x0E, 0xB9, 0x06, 0x8C, 0x14, 0x32, 0x29, 0xE1, 0x67, 0x1F,
+    0xEC, 0xFD, 0x9D, 0x36, 0xD7, 0x77, 0xFE, 0x02, 0xB7, 0xF3, 0x06, 0x26, 0xFD, 0xE1, 0x19, 0xFC,
+    0x76, 0xD3, 0xBD, 0x6B, 0x37, 0x9B, 0xDB, 0xEA, 0xB0, 0x31, 0x01, 0x66, 0x39, 0x82, 0x5B, 0x03,
+    0x1E, 0xAD, 0x7B, 0x96, 0xC9, 0x9E, 0x83, 0xEF, 0xFC, 0x0D, 0xE6, 0x30, 0xA5, 0x06, 0xA4, 0x60,
+    0x35, 0x67, 0xF3, 0x89, 0xA1, 0x0A, 0xCA, 0x93, 0x1D, 0xDC, 0x6B, 0xB3, 0x91, 0x1A, 0xAF, 0xB6,
+    0xD4, 0x8C, 0xAA, 0x68, 0x07, 0xDF, 0xCE, 0x66, 0xAA, 0x82, 0x7F, 0x3E, 0x55, 0xD1, 0x69, 0x31,
+    0x52, 0xEB, 0x74, 0x9A, 0x3F, 0x8D, 0x14, 0x5F, 0x87, 0x23, 0x0D, 0x0F, 0x75, 0x28, 0xD7, 0xAA,
+    0xE3, 0x64, 0x67, 0xE8, 0x26, 0x97, 0xC8, 0x34, 0x2A, 0x91, 0x27, 0x16, 0x36, 0x0D, 0xFF, 0x62,
+    0xF9, 0xF1, 0x72, 0x1A, 0x27, 0x69, 0xA0, 0x93, 0xD4, 0x63, 0x63, 0x31, 0x81, 0x1D, 0x8A, 0x08,
+    0x76, 0x28, 0x23, 0x54, 0xBD, 0x8D, 0x50, 0x07, 0x3B, 0x80, 0x0B, 0x55, 0x0F, 0xAE, 0xAD, 0x03,
+    0xB8, 0xA6, 0x0E, 0xE0, 0x71, 0xED, 0x6A, 0xEE, 0x41, 0xF8, 0x06, 0x16, 0x3A, 0xC8, 0xE6, 0x15,
+    0xF8, 0x98, 0x2F, 0x9B, 0xB9, 0xE9, 0xA2, 0x9B, 0x58, 0x2B, 0x9F, 0xBB, 0xBA, 0x24, 0x1B, 0x28,
+    0x75, 0x6D, 0xC4, 0xE8, 0xBD, 0x44, 0x3E, 0xF3, 0xED, 0x8D, 0xB1, 0xF4, 0x7F, 0xFB, 0xCD, 0x36,
+    0x93, 0xCA, 0x48, 0xA7, 0x9D, 0x84, 0x49, 0x2C, 0x1B, 0xA0, 0x82, 0x6B, 0xAB, 0x9E, 0xAA, 0x2F,
+    0x23, 0x65, 0x34, 0xDB, 0x2B, 0xCB, 0xBA, 0xA9, 0xFB, 0x37, 0x5E, 0xD9, 0x16, 0x93, 0x5C, 0xD8,
+    0xD8, 0xC4, 0x15, 0xA3, 0x53, 0x3F, 0x5C, 0x99, 0x2D, 0x55, 0xF5, 0x94, 0xBA, 0x16, 0x77, 0x09,
+    0xD1, 0x66, 0x3A, 0xFF, 0xB7, 0x55, 0xFF, 0x8F, 0x27, 0xA4, 0x0E, 0xBF, 0x25, 0x21, 0x50, 0x2E,
+    0x46, 0x2F, 0x04, 0x4A, 0x9D, 0xD2, 0xD5, 0x89, 0x42, 0xEF, 0xEB, 0xD6, 0xBC, 0x8A, 0xEC, 0xDB,
+    0x5B, 0x06, 0xE3, 0x3F, 0xED, 0xFE, 0x6E, 0xDF, 0x69, 0x24, 0xE9, 0xF5, 0x91, 0x4E, 0xD2, 0x7B,
+    0x09, 0x93, 0xB2, 0x85, 0x0E, 0x96, 0x55, 0x24, 0xAE, 0xAD, 0x83, 0x1D, 0xA8, 0x7A, 0x1B, 0x8B,
+    0x91, 0x32, 0x9A, 0x29, 0x4F, 0xAB, 0xD0, 0xB5, 0x8A, 0xC8, 0xB5, 0xB8, 0xA6, 0x0E, 0xB6, 0xA7,
+    0x0A, 0x76, 0x28, 0xE2, 0x6F, 0x1A, 0xC3, 0x06, 0x0C, 0x02, 0x2E, 0xD4, 0x03, 0xE4, 0x1A, 0x36,
+    0x84, 0xBB, 0x09, 0xA8, 0x07, 0x3B, 0xFE, 0x1A, 0xF1, 0x87, 0x87, 0x95, 0xF8, 0x71, 0x25, 0x7E,
+    0xA3, 0x6F, 0xDD, 0x4A, 0xBC, 0x0B, 0xF8, 0x4F, 0xBB, 0xBF, 0xB3, 0xC3, 0x6F, 0x22, 0x5E, 0xFF,
+    0xBF, 0x12, 0x7F, 0x62, 0x69, 0xA0, 0x94, 0x7A, 0xF0, 0x52, 0x8B, 0x99, 0xF3, 0x79, 0xBB, 0x04,
+    0x7C, 0xE3, 0x3E, 0x25, 0x4F, 0xA5, 0x12, 0x36, 0x3A, 0xC5, 0x55, 0xF8, 0xD9, 0x4C, 0x07, 0x45,
+    0x34, 0x69, 0xBB, 0x3C, 0x84, 0x6B, 0x30, 0x53, 0x96, 0x58, 0xE5, 0xBF, 0xA2, 0x98, 0x4D, 0x42,
+    0x09, 0x3B, 0xE4, 0x8A, 0xB8, 0xC6, 0xA8, 0x5D, 0xF7, 0xF0, 0x97, 0x91, 0xAD, 0x57, 0x71, 0x33,
+    0x80, 0x06, 0x36, 0x28, 0xA8, 0x87, 0x7A, 0x06, 0xDA, 0xA5, 0xCA, 0x49, 0x2D, 0x79, 0xCA, 0x66,
+    0x28, 0xFB, 0x62, 0xA4, 0x54, 0xEB, 0x3E, 0x6D, 0xA4, 0x52, 0xB3, 0x55, 0x72, 0x8A, 0xAE, 0x3D,
+    0x5D, 0x0D, 0xD9, 0x02, 0x1E, 0xB3, 0x90, 0x27, 0x4A, 0x35, 0x36, 0x52, 0xAA, 0x75, 0x2D, 0x46,
+    0xD9, 0xCC, 0xDA, 0x55, 0x6C, 0xCA, 0x58, 0x87, 0xFC, 0x53, 0xB5, 0x5D, 0x2A, 0x95, 0x32, 0xC5,
+    0x4A, 0xED, 0x83, 0xE6, 0x0D, 0xE6, 0x41, 0x98, 0x65, 0xB4, 0xE6, 0x8B, 0x80, 0x91, 0x80, 0x67,
+    0xA9, 0xC1, 0x0C, 0xD4, 0xE0, 0xFE, 0xCF, 0xDE, 0x63, 0xA4, 0xCB, 0xC2, 0x69, 0x29, 0x64, 0xA4,
+    0xC1, 0xA9, 0xD6, 0x62, 0xB4, 0x38, 0x45, 0xA7, 0xE8, 0xF4, 0x9A, 0x84, 0xD3, 0x71, 0x45, 0x9C,
+    0x24, 0x70, 0x77, 0x14, 0xC1, 0x3D, 0x27, 0xE0, 0xD9, 0x22, 0x02, 0x07, 0x3B, 0x58, 0xC1, 0x27,
+    0xDB, 0xC8, 0xEE, 0x0F, 0x81, 0xFF, 0x0F,
 };
 
 static const EpdGlyph notosans_12_bolditalicGlyphs[] = {
@@ -1802,7 +1830,7 @@ static const EpdGlyph notosans_12_bolditalicGlyphs[] = {
     { 4, 25, 14, 5, 19, 25, 5625 }, // |
     { 11, 22, 9, -2, 18, 61, 5650 }, // }
     { 13, 5, 14, 1, 11, 17, 5711 }, // ~
-    { 0, 0, 7, 0, 0, 0, 0 }, //  
+    { 0, 0, 7, 0, 0, 0, 5728 }, //  
     { 8, 19, 7, -1, 14, 38, 0 }, // ¡
     { 12, 20, 14, 2, 19, 60, 38 }, // ¢
     { 17, 19, 14, -1, 19, 81, 98 }, // £
@@ -1813,774 +1841,781 @@ static const EpdGlyph notosans_12_bolditalicGlyphs[] = {
     { 9, 4, 14, 5, 19, 9, 377 }, // ¨
     { 19, 20, 21, 1, 19, 95, 386 }, // ©
     { 10, 10, 9, 1, 19, 25, 481 }, // ª
-    { 15, 12, 14, 0, 13, 45, 506 }, // «
-    { 13, 8, 14, 1, 11, 26, 551 }, // ¬
-    { 8, 4, 8, 0, 9, 8, 577 }, // ­
-    { 19, 20, 21, 1, 19, 95, 585 }, // ®
-    { 12, 4, 11, 2, 22, 12, 680 }, // ¯
-    { 9, 10, 11, 1, 19, 23, 692 }, // °
-    { 13, 16, 14, 1, 16, 52, 715 }, // ±
-    { 10, 12, 9, 1, 22, 30, 767 }, // ²
-    { 10, 12, 9, 1, 22, 30, 797 }, // ³
-    { 8, 5, 8, 2, 20, 10, 827 }, // ´
-    { 16, 20, 15, -1, 14, 80, 837 }, // µ
-    { 14, 23, 16, 1, 19, 81, 917 }, // ¶
-    { 6, 5, 7, 1, 11, 8, 998 }, // ·
-    { 7, 6, 5, -3, 0, 11, 1006 }, // ¸
-    { 8, 12, 9, 2, 22, 24, 1017 }, // ¹
-    { 8, 9, 9, 2, 18, 18, 1041 }, // º
-    { 14, 12, 14, 0, 13, 42, 1059 }, // »
-    { 19, 19, 21, 1, 19, 91, 1101 }, // ¼
-    { 21, 19, 22, 1, 19, 100, 1192 }, // ½
-    { 20, 19, 22, 1, 19, 95, 1292 }, // ¾
-    { 11, 19, 12, -1, 14, 53, 1387 }, // ¿
-    { 17, 24, 16, -2, 24, 102, 1440 }, // À
-    { 18, 24, 16, -2, 24, 108, 1542 }, // Á
-    { 18, 24, 16, -2, 24, 108, 1650 }, // Â
-    { 18, 23, 16, -2, 23, 104, 1758 }, // Ã
-    { 17, 23, 16, -2, 23, 98, 1862 }, // Ä
-    { 17, 25, 16, -2, 25, 107, 1960 }, // Å
-    { 26, 18, 22, -2, 18, 117, 2067 }, // Æ
-    { 16, 25, 15, 1, 19, 100, 2184 }, // Ç
-    { 15, 24, 14, 0, 24, 90, 2284 }, // È
-    { 15, 24, 14, 0, 24, 90, 2374 }, // É
-    { 15, 24, 14, 0, 24, 90, 2464 }, // Ê
-    { 15, 23, 14, 0, 23, 87, 2554 }, // Ë
-    { 12, 24, 10, -1, 24, 72, 2641 }, // Ì
-    { 14, 24, 10, -1, 24, 84, 2713 }, // Í
-    { 14, 24, 10, -1, 24, 84, 2797 }, // Î
-    { 13, 23, 10, -1, 23, 75, 2881 }, // Ï
-    { 17, 18, 17, 0, 18, 77, 2956 }, // Ð
-    { 20, 23, 19, 0, 23, 115, 3033 }, // Ñ
-    { 17, 25, 18, 1, 24, 107, 3148 }, // Ò
-    { 17, 25, 18, 1, 24, 107, 3255 }, // Ó
-    { 17, 25, 18, 1, 24, 107, 3362 }, // Ô
-    { 17, 24, 18, 1, 23, 102, 3469 }, // Õ
-    { 17, 24, 18, 1, 23, 102, 3571 }, // Ö
-    { 12, 12, 14, 1, 15, 36, 3673 }, // ×
-    { 17, 21, 18, 1, 19, 90, 3709 }, // Ø
-    { 17, 25, 17, 1, 24, 107, 3799 }, // Ù
-    { 17, 25, 17, 1, 24, 107, 3906 }, // Ú
-    { 17, 25, 17, 1, 24, 107, 4013 }, // Û
-    { 17, 24, 17, 1, 23, 102, 4120 }, // Ü
-    { 15, 24, 14, 2, 24, 90, 4222 }, // Ý
-    { 15, 18, 15, 0, 18, 68, 4312 }, // Þ
-    { 20, 26, 16, -4, 20, 130, 4380 }, // ß
-    { 14, 21, 15, 1, 20, 74, 4510 }, // à
-    { 14, 21, 15, 1, 20, 74, 4584 }, // á
-    { 14, 21, 15, 1, 20, 74, 4658 }, // â
-    { 14, 20, 15, 1, 19, 70, 4732 }, // ã
-    { 14, 20, 15, 1, 19, 70, 4802 }, // ä
-    { 14, 22, 15, 1, 21, 77, 4872 }, // å
-    { 21, 15, 22, 1, 14, 79, 4949 }, // æ
-    { 12, 20, 12, 1, 14, 60, 5028 }, // ç
-    { 13, 21, 14, 1, 20, 69, 5088 }, // è
-    { 13, 21, 14, 1, 20, 69, 5157 }, // é
-    { 13, 21, 14, 1, 20, 69, 5226 }, // ê
-    { 13, 20, 14, 1, 19, 65, 5295 }, // ë
-    { 8, 20, 7, 0, 20, 40, 5360 }, // ì
-    { 11, 20, 7, 0, 20, 55, 5400 }, // í
-    { 11, 20, 7, 0, 20, 55, 5455 }, // î
-    { 10, 19, 7, 0, 19, 48, 5510 }, // ï
-    { 15, 21, 14, 0, 20, 79, 5558 }, // ð
-    { 15, 19, 15, 0, 19, 72, 5637 }, // ñ
-    { 13, 21, 15, 1, 20, 69, 5709 }, // ò
-    { 13, 21, 15, 1, 20, 69, 5778 }, // ó
-    { 13, 21, 15, 1, 20, 69, 5847 }, // ô
-    { 14, 20, 15, 1, 19, 70, 5916 }, // õ
-    { 13, 20, 15, 1, 19, 65, 5986 }, // ö
-    { 13, 13, 14, 1, 15, 43, 6051 }, // ÷
-    { 14, 17, 15, 0, 15, 60, 6094 }, // ø
-    { 14, 21, 15, 1, 20, 74, 6154 }, // ù
-    { 14, 21, 15, 1, 20, 74, 6228 }, // ú
-    { 14, 21, 15, 1, 20, 74, 6302 }, // û
-    { 14, 20, 15, 1, 19, 70, 6376 }, // ü
-    { 17, 26, 13, -2, 20, 111, 6446 }, // ý
-    { 15, 25, 15, -1, 19, 94, 6557 }, // þ
-    { 17, 25, 13, -2, 19, 107, 6651 }, // ÿ
-    { 17, 22, 16, -2, 22, 94, 0 }, // Ā
-    { 14, 19, 15, 1, 18, 67, 94 }, // ā
-    { 18, 24, 16, -2, 24, 108, 161 }, // Ă
-    { 14, 21, 15, 1, 20, 74, 269 }, // ă
-    { 17, 25, 16, -2, 18, 107, 343 }, // Ą
-    { 14, 21, 15, 1, 14, 74, 450 }, // ą
-    { 16, 25, 15, 1, 24, 100, 524 }, // Ć
-    { 12, 21, 12, 1, 20, 63, 624 }, // ć
-    { 16, 25, 15, 1, 24, 100, 687 }, // Ĉ
-    { 12, 21, 12, 1, 20, 63, 787 }, // ĉ
-    { 16, 25, 15, 1, 24, 100, 850 }, // Ċ
-    { 12, 21, 12, 1, 20, 63, 950 }, // ċ
-    { 16, 25, 15, 1, 24, 100, 1013 }, // Č
-    { 13, 21, 12, 1, 20, 69, 1113 }, // č
-    { 17, 24, 17, 0, 24, 102, 1182 }, // Ď
-    { 20, 20, 17, 1, 19, 100, 1284 }, // ď
-    { 17, 18, 17, 0, 18, 77, 1384 }, // Đ
-    { 16, 20, 15, 1, 19, 80, 1461 }, // đ
-    { 15, 22, 14, 0, 22, 83, 1541 }, // Ē
-    { 13, 19, 14, 1, 18, 62, 1624 }, // ē
-    { 15, 24, 14, 0, 24, 90, 1686 }, // Ĕ
-    { 13, 21, 14, 1, 20, 69, 1776 }, // ĕ
-    { 15, 24, 14, 0, 24, 90, 1845 }, // Ė
-    { 13, 21, 14, 1, 20, 69, 1935 }, // ė
-    { 15, 25, 14, 0, 18, 94, 2004 }, // Ę
-    { 13, 20, 14, 1, 14, 65, 2098 }, // ę
-    { 16, 24, 14, 0, 24, 96, 2163 }, // Ě
-    { 14, 21, 14, 1, 20, 74, 2259 }, // ě
-    { 16, 25, 17, 1, 24, 100, 2333 }, // Ĝ
-    { 15, 26, 15, 0, 20, 98, 2433 }, // ĝ
-    { 16, 25, 17, 1, 24, 100, 2531 }, // Ğ
-    { 15, 26, 15, 0, 20, 98, 2631 }, // ğ
-    { 16, 25, 17, 1, 24, 100, 2729 }, // Ġ
-    { 15, 26, 15, 0, 20, 98, 2829 }, // ġ
-    { 16, 25, 17, 1, 19, 100, 2927 }, // Ģ
-    { 15, 26, 15, 0, 20, 98, 3027 }, // ģ
-    { 18, 24, 18, 0, 24, 108, 3125 }, // Ĥ
-    { 14, 25, 15, 0, 25, 88, 3233 }, // ĥ
-    { 20, 18, 18, 0, 18, 90, 3321 }, // Ħ
-    { 14, 19, 15, 0, 19, 67, 3411 }, // ħ
-    { 14, 23, 10, -1, 23, 81, 3478 }, // Ĩ
-    { 12, 19, 7, 0, 19, 57, 3559 }, // ĩ
-    { 13, 22, 10, -1, 22, 72, 3616 }, // Ī
-    { 10, 18, 7, 0, 18, 45, 3688 }, // ī
-    { 14, 24, 10, -1, 24, 84, 3733 }, // Ĭ
-    { 11, 20, 7, 0, 20, 55, 3817 }, // ĭ
-    { 12, 25, 10, -1, 18, 75, 3872 }, // Į
-    { 10, 27, 7, -1, 20, 68, 3947 }, // į
-    { 12, 24, 10, -1, 24, 72, 4015 }, // İ
-    { 8, 14, 7, 0, 14, 28, 4087 }, // ı
-    { 20, 24, 18, -1, 18, 120, 4115 }, // Ĳ
-    { 16, 26, 15, 0, 20, 104, 4235 }, // ĳ
-    { 16, 30, 8, -4, 24, 120, 4339 }, // Ĵ
-    { 15, 26, 7, -4, 20, 98, 4459 }, // ĵ
-    { 18, 24, 15, 0, 18, 108, 4557 }, // Ķ
-    { 16, 25, 14, 0, 19, 100, 4665 }, // ķ
-    { 16, 14, 14, 0, 14, 56, 4765 }, // ĸ
-    { 13, 24, 13, 0, 24, 78, 4821 }, // Ĺ
-    { 12, 25, 7, 0, 25, 75, 4899 }, // ĺ
-    { 12, 24, 13, 0, 18, 72, 4974 }, // Ļ
-    { 10, 25, 7, -1, 19, 63, 5046 }, // ļ
-    { 15, 18, 13, 0, 18, 68, 5109 }, // Ľ
-    { 14, 19, 9, 0, 19, 67, 5177 }, // ľ
-    { 13, 18, 13, 0, 18, 59, 5244 }, // Ŀ
-    { 12, 19, 11, 0, 19, 57, 5303 }, // ŀ
-    { 13, 18, 13, -1, 18, 59, 5360 }, // Ł
-    { 9, 19, 8, 0, 19, 43, 5419 }, // ł
-    { 20, 24, 19, 0, 24, 120, 5462 }, // Ń
-    { 15, 20, 15, 0, 20, 75, 5582 }, // ń
-    { 20, 24, 19, 0, 18, 120, 5657 }, // Ņ
-    { 14, 20, 15, 0, 14, 70, 5777 }, // ņ
-    { 20, 24, 19, 0, 24, 120, 5847 }, // Ň
-    { 16, 20, 15, 0, 20, 80, 5967 }, // ň
-    { 17, 18, 18, 0, 18, 77, 6047 }, // ŉ
-    { 19, 24, 19, 0, 18, 114, 6124 }, // Ŋ
-    { 14, 20, 15, 0, 14, 70, 6238 }, // ŋ
-    { 17, 23, 18, 1, 22, 98, 6308 }, // Ō
-    { 13, 19, 15, 1, 18, 62, 6406 }, // ō
-    { 17, 25, 18, 1, 24, 107, 6468 }, // Ŏ
-    { 13, 21, 15, 1, 20, 69, 6575 }, // ŏ
-    { 19, 25, 18, 1, 24, 119, 6644 }, // Ő
-    { 16, 21, 15, 1, 20, 84, 6763 }, // ő
-    { 23, 20, 23, 1, 19, 115, 6847 }, // Œ
-    { 21, 15, 22, 1, 14, 79, 6962 }, // œ
-    { 16, 24, 16, 0, 24, 96, 7041 }, // Ŕ
-    { 13, 20, 11, 0, 20, 65, 7137 }, // ŕ
-    { 15, 24, 16, 0, 18, 90, 7202 }, // Ŗ
-    { 13, 20, 11, -1, 14, 65, 7292 }, // ŗ
-    { 17, 24, 16, 0, 24, 102, 7357 }, // Ř
-    { 14, 20, 11, 0, 20, 70, 7459 }, // ř
-    { 14, 25, 13, 0, 24, 88, 7529 }, // Ś
-    { 13, 21, 12, 0, 20, 69, 7617 }, // ś
-    { 14, 25, 13, 0, 24, 88, 7686 }, // Ŝ
-    { 13, 21, 12, 0, 20, 69, 7774 }, // ŝ
-    { 14, 25, 13, 0, 19, 88, 7843 }, // Ş
-    { 12, 20, 12, 0, 14, 60, 7931 }, // ş
-    { 15, 25, 13, 0, 24, 94, 7991 }, // Š
-    { 13, 21, 12, 0, 20, 69, 8085 }, // š
-    { 15, 24, 13, 1, 18, 90, 8154 }, // Ţ
-    { 10, 23, 10, 1, 17, 58, 8244 }, // ţ
-    { 14, 24, 13, 2, 24, 84, 8302 }, // Ť
-    { 13, 20, 10, 1, 19, 65, 8386 }, // ť
-    { 15, 18, 13, 1, 18, 68, 8451 }, // Ŧ
-    { 11, 18, 10, 0, 17, 50, 8519 }, // ŧ
-    { 17, 24, 17, 1, 23, 102, 8569 }, // Ũ
-    { 14, 20, 15, 1, 19, 70, 8671 }, // ũ
-    { 17, 23, 17, 1, 22, 98, 8741 }, // Ū
-    { 14, 19, 15, 1, 18, 67, 8839 }, // ū
-    { 17, 25, 17, 1, 24, 107, 8906 }, // Ŭ
-    { 14, 21, 15, 1, 20, 74, 9013 }, // ŭ
-    { 17, 26, 17, 1, 25, 111, 9087 }, // Ů
-    { 14, 22, 15, 1, 21, 77, 9198 }, // ů
-    { 18, 25, 17, 1, 24, 113, 9275 }, // Ű
-    { 16, 21, 15, 1, 20, 84, 9388 }, // ű
-    { 17, 25, 17, 1, 18, 107, 9472 }, // Ų
-    { 14, 21, 15, 1, 14, 74, 9579 }, // ų
-    { 23, 24, 22, 2, 24, 138, 9653 }, // Ŵ
-    { 20, 20, 20, 1, 20, 100, 9791 }, // ŵ
-    { 15, 24, 14, 2, 24, 90, 9891 }, // Ŷ
-    { 17, 26, 13, -2, 20, 111, 9981 }, // ŷ
-    { 15, 23, 14, 2, 23, 87, 10092 }, // Ÿ
-    { 16, 24, 13, -1, 24, 96, 10179 }, // Ź
-    { 14, 20, 12, -1, 20, 70, 10275 }, // ź
-    { 16, 24, 13, -1, 24, 96, 10345 }, // Ż
-    { 13, 20, 12, -1, 20, 65, 10441 }, // ż
-    { 17, 24, 13, -1, 24, 102, 10506 }, // Ž
-    { 15, 20, 12, -1, 20, 75, 10608 }, // ž
-    { 15, 26, 9, -3, 20, 98, 10683 }, // ſ
-    { 6, 5, 0, -11, 20, 8, 0 }, // ̀
-    { 8, 5, 0, -6, 20, 10, 8 }, // ́
-    { 11, 5, 0, -4, 20, 14, 18 }, // ̂
-    { 11, 4, 0, -11, 19, 11, 32 }, // ̃
-    { 9, 3, 0, -3, 18, 7, 43 }, // ̄
-    { 11, 4, 0, -3, 22, 11, 50 }, // ̅
-    { 10, 5, 0, -3, 20, 13, 61 }, // ̆
-    { 5, 5, 0, 0, 20, 7, 74 }, // ̇
-    { 9, 4, 0, -2, 19, 9, 81 }, // ̈
-    { 6, 7, 0, -8, 21, 11, 90 }, // ̉
-    { 7, 6, 0, -1, 21, 11, 101 }, // ̊
-    { 12, 5, 0, -3, 20, 15, 112 }, // ̋
-    { 11, 5, 0, -3, 20, 14, 127 }, // ̌
-    { 5, 8, 0, 0, 20, 10, 141 }, // ̍
-    { 9, 6, 0, -2, 20, 14, 151 }, // ̎
-    { 11, 5, 0, -12, 20, 14, 165 }, // ̏
-    { 9, 7, 0, -2, 22, 16, 179 }, // ̐
-    { 10, 5, 0, -3, 20, 13, 195 }, // ̑
-    { 7, 7, 0, -2, 18, 13, 208 }, // ̒
-    { 7, 7, 0, -2, 18, 13, 221 }, // ̓
-    { 4, 7, 0, 0, 18, 7, 234 }, // ̔
-    { 7, 7, 0, -2, 18, 13, 241 }, // ̕
-    { 6, 5, 0, -5, 0, 8, 254 }, // ̖
-    { 8, 5, 0, -6, 0, 10, 262 }, // ̗
-    { 6, 6, 0, -5, 0, 9, 272 }, // ̘
-    { 6, 6, 0, -5, 0, 9, 281 }, // ̙
-    { 8, 7, 8, 2, 19, 14, 290 }, // ̚
-    { 8, 7, 0, -2, 20, 14, 304 }, // ̛
-    { 5, 7, 0, -2, 0, 9, 318 }, // ̜
-    { 7, 5, 0, -6, -1, 9, 327 }, // ̝
-    { 6, 5, 0, -5, -1, 8, 336 }, // ̞
-    { 6, 6, 0, -5, 0, 9, 344 }, // ̟
-    { 7, 3, 0, -6, -2, 6, 353 }, // ̠
-    { 8, 8, 0, -6, 2, 16, 359 }, // ̡
-    { 6, 8, 0, -3, 2, 12, 375 }, // ̢
-    { 5, 5, 0, -12, -1, 7, 387 }, // ̣
-    { 9, 4, 0, -7, -1, 9, 394 }, // ̤
-    { 7, 6, 0, -6, 0, 11, 403 }, // ̥
-    { 6, 5, 0, 1, -1, 8, 414 }, // ̦
-    { 7, 6, 0, -5, 0, 11, 422 }, // ̧
-    { 6, 7, 0, -5, 0, 11, 433 }, // ̨
-    { 5, 8, 0, -4, 0, 10, 444 }, // ̩
-    { 10, 5, 0, -7, -1, 13, 454 }, // ̪
-    { 10, 4, 0, -7, -1, 10, 467 }, // ̫
-    { 11, 5, 0, -7, 0, 14, 477 }, // ̬
-    { 11, 5, 0, -8, 0, 14, 491 }, // ̭
-    { 10, 5, 0, -7, 0, 13, 505 }, // ̮
-    { 10, 5, 0, -7, -1, 13, 518 }, // ̯
-    { 12, 4, 0, -8, -1, 12, 531 }, // ̰
-    { 9, 3, 0, -7, -2, 7, 543 }, // ̱
-    { 12, 2, 0, -8, -2, 6, 550 }, // ̲
-    { 13, 6, 0, -9, 0, 20, 556 }, // ̳
-    { 12, 4, 0, -6, 9, 12, 576 }, // ̴
-    { 11, 4, 0, -6, 9, 11, 588 }, // ̵
-    { 20, 4, 0, -10, 9, 20, 599 }, // ̶
-    { 10, 8, 0, -5, 11, 20, 619 }, // ̷
-    { 16, 21, 0, -8, 19, 84, 639 }, // ̸
-    { 4, 7, 0, -2, 0, 7, 723 }, // ̹
-    { 10, 5, 0, -7, -1, 13, 730 }, // ̺
-    { 10, 6, 0, -7, 0, 15, 743 }, // ̻
-    { 10, 4, 0, -7, -1, 10, 758 }, // ̼
-    { 7, 6, 0, -1, 20, 11, 768 }, // ̽
-    { 6, 8, 0, -1, 22, 12, 779 }, // ̾
-    { 12, 6, 0, -3, 25, 18, 791 }, // ̿
-    { 6, 5, 0, -2, 20, 8, 809 }, // ̀
-    { 7, 5, 0, 0, 20, 9, 817 }, // ́
-    { 12, 4, 0, 3, 19, 12, 826 }, // ͂
-    { 5, 6, 0, 0, 20, 8, 838 }, // ̓
-    { 14, 5, 0, -4, 20, 18, 846 }, // ̈́
-    { 6, 5, 0, -4, -1, 8, 864 }, // ͅ
-    { 12, 6, 0, -4, 20, 18, 872 }, // ͆
-    { 12, 6, 0, -8, 0, 18, 890 }, // ͇
-    { 8, 6, 0, -6, 0, 12, 908 }, // ͈
-    { 6, 5, 0, -5, -1, 8, 920 }, // ͉
-    { 10, 6, 0, -3, 20, 15, 928 }, // ͊
-    { 11, 10, 0, -3, 24, 28, 943 }, // ͋
-    { 11, 7, 0, -3, 22, 20, 971 }, // ͌
-    { 10, 6, 0, -7, 0, 15, 991 }, // ͍
-    { 5, 6, 0, -4, 0, 8, 1006 }, // ͎
-    { 18, 18, 0, -9, 18, 81, 1014 }, // ͏
-    { 5, 6, 0, 0, 20, 8, 1095 }, // ͐
-    { 4, 7, 0, 3, 22, 7, 1103 }, // ͑
-    { 10, 7, 0, -3, 22, 18, 1110 }, // ͒
-    { 5, 6, 0, -4, 0, 8, 1128 }, // ͓
-    { 5, 5, 0, -4, -1, 7, 1136 }, // ͔
-    { 5, 5, 0, -4, -1, 7, 1143 }, // ͕
-    { 10, 5, 0, -6, -1, 13, 1150 }, // ͖
-    { 5, 7, 0, 2, 21, 9, 1163 }, // ͗
-    { 5, 5, 0, 0, 20, 7, 1172 }, // ͘
-    { 6, 6, 0, -5, 0, 9, 1179 }, // ͙
-    { 10, 6, 0, -7, 0, 15, 1188 }, // ͚
-    { 5, 6, 0, 0, 20, 8, 1203 }, // ͛
-    { 20, 5, 0, -11, -1, 25, 1211 }, // ͜
-    { 20, 5, 0, -8, 19, 25, 1236 }, // ͝
-    { 14, 3, 0, -5, 18, 11, 1261 }, // ͞
-    { 14, 3, 0, -9, -1, 11, 1272 }, // ͟
-    { 21, 4, 0, -8, 19, 21, 1283 }, // ͠
-    { 20, 6, 0, -7, 22, 30, 1304 }, // ͡
-    { 21, 6, 0, -13, 0, 32, 1334 }, // ͢
-    { 7, 7, 0, -1, 22, 13, 1366 }, // ͣ
-    { 7, 7, 0, -1, 22, 13, 1379 }, // ͤ
-    { 5, 9, 0, 0, 24, 12, 1392 }, // ͥ
-    { 7, 7, 0, -1, 22, 13, 1404 }, // ͦ
-    { 7, 6, 0, -1, 21, 11, 1417 }, // ͧ
-    { 6, 7, 0, 0, 22, 11, 1428 }, // ͨ
-    { 8, 9, 0, -1, 24, 18, 1439 }, // ͩ
-    { 7, 9, 0, -1, 24, 16, 1457 }, // ͪ
-    { 10, 7, 0, -3, 22, 18, 1473 }, // ͫ
-    { 6, 7, 0, 0, 22, 11, 1491 }, // ͬ
-    { 5, 8, 0, 0, 23, 10, 1502 }, // ͭ
-    { 6, 6, 0, 0, 21, 9, 1512 }, // ͮ
-    { 8, 6, 0, -2, 21, 12, 1521 }, // ͯ
-    { 15, 24, 13, 0, 24, 90, 0 }, // Ѐ
-    { 15, 24, 13, 0, 24, 90, 90 }, // Ё
-    { 15, 19, 18, 2, 18, 72, 180 }, // Ђ
-    { 15, 24, 13, 0, 24, 90, 252 }, // Ѓ
-    { 16, 20, 15, 1, 19, 80, 342 }, // Є
-    { 14, 20, 13, 0, 19, 70, 422 }, // Ѕ
-    { 9, 18, 8, 0, 18, 41, 492 }, // І
-    { 11, 24, 8, 0, 24, 66, 533 }, // Ї
-    { 14, 24, 8, -5, 18, 84, 599 }, // Ј
-    { 25, 19, 24, -1, 18, 119, 683 }, // Љ
-    { 23, 18, 23, 0, 18, 104, 802 }, // Њ
-    { 15, 18, 18, 2, 18, 68, 906 }, // Ћ
-    { 18, 24, 16, 0, 24, 108, 974 }, // Ќ
-    { 18, 24, 17, 0, 24, 108, 1082 }, // Ѝ
-    { 18, 25, 15, 0, 24, 113, 1190 }, // Ў
-    { 18, 22, 17, 0, 18, 99, 1303 }, // Џ
-    { 17, 18, 16, -2, 18, 77, 1402 }, // А
-    { 15, 18, 15, 0, 18, 68, 1479 }, // Б
-    { 16, 18, 15, 0, 18, 72, 1547 }, // В
-    { 15, 18, 13, 0, 18, 68, 1619 }, // Г
-    { 21, 22, 18, -3, 18, 116, 1687 }, // Д
-    { 15, 18, 13, 0, 18, 68, 1803 }, // Е
-    { 27, 18, 23, -2, 18, 122, 1871 }, // Ж
-    { 15, 20, 14, 0, 19, 75, 1993 }, // З
-    { 18, 18, 17, 0, 18, 81, 2068 }, // И
-    { 18, 24, 17, 0, 24, 108, 2149 }, // Й
-    { 18, 18, 16, 0, 18, 81, 2257 }, // К
-    { 19, 19, 17, -1, 18, 91, 2338 }, // Л
-    { 23, 18, 22, 0, 18, 104, 2429 }, // М
-    { 18, 18, 17, 0, 18, 81, 2533 }, // Н
-    { 17, 20, 18, 1, 19, 85, 2614 }, // О
-    { 18, 18, 17, 0, 18, 81, 2699 }, // П
-    { 16, 18, 15, 0, 18, 72, 2780 }, // Р
-    { 16, 20, 15, 1, 19, 80, 2852 }, // С
-    { 14, 18, 13, 2, 18, 63, 2932 }, // Т
-    { 18, 19, 15, 0, 18, 86, 2995 }, // У
-    { 21, 20, 22, 1, 19, 105, 3081 }, // Ф
-    { 20, 18, 15, -2, 18, 90, 3186 }, // Х
-    { 18, 22, 17, 0, 18, 99, 3276 }, // Ц
-    { 15, 18, 17, 2, 18, 68, 3375 }, // Ч
-    { 25, 18, 25, 0, 18, 113, 3443 }, // Ш
-    { 25, 22, 25, 0, 18, 138, 3556 }, // Щ
-    { 15, 18, 17, 2, 18, 68, 3694 }, // Ъ
-    { 23, 18, 22, 0, 18, 104, 3762 }, // Ы
-    { 15, 18, 15, 0, 18, 68, 3866 }, // Ь
-    { 16, 20, 15, 0, 19, 80, 3934 }, // Э
-    { 25, 20, 25, 0, 19, 125, 4014 }, // Ю
-    { 18, 18, 15, -2, 18, 81, 4139 }, // Я
-    { 15, 15, 15, 0, 14, 57, 4220 }, // а
-    { 14, 21, 14, 1, 20, 74, 4277 }, // б
-    { 14, 15, 14, 0, 14, 53, 4351 }, // в
-    { 13, 15, 12, -1, 14, 49, 4404 }, // г
-    { 14, 21, 14, 0, 20, 74, 4453 }, // д
-    { 13, 15, 13, 0, 14, 49, 4527 }, // е
-    { 26, 15, 24, -1, 14, 98, 4576 }, // ж
-    { 12, 15, 12, 0, 14, 45, 4674 }, // з
-    { 14, 15, 15, 1, 14, 53, 4719 }, // и
-    { 14, 21, 15, 1, 20, 74, 4772 }, // й
-    { 16, 14, 14, 0, 14, 56, 4846 }, // к
-    { 16, 15, 15, -1, 14, 60, 4902 }, // л
-    { 19, 14, 19, 0, 14, 67, 4962 }, // м
-    { 15, 14, 15, 0, 14, 53, 5029 }, // н
-    { 14, 15, 14, 0, 14, 53, 5082 }, // о
-    { 14, 14, 15, 0, 14, 49, 5135 }, // п
-    { 16, 20, 15, -1, 14, 80, 5184 }, // р
-    { 12, 15, 12, 0, 14, 45, 5264 }, // с
-    { 22, 14, 22, 0, 14, 77, 5309 }, // т
-    { 17, 20, 13, -2, 14, 85, 5386 }, // у
-    { 18, 25, 19, 0, 19, 113, 5471 }, // ф
-    { 17, 14, 13, -2, 14, 60, 5584 }, // х
-    { 14, 18, 15, 1, 14, 63, 5644 }, // ц
-    { 14, 14, 14, 1, 14, 49, 5707 }, // ч
-    { 22, 15, 22, 1, 14, 83, 5756 }, // ш
-    { 22, 18, 23, 1, 14, 99, 5839 }, // щ
-    { 15, 15, 16, 0, 14, 57, 5938 }, // ъ
-    { 20, 15, 20, 0, 14, 75, 5995 }, // ы
-    { 13, 15, 14, 0, 14, 49, 6070 }, // ь
-    { 12, 15, 12, 0, 14, 45, 6119 }, // э
-    { 20, 15, 20, 0, 14, 75, 6164 }, // ю
-    { 16, 14, 14, -2, 14, 56, 6239 }, // я
-    { 13, 21, 13, 0, 20, 69, 6295 }, // ѐ
-    { 13, 20, 13, 0, 19, 65, 6364 }, // ё
-    { 14, 25, 15, 0, 19, 88, 6429 }, // ђ
-    { 14, 21, 12, -1, 20, 74, 6517 }, // ѓ
-    { 12, 15, 12, 0, 14, 45, 6591 }, // є
-    { 12, 15, 11, 0, 14, 45, 6636 }, // ѕ
-    { 9, 20, 7, 0, 20, 45, 6681 }, // і
-    { 10, 19, 7, 0, 19, 48, 6726 }, // ї
-    { 13, 26, 7, -4, 20, 85, 6774 }, // ј
-    { 22, 15, 21, -1, 14, 83, 6859 }, // љ
-    { 21, 15, 21, 0, 14, 79, 6942 }, // њ
-    { 14, 19, 15, 0, 19, 67, 7021 }, // ћ
-    { 16, 20, 14, 0, 20, 80, 7088 }, // ќ
-    { 14, 21, 15, 1, 20, 74, 7168 }, // ѝ
-    { 17, 26, 13, -2, 20, 111, 7242 }, // ў
-    { 14, 19, 15, 1, 14, 67, 7353 }, // џ
-    { 23, 18, 22, 2, 18, 104, 7420 }, // Ѡ
-    { 21, 14, 20, 1, 14, 74, 7524 }, // ѡ
-    { 14, 18, 16, 1, 18, 63, 7598 }, // Ѣ
-    { 20, 15, 21, 0, 14, 75, 7661 }, // ѣ
-    { 24, 20, 22, 0, 19, 120, 7736 }, // Ѥ
-    { 19, 15, 19, 0, 14, 72, 7856 }, // ѥ
-    { 18, 18, 17, -2, 18, 81, 7928 }, // Ѧ
-    { 16, 14, 15, -2, 14, 56, 8009 }, // ѧ
-    { 22, 18, 23, 0, 18, 99, 8065 }, // Ѩ
-    { 20, 14, 21, 0, 14, 70, 8164 }, // ѩ
-    { 21, 18, 18, -2, 18, 95, 8234 }, // Ѫ
-    { 17, 14, 14, -2, 14, 60, 8329 }, // ѫ
-    { 26, 18, 25, 0, 18, 117, 8389 }, // Ѭ
-    { 22, 14, 21, 0, 14, 77, 8506 }, // ѭ
-    { 16, 28, 15, -1, 22, 112, 8583 }, // Ѯ
-    { 15, 23, 13, -2, 17, 87, 8695 }, // ѯ
-    { 21, 18, 21, 2, 18, 95, 8782 }, // Ѱ
-    { 19, 25, 20, 1, 19, 119, 8877 }, // ѱ
-    { 17, 20, 18, 1, 19, 85, 8996 }, // Ѳ
-    { 13, 15, 15, 1, 14, 49, 9081 }, // ѳ
-    { 16, 18, 16, 2, 18, 72, 9130 }, // Ѵ
-    { 14, 14, 14, 1, 14, 49, 9202 }, // ѵ
-    { 16, 24, 16, 2, 24, 96, 9251 }, // Ѷ
-    { 14, 20, 14, 1, 20, 70, 9347 }, // ѷ
-    { 32, 25, 31, 1, 19, 200, 9417 }, // Ѹ
-    { 28, 20, 28, 1, 14, 140, 9617 }, // ѹ
-    { 18, 22, 19, 1, 20, 99, 9757 }, // Ѻ
-    { 14, 17, 16, 1, 15, 60, 9856 }, // ѻ
-    { 24, 27, 25, 1, 26, 162, 9916 }, // Ѽ
-    { 20, 23, 22, 1, 22, 115, 10078 }, // ѽ
-    { 23, 23, 22, 2, 23, 133, 10193 }, // Ѿ
-    { 21, 19, 20, 1, 19, 100, 10326 }, // ѿ
-    { 16, 25, 15, 1, 19, 100, 10426 }, // Ҁ
-    { 12, 20, 12, 1, 14, 60, 10526 }, // ҁ
-    { 13, 17, 15, 1, 16, 56, 10586 }, // ҂
-    { 10, 5, 0, -10, 19, 13, 10642 }, // ҃
-    { 10, 4, 0, -10, 19, 10, 10655 }, // ҄
-    { 5, 6, 0, -7, 20, 8, 10665 }, // ҅
-    { 5, 6, 0, -7, 20, 8, 10673 }, // ҆
-    { 11, 4, 0, -3, 23, 11, 10681 }, // ҇
-    { 30, 27, 0, -15, 20, 203, 10692 }, // ҈
-    { 28, 28, 0, -14, 21, 196, 10895 }, // ҉
-    { 20, 30, 21, 0, 24, 150, 11091 }, // Ҋ
-    { 15, 25, 16, 1, 20, 94, 11241 }, // ҋ
-    { 14, 18, 15, 0, 18, 63, 11335 }, // Ҍ
-    { 12, 20, 14, 1, 19, 60, 11398 }, // ҍ
-    { 16, 18, 15, 0, 18, 72, 11458 }, // Ҏ
-    { 15, 20, 15, -1, 14, 75, 11530 }, // ҏ
-    { 16, 22, 13, 0, 22, 88, 11605 }, // Ґ
-    { 14, 18, 12, 0, 18, 63, 11693 }, // ґ
-    { 15, 18, 13, 0, 18, 68, 11756 }, // Ғ
-    { 14, 14, 12, -1, 14, 49, 11824 }, // ғ
-    { 15, 25, 17, 0, 18, 94, 11873 }, // Ҕ
-    { 13, 21, 14, 0, 14, 69, 11967 }, // ҕ
-    { 26, 24, 23, -2, 18, 156, 12036 }, // Җ
-    { 26, 19, 24, -1, 14, 124, 12192 }, // җ
-    { 15, 26, 14, 0, 19, 98, 12316 }, // Ҙ
-    { 12, 21, 12, 0, 14, 63, 12414 }, // ҙ
-    { 18, 24, 17, 0, 18, 108, 12477 }, // Қ
-    { 16, 19, 15, 0, 14, 76, 12585 }, // қ
-    { 18, 18, 16, 0, 18, 81, 12661 }, // Ҝ
-    { 15, 14, 15, 1, 14, 53, 12742 }, // ҝ
-    { 18, 18, 15, 0, 18, 81, 12795 }, // Ҟ
-    { 16, 19, 14, 0, 19, 76, 12876 }, // ҟ
-    { 18, 18, 18, 2, 18, 81, 12952 }, // Ҡ
-    { 18, 14, 16, 0, 14, 63, 13033 }, // ҡ
-    { 18, 24, 19, 0, 18, 108, 13096 }, // Ң
-    { 16, 19, 17, 0, 14, 76, 13204 }, // ң
-    { 22, 18, 19, 0, 18, 99, 13280 }, // Ҥ
-    { 20, 14, 18, 0, 14, 70, 13379 }, // ҥ
-    { 24, 25, 26, 0, 18, 150, 13449 }, // Ҧ
-    { 20, 21, 22, 0, 14, 105, 13599 }, // ҧ
-    { 17, 21, 18, 1, 19, 90, 13704 }, // Ҩ
-    { 14, 15, 15, 1, 14, 53, 13794 }, // ҩ
-    { 16, 26, 15, 1, 19, 104, 13847 }, // Ҫ
-    { 12, 21, 12, 1, 14, 63, 13951 }, // ҫ
-    { 14, 24, 13, 2, 18, 84, 14014 }, // Ҭ
-    { 23, 19, 23, 0, 14, 110, 14098 }, // ҭ
-    { 15, 18, 14, 2, 18, 68, 14208 }, // Ү
-    { 14, 20, 13, 1, 14, 70, 14276 }, // ү
-    { 17, 18, 14, 0, 18, 77, 14346 }, // Ұ
-    { 16, 20, 13, -1, 14, 80, 14423 }, // ұ
-    { 20, 24, 17, -2, 18, 120, 14503 }, // Ҳ
-    { 16, 19, 15, -1, 14, 76, 14623 }, // ҳ
-    { 19, 24, 21, 2, 18, 114, 14699 }, // Ҵ
-    { 16, 19, 17, 1, 14, 76, 14813 }, // ҵ
-    { 16, 24, 19, 2, 18, 96, 14889 }, // Ҷ
-    { 13, 19, 16, 2, 14, 62, 14985 }, // ҷ
-    { 15, 18, 17, 2, 18, 68, 15047 }, // Ҹ
-    { 13, 14, 15, 2, 14, 46, 15115 }, // ҹ
-    { 16, 18, 17, 0, 18, 72, 15161 }, // Һ
-    { 14, 19, 15, 0, 19, 67, 15233 }, // һ
-    { 20, 20, 19, 0, 19, 100, 15300 }, // Ҽ
-    { 16, 15, 17, 0, 14, 60, 15400 }, // ҽ
-    { 20, 25, 19, 0, 19, 125, 15460 }, // Ҿ
-    { 16, 19, 17, 0, 14, 76, 15585 }, // ҿ
-    { 12, 18, 10, -1, 18, 54, 15661 }, // Ӏ
-    { 27, 24, 23, -2, 24, 162, 15715 }, // Ӂ
-    { 26, 21, 24, -1, 20, 137, 15877 }, // ӂ
-    { 18, 25, 17, 0, 18, 113, 16014 }, // Ӄ
-    { 16, 21, 15, 0, 14, 84, 16127 }, // ӄ
-    { 20, 24, 19, -1, 18, 120, 16211 }, // Ӆ
-    { 17, 19, 16, -1, 14, 81, 16331 }, // ӆ
-    { 18, 25, 18, 0, 18, 113, 16412 }, // Ӈ
-    { 15, 21, 15, 0, 14, 79, 16525 }, // ӈ
-    { 19, 24, 19, 0, 18, 114, 16604 }, // Ӊ
-    { 16, 19, 17, 0, 14, 76, 16718 }, // ӊ
-    { 15, 24, 17, 2, 18, 90, 16794 }, // Ӌ
-    { 13, 19, 15, 2, 14, 62, 16884 }, // ӌ
-    { 23, 24, 24, 0, 18, 138, 16946 }, // Ӎ
-    { 21, 19, 21, 0, 14, 100, 17084 }, // ӎ
-    { 12, 18, 10, -1, 18, 54, 17184 }, // ӏ
-    { 18, 24, 16, -2, 24, 108, 17238 }, // Ӑ
-    { 14, 21, 15, 1, 20, 74, 17346 }, // ӑ
-    { 17, 23, 16, -2, 23, 98, 17420 }, // Ӓ
-    { 14, 20, 15, 1, 19, 70, 17518 }, // ӓ
-    { 26, 18, 22, -2, 18, 117, 17588 }, // Ӕ
-    { 21, 15, 22, 1, 14, 79, 17705 }, // ӕ
-    { 16, 24, 14, 0, 24, 96, 17784 }, // Ӗ
-    { 14, 21, 14, 1, 20, 74, 17880 }, // ӗ
-    { 16, 20, 17, 0, 19, 80, 17954 }, // Ә
-    { 13, 15, 14, 0, 14, 49, 18034 }, // ә
-    { 16, 24, 17, 0, 23, 96, 18083 }, // Ӛ
-    { 13, 20, 14, 0, 19, 65, 18179 }, // ӛ
-    { 27, 23, 23, -2, 23, 156, 18244 }, // Ӝ
-    { 26, 20, 24, -1, 19, 130, 18400 }, // ӝ
-    { 15, 24, 14, 0, 23, 90, 18530 }, // Ӟ
-    { 13, 20, 12, 0, 19, 65, 18620 }, // ӟ
-    { 16, 19, 14, -1, 18, 76, 18685 }, // Ӡ
-    { 16, 21, 14, -2, 14, 84, 18761 }, // ӡ
-    { 18, 22, 17, 0, 22, 99, 18845 }, // Ӣ
-    { 14, 19, 15, 1, 18, 67, 18944 }, // ӣ
-    { 18, 23, 17, 0, 23, 104, 19011 }, // Ӥ
-    { 14, 20, 15, 1, 19, 70, 19115 }, // ӥ
-    { 17, 24, 18, 1, 23, 102, 19185 }, // Ӧ
-    { 13, 20, 15, 1, 19, 65, 19287 }, // ӧ
-    { 17, 20, 18, 1, 19, 85, 19352 }, // Ө
-    { 13, 15, 15, 1, 14, 49, 19437 }, // ө
-    { 17, 24, 18, 1, 23, 102, 19486 }, // Ӫ
-    { 13, 20, 15, 1, 19, 65, 19588 }, // ӫ
-    { 16, 24, 15, 0, 23, 96, 19653 }, // Ӭ
-    { 12, 20, 12, 0, 19, 60, 19749 }, // ӭ
-    { 18, 23, 15, 0, 22, 104, 19809 }, // Ӯ
-    { 17, 24, 13, -2, 18, 102, 19913 }, // ӯ
-    { 18, 24, 15, 0, 23, 108, 20015 }, // Ӱ
-    { 17, 25, 13, -2, 19, 107, 20123 }, // ӱ
-    { 18, 25, 15, 0, 24, 113, 20230 }, // Ӳ
-    { 18, 26, 13, -2, 20, 117, 20343 }, // ӳ
-    { 15, 23, 17, 2, 23, 87, 20460 }, // Ӵ
-    { 14, 19, 14, 1, 19, 67, 20547 }, // ӵ
-    { 15, 24, 13, 0, 18, 90, 20614 }, // Ӷ
-    { 13, 19, 12, 0, 14, 62, 20704 }, // ӷ
-    { 23, 23, 22, 0, 23, 133, 20766 }, // Ӹ
-    { 20, 20, 20, 0, 19, 100, 20899 }, // ӹ
-    { 15, 25, 13, 0, 18, 94, 20999 }, // Ӻ
-    { 14, 21, 12, -1, 14, 74, 21093 }, // ӻ
-    { 20, 25, 17, -2, 18, 125, 21167 }, // Ӽ
-    { 17, 21, 15, -2, 14, 90, 21292 }, // ӽ
-    { 20, 18, 15, -2, 18, 90, 21382 }, // Ӿ
-    { 17, 14, 13, -2, 14, 60, 21472 }, // ӿ
-    { 0, 0, 13, 0, 0, 0, 0 }, //  
-    { 0, 0, 25, 0, 0, 0, 0 }, //  
-    { 0, 0, 13, 0, 0, 0, 0 }, //  
-    { 0, 0, 25, 0, 0, 0, 0 }, //  
-    { 0, 0, 8, 0, 0, 0, 0 }, //  
-    { 0, 0, 6, 0, 0, 0, 0 }, //  
-    { 0, 0, 4, 0, 0, 0, 0 }, //  
-    { 0, 0, 14, 0, 0, 0, 0 }, //  
-    { 0, 0, 7, 0, 0, 0, 0 }, //  
-    { 0, 0, 4, 0, 0, 0, 0 }, //  
-    { 0, 0, 3, 0, 0, 0, 0 }, //  
-    { 0, 0, 0, 0, 0, 0, 0 }, // ​
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‍
-    { 7, 22, 0, -1, 18, 39, 0 }, // ‎
-    { 7, 22, 0, -6, 18, 39, 39 }, // ‏
-    { 8, 4, 8, 0, 9, 8, 78 }, // ‐
-    { 8, 4, 8, 0, 9, 8, 86 }, // ‑
-    { 14, 4, 14, 0, 11, 14, 94 }, // ‒
-    { 12, 4, 12, 0, 9, 12, 108 }, // –
-    { 24, 4, 24, 0, 9, 24, 120 }, // —
-    { 24, 4, 24, 0, 9, 24, 144 }, // ―
-    { 10, 25, 14, 2, 19, 63, 168 }, // ‖
-    { 12, 6, 10, -3, 0, 18, 231 }, // ‗
-    { 7, 7, 5, 1, 18, 13, 249 }, // ‘
-    { 7, 7, 5, 1, 18, 13, 262 }, // ’
-    { 7, 7, 7, -2, 3, 13, 275 }, // ‚
-    { 5, 7, 5, 2, 18, 9, 288 }, // ‛
-    { 12, 7, 11, 1, 18, 21, 297 }, // “
-    { 12, 7, 11, 1, 18, 21, 318 }, // ”
-    { 13, 7, 12, -2, 3, 23, 339 }, // „
-    { 10, 7, 11, 2, 18, 18, 362 }, // ‟
-    { 11, 19, 13, 2, 19, 53, 380 }, // †
-    { 14, 19, 13, 0, 19, 67, 433 }, // ‡
-    { 8, 8, 9, 1, 13, 16, 500 }, // •
-    { 8, 10, 9, 1, 14, 20, 516 }, // ‣
-    { 6, 5, 13, 2, 4, 8, 536 }, // ․
-    { 12, 5, 14, 0, 4, 15, 544 }, // ‥
-    { 19, 5, 21, 0, 4, 24, 559 }, // …
-    { 6, 5, 8, 1, 9, 8, 583 }, // ‧
-    { 0, 0, 15, 0, 0, 0, 591 }, //  
-    { 0, 0, 15, 0, 0, 0, 591 }, //  
-    { 7, 20, 0, -1, 16, 35, 591 }, // ‪
-    { 7, 20, 0, -6, 16, 35, 626 }, // ‫
-    { 6, 22, 0, -3, 18, 33, 661 }, // ‬
-    { 6, 22, 0, -3, 18, 33, 694 }, // ‭
-    { 6, 22, 0, -3, 18, 33, 727 }, // ‮
-    { 0, 0, 4, 0, 0, 0, 760 }, //  
-    { 29, 20, 30, 1, 19, 145, 760 }, // ‰
-    { 38, 20, 40, 1, 19, 190, 905 }, // ‱
-    { 8, 7, 7, 1, 18, 14, 1095 }, // ′
-    { 14, 7, 13, 1, 18, 25, 1109 }, // ″
-    { 20, 7, 19, 1, 18, 35, 1134 }, // ‴
-    { 7, 7, 7, 1, 18, 13, 1169 }, // ‵
-    { 13, 7, 13, 1, 18, 23, 1182 }, // ‶
-    { 19, 7, 19, 1, 18, 34, 1205 }, // ‷
-    { 9, 9, 9, -2, 3, 21, 1239 }, // ‸
-    { 9, 12, 8, 0, 13, 27, 1260 }, // ‹
-    { 8, 12, 8, 0, 13, 24, 1287 }, // ›
-    { 21, 20, 21, 0, 19, 105, 1311 }, // ※
-    { 15, 19, 14, 0, 18, 72, 1416 }, // ‼
-    { 11, 20, 12, 2, 19, 55, 1488 }, // ‽
-    { 12, 4, 11, 2, 22, 12, 1543 }, // ‾
-    { 14, 6, 13, -2, 0, 21, 1555 }, // ‿
-    { 13, 6, 13, 2, 20, 20, 1576 }, // ⁀
-    { 14, 17, 10, -3, 11, 60, 1596 }, // ⁁
-    { 29, 24, 29, -1, 20, 174, 1656 }, // ⁂
-    { 8, 4, 8, 0, 9, 8, 1830 }, // ⁃
-    { 17, 18, 3, -7, 18, 77, 1838 }, // ⁄
-    { 11, 22, 8, -1, 18, 61, 1915 }, // ⁅
-    { 11, 22, 8, -2, 18, 61, 1976 }, // ⁆
-    { 23, 20, 23, 1, 19, 115, 2037 }, // ⁇
-    { 19, 20, 19, 1, 19, 95, 2152 }, // ⁈
-    { 20, 20, 19, 0, 19, 100, 2247 }, // ⁉
-    { 13, 14, 13, 1, 14, 46, 2347 }, // ⁊
-    { 14, 23, 16, 2, 19, 81, 2393 }, // ⁋
-    { 14, 13, 16, 1, 14, 46, 2474 }, // ⁌
-    { 14, 13, 16, 1, 14, 46, 2520 }, // ⁍
-    { 13, 13, 14, -1, 8, 43, 2566 }, // ⁎
-    { 7, 18, 7, 0, 14, 32, 2609 }, // ⁏
-    { 17, 26, 13, -2, 20, 111, 2641 }, // ⁐
-    { 16, 26, 14, -1, 20, 104, 2752 }, // ⁑
-    { 11, 20, 11, 0, 19, 55, 2856 }, // ⁒
-    { 24, 6, 25, 1, 10, 36, 2911 }, // ⁓
-    { 14, 6, 13, -3, 0, 21, 2947 }, // ⁔
-    { 14, 14, 14, 0, 13, 49, 2968 }, // ⁕
-    { 12, 20, 14, 1, 19, 60, 3017 }, // ⁖
-    { 23, 7, 22, 1, 18, 41, 3077 }, // ⁗
-    { 19, 20, 21, 1, 19, 95, 3118 }, // ⁘
-    { 19, 20, 21, 1, 19, 95, 3213 }, // ⁙
-    { 5, 20, 7, 1, 19, 25, 3308 }, // ⁚
-    { 16, 21, 18, 1, 20, 84, 3333 }, // ⁛
-    { 20, 20, 21, 0, 19, 100, 3417 }, // ⁜
-    { 5, 20, 7, 1, 19, 25, 3517 }, // ⁝
-    { 5, 20, 7, 1, 19, 25, 3542 }, // ⁞
-    { 0, 0, 6, 0, 0, 0, 3567 }, //  
-    { 0, 0, 15, 0, 0, 0, 3567 }, // ⁠
-    { 0, 0, 15, 0, 0, 0, 3567 }, // ⁡
-    { 0, 0, 15, 0, 0, 0, 3567 }, // ⁢
-    { 0, 0, 15, 0, 0, 0, 3567 }, // ⁣
-    { 0, 0, 15, 0, 0, 0, 3567 }, // ⁤
-    { 0, 0, 15, 0, 0, 0, 3567 }, // ⁦
-    { 0, 0, 15, 0, 0, 0, 3567 }, // ⁧
-    { 0, 0, 15, 0, 0, 0, 3567 }, // ⁨
-    { 0, 0, 15, 0, 0, 0, 3567 }, // ⁩
-    { 6, 22, 0, -3, 18, 33, 3567 }, // ⁪
-    { 6, 22, 0, -3, 18, 33, 3600 }, // ⁫
-    { 6, 22, 0, -3, 18, 33, 3633 }, // ⁬
-    { 6, 22, 0, -3, 18, 33, 3666 }, // ⁭
-    { 6, 22, 0, -3, 18, 33, 3699 }, // ⁮
-    { 6, 22, 0, -3, 18, 33, 3732 }, // ⁯
-    { 9, 12, 9, 2, 22, 27, 0 }, // ⁰
-    { 6, 12, 6, 1, 19, 18, 27 }, // ⁱ
-    { 10, 12, 9, 1, 22, 30, 45 }, // ⁴
-    { 10, 12, 9, 1, 22, 30, 75 }, // ⁵
-    { 9, 12, 9, 2, 22, 27, 105 }, // ⁶
-    { 10, 12, 9, 2, 22, 30, 132 }, // ⁷
-    { 10, 12, 9, 1, 22, 30, 162 }, // ⁸
-    { 9, 12, 9, 2, 22, 27, 192 }, // ⁹
-    { 9, 8, 9, 2, 19, 18, 219 }, // ⁺
-    { 9, 2, 9, 2, 16, 5, 237 }, // ⁻
-    { 8, 6, 10, 3, 18, 12, 242 }, // ⁼
-    { 6, 15, 6, 3, 23, 23, 254 }, // ⁽
-    { 7, 15, 6, 0, 23, 27, 277 }, // ⁾
-    { 10, 9, 10, 1, 16, 23, 304 }, // ⁿ
-    { 10, 12, 9, -1, 8, 30, 327 }, // ₀
-    { 9, 12, 9, -1, 8, 27, 357 }, // ₁
-    { 10, 12, 9, -2, 8, 30, 384 }, // ₂
-    { 10, 12, 9, -2, 8, 30, 414 }, // ₃
-    { 10, 12, 9, -2, 8, 30, 444 }, // ₄
-    { 10, 12, 9, -1, 8, 30, 474 }, // ₅
-    { 10, 12, 9, -1, 8, 30, 504 }, // ₆
-    { 10, 12, 9, -1, 8, 30, 534 }, // ₇
-    { 9, 12, 9, -1, 8, 27, 564 }, // ₈
-    { 9, 12, 9, -1, 8, 27, 591 }, // ₉
-    { 8, 8, 9, 0, 6, 16, 618 }, // ₊
-    { 8, 2, 9, 0, 3, 4, 634 }, // ₋
-    { 8, 6, 10, 0, 5, 12, 638 }, // ₌
-    { 7, 15, 6, 0, 10, 27, 650 }, // ₍
-    { 7, 15, 6, -3, 10, 27, 677 }, // ₎
-    { 10, 9, 10, -1, 6, 23, 704 }, // ₐ
-    { 9, 9, 9, -1, 6, 21, 727 }, // ₑ
-    { 9, 9, 10, -1, 6, 21, 748 }, // ₒ
-    { 12, 9, 9, -3, 6, 27, 769 }, // ₓ
-    { 9, 9, 9, -1, 6, 21, 796 }, // ₔ
-    { 10, 12, 11, -1, 9, 30, 817 }, // ₕ
-    { 11, 12, 10, -1, 9, 33, 847 }, // ₖ
-    { 6, 12, 6, -1, 9, 18, 880 }, // ₗ
-    { 15, 9, 16, -1, 6, 34, 898 }, // ₘ
-    { 9, 9, 10, -1, 6, 21, 932 }, // ₙ
-    { 10, 12, 10, -2, 6, 30, 953 }, // ₚ
-    { 8, 9, 8, -1, 6, 18, 983 }, // ₛ
-    { 7, 11, 7, -1, 8, 20, 1001 }, // ₜ
-    { 14, 19, 14, 1, 19, 67, 0 }, // ₠
-    { 16, 21, 14, 0, 19, 84, 67 }, // ₡
-    { 16, 20, 14, 0, 19, 80, 151 }, // ₢
-    { 15, 18, 14, 0, 18, 68, 231 }, // ₣
-    { 17, 19, 14, -1, 19, 81, 299 }, // ₤
-    { 22, 20, 23, 0, 17, 110, 380 }, // ₥
-    { 16, 18, 15, 0, 18, 72, 490 }, // ₦
-    { 22, 19, 21, 0, 18, 105, 562 }, // ₧
-    { 23, 19, 22, 0, 18, 110, 667 }, // ₨
-    { 20, 18, 18, 0, 18, 90, 777 }, // ₩
-    { 22, 18, 22, 0, 18, 99, 867 }, // ₪
-    { 17, 23, 15, 0, 19, 98, 966 }, // ₫
-    { 16, 20, 14, 0, 19, 80, 1064 }, // €
-    { 17, 18, 14, 0, 18, 77, 1144 }, // ₭
-    { 16, 18, 13, 0, 18, 72, 1221 }, // ₮
-    { 25, 25, 25, 0, 19, 157, 1293 }, // ₯
-    { 17, 25, 15, -2, 19, 107, 1450 }, // ₰
-    { 16, 18, 14, 0, 18, 72, 1557 }, // ₱
-    { 17, 22, 17, 1, 20, 94, 1629 }, // ₲
-    { 18, 18, 15, -2, 18, 81, 1723 }, // ₳
-    { 15, 20, 14, 0, 19, 75, 1804 }, // ₴
-    { 16, 21, 15, 1, 19, 84, 1879 }, // ₵
-    { 18, 18, 17, 0, 17, 81, 1963 }, // ₶
-    { 19, 21, 17, -1, 19, 100, 2044 }, // ₷
-    { 14, 18, 13, 1, 18, 63, 2144 }, // ₸
-    { 14, 18, 14, 1, 18, 63, 2207 }, // ₹
-    { 14, 19, 14, 0, 18, 67, 2270 }, // ₺
-    { 16, 20, 16, 1, 19, 80, 2337 }, // ₻
-    { 20, 18, 20, -1, 18, 90, 2417 }, // ₼
-    { 16, 18, 15, -1, 18, 72, 2507 }, // ₽
-    { 18, 21, 15, -1, 21, 95, 2579 }, // ₾
-    { 14, 24, 14, 0, 21, 84, 2674 }, // ₿
-    { 8, 4, 8, 0, 9, 8, 0 }, // −
-    { 23, 23, 25, 1, 19, 133, 0 }, // �
+    { 15, 12, 14, 0, 13, 45, 5728 }, // «
+    { 13, 8, 14, 1, 11, 26, 506 }, // ¬
+    { 8, 4, 8, 0, 9, 8, 532 }, // ­
+    { 19, 20, 21, 1, 19, 95, 540 }, // ®
+    { 12, 4, 11, 2, 22, 12, 635 }, // ¯
+    { 9, 10, 11, 1, 19, 23, 647 }, // °
+    { 13, 16, 14, 1, 16, 52, 670 }, // ±
+    { 10, 12, 9, 1, 22, 30, 722 }, // ²
+    { 10, 12, 9, 1, 22, 30, 752 }, // ³
+    { 8, 5, 8, 2, 20, 10, 782 }, // ´
+    { 16, 20, 15, -1, 14, 80, 792 }, // µ
+    { 14, 23, 16, 1, 19, 81, 872 }, // ¶
+    { 6, 5, 7, 1, 11, 8, 953 }, // ·
+    { 7, 6, 5, -3, 0, 11, 961 }, // ¸
+    { 8, 12, 9, 2, 22, 24, 972 }, // ¹
+    { 8, 9, 9, 2, 18, 18, 996 }, // º
+    { 14, 12, 14, 0, 13, 42, 5773 }, // »
+    { 19, 19, 21, 1, 19, 91, 1014 }, // ¼
+    { 21, 19, 22, 1, 19, 100, 1105 }, // ½
+    { 20, 19, 22, 1, 19, 95, 1205 }, // ¾
+    { 11, 19, 12, -1, 14, 53, 1300 }, // ¿
+    { 17, 24, 16, -2, 24, 102, 5815 }, // À
+    { 18, 24, 16, -2, 24, 108, 5917 }, // Á
+    { 18, 24, 16, -2, 24, 108, 6025 }, // Â
+    { 18, 23, 16, -2, 23, 104, 1353 }, // Ã
+    { 17, 23, 16, -2, 23, 98, 6133 }, // Ä
+    { 17, 25, 16, -2, 25, 107, 1457 }, // Å
+    { 26, 18, 22, -2, 18, 117, 1564 }, // Æ
+    { 16, 25, 15, 1, 19, 100, 6231 }, // Ç
+    { 15, 24, 14, 0, 24, 90, 6331 }, // È
+    { 15, 24, 14, 0, 24, 90, 6421 }, // É
+    { 15, 24, 14, 0, 24, 90, 6511 }, // Ê
+    { 15, 23, 14, 0, 23, 87, 6601 }, // Ë
+    { 12, 24, 10, -1, 24, 72, 6688 }, // Ì
+    { 14, 24, 10, -1, 24, 84, 6760 }, // Í
+    { 14, 24, 10, -1, 24, 84, 6844 }, // Î
+    { 13, 23, 10, -1, 23, 75, 6928 }, // Ï
+    { 17, 18, 17, 0, 18, 77, 1681 }, // Ð
+    { 20, 23, 19, 0, 23, 115, 7003 }, // Ñ
+    { 17, 25, 18, 1, 24, 107, 7118 }, // Ò
+    { 17, 25, 18, 1, 24, 107, 7225 }, // Ó
+    { 17, 25, 18, 1, 24, 107, 7332 }, // Ô
+    { 17, 24, 18, 1, 23, 102, 1758 }, // Õ
+    { 17, 24, 18, 1, 23, 102, 7439 }, // Ö
+    { 12, 12, 14, 1, 15, 36, 1860 }, // ×
+    { 17, 21, 18, 1, 19, 90, 1896 }, // Ø
+    { 17, 25, 17, 1, 24, 107, 7541 }, // Ù
+    { 17, 25, 17, 1, 24, 107, 7648 }, // Ú
+    { 17, 25, 17, 1, 24, 107, 7755 }, // Û
+    { 17, 24, 17, 1, 23, 102, 7862 }, // Ü
+    { 15, 24, 14, 2, 24, 90, 1986 }, // Ý
+    { 15, 18, 15, 0, 18, 68, 2076 }, // Þ
+    { 20, 26, 16, -4, 20, 130, 2144 }, // ß
+    { 14, 21, 15, 1, 20, 74, 7964 }, // à
+    { 14, 21, 15, 1, 20, 74, 8038 }, // á
+    { 14, 21, 15, 1, 20, 74, 8112 }, // â
+    { 14, 20, 15, 1, 19, 70, 2274 }, // ã
+    { 14, 20, 15, 1, 19, 70, 8186 }, // ä
+    { 14, 22, 15, 1, 21, 77, 2344 }, // å
+    { 21, 15, 22, 1, 14, 79, 2421 }, // æ
+    { 12, 20, 12, 1, 14, 60, 8256 }, // ç
+    { 13, 21, 14, 1, 20, 69, 8316 }, // è
+    { 13, 21, 14, 1, 20, 69, 8385 }, // é
+    { 13, 21, 14, 1, 20, 69, 8454 }, // ê
+    { 13, 20, 14, 1, 19, 65, 8523 }, // ë
+    { 8, 20, 7, 0, 20, 40, 8588 }, // ì
+    { 11, 20, 7, 0, 20, 55, 8628 }, // í
+    { 11, 20, 7, 0, 20, 55, 8683 }, // î
+    { 10, 19, 7, 0, 19, 48, 8738 }, // ï
+    { 15, 21, 14, 0, 20, 79, 2500 }, // ð
+    { 15, 19, 15, 0, 19, 72, 8786 }, // ñ
+    { 13, 21, 15, 1, 20, 69, 8858 }, // ò
+    { 13, 21, 15, 1, 20, 69, 8927 }, // ó
+    { 13, 21, 15, 1, 20, 69, 8996 }, // ô
+    { 14, 20, 15, 1, 19, 70, 2579 }, // õ
+    { 13, 20, 15, 1, 19, 65, 9065 }, // ö
+    { 13, 13, 14, 1, 15, 43, 2649 }, // ÷
+    { 14, 17, 15, 0, 15, 60, 2692 }, // ø
+    { 14, 21, 15, 1, 20, 74, 9130 }, // ù
+    { 14, 21, 15, 1, 20, 74, 9204 }, // ú
+    { 14, 21, 15, 1, 20, 74, 9278 }, // û
+    { 14, 20, 15, 1, 19, 70, 9352 }, // ü
+    { 17, 26, 13, -2, 20, 111, 2752 }, // ý
+    { 15, 25, 15, -1, 19, 94, 2863 }, // þ
+    { 17, 25, 13, -2, 19, 107, 2957 }, // ÿ
+    { 17, 22, 16, -2, 22, 94, 3064 }, // Ā
+    { 14, 19, 15, 1, 18, 67, 3158 }, // ā
+    { 18, 24, 16, -2, 24, 108, 3225 }, // Ă
+    { 14, 21, 15, 1, 20, 74, 3333 }, // ă
+    { 17, 25, 16, -2, 18, 107, 3407 }, // Ą
+    { 14, 21, 15, 1, 14, 74, 3514 }, // ą
+    { 16, 25, 15, 1, 24, 100, 3588 }, // Ć
+    { 12, 21, 12, 1, 20, 63, 3688 }, // ć
+    { 16, 25, 15, 1, 24, 100, 3751 }, // Ĉ
+    { 12, 21, 12, 1, 20, 63, 3851 }, // ĉ
+    { 16, 25, 15, 1, 24, 100, 3914 }, // Ċ
+    { 12, 21, 12, 1, 20, 63, 4014 }, // ċ
+    { 16, 25, 15, 1, 24, 100, 4077 }, // Č
+    { 13, 21, 12, 1, 20, 69, 4177 }, // č
+    { 17, 24, 17, 0, 24, 102, 4246 }, // Ď
+    { 20, 20, 17, 1, 19, 100, 4348 }, // ď
+    { 17, 18, 17, 0, 18, 77, 4448 }, // Đ
+    { 16, 20, 15, 1, 19, 80, 4525 }, // đ
+    { 15, 22, 14, 0, 22, 83, 4605 }, // Ē
+    { 13, 19, 14, 1, 18, 62, 4688 }, // ē
+    { 15, 24, 14, 0, 24, 90, 4750 }, // Ĕ
+    { 13, 21, 14, 1, 20, 69, 4840 }, // ĕ
+    { 15, 24, 14, 0, 24, 90, 4909 }, // Ė
+    { 13, 21, 14, 1, 20, 69, 4999 }, // ė
+    { 15, 25, 14, 0, 18, 94, 5068 }, // Ę
+    { 13, 20, 14, 1, 14, 65, 5162 }, // ę
+    { 16, 24, 14, 0, 24, 96, 5227 }, // Ě
+    { 14, 21, 14, 1, 20, 74, 5323 }, // ě
+    { 16, 25, 17, 1, 24, 100, 5397 }, // Ĝ
+    { 15, 26, 15, 0, 20, 98, 5497 }, // ĝ
+    { 16, 25, 17, 1, 24, 100, 5595 }, // Ğ
+    { 15, 26, 15, 0, 20, 98, 5695 }, // ğ
+    { 16, 25, 17, 1, 24, 100, 5793 }, // Ġ
+    { 15, 26, 15, 0, 20, 98, 5893 }, // ġ
+    { 16, 25, 17, 1, 19, 100, 5991 }, // Ģ
+    { 15, 26, 15, 0, 20, 98, 6091 }, // ģ
+    { 18, 24, 18, 0, 24, 108, 6189 }, // Ĥ
+    { 14, 25, 15, 0, 25, 88, 6297 }, // ĥ
+    { 20, 18, 18, 0, 18, 90, 6385 }, // Ħ
+    { 14, 19, 15, 0, 19, 67, 6475 }, // ħ
+    { 14, 23, 10, -1, 23, 81, 6542 }, // Ĩ
+    { 12, 19, 7, 0, 19, 57, 6623 }, // ĩ
+    { 13, 22, 10, -1, 22, 72, 6680 }, // Ī
+    { 10, 18, 7, 0, 18, 45, 6752 }, // ī
+    { 14, 24, 10, -1, 24, 84, 6797 }, // Ĭ
+    { 11, 20, 7, 0, 20, 55, 6881 }, // ĭ
+    { 12, 25, 10, -1, 18, 75, 6936 }, // Į
+    { 10, 27, 7, -1, 20, 68, 7011 }, // į
+    { 12, 24, 10, -1, 24, 72, 7079 }, // İ
+    { 8, 14, 7, 0, 14, 28, 7151 }, // ı
+    { 20, 24, 18, -1, 18, 120, 7179 }, // Ĳ
+    { 16, 26, 15, 0, 20, 104, 7299 }, // ĳ
+    { 16, 30, 8, -4, 24, 120, 7403 }, // Ĵ
+    { 15, 26, 7, -4, 20, 98, 7523 }, // ĵ
+    { 18, 24, 15, 0, 18, 108, 7621 }, // Ķ
+    { 16, 25, 14, 0, 19, 100, 7729 }, // ķ
+    { 16, 14, 14, 0, 14, 56, 7829 }, // ĸ
+    { 13, 24, 13, 0, 24, 78, 7885 }, // Ĺ
+    { 12, 25, 7, 0, 25, 75, 7963 }, // ĺ
+    { 12, 24, 13, 0, 18, 72, 8038 }, // Ļ
+    { 10, 25, 7, -1, 19, 63, 8110 }, // ļ
+    { 15, 18, 13, 0, 18, 68, 8173 }, // Ľ
+    { 14, 19, 9, 0, 19, 67, 8241 }, // ľ
+    { 13, 18, 13, 0, 18, 59, 8308 }, // Ŀ
+    { 12, 19, 11, 0, 19, 57, 8367 }, // ŀ
+    { 13, 18, 13, -1, 18, 59, 8424 }, // Ł
+    { 9, 19, 8, 0, 19, 43, 8483 }, // ł
+    { 20, 24, 19, 0, 24, 120, 8526 }, // Ń
+    { 15, 20, 15, 0, 20, 75, 8646 }, // ń
+    { 20, 24, 19, 0, 18, 120, 8721 }, // Ņ
+    { 14, 20, 15, 0, 14, 70, 8841 }, // ņ
+    { 20, 24, 19, 0, 24, 120, 8911 }, // Ň
+    { 16, 20, 15, 0, 20, 80, 9031 }, // ň
+    { 17, 18, 18, 0, 18, 77, 9111 }, // ŉ
+    { 19, 24, 19, 0, 18, 114, 9188 }, // Ŋ
+    { 14, 20, 15, 0, 14, 70, 9302 }, // ŋ
+    { 17, 23, 18, 1, 22, 98, 9372 }, // Ō
+    { 13, 19, 15, 1, 18, 62, 9470 }, // ō
+    { 17, 25, 18, 1, 24, 107, 9532 }, // Ŏ
+    { 13, 21, 15, 1, 20, 69, 9639 }, // ŏ
+    { 19, 25, 18, 1, 24, 119, 9708 }, // Ő
+    { 16, 21, 15, 1, 20, 84, 9827 }, // ő
+    { 23, 20, 23, 1, 19, 115, 9422 }, // Œ
+    { 21, 15, 22, 1, 14, 79, 9537 }, // œ
+    { 16, 24, 16, 0, 24, 96, 9911 }, // Ŕ
+    { 13, 20, 11, 0, 20, 65, 10007 }, // ŕ
+    { 15, 24, 16, 0, 18, 90, 10072 }, // Ŗ
+    { 13, 20, 11, -1, 14, 65, 10162 }, // ŗ
+    { 17, 24, 16, 0, 24, 102, 10227 }, // Ř
+    { 14, 20, 11, 0, 20, 70, 10329 }, // ř
+    { 14, 25, 13, 0, 24, 88, 10399 }, // Ś
+    { 13, 21, 12, 0, 20, 69, 10487 }, // ś
+    { 14, 25, 13, 0, 24, 88, 10556 }, // Ŝ
+    { 13, 21, 12, 0, 20, 69, 10644 }, // ŝ
+    { 14, 25, 13, 0, 19, 88, 10713 }, // Ş
+    { 12, 20, 12, 0, 14, 60, 10801 }, // ş
+    { 15, 25, 13, 0, 24, 94, 10861 }, // Š
+    { 13, 21, 12, 0, 20, 69, 10955 }, // š
+    { 15, 24, 13, 1, 18, 90, 11024 }, // Ţ
+    { 10, 23, 10, 1, 17, 58, 11114 }, // ţ
+    { 14, 24, 13, 2, 24, 84, 11172 }, // Ť
+    { 13, 20, 10, 1, 19, 65, 11256 }, // ť
+    { 15, 18, 13, 1, 18, 68, 11321 }, // Ŧ
+    { 11, 18, 10, 0, 17, 50, 11389 }, // ŧ
+    { 17, 24, 17, 1, 23, 102, 11439 }, // Ũ
+    { 14, 20, 15, 1, 19, 70, 11541 }, // ũ
+    { 17, 23, 17, 1, 22, 98, 11611 }, // Ū
+    { 14, 19, 15, 1, 18, 67, 11709 }, // ū
+    { 17, 25, 17, 1, 24, 107, 11776 }, // Ŭ
+    { 14, 21, 15, 1, 20, 74, 11883 }, // ŭ
+    { 17, 26, 17, 1, 25, 111, 11957 }, // Ů
+    { 14, 22, 15, 1, 21, 77, 12068 }, // ů
+    { 18, 25, 17, 1, 24, 113, 12145 }, // Ű
+    { 16, 21, 15, 1, 20, 84, 12258 }, // ű
+    { 17, 25, 17, 1, 18, 107, 12342 }, // Ų
+    { 14, 21, 15, 1, 14, 74, 12449 }, // ų
+    { 23, 24, 22, 2, 24, 138, 12523 }, // Ŵ
+    { 20, 20, 20, 1, 20, 100, 12661 }, // ŵ
+    { 15, 24, 14, 2, 24, 90, 12761 }, // Ŷ
+    { 17, 26, 13, -2, 20, 111, 12851 }, // ŷ
+    { 15, 23, 14, 2, 23, 87, 12962 }, // Ÿ
+    { 16, 24, 13, -1, 24, 96, 13049 }, // Ź
+    { 14, 20, 12, -1, 20, 70, 13145 }, // ź
+    { 16, 24, 13, -1, 24, 96, 13215 }, // Ż
+    { 13, 20, 12, -1, 20, 65, 13311 }, // ż
+    { 17, 24, 13, -1, 24, 102, 13376 }, // Ž
+    { 15, 20, 12, -1, 20, 75, 13478 }, // ž
+    { 15, 26, 9, -3, 20, 98, 13553 }, // ſ
+    { 6, 5, 0, -11, 20, 8, 13651 }, // ̀
+    { 8, 5, 0, -6, 20, 10, 13659 }, // ́
+    { 11, 5, 0, -4, 20, 14, 13669 }, // ̂
+    { 11, 4, 0, -11, 19, 11, 13683 }, // ̃
+    { 9, 3, 0, -3, 18, 7, 13694 }, // ̄
+    { 11, 4, 0, -3, 22, 11, 13701 }, // ̅
+    { 10, 5, 0, -3, 20, 13, 13712 }, // ̆
+    { 5, 5, 0, 0, 20, 7, 13725 }, // ̇
+    { 9, 4, 0, -2, 19, 9, 13732 }, // ̈
+    { 6, 7, 0, -8, 21, 11, 13741 }, // ̉
+    { 7, 6, 0, -1, 21, 11, 13752 }, // ̊
+    { 12, 5, 0, -3, 20, 15, 13763 }, // ̋
+    { 11, 5, 0, -3, 20, 14, 13778 }, // ̌
+    { 5, 8, 0, 0, 20, 10, 13792 }, // ̍
+    { 9, 6, 0, -2, 20, 14, 13802 }, // ̎
+    { 11, 5, 0, -12, 20, 14, 13816 }, // ̏
+    { 9, 7, 0, -2, 22, 16, 13830 }, // ̐
+    { 10, 5, 0, -3, 20, 13, 13846 }, // ̑
+    { 7, 7, 0, -2, 18, 13, 13859 }, // ̒
+    { 7, 7, 0, -2, 18, 13, 13872 }, // ̓
+    { 4, 7, 0, 0, 18, 7, 13885 }, // ̔
+    { 7, 7, 0, -2, 18, 13, 13892 }, // ̕
+    { 6, 5, 0, -5, 0, 8, 13905 }, // ̖
+    { 8, 5, 0, -6, 0, 10, 13913 }, // ̗
+    { 6, 6, 0, -5, 0, 9, 13923 }, // ̘
+    { 6, 6, 0, -5, 0, 9, 13932 }, // ̙
+    { 8, 7, 8, 2, 19, 14, 13941 }, // ̚
+    { 8, 7, 0, -2, 20, 14, 13955 }, // ̛
+    { 5, 7, 0, -2, 0, 9, 13969 }, // ̜
+    { 7, 5, 0, -6, -1, 9, 13978 }, // ̝
+    { 6, 5, 0, -5, -1, 8, 13987 }, // ̞
+    { 6, 6, 0, -5, 0, 9, 13995 }, // ̟
+    { 7, 3, 0, -6, -2, 6, 14004 }, // ̠
+    { 8, 8, 0, -6, 2, 16, 14010 }, // ̡
+    { 6, 8, 0, -3, 2, 12, 14026 }, // ̢
+    { 5, 5, 0, -12, -1, 7, 14038 }, // ̣
+    { 9, 4, 0, -7, -1, 9, 14045 }, // ̤
+    { 7, 6, 0, -6, 0, 11, 14054 }, // ̥
+    { 6, 5, 0, 1, -1, 8, 14065 }, // ̦
+    { 7, 6, 0, -5, 0, 11, 14073 }, // ̧
+    { 6, 7, 0, -5, 0, 11, 14084 }, // ̨
+    { 5, 8, 0, -4, 0, 10, 14095 }, // ̩
+    { 10, 5, 0, -7, -1, 13, 14105 }, // ̪
+    { 10, 4, 0, -7, -1, 10, 14118 }, // ̫
+    { 11, 5, 0, -7, 0, 14, 14128 }, // ̬
+    { 11, 5, 0, -8, 0, 14, 14142 }, // ̭
+    { 10, 5, 0, -7, 0, 13, 14156 }, // ̮
+    { 10, 5, 0, -7, -1, 13, 14169 }, // ̯
+    { 12, 4, 0, -8, -1, 12, 14182 }, // ̰
+    { 9, 3, 0, -7, -2, 7, 14194 }, // ̱
+    { 12, 2, 0, -8, -2, 6, 14201 }, // ̲
+    { 13, 6, 0, -9, 0, 20, 14207 }, // ̳
+    { 12, 4, 0, -6, 9, 12, 14227 }, // ̴
+    { 11, 4, 0, -6, 9, 11, 14239 }, // ̵
+    { 20, 4, 0, -10, 9, 20, 14250 }, // ̶
+    { 10, 8, 0, -5, 11, 20, 14270 }, // ̷
+    { 16, 21, 0, -8, 19, 84, 14290 }, // ̸
+    { 4, 7, 0, -2, 0, 7, 14374 }, // ̹
+    { 10, 5, 0, -7, -1, 13, 14381 }, // ̺
+    { 10, 6, 0, -7, 0, 15, 14394 }, // ̻
+    { 10, 4, 0, -7, -1, 10, 14409 }, // ̼
+    { 7, 6, 0, -1, 20, 11, 14419 }, // ̽
+    { 6, 8, 0, -1, 22, 12, 14430 }, // ̾
+    { 12, 6, 0, -3, 25, 18, 14442 }, // ̿
+    { 6, 5, 0, -2, 20, 8, 14460 }, // ̀
+    { 7, 5, 0, 0, 20, 9, 14468 }, // ́
+    { 12, 4, 0, 3, 19, 12, 14477 }, // ͂
+    { 5, 6, 0, 0, 20, 8, 14489 }, // ̓
+    { 14, 5, 0, -4, 20, 18, 14497 }, // ̈́
+    { 6, 5, 0, -4, -1, 8, 14515 }, // ͅ
+    { 12, 6, 0, -4, 20, 18, 14523 }, // ͆
+    { 12, 6, 0, -8, 0, 18, 14541 }, // ͇
+    { 8, 6, 0, -6, 0, 12, 14559 }, // ͈
+    { 6, 5, 0, -5, -1, 8, 14571 }, // ͉
+    { 10, 6, 0, -3, 20, 15, 14579 }, // ͊
+    { 11, 10, 0, -3, 24, 28, 14594 }, // ͋
+    { 11, 7, 0, -3, 22, 20, 14622 }, // ͌
+    { 10, 6, 0, -7, 0, 15, 14642 }, // ͍
+    { 5, 6, 0, -4, 0, 8, 14657 }, // ͎
+    { 18, 18, 0, -9, 18, 81, 14665 }, // ͏
+    { 5, 6, 0, 0, 20, 8, 14746 }, // ͐
+    { 4, 7, 0, 3, 22, 7, 14754 }, // ͑
+    { 10, 7, 0, -3, 22, 18, 14761 }, // ͒
+    { 5, 6, 0, -4, 0, 8, 14779 }, // ͓
+    { 5, 5, 0, -4, -1, 7, 14787 }, // ͔
+    { 5, 5, 0, -4, -1, 7, 14794 }, // ͕
+    { 10, 5, 0, -6, -1, 13, 14801 }, // ͖
+    { 5, 7, 0, 2, 21, 9, 14814 }, // ͗
+    { 5, 5, 0, 0, 20, 7, 14823 }, // ͘
+    { 6, 6, 0, -5, 0, 9, 14830 }, // ͙
+    { 10, 6, 0, -7, 0, 15, 14839 }, // ͚
+    { 5, 6, 0, 0, 20, 8, 14854 }, // ͛
+    { 20, 5, 0, -11, -1, 25, 14862 }, // ͜
+    { 20, 5, 0, -8, 19, 25, 14887 }, // ͝
+    { 14, 3, 0, -5, 18, 11, 14912 }, // ͞
+    { 14, 3, 0, -9, -1, 11, 14923 }, // ͟
+    { 21, 4, 0, -8, 19, 21, 14934 }, // ͠
+    { 20, 6, 0, -7, 22, 30, 14955 }, // ͡
+    { 21, 6, 0, -13, 0, 32, 14985 }, // ͢
+    { 7, 7, 0, -1, 22, 13, 15017 }, // ͣ
+    { 7, 7, 0, -1, 22, 13, 15030 }, // ͤ
+    { 5, 9, 0, 0, 24, 12, 15043 }, // ͥ
+    { 7, 7, 0, -1, 22, 13, 15055 }, // ͦ
+    { 7, 6, 0, -1, 21, 11, 15068 }, // ͧ
+    { 6, 7, 0, 0, 22, 11, 15079 }, // ͨ
+    { 8, 9, 0, -1, 24, 18, 15090 }, // ͩ
+    { 7, 9, 0, -1, 24, 16, 15108 }, // ͪ
+    { 10, 7, 0, -3, 22, 18, 15124 }, // ͫ
+    { 6, 7, 0, 0, 22, 11, 15142 }, // ͬ
+    { 5, 8, 0, 0, 23, 10, 15153 }, // ͭ
+    { 6, 6, 0, 0, 21, 9, 15163 }, // ͮ
+    { 8, 6, 0, -2, 21, 12, 15172 }, // ͯ
+    { 15, 24, 13, 0, 24, 90, 15184 }, // Ѐ
+    { 15, 24, 13, 0, 24, 90, 0 }, // Ё
+    { 15, 19, 18, 2, 18, 72, 15274 }, // Ђ
+    { 15, 24, 13, 0, 24, 90, 15346 }, // Ѓ
+    { 16, 20, 15, 1, 19, 80, 15436 }, // Є
+    { 14, 20, 13, 0, 19, 70, 15516 }, // Ѕ
+    { 9, 18, 8, 0, 18, 41, 15586 }, // І
+    { 11, 24, 8, 0, 24, 66, 15627 }, // Ї
+    { 14, 24, 8, -5, 18, 84, 15693 }, // Ј
+    { 25, 19, 24, -1, 18, 119, 15777 }, // Љ
+    { 23, 18, 23, 0, 18, 104, 15896 }, // Њ
+    { 15, 18, 18, 2, 18, 68, 16000 }, // Ћ
+    { 18, 24, 16, 0, 24, 108, 16068 }, // Ќ
+    { 18, 24, 17, 0, 24, 108, 16176 }, // Ѝ
+    { 18, 25, 15, 0, 24, 113, 16284 }, // Ў
+    { 18, 22, 17, 0, 18, 99, 16397 }, // Џ
+    { 17, 18, 16, -2, 18, 77, 90 }, // А
+    { 15, 18, 15, 0, 18, 68, 167 }, // Б
+    { 16, 18, 15, 0, 18, 72, 235 }, // В
+    { 15, 18, 13, 0, 18, 68, 307 }, // Г
+    { 21, 22, 18, -3, 18, 116, 375 }, // Д
+    { 15, 18, 13, 0, 18, 68, 491 }, // Е
+    { 27, 18, 23, -2, 18, 122, 559 }, // Ж
+    { 15, 20, 14, 0, 19, 75, 681 }, // З
+    { 18, 18, 17, 0, 18, 81, 756 }, // И
+    { 18, 24, 17, 0, 24, 108, 837 }, // Й
+    { 18, 18, 16, 0, 18, 81, 945 }, // К
+    { 19, 19, 17, -1, 18, 91, 1026 }, // Л
+    { 23, 18, 22, 0, 18, 104, 1117 }, // М
+    { 18, 18, 17, 0, 18, 81, 1221 }, // Н
+    { 17, 20, 18, 1, 19, 85, 1302 }, // О
+    { 18, 18, 17, 0, 18, 81, 1387 }, // П
+    { 16, 18, 15, 0, 18, 72, 1468 }, // Р
+    { 16, 20, 15, 1, 19, 80, 1540 }, // С
+    { 14, 18, 13, 2, 18, 63, 1620 }, // Т
+    { 18, 19, 15, 0, 18, 86, 1683 }, // У
+    { 21, 20, 22, 1, 19, 105, 1769 }, // Ф
+    { 20, 18, 15, -2, 18, 90, 1874 }, // Х
+    { 18, 22, 17, 0, 18, 99, 1964 }, // Ц
+    { 15, 18, 17, 2, 18, 68, 2063 }, // Ч
+    { 25, 18, 25, 0, 18, 113, 2131 }, // Ш
+    { 25, 22, 25, 0, 18, 138, 2244 }, // Щ
+    { 15, 18, 17, 2, 18, 68, 2382 }, // Ъ
+    { 23, 18, 22, 0, 18, 104, 2450 }, // Ы
+    { 15, 18, 15, 0, 18, 68, 2554 }, // Ь
+    { 16, 20, 15, 0, 19, 80, 2622 }, // Э
+    { 25, 20, 25, 0, 19, 125, 2702 }, // Ю
+    { 18, 18, 15, -2, 18, 81, 2827 }, // Я
+    { 15, 15, 15, 0, 14, 57, 2908 }, // а
+    { 14, 21, 14, 1, 20, 74, 2965 }, // б
+    { 14, 15, 14, 0, 14, 53, 3039 }, // в
+    { 13, 15, 12, -1, 14, 49, 3092 }, // г
+    { 14, 21, 14, 0, 20, 74, 3141 }, // д
+    { 13, 15, 13, 0, 14, 49, 3215 }, // е
+    { 26, 15, 24, -1, 14, 98, 3264 }, // ж
+    { 12, 15, 12, 0, 14, 45, 3362 }, // з
+    { 14, 15, 15, 1, 14, 53, 3407 }, // и
+    { 14, 21, 15, 1, 20, 74, 3460 }, // й
+    { 16, 14, 14, 0, 14, 56, 3534 }, // к
+    { 16, 15, 15, -1, 14, 60, 3590 }, // л
+    { 19, 14, 19, 0, 14, 67, 3650 }, // м
+    { 15, 14, 15, 0, 14, 53, 3717 }, // н
+    { 14, 15, 14, 0, 14, 53, 3770 }, // о
+    { 14, 14, 15, 0, 14, 49, 3823 }, // п
+    { 16, 20, 15, -1, 14, 80, 3872 }, // р
+    { 12, 15, 12, 0, 14, 45, 3952 }, // с
+    { 22, 14, 22, 0, 14, 77, 3997 }, // т
+    { 17, 20, 13, -2, 14, 85, 4074 }, // у
+    { 18, 25, 19, 0, 19, 113, 4159 }, // ф
+    { 17, 14, 13, -2, 14, 60, 4272 }, // х
+    { 14, 18, 15, 1, 14, 63, 4332 }, // ц
+    { 14, 14, 14, 1, 14, 49, 4395 }, // ч
+    { 22, 15, 22, 1, 14, 83, 4444 }, // ш
+    { 22, 18, 23, 1, 14, 99, 4527 }, // щ
+    { 15, 15, 16, 0, 14, 57, 4626 }, // ъ
+    { 20, 15, 20, 0, 14, 75, 4683 }, // ы
+    { 13, 15, 14, 0, 14, 49, 4758 }, // ь
+    { 12, 15, 12, 0, 14, 45, 4807 }, // э
+    { 20, 15, 20, 0, 14, 75, 4852 }, // ю
+    { 16, 14, 14, -2, 14, 56, 4927 }, // я
+    { 13, 21, 13, 0, 20, 69, 16496 }, // ѐ
+    { 13, 20, 13, 0, 19, 65, 4983 }, // ё
+    { 14, 25, 15, 0, 19, 88, 16565 }, // ђ
+    { 14, 21, 12, -1, 20, 74, 16653 }, // ѓ
+    { 12, 15, 12, 0, 14, 45, 16727 }, // є
+    { 12, 15, 11, 0, 14, 45, 16772 }, // ѕ
+    { 9, 20, 7, 0, 20, 45, 16817 }, // і
+    { 10, 19, 7, 0, 19, 48, 16862 }, // ї
+    { 13, 26, 7, -4, 20, 85, 16910 }, // ј
+    { 22, 15, 21, -1, 14, 83, 16995 }, // љ
+    { 21, 15, 21, 0, 14, 79, 17078 }, // њ
+    { 14, 19, 15, 0, 19, 67, 17157 }, // ћ
+    { 16, 20, 14, 0, 20, 80, 17224 }, // ќ
+    { 14, 21, 15, 1, 20, 74, 17304 }, // ѝ
+    { 17, 26, 13, -2, 20, 111, 17378 }, // ў
+    { 14, 19, 15, 1, 14, 67, 17489 }, // џ
+    { 23, 18, 22, 2, 18, 104, 17556 }, // Ѡ
+    { 21, 14, 20, 1, 14, 74, 17660 }, // ѡ
+    { 14, 18, 16, 1, 18, 63, 17734 }, // Ѣ
+    { 20, 15, 21, 0, 14, 75, 17797 }, // ѣ
+    { 24, 20, 22, 0, 19, 120, 17872 }, // Ѥ
+    { 19, 15, 19, 0, 14, 72, 17992 }, // ѥ
+    { 18, 18, 17, -2, 18, 81, 18064 }, // Ѧ
+    { 16, 14, 15, -2, 14, 56, 18145 }, // ѧ
+    { 22, 18, 23, 0, 18, 99, 18201 }, // Ѩ
+    { 20, 14, 21, 0, 14, 70, 18300 }, // ѩ
+    { 21, 18, 18, -2, 18, 95, 18370 }, // Ѫ
+    { 17, 14, 14, -2, 14, 60, 18465 }, // ѫ
+    { 26, 18, 25, 0, 18, 117, 18525 }, // Ѭ
+    { 22, 14, 21, 0, 14, 77, 18642 }, // ѭ
+    { 16, 28, 15, -1, 22, 112, 18719 }, // Ѯ
+    { 15, 23, 13, -2, 17, 87, 18831 }, // ѯ
+    { 21, 18, 21, 2, 18, 95, 18918 }, // Ѱ
+    { 19, 25, 20, 1, 19, 119, 19013 }, // ѱ
+    { 17, 20, 18, 1, 19, 85, 19132 }, // Ѳ
+    { 13, 15, 15, 1, 14, 49, 19217 }, // ѳ
+    { 16, 18, 16, 2, 18, 72, 19266 }, // Ѵ
+    { 14, 14, 14, 1, 14, 49, 19338 }, // ѵ
+    { 16, 24, 16, 2, 24, 96, 19387 }, // Ѷ
+    { 14, 20, 14, 1, 20, 70, 19483 }, // ѷ
+    { 32, 25, 31, 1, 19, 200, 19553 }, // Ѹ
+    { 28, 20, 28, 1, 14, 140, 19753 }, // ѹ
+    { 18, 22, 19, 1, 20, 99, 19893 }, // Ѻ
+    { 14, 17, 16, 1, 15, 60, 19992 }, // ѻ
+    { 24, 27, 25, 1, 26, 162, 20052 }, // Ѽ
+    { 20, 23, 22, 1, 22, 115, 20214 }, // ѽ
+    { 23, 23, 22, 2, 23, 133, 20329 }, // Ѿ
+    { 21, 19, 20, 1, 19, 100, 20462 }, // ѿ
+    { 16, 25, 15, 1, 19, 100, 20562 }, // Ҁ
+    { 12, 20, 12, 1, 14, 60, 20662 }, // ҁ
+    { 13, 17, 15, 1, 16, 56, 20722 }, // ҂
+    { 10, 5, 0, -10, 19, 13, 20778 }, // ҃
+    { 10, 4, 0, -10, 19, 10, 20791 }, // ҄
+    { 5, 6, 0, -7, 20, 8, 20801 }, // ҅
+    { 5, 6, 0, -7, 20, 8, 20809 }, // ҆
+    { 11, 4, 0, -3, 23, 11, 20817 }, // ҇
+    { 30, 27, 0, -15, 20, 203, 20828 }, // ҈
+    { 28, 28, 0, -14, 21, 196, 21031 }, // ҉
+    { 20, 30, 21, 0, 24, 150, 21227 }, // Ҋ
+    { 15, 25, 16, 1, 20, 94, 21377 }, // ҋ
+    { 14, 18, 15, 0, 18, 63, 0 }, // Ҍ
+    { 12, 20, 14, 1, 19, 60, 63 }, // ҍ
+    { 16, 18, 15, 0, 18, 72, 123 }, // Ҏ
+    { 15, 20, 15, -1, 14, 75, 195 }, // ҏ
+    { 16, 22, 13, 0, 22, 88, 270 }, // Ґ
+    { 14, 18, 12, 0, 18, 63, 358 }, // ґ
+    { 15, 18, 13, 0, 18, 68, 421 }, // Ғ
+    { 14, 14, 12, -1, 14, 49, 489 }, // ғ
+    { 15, 25, 17, 0, 18, 94, 538 }, // Ҕ
+    { 13, 21, 14, 0, 14, 69, 632 }, // ҕ
+    { 26, 24, 23, -2, 18, 156, 701 }, // Җ
+    { 26, 19, 24, -1, 14, 124, 857 }, // җ
+    { 15, 26, 14, 0, 19, 98, 981 }, // Ҙ
+    { 12, 21, 12, 0, 14, 63, 1079 }, // ҙ
+    { 18, 24, 17, 0, 18, 108, 1142 }, // Қ
+    { 16, 19, 15, 0, 14, 76, 1250 }, // қ
+    { 18, 18, 16, 0, 18, 81, 1326 }, // Ҝ
+    { 15, 14, 15, 1, 14, 53, 1407 }, // ҝ
+    { 18, 18, 15, 0, 18, 81, 1460 }, // Ҟ
+    { 16, 19, 14, 0, 19, 76, 1541 }, // ҟ
+    { 18, 18, 18, 2, 18, 81, 1617 }, // Ҡ
+    { 18, 14, 16, 0, 14, 63, 1698 }, // ҡ
+    { 18, 24, 19, 0, 18, 108, 1761 }, // Ң
+    { 16, 19, 17, 0, 14, 76, 1869 }, // ң
+    { 22, 18, 19, 0, 18, 99, 1945 }, // Ҥ
+    { 20, 14, 18, 0, 14, 70, 2044 }, // ҥ
+    { 24, 25, 26, 0, 18, 150, 2114 }, // Ҧ
+    { 20, 21, 22, 0, 14, 105, 2264 }, // ҧ
+    { 17, 21, 18, 1, 19, 90, 2369 }, // Ҩ
+    { 14, 15, 15, 1, 14, 53, 2459 }, // ҩ
+    { 16, 26, 15, 1, 19, 104, 2512 }, // Ҫ
+    { 12, 21, 12, 1, 14, 63, 2616 }, // ҫ
+    { 14, 24, 13, 2, 18, 84, 2679 }, // Ҭ
+    { 23, 19, 23, 0, 14, 110, 2763 }, // ҭ
+    { 15, 18, 14, 2, 18, 68, 2873 }, // Ү
+    { 14, 20, 13, 1, 14, 70, 2941 }, // ү
+    { 17, 18, 14, 0, 18, 77, 3011 }, // Ұ
+    { 16, 20, 13, -1, 14, 80, 3088 }, // ұ
+    { 20, 24, 17, -2, 18, 120, 3168 }, // Ҳ
+    { 16, 19, 15, -1, 14, 76, 3288 }, // ҳ
+    { 19, 24, 21, 2, 18, 114, 3364 }, // Ҵ
+    { 16, 19, 17, 1, 14, 76, 3478 }, // ҵ
+    { 16, 24, 19, 2, 18, 96, 3554 }, // Ҷ
+    { 13, 19, 16, 2, 14, 62, 3650 }, // ҷ
+    { 15, 18, 17, 2, 18, 68, 3712 }, // Ҹ
+    { 13, 14, 15, 2, 14, 46, 3780 }, // ҹ
+    { 16, 18, 17, 0, 18, 72, 3826 }, // Һ
+    { 14, 19, 15, 0, 19, 67, 3898 }, // һ
+    { 20, 20, 19, 0, 19, 100, 3965 }, // Ҽ
+    { 16, 15, 17, 0, 14, 60, 4065 }, // ҽ
+    { 20, 25, 19, 0, 19, 125, 4125 }, // Ҿ
+    { 16, 19, 17, 0, 14, 76, 4250 }, // ҿ
+    { 12, 18, 10, -1, 18, 54, 4326 }, // Ӏ
+    { 27, 24, 23, -2, 24, 162, 4380 }, // Ӂ
+    { 26, 21, 24, -1, 20, 137, 4542 }, // ӂ
+    { 18, 25, 17, 0, 18, 113, 4679 }, // Ӄ
+    { 16, 21, 15, 0, 14, 84, 4792 }, // ӄ
+    { 20, 24, 19, -1, 18, 120, 4876 }, // Ӆ
+    { 17, 19, 16, -1, 14, 81, 4996 }, // ӆ
+    { 18, 25, 18, 0, 18, 113, 5077 }, // Ӈ
+    { 15, 21, 15, 0, 14, 79, 5190 }, // ӈ
+    { 19, 24, 19, 0, 18, 114, 5269 }, // Ӊ
+    { 16, 19, 17, 0, 14, 76, 5383 }, // ӊ
+    { 15, 24, 17, 2, 18, 90, 5459 }, // Ӌ
+    { 13, 19, 15, 2, 14, 62, 5549 }, // ӌ
+    { 23, 24, 24, 0, 18, 138, 5611 }, // Ӎ
+    { 21, 19, 21, 0, 14, 100, 5749 }, // ӎ
+    { 12, 18, 10, -1, 18, 54, 5849 }, // ӏ
+    { 18, 24, 16, -2, 24, 108, 5903 }, // Ӑ
+    { 14, 21, 15, 1, 20, 74, 6011 }, // ӑ
+    { 17, 23, 16, -2, 23, 98, 6085 }, // Ӓ
+    { 14, 20, 15, 1, 19, 70, 6183 }, // ӓ
+    { 26, 18, 22, -2, 18, 117, 6253 }, // Ӕ
+    { 21, 15, 22, 1, 14, 79, 6370 }, // ӕ
+    { 16, 24, 14, 0, 24, 96, 6449 }, // Ӗ
+    { 14, 21, 14, 1, 20, 74, 6545 }, // ӗ
+    { 16, 20, 17, 0, 19, 80, 6619 }, // Ә
+    { 13, 15, 14, 0, 14, 49, 6699 }, // ә
+    { 16, 24, 17, 0, 23, 96, 6748 }, // Ӛ
+    { 13, 20, 14, 0, 19, 65, 6844 }, // ӛ
+    { 27, 23, 23, -2, 23, 156, 6909 }, // Ӝ
+    { 26, 20, 24, -1, 19, 130, 7065 }, // ӝ
+    { 15, 24, 14, 0, 23, 90, 7195 }, // Ӟ
+    { 13, 20, 12, 0, 19, 65, 7285 }, // ӟ
+    { 16, 19, 14, -1, 18, 76, 7350 }, // Ӡ
+    { 16, 21, 14, -2, 14, 84, 7426 }, // ӡ
+    { 18, 22, 17, 0, 22, 99, 7510 }, // Ӣ
+    { 14, 19, 15, 1, 18, 67, 7609 }, // ӣ
+    { 18, 23, 17, 0, 23, 104, 7676 }, // Ӥ
+    { 14, 20, 15, 1, 19, 70, 7780 }, // ӥ
+    { 17, 24, 18, 1, 23, 102, 7850 }, // Ӧ
+    { 13, 20, 15, 1, 19, 65, 7952 }, // ӧ
+    { 17, 20, 18, 1, 19, 85, 8017 }, // Ө
+    { 13, 15, 15, 1, 14, 49, 8102 }, // ө
+    { 17, 24, 18, 1, 23, 102, 8151 }, // Ӫ
+    { 13, 20, 15, 1, 19, 65, 8253 }, // ӫ
+    { 16, 24, 15, 0, 23, 96, 8318 }, // Ӭ
+    { 12, 20, 12, 0, 19, 60, 8414 }, // ӭ
+    { 18, 23, 15, 0, 22, 104, 8474 }, // Ӯ
+    { 17, 24, 13, -2, 18, 102, 8578 }, // ӯ
+    { 18, 24, 15, 0, 23, 108, 8680 }, // Ӱ
+    { 17, 25, 13, -2, 19, 107, 8788 }, // ӱ
+    { 18, 25, 15, 0, 24, 113, 8895 }, // Ӳ
+    { 18, 26, 13, -2, 20, 117, 9008 }, // ӳ
+    { 15, 23, 17, 2, 23, 87, 9125 }, // Ӵ
+    { 14, 19, 14, 1, 19, 67, 9212 }, // ӵ
+    { 15, 24, 13, 0, 18, 90, 9279 }, // Ӷ
+    { 13, 19, 12, 0, 14, 62, 9369 }, // ӷ
+    { 23, 23, 22, 0, 23, 133, 9431 }, // Ӹ
+    { 20, 20, 20, 0, 19, 100, 9564 }, // ӹ
+    { 15, 25, 13, 0, 18, 94, 9664 }, // Ӻ
+    { 14, 21, 12, -1, 14, 74, 9758 }, // ӻ
+    { 20, 25, 17, -2, 18, 125, 9832 }, // Ӽ
+    { 17, 21, 15, -2, 14, 90, 9957 }, // ӽ
+    { 20, 18, 15, -2, 18, 90, 10047 }, // Ӿ
+    { 17, 14, 13, -2, 14, 60, 10137 }, // ӿ
+    { 0, 0, 13, 0, 0, 0, 10197 }, //  
+    { 0, 0, 25, 0, 0, 0, 10197 }, //  
+    { 0, 0, 13, 0, 0, 0, 10197 }, //  
+    { 0, 0, 25, 0, 0, 0, 10197 }, //  
+    { 0, 0, 8, 0, 0, 0, 10197 }, //  
+    { 0, 0, 6, 0, 0, 0, 10197 }, //  
+    { 0, 0, 4, 0, 0, 0, 10197 }, //  
+    { 0, 0, 14, 0, 0, 0, 10197 }, //  
+    { 0, 0, 7, 0, 0, 0, 10197 }, //  
+    { 0, 0, 4, 0, 0, 0, 10197 }, //  
+    { 0, 0, 3, 0, 0, 0, 10197 }, //  
+    { 0, 0, 0, 0, 0, 0, 10197 }, // ​
+    { 0, 0, 0, 0, 0, 0, 10197 }, // ‌
+    { 0, 0, 0, 0, 0, 0, 10197 }, // ‍
+    { 7, 22, 0, -1, 18, 39, 10197 }, // ‎
+    { 7, 22, 0, -6, 18, 39, 10236 }, // ‏
+    { 8, 4, 8, 0, 9, 8, 10275 }, // ‐
+    { 8, 4, 8, 0, 9, 8, 10283 }, // ‑
+    { 14, 4, 14, 0, 11, 14, 10291 }, // ‒
+    { 12, 4, 12, 0, 9, 12, 9616 }, // –
+    { 24, 4, 24, 0, 9, 24, 9628 }, // —
+    { 24, 4, 24, 0, 9, 24, 10305 }, // ―
+    { 10, 25, 14, 2, 19, 63, 10329 }, // ‖
+    { 12, 6, 10, -3, 0, 18, 10392 }, // ‗
+    { 7, 7, 5, 1, 18, 13, 9652 }, // ‘
+    { 7, 7, 5, 1, 18, 13, 9665 }, // ’
+    { 7, 7, 7, -2, 3, 13, 10410 }, // ‚
+    { 5, 7, 5, 2, 18, 9, 10423 }, // ‛
+    { 12, 7, 11, 1, 18, 21, 9678 }, // “
+    { 12, 7, 11, 1, 18, 21, 9699 }, // ”
+    { 13, 7, 12, -2, 3, 23, 10432 }, // „
+    { 10, 7, 11, 2, 18, 18, 10455 }, // ‟
+    { 11, 19, 13, 2, 19, 53, 10473 }, // †
+    { 14, 19, 13, 0, 19, 67, 10526 }, // ‡
+    { 8, 8, 9, 1, 13, 16, 10593 }, // •
+    { 8, 10, 9, 1, 14, 20, 10609 }, // ‣
+    { 6, 5, 13, 2, 4, 8, 10629 }, // ․
+    { 12, 5, 14, 0, 4, 15, 10637 }, // ‥
+    { 19, 5, 21, 0, 4, 24, 9720 }, // …
+    { 6, 5, 8, 1, 9, 8, 10652 }, // ‧
+    { 0, 0, 15, 0, 0, 0, 10660 }, //  
+    { 0, 0, 15, 0, 0, 0, 10660 }, //  
+    { 7, 20, 0, -1, 16, 35, 10660 }, // ‪
+    { 7, 20, 0, -6, 16, 35, 10695 }, // ‫
+    { 6, 22, 0, -3, 18, 33, 10730 }, // ‬
+    { 6, 22, 0, -3, 18, 33, 10763 }, // ‭
+    { 6, 22, 0, -3, 18, 33, 10796 }, // ‮
+    { 0, 0, 4, 0, 0, 0, 10829 }, //  
+    { 29, 20, 30, 1, 19, 145, 10829 }, // ‰
+    { 38, 20, 40, 1, 19, 190, 10974 }, // ‱
+    { 8, 7, 7, 1, 18, 14, 11164 }, // ′
+    { 14, 7, 13, 1, 18, 25, 11178 }, // ″
+    { 20, 7, 19, 1, 18, 35, 11203 }, // ‴
+    { 7, 7, 7, 1, 18, 13, 11238 }, // ‵
+    { 13, 7, 13, 1, 18, 23, 11251 }, // ‶
+    { 19, 7, 19, 1, 18, 34, 11274 }, // ‷
+    { 9, 9, 9, -2, 3, 21, 11308 }, // ‸
+    { 9, 12, 8, 0, 13, 27, 11329 }, // ‹
+    { 8, 12, 8, 0, 13, 24, 11356 }, // ›
+    { 21, 20, 21, 0, 19, 105, 11380 }, // ※
+    { 15, 19, 14, 0, 18, 72, 11485 }, // ‼
+    { 11, 20, 12, 2, 19, 55, 11557 }, // ‽
+    { 12, 4, 11, 2, 22, 12, 11612 }, // ‾
+    { 14, 6, 13, -2, 0, 21, 11624 }, // ‿
+    { 13, 6, 13, 2, 20, 20, 11645 }, // ⁀
+    { 14, 17, 10, -3, 11, 60, 11665 }, // ⁁
+    { 29, 24, 29, -1, 20, 174, 11725 }, // ⁂
+    { 8, 4, 8, 0, 9, 8, 11899 }, // ⁃
+    { 17, 18, 3, -7, 18, 77, 11907 }, // ⁄
+    { 11, 22, 8, -1, 18, 61, 11984 }, // ⁅
+    { 11, 22, 8, -2, 18, 61, 12045 }, // ⁆
+    { 23, 20, 23, 1, 19, 115, 12106 }, // ⁇
+    { 19, 20, 19, 1, 19, 95, 12221 }, // ⁈
+    { 20, 20, 19, 0, 19, 100, 12316 }, // ⁉
+    { 13, 14, 13, 1, 14, 46, 12416 }, // ⁊
+    { 14, 23, 16, 2, 19, 81, 12462 }, // ⁋
+    { 14, 13, 16, 1, 14, 46, 12543 }, // ⁌
+    { 14, 13, 16, 1, 14, 46, 12589 }, // ⁍
+    { 13, 13, 14, -1, 8, 43, 12635 }, // ⁎
+    { 7, 18, 7, 0, 14, 32, 12678 }, // ⁏
+    { 17, 26, 13, -2, 20, 111, 12710 }, // ⁐
+    { 16, 26, 14, -1, 20, 104, 12821 }, // ⁑
+    { 11, 20, 11, 0, 19, 55, 12925 }, // ⁒
+    { 24, 6, 25, 1, 10, 36, 12980 }, // ⁓
+    { 14, 6, 13, -3, 0, 21, 13016 }, // ⁔
+    { 14, 14, 14, 0, 13, 49, 13037 }, // ⁕
+    { 12, 20, 14, 1, 19, 60, 13086 }, // ⁖
+    { 23, 7, 22, 1, 18, 41, 13146 }, // ⁗
+    { 19, 20, 21, 1, 19, 95, 13187 }, // ⁘
+    { 19, 20, 21, 1, 19, 95, 13282 }, // ⁙
+    { 5, 20, 7, 1, 19, 25, 13377 }, // ⁚
+    { 16, 21, 18, 1, 20, 84, 13402 }, // ⁛
+    { 20, 20, 21, 0, 19, 100, 13486 }, // ⁜
+    { 5, 20, 7, 1, 19, 25, 13586 }, // ⁝
+    { 5, 20, 7, 1, 19, 25, 13611 }, // ⁞
+    { 0, 0, 6, 0, 0, 0, 13636 }, //  
+    { 0, 0, 15, 0, 0, 0, 13636 }, // ⁠
+    { 0, 0, 15, 0, 0, 0, 13636 }, // ⁡
+    { 0, 0, 15, 0, 0, 0, 13636 }, // ⁢
+    { 0, 0, 15, 0, 0, 0, 13636 }, // ⁣
+    { 0, 0, 15, 0, 0, 0, 13636 }, // ⁤
+    { 0, 0, 15, 0, 0, 0, 13636 }, // ⁦
+    { 0, 0, 15, 0, 0, 0, 13636 }, // ⁧
+    { 0, 0, 15, 0, 0, 0, 13636 }, // ⁨
+    { 0, 0, 15, 0, 0, 0, 13636 }, // ⁩
+    { 6, 22, 0, -3, 18, 33, 13636 }, // ⁪
+    { 6, 22, 0, -3, 18, 33, 13669 }, // ⁫
+    { 6, 22, 0, -3, 18, 33, 13702 }, // ⁬
+    { 6, 22, 0, -3, 18, 33, 13735 }, // ⁭
+    { 6, 22, 0, -3, 18, 33, 13768 }, // ⁮
+    { 6, 22, 0, -3, 18, 33, 13801 }, // ⁯
+    { 9, 12, 9, 2, 22, 27, 13834 }, // ⁰
+    { 6, 12, 6, 1, 19, 18, 13861 }, // ⁱ
+    { 10, 12, 9, 1, 22, 30, 13879 }, // ⁴
+    { 10, 12, 9, 1, 22, 30, 13909 }, // ⁵
+    { 9, 12, 9, 2, 22, 27, 13939 }, // ⁶
+    { 10, 12, 9, 2, 22, 30, 13966 }, // ⁷
+    { 10, 12, 9, 1, 22, 30, 13996 }, // ⁸
+    { 9, 12, 9, 2, 22, 27, 14026 }, // ⁹
+    { 9, 8, 9, 2, 19, 18, 14053 }, // ⁺
+    { 9, 2, 9, 2, 16, 5, 14071 }, // ⁻
+    { 8, 6, 10, 3, 18, 12, 14076 }, // ⁼
+    { 6, 15, 6, 3, 23, 23, 14088 }, // ⁽
+    { 7, 15, 6, 0, 23, 27, 14111 }, // ⁾
+    { 10, 9, 10, 1, 16, 23, 14138 }, // ⁿ
+    { 10, 12, 9, -1, 8, 30, 14161 }, // ₀
+    { 9, 12, 9, -1, 8, 27, 14191 }, // ₁
+    { 10, 12, 9, -2, 8, 30, 14218 }, // ₂
+    { 10, 12, 9, -2, 8, 30, 14248 }, // ₃
+    { 10, 12, 9, -2, 8, 30, 14278 }, // ₄
+    { 10, 12, 9, -1, 8, 30, 14308 }, // ₅
+    { 10, 12, 9, -1, 8, 30, 14338 }, // ₆
+    { 10, 12, 9, -1, 8, 30, 14368 }, // ₇
+    { 9, 12, 9, -1, 8, 27, 14398 }, // ₈
+    { 9, 12, 9, -1, 8, 27, 14425 }, // ₉
+    { 8, 8, 9, 0, 6, 16, 14452 }, // ₊
+    { 8, 2, 9, 0, 3, 4, 14468 }, // ₋
+    { 8, 6, 10, 0, 5, 12, 14472 }, // ₌
+    { 7, 15, 6, 0, 10, 27, 14484 }, // ₍
+    { 7, 15, 6, -3, 10, 27, 14511 }, // ₎
+    { 10, 9, 10, -1, 6, 23, 14538 }, // ₐ
+    { 9, 9, 9, -1, 6, 21, 14561 }, // ₑ
+    { 9, 9, 10, -1, 6, 21, 14582 }, // ₒ
+    { 12, 9, 9, -3, 6, 27, 14603 }, // ₓ
+    { 9, 9, 9, -1, 6, 21, 14630 }, // ₔ
+    { 10, 12, 11, -1, 9, 30, 14651 }, // ₕ
+    { 11, 12, 10, -1, 9, 33, 14681 }, // ₖ
+    { 6, 12, 6, -1, 9, 18, 14714 }, // ₗ
+    { 15, 9, 16, -1, 6, 34, 14732 }, // ₘ
+    { 9, 9, 10, -1, 6, 21, 14766 }, // ₙ
+    { 10, 12, 10, -2, 6, 30, 14787 }, // ₚ
+    { 8, 9, 8, -1, 6, 18, 14817 }, // ₛ
+    { 7, 11, 7, -1, 8, 20, 14835 }, // ₜ
+    { 14, 19, 14, 1, 19, 67, 14855 }, // ₠
+    { 16, 21, 14, 0, 19, 84, 14922 }, // ₡
+    { 16, 20, 14, 0, 19, 80, 15006 }, // ₢
+    { 15, 18, 14, 0, 18, 68, 15086 }, // ₣
+    { 17, 19, 14, -1, 19, 81, 15154 }, // ₤
+    { 22, 20, 23, 0, 17, 110, 15235 }, // ₥
+    { 16, 18, 15, 0, 18, 72, 15345 }, // ₦
+    { 22, 19, 21, 0, 18, 105, 15417 }, // ₧
+    { 23, 19, 22, 0, 18, 110, 15522 }, // ₨
+    { 20, 18, 18, 0, 18, 90, 15632 }, // ₩
+    { 22, 18, 22, 0, 18, 99, 15722 }, // ₪
+    { 17, 23, 15, 0, 19, 98, 15821 }, // ₫
+    { 16, 20, 14, 0, 19, 80, 15919 }, // €
+    { 17, 18, 14, 0, 18, 77, 15999 }, // ₭
+    { 16, 18, 13, 0, 18, 72, 16076 }, // ₮
+    { 25, 25, 25, 0, 19, 157, 16148 }, // ₯
+    { 17, 25, 15, -2, 19, 107, 16305 }, // ₰
+    { 16, 18, 14, 0, 18, 72, 16412 }, // ₱
+    { 17, 22, 17, 1, 20, 94, 16484 }, // ₲
+    { 18, 18, 15, -2, 18, 81, 16578 }, // ₳
+    { 15, 20, 14, 0, 19, 75, 16659 }, // ₴
+    { 16, 21, 15, 1, 19, 84, 16734 }, // ₵
+    { 18, 18, 17, 0, 17, 81, 16818 }, // ₶
+    { 19, 21, 17, -1, 19, 100, 16899 }, // ₷
+    { 14, 18, 13, 1, 18, 63, 16999 }, // ₸
+    { 14, 18, 14, 1, 18, 63, 17062 }, // ₹
+    { 14, 19, 14, 0, 18, 67, 17125 }, // ₺
+    { 16, 20, 16, 1, 19, 80, 17192 }, // ₻
+    { 20, 18, 20, -1, 18, 90, 17272 }, // ₼
+    { 16, 18, 15, -1, 18, 72, 17362 }, // ₽
+    { 18, 21, 15, -1, 21, 95, 17434 }, // ₾
+    { 14, 24, 14, 0, 21, 84, 17529 }, // ₿
+    { 8, 4, 8, 0, 9, 8, 17613 }, // −
+    { 24, 26, 18, -3, 20, 156, 17621 }, // ﬀ
+    { 21, 26, 17, -3, 20, 137, 17777 }, // ﬁ
+    { 21, 26, 17, -3, 20, 137, 17914 }, // ﬂ
+    { 29, 26, 25, -3, 20, 189, 18051 }, // ﬃ
+    { 29, 26, 25, -3, 20, 189, 18240 }, // ﬄ
+    { 23, 26, 19, -3, 20, 150, 18429 }, // ﬅ
+    { 23, 21, 22, 0, 20, 121, 18579 }, // ﬆ
+    { 23, 23, 25, 1, 19, 133, 18700 }, // �
 };
 
 static const EpdUnicodeInterval notosans_12_bolditalicIntervals[] = {
@@ -2598,31 +2633,285 @@ static const EpdUnicodeInterval notosans_12_bolditalicIntervals[] = {
     { 0x2090, 0x209C, 0x33D },
     { 0x20A0, 0x20BF, 0x34A },
     { 0x2212, 0x2212, 0x36A },
-    { 0xFFFD, 0xFFFD, 0x36B },
+    { 0xFB00, 0xFB06, 0x36B },
+    { 0xFFFD, 0xFFFD, 0x372 },
 };
 
 static const EpdFontGroup notosans_12_bolditalicGroups[] = {
-    { 0, 3242, 5728, 97, 0 },
-    { 3242, 3268, 6758, 96, 97 },
-    { 6510, 4519, 10781, 128, 193 },
-    { 11029, 1169, 1533, 112, 321 },
-    { 12198, 10191, 21532, 256, 433 },
-    { 22389, 2042, 3765, 111, 689 },
-    { 24431, 783, 1021, 42, 800 },
-    { 25214, 1772, 2758, 32, 842 },
-    { 26986, 10, 8, 1, 874 },
-    { 26996, 90, 133, 1, 875 },
+    { 0, 4560, 9744, 151, 2 },
+    { 4560, 2746, 5048, 66, 434 },
+    { 7306, 10359, 21471, 363, 0 },
+    { 17665, 9862, 18833, 303, 573 },
+};
+
+static const uint8_t notosans_12_bolditalicGlyphGroups[883] = {
+    2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2,
+    2, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 2, 2,
+    2, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 0, 0, 3, 3, 3, 0, 0, 3, 3, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+};
+
+static const uint8_t notosans_12_bolditalicKernLeftClasses[883] = {
+    0, 0, 0, 0, 1, 0, 0, 0, 48, 1, 15, 0, 0, 0, 6, 29,
+    6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 12, 0, 0, 21, 24, 56, 0, 0, 0, 0, 0, 22, 0,
+    0, 21, 40, 21, 0, 0, 11, 0, 45, 45, 0, 16, 0, 15, 0, 0,
+    0, 55, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 30, 0, 0, 0, 34, 34, 0, 34, 0, 15, 0, 0,
+    0, 0, 24, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27, 0, 0, 0,
+    50, 12, 12, 12, 12, 12, 12, 24, 0, 24, 24, 24, 24, 0, 0, 0,
+    0, 21, 0, 21, 21, 21, 21, 21, 0, 21, 0, 0, 0, 0, 16, 40,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    58, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 34, 0,
+    34, 12, 0, 12, 0, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21,
+    28, 21, 0, 24, 0, 24, 0, 24, 0, 24, 0, 24, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 51, 0, 58, 0, 0, 59,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 22, 0, 22, 28,
+    22, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 0, 21,
+    0, 21, 0, 24, 0, 0, 30, 0, 30, 0, 30, 0, 0, 0, 0, 0,
+    0, 0, 0, 11, 0, 11, 52, 11, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 45, 34, 16, 34, 16, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 10, 9, 0, 0, 0, 0, 57, 10, 10, 37, 13, 0, 2,
+    0, 4, 53, 0, 9, 3, 0, 13, 0, 0, 0, 13, 0, 0, 0, 14,
+    0, 25, 0, 9, 2, 41, 13, 3, 0, 0, 3, 10, 0, 10, 14, 14,
+    0, 19, 49, 31, 19, 0, 19, 19, 31, 19, 19, 0, 19, 19, 19, 7,
+    35, 7, 19, 35, 18, 7, 0, 26, 19, 19, 26, 5, 19, 5, 7, 7,
+    19, 19, 19, 38, 19, 19, 19, 0, 47, 54, 5, 5, 35, 0, 19, 18,
+    19, 2, 42, 33, 5, 0, 0, 4, 36, 4, 36, 0, 0, 0, 0, 0,
+    31, 0, 0, 14, 7, 2, 42, 2, 42, 18, 18, 14, 7, 14, 7, 2,
+    42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 33, 5, 25,
+    7, 8, 43, 20, 44, 0, 32, 17, 0, 0, 31, 17, 0, 13, 19, 13,
+    19, 13, 19, 3, 0, 20, 43, 0, 32, 0, 7, 0, 0, 8, 0, 23,
+    42, 23, 42, 17, 0, 3, 0, 3, 0, 0, 0, 0, 32, 0, 19, 0,
+    19, 0, 13, 19, 0, 19, 3, 0, 0, 0, 3, 0, 0, 0, 3, 0,
+    0, 4, 0, 4, 0, 0, 19, 0, 19, 14, 7, 14, 7, 13, 19, 0,
+    31, 0, 0, 0, 0, 0, 0, 14, 7, 14, 7, 14, 7, 14, 7, 2,
+    18, 2, 18, 2, 18, 0, 19, 8, 43, 0, 19, 20, 44, 17, 0, 13,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 29, 29, 29, 0, 0, 1, 1, 6, 0, 1, 1, 6,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 27, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 60, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 61, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0,
+    0, 0, 0,
+};
+
+static const uint8_t notosans_12_bolditalicKernRightClasses[883] = {
+    0, 0, 0, 52, 5, 0, 0, 0, 59, 5, 0, 28, 0, 0, 3, 25,
+    3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 52, 0, 12, 0, 19, 0, 0, 0, 19, 0, 0, 36, 0, 0, 0,
+    0, 19, 0, 19, 0, 0, 14, 0, 44, 44, 0, 20, 0, 0, 0, 28,
+    0, 0, 0, 9, 0, 2, 2, 2, 50, 30, 0, 0, 50, 0, 0, 8,
+    8, 2, 8, 2, 8, 9, 0, 8, 0, 0, 0, 0, 48, 0, 0, 28,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0,
+    0, 12, 12, 12, 12, 12, 12, 0, 19, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 19, 19, 19, 19, 19, 0, 19, 0, 0, 0, 0, 20, 0,
+    50, 2, 9, 9, 9, 9, 9, 9, 2, 2, 2, 2, 2, 0, 0, 0,
+    0, 0, 8, 2, 2, 2, 2, 2, 0, 2, 8, 8, 8, 8, 0, 0,
+    0, 12, 9, 12, 9, 12, 9, 19, 2, 19, 2, 19, 2, 19, 2, 0,
+    2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 19, 30, 19,
+    30, 19, 30, 19, 30, 0, 0, 0, 60, 0, 49, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 50, 0, 0, 8, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 8, 0, 8, 0, 8, 0, 0, 8, 19, 2, 19,
+    2, 19, 2, 19, 2, 0, 8, 0, 8, 0, 0, 0, 9, 0, 9, 0,
+    9, 0, 9, 14, 0, 14, 0, 14, 0, 0, 8, 0, 8, 0, 8, 0,
+    8, 0, 8, 0, 8, 44, 0, 20, 0, 20, 0, 48, 0, 48, 0, 48,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 32, 57, 0, 0, 26, 21, 0, 1, 0, 0, 13,
+    0, 11, 0, 0, 0, 37, 0, 17, 31, 0, 0, 0, 21, 0, 0, 32,
+    0, 0, 32, 1, 13, 40, 17, 0, 4, 0, 0, 1, 0, 0, 31, 0,
+    54, 15, 0, 15, 39, 53, 15, 0, 39, 35, 35, 35, 24, 35, 35, 15,
+    35, 35, 15, 35, 7, 15, 35, 35, 6, 35, 35, 18, 35, 35, 0, 35,
+    55, 15, 15, 22, 39, 15, 51, 0, 31, 45, 24, 35, 22, 35, 35, 7,
+    35, 34, 56, 0, 0, 0, 16, 11, 27, 0, 16, 0, 0, 0, 16, 31,
+    39, 4, 16, 19, 10, 34, 56, 34, 56, 19, 10, 19, 10, 19, 10, 34,
+    56, 19, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 0, 22, 0,
+    16, 0, 16, 0, 0, 0, 16, 17, 39, 31, 39, 0, 16, 0, 16, 0,
+    22, 38, 18, 0, 16, 0, 16, 0, 16, 19, 10, 19, 10, 1, 16, 41,
+    47, 41, 47, 17, 0, 38, 18, 4, 6, 4, 6, 0, 16, 33, 42, 33,
+    42, 0, 17, 0, 0, 16, 43, 27, 0, 16, 0, 16, 4, 6, 0, 16,
+    0, 11, 58, 11, 58, 11, 58, 0, 10, 0, 39, 0, 39, 17, 0, 31,
+    39, 0, 0, 0, 16, 0, 16, 19, 10, 19, 10, 19, 10, 31, 0, 13,
+    7, 13, 7, 13, 7, 4, 6, 0, 16, 0, 35, 0, 0, 17, 0, 17,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 25, 25, 25, 0, 0, 23, 5, 3, 0, 23, 5, 3,
+    0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 46, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 61, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 62, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 0, 0, 0, 0,
+    0, 0, 0,
+};
+
+static const int8_t notosans_12_bolditalicKernMatrix[3906] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 0, -1, -1, -2, -2, -2, 1, 0, 0, 0, 1, 0, 0, 0, -1, 1, 0, -1, 0, 0, -2, 0, 0, -1, 1, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, -2, 1, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 3, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, 0, -2, -2, -2, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -2, 0, 0, 0, 0, -2, 0, 0, 1, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, 0, -3, -2, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, 0, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -1, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, 0, 0, 0, -2, 0, -1, -2, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, 0, -1, -1, 0, 0, -2, -1, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, -2, -1, 0, 0, -1, -1, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, -2, 1, 0, -2, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, 0, -2, -2, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, -2, 0, 0, 0, 0, -1, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 3, 0, 0, 0, 0, 1, 0, 0, 0, 0, 2, 1, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -2, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, 0, -1, 0, 0, 0, -1, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 3, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0,
+    0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -3, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -2, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, 0, -2, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+};
+
+static const EpdLigaturePair notosans_12_bolditalicLigatures[] = {
+    { 0x66, 0x66, 0xFB00 },
+    { 0x66, 0x69, 0xFB01 },
+    { 0x66, 0x6C, 0xFB02 },
+    { 0xFB00, 0x69, 0xFB03 },
+    { 0xFB00, 0x6C, 0xFB04 },
+};
+
+static const uint16_t notosans_12_bolditalicGlyphLookup[368] = {
+    0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0001, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, 0x0010, 0x0011,
+    0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, 0x0020, 0x0021,
+    0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, 0x0030, 0x0031,
+    0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, 0x0040, 0x0041,
+    0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051,
+    0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, 0x0060, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070,
+    0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, 0x0080,
+    0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F, 0x0090,
+    0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F, 0x00A0,
+    0x00A1, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF, 0x00B0,
+    0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF, 0x00C0,
+    0x02B1, 0x02B2, 0x02B3, 0x02B4, 0x02B5, 0x02B6, 0x02B7, 0x02B8, 0x02B9, 0x02BA, 0x02BB, 0x02BC, 0x02BD, 0x02BE, 0x02BF, 0x02C0,
+    0x02C1, 0x02C2, 0x02C3, 0x02C4, 0x02C5, 0x02C6, 0x02C7, 0x02C8, 0x02C9, 0x02CA, 0x02CB, 0x02CC, 0x02CD, 0x02CE, 0x02CF, 0x02D0,
+    0x02D1, 0x02D2, 0x02D3, 0x02D4, 0x02D5, 0x02D6, 0x02D7, 0x02D8, 0x02D9, 0x02DA, 0x02DB, 0x02DC, 0x02DD, 0x02DE, 0x02DF, 0x02E0,
+    0x02E1, 0x02E2, 0x02E3, 0x02E4, 0x02E5, 0x02E6, 0x02E7, 0x02E8, 0x02E9, 0x02EA, 0x02EB, 0x02EC, 0x02ED, 0x02EE, 0x02EF, 0x02F0,
+    0x02F1, 0x02F2, 0x02F3, 0x02F4, 0x02F5, 0x02F6, 0x02F7, 0x02F8, 0x02F9, 0x02FA, 0x02FB, 0x02FC, 0x02FD, 0x02FE, 0x02FF, 0x0300,
+    0x0301, 0x0302, 0x0303, 0x0304, 0x0305, 0x0306, 0x0307, 0x0308, 0x0309, 0x030A, 0x030B, 0x030C, 0x030D, 0x030E, 0x030F, 0x0310,
+    0x0311, 0x0312, 0x0313, 0x0314, 0x0315, 0xFFFF, 0x0316, 0x0317, 0x0318, 0x0319, 0x031A, 0x031B, 0x031C, 0x031D, 0x031E, 0x031F,
 };
 
 static const EpdFontData notosans_12_bolditalic = {
     notosans_12_bolditalicBitmaps,
     notosans_12_bolditalicGlyphs,
     notosans_12_bolditalicIntervals,
-    15,
+    16,
     34,
     27,
     -8,
     true,
     notosans_12_bolditalicGroups,
-    10,
+    4,
+    notosans_12_bolditalicKernLeftClasses,
+    notosans_12_bolditalicKernRightClasses,
+    notosans_12_bolditalicKernMatrix,
+    63,
+    notosans_12_bolditalicLigatures,
+    5,
+    0x4000000001ull,
+    notosans_12_bolditalicGlyphLookup,
+    notosans_12_bolditalicGlyphGroups,
+    false,
+    nullptr,
 };
@@ -3,1575 +3,1565 @@
  * name: notosans_12_italic
  * size: 12
  * mode: 2-bit  compressed: true
- * Command used: fontconvert.py notosans_12_italic 12 ../builtinFonts/source/NotoSans/NotoSans-Italic.ttf --2bit --compress
+ * Command used: fontconvert.py notosans_12_italic 12 ../builtinFonts/source/NotoSans/NotoSans-Italic.ttf --2bit --compress --frequency-corpus ../../../test/hyphenation_eval/resources/english_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/french_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/german_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/italian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/russian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/spanish_hyphenation_tests.txt
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t notosans_12_italicBitmaps[25007] = {
-    0xA5, 0x58, 0x3D, 0x8C, 0x1B, 0xC7, 0x15, 0x7E, 0xBB, 0x63, 0x79, 0x13, 0x2F, 0xA4, 0x51, 0x91,
-    0x00, 0x81, 0x04, 0x71, 0x53, 0xA4, 0x08, 0x8C, 0x23, 0xD9, 0xB8, 0xB8, 0x62, 0x96, 0xDC, 0x58,
-    0x80, 0x5D, 0xB8, 0xF0, 0x21, 0xD0, 0xB9, 0x88, 0x81, 0xA4, 0x4F, 0x60, 0xC8, 0x85, 0x0A, 0x06,
-    0x58, 0x1D, 0xC7, 0x52, 0xA1, 0xC2, 0x45, 0x04, 0x04, 0x48, 0x4A, 0xAB, 0x30, 0x10, 0xF9, 0x54,
-    0xE8, 0x02, 0x10, 0x01, 0x81, 0xF0, 0x8E, 0x23, 0xA9, 0x50, 0x99, 0x91, 0x12, 0xC0, 0x85, 0x10,
-    0x68, 0xAD, 0x48, 0x88, 0x21, 0xC5, 0xD1, 0x38, 0x5E, 0x27, 0xD4, 0xE9, 0xEE, 0x26, 0xDF, 0x9B,
-    0xE5, 0x51, 0x7F, 0x71, 0x15, 0xEA, 0x28, 0x72, 0xE7, 0xE7, 0xCD, 0xFB, 0xFD, 0xBE, 0x37, 0xA4,
-    0xB1, 0xA8, 0x64, 0x51, 0xC6, 0x4E, 0xEA, 0x9C, 0x5C, 0x62, 0x5A, 0x34, 0x12, 0x46, 0x12, 0x5E,
-    0xB2, 0x58, 0x8B, 0xEA, 0x88, 0xA8, 0x25, 0xD3, 0x73, 0x57, 0x6F, 0x54, 0x6E, 0xB4, 0xBC, 0x74,
-    0xF0, 0x50, 0x1C, 0x17, 0x14, 0x9B, 0xD7, 0x88, 0xDC, 0x31, 0xA2, 0xE5, 0x94, 0xE8, 0x98, 0xD0,
-    0x94, 0x46, 0x36, 0xBA, 0x74, 0x7F, 0x5B, 0x4F, 0xBD, 0x77, 0xB4, 0xD1, 0x22, 0x52, 0x98, 0x38,
-    0x24, 0x0C, 0x25, 0x45, 0x45, 0x1E, 0x83, 0x7D, 0xEF, 0x67, 0x74, 0x0A, 0x52, 0x97, 0xB0, 0x5A,
-    0xC6, 0x86, 0x84, 0x76, 0x14, 0xD9, 0x65, 0x3E, 0x66, 0x03, 0x27, 0x11, 0xA5, 0x8F, 0x28, 0xF5,
-    0x3B, 0xD1, 0xD7, 0x57, 0x0B, 0xB5, 0x44, 0xE2, 0x9A, 0xA1, 0x7C, 0x99, 0xE2, 0xC7, 0x05, 0xA5,
-    0x33, 0x4C, 0xD7, 0x44, 0x0F, 0x2C, 0x1D, 0xEC, 0x50, 0x74, 0xB3, 0xA2, 0xA5, 0x5C, 0xFC, 0xFA,
-    0xB6, 0xE9, 0xFB, 0x8A, 0x4E, 0x56, 0x44, 0xEF, 0x63, 0x2B, 0x84, 0xAC, 0x50, 0x78, 0x45, 0x7B,
-    0x24, 0x3E, 0x78, 0x6C, 0x85, 0x71, 0x83, 0xD8, 0x0E, 0x0E, 0x45, 0x15, 0xCE, 0x73, 0x32, 0xB2,
-    0x4E, 0x98, 0x8D, 0x11, 0x39, 0x35, 0xD8, 0x52, 0xC7, 0xD4, 0xE3, 0x5B, 0x97, 0xD5, 0x48, 0x6D,
-    0xB5, 0x95, 0xA4, 0xD6, 0x31, 0xD8, 0x9A, 0x52, 0x25, 0x85, 0x39, 0x95, 0x16, 0x6E, 0x29, 0xD1,
-    0x0A, 0x6A, 0xA7, 0x1F, 0x41, 0x75, 0x5F, 0xD0, 0xFE, 0x2B, 0xF2, 0x9A, 0xE2, 0xED, 0x19, 0x45,
-    0x2E, 0x23, 0x1A, 0x63, 0xAE, 0x4D, 0x8E, 0x52, 0x0D, 0xAD, 0xBE, 0x84, 0x76, 0x7D, 0x7C, 0x66,
-    0xD0, 0xA4, 0x3B, 0xA1, 0x95, 0x9E, 0xD4, 0xE3, 0x0E, 0xD5, 0x90, 0x9C, 0xF5, 0x84, 0x89, 0xF7,
-    0xB0, 0xAE, 0x4F, 0x3D, 0x1A, 0xDA, 0x64, 0x7B, 0x6F, 0x42, 0xC3, 0x99, 0xD4, 0x2C, 0xAF, 0xD5,
-    0x69, 0xAB, 0xE5, 0xD7, 0xBE, 0x4F, 0x87, 0x60, 0xB8, 0x2C, 0x52, 0x2D, 0x8C, 0xB0, 0x91, 0xA3,
-    0x11, 0x29, 0xCA, 0x20, 0x57, 0x58, 0x6C, 0x53, 0x98, 0xC3, 0x49, 0x8E, 0x72, 0x4A, 0x8B, 0xA8,
-    0xC2, 0x73, 0x02, 0x85, 0x96, 0x61, 0x6C, 0x64, 0xF1, 0x31, 0x9F, 0x5C, 0xAC, 0x2A, 0xA9, 0x03,
-    0x51, 0x38, 0xB2, 0xC2, 0xC3, 0x18, 0x8F, 0x0A, 0x4A, 0x76, 0x1A, 0xF5, 0xB1, 0x00, 0x83, 0x85,
-    0xA2, 0xFC, 0x20, 0xA5, 0x8F, 0x89, 0x8E, 0x7A, 0x17, 0x3F, 0xBA, 0x18, 0xDF, 0x26, 0x71, 0x07,
-    0xC7, 0x96, 0x74, 0x18, 0xEE, 0x47, 0x98, 0xE9, 0x20, 0x51, 0xA2, 0x09, 0x67, 0xD1, 0x00, 0x3A,
-    0xD2, 0x2B, 0x97, 0xEF, 0xFF, 0x96, 0xC3, 0x16, 0x1E, 0x9E, 0x9A, 0xC1, 0x2B, 0xAE, 0xF2, 0xD4,
-    0xD4, 0x2D, 0x16, 0xFC, 0xEA, 0x45, 0xFF, 0xD9, 0x2A, 0x51, 0xBE, 0x76, 0xFA, 0x70, 0x58, 0x44,
-    0xF0, 0x46, 0xA7, 0x39, 0x73, 0x1C, 0x02, 0x2B, 0xB0, 0xAB, 0xE4, 0x64, 0x82, 0xFB, 0xB0, 0x0E,
-    0xE1, 0xD2, 0xAC, 0xCE, 0xFE, 0x22, 0x38, 0x10, 0x4E, 0x85, 0xC9, 0xE1, 0x95, 0xEE, 0x92, 0xF4,
-    0x56, 0x9A, 0x49, 0x6A, 0xA4, 0xB0, 0xE2, 0x86, 0xA3, 0x7A, 0x46, 0x79, 0x4E, 0xF2, 0x6D, 0x12,
-    0xD7, 0x4D, 0xF4, 0x65, 0x45, 0xE5, 0x98, 0x3A, 0x30, 0xF5, 0x2D, 0x9D, 0x5C, 0x71, 0xC2, 0xE6,
-    0xC2, 0xA5, 0x0F, 0x1C, 0x4D, 0xAB, 0xB0, 0x3B, 0xA3, 0xBE, 0x99, 0x56, 0xBB, 0xB5, 0x62, 0x3F,
-    0x26, 0x1A, 0xBE, 0xA8, 0x9F, 0x75, 0xE9, 0xFC, 0x6B, 0x13, 0x53, 0x8B, 0xCC, 0x2C, 0x0E, 0xD1,
-    0x4E, 0xA3, 0x87, 0x5A, 0xE8, 0xDC, 0xA8, 0x13, 0xC1, 0x8E, 0xD3, 0x78, 0x40, 0x06, 0x5A, 0x8A,
-    0xA1, 0xEF, 0x04, 0x91, 0x86, 0x82, 0xDE, 0x5B, 0xEF, 0x77, 0x1A, 0x2F, 0x78, 0x1B, 0x05, 0x11,
-    0x93, 0x85, 0x88, 0xC4, 0xB0, 0x03, 0xA2, 0x4D, 0x4A, 0xF7, 0x88, 0x2E, 0x63, 0x57, 0x8A, 0x81,
-    0x1E, 0x3B, 0xAC, 0x31, 0xD8, 0xAE, 0xD0, 0x24, 0xD9, 0x9E, 0x16, 0x5D, 0xAF, 0xE7, 0x06, 0x1B,
-    0x8A, 0x21, 0x6D, 0xA8, 0x29, 0x1B, 0x91, 0xF8, 0x13, 0x76, 0x23, 0xE2, 0x50, 0xF3, 0x4C, 0x05,
-    0x1F, 0x53, 0x29, 0x4C, 0x46, 0x4A, 0x98, 0xC4, 0xA0, 0xB2, 0x6E, 0x85, 0x73, 0x5D, 0x50, 0x90,
-    0x43, 0xD1, 0x86, 0x42, 0xDE, 0x0A, 0x0C, 0x8E, 0x83, 0x7B, 0x79, 0x0A, 0x81, 0x8A, 0x61, 0x5F,
-    0x1F, 0x65, 0xC0, 0x8B, 0x93, 0x2A, 0xAC, 0xE6, 0x19, 0x8E, 0x31, 0x3E, 0x7A, 0x31, 0x8E, 0xEC,
-    0x5F, 0xAA, 0x63, 0x04, 0x76, 0x91, 0xDE, 0xD3, 0x2A, 0xF6, 0xB5, 0xA8, 0xD9, 0x4C, 0x5E, 0x53,
-    0x87, 0x80, 0x75, 0x86, 0x95, 0xDC, 0x9A, 0x8A, 0x5A, 0xDC, 0xA8, 0xA9, 0x2E, 0xA9, 0x9D, 0x91,
-    0x7C, 0xD3, 0x88, 0x2B, 0x2E, 0x72, 0xBD, 0xA8, 0x4E, 0x1E, 0xCF, 0x68, 0x58, 0xF3, 0x66, 0x54,
-    0xB6, 0xF4, 0xDE, 0x04, 0x97, 0xB9, 0x70, 0xD2, 0x38, 0x78, 0x22, 0x0F, 0x27, 0x43, 0x2D, 0x84,
-    0x1B, 0xCE, 0x41, 0x16, 0xCC, 0x45, 0x4F, 0xC2, 0xDC, 0x3C, 0x35, 0xD9, 0x4F, 0xD2, 0x03, 0x7A,
-    0x4E, 0xA3, 0xEA, 0x3E, 0x70, 0x71, 0xA5, 0xA8, 0x96, 0x7A, 0x46, 0x28, 0xB6, 0xAE, 0xA3, 0xE1,
-    0x16, 0x6D, 0x26, 0xB6, 0xA4, 0x12, 0x01, 0x47, 0x72, 0x5F, 0xAB, 0x22, 0x37, 0xA1, 0x99, 0xBC,
-    0xBF, 0x43, 0xD3, 0x85, 0xF6, 0x19, 0x56, 0x7A, 0xD3, 0xC5, 0x30, 0x65, 0x08, 0xEE, 0x55, 0x04,
-    0xBA, 0xA6, 0x32, 0xA7, 0x6E, 0x6A, 0x32, 0xB3, 0x7B, 0xB2, 0xCA, 0x76, 0x6B, 0x3A, 0xA1, 0xC2,
-    0x81, 0x32, 0xE4, 0x5E, 0x6A, 0x7A, 0x53, 0x23, 0x1B, 0xFF, 0xC7, 0x7A, 0x2D, 0xB5, 0x3F, 0x58,
-    0x38, 0x02, 0x46, 0xAC, 0x25, 0x16, 0x79, 0xFC, 0x43, 0x5A, 0xA3, 0x4D, 0x7A, 0x6A, 0x22, 0x4C,
-    0x56, 0x89, 0x49, 0x35, 0x30, 0x83, 0xCD, 0x9B, 0xBF, 0x2E, 0x50, 0x5C, 0x53, 0x5A, 0x51, 0x57,
-    0xD3, 0x16, 0xC5, 0xB3, 0x90, 0xCE, 0x47, 0x61, 0x64, 0x17, 0x8E, 0x1F, 0x9E, 0x67, 0x38, 0xC2,
-    0x19, 0xCD, 0x52, 0x78, 0xE9, 0xE6, 0xFA, 0xFA, 0x85, 0x27, 0xE2, 0xBC, 0xAF, 0xD7, 0xD7, 0x2F,
-    0xE2, 0x1B, 0x80, 0x54, 0xF0, 0x1E, 0x04, 0x6E, 0x8A, 0x2A, 0xD9, 0x45, 0xDC, 0xE0, 0x2A, 0xC8,
-    0xDB, 0xA5, 0xEC, 0x2E, 0x4D, 0x35, 0x61, 0xE4, 0xD4, 0x62, 0xDF, 0xD1, 0xBD, 0xC8, 0xEF, 0xC5,
-    0x45, 0xC9, 0xCE, 0x84, 0xD3, 0x25, 0x9F, 0x29, 0x4D, 0x34, 0xA3, 0x4C, 0x63, 0x04, 0x20, 0xB1,
-    0xB4, 0xEF, 0x19, 0x42, 0x6E, 0xB3, 0xDF, 0xF9, 0xE1, 0x17, 0x9F, 0x87, 0xDC, 0xD5, 0xB4, 0x56,
-    0x24, 0x8E, 0x73, 0x7B, 0x1C, 0x32, 0x56, 0xD2, 0xC9, 0xBB, 0xED, 0x16, 0xB0, 0xED, 0x98, 0x4A,
-    0xF5, 0xA8, 0xB5, 0x9C, 0x91, 0x6B, 0x9D, 0x6A, 0x53, 0x75, 0x6C, 0xA4, 0x22, 0xBB, 0xB4, 0xA1,
-    0x84, 0x55, 0x1B, 0x2A, 0x31, 0xA3, 0x51, 0xA7, 0x75, 0xC7, 0x0D, 0x64, 0xED, 0xB5, 0x8A, 0x8A,
-    0xEF, 0x34, 0xD1, 0x03, 0x96, 0x1D, 0x26, 0xB1, 0xFD, 0x13, 0xE8, 0x3A, 0xF4, 0xE7, 0x31, 0x50,
-    0xCC, 0x47, 0x69, 0x08, 0x83, 0x90, 0x7D, 0x1D, 0xCC, 0x7C, 0x65, 0x28, 0xFD, 0x55, 0x41, 0xAA,
-    0x8D, 0x12, 0x18, 0x53, 0x86, 0xBC, 0x9D, 0x25, 0x26, 0xB9, 0x7F, 0x19, 0x79, 0x03, 0xB0, 0x5F,
-    0x75, 0x08, 0xAB, 0x9D, 0x90, 0x3C, 0x6E, 0xA9, 0xD3, 0x85, 0x52, 0x35, 0x67, 0x89, 0x7F, 0x44,
-    0x99, 0x9F, 0xC5, 0x55, 0x6A, 0x73, 0x62, 0x14, 0xAD, 0x4A, 0xEA, 0xA5, 0x3A, 0x31, 0x8F, 0xDE,
-    0xA9, 0xA5, 0xAF, 0x69, 0xFB, 0x32, 0x8A, 0xA2, 0xCB, 0xC5, 0x0D, 0x5C, 0x38, 0x6B, 0x80, 0xB6,
-    0x94, 0x41, 0x66, 0x35, 0xF5, 0x33, 0x89, 0xAD, 0x4D, 0x5A, 0x79, 0x1D, 0xC3, 0xDA, 0xBE, 0xFE,
-    0x16, 0x97, 0x2E, 0x8A, 0x98, 0x03, 0xC3, 0xC5, 0x89, 0x43, 0x38, 0x09, 0x19, 0x04, 0x98, 0xE3,
-    0xD4, 0xFC, 0xB1, 0x6A, 0x2A, 0x55, 0xE2, 0x9D, 0x21, 0xB5, 0x33, 0xDF, 0x80, 0x84, 0xFF, 0x9C,
-    0x12, 0xBF, 0x47, 0x1D, 0xC4, 0xB1, 0xA6, 0x09, 0x3C, 0x36, 0xCB, 0x50, 0x24, 0x63, 0x4A, 0xAE,
-    0x59, 0xCA, 0x90, 0xDB, 0x13, 0x45, 0xF1, 0x67, 0x8E, 0xE4, 0x87, 0x9A, 0x53, 0x4E, 0x38, 0x47,
-    0xDD, 0xE3, 0x26, 0xC6, 0xA2, 0x21, 0xA8, 0xB0, 0x16, 0x41, 0x1B, 0xA8, 0x31, 0xF4, 0x55, 0x27,
-    0xD4, 0x02, 0x24, 0x44, 0x4D, 0x85, 0xF4, 0x56, 0x0B, 0xE9, 0x67, 0xE2, 0xFE, 0x27, 0xF3, 0xE7,
-    0xBC, 0xC1, 0xCA, 0x66, 0x7E, 0xEA, 0x6D, 0x1F, 0x44, 0xFA, 0x0D, 0x5B, 0x79, 0xE9, 0xFA, 0xC7,
-    0xC2, 0xEF, 0xC2, 0x7F, 0x2F, 0x6C, 0x6D, 0x9E, 0x69, 0x8E, 0x4F, 0x35, 0x6A, 0x63, 0x97, 0xF6,
-    0xE8, 0x7B, 0xC8, 0x52, 0x4A, 0x6C, 0x13, 0x1D, 0x06, 0x04, 0x0E, 0x60, 0x4E, 0xDF, 0x3D, 0x91,
-    0x83, 0xBD, 0x14, 0xBD, 0x8A, 0x37, 0xB9, 0x1C, 0x02, 0x7A, 0x08, 0x53, 0x17, 0xDE, 0x91, 0x06,
-    0xA0, 0xB3, 0x87, 0xB2, 0x9E, 0xEE, 0x35, 0x34, 0x08, 0x23, 0x01, 0x0A, 0x89, 0xE9, 0x60, 0x01,
-    0xB4, 0xA9, 0x71, 0x9C, 0x8A, 0x78, 0x70, 0xCC, 0x83, 0xAB, 0xEF, 0x54, 0x48, 0xEF, 0x5A, 0xDC,
-    0x5F, 0x9F, 0x60, 0x30, 0xC3, 0x60, 0x8A, 0x66, 0x22, 0xB6, 0xD0, 0x6B, 0x7F, 0xE5, 0xFE, 0x20,
-    0x7B, 0x7E, 0x5A, 0x33, 0xA3, 0x3A, 0x0E, 0x48, 0x27, 0xA4, 0xB1, 0x61, 0xA5, 0x06, 0x8C, 0x92,
-    0x90, 0xAD, 0xD8, 0x10, 0x14, 0x6A, 0xCE, 0xA7, 0x1E, 0xBD, 0x1B, 0xB1, 0x27, 0x38, 0x50, 0x65,
-    0xB0, 0xAE, 0xE6, 0x51, 0x2C, 0xC0, 0x5A, 0xFC, 0x41, 0x1A, 0x77, 0x19, 0x86, 0xD7, 0x63, 0xAB,
-    0x0C, 0xAE, 0xC8, 0x82, 0x7D, 0x79, 0xD8, 0x34, 0xA1, 0x37, 0x6A, 0x42, 0xAB, 0xB0, 0x1E, 0x6C,
-    0x18, 0x47, 0x55, 0x0C, 0x90, 0x49, 0xC1, 0xB7, 0xB0, 0xD2, 0x4C, 0x28, 0xB9, 0x8A, 0xA3, 0x3E,
-    0x34, 0x24, 0x4F, 0x62, 0x27, 0x8A, 0x55, 0x3E, 0xC4, 0xF6, 0xB7, 0x34, 0x75, 0x20, 0x32, 0x87,
-    0x70, 0x15, 0x33, 0x6D, 0x00, 0x50, 0x70, 0x34, 0xB3, 0x6A, 0xCD, 0x60, 0xEE, 0x00, 0x01, 0x38,
-    0x3B, 0xE7, 0xA3, 0x4B, 0x3E, 0xB9, 0xE6, 0xB3, 0xD9, 0xC4, 0xFD, 0x51, 0xC5, 0x2A, 0x4D, 0xFD,
-    0x6D, 0xE4, 0x38, 0x83, 0x3B, 0x4D, 0x81, 0x93, 0xA6, 0x6B, 0x00, 0x0B, 0x72, 0x44, 0x72, 0x24,
-    0xFE, 0x4A, 0x69, 0x19, 0xFD, 0x5D, 0x03, 0xEF, 0xC7, 0x95, 0xF8, 0xD4, 0xE4, 0x2A, 0xBA, 0x53,
-    0x49, 0x09, 0xE4, 0x42, 0xE3, 0x33, 0x50, 0x51, 0xB5, 0xA1, 0x32, 0x1A, 0xB5, 0xA1, 0x44, 0x9E,
-    0xBC, 0x0D, 0x7F, 0x47, 0x0F, 0x8A, 0x3A, 0x31, 0x43, 0x83, 0x19, 0x69, 0x31, 0x03, 0xD2, 0xD3,
-    0x8A, 0x60, 0x08, 0xB3, 0x54, 0xA2, 0xB7, 0x38, 0x68, 0xA8, 0x03, 0xB4, 0x49, 0x4A, 0xDC, 0x46,
-    0x91, 0xFD, 0xCD, 0x24, 0x7A, 0x3C, 0x8E, 0x2D, 0x88, 0xA4, 0x06, 0x8D, 0x82, 0x40, 0xC6, 0xA8,
-    0x3C, 0x89, 0x0A, 0x17, 0x37, 0x51, 0x53, 0x03, 0x87, 0xB6, 0x03, 0x55, 0x1D, 0x3F, 0x44, 0x39,
-    0x0E, 0x35, 0x34, 0xB2, 0x2A, 0x50, 0x5C, 0xC3, 0x8B, 0x15, 0x43, 0x53, 0x01, 0xE0, 0x77, 0xC2,
-    0x81, 0x2F, 0xE0, 0x20, 0xC3, 0x4E, 0x87, 0xFB, 0x15, 0xA7, 0x22, 0xE7, 0xE2, 0x35, 0x06, 0x7B,
-    0xE6, 0x44, 0x78, 0xB8, 0x87, 0x81, 0xEC, 0x38, 0x22, 0x07, 0x77, 0x82, 0xB5, 0x4D, 0x0A, 0x52,
-    0x9C, 0x5A, 0xAE, 0xC0, 0x46, 0xA0, 0xBF, 0x8B, 0x72, 0x82, 0xAE, 0x99, 0x0E, 0x7C, 0x26, 0x0C,
-    0x7A, 0x13, 0xAE, 0xE6, 0x1A, 0x90, 0x5D, 0x0C, 0x91, 0xE3, 0x26, 0xF3, 0xE7, 0x99, 0x1F, 0xF3,
-    0x67, 0x58, 0x74, 0xCE, 0x69, 0xFF, 0x87, 0x4E, 0xE2, 0x7F, 0xEB, 0xC4, 0x9C, 0xC8, 0xCC, 0x1E,
-    0x0A, 0x9E, 0xD9, 0x9F, 0x0E, 0x3C, 0xA5, 0xA4, 0x79, 0x51, 0xC9, 0xD5, 0x2D, 0x6E, 0x14, 0xB2,
-    0x4B, 0x86, 0x19, 0x39, 0x8F, 0xAB, 0xC0, 0xC9, 0x84, 0x80, 0xA4, 0x66, 0x0C, 0x04, 0x2D, 0x44,
-    0x68, 0x3E, 0x12, 0x7F, 0x1E, 0x05, 0x9D, 0xDA, 0x6F, 0xCF, 0x89, 0xB0, 0x0C, 0xC5, 0xC6, 0x94,
-    0x00, 0x5C, 0x67, 0x1E, 0x00, 0x4B, 0x30, 0xF7, 0x35, 0xA5, 0x1A, 0xBB, 0x95, 0x68, 0xD6, 0x7D,
-    0x38, 0x4B, 0x7C, 0x20, 0xD1, 0xA1, 0xF7, 0x97, 0xD1, 0x58, 0x70, 0x6D, 0x34, 0x5B, 0xE7, 0x35,
-    0xFF, 0xFC, 0xB3, 0xD9, 0x17, 0xBD, 0x78, 0xE6, 0x4E, 0xA0, 0x29, 0xC2, 0x9C, 0x2B, 0x93, 0x68,
-    0xC4, 0x99, 0xCB, 0x85, 0xC4, 0x64, 0x60, 0x54, 0x33, 0x08, 0x65, 0x91, 0xCA, 0xFB, 0x83, 0xF3,
-    0x95, 0x35, 0xC4, 0x4F, 0xF0, 0x6F, 0x93, 0xE4, 0x63, 0x30, 0xCC, 0x74, 0xB7, 0x71, 0xF6, 0x88,
-    0xE2, 0x3B, 0x58, 0xF9, 0xA6, 0xA6, 0x49, 0x06, 0x0D, 0x14, 0x20, 0xD3, 0x71, 0x15, 0x33, 0xF5,
-    0xA9, 0x20, 0x7A, 0x24, 0x03, 0x98, 0x27, 0xC0, 0xDE, 0x16, 0x14, 0x29, 0xA1, 0x12, 0x1A, 0x75,
-    0x46, 0x7C, 0x69, 0x43, 0x93, 0x84, 0x52, 0x46, 0x5B, 0xFA, 0xA9, 0x01, 0xEA, 0x94, 0x8A, 0xFA,
-    0x05, 0x50, 0x3A, 0xAD, 0xD1, 0x7D, 0xD3, 0x7F, 0x8A, 0x8E, 0x30, 0xED, 0x81, 0x30, 0x4A, 0x5C,
-    0xD7, 0x60, 0xA0, 0xC1, 0x00, 0x32, 0x65, 0xF2, 0x81, 0x13, 0x57, 0xAA, 0xE5, 0x9C, 0x94, 0x12,
-    0xE7, 0x0C, 0x66, 0x14, 0x3A, 0xE1, 0x11, 0x8A, 0x03, 0xC9, 0x9C, 0x57, 0xD4, 0xB1, 0x10, 0x8D,
-    0x26, 0xA9, 0xAF, 0xA9, 0x5B, 0x20, 0xFC, 0x88, 0x7E, 0x2F, 0x20, 0x02, 0x77, 0x78, 0x01, 0x59,
-    0x18, 0x29, 0xE0, 0xEC, 0xF4, 0x0C, 0x34, 0x51, 0xF0, 0x8E, 0x78, 0xC8, 0xF4, 0xC7, 0x10, 0xCE,
-    0x6D, 0x42, 0x1F, 0x5E, 0x4A, 0xA1, 0x5C, 0xF4, 0x2F, 0x8C, 0xE4, 0xDC, 0x94, 0x68, 0x16, 0x82,
-    0xBA, 0x45, 0x67, 0xC1, 0x4D, 0xB3, 0x45, 0x04, 0x3B, 0x0C, 0x4F, 0xE7, 0x4C, 0x04, 0x25, 0x51,
-    0xF7, 0xA9, 0xEE, 0x44, 0x68, 0x74, 0xC0, 0x2F, 0x58, 0xF5, 0x35, 0xB2, 0x6D, 0x33, 0xB4, 0x68,
-    0xC2, 0x2D, 0xB2, 0xB4, 0x6C, 0x9A, 0xDD, 0x27, 0x9D, 0x17, 0x62, 0x88, 0xB6, 0x84, 0x9B, 0x2E,
-    0x50, 0xF1, 0x82, 0x50, 0x32, 0x6A, 0xF0, 0x98, 0x87, 0xDC, 0x0B, 0x43, 0xF1, 0xFE, 0x50, 0x11,
-    0xFA, 0xA8, 0xF0, 0xE6, 0xBE, 0xC7, 0x9B, 0x06, 0x11, 0xC7, 0xDC, 0xCC, 0x49, 0x36, 0x15, 0x51,
-    0xDE, 0x47, 0x44, 0x4C, 0xB5, 0x38, 0x4A, 0xF8, 0x94, 0xAC, 0x07, 0x4F, 0x15, 0xD4, 0xC7, 0x2E,
-    0x4D, 0xCB, 0xEC, 0x59, 0xD3, 0x8E, 0x6D, 0x0B, 0x0E, 0xE1, 0xBF, 0x51, 0xA2, 0x07, 0xCD, 0x18,
-    0xF5, 0x6D, 0xB2, 0x3B, 0xC7, 0x26, 0x0D, 0xC9, 0x01, 0xB1, 0x24, 0xEF, 0x6E, 0x2F, 0x10, 0x6B,
-    0xC0, 0x92, 0xE6, 0xA3, 0x1D, 0x5C, 0x5A, 0xD8, 0x6B, 0x87, 0x28, 0xB4, 0xC2, 0x70, 0x62, 0xF2,
-    0x1E, 0x8E, 0x07, 0xF6, 0xA5, 0xB8, 0x66, 0x28, 0xC2, 0xFD, 0x2A, 0xC5, 0x4A, 0x64, 0x03, 0xF6,
-    0x5F, 0x29, 0xE8, 0xA5, 0xAE, 0x9F, 0x79, 0xD4, 0xA9, 0x44, 0x0F, 0x87, 0x3B, 0xDE, 0x91, 0xA8,
-    0x18, 0x7E, 0x5D, 0xAD, 0xBD, 0x0B, 0x8E, 0xDE, 0xE9, 0x52, 0x17, 0xB7, 0x9C, 0x73, 0x86, 0xF3,
-    0xAA, 0x1E, 0x33, 0x53, 0xF6, 0x53, 0x9D, 0x9D, 0x71, 0x99, 0xED, 0x6F, 0x6E, 0x24, 0xBB, 0x4D,
-    0x37, 0x55, 0x36, 0x17, 0x83, 0xBA, 0xE1, 0x65, 0x6E, 0x65, 0x5F, 0xD6, 0xF1, 0xA7, 0x9E, 0x7A,
-    0xF7, 0x76, 0x50, 0xF6, 0x66, 0x0D, 0xF5, 0x08, 0xAF, 0x84, 0x82, 0x4B, 0x8C, 0xE3, 0xDC, 0x94,
-    0xAF, 0x23, 0x44, 0x7D, 0x74, 0x8E, 0xB7, 0xA7, 0x7A, 0x79, 0xD8, 0x10, 0xF6, 0x91, 0xF3, 0x89,
-    0xB7, 0x6B, 0x6F, 0x20, 0xB3, 0x03, 0x4E, 0x2F, 0x08, 0xC6, 0xB2, 0x70, 0x78, 0xB4, 0x7F, 0x49,
-    0x77, 0xE7, 0x79, 0x1E, 0xCD, 0xEF, 0x20, 0x76, 0xDE, 0xFB, 0x47, 0x17, 0xCA, 0xC8, 0xDF, 0xD2,
-    0x5B, 0xEF, 0xD6, 0xB2, 0xE8, 0x0B, 0xF0, 0x44, 0xCE, 0x2C, 0x10, 0xDB, 0x31, 0xE5, 0x0D, 0x12,
-    0xEC, 0x40, 0x69, 0x3D, 0x49, 0x6A, 0xF1, 0xF8, 0x16, 0x65, 0x75, 0x03, 0x97, 0x47, 0x8A, 0xC4,
-    0x9B, 0xB5, 0xEC, 0xAC, 0x45, 0x21, 0x8C, 0x5D, 0x7A, 0xFD, 0xC1, 0x2E, 0x3A, 0xFB, 0xD9, 0xE2,
-    0xBC, 0xC3, 0xFD, 0x4B, 0xA6, 0xBB, 0xF7, 0xA4, 0x85, 0x9C, 0x82, 0xA8, 0xFE, 0x19, 0x6C, 0x65,
-    0xC0, 0xE3, 0xCC, 0x39, 0xBD, 0x02, 0xE0, 0x31, 0x74, 0xF4, 0x2F, 0xA1, 0x9F, 0x0F, 0xBD, 0xC8,
-    0x3C, 0x47, 0xC6, 0xCF, 0x74, 0x29, 0xAC, 0x2D, 0xFB, 0x27, 0x6F, 0x9C, 0xC3, 0x08, 0xD9, 0x69,
-    0xD6, 0x63, 0x77, 0x1C, 0xBA, 0xE1, 0x97, 0xF5, 0x4A, 0xE2, 0x7F, 0x1A, 0x3F, 0x3A, 0x09, 0x88,
-    0xDF, 0x49, 0x0D, 0x23, 0xE4, 0x18, 0x5E, 0x3A, 0x03, 0xA7, 0x77, 0x80, 0x86, 0x56, 0xB8, 0x0E,
-    0xAD, 0xC5, 0xF0, 0xBA, 0x7C, 0x58, 0xD2, 0xF0, 0xCF, 0x66, 0xE1, 0x73, 0x77, 0x80, 0xAF, 0xA8,
-    0xDE, 0xC4, 0xDC, 0xF5, 0x7C, 0x43, 0x1C, 0x8A, 0xDE, 0xBD, 0xC9, 0x22, 0x0E, 0x09, 0xE2, 0x30,
-    0x96, 0x85, 0x2C, 0x1C, 0xE1, 0x46, 0x2C, 0xB9, 0x0A, 0xE1, 0x2C, 0xBE, 0xC5, 0x2A, 0xD6, 0xF5,
-    0x30, 0xE0, 0x45, 0xBF, 0x04, 0x9D, 0x8B, 0x0E, 0x03, 0x47, 0x86, 0x5C, 0x41, 0xCF, 0x80, 0x26,
-    0x80, 0xF9, 0xDF, 0xB1, 0x7D, 0x68, 0x1C, 0x19, 0x8D, 0x34, 0xBD, 0x14, 0x22, 0x51, 0x3C, 0xD7,
-    0x06, 0xD8, 0x17, 0xDA, 0x80, 0xFD, 0x7A, 0x80, 0x47, 0x32, 0xFE, 0x39, 0xA0, 0x5F, 0x3C, 0xA7,
-    0x69, 0x14, 0x2E, 0x3F, 0x27, 0x80, 0xE0, 0x45, 0x9E, 0x58, 0x71, 0x05, 0xC8, 0x73, 0x9A, 0xD2,
-    0x8F, 0x0A, 0xFA, 0x23, 0xCE, 0x41, 0x55, 0xCD, 0x6A, 0x6E, 0x12, 0x1B, 0x04, 0x87, 0x0A, 0x50,
-    0x87, 0x1D, 0x5C, 0x06, 0xC5, 0xF8, 0x57, 0x8F, 0xB9, 0xA6, 0x20, 0xCD, 0x67, 0x35, 0x2D, 0x2E,
-    0x46, 0x1F, 0xD3, 0xEF, 0xFD, 0x55, 0x6F, 0xF2, 0x7B, 0xFF, 0xBE, 0x51, 0x4B, 0xDB, 0x05, 0x27,
-    0xA3, 0x33, 0x95, 0x3F, 0x72, 0x90, 0x83, 0xE4, 0xA8, 0xB9, 0x71, 0x52, 0x54, 0xE2, 0xFA, 0xC1,
-    0xF9, 0x02, 0x94, 0x7C, 0xBD, 0x82, 0xAF, 0xE1, 0x7C, 0xC7, 0x88, 0xB7, 0x3F, 0x03, 0x23, 0x3F,
-    0xA1, 0xF6, 0xB0, 0x16, 0x0F, 0x7F, 0x66, 0xFA, 0xBA, 0x4C, 0x70, 0x97, 0x98, 0x60, 0x4A, 0xF3,
-    0xAF, 0x08, 0xB8, 0xBA, 0x40, 0x5C, 0x84, 0xF0, 0x74, 0x85, 0x0D, 0x2A, 0x26, 0x0C, 0x00, 0x47,
-    0x8A, 0xC8, 0xD7, 0xE9, 0xBD, 0x49, 0x56, 0xF4, 0x7A, 0x94, 0xA1, 0xC9, 0x2D, 0x29, 0xC3, 0xE5,
-    0x17, 0x2D, 0x08, 0x78, 0x1E, 0x01, 0x28, 0x23, 0xD7, 0xBD, 0x6C, 0xD3, 0x26, 0xBD, 0x0E, 0x1F,
-    0xA1, 0xF8, 0xBA, 0x27, 0xF9, 0xCB, 0x21, 0x7C, 0xA3, 0x00, 0x41, 0x8E, 0x65, 0x74, 0x02, 0xE2,
-    0x83, 0xD0, 0x62, 0x8E, 0x53, 0x81, 0x13, 0xC5, 0x2C, 0xB1, 0x72, 0x6D, 0x8F, 0xD4, 0xD0, 0x3E,
-    0x97, 0x52, 0x6C, 0x6D, 0x2B, 0xE4, 0xF4, 0xBC, 0x74, 0x47, 0x4F, 0x95, 0xAE, 0xB8, 0xF9, 0x62,
-    0xE9, 0xBA, 0x50, 0xBA, 0x59, 0x10, 0x32, 0x67, 0x2A, 0x15, 0x44, 0x14, 0x1F, 0xA7, 0x99, 0xCD,
-    0xEF, 0xE1, 0xDA, 0x02, 0xAE, 0xDD, 0x0F, 0x5B, 0xC0, 0xAA, 0xFD, 0x06, 0x2F, 0x00, 0xE6, 0xCF,
-    0xD1, 0x01, 0x9B, 0xDD, 0x23, 0x4D, 0x68, 0x51, 0xAE, 0xC3, 0x82, 0x21, 0x3E, 0x0B, 0x75, 0xAA,
-    0x0E, 0xC7, 0x6E, 0x7B, 0xFA, 0x7A, 0xC3, 0x8E, 0xB8, 0x58, 0xBC, 0x8F, 0x4D, 0xDD, 0x13, 0x53,
-    0x9F, 0xDC, 0x9B, 0xFF, 0xD6, 0x31, 0xBF, 0xD2, 0x37, 0x5F, 0xA3, 0x6D, 0xCD, 0x17, 0x2E, 0x10,
-    0x79, 0x74, 0x1C, 0x0E, 0x74, 0x7C, 0x25, 0x40, 0x07, 0x85, 0xFB, 0x60, 0x72, 0xB6, 0x79, 0x06,
-    0xD2, 0xB7, 0x16, 0xAA, 0x0F, 0x37, 0x37, 0xD2, 0x06, 0x75, 0x56, 0xE8, 0xC0, 0x88, 0x72, 0xD8,
-    0x35, 0xC0, 0x92, 0xD8, 0x01, 0x27, 0xC1, 0xFA, 0xB8, 0x14, 0xA1, 0xA9, 0xC8, 0x15, 0xB5, 0xC7,
-    0x7C, 0x85, 0x01, 0x8F, 0x64, 0x06, 0x09, 0xBB, 0x42, 0x3F, 0x46, 0xDC, 0xD3, 0x0F, 0x35, 0xFC,
-    0xDB, 0x8A, 0xBE, 0x88, 0xAB, 0x81, 0x1C, 0xC8, 0xA8, 0x1A, 0x54, 0x65, 0x72, 0xF6, 0xDA, 0x59,
-    0x9B, 0xB5, 0x0E, 0x65, 0x54, 0x6E, 0x2C, 0xD7, 0xF4, 0x95, 0xFE, 0xCA, 0x88, 0x7F, 0x88, 0x2F,
-    0x48, 0x56, 0xD2, 0x21, 0x1A, 0x30, 0x6A, 0x87, 0xFB, 0x8C, 0xA8, 0xE0, 0x82, 0x98, 0x70, 0xC9,
-    0xA4, 0xB8, 0xEF, 0x94, 0x48, 0x78, 0xC4, 0x0E, 0xF6, 0x32, 0xBE, 0x0E, 0x81, 0xE6, 0x8A, 0xD8,
-    0xCD, 0xC8, 0x86, 0x2E, 0x8D, 0x19, 0xEC, 0x58, 0x3D, 0x38, 0x2F, 0x0F, 0x9D, 0x27, 0xF7, 0x9E,
-    0xA1, 0x1B, 0x65, 0xB0, 0xE6, 0xB2, 0x80, 0x43, 0xDB, 0x28, 0x9B, 0x63, 0xEC, 0xF3, 0x11, 0x70,
-    0xDA, 0x35, 0xF4, 0xCB, 0x57, 0x18, 0x06, 0x96, 0xEE, 0xFC, 0x76, 0x03, 0x68, 0x18, 0xBA, 0xC0,
-    0x5E, 0x44, 0xAB, 0xAB, 0x11, 0x18, 0x66, 0xF5, 0x34, 0x8F, 0xC6, 0x01, 0x1D, 0xB1, 0x32, 0x7F,
-    0xF2, 0xC4, 0x00, 0xB9, 0x7E, 0x01, 0x57, 0x0E, 0x7E, 0xC6, 0xB5, 0x67, 0x41, 0x17, 0x23, 0x0E,
-    0x9F, 0x43, 0xD7, 0x34, 0x2C, 0xD2, 0xC0, 0x44, 0x61, 0x74, 0x41, 0x17, 0xFC, 0x1F, 0x33, 0xC6,
-    0x1F, 0x6E, 0xBD, 0xF7, 0xDC, 0xDF, 0x88, 0xA3, 0x2F, 0x99, 0xA3, 0x9F, 0x63, 0x1B, 0xAE, 0x71,
-    0x1B, 0x6D, 0x42, 0xA4, 0x9C, 0x37, 0xD4, 0x68, 0xB6, 0x79, 0x6A, 0x4C, 0x9E, 0x81, 0xE1, 0x00,
-    0x9A, 0x79, 0x5F, 0xFC, 0xEE, 0x37, 0xC8, 0x80, 0x57, 0xEE, 0xFE, 0x17, 0xB5, 0x58, 0x3D, 0x6C,
-    0x1C, 0xC7, 0x15, 0x7E, 0xB3, 0x23, 0x69, 0x23, 0x2E, 0xC4, 0x51, 0x41, 0xC0, 0x81, 0x4D, 0x71,
-    0x1B, 0x17, 0xB2, 0x42, 0xDE, 0x35, 0x02, 0x4C, 0x04, 0x7B, 0x77, 0x1B, 0x0B, 0x88, 0x0B, 0x17,
-    0x62, 0x61, 0x25, 0x9D, 0xD5, 0xA4, 0x48, 0x00, 0x27, 0x52, 0xC1, 0xE2, 0x10, 0xAC, 0xC8, 0x95,
-    0x54, 0xB8, 0x70, 0x61, 0x16, 0x89, 0xDD, 0x0A, 0x81, 0x03, 0x24, 0x94, 0x13, 0xB1, 0x60, 0x82,
-    0x0B, 0x7C, 0xF6, 0x0D, 0xA9, 0x22, 0x45, 0x0A, 0xAF, 0x25, 0x20, 0x42, 0x20, 0x04, 0x59, 0xD9,
-    0x16, 0x02, 0x58, 0x80, 0x35, 0x4E, 0x56, 0xF1, 0x9A, 0xBA, 0xBB, 0xC9, 0xF7, 0x66, 0xF7, 0x48,
-    0x29, 0x30, 0x10, 0x48, 0xB6, 0xF6, 0xB8, 0x07, 0xEE, 0xDC, 0xCC, 0xFB, 0x7F, 0xDF, 0x7B, 0x6F,
-    0xE9, 0x59, 0x1A, 0xE2, 0xF3, 0x23, 0x22, 0x8A, 0x29, 0x13, 0x99, 0xA7, 0x25, 0x3E, 0x7E, 0x1A,
-    0xC4, 0x2A, 0x56, 0x14, 0x52, 0x93, 0xDA, 0xF4, 0x1C, 0xF1, 0x25, 0x53, 0x92, 0x31, 0x35, 0x4B,
-    0x61, 0x4B, 0x3F, 0x27, 0x95, 0xE2, 0x27, 0x6A, 0x11, 0x45, 0x44, 0xC9, 0xE4, 0x0F, 0x8F, 0xCD,
-    0x38, 0x55, 0x56, 0x8B, 0x31, 0x88, 0x91, 0xC8, 0x98, 0x68, 0x75, 0xAD, 0x16, 0xE4, 0xD9, 0x21,
-    0xF9, 0xD9, 0x3E, 0x52, 0x58, 0x53, 0x58, 0x0A, 0x71, 0xCF, 0xE1, 0x6E, 0x10, 0x79, 0xEF, 0xFF,
-    0x96, 0x02, 0x3B, 0x76, 0x44, 0xA8, 0x87, 0xBB, 0xC0, 0x6D, 0xB0, 0x9E, 0x13, 0x05, 0x29, 0x51,
-    0xC7, 0xDA, 0x94, 0x6F, 0xAC, 0x6C, 0x2D, 0xDD, 0xB4, 0x36, 0xF8, 0xB0, 0x88, 0x28, 0xCF, 0xBD,
-    0xAB, 0x71, 0xA0, 0x28, 0x6A, 0xC8, 0xCC, 0xDA, 0xBF, 0x3C, 0xF3, 0x7A, 0x4C, 0xFB, 0x40, 0xD7,
-    0xB4, 0xC0, 0xA1, 0x47, 0x7D, 0x32, 0xAC, 0x49, 0x8B, 0x82, 0x17, 0x72, 0x9A, 0xC3, 0x7A, 0x04,
-    0x9A, 0xF7, 0x53, 0x7A, 0x6A, 0xBC, 0xE4, 0x31, 0x25, 0xE6, 0xDE, 0x25, 0xB2, 0x56, 0xFB, 0xCC,
-    0x18, 0x6A, 0x08, 0x66, 0x06, 0xD9, 0xFE, 0x78, 0xF3, 0xA7, 0xF8, 0xFB, 0x03, 0x98, 0xD1, 0xB7,
-    0xAB, 0xFF, 0x37, 0x9D, 0x0A, 0x81, 0x4D, 0xD5, 0xA7, 0xC6, 0xD7, 0x6E, 0x23, 0x54, 0x0D, 0x0A,
-    0x92, 0x36, 0x95, 0x5B, 0xA5, 0xA7, 0x15, 0x33, 0x6B, 0x89, 0xDC, 0xCF, 0x0D, 0xAD, 0xE6, 0x24,
-    0x86, 0xC4, 0x06, 0xE2, 0x7D, 0x85, 0xFF, 0xE9, 0x90, 0x06, 0x45, 0x6D, 0x85, 0xA4, 0xD5, 0x8D,
-    0xEA, 0x7F, 0xE9, 0x0C, 0xB8, 0xAA, 0x5F, 0x9C, 0x49, 0xA1, 0xA7, 0xAF, 0xA7, 0xE9, 0x94, 0xD4,
-    0x1B, 0xE1, 0xD8, 0x3F, 0x11, 0x17, 0x33, 0xC1, 0x2C, 0xC4, 0x98, 0xDD, 0xC0, 0xCE, 0xE7, 0x53,
-    0x18, 0xE1, 0x33, 0xA9, 0x49, 0xBE, 0x03, 0x0D, 0x0E, 0x9D, 0x05, 0xD7, 0xE3, 0x59, 0x42, 0xDE,
-    0xB6, 0x1E, 0x94, 0xD3, 0x32, 0x3D, 0x16, 0x1B, 0x3F, 0x85, 0x2D, 0xFD, 0x4F, 0x0E, 0x18, 0x12,
-    0x76, 0x34, 0x21, 0x1D, 0xFC, 0x6D, 0xE1, 0xDC, 0xF2, 0xFC, 0xC6, 0x7C, 0xBE, 0x98, 0x1F, 0x37,
-    0xC5, 0xEA, 0xD9, 0x99, 0xC3, 0x14, 0x1F, 0xF6, 0x2F, 0x64, 0xC9, 0x5C, 0xB0, 0x65, 0xFA, 0xA1,
-    0xCC, 0x0A, 0x7F, 0x3B, 0x57, 0x27, 0xF4, 0x5C, 0x10, 0x47, 0x8A, 0x0E, 0xCF, 0xD0, 0xB1, 0xF5,
-    0xF5, 0xD3, 0xD6, 0xE6, 0xCE, 0x22, 0x70, 0x89, 0x5F, 0xC9, 0x7E, 0xFC, 0xD8, 0x6F, 0xEC, 0xAD,
-    0x53, 0x5F, 0x29, 0xEE, 0xFE, 0x97, 0x21, 0x6E, 0x67, 0x04, 0x71, 0x3F, 0xEF, 0x07, 0xB3, 0x52,
-    0x9B, 0xD9, 0x0D, 0x25, 0xF5, 0xF3, 0x69, 0xEB, 0x67, 0xF4, 0x19, 0xD9, 0x5C, 0xBE, 0x23, 0xFF,
-    0x9C, 0x1E, 0x3A, 0xAB, 0x54, 0x7C, 0x3C, 0x8B, 0x42, 0x88, 0x6B, 0x16, 0xA6, 0xE5, 0x85, 0xF8,
-    0xD9, 0xAF, 0x12, 0xF7, 0xD8, 0xFA, 0xAF, 0x1D, 0x6B, 0x6F, 0x2C, 0xFF, 0x7A, 0x2B, 0x9B, 0xDF,
-    0xF0, 0x5F, 0x15, 0xD7, 0x53, 0xB3, 0x5A, 0x88, 0xB5, 0x07, 0x65, 0x71, 0x82, 0x29, 0x6B, 0x6F,
-    0x58, 0x5B, 0x3E, 0x2C, 0x65, 0x97, 0x89, 0x4C, 0x7E, 0x99, 0xA1, 0x41, 0x76, 0x3C, 0x01, 0x0F,
-    0x99, 0x7A, 0xDA, 0xCB, 0xBC, 0x8C, 0x63, 0x40, 0x5A, 0xB3, 0xFE, 0x36, 0x2D, 0xA9, 0xD1, 0xC1,
-    0x10, 0xBF, 0x4C, 0x1F, 0x28, 0xA7, 0x0A, 0xF8, 0x7B, 0x3E, 0x8E, 0x76, 0x0A, 0xE8, 0x43, 0x4A,
-    0x27, 0xBE, 0x5E, 0x24, 0x9C, 0x9D, 0xF1, 0x72, 0x91, 0xAB, 0x38, 0x48, 0x23, 0x6A, 0x09, 0x43,
-    0x90, 0xD6, 0xD7, 0x0D, 0xC4, 0x67, 0x41, 0x05, 0xD3, 0xE1, 0x6C, 0xE8, 0x8B, 0xA1, 0x34, 0x61,
-    0xAE, 0xEE, 0xDF, 0x89, 0xDB, 0xA3, 0x79, 0x51, 0xC7, 0x67, 0xAB, 0x0A, 0x57, 0x38, 0xCA, 0x45,
-    0x34, 0x02, 0xEC, 0xA2, 0xB5, 0x1F, 0xDB, 0xF2, 0x39, 0x3B, 0x9E, 0x1A, 0xD8, 0x0B, 0x57, 0x6C,
-    0x7E, 0xD9, 0x96, 0xC7, 0xF0, 0xB0, 0x6A, 0x2F, 0xBC, 0x61, 0xF3, 0x5F, 0xD9, 0xF2, 0x68, 0x73,
-    0x3C, 0x45, 0x3F, 0xBC, 0x90, 0xD2, 0xA5, 0x4B, 0x74, 0xF4, 0x28, 0x4D, 0x4D, 0x91, 0xF7, 0x15,
-    0x0F, 0x1C, 0x32, 0xC3, 0xE1, 0x61, 0x99, 0x2E, 0x7B, 0xD9, 0xF4, 0x53, 0xD7, 0x11, 0x46, 0x8D,
-    0xF0, 0xFA, 0xEF, 0x3C, 0x1D, 0x61, 0x25, 0x20, 0xA3, 0x08, 0x36, 0x0A, 0xCC, 0x42, 0xB2, 0x3C,
-    0xBB, 0x71, 0x28, 0x9F, 0xCD, 0xE7, 0x37, 0x96, 0x3B, 0xF9, 0x7E, 0xDA, 0xEF, 0x51, 0x34, 0x4D,
-    0xDD, 0x05, 0x32, 0x89, 0x97, 0x17, 0xC1, 0xB6, 0x49, 0xC2, 0x13, 0xBA, 0x68, 0xA9, 0x17, 0xB2,
-    0x42, 0xD4, 0x09, 0x09, 0xED, 0xE6, 0x55, 0x4E, 0x9B, 0xAD, 0x4C, 0xE4, 0x6C, 0x24, 0x0E, 0x61,
-    0xA9, 0x17, 0x60, 0xB6, 0x2E, 0xF9, 0xB1, 0x89, 0x02, 0xA9, 0x87, 0x2A, 0x78, 0x61, 0x38, 0x35,
-    0xE7, 0x77, 0x29, 0x3A, 0xB2, 0x4C, 0x66, 0x71, 0xC3, 0xCB, 0xEE, 0x15, 0xFE, 0x79, 0x3B, 0x52,
-    0x30, 0xFB, 0x3C, 0x92, 0x7B, 0x99, 0x44, 0xEA, 0x88, 0x85, 0x84, 0xE3, 0x20, 0x26, 0xFF, 0x0E,
-    0xED, 0x99, 0x1A, 0xCD, 0xC3, 0x1A, 0x4C, 0x8E, 0x16, 0xFD, 0xF3, 0xB1, 0x1F, 0xFF, 0xCB, 0xC6,
-    0x1B, 0xF3, 0xC7, 0x13, 0xE5, 0xC7, 0x9E, 0xBE, 0x94, 0xC3, 0xF6, 0x11, 0x12, 0x2D, 0x88, 0xD9,
-    0xDA, 0xB4, 0x89, 0x87, 0x05, 0xB8, 0x45, 0xF1, 0x49, 0x6B, 0xBA, 0x88, 0x07, 0xA2, 0x25, 0x50,
-    0x1D, 0x20, 0x6D, 0x0F, 0xB2, 0x54, 0xB4, 0x81, 0x8F, 0xA2, 0x23, 0xF4, 0x9D, 0x54, 0xA6, 0x07,
-    0x4A, 0x90, 0xF6, 0x32, 0x90, 0x3E, 0xE2, 0x9F, 0x37, 0x5E, 0x66, 0x56, 0xDE, 0x2F, 0x23, 0x75,
-    0xED, 0x4F, 0xC1, 0x89, 0x77, 0x20, 0xD6, 0xBF, 0x35, 0x45, 0xF3, 0x8B, 0xA4, 0xFC, 0xB7, 0xD6,
-    0x3C, 0x60, 0x02, 0x62, 0x23, 0x60, 0xA8, 0x41, 0x72, 0xD2, 0x41, 0x28, 0xBD, 0x46, 0x1D, 0x92,
-    0x39, 0x1D, 0x65, 0xA1, 0x0F, 0x43, 0x4F, 0x90, 0x6A, 0xC0, 0xFD, 0x7E, 0x2E, 0x0A, 0xB8, 0x10,
-    0x99, 0xDD, 0xE3, 0xAF, 0x95, 0x03, 0xDB, 0x76, 0x78, 0xE0, 0xCB, 0x3A, 0xEE, 0x7B, 0x95, 0x6B,
-    0xD9, 0xD3, 0x42, 0x57, 0x4B, 0x25, 0x62, 0x0F, 0x4B, 0x1D, 0x4D, 0xDE, 0x5D, 0x84, 0x0F, 0xF2,
-    0xB4, 0x07, 0x28, 0xD8, 0xCE, 0xA8, 0x11, 0xA4, 0xC2, 0x20, 0x4C, 0xD3, 0x84, 0x56, 0xD6, 0x8D,
-    0x04, 0xB6, 0x84, 0xA7, 0x4E, 0x23, 0x7A, 0x5A, 0x81, 0xA6, 0xA2, 0x45, 0xDE, 0x47, 0x86, 0x82,
-    0x37, 0x62, 0x07, 0x3D, 0x7C, 0xB5, 0x2A, 0xA0, 0xF3, 0x00, 0x93, 0x7E, 0x8D, 0x93, 0x40, 0x0D,
-    0x0A, 0xB5, 0xA3, 0x4D, 0xEF, 0xE2, 0x86, 0x42, 0xDE, 0xC7, 0x99, 0x23, 0x1E, 0x5C, 0xC8, 0x29,
-    0x84, 0x18, 0x6D, 0xF8, 0x0E, 0xD4, 0x81, 0x5C, 0x46, 0xDC, 0x3B, 0x65, 0x64, 0x46, 0x05, 0x93,
-    0x07, 0xAA, 0xF6, 0x80, 0xC8, 0xBD, 0x56, 0x05, 0xA2, 0xB8, 0x80, 0xD2, 0x14, 0x42, 0xCE, 0x04,
-    0xB1, 0x9D, 0xCF, 0x7E, 0xB3, 0xF4, 0xF7, 0x09, 0xD0, 0xC9, 0x33, 0x9A, 0x1E, 0x00, 0x0E, 0xD8,
-    0x36, 0xAE, 0x42, 0xB0, 0x8D, 0x00, 0x7D, 0x64, 0xA9, 0xA2, 0x1E, 0x81, 0x7B, 0x03, 0x07, 0x14,
-    0xF0, 0x8C, 0xC9, 0xFB, 0xBA, 0x8B, 0x4D, 0x21, 0x89, 0x9D, 0xCB, 0x9A, 0xE9, 0xD3, 0xB9, 0x53,
-    0x09, 0x31, 0x5C, 0x37, 0x49, 0x66, 0xCC, 0x00, 0x8C, 0x00, 0xE6, 0xEC, 0x04, 0x77, 0x45, 0x0B,
-    0x0C, 0x99, 0xB4, 0x7B, 0x7D, 0x53, 0xD2, 0x8B, 0xB8, 0xF2, 0xDE, 0xC5, 0x94, 0xA6, 0xA7, 0x10,
-    0x49, 0x9B, 0x5C, 0xB7, 0x76, 0x55, 0x60, 0x0E, 0xD0, 0x20, 0xE8, 0x3B, 0x05, 0x98, 0x01, 0xCB,
-    0xDF, 0x6B, 0x38, 0xF1, 0x41, 0x9F, 0xA5, 0x07, 0xDE, 0xB0, 0xF0, 0x4C, 0x9E, 0x65, 0x2F, 0x28,
-    0x78, 0x5D, 0x3B, 0x55, 0x99, 0xBA, 0x65, 0x68, 0x93, 0xEE, 0x3B, 0xF8, 0x80, 0xE9, 0x2A, 0x2E,
-    0x77, 0xD4, 0x76, 0x7E, 0x4F, 0x1A, 0xFC, 0x5D, 0xB0, 0x56, 0x5E, 0xDE, 0x3A, 0x15, 0x83, 0xEA,
-    0xAA, 0x05, 0x8B, 0x78, 0x65, 0x1D, 0x25, 0x75, 0xBD, 0xE4, 0x5A, 0x69, 0xB9, 0x5E, 0x7C, 0xF9,
-    0x03, 0x2E, 0x80, 0x46, 0x30, 0xAE, 0x64, 0x9E, 0x61, 0xED, 0xB9, 0x1C, 0x86, 0x4C, 0x19, 0x46,
-    0xE3, 0xEF, 0x49, 0x59, 0xE2, 0x82, 0xD6, 0x49, 0xBF, 0xC5, 0x9B, 0xC2, 0xB8, 0x8A, 0x4F, 0xE8,
-    0xD0, 0xAC, 0xC2, 0x0B, 0x32, 0xBA, 0x72, 0x1B, 0xD5, 0x8F, 0x0C, 0x59, 0x9A, 0x51, 0x0F, 0x9B,
-    0xEF, 0x97, 0x14, 0x82, 0x39, 0xEA, 0x3A, 0x72, 0x90, 0xE8, 0x1C, 0xEE, 0x65, 0xA2, 0xA7, 0x50,
-    0xE2, 0x46, 0x7B, 0x2E, 0x8D, 0xAA, 0xF0, 0xDC, 0xA8, 0x70, 0xB6, 0x44, 0xB9, 0x64, 0x39, 0x0A,
-    0xF7, 0x43, 0xE8, 0xF0, 0x4F, 0xDE, 0x7E, 0x19, 0x06, 0x4F, 0xDB, 0xEB, 0x6B, 0xF5, 0x73, 0xE6,
-    0x72, 0xA6, 0xFE, 0xDD, 0x8E, 0x76, 0x65, 0xF5, 0x33, 0xFE, 0x0D, 0x7F, 0x55, 0x2A, 0x7D, 0x4D,
-    0x6A, 0x10, 0x77, 0x55, 0x53, 0xB7, 0x4B, 0xCB, 0xFE, 0xD7, 0xA7, 0xE6, 0x5F, 0xD4, 0x02, 0xD5,
-    0xBB, 0xBA, 0x3A, 0x36, 0x0F, 0x6D, 0xB9, 0xB7, 0x3B, 0x71, 0x5D, 0x8A, 0xFA, 0xE5, 0x92, 0x44,
-    0xAF, 0xB0, 0xB3, 0x1E, 0xD7, 0xCF, 0xB1, 0x43, 0xFC, 0xEA, 0xF7, 0xA6, 0x2D, 0x94, 0x1D, 0x4E,
-    0x20, 0xC3, 0x30, 0x60, 0x38, 0x25, 0x03, 0x1B, 0x87, 0x25, 0x3B, 0x20, 0xE1, 0x6E, 0x06, 0x47,
-    0x22, 0x06, 0x5F, 0xD4, 0xAE, 0x06, 0xCB, 0x89, 0xF3, 0x21, 0x1F, 0x00, 0x1F, 0xC0, 0xEA, 0xFB,
-    0x71, 0x68, 0x77, 0xA1, 0xA1, 0x60, 0x60, 0xA8, 0x70, 0x01, 0xFD, 0x03, 0xBA, 0x0A, 0xE5, 0x44,
-    0x6E, 0x3C, 0xD0, 0x75, 0x75, 0x1D, 0xAF, 0xC2, 0xB1, 0x33, 0x4C, 0x9E, 0x8D, 0xAB, 0xE9, 0x99,
-    0x4F, 0x68, 0x75, 0x38, 0x81, 0x00, 0x65, 0x28, 0x41, 0xAF, 0x74, 0xE4, 0x6B, 0xD1, 0x41, 0x22,
-    0xEE, 0xE6, 0xE1, 0xE3, 0x11, 0xE9, 0xEC, 0x70, 0x5C, 0xE7, 0xD4, 0xF3, 0x4B, 0xEC, 0x41, 0x73,
-    0xE6, 0x32, 0xB5, 0x89, 0x6D, 0x68, 0x47, 0x28, 0x6C, 0x5A, 0xDD, 0xEC, 0x58, 0xDD, 0x40, 0xDC,
-    0xB6, 0x61, 0xF6, 0x04, 0x76, 0x1A, 0xA2, 0x22, 0x14, 0x8A, 0x02, 0xE0, 0xC5, 0x6A, 0xDA, 0x44,
-    0x32, 0x75, 0xEC, 0x1A, 0xE3, 0xF6, 0x3E, 0x10, 0xBA, 0x18, 0xD3, 0x77, 0xAD, 0xA6, 0xD9, 0x20,
-    0xAD, 0x03, 0x41, 0xE4, 0xCD, 0x14, 0xF0, 0x61, 0xA8, 0x25, 0x47, 0x90, 0xED, 0x0B, 0x8D, 0x5C,
-    0x35, 0x22, 0x6F, 0x34, 0x68, 0x53, 0xBD, 0xA8, 0x5B, 0x52, 0x83, 0x92, 0x01, 0xF5, 0xAE, 0xDC,
-    0xCE, 0x17, 0xA8, 0xD8, 0x54, 0xF1, 0x5C, 0x84, 0x92, 0xFE, 0x01, 0x64, 0x78, 0x17, 0x59, 0x1D,
-    0x62, 0x51, 0x62, 0x0B, 0x04, 0xAB, 0x2E, 0x4E, 0x52, 0xF6, 0xAD, 0xEB, 0x2E, 0xFC, 0x49, 0x0F,
-    0x5B, 0x72, 0xBF, 0x98, 0xD1, 0xC8, 0xB5, 0xCC, 0x2A, 0xED, 0x23, 0x3D, 0x59, 0xFD, 0x90, 0x11,
-    0x0E, 0xB1, 0x72, 0x95, 0x83, 0x05, 0x06, 0x80, 0xBD, 0xA9, 0x09, 0x62, 0xEA, 0x22, 0x1C, 0x98,
-    0x95, 0x24, 0x4D, 0x13, 0x3B, 0xA5, 0xF1, 0x60, 0xB9, 0xBB, 0xDC, 0x07, 0xE7, 0xF4, 0xE0, 0xD5,
-    0xAA, 0x6F, 0xCE, 0xC0, 0x23, 0x4F, 0x94, 0x15, 0x57, 0x04, 0x1F, 0xCE, 0xF0, 0xAF, 0x82, 0x44,
-    0x7A, 0xF6, 0x49, 0xB1, 0x7A, 0xC8, 0x45, 0x7E, 0xE5, 0x22, 0x81, 0x9F, 0x91, 0x6A, 0xB1, 0x2C,
-    0x24, 0xCE, 0x50, 0x1B, 0x58, 0x15, 0x68, 0x0E, 0x16, 0x44, 0x4E, 0xC4, 0xB9, 0xC4, 0xC9, 0x04,
-    0x56, 0xC2, 0x20, 0x9D, 0xFA, 0x60, 0xD5, 0xC6, 0x42, 0x78, 0x02, 0x81, 0xA6, 0xFB, 0xD8, 0xA9,
-    0x74, 0x90, 0x09, 0x3B, 0xC8, 0x18, 0xED, 0x1E, 0x50, 0xC8, 0x9D, 0x0C, 0xE2, 0xDD, 0xE7, 0x27,
-    0xC0, 0x65, 0x99, 0x16, 0xCF, 0x51, 0x89, 0x3D, 0xFE, 0x3F, 0x52, 0x81, 0x1E, 0x78, 0x44, 0xF2,
-    0x6E, 0xAC, 0x5E, 0xCB, 0xDA, 0xA2, 0xE8, 0x51, 0x72, 0x18, 0x7D, 0x04, 0x50, 0x1A, 0x8C, 0x3F,
-    0xCA, 0xC1, 0xD8, 0xD4, 0x8C, 0xC7, 0x60, 0x6C, 0xC1, 0xB8, 0x07, 0xC6, 0x09, 0x18, 0x27, 0x60,
-    0xDC, 0x02, 0x63, 0x74, 0x95, 0xA6, 0x01, 0xC6, 0x21, 0x18, 0x9F, 0x06, 0x63, 0x50, 0xD2, 0x83,
-    0xB8, 0x62, 0xEC, 0x83, 0xB1, 0x7F, 0x13, 0x8C, 0xD7, 0x1E, 0x8A, 0x0E, 0x87, 0xDB, 0x2E, 0xCE,
-    0x19, 0x9C, 0x0E, 0x55, 0x6B, 0x68, 0x32, 0x0D, 0xA7, 0x09, 0x52, 0xA7, 0x81, 0xF5, 0x00, 0x80,
-    0x24, 0x33, 0xE8, 0x67, 0xA0, 0x4E, 0x82, 0xB8, 0xE5, 0x45, 0xC5, 0x8B, 0x7A, 0x77, 0x31, 0xAB,
-    0x17, 0x31, 0x10, 0x69, 0x7C, 0x32, 0xAA, 0xF4, 0xCC, 0x1E, 0xE2, 0xC5, 0xE1, 0x9F, 0xD4, 0x3C,
-    0x17, 0x9F, 0x28, 0x2B, 0x2E, 0x3F, 0x01, 0x22, 0x2F, 0x38, 0x89, 0x9B, 0x2E, 0x3D, 0x49, 0x56,
-    0x9B, 0xD0, 0x66, 0x41, 0xED, 0x3D, 0x77, 0x1D, 0x01, 0xC1, 0x04, 0x7A, 0xA0, 0xBA, 0x20, 0x8C,
-    0x1B, 0x18, 0x79, 0x56, 0xC4, 0x22, 0xB9, 0x45, 0x6E, 0xFF, 0x15, 0xED, 0x2E, 0x56, 0x3B, 0x5B,
-    0x40, 0xAE, 0x26, 0x7F, 0x62, 0x39, 0xB6, 0x18, 0x85, 0x6D, 0xFC, 0x50, 0x6B, 0xC2, 0xE5, 0x17,
-    0x70, 0x31, 0x5D, 0xD7, 0x80, 0xE0, 0x35, 0x2D, 0x0C, 0x06, 0x09, 0x99, 0x05, 0x69, 0x03, 0x5D,
-    0x03, 0xCF, 0xA5, 0xD0, 0xEE, 0x1E, 0x14, 0x7B, 0x0F, 0xF9, 0x81, 0xCC, 0x32, 0x2E, 0xEF, 0x19,
-    0x66, 0x12, 0x37, 0xCD, 0x30, 0x7E, 0xF2, 0x70, 0x6C, 0x2A, 0x67, 0x77, 0xAB, 0x22, 0xB3, 0x13,
-    0x4B, 0x3B, 0x12, 0x26, 0xD4, 0x3D, 0xEE, 0x1A, 0xDA, 0xE8, 0x94, 0x2F, 0x6A, 0xF9, 0xA1, 0xF1,
-    0x4C, 0xCF, 0x2B, 0x3A, 0xB6, 0x54, 0x98, 0xB6, 0x34, 0x23, 0x2E, 0x9F, 0x7E, 0xA0, 0x57, 0xC2,
-    0xC0, 0x4D, 0xCD, 0xBB, 0xDC, 0x4B, 0x71, 0xA1, 0x71, 0xEA, 0xB4, 0xB1, 0xCD, 0x75, 0x58, 0x68,
-    0xCE, 0x91, 0xC0, 0x2E, 0x23, 0x7C, 0x4E, 0x6F, 0x6E, 0x8D, 0x82, 0x18, 0x25, 0xBF, 0xF0, 0x78,
-    0x9F, 0x82, 0xE0, 0x10, 0x89, 0x1B, 0x1E, 0x18, 0xB8, 0xA4, 0xE8, 0xE7, 0x03, 0x64, 0x0D, 0x22,
-    0x33, 0x99, 0x84, 0x62, 0x51, 0x8F, 0xEF, 0x1D, 0x1C, 0x96, 0x93, 0xE1, 0x36, 0xA8, 0x6A, 0xE1,
-    0xF4, 0xA4, 0x51, 0x16, 0x97, 0x66, 0x7C, 0xFB, 0x8A, 0x7F, 0x7B, 0x70, 0x22, 0x53, 0xDB, 0x90,
-    0x17, 0xE9, 0x00, 0xA2, 0x68, 0xB8, 0x5F, 0x4A, 0xC1, 0x55, 0x9A, 0x9E, 0x28, 0x9B, 0x62, 0x24,
-    0xEF, 0xDF, 0xA4, 0xD5, 0xEB, 0xFA, 0x41, 0x43, 0xE2, 0x2F, 0x70, 0x2F, 0x1B, 0x1E, 0x9B, 0x08,
-    0x43, 0x1A, 0xBA, 0x7B, 0x53, 0xD7, 0xBD, 0x47, 0x27, 0xB2, 0x8F, 0x62, 0xB4, 0xB7, 0x6A, 0xD5,
-    0xC8, 0xAA, 0xB9, 0x3D, 0x90, 0x2E, 0x85, 0xA3, 0x6E, 0xF8, 0xE6, 0x48, 0xC5, 0x1D, 0xC4, 0xD9,
-    0xD5, 0xCC, 0xBB, 0x65, 0xA8, 0xD7, 0xA3, 0x56, 0x83, 0x42, 0x15, 0xAB, 0x6D, 0x4C, 0xFE, 0x7D,
-    0xBF, 0x50, 0x77, 0x5F, 0x15, 0xF6, 0xE4, 0xAE, 0x26, 0x41, 0xCA, 0x9D, 0x69, 0x75, 0x3D, 0x32,
-    0x01, 0xF4, 0xA8, 0x72, 0x48, 0xDE, 0x55, 0x37, 0x07, 0xCE, 0x6D, 0x92, 0xA8, 0xCC, 0xFC, 0xE3,
-    0xFD, 0xC2, 0xDE, 0x38, 0xFF, 0xE5, 0x99, 0x0C, 0x40, 0xD3, 0xA7, 0x7E, 0x0B, 0x03, 0x21, 0x7A,
-    0xCF, 0x54, 0x5E, 0xCB, 0x05, 0xD4, 0x1A, 0x36, 0x68, 0x25, 0xD0, 0xAB, 0xF1, 0xF8, 0x3F, 0x3A,
-    0x2C, 0xAA, 0x66, 0xE6, 0x98, 0x98, 0x4A, 0x7D, 0xDB, 0xB6, 0xD9, 0xCA, 0x2B, 0xE3, 0x97, 0xAE,
-    0x66, 0x61, 0x1E, 0x36, 0x30, 0x05, 0x25, 0x18, 0x69, 0xFD, 0x1B, 0x5A, 0xDE, 0x19, 0x81, 0xBF,
-    0x4D, 0x7B, 0xB0, 0x98, 0xCC, 0xDC, 0x6B, 0x1D, 0xF4, 0xC5, 0x4D, 0xCF, 0xC6, 0x87, 0x3B, 0xEF,
-    0xD9, 0x3B, 0xD9, 0xEA, 0x6B, 0xE1, 0xB8, 0x56, 0xE0, 0xE9, 0x35, 0x1F, 0x34, 0xBE, 0x8F, 0x80,
-    0x68, 0x93, 0x7B, 0x07, 0x50, 0x37, 0x30, 0x19, 0xFB, 0x0A, 0xB1, 0xD0, 0xB9, 0x9C, 0x36, 0x47,
-    0x34, 0x5B, 0x97, 0x7F, 0xA9, 0xC5, 0x19, 0x94, 0x6E, 0x77, 0xB2, 0x6A, 0x06, 0x74, 0xE5, 0x50,
-    0xF1, 0x36, 0xDA, 0x01, 0xFF, 0x56, 0xD9, 0x12, 0x1F, 0xE5, 0xC1, 0x1B, 0xD4, 0x5F, 0x19, 0x5C,
-    0x43, 0x0C, 0xA7, 0x1C, 0xB9, 0x3D, 0x1C, 0x14, 0x72, 0xA7, 0xFF, 0x40, 0x25, 0xE9, 0x57, 0xB4,
-    0xEA, 0x9C, 0x7A, 0x3A, 0x16, 0xD6, 0xE0, 0xAC, 0x8A, 0xBB, 0x0D, 0xEA, 0x45, 0x9E, 0x59, 0x19,
-    0x64, 0x83, 0x31, 0x3B, 0xBB, 0x70, 0xD1, 0x9F, 0x50, 0xDC, 0xB9, 0xAC, 0xF7, 0xB0, 0xBB, 0x43,
-    0xDE, 0x98, 0x16, 0x22, 0x4F, 0x1F, 0x7D, 0x44, 0xC6, 0x18, 0x2B, 0x55, 0x5D, 0xB7, 0xE8, 0x27,
-    0xB0, 0x8F, 0x28, 0x57, 0xC0, 0xB3, 0xE7, 0x7D, 0xAC, 0x9B, 0xE1, 0x95, 0x62, 0x30, 0x96, 0xAE,
-    0x91, 0x6B, 0x38, 0x8E, 0xE3, 0x2B, 0x34, 0x28, 0xEB, 0x31, 0xB8, 0x05, 0xE0, 0x44, 0xFF, 0xBC,
-    0x1F, 0x68, 0x91, 0x29, 0x4A, 0x44, 0x1E, 0xA4, 0x2D, 0x32, 0x9C, 0x81, 0x85, 0xD4, 0xAA, 0xEA,
-    0xA7, 0xDD, 0xD0, 0xCB, 0x7C, 0xF6, 0xC3, 0x70, 0xB0, 0x1E, 0x67, 0xDA, 0xDC, 0xDE, 0xBF, 0x08,
-    0xCA, 0x18, 0x0A, 0x9B, 0x4A, 0xFE, 0x4E, 0xD6, 0x8A, 0x8E, 0xB2, 0xDD, 0xFE, 0xEF, 0x66, 0xB9,
-    0x95, 0x9B, 0xEA, 0x35, 0xD5, 0x4C, 0xBD, 0x0C, 0xCB, 0x75, 0xF7, 0xFE, 0xED, 0xF1, 0x9C, 0x55,
-    0xB5, 0x34, 0xD8, 0x1C, 0xAF, 0x89, 0x9D, 0x82, 0x30, 0xB3, 0x87, 0x05, 0x85, 0x27, 0x49, 0xF0,
-    0x08, 0xDA, 0xA5, 0xDF, 0x9F, 0x14, 0xF6, 0x8B, 0xAD, 0x32, 0xE0, 0x40, 0x4A, 0xA8, 0xD9, 0xE0,
-    0x61, 0x55, 0x5E, 0xCF, 0xB8, 0xFA, 0x03, 0x21, 0x12, 0xB9, 0x83, 0x1E, 0xAC, 0xAC, 0x0B, 0x2D,
-    0xEA, 0xDE, 0x78, 0x9A, 0x16, 0xAC, 0x96, 0xDF, 0x73, 0x6C, 0x67, 0xA6, 0xD6, 0xBC, 0x1B, 0x36,
-    0x6E, 0xDF, 0x1B, 0xCA, 0xD2, 0xD7, 0x2B, 0x94, 0x04, 0x68, 0xC1, 0x4A, 0xEA, 0x21, 0xB6, 0x53,
-    0x43, 0x45, 0x48, 0xA1, 0x97, 0x73, 0x5F, 0x81, 0xF1, 0x4E, 0x66, 0x09, 0x45, 0x93, 0xCE, 0x27,
-    0x74, 0xEF, 0xDC, 0xBC, 0x74, 0xE2, 0xDF, 0x22, 0xB8, 0xDD, 0x0F, 0xE3, 0x76, 0x9B, 0xC2, 0x88,
-    0xC2, 0x84, 0xC2, 0x1E, 0x35, 0x0A, 0x6A, 0x17, 0x14, 0xF5, 0x90, 0xB3, 0xC2, 0x34, 0xAF, 0x64,
-    0xC1, 0x98, 0xFE, 0x37, 0x3C, 0xA6, 0xE8, 0x71, 0x8E, 0x03, 0xAF, 0x9A, 0x30, 0xCC, 0xA6, 0xC8,
-    0xE6, 0x1F, 0xF9, 0xF8, 0x8C, 0xA0, 0xE6, 0x35, 0x3D, 0x37, 0xC8, 0xA6, 0xBC, 0x0A, 0x1F, 0xD6,
-    0x10, 0x26, 0x71, 0xF3, 0x4D, 0x83, 0xD3, 0x0A, 0xA0, 0xA2, 0xC5, 0xE7, 0x70, 0x50, 0x8F, 0x47,
-    0x42, 0x05, 0x23, 0x6E, 0xC3, 0xED, 0x38, 0x1F, 0xDC, 0x29, 0xF8, 0xB5, 0xC6, 0xE4, 0xCD, 0x42,
-    0xE4, 0x4A, 0xD3, 0xA3, 0xCB, 0x7E, 0xD0, 0xC9, 0xCE, 0xE5, 0x86, 0x9B, 0x0F, 0x9A, 0x5A, 0x5F,
-    0x7F, 0x8B, 0xDF, 0x7D, 0xD5, 0x3D, 0x5E, 0x55, 0x58, 0xBA, 0x75, 0xF4, 0xCE, 0xA2, 0xEB, 0x4E,
-    0x9B, 0x6F, 0x16, 0xBE, 0xEE, 0xA4, 0x45, 0xD0, 0x57, 0xE2, 0x9F, 0x5B, 0x79, 0x92, 0x2C, 0x28,
-    0xFF, 0xE2, 0x75, 0xBD, 0xD9, 0xDA, 0x54, 0x1E, 0x06, 0xA6, 0x50, 0x27, 0x34, 0x1E, 0xC4, 0x6D,
-    0x0C, 0x92, 0x75, 0x45, 0xE3, 0xF1, 0xB1, 0xA8, 0xC6, 0x46, 0x07, 0x60, 0x4B, 0x34, 0x03, 0xD7,
-    0xA1, 0x32, 0x9C, 0xD0, 0x72, 0x0B, 0xA5, 0xAC, 0x47, 0xDD, 0xEA, 0xF9, 0x45, 0xED, 0x6F, 0xE5,
-    0x13, 0x00, 0xF5, 0x01, 0xA0, 0x83, 0x87, 0xA1, 0x1C, 0xD8, 0xC0, 0x02, 0xA5, 0x8F, 0x4F, 0x64,
-    0xE8, 0xA0, 0x1C, 0x60, 0x76, 0xE9, 0xD0, 0x63, 0x13, 0x41, 0x32, 0xC3, 0x05, 0x34, 0xC1, 0xD5,
-    0xA5, 0x82, 0x6D, 0xDF, 0xC2, 0x21, 0x5F, 0xFB, 0xDB, 0xC8, 0xC7, 0xEA, 0x19, 0x31, 0xEA, 0xA7,
-    0x13, 0x24, 0x0E, 0xEF, 0xBE, 0xEA, 0xED, 0x41, 0x39, 0x39, 0x9B, 0x72, 0x81, 0x0B, 0xF7, 0x3A,
-    0xA3, 0x25, 0x4E, 0x74, 0xC4, 0x30, 0xDA, 0x40, 0x7C, 0xE0, 0x27, 0x78, 0x04, 0x43, 0x05, 0x45,
-    0x50, 0x1A, 0xC4, 0x69, 0x01, 0x00, 0x71, 0x04, 0x0E, 0x06, 0x78, 0xD3, 0x34, 0xCF, 0xEF, 0x59,
-    0xD5, 0xF6, 0x70, 0x89, 0x6F, 0xD6, 0x4D, 0x16, 0xBC, 0xB6, 0x6A, 0x5C, 0x37, 0x50, 0x91, 0xEE,
-    0x3D, 0x34, 0xAF, 0x8B, 0xFC, 0xC7, 0x14, 0x9C, 0x1E, 0x52, 0xFB, 0xF6, 0x10, 0x7D, 0xA7, 0xF1,
-    0x73, 0x7E, 0x07, 0xC9, 0x6D, 0x49, 0x24, 0x33, 0x6E, 0x55, 0x02, 0x38, 0xAE, 0xC5, 0xAF, 0x08,
-    0x54, 0x1E, 0xC6, 0x2D, 0x0C, 0xF3, 0x9F, 0xDB, 0x98, 0x5D, 0xD7, 0xA8, 0x47, 0x7D, 0x5D, 0x51,
-    0xEA, 0xEE, 0x2A, 0xF1, 0xA1, 0x61, 0xA0, 0xD8, 0x55, 0xEA, 0x1B, 0xD6, 0xE0, 0xBF, 0xB5, 0x5A,
-    0x4F, 0x8C, 0xDC, 0xD6, 0x7D, 0xFE, 0x91, 0xDC, 0x35, 0x9D, 0x12, 0xD1, 0xD3, 0x41, 0x6E, 0x0C,
-    0x39, 0x5A, 0xFA, 0xE8, 0x1A, 0xDA, 0xE1, 0xC5, 0x87, 0x3D, 0x90, 0x33, 0x94, 0x5D, 0xF4, 0xE2,
-    0x43, 0xF6, 0x20, 0x9D, 0x02, 0xC4, 0x3D, 0x3A, 0x41, 0x60, 0x1B, 0x85, 0x0E, 0x53, 0x60, 0xB4,
-    0x43, 0x45, 0x07, 0x1D, 0x04, 0xD4, 0x3A, 0xB4, 0xB9, 0xC6, 0x07, 0x1F, 0x62, 0x09, 0x88, 0x54,
-    0x60, 0x0F, 0x4C, 0xBD, 0xF2, 0x50, 0xD2, 0xC1, 0x07, 0x1F, 0x4A, 0xC7, 0x2D, 0x7C, 0x08, 0xD0,
-    0xD0, 0xB1, 0x8C, 0x22, 0x2E, 0xD0, 0x65, 0x1C, 0x2A, 0x1E, 0xAD, 0x76, 0xE6, 0xF5, 0xFB, 0xDE,
-    0x23, 0x67, 0x77, 0xB5, 0x76, 0x5B, 0x39, 0x9B, 0x95, 0x46, 0x5A, 0x3E, 0x92, 0xEF, 0x7D, 0xEF,
-    0xF7, 0xF7, 0xFB, 0xFD, 0xDE, 0x88, 0x8C, 0x67, 0x22, 0x93, 0x5D, 0x31, 0x3F, 0x2A, 0x13, 0x09,
-    0x0B, 0x91, 0x01, 0x3E, 0xEF, 0xE2, 0xF3, 0x87, 0x42, 0xDC, 0x4F, 0x4B, 0xF1, 0xEE, 0x94, 0x12,
-    0xFC, 0xA4, 0x92, 0xD0, 0xA9, 0xA4, 0xEF, 0xD4, 0xB2, 0x71, 0xAD, 0x16, 0xAD, 0x6B, 0xE7, 0xFE,
-    0xB9, 0xDA, 0x2B, 0xA5, 0x09, 0x0A, 0x69, 0x54, 0x2A, 0x79, 0x24, 0x92, 0x27, 0x22, 0x23, 0x4E,
-    0x19, 0x6A, 0x33, 0xE1, 0xAB, 0xCB, 0x8E, 0xFE, 0xF8, 0xE2, 0x83, 0xD7, 0xCB, 0xC6, 0xAB, 0xB7,
-    0x64, 0x2B, 0x91, 0x5E, 0x28, 0xC1, 0x95, 0xCC, 0xFB, 0x55, 0xE5, 0xD4, 0x8D, 0xEC, 0xF6, 0x64,
-    0x23, 0x28, 0xC6, 0xE9, 0xFC, 0x8F, 0x45, 0xD8, 0xD4, 0x16, 0xC2, 0xF1, 0x65, 0x91, 0xF3, 0xA7,
-    0x00, 0x01, 0x90, 0x82, 0xEA, 0x48, 0x61, 0x3D, 0xBB, 0x2C, 0xDF, 0xF6, 0x33, 0x4F, 0x17, 0x12,
-    0x65, 0x9C, 0xF6, 0x89, 0x6C, 0x3D, 0x9C, 0x0D, 0xC3, 0x9F, 0xCE, 0x54, 0x3A, 0x08, 0x8A, 0xE0,
-    0x6E, 0xE9, 0x7E, 0x52, 0x4B, 0x9E, 0x4B, 0xD2, 0x93, 0x50, 0xA5, 0xEA, 0x4E, 0xE5, 0x57, 0x5B,
-    0x7E, 0xA3, 0xB6, 0x7F, 0xEC, 0xE8, 0xEF, 0xED, 0x01, 0x19, 0x8B, 0x78, 0xC0, 0xD6, 0xAB, 0x0D,
-    0x8E, 0xE0, 0xCD, 0x54, 0xE2, 0x55, 0x71, 0xAB, 0xDC, 0xC0, 0x98, 0xFA, 0x85, 0xFF, 0xF9, 0x0D,
-    0x19, 0xE8, 0x5D, 0xA2, 0x50, 0xA9, 0x57, 0x6E, 0x89, 0x7A, 0xA9, 0x94, 0x1E, 0x41, 0x34, 0x02,
-    0x90, 0x72, 0x0C, 0xF3, 0x60, 0x5F, 0x0A, 0xFF, 0xC5, 0xF8, 0xBC, 0x87, 0xCF, 0xBA, 0x9C, 0x74,
-    0xD2, 0xF1, 0xFD, 0x6A, 0xE3, 0xFB, 0x4D, 0x22, 0xBB, 0x91, 0x44, 0x2A, 0x0D, 0x2E, 0x17, 0xEE,
-    0x6F, 0x2B, 0x69, 0x72, 0x19, 0x25, 0x32, 0x08, 0xB2, 0xF0, 0x27, 0x75, 0x58, 0x0E, 0x6E, 0xDD,
-    0xF4, 0x67, 0x78, 0xE9, 0xB4, 0xF9, 0x0B, 0x21, 0xF9, 0xA9, 0x08, 0xB0, 0x2C, 0x5B, 0x74, 0xE2,
-    0x17, 0x66, 0x4E, 0xAF, 0x30, 0xF7, 0xF9, 0x13, 0xCD, 0x25, 0xD0, 0x73, 0x99, 0xCB, 0xB3, 0x90,
-    0x86, 0x5C, 0xC0, 0x3D, 0x2C, 0x1D, 0xE2, 0xC6, 0x16, 0x7E, 0x2D, 0x81, 0x22, 0xB5, 0x28, 0xEA,
-    0xF6, 0x12, 0xFB, 0x03, 0x52, 0x19, 0xE0, 0x33, 0xDE, 0xAE, 0x64, 0xAC, 0xD3, 0x76, 0x6A, 0xBE,
-    0xD8, 0x13, 0xEC, 0x90, 0xF0, 0xC5, 0x79, 0x07, 0x3A, 0xF6, 0xEF, 0xFD, 0x6D, 0xC2, 0x61, 0x45,
-    0xD9, 0xBA, 0x15, 0xE7, 0x82, 0x98, 0x73, 0x6E, 0xD2, 0xDB, 0xC9, 0x5D, 0x5D, 0x76, 0xAF, 0xCA,
-    0x2D, 0xA8, 0x12, 0x30, 0xF3, 0x4D, 0x00, 0xBE, 0x79, 0xC4, 0xB8, 0x06, 0xE2, 0xCD, 0x24, 0x89,
-    0xDD, 0xEC, 0x85, 0xC7, 0xC3, 0x45, 0x99, 0x8D, 0xC4, 0x68, 0xC4, 0xB1, 0x33, 0x05, 0x3A, 0x73,
-    0xB5, 0xCE, 0x06, 0xD9, 0x93, 0x2E, 0x06, 0x43, 0xAC, 0x30, 0xB5, 0x22, 0xE5, 0xCA, 0x4D, 0x0B,
-    0xA4, 0xD5, 0x5A, 0x63, 0x11, 0x13, 0xBC, 0xC2, 0x27, 0x7C, 0x38, 0x85, 0xC5, 0xDB, 0x89, 0x31,
-    0x5B, 0xDF, 0x3C, 0x60, 0x20, 0xFE, 0x28, 0x0D, 0xF5, 0x99, 0x07, 0x4F, 0x03, 0xC3, 0x94, 0x7A,
-    0x09, 0x09, 0x04, 0x13, 0xE1, 0xBA, 0x67, 0xD6, 0x9F, 0xFF, 0x42, 0x26, 0x4D, 0xB7, 0x97, 0xE0,
-    0x0C, 0xD0, 0x62, 0x3C, 0xC4, 0xD4, 0xBD, 0xA3, 0x56, 0x60, 0x7D, 0x5A, 0x86, 0x35, 0x5D, 0x28,
-    0x34, 0x43, 0x27, 0xAF, 0x3A, 0xBA, 0x81, 0xA8, 0x30, 0x41, 0xDF, 0x4C, 0x31, 0x22, 0x34, 0xE2,
-    0x6E, 0xCC, 0x2F, 0xB8, 0x1C, 0x5C, 0xCF, 0x82, 0xBD, 0xF7, 0x95, 0x5B, 0xCA, 0x0A, 0x9E, 0x8B,
-    0x80, 0x23, 0xB1, 0x23, 0xF3, 0x0C, 0x0B, 0x54, 0x6E, 0x15, 0x56, 0x30, 0xD8, 0x22, 0x16, 0x75,
-    0xB1, 0x96, 0x28, 0xC8, 0x68, 0xB2, 0x74, 0xEF, 0xE0, 0x6E, 0x41, 0x7F, 0x97, 0x69, 0x2E, 0xFE,
-    0xDD, 0x52, 0x06, 0x4A, 0xDC, 0x26, 0x96, 0xE8, 0x62, 0xED, 0x4F, 0x03, 0xAD, 0xD3, 0x81, 0xBE,
-    0x4A, 0x71, 0xD5, 0x80, 0x1E, 0x5C, 0xC1, 0x32, 0xC9, 0x1A, 0x2E, 0xBF, 0x28, 0xAC, 0xFD, 0xBE,
-    0x8A, 0xF7, 0xC2, 0x59, 0x2E, 0x2E, 0x62, 0x07, 0x36, 0x39, 0xA0, 0x32, 0xB6, 0xB0, 0x45, 0xE8,
-    0x13, 0x11, 0x04, 0x5E, 0x0D, 0x0C, 0x2E, 0x82, 0x08, 0xEE, 0x41, 0x01, 0x88, 0x23, 0x90, 0x88,
-    0x0F, 0xE4, 0x08, 0x25, 0xB2, 0x70, 0x57, 0x6C, 0x61, 0x47, 0x08, 0x51, 0x72, 0x7F, 0x8A, 0x7D,
-    0x6D, 0x41, 0x4C, 0x0C, 0x14, 0x11, 0x67, 0x81, 0xB8, 0xC2, 0x48, 0x17, 0xD1, 0x40, 0x17, 0x3D,
-    0x68, 0xB9, 0x4F, 0xDC, 0x10, 0xC6, 0x2E, 0x51, 0x2A, 0x84, 0x9E, 0x50, 0xC6, 0x59, 0xA4, 0x67,
-    0xD2, 0xC1, 0x14, 0xDA, 0x92, 0xA7, 0x77, 0xC5, 0xC7, 0x87, 0x18, 0x9F, 0xF7, 0x0B, 0x57, 0xFF,
-    0x3A, 0x0B, 0xAA, 0x49, 0x1A, 0x02, 0x60, 0x1F, 0x82, 0x8F, 0x81, 0x64, 0x24, 0xAB, 0x06, 0x1D,
-    0x3C, 0x17, 0x4B, 0xEE, 0x4A, 0xEE, 0x4C, 0x0D, 0x34, 0x38, 0xAF, 0x2C, 0xA2, 0x5C, 0xA4, 0xA1,
-    0xD6, 0x82, 0x6E, 0xA5, 0xE7, 0x0E, 0x8C, 0x2E, 0x37, 0x32, 0x55, 0xC6, 0xDE, 0xB0, 0x8C, 0x3C,
-    0x38, 0x87, 0x75, 0x2B, 0x75, 0xED, 0xED, 0xF6, 0xBA, 0x31, 0x2A, 0x6A, 0xEF, 0x43, 0x76, 0x9A,
-    0x2F, 0xEB, 0xA9, 0x67, 0x6C, 0xEE, 0x09, 0xA8, 0xB2, 0x0E, 0x2F, 0x57, 0x8D, 0x7F, 0x25, 0xEB,
-    0xC5, 0xEE, 0xEF, 0x77, 0xF4, 0xCB, 0xBA, 0x32, 0x36, 0x88, 0x57, 0xFD, 0x62, 0x49, 0x7D, 0x5E,
-    0xC3, 0xB6, 0xB9, 0xEC, 0x09, 0x27, 0x0D, 0x9C, 0x52, 0x20, 0x90, 0x67, 0x8C, 0xB1, 0x62, 0x8D,
-    0x50, 0x4F, 0xB1, 0x73, 0xDA, 0x4E, 0x6D, 0x94, 0x0E, 0xBB, 0x53, 0xFF, 0xB4, 0x0E, 0x58, 0xB2,
-    0x73, 0x2D, 0x6D, 0xAF, 0x53, 0xA3, 0x12, 0x7B, 0x3F, 0xD2, 0x8D, 0xA2, 0x00, 0xD2, 0x27, 0xA5,
-    0x3A, 0x4D, 0xDB, 0x0D, 0xCD, 0xCC, 0x27, 0x53, 0x60, 0xF0, 0x3F, 0x99, 0xAA, 0x74, 0xD8, 0x93,
-    0x3C, 0x76, 0xEB, 0x8D, 0x49, 0x39, 0x99, 0xD3, 0x83, 0x3A, 0x73, 0x4A, 0x07, 0xD7, 0x8B, 0x16,
-    0x06, 0x02, 0x1E, 0xB7, 0x13, 0x76, 0xAE, 0xF7, 0x27, 0xC0, 0x70, 0x8C, 0xBD, 0xE7, 0xAD, 0xB7,
-    0xFD, 0x10, 0x5E, 0xE8, 0x4C, 0x37, 0x00, 0x22, 0x77, 0x3F, 0x2D, 0xA2, 0xF0, 0x46, 0x33, 0x99,
-    0x7B, 0xD5, 0xC2, 0xDB, 0xD2, 0xF9, 0x0D, 0x99, 0x4C, 0xF9, 0x20, 0x44, 0x0E, 0xB3, 0x58, 0x4C,
-    0x4A, 0xED, 0x62, 0x8E, 0xFE, 0xB9, 0x54, 0x41, 0xA8, 0x9F, 0xBF, 0xD3, 0x5E, 0x5B, 0x95, 0xB4,
-    0xF7, 0x27, 0xBA, 0x1C, 0xE8, 0xDA, 0xC4, 0x6E, 0xFC, 0xBD, 0x69, 0x42, 0xAC, 0x8F, 0xEB, 0x13,
-    0xDC, 0xBC, 0xAF, 0x8B, 0x8D, 0xF0, 0x52, 0xB9, 0x82, 0xBD, 0xD7, 0xC1, 0xFB, 0xFF, 0x35, 0x8B,
-    0x74, 0x36, 0xE5, 0x6E, 0xB0, 0xA7, 0x50, 0x8E, 0x63, 0xE7, 0xF0, 0x63, 0xF8, 0xCF, 0x29, 0xC2,
-    0xC7, 0x7C, 0xAA, 0x6A, 0x63, 0xB6, 0x53, 0x0E, 0x45, 0xBD, 0x06, 0x09, 0x64, 0x46, 0xCD, 0x16,
-    0x19, 0x64, 0xC1, 0x8B, 0xC4, 0x7A, 0x02, 0x36, 0x8B, 0x59, 0x68, 0x11, 0xC0, 0x46, 0x69, 0x84,
-    0xC6, 0x12, 0xBB, 0xDB, 0xB1, 0x8D, 0x51, 0x40, 0x67, 0xE4, 0x41, 0x47, 0x5F, 0x95, 0xB8, 0x91,
-    0xC8, 0x04, 0x99, 0xC7, 0xD6, 0x8C, 0xF1, 0x6B, 0xA6, 0x5A, 0x6A, 0x02, 0x58, 0x4D, 0x58, 0xC5,
-    0x82, 0x1A, 0x33, 0xC2, 0x19, 0xE6, 0xF2, 0xB4, 0x8B, 0xD7, 0xFC, 0x36, 0xD4, 0x30, 0x10, 0x31,
-    0x50, 0x25, 0xF2, 0xD4, 0x59, 0xA4, 0x29, 0x78, 0xF7, 0xF3, 0xF8, 0x48, 0x4D, 0xFF, 0xEF, 0x03,
-    0x65, 0x04, 0x19, 0xA8, 0xC2, 0x2B, 0xFC, 0x39, 0xEC, 0x75, 0x32, 0x5F, 0xC4, 0x12, 0x1A, 0x0D,
-    0x92, 0x28, 0x7D, 0x7F, 0xCD, 0x4F, 0xDB, 0x5C, 0xEC, 0xEB, 0x1F, 0xD0, 0xDB, 0x91, 0x01, 0x91,
-    0x8C, 0x8B, 0x46, 0xF2, 0x50, 0x14, 0xB2, 0x7B, 0xD3, 0xA3, 0xAF, 0x7A, 0x35, 0x7C, 0xDC, 0x45,
-    0x0E, 0x54, 0xDB, 0xE0, 0x17, 0x1F, 0xED, 0xC9, 0xA5, 0x5E, 0x86, 0xE7, 0x8D, 0x75, 0x61, 0xE3,
-    0x7A, 0xB6, 0x04, 0xED, 0x20, 0x8E, 0x50, 0x51, 0x36, 0xC9, 0x1F, 0x29, 0xF4, 0x25, 0x27, 0x75,
-    0xCA, 0xF3, 0x50, 0xC4, 0x62, 0xF6, 0x57, 0x97, 0x05, 0x89, 0x3B, 0xFA, 0xE9, 0x8C, 0x4F, 0x83,
-    0xE1, 0x20, 0x10, 0x22, 0x08, 0x4E, 0x7B, 0xA2, 0x5E, 0x44, 0x74, 0xC2, 0xC4, 0x2E, 0x58, 0x44,
-    0xE4, 0x60, 0xF9, 0x2F, 0x0B, 0x93, 0xBB, 0xA9, 0xAC, 0x9C, 0x76, 0xB5, 0xEE, 0x55, 0x8C, 0x24,
-    0xD1, 0xAC, 0x4D, 0x1A, 0x06, 0x15, 0x55, 0xD6, 0xA6, 0xA3, 0x23, 0x15, 0xF9, 0x71, 0x3B, 0x75,
-    0xBD, 0x50, 0xC0, 0x11, 0xE1, 0x3E, 0x62, 0x9C, 0x74, 0x0A, 0xA6, 0xD8, 0x55, 0x7C, 0x98, 0x0D,
-    0x9E, 0x6D, 0xD7, 0x70, 0x0A, 0x73, 0x8D, 0x5B, 0x8E, 0xF5, 0x92, 0x23, 0x32, 0x97, 0xCE, 0xDA,
-    0x15, 0xBC, 0x41, 0x21, 0x69, 0x04, 0x62, 0xA7, 0xC7, 0x42, 0x35, 0x36, 0x3C, 0x72, 0x49, 0x7A,
-    0x1A, 0x88, 0x2E, 0x86, 0xAF, 0x61, 0x47, 0x35, 0x93, 0x84, 0xFB, 0xD9, 0xB9, 0xD7, 0xE0, 0xA6,
-    0x3A, 0xED, 0x5F, 0xBB, 0x8E, 0x41, 0x87, 0x83, 0x39, 0x7C, 0x7D, 0x55, 0xEA, 0xC5, 0x93, 0x8B,
-    0x41, 0x9B, 0x29, 0x3D, 0x08, 0x1E, 0x0E, 0x96, 0xC4, 0x8B, 0x15, 0x64, 0x4F, 0xA2, 0x56, 0x2F,
-    0x66, 0x6F, 0xAF, 0xCA, 0xEA, 0xB8, 0xF1, 0xFE, 0xFB, 0xFB, 0xC5, 0x20, 0x8D, 0xFD, 0xCA, 0x83,
-    0x62, 0x46, 0x41, 0x16, 0x64, 0x0D, 0x88, 0xAC, 0x28, 0x04, 0xA1, 0xDA, 0x6C, 0xCE, 0xAD, 0x62,
-    0x49, 0x3C, 0xC8, 0x8E, 0x0B, 0xCA, 0x0A, 0x16, 0x23, 0x4E, 0x0F, 0x90, 0xE6, 0x63, 0xFC, 0x53,
-    0x8E, 0x30, 0x35, 0x81, 0x22, 0x66, 0xBC, 0x92, 0x29, 0x0D, 0xFD, 0xEC, 0x5C, 0xBB, 0x21, 0x61,
-    0xFB, 0x9C, 0x90, 0x1C, 0xE1, 0xDD, 0x44, 0x08, 0x95, 0xBB, 0x04, 0x8A, 0x20, 0x03, 0x8C, 0xA6,
-    0x93, 0x92, 0x8F, 0x57, 0xB0, 0x3F, 0xC2, 0x5A, 0x59, 0x4E, 0xDD, 0x8F, 0xB4, 0x24, 0xF7, 0x77,
-    0x3D, 0x70, 0xDB, 0x0D, 0x89, 0x41, 0x70, 0x8B, 0x5C, 0x72, 0xA4, 0xDD, 0x14, 0x78, 0x20, 0x73,
-    0xD7, 0xD8, 0x4B, 0x0F, 0x78, 0xCA, 0x98, 0xD1, 0x68, 0xC9, 0x01, 0x7F, 0x29, 0xD5, 0xA4, 0xF6,
-    0xAD, 0xAE, 0x60, 0x28, 0xFE, 0xBC, 0x8B, 0xF7, 0x07, 0x62, 0xFC, 0xCA, 0x23, 0xD7, 0x8B, 0x70,
-    0xFC, 0xC4, 0x03, 0x40, 0x40, 0xD4, 0x95, 0xE3, 0xF3, 0x63, 0x89, 0xBE, 0x6B, 0xE6, 0x59, 0x66,
-    0xD0, 0x4B, 0x78, 0x17, 0xDB, 0x83, 0x6C, 0xF9, 0x68, 0x8D, 0x29, 0xBB, 0x51, 0x92, 0x20, 0xD4,
-    0x1D, 0x63, 0x13, 0x03, 0x91, 0x96, 0xC6, 0x86, 0x00, 0x86, 0x66, 0xD6, 0xA4, 0x23, 0x38, 0xC3,
-    0x8E, 0xE3, 0xD4, 0x0C, 0xE9, 0xCC, 0xE7, 0x25, 0xDF, 0x7D, 0xE6, 0x1E, 0xDF, 0x53, 0xFA, 0x32,
-    0x8D, 0xC2, 0x49, 0x31, 0xDE, 0xE0, 0x85, 0x10, 0xEB, 0x2C, 0x7E, 0x0D, 0x32, 0x3C, 0x5A, 0x9B,
-    0x55, 0x50, 0xA1, 0xA0, 0x40, 0x41, 0x7D, 0x62, 0xCB, 0x93, 0x6F, 0xB4, 0xD6, 0x93, 0x92, 0x56,
-    0x6B, 0x08, 0x23, 0x26, 0x8A, 0xFC, 0x7F, 0xB6, 0x36, 0x69, 0x1C, 0x18, 0x50, 0x4D, 0xA3, 0xE9,
-    0x71, 0x56, 0xCB, 0x25, 0x87, 0x2D, 0xBF, 0x8D, 0xB9, 0x04, 0x64, 0x99, 0x70, 0xB5, 0x67, 0xEE,
-    0x21, 0xE0, 0x23, 0x3B, 0xE1, 0x11, 0xE4, 0x9B, 0x4D, 0x71, 0x76, 0x4D, 0xC2, 0x5D, 0xC2, 0x8B,
-    0x7D, 0xFC, 0xCB, 0x8C, 0x95, 0x63, 0x86, 0xDA, 0xA9, 0x1D, 0x70, 0x37, 0xF8, 0x4A, 0x41, 0x73,
-    0x81, 0x42, 0xB1, 0x89, 0x63, 0x70, 0xB3, 0x9B, 0x98, 0x63, 0x22, 0x4F, 0x09, 0x73, 0xAA, 0x99,
-    0xBB, 0x75, 0xF3, 0x12, 0x6A, 0xDC, 0x4F, 0x61, 0xB9, 0x4B, 0xA8, 0xA6, 0x5B, 0x76, 0x1F, 0xB2,
-    0xD7, 0xAF, 0x52, 0x7D, 0xB2, 0xDE, 0x83, 0x49, 0xF8, 0xC5, 0x10, 0x06, 0x0C, 0xE3, 0xE5, 0x05,
-    0xEE, 0x4D, 0x60, 0xCA, 0x21, 0x4C, 0x49, 0x68, 0x8C, 0x64, 0x48, 0x3D, 0xAC, 0xC0, 0xC5, 0x09,
-    0xC3, 0x58, 0xE8, 0x70, 0x31, 0x18, 0xEE, 0x0D, 0x12, 0x31, 0x2D, 0x16, 0x2F, 0x63, 0x83, 0xA8,
-    0x87, 0x34, 0xED, 0x86, 0xE2, 0x25, 0x13, 0x7E, 0xEA, 0x16, 0xD9, 0xA8, 0xE1, 0xFF, 0xD0, 0x0F,
-    0x48, 0x4E, 0x36, 0x62, 0x29, 0xE6, 0x30, 0xEE, 0x51, 0xBE, 0xEB, 0x6E, 0xA5, 0x24, 0x71, 0x6A,
-    0xAF, 0x00, 0x3F, 0xF3, 0x4A, 0x3F, 0x8B, 0xC1, 0x08, 0x0B, 0x64, 0x44, 0x78, 0x34, 0x56, 0x69,
-    0xF6, 0xDD, 0x8E, 0x91, 0xA6, 0xBB, 0x22, 0x6A, 0x64, 0x0C, 0x32, 0x82, 0xF6, 0xA6, 0x5D, 0x15,
-    0x74, 0xC8, 0x91, 0xE3, 0x47, 0x1D, 0xB9, 0x4D, 0xCF, 0x3D, 0x4B, 0xC8, 0xE3, 0xAF, 0xF2, 0xF3,
-    0x7A, 0xFF, 0x6D, 0xF0, 0xFA, 0xBF, 0x69, 0x0C, 0xFA, 0x6B, 0x7B, 0x35, 0x0D, 0xF3, 0x2F, 0x16,
-    0x79, 0xCE, 0x4B, 0xDB, 0xB0, 0x78, 0xC8, 0x71, 0xD2, 0xAF, 0x72, 0x9C, 0x03, 0xD7, 0x58, 0x17,
-    0xB3, 0xA8, 0xD2, 0x54, 0x07, 0x39, 0x74, 0x0D, 0x39, 0x06, 0xF0, 0x52, 0x44, 0x5E, 0x04, 0x16,
-    0xFF, 0x0E, 0x2C, 0xE6, 0x0A, 0xA8, 0xC8, 0xEB, 0x56, 0x74, 0x6A, 0x1B, 0xD0, 0x5F, 0xCE, 0x84,
-    0x5C, 0x38, 0xC1, 0xD4, 0x20, 0x0A, 0x40, 0xD7, 0x98, 0xE8, 0x60, 0xA9, 0x6C, 0x5F, 0x3A, 0xEE,
-    0xC6, 0x65, 0x28, 0x26, 0x2F, 0x6B, 0xB3, 0x55, 0x1B, 0x5C, 0x9B, 0xC5, 0xF6, 0x56, 0xE4, 0x2C,
-    0xCA, 0x82, 0x34, 0xF1, 0x4B, 0xEF, 0x36, 0xE6, 0xB8, 0x20, 0xC1, 0xCF, 0x52, 0x79, 0xB7, 0x32,
-    0x99, 0x73, 0x0A, 0xCE, 0x08, 0xEA, 0x5C, 0x25, 0x92, 0xB8, 0x10, 0x39, 0x43, 0x66, 0x6E, 0x66,
-    0x3E, 0x61, 0x60, 0xD3, 0xDB, 0x21, 0x16, 0xD7, 0xAC, 0xB5, 0x9C, 0xF6, 0x9C, 0xC6, 0x2B, 0x2F,
-    0x48, 0x1C, 0xA6, 0xFE, 0xFB, 0xA5, 0xFC, 0x12, 0x55, 0xC5, 0x7B, 0x26, 0xBD, 0xAB, 0x37, 0x53,
-    0xA7, 0x1E, 0x21, 0xEE, 0x94, 0xDC, 0x11, 0x90, 0x7A, 0x8C, 0x79, 0xC2, 0x1A, 0x89, 0x65, 0xB7,
-    0xBC, 0x61, 0xA8, 0x10, 0x80, 0xEC, 0xF9, 0x16, 0xEE, 0x37, 0x87, 0x7D, 0x0B, 0xFB, 0x9D, 0xE8,
-    0xDF, 0x58, 0xEE, 0x84, 0x5C, 0xB0, 0xC5, 0x81, 0xB5, 0x8E, 0xA6, 0xEC, 0xD9, 0xFA, 0x01, 0x17,
-    0xB3, 0xB6, 0xBE, 0xB9, 0x70, 0x83, 0xCE, 0x0B, 0x4D, 0x82, 0x7D, 0xCC, 0x45, 0x97, 0x29, 0xCA,
-    0x35, 0xD8, 0x93, 0x98, 0xAC, 0xD9, 0x33, 0x66, 0x1E, 0x1B, 0xB9, 0x1B, 0x27, 0x75, 0x2B, 0xB7,
-    0x3C, 0xE8, 0xA4, 0x7C, 0x67, 0x05, 0x8F, 0xBC, 0x41, 0x5D, 0xD4, 0xC7, 0x9C, 0x6A, 0xD5, 0xAD,
-    0xD6, 0xBC, 0xF2, 0x26, 0x66, 0xC6, 0xBC, 0x58, 0x50, 0x19, 0xC7, 0x7D, 0x24, 0x24, 0xD9, 0xA8,
-    0x04, 0x9E, 0xC8, 0xDA, 0x61, 0x34, 0x72, 0x3F, 0x2D, 0xD5, 0x0F, 0x24, 0xAE, 0x0E, 0xC5, 0x94,
-    0x9C, 0x78, 0x1E, 0x8D, 0x29, 0xB4, 0xAD, 0xAF, 0xD8, 0xD8, 0x92, 0x3A, 0x53, 0xD7, 0x51, 0x28,
-    0x2F, 0x1E, 0xDE, 0x18, 0x54, 0x43, 0x45, 0x30, 0x47, 0xB5, 0xBF, 0xDE, 0x76, 0xBE, 0xA8, 0xF2,
-    0xE9, 0xEA, 0x12, 0x47, 0x31, 0x35, 0x6B, 0x24, 0xD5, 0xBA, 0x99, 0xFB, 0x68, 0x18, 0xB9, 0x5F,
-    0x79, 0x3A, 0x0D, 0x4B, 0x17, 0x3C, 0xA3, 0x62, 0xC1, 0x1A, 0xB7, 0xB7, 0x40, 0xFB, 0x0D, 0x7C,
-    0x2B, 0x1C, 0x2B, 0x1E, 0xEF, 0xDF, 0xBC, 0x5D, 0xBF, 0x89, 0x0A, 0x96, 0x61, 0x6A, 0x9F, 0x04,
-    0xDB, 0x9F, 0xA4, 0xFD, 0x90, 0x53, 0x9C, 0x6A, 0xD5, 0x9A, 0xCA, 0x10, 0xC1, 0xBB, 0x87, 0xE9,
-    0x55, 0xAA, 0x01, 0x27, 0xC1, 0x44, 0xA8, 0x6D, 0x87, 0xC1, 0x95, 0x6C, 0xD5, 0xFB, 0xB0, 0x46,
-    0x6A, 0x43, 0x7E, 0x8D, 0xC1, 0x88, 0x56, 0xA4, 0xCE, 0x83, 0x34, 0x59, 0x45, 0xCC, 0x78, 0x13,
-    0xEB, 0xFD, 0xA1, 0xC0, 0x5E, 0x30, 0x88, 0x02, 0x36, 0x95, 0x19, 0xB0, 0x47, 0xED, 0x22, 0x53,
-    0x53, 0x86, 0x20, 0x78, 0xDB, 0xA8, 0xE0, 0xA4, 0xEF, 0x98, 0x4C, 0xBE, 0xFD, 0x4A, 0x31, 0xC8,
-    0x46, 0x7E, 0xE5, 0x33, 0x93, 0x2B, 0x93, 0xC9, 0xA7, 0xD0, 0xE0, 0x19, 0x2C, 0xD7, 0x93, 0x88,
-    0x99, 0x1C, 0x4E, 0xE0, 0x23, 0x93, 0x3B, 0x0D, 0x5E, 0x7E, 0x8F, 0xB4, 0x88, 0x4D, 0x2B, 0xA4,
-    0x1C, 0xEF, 0x37, 0x12, 0x3A, 0x9F, 0x16, 0x7E, 0x96, 0xE7, 0x6E, 0x99, 0x20, 0x44, 0x29, 0x13,
-    0x3E, 0xF3, 0xD0, 0xA9, 0x54, 0x90, 0x6D, 0x7A, 0xBF, 0x02, 0xF1, 0x19, 0xD6, 0x98, 0x0B, 0x01,
-    0xD6, 0xDD, 0x86, 0xCF, 0x8C, 0xB3, 0x4D, 0xF8, 0x7A, 0x2C, 0x6E, 0xCB, 0xF1, 0xCE, 0xB6, 0x9D,
-    0x8A, 0x95, 0x96, 0x52, 0xB9, 0xDF, 0x04, 0x96, 0xDD, 0x8B, 0xC9, 0x65, 0x74, 0xEC, 0xD2, 0xF8,
-    0xA8, 0xFD, 0x39, 0xCF, 0x6C, 0xFE, 0x0A, 0x0B, 0x16, 0x91, 0x4E, 0x0C, 0x47, 0x2E, 0x57, 0x94,
-    0x32, 0xB8, 0x6F, 0x5A, 0x0E, 0xCD, 0x37, 0x92, 0x6B, 0x60, 0x9B, 0x15, 0x0C, 0x49, 0xA6, 0x53,
-    0xB2, 0xFE, 0xFC, 0x8B, 0x77, 0x3F, 0xD6, 0x7F, 0xAD, 0x7E, 0x39, 0x96, 0x41, 0x3A, 0x72, 0xA6,
-    0xE0, 0x69, 0x70, 0xAC, 0xBE, 0x61, 0x79, 0x0D, 0x5E, 0x28, 0x43, 0x18, 0x50, 0x2E, 0x5B, 0x70,
-    0x38, 0xA4, 0x04, 0x85, 0xCA, 0x13, 0x6E, 0xF0, 0xB5, 0xBA, 0xD9, 0xA4, 0x6E, 0x54, 0xA7, 0x9B,
-    0x61, 0xAB, 0x1B, 0x97, 0xBA, 0x19, 0x51, 0x37, 0x23, 0x76, 0x08, 0xA0, 0x9B, 0x41, 0xAB, 0x1B,
-    0xC2, 0xA0, 0x13, 0x32, 0x94, 0x2E, 0xB3, 0x8F, 0xC8, 0xEE, 0x0A, 0x53, 0x56, 0xFA, 0x43, 0x39,
-    0x8D, 0x6D, 0xFD, 0xC7, 0x82, 0xF8, 0x8D, 0xFE, 0x0F, 0xE2, 0xC7, 0x59, 0x98, 0x57, 0xA6, 0xC6,
-    0xC7, 0x07, 0x20, 0x17, 0xF8, 0xCD, 0x01, 0x6D, 0x5B, 0xB4, 0x72, 0xC3, 0x39, 0xEB, 0xEA, 0x06,
-    0xDB, 0x1C, 0xB0, 0x47, 0x06, 0xBE, 0x4D, 0x92, 0x2F, 0x0A, 0x6F, 0x79, 0x77, 0x60, 0xA4, 0x35,
-    0x5B, 0x0A, 0x10, 0x4D, 0x08, 0xC5, 0xB2, 0x51, 0xE3, 0x55, 0x0D, 0x76, 0x0A, 0x60, 0xA0, 0xD3,
-    0x08, 0x82, 0xBB, 0x72, 0x4B, 0xC2, 0x87, 0x6C, 0x0D, 0x77, 0xA9, 0x0F, 0x13, 0xEB, 0x69, 0x57,
-    0x50, 0x36, 0xC1, 0x67, 0x5B, 0x61, 0xDA, 0xEF, 0x4B, 0x08, 0x72, 0x34, 0x92, 0x30, 0x97, 0x1E,
-    0x12, 0x04, 0x64, 0x83, 0x64, 0x31, 0x72, 0xEA, 0xE8, 0x46, 0x19, 0xCC, 0xED, 0x6B, 0xE9, 0x09,
-    0xDB, 0xCF, 0x65, 0xE4, 0x37, 0xCD, 0x4E, 0xAA, 0x51, 0xB3, 0x93, 0x02, 0x03, 0x69, 0xBC, 0x1A,
-    0x19, 0xB5, 0x0F, 0x9B, 0x25, 0x83, 0x17, 0xC4, 0x73, 0x89, 0x99, 0xBC, 0x98, 0xCD, 0xEE, 0x96,
-    0xB6, 0x37, 0xB4, 0x05, 0x2B, 0xEE, 0x63, 0x20, 0x7C, 0x09, 0x41, 0x16, 0xFA, 0x0E, 0x0A, 0x55,
-    0x04, 0xA5, 0xA3, 0x27, 0xA5, 0x2C, 0x8A, 0xD6, 0xF5, 0x25, 0xB9, 0x79, 0x5A, 0xC6, 0x53, 0x79,
-    0xE6, 0xEA, 0xE3, 0x23, 0x34, 0x3F, 0x0D, 0x52, 0x10, 0x7B, 0x55, 0xFE, 0x25, 0x4C, 0x59, 0xBE,
-    0xD5, 0x32, 0x74, 0xCC, 0x4F, 0x9C, 0x32, 0x83, 0x3C, 0x28, 0xC4, 0x80, 0x96, 0x49, 0xA0, 0x21,
-    0xFB, 0x61, 0x95, 0x29, 0x67, 0x04, 0xDA, 0x07, 0x52, 0x76, 0xC6, 0x3C, 0x8A, 0x11, 0x23, 0x17,
-    0xD8, 0x73, 0x28, 0x22, 0xFA, 0x22, 0xE5, 0x88, 0x12, 0x27, 0x95, 0xFD, 0x05, 0xB6, 0x91, 0xBC,
-    0x7A, 0x39, 0x75, 0x3F, 0x44, 0x9E, 0xB2, 0x05, 0xF6, 0x49, 0x6C, 0x50, 0xA7, 0xC0, 0x8C, 0x74,
-    0x57, 0x01, 0x34, 0x43, 0x24, 0x50, 0x07, 0x60, 0xA0, 0x0D, 0xB7, 0xEF, 0x91, 0x74, 0xFB, 0xA8,
-    0x2C, 0x00, 0x5C, 0x26, 0xD5, 0xBE, 0xA9, 0x50, 0xCD, 0x98, 0x2E, 0x15, 0xE2, 0xA2, 0x2A, 0xD9,
-    0xAE, 0xA8, 0x69, 0x66, 0x5B, 0x96, 0x04, 0x00, 0x23, 0xAE, 0x12, 0xA6, 0x01, 0xEF, 0xDF, 0xCF,
-    0x02, 0xE8, 0x58, 0xC3, 0x38, 0x83, 0xCF, 0x7F, 0x0E, 0xA8, 0xA6, 0xA7, 0xA4, 0x0C, 0x0F, 0xA9,
-    0x69, 0x92, 0x24, 0x2E, 0xA4, 0x5A, 0x80, 0x9E, 0x98, 0xF6, 0xA1, 0xD6, 0xCC, 0x17, 0xBA, 0x2B,
-    0x1A, 0x4F, 0xA6, 0x6C, 0x34, 0x35, 0x83, 0x59, 0xF0, 0xD9, 0xAD, 0x07, 0x51, 0x98, 0x0E, 0xCA,
-    0x10, 0x2F, 0x65, 0x94, 0xAF, 0x5C, 0x18, 0x4A, 0x78, 0x03, 0x32, 0x8C, 0x74, 0xD6, 0xD8, 0x64,
-    0xD2, 0x67, 0x26, 0x99, 0xC0, 0x50, 0x1D, 0x9D, 0x1E, 0x8F, 0x6E, 0x7C, 0xB0, 0xD3, 0x04, 0x73,
-    0x57, 0xEF, 0x07, 0x3E, 0x35, 0x7E, 0xC0, 0xA4, 0x6D, 0x4B, 0x31, 0x7D, 0x0F, 0x22, 0x00, 0x80,
-    0x10, 0xCB, 0x8F, 0x68, 0xE5, 0x70, 0xBE, 0x20, 0xF3, 0x0B, 0xFA, 0xF6, 0xB9, 0xF7, 0x58, 0x90,
-    0x84, 0xD7, 0x5B, 0xDA, 0x50, 0xB1, 0xC6, 0x8A, 0xE9, 0xB1, 0x01, 0xE4, 0x12, 0x43, 0x3C, 0x76,
-    0xE2, 0x91, 0x49, 0x63, 0x25, 0x93, 0x29, 0x4D, 0xEF, 0x6D, 0xF7, 0x7D, 0x38, 0xD5, 0xBA, 0x07,
-    0x07, 0xAE, 0xF6, 0xA5, 0xC6, 0x43, 0x79, 0xF1, 0x08, 0x96, 0x5E, 0xB6, 0xAC, 0x68, 0xD5, 0x92,
-    0x22, 0xD6, 0xAD, 0xC7, 0xFF, 0x4A, 0xFE, 0x79, 0x26, 0x5F, 0xFE, 0x23, 0x8C, 0xC7, 0x99, 0x1E,
-    0x28, 0x01, 0xF6, 0x23, 0x51, 0x5D, 0xDD, 0xBB, 0x62, 0x90, 0x9C, 0xB7, 0xFC, 0x8A, 0x3F, 0xF0,
-    0x75, 0xFF, 0x67, 0xE6, 0xCC, 0xC3, 0xA9, 0x8F, 0x48, 0x3E, 0xA7, 0xFC, 0xCC, 0xFB, 0x20, 0x63,
-    0xB3, 0xC9, 0x52, 0xA5, 0xA5, 0xBF, 0x48, 0x83, 0xB0, 0x84, 0x84, 0x80, 0x91, 0x1D, 0xD4, 0xF0,
-    0xEB, 0x0A, 0xB2, 0x45, 0xE3, 0x80, 0x1B, 0xA8, 0xB8, 0x13, 0xA7, 0xB4, 0x8E, 0x7C, 0xCF, 0xD3,
-    0x73, 0xB7, 0x71, 0x53, 0x5B, 0x3B, 0x86, 0xB6, 0x3F, 0x0D, 0x37, 0x0F, 0x30, 0x30, 0xCE, 0x0C,
-    0x71, 0x8E, 0xA4, 0x9B, 0x62, 0xEB, 0x84, 0x6C, 0x04, 0x0F, 0xE7, 0x8E, 0x9E, 0xC9, 0xBE, 0x63,
-    0x05, 0x76, 0x03, 0xE4, 0xDB, 0xA6, 0xAA, 0x7F, 0x5B, 0xF4, 0xAE, 0xFA, 0xF0, 0x2D, 0x13, 0x29,
-    0x71, 0xC7, 0x6F, 0x18, 0xD7, 0xAC, 0xF4, 0xBC, 0xDB, 0x12, 0xA9, 0xEB, 0x4D, 0xB4, 0xD7, 0x90,
-    0xDE, 0x30, 0xC2, 0x89, 0xE3, 0xB6, 0x85, 0xF4, 0xA7, 0x63, 0xE9, 0xF3, 0x28, 0x21, 0x8E, 0x6D,
-    0xCF, 0xEB, 0xB1, 0xB0, 0xF8, 0xFA, 0xAA, 0xD2, 0xD3, 0xA0, 0xFC, 0x96, 0x09, 0x05, 0xB6, 0x70,
-    0x68, 0x17, 0xC4, 0xC0, 0xDC, 0x9E, 0x64, 0x6D, 0x75, 0xDD, 0x44, 0xB7, 0x5E, 0x77, 0xA6, 0xD1,
-    0xF6, 0x94, 0x65, 0x36, 0xAC, 0xC5, 0x69, 0xAB, 0x85, 0x4C, 0xFE, 0xB2, 0xA5, 0xEB, 0x3F, 0x4A,
-    0x95, 0x2E, 0x66, 0x27, 0x2D, 0x1F, 0x83, 0x8F, 0x8C, 0x53, 0xEA, 0x2C, 0x64, 0x2F, 0x51, 0xE2,
-    0xE3, 0x6E, 0xBD, 0x33, 0x79, 0x11, 0xAF, 0xAE, 0xF1, 0x4D, 0x1A, 0x55, 0xE1, 0xBC, 0x66, 0xDF,
-    0xB3, 0x56, 0xC3, 0xAC, 0xBC, 0x67, 0x35, 0xE1, 0x9C, 0x3D, 0x4D, 0x8A, 0x25, 0xB1, 0x29, 0x63,
-    0x64, 0xE5, 0xC2, 0xCA, 0x73, 0x92, 0x1A, 0x70, 0xC4, 0x19, 0xEC, 0x1D, 0x1D, 0x6D, 0x2D, 0x63,
-    0xA9, 0xC9, 0xA4, 0x22, 0x3C, 0xD9, 0x33, 0xC6, 0xBF, 0xB7, 0x87, 0x07, 0x62, 0x4F, 0x35, 0x3C,
-    0x5D, 0x43, 0x38, 0xD6, 0x95, 0xB0, 0x55, 0xD3, 0x7A, 0x37, 0x6D, 0x3D, 0xE6, 0x97, 0x22, 0x0D,
-    0x8A, 0x9D, 0x49, 0x3A, 0x31, 0xA2, 0x0D, 0xB5, 0xFE, 0x2D, 0x23, 0xD4, 0xC1, 0xF2, 0x28, 0xF9,
-    0x9A, 0xF2, 0x28, 0x7C, 0xB4, 0x3C, 0xA2, 0x3B, 0x9D, 0xB7, 0xEF, 0x1C, 0x13, 0xF9, 0x0E, 0xEC,
-    0xAF, 0x31, 0xFD, 0x2C, 0x9F, 0x8F, 0x47, 0x67, 0x23, 0x5D, 0x6C, 0xAC, 0x77, 0x7C, 0x74, 0x7F,
-    0xE5, 0xDC, 0x13, 0x67, 0x27, 0x0B, 0xA6, 0xF2, 0x02, 0x4B, 0xA5, 0x0B, 0xB0, 0x57, 0x67, 0x84,
-    0x5C, 0x68, 0x83, 0x6F, 0x60, 0x58, 0x85, 0xB6, 0x87, 0x3C, 0x50, 0x9E, 0xDE, 0x21, 0xC0, 0x03,
-    0x0D, 0xF8, 0x46, 0x0E, 0x5D, 0xDB, 0x0E, 0xC6, 0x81, 0x6B, 0x62, 0x08, 0xD2, 0xA5, 0x35, 0xF9,
-    0x3B, 0x26, 0xE5, 0xE8, 0x6C, 0xA0, 0x6B, 0xFF, 0xB3, 0x45, 0x49, 0x70, 0x90, 0xD2, 0xE6, 0x04,
-    0xE4, 0xCE, 0xDB, 0x88, 0x7D, 0x43, 0xEB, 0xF2, 0x90, 0xA3, 0x21, 0xB2, 0xEB, 0x0A, 0x14, 0x57,
-    0x0E, 0x34, 0xA6, 0x0F, 0x38, 0xE2, 0x57, 0xED, 0x3C, 0xFA, 0x9D, 0xAF, 0xCB, 0xC3, 0x3B, 0x37,
-    0x21, 0x10, 0xF5, 0xBE, 0x7E, 0x59, 0xE4, 0x5F, 0x60, 0xAA, 0x2F, 0x04, 0x76, 0xFB, 0x43, 0x61,
-    0x9D, 0xEB, 0xD4, 0x3C, 0x1B, 0xC5, 0xFB, 0xAB, 0xE6, 0x10, 0x05, 0x65, 0x4E, 0xC1, 0xD6, 0x1C,
-    0xB0, 0x73, 0x30, 0xE1, 0xA0, 0x2C, 0x06, 0xED, 0x93, 0x09, 0x76, 0x1D, 0xF1, 0x4F, 0xEA, 0x31,
-    0xA3, 0x2D, 0xCC, 0x7F, 0x49, 0x52, 0x55, 0x55, 0x6A, 0x5C, 0x7B, 0x67, 0x1A, 0x4B, 0x18, 0xD7,
-    0x1B, 0xC9, 0x41, 0x55, 0x14, 0xE9, 0x86, 0x7F, 0xA7, 0x72, 0x2A, 0x7B, 0x0D, 0x72, 0xE5, 0x67,
-    0xDD, 0xB9, 0x6A, 0xB8, 0xFD, 0x63, 0xB7, 0x3D, 0xA8, 0xF1, 0x98, 0x17, 0x5A, 0x6B, 0x03, 0x87,
-    0x8E, 0xCD, 0x21, 0x0F, 0x2A, 0x3D, 0x94, 0xE9, 0x2E, 0x18, 0x99, 0x34, 0x90, 0x64, 0xCC, 0xF3,
-    0x1A, 0x8A, 0x1B, 0x83, 0xA4, 0x69, 0xA6, 0x17, 0x67, 0x07, 0x9B, 0x76, 0x10, 0xE9, 0xAE, 0xC6,
-    0x1F, 0x70, 0x9E, 0xED, 0xC6, 0xB4, 0x25, 0xDB, 0x6A, 0x7A, 0xCE, 0xD4, 0x6A, 0xEA, 0xCB, 0x65,
-    0x95, 0x06, 0x97, 0xC0, 0xF2, 0x6A, 0x52, 0x8D, 0x51, 0x4F, 0x56, 0xEC, 0xF5, 0x87, 0x48, 0x99,
-    0xC3, 0xEE, 0x34, 0xFA, 0xCC, 0xFC, 0x8F, 0x45, 0xD4, 0x9E, 0xD3, 0x38, 0x8C, 0xE4, 0xD5, 0x69,
-    0xD3, 0xC4, 0xA2, 0xEF, 0xFF, 0x79, 0xE4, 0xF7, 0xAC, 0x23, 0xC7, 0xBC, 0xCC, 0xED, 0xCE, 0xA5,
-    0x1F, 0x5F, 0x7E, 0xA6, 0xAB, 0x83, 0x48, 0x23, 0xDF, 0xFD, 0x2E, 0x04, 0x08, 0xFB, 0x90, 0xFF,
-    0x2C, 0xA4, 0x8D, 0xF1, 0x7F, 0x06, 0x81, 0x02, 0x20, 0x02, 0xA5, 0x73, 0xA7, 0x90, 0x9B, 0x6F,
-    0xC8, 0xB1, 0x61, 0x2B, 0x98, 0xC7, 0x97, 0xAE, 0x85, 0x47, 0xEE, 0x79, 0xD7, 0x1E, 0xE6, 0xBB,
-    0x17, 0x4D, 0xC5, 0xC1, 0x5C, 0x68, 0x3A, 0xAD, 0x00, 0xD3, 0x33, 0x1E, 0x36, 0x02, 0x18, 0xF8,
-    0x00, 0x05, 0x89, 0xCC, 0x67, 0x06, 0xC9, 0xCD, 0xA9, 0x87, 0x76, 0xB0, 0x6C, 0x07, 0x41, 0x6E,
-    0x90, 0xF3, 0x82, 0x52, 0x2C, 0x3F, 0x2C, 0xF7, 0xF1, 0x8D, 0xE0, 0x32, 0x9C, 0x05, 0xDB, 0xC2,
-    0x82, 0xCF, 0x3D, 0xDD, 0xB6, 0x32, 0x4E, 0x90, 0x54, 0x2B, 0xD3, 0xB6, 0x8D, 0x9D, 0x9A, 0x5D,
-    0x5B, 0x3F, 0x4B, 0xCC, 0x54, 0x0D, 0x1B, 0x9D, 0x2B, 0x60, 0x7D, 0xB9, 0x33, 0x65, 0x23, 0xD9,
-    0x7F, 0xF8, 0x6B, 0x09, 0x66, 0xB6, 0xAA, 0x74, 0x2A, 0xA3, 0x5C, 0xBF, 0xE0, 0x19, 0x24, 0x34,
-    0xBE, 0xC9, 0x9E, 0x09, 0x7B, 0x00, 0x90, 0x9C, 0x5F, 0xC4, 0x76, 0x10, 0x13, 0x18, 0xC1, 0xDB,
-    0xC1, 0xF6, 0xC9, 0x06, 0x40, 0xB7, 0xF0, 0xE7, 0x96, 0x28, 0x43, 0xAE, 0x67, 0xB6, 0xA3, 0x6D,
-    0x3A, 0x9C, 0x75, 0x5B, 0xB1, 0x99, 0xB6, 0xE2, 0x3A, 0x49, 0x81, 0xF3, 0x12, 0xD0, 0x01, 0x0A,
-    0xC0, 0x85, 0xE4, 0x82, 0xFE, 0x25, 0x7B, 0x0D, 0xE9, 0xAE, 0x2C, 0xBE, 0x14, 0x30, 0xBE, 0x75,
-    0x33, 0xF8, 0xDF, 0xBE, 0x14, 0x60, 0x8E, 0xDF, 0x85, 0x5D, 0xAC, 0xF6, 0x9C, 0xD5, 0x29, 0xDB,
-    0x2F, 0x07, 0xC0, 0x92, 0x51, 0x80, 0x7F, 0x5C, 0x40, 0xC1, 0x90, 0xCB, 0x20, 0x55, 0x97, 0x0A,
-    0xA4, 0x4A, 0x30, 0xD9, 0x2F, 0xD3, 0x9E, 0x57, 0xAC, 0x0E, 0x51, 0xAA, 0x79, 0xEF, 0x67, 0xB0,
-    0xDC, 0xE1, 0x50, 0x81, 0x44, 0xF8, 0x17, 0x6B, 0xEF, 0x76, 0xB5, 0x96, 0x30, 0x45, 0x5E, 0x2E,
-    0x70, 0x27, 0xDE, 0x94, 0x78, 0xD3, 0xFB, 0x57, 0x41, 0x3D, 0x94, 0x20, 0xEC, 0x94, 0xDE, 0xAE,
-    0xA0, 0xF2, 0x43, 0xA6, 0x82, 0x81, 0xD7, 0x24, 0xBF, 0xFD, 0x0E, 0x81, 0x43, 0xD3, 0x09, 0x79,
-    0xD4, 0xFE, 0x09, 0x36, 0x77, 0xCA, 0x29, 0x5A, 0xEF, 0x5A, 0x96, 0xE5, 0x1E, 0xE0, 0xE5, 0x39,
-    0x2A, 0x81, 0xDB, 0xD5, 0x4A, 0xD9, 0xF3, 0xB3, 0x2F, 0xB3, 0x7A, 0xC5, 0xFF, 0x07, 0xBF, 0x18,
-    0xC6, 0x6B, 0x89, 0xF3, 0xFB, 0xEA, 0x93, 0xDA, 0xFF, 0xC0, 0x7B, 0x33, 0x55, 0x6B, 0x2A, 0x96,
-    0x7E, 0xD1, 0x2F, 0x91, 0x65, 0x34, 0x52, 0x00, 0x52, 0xB1, 0x2A, 0x94, 0x9D, 0x86, 0x9B, 0x65,
-    0xA3, 0xEB, 0x7B, 0xE2, 0x16, 0xA6, 0x71, 0x93, 0x53, 0xD5, 0x64, 0xE4, 0x89, 0x57, 0x06, 0x59,
-    0x8F, 0x7A, 0x05, 0xDD, 0x86, 0x41, 0xDD, 0x87, 0x2D, 0xDD, 0x32, 0x5C, 0x80, 0x7D, 0xBC, 0xBD,
-    0xF3, 0x35, 0xD6, 0xED, 0xF9, 0x23, 0x27, 0x24, 0x3C, 0x41, 0x27, 0xFD, 0xFF, 0xA8, 0x58, 0xB4,
-    0xFA, 0xD6, 0x81, 0xB7, 0x3B, 0xD9, 0x65, 0x43, 0xCC, 0xB4, 0xC8, 0xD8, 0xF5, 0x60, 0xA0, 0x87,
-    0x72, 0x57, 0x61, 0x8D, 0xA7, 0xA0, 0x89, 0x95, 0x4D, 0xE4, 0x2A, 0x56, 0x9C, 0x65, 0x7B, 0xBA,
-    0x90, 0xDA, 0x0A, 0x39, 0xB6, 0xA4, 0x77, 0x5C, 0x1B, 0x08, 0xF6, 0xA0, 0x01, 0x4B, 0xC3, 0x39,
-    0x5A, 0x03, 0x45, 0x06, 0x1B, 0x91, 0xFA, 0x7B, 0xE0, 0xE8, 0x39, 0x88, 0x9E, 0x39, 0xA4, 0xAE,
-    0x91, 0xD5, 0x90, 0xD1, 0xDF, 0x2D, 0x51, 0x1D, 0x1B, 0x58, 0xFB, 0xF2, 0xE6, 0x70, 0x7F, 0xDF,
-    0xAD, 0x3B, 0x8F, 0xA9, 0xED, 0x3D, 0x8E, 0x3C, 0xD7, 0x55, 0x08, 0xBB, 0xC8, 0x2C, 0xBB, 0x36,
-    0x84, 0x75, 0xDF, 0x5B, 0x08, 0xDB, 0xBE, 0xC8, 0xD4, 0x76, 0x35, 0x1F, 0x19, 0x72, 0xBB, 0xA1,
-    0x94, 0x65, 0xA4, 0x36, 0x1F, 0x0B, 0xB2, 0xB0, 0x29, 0x5E, 0x5C, 0xB3, 0x85, 0xE5, 0x73, 0xEB,
-    0x3C, 0x0D, 0x3A, 0x77, 0xC1, 0x10, 0x95, 0xC8, 0xF2, 0x01, 0xDB, 0x7E, 0xCA, 0xDA, 0x67, 0xF9,
-    0xF8, 0xCE, 0x35, 0x9E, 0x72, 0xDB, 0x40, 0x15, 0xB6, 0x0D, 0x83, 0xA5, 0x23, 0x06, 0x97, 0x1A,
-    0x92, 0x5D, 0xB7, 0x47, 0xC1, 0xE7, 0xCE, 0x61, 0x45, 0x83, 0x6B, 0xCA, 0x41, 0x80, 0xB0, 0xDF,
-    0x03, 0xE9, 0xAE, 0x58, 0x36, 0x5F, 0x7B, 0x6B, 0xDC, 0x56, 0x24, 0x6E, 0x01, 0x51, 0x7E, 0x51,
-    0x59, 0xC5, 0xF4, 0x8F, 0x5C, 0x6A, 0x81, 0x5B, 0xCA, 0x17, 0x88, 0xAC, 0x86, 0x3D, 0x3F, 0xBE,
-    0xD4, 0x0C, 0x1A, 0xBC, 0xFB, 0xD0, 0x9C, 0x63, 0x4B, 0xAB, 0xE0, 0xD0, 0x98, 0xFA, 0xE2, 0x6B,
-    0x29, 0x23, 0x4B, 0x92, 0x98, 0xE4, 0x93, 0xBD, 0x87, 0x7A, 0xED, 0x97, 0x55, 0x8A, 0x03, 0x0F,
-    0xD1, 0x22, 0xB7, 0xEC, 0x21, 0x2F, 0x39, 0xDA, 0xFF, 0x00, 0x6D, 0x53, 0x4F, 0x68, 0x1C, 0x55,
-    0x18, 0xFF, 0xBD, 0x79, 0xBB, 0x99, 0x24, 0x93, 0xEC, 0x6C, 0xCB, 0x06, 0x43, 0xD8, 0xEE, 0xEE,
-    0x21, 0x60, 0x08, 0xD9, 0xEE, 0x16, 0xF6, 0xB0, 0xAD, 0xB3, 0xDD, 0xB7, 0xC9, 0xA1, 0x07, 0x0F,
-    0xCD, 0x21, 0x7B, 0x51, 0xA4, 0xEB, 0xBF, 0x8B, 0x52, 0xDD, 0xC3, 0x0A, 0xB1, 0x6C, 0xCC, 0x98,
-    0x48, 0x0B, 0xE2, 0x61, 0x41, 0x11, 0x41, 0x0F, 0x15, 0x45, 0x74, 0x45, 0xBB, 0x94, 0x88, 0x31,
-    0x6D, 0x93, 0x49, 0xF7, 0x50, 0xD0, 0x83, 0xAF, 0x0D, 0x9A, 0x43, 0x41, 0x87, 0x86, 0x22, 0xF6,
-    0x34, 0x85, 0x11, 0x5A, 0x98, 0xDD, 0xE7, 0x37, 0x5B, 0x45, 0x11, 0xE7, 0xEF, 0xF7, 0x66, 0xBE,
-    0xF7, 0xBE, 0xEF, 0xF7, 0xE7, 0x21, 0xCD, 0xA5, 0xA5, 0x0B, 0xA0, 0x64, 0xCE, 0xCB, 0x06, 0xE8,
-    0x28, 0xA3, 0x2C, 0x4B, 0xD6, 0x0C, 0x17, 0x0C, 0x87, 0xFA, 0xE3, 0x25, 0xD5, 0x65, 0xEE, 0x6A,
-    0x6F, 0x27, 0xA0, 0x3F, 0x4A, 0xDD, 0x69, 0xB7, 0x45, 0x86, 0x15, 0x63, 0xE5, 0xC0, 0x70, 0x23,
-    0xA5, 0x52, 0x04, 0xB0, 0x8E, 0x5A, 0x59, 0x60, 0x82, 0x07, 0x9A, 0xD3, 0x3C, 0xC9, 0xED, 0x38,
-    0x18, 0x76, 0xD6, 0x4F, 0x25, 0xC7, 0x8E, 0x7B, 0x47, 0xC3, 0xC5, 0xAC, 0x92, 0xF9, 0xE4, 0xDA,
-    0x4D, 0x59, 0x2F, 0x50, 0x6C, 0x6A, 0xBB, 0x07, 0x4E, 0xCE, 0xD1, 0x25, 0xCC, 0x54, 0xD6, 0xB2,
-    0xAC, 0xE9, 0x54, 0xEA, 0x48, 0x36, 0x0C, 0xC2, 0x44, 0xBE, 0xE7, 0xA6, 0x4C, 0x74, 0x1A, 0x7C,
-    0xCD, 0xA1, 0xD1, 0x32, 0x72, 0x38, 0x1F, 0x29, 0x9A, 0x86, 0xC2, 0x36, 0xD8, 0x62, 0x3A, 0x38,
-    0x7E, 0xB6, 0x36, 0xAE, 0x39, 0xCB, 0x26, 0xF3, 0x4A, 0xBA, 0x13, 0x87, 0xEE, 0x6C, 0x9A, 0x9A,
-    0x4B, 0x7D, 0xC7, 0xB1, 0xDC, 0x6C, 0x5A, 0xD6, 0x5C, 0xE4, 0x5F, 0x5F, 0x90, 0xD6, 0xA4, 0xC5,
-    0x09, 0xD2, 0xCA, 0x23, 0x48, 0x22, 0x36, 0xBB, 0x47, 0xED, 0x25, 0x22, 0xDC, 0x39, 0xF9, 0x6E,
-    0xD0, 0x88, 0x62, 0xB5, 0x3F, 0xFB, 0x15, 0xE6, 0xE8, 0x2C, 0xA2, 0x80, 0x3A, 0x97, 0x4D, 0xF3,
-    0x94, 0xEB, 0x03, 0x43, 0xFA, 0xBA, 0x2D, 0xE7, 0x34, 0xE8, 0xE8, 0xA4, 0x4F, 0xF7, 0x88, 0x88,
-    0xFB, 0xDB, 0xB6, 0xC7, 0x6D, 0x10, 0xA4, 0x46, 0xEE, 0xC3, 0x7E, 0x0C, 0xAD, 0x89, 0xD3, 0xFD,
-    0xB0, 0xD7, 0x2C, 0x51, 0xC6, 0x9D, 0x4D, 0x65, 0x48, 0x18, 0x0B, 0xD2, 0xB3, 0xD2, 0x3C, 0x78,
-    0x23, 0xD1, 0x6C, 0x52, 0x65, 0x2B, 0xDB, 0x2C, 0x01, 0x51, 0x1E, 0x74, 0xEE, 0x8D, 0x9E, 0xBB,
-    0xE9, 0xB3, 0x79, 0xE9, 0x76, 0x32, 0xE0, 0xA2, 0xA1, 0xC9, 0xD4, 0x63, 0x7B, 0xBE, 0x61, 0xEA,
-    0xF3, 0x72, 0x95, 0x89, 0x01, 0xFE, 0xE5, 0x17, 0xCA, 0xEA, 0xE0, 0xDE, 0xD7, 0x75, 0xDC, 0x46,
-    0x72, 0x91, 0x89, 0x78, 0xFC, 0xD0, 0xF5, 0xEB, 0x5D, 0xD5, 0x63, 0x15, 0xEA, 0x3C, 0xC6, 0x77,
-    0x7F, 0x73, 0xCA, 0x8E, 0x1E, 0x72, 0xC1, 0x3D, 0xD3, 0x2F, 0x59, 0x17, 0x63, 0x19, 0x16, 0xE3,
-    0xEB, 0xCA, 0xC9, 0xD9, 0x21, 0x1F, 0xA5, 0x57, 0xEA, 0xA3, 0x0C, 0x95, 0xFE, 0x91, 0x13, 0xEA,
-    0x86, 0x46, 0xFA, 0xAC, 0x06, 0x65, 0x15, 0x5E, 0xD1, 0xEA, 0x52, 0x4E, 0xF5, 0xE8, 0x19, 0x0A,
-    0xA9, 0x1E, 0xCC, 0xB6, 0x3F, 0xFD, 0x27, 0x0B, 0x30, 0x94, 0x6A, 0xB7, 0x2F, 0x96, 0x95, 0x52,
-    0xFB, 0x74, 0x07, 0x18, 0xC6, 0x35, 0xDD, 0x2F, 0xDB, 0xCB, 0x21, 0x28, 0x30, 0x4A, 0x20, 0x29,
-    0x0C, 0x2A, 0xEF, 0x11, 0x46, 0x2A, 0x6C, 0x0F, 0xA2, 0x14, 0x45, 0xD4, 0xC7, 0x06, 0x09, 0x08,
-    0x68, 0x12, 0xC4, 0x5A, 0x18, 0xFD, 0x6F, 0xFA, 0x22, 0xAD, 0x33, 0x99, 0x32, 0x62, 0xCD, 0x78,
-    0x01, 0x9F, 0x88, 0x58, 0x03, 0xB7, 0x55, 0x50, 0xAD, 0x8A, 0x68, 0x75, 0x41, 0xF5, 0x0B, 0xD8,
-    0x47, 0x72, 0xEB, 0xCB, 0xEF, 0xDB, 0x9F, 0xB3, 0xCA, 0xBC, 0xEA, 0xD7, 0x3B, 0xDF, 0x30, 0x06,
-    0x5C, 0xDE, 0xED, 0x71, 0xF7, 0x9C, 0xAC, 0x00, 0xAD, 0x15, 0x13, 0x9E, 0x6E, 0x17, 0x73, 0x1A,
-    0xE5, 0x2F, 0xA5, 0x55, 0xFF, 0x6F, 0x14, 0x01, 0xA1, 0x00, 0x77, 0x4D, 0x34, 0x34, 0xEA, 0xC3,
-    0x74, 0x9A, 0xBA, 0x53, 0x44, 0x14, 0xF3, 0xBD, 0xE4, 0x39, 0xF5, 0xB6, 0xE6, 0x26, 0x4C, 0x67,
-    0x63, 0x6E, 0x8C, 0x3C, 0x08, 0x2E, 0x4B, 0xDF, 0x1D, 0xFC, 0x98, 0x65, 0x0E, 0x96, 0x37, 0xAE,
-    0xAD, 0xD0, 0x5C, 0x5A, 0x24, 0x5B, 0x3D, 0x5B, 0x44, 0xB2, 0x48, 0x62, 0x93, 0x2E, 0xD5, 0xEA,
-    0x7F, 0x96, 0xCD, 0x0E, 0xFC, 0x67, 0x11, 0x01, 0x2F, 0xAD, 0x7A, 0xC5, 0x23, 0x7A, 0xC8, 0xC3,
-    0xE1, 0x5D, 0xD3, 0x3F, 0xF8, 0x35, 0x38, 0xF6, 0x0B, 0x22, 0x03, 0x5E, 0x3A, 0x21, 0x7C, 0x11,
-    0x31, 0xFD, 0xCE, 0x96, 0x5A, 0xA8, 0x6C, 0x10, 0x7C, 0xE6, 0x41, 0x23, 0xD8, 0x22, 0x9E, 0xBB,
-    0xE3, 0xFC, 0xDC, 0x63, 0x10, 0x86, 0xDD, 0xBA, 0xA2, 0xF8, 0xBC, 0x1B, 0xA6, 0x67, 0x6A, 0xE9,
-    0x4B, 0xEB, 0x2A, 0x18, 0x1D, 0x0F, 0x07, 0xFA, 0x05, 0xBF, 0x63, 0xC5, 0xA0, 0x78, 0x60, 0xF6,
-    0x5B, 0x53, 0xE2, 0x65, 0x62, 0x0F, 0x2B, 0x78, 0x6A, 0x51, 0xC7, 0x44, 0x54, 0x60, 0x08, 0x23,
-    0x60, 0x02, 0x89, 0xF1, 0x04, 0xD8, 0xA9, 0x5B, 0xC0, 0xF0, 0x4A, 0x06, 0xB8, 0x40, 0x39, 0x91,
-    0xFA, 0x0C, 0x98, 0x4D, 0x6C, 0x2E, 0x22, 0x2A, 0x26, 0x20, 0x47, 0x3E, 0x43, 0x08, 0x47, 0xBF,
-    0xCB, 0x96, 0xA2, 0x3B, 0x5E, 0xD9, 0x51, 0xF6, 0xD1, 0xCA, 0xFD, 0x80, 0xCA, 0x8D, 0x58, 0x1D,
-    0xB7, 0x91, 0x20, 0x15, 0x1E, 0xE4, 0xAE, 0x15, 0x8C, 0xC3, 0x0E, 0x97, 0x9A, 0x8D, 0xE4, 0xBE,
-    0x1F, 0x5C, 0x79, 0x4B, 0x68, 0x67, 0x7E, 0x78, 0xF3, 0xAA, 0x26, 0x0A, 0x86, 0xDB, 0xDC, 0x2E,
-    0x40, 0x8E, 0xEA, 0xAE, 0x6F, 0x9E, 0xB9, 0x70, 0xF0, 0x91, 0xAC, 0xCB, 0xE1, 0x98, 0x6E, 0x94,
-    0xE2, 0x8F, 0x36, 0x70, 0xE7, 0x89, 0x5B, 0x0F, 0x73, 0xBB, 0x1F, 0x80, 0xF1, 0x7E, 0xAF, 0xEE,
-    0x6D, 0x19, 0xFA, 0x6B, 0x7F, 0xDC, 0x79, 0xF8, 0x20, 0x93, 0x34, 0x1E, 0x3E, 0xC3, 0x07, 0x5A,
-    0xC3, 0xDB, 0x24, 0x26, 0x45, 0x0F, 0xBA, 0x8F, 0x1D, 0x45, 0x1B, 0x60, 0xAA, 0x2D, 0x42, 0x37,
-    0xB0, 0x03, 0x52, 0xE3, 0x6A, 0xBA, 0xC5, 0xB6, 0x89, 0x4C, 0x25, 0x30, 0xF5, 0x45, 0xC8, 0xAA,
-    0xDA, 0x53, 0xA1, 0x11, 0x07, 0x2F, 0x10, 0xD1, 0xF1, 0x55, 0xD5, 0xD2, 0xBA, 0x3F, 0xBD, 0xAA,
-    0x7A, 0x04, 0xE9, 0x12, 0x59, 0xA4, 0x4A, 0x33, 0x77, 0x94, 0x8B, 0xF2, 0xDD, 0xA7, 0x7D, 0xEE,
-    0x82, 0xF9, 0xE1, 0xF6, 0xF7, 0x88, 0x4E, 0x08, 0xFC, 0x75, 0x44, 0x87, 0xDA, 0xED, 0xF6, 0x76,
-    0x79, 0x60, 0x51, 0xB2, 0x9C, 0x3D, 0xF8, 0x68, 0xBC, 0x77, 0xB1, 0xCB, 0xC7, 0x66, 0x8E, 0xC9,
-    0x17, 0x91, 0x7E, 0xE7, 0xC4, 0xB7, 0xE2, 0xE3, 0x21, 0x31, 0x86, 0xC4, 0x74, 0x3E, 0x5F, 0x13,
-    0x86, 0x6C, 0xD1, 0xAF, 0xB1, 0x82, 0x9C, 0xC1, 0xE4, 0x74, 0xEB, 0x51, 0xD6, 0xB3, 0x18, 0x5D,
-    0x47, 0x6D, 0x04, 0x75, 0xD6, 0xA2, 0xC9, 0x79, 0xB6, 0xF6, 0xFB, 0x4C, 0xDE, 0xE9, 0x8E, 0x8E,
-    0x35, 0x26, 0xA9, 0x4C, 0x1E, 0xCE, 0xD0, 0xE6, 0x5C, 0x5E, 0x76, 0x87, 0x86, 0xA7, 0xE3, 0x62,
-    0xE4, 0xB2, 0xEC, 0x9E, 0x9F, 0xCC, 0x3F, 0xB7, 0x30, 0x92, 0xAF, 0xED, 0x46, 0x22, 0x53, 0x6B,
-    0x4E, 0x81, 0x23, 0x43, 0xDE, 0x4C, 0xBC, 0x9E, 0xAF, 0xB5, 0xE4, 0xF4, 0xE2, 0xFB, 0xC9, 0xE7,
-    0xB5, 0x9A, 0xC5, 0xC4, 0x70, 0xE6, 0x71, 0xF2, 0xA0, 0x9C, 0x76, 0x2A, 0xF8, 0x13, 0xC5, 0x7C,
-    0x4F, 0x8C, 0x1C, 0xD7, 0x79, 0xE7, 0x57, 0x55, 0x24, 0x4B, 0x66, 0x79, 0x55, 0xC4, 0x82, 0x4A,
-    0x56, 0x56, 0x34, 0xE5, 0x83, 0x0F, 0x42, 0xA2, 0xE9, 0xBE, 0xE4, 0xE0, 0x05, 0xAA, 0xBA, 0x4B,
-    0x24, 0x60, 0x1D, 0x74, 0xD0, 0x24, 0xD0, 0x48, 0x8B, 0x35, 0x60, 0xE6, 0xE0, 0x8B, 0x0D, 0x23,
-    0xF4, 0xC1, 0x87, 0xD9, 0xA0, 0x39, 0x5D, 0x24, 0x0F, 0x3A, 0x18, 0x58, 0xD1, 0x40, 0xB4, 0x39,
-    0xE4, 0x60, 0x1D, 0xB8, 0x80, 0x96, 0x5A, 0xEC, 0x38, 0x8B, 0xD9, 0x4D, 0x6B, 0xDD, 0x9C, 0x2E,
-    0x72, 0x0E, 0x02, 0xA2, 0x83, 0x4A, 0x54, 0x14, 0x1D, 0x84, 0x44, 0xE5, 0xC8, 0x84, 0x01, 0x72,
-    0x11, 0x3E, 0x89, 0x25, 0xB1, 0x39, 0xEC, 0xE9, 0xDA, 0xDF, 0xEF, 0x7B, 0xD5, 0xDD, 0x33, 0x14,
-    0x25, 0x4B, 0x16, 0x95, 0x1D, 0xB2, 0x9B, 0xEC, 0xAE, 0xAA, 0xF7, 0xBE, 0xF7, 0xBD, 0xEF, 0xCF,
-    0xEF, 0xFB, 0xF3, 0x46, 0x04, 0x3F, 0x2D, 0xBC, 0x8C, 0x88, 0x97, 0x89, 0xFC, 0x01, 0x3F, 0x4B,
-    0xBF, 0x2E, 0x82, 0x7A, 0x57, 0x2A, 0x91, 0x50, 0xC4, 0x31, 0x7A, 0x87, 0x5B, 0x8A, 0x74, 0x56,
-    0x53, 0x0F, 0xDF, 0xAF, 0x5F, 0xC8, 0x02, 0xDC, 0x6B, 0x2F, 0xF3, 0xC9, 0xC8, 0x5E, 0xEE, 0xD6,
-    0xC6, 0xAB, 0x6B, 0x3C, 0xF1, 0x44, 0x2A, 0x71, 0x2C, 0xFE, 0xF3, 0xB9, 0x1C, 0xD1, 0xF1, 0x7C,
-    0x3C, 0x34, 0xAA, 0x8B, 0x30, 0xDD, 0x7B, 0x37, 0xC6, 0xF4, 0xAE, 0x3E, 0x83, 0x87, 0x0A, 0xFF,
-    0xDA, 0xCB, 0x32, 0xC0, 0x60, 0xF6, 0xF2, 0x62, 0x4A, 0x0E, 0x86, 0x31, 0xF1, 0xAA, 0xFD, 0x1A,
-    0xFF, 0x2E, 0xEE, 0x69, 0x86, 0x68, 0x6F, 0xA5, 0xBC, 0x27, 0x71, 0xC6, 0x7E, 0xEE, 0xE7, 0x03,
-    0x49, 0xC2, 0xD4, 0x2B, 0x8C, 0xC4, 0xA1, 0x04, 0x97, 0x8C, 0x53, 0xB5, 0x1E, 0x9C, 0x7A, 0x45,
-    0x9D, 0xC9, 0xFC, 0xA7, 0xA7, 0xA3, 0x7B, 0xB9, 0xC8, 0x8F, 0x17, 0xEB, 0x9C, 0x7C, 0x72, 0x9D,
-    0x89, 0xBD, 0x09, 0xB7, 0xDF, 0x73, 0x9D, 0xCD, 0x65, 0xFD, 0x89, 0xEA, 0x0C, 0x24, 0xA4, 0xDD,
-    0xF4, 0x01, 0x0F, 0x37, 0xB4, 0x45, 0x6F, 0x0F, 0x70, 0xB5, 0x83, 0xFF, 0xD6, 0xCA, 0x90, 0x2C,
-    0xB2, 0x53, 0x73, 0x02, 0xAF, 0xC0, 0x60, 0xB8, 0x1A, 0x61, 0xDC, 0xE8, 0x4E, 0x85, 0xC7, 0x67,
-    0x03, 0x49, 0x50, 0x9F, 0x0B, 0xEB, 0x71, 0x50, 0x3C, 0x80, 0x7B, 0x78, 0x2B, 0x89, 0xCD, 0xC4,
-    0x1D, 0x63, 0x54, 0x7C, 0x31, 0xC5, 0x0D, 0x78, 0x76, 0x38, 0x5B, 0x81, 0x6B, 0x56, 0x9C, 0x71,
-    0xFB, 0xC6, 0xD8, 0xAF, 0x2B, 0x7D, 0x7A, 0xCD, 0x2D, 0xC3, 0x34, 0x76, 0x4C, 0x90, 0xB5, 0xA4,
-    0xF2, 0xF2, 0x48, 0x06, 0x5E, 0xD1, 0x7C, 0x91, 0x90, 0xF4, 0x3F, 0x49, 0xC3, 0x58, 0x6E, 0xDA,
-    0xC9, 0xFC, 0x0C, 0xAC, 0x04, 0x27, 0x0D, 0x16, 0x84, 0xF5, 0xB4, 0x48, 0x15, 0xB6, 0x2B, 0xB7,
-    0xDF, 0x56, 0x98, 0x01, 0xF3, 0x37, 0xDF, 0xE2, 0x27, 0x56, 0x5A, 0x06, 0xBA, 0x32, 0xC3, 0x4B,
-    0x78, 0x06, 0x7F, 0x71, 0x19, 0x74, 0xE0, 0x29, 0xF0, 0x08, 0x8F, 0x85, 0x4A, 0x59, 0xA4, 0x3C,
-    0x4C, 0xF4, 0xA1, 0xA1, 0x7C, 0xA7, 0x92, 0xBA, 0x94, 0x0B, 0xA2, 0xAC, 0xC0, 0xDC, 0x8E, 0xBE,
-    0xBB, 0x05, 0x1E, 0xC2, 0xB3, 0xE4, 0xAD, 0x9F, 0x73, 0x47, 0x83, 0x8C, 0xEF, 0x61, 0x4A, 0x36,
-    0x87, 0x12, 0x4D, 0x39, 0x4E, 0x1B, 0x4F, 0x2E, 0x4B, 0xE2, 0x56, 0x18, 0x2A, 0xC6, 0xEC, 0x31,
-    0x88, 0xE8, 0xC9, 0x9A, 0xBE, 0x57, 0xF8, 0x3C, 0x00, 0x2D, 0x15, 0x96, 0x5A, 0x8A, 0xF1, 0x4D,
-    0x9D, 0x73, 0xE8, 0x5A, 0xDC, 0xFA, 0xF6, 0x8C, 0x9D, 0x6B, 0x24, 0x27, 0xC8, 0xC8, 0xC9, 0x8A,
-    0x34, 0x85, 0xA4, 0x19, 0x9F, 0x12, 0x52, 0x48, 0x06, 0x96, 0x5C, 0x55, 0xF7, 0xC2, 0xC6, 0x35,
-    0xCA, 0x10, 0xB6, 0xF0, 0xD4, 0xEA, 0x89, 0x67, 0x27, 0xA0, 0xC9, 0x78, 0x25, 0xF6, 0x45, 0x5A,
-    0x7C, 0xC0, 0x2D, 0xF9, 0x40, 0x12, 0xE1, 0x01, 0xFF, 0x32, 0x1E, 0x70, 0xC7, 0x09, 0x84, 0x79,
-    0x8A, 0xC7, 0x47, 0xD3, 0xCF, 0x10, 0xCB, 0x91, 0xCA, 0x44, 0xE2, 0x4C, 0xFC, 0xDC, 0x83, 0x58,
-    0xC6, 0x10, 0xCB, 0xDC, 0x48, 0x0F, 0x62, 0x79, 0xDA, 0xC8, 0x66, 0x4B, 0xC2, 0xE3, 0x05, 0x6F,
-    0xD7, 0x1F, 0xCA, 0x09, 0x68, 0xC2, 0x5A, 0x45, 0xFE, 0x8D, 0x34, 0xFB, 0xC3, 0x99, 0x5D, 0xAC,
-    0x0F, 0xF4, 0x62, 0x0B, 0x31, 0x6E, 0x85, 0xA5, 0x54, 0xE0, 0x1C, 0xA4, 0xE1, 0x36, 0x5E, 0xDD,
-    0x09, 0x26, 0xDB, 0xC0, 0xFA, 0xCE, 0x62, 0x13, 0x0A, 0x08, 0x85, 0xC1, 0x62, 0x63, 0xCC, 0x1D,
-    0x61, 0x51, 0xE4, 0xA6, 0x57, 0xE0, 0x31, 0x5D, 0xAC, 0xFE, 0x80, 0x4B, 0x56, 0x88, 0xC1, 0x16,
-    0xD0, 0x98, 0xCF, 0x58, 0xE4, 0x63, 0x13, 0x1C, 0x2A, 0x40, 0x37, 0x0F, 0x25, 0x1C, 0x3B, 0xC6,
-    0xBD, 0x9E, 0xB6, 0xA4, 0x67, 0x20, 0x4C, 0xA1, 0x24, 0xDE, 0x9B, 0x25, 0xC8, 0xC7, 0xE7, 0xC8,
-    0x2B, 0x82, 0xB3, 0x79, 0x2C, 0x55, 0x85, 0xFD, 0x6A, 0x61, 0xC1, 0xB7, 0xB0, 0x6D, 0x11, 0x26,
-    0x70, 0x77, 0x31, 0x6A, 0x37, 0x75, 0xC0, 0x33, 0xE5, 0x31, 0x26, 0xF5, 0x7E, 0x05, 0x31, 0xE9,
-    0xE2, 0xE5, 0xAC, 0xE8, 0x24, 0x4E, 0x09, 0x82, 0x62, 0xA1, 0x34, 0x7A, 0x58, 0x15, 0xEE, 0xE8,
-    0xA9, 0x88, 0xF5, 0xF0, 0x15, 0xC8, 0xC3, 0xF0, 0x12, 0x51, 0xA4, 0x5F, 0x07, 0x0B, 0xFF, 0x96,
-    0x9A, 0x51, 0x58, 0x72, 0xB9, 0x71, 0x94, 0x38, 0x90, 0xA7, 0xCB, 0x0D, 0xC7, 0x8B, 0x9D, 0x0D,
-    0xD2, 0x96, 0x0E, 0x88, 0xBD, 0xCA, 0xA5, 0x87, 0x3B, 0x97, 0x40, 0x13, 0x25, 0x7F, 0xDF, 0x97,
-    0x2D, 0x95, 0xE7, 0xE4, 0x5E, 0x5F, 0x62, 0xEB, 0xF2, 0x90, 0x7B, 0xA7, 0xDB, 0xB0, 0xD6, 0xB0,
-    0x5F, 0x19, 0x44, 0xA5, 0x93, 0x3E, 0x68, 0xC0, 0x9C, 0x2D, 0x5C, 0x85, 0xCE, 0x04, 0x2F, 0xC0,
-    0x9E, 0x2D, 0x63, 0x6B, 0x07, 0x12, 0x61, 0x39, 0x34, 0x36, 0xD7, 0x36, 0xB0, 0xFD, 0x13, 0xE7,
-    0xA3, 0x55, 0x43, 0x5E, 0x0F, 0x75, 0x47, 0x5B, 0xD0, 0xFE, 0x41, 0x45, 0xC2, 0xFB, 0xB5, 0x71,
-    0x39, 0x43, 0xAA, 0x7A, 0xC0, 0x95, 0x50, 0xD6, 0x39, 0x45, 0x7D, 0x1E, 0x56, 0x6D, 0x82, 0x61,
-    0x26, 0xA0, 0xA3, 0xF2, 0x0A, 0xAF, 0x04, 0xDF, 0xD3, 0x18, 0x26, 0xCC, 0xB8, 0x50, 0xD5, 0x36,
-    0x28, 0x83, 0xCE, 0x4C, 0x69, 0x9B, 0x6E, 0x43, 0x9A, 0x6B, 0x5C, 0xEC, 0x63, 0x8C, 0x53, 0x18,
-    0xA3, 0x0A, 0x32, 0x2F, 0x5F, 0xC6, 0x02, 0x3E, 0x7A, 0x0E, 0x56, 0xE5, 0xB6, 0x44, 0x17, 0x2A,
-    0x3B, 0x86, 0x83, 0xCD, 0xF7, 0xB1, 0x3B, 0x11, 0x6E, 0x1A, 0x63, 0xF3, 0xF3, 0x2E, 0xCC, 0x6D,
-    0x4D, 0xBB, 0xF7, 0x65, 0xED, 0x5B, 0x40, 0x6B, 0xEE, 0x51, 0x69, 0x41, 0x1E, 0x2E, 0x6C, 0xF2,
-    0x5E, 0xAA, 0x23, 0xB5, 0x94, 0x72, 0x8A, 0xC7, 0xBD, 0x82, 0x57, 0xA8, 0x8B, 0x18, 0x2F, 0xE6,
-    0x14, 0x11, 0x2F, 0xE3, 0x0A, 0xE8, 0x55, 0x13, 0x61, 0xB8, 0x9F, 0x31, 0x2C, 0x16, 0xAE, 0x80,
-    0xE9, 0xF5, 0x84, 0xFA, 0x36, 0xB5, 0x5C, 0x19, 0x88, 0x15, 0x03, 0x15, 0x60, 0x12, 0xF4, 0x25,
-    0x5D, 0xCF, 0x12, 0xFE, 0x50, 0xBD, 0x21, 0x9E, 0xD8, 0x0C, 0xD8, 0x41, 0x1A, 0x26, 0xEC, 0x11,
-    0x54, 0xA7, 0xC7, 0x8D, 0xED, 0xB5, 0xF8, 0x1E, 0x3E, 0xFD, 0x14, 0xAD, 0xD1, 0xAD, 0x77, 0x73,
-    0x75, 0x02, 0x7C, 0xEF, 0x4E, 0x29, 0x09, 0x9D, 0x16, 0x69, 0xE9, 0x86, 0x4F, 0xE2, 0xAB, 0xB6,
-    0x97, 0x63, 0x1A, 0x30, 0x95, 0x12, 0x9A, 0x62, 0x2C, 0x15, 0x26, 0x88, 0x6E, 0xC6, 0xC5, 0x87,
-    0xD0, 0x6C, 0x1A, 0x73, 0xE5, 0x52, 0x41, 0x76, 0x1F, 0xA0, 0x71, 0xA6, 0xE4, 0x76, 0xAC, 0x99,
-    0xC7, 0x62, 0x4E, 0x4A, 0x30, 0x4D, 0xE5, 0x87, 0x63, 0x4B, 0x63, 0x68, 0x05, 0x9A, 0xC4, 0x98,
-    0x23, 0xB2, 0xE5, 0x4D, 0xEB, 0xAC, 0x5D, 0x17, 0x5F, 0x8D, 0x26, 0x8A, 0x59, 0xC2, 0x4C, 0x5C,
-    0x46, 0x9F, 0xFE, 0x61, 0x65, 0x66, 0x58, 0x40, 0x15, 0x84, 0x18, 0xCF, 0x40, 0xBC, 0x8D, 0xD0,
-    0x35, 0xB5, 0x36, 0xDD, 0xD2, 0x7F, 0x03, 0xCF, 0x18, 0x83, 0x9D, 0x58, 0x92, 0x38, 0x38, 0x53,
-    0xFA, 0x97, 0x4C, 0x22, 0x83, 0x18, 0x6C, 0x7C, 0x3A, 0xED, 0xC9, 0x87, 0x25, 0x84, 0x0A, 0x4A,
-    0xEB, 0x40, 0x1A, 0xE9, 0x8B, 0x8C, 0x47, 0xFB, 0xD8, 0xD1, 0x35, 0xAD, 0xE1, 0xC1, 0x16, 0xDC,
-    0x1E, 0xF9, 0x4D, 0xAF, 0xE3, 0x90, 0xD7, 0x03, 0xBC, 0x96, 0xC1, 0xE7, 0xF0, 0xE7, 0x10, 0x0F,
-    0x0A, 0xCF, 0x0E, 0x78, 0x3B, 0x00, 0x67, 0x13, 0x38, 0xC6, 0x90, 0xF2, 0x90, 0xB7, 0x70, 0xA7,
-    0x3A, 0x9C, 0x0A, 0xD2, 0x06, 0x6E, 0x2A, 0xC7, 0xC0, 0x45, 0x58, 0x30, 0x48, 0xBF, 0x5B, 0xA8,
-    0xEF, 0xA1, 0x4F, 0xD2, 0x9B, 0x7A, 0x18, 0x9F, 0x96, 0x59, 0x2A, 0xBD, 0xD7, 0xA5, 0x71, 0x8B,
-    0x75, 0x9F, 0xDD, 0x02, 0x24, 0x24, 0x42, 0x03, 0x2B, 0xB4, 0x2C, 0x1D, 0xC8, 0x14, 0x66, 0xAC,
-    0x42, 0xD3, 0x68, 0xB3, 0xC8, 0x3A, 0xB6, 0x32, 0x6F, 0x63, 0xE2, 0x12, 0x5F, 0x06, 0x63, 0xEF,
-    0xFF, 0x8A, 0xBF, 0xEB, 0x5C, 0x4F, 0xBD, 0xF7, 0xE4, 0xD5, 0xC2, 0xF9, 0x4D, 0xBE, 0xBC, 0x86,
-    0x05, 0x86, 0x4B, 0xB2, 0xB6, 0xE9, 0x6D, 0xE7, 0x31, 0xF4, 0xD0, 0x2C, 0x87, 0x58, 0x7B, 0xE8,
-    0xE7, 0x49, 0x18, 0x1C, 0x2B, 0x43, 0x77, 0x3B, 0x87, 0x3F, 0xFD, 0xDF, 0x45, 0xEC, 0x94, 0x11,
-    0x94, 0x75, 0xD3, 0x07, 0xDD, 0x89, 0x8C, 0xB1, 0x2F, 0x20, 0xA1, 0xD2, 0xAD, 0x83, 0xE1, 0xA1,
-    0xF7, 0x95, 0x4D, 0x10, 0x81, 0x01, 0x30, 0xF3, 0x00, 0x94, 0xEB, 0x97, 0x2F, 0xAE, 0x56, 0x90,
-    0xCB, 0x89, 0xB3, 0x73, 0x61, 0xA4, 0x5F, 0x26, 0xFC, 0x52, 0xE8, 0xA1, 0x1B, 0xC3, 0x4E, 0xBB,
-    0x35, 0xFB, 0x72, 0x86, 0x03, 0x52, 0x1A, 0x10, 0x67, 0xEC, 0x8C, 0xB1, 0x97, 0x3D, 0xB0, 0x0C,
-    0xB0, 0x46, 0x8D, 0x4B, 0x0B, 0x92, 0x45, 0x01, 0x6D, 0x41, 0xB4, 0x12, 0xBC, 0x62, 0xBC, 0x7A,
-    0x78, 0xC1, 0x29, 0x39, 0xA6, 0x03, 0xD9, 0x8B, 0xB2, 0x28, 0x0F, 0xA6, 0x35, 0xFC, 0x6C, 0x33,
-    0x56, 0xBF, 0xA6, 0x8C, 0x29, 0xF2, 0xDA, 0x3F, 0xE5, 0x5D, 0xA6, 0x72, 0x46, 0x07, 0xBE, 0x94,
-    0x7D, 0xA6, 0x72, 0xF1, 0x25, 0x06, 0x1B, 0xC3, 0x22, 0x4D, 0x25, 0x7C, 0xE2, 0x22, 0x56, 0x0E,
-    0x09, 0x25, 0xB6, 0x08, 0x72, 0xEE, 0x7F, 0xA5, 0x90, 0x23, 0x8B, 0xEA, 0x31, 0xFC, 0x62, 0xAA,
-    0x18, 0x47, 0xF6, 0x99, 0xBE, 0xC4, 0x2A, 0xEB, 0xE7, 0x80, 0x4C, 0x95, 0xB5, 0x3D, 0xBF, 0x1D,
-    0x32, 0xC1, 0x84, 0xFF, 0x1C, 0xF2, 0x42, 0x85, 0x53, 0xA3, 0xC4, 0x47, 0xD4, 0x1C, 0x7D, 0xF2,
-    0xB3, 0x05, 0x53, 0x8B, 0xCF, 0x50, 0x03, 0x88, 0xBB, 0xAA, 0x73, 0x08, 0x73, 0xE2, 0xE7, 0xD0,
-    0x9A, 0x42, 0x99, 0x13, 0xA6, 0x95, 0x9A, 0x79, 0xE9, 0xD1, 0xC6, 0xC1, 0x60, 0xBB, 0xEF, 0x91,
-    0x8B, 0xA9, 0xF5, 0x0A, 0x0A, 0x5B, 0xF8, 0x3C, 0x06, 0xA4, 0xEF, 0xE8, 0x96, 0xB2, 0xEF, 0x47,
-    0xBD, 0x2D, 0xBE, 0x77, 0x46, 0x40, 0x21, 0x23, 0x1A, 0xEF, 0xA2, 0xEA, 0xCB, 0xD8, 0xCB, 0x3B,
-    0x01, 0x54, 0xA3, 0x97, 0x80, 0x0A, 0x03, 0x85, 0xF6, 0x5F, 0xA3, 0xCE, 0x46, 0x44, 0x35, 0x98,
-    0xD3, 0xCB, 0x61, 0xB3, 0x3B, 0xCE, 0x6E, 0xF2, 0x88, 0x01, 0x86, 0x81, 0xE5, 0x3F, 0x09, 0x93,
-    0xA1, 0xEB, 0x27, 0xB0, 0x10, 0x49, 0x95, 0x93, 0x84, 0x04, 0xBA, 0x4F, 0x09, 0x4D, 0x25, 0x6C,
-    0xEB, 0x99, 0xD2, 0xEE, 0xBF, 0x47, 0x02, 0xE9, 0x33, 0x85, 0xFE, 0x11, 0x62, 0x2E, 0x01, 0x1C,
-    0x97, 0xF3, 0x21, 0xCD, 0x38, 0x0D, 0x71, 0x06, 0xB8, 0x86, 0x7D, 0x52, 0xD8, 0x44, 0x57, 0x65,
-    0xCD, 0xC3, 0x3D, 0x5C, 0x68, 0xF4, 0x69, 0x2E, 0x34, 0xF8, 0x54, 0x17, 0x3A, 0xA5, 0x35, 0x4F,
-    0x1B, 0x67, 0x61, 0xEC, 0x8E, 0xE1, 0x2A, 0x15, 0xD4, 0x28, 0x68, 0x22, 0x64, 0x02, 0x60, 0xDA,
-    0x86, 0x0E, 0xC7, 0x70, 0x91, 0x50, 0xD1, 0x0E, 0x0C, 0xEA, 0x74, 0xA3, 0x64, 0x40, 0xE0, 0xC0,
-    0x65, 0x72, 0x9F, 0xC8, 0xD5, 0x7D, 0xE8, 0x7F, 0x0D, 0xDF, 0x2E, 0x29, 0xE2, 0xA3, 0x64, 0xF5,
-    0x84, 0xF8, 0x75, 0xA0, 0xDB, 0x53, 0x29, 0xC6, 0xC1, 0x77, 0x2E, 0xF1, 0xD3, 0x40, 0x41, 0x0E,
-    0x24, 0xCF, 0x25, 0x06, 0xCC, 0xF9, 0x89, 0x2E, 0x92, 0xAA, 0xE8, 0xF3, 0x5D, 0xF8, 0x1D, 0x3D,
-    0x11, 0x0D, 0x13, 0xBF, 0x6B, 0xA9, 0x5F, 0xEA, 0x2A, 0xDA, 0xD3, 0x77, 0x51, 0xE3, 0x71, 0xEF,
-    0xB9, 0x36, 0xE7, 0x73, 0x95, 0x9F, 0x3E, 0x97, 0x53, 0xD2, 0xF2, 0xFC, 0x96, 0xB9, 0x26, 0xFA,
-    0x6E, 0xE1, 0xCB, 0xA6, 0xBE, 0x5B, 0xED, 0x54, 0x85, 0x70, 0x0C, 0xC0, 0x4D, 0x54, 0xDF, 0x25,
-    0xAB, 0x2D, 0x9A, 0x81, 0x8C, 0x0E, 0xCF, 0x44, 0x39, 0x4C, 0x2F, 0x94, 0x0C, 0xE8, 0xF8, 0x2C,
-    0xCC, 0x22, 0x60, 0x42, 0xCF, 0xAD, 0xDA, 0xF5, 0x38, 0xAC, 0xD5, 0xFC, 0x2A, 0xF5, 0x4A, 0xBC,
-    0xD2, 0xAE, 0xA4, 0x2B, 0xE5, 0x4A, 0x38, 0xE8, 0xAE, 0xCF, 0x81, 0x6C, 0x80, 0x00, 0x50, 0xBD,
-    0x4E, 0xA2, 0x23, 0xD2, 0x1C, 0x1E, 0x23, 0xEE, 0x20, 0xC5, 0x11, 0x09, 0xEE, 0x80, 0x5E, 0x67,
-    0x42, 0x72, 0x2B, 0x6E, 0x6C, 0x8A, 0xBD, 0x58, 0x53, 0x22, 0xF0, 0x1F, 0x2F, 0x57, 0x2D, 0x1C,
-    0xD8, 0xCF, 0xD0, 0x6E, 0x58, 0x33, 0x10, 0x05, 0xF8, 0x0D, 0x60, 0x1C, 0x72, 0x57, 0xBD, 0x4B,
-    0x20, 0x6A, 0xE0, 0x56, 0x7C, 0xBA, 0x2E, 0x1B, 0x1B, 0x56, 0x0A, 0x91, 0xCC, 0x8A, 0xDF, 0x28,
-    0x70, 0xB0, 0x57, 0xA7, 0x89, 0x28, 0x02, 0x05, 0x39, 0x8D, 0xB6, 0x37, 0x36, 0x00, 0x5A, 0xEE,
-    0x4C, 0x08, 0x9C, 0x66, 0x41, 0x8D, 0xCC, 0x10, 0x24, 0x4C, 0x0F, 0x7C, 0x10, 0x56, 0x91, 0xC8,
-    0x2E, 0xBC, 0xA4, 0x09, 0x73, 0x07, 0x0E, 0x10, 0x10, 0xB2, 0x6C, 0x41, 0xA0, 0x83, 0x7C, 0xC0,
-    0xD0, 0xC3, 0xBB, 0x0A, 0x07, 0x3C, 0x24, 0x09, 0x6E, 0xB9, 0xBE, 0x01, 0xC7, 0x7F, 0xA6, 0xA4,
-    0xCF, 0xA1, 0x4E, 0x3B, 0x26, 0x06, 0x15, 0x41, 0x46, 0xD5, 0xE9, 0xF9, 0x58, 0x31, 0x1E, 0x94,
-    0x2E, 0x60, 0x5E, 0x25, 0xFD, 0x1B, 0x94, 0xEB, 0xF6, 0xEE, 0x7C, 0xB6, 0x11, 0x3C, 0x29, 0x66,
-    0xEA, 0xC2, 0xF3, 0x0D, 0x9B, 0x58, 0xA3, 0xD2, 0x3F, 0x46, 0x86, 0xE0, 0x44, 0xF7, 0xD9, 0x52,
-    0x38, 0x47, 0xF8, 0x4A, 0x21, 0x1D, 0x3C, 0x39, 0xA4, 0xF9, 0x20, 0xD4, 0x01, 0x57, 0x01, 0xBC,
-    0xBB, 0xD8, 0xF7, 0x21, 0x97, 0xFA, 0xB0, 0x23, 0xA3, 0x0F, 0x8A, 0xAD, 0x13, 0xE6, 0x94, 0x4C,
-    0x3A, 0xD2, 0x81, 0x54, 0xFC, 0x34, 0xF3, 0xDE, 0x82, 0xDC, 0x56, 0xD4, 0x89, 0x4E, 0x98, 0xB6,
-    0x8F, 0x95, 0x51, 0xD1, 0xBF, 0x68, 0x82, 0x49, 0x3C, 0x5F, 0xEA, 0x21, 0xCA, 0x42, 0x1E, 0x00,
-    0xFA, 0x55, 0x36, 0x00, 0x4C, 0xC5, 0xF9, 0xE0, 0xA2, 0xB4, 0x46, 0x13, 0x6F, 0xD7, 0x2F, 0xBA,
-    0xD2, 0xF2, 0x21, 0x78, 0x18, 0x3E, 0x80, 0x39, 0xD8, 0x84, 0x3B, 0x4D, 0x19, 0x5E, 0x10, 0xE6,
-    0x48, 0x7B, 0xA3, 0x90, 0x51, 0x63, 0x62, 0x0F, 0x9D, 0x43, 0xF4, 0x94, 0xB6, 0x9F, 0x33, 0x11,
-    0x43, 0x0F, 0x78, 0xB2, 0xF0, 0xCC, 0xCE, 0x46, 0x06, 0x57, 0x80, 0x88, 0x04, 0x9F, 0x61, 0x04,
-    0x0A, 0xAC, 0x24, 0xBC, 0x5E, 0xC9, 0xC8, 0xF2, 0xF9, 0x87, 0x29, 0x66, 0xFD, 0xF7, 0x30, 0xB0,
-    0x04, 0x4D, 0x60, 0xA7, 0x3F, 0x71, 0xA6, 0x69, 0x9B, 0x0E, 0x17, 0xCA, 0x19, 0xC9, 0x91, 0xEE,
-    0x2B, 0x79, 0x77, 0x3A, 0xA3, 0x71, 0x34, 0x96, 0xD6, 0x86, 0xC5, 0x60, 0x91, 0xDD, 0xBE, 0xCA,
-    0xBD, 0x9D, 0xF8, 0xF5, 0x7B, 0xC7, 0xCB, 0xF6, 0x95, 0xD2, 0x33, 0x70, 0xC3, 0x80, 0x18, 0x09,
-    0x51, 0x33, 0xD6, 0xEB, 0x60, 0xBD, 0x55, 0x5B, 0x26, 0xDE, 0x0E, 0x58, 0xDA, 0x40, 0xF8, 0x6F,
-    0xA4, 0x7E, 0x9D, 0x6F, 0x9D, 0x78, 0x32, 0x87, 0x43, 0xFB, 0xC8, 0x04, 0xAF, 0x5F, 0x87, 0x86,
-    0x60, 0x93, 0xB0, 0x43, 0x58, 0xAF, 0x9D, 0xCE, 0xEE, 0x87, 0xF3, 0x12, 0x90, 0xCB, 0xF7, 0x3D,
-    0xC0, 0xC1, 0x60, 0xE2, 0xB4, 0xC5, 0xB4, 0x9F, 0x81, 0xF7, 0x31, 0x60, 0x57, 0x70, 0x1A, 0xCB,
-    0x17, 0xFF, 0x4C, 0x41, 0xFF, 0x72, 0xFD, 0x9A, 0x51, 0xA8, 0x4A, 0x88, 0xF5, 0xE4, 0x36, 0x84,
-    0x2D, 0x0A, 0xCE, 0xE0, 0xBD, 0x05, 0xEF, 0x0D, 0x26, 0x32, 0x26, 0xF9, 0x23, 0xA0, 0xCB, 0x69,
-    0xD6, 0xCD, 0x97, 0x80, 0xAE, 0x9A, 0x5D, 0xFE, 0x01, 0xE4, 0x33, 0x3D, 0xDF, 0x57, 0x0B, 0x04,
-    0x58, 0x90, 0xB5, 0xC7, 0x02, 0xBF, 0x42, 0x7C, 0x92, 0x0A, 0xDD, 0xE9, 0xCE, 0xE8, 0x98, 0x15,
-    0xC2, 0x83, 0x34, 0x54, 0x34, 0x68, 0x15, 0xE0, 0x2D, 0xC0, 0x6D, 0x90, 0x02, 0x80, 0x31, 0xCB,
-    0x60, 0x60, 0x52, 0x21, 0x44, 0xD0, 0xA8, 0x33, 0xCD, 0x46, 0xEE, 0xDA, 0x8D, 0xFC, 0xB3, 0xC3,
-    0xB2, 0x0C, 0x73, 0x70, 0x3D, 0x97, 0x93, 0xCC, 0x3D, 0x38, 0xA9, 0xAC, 0x54, 0xB2, 0x19, 0xD3,
-    0x22, 0x86, 0xF0, 0x36, 0x97, 0x0B, 0x46, 0x95, 0x15, 0xE0, 0x4D, 0xC4, 0x8D, 0x0C, 0x2F, 0x97,
-    0x7E, 0x39, 0xF0, 0xAB, 0xE8, 0x46, 0xCF, 0xAD, 0x9F, 0x56, 0xDA, 0x52, 0x07, 0x26, 0x77, 0x4C,
-    0x90, 0x14, 0x63, 0x2F, 0x2E, 0xC1, 0xFA, 0xC0, 0x76, 0xD7, 0xEA, 0x73, 0xC2, 0x30, 0x75, 0xCA,
-    0xA1, 0xB4, 0xB8, 0x87, 0xB8, 0x4C, 0xAD, 0x86, 0xE1, 0x70, 0x56, 0x9F, 0x11, 0x1A, 0x0B, 0xFF,
-    0x6D, 0x44, 0x22, 0x90, 0xDB, 0x10, 0xEA, 0x4B, 0x7B, 0xDE, 0x52, 0x78, 0x65, 0x63, 0xC8, 0x35,
-    0x5A, 0x33, 0xDA, 0x2D, 0x2F, 0xEF, 0x16, 0x78, 0xA5, 0xBE, 0xB2, 0x02, 0x51, 0x9A, 0xB3, 0x12,
-    0x42, 0x5B, 0xF3, 0x6E, 0xE6, 0x4C, 0x05, 0x3E, 0x6B, 0xD3, 0xFF, 0xEF, 0x08, 0xC4, 0x96, 0x37,
-    0xBD, 0x37, 0xE4, 0x83, 0x22, 0xE9, 0x79, 0xDB, 0xA7, 0xFF, 0x19, 0x18, 0x34, 0x0C, 0xD2, 0xB5,
-    0x78, 0x33, 0x76, 0x8B, 0xBF, 0xCD, 0x4D, 0xE8, 0xEC, 0xFA, 0x59, 0xEC, 0x97, 0x2D, 0x46, 0x1E,
-    0x95, 0x2E, 0x30, 0x01, 0x49, 0xE0, 0x0A, 0x16, 0x65, 0x33, 0x31, 0x03, 0xB8, 0x86, 0x14, 0x01,
-    0x56, 0xC4, 0x98, 0x90, 0x10, 0x5A, 0x29, 0xD6, 0xCB, 0x90, 0x18, 0x08, 0x28, 0x40, 0xB3, 0x5B,
-    0x9D, 0x84, 0x8C, 0x8F, 0x61, 0x2D, 0xB1, 0x44, 0xB0, 0x12, 0x9C, 0x21, 0x4A, 0xD4, 0xE0, 0x18,
-    0x0F, 0x10, 0x20, 0x06, 0x90, 0xD1, 0xF6, 0xC4, 0xEE, 0x58, 0x7A, 0x5E, 0x3E, 0xAC, 0xF3, 0xCE,
-    0xD5, 0x71, 0x58, 0xB4, 0xFD, 0x22, 0xB8, 0x0C, 0x4F, 0x3A, 0x9E, 0xB1, 0xD1, 0x07, 0x5B, 0x11,
-    0x5C, 0x56, 0xB3, 0xCF, 0x40, 0xBC, 0x0F, 0x8B, 0xF7, 0x1A, 0x56, 0xF3, 0x9F, 0xFA, 0xD4, 0x64,
-    0x07, 0x77, 0x06, 0xA0, 0xAF, 0x23, 0x24, 0xB8, 0x07, 0x93, 0x4D, 0xCA, 0x52, 0xE8, 0xB7, 0x37,
-    0xF6, 0x8B, 0x70, 0x7D, 0x2A, 0xBD, 0x91, 0xC6, 0x31, 0x81, 0x0D, 0xD9, 0x68, 0x49, 0xC9, 0x9F,
-    0x56, 0xA3, 0x4E, 0xA3, 0x89, 0x7B, 0xFB, 0x3F, 0xF8, 0xB9, 0x95, 0xCF, 0x26, 0xC3, 0x61, 0xFF,
-    0x76, 0xD4, 0x7A, 0x85, 0xD7, 0x0A, 0x57, 0xA1, 0xBC, 0x93, 0x7E, 0xDF, 0x39, 0x2F, 0x1F, 0xD4,
-    0x67, 0xA1, 0x6C, 0x57, 0x6F, 0x5D, 0x81, 0xA1, 0x6A, 0xE7, 0x09, 0xA8, 0xCD, 0xC3, 0x63, 0x40,
-    0xE6, 0x8C, 0x28, 0xC0, 0x0D, 0xA6, 0x32, 0xD6, 0x22, 0x46, 0x2A, 0x88, 0xA0, 0x68, 0x8B, 0xC1,
-    0x9B, 0xC5, 0x95, 0x01, 0x30, 0x39, 0x47, 0x3E, 0x0A, 0xD1, 0x5B, 0x12, 0xC2, 0x13, 0x4C, 0x4C,
-    0x58, 0x3F, 0x07, 0x28, 0x45, 0xCF, 0xC2, 0xE9, 0x25, 0xC6, 0x60, 0x88, 0x4D, 0xE5, 0x16, 0xE4,
-    0x8C, 0x92, 0x8D, 0x7D, 0x64, 0x98, 0x65, 0x91, 0x43, 0xAF, 0x41, 0x24, 0x5D, 0x86, 0x70, 0xF8,
-    0xD7, 0x2A, 0x30, 0x81, 0x59, 0xD4, 0xE4, 0xFC, 0x92, 0x06, 0xA4, 0x5D, 0xD4, 0xB0, 0xCB, 0xBD,
-    0xBD, 0x53, 0xF9, 0x45, 0x35, 0x0C, 0x53, 0x93, 0x30, 0xEA, 0x69, 0xB9, 0x65, 0x2B, 0x71, 0x8B,
-    0x56, 0xE2, 0xE5, 0x09, 0x5E, 0xBD, 0x96, 0x9F, 0x8F, 0xC3, 0x9F, 0x9E, 0x35, 0x3E, 0xE3, 0x41,
-    0x22, 0x1C, 0x0E, 0xB3, 0xB4, 0x7F, 0x28, 0x9D, 0x74, 0x45, 0x56, 0x10, 0x39, 0x64, 0x0C, 0xEE,
-    0x60, 0x7B, 0x64, 0xB9, 0x67, 0x89, 0x83, 0x46, 0x2B, 0xDE, 0x2B, 0xC4, 0xBD, 0x05, 0xAB, 0x42,
-    0x48, 0x1A, 0x69, 0xEC, 0x3B, 0x06, 0xB9, 0xF7, 0xD2, 0xB2, 0xE2, 0x13, 0x5A, 0x56, 0xF6, 0x2F,
-    0x6E, 0x05, 0xBB, 0x91, 0xF5, 0x48, 0xD6, 0x43, 0x1D, 0xC2, 0xA3, 0x07, 0x7D, 0xFA, 0x20, 0xC7,
-    0x0C, 0xC8, 0x15, 0xF8, 0xA4, 0xF6, 0xF1, 0x22, 0xCA, 0xA7, 0x5B, 0x26, 0xDC, 0x1D, 0xC8, 0x33,
-    0x89, 0xAE, 0xD9, 0x9F, 0x79, 0xB1, 0x83, 0xFC, 0x43, 0x7E, 0xFB, 0xB9, 0x61, 0x50, 0xCB, 0x78,
-    0x68, 0xB3, 0x85, 0xD8, 0x3C, 0xC6, 0x4E, 0xA8, 0x6D, 0xDC, 0x7B, 0xA5, 0xE2, 0x4E, 0xF4, 0x34,
-    0x2E, 0x77, 0xCB, 0x76, 0xD9, 0xCD, 0xD7, 0x87, 0xEB, 0xAF, 0x96, 0xC1, 0x24, 0x18, 0x5B, 0x47,
-    0xFE, 0xE9, 0xC3, 0x25, 0x9F, 0x7B, 0xB8, 0xDB, 0x1C, 0xAE, 0x4B, 0x4B, 0x61, 0xE3, 0x49, 0xD3,
-    0xE4, 0xDC, 0x44, 0xBE, 0x26, 0x0F, 0x3D, 0x43, 0xCF, 0x74, 0xF0, 0x84, 0xCC, 0xDC, 0xF0, 0xAB,
-    0x9A, 0x30, 0x0D, 0x5F, 0x1C, 0x82, 0xC3, 0xA7, 0x75, 0xD4, 0x2A, 0x84, 0xA7, 0xDF, 0xD9, 0x6A,
-    0x3C, 0x18, 0x74, 0xD1, 0x39, 0x06, 0x0E, 0x97, 0x4C, 0x7B, 0x61, 0x10, 0x28, 0x03, 0x98, 0xF9,
-    0x22, 0xB8, 0x59, 0x4F, 0xDC, 0xE2, 0xF6, 0x89, 0x1C, 0x5F, 0x56, 0xF8, 0x32, 0x89, 0xE0, 0x15,
-    0xE0, 0x0F, 0x83, 0xED, 0x02, 0x9E, 0xC3, 0x40, 0x78, 0xE3, 0x66, 0x3D, 0x8A, 0x30, 0xC9, 0xAF,
-    0x16, 0x67, 0x83, 0x55, 0x09, 0x5F, 0x9C, 0xF4, 0xE4, 0xA3, 0xD2, 0x7B, 0x27, 0x0F, 0x4F, 0x48,
-    0xAF, 0xBB, 0x51, 0x34, 0x33, 0xD1, 0x82, 0xCA, 0x7F, 0xED, 0xEB, 0x03, 0x03, 0xCC, 0xD8, 0xAD,
-    0x4F, 0xD3, 0xA7, 0x57, 0x24, 0x95, 0xE1, 0xDD, 0x5F, 0x8C, 0xD2, 0xDA, 0x3A, 0xA4, 0x15, 0xF9,
-    0x01, 0x2D, 0xEC, 0x94, 0xD9, 0xBC, 0x75, 0x20, 0x1A, 0xBA, 0x60, 0x88, 0xFB, 0x12, 0x31, 0xD3,
-    0x08, 0x01, 0x85, 0x07, 0x4B, 0x1B, 0x87, 0xB4, 0x4D, 0x3D, 0xC4, 0x79, 0x67, 0xCA, 0x65, 0xBA,
-    0xAD, 0x9E, 0x57, 0xC6, 0x32, 0x1D, 0x81, 0x96, 0xD1, 0x0C, 0x66, 0x1F, 0x5C, 0x85, 0xE3, 0x98,
-    0x38, 0xB7, 0xBF, 0x8B, 0x30, 0x6A, 0xC0, 0x18, 0x3F, 0xA6, 0x5E, 0x44, 0xEA, 0x8E, 0xFB, 0xF0,
-    0xDA, 0x90, 0x18, 0x3C, 0x03, 0x87, 0xDC, 0x96, 0x01, 0x74, 0x2E, 0xB5, 0x50, 0x8B, 0x09, 0x4B,
-    0x70, 0x44, 0x4D, 0xF1, 0x79, 0xE9, 0x4F, 0x82, 0xAB, 0x55, 0xCF, 0x7D, 0xBF, 0xC4, 0x62, 0x86,
-    0x5B, 0xA3, 0x6D, 0x22, 0x1E, 0xAE, 0x80, 0xF7, 0x39, 0xDE, 0xCE, 0xD0, 0x6D, 0x22, 0x72, 0xA1,
-    0xC5, 0x86, 0x30, 0x1E, 0x39, 0x62, 0x3D, 0x96, 0x53, 0x1B, 0x3C, 0x08, 0xA3, 0xDA, 0xC1, 0xB7,
-    0xAE, 0xD9, 0x1A, 0xE5, 0x36, 0x4B, 0x61, 0xFF, 0xF6, 0x24, 0x85, 0xD3, 0x62, 0xE4, 0x26, 0x33,
-    0xFC, 0xD6, 0x27, 0xC6, 0x2C, 0x66, 0x78, 0xAE, 0x5D, 0x86, 0xFD, 0xA9, 0x37, 0x09, 0x2E, 0x01,
-    0x3C, 0xA9, 0x44, 0x13, 0xCF, 0x29, 0x74, 0x12, 0x88, 0x2D, 0x00, 0x41, 0xCB, 0x42, 0xA9, 0xB9,
-    0x68, 0x77, 0xA8, 0x5F, 0x4E, 0x9D, 0x49, 0xB7, 0xC9, 0x5F, 0x0F, 0x89, 0x83, 0x10, 0xB9, 0x3C,
-    0xD8, 0x78, 0x6C, 0xBF, 0x36, 0xDE, 0xCF, 0xC6, 0x4D, 0x6A, 0x16, 0x4A, 0xDF, 0xCF, 0xFD, 0xDB,
-    0x02, 0x9F, 0x6D, 0xB3, 0xB5, 0x96, 0xA0, 0xD0, 0x26, 0xBF, 0x69, 0xC0, 0x76, 0xF7, 0x1A, 0xB0,
-    0x76, 0x9D, 0x77, 0xEB, 0x7C, 0xBF, 0x01, 0x2B, 0x9B, 0x95, 0xFF, 0x30, 0x0D, 0xEB, 0x7C, 0xF7,
-    0xBB, 0x1E, 0x1D, 0x3F, 0x2F, 0x22, 0xF8, 0x01, 0x09, 0x16, 0x1B, 0xC4, 0x47, 0xDC, 0x85, 0x63,
-    0x94, 0x23, 0xC0, 0xBD, 0xD9, 0x01, 0xCA, 0x5C, 0x93, 0x72, 0x5E, 0xE4, 0xA0, 0x13, 0x0D, 0x16,
-    0x9C, 0x03, 0x72, 0x33, 0x3F, 0x55, 0x1E, 0x38, 0xA2, 0x32, 0x90, 0x30, 0xCA, 0x07, 0x56, 0x02,
-    0xB9, 0xFC, 0x2F, 0x60, 0x53, 0x39, 0xFF, 0x2F, 0x47, 0x63, 0xEE, 0x04, 0xE4, 0x1D, 0xD8, 0x2B,
-    0x86, 0x96, 0x8A, 0x81, 0x42, 0x03, 0x2E, 0x8A, 0xC9, 0xC4, 0x74, 0xAF, 0x84, 0x6E, 0xF2, 0x96,
-    0xB6, 0x44, 0x15, 0xAC, 0xBC, 0xA8, 0x1F, 0x64, 0x64, 0x88, 0xF1, 0xE8, 0x0A, 0xB1, 0x35, 0x3E,
-    0xB3, 0x3D, 0x44, 0xDD, 0x70, 0x55, 0xAB, 0xDC, 0x17, 0x88, 0xA8, 0x57, 0x44, 0xCF, 0x8E, 0x89,
-    0x91, 0x61, 0x59, 0x33, 0x3A, 0xD1, 0x8A, 0xFF, 0xA5, 0xD7, 0x18, 0x77, 0x0B, 0x88, 0x9C, 0x07,
-    0x11, 0x9E, 0x57, 0x0D, 0xE0, 0x8B, 0x31, 0x25, 0xB3, 0xAB, 0x64, 0x2B, 0xB3, 0x60, 0x9A, 0xB2,
-    0x56, 0x0B, 0x0D, 0x54, 0xBF, 0xEB, 0x5D, 0xDB, 0xB8, 0x36, 0x09, 0xF1, 0x79, 0xBC, 0x26, 0x15,
-    0xC2, 0x2E, 0xAF, 0x00, 0xEE, 0x09, 0xF2, 0x04, 0xF1, 0xCE, 0xF5, 0x0F, 0x8C, 0xE6, 0xB2, 0x67,
-    0xA5, 0x07, 0x38, 0x6A, 0x02, 0x5B, 0x86, 0x4C, 0xD8, 0xE3, 0xA5, 0x83, 0xA9, 0xFB, 0x56, 0x2D,
-    0xC9, 0xCE, 0x18, 0x2E, 0x28, 0x5F, 0x5F, 0x38, 0x4E, 0xD8, 0x0D, 0xA3, 0xA6, 0x91, 0x11, 0xDF,
-    0xC2, 0xAF, 0x36, 0xE3, 0x8C, 0x55, 0xB8, 0xB8, 0xAC, 0xE2, 0x77, 0xC3, 0x0A, 0xB2, 0x88, 0xB8,
-    0xA4, 0x19, 0x64, 0x45, 0x8E, 0x26, 0xB2, 0x1C, 0x32, 0x5F, 0x84, 0x90, 0xCD, 0x31, 0x9B, 0x0C,
-    0xD7, 0x88, 0xED, 0x7D, 0x66, 0xBD, 0x3D, 0x33, 0x70, 0xC6, 0x2D, 0xB8, 0xFC, 0x3B, 0xEF, 0xC9,
-    0xE8, 0x2D, 0x8B, 0x9F, 0x9C, 0xEC, 0x31, 0x91, 0x5F, 0x2C, 0xD9, 0x24, 0xB4, 0xB3, 0x35, 0xB3,
-    0x85, 0x4E, 0x6A, 0xE3, 0x54, 0x4D, 0xCF, 0x8C, 0x17, 0x49, 0xDE, 0x4D, 0x3A, 0x4D, 0x70, 0x8D,
-    0x15, 0x21, 0xE7, 0x7D, 0xCC, 0x99, 0x10, 0xAB, 0x31, 0x34, 0x18, 0xAB, 0x64, 0x5B, 0x1F, 0x42,
-    0x7F, 0xA2, 0x75, 0x00, 0xCC, 0xC1, 0x2D, 0x54, 0xC9, 0xFF, 0xC2, 0xF0, 0xCB, 0xA6, 0xF6, 0x9B,
-    0x1C, 0x40, 0x4C, 0xA6, 0x0F, 0x98, 0x07, 0x87, 0xF9, 0x62, 0xEE, 0x2E, 0xA2, 0x28, 0xF5, 0x34,
-    0x14, 0xFE, 0x95, 0x91, 0x53, 0x5C, 0x22, 0xB6, 0x7B, 0x88, 0xCD, 0x07, 0x93, 0x7A, 0x52, 0xA7,
-    0xF0, 0x7C, 0xC1, 0x45, 0x32, 0x34, 0xC6, 0x2B, 0x3C, 0x76, 0x05, 0x71, 0x02, 0x6C, 0x25, 0xF8,
-    0x3A, 0x36, 0x70, 0x59, 0xEE, 0xAD, 0x2C, 0xE9, 0x89, 0x3F, 0x91, 0x3B, 0xCC, 0x27, 0x39, 0xBB,
-    0xD4, 0x1D, 0x6F, 0x9E, 0x05, 0x38, 0xCA, 0x3F, 0x94, 0x93, 0x38, 0x86, 0x0A, 0xAF, 0xA9, 0xC5,
-    0xE7, 0x1B, 0x48, 0x1D, 0xB8, 0xB0, 0x4C, 0x1C, 0x15, 0x9B, 0x9D, 0xC5, 0xC1, 0x30, 0x94, 0x64,
-    0x09, 0xCB, 0x59, 0x8E, 0x11, 0xC3, 0x2F, 0xFD, 0x62, 0x19, 0x9B, 0x55, 0x20, 0x88, 0x47, 0x00,
-    0x91, 0x35, 0x8E, 0xCD, 0x39, 0xF1, 0x22, 0xF1, 0xD3, 0x1F, 0xEE, 0x9C, 0x9F, 0x85, 0x62, 0x7F,
-    0x09, 0xA9, 0xAC, 0x9C, 0x9D, 0x51, 0x36, 0x70, 0x21, 0x16, 0xF1, 0x9E, 0xD0, 0xCB, 0xB7, 0xA1,
-    0xD7, 0x39, 0xF0, 0xFF, 0xBF, 0x01, 0x00, 0xBC, 0x03, 0x01, 0xF3, 0x6E, 0x9C, 0xC8, 0x85, 0x82,
-    0x25, 0x7E, 0xC9, 0x12, 0x0D, 0x31, 0x04, 0x5C, 0xF2, 0x0D, 0x46, 0x29, 0x88, 0x1D, 0xB9, 0x35,
-    0xCC, 0xA4, 0x25, 0x0C, 0x53, 0x63, 0xEA, 0x20, 0x4C, 0x10, 0xC0, 0x56, 0x4F, 0x16, 0xF6, 0xCF,
-    0xA2, 0x05, 0x67, 0x34, 0x86, 0xD2, 0x8D, 0x6A, 0x48, 0x50, 0x37, 0x7B, 0x00, 0x51, 0x4E, 0xDE,
-    0xC4, 0x98, 0x7E, 0xCE, 0x74, 0xCD, 0x80, 0xB2, 0x14, 0xBE, 0xB8, 0xBB, 0xBA, 0x22, 0x1A, 0x50,
-    0x87, 0x17, 0x76, 0x2E, 0xBC, 0xE4, 0x68, 0x32, 0xB7, 0x65, 0x93, 0x37, 0x36, 0x13, 0xA4, 0x81,
-    0x5E, 0xA8, 0x39, 0xE7, 0x75, 0x6A, 0x82, 0x5B, 0x8F, 0x80, 0x64, 0xFC, 0x7A, 0x96, 0x14, 0x5A,
-    0x81, 0xDD, 0x69, 0xC1, 0x88, 0x7B, 0x45, 0xFB, 0x67, 0x80, 0x96, 0x05, 0x86, 0x87, 0x68, 0xAC,
-    0x85, 0x0A, 0xEC, 0x99, 0xCD, 0xAE, 0xF3, 0x50, 0xEB, 0x62, 0x4C, 0x7F, 0x69, 0xF1, 0x89, 0xE6,
-    0x48, 0xA6, 0xFF, 0x03, 0x50, 0x6E, 0x4E, 0x31, 0x63, 0x91, 0xB0, 0x29, 0x21, 0x74, 0xB0, 0x2B,
-    0xAF, 0x32, 0x31, 0x6D, 0xD4, 0x19, 0xFA, 0x6F, 0x83, 0xC5, 0x50, 0xBE, 0x68, 0x0B, 0x9A, 0x1F,
-    0xAF, 0xC9, 0x60, 0x0D, 0xFA, 0xB0, 0x86, 0xA0, 0x70, 0x13, 0x7A, 0x67, 0x10, 0x23, 0x9A, 0x56,
-    0xDB, 0x29, 0x97, 0x60, 0x14, 0x22, 0xEE, 0x23, 0x91, 0x94, 0x03, 0x2D, 0x8A, 0x11, 0x1A, 0xBC,
-    0x20, 0x8C, 0xD9, 0xBA, 0x1B, 0xB0, 0xB8, 0x63, 0xF9, 0xE8, 0x9D, 0xBC, 0xF5, 0x78, 0xEC, 0x6D,
-    0x6F, 0xE7, 0x83, 0x18, 0x72, 0x71, 0xE6, 0xAD, 0x62, 0x53, 0x53, 0x49, 0xD4, 0xC8, 0x5D, 0x6C,
-    0x93, 0xCF, 0x40, 0xB1, 0x03, 0xA0, 0xE7, 0xFE, 0x86, 0x89, 0x00, 0x66, 0x02, 0x07, 0xB1, 0x77,
-    0xF5, 0xB9, 0xB7, 0x2B, 0xE6, 0x4A, 0x8A, 0xCE, 0x2B, 0x77, 0x6E, 0x9C, 0x36, 0x61, 0x08, 0xDC,
-    0x3F, 0xF8, 0x76, 0x9C, 0x78, 0x97, 0x4A, 0x63, 0x3A, 0xC1, 0xF1, 0xB7, 0x2E, 0x99, 0x38, 0x3C,
-    0x41, 0x22, 0x06, 0x43, 0x3F, 0xEB, 0xBF, 0x95, 0x93, 0x77, 0x80, 0x51, 0x78, 0x1A, 0x4E, 0x53,
-    0xFA, 0x19, 0x36, 0x09, 0xDA, 0xBB, 0x1C, 0x3B, 0xCC, 0x06, 0x8F, 0x30, 0x50, 0xB7, 0xC6, 0x2E,
-    0x7A, 0xAF, 0x7F, 0xCF, 0xBF, 0xFC, 0xFE, 0xF6, 0x65, 0x0C, 0x62, 0xAA, 0x2A, 0x86, 0x2C, 0x2D,
-    0x05, 0x4F, 0x27, 0x0C, 0x7B, 0xDA, 0xAC, 0x6D, 0x90, 0x69, 0x60, 0xD5, 0x29, 0xD1, 0x4C, 0x35,
-    0x8D, 0x32, 0x43, 0x7E, 0x9B, 0x42, 0xD4, 0xDC, 0x55, 0x04, 0x86, 0xB8, 0x3B, 0xB7, 0x60, 0xA5,
-    0x58, 0x47, 0xAA, 0x12, 0x62, 0xCD, 0x6A, 0x49, 0x08, 0xF6, 0x10, 0xE2, 0x33, 0x95, 0x8B, 0xED,
-    0xED, 0x81, 0xD5, 0x9E, 0x26, 0x3B, 0xE5, 0xA1, 0xD5, 0x55, 0x26, 0xF0, 0x0B, 0xF7, 0xEA, 0x77,
-    0x81, 0x46, 0x21, 0xF7, 0x3E, 0x1E, 0x93, 0x5B, 0x85, 0xC6, 0x84, 0xEE, 0x9D, 0x1B, 0x30, 0xEE,
-    0x8C, 0xF6, 0xE2, 0x25, 0xE9, 0xC1, 0xB7, 0xC7, 0x80, 0x17, 0x2D, 0xB7, 0x88, 0x6D, 0xFE, 0xDD,
-    0x44, 0x75, 0x0D, 0x6B, 0x0C, 0xDA, 0x75, 0x71, 0xEB, 0xB6, 0xF8, 0x41, 0x74, 0xD4, 0x61, 0x4E,
-    0xF7, 0x38, 0x7D, 0x41, 0xD4, 0x12, 0xEF, 0xEA, 0x6A, 0xDF, 0x68, 0x95, 0x60, 0x2C, 0x9D, 0x57,
-    0x76, 0x76, 0x2A, 0x50, 0xF1, 0xE4, 0xE5, 0x12, 0xEC, 0x02, 0x60, 0x01, 0x61, 0x08, 0xF4, 0x0D,
-    0x0C, 0x5A, 0xEC, 0x21, 0x0A, 0xC1, 0x98, 0x01, 0xC8, 0xCB, 0x07, 0x09, 0xFC, 0x8E, 0x77, 0xC5,
-    0x30, 0x51, 0x25, 0x2B, 0xAB, 0xAB, 0xAB, 0x6E, 0x59, 0xD7, 0x53, 0xAF, 0xB8, 0xB8, 0x4A, 0x85,
-    0x53, 0xDB, 0x8E, 0x95, 0x65, 0xC1, 0x9F, 0x53, 0x96, 0x00, 0x37, 0xEA, 0x3B, 0x77, 0x20, 0x4C,
-    0x57, 0xAE, 0x94, 0x58, 0x76, 0x6E, 0x5A, 0x11, 0xC6, 0x4A, 0x12, 0x3F, 0x33, 0x71, 0x2F, 0x48,
-    0xAB, 0xB8, 0x0A, 0x52, 0x8B, 0xED, 0x1E, 0x44, 0x30, 0xB8, 0x3C, 0x50, 0x33, 0xF4, 0x48, 0xCD,
-    0x1A, 0x61, 0x1A, 0x20, 0xBA, 0xB7, 0x10, 0xB7, 0x09, 0x0F, 0x30, 0xDF, 0x23, 0x85, 0x2E, 0x7E,
-    0x83, 0x95, 0xAA, 0xCA, 0xA2, 0x6F, 0xBF, 0xC9, 0x75, 0x8C, 0x29, 0x89, 0xCE, 0xC9, 0x5D, 0x40,
-    0x81, 0xCC, 0xBF, 0xAA, 0x6E, 0x4B, 0xC6, 0x30, 0xD8, 0x88, 0x54, 0x9D, 0x51, 0xE3, 0x60, 0x1E,
-    0x00, 0x2E, 0x31, 0x13, 0x41, 0x88, 0x8B, 0x5D, 0xC6, 0x8D, 0xE2, 0xFF, 0xC9, 0xD8, 0xA6, 0x4C,
-    0x07, 0x33, 0x00, 0x80, 0xC8, 0x54, 0x91, 0x61, 0xA4, 0x99, 0x10, 0x6C, 0xA7, 0x33, 0xCA, 0x82,
-    0xFA, 0x9C, 0xF7, 0x91, 0x5A, 0x38, 0x30, 0x4C, 0xF7, 0xF1, 0xA1, 0x67, 0x53, 0x3A, 0xB3, 0x4D,
-    0xBA, 0xE2, 0x02, 0x7F, 0x43, 0xA8, 0x1B, 0x75, 0xBC, 0xE7, 0x96, 0xB0, 0x3D, 0xE0, 0x2F, 0x3C,
-    0xB3, 0x3A, 0xE7, 0x04, 0x1C, 0xCD, 0xC6, 0x60, 0x9C, 0x53, 0xB5, 0xFC, 0xC2, 0x9B, 0x4E, 0x77,
-    0x59, 0x67, 0xC2, 0x84, 0xED, 0xB4, 0x09, 0x1C, 0x14, 0x86, 0x86, 0xE9, 0x0C, 0x85, 0x6A, 0xDD,
-    0x2A, 0xDE, 0x83, 0xEF, 0x09, 0xA2, 0xAB, 0xA3, 0x90, 0xD6, 0x65, 0x6E, 0x46, 0xE8, 0x94, 0xAD,
-    0xC8, 0x2D, 0x97, 0xB1, 0x2B, 0x0C, 0x13, 0x62, 0xE8, 0x13, 0x5E, 0xD9, 0x80, 0xCC, 0xEC, 0xC1,
-    0x87, 0x75, 0xC2, 0x20, 0x6F, 0xDF, 0x18, 0xA9, 0xEB, 0x9B, 0x87, 0x09, 0x8B, 0xA1, 0xE6, 0x69,
-    0x6F, 0xAC, 0xB5, 0x64, 0xAD, 0x29, 0xF5, 0x2A, 0xCF, 0x20, 0x50, 0xE8, 0x80, 0x95, 0x01, 0x2B,
-    0x30, 0x86, 0x99, 0x6E, 0x1A, 0x40, 0x4A, 0xC5, 0x36, 0x5E, 0x50, 0x69, 0x19, 0x62, 0x84, 0x0E,
-    0xC1, 0x0C, 0x04, 0x27, 0xCC, 0x87, 0xB8, 0x33, 0xCC, 0x83, 0xC2, 0xA9, 0x47, 0x05, 0x13, 0x67,
-    0xB3, 0x34, 0x83, 0x53, 0x57, 0xC1, 0xD5, 0x61, 0x94, 0xB6, 0x20, 0x63, 0xB1, 0x44, 0xFD, 0xBA,
-    0x86, 0xFC, 0x55, 0xD2, 0x02, 0xDC, 0x84, 0x5E, 0x42, 0xC8, 0x81, 0x7D, 0x83, 0xA9, 0xCD, 0xCB,
-    0x39, 0xD3, 0x52, 0x22, 0x04, 0x52, 0xF0, 0xBC, 0xAC, 0x57, 0xC6, 0xF4, 0xF5, 0xE4, 0x21, 0x55,
-    0x38, 0x01, 0x4B, 0x36, 0xDB, 0xC2, 0x00, 0x93, 0x2E, 0x6C, 0x09, 0xCB, 0x38, 0x05, 0x22, 0xEE,
-    0xA4, 0x5A, 0x25, 0x0C, 0x0B, 0x0D, 0xB2, 0xA0, 0xAE, 0x07, 0x97, 0x25, 0x7A, 0x3D, 0x0B, 0x9F,
-    0x80, 0xBC, 0x42, 0x2E, 0x23, 0x0E, 0xA0, 0x8E, 0x8A, 0x16, 0xF6, 0x84, 0xB8, 0xEF, 0xA5, 0xF2,
-    0xCB, 0x9C, 0xD6, 0xC9, 0x6F, 0xCC, 0x1E, 0xB3, 0xCC, 0xD5, 0x40, 0x8D, 0x94, 0x53, 0xA8, 0x15,
-    0x03, 0xBA, 0x89, 0xFE, 0x05, 0xAC, 0x58, 0x63, 0xA2, 0x83, 0x20, 0x97, 0x24, 0xA8, 0xF3, 0x16,
-    0x4D, 0x32, 0xC1, 0x4A, 0x1F, 0x33, 0xEA, 0x4B, 0xE1, 0x5E, 0xE8, 0x4A, 0xFD, 0xF7, 0x40, 0xC0,
-    0xE6, 0xBE, 0x08, 0x8B, 0xB6, 0x17, 0x7E, 0x6E, 0xBB, 0x10, 0x18, 0xB9, 0xC0, 0x4F, 0x2D, 0x9E,
-    0xFA, 0xD3, 0xC2, 0x99, 0xC0, 0x1F, 0x2D, 0xD1, 0x64, 0xC7, 0x8C, 0xC8, 0x63, 0x75, 0xF0, 0xBC,
-    0xED, 0x23, 0x23, 0xCB, 0x95, 0x04, 0x40, 0x98, 0xBB, 0x5A, 0xFA, 0x9C, 0xFF, 0xF4, 0x6D, 0xC2,
-    0xA6, 0x6B, 0x01, 0x5F, 0xA8, 0xC6, 0x9F, 0x53, 0x74, 0x2C, 0x20, 0x75, 0x0D, 0x96, 0xCC, 0xD2,
-    0x3F, 0x28, 0x7B, 0x93, 0xB5, 0xD4, 0x35, 0xBA, 0x64, 0x8E, 0xCA, 0x18, 0x5E, 0x4C, 0x4C, 0x47,
-    0xC5, 0x0C, 0x63, 0xAC, 0x0D, 0x0B, 0x31, 0xF9, 0x8A, 0x7D, 0x2D, 0x98, 0x6D, 0xF7, 0x8B, 0xE5,
-    0x16, 0xC7, 0x99, 0x38, 0xEF, 0x23, 0x18, 0x87, 0x1B, 0x5D, 0x42, 0xB4, 0x88, 0x2D, 0x94, 0x1B,
-    0x98, 0xF6, 0x46, 0xA5, 0x4C, 0x85, 0x62, 0xC9, 0xA4, 0x71, 0x44, 0xA9, 0x95, 0x11, 0xB3, 0x27,
-    0xD3, 0x6E, 0x93, 0xF2, 0x24, 0xD3, 0x7E, 0xAB, 0x60, 0x02, 0xBB, 0x8E, 0xC5, 0xAE, 0x44, 0x75,
-    0x8A, 0x6D, 0xC3, 0xE6, 0xFB, 0x99, 0x7F, 0xA9, 0xF2, 0x18, 0x27, 0x75, 0x34, 0xD7, 0x49, 0x04,
-    0x1A, 0xD3, 0xD5, 0x47, 0x5E, 0x31, 0x60, 0x1A, 0x6D, 0x99, 0x19, 0x81, 0x8E, 0xFB, 0xCF, 0x9A,
-    0xC9, 0x5D, 0x62, 0xA7, 0xC1, 0xC0, 0xB9, 0x9E, 0x11, 0x0F, 0x3E, 0x68, 0x34, 0xAB, 0x06, 0x9E,
-    0x8C, 0x4A, 0xF5, 0x2B, 0x73, 0x61, 0x8D, 0xEC, 0x7C, 0xC5, 0x0C, 0x91, 0xB1, 0xC3, 0xC5, 0x72,
-    0x4A, 0x09, 0x22, 0x84, 0xE5, 0xFD, 0x27, 0x6F, 0xDB, 0x92, 0xD6, 0xEE, 0xA9, 0x2D, 0xAC, 0x23,
-    0x80, 0x98, 0xC2, 0xC8, 0x0A, 0x73, 0x81, 0xF0, 0x2A, 0x99, 0xB8, 0x44, 0x42, 0x03, 0x8C, 0xD8,
-    0x61, 0xB1, 0xE1, 0x69, 0x0C, 0x82, 0xBD, 0xF0, 0xCC, 0x18, 0x86, 0x04, 0x88, 0x7C, 0xEC, 0x7D,
-    0xF8, 0xAB, 0x09, 0x2C, 0xC2, 0x04, 0xEA, 0x59, 0xD9, 0xEA, 0x87, 0x43, 0x26, 0x1C, 0x4A, 0x29,
-    0x3E, 0x51, 0x9D, 0xB5, 0xB7, 0xC6, 0x51, 0x1A, 0x85, 0x99, 0x07, 0x4C, 0xF6, 0x71, 0x29, 0x09,
-    0xF8, 0x97, 0x88, 0xFF, 0x46, 0x8A, 0xA5, 0x00, 0x76, 0x7C, 0x6B, 0xCC, 0xCA, 0xEF, 0xA8, 0x52,
-    0x78, 0xA2, 0x31, 0x8C, 0xF3, 0xB2, 0x2D, 0xBE, 0xB0, 0x16, 0x68, 0x58, 0x28, 0x70, 0xA2, 0xB9,
-    0x7A, 0x03, 0xCC, 0xF1, 0xED, 0xF0, 0x7C, 0xE7, 0x83, 0xDD, 0x43, 0x53, 0x88, 0xE1, 0xB8, 0x0D,
-    0x97, 0x9E, 0x65, 0xDF, 0xEC, 0xE8, 0x2A, 0x7B, 0x0A, 0xD4, 0x0D, 0x77, 0x9F, 0x81, 0x0B, 0x88,
-    0x66, 0x5A, 0x57, 0x7A, 0x1D, 0xDD, 0x19, 0xB2, 0x46, 0xFD, 0x08, 0xA1, 0xA3, 0xB2, 0x19, 0x7C,
-    0xA2, 0x06, 0x53, 0x7F, 0x98, 0xE2, 0x28, 0x83, 0xA2, 0x9D, 0x77, 0x25, 0xBC, 0x43, 0xE7, 0x14,
-    0x4C, 0xC3, 0xE9, 0x1E, 0x41, 0x23, 0x4C, 0xDF, 0x28, 0xC5, 0xBD, 0xD4, 0x6E, 0x38, 0xCA, 0x66,
-    0x24, 0xF9, 0x09, 0x2D, 0xA4, 0xCC, 0xB4, 0xF9, 0x07, 0xD2, 0x9E, 0xB4, 0xC7, 0xC1, 0xD5, 0xF4,
-    0xAF, 0xDE, 0xAC, 0x6C, 0x31, 0xCC, 0x65, 0x43, 0x4B, 0x04, 0xB6, 0xBA, 0xD7, 0xB3, 0xC3, 0x50,
-    0x6B, 0xC7, 0x78, 0xEF, 0xC1, 0x08, 0xF6, 0xD8, 0xFB, 0xF2, 0x7C, 0x9E, 0xB8, 0xA6, 0xBB, 0x01,
-    0xF3, 0x56, 0xBF, 0x5B, 0xEF, 0x2B, 0xD3, 0xF8, 0x6A, 0xEE, 0xBE, 0xFE, 0xF5, 0x3F, 0xD8, 0xF7,
-    0x2D, 0xEB, 0x1A, 0xEE, 0xFB, 0x0A, 0x12, 0x4F, 0x68, 0xEB, 0x0B, 0x41, 0xA2, 0xF3, 0x01, 0xB1,
-    0x23, 0xC6, 0x82, 0x6D, 0x47, 0xD4, 0x1C, 0x16, 0x2E, 0xB4, 0xB9, 0x9F, 0x42, 0x37, 0x61, 0xB1,
-    0xC1, 0x8E, 0x56, 0x45, 0xD7, 0x78, 0x13, 0xAF, 0x24, 0x78, 0x2A, 0x23, 0xDC, 0x83, 0x9B, 0xF2,
-    0xDE, 0xCF, 0x89, 0xA6, 0xFE, 0x89, 0x7A, 0x15, 0x19, 0xEF, 0x06, 0xC5, 0x02, 0xB8, 0x00, 0x0A,
-    0x13, 0xCE, 0x7B, 0x91, 0x0E, 0x5F, 0xB8, 0x00, 0x6E, 0x9D, 0xF8, 0x1E, 0x84, 0xE5, 0xC0, 0x81,
-    0xFB, 0x8A, 0x1E, 0x6D, 0xFA, 0x3D, 0xA3, 0x4D, 0x07, 0x60, 0xA3, 0x3F, 0x8A, 0x52, 0x65, 0xA9,
-    0xBF, 0x48, 0xB4, 0xEF, 0xA9, 0xD0, 0xE9, 0xC7, 0xD2, 0x26, 0xE8, 0x15, 0x3B, 0x01, 0x3C, 0x86,
-    0x13, 0xEB, 0xC8, 0xF6, 0x54, 0xEE, 0x66, 0x3E, 0xED, 0x1B, 0xE7, 0xFC, 0xBA, 0xD8, 0xFA, 0x0E,
-    0x06, 0xE8, 0x2C, 0x82, 0x30, 0x4D, 0xDD, 0x06, 0x1A, 0x21, 0x76, 0xFF, 0x45, 0xDA, 0x9A, 0x01,
-    0xD0, 0x3A, 0x8E, 0xAB, 0x11, 0x5D, 0x6C, 0x77, 0x11, 0xCE, 0xEB, 0x1C, 0xA2, 0xA2, 0xD7, 0x53,
-    0x69, 0xB3, 0x76, 0x06, 0x31, 0x66, 0x20, 0x34, 0xFC, 0xE3, 0x25, 0xF1, 0x6F, 0x01, 0xA1, 0xD2,
-    0x5B, 0xC2, 0x01, 0xDC, 0x80, 0xD5, 0x7A, 0x54, 0x89, 0x7B, 0x69, 0xE6, 0x17, 0xFE, 0xE1, 0xC2,
-    0xC5, 0xE9, 0x85, 0xEF, 0x58, 0xC5, 0x1B, 0x8F, 0xFE, 0xE1, 0xEF, 0xD2, 0x07, 0x8E, 0x0C, 0x7F,
-    0xF1, 0xC7, 0x0F, 0x1C, 0x4D, 0x1E, 0x7D, 0xFC, 0xCF, 0x70, 0x79, 0x9A, 0x76, 0xEA, 0xBF, 0x86,
-    0x5B, 0x14, 0x79, 0xB8, 0x59, 0x7D, 0x63, 0x33, 0x0A, 0x95, 0x69, 0x39, 0xE0, 0xCC, 0x74, 0xF2,
-    0xA0, 0xED, 0x22, 0xF1, 0x20, 0xD9, 0x6F, 0x82, 0x03, 0x9B, 0x3F, 0x96, 0xA3, 0x07, 0x67, 0xD7,
-    0x3F, 0xE3, 0x27, 0x52, 0xF3, 0x52, 0x1F, 0xFF, 0x2B, 0x72, 0x77, 0xF9, 0x47, 0xDF, 0xA4, 0x44,
-    0xBA, 0x92, 0x7D, 0xF6, 0x43, 0x3E, 0x5B, 0x58, 0x30, 0xD9, 0x75, 0x30, 0xEE, 0x2F, 0x8C, 0x3C,
-    0xF6, 0x35, 0x91, 0xAF, 0x79, 0xE9, 0xE2, 0xBA, 0xDB, 0xB8, 0xBD, 0x06, 0xBC, 0x7E, 0xDD, 0xDF,
-    0xFF, 0xF8, 0x41, 0xFB, 0x4F, 0xD3, 0x10, 0xF4, 0xB8, 0xFD, 0x47, 0xDD, 0xF1, 0x8F, 0xD5, 0x71,
-    0x82, 0xB9, 0xDF, 0x17, 0xDF, 0xF2, 0x76, 0x64, 0xBB, 0x20, 0x9A, 0x9E, 0x88, 0xCF, 0xA6, 0x8B,
-    0xB5, 0x45, 0xD8, 0xDE, 0x36, 0x67, 0xF5, 0xA7, 0xCE, 0x39, 0xD5, 0xAC, 0xCF, 0x7C, 0xC2, 0xB5,
-    0xC6, 0x21, 0xB2, 0x19, 0xFF, 0x2D, 0x69, 0xC2, 0xF0, 0x65, 0x4B, 0x54, 0x6C, 0x49, 0x6C, 0xA2,
-    0xD3, 0x9F, 0xD8, 0x7F, 0x7E, 0x2C, 0x73, 0x40, 0x0E, 0x8A, 0x06, 0xEC, 0x0F, 0x63, 0x3C, 0x77,
-    0xC1, 0x2E, 0x1F, 0x51, 0x63, 0x85, 0xAF, 0x76, 0xDD, 0x42, 0x6A, 0x66, 0x77, 0xF2, 0x58, 0x4E,
-    0x01, 0x75, 0xC7, 0xB8, 0x0F, 0x00, 0xA2, 0x68, 0x11, 0xD7, 0x41, 0xD4, 0x81, 0x2B, 0x96, 0xC2,
-    0x74, 0x13, 0x6A, 0x95, 0x78, 0xAF, 0x61, 0x9C, 0x5B, 0x80, 0x8A, 0xFD, 0x82, 0x45, 0x78, 0xD9,
-    0x0C, 0x4A, 0xE9, 0xBE, 0x65, 0x34, 0x82, 0xD4, 0x8A, 0x5A, 0xDC, 0xB8, 0x04, 0x4A, 0xE8, 0xE1,
-    0x54, 0x2B, 0xD8, 0xB0, 0xF1, 0x2C, 0x42, 0x9D, 0x3C, 0x37, 0xCF, 0xC0, 0xEF, 0x8D, 0x69, 0x9D,
-    0xD2, 0x7E, 0xD6, 0xD4, 0xB1, 0x66, 0xE0, 0x87, 0xCC, 0xC0, 0x9F, 0xBC, 0x5C, 0x3F, 0x6D, 0x74,
-    0x19, 0xB1, 0xD2, 0x19, 0xAA, 0xB9, 0x35, 0x5C, 0xEF, 0x23, 0x3B, 0x59, 0xB7, 0xCE, 0x7F, 0xFF,
-    0xED, 0x59, 0xC3, 0xDB, 0x5F, 0x32, 0xEB, 0x14, 0xBE, 0x32, 0x8E, 0x64, 0x88, 0x08, 0x31, 0x11,
-    0x04, 0xFC, 0xF8, 0x3B, 0xEC, 0x1D, 0xAA, 0x10, 0x2B, 0xD5, 0xB7, 0x29, 0xFA, 0x9A, 0xA9, 0x08,
-    0xEB, 0xA2, 0x7D, 0xAD, 0x51, 0x92, 0xDC, 0x26, 0x31, 0x5C, 0x2D, 0x20, 0x75, 0xEB, 0x0F, 0x8C,
-    0xFF, 0x4E, 0x1E, 0x7C, 0x4F, 0x12, 0x00, 0x91, 0xE9, 0x28, 0xB5, 0x4E, 0xB6, 0xFE, 0x35, 0x54,
-    0x10, 0xD0, 0x23, 0x02, 0x5C, 0xEF, 0xD1, 0xFD, 0xC3, 0x1E, 0x10, 0x97, 0x0F, 0xE2, 0x71, 0x78,
-    0xAC, 0x66, 0x1B, 0x1D, 0xD0, 0x1E, 0x31, 0x6D, 0x22, 0xDF, 0x64, 0xBC, 0xB3, 0xBF, 0x80, 0x2A,
-    0x47, 0xBE, 0x21, 0xEE, 0x3C, 0xED, 0x1D, 0x43, 0x00, 0x59, 0xAC, 0xD4, 0x62, 0xE4, 0x2C, 0xED,
-    0xED, 0x84, 0xE9, 0x30, 0xEE, 0x79, 0xE3, 0xBE, 0xA6, 0xBD, 0xE3, 0x3E, 0x93, 0x93, 0x05, 0x1C,
-    0x78, 0xD6, 0x68, 0x3A, 0x07, 0x5D, 0x6A, 0x82, 0xFC, 0x79, 0x2B, 0x50, 0xCC, 0x06, 0x17, 0x9D,
-    0xF8, 0x5E, 0xCD, 0x43, 0xE9, 0x3D, 0x9A, 0x87, 0xEE, 0xA2, 0x8B, 0xFA, 0x97, 0x34, 0xAD, 0x84,
-    0xAB, 0x03, 0x78, 0x34, 0xEF, 0xED, 0x15, 0xDB, 0x3D, 0x88, 0xC0, 0x09, 0x8C, 0xB2, 0x0D, 0x84,
-    0x7B, 0xBB, 0x07, 0x63, 0x05, 0x1E, 0x5A, 0x29, 0x1E, 0xDC, 0x63, 0x8E, 0x76, 0x9D, 0xB3, 0xAA,
-    0xF9, 0x89, 0xE2, 0xF1, 0xAC, 0x75, 0x94, 0x02, 0xBE, 0xFA, 0x0C, 0x44, 0xA0, 0xB3, 0x3A, 0xB3,
-    0x53, 0x87, 0xA6, 0xE7, 0xBA, 0x75, 0x36, 0xDF, 0x82, 0xD4, 0x96, 0x7E, 0xE8, 0xA2, 0xB3, 0x7E,
-    0x5D, 0xDE, 0x5D, 0xED, 0x5C, 0xDE, 0x5F, 0xED, 0x1C, 0x27, 0xD2, 0x0E, 0xB5, 0x94, 0x0D, 0x97,
-    0x10, 0xDB, 0x02, 0x57, 0x4E, 0xCB, 0x49, 0xD4, 0x3F, 0x11, 0x67, 0xE2, 0x5D, 0x9F, 0x48, 0x53,
-    0xE4, 0xDD, 0x3F, 0x31, 0x98, 0xB9, 0x55, 0x22, 0x74, 0x0F, 0x9F, 0x34, 0x3D, 0xEF, 0x4A, 0x19,
-    0xBC, 0x90, 0xB6, 0x80, 0x32, 0x8C, 0x25, 0x81, 0x25, 0x4C, 0x69, 0x03, 0xA7, 0x7A, 0xD3, 0x46,
-    0xC5, 0x21, 0x47, 0x30, 0xD3, 0x9A, 0x3E, 0x61, 0x0E, 0x54, 0x8B, 0x9B, 0x98, 0xA8, 0x00, 0xFE,
-    0x84, 0x51, 0x36, 0x9A, 0xD5, 0xFA, 0x90, 0x64, 0x5F, 0xBC, 0xA5, 0x7D, 0x4B, 0x9A, 0x73, 0x1C,
-    0xDD, 0xA0, 0xA6, 0xDE, 0x7C, 0x83, 0xBD, 0x94, 0xDB, 0xAF, 0xD1, 0x56, 0x3F, 0xC9, 0xD0, 0xEC,
-    0x54, 0x00, 0x10, 0xC9, 0x0A, 0x0B, 0x61, 0x00, 0xB3, 0x31, 0x61, 0x16, 0x49, 0xB7, 0xE8, 0x82,
-    0xA6, 0x28, 0x9F, 0x45, 0xCC, 0x36, 0x9B, 0x64, 0x77, 0x73, 0xB6, 0x5B, 0x87, 0xC5, 0x7D, 0x49,
-    0x56, 0x9C, 0xF3, 0x21, 0x9C, 0x4E, 0xBF, 0xFC, 0xB7, 0x66, 0xC9, 0xFF, 0x35, 0x46, 0xD8, 0xEC,
-    0x70, 0xF8, 0xCB, 0xDC, 0x87, 0x90, 0xF7, 0xAD, 0x6F, 0xD1, 0xF5, 0x6A, 0x1B, 0x5D, 0xF8, 0x14,
-    0x3B, 0xAA, 0x62, 0xA6, 0x9B, 0xBD, 0x92, 0x88, 0xBD, 0xED, 0x65, 0x95, 0xFC, 0x51, 0xB5, 0xE4,
-    0xEE, 0x9C, 0xAE, 0x65, 0xD3, 0x9D, 0x2E, 0xD0, 0x93, 0x9D, 0x33, 0x94, 0x59, 0x37, 0xA2, 0x58,
-    0x2B, 0xF4, 0x65, 0xDB, 0xA8, 0x88, 0x73, 0xBF, 0x6D, 0x47, 0x5F, 0x53, 0x9B, 0x48, 0xB4, 0xF4,
-    0x39, 0xCB, 0x7C, 0x8F, 0xEA, 0xA3, 0x86, 0x5D, 0x16, 0x13, 0x7D, 0x0E, 0xD0, 0x9B, 0x0D, 0x79,
-    0x6E, 0xC9, 0xA2, 0x51, 0x1B, 0x83, 0x0E, 0xC5, 0xC7, 0xBA, 0x83, 0x9F, 0xE2, 0xD9, 0x9F, 0x63,
-    0xEE, 0xA1, 0x7D, 0x45, 0x89, 0x42, 0x6D, 0xD8, 0x95, 0x4C, 0x58, 0x60, 0x06, 0xE0, 0x65, 0x45,
-    0x0B, 0xE2, 0xD3, 0x07, 0xEE, 0x21, 0x18, 0x64, 0x12, 0x3A, 0xDC, 0x53, 0x76, 0x81, 0x8B, 0x5A,
-    0x39, 0x98, 0xB6, 0x1C, 0x44, 0x68, 0xA7, 0x80, 0x28, 0x52, 0xFF, 0xB5, 0x42, 0x5E, 0x05, 0xF6,
-    0xBE, 0xA8, 0x29, 0x2F, 0x00, 0x38, 0x22, 0x8E, 0x96, 0x45, 0xFA, 0xB1, 0x53, 0xC3, 0x80, 0x2E,
-    0xE4, 0x39, 0xB6, 0xAB, 0xFB, 0xD6, 0x7E, 0xF2, 0xAE, 0x6C, 0x00, 0xEA, 0x43, 0x11, 0x5E, 0x6B,
-    0xC8, 0x3B, 0x89, 0xC9, 0xB0, 0xFA, 0x70, 0xAB, 0x21, 0x0F, 0x62, 0x93, 0x80, 0x92, 0xB8, 0x0B,
-    0xF2, 0x7E, 0x6F, 0x46, 0x1E, 0xCB, 0xDA, 0x08, 0x59, 0x56, 0x9C, 0xB4, 0x75, 0x64, 0xEC, 0xBD,
-    0xDB, 0x91, 0x78, 0x94, 0xFA, 0x6F, 0xDC, 0x4D, 0xCA, 0x4D, 0x90, 0xD2, 0xCD, 0xBC, 0x77, 0x40,
-    0xCA, 0xDF, 0x18, 0x96, 0x74, 0x74, 0xE2, 0xD2, 0x35, 0x8F, 0xDC, 0x46, 0x4C, 0x37, 0x6D, 0xCB,
-    0xEF, 0xFF, 0xFD, 0x82, 0x2F, 0xE1, 0xC9, 0x86, 0x2F, 0x83, 0xBB, 0xF8, 0x02, 0x15, 0xB0, 0x7C,
-    0xA9, 0x9A, 0x89, 0x3B, 0x33, 0xE3, 0xA1, 0x3B, 0xBE, 0xAB, 0x4A, 0xB8, 0x24, 0xCF, 0xC0, 0xE6,
-    0xA5, 0x09, 0x22, 0xD2, 0x4B, 0xB0, 0x54, 0xA7, 0xB4, 0xAE, 0xF5, 0xCB, 0x42, 0xA1, 0xC8, 0x4D,
-    0x04, 0x66, 0x6C, 0x54, 0x1E, 0x2A, 0x8E, 0xCC, 0xD9, 0x38, 0x33, 0x61, 0x68, 0xD2, 0x6A, 0x4F,
-    0xB1, 0x08, 0x96, 0xDC, 0x3D, 0xC0, 0x4A, 0x04, 0x73, 0xD8, 0xF9, 0xB6, 0x5D, 0x31, 0x89, 0x21,
-    0xF0, 0x62, 0xFC, 0xCC, 0xFC, 0x9F, 0x24, 0xFC, 0xF2, 0x38, 0xDB, 0x11, 0x7B, 0x4C, 0x05, 0x67,
-    0x4D, 0xE7, 0x59, 0x9B, 0x39, 0xE9, 0x52, 0x1E, 0x5A, 0x95, 0xA3, 0xDD, 0xA9, 0x53, 0x3D, 0x74,
-    0xCA, 0x2F, 0xB8, 0x2B, 0xCC, 0x86, 0xC9, 0x1A, 0x84, 0x0C, 0x14, 0x68, 0x2A, 0xF2, 0x66, 0xA1,
-    0x1B, 0xC3, 0xD6, 0x20, 0x17, 0x3B, 0x43, 0x22, 0xBC, 0x3C, 0xC8, 0x35, 0xF3, 0xD3, 0x9B, 0xF5,
-    0x7A, 0x2D, 0x7A, 0xAC, 0x9A, 0x06, 0xB0, 0xD5, 0x67, 0x4B, 0xC4, 0xAC, 0x95, 0x77, 0xED, 0xC2,
-    0x70, 0x6F, 0xAF, 0x57, 0x71, 0x77, 0x03, 0x18, 0x6C, 0x8B, 0xAA, 0x7F, 0xB8, 0xB7, 0x97, 0x66,
-    0xAD, 0x91, 0x16, 0x59, 0x61, 0x53, 0x09, 0x9B, 0xE4, 0x0C, 0x43, 0x37, 0xAF, 0x58, 0x12, 0xA6,
-    0x80, 0xD8, 0x44, 0x69, 0xD8, 0x62, 0xD2, 0x93, 0x84, 0x3D, 0x29, 0xEC, 0x39, 0x01, 0xE0, 0x2E,
-    0xE0, 0x50, 0x17, 0x5D, 0xA7, 0x54, 0xEC, 0x96, 0x85, 0x52, 0x4C, 0xAA, 0xB0, 0x57, 0xAD, 0x56,
-    0x5A, 0x6D, 0x9F, 0x37, 0x69, 0x10, 0x25, 0x82, 0xF4, 0x66, 0xD2, 0x59, 0x7D, 0x8E, 0xAE, 0x09,
-    0x0A, 0x41, 0x92, 0xE7, 0x57, 0xB0, 0x53, 0x49, 0x93, 0x81, 0xBF, 0xEB, 0x99, 0xD9, 0x15, 0x92,
-    0xB9, 0x4A, 0x3A, 0x6B, 0x30, 0x27, 0x5A, 0xD5, 0x1E, 0x1A, 0x92, 0x2A, 0xA4, 0x95, 0xC4, 0x32,
-    0xB0, 0x37, 0xB6, 0x2B, 0x94, 0x3D, 0x36, 0xDA, 0x52, 0x43, 0x8A, 0x85, 0x31, 0x82, 0xDE, 0x4E,
-    0x33, 0xCC, 0xBE, 0xEF, 0x5A, 0xDB, 0x37, 0x6C, 0x71, 0x15, 0x73, 0xB1, 0xE5, 0x48, 0xB4, 0xA7,
-    0x99, 0x7F, 0x2B, 0xBA, 0xFB, 0x50, 0x19, 0x75, 0xE7, 0xD7, 0x6C, 0x5F, 0xAF, 0x4B, 0x0A, 0x46,
-    0xFB, 0x0C, 0x1F, 0x38, 0xC5, 0x07, 0x80, 0xBD, 0x71, 0x77, 0x9B, 0x9D, 0x83, 0xCE, 0x2D, 0xB6,
-    0x0E, 0x46, 0xEC, 0x55, 0x72, 0x35, 0xE5, 0xDE, 0x59, 0x04, 0x6D, 0x43, 0xC5, 0x75, 0x34, 0x78,
-    0x0C, 0xC5, 0xFD, 0x1B, 0x44, 0x8C, 0xFD, 0x79, 0x0B, 0xC8, 0xEA, 0xEA, 0x0A, 0x53, 0x45, 0x64,
-    0xC8, 0x29, 0x52, 0x47, 0x33, 0xEE, 0xD1, 0x90, 0x47, 0x9C, 0x7F, 0x8B, 0xB1, 0x0C, 0xCC, 0x39,
-    0xE4, 0x89, 0x39, 0x68, 0x98, 0x74, 0x97, 0x46, 0x3D, 0x48, 0x23, 0x9A, 0xEE, 0x9E, 0xD1, 0x22,
-    0xC1, 0x9E, 0x04, 0x8A, 0x16, 0x64, 0xDB, 0xA9, 0x6D, 0xCA, 0xF3, 0xA6, 0x7B, 0x1B, 0x5B, 0x34,
-    0xE3, 0x31, 0x16, 0x8F, 0x17, 0x8C, 0xB3, 0xE2, 0x1A, 0xAF, 0x86, 0x64, 0xDC, 0x2A, 0x7B, 0x08,
-    0x33, 0x3A, 0x52, 0xC1, 0xC8, 0xF6, 0x10, 0x13, 0xB6, 0x1C, 0x83, 0xD8, 0x7F, 0x18, 0x7B, 0x65,
-    0x27, 0x4C, 0xC7, 0xD1, 0xF1, 0xB2, 0x15, 0xE6, 0x43, 0xFF, 0xF5, 0x3C, 0xCC, 0xEB, 0x59, 0xC6,
-    0x83, 0x32, 0x1A, 0x99, 0x59, 0xA0, 0xC4, 0x46, 0x90, 0xDD, 0x03, 0xD2, 0x73, 0x5E, 0x4A, 0xBC,
-    0x3A, 0x72, 0x3F, 0xBE, 0x9E, 0x99, 0xF5, 0xB2, 0x17, 0x55, 0xAD, 0xE0, 0x62, 0x70, 0xF6, 0xDD,
-    0x33, 0x1F, 0x7E, 0x50, 0x75, 0x4C, 0x7B, 0x43, 0x5B, 0x94, 0xE5, 0xD0, 0x4B, 0x5F, 0x3A, 0x62,
-    0xB8, 0x33, 0xC6, 0x46, 0x68, 0xA7, 0xAF, 0x04, 0xB8, 0xFC, 0xA8, 0x15, 0x60, 0x5A, 0xBF, 0x95,
-    0x59, 0xC4, 0xB0, 0xFE, 0x19, 0x11, 0xC3, 0x2B, 0x59, 0x7B, 0x97, 0x55, 0xAD, 0xD8, 0x5E, 0x76,
-    0xD4, 0x02, 0xF7, 0xEB, 0x7A, 0xA3, 0xAE, 0x8B, 0x7D, 0x1D, 0x51, 0x74, 0xCF, 0x77, 0x7F, 0xCE,
-    0x67, 0x47, 0x25, 0xF8, 0xB9, 0xB2, 0xE9, 0x18, 0x95, 0xFB, 0xA6, 0x06, 0xF0, 0x18, 0x4B, 0x38,
-    0x2F, 0x3B, 0xE7, 0xE5, 0x6F, 0xEA, 0xCB, 0x75, 0x9E, 0x5C, 0xFD, 0xF8, 0xCD, 0x2A, 0x2C, 0x58,
-    0x92, 0x47, 0x30, 0x8A, 0x28, 0x0E, 0x1C, 0x2F, 0x68, 0x09, 0x98, 0x50, 0x67, 0x7F, 0x7E, 0x24,
-    0x2D, 0x16, 0x49, 0x16, 0x25, 0x79, 0x31, 0xF4, 0xC8, 0x9D, 0x17, 0x18, 0xCA, 0x96, 0xF3, 0x9E,
-    0xBC, 0x64, 0xEE, 0xC1, 0x34, 0x22, 0x76, 0xCE, 0x41, 0x15, 0x9E, 0xD7, 0x88, 0x17, 0x00, 0x36,
-    0xC8, 0x5A, 0xAC, 0x80, 0x24, 0x4C, 0x8B, 0x30, 0x04, 0xA4, 0x41, 0x45, 0x7C, 0xCB, 0xCC, 0xCC,
-    0x02, 0x3A, 0xF9, 0xD9, 0x5E, 0xDC, 0xB2, 0x22, 0x07, 0x07, 0x0C, 0xE0, 0x87, 0x3D, 0x44, 0x7B,
-    0x88, 0xF5, 0x08, 0x7F, 0x33, 0xF8, 0xD2, 0xE5, 0x84, 0xD5, 0xF3, 0x25, 0xC3, 0xC8, 0x28, 0x64,
-    0x02, 0x7F, 0x01, 0x92, 0x96, 0x67, 0x38, 0x89, 0xEA, 0xDC, 0x53, 0xEB, 0x50, 0x71, 0x6E, 0x1A,
-    0x84, 0x88, 0xAE, 0x08, 0xF7, 0x60, 0x72, 0xF7, 0x06, 0xE2, 0xAC, 0xB1, 0xDD, 0x28, 0x16, 0xF3,
-    0xEA, 0xD2, 0x61, 0xFD, 0x69, 0xC9, 0xAE, 0x64, 0xB6, 0xAB, 0xCC, 0x98, 0x30, 0x5D, 0x92, 0x05,
-    0x30, 0x8F, 0x86, 0xE6, 0x2C, 0x26, 0xF4, 0x1C, 0x33, 0xE6, 0x65, 0xCF, 0x12, 0x88, 0x70, 0x6E,
-    0x68, 0x7C, 0xC6, 0x7C, 0x0C, 0xC8, 0xE8, 0xD6, 0x85, 0x3B, 0x7A, 0x59, 0x99, 0xBC, 0x3C, 0x77,
-    0x4E, 0xF7, 0x6C, 0x53, 0x34, 0x4D, 0x9B, 0xE2, 0x8D, 0xBD, 0x6D, 0x8A, 0xDD, 0x79, 0x9B, 0x62,
-    0x71, 0xEF, 0x36, 0xC5, 0x09, 0x51, 0x51, 0xDE, 0x58, 0x41, 0x2D, 0xE4, 0x56, 0x33, 0x8E, 0xBF,
-    0xB4, 0xA7, 0xC1, 0x60, 0xB8, 0x68, 0x30, 0x28, 0x3E, 0xB5, 0xC1, 0xA0, 0x8B, 0x75, 0x6C, 0xED,
-    0x5F, 0x6F, 0xAC, 0xA0, 0x03, 0x32, 0x76, 0xE6, 0x5D, 0x58, 0xBB, 0x44, 0x4D, 0x8D, 0x5A, 0x1A,
-    0x1A, 0x1A, 0xB5, 0x33, 0x3C, 0xA1, 0x80, 0xF0, 0xDF, 0xE8, 0x19, 0x99, 0x48, 0x4F, 0x82, 0xC8,
-    0x5D, 0xF7, 0x69, 0x67, 0x32, 0xAD, 0x0B, 0xF3, 0x92, 0x4C, 0xB6, 0x9B, 0xA6, 0x1F, 0x42, 0xD5,
-    0x3F, 0x99, 0x21, 0x9D, 0xC7, 0xE0, 0x5D, 0x56, 0xFE, 0xB4, 0xAE, 0xB7, 0xDF, 0x3E, 0xB9, 0x4A,
-    0x67, 0x11, 0x93, 0x43, 0x6C, 0x67, 0xD6, 0xA6, 0x7F, 0x70, 0x3B, 0x23, 0xBF, 0xA1, 0xED, 0x2E,
-    0xD0, 0x75, 0xBB, 0xF0, 0xAF, 0xBF, 0x57, 0x06, 0x93, 0xA8, 0x09, 0xB7, 0xF7, 0xD0, 0xFC, 0x18,
-    0x65, 0xC6, 0xB4, 0x84, 0xA5, 0xF3, 0x16, 0x46, 0xAE, 0x58, 0xCA, 0x1A, 0x68, 0x46, 0xBF, 0x07,
-    0x0B, 0x57, 0xB2, 0x09, 0x7A, 0xF7, 0xD0, 0x04, 0xDB, 0x6B, 0x9C, 0xAD, 0x27, 0x9B, 0xDE, 0x95,
-    0x3D, 0xDD, 0xB4, 0xA3, 0x5C, 0xDC, 0x3D, 0x2D, 0x77, 0xA1, 0x65, 0x2E, 0xD8, 0x60, 0xFB, 0x27,
-    0x9A, 0xBA, 0x9F, 0xED, 0x9F, 0x00, 0xE6, 0x99, 0xF5, 0x4F, 0xAC, 0xCC, 0xFB, 0x27, 0x5C, 0x26,
-    0xC2, 0xEE, 0xEA, 0x07, 0x3C, 0x7C, 0x4F, 0xA2, 0x8E, 0x82, 0x28, 0xD3, 0x0B, 0x8F, 0x9F, 0x29,
-    0x93, 0x47, 0x41, 0xD4, 0xFF, 0x51, 0xA2, 0x64, 0x04, 0xA2, 0xBE, 0xDD, 0x12, 0xA7, 0x00, 0xC6,
-    0xC0, 0xAD, 0x47, 0x9B, 0xF5, 0x81, 0x5B, 0xFB, 0x29, 0x78, 0x3C, 0x09, 0x1F, 0x6C, 0x7B, 0x6F,
-    0x9D, 0xC8, 0xA7, 0x53, 0xA5, 0x00, 0xBE, 0xF8, 0x41, 0x78, 0x69, 0x3C, 0xCD, 0x7E, 0xAE, 0xC1,
-    0x3D, 0x62, 0x0D, 0xA2, 0x89, 0xD3, 0x2F, 0xC3, 0xCF, 0x54, 0xE1, 0xED, 0x13, 0xF9, 0xBC, 0xF5,
-    0x34, 0x5E, 0xB4, 0x9E, 0xE2, 0x61, 0x33, 0xA0, 0x48, 0xE8, 0xF1, 0x93, 0xBB, 0x4E, 0x3D, 0x2C,
-    0x1D, 0xCA, 0x58, 0x33, 0xEB, 0x5C, 0x1D, 0x7A, 0x70, 0xCB, 0xEB, 0x5A, 0x48, 0x5D, 0x54, 0x62,
-    0xCD, 0xA7, 0x55, 0x62, 0x69, 0xBD, 0xF5, 0x58, 0x53, 0x3F, 0x5D, 0x87, 0x00, 0xBB, 0x4C, 0x5A,
-    0x47, 0x8F, 0x21, 0xB6, 0xB8, 0xF5, 0x42, 0x26, 0x17, 0xD7, 0x2A, 0x67, 0xF4, 0x3C, 0x4B, 0x3E,
-    0x51, 0xBD, 0x93, 0xEA, 0x5E, 0xA8, 0x58, 0xB4, 0x67, 0x49, 0x4C, 0x75, 0x0F, 0x17, 0xE5, 0xDF,
-    0xC1, 0x01, 0x60, 0x67, 0x02, 0x84, 0x7D, 0xD2, 0x14, 0xF6, 0x85, 0x55, 0xFB, 0xDD, 0xB6, 0xB0,
-    0x88, 0x1C, 0x8B, 0xF9, 0xB0, 0x8C, 0xCE, 0xDE, 0x78, 0x65, 0xEC, 0xD7, 0xD3, 0xD4, 0x69, 0x12,
-    0x31, 0xA1, 0x1E, 0x1B, 0x3A, 0x22, 0xFD, 0x8D, 0x8C, 0xC7, 0x44, 0xF6, 0x3B, 0x94, 0xFB, 0x4A,
-    0x92, 0x26, 0x94, 0x66, 0xAA, 0xA7, 0x37, 0x3D, 0xFC, 0xBB, 0x12, 0x99, 0x34, 0x90, 0xA4, 0x91,
-    0xCC, 0xF3, 0x14, 0xC9, 0x8A, 0xF8, 0x6C, 0x8F, 0x4F, 0xD0, 0x6A, 0xFF, 0x22, 0x6D, 0xE4, 0x18,
-    0x8B, 0x30, 0x70, 0xCB, 0x23, 0xBF, 0x76, 0x54, 0xBF, 0x9C, 0x52, 0xD3, 0x95, 0x49, 0xB4, 0x27,
-    0xE9, 0x7A, 0x74, 0x91, 0x74, 0xC9, 0xF4, 0x48, 0x0A, 0x8C, 0xBA, 0x0E, 0x69, 0x7C, 0x7A, 0x25,
-    0x02, 0x73, 0xD9, 0x8C, 0xE8, 0xB2, 0xA2, 0xE0, 0x2C, 0xDE, 0xBD, 0xB7, 0xAE, 0x70, 0xA8, 0x53,
-    0x1F, 0x1B, 0xCD, 0x87, 0xEA, 0xD2, 0x6B, 0x22, 0x82, 0xF0, 0xA7, 0x6C, 0xA6, 0x0A, 0xB7, 0x99,
-    0xCB, 0x0E, 0x72, 0xE6, 0xAE, 0xFD, 0xBC, 0xC7, 0xAA, 0x7D, 0xC1, 0x1A, 0x1F, 0x3B, 0x3C, 0x61,
-    0x00, 0xB4, 0x66, 0xE5, 0x19, 0x7B, 0xE2, 0x45, 0x0E, 0x69, 0x9A, 0x2A, 0x48, 0x39, 0x08, 0x3B,
-    0xFE, 0x16, 0xD5, 0xF0, 0xAF, 0xB2, 0x7B, 0xF1, 0x33, 0xE3, 0x13, 0xE2, 0xF0, 0xAD, 0xD4, 0x56,
-    0x3B, 0xFF, 0xCB, 0xAE, 0x9E, 0xCE, 0x48, 0xB4, 0xCF, 0x8A, 0x26, 0x87, 0x06, 0x1E, 0x11, 0xA5,
-    0x9E, 0x26, 0xD3, 0x93, 0x30, 0xA9, 0x15, 0x00, 0xE0, 0x1C, 0x84, 0x3E, 0xD1, 0xA8, 0xD4, 0x04,
-    0xA0, 0x2D, 0xC9, 0xDE, 0x2B, 0x4E, 0xC1, 0xE2, 0x80, 0xD8, 0xC3, 0x63, 0x95, 0x63, 0x02, 0x75,
-    0x13, 0xDA, 0xD5, 0x97, 0xA8, 0x59, 0x54, 0xCD, 0x62, 0x3B, 0xA8, 0xA4, 0x7D, 0xCD, 0xF8, 0xCC,
-    0x1B, 0x77, 0x46, 0x0C, 0x28, 0x80, 0x02, 0x05, 0x0F, 0x29, 0xE4, 0x75, 0x0B, 0xDD, 0x60, 0x6E,
-    0x3D, 0x81, 0xA4, 0x36, 0xB6, 0xB5, 0x98, 0xB7, 0x29, 0x84, 0xF0, 0xDE, 0x2B, 0x15, 0x1A, 0x0E,
-    0xF4, 0x54, 0x8C, 0x5A, 0x63, 0x02, 0xF5, 0x0D, 0xA0, 0x1D, 0xF8, 0xF8, 0x76, 0x79, 0xC4, 0xBA,
-    0x1B, 0x0D, 0x58, 0x4D, 0x73, 0x84, 0x4E, 0xFB, 0x7B, 0x0E, 0xAD, 0x20, 0x1C, 0x85, 0xE7, 0x38,
-    0x91, 0xD2, 0x17, 0x07, 0x70, 0x2A, 0x31, 0xDB, 0x4C, 0x5A, 0xDA, 0x36, 0x17, 0xDB, 0x46, 0x6D,
-    0xDA, 0xE0, 0x81, 0x5B, 0x76, 0xF3, 0xB0, 0xDA, 0x55, 0x86, 0x36, 0x78, 0x85, 0x1E, 0x39, 0x9E,
-    0x63, 0xE5, 0x2F, 0x8E, 0xEA, 0xEF, 0x75, 0xAC, 0x43, 0xC1, 0xA6, 0x69, 0xF0, 0xE6, 0x29, 0x3D,
-    0x8B, 0xC2, 0x13, 0x14, 0x7B, 0xA0, 0xE6, 0x17, 0x83, 0xF7, 0x4B, 0x16, 0x2A, 0xCF, 0x5C, 0xC2,
-    0x40, 0x0E, 0x80, 0x9F, 0xDD, 0xDD, 0x79, 0x16, 0xF1, 0x3E, 0xC5, 0x23, 0x93, 0x44, 0x0B, 0x92,
-    0x3A, 0x07, 0x9D, 0xAF, 0x9E, 0x7B, 0x28, 0x55, 0xA0, 0xBF, 0x68, 0x3C, 0x52, 0x2E, 0xE2, 0x91,
-    0x62, 0xEE, 0x74, 0xB0, 0x57, 0x5F, 0xCA, 0x97, 0x31, 0x57, 0xDC, 0x2D, 0xF7, 0x65, 0xAB, 0x06,
-    0x56, 0x02, 0x8E, 0xCA, 0x41, 0xD8, 0x69, 0x4D, 0xC5, 0x01, 0x75, 0x0C, 0x07, 0x32, 0x1E, 0x7A,
-    0xE3, 0xF5, 0x93, 0x55, 0x7B, 0x6C, 0x9C, 0x27, 0x4C, 0x73, 0x6A, 0x15, 0xC0, 0xA2, 0x9B, 0xEF,
-    0x3B, 0xD5, 0xFA, 0x92, 0x9E, 0x32, 0xEC, 0x33, 0x6B, 0xD0, 0xE5, 0x51, 0xA1, 0x76, 0x19, 0x22,
-    0xCE, 0xD8, 0xF4, 0xFE, 0x51, 0x82, 0x9E, 0xF3, 0x9B, 0xCC, 0x7B, 0x43, 0x06, 0xEC, 0x7F, 0x4B,
-    0x62, 0x87, 0xAD, 0xB0, 0x62, 0x2A, 0x6F, 0x3B, 0x5F, 0x8B, 0x9D, 0xF2, 0x17, 0xC0, 0x47, 0x9B,
-    0xCB, 0x2D, 0x3F, 0x4B, 0xFC, 0xA7, 0xC1, 0x70, 0xE7, 0x7A, 0x5A, 0xF9, 0x79, 0x3F, 0x67, 0x99,
-    0xBE, 0xC0, 0x15, 0x4F, 0x7B, 0xBB, 0x79, 0x34, 0x6B, 0x06, 0x5E, 0x14, 0xCA, 0x28, 0x66, 0xD4,
-    0xAE, 0x11, 0xCB, 0xD0, 0x83, 0xE9, 0x96, 0x84, 0x25, 0x6B, 0x04, 0x0F, 0x1A, 0x6F, 0xE2, 0x0F,
-    0x9D, 0xF7, 0x9C, 0x77, 0xE5, 0x66, 0xFE, 0x3F, 0xF3, 0xFF, 0x55, 0xC6, 0x3F, 0x89, 0x37, 0xC3,
-    0x47, 0x1F, 0x8F, 0xFD, 0xB3, 0xFF, 0x39, 0x74, 0x8B, 0xEB, 0x7E, 0x66, 0xBA, 0xA7, 0xCB, 0x38,
-    0xCC, 0x47, 0xF8, 0x44, 0xD9, 0x75, 0x66, 0x02, 0x36, 0xCB, 0x82, 0x3E, 0xFC, 0x3B, 0x59, 0x55,
-    0xF6, 0x6B, 0xB4, 0x00, 0xFA, 0xB5, 0xED, 0xE9, 0xE0, 0x9E, 0x33, 0xA3, 0x64, 0x8B, 0xD0, 0xCA,
-    0xFE, 0x32, 0xD7, 0x66, 0x08, 0xED, 0x1D, 0x08, 0xB1, 0x0A, 0x9E, 0x3F, 0xF1, 0xF3, 0x35, 0x9E,
-    0x39, 0x12, 0x67, 0xE7, 0x95, 0x9C, 0x47, 0x9D, 0xE5, 0xD4, 0x6A, 0x4F, 0x4D, 0x4D, 0xDB, 0x9E,
-    0x17, 0x19, 0x40, 0x38, 0x5B, 0x2C, 0xF5, 0xE5, 0xF2, 0xAD, 0x43, 0xB2, 0x04, 0x1B, 0x71, 0x1D,
-    0xCC, 0xD7, 0x64, 0xCF, 0xA1, 0x6C, 0x25, 0xDA, 0x5D, 0x83, 0x79, 0x02, 0x3C, 0x0B, 0xF2, 0x60,
-    0xBB, 0x70, 0x7F, 0x05, 0x69, 0x1A, 0xB0, 0x1F, 0x05, 0x4E, 0x7A, 0x96, 0x90, 0x0D, 0x6F, 0xFC,
-    0xC8, 0xB1, 0x2D, 0xD1, 0x4D, 0xFE, 0x1B, 0xB6, 0xBF, 0x97, 0xEC, 0xE9, 0x4E, 0xE1, 0x89, 0xA0,
-    0xDC, 0xC2, 0x49, 0x12, 0x78, 0x33, 0xD7, 0x9A, 0x9A, 0x77, 0xB9, 0x50, 0xFA, 0x78, 0x56, 0xB3,
-    0xC3, 0x5E, 0x83, 0x0B, 0xEC, 0x85, 0x30, 0x3C, 0xAC, 0x09, 0x6A, 0xAA, 0x80, 0xC7, 0xC3, 0x40,
-    0x5D, 0xDB, 0x36, 0xD1, 0x6A, 0x36, 0x9D, 0x15, 0xCC, 0xCB, 0xB3, 0x36, 0x92, 0x2F, 0x4E, 0x9C,
-    0xC3, 0x1E, 0x15, 0xC6, 0xB8, 0x78, 0x0F, 0x98, 0x84, 0x63, 0xE7, 0x87, 0xD8, 0x4A, 0x9F, 0x68,
-    0x4D, 0xD4, 0x56, 0xFE, 0xB0, 0x07, 0xC9, 0x2A, 0x00, 0x79, 0xDE, 0xAF, 0xD9, 0xEB, 0xBE, 0x7E,
-    0x21, 0x93, 0xF6, 0x85, 0xB1, 0x9E, 0xD3, 0xA2, 0x33, 0xB9, 0xFD, 0xAC, 0x61, 0xB8, 0x68, 0xFB,
-    0x66, 0x18, 0x87, 0xC1, 0x85, 0xD3, 0x6B, 0xE9, 0x41, 0xF8, 0x44, 0xDF, 0xE5, 0x0F, 0x9D, 0xC3,
-    0x99, 0x5F, 0x77, 0x10, 0x52, 0x7D, 0x6F, 0xFA, 0xD4, 0x76, 0x11, 0x95, 0x11, 0x0F, 0x32, 0xF4,
-    0x60, 0x23, 0xFD, 0x77, 0xC0, 0xE0, 0xDD, 0x16, 0x4B, 0x83, 0x90, 0x7B, 0x8C, 0xE0, 0x63, 0xC3,
-    0xE1, 0x36, 0xA4, 0x8D, 0xF0, 0xF7, 0x48, 0xF7, 0x62, 0x7D, 0xBD, 0xE8, 0x3F, 0x3F, 0xEF, 0x47,
-    0x5B, 0xE6, 0xE1, 0x15, 0xA8, 0xDC, 0x74, 0xB6, 0xE1, 0x61, 0x3D, 0xC6, 0x32, 0xB2, 0x45, 0xAE,
-    0x69, 0x96, 0x5A, 0x7D, 0x91, 0xAD, 0x3D, 0x59, 0x78, 0xE1, 0xBC, 0xF3, 0x89, 0x54, 0x14, 0x0D,
-    0xBE, 0x76, 0xE7, 0xE4, 0x4D, 0xD7, 0x7B, 0xE6, 0xCF, 0xBA, 0xDE, 0xD9, 0x74, 0x18, 0xD5, 0x12,
-    0x3D, 0x0F, 0x3B, 0xB4, 0x86, 0x90, 0xC8, 0xCB, 0xDB, 0xCE, 0x4E, 0x9D, 0x8E, 0xA6, 0xB4, 0xD6,
-    0xCC, 0xDD, 0x95, 0xDA, 0xA4, 0x18, 0xC2, 0xFB, 0x8D, 0xE6, 0x27, 0x7B, 0x0F, 0x81, 0x0D, 0x5D,
-    0x04, 0xC4, 0x05, 0x4F, 0xBD, 0xBB, 0xB3, 0xB3, 0x5F, 0x4D, 0x12, 0x63, 0x20, 0xFF, 0x71, 0xA3,
-    0x6C, 0xD7, 0xF5, 0x53, 0xB7, 0xD3, 0x1E, 0xEC, 0xE8, 0x4D, 0x98, 0xB5, 0xA7, 0x53, 0x19, 0x32,
-    0x0F, 0x3B, 0x01, 0x6C, 0xA9, 0x99, 0x4C, 0x6A, 0x46, 0xFA, 0x21, 0x0F, 0xA0, 0x1C, 0x3E, 0xA6,
-    0x35, 0x37, 0x9B, 0x4B, 0xFE, 0xBD, 0xA1, 0x57, 0x4F, 0xA2, 0xBF, 0xC7, 0x86, 0x57, 0x3D, 0xC7,
-    0xF4, 0xFC, 0xA2, 0x3B, 0x4A, 0xA3, 0xB9, 0x15, 0x66, 0xF7, 0x25, 0xFB, 0x3D, 0xEF, 0x33, 0x19,
-    0x56, 0x64, 0xD7, 0x66, 0xE3, 0x7E, 0x61, 0xAA, 0x66, 0x32, 0x6F, 0x55, 0x6E, 0x7F, 0x79, 0xE9,
-    0x5F, 0x1D, 0xE9, 0x34, 0xF3, 0x9E, 0xCD, 0xE7, 0xEF, 0x7B, 0x70, 0xE7, 0x57, 0x87, 0x74, 0x1A,
-    0x1E, 0x2C, 0x66, 0xBC, 0x0F, 0xA7, 0x6D, 0x59, 0xBE, 0x2E, 0x43, 0x9B, 0xF5, 0x96, 0x83, 0xE7,
-    0x81, 0x68, 0xDC, 0x9F, 0x4D, 0x9A, 0x76, 0xD3, 0x16, 0x50, 0x0B, 0xDB, 0xE5, 0xDB, 0x62, 0xBB,
-    0x82, 0xFD, 0xED, 0x6B, 0xBB, 0x81, 0x7D, 0x4E, 0x91, 0xF3, 0xAE, 0xE6, 0x8D, 0x38, 0xF1, 0x58,
-    0xEF, 0x80, 0xD5, 0xF4, 0x0B, 0x75, 0xC0, 0x87, 0x47, 0x99, 0x3A, 0x79, 0xAF, 0xF9, 0xDD, 0x16,
-    0x8C, 0x4F, 0x1E, 0x80, 0x7D, 0x9A, 0x6E, 0x98, 0xF9, 0x79, 0xA6, 0xD5, 0xD5, 0x94, 0x38, 0x68,
-    0xF5, 0x84, 0x4D, 0x50, 0xD8, 0x20, 0x0A, 0x7C, 0xA7, 0x90, 0xAD, 0x8B, 0x6A, 0xA3, 0x3B, 0x9E,
-    0xF7, 0x16, 0xED, 0xD1, 0xB4, 0xF1, 0x41, 0x68, 0x39, 0x60, 0x94, 0x6D, 0x76, 0x1B, 0x4D, 0x64,
-    0xDE, 0xE6, 0x72, 0xFF, 0xCF, 0xF4, 0x76, 0xA7, 0x0D, 0x08, 0x3C, 0xCA, 0xEE, 0x8E, 0x7D, 0xED,
-    0x96, 0x4B, 0xF6, 0xF3, 0x9B, 0xB0, 0x51, 0x6B, 0x32, 0x69, 0xC9, 0x7A, 0x90, 0xF7, 0x9F, 0x98,
-    0x7E, 0x9C, 0xB7, 0x2B, 0x23, 0xFB, 0x65, 0x64, 0x10, 0xEF, 0x15, 0xD6, 0xFB, 0x4D, 0x22, 0x45,
-    0xD8, 0xCF, 0x18, 0xE4, 0x35, 0x67, 0x43, 0x3E, 0x67, 0x81, 0xEF, 0x47, 0xEE, 0xDD, 0xFE, 0x24,
-    0x0A, 0xD3, 0xBB, 0xF2, 0x71, 0x9F, 0xD5, 0x81, 0x94, 0x6A, 0x5B, 0x8D, 0xF3, 0x79, 0x3B, 0x90,
-    0x44, 0xF9, 0x30, 0x37, 0x2C, 0x8B, 0x86, 0xA4, 0x8E, 0x6D, 0x48, 0xEA, 0x31, 0x3D, 0xD9, 0xAA,
-    0xA4, 0xF3, 0xC9, 0x86, 0xA4, 0xFF, 0xFF, 0x2D, 0x51, 0xF6, 0xA7, 0xE2, 0x54, 0x4B, 0xF2, 0xD5,
-    0x91, 0x64, 0x3B, 0xED, 0xEF, 0xC1, 0xA3, 0xCF, 0x49, 0x21, 0xCC, 0xAB, 0x9E, 0x76, 0x90, 0xFB,
-    0x7C, 0xF0, 0x10, 0x52, 0xDC, 0x6A, 0x8E, 0x90, 0xD3, 0x44, 0x4C, 0xDC, 0x17, 0x27, 0xBC, 0x97,
-    0x75, 0xDD, 0xAC, 0x9E, 0xB2, 0x17, 0xD4, 0xA6, 0xC4, 0x81, 0xAC, 0x2F, 0x5D, 0xDB, 0xF5, 0xEC,
-    0xA1, 0x64, 0x1F, 0xEA, 0xE9, 0x36, 0x4D, 0xAD, 0x4B, 0xFA, 0x0B, 0x08, 0x24, 0xD1, 0x8A, 0x07,
-    0x7F, 0x2B, 0x82, 0x36, 0x8E, 0xF3, 0xD4, 0x3B, 0xDB, 0xC9, 0x08, 0x50, 0x54, 0x8E, 0x62, 0x18,
-    0xC8, 0x80, 0xD4, 0xED, 0x36, 0x91, 0xCC, 0xAC, 0x0D, 0x1A, 0xC8, 0x46, 0x47, 0x5D, 0x30, 0xCA,
-    0x53, 0xDE, 0x17, 0x4D, 0xE0, 0x70, 0x50, 0xBB, 0xE7, 0x07, 0xCD, 0x2F, 0x44, 0x61, 0x89, 0x85,
-    0x6D, 0x56, 0x31, 0xB1, 0x1D, 0xC8, 0x5A, 0xC6, 0x5E, 0x3C, 0xCA, 0x2A, 0x36, 0x86, 0x7F, 0xD0,
-    0xD8, 0x26, 0x35, 0x26, 0x01, 0x67, 0x01, 0x5F, 0x6C, 0x53, 0x71, 0x6C, 0x9D, 0xEA, 0xCF, 0x27,
-    0x30, 0x9B, 0xFB, 0x00, 0xD6, 0xFD, 0xFF, 0xD5, 0x1D, 0xBA, 0x0A, 0x38, 0x1D, 0xD8, 0x5F, 0x59,
-    0x84, 0x40, 0x5F, 0xC1, 0x4A, 0xC2, 0xA7, 0x32, 0xA6, 0x64, 0xB1, 0x8B, 0x30, 0xD6, 0xC7, 0xB2,
-    0xA6, 0xD8, 0xD8, 0x04, 0x69, 0x45, 0x53, 0x03, 0x8B, 0xC4, 0x96, 0x72, 0x14, 0x0F, 0xB6, 0xE8,
-    0xFE, 0xB6, 0x31, 0x2E, 0x73, 0x92, 0xCB, 0x0C, 0x08, 0xAB, 0x26, 0x5B, 0x39, 0x3B, 0x48, 0xD5,
-    0x17, 0xED, 0xAC, 0xDF, 0x97, 0xC2, 0xE7, 0x9E, 0xBF, 0x86, 0x8D, 0xC2, 0x83, 0xDE, 0x65, 0xC0,
-    0xCF, 0xD3, 0xF9, 0xAC, 0x7D, 0x63, 0x45, 0x4F, 0x0F, 0x2F, 0xA6, 0x69, 0x37, 0xBF, 0xA4, 0x85,
-    0xCD, 0x03, 0xC7, 0x71, 0xE7, 0x15, 0x70, 0xE0, 0x27, 0xC6, 0x2E, 0xCB, 0xA3, 0x4F, 0xDE, 0xB5,
-    0x67, 0xB5, 0x74, 0x5D, 0x41, 0x6E, 0xE5, 0x93, 0xDC, 0xE4, 0xC2, 0xA2, 0x72, 0xCF, 0x16, 0x2D,
-    0x4C, 0x96, 0x61, 0xD7, 0x3E, 0xF9, 0x09, 0xCD, 0x63, 0xF3, 0x58, 0x0F, 0x41, 0x2F, 0x8C, 0x6F,
-    0x15, 0x23, 0x94, 0xC2, 0x76, 0x45, 0xD7, 0xA6, 0x3C, 0xD8, 0xC5, 0xEE, 0xFE, 0x7B, 0xFF, 0xBE,
-    0x0F, 0xE2, 0xC0, 0xD0, 0xFE, 0x9A, 0x88, 0xE6, 0x30, 0xC1, 0x13, 0x33, 0x4B, 0x6F, 0xCF, 0xA7,
-    0x04, 0x45, 0xE5, 0x9B, 0xEE, 0x06, 0x60, 0xCA, 0x9F, 0xCB, 0x43, 0x77, 0xE7, 0xDB, 0x3F, 0xBD,
-    0x6E, 0xBE, 0xF7, 0x73, 0x32, 0xFB, 0x8D, 0x45, 0xFC, 0x0C, 0x17, 0xD9, 0xB5, 0x29, 0xFC, 0xF9,
-    0x01, 0x7D, 0xF7, 0xDC, 0x3D, 0x0A, 0xE6, 0x9B, 0xF3, 0x13, 0x1F, 0x36, 0x6A, 0x01, 0x1C, 0xA8,
-    0x17, 0xE7, 0x40, 0x62, 0x0D, 0x9C, 0x66, 0x3B, 0x4D, 0x68, 0xB4, 0x14, 0xEE, 0xDD, 0x91, 0xAF,
-    0xEE, 0x54, 0xF4, 0x5C, 0x4B, 0x2C, 0x2C, 0x9B, 0x09, 0xB0, 0xAC, 0x6C, 0x5A, 0x8F, 0x47, 0x79,
-    0x65, 0x4A, 0xDA, 0xBF, 0x7C, 0x75, 0x85, 0x5D, 0xC8, 0xB2, 0xD9, 0x79, 0xCE, 0xE0, 0xCB, 0x84,
-    0x3D, 0x91, 0x4F, 0x5E, 0x32, 0xF0, 0x58, 0x10, 0xEF, 0x2A, 0xB8, 0x8E, 0x2D, 0x1A, 0x55, 0x0D,
-    0xD1, 0xBF, 0x63, 0x97, 0x03, 0x5C, 0x22, 0xCB, 0x1D, 0x4D, 0xB3, 0x05, 0x0B, 0x64, 0x86, 0xE9,
-    0x3B, 0x61, 0x9F, 0x36, 0x7F, 0x3D, 0xD1, 0xED, 0x67, 0xE6, 0xBF, 0xAD, 0xE9, 0x91, 0x1D, 0xD0,
-    0x9F, 0xED, 0xFB, 0x6D, 0x4D, 0xB6, 0x7B, 0xA6, 0x64, 0x04, 0xE9, 0x69, 0x3C, 0xDC, 0xB9, 0xFF,
-    0x09, 0xFC, 0x59, 0x0B, 0x9F, 0x82, 0x57, 0xD3, 0x1C, 0x41, 0xC4, 0xA0, 0x3C, 0xB4, 0xD2, 0x02,
-    0x7E, 0x33, 0x91, 0x04, 0xC7, 0x0B, 0x06, 0x2F, 0xD4, 0x29, 0xC0, 0x2A, 0xF6, 0x52, 0xF4, 0x73,
-    0x09, 0x61, 0x73, 0xA0, 0x1E, 0x63, 0xB8, 0x7D, 0x19, 0x05, 0x84, 0xA0, 0xBA, 0x66, 0x5B, 0x6C,
-    0xE8, 0xDA, 0xF3, 0x1D, 0xBF, 0x85, 0xD4, 0x83, 0x27, 0x3F, 0x4A, 0x85, 0x6E, 0xE3, 0xF0, 0xE8,
-    0xDA, 0x6F, 0x21, 0xD5, 0xFE, 0x4A, 0x84, 0x7B, 0xD2, 0x74, 0x08, 0x0F, 0x8F, 0x78, 0xB8, 0x6C,
-    0x3F, 0x4D, 0x08, 0x6C, 0xBD, 0xFC, 0xFF, 0x01, 0xA5, 0x56, 0x4F, 0x68, 0x1B, 0xD9, 0x19, 0xFF,
-    0x66, 0x9E, 0x9C, 0xD9, 0x64, 0x6C, 0x3D, 0x51, 0x5C, 0x58, 0x88, 0xA5, 0xB9, 0xE4, 0x10, 0x8C,
-    0x64, 0xF5, 0x90, 0x82, 0x17, 0xC6, 0xD2, 0x24, 0x7B, 0x28, 0x34, 0x94, 0xFA, 0xB0, 0xEE, 0xAD,
-    0xAC, 0x8F, 0xED, 0x52, 0xB0, 0x0F, 0x2E, 0x88, 0xA2, 0xD8, 0x53, 0x72, 0x08, 0x0B, 0x7B, 0x08,
-    0x85, 0xF6, 0x56, 0xF0, 0x21, 0xA5, 0xC1, 0x7B, 0xA8, 0x58, 0x54, 0x2A, 0x8A, 0xB3, 0x7A, 0xB6,
-    0x0F, 0x81, 0xA6, 0xD0, 0x49, 0x2E, 0x85, 0xB6, 0x6C, 0x66, 0x9B, 0x2D, 0x3D, 0x04, 0xDA, 0xB7,
-    0xCD, 0xB4, 0xD1, 0xAE, 0x65, 0xBD, 0xFE, 0xBE, 0x99, 0x91, 0xEC, 0xF5, 0xDA, 0x81, 0xD2, 0x27,
-    0xCD, 0xBC, 0x79, 0xDF, 0xFB, 0xDE, 0xF7, 0x7E, 0xEF, 0xFB, 0xFB, 0x88, 0x66, 0x68, 0xA6, 0x3E,
-    0xDC, 0x7E, 0xF2, 0xDE, 0x25, 0xBA, 0x4A, 0xDB, 0x76, 0x78, 0x46, 0x47, 0xDC, 0xE6, 0x2C, 0x25,
-    0x47, 0x73, 0x57, 0xE7, 0xCE, 0x66, 0xC9, 0x3A, 0x9A, 0xBF, 0x6F, 0x3E, 0x5E, 0xC9, 0xDF, 0x4D,
-    0x63, 0x3C, 0x63, 0xD4, 0xFC, 0xCE, 0xFD, 0xA6, 0x19, 0x7E, 0x75, 0x65, 0x79, 0x7E, 0x07, 0x0D,
-    0xDF, 0x68, 0x18, 0xA2, 0x9D, 0x41, 0x69, 0xC9, 0x8A, 0x78, 0x18, 0x7E, 0x1A, 0xFB, 0xFF, 0xE3,
-    0x07, 0xF0, 0x4D, 0xAD, 0xBC, 0x55, 0x37, 0x43, 0xBC, 0xF1, 0xBD, 0x65, 0x06, 0xEF, 0xEC, 0xDC,
-    0xB3, 0x94, 0xEF, 0x06, 0xBA, 0xE1, 0x44, 0xB3, 0x24, 0xA2, 0x5D, 0x79, 0x5D, 0xD7, 0x44, 0x58,
-    0x22, 0x11, 0xB7, 0xDD, 0x50, 0x57, 0x84, 0x22, 0xF2, 0xD1, 0xAA, 0xE5, 0x82, 0xA5, 0xB6, 0xA5,
-    0x13, 0x74, 0x7D, 0xB1, 0x1F, 0x37, 0xA4, 0x95, 0xEC, 0x5A, 0x41, 0x40, 0xE2, 0x89, 0xAE, 0xCB,
-    0x30, 0x69, 0x3B, 0xFB, 0x51, 0x4D, 0x52, 0xDC, 0xB1, 0x20, 0x55, 0x7C, 0xAC, 0x3D, 0x57, 0xF5,
-    0x7C, 0xB1, 0x17, 0x57, 0x24, 0xE9, 0x0D, 0xD6, 0x8A, 0xBF, 0x84, 0x5F, 0xCD, 0xAF, 0x55, 0x2B,
-    0xE5, 0x62, 0xA1, 0x40, 0x0D, 0x82, 0x5C, 0x9F, 0x44, 0x48, 0xEB, 0xC2, 0x98, 0x1F, 0x7D, 0x1E,
-    0x17, 0x89, 0x22, 0x9A, 0x23, 0x3B, 0xA7, 0xF6, 0x48, 0x06, 0xA4, 0xC9, 0x23, 0x5B, 0x83, 0x17,
-    0x22, 0x63, 0xA2, 0x04, 0x52, 0x88, 0x8A, 0x64, 0xFF, 0x72, 0x87, 0xA0, 0xAF, 0x52, 0x67, 0x99,
-    0xC7, 0x15, 0x22, 0x37, 0x04, 0x6E, 0x02, 0xFB, 0xEC, 0x62, 0x49, 0x9A, 0xA1, 0xFD, 0xFE, 0x3B,
-    0x2C, 0x07, 0x63, 0x6A, 0x13, 0xD5, 0xB1, 0xDA, 0x1E, 0x6E, 0x1D, 0x9A, 0xFE, 0xCB, 0x91, 0x17,
-    0xBE, 0x06, 0x91, 0x5E, 0x54, 0x1F, 0x34, 0x8F, 0x9A, 0x77, 0x5B, 0x8C, 0x6B, 0x69, 0xF3, 0x56,
-    0x09, 0xE2, 0xA3, 0x85, 0x4D, 0xF1, 0x32, 0x6A, 0x94, 0x28, 0x60, 0xA2, 0x0C, 0xDA, 0xE2, 0x61,
-    0xDC, 0xB4, 0xFF, 0x9D, 0xC8, 0x70, 0x17, 0xB4, 0x02, 0xD1, 0x42, 0xB3, 0x51, 0x20, 0xDB, 0xFC,
-    0xE9, 0x5C, 0xDB, 0x73, 0x87, 0x66, 0x99, 0xF8, 0x15, 0x76, 0x47, 0x07, 0xE9, 0x26, 0x6B, 0x97,
-    0x68, 0xFB, 0xAC, 0x3F, 0x18, 0x46, 0x6A, 0x9A, 0x94, 0x3C, 0x9F, 0xC1, 0x35, 0xF4, 0x35, 0x01,
-    0xBF, 0x39, 0x97, 0x21, 0x6B, 0x5B, 0x21, 0x41, 0x6D, 0xDE, 0x03, 0x56, 0x13, 0x6C, 0xE1, 0xE2,
-    0x6C, 0xAD, 0xA2, 0x05, 0x92, 0x4B, 0x31, 0x48, 0xA4, 0xCB, 0xEC, 0x0F, 0xD2, 0xDE, 0x8F, 0x78,
-    0xE0, 0xB7, 0x3E, 0xA4, 0x0F, 0xA5, 0xF3, 0xED, 0x46, 0xD2, 0x1C, 0xFC, 0xF6, 0xC5, 0xA3, 0x37,
-    0x1F, 0xDD, 0xDE, 0x1F, 0x74, 0xB5, 0xAF, 0x7D, 0xAA, 0x94, 0xC5, 0x47, 0x42, 0x89, 0x7D, 0xF5,
-    0x46, 0xE4, 0x83, 0xCF, 0xF9, 0x81, 0x08, 0x6B, 0x42, 0x7D, 0xA0, 0xBA, 0x4E, 0xE8, 0x17, 0x61,
-    0x75, 0x6D, 0xFF, 0x7D, 0xEF, 0x25, 0xA6, 0x64, 0xE2, 0x26, 0x74, 0xAA, 0x65, 0x18, 0xC6, 0x28,
-    0x26, 0x38, 0xC6, 0x48, 0x26, 0x58, 0xC6, 0x68, 0x26, 0x78, 0xC6, 0x88, 0x68, 0x33, 0xC7, 0x54,
-    0x1F, 0x66, 0xA8, 0x1E, 0x8E, 0x71, 0xE9, 0x6A, 0x86, 0xEC, 0x0F, 0x76, 0x86, 0x6D, 0x29, 0xCE,
-    0xD1, 0xFD, 0x5C, 0xA8, 0x14, 0xDF, 0xAF, 0xA3, 0x8D, 0x0C, 0x61, 0x79, 0x8C, 0xF1, 0x3F, 0x39,
-    0x4A, 0x67, 0x30, 0x01, 0x68, 0x69, 0xB6, 0xB6, 0x2A, 0x83, 0x83, 0x07, 0x5A, 0xDE, 0x0C, 0xDB,
-    0xF0, 0xF0, 0xA8, 0x5C, 0x24, 0xDD, 0xB1, 0xED, 0x80, 0x69, 0x5D, 0x79, 0xF3, 0x8E, 0x6A, 0xFB,
-    0x20, 0x3F, 0x8E, 0xCB, 0x45, 0x08, 0xEB, 0x6C, 0xD8, 0xF6, 0xF5, 0x80, 0x36, 0x5A, 0x08, 0x8B,
-    0x99, 0xA9, 0x8D, 0x6E, 0xAB, 0x85, 0x00, 0xF1, 0xCB, 0xD5, 0x99, 0x99, 0xA9, 0x8B, 0x1B, 0xDD,
-    0x4E, 0xAB, 0xD5, 0xF5, 0xFD, 0x56, 0xD5, 0x07, 0x05, 0xA4, 0xB9, 0xA9, 0x8B, 0xAF, 0xF1, 0x4E,
-    0x31, 0x7C, 0xD1, 0x59, 0xA7, 0x67, 0x61, 0xB5, 0xEA, 0x58, 0x2A, 0x9A, 0x59, 0x04, 0x25, 0xA8,
-    0x38, 0x7B, 0xBA, 0xCD, 0x08, 0xA2, 0x0A, 0x69, 0x8B, 0xA6, 0xA0, 0xA5, 0x16, 0xA0, 0xC4, 0x8E,
-    0x6A, 0x88, 0x78, 0xC9, 0x8E, 0xAC, 0x1C, 0x66, 0x60, 0x47, 0xF4, 0xA6, 0x92, 0xA1, 0x74, 0x54,
-    0x8D, 0xB4, 0xA3, 0xE0, 0xA3, 0x78, 0x25, 0xE4, 0x28, 0x04, 0x8A, 0xA3, 0x12, 0x2A, 0x39, 0x4F,
-    0x83, 0xAF, 0x68, 0x27, 0x11, 0xCF, 0x95, 0x54, 0xF2, 0x5D, 0x3A, 0x54, 0xAF, 0x93, 0xFC, 0x06,
-    0xC2, 0x20, 0xF9, 0x22, 0xF3, 0x2A, 0x98, 0x45, 0xEC, 0xEC, 0x07, 0x32, 0xBC, 0x40, 0x04, 0xCF,
-    0xA6, 0x9E, 0x0C, 0x1B, 0x22, 0x42, 0xD8, 0x3B, 0x6A, 0xD7, 0xD6, 0x0B, 0x34, 0x90, 0xC1, 0x92,
-    0x50, 0xD2, 0xC2, 0xB8, 0x65, 0xC5, 0x35, 0xEA, 0x4A, 0xF2, 0x31, 0xCE, 0xEC, 0x88, 0x96, 0x48,
-    0xDA, 0x74, 0x23, 0xEF, 0x06, 0xE0, 0x96, 0x78, 0x7C, 0x79, 0x64, 0x99, 0x91, 0x7D, 0xAB, 0x6D,
-    0xE9, 0xC4, 0x39, 0x88, 0x16, 0x24, 0x25, 0x03, 0xF1, 0x54, 0xC9, 0x01, 0x6D, 0x05, 0x56, 0x42,
-    0xB0, 0x76, 0x35, 0x5F, 0xE8, 0x11, 0x0D, 0x39, 0x92, 0x71, 0xA6, 0xF9, 0x9D, 0x5F, 0x18, 0xC3,
-    0x02, 0x05, 0xD1, 0xF4, 0x22, 0x89, 0x1F, 0x47, 0x14, 0xBB, 0x3F, 0xED, 0xD1, 0x65, 0x18, 0x66,
-    0xED, 0x2E, 0x7D, 0xBE, 0x86, 0xDD, 0xE2, 0x88, 0xA6, 0xB7, 0xC9, 0x0E, 0xC6, 0x96, 0x42, 0x8A,
-    0x80, 0xA4, 0x6B, 0x84, 0x3C, 0x6B, 0x29, 0x4E, 0x12, 0x2E, 0x21, 0x27, 0xB3, 0x5B, 0xB5, 0x59,
-    0xB0, 0xFD, 0x7B, 0x12, 0xDF, 0xA2, 0xE2, 0x0C, 0xCD, 0x5D, 0xA2, 0x6B, 0xEE, 0x09, 0x17, 0xAC,
-    0x65, 0x9D, 0x4E, 0xDF, 0x9C, 0xCE, 0x10, 0xF5, 0xC5, 0x74, 0xD0, 0xEF, 0xA6, 0xDD, 0x65, 0x93,
-    0xCE, 0xD5, 0x7F, 0x16, 0x72, 0xAE, 0xF8, 0x73, 0x4A, 0x5B, 0x28, 0xE7, 0x3E, 0x98, 0xFA, 0x08,
-    0xE7, 0x1E, 0xC0, 0xB7, 0x60, 0x1B, 0xFE, 0xC3, 0x2C, 0x40, 0x30, 0xEB, 0x52, 0xFD, 0x26, 0xD1,
-    0xD1, 0x55, 0x5A, 0xFB, 0x6C, 0xC5, 0xEA, 0xFF, 0x6D, 0x59, 0x98, 0x01, 0x79, 0x26, 0xF2, 0xF6,
-    0x96, 0xA9, 0x3F, 0x65, 0x3F, 0x0B, 0xC8, 0xFD, 0x2E, 0xD5, 0xE1, 0xD4, 0x3D, 0x9F, 0x3A, 0x35,
-    0xA4, 0xA4, 0x24, 0x5F, 0x9C, 0xE3, 0x9A, 0xBF, 0x67, 0x1E, 0xAF, 0xF0, 0xC7, 0x22, 0x9E, 0x0E,
-    0x76, 0xC1, 0x84, 0xE0, 0xFC, 0x90, 0x63, 0x6E, 0x65, 0xA0, 0x19, 0x31, 0x87, 0x4C, 0x85, 0xD2,
-    0xB3, 0x32, 0x89, 0x45, 0x38, 0x39, 0x27, 0x93, 0xD2, 0x63, 0xD4, 0x35, 0x19, 0x05, 0x66, 0x68,
-    0xB9, 0xC7, 0x1C, 0x92, 0xE7, 0x10, 0x63, 0xC8, 0x8E, 0x4D, 0x4C, 0x85, 0x98, 0xAA, 0x30, 0x2B,
-    0x7A, 0xC9, 0x2A, 0xE3, 0xA9, 0x20, 0x9B, 0x22, 0x6A, 0x46, 0xCE, 0x51, 0x96, 0x92, 0x9D, 0x49,
-    0xF2, 0x95, 0x60, 0x01, 0xB5, 0x9F, 0x52, 0x15, 0xE0, 0xB8, 0x63, 0x2A, 0x2D, 0xD0, 0x56, 0xE4,
-    0x0E, 0xF3, 0x73, 0xAC, 0x0D, 0x2C, 0x1C, 0xDA, 0xC4, 0x7D, 0x13, 0xDC, 0xF5, 0x6C, 0xDA, 0xE5,
-    0x4C, 0xCD, 0x9B, 0x04, 0x8C, 0x4D, 0xF3, 0xD2, 0x06, 0x93, 0xA4, 0xA2, 0x4D, 0x72, 0x62, 0xF2,
-    0x42, 0x6B, 0x40, 0x6E, 0x44, 0x4B, 0xE9, 0x64, 0xEA, 0x1D, 0x9D, 0xDC, 0x2C, 0x74, 0xEC, 0x28,
-    0x3D, 0x12, 0x48, 0xFF, 0xF9, 0x52, 0x64, 0xE5, 0x3C, 0x0E, 0xAC, 0x7E, 0x2C, 0x1E, 0x9B, 0x91,
-    0x95, 0x5C, 0x71, 0x14, 0xAC, 0x9E, 0x20, 0xBB, 0x2F, 0xC9, 0x90, 0x24, 0xF2, 0xBF, 0x0C, 0x01,
-    0x0E, 0x44, 0x2F, 0x5C, 0xC0, 0xE3, 0x06, 0x32, 0x10, 0x0A, 0xE2, 0x35, 0x4A, 0xC1, 0xE2, 0x09,
-    0xC9, 0xF0, 0x64, 0x65, 0x23, 0x02, 0x80, 0xB3, 0x94, 0xBA, 0x3F, 0xE7, 0xA0, 0xB0, 0x9F, 0xD0,
-    0xA0, 0x69, 0x10, 0x04, 0x41, 0xC3, 0xD2, 0x08, 0x79, 0xC8, 0xF5, 0xC0, 0x63, 0xC7, 0x40, 0xD9,
-    0x66, 0xA5, 0x06, 0x6D, 0x60, 0x76, 0x42, 0x94, 0xA3, 0x2E, 0x74, 0x27, 0x59, 0x85, 0x7A, 0x12,
-    0x11, 0xEC, 0x51, 0xF8, 0x39, 0x31, 0x8E, 0x77, 0x0B, 0x3F, 0x8B, 0xE1, 0xA2, 0x50, 0xBF, 0x6D,
-    0x50, 0xDF, 0x57, 0x32, 0xB3, 0xFB, 0xA9, 0x51, 0x3D, 0x2E, 0x2E, 0x69, 0xC1, 0x52, 0x5C, 0xB3,
-    0xB0, 0x17, 0x1F, 0xAF, 0xC7, 0x95, 0xF8, 0x13, 0x5C, 0x02, 0xEE, 0x38, 0xE6, 0xD3, 0x3D, 0x33,
-    0x5A, 0xDF, 0x32, 0x7F, 0xF1, 0xCC, 0x4B, 0xC7, 0x1C, 0xED, 0x19, 0x93, 0x0D, 0xFE, 0x98, 0xCE,
-    0xE8, 0xF5, 0x1F, 0x06, 0x73, 0x73, 0xE4, 0x38, 0x64, 0xED, 0x29, 0x5A, 0x5F, 0xA7, 0xD3, 0x83,
-    0xB4, 0xAD, 0xAC, 0xDC, 0x30, 0xE6, 0x5F, 0xE6, 0xA8, 0x6D, 0x8C, 0xDC, 0x32, 0x07, 0xFF, 0x34,
-    0xFA, 0xD0, 0x0C, 0x1B, 0x18, 0xF4, 0xCD, 0xC1, 0x53, 0xA3, 0x5F, 0x98, 0xA1, 0xBF, 0x65, 0x7E,
-    0x75, 0x01, 0x35, 0x34, 0x65, 0x0E, 0x9A, 0x66, 0x24, 0xDF, 0x36, 0xCF, 0x6E, 0x9B, 0x61, 0x6C,
-    0x4C, 0xAB, 0x69, 0xFE, 0x21, 0xCD, 0xE1, 0x6D, 0x33, 0xC2, 0xA0, 0xD7, 0x34, 0x1F, 0x49, 0xF3,
-    0xE2, 0xB9, 0x49, 0xB2, 0x68, 0xCD, 0x6C, 0x10, 0xA5, 0x1E, 0x57, 0xA5, 0x46, 0x91, 0xDC, 0x43,
-    0x9C, 0xC6, 0x24, 0xD6, 0xD1, 0xF7, 0xAC, 0xE7, 0xA8, 0xD5, 0x31, 0x07, 0x4C, 0x21, 0x4B, 0xF0,
-    0x76, 0x88, 0x2C, 0x71, 0xE5, 0x58, 0x43, 0x42, 0xF9, 0xE9, 0xBF, 0xCA, 0x35, 0x16, 0x31, 0xCE,
-    0x41, 0xCE, 0x51, 0x8E, 0xBA, 0x3F, 0x4D, 0x27, 0xE3, 0xFC, 0xFF, 0x68, 0xD3, 0x84, 0xC2, 0x18,
-    0xC2, 0xDE, 0x1B, 0x78, 0x38, 0x9F, 0xD0, 0x5A, 0x3C, 0xD9, 0x3E, 0x8D, 0x97, 0x00, 0xD7, 0x8B,
-    0x28, 0x02, 0x6E, 0xF6, 0x25, 0x43, 0xF6, 0x67, 0xF7, 0xA9, 0xA6, 0x49, 0xFC, 0x35, 0x22, 0x0F,
-    0x8E, 0x5A, 0xE2, 0x88, 0x2A, 0x65, 0xA7, 0x8C, 0xB3, 0x18, 0xAB, 0xC2, 0x09, 0x3A, 0xE0, 0xC7,
-    0x27, 0x1C, 0xDC, 0x3A, 0xFA, 0x3E, 0x55, 0xD6, 0x61, 0xB7, 0x18, 0x3E, 0xA7, 0x70, 0xD4, 0x30,
-    0xCB, 0xA1, 0xE4, 0x2A, 0x7F, 0xE8, 0xDC, 0x09, 0x3B, 0xD8, 0x03, 0xB1, 0x97, 0x86, 0x11, 0x7F,
-    0x5B, 0xF9, 0x77, 0x37, 0xFF, 0x76, 0x6E, 0x87, 0xBB, 0x5D, 0x97, 0xF5, 0xFE, 0x56, 0x9A, 0x80,
-    0x46, 0x01, 0xCD, 0x2C, 0x7C, 0xC7, 0x7C, 0xE2, 0x1C, 0x04, 0xB4, 0x66, 0xF4, 0x2A, 0xD1, 0x85,
-    0x7B, 0xB8, 0xA2, 0x2D, 0x43, 0xA9, 0x91, 0x88, 0xDC, 0x20, 0xA6, 0x2A, 0x6E, 0x8B, 0x4F, 0x78,
-    0x93, 0x0B, 0x69, 0x96, 0x70, 0x5D, 0x97, 0xDA, 0x1F, 0x44, 0x96, 0xE9, 0x92, 0x33, 0x82, 0xD7,
-    0x98, 0x27, 0xEF, 0x8F, 0xEE, 0x53, 0x5F, 0x53, 0xED, 0x37, 0xCA, 0xBD, 0xE9, 0x11, 0xDF, 0x8A,
-    0x8E, 0x93, 0x1F, 0x5C, 0xCC, 0x0B, 0xF9, 0xBE, 0x39, 0x69, 0x25, 0xBE, 0x51, 0x01, 0xC0, 0xC5,
-    0x53, 0x9A, 0x5B, 0xE5, 0xC4, 0x0C, 0xD7, 0x9C, 0x45, 0xB9, 0x4B, 0x7A, 0xA8, 0x77, 0x07, 0x5C,
-    0xF0, 0x6A, 0xA8, 0x78, 0x11, 0x97, 0x3C, 0x17, 0x35, 0x6F, 0xFD, 0x1A, 0x8A, 0xDE, 0xF5, 0xF0,
-    0x58, 0x34, 0xB1, 0x70, 0xFA, 0x82, 0xF8, 0x93, 0x1B, 0x11, 0xDD, 0x80, 0x7B, 0xBB, 0x8F, 0x70,
-    0xDA, 0x3A, 0x6F, 0x77, 0xE5, 0x4C, 0xBE, 0xD5, 0xFC, 0x76, 0xC7, 0x9B, 0x13, 0xCD, 0x8E, 0x8B,
-    0x32, 0x94, 0xCF, 0x0B, 0xBD, 0x6F, 0x9E, 0xBB, 0xC1, 0xF1, 0xC2, 0xF0, 0x78, 0xE1, 0xA9, 0xC6,
-    0x5B, 0xFE, 0x64, 0x02, 0xA2, 0x90, 0xC2, 0x6A, 0xEF, 0xB6, 0x4F, 0xB2, 0x2C, 0xF2, 0x90, 0xEF,
-    0x4C, 0xB7, 0x28, 0x8D, 0x45, 0xFA, 0x92, 0x1F, 0x5E, 0x25, 0x0B, 0x32, 0x24, 0x44, 0xB0, 0x84,
-    0xD2, 0xE9, 0xE9, 0x93, 0x6B, 0x69, 0x8C, 0x44, 0xE7, 0x1E, 0x37, 0x90, 0xB6, 0x16, 0xDA, 0x97,
-    0x0A, 0x17, 0xEC, 0x72, 0x5E, 0x7D, 0xD2, 0x6B, 0x0E, 0xD2, 0x01, 0xDF, 0x01, 0x5F, 0xF0, 0x4B,
-    0x4D, 0x48, 0xE9, 0xC2, 0xD7, 0x85, 0x5A, 0xC5, 0x42, 0x11, 0x8B, 0xD8, 0x97, 0xA1, 0x45, 0xBA,
-    0x90, 0x2F, 0x84, 0x12, 0x0B, 0xCD, 0x66, 0x5A, 0xCE, 0x1A, 0xCD, 0x46, 0xDE, 0x15, 0xA8, 0xFD,
-    0x00, 0x27, 0x68, 0x3F, 0xD8, 0x4D, 0x5F, 0xA5, 0xEC, 0xE5, 0x8E, 0xF8, 0x26, 0xF8, 0x8A, 0x2B,
-    0xA4, 0x34, 0x1C, 0x8B, 0xAF, 0xB8, 0x42, 0xBA, 0xA3, 0xE6, 0x1E, 0x2A, 0xFD, 0xF6, 0xF9, 0x77,
-    0xCC, 0x65, 0x69, 0x0F, 0x9A, 0x8F, 0x46, 0xE7, 0x33, 0xE8, 0xAF, 0xFF, 0xEE, 0xD2, 0x7C, 0x78,
-    0xBE, 0x04, 0x37, 0x7E, 0x35, 0xC8, 0xFF, 0x02, 0x6D, 0x92, 0x31, 0x68, 0x14, 0x41, 0x14, 0x86,
-    0xFF, 0x99, 0x49, 0x6E, 0x4C, 0xC6, 0xDB, 0xBD, 0x42, 0x8B, 0xE8, 0xEE, 0xA5, 0x95, 0x38, 0xC6,
-    0x14, 0xAB, 0x6C, 0xB1, 0x98, 0x49, 0x52, 0x58, 0xD8, 0x5C, 0xA1, 0xD8, 0x8A, 0xB5, 0xE8, 0x16,
-    0x57, 0x44, 0x89, 0x64, 0xC5, 0x22, 0x85, 0x4D, 0xB0, 0xB0, 0xB1, 0x49, 0x11, 0x44, 0x45, 0x70,
-    0x85, 0x08, 0xA9, 0xE2, 0x24, 0x8D, 0x85, 0xCD, 0x24, 0x11, 0x52, 0x09, 0x23, 0x2A, 0x24, 0x46,
-    0xCC, 0x8A, 0x27, 0x48, 0xE2, 0x65, 0x9D, 0x55, 0x11, 0x0B, 0x99, 0xE1, 0xCD, 0x83, 0x37, 0x6F,
-    0xDE, 0xFF, 0x7F, 0x0C, 0x5A, 0xA4, 0x54, 0x9D, 0x62, 0x41, 0x26, 0xC2, 0xA3, 0x2F, 0xD5, 0x17,
-    0x13, 0xB7, 0xC3, 0xA6, 0xCF, 0x4A, 0x35, 0x0C, 0x08, 0x82, 0x40, 0x1E, 0x8B, 0x46, 0xD2, 0x7C,
-    0x16, 0x00, 0xB5, 0xA4, 0x83, 0x1F, 0xD8, 0xC6, 0x57, 0x9D, 0xDB, 0xE7, 0x93, 0xA3, 0x65, 0xE6,
-    0x83, 0x65, 0x70, 0x25, 0x52, 0xEA, 0xE7, 0xAD, 0x18, 0x75, 0xF0, 0x2E, 0x2E, 0x6A, 0xB4, 0x11,
-    0xC2, 0x17, 0x4F, 0xD5, 0x12, 0xD0, 0x83, 0x69, 0x7D, 0xBD, 0x11, 0x43, 0xC2, 0x2F, 0xD9, 0xDA,
-    0xAA, 0x8D, 0xDB, 0x75, 0x4F, 0xB0, 0x9D, 0x6C, 0x58, 0x01, 0xAC, 0xB4, 0x17, 0x3A, 0x88, 0x91,
-    0x54, 0xD7, 0x21, 0xC0, 0x33, 0xA6, 0xA9, 0xC1, 0x1C, 0x50, 0x49, 0xB2, 0x45, 0x5B, 0x7A, 0x1E,
-    0xD9, 0x27, 0xE5, 0x98, 0x2D, 0xF2, 0x30, 0x11, 0x7C, 0x27, 0xBB, 0xAA, 0xAA, 0x59, 0xE4, 0x8B,
-    0xCD, 0x9D, 0x5A, 0x9F, 0xAD, 0xEC, 0x15, 0xC3, 0x6D, 0xF7, 0xF4, 0x89, 0xFE, 0x25, 0xB2, 0x09,
-    0xA2, 0x68, 0x46, 0xB3, 0xE9, 0xEE, 0xF1, 0xCD, 0xEA, 0x04, 0xA6, 0xBB, 0x43, 0x0F, 0xAB, 0x08,
-    0x1C, 0x3E, 0xEF, 0x62, 0x83, 0x65, 0x09, 0x31, 0x3E, 0xDA, 0x54, 0xFB, 0x6E, 0xA8, 0x65, 0x4E,
-    0xBD, 0x44, 0x04, 0x82, 0x84, 0xE8, 0x10, 0xA6, 0x4E, 0x4C, 0x48, 0x75, 0x2C, 0x94, 0x95, 0x02,
-    0xE8, 0xA5, 0x3B, 0xF6, 0xBB, 0x4C, 0xFC, 0x90, 0xDD, 0xC1, 0x9A, 0x4E, 0xAD, 0x8C, 0xFA, 0x9D,
-    0x2C, 0xFC, 0x4B, 0xEA, 0x99, 0x49, 0xDA, 0x4D, 0xEF, 0x0F, 0x29, 0x0C, 0xFA, 0xEF, 0xDE, 0x50,
-    0x9D, 0x30, 0x1D, 0x73, 0x95, 0xFB, 0x0E, 0xCA, 0x21, 0xBC, 0x30, 0xD1, 0x94, 0x33, 0x56, 0x99,
-    0xAA, 0x16, 0x33, 0x4C, 0xB3, 0xB2, 0x78, 0x3C, 0x8F, 0x96, 0xDF, 0xED, 0x1B, 0x74, 0x15, 0xAF,
-    0xB6, 0x58, 0xEB, 0x38, 0x11, 0x52, 0x25, 0xBB, 0x9D, 0x6B, 0x4E, 0x32, 0xB8, 0x66, 0x96, 0x7D,
-    0xA7, 0x6F, 0xE8, 0x2B, 0xB2, 0xBE, 0xFC, 0xA1, 0xF3, 0xA2, 0xC4, 0x09, 0x07, 0x86, 0x64, 0xFF,
-    0x41, 0x1C, 0xFC, 0x83, 0xD8, 0xDC, 0xAC, 0x10, 0x37, 0x1C, 0xE2, 0x55, 0x6B, 0xE3, 0xC8, 0xF3,
-    0xC4, 0x78, 0xF9, 0x17, 0xF1, 0x02, 0x2A, 0xFC, 0xCD, 0x0A, 0xB1, 0x62, 0x0E, 0x31, 0xB1, 0x15,
-    0xE2, 0x06, 0x29, 0xB3, 0x22, 0x8F, 0x43, 0xDF, 0x27, 0xFB, 0xCE, 0x96, 0x5D, 0xC8, 0x43, 0x29,
-    0x26, 0xB6, 0x7F, 0x75, 0x91, 0x12, 0xDF, 0x8A, 0xDF, 0x88, 0x97, 0xF7, 0x8A, 0xE6, 0x64, 0xD5,
-    0x5E, 0x5B, 0x22, 0x8B, 0x80, 0x22, 0x9A, 0xE8, 0xD1, 0xEE, 0xD0, 0x56, 0x75, 0x42, 0xB9, 0xEC,
-    0x11, 0x30, 0xBA, 0x5F, 0x21, 0x76, 0x51, 0x25, 0x82, 0x98, 0xE4, 0x97, 0xFF, 0xC2, 0x6D, 0x81,
-    0x94, 0x29, 0x02, 0x49, 0x4C, 0x1D, 0xD6, 0x83, 0x75, 0x78, 0x5D, 0xB1, 0x90, 0x5C, 0xD1, 0xB7,
-    0x13, 0x1B, 0x6B, 0x3A, 0x37, 0x32, 0xF5, 0x24, 0x3B, 0xCB, 0xF4, 0x5E, 0xDA, 0xD7, 0x03, 0xFA,
-    0xDE, 0xBF, 0x22, 0xEB, 0xD1, 0xD4, 0xF4, 0x6C, 0x8E, 0x14, 0x67, 0x16, 0x6A, 0x8A, 0xCE, 0xB3,
-    0x8D, 0xDB, 0xEE, 0x5A, 0x90, 0x0A, 0xC9, 0x66, 0x88, 0xDE, 0x35, 0x35, 0x85, 0x3E, 0x3A, 0xB6,
-    0xA2, 0x4F, 0x6B, 0xEE, 0x7C, 0x90, 0x4F, 0x58, 0x57, 0x36, 0x6F, 0xF5, 0xE0, 0xE8, 0xEC, 0x3D,
-    0x43, 0xB5, 0x18, 0xDC, 0x37, 0x9F, 0xC5, 0x70, 0x31, 0x00, 0x0E, 0xAA, 0x61, 0x71, 0x6A, 0xBE,
-    0x79, 0x9F, 0xDF, 0x5A, 0xD1, 0xA9, 0x91, 0x23, 0x5E, 0xC0, 0xCE, 0x91, 0x65, 0xD5, 0xF8, 0x53,
-    0x8A, 0x8E, 0x05, 0x52, 0x48, 0xFA, 0x04, 0x25, 0x22, 0xE3, 0x52, 0x36, 0xA6, 0x5A, 0x9C, 0x6A,
-    0x1B, 0x1D, 0xE4, 0x34, 0x33, 0x51, 0x20, 0x88, 0x3A, 0x30, 0xD9, 0x54, 0x5B, 0x1F, 0xA7, 0xC2,
-    0xEA, 0x85, 0x5C, 0xC6, 0x1E, 0xBB, 0xAD, 0x4C, 0x94, 0x06, 0x5C, 0x50, 0x9D, 0xB6, 0x0E, 0xF5,
-    0xE2, 0xC0, 0x4D, 0xFE, 0x60, 0xC5, 0xA6, 0x45, 0x10, 0x8B, 0x3A, 0x9B, 0xA9, 0xBE, 0x89, 0x53,
-    0x42, 0x8F, 0xE0, 0xC6, 0x15, 0x9E, 0x99, 0xBC, 0x5E, 0x27, 0xDA, 0xC8, 0x90, 0x8F, 0xEF, 0xDA,
-    0xF8, 0x12, 0x53, 0xCE, 0x92, 0xFB, 0x56, 0xB5, 0xF7, 0xD7, 0x2F, 0x6B, 0x9E, 0x71, 0x27, 0x96,
-    0x0F, 0x2D, 0x0E, 0x38, 0x3A, 0x73, 0x27, 0xEF, 0xBE, 0x0E, 0x68, 0x16, 0x31, 0x95, 0xB2, 0xB9,
-    0x01, 0xFC, 0x04, 0x55, 0x56, 0x41, 0x6F, 0x1C, 0x49, 0x19, 0x7D, 0xD5, 0x95, 0xB8, 0xAD, 0xD4,
-    0xE2, 0x8A, 0xD0, 0x0A, 0x56, 0x6C, 0xE2, 0xFE, 0x01, 0xB1, 0xDD, 0x1C, 0xF6, 0x60, 0x65, 0x7B,
-    0x32, 0xAD, 0xF8, 0x90, 0x83, 0x25, 0xF0, 0x21, 0x61, 0x0F, 0xFC, 0x04, 0x56, 0xC4, 0x42, 0x23,
-    0x11, 0xD0, 0x78, 0xDD, 0x49, 0x0E, 0x7B, 0x58, 0x69, 0xB1, 0xB8, 0x70, 0x88, 0x90, 0x7C, 0xE0,
-    0x80, 0x0C, 0x52, 0x2C, 0x64, 0xA4, 0x41, 0xB2, 0x3C, 0x95, 0xF5, 0x21, 0x87, 0x1C, 0x68, 0xD8,
-    0xE5, 0x04, 0x12, 0xBD, 0xD1, 0xFA, 0x80, 0x2D, 0x48, 0xB1, 0xAE, 0xEC, 0x8E, 0xED, 0xF1, 0x14,
-    0xAF, 0x6A, 0xEC, 0x44, 0xB4, 0x5C, 0xAD, 0x71, 0x77, 0xF5, 0x57, 0xEF, 0x7B, 0xDF, 0xFB, 0x5E,
-    0x15, 0x00, 0xA4, 0x23, 0xC8, 0x63, 0x8B, 0x6D, 0x40, 0x03, 0x49, 0x03, 0xB4, 0xC4, 0x9D, 0x05,
-    0xB3, 0x3A, 0x2C, 0x54, 0x29, 0x8D, 0x45, 0x4B, 0x23, 0xF9, 0xEA, 0x65, 0xA9, 0xFC, 0x08, 0xE9,
-    0x5E, 0x89, 0x02, 0x90, 0x06, 0xB8, 0x07, 0xA8, 0xFD, 0x0A, 0x7E, 0xC0, 0x00, 0x9B, 0x35, 0xA6,
-    0x66, 0x30, 0xE1, 0x8D, 0xF4, 0x23, 0xE1, 0x17, 0xAB, 0x95, 0xCD, 0x5A, 0x7F, 0x6F, 0x26, 0xF9,
-    0xEF, 0x6E, 0xD5, 0x2A, 0x3A, 0x72, 0x77, 0x11, 0xDD, 0xCD, 0x5A, 0x7D, 0x3C, 0x83, 0x3F, 0xED,
-    0x56, 0xE9, 0xB0, 0x83, 0xF6, 0x22, 0xA4, 0xAD, 0x91, 0x8D, 0x06, 0xC2, 0xFB, 0xB2, 0xE8, 0x40,
-    0x2E, 0x02, 0x97, 0x97, 0x30, 0xBE, 0xFA, 0x03, 0xAC, 0xFA, 0x3A, 0xAB, 0x26, 0x25, 0x91, 0x30,
-    0x7A, 0x76, 0x86, 0x49, 0xE5, 0xD2, 0x9C, 0xD8, 0xAE, 0x36, 0xA9, 0x71, 0xE8, 0x66, 0x48, 0x3F,
-    0xA9, 0xD1, 0x2D, 0x20, 0x3F, 0x35, 0xC8, 0x09, 0x9D, 0x91, 0x12, 0x6F, 0x63, 0x84, 0xCC, 0x3B,
-    0xF4, 0x7D, 0x2D, 0xEB, 0x98, 0x50, 0x00, 0x2C, 0x18, 0x40, 0x95, 0x0C, 0xC2, 0x7F, 0x8F, 0x37,
-    0x90, 0xFA, 0x21, 0xB2, 0x3B, 0x4B, 0xD8, 0x1A, 0xA7, 0xE2, 0x4F, 0xF9, 0xC4, 0xC6, 0x55, 0x74,
-    0x19, 0xE7, 0x9F, 0x5D, 0xAB, 0x0E, 0x09, 0xA7, 0xA6, 0xF5, 0x85, 0xF8, 0x22, 0x04, 0x23, 0x1A,
-    0x4C, 0xF3, 0x33, 0xEF, 0xF9, 0xCD, 0x68, 0x1C, 0x7C, 0xE5, 0x36, 0x34, 0xA7, 0x5D, 0x3C, 0xBA,
-    0x0D, 0xD8, 0x31, 0xDA, 0xB4, 0x02, 0xDA, 0xDE, 0x57, 0x61, 0xF0, 0x0B, 0x11, 0x6E, 0x68, 0xC2,
-    0xCD, 0x42, 0x24, 0xEB, 0x3F, 0x5F, 0x4B, 0x9E, 0xFA, 0xB6, 0xC7, 0xD7, 0xBF, 0xF2, 0xB7, 0xEA,
-    0x76, 0xD9, 0x87, 0xCB, 0xAA, 0xBC, 0x6C, 0xA5, 0x46, 0x1B, 0x7D, 0xB3, 0x49, 0x6B, 0x69, 0x9C,
-    0xB4, 0xC2, 0x16, 0xC9, 0x10, 0xBD, 0x0C, 0x23, 0x26, 0x5F, 0xF9, 0x52, 0xCB, 0xFA, 0xA7, 0x86,
-    0x05, 0x99, 0x0F, 0x6F, 0x66, 0xBA, 0xE8, 0xE1, 0x6A, 0x08, 0x18, 0x50, 0x21, 0x8D, 0x78, 0xBB,
-    0xB0, 0x89, 0x93, 0x95, 0xAE, 0xA7, 0xD1, 0xAE, 0xB6, 0xC4, 0x7F, 0xA4, 0x51, 0x5D, 0x2D, 0x76,
-    0x8E, 0x77, 0x16, 0xBD, 0x1F, 0xCA, 0x67, 0x8B, 0x98, 0xBE, 0x5A, 0xA4, 0xDE, 0x8F, 0xDE, 0xDE,
-    0x3F, 0xF9, 0x42, 0xCB, 0x7F, 0x63, 0x5E, 0x6F, 0x8A, 0xA6, 0x6D, 0x14, 0x01, 0x14, 0xC9, 0x00,
-    0x36, 0x25, 0x63, 0xFD, 0x35, 0x86, 0xF4, 0x64, 0xC5, 0xAE, 0x86, 0xD8, 0x84, 0xDB, 0x30, 0xF7,
-    0x39, 0xB8, 0x65, 0x59, 0x6B, 0xCD, 0x79, 0x5F, 0xEE, 0xA5, 0x66, 0xC7, 0xDB, 0xBE, 0xBF, 0xF5,
-    0x99, 0x62, 0xF5, 0xE0, 0x98, 0x2C, 0x31, 0x6C, 0x09, 0x4B, 0x92, 0xE6, 0xF8, 0x1D, 0x79, 0xD7,
-    0x81, 0x97, 0xE3, 0x05, 0x03, 0xE5, 0xCE, 0x8A, 0x1A, 0x72, 0x6F, 0xFB, 0x40, 0xA2, 0x24, 0x45,
-    0xA9, 0x89, 0x45, 0xD1, 0xC9, 0x6F, 0xB0, 0x25, 0x9F, 0x7A, 0xD3, 0x12, 0x87, 0x9F, 0xAF, 0x69,
-    0x1C, 0x59, 0xA4, 0x7F, 0x1B, 0x76, 0x49, 0xFA, 0x80, 0x6B, 0x8E, 0x06, 0x89, 0x43, 0x91, 0x21,
-    0xAF, 0xB4, 0x34, 0xC2, 0x85, 0xB2, 0xCF, 0x25, 0xCD, 0x2C, 0x97, 0x73, 0xAA, 0x92, 0x4D, 0x21,
-    0x0E, 0x0F, 0x2C, 0x17, 0xEA, 0x8F, 0x8B, 0xCE, 0xC7, 0x85, 0xA8, 0xEF, 0x31, 0x72, 0x5A, 0x0D,
-    0xA5, 0xE9, 0x4C, 0x99, 0x2D, 0x75, 0xF3, 0x1F, 0x1A, 0x5B, 0xD7, 0x4D, 0xA3, 0x6E, 0xBD, 0x3F,
-    0x8B, 0xCD, 0x3F, 0xEC, 0x1A, 0x96, 0xC3, 0x4F, 0x9C, 0x9C, 0xBC, 0x58, 0xD7, 0x45, 0x61, 0x71,
-    0xF8, 0xF0, 0xD7, 0xD0, 0xCB, 0xD7, 0x0D, 0x5E, 0xC8, 0x1E, 0x34, 0xEB, 0x80, 0x21, 0xC1, 0xE9,
-    0xEA, 0x06, 0xE0, 0x82, 0x78, 0x56, 0x47, 0xA5, 0x22, 0x68, 0x27, 0x8D, 0x66, 0xDD, 0xAD, 0x34,
-    0x49, 0x7D, 0x4F, 0x34, 0x4B, 0x9D, 0x59, 0x6C, 0x15, 0xB3, 0x5C, 0x79, 0x5A, 0x2D, 0x18, 0xAD,
-    0x1E, 0x3E, 0xB1, 0xE9, 0x83, 0xDA, 0xF2, 0x8D, 0xBD, 0xF7, 0xEA, 0x0D, 0x11, 0x6B, 0xB5, 0xF0,
-    0xA4, 0x49, 0x1F, 0x9A, 0xA5, 0xAD, 0xA4, 0xB6, 0xE4, 0xC3, 0x15, 0x58, 0x61, 0x3A, 0x1B, 0x23,
-    0x68, 0xE5, 0x8F, 0xCE, 0xEA, 0x05, 0x32, 0x4B, 0xBA, 0x6D, 0x94, 0x64, 0x10, 0x47, 0xB2, 0xDE,
-    0x85, 0xF2, 0x3F, 0x86, 0x6A, 0xFA, 0x65, 0x5A, 0x6B, 0x23, 0x9B, 0xC4, 0xF2, 0x71, 0x8F, 0x73,
-    0x67, 0x39, 0x57, 0x97, 0xAA, 0x4A, 0x8D, 0xAC, 0x89, 0xB3, 0x27, 0x06, 0xC8, 0xC5, 0x29, 0xE4,
-    0xC9, 0xDF, 0x09, 0x95, 0x5D, 0x70, 0x7E, 0x65, 0xD4, 0xB3, 0xA2, 0x3E, 0x5F, 0x8B, 0x58, 0x32,
-    0xB8, 0xAE, 0xDF, 0x44, 0x7E, 0xB6, 0x26, 0xBB, 0x2A, 0x88, 0x35, 0x0B, 0xDA, 0xDE, 0x5B, 0x8A,
-    0x3D, 0xD0, 0xF6, 0x75, 0x1C, 0xE1, 0x77, 0x1C, 0x2C, 0x98, 0x08, 0xC5, 0xF3, 0x3B, 0x40, 0x7E,
-    0x3A, 0x0E, 0x55, 0x10, 0xC1, 0x34, 0xA3, 0xA8, 0x2A, 0x87, 0xAC, 0x19, 0xCD, 0x72, 0x74, 0x39,
-    0xE6, 0x38, 0xF4, 0xDD, 0x28, 0x79, 0x73, 0xC9, 0x8F, 0xD6, 0xB1, 0xC2, 0xB4, 0xE6, 0x52, 0x43,
-    0xBC, 0x5C, 0xDD, 0xE4, 0x63, 0x55, 0x04, 0xC9, 0xCE, 0x91, 0x49, 0x5D, 0x32, 0x7A, 0xE6, 0xFD,
-    0x73, 0x4F, 0xA4, 0xA1, 0xB1, 0x58, 0xC1, 0x6C, 0x12, 0xC9, 0x81, 0x41, 0xBB, 0x81, 0x74, 0x10,
-    0xE4, 0xC2, 0x3F, 0x43, 0xAB, 0x4F, 0x25, 0x35, 0xA0, 0x0A, 0x04, 0xB3, 0xD9, 0xB1, 0xB8, 0xC8,
-    0xA8, 0xA1, 0x30, 0xAF, 0x3A, 0xF4, 0x6D, 0xBF, 0x16, 0x75, 0x15, 0xB8, 0x7B, 0x13, 0xAB, 0xE1,
-    0xD1, 0x92, 0x0E, 0x4C, 0x84, 0xE5, 0x78, 0x0F, 0xAD, 0x28, 0x1A, 0x11, 0x9B, 0x32, 0xDC, 0x65,
-    0x1D, 0xEF, 0x46, 0x58, 0x41, 0x0D, 0x26, 0xCD, 0xAA, 0x4D, 0x2B, 0x59, 0x1F, 0x0D, 0x55, 0xA9,
-    0x76, 0x9B, 0x96, 0x2E, 0xF5, 0x82, 0xA1, 0xDB, 0x7D, 0x40, 0x11, 0x65, 0x13, 0x43, 0x55, 0x6D,
-    0xE7, 0xBE, 0xD1, 0x07, 0x2E, 0x3F, 0x82, 0xEE, 0xD7, 0xE7, 0xAD, 0x16, 0xDA, 0x9F, 0xD7, 0x6C,
-    0xBC, 0xB7, 0xCE, 0x78, 0x39, 0xAF, 0xE6, 0x58, 0x89, 0xE4, 0x57, 0x93, 0x36, 0x2A, 0x01, 0xC5,
-    0x14, 0x07, 0xBF, 0x98, 0x9F, 0xE1, 0x98, 0xE7, 0x6F, 0xAE, 0xDF, 0x22, 0xAA, 0x36, 0x51, 0xE6,
-    0xE3, 0xF2, 0x7F, 0xF7, 0x03, 0x22, 0xF5, 0x48, 0x4E, 0xFE, 0x8C, 0xF4, 0xF1, 0xF7, 0xA1, 0xA7,
-    0x55, 0x39, 0xFB, 0x46, 0x70, 0xAB, 0xF3, 0x11, 0x28, 0xA2, 0xEF, 0xA4, 0xAC, 0x42, 0xCA, 0x92,
-    0xAC, 0x32, 0x7C, 0x9F, 0xAD, 0xE4, 0x94, 0xB9, 0xF8, 0xF2, 0xBD, 0xCF, 0x34, 0x7B, 0x5B, 0x34,
-    0x14, 0x27, 0xC7, 0xB5, 0xE3, 0xC7, 0xCD, 0xB5, 0xFD, 0xC7, 0xEB, 0xA9, 0xB9, 0x01, 0x75, 0x30,
-    0xA4, 0x0C, 0xEA, 0xFF, 0x73, 0xAE, 0xB9, 0x33, 0xC8, 0x63, 0xC0, 0xDF, 0x20, 0x2D, 0xB4, 0xCA,
-    0x9C, 0x55, 0x18, 0x15, 0x6F, 0x25, 0x6E, 0x9E, 0x4E, 0xD7, 0xA1, 0xFE, 0x97, 0x39, 0x77, 0x93,
-    0xE8, 0x1A, 0xCE, 0xDD, 0xBB, 0xDD, 0x12, 0xDE, 0x15, 0xC9, 0xBE, 0x2B, 0x68, 0x3D, 0x2D, 0x79,
-    0xDF, 0xDE, 0x90, 0x37, 0x9B, 0x3C, 0xA5, 0x19, 0x3C, 0x93, 0x26, 0xF5, 0x7D, 0x83, 0xFE, 0xA8,
-    0x8C, 0x9C, 0x5C, 0x89, 0x6E, 0x44, 0xA7, 0x4B, 0x03, 0xC7, 0x2C, 0x49, 0xF2, 0x82, 0x0F, 0x0E,
-    0x99, 0x68, 0x8F, 0xA8, 0xA9, 0x08, 0x22, 0xF5, 0xE2, 0xEE, 0x0F, 0x5E, 0x96, 0xBA, 0xEA, 0xE2,
-    0x47, 0x84, 0xD9, 0x0E, 0xD0, 0x83, 0xBC, 0x1D, 0x57, 0xDA, 0x66, 0xAE, 0x2D, 0xD6, 0x89, 0xAC,
-    0xF4, 0x88, 0x39, 0x1B, 0x73, 0x79, 0x77, 0x10, 0xD5, 0x7B, 0x11, 0x8C, 0x37, 0xAE, 0x1D, 0x33,
-    0x49, 0x36, 0x36, 0x46, 0xD4, 0x0F, 0xF5, 0xEF, 0xA0, 0x4E, 0x43, 0xDC, 0x61, 0xBE, 0xBF, 0xB1,
-    0xC6, 0x02, 0x24, 0xD1, 0x5C, 0x38, 0xA5, 0xBA, 0x80, 0xFC, 0xC0, 0x32, 0xB7, 0x0A, 0xE7, 0xB9,
-    0x2A, 0x5F, 0x25, 0xC1, 0x92, 0x7F, 0x31, 0x99, 0xD8, 0x79, 0x64, 0x65, 0x8D, 0x41, 0xCA, 0xC9,
-    0x33, 0x31, 0xD3, 0x81, 0xA4, 0x10, 0xAE, 0x92, 0xA8, 0x4D, 0x5A, 0x9C, 0x81, 0x9B, 0x62, 0x07,
-    0xBC, 0x03, 0xF5, 0x84, 0xFC, 0x3D, 0x0B, 0x2D, 0x35, 0xE0, 0xA8, 0xA3, 0xAD, 0x87, 0x34, 0x2F,
-    0x0B, 0x60, 0x59, 0xB1, 0x6C, 0xDC, 0x1A, 0x5F, 0xDE, 0xBD, 0x9D, 0x13, 0x40, 0xBA, 0xB7, 0xB2,
-    0x24, 0x69, 0x6B, 0xA9, 0x61, 0x03, 0x57, 0x3D, 0x0E, 0x47, 0xEA, 0x6D, 0xB4, 0xD0, 0x8C, 0xC8,
-    0x69, 0x5D, 0x68, 0x71, 0x14, 0xE2, 0xB8, 0x2A, 0xD0, 0xAF, 0xF0, 0xFA, 0xE2, 0x8E, 0x47, 0x0D,
-    0x37, 0x6C, 0xD1, 0xB7, 0x62, 0x8E, 0x51, 0x18, 0x21, 0x13, 0x82, 0xE4, 0x8D, 0xBB, 0x4C, 0xA4,
-    0x73, 0x6C, 0xA6, 0x3A, 0x08, 0xB1, 0x2D, 0x9E, 0xFF, 0xF2, 0xBE, 0x7D, 0xF7, 0xD1, 0xA3, 0x4C,
-    0x76, 0x3A, 0x3F, 0x69, 0xDA, 0xE9, 0xA5, 0xAE, 0x38, 0x6A, 0x7C, 0x39, 0x15, 0xB6, 0x1B, 0xF3,
-    0x17, 0x83, 0x37, 0xAE, 0x5C, 0x09, 0xA8, 0xFD, 0x27, 0x3E, 0xF6, 0x06, 0x62, 0x97, 0xF8, 0x5B,
-    0x9E, 0x4E, 0xD3, 0x1A, 0x93, 0x48, 0xB2, 0x14, 0x41, 0xB8, 0x28, 0x8E, 0xB0, 0xEA, 0xF9, 0x3E,
-    0xFB, 0xFA, 0xB5, 0xF7, 0x37, 0xD9, 0xCF, 0xE1, 0xDD, 0x1C, 0xBE, 0xF3, 0xF8, 0x5F, 0xA4, 0xB9,
-    0x0C, 0xD6, 0xB1, 0x8D, 0x6F, 0x9D, 0x22, 0x1F, 0x44, 0x9E, 0x5D, 0xD4, 0x54, 0xF8, 0xA0, 0x17,
-    0x03, 0x05, 0xDB, 0xE8, 0x8E, 0x05, 0x16, 0x5E, 0xF7, 0x26, 0xA0, 0x1F, 0x35, 0xF0, 0xB5, 0xE0,
-    0xA7, 0xD7, 0xED, 0xFB, 0xC8, 0xE9, 0x6A, 0xDC, 0x6D, 0x89, 0xE9, 0x3D, 0xBA, 0x69, 0x17, 0x45,
-    0xB0, 0x33, 0x07, 0xA7, 0x99, 0x92, 0xCD, 0x0C, 0xFB, 0x2D, 0xF1, 0x5F, 0xBC, 0x22, 0x26, 0xE4,
-    0xDA, 0xE2, 0xF2, 0xCB, 0x1D, 0x9E, 0x31, 0x38, 0x7E, 0xF6, 0xC7, 0x3B, 0x21, 0x0D, 0x37, 0x71,
-    0xBC, 0xB1, 0xCD, 0x9A, 0x4D, 0x89, 0x1A, 0x97, 0x92, 0xDD, 0xC9, 0x4B, 0xF2, 0x9F, 0xFD, 0x29,
-    0xF9, 0xD5, 0xD7, 0xBF, 0x97, 0xE6, 0xBE, 0x0B, 0xED, 0xFF, 0x2E, 0xC7, 0x37, 0xC3, 0x8E, 0x33,
-    0xDA, 0x1E, 0xB7, 0x4B, 0xBC, 0xC2, 0x21, 0x20, 0x76, 0xC3, 0xB8, 0x6B, 0x03, 0xBF, 0x01, 0xA3,
-    0x58, 0x2D, 0xE9, 0x2F, 0xA1, 0x0F, 0x0E, 0x0E, 0x5C, 0xE2, 0xB2, 0xC4, 0xEA, 0xB2, 0x2B, 0x4D,
-    0x37, 0x69, 0xB4, 0xE4, 0xD6, 0x57, 0xF0, 0x8F, 0xFB, 0x2D, 0xAC, 0x7A, 0x12, 0x88, 0x88, 0x9C,
-    0x45, 0x8E, 0x5C, 0xA4, 0x4C, 0xD3, 0x81, 0x82, 0x8F, 0xCE, 0x61, 0x87, 0x61, 0x73, 0x26, 0x9E,
-    0x91, 0x80, 0x2C, 0x3A, 0x1D, 0x8F, 0x29, 0x70, 0xDF, 0x76, 0x2C, 0x43, 0x9D, 0xF9, 0xDF, 0x46,
-    0x76, 0x83, 0x2D, 0x05, 0x9B, 0xBD, 0xC6, 0xA3, 0x53, 0x58, 0x3C, 0x84, 0x8B, 0x90, 0x20, 0x2E,
-    0xF0, 0xED, 0x87, 0xFC, 0xF1, 0x39, 0x1F, 0xF7, 0xC3, 0xC1, 0xC3, 0x57, 0xD2, 0x4F, 0xAD, 0xC9,
-    0xC3, 0x0F, 0xA9, 0x85, 0xBF, 0x52, 0x92, 0xEF, 0x6C, 0x62, 0xFB, 0xCA, 0x3C, 0x5A, 0x13, 0x93,
-    0xF1, 0x13, 0x69, 0xCE, 0x92, 0x28, 0xCE, 0xD2, 0x8A, 0xD2, 0xB9, 0x11, 0xA4, 0xE3, 0xC2, 0x71,
-    0xC8, 0x87, 0xDD, 0xAE, 0x89, 0x81, 0x93, 0xA7, 0xC0, 0x73, 0x1E, 0xCE, 0x1A, 0xC1, 0x23, 0x4B,
-    0x4F, 0xD5, 0x2D, 0x0C, 0x74, 0xB0, 0x67, 0xF5, 0xA0, 0x49, 0xCD, 0xD1, 0x0F, 0xEB, 0xB6, 0xAF,
-    0xF4, 0xEF, 0xB8, 0xC1, 0x66, 0xF4, 0x90, 0xDA, 0x61, 0x50, 0x84, 0x33, 0x5F, 0xC6, 0xFF, 0x1F,
-    0x10, 0x84, 0x1F, 0x95, 0xF2, 0x23, 0xE0, 0xD3, 0x0A, 0x97, 0x4B, 0xFC, 0x0F, 0xD3, 0x5A, 0xF1,
-    0xFF, 0x61, 0x28, 0x03, 0x00, 0x63, 0x60, 0x60, 0x66, 0x00, 0x01, 0x7B, 0x10, 0xC1, 0xFC, 0x1F,
-    0xCC, 0xFC, 0x0F, 0x66, 0x82, 0x48, 0x5B, 0x06, 0x7D, 0x20, 0xF3, 0x01, 0x88, 0xB4, 0x3F, 0x76,
-    0xA1, 0x1E, 0x24, 0x7A, 0xF0, 0x3F, 0x50, 0xC1, 0x3F, 0xF6, 0xFF, 0x40, 0xE6, 0x03, 0xFB, 0xFF,
-    0xFA, 0xFF, 0xFF, 0x31, 0xFF, 0xFF, 0x67, 0xFF, 0xFF, 0x03, 0x18, 0x35, 0xFD, 0x07, 0x49, 0xC6,
-    0xFF, 0xFF, 0x00, 0x24, 0x41, 0xFA, 0xED, 0xBF, 0x02, 0x99, 0x0C, 0xF6, 0x8E, 0x60, 0xA3, 0xD8,
-    0x81, 0x4C, 0x06, 0xBB, 0xFD, 0x60, 0x1B, 0x3E, 0xC0, 0xAD, 0x64, 0x50, 0x00, 0x62, 0x00,
+static const uint8_t notosans_12_italicBitmaps[24833] = {
+    0xB5, 0x99, 0x3F, 0x8C, 0x64, 0xC7, 0x71, 0x87, 0xBF, 0xEE, 0x26, 0xF9, 0x6C, 0x35, 0x78, 0xBD,
+    0x01, 0x05, 0x1B, 0xA4, 0x6E, 0x9E, 0x03, 0x07, 0x02, 0x71, 0x3B, 0x93, 0x28, 0x38, 0x18, 0xEF,
+    0xED, 0x34, 0x79, 0x80, 0x14, 0x28, 0xD0, 0xC1, 0xE0, 0x29, 0xB0, 0x00, 0x29, 0xB6, 0x2D, 0x81,
+    0x0A, 0x18, 0x8C, 0x81, 0x77, 0x3B, 0x2D, 0x5E, 0xC0, 0x40, 0x81, 0x08, 0x18, 0x96, 0x43, 0x31,
+    0x20, 0x60, 0x6A, 0x19, 0xDC, 0x19, 0x18, 0x18, 0x0F, 0xD0, 0xDC, 0x4D, 0xF3, 0x2E, 0x60, 0xE0,
+    0x40, 0x2D, 0xDA, 0x06, 0x03, 0xC2, 0x60, 0x93, 0xE2, 0xC1, 0x02, 0x65, 0xF9, 0x5A, 0x56, 0xD3,
+    0x1A, 0xDE, 0xCD, 0x6E, 0x3B, 0x78, 0xB3, 0x7B, 0x7F, 0x68, 0x01, 0x26, 0x29, 0x0E, 0x76, 0x81,
+    0xD7, 0xF5, 0xBA, 0xAB, 0xEB, 0x75, 0x55, 0xFD, 0xAA, 0xAA, 0x8B, 0x5E, 0x45, 0x63, 0x3B, 0x99,
+    0x8C, 0x6B, 0x49, 0x95, 0x1F, 0xB1, 0x50, 0xDE, 0x00, 0x18, 0xBB, 0x2F, 0xB2, 0x80, 0x91, 0xD1,
+    0x2F, 0x5C, 0xFF, 0x59, 0x4C, 0x8B, 0xB3, 0x67, 0x1E, 0x3D, 0x25, 0xA5, 0x45, 0xFA, 0x2F, 0x41,
+    0x3A, 0x0D, 0x67, 0x35, 0x9C, 0x56, 0x0E, 0x2D, 0x82, 0x78, 0xF5, 0xFD, 0xDB, 0x6E, 0x55, 0x4A,
+    0xE2, 0xCA, 0x08, 0x1A, 0x0D, 0xA7, 0x94, 0xA7, 0xB2, 0x91, 0x52, 0x4A, 0x9A, 0x96, 0xB2, 0xE6,
+    0x39, 0x03, 0x67, 0x94, 0xC3, 0x48, 0x8F, 0x72, 0x09, 0x11, 0xCE, 0x02, 0x5C, 0x01, 0x03, 0xFA,
+    0x43, 0x74, 0xD9, 0x88, 0x0F, 0xAE, 0xDB, 0xE6, 0x0C, 0xEA, 0x86, 0xA7, 0x3D, 0x8B, 0xBC, 0x63,
+    0xD1, 0x6B, 0x30, 0x19, 0x7E, 0x19, 0x78, 0x74, 0x8C, 0x78, 0x23, 0x72, 0xA6, 0x55, 0x7F, 0xFB,
+    0xB6, 0x9F, 0x96, 0xC8, 0xB3, 0x11, 0xBE, 0x0B, 0x1A, 0x38, 0x0F, 0x00, 0xE2, 0x08, 0xF5, 0xBD,
+    0x3B, 0x41, 0xF9, 0x34, 0x93, 0x61, 0x76, 0x4A, 0xC4, 0x33, 0xCA, 0x25, 0x23, 0x42, 0x52, 0xFE,
+    0xCA, 0x82, 0xD4, 0xCC, 0xAE, 0x35, 0xA7, 0x9B, 0x3B, 0x6F, 0x5D, 0x6E, 0x16, 0xCD, 0xB5, 0xDD,
+    0xC6, 0x30, 0x3A, 0xAD, 0xBC, 0xD1, 0x44, 0xA3, 0xFC, 0x73, 0xDA, 0xA6, 0x33, 0x95, 0x6B, 0x4E,
+    0x29, 0xAF, 0x7F, 0xA4, 0x3C, 0xC5, 0x72, 0xFC, 0x13, 0xC5, 0x21, 0x6F, 0xAF, 0x11, 0xA9, 0x86,
+    0x5E, 0x79, 0x76, 0x49, 0x68, 0x97, 0xE1, 0xD7, 0x6B, 0x98, 0x66, 0xA8, 0x23, 0x4C, 0x96, 0x9C,
+    0xDF, 0x33, 0xAE, 0x1F, 0x93, 0x1B, 0x43, 0xBD, 0xA7, 0xBC, 0x3C, 0x22, 0x31, 0x65, 0x8F, 0x79,
+    0xA8, 0x6E, 0x1F, 0x2D, 0x99, 0xAF, 0x8D, 0x03, 0x18, 0x8D, 0x77, 0x9B, 0xB3, 0x5F, 0xFA, 0x13,
+    0x4E, 0x61, 0x30, 0x56, 0x3B, 0xE5, 0x55, 0x10, 0x89, 0x05, 0x0D, 0x35, 0xDA, 0xA9, 0x40, 0xA2,
+    0xC1, 0xA0, 0x3C, 0x89, 0x16, 0x6D, 0x45, 0xA4, 0xA1, 0xB2, 0x70, 0x16, 0x8D, 0x08, 0x9C, 0x3D,
+    0x7E, 0x79, 0x32, 0xAB, 0x63, 0x8C, 0xB1, 0xCA, 0xCB, 0x48, 0xA2, 0xA7, 0xA3, 0x61, 0x97, 0xF1,
+    0x20, 0xBE, 0xF2, 0x90, 0xB0, 0x0D, 0xED, 0xA3, 0xE8, 0x3B, 0xF0, 0x44, 0x49, 0xF2, 0xC3, 0x57,
+    0xE4, 0xDB, 0xA8, 0x77, 0x83, 0x48, 0x1D, 0x3B, 0x06, 0x04, 0xF0, 0x28, 0x54, 0x0E, 0x11, 0x61,
+    0x06, 0x23, 0x3E, 0x77, 0xF9, 0xFD, 0xBF, 0x2F, 0x65, 0x3D, 0x0C, 0xEE, 0x79, 0x03, 0xC8, 0xD8,
+    0x6A, 0x9F, 0x47, 0xCA, 0xC3, 0x93, 0xAF, 0x94, 0x77, 0x2E, 0x40, 0xBB, 0x7F, 0x71, 0x07, 0x2A,
+    0x07, 0x19, 0xC6, 0xC3, 0x9E, 0x3D, 0x18, 0x50, 0x11, 0x3A, 0x30, 0x16, 0x91, 0xA0, 0x05, 0xED,
+    0x20, 0x9D, 0x4C, 0x5A, 0x43, 0x0D, 0x2A, 0x0C, 0xA2, 0xEA, 0x43, 0x4C, 0x09, 0xC6, 0x2F, 0xB5,
+    0x37, 0x2A, 0xA8, 0x9F, 0x25, 0xF2, 0x9A, 0xB6, 0xC5, 0x7C, 0x0D, 0xF5, 0xBA, 0x17, 0xBF, 0x8E,
+    0x74, 0x3D, 0xE3, 0x31, 0xE6, 0xAB, 0xAE, 0x7A, 0x2D, 0xA9, 0xD0, 0xAA, 0xA4, 0x7F, 0x99, 0x58,
+    0x45, 0x00, 0x6A, 0xA6, 0x7E, 0x15, 0x0F, 0x73, 0xD3, 0x50, 0x53, 0x39, 0x19, 0xC9, 0xF7, 0x1F,
+    0xE9, 0xF6, 0x71, 0xD0, 0x69, 0xA0, 0x14, 0x7B, 0x8A, 0xCD, 0x20, 0x47, 0x73, 0x22, 0xF3, 0x20,
+    0x8E, 0xC8, 0x70, 0x11, 0x6A, 0x8B, 0x0E, 0xC8, 0x04, 0x4B, 0x98, 0x82, 0x2E, 0x25, 0x94, 0xB2,
+    0x19, 0x4E, 0xA1, 0x04, 0x51, 0x8A, 0x3D, 0xC5, 0xF2, 0x84, 0x45, 0xE5, 0x21, 0x23, 0xAE, 0xA2,
+    0x8F, 0xE0, 0x72, 0x02, 0xED, 0x61, 0x0F, 0x64, 0x1C, 0x3E, 0x38, 0x9C, 0x67, 0x59, 0xDD, 0x5E,
+    0xD9, 0x49, 0x71, 0xDB, 0x0F, 0xF6, 0xC8, 0x0D, 0xCC, 0x1D, 0xF5, 0x02, 0xF5, 0x53, 0xC8, 0x89,
+    0xB6, 0x46, 0x3F, 0x1F, 0x65, 0x6C, 0xE9, 0x94, 0xAF, 0x69, 0x94, 0xAF, 0xFC, 0xAA, 0x94, 0xB7,
+    0x4A, 0xD9, 0x40, 0x82, 0x1A, 0x44, 0x84, 0x5D, 0x98, 0x96, 0xA0, 0xCA, 0x86, 0x1E, 0x8C, 0x85,
+    0x04, 0x23, 0x90, 0x01, 0xA6, 0x47, 0xA8, 0xB2, 0x81, 0x2A, 0x42, 0x0D, 0x24, 0x30, 0x20, 0x12,
+    0xEC, 0x49, 0xB4, 0x9F, 0xBE, 0x9A, 0x65, 0x59, 0xDF, 0x35, 0xEF, 0x55, 0x94, 0x25, 0xAB, 0x8C,
+    0x4C, 0x88, 0x04, 0x19, 0x3A, 0x18, 0xCF, 0xA3, 0xB9, 0xB6, 0x52, 0x59, 0xFD, 0x2C, 0x93, 0x3B,
+    0x76, 0x6B, 0xCC, 0x57, 0xBC, 0x7A, 0x2D, 0x89, 0xB4, 0x27, 0x72, 0x75, 0x67, 0xCD, 0x3C, 0x03,
+    0x4C, 0x4B, 0x31, 0xA5, 0x78, 0x54, 0x40, 0x24, 0x48, 0xD0, 0x43, 0x03, 0x2D, 0xD4, 0x60, 0x2C,
+    0xDA, 0xA1, 0x3C, 0x2A, 0x1E, 0xB3, 0x5E, 0x42, 0xCB, 0xB1, 0x69, 0xA2, 0x8F, 0x30, 0x25, 0x19,
+    0x77, 0x51, 0x79, 0xFD, 0xBD, 0x24, 0x63, 0x43, 0x36, 0x6E, 0xCD, 0xED, 0x35, 0x93, 0xC4, 0xFC,
+    0x1A, 0x57, 0xAB, 0xD0, 0xD1, 0x8D, 0x31, 0xC6, 0xAA, 0x1B, 0x51, 0xA4, 0x25, 0x6B, 0xF3, 0xFE,
+    0x86, 0xD5, 0x89, 0xF4, 0xF5, 0x9A, 0x49, 0xF1, 0x13, 0xD6, 0x86, 0x5A, 0x3B, 0x75, 0x3D, 0x90,
+    0x32, 0x5D, 0xCB, 0x44, 0xFB, 0xDA, 0x1F, 0x3E, 0x1B, 0xEB, 0xC3, 0xCC, 0x33, 0x0D, 0x8C, 0x07,
+    0x94, 0x71, 0x68, 0xBF, 0xB7, 0xF2, 0x66, 0x38, 0x7F, 0xE9, 0xF6, 0x75, 0xF8, 0xD3, 0x93, 0x83,
+    0x40, 0x85, 0xFD, 0x2A, 0xEC, 0xC0, 0x17, 0xD9, 0xE7, 0x2A, 0xF7, 0xBC, 0x00, 0x50, 0xB1, 0xF2,
+    0xDA, 0x19, 0x46, 0x34, 0x27, 0xB4, 0x97, 0x90, 0x19, 0x1D, 0x99, 0x38, 0xAE, 0x21, 0xD7, 0xB0,
+    0x86, 0x27, 0x32, 0x4C, 0x22, 0xCC, 0x5F, 0x44, 0x1C, 0x81, 0xDC, 0x6A, 0xDA, 0x94, 0xF2, 0xC6,
+    0xC1, 0xC1, 0x4B, 0x77, 0xD9, 0x95, 0x92, 0x0F, 0x0E, 0x5E, 0x01, 0x4E, 0x83, 0xCA, 0x30, 0x09,
+    0xB0, 0xB2, 0x88, 0x43, 0xA8, 0x12, 0x5C, 0x43, 0x1E, 0x52, 0xBF, 0xC7, 0xCA, 0x71, 0x08, 0xCF,
+    0x9D, 0xAC, 0x7B, 0xE2, 0x48, 0x94, 0x23, 0x69, 0x3B, 0xC8, 0xA8, 0x80, 0x81, 0x35, 0xC6, 0x8B,
+    0x35, 0xB5, 0x23, 0x53, 0x59, 0xCE, 0x1C, 0x9F, 0x0C, 0x6C, 0x50, 0x11, 0x01, 0xF0, 0xD7, 0xBF,
+    0x00, 0x5D, 0x8A, 0x63, 0xDF, 0x56, 0x49, 0xE4, 0x01, 0xC6, 0x68, 0x0C, 0xCF, 0xBE, 0xB7, 0x3B,
+    0x92, 0xB7, 0xD7, 0xA7, 0x1B, 0xED, 0x16, 0xA3, 0xB3, 0x35, 0x69, 0xF4, 0xDC, 0x2E, 0xF1, 0xF4,
+    0xA2, 0x11, 0xE1, 0xCC, 0x95, 0x46, 0x85, 0xE6, 0x4A, 0x53, 0xF9, 0xC5, 0x62, 0x3C, 0x7A, 0x37,
+    0xCD, 0x4C, 0x2E, 0xAE, 0x11, 0xF6, 0xB1, 0x41, 0x7B, 0xC6, 0xB1, 0x83, 0xBA, 0xFD, 0x17, 0x09,
+    0xE6, 0xE5, 0x45, 0xC0, 0x6E, 0xA9, 0xCC, 0x41, 0x6D, 0x60, 0x9C, 0xE0, 0x37, 0x1E, 0xFD, 0x03,
+    0x4B, 0xB3, 0x8B, 0x8C, 0x3D, 0xB5, 0x88, 0xAC, 0x2B, 0x5F, 0xBD, 0x7F, 0x99, 0x69, 0xD9, 0x88,
+    0x0F, 0x2E, 0x24, 0x63, 0x55, 0x58, 0x62, 0xCE, 0x05, 0xC6, 0x13, 0xE8, 0x33, 0x22, 0x51, 0x3E,
+    0xA4, 0x2E, 0x6B, 0x19, 0x75, 0x68, 0xD9, 0x53, 0x5E, 0xC6, 0x8E, 0x3D, 0xED, 0x2A, 0xFF, 0xE1,
+    0xD7, 0xB3, 0x29, 0x99, 0xDB, 0x97, 0x7D, 0xCD, 0x44, 0x46, 0x72, 0x8B, 0xB9, 0xE4, 0xC9, 0x0D,
+    0x75, 0xE5, 0xAB, 0xB8, 0x2A, 0x6B, 0x53, 0x3E, 0xDC, 0x9A, 0x55, 0x71, 0xB2, 0x14, 0x37, 0x75,
+    0x7F, 0x20, 0x13, 0xD4, 0x16, 0xD6, 0x83, 0x73, 0x4E, 0x80, 0x3C, 0xE0, 0x8D, 0x01, 0x9A, 0xED,
+    0x30, 0x0E, 0x9E, 0x6A, 0x3C, 0xD4, 0x77, 0xD6, 0xD4, 0x65, 0x00, 0x89, 0xF2, 0x0B, 0xAA, 0x72,
+    0xC4, 0x58, 0x1C, 0x91, 0x59, 0x2A, 0xCF, 0xBA, 0x46, 0xA6, 0x9E, 0xEA, 0x46, 0xA0, 0x36, 0x96,
+    0x65, 0x83, 0x7C, 0x27, 0x61, 0xBE, 0xEF, 0xE8, 0x5A, 0x54, 0x4A, 0x4C, 0xCE, 0x79, 0xB9, 0xAE,
+    0x99, 0xBB, 0x55, 0xC9, 0xAA, 0x7C, 0x08, 0x94, 0xE2, 0xE6, 0x25, 0x8E, 0xC1, 0x58, 0x94, 0x47,
+    0x0C, 0x1E, 0xB2, 0x77, 0xC1, 0x9A, 0xB2, 0x56, 0xEF, 0xFF, 0x78, 0x3B, 0x6E, 0x07, 0xAC, 0x1C,
+    0xDE, 0xAF, 0x4A, 0x98, 0x96, 0xF4, 0xBB, 0x96, 0xB6, 0x60, 0x0E, 0x5E, 0x56, 0xE5, 0x50, 0x7C,
+    0x70, 0xE1, 0x23, 0x4B, 0x87, 0x31, 0x5B, 0x7C, 0xCA, 0x4C, 0xCA, 0x21, 0x47, 0xFC, 0xB1, 0xCC,
+    0x50, 0x85, 0x41, 0x3B, 0x35, 0x83, 0xFB, 0xB5, 0x7C, 0xFE, 0x99, 0x96, 0x69, 0x6E, 0x78, 0x32,
+    0x37, 0x90, 0x5A, 0x44, 0xDA, 0x43, 0xC6, 0x09, 0x2A, 0x18, 0xAF, 0x7C, 0x75, 0x54, 0x3C, 0xAB,
+    0xA3, 0x21, 0x0C, 0x26, 0x0C, 0x1D, 0x95, 0x1F, 0x23, 0xA3, 0xB1, 0x64, 0xE5, 0x69, 0x44, 0xC2,
+    0xD0, 0x53, 0xF9, 0xF1, 0x85, 0xAF, 0x47, 0x53, 0x4A, 0x56, 0xEF, 0x1F, 0x2C, 0x45, 0xA2, 0xA6,
+    0x47, 0xBB, 0x16, 0x19, 0x0C, 0x27, 0x33, 0x8F, 0x89, 0x2A, 0xC0, 0x2A, 0x8B, 0xE2, 0x48, 0x54,
+    0x9E, 0x31, 0x64, 0x94, 0xA7, 0x86, 0x19, 0x32, 0x62, 0x2C, 0x0D, 0x22, 0xA1, 0x1D, 0x2D, 0x24,
+    0x9E, 0x78, 0x4F, 0x94, 0x34, 0x28, 0xAA, 0x83, 0x1E, 0x32, 0x24, 0x44, 0x42, 0x46, 0x64, 0x44,
+    0x05, 0x94, 0xA7, 0xF2, 0x68, 0x87, 0xB1, 0x18, 0x30, 0x50, 0xC3, 0x18, 0x5A, 0x68, 0x60, 0xC9,
+    0x97, 0x33, 0x25, 0x72, 0x00, 0x24, 0x7A, 0x11, 0x65, 0x92, 0x51, 0x7B, 0x15, 0x26, 0x28, 0xBF,
+    0xA4, 0xBA, 0x9E, 0xD0, 0xDF, 0xF7, 0x98, 0x67, 0xC1, 0x1C, 0x81, 0xB9, 0x05, 0xF5, 0x57, 0x1D,
+    0xE3, 0xCA, 0xD3, 0xAA, 0x40, 0x23, 0x13, 0x0D, 0x99, 0x8E, 0x9E, 0x9E, 0x8E, 0xCC, 0x1E, 0x24,
+    0x46, 0xC8, 0x48, 0x8B, 0xF2, 0x74, 0x68, 0x47, 0xC6, 0x58, 0x12, 0xF5, 0x09, 0xB5, 0xA1, 0xF2,
+    0xAC, 0xCA, 0xDB, 0x65, 0x23, 0x36, 0x30, 0x67, 0x05, 0x53, 0x3F, 0xF1, 0x4C, 0xA2, 0x59, 0x60,
+    0x16, 0xEA, 0xDF, 0xD1, 0x9D, 0xF8, 0x0F, 0xA7, 0x7E, 0x4A, 0x1F, 0xD5, 0x9B, 0xBE, 0x6D, 0xC4,
+    0xBB, 0xD1, 0x18, 0x52, 0x56, 0x37, 0xFC, 0xAC, 0x11, 0xF1, 0x4A, 0x53, 0xB3, 0xD8, 0x1D, 0x57,
+    0xBE, 0xAD, 0xBE, 0x26, 0xA3, 0x11, 0xBF, 0xB4, 0xB9, 0xF2, 0x73, 0xDF, 0x88, 0x68, 0x42, 0xCD,
+    0x42, 0x25, 0xED, 0x1A, 0x92, 0x8C, 0x88, 0x4C, 0xE5, 0xAE, 0x21, 0xE3, 0xC4, 0x93, 0x4D, 0xA6,
+    0x51, 0x6F, 0x53, 0x8B, 0x9F, 0xFB, 0xCA, 0xF5, 0xBD, 0x0C, 0x6D, 0x4D, 0x36, 0x2A, 0x34, 0xCA,
+    0xF7, 0xB5, 0x88, 0x46, 0xBB, 0x85, 0x7A, 0x23, 0xB4, 0xCC, 0x92, 0xC1, 0x34, 0x95, 0x97, 0xB7,
+    0x44, 0x64, 0xEE, 0x16, 0x98, 0xD0, 0x20, 0xD3, 0x71, 0xAE, 0x13, 0x51, 0xA5, 0x58, 0x95, 0x55,
+    0x52, 0x89, 0x3D, 0x99, 0xD0, 0x3E, 0x43, 0xEA, 0xA0, 0x19, 0x83, 0x31, 0x16, 0x75, 0x23, 0x20,
+    0x52, 0x82, 0x65, 0x03, 0x7B, 0xC6, 0x52, 0x9F, 0x8B, 0x18, 0xBF, 0x44, 0x7B, 0xE3, 0x75, 0x10,
+    0x65, 0x15, 0xD0, 0xC7, 0x11, 0xAE, 0xBC, 0x47, 0x5D, 0x92, 0x8C, 0xB5, 0x6B, 0xE9, 0x94, 0x57,
+    0xBE, 0xA3, 0xD1, 0xAE, 0xF2, 0x99, 0xB5, 0xB1, 0x73, 0x4A, 0xF1, 0x75, 0x79, 0x51, 0x46, 0x68,
+    0xEF, 0x8B, 0xA2, 0xDB, 0x98, 0xF6, 0x29, 0x64, 0x52, 0xFF, 0xB7, 0x4C, 0x55, 0x04, 0x2E, 0x0E,
+    0xA1, 0x17, 0x36, 0xC0, 0xC3, 0xF7, 0x08, 0xE9, 0x3F, 0x2A, 0xE4, 0x85, 0x6B, 0x94, 0x62, 0xEB,
+    0x57, 0xBD, 0x8C, 0x2D, 0xAD, 0x8C, 0xCA, 0xD7, 0x34, 0xE4, 0xCA, 0x6B, 0xDF, 0xD3, 0x18, 0xAB,
+    0x22, 0x40, 0x55, 0x5E, 0x34, 0x65, 0xAD, 0xC3, 0x1F, 0x6E, 0x03, 0x61, 0x07, 0xC6, 0x21, 0xD7,
+    0x30, 0x09, 0x88, 0x23, 0xD0, 0x11, 0x96, 0xC7, 0xAE, 0x2A, 0xD3, 0x79, 0xB1, 0x9E, 0xDC, 0x5A,
+    0x57, 0x25, 0x03, 0xCC, 0x4B, 0xB9, 0x5C, 0x4A, 0x50, 0x01, 0x86, 0xA5, 0x5B, 0x9F, 0x7F, 0x70,
+    0xEC, 0x8F, 0x59, 0x9F, 0x8C, 0x11, 0x71, 0xEB, 0x84, 0x2D, 0x32, 0x1A, 0x58, 0x54, 0x9E, 0x56,
+    0x46, 0x0C, 0x99, 0xCA, 0x37, 0x03, 0x31, 0x57, 0x9E, 0xE6, 0x84, 0xB8, 0x9D, 0x99, 0x55, 0x60,
+    0xC9, 0x92, 0xAB, 0x98, 0x3B, 0x87, 0xB0, 0x3A, 0x1C, 0x0E, 0x7B, 0x81, 0x7C, 0x37, 0x62, 0xBE,
+    0xE2, 0x58, 0xD6, 0xA8, 0xD0, 0x30, 0x21, 0x91, 0x95, 0xD7, 0xCE, 0xD0, 0xD0, 0xCA, 0xC8, 0xC2,
+    0x20, 0x63, 0x4F, 0x75, 0xC9, 0x33, 0x1A, 0x43, 0x97, 0xE0, 0x8E, 0x45, 0x6D, 0xC0, 0x04, 0x98,
+    0x02, 0x33, 0x0C, 0xEA, 0x4D, 0x2F, 0x33, 0x5D, 0xC3, 0xD4, 0x9A, 0x4B, 0x5E, 0x67, 0x52, 0xC3,
+    0x6F, 0xED, 0x58, 0xF9, 0xDD, 0x99, 0xF2, 0x8D, 0x7A, 0xDD, 0xF5, 0xCA, 0xCF, 0x66, 0x86, 0xC6,
+    0x54, 0xDF, 0x4B, 0xEA, 0xB5, 0x78, 0xB6, 0xA5, 0x69, 0xD4, 0x0B, 0x5E, 0xBD, 0xEE, 0x9A, 0x05,
+    0xCD, 0x42, 0xFD, 0x14, 0xF5, 0x36, 0x6D, 0x64, 0x1C, 0xD4, 0x06, 0xB9, 0x61, 0xEA, 0x98, 0x58,
+    0x95, 0x90, 0x89, 0x3D, 0xA0, 0xA1, 0x72, 0x32, 0x8A, 0x44, 0x4D, 0x0B, 0xC9, 0x38, 0xF4, 0xF3,
+    0x09, 0x9A, 0x0E, 0xD4, 0x2D, 0xA0, 0x0E, 0xC0, 0x1A, 0x98, 0x7A, 0xD0, 0x1B, 0x10, 0xFF, 0x1D,
+    0xA0, 0xAD, 0xC1, 0xB8, 0x84, 0x4C, 0xDA, 0xD1, 0xD1, 0x61, 0xAC, 0x0A, 0x2A, 0x32, 0xA6, 0x47,
+    0xBF, 0xE0, 0x45, 0x6A, 0x68, 0x55, 0xD0, 0x6E, 0x2C, 0x92, 0x48, 0x2D, 0x46, 0x3B, 0x3E, 0x48,
+    0xE8, 0xAB, 0x30, 0x77, 0xA8, 0x74, 0x62, 0xA5, 0xDD, 0x90, 0xEC, 0xDE, 0xCD, 0xBC, 0x98, 0x97,
+    0x0D, 0xAB, 0xB2, 0x01, 0xB1, 0xBE, 0x1B, 0x50, 0x6A, 0x06, 0x3C, 0x5E, 0x83, 0x4A, 0x1F, 0x21,
+    0xC9, 0x63, 0x92, 0x85, 0x69, 0x29, 0x4C, 0x4B, 0x81, 0x49, 0xA2, 0xF8, 0x01, 0x11, 0x7B, 0x64,
+    0xC0, 0x40, 0x83, 0x88, 0x27, 0x88, 0xA8, 0x3C, 0x23, 0x58, 0xA0, 0x3C, 0x06, 0x3A, 0x44, 0x44,
+    0x5B, 0xA6, 0x89, 0xE2, 0x38, 0xAB, 0x7C, 0xA3, 0xFC, 0xAE, 0x0C, 0x23, 0x92, 0x21, 0x19, 0x16,
+    0x95, 0x9B, 0x0D, 0x34, 0xA6, 0xA1, 0x3A, 0xDC, 0x62, 0x93, 0xA3, 0x1F, 0x10, 0xCB, 0x20, 0x22,
+    0xBB, 0x27, 0x88, 0x35, 0x43, 0x9F, 0x50, 0xC7, 0xCC, 0x83, 0xDE, 0xC0, 0x29, 0x10, 0x19, 0xA6,
+    0x9E, 0xEA, 0x3B, 0x90, 0x12, 0x23, 0x6D, 0x95, 0x6F, 0x98, 0xC9, 0xA0, 0x31, 0x44, 0x16, 0xBB,
+    0xA8, 0xD7, 0x2C, 0x0F, 0x4D, 0xCA, 0xBA, 0x94, 0x88, 0x91, 0xB1, 0x51, 0x8E, 0xC7, 0x85, 0x9D,
+    0x7F, 0x10, 0xF7, 0xBF, 0x91, 0x5B, 0x36, 0x13, 0x26, 0xC6, 0xEA, 0x17, 0xBC, 0x7C, 0x37, 0x92,
+    0x7B, 0xBA, 0x96, 0xA9, 0x76, 0xF5, 0xF3, 0xA9, 0x0E, 0xD3, 0xAB, 0x57, 0xAA, 0xC3, 0x21, 0x9B,
+    0xEA, 0x86, 0xC2, 0x20, 0x0F, 0x71, 0x39, 0xC1, 0xE8, 0x11, 0x27, 0xDF, 0x2C, 0xEC, 0xDD, 0xDC,
+    0xA8, 0xAC, 0xFC, 0x3E, 0x8D, 0xF6, 0x6A, 0x70, 0xB8, 0xCA, 0x27, 0x96, 0x35, 0xE6, 0xE9, 0x24,
+    0xD2, 0xD4, 0x5D, 0x54, 0x6F, 0xAF, 0xDC, 0xD9, 0xF9, 0x10, 0xB0, 0x1F, 0x7F, 0xB1, 0x2A, 0x61,
+    0xFF, 0xCB, 0x2A, 0x0C, 0x38, 0x7D, 0x12, 0x60, 0x02, 0xDA, 0x51, 0xC3, 0xF4, 0x55, 0x37, 0xD9,
+    0xDA, 0xB9, 0xD8, 0xD6, 0x20, 0x61, 0x9B, 0xFB, 0x8B, 0x97, 0x3A, 0x51, 0xDE, 0x72, 0xD7, 0xBE,
+    0x91, 0x8D, 0x9D, 0xAA, 0x28, 0x53, 0xCB, 0xB8, 0xF2, 0x32, 0xF4, 0xB4, 0x03, 0x12, 0x6C, 0xB4,
+    0xAB, 0xDD, 0xB2, 0xCA, 0xEA, 0xCE, 0x5B, 0xD4, 0x79, 0x80, 0xCB, 0xC7, 0x6D, 0x55, 0xFC, 0x7E,
+    0x7D, 0x29, 0x8C, 0xC6, 0xF4, 0x49, 0xBF, 0xFE, 0xCB, 0xC3, 0x49, 0x71, 0xEB, 0x93, 0xFD, 0x76,
+    0xA6, 0xAF, 0xFA, 0xC9, 0xD1, 0xDD, 0x14, 0x72, 0xE5, 0xD1, 0xFF, 0x05, 0xDD, 0x50, 0x10, 0x18,
+    0x0B, 0x17, 0xCF, 0x53, 0x17, 0xCF, 0x13, 0xFF, 0x0A, 0xBB, 0xDB, 0x5C, 0x64, 0x6B, 0x23, 0xFD,
+    0x7D, 0x59, 0x8A, 0x48, 0xC3, 0xF9, 0xB4, 0xC3, 0xE1, 0x54, 0x7E, 0x88, 0xE1, 0x19, 0x8A, 0x47,
+    0xAE, 0x01, 0x1E, 0x71, 0xE7, 0xAB, 0xF2, 0x4D, 0xF9, 0xE1, 0xB3, 0xA1, 0x65, 0xA3, 0xBD, 0xF6,
+    0x99, 0xBE, 0xC6, 0x3C, 0x1F, 0xC9, 0x63, 0x6A, 0x15, 0x54, 0x1A, 0xB3, 0x2F, 0x53, 0x1D, 0xCC,
+    0xAD, 0x8E, 0xF9, 0xBF, 0xF8, 0x93, 0x33, 0x4F, 0x0F, 0xB3, 0xC7, 0xBC, 0x78, 0x59, 0xC2, 0xEF,
+    0xD4, 0x83, 0xDD, 0xBB, 0xB9, 0x3C, 0xD1, 0x43, 0xE5, 0x7B, 0x7A, 0x63, 0x8D, 0x4D, 0xA4, 0x1A,
+    0x23, 0xA3, 0x48, 0x2D, 0x63, 0xE5, 0x55, 0x68, 0x68, 0x60, 0x47, 0x46, 0xE3, 0x1E, 0x02, 0x61,
+    0xC7, 0x64, 0xE5, 0x6B, 0x66, 0x32, 0x1A, 0xDB, 0x88, 0xA4, 0x5D, 0x4B, 0x52, 0x1E, 0xD8, 0x41,
+    0x46, 0x8C, 0xE3, 0x21, 0x00, 0x61, 0x1F, 0x48, 0x03, 0xC2, 0x47, 0xD2, 0x80, 0x63, 0x7F, 0x50,
+    0x81, 0x1A, 0x93, 0x99, 0xDA, 0x07, 0x24, 0x15, 0x09, 0x46, 0x3C, 0x23, 0x63, 0x6D, 0xDB, 0x2A,
+    0xA8, 0xD7, 0x32, 0xDD, 0x45, 0xF4, 0x8F, 0x2C, 0x3F, 0x89, 0x98, 0x02, 0xEB, 0x4C, 0x5D, 0x6D,
+    0x11, 0x3C, 0x29, 0x6F, 0x6C, 0x43, 0x0F, 0x9D, 0x8C, 0xC6, 0x36, 0xA4, 0xCA, 0x6F, 0x25, 0xED,
+    0x65, 0xB8, 0x5F, 0x52, 0xFB, 0x8A, 0x78, 0x99, 0x7F, 0x2C, 0xD7, 0x8B, 0x6F, 0x6F, 0xFE, 0xCF,
+    0xCF, 0xB2, 0x09, 0x13, 0xDF, 0x56, 0x51, 0x07, 0xF3, 0x54, 0x92, 0x49, 0x85, 0x9E, 0x4C, 0x6A,
+    0x69, 0xE8, 0x0C, 0x35, 0xE3, 0xCA, 0x6B, 0x67, 0x9E, 0x8E, 0x2A, 0x28, 0x9F, 0x49, 0xA4, 0xE6,
+    0xE4, 0x0D, 0xC2, 0xFE, 0x98, 0xDD, 0x79, 0x56, 0xB7, 0xBE, 0xE5, 0xA7, 0xAE, 0xAB, 0x62, 0xE5,
+    0x97, 0x74, 0xC6, 0x69, 0x97, 0x59, 0x1B, 0xCC, 0x53, 0x49, 0xA4, 0x31, 0x13, 0x15, 0x64, 0x6C,
+    0x69, 0x2B, 0xAF, 0x3C, 0x8F, 0x5B, 0x51, 0xB2, 0xBE, 0xB9, 0xAC, 0xED, 0xDE, 0x1E, 0x75, 0x43,
+    0xDD, 0x51, 0xF7, 0x8C, 0x33, 0x7B, 0x99, 0xA6, 0xA7, 0xEF, 0x44, 0x9A, 0x5C, 0x0E, 0x7A, 0x30,
+    0xAF, 0x9D, 0xC7, 0x91, 0xAF, 0x17, 0xCC, 0xDF, 0xCC, 0x99, 0xDA, 0x46, 0xAC, 0x49, 0x95, 0x57,
+    0x7E, 0x8C, 0x21, 0xD3, 0x29, 0x2F, 0x53, 0x8D, 0xB1, 0x4B, 0x3A, 0xB5, 0xAE, 0x82, 0xD9, 0x3F,
+    0xA2, 0x99, 0x87, 0x07, 0x4C, 0x4A, 0x79, 0x18, 0x01, 0x27, 0xAE, 0xBB, 0xB8, 0xC7, 0x75, 0xD5,
+    0x1B, 0x1F, 0x75, 0xDD, 0x54, 0x1D, 0x36, 0x50, 0x83, 0x76, 0xC7, 0x91, 0xAA, 0x81, 0x11, 0xD8,
+    0x97, 0x75, 0x1D, 0xDA, 0x9B, 0x1C, 0x52, 0xC5, 0x13, 0xB5, 0x19, 0xE8, 0x4E, 0x12, 0x3C, 0x12,
+    0xF0, 0x57, 0xD6, 0x14, 0x7F, 0xF8, 0xF8, 0xA0, 0xDA, 0x3D, 0x98, 0x5B, 0xA6, 0x8E, 0xDA, 0x51,
+    0x43, 0xB3, 0x23, 0xD3, 0xED, 0xD5, 0xD3, 0x43, 0x74, 0xC4, 0xF2, 0x5D, 0x1A, 0x26, 0xCF, 0xAC,
+    0x4A, 0x75, 0x73, 0x7B, 0xD7, 0xB1, 0x2D, 0xE9, 0x87, 0x47, 0x71, 0xDB, 0x4D, 0x22, 0xF0, 0x30,
+    0xE2, 0x5C, 0x90, 0x31, 0x91, 0x1B, 0x9A, 0x9A, 0x5A, 0xBB, 0xEA, 0xD2, 0x30, 0xEE, 0xE8, 0x46,
+    0x27, 0xA2, 0xCF, 0xAF, 0x5E, 0xD1, 0x03, 0xEA, 0x9C, 0xE7, 0xE1, 0x05, 0x6D, 0x4F, 0x37, 0x23,
+    0x77, 0x32, 0x35, 0xCA, 0x37, 0xDA, 0x35, 0x86, 0x66, 0x4C, 0xDB, 0xB0, 0xDB, 0x33, 0x4E, 0xD4,
+    0x81, 0xDA, 0xB3, 0xC3, 0x79, 0xFE, 0x3C, 0xEA, 0xA0, 0xBF, 0xEF, 0xA6, 0xB6, 0x19, 0x89, 0x5F,
+    0xC9, 0x38, 0x33, 0x33, 0x23, 0xE2, 0x2C, 0x76, 0xD5, 0xA5, 0x1B, 0x97, 0x42, 0x3D, 0x3A, 0x55,
+    0xD3, 0x5D, 0x39, 0x9B, 0xF9, 0x8D, 0xFB, 0x8D, 0x57, 0xFF, 0xA9, 0x7E, 0x85, 0x89, 0x26, 0x31,
+    0xB5, 0x53, 0xC7, 0x86, 0x0D, 0x08, 0x2B, 0xEC, 0x98, 0x25, 0xA9, 0x46, 0x9F, 0x0B, 0x74, 0x19,
+    0x75, 0x04, 0xB5, 0x43, 0x64, 0x98, 0x7B, 0x4C, 0x83, 0x7A, 0x23, 0xB2, 0x36, 0x4C, 0xE8, 0xB5,
+    0x57, 0x9E, 0xF3, 0x3C, 0x4C, 0x4F, 0x4B, 0x4F, 0x47, 0x47, 0x1E, 0xB2, 0x51, 0xE5, 0x69, 0xB4,
+    0xA3, 0x35, 0xB0, 0x3B, 0x86, 0xD3, 0x0D, 0x8C, 0x16, 0x70, 0x2A, 0x0D, 0xE1, 0xD7, 0xF8, 0x01,
+    0x58, 0x26, 0xDB, 0xEA, 0x66, 0x0D, 0xF3, 0x04, 0x73, 0x07, 0x5C, 0xB8, 0x20, 0x4A, 0xE1, 0xC2,
+    0x45, 0x58, 0x23, 0x13, 0x95, 0xC7, 0x58, 0xDA, 0xBB, 0xA3, 0x1A, 0xA6, 0x07, 0x2F, 0xCD, 0x4B,
+    0x44, 0x26, 0x8E, 0x18, 0x9F, 0x84, 0x8B, 0x05, 0x06, 0x12, 0x17, 0x99, 0x5B, 0x1D, 0xD1, 0x6E,
+    0xA0, 0x9E, 0x84, 0x0B, 0x12, 0x26, 0x32, 0xE6, 0x9F, 0xDE, 0xFA, 0xCE, 0x03, 0x7F, 0x0B, 0xE8,
+    0x31, 0x89, 0x9A, 0x07, 0xA2, 0x8D, 0x0C, 0x98, 0x20, 0xAE, 0x72, 0x71, 0x58, 0x3E, 0x42, 0x06,
+    0x1A, 0x94, 0xA7, 0xA7, 0x60, 0x1C, 0x0F, 0x5B, 0x4C, 0xB1, 0xFF, 0xF0, 0xC3, 0x92, 0xF9, 0xDC,
+    0x7B, 0xD8, 0x9D, 0xEA, 0xF9, 0xD0, 0x8D, 0xF4, 0x6B, 0x69, 0x59, 0xAB, 0x90, 0xAB, 0xEB, 0xD1,
+    0x9C, 0xF3, 0x23, 0x6D, 0x1B, 0xC3, 0xCE, 0x63, 0x3C, 0x2C, 0x69, 0x4E, 0x31, 0xDB, 0x25, 0x75,
+    0x32, 0x66, 0x7D, 0x3D, 0x75, 0xF5, 0x39, 0x9F, 0x5B, 0xF3, 0x74, 0xC8, 0x82, 0xE3, 0x1C, 0xB2,
+    0x1F, 0xAC, 0x5C, 0x44, 0x10, 0x7E, 0x20, 0xAD, 0x87, 0x42, 0x7B, 0xEA, 0x91, 0xB7, 0xC0, 0x34,
+    0xD0, 0x67, 0xD4, 0xF5, 0xC0, 0x58, 0x3B, 0x91, 0x46, 0x18, 0xD7, 0xB1, 0x7F, 0x90, 0x54, 0x29,
+    0xBE, 0xBE, 0xF0, 0x2D, 0x32, 0xAD, 0xF6, 0xE4, 0x16, 0xF9, 0x6E, 0x42, 0xFF, 0xC0, 0x52, 0x6F,
+    0x59, 0xB7, 0x03, 0x10, 0xCB, 0x00, 0xD5, 0x76, 0x3B, 0xE3, 0xA0, 0xF6, 0x43, 0xEE, 0xF1, 0x13,
+    0x0F, 0xBF, 0xF1, 0xC8, 0x9F, 0x07, 0xD4, 0xF5, 0x80, 0x7E, 0x3E, 0x52, 0x8B, 0xC8, 0x9E, 0x48,
+    0xEC, 0x1F, 0x24, 0x4A, 0x49, 0xE2, 0x83, 0x0B, 0x49, 0x05, 0xB2, 0xF6, 0x64, 0x63, 0xE9, 0x27,
+    0xD0, 0xB7, 0xD0, 0x0D, 0xBC, 0xAA, 0x08, 0x75, 0x82, 0xEE, 0x2C, 0xC4, 0x2F, 0xFC, 0xFE, 0xF9,
+    0x37, 0xBB, 0xD0, 0xB5, 0x77, 0x83, 0xD4, 0xEF, 0x91, 0xF7, 0xEF, 0xA1, 0x0C, 0x57, 0x76, 0x88,
+    0x8C, 0x17, 0x81, 0xE7, 0xE0, 0x8F, 0x3C, 0xE2, 0xF0, 0xF8, 0x3E, 0x66, 0x28, 0x16, 0x2C, 0x5C,
+    0x19, 0x2E, 0x58, 0xD6, 0x55, 0x39, 0x92, 0x11, 0x32, 0xDC, 0x45, 0xA6, 0x9B, 0xCF, 0x50, 0x8A,
+    0xDB, 0x3B, 0x78, 0xF1, 0x41, 0xA4, 0xAA, 0x41, 0x97, 0x43, 0x55, 0xCA, 0xF6, 0x98, 0x03, 0x2A,
+    0xA0, 0xC2, 0xD6, 0x3C, 0x3E, 0x25, 0xB7, 0x8B, 0x30, 0xF7, 0xCC, 0x66, 0x3C, 0x57, 0x7D, 0x7A,
+    0x6E, 0xD5, 0x25, 0x2F, 0xE2, 0xB6, 0x3E, 0x63, 0x5A, 0x62, 0x5D, 0xD6, 0x77, 0x67, 0x6F, 0xAB,
+    0x81, 0xBF, 0x3B, 0xAF, 0xCA, 0x11, 0xB7, 0x0F, 0xEC, 0x7D, 0xD5, 0xC1, 0xF0, 0x7E, 0x52, 0xB2,
+    0xD9, 0xDE, 0x59, 0xF6, 0x90, 0x10, 0x71, 0xF8, 0x48, 0x5D, 0x6C, 0xBD, 0xBE, 0x1F, 0x99, 0x45,
+    0xA2, 0x72, 0xF7, 0x86, 0xE3, 0x2D, 0x78, 0x8B, 0x6B, 0xB6, 0x2E, 0x27, 0xE6, 0x9E, 0x91, 0x61,
+    0x6B, 0xEB, 0xAB, 0xCC, 0x3C, 0x3E, 0x58, 0x75, 0x77, 0x30, 0x7B, 0xB0, 0x5A, 0x1F, 0x4A, 0xF5,
+    0x27, 0xDE, 0x63, 0xBE, 0x39, 0x36, 0x6B, 0x93, 0xE8, 0x1A, 0xE2, 0xE9, 0x4F, 0xC5, 0xA7, 0xD9,
+    0xBD, 0x6B, 0xBD, 0x9F, 0x90, 0xC9, 0xCE, 0x43, 0x30, 0xBF, 0x64, 0xF9, 0xB3, 0xE2, 0xF9, 0x82,
+    0x76, 0x5B, 0x05, 0x8A, 0x38, 0x71, 0xF4, 0x3A, 0xD1, 0xAA, 0x43, 0x0C, 0xBF, 0xF5, 0x95, 0x9F,
+    0x25, 0x11, 0xC7, 0x63, 0x16, 0xE6, 0x2B, 0xBE, 0x55, 0x3E, 0x1B, 0xD2, 0xB8, 0xF2, 0x33, 0x75,
+    0x3D, 0xEE, 0x92, 0x17, 0xC6, 0x8E, 0x1A, 0xE5, 0xD5, 0x4F, 0x45, 0xE2, 0x27, 0x7E, 0x46, 0x1D,
+    0x77, 0x51, 0xD9, 0xC0, 0x72, 0x2B, 0xDC, 0x78, 0x7B, 0x15, 0xCF, 0x0C, 0xA8, 0xB6, 0xC4, 0xF9,
+    0x1A, 0x4A, 0x09, 0x1C, 0xB2, 0x61, 0x83, 0x71, 0x4B, 0x64, 0x6A, 0xA1, 0xA9, 0xC1, 0x68, 0x87,
+    0xBA, 0x11, 0x20, 0x65, 0xE8, 0x1A, 0x98, 0x18, 0x30, 0x97, 0x02, 0x55, 0x58, 0xA3, 0xD2, 0x04,
+    0x99, 0x54, 0x92, 0x99, 0xF9, 0xAD, 0x8C, 0x2C, 0xF1, 0xBE, 0xBB, 0xCA, 0x76, 0xFB, 0xBF, 0x3B,
+    0x5C, 0x2F, 0x7E, 0x86, 0x5B, 0x55, 0x11, 0xAA, 0x0D, 0x54, 0x37, 0x1C, 0xCA, 0x7D, 0xF7, 0xB3,
+    0xDC, 0xAA, 0x19, 0x83, 0xD1, 0xF7, 0xB6, 0x65, 0x7E, 0xCF, 0x57, 0x15, 0xC3, 0x2E, 0x0C, 0x69,
+    0x11, 0x69, 0x68, 0x89, 0x00, 0x8C, 0x20, 0x69, 0x47, 0xA7, 0x02, 0x63, 0x12, 0xDA, 0x76, 0xA8,
+    0x30, 0x86, 0x64, 0x2C, 0x9D, 0xF2, 0x8C, 0x49, 0x18, 0xDB, 0xA1, 0xFC, 0x09, 0x31, 0x6C, 0x89,
+    0x2D, 0xDA, 0x6B, 0xAF, 0x03, 0xC3, 0x4E, 0xE1, 0x3E, 0x35, 0x2D, 0x87, 0xC2, 0x87, 0x06, 0x38,
+    0xFB, 0x99, 0x6E, 0x65, 0x3C, 0xE8, 0x35, 0xE8, 0xAF, 0x81, 0xE6, 0xA5, 0xCF, 0x72, 0xAB, 0x45,
+    0x03, 0xBB, 0xE6, 0xEE, 0x78, 0x86, 0xF2, 0x63, 0x44, 0x32, 0x76, 0xE8, 0x9D, 0x89, 0x84, 0xB1,
+    0x3D, 0xCA, 0xB7, 0x88, 0x64, 0x86, 0x9B, 0xE8, 0x76, 0x7B, 0x97, 0xB8, 0x25, 0x0E, 0x33, 0x5B,
+    0x32, 0x13, 0x26, 0x4C, 0xAC, 0x3A, 0x2A, 0x96, 0xC9, 0x3D, 0x1D, 0x39, 0x3D, 0x60, 0xDB, 0xA9,
+    0xE3, 0x60, 0x2E, 0x5E, 0x7A, 0xAC, 0x2A, 0xDF, 0xAC, 0x6E, 0xAE, 0xCE, 0x05, 0x73, 0x3D, 0xC9,
+    0x94, 0xE9, 0xBB, 0xE3, 0x3E, 0xD1, 0x8D, 0xA0, 0x52, 0x2F, 0xD6, 0x13, 0x71, 0xA8, 0xEE, 0xBC,
+    0x35, 0x14, 0x3E, 0x77, 0x23, 0x9D, 0x71, 0x68, 0x87, 0xB2, 0x9F, 0x9C, 0xC9, 0x1A, 0x8A, 0x25,
+    0xA5, 0x2D, 0x8E, 0x7D, 0x22, 0x26, 0x66, 0xE8, 0x5C, 0x0C, 0xBF, 0x47, 0xDC, 0xF9, 0xFA, 0x70,
+    0x56, 0xFF, 0xF0, 0xD0, 0xD8, 0xA9, 0xF6, 0xFA, 0x46, 0x90, 0xEF, 0x24, 0xFA, 0x9E, 0x76, 0x4C,
+    0x6D, 0xAC, 0xB9, 0x1E, 0xAB, 0xB8, 0xAC, 0xB2, 0xB9, 0xF5, 0x6D, 0x51, 0xBE, 0xF6, 0x31, 0x8A,
+    0xDE, 0x2F, 0x6C, 0xD1, 0x4F, 0x79, 0xF1, 0x2C, 0x3A, 0x6E, 0x6F, 0x75, 0x65, 0x44, 0xF9, 0xE1,
+    0xFB, 0xC5, 0xCB, 0xCC, 0x37, 0xD5, 0x3B, 0xEB, 0x56, 0xBC, 0x1B, 0xF5, 0x0F, 0x58, 0xEE, 0xAF,
+    0xDE, 0x28, 0x6B, 0xE3, 0x68, 0xA1, 0x47, 0x24, 0xA1, 0x6E, 0x2F, 0xEF, 0x71, 0xC8, 0xE5, 0xC0,
+    0x8B, 0x53, 0xDB, 0x3A, 0x58, 0x94, 0x54, 0xBD, 0xB3, 0x36, 0x76, 0x36, 0xA6, 0x6F, 0x64, 0xDA,
+    0x5F, 0x85, 0xD5, 0x11, 0x6B, 0xC8, 0xD0, 0x43, 0x87, 0x9D, 0xBE, 0xEA, 0xEF, 0x3A, 0xDA, 0x14,
+    0x79, 0xC4, 0x6E, 0x23, 0xFD, 0x17, 0x3F, 0xE6, 0xC6, 0x32, 0x24, 0x53, 0x6D, 0xB9, 0xFC, 0x25,
+    0x75, 0x11, 0xEB, 0x7D, 0x63, 0x67, 0xBD, 0xFC, 0xB9, 0x9F, 0xD4, 0x97, 0xF3, 0xEA, 0x48, 0x45,
+    0x8C, 0x65, 0x0C, 0x1D, 0xF6, 0xE8, 0xF2, 0x71, 0x9F, 0xA8, 0xA6, 0xA5, 0xE1, 0x39, 0x78, 0x98,
+    0x5E, 0x05, 0x43, 0x27, 0xA2, 0x1E, 0xBA, 0xDD, 0x63, 0xF2, 0xB6, 0xDB, 0xAD, 0xA2, 0x8C, 0x22,
+    0x32, 0xD4, 0x11, 0x27, 0xE5, 0xC5, 0xE8, 0xDE, 0x4A, 0xC3, 0x58, 0xE5, 0x49, 0x83, 0xFC, 0xD3,
+    0xD0, 0x36, 0x5F, 0x54, 0xF6, 0xFF, 0x31, 0x59, 0xBD, 0x16, 0xD3, 0x02, 0x80, 0xC7, 0xB6, 0x64,
+    0x91, 0x98, 0xDD, 0x7D, 0xEC, 0x69, 0x87, 0x2E, 0x2E, 0x82, 0x1D, 0x8E, 0x4E, 0xB1, 0x5B, 0xBC,
+    0x7A, 0x6A, 0x01, 0xF0, 0xD8, 0xE7, 0x5E, 0x94, 0x6F, 0x16, 0xBB, 0xF7, 0xC1, 0x46, 0xAD, 0x2B,
+    0xBF, 0x4F, 0xA7, 0x7D, 0xE5, 0xD7, 0xF4, 0xC6, 0x1A, 0x97, 0xC8, 0x35, 0xB5, 0x1C, 0x2E, 0x2A,
+    0x54, 0x50, 0xA1, 0xDB, 0xF6, 0xA5, 0x86, 0xCE, 0x9B, 0xB6, 0xDB, 0xCE, 0xD3, 0xC7, 0x2A, 0x23,
+    0xEF, 0xD5, 0xEC, 0xE7, 0xF8, 0x24, 0xCB, 0xB5, 0x67, 0x92, 0xE8, 0x17, 0x22, 0x9C, 0xF9, 0x24,
+    0xCB, 0xFB, 0x86, 0xC5, 0x71, 0x7B, 0xED, 0xE3, 0xAE, 0x1D, 0x9A, 0xAF, 0x18, 0x20, 0x0C, 0xD5,
+    0xDD, 0x63, 0x2D, 0x63, 0x83, 0x39, 0x37, 0xF4, 0x2D, 0x7B, 0x66, 0xC3, 0xF8, 0x2B, 0xBE, 0x7A,
+    0x2D, 0x1E, 0xBB, 0x62, 0x75, 0xE7, 0x2D, 0x56, 0xF7, 0x83, 0x82, 0x76, 0x54, 0x0E, 0xE5, 0x3E,
+    0x39, 0x93, 0x0D, 0x14, 0x4B, 0x4E, 0xBC, 0xF4, 0xE8, 0x27, 0x66, 0x62, 0x2A, 0xA7, 0xAE, 0x6F,
+    0xCD, 0x5E, 0x58, 0xCE, 0x67, 0xFA, 0x86, 0xD6, 0x60, 0x2A, 0x5F, 0x5D, 0x8F, 0x22, 0x0E, 0xE3,
+    0x9A, 0xBA, 0x72, 0xC7, 0xA0, 0x50, 0xDF, 0xFA, 0xB6, 0xDC, 0x82, 0xC2, 0x36, 0x10, 0x97, 0x72,
+    0xC8, 0xB4, 0x94, 0xE2, 0x4D, 0x30, 0xA0, 0x92, 0x48, 0xB0, 0x1C, 0x12, 0x44, 0x19, 0x11, 0x69,
+    0xE8, 0xC5, 0xAA, 0x7F, 0x7B, 0x46, 0x05, 0xE6, 0x25, 0xB4, 0xE8, 0xF7, 0x5F, 0x51, 0x7E, 0xC8,
+    0x52, 0x0D, 0xA8, 0x40, 0x82, 0x3D, 0x6A, 0x90, 0x49, 0x46, 0x30, 0xBE, 0x05, 0xE6, 0xB7, 0x4A,
+    0x81, 0x55, 0x29, 0xE9, 0x44, 0x55, 0x8F, 0xBC, 0x28, 0x4A, 0x9E, 0x1E, 0xEA, 0x9B, 0x57, 0x3F,
+    0x9C, 0xD4, 0x76, 0x1A, 0xEA, 0x3D, 0x6A, 0x57, 0x37, 0xD4, 0x5C, 0x9C, 0x51, 0x5F, 0xCE, 0x3D,
+    0x93, 0xE2, 0xF2, 0x80, 0x4C, 0x7B, 0xD0, 0xB3, 0x82, 0x4E, 0x14, 0xBB, 0x33, 0xB9, 0xFC, 0xCF,
+    0xB7, 0xB3, 0x3E, 0x3A, 0xF6, 0xF0, 0x27, 0x0F, 0x5E, 0x99, 0x96, 0xCD, 0xE7, 0x2F, 0x9C, 0x7F,
+    0xF2, 0xE0, 0xE0, 0xE0, 0xE0, 0x95, 0x69, 0x29, 0xA5, 0x6C, 0x3E, 0x7F, 0xE1, 0xC2, 0x85, 0x0B,
+    0xE7, 0x85, 0x6F, 0xB4, 0x4D, 0x7B, 0x55, 0x78, 0x0C, 0x15, 0x96, 0xE6, 0xA9, 0xB4, 0xAB, 0xDC,
+    0x0E, 0xC2, 0xBF, 0x64, 0x2A, 0xBB, 0x68, 0xD4, 0xF5, 0xB8, 0x67, 0x44, 0x5E, 0x0A, 0x6B, 0x51,
+    0x6F, 0xA4, 0x89, 0x71, 0xB9, 0xAB, 0xAE, 0x87, 0x5D, 0x43, 0xBC, 0x22, 0x8E, 0x8F, 0xD4, 0x76,
+    0xEA, 0xF5, 0x38, 0x95, 0x1F, 0x64, 0xE3, 0x96, 0x3B, 0xD8, 0x87, 0xF8, 0x5F, 0x8D, 0x98, 0xBF,
+    0xAF, 0x25, 0x47, 0x56, 0xC7, 0x3F, 0xD5, 0xC5, 0xB8, 0x80, 0x0A, 0x8E, 0x03, 0x08, 0x16, 0xA4,
+    0x57, 0x7F, 0x00, 0x7A, 0x7D, 0x63, 0xA4, 0xEE, 0xDB, 0xE5, 0x99, 0xC0, 0x01, 0x81, 0x5F, 0x30,
+    0x66, 0x91, 0x08, 0x4C, 0xB0, 0x89, 0x37, 0x71, 0xFA, 0x40, 0xBD, 0x73, 0xDB, 0x33, 0x01, 0xC1,
+    0x06, 0x76, 0xE2, 0x78, 0x09, 0x8C, 0x84, 0x6C, 0xA4, 0x49, 0x9E, 0xD8, 0xB6, 0xF4, 0x3C, 0xAF,
+    0x3C, 0x13, 0x6C, 0x40, 0xB0, 0xC5, 0xAE, 0x10, 0x01, 0x81, 0x4B, 0x48, 0x23, 0x24, 0x0F, 0xD2,
+    0x96, 0x4D, 0x59, 0x73, 0xDF, 0x70, 0xEF, 0x2D, 0x82, 0xBE, 0xE3, 0x1D, 0xFF, 0x12, 0xB4, 0x3A,
+    0xB8, 0x55, 0x47, 0x3A, 0xBF, 0xBF, 0xE7, 0x7B, 0xFA, 0xA2, 0x5E, 0xF1, 0x74, 0x1D, 0xE6, 0x6F,
+    0x03, 0x2F, 0x03, 0x60, 0xEA, 0x9E, 0xAB, 0x1A, 0xC5, 0x43, 0x06, 0x07, 0x4D, 0x82, 0x16, 0xF4,
+    0xE3, 0xDB, 0x0C, 0x35, 0x9A, 0xCF, 0xFE, 0x81, 0x19, 0x8E, 0x62, 0x01, 0x95, 0x17, 0x71, 0xAD,
+    0x0C, 0x35, 0x03, 0x32, 0xC1, 0x06, 0xF4, 0x0E, 0xDA, 0x0C, 0xFF, 0x1D, 0xB0, 0xEF, 0x78, 0xBA,
+    0x53, 0x9A, 0x34, 0xE3, 0x54, 0x62, 0x6B, 0x82, 0xF9, 0xEC, 0x3E, 0x43, 0xDD, 0xA9, 0x2F, 0x5F,
+    0xCF, 0xE2, 0x75, 0xBC, 0x44, 0x6E, 0x45, 0xDA, 0x15, 0xCC, 0x05, 0x95, 0xD9, 0xD4, 0xDC, 0xD4,
+    0x1A, 0xC4, 0x43, 0xB7, 0x58, 0xB0, 0x13, 0x9C, 0x02, 0xF5, 0x7D, 0x74, 0xDD, 0xE1, 0xD4, 0x8E,
+    0x99, 0xA2, 0xA3, 0x4E, 0x82, 0xF8, 0x8E, 0x5E, 0xE5, 0x26, 0xDB, 0x69, 0xE5, 0x87, 0x5A, 0xA8,
+    0x07, 0x60, 0x73, 0x4D, 0x53, 0x2B, 0xE2, 0x37, 0x74, 0xFC, 0x44, 0x65, 0x8A, 0x9D, 0x74, 0x38,
+    0xA5, 0xE5, 0xCB, 0x1F, 0x66, 0x5D, 0xAF, 0x71, 0x1F, 0x94, 0x45, 0x87, 0xCA, 0x82, 0x09, 0x1D,
+    0x4E, 0x65, 0xB6, 0x76, 0x92, 0x30, 0xD4, 0x3D, 0xB5, 0x4E, 0xB0, 0xA9, 0xD1, 0xD6, 0x1D, 0xE5,
+    0xC5, 0x40, 0x9B, 0x04, 0x3D, 0xE8, 0x00, 0xE3, 0xE2, 0xD7, 0x22, 0x7E, 0x21, 0x5B, 0x47, 0x31,
+    0xD8, 0x5A, 0x41, 0xD7, 0x1A, 0x50, 0xB9, 0x49, 0x70, 0x41, 0x81, 0x8E, 0x0E, 0x04, 0x07, 0x66,
+    0xB2, 0x13, 0x3A, 0x36, 0x09, 0x32, 0x05, 0x46, 0x3A, 0x68, 0x71, 0x20, 0xD8, 0x09, 0x3B, 0xE9,
+    0x88, 0x0E, 0x64, 0x74, 0xA2, 0xA3, 0xC9, 0x38, 0xA4, 0xD6, 0xBA, 0xD3, 0xB5, 0xD6, 0xC3, 0x92,
+    0x95, 0x19, 0x74, 0xEC, 0x81, 0x2C, 0xC0, 0x78, 0x74, 0x79, 0xFF, 0x6D, 0x97, 0xD7, 0xAF, 0x7B,
+    0x5D, 0xF7, 0xDC, 0xF9, 0x60, 0xFA, 0x4E, 0x97, 0x87, 0x9A, 0x75, 0xAD, 0x70, 0xC2, 0x09, 0x2D,
+    0x3A, 0x88, 0x77, 0x30, 0xEB, 0xE0, 0x3C, 0x42, 0x16, 0x4F, 0x13, 0x47, 0x99, 0x60, 0x6C, 0x65,
+    0x02, 0x79, 0xED, 0xCF, 0x02, 0xA8, 0xA7, 0xFF, 0x1E, 0x80, 0x4D, 0x0D, 0xC0, 0x70, 0xC8, 0xC0,
+    0xBA, 0xED, 0x81, 0x41, 0x5E, 0x0D, 0xB0, 0xD2, 0xA1, 0x80, 0x53, 0xB9, 0x05, 0xE7, 0x67, 0x1D,
+    0x10, 0xDF, 0x53, 0x90, 0x49, 0x70, 0x48, 0xD0, 0x41, 0x47, 0x96, 0x2C, 0x45, 0x6A, 0x9D, 0x7E,
+    0x87, 0x4B, 0xD0, 0x09, 0xD6, 0xA0, 0x23, 0x8C, 0xF0, 0x16, 0xF6, 0xE0, 0xF9, 0xF1, 0x76, 0xF1,
+    0x51, 0x58, 0x1C, 0xF7, 0x34, 0xF9, 0x65, 0x1E, 0xE8, 0x43, 0x9D, 0x56, 0x75, 0x51, 0x71, 0x8E,
+    0x09, 0x76, 0x52, 0x3B, 0x0A, 0x43, 0x10, 0x64, 0xAB, 0x72, 0xF3, 0xC4, 0xB7, 0x8C, 0xB9, 0x49,
+    0x22, 0xF4, 0xFA, 0x5F, 0x92, 0x0E, 0x73, 0xCB, 0xE8, 0x74, 0xB4, 0xF7, 0x42, 0x47, 0x29, 0x26,
+    0x48, 0xCB, 0xCC, 0xD3, 0x20, 0xDE, 0x65, 0x72, 0xB3, 0x47, 0x18, 0xBC, 0xCA, 0x3A, 0xD1, 0x02,
+    0xF9, 0x04, 0xE4, 0xD5, 0x00, 0x9B, 0x02, 0x9C, 0xB1, 0x60, 0x63, 0x62, 0x64, 0xC6, 0x05, 0xF1,
+    0x7A, 0x47, 0xA6, 0x4E, 0x8E, 0xF6, 0xA2, 0x49, 0xE6, 0x97, 0xB4, 0xE4, 0xAC, 0x63, 0x7F, 0x42,
+    0x67, 0xEF, 0x26, 0xF3, 0x49, 0xEE, 0x99, 0x3B, 0x1D, 0xE4, 0x35, 0x3F, 0xF2, 0x45, 0xB2, 0x93,
+    0x8C, 0x14, 0x55, 0x11, 0x56, 0x91, 0xAC, 0x0B, 0x8E, 0x35, 0x4D, 0x82, 0x73, 0x5A, 0x5A, 0x56,
+    0x88, 0x77, 0xE8, 0xE0, 0x50, 0x59, 0x3C, 0xB3, 0x78, 0x4E, 0x65, 0x42, 0x7E, 0x36, 0xA1, 0x6B,
+    0x40, 0x3D, 0xCB, 0x30, 0xF7, 0xD0, 0xDB, 0x80, 0x90, 0xD1, 0xA1, 0x45, 0x65, 0x13, 0x98, 0x29,
+    0xF4, 0x38, 0x04, 0x1D, 0x81, 0x5A, 0x13, 0xAE, 0x1E, 0x68, 0xA2, 0x8E, 0x74, 0x74, 0x98, 0x60,
+    0x02, 0x33, 0x23, 0xE2, 0xED, 0x44, 0xA6, 0xE0, 0x10, 0x9A, 0xA8, 0x32, 0x1D, 0x2D, 0x3A, 0x34,
+    0x91, 0x73, 0x7A, 0xC4, 0xEB, 0x40, 0x66, 0x64, 0x8D, 0x9D, 0x6A, 0xA0, 0x48, 0x46, 0x96, 0x98,
+    0xB9, 0x03, 0xAB, 0xB0, 0x0A, 0x48, 0x92, 0x8C, 0xDD, 0xEA, 0xFF, 0xC2, 0xEC, 0xD5, 0x13, 0xAF,
+    0x3F, 0xE5, 0xA3, 0xA8, 0xFE, 0x33, 0x9C, 0x9E, 0xF3, 0x45, 0x92, 0x13, 0xCE, 0x2F, 0xF4, 0xA3,
+    0xD0, 0xF5, 0x2A, 0xE7, 0x53, 0x61, 0xEE, 0xC4, 0x84, 0x5E, 0xEC, 0xCD, 0x24, 0xCD, 0xA3, 0x50,
+    0x74, 0xF8, 0xA7, 0xD8, 0xA9, 0xE4, 0x92, 0x70, 0x61, 0xB2, 0x09, 0x3D, 0xDB, 0x26, 0x09, 0x1D,
+    0x05, 0xCE, 0x31, 0x53, 0x4B, 0x93, 0xC4, 0x73, 0xA1, 0x03, 0xBD, 0xCA, 0x08, 0x33, 0x26, 0xB4,
+    0x34, 0x49, 0xDE, 0x7B, 0xBD, 0xE8, 0x5A, 0x77, 0xEA, 0xD9, 0x07, 0x57, 0xCC, 0x98, 0xD0, 0xD3,
+    0x24, 0x81, 0xA2, 0x03, 0x9D, 0xCA, 0x38, 0x66, 0xEC, 0xF4, 0xFC, 0x92, 0x63, 0x3B, 0x79, 0x36,
+    0x35, 0xAB, 0xAD, 0xDA, 0xEA, 0xC4, 0x68, 0x03, 0xBD, 0x78, 0xDA, 0x15, 0xB4, 0x6B, 0x68, 0x7B,
+    0x68, 0x47, 0xE8, 0x47, 0xE8, 0x46, 0x18, 0x47, 0xD8, 0xF6, 0xA8, 0xBC, 0x46, 0x27, 0x37, 0xB9,
+    0x60, 0x0F, 0x15, 0x55, 0x8F, 0xBA, 0x36, 0xB5, 0x4E, 0xAB, 0x5A, 0xA3, 0xF8, 0x6F, 0x98, 0x6C,
+    0xD1, 0x51, 0x3C, 0x59, 0x07, 0xC6, 0x17, 0xFC, 0xD0, 0x51, 0xF8, 0xEA, 0xB2, 0xFD, 0xDA, 0x25,
+    0x6C, 0xB6, 0x34, 0xF5, 0x80, 0xBC, 0xF2, 0x31, 0x1D, 0x5B, 0x95, 0x55, 0xB6, 0x93, 0x0D, 0x2D,
+    0x2D, 0x85, 0xA2, 0x83, 0x9B, 0x5C, 0xDD, 0x72, 0x75, 0xF0, 0x3A, 0x2E, 0xBD, 0xFE, 0xC2, 0xE8,
+    0xEB, 0x17, 0xB0, 0x2E, 0x8F, 0xAB, 0x93, 0xAE, 0xD5, 0x0F, 0xFE, 0x77, 0x75, 0x86, 0xD5, 0x82,
+    0x0A, 0x1B, 0x60, 0xBD, 0xFC, 0xD4, 0x01, 0xDC, 0x32, 0x0D, 0x54, 0x5E, 0xB0, 0x24, 0x01, 0xDC,
+    0x04, 0xEE, 0x7F, 0x0A, 0xAE, 0x06, 0x80, 0xA1, 0xD6, 0x9F, 0xD5, 0x9A, 0x74, 0x62, 0x19, 0x4A,
+    0x38, 0xB0, 0x13, 0x3A, 0x7E, 0xFB, 0x9C, 0x61, 0x7C, 0xF1, 0x6C, 0x26, 0x5A, 0x32, 0xE2, 0x7B,
+    0x64, 0xB2, 0x93, 0x09, 0x2A, 0xEB, 0x48, 0xA7, 0x32, 0xE2, 0x0B, 0x4D, 0x9A, 0x61, 0xEC, 0x40,
+    0x4E, 0xA1, 0xF9, 0x14, 0xD8, 0xF8, 0x85, 0x15, 0x4C, 0x58, 0xBC, 0x31, 0x19, 0x6A, 0x86, 0x21,
+    0xF1, 0xB5, 0xA7, 0x67, 0x09, 0x53, 0x5D, 0x5D, 0xC3, 0x55, 0xAD, 0x48, 0x2C, 0x1B, 0xB6, 0x3A,
+    0xAC, 0x6D, 0x70, 0x8C, 0x3D, 0x23, 0x39, 0x37, 0xC9, 0xFC, 0x22, 0x88, 0x77, 0x8E, 0x8E, 0xB9,
+    0x53, 0x59, 0x87, 0xAD, 0x9D, 0xD6, 0x6A, 0xDF, 0xFF, 0x71, 0x56, 0xB5, 0x1E, 0xE0, 0xAD, 0x83,
+    0x5F, 0xE2, 0x67, 0x06, 0xF0, 0x40, 0x87, 0x99, 0x9A, 0xA4, 0x32, 0x8E, 0x1E, 0xB2, 0x4C, 0xD8,
+    0xBB, 0x69, 0xA9, 0xBF, 0xFE, 0x14, 0x70, 0x11, 0xD8, 0x02, 0xAB, 0x00, 0x76, 0x07, 0xEA, 0x8B,
+    0x04, 0xBD, 0x03, 0x99, 0x32, 0x4D, 0xB6, 0x13, 0x23, 0x23, 0xE2, 0x75, 0x5C, 0xC6, 0xC3, 0x39,
+    0xD6, 0x7F, 0x67, 0x0B, 0x7C, 0xE3, 0xB2, 0x65, 0xC6, 0xFA, 0xFE, 0xDB, 0x97, 0xE2, 0x87, 0x5A,
+    0x0F, 0x52, 0x6B, 0xF5, 0x47, 0xB2, 0xC8, 0x4B, 0xC5, 0x68, 0x11, 0x9A, 0x98, 0xE9, 0x1D, 0xFA,
+    0x61, 0x62, 0xEC, 0x31, 0x8F, 0x02, 0x73, 0x87, 0xDC, 0x0A, 0xE4, 0x35, 0x4E, 0x1D, 0xEE, 0x27,
+    0x53, 0xF7, 0xA8, 0x5B, 0x11, 0xBA, 0x25, 0xAB, 0x5F, 0x63, 0xE4, 0x73, 0x3A, 0x4E, 0x98, 0xE9,
+    0x68, 0x29, 0x8C, 0xF4, 0x64, 0x66, 0x3A, 0x95, 0x29, 0x74, 0x4D, 0xA2, 0x30, 0x36, 0x91, 0xCC,
+    0xAC, 0xA3, 0xCA, 0x14, 0x1D, 0x9A, 0x44, 0x36, 0x41, 0x47, 0x95, 0xED, 0xA4, 0x43, 0x93, 0xC4,
+    0x9B, 0xD0, 0x24, 0xC1, 0x04, 0x1D, 0x05, 0x3B, 0xE9, 0xE0, 0x10, 0x6F, 0x42, 0x8B, 0x60, 0xA7,
+    0xA1, 0xD6, 0x5A, 0xFD, 0x50, 0x6B, 0xAD, 0x70, 0x4E, 0xFF, 0x3D, 0xB6, 0x2E, 0xBE, 0xB2, 0x95,
+    0xBE, 0xDF, 0x96, 0x4A, 0xE2, 0xF5, 0xFF, 0x65, 0x6B, 0x37, 0xD4, 0x5A, 0xEB, 0x16, 0x80, 0x0B,
+    0xE0, 0x39, 0xD2, 0x33, 0x80, 0xCA, 0xC3, 0x0E, 0x57, 0xBF, 0xD1, 0xAB, 0x2D, 0xD8, 0x3A, 0xE9,
+    0xBA, 0x27, 0xBB, 0x30, 0x52, 0x5A, 0x5A, 0xF1, 0x72, 0x2F, 0xEA, 0x98, 0x9B, 0x3C, 0x36, 0x65,
+    0x55, 0xB7, 0x52, 0x13, 0x9C, 0xC3, 0x09, 0x33, 0xB4, 0x14, 0xE8, 0xC9, 0xD0, 0xA9, 0x0C, 0x5D,
+    0x93, 0x60, 0x6C, 0x12, 0xCC, 0xBA, 0xBE, 0x4B, 0xD1, 0x75, 0x47, 0x36, 0xE1, 0x8E, 0xCA, 0x76,
+    0x72, 0x2A, 0x89, 0x97, 0x9B, 0x49, 0x10, 0x1D, 0x05, 0xA7, 0x83, 0x63, 0x6D, 0x42, 0xAB, 0x76,
+    0x76, 0x1A, 0x6A, 0x11, 0x3F, 0x54, 0x2F, 0x9E, 0x73, 0x68, 0x41, 0x3C, 0x3A, 0xA0, 0x32, 0x8B,
+    0x11, 0xE4, 0xE0, 0x75, 0xDD, 0xA9, 0xEC, 0xC2, 0x4C, 0xEE, 0xE9, 0x05, 0xB9, 0x15, 0xF4, 0x27,
+    0xB9, 0xC9, 0x73, 0x53, 0x86, 0x5A, 0xA4, 0xA6, 0xE3, 0x0C, 0x4B, 0x0C, 0xB5, 0x70, 0x66, 0x8E,
+    0x00, 0xB6, 0x2F, 0x62, 0x5A, 0xD7, 0x1A, 0x6C, 0x3D, 0xFC, 0x16, 0xED, 0xC7, 0x19, 0x20, 0x01,
+    0xB5, 0x6B, 0x6A, 0x0D, 0xE6, 0xF9, 0xFC, 0x02, 0x40, 0x25, 0x36, 0x5B, 0xEC, 0x24, 0x75, 0x47,
+    0xCF, 0x5E, 0xED, 0xC8, 0x12, 0x54, 0x31, 0x61, 0x44, 0xA7, 0x56, 0x27, 0x6C, 0x98, 0x05, 0x9C,
+    0x7E, 0x7C, 0x09, 0x97, 0x52, 0x13, 0x4D, 0xBA, 0x73, 0xDF, 0x23, 0x77, 0x53, 0x0F, 0xBD, 0xF8,
+    0x82, 0xCA, 0x9D, 0x8E, 0xD8, 0x29, 0xCB, 0xC4, 0x68, 0x82, 0x43, 0xA7, 0x96, 0x81, 0x0D, 0x85,
+    0xCD, 0x6F, 0xB2, 0x0E, 0xAC, 0xF6, 0x5F, 0x59, 0xBB, 0xDA, 0x23, 0x75, 0xC7, 0xE0, 0x47, 0x2E,
+    0x19, 0x29, 0xCC, 0x14, 0x0A, 0x85, 0xCC, 0xA5, 0xCA, 0x0C, 0x7F, 0x9E, 0x90, 0x9A, 0x90, 0x0F,
+    0x23, 0x6B, 0x1D, 0xB8, 0x34, 0x41, 0x65, 0x3B, 0xE9, 0x28, 0x5E, 0x26, 0xF1, 0x03, 0xC2, 0x25,
+    0x0E, 0x7E, 0xA0, 0xB8, 0xFA, 0x3C, 0x3E, 0x78, 0x23, 0xFF, 0x84, 0xDD, 0x9A, 0xB5, 0x43, 0x7E,
+    0x3A, 0xE9, 0x5F, 0x47, 0x72, 0x61, 0xEC, 0x59, 0x8B, 0x5F, 0xDD, 0x4C, 0x2E, 0x6E, 0x3E, 0xCE,
+    0x76, 0xD7, 0x7D, 0x15, 0xEA, 0x4B, 0x3B, 0x5C, 0x0D, 0xF6, 0x9A, 0xA6, 0xC0, 0x08, 0xE2, 0x51,
+    0x9F, 0x7F, 0x4C, 0x7B, 0xB5, 0xD3, 0x7B, 0x13, 0x07, 0x5A, 0x13, 0x55, 0xBE, 0xC4, 0xD9, 0xA9,
+    0x49, 0x17, 0xF4, 0xD6, 0xEB, 0x30, 0x33, 0xEB, 0xE0, 0x58, 0xDD, 0x8F, 0x5C, 0x1D, 0x47, 0xEC,
+    0x4B, 0xEF, 0xB2, 0xAA, 0x7E, 0xF5, 0xC3, 0xEC, 0xE8, 0xC4, 0x8B, 0x09, 0x72, 0xF7, 0xD9, 0xFD,
+    0xA9, 0xD6, 0xA9, 0x57, 0x3B, 0xF1, 0xA2, 0xA3, 0x8E, 0x97, 0x2A, 0xCB, 0x93, 0xC2, 0xD5, 0x92,
+    0xE7, 0x1F, 0x7B, 0x57, 0xC3, 0x9F, 0xBA, 0x09, 0x07, 0x33, 0x36, 0x98, 0x9D, 0x3A, 0xF8, 0xD5,
+    0x44, 0xC6, 0x04, 0x1C, 0x2F, 0x0F, 0x1F, 0x86, 0xE1, 0xF0, 0xDC, 0xC7, 0xAB, 0x2D, 0xED, 0xFD,
+    0x65, 0x07, 0x73, 0x4B, 0xF9, 0x4A, 0x73, 0xDD, 0x9B, 0xFA, 0xE9, 0xAD, 0xB4, 0xFA, 0x55, 0xD2,
+    0x39, 0x33, 0xCE, 0xB8, 0x1E, 0xFB, 0x8E, 0xD7, 0xBF, 0x8E, 0x2A, 0x17, 0xCA, 0x8A, 0x9D, 0x7E,
+    0xB6, 0x63, 0x58, 0x30, 0xC0, 0x1F, 0x79, 0x53, 0xC3, 0x83, 0x37, 0x5E, 0x0D, 0xED, 0x9A, 0x2F,
+    0xB3, 0xFD, 0xE7, 0x27, 0xBB, 0xA1, 0xFA, 0x82, 0x8E, 0x88, 0x3F, 0x9A, 0x5B, 0xEA, 0xA1, 0xFE,
+    0x8E, 0x33, 0x7E, 0xA4, 0xF7, 0x14, 0xBB, 0x53, 0x2B, 0xF2, 0xEA, 0x36, 0xF2, 0x4A, 0xEE, 0xC0,
+    0xBE, 0x9D, 0x2E, 0xC0, 0xDC, 0x8D, 0x19, 0xEC, 0x93, 0xCF, 0x32, 0xD8, 0x5A, 0x13, 0xC8, 0xAB,
+    0x8F, 0x22, 0x38, 0x7B, 0x37, 0x42, 0x6B, 0x6F, 0x26, 0x18, 0x45, 0x65, 0xFE, 0x24, 0x0B, 0x87,
+    0x69, 0x08, 0x27, 0x0C, 0xE1, 0x58, 0xE5, 0x37, 0x19, 0xAA, 0x7F, 0x7F, 0x03, 0x1D, 0x64, 0xEC,
+    0xB4, 0xDA, 0x52, 0x03, 0x36, 0x20, 0x9E, 0x1E, 0x95, 0x9F, 0x5D, 0xDD, 0x5C, 0x9A, 0xF0, 0x06,
+    0xEA, 0x56, 0x6C, 0x62, 0xA6, 0x8C, 0x74, 0x2D, 0xCE, 0x7A, 0x7B, 0x2F, 0xE8, 0x98, 0xC9, 0x23,
+    0x63, 0xCB, 0x60, 0x27, 0x77, 0xF7, 0x58, 0xC8, 0xFD, 0x52, 0xC8, 0xBF, 0xFA, 0x7D, 0x4E, 0x4D,
+    0xD0, 0x4F, 0x02, 0x6F, 0x4D, 0x80, 0xF2, 0x9C, 0x15, 0x2E, 0x3A, 0x7A, 0x87, 0xD8, 0xC9, 0x3C,
+    0x8C, 0x4D, 0xCA, 0x94, 0x8E, 0xCE, 0xE1, 0xEC, 0x24, 0x0F, 0x93, 0x49, 0xB3, 0x29, 0xEE, 0x37,
+    0x63, 0x53, 0x5F, 0x03, 0x50, 0x5E, 0xF9, 0x9E, 0xAD, 0x0E, 0x2D, 0x9D, 0x0D, 0xE6, 0x93, 0xCC,
+    0x3C, 0x22, 0x15, 0x6A, 0x46, 0xC4, 0xAB, 0x74, 0x49, 0xAB, 0xA3, 0x8E, 0x2D, 0x1D, 0xD9, 0x04,
+    0x3B, 0xA1, 0x5E, 0xBF, 0x8D, 0xAE, 0x7B, 0xCC, 0xBF, 0x5E, 0x22, 0x7E, 0x44, 0x38, 0xC7, 0x31,
+    0xD3, 0x52, 0xE8, 0xC9, 0x74, 0x2A, 0x73, 0xDE, 0xA4, 0xE5, 0x63, 0x41, 0x87, 0x21, 0xEA, 0x30,
+    0x78, 0x13, 0x00, 0xD4, 0x19, 0xEA, 0x4C, 0x12, 0x43, 0x18, 0x26, 0x75, 0xA0, 0x22, 0x17, 0xE6,
+    0x1F, 0xF9, 0x79, 0x38, 0xBD, 0xD0, 0xBF, 0xE4, 0xF3, 0xD8, 0x8F, 0xFA, 0xD1, 0xDB, 0xFF, 0x91,
+    0x44, 0xC4, 0xFA, 0xF3, 0xEE, 0xA2, 0x6B, 0xE2, 0xCF, 0x43, 0x16, 0xB5, 0x37, 0x53, 0x67, 0x52,
+    0xAB, 0xB2, 0x50, 0x50, 0x9E, 0xB3, 0x9E, 0x56, 0x07, 0x1D, 0x3B, 0x3A, 0x13, 0x4C, 0x98, 0x99,
+    0xA5, 0x56, 0x5F, 0x6B, 0x76, 0x88, 0xCA, 0x2A, 0xB7, 0x8B, 0xC7, 0x1D, 0x9D, 0x09, 0x3A, 0xF0,
+    0xD2, 0xBB, 0xD8, 0x1A, 0x9B, 0xF2, 0x16, 0x23, 0x5B, 0xF1, 0xE6, 0x93, 0xCC, 0xD8, 0x62, 0x1E,
+    0x46, 0xE6, 0x1E, 0xB9, 0x15, 0xC9, 0x2D, 0xAD, 0xCA, 0x26, 0xD8, 0x27, 0x85, 0xD5, 0x6E, 0xA9,
+    0x98, 0x7F, 0x9F, 0x2F, 0x6A, 0x58, 0x3F, 0xDE, 0x4A, 0x5C, 0x99, 0x68, 0x1F, 0xE6, 0x26, 0x6D,
+    0x9F, 0xA7, 0xD1, 0x4C, 0xE6, 0x61, 0x6A, 0x52, 0x79, 0x7E, 0x86, 0xB3, 0x1F, 0xA0, 0x7F, 0x51,
+    0x91, 0xBF, 0xDE, 0x30, 0xF8, 0x51, 0x6D, 0x29, 0x36, 0xE8, 0xB8, 0x46, 0x28, 0x8C, 0x3A, 0x34,
+    0xD9, 0x21, 0xFE, 0x92, 0x51, 0x6F, 0x4D, 0x94, 0x3B, 0x07, 0xC6, 0xAB, 0xD8, 0x24, 0xB0, 0xCB,
+    0x27, 0x1B, 0x79, 0xE1, 0xA5, 0xF6, 0x08, 0xA7, 0xAB, 0x5D, 0x73, 0xFD, 0x17, 0x26, 0x2C, 0xFD,
+    0x49, 0x0B, 0xFD, 0xF3, 0x77, 0x0D, 0x2B, 0x90, 0xCF, 0x62, 0x53, 0x23, 0xA0, 0xFC, 0x8F, 0xD4,
+    0xFB, 0x7C, 0x5E, 0xEF, 0xD5, 0xA9, 0x7F, 0xFC, 0xF4, 0x57, 0x59, 0xC2, 0x2A, 0xF4, 0x26, 0xDA,
+    0x20, 0x37, 0xB3, 0x4E, 0x3A, 0x14, 0xB2, 0xCA, 0x1D, 0x23, 0xE7, 0x8E, 0x13, 0x5A, 0x33, 0x59,
+    0x2F, 0x37, 0x93, 0x8E, 0x2F, 0x48, 0x66, 0x47, 0x4B, 0x0F, 0x7F, 0xC0, 0x0D, 0x4E, 0xB0, 0x93,
+    0x09, 0x26, 0x90, 0x75, 0xFA, 0xED, 0x82, 0x12, 0xC7, 0x65, 0x9D, 0x3E, 0x71, 0x60, 0xDE, 0xF1,
+    0xF0, 0x74, 0x82, 0x21, 0x80, 0x24, 0x68, 0xF2, 0x71, 0x73, 0x18, 0x8F, 0x1B, 0xC9, 0x00, 0xBA,
+    0x02, 0x0B, 0x80, 0x85, 0x65, 0x10, 0xB7, 0x47, 0x69, 0x07, 0xEA, 0x63, 0xD8, 0xD4, 0xD8, 0x5C,
+    0x3F, 0x2B, 0x26, 0x96, 0x4B, 0xF1, 0xB9, 0x77, 0x2A, 0xB7, 0x6D, 0x93, 0xDA, 0xBE, 0x89, 0x6D,
+    0xAF, 0x43, 0xDF, 0xEB, 0x30, 0xB6, 0x26, 0x6C, 0xE5, 0xA7, 0xF7, 0xB2, 0xA9, 0x35, 0x70, 0x75,
+    0xBD, 0xA8, 0x39, 0xF9, 0xBA, 0x2A, 0x46, 0xE0, 0x8C, 0x33, 0x1D, 0x64, 0xB2, 0xD3, 0x8C, 0x98,
+    0xC0, 0xE9, 0xB8, 0x38, 0xB7, 0x07, 0x9D, 0x61, 0x15, 0x69, 0x9E, 0x06, 0x9C, 0x78, 0x8A, 0x43,
+    0x7C, 0xC7, 0x96, 0xF9, 0x3B, 0x51, 0x16, 0xBF, 0x85, 0xB2, 0xB4, 0xF9, 0xF8, 0x81, 0xDD, 0xBB,
+    0x85, 0x91, 0x16, 0x86, 0x7A, 0x89, 0x1B, 0xDC, 0x30, 0x41, 0x7F, 0x92, 0x55, 0x9E, 0x99, 0x7B,
+    0x7A, 0x61, 0x75, 0x2B, 0xBA, 0x70, 0x78, 0x90, 0x65, 0x3F, 0x73, 0xBB, 0x07, 0x01, 0xF3, 0x9C,
+    0xC5, 0x6E, 0x70, 0x83, 0x1B, 0x3A, 0xEA, 0x60, 0x42, 0x56, 0xB9, 0x49, 0x23, 0x33, 0x17, 0x2D,
+    0xA7, 0x74, 0xD6, 0x2F, 0xB3, 0xF1, 0x45, 0x49, 0x69, 0xE9, 0x19, 0xED, 0xB4, 0xF2, 0x43, 0x93,
+    0x56, 0x69, 0x08, 0x77, 0x2E, 0xEF, 0x7C, 0x94, 0xEC, 0xCE, 0x6E, 0x17, 0x22, 0xFF, 0x7E, 0x75,
+    0xFD, 0xFF, 0x5B, 0xDD, 0xB5, 0xDD, 0xD9, 0xED, 0x30, 0xB1, 0x10, 0xE5, 0x71, 0x2D, 0xE8, 0x00,
+    0x7E, 0x8F, 0x3F, 0xBC, 0xCD, 0x6A, 0xCF, 0x8D, 0x37, 0x78, 0x4E, 0xC3, 0x1F, 0xDD, 0x66, 0xA8,
+    0x51, 0xDE, 0xBB, 0xD4, 0x41, 0xDE, 0xCE, 0x4D, 0x1A, 0x29, 0xC2, 0xD8, 0x3C, 0x7B, 0x70, 0x64,
+    0x30, 0xE5, 0x51, 0x37, 0x23, 0x4D, 0xCA, 0x50, 0x3A, 0xE8, 0x1C, 0x38, 0xFB, 0x9E, 0xB7, 0xF7,
+    0xEA, 0xAE, 0x89, 0xD7, 0x6F, 0x84, 0xD2, 0x51, 0x3A, 0x47, 0xEF, 0x4C, 0x10, 0x3B, 0x65, 0xFB,
+    0x28, 0xAE, 0xEE, 0xC7, 0xDC, 0xD4, 0xD8, 0x1D, 0xE3, 0xA1, 0x67, 0x99, 0xFB, 0x2D, 0x7C, 0x74,
+    0x5B, 0xD7, 0xBD, 0xBC, 0xB7, 0x1B, 0xF9, 0x32, 0xE9, 0x7F, 0x0B, 0xF2, 0x06, 0xE3, 0x70, 0x3F,
+    0x1E, 0x2D, 0xBD, 0xC9, 0x50, 0xF9, 0xFB, 0x0D, 0xF4, 0x30, 0xD3, 0xA4, 0xA1, 0xBE, 0x5D, 0x0F,
+    0x50, 0xD0, 0x81, 0x16, 0x95, 0xFF, 0xE6, 0xCA, 0xD7, 0x85, 0x90, 0xCE, 0x78, 0x13, 0x3B, 0xAD,
+    0x0E, 0xF4, 0x4D, 0xB9, 0x43, 0x76, 0x8C, 0x26, 0x14, 0xF2, 0x89, 0x09, 0x3A, 0x5E, 0x1D, 0x10,
+    0x5D, 0x0B, 0x9D, 0xE8, 0xA8, 0xF2, 0x28, 0xDE, 0xDE, 0x4D, 0xA7, 0x74, 0xE2, 0x47, 0x9D, 0x3A,
+    0x0E, 0x57, 0x64, 0xAE, 0x9E, 0xAF, 0xD9, 0x37, 0x5E, 0xF7, 0xA6, 0xEE, 0xD4, 0xF5, 0x5F, 0x86,
+    0x9E, 0x59, 0x07, 0xF1, 0x1D, 0x59, 0x27, 0x87, 0xD4, 0xC4, 0x66, 0x8F, 0xDC, 0x8B, 0x3A, 0x75,
+    0x5C, 0x9A, 0xB0, 0x62, 0x36, 0xD1, 0x7A, 0x80, 0x8B, 0x8E, 0x32, 0xF2, 0xF2, 0xCB, 0x0B, 0xEF,
+    0xA8, 0x9A, 0xED, 0xE3, 0xE2, 0x98, 0xD7, 0x94, 0xB1, 0xC9, 0x0F, 0xAE, 0xC2, 0xF2, 0x5F, 0xC3,
+    0xF2, 0x8E, 0xF8, 0xE1, 0xC3, 0x60, 0xAB, 0x07, 0xFE, 0x17, 0xB5, 0xBC, 0x6F, 0x8C, 0x1E, 0xC7,
+    0x9D, 0xDF, 0xF9, 0xA9, 0xAE, 0x19, 0x16, 0xC5, 0x96, 0x58, 0x4C, 0x40, 0x9D, 0x7D, 0x12, 0x39,
+    0xCD, 0x17, 0x02, 0xA2, 0x55, 0x38, 0xFD, 0x28, 0x00, 0x81, 0x30, 0x7B, 0xDD, 0xF3, 0x94, 0xC4,
+    0xC3, 0xFA, 0x85, 0x5F, 0x68, 0x72, 0xD0, 0x6C, 0x82, 0x18, 0x31, 0x95, 0xDC, 0x1E, 0xB0, 0xEB,
+    0xEC, 0x5A, 0xC4, 0x81, 0x07, 0x4C, 0x8C, 0x26, 0x9F, 0x96, 0x18, 0x44, 0x40, 0x7C, 0x38, 0x31,
+    0x38, 0xAF, 0xF7, 0x80, 0x1C, 0x10, 0xDD, 0x9D, 0xEF, 0xB0, 0x1E, 0x6D, 0x96, 0x93, 0x60, 0x92,
+    0xB4, 0xD7, 0x43, 0x3E, 0x45, 0xF2, 0x85, 0x81, 0xF8, 0xC5, 0x96, 0xC4, 0x78, 0x85, 0x40, 0x88,
+    0x55, 0x32, 0x2D, 0x2C, 0x22, 0x01, 0x66, 0xC9, 0x6E, 0xAD, 0x1E, 0x92, 0xCF, 0xF3, 0xD4, 0xBD,
+    0xE8, 0x9E, 0x21, 0x29, 0xCA, 0xCE, 0xCA, 0xCB, 0x1D, 0x48, 0xE0, 0xD3, 0xD5, 0xFD, 0x74, 0xFF,
+    0xBA, 0xEA, 0xF7, 0xF7, 0xFB, 0xFD, 0xD5, 0xC3, 0x13, 0x4C, 0x99, 0xF2, 0x1B, 0x80, 0xC1, 0x09,
+    0x97, 0x58, 0x69, 0xA5, 0x55, 0x75, 0x6A, 0xB4, 0xD1, 0x64, 0x0C, 0x58, 0xE1, 0x57, 0x00, 0x90,
+    0x35, 0xD2, 0x30, 0x98, 0x88, 0x38, 0x51, 0x1E, 0x5D, 0x33, 0x80, 0x12, 0x0A, 0xA8, 0x76, 0xFE,
+    0x2B, 0x61, 0x60, 0x6A, 0x1D, 0xAD, 0x98, 0x1B, 0x1C, 0xC2, 0x81, 0xA1, 0xFB, 0x1B, 0xB5, 0x24,
+    0x71, 0x8A, 0x72, 0x0B, 0x68, 0x03, 0x1A, 0xC8, 0x80, 0x25, 0x20, 0x87, 0xE4, 0xD2, 0xB7, 0x49,
+    0xE3, 0x1C, 0x2A, 0xA0, 0x01, 0x5A, 0x20, 0x40, 0xE2, 0x21, 0xAD, 0x61, 0x18, 0x63, 0x3D, 0x8C,
+    0xB1, 0x86, 0xE4, 0xF2, 0xEA, 0xDB, 0x31, 0xA6, 0x6F, 0xB4, 0x05, 0xDE, 0x27, 0x57, 0x4D, 0xAA,
+    0x29, 0x72, 0xE9, 0x62, 0xFC, 0xFE, 0xE3, 0x5F, 0x37, 0x2C, 0x68, 0x08, 0x25, 0xDA, 0x34, 0x6C,
+    0x13, 0xA4, 0x95, 0xB6, 0x24, 0x7D, 0xD6, 0xB3, 0xA4, 0xA1, 0x68, 0xE1, 0x76, 0xCD, 0xE7, 0xE6,
+    0xAB, 0x49, 0x8C, 0x35, 0x19, 0xB0, 0x0E, 0x31, 0x5A, 0x15, 0xE7, 0x50, 0x80, 0xF0, 0x90, 0x1A,
+    0xF8, 0x77, 0x6F, 0xFF, 0xCE, 0xBF, 0x7B, 0xFB, 0x77, 0xFE, 0x6D, 0x0D, 0x7C, 0xBE, 0xFB, 0xBC,
+    0x05, 0x40, 0x1A, 0x6B, 0xFD, 0x7E, 0x50, 0x16, 0xE1, 0xA1, 0x84, 0xB4, 0x45, 0xC6, 0x5A, 0x5E,
+    0x9E, 0x24, 0x56, 0x13, 0xA4, 0x2D, 0x85, 0x57, 0x3E, 0x30, 0xF2, 0x88, 0x29, 0xE8, 0x1A, 0xE1,
+    0xA1, 0x55, 0xEF, 0x4F, 0x19, 0xB7, 0xFD, 0x2C, 0x54, 0xE5, 0x7A, 0xD1, 0x7F, 0xE4, 0xC5, 0x39,
+    0xE8, 0x6F, 0xBC, 0x58, 0x13, 0x50, 0x76, 0x3F, 0x6B, 0xD2, 0x6E, 0x66, 0x73, 0x75, 0xC2, 0xB4,
+    0x07, 0xD3, 0x43, 0xA9, 0xE1, 0xD0, 0x66, 0x01, 0x7F, 0xB3, 0x0E, 0xF0, 0x13, 0x69, 0x91, 0x7F,
+    0xA0, 0xE1, 0x91, 0x53, 0x25, 0x1C, 0x73, 0x15, 0xC9, 0x15, 0x3B, 0x9E, 0xEC, 0x97, 0xF5, 0x53,
+    0x26, 0xA8, 0x1A, 0x8D, 0xFA, 0xF1, 0x9E, 0x80, 0x88, 0xB3, 0x9D, 0x5B, 0xA7, 0xFF, 0x69, 0xF9,
+    0xCC, 0xE9, 0xA3, 0x9B, 0x47, 0xFD, 0x71, 0x7F, 0x2C, 0xB4, 0xA3, 0x53, 0x07, 0x0F, 0x3C, 0xB5,
+    0xB1, 0x71, 0x32, 0x46, 0x0F, 0xEB, 0xB0, 0x04, 0xAA, 0x13, 0xEE, 0xD8, 0x53, 0xBF, 0x1F, 0xDF,
+    0x5D, 0xFB, 0x54, 0x79, 0x16, 0x9F, 0x97, 0x76, 0x73, 0x38, 0x53, 0x27, 0xCC, 0x87, 0xDB, 0xE9,
+    0x21, 0x69, 0xC3, 0xA1, 0x4D, 0x2D, 0xED, 0xDF, 0xAC, 0xCB, 0xAF, 0xF2, 0x13, 0xA2, 0x97, 0x7F,
+    0x20, 0xBF, 0x57, 0x3F, 0x72, 0x4A, 0x6B, 0x73, 0xCC, 0x15, 0x59, 0x72, 0xC5, 0x86, 0xE5, 0xFD,
+    0xF2, 0x65, 0xF3, 0xC4, 0xA7, 0xC9, 0xF3, 0xD4, 0xC6, 0xFF, 0x1B, 0xA3, 0x87, 0x64, 0x2E, 0xFF,
+    0xE4, 0x5D, 0x77, 0x74, 0x53, 0xFD, 0xB6, 0xB8, 0x56, 0x87, 0x51, 0x2B, 0xCE, 0xDF, 0x2D, 0xCB,
+    0x3A, 0x2C, 0xA1, 0x63, 0x7C, 0x2B, 0xC6, 0xC9, 0xBD, 0x52, 0xAE, 0x03, 0xBB, 0x67, 0x0E, 0x32,
+    0x76, 0xC7, 0x2A, 0x34, 0xB2, 0x4E, 0x6C, 0xE2, 0x12, 0x27, 0xAD, 0xB4, 0x32, 0x86, 0x8D, 0x6F,
+    0xB1, 0xAA, 0x67, 0x0F, 0x65, 0x68, 0xF6, 0xEF, 0x99, 0xEC, 0x6B, 0x29, 0x38, 0x6A, 0x8A, 0x5B,
+    0xED, 0x8B, 0x35, 0x68, 0x5B, 0x29, 0x7B, 0x1C, 0x0E, 0x72, 0x30, 0xF1, 0xC2, 0x6B, 0x93, 0xD6,
+    0x05, 0xA5, 0x08, 0x04, 0x55, 0x2B, 0x9B, 0x93, 0xD3, 0xD2, 0x4A, 0x2B, 0x6D, 0xC6, 0x80, 0x6D,
+    0x31, 0x95, 0x21, 0xF3, 0xFA, 0xF6, 0x07, 0x66, 0x65, 0x76, 0x54, 0xF4, 0x0A, 0x58, 0x76, 0xFA,
+    0x28, 0x6D, 0xA7, 0xB2, 0x49, 0x8C, 0xE7, 0x62, 0xBC, 0x1E, 0x27, 0xBF, 0x12, 0xE7, 0xFB, 0xC6,
+    0xF1, 0xE5, 0x0B, 0xD1, 0xBF, 0x1E, 0x27, 0x4F, 0xC5, 0xF9, 0xBE, 0x51, 0x7C, 0xF9, 0xD5, 0xE8,
+    0xFF, 0xEF, 0x38, 0x79, 0x72, 0x30, 0xDF, 0xC7, 0xDF, 0x79, 0xB9, 0xE6, 0xB5, 0xD7, 0x78, 0xF2,
+    0x49, 0xF6, 0xED, 0x23, 0xF9, 0x94, 0x03, 0xA0, 0x9A, 0x4E, 0x0F, 0xC8, 0xFA, 0x74, 0xE2, 0xF6,
+    0x7F, 0xEE, 0x5A, 0x0B, 0x79, 0x76, 0xED, 0x5F, 0x25, 0xB6, 0x90, 0xF5, 0xE9, 0x94, 0xA0, 0x39,
+    0x0F, 0x69, 0x58, 0xAE, 0x4E, 0x1F, 0xDA, 0x7C, 0xC4, 0x1F, 0xF2, 0x47, 0x37, 0x4F, 0x0F, 0xFD,
+    0x22, 0x00, 0x22, 0x70, 0x54, 0x7B, 0xB6, 0x4A, 0x27, 0x7C, 0xE2, 0xA4, 0x4D, 0xAC, 0x46, 0xDA,
+    0x65, 0x64, 0xBD, 0x8E, 0x32, 0xA1, 0x48, 0xA5, 0x9D, 0xEA, 0xF4, 0xD9, 0xE9, 0xBE, 0x25, 0xB5,
+    0x4E, 0x71, 0xF8, 0x34, 0xE1, 0xF8, 0x66, 0xE2, 0x3E, 0x6A, 0xD5, 0x4B, 0x71, 0xA6, 0x11, 0xFE,
+    0x28, 0xC2, 0x9D, 0x46, 0xD4, 0x00, 0x64, 0x24, 0x56, 0x7B, 0xB6, 0xE4, 0x7F, 0x66, 0x89, 0xC4,
+    0x49, 0xCB, 0x51, 0x02, 0xD2, 0x2E, 0xC3, 0x71, 0xF5, 0x92, 0x51, 0xE6, 0xA7, 0xD1, 0x6C, 0x1E,
+    0x3D, 0x56, 0x69, 0x65, 0x12, 0xFB, 0x9A, 0xA7, 0xA0, 0x20, 0x35, 0xA9, 0x49, 0xBC, 0xF0, 0x6C,
+    0x51, 0xB0, 0x8C, 0x46, 0x93, 0x38, 0x19, 0xC3, 0x3A, 0x4F, 0x6D, 0xC0, 0x2A, 0x30, 0xF6, 0x2C,
+    0x3D, 0xA4, 0x91, 0x96, 0x4D, 0x36, 0xD1, 0x1C, 0xE6, 0xAF, 0xD7, 0xB2, 0xDE, 0x33, 0x21, 0x90,
+    0xB8, 0x65, 0x38, 0xAC, 0x5E, 0x0A, 0x89, 0x0B, 0x67, 0x2F, 0x4D, 0x0A, 0xFD, 0xE6, 0x77, 0xD2,
+    0x13, 0x7F, 0x80, 0xF0, 0x3F, 0xB3, 0x14, 0x47, 0x8F, 0xA3, 0xD5, 0xEF, 0x9D, 0x4F, 0x5C, 0x8C,
+    0xAC, 0x93, 0xA2, 0x21, 0x48, 0xCB, 0x43, 0x20, 0xCE, 0x33, 0x44, 0x7A, 0x9E, 0x04, 0x38, 0x80,
+    0x32, 0x04, 0x72, 0xB4, 0x55, 0x5E, 0xB4, 0x94, 0x28, 0x4B, 0x83, 0xB2, 0x9C, 0xDD, 0x73, 0x25,
+    0x4E, 0xF7, 0xDC, 0x04, 0x16, 0x04, 0x64, 0xDE, 0xB1, 0x7F, 0x1C, 0x50, 0xC2, 0x77, 0x0A, 0x29,
+    0x3D, 0x88, 0x29, 0x10, 0x81, 0xEF, 0x5A, 0x28, 0x02, 0xE4, 0x25, 0xE8, 0xD4, 0x90, 0xBE, 0xEC,
+    0x51, 0x76, 0x1D, 0xE9, 0x33, 0xC4, 0xAD, 0xD7, 0x2D, 0x31, 0x06, 0xCE, 0xAC, 0x55, 0x94, 0x68,
+    0x33, 0x40, 0x3A, 0x6D, 0x68, 0x52, 0x4B, 0x2E, 0x1D, 0xCA, 0x82, 0x30, 0x30, 0xB4, 0x24, 0xE7,
+    0x6A, 0xF6, 0xEF, 0x83, 0xC3, 0x5B, 0x30, 0x30, 0xBB, 0x8F, 0xC9, 0x2C, 0x44, 0x48, 0xB7, 0xA1,
+    0x08, 0x24, 0xD7, 0x1D, 0x3A, 0x35, 0x34, 0x39, 0xCA, 0xAE, 0xB3, 0x22, 0x82, 0xB8, 0xF5, 0xBA,
+    0xD5, 0x31, 0x72, 0x66, 0xAD, 0x92, 0x8E, 0x76, 0x80, 0x74, 0x2D, 0xE9, 0xD7, 0x2D, 0x79, 0x09,
+    0x15, 0x88, 0x18, 0x67, 0x20, 0x63, 0x9C, 0x41, 0xFA, 0xC7, 0x06, 0xD0, 0x1A, 0x60, 0x25, 0x03,
+    0xA8, 0x72, 0x80, 0xB6, 0x04, 0x12, 0x5F, 0xAE, 0x19, 0x94, 0x1D, 0x45, 0x87, 0x36, 0x67, 0x37,
+    0x6A, 0x06, 0x1B, 0x13, 0x60, 0x14, 0x5B, 0xE0, 0xE6, 0xAF, 0x07, 0x48, 0x82, 0x08, 0x20, 0x5D,
+    0x12, 0x40, 0xD7, 0x89, 0x87, 0x0C, 0x19, 0x23, 0x25, 0x32, 0x46, 0x18, 0xDE, 0x82, 0x51, 0xF4,
+    0x34, 0x6A, 0x42, 0xCB, 0x36, 0x81, 0x15, 0x11, 0x18, 0x24, 0x9E, 0x4C, 0x3A, 0xB2, 0x41, 0xB4,
+    0x83, 0x61, 0xB4, 0xB9, 0xB2, 0xAC, 0xA4, 0x35, 0x95, 0x36, 0x4C, 0x35, 0x49, 0xAB, 0x49, 0x7D,
+    0xC6, 0xA8, 0x1E, 0xC4, 0x19, 0xC3, 0x78, 0x1E, 0x38, 0xB0, 0x00, 0xA3, 0x73, 0x86, 0x5F, 0x8D,
+    0x96, 0x43, 0xAA, 0x53, 0x30, 0x11, 0x3D, 0x32, 0x46, 0x23, 0x5B, 0x19, 0x64, 0x60, 0x25, 0x09,
+    0xA4, 0xB6, 0x85, 0x50, 0x41, 0x91, 0x83, 0xD6, 0x06, 0x79, 0xD5, 0x21, 0x42, 0x80, 0xED, 0x02,
+    0x56, 0xB4, 0x21, 0x3B, 0xE1, 0xD1, 0x76, 0x9B, 0xD4, 0x6A, 0x9B, 0x3A, 0x11, 0xC7, 0x8E, 0x34,
+    0xD6, 0x3B, 0x4E, 0xEE, 0x34, 0xC7, 0xCF, 0x30, 0xC9, 0x4E, 0x78, 0xF5, 0x4E, 0x2D, 0xE6, 0x30,
+    0x43, 0xDE, 0x30, 0xFA, 0x15, 0xB7, 0x22, 0xDA, 0x86, 0xEA, 0x00, 0x07, 0x80, 0x04, 0x11, 0x7F,
+    0xE4, 0x65, 0x8C, 0xA1, 0x7F, 0xF0, 0x3C, 0x09, 0x44, 0xDB, 0xD2, 0x84, 0x8A, 0xAA, 0xC8, 0xA9,
+    0xB4, 0x36, 0xA5, 0xBC, 0xEA, 0x4A, 0x11, 0x42, 0xCE, 0x76, 0x91, 0xB1, 0xA2, 0x4F, 0x92, 0x9D,
+    0xB8, 0x61, 0xB4, 0x1D, 0x9B, 0xEE, 0xC1, 0x2A, 0x8E, 0x9D, 0x7A, 0x3B, 0xD6, 0x9C, 0xE7, 0xEE,
+    0x3F, 0x5D, 0x93, 0x04, 0x58, 0x87, 0xFD, 0x00, 0x34, 0xA4, 0xAF, 0x58, 0x11, 0x0A, 0x4A, 0xE9,
+    0xD2, 0x3A, 0x17, 0x41, 0x84, 0x12, 0x9D, 0xD6, 0x7C, 0x14, 0x48, 0x2F, 0xC2, 0xA8, 0x46, 0x06,
+    0x28, 0x3B, 0x2F, 0x52, 0x81, 0xAA, 0xA1, 0x01, 0x6D, 0x20, 0x74, 0xEE, 0x65, 0x1D, 0x72, 0xD0,
+    0xB7, 0x8C, 0x8C, 0x33, 0x11, 0x32, 0xDB, 0xD0, 0x96, 0xAC, 0x68, 0xF4, 0x39, 0x2B, 0xDF, 0x08,
+    0x49, 0x68, 0x92, 0x76, 0x18, 0x27, 0x3A, 0x7A, 0x69, 0x11, 0x01, 0x9A, 0xCE, 0x31, 0xDD, 0x09,
+    0xB1, 0x0C, 0x6E, 0x38, 0x94, 0xCD, 0xA1, 0x15, 0x01, 0xCD, 0x0A, 0x22, 0xA4, 0x96, 0x5C, 0x06,
+    0xA4, 0x9B, 0x74, 0x53, 0xAD, 0xAE, 0x3A, 0x68, 0x06, 0x90, 0x9A, 0x19, 0xB4, 0x49, 0x40, 0xA3,
+    0xAD, 0x08, 0x54, 0xE4, 0x28, 0x2B, 0x1D, 0x13, 0x8A, 0xAF, 0x8D, 0x91, 0x57, 0x63, 0x4D, 0x45,
+    0xE7, 0xFF, 0x68, 0xFB, 0x80, 0x3D, 0x74, 0x20, 0x5B, 0x80, 0x05, 0x4C, 0xE6, 0x9D, 0x1E, 0x05,
+    0xD9, 0xD9, 0xD5, 0x9E, 0x7A, 0x35, 0x9B, 0xAD, 0x67, 0xDF, 0x9C, 0x69, 0x33, 0x4C, 0x6D, 0x7A,
+    0xD5, 0x25, 0xEF, 0x06, 0x9A, 0x86, 0x32, 0x27, 0xD3, 0x46, 0x5F, 0xF1, 0xCA, 0x6F, 0xAB, 0x56,
+    0xDF, 0xF8, 0x6D, 0x11, 0x9F, 0xEB, 0x74, 0xC2, 0x20, 0xA7, 0x24, 0x57, 0x6B, 0x5E, 0x7B, 0x8D,
+    0xA5, 0x2D, 0x44, 0x17, 0x25, 0x7F, 0x73, 0x51, 0xC4, 0xB7, 0x5E, 0xBA, 0xF9, 0xA2, 0x6B, 0x65,
+    0xD8, 0x66, 0xBB, 0x24, 0xCF, 0x48, 0xBF, 0x5E, 0xCB, 0x37, 0xBD, 0x08, 0x2D, 0xD3, 0x9C, 0xB3,
+    0xA9, 0x1D, 0x99, 0xF9, 0x9F, 0xD9, 0xAC, 0x0D, 0x5D, 0x7C, 0x11, 0xFB, 0x6A, 0x15, 0x57, 0xA2,
+    0x3B, 0xFB, 0xE5, 0xF9, 0x17, 0xAF, 0xBA, 0xCC, 0x67, 0x39, 0x43, 0xAA, 0x96, 0x56, 0xBD, 0x65,
+    0xE5, 0x07, 0xB3, 0x9C, 0x2C, 0xD6, 0x0D, 0x13, 0xA4, 0x53, 0x1E, 0x5D, 0x0F, 0x2D, 0x83, 0x24,
+    0x9A, 0x03, 0xC3, 0x8B, 0xF1, 0x03, 0x37, 0x7A, 0x25, 0x9B, 0xDF, 0x99, 0x42, 0x69, 0xCE, 0x8B,
+    0x5B, 0x2D, 0xDA, 0x93, 0xB5, 0x64, 0xCF, 0x21, 0x12, 0x07, 0xEB, 0xFC, 0xE1, 0x73, 0x22, 0x7E,
+    0x7C, 0x79, 0x92, 0x86, 0x96, 0x69, 0xC5, 0x20, 0x27, 0x7D, 0xD5, 0xC8, 0x6B, 0x8E, 0xD0, 0xD2,
+    0x0C, 0xA8, 0xE4, 0xAD, 0x19, 0xC3, 0x49, 0x77, 0x87, 0x83, 0x82, 0xC1, 0x9B, 0x76, 0x69, 0xEC,
+    0xF6, 0x25, 0xDD, 0xAC, 0x9C, 0x27, 0x8B, 0x66, 0xF0, 0xCD, 0x90, 0x99, 0x15, 0x5D, 0xAB, 0xAB,
+    0x56, 0x7C, 0x18, 0xA8, 0x1A, 0xF2, 0x12, 0xFD, 0xAA, 0x91, 0x57, 0x7C, 0xE2, 0x2B, 0x11, 0xD2,
+    0x0F, 0x5A, 0xC6, 0x9D, 0x77, 0x7A, 0x08, 0x52, 0x4B, 0x12, 0xE0, 0x00, 0xC0, 0xBE, 0x8D, 0x8D,
+    0xDF, 0x8B, 0xB1, 0xBF, 0x39, 0xAA, 0xD3, 0xA1, 0xF5, 0xEE, 0xE8, 0xB7, 0x0E, 0x31, 0x8A, 0xF5,
+    0xE0, 0x9B, 0xAD, 0xB2, 0xC3, 0xBA, 0x4D, 0xB7, 0xB5, 0xF8, 0xD3, 0xCB, 0xBE, 0xAA, 0x96, 0xB5,
+    0x3A, 0x77, 0xCD, 0x6E, 0x95, 0x5B, 0x3A, 0x99, 0x27, 0x3E, 0xB3, 0x15, 0xF3, 0xB1, 0x59, 0x89,
+    0x75, 0x62, 0x76, 0x5F, 0x33, 0x40, 0x6A, 0xBB, 0x05, 0x3D, 0xDE, 0x0D, 0xAD, 0xB2, 0x48, 0x43,
+    0x49, 0x43, 0x45, 0x45, 0x4B, 0x91, 0x04, 0x0A, 0x69, 0x29, 0xD2, 0x9A, 0x52, 0xC3, 0x72, 0x0E,
+    0x87, 0x0B, 0x58, 0xDA, 0x82, 0xFD, 0x01, 0xB4, 0x03, 0x6D, 0x3B, 0xED, 0x1D, 0x00, 0x05, 0x30,
+    0x81, 0x51, 0x80, 0x51, 0xDD, 0xEB, 0x4A, 0x03, 0xD2, 0x75, 0xB9, 0x5E, 0x01, 0xC2, 0xFF, 0x26,
+    0xE9, 0xC9, 0x29, 0x2B, 0xEF, 0x4D, 0x99, 0x11, 0x94, 0x97, 0x36, 0x43, 0xD3, 0x50, 0x48, 0x27,
+    0x82, 0x26, 0xB5, 0x15, 0x65, 0x12, 0x44, 0xD0, 0x3E, 0x33, 0xE5, 0xED, 0x09, 0x1F, 0x46, 0xA3,
+    0x2C, 0xE4, 0x9D, 0xF6, 0x49, 0xDB, 0xDD, 0x69, 0x7D, 0xF7, 0x25, 0xDE, 0x08, 0xC8, 0xCB, 0x7E,
+    0x77, 0xED, 0x1E, 0xF4, 0x1B, 0x30, 0x9A, 0xC1, 0x78, 0xBA, 0x6B, 0xEC, 0x64, 0x16, 0x86, 0xB6,
+    0x8B, 0x18, 0x3F, 0xB3, 0x24, 0xD7, 0x1D, 0xF2, 0x8A, 0x23, 0x7D, 0xD9, 0x93, 0x09, 0xCF, 0x8A,
+    0x08, 0x9C, 0xDD, 0x08, 0xC4, 0x18, 0xC4, 0x47, 0x6B, 0x41, 0x3A, 0xDA, 0xD4, 0xD2, 0x6A, 0x43,
+    0x33, 0x80, 0xA6, 0x84, 0x8A, 0xD1, 0x8C, 0x2C, 0xFE, 0x72, 0x5A, 0xCE, 0x81, 0x45, 0x38, 0x7D,
+    0x18, 0x86, 0x53, 0x48, 0xFD, 0x03, 0x15, 0xEB, 0xC8, 0x22, 0x8F, 0xA8, 0x5A, 0x46, 0xCB, 0xA0,
+    0xFE, 0xA5, 0x4C, 0x19, 0x5D, 0xC3, 0x08, 0xE4, 0x14, 0xF2, 0x00, 0x3F, 0xB3, 0xA4, 0xAF, 0x1A,
+    0x8A, 0x65, 0x12, 0xDF, 0x90, 0x09, 0xCF, 0x44, 0x59, 0xF5, 0xFE, 0x05, 0x86, 0x71, 0x2A, 0x3E,
+    0x5A, 0x0B, 0xDA, 0x48, 0xB7, 0x8D, 0x3E, 0xE1, 0xC8, 0x07, 0xD0, 0xB4, 0x88, 0xD0, 0xB9, 0x51,
+    0xBF, 0xAB, 0x2E, 0x5C, 0x02, 0x56, 0x79, 0x4C, 0x98, 0xD1, 0x47, 0xFE, 0xEC, 0x97, 0xDA, 0x92,
+    0xE9, 0x80, 0x81, 0x36, 0xE9, 0x2B, 0x36, 0xF9, 0x91, 0xA7, 0x6D, 0xA8, 0x4A, 0x86, 0x69, 0x9D,
+    0xBD, 0x1C, 0x32, 0x37, 0xBC, 0xB8, 0xA9, 0x66, 0x05, 0x1C, 0x85, 0xA3, 0x70, 0x18, 0x94, 0x81,
+    0x29, 0x2C, 0xEE, 0xD8, 0x8D, 0x85, 0xA2, 0xD3, 0xA1, 0xA3, 0xDD, 0xC8, 0x60, 0x4E, 0x1A, 0xE7,
+    0xCC, 0x39, 0x92, 0x5A, 0x38, 0xD3, 0x47, 0x6B, 0x60, 0xBB, 0x57, 0x5A, 0xD3, 0x49, 0x11, 0xFA,
+    0xC3, 0xBA, 0x53, 0x92, 0x21, 0x30, 0xBA, 0xE1, 0x19, 0xC5, 0x3B, 0xC6, 0xE4, 0xC9, 0x11, 0xBE,
+    0x8B, 0x02, 0xE2, 0xDB, 0x8C, 0x66, 0xEA, 0xC7, 0x2F, 0x94, 0x48, 0x8F, 0x86, 0x8A, 0xC4, 0xA3,
+    0x0D, 0x25, 0x34, 0x88, 0x80, 0xBC, 0xD5, 0x24, 0xD1, 0xED, 0xEA, 0xEC, 0x45, 0x48, 0xA7, 0xD0,
+    0x6C, 0xA1, 0xCC, 0xE6, 0x03, 0x96, 0x6B, 0x88, 0x9C, 0x51, 0x16, 0x49, 0x7D, 0xEC, 0xB3, 0xC9,
+    0xB5, 0x48, 0x97, 0x79, 0x04, 0x10, 0xEC, 0x14, 0x3E, 0x49, 0x8C, 0xF5, 0xB0, 0xDE, 0x9B, 0x04,
+    0xC8, 0x0C, 0x4C, 0xBA, 0x29, 0x1D, 0xF4, 0xA6, 0x79, 0xC7, 0xC8, 0x69, 0x3B, 0x89, 0x53, 0xDB,
+    0x19, 0x57, 0x76, 0x7B, 0x42, 0xD6, 0xDF, 0x58, 0xC0, 0x0A, 0xB4, 0x7D, 0x4D, 0xF8, 0x15, 0x93,
+    0xC5, 0x67, 0x6E, 0x7E, 0x5E, 0x1B, 0x26, 0x48, 0x4B, 0x06, 0x0D, 0xD2, 0xA1, 0x0D, 0x39, 0x54,
+    0x30, 0xFF, 0xC3, 0x3B, 0x65, 0x13, 0xE9, 0x33, 0x1E, 0x9D, 0x43, 0xE6, 0x3B, 0x7F, 0xF0, 0x40,
+    0x27, 0x2A, 0x1C, 0x65, 0x3D, 0x30, 0xB4, 0x64, 0x06, 0xE0, 0xB1, 0xF3, 0x22, 0xB6, 0xEA, 0xC7,
+    0x2F, 0x68, 0xC3, 0xCA, 0x4E, 0x79, 0xDB, 0x40, 0x0B, 0x2D, 0x34, 0x50, 0xC1, 0xF0, 0xF5, 0x3A,
+    0xBD, 0xF3, 0x7D, 0x9D, 0x38, 0x96, 0x0A, 0x18, 0xD8, 0x9D, 0x70, 0xAC, 0xE7, 0x35, 0xA3, 0xE8,
+    0x13, 0x9F, 0x79, 0x6D, 0x52, 0x5B, 0xA0, 0x5F, 0x0A, 0x0C, 0xD2, 0x9A, 0xAA, 0x44, 0x84, 0x96,
+    0xF4, 0xAA, 0x25, 0xCF, 0x60, 0xD2, 0xA0, 0xAE, 0x3A, 0x86, 0x9A, 0xA4, 0x2D, 0x18, 0xBC, 0x14,
+    0xD4, 0x24, 0x8D, 0xD1, 0x74, 0x69, 0x94, 0x08, 0x01, 0xD2, 0xAF, 0x1B, 0x28, 0x8F, 0x03, 0x3F,
+    0xB5, 0x9D, 0xFE, 0xFE, 0x66, 0x06, 0xD9, 0xAC, 0x21, 0xB9, 0xF9, 0xA2, 0x43, 0x9B, 0x21, 0x4C,
+    0xD8, 0x46, 0xBA, 0xC4, 0x93, 0x91, 0x1A, 0x1A, 0x4A, 0x12, 0x2F, 0x02, 0xDA, 0x68, 0x4B, 0xCE,
+    0x59, 0xD8, 0x56, 0x2D, 0xCC, 0xFF, 0xCC, 0xB2, 0x6B, 0xAE, 0x0F, 0x30, 0xDB, 0x13, 0x5D, 0x99,
+    0x2E, 0xE3, 0x14, 0x15, 0xA7, 0x20, 0x2D, 0x4F, 0x29, 0x9B, 0xC4, 0xB7, 0xEB, 0xD4, 0x8F, 0x4D,
+    0x66, 0x86, 0xAC, 0x30, 0xA0, 0x20, 0xA7, 0x62, 0x79, 0xD7, 0x41, 0xB7, 0x4C, 0x69, 0xC4, 0x84,
+    0x6D, 0xD5, 0x32, 0xBC, 0xB8, 0xC9, 0xAE, 0x97, 0x1B, 0x44, 0xD2, 0x68, 0x01, 0x19, 0xE7, 0x22,
+    0xC6, 0xBA, 0x4B, 0x71, 0x34, 0x28, 0x4B, 0xE2, 0xE1, 0xE6, 0x1A, 0xC3, 0xE8, 0xF5, 0xC6, 0xB7,
+    0xFA, 0xE3, 0x16, 0x8A, 0xDD, 0xF3, 0x31, 0x9A, 0x18, 0x2D, 0xC4, 0x89, 0x8C, 0x0E, 0xD8, 0x73,
+    0x5E, 0xC4, 0x90, 0xBD, 0xE2, 0x5B, 0xF5, 0xF5, 0x3A, 0x2F, 0x92, 0x0F, 0x6F, 0xC5, 0x2F, 0x46,
+    0xBF, 0x02, 0x2D, 0x89, 0x47, 0xD9, 0x05, 0xFD, 0x7E, 0xE8, 0x13, 0xCA, 0x83, 0xC2, 0xA4, 0xC2,
+    0x11, 0x3D, 0x8F, 0x3B, 0x80, 0x61, 0xF4, 0x59, 0x9C, 0xA4, 0x35, 0xD2, 0x41, 0x80, 0xAA, 0xCB,
+    0xCC, 0x7E, 0x77, 0x55, 0xC6, 0x39, 0xB7, 0x36, 0x4C, 0x7F, 0x6C, 0x90, 0x76, 0xE7, 0xFC, 0x20,
+    0xB6, 0x3A, 0x4E, 0xC1, 0xEC, 0xC5, 0x1F, 0x65, 0xDC, 0x92, 0xD5, 0x00, 0x8F, 0x19, 0x11, 0x83,
+    0x7A, 0x77, 0xA2, 0xCD, 0x7A, 0x4E, 0x53, 0x24, 0xE1, 0xEC, 0xD8, 0x8D, 0xE7, 0x4C, 0xEE, 0xA8,
+    0x93, 0x19, 0xBE, 0x6E, 0x77, 0xF2, 0xDA, 0x55, 0x28, 0x20, 0xDB, 0x31, 0xBD, 0xBF, 0x80, 0x18,
+    0x02, 0x06, 0xD0, 0xF4, 0xD6, 0xF6, 0x5B, 0x64, 0x51, 0x4C, 0xCE, 0x6A, 0xB3, 0xDE, 0x24, 0xD7,
+    0xED, 0x20, 0xBB, 0xD0, 0x8E, 0xE7, 0xD2, 0xEF, 0x5A, 0x9B, 0x99, 0x5F, 0x60, 0x3C, 0x01, 0x88,
+    0xB1, 0x1E, 0x45, 0xBF, 0x7B, 0xD3, 0x3E, 0xCB, 0x5C, 0x59, 0x33, 0x3A, 0x4E, 0xE4, 0xFB, 0xDF,
+    0xBE, 0x93, 0x75, 0x6A, 0x76, 0xCE, 0x8F, 0xA3, 0x1B, 0xC6, 0x00, 0x1E, 0x3C, 0x6C, 0xC2, 0x51,
+    0x50, 0x01, 0x0E, 0xC2, 0x63, 0x46, 0x45, 0x7B, 0x36, 0x3B, 0xE7, 0x96, 0x72, 0x9A, 0x90, 0x7E,
+    0xEF, 0x83, 0xD9, 0x20, 0xD6, 0x13, 0xA4, 0x23, 0xAD, 0xC9, 0x38, 0x30, 0x7C, 0xDD, 0x0E, 0xE6,
+    0x24, 0x8E, 0xC3, 0x10, 0x90, 0x16, 0xED, 0x7B, 0x9F, 0x2D, 0xDC, 0x3A, 0xFA, 0xAB, 0x30, 0xAC,
+    0xE9, 0x12, 0x29, 0x62, 0xAC, 0xB3, 0x38, 0x49, 0xFC, 0xDD, 0x29, 0x74, 0x5A, 0xC3, 0xCD, 0x35,
+    0x74, 0x9C, 0x70, 0x6B, 0xC3, 0x64, 0x1D, 0x60, 0xD4, 0x9F, 0x2E, 0x3A, 0x1F, 0x35, 0x8E, 0x4E,
+    0xC7, 0x2E, 0x8A, 0x87, 0x65, 0x8A, 0x96, 0x81, 0x43, 0x9B, 0xCF, 0xBE, 0x32, 0xD0, 0x79, 0xB4,
+    0xA1, 0x83, 0x10, 0x90, 0xF5, 0x31, 0x00, 0x92, 0xD8, 0x32, 0x88, 0x33, 0xE6, 0x7C, 0x3E, 0x69,
+    0x41, 0xF5, 0xAE, 0x26, 0xEB, 0x70, 0x2D, 0x4A, 0x1E, 0x7D, 0xBE, 0x64, 0xD8, 0x16, 0x3C, 0xD5,
+    0x16, 0x10, 0x4A, 0x44, 0x58, 0x21, 0xF1, 0x03, 0xA4, 0xD3, 0x56, 0x5A, 0x35, 0x8F, 0x96, 0xF1,
+    0x7C, 0xD7, 0x97, 0x90, 0xD5, 0xC8, 0x29, 0x22, 0x04, 0x8E, 0x2B, 0xD3, 0xC7, 0x62, 0x15, 0xBF,
+    0x9C, 0xDC, 0x7C, 0xD1, 0x95, 0x4C, 0x53, 0x9B, 0xDA, 0x96, 0x26, 0x43, 0xBF, 0xEC, 0x69, 0x73,
+    0x32, 0xE9, 0x64, 0xC8, 0x39, 0x9B, 0x84, 0xCC, 0xE9, 0x1B, 0x15, 0xA3, 0x6B, 0x77, 0xE6, 0x25,
+    0x2C, 0xB2, 0xC2, 0x28, 0xDA, 0xCE, 0xAF, 0xD7, 0x0B, 0xE0, 0x8F, 0x43, 0x0C, 0xF4, 0x41, 0xFE,
+    0x81, 0x8A, 0xBE, 0x20, 0x8C, 0x70, 0xA7, 0xD1, 0x71, 0xF7, 0xEE, 0xBF, 0xB9, 0xC8, 0xE8, 0x23,
+    0x3F, 0xF8, 0xE6, 0x4C, 0x3A, 0x6D, 0xB7, 0xD9, 0xD6, 0x26, 0x7D, 0x29, 0x30, 0xC9, 0xD1, 0xCF,
+    0x7A, 0x11, 0x4A, 0x86, 0x89, 0x57, 0x7E, 0x20, 0x66, 0xCC, 0x3F, 0xB6, 0x6A, 0xD6, 0x2F, 0x56,
+    0x03, 0x9A, 0x55, 0xE9, 0x55, 0x9C, 0x32, 0x98, 0xF5, 0x41, 0x03, 0x5D, 0x77, 0xEE, 0xBC, 0x0F,
+    0x47, 0x0F, 0x74, 0xCA, 0x0F, 0xDC, 0x29, 0xC0, 0x78, 0x90, 0x72, 0x3F, 0x60, 0x39, 0x17, 0xE9,
+    0x42, 0xEC, 0x72, 0x9F, 0xB1, 0x1F, 0xE9, 0x9F, 0x21, 0x2C, 0x1C, 0x07, 0xDD, 0xA1, 0x97, 0x0F,
+    0x4E, 0x5D, 0x76, 0xB4, 0x5D, 0x4F, 0x40, 0x3F, 0x07, 0x29, 0xDD, 0xED, 0x35, 0x04, 0x65, 0xA9,
+    0x12, 0x4F, 0x4E, 0x8B, 0x36, 0x05, 0xD2, 0x66, 0x10, 0xD2, 0x9A, 0x2A, 0x79, 0x6F, 0xED, 0xAB,
+    0xC4, 0x18, 0xCD, 0xCA, 0xC6, 0xEB, 0x36, 0x43, 0x84, 0xB4, 0xA6, 0x91, 0x8E, 0x65, 0xC2, 0xEE,
+    0x95, 0xBB, 0x83, 0xE5, 0x6E, 0x25, 0x12, 0x6B, 0xCA, 0x62, 0xF7, 0x09, 0xDC, 0x99, 0xD1, 0x6E,
+    0x5D, 0x74, 0x57, 0x3A, 0x2C, 0x8F, 0x5A, 0xF9, 0x93, 0x2F, 0xD9, 0xA1, 0x29, 0x94, 0x97, 0x76,
+    0x9B, 0x2A, 0xAD, 0xD3, 0xBA, 0xA5, 0xD5, 0x68, 0x11, 0x08, 0x39, 0x99, 0x74, 0x89, 0x2F, 0x28,
+    0xA5, 0x95, 0x96, 0x80, 0x66, 0x09, 0x11, 0x12, 0x4F, 0x2E, 0x63, 0x8C, 0xF3, 0x51, 0x8C, 0xD1,
+    0x55, 0x28, 0x9B, 0xD6, 0x54, 0xDC, 0x5C, 0x3B, 0x59, 0xEB, 0x18, 0x5B, 0x6E, 0x6D, 0x5C, 0x20,
+    0xEB, 0xAF, 0xA3, 0x44, 0x7A, 0x69, 0x29, 0x29, 0x90, 0x56, 0x59, 0x2A, 0x1A, 0xD2, 0x5A, 0x1B,
+    0xDA, 0x9D, 0x59, 0x52, 0xB1, 0x25, 0x46, 0x43, 0x80, 0xA5, 0x45, 0x93, 0x5C, 0x8B, 0x94, 0x1F,
+    0x4D, 0xE5, 0x44, 0xD9, 0xB3, 0x14, 0xCA, 0x2A, 0xDB, 0xD0, 0x68, 0xA3, 0x4D, 0x20, 0x64, 0xE8,
+    0xC4, 0x8B, 0x50, 0x92, 0x4B, 0x2B, 0x5D, 0x41, 0x01, 0x0B, 0x82, 0xCC, 0x3B, 0x3D, 0x0E, 0x3D,
+    0x10, 0x35, 0x98, 0xA1, 0xE6, 0x3B, 0xFE, 0xFE, 0x1E, 0x1F, 0xBF, 0xF4, 0x89, 0xE3, 0x5D, 0x77,
+    0xBC, 0xE7, 0x26, 0x2A, 0x5A, 0x04, 0x07, 0xE6, 0xFB, 0xCB, 0x78, 0x55, 0x78, 0x60, 0x91, 0xC4,
+    0x53, 0x22, 0x2D, 0x15, 0xAA, 0xA6, 0x41, 0x1B, 0x02, 0xD9, 0xEE, 0x68, 0xD1, 0x95, 0x32, 0xA3,
+    0x29, 0xC0, 0xB8, 0x65, 0xE4, 0xD1, 0x90, 0x41, 0x7E, 0x17, 0x7E, 0xBF, 0xBE, 0x93, 0xE3, 0x04,
+    0x44, 0x20, 0xF1, 0x48, 0x87, 0xB4, 0x3C, 0xFE, 0x63, 0x46, 0x53, 0x74, 0x7C, 0x25, 0x3A, 0x10,
+    0x26, 0xF1, 0xB4, 0x14, 0x64, 0xA8, 0x7A, 0xF7, 0x63, 0x5A, 0x4B, 0x47, 0xA0, 0xE8, 0x2A, 0x94,
+    0xD3, 0x87, 0x19, 0x4E, 0xFB, 0xF2, 0xE4, 0x97, 0x7A, 0xD6, 0x5E, 0x8C, 0x3F, 0xAE, 0x63, 0xE7,
+    0x45, 0xFE, 0x3C, 0xAF, 0x36, 0x6E, 0x45, 0xEC, 0x30, 0x6B, 0x72, 0x68, 0xFB, 0x5C, 0x72, 0xBD,
+    0xCF, 0x6F, 0x0B, 0x44, 0x20, 0xAD, 0x29, 0x21, 0xF0, 0xF8, 0x8F, 0x45, 0x0C, 0x1C, 0x45, 0x5A,
+    0x0E, 0xC3, 0x16, 0x62, 0x0A, 0xAB, 0xB0, 0x40, 0xCE, 0x0A, 0x0B, 0xC0, 0x41, 0x1A, 0x5A, 0x82,
+    0x08, 0xC2, 0x27, 0x5E, 0x3A, 0x69, 0x95, 0x4D, 0x6B, 0x6D, 0x34, 0x9A, 0xFD, 0x1C, 0x67, 0x93,
+    0xC0, 0x98, 0x47, 0x01, 0xD3, 0xDD, 0xBB, 0x37, 0x73, 0xA7, 0xE6, 0xF7, 0xA4, 0xB0, 0x50, 0x21,
+    0xFC, 0xEE, 0x63, 0xEF, 0x92, 0xEC, 0xC5, 0xF3, 0x2A, 0x5A, 0x58, 0xCD, 0xA5, 0x2B, 0x94, 0x5D,
+    0x4F, 0xEB, 0x56, 0x8B, 0x90, 0x4B, 0x57, 0x48, 0xCB, 0xB8, 0xD5, 0x64, 0x13, 0x65, 0x09, 0x89,
+    0xA7, 0xA2, 0x25, 0xA7, 0x40, 0x1B, 0x8D, 0xB4, 0xCA, 0x8A, 0x90, 0x78, 0xD6, 0x77, 0x07, 0xB3,
+    0x3B, 0x83, 0x0D, 0x2D, 0x25, 0x05, 0x9A, 0x8C, 0xC7, 0x7F, 0x9C, 0xD6, 0x59, 0x94, 0xAE, 0xC7,
+    0x6B, 0xB6, 0xE1, 0xD1, 0x8B, 0xA0, 0xE7, 0x20, 0xBE, 0x0D, 0x1C, 0x10, 0x26, 0xAD, 0x2B, 0x26,
+    0xCA, 0x8A, 0x0E, 0x5C, 0x58, 0x64, 0x35, 0xF1, 0x9A, 0x52, 0x04, 0x69, 0x73, 0x2A, 0xE9, 0x54,
+    0x5D, 0xD0, 0x28, 0xAB, 0xCD, 0x3A, 0x21, 0x35, 0x19, 0xED, 0x5D, 0xA7, 0x8B, 0xC4, 0xED, 0x16,
+    0x51, 0x15, 0x68, 0xC3, 0x20, 0x90, 0x4C, 0xEE, 0x82, 0x14, 0xEE, 0x35, 0xE4, 0xE2, 0x93, 0x86,
+    0xDC, 0x87, 0xE7, 0xBC, 0x4B, 0xC8, 0x8B, 0x4F, 0xB3, 0xF3, 0x70, 0xF7, 0xE9, 0xD4, 0xF2, 0x6B,
+    0x2D, 0x7A, 0x0E, 0x1B, 0x77, 0x6A, 0x1A, 0x86, 0x8E, 0xB2, 0xE0, 0x49, 0x69, 0x7A, 0xB7, 0x78,
+    0x9F, 0xE1, 0x98, 0x4F, 0x33, 0x9C, 0x7B, 0x8E, 0x95, 0x65, 0xE8, 0xD0, 0x0E, 0x08, 0x34, 0xC2,
+    0x27, 0x21, 0xF1, 0xA9, 0x95, 0x6E, 0x80, 0xB4, 0xDB, 0xA8, 0x2B, 0x81, 0xF4, 0xEB, 0x16, 0xFD,
+    0x62, 0x37, 0x75, 0xFA, 0x06, 0x64, 0x5F, 0xAC, 0xC9, 0x95, 0xA5, 0x94, 0xAE, 0xC3, 0x15, 0x68,
+    0xA9, 0x68, 0xFA, 0x54, 0x76, 0x65, 0x07, 0x80, 0xE8, 0x38, 0x2B, 0x07, 0xB2, 0xEE, 0xA3, 0x55,
+    0xEF, 0x5C, 0xDB, 0xDD, 0xD7, 0x5B, 0xE2, 0xF9, 0xC4, 0x67, 0xA6, 0x54, 0x4E, 0x5E, 0x6E, 0xA9,
+    0xCE, 0x90, 0xFE, 0x4B, 0xC3, 0x77, 0x3D, 0x3A, 0xC2, 0xA4, 0x25, 0x53, 0x36, 0xF1, 0x25, 0x65,
+    0x12, 0xA4, 0xD5, 0xA6, 0xA0, 0xE9, 0x40, 0x25, 0xD0, 0x06, 0xE1, 0xA1, 0x80, 0x04, 0x60, 0x75,
+    0xD1, 0xE4, 0xA2, 0x95, 0xEE, 0x0C, 0x45, 0x66, 0xD4, 0xF7, 0x1C, 0xDF, 0x69, 0x49, 0x2F, 0x41,
+    0x0C, 0xE8, 0x57, 0x8D, 0x08, 0x15, 0xB9, 0x74, 0xD2, 0x0D, 0x28, 0x68, 0xA5, 0x4D, 0x6B, 0x80,
+    0x33, 0x68, 0x23, 0x1D, 0xA7, 0x00, 0x02, 0x4B, 0x77, 0xD9, 0x56, 0x5A, 0xD3, 0xDE, 0x6F, 0x5B,
+    0xCA, 0x32, 0x8E, 0xEF, 0x74, 0xB9, 0x93, 0xB6, 0x6C, 0xA3, 0xEC, 0x0E, 0x5A, 0x74, 0xB7, 0xAE,
+    0xDF, 0x63, 0x62, 0x9D, 0xAE, 0x6F, 0xED, 0x9A, 0xC1, 0x8E, 0x15, 0xF6, 0x08, 0xE7, 0x67, 0x7A,
+    0xE8, 0x22, 0x89, 0xE3, 0x38, 0x29, 0xD4, 0x90, 0x91, 0x53, 0x52, 0x50, 0x50, 0xED, 0x18, 0x69,
+    0xE2, 0x13, 0x77, 0xAF, 0x91, 0xC2, 0x22, 0x4B, 0x14, 0x9C, 0x62, 0x15, 0xC2, 0x7E, 0xE1, 0x97,
+    0x13, 0x7F, 0x5C, 0xBA, 0x4D, 0x69, 0x51, 0x96, 0xB4, 0x46, 0x1B, 0xB4, 0xF9, 0xA4, 0x4B, 0xEA,
+    0xBC, 0xD2, 0x38, 0xBA, 0x18, 0x2D, 0x55, 0x95, 0x5C, 0x77, 0xFA, 0xCB, 0x14, 0xFE, 0x3E, 0x9F,
+    0xD2, 0x90, 0xB8, 0xFB, 0x7C, 0x8A, 0xB4, 0x9F, 0xFA, 0x62, 0x0B, 0xFA, 0x99, 0x10, 0x06, 0x19,
+    0xCF, 0xDE, 0xFF, 0x62, 0x15, 0x39, 0xDA, 0x48, 0x4B, 0xD8, 0xF9, 0x78, 0x59, 0xFC, 0xD4, 0x37,
+    0x93, 0xE5, 0x05, 0x6D, 0xA4, 0x15, 0x81, 0x86, 0x12, 0xDD, 0x9B, 0x59, 0xF2, 0x49, 0x37, 0xF2,
+    0x91, 0x97, 0xD1, 0x64, 0x2E, 0x99, 0x32, 0xF0, 0x64, 0xFD, 0xD4, 0x2A, 0xCB, 0x20, 0xB6, 0x31,
+    0xDA, 0x9D, 0xC9, 0xE9, 0xA6, 0x47, 0xFE, 0x47, 0x39, 0x55, 0xED, 0xC0, 0x8E, 0x4D, 0x66, 0xF4,
+    0x5D, 0x33, 0xD8, 0xFF, 0x95, 0xFD, 0xFF, 0xCB, 0xC0, 0xE1, 0x7E, 0x59, 0x0D, 0xEB, 0xA9, 0x27,
+    0x4F, 0xA6, 0x68, 0x13, 0x8D, 0xB4, 0x65, 0x10, 0x61, 0xA9, 0x60, 0x3D, 0xFD, 0x7A, 0xBD, 0x2C,
+    0xDF, 0x08, 0xDA, 0x84, 0x52, 0xDA, 0x22, 0x7D, 0x29, 0x2C, 0x11, 0x9A, 0xD4, 0x94, 0xCB, 0xD2,
+    0xA9, 0x57, 0x09, 0xFC, 0xCC, 0x56, 0xE4, 0x61, 0x09, 0x35, 0x49, 0x0D, 0x33, 0x69, 0x19, 0xF4,
+    0x0F, 0x99, 0xC0, 0xA0, 0x83, 0xBA, 0x7D, 0x87, 0xF9, 0x7E, 0x9B, 0xE5, 0x51, 0x2B, 0x6F, 0x9C,
+    0xB4, 0xC3, 0xBA, 0x52, 0x5E, 0xD9, 0x6D, 0x2A, 0x5D, 0xA7, 0x75, 0xCB, 0x44, 0xA3, 0x9F, 0x09,
+    0x22, 0xE4, 0x0C, 0xA4, 0x4B, 0x7C, 0x49, 0xA9, 0xAC, 0xB4, 0xA2, 0x45, 0xD5, 0x97, 0x48, 0xFC,
+    0xC0, 0xD2, 0xEA, 0x96, 0x42, 0xBE, 0x43, 0x26, 0xAE, 0x5B, 0x55, 0x37, 0x4D, 0xE2, 0xCA, 0x8C,
+    0x56, 0x4B, 0x57, 0x48, 0xDB, 0x64, 0xC2, 0xEB, 0xB4, 0xDE, 0x92, 0x6F, 0xBA, 0x92, 0xF5, 0xA0,
+    0xD1, 0x85, 0xB2, 0xC9, 0x0D, 0xE1, 0x19, 0xD5, 0x5B, 0x68, 0x57, 0x90, 0xF4, 0x39, 0xDE, 0xF3,
+    0x3D, 0x52, 0xB1, 0xD4, 0xA7, 0x54, 0xC9, 0x2F, 0x23, 0x56, 0x8F, 0x5F, 0xB3, 0xDE, 0x19, 0xB6,
+    0x83, 0x83, 0xBB, 0xBC, 0x44, 0x06, 0xE9, 0xC9, 0x9E, 0x5D, 0x1A, 0xFC, 0x25, 0xCD, 0x6B, 0x58,
+    0x46, 0xBD, 0xDA, 0x41, 0x0E, 0xED, 0x2F, 0x35, 0xAF, 0x69, 0x07, 0x56, 0x88, 0xD0, 0x23, 0x25,
+    0xAB, 0x4F, 0x3D, 0x7B, 0xF5, 0xAD, 0xF8, 0xDF, 0xEB, 0xEF, 0x8C, 0x18, 0x9A, 0x4A, 0x4C, 0x44,
+    0x48, 0xAD, 0xB2, 0x2B, 0x1D, 0x37, 0xAA, 0xAC, 0x74, 0x19, 0x19, 0x0D, 0xDB, 0xD2, 0x49, 0xAF,
+    0xD1, 0xA6, 0xA2, 0xE0, 0xE7, 0xAF, 0xCD, 0x56, 0x93, 0xB8, 0x52, 0xEF, 0xAC, 0xCD, 0x7A, 0xBF,
+    0x36, 0xC9, 0x9B, 0xAE, 0xA4, 0x0A, 0x1A, 0x5D, 0x29, 0x9B, 0x44, 0xE1, 0x19, 0xF6, 0x6B, 0x23,
+    0x42, 0xE7, 0x2B, 0x59, 0x81, 0xC5, 0x11, 0xC8, 0x68, 0xE0, 0xDB, 0x80, 0xF9, 0x2D, 0x8E, 0x8E,
+    0x5A, 0xF9, 0xC3, 0xDD, 0xC4, 0xAF, 0xFA, 0xAF, 0x24, 0x7E, 0x54, 0x5D, 0x5C, 0x99, 0x40, 0x06,
+    0x43, 0x8F, 0x9C, 0x80, 0x88, 0xED, 0x1D, 0x28, 0x37, 0x9B, 0xC3, 0x30, 0xB6, 0x0C, 0xCD, 0x90,
+    0x21, 0xD2, 0x0F, 0x60, 0x5B, 0x1B, 0xB4, 0xB2, 0xC8, 0x2B, 0x1E, 0x42, 0x0B, 0x45, 0x09, 0x99,
+    0x86, 0xF4, 0xAA, 0x45, 0xFA, 0x16, 0xD1, 0xAE, 0xC0, 0x34, 0xB5, 0x6C, 0x33, 0xE5, 0x22, 0xD9,
+    0xED, 0x19, 0x7D, 0xBD, 0x0C, 0x8C, 0xA7, 0x74, 0x00, 0xFD, 0x63, 0x46, 0xC4, 0x36, 0x7D, 0x6F,
+    0x3B, 0x33, 0x2B, 0x2B, 0x64, 0x05, 0x59, 0x45, 0xD6, 0x90, 0xB7, 0xAC, 0xB4, 0x14, 0x0D, 0x4D,
+    0x25, 0xC2, 0xE0, 0x82, 0x4B, 0x7B, 0xBE, 0xC1, 0x1C, 0xEC, 0xF0, 0x5C, 0x1D, 0x7B, 0xB0, 0xF3,
+    0x2F, 0x83, 0x26, 0x5B, 0x5D, 0x60, 0xF3, 0x28, 0xA3, 0x09, 0x8F, 0x9F, 0xFF, 0xEC, 0x12, 0x02,
+    0xD0, 0x36, 0x90, 0x67, 0xA0, 0xCE, 0xD5, 0xE0, 0x5E, 0xEB, 0x33, 0xF4, 0x58, 0x23, 0x63, 0x34,
+    0xCC, 0x98, 0x32, 0x44, 0xFA, 0xD4, 0x32, 0xA0, 0x85, 0x90, 0x81, 0x4E, 0x3C, 0x84, 0x12, 0xB4,
+    0x74, 0x88, 0x50, 0xC0, 0x40, 0x5A, 0xA4, 0x2F, 0xE1, 0x8C, 0xF4, 0x68, 0x3B, 0x20, 0x09, 0x4C,
+    0xB9, 0x88, 0x9A, 0x47, 0x73, 0x37, 0xA5, 0x07, 0x14, 0x25, 0xFA, 0x8B, 0x26, 0x79, 0xC3, 0x71,
+    0xAA, 0x2B, 0xB0, 0x1F, 0x33, 0x64, 0xD1, 0xA4, 0xEF, 0x6D, 0x8B, 0x56, 0xFA, 0x15, 0x32, 0x69,
+    0x45, 0xA8, 0xC8, 0xD2, 0x3A, 0xF1, 0x2D, 0x2B, 0xDA, 0x48, 0xDB, 0xD0, 0x28, 0x9B, 0x31, 0xB8,
+    0xE0, 0x76, 0x38, 0x94, 0x5D, 0xD7, 0xB3, 0xD2, 0x85, 0xDF, 0xAE, 0xA2, 0x89, 0x3F, 0x26, 0x8B,
+    0x21, 0xF1, 0x99, 0x2D, 0xA9, 0xA4, 0x95, 0xB6, 0xA2, 0x48, 0x6B, 0x65, 0x5B, 0x26, 0x7A, 0xED,
+    0x12, 0x31, 0x9A, 0xEC, 0xF5, 0x3E, 0xFA, 0x7A, 0x69, 0x33, 0x0A, 0x5A, 0x65, 0x53, 0xDB, 0x50,
+    0x68, 0x23, 0xBB, 0x1B, 0x57, 0xD0, 0x22, 0x1D, 0x69, 0xB7, 0x82, 0xDF, 0x4A, 0xBE, 0xD7, 0xCA,
+    0x1F, 0xAE, 0xCA, 0x16, 0xE5, 0xEF, 0x8A, 0x30, 0xF7, 0x85, 0x97, 0x07, 0xF0, 0xE8, 0xC5, 0x2E,
+    0xB9, 0x58, 0xEE, 0x72, 0x8B, 0x23, 0xC0, 0x81, 0x5F, 0xE1, 0x5F, 0xCF, 0xF8, 0xF8, 0x1B, 0xCC,
+    0x10, 0x93, 0x7B, 0x32, 0xE9, 0xBB, 0x25, 0xD1, 0x3B, 0xE5, 0xE3, 0x12, 0x14, 0x70, 0xBA, 0x4B,
+    0x53, 0x00, 0x7C, 0x81, 0xFA, 0x97, 0x30, 0xEC, 0x40, 0x9C, 0x07, 0x22, 0xE4, 0x61, 0x55, 0xCB,
+    0xEF, 0xD7, 0x0C, 0xEB, 0x8E, 0x33, 0x64, 0x61, 0x9F, 0x49, 0x33, 0x27, 0x7F, 0xB8, 0xCA, 0x0C,
+    0xCE, 0xDE, 0x5F, 0xE7, 0xDC, 0x93, 0x9E, 0x75, 0x69, 0xA4, 0x43, 0x7A, 0x12, 0x8F, 0x70, 0x9D,
+    0x3D, 0xFC, 0x58, 0xC6, 0x79, 0xD2, 0x26, 0xA6, 0x2B, 0xC1, 0xB2, 0x0E, 0xE6, 0xBD, 0x04, 0x69,
+    0x0B, 0xA3, 0x9A, 0xA4, 0x8B, 0x2F, 0xFD, 0x2D, 0xB6, 0x0F, 0x72, 0x36, 0xBD, 0x3D, 0xBF, 0xAB,
+    0x13, 0x06, 0xE9, 0x59, 0x21, 0xF1, 0x3C, 0x02, 0xB0, 0xE7, 0x5B, 0xC4, 0xA9, 0x7E, 0xE3, 0xB5,
+    0x02, 0x11, 0x90, 0x1E, 0xD5, 0x22, 0x27, 0xFD, 0xEC, 0xC9, 0xCB, 0x0C, 0xF4, 0xEB, 0xED, 0xE0,
+    0x0E, 0xAE, 0x7B, 0x16, 0x86, 0x96, 0xA2, 0xE8, 0x91, 0x98, 0xBF, 0xB8, 0x2C, 0x2B, 0xC8, 0x19,
+    0x45, 0xD1, 0x41, 0x47, 0x9F, 0x49, 0x16, 0x15, 0xCF, 0xEB, 0x38, 0x49, 0xDD, 0x43, 0xD2, 0x21,
+    0xBA, 0xB9, 0xD3, 0xFD, 0x03, 0x1D, 0x62, 0xDE, 0x11, 0x42, 0xDB, 0x3B, 0xA0, 0x5C, 0x12, 0x56,
+    0xC5, 0x64, 0x70, 0x63, 0xA2, 0x62, 0x8B, 0xEC, 0x7A, 0x68, 0x72, 0x90, 0x35, 0xFF, 0x4D, 0x9F,
+    0xF5, 0x7E, 0xC5, 0xE8, 0x68, 0x67, 0x8F, 0x75, 0x69, 0xCD, 0x0A, 0x8C, 0x0C, 0xC3, 0x9A, 0xAC,
+    0x26, 0x83, 0xE2, 0x40, 0x12, 0x6E, 0x8D, 0x9F, 0x8D, 0x2D, 0xC7, 0x11, 0x9E, 0xC4, 0x23, 0xAD,
+    0xF8, 0x6A, 0xF7, 0xBD, 0x4E, 0x6B, 0xD2, 0x93, 0x77, 0x6B, 0x4D, 0x36, 0x37, 0x3A, 0x4E, 0x92,
+    0x36, 0x31, 0x65, 0xE7, 0x79, 0xAB, 0x6E, 0x5E, 0x06, 0x35, 0x8C, 0x0D, 0x62, 0x0E, 0xC9, 0xA4,
+    0x23, 0x04, 0xFA, 0xE2, 0x61, 0x7B, 0x91, 0xAC, 0x1E, 0x8F, 0xBD, 0x8A, 0xBB, 0xF8, 0x3E, 0xBE,
+    0xE0, 0x1F, 0x77, 0x18, 0x3C, 0x1D, 0x39, 0x20, 0x63, 0xD0, 0x6F, 0xBC, 0xD6, 0x99, 0x92, 0xAE,
+    0x51, 0x2D, 0xCC, 0x21, 0xAB, 0x51, 0x16, 0x69, 0x4D, 0x6A, 0x6F, 0x8D, 0xCD, 0x78, 0x06, 0x90,
+    0xC5, 0xF8, 0xA3, 0x18, 0x67, 0x9F, 0xA8, 0x32, 0xCA, 0x9F, 0x53, 0x65, 0x64, 0x9F, 0xAC, 0x32,
+    0x64, 0x0D, 0xA7, 0xBB, 0xEF, 0xEC, 0x87, 0xCF, 0xB9, 0x8E, 0xDD, 0x3E, 0x80, 0x82, 0xC0, 0xE0,
+    0xF9, 0x41, 0xB4, 0x67, 0x57, 0x77, 0xD2, 0xBA, 0xBB, 0x0B, 0xD0, 0x1C, 0x71, 0xAB, 0x4E, 0x27,
+    0x1C, 0x23, 0x35, 0x9C, 0x41, 0x38, 0x51, 0x31, 0xEC, 0xD6, 0xAB, 0x48, 0x51, 0xAF, 0x42, 0xEC,
+    0xB8, 0x12, 0x54, 0x8C, 0xB7, 0x62, 0x9C, 0xDD, 0x8B, 0x63, 0xB7, 0xDC, 0x77, 0xDC, 0x01, 0x01,
+    0xF7, 0x1C, 0x43, 0x20, 0x35, 0x0B, 0xC7, 0xF9, 0x9F, 0xAD, 0xB4, 0x0C, 0x9E, 0x4F, 0x63, 0x50,
+    0xEF, 0xED, 0x66, 0xD6, 0xF7, 0x66, 0x86, 0x0D, 0xE2, 0x56, 0x9D, 0xCC, 0x01, 0x46, 0x31, 0x5E,
+    0x88, 0xD1, 0xDD, 0x67, 0x68, 0x8E, 0x71, 0xF4, 0x83, 0xD8, 0x72, 0x0F, 0xBE, 0x7B, 0x8F, 0x21,
+    0x7E, 0xDA, 0x9B, 0x0F, 0xFE, 0x8B, 0x8A, 0xEE, 0xFE, 0x37, 0x07, 0x30, 0x0B, 0x10, 0xBF, 0x08,
+    0x7F, 0x14, 0x0D, 0xC7, 0xD2, 0xEE, 0xF5, 0xD7, 0x91, 0x36, 0x47, 0x04, 0x6D, 0x68, 0xA4, 0x65,
+    0x59, 0x04, 0xB4, 0x69, 0x90, 0xB6, 0x44, 0x04, 0x0D, 0x8D, 0xB4, 0x94, 0x22, 0xA0, 0xD9, 0x1D,
+    0xEC, 0xAE, 0x2C, 0x69, 0x19, 0x30, 0x60, 0x60, 0xE4, 0x3C, 0x1A, 0x76, 0xD5, 0x7F, 0x01, 0xA3,
+    0xBD, 0xD7, 0xA3, 0x20, 0x9F, 0x69, 0xBB, 0xBC, 0x6B, 0xB5, 0xA5, 0x29, 0x28, 0x35, 0x5A, 0x59,
+    0x75, 0xC5, 0x0B, 0xDF, 0x1D, 0x67, 0x64, 0xAA, 0xDE, 0xA1, 0x27, 0xB3, 0x1B, 0xBF, 0x9D, 0xF4,
+    0x7C, 0x87, 0x8C, 0x1E, 0x7A, 0x6D, 0x53, 0x35, 0x45, 0xE2, 0xC9, 0x68, 0x49, 0xEB, 0x82, 0xC4,
+    0x65, 0xD0, 0xA6, 0x35, 0x85, 0x74, 0x64, 0x04, 0xD2, 0xBA, 0x40, 0xBA, 0x1E, 0xD2, 0xEA, 0x06,
+    0xDB, 0x7E, 0x50, 0x9B, 0x24, 0x24, 0x21, 0x69, 0x19, 0xDE, 0x68, 0x49, 0x76, 0xB5, 0x77, 0x38,
+    0x27, 0x8B, 0x06, 0x38, 0xC8, 0xA2, 0x36, 0xE9, 0x39, 0x2B, 0x5D, 0x20, 0x54, 0x54, 0x39, 0x4B,
+    0xDD, 0xF1, 0x1B, 0x41, 0x84, 0xF5, 0x1D, 0x52, 0xF7, 0x99, 0xF9, 0x9F, 0xD9, 0x41, 0x4F, 0x77,
+    0x08, 0x8E, 0x80, 0x3F, 0x0A, 0x83, 0x19, 0x88, 0x3E, 0xA1, 0x78, 0xE0, 0xF3, 0x77, 0x44, 0xB0,
+    0x5F, 0xD6, 0xC9, 0x0E, 0xBD, 0xFB, 0xD9, 0xE7, 0x8F, 0x05, 0x60, 0xE0, 0xE0, 0xD0, 0x21, 0x50,
+    0x0A, 0xF8, 0x53, 0xDB, 0xF7, 0x85, 0xFC, 0x65, 0x4C, 0xA8, 0x30, 0xC8, 0x19, 0xE2, 0x8A, 0x65,
+    0xF3, 0x14, 0xFB, 0xD7, 0xFB, 0x89, 0xF9, 0xEC, 0xB3, 0xDB, 0x89, 0x77, 0xD5, 0x22, 0xAF, 0x76,
+    0x9C, 0x78, 0xF2, 0x92, 0x85, 0x2E, 0xF5, 0x0F, 0x69, 0x4D, 0x25, 0x1D, 0x39, 0x81, 0xD4, 0x54,
+    0x48, 0x97, 0x43, 0xD0, 0x86, 0x4A, 0x5A, 0x72, 0x02, 0xDA, 0x54, 0x48, 0xBB, 0x3B, 0xE8, 0xFA,
+    0xC1, 0x92, 0xD4, 0xA6, 0x36, 0x75, 0x74, 0x69, 0x96, 0xBB, 0x2B, 0xDF, 0x48, 0x5F, 0xB1, 0x54,
+    0x05, 0xF2, 0xAA, 0xE5, 0xC9, 0xCF, 0xF7, 0x88, 0xC0, 0x41, 0xE9, 0x12, 0xAF, 0xD1, 0xA6, 0xA0,
+    0x10, 0x41, 0x84, 0xB4, 0x56, 0x75, 0x49, 0x4E, 0xA0, 0x55, 0x56, 0xD9, 0x25, 0x86, 0x34, 0x62,
+    0x92, 0x84, 0xCC, 0xA9, 0xDB, 0x6F, 0x93, 0xCE, 0xBA, 0xE2, 0x4C, 0x78, 0x34, 0x0D, 0xCA, 0x96,
+    0x24, 0x5E, 0xC3, 0x96, 0xB2, 0x94, 0x89, 0x47, 0xD3, 0xA2, 0x6C, 0xD1, 0x0D, 0xB6, 0xCA, 0x52,
+    0xEC, 0x0E, 0xF6, 0x57, 0xB6, 0xD2, 0xB1, 0xCD, 0x36, 0x17, 0xD1, 0xB7, 0x67, 0x30, 0x9E, 0x75,
+    0xC0, 0xB0, 0xF0, 0x5D, 0xFA, 0x40, 0x41, 0xDF, 0x3C, 0xB0, 0x0A, 0x8B, 0x88, 0x13, 0x2E, 0xF1,
+    0x81, 0xB6, 0xA0, 0xC8, 0xC8, 0xD2, 0x5A, 0x9D, 0xEB, 0x8E, 0x2B, 0xAA, 0xA5, 0x5D, 0x6E, 0x7D,
+    0x74, 0x71, 0x33, 0xFD, 0x45, 0xDC, 0x3A, 0x5C, 0x04, 0x18, 0x04, 0x7A, 0xBA, 0x52, 0xB8, 0x9E,
+    0x63, 0x67, 0x1D, 0x8D, 0x7C, 0xCB, 0x26, 0x2D, 0x55, 0xC1, 0xD0, 0xE8, 0x73, 0x36, 0x6D, 0x09,
+    0x05, 0x1F, 0x9B, 0x5C, 0xDA, 0xE5, 0x75, 0x69, 0x0B, 0xF9, 0xBD, 0xBA, 0x91, 0x76, 0x7D, 0x5D,
+    0x53, 0x68, 0xF5, 0x52, 0x90, 0x97, 0xFD, 0xF1, 0x92, 0xA2, 0x90, 0xAF, 0x58, 0xF9, 0xBD, 0xBA,
+    0xD8, 0xA2, 0xD8, 0x92, 0x7F, 0x8C, 0x7C, 0x87, 0xD2, 0x93, 0x3B, 0x39, 0x25, 0x99, 0x32, 0xAC,
+    0x19, 0x18, 0x19, 0x48, 0xC2, 0x0E, 0xF0, 0x42, 0xD7, 0x3A, 0x94, 0x05, 0x10, 0xEF, 0x7A, 0x38,
+    0x2C, 0x6C, 0x6F, 0x5D, 0x8B, 0x2C, 0xE6, 0x5C, 0xA4, 0x69, 0x64, 0x2B, 0x2F, 0xFB, 0x25, 0x97,
+    0xAB, 0xFA, 0xE3, 0x3A, 0x2C, 0xA9, 0xFF, 0x4D, 0xD9, 0xF5, 0xE2, 0x78, 0x29, 0x3E, 0xF4, 0xEF,
+    0x06, 0xF5, 0x7D, 0xF9, 0xAA, 0xD1, 0xC7, 0x75, 0xC1, 0x8A, 0x5D, 0x71, 0xCC, 0x89, 0xC8, 0x56,
+    0x4E, 0xD0, 0x56, 0x77, 0xB7, 0x61, 0x0A, 0x43, 0x87, 0x7E, 0x8E, 0xC4, 0x1E, 0x7F, 0x10, 0x9D,
+    0x5E, 0x3B, 0x50, 0x16, 0xB1, 0x46, 0x5E, 0xB3, 0xBB, 0x88, 0xD9, 0x03, 0xEF, 0x60, 0x01, 0xAD,
+    0x6A, 0xC2, 0x4E, 0xCB, 0x4C, 0x5A, 0xD3, 0x54, 0x64, 0xD2, 0x4A, 0x57, 0xD2, 0x24, 0x3E, 0x23,
+    0x93, 0x8E, 0xD0, 0xA0, 0x4F, 0xC2, 0x77, 0x1D, 0x6A, 0x02, 0xC3, 0x7B, 0xE2, 0xE6, 0xFA, 0xDD,
+    0xF0, 0xD5, 0x0E, 0xAD, 0x11, 0xBA, 0x73, 0x1A, 0xBA, 0x3E, 0x4C, 0x18, 0xC5, 0x29, 0xE3, 0x38,
+    0xED, 0x5C, 0xD8, 0x0E, 0xFD, 0x9F, 0xF5, 0xF0, 0xC2, 0xE4, 0xDE, 0x7E, 0xA3, 0x7E, 0x28, 0xD9,
+    0x19, 0x32, 0x30, 0x8C, 0x91, 0x61, 0x8C, 0xBD, 0x90, 0xB6, 0x0B, 0xF1, 0x24, 0x35, 0xC0, 0xE2,
+    0xDA, 0xAA, 0x8A, 0x53, 0xD6, 0xCE, 0xC0, 0x0A, 0x0C, 0xBA, 0x7C, 0xA0, 0x43, 0x71, 0xEA, 0xFE,
+    0x5A, 0x65, 0x91, 0xB7, 0x36, 0x44, 0x8C, 0x75, 0xE7, 0xA8, 0xB2, 0xBE, 0xEE, 0x5E, 0x78, 0xC0,
+    0xC2, 0x19, 0x44, 0x20, 0x09, 0x3D, 0xA3, 0xBA, 0xB6, 0x26, 0x62, 0x64, 0xED, 0x0C, 0x4C, 0x48,
+    0x02, 0xCA, 0xF6, 0xED, 0x14, 0x3B, 0x47, 0x19, 0x0C, 0x37, 0x5E, 0x1B, 0xC5, 0x6E, 0x69, 0x13,
+    0xBB, 0x0E, 0x3F, 0xF5, 0xDD, 0xC2, 0xAC, 0x3C, 0xF0, 0x59, 0x4B, 0x13, 0xC7, 0x4F, 0x1D, 0x99,
+    0xA3, 0xAF, 0x16, 0x3E, 0xDB, 0xAC, 0x01, 0x8C, 0x1C, 0xF2, 0xB6, 0x21, 0xEF, 0x1C, 0x85, 0xB2,
+    0xF7, 0xB5, 0x70, 0x55, 0x7D, 0x3B, 0xBE, 0xD9, 0xED, 0x86, 0xFE, 0x94, 0xEE, 0xAC, 0xFE, 0x22,
+    0x6D, 0x60, 0xBB, 0xE3, 0x4A, 0xBB, 0x1C, 0x4D, 0xBA, 0x42, 0x19, 0x28, 0xF5, 0xB3, 0xEE, 0x74,
+    0xA7, 0xFD, 0x43, 0x57, 0x16, 0x4F, 0x4A, 0x23, 0xF8, 0x2B, 0xF3, 0x47, 0xCA, 0x78, 0x55, 0xF8,
+    0xD1, 0x6C, 0x3C, 0x05, 0x62, 0xFC, 0xD1, 0xC6, 0x86, 0x39, 0x22, 0x8E, 0xEF, 0x1F, 0x4E, 0x53,
+    0xBF, 0x50, 0x96, 0x0B, 0x50, 0xE4, 0xC5, 0x32, 0x3C, 0x2A, 0xA7, 0x89, 0xAD, 0x56, 0x64, 0x7D,
+    0x00, 0xC1, 0xF8, 0xDC, 0x17, 0x0E, 0x3D, 0xFC, 0xB7, 0x42, 0xDE, 0xD5, 0x8C, 0xFA, 0x8B, 0x2F,
+    0xBF, 0xE1, 0x4E, 0x1D, 0x03, 0x74, 0x72, 0xF9, 0xBA, 0x1D, 0x58, 0xE5, 0xD0, 0x4B, 0xCB, 0x45,
+    0x51, 0x3C, 0xB1, 0xB4, 0x74, 0x78, 0x79, 0xB9, 0x28, 0x0A, 0x00, 0x79, 0xCD, 0x2F, 0x69, 0x36,
+    0x4F, 0xCB, 0x97, 0x2D, 0xB0, 0xCE, 0x80, 0x7F, 0xBA, 0x70, 0x5C, 0xA7, 0x91, 0x4B, 0x88, 0xD5,
+    0x6C, 0xFA, 0xB7, 0x7E, 0xE7, 0x85, 0x47, 0x12, 0xBB, 0xAE, 0x45, 0x28, 0x95, 0x3D, 0x80, 0xB2,
+    0x8D, 0x4E, 0x7C, 0xA1, 0xCC, 0x01, 0xD6, 0xAB, 0xAA, 0x28, 0x8E, 0x2E, 0xDC, 0x35, 0x42, 0x96,
+    0xB8, 0x42, 0x1A, 0x38, 0xD3, 0xBD, 0x92, 0xD9, 0xFF, 0xD4, 0xB5, 0x69, 0x62, 0x0F, 0x2E, 0x48,
+    0xBB, 0xF2, 0xBF, 0x4F, 0x4F, 0x2F, 0x32, 0x9A, 0x3F, 0xF5, 0xAF, 0x38, 0xCA, 0x51, 0x8E, 0x73,
+    0x8C, 0x53, 0xD2, 0x55, 0xFA, 0x0B, 0xBE, 0x85, 0x3D, 0xEA, 0x5C, 0xED, 0x8E, 0x26, 0x28, 0x36,
+    0xB3, 0xE7, 0x66, 0x30, 0xFC, 0xF0, 0x52, 0x1D, 0x3A, 0xB8, 0xF8, 0xF4, 0xE0, 0x5F, 0xCC, 0xF7,
+    0x73, 0xFE, 0xD1, 0xE7, 0xE6, 0x00, 0xCB, 0x1D, 0xAC, 0x15, 0x53, 0x47, 0x7A, 0xC2, 0x85, 0x22,
+    0x93, 0xD3, 0xB3, 0x07, 0xAB, 0xEA, 0x00, 0x14, 0xCB, 0x55, 0x09, 0x8B, 0x72, 0xBA, 0xF9, 0xFE,
+    0xBE, 0xAF, 0xBD, 0xD1, 0x8A, 0x67, 0x9D, 0xDF, 0x3C, 0x82, 0x34, 0xA7, 0x13, 0xB7, 0xF4, 0xB9,
+    0x6B, 0x6D, 0xAA, 0xD5, 0xB3, 0x6E, 0x24, 0x8C, 0x5E, 0x5A, 0x2E, 0x8A, 0xF5, 0xDF, 0x18, 0xC6,
+    0xEB, 0xEF, 0xFF, 0xE1, 0x29, 0xDE, 0xE6, 0xD0, 0xAA, 0x30, 0x07, 0x0E, 0xFC, 0x95, 0x2B, 0x57,
+    0xAE, 0xC6, 0x99, 0x78, 0xC6, 0xC0, 0x7E, 0x79, 0xF9, 0x4F, 0xED, 0xD0, 0x2A, 0x0B, 0xC8, 0xA0,
+    0xDB, 0xB2, 0x78, 0x6D, 0xFF, 0x11, 0xB1, 0x5F, 0x9E, 0x8B, 0x76, 0x50, 0x8B, 0xD5, 0x6C, 0x5A,
+    0x7E, 0xF5, 0xD4, 0x3E, 0xC1, 0x33, 0xF3, 0xC3, 0xBF, 0x1A, 0xBF, 0x97, 0xF8, 0xD1, 0x6C, 0x34,
+    0x1D, 0xC6, 0xE9, 0x30, 0x4E, 0x17, 0xD7, 0x9E, 0x1F, 0xC4, 0xD9, 0xE2, 0xDA, 0xF3, 0xC0, 0x30,
+    0x4E, 0x9E, 0xDA, 0xF8, 0xD6, 0x9D, 0xAB, 0x20, 0x8D, 0x71, 0x63, 0xE3, 0xB5, 0x61, 0x8C, 0xF1,
+    0xAD, 0x18, 0xE3, 0x94, 0xBD, 0x5C, 0x54, 0xED, 0xB0, 0x5E, 0xDF, 0x89, 0x6C, 0x14, 0x9D, 0x12,
+    0xDD, 0xA9, 0x66, 0x03, 0x2C, 0x75, 0x2A, 0xB4, 0x05, 0xBA, 0x43, 0xD0, 0xEF, 0x90, 0x9A, 0xF7,
+    0x5D, 0xBE, 0x0A, 0x7C, 0x7E, 0x29, 0xDD, 0x5F, 0x1D, 0x38, 0xC6, 0xFF, 0x63, 0xF6, 0x9F, 0xE6,
+    0xED, 0x38, 0x5D, 0x5B, 0x33, 0x8B, 0x6B, 0x27, 0xE2, 0xFC, 0x18, 0x6F, 0x71, 0xE8, 0x8F, 0x5E,
+    0xFF, 0x0F, 0x1B, 0xBF, 0x2F, 0x9E, 0x79, 0x36, 0xCE, 0x4F, 0x6D, 0xFE, 0x5B, 0x21, 0xE0, 0xDF,
+    0x5C, 0x9E, 0x49, 0xFF, 0x35, 0xF7, 0x0C, 0x9C, 0x3F, 0xA3, 0x09, 0xAA, 0x3E, 0x3E, 0x48, 0xCC,
+    0xE2, 0xDA, 0xF3, 0x59, 0x9C, 0xEF, 0xBC, 0xC5, 0xF4, 0xA9, 0x8D, 0x6F, 0x21, 0xBD, 0xE6, 0x74,
+    0x62, 0x77, 0x77, 0x0C, 0x2C, 0xF2, 0xEC, 0xEC, 0xD0, 0xD7, 0xE2, 0x3F, 0x4B, 0xFC, 0x41, 0x6D,
+    0xB7, 0x8E, 0x3E, 0x0C, 0x8F, 0x22, 0x5D, 0xF9, 0x9D, 0xEB, 0x7F, 0xBC, 0x2C, 0x2C, 0xEB, 0x5B,
+    0x17, 0xCF, 0x00, 0x59, 0x9C, 0x2F, 0xAF, 0xFD, 0xCE, 0x71, 0x0E, 0x1D, 0xE7, 0x28, 0xB0, 0xB8,
+    0xB6, 0xF6, 0x89, 0xDB, 0x2E, 0x2F, 0x2F, 0x17, 0x45, 0x51, 0xAC, 0xC3, 0x57, 0x46, 0xE1, 0xF8,
+    0x61, 0x05, 0xF0, 0x57, 0x2F, 0xEB, 0xF6, 0xFA, 0x3B, 0xD3, 0xBF, 0xF1, 0xC3, 0xDE, 0x4B, 0x6D,
+    0x22, 0x2D, 0x66, 0x41, 0xB7, 0x9B, 0x7F, 0x14, 0x4F, 0x3C, 0xB3, 0xC5, 0x71, 0x44, 0x20, 0x31,
+    0x60, 0x0E, 0x0C, 0x7E, 0x64, 0xFF, 0x64, 0x26, 0x30, 0x69, 0x7D, 0xFE, 0xBB, 0x51, 0x3E, 0xEB,
+    0x01, 0x8E, 0xBC, 0x90, 0x5D, 0x38, 0x17, 0xA7, 0xFB, 0x1E, 0x01, 0x50, 0xAF, 0xB4, 0x9B, 0xC5,
+    0x7E, 0xA2, 0x9C, 0xEA, 0xF9, 0xF9, 0xC7, 0xCC, 0x3F, 0x72, 0xC0, 0x19, 0xFE, 0xDE, 0xAA, 0xE2,
+    0xD1, 0x45, 0xC3, 0x1E, 0x1E, 0x42, 0x18, 0x0E, 0x3E, 0x72, 0x10, 0xF1, 0x85, 0x37, 0x61, 0xEF,
+    0x99, 0x23, 0xF0, 0x8A, 0x83, 0x85, 0x53, 0x4F, 0x22, 0x6A, 0x56, 0x59, 0x65, 0xD1, 0x3C, 0x8A,
+    0x7B, 0xE8, 0xFF, 0xE3, 0x0C, 0xA0, 0xDE, 0x13, 0xCF, 0x2F, 0x8E, 0xC3, 0xD0, 0xC6, 0x3A, 0x7F,
+    0xE6, 0xC3, 0xA9, 0x87, 0x87, 0x8A, 0x4D, 0x7F, 0xFA, 0x20, 0xA4, 0x93, 0xC1, 0xC5, 0x63, 0xE9,
+    0x5F, 0xB5, 0xD2, 0x25, 0x35, 0x87, 0xDE, 0x6A, 0xA7, 0xDF, 0xFD, 0x27, 0x26, 0x39, 0xF9, 0xFD,
+    0x97, 0xB6, 0x13, 0x73, 0x2C, 0xF5, 0xD5, 0xA5, 0x63, 0xB8, 0x7D, 0xCA, 0xB7, 0xFA, 0xE4, 0x2B,
+    0xD7, 0xFF, 0x4F, 0x77, 0xCA, 0xED, 0xDD, 0xAF, 0xD2, 0xF2, 0x40, 0x67, 0xC0, 0x9B, 0xFF, 0xDD,
+    0x9B, 0x37, 0x07, 0x97, 0xFF, 0x0F, 0x84, 0x9C, 0xCF, 0x4E, 0x85, 0x3F, 0x4A, 0xD5, 0xFF, 0xF2,
+    0xD1, 0x8F, 0x6E, 0x4E, 0x8E, 0x1C, 0x4A, 0x6F, 0xFE, 0x7D, 0xD9, 0x11, 0xDA, 0xA1, 0x81, 0xCC,
+    0xCC, 0x50, 0x2D, 0xE3, 0x38, 0x87, 0xC7, 0x36, 0x0C, 0x5B, 0x20, 0xAE, 0x5B, 0xD8, 0xCE, 0xCE,
+    0x8B, 0x4B, 0x0C, 0x63, 0x34, 0x3C, 0xF6, 0x6D, 0x18, 0xC6, 0x78, 0x2D, 0xC6, 0x69, 0xFF, 0x0F,
+    0xCF, 0xC3, 0x81, 0x51, 0x3C, 0x9F, 0x5C, 0xFD, 0xC1, 0x8B, 0x71, 0xF6, 0x24, 0xE2, 0x42, 0x0D,
+    0x6B, 0x20, 0xC6, 0xD1, 0x33, 0x7C, 0xEF, 0x4B, 0xAD, 0xF4, 0x88, 0xB6, 0x00, 0x82, 0xE1, 0xCE,
+    0x7E, 0x24, 0x16, 0xF7, 0x6C, 0x6C, 0x6C, 0x5C, 0x1A, 0xC6, 0x18, 0xA7, 0xD0, 0x07, 0x1B, 0xD2,
+    0x6F, 0xBC, 0x76, 0x55, 0x3E, 0xFC, 0xE4, 0xDF, 0x70, 0xFF, 0x13, 0xD9, 0xFF, 0xFA, 0xAB, 0xFF,
+    0xDE, 0xFC, 0x5F, 0x7B, 0xCC, 0xC3, 0x1C, 0x7C, 0xE2, 0xE9, 0xA7, 0x5F, 0x30, 0xA9, 0x3B, 0x7F,
+    0x55, 0x3E, 0xFC, 0xF0, 0x31, 0xF7, 0x24, 0x9F, 0x7F, 0xE2, 0x7C, 0x77, 0xD5, 0x3F, 0x60, 0xDF,
+    0x39, 0x5E, 0x78, 0x88, 0x53, 0xE2, 0x3C, 0xF0, 0xB4, 0x78, 0xF9, 0xBF, 0x3C, 0xF9, 0xB4, 0xBD,
+    0xBA, 0xEF, 0xE1, 0xD3, 0x9F, 0x37, 0xF0, 0x34, 0x76, 0x4F, 0x73, 0xF4, 0x69, 0x77, 0x75, 0xCF,
+    0xDE, 0x27, 0x0E, 0x98, 0x87, 0xFE, 0x8D, 0xBB, 0xFA, 0x4F, 0x3F, 0xFF, 0xF4, 0x3F, 0x3C, 0xF1,
+    0xD0, 0xD3, 0x2F, 0x5C, 0x5E, 0x58, 0x78, 0xEC, 0x65, 0x7B, 0x4C, 0x72, 0x44, 0xC0, 0xC1, 0x7F,
+    0xFC, 0xF4, 0x0B, 0xE7, 0xDD, 0x13, 0xAB, 0xDF, 0x3C, 0xF4, 0x3F, 0x26, 0x2F, 0x14, 0xC2, 0xEC,
+    0x3D, 0xF2, 0xD7, 0x38, 0x9D, 0xB8, 0x27, 0xEC, 0x33, 0x9D, 0x9C, 0xBD, 0x43, 0x96, 0x35, 0x1C,
+    0xEA, 0xC3, 0x86, 0x4B, 0xE3, 0xEC, 0x2E, 0x4A, 0x29, 0xEF, 0x7C, 0xEE, 0xCA, 0x9A, 0x91, 0x71,
+    0xC6, 0xD9, 0x8D, 0xFA, 0xAE, 0x90, 0x7D, 0xA7, 0x20, 0x1E, 0xC6, 0x20, 0xBB, 0x88, 0xA1, 0x62,
+    0x0C, 0xF7, 0xD3, 0x72, 0x83, 0x4B, 0x46, 0xC6, 0x48, 0x29, 0x26, 0x1D, 0x91, 0x5D, 0x6A, 0x23,
+    0x5D, 0xA0, 0xD0, 0xA4, 0x97, 0x83, 0x68, 0xF3, 0xFD, 0x73, 0xE9, 0xEE, 0x46, 0xEA, 0xAA, 0x1D,
+    0xB4, 0xA1, 0x23, 0x94, 0x3A, 0xB1, 0xA6, 0xF7, 0x8B, 0x75, 0x6F, 0xB3, 0xCE, 0x7D, 0x62, 0xF5,
+    0xA7, 0x3B, 0x28, 0x21, 0xD6, 0x32, 0x46, 0x33, 0x34, 0x7B, 0x65, 0xD8, 0x6D, 0x2E, 0x4C, 0x6D,
+    0x17, 0x30, 0x63, 0x0C, 0x32, 0xC6, 0x3A, 0xBB, 0xD3, 0x9D, 0x28, 0xFB, 0xF4, 0x27, 0xAB, 0x21,
+    0xBB, 0xDD, 0x92, 0x45, 0xBB, 0x9B, 0x8A, 0xF7, 0x78, 0xC9, 0xDE, 0x9F, 0x8B, 0x97, 0xB8, 0x9F,
+    0x83, 0x97, 0x00, 0xAC, 0x27, 0x5E, 0x9B, 0x42, 0x84, 0xB4, 0xCE, 0x69, 0xA5, 0xCD, 0x68, 0xA4,
+    0xEB, 0x07, 0x4A, 0x02, 0xFC, 0x6D, 0xA3, 0x0B, 0x7E, 0x66, 0x77, 0xAA, 0x9F, 0x7B, 0x51, 0x01,
+    0xE9, 0x3A, 0xB2, 0xA7, 0x41, 0x1B, 0x5A, 0x34, 0x22, 0xEC, 0x8C, 0x72, 0x6F, 0x3B, 0xE1, 0x0E,
+    0xFD, 0xFD, 0xF3, 0x70, 0xBB, 0xBB, 0x41, 0xC4, 0x6D, 0x7E, 0xAD, 0x25, 0xFA, 0x8E, 0x09, 0x8D,
+    0xD1, 0x82, 0x88, 0xD1, 0x42, 0xE2, 0x94, 0x85, 0x8E, 0xE1, 0x53, 0x56, 0x1B, 0xBA, 0x86, 0x05,
+    0xB4, 0xD1, 0x80, 0x26, 0x9B, 0x43, 0xC6, 0x20, 0x7A, 0x96, 0x29, 0x93, 0x96, 0x82, 0x82, 0x86,
+    0x82, 0x8A, 0x8A, 0xF5, 0x3E, 0xCD, 0x6C, 0x68, 0x08, 0xB4, 0xB4, 0xD2, 0x13, 0x54, 0x88, 0x56,
+    0xC4, 0x68, 0x23, 0x49, 0xBC, 0xC9, 0x5D, 0x79, 0x3C, 0x69, 0x2D, 0x02, 0x74, 0xD8, 0x01, 0x89,
+    0x47, 0x04, 0x4A, 0xC8, 0x91, 0x96, 0xC4, 0x53, 0xC1, 0x70, 0xE3, 0xC2, 0xFB, 0x46, 0xC6, 0x18,
+    0xA3, 0x39, 0xB3, 0x76, 0xF2, 0xD7, 0xA7, 0x69, 0x4D, 0x90, 0xBE, 0x25, 0x23, 0xD7, 0x24, 0x3E,
+    0xF1, 0x81, 0x92, 0x32, 0x43, 0x5A, 0x75, 0xC5, 0x53, 0x25, 0x93, 0x12, 0x15, 0xE7, 0xD2, 0x32,
+    0x9E, 0xFF, 0x02, 0xB5, 0x1C, 0xD7, 0x32, 0x46, 0x53, 0x8A, 0xA9, 0xB2, 0xB2, 0xC7, 0x1A, 0x6D,
+    0xA0, 0xD2, 0xA4, 0x2F, 0x05, 0xB6, 0x72, 0xF4, 0x09, 0xB7, 0x9B, 0x54, 0xAF, 0xDC, 0xC5, 0x68,
+    0x3D, 0xB2, 0xD3, 0x31, 0x9F, 0xF8, 0xC4, 0x27, 0x81, 0x56, 0x04, 0x0A, 0x11, 0xFA, 0xEA, 0xB3,
+    0x25, 0x71, 0x13, 0xB8, 0x39, 0xE9, 0xFA, 0xA9, 0xB3, 0x0B, 0x90, 0x9E, 0x73, 0x48, 0xB7, 0x0D,
+    0x41, 0xD3, 0x57, 0xB4, 0x15, 0x69, 0xAD, 0x8D, 0x74, 0x22, 0x10, 0x76, 0x77, 0x5A, 0x48, 0xDF,
+    0x13, 0x47, 0xAC, 0x03, 0x89, 0xDD, 0x99, 0x22, 0x65, 0xD3, 0x5A, 0x4C, 0x69, 0x19, 0x5A, 0x8D,
+    0x9E, 0x88, 0x90, 0x7C, 0x60, 0x72, 0xAA, 0x90, 0x78, 0xAD, 0x29, 0xE5, 0x1B, 0x5E, 0xDA, 0x26,
+    0xA7, 0xCA, 0xA4, 0x4B, 0xCF, 0xD9, 0x82, 0xB6, 0x55, 0x56, 0xE7, 0x34, 0x7C, 0x6C, 0xB5, 0xC9,
+    0x02, 0x21, 0x99, 0xA1, 0x19, 0x1A, 0x11, 0xA4, 0x27, 0x07, 0x2D, 0x02, 0xF2, 0xDD, 0x16, 0x86,
+    0x2D, 0x88, 0xD5, 0x9D, 0xE8, 0xB9, 0x53, 0x38, 0x4B, 0x9F, 0x78, 0x11, 0xA8, 0x68, 0xD1, 0x54,
+    0x48, 0x57, 0x42, 0x93, 0x77, 0xAC, 0x85, 0xFC, 0xBE, 0x81, 0x7F, 0x6F, 0x21, 0x73, 0xFD, 0x66,
+    0xA7, 0xD0, 0xD9, 0x92, 0x98, 0x76, 0xAF, 0xAB, 0x27, 0x77, 0x56, 0x36, 0x35, 0x79, 0xB7, 0xA9,
+    0x29, 0x48, 0x4B, 0x25, 0x02, 0x4B, 0x34, 0xA4, 0xF5, 0x27, 0x06, 0x73, 0x1A, 0xB4, 0x29, 0x3F,
+    0x6D, 0x70, 0x18, 0xA3, 0xD5, 0x31, 0x86, 0xAE, 0xB6, 0x59, 0xEF, 0xA7, 0x7F, 0xA7, 0x5E, 0x68,
+    0x11, 0x81, 0xC4, 0x75, 0x0E, 0x56, 0x7C, 0x8B, 0xD1, 0x34, 0x7D, 0xAF, 0xAD, 0x92, 0xEB, 0x5E,
+    0x9F, 0x64, 0xFB, 0xD2, 0xF8, 0x6A, 0x6C, 0xBB, 0xB4, 0xB9, 0x45, 0x04, 0x21, 0x6F, 0x6D, 0xF7,
+    0xED, 0x47, 0x1D, 0x26, 0x35, 0x8A, 0x66, 0x18, 0xDD, 0x0E, 0x86, 0x35, 0xF0, 0x7A, 0x34, 0x97,
+    0xD3, 0xF4, 0xF2, 0x54, 0x74, 0xF5, 0x7F, 0xAE, 0x8D, 0x3E, 0x61, 0xE5, 0xE5, 0x40, 0x68, 0xA8,
+    0x4A, 0x72, 0x8D, 0x3E, 0x61, 0x7B, 0x54, 0x6B, 0x1D, 0x56, 0x20, 0x43, 0xC4, 0x9A, 0x61, 0xEF,
+    0xB7, 0xB6, 0x11, 0x1E, 0x55, 0xF7, 0x1B, 0x76, 0xBE, 0x62, 0x54, 0x0C, 0xF2, 0x9F, 0x4F, 0x7A,
+    0x93, 0x4C, 0x02, 0x23, 0xAB, 0x6E, 0x32, 0xA8, 0x77, 0xF7, 0xB4, 0x9A, 0xE1, 0xEB, 0x56, 0x77,
+    0x4E, 0x6F, 0xCF, 0x79, 0xC6, 0xB3, 0xE4, 0xE6, 0xDF, 0xED, 0xF2, 0xFC, 0x0C, 0x06, 0xD1, 0x0E,
+    0xA3, 0x2D, 0xA1, 0xDC, 0xC9, 0xB1, 0xF5, 0xFB, 0xBE, 0x97, 0xBE, 0xC3, 0x57, 0xBF, 0xF4, 0x5F,
+    0xC1, 0x57, 0x01, 0x0E, 0x24, 0x5E, 0xD7, 0x0B, 0x20, 0x4C, 0xEF, 0x6A, 0xEE, 0xF8, 0x9E, 0x92,
+    0x20, 0x2D, 0x62, 0x81, 0x9F, 0xD9, 0x33, 0x7E, 0xE1, 0x00, 0xB0, 0xDA, 0x13, 0xC3, 0xBB, 0x1C,
+    0xB1, 0xB2, 0xC2, 0xEF, 0x7E, 0x04, 0x0E, 0xD0, 0xF5, 0x74, 0x2E, 0xF4, 0x98, 0xFF, 0x0E, 0x43,
+    0x7D, 0x5F, 0x67, 0x8A, 0xF9, 0x04, 0x5B, 0x6F, 0x19, 0x90, 0xB5, 0x0C, 0x0D, 0x88, 0x3E, 0x73,
+    0xB1, 0xA0, 0x7E, 0xB0, 0x0D, 0xB4, 0xAA, 0x06, 0xCD, 0x16, 0x88, 0xA0, 0xD7, 0x20, 0x27, 0xCE,
+    0x91, 0x2E, 0xFB, 0xF5, 0x09, 0x45, 0xE2, 0x95, 0x55, 0x75, 0x4E, 0x41, 0x9B, 0x78, 0x65, 0x33,
+    0x32, 0x26, 0x43, 0xC7, 0x7C, 0x2C, 0x5B, 0xE4, 0x6E, 0xB4, 0x30, 0xC2, 0x90, 0x1A, 0x0D, 0x05,
+    0x15, 0x84, 0xC4, 0x77, 0xAE, 0x2A, 0xA7, 0x84, 0x18, 0xE3, 0x4C, 0xBE, 0x7F, 0xE1, 0xFD, 0xA9,
+    0x26, 0x67, 0xB2, 0x4E, 0x2B, 0x7E, 0xEA, 0xA5, 0x4B, 0x5F, 0x35, 0xA9, 0x2D, 0x0B, 0xF4, 0x07,
+    0x1F, 0x06, 0x76, 0x37, 0xE8, 0xFC, 0xDC, 0x1E, 0xAC, 0x5B, 0x93, 0x4F, 0xEB, 0xC1, 0x6A, 0x3F,
+    0xA5, 0x07, 0x6B, 0x87, 0x18, 0xCA, 0xBB, 0xA2, 0xBC, 0x23, 0x19, 0x8C, 0x30, 0x25, 0x13, 0x69,
+    0x73, 0x8A, 0xD4, 0xAA, 0xCB, 0x81, 0xA6, 0x42, 0xC7, 0xAE, 0x99, 0x42, 0x1B, 0xE1, 0xB7, 0xBB,
+    0x66, 0x8A, 0x9C, 0x82, 0xA0, 0xFA, 0x66, 0x8A, 0xDD, 0xAE, 0xBF, 0xFE, 0x26, 0xAB, 0x1C, 0x2C,
+    0x59, 0xD6, 0xE8, 0x2F, 0x58, 0x79, 0xC5, 0x8B, 0xB0, 0x75, 0x0F, 0xC0, 0x26, 0x43, 0x23, 0x26,
+    0xB9, 0x98, 0xA9, 0xDB, 0xEF, 0x30, 0xBE, 0xD6, 0xA3, 0x13, 0xF5, 0x93, 0xB0, 0xB9, 0xD4, 0x39,
+    0x1F, 0xD1, 0x13, 0x80, 0x8B, 0x08, 0xA3, 0xEA, 0xC4, 0x8B, 0x20, 0x02, 0x05, 0x93, 0x3B, 0xC6,
+    0xBD, 0x95, 0x41, 0xAE, 0x0D, 0xEA, 0x15, 0x8B, 0xB8, 0xEE, 0xA0, 0xF4, 0xA0, 0x03, 0xC8, 0x49,
+    0xD7, 0xEA, 0x43, 0xDE, 0xD7, 0xBE, 0xDA, 0x74, 0x71, 0x31, 0x5A, 0x3A, 0xCD, 0xEF, 0x80, 0x1E,
+    0x17, 0x68, 0x2B, 0x8A, 0x9C, 0x2C, 0xBD, 0x17, 0x46, 0x1B, 0xA6, 0x75, 0xF6, 0xB2, 0xCF, 0xDC,
+    0xE8, 0x62, 0xE8, 0x01, 0x28, 0x79, 0x37, 0x06, 0x5D, 0x90, 0xD6, 0x34, 0x81, 0x12, 0xF9, 0x96,
+    0xA5, 0x45, 0x67, 0x48, 0x47, 0x55, 0xA1, 0x8D, 0x7C, 0x37, 0x70, 0x06, 0xAD, 0xAC, 0x6C, 0xD9,
+    0xCE, 0xC8, 0x9C, 0x74, 0x15, 0xD1, 0x64, 0x22, 0xA4, 0x17, 0x99, 0x48, 0x5B, 0x4C, 0xA4, 0xD5,
+    0xCF, 0xBE, 0xE9, 0x73, 0xCA, 0x4C, 0x5D, 0x0E, 0x4C, 0x42, 0xA6, 0x4D, 0xF2, 0x71, 0x5D, 0x56,
+    0xA8, 0x29, 0xB7, 0x2D, 0xDA, 0x8B, 0x19, 0x0C, 0xFA, 0xAA, 0xB5, 0x43, 0xF9, 0x0E, 0x72, 0xB0,
+    0xA0, 0xA2, 0x28, 0x58, 0x67, 0xBD, 0xA2, 0xA1, 0xAD, 0x68, 0x08, 0x15, 0x4D, 0xE2, 0x0B, 0x26,
+    0xD2, 0x16, 0x72, 0xA2, 0xEA, 0x22, 0xDD, 0xD6, 0x94, 0x4B, 0x45, 0xCE, 0x72, 0x51, 0x54, 0x2C,
+    0x6D, 0x2E, 0x07, 0xB4, 0xCB, 0x1C, 0xBA, 0xD6, 0x75, 0xBF, 0x93, 0x4E, 0x9C, 0xFC, 0x5D, 0x13,
+    0x63, 0x78, 0xEA, 0xD6, 0xB7, 0x76, 0x76, 0xD6, 0x7D, 0x03, 0x19, 0x5B, 0x71, 0x6B, 0x5C, 0x37,
+    0x49, 0x28, 0x29, 0x3A, 0x7F, 0x71, 0x39, 0x24, 0xA1, 0x51, 0xED, 0x30, 0xB6, 0x3A, 0x9E, 0x47,
+    0x98, 0x6F, 0x43, 0xF2, 0x56, 0x34, 0xC8, 0x1B, 0x27, 0x2D, 0x72, 0xA2, 0x2C, 0xCA, 0x2B, 0x4B,
+    0x6A, 0x95, 0x45, 0xD7, 0xE9, 0x0D, 0xA7, 0x8D, 0x8E, 0x13, 0x8D, 0xA6, 0xCA, 0xD0, 0x94, 0x39,
+    0x9A, 0xA2, 0x44, 0x53, 0x95, 0xA4, 0x1F, 0xB4, 0x15, 0xC9, 0x3D, 0xB0, 0xA0, 0x46, 0x8C, 0x27,
+    0xC2, 0x33, 0x8E, 0x2E, 0x67, 0x58, 0xEF, 0x95, 0x4E, 0x5B, 0x28, 0x44, 0x00, 0x65, 0x57, 0x80,
+    0x46, 0x59, 0xD0, 0xBF, 0x3B, 0x5B, 0x5B, 0x25, 0xC6, 0x18, 0xD1, 0x1B, 0xB7, 0x36, 0x5E, 0x13,
+    0x41, 0x03, 0x79, 0x97, 0xE7, 0x74, 0x9B, 0x2B, 0x5A, 0x90, 0x56, 0x5B, 0xA8, 0x38, 0x0B, 0x69,
+    0x9D, 0xC4, 0xB1, 0x69, 0x51, 0x31, 0xEC, 0x6E, 0x80, 0xFA, 0x8A, 0xC9, 0x19, 0xCD, 0xA4, 0x1B,
+    0xFC, 0xF3, 0xBA, 0x50, 0x0E, 0x65, 0x27, 0xB0, 0xAE, 0x21, 0x8D, 0x71, 0x46, 0x8C, 0xD1, 0x76,
+    0x8C, 0x6C, 0x09, 0x79, 0xE2, 0x3B, 0x50, 0xB6, 0x60, 0xFE, 0x87, 0xF2, 0xAE, 0xA6, 0x4F, 0xB9,
+    0xB3, 0x71, 0xC3, 0xC1, 0x8A, 0x87, 0xEF, 0x78, 0x08, 0x81, 0xC4, 0x07, 0xD4, 0x0F, 0x02, 0x3A,
+    0xB6, 0x64, 0x97, 0x26, 0x14, 0xC5, 0x3A, 0xCD, 0x7A, 0x41, 0x58, 0x2F, 0xA4, 0xDB, 0x2A, 0x94,
+    0x0D, 0xA5, 0x36, 0x21, 0x1F, 0x08, 0xBF, 0x54, 0x24, 0x3E, 0xEB, 0x5A, 0x96, 0x3C, 0x22, 0x42,
+    0x11, 0x48, 0x5F, 0x85, 0xD0, 0x32, 0xBC, 0x60, 0x54, 0x9C, 0xF0, 0xD1, 0x5B, 0x36, 0x3F, 0x5A,
+    0xC8, 0xAB, 0x57, 0x6D, 0x53, 0x94, 0x99, 0x7A, 0xF9, 0x9A, 0xDB, 0xCA, 0x09, 0x68, 0x54, 0xCD,
+    0x8C, 0x1C, 0xD5, 0xD2, 0xB2, 0xE2, 0xA5, 0x4D, 0xFE, 0xD4, 0x66, 0x68, 0x4D, 0x43, 0x53, 0xC8,
+    0xF7, 0xFE, 0xCE, 0x0F, 0x5A, 0x1D, 0x63, 0x74, 0x2B, 0xAF, 0xDF, 0xBE, 0xF1, 0x52, 0xD0, 0x3A,
+    0x4B, 0xEB, 0xE6, 0x78, 0x51, 0xCA, 0xCB, 0x3E, 0x84, 0x95, 0xF4, 0xC4, 0xB5, 0xCB, 0xA1, 0xD0,
+    0x27, 0xB5, 0x09, 0x79, 0xB3, 0xAD, 0xEA, 0xD1, 0x35, 0x9B, 0x8B, 0xC0, 0x2A, 0xAB, 0x34, 0xCC,
+    0x29, 0x19, 0xD5, 0x9A, 0x22, 0x28, 0xBB, 0x5C, 0x08, 0xAF, 0x35, 0xE3, 0x18, 0xDD, 0x30, 0xC6,
+    0x89, 0x96, 0xDF, 0xFF, 0xB2, 0xBA, 0x72, 0xFD, 0xEA, 0x15, 0x1F, 0x42, 0x68, 0xDB, 0xA2, 0x28,
+    0xAA, 0xA5, 0xF4, 0xB9, 0x32, 0x7D, 0xD6, 0x33, 0x88, 0x31, 0x10, 0x63, 0xB4, 0x89, 0xE7, 0x0C,
+    0xD2, 0x4A, 0x47, 0x5A, 0xF7, 0xAC, 0x36, 0x79, 0x09, 0x0C, 0x3D, 0x64, 0xB1, 0x25, 0xB9, 0xF5,
+    0x71, 0x20, 0x4B, 0xCF, 0x39, 0xDA, 0x32, 0xAD, 0x95, 0x6D, 0x97, 0x28, 0xA5, 0xAD, 0x44, 0xC8,
+    0x44, 0xD0, 0xA6, 0x51, 0xB6, 0x92, 0x2E, 0x93, 0x5E, 0x53, 0xC0, 0xA3, 0x6B, 0x6B, 0xE8, 0x18,
+    0x5D, 0xF2, 0xDE, 0x97, 0x3C, 0x85, 0xF4, 0xA8, 0x73, 0x0E, 0x3E, 0x76, 0x30, 0x9E, 0x90, 0xDC,
+    0xBE, 0x61, 0x45, 0x08, 0x2D, 0x6D, 0xB1, 0x44, 0xB5, 0xA4, 0x6C, 0x91, 0xD6, 0x21, 0x4F, 0x5C,
+    0xA1, 0x09, 0xDA, 0x10, 0xB2, 0x18, 0x5B, 0x55, 0x8F, 0x63, 0xB4, 0xB9, 0x08, 0x9C, 0xA5, 0x95,
+    0x4E, 0x7A, 0x69, 0x95, 0x5D, 0x21, 0x43, 0x9F, 0xF0, 0x34, 0x64, 0x39, 0xF2, 0xBD, 0xB5, 0x51,
+    0x40, 0xC7, 0x18, 0x27, 0xAC, 0xBC, 0x7E, 0xEB, 0x56, 0x2B, 0x82, 0xFE, 0xC2, 0x15, 0x9F, 0xD6,
+    0x4D, 0xA6, 0x6C, 0x29, 0x6D, 0xA3, 0xE9, 0x7B, 0x0E, 0x83, 0x26, 0x64, 0xA9, 0xAD, 0xA4, 0x6D,
+    0xCA, 0xC4, 0x6B, 0xF9, 0x66, 0x48, 0x4D, 0x09, 0xAB, 0x6B, 0x6B, 0x6B, 0x89, 0x8F, 0x71, 0x2E,
+    0xDD, 0xC5, 0xB5, 0x89, 0xB4, 0x45, 0xE2, 0x95, 0xCD, 0xD2, 0x5A, 0xD5, 0xE9, 0x57, 0x49, 0x63,
+    0x9C, 0xA3, 0xE3, 0xED, 0xDB, 0x56, 0xCB, 0x37, 0xDF, 0xF4, 0x59, 0x7A, 0xCE, 0x86, 0x3C, 0x93,
+    0x36, 0x94, 0xA5, 0xAA, 0x43, 0x51, 0xA5, 0xA6, 0x2D, 0xDA, 0xD4, 0x74, 0x3F, 0x99, 0xB0, 0x3F,
+    0xB5, 0x2C, 0x37, 0x30, 0xAC, 0x79, 0x3C, 0x1A, 0x19, 0xA3, 0x49, 0xCD, 0xB0, 0x6F, 0xF5, 0xE8,
+    0x01, 0xA4, 0x12, 0x1E, 0x77, 0x8C, 0x27, 0x24, 0x17, 0xDA, 0x0E, 0xC8, 0x4D, 0xEE, 0xC2, 0x9F,
+    0x26, 0x90, 0x39, 0xF1, 0xE2, 0x8C, 0x51, 0xAC, 0xD5, 0x7B, 0xA6, 0xC3, 0xC1, 0x84, 0x11, 0x31,
+    0x7A, 0x31, 0xEE, 0x03, 0xCC, 0xDE, 0xA4, 0x26, 0x4C, 0x91, 0x33, 0x18, 0xD5, 0x8C, 0x22, 0xEA,
+    0x6F, 0x4F, 0xBA, 0x6A, 0xA3, 0xD9, 0x49, 0x00, 0x06, 0x93, 0xAE, 0x5C, 0xC8, 0x3A, 0x48, 0xE1,
+    0x0C, 0x62, 0x5C, 0xA7, 0xF1, 0xBC, 0xFC, 0xA8, 0xA3, 0x00, 0xDF, 0x5B, 0x23, 0x8B, 0x2D, 0x8F,
+    0xFE, 0xBA, 0x51, 0x75, 0xCE, 0x56, 0x4E, 0x2B, 0x5D, 0x2B, 0x9D, 0x96, 0x56, 0x53, 0x65, 0x54,
+    0x89, 0x6F, 0x12, 0xAF, 0x4F, 0x78, 0x6D, 0x0A, 0x6D, 0x0A, 0x11, 0x4A, 0x11, 0x74, 0x3D, 0x49,
+    0x6D, 0x25, 0xDA, 0x5C, 0x39, 0x39, 0x9F, 0xCF, 0x48, 0x62, 0xAC, 0xFB, 0x9D, 0xDF, 0x4D, 0xC7,
+    0x63, 0x77, 0x8E, 0xB8, 0x0F, 0x3A, 0xCB, 0xFD, 0xA7, 0x82, 0x9D, 0xDF, 0xB8, 0x58, 0xA4, 0x3D,
+    0xA8, 0x4D, 0x58, 0xD6, 0x84, 0x5C, 0x0B, 0x9F, 0x67, 0x89, 0x5F, 0xCE, 0xA5, 0x2B, 0x4B, 0x69,
+    0x8B, 0x42, 0xD9, 0xA2, 0x50, 0x75, 0x53, 0xA5, 0xA6, 0xAD, 0x74, 0xE2, 0x57, 0x74, 0x6A, 0x07,
+    0x37, 0xC6, 0xA8, 0xD8, 0xD1, 0x86, 0x9F, 0xB8, 0x55, 0xDF, 0x03, 0xF4, 0xE7, 0xEA, 0x1F, 0x89,
+    0x31, 0x5E, 0x8D, 0x31, 0xFE, 0x79, 0xFB, 0x47, 0xEE, 0x34, 0x8C, 0xE4, 0x5D, 0xC3, 0xC8, 0x28,
+    0xC6, 0x71, 0x8C, 0x2D, 0xF9, 0xFD, 0x0D, 0x23, 0x5B, 0x88, 0xB9, 0x27, 0xFB, 0xB8, 0xA6, 0xCD,
+    0x48, 0xEB, 0x82, 0x82, 0x90, 0x78, 0x69, 0x35, 0x9A, 0x86, 0x52, 0x3A, 0xB6, 0x06, 0x24, 0xBE,
+    0x45, 0xBD, 0x62, 0x59, 0x2A, 0xE1, 0x4C, 0x80, 0xDB, 0x06, 0x39, 0xED, 0xA0, 0xEC, 0x61, 0x07,
+    0x81, 0x2F, 0x93, 0x7D, 0xBF, 0xD6, 0xCF, 0xF8, 0xB4, 0xAE, 0xA4, 0xCD, 0x12, 0x2F, 0x6D, 0x20,
+    0x54, 0x14, 0x25, 0xFA, 0x24, 0xC9, 0x3B, 0x86, 0xEF, 0x5A, 0x32, 0x87, 0xEA, 0xDD, 0x5E, 0x55,
+    0x74, 0x3D, 0x2A, 0x21, 0x20, 0x9C, 0x03, 0x48, 0x0D, 0xD9, 0x4F, 0x10, 0x71, 0x1D, 0xFD, 0x4C,
+    0xA0, 0x91, 0x56, 0x5A, 0x4D, 0x4E, 0x41, 0x20, 0xA4, 0xB5, 0x74, 0x25, 0xE9, 0xB3, 0x81, 0x5C,
+    0x1B, 0xD6, 0x2B, 0xC4, 0x75, 0x87, 0x7A, 0x07, 0xF4, 0x56, 0xB7, 0x8B, 0x72, 0xD6, 0xE1, 0xAE,
+    0x40, 0x9E, 0x21, 0xAF, 0x3A, 0xD6, 0x0B, 0x52, 0x65, 0xBA, 0x7C, 0xEA, 0x7F, 0x70, 0x62, 0xDA,
+    0xD0, 0x2E, 0xD1, 0x28, 0x5B, 0x88, 0x90, 0x53, 0x68, 0xB4, 0xB2, 0xF2, 0xAA, 0xE3, 0xA3, 0xC0,
+    0x72, 0x4B, 0xBA, 0x8D, 0x98, 0xC1, 0xE8, 0x2E, 0xF7, 0x3F, 0x9A, 0xF4, 0x3B, 0x79, 0x5A, 0x00,
+    0xED, 0x74, 0x07, 0xB7, 0x75, 0x20, 0xF0, 0x36, 0x49, 0x58, 0x65, 0x51, 0x1B, 0x74, 0x5A, 0xCB,
+    0x37, 0x02, 0x84, 0x75, 0xAA, 0x1C, 0xB4, 0xB2, 0xFA, 0x84, 0x83, 0x50, 0x24, 0xA1, 0x84, 0x4C,
+    0xDA, 0x42, 0x5A, 0x92, 0x50, 0xA4, 0x75, 0x01, 0x2B, 0x89, 0x0B, 0xD2, 0xA1, 0xDC, 0x72, 0xCE,
+    0x0A, 0x4C, 0xC5, 0x75, 0x9B, 0x04, 0x06, 0x2C, 0x35, 0x68, 0x9B, 0x3A, 0x6E, 0xC0, 0xE8, 0x46,
+    0x8B, 0xEE, 0xBC, 0x0A, 0x3B, 0x7B, 0x58, 0xCD, 0xCE, 0x0F, 0x47, 0xEC, 0xB6, 0xFF, 0xF5, 0x9B,
+    0x2B, 0xE8, 0x48, 0x03, 0xFA, 0x64, 0x82, 0xC7, 0xCC, 0x22, 0xAC, 0x66, 0xD1, 0x34, 0x94, 0xE9,
+    0x7B, 0xDB, 0xAA, 0x56, 0x97, 0x5B, 0xE9, 0x2B, 0xDA, 0x15, 0x32, 0x69, 0x33, 0x69, 0x45, 0x28,
+    0xA4, 0xAB, 0xC8, 0xA4, 0x6B, 0xD2, 0x3A, 0xF1, 0xCB, 0x9A, 0x96, 0x95, 0xE4, 0x47, 0x5E, 0x1B,
+    0x69, 0x97, 0x0A, 0x1A, 0x1A, 0xF1, 0x41, 0xAD, 0x6C, 0xC6, 0xFE, 0xC0, 0xE0, 0x82, 0x63, 0x06,
+    0x63, 0x4F, 0xCF, 0xA7, 0xB4, 0x3B, 0x1D, 0xA4, 0x3B, 0x76, 0x02, 0x93, 0xAE, 0xC9, 0xA1, 0x9B,
+    0xA9, 0x7A, 0x87, 0x71, 0xD4, 0x16, 0x5E, 0xBC, 0x09, 0x31, 0x7A, 0x66, 0x67, 0x2E, 0x31, 0x25,
+    0xB5, 0xDB, 0xDD, 0xEF, 0x1D, 0xAC, 0x64, 0x90, 0xBE, 0x5A, 0x93, 0x5C, 0x77, 0xD0, 0xB4, 0xB0,
+    0x52, 0x74, 0x1B, 0x15, 0xD4, 0x55, 0x87, 0x0C, 0x13, 0x44, 0x3B, 0x80, 0x89, 0xFC, 0xE9, 0xBB,
+    0x53, 0x46, 0x71, 0xDA, 0x91, 0x8B, 0x59, 0xDD, 0x35, 0xED, 0xB1, 0xC7, 0xA0, 0x02, 0x59, 0xAC,
+    0x07, 0x97, 0x26, 0x99, 0xC9, 0x74, 0x2D, 0xAF, 0x59, 0xFE, 0xCC, 0x53, 0x36, 0xE8, 0x12, 0xF5,
+    0xC7, 0x26, 0xF9, 0x91, 0xA7, 0xAD, 0x9E, 0x98, 0xA4, 0x71, 0xCA, 0xB8, 0x45, 0xFA, 0x7E, 0x37,
+    0xB6, 0xF8, 0xFD, 0x0E, 0xA7, 0x58, 0x05, 0xC2, 0xC0, 0x82, 0xC8, 0x76, 0xCD, 0x1B, 0x36, 0x01,
+    0xF6, 0xDD, 0xE1, 0x03, 0x67, 0x7B, 0xE6, 0x88, 0x38, 0x19, 0x44, 0x74, 0x5D, 0x1F, 0x59, 0x61,
+    0x02, 0x54, 0xCA, 0x02, 0x61, 0x05, 0x90, 0x97, 0x03, 0xA0, 0x53, 0x0B, 0x54, 0x2B, 0x80, 0x08,
+    0x2D, 0x5D, 0x1D, 0xDA, 0x52, 0x76, 0x89, 0x7E, 0x41, 0x46, 0x6A, 0x5B, 0x1A, 0x4A, 0xE9, 0xA5,
+    0x93, 0x3E, 0x75, 0x03, 0x3B, 0x44, 0xDF, 0x8E, 0x31, 0x90, 0xCE, 0xF5, 0x5D, 0x9D, 0x5A, 0xA3,
+    0x1A, 0xF4, 0x05, 0x4F, 0x72, 0x79, 0xD0, 0xCF, 0xA8, 0xAC, 0x81, 0xD3, 0xC0, 0x5E, 0x76, 0xAC,
+    0xF9, 0xB7, 0x18, 0x4C, 0x07, 0x93, 0xF4, 0x3D, 0xF3, 0x7B, 0x6F, 0xB4, 0x90, 0xAF, 0x40, 0xF2,
+    0x33, 0x0B, 0xD9, 0x36, 0x24, 0x1F, 0xD4, 0xFB, 0xC8, 0x5B, 0x11, 0xE4, 0x3B, 0x75, 0x4E, 0xD5,
+    0x48, 0xA7, 0x5F, 0xB1, 0x65, 0x12, 0x86, 0x17, 0xE6, 0x33, 0xE2, 0xDB, 0xF1, 0x9E, 0x1F, 0x3F,
+    0x50, 0x31, 0xD6, 0xF0, 0xF0, 0xC3, 0x87, 0xEE, 0x19, 0x0D, 0xE4, 0x24, 0xD7, 0x2D, 0x2D, 0xFA,
+    0x24, 0xD2, 0x51, 0x54, 0x68, 0x23, 0x3E, 0x0C, 0x94, 0xE8, 0x57, 0xAC, 0x68, 0x29, 0x32, 0xB4,
+    0x4B, 0x42, 0xC5, 0xC8, 0xE8, 0x67, 0x82, 0x9C, 0x51, 0x29, 0x9B, 0xB7, 0xD2, 0x6B, 0x7E, 0xE6,
+    0x35, 0x65, 0xFA, 0xC5, 0xBA, 0xA1, 0xAD, 0x32, 0x65, 0xE5, 0x75, 0x5B, 0x95, 0xA4, 0x3F, 0xE4,
+    0xA3, 0x40, 0x16, 0xE4, 0x0D, 0x18, 0xD6, 0xAA, 0x85, 0xED, 0x1D, 0x7D, 0xED, 0xB6, 0xC6, 0x43,
+    0x7A, 0xF2, 0xCB, 0xB0, 0xB0, 0xB0, 0xF0, 0x40, 0xB3, 0xC7, 0xBF, 0xE8, 0xA6, 0xD7, 0x68, 0xD0,
+    0xD3, 0x9E, 0xAD, 0xA9, 0xEF, 0xA1, 0x4B, 0x32, 0xE0, 0xB1, 0xF3, 0x2A, 0xBA, 0x4B, 0xBF, 0x26,
+    0x1D, 0x2B, 0xF7, 0x6C, 0x0F, 0xE8, 0x37, 0xC5, 0x31, 0xFC, 0x09, 0x83, 0x16, 0x69, 0xD1, 0x77,
+    0xEF, 0x63, 0x80, 0xBD, 0x20, 0x3C, 0xE7, 0x0B, 0xF4, 0xF7, 0x0D, 0x83, 0x00, 0x43, 0x83, 0x8A,
+    0x86, 0xB0, 0x7D, 0x6C, 0x09, 0xF5, 0xB1, 0x25, 0x9D, 0x40, 0xE6, 0x91, 0x37, 0x1C, 0xEB, 0x87,
+    0xD1, 0xC0, 0x6B, 0x3B, 0x71, 0xE1, 0x4F, 0x36, 0x2E, 0xCE, 0x37, 0x7E, 0xAD, 0x33, 0xBC, 0xC9,
+    0xF8, 0x4F, 0xFE, 0x83, 0xD9, 0x7B, 0x60, 0x7B, 0xF3, 0xD8, 0xDE, 0x83, 0xE5, 0xE1, 0xA3, 0x2F,
+    0x80, 0x98, 0x9B, 0x95, 0xF8, 0x2F, 0x38, 0x03, 0xFC, 0xB7, 0xFD, 0xDB, 0xF7, 0x3E, 0xC3, 0x6D,
+    0xF6, 0xDB, 0xBB, 0x76, 0x6C, 0x72, 0xB1, 0x43, 0x0F, 0xE4, 0x1C, 0xF1, 0x86, 0x83, 0xAD, 0x53,
+    0x1C, 0x5C, 0xDC, 0x39, 0xFF, 0x0B, 0xFE, 0xB2, 0x00, 0x10, 0x4F, 0xFC, 0x5E, 0x0D, 0x2C, 0xFF,
+    0xF6, 0x91, 0xBD, 0x40, 0x42, 0xFD, 0x8B, 0xBF, 0xA4, 0x7C, 0xC7, 0x8D, 0x7D, 0x60, 0xE1, 0x6B,
+    0x81, 0x27, 0x1F, 0x82, 0x87, 0xE4, 0x9D, 0xAD, 0x72, 0x24, 0x7D, 0xD8, 0xEB, 0x93, 0xD7, 0x87,
+    0xD5, 0xBD, 0x5F, 0xEF, 0x09, 0xEA, 0x1E, 0x08, 0xEA, 0x39, 0xE9, 0x02, 0xE0, 0x14, 0x55, 0x07,
+    0x7E, 0xFC, 0x06, 0xAA, 0x9B, 0xDB, 0x71, 0x07, 0x38, 0xF5, 0xF0, 0xE4, 0x2F, 0x96, 0x6B, 0x6E,
+    0x00, 0xE5, 0x06, 0x0E, 0x50, 0x73, 0xD1, 0x35, 0x56, 0xFE, 0xC2, 0x6F, 0x24, 0x9D, 0x73, 0xC8,
+    0x3A, 0x00, 0xF4, 0x12, 0x7D, 0x19, 0xBE, 0xDC, 0x09, 0x55, 0x74, 0x22, 0x16, 0x3B, 0x3F, 0x6B,
+    0x42, 0x27, 0xE2, 0x6E, 0x42, 0xAE, 0xA1, 0x49, 0x6B, 0x74, 0xB4, 0xB0, 0x61, 0x76, 0x1A, 0x18,
+    0xDA, 0xB4, 0x66, 0x96, 0x38, 0x22, 0x81, 0xB1, 0x2D, 0x38, 0xE3, 0x33, 0x8A, 0x26, 0xAD, 0xCB,
+    0x52, 0xBA, 0x5C, 0x13, 0x32, 0x69, 0x0B, 0x2D, 0xFC, 0x92, 0x36, 0x5B, 0xE9, 0x17, 0xEB, 0x52,
+    0x7E, 0xCF, 0x6A, 0x3E, 0xB6, 0xCA, 0x8E, 0x9C, 0xF0, 0x99, 0x67, 0x2B, 0xF5, 0x0C, 0xAF, 0x05,
+    0x74, 0x00, 0xB6, 0xFA, 0xC7, 0x97, 0xBD, 0x5F, 0xDE, 0x67, 0x20, 0x48, 0x5B, 0x48, 0x97, 0x46,
+    0xCF, 0x8B, 0xE7, 0x3F, 0x4B, 0xD3, 0xC8, 0x8B, 0x57, 0xE2, 0x73, 0x01, 0x4E, 0x43, 0x01, 0x4B,
+    0xA0, 0x61, 0x8F, 0x21, 0x20, 0x3C, 0x8F, 0xDF, 0xAA, 0x87, 0xD1, 0x7E, 0xEE, 0x07, 0x3B, 0x40,
+    0xE7, 0x37, 0xD0, 0xD1, 0xEB, 0xD7, 0x27, 0x19, 0xDB, 0x39, 0x65, 0x49, 0x59, 0x50, 0x16, 0x6C,
+    0x57, 0x7B, 0xDA, 0x71, 0x74, 0xF1, 0x26, 0x49, 0x8F, 0x54, 0xE8, 0xE8, 0x06, 0xEF, 0xEF, 0x76,
+    0xE2, 0xEF, 0xEE, 0x2B, 0x88, 0x7E, 0x18, 0x3F, 0x0C, 0xEA, 0x2D, 0x9B, 0x7E, 0x99, 0xB2, 0x12,
+    0x61, 0x3E, 0x36, 0x5D, 0x90, 0xDD, 0x6D, 0x64, 0xAC, 0xEF, 0x6D, 0x64, 0x6C, 0x8A, 0x89, 0x7E,
+    0x36, 0x12, 0xA3, 0xCD, 0x62, 0x9B, 0x78, 0x65, 0x4B, 0x8E, 0xDC, 0xB5, 0x53, 0xB4, 0xC7, 0x1E,
+    0xFF, 0x7F, 0xBD, 0x9B, 0x5F, 0x8C, 0x1D, 0xD7, 0x7D, 0xDF, 0x3F, 0x67, 0x0E, 0xC9, 0x91, 0x78,
+    0xC4, 0x3D, 0x44, 0x20, 0x25, 0xB6, 0xC5, 0xDD, 0xE9, 0x83, 0x1F, 0x04, 0x79, 0xF7, 0x5E, 0x3F,
+    0x30, 0xC5, 0x36, 0x99, 0xD9, 0x7B, 0x44, 0x02, 0x15, 0x50, 0xA2, 0xF5, 0xA2, 0xD0, 0xDA, 0x40,
+    0x83, 0x56, 0x46, 0xD1, 0x87, 0xC6, 0x35, 0x42, 0xA2, 0x60, 0xD1, 0x75, 0x30, 0xE4, 0x8E, 0xC4,
+    0x07, 0xA1, 0x70, 0x11, 0xB3, 0x46, 0xEC, 0x3E, 0x04, 0x41, 0xF9, 0xA0, 0xB6, 0x2E, 0x5D, 0x80,
+    0x1B, 0x63, 0x8D, 0xDC, 0xC4, 0x2B, 0xDE, 0x43, 0x12, 0xA8, 0x80, 0xAA, 0x80, 0x47, 0x92, 0x05,
+    0x03, 0x75, 0x12, 0x1F, 0xDB, 0x12, 0x92, 0x90, 0xAD, 0x75, 0x24, 0x8E, 0xAC, 0x4B, 0xF2, 0xEE,
+    0xFD, 0xF5, 0x61, 0xE6, 0xEE, 0xAE, 0x68, 0xC9, 0x8E, 0x1D, 0xBB, 0x03, 0x72, 0x77, 0xE7, 0xEF,
+    0xF9, 0x9E, 0x7F, 0xBF, 0xF3, 0xFD, 0x7D, 0x7F, 0xBF, 0xC3, 0xD1, 0x8F, 0x90, 0xBC, 0x28, 0xD8,
+    0xCF, 0x6D, 0x30, 0x70, 0xB9, 0x1A, 0x13, 0x53, 0xAF, 0x7D, 0x0F, 0x4B, 0x43, 0xA9, 0x7D, 0x12,
+    0x33, 0x65, 0xDD, 0x76, 0x5E, 0xEA, 0xF1, 0x46, 0x6D, 0xCF, 0x4F, 0xC9, 0x37, 0xA2, 0x8A, 0x49,
+    0x6D, 0x2A, 0x5D, 0x15, 0x40, 0x04, 0xED, 0x61, 0x01, 0x00, 0x55, 0x41, 0xD1, 0x5E, 0xC8, 0x11,
+    0xA9, 0x32, 0x69, 0x92, 0xB0, 0x7B, 0xA9, 0x04, 0x53, 0x41, 0x03, 0xD6, 0x41, 0x84, 0x0C, 0xF6,
+    0xDD, 0xCE, 0x21, 0xF5, 0x30, 0x6C, 0x6F, 0xC3, 0x01, 0x28, 0x20, 0x87, 0x92, 0xB5, 0x61, 0x22,
+    0x8D, 0x7E, 0x6D, 0x55, 0x7B, 0x52, 0x4F, 0x5A, 0x61, 0x1C, 0xD6, 0x61, 0x21, 0x83, 0xDE, 0xEC,
+    0xB9, 0x1C, 0x18, 0x48, 0x48, 0x65, 0x67, 0xF6, 0x91, 0xF7, 0x94, 0xD1, 0x17, 0xAF, 0x65, 0xB2,
+    0xBF, 0x8C, 0x08, 0x16, 0x54, 0x84, 0x1E, 0xE8, 0x1A, 0x58, 0x7B, 0xCA, 0x48, 0x58, 0x59, 0x23,
+    0x92, 0x7A, 0x7A, 0x1C, 0x9A, 0x5E, 0x1C, 0x48, 0x65, 0xA1, 0x24, 0x09, 0x58, 0x47, 0x0E, 0x11,
+    0x10, 0xA9, 0x36, 0x24, 0xF4, 0xC0, 0x3A, 0xB4, 0x47, 0x45, 0x18, 0xC2, 0x12, 0xD8, 0xA9, 0xD3,
+    0x32, 0x51, 0x31, 0xF3, 0x43, 0xC6, 0x05, 0x7D, 0x4B, 0x7A, 0xC3, 0xF3, 0x56, 0x24, 0x1F, 0x92,
+    0x15, 0x18, 0x8F, 0x0E, 0xA8, 0x06, 0x26, 0xA8, 0x89, 0xBE, 0x35, 0x41, 0xC6, 0xC0, 0xFD, 0x05,
+    0x2F, 0xC0, 0xD5, 0xA0, 0xA5, 0xB1, 0x4F, 0xC6, 0x52, 0xBF, 0x12, 0xCC, 0x17, 0x5C, 0x2F, 0x67,
+    0x18, 0x5B, 0x08, 0x25, 0x3A, 0xD0, 0x57, 0xD2, 0xE8, 0x29, 0x00, 0x39, 0x39, 0x05, 0x7D, 0x72,
+    0xC6, 0x58, 0x57, 0xEA, 0x80, 0xF1, 0x43, 0xEB, 0xD1, 0xF5, 0x56, 0x1F, 0x92, 0x18, 0xB7, 0x81,
+    0xE6, 0xED, 0x08, 0xBC, 0xF0, 0xAE, 0x07, 0x06, 0xE2, 0x80, 0xD1, 0x9B, 0x40, 0x72, 0xFB, 0x9B,
+    0x0E, 0xCC, 0x8D, 0x17, 0x3D, 0x64, 0x4F, 0x5E, 0xA8, 0xE1, 0x9C, 0x79, 0x22, 0xC2, 0xD8, 0xBA,
+    0x06, 0x1D, 0x2C, 0x25, 0xB6, 0xCA, 0x18, 0xD4, 0x03, 0x16, 0xC8, 0x3C, 0xB4, 0x3D, 0x05, 0x69,
+    0x05, 0x6D, 0x6F, 0xCE, 0x7A, 0xEB, 0x30, 0xC9, 0x25, 0x56, 0xD5, 0xF3, 0x76, 0xAC, 0xFD, 0x46,
+    0xF8, 0x95, 0xB8, 0x90, 0xBE, 0x8E, 0x0E, 0x5B, 0x2B, 0x60, 0x6E, 0x5C, 0x8F, 0x90, 0x59, 0xEB,
+    0xE0, 0xFC, 0xD5, 0x6D, 0x48, 0x44, 0x22, 0xD8, 0x53, 0xA7, 0x3C, 0xE4, 0x79, 0x06, 0x3A, 0xC4,
+    0x12, 0xFA, 0xBA, 0x6A, 0xF8, 0x58, 0xB3, 0x90, 0xDC, 0x7D, 0x46, 0xD8, 0x4A, 0xDA, 0xDA, 0x35,
+    0x7B, 0x65, 0x5A, 0x00, 0xD6, 0x01, 0xD4, 0x45, 0x00, 0x8C, 0xD4, 0x88, 0x54, 0x07, 0xD8, 0x06,
+    0x1D, 0x60, 0xA5, 0xED, 0xC5, 0x12, 0x4E, 0x63, 0xA6, 0x8E, 0xCF, 0x8C, 0xDB, 0xCE, 0xB7, 0xCC,
+    0x46, 0x5D, 0x12, 0x8F, 0x72, 0x55, 0x4F, 0xA5, 0xEA, 0x4B, 0x4D, 0xEA, 0x60, 0xB9, 0xFD, 0xFA,
+    0x3A, 0x8C, 0x40, 0x39, 0x50, 0xBF, 0xCD, 0x40, 0xDC, 0xF3, 0x1B, 0xB4, 0x7D, 0x6D, 0xAA, 0xFE,
+    0x18, 0xF1, 0x18, 0x8F, 0x75, 0x14, 0xA8, 0x78, 0x77, 0x74, 0x42, 0x1A, 0xE6, 0x61, 0x19, 0x22,
+    0x69, 0x95, 0x4C, 0x50, 0x0E, 0x22, 0x43, 0x15, 0x93, 0x98, 0x04, 0xE3, 0x75, 0xDD, 0x47, 0xFB,
+    0x6D, 0xD2, 0xEB, 0x11, 0xF3, 0x79, 0x8F, 0xF9, 0x4F, 0x60, 0xB7, 0xDB, 0xFF, 0x59, 0x01, 0xBD,
+    0x0C, 0x0A, 0x5B, 0x91, 0xEB, 0x9A, 0x3C, 0x89, 0x94, 0x8C, 0x19, 0xB2, 0xE1, 0x1B, 0x06, 0x15,
+    0x18, 0xD7, 0x02, 0xB6, 0x40, 0x06, 0x7C, 0x18, 0x56, 0x0F, 0xBA, 0x9E, 0x6A, 0x74, 0x7D, 0x8E,
+    0x3C, 0x73, 0xE9, 0x8B, 0x35, 0x7F, 0xD2, 0x60, 0x5E, 0x00, 0xF1, 0xD8, 0x02, 0xF5, 0x56, 0xA4,
+    0x67, 0x2A, 0x5D, 0x17, 0xE4, 0x4A, 0xB4, 0xB7, 0x7B, 0xE3, 0x39, 0x6F, 0x6B, 0xF7, 0xD1, 0xF7,
+    0xC2, 0x7B, 0xE5, 0x0A, 0xFA, 0xC6, 0x84, 0xF4, 0xC5, 0x0E, 0xDE, 0x69, 0xB0, 0x23, 0xB0, 0x57,
+    0x3B, 0x78, 0x7D, 0x28, 0x06, 0x15, 0xF9, 0xA0, 0x26, 0xFF, 0xD5, 0x19, 0xBC, 0x92, 0x86, 0x01,
+    0xAC, 0x2A, 0xD7, 0x3B, 0x3A, 0xD6, 0xDF, 0x59, 0x21, 0x1F, 0xB9, 0xF4, 0x9B, 0xF7, 0x43, 0xB9,
+    0x1D, 0xE9, 0x0D, 0x2A, 0xFD, 0xED, 0x82, 0xFC, 0x8F, 0xA2, 0xF6, 0xB6, 0x22, 0x32, 0x54, 0x21,
+    0x89, 0x8F, 0xDE, 0x31, 0xBE, 0x3F, 0xED, 0xF3, 0x6B, 0xDF, 0xDA, 0x6B, 0x17, 0x7B, 0xBA, 0x6B,
+    0x97, 0xE1, 0x7D, 0xED, 0x92, 0xFA, 0xAE, 0x5D, 0x9A, 0xAE, 0xE0, 0x95, 0x99, 0xF1, 0x30, 0x52,
+    0x23, 0x3B, 0x10, 0x61, 0x81, 0xA7, 0x92, 0x90, 0xB9, 0x22, 0xAD, 0xF5, 0xB5, 0x86, 0xF2, 0x1C,
+    0xE9, 0x17, 0x1C, 0xDF, 0xA8, 0xB1, 0x13, 0xB8, 0x1D, 0xC8, 0x32, 0x92, 0xB0, 0x4D, 0xA1, 0x83,
+    0xF6, 0x19, 0x39, 0x13, 0x36, 0xC6, 0xF4, 0xFA, 0x53, 0x06, 0x58, 0x37, 0x40, 0xFB, 0x01, 0x2A,
+    0xF6, 0x61, 0xBD, 0xDF, 0xD6, 0xD8, 0x9E, 0x06, 0xFD, 0x26, 0x28, 0xA9, 0x60, 0x18, 0xA1, 0xE8,
+    0x83, 0x3D, 0x59, 0xA3, 0x7D, 0x89, 0x8A, 0xB6, 0x62, 0x48, 0x43, 0x41, 0x1F, 0x8B, 0x0E, 0x3C,
+    0xB2, 0xC6, 0xC3, 0x83, 0xA9, 0x6A, 0x1E, 0x39, 0x97, 0xD6, 0xE4, 0x99, 0xA3, 0x2C, 0x60, 0xBD,
+    0x81, 0x6F, 0xD4, 0x20, 0x1E, 0x6E, 0xD7, 0xA8, 0xB7, 0x22, 0x49, 0x18, 0x92, 0xD4, 0x05, 0xDA,
+    0x67, 0x68, 0x6F, 0x3C, 0x11, 0x4B, 0x49, 0xEA, 0x7B, 0x24, 0xC1, 0x3A, 0x1A, 0xED, 0xC9, 0x55,
+    0xC4, 0x32, 0x24, 0xF5, 0xBD, 0xB5, 0x4F, 0x06, 0x2B, 0xD2, 0xE8, 0x9B, 0x97, 0xB7, 0x55, 0x24,
+    0x63, 0x88, 0xA9, 0x0A, 0x92, 0xDA, 0xB2, 0xFB, 0x64, 0xC6, 0x10, 0x33, 0x2E, 0xD0, 0xD3, 0x6E,
+    0xEE, 0x69, 0xDF, 0x9A, 0x61, 0xD6, 0xBB, 0xD1, 0xC2, 0xAA, 0xA9, 0xB4, 0x2F, 0xC8, 0x88, 0x0C,
+    0x53, 0xAF, 0xEB, 0x05, 0x2C, 0x23, 0x99, 0x68, 0x91, 0x68, 0x31, 0x55, 0x49, 0x91, 0x04, 0xA2,
+    0x75, 0xA9, 0xCF, 0xC9, 0xEA, 0xC8, 0xC8, 0x41, 0xDE, 0x1A, 0xC2, 0xB4, 0x82, 0x1E, 0x70, 0x09,
+    0x22, 0x56, 0x58, 0x27, 0x15, 0xDF, 0xEB, 0xAC, 0x5F, 0x83, 0xF6, 0xE4, 0xA8, 0x48, 0x06, 0x43,
+    0xD2, 0x8A, 0x95, 0xB5, 0x4F, 0x05, 0xAC, 0x48, 0x83, 0xBE, 0x79, 0x79, 0x7B, 0xF7, 0x8E, 0xA9,
+    0x28, 0xD0, 0x35, 0x96, 0xFB, 0xDF, 0x99, 0xDD, 0x81, 0x55, 0xD6, 0x56, 0x4D, 0xA5, 0xA5, 0x2E,
+    0xC8, 0xD6, 0x88, 0x0C, 0x49, 0xBD, 0xAE, 0x59, 0xC0, 0xC2, 0x48, 0x26, 0x68, 0x91, 0x88, 0xC5,
+    0x54, 0x94, 0x14, 0x24, 0x81, 0x88, 0x75, 0xA9, 0x27, 0x27, 0x83, 0xC8, 0x10, 0x10, 0x99, 0x42,
+    0x26, 0x12, 0x48, 0x02, 0x05, 0x14, 0x68, 0x8F, 0xF6, 0x94, 0x50, 0x62, 0x2A, 0x4C, 0x45, 0x03,
+    0x5B, 0x58, 0xB0, 0x8E, 0x7B, 0xAF, 0x13, 0xC9, 0x24, 0x64, 0x24, 0xA1, 0xFF, 0x6C, 0xA0, 0xE0,
+    0x5C, 0x81, 0xF6, 0xFA, 0x07, 0x9E, 0x92, 0x7E, 0x4E, 0xEA, 0xD5, 0xBB, 0x9E, 0x21, 0xD9, 0x10,
+    0xEB, 0x12, 0x71, 0x44, 0x56, 0xA0, 0x5B, 0x18, 0xD8, 0x06, 0xC8, 0x2A, 0x20, 0x8D, 0x90, 0xBE,
+    0x39, 0x01, 0x36, 0x76, 0xE8, 0x8E, 0xB5, 0xB5, 0x55, 0x8C, 0x48, 0xC5, 0xCA, 0xDA, 0x39, 0x88,
+    0x44, 0x52, 0xAF, 0x3D, 0x0B, 0x64, 0xB0, 0xC5, 0xD5, 0xA0, 0x6B, 0x2D, 0x8D, 0xC5, 0x9E, 0x8C,
+    0x25, 0xA5, 0x7E, 0x25, 0x24, 0xC1, 0x7C, 0xC1, 0x19, 0x97, 0xE5, 0x14, 0x94, 0x91, 0x98, 0x84,
+    0x99, 0x21, 0xCD, 0x81, 0x24, 0x02, 0x7D, 0x87, 0x92, 0x06, 0x3A, 0x33, 0xDF, 0x1E, 0x4A, 0x02,
+    0x5A, 0xC6, 0xE8, 0x06, 0x74, 0x54, 0xAB, 0x49, 0xD4, 0x42, 0xA3, 0xDF, 0x0D, 0x65, 0x12, 0xCB,
+    0x15, 0x1A, 0x6B, 0x5D, 0x99, 0xDE, 0xA8, 0x7B, 0x2A, 0x46, 0x53, 0x6D, 0xE7, 0x3A, 0xAC, 0x58,
+    0x37, 0xCE, 0x4E, 0x86, 0x9E, 0xF5, 0xDB, 0xE9, 0x4B, 0xDE, 0x7A, 0xA9, 0x95, 0x8C, 0x6A, 0x8C,
+    0x88, 0x87, 0x2C, 0xB6, 0x5F, 0xFD, 0x88, 0x63, 0x14, 0xD9, 0x39, 0x40, 0xA9, 0x2E, 0x15, 0x5A,
+    0xB2, 0xE4, 0x47, 0xB7, 0xAA, 0x78, 0x3E, 0x94, 0x59, 0xD3, 0x33, 0x2F, 0x98, 0x0B, 0xDF, 0x79,
+    0xF6, 0xED, 0xB7, 0x9A, 0x95, 0xD8, 0xBF, 0x12, 0x13, 0x11, 0xCF, 0xA1, 0x4B, 0x9D, 0xF1, 0xAD,
+    0x12, 0x91, 0x6A, 0x50, 0x3D, 0x90, 0x44, 0xC8, 0x1C, 0x8C, 0xDB, 0x05, 0xBC, 0xDF, 0x5A, 0x5B,
+    0x5D, 0xB7, 0x36, 0x2C, 0xEF, 0x4E, 0x03, 0x18, 0x0F, 0xD6, 0x43, 0x76, 0x6F, 0x4C, 0x26, 0x35,
+    0xDA, 0x83, 0x01, 0xE6, 0xDB, 0x01, 0x3C, 0xA8, 0x60, 0x15, 0xF8, 0xC8, 0xC5, 0x54, 0xEA, 0xF3,
+    0x7F, 0x5F, 0xD7, 0xAC, 0x30, 0x5B, 0x89, 0x69, 0xD0, 0x35, 0xA6, 0x22, 0x83, 0xC1, 0x57, 0xAB,
+    0xFE, 0x0E, 0x73, 0x9D, 0x85, 0x4E, 0xBD, 0x9A, 0xA0, 0x1C, 0x1B, 0x22, 0x57, 0x44, 0x6A, 0x5D,
+    0x43, 0x84, 0x12, 0xBA, 0xE5, 0xF9, 0xFE, 0xF3, 0x76, 0xB9, 0xEE, 0xCE, 0x1B, 0xF4, 0x04, 0x2C,
+    0xA4, 0x15, 0x49, 0x80, 0x06, 0x1E, 0x03, 0xDC, 0x57, 0xD4, 0xF3, 0xFC, 0x91, 0x5C, 0x17, 0x5F,
+    0xBC, 0xF1, 0xA3, 0x97, 0x1B, 0x5B, 0xF7, 0x7D, 0x91, 0x06, 0x53, 0xDB, 0x27, 0x62, 0x12, 0x75,
+    0x3D, 0xA4, 0x21, 0x16, 0xE4, 0x94, 0x96, 0x8C, 0x5E, 0xEA, 0x4D, 0x65, 0x4F, 0x04, 0x5D, 0x6B,
+    0xDF, 0x10, 0x89, 0x39, 0x39, 0x2B, 0x5F, 0x20, 0xC3, 0x04, 0x80, 0x21, 0x40, 0xB1, 0xBB, 0x82,
+    0xA5, 0x1E, 0x50, 0x17, 0x87, 0x98, 0xE7, 0xBC, 0x8A, 0x39, 0x85, 0xAE, 0x4D, 0xD5, 0x53, 0x51,
+    0xC5, 0x02, 0x6B, 0x2A, 0xDE, 0x89, 0x98, 0x17, 0x60, 0xA3, 0x42, 0xC7, 0xFD, 0xD4, 0x29, 0xAD,
+    0xF6, 0xF3, 0x96, 0x55, 0x0E, 0x0E, 0x29, 0x86, 0x6C, 0x97, 0xC4, 0x32, 0x09, 0xB9, 0xF6, 0xB9,
+    0xAD, 0xF2, 0x8C, 0xA5, 0x82, 0xA5, 0x92, 0x85, 0x48, 0x16, 0xB0, 0x1E, 0x5B, 0xED, 0x91, 0xA4,
+    0xA5, 0x19, 0x4F, 0xEA, 0x91, 0x84, 0x92, 0x8C, 0x48, 0xA3, 0x6B, 0x53, 0x99, 0xAA, 0x24, 0xD3,
+    0x35, 0x79, 0x0F, 0xDE, 0x89, 0x24, 0x6F, 0x3A, 0xD2, 0x71, 0xDB, 0x51, 0x2B, 0xB0, 0x21, 0x41,
+    0x89, 0x38, 0x16, 0xDA, 0x9A, 0xCC, 0x7A, 0xF5, 0x20, 0xAC, 0x0E, 0x29, 0x4C, 0x65, 0x7C, 0x49,
+    0x4C, 0x7D, 0x8F, 0x5C, 0x7B, 0xED, 0xC7, 0xE4, 0x19, 0xFA, 0xD5, 0x9A, 0xA5, 0x12, 0xF5, 0x26,
+    0x64, 0x01, 0x26, 0x60, 0x2B, 0x06, 0x52, 0x27, 0xA3, 0xAF, 0x90, 0x04, 0x58, 0xDA, 0x5D, 0x9C,
+    0xC8, 0x49, 0xAB, 0x24, 0xA8, 0x48, 0x46, 0x01, 0xD1, 0x56, 0x98, 0x67, 0x23, 0xE4, 0x65, 0x6B,
+    0x8C, 0xC9, 0x6A, 0x60, 0x0C, 0x0C, 0x3C, 0x98, 0x09, 0xA8, 0xB7, 0x6B, 0x28, 0x32, 0xB0, 0x55,
+    0x24, 0x89, 0xA6, 0xA2, 0xA4, 0xC4, 0x3A, 0x3D, 0xD1, 0x81, 0xBE, 0xEF, 0xAC, 0xA0, 0x71, 0x1D,
+    0x75, 0xB0, 0xB4, 0xB6, 0x6C, 0x95, 0x55, 0xED, 0x6D, 0x65, 0xAA, 0x6D, 0x6C, 0xEA, 0x59, 0x2A,
+    0x61, 0x50, 0xC3, 0x0E, 0xE8, 0x08, 0xFD, 0x9A, 0xE4, 0x5D, 0x4F, 0x66, 0x1D, 0x4D, 0x86, 0x75,
+    0x03, 0x3F, 0xE6, 0xEA, 0x7B, 0xEB, 0x9B, 0x83, 0xBA, 0xC8, 0x86, 0xC8, 0xB3, 0xDF, 0x11, 0x69,
+    0x0A, 0x0A, 0xB4, 0xD7, 0x9E, 0x92, 0x12, 0x53, 0x99, 0x8A, 0x86, 0x06, 0x8B, 0x75, 0x2A, 0x12,
+    0xC9, 0xC8, 0x48, 0x42, 0x12, 0xB8, 0xEF, 0xB9, 0xD4, 0x33, 0x64, 0x88, 0x75, 0x56, 0x44, 0x10,
+    0x91, 0x48, 0xCB, 0x9C, 0x93, 0xD0, 0x0D, 0x11, 0xED, 0x81, 0xC7, 0x78, 0x64, 0x6D, 0xF5, 0x1F,
+    0x8B, 0xDC, 0x78, 0xED, 0xF4, 0x9A, 0xA5, 0x24, 0x4F, 0x82, 0x8A, 0xD6, 0x99, 0x2A, 0xA7, 0x50,
+    0x91, 0x98, 0x56, 0xA9, 0xEF, 0xB1, 0x42, 0x93, 0x34, 0x49, 0xE8, 0xD7, 0xE9, 0xAD, 0xEF, 0x06,
+    0x33, 0xC9, 0x7C, 0x4B, 0x17, 0xF6, 0x61, 0x7E, 0x8C, 0xB4, 0x22, 0xF6, 0x48, 0x7D, 0x43, 0x4F,
+    0x7B, 0x9A, 0x0C, 0x5D, 0x0F, 0xB1, 0xBA, 0xA6, 0xB4, 0x2E, 0x09, 0x05, 0xD6, 0xED, 0x1C, 0x9A,
+    0x28, 0x91, 0xA8, 0xAE, 0x3E, 0xE9, 0x5B, 0xC3, 0xDF, 0xB4, 0x20, 0x32, 0x60, 0xE4, 0x49, 0xA6,
+    0x7B, 0x97, 0x6C, 0xDB, 0xB8, 0xEA, 0x22, 0x07, 0x39, 0x98, 0x7A, 0x7D, 0x3D, 0xA8, 0xB8, 0xC5,
+    0xB0, 0xA0, 0xB0, 0xF4, 0x75, 0xDD, 0xF7, 0xD3, 0xAB, 0xD1, 0xEE, 0x0C, 0x59, 0x2D, 0xDA, 0x19,
+    0xE5, 0x49, 0x76, 0x60, 0xB4, 0x9F, 0x21, 0xF7, 0xE0, 0xF0, 0xFB, 0x82, 0x7A, 0xD8, 0xEA, 0x3A,
+    0x96, 0xF6, 0xE4, 0xB3, 0xA1, 0x98, 0xB7, 0x6E, 0xE7, 0x4F, 0x27, 0x4A, 0x24, 0x32, 0x7A, 0xD2,
+    0xB3, 0xDC, 0x43, 0xD5, 0x0D, 0x46, 0x7B, 0x1E, 0xEE, 0xEA, 0x97, 0x84, 0xFB, 0x10, 0x2C, 0x16,
+    0x76, 0xAE, 0xAF, 0x5F, 0x7D, 0xDA, 0x4F, 0xA7, 0xD1, 0xEE, 0x0C, 0x29, 0x0B, 0xE6, 0x2C, 0xFA,
+    0x49, 0xCF, 0x89, 0x00, 0xC3, 0xF7, 0xF1, 0x35, 0x4A, 0x30, 0xCF, 0x7C, 0x85, 0x91, 0x34, 0xF6,
+    0xCE, 0xD3, 0x3E, 0x52, 0x64, 0xE8, 0xEB, 0x81, 0xBC, 0x20, 0xBD, 0xE1, 0x19, 0xE6, 0xD8, 0x27,
+    0x3D, 0x71, 0x48, 0x66, 0x9D, 0x8A, 0xFB, 0x1D, 0x97, 0xD6, 0x52, 0x2D, 0x1C, 0xAA, 0x92, 0x6F,
+    0x8B, 0x5B, 0x79, 0x63, 0x5B, 0x37, 0xDA, 0x9F, 0x27, 0x37, 0x3E, 0xF5, 0x43, 0x86, 0xD6, 0x59,
+    0x17, 0x89, 0x19, 0x36, 0x09, 0x2A, 0x16, 0xF4, 0xB4, 0xD7, 0x75, 0x4E, 0xBE, 0xCF, 0x7A, 0x23,
+    0xE2, 0xD9, 0x70, 0xE7, 0xB1, 0x55, 0x12, 0x75, 0x24, 0x7B, 0xAC, 0x24, 0x79, 0xF7, 0x0B, 0x15,
+    0x2F, 0xAC, 0x37, 0x6A, 0xF4, 0x9C, 0x88, 0xD4, 0x99, 0xDC, 0x75, 0xF4, 0x66, 0xC3, 0xA2, 0x4F,
+    0xBB, 0x32, 0xB7, 0xCB, 0xC3, 0x0B, 0x7C, 0x08, 0x2D, 0x23, 0x8F, 0x91, 0xD7, 0xBB, 0xAF, 0x7E,
+    0xC6, 0x61, 0xA5, 0x62, 0xA7, 0x8F, 0xF1, 0x45, 0x9E, 0x13, 0xDF, 0x0E, 0xD9, 0x85, 0x37, 0xBF,
+    0x3A, 0x4E, 0x65, 0xEA, 0x54, 0x6C, 0x0D, 0x8E, 0x05, 0x56, 0x38, 0xCA, 0xC6, 0x95, 0x8A, 0x8D,
+    0x3B, 0xF7, 0x2D, 0x28, 0xBF, 0x50, 0x48, 0xB6, 0xDA, 0x37, 0xF5, 0x54, 0x6C, 0x29, 0xC9, 0xCF,
+    0x07, 0xB2, 0xE8, 0x28, 0x49, 0x37, 0x32, 0x9F, 0x07, 0x46, 0x8D, 0x92, 0x6A, 0xFF, 0x9A, 0xE0,
+    0xC9, 0x60, 0x7D, 0xD7, 0x3B, 0x53, 0xB1, 0x65, 0x18, 0x44, 0x1E, 0x7D, 0x5D, 0x49, 0x04, 0x54,
+    0x58, 0x82, 0xD6, 0x66, 0x40, 0x2A, 0x00, 0x3C, 0xBC, 0x5B, 0xFF, 0xB4, 0x4A, 0x2B, 0x53, 0x11,
+    0x75, 0x9D, 0x7A, 0x7A, 0xC4, 0xB4, 0x46, 0xFB, 0x5C, 0xD7, 0xB0, 0x95, 0xE9, 0x00, 0x99, 0xB9,
+    0x10, 0x40, 0xBF, 0xFA, 0x4A, 0x04, 0xCE, 0xFD, 0x28, 0x02, 0x99, 0x44, 0xC0, 0xCA, 0x36, 0x60,
+    0x3F, 0xFF, 0x05, 0x07, 0xF6, 0xC6, 0xCB, 0x11, 0x8C, 0x8F, 0x05, 0xA4, 0xBE, 0x34, 0x15, 0x69,
+    0xDD, 0x23, 0xA2, 0x6B, 0xEB, 0x0A, 0x74, 0xD0, 0x3E, 0xF5, 0x3A, 0x12, 0x69, 0x80, 0x43, 0x5C,
+    0x02, 0x8C, 0x8B, 0x80, 0xBE, 0xE5, 0x01, 0x75, 0x75, 0xB7, 0x37, 0x2E, 0xB1, 0xCA, 0xBF, 0xD0,
+    0x3B, 0x34, 0x66, 0xA2, 0xFA, 0xC4, 0xFE, 0x53, 0xD8, 0x27, 0x62, 0x0E, 0xE6, 0x99, 0xB0, 0x05,
+    0xE9, 0xB3, 0x75, 0x04, 0x73, 0xEB, 0x66, 0x04, 0x23, 0x12, 0xC0, 0x3E, 0x79, 0xA3, 0x86, 0xCC,
+    0x3C, 0x5B, 0x43, 0xCF, 0x9C, 0x08, 0x50, 0x5A, 0x15, 0xF9, 0x58, 0xB4, 0x4C, 0xAB, 0x81, 0x5F,
+    0x60, 0xE0, 0xBB, 0x4F, 0xFF, 0x24, 0xFF, 0xE4, 0x34, 0xD8, 0xAB, 0x0E, 0x2B, 0x0D, 0xD9, 0x97,
+    0x77, 0xE8, 0xD1, 0xA7, 0xC0, 0xBA, 0x1C, 0x53, 0xE5, 0x18, 0x5F, 0x62, 0xFC, 0x10, 0x53, 0x35,
+    0xD8, 0xAA, 0xED, 0xF3, 0x3E, 0x70, 0x0E, 0x92, 0x09, 0xD9, 0x28, 0x90, 0x89, 0x6B, 0xCB, 0x78,
+    0x5F, 0x3F, 0xE5, 0x2A, 0xC8, 0x0E, 0xF6, 0x44, 0xA3, 0xA2, 0xF1, 0x3D, 0x72, 0x5D, 0xEB, 0x3A,
+    0xA7, 0xD0, 0x7E, 0x36, 0x0F, 0x3D, 0x34, 0xB8, 0x0D, 0xAC, 0x78, 0x46, 0xA1, 0x83, 0x3B, 0x12,
+    0x8F, 0x95, 0x09, 0x44, 0xE3, 0xC9, 0x18, 0x92, 0xD4, 0xD6, 0x91, 0x13, 0x49, 0x7D, 0x06, 0x43,
+    0x15, 0xB1, 0xAE, 0x07, 0x51, 0xD7, 0x64, 0xE4, 0xE8, 0x90, 0x7A, 0x72, 0x86, 0xA4, 0xBE, 0xB3,
+    0xC6, 0x7D, 0x2C, 0x57, 0x6A, 0x25, 0xB6, 0xA1, 0x1F, 0x8E, 0xB6, 0xCB, 0x8D, 0xA9, 0x3A, 0xAA,
+    0xBC, 0x02, 0x24, 0x15, 0x70, 0x68, 0x95, 0x44, 0x02, 0xFD, 0xA7, 0x9D, 0x8A, 0x39, 0xA6, 0x8A,
+    0xE4, 0xA9, 0x57, 0xA1, 0x87, 0x75, 0x0D, 0xB9, 0xF6, 0x49, 0xB0, 0x58, 0x4A, 0x86, 0x49, 0x18,
+    0x78, 0xDB, 0xEC, 0x30, 0xF0, 0xBB, 0x7C, 0x25, 0xAD, 0xDA, 0xAF, 0xB6, 0x5C, 0xF9, 0x67, 0x67,
+    0xF5, 0xE1, 0x7E, 0x56, 0x5F, 0x75, 0xD4, 0x38, 0x76, 0x7C, 0xF3, 0x1C, 0x70, 0x9E, 0x44, 0xA6,
+    0xFB, 0xA9, 0xE6, 0xCF, 0x46, 0xEF, 0x17, 0x5A, 0xAA, 0x3C, 0x5B, 0x12, 0x86, 0x1C, 0x30, 0x9E,
+    0xC1, 0x0E, 0x48, 0x3D, 0x1B, 0x17, 0xBF, 0x08, 0x7F, 0x64, 0x52, 0xA0, 0x77, 0xBA, 0x49, 0x6F,
+    0x5C, 0x3B, 0x67, 0x75, 0x00, 0x75, 0xE9, 0x67, 0xF6, 0x47, 0xC2, 0x9E, 0x3F, 0x52, 0xEF, 0x2E,
+    0x3A, 0x49, 0xF5, 0xB7, 0x5B, 0xCB, 0xCC, 0x18, 0x06, 0xE1, 0x3D, 0x6A, 0xD5, 0xB0, 0x1D, 0x01,
+    0x0F, 0x73, 0xB0, 0xA0, 0x97, 0x53, 0xE4, 0xE4, 0x25, 0xDB, 0x43, 0xC6, 0xDB, 0x7A, 0x7C, 0xFE,
+    0x74, 0xD3, 0x1F, 0x47, 0xF5, 0x44, 0x24, 0x09, 0xE8, 0x9A, 0xBE, 0x67, 0xE0, 0x5B, 0x29, 0x8A,
+    0x21, 0x34, 0x70, 0x09, 0x35, 0x81, 0x0D, 0x46, 0x30, 0xF0, 0x7D, 0x4F, 0x3F, 0xD8, 0x2D, 0xEC,
+    0x96, 0xFE, 0x73, 0x4C, 0xA9, 0xFE, 0xB2, 0xD2, 0xDF, 0x64, 0x18, 0xF4, 0xB7, 0x7D, 0x91, 0xAB,
+    0xEF, 0x07, 0x6B, 0x89, 0x8D, 0xBE, 0xE1, 0xD7, 0x73, 0x15, 0x36, 0xF3, 0x8C, 0xAD, 0xA5, 0x5E,
+    0x5A, 0x15, 0xE9, 0x27, 0x92, 0x60, 0xD5, 0x2D, 0xD7, 0xA4, 0x7E, 0xC3, 0xE7, 0x2A, 0xD8, 0x3A,
+    0x63, 0x4B, 0x47, 0x33, 0xC9, 0x89, 0xC9, 0xCE, 0x2E, 0x5D, 0x34, 0x6E, 0xC6, 0x19, 0x75, 0x60,
+    0xD6, 0xA0, 0x07, 0xDD, 0x55, 0x6C, 0x18, 0x54, 0x69, 0x33, 0x17, 0xF5, 0x24, 0xDD, 0x56, 0xDF,
+    0x55, 0xDF, 0xE1, 0xB6, 0xFF, 0x9A, 0xFF, 0x7A, 0xC8, 0xCF, 0xE6, 0x5B, 0x76, 0x7E, 0x31, 0x4F,
+    0x2F, 0xFC, 0x9E, 0x4D, 0xEA, 0x5B, 0x69, 0x15, 0x07, 0xCF, 0x84, 0xDC, 0xFA, 0x91, 0x4D, 0xEA,
+    0x81, 0x6F, 0x1B, 0x95, 0x08, 0x6C, 0x75, 0xDC, 0xFC, 0xC3, 0x3F, 0x97, 0x55, 0x8D, 0x16, 0x7A,
+    0x99, 0x43, 0x4B, 0x05, 0x07, 0xBB, 0xA1, 0xA9, 0x03, 0xA8, 0x09, 0x20, 0xC0, 0x37, 0x3C, 0xE4,
+    0x11, 0x7A, 0x05, 0x58, 0xE3, 0x30, 0xCF, 0x06, 0x52, 0xBF, 0x8E, 0x0E, 0x19, 0xEA, 0xEE, 0x57,
+    0x3D, 0x22, 0x91, 0x73, 0x6B, 0x25, 0x05, 0xD6, 0xF5, 0xD1, 0xB5, 0x75, 0x0C, 0x8D, 0xA7, 0xA7,
+    0x6B, 0x52, 0xCF, 0x47, 0x0F, 0xB1, 0xA0, 0xBD, 0xBE, 0x55, 0xD3, 0xBF, 0x08, 0x70, 0xA8, 0x5A,
+    0xCD, 0x76, 0xD6, 0xB3, 0x2F, 0xEF, 0x58, 0x37, 0x30, 0xDE, 0xDC, 0xA8, 0x93, 0xEF, 0x45, 0x86,
+    0x43, 0x8A, 0x1E, 0x99, 0x75, 0xF6, 0x7A, 0x48, 0xC3, 0x76, 0xDA, 0xD8, 0x37, 0x3F, 0xAB, 0xE4,
+    0x13, 0x7B, 0xCB, 0x5B, 0xBE, 0x04, 0x65, 0xB1, 0x77, 0x6E, 0x2B, 0xC8, 0x7C, 0x4B, 0x27, 0xBF,
+    0xE1, 0xE1, 0xB6, 0x27, 0xF9, 0x41, 0x8D, 0xBE, 0x5E, 0x63, 0x9E, 0x0D, 0x64, 0x2A, 0xB0, 0xA2,
+    0x22, 0xE7, 0x2F, 0x47, 0x44, 0xA2, 0x7A, 0x67, 0x2D, 0xEA, 0x9A, 0xC6, 0x78, 0x1A, 0xEB, 0x18,
+    0xF6, 0x61, 0x58, 0x40, 0x09, 0x60, 0x4D, 0xA5, 0xAF, 0x77, 0x73, 0xE8, 0xE7, 0x00, 0xA7, 0x44,
+    0x76, 0x40, 0x8B, 0xEC, 0x80, 0xF9, 0xA6, 0x03, 0xAC, 0x05, 0x58, 0xC9, 0x00, 0xCA, 0x1E, 0x40,
+    0x53, 0x00, 0x49, 0x28, 0xD6, 0x1C, 0xA9, 0xDF, 0x90, 0x1A, 0xEB, 0xCE, 0x5F, 0xAE, 0xE8, 0x5F,
+    0x1E, 0x03, 0x1B, 0xD2, 0x00, 0x77, 0x3E, 0x19, 0x21, 0x89, 0x2A, 0x82, 0xAE, 0x93, 0x08, 0xB6,
+    0x4A, 0x02, 0x64, 0x68, 0x11, 0x0A, 0xB4, 0x08, 0x3C, 0xAE, 0x0E, 0x57, 0xA9, 0xAC, 0x48, 0x7D,
+    0xFE, 0x9F, 0x4D, 0x4F, 0xDD, 0xA8, 0xB3, 0x90, 0xF5, 0x18, 0x50, 0x36, 0x34, 0xE9, 0xB7, 0xBD,
+    0xBE, 0xB5, 0xD3, 0x23, 0x93, 0x6A, 0xC8, 0x18, 0x5D, 0xA7, 0x01, 0x5B, 0x0D, 0x3C, 0xFD, 0x44,
+    0xDC, 0xD1, 0xC1, 0x0B, 0x72, 0xAB, 0xDE, 0x78, 0x2E, 0x9B, 0xF9, 0x9F, 0x4B, 0xDA, 0xAB, 0x30,
+    0xC4, 0x4E, 0x67, 0x1D, 0x6E, 0x65, 0xAC, 0x44, 0xAA, 0x3D, 0xAD, 0x69, 0x26, 0xAD, 0x7E, 0x69,
+    0x15, 0x91, 0xCA, 0x5E, 0x7E, 0x5E, 0xFD, 0x98, 0x14, 0x55, 0x82, 0x91, 0x1D, 0x44, 0x3C, 0x7C,
+    0xFA, 0x30, 0x4B, 0x69, 0x95, 0xDE, 0xF2, 0x9C, 0xAE, 0x00, 0x0E, 0x5D, 0x24, 0x13, 0xB2, 0xE7,
+    0x82, 0x75, 0xEB, 0xA6, 0xEA, 0x69, 0xDF, 0x57, 0x77, 0xC5, 0x8D, 0xA6, 0xAC, 0xB4, 0xDA, 0x5D,
+    0x80, 0x12, 0x67, 0x6F, 0x46, 0x46, 0xE3, 0x59, 0x87, 0x1E, 0x92, 0x86, 0x81, 0x8C, 0xA9, 0x93,
+    0x71, 0xEB, 0x37, 0xEB, 0xBA, 0xED, 0xE5, 0x1E, 0x30, 0xE4, 0x9F, 0x5C, 0x09, 0x7D, 0x91, 0x53,
+    0x77, 0x5C, 0x79, 0x9E, 0xE4, 0x76, 0xC4, 0x7E, 0xC2, 0xB1, 0x5D, 0x60, 0xFC, 0x84, 0x17, 0x10,
+    0xA9, 0x77, 0xF5, 0xD7, 0xCF, 0x60, 0x24, 0x1C, 0x3E, 0xD1, 0xC0, 0x76, 0xA7, 0x25, 0xFF, 0xEA,
+    0xB6, 0x96, 0x49, 0xF6, 0xAD, 0x61, 0x41, 0x53, 0xAA, 0x58, 0xA6, 0xF5, 0x60, 0xE4, 0xB2, 0x5D,
+    0x2B, 0x4C, 0xCF, 0xC2, 0x56, 0xFE, 0x8B, 0x86, 0xD1, 0x0E, 0xD9, 0xF5, 0xD9, 0x77, 0x7F, 0x66,
+    0x54, 0xB3, 0x31, 0xDF, 0x4E, 0xB9, 0xF7, 0x1C, 0xFF, 0xFF, 0x99, 0x4E, 0x57, 0xEE, 0x05, 0xBF,
+    0xFB, 0x73, 0x1F, 0xEF, 0xFC, 0xE5, 0x31, 0x9D, 0xAE, 0x0D, 0xF6, 0x4A, 0xFC, 0x5B, 0xCA, 0xC4,
+    0x9D, 0x6D, 0xBB, 0x16, 0x6C, 0xAB, 0x7A, 0x73, 0xF0, 0x79, 0x64, 0x27, 0xF9, 0x0F, 0x13, 0x88,
+    0x68, 0x4F, 0x8F, 0x51, 0xD0, 0x02, 0x7D, 0x28, 0xA0, 0x21, 0xBD, 0x71, 0x73, 0xC7, 0xB4, 0xEF,
+    0x89, 0xD4, 0x99, 0xEC, 0x40, 0x56, 0xA1, 0x03, 0x8C, 0xA1, 0x80, 0xCC, 0x91, 0xD6, 0x20, 0x35,
+    0x87, 0x47, 0x15, 0x9C, 0x6B, 0x41, 0xF5, 0xDA, 0x5F, 0xC5, 0x03, 0x64, 0x7E, 0x7A, 0x25, 0xA6,
+    0xD2, 0xCC, 0x94, 0x25, 0x67, 0x65, 0xC2, 0xDA, 0xD3, 0xAD, 0x40, 0xD1, 0x3A, 0x51, 0xA6, 0x22,
+    0x89, 0x70, 0x1E, 0xEC, 0x14, 0x92, 0x4E, 0x78, 0x29, 0xDE, 0x33, 0xD3, 0xC6, 0x07, 0x19, 0x30,
+    0x12, 0x9F, 0x48, 0x0D, 0x8C, 0x26, 0x60, 0xA4, 0xEA, 0x46, 0x02, 0x25, 0x43, 0x32, 0x6F, 0x9D,
+    0x9E, 0x10, 0x91, 0x2A, 0xA3, 0xB7, 0x95, 0x84, 0xF4, 0x9B, 0xF4, 0x88, 0x51, 0xD7, 0xC5, 0x02,
+    0xB9, 0x79, 0x36, 0xA4, 0xD7, 0x62, 0xC1, 0x30, 0xD7, 0xDE, 0x7E, 0xC2, 0x95, 0xBC, 0x1D, 0x4C,
+    0x65, 0x4B, 0x1A, 0x25, 0x58, 0xFA, 0x35, 0x51, 0x37, 0x64, 0xAC, 0x90, 0x04, 0x18, 0x4C, 0x3B,
+    0x12, 0xF8, 0x30, 0x07, 0xAD, 0x33, 0x17, 0xBC, 0xAE, 0x23, 0xB1, 0xA4, 0xEC, 0xB1, 0xD0, 0x9E,
+    0xBF, 0x1C, 0x55, 0x5C, 0x67, 0xD2, 0xE3, 0xBC, 0xF1, 0x1B, 0x4F, 0x4C, 0x7F, 0xE4, 0xFB, 0x4D,
+    0xE4, 0xBD, 0x63, 0x64, 0x98, 0xEF, 0x1F, 0xAC, 0xBF, 0x68, 0x88, 0x80, 0x4D, 0x2B, 0x7D, 0xBD,
+    0x23, 0x98, 0xCA, 0xB1, 0xDA, 0x30, 0xCC, 0x29, 0x2C, 0x36, 0xF5, 0xE9, 0xF5, 0xA0, 0x42, 0x7B,
+    0x9E, 0x91, 0xA5, 0xD5, 0xCC, 0x64, 0x67, 0x6F, 0x7E, 0x36, 0xB9, 0x7F, 0x3D, 0xC9, 0xAC, 0xBB,
+    0x4F, 0x8F, 0x13, 0xA7, 0x1B, 0x1D, 0x75, 0x64, 0x25, 0x89, 0x18, 0xDF, 0x40, 0x2C, 0x21, 0xEF,
+    0x81, 0xB5, 0x0E, 0x7D, 0xA3, 0x46, 0xC5, 0x08, 0xDB, 0x39, 0xAC, 0x58, 0x47, 0x76, 0x32, 0x60,
+    0xFD, 0x36, 0xC6, 0x5B, 0x6F, 0x66, 0x7A, 0x5C, 0xB5, 0xFB, 0xCD, 0x61, 0xBE, 0x67, 0x58, 0x3E,
+    0xE2, 0x94, 0x34, 0xE6, 0x8D, 0xED, 0xCC, 0xAD, 0xAC, 0x90, 0xE5, 0x64, 0x25, 0xD9, 0x90, 0x5E,
+    0xC3, 0x4A, 0x43, 0x3E, 0x64, 0x58, 0xAA, 0xD8, 0xBF, 0x52, 0x9B, 0xE9, 0xCF, 0x00, 0x48, 0x44,
+    0x6E, 0x88, 0xC8, 0xDF, 0x14, 0xD0, 0x1E, 0x82, 0x5E, 0x8B, 0x60, 0x43, 0x64, 0x24, 0xD2, 0xD0,
+    0xFB, 0x00, 0x04, 0x34, 0x25, 0xE4, 0x0B, 0xFC, 0xF2, 0x20, 0x01, 0x5B, 0xEF, 0xDB, 0x46, 0x7F,
+    0x43, 0x84, 0xEB, 0x39, 0x49, 0xD8, 0x1D, 0x7D, 0x46, 0x02, 0x03, 0x69, 0x58, 0x4D, 0x3B, 0xB3,
+    0x6D, 0x3A, 0xF9, 0xA3, 0x04, 0x15, 0xB5, 0x88, 0x37, 0xB2, 0x4F, 0x05, 0xE9, 0xD4, 0x4D, 0xEB,
+    0x51, 0x93, 0x44, 0xC4, 0xEF, 0x4E, 0x54, 0x48, 0x2F, 0xF8, 0x5E, 0x1B, 0xA4, 0xE2, 0xE0, 0xF3,
+    0xC8, 0x24, 0xF9, 0xD2, 0x04, 0x1A, 0x92, 0x80, 0xA9, 0x64, 0x9A, 0xCA, 0xB8, 0x93, 0xC4, 0x87,
+    0xA4, 0xD7, 0x6E, 0xEE, 0x68, 0x69, 0x23, 0x69, 0x52, 0x93, 0x48, 0x8B, 0x66, 0x01, 0x86, 0xDA,
+    0x53, 0xD0, 0xB0, 0x42, 0x8F, 0x8C, 0xD4, 0x5B, 0x47, 0x4C, 0x3D, 0x85, 0x6E, 0x09, 0x8A, 0x8A,
+    0x11, 0xF2, 0x2D, 0x30, 0x25, 0xA8, 0x9D, 0xCE, 0x93, 0xC9, 0x3A, 0x57, 0x3C, 0xF3, 0x68, 0xF1,
+    0xB0, 0xD7, 0x50, 0x5A, 0x02, 0xBA, 0xB3, 0x61, 0xAB, 0x1C, 0x64, 0x48, 0xC1, 0x90, 0x92, 0x92,
+    0x86, 0x3C, 0x89, 0xE4, 0xDA, 0x93, 0x9B, 0x8A, 0xC2, 0xC2, 0x52, 0x0F, 0xE6, 0x73, 0x58, 0xD8,
+    0x82, 0xB9, 0x08, 0xB6, 0x6E, 0x45, 0xC0, 0x99, 0xC3, 0x97, 0xB7, 0x52, 0xDC, 0x46, 0x84, 0x8D,
+    0xDD, 0x02, 0xE2, 0xD6, 0x7B, 0x08, 0x96, 0x0A, 0x98, 0x2A, 0x47, 0xD7, 0xD6, 0xE9, 0x90, 0x04,
+    0xD5, 0x06, 0x71, 0x2C, 0x25, 0xBA, 0x2E, 0x60, 0xD8, 0x83, 0xCC, 0x82, 0x7E, 0xC9, 0xC1, 0x1F,
+    0xFB, 0x56, 0xDF, 0xD3, 0xA1, 0x13, 0x0A, 0x9A, 0x96, 0x3D, 0x0E, 0x26, 0x60, 0xC7, 0xFB, 0x17,
+    0x0B, 0xFD, 0x72, 0x44, 0x5F, 0x0B, 0xEC, 0xB9, 0x40, 0xBF, 0x84, 0x9A, 0xD8, 0x53, 0x15, 0xE6,
+    0x39, 0x4F, 0x7A, 0xA1, 0x42, 0x9F, 0xA8, 0xBA, 0x60, 0x63, 0xE7, 0xA4, 0xD5, 0x5D, 0x0C, 0x2C,
+    0xA3, 0x0D, 0xE5, 0xD0, 0x58, 0x47, 0xCF, 0x54, 0xA4, 0x37, 0x3C, 0xBC, 0x5D, 0xC3, 0x52, 0x84,
+    0xB4, 0xE9, 0xD4, 0xCA, 0xB2, 0x93, 0xF3, 0x36, 0xC0, 0xCA, 0x7D, 0x12, 0x3E, 0x90, 0xBE, 0xE8,
+    0xD1, 0x37, 0x3C, 0xFA, 0xBA, 0x27, 0x79, 0xA6, 0x5D, 0xA6, 0x0E, 0xC2, 0x6A, 0x12, 0xBA, 0x88,
+    0x57, 0x5B, 0x4C, 0xBF, 0xA5, 0xD9, 0xB9, 0xA9, 0xB0, 0x27, 0x3D, 0xC9, 0x2B, 0x01, 0xCE, 0xC6,
+    0xB6, 0x5A, 0x7A, 0x1B, 0xD8, 0x01, 0x06, 0x5D, 0xDF, 0x1B, 0xDF, 0x8E, 0x4F, 0x1D, 0xDA, 0x8A,
+    0x65, 0x61, 0x5F, 0x17, 0xED, 0x99, 0xAC, 0xC8, 0x92, 0x45, 0xBF, 0x1C, 0xC9, 0x7B, 0xA4, 0x37,
+    0x6A, 0xCA, 0x1C, 0x73, 0xC1, 0xD3, 0xE4, 0x58, 0x1D, 0x54, 0xCC, 0x6E, 0x4E, 0xD9, 0x90, 0x9A,
+    0x87, 0x7F, 0x3C, 0x64, 0xDF, 0xB9, 0x0D, 0xB0, 0x64, 0xB1, 0x4F, 0xFA, 0x99, 0x19, 0x55, 0x4F,
+    0xCC, 0x2C, 0x7D, 0xCF, 0x3A, 0x7B, 0xD2, 0x9B, 0xBA, 0x49, 0xE3, 0xE0, 0xCA, 0xB6, 0x96, 0xDF,
+    0xE1, 0x91, 0xFB, 0xF5, 0xF6, 0x0F, 0x8E, 0x9B, 0xEF, 0x3F, 0x6F, 0xF5, 0xC3, 0xEE, 0x7C, 0x54,
+    0x31, 0x68, 0x25, 0xFC, 0xBC, 0xF5, 0xE4, 0x2A, 0x92, 0x8B, 0xEF, 0x13, 0x30, 0xDF, 0xEA, 0x26,
+    0xD7, 0x2C, 0x52, 0x3F, 0xF0, 0x08, 0x0C, 0xBB, 0xAB, 0x39, 0xEA, 0xD2, 0x9E, 0x13, 0x60, 0x1C,
+    0x2C, 0xD8, 0xFD, 0x3D, 0xB2, 0x0E, 0x0B, 0xED, 0xDA, 0xDA, 0x40, 0x41, 0x84, 0x5C, 0x45, 0xC8,
+    0x93, 0x00, 0x65, 0x12, 0x60, 0xA8, 0xE5, 0x22, 0x8D, 0x96, 0x09, 0x31, 0xF5, 0xE7, 0x55, 0x34,
+    0x55, 0xA6, 0x82, 0x75, 0xF6, 0x44, 0xB0, 0x58, 0x5D, 0x5B, 0x32, 0xED, 0x33, 0x56, 0x52, 0xDF,
+    0x53, 0x13, 0x53, 0x0D, 0xA4, 0xB1, 0x6E, 0x20, 0x6E, 0xD6, 0xEC, 0x71, 0x6B, 0x46, 0xCB, 0x66,
+    0x03, 0x98, 0xD5, 0xAD, 0x76, 0xC5, 0x2B, 0x2C, 0xD8, 0xD4, 0x93, 0x5E, 0x7F, 0x63, 0x35, 0x09,
+    0x22, 0x6C, 0xAD, 0x7C, 0x2A, 0x16, 0x96, 0xC2, 0xA6, 0xDE, 0x3E, 0x79, 0x2D, 0xEA, 0xEB, 0x21,
+    0x4F, 0x62, 0x63, 0x6E, 0x35, 0x39, 0xA3, 0xA6, 0x03, 0xFD, 0x73, 0x66, 0x39, 0xF4, 0x6B, 0xF4,
+    0x64, 0x37, 0xD9, 0xC2, 0x54, 0x98, 0x08, 0x2F, 0x00, 0x3C, 0xB2, 0xC6, 0x68, 0xCA, 0x9D, 0xA7,
+    0x88, 0xA8, 0x48, 0x12, 0x78, 0xF4, 0xAE, 0x1B, 0x48, 0xD5, 0xE6, 0x5B, 0x98, 0x0A, 0xEB, 0xB0,
+    0x11, 0x1B, 0x21, 0xA0, 0x6A, 0xB4, 0x67, 0xE0, 0x59, 0xF9, 0xC5, 0x0B, 0xF8, 0x15, 0x70, 0x76,
+    0xE6, 0xF5, 0x46, 0x60, 0xDA, 0x3A, 0x6D, 0xCA, 0x29, 0xD7, 0x63, 0x9B, 0x98, 0x61, 0x4E, 0xD6,
+    0x94, 0x0D, 0x7A, 0x0A, 0x59, 0x85, 0x6A, 0x60, 0xC3, 0x63, 0x73, 0xF4, 0x2B, 0x81, 0xB1, 0xA5,
+    0xCF, 0xC8, 0x78, 0xDD, 0xD5, 0xB9, 0x0D, 0x36, 0x0C, 0x3C, 0x49, 0xF8, 0xA9, 0x50, 0x0F, 0x9E,
+    0x7E, 0xC7, 0x21, 0xD2, 0x70, 0x78, 0x74, 0xF3, 0xA7, 0x40, 0xAD, 0x75, 0xA0, 0xF7, 0xFE, 0x98,
+    0x0E, 0x8D, 0x6E, 0x32, 0x92, 0x70, 0x3F, 0xA6, 0xA1, 0xF1, 0xDA, 0xC3, 0x11, 0x8E, 0xF4, 0x27,
+    0x97, 0x5E, 0xF9, 0xF7, 0x87, 0x79, 0x8C, 0x4B, 0x49, 0xF5, 0x3E, 0xBF, 0x00, 0x38, 0xA6, 0xBC,
+    0x9D, 0x1E, 0x7B, 0xEC, 0xD8, 0xFB, 0x3F, 0xD2, 0xFE, 0xE2, 0xF1, 0xAF, 0xC8, 0xF7, 0xD6, 0xBA,
+    0x9F, 0x03, 0x91, 0x4C, 0xC4, 0x3F, 0x7E, 0xF9, 0xF2, 0xE5, 0xCB, 0x5F, 0x19, 0x88, 0x88, 0x4C,
+    0x1E, 0x59, 0x5B, 0x5B, 0x5B, 0x5B, 0x5D, 0xB7, 0x0B, 0xFA, 0xC5, 0xEA, 0xAD, 0x90, 0xFF, 0x8C,
+    0x7F, 0x00, 0x07, 0xD7, 0x9E, 0xEA, 0xCB, 0xE4, 0xE0, 0xDA, 0x53, 0xC0, 0x86, 0x8C, 0x3F, 0x73,
+    0xF9, 0x79, 0x1D, 0x4A, 0x53, 0xC5, 0x05, 0xED, 0x21, 0xCF, 0xF3, 0x7C, 0x71, 0xFE, 0x80, 0xFE,
+    0x5E, 0xCC, 0x8C, 0x1F, 0xE6, 0xFA, 0x5A, 0x58, 0xB0, 0xC4, 0xB3, 0x00, 0x79, 0x91, 0x17, 0xF9,
+    0x52, 0xBE, 0xB4, 0xB8, 0x30, 0x3F, 0x77, 0xE0, 0x00, 0x2B, 0x6D, 0xFC, 0x57, 0x57, 0x9C, 0xD1,
+    0x22, 0xBF, 0x7B, 0x37, 0xCC, 0x41, 0xCD, 0x31, 0x92, 0xEE, 0xEA, 0x10, 0xEB, 0x88, 0x64, 0x24,
+    0x6D, 0xB8, 0x55, 0xB7, 0x51, 0xB8, 0x1C, 0xE6, 0x48, 0xFE, 0xEB, 0x65, 0x44, 0xFC, 0xD1, 0xCD,
+    0x55, 0x72, 0x58, 0x00, 0x53, 0x75, 0xF1, 0xBC, 0x87, 0x97, 0x8F, 0x5A, 0x99, 0x24, 0x5F, 0xFD,
+    0x0C, 0x89, 0x9F, 0xC5, 0xF7, 0xFA, 0x40, 0x32, 0xD9, 0xB8, 0x27, 0xA3, 0x77, 0xA7, 0x59, 0xF5,
+    0x00, 0x19, 0x59, 0xDD, 0x1F, 0x0F, 0x76, 0x06, 0x17, 0xD7, 0x01, 0x8A, 0xF3, 0xE7, 0x8E, 0x82,
+    0xAE, 0x7B, 0xE7, 0xF5, 0xBB, 0xF5, 0xCA, 0x51, 0x1C, 0xBD, 0xC1, 0xCA, 0x01, 0x12, 0xF9, 0xDF,
+    0x1F, 0xD8, 0x19, 0x49, 0x75, 0xB8, 0x23, 0x30, 0x3F, 0xA1, 0x23, 0x2E, 0x25, 0x15, 0x58, 0x69,
+    0x8F, 0xC3, 0x5C, 0x7A, 0xBF, 0x7F, 0x60, 0xA7, 0xFE, 0x21, 0xBC, 0xFD, 0xE0, 0x07, 0x8C, 0xF0,
+    0x71, 0xCD, 0xE0, 0x83, 0x1F, 0x68, 0x8F, 0x8D, 0x8A, 0x00, 0xD9, 0x0B, 0xE4, 0xA0, 0xAF, 0x05,
+    0xE3, 0x60, 0x7D, 0x4E, 0x05, 0x30, 0x84, 0x1C, 0x88, 0xF3, 0x16, 0xB0, 0xC9, 0xF5, 0x1A, 0x88,
+    0xF9, 0xFA, 0x55, 0xAE, 0xDA, 0xF4, 0x13, 0x2B, 0xCD, 0x60, 0xFC, 0xA7, 0xB7, 0x5F, 0x3A, 0xF9,
+    0xD2, 0x85, 0xEB, 0xE3, 0xAD, 0x98, 0xC7, 0x9C, 0x85, 0x79, 0xFD, 0x17, 0xDA, 0xEB, 0xEB, 0xFE,
+    0xEF, 0xD5, 0x39, 0x31, 0x4F, 0x3F, 0xAB, 0xAB, 0x25, 0xED, 0xBF, 0xE6, 0xB7, 0xD2, 0x2A, 0x9F,
+    0x5B, 0xB2, 0xC4, 0xE4, 0x2F, 0xAF, 0xBD, 0x5B, 0xE7, 0xD8, 0xC6, 0x34, 0xDC, 0x77, 0xB4, 0x18,
+    0x66, 0x28, 0x76, 0x71, 0xCC, 0x90, 0xEC, 0x62, 0x99, 0xA1, 0xD9, 0xC5, 0x33, 0x43, 0xC4, 0xF9,
+    0x0E, 0x53, 0x7F, 0xD2, 0xA2, 0x7A, 0x71, 0x86, 0x2B, 0x2E, 0xB6, 0xC8, 0xBE, 0x99, 0xB4, 0xD8,
+    0x8A, 0xD0, 0xA1, 0xFB, 0x43, 0xED, 0x97, 0xB4, 0xFF, 0x9A, 0xFF, 0x7A, 0x7D, 0xB6, 0x45, 0x38,
+    0x3F, 0xC3, 0xF8, 0xA3, 0x0E, 0x65, 0xBA, 0x47, 0x19, 0x54, 0xB4, 0xAE, 0xD4, 0x7E, 0x9E, 0x98,
+    0x80, 0x8A, 0xD1, 0x9E, 0xAA, 0xCA, 0x5C, 0x5F, 0xAF, 0xE7, 0xE7, 0x88, 0x9B, 0x49, 0xE2, 0x50,
+    0x31, 0x6E, 0xD9, 0x53, 0xCF, 0xF9, 0x32, 0xCF, 0xF5, 0xF5, 0x97, 0xC3, 0xFC, 0x9C, 0x25, 0x6E,
+    0x9E, 0x4D, 0x92, 0x27, 0x1C, 0x67, 0xD7, 0xF3, 0xC5, 0xF9, 0x23, 0x07, 0xCF, 0x6E, 0xAD, 0xAF,
+    0xE7, 0xF9, 0x62, 0x3E, 0xBF, 0x78, 0xE4, 0xC8, 0xC1, 0x07, 0xCF, 0x6E, 0x6D, 0xAE, 0xAF, 0x6F,
+    0xE5, 0xF9, 0xFA, 0x62, 0x9E, 0xCF, 0x2F, 0x2E, 0x1E, 0x39, 0x72, 0xEC, 0xE0, 0x83, 0x0F, 0x00,
+    0x04, 0xFA, 0xA4, 0x67, 0xF8, 0x41, 0xB5, 0xB8, 0x98, 0x2A, 0x5F, 0x1F, 0x59, 0x26, 0xE0, 0x16,
+    0xD2, 0x6B, 0xB1, 0xB4, 0xAE, 0xD4, 0xF5, 0x02, 0x51, 0x71, 0x90, 0x9C, 0x75, 0x62, 0x12, 0x52,
+    0xBF, 0xA2, 0x43, 0x91, 0xD4, 0xAA, 0x83, 0xE9, 0x92, 0x9A, 0x93, 0xDE, 0x56, 0x36, 0xF5, 0x4B,
+    0xC4, 0xD4, 0xB7, 0xF9, 0x0D, 0x4D, 0xCB, 0xFA, 0x52, 0xDF, 0x70, 0x34, 0xFD, 0xAE, 0xFB, 0x95,
+    0x98, 0x36, 0xFA, 0x96, 0xB7, 0xDE, 0xFE, 0x3B, 0xEE, 0xF9, 0x0F, 0xB5, 0x4B, 0x6F, 0xF3, 0xDE,
+    0x87, 0x3F, 0x9D, 0xFA, 0x46, 0x87, 0xF4, 0xBA, 0xB3, 0xD5, 0x21, 0x38, 0x00, 0x0C, 0x6D, 0xB5,
+    0xA2, 0x6B, 0xFB, 0x44, 0x4C, 0xFD, 0x76, 0x12, 0x7B, 0x8C, 0xAD, 0x2B, 0xB4, 0xB7, 0x2A, 0xA6,
+    0x7E, 0x5D, 0x85, 0x25, 0xB6, 0x2C, 0xB9, 0xF6, 0x96, 0x19, 0x49, 0x68, 0x2C, 0xE7, 0x4D, 0x9D,
+    0x9D, 0x88, 0x8A, 0xA3, 0x00, 0x8F, 0x4E, 0x95, 0x4C, 0x93, 0x73, 0xA5, 0x8A, 0x4D, 0x7A, 0xA3,
+    0xEE, 0x59, 0x9A, 0xB1, 0xFE, 0xAE, 0xB7, 0x63, 0x36, 0x9C, 0x6A, 0x30, 0x8E, 0xC5, 0xEE, 0xC5,
+    0x0C, 0x26, 0xE8, 0x80, 0x82, 0xC7, 0x2F, 0xFF, 0x67, 0x91, 0x00, 0x68, 0x78, 0x68, 0x19, 0xFD,
+    0x4C, 0x4D, 0x30, 0x5F, 0x1A, 0xF2, 0xE8, 0x18, 0x4E, 0x5F, 0xE4, 0xEE, 0x69, 0x02, 0xA1, 0xE6,
+    0xA1, 0x4B, 0x24, 0xBB, 0x0E, 0xD4, 0x1C, 0x2C, 0xC2, 0x71, 0xB8, 0x84, 0xF2, 0xE8, 0x0A, 0x03,
+    0x47, 0xBA, 0xA4, 0x3F, 0x26, 0x24, 0xFF, 0x0B, 0xFD, 0x0F, 0x99, 0x3B, 0xC2, 0xB1, 0xC3, 0x1C,
+    0x37, 0xFB, 0x86, 0xE0, 0xD2, 0x8C, 0xCD, 0xEC, 0xA5, 0x87, 0x15, 0x73, 0x6D, 0xE0, 0x60, 0x0B,
+    0x80, 0x47, 0x5B, 0x4A, 0xDD, 0xFF, 0x72, 0x05, 0x24, 0xDF, 0x69, 0x25, 0x9B, 0xF9, 0x6E, 0x0C,
+    0x02, 0x28, 0x1A, 0x20, 0x43, 0xB1, 0xDE, 0x2A, 0xCC, 0xB5, 0x52, 0x9E, 0x87, 0x0D, 0xFD, 0x53,
+    0xB0, 0xF3, 0x18, 0xA7, 0xEF, 0xAC, 0xA9, 0xD1, 0x1B, 0xAB, 0x5A, 0xC6, 0x64, 0x52, 0x67, 0xD7,
+    0x56, 0x19, 0x1D, 0x4C, 0x7E, 0xE0, 0x30, 0xFF, 0x94, 0xBE, 0x85, 0x61, 0xCE, 0xE6, 0x12, 0x89,
+    0x6F, 0xBA, 0x97, 0x3B, 0x5C, 0x8F, 0x3F, 0x2F, 0x2F, 0xAF, 0x01, 0x2C, 0x03, 0x9B, 0xAD, 0xDA,
+    0xAA, 0xAB, 0x96, 0x3D, 0x2D, 0x75, 0xC1, 0xE9, 0x4E, 0x83, 0x36, 0xAE, 0xD5, 0xA1, 0xF3, 0xF6,
+    0x52, 0x52, 0xB7, 0x01, 0x85, 0x59, 0xCA, 0xC4, 0x16, 0x40, 0x3F, 0x22, 0xBE, 0x55, 0x63, 0x87,
+    0x24, 0x33, 0x26, 0x13, 0x30, 0x15, 0x83, 0x88, 0x54, 0x7A, 0x46, 0x7D, 0x7C, 0x4B, 0x7D, 0x54,
+    0xC0, 0xB8, 0xF6, 0x16, 0x0C, 0xEA, 0x74, 0xA7, 0x35, 0xBE, 0xE9, 0xAE, 0x99, 0xB5, 0xA8, 0x90,
+    0xEE, 0x30, 0xF2, 0xE4, 0xA4, 0x9E, 0x75, 0xCC, 0xEC, 0x2A, 0x3D, 0x36, 0x6A, 0x33, 0xE9, 0xEA,
+    0x71, 0x7A, 0xAC, 0xA4, 0xCE, 0x24, 0x8C, 0xC4, 0x5D, 0xCC, 0x12, 0xB6, 0x3B, 0x55, 0x78, 0x96,
+    0x01, 0x99, 0x7A, 0x56, 0xA0, 0xC1, 0x7A, 0xCE, 0x93, 0x06, 0xB2, 0x4A, 0x8D, 0x31, 0x75, 0x2B,
+    0x11, 0xA7, 0x8E, 0x45, 0xD8, 0xEC, 0xBA, 0x85, 0xBD, 0x81, 0x32, 0x44, 0x47, 0xB2, 0xEE, 0x55,
+    0x1C, 0xDD, 0x3C, 0x50, 0xA3, 0xA0, 0x5F, 0x96, 0xA9, 0x6A, 0x3E, 0x9A, 0xFA, 0x12, 0x9A, 0x7E,
+    0x9B, 0x05, 0x66, 0x75, 0x8D, 0xAD, 0x22, 0xD6, 0x97, 0x64, 0x55, 0x8F, 0xAC, 0x32, 0xCE, 0x3A,
+    0xED, 0x53, 0x47, 0x4C, 0x3C, 0xCB, 0xFB, 0xBE, 0xAC, 0xBD, 0xF5, 0x49, 0xA3, 0x03, 0xDB, 0x1C,
+    0xE5, 0x40, 0xE7, 0xD6, 0x55, 0xA3, 0x86, 0xF1, 0x40, 0x6A, 0xFB, 0x84, 0x5B, 0x51, 0xB1, 0x4D,
+    0xF6, 0xCA, 0x74, 0x20, 0x09, 0x05, 0x94, 0xDA, 0x93, 0xB9, 0x12, 0x53, 0xA7, 0x55, 0x12, 0xD9,
+    0xA2, 0xC4, 0x62, 0x21, 0xB2, 0xE7, 0x65, 0x50, 0x50, 0x90, 0x86, 0x34, 0x70, 0x8E, 0x73, 0x28,
+    0x14, 0x3C, 0xB2, 0xB6, 0xF6, 0xB4, 0xC8, 0xF7, 0xD6, 0xD6, 0xDA, 0x6E, 0xCF, 0x61, 0x09, 0x32,
+    0xB0, 0x0E, 0x53, 0xA1, 0x3D, 0xBA, 0x46, 0x45, 0x68, 0x60, 0x08, 0x1B, 0xF2, 0x7A, 0x26, 0xF2,
+    0x5C, 0x2A, 0x6F, 0x5D, 0x93, 0xE9, 0x99, 0x0D, 0xF9, 0xB3, 0x4C, 0xDE, 0x4D, 0x65, 0xE7, 0x9A,
+    0x48, 0x7B, 0xF2, 0xED, 0x54, 0xDE, 0xBA, 0x26, 0xF1, 0xCC, 0xBF, 0x71, 0xC7, 0x8E, 0x91, 0xA6,
+    0xA8, 0x6B, 0x9E, 0x33, 0x67, 0xB8, 0xFF, 0xA4, 0x93, 0x81, 0x4E, 0x88, 0xBC, 0x2D, 0x3B, 0xA5,
+    0x88, 0xDD, 0x90, 0x1B, 0x6F, 0x4A, 0xBC, 0x27, 0x93, 0x15, 0x11, 0x3B, 0x92, 0x1B, 0xDF, 0x95,
+    0x78, 0x5B, 0x26, 0xF9, 0x86, 0x5C, 0x39, 0x24, 0xE2, 0x5B, 0xCD, 0x68, 0x20, 0x53, 0xFB, 0xB4,
+    0xFC, 0xE0, 0x82, 0x4C, 0x82, 0xC8, 0xFA, 0x40, 0x7E, 0x68, 0xE5, 0xDE, 0x05, 0x99, 0x06, 0x91,
+    0xE1, 0x40, 0xFE, 0xC2, 0xCA, 0xED, 0x5B, 0xD2, 0xB4, 0xB3, 0xB5, 0xED, 0x83, 0x1A, 0xB6, 0x60,
+    0x91, 0x95, 0x39, 0xCC, 0x3D, 0x87, 0x91, 0x46, 0xED, 0xFC, 0x4B, 0x75, 0x8B, 0x24, 0x06, 0x62,
+    0xCE, 0x81, 0xD6, 0xC0, 0x27, 0xD5, 0x79, 0x53, 0x7F, 0x74, 0x9F, 0x63, 0xE6, 0x73, 0xED, 0x73,
+    0xED, 0x17, 0x71, 0x70, 0xFA, 0x22, 0xDC, 0x3D, 0x0D, 0x81, 0x40, 0xCD, 0x43, 0xEC, 0x9F, 0xE7,
+    0x7F, 0x8B, 0xE3, 0x21, 0xF8, 0xB8, 0xAE, 0x58, 0xE6, 0x2C, 0xCB, 0x98, 0x2F, 0x0D, 0xE1, 0x74,
+    0xD8, 0x2D, 0x1E, 0x2C, 0xB8, 0x1C, 0x5D, 0xD7, 0x98, 0x7B, 0xA0, 0x46, 0x42, 0x72, 0xE7, 0x2B,
+    0x2C, 0x45, 0xF4, 0xF7, 0x6B, 0xB2, 0xD4, 0x73, 0xD4, 0x42, 0x6B, 0xD4, 0x50, 0xA1, 0x9D, 0x63,
+    0x8B, 0x24, 0x61, 0x13, 0x73, 0xAF, 0x82, 0x91, 0x38, 0xB5, 0xF3, 0xDB, 0x2C, 0x9C, 0x41, 0xC5,
+    0x80, 0xD5, 0x9E, 0x03, 0xA6, 0x6A, 0x6D, 0x28, 0xC6, 0xE7, 0x93, 0xF4, 0xB9, 0x6A, 0x13, 0x4B,
+    0x52, 0xB7, 0xD3, 0x68, 0x13, 0x8B, 0xEA, 0xFE, 0xDE, 0xEA, 0xFE, 0x4E, 0x2F, 0x54, 0xDB, 0x5B,
+    0xC6, 0x03, 0x4F, 0x01, 0x8C, 0xA6, 0x8E, 0x23, 0xBD, 0x4F, 0xCA, 0xEB, 0xE9, 0x0D, 0xC7, 0x69,
+    0x89, 0x9F, 0x86, 0x43, 0xCF, 0xC3, 0xC1, 0x55, 0x8C, 0xD4, 0xBA, 0x36, 0x2E, 0xB0, 0xF8, 0x18,
+    0xBC, 0x02, 0x07, 0x38, 0x04, 0x6C, 0x62, 0x8C, 0xA1, 0xFC, 0x5A, 0xAD, 0x64, 0x8B, 0x74, 0xCA,
+    0x86, 0xC8, 0x2B, 0x5F, 0x9D, 0x7E, 0x85, 0x51, 0x64, 0xE9, 0x8F, 0xBD, 0x39, 0x95, 0x71, 0x74,
+    0x73, 0x95, 0x3D, 0xE3, 0xA7, 0x6B, 0xB2, 0x8A, 0xC7, 0xF6, 0xB5, 0xD0, 0x51, 0x92, 0x88, 0xF1,
+    0x3C, 0x78, 0x5F, 0xCB, 0x7D, 0x1A, 0x1D, 0xB0, 0x8E, 0x87, 0x55, 0x8C, 0xCD, 0xD0, 0x9E, 0x7A,
+    0xEE, 0x86, 0x2F, 0xF3, 0x7C, 0x49, 0x5F, 0x7F, 0xB9, 0x0E, 0xF3, 0x73, 0xD6, 0x10, 0x37, 0xCF,
+    0x1C, 0x4F, 0x92, 0x27, 0x9E, 0xA8, 0xF6, 0x3E, 0xDD, 0xE5, 0xB8, 0x3D, 0xF6, 0xBE, 0x5D, 0x71,
+    0x14, 0x38, 0x11, 0xC1, 0xBC, 0xE4, 0xA1, 0xFF, 0x20, 0xF0, 0xD1, 0xF7, 0x7D, 0xEE, 0xD3, 0xB3,
+    0x68, 0x95, 0x75, 0x7B, 0xC1, 0x76, 0x15, 0x21, 0x7D, 0xC9, 0x43, 0xF6, 0x0F, 0x3E, 0xB0, 0x80,
+    0xBD, 0x17, 0xAB, 0xF7, 0x44, 0xE9, 0xF7, 0x1F, 0x1F, 0x05, 0xBE, 0xB8, 0x0B, 0xE2, 0x00, 0x70,
+    0x94, 0x72, 0xBB, 0xDC, 0xFF, 0xC8, 0xF2, 0x76, 0x09, 0x87, 0xBB, 0x00, 0x6A, 0x03, 0xFC, 0xD8,
+    0x38, 0x7C, 0x0C, 0xF5, 0xC5, 0x88, 0x7D, 0xC9, 0xD3, 0x3F, 0x30, 0x1B, 0x1D, 0xFB, 0x8E, 0xFD,
+    0xEF, 0xEE, 0xE6, 0x0B, 0xC4, 0x6E, 0xC4, 0x8D, 0x6D, 0x12, 0x75, 0xCC, 0xAD, 0x37, 0x2E, 0xCE,
+    0x77, 0xAB, 0x8F, 0x6D, 0x33, 0xB1, 0x11, 0x11, 0xB9, 0x2D, 0x22, 0xE2, 0x77, 0x2F, 0x41, 0x84,
+    0x0F, 0x69, 0xFF, 0x69, 0xC6, 0x56, 0x07, 0x1D, 0x72, 0x5B, 0x29, 0xE2, 0x81, 0xEE, 0xC5, 0x07,
+    0xE1, 0xC0, 0x60, 0xB0, 0x04, 0xB0, 0x32, 0x58, 0xE9, 0x7E, 0x1D, 0xA0, 0x7C, 0xA1, 0x84, 0xF2,
+    0x85, 0x6D, 0x28, 0x5F, 0xD8, 0x3E, 0xDA, 0xFE, 0x30, 0xD3, 0xC3, 0x5C, 0x3A, 0xFC, 0x13, 0x28,
+    0xA4, 0x15, 0x9F, 0x6B, 0xFF, 0x13, 0x28, 0xA4, 0x99, 0x0E, 0xAE, 0x35, 0xF6, 0xFD, 0xEF, 0xB6,
+    0x1C, 0x73, 0xD5, 0x26, 0xE3, 0xC1, 0x4B, 0xD3, 0x0F, 0x7E, 0x20, 0xFE, 0xFA, 0xFF, 0x3C, 0xFC,
+    0x78, 0xF5, 0xC1, 0x5F, 0x30, 0xE1, 0xA7, 0x80, 0x5C, 0x55, 0xE2, 0x9A, 0xB8, 0xB5, 0x98, 0x9B,
+    0xB9, 0xE4, 0x45, 0xF7, 0x56, 0xBD, 0x7C, 0x76, 0x7E, 0xC1, 0x6A, 0x71, 0x3D, 0x30, 0x8A, 0x63,
+    0x8B, 0x8F, 0x1D, 0xFF, 0xF8, 0x99, 0xCD, 0x8B, 0x40, 0x12, 0x54, 0xC3, 0x84, 0x5B, 0xDC, 0xF6,
+    0x9B, 0xE1, 0xEB, 0xEB, 0x03, 0xA9, 0x2C, 0xBA, 0xE2, 0x22, 0x28, 0xF1, 0x5F, 0x5F, 0x5D, 0xE6,
+    0x08, 0xE9, 0x0E, 0x9F, 0xF2, 0x9C, 0x65, 0x1E, 0x6B, 0xAE, 0xB8, 0xAB, 0x70, 0x80, 0x0D, 0xFF,
+    0xB9, 0xA3, 0xCB, 0x2C, 0x62, 0x45, 0xBF, 0xF2, 0x72, 0x58, 0x3E, 0x7B, 0x64, 0xCE, 0xE8, 0x37,
+    0xAB, 0x9E, 0x03, 0x2D, 0x61, 0xAD, 0x61, 0x99, 0x9C, 0x79, 0x2C, 0x86, 0xB4, 0xD2, 0x3E, 0xA9,
+    0xB9, 0xD4, 0x42, 0x0A, 0xF1, 0xEC, 0xE2, 0xDC, 0x9C, 0x9A, 0x2A, 0x79, 0x22, 0xC4, 0xCD, 0xF9,
+    0xDC, 0xA4, 0x6F, 0x56, 0xBF, 0xE3, 0x40, 0x89, 0x7A, 0x2B, 0x6C, 0x2E, 0xE6, 0xC6, 0xEA, 0xEB,
+    0xF7, 0x62, 0xEF, 0x2C, 0x8B, 0x2C, 0x1D, 0xBE, 0xAA, 0xFE, 0x0A, 0xE5, 0x92, 0x2A, 0xA9, 0x36,
+    0x76, 0x3E, 0xF6, 0x57, 0x49, 0x95, 0x54, 0xB0, 0xB1, 0xF3, 0xF8, 0x57, 0xDA, 0x30, 0xFD, 0x23,
+    0x4F, 0x6D, 0xEC, 0x70, 0x54, 0x57, 0xB9, 0xAA, 0x2D, 0x67, 0x13, 0x6F, 0x59, 0x26, 0xE8, 0xCA,
+    0xB2, 0xC8, 0x71, 0x14, 0xB9, 0xF2, 0xF3, 0xD4, 0x47, 0x54, 0x3D, 0x9F, 0xF8, 0x65, 0xE3, 0xC2,
+    0xA2, 0x81, 0x83, 0xC9, 0x9B, 0x61, 0xBC, 0x98, 0xDB, 0x79, 0xFD, 0x79, 0x5E, 0xF1, 0x67, 0xC2,
+    0xE2, 0xF1, 0xC3, 0xB0, 0xCA, 0xFE, 0x96, 0xFA, 0xA3, 0x3A, 0x3F, 0xBB, 0x30, 0xD7, 0xB5, 0x14,
+    0x99, 0xFD, 0xC1, 0x9F, 0x27, 0x3E, 0xD7, 0x7E, 0x39, 0x75, 0x9B, 0x96, 0x8B, 0x3C, 0xCC, 0xA8,
+    0x3E, 0x5E, 0x62, 0xD1, 0x3E, 0xA9, 0x93, 0x3A, 0xA9, 0x75, 0xAD, 0xBD, 0x96, 0x78, 0xF9, 0x79,
+    0x56, 0xED, 0xCE, 0x83, 0x19, 0x96, 0xB9, 0x43, 0xC3, 0x43, 0x0D, 0x8B, 0x2C, 0xBA, 0xFC, 0x6E,
+    0x73, 0xBA, 0x02, 0x52, 0xAF, 0x83, 0x1E, 0x27, 0x7F, 0x9E, 0xBC, 0xA4, 0x5E, 0xBD, 0xF6, 0x46,
+    0x33, 0x12, 0x96, 0x30, 0xA8, 0xEA, 0x7D, 0x9A, 0xF8, 0xD8, 0xBE, 0x26, 0xAE, 0xCF, 0x1D, 0x5D,
+    0x66, 0xF1, 0xA8, 0x15, 0xFD, 0x72, 0x08, 0xCB, 0xC7, 0xE7, 0xE6, 0xCC, 0x09, 0xD9, 0x6D, 0xE2,
+    0x2D, 0x96, 0x59, 0x64, 0x01, 0x8B, 0x71, 0xBA, 0xD2, 0x5E, 0x05, 0x2E, 0xC1, 0x51, 0x25, 0x55,
+    0xDC, 0x5C, 0x9E, 0xB7, 0x56, 0x4D, 0x11, 0x17, 0xB6, 0x36, 0xE7, 0x17, 0xCD, 0xC9, 0x5B, 0x55,
+    0xCF, 0x81, 0x12, 0xDE, 0x89, 0x6D, 0x13, 0x5F, 0xBB, 0x17, 0x17, 0xD6, 0x59, 0x64, 0xE1, 0xD0,
+    0x55, 0x35, 0x04, 0xA7, 0xBC, 0xF2, 0x83, 0x9D, 0xC7, 0xFF, 0x5A, 0x79, 0xE5, 0x71, 0x83, 0x9D,
+    0xC7, 0xFF, 0x1B, 0x0C, 0xA6, 0xF0, 0xC8, 0x53, 0x83, 0x29, 0x2E, 0x37, 0xAA, 0xCE, 0x53, 0xB7,
+    0x69, 0x89, 0x96, 0x68, 0x38, 0xA3, 0x9D, 0x62, 0x51, 0xD5, 0x47, 0x08, 0x73, 0x84, 0xF9, 0xC4,
+    0xE7, 0xA9, 0x8B, 0x8B, 0xA9, 0x4B, 0xBE, 0x77, 0xF2, 0xDB, 0xAF, 0xF8, 0xCD, 0x7A, 0xF1, 0xCC,
+    0xDC, 0xA2, 0x7E, 0x52, 0xFB, 0x7B, 0x67, 0x1E, 0x3C, 0x40, 0xF2, 0xBA, 0xFD, 0xEC, 0xE2, 0x91,
+    0xE3, 0xE5, 0xC6, 0xC5, 0x4D, 0xCE, 0xB0, 0xB2, 0x75, 0xC8, 0x25, 0xCF, 0xEB, 0x6F, 0x5F, 0xF0,
+    0x9B, 0xF5, 0xB1, 0x33, 0x66, 0x51, 0x3F, 0xA7, 0xFC, 0xDD, 0xFA, 0x90, 0xE3, 0xC1, 0xE4, 0x89,
+    0xEB, 0xFE, 0xEF, 0xFA, 0xD4, 0xAB, 0xA0, 0xFE, 0x0F, 0xAF, 0xBA, 0xB0, 0xB9, 0x7A, 0x80, 0x47,
+    0x2F, 0x7E, 0xB9, 0x4E, 0xBC, 0xC9, 0xA6, 0xF5, 0x0F, 0x4D, 0x2F, 0x7E, 0x98, 0x94, 0xC4, 0x13,
+    0xF8, 0xF5, 0xE7, 0x17, 0xFE, 0x20, 0x7D, 0xE6, 0xBA, 0x3F, 0x53, 0x2F, 0x7E, 0x7C, 0xEE, 0x98,
+    0x3E, 0xA5, 0xAE, 0xB9, 0xA3, 0xDD, 0xAD, 0xE3, 0x8F, 0x1D, 0x5B, 0x34, 0x8B, 0xC9, 0x7F, 0x47,
+    0x38, 0x5E, 0x1F, 0x5B, 0x34, 0xFA, 0x09, 0xB7, 0x9A, 0x26, 0x3E, 0x1C, 0x7F, 0x28, 0x4D, 0xAA,
+    0xFA, 0xF8, 0x31, 0xA3, 0xDC, 0x03, 0xEB, 0x0B, 0xEE, 0xAF, 0x6F, 0x96, 0xF3, 0xE9, 0x33, 0xD7,
+    0xFD, 0xE6, 0xE2, 0xF2, 0x9C, 0xBE, 0xE0, 0xEA, 0xE3, 0x67, 0x8E, 0xA5, 0x26, 0xF1, 0x67, 0x56,
+    0x1F, 0x3E, 0xC8, 0x03, 0xE7, 0xD2, 0xFF, 0x72, 0x3D, 0x9C, 0x89, 0xC7, 0x96, 0xCD, 0x11, 0xFD,
+    0x1C, 0xAF, 0xF8, 0x33, 0xAB, 0x07, 0x48, 0x3E, 0xC2, 0xEF, 0x7E, 0x36, 0xAD, 0xEA, 0xCD, 0x23,
+    0x47, 0x94, 0xAF, 0x17, 0xE7, 0xD3, 0x13, 0x77, 0xC3, 0xF2, 0xA7, 0xB5, 0xE3, 0x0C, 0x06, 0x0E,
+    0xBD, 0xFE, 0xB9, 0x7F, 0xEE, 0xD3, 0x2A, 0xAD, 0x13, 0x9F, 0x3E, 0x3E, 0xFC, 0xB0, 0x53, 0x5C,
+    0xEA, 0x7F, 0xF1, 0x5B, 0xC7, 0x92, 0xEA, 0xB8, 0x76, 0x67, 0xF4, 0xA5, 0x0F, 0xB7, 0x62, 0xE4,
+    0x14, 0x7D, 0x37, 0xB2, 0x0D, 0xB6, 0x13, 0x91, 0xD4, 0xDA, 0x49, 0xBF, 0x31, 0xC9, 0x8D, 0xD3,
+    0x3E, 0x52, 0x58, 0x92, 0x1F, 0xBD, 0xE3, 0x8C, 0x4C, 0x49, 0xDF, 0x70, 0xB3, 0xE0, 0xD2, 0x3A,
+    0x98, 0x9B, 0x55, 0x1B, 0xB6, 0xDC, 0xAC, 0x99, 0x5B, 0xE4, 0x90, 0x78, 0x2D, 0x53, 0x25, 0xA7,
+    0xAA, 0x73, 0x9B, 0xB5, 0xFD, 0x47, 0x8B, 0xC9, 0x5B, 0x37, 0xAA, 0x22, 0x3F, 0xAB, 0x6F, 0x9C,
+    0xA2, 0xDC, 0xAC, 0xCD, 0xEF, 0x2D, 0xF2, 0x27, 0x37, 0xAA, 0x74, 0x72, 0x96, 0xC1, 0x29, 0x74,
+    0xAC, 0xC9, 0xA6, 0x63, 0x25, 0xE2, 0xF2, 0xB3, 0xE8, 0x53, 0x70, 0x74, 0x75, 0x96, 0xF7, 0x33,
+    0x66, 0x43, 0xEA, 0xAC, 0x7A, 0xA0, 0x8B, 0x97, 0xCD, 0x84, 0x2D, 0xD3, 0xD7, 0xFE, 0x5E, 0x2C,
+    0xAD, 0x4F, 0x7D, 0x43, 0x99, 0x91, 0x5E, 0xAF, 0x29, 0x73, 0xF4, 0xAB, 0x9E, 0xFE, 0x36, 0x88,
+    0xB8, 0x99, 0x88, 0x9E, 0x49, 0xC3, 0xA8, 0xCD, 0x03, 0x9E, 0x25, 0x6E, 0x86, 0x96, 0x6D, 0x17,
+    0xC0, 0xDD, 0xCB, 0xA4, 0x32, 0x21, 0x5B, 0x5B, 0x65, 0xAB, 0xAD, 0x8A, 0xEC, 0x90, 0x4A, 0x6C,
+    0x03, 0x80, 0x0E, 0xF6, 0x82, 0x50, 0x1B, 0x0D, 0x89, 0x4C, 0x48, 0xEB, 0x03, 0x58, 0xB7, 0xB7,
+    0x1F, 0x63, 0x01, 0xB4, 0x08, 0xA9, 0x4C, 0xDB, 0x8F, 0x9F, 0x7B, 0x0A, 0x2B, 0x13, 0x0E, 0xDE,
+    0x79, 0xAA, 0xE5, 0xF1, 0x1D, 0xC7, 0x18, 0x88, 0x54, 0x03, 0x91, 0xAA, 0xDB, 0x15, 0x45, 0x4B,
+    0x2C, 0x23, 0x2A, 0xB9, 0xF4, 0xBB, 0x17, 0x93, 0x17, 0x65, 0x20, 0xBC, 0xFB, 0x1F, 0xE5, 0xC9,
+    0x7A, 0xE0, 0x46, 0x34, 0x59, 0xD5, 0x77, 0x45, 0xEA, 0xAD, 0xB7, 0x27, 0x42, 0x5A, 0x6B, 0xDF,
+    0xE8, 0xA8, 0x62, 0x9E, 0x4C, 0x18, 0x66, 0x4C, 0x29, 0x4C, 0x25, 0xCE, 0xEA, 0xFA, 0xDF, 0x7A,
+    0xED, 0xE3, 0x72, 0x54, 0x31, 0x5F, 0x2C, 0x19, 0x32, 0xBF, 0x97, 0x52, 0x0C, 0x40, 0x49, 0x4C,
+    0x1A, 0x5D, 0xD9, 0x7A, 0x81, 0x41, 0xB5, 0xA5, 0x7E, 0xA8, 0xBD, 0x29, 0xAD, 0xBA, 0x7A, 0xF7,
+    0xEA, 0x29, 0x91, 0x89, 0x7E, 0xE9, 0x14, 0x0B, 0xF3, 0x79, 0x2A, 0x32, 0x7D, 0xF4, 0xE6, 0xBD,
+    0xD7, 0xAD, 0xFE, 0xBF, 0x2C, 0xDB, 0x4D, 0x15, 0x06, 0xDE, 0xB8, 0x11, 0x79, 0x32, 0x26, 0xA6,
+    0x35, 0x8C, 0x2E, 0x82, 0x15, 0x0F, 0x71, 0x03, 0x2C, 0x11, 0x15, 0xAC, 0xA3, 0x47, 0x73, 0x46,
+    0xD7, 0xD6, 0x92, 0x27, 0x6F, 0xBF, 0x91, 0xFA, 0xAB, 0x12, 0x47, 0xF2, 0xE4, 0xB7, 0x8C, 0xB8,
+    0x9C, 0x86, 0xB4, 0xB2, 0xB0, 0xB5, 0x3F, 0x1F, 0xCB, 0x92, 0xC3, 0xDD, 0x93, 0x9E, 0x99, 0x74,
+    0x30, 0x0A, 0xB3, 0x6D, 0x47, 0x56, 0x47, 0x48, 0x7D, 0x0E, 0x2A, 0xD8, 0xE4, 0x79, 0xB6, 0xF4,
+    0x8B, 0xE2, 0x0B, 0x75, 0xFB, 0x7B, 0x17, 0x2D, 0x77, 0x22, 0xE9, 0x6B, 0x93, 0x92, 0x44, 0xC6,
+    0xD6, 0x31, 0x1D, 0x27, 0x0D, 0x79, 0x46, 0xBF, 0xB2, 0xDA, 0xAB, 0x26, 0xF5, 0x0D, 0xBD, 0x24,
+    0x2C, 0x91, 0x56, 0x8D, 0xA9, 0x74, 0xC8, 0xD5, 0xED, 0x5B, 0xD1, 0x92, 0x8F, 0xE2, 0x2C, 0x60,
+    0x98, 0xAB, 0x7A, 0x3D, 0xF5, 0x79, 0x5A, 0x4D, 0xB4, 0x3F, 0x3B, 0xE7, 0xB7, 0xCC, 0x89, 0x3F,
+    0xB3, 0x6C, 0xFD, 0x86, 0x0F, 0xE6, 0xC9, 0xCF, 0x2E, 0xB1, 0xF9, 0xB5, 0x1B, 0x7E, 0x20, 0x22,
+    0x87, 0xEE, 0xDD, 0x7B, 0xF3, 0x92, 0xCD, 0xF3, 0xC8, 0xED, 0x0B, 0x7F, 0x88, 0x3D, 0xF3, 0x1B,
+    0x9E, 0x37, 0xF5, 0x10, 0x5B, 0x0F, 0x1C, 0x13, 0x1D, 0xB1, 0xD5, 0x4A, 0xAB, 0xF7, 0xB3, 0x31,
+    0x75, 0x86, 0x81, 0x34, 0xDA, 0x5B, 0x32, 0xA2, 0xF6, 0x49, 0xBD, 0xAE, 0xC2, 0xEA, 0xD9, 0x25,
+    0xB6, 0xF2, 0x25, 0x4B, 0xBE, 0x60, 0x4E, 0x7A, 0x6B, 0x2E, 0x5C, 0x8B, 0xE9, 0xB3, 0x75, 0x5C,
+    0x57, 0x21, 0xAE, 0xEF, 0xDE, 0xB1, 0xDA, 0x5B, 0x73, 0xF2, 0x5A, 0x48, 0x2F, 0xF8, 0xD5, 0xAD,
+    0xA4, 0x8E, 0xE4, 0x34, 0x39, 0xE7, 0xC8, 0xB3, 0xCB, 0x53, 0xAC, 0x91, 0x3B, 0x5D, 0x7F, 0xB5,
+    0x39, 0xE8, 0x12, 0x49, 0x65, 0x02, 0x44, 0x92, 0x4B, 0x25, 0x46, 0x7E, 0x07, 0x13, 0x46, 0x2E,
+    0xAD, 0xAD, 0xD7, 0x21, 0x89, 0x44, 0x86, 0x94, 0x2C, 0xD1, 0xC3, 0x3A, 0x53, 0xA5, 0x5E, 0xD7,
+    0x3A, 0x32, 0x54, 0x63, 0xFA, 0x6A, 0x07, 0x7D, 0xEF, 0x3B, 0xB0, 0xF1, 0xEA, 0x9E, 0xAB, 0x95,
+    0xC9, 0x0E, 0x46, 0x64, 0xDF, 0x20, 0xD6, 0x32, 0xC1, 0xD6, 0x0F, 0xD3, 0xEF, 0xCA, 0x1C, 0xC3,
+    0xC1, 0x3B, 0x4F, 0x91, 0xC9, 0x84, 0xF4, 0x8D, 0x55, 0xB4, 0x87, 0x81, 0xD4, 0x0C, 0xBA, 0x84,
+    0xFC, 0x59, 0x10, 0x41, 0x35, 0x80, 0x5C, 0x85, 0x7E, 0x97, 0x5E, 0x90, 0xD3, 0x63, 0x81, 0x3E,
+    0xA6, 0xEA, 0xA3, 0xEB, 0x3E, 0xC4, 0x3E, 0x94, 0xFB, 0xB6, 0xCF, 0x0C, 0x44, 0xFC, 0x61, 0x99,
+    0x5E, 0xE2, 0x5C, 0x0F, 0x7A, 0xA9, 0xC7, 0xBA, 0xA6, 0x0B, 0x63, 0xE8, 0x9A, 0x92, 0x21, 0x3D,
+    0x32, 0xAC, 0xD3, 0x81, 0x4C, 0xE4, 0xFB, 0x22, 0x3B, 0xBB, 0xF2, 0xF5, 0x03, 0x24, 0xB7, 0x3C,
+    0x83, 0x80, 0x6E, 0x50, 0x13, 0x90, 0x97, 0x28, 0x46, 0x35, 0x36, 0x90, 0x34, 0x28, 0x81, 0xAB,
+    0x91, 0x83, 0x7B, 0x99, 0x24, 0x74, 0x3E, 0xFE, 0x45, 0x60, 0x20, 0x13, 0xE0, 0x61, 0x36, 0x5A,
+    0xFE, 0xE2, 0x69, 0x8B, 0xA3, 0xDD, 0x54, 0xA1, 0x82, 0x8A, 0x90, 0x84, 0x36, 0x43, 0x46, 0x45,
+    0xD0, 0x5E, 0x45, 0x45, 0xEA, 0x93, 0xB0, 0x11, 0xD3, 0x4A, 0xD7, 0x77, 0x26, 0xC6, 0x99, 0x1B,
+    0xA1, 0xB0, 0xCE, 0x9E, 0xF4, 0x85, 0xE5, 0x7C, 0xEA, 0xF3, 0xEC, 0xD0, 0xC4, 0x54, 0xDB, 0x7D,
+    0x09, 0xF6, 0x56, 0xD3, 0xBF, 0x83, 0x1D, 0xD5, 0xBB, 0xFB, 0xCF, 0x16, 0xF6, 0xE9, 0x0F, 0x05,
+    0xBB, 0x1C, 0x8F, 0x5D, 0x02, 0x9A, 0x8E, 0xDB, 0xAD, 0x54, 0x4B, 0x16, 0xF2, 0xB9, 0x36, 0x14,
+    0xBA, 0xBC, 0x08, 0xCB, 0xCB, 0x6D, 0x3E, 0x54, 0x11, 0x5A, 0x31, 0xBC, 0xDF, 0x76, 0xFF, 0xC7,
+    0xCF, 0x43, 0x14, 0x92, 0x7B, 0xDF, 0x24, 0xBD, 0xF2, 0x09, 0xEC, 0x82, 0x71, 0x4B, 0x0F, 0x19,
+    0xD7, 0x5A, 0x2C, 0xE3, 0xBA, 0xC0, 0x1E, 0xA4, 0x3B, 0x6D, 0x7C, 0x69, 0x63, 0x0C, 0x23, 0x71,
+    0x34, 0xC6, 0x1F, 0x7C, 0xE7, 0x53, 0xDF, 0xB2, 0x22, 0x13, 0x15, 0xB4, 0x4F, 0x82, 0xF6, 0x1F,
+    0xBB, 0x7B, 0x25, 0x7C, 0xEC, 0xE6, 0x95, 0x4B, 0xA9, 0x5F, 0xC1, 0xDC, 0x9A, 0x60, 0xA4, 0x7E,
+    0x8F, 0xE5, 0xEA, 0x75, 0x90, 0x5B, 0xC0, 0x47, 0x20, 0x91, 0x86, 0xBE, 0xEC, 0x30, 0xCD, 0x3F,
+    0x94, 0x34, 0xCB, 0xA4, 0xF5, 0x59, 0x6C, 0x75, 0x86, 0x8C, 0x4D, 0xFA, 0x04, 0x0A, 0xDE, 0x78,
+    0xAA, 0x50, 0xD2, 0xE4, 0xC9, 0xCD, 0x26, 0xD7, 0x3E, 0x16, 0xFA, 0x99, 0xB8, 0xA2, 0x4F, 0x84,
+    0x7E, 0xAA, 0x6B, 0xFB, 0x92, 0xF6, 0xA9, 0x8C, 0x3C, 0xA3, 0x69, 0xBB, 0x37, 0xE0, 0xD8, 0x2C,
+    0xBD, 0x2A, 0x8D, 0xA0, 0x27, 0x90, 0xBC, 0x09, 0xDC, 0xF6, 0x30, 0x6C, 0xE0, 0x5C, 0x0F, 0x2B,
+    0x22, 0xEA, 0xF4, 0x27, 0xDF, 0x71, 0xB6, 0x2A, 0xF9, 0x57, 0x37, 0xAF, 0x5C, 0x1A, 0x88, 0x4C,
+    0x54, 0x9B, 0x2B, 0x52, 0xB0, 0x8D, 0x71, 0x05, 0x49, 0xE8, 0xC3, 0xD0, 0x3A, 0xB2, 0x99, 0x0C,
+    0x81, 0x96, 0x09, 0x07, 0x99, 0xB4, 0xFE, 0x83, 0xF6, 0x90, 0x25, 0x97, 0x2F, 0x4F, 0x33, 0x91,
+    0x31, 0xFD, 0x06, 0xB3, 0x83, 0x15, 0x99, 0xF4, 0x6F, 0x5E, 0xBE, 0x58, 0xB6, 0x89, 0x37, 0xA9,
+    0x87, 0xAC, 0x3A, 0x40, 0xFF, 0x56, 0xA4, 0x3F, 0x0B, 0x84, 0x1E, 0xD9, 0xDB, 0xAE, 0xF2, 0x85,
+    0x07, 0x92, 0xB8, 0x4C, 0xE6, 0x6A, 0xC6, 0x29, 0xA9, 0x5F, 0xA4, 0x4F, 0x60, 0xAC, 0x2B, 0x5D,
+    0xCF, 0x63, 0xD9, 0x24, 0x4F, 0x3C, 0xCD, 0x1C, 0x3A, 0x1C, 0xC7, 0x5C, 0xAB, 0xB1, 0x2F, 0x41,
+    0xD6, 0x6A, 0x40, 0xA4, 0x55, 0x5B, 0xCD, 0xA3, 0x0A, 0xCE, 0x18, 0x88, 0x96, 0xE4, 0x9D, 0xD3,
+    0x4F, 0xF5, 0x45, 0x26, 0xE9, 0x1B, 0xE7, 0x56, 0xB5, 0xCF, 0x49, 0x7D, 0x89, 0xA9, 0xBA, 0x64,
+    0x59, 0x17, 0xB1, 0x44, 0x32, 0x15, 0xE9, 0x25, 0x81, 0x22, 0x09, 0xE4, 0xEA, 0x6E, 0x95, 0x33,
+    0xAA, 0xF6, 0xF9, 0x1A, 0xA3, 0x31, 0x0C, 0x24, 0x60, 0xEB, 0x0F, 0xB5, 0x61, 0xD0, 0xFE, 0x6C,
+    0x07, 0x50, 0xE6, 0xBA, 0x00, 0x88, 0x9E, 0x40, 0x6B, 0x4C, 0x6D, 0x0D, 0x0C, 0xD4, 0xF7, 0xBF,
+    0xF8, 0x4C, 0xFC, 0xCD, 0x3F, 0xF8, 0x83, 0x4C, 0x9F, 0x3D, 0xFB, 0xAF, 0xC3, 0x20, 0x3D, 0x5C,
+    0xAA, 0x3B, 0x41, 0xDC, 0x9C, 0x48, 0x85, 0x7F, 0xD9, 0xF3, 0xD0, 0xB1, 0x63, 0x90, 0x89, 0x5C,
+    0x17, 0x99, 0x09, 0x3A, 0x03, 0x91, 0x27, 0x45, 0x22, 0xEF, 0x17, 0xD7, 0x53, 0xEF, 0x9B, 0x1E,
+    0x2F, 0x72, 0x42, 0xC4, 0xB7, 0x19, 0x5C, 0x1F, 0xB9, 0xF2, 0xD7, 0x56, 0xC4, 0x31, 0x86, 0x6D,
+    0x7E, 0x75, 0x87, 0xFE, 0x98, 0xD4, 0x43, 0xD3, 0xA6, 0xAD, 0x74, 0xA1, 0xA6, 0xD6, 0x6C, 0x94,
+    0xEC, 0xA5, 0x82, 0x1D, 0xC2, 0xFE, 0x41, 0x40, 0x6A, 0x25, 0x8E, 0xDF, 0x88, 0x9F, 0xA5, 0x3F,
+    0x72, 0xE9, 0x0E, 0xE9, 0x04, 0x3E, 0xE5, 0x93, 0xBA, 0x24, 0x37, 0x55, 0xEA, 0x1B, 0x1A, 0xCB,
+    0x40, 0xC5, 0xCC, 0xF7, 0x25, 0x24, 0xBB, 0x59, 0xED, 0x6D, 0x5D, 0x8B, 0x08, 0x67, 0xCE, 0xC2,
+    0xE6, 0x59, 0xF8, 0xDC, 0xD7, 0xD7, 0x18, 0x88, 0x34, 0x87, 0xEE, 0x5E, 0xDE, 0x26, 0x30, 0xA7,
+    0x6A, 0x0E, 0x27, 0x37, 0x1E, 0x38, 0xAC, 0xBF, 0x3B, 0x9A, 0xD3, 0x3F, 0x7A, 0xF7, 0xBF, 0x6B,
+    0xFF, 0x4C, 0x63, 0x3D, 0xFC, 0xA6, 0x87, 0x5F, 0x09, 0xC0, 0x74, 0xBB, 0x9D, 0x2E, 0xBB, 0xBE,
+    0x7F, 0xEB, 0x8F, 0x16, 0x33, 0x67, 0x2E, 0xF5, 0xA0, 0x36, 0x1C, 0x4A, 0xA4, 0xA1, 0x7F, 0xEB,
+    0x56, 0x93, 0x34, 0x59, 0xD2, 0x4A, 0xC7, 0x65, 0x12, 0xAC, 0x0E, 0xD6, 0xE5, 0xD6, 0xE5, 0x2A,
+    0xE6, 0x44, 0x73, 0x2D, 0x42, 0xCF, 0x54, 0x6D, 0x56, 0x9E, 0xF6, 0x4D, 0xAB, 0xFB, 0xC8, 0x45,
+    0x32, 0x99, 0xD0, 0xE3, 0x6A, 0xB7, 0x07, 0x37, 0xA3, 0x24, 0x63, 0x48, 0x8F, 0x86, 0x92, 0xE6,
+    0xD7, 0x9A, 0x4C, 0xA4, 0xCE, 0xA4, 0xDD, 0xF8, 0xA2, 0xEB, 0xD6, 0xD4, 0x7E, 0xEC, 0x66, 0x45,
+    0xEA, 0xDB, 0x2E, 0x68, 0x43, 0x84, 0xEA, 0x00, 0xE8, 0xE7, 0x80, 0xEF, 0x79, 0x18, 0x35, 0x24,
+    0x22, 0x95, 0x96, 0xB9, 0x8B, 0xFA, 0xF6, 0x73, 0x24, 0xF1, 0x15, 0x4F, 0x73, 0x7C, 0x93, 0xED,
+    0x63, 0xCB, 0x14, 0x87, 0x1E, 0x78, 0xEF, 0xA6, 0xBF, 0xBC, 0xAB, 0x96, 0xDA, 0x4D, 0x6B, 0x6E,
+    0x40, 0x44, 0xFC, 0x40, 0x24, 0x80, 0x3A, 0x40, 0xF2, 0x22, 0x7C, 0xDF, 0x6B, 0x09, 0x4A, 0xA6,
+    0x0C, 0x4D, 0x5D, 0x30, 0xB6, 0xF4, 0x52, 0x6F, 0x9E, 0x0D, 0xA9, 0xBF, 0xF3, 0x5B, 0xF5, 0x40,
+    0x2A, 0xFB, 0xD5, 0x26, 0xF5, 0x59, 0x12, 0x74, 0xDD, 0x30, 0xCE, 0x29, 0x2C, 0x59, 0xEA, 0xB3,
+    0x67, 0x45, 0x2A, 0x99, 0x3A, 0xFD, 0x79, 0x78, 0xB5, 0xE2, 0xA8, 0xEB, 0x82, 0x4D, 0xBB, 0x03,
+    0xD7, 0x8F, 0x3C, 0xE6, 0x87, 0xF6, 0x87, 0x50, 0x52, 0xD2, 0xEE, 0x78, 0xC1, 0x3A, 0xEB, 0xE0,
+    0xDC, 0xDA, 0xB9, 0x55, 0x32, 0x11, 0xF1, 0x3C, 0xFA, 0xDA, 0x6F, 0xFD, 0x3E, 0x2C, 0xB1, 0x04,
+    0x34, 0x6D, 0x16, 0x45, 0x9B, 0x94, 0xDB, 0xEE, 0xE6, 0x18, 0x82, 0xEE, 0xC8, 0x9A, 0xED, 0x76,
+    0x33, 0xA3, 0xA2, 0x8A, 0xB4, 0xFB, 0x6A, 0x28, 0x68, 0x77, 0x99, 0x47, 0x48, 0x7D, 0xBB, 0x15,
+    0xA0, 0x37, 0xFB, 0x92, 0x78, 0xF1, 0x24, 0xE3, 0x64, 0x4F, 0xF9, 0x4F, 0xE4, 0x00, 0x5C, 0xFD,
+    0x41, 0x98, 0xA5, 0xFD, 0x38, 0x0A, 0x20, 0x7D, 0x4D, 0xB9, 0x54, 0xE2, 0x90, 0x47, 0xBF, 0x65,
+    0x1D, 0x5B, 0x44, 0xAC, 0xCB, 0xDA, 0x05, 0x22, 0xA3, 0x20, 0x09, 0xDA, 0x53, 0x90, 0xA3, 0xFD,
+    0x6E, 0x12, 0xB9, 0x75, 0x0C, 0x89, 0x58, 0x67, 0xDB, 0x66, 0xCE, 0xF6, 0xEF, 0xD2, 0x11, 0x4F,
+    0xB7, 0xB7, 0xAB, 0x2B, 0x34, 0x83, 0xAB, 0xDF, 0x7F, 0xCF, 0xC7, 0x4A, 0xD2, 0xD7, 0x4C, 0x95,
+    0x4A, 0xDC, 0xFA, 0x79, 0x0A, 0xCD, 0x7E, 0x7A, 0xA1, 0x90, 0x48, 0x5B, 0xDB, 0x30, 0xFD, 0x7E,
+    0x20, 0xEB, 0x6A, 0xDC, 0xD5, 0xB9, 0xAD, 0xF5, 0xA7, 0x5E, 0x53, 0x2E, 0x15, 0x91, 0x38, 0xE4,
+    0xD1, 0xD7, 0x7E, 0xEB, 0xF7, 0xAD, 0x63, 0xAB, 0x03, 0xD2, 0x15, 0xD1, 0x82, 0xC9, 0x58, 0x22,
+    0x09, 0x1D, 0xA0, 0x16, 0x52, 0x07, 0xAA, 0x85, 0xD5, 0x01, 0xEB, 0xDA, 0xA3, 0x6D, 0x91, 0x16,
+    0x5E, 0x0B, 0xB0, 0x83, 0xD8, 0x82, 0x6C, 0x61, 0xFE, 0x18, 0xD0, 0x6C, 0x3F, 0xD0, 0x62, 0x7F,
+    0x71, 0x25, 0xE9, 0x6B, 0x9F, 0x7A, 0x2D, 0xAD, 0x52, 0x11, 0x89, 0x5B, 0x3F, 0x05, 0x68, 0xF1,
+    0xCB, 0x04, 0x9A, 0x88, 0x03, 0x7D, 0x6F, 0x4C, 0x9B, 0x0A, 0x4F, 0x6C, 0x4D, 0x61, 0x84, 0x8C,
+    0x17, 0x56, 0x31, 0xCF, 0xCA, 0x04, 0x5D, 0x67, 0xBF, 0xBF, 0xFF, 0x4E, 0x8F, 0x12, 0x8C, 0xEB,
+    0xD1, 0x26, 0x30, 0x77, 0x77, 0xD4, 0xEC, 0x8E, 0x75, 0x19, 0x68, 0x9F, 0xDE, 0x84, 0xC8, 0xC8,
+    0xB7, 0x2C, 0xA1, 0xB7, 0xBB, 0x6B, 0xDE, 0x78, 0xDA, 0x8D, 0x68, 0xAD, 0x61, 0xDF, 0xE5, 0x70,
+    0x3B, 0xC0, 0xC6, 0xC8, 0xB5, 0x81, 0x9E, 0xF6, 0x9B, 0x21, 0xF5, 0x7C, 0x26, 0x66, 0xAF, 0x69,
+    0x89, 0x32, 0xB5, 0x2F, 0x5F, 0x7A, 0xFA, 0x29, 0xDB, 0x55, 0x6C, 0x01, 0x5B, 0xD1, 0x23, 0x6D,
+    0x28, 0x60, 0x4A, 0x0E, 0x59, 0x55, 0x42, 0xEA, 0x87, 0xA0, 0xFD, 0x16, 0xCE, 0xF8, 0x31, 0x77,
+    0x47, 0xEE, 0xEA, 0xC5, 0xD1, 0x4E, 0x5B, 0x18, 0x6D, 0x90, 0xA6, 0xCB, 0x1E, 0x41, 0x4B, 0xBB,
+    0x42, 0xD0, 0x7A, 0x36, 0x50, 0xD0, 0x07, 0x1D, 0xE8, 0xC3, 0xE0, 0x7F, 0xD4, 0x1B, 0x68, 0x91,
+    0x6B, 0xC2, 0x40, 0xA6, 0xA9, 0x68, 0x91, 0x30, 0x90, 0xBE, 0x4C, 0xB5, 0x4C, 0x07, 0x12, 0x07,
+    0x12, 0x07, 0xF2, 0xAC, 0x08, 0x03, 0x79, 0x5A, 0x22, 0x03, 0x11, 0x81, 0xC1, 0x3B, 0x12, 0x61,
+    0xF0, 0x84, 0x00, 0x45, 0x1A, 0x81, 0x95, 0x11, 0xC0, 0x20, 0xEE, 0x16, 0xC9, 0xDF, 0x01, 0xFE,
+    0x1F,
 };
 
 static const EpdGlyph notosans_12_italicGlyphs[] = {
@@ -1672,7 +1662,7 @@ static const EpdGlyph notosans_12_italicGlyphs[] = {
     { 3, 26, 14, 6, 19, 20, 5195 }, // |
     { 10, 22, 9, -1, 18, 55, 5215 }, // }
     { 13, 4, 14, 1, 11, 13, 5270 }, // ~
-    { 0, 0, 7, 0, 0, 0, 0 }, //  
+    { 0, 0, 7, 0, 0, 0, 5283 }, //  
     { 8, 19, 7, -1, 14, 38, 0 }, // ¡
     { 12, 20, 14, 2, 19, 60, 38 }, // ¢
     { 16, 19, 14, -1, 19, 76, 98 }, // £
@@ -1683,774 +1673,781 @@ static const EpdGlyph notosans_12_italicGlyphs[] = {
     { 8, 4, 14, 5, 19, 8, 364 }, // ¨
     { 19, 20, 21, 1, 19, 95, 372 }, // ©
     { 8, 10, 8, 2, 19, 20, 467 }, // ª
-    { 11, 11, 12, 1, 12, 31, 487 }, // «
-    { 13, 7, 14, 1, 10, 23, 518 }, // ¬
-    { 7, 3, 8, 0, 8, 6, 541 }, // ­
-    { 19, 20, 21, 1, 19, 95, 547 }, // ®
-    { 11, 2, 10, 2, 21, 6, 642 }, // ¯
-    { 9, 9, 11, 1, 19, 21, 648 }, // °
-    { 13, 15, 14, 1, 15, 49, 669 }, // ±
-    { 9, 12, 9, 1, 22, 27, 718 }, // ²
-    { 8, 12, 9, 2, 22, 24, 745 }, // ³
-    { 7, 5, 7, 2, 20, 9, 769 }, // ´
-    { 15, 20, 15, -1, 14, 75, 778 }, // µ
-    { 13, 23, 16, 2, 19, 75, 853 }, // ¶
-    { 4, 5, 6, 2, 11, 5, 928 }, // ·
-    { 6, 6, 5, -3, 0, 9, 933 }, // ¸
-    { 6, 12, 9, 3, 22, 18, 942 }, // ¹
-    { 8, 10, 8, 2, 19, 20, 960 }, // º
-    { 11, 11, 12, 0, 12, 31, 980 }, // »
-    { 16, 19, 18, 2, 19, 76, 1011 }, // ¼
-    { 18, 19, 20, 2, 19, 86, 1087 }, // ½
-    { 18, 19, 20, 1, 19, 86, 1173 }, // ¾
-    { 10, 19, 11, -1, 14, 48, 1259 }, // ¿
-    { 15, 24, 14, -2, 24, 90, 1307 }, // À
-    { 16, 24, 14, -2, 24, 96, 1397 }, // Á
-    { 16, 24, 14, -2, 24, 96, 1493 }, // Â
-    { 17, 23, 14, -2, 23, 98, 1589 }, // Ã
-    { 16, 23, 14, -2, 23, 92, 1687 }, // Ä
-    { 15, 25, 14, -2, 25, 94, 1779 }, // Å
-    { 24, 18, 21, -2, 18, 108, 1873 }, // Æ
-    { 15, 25, 15, 1, 19, 94, 1981 }, // Ç
-    { 13, 24, 13, 1, 24, 78, 2075 }, // È
-    { 13, 24, 13, 1, 24, 78, 2153 }, // É
-    { 13, 24, 13, 1, 24, 78, 2231 }, // Ê
-    { 13, 23, 13, 1, 23, 75, 2309 }, // Ë
-    { 11, 24, 8, -1, 24, 66, 2384 }, // Ì
-    { 12, 24, 8, -1, 24, 72, 2450 }, // Í
-    { 12, 24, 8, -1, 24, 72, 2522 }, // Î
-    { 12, 23, 8, -1, 23, 69, 2594 }, // Ï
-    { 16, 18, 17, 0, 18, 72, 2663 }, // Ð
-    { 17, 23, 18, 1, 23, 98, 2735 }, // Ñ
-    { 17, 25, 18, 1, 24, 107, 2833 }, // Ò
-    { 17, 25, 18, 1, 24, 107, 2940 }, // Ó
-    { 17, 25, 18, 1, 24, 107, 3047 }, // Ô
-    { 17, 24, 18, 1, 23, 102, 3154 }, // Õ
-    { 17, 24, 18, 1, 23, 102, 3256 }, // Ö
-    { 12, 12, 14, 2, 15, 36, 3358 }, // ×
-    { 17, 21, 18, 1, 19, 90, 3394 }, // Ø
-    { 17, 25, 17, 1, 24, 107, 3484 }, // Ù
-    { 17, 25, 17, 1, 24, 107, 3591 }, // Ú
-    { 17, 25, 17, 1, 24, 107, 3698 }, // Û
-    { 17, 24, 17, 1, 23, 102, 3805 }, // Ü
-    { 14, 24, 13, 2, 24, 84, 3907 }, // Ý
-    { 13, 18, 14, 1, 18, 59, 3991 }, // Þ
-    { 18, 26, 15, -4, 20, 117, 4050 }, // ß
-    { 13, 21, 14, 1, 20, 69, 4167 }, // à
-    { 13, 21, 14, 1, 20, 69, 4236 }, // á
-    { 13, 21, 14, 1, 20, 69, 4305 }, // â
-    { 13, 20, 14, 1, 19, 65, 4374 }, // ã
-    { 13, 20, 14, 1, 19, 65, 4439 }, // ä
-    { 13, 22, 14, 1, 21, 72, 4504 }, // å
-    { 19, 15, 21, 1, 14, 72, 4576 }, // æ
-    { 11, 20, 11, 1, 14, 55, 4648 }, // ç
-    { 11, 21, 12, 1, 20, 58, 4703 }, // è
-    { 12, 21, 12, 1, 20, 63, 4761 }, // é
-    { 11, 21, 12, 1, 20, 58, 4824 }, // ê
-    { 11, 20, 12, 1, 19, 55, 4882 }, // ë
-    { 7, 20, 6, 0, 20, 35, 4937 }, // ì
-    { 9, 20, 6, 0, 20, 45, 4972 }, // í
-    { 9, 20, 6, 0, 20, 45, 5017 }, // î
-    { 9, 19, 6, 0, 19, 43, 5062 }, // ï
-    { 13, 21, 14, 1, 20, 69, 5105 }, // ð
-    { 14, 19, 14, 0, 19, 67, 5174 }, // ñ
-    { 12, 21, 14, 1, 20, 63, 5241 }, // ò
-    { 12, 21, 14, 1, 20, 63, 5304 }, // ó
-    { 12, 21, 14, 1, 20, 63, 5367 }, // ô
-    { 13, 20, 14, 1, 19, 65, 5430 }, // õ
-    { 12, 20, 14, 1, 19, 60, 5495 }, // ö
-    { 13, 12, 14, 1, 15, 39, 5555 }, // ÷
-    { 14, 16, 14, 0, 15, 56, 5594 }, // ø
-    { 13, 21, 14, 1, 20, 69, 5650 }, // ù
-    { 13, 21, 14, 1, 20, 69, 5719 }, // ú
-    { 13, 21, 14, 1, 20, 69, 5788 }, // û
-    { 13, 20, 14, 1, 19, 65, 5857 }, // ü
-    { 16, 26, 12, -3, 20, 104, 5922 }, // ý
-    { 15, 25, 14, -1, 19, 94, 6026 }, // þ
-    { 16, 25, 12, -3, 19, 100, 6120 }, // ÿ
-    { 16, 21, 14, -2, 21, 84, 0 }, // Ā
-    { 13, 18, 14, 1, 17, 59, 84 }, // ā
-    { 16, 23, 14, -2, 23, 92, 143 }, // Ă
-    { 13, 20, 14, 1, 19, 65, 235 }, // ă
-    { 15, 24, 14, -2, 18, 90, 300 }, // Ą
-    { 13, 20, 14, 1, 14, 65, 390 }, // ą
-    { 15, 25, 15, 1, 24, 94, 455 }, // Ć
-    { 11, 21, 11, 1, 20, 58, 549 }, // ć
-    { 15, 25, 15, 1, 24, 94, 607 }, // Ĉ
-    { 11, 21, 11, 1, 20, 58, 701 }, // ĉ
-    { 15, 24, 15, 1, 23, 90, 759 }, // Ċ
-    { 11, 20, 11, 1, 19, 55, 849 }, // ċ
-    { 15, 25, 15, 1, 24, 94, 904 }, // Č
-    { 12, 21, 11, 1, 20, 63, 998 }, // č
-    { 15, 24, 17, 1, 24, 90, 1061 }, // Ď
-    { 19, 20, 15, 1, 19, 95, 1151 }, // ď
-    { 16, 18, 17, 0, 18, 72, 1246 }, // Đ
-    { 16, 20, 14, 1, 19, 80, 1318 }, // đ
-    { 13, 21, 13, 1, 21, 69, 1398 }, // Ē
-    { 11, 18, 12, 1, 17, 50, 1467 }, // ē
-    { 13, 23, 13, 1, 23, 75, 1517 }, // Ĕ
-    { 12, 20, 12, 1, 19, 60, 1592 }, // ĕ
-    { 13, 23, 13, 1, 23, 75, 1652 }, // Ė
-    { 11, 20, 12, 1, 19, 55, 1727 }, // ė
-    { 13, 24, 13, 1, 18, 78, 1782 }, // Ę
-    { 11, 20, 12, 1, 14, 55, 1860 }, // ę
-    { 14, 24, 13, 1, 24, 84, 1915 }, // Ě
-    { 12, 21, 12, 1, 20, 63, 1999 }, // ě
-    { 16, 25, 17, 1, 24, 100, 2062 }, // Ĝ
-    { 14, 26, 14, 0, 20, 91, 2162 }, // ĝ
-    { 16, 24, 17, 1, 23, 96, 2253 }, // Ğ
-    { 14, 25, 14, 0, 19, 88, 2349 }, // ğ
-    { 16, 24, 17, 1, 23, 96, 2437 }, // Ġ
-    { 14, 25, 14, 0, 19, 88, 2533 }, // ġ
-    { 16, 25, 17, 1, 19, 100, 2621 }, // Ģ
-    { 14, 26, 14, 0, 20, 91, 2721 }, // ģ
-    { 17, 24, 17, 1, 24, 102, 2812 }, // Ĥ
-    { 14, 26, 14, 0, 26, 91, 2914 }, // ĥ
-    { 18, 18, 17, 1, 18, 81, 3005 }, // Ħ
-    { 14, 19, 14, 0, 19, 67, 3086 }, // ħ
-    { 13, 23, 8, -1, 23, 75, 3153 }, // Ĩ
-    { 10, 19, 6, 0, 19, 48, 3228 }, // ĩ
-    { 12, 21, 8, -1, 21, 63, 3276 }, // Ī
-    { 9, 17, 6, 0, 17, 39, 3339 }, // ī
-    { 12, 23, 8, -1, 23, 69, 3378 }, // Ĭ
-    { 10, 19, 6, 0, 19, 48, 3447 }, // ĭ
-    { 11, 24, 8, -1, 18, 66, 3495 }, // Į
-    { 8, 25, 6, -1, 19, 50, 3561 }, // į
-    { 11, 23, 8, -1, 23, 64, 3611 }, // İ
-    { 6, 14, 6, 0, 14, 21, 3675 }, // ı
-    { 17, 23, 15, -1, 18, 98, 3696 }, // Ĳ
-    { 14, 25, 13, 0, 19, 88, 3794 }, // ĳ
-    { 14, 29, 7, -4, 24, 102, 3882 }, // Ĵ
-    { 13, 26, 6, -4, 20, 85, 3984 }, // ĵ
-    { 16, 24, 14, 1, 18, 96, 4069 }, // Ķ
-    { 14, 25, 12, 0, 19, 88, 4165 }, // ķ
-    { 14, 14, 12, 0, 14, 49, 4253 }, // ĸ
-    { 10, 24, 12, 1, 24, 60, 4302 }, // Ĺ
-    { 11, 26, 6, 0, 26, 72, 4362 }, // ĺ
-    { 10, 24, 12, 1, 18, 60, 4434 }, // Ļ
-    { 8, 25, 6, -1, 19, 50, 4494 }, // ļ
-    { 12, 18, 12, 1, 18, 54, 4544 }, // Ľ
-    { 11, 19, 7, 0, 19, 53, 4598 }, // ľ
-    { 10, 18, 12, 1, 18, 45, 4651 }, // Ŀ
-    { 9, 19, 7, 0, 19, 43, 4696 }, // ŀ
-    { 11, 18, 12, 0, 18, 50, 4739 }, // Ł
-    { 8, 19, 6, 0, 19, 38, 4789 }, // ł
-    { 17, 24, 18, 1, 24, 102, 4827 }, // Ń
-    { 14, 20, 14, 0, 20, 70, 4929 }, // ń
-    { 17, 24, 18, 1, 18, 102, 4999 }, // Ņ
-    { 14, 20, 14, 0, 14, 70, 5101 }, // ņ
-    { 17, 24, 18, 1, 24, 102, 5171 }, // Ň
-    { 14, 20, 14, 0, 20, 70, 5273 }, // ň
-    { 15, 18, 16, 1, 18, 68, 5343 }, // ŉ
-    { 17, 23, 18, 1, 18, 98, 5411 }, // Ŋ
-    { 14, 20, 14, 0, 14, 70, 5509 }, // ŋ
-    { 17, 22, 18, 1, 21, 94, 5579 }, // Ō
-    { 12, 18, 14, 1, 17, 54, 5673 }, // ō
-    { 17, 24, 18, 1, 23, 102, 5727 }, // Ŏ
-    { 12, 20, 14, 1, 19, 60, 5829 }, // ŏ
-    { 18, 25, 18, 1, 24, 113, 5889 }, // Ő
-    { 14, 21, 14, 1, 20, 74, 6002 }, // ő
-    { 22, 20, 21, 1, 19, 110, 6076 }, // Œ
-    { 20, 15, 22, 1, 14, 75, 6186 }, // œ
-    { 14, 24, 14, 1, 24, 84, 6261 }, // Ŕ
-    { 12, 20, 10, 0, 20, 60, 6345 }, // ŕ
-    { 14, 24, 14, 1, 18, 84, 6405 }, // Ŗ
-    { 12, 20, 10, -1, 14, 60, 6489 }, // ŗ
-    { 14, 24, 14, 1, 24, 84, 6549 }, // Ř
-    { 13, 20, 10, 0, 20, 65, 6633 }, // ř
-    { 13, 25, 13, 0, 24, 82, 6698 }, // Ś
-    { 11, 21, 11, 0, 20, 58, 6780 }, // ś
-    { 13, 25, 13, 0, 24, 82, 6838 }, // Ŝ
-    { 11, 21, 11, 0, 20, 58, 6920 }, // ŝ
-    { 13, 25, 13, 0, 19, 82, 6978 }, // Ş
-    { 11, 20, 11, 0, 14, 55, 7060 }, // ş
-    { 14, 25, 13, 0, 24, 88, 7115 }, // Š
-    { 12, 21, 11, 0, 20, 63, 7203 }, // š
-    { 14, 24, 13, 1, 18, 84, 7266 }, // Ţ
-    { 10, 23, 8, 0, 17, 58, 7350 }, // ţ
-    { 13, 24, 13, 2, 24, 78, 7408 }, // Ť
-    { 11, 20, 8, 1, 19, 55, 7486 }, // ť
-    { 13, 18, 13, 2, 18, 59, 7541 }, // Ŧ
-    { 10, 18, 8, 0, 17, 45, 7600 }, // ŧ
-    { 17, 24, 17, 1, 23, 102, 7645 }, // Ũ
-    { 13, 20, 14, 1, 19, 65, 7747 }, // ũ
-    { 17, 22, 17, 1, 21, 94, 7812 }, // Ū
-    { 13, 18, 14, 1, 17, 59, 7906 }, // ū
-    { 17, 24, 17, 1, 23, 102, 7965 }, // Ŭ
-    { 13, 20, 14, 1, 19, 65, 8067 }, // ŭ
-    { 17, 26, 17, 1, 25, 111, 8132 }, // Ů
-    { 13, 22, 14, 1, 21, 72, 8243 }, // ů
-    { 17, 25, 17, 1, 24, 107, 8315 }, // Ű
-    { 15, 21, 14, 1, 20, 79, 8422 }, // ű
-    { 17, 24, 17, 1, 18, 102, 8501 }, // Ų
-    { 13, 20, 14, 1, 14, 65, 8603 }, // ų
-    { 22, 24, 21, 2, 24, 132, 8668 }, // Ŵ
-    { 19, 20, 18, 1, 20, 95, 8800 }, // ŵ
-    { 14, 24, 13, 2, 24, 84, 8895 }, // Ŷ
-    { 16, 26, 12, -3, 20, 104, 8979 }, // ŷ
-    { 14, 23, 13, 2, 23, 81, 9083 }, // Ÿ
-    { 16, 24, 13, -1, 24, 96, 9164 }, // Ź
-    { 13, 20, 11, -1, 20, 65, 9260 }, // ź
-    { 16, 23, 13, -1, 23, 92, 9325 }, // Ż
-    { 12, 19, 11, -1, 19, 57, 9417 }, // ż
-    { 16, 24, 13, -1, 24, 96, 9474 }, // Ž
-    { 13, 20, 11, -1, 20, 65, 9570 }, // ž
-    { 15, 26, 7, -4, 20, 98, 9635 }, // ſ
-    { 5, 5, 0, -10, 20, 7, 0 }, // ̀
-    { 6, 5, 0, -6, 20, 8, 7 }, // ́
-    { 9, 5, 0, -3, 20, 12, 15 }, // ̂
-    { 10, 4, 0, -11, 19, 10, 27 }, // ̃
-    { 8, 2, 0, -2, 17, 4, 37 }, // ̄
-    { 11, 3, 0, -3, 22, 9, 41 }, // ̅
-    { 8, 4, 0, -2, 19, 8, 50 }, // ̆
-    { 4, 4, 0, 0, 19, 4, 58 }, // ̇
-    { 8, 4, 0, -2, 19, 8, 62 }, // ̈
-    { 6, 7, 0, -8, 21, 11, 70 }, // ̉
-    { 7, 6, 0, -1, 21, 11, 81 }, // ̊
-    { 10, 5, 0, -2, 20, 13, 92 }, // ̋
-    { 9, 5, 0, -2, 20, 12, 105 }, // ̌
-    { 4, 7, 0, 0, 19, 7, 117 }, // ̍
-    { 8, 5, 0, -2, 19, 10, 124 }, // ̎
-    { 10, 5, 0, -13, 20, 13, 134 }, // ̏
-    { 9, 7, 0, -2, 22, 16, 147 }, // ̐
-    { 8, 4, 0, -2, 19, 8, 163 }, // ̑
-    { 6, 7, 0, -1, 18, 11, 171 }, // ̒
-    { 6, 7, 0, -1, 18, 11, 182 }, // ̓
-    { 4, 7, 0, 0, 18, 7, 193 }, // ̔
-    { 6, 7, 0, -1, 18, 11, 200 }, // ̕
-    { 5, 5, 0, -5, 0, 7, 211 }, // ̖
-    { 6, 5, 0, -4, 0, 8, 218 }, // ̗
-    { 6, 6, 0, -5, 0, 9, 226 }, // ̘
-    { 6, 6, 0, -5, 0, 9, 235 }, // ̙
-    { 8, 7, 8, 2, 19, 14, 244 }, // ̚
-    { 6, 6, 0, -1, 19, 9, 258 }, // ̛
-    { 5, 6, 0, -2, 0, 8, 267 }, // ̜
-    { 6, 5, 0, -5, -1, 8, 275 }, // ̝
-    { 7, 5, 0, -5, -1, 9, 283 }, // ̞
-    { 6, 6, 0, -5, 0, 9, 292 }, // ̟
-    { 6, 3, 0, -5, -2, 5, 301 }, // ̠
-    { 6, 8, 0, -5, 2, 12, 306 }, // ̡
-    { 5, 8, 0, -3, 2, 10, 318 }, // ̢
-    { 4, 4, 0, -11, -1, 4, 328 }, // ̣
-    { 8, 4, 0, -6, -1, 8, 332 }, // ̤
-    { 6, 6, 0, -5, 0, 9, 340 }, // ̥
-    { 5, 5, 0, 1, -1, 7, 349 }, // ̦
-    { 6, 6, 0, -5, 0, 9, 356 }, // ̧
-    { 5, 6, 0, -4, 0, 8, 365 }, // ̨
-    { 4, 7, 0, -4, -1, 7, 373 }, // ̩
-    { 10, 5, 0, -7, -1, 13, 380 }, // ̪
-    { 11, 4, 0, -7, -1, 11, 393 }, // ̫
-    { 9, 5, 0, -6, 0, 12, 404 }, // ̬
-    { 8, 5, 0, -6, 0, 10, 416 }, // ̭
-    { 9, 4, 0, -6, -1, 9, 426 }, // ̮
-    { 8, 4, 0, -6, -1, 8, 435 }, // ̯
-    { 10, 4, 0, -7, -1, 10, 443 }, // ̰
-    { 8, 2, 0, -6, -2, 4, 453 }, // ̱
-    { 12, 2, 0, -8, -2, 6, 457 }, // ̲
-    { 12, 6, 0, -8, 0, 18, 463 }, // ̳
-    { 10, 4, 0, -5, 9, 10, 481 }, // ̴
-    { 10, 3, 0, -5, 9, 8, 491 }, // ̵
-    { 18, 2, 0, -9, 8, 9, 499 }, // ̶
-    { 8, 6, 0, -4, 10, 12, 508 }, // ̷
-    { 14, 21, 0, -7, 19, 74, 520 }, // ̸
-    { 4, 6, 0, -2, 0, 6, 594 }, // ̹
-    { 10, 5, 0, -7, -1, 13, 600 }, // ̺
-    { 10, 6, 0, -7, 0, 15, 613 }, // ̻
-    { 10, 4, 0, -7, -1, 10, 628 }, // ̼
-    { 7, 6, 0, -1, 20, 11, 638 }, // ̽
-    { 6, 8, 0, -1, 22, 12, 649 }, // ̾
-    { 12, 6, 0, -3, 25, 18, 661 }, // ̿
-    { 6, 5, 0, -2, 20, 8, 679 }, // ̀
-    { 7, 5, 0, 0, 20, 9, 687 }, // ́
-    { 10, 4, 0, 4, 19, 10, 696 }, // ͂
-    { 5, 5, 0, 0, 20, 7, 706 }, // ̓
-    { 10, 5, 0, -3, 20, 13, 713 }, // ̈́
-    { 4, 4, 0, -3, -2, 4, 726 }, // ͅ
-    { 12, 6, 0, -4, 20, 18, 730 }, // ͆
-    { 12, 6, 0, -8, 0, 18, 748 }, // ͇
-    { 8, 5, 0, -6, -1, 10, 766 }, // ͈
-    { 5, 5, 0, -4, -1, 7, 776 }, // ͉
-    { 10, 6, 0, -3, 20, 15, 783 }, // ͊
-    { 11, 10, 0, -3, 24, 28, 798 }, // ͋
-    { 11, 7, 0, -3, 22, 20, 826 }, // ͌
-    { 10, 6, 0, -7, 0, 15, 846 }, // ͍
-    { 5, 6, 0, -4, 0, 8, 861 }, // ͎
-    { 18, 18, 0, -9, 18, 81, 869 }, // ͏
-    { 5, 6, 0, 0, 20, 8, 950 }, // ͐
-    { 4, 6, 0, 3, 21, 6, 958 }, // ͑
-    { 8, 7, 0, -2, 22, 14, 964 }, // ͒
-    { 5, 6, 0, -4, 0, 8, 978 }, // ͓
-    { 5, 5, 0, -4, -1, 7, 986 }, // ͔
-    { 5, 5, 0, -4, -1, 7, 993 }, // ͕
-    { 10, 5, 0, -6, -1, 13, 1000 }, // ͖
-    { 4, 6, 0, 2, 21, 6, 1013 }, // ͗
-    { 4, 4, 0, 0, 19, 4, 1019 }, // ͘
-    { 6, 6, 0, -5, 0, 9, 1023 }, // ͙
-    { 10, 6, 0, -7, 0, 15, 1032 }, // ͚
-    { 5, 6, 0, 0, 20, 8, 1047 }, // ͛
-    { 19, 5, 0, -11, -1, 24, 1055 }, // ͜
-    { 18, 5, 0, -7, 19, 23, 1079 }, // ͝
-    { 14, 2, 0, -5, 17, 7, 1102 }, // ͞
-    { 14, 2, 0, -9, -2, 7, 1109 }, // ͟
-    { 19, 4, 0, -7, 19, 19, 1116 }, // ͠
-    { 19, 6, 0, -7, 22, 29, 1135 }, // ͡
-    { 19, 6, 0, -12, 0, 29, 1164 }, // ͢
-    { 7, 6, 0, -1, 21, 11, 1193 }, // ͣ
-    { 5, 6, 0, 0, 21, 8, 1204 }, // ͤ
-    { 4, 8, 0, 1, 23, 8, 1212 }, // ͥ
-    { 7, 6, 0, -1, 21, 11, 1220 }, // ͦ
-    { 7, 6, 0, -1, 21, 11, 1231 }, // ͧ
-    { 6, 6, 0, 0, 21, 9, 1242 }, // ͨ
-    { 7, 9, 0, -1, 24, 16, 1251 }, // ͩ
-    { 7, 9, 0, -1, 24, 16, 1267 }, // ͪ
-    { 10, 6, 0, -3, 21, 15, 1283 }, // ͫ
-    { 6, 6, 0, 0, 21, 9, 1298 }, // ͬ
-    { 4, 8, 0, 1, 23, 8, 1307 }, // ͭ
-    { 6, 6, 0, 0, 21, 9, 1315 }, // ͮ
-    { 7, 6, 0, -1, 21, 11, 1324 }, // ͯ
-    { 14, 24, 13, 0, 24, 84, 0 }, // Ѐ
-    { 14, 23, 13, 0, 23, 81, 84 }, // Ё
-    { 14, 19, 17, 2, 18, 67, 165 }, // Ђ
-    { 14, 24, 12, 0, 24, 84, 232 }, // Ѓ
-    { 15, 20, 15, 1, 19, 75, 316 }, // Є
-    { 13, 20, 13, 0, 19, 65, 391 }, // Ѕ
-    { 7, 18, 7, 0, 18, 32, 456 }, // І
-    { 10, 23, 7, 0, 23, 58, 488 }, // Ї
-    { 12, 23, 7, -4, 18, 69, 546 }, // Ј
-    { 24, 19, 23, -1, 18, 114, 615 }, // Љ
-    { 22, 18, 23, 0, 18, 99, 729 }, // Њ
-    { 14, 18, 17, 2, 18, 63, 828 }, // Ћ
-    { 17, 24, 14, 0, 24, 102, 891 }, // Ќ
-    { 18, 24, 17, 0, 24, 108, 993 }, // Ѝ
-    { 17, 24, 14, 0, 23, 102, 1101 }, // Ў
-    { 17, 22, 17, 0, 18, 94, 1203 }, // Џ
-    { 15, 18, 14, -2, 18, 68, 1297 }, // А
-    { 15, 18, 14, 0, 18, 68, 1365 }, // Б
-    { 15, 18, 15, 0, 18, 68, 1433 }, // В
-    { 14, 18, 12, 0, 18, 63, 1501 }, // Г
-    { 21, 22, 17, -3, 18, 116, 1564 }, // Д
-    { 14, 18, 13, 0, 18, 63, 1680 }, // Е
-    { 25, 18, 20, -2, 18, 113, 1743 }, // Ж
-    { 14, 20, 13, -1, 19, 70, 1856 }, // З
-    { 18, 18, 17, 0, 18, 81, 1926 }, // И
-    { 18, 23, 17, 0, 23, 104, 2007 }, // Й
-    { 17, 18, 14, 0, 18, 77, 2111 }, // К
-    { 18, 19, 17, -1, 18, 86, 2188 }, // Л
-    { 21, 18, 21, 0, 18, 95, 2274 }, // М
-    { 17, 18, 17, 0, 18, 77, 2369 }, // Н
-    { 16, 20, 17, 1, 19, 80, 2446 }, // О
-    { 17, 18, 17, 0, 18, 77, 2526 }, // П
-    { 15, 18, 14, 0, 18, 68, 2603 }, // Р
-    { 15, 20, 15, 1, 19, 75, 2671 }, // С
-    { 13, 18, 13, 2, 18, 59, 2746 }, // Т
-    { 17, 19, 14, 0, 18, 81, 2805 }, // У
-    { 19, 20, 20, 1, 19, 95, 2886 }, // Ф
-    { 18, 18, 13, -2, 18, 81, 2981 }, // Х
-    { 17, 22, 17, 0, 18, 94, 3062 }, // Ц
-    { 14, 18, 16, 2, 18, 63, 3156 }, // Ч
-    { 24, 18, 24, 0, 18, 108, 3219 }, // Ш
-    { 24, 22, 24, 0, 18, 132, 3327 }, // Щ
-    { 13, 18, 16, 2, 18, 59, 3459 }, // Ъ
-    { 20, 18, 20, 0, 18, 90, 3518 }, // Ы
-    { 13, 18, 14, 0, 18, 59, 3608 }, // Ь
-    { 15, 20, 15, 0, 19, 75, 3667 }, // Э
-    { 23, 20, 24, 0, 19, 115, 3742 }, // Ю
-    { 16, 18, 14, -1, 18, 72, 3857 }, // Я
-    { 13, 15, 14, 1, 14, 49, 3929 }, // а
-    { 14, 21, 14, 1, 20, 74, 3978 }, // б
-    { 13, 15, 13, 0, 14, 49, 4052 }, // в
-    { 11, 15, 11, 0, 14, 42, 4101 }, // г
-    { 13, 21, 14, 1, 20, 69, 4143 }, // д
-    { 11, 15, 12, 1, 14, 42, 4212 }, // е
-    { 24, 15, 22, -1, 14, 90, 4254 }, // ж
-    { 11, 15, 11, 0, 14, 42, 4344 }, // з
-    { 13, 15, 14, 1, 14, 49, 4386 }, // и
-    { 13, 20, 14, 1, 19, 65, 4435 }, // й
-    { 14, 14, 13, 0, 14, 49, 4500 }, // к
-    { 16, 15, 14, -2, 14, 60, 4549 }, // л
-    { 19, 14, 19, 0, 14, 67, 4609 }, // м
-    { 14, 14, 14, 0, 14, 49, 4676 }, // н
-    { 14, 15, 14, 0, 14, 53, 4725 }, // о
-    { 13, 14, 14, 0, 14, 46, 4778 }, // п
-    { 15, 20, 14, -1, 14, 75, 4824 }, // р
-    { 12, 15, 12, 0, 14, 45, 4899 }, // с
-    { 21, 14, 22, 0, 14, 74, 4944 }, // т
-    { 17, 20, 12, -3, 14, 85, 5018 }, // у
-    { 16, 25, 17, 0, 19, 100, 5103 }, // ф
-    { 15, 14, 11, -2, 14, 53, 5203 }, // х
-    { 13, 18, 15, 1, 14, 59, 5256 }, // ц
-    { 13, 14, 14, 1, 14, 46, 5315 }, // ч
-    { 21, 15, 22, 1, 14, 79, 5361 }, // ш
-    { 21, 18, 22, 1, 14, 95, 5440 }, // щ
-    { 13, 15, 15, 1, 14, 49, 5535 }, // ъ
-    { 17, 15, 18, 1, 14, 64, 5584 }, // ы
-    { 11, 15, 13, 1, 14, 42, 5648 }, // ь
-    { 11, 15, 12, 0, 14, 42, 5690 }, // э
-    { 19, 15, 19, 0, 14, 72, 5732 }, // ю
-    { 14, 14, 13, -1, 14, 49, 5804 }, // я
-    { 11, 21, 12, 1, 20, 58, 5853 }, // ѐ
-    { 12, 20, 12, 1, 19, 60, 5911 }, // ё
-    { 13, 25, 14, 0, 19, 82, 5971 }, // ђ
-    { 12, 21, 11, 0, 20, 63, 6053 }, // ѓ
-    { 12, 15, 12, 0, 14, 45, 6116 }, // є
-    { 11, 15, 11, 0, 14, 42, 6161 }, // ѕ
-    { 7, 19, 6, 0, 19, 34, 6203 }, // і
-    { 9, 19, 6, 0, 19, 43, 6237 }, // ї
-    { 11, 25, 6, -4, 19, 69, 6280 }, // ј
-    { 22, 15, 20, -2, 14, 83, 6349 }, // љ
-    { 19, 15, 20, 0, 14, 72, 6432 }, // њ
-    { 14, 19, 14, 0, 19, 67, 6504 }, // ћ
-    { 14, 20, 13, 0, 20, 70, 6571 }, // ќ
-    { 13, 21, 14, 1, 20, 69, 6641 }, // ѝ
-    { 17, 25, 12, -3, 19, 107, 6710 }, // ў
-    { 13, 19, 14, 1, 14, 62, 6817 }, // џ
-    { 23, 19, 23, 2, 18, 110, 6879 }, // Ѡ
-    { 20, 14, 20, 1, 14, 70, 6989 }, // ѡ
-    { 13, 18, 15, 1, 18, 59, 7059 }, // Ѣ
-    { 20, 15, 21, 0, 14, 75, 7118 }, // ѣ
-    { 22, 20, 22, 1, 19, 110, 7193 }, // Ѥ
-    { 18, 15, 17, 0, 14, 68, 7303 }, // ѥ
-    { 16, 18, 15, -2, 18, 72, 7371 }, // Ѧ
-    { 14, 14, 13, -2, 14, 49, 7443 }, // ѧ
-    { 19, 18, 21, 1, 18, 86, 7492 }, // Ѩ
-    { 17, 14, 18, 0, 14, 60, 7578 }, // ѩ
-    { 19, 18, 17, -1, 18, 86, 7638 }, // Ѫ
-    { 17, 14, 15, -2, 14, 60, 7724 }, // ѫ
-    { 23, 18, 23, 1, 18, 104, 7784 }, // Ѭ
-    { 20, 14, 20, 0, 14, 70, 7888 }, // ѭ
-    { 15, 28, 13, -1, 22, 105, 7958 }, // Ѯ
-    { 14, 22, 11, -2, 17, 77, 8063 }, // ѯ
-    { 19, 18, 19, 2, 18, 86, 8140 }, // Ѱ
-    { 16, 25, 18, 1, 19, 100, 8226 }, // ѱ
-    { 17, 20, 18, 1, 19, 85, 8326 }, // Ѳ
-    { 12, 15, 14, 1, 14, 45, 8411 }, // ѳ
-    { 15, 18, 14, 2, 18, 68, 8456 }, // Ѵ
-    { 13, 14, 11, 1, 14, 46, 8524 }, // ѵ
-    { 15, 24, 14, 2, 24, 90, 8570 }, // Ѷ
-    { 13, 20, 11, 1, 20, 65, 8660 }, // ѷ
-    { 30, 25, 30, 1, 19, 188, 8725 }, // Ѹ
-    { 26, 20, 26, 1, 14, 130, 8913 }, // ѹ
-    { 17, 22, 19, 1, 20, 94, 9043 }, // Ѻ
-    { 13, 17, 15, 1, 15, 56, 9137 }, // ѻ
-    { 23, 27, 24, 1, 26, 156, 9193 }, // Ѽ
-    { 18, 23, 20, 1, 22, 104, 9349 }, // ѽ
-    { 23, 24, 23, 2, 23, 138, 9453 }, // Ѿ
-    { 20, 18, 20, 1, 18, 90, 9591 }, // ѿ
-    { 15, 25, 15, 1, 19, 94, 9681 }, // Ҁ
-    { 11, 20, 11, 1, 14, 55, 9775 }, // ҁ
-    { 14, 17, 15, 1, 16, 60, 9830 }, // ҂
-    { 10, 4, 0, -10, 18, 10, 9890 }, // ҃
-    { 10, 4, 0, -10, 19, 10, 9900 }, // ҄
-    { 4, 5, 0, -7, 20, 5, 9910 }, // ҅
-    { 4, 5, 0, -7, 20, 5, 9915 }, // ҆
-    { 10, 4, 0, -2, 23, 10, 9920 }, // ҇
-    { 30, 27, 0, -15, 20, 203, 9930 }, // ҈
-    { 28, 28, 0, -14, 21, 196, 10133 }, // ҉
-    { 17, 29, 18, 1, 24, 124, 10329 }, // Ҋ
-    { 13, 24, 15, 1, 19, 78, 10453 }, // ҋ
-    { 12, 18, 14, 1, 18, 54, 10531 }, // Ҍ
-    { 11, 20, 13, 1, 19, 55, 10585 }, // ҍ
-    { 14, 18, 14, 1, 18, 63, 10640 }, // Ҏ
-    { 15, 20, 14, -1, 14, 75, 10703 }, // ҏ
-    { 14, 22, 12, 1, 22, 77, 10778 }, // Ґ
-    { 12, 18, 10, 0, 18, 54, 10855 }, // ґ
-    { 14, 18, 12, 0, 18, 63, 10909 }, // Ғ
-    { 11, 14, 10, 0, 14, 39, 10972 }, // ғ
-    { 13, 25, 15, 1, 18, 82, 11011 }, // Ҕ
-    { 11, 21, 12, 0, 14, 58, 11093 }, // ҕ
-    { 24, 23, 21, -2, 18, 138, 11151 }, // Җ
-    { 23, 19, 21, -1, 14, 110, 11289 }, // җ
-    { 14, 25, 13, -1, 19, 88, 11399 }, // Ҙ
-    { 11, 20, 11, 0, 14, 55, 11487 }, // ҙ
-    { 16, 23, 15, 1, 18, 92, 11542 }, // Қ
-    { 14, 19, 13, 0, 14, 67, 11634 }, // қ
-    { 16, 18, 14, 1, 18, 72, 11701 }, // Ҝ
-    { 14, 14, 12, 0, 14, 49, 11773 }, // ҝ
-    { 16, 18, 14, 1, 18, 72, 11822 }, // Ҟ
-    { 14, 19, 12, 0, 19, 67, 11894 }, // ҟ
-    { 17, 18, 16, 2, 18, 77, 11961 }, // Ҡ
-    { 16, 14, 14, 0, 14, 56, 12038 }, // ҡ
-    { 17, 23, 17, 1, 18, 98, 12094 }, // Ң
-    { 15, 19, 15, 0, 14, 72, 12192 }, // ң
-    { 21, 18, 19, 1, 18, 95, 12264 }, // Ҥ
-    { 19, 14, 17, 0, 14, 67, 12359 }, // ҥ
-    { 22, 25, 25, 1, 18, 138, 12426 }, // Ҧ
-    { 19, 21, 21, 0, 14, 100, 12564 }, // ҧ
-    { 17, 21, 18, 1, 19, 90, 12664 }, // Ҩ
-    { 13, 15, 15, 1, 14, 49, 12754 }, // ҩ
-    { 15, 25, 15, 1, 19, 94, 12803 }, // Ҫ
-    { 11, 20, 11, 1, 14, 55, 12897 }, // ҫ
-    { 13, 23, 13, 2, 18, 75, 12952 }, // Ҭ
-    { 21, 19, 22, 0, 14, 100, 13027 }, // ҭ
-    { 14, 18, 13, 2, 18, 63, 13127 }, // Ү
-    { 12, 20, 12, 1, 14, 60, 13190 }, // ү
-    { 15, 18, 13, 1, 18, 68, 13250 }, // Ұ
-    { 14, 20, 12, -1, 14, 70, 13318 }, // ұ
-    { 18, 23, 15, -2, 18, 104, 13388 }, // Ҳ
-    { 15, 19, 13, -1, 14, 72, 13492 }, // ҳ
-    { 18, 23, 20, 2, 18, 104, 13564 }, // Ҵ
-    { 15, 19, 16, 1, 14, 72, 13668 }, // ҵ
-    { 15, 23, 16, 2, 18, 87, 13740 }, // Ҷ
-    { 13, 19, 14, 1, 14, 62, 13827 }, // ҷ
-    { 15, 18, 16, 2, 18, 68, 13889 }, // Ҹ
-    { 13, 14, 14, 1, 14, 46, 13957 }, // ҹ
-    { 14, 18, 16, 1, 18, 63, 14003 }, // Һ
-    { 14, 19, 14, 0, 19, 67, 14066 }, // һ
-    { 18, 20, 19, 1, 19, 90, 14133 }, // Ҽ
-    { 15, 15, 15, 0, 14, 57, 14223 }, // ҽ
-    { 18, 24, 19, 1, 19, 108, 14280 }, // Ҿ
-    { 15, 19, 15, 0, 14, 72, 14388 }, // ҿ
-    { 11, 18, 8, -1, 18, 50, 14460 }, // Ӏ
-    { 25, 23, 20, -2, 23, 144, 14510 }, // Ӂ
-    { 24, 20, 22, -1, 19, 120, 14654 }, // ӂ
-    { 16, 25, 16, 1, 18, 100, 14774 }, // Ӄ
-    { 14, 21, 13, 0, 14, 74, 14874 }, // ӄ
-    { 18, 23, 17, -1, 18, 104, 14948 }, // Ӆ
-    { 15, 19, 14, -2, 14, 72, 15052 }, // ӆ
-    { 17, 25, 17, 1, 18, 107, 15124 }, // Ӈ
-    { 15, 21, 15, 0, 14, 79, 15231 }, // ӈ
-    { 17, 23, 17, 1, 18, 98, 15310 }, // Ӊ
-    { 15, 19, 15, 0, 14, 72, 15408 }, // ӊ
-    { 15, 23, 16, 2, 18, 87, 15480 }, // Ӌ
-    { 12, 19, 15, 2, 14, 57, 15567 }, // ӌ
-    { 21, 23, 21, 1, 18, 121, 15624 }, // Ӎ
-    { 17, 19, 18, 0, 14, 81, 15745 }, // ӎ
-    { 11, 18, 8, -1, 18, 50, 15826 }, // ӏ
-    { 17, 23, 14, -2, 23, 98, 15876 }, // Ӑ
-    { 13, 20, 14, 1, 19, 65, 15974 }, // ӑ
-    { 16, 23, 14, -2, 23, 92, 16039 }, // Ӓ
-    { 13, 20, 14, 1, 19, 65, 16131 }, // ӓ
-    { 24, 18, 21, -2, 18, 108, 16196 }, // Ӕ
-    { 19, 15, 21, 1, 14, 72, 16304 }, // ӕ
-    { 14, 23, 13, 1, 23, 81, 16376 }, // Ӗ
-    { 13, 20, 12, 1, 19, 65, 16457 }, // ӗ
-    { 15, 20, 17, 1, 19, 75, 16522 }, // Ә
-    { 12, 15, 12, 0, 14, 45, 16597 }, // ә
-    { 15, 24, 17, 1, 23, 90, 16642 }, // Ӛ
-    { 12, 20, 12, 0, 19, 60, 16732 }, // ӛ
-    { 25, 23, 20, -2, 23, 144, 16792 }, // Ӝ
-    { 24, 20, 22, -1, 19, 120, 16936 }, // ӝ
-    { 14, 24, 13, -1, 23, 84, 17056 }, // Ӟ
-    { 11, 20, 11, 0, 19, 55, 17140 }, // ӟ
-    { 14, 19, 13, 0, 18, 67, 17195 }, // Ӡ
-    { 14, 20, 12, -2, 14, 70, 17262 }, // ӡ
-    { 18, 21, 17, 0, 21, 95, 17332 }, // Ӣ
-    { 13, 18, 14, 1, 17, 59, 17427 }, // ӣ
-    { 18, 23, 17, 0, 23, 104, 17486 }, // Ӥ
-    { 13, 20, 14, 1, 19, 65, 17590 }, // ӥ
-    { 17, 24, 18, 1, 23, 102, 17655 }, // Ӧ
-    { 12, 20, 14, 1, 19, 60, 17757 }, // ӧ
-    { 17, 20, 18, 1, 19, 85, 17817 }, // Ө
-    { 12, 15, 14, 1, 14, 45, 17902 }, // ө
-    { 17, 24, 18, 1, 23, 102, 17947 }, // Ӫ
-    { 12, 20, 14, 1, 19, 60, 18049 }, // ӫ
-    { 15, 24, 15, 0, 23, 90, 18109 }, // Ӭ
-    { 11, 20, 12, 0, 19, 55, 18199 }, // ӭ
-    { 17, 22, 14, 0, 21, 94, 18254 }, // Ӯ
-    { 16, 23, 12, -3, 17, 92, 18348 }, // ӯ
-    { 17, 24, 14, 0, 23, 102, 18440 }, // Ӱ
-    { 16, 25, 12, -3, 19, 100, 18542 }, // ӱ
-    { 17, 25, 14, 0, 24, 107, 18642 }, // Ӳ
-    { 17, 26, 12, -3, 20, 111, 18749 }, // ӳ
-    { 14, 23, 16, 2, 23, 81, 18860 }, // Ӵ
-    { 13, 19, 14, 1, 19, 62, 18941 }, // ӵ
-    { 13, 23, 12, 1, 18, 75, 19003 }, // Ӷ
-    { 11, 19, 10, 0, 14, 53, 19078 }, // ӷ
-    { 20, 23, 20, 0, 23, 115, 19131 }, // Ӹ
-    { 17, 20, 18, 1, 19, 85, 19246 }, // ӹ
-    { 14, 23, 12, 0, 18, 81, 19331 }, // Ӻ
-    { 12, 19, 10, -1, 14, 57, 19412 }, // ӻ
-    { 18, 23, 13, -2, 18, 104, 19469 }, // Ӽ
-    { 14, 19, 12, -1, 14, 67, 19573 }, // ӽ
-    { 18, 18, 13, -2, 18, 81, 19640 }, // Ӿ
-    { 14, 14, 12, -1, 14, 49, 19721 }, // ӿ
-    { 0, 0, 13, 0, 0, 0, 0 }, //  
-    { 0, 0, 25, 0, 0, 0, 0 }, //  
-    { 0, 0, 13, 0, 0, 0, 0 }, //  
-    { 0, 0, 25, 0, 0, 0, 0 }, //  
-    { 0, 0, 8, 0, 0, 0, 0 }, //  
-    { 0, 0, 6, 0, 0, 0, 0 }, //  
-    { 0, 0, 4, 0, 0, 0, 0 }, //  
-    { 0, 0, 14, 0, 0, 0, 0 }, //  
-    { 0, 0, 6, 0, 0, 0, 0 }, //  
-    { 0, 0, 4, 0, 0, 0, 0 }, //  
-    { 0, 0, 3, 0, 0, 0, 0 }, //  
-    { 0, 0, 0, 0, 0, 0, 0 }, // ​
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‍
-    { 7, 22, 0, -1, 18, 39, 0 }, // ‎
-    { 7, 22, 0, -6, 18, 39, 39 }, // ‏
-    { 7, 3, 8, 0, 8, 6, 78 }, // ‐
-    { 7, 3, 8, 0, 8, 6, 84 }, // ‑
-    { 13, 2, 14, 1, 10, 7, 90 }, // ‒
-    { 12, 3, 12, 0, 8, 9, 97 }, // –
-    { 24, 3, 24, 0, 8, 18, 106 }, // —
-    { 24, 3, 24, 0, 8, 18, 124 }, // ―
-    { 9, 26, 14, 3, 19, 59, 142 }, // ‖
-    { 12, 6, 10, -3, 0, 18, 201 }, // ‗
-    { 6, 7, 4, 1, 18, 11, 219 }, // ‘
-    { 6, 7, 4, 1, 18, 11, 230 }, // ’
-    { 6, 7, 6, -2, 3, 11, 241 }, // ‚
-    { 4, 7, 4, 2, 18, 7, 252 }, // ‛
-    { 11, 7, 9, 1, 18, 20, 259 }, // “
-    { 11, 7, 9, 1, 18, 20, 279 }, // ”
-    { 11, 7, 11, -2, 3, 20, 299 }, // „
-    { 8, 7, 9, 2, 18, 14, 319 }, // ‟
-    { 10, 19, 12, 2, 19, 48, 333 }, // †
-    { 13, 19, 12, 0, 19, 62, 381 }, // ‡
-    { 6, 7, 9, 2, 13, 11, 443 }, // •
-    { 8, 8, 9, 1, 13, 16, 454 }, // ‣
-    { 4, 5, 13, 3, 4, 5, 470 }, // ․
-    { 10, 5, 13, 0, 4, 13, 475 }, // ‥
-    { 17, 5, 19, 0, 4, 22, 488 }, // …
-    { 4, 5, 6, 1, 9, 5, 510 }, // ‧
-    { 0, 0, 15, 0, 0, 0, 515 }, //  
-    { 0, 0, 15, 0, 0, 0, 515 }, //  
-    { 7, 20, 0, -1, 16, 35, 515 }, // ‪
-    { 7, 20, 0, -6, 16, 35, 550 }, // ‫
-    { 6, 22, 0, -3, 18, 33, 585 }, // ‬
-    { 6, 22, 0, -3, 18, 33, 618 }, // ‭
-    { 6, 22, 0, -3, 18, 33, 651 }, // ‮
-    { 0, 0, 4, 0, 0, 0, 684 }, //  
-    { 26, 20, 28, 2, 19, 130, 684 }, // ‰
-    { 34, 20, 36, 2, 19, 170, 814 }, // ‱
-    { 7, 7, 6, 1, 18, 13, 984 }, // ′
-    { 11, 7, 10, 1, 18, 20, 997 }, // ″
-    { 15, 7, 14, 1, 18, 27, 1017 }, // ‴
-    { 4, 7, 7, 3, 18, 7, 1044 }, // ‵
-    { 8, 7, 11, 3, 18, 14, 1051 }, // ‶
-    { 12, 7, 14, 3, 18, 21, 1065 }, // ‷
-    { 10, 9, 10, -3, 3, 23, 1086 }, // ‸
-    { 6, 11, 7, 1, 12, 17, 1109 }, // ‹
-    { 7, 11, 7, 0, 12, 20, 1126 }, // ›
-    { 19, 20, 21, 1, 19, 95, 1146 }, // ※
-    { 13, 19, 12, 0, 18, 62, 1241 }, // ‼
-    { 11, 20, 11, 1, 19, 55, 1303 }, // ‽
-    { 11, 2, 10, 2, 21, 6, 1358 }, // ‾
-    { 14, 6, 14, -2, 0, 21, 1364 }, // ‿
-    { 13, 6, 14, 2, 20, 20, 1385 }, // ⁀
-    { 12, 17, 9, -3, 11, 51, 1405 }, // ⁁
-    { 27, 24, 28, 0, 20, 162, 1456 }, // ⁂
-    { 7, 3, 7, 0, 8, 6, 1618 }, // ⁃
-    { 16, 18, 3, -6, 18, 72, 1624 }, // ⁄
-    { 11, 22, 7, -1, 18, 61, 1696 }, // ⁅
-    { 10, 22, 7, -2, 18, 55, 1757 }, // ⁆
-    { 22, 20, 22, 1, 19, 110, 1812 }, // ⁇
-    { 17, 20, 17, 1, 19, 85, 1922 }, // ⁈
-    { 18, 20, 17, 0, 19, 90, 2007 }, // ⁉
-    { 13, 14, 13, 1, 14, 46, 2097 }, // ⁊
-    { 13, 23, 15, 2, 19, 75, 2143 }, // ⁋
-    { 13, 14, 16, 1, 14, 46, 2218 }, // ⁌
-    { 13, 14, 16, 2, 14, 46, 2264 }, // ⁍
-    { 13, 13, 14, -1, 7, 43, 2310 }, // ⁎
-    { 6, 18, 6, 0, 14, 27, 2353 }, // ⁏
-    { 17, 26, 14, -2, 20, 111, 2380 }, // ⁐
-    { 15, 26, 14, 0, 20, 98, 2491 }, // ⁑
-    { 10, 20, 9, 0, 19, 50, 2589 }, // ⁒
-    { 22, 5, 25, 2, 10, 28, 2639 }, // ⁓
-    { 14, 6, 14, -3, 0, 21, 2667 }, // ⁔
-    { 14, 14, 14, 0, 13, 49, 2688 }, // ⁕
-    { 11, 20, 13, 1, 19, 55, 2737 }, // ⁖
-    { 19, 7, 18, 1, 18, 34, 2792 }, // ⁗
-    { 19, 20, 21, 1, 19, 95, 2826 }, // ⁘
-    { 19, 20, 21, 1, 19, 95, 2921 }, // ⁙
-    { 4, 20, 6, 1, 19, 20, 3016 }, // ⁚
-    { 15, 20, 16, 1, 19, 75, 3036 }, // ⁛
-    { 19, 20, 20, 0, 19, 95, 3111 }, // ⁜
-    { 4, 19, 7, 1, 18, 19, 3206 }, // ⁝
-    { 4, 20, 7, 2, 19, 20, 3225 }, // ⁞
-    { 0, 0, 6, 0, 0, 0, 3245 }, //  
-    { 0, 0, 15, 0, 0, 0, 3245 }, // ⁠
-    { 0, 0, 15, 0, 0, 0, 3245 }, // ⁡
-    { 0, 0, 15, 0, 0, 0, 3245 }, // ⁢
-    { 0, 0, 15, 0, 0, 0, 3245 }, // ⁣
-    { 0, 0, 15, 0, 0, 0, 3245 }, // ⁤
-    { 0, 0, 15, 0, 0, 0, 3245 }, // ⁦
-    { 0, 0, 15, 0, 0, 0, 3245 }, // ⁧
-    { 0, 0, 15, 0, 0, 0, 3245 }, // ⁨
-    { 0, 0, 15, 0, 0, 0, 3245 }, // ⁩
-    { 6, 22, 0, -3, 18, 33, 3245 }, // ⁪
-    { 6, 22, 0, -3, 18, 33, 3278 }, // ⁫
-    { 6, 22, 0, -3, 18, 33, 3311 }, // ⁬
-    { 6, 22, 0, -3, 18, 33, 3344 }, // ⁭
-    { 6, 22, 0, -3, 18, 33, 3377 }, // ⁮
-    { 6, 22, 0, -3, 18, 33, 3410 }, // ⁯
-    { 9, 12, 9, 2, 22, 27, 0 }, // ⁰
-    { 4, 12, 6, 2, 19, 12, 27 }, // ⁱ
-    { 9, 12, 9, 1, 22, 27, 39 }, // ⁴
-    { 9, 12, 9, 2, 22, 27, 66 }, // ⁵
-    { 9, 12, 9, 2, 22, 27, 93 }, // ⁶
-    { 9, 12, 9, 2, 22, 27, 120 }, // ⁷
-    { 9, 12, 9, 2, 22, 27, 147 }, // ⁸
-    { 9, 12, 9, 2, 22, 27, 174 }, // ⁹
-    { 8, 8, 8, 2, 19, 16, 201 }, // ⁺
-    { 8, 2, 8, 2, 16, 4, 217 }, // ⁻
-    { 8, 5, 8, 2, 18, 10, 221 }, // ⁼
-    { 7, 14, 5, 2, 23, 25, 231 }, // ⁽
-    { 6, 14, 5, 0, 23, 21, 256 }, // ⁾
-    { 9, 9, 9, 1, 16, 21, 277 }, // ⁿ
-    { 9, 12, 9, -1, 8, 27, 298 }, // ₀
-    { 6, 12, 9, 0, 8, 18, 325 }, // ₁
-    { 9, 12, 9, -2, 8, 27, 343 }, // ₂
-    { 8, 12, 9, -1, 8, 24, 370 }, // ₃
-    { 9, 12, 9, -1, 8, 27, 394 }, // ₄
-    { 9, 12, 9, -1, 8, 27, 421 }, // ₅
-    { 9, 12, 9, -1, 8, 27, 448 }, // ₆
-    { 9, 12, 9, -1, 8, 27, 475 }, // ₇
-    { 9, 12, 9, -1, 8, 27, 502 }, // ₈
-    { 9, 12, 9, -1, 8, 27, 529 }, // ₉
-    { 8, 8, 8, -1, 6, 16, 556 }, // ₊
-    { 8, 2, 8, -1, 3, 4, 572 }, // ₋
-    { 8, 5, 8, -1, 5, 10, 576 }, // ₌
-    { 6, 14, 5, 0, 9, 21, 586 }, // ₍
-    { 6, 14, 5, -3, 9, 21, 607 }, // ₎
-    { 9, 9, 9, -1, 6, 21, 628 }, // ₐ
-    { 8, 9, 8, -1, 6, 18, 649 }, // ₑ
-    { 9, 9, 9, -1, 6, 21, 667 }, // ₒ
-    { 9, 9, 8, -2, 6, 21, 688 }, // ₓ
-    { 7, 9, 8, -1, 6, 16, 709 }, // ₔ
-    { 9, 12, 11, 0, 9, 27, 725 }, // ₕ
-    { 9, 12, 9, 0, 9, 27, 752 }, // ₖ
-    { 5, 12, 6, 0, 9, 15, 779 }, // ₗ
-    { 14, 9, 16, 0, 6, 32, 794 }, // ₘ
-    { 9, 9, 9, -1, 6, 21, 826 }, // ₙ
-    { 10, 12, 9, -2, 6, 30, 847 }, // ₚ
-    { 7, 9, 8, -1, 6, 16, 877 }, // ₛ
-    { 6, 11, 5, -1, 8, 17, 893 }, // ₜ
-    { 14, 19, 14, 1, 19, 67, 0 }, // ₠
-    { 14, 21, 14, 1, 19, 74, 67 }, // ₡
-    { 14, 20, 14, 1, 19, 70, 141 }, // ₢
-    { 15, 18, 14, 0, 18, 68, 211 }, // ₣
-    { 16, 19, 14, -1, 19, 76, 279 }, // ₤
-    { 21, 20, 22, 0, 17, 105, 355 }, // ₥
-    { 15, 18, 14, 0, 18, 68, 460 }, // ₦
-    { 18, 19, 18, 0, 18, 86, 528 }, // ₧
-    { 21, 19, 20, 0, 18, 100, 614 }, // ₨
-    { 18, 18, 16, 0, 18, 81, 714 }, // ₩
-    { 21, 18, 20, 0, 18, 95, 795 }, // ₪
-    { 17, 23, 14, 0, 19, 98, 890 }, // ₫
-    { 16, 20, 14, 0, 19, 80, 988 }, // €
-    { 17, 18, 14, 0, 18, 77, 1068 }, // ₭
-    { 14, 18, 13, 1, 18, 63, 1145 }, // ₮
-    { 24, 25, 24, 0, 19, 150, 1208 }, // ₯
-    { 16, 25, 14, -2, 19, 100, 1358 }, // ₰
-    { 16, 18, 14, 0, 18, 72, 1458 }, // ₱
-    { 16, 21, 17, 1, 19, 84, 1530 }, // ₲
-    { 17, 18, 14, -2, 18, 77, 1614 }, // ₳
-    { 15, 20, 13, -1, 19, 75, 1691 }, // ₴
-    { 15, 21, 15, 1, 19, 79, 1766 }, // ₵
-    { 16, 18, 14, 0, 17, 72, 1845 }, // ₶
-    { 18, 21, 16, -1, 19, 95, 1917 }, // ₷
-    { 14, 18, 12, 1, 18, 63, 2012 }, // ₸
-    { 13, 18, 14, 2, 18, 59, 2075 }, // ₹
-    { 14, 19, 14, 0, 18, 67, 2134 }, // ₺
-    { 16, 20, 17, 1, 19, 80, 2201 }, // ₻
-    { 19, 18, 19, -1, 18, 86, 2281 }, // ₼
-    { 16, 18, 15, -1, 18, 72, 2367 }, // ₽
-    { 17, 21, 15, -1, 21, 90, 2439 }, // ₾
-    { 13, 24, 14, 1, 21, 78, 2529 }, // ₿
-    { 7, 3, 8, 0, 8, 6, 0 }, // −
-    { 23, 23, 25, 1, 19, 133, 0 }, // �
+    { 11, 11, 12, 1, 12, 31, 5283 }, // «
+    { 13, 7, 14, 1, 10, 23, 487 }, // ¬
+    { 7, 3, 8, 0, 8, 6, 510 }, // ­
+    { 19, 20, 21, 1, 19, 95, 516 }, // ®
+    { 11, 2, 10, 2, 21, 6, 611 }, // ¯
+    { 9, 9, 11, 1, 19, 21, 617 }, // °
+    { 13, 15, 14, 1, 15, 49, 638 }, // ±
+    { 9, 12, 9, 1, 22, 27, 687 }, // ²
+    { 8, 12, 9, 2, 22, 24, 714 }, // ³
+    { 7, 5, 7, 2, 20, 9, 738 }, // ´
+    { 15, 20, 15, -1, 14, 75, 747 }, // µ
+    { 13, 23, 16, 2, 19, 75, 822 }, // ¶
+    { 4, 5, 6, 2, 11, 5, 897 }, // ·
+    { 6, 6, 5, -3, 0, 9, 902 }, // ¸
+    { 6, 12, 9, 3, 22, 18, 911 }, // ¹
+    { 8, 10, 8, 2, 19, 20, 929 }, // º
+    { 11, 11, 12, 0, 12, 31, 5314 }, // »
+    { 16, 19, 18, 2, 19, 76, 949 }, // ¼
+    { 18, 19, 20, 2, 19, 86, 1025 }, // ½
+    { 18, 19, 20, 1, 19, 86, 1111 }, // ¾
+    { 10, 19, 11, -1, 14, 48, 1197 }, // ¿
+    { 15, 24, 14, -2, 24, 90, 5345 }, // À
+    { 16, 24, 14, -2, 24, 96, 5435 }, // Á
+    { 16, 24, 14, -2, 24, 96, 5531 }, // Â
+    { 17, 23, 14, -2, 23, 98, 1245 }, // Ã
+    { 16, 23, 14, -2, 23, 92, 5627 }, // Ä
+    { 15, 25, 14, -2, 25, 94, 1343 }, // Å
+    { 24, 18, 21, -2, 18, 108, 1437 }, // Æ
+    { 15, 25, 15, 1, 19, 94, 5719 }, // Ç
+    { 13, 24, 13, 1, 24, 78, 5813 }, // È
+    { 13, 24, 13, 1, 24, 78, 5891 }, // É
+    { 13, 24, 13, 1, 24, 78, 5969 }, // Ê
+    { 13, 23, 13, 1, 23, 75, 6047 }, // Ë
+    { 11, 24, 8, -1, 24, 66, 6122 }, // Ì
+    { 12, 24, 8, -1, 24, 72, 6188 }, // Í
+    { 12, 24, 8, -1, 24, 72, 6260 }, // Î
+    { 12, 23, 8, -1, 23, 69, 6332 }, // Ï
+    { 16, 18, 17, 0, 18, 72, 1545 }, // Ð
+    { 17, 23, 18, 1, 23, 98, 6401 }, // Ñ
+    { 17, 25, 18, 1, 24, 107, 6499 }, // Ò
+    { 17, 25, 18, 1, 24, 107, 6606 }, // Ó
+    { 17, 25, 18, 1, 24, 107, 6713 }, // Ô
+    { 17, 24, 18, 1, 23, 102, 1617 }, // Õ
+    { 17, 24, 18, 1, 23, 102, 6820 }, // Ö
+    { 12, 12, 14, 2, 15, 36, 1719 }, // ×
+    { 17, 21, 18, 1, 19, 90, 1755 }, // Ø
+    { 17, 25, 17, 1, 24, 107, 6922 }, // Ù
+    { 17, 25, 17, 1, 24, 107, 7029 }, // Ú
+    { 17, 25, 17, 1, 24, 107, 7136 }, // Û
+    { 17, 24, 17, 1, 23, 102, 7243 }, // Ü
+    { 14, 24, 13, 2, 24, 84, 1845 }, // Ý
+    { 13, 18, 14, 1, 18, 59, 1929 }, // Þ
+    { 18, 26, 15, -4, 20, 117, 1988 }, // ß
+    { 13, 21, 14, 1, 20, 69, 7345 }, // à
+    { 13, 21, 14, 1, 20, 69, 7414 }, // á
+    { 13, 21, 14, 1, 20, 69, 7483 }, // â
+    { 13, 20, 14, 1, 19, 65, 2105 }, // ã
+    { 13, 20, 14, 1, 19, 65, 7552 }, // ä
+    { 13, 22, 14, 1, 21, 72, 2170 }, // å
+    { 19, 15, 21, 1, 14, 72, 2242 }, // æ
+    { 11, 20, 11, 1, 14, 55, 7617 }, // ç
+    { 11, 21, 12, 1, 20, 58, 7672 }, // è
+    { 12, 21, 12, 1, 20, 63, 7730 }, // é
+    { 11, 21, 12, 1, 20, 58, 7793 }, // ê
+    { 11, 20, 12, 1, 19, 55, 7851 }, // ë
+    { 7, 20, 6, 0, 20, 35, 7906 }, // ì
+    { 9, 20, 6, 0, 20, 45, 7941 }, // í
+    { 9, 20, 6, 0, 20, 45, 7986 }, // î
+    { 9, 19, 6, 0, 19, 43, 8031 }, // ï
+    { 13, 21, 14, 1, 20, 69, 2314 }, // ð
+    { 14, 19, 14, 0, 19, 67, 8074 }, // ñ
+    { 12, 21, 14, 1, 20, 63, 8141 }, // ò
+    { 12, 21, 14, 1, 20, 63, 8204 }, // ó
+    { 12, 21, 14, 1, 20, 63, 8267 }, // ô
+    { 13, 20, 14, 1, 19, 65, 2383 }, // õ
+    { 12, 20, 14, 1, 19, 60, 8330 }, // ö
+    { 13, 12, 14, 1, 15, 39, 2448 }, // ÷
+    { 14, 16, 14, 0, 15, 56, 2487 }, // ø
+    { 13, 21, 14, 1, 20, 69, 8390 }, // ù
+    { 13, 21, 14, 1, 20, 69, 8459 }, // ú
+    { 13, 21, 14, 1, 20, 69, 8528 }, // û
+    { 13, 20, 14, 1, 19, 65, 8597 }, // ü
+    { 16, 26, 12, -3, 20, 104, 2543 }, // ý
+    { 15, 25, 14, -1, 19, 94, 2647 }, // þ
+    { 16, 25, 12, -3, 19, 100, 2741 }, // ÿ
+    { 16, 21, 14, -2, 21, 84, 2841 }, // Ā
+    { 13, 18, 14, 1, 17, 59, 2925 }, // ā
+    { 16, 23, 14, -2, 23, 92, 2984 }, // Ă
+    { 13, 20, 14, 1, 19, 65, 3076 }, // ă
+    { 15, 24, 14, -2, 18, 90, 3141 }, // Ą
+    { 13, 20, 14, 1, 14, 65, 3231 }, // ą
+    { 15, 25, 15, 1, 24, 94, 3296 }, // Ć
+    { 11, 21, 11, 1, 20, 58, 3390 }, // ć
+    { 15, 25, 15, 1, 24, 94, 3448 }, // Ĉ
+    { 11, 21, 11, 1, 20, 58, 3542 }, // ĉ
+    { 15, 24, 15, 1, 23, 90, 3600 }, // Ċ
+    { 11, 20, 11, 1, 19, 55, 3690 }, // ċ
+    { 15, 25, 15, 1, 24, 94, 3745 }, // Č
+    { 12, 21, 11, 1, 20, 63, 3839 }, // č
+    { 15, 24, 17, 1, 24, 90, 3902 }, // Ď
+    { 19, 20, 15, 1, 19, 95, 3992 }, // ď
+    { 16, 18, 17, 0, 18, 72, 4087 }, // Đ
+    { 16, 20, 14, 1, 19, 80, 4159 }, // đ
+    { 13, 21, 13, 1, 21, 69, 4239 }, // Ē
+    { 11, 18, 12, 1, 17, 50, 4308 }, // ē
+    { 13, 23, 13, 1, 23, 75, 4358 }, // Ĕ
+    { 12, 20, 12, 1, 19, 60, 4433 }, // ĕ
+    { 13, 23, 13, 1, 23, 75, 4493 }, // Ė
+    { 11, 20, 12, 1, 19, 55, 4568 }, // ė
+    { 13, 24, 13, 1, 18, 78, 4623 }, // Ę
+    { 11, 20, 12, 1, 14, 55, 4701 }, // ę
+    { 14, 24, 13, 1, 24, 84, 4756 }, // Ě
+    { 12, 21, 12, 1, 20, 63, 4840 }, // ě
+    { 16, 25, 17, 1, 24, 100, 4903 }, // Ĝ
+    { 14, 26, 14, 0, 20, 91, 5003 }, // ĝ
+    { 16, 24, 17, 1, 23, 96, 5094 }, // Ğ
+    { 14, 25, 14, 0, 19, 88, 5190 }, // ğ
+    { 16, 24, 17, 1, 23, 96, 5278 }, // Ġ
+    { 14, 25, 14, 0, 19, 88, 5374 }, // ġ
+    { 16, 25, 17, 1, 19, 100, 5462 }, // Ģ
+    { 14, 26, 14, 0, 20, 91, 5562 }, // ģ
+    { 17, 24, 17, 1, 24, 102, 5653 }, // Ĥ
+    { 14, 26, 14, 0, 26, 91, 5755 }, // ĥ
+    { 18, 18, 17, 1, 18, 81, 5846 }, // Ħ
+    { 14, 19, 14, 0, 19, 67, 5927 }, // ħ
+    { 13, 23, 8, -1, 23, 75, 5994 }, // Ĩ
+    { 10, 19, 6, 0, 19, 48, 6069 }, // ĩ
+    { 12, 21, 8, -1, 21, 63, 6117 }, // Ī
+    { 9, 17, 6, 0, 17, 39, 6180 }, // ī
+    { 12, 23, 8, -1, 23, 69, 6219 }, // Ĭ
+    { 10, 19, 6, 0, 19, 48, 6288 }, // ĭ
+    { 11, 24, 8, -1, 18, 66, 6336 }, // Į
+    { 8, 25, 6, -1, 19, 50, 6402 }, // į
+    { 11, 23, 8, -1, 23, 64, 6452 }, // İ
+    { 6, 14, 6, 0, 14, 21, 6516 }, // ı
+    { 17, 23, 15, -1, 18, 98, 6537 }, // Ĳ
+    { 14, 25, 13, 0, 19, 88, 6635 }, // ĳ
+    { 14, 29, 7, -4, 24, 102, 6723 }, // Ĵ
+    { 13, 26, 6, -4, 20, 85, 6825 }, // ĵ
+    { 16, 24, 14, 1, 18, 96, 6910 }, // Ķ
+    { 14, 25, 12, 0, 19, 88, 7006 }, // ķ
+    { 14, 14, 12, 0, 14, 49, 7094 }, // ĸ
+    { 10, 24, 12, 1, 24, 60, 7143 }, // Ĺ
+    { 11, 26, 6, 0, 26, 72, 7203 }, // ĺ
+    { 10, 24, 12, 1, 18, 60, 7275 }, // Ļ
+    { 8, 25, 6, -1, 19, 50, 7335 }, // ļ
+    { 12, 18, 12, 1, 18, 54, 7385 }, // Ľ
+    { 11, 19, 7, 0, 19, 53, 7439 }, // ľ
+    { 10, 18, 12, 1, 18, 45, 7492 }, // Ŀ
+    { 9, 19, 7, 0, 19, 43, 7537 }, // ŀ
+    { 11, 18, 12, 0, 18, 50, 7580 }, // Ł
+    { 8, 19, 6, 0, 19, 38, 7630 }, // ł
+    { 17, 24, 18, 1, 24, 102, 7668 }, // Ń
+    { 14, 20, 14, 0, 20, 70, 7770 }, // ń
+    { 17, 24, 18, 1, 18, 102, 7840 }, // Ņ
+    { 14, 20, 14, 0, 14, 70, 7942 }, // ņ
+    { 17, 24, 18, 1, 24, 102, 8012 }, // Ň
+    { 14, 20, 14, 0, 20, 70, 8114 }, // ň
+    { 15, 18, 16, 1, 18, 68, 8184 }, // ŉ
+    { 17, 23, 18, 1, 18, 98, 8252 }, // Ŋ
+    { 14, 20, 14, 0, 14, 70, 8350 }, // ŋ
+    { 17, 22, 18, 1, 21, 94, 8420 }, // Ō
+    { 12, 18, 14, 1, 17, 54, 8514 }, // ō
+    { 17, 24, 18, 1, 23, 102, 8568 }, // Ŏ
+    { 12, 20, 14, 1, 19, 60, 8670 }, // ŏ
+    { 18, 25, 18, 1, 24, 113, 8730 }, // Ő
+    { 14, 21, 14, 1, 20, 74, 8843 }, // ő
+    { 22, 20, 21, 1, 19, 110, 8662 }, // Œ
+    { 20, 15, 22, 1, 14, 75, 8772 }, // œ
+    { 14, 24, 14, 1, 24, 84, 8917 }, // Ŕ
+    { 12, 20, 10, 0, 20, 60, 9001 }, // ŕ
+    { 14, 24, 14, 1, 18, 84, 9061 }, // Ŗ
+    { 12, 20, 10, -1, 14, 60, 9145 }, // ŗ
+    { 14, 24, 14, 1, 24, 84, 9205 }, // Ř
+    { 13, 20, 10, 0, 20, 65, 9289 }, // ř
+    { 13, 25, 13, 0, 24, 82, 9354 }, // Ś
+    { 11, 21, 11, 0, 20, 58, 9436 }, // ś
+    { 13, 25, 13, 0, 24, 82, 9494 }, // Ŝ
+    { 11, 21, 11, 0, 20, 58, 9576 }, // ŝ
+    { 13, 25, 13, 0, 19, 82, 9634 }, // Ş
+    { 11, 20, 11, 0, 14, 55, 9716 }, // ş
+    { 14, 25, 13, 0, 24, 88, 9771 }, // Š
+    { 12, 21, 11, 0, 20, 63, 9859 }, // š
+    { 14, 24, 13, 1, 18, 84, 9922 }, // Ţ
+    { 10, 23, 8, 0, 17, 58, 10006 }, // ţ
+    { 13, 24, 13, 2, 24, 78, 10064 }, // Ť
+    { 11, 20, 8, 1, 19, 55, 10142 }, // ť
+    { 13, 18, 13, 2, 18, 59, 10197 }, // Ŧ
+    { 10, 18, 8, 0, 17, 45, 10256 }, // ŧ
+    { 17, 24, 17, 1, 23, 102, 10301 }, // Ũ
+    { 13, 20, 14, 1, 19, 65, 10403 }, // ũ
+    { 17, 22, 17, 1, 21, 94, 10468 }, // Ū
+    { 13, 18, 14, 1, 17, 59, 10562 }, // ū
+    { 17, 24, 17, 1, 23, 102, 10621 }, // Ŭ
+    { 13, 20, 14, 1, 19, 65, 10723 }, // ŭ
+    { 17, 26, 17, 1, 25, 111, 10788 }, // Ů
+    { 13, 22, 14, 1, 21, 72, 10899 }, // ů
+    { 17, 25, 17, 1, 24, 107, 10971 }, // Ű
+    { 15, 21, 14, 1, 20, 79, 11078 }, // ű
+    { 17, 24, 17, 1, 18, 102, 11157 }, // Ų
+    { 13, 20, 14, 1, 14, 65, 11259 }, // ų
+    { 22, 24, 21, 2, 24, 132, 11324 }, // Ŵ
+    { 19, 20, 18, 1, 20, 95, 11456 }, // ŵ
+    { 14, 24, 13, 2, 24, 84, 11551 }, // Ŷ
+    { 16, 26, 12, -3, 20, 104, 11635 }, // ŷ
+    { 14, 23, 13, 2, 23, 81, 11739 }, // Ÿ
+    { 16, 24, 13, -1, 24, 96, 11820 }, // Ź
+    { 13, 20, 11, -1, 20, 65, 11916 }, // ź
+    { 16, 23, 13, -1, 23, 92, 11981 }, // Ż
+    { 12, 19, 11, -1, 19, 57, 12073 }, // ż
+    { 16, 24, 13, -1, 24, 96, 12130 }, // Ž
+    { 13, 20, 11, -1, 20, 65, 12226 }, // ž
+    { 15, 26, 7, -4, 20, 98, 12291 }, // ſ
+    { 5, 5, 0, -10, 20, 7, 12389 }, // ̀
+    { 6, 5, 0, -6, 20, 8, 12396 }, // ́
+    { 9, 5, 0, -3, 20, 12, 12404 }, // ̂
+    { 10, 4, 0, -11, 19, 10, 12416 }, // ̃
+    { 8, 2, 0, -2, 17, 4, 12426 }, // ̄
+    { 11, 3, 0, -3, 22, 9, 12430 }, // ̅
+    { 8, 4, 0, -2, 19, 8, 12439 }, // ̆
+    { 4, 4, 0, 0, 19, 4, 12447 }, // ̇
+    { 8, 4, 0, -2, 19, 8, 12451 }, // ̈
+    { 6, 7, 0, -8, 21, 11, 12459 }, // ̉
+    { 7, 6, 0, -1, 21, 11, 12470 }, // ̊
+    { 10, 5, 0, -2, 20, 13, 12481 }, // ̋
+    { 9, 5, 0, -2, 20, 12, 12494 }, // ̌
+    { 4, 7, 0, 0, 19, 7, 12506 }, // ̍
+    { 8, 5, 0, -2, 19, 10, 12513 }, // ̎
+    { 10, 5, 0, -13, 20, 13, 12523 }, // ̏
+    { 9, 7, 0, -2, 22, 16, 12536 }, // ̐
+    { 8, 4, 0, -2, 19, 8, 12552 }, // ̑
+    { 6, 7, 0, -1, 18, 11, 12560 }, // ̒
+    { 6, 7, 0, -1, 18, 11, 12571 }, // ̓
+    { 4, 7, 0, 0, 18, 7, 12582 }, // ̔
+    { 6, 7, 0, -1, 18, 11, 12589 }, // ̕
+    { 5, 5, 0, -5, 0, 7, 12600 }, // ̖
+    { 6, 5, 0, -4, 0, 8, 12607 }, // ̗
+    { 6, 6, 0, -5, 0, 9, 12615 }, // ̘
+    { 6, 6, 0, -5, 0, 9, 12624 }, // ̙
+    { 8, 7, 8, 2, 19, 14, 12633 }, // ̚
+    { 6, 6, 0, -1, 19, 9, 12647 }, // ̛
+    { 5, 6, 0, -2, 0, 8, 12656 }, // ̜
+    { 6, 5, 0, -5, -1, 8, 12664 }, // ̝
+    { 7, 5, 0, -5, -1, 9, 12672 }, // ̞
+    { 6, 6, 0, -5, 0, 9, 12681 }, // ̟
+    { 6, 3, 0, -5, -2, 5, 12690 }, // ̠
+    { 6, 8, 0, -5, 2, 12, 12695 }, // ̡
+    { 5, 8, 0, -3, 2, 10, 12707 }, // ̢
+    { 4, 4, 0, -11, -1, 4, 12717 }, // ̣
+    { 8, 4, 0, -6, -1, 8, 12721 }, // ̤
+    { 6, 6, 0, -5, 0, 9, 12729 }, // ̥
+    { 5, 5, 0, 1, -1, 7, 12738 }, // ̦
+    { 6, 6, 0, -5, 0, 9, 12745 }, // ̧
+    { 5, 6, 0, -4, 0, 8, 12754 }, // ̨
+    { 4, 7, 0, -4, -1, 7, 12762 }, // ̩
+    { 10, 5, 0, -7, -1, 13, 12769 }, // ̪
+    { 11, 4, 0, -7, -1, 11, 12782 }, // ̫
+    { 9, 5, 0, -6, 0, 12, 12793 }, // ̬
+    { 8, 5, 0, -6, 0, 10, 12805 }, // ̭
+    { 9, 4, 0, -6, -1, 9, 12815 }, // ̮
+    { 8, 4, 0, -6, -1, 8, 12824 }, // ̯
+    { 10, 4, 0, -7, -1, 10, 12832 }, // ̰
+    { 8, 2, 0, -6, -2, 4, 12842 }, // ̱
+    { 12, 2, 0, -8, -2, 6, 12846 }, // ̲
+    { 12, 6, 0, -8, 0, 18, 12852 }, // ̳
+    { 10, 4, 0, -5, 9, 10, 12870 }, // ̴
+    { 10, 3, 0, -5, 9, 8, 12880 }, // ̵
+    { 18, 2, 0, -9, 8, 9, 12888 }, // ̶
+    { 8, 6, 0, -4, 10, 12, 12897 }, // ̷
+    { 14, 21, 0, -7, 19, 74, 12909 }, // ̸
+    { 4, 6, 0, -2, 0, 6, 12983 }, // ̹
+    { 10, 5, 0, -7, -1, 13, 12989 }, // ̺
+    { 10, 6, 0, -7, 0, 15, 13002 }, // ̻
+    { 10, 4, 0, -7, -1, 10, 13017 }, // ̼
+    { 7, 6, 0, -1, 20, 11, 13027 }, // ̽
+    { 6, 8, 0, -1, 22, 12, 13038 }, // ̾
+    { 12, 6, 0, -3, 25, 18, 13050 }, // ̿
+    { 6, 5, 0, -2, 20, 8, 13068 }, // ̀
+    { 7, 5, 0, 0, 20, 9, 13076 }, // ́
+    { 10, 4, 0, 4, 19, 10, 13085 }, // ͂
+    { 5, 5, 0, 0, 20, 7, 13095 }, // ̓
+    { 10, 5, 0, -3, 20, 13, 13102 }, // ̈́
+    { 4, 4, 0, -3, -2, 4, 13115 }, // ͅ
+    { 12, 6, 0, -4, 20, 18, 13119 }, // ͆
+    { 12, 6, 0, -8, 0, 18, 13137 }, // ͇
+    { 8, 5, 0, -6, -1, 10, 13155 }, // ͈
+    { 5, 5, 0, -4, -1, 7, 13165 }, // ͉
+    { 10, 6, 0, -3, 20, 15, 13172 }, // ͊
+    { 11, 10, 0, -3, 24, 28, 13187 }, // ͋
+    { 11, 7, 0, -3, 22, 20, 13215 }, // ͌
+    { 10, 6, 0, -7, 0, 15, 13235 }, // ͍
+    { 5, 6, 0, -4, 0, 8, 13250 }, // ͎
+    { 18, 18, 0, -9, 18, 81, 13258 }, // ͏
+    { 5, 6, 0, 0, 20, 8, 13339 }, // ͐
+    { 4, 6, 0, 3, 21, 6, 13347 }, // ͑
+    { 8, 7, 0, -2, 22, 14, 13353 }, // ͒
+    { 5, 6, 0, -4, 0, 8, 13367 }, // ͓
+    { 5, 5, 0, -4, -1, 7, 13375 }, // ͔
+    { 5, 5, 0, -4, -1, 7, 13382 }, // ͕
+    { 10, 5, 0, -6, -1, 13, 13389 }, // ͖
+    { 4, 6, 0, 2, 21, 6, 13402 }, // ͗
+    { 4, 4, 0, 0, 19, 4, 13408 }, // ͘
+    { 6, 6, 0, -5, 0, 9, 13412 }, // ͙
+    { 10, 6, 0, -7, 0, 15, 13421 }, // ͚
+    { 5, 6, 0, 0, 20, 8, 13436 }, // ͛
+    { 19, 5, 0, -11, -1, 24, 13444 }, // ͜
+    { 18, 5, 0, -7, 19, 23, 13468 }, // ͝
+    { 14, 2, 0, -5, 17, 7, 13491 }, // ͞
+    { 14, 2, 0, -9, -2, 7, 13498 }, // ͟
+    { 19, 4, 0, -7, 19, 19, 13505 }, // ͠
+    { 19, 6, 0, -7, 22, 29, 13524 }, // ͡
+    { 19, 6, 0, -12, 0, 29, 13553 }, // ͢
+    { 7, 6, 0, -1, 21, 11, 13582 }, // ͣ
+    { 5, 6, 0, 0, 21, 8, 13593 }, // ͤ
+    { 4, 8, 0, 1, 23, 8, 13601 }, // ͥ
+    { 7, 6, 0, -1, 21, 11, 13609 }, // ͦ
+    { 7, 6, 0, -1, 21, 11, 13620 }, // ͧ
+    { 6, 6, 0, 0, 21, 9, 13631 }, // ͨ
+    { 7, 9, 0, -1, 24, 16, 13640 }, // ͩ
+    { 7, 9, 0, -1, 24, 16, 13656 }, // ͪ
+    { 10, 6, 0, -3, 21, 15, 13672 }, // ͫ
+    { 6, 6, 0, 0, 21, 9, 13687 }, // ͬ
+    { 4, 8, 0, 1, 23, 8, 13696 }, // ͭ
+    { 6, 6, 0, 0, 21, 9, 13704 }, // ͮ
+    { 7, 6, 0, -1, 21, 11, 13713 }, // ͯ
+    { 14, 24, 13, 0, 24, 84, 13724 }, // Ѐ
+    { 14, 23, 13, 0, 23, 81, 0 }, // Ё
+    { 14, 19, 17, 2, 18, 67, 13808 }, // Ђ
+    { 14, 24, 12, 0, 24, 84, 13875 }, // Ѓ
+    { 15, 20, 15, 1, 19, 75, 13959 }, // Є
+    { 13, 20, 13, 0, 19, 65, 14034 }, // Ѕ
+    { 7, 18, 7, 0, 18, 32, 14099 }, // І
+    { 10, 23, 7, 0, 23, 58, 14131 }, // Ї
+    { 12, 23, 7, -4, 18, 69, 14189 }, // Ј
+    { 24, 19, 23, -1, 18, 114, 14258 }, // Љ
+    { 22, 18, 23, 0, 18, 99, 14372 }, // Њ
+    { 14, 18, 17, 2, 18, 63, 14471 }, // Ћ
+    { 17, 24, 14, 0, 24, 102, 14534 }, // Ќ
+    { 18, 24, 17, 0, 24, 108, 14636 }, // Ѝ
+    { 17, 24, 14, 0, 23, 102, 14744 }, // Ў
+    { 17, 22, 17, 0, 18, 94, 14846 }, // Џ
+    { 15, 18, 14, -2, 18, 68, 81 }, // А
+    { 15, 18, 14, 0, 18, 68, 149 }, // Б
+    { 15, 18, 15, 0, 18, 68, 217 }, // В
+    { 14, 18, 12, 0, 18, 63, 285 }, // Г
+    { 21, 22, 17, -3, 18, 116, 348 }, // Д
+    { 14, 18, 13, 0, 18, 63, 464 }, // Е
+    { 25, 18, 20, -2, 18, 113, 527 }, // Ж
+    { 14, 20, 13, -1, 19, 70, 640 }, // З
+    { 18, 18, 17, 0, 18, 81, 710 }, // И
+    { 18, 23, 17, 0, 23, 104, 791 }, // Й
+    { 17, 18, 14, 0, 18, 77, 895 }, // К
+    { 18, 19, 17, -1, 18, 86, 972 }, // Л
+    { 21, 18, 21, 0, 18, 95, 1058 }, // М
+    { 17, 18, 17, 0, 18, 77, 1153 }, // Н
+    { 16, 20, 17, 1, 19, 80, 1230 }, // О
+    { 17, 18, 17, 0, 18, 77, 1310 }, // П
+    { 15, 18, 14, 0, 18, 68, 1387 }, // Р
+    { 15, 20, 15, 1, 19, 75, 1455 }, // С
+    { 13, 18, 13, 2, 18, 59, 1530 }, // Т
+    { 17, 19, 14, 0, 18, 81, 1589 }, // У
+    { 19, 20, 20, 1, 19, 95, 1670 }, // Ф
+    { 18, 18, 13, -2, 18, 81, 1765 }, // Х
+    { 17, 22, 17, 0, 18, 94, 1846 }, // Ц
+    { 14, 18, 16, 2, 18, 63, 1940 }, // Ч
+    { 24, 18, 24, 0, 18, 108, 2003 }, // Ш
+    { 24, 22, 24, 0, 18, 132, 2111 }, // Щ
+    { 13, 18, 16, 2, 18, 59, 2243 }, // Ъ
+    { 20, 18, 20, 0, 18, 90, 2302 }, // Ы
+    { 13, 18, 14, 0, 18, 59, 2392 }, // Ь
+    { 15, 20, 15, 0, 19, 75, 2451 }, // Э
+    { 23, 20, 24, 0, 19, 115, 2526 }, // Ю
+    { 16, 18, 14, -1, 18, 72, 2641 }, // Я
+    { 13, 15, 14, 1, 14, 49, 2713 }, // а
+    { 14, 21, 14, 1, 20, 74, 2762 }, // б
+    { 13, 15, 13, 0, 14, 49, 2836 }, // в
+    { 11, 15, 11, 0, 14, 42, 2885 }, // г
+    { 13, 21, 14, 1, 20, 69, 2927 }, // д
+    { 11, 15, 12, 1, 14, 42, 2996 }, // е
+    { 24, 15, 22, -1, 14, 90, 3038 }, // ж
+    { 11, 15, 11, 0, 14, 42, 3128 }, // з
+    { 13, 15, 14, 1, 14, 49, 3170 }, // и
+    { 13, 20, 14, 1, 19, 65, 3219 }, // й
+    { 14, 14, 13, 0, 14, 49, 3284 }, // к
+    { 16, 15, 14, -2, 14, 60, 3333 }, // л
+    { 19, 14, 19, 0, 14, 67, 3393 }, // м
+    { 14, 14, 14, 0, 14, 49, 3460 }, // н
+    { 14, 15, 14, 0, 14, 53, 3509 }, // о
+    { 13, 14, 14, 0, 14, 46, 3562 }, // п
+    { 15, 20, 14, -1, 14, 75, 3608 }, // р
+    { 12, 15, 12, 0, 14, 45, 3683 }, // с
+    { 21, 14, 22, 0, 14, 74, 3728 }, // т
+    { 17, 20, 12, -3, 14, 85, 3802 }, // у
+    { 16, 25, 17, 0, 19, 100, 3887 }, // ф
+    { 15, 14, 11, -2, 14, 53, 3987 }, // х
+    { 13, 18, 15, 1, 14, 59, 4040 }, // ц
+    { 13, 14, 14, 1, 14, 46, 4099 }, // ч
+    { 21, 15, 22, 1, 14, 79, 4145 }, // ш
+    { 21, 18, 22, 1, 14, 95, 4224 }, // щ
+    { 13, 15, 15, 1, 14, 49, 4319 }, // ъ
+    { 17, 15, 18, 1, 14, 64, 4368 }, // ы
+    { 11, 15, 13, 1, 14, 42, 4432 }, // ь
+    { 11, 15, 12, 0, 14, 42, 4474 }, // э
+    { 19, 15, 19, 0, 14, 72, 4516 }, // ю
+    { 14, 14, 13, -1, 14, 49, 4588 }, // я
+    { 11, 21, 12, 1, 20, 58, 14940 }, // ѐ
+    { 12, 20, 12, 1, 19, 60, 4637 }, // ё
+    { 13, 25, 14, 0, 19, 82, 14998 }, // ђ
+    { 12, 21, 11, 0, 20, 63, 15080 }, // ѓ
+    { 12, 15, 12, 0, 14, 45, 15143 }, // є
+    { 11, 15, 11, 0, 14, 42, 15188 }, // ѕ
+    { 7, 19, 6, 0, 19, 34, 15230 }, // і
+    { 9, 19, 6, 0, 19, 43, 15264 }, // ї
+    { 11, 25, 6, -4, 19, 69, 15307 }, // ј
+    { 22, 15, 20, -2, 14, 83, 15376 }, // љ
+    { 19, 15, 20, 0, 14, 72, 15459 }, // њ
+    { 14, 19, 14, 0, 19, 67, 15531 }, // ћ
+    { 14, 20, 13, 0, 20, 70, 15598 }, // ќ
+    { 13, 21, 14, 1, 20, 69, 15668 }, // ѝ
+    { 17, 25, 12, -3, 19, 107, 15737 }, // ў
+    { 13, 19, 14, 1, 14, 62, 15844 }, // џ
+    { 23, 19, 23, 2, 18, 110, 15906 }, // Ѡ
+    { 20, 14, 20, 1, 14, 70, 16016 }, // ѡ
+    { 13, 18, 15, 1, 18, 59, 16086 }, // Ѣ
+    { 20, 15, 21, 0, 14, 75, 16145 }, // ѣ
+    { 22, 20, 22, 1, 19, 110, 16220 }, // Ѥ
+    { 18, 15, 17, 0, 14, 68, 16330 }, // ѥ
+    { 16, 18, 15, -2, 18, 72, 16398 }, // Ѧ
+    { 14, 14, 13, -2, 14, 49, 16470 }, // ѧ
+    { 19, 18, 21, 1, 18, 86, 16519 }, // Ѩ
+    { 17, 14, 18, 0, 14, 60, 16605 }, // ѩ
+    { 19, 18, 17, -1, 18, 86, 16665 }, // Ѫ
+    { 17, 14, 15, -2, 14, 60, 16751 }, // ѫ
+    { 23, 18, 23, 1, 18, 104, 16811 }, // Ѭ
+    { 20, 14, 20, 0, 14, 70, 16915 }, // ѭ
+    { 15, 28, 13, -1, 22, 105, 16985 }, // Ѯ
+    { 14, 22, 11, -2, 17, 77, 17090 }, // ѯ
+    { 19, 18, 19, 2, 18, 86, 17167 }, // Ѱ
+    { 16, 25, 18, 1, 19, 100, 17253 }, // ѱ
+    { 17, 20, 18, 1, 19, 85, 17353 }, // Ѳ
+    { 12, 15, 14, 1, 14, 45, 17438 }, // ѳ
+    { 15, 18, 14, 2, 18, 68, 17483 }, // Ѵ
+    { 13, 14, 11, 1, 14, 46, 17551 }, // ѵ
+    { 15, 24, 14, 2, 24, 90, 17597 }, // Ѷ
+    { 13, 20, 11, 1, 20, 65, 17687 }, // ѷ
+    { 30, 25, 30, 1, 19, 188, 17752 }, // Ѹ
+    { 26, 20, 26, 1, 14, 130, 17940 }, // ѹ
+    { 17, 22, 19, 1, 20, 94, 18070 }, // Ѻ
+    { 13, 17, 15, 1, 15, 56, 18164 }, // ѻ
+    { 23, 27, 24, 1, 26, 156, 18220 }, // Ѽ
+    { 18, 23, 20, 1, 22, 104, 18376 }, // ѽ
+    { 23, 24, 23, 2, 23, 138, 18480 }, // Ѿ
+    { 20, 18, 20, 1, 18, 90, 18618 }, // ѿ
+    { 15, 25, 15, 1, 19, 94, 18708 }, // Ҁ
+    { 11, 20, 11, 1, 14, 55, 18802 }, // ҁ
+    { 14, 17, 15, 1, 16, 60, 18857 }, // ҂
+    { 10, 4, 0, -10, 18, 10, 18917 }, // ҃
+    { 10, 4, 0, -10, 19, 10, 18927 }, // ҄
+    { 4, 5, 0, -7, 20, 5, 18937 }, // ҅
+    { 4, 5, 0, -7, 20, 5, 18942 }, // ҆
+    { 10, 4, 0, -2, 23, 10, 18947 }, // ҇
+    { 30, 27, 0, -15, 20, 203, 18957 }, // ҈
+    { 28, 28, 0, -14, 21, 196, 19160 }, // ҉
+    { 17, 29, 18, 1, 24, 124, 19356 }, // Ҋ
+    { 13, 24, 15, 1, 19, 78, 19480 }, // ҋ
+    { 12, 18, 14, 1, 18, 54, 19558 }, // Ҍ
+    { 11, 20, 13, 1, 19, 55, 19612 }, // ҍ
+    { 14, 18, 14, 1, 18, 63, 19667 }, // Ҏ
+    { 15, 20, 14, -1, 14, 75, 0 }, // ҏ
+    { 14, 22, 12, 1, 22, 77, 75 }, // Ґ
+    { 12, 18, 10, 0, 18, 54, 152 }, // ґ
+    { 14, 18, 12, 0, 18, 63, 206 }, // Ғ
+    { 11, 14, 10, 0, 14, 39, 269 }, // ғ
+    { 13, 25, 15, 1, 18, 82, 308 }, // Ҕ
+    { 11, 21, 12, 0, 14, 58, 390 }, // ҕ
+    { 24, 23, 21, -2, 18, 138, 448 }, // Җ
+    { 23, 19, 21, -1, 14, 110, 586 }, // җ
+    { 14, 25, 13, -1, 19, 88, 696 }, // Ҙ
+    { 11, 20, 11, 0, 14, 55, 784 }, // ҙ
+    { 16, 23, 15, 1, 18, 92, 839 }, // Қ
+    { 14, 19, 13, 0, 14, 67, 931 }, // қ
+    { 16, 18, 14, 1, 18, 72, 998 }, // Ҝ
+    { 14, 14, 12, 0, 14, 49, 1070 }, // ҝ
+    { 16, 18, 14, 1, 18, 72, 1119 }, // Ҟ
+    { 14, 19, 12, 0, 19, 67, 1191 }, // ҟ
+    { 17, 18, 16, 2, 18, 77, 1258 }, // Ҡ
+    { 16, 14, 14, 0, 14, 56, 1335 }, // ҡ
+    { 17, 23, 17, 1, 18, 98, 1391 }, // Ң
+    { 15, 19, 15, 0, 14, 72, 1489 }, // ң
+    { 21, 18, 19, 1, 18, 95, 1561 }, // Ҥ
+    { 19, 14, 17, 0, 14, 67, 1656 }, // ҥ
+    { 22, 25, 25, 1, 18, 138, 1723 }, // Ҧ
+    { 19, 21, 21, 0, 14, 100, 1861 }, // ҧ
+    { 17, 21, 18, 1, 19, 90, 1961 }, // Ҩ
+    { 13, 15, 15, 1, 14, 49, 2051 }, // ҩ
+    { 15, 25, 15, 1, 19, 94, 2100 }, // Ҫ
+    { 11, 20, 11, 1, 14, 55, 2194 }, // ҫ
+    { 13, 23, 13, 2, 18, 75, 2249 }, // Ҭ
+    { 21, 19, 22, 0, 14, 100, 2324 }, // ҭ
+    { 14, 18, 13, 2, 18, 63, 2424 }, // Ү
+    { 12, 20, 12, 1, 14, 60, 2487 }, // ү
+    { 15, 18, 13, 1, 18, 68, 2547 }, // Ұ
+    { 14, 20, 12, -1, 14, 70, 2615 }, // ұ
+    { 18, 23, 15, -2, 18, 104, 2685 }, // Ҳ
+    { 15, 19, 13, -1, 14, 72, 2789 }, // ҳ
+    { 18, 23, 20, 2, 18, 104, 2861 }, // Ҵ
+    { 15, 19, 16, 1, 14, 72, 2965 }, // ҵ
+    { 15, 23, 16, 2, 18, 87, 3037 }, // Ҷ
+    { 13, 19, 14, 1, 14, 62, 3124 }, // ҷ
+    { 15, 18, 16, 2, 18, 68, 3186 }, // Ҹ
+    { 13, 14, 14, 1, 14, 46, 3254 }, // ҹ
+    { 14, 18, 16, 1, 18, 63, 3300 }, // Һ
+    { 14, 19, 14, 0, 19, 67, 3363 }, // һ
+    { 18, 20, 19, 1, 19, 90, 3430 }, // Ҽ
+    { 15, 15, 15, 0, 14, 57, 3520 }, // ҽ
+    { 18, 24, 19, 1, 19, 108, 3577 }, // Ҿ
+    { 15, 19, 15, 0, 14, 72, 3685 }, // ҿ
+    { 11, 18, 8, -1, 18, 50, 3757 }, // Ӏ
+    { 25, 23, 20, -2, 23, 144, 3807 }, // Ӂ
+    { 24, 20, 22, -1, 19, 120, 3951 }, // ӂ
+    { 16, 25, 16, 1, 18, 100, 4071 }, // Ӄ
+    { 14, 21, 13, 0, 14, 74, 4171 }, // ӄ
+    { 18, 23, 17, -1, 18, 104, 4245 }, // Ӆ
+    { 15, 19, 14, -2, 14, 72, 4349 }, // ӆ
+    { 17, 25, 17, 1, 18, 107, 4421 }, // Ӈ
+    { 15, 21, 15, 0, 14, 79, 4528 }, // ӈ
+    { 17, 23, 17, 1, 18, 98, 4607 }, // Ӊ
+    { 15, 19, 15, 0, 14, 72, 4705 }, // ӊ
+    { 15, 23, 16, 2, 18, 87, 4777 }, // Ӌ
+    { 12, 19, 15, 2, 14, 57, 4864 }, // ӌ
+    { 21, 23, 21, 1, 18, 121, 4921 }, // Ӎ
+    { 17, 19, 18, 0, 14, 81, 5042 }, // ӎ
+    { 11, 18, 8, -1, 18, 50, 5123 }, // ӏ
+    { 17, 23, 14, -2, 23, 98, 5173 }, // Ӑ
+    { 13, 20, 14, 1, 19, 65, 5271 }, // ӑ
+    { 16, 23, 14, -2, 23, 92, 5336 }, // Ӓ
+    { 13, 20, 14, 1, 19, 65, 5428 }, // ӓ
+    { 24, 18, 21, -2, 18, 108, 5493 }, // Ӕ
+    { 19, 15, 21, 1, 14, 72, 5601 }, // ӕ
+    { 14, 23, 13, 1, 23, 81, 5673 }, // Ӗ
+    { 13, 20, 12, 1, 19, 65, 5754 }, // ӗ
+    { 15, 20, 17, 1, 19, 75, 5819 }, // Ә
+    { 12, 15, 12, 0, 14, 45, 5894 }, // ә
+    { 15, 24, 17, 1, 23, 90, 5939 }, // Ӛ
+    { 12, 20, 12, 0, 19, 60, 6029 }, // ӛ
+    { 25, 23, 20, -2, 23, 144, 6089 }, // Ӝ
+    { 24, 20, 22, -1, 19, 120, 6233 }, // ӝ
+    { 14, 24, 13, -1, 23, 84, 6353 }, // Ӟ
+    { 11, 20, 11, 0, 19, 55, 6437 }, // ӟ
+    { 14, 19, 13, 0, 18, 67, 6492 }, // Ӡ
+    { 14, 20, 12, -2, 14, 70, 6559 }, // ӡ
+    { 18, 21, 17, 0, 21, 95, 6629 }, // Ӣ
+    { 13, 18, 14, 1, 17, 59, 6724 }, // ӣ
+    { 18, 23, 17, 0, 23, 104, 6783 }, // Ӥ
+    { 13, 20, 14, 1, 19, 65, 6887 }, // ӥ
+    { 17, 24, 18, 1, 23, 102, 6952 }, // Ӧ
+    { 12, 20, 14, 1, 19, 60, 7054 }, // ӧ
+    { 17, 20, 18, 1, 19, 85, 7114 }, // Ө
+    { 12, 15, 14, 1, 14, 45, 7199 }, // ө
+    { 17, 24, 18, 1, 23, 102, 7244 }, // Ӫ
+    { 12, 20, 14, 1, 19, 60, 7346 }, // ӫ
+    { 15, 24, 15, 0, 23, 90, 7406 }, // Ӭ
+    { 11, 20, 12, 0, 19, 55, 7496 }, // ӭ
+    { 17, 22, 14, 0, 21, 94, 7551 }, // Ӯ
+    { 16, 23, 12, -3, 17, 92, 7645 }, // ӯ
+    { 17, 24, 14, 0, 23, 102, 7737 }, // Ӱ
+    { 16, 25, 12, -3, 19, 100, 7839 }, // ӱ
+    { 17, 25, 14, 0, 24, 107, 7939 }, // Ӳ
+    { 17, 26, 12, -3, 20, 111, 8046 }, // ӳ
+    { 14, 23, 16, 2, 23, 81, 8157 }, // Ӵ
+    { 13, 19, 14, 1, 19, 62, 8238 }, // ӵ
+    { 13, 23, 12, 1, 18, 75, 8300 }, // Ӷ
+    { 11, 19, 10, 0, 14, 53, 8375 }, // ӷ
+    { 20, 23, 20, 0, 23, 115, 8428 }, // Ӹ
+    { 17, 20, 18, 1, 19, 85, 8543 }, // ӹ
+    { 14, 23, 12, 0, 18, 81, 8628 }, // Ӻ
+    { 12, 19, 10, -1, 14, 57, 8709 }, // ӻ
+    { 18, 23, 13, -2, 18, 104, 8766 }, // Ӽ
+    { 14, 19, 12, -1, 14, 67, 8870 }, // ӽ
+    { 18, 18, 13, -2, 18, 81, 8937 }, // Ӿ
+    { 14, 14, 12, -1, 14, 49, 9018 }, // ӿ
+    { 0, 0, 13, 0, 0, 0, 9067 }, //  
+    { 0, 0, 25, 0, 0, 0, 9067 }, //  
+    { 0, 0, 13, 0, 0, 0, 9067 }, //  
+    { 0, 0, 25, 0, 0, 0, 9067 }, //  
+    { 0, 0, 8, 0, 0, 0, 9067 }, //  
+    { 0, 0, 6, 0, 0, 0, 9067 }, //  
+    { 0, 0, 4, 0, 0, 0, 9067 }, //  
+    { 0, 0, 14, 0, 0, 0, 9067 }, //  
+    { 0, 0, 6, 0, 0, 0, 9067 }, //  
+    { 0, 0, 4, 0, 0, 0, 9067 }, //  
+    { 0, 0, 3, 0, 0, 0, 9067 }, //  
+    { 0, 0, 0, 0, 0, 0, 9067 }, // ​
+    { 0, 0, 0, 0, 0, 0, 9067 }, // ‌
+    { 0, 0, 0, 0, 0, 0, 9067 }, // ‍
+    { 7, 22, 0, -1, 18, 39, 9067 }, // ‎
+    { 7, 22, 0, -6, 18, 39, 9106 }, // ‏
+    { 7, 3, 8, 0, 8, 6, 9145 }, // ‐
+    { 7, 3, 8, 0, 8, 6, 9151 }, // ‑
+    { 13, 2, 14, 1, 10, 7, 9157 }, // ‒
+    { 12, 3, 12, 0, 8, 9, 8847 }, // –
+    { 24, 3, 24, 0, 8, 18, 8856 }, // —
+    { 24, 3, 24, 0, 8, 18, 9164 }, // ―
+    { 9, 26, 14, 3, 19, 59, 9182 }, // ‖
+    { 12, 6, 10, -3, 0, 18, 9241 }, // ‗
+    { 6, 7, 4, 1, 18, 11, 8874 }, // ‘
+    { 6, 7, 4, 1, 18, 11, 8885 }, // ’
+    { 6, 7, 6, -2, 3, 11, 9259 }, // ‚
+    { 4, 7, 4, 2, 18, 7, 9270 }, // ‛
+    { 11, 7, 9, 1, 18, 20, 8896 }, // “
+    { 11, 7, 9, 1, 18, 20, 8916 }, // ”
+    { 11, 7, 11, -2, 3, 20, 9277 }, // „
+    { 8, 7, 9, 2, 18, 14, 9297 }, // ‟
+    { 10, 19, 12, 2, 19, 48, 9311 }, // †
+    { 13, 19, 12, 0, 19, 62, 9359 }, // ‡
+    { 6, 7, 9, 2, 13, 11, 9421 }, // •
+    { 8, 8, 9, 1, 13, 16, 9432 }, // ‣
+    { 4, 5, 13, 3, 4, 5, 9448 }, // ․
+    { 10, 5, 13, 0, 4, 13, 9453 }, // ‥
+    { 17, 5, 19, 0, 4, 22, 8936 }, // …
+    { 4, 5, 6, 1, 9, 5, 9466 }, // ‧
+    { 0, 0, 15, 0, 0, 0, 9471 }, //  
+    { 0, 0, 15, 0, 0, 0, 9471 }, //  
+    { 7, 20, 0, -1, 16, 35, 9471 }, // ‪
+    { 7, 20, 0, -6, 16, 35, 9506 }, // ‫
+    { 6, 22, 0, -3, 18, 33, 9541 }, // ‬
+    { 6, 22, 0, -3, 18, 33, 9574 }, // ‭
+    { 6, 22, 0, -3, 18, 33, 9607 }, // ‮
+    { 0, 0, 4, 0, 0, 0, 9640 }, //  
+    { 26, 20, 28, 2, 19, 130, 9640 }, // ‰
+    { 34, 20, 36, 2, 19, 170, 9770 }, // ‱
+    { 7, 7, 6, 1, 18, 13, 9940 }, // ′
+    { 11, 7, 10, 1, 18, 20, 9953 }, // ″
+    { 15, 7, 14, 1, 18, 27, 9973 }, // ‴
+    { 4, 7, 7, 3, 18, 7, 10000 }, // ‵
+    { 8, 7, 11, 3, 18, 14, 10007 }, // ‶
+    { 12, 7, 14, 3, 18, 21, 10021 }, // ‷
+    { 10, 9, 10, -3, 3, 23, 10042 }, // ‸
+    { 6, 11, 7, 1, 12, 17, 10065 }, // ‹
+    { 7, 11, 7, 0, 12, 20, 10082 }, // ›
+    { 19, 20, 21, 1, 19, 95, 10102 }, // ※
+    { 13, 19, 12, 0, 18, 62, 10197 }, // ‼
+    { 11, 20, 11, 1, 19, 55, 10259 }, // ‽
+    { 11, 2, 10, 2, 21, 6, 10314 }, // ‾
+    { 14, 6, 14, -2, 0, 21, 10320 }, // ‿
+    { 13, 6, 14, 2, 20, 20, 10341 }, // ⁀
+    { 12, 17, 9, -3, 11, 51, 10361 }, // ⁁
+    { 27, 24, 28, 0, 20, 162, 10412 }, // ⁂
+    { 7, 3, 7, 0, 8, 6, 10574 }, // ⁃
+    { 16, 18, 3, -6, 18, 72, 10580 }, // ⁄
+    { 11, 22, 7, -1, 18, 61, 10652 }, // ⁅
+    { 10, 22, 7, -2, 18, 55, 10713 }, // ⁆
+    { 22, 20, 22, 1, 19, 110, 10768 }, // ⁇
+    { 17, 20, 17, 1, 19, 85, 10878 }, // ⁈
+    { 18, 20, 17, 0, 19, 90, 10963 }, // ⁉
+    { 13, 14, 13, 1, 14, 46, 11053 }, // ⁊
+    { 13, 23, 15, 2, 19, 75, 11099 }, // ⁋
+    { 13, 14, 16, 1, 14, 46, 11174 }, // ⁌
+    { 13, 14, 16, 2, 14, 46, 11220 }, // ⁍
+    { 13, 13, 14, -1, 7, 43, 11266 }, // ⁎
+    { 6, 18, 6, 0, 14, 27, 11309 }, // ⁏
+    { 17, 26, 14, -2, 20, 111, 11336 }, // ⁐
+    { 15, 26, 14, 0, 20, 98, 11447 }, // ⁑
+    { 10, 20, 9, 0, 19, 50, 11545 }, // ⁒
+    { 22, 5, 25, 2, 10, 28, 11595 }, // ⁓
+    { 14, 6, 14, -3, 0, 21, 11623 }, // ⁔
+    { 14, 14, 14, 0, 13, 49, 11644 }, // ⁕
+    { 11, 20, 13, 1, 19, 55, 11693 }, // ⁖
+    { 19, 7, 18, 1, 18, 34, 11748 }, // ⁗
+    { 19, 20, 21, 1, 19, 95, 11782 }, // ⁘
+    { 19, 20, 21, 1, 19, 95, 11877 }, // ⁙
+    { 4, 20, 6, 1, 19, 20, 11972 }, // ⁚
+    { 15, 20, 16, 1, 19, 75, 11992 }, // ⁛
+    { 19, 20, 20, 0, 19, 95, 12067 }, // ⁜
+    { 4, 19, 7, 1, 18, 19, 12162 }, // ⁝
+    { 4, 20, 7, 2, 19, 20, 12181 }, // ⁞
+    { 0, 0, 6, 0, 0, 0, 12201 }, //  
+    { 0, 0, 15, 0, 0, 0, 12201 }, // ⁠
+    { 0, 0, 15, 0, 0, 0, 12201 }, // ⁡
+    { 0, 0, 15, 0, 0, 0, 12201 }, // ⁢
+    { 0, 0, 15, 0, 0, 0, 12201 }, // ⁣
+    { 0, 0, 15, 0, 0, 0, 12201 }, // ⁤
+    { 0, 0, 15, 0, 0, 0, 12201 }, // ⁦
+    { 0, 0, 15, 0, 0, 0, 12201 }, // ⁧
+    { 0, 0, 15, 0, 0, 0, 12201 }, // ⁨
+    { 0, 0, 15, 0, 0, 0, 12201 }, // ⁩
+    { 6, 22, 0, -3, 18, 33, 12201 }, // ⁪
+    { 6, 22, 0, -3, 18, 33, 12234 }, // ⁫
+    { 6, 22, 0, -3, 18, 33, 12267 }, // ⁬
+    { 6, 22, 0, -3, 18, 33, 12300 }, // ⁭
+    { 6, 22, 0, -3, 18, 33, 12333 }, // ⁮
+    { 6, 22, 0, -3, 18, 33, 12366 }, // ⁯
+    { 9, 12, 9, 2, 22, 27, 12399 }, // ⁰
+    { 4, 12, 6, 2, 19, 12, 12426 }, // ⁱ
+    { 9, 12, 9, 1, 22, 27, 12438 }, // ⁴
+    { 9, 12, 9, 2, 22, 27, 12465 }, // ⁵
+    { 9, 12, 9, 2, 22, 27, 12492 }, // ⁶
+    { 9, 12, 9, 2, 22, 27, 12519 }, // ⁷
+    { 9, 12, 9, 2, 22, 27, 12546 }, // ⁸
+    { 9, 12, 9, 2, 22, 27, 12573 }, // ⁹
+    { 8, 8, 8, 2, 19, 16, 12600 }, // ⁺
+    { 8, 2, 8, 2, 16, 4, 12616 }, // ⁻
+    { 8, 5, 8, 2, 18, 10, 12620 }, // ⁼
+    { 7, 14, 5, 2, 23, 25, 12630 }, // ⁽
+    { 6, 14, 5, 0, 23, 21, 12655 }, // ⁾
+    { 9, 9, 9, 1, 16, 21, 12676 }, // ⁿ
+    { 9, 12, 9, -1, 8, 27, 12697 }, // ₀
+    { 6, 12, 9, 0, 8, 18, 12724 }, // ₁
+    { 9, 12, 9, -2, 8, 27, 12742 }, // ₂
+    { 8, 12, 9, -1, 8, 24, 12769 }, // ₃
+    { 9, 12, 9, -1, 8, 27, 12793 }, // ₄
+    { 9, 12, 9, -1, 8, 27, 12820 }, // ₅
+    { 9, 12, 9, -1, 8, 27, 12847 }, // ₆
+    { 9, 12, 9, -1, 8, 27, 12874 }, // ₇
+    { 9, 12, 9, -1, 8, 27, 12901 }, // ₈
+    { 9, 12, 9, -1, 8, 27, 12928 }, // ₉
+    { 8, 8, 8, -1, 6, 16, 12955 }, // ₊
+    { 8, 2, 8, -1, 3, 4, 12971 }, // ₋
+    { 8, 5, 8, -1, 5, 10, 12975 }, // ₌
+    { 6, 14, 5, 0, 9, 21, 12985 }, // ₍
+    { 6, 14, 5, -3, 9, 21, 13006 }, // ₎
+    { 9, 9, 9, -1, 6, 21, 13027 }, // ₐ
+    { 8, 9, 8, -1, 6, 18, 13048 }, // ₑ
+    { 9, 9, 9, -1, 6, 21, 13066 }, // ₒ
+    { 9, 9, 8, -2, 6, 21, 13087 }, // ₓ
+    { 7, 9, 8, -1, 6, 16, 13108 }, // ₔ
+    { 9, 12, 11, 0, 9, 27, 13124 }, // ₕ
+    { 9, 12, 9, 0, 9, 27, 13151 }, // ₖ
+    { 5, 12, 6, 0, 9, 15, 13178 }, // ₗ
+    { 14, 9, 16, 0, 6, 32, 13193 }, // ₘ
+    { 9, 9, 9, -1, 6, 21, 13225 }, // ₙ
+    { 10, 12, 9, -2, 6, 30, 13246 }, // ₚ
+    { 7, 9, 8, -1, 6, 16, 13276 }, // ₛ
+    { 6, 11, 5, -1, 8, 17, 13292 }, // ₜ
+    { 14, 19, 14, 1, 19, 67, 13309 }, // ₠
+    { 14, 21, 14, 1, 19, 74, 13376 }, // ₡
+    { 14, 20, 14, 1, 19, 70, 13450 }, // ₢
+    { 15, 18, 14, 0, 18, 68, 13520 }, // ₣
+    { 16, 19, 14, -1, 19, 76, 13588 }, // ₤
+    { 21, 20, 22, 0, 17, 105, 13664 }, // ₥
+    { 15, 18, 14, 0, 18, 68, 13769 }, // ₦
+    { 18, 19, 18, 0, 18, 86, 13837 }, // ₧
+    { 21, 19, 20, 0, 18, 100, 13923 }, // ₨
+    { 18, 18, 16, 0, 18, 81, 14023 }, // ₩
+    { 21, 18, 20, 0, 18, 95, 14104 }, // ₪
+    { 17, 23, 14, 0, 19, 98, 14199 }, // ₫
+    { 16, 20, 14, 0, 19, 80, 14297 }, // €
+    { 17, 18, 14, 0, 18, 77, 14377 }, // ₭
+    { 14, 18, 13, 1, 18, 63, 14454 }, // ₮
+    { 24, 25, 24, 0, 19, 150, 14517 }, // ₯
+    { 16, 25, 14, -2, 19, 100, 14667 }, // ₰
+    { 16, 18, 14, 0, 18, 72, 14767 }, // ₱
+    { 16, 21, 17, 1, 19, 84, 14839 }, // ₲
+    { 17, 18, 14, -2, 18, 77, 14923 }, // ₳
+    { 15, 20, 13, -1, 19, 75, 15000 }, // ₴
+    { 15, 21, 15, 1, 19, 79, 15075 }, // ₵
+    { 16, 18, 14, 0, 17, 72, 15154 }, // ₶
+    { 18, 21, 16, -1, 19, 95, 15226 }, // ₷
+    { 14, 18, 12, 1, 18, 63, 15321 }, // ₸
+    { 13, 18, 14, 2, 18, 59, 15384 }, // ₹
+    { 14, 19, 14, 0, 18, 67, 15443 }, // ₺
+    { 16, 20, 17, 1, 19, 80, 15510 }, // ₻
+    { 19, 18, 19, -1, 18, 86, 15590 }, // ₼
+    { 16, 18, 15, -1, 18, 72, 15676 }, // ₽
+    { 17, 21, 15, -1, 21, 90, 15748 }, // ₾
+    { 13, 24, 14, 1, 21, 78, 15838 }, // ₿
+    { 7, 3, 8, 0, 8, 6, 15916 }, // −
+    { 23, 26, 16, -3, 20, 150, 15922 }, // ﬀ
+    { 18, 26, 14, -3, 20, 117, 16072 }, // ﬁ
+    { 18, 26, 14, -3, 20, 117, 16189 }, // ﬂ
+    { 26, 26, 22, -3, 20, 169, 16306 }, // ﬃ
+    { 26, 26, 22, -3, 20, 169, 16475 }, // ﬄ
+    { 21, 26, 15, -4, 20, 137, 16644 }, // ﬅ
+    { 20, 21, 19, 0, 20, 105, 16781 }, // ﬆ
+    { 23, 23, 25, 1, 19, 133, 16886 }, // �
 };
 
 static const EpdUnicodeInterval notosans_12_italicIntervals[] = {
@@ -2468,31 +2465,283 @@ static const EpdUnicodeInterval notosans_12_italicIntervals[] = {
     { 0x2090, 0x209C, 0x33D },
     { 0x20A0, 0x20BF, 0x34A },
     { 0x2212, 0x2212, 0x36A },
-    { 0xFFFD, 0xFFFD, 0x36B },
+    { 0xFB00, 0xFB06, 0x36B },
+    { 0xFFFD, 0xFFFD, 0x372 },
 };
 
 static const EpdFontGroup notosans_12_italicGroups[] = {
-    { 0, 3052, 5283, 97, 0 },
-    { 3052, 2962, 6220, 96, 97 },
-    { 6014, 4284, 9733, 128, 193 },
-    { 10298, 1060, 1335, 112, 321 },
-    { 11358, 9306, 19770, 256, 433 },
-    { 20664, 1840, 3443, 111, 689 },
-    { 22504, 699, 910, 42, 800 },
-    { 23203, 1706, 2607, 32, 842 },
-    { 24909, 8, 6, 1, 874 },
-    { 24917, 90, 133, 1, 875 },
+    { 0, 4189, 8958, 151, 2 },
+    { 4189, 2589, 4697, 66, 434 },
+    { 6778, 9576, 19730, 366, 0 },
+    { 16354, 8479, 17019, 300, 576 },
+};
+
+static const uint8_t notosans_12_italicGlyphGroups[883] = {
+    2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2,
+    2, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 2, 2,
+    2, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 0, 0, 3, 3, 3, 0, 0, 3, 3, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+};
+
+static const uint8_t notosans_12_italicKernLeftClasses[883] = {
+    0, 0, 0, 0, 2, 0, 0, 0, 47, 2, 15, 0, 0, 0, 6, 28,
+    6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 12, 0, 0, 21, 23, 55, 0, 0, 0, 0, 0, 22, 0,
+    0, 21, 39, 21, 0, 0, 11, 0, 45, 45, 0, 17, 0, 15, 0, 0,
+    0, 23, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 29, 0, 0, 0, 33, 33, 0, 33, 0, 15, 0, 0,
+    0, 0, 23, 0, 0, 0, 0, 0, 0, 0, 0, 0, 38, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27, 0, 0, 0,
+    49, 12, 12, 12, 12, 12, 12, 23, 0, 23, 23, 23, 23, 0, 0, 0,
+    0, 21, 0, 21, 21, 21, 21, 21, 0, 21, 0, 0, 0, 0, 17, 39,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    54, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 0,
+    33, 12, 0, 12, 0, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21,
+    34, 21, 0, 23, 0, 23, 0, 23, 0, 23, 0, 23, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 0, 54, 0, 0, 57,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 22, 0, 22, 34,
+    22, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 0, 21,
+    0, 21, 0, 23, 0, 0, 29, 0, 29, 0, 29, 0, 0, 0, 0, 0,
+    0, 0, 0, 11, 0, 11, 54, 11, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 45, 33, 17, 33, 17, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 10, 9, 0, 0, 0, 0, 56, 10, 10, 37, 13, 0, 1,
+    0, 4, 52, 0, 9, 3, 0, 13, 0, 0, 0, 13, 0, 0, 0, 14,
+    0, 25, 0, 9, 1, 41, 13, 3, 0, 0, 3, 10, 0, 10, 14, 14,
+    0, 16, 48, 30, 16, 0, 16, 16, 30, 16, 16, 16, 16, 16, 16, 7,
+    35, 7, 16, 35, 19, 7, 16, 26, 16, 16, 26, 5, 16, 5, 7, 7,
+    16, 16, 16, 40, 16, 16, 16, 0, 51, 53, 5, 5, 35, 16, 16, 19,
+    16, 1, 42, 32, 5, 0, 0, 4, 36, 4, 36, 0, 0, 0, 0, 0,
+    30, 0, 0, 14, 7, 1, 42, 1, 42, 19, 19, 14, 7, 14, 7, 1,
+    42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 32, 5, 25,
+    7, 8, 43, 20, 44, 0, 31, 18, 0, 0, 30, 18, 0, 13, 16, 13,
+    16, 13, 16, 3, 0, 20, 43, 0, 31, 0, 7, 0, 0, 8, 0, 24,
+    42, 24, 42, 18, 0, 3, 0, 3, 0, 0, 0, 0, 31, 0, 16, 0,
+    16, 0, 13, 16, 0, 16, 3, 0, 0, 0, 3, 0, 0, 0, 3, 0,
+    0, 4, 0, 4, 0, 0, 16, 0, 16, 14, 7, 14, 7, 13, 16, 0,
+    30, 0, 0, 0, 0, 0, 0, 14, 7, 14, 7, 14, 7, 14, 7, 1,
+    19, 1, 19, 1, 19, 0, 16, 8, 43, 0, 16, 20, 44, 18, 0, 13,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 28, 28, 28, 0, 0, 2, 2, 6, 0, 2, 2, 6,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 38, 27, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 58, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 59, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0,
+    0, 0, 0,
+};
+
+static const uint8_t notosans_12_italicKernRightClasses[883] = {
+    0, 0, 0, 52, 5, 0, 0, 0, 59, 5, 0, 29, 0, 0, 3, 26,
+    3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 52, 0, 12, 0, 19, 0, 0, 0, 19, 0, 0, 36, 0, 0, 0,
+    0, 19, 0, 19, 0, 0, 13, 0, 44, 44, 0, 20, 0, 0, 0, 29,
+    0, 0, 0, 9, 0, 2, 2, 2, 51, 31, 0, 0, 51, 0, 0, 8,
+    8, 2, 8, 2, 8, 9, 0, 8, 0, 0, 0, 0, 49, 0, 0, 29,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 30, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0,
+    0, 12, 12, 12, 12, 12, 12, 0, 19, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 19, 19, 19, 19, 19, 0, 19, 0, 0, 0, 0, 20, 0,
+    51, 2, 9, 9, 9, 9, 9, 9, 2, 2, 2, 2, 2, 0, 0, 0,
+    0, 0, 8, 2, 2, 2, 2, 2, 0, 2, 8, 8, 8, 8, 0, 0,
+    0, 12, 9, 12, 9, 12, 9, 19, 2, 19, 2, 19, 2, 19, 2, 0,
+    2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 19, 31, 19,
+    31, 19, 31, 19, 31, 0, 0, 0, 52, 0, 50, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 51, 0, 0, 8, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 8, 0, 8, 0, 8, 0, 0, 8, 19, 2, 19,
+    2, 19, 2, 19, 2, 0, 8, 0, 8, 0, 0, 0, 9, 0, 9, 0,
+    9, 0, 9, 13, 0, 13, 0, 13, 0, 0, 8, 0, 8, 0, 8, 0,
+    8, 0, 8, 0, 8, 44, 0, 20, 0, 20, 0, 49, 0, 49, 0, 49,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 33, 57, 0, 0, 27, 21, 0, 1, 0, 0, 15,
+    0, 11, 0, 0, 0, 37, 0, 17, 32, 0, 0, 0, 21, 0, 0, 33,
+    0, 0, 33, 1, 15, 40, 17, 0, 4, 0, 0, 1, 0, 0, 32, 0,
+    54, 14, 0, 14, 39, 47, 14, 24, 39, 24, 24, 24, 25, 24, 24, 14,
+    24, 24, 14, 24, 7, 14, 24, 24, 6, 24, 24, 18, 24, 24, 24, 24,
+    55, 14, 14, 22, 39, 14, 53, 0, 32, 45, 25, 24, 22, 24, 24, 7,
+    24, 35, 56, 0, 0, 0, 16, 11, 28, 0, 16, 0, 0, 0, 16, 32,
+    39, 4, 16, 19, 10, 35, 56, 35, 56, 19, 10, 19, 10, 19, 10, 35,
+    56, 19, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 0, 22, 0,
+    16, 0, 16, 0, 0, 0, 16, 17, 39, 32, 39, 0, 16, 0, 16, 0,
+    22, 38, 18, 0, 16, 0, 16, 0, 16, 19, 10, 19, 10, 1, 16, 41,
+    48, 41, 48, 17, 24, 38, 18, 4, 6, 4, 6, 0, 16, 34, 42, 34,
+    42, 0, 17, 24, 0, 16, 43, 28, 0, 16, 0, 16, 4, 6, 0, 16,
+    0, 11, 58, 11, 58, 11, 58, 0, 10, 0, 39, 0, 39, 17, 24, 32,
+    39, 0, 0, 0, 16, 0, 16, 19, 10, 19, 10, 19, 10, 32, 24, 15,
+    7, 15, 7, 15, 7, 4, 6, 0, 16, 0, 24, 0, 0, 17, 24, 17,
+    24, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 26, 26, 26, 0, 0, 23, 5, 3, 0, 23, 5, 3,
+    0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 30, 46, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 60, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 61, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 51, 0, 0, 0, 0,
+    0, 0, 0,
+};
+
+static const int8_t notosans_12_italicKernMatrix[3720] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, -2, 1, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, -2, 0, 0, -1, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 0, -1, -1, -2, -2, -2, 0, 0, 1, 0, 1, 0, 0, 0, -1, 1, 0, 0, -1, 0, 0, -2, 0, 0, -1, 1, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 3, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, 0, -2, -2, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -2, 0, 0, 0, 1, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, -1, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, 0, -3, -2, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, 0, -2, 0, -2, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, 0, 0, -2, 0, -1, -2, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, 0, -1, -1, 0, 0, -2, -1, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, -2, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, -2, 1, 0, -1, -2, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, 0, -2, -2, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, -2, 0, 0, 0, 0, -1, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 3, 0, 0, 0, 0, 1, 0, 0, 0, 2, 1, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -2, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, 0, -1, 0, 0, 0, -1, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0,
+    0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 3, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -3, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -2, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, 0, -2, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+};
+
+static const EpdLigaturePair notosans_12_italicLigatures[] = {
+    { 0x66, 0x66, 0xFB00 },
+    { 0x66, 0x69, 0xFB01 },
+    { 0x66, 0x6C, 0xFB02 },
+    { 0xFB00, 0x69, 0xFB03 },
+    { 0xFB00, 0x6C, 0xFB04 },
+};
+
+static const uint16_t notosans_12_italicGlyphLookup[368] = {
+    0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0001, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, 0x0010, 0x0011,
+    0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, 0x0020, 0x0021,
+    0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, 0x0030, 0x0031,
+    0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, 0x0040, 0x0041,
+    0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051,
+    0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, 0x0060, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070,
+    0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, 0x0080,
+    0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F, 0x0090,
+    0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F, 0x00A0,
+    0x00A1, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF, 0x00B0,
+    0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF, 0x00C0,
+    0x02B1, 0x02B2, 0x02B3, 0x02B4, 0x02B5, 0x02B6, 0x02B7, 0x02B8, 0x02B9, 0x02BA, 0x02BB, 0x02BC, 0x02BD, 0x02BE, 0x02BF, 0x02C0,
+    0x02C1, 0x02C2, 0x02C3, 0x02C4, 0x02C5, 0x02C6, 0x02C7, 0x02C8, 0x02C9, 0x02CA, 0x02CB, 0x02CC, 0x02CD, 0x02CE, 0x02CF, 0x02D0,
+    0x02D1, 0x02D2, 0x02D3, 0x02D4, 0x02D5, 0x02D6, 0x02D7, 0x02D8, 0x02D9, 0x02DA, 0x02DB, 0x02DC, 0x02DD, 0x02DE, 0x02DF, 0x02E0,
+    0x02E1, 0x02E2, 0x02E3, 0x02E4, 0x02E5, 0x02E6, 0x02E7, 0x02E8, 0x02E9, 0x02EA, 0x02EB, 0x02EC, 0x02ED, 0x02EE, 0x02EF, 0x02F0,
+    0x02F1, 0x02F2, 0x02F3, 0x02F4, 0x02F5, 0x02F6, 0x02F7, 0x02F8, 0x02F9, 0x02FA, 0x02FB, 0x02FC, 0x02FD, 0x02FE, 0x02FF, 0x0300,
+    0x0301, 0x0302, 0x0303, 0x0304, 0x0305, 0x0306, 0x0307, 0x0308, 0x0309, 0x030A, 0x030B, 0x030C, 0x030D, 0x030E, 0x030F, 0x0310,
+    0x0311, 0x0312, 0x0313, 0x0314, 0x0315, 0xFFFF, 0x0316, 0x0317, 0x0318, 0x0319, 0x031A, 0x031B, 0x031C, 0x031D, 0x031E, 0x031F,
 };
 
 static const EpdFontData notosans_12_italic = {
     notosans_12_italicBitmaps,
     notosans_12_italicGlyphs,
     notosans_12_italicIntervals,
-    15,
+    16,
     34,
     27,
     -8,
     true,
     notosans_12_italicGroups,
-    10,
+    4,
+    notosans_12_italicKernLeftClasses,
+    notosans_12_italicKernRightClasses,
+    notosans_12_italicKernMatrix,
+    62,
+    notosans_12_italicLigatures,
+    5,
+    0x4000000001ull,
+    notosans_12_italicGlyphLookup,
+    notosans_12_italicGlyphGroups,
+    false,
+    nullptr,
 };
@@ -3,1902 +3,1913 @@
  * name: notosans_14_bold
  * size: 14
  * mode: 2-bit  compressed: true
- * Command used: fontconvert.py notosans_14_bold 14 ../builtinFonts/source/NotoSans/NotoSans-Bold.ttf --2bit --compress
+ * Command used: fontconvert.py notosans_14_bold 14 ../builtinFonts/source/NotoSans/NotoSans-Bold.ttf --2bit --compress --frequency-corpus ../../../test/hyphenation_eval/resources/english_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/french_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/german_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/italian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/russian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/spanish_hyphenation_tests.txt
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t notosans_14_boldBitmaps[30237] = {
-    0xBD, 0x59, 0xBF, 0xAF, 0x1D, 0xC5, 0x15, 0x9E, 0xBB, 0xCB, 0x7B, 0x2B, 0x79, 0x8B, 0xA1, 0x30,
-    0x45, 0xEC, 0x48, 0x9B, 0x32, 0xB2, 0x84, 0xF6, 0x3F, 0xC8, 0xAC, 0x41, 0x11, 0x05, 0x85, 0x5D,
-    0xC4, 0x42, 0x8A, 0x0B, 0xD7, 0x10, 0x05, 0xB7, 0xA9, 0x3C, 0x8B, 0x5D, 0xB8, 0x70, 0x81, 0x0B,
-    0x08, 0x65, 0x22, 0x85, 0xFC, 0xE0, 0x46, 0x91, 0x53, 0xA4, 0x8A, 0x82, 0x67, 0x6D, 0x17, 0x14,
-    0x14, 0x2C, 0x3C, 0x11, 0x17, 0x2E, 0xDE, 0x82, 0x21, 0x28, 0xA6, 0xF0, 0x82, 0xD7, 0xBC, 0x7D,
-    0xCF, 0x3B, 0x73, 0xF2, 0x7D, 0xB3, 0xF7, 0x3D, 0x9E, 0xC1, 0x76, 0x0C, 0x91, 0x72, 0xDF, 0xDD,
-    0xBD, 0x33, 0x3B, 0x3F, 0x76, 0xE6, 0x9C, 0xEF, 0x9C, 0xF3, 0x9D, 0x79, 0xF6, 0x7A, 0x30, 0x1B,
-    0x3E, 0x7E, 0x27, 0x73, 0x8D, 0xDF, 0xF2, 0xEA, 0xA4, 0x94, 0x5A, 0x4B, 0xBD, 0xFD, 0x2C, 0x98,
-    0xE6, 0xF8, 0xFC, 0x90, 0xDF, 0xB3, 0xAB, 0x6F, 0xF9, 0xCC, 0x78, 0xE8, 0xE8, 0x9B, 0x2A, 0xED,
-    0x7E, 0xA2, 0x54, 0x71, 0x65, 0x54, 0xEA, 0x72, 0xDE, 0xAA, 0x64, 0x30, 0x95, 0xD2, 0x0D, 0x86,
-    0x9A, 0xB4, 0x5F, 0x08, 0x3E, 0x19, 0xAE, 0xA9, 0xC0, 0xAD, 0x57, 0x93, 0x6E, 0x54, 0xDA, 0x9B,
-    0xB9, 0xFB, 0x4B, 0x72, 0x69, 0xE7, 0x95, 0xBD, 0x0E, 0xCA, 0x3E, 0xD7, 0x2B, 0x35, 0x15, 0x8D,
-    0xCA, 0xBA, 0xCB, 0x4A, 0x95, 0x67, 0x07, 0xA5, 0xFC, 0x6E, 0xF7, 0xF8, 0x79, 0x1A, 0xD7, 0xDF,
-    0x94, 0x3A, 0x2D, 0x17, 0x35, 0xE6, 0xC2, 0x98, 0x77, 0x64, 0xC7, 0x97, 0x1F, 0xB7, 0x4F, 0xBA,
-    0x0B, 0x55, 0x22, 0x7F, 0x51, 0xA9, 0x0C, 0x2A, 0x13, 0x8F, 0x5F, 0xA9, 0x16, 0x4E, 0x2A, 0xE5,
-    0x44, 0x25, 0xD7, 0xBD, 0xCA, 0x8F, 0xED, 0x5C, 0x7C, 0xDA, 0xDC, 0x08, 0x22, 0xA5, 0xC8, 0xE0,
-    0xD0, 0x7A, 0x48, 0x2E, 0xC6, 0xA9, 0x92, 0x56, 0xA9, 0x75, 0xB5, 0xFB, 0x29, 0x07, 0x95, 0x0E,
-    0x4A, 0x4B, 0xAB, 0x9C, 0xC2, 0xC2, 0x95, 0x6E, 0x95, 0xB9, 0x36, 0x24, 0x13, 0x9E, 0x9A, 0x1A,
-    0x8B, 0x30, 0xCF, 0x4C, 0xBA, 0x43, 0xA5, 0xBC, 0xC2, 0xCD, 0x3D, 0x33, 0x9A, 0x9A, 0x2D, 0xE7,
-    0xFB, 0x97, 0xAB, 0xF2, 0xDA, 0xE0, 0x4D, 0xC0, 0x98, 0xF2, 0x5D, 0x19, 0x72, 0xD9, 0x18, 0x42,
-    0xD9, 0x14, 0x9D, 0x2B, 0x28, 0x05, 0x7D, 0x65, 0xC2, 0x44, 0xE9, 0x58, 0x34, 0x5E, 0x29, 0xBB,
-    0x60, 0x45, 0x77, 0xAC, 0x2C, 0x26, 0xE5, 0xB1, 0x5B, 0x53, 0xE9, 0x7B, 0x93, 0xCA, 0x7B, 0x65,
-    0x04, 0x1B, 0xC6, 0x8B, 0xDB, 0xB8, 0x98, 0x6A, 0xB5, 0xA8, 0x02, 0xFB, 0x50, 0xA5, 0x8C, 0x2C,
-    0xA1, 0xA8, 0xB7, 0x6D, 0xAF, 0xD2, 0x29, 0xC5, 0xC4, 0xB2, 0xC0, 0x00, 0xD3, 0xE2, 0x61, 0xE6,
-    0xA5, 0x41, 0x9D, 0xB7, 0x42, 0x6A, 0x76, 0x6F, 0xF2, 0xA9, 0x94, 0x29, 0xF5, 0xDA, 0xCB, 0x15,
-    0xC9, 0x27, 0x3D, 0xC9, 0x39, 0x61, 0x07, 0x69, 0xB4, 0x74, 0xD8, 0xA7, 0xF4, 0x99, 0xFC, 0x1A,
-    0xA2, 0xA2, 0xF4, 0x5B, 0x48, 0xF3, 0xB6, 0x57, 0x56, 0x6A, 0xBC, 0xFA, 0x20, 0x5E, 0x69, 0xDE,
-    0xBB, 0x33, 0x05, 0xF3, 0xEA, 0xC7, 0xC3, 0x8B, 0xEA, 0x32, 0x44, 0x61, 0xEA, 0xB2, 0xD1, 0x5D,
-    0xDE, 0xE3, 0x9D, 0x41, 0xD9, 0xAA, 0x6C, 0x62, 0x51, 0x94, 0x69, 0x74, 0x0F, 0xE1, 0x38, 0x55,
-    0xB4, 0xE9, 0x88, 0x7A, 0xC9, 0x1F, 0x87, 0xCD, 0x2D, 0xBC, 0x3A, 0x54, 0x95, 0x35, 0x64, 0xC9,
-    0x1A, 0xBA, 0xD8, 0x4A, 0x73, 0x88, 0xAB, 0x62, 0xCF, 0x80, 0x19, 0x75, 0x17, 0x0B, 0x98, 0xAD,
-    0x65, 0x13, 0x46, 0x60, 0xBE, 0xDA, 0x34, 0x45, 0x7B, 0xE0, 0xE2, 0xBC, 0x6F, 0x08, 0x17, 0x1D,
-    0x80, 0x26, 0xA5, 0x00, 0xAA, 0xCB, 0xC5, 0xC9, 0x9B, 0x58, 0xEA, 0xAB, 0xB8, 0xD6, 0xEC, 0xF6,
-    0x71, 0xAC, 0x5F, 0xE9, 0xDB, 0x9D, 0x72, 0x98, 0x70, 0x32, 0x4D, 0xD6, 0xFE, 0x4A, 0x2D, 0x38,
-    0x68, 0x0D, 0xB2, 0x22, 0x5A, 0x20, 0x9D, 0x14, 0x60, 0x02, 0x7A, 0x50, 0xCD, 0x31, 0xC8, 0x8A,
-    0x78, 0xFC, 0x0C, 0x27, 0xEC, 0x89, 0xEA, 0xFE, 0x56, 0xA5, 0x20, 0xDA, 0xB5, 0xE3, 0x90, 0x23,
-    0x54, 0xD4, 0xBA, 0x74, 0xD4, 0xCD, 0x91, 0xE5, 0x31, 0xD9, 0x90, 0x41, 0xFC, 0x1E, 0xF4, 0x21,
-    0x5C, 0x95, 0x00, 0x58, 0x93, 0xCA, 0x46, 0x95, 0x03, 0x23, 0xBD, 0x2A, 0x3A, 0x08, 0x80, 0x5F,
-    0x57, 0xA1, 0x71, 0x11, 0x1E, 0xD5, 0xBE, 0xFA, 0x24, 0x90, 0xAF, 0x95, 0x1E, 0xF0, 0xEC, 0xCA,
-    0x6D, 0x81, 0xE2, 0xE4, 0xFC, 0xB4, 0x90, 0xB2, 0x4B, 0x27, 0xA9, 0xF5, 0x96, 0x57, 0xE6, 0x36,
-    0x14, 0xE3, 0xDA, 0x34, 0x08, 0x20, 0xC1, 0x2A, 0xA4, 0x7A, 0xBA, 0xC3, 0x1A, 0x9A, 0xA2, 0x97,
-    0xCA, 0x5D, 0x95, 0x93, 0x1E, 0x63, 0xA1, 0x39, 0x01, 0xC4, 0x3B, 0xA5, 0xB0, 0x2C, 0xBE, 0xB2,
-    0x80, 0x80, 0xA7, 0x44, 0x26, 0x2D, 0x93, 0xD9, 0x9A, 0x8A, 0x77, 0xA6, 0x03, 0x19, 0xD6, 0xF1,
-    0x78, 0x5F, 0x7C, 0xD6, 0xA5, 0x03, 0x70, 0x07, 0xA0, 0xAB, 0xB7, 0x3B, 0xD2, 0xBF, 0xAD, 0x5C,
-    0x53, 0x11, 0x59, 0x6C, 0x2D, 0x21, 0x26, 0x00, 0x2A, 0x47, 0xD1, 0xB5, 0x2A, 0x27, 0x80, 0x5B,
-    0xA0, 0xED, 0xBE, 0x1F, 0x59, 0x2E, 0x61, 0x52, 0x30, 0x2E, 0xB9, 0x87, 0xAB, 0xE3, 0x94, 0x87,
-    0xA5, 0xCB, 0xE6, 0x29, 0x07, 0xF3, 0x2F, 0xE9, 0x7E, 0xA4, 0x80, 0x4C, 0x4E, 0x99, 0x43, 0xD4,
-    0xA6, 0x59, 0x3B, 0xE9, 0x81, 0xD0, 0x5A, 0xB9, 0x00, 0xAB, 0x45, 0x4B, 0x12, 0x5B, 0x2B, 0x95,
-    0x62, 0x42, 0x7D, 0x17, 0x6F, 0xDA, 0x7C, 0xED, 0xB0, 0x18, 0x8C, 0xC5, 0x74, 0x47, 0x1D, 0x66,
-    0x5C, 0x44, 0x09, 0x96, 0x98, 0xBA, 0xC0, 0x04, 0x1A, 0xA8, 0xC8, 0x31, 0x3C, 0x43, 0x4B, 0x0A,
-    0xBB, 0x48, 0x42, 0x80, 0x29, 0xB9, 0x5A, 0x05, 0xF4, 0x70, 0x78, 0x85, 0x4D, 0x88, 0x30, 0x07,
-    0xD4, 0x96, 0x5D, 0xB1, 0x73, 0x29, 0x5C, 0xC0, 0x3C, 0x5F, 0xD2, 0xC3, 0xBC, 0xB4, 0x74, 0x3B,
-    0xF3, 0x22, 0xD0, 0x03, 0xEF, 0xA9, 0xE3, 0xA4, 0x58, 0x65, 0x03, 0x78, 0x60, 0x29, 0x13, 0x90,
-    0xD2, 0x97, 0x30, 0x3F, 0x2E, 0x86, 0x96, 0xDB, 0x1F, 0x87, 0x51, 0xD2, 0x48, 0x02, 0xE4, 0xEE,
-    0x93, 0xD7, 0xED, 0x4A, 0x24, 0x66, 0xB7, 0x4F, 0xA5, 0xCA, 0x2F, 0xB7, 0x5F, 0x10, 0xBC, 0x01,
-    0xE6, 0x26, 0x4D, 0x09, 0x07, 0x14, 0xB5, 0x12, 0xD7, 0x2B, 0x58, 0x26, 0x07, 0x0F, 0x5A, 0x5E,
-    0xAF, 0x21, 0xA9, 0xB8, 0x3F, 0x8C, 0xB6, 0x47, 0x5F, 0x4B, 0x26, 0xE7, 0xF5, 0x3D, 0xF1, 0xD8,
-    0xE5, 0x04, 0x30, 0x6C, 0x85, 0xA8, 0x7B, 0xE7, 0xDA, 0x24, 0xB8, 0x3A, 0xDF, 0x96, 0xCA, 0x6C,
-    0xC8, 0x0B, 0x82, 0x97, 0x8E, 0x90, 0x63, 0x9D, 0x70, 0x5A, 0x18, 0x26, 0x7A, 0x87, 0x7D, 0x97,
-    0x8F, 0xDA, 0x8F, 0xFB, 0xE1, 0xB4, 0x94, 0x0F, 0x17, 0xE6, 0x9A, 0xB8, 0x38, 0xCA, 0x3B, 0x0D,
-    0xB3, 0x1A, 0x35, 0xBD, 0x47, 0xFF, 0xF5, 0xDA, 0x57, 0x5D, 0x12, 0x99, 0x57, 0x0A, 0x04, 0xC0,
-    0x55, 0xC2, 0x6F, 0x41, 0x5D, 0x9D, 0xFD, 0x42, 0x94, 0x7D, 0x07, 0xF6, 0xAD, 0xFB, 0x7C, 0x2C,
-    0x07, 0xD7, 0x52, 0x02, 0x25, 0x7D, 0x22, 0x50, 0x89, 0xC5, 0xC8, 0x07, 0x72, 0x01, 0x68, 0x33,
-    0x58, 0xAA, 0xA8, 0x0C, 0x30, 0x2D, 0x3F, 0xF7, 0x89, 0x1C, 0x9B, 0x3D, 0x7C, 0x93, 0xEF, 0x97,
-    0xC0, 0xE9, 0x6D, 0xBC, 0x42, 0x6A, 0xCC, 0xDB, 0x15, 0xC1, 0x0D, 0x65, 0x9F, 0x4F, 0x26, 0xDA,
-    0x6B, 0xEA, 0x71, 0x05, 0x94, 0x83, 0xE9, 0xF3, 0x80, 0xB6, 0xA0, 0xA3, 0x8C, 0xBF, 0xF2, 0xEA,
-    0xE5, 0xB3, 0xD3, 0xBC, 0xAD, 0x2C, 0xAE, 0x79, 0xB1, 0x26, 0x5D, 0x1E, 0xE7, 0x0D, 0x90, 0xE6,
-    0x1E, 0xE6, 0x69, 0x95, 0xED, 0x9B, 0x7B, 0x8E, 0x7B, 0x9F, 0x9D, 0x96, 0x57, 0xE4, 0x7C, 0xD0,
-    0xC3, 0x81, 0x3D, 0xA3, 0xE3, 0xE7, 0xA9, 0x4A, 0x9E, 0x85, 0xEB, 0xB6, 0xF4, 0xDF, 0xBB, 0xC1,
-    0x64, 0x01, 0x39, 0xD8, 0x4A, 0x15, 0x9E, 0x40, 0x5A, 0x00, 0x47, 0xD6, 0x47, 0x5F, 0x8B, 0x9D,
-    0x26, 0xC4, 0x9C, 0x6C, 0x33, 0xD2, 0x54, 0xF1, 0xAD, 0x34, 0x5C, 0x76, 0x56, 0x3F, 0xE0, 0xC8,
-    0x97, 0x96, 0xCB, 0xDF, 0x01, 0x4E, 0x9B, 0xB8, 0x7E, 0xBE, 0x5C, 0xFE, 0x69, 0x35, 0x9F, 0xDE,
-    0xE7, 0x65, 0x76, 0xED, 0x1D, 0x00, 0xD3, 0xD4, 0x0A, 0xB6, 0x62, 0x57, 0xA8, 0xE5, 0xDC, 0xCA,
-    0x8D, 0x31, 0xD8, 0xAC, 0x4B, 0xCB, 0xD7, 0x38, 0xF8, 0x41, 0xA9, 0x52, 0x69, 0x63, 0xE7, 0x1F,
-    0xEF, 0x5B, 0x37, 0xDE, 0x6F, 0x63, 0x74, 0x1C, 0xCD, 0x1F, 0xE4, 0x4A, 0x45, 0x00, 0x41, 0x7D,
-    0xD1, 0xF7, 0xC3, 0xB5, 0xF4, 0xB4, 0xFC, 0x54, 0x22, 0x90, 0x09, 0x80, 0xB0, 0x37, 0x8E, 0x06,
-    0x23, 0xD1, 0x5A, 0x68, 0x57, 0x6C, 0x3B, 0x18, 0xA7, 0x0B, 0x58, 0x50, 0xC6, 0x50, 0x0B, 0x28,
-    0x5D, 0xE2, 0x5E, 0x6B, 0x58, 0x70, 0xC4, 0x50, 0x9F, 0xF7, 0x6B, 0x6F, 0x25, 0x08, 0xBE, 0x46,
-    0xBA, 0xA9, 0x44, 0x50, 0xEE, 0xDE, 0x36, 0xA9, 0xCF, 0xBB, 0x33, 0x36, 0xEB, 0xF3, 0xCE, 0x9E,
-    0xC9, 0x3B, 0xDC, 0x2F, 0xEB, 0x56, 0xCF, 0xF7, 0xF6, 0xCC, 0x65, 0xDD, 0xE9, 0xD6, 0x9F, 0xC9,
-    0xFB, 0xF2, 0xA3, 0xC9, 0xA6, 0xDC, 0xB4, 0x39, 0x0A, 0x8B, 0xED, 0xCA, 0xE6, 0x48, 0x7D, 0xA4,
-    0xD2, 0xD1, 0x0D, 0x10, 0x7A, 0x07, 0xB1, 0xE3, 0x4F, 0x4F, 0x52, 0x00, 0xC2, 0x18, 0xB6, 0x2E,
-    0x31, 0xBC, 0xAD, 0x45, 0x35, 0x32, 0x5E, 0xA9, 0x28, 0x2D, 0xC7, 0xB5, 0x1B, 0xD6, 0xF5, 0x3D,
-    0x3A, 0xFC, 0x6D, 0xD4, 0x09, 0x12, 0xAC, 0x5F, 0xA3, 0xEE, 0x5E, 0x89, 0x91, 0x0E, 0xF5, 0xA2,
-    0x47, 0x3D, 0x07, 0xFE, 0x30, 0x7A, 0x29, 0x0D, 0xE9, 0x05, 0x62, 0x0E, 0xEE, 0x34, 0x0E, 0x69,
-    0x0A, 0xB8, 0xDE, 0x51, 0x53, 0x2A, 0x84, 0xBE, 0x7D, 0x9F, 0xBB, 0x1F, 0x31, 0x2D, 0xA4, 0x64,
-    0xE5, 0xDF, 0xEC, 0xD8, 0xE1, 0x1A, 0xDD, 0x2D, 0x37, 0xB9, 0x26, 0xF7, 0x0E, 0x48, 0x9C, 0xAF,
-    0x7C, 0x72, 0x1F, 0x3A, 0x52, 0x83, 0x1A, 0xD7, 0xC5, 0xD8, 0x67, 0x6E, 0x17, 0xD7, 0x24, 0x32,
-    0xFF, 0x66, 0x01, 0xE3, 0x3C, 0xDA, 0xA6, 0x79, 0x9E, 0x95, 0xBC, 0x17, 0xF0, 0x63, 0xD9, 0x6C,
-    0xA9, 0x3E, 0x93, 0x5B, 0xB0, 0xDA, 0x7A, 0x71, 0x94, 0x51, 0x98, 0xDB, 0x31, 0x10, 0x04, 0x77,
-    0x40, 0x67, 0x49, 0x8B, 0xA4, 0xC7, 0x54, 0x58, 0x65, 0x34, 0xCD, 0xD8, 0xA3, 0x64, 0x05, 0xEB,
-    0xAC, 0x5C, 0x38, 0xD9, 0x6B, 0x2A, 0x07, 0xB3, 0x53, 0x4E, 0x30, 0xE1, 0xE3, 0x71, 0xD5, 0x39,
-    0x4D, 0x9D, 0x4B, 0x62, 0x20, 0xEB, 0xB0, 0x2E, 0x79, 0x9E, 0x4E, 0x1F, 0x46, 0xEC, 0x6E, 0xC0,
-    0x89, 0x07, 0x14, 0xCC, 0xE7, 0xDC, 0x33, 0x0B, 0xA0, 0x12, 0xE9, 0xEE, 0x93, 0xCC, 0xB3, 0xCF,
-    0xBB, 0x73, 0x67, 0x8C, 0x0A, 0x97, 0xE6, 0xED, 0xAF, 0x26, 0xDC, 0x8E, 0x4A, 0xF9, 0x8D, 0xC8,
-    0x67, 0x22, 0xDB, 0x78, 0x64, 0x29, 0x5E, 0x2A, 0x8D, 0x0B, 0xB5, 0xB7, 0x96, 0x05, 0x09, 0x96,
-    0x7C, 0x81, 0x25, 0xDD, 0xDF, 0x82, 0xCA, 0xCE, 0xF2, 0x8D, 0x38, 0x26, 0x60, 0x82, 0x1A, 0xD7,
-    0xA9, 0x87, 0x4C, 0xD2, 0xA8, 0x7D, 0x93, 0x88, 0xDC, 0xDF, 0xB2, 0xBF, 0xB2, 0xE7, 0x33, 0x3F,
-    0xC1, 0x25, 0x1D, 0xE5, 0x90, 0xCA, 0x8E, 0x6B, 0x80, 0x8E, 0x83, 0x40, 0xF9, 0xEC, 0xAA, 0x80,
-    0xF8, 0xE8, 0x44, 0x21, 0xC4, 0x43, 0xCB, 0x3F, 0x7A, 0x28, 0xDF, 0xB6, 0x85, 0xDC, 0x61, 0x01,
-    0x72, 0x2E, 0xEF, 0x20, 0x46, 0x0B, 0xC4, 0x59, 0xF6, 0xD2, 0x26, 0x92, 0xCB, 0xA7, 0xAE, 0x27,
-    0x28, 0x28, 0xBA, 0x1E, 0x74, 0xF0, 0x13, 0xF8, 0x81, 0xF8, 0xAE, 0xF2, 0xB3, 0x09, 0x01, 0xE0,
-    0x51, 0x85, 0x5B, 0x4B, 0x87, 0xED, 0xC4, 0xDD, 0xC9, 0x5C, 0x78, 0x9C, 0x51, 0x28, 0x74, 0x86,
-    0x51, 0x6B, 0x03, 0x71, 0x4B, 0x3A, 0x2C, 0x19, 0x71, 0x13, 0x2E, 0x97, 0x08, 0x7A, 0x48, 0x51,
-    0x33, 0xA0, 0x1F, 0x63, 0x1C, 0x18, 0x28, 0x0F, 0x0B, 0x40, 0x53, 0x28, 0xDF, 0xB1, 0x08, 0x78,
-    0x86, 0x03, 0x6E, 0x80, 0xFD, 0x50, 0x6A, 0xB5, 0x8A, 0xBB, 0x74, 0xF0, 0xE1, 0xE5, 0x60, 0x9B,
-    0xCC, 0x67, 0x20, 0x19, 0xB5, 0x6D, 0x4C, 0x9F, 0x81, 0x07, 0x2A, 0x7B, 0x55, 0xAA, 0x6C, 0xB2,
-    0x9D, 0xB2, 0xEF, 0x8D, 0x74, 0x06, 0x04, 0x41, 0x2C, 0x80, 0x9B, 0xDC, 0xC3, 0x8C, 0x1E, 0x5E,
-    0xC3, 0x36, 0xAE, 0xCD, 0x26, 0x1A, 0x4D, 0x53, 0x8C, 0x78, 0x07, 0x02, 0x24, 0x2C, 0x20, 0x9B,
-    0x27, 0x8C, 0xB5, 0x99, 0x12, 0x7C, 0x9F, 0x9F, 0xB0, 0x7C, 0x0B, 0x0A, 0xB9, 0x01, 0xA8, 0xE0,
-    0xA7, 0xB5, 0x64, 0x04, 0xDB, 0x60, 0x73, 0x89, 0x6C, 0xD1, 0x01, 0xC2, 0xAB, 0xD6, 0x30, 0x65,
-    0x4B, 0x55, 0xFA, 0xE0, 0x41, 0xF2, 0xB6, 0xB6, 0x46, 0x65, 0xEC, 0xE6, 0x0D, 0x50, 0x4D, 0xB1,
-    0xA7, 0x1A, 0x7D, 0xD3, 0x07, 0x10, 0xC5, 0x63, 0x5B, 0xA3, 0x24, 0x93, 0xD9, 0xFC, 0x08, 0x1E,
-    0x5D, 0xEC, 0xB9, 0xC1, 0x3C, 0xEB, 0x83, 0xFE, 0x62, 0xD2, 0x5B, 0x63, 0xF9, 0x5E, 0x67, 0x36,
-    0x3B, 0xEB, 0x2A, 0xB1, 0x35, 0x19, 0x70, 0x80, 0xC7, 0xC5, 0xE3, 0x0C, 0x31, 0x75, 0xB3, 0xC3,
-    0xFE, 0xF1, 0x98, 0x8C, 0xCB, 0x0E, 0x2A, 0x99, 0x10, 0xCF, 0x51, 0x0A, 0xBC, 0x49, 0xBC, 0xD5,
-    0xBC, 0xC1, 0x23, 0x5A, 0x0B, 0x52, 0x6A, 0x4F, 0x0D, 0xB8, 0x3D, 0x0F, 0xAE, 0x6D, 0xCF, 0x05,
-    0xDC, 0xCE, 0x0A, 0x6E, 0xB5, 0x5C, 0xC3, 0xCD, 0x6E, 0xE0, 0x66, 0xEE, 0xE0, 0x56, 0x7C, 0x85,
-    0x5B, 0x0E, 0x74, 0xD7, 0x29, 0x6F, 0x09, 0x6F, 0x2A, 0xDE, 0x2C, 0x6F, 0x66, 0xDA, 0xA5, 0x7E,
-    0xD1, 0xFF, 0x43, 0xD2, 0x34, 0x62, 0x18, 0xE3, 0x2D, 0x19, 0x61, 0xF5, 0x19, 0x68, 0x07, 0x7A,
-    0x76, 0x70, 0x04, 0x7A, 0x32, 0x0C, 0x34, 0xF4, 0x0D, 0x16, 0x39, 0x8B, 0x2A, 0xEE, 0x46, 0x62,
-    0x0F, 0x7F, 0xB1, 0x90, 0x53, 0x7C, 0xB8, 0x11, 0x18, 0xC0, 0x63, 0x4F, 0x80, 0x3C, 0x0B, 0x71,
-    0x38, 0x3C, 0xE7, 0x69, 0x90, 0x47, 0xCE, 0x49, 0x9C, 0xD7, 0x70, 0x1C, 0x01, 0xCE, 0x1F, 0x9E,
-    0x03, 0x6A, 0xFD, 0x04, 0xD1, 0xD7, 0xE3, 0x7D, 0xA1, 0xA4, 0xCF, 0x6A, 0xCA, 0x1D, 0x89, 0xFE,
-    0xC1, 0xDD, 0xEE, 0xE9, 0xD2, 0xF4, 0x0E, 0x12, 0x08, 0xE8, 0x81, 0x49, 0x51, 0x0F, 0x6F, 0x96,
-    0xC8, 0xB2, 0xCA, 0x57, 0x04, 0xC7, 0x35, 0xD1, 0xE2, 0xF6, 0x55, 0xD5, 0xFF, 0x7D, 0x1F, 0x04,
-    0xF2, 0xC2, 0x0E, 0x6A, 0x76, 0x8F, 0x18, 0x88, 0x85, 0xE0, 0xAD, 0x5C, 0x85, 0xEB, 0xAD, 0xBC,
-    0x39, 0x2F, 0x83, 0xC6, 0x9D, 0xC3, 0xB1, 0x55, 0xAE, 0x29, 0x26, 0xAC, 0xD7, 0x35, 0x74, 0xE6,
-    0xAB, 0x82, 0x1E, 0x73, 0x7F, 0x32, 0x3A, 0x80, 0x96, 0x24, 0x44, 0xD1, 0x67, 0xE7, 0x13, 0x96,
-    0x36, 0xF7, 0x82, 0x0F, 0x86, 0x54, 0x86, 0x9C, 0x00, 0xA7, 0x7B, 0x47, 0xC1, 0xF4, 0xAE, 0x89,
-    0x6E, 0x99, 0xAF, 0x22, 0xF3, 0xF8, 0x08, 0x22, 0x34, 0x3B, 0xEE, 0x1D, 0xAF, 0x0E, 0x02, 0xF5,
-    0x8C, 0x68, 0xF0, 0x42, 0x64, 0xDF, 0xC8, 0xA3, 0x00, 0x54, 0x12, 0xFA, 0x9A, 0xD4, 0x41, 0xB9,
-    0x2E, 0x8A, 0xAC, 0xD8, 0xC1, 0x8F, 0x7B, 0x9D, 0x82, 0x65, 0x98, 0x48, 0xE8, 0xC7, 0x0F, 0x46,
-    0x47, 0x2B, 0xCC, 0x80, 0xAF, 0xE3, 0xBA, 0x1B, 0xB3, 0x5D, 0x72, 0xB2, 0x39, 0x08, 0xD4, 0xAB,
-    0x30, 0xF1, 0xFD, 0x1E, 0x00, 0x64, 0xE5, 0x8D, 0x7D, 0x4E, 0xFF, 0x3B, 0x16, 0xB0, 0x29, 0xF3,
-    0x19, 0x38, 0x90, 0xC7, 0xB6, 0xE4, 0x2A, 0x7C, 0xE6, 0xA8, 0x57, 0xD1, 0xB4, 0xC1, 0xA2, 0x11,
-    0xAC, 0xD6, 0x14, 0x33, 0x98, 0x7C, 0x87, 0x11, 0xF8, 0x26, 0x99, 0x07, 0x5E, 0x8A, 0xE4, 0xB2,
-    0x9F, 0xE3, 0x31, 0x92, 0xCA, 0x2A, 0x86, 0x63, 0x12, 0x3B, 0xD4, 0xF4, 0x40, 0x2F, 0xD1, 0x81,
-    0xA5, 0x98, 0x06, 0x23, 0xE4, 0x39, 0x78, 0xF8, 0x50, 0x92, 0xB3, 0xA0, 0xA6, 0xB7, 0x26, 0x26,
-    0xA8, 0xAD, 0x8A, 0xA9, 0xAE, 0x22, 0x1F, 0x88, 0xD9, 0x6E, 0xE4, 0x30, 0xCC, 0xA2, 0x14, 0x92,
-    0x21, 0x45, 0xD7, 0x44, 0xDF, 0xC5, 0x79, 0x30, 0x21, 0xE7, 0xC4, 0xE4, 0xB4, 0xCA, 0x7C, 0x04,
-    0x4F, 0x5B, 0x30, 0xED, 0x75, 0x0E, 0xA4, 0xC7, 0x34, 0xE6, 0x52, 0x63, 0x5A, 0x3D, 0xE8, 0xEB,
-    0x03, 0x32, 0xD1, 0x90, 0x0D, 0x21, 0xA3, 0x7F, 0x9B, 0xCC, 0xD5, 0x00, 0xD2, 0x23, 0x39, 0x92,
-    0x26, 0xB0, 0xCD, 0x57, 0xC8, 0x23, 0xDC, 0xA9, 0xD6, 0xBC, 0x0A, 0xC2, 0xF4, 0x79, 0x0F, 0x5F,
-    0xC0, 0xB4, 0x21, 0x81, 0x73, 0x51, 0xC2, 0xAC, 0x37, 0x32, 0x75, 0x8D, 0xED, 0x66, 0xD2, 0xC4,
-    0xB4, 0x8A, 0x40, 0x01, 0xEC, 0xCC, 0x40, 0x7E, 0x45, 0x39, 0x17, 0xE0, 0xC1, 0x50, 0x3B, 0x9D,
-    0x67, 0x8B, 0x40, 0x2E, 0xF0, 0xDC, 0x54, 0xB5, 0x9C, 0x23, 0xC7, 0xD8, 0x8C, 0x6C, 0x6A, 0x50,
-    0x11, 0x10, 0x9C, 0x83, 0xFB, 0x21, 0xF1, 0x9B, 0xB3, 0xF1, 0x6E, 0xD5, 0xCA, 0x30, 0xBC, 0x90,
-    0x67, 0xE1, 0x6B, 0xB0, 0xFE, 0x2A, 0x42, 0x0E, 0x8E, 0xD6, 0x74, 0x10, 0x3B, 0x49, 0x36, 0x8C,
-    0x01, 0x2A, 0x29, 0xBF, 0xC0, 0x48, 0x66, 0xEA, 0xC0, 0x26, 0xF2, 0xBF, 0x36, 0x4A, 0x16, 0xFB,
-    0x63, 0x4C, 0xA3, 0xC6, 0x36, 0x88, 0xB3, 0xDB, 0xCC, 0xC9, 0x84, 0xA2, 0x1B, 0x57, 0x1C, 0x2A,
-    0x23, 0x26, 0xC8, 0x32, 0x22, 0xB9, 0x27, 0xB3, 0x9F, 0xC3, 0xE4, 0xB7, 0x1F, 0x31, 0x1E, 0x52,
-    0xBF, 0xD7, 0x64, 0x3E, 0x40, 0x61, 0xEA, 0x30, 0xCD, 0x76, 0x4E, 0x60, 0x51, 0x11, 0x49, 0x9C,
-    0xBA, 0x9A, 0x41, 0x46, 0xC3, 0x27, 0x63, 0x21, 0xD8, 0x18, 0x7D, 0x69, 0xD5, 0x3A, 0xE6, 0x60,
-    0xCB, 0xE5, 0x79, 0x89, 0x71, 0x3D, 0x06, 0x76, 0x89, 0x07, 0x09, 0x3C, 0x5F, 0x48, 0x27, 0xDD,
-    0x9B, 0x87, 0xFF, 0xDC, 0x45, 0xE7, 0xB0, 0xFC, 0x2D, 0xB4, 0x4D, 0xE7, 0x88, 0x1D, 0xB7, 0xA4,
-    0xA7, 0xF8, 0x82, 0xEE, 0x03, 0x40, 0xC8, 0xA1, 0x91, 0x49, 0xAB, 0x19, 0x0F, 0xE6, 0x11, 0x3D,
-    0x94, 0x09, 0x16, 0x7F, 0x28, 0x3E, 0xC6, 0xDF, 0x53, 0xB1, 0xEF, 0x91, 0xB7, 0x54, 0x46, 0xE5,
-    0x8C, 0x2A, 0xBE, 0x00, 0x4E, 0x04, 0xB3, 0x40, 0x26, 0xE5, 0x6F, 0xE0, 0x8A, 0xAE, 0x81, 0x55,
-    0x76, 0x56, 0xA5, 0xBD, 0x6E, 0x17, 0x13, 0x0F, 0x66, 0x94, 0xA9, 0xAC, 0xCA, 0x7A, 0xAC, 0xC1,
-    0x1F, 0xA8, 0xD5, 0xA1, 0xFA, 0xA9, 0x13, 0x27, 0x9E, 0xC5, 0x5E, 0x8F, 0x2C, 0x97, 0xF5, 0x89,
-    0x0A, 0x9A, 0x43, 0x32, 0xC4, 0xE3, 0x8D, 0x39, 0x35, 0xCD, 0x21, 0x48, 0x34, 0x32, 0x85, 0x4C,
-    0x2F, 0x7E, 0x9D, 0x20, 0x1E, 0x16, 0xAF, 0x99, 0xC6, 0x06, 0x77, 0x03, 0xA8, 0x41, 0x48, 0xF1,
-    0x82, 0x78, 0x01, 0x6E, 0x40, 0x2F, 0x80, 0xA8, 0x0F, 0xDF, 0x7C, 0x6E, 0x58, 0xAC, 0x32, 0x95,
-    0xC8, 0x18, 0x1F, 0x74, 0x5D, 0x08, 0x4A, 0x1C, 0x24, 0x4B, 0x8D, 0xDD, 0xB5, 0x83, 0x34, 0x64,
-    0xB4, 0xF9, 0x84, 0xBC, 0x0A, 0x57, 0xB6, 0xBA, 0x50, 0xE6, 0x33, 0xB6, 0xB1, 0x0F, 0xFB, 0x5A,
-    0x69, 0x02, 0x73, 0xE5, 0x55, 0x3A, 0x96, 0xC9, 0x90, 0x52, 0x41, 0x32, 0x96, 0xFE, 0x24, 0x15,
-    0x0D, 0xBD, 0xDE, 0x1F, 0x9A, 0xB3, 0x19, 0xED, 0xA9, 0x7C, 0xF8, 0x0F, 0x1D, 0x73, 0xE2, 0x29,
-    0xF2, 0xF2, 0x83, 0x2B, 0xD7, 0x4F, 0xFC, 0x7C, 0xFB, 0x5A, 0xC8, 0x06, 0xB6, 0xB1, 0xE5, 0x0B,
-    0xFA, 0xC9, 0xED, 0xD3, 0xDE, 0x74, 0x39, 0x38, 0x60, 0xBA, 0x8F, 0x5A, 0xCF, 0x17, 0x9F, 0x99,
-    0x2E, 0x8B, 0x7D, 0x8A, 0x18, 0x96, 0xBE, 0x42, 0xDA, 0xF8, 0xBE, 0x57, 0x4F, 0xAC, 0xA6, 0x77,
-    0xF1, 0xDC, 0xAE, 0xE1, 0xC9, 0x5E, 0x39, 0x14, 0x30, 0x79, 0x90, 0x94, 0x26, 0x9D, 0x56, 0x74,
-    0x7B, 0xBE, 0x9A, 0x99, 0x2B, 0x12, 0x8D, 0xE5, 0xA8, 0xFE, 0xCA, 0xBE, 0x3C, 0x10, 0x81, 0x5F,
-    0x6F, 0xE7, 0x6D, 0x1E, 0xE7, 0xE9, 0x9D, 0x46, 0x44, 0x20, 0x11, 0x5A, 0x23, 0xEC, 0xA1, 0x89,
-    0x52, 0x10, 0x2E, 0x98, 0x9D, 0x2E, 0xEC, 0xA7, 0xD4, 0x1A, 0x17, 0x3E, 0xB7, 0x3C, 0xBC, 0x12,
-    0x89, 0x3D, 0x96, 0x97, 0xCB, 0xCE, 0xE3, 0x6F, 0x6D, 0x2C, 0x56, 0x5B, 0xBB, 0x87, 0xAD, 0xC1,
-    0x56, 0x9F, 0xE0, 0x7C, 0xD9, 0xF4, 0x24, 0x23, 0xDD, 0xEF, 0xDD, 0xC8, 0x38, 0xCB, 0x53, 0x82,
-    0x75, 0x32, 0xEF, 0xD9, 0xE0, 0x68, 0x4B, 0xDC, 0x0D, 0x14, 0xBD, 0x57, 0xFD, 0x40, 0x5A, 0xE8,
-    0xEE, 0x66, 0xCC, 0x30, 0xDF, 0x10, 0x17, 0xB5, 0xC6, 0xF4, 0xB7, 0x8C, 0xD1, 0xAE, 0x9B, 0x33,
-    0xEA, 0x07, 0x57, 0x11, 0xB5, 0xBD, 0xB9, 0x19, 0x0A, 0xC2, 0x3C, 0xA0, 0xF0, 0x80, 0x2F, 0x13,
-    0xB3, 0xB2, 0xD5, 0x23, 0x5E, 0x67, 0x77, 0xD5, 0x2A, 0xB5, 0xE9, 0xE2, 0x93, 0x47, 0x17, 0xFE,
-    0xE9, 0xBE, 0x82, 0x0E, 0xC8, 0x0F, 0x77, 0x8F, 0x63, 0xBE, 0x79, 0x94, 0xB2, 0xFB, 0x00, 0x1E,
-    0xAD, 0x2E, 0x87, 0xB2, 0x2B, 0x86, 0x7C, 0x2C, 0xE0, 0x6A, 0x31, 0xC4, 0xBD, 0x3A, 0xAA, 0xF2,
-    0xF6, 0xC4, 0xA0, 0xCD, 0x43, 0x01, 0xC6, 0x62, 0x8F, 0x7E, 0xD8, 0xDA, 0xA8, 0xD1, 0x03, 0x1E,
-    0x07, 0x43, 0x7A, 0x30, 0x33, 0xE1, 0x09, 0x0E, 0x42, 0xEB, 0xED, 0x7B, 0x41, 0xDC, 0x03, 0x6F,
-    0xE3, 0xEA, 0x80, 0xF0, 0x2C, 0xE8, 0x23, 0x18, 0x1F, 0x72, 0x0E, 0x32, 0x6E, 0x7A, 0x22, 0x60,
-    0x5F, 0x5E, 0x10, 0x33, 0x80, 0x4F, 0xD0, 0x2F, 0x03, 0x4D, 0x3C, 0x59, 0xE9, 0x68, 0x77, 0xD0,
-    0xAE, 0xD8, 0x8E, 0x5E, 0x75, 0x33, 0x1A, 0x2F, 0x1B, 0xDA, 0xFF, 0xDA, 0x40, 0xDB, 0x4C, 0x61,
-    0x30, 0xFA, 0xCE, 0x7C, 0xE2, 0x22, 0xDB, 0xE0, 0xC8, 0x95, 0x89, 0x49, 0x1A, 0x4F, 0xCD, 0xEA,
-    0x0C, 0xA2, 0x2F, 0x78, 0x78, 0xF0, 0xE0, 0xEA, 0xCC, 0xFE, 0x1C, 0xBD, 0x7E, 0x3C, 0x66, 0xED,
-    0xCB, 0xB1, 0x98, 0x88, 0x15, 0x60, 0x26, 0xB8, 0x78, 0x25, 0xBB, 0x19, 0x66, 0xE0, 0x33, 0xB6,
-    0xB1, 0x0F, 0xFD, 0x06, 0xC7, 0x44, 0x0B, 0x5C, 0xB9, 0x08, 0xC9, 0xA1, 0x06, 0xF3, 0x3D, 0x3C,
-    0x01, 0xBD, 0xC7, 0x31, 0xAA, 0xF0, 0xF8, 0x43, 0xBD, 0xCC, 0xFF, 0x86, 0xF7, 0xAD, 0x7D, 0x78,
-    0x7F, 0xE8, 0x35, 0x96, 0xB7, 0xBF, 0x84, 0xF6, 0xBC, 0x90, 0xE9, 0x23, 0xEA, 0x00, 0x8A, 0xE0,
-    0xDB, 0x81, 0xA0, 0xFF, 0x66, 0x71, 0x95, 0x56, 0x3F, 0x13, 0x03, 0xCC, 0xE8, 0xEA, 0x1F, 0x02,
-    0x5B, 0x39, 0xCF, 0x2B, 0x78, 0x44, 0x03, 0xB7, 0xCB, 0x23, 0xB1, 0x3E, 0xE6, 0xD4, 0xF2, 0x4B,
-    0x65, 0x6F, 0xC4, 0xE3, 0xBD, 0x01, 0x32, 0x67, 0x82, 0x47, 0x7F, 0x35, 0xF1, 0x6C, 0x3D, 0x21,
-    0xD8, 0xA0, 0x35, 0x64, 0x71, 0xE1, 0xB0, 0xFF, 0xD9, 0x03, 0x8F, 0x3F, 0x53, 0xA6, 0xCD, 0x3F,
-    0x4D, 0x05, 0xF8, 0x0B, 0x3C, 0xA2, 0x59, 0x54, 0x88, 0xCD, 0x3C, 0xD3, 0x8A, 0x6F, 0x69, 0xC9,
-    0xDE, 0x72, 0x79, 0x40, 0x95, 0xEE, 0xBE, 0xCF, 0xC4, 0x7D, 0xEA, 0xFC, 0x7C, 0xB8, 0x88, 0xAC,
-    0xAA, 0x77, 0xEA, 0xC9, 0x28, 0x4C, 0x39, 0x85, 0xEC, 0xEC, 0x1A, 0xBA, 0x75, 0x0E, 0x20, 0x2A,
-    0x90, 0x76, 0xA5, 0x1E, 0x46, 0xE1, 0x6A, 0xC4, 0xF2, 0x9E, 0xC2, 0x43, 0x48, 0xB3, 0x20, 0x23,
-    0x64, 0x22, 0x91, 0x86, 0x90, 0x83, 0xE8, 0x78, 0x36, 0xD4, 0xC4, 0x30, 0x8B, 0x61, 0x00, 0xD8,
-    0x29, 0xF8, 0xB6, 0xCA, 0x6C, 0x4C, 0xCC, 0x5F, 0x7A, 0x0C, 0x9E, 0xB2, 0xB1, 0xE8, 0x8D, 0x4D,
-    0x7D, 0x3A, 0x15, 0xEF, 0x81, 0x5C, 0xC9, 0xF3, 0x37, 0x91, 0x8D, 0x95, 0x37, 0x87, 0xCB, 0x65,
-    0x97, 0x4D, 0x78, 0x06, 0xBC, 0x9A, 0xF4, 0x0E, 0x04, 0xBB, 0xD9, 0xF8, 0xA0, 0xB2, 0x7B, 0x5D,
-    0x49, 0x52, 0x35, 0x90, 0x92, 0x20, 0x0D, 0x81, 0xC0, 0x40, 0x9E, 0x0D, 0x8F, 0x84, 0x80, 0x11,
-    0x98, 0x18, 0x52, 0x64, 0x26, 0x86, 0xFC, 0x9F, 0x40, 0x31, 0x10, 0x83, 0xB4, 0x3A, 0x8A, 0x55,
-    0xFA, 0xF9, 0x84, 0xCA, 0x90, 0xA8, 0xC7, 0xA4, 0x0C, 0x6C, 0x35, 0x22, 0xAB, 0x18, 0x52, 0xA4,
-    0x09, 0x08, 0x1E, 0xE6, 0x63, 0x48, 0xC2, 0xEF, 0xDF, 0x2B, 0xF8, 0x09, 0x88, 0xCA, 0xEE, 0x5E,
-    0x6D, 0x33, 0xEF, 0x35, 0xE1, 0x5E, 0xCD, 0x6A, 0xAF, 0x8B, 0xE0, 0x67, 0xE6, 0x97, 0xEF, 0x9D,
-    0x8E, 0xF4, 0xAB, 0xD3, 0x91, 0x15, 0xFF, 0xF8, 0x33, 0x49, 0x26, 0x1A, 0x75, 0xF4, 0x87, 0xF1,
-    0xFF, 0x1E, 0xE0, 0xA4, 0xF1, 0x6C, 0xF5, 0xCA, 0x89, 0x53, 0x53, 0xE4, 0x26, 0x08, 0x5B, 0x7A,
-    0x9C, 0x29, 0x63, 0x43, 0x3E, 0xC2, 0x71, 0x2C, 0x6D, 0x33, 0x3E, 0xF3, 0x40, 0x75, 0x83, 0xA7,
-    0x1B, 0xEB, 0x10, 0x06, 0x38, 0x7F, 0x05, 0x12, 0xC7, 0xCC, 0x8E, 0xFC, 0x21, 0xB2, 0xD5, 0x94,
-    0xAC, 0xB2, 0x00, 0x81, 0xC4, 0xF6, 0xDB, 0x75, 0xDA, 0x57, 0xF3, 0xAD, 0x0E, 0x08, 0x9A, 0xA5,
-    0x27, 0xFD, 0x5B, 0xAF, 0xD5, 0xE5, 0x47, 0x7C, 0x5E, 0xFC, 0x3B, 0x99, 0x1E, 0x08, 0xEA, 0x61,
-    0xCF, 0x33, 0xFF, 0x02, 0x5A, 0xAD, 0x16, 0xA0, 0xD2, 0x43, 0x3C, 0xFB, 0xC7, 0xD4, 0x93, 0x3A,
-    0x8D, 0x4C, 0xAB, 0xE1, 0x3F, 0x86, 0xE2, 0xD3, 0xAF, 0x3B, 0x94, 0x71, 0x6D, 0x50, 0x4A, 0x9B,
-    0xBC, 0xA6, 0xD4, 0xFA, 0x9B, 0x50, 0x4A, 0x58, 0xF0, 0x40, 0xF1, 0xCC, 0x2F, 0xC4, 0xD7, 0xAB,
-    0x7F, 0x01, 0xFD, 0x07, 0xC5, 0x5A, 0xBF, 0x93, 0xDF, 0x46, 0x15, 0x7F, 0x92, 0x7C, 0x16, 0x63,
-    0xCD, 0xA0, 0x14, 0x39, 0x66, 0x20, 0x33, 0x51, 0xCD, 0xAF, 0xA8, 0xA1, 0x61, 0xC6, 0xE7, 0x95,
-    0xC9, 0x64, 0x52, 0xA4, 0xF0, 0x15, 0x3E, 0x28, 0x52, 0x84, 0x82, 0x02, 0xAA, 0xFB, 0x07, 0x88,
-    0x25, 0xFB, 0x0A, 0x0A, 0x0A, 0xBB, 0x63, 0x06, 0x0A, 0x60, 0x86, 0x22, 0xD8, 0x85, 0x29, 0x52,
-    0xB8, 0xB0, 0x4F, 0x72, 0xAE, 0x48, 0x91, 0xC2, 0x22, 0x37, 0x8C, 0x8B, 0x14, 0x27, 0x48, 0x88,
-    0x67, 0xEC, 0xC2, 0x0A, 0xD6, 0xF9, 0xE4, 0xB3, 0xB4, 0x8F, 0xCF, 0x67, 0xA5, 0xEF, 0xD9, 0x06,
-    0x63, 0x02, 0xB9, 0x89, 0x35, 0xD6, 0xFA, 0x2B, 0xED, 0xEE, 0xDB, 0xF7, 0xDE, 0xBE, 0x1F, 0x9F,
-    0xB7, 0xBA, 0x64, 0x63, 0xCC, 0x3F, 0x1E, 0x93, 0x42, 0xC4, 0x7B, 0x27, 0x7D, 0x6F, 0x30, 0x5B,
-    0xD3, 0xBF, 0xD1, 0x6C, 0x8F, 0xE6, 0xA6, 0xCD, 0xFF, 0x7A, 0x5A, 0x70, 0x05, 0x8D, 0x48, 0x2F,
-    0x5E, 0xF9, 0x49, 0xA8, 0xFA, 0x0B, 0xD5, 0x6D, 0xBD, 0xF3, 0x99, 0x16, 0x47, 0xCA, 0x4A, 0x4C,
-    0x23, 0x71, 0x2F, 0xC1, 0x28, 0xA2, 0x05, 0x1F, 0xA2, 0x41, 0x3C, 0xAD, 0xBE, 0x6E, 0x54, 0x5F,
-    0x55, 0xAD, 0x53, 0x6D, 0x25, 0x5F, 0x95, 0xB8, 0x70, 0x04, 0x56, 0xC5, 0x5D, 0x89, 0x5E, 0x90,
-    0x52, 0x3B, 0x4F, 0xB5, 0x0D, 0xF4, 0xD7, 0x0D, 0xE7, 0x86, 0xC3, 0xA3, 0xFB, 0xCD, 0x71, 0x4D,
-    0x54, 0x35, 0xE3, 0x7D, 0xD9, 0x5E, 0xCC, 0x1E, 0xEF, 0x8B, 0x7A, 0x4C, 0x6F, 0x45, 0xCA, 0xDB,
-    0x17, 0xDF, 0x41, 0xFF, 0xB0, 0xB8, 0xBF, 0x22, 0xFE, 0xAB, 0xF7, 0xC7, 0x6B, 0x58, 0xB5, 0x51,
-    0xED, 0xE3, 0x26, 0x3F, 0x39, 0x78, 0x7D, 0x52, 0xC4, 0xD7, 0x7B, 0x19, 0xE2, 0xDA, 0x14, 0x7A,
-    0xB7, 0x4B, 0x55, 0xB7, 0x54, 0xED, 0xCB, 0x4B, 0x01, 0x24, 0x95, 0xB2, 0x10, 0x3D, 0xD5, 0x4A,
-    0xF9, 0x9E, 0x15, 0x53, 0x9B, 0x2A, 0x69, 0xA3, 0x2E, 0xEE, 0x44, 0xB1, 0x46, 0xFA, 0xE1, 0x28,
-    0xC1, 0xA0, 0x18, 0xA2, 0x99, 0xC4, 0x5A, 0x49, 0xA0, 0x35, 0x58, 0xD6, 0x0A, 0x92, 0xB7, 0xF2,
-    0x23, 0x0B, 0x75, 0x94, 0x99, 0x1C, 0x2B, 0xF7, 0x0B, 0xF7, 0x02, 0xCB, 0xB9, 0x17, 0x92, 0xD6,
-    0x60, 0xAF, 0x03, 0xE9, 0xCD, 0x47, 0xD7, 0xCF, 0x9C, 0xBC, 0x4F, 0xBC, 0x58, 0x96, 0x50, 0xFB,
-    0x44, 0x47, 0xF3, 0x97, 0x21, 0x97, 0x23, 0xC6, 0xE9, 0x2C, 0xD6, 0x2C, 0xD6, 0x36, 0xDD, 0x19,
-    0x8C, 0x37, 0xE6, 0xB2, 0x69, 0xB2, 0x4D, 0xD3, 0xD8, 0x58, 0x07, 0x5F, 0x3B, 0x49, 0x07, 0xF1,
-    0xAD, 0x88, 0x5D, 0x15, 0x7B, 0xE6, 0x47, 0x63, 0xAE, 0x7D, 0x0A, 0x76, 0x4E, 0x4B, 0xEA, 0xED,
-    0xDA, 0x78, 0xAF, 0x37, 0x1F, 0x14, 0x6F, 0x4F, 0x4A, 0x95, 0x14, 0xFA, 0x97, 0xD4, 0xA2, 0x8D,
-    0x6B, 0xC9, 0x33, 0xEA, 0xFB, 0x9A, 0x5C, 0x39, 0xAA, 0xE7, 0xDA, 0xC4, 0xD3, 0x21, 0xDA, 0xA8,
-    0xCF, 0x78, 0xD9, 0xF1, 0xE3, 0x71, 0x25, 0xFE, 0xCD, 0x02, 0x6C, 0xBE, 0xFC, 0x6E, 0x82, 0x0D,
-    0x7F, 0x78, 0x12, 0xCA, 0x8C, 0xDD, 0xCF, 0x3D, 0xF7, 0xF6, 0x38, 0xB6, 0xCA, 0xDF, 0xAE, 0x40,
-    0xF4, 0x78, 0x1A, 0x60, 0x5A, 0xD5, 0x45, 0x7A, 0xB6, 0x0D, 0x1B, 0x4F, 0xDE, 0x96, 0xA4, 0x96,
-    0x14, 0xFC, 0xDE, 0x2E, 0x21, 0xE9, 0x3A, 0xB8, 0x10, 0x59, 0x9A, 0x96, 0x2E, 0xBB, 0x44, 0xEB,
-    0x4F, 0x36, 0x25, 0x68, 0x4B, 0x35, 0x77, 0xEE, 0xB5, 0xC6, 0x44, 0xF7, 0x54, 0x93, 0xDD, 0xF6,
-    0x45, 0x91, 0x17, 0x24, 0x93, 0x4D, 0xAF, 0xF7, 0x34, 0x18, 0x83, 0x31, 0xEE, 0xE3, 0x3E, 0x6D,
-    0x4D, 0x5B, 0x56, 0xE5, 0x75, 0x15, 0xDE, 0xFC, 0x1D, 0xF7, 0xA6, 0x65, 0x1F, 0xC7, 0x70, 0x2C,
-    0xE7, 0x94, 0xAA, 0x7B, 0xD8, 0xD8, 0x1D, 0xDC, 0xAF, 0xAD, 0xAD, 0xC1, 0x42, 0x7C, 0x70, 0x17,
-    0x61, 0xCD, 0x34, 0xA3, 0x5C, 0xE2, 0xAD, 0x7E, 0xEB, 0xE2, 0x29, 0x98, 0x61, 0xA7, 0xE3, 0x33,
-    0xE5, 0x37, 0xA3, 0xDF, 0x26, 0x81, 0xF6, 0x90, 0x7F, 0x25, 0xAA, 0x8F, 0x1F, 0x0F, 0xEA, 0x15,
-    0xC8, 0xBF, 0x12, 0xD4, 0x2F, 0xBF, 0x1B, 0xD4, 0x57, 0xBD, 0x87, 0x99, 0x81, 0xEE, 0xDF, 0xC5,
-    0x16, 0x43, 0xFE, 0x95, 0x14, 0xF2, 0x07, 0x75, 0x0F, 0xF9, 0x57, 0xC2, 0x0A, 0xF2, 0xD7, 0x27,
-    0x20, 0xFF, 0x8A, 0xB7, 0x0B, 0xF9, 0xE5, 0x59, 0xF2, 0x0B, 0xEC, 0xCE, 0x2E, 0x6E, 0x1A, 0x78,
-    0xEF, 0xEB, 0x90, 0xDC, 0xE9, 0xAF, 0x05, 0xF7, 0xDA, 0xE8, 0x46, 0x95, 0xA6, 0x67, 0x07, 0xA3,
-    0x75, 0x6E, 0xE5, 0x1B, 0xC5, 0x34, 0xC7, 0xE0, 0x86, 0x35, 0x07, 0x54, 0x7E, 0xC5, 0xC7, 0x63,
-    0x97, 0xEC, 0xC5, 0x5C, 0x75, 0x84, 0xB8, 0xBB, 0x6B, 0xE5, 0x5A, 0xF6, 0x64, 0xAF, 0x1B, 0x8C,
-    0x4B, 0x1F, 0x29, 0x25, 0x3B, 0x6A, 0xB1, 0x06, 0xA8, 0xD6, 0x56, 0xE2, 0xC6, 0x1B, 0xC4, 0x14,
-    0x71, 0x13, 0xF6, 0x1E, 0xCC, 0x59, 0xA1, 0x7B, 0xA3, 0xED, 0x51, 0x8B, 0xF1, 0xFE, 0xBE, 0xF5,
-    0xD0, 0x19, 0x36, 0xC7, 0xA0, 0xEA, 0x4E, 0x2E, 0xF5, 0xA4, 0x1A, 0x6F, 0x7D, 0xAA, 0xB1, 0xC2,
-    0x21, 0x32, 0x12, 0x85, 0xB3, 0x55, 0x5A, 0x94, 0x45, 0x9E, 0x2D, 0x63, 0x85, 0x2C, 0x84, 0x04,
-    0x29, 0x6C, 0xBA, 0xD4, 0xC6, 0x57, 0x2D, 0xA2, 0xA7, 0x3F, 0xC2, 0xF2, 0x61, 0xFD, 0xBB, 0x60,
-    0xD9, 0x5D, 0x39, 0xFC, 0xAB, 0xD4, 0xD7, 0x24, 0x80, 0xF4, 0x88, 0x06, 0xB4, 0x69, 0x86, 0x83,
-    0xC5, 0xA3, 0xBB, 0xE0, 0xEE, 0x36, 0xC2, 0x9D, 0xEA, 0x78, 0xC6, 0x68, 0x7F, 0x82, 0x77, 0xFE,
-    0x94, 0x9B, 0xEF, 0xB1, 0xC4, 0x89, 0x18, 0xB7, 0x8F, 0x5B, 0x8E, 0x5C, 0x39, 0x21, 0xF2, 0x79,
-    0xEF, 0x9F, 0x7C, 0x73, 0x29, 0x18, 0xF3, 0x5B, 0xD6, 0x54, 0xAB, 0x51, 0x05, 0x8D, 0x0C, 0x32,
-    0xFC, 0x70, 0xC8, 0xFB, 0xBC, 0x96, 0x6F, 0x89, 0xA9, 0xF2, 0xB6, 0x1C, 0xD2, 0xDC, 0x8F, 0x2B,
-    0x68, 0x01, 0x2A, 0x93, 0x83, 0x1F, 0xE2, 0x42, 0x8B, 0x8E, 0xD1, 0xA7, 0x83, 0xF1, 0xBB, 0x3E,
-    0xDA, 0x6E, 0x92, 0x53, 0xD5, 0x35, 0xF3, 0x7A, 0x6B, 0xB4, 0xC8, 0x3B, 0x39, 0x82, 0x5D, 0x3B,
-    0x22, 0x29, 0x0C, 0x0A, 0x36, 0x9B, 0xA5, 0x6D, 0x5E, 0xD1, 0x8E, 0x27, 0x9B, 0x7D, 0xD5, 0xF2,
-    0x5E, 0xD8, 0x36, 0xFB, 0xDC, 0x18, 0x8C, 0xE5, 0x1C, 0x39, 0xC3, 0xCD, 0x83, 0x07, 0xFB, 0x83,
-    0xC4, 0x96, 0xDA, 0x37, 0x56, 0xA2, 0x46, 0xBE, 0xBB, 0x29, 0x09, 0xF6, 0x76, 0x13, 0xFB, 0xC6,
-    0x36, 0x67, 0x98, 0x10, 0x9A, 0xF2, 0xA6, 0x3F, 0xF8, 0xBF, 0x93, 0xCD, 0xA0, 0x8B, 0x5B, 0xD9,
-    0x8C, 0x40, 0x4F, 0x36, 0xE3, 0xCA, 0xB4, 0xF2, 0xB3, 0xB4, 0x78, 0x08, 0x83, 0xC8, 0xFD, 0x7B,
-    0x68, 0x6D, 0xB0, 0xDD, 0x8A, 0x37, 0xC4, 0x1B, 0xAD, 0x04, 0x5D, 0x7A, 0x69, 0x5F, 0x30, 0x50,
-    0x15, 0x86, 0xCF, 0x36, 0xAD, 0xDC, 0x32, 0xCE, 0x80, 0xDC, 0xEA, 0x0C, 0x76, 0x25, 0x36, 0xA4,
-    0xE1, 0x4B, 0x6C, 0x1E, 0x8C, 0x78, 0x5E, 0x3E, 0x85, 0xD1, 0x40, 0xF2, 0x26, 0x04, 0x4D, 0xBF,
-    0x0F, 0xBA, 0x69, 0xFD, 0x97, 0x7E, 0x87, 0x0E, 0x84, 0x9A, 0x2C, 0x6A, 0x4A, 0x04, 0x70, 0xBF,
-    0x37, 0xFE, 0xB9, 0x81, 0x0C, 0x90, 0x4D, 0x4C, 0x03, 0xCB, 0x98, 0x86, 0x65, 0x30, 0x0D, 0x51,
-    0x0F, 0xD3, 0xD0, 0x42, 0x3E, 0xBC, 0x81, 0x08, 0x29, 0x82, 0x56, 0x89, 0x90, 0x36, 0x62, 0xB5,
-    0x40, 0x27, 0x1B, 0x13, 0x79, 0x69, 0x64, 0x1F, 0x68, 0x62, 0xDC, 0x89, 0xF5, 0x6A, 0xB2, 0x6D,
-    0xE8, 0x41, 0x92, 0x02, 0x14, 0x23, 0xEB, 0x88, 0x8E, 0x5C, 0x60, 0x29, 0x2F, 0xA8, 0x87, 0xF8,
-    0xFA, 0x70, 0xEC, 0x42, 0x16, 0x6F, 0x77, 0x49, 0xB3, 0x59, 0x7E, 0xD0, 0x9A, 0xA6, 0xD4, 0x53,
-    0xB5, 0x36, 0x2F, 0xF5, 0xE9, 0xD9, 0x87, 0x98, 0x96, 0x07, 0x3B, 0x68, 0x6D, 0x7C, 0xBE, 0x81,
-    0x1E, 0x12, 0xB0, 0x13, 0x74, 0xE6, 0x72, 0x0F, 0x8E, 0x0C, 0x16, 0x46, 0xC4, 0x47, 0x0B, 0x76,
-    0xF0, 0xDE, 0x64, 0x6C, 0x79, 0xC1, 0x18, 0xD3, 0x4E, 0x7C, 0x70, 0xC4, 0x0C, 0xF2, 0x53, 0x59,
-    0x5C, 0x51, 0x3B, 0xF5, 0xB9, 0xDC, 0x15, 0xA0, 0x1B, 0xAE, 0x0D, 0x85, 0x07, 0x50, 0x5C, 0x5E,
-    0x31, 0xEB, 0xBC, 0x60, 0x76, 0xD7, 0x91, 0x3A, 0xC6, 0xD8, 0x25, 0xB4, 0xDA, 0x4D, 0x5A, 0x62,
-    0x2E, 0x0B, 0xD4, 0x05, 0x9E, 0x96, 0xD6, 0x4D, 0xBF, 0x9F, 0x57, 0x3A, 0xBD, 0xA0, 0x1C, 0xAB,
-    0x1B, 0x84, 0x19, 0x3E, 0xB3, 0x04, 0xBC, 0x86, 0xBE, 0x7F, 0x97, 0x51, 0xEC, 0x16, 0x9E, 0xE3,
-    0x4E, 0x99, 0xD5, 0x0C, 0x94, 0x67, 0x99, 0xDC, 0x90, 0xF2, 0xB8, 0x24, 0x9E, 0xD3, 0x36, 0xA2,
-    0xB9, 0x5C, 0x52, 0x24, 0x0B, 0x75, 0x9E, 0xA7, 0x03, 0xBD, 0x5F, 0x05, 0x86, 0x6C, 0x1A, 0x70,
-    0x17, 0x0F, 0x70, 0x2C, 0x4F, 0x5F, 0x87, 0xAA, 0xCC, 0xC7, 0x98, 0x16, 0x63, 0xBE, 0xB7, 0x26,
-    0xE2, 0xE4, 0x43, 0x07, 0xD5, 0xAE, 0xB3, 0xD4, 0x82, 0xA4, 0xF3, 0x9C, 0x58, 0x5A, 0x73, 0xE9,
-    0x81, 0x0A, 0x2A, 0xC9, 0x48, 0xFE, 0x16, 0xB7, 0xEE, 0xA4, 0x25, 0x47, 0x4B, 0xD9, 0xF3, 0x61,
-    0x89, 0x97, 0x3F, 0x06, 0xC8, 0x83, 0x0A, 0x87, 0x42, 0x54, 0x82, 0xD5, 0x5F, 0x4D, 0xB0, 0xD0,
-    0x11, 0xE4, 0x9D, 0xE7, 0xC2, 0x52, 0x92, 0x91, 0x66, 0x0B, 0x17, 0x0D, 0x06, 0xFA, 0xD0, 0xDB,
-    0x41, 0x2D, 0x8F, 0x5F, 0x66, 0x70, 0x2C, 0x41, 0x5F, 0x11, 0x7C, 0x18, 0x7C, 0xF1, 0x59, 0x89,
-    0x39, 0xCA, 0xDF, 0xE2, 0xD9, 0x6C, 0x0F, 0x04, 0x45, 0xE8, 0x8F, 0x7A, 0x58, 0x36, 0xF2, 0x2C,
-    0x21, 0x18, 0x98, 0x92, 0xB2, 0x82, 0x6D, 0x9A, 0xFD, 0xCB, 0x03, 0xF1, 0x0B, 0x83, 0xB7, 0x43,
-    0x5C, 0x60, 0x89, 0xF6, 0xA1, 0x05, 0xB0, 0x8D, 0x81, 0x63, 0x49, 0x38, 0x26, 0xD0, 0x81, 0x9E,
-    0x07, 0x19, 0x30, 0x28, 0x2F, 0xBA, 0x3D, 0xA3, 0x25, 0x9F, 0x40, 0xA2, 0x95, 0x97, 0x23, 0x44,
-    0xA8, 0x70, 0x8B, 0xCF, 0x54, 0x95, 0x98, 0x71, 0x91, 0x6C, 0x81, 0x59, 0xC0, 0x8D, 0x65, 0x72,
-    0xB6, 0x39, 0x9E, 0x09, 0xA8, 0x24, 0xDF, 0x1A, 0xE9, 0x4B, 0xF0, 0x9C, 0x98, 0x21, 0x2C, 0x1C,
-    0x90, 0xD3, 0x7D, 0xE4, 0xFA, 0x4A, 0xF4, 0x36, 0x0C, 0x21, 0x57, 0x97, 0x41, 0x00, 0xA7, 0x62,
-    0x72, 0x13, 0x02, 0x6B, 0x59, 0xBA, 0x11, 0x73, 0x90, 0x24, 0x1D, 0xB4, 0x14, 0x58, 0x32, 0xA1,
-    0x8C, 0x4E, 0x1C, 0xC1, 0x1D, 0xC2, 0x68, 0x89, 0x9C, 0x16, 0x99, 0x69, 0x95, 0xF1, 0x94, 0x2E,
-    0x0C, 0x9D, 0x61, 0x19, 0xF0, 0x7A, 0xD6, 0x6D, 0xD7, 0xC8, 0xAD, 0x80, 0x22, 0x92, 0xFD, 0x8B,
-    0x17, 0x20, 0x3D, 0x56, 0x2A, 0xC2, 0xC1, 0x73, 0xEB, 0x35, 0x21, 0x61, 0x9A, 0x63, 0xC0, 0x11,
-    0xAA, 0x26, 0x42, 0xDC, 0x5E, 0x92, 0x03, 0xAB, 0x2E, 0x26, 0x80, 0x5A, 0x7E, 0xFB, 0xE2, 0x86,
-    0x75, 0x6B, 0xE2, 0x45, 0x48, 0x74, 0x59, 0x50, 0x79, 0xED, 0x94, 0xC2, 0x4A, 0x9B, 0x91, 0x12,
-    0xEE, 0x31, 0xD4, 0xDB, 0x1A, 0x68, 0xE1, 0x9D, 0xA4, 0x26, 0x1C, 0xC1, 0xC6, 0xD1, 0x81, 0x36,
-    0xE9, 0x7F, 0x34, 0x76, 0xEC, 0x22, 0x15, 0xCB, 0x2C, 0x38, 0xC9, 0xC3, 0x07, 0x68, 0x3E, 0x2B,
-    0xED, 0x9B, 0x6D, 0xCC, 0x85, 0x81, 0x72, 0xE4, 0x28, 0x63, 0x24, 0x91, 0x4D, 0x40, 0x4B, 0xA3,
-    0x40, 0x0C, 0x8E, 0x5F, 0xE3, 0x9E, 0xDA, 0x89, 0x1A, 0x62, 0x0D, 0x55, 0x84, 0x05, 0x88, 0x04,
-    0x81, 0x42, 0x1C, 0x90, 0xA6, 0x64, 0x90, 0xF1, 0xB7, 0xAA, 0xB7, 0x90, 0x89, 0x9D, 0x01, 0x52,
-    0x88, 0x90, 0x9B, 0x7F, 0xF1, 0x1D, 0xF4, 0x80, 0xED, 0xF7, 0x55, 0x3F, 0x7B, 0xB2, 0x47, 0x28,
-    0xE1, 0x5B, 0x6E, 0xCE, 0x03, 0xAA, 0x06, 0x31, 0x03, 0x11, 0xC3, 0xD9, 0x83, 0x8B, 0x15, 0xCB,
-    0x72, 0x68, 0xA4, 0x97, 0x33, 0x42, 0x0E, 0xE0, 0x2B, 0xF3, 0x41, 0x9B, 0x56, 0xE5, 0x52, 0xE6,
-    0x65, 0x87, 0x44, 0x3A, 0xAA, 0xAE, 0x85, 0xBD, 0xB9, 0x3E, 0xC6, 0xED, 0x2B, 0xDE, 0xB4, 0x33,
-    0xDC, 0xAA, 0x07, 0x07, 0xA4, 0x6F, 0xCE, 0x73, 0x26, 0x02, 0xF6, 0xE2, 0xEF, 0xA1, 0xEB, 0x99,
-    0xF4, 0x13, 0x3D, 0x6E, 0xD1, 0x3F, 0x1E, 0xB0, 0xD3, 0x83, 0x63, 0xEC, 0x13, 0x36, 0x14, 0xBE,
-    0x95, 0x67, 0xCE, 0x11, 0x90, 0xC7, 0x0C, 0x40, 0x26, 0xD0, 0x1B, 0x30, 0x50, 0x05, 0x43, 0x86,
-    0x7F, 0xC3, 0xA9, 0xFE, 0xD3, 0xCF, 0x80, 0x65, 0xCB, 0xB6, 0xEA, 0x29, 0xE4, 0x9F, 0xA5, 0xD3,
-    0x52, 0xD6, 0x58, 0xC3, 0x54, 0xD8, 0xD9, 0x25, 0xF9, 0x62, 0xC4, 0xD6, 0x66, 0x65, 0x8A, 0xB9,
-    0xD1, 0x9A, 0x62, 0x56, 0x26, 0x9E, 0x3B, 0xD0, 0x64, 0x96, 0x85, 0xAD, 0xF8, 0xAC, 0x59, 0x2A,
-    0x4E, 0x05, 0x81, 0x67, 0x3F, 0x68, 0x1D, 0xB8, 0x02, 0x0B, 0x79, 0xB2, 0x7B, 0xC5, 0xFF, 0x6C,
-    0x8C, 0x6F, 0x75, 0xE6, 0x97, 0xC5, 0xCF, 0x9D, 0x26, 0x03, 0xB7, 0x20, 0x3A, 0x40, 0xF2, 0x19,
-    0xCC, 0x1D, 0xFC, 0x74, 0x44, 0x1C, 0x9F, 0xC4, 0x8E, 0x05, 0x77, 0x62, 0x74, 0xD1, 0xAF, 0x70,
-    0x21, 0x10, 0x0A, 0x28, 0x3B, 0x34, 0xC9, 0x80, 0x26, 0xA2, 0x8F, 0x86, 0x96, 0x79, 0x16, 0x5B,
-    0x35, 0x04, 0x7A, 0xD0, 0xD8, 0x6F, 0xDB, 0x3F, 0x04, 0x0C, 0xA6, 0x21, 0x87, 0x44, 0xC3, 0x62,
-    0x06, 0xE6, 0xDA, 0xCB, 0xDA, 0x2C, 0xE8, 0x39, 0xCA, 0x17, 0x16, 0x51, 0xBA, 0x49, 0xA1, 0x02,
-    0xBB, 0xC9, 0x52, 0x0D, 0xEE, 0xD2, 0xD3, 0xD9, 0x56, 0xBD, 0x39, 0xAD, 0x00, 0xB5, 0xF9, 0x43,
-    0x8E, 0x85, 0x06, 0xE0, 0x6E, 0x34, 0xEA, 0x9A, 0x82, 0x4D, 0x8D, 0x26, 0x6F, 0xD1, 0xBC, 0xD5,
-    0xA1, 0x79, 0x63, 0x40, 0xB3, 0x61, 0xD1, 0x9C, 0x53, 0x34, 0x85, 0x6E, 0xA1, 0xC9, 0xB7, 0xD1,
-    0x98, 0x7B, 0x68, 0x92, 0xFB, 0x68, 0x22, 0xD8, 0x4F, 0x11, 0xB0, 0xF1, 0xD9, 0x88, 0x6B, 0x72,
-    0x36, 0x88, 0xCD, 0x4B, 0xA7, 0x9D, 0xCB, 0xB0, 0xAA, 0x24, 0x07, 0x73, 0xDE, 0x8D, 0xDA, 0x27,
-    0xA0, 0x40, 0xCA, 0xC8, 0x0D, 0x77, 0x2F, 0xD8, 0x40, 0x2C, 0x08, 0x55, 0x60, 0x43, 0xF3, 0x36,
-    0x05, 0x68, 0xB1, 0xCC, 0x4B, 0xBA, 0x45, 0x10, 0xF2, 0x19, 0x3C, 0x31, 0x1C, 0x11, 0x3A, 0x3C,
-    0x7D, 0x0B, 0xC4, 0xF2, 0x9B, 0xF0, 0xFF, 0x64, 0xD7, 0xBD, 0xA4, 0xFF, 0xAB, 0x1B, 0xF9, 0x1E,
-    0x9E, 0xF3, 0xC6, 0x4D, 0x8F, 0xF4, 0x53, 0x07, 0xC7, 0x41, 0x33, 0x72, 0xA5, 0xE8, 0xBA, 0x7E,
-    0xF2, 0x28, 0xE1, 0xBB, 0xF4, 0xCB, 0xD0, 0x23, 0x3A, 0x17, 0xBD, 0x42, 0xC3, 0x7E, 0x1C, 0x10,
-    0x3C, 0x17, 0xC6, 0xD6, 0xB2, 0x69, 0x87, 0x68, 0xC1, 0x6C, 0x6E, 0x40, 0x59, 0xB0, 0x6A, 0x84,
-    0xBA, 0xEC, 0x00, 0x16, 0x3C, 0x1F, 0x8D, 0x39, 0x28, 0xE7, 0x03, 0x54, 0xEA, 0x3E, 0x73, 0x22,
-    0xED, 0x6A, 0x05, 0xE6, 0x0A, 0xFF, 0x7D, 0xE1, 0x79, 0x6A, 0x2C, 0x2E, 0xAE, 0xF2, 0x74, 0x01,
-    0x06, 0xE7, 0x8F, 0x04, 0x99, 0xAF, 0xF8, 0xCD, 0x13, 0x10, 0xA1, 0x04, 0x37, 0x3E, 0x83, 0x2E,
-    0x13, 0x5A, 0xEB, 0xEB, 0x3E, 0xE0, 0x16, 0x6A, 0x5A, 0xAD, 0x90, 0xC7, 0x93, 0x9E, 0x68, 0x56,
-    0x59, 0x88, 0x95, 0xEF, 0x3F, 0xE2, 0xE1, 0x5F, 0x18, 0xEB, 0x40, 0x21, 0x1A, 0xDC, 0xC8, 0x68,
-    0xA4, 0x39, 0xBB, 0xE9, 0xA9, 0xFE, 0x46, 0x9B, 0xC0, 0xE5, 0x61, 0x64, 0x63, 0xA8, 0xA5, 0x74,
-    0xDE, 0x77, 0x9A, 0x0A, 0xF1, 0xBD, 0x4E, 0xAE, 0x9A, 0x3A, 0x6D, 0xF4, 0x8D, 0x3E, 0xC0, 0xD2,
-    0xF1, 0x7C, 0x00, 0x04, 0x8C, 0x0F, 0x3F, 0x2D, 0xCF, 0x77, 0x69, 0x63, 0x3E, 0xEC, 0x65, 0x3C,
-    0x26, 0xC1, 0x62, 0x4F, 0x2F, 0x80, 0x3F, 0x7B, 0xC6, 0xA5, 0xE0, 0xCC, 0xE5, 0xE1, 0x08, 0x59,
-    0x14, 0x93, 0xB3, 0x58, 0x7D, 0xE2, 0x93, 0x86, 0xA7, 0x2C, 0x83, 0x69, 0x82, 0xFB, 0x9A, 0x74,
-    0x7E, 0x0F, 0xCE, 0x00, 0xEE, 0xC1, 0xEE, 0x48, 0x76, 0x37, 0xC9, 0x6E, 0x2E, 0xF9, 0xB6, 0x35,
-    0x28, 0xC1, 0xF4, 0x6E, 0x11, 0x0F, 0x29, 0xC6, 0x03, 0x3E, 0xD4, 0x21, 0x00, 0x86, 0x5D, 0xD7,
-    0x82, 0x98, 0xA2, 0x22, 0xBB, 0x85, 0xBF, 0xAF, 0x36, 0x93, 0xEF, 0x78, 0xAB, 0x0B, 0x0D, 0xD1,
-    0x15, 0xB8, 0x91, 0x13, 0x5C, 0x77, 0xB8, 0x81, 0x79, 0x79, 0x1E, 0x10, 0xF6, 0x50, 0x2C, 0x4F,
-    0xB3, 0xEE, 0x30, 0x34, 0xFD, 0xCF, 0x3F, 0x6E, 0xB9, 0x80, 0x56, 0x83, 0x37, 0x14, 0x61, 0x43,
-    0x6A, 0xDF, 0x84, 0xFA, 0x26, 0xAC, 0x85, 0x80, 0xE6, 0x4E, 0x28, 0xDC, 0x32, 0xCB, 0x68, 0x43,
-    0x87, 0x06, 0xA0, 0x10, 0x53, 0xCF, 0x41, 0x62, 0x8E, 0x11, 0x5F, 0x0A, 0x0B, 0x1E, 0x17, 0xA3,
-    0xFD, 0x12, 0xC0, 0x45, 0xF7, 0x01, 0xCD, 0x86, 0xB0, 0x3B, 0x00, 0xE3, 0x5F, 0x0A, 0x0B, 0x57,
-    0xC3, 0x1A, 0xC0, 0x8D, 0x68, 0x83, 0xF0, 0xB0, 0x7A, 0xFB, 0x91, 0x11, 0xC3, 0xBA, 0xD3, 0x8F,
-    0xFE, 0xAF, 0x95, 0xDD, 0x8F, 0x9C, 0x2C, 0x8C, 0xF4, 0xAE, 0x96, 0x7E, 0xF5, 0xF7, 0xB2, 0xA7,
-    0x39, 0x10, 0xE8, 0x01, 0xD6, 0x11, 0xCB, 0xBB, 0x1C, 0xEC, 0xA2, 0x35, 0xA1, 0x19, 0x8F, 0x1D,
-    0x91, 0x9B, 0x67, 0xDC, 0xB5, 0x08, 0x3B, 0x2E, 0x47, 0xE6, 0x28, 0x1B, 0x61, 0x8A, 0x3E, 0x41,
-    0x74, 0xDC, 0x39, 0xF4, 0xCA, 0xD3, 0x2B, 0xF4, 0xA0, 0x1B, 0xE0, 0x3F, 0x93, 0xF4, 0x21, 0xC1,
-    0x32, 0x23, 0x6B, 0xEE, 0xF6, 0xB3, 0x9D, 0x33, 0x80, 0x23, 0x1A, 0xBB, 0xC0, 0x56, 0xCF, 0xFB,
-    0xFC, 0xEF, 0xAF, 0xC0, 0xA8, 0xA7, 0xD3, 0x79, 0x66, 0xB2, 0xFF, 0x07, 0x42, 0xE2, 0x93, 0x60,
-    0xF4, 0x75, 0x87, 0x39, 0x23, 0x88, 0x11, 0x8F, 0x28, 0xE2, 0xF7, 0x06, 0xC9, 0x77, 0xE0, 0xC9,
-    0x79, 0x95, 0x3E, 0xD0, 0xCB, 0xC4, 0x44, 0x36, 0x21, 0x72, 0xD0, 0x4F, 0x0E, 0xE6, 0xB6, 0xB3,
-    0x1D, 0x33, 0xE5, 0x25, 0x08, 0x18, 0x10, 0xB7, 0xA3, 0xF1, 0x57, 0x79, 0x97, 0x8C, 0x88, 0x2E,
-    0x90, 0xA1, 0xE0, 0xB9, 0x04, 0xD8, 0xD7, 0x22, 0xED, 0xE2, 0x1E, 0x05, 0xB6, 0x9E, 0xC3, 0xDE,
-    0x30, 0x20, 0xE8, 0x06, 0xDC, 0xA5, 0x4F, 0x80, 0x02, 0x8A, 0xDC, 0x62, 0x8C, 0xF6, 0x00, 0xB3,
-    0x7A, 0x03, 0x21, 0x6C, 0xA4, 0x1F, 0xEF, 0xF4, 0x3F, 0x8E, 0x46, 0x9E, 0xF4, 0xDE, 0xE8, 0x73,
-    0xA4, 0xF7, 0x8D, 0x79, 0xFB, 0x58, 0x62, 0x12, 0x8B, 0x12, 0xD3, 0xFA, 0x04, 0xFE, 0xC3, 0xC2,
-    0xB6, 0x19, 0x82, 0xC0, 0x00, 0x22, 0x86, 0x56, 0xDF, 0x27, 0xC6, 0xA0, 0xDC, 0x71, 0x87, 0x80,
-    0x51, 0x2B, 0x11, 0xC5, 0x9D, 0xB1, 0xAC, 0xE3, 0x3D, 0x25, 0x65, 0x4F, 0xD7, 0xC1, 0x20, 0xC4,
-    0x06, 0x6C, 0xD8, 0xA9, 0xCB, 0xDE, 0x64, 0xAE, 0xE4, 0x00, 0xFA, 0x22, 0x69, 0xA8, 0xD8, 0x9B,
-    0x61, 0xEE, 0x8B, 0x72, 0x28, 0x94, 0x59, 0xAB, 0x2B, 0x4F, 0x59, 0x6B, 0x29, 0xD7, 0xEB, 0x08,
-    0x60, 0x74, 0x79, 0x3E, 0xB9, 0xFB, 0xC2, 0x3C, 0xD3, 0x7A, 0xA2, 0x0A, 0x18, 0x04, 0x71, 0xB7,
-    0x8D, 0xCF, 0x2A, 0xDE, 0x1E, 0x8A, 0x36, 0xFC, 0x36, 0xC9, 0x92, 0x06, 0x55, 0xE3, 0xC6, 0x20,
-    0x57, 0xC2, 0xEA, 0xB1, 0xD4, 0x83, 0x0D, 0x46, 0xA6, 0xD0, 0xF6, 0xAB, 0x19, 0x0C, 0x9F, 0xD6,
-    0x04, 0xCA, 0xEB, 0xDA, 0x19, 0x22, 0xB0, 0x7D, 0x90, 0x0A, 0x46, 0x94, 0x56, 0x7B, 0x56, 0xF2,
-    0x8F, 0x50, 0xA2, 0x00, 0x32, 0x03, 0xC9, 0xED, 0x75, 0xA9, 0x8D, 0xEB, 0xC9, 0xFA, 0x33, 0x82,
-    0x3F, 0x89, 0xEE, 0x56, 0xB2, 0x12, 0x67, 0xD2, 0xAD, 0x88, 0x8F, 0x22, 0xD8, 0x9D, 0x19, 0x4C,
-    0x7C, 0x47, 0x2E, 0x05, 0x0D, 0x10, 0x67, 0x08, 0x2E, 0x30, 0x54, 0xD2, 0x68, 0x35, 0x7B, 0xC9,
-    0x9D, 0x7E, 0x74, 0x6A, 0xCB, 0x8F, 0x60, 0x43, 0x00, 0x4F, 0x30, 0x92, 0xE4, 0x3E, 0xEC, 0xF6,
-    0xA6, 0x13, 0x67, 0x1C, 0x23, 0xDD, 0xE8, 0x16, 0xD0, 0xCB, 0x89, 0xFF, 0x03, 0x68, 0x5C, 0xF5,
-    0x21, 0x02, 0x3D, 0xCB, 0x38, 0x18, 0x66, 0x91, 0x5A, 0x7F, 0xB2, 0x1C, 0xE3, 0x18, 0x8F, 0xBA,
-    0xA3, 0xC8, 0x9F, 0x8E, 0x2E, 0xAE, 0xF3, 0x7A, 0x09, 0xED, 0x9D, 0x91, 0x12, 0x61, 0x98, 0x5B,
-    0xB5, 0x48, 0x07, 0x9A, 0x43, 0xA2, 0xD5, 0x51, 0x18, 0xE2, 0x5D, 0x77, 0xB6, 0xFF, 0x57, 0x64,
-    0xC6, 0x48, 0x6B, 0xB2, 0x79, 0xE4, 0xE0, 0xFC, 0x35, 0x74, 0x76, 0x5F, 0xA1, 0x2B, 0x1D, 0xDF,
-    0xA4, 0x0D, 0xC1, 0xBF, 0x19, 0xEB, 0xA1, 0xA1, 0xF9, 0x3F, 0xFA, 0x0B, 0x72, 0x53, 0xA0, 0x7F,
-    0xB9, 0xCA, 0x6D, 0xC9, 0x5D, 0xDE, 0xE6, 0x17, 0x0D, 0x1E, 0x16, 0x33, 0xF0, 0x78, 0xC0, 0x71,
-    0x70, 0xA6, 0x92, 0xF6, 0x3F, 0x1D, 0xA4, 0x2C, 0x6A, 0x3A, 0x9E, 0xE9, 0x3B, 0x33, 0x5F, 0x58,
-    0xE3, 0x48, 0x88, 0xCC, 0xF2, 0xB5, 0x4D, 0xBB, 0xA4, 0x33, 0x80, 0xF8, 0x79, 0x15, 0x0C, 0xC4,
-    0x02, 0x07, 0x77, 0x35, 0x79, 0x26, 0xA7, 0x03, 0x14, 0xFC, 0x29, 0x9E, 0xA2, 0x20, 0x60, 0xB3,
-    0xCE, 0xC5, 0xDB, 0x72, 0xE6, 0x16, 0xA0, 0x42, 0xC2, 0x7E, 0x32, 0xF6, 0xC5, 0x59, 0xF2, 0x61,
-    0xD0, 0xA7, 0xC5, 0x1B, 0xD0, 0x85, 0xD7, 0x22, 0xA0, 0x67, 0x34, 0xF9, 0xB9, 0x62, 0x38, 0x14,
-    0xFA, 0xB4, 0x4E, 0x14, 0x60, 0x15, 0x6F, 0xBF, 0x49, 0x1E, 0x83, 0x21, 0x5F, 0x9C, 0xF6, 0xF2,
-    0x2A, 0xAC, 0x11, 0xDB, 0x85, 0xE4, 0x00, 0x3B, 0x61, 0xB0, 0x06, 0x1C, 0xB0, 0x9F, 0xA7, 0xC1,
-    0xAE, 0x21, 0xE1, 0x14, 0x9A, 0x95, 0x0E, 0x33, 0xE1, 0x0D, 0x70, 0x59, 0x13, 0xF7, 0xCF, 0xF8,
-    0xE1, 0x60, 0x41, 0xCE, 0x53, 0x09, 0x31, 0xE7, 0x51, 0x57, 0xE9, 0xD2, 0x94, 0x08, 0x18, 0xDE,
-    0x26, 0x34, 0xC3, 0x6F, 0x5B, 0x9F, 0xEF, 0xE1, 0x84, 0xFF, 0xB7, 0x21, 0xF9, 0xA8, 0xCD, 0x4F,
-    0x65, 0x57, 0xE6, 0x63, 0x1B, 0x38, 0x40, 0x81, 0x21, 0xE8, 0xFB, 0xAF, 0x3F, 0xDD, 0xB5, 0xE2,
-    0x23, 0x51, 0xDD, 0x6D, 0xE0, 0xE5, 0x95, 0x3B, 0x81, 0x42, 0xB9, 0x22, 0x39, 0x4C, 0xF9, 0x7B,
-    0x8C, 0xF4, 0x11, 0xC2, 0xF8, 0xDE, 0xC0, 0x12, 0x28, 0xE1, 0x87, 0x06, 0x54, 0x67, 0x39, 0x8A,
-    0x38, 0x68, 0x57, 0x59, 0x8B, 0xE1, 0x46, 0xE2, 0x08, 0xAC, 0x41, 0x6D, 0x63, 0xBA, 0x78, 0x88,
-    0xA7, 0x03, 0xFA, 0xDA, 0x59, 0xF9, 0xBC, 0xF1, 0x61, 0x17, 0x67, 0xB9, 0xBD, 0x46, 0x65, 0xC7,
-    0x30, 0xBC, 0x17, 0xC5, 0xBD, 0x36, 0xE7, 0x10, 0x92, 0x8C, 0x7E, 0xEC, 0xBE, 0x2B, 0xFC, 0x4A,
-    0x4B, 0xE7, 0x49, 0x3C, 0xE6, 0x67, 0x46, 0xC9, 0xB5, 0xF1, 0x5C, 0xE1, 0xF5, 0xF4, 0xC7, 0xCA,
-    0xA1, 0x2A, 0xEE, 0x28, 0x23, 0x05, 0x0D, 0xD9, 0x61, 0xAA, 0x19, 0x4A, 0x63, 0x69, 0xD0, 0xAA,
-    0x9D, 0x31, 0xF4, 0x09, 0x50, 0x1D, 0x40, 0x5C, 0xC5, 0x7C, 0xCD, 0xDB, 0x9F, 0xD9, 0x0E, 0x26,
-    0xB6, 0xD1, 0xC7, 0x31, 0x73, 0x06, 0x7B, 0x8C, 0x6D, 0x42, 0xA6, 0xBC, 0x9E, 0x02, 0xDD, 0x30,
-    0x1D, 0xB0, 0x2E, 0x52, 0xF5, 0x61, 0xD0, 0xA7, 0xA3, 0x30, 0xCA, 0xE0, 0xD9, 0xB3, 0x79, 0x01,
-    0x15, 0x35, 0x5E, 0x36, 0x63, 0xC2, 0x43, 0xE1, 0x9F, 0x74, 0xB2, 0x96, 0x47, 0x8D, 0x7C, 0x1F,
-    0x5D, 0x47, 0x92, 0x65, 0xE0, 0x3A, 0x24, 0xFA, 0x5E, 0x17, 0x17, 0x3C, 0x33, 0xE4, 0xCD, 0xDF,
-    0x8F, 0x1C, 0xF1, 0x10, 0x78, 0xF7, 0x08, 0x94, 0xA6, 0x34, 0x4F, 0x9C, 0x1A, 0x15, 0x53, 0x7E,
-    0xE0, 0xD7, 0x1E, 0xF7, 0xA1, 0xAA, 0x5B, 0x5B, 0x43, 0x1D, 0x47, 0x48, 0xDB, 0x4E, 0x5F, 0x3F,
-    0x51, 0xBF, 0xC9, 0xBB, 0x6E, 0xF9, 0x0C, 0x44, 0x9C, 0x57, 0x3B, 0x06, 0x1E, 0xE4, 0xBD, 0x69,
-    0x0C, 0x22, 0x41, 0x39, 0x96, 0xD7, 0x91, 0x42, 0xB6, 0xFE, 0x61, 0xCB, 0x0F, 0x3E, 0xB4, 0xE5,
-    0xCE, 0x96, 0xCD, 0x35, 0x18, 0x0D, 0x2A, 0xFE, 0x74, 0x4C, 0x9D, 0xCD, 0xF2, 0x88, 0x3D, 0x81,
-    0x79, 0x85, 0xB3, 0xF2, 0x18, 0x89, 0xC3, 0xF9, 0x18, 0x8C, 0xFB, 0xCF, 0x40, 0x3C, 0x6D, 0x8F,
-    0xA9, 0x7D, 0xCB, 0x22, 0x62, 0xFE, 0xE0, 0xA0, 0xB5, 0xAF, 0x4F, 0x79, 0xE4, 0xE7, 0xB0, 0xC1,
-    0xD3, 0xBB, 0x0F, 0xD6, 0xC9, 0x35, 0x02, 0xD0, 0x0E, 0xBF, 0x00, 0x55, 0x47, 0x1E, 0xC3, 0x1B,
-    0xAC, 0xC5, 0xC6, 0x49, 0x80, 0x09, 0x89, 0x7F, 0x61, 0xCA, 0xB0, 0x59, 0x0F, 0x7A, 0xE4, 0xB7,
-    0x63, 0x35, 0x55, 0xDC, 0x10, 0x6F, 0x2C, 0x1F, 0x06, 0xE5, 0xA0, 0x49, 0x25, 0xFD, 0xB3, 0x95,
-    0xF2, 0xF5, 0x5E, 0xAE, 0x44, 0x8B, 0xDD, 0x06, 0xB6, 0x2C, 0xCB, 0xA7, 0x93, 0x7A, 0xFC, 0x91,
-    0x78, 0x44, 0xF2, 0x87, 0x40, 0xE5, 0xFC, 0x7E, 0x98, 0xEA, 0x1E, 0xAA, 0xA7, 0xA8, 0xF5, 0x64,
-    0x51, 0x98, 0xF0, 0x08, 0x3C, 0xEE, 0x27, 0xA8, 0xCA, 0xFD, 0x9E, 0xBD, 0x00, 0xF1, 0x29, 0x80,
-    0xED, 0x78, 0xCA, 0x65, 0xDE, 0xD3, 0xF9, 0x6B, 0x79, 0xDC, 0x45, 0xFC, 0x5C, 0x0B, 0x8C, 0x79,
-    0x5D, 0x91, 0x21, 0xCB, 0x4C, 0x2C, 0xA2, 0xB5, 0xD9, 0x69, 0x24, 0x7C, 0xC8, 0xBA, 0x99, 0x89,
-    0xDB, 0xCE, 0x1F, 0x48, 0x5C, 0x22, 0xAD, 0x27, 0xBC, 0x8A, 0x05, 0xFC, 0xCB, 0xAC, 0x7B, 0x2D,
-    0x4F, 0x6E, 0xF0, 0xFC, 0x60, 0x16, 0xC2, 0x9D, 0xA2, 0x3E, 0xED, 0xFE, 0x25, 0x62, 0x75, 0xC9,
-    0xDC, 0xAE, 0xAD, 0xEE, 0xE6, 0x1D, 0x92, 0x4B, 0x8F, 0xF8, 0x34, 0xA0, 0x5A, 0x1C, 0x78, 0xBE,
-    0x3B, 0xDD, 0xF8, 0xCD, 0x77, 0xEC, 0xE3, 0x18, 0x8E, 0xE5, 0x9C, 0x53, 0x8C, 0xF3, 0xAB, 0xFF,
-    0x91, 0xB6, 0xD7, 0x43, 0x87, 0x8A, 0xFA, 0xC7, 0x5C, 0x47, 0xDE, 0xAA, 0x5F, 0x79, 0xF4, 0x91,
-    0x04, 0x58, 0x7A, 0x57, 0xDD, 0x09, 0xBF, 0xAF, 0x40, 0x10, 0x3C, 0xDF, 0xE7, 0xF1, 0x7E, 0xDA,
-    0x84, 0x03, 0xF2, 0xD2, 0xC1, 0x5F, 0x09, 0xF4, 0x3C, 0x4A, 0x03, 0x78, 0x48, 0xEE, 0xD6, 0x10,
-    0x95, 0x7F, 0x96, 0xD0, 0x4F, 0xDF, 0x18, 0x26, 0xB9, 0xB3, 0x83, 0x4C, 0x77, 0xAC, 0x64, 0x5D,
-    0xDD, 0xBB, 0xAF, 0x6F, 0x62, 0x58, 0xD5, 0xFF, 0x13, 0xC5, 0x5A, 0xBF, 0x8F, 0xDD, 0x46, 0x92,
-    0x6E, 0x92, 0x1E, 0x11, 0xB7, 0x0C, 0xE8, 0x60, 0x06, 0x07, 0xAC, 0x0F, 0x60, 0x74, 0xC0, 0xDD,
-    0x5E, 0xC0, 0xF8, 0x80, 0xBB, 0x6B, 0x6A, 0x8D, 0x83, 0x02, 0x07, 0x9A, 0x60, 0x26, 0x72, 0xA0,
-    0x7C, 0x0F, 0x77, 0xF3, 0x0F, 0xEC, 0x2E, 0xDF, 0xDA, 0x38, 0x6C, 0xE0, 0x40, 0x4A, 0xEC, 0x0D,
-    0x36, 0x58, 0x1F, 0xE0, 0xC5, 0x79, 0xDF, 0x06, 0xDA, 0xF4, 0x00, 0x5B, 0xA4, 0x47, 0x81, 0x03,
-    0x05, 0xA6, 0x56, 0x30, 0x1C, 0x28, 0x30, 0x6F, 0x2D, 0x9F, 0x00, 0x39, 0x18, 0xAE, 0x45, 0xDB,
-    0x94, 0x86, 0xEC, 0xBA, 0xEF, 0xAB, 0xE6, 0x9B, 0x1F, 0xB2, 0x7E, 0x6B, 0xA4, 0x7D, 0x78, 0xEC,
-    0xC7, 0xE6, 0x6B, 0x76, 0x77, 0x75, 0x55, 0x57, 0x7D, 0x55, 0xD5, 0xE6, 0x87, 0xCB, 0xF7, 0x8C,
-    0x49, 0x45, 0x8C, 0x89, 0x44, 0x6A, 0x63, 0xB6, 0xB7, 0x37, 0xCD, 0xFC, 0x91, 0x0E, 0x85, 0x9D,
-    0x50, 0xE4, 0xB2, 0x60, 0x23, 0xD4, 0x23, 0x87, 0x7A, 0xE8, 0x4A, 0xD4, 0xE5, 0x2C, 0xEA, 0xE5,
-    0x65, 0xD4, 0xF3, 0xB6, 0xAC, 0x4D, 0xDA, 0xA7, 0x9D, 0x89, 0xC7, 0x68, 0x32, 0xA1, 0x98, 0xAA,
-    0x36, 0x72, 0xAB, 0xEA, 0x4C, 0x29, 0xE2, 0xF0, 0x36, 0x7A, 0xC6, 0x10, 0xD2, 0xC5, 0x13, 0x3A,
-    0x88, 0x30, 0x96, 0xD4, 0xE8, 0x31, 0xEB, 0xCB, 0x06, 0x75, 0xDB, 0xB1, 0x1E, 0x2E, 0x97, 0x45,
-    0x8A, 0xC6, 0x56, 0x06, 0xCC, 0xA1, 0xE0, 0xF8, 0x09, 0x6E, 0x45, 0xC6, 0x10, 0x57, 0x74, 0x21,
-    0x47, 0x2B, 0xDB, 0xA0, 0x65, 0xF1, 0x8A, 0x4C, 0xE8, 0xAC, 0x17, 0x57, 0x5D, 0x9F, 0x8C, 0x94,
-    0x5D, 0x34, 0xC9, 0x22, 0xFB, 0x56, 0x4E, 0xCB, 0x67, 0x18, 0xE2, 0xAC, 0x4C, 0x53, 0x22, 0x6F,
-    0xF6, 0x01, 0x7B, 0x58, 0x37, 0x1B, 0x98, 0xF6, 0x22, 0xAD, 0x31, 0xA5, 0x0A, 0xEF, 0x5A, 0x69,
-    0x49, 0x26, 0x0A, 0xB3, 0xB6, 0x22, 0x12, 0x64, 0x19, 0x3E, 0xC4, 0xDF, 0x21, 0xC6, 0xC3, 0x00,
-    0xAC, 0xDB, 0x3D, 0xD4, 0xF3, 0x9B, 0xA8, 0xA7, 0x3D, 0xEA, 0xF1, 0x88, 0xA1, 0x43, 0x17, 0x8F,
-    0x1C, 0x1F, 0xF5, 0xB2, 0x46, 0x3D, 0xEF, 0x92, 0xD1, 0xA4, 0xEE, 0xF7, 0x62, 0x62, 0x0C, 0xDC,
-    0x62, 0x9A, 0x32, 0xE2, 0x6D, 0xBC, 0x0F, 0xB2, 0x6C, 0x0B, 0xB2, 0xD2, 0x31, 0x1D, 0x4C, 0x20,
-    0x67, 0xB0, 0x44, 0xF6, 0x0B, 0xBC, 0x96, 0x8E, 0x6B, 0x45, 0xB0, 0x99, 0x15, 0x59, 0x61, 0xBF,
-    0x1A, 0xB1, 0x36, 0x8D, 0x29, 0xA7, 0x83, 0xA9, 0x54, 0xB2, 0x00, 0x59, 0x35, 0x16, 0xAB, 0xFE,
-    0xC7, 0x90, 0xEC, 0x98, 0x38, 0x78, 0x50, 0x49, 0xA3, 0x64, 0x7D, 0x35, 0x55, 0x4D, 0xFA, 0x9D,
-    0x18, 0xFB, 0xF9, 0x10, 0xC8, 0x4E, 0x9F, 0x4D, 0x25, 0xD7, 0x40, 0x3E, 0x6F, 0xAA, 0xC1, 0x16,
-    0xEB, 0x4A, 0x42, 0xCD, 0xD9, 0xF7, 0xEC, 0xCA, 0x91, 0x04, 0xD6, 0xD3, 0x7D, 0xD4, 0x93, 0x3B,
-    0x8E, 0xDD, 0xD9, 0x1A, 0x73, 0x49, 0x51, 0xAF, 0x7E, 0x21, 0x5C, 0x4B, 0xD4, 0xB3, 0x0E, 0xF5,
-    0x04, 0x2B, 0x8C, 0xB7, 0x97, 0x52, 0x07, 0x18, 0x69, 0xC0, 0x44, 0x40, 0x82, 0x25, 0xCF, 0xB2,
-    0xDE, 0xA4, 0x43, 0x3A, 0xE2, 0xCF, 0x08, 0x3D, 0x94, 0x57, 0xA5, 0x40, 0x1D, 0xDD, 0x92, 0x83,
-    0xC6, 0xFC, 0x9C, 0xC5, 0xBF, 0xB0, 0xC8, 0x75, 0x1D, 0xEB, 0x83, 0x49, 0x94, 0x14, 0x9C, 0xF0,
-    0xC6, 0xB3, 0xF3, 0x30, 0x2B, 0x4C, 0x30, 0xF8, 0xAE, 0x2D, 0x89, 0x6B, 0x41, 0x01, 0xA8, 0xF8,
-    0x1F, 0x63, 0x82, 0x6D, 0xF2, 0xCB, 0x5F, 0x01, 0xC9, 0x75, 0xCA, 0x6F, 0xFF, 0x79, 0x45, 0x6E,
-    0x50, 0xF2, 0x16, 0xB8, 0x9A, 0xD2, 0x5D, 0xEC, 0xEC, 0x60, 0xD6, 0x33, 0xF6, 0x33, 0x52, 0x80,
-    0xD9, 0x11, 0xA4, 0x03, 0x4C, 0x02, 0xFD, 0xE0, 0x2D, 0xD6, 0x39, 0xE0, 0x03, 0xDB, 0xFA, 0x16,
-    0xA1, 0x56, 0x7A, 0xF3, 0x52, 0x22, 0x5F, 0x56, 0x64, 0x68, 0x9D, 0x40, 0x74, 0xCD, 0x0E, 0x97,
-    0x76, 0x83, 0xDD, 0x6F, 0x70, 0x19, 0xB4, 0xA3, 0xAA, 0x30, 0x39, 0xE6, 0xE3, 0x77, 0x4C, 0x2C,
-    0x3D, 0xB7, 0x10, 0x96, 0x30, 0x9F, 0x5E, 0xE7, 0x12, 0x61, 0x04, 0x48, 0x08, 0xF7, 0xC2, 0xFC,
-    0x43, 0xF9, 0xC1, 0x28, 0x91, 0x7C, 0xFA, 0x01, 0x59, 0x5D, 0x42, 0x5E, 0xC8, 0x2A, 0x4E, 0x7B,
-    0xDB, 0x93, 0x67, 0x04, 0xB3, 0xA9, 0x76, 0x1A, 0x53, 0x05, 0x13, 0x06, 0x5B, 0x7B, 0x11, 0xF4,
-    0x6C, 0x6C, 0x62, 0xEA, 0x85, 0xC1, 0x64, 0xEC, 0x27, 0x5D, 0xDA, 0xE6, 0xF5, 0xA6, 0xD9, 0x7A,
-    0x66, 0x7A, 0xF8, 0xB1, 0x50, 0x12, 0x64, 0x39, 0x9B, 0x29, 0x7F, 0xCC, 0x8B, 0xE1, 0x0F, 0xDA,
-    0x73, 0xC7, 0x75, 0x2A, 0xA7, 0x59, 0xB3, 0x1A, 0xF5, 0x59, 0xE8, 0xD9, 0x42, 0xCF, 0x79, 0x9D,
-    0xD7, 0x21, 0x77, 0x51, 0xAE, 0x5B, 0xA0, 0xD1, 0x95, 0x7B, 0xFE, 0xF4, 0x50, 0x65, 0xB8, 0xC0,
-    0x45, 0x63, 0x05, 0xFD, 0xD0, 0x9A, 0x72, 0x54, 0xD9, 0x7F, 0x36, 0x7A, 0x02, 0xB2, 0x38, 0xAF,
-    0xC1, 0x20, 0x39, 0xC7, 0x65, 0x1A, 0x67, 0x35, 0xB8, 0x51, 0xCC, 0x3D, 0xBB, 0x0B, 0x54, 0x03,
-    0x0D, 0x26, 0x22, 0x0B, 0xDC, 0x38, 0x74, 0x58, 0xF5, 0x15, 0x14, 0xC4, 0x95, 0xD1, 0x24, 0x13,
-    0xBA, 0x2E, 0xA1, 0xC0, 0x22, 0x87, 0x1B, 0xBB, 0x4F, 0xFD, 0xC0, 0x9B, 0xD5, 0x93, 0xF2, 0x3A,
-    0xDA, 0x8C, 0x73, 0x63, 0xBC, 0x75, 0x0B, 0xAF, 0xCF, 0xFD, 0xB0, 0xC3, 0x0B, 0x07, 0x62, 0x60,
-    0xFF, 0x38, 0x51, 0x2F, 0xE5, 0xDC, 0xDD, 0xD7, 0x7A, 0x55, 0x51, 0xFA, 0x74, 0xE1, 0x95, 0x5F,
-    0x36, 0x41, 0x57, 0x24, 0xF2, 0xDD, 0x64, 0xA8, 0x97, 0xA0, 0x52, 0xEF, 0xEC, 0xD0, 0x7C, 0x18,
-    0x68, 0xF2, 0xB2, 0x46, 0x03, 0xCC, 0x09, 0x0D, 0xAA, 0x7B, 0x6E, 0x63, 0xBD, 0xB5, 0x2D, 0x4D,
-    0x8D, 0xBC, 0x83, 0xD7, 0x32, 0xD1, 0x3D, 0x25, 0xD8, 0x54, 0xA1, 0x5C, 0xA5, 0x35, 0x2B, 0x3C,
-    0x89, 0x0B, 0xEA, 0xED, 0x49, 0x95, 0xF7, 0x42, 0x35, 0x78, 0xCC, 0xE9, 0xA2, 0xC8, 0xC6, 0x98,
-    0x54, 0xA2, 0x88, 0x49, 0x78, 0xE4, 0xB0, 0x70, 0x91, 0x1C, 0x14, 0xEE, 0x1F, 0xDC, 0x7B, 0x11,
-    0x6D, 0x41, 0xCC, 0x26, 0xC9, 0xB8, 0x7A, 0x03, 0xEF, 0xBA, 0x8B, 0xE8, 0x65, 0xEE, 0x4F, 0x7B,
-    0x3E, 0x20, 0x96, 0x6A, 0x8F, 0x44, 0x95, 0x78, 0x8E, 0x45, 0x68, 0x31, 0x21, 0xE7, 0x9F, 0x14,
-    0xB6, 0x09, 0xE5, 0x8B, 0x09, 0x0F, 0xAA, 0x06, 0xCA, 0x7F, 0xD2, 0x59, 0x97, 0x1D, 0xC6, 0x9F,
-    0xF0, 0x16, 0x69, 0x52, 0xEA, 0xAA, 0x26, 0xF2, 0x4F, 0x4A, 0x58, 0xD1, 0x48, 0xDE, 0x16, 0x6D,
-    0x0C, 0x71, 0x29, 0xF1, 0xFA, 0xEE, 0xA4, 0x54, 0xFD, 0x60, 0xF9, 0x3B, 0x48, 0xC4, 0x02, 0xDD,
-    0x6F, 0xA8, 0x15, 0x07, 0xE9, 0x37, 0x45, 0xEE, 0x80, 0x7F, 0x90, 0xCC, 0x73, 0xB4, 0xCE, 0x58,
-    0x4A, 0x5A, 0x2F, 0x93, 0xDD, 0x5D, 0xFE, 0x52, 0xE4, 0xCF, 0xD0, 0xCA, 0xF8, 0x27, 0x3B, 0xF6,
-    0x0F, 0x2A, 0x6E, 0xF9, 0x5B, 0xFF, 0xCE, 0x6F, 0x68, 0xD7, 0x60, 0x98, 0xD9, 0x2B, 0xAF, 0x60,
-    0x7B, 0x7B, 0x36, 0x56, 0x93, 0xC2, 0x05, 0x48, 0x55, 0x97, 0xF7, 0x59, 0x6F, 0x9B, 0x78, 0x04,
-    0x4F, 0x46, 0xB0, 0xF8, 0xF0, 0xAA, 0xB5, 0x3F, 0x15, 0xF3, 0x7C, 0x30, 0x7F, 0x60, 0xDB, 0x88,
-    0x82, 0x5D, 0x71, 0xEB, 0x6C, 0x52, 0xBB, 0x9D, 0xA9, 0xE3, 0x46, 0x2E, 0x76, 0x99, 0xF4, 0x01,
-    0x84, 0x5D, 0x4D, 0x76, 0x70, 0x30, 0x30, 0x66, 0xFE, 0xCD, 0xE1, 0x94, 0x38, 0xBF, 0xE5, 0xFB,
-    0x9C, 0xAC, 0xC8, 0xC7, 0x9C, 0xF9, 0xB1, 0x7F, 0x50, 0xB9, 0xB5, 0x3C, 0x77, 0x40, 0x2D, 0xB7,
-    0x4C, 0xDC, 0xC4, 0x0D, 0xC5, 0x11, 0x1D, 0x16, 0x6A, 0x66, 0x83, 0xE2, 0xC4, 0xA6, 0xAE, 0xE6,
-    0xAE, 0xA5, 0xD4, 0xD1, 0xFC, 0x50, 0xCD, 0x99, 0x93, 0x9A, 0xFA, 0xAA, 0x6F, 0x55, 0x9C, 0xBC,
-    0x78, 0xBF, 0xFA, 0x9C, 0xC0, 0xD4, 0x0F, 0x26, 0x88, 0xC1, 0xA6, 0x7B, 0xA7, 0xB1, 0x9A, 0x20,
-    0xA4, 0xE2, 0xD8, 0x3F, 0x2A, 0x2F, 0xBF, 0x3A, 0x90, 0x24, 0x20, 0xB7, 0x82, 0x5F, 0x98, 0xE5,
-    0xA8, 0x53, 0xB3, 0x85, 0x91, 0x68, 0x94, 0x9F, 0x71, 0x8A, 0x25, 0x0D, 0xE0, 0xCE, 0xC2, 0xDB,
-    0xFA, 0x0F, 0x70, 0xD1, 0x6E, 0xC8, 0xBB, 0x1E, 0x4F, 0x64, 0x2D, 0x04, 0xE6, 0xC7, 0x63, 0x34,
-    0xA4, 0xDF, 0x38, 0xC5, 0x36, 0x78, 0x21, 0x98, 0xED, 0x94, 0x0C, 0x98, 0xD5, 0x2F, 0xFD, 0xCF,
-    0x99, 0x51, 0x7B, 0x8F, 0xE7, 0x1F, 0xB7, 0x7C, 0x17, 0x0F, 0xD1, 0xA4, 0xE3, 0xCF, 0xF1, 0xFF,
-    0x46, 0x25, 0xFA, 0xCC, 0xE1, 0xEB, 0x94, 0x9B, 0xA4, 0x4B, 0xBB, 0x90, 0x2B, 0x43, 0x1C, 0x68,
-    0xD1, 0x64, 0x6D, 0xF3, 0x04, 0xE5, 0x86, 0xC0, 0x36, 0xA3, 0xD6, 0x23, 0x96, 0x16, 0xD8, 0x12,
-    0xBB, 0xA8, 0xA0, 0x8D, 0x67, 0x04, 0x01, 0xCB, 0x72, 0x83, 0x68, 0xB9, 0x4D, 0x09, 0x97, 0xE4,
-    0x6E, 0x55, 0x63, 0x5B, 0xAC, 0x67, 0xA3, 0x87, 0x39, 0xB4, 0x68, 0xAA, 0x31, 0xA0, 0xE8, 0x7F,
-    0xB8, 0xFC, 0xEF, 0x29, 0xE0, 0xDE, 0xCF, 0xE4, 0x36, 0x6F, 0x30, 0x62, 0x7E, 0x5B, 0xD0, 0x2C,
-    0xEF, 0x21, 0x35, 0x02, 0x95, 0x40, 0x63, 0xD2, 0x11, 0xC5, 0x51, 0x91, 0x77, 0x80, 0x91, 0x37,
-    0xBC, 0x75, 0x24, 0x39, 0x24, 0x0B, 0x86, 0x00, 0x64, 0x16, 0x71, 0x9F, 0x35, 0x24, 0xDB, 0x0B,
-    0xF0, 0x55, 0xE0, 0xAE, 0xBB, 0x13, 0x35, 0x26, 0x95, 0xAD, 0x6D, 0x93, 0x89, 0x9A, 0xB6, 0xBA,
-    0xE7, 0xE2, 0x33, 0x2A, 0x58, 0x3B, 0x64, 0xDA, 0x36, 0x91, 0xFD, 0x29, 0x94, 0x6B, 0x93, 0x79,
-    0x89, 0xB3, 0x8B, 0xC7, 0x97, 0x61, 0xD6, 0xF2, 0xDF, 0x56, 0x43, 0xCE, 0xA5, 0xC2, 0x92, 0x9D,
-    0x92, 0x3B, 0x46, 0xC1, 0x4C, 0xD8, 0x05, 0x40, 0x94, 0xFB, 0x62, 0x74, 0x41, 0x02, 0xF5, 0x2F,
-    0x56, 0xDE, 0xC6, 0xF3, 0x27, 0x3D, 0x00, 0x99, 0x51, 0x13, 0xB5, 0x11, 0x7D, 0x01, 0x4A, 0xB1,
-    0x3D, 0xD4, 0x0A, 0xCF, 0x95, 0x74, 0xFD, 0x44, 0xF4, 0x2D, 0x28, 0x20, 0xB4, 0xCD, 0xC6, 0x16,
-    0x47, 0xE0, 0xD0, 0x0B, 0xE0, 0xBA, 0x6A, 0x15, 0xEE, 0xA2, 0xDE, 0x5F, 0xC9, 0xA1, 0x56, 0x79,
-    0xFE, 0xA4, 0xBF, 0x20, 0xFA, 0x0C, 0xB6, 0x93, 0x89, 0xD5, 0xFF, 0x59, 0xB9, 0x23, 0xAA, 0x1F,
-    0x50, 0xD0, 0x89, 0x88, 0xF0, 0x4F, 0xDC, 0xF9, 0x65, 0x98, 0xF7, 0xF4, 0x73, 0x25, 0x5D, 0x95,
-    0x53, 0xD5, 0x79, 0xE7, 0x39, 0x86, 0xD2, 0x0A, 0x26, 0x4C, 0x0E, 0xDB, 0x40, 0x59, 0x0F, 0xE5,
-    0x03, 0x2F, 0x1A, 0x58, 0xF2, 0xE6, 0x43, 0x6E, 0xDC, 0xF2, 0xF7, 0xD4, 0xB7, 0x54, 0xD7, 0xE2,
-    0x6F, 0x1E, 0xE7, 0x2D, 0xDE, 0xA8, 0xA2, 0x89, 0x75, 0x79, 0xE9, 0x4A, 0x0E, 0x6A, 0xA6, 0x84,
-    0xBB, 0x6D, 0x6B, 0xB5, 0x58, 0x94, 0x00, 0xBA, 0xF5, 0x0A, 0x50, 0xD3, 0xE1, 0xD8, 0xA3, 0x29,
-    0x9F, 0x0C, 0x9C, 0x4D, 0x2A, 0x5A, 0x62, 0x8C, 0x3B, 0xE5, 0x10, 0x49, 0x61, 0x3B, 0xA0, 0xD5,
-    0xAA, 0xB6, 0xF0, 0x74, 0xD1, 0x2A, 0x01, 0x10, 0x02, 0x53, 0xF0, 0xE2, 0xC3, 0x1F, 0x29, 0xA1,
-    0x34, 0x26, 0x78, 0x8C, 0xE9, 0xC1, 0x2F, 0xA6, 0x8B, 0x3C, 0xB1, 0x90, 0xEF, 0xB4, 0x6C, 0xF4,
-    0x31, 0x0D, 0x0D, 0x70, 0x13, 0x49, 0x26, 0x6E, 0x81, 0xDB, 0x48, 0x82, 0x5B, 0x42, 0x3F, 0x3C,
-    0x26, 0x0A, 0x3B, 0xDA, 0xC9, 0xDC, 0xFA, 0x61, 0x8F, 0xF9, 0x09, 0xF9, 0x53, 0x2D, 0x8C, 0x2A,
-    0x61, 0xBA, 0xE7, 0x96, 0x5A, 0xBD, 0xA2, 0x5F, 0xD2, 0xAE, 0x9B, 0x64, 0xA8, 0x86, 0xD0, 0x81,
-    0x5F, 0x90, 0xA5, 0x3E, 0x07, 0x57, 0x13, 0xA0, 0xB0, 0x5D, 0x41, 0x87, 0x55, 0x1D, 0x8F, 0x39,
-    0x7A, 0x4B, 0xD0, 0xEF, 0x2E, 0x47, 0xA8, 0x16, 0xF7, 0x79, 0xA0, 0x96, 0x3A, 0xB7, 0xEE, 0x52,
-    0x25, 0xE3, 0x90, 0xF5, 0x9B, 0xAA, 0x4B, 0x52, 0x7A, 0xB6, 0xFC, 0x06, 0x04, 0x79, 0xF5, 0x63,
-    0x7D, 0xA5, 0x39, 0x78, 0x4B, 0x9D, 0x97, 0xE8, 0xAA, 0xEC, 0x77, 0x58, 0x82, 0x9F, 0x26, 0xE3,
-    0x9A, 0x79, 0x59, 0xB5, 0x87, 0x53, 0xCE, 0x80, 0x43, 0xB3, 0xE7, 0xF9, 0x18, 0x95, 0x1F, 0x2D,
-    0xDF, 0x13, 0xF9, 0x42, 0xE4, 0x3F, 0xB7, 0xB7, 0x34, 0xAC, 0x71, 0x4D, 0x3D, 0xEB, 0x98, 0x4C,
-    0x21, 0xB2, 0xA8, 0x6A, 0x70, 0xE8, 0x81, 0xB7, 0xB6, 0xC7, 0x64, 0x2C, 0x23, 0x0C, 0xCD, 0x4F,
-    0x96, 0xFF, 0xA5, 0xB8, 0x60, 0x4D, 0xFB, 0x41, 0xC7, 0xE8, 0x1E, 0x70, 0xD0, 0x3D, 0xFA, 0x76,
-    0xCB, 0xAC, 0x7F, 0x60, 0x7E, 0x66, 0xF7, 0xC6, 0x5C, 0xFA, 0x18, 0x26, 0x5B, 0x1D, 0x43, 0x74,
-    0xEA, 0xBF, 0x98, 0x49, 0xC8, 0xCD, 0xFD, 0xE8, 0x2F, 0x85, 0x6F, 0xF5, 0x16, 0xFA, 0x1C, 0xCD,
-    0x07, 0xE5, 0xDE, 0x60, 0xA5, 0x4B, 0x40, 0xEB, 0xFA, 0xBC, 0x3C, 0x4F, 0xF4, 0x55, 0xC2, 0xB0,
-    0x1E, 0xA7, 0x19, 0xB6, 0x31, 0x8F, 0x5C, 0x8F, 0x14, 0x80, 0x9B, 0x6B, 0x87, 0xD7, 0x80, 0x4D,
-    0xC2, 0xCE, 0x64, 0x0B, 0x73, 0x09, 0xDA, 0xA3, 0xC1, 0xC4, 0xC2, 0xF7, 0x61, 0x47, 0xED, 0x17,
-    0x2E, 0xAB, 0x39, 0x0D, 0xDC, 0xDC, 0xE7, 0xDB, 0x0E, 0x36, 0x69, 0x20, 0x5F, 0xB6, 0x5B, 0x7A,
-    0x4B, 0xA0, 0x1D, 0x9B, 0x69, 0x15, 0x80, 0x9A, 0x17, 0xBA, 0x1C, 0x1E, 0xC1, 0x14, 0xBD, 0xC5,
-    0x98, 0x2B, 0x5E, 0x4A, 0xB5, 0xB7, 0xEF, 0xEE, 0x29, 0xD0, 0x55, 0x32, 0xA0, 0xB3, 0x1C, 0x9C,
-    0x2F, 0xAA, 0x5F, 0x80, 0x40, 0xC7, 0x97, 0x07, 0xBE, 0xDE, 0xB2, 0x83, 0x05, 0x7A, 0x7B, 0x92,
-    0x47, 0xE9, 0x64, 0x7C, 0x5F, 0xE7, 0x65, 0x0A, 0x7D, 0xF7, 0xB3, 0xAE, 0xA0, 0x17, 0x7B, 0xEA,
-    0xE2, 0x48, 0x3F, 0x03, 0xB5, 0xD2, 0xF1, 0x49, 0x73, 0x08, 0x56, 0x8B, 0xFC, 0xB2, 0x33, 0x72,
-    0x7E, 0x88, 0xB0, 0x36, 0x49, 0xB7, 0x32, 0x42, 0x03, 0x55, 0x69, 0xDA, 0xCB, 0xC2, 0x5E, 0xC3,
-    0xBF, 0x67, 0x9F, 0xA4, 0x5A, 0xCC, 0x31, 0x31, 0xF5, 0xA6, 0xFE, 0x8D, 0x92, 0x01, 0xF7, 0x0B,
-    0x62, 0x45, 0x57, 0x1B, 0x1A, 0x3D, 0x82, 0x34, 0x60, 0x03, 0xE5, 0x57, 0xFA, 0xA4, 0xCB, 0xEB,
-    0x2D, 0x2F, 0x19, 0xD4, 0x08, 0x50, 0x10, 0x27, 0xF0, 0x83, 0x55, 0x81, 0xE4, 0xFC, 0x88, 0x4C,
-    0xA7, 0x1E, 0xD1, 0xE1, 0xF4, 0xB3, 0xAD, 0x00, 0xB5, 0x14, 0x63, 0xCF, 0x77, 0x76, 0xE1, 0xD6,
-    0xBC, 0x86, 0xE7, 0x54, 0x9F, 0x74, 0xC7, 0xAE, 0x2A, 0xCD, 0xA9, 0xAA, 0x27, 0x71, 0x80, 0x9C,
-    0xA4, 0x0D, 0xAA, 0xAD, 0xFA, 0x18, 0x8C, 0xE9, 0xCB, 0x9A, 0x2E, 0x67, 0x20, 0x8B, 0xB2, 0xB6,
-    0x5D, 0x3C, 0x42, 0x1D, 0x97, 0xBB, 0x52, 0x00, 0x87, 0xB6, 0xA6, 0xFC, 0x64, 0x20, 0x10, 0xA6,
-    0x83, 0xA9, 0x37, 0xF0, 0x91, 0x81, 0xB3, 0xE2, 0x29, 0xA3, 0x66, 0xAC, 0x80, 0x55, 0x23, 0xC1,
-    0x4D, 0x36, 0x40, 0x6B, 0x49, 0x0D, 0x7B, 0x46, 0x2C, 0xCC, 0x0E, 0x8D, 0x06, 0xEC, 0x0E, 0x58,
-    0x06, 0x64, 0xD0, 0xCD, 0xC1, 0x1A, 0x35, 0xA0, 0x2B, 0x5C, 0x0A, 0xFE, 0x92, 0xED, 0x2B, 0x7D,
-    0x7A, 0xF4, 0x41, 0xDE, 0x57, 0x8B, 0xBC, 0xCF, 0xDB, 0x0C, 0x82, 0x91, 0x41, 0x9F, 0x62, 0xC4,
-    0xEA, 0x3C, 0x44, 0x7C, 0x8F, 0xCC, 0x21, 0x93, 0xD4, 0xD9, 0x05, 0x5F, 0x7A, 0xA9, 0x21, 0x4D,
-    0x68, 0x01, 0xB9, 0xC1, 0x2B, 0x5D, 0x0E, 0x24, 0x46, 0x7D, 0x7A, 0x08, 0x45, 0x12, 0xB0, 0x36,
-    0xA4, 0x5A, 0xE5, 0xCE, 0xB0, 0x73, 0x94, 0x16, 0x9A, 0x76, 0x42, 0xD3, 0x29, 0x81, 0x20, 0x85,
-    0x8E, 0xFE, 0xFF, 0x1B, 0x62, 0xF2, 0x3F, 0x41, 0x34, 0xEF, 0x68, 0xEF, 0x0B, 0xF4, 0xDE, 0x13,
-    0x5F, 0x98, 0xC4, 0xD9, 0xCE, 0xB7, 0x58, 0x94, 0x4D, 0xDE, 0x26, 0x23, 0x7A, 0x17, 0x6A, 0xEB,
-    0x81, 0x3C, 0x02, 0xCE, 0x40, 0x9D, 0x14, 0x94, 0xC5, 0x0A, 0xF6, 0xC5, 0xC7, 0xC2, 0x25, 0x4F,
-    0xF8, 0x73, 0x6B, 0xF9, 0x6B, 0x18, 0x32, 0xD8, 0x8E, 0xEB, 0x34, 0x92, 0xDB, 0x05, 0x44, 0x9B,
-    0x42, 0x9A, 0xD7, 0x8A, 0xA6, 0xA9, 0x65, 0xDA, 0x27, 0x2F, 0xC8, 0xEC, 0xE4, 0x69, 0x67, 0xE5,
-    0x96, 0xBF, 0x9B, 0xA7, 0xC3, 0x58, 0xCB, 0x0A, 0x78, 0x8E, 0x8A, 0x8C, 0x08, 0x7F, 0x7E, 0xEE,
-    0xF1, 0xEE, 0x83, 0xD4, 0xD4, 0xA1, 0xBE, 0x62, 0x4C, 0x35, 0xDB, 0x1D, 0x6C, 0xB0, 0x59, 0xD6,
-    0xE9, 0xD7, 0x90, 0xEC, 0xB7, 0xC6, 0x60, 0xCC, 0xBB, 0xA4, 0xAD, 0xEA, 0x9C, 0xA0, 0x8D, 0x03,
-    0xD2, 0x39, 0xAD, 0x6A, 0xF3, 0xA8, 0xEA, 0x72, 0xF9, 0x1A, 0xE6, 0x03, 0xF6, 0xF4, 0x7E, 0x4E,
-    0xD0, 0x06, 0x7B, 0x43, 0x65, 0xFF, 0x34, 0xC8, 0xF9, 0xCB, 0xEE, 0xEF, 0x9F, 0xC4, 0x9A, 0xA4,
-    0x7E, 0x2B, 0x3C, 0x64, 0x05, 0xAA, 0x64, 0x4C, 0x07, 0xC0, 0xCB, 0xB7, 0xC6, 0xB8, 0x7B, 0xF4,
-    0xEA, 0x3C, 0x64, 0x20, 0x67, 0xBF, 0x1A, 0xE5, 0xE2, 0x6D, 0x67, 0xCF, 0x3E, 0x70, 0x26, 0x14,
-    0x9D, 0xFB, 0x5F, 0x05, 0xF6, 0x5F, 0xC7, 0xE8, 0x9C, 0xFE, 0xA6, 0x0C, 0x3F, 0x70, 0x06, 0xA3,
-    0xF7, 0xBB, 0xFE, 0xFA, 0x68, 0x5B, 0x4C, 0x89, 0x91, 0xA2, 0xD5, 0x65, 0x74, 0x53, 0x61, 0x6F,
-    0x55, 0x0B, 0xC8, 0xE9, 0xD1, 0x5B, 0x6C, 0x33, 0x60, 0x13, 0x6C, 0xE2, 0x86, 0x45, 0x4B, 0x23,
-    0xEE, 0xBE, 0xDF, 0x76, 0x06, 0x9D, 0x0C, 0x2A, 0x2A, 0x03, 0x0C, 0xD3, 0x34, 0x81, 0x9A, 0x99,
-    0x95, 0x9B, 0x55, 0xF6, 0xD8, 0x61, 0x98, 0x4F, 0x34, 0x42, 0x5F, 0xA3, 0x10, 0x2D, 0x16, 0x2C,
-    0x1A, 0x14, 0x65, 0x87, 0xE2, 0x5C, 0x8F, 0xE2, 0xB5, 0x11, 0xC5, 0x9B, 0x0E, 0xC5, 0x1B, 0x82,
-    0x62, 0x21, 0x97, 0x51, 0x94, 0xD7, 0x50, 0xD8, 0xDB, 0x28, 0xB2, 0x6F, 0x51, 0x24, 0x82, 0x22,
-    0x62, 0x11, 0xB2, 0x30, 0x5A, 0x94, 0x2C, 0x48, 0xE9, 0x46, 0xA1, 0x01, 0x58, 0x2C, 0x5A, 0xC8,
-    0x1C, 0x51, 0x33, 0xC3, 0x71, 0x63, 0xDF, 0x90, 0x46, 0x2C, 0x91, 0x89, 0x7C, 0x2E, 0xBF, 0x92,
-    0x4A, 0xA3, 0x98, 0x89, 0x10, 0xF6, 0x11, 0xF4, 0x11, 0xF2, 0x2D, 0xE2, 0x07, 0x54, 0xEB, 0x17,
-    0x38, 0xFF, 0xC3, 0x8F, 0xA6, 0x3B, 0xA8, 0xFA, 0x02, 0x3E, 0x0E, 0x69, 0xFF, 0x66, 0x8F, 0x3D,
-    0x1A, 0xF2, 0x29, 0xBD, 0x2D, 0x8E, 0x38, 0x19, 0x30, 0x79, 0x9F, 0x40, 0x05, 0x7A, 0xFB, 0xE1,
-    0x44, 0xCC, 0xD5, 0x83, 0x21, 0xB8, 0x43, 0x19, 0xA6, 0x86, 0xDB, 0xC2, 0x78, 0x0A, 0xCD, 0x07,
-    0xE3, 0xCD, 0xA8, 0xD3, 0xEC, 0x7C, 0x36, 0xAE, 0x52, 0x6F, 0xAA, 0xAA, 0xB7, 0x5F, 0x34, 0x23,
-    0x19, 0x1D, 0xB0, 0x0B, 0xB4, 0xBE, 0x82, 0x0D, 0x20, 0x0B, 0x15, 0x66, 0x9F, 0x9F, 0x7B, 0x26,
-    0x46, 0x52, 0xD7, 0xFB, 0xC0, 0xB8, 0x7A, 0x64, 0x3E, 0x89, 0x63, 0x88, 0xA2, 0x40, 0x97, 0x3D,
-    0x23, 0xB5, 0x7D, 0xF5, 0x0E, 0x00, 0xDA, 0xA6, 0x25, 0x6C, 0x8F, 0xE4, 0x53, 0x06, 0x80, 0x7D,
-    0xFE, 0x90, 0x12, 0x65, 0x1B, 0x02, 0xB9, 0x51, 0x6F, 0xEB, 0xC7, 0xBE, 0x3D, 0xB2, 0x66, 0xF7,
-    0x2C, 0x57, 0xC5, 0xE5, 0xDA, 0x19, 0x50, 0x9C, 0x9D, 0x50, 0x9C, 0x11, 0x5D, 0x2E, 0xAE, 0x94,
-    0x70, 0xA5, 0xCA, 0xAF, 0x51, 0xE4, 0x0E, 0x45, 0x7A, 0xBF, 0x95, 0xB2, 0x2C, 0x32, 0x16, 0x29,
-    0x0B, 0xF2, 0xF3, 0xB0, 0x58, 0xDB, 0x19, 0x88, 0x90, 0xE8, 0x7C, 0x53, 0xEB, 0x64, 0x87, 0x89,
-    0x90, 0xE3, 0xC2, 0xB3, 0x73, 0x28, 0x3C, 0xB4, 0x6A, 0x89, 0x26, 0x4E, 0x87, 0x07, 0x55, 0x0F,
-    0x55, 0x2C, 0xF6, 0x58, 0x78, 0x71, 0x80, 0x88, 0x60, 0x81, 0x98, 0x92, 0x6A, 0xCC, 0x0F, 0x96,
-    0xEF, 0x6B, 0x54, 0xAC, 0x60, 0x48, 0x92, 0x69, 0x8A, 0x83, 0x94, 0x6E, 0xC8, 0x00, 0x63, 0x42,
-    0xE7, 0x2A, 0xF1, 0x79, 0x86, 0x5B, 0x42, 0xCF, 0x2E, 0x96, 0x90, 0x8C, 0x6D, 0x21, 0x60, 0xE9,
-    0xC8, 0xFD, 0x2A, 0x8C, 0x11, 0x94, 0x9F, 0x31, 0x08, 0xFF, 0x0D, 0xBA, 0x89, 0xA7, 0x92, 0xE1,
-    0x9A, 0x73, 0x7C, 0x08, 0x20, 0x46, 0x5F, 0x9C, 0x2D, 0xE1, 0x95, 0xC7, 0x4E, 0x5F, 0x37, 0x95,
-    0xDB, 0xD1, 0xF4, 0x25, 0x9E, 0x57, 0x34, 0xC9, 0xA7, 0xC4, 0x15, 0x7E, 0x93, 0x04, 0xCB, 0x25,
-    0x96, 0x4A, 0x6A, 0x5E, 0xAB, 0xC4, 0x2E, 0x83, 0x4F, 0x90, 0x95, 0x46, 0x63, 0x69, 0x43, 0x36,
-    0xD2, 0xB7, 0x06, 0x26, 0x71, 0x95, 0x5E, 0xA1, 0xF8, 0x2B, 0x72, 0x7C, 0xC6, 0xFF, 0xD8, 0x86,
-    0xE9, 0x42, 0xBE, 0xA3, 0x19, 0x0C, 0x5A, 0x31, 0xCD, 0x8E, 0x25, 0x75, 0xC2, 0x99, 0x79, 0x37,
-    0xBB, 0x23, 0x81, 0x2A, 0x4B, 0xC5, 0x61, 0x68, 0xA5, 0x35, 0x7E, 0x46, 0x8C, 0xCF, 0xE1, 0xDD,
-    0x8B, 0xC0, 0x92, 0x3D, 0xF0, 0x5A, 0x0E, 0x94, 0xE4, 0xA8, 0x28, 0xE5, 0x32, 0x09, 0xFA, 0xF3,
-    0x3D, 0x54, 0x1E, 0x21, 0x5D, 0xD7, 0x43, 0x5B, 0xEE, 0x52, 0x95, 0xB7, 0xFA, 0x7A, 0x22, 0xFF,
-    0xA7, 0x89, 0x4D, 0x45, 0xA0, 0x4C, 0x1B, 0xEF, 0x30, 0x12, 0xA1, 0xA1, 0x08, 0x0C, 0xBE, 0x19,
-    0xB5, 0x51, 0x17, 0xFA, 0x30, 0x13, 0x3C, 0x72, 0x77, 0x24, 0xF8, 0x7C, 0x02, 0x84, 0x07, 0x5B,
-    0x1B, 0x6A, 0xC3, 0x31, 0x59, 0x47, 0xAD, 0xEA, 0xA8, 0x3B, 0x3E, 0x24, 0x5C, 0x5B, 0xFF, 0x8B,
-    0x12, 0x6E, 0xB6, 0x01, 0xC2, 0x25, 0xEB, 0x98, 0x69, 0x8E, 0x3B, 0x58, 0xC9, 0x8F, 0x06, 0xB3,
-    0x76, 0x92, 0x84, 0xAF, 0x50, 0x2A, 0xA3, 0x21, 0x5A, 0x8A, 0x0F, 0x26, 0x38, 0xCA, 0x31, 0x2A,
-    0x42, 0xA5, 0x00, 0x9C, 0xE9, 0x73, 0x5E, 0x8A, 0xA6, 0xB9, 0xFD, 0x5B, 0x62, 0xF1, 0x88, 0x21,
-    0xF8, 0x86, 0xFE, 0xFF, 0xC7, 0x1A, 0xC7, 0x1D, 0x7D, 0xE5, 0xF2, 0x74, 0xB4, 0x99, 0x7F, 0xC7,
-    0x77, 0x00, 0x60, 0x1C, 0xE9, 0x66, 0x79, 0xA7, 0xBA, 0xBB, 0xBC, 0xE0, 0xC7, 0x99, 0x07, 0x0D,
-    0x7C, 0xE5, 0x20, 0xCF, 0xE9, 0x77, 0x16, 0xFC, 0xD9, 0x96, 0xE9, 0x1D, 0x1F, 0xF3, 0xE5, 0x69,
-    0x87, 0xFC, 0xCE, 0x0E, 0xD4, 0x58, 0x2B, 0x8B, 0x0C, 0xCA, 0x07, 0x00, 0x1E, 0x08, 0x54, 0x72,
-    0xC6, 0x21, 0x80, 0x40, 0xB8, 0x1F, 0xE4, 0x5B, 0xD1, 0x7D, 0x78, 0x5D, 0xD5, 0x14, 0xFD, 0x0C,
-    0xD1, 0xE0, 0x31, 0xB3, 0xB1, 0xA6, 0xBA, 0x51, 0x41, 0x5D, 0x16, 0xDA, 0x13, 0xD3, 0x3C, 0xDF,
-    0x61, 0x35, 0xB0, 0x12, 0x54, 0xA2, 0x14, 0xFC, 0xB5, 0x39, 0x11, 0x7D, 0x98, 0x63, 0x24, 0x2C,
-    0xA7, 0x24, 0xAC, 0x62, 0xC9, 0xB1, 0xDC, 0x2D, 0x54, 0x02, 0x12, 0x0D, 0x97, 0xDD, 0x82, 0xE3,
-    0x06, 0xD7, 0xA1, 0xAE, 0x6A, 0xE0, 0x62, 0xC6, 0x71, 0xE6, 0x1B, 0x59, 0x54, 0x9F, 0x56, 0x60,
-    0xAB, 0x4C, 0x9A, 0x92, 0xF2, 0xB9, 0xA9, 0x8F, 0xA4, 0x98, 0x5B, 0xD9, 0x96, 0xC7, 0x03, 0x8A,
-    0xAA, 0x4E, 0x59, 0x2F, 0x5B, 0xFA, 0x9F, 0x3C, 0xF6, 0x30, 0x9A, 0xB5, 0x2D, 0x02, 0x6B, 0x48,
-    0xA1, 0x14, 0x50, 0x73, 0x7E, 0x54, 0x07, 0xD7, 0x33, 0x1F, 0x60, 0x09, 0x98, 0xDB, 0xEF, 0x49,
-    0x0E, 0x7D, 0xB2, 0x07, 0x7F, 0x4B, 0x79, 0xCF, 0x8B, 0x11, 0xA3, 0x79, 0x09, 0x64, 0x14, 0x03,
-    0x65, 0xC7, 0xA6, 0xC7, 0x9B, 0x74, 0x48, 0xA6, 0xD7, 0x65, 0x95, 0x90, 0xF4, 0xA9, 0xB3, 0x64,
-    0x84, 0x8A, 0xF2, 0xAD, 0x08, 0xF8, 0xEB, 0xBC, 0x27, 0x2D, 0xA8, 0x6B, 0xCA, 0xCE, 0x12, 0xFE,
-    0xDD, 0xEB, 0xD9, 0xA8, 0x99, 0x99, 0x56, 0x46, 0x66, 0x73, 0xC6, 0x22, 0xCE, 0x5E, 0x71, 0x76,
-    0x0F, 0x1E, 0xF8, 0x64, 0x27, 0x72, 0xC8, 0x8B, 0xC2, 0x83, 0xBE, 0xFE, 0x93, 0xB5, 0xEC, 0x23,
-    0x5F, 0xD0, 0x47, 0x99, 0x33, 0xB4, 0x80, 0x07, 0x6A, 0x86, 0x17, 0xDE, 0x56, 0x13, 0x3F, 0xCC,
-    0x69, 0xDA, 0xE7, 0xCD, 0x88, 0x75, 0xB3, 0x96, 0xB6, 0xD9, 0x55, 0xA8, 0x82, 0x8C, 0x11, 0xD2,
-    0x76, 0xCE, 0x4A, 0x83, 0x15, 0xA0, 0x2C, 0xDD, 0x97, 0x57, 0xB1, 0x6C, 0x8C, 0x5B, 0x74, 0x8F,
-    0xF6, 0x3D, 0xCD, 0xEC, 0x27, 0xA5, 0x07, 0x7E, 0x92, 0x0F, 0x56, 0x62, 0x32, 0x2D, 0xE6, 0xF3,
-    0xBF, 0x0C, 0x93, 0xDE, 0xAD, 0xB0, 0x81, 0xD6, 0xE7, 0xF4, 0x89, 0xE6, 0xD8, 0xF1, 0x3A, 0x2E,
-    0x4B, 0x97, 0x93, 0x2C, 0x65, 0xB2, 0xB5, 0x55, 0x3F, 0x20, 0xBB, 0xCB, 0x73, 0x37, 0x6F, 0x13,
-    0x72, 0x33, 0x3D, 0x12, 0xD2, 0x22, 0x71, 0xCF, 0x60, 0x61, 0x02, 0xF2, 0xBF, 0xD0, 0xEF, 0x2A,
-    0x80, 0xFB, 0x8A, 0xDC, 0xC8, 0x35, 0x47, 0xF6, 0xD6, 0x10, 0xEC, 0xD2, 0x90, 0xF5, 0xB4, 0x69,
-    0x4C, 0xDF, 0xF1, 0x0C, 0x49, 0xEE, 0xF3, 0xDB, 0xE9, 0xB7, 0x4D, 0x4C, 0xF8, 0x8E, 0x96, 0x67,
-    0xB0, 0x48, 0x94, 0x3A, 0x6C, 0x82, 0x44, 0xD0, 0x21, 0x16, 0xE5, 0x37, 0x6D, 0xD6, 0xD8, 0xC5,
-    0x1C, 0xE3, 0x3C, 0xD9, 0x39, 0x6F, 0x6B, 0x2C, 0x17, 0xB0, 0x01, 0x83, 0x94, 0xC5, 0xCA, 0xC9,
-    0x7F, 0xDA, 0x39, 0x9F, 0xE8, 0xF4, 0xAC, 0x4F, 0x2E, 0xF0, 0x6C, 0x81, 0x35, 0xC1, 0xEB, 0x1D,
-    0x21, 0x86, 0x1E, 0x30, 0xC0, 0x4A, 0x57, 0xEE, 0xC7, 0x9A, 0xD0, 0x1B, 0xAA, 0xC5, 0xDF, 0xC0,
-    0x41, 0x48, 0xB8, 0xE0, 0x13, 0x80, 0x48, 0xCF, 0xE3, 0x46, 0x34, 0x96, 0x3C, 0x8D, 0x20, 0xFF,
-    0x6E, 0x4A, 0x74, 0xF8, 0x35, 0x36, 0x2D, 0x53, 0x70, 0x79, 0xC1, 0xF4, 0x40, 0x00, 0x34, 0x9A,
-    0x36, 0xE6, 0xD7, 0x3D, 0x65, 0x19, 0x02, 0xB1, 0x66, 0x82, 0xD3, 0x53, 0x38, 0xC6, 0x83, 0x14,
-    0xC4, 0x31, 0xD5, 0xB0, 0x92, 0xEF, 0x13, 0x5D, 0xE7, 0x07, 0x08, 0xF3, 0x53, 0xAE, 0x33, 0x23,
-    0xC8, 0x8C, 0x25, 0xF3, 0x50, 0xD1, 0x37, 0x6A, 0xB3, 0xE8, 0xB9, 0xF9, 0x13, 0x19, 0x8B, 0xF9,
-    0x00, 0xC6, 0xD3, 0x3D, 0x30, 0x44, 0xAF, 0x97, 0x0A, 0x1F, 0xB2, 0x30, 0x97, 0x8C, 0xF9, 0x2B,
-    0xE2, 0x3E, 0x6A, 0x1C, 0xAA, 0xE1, 0x75, 0xA6, 0x2E, 0xE1, 0x2B, 0x84, 0x34, 0x92, 0x80, 0x77,
-    0xAE, 0x14, 0xF7, 0xCA, 0xB4, 0xC5, 0x23, 0x03, 0xDF, 0xFB, 0x46, 0x44, 0xB7, 0xFF, 0x1A, 0x09,
-    0x34, 0xBB, 0x63, 0x0C, 0x2D, 0x6E, 0xB8, 0xFA, 0xA7, 0x46, 0xF6, 0xFA, 0xB7, 0x8E, 0x8B, 0x6F,
-    0x5B, 0x3D, 0xAE, 0xE1, 0xE0, 0xC8, 0xA5, 0x5F, 0x73, 0xCB, 0x3A, 0x42, 0xC9, 0x03, 0xFD, 0x42,
-    0x6B, 0xC4, 0x2C, 0xBE, 0x9C, 0x9B, 0x29, 0xED, 0x9E, 0x85, 0xB0, 0x63, 0x0F, 0x66, 0x6D, 0xD7,
-    0x68, 0x54, 0x68, 0x33, 0xEA, 0x41, 0x15, 0x76, 0x99, 0xF9, 0x3B, 0x1E, 0x7A, 0x52, 0x34, 0x6A,
-    0x15, 0xCE, 0xCB, 0x22, 0xA8, 0x3E, 0x2D, 0xFC, 0xE1, 0x96, 0xD1, 0x87, 0xDC, 0x34, 0x0D, 0x7A,
-    0xEC, 0x01, 0x93, 0x33, 0xE9, 0xB4, 0x0E, 0x62, 0xA9, 0x59, 0x98, 0x12, 0x21, 0x42, 0x59, 0x33,
-    0xDF, 0x63, 0xD2, 0x74, 0xDF, 0x89, 0x05, 0xE4, 0x1E, 0x9A, 0x72, 0xB8, 0x3A, 0xBC, 0xE8, 0xDE,
-    0x7D, 0x1C, 0x26, 0x3D, 0x94, 0x0F, 0xC0, 0xDA, 0xFE, 0x7B, 0x7F, 0x3E, 0xCC, 0x80, 0x23, 0xE9,
-    0x53, 0x08, 0xEA, 0x7E, 0xE7, 0x0F, 0x6E, 0x7C, 0x84, 0xEE, 0x5F, 0x36, 0x73, 0xEC, 0x08, 0x4A,
-    0x72, 0x3A, 0x7A, 0xEE, 0xE5, 0xC9, 0x6E, 0x6E, 0xEA, 0xC1, 0x12, 0xEC, 0x8B, 0x6B, 0x42, 0x28,
-    0xED, 0x5E, 0xE7, 0xB9, 0x0D, 0x85, 0x0E, 0x98, 0x8E, 0x86, 0x02, 0x56, 0x76, 0xBC, 0x4F, 0x8B,
-    0xD2, 0x7D, 0xC8, 0x14, 0x46, 0x8A, 0x9D, 0xB3, 0xEE, 0x87, 0xB7, 0x4D, 0xE8, 0x28, 0xFD, 0x13,
-    0xF8, 0xC0, 0xCD, 0xDC, 0x84, 0x72, 0x9F, 0x2A, 0x23, 0xDD, 0xB0, 0x35, 0x7B, 0x00, 0x22, 0xA5,
-    0x6E, 0xB4, 0xCF, 0xBB, 0x6A, 0xCC, 0xEB, 0x97, 0xD0, 0xC1, 0x4F, 0x96, 0x17, 0xFC, 0xB1, 0x4F,
-    0x0A, 0xCC, 0xDA, 0x7C, 0xAE, 0xE3, 0x45, 0xD0, 0x14, 0x2E, 0x97, 0x60, 0xE2, 0x84, 0x05, 0xED,
-    0x67, 0x7F, 0x00, 0xF0, 0x2C, 0xDF, 0x7B, 0x30, 0x11, 0xAB, 0x6A, 0x4B, 0xF7, 0x32, 0x73, 0xF2,
-    0x8E, 0xE6, 0x8D, 0xAE, 0x00, 0x69, 0x25, 0xB2, 0x3B, 0xEA, 0x72, 0x70, 0x7F, 0xA4, 0x45, 0x0A,
-    0x9B, 0xB2, 0xC7, 0xA8, 0x8B, 0x33, 0x1A, 0x76, 0x59, 0x1D, 0x9F, 0x7B, 0x11, 0x54, 0x01, 0x03,
-    0x14, 0xB9, 0xC9, 0x4D, 0xB9, 0x47, 0x0F, 0xAE, 0xA6, 0x7E, 0x9C, 0x87, 0x7F, 0x66, 0x4E, 0xA9,
-    0xC1, 0xA0, 0x1F, 0x97, 0x33, 0x40, 0xD0, 0x60, 0x53, 0xFD, 0x73, 0x8A, 0x65, 0x84, 0x4C, 0xFA,
-    0x5C, 0xF2, 0x4B, 0x2F, 0x8E, 0x4A, 0xB5, 0x7A, 0xF4, 0xFD, 0xF6, 0x6A, 0xF3, 0x4F, 0x99, 0x31,
-    0xDD, 0x4F, 0x4D, 0xB4, 0xDF, 0xFA, 0xF3, 0xA0, 0x2A, 0x96, 0xCF, 0xCE, 0xCA, 0x8D, 0xD3, 0x5B,
-    0xD8, 0x8E, 0xD0, 0xA2, 0x02, 0x94, 0x95, 0x5F, 0x86, 0xB7, 0xD2, 0x7E, 0x88, 0x9D, 0xFC, 0x02,
-    0x59, 0x69, 0xB6, 0x37, 0x8A, 0x74, 0x80, 0xA5, 0x3F, 0xDF, 0x47, 0x7D, 0x69, 0xEC, 0xAB, 0xD0,
-    0x7D, 0x27, 0xC3, 0x4A, 0xD8, 0x88, 0xFC, 0xFA, 0x53, 0x4D, 0x5C, 0x6F, 0x98, 0xE2, 0xBC, 0x39,
-    0xD1, 0x33, 0xEB, 0xE8, 0x93, 0x7D, 0x59, 0x0D, 0xE9, 0x7C, 0x54, 0xB7, 0xC6, 0x6E, 0x62, 0xE4,
-    0x88, 0xE2, 0x90, 0x41, 0x03, 0x86, 0xDD, 0x1C, 0x40, 0x0F, 0x1D, 0xBD, 0x82, 0x51, 0x43, 0x81,
-    0x98, 0xDB, 0xFE, 0xC3, 0x67, 0x3E, 0xA9, 0x52, 0xE7, 0x39, 0x6D, 0xA9, 0xBE, 0xAC, 0x98, 0xA3,
-    0x05, 0x26, 0x28, 0x77, 0xA5, 0xAB, 0xCC, 0xCB, 0xB0, 0x4B, 0x3C, 0xEC, 0xCB, 0x00, 0x95, 0x1E,
-    0xC7, 0x1D, 0xFD, 0xB1, 0x9C, 0xFF, 0x28, 0x0E, 0x63, 0x52, 0xD2, 0xAD, 0x5C, 0x3D, 0xFD, 0x39,
-    0xA7, 0x11, 0xE8, 0xF2, 0xB4, 0xC6, 0x1F, 0x57, 0x79, 0x6F, 0xF5, 0x95, 0x26, 0xD5, 0xB6, 0x60,
-    0x32, 0x60, 0x60, 0xC0, 0xE3, 0x67, 0x80, 0x56, 0xD5, 0x9B, 0xA3, 0x1A, 0xBB, 0x46, 0x0A, 0xEC,
-    0xDD, 0xB4, 0xCB, 0xE1, 0x06, 0xB5, 0x31, 0x94, 0x73, 0xE8, 0xF0, 0x05, 0x4C, 0x74, 0x15, 0xE0,
-    0xA2, 0x6D, 0xEC, 0xB9, 0xC6, 0xD6, 0xC9, 0x90, 0x5D, 0x1B, 0xB2, 0x2E, 0x90, 0xA4, 0x63, 0x0A,
-    0xC1, 0x5E, 0x1E, 0x73, 0x78, 0x72, 0x69, 0xE7, 0xE2, 0x5E, 0xF4, 0x58, 0x8B, 0x83, 0xB9, 0x29,
-    0x2F, 0xD6, 0xF6, 0x73, 0x05, 0x20, 0xC9, 0x7E, 0x0F, 0x19, 0xED, 0x89, 0x11, 0x19, 0x87, 0x65,
-    0x4A, 0x1C, 0x06, 0x34, 0x15, 0x9A, 0x6C, 0xA0, 0xA0, 0x46, 0xB7, 0x97, 0x1E, 0x5A, 0x5E, 0x53,
-    0xE8, 0x18, 0x29, 0x7A, 0xD2, 0x33, 0x3A, 0x98, 0xA6, 0x9E, 0x0F, 0x1F, 0x34, 0x2F, 0xB2, 0x75,
-    0xE0, 0xF3, 0x61, 0x4A, 0x56, 0xCF, 0x09, 0xA5, 0x13, 0x0F, 0xC2, 0x27, 0xF0, 0xAE, 0x77, 0x1D,
-    0xDE, 0xC8, 0xDA, 0xB2, 0x9E, 0x46, 0x9E, 0x85, 0x2F, 0x6D, 0x34, 0x46, 0x53, 0x7E, 0xFE, 0x2A,
-    0x30, 0xFF, 0xF9, 0x3F, 0x02, 0x80, 0x65, 0xB7, 0xF1, 0xAC, 0x89, 0xC6, 0x31, 0xFD, 0x04, 0xFC,
-    0x2B, 0xA3, 0xEF, 0x06, 0x93, 0xED, 0x2D, 0x2E, 0xD1, 0x1D, 0x6D, 0x68, 0xCF, 0x29, 0x87, 0xF0,
-    0x2A, 0x46, 0x1E, 0xA8, 0x8A, 0x9D, 0x86, 0x77, 0x34, 0x9C, 0x9B, 0x8F, 0xF3, 0xD1, 0xF4, 0xEC,
-    0xE6, 0xC0, 0xE4, 0xF0, 0xA0, 0x27, 0x59, 0xBC, 0x97, 0xDF, 0x41, 0x05, 0x94, 0xF4, 0x4C, 0x18,
-    0x60, 0xC1, 0xFA, 0xA4, 0xBD, 0x1E, 0xBE, 0x8F, 0x26, 0x3D, 0x14, 0x89, 0xBF, 0xD3, 0x1E, 0xB4,
-    0xE4, 0xFB, 0xE3, 0x7C, 0x1E, 0xBC, 0x74, 0x33, 0x9F, 0x02, 0x99, 0x4F, 0x59, 0x6A, 0x3E, 0x4D,
-    0x8F, 0x27, 0x6A, 0x30, 0xEE, 0x3E, 0x8F, 0x78, 0x58, 0x82, 0x47, 0x09, 0x18, 0xCD, 0xE6, 0x49,
-    0x82, 0x68, 0x48, 0xDB, 0xD5, 0x41, 0x02, 0x46, 0xD6, 0xB0, 0x08, 0x7A, 0xAE, 0x9C, 0xA9, 0x73,
-    0x9E, 0x2A, 0xE7, 0xA1, 0xF2, 0x64, 0x08, 0x84, 0x21, 0xB7, 0x8F, 0xE0, 0xE1, 0xF6, 0x70, 0xBE,
-    0xC8, 0x0F, 0x32, 0x23, 0xE6, 0x79, 0x74, 0xB2, 0x81, 0x41, 0x11, 0x55, 0x1B, 0xEA, 0xF2, 0xCE,
-    0x47, 0x63, 0xE9, 0x77, 0x30, 0x9F, 0x48, 0x05, 0xCE, 0x58, 0x56, 0xAA, 0x27, 0x48, 0x7E, 0x16,
-    0x41, 0xC3, 0x60, 0x03, 0x81, 0xBF, 0x50, 0x80, 0x59, 0x31, 0x1C, 0xBA, 0x75, 0x7A, 0x02, 0x0F,
-    0x5E, 0x68, 0x3A, 0x58, 0xA6, 0x46, 0xB1, 0xBA, 0x13, 0x7D, 0xC1, 0x8E, 0xA7, 0xF4, 0x8B, 0x90,
-    0xFE, 0x51, 0xA4, 0x87, 0x48, 0x9D, 0xCC, 0x31, 0xD4, 0x4C, 0xF1, 0x81, 0xEE, 0x87, 0xF6, 0xC1,
-    0x14, 0xDF, 0xF3, 0x48, 0x41, 0x68, 0xDE, 0xFB, 0x39, 0x66, 0xF3, 0x99, 0xBC, 0x55, 0x40, 0x82,
-    0xE8, 0x8B, 0xD1, 0x01, 0x6E, 0xC5, 0xCB, 0x8C, 0x0E, 0xF8, 0x13, 0x2D, 0xB9, 0x27, 0x47, 0xDD,
-    0x73, 0x6A, 0x69, 0xE2, 0x6C, 0x02, 0x14, 0x3D, 0xAF, 0xCE, 0x31, 0x38, 0x11, 0xE5, 0x48, 0xE3,
-    0x01, 0x8B, 0xBD, 0xBB, 0xE4, 0xF9, 0x3B, 0x26, 0xDA, 0x09, 0xD8, 0xC5, 0x47, 0x59, 0x41, 0x9B,
-    0x26, 0x12, 0x0B, 0xE2, 0x27, 0xCF, 0x74, 0x1E, 0xA5, 0x07, 0xC4, 0xDD, 0xC5, 0xCF, 0xC6, 0x36,
-    0x05, 0x66, 0x06, 0xF1, 0x0B, 0xCD, 0x70, 0x8D, 0xDA, 0xBB, 0x6D, 0xFD, 0xDD, 0xDB, 0x5B, 0x56,
-    0x73, 0xC5, 0x70, 0x6F, 0xE7, 0x7C, 0x90, 0x86, 0x59, 0x79, 0x0C, 0x89, 0x13, 0x8C, 0xFA, 0x23,
-    0x31, 0xEE, 0xE7, 0x47, 0x87, 0x4F, 0xEA, 0x31, 0xC0, 0xC2, 0xE8, 0x4A, 0x7D, 0x10, 0x31, 0x79,
-    0x4A, 0x3A, 0x66, 0x34, 0xEC, 0xEE, 0x8B, 0x86, 0x9F, 0x1F, 0x1D, 0x70, 0x80, 0x0A, 0x60, 0xF0,
-    0x78, 0xA8, 0x8E, 0x3B, 0x40, 0x4F, 0xCF, 0x8F, 0x75, 0xA8, 0x4A, 0x0B, 0xDC, 0x3B, 0x56, 0xCD,
-    0x6B, 0x03, 0x1C, 0x87, 0xE4, 0x31, 0x0B, 0xF3, 0xFF, 0x8D, 0x54, 0x41, 0x8C, 0x14, 0x45, 0x14,
-    0xFD, 0x35, 0xCD, 0x6C, 0x23, 0xED, 0x6E, 0xAF, 0x66, 0x06, 0x21, 0xC4, 0x29, 0x0E, 0x1E, 0xC8,
-    0xC2, 0x6E, 0x73, 0xF0, 0xB0, 0x24, 0x3D, 0x53, 0x45, 0x4C, 0xF4, 0xB0, 0x07, 0xC6, 0x64, 0x47,
-    0x13, 0x49, 0x60, 0x0E, 0x5E, 0xDC, 0x08, 0xEC, 0x71, 0x4D, 0x66, 0xA6, 0x9B, 0x45, 0xC3, 0xC1,
-    0x83, 0x7B, 0xF3, 0x64, 0xE0, 0x62, 0x32, 0x8C, 0x41, 0x31, 0x59, 0x0D, 0xE8, 0xEE, 0x74, 0x2F,
-    0x98, 0x6C, 0x82, 0x07, 0x5B, 0x30, 0x4C, 0x22, 0xD1, 0xB4, 0x8A, 0x84, 0x64, 0x0F, 0x34, 0xA4,
-    0x89, 0x8D, 0x54, 0x77, 0xF9, 0x6B, 0x66, 0x21, 0x2C, 0x68, 0x62, 0x75, 0x65, 0xE6, 0xD7, 0xAF,
-    0xEA, 0xDF, 0xFF, 0xBF, 0xFF, 0x5E, 0x15, 0xB9, 0x29, 0xC0, 0x73, 0x8D, 0x04, 0x1C, 0x4E, 0xAA,
-    0x50, 0x03, 0xE9, 0x7B, 0xBE, 0xE3, 0x3A, 0x3C, 0x0F, 0x80, 0x2B, 0x4D, 0xBA, 0x86, 0x0C, 0xAD,
-    0xEB, 0xB1, 0x47, 0xD2, 0x69, 0x28, 0xA2, 0xCF, 0x08, 0x29, 0x93, 0x5D, 0x47, 0xA6, 0xE7, 0x69,
-    0x5C, 0x05, 0x3E, 0xD3, 0x39, 0x25, 0x71, 0xDC, 0xAB, 0xD5, 0xC6, 0x3A, 0x9D, 0x13, 0x52, 0x0A,
-    0x26, 0xE5, 0x4A, 0xAD, 0x36, 0x5D, 0x80, 0x62, 0x05, 0x2A, 0xEC, 0x41, 0x6A, 0xCA, 0x44, 0x93,
-    0x01, 0x14, 0x00, 0x34, 0xE1, 0xF4, 0x52, 0xCB, 0x05, 0x8B, 0xC4, 0xEC, 0x92, 0x60, 0x27, 0x04,
-    0x25, 0x31, 0x00, 0x8B, 0x98, 0x78, 0x5E, 0x80, 0x30, 0x12, 0x33, 0x18, 0x72, 0xF3, 0x9C, 0xC5,
-    0x5D, 0x11, 0x97, 0xE3, 0x72, 0x4B, 0x58, 0x31, 0xE1, 0x64, 0xBA, 0xC8, 0x9D, 0xEF, 0x13, 0xF3,
-    0x4E, 0x96, 0x13, 0xCC, 0x6D, 0x19, 0x01, 0xE1, 0x55, 0xC0, 0x44, 0x68, 0x60, 0x5D, 0x4C, 0x99,
-    0x6F, 0x49, 0x5F, 0x05, 0x2F, 0x56, 0xA1, 0xD0, 0xC4, 0xF1, 0xCE, 0x74, 0x51, 0xB0, 0xC1, 0xD3,
-    0x1E, 0x2B, 0xE6, 0xAB, 0xE6, 0xDD, 0x8C, 0xA4, 0x96, 0x4F, 0x2F, 0x26, 0x24, 0xB1, 0x78, 0x9E,
-    0x70, 0x68, 0x00, 0x48, 0x28, 0x64, 0x85, 0xF2, 0xAE, 0x86, 0xB5, 0x3F, 0x31, 0x65, 0xA4, 0x4B,
-    0x5F, 0xE5, 0x56, 0x03, 0x1D, 0xCB, 0x94, 0x09, 0xEB, 0x88, 0x06, 0x94, 0x0B, 0x50, 0xD0, 0xC3,
-    0x8C, 0x5E, 0x11, 0x6C, 0x35, 0xF1, 0x8E, 0x57, 0xE9, 0xEF, 0x99, 0x4A, 0xF8, 0xB5, 0xA8, 0x4B,
-    0xB8, 0x37, 0x95, 0xA0, 0x4D, 0xFD, 0xD4, 0x08, 0x0B, 0x8F, 0xFB, 0x8B, 0x0A, 0x47, 0x04, 0x2B,
-    0x06, 0x07, 0xF0, 0x3B, 0x35, 0x4E, 0x13, 0x2D, 0x05, 0xC9, 0x2D, 0x1F, 0x51, 0x05, 0x28, 0x6D,
-    0x5D, 0xCB, 0xDE, 0x08, 0x4B, 0xC0, 0xC1, 0xE0, 0x17, 0xA6, 0xB2, 0x0B, 0x07, 0xF9, 0x28, 0x7A,
-    0xBD, 0x6C, 0xE6, 0x73, 0x28, 0x3D, 0x7A, 0x40, 0x4B, 0x75, 0xC4, 0xC1, 0x89, 0xBC, 0xA0, 0x8B,
-    0xBB, 0x79, 0xB6, 0x1C, 0x9F, 0x77, 0x4A, 0x39, 0x57, 0xF3, 0x35, 0x7F, 0xF7, 0x2D, 0x26, 0x00,
-    0xC6, 0xDA, 0x4C, 0xA8, 0x95, 0xE6, 0xE3, 0x3E, 0xA8, 0x7F, 0x26, 0x76, 0xDF, 0xD2, 0xFC, 0x9C,
-    0x3B, 0xD6, 0x96, 0x11, 0x00, 0x69, 0x1B, 0x91, 0xE5, 0x7B, 0x39, 0x41, 0xFF, 0x92, 0xA7, 0x84,
-    0xE3, 0x9E, 0xD1, 0x12, 0x33, 0x64, 0x6E, 0xA6, 0xA5, 0x86, 0x3C, 0x90, 0xD2, 0x18, 0x10, 0xC5,
-    0xAB, 0x88, 0xC8, 0x86, 0x1E, 0x3C, 0x89, 0x39, 0xE4, 0x52, 0x76, 0x29, 0x66, 0x84, 0xEB, 0xBE,
-    0x19, 0x0E, 0x09, 0x48, 0xB7, 0x0A, 0x47, 0xB0, 0x90, 0x40, 0x52, 0x31, 0x7C, 0xEC, 0xA7, 0x13,
-    0x7D, 0x33, 0x40, 0x7B, 0xAC, 0xD3, 0x66, 0x52, 0xD8, 0x60, 0x4F, 0xC2, 0x1E, 0x9C, 0x05, 0x05,
-    0x24, 0xCC, 0xDA, 0xC3, 0xFB, 0xBA, 0x0D, 0xBA, 0x86, 0xAD, 0xC5, 0x46, 0xE5, 0xB1, 0x51, 0x2B,
-    0x99, 0x6A, 0x54, 0xB0, 0xDE, 0xA8, 0xC7, 0x49, 0xE5, 0xF4, 0x49, 0x85, 0x54, 0x69, 0x42, 0x93,
-    0xAD, 0x09, 0x2A, 0x63, 0x7D, 0x40, 0x95, 0xA7, 0xDA, 0xB1, 0x4E, 0xBC, 0xAC, 0xEB, 0x49, 0x91,
-    0x20, 0xF1, 0xC8, 0x63, 0xC4, 0xC3, 0x71, 0x18, 0xAD, 0x4E, 0xA7, 0x73, 0x1A, 0x4D, 0xE4, 0xDF,
-    0xCF, 0x68, 0x29, 0xF6, 0xF6, 0x17, 0xD7, 0x06, 0x8B, 0x5C, 0xAA, 0x5D, 0x92, 0x0F, 0xEE, 0x48,
-    0x19, 0x2F, 0xD1, 0x64, 0x13, 0x8C, 0xC2, 0x46, 0xBA, 0xF6, 0xA3, 0x1C, 0x54, 0x01, 0x33, 0x4F,
-    0xFD, 0xDE, 0xC4, 0x68, 0x9D, 0x33, 0x0A, 0x64, 0x98, 0x05, 0x2D, 0x01, 0x4B, 0x10, 0x19, 0x98,
-    0x19, 0xB0, 0x18, 0x28, 0x87, 0x4D, 0xB0, 0x3E, 0xB0, 0x25, 0xB8, 0xD4, 0x10, 0xF9, 0x0A, 0x26,
-    0x18, 0x3C, 0x74, 0xE4, 0x06, 0x0E, 0x7D, 0xDD, 0xE1, 0x3E, 0xE1, 0x30, 0x07, 0x0E, 0xF6, 0xA4,
-    0x63, 0x0C, 0x23, 0x56, 0x45, 0x8B, 0x4E, 0xA4, 0x8B, 0x2F, 0xC1, 0xB6, 0x01, 0xA8, 0xE5, 0x5A,
-    0x03, 0x31, 0x2E, 0xD6, 0xA6, 0x15, 0x5D, 0x64, 0xF6, 0x55, 0xED, 0xD0, 0x39, 0x18, 0xC1, 0x89,
-    0xF6, 0x4C, 0x3F, 0x41, 0x44, 0x7A, 0x5F, 0xEB, 0x5D, 0x44, 0x1D, 0xED, 0xD1, 0xA9, 0x43, 0xEC,
-    0x62, 0xEC, 0x5C, 0x1F, 0x41, 0xDB, 0x3A, 0x1F, 0x37, 0xC6, 0xCD, 0xA3, 0x09, 0xFC, 0x0B, 0x26,
-    0x6A, 0xD1, 0x27, 0xAC, 0xE7, 0xEB, 0x09, 0x30, 0xF7, 0x29, 0xE1, 0x23, 0x5E, 0xF7, 0xF5, 0x47,
-    0x78, 0xC5, 0x05, 0xC4, 0x6B, 0xC6, 0x10, 0xC7, 0x7C, 0x41, 0x39, 0x56, 0x77, 0x06, 0xF4, 0x1F,
-    0xE5, 0xE1, 0x57, 0x84, 0xF7, 0x51, 0x24, 0x95, 0x18, 0x0E, 0x04, 0x4D, 0x50, 0x2C, 0x2F, 0x42,
-    0xAA, 0xC5, 0x66, 0xC2, 0x22, 0x47, 0xD1, 0x53, 0x97, 0x32, 0x6D, 0x75, 0x3E, 0xEB, 0xB9, 0x30,
-    0x3E, 0x07, 0xB9, 0x6B, 0x1C, 0xB6, 0xFF, 0x47, 0x26, 0x1B, 0x44, 0x3B, 0x95, 0xCD, 0x84, 0x23,
-    0x10, 0xAA, 0x0A, 0xC8, 0x81, 0x4D, 0x34, 0xB5, 0xB1, 0xFA, 0x49, 0x2F, 0x1A, 0x0D, 0xB9, 0xCA,
-    0x0A, 0x79, 0x80, 0xCA, 0xF0, 0x00, 0x9A, 0x88, 0xB6, 0x6D, 0x65, 0x4B, 0x4C, 0x26, 0x73, 0x3B,
-    0x22, 0xD8, 0xD5, 0xF7, 0xE3, 0xDC, 0xA5, 0x4E, 0x19, 0xB1, 0x8D, 0xDC, 0xB1, 0xAD, 0x08, 0x35,
-    0x66, 0xDC, 0xB0, 0xA9, 0x4C, 0xCA, 0x56, 0x54, 0x40, 0x62, 0xEF, 0x07, 0x7D, 0x3E, 0xC0, 0x2D,
-    0x73, 0x2D, 0xCA, 0xCD, 0xBB, 0xFD, 0x3A, 0x4F, 0x5B, 0xF3, 0x89, 0x09, 0x91, 0x09, 0x8E, 0xCF,
-    0x7C, 0xD6, 0x13, 0x9A, 0xD0, 0xD2, 0x59, 0xB5, 0xD1, 0xC3, 0x5E, 0xC0, 0x70, 0x1D, 0x2E, 0xEF,
-    0x85, 0x05, 0x78, 0x9F, 0xEC, 0x04, 0x78, 0x16, 0x34, 0x80, 0x21, 0xD4, 0x25, 0xD4, 0xEB, 0xF8,
-    0xE2, 0xC7, 0xEA, 0xD4, 0xF0, 0x2C, 0x76, 0x70, 0x6F, 0x0F, 0x09, 0x41, 0x86, 0x67, 0xD1, 0x5B,
-    0x0D, 0xF0, 0xC0, 0x16, 0x80, 0xCD, 0x90, 0xC3, 0xDD, 0xEF, 0xC8, 0x5E, 0xD8, 0x49, 0x2E, 0xBF,
-    0x0C, 0x27, 0xFB, 0xC1, 0x06, 0x71, 0xDB, 0xB9, 0x76, 0xEE, 0xAC, 0xE3, 0x3B, 0x01, 0x0B, 0x60,
-    0x88, 0x33, 0xBE, 0x4C, 0x7B, 0x61, 0x15, 0x88, 0xB1, 0x7A, 0x37, 0x6A, 0x98, 0x2B, 0x11, 0x90,
-    0x2E, 0x37, 0x64, 0x44, 0xD7, 0x92, 0x0A, 0x2C, 0xD9, 0x2D, 0x1B, 0xEF, 0x2B, 0x55, 0x18, 0x7E,
-    0x41, 0xDB, 0xEC, 0x5C, 0x49, 0xD8, 0xEA, 0x27, 0x78, 0x89, 0x2C, 0x2C, 0xB7, 0xF4, 0x90, 0xFA,
-    0xDB, 0xEB, 0x7A, 0x68, 0x04, 0xCB, 0xCE, 0xAB, 0x50, 0x87, 0x6A, 0x2B, 0x17, 0x19, 0x57, 0x63,
-    0xA3, 0xD7, 0x60, 0x53, 0x7B, 0xEA, 0x23, 0x23, 0xA3, 0x54, 0x8F, 0x1A, 0x94, 0x9E, 0xC4, 0x32,
-    0x51, 0xF4, 0x7F, 0x28, 0xD1, 0x6B, 0xFE, 0x0B, 0x3F, 0x31, 0x61, 0x84, 0x66, 0xF4, 0x4C, 0x7D,
-    0xC0, 0x9C, 0xF7, 0xBA, 0x47, 0xCE, 0xD9, 0x23, 0x38, 0xCB, 0x28, 0xD9, 0x5E, 0x3C, 0xA9, 0x71,
-    0xE7, 0xE6, 0x59, 0xE2, 0x6F, 0x6B, 0xA9, 0x4C, 0x97, 0x99, 0xAF, 0x2E, 0x6D, 0x33, 0x05, 0x38,
-    0x16, 0x69, 0x4A, 0x15, 0x3E, 0x38, 0xD8, 0x54, 0x04, 0xC1, 0xCB, 0x5C, 0xF8, 0x3F, 0x67, 0x94,
-    0x8A, 0xBE, 0x50, 0xDE, 0x3E, 0xD6, 0x1B, 0x57, 0x83, 0xA1, 0xCB, 0xBF, 0x39, 0x94, 0xA9, 0xD2,
-    0xAF, 0x60, 0xB7, 0xF1, 0x2F, 0x69, 0x40, 0xDE, 0x93, 0x81, 0xBA, 0x1E, 0x95, 0xCC, 0x8A, 0x8A,
-    0xF8, 0x3B, 0x90, 0x86, 0x40, 0xD4, 0x9B, 0x5C, 0x97, 0x9F, 0xBE, 0x25, 0x43, 0x7A, 0x03, 0x9D,
-    0x31, 0x43, 0x4E, 0x10, 0x51, 0x58, 0x27, 0xC6, 0xC3, 0xA1, 0x71, 0xA5, 0xE5, 0x37, 0x43, 0x75,
-    0x5C, 0x26, 0x7D, 0x35, 0x47, 0x7D, 0x7F, 0xBF, 0xE1, 0x04, 0xF2, 0x0B, 0x48, 0xFC, 0x71, 0x64,
-    0xD6, 0x78, 0xB9, 0x49, 0x7F, 0xC1, 0x44, 0xF7, 0x3F, 0xF8, 0x41, 0xF7, 0xB2, 0x28, 0xF7, 0xE7,
-    0x3C, 0x26, 0xF6, 0xE5, 0x07, 0xE3, 0x5F, 0x5F, 0x3F, 0xB2, 0x48, 0x16, 0xA8, 0xB0, 0x27, 0xEC,
-    0x92, 0x5D, 0x9A, 0x68, 0xE2, 0x9D, 0x0E, 0x85, 0xBC, 0xB2, 0xF1, 0x99, 0xA8, 0xB4, 0xE8, 0xAF,
-    0xF8, 0xD2, 0x82, 0xB7, 0xEA, 0x97, 0x60, 0x0E, 0xEE, 0x1F, 0x57, 0xD5, 0xBC, 0x08, 0x13, 0x43,
-    0x47, 0xAD, 0x6C, 0xF0, 0x46, 0xA5, 0x65, 0x62, 0xD8, 0x48, 0xF3, 0xCD, 0x6D, 0x2C, 0x8D, 0xBF,
-    0x5D, 0xB9, 0xAD, 0x2F, 0x95, 0xA2, 0xB9, 0xE7, 0x4E, 0xBF, 0xCD, 0x64, 0x6A, 0x57, 0x4A, 0xF6,
-    0xB8, 0xF9, 0x70, 0x8E, 0xBC, 0xFE, 0xE1, 0xD2, 0x92, 0xC1, 0x17, 0x71, 0xC2, 0x16, 0x72, 0x8F,
-    0xFD, 0x16, 0x96, 0x48, 0x68, 0x56, 0xBB, 0xEA, 0x7B, 0xA6, 0x3E, 0x7F, 0xC5, 0x9F, 0x8C, 0xCC,
-    0x45, 0x22, 0xA0, 0x0C, 0x85, 0xE2, 0xB8, 0x6D, 0xC6, 0xD8, 0xED, 0xA8, 0xD4, 0xB0, 0x27, 0xFE,
-    0x01, 0xD5, 0x7D, 0x4D, 0xAC, 0x1C, 0xD7, 0x95, 0x5E, 0x75, 0x97, 0xC9, 0xCA, 0xA8, 0x00, 0x97,
-    0x16, 0xE2, 0x60, 0x62, 0x0D, 0xA6, 0x66, 0x31, 0x08, 0x10, 0xCD, 0xC0, 0xB5, 0x99, 0x85, 0x1D,
-    0xC4, 0xAA, 0x96, 0x84, 0x89, 0x10, 0x78, 0x21, 0x4E, 0x4C, 0xDA, 0x88, 0xB9, 0x78, 0x5E, 0xCC,
-    0x22, 0xB1, 0x27, 0x78, 0x41, 0x90, 0x00, 0x59, 0xD8, 0xA8, 0x96, 0xB8, 0x20, 0x30, 0x04, 0x42,
-    0x06, 0x89, 0x62, 0x20, 0x59, 0x48, 0x08, 0x1C, 0xC0, 0x7E, 0x04, 0xE6, 0xCD, 0x62, 0x16, 0x46,
-    0xE0, 0xF1, 0x6D, 0x91, 0x8B, 0xB7, 0xE0, 0x82, 0x65, 0x11, 0x34, 0x17, 0x5A, 0xB0, 0x6C, 0x49,
-    0xF1, 0x98, 0x5C, 0xB0, 0x48, 0x16, 0xC5, 0x7A, 0x8F, 0x55, 0x75, 0xF3, 0x7D, 0xDF, 0xA9, 0xEE,
-    0xD7, 0x8F, 0x22, 0x29, 0xC9, 0x94, 0x85, 0x84, 0x64, 0xFD, 0xF4, 0xAD, 0xBF, 0xFB, 0x73, 0xEE,
-    0x39, 0xDF, 0xF9, 0xBB, 0x3C, 0x74, 0x34, 0x08, 0x7D, 0x10, 0x64, 0x75, 0x30, 0xED, 0x83, 0x20,
-    0x5D, 0x04, 0xC1, 0xD1, 0x20, 0x08, 0x26, 0xDE, 0x0F, 0xCE, 0xFB, 0x6D, 0xEF, 0x6F, 0x78, 0xBF,
-    0x87, 0xEB, 0x6E, 0xC1, 0x5B, 0xE2, 0x2E, 0x98, 0xFA, 0xAD, 0x1F, 0xE2, 0x4A, 0xE6, 0xFD, 0x45,
-    0xEF, 0x6F, 0x1F, 0xBC, 0x82, 0x1F, 0xD7, 0xB7, 0x96, 0xCF, 0xF8, 0x21, 0x9E, 0xFF, 0x24, 0x6A,
-    0xF3, 0x57, 0x87, 0xB4, 0xCE, 0x5F, 0x6A, 0x02, 0xFD, 0x89, 0xEC, 0xCA, 0xF8, 0xEA, 0xF1, 0x19,
-    0x7B, 0xC1, 0xB0, 0xF5, 0x3F, 0xBD, 0xEF, 0xC6, 0x57, 0x1F, 0xB8, 0xA2, 0x8F, 0x6E, 0xAD, 0xAA,
-    0xD3, 0x16, 0xDE, 0x7B, 0xBE, 0xC9, 0xD7, 0xC1, 0xDA, 0x29, 0x6F, 0x0D, 0xF4, 0xD8, 0xC1, 0xD3,
-    0x0F, 0xFC, 0x1C, 0xA7, 0x1E, 0x7B, 0xBC, 0x78, 0xC0, 0xE9, 0x9E, 0x6F, 0x70, 0xC3, 0xC4, 0xCF,
-    0x71, 0x03, 0xDE, 0x8D, 0x7B, 0x8B, 0xC5, 0xEA, 0xD4, 0xE3, 0xF4, 0x73, 0x9B, 0x2D, 0x4E, 0xF1,
-    0xE2, 0xA9, 0x4F, 0x7C, 0xC9, 0x53, 0xD6, 0x7E, 0xC2, 0x7E, 0x39, 0x3E, 0x0B, 0xD2, 0x26, 0x08,
-    0xD1, 0x53, 0x7E, 0x16, 0x64, 0x0B, 0x2B, 0x64, 0x05, 0x7A, 0xD4, 0xE4, 0xEA, 0x78, 0xE8, 0x02,
-    0xBC, 0x31, 0x88, 0x7E, 0x93, 0x83, 0xFE, 0x4C, 0xDC, 0x30, 0xC3, 0x2B, 0xBB, 0x18, 0xEF, 0x8B,
-    0xFC, 0x75, 0x17, 0xFA, 0xF9, 0xE4, 0x45, 0x7C, 0x0F, 0x95, 0x0B, 0x82, 0xBC, 0xC4, 0x28, 0xED,
-    0x1E, 0x3F, 0xC6, 0x46, 0x63, 0x94, 0xFC, 0x02, 0x5F, 0xAC, 0x51, 0x27, 0x55, 0x2A, 0x40, 0x2B,
-    0x83, 0xAC, 0x61, 0x8D, 0x66, 0xC1, 0xCC, 0x0D, 0xDF, 0xAC, 0x13, 0xBC, 0x27, 0x40, 0xD7, 0x05,
-    0x87, 0xFD, 0x30, 0x1B, 0xAB, 0x1B, 0x3C, 0xEB, 0x4B, 0xBC, 0xFB, 0x6D, 0x5C, 0xCA, 0xF7, 0xDC,
-    0x4E, 0x17, 0x3C, 0x83, 0x8E, 0x8E, 0x59, 0x89, 0x1A, 0xB4, 0x50, 0x05, 0x09, 0xB6, 0x1C, 0x0D,
-    0x77, 0x78, 0x89, 0x43, 0xB1, 0xAB, 0x8C, 0x44, 0x76, 0x83, 0x70, 0xF0, 0xAF, 0xFB, 0x6B, 0x78,
-    0x0E, 0x1F, 0x46, 0x9F, 0xCE, 0x82, 0x67, 0xF0, 0xD0, 0xCD, 0xFB, 0x83, 0x77, 0x0F, 0xDB, 0xA1,
-    0xB6, 0xE1, 0xAD, 0xB6, 0xD8, 0xDC, 0xF9, 0xA0, 0x7B, 0x3E, 0x99, 0xEB, 0xCB, 0xC5, 0x02, 0xAD,
-    0xFC, 0x84, 0xBB, 0x20, 0xE5, 0x08, 0x4D, 0x3C, 0x3B, 0xE8, 0x13, 0x9E, 0xBA, 0x45, 0x38, 0x3C,
-    0xE5, 0x9A, 0xDC, 0x2F, 0x7C, 0x17, 0x7A, 0x55, 0x21, 0xF7, 0x1A, 0xCD, 0x84, 0xB4, 0x80, 0xFA,
-    0x89, 0x30, 0x48, 0xEE, 0x68, 0x33, 0xAA, 0x37, 0x4F, 0x5A, 0x1C, 0xD2, 0x2A, 0xE4, 0xC5, 0xA8,
-    0x55, 0x7F, 0x4E, 0x86, 0x20, 0xDF, 0xFB, 0x01, 0xBA, 0x61, 0x96, 0x90, 0xCE, 0xB2, 0x92, 0x0F,
-    0xCD, 0xE2, 0x26, 0x20, 0xD9, 0x61, 0xD2, 0xE4, 0x55, 0xDA, 0x07, 0x3E, 0x48, 0x78, 0x77, 0x8E,
-    0x0F, 0x82, 0x60, 0x12, 0x10, 0xD2, 0x3C, 0xEE, 0xC2, 0x0E, 0x17, 0xC3, 0x61, 0xCA, 0x8B, 0x20,
-    0x61, 0x3F, 0x0F, 0xFD, 0x39, 0x7F, 0x09, 0xA3, 0x88, 0x27, 0xDF, 0x55, 0x27, 0xFB, 0x4A, 0xFD,
-    0xED, 0x67, 0x93, 0x59, 0x30, 0x76, 0x50, 0x90, 0x2F, 0xEC, 0x50, 0x7E, 0xA2, 0x03, 0x5E, 0xE9,
-    0x77, 0xED, 0xE0, 0x4B, 0x3B, 0x34, 0xC5, 0xF5, 0x2D, 0xB7, 0xE7, 0x3B, 0xDD, 0x12, 0xF7, 0x3A,
-    0x84, 0xC3, 0x43, 0x0E, 0x76, 0xED, 0xBA, 0xD3, 0x9D, 0x7C, 0x4E, 0x87, 0x52, 0x07, 0x7B, 0x67,
-    0x90, 0x92, 0xD4, 0x34, 0xD1, 0xD8, 0x57, 0xDD, 0x38, 0xC5, 0x48, 0x34, 0xE3, 0x3C, 0xE3, 0x68,
-    0x63, 0xB2, 0xFD, 0x74, 0x1E, 0xC4, 0x36, 0xCD, 0xD8, 0xA3, 0x8E, 0xB7, 0x66, 0xF5, 0x94, 0x9D,
-    0x81, 0xAE, 0xB0, 0x59, 0xE6, 0x38, 0xDB, 0x32, 0x0E, 0x4E, 0x6C, 0x17, 0x0F, 0x16, 0x06, 0xC1,
-    0x91, 0xA3, 0x7C, 0x29, 0x3A, 0x24, 0xE5, 0x37, 0xF8, 0xF6, 0x84, 0x83, 0x73, 0x64, 0x9C, 0x1E,
-    0x28, 0xCD, 0x6A, 0xD4, 0xCD, 0xBF, 0x80, 0x7E, 0xED, 0x22, 0x3E, 0x9B, 0xD6, 0x51, 0x8F, 0x9E,
-    0xC8, 0xAB, 0x09, 0xC8, 0x12, 0x63, 0x8F, 0xF9, 0x90, 0xEE, 0x61, 0xEC, 0x0A, 0x7C, 0x7E, 0xC2,
-    0x41, 0x8B, 0x58, 0x9B, 0xB4, 0x76, 0x25, 0xEE, 0xF2, 0xA0, 0x0F, 0xCC, 0xFE, 0xA8, 0xC3, 0x37,
-    0xD2, 0x1A, 0x94, 0x0D, 0x3A, 0x1B, 0x40, 0x32, 0x71, 0x8F, 0x77, 0x25, 0x1D, 0x5E, 0x9F, 0xB6,
-    0xAA, 0x43, 0x80, 0xDB, 0xD5, 0xC1, 0xE3, 0x2E, 0x9F, 0xED, 0xD7, 0x82, 0x77, 0xB1, 0xD7, 0xFC,
-    0x5D, 0xF2, 0x1F, 0x4C, 0xF9, 0xDC, 0x6F, 0xA0, 0x6B, 0x50, 0x94, 0xB0, 0xA8, 0x70, 0x57, 0x31,
-    0xFA, 0x28, 0x4A, 0x2F, 0xA3, 0xC8, 0x27, 0x77, 0x7D, 0xD4, 0xE4, 0x57, 0xBB, 0x7C, 0xE1, 0x37,
-    0x6E, 0xF5, 0x61, 0x5F, 0x5C, 0xAA, 0x51, 0x54, 0xCC, 0xF2, 0xAB, 0xA8, 0xA0, 0xDF, 0xF0, 0x25,
-    0x8A, 0xD0, 0x98, 0xBB, 0x20, 0x4D, 0x14, 0xE1, 0xAD, 0x1B, 0x3D, 0xE7, 0xF3, 0x31, 0xFC, 0x0D,
-    0xBB, 0xB0, 0x05, 0x25, 0x62, 0x8C, 0x13, 0x52, 0x6C, 0x4C, 0x3A, 0x9D, 0x1C, 0x5B, 0x55, 0x62,
-    0x3A, 0xE4, 0x20, 0xA0, 0x1A, 0xDD, 0xE6, 0x16, 0x7E, 0x16, 0xF6, 0x68, 0x3E, 0x3A, 0x03, 0x7D,
-    0x02, 0x4A, 0x0E, 0x39, 0x07, 0x52, 0x90, 0x59, 0x89, 0xCE, 0x2C, 0x2E, 0x60, 0xAC, 0x7C, 0x56,
-    0x82, 0x9C, 0x3D, 0xE9, 0xBE, 0xE5, 0xBB, 0xD0, 0xAA, 0x84, 0x94, 0x9E, 0x37, 0x9C, 0x03, 0x8B,
-    0xE0, 0xA9, 0xED, 0x8E, 0x33, 0x04, 0x9F, 0xE0, 0xB7, 0x42, 0xCF, 0xF6, 0x1F, 0xB5, 0xE6, 0x67,
-    0xBF, 0x02, 0x1B, 0x1E, 0x3E, 0x8D, 0x93, 0x61, 0xEB, 0xDC, 0x40, 0x9A, 0xFA, 0x15, 0x36, 0x9D,
-    0x54, 0xA2, 0x60, 0xF1, 0xAF, 0xD5, 0xC9, 0x91, 0x19, 0xBF, 0xCF, 0x5E, 0xD7, 0x74, 0x75, 0xAA,
-    0xA5, 0xEA, 0x7B, 0x1F, 0xBF, 0xE3, 0x5D, 0x56, 0xAF, 0xC7, 0x4C, 0x99, 0xF8, 0x04, 0xBF, 0xDD,
-    0xAB, 0x9E, 0xCF, 0xE6, 0xE4, 0x15, 0xF8, 0x1D, 0x63, 0x68, 0xF1, 0xF4, 0x16, 0x47, 0x1A, 0xF2,
-    0x82, 0x64, 0xE8, 0x49, 0xD1, 0x7E, 0x01, 0xC2, 0x48, 0xDA, 0xA4, 0xC3, 0x45, 0xCE, 0xF0, 0xE2,
-    0x67, 0xE8, 0x98, 0xA4, 0xC5, 0x6B, 0x49, 0x05, 0xA0, 0x93, 0x03, 0x9B, 0x4D, 0xC3, 0xFD, 0xCD,
-    0xFF, 0x9A, 0xF7, 0x70, 0x6E, 0x35, 0xD8, 0x30, 0x57, 0x12, 0x0C, 0x6D, 0xC8, 0x6D, 0xB0, 0x23,
-    0xA6, 0x11, 0xE7, 0x90, 0x5D, 0xC7, 0x7D, 0xBB, 0x7A, 0x06, 0x1F, 0xAF, 0xB0, 0xB5, 0x0E, 0xD7,
-    0x40, 0xF2, 0x3D, 0x78, 0xD2, 0xB8, 0xC5, 0x9D, 0xBB, 0xE2, 0x1A, 0x5C, 0x2B, 0xC7, 0xAD, 0x1D,
-    0xAF, 0x7B, 0xCE, 0x06, 0x3B, 0x46, 0x1E, 0xCF, 0xF5, 0xCE, 0x24, 0x23, 0xDE, 0x33, 0x04, 0x6B,
-    0x82, 0x86, 0x87, 0xDF, 0x50, 0xD0, 0x88, 0xA0, 0x31, 0xA9, 0xD1, 0xD7, 0xFC, 0xF0, 0x38, 0x5F,
-    0x63, 0x93, 0x93, 0x25, 0x3B, 0x07, 0xEC, 0xAE, 0xE5, 0x58, 0x88, 0xBE, 0xC8, 0x08, 0xC5, 0xDB,
-    0x8C, 0xD1, 0x89, 0xB1, 0x8D, 0xC5, 0x6C, 0x3F, 0x79, 0x24, 0x8A, 0xD1, 0xF5, 0x28, 0xC6, 0x28,
-    0x80, 0xD3, 0x0D, 0x10, 0x16, 0x13, 0xB7, 0xB7, 0xB5, 0x3D, 0x9C, 0x16, 0x33, 0xDA, 0xE4, 0x8E,
-    0x0D, 0xF1, 0xFE, 0x03, 0x0D, 0xE6, 0x3B, 0xE4, 0xB4, 0x7E, 0xB3, 0xE2, 0x40, 0x3A, 0xB0, 0xD9,
-    0xA4, 0x39, 0xA6, 0x71, 0x2F, 0xF6, 0x61, 0x07, 0x80, 0xC2, 0x03, 0xE0, 0x62, 0x09, 0x3B, 0xD0,
-    0x1D, 0x07, 0xAE, 0xE0, 0xC7, 0xDE, 0xD6, 0xB9, 0x15, 0xB8, 0x98, 0x67, 0xE0, 0x3D, 0xF3, 0xE9,
-    0x80, 0xEA, 0x67, 0xE0, 0x09, 0x33, 0xF4, 0x2B, 0xB9, 0x33, 0xB8, 0xF0, 0x80, 0x7B, 0x59, 0x30,
-    0xCF, 0x29, 0xD8, 0xB3, 0x0A, 0xF5, 0x0D, 0x87, 0xB8, 0x25, 0x37, 0x2B, 0xCE, 0x0F, 0xA4, 0xA5,
-    0x78, 0xF0, 0x37, 0x55, 0x35, 0xB1, 0x39, 0x91, 0x0D, 0x39, 0x9B, 0x49, 0x88, 0xB4, 0x75, 0xA7,
-    0xD1, 0x65, 0x49, 0x97, 0x55, 0xA0, 0x9A, 0xB8, 0x8F, 0x5B, 0xF0, 0x0A, 0x70, 0x78, 0xF0, 0xF8,
-    0x19, 0x68, 0x08, 0xAF, 0x05, 0x3F, 0x9B, 0x65, 0x55, 0x34, 0x40, 0x58, 0xF3, 0x9B, 0xE0, 0x36,
-    0xF8, 0x66, 0xD2, 0x15, 0xAA, 0x90, 0x89, 0xA0, 0xCC, 0x57, 0xE8, 0xE8, 0x16, 0xBD, 0xDF, 0xE4,
-    0x5B, 0xBE, 0x3E, 0x2A, 0xA6, 0xC7, 0x49, 0xC9, 0xC9, 0x57, 0x1D, 0xFA, 0x8E, 0xD7, 0x14, 0xF4,
-    0x14, 0x17, 0x98, 0x81, 0x9C, 0x97, 0xEC, 0x67, 0x76, 0x3E, 0xA5, 0x53, 0x71, 0xE3, 0xFD, 0x0D,
-    0x62, 0xA4, 0x96, 0xED, 0x74, 0xB8, 0x91, 0x42, 0x1D, 0xC3, 0x59, 0xDC, 0x25, 0xCD, 0x83, 0x13,
-    0xA5, 0x60, 0x3B, 0x01, 0x29, 0x23, 0x22, 0x27, 0xCA, 0x51, 0x84, 0x29, 0xBF, 0x51, 0x27, 0x77,
-    0x50, 0x54, 0xBC, 0x72, 0xD7, 0x87, 0x1D, 0x38, 0x51, 0x5A, 0xA2, 0xC8, 0x83, 0x6A, 0x77, 0x1A,
-    0xB0, 0x9D, 0x7C, 0x91, 0x5F, 0xED, 0x7B, 0x72, 0xA2, 0x9A, 0x9C, 0x68, 0x86, 0xA2, 0x8E, 0x9C,
-    0xA8, 0x64, 0x11, 0xC6, 0xA7, 0x68, 0x38, 0xB6, 0x62, 0x47, 0x6D, 0x5C, 0xE3, 0x9C, 0x52, 0x99,
-    0xB4, 0x93, 0x92, 0x45, 0x8C, 0xA8, 0xE2, 0x33, 0xE1, 0x89, 0x78, 0xBD, 0x7B, 0x8B, 0x55, 0x02,
-    0x11, 0xE7, 0x75, 0x4A, 0xE9, 0x51, 0x60, 0x56, 0x83, 0x7D, 0x93, 0xA3, 0xC7, 0xE4, 0x78, 0x05,
-    0x98, 0xFC, 0x8D, 0x61, 0xC5, 0xF7, 0x59, 0x53, 0x92, 0xE9, 0x79, 0x08, 0x59, 0x1F, 0x52, 0x3A,
-    0x60, 0x70, 0xD2, 0x3A, 0xA6, 0xC0, 0x48, 0x3A, 0x3C, 0x98, 0xB6, 0x78, 0x57, 0xD6, 0xA0, 0xF6,
-    0x39, 0x27, 0x7D, 0x21, 0xB9, 0xDC, 0x91, 0x73, 0xD4, 0x91, 0x78, 0x06, 0x29, 0xA0, 0x80, 0x04,
-    0x9B, 0x50, 0xB4, 0x63, 0x50, 0xDD, 0x22, 0xA3, 0x28, 0x73, 0x33, 0xF0, 0x99, 0x9E, 0xD2, 0xBE,
-    0x41, 0x51, 0x5E, 0xA2, 0x88, 0xA2, 0x2C, 0xEC, 0x0C, 0x00, 0xB8, 0x05, 0x61, 0x25, 0xA5, 0xDB,
-    0xE0, 0x5A, 0xD2, 0x0F, 0x6A, 0x6E, 0x82, 0x11, 0xF3, 0xAC, 0x7B, 0x46, 0xC2, 0x1E, 0xC3, 0x99,
-    0xEF, 0xA2, 0x9A, 0x53, 0x7F, 0xCF, 0x93, 0xC1, 0x5F, 0xE3, 0x34, 0xF3, 0x05, 0x91, 0x67, 0x3F,
-    0xF4, 0x41, 0x72, 0xF3, 0xDE, 0xBD, 0x36, 0xC8, 0x8B, 0x6B, 0xEF, 0xD4, 0xD3, 0xCE, 0x17, 0x1B,
-    0x8B, 0xE4, 0xDD, 0x7E, 0xC8, 0xE7, 0xF9, 0x2B, 0xF7, 0x5A, 0x3F, 0xED, 0xF2, 0x6B, 0xBF, 0xE8,
-    0x92, 0xCA, 0x17, 0x27, 0x9B, 0xFC, 0xA5, 0x7E, 0x48, 0x6E, 0x75, 0xC9, 0xBD, 0x36, 0xBB, 0x54,
-    0xE5, 0xD7, 0xAA, 0xC2, 0xCD, 0x7C, 0x31, 0x07, 0xE4, 0xE9, 0x41, 0x97, 0x15, 0x8A, 0x01, 0x07,
-    0x51, 0x0C, 0xBE, 0x87, 0xE2, 0xAC, 0x0A, 0x29, 0xE7, 0x53, 0x32, 0x64, 0x4F, 0x86, 0x7C, 0xEF,
-    0x11, 0x27, 0x00, 0x0F, 0xF7, 0x38, 0x5D, 0xC9, 0xA2, 0xED, 0xE4, 0x31, 0x37, 0xAF, 0x9F, 0xD4,
-    0x46, 0x0E, 0x53, 0x12, 0x48, 0x4C, 0xB8, 0x15, 0x0B, 0x30, 0xF9, 0xEB, 0xBE, 0x09, 0x79, 0xA4,
-    0x6C, 0x77, 0x25, 0xFA, 0x23, 0x69, 0x39, 0xFD, 0x3C, 0xD1, 0x2B, 0x61, 0x68, 0x90, 0xDD, 0xC2,
-    0x2C, 0x88, 0x58, 0xBB, 0xA9, 0x15, 0x5E, 0xC0, 0x1B, 0xF2, 0x5A, 0x77, 0x02, 0xD5, 0xC6, 0x3D,
-    0x1E, 0x8F, 0xD0, 0xF1, 0xBB, 0x9B, 0x9E, 0x58, 0x0C, 0x9D, 0xE5, 0x08, 0x42, 0x0F, 0x0B, 0xCA,
-    0x11, 0x41, 0x1D, 0x10, 0x2B, 0x76, 0x02, 0x0C, 0x83, 0x96, 0x86, 0x9F, 0xC6, 0x49, 0x55, 0xF8,
-    0xF7, 0x30, 0x7C, 0x3D, 0x01, 0x4E, 0x26, 0x16, 0x94, 0x41, 0x35, 0xCA, 0xEF, 0x43, 0xDA, 0xDE,
-    0xAC, 0xC9, 0xB0, 0x13, 0xFC, 0xF4, 0xEF, 0x78, 0xA9, 0x30, 0xB5, 0x23, 0x44, 0xDE, 0x9A, 0xC5,
-    0x23, 0x56, 0x72, 0x0B, 0x71, 0xAA, 0xB5, 0x9F, 0x07, 0xC0, 0x7E, 0x3B, 0x82, 0x7D, 0x6F, 0x60,
-    0x7F, 0x3E, 0x82, 0x7D, 0xB2, 0x1C, 0xC2, 0xF9, 0x8E, 0xF2, 0x79, 0xC4, 0x21, 0x02, 0xFB, 0x6C,
-    0x31, 0xEF, 0x78, 0x3C, 0xD8, 0x67, 0x37, 0x90, 0x7C, 0x21, 0x29, 0x30, 0x03, 0x79, 0x95, 0x1C,
-    0xC4, 0x1E, 0x9E, 0xDB, 0xEB, 0x7F, 0xC3, 0x02, 0x54, 0x24, 0x6E, 0x49, 0xAD, 0xE7, 0x49, 0xAC,
-    0xE0, 0xB3, 0x49, 0x13, 0x13, 0xAC, 0x63, 0x46, 0x02, 0x2E, 0x57, 0x09, 0x61, 0x78, 0x31, 0x0F,
-    0xFC, 0x4B, 0x3D, 0x45, 0x34, 0xF4, 0x8A, 0xCE, 0xCD, 0x82, 0x08, 0x5D, 0x25, 0xED, 0x02, 0xD3,
-    0x81, 0xAC, 0x55, 0x6C, 0xB6, 0x64, 0x03, 0x82, 0xE0, 0x39, 0x57, 0x93, 0xE7, 0xCE, 0x0D, 0x9A,
-    0x24, 0x84, 0x7F, 0x4B, 0x4C, 0xAC, 0x3F, 0x49, 0xBD, 0xDA, 0x4F, 0xB6, 0xF7, 0x8E, 0x6A, 0xAC,
-    0x07, 0xE1, 0x77, 0xBF, 0x20, 0x2D, 0x40, 0x09, 0xEA, 0x93, 0x3A, 0xEB, 0x72, 0xCC, 0xBD, 0xB8,
-    0xCB, 0xCB, 0x84, 0x9C, 0x6C, 0x81, 0xFD, 0xC0, 0xFD, 0x74, 0xB0, 0x73, 0x2B, 0xB7, 0x7B, 0xEC,
-    0x7E, 0x7B, 0x76, 0xAA, 0xF7, 0xD8, 0x3B, 0xF9, 0xFE, 0xD9, 0xC1, 0x2F, 0x06, 0x87, 0x8E, 0x0A,
-    0x9B, 0x24, 0x14, 0x14, 0x98, 0xDD, 0x98, 0x94, 0x25, 0x10, 0x27, 0x45, 0x34, 0x87, 0xC5, 0x9F,
-    0x24, 0x98, 0xB8, 0x28, 0xEC, 0xD4, 0x8C, 0x2D, 0x14, 0xB8, 0x8A, 0xD8, 0x65, 0x89, 0xC6, 0x89,
-    0x1A, 0x6A, 0x7E, 0x13, 0x57, 0xFD, 0x69, 0x62, 0x52, 0x30, 0x22, 0xC8, 0x47, 0x3F, 0x13, 0xF4,
-    0xC5, 0x88, 0xE6, 0x35, 0x7A, 0x36, 0x6B, 0x40, 0x16, 0x09, 0xE9, 0x3F, 0x2B, 0xC1, 0x8E, 0x12,
-    0x32, 0x26, 0xDE, 0xC5, 0xAE, 0x17, 0x01, 0x3E, 0x69, 0x21, 0xC5, 0xF1, 0x29, 0x3F, 0x12, 0x83,
-    0x30, 0x04, 0xE7, 0x8F, 0xC1, 0x2E, 0x72, 0xF8, 0x11, 0x7C, 0x05, 0x2A, 0x3C, 0x32, 0xC3, 0xC1,
-    0x83, 0x9B, 0xE6, 0xD7, 0xC0, 0xFE, 0xEF, 0x91, 0xFB, 0x1E, 0x28, 0x18, 0x58, 0x00, 0xBE, 0x0C,
-    0x6D, 0xB9, 0x20, 0x81, 0x11, 0xC9, 0xF4, 0x9A, 0xEA, 0x5F, 0xF8, 0x35, 0x5F, 0x98, 0xAC, 0x94,
-    0xD2, 0x99, 0x7D, 0x61, 0xAD, 0xA0, 0xA0, 0x54, 0x8C, 0xF7, 0x04, 0xFD, 0xF3, 0x1B, 0xA6, 0x79,
-    0x6F, 0x9B, 0xBE, 0x26, 0x4D, 0x20, 0xF9, 0x2D, 0x5C, 0x42, 0xDB, 0xB7, 0xDC, 0x0D, 0x81, 0x11,
-    0x22, 0x0C, 0x6F, 0x50, 0x81, 0x00, 0x51, 0xB5, 0x11, 0x01, 0x63, 0x10, 0x88, 0x16, 0xC2, 0xCF,
-    0xF6, 0x27, 0xEA, 0xB5, 0xB7, 0xE5, 0xFF, 0xDE, 0x6A, 0x43, 0x80, 0xC3, 0x3F, 0xDD, 0xF8, 0xD3,
-    0x18, 0xC5, 0xD2, 0x38, 0x50, 0x3C, 0xF4, 0xE7, 0xF4, 0x87, 0x05, 0xE9, 0x2B, 0x25, 0x62, 0x89,
-    0x88, 0x57, 0x26, 0xF6, 0x9C, 0x88, 0x37, 0xD4, 0xBD, 0x52, 0xD2, 0xF2, 0xEB, 0x67, 0xA5, 0xFA,
-    0x56, 0x9A, 0x38, 0xC2, 0x38, 0x90, 0x7A, 0x65, 0x0A, 0xBE, 0x40, 0x83, 0x88, 0xC1, 0x3A, 0x21,
-    0x3C, 0x81, 0xBD, 0x84, 0x60, 0x26, 0x1C, 0xCE, 0x99, 0xC6, 0x5A, 0x4A, 0x29, 0xA4, 0x1A, 0x32,
-    0xD3, 0x77, 0x93, 0x5B, 0x9A, 0xC4, 0x64, 0xDC, 0x81, 0xA7, 0xAA, 0x26, 0xB9, 0xF2, 0x40, 0xF1,
-    0xDE, 0xFF, 0x62, 0x31, 0x68, 0x02, 0xC5, 0x98, 0xDD, 0xF9, 0x0E, 0xE9, 0x03, 0x77, 0xC7, 0x9E,
-    0x77, 0xC7, 0x1D, 0xEF, 0x4E, 0x1A, 0xDE, 0x0D, 0x2D, 0x25, 0x45, 0x25, 0x5E, 0x22, 0xB0, 0x66,
-    0xF1, 0x39, 0x5F, 0xE9, 0xEE, 0x80, 0x1C, 0xAC, 0xE6, 0x4B, 0x76, 0x51, 0xA1, 0x0F, 0xA1, 0xF2,
-    0xF5, 0xED, 0xBA, 0x38, 0x1E, 0x11, 0x24, 0x58, 0x35, 0x87, 0x35, 0xC3, 0xCB, 0xA2, 0x25, 0x4A,
-    0xEF, 0xED, 0x1C, 0xF3, 0xEB, 0xBA, 0xEF, 0x46, 0x94, 0x2F, 0x94, 0x3E, 0xB2, 0x61, 0x8A, 0xA9,
-    0x76, 0xA2, 0x5A, 0x5E, 0xF7, 0xED, 0x21, 0xD9, 0x3C, 0xC4, 0xEF, 0x62, 0xE3, 0xBE, 0xC7, 0x8F,
-    0xBB, 0x92, 0xDA, 0x31, 0xFA, 0xAF, 0x0F, 0x6D, 0xE2, 0x14, 0xA5, 0x29, 0xA9, 0xBC, 0x23, 0x94,
-    0xC6, 0xF4, 0xF2, 0xAF, 0xBF, 0xE3, 0x5F, 0x1D, 0xCD, 0x32, 0xF3, 0x78, 0xCD, 0xE6, 0x12, 0x18,
-    0x07, 0xC7, 0x67, 0x88, 0x36, 0x3C, 0x55, 0x4F, 0x59, 0xA5, 0xC0, 0x32, 0x87, 0x6D, 0xAA, 0xB2,
-    0x54, 0xAF, 0x23, 0xAA, 0xB3, 0x71, 0x9F, 0x02, 0x98, 0x62, 0x10, 0x00, 0x92, 0x66, 0x41, 0x8E,
-    0x9E, 0x20, 0x48, 0xDF, 0xE1, 0x50, 0x4D, 0xD8, 0x17, 0x04, 0xF0, 0x05, 0x47, 0x2F, 0xBD, 0xE5,
-    0x39, 0xB6, 0x10, 0x9D, 0x98, 0x59, 0x90, 0x98, 0x64, 0x21, 0x7C, 0x8A, 0x20, 0xE6, 0x67, 0xCB,
-    0x17, 0x4E, 0xFD, 0xFB, 0xAE, 0xA1, 0x9A, 0xAB, 0x6F, 0x85, 0x6A, 0x22, 0xDE, 0x33, 0xA8, 0x46,
-    0x87, 0xB8, 0x3B, 0xEC, 0xA4, 0xD9, 0x0B, 0xF1, 0x2C, 0x08, 0x7D, 0x80, 0x8F, 0xF2, 0x05, 0x68,
-    0x93, 0x70, 0xCA, 0x4E, 0xC0, 0xEB, 0x00, 0x11, 0x77, 0xBF, 0x61, 0xF7, 0x84, 0x12, 0x24, 0x9E,
-    0xA6, 0xB2, 0x6F, 0x90, 0x62, 0x72, 0xF4, 0x69, 0x88, 0x4B, 0x33, 0xDC, 0x03, 0x70, 0x01, 0x98,
-    0x91, 0xBF, 0x05, 0xBA, 0x01, 0x2B, 0x96, 0x2D, 0x83, 0xF6, 0xA6, 0x16, 0x6D, 0xED, 0xF8, 0xF1,
-    0xCF, 0xCF, 0x0A, 0x32, 0x42, 0x42, 0xDA, 0xD9, 0x1F, 0xFB, 0x1E, 0x6F, 0x69, 0x30, 0x0D, 0xDF,
-    0x01, 0xF6, 0x2C, 0x2A, 0xB0, 0x93, 0x79, 0x7A, 0x0F, 0x7D, 0x41, 0x6E, 0xF2, 0x8A, 0xDF, 0x05,
-    0x33, 0x79, 0xA9, 0x09, 0x4C, 0x08, 0x1C, 0x0D, 0xA6, 0xAE, 0x21, 0x7B, 0x45, 0x0D, 0x00, 0x67,
-    0x86, 0xB3, 0xD4, 0x5B, 0x29, 0x48, 0xC9, 0x58, 0x40, 0x27, 0xF3, 0x62, 0x5B, 0x22, 0xB7, 0x73,
-    0xBB, 0x69, 0xEF, 0x2A, 0x9B, 0xF5, 0xB6, 0x4D, 0x3C, 0x81, 0x58, 0xBE, 0xA0, 0xAA, 0x1C, 0xF6,
-    0x69, 0x9B, 0x92, 0xE7, 0x37, 0xC2, 0xD6, 0x54, 0x2B, 0x21, 0x65, 0xF0, 0x4A, 0xFC, 0x1C, 0x38,
-    0xB0, 0x60, 0x92, 0x10, 0x6B, 0xD9, 0x1D, 0xE0, 0xF7, 0x33, 0x83, 0xEB, 0x72, 0x52, 0xAB, 0x07,
-    0x7F, 0x3F, 0xE4, 0xCF, 0xA0, 0xE3, 0xF2, 0x2A, 0xEA, 0x40, 0x1E, 0x77, 0x50, 0x74, 0x86, 0xD6,
-    0x33, 0x8C, 0xAF, 0xA3, 0x52, 0xA3, 0x7F, 0x57, 0x8E, 0x41, 0x8D, 0xF9, 0xC8, 0x7F, 0x9C, 0x49,
-    0xC1, 0xB2, 0x07, 0xD1, 0x41, 0x57, 0xC0, 0xF2, 0xC9, 0xA3, 0x23, 0x72, 0xEB, 0x94, 0x7C, 0xBB,
-    0x20, 0x77, 0xEC, 0x69, 0x90, 0x68, 0x08, 0x72, 0x17, 0x9C, 0x15, 0xA0, 0xEF, 0x8D, 0xDD, 0xAF,
-    0xFB, 0xAF, 0x91, 0x21, 0x5C, 0x5B, 0x82, 0xB2, 0x1E, 0x34, 0x90, 0xDC, 0xA3, 0xD4, 0xB9, 0x46,
-    0xD9, 0x89, 0x61, 0x37, 0xEE, 0x3D, 0xA2, 0x2F, 0x76, 0x97, 0xFA, 0x1C, 0x38, 0xB9, 0x81, 0x52,
-    0x02, 0x1C, 0x53, 0xDC, 0xF4, 0xAB, 0x3F, 0xF7, 0x47, 0x24, 0x52, 0x50, 0xDB, 0x7F, 0xEF, 0xF0,
-    0xC2, 0xEC, 0x89, 0xC4, 0x0F, 0x67, 0x83, 0x43, 0x33, 0x0A, 0x38, 0xA8, 0x2F, 0xFC, 0xF2, 0x3C,
-    0xAF, 0xE2, 0x2E, 0x6A, 0x49, 0x0C, 0x25, 0x50, 0x25, 0x88, 0x27, 0x22, 0x6E, 0x8B, 0xBB, 0xE2,
-    0x74, 0xB7, 0xD4, 0x8F, 0x46, 0x03, 0x5A, 0xA6, 0x1F, 0xD1, 0xE0, 0xA8, 0x41, 0xF9, 0x53, 0x2D,
-    0x65, 0x45, 0x5D, 0x9C, 0x44, 0xEB, 0xFA, 0xA8, 0x95, 0x81, 0xAC, 0x98, 0x17, 0x65, 0x5E, 0x47,
-    0xE8, 0x6F, 0x02, 0xF0, 0x79, 0x22, 0xDE, 0x84, 0x4F, 0xE2, 0x35, 0x2F, 0xE0, 0xEB, 0x9F, 0xE7,
-    0x94, 0x62, 0x2B, 0xF2, 0xC5, 0x17, 0x1C, 0xC6, 0x9A, 0xDA, 0x4C, 0x13, 0x60, 0xE2, 0x09, 0x3C,
-    0x65, 0x77, 0xCE, 0x46, 0x1E, 0x77, 0x5E, 0x96, 0xF6, 0xD4, 0x93, 0x2A, 0xDC, 0x3C, 0x81, 0xF6,
-    0x88, 0x21, 0x9F, 0xE7, 0xD8, 0x0A, 0x6C, 0x18, 0x89, 0xD7, 0x86, 0xDE, 0x9D, 0xBC, 0xD7, 0xBB,
-    0xD3, 0x77, 0x7A, 0xF7, 0xCA, 0xE5, 0xDE, 0x6D, 0x5E, 0xE8, 0x9D, 0x83, 0x96, 0x09, 0x7D, 0xD0,
-    0x01, 0x14, 0xBB, 0x16, 0x1B, 0x60, 0x00, 0xC8, 0xA4, 0x3F, 0xFC, 0xE6, 0x53, 0xF3, 0xB8, 0xCE,
-    0x4A, 0x71, 0x09, 0xCE, 0x69, 0xD7, 0xAF, 0x80, 0xC7, 0x93, 0xBE, 0xDB, 0x41, 0x23, 0xC1, 0x3B,
-    0x1A, 0x3C, 0x5F, 0xB9, 0xB9, 0x5B, 0xD0, 0x4A, 0xE1, 0x4E, 0x02, 0x36, 0xC8, 0x24, 0x51, 0xDB,
-    0xF1, 0x26, 0x7E, 0xA3, 0x83, 0x70, 0x6D, 0x8E, 0x7B, 0x4A, 0x6A, 0x90, 0x78, 0x06, 0xCF, 0xC5,
-    0xFD, 0x44, 0x8A, 0x87, 0x69, 0x20, 0x75, 0xBC, 0x7B, 0xA2, 0x13, 0x55, 0x38, 0x90, 0x07, 0xE1,
-    0x41, 0x5C, 0x47, 0x9A, 0x75, 0x01, 0x89, 0x83, 0x54, 0x42, 0xBB, 0xCF, 0x06, 0x89, 0x14, 0x1D,
-    0x7B, 0x09, 0x6A, 0xCD, 0x9D, 0x61, 0x29, 0x26, 0xA0, 0x7F, 0x24, 0xC0, 0xA4, 0x10, 0x0D, 0x17,
-    0x3D, 0xD4, 0x94, 0xDB, 0xF8, 0x2E, 0x26, 0x8A, 0xC3, 0xBB, 0xB3, 0x6B, 0x65, 0xEE, 0x2E, 0xDE,
-    0x6B, 0x93, 0x4B, 0xB7, 0xFB, 0x22, 0xBE, 0xD3, 0xA1, 0x49, 0x8D, 0xCF, 0xDE, 0xEE, 0xBA, 0xFC,
-    0x62, 0x53, 0xB8, 0xE4, 0x36, 0x26, 0xE8, 0x4B, 0x9D, 0x7B, 0x11, 0x6A, 0x6C, 0x56, 0x16, 0x15,
-    0x0A, 0x93, 0x06, 0x85, 0x53, 0x7C, 0x18, 0x15, 0xDC, 0x83, 0x3E, 0x74, 0x9F, 0x4D, 0x80, 0x36,
-    0x84, 0x9F, 0x03, 0x7F, 0x0E, 0x5B, 0x9E, 0x34, 0x86, 0x99, 0x38, 0xF8, 0x2D, 0xF7, 0xE0, 0xD5,
-    0xF1, 0xA7, 0x55, 0x4A, 0xE8, 0xAD, 0xE4, 0x2C, 0x80, 0xF2, 0xD5, 0xE5, 0x36, 0x04, 0x36, 0x6F,
-    0xE7, 0xE3, 0xB6, 0xA0, 0x42, 0x41, 0xD4, 0x06, 0xCC, 0xD6, 0xD8, 0xBC, 0x8D, 0xD6, 0xE6, 0xAD,
-    0x93, 0xC2, 0x4F, 0x5B, 0x81, 0xDF, 0xBE, 0xFB, 0x8D, 0x61, 0xAC, 0xD2, 0x0D, 0x7C, 0x65, 0xBB,
-    0x9A, 0x7E, 0xC4, 0x4F, 0x55, 0x21, 0x1E, 0x02, 0x57, 0xC8, 0xF4, 0x52, 0xBB, 0xBB, 0x45, 0xE3,
-    0xCA, 0xA4, 0x93, 0x59, 0x66, 0xC1, 0x81, 0x0B, 0x6D, 0xE3, 0x39, 0xCB, 0x78, 0x6D, 0xB7, 0x68,
-    0x74, 0x2F, 0x38, 0xA6, 0x3B, 0x4D, 0x75, 0xFF, 0xA8, 0xA6, 0xF4, 0xC3, 0x36, 0xF3, 0x0B, 0x90,
-    0xAF, 0x60, 0x66, 0xB5, 0x59, 0x7F, 0x42, 0x06, 0x27, 0xB3, 0xB3, 0x03, 0x15, 0x12, 0x43, 0x2F,
-    0xAD, 0xEE, 0x94, 0xC6, 0x57, 0xFE, 0x15, 0xB5, 0xD4, 0x42, 0x94, 0x41, 0xB3, 0x3A, 0x3E, 0xF3,
-    0x01, 0x9A, 0x45, 0x65, 0xE2, 0xCF, 0x36, 0x76, 0x8F, 0x49, 0x0E, 0xAD, 0x19, 0x01, 0x1E, 0xFB,
-    0x93, 0x7C, 0xF7, 0x67, 0x54, 0x74, 0x13, 0xEA, 0xAA, 0x50, 0x4B, 0xC0, 0x47, 0x40, 0x27, 0x79,
-    0x49, 0x5B, 0x48, 0xD8, 0x99, 0x14, 0x75, 0x5F, 0x6D, 0x70, 0x07, 0xCD, 0x66, 0xD7, 0x2A, 0x4C,
-    0xDF, 0x7E, 0xC4, 0xA9, 0x8E, 0x60, 0x5F, 0x82, 0xAF, 0x1E, 0xC1, 0x9A, 0x64, 0x3A, 0x4A, 0xCF,
-    0xF9, 0x11, 0xD9, 0x0A, 0x9F, 0xEF, 0xEE, 0x23, 0x73, 0x23, 0x32, 0x21, 0x91, 0x87, 0x9E, 0x4E,
-    0xA9, 0x02, 0x52, 0xD6, 0xC9, 0x62, 0xEE, 0xAB, 0xAC, 0x2D, 0x76, 0xFC, 0x4B, 0x03, 0x05, 0x05,
-    0x09, 0x17, 0xB8, 0x39, 0xE4, 0xC4, 0x99, 0x43, 0x7A, 0xBC, 0xD3, 0xEA, 0x74, 0x41, 0x7B, 0x04,
-    0x4A, 0xA3, 0x8E, 0xC2, 0xC5, 0xBF, 0xE6, 0x4F, 0x75, 0x05, 0x95, 0x1B, 0x48, 0xAD, 0x4C, 0x82,
-    0x37, 0x93, 0xD5, 0xFE, 0xA3, 0x3E, 0x6C, 0x86, 0x2E, 0xD0, 0x1B, 0x7A, 0xD9, 0xCF, 0xF1, 0x17,
-    0x40, 0x5B, 0xA2, 0x80, 0x1A, 0x3E, 0x6D, 0x03, 0xB5, 0x35, 0x26, 0x27, 0x6B, 0x11, 0xB2, 0xA1,
-    0x7E, 0x44, 0x5B, 0x75, 0xDA, 0xD0, 0x6A, 0x8F, 0x7E, 0xC8, 0x7F, 0x09, 0x8D, 0x13, 0x62, 0x09,
-    0x10, 0x05, 0x13, 0x9A, 0x1C, 0xEC, 0xA5, 0x81, 0x48, 0xE5, 0xA3, 0x0B, 0x5E, 0xDF, 0xD8, 0x25,
-    0x8F, 0xE6, 0x64, 0xB8, 0xEF, 0xCD, 0xD9, 0x40, 0xB2, 0xC8, 0x88, 0x27, 0xF0, 0x4D, 0x23, 0x40,
-    0xC2, 0xAC, 0x6E, 0x1F, 0x9E, 0xD8, 0x96, 0x73, 0xC3, 0xBB, 0xF2, 0x61, 0xBB, 0x4F, 0x0D, 0x52,
-    0xF7, 0xC1, 0xF6, 0xF7, 0x7B, 0x1B, 0x8F, 0x83, 0x1B, 0x58, 0x05, 0x99, 0xCD, 0x3C, 0x7D, 0xD2,
-    0xFD, 0x95, 0xCD, 0xBB, 0xDF, 0x30, 0xEB, 0xDC, 0xC1, 0xBD, 0xAE, 0xC6, 0xAD, 0xC8, 0xE7, 0xC9,
-    0x7F, 0xF0, 0x2B, 0xC3, 0x57, 0xD7, 0xB1, 0xB7, 0xE1, 0x71, 0xEB, 0x0C, 0xF6, 0xCD, 0xAA, 0x67,
-    0x0E, 0xFC, 0xA0, 0x88, 0xA0, 0xFE, 0x4C, 0x05, 0x9A, 0x18, 0xF7, 0xD0, 0x66, 0x3D, 0x8E, 0x31,
-    0x78, 0xE4, 0x59, 0x42, 0xDE, 0x96, 0x56, 0x1E, 0x28, 0x22, 0xD7, 0x9D, 0xA4, 0x65, 0x89, 0xA1,
-    0x97, 0x75, 0x1F, 0xBC, 0xF0, 0x4A, 0x21, 0x9F, 0xC5, 0x7C, 0xBC, 0x0B, 0x22, 0x9B, 0x53, 0x74,
-    0x1B, 0xEF, 0xCF, 0x6F, 0x90, 0x94, 0xF7, 0x08, 0xDC, 0x06, 0x89, 0xE6, 0x6D, 0xA0, 0xC1, 0x1C,
-    0x55, 0xAA, 0x13, 0xF2, 0x15, 0x14, 0x5E, 0xF1, 0x95, 0xDF, 0xAE, 0x92, 0x0E, 0x77, 0x4E, 0x3D,
-    0xEF, 0x74, 0x17, 0x50, 0xE8, 0x2A, 0x2A, 0x10, 0x35, 0xEF, 0x6C, 0x78, 0xE7, 0x59, 0x3D, 0xCE,
-    0xBA, 0x72, 0x68, 0x59, 0x73, 0xFE, 0x04, 0x48, 0xA1, 0xF5, 0x23, 0xA3, 0x66, 0x74, 0xDD, 0xDF,
-    0xC6, 0xB3, 0x17, 0xD1, 0x0D, 0x59, 0x25, 0xB3, 0xEF, 0x6D, 0xBC, 0xFF, 0xAB, 0xBA, 0xAA, 0x16,
-    0x1E, 0xD6, 0xC4, 0x6F, 0xE9, 0xA6, 0xF8, 0x32, 0xB5, 0x61, 0x63, 0x0F, 0xDF, 0xDE, 0xA6, 0x0F,
-    0x70, 0xE1, 0x80, 0xCD, 0x8E, 0x1B, 0xB3, 0x98, 0xF8, 0xFF, 0xF4, 0xE7, 0xAE, 0xF6, 0x02, 0x4E,
-    0xE0, 0x16, 0x67, 0x0D, 0xC1, 0x05, 0xFA, 0x70, 0x81, 0x2F, 0xCC, 0x33, 0xDF, 0xC5, 0xB4, 0x25,
-    0x40, 0x88, 0xF8, 0x9F, 0xFB, 0xD3, 0xD0, 0x57, 0xF1, 0x39, 0xA8, 0xA7, 0xF9, 0x3B, 0x83, 0x03,
-    0x17, 0x75, 0xB4, 0xEB, 0xDD, 0x20, 0x86, 0x1B, 0xDC, 0x8D, 0x9E, 0x46, 0x58, 0xF2, 0x56, 0xF7,
-    0x1A, 0xBA, 0xEC, 0x62, 0x9B, 0xEC, 0x66, 0x2D, 0x64, 0x90, 0xF7, 0x31, 0xE1, 0x1A, 0x86, 0x2E,
-    0x92, 0x53, 0x8C, 0xD2, 0x70, 0x53, 0x90, 0x77, 0xA0, 0xE5, 0x23, 0xE9, 0xC3, 0x01, 0x1D, 0xAB,
-    0x2D, 0x69, 0x43, 0xA2, 0xA6, 0x81, 0xD7, 0x64, 0xDD, 0xF2, 0x17, 0x38, 0x6F, 0x06, 0xFE, 0x05,
-    0x26, 0x1C, 0x32, 0xAA, 0xDF, 0x00, 0x63, 0x93, 0xE3, 0x86, 0x91, 0xB9, 0x01, 0x56, 0x04, 0x51,
-    0xB3, 0x12, 0xB2, 0x19, 0x0D, 0xA7, 0xC2, 0x9D, 0x27, 0x81, 0x36, 0x5E, 0x69, 0xA8, 0xA9, 0x47,
-    0xC3, 0x3E, 0x4C, 0xF1, 0xA3, 0xE1, 0x24, 0x22, 0x6F, 0x1B, 0x66, 0x7F, 0x49, 0x79, 0x41, 0x10,
-    0x1C, 0x13, 0xB8, 0x1F, 0x0B, 0x26, 0x6F, 0x7E, 0x21, 0x48, 0x2A, 0xB4, 0xEF, 0x42, 0x17, 0xF4,
-    0x49, 0xB9, 0xE4, 0x49, 0x31, 0x4D, 0x97, 0x9E, 0x3C, 0xA3, 0x02, 0x14, 0xBF, 0x0C, 0x19, 0xFB,
-    0x06, 0x88, 0xC0, 0xED, 0xBF, 0xF5, 0xA6, 0xD9, 0x60, 0x26, 0x32, 0x38, 0x9C, 0x7D, 0x96, 0x80,
-    0x2C, 0x92, 0x1D, 0x00, 0x88, 0x7D, 0x74, 0xF1, 0x4C, 0xC7, 0x39, 0x2B, 0xB0, 0x36, 0x7A, 0x10,
-    0xE6, 0x6B, 0x93, 0xD8, 0xA1, 0xAE, 0x8E, 0x26, 0x58, 0x08, 0xB0, 0x61, 0x63, 0x00, 0x9E, 0xF1,
-    0xE7, 0xE9, 0xC3, 0xA2, 0xC4, 0x20, 0xA7, 0xE5, 0x90, 0x9C, 0xA7, 0xA9, 0x91, 0x38, 0xE0, 0x43,
-    0x05, 0xA3, 0x41, 0xC7, 0x99, 0x95, 0xE7, 0x29, 0x80, 0xDB, 0x90, 0x94, 0x4D, 0x46, 0x9C, 0xA1,
-    0x87, 0xD0, 0x63, 0x78, 0x61, 0x2A, 0x04, 0xFD, 0x53, 0x36, 0x54, 0x73, 0xE0, 0x13, 0x42, 0xCD,
-    0x83, 0x22, 0x68, 0x37, 0x5A, 0x8A, 0xA0, 0x61, 0x6B, 0x8E, 0x36, 0x11, 0xC1, 0xE3, 0x4D, 0x12,
-    0x41, 0x25, 0x7B, 0xE1, 0x01, 0x11, 0x24, 0x8D, 0x65, 0x78, 0xD1, 0xFB, 0x5B, 0xA4, 0xE0, 0xF9,
-    0xEF, 0x13, 0xF3, 0x0D, 0xAA, 0x21, 0x31, 0x19, 0xEE, 0x99, 0xFA, 0xDA, 0xC4, 0xD9, 0xF7, 0x08,
-    0x38, 0xFC, 0x1D, 0xA9, 0x54, 0x95, 0xBA, 0x2F, 0x05, 0x48, 0x2D, 0x66, 0xE8, 0x42, 0xB7, 0x7D,
-    0x63, 0xEF, 0xE0, 0x8E, 0x53, 0xEE, 0xE2, 0xCE, 0x9D, 0xA6, 0xEB, 0x9F, 0xCF, 0xC6, 0x99, 0x2E,
-    0x7F, 0x8D, 0x5B, 0x90, 0x56, 0x1F, 0x71, 0xC2, 0xDB, 0x4A, 0x52, 0x5B, 0x50, 0xE8, 0x19, 0xCC,
-    0x6B, 0xE0, 0xF0, 0x4A, 0x25, 0x8F, 0x3F, 0xF9, 0xB9, 0xFB, 0x00, 0x58, 0x07, 0xB0, 0x9F, 0xC8,
-    0xDB, 0xBC, 0x48, 0x72, 0x23, 0x29, 0x64, 0x20, 0xEA, 0x4F, 0x70, 0x20, 0x06, 0x41, 0x92, 0x02,
-    0x43, 0xF9, 0x5E, 0x90, 0x96, 0x98, 0xB0, 0x65, 0xD4, 0x80, 0xD4, 0x81, 0xB7, 0xA0, 0xE1, 0x60,
-    0x84, 0x67, 0xAC, 0x49, 0x86, 0x0D, 0x22, 0x55, 0x35, 0x02, 0x14, 0xF3, 0x5F, 0xF7, 0x8E, 0x34,
-    0xEF, 0x01, 0xB5, 0x32, 0x42, 0xD2, 0x40, 0xDA, 0x5E, 0xB0, 0x44, 0x8E, 0xED, 0x63, 0xF6, 0x57,
-    0x36, 0x76, 0x8F, 0xCA, 0x29, 0x25, 0xE8, 0x61, 0xA6, 0x7C, 0x31, 0xDB, 0xA4, 0x05, 0x76, 0xA6,
-    0x9B, 0xC2, 0xAF, 0xF6, 0xBB, 0x27, 0x58, 0x42, 0xC5, 0x86, 0xFB, 0x46, 0xFB, 0xF9, 0x67, 0x41,
-    0x9E, 0x47, 0x2C, 0xE0, 0x80, 0x5D, 0x13, 0xB6, 0xE6, 0x82, 0x3D, 0xB4, 0xC4, 0xC5, 0x4F, 0x88,
-    0x6B, 0x8F, 0x8F, 0xFE, 0x5D, 0x8E, 0x6B, 0x5A, 0x19, 0x3B, 0x08, 0x8E, 0x7E, 0x2A, 0x98, 0x3B,
-    0xF8, 0x76, 0xF0, 0xC3, 0x80, 0x80, 0x3E, 0x28, 0xAE, 0xD2, 0xCD, 0x87, 0xCF, 0xC4, 0xF2, 0x51,
-    0x58, 0xD5, 0x69, 0x76, 0xEB, 0x15, 0x23, 0x40, 0x31, 0x4F, 0x5C, 0x30, 0xA3, 0xCD, 0x32, 0xEC,
-    0xA7, 0x6C, 0x38, 0x3D, 0x57, 0x54, 0xC0, 0x1B, 0x37, 0x03, 0x45, 0xD7, 0xB8, 0x75, 0x18, 0x5D,
-    0x1C, 0x9C, 0x9A, 0xB1, 0xEC, 0x9F, 0xF5, 0x12, 0x1F, 0x95, 0x23, 0xD4, 0x40, 0xE9, 0x53, 0xB2,
-    0x5D, 0x92, 0x41, 0xC9, 0x70, 0x7B, 0x96, 0xCD, 0xF8, 0x04, 0x50, 0x14, 0xF4, 0xB0, 0x82, 0xB1,
-    0xC2, 0x38, 0xA3, 0x00, 0x19, 0xE5, 0x89, 0x24, 0x9D, 0xDC, 0xDA, 0x45, 0xB9, 0x7E, 0xA0, 0xB7,
-    0x7B, 0x3C, 0xCC, 0x62, 0x2A, 0xDB, 0xCB, 0x03, 0x5A, 0xC6, 0xF8, 0x96, 0x45, 0xD2, 0x02, 0xC7,
-    0xE0, 0xD0, 0x60, 0x2E, 0xE8, 0x00, 0x16, 0x47, 0xC5, 0x01, 0x33, 0xBF, 0x62, 0x9B, 0x13, 0x50,
-    0x06, 0x98, 0x73, 0x7A, 0xAD, 0xC9, 0x4B, 0x08, 0xA6, 0x4B, 0x2D, 0x7D, 0x37, 0xC5, 0xA9, 0x8E,
-    0xDC, 0x03, 0x28, 0x86, 0xD8, 0xD0, 0xCB, 0x52, 0x00, 0xD5, 0x81, 0x1D, 0x00, 0x95, 0x9B, 0x1E,
-    0x0B, 0x1A, 0x03, 0xD8, 0x83, 0x34, 0x5D, 0x92, 0xAB, 0xCA, 0x42, 0x5E, 0xE0, 0xFD, 0x26, 0x70,
-    0x29, 0x50, 0x02, 0x2F, 0x7F, 0x5B, 0xF1, 0x16, 0x2E, 0x56, 0x19, 0x30, 0x5C, 0xD6, 0x25, 0x54,
-    0x1D, 0x80, 0x3E, 0x27, 0x10, 0x22, 0xBF, 0x40, 0xF1, 0x85, 0xFB, 0x9D, 0x9B, 0xC5, 0x1F, 0x74,
-    0x9E, 0x9D, 0xDE, 0xB3, 0x93, 0x33, 0x4F, 0x86, 0x12, 0xFA, 0x19, 0xBD, 0xD1, 0x0A, 0x0E, 0x10,
-    0x87, 0x54, 0x27, 0xD3, 0xC8, 0x92, 0x8F, 0x08, 0xD2, 0xE2, 0x2F, 0x2C, 0x38, 0xC0, 0x20, 0xC0,
-    0xB0, 0x0F, 0x01, 0x3A, 0x2A, 0x4C, 0x44, 0x1B, 0x45, 0x1D, 0x99, 0x3D, 0x5A, 0x43, 0x6C, 0x00,
-    0xB8, 0x8E, 0x86, 0x6D, 0x3F, 0x5F, 0xDE, 0x45, 0xE7, 0xF0, 0x7B, 0x6B, 0x10, 0x76, 0xF5, 0xC2,
-    0xD1, 0xC6, 0xE1, 0x03, 0xD9, 0xD3, 0xC7, 0x6F, 0xAC, 0xEE, 0xF2, 0x7B, 0x33, 0x3E, 0x5D, 0x49,
-    0xE5, 0x8D, 0xBA, 0x43, 0x7E, 0xA9, 0xA0, 0x4B, 0x19, 0x2B, 0xE4, 0x33, 0x9A, 0x1B, 0x18, 0x59,
-    0x31, 0x04, 0x3A, 0xEA, 0xFD, 0x2E, 0x49, 0x8B, 0xA6, 0x57, 0xBD, 0x97, 0x4E, 0xB1, 0xEB, 0x34,
-    0x84, 0x0D, 0xC1, 0xF4, 0xE5, 0x8E, 0x9C, 0x79, 0xE2, 0x47, 0x13, 0xBF, 0xA6, 0xC5, 0x9E, 0xDB,
-    0xDB, 0x7A, 0x33, 0x12, 0x5F, 0x98, 0x48, 0x62, 0xCD, 0x64, 0xAD, 0x2D, 0x65, 0xE5, 0x21, 0xB6,
-    0x97, 0x04, 0x31, 0xC6, 0xB5, 0xA0, 0x4D, 0x25, 0xAD, 0x69, 0x12, 0x79, 0x19, 0x95, 0xD8, 0x3D,
-    0x71, 0x4B, 0x3C, 0xA9, 0x2B, 0xE4, 0xFF, 0xC6, 0xC7, 0x47, 0xD6, 0xB4, 0x34, 0xA8, 0x83, 0x76,
-    0x0B, 0x7F, 0x06, 0x23, 0xE4, 0xEF, 0x81, 0x47, 0xFA, 0x0E, 0x53, 0xB4, 0xFA, 0x87, 0x79, 0x25,
-    0xF3, 0x11, 0x6D, 0xF5, 0x32, 0x3B, 0xCA, 0x2E, 0x4E, 0xED, 0xBE, 0x4B, 0x86, 0xED, 0xBD, 0x2D,
-    0x88, 0x74, 0x69, 0x2E, 0xB4, 0xF9, 0x57, 0x59, 0x33, 0xB9, 0x44, 0xB9, 0x02, 0x15, 0x33, 0xE7,
-    0xE3, 0x53, 0x43, 0x31, 0x47, 0x47, 0x7B, 0xBE, 0x99, 0xF7, 0x43, 0x79, 0xEE, 0x0B, 0x72, 0xA4,
-    0xF8, 0x36, 0xBB, 0x6E, 0x48, 0x71, 0x2D, 0x5B, 0xC8, 0xD3, 0x19, 0xD3, 0xF2, 0xF0, 0xBA, 0x53,
-    0xB4, 0x48, 0x17, 0x98, 0x79, 0x31, 0x95, 0x45, 0xBF, 0x2B, 0xCE, 0x40, 0xEA, 0xED, 0xB4, 0xC5,
-    0x2C, 0x6E, 0x8A, 0x93, 0x98, 0xA1, 0x51, 0x4B, 0xED, 0xB6, 0x78, 0x75, 0x98, 0xD2, 0x88, 0x80,
-    0x49, 0x5A, 0xCC, 0xFD, 0xCB, 0x5D, 0xD4, 0x46, 0x2D, 0xFA, 0x04, 0x5A, 0x83, 0xDC, 0x07, 0x41,
-    0xAE, 0x1E, 0xE4, 0x34, 0xBD, 0x87, 0xCF, 0xE6, 0x78, 0xC7, 0xB4, 0x4B, 0x17, 0x60, 0x5B, 0x39,
-    0xC3, 0x40, 0x64, 0x72, 0x19, 0x8C, 0x40, 0x5C, 0xB6, 0xD3, 0x40, 0xAF, 0x4B, 0x6A, 0xE8, 0xB9,
-    0xD0, 0x2E, 0xE2, 0xBA, 0x38, 0xD5, 0xA2, 0x56, 0x80, 0xA7, 0x53, 0xBA, 0x17, 0x93, 0xDE, 0xE2,
-    0x1D, 0xBC, 0xC5, 0xD6, 0x78, 0x19, 0x3B, 0xD9, 0x0A, 0x2A, 0x4D, 0xD9, 0x82, 0x07, 0x36, 0x04,
-    0x7D, 0xDB, 0xCB, 0xCB, 0xA1, 0xB6, 0x14, 0xD7, 0xCF, 0xED, 0x9E, 0x68, 0x2D, 0xFC, 0xA6, 0xB3,
-    0x43, 0x6F, 0x87, 0x81, 0xDA, 0xF9, 0x4E, 0xEB, 0xED, 0x40, 0xDB, 0x8E, 0x7B, 0x19, 0x0D, 0x02,
-    0x03, 0x62, 0xBB, 0x30, 0x43, 0xA2, 0x36, 0xAD, 0x8A, 0xF3, 0x6A, 0x5A, 0x71, 0x01, 0xCD, 0x4A,
-    0x9A, 0x62, 0x47, 0xAD, 0x2B, 0x2E, 0x61, 0x87, 0x8A, 0xA2, 0x77, 0x2A, 0xC6, 0x9A, 0xE5, 0x20,
-    0x9F, 0x1A, 0xF5, 0x9A, 0x4F, 0xA1, 0xA6, 0xDC, 0x00, 0x9B, 0xC5, 0xCF, 0x1E, 0x17, 0x42, 0xB4,
-    0x82, 0xC0, 0xEC, 0x44, 0x33, 0xB5, 0x0F, 0x4A, 0x9A, 0x2C, 0xB2, 0x2B, 0xC5, 0xCD, 0xFB, 0x6D,
-    0x5C, 0x27, 0x77, 0x3A, 0x3F, 0xED, 0xA2, 0xC6, 0xA7, 0xA5, 0xC3, 0xAD, 0x17, 0xBA, 0xEC, 0xAD,
-    0x21, 0xA9, 0xFD, 0x57, 0x6B, 0xF7, 0x52, 0x97, 0xFE, 0x92, 0x3D, 0x10, 0x76, 0xA2, 0x33, 0x39,
-    0x3A, 0x2D, 0x4E, 0xC2, 0x5A, 0x82, 0xF6, 0xCE, 0x35, 0xE8, 0x33, 0x32, 0x3B, 0xBA, 0x72, 0x18,
-    0x41, 0x52, 0x09, 0x74, 0x9B, 0x4B, 0x7C, 0x16, 0xD8, 0x5C, 0xE4, 0x33, 0xB3, 0x89, 0xDF, 0xBE,
-    0x47, 0xDB, 0x71, 0x71, 0x01, 0x4D, 0x7F, 0x4B, 0x20, 0x32, 0xEA, 0x18, 0x8F, 0x01, 0x92, 0x2D,
-    0x69, 0x95, 0x04, 0xCC, 0x24, 0x8D, 0x53, 0x1D, 0xA5, 0xA6, 0x03, 0xDA, 0xA7, 0x0F, 0x5C, 0xE6,
-    0xD2, 0x36, 0xD1, 0xA7, 0x17, 0xE0, 0xDB, 0x43, 0x0C, 0xC5, 0x74, 0x57, 0x5C, 0x67, 0x41, 0xEA,
-    0x20, 0xEC, 0x57, 0x97, 0x56, 0xC9, 0x6D, 0x74, 0x46, 0x9F, 0x5D, 0x68, 0xB2, 0xF3, 0x5D, 0x7E,
-    0xB2, 0xE3, 0xFE, 0xC5, 0x2E, 0x7D, 0x07, 0x92, 0x19, 0x98, 0x91, 0x8D, 0x6E, 0xD3, 0x9A, 0xFA,
-    0x21, 0xCD, 0xA8, 0x5E, 0x2F, 0x56, 0x57, 0xE0, 0xCB, 0x90, 0xBA, 0x23, 0x2B, 0xC8, 0x19, 0x53,
-    0x06, 0x22, 0x2A, 0x65, 0x05, 0x05, 0xC5, 0xD3, 0xCD, 0xC9, 0xD8, 0x20, 0xCD, 0x31, 0x85, 0x12,
-    0x7A, 0x19, 0x19, 0xF5, 0x13, 0x0F, 0xED, 0xF9, 0xA2, 0x62, 0x23, 0x1C, 0x06, 0x05, 0x7F, 0xB3,
-    0x1A, 0xAF, 0x9D, 0x0E, 0x50, 0x11, 0xA1, 0x44, 0xFB, 0x17, 0xD1, 0x77, 0x3C, 0x71, 0x0B, 0xA8,
-    0xA8, 0x59, 0x05, 0x90, 0x70, 0xCB, 0xD3, 0xBC, 0x0F, 0x22, 0xDE, 0x21, 0x70, 0xC1, 0xC4, 0x0A,
-    0xE5, 0x19, 0xE1, 0xBE, 0x76, 0x62, 0x19, 0x4E, 0x16, 0x1C, 0xA7, 0x89, 0xE0, 0x02, 0x8C, 0x8E,
-    0x2A, 0xD9, 0x68, 0xDF, 0xDB, 0xD8, 0xCD, 0xDC, 0x71, 0xD6, 0xDB, 0x4D, 0xFA, 0xFC, 0x4C, 0xE5,
-    0xA6, 0x5D, 0x7E, 0xBA, 0x76, 0x61, 0x9B, 0x9F, 0xAA, 0x5D, 0xD4, 0xE4, 0x27, 0x5B, 0x17, 0xD7,
-    0x68, 0xBE, 0x03, 0x69, 0xBF, 0xCA, 0x69, 0xF5, 0x74, 0x90, 0xCD, 0xD5, 0x6F, 0x7D, 0x10, 0xEE,
-    0xC9, 0xC1, 0x46, 0x59, 0xB5, 0x2B, 0x73, 0x36, 0xBF, 0x5B, 0xA5, 0xBB, 0x27, 0xFC, 0xEC, 0x4D,
-    0xE9, 0x14, 0xF2, 0xE1, 0xD1, 0x0F, 0x83, 0xCA, 0x1D, 0x36, 0xBB, 0x3E, 0xF5, 0xDE, 0x3D, 0x81,
-    0x4B, 0xCE, 0xD6, 0x66, 0xC4, 0xA4, 0x72, 0x1A, 0x48, 0xF5, 0xEF, 0x68, 0xBF, 0x9D, 0x67, 0x06,
-    0xBB, 0x69, 0x4F, 0xDC, 0x0D, 0x8A, 0xF7, 0x67, 0xC6, 0x0C, 0x69, 0xFF, 0x0E, 0xC7, 0xF0, 0xB0,
-    0x46, 0xB6, 0x77, 0x33, 0x74, 0xCF, 0x26, 0x6F, 0x46, 0xE8, 0xB3, 0x49, 0x97, 0xFF, 0x80, 0x06,
-    0xB5, 0xC3, 0xA6, 0xB8, 0x57, 0x04, 0x30, 0x4F, 0x31, 0xAC, 0x44, 0x4A, 0x40, 0xCC, 0x27, 0x30,
-    0x00, 0x9C, 0x61, 0x54, 0x34, 0x36, 0x5B, 0x63, 0xB1, 0xFC, 0x74, 0xDA, 0xD1, 0x6A, 0x80, 0xB7,
-    0x56, 0xB4, 0xB1, 0x16, 0x57, 0x66, 0xE8, 0x2A, 0x53, 0xA0, 0x0B, 0x53, 0x16, 0x48, 0xF1, 0x44,
-    0x85, 0xE4, 0x00, 0xF3, 0xFC, 0x22, 0xED, 0x06, 0x9D, 0x4C, 0x08, 0x8F, 0x3B, 0x25, 0xB7, 0xC8,
-    0x77, 0x68, 0x6E, 0xE8, 0x18, 0x2C, 0x04, 0x7A, 0x7C, 0xA9, 0xCB, 0x9A, 0xC4, 0x8F, 0x76, 0x36,
-    0x73, 0x73, 0xA0, 0x26, 0xDF, 0x81, 0x40, 0x31, 0x23, 0xF5, 0xE8, 0x3C, 0x79, 0xF0, 0x74, 0x64,
-    0xA3, 0x0F, 0x75, 0xB1, 0x8C, 0x85, 0xFC, 0x08, 0x45, 0x22, 0x88, 0x85, 0xDF, 0x2A, 0x2E, 0x35,
-    0x09, 0x43, 0x30, 0x68, 0xDF, 0x40, 0x21, 0xDD, 0x68, 0xA8, 0xCB, 0x35, 0x16, 0xDE, 0x5B, 0x2B,
-    0xAC, 0x64, 0x0F, 0x01, 0x7D, 0xD6, 0xFE, 0x57, 0xBD, 0xA3, 0xEE, 0x28, 0xD3, 0x39, 0x26, 0x64,
-    0xAC, 0x9A, 0x8D, 0xEE, 0xB9, 0xC7, 0x7F, 0x7D, 0xB4, 0xFF, 0x2A, 0x5A, 0xCC, 0x9E, 0x64, 0x77,
-    0xBD, 0x0E, 0x98, 0x44, 0x36, 0x48, 0x91, 0x91, 0x57, 0xA0, 0x03, 0x7A, 0x49, 0xE9, 0xA2, 0xB9,
-    0x7B, 0xFC, 0xB8, 0xFC, 0x77, 0xEB, 0x4E, 0xC1, 0x0D, 0xCA, 0xDB, 0xCB, 0x24, 0xA6, 0x1A, 0x77,
-    0x92, 0xEC, 0xA1, 0x22, 0x87, 0x9C, 0x8B, 0x81, 0x03, 0x35, 0x11, 0x84, 0x2A, 0x9E, 0x01, 0x17,
-    0xE5, 0x6B, 0xDE, 0xF7, 0x72, 0x98, 0x59, 0x6F, 0x21, 0xB3, 0xDE, 0xEE, 0x66, 0x4B, 0x8B, 0x39,
-    0x8D, 0x1A, 0xEE, 0xFA, 0x39, 0x6A, 0xFC, 0xB6, 0xE1, 0x5C, 0x86, 0x0E, 0x68, 0xE9, 0xD9, 0xAE,
-    0x5C, 0xB0, 0xF5, 0xBA, 0x39, 0xDE, 0x11, 0x79, 0x52, 0xC3, 0xF7, 0xEF, 0x92, 0xFB, 0xD0, 0xCD,
-    0x5C, 0xEC, 0xC9, 0xF1, 0x4A, 0xE3, 0x15, 0x30, 0xC0, 0x2C, 0x52, 0xE0, 0x20, 0x85, 0x05, 0x9D,
-    0x8B, 0x14, 0xF0, 0x00, 0x4D, 0xE0, 0x4C, 0xE8, 0x72, 0x3E, 0xF6, 0x32, 0x29, 0xE8, 0x97, 0x54,
-    0xEB, 0x69, 0xE0, 0x92, 0x65, 0x3C, 0x48, 0x6F, 0x8A, 0x56, 0x15, 0x51, 0x28, 0x39, 0xDE, 0x07,
-    0x23, 0x92, 0x93, 0x97, 0xB7, 0x0D, 0xC4, 0xFC, 0xFD, 0xBB, 0xD0, 0x6E, 0x06, 0xA0, 0x22, 0xFF,
-    0xE7, 0x64, 0x47, 0x98, 0xCB, 0xC0, 0x68, 0x73, 0x3A, 0x33, 0xA8, 0x8A, 0xBD, 0xDD, 0x43, 0x57,
-    0x40, 0x17, 0x27, 0xF7, 0x88, 0xE2, 0xE9, 0xD0, 0x96, 0x57, 0x77, 0xB0, 0xE0, 0x39, 0x4D, 0xB0,
-    0x43, 0x47, 0x09, 0x6E, 0x19, 0x99, 0x06, 0x88, 0x43, 0x5B, 0x5A, 0x9B, 0x73, 0x58, 0xC2, 0x9A,
-    0x2D, 0x7B, 0x66, 0x1C, 0x1A, 0x33, 0xDD, 0x30, 0xEA, 0xEC, 0x0C, 0xA5, 0xED, 0xBB, 0x0C, 0x56,
-    0xF9, 0x7B, 0x85, 0xF0, 0x25, 0x74, 0xC7, 0x85, 0xBD, 0xC5, 0xAE, 0xE2, 0xDB, 0xB4, 0xEE, 0xE0,
-    0x5E, 0x79, 0x8E, 0x80, 0xA3, 0xC9, 0xB9, 0x16, 0x86, 0x60, 0x83, 0xE2, 0x34, 0x51, 0xF9, 0x1D,
-    0x4E, 0x98, 0x5E, 0x28, 0x80, 0xDD, 0x26, 0x1B, 0x9E, 0xB5, 0x52, 0x53, 0x99, 0xB3, 0xF7, 0xC8,
-    0x0B, 0x47, 0x2D, 0x56, 0x2E, 0xB9, 0x85, 0x9A, 0xE6, 0x2F, 0xE3, 0x22, 0x25, 0xE3, 0xB2, 0x3A,
-    0x9F, 0x5A, 0xD3, 0xF7, 0xFF, 0x30, 0xA6, 0x61, 0x69, 0xB6, 0x19, 0x7B, 0x38, 0xB7, 0x68, 0x2A,
-    0x92, 0xE4, 0x96, 0xAC, 0x0A, 0x54, 0x2E, 0x42, 0xE3, 0x17, 0x59, 0x63, 0x91, 0x20, 0xC5, 0x65,
-    0x36, 0xF3, 0x3C, 0x7D, 0xB8, 0xF8, 0x15, 0xD1, 0xAB, 0xE5, 0x4F, 0x4A, 0x1A, 0x13, 0x63, 0xC9,
-    0x31, 0x40, 0x7F, 0x56, 0xD4, 0x2B, 0xD6, 0x0F, 0x7F, 0x55, 0x44, 0x29, 0xC3, 0x69, 0x51, 0x94,
-    0x49, 0x4D, 0x8D, 0x84, 0x3C, 0xC4, 0xBF, 0xD2, 0x84, 0x0A, 0x0B, 0x8B, 0x7A, 0x45, 0x95, 0xD2,
-    0x28, 0x7A, 0xB3, 0xB2, 0x2F, 0x4E, 0x3D, 0x61, 0xD8, 0x7F, 0x43, 0xF5, 0xD9, 0x59, 0x56, 0x2F,
-    0x22, 0x15, 0x73, 0x5D, 0x98, 0x2F, 0x63, 0x66, 0x26, 0x55, 0x29, 0xC1, 0xFB, 0x3E, 0x95, 0x62,
-    0xB1, 0x4F, 0x2D, 0xF6, 0xE7, 0xDC, 0x8A, 0x7E, 0xFC, 0xD2, 0xF4, 0xE0, 0x9B, 0x07, 0x6F, 0x1A,
-    0x9B, 0x4D, 0xE5, 0x24, 0x22, 0xFF, 0x2C, 0x73, 0x0E, 0xAE, 0xDC, 0x2D, 0xA0, 0xE6, 0x8C, 0xFE,
-    0x28, 0x08, 0x1C, 0xAA, 0xB6, 0x25, 0x23, 0x8B, 0x68, 0xF0, 0x26, 0x43, 0x90, 0x93, 0x98, 0x82,
-    0x93, 0x56, 0x70, 0xA0, 0xE6, 0x36, 0xB6, 0xC0, 0x22, 0x2F, 0xA7, 0x76, 0xE0, 0x36, 0x08, 0x70,
-    0xF3, 0x2A, 0xDC, 0x63, 0x88, 0x1E, 0x31, 0x39, 0xFD, 0x71, 0xAF, 0x12, 0xD5, 0xD2, 0xDA, 0x8F,
-    0x6A, 0x24, 0x12, 0xCC, 0xF4, 0x1D, 0xD6, 0x16, 0x40, 0xA9, 0x20, 0x8E, 0x67, 0xD6, 0x1A, 0x12,
-    0x77, 0x4B, 0xC7, 0xA4, 0x0D, 0x97, 0xF4, 0x98, 0x60, 0xC4, 0x51, 0xC2, 0xAD, 0x4B, 0x86, 0x6E,
-    0x2A, 0xE7, 0xE1, 0x60, 0xC9, 0x6D, 0x0E, 0xF3, 0xBD, 0xD1, 0x32, 0xD0, 0xD7, 0xE0, 0x42, 0x95,
-    0x0C, 0xD9, 0x45, 0x46, 0xD6, 0x06, 0x69, 0x4B, 0x35, 0xC9, 0x5F, 0x20, 0x07, 0xEA, 0x29, 0x23,
-    0x8A, 0xAB, 0x24, 0xF9, 0x81, 0xA7, 0xF9, 0xAF, 0xF6, 0x4F, 0x2F, 0x0F, 0xD4, 0x26, 0x74, 0xEF,
-    0x79, 0x3E, 0x06, 0xA4, 0x99, 0x9E, 0x32, 0xA0, 0x5B, 0x4D, 0x85, 0xA4, 0xF4, 0x09, 0xC2, 0xD7,
-    0x15, 0x9B, 0x7B, 0x6A, 0xB6, 0x44, 0x9A, 0x39, 0x55, 0x5D, 0x0B, 0xEB, 0x27, 0x3F, 0x82, 0x12,
-    0xEF, 0x6E, 0x36, 0x79, 0x55, 0xFB, 0x1D, 0x3C, 0xC7, 0xE9, 0x95, 0xBF, 0xC3, 0xF8, 0x07, 0x9E,
-    0xDC, 0x58, 0x86, 0xF0, 0x5C, 0x1E, 0x9E, 0x82, 0xE8, 0xBE, 0x3F, 0x98, 0x5E, 0x3C, 0x65, 0xD5,
-    0x0F, 0xD3, 0x90, 0xA4, 0x77, 0x3F, 0xB5, 0x3E, 0x60, 0x45, 0x33, 0x0E, 0xAC, 0x62, 0x41, 0x26,
-    0x23, 0xF9, 0xA6, 0x2F, 0x58, 0xE0, 0xCE, 0xD7, 0xEA, 0xA7, 0xD7, 0x49, 0x62, 0x32, 0xF6, 0xD7,
-    0x18, 0xE5, 0x1E, 0x19, 0x81, 0x07, 0xDF, 0xB2, 0xBE, 0xAB, 0x02, 0xF7, 0x1E, 0xE9, 0x6B, 0x41,
-    0x27, 0x7D, 0x6E, 0x06, 0x99, 0x64, 0xD8, 0x08, 0xFE, 0x60, 0x63, 0x40, 0x6F, 0x3D, 0x4D, 0xA5,
-    0xD2, 0x62, 0xA6, 0x0C, 0x62, 0x71, 0x32, 0x88, 0x9A, 0xDC, 0x85, 0xCE, 0x94, 0x13, 0xFB, 0x4A,
-    0xB1, 0xB3, 0xFF, 0x93, 0xFF, 0x70, 0x35, 0xE2, 0x3F, 0xA2, 0xF9, 0x85, 0x94, 0x6D, 0x42, 0x1B,
-    0xE8, 0x7C, 0xA6, 0x2E, 0xFA, 0x92, 0x0A, 0x5A, 0x1D, 0x43, 0xAF, 0xDC, 0x73, 0xBD, 0x20, 0x1A,
-    0xD9, 0xB5, 0x5C, 0x26, 0xB2, 0xF8, 0x9B, 0x75, 0xEF, 0xE9, 0x51, 0x2B, 0xF8, 0xF6, 0xCC, 0x06,
-    0xFC, 0xAC, 0x45, 0xC5, 0xB3, 0x3E, 0xF9, 0x09, 0xC1, 0xF8, 0xB7, 0xFF, 0xD9, 0xDF, 0xAC, 0xE4,
-    0xCB, 0x18, 0x0E, 0x13, 0x64, 0xEB, 0xED, 0x6C, 0xD6, 0xC9, 0x1C, 0x3A, 0x3B, 0x46, 0xAD, 0x8B,
-    0xE9, 0x63, 0x02, 0xDC, 0xF2, 0x55, 0xB6, 0xFB, 0xAD, 0xC9, 0xF7, 0x15, 0x6E, 0x2B, 0xE7, 0x34,
-    0xDF, 0xC4, 0x48, 0x99, 0x80, 0x6E, 0x96, 0xC9, 0x31, 0x85, 0xCD, 0x2C, 0x7D, 0x2C, 0x8A, 0x02,
-    0x03, 0x13, 0xEC, 0xE8, 0x71, 0xC4, 0xDC, 0xC7, 0x2C, 0xBD, 0x5B, 0xD4, 0xE9, 0x08, 0xA3, 0x19,
-    0xF6, 0x49, 0xEA, 0x56, 0xBD, 0xAD, 0xFB, 0x83, 0xE3, 0xC7, 0x8F, 0x07, 0xC1, 0x38, 0x77, 0x97,
-    0x06, 0x9E, 0xE0, 0xDF, 0x7F, 0xE9, 0x4F, 0x02, 0xB5, 0xEC, 0x73, 0xFB, 0xA3, 0xF9, 0xFF, 0x9E,
-    0x02, 0x1D, 0x4C, 0x8E, 0x1F, 0x3F, 0x2A, 0xCA, 0xEA, 0x8D, 0x3F, 0xB2, 0x4F, 0xA2, 0x70, 0xBE,
-    0x4E, 0x84, 0x81, 0xA2, 0xDB, 0xE3, 0x5D, 0x06, 0x75, 0x93, 0x80, 0x8D, 0xB5, 0x51, 0x95, 0xBD,
-    0x8C, 0x77, 0x88, 0xE1, 0x31, 0xCA, 0x87, 0x17, 0xA7, 0x60, 0x1A, 0x53, 0x68, 0x6D, 0x33, 0xFC,
-    0x85, 0x90, 0x48, 0x2B, 0x47, 0x0B, 0x6D, 0x97, 0xBB, 0x8B, 0x80, 0x96, 0x9B, 0x97, 0xEE, 0xD0,
-    0xDF, 0xFC, 0x33, 0x7C, 0x0A, 0x3A, 0x36, 0x55, 0x9B, 0x9C, 0xA1, 0x78, 0x16, 0x78, 0x3F, 0x7E,
-    0x2A, 0xC3, 0xD0, 0x8F, 0x20, 0xAD, 0x0F, 0x41, 0x32, 0x0B, 0x74, 0xF3, 0x1F, 0xD1, 0x6C, 0x36,
-    0x5D, 0xC6, 0x41, 0x98, 0x3B, 0xA8, 0x54, 0x03, 0x46, 0xEC, 0xD7, 0x2F, 0x2F, 0x79, 0xE3, 0xE3,
-    0xCB, 0x78, 0xAE, 0xF7, 0xBF, 0xAD, 0x77, 0x51, 0x05, 0xA6, 0x10, 0xA8, 0xCC, 0x7E, 0x6B, 0xB7,
-    0x3E, 0xFC, 0x84, 0xB4, 0x43, 0xE7, 0xDE, 0x5B, 0xF4, 0xAB, 0xEF, 0x9E, 0x78, 0x69, 0xDF, 0x5B,
-    0xE6, 0x56, 0x87, 0x48, 0x01, 0xB2, 0xF8, 0xD8, 0x7F, 0xFE, 0x56, 0x22, 0xC8, 0x46, 0x5B, 0x93,
-    0xBC, 0xD8, 0x14, 0x90, 0xE9, 0x83, 0x07, 0x9B, 0x9A, 0xAC, 0x66, 0x19, 0x7C, 0x29, 0xC6, 0x8C,
-    0xD9, 0xB0, 0x70, 0xF7, 0x89, 0x82, 0xD9, 0xAA, 0x60, 0x7A, 0xBB, 0x7B, 0x3A, 0x2C, 0xBF, 0xF4,
-    0x95, 0x18, 0x2A, 0xED, 0xB5, 0xB1, 0x86, 0x32, 0xE0, 0x34, 0xC1, 0xF4, 0x16, 0x38, 0x46, 0xF9,
-    0x7B, 0x41, 0x4C, 0x37, 0xD3, 0xFA, 0x80, 0x7C, 0x37, 0xA7, 0x05, 0xB6, 0xFB, 0xE9, 0xF1, 0xA3,
-    0x7F, 0x34, 0x76, 0x5B, 0xFB, 0xAC, 0xC2, 0x0D, 0x01, 0xDD, 0x9E, 0x0E, 0x0E, 0x05, 0xE9, 0xA5,
-    0x7B, 0xCD, 0x4F, 0x92, 0xF2, 0x2F, 0x82, 0xEC, 0x52, 0xF3, 0x77, 0x69, 0xFE, 0xCF, 0x83, 0xC3,
-    0x6F, 0x62, 0x6C, 0xE7, 0xE8, 0x87, 0x9F, 0x6E, 0x0C, 0x3F, 0x09, 0xFE, 0x9A, 0xE2, 0xFF, 0xBD,
-    0xA5, 0xA8, 0x18, 0xD9, 0xC4, 0x9F, 0x8C, 0x5F, 0x98, 0xCC, 0xFE, 0x70, 0xFD, 0x53, 0xD3, 0xD6,
-    0x72, 0x50, 0x02, 0x4E, 0x46, 0x72, 0x91, 0xDF, 0x0F, 0x67, 0x76, 0xF3, 0x0C, 0xD4, 0x3F, 0x59,
-    0x4E, 0x81, 0xC7, 0xFE, 0xF9, 0xD7, 0xDA, 0x1F, 0x3E, 0xAB, 0x50, 0x3B, 0x74, 0xDC, 0xA9, 0xAF,
-    0x8B, 0xB3, 0xFC, 0x87, 0x7F, 0xF3, 0xAD, 0xDF, 0x31, 0x86, 0x7E, 0x36, 0xF8, 0xF8, 0x7F, 0x2C,
-    0x13, 0x62, 0x2E, 0x05, 0x03, 0x9C, 0x22, 0x98, 0x2C, 0xFE, 0x14, 0xB5, 0x9C, 0xFF, 0xDB, 0xA5,
-    0xD4, 0xD7, 0x7E, 0x65, 0x02, 0x1D, 0x05, 0xE2, 0x1F, 0x6C, 0x8F, 0xAD, 0x99, 0xFF, 0xE9, 0x83,
-    0xEF, 0xFB, 0xD2, 0x92, 0xC8, 0x97, 0x34, 0xBF, 0x12, 0x9D, 0xDA, 0xFF, 0x4E, 0x30, 0xB1, 0x31,
-    0x04, 0xD3, 0x0C, 0x82, 0xDF, 0x0B, 0x34, 0x18, 0x01, 0x6D, 0x08, 0x5F, 0x19, 0xAD, 0x35, 0xD3,
-    0x7A, 0xEC, 0xA5, 0xCF, 0x63, 0xFB, 0x07, 0xEB, 0x5F, 0x7F, 0xD4, 0x1F, 0x1B, 0xB4, 0xE9, 0x6C,
-    0x99, 0x0C, 0x74, 0xD6, 0x44, 0x20, 0x66, 0xF7, 0x61, 0x9B, 0x07, 0x7F, 0xF9, 0x71, 0x3B, 0x83,
-    0xBD, 0x3F, 0x25, 0xD5, 0x2E, 0x47, 0xAA, 0x1D, 0x23, 0xDD, 0x22, 0x46, 0x22, 0xCD, 0x82, 0x1F,
-    0x07, 0x5F, 0xE4, 0x87, 0x28, 0x12, 0x96, 0xAD, 0x38, 0x6C, 0x32, 0x35, 0xD8, 0x27, 0x4C, 0x1B,
-    0xFE, 0x03, 0xEF, 0x9D, 0xFE, 0x30, 0x78, 0x8E, 0x34, 0x28, 0xC3, 0x68, 0x5A, 0x29, 0x66, 0x8E,
-    0x62, 0x8A, 0x13, 0x54, 0x83, 0xF8, 0x2F, 0xF7, 0xE3, 0x89, 0x7A, 0x65, 0x6E, 0x60, 0x44, 0xB2,
-    0x9E, 0xB7, 0x43, 0x5A, 0x47, 0x94, 0xFD, 0xE5, 0x84, 0xB1, 0x4C, 0xBC, 0x10, 0x0E, 0xBC, 0x30,
-    0x1D, 0x0A, 0x5C, 0x98, 0xF8, 0x94, 0x17, 0xFC, 0x29, 0x5E, 0x70, 0xE7, 0x79, 0x21, 0x2F, 0xDD,
-    0x8C, 0xB1, 0x1C, 0x19, 0x2E, 0x80, 0xAD, 0xE1, 0xC2, 0x99, 0x06, 0xE0, 0x34, 0x85, 0xDC, 0xC4,
-    0x85, 0xFB, 0x7D, 0x80, 0x0B, 0x98, 0xC0, 0x52, 0xD4, 0x28, 0xE8, 0x09, 0x07, 0x9C, 0xDF, 0xF1,
-    0xB4, 0x8E, 0xFC, 0x42, 0xDA, 0x79, 0xB3, 0x42, 0x04, 0x66, 0x22, 0x5B, 0xFA, 0xBE, 0x4D, 0x80,
-    0x99, 0x54, 0x5B, 0x01, 0x21, 0x7C, 0xBF, 0x17, 0x64, 0x47, 0xF3, 0x5E, 0x75, 0x8A, 0xCB, 0xA6,
-    0xC7, 0x59, 0x43, 0x71, 0x2C, 0x58, 0x61, 0x63, 0x3A, 0xE5, 0x67, 0x11, 0x54, 0xCE, 0x32, 0xF4,
-    0x55, 0xDC, 0x4C, 0xA1, 0x01, 0xF5, 0xAC, 0x86, 0x9B, 0x79, 0x87, 0x42, 0xF7, 0x06, 0x0A, 0x8B,
-    0x1D, 0x14, 0xE6, 0x3F, 0x43, 0xE1, 0x66, 0x5D, 0xCC, 0xB3, 0x9B, 0x75, 0x5A, 0x91, 0x7D, 0x40,
-    0x57, 0xA2, 0x11, 0xCE, 0xD1, 0x5E, 0x70, 0x93, 0x7E, 0x8A, 0x1B, 0x54, 0xE9, 0x9B, 0x95, 0x84,
-    0x36, 0x1D, 0x69, 0x49, 0x46, 0x26, 0xCC, 0xD0, 0xE1, 0xD1, 0x52, 0xD9, 0xCD, 0x86, 0x1F, 0x06,
-    0x0A, 0x30, 0x28, 0x7C, 0x6F, 0x27, 0xAB, 0x4B, 0xD1, 0x68, 0xF7, 0xA3, 0x1B, 0x51, 0xDA, 0x62,
-    0x4B, 0x9B, 0xE2, 0x82, 0x3C, 0x39, 0x52, 0x64, 0x8C, 0x9D, 0xA0, 0xE4, 0xBA, 0xFC, 0x78, 0x16,
-    0xB9, 0x11, 0x79, 0x7F, 0xF6, 0x80, 0x33, 0x49, 0xC6, 0xDD, 0xD1, 0xCC, 0xB2, 0xB0, 0x7C, 0xB2,
-    0x75, 0x8F, 0xF0, 0x01, 0x17, 0xB1, 0x1F, 0x7E, 0x40, 0x00, 0x4D, 0x87, 0x44, 0x17, 0xB7, 0x87,
-    0xFD, 0x6B, 0x8C, 0x3F, 0x77, 0x14, 0x4E, 0x55, 0x44, 0x57, 0x1C, 0x53, 0xF0, 0xFC, 0xCC, 0x72,
-    0x42, 0xDE, 0x63, 0xC6, 0x26, 0xD1, 0x52, 0xAA, 0xA4, 0x90, 0x14, 0x22, 0x83, 0x01, 0xD9, 0xC5,
-    0xB5, 0xFA, 0xDF, 0xF9, 0x62, 0xE7, 0x66, 0xEF, 0x13, 0xC5, 0x43, 0xA7, 0x96, 0x9C, 0xF2, 0xAA,
-    0xDF, 0x2A, 0x50, 0xD9, 0xEF, 0x62, 0x12, 0x51, 0x77, 0x9A, 0x78, 0xD3, 0xBC, 0xA5, 0x56, 0x8C,
-    0xF2, 0x60, 0x8C, 0x8D, 0x58, 0xAC, 0xC5, 0x46, 0xB4, 0x8A, 0x83, 0x90, 0xF1, 0x7F, 0xDC, 0x5E,
-    0xBD, 0xDA, 0xB9, 0x1D, 0xDF, 0xB9, 0xB7, 0x7D, 0xEB, 0xEE, 0xFA, 0x65, 0x6C, 0x44, 0xE9, 0xCE,
-    0xD0, 0xFF, 0xF8, 0x35, 0x6C, 0x93, 0xC5, 0xA3, 0x62, 0x23, 0xE8, 0xD0, 0x61, 0x92, 0x89, 0xB4,
-    0xA1, 0xF8, 0xEE, 0x18, 0xEB, 0xB0, 0x69, 0x9E, 0xE7, 0xDB, 0x07, 0x23, 0xA5, 0xA7, 0x9F, 0xF4,
-    0x27, 0x91, 0x81, 0x46, 0x7B, 0xFC, 0xE7, 0xFC, 0xF2, 0xDF, 0x95, 0xE3, 0x1F, 0xC7, 0x73, 0x16,
-    0x8D, 0x9D, 0xB9, 0xDA, 0x3A, 0xEB, 0xA0, 0xF5, 0xAD, 0xB0, 0x20, 0x3F, 0x6D, 0x7F, 0x3C, 0x6C,
-    0xCD, 0x1E, 0x76, 0xCF, 0xFA, 0x26, 0x5F, 0xA4, 0x82, 0xCC, 0x2A, 0x7F, 0xFD, 0x47, 0x9C, 0xD7,
-    0x98, 0x4D, 0x1B, 0xBB, 0xC7, 0x12, 0xD9, 0x5A, 0xE5, 0x8D, 0x1B, 0x0B, 0x0F, 0x1E, 0x68, 0xF9,
-    0x8A, 0x0C, 0x00, 0x2D, 0x4F, 0x16, 0xC1, 0x1A, 0x5D, 0xAE, 0x4E, 0x86, 0xAD, 0xB3, 0x4A, 0x50,
-    0x8A, 0xC6, 0xF0, 0x43, 0x1F, 0x0D, 0x5F, 0x67, 0x10, 0xE4, 0x44, 0x80, 0x78, 0x19, 0xCA, 0xAE,
-    0x10, 0xFD, 0xF4, 0x1E, 0x8D, 0xEB, 0x63, 0xAC, 0xBE, 0xC9, 0xE1, 0x52, 0xCA, 0x62, 0xBA, 0xED,
-    0xE7, 0x4A, 0x9C, 0x48, 0x95, 0x39, 0x37, 0x2A, 0x0C, 0x0A, 0x65, 0x57, 0x3E, 0x6A, 0x9D, 0xED,
-    0x6D, 0xCD, 0xD7, 0x7D, 0xDD, 0x72, 0xF9, 0x00, 0x7A, 0xFB, 0x21, 0x1E, 0x5C, 0x9F, 0x55, 0xF4,
-    0xF0, 0x24, 0x1F, 0x0C, 0x4A, 0xEF, 0x19, 0xE3, 0x6C, 0xD8, 0x8E, 0x5C, 0x01, 0x5C, 0xFF, 0xC4,
-    0x11, 0x14, 0x2E, 0x42, 0x69, 0x60, 0xF3, 0x51, 0xA4, 0x80, 0xBF, 0xB4, 0xCA, 0x5A, 0xA3, 0x3A,
-    0x64, 0x71, 0x02, 0x32, 0xD6, 0x29, 0xB5, 0xC7, 0x6C, 0xE2, 0xC0, 0x61, 0xB5, 0xE2, 0xFC, 0x68,
-    0x55, 0x24, 0xA7, 0x49, 0x15, 0x63, 0x9A, 0xEC, 0x7A, 0xF1, 0x99, 0xFC, 0xE6, 0xFD, 0x76, 0xCC,
-    0xE5, 0x24, 0xFF, 0x77, 0xD7, 0x18, 0x13, 0xC7, 0xCC, 0x11, 0x03, 0x17, 0x69, 0x2D, 0x5F, 0xD3,
-    0x5B, 0x0C, 0x03, 0x09, 0x64, 0x8D, 0xAC, 0x2C, 0x2C, 0x9A, 0xDC, 0x8C, 0x1F, 0xF2, 0xBD, 0x12,
-    0x48, 0x72, 0x7F, 0x99, 0x4E, 0xA0, 0x00, 0x14, 0xC8, 0x0C, 0xD2, 0x78, 0x54, 0xE9, 0x96, 0xFA,
-    0x5F, 0xFE, 0x71, 0x7E, 0x8A, 0xDB, 0x51, 0xE5, 0x8C, 0x7A, 0xC5, 0x65, 0x29, 0x27, 0x84, 0x26,
-    0x8A, 0xB9, 0x10, 0x70, 0x5E, 0xAA, 0x12, 0xA8, 0x91, 0xA2, 0x46, 0x7B, 0xD5, 0x7F, 0xCC, 0x41,
-    0x8D, 0x2C, 0x63, 0x36, 0x69, 0x3D, 0xC1, 0x61, 0x5E, 0x7B, 0x8B, 0x01, 0xA0, 0xBA, 0x3B, 0xA1,
-    0x19, 0xC9, 0x1F, 0xA7, 0x43, 0x13, 0xFD, 0xC7, 0x34, 0x0E, 0x54, 0x96, 0x11, 0xCE, 0x94, 0xC2,
-    0xC1, 0x3E, 0x38, 0x7F, 0xEC, 0x61, 0xEB, 0xB7, 0x91, 0x7A, 0xF4, 0x13, 0xBC, 0x93, 0x8E, 0x08,
-    0xA2, 0x5A, 0x9A, 0x32, 0xE6, 0xB2, 0x38, 0x3C, 0x37, 0x0F, 0x9E, 0x24, 0xAC, 0x8F, 0xBC, 0x9A,
-    0x06, 0x93, 0x6C, 0x46, 0xC9, 0x4A, 0x9C, 0x8A, 0x1E, 0x01, 0x9B, 0xA6, 0x96, 0x33, 0x57, 0x76,
-    0x2F, 0xAD, 0x47, 0xC1, 0x68, 0xD6, 0x55, 0xFE, 0xB6, 0x54, 0x22, 0x65, 0x39, 0x2E, 0x23, 0xF1,
-    0x0B, 0xC6, 0x44, 0x2A, 0x2A, 0xBA, 0xB8, 0xC6, 0xAA, 0xEF, 0xD0, 0x44, 0x70, 0xC1, 0x9B, 0x35,
-    0x81, 0x4F, 0x54, 0x7C, 0x96, 0xBA, 0x52, 0xE2, 0x15, 0xFB, 0xD7, 0xF3, 0xCD, 0x32, 0x84, 0xF4,
-    0xCB, 0x71, 0x7D, 0xE4, 0x2E, 0x30, 0x55, 0xA1, 0x8A, 0x7B, 0xC0, 0xEF, 0x9E, 0xD1, 0x0E, 0xD4,
-    0x56, 0x18, 0x2D, 0x44, 0xA2, 0x34, 0xB7, 0xA3, 0x87, 0x32, 0x9D, 0xBF, 0xCB, 0xBC, 0x38, 0x46,
-    0x40, 0xD0, 0xFD, 0x3A, 0xF7, 0x57, 0x0A, 0xC2, 0x6B, 0x06, 0x19, 0x0F, 0x36, 0x74, 0xB4, 0x13,
-    0x25, 0xF5, 0x28, 0x42, 0x97, 0x05, 0x4F, 0xBD, 0xC9, 0x5A, 0x9C, 0x66, 0x82, 0x93, 0xDB, 0x39,
-    0xDD, 0xC7, 0xDD, 0x7F, 0x44, 0x6F, 0xEF, 0x78, 0xCC, 0x88, 0x82, 0x2A, 0x12, 0x3F, 0xCD, 0x74,
-    0xB2, 0x4B, 0x1D, 0x73, 0xD5, 0x02, 0xB9, 0x5C, 0x41, 0x4A, 0x60, 0x5C, 0x17, 0x7B, 0x46, 0x65,
-    0xD6, 0xBC, 0x07, 0x9C, 0x9A, 0xF1, 0x20, 0x3B, 0xAE, 0xE1, 0xE3, 0x0B, 0xF7, 0x16, 0x24, 0x46,
-    0x67, 0x09, 0x06, 0x54, 0x12, 0xE2, 0xCE, 0xFF, 0x55, 0xD6, 0xF8, 0x33, 0x45, 0xE9, 0xCF, 0xA0,
-    0x5E, 0x67, 0x40, 0x57, 0x67, 0x40, 0x56, 0x6F, 0xD4, 0x32, 0x08, 0xB3, 0xEA, 0xF2, 0x0F, 0x9D,
-    0x41, 0xAD, 0xCF, 0x80, 0xF8, 0xCE, 0xE0, 0x99, 0x33, 0x20, 0xC9, 0xBF, 0x62, 0x70, 0x6C, 0x34,
-    0x28, 0x03, 0x97, 0x56, 0xA1, 0xD2, 0xE1, 0x22, 0xB8, 0xD7, 0x6B, 0xA4, 0xCB, 0x53, 0x7D, 0xE0,
-    0xF6, 0x5E, 0x69, 0x41, 0xDD, 0x18, 0x12, 0xD9, 0x6B, 0x94, 0x83, 0x9B, 0x2A, 0x54, 0x79, 0xDC,
-    0xCD, 0x2D, 0x09, 0x17, 0x73, 0x90, 0xB7, 0xA4, 0xAD, 0x25, 0x62, 0x29, 0x0B, 0x97, 0x0C, 0x60,
-    0x4E, 0xBB, 0x57, 0xA9, 0x4C, 0x2C, 0x4B, 0xC3, 0x5D, 0x45, 0x02, 0x51, 0x6C, 0xE4, 0xE4, 0x47,
-    0x54, 0xC4, 0x4D, 0x3F, 0x65, 0x11, 0xF8, 0x4B, 0xD6, 0x30, 0xBA, 0x68, 0x06, 0xD6, 0x23, 0x7B,
-    0xD5, 0x82, 0xC6, 0x79, 0xB0, 0x14, 0xA5, 0x9A, 0xF6, 0xA6, 0x7C, 0x4C, 0x07, 0xAF, 0x74, 0x15,
-    0x14, 0xFD, 0x82, 0xFD, 0xF4, 0xAA, 0x9F, 0x29, 0x63, 0x2F, 0xA6, 0x45, 0x94, 0x16, 0x2F, 0xBA,
-    0xB4, 0xE9, 0x09, 0x03, 0x81, 0x9D, 0x21, 0x71, 0xD6, 0xE4, 0x52, 0x3D, 0xE3, 0xC1, 0x94, 0xE0,
-    0x88, 0xF6, 0x48, 0xB8, 0x1B, 0x8D, 0x51, 0x63, 0x1C, 0x89, 0x2C, 0x32, 0xCB, 0x9B, 0x85, 0x12,
-    0x70, 0x12, 0x8B, 0xCC, 0x22, 0x2A, 0x91, 0x46, 0x67, 0x4A, 0x36, 0x33, 0x42, 0x13, 0x38, 0x20,
-    0xE5, 0x5A, 0x72, 0x3A, 0x49, 0x17, 0xCA, 0x92, 0x3E, 0x94, 0x7B, 0xC6, 0xD2, 0xF8, 0x6E, 0x3A,
-    0x4C, 0x8E, 0x8B, 0xE1, 0x81, 0xD1, 0xC9, 0xF4, 0x3A, 0xA3, 0x05, 0x93, 0xD6, 0x50, 0x35, 0x9F,
-    0x31, 0x2B, 0xC9, 0x6D, 0xCD, 0x56, 0x05, 0xFC, 0x89, 0xA3, 0x2C, 0x98, 0x96, 0x42, 0x53, 0x50,
-    0x28, 0x5D, 0x8E, 0xC6, 0x33, 0x59, 0x43, 0x23, 0xE6, 0xDB, 0x06, 0x1F, 0x7D, 0x7A, 0x7D, 0xCB,
-    0x51, 0xAA, 0x98, 0x7C, 0xF1, 0xCB, 0xD3, 0xC7, 0x3F, 0x66, 0xA9, 0x60, 0xFE, 0xDE, 0xFE, 0x69,
-    0xBD, 0x02, 0x80, 0xE9, 0xA3, 0x4F, 0x2D, 0x72, 0x40, 0x9E, 0xF6, 0x58, 0x33, 0x97, 0xFA, 0xF7,
-    0x7E, 0x91, 0x9C, 0x56, 0x84, 0x46, 0x0C, 0xE3, 0x06, 0xBB, 0xDB, 0x7C, 0xC8, 0x5D, 0xFE, 0x3E,
-    0x6D, 0x4D, 0x37, 0x2B, 0xF3, 0x40, 0x69, 0xD6, 0x08, 0xC4, 0xC9, 0xEE, 0xBD, 0x2A, 0xD2, 0x04,
-    0xCA, 0xE8, 0x69, 0xC5, 0xBB, 0xAE, 0xAA, 0x96, 0x1B, 0x74, 0x82, 0xF6, 0x6A, 0x81, 0x19, 0x53,
-    0xAD, 0x49, 0xF4, 0x8D, 0xB6, 0xD6, 0x09, 0xF2, 0xF9, 0xCC, 0xAD, 0xFD, 0xA9, 0x19, 0xB5, 0x1E,
-    0x71, 0xF7, 0x63, 0x8A, 0x59, 0xE6, 0x3D, 0x2F, 0xFB, 0x8B, 0xAC, 0xE9, 0x6D, 0x5C, 0xBD, 0x7B,
-    0x4C, 0x37, 0xEA, 0x19, 0x35, 0x72, 0xAA, 0xB4, 0x0B, 0xCB, 0x8D, 0xBF, 0xFB, 0x75, 0x6F, 0x0F,
-    0xDB, 0x7B, 0xD6, 0xEE, 0xDC, 0x2F, 0x2C, 0x4C, 0xB0, 0x45, 0xDE, 0xF4, 0x80, 0x62, 0x94, 0x17,
-    0xCB, 0x9F, 0x8B, 0x60, 0x0C, 0x86, 0x4C, 0x1E, 0xFF, 0x73, 0x6F, 0x4B, 0xAE, 0x4C, 0xBA, 0x5A,
-    0x23, 0x45, 0x9F, 0x2B, 0x2B, 0x88, 0x26, 0x7F, 0xFE, 0xEC, 0xBF, 0xA9, 0x94, 0x67, 0x72, 0xFE,
-    0x53, 0x7A, 0x56, 0x79, 0x48, 0x24, 0xFF, 0x1D, 0xFD, 0x54, 0xEA, 0x25, 0x9D, 0xBF, 0x57, 0x0F,
-    0xFE, 0x2C, 0x0F, 0xE4, 0xA3, 0x8C, 0xD9, 0x2A, 0x99, 0x66, 0xEE, 0xF3, 0xDB, 0xDE, 0x94, 0x2B,
-    0x93, 0xA4, 0xF9, 0xA8, 0x2D, 0xF8, 0x51, 0x1F, 0x38, 0x2A, 0x60, 0x61, 0xA1, 0xA1, 0xA5, 0xE5,
-    0x08, 0xA2, 0x3F, 0xBE, 0xD1, 0x2B, 0x08, 0xA4, 0x61, 0xC7, 0xE2, 0xE5, 0x8C, 0x23, 0x98, 0x69,
-    0x8E, 0x32, 0xBA, 0x0D, 0x95, 0x7E, 0x91, 0x2E, 0x67, 0x85, 0x17, 0x6C, 0xA3, 0x9F, 0xC3, 0x3E,
-    0x66, 0xD8, 0x4C, 0xC3, 0xD0, 0xBC, 0xBC, 0x4C, 0xEF, 0xF3, 0xEE, 0xE2, 0x66, 0x65, 0x16, 0xF3,
-    0x65, 0xB5, 0xC4, 0x40, 0x64, 0xE3, 0x7C, 0xDE, 0x89, 0xCF, 0x7A, 0x49, 0xDD, 0x3E, 0x18, 0x13,
-    0xB4, 0xF6, 0xFF, 0x1C, 0x26, 0x21, 0x2B, 0xC2, 0x70, 0x4C, 0xB6, 0xFF, 0xEF, 0x33, 0x33, 0x6D,
-    0x10, 0xA0, 0x80, 0x17, 0x82, 0x3E, 0xA1, 0x34, 0x41, 0x46, 0xD1, 0xC9, 0xE7, 0xE8, 0x49, 0x62,
-    0xFE, 0x8A, 0x52, 0x59, 0xF2, 0x85, 0x47, 0x35, 0xEA, 0xFC, 0x42, 0x4F, 0x27, 0x84, 0xA7, 0x97,
-    0x37, 0x6B, 0xE8, 0xF0, 0xF1, 0x2F, 0xB2, 0xEA, 0x83, 0xB3, 0xC1, 0x7F, 0xDD, 0x5C, 0x92, 0x46,
-    0x02, 0x93, 0xD9, 0x66, 0x77, 0xC0, 0x76, 0x66, 0xCA, 0x8A, 0xD7, 0x62, 0x1B, 0x47, 0x65, 0xDB,
-    0xC6, 0x10, 0xA1, 0xB5, 0x1D, 0xC4, 0xA5, 0x7B, 0xAD, 0xCB, 0x4F, 0xB7, 0xD9, 0xF9, 0xD6, 0x9D,
-    0xEF, 0xF2, 0x53, 0x5D, 0x76, 0xA1, 0xCD, 0xCB, 0xC1, 0x4D, 0xC1, 0x9B, 0xAB, 0x64, 0xF4, 0x90,
-    0xCA, 0x95, 0xB8, 0x08, 0x9E, 0x89, 0xBB, 0x83, 0xB6, 0xF8, 0x48, 0x39, 0x13, 0xFB, 0xF9, 0x85,
-    0x2F, 0xAC, 0xE7, 0x17, 0x12, 0x9E, 0xD1, 0xA0, 0x63, 0xC1, 0x07, 0xE5, 0x43, 0xF2, 0x0B, 0x43,
-    0xCB, 0x2F, 0x3C, 0xB1, 0x9E, 0x5F, 0x48, 0xE3, 0x51, 0x69, 0xC2, 0x3F, 0x48, 0xE7, 0x66, 0x0A,
-    0xA4, 0x91, 0x81, 0xE2, 0x1F, 0xA2, 0x7A, 0x8C, 0x3D, 0x6B, 0xD6, 0xC2, 0x9F, 0xBD, 0xDE, 0xFE,
-    0x08, 0x83, 0xCE, 0x95, 0x9F, 0x24, 0x02, 0xAD, 0x9D, 0x0C, 0xD5, 0x7F, 0x67, 0xF2, 0x1F, 0xEF,
-    0x9D, 0x74, 0x02, 0x15, 0xA3, 0xFC, 0xA7, 0x63, 0x6A, 0x2D, 0x9B, 0xB1, 0xFF, 0x8D, 0xB3, 0x19,
-    0x4D, 0x90, 0x2C, 0x14, 0x06, 0x4C, 0x2E, 0xBF, 0x96, 0x5C, 0x59, 0x3F, 0x90, 0x6D, 0xA9, 0xF9,
-    0xD6, 0x2F, 0xB7, 0x23, 0x1B, 0x77, 0x8F, 0x89, 0xE3, 0x3C, 0x76, 0x53, 0x0E, 0x60, 0xBD, 0xDA,
-    0x1E, 0x7A, 0xD3, 0x53, 0x6F, 0x32, 0x69, 0xFD, 0x16, 0x2D, 0xB2, 0x27, 0x95, 0x36, 0x4C, 0x83,
-    0x9E, 0xA2, 0xDD, 0x18, 0x29, 0xA3, 0x38, 0x2D, 0x59, 0xF9, 0x98, 0x5B, 0x6A, 0x24, 0x41, 0xC3,
-    0xBE, 0xAD, 0x89, 0x20, 0x4B, 0x95, 0xD2, 0xF5, 0x34, 0xFD, 0x48, 0xD9, 0x82, 0x25, 0x1F, 0x2E,
-    0xA2, 0x4B, 0xF3, 0x8D, 0x86, 0x51, 0xAB, 0x04, 0x13, 0x50, 0x30, 0x52, 0x7A, 0xA7, 0x89, 0x57,
-    0x80, 0x87, 0x67, 0x09, 0xE0, 0x00, 0xDD, 0x93, 0x0A, 0x76, 0x4A, 0xEE, 0xB7, 0x96, 0xB2, 0x9B,
-    0x7B, 0x0B, 0x64, 0x12, 0xFA, 0xA3, 0x24, 0x7B, 0x6C, 0xA7, 0x3E, 0x59, 0x2B, 0xBE, 0xB0, 0xBD,
-    0x27, 0x1D, 0x57, 0xB9, 0x50, 0xF4, 0xE9, 0x7A, 0xA3, 0xBF, 0x4F, 0xBF, 0x15, 0xC9, 0x98, 0xE4,
-    0x43, 0x86, 0x37, 0x3F, 0x42, 0x0F, 0xF6, 0x7A, 0x2B, 0x94, 0xDB, 0x39, 0x95, 0x7F, 0x53, 0xC9,
-    0x9D, 0xF4, 0x26, 0x91, 0xF4, 0xA4, 0x7D, 0x34, 0x6C, 0xB3, 0xA3, 0xBC, 0x17, 0xB0, 0xB3, 0x28,
-    0x78, 0xAD, 0x8C, 0x33, 0xF2, 0x0F, 0xF9, 0x06, 0x24, 0x04, 0xC3, 0x41, 0xE2, 0xFA, 0xB4, 0x40,
-    0x7E, 0x5E, 0xCB, 0x75, 0x47, 0x2D, 0x03, 0x3C, 0x85, 0x49, 0x9E, 0x74, 0x89, 0x4C, 0xB5, 0x76,
-    0x81, 0x1C, 0x75, 0x8F, 0xF0, 0x2E, 0x1F, 0x70, 0x34, 0x6B, 0x41, 0x01, 0x2A, 0xDF, 0x5A, 0x4B,
-    0x20, 0x20, 0xCA, 0x82, 0x0A, 0xA7, 0x04, 0xBE, 0x31, 0xC4, 0x46, 0x99, 0xA6, 0xB9, 0xBA, 0x56,
-    0x21, 0x68, 0xEC, 0xED, 0x4B, 0x74, 0x81, 0x24, 0xBB, 0x47, 0xF3, 0x3A, 0x63, 0xD4, 0x5F, 0xEE,
-    0x89, 0x37, 0x1E, 0x21, 0x2D, 0x55, 0xF4, 0xDC, 0x9C, 0xB3, 0x2B, 0xB1, 0xD5, 0x5D, 0x72, 0xE9,
-    0x90, 0x80, 0x1F, 0x94, 0x83, 0xCC, 0xC1, 0x4E, 0x6A, 0xD3, 0xE2, 0x6C, 0xAD, 0x19, 0xAF, 0x91,
-    0xC1, 0xB3, 0xE1, 0x13, 0x5F, 0x62, 0xF0, 0x45, 0x19, 0x98, 0x6B, 0x22, 0x34, 0x3B, 0xBF, 0xDC,
-    0xF1, 0x6B, 0xC8, 0x6F, 0x69, 0x32, 0x18, 0x43, 0xC1, 0xE3, 0x87, 0x5C, 0xD2, 0x1C, 0xBD, 0xA8,
-    0xDC, 0xBD, 0x8C, 0xF1, 0x57, 0xE8, 0xE0, 0x43, 0xC5, 0xDD, 0x7F, 0x21, 0x11, 0x1D, 0x4B, 0x44,
-    0x67, 0x12, 0xD1, 0xA4, 0x55, 0xA5, 0x9F, 0x3C, 0xAA, 0xF8, 0xF5, 0x13, 0x02, 0x0B, 0x5E, 0x5A,
-    0x92, 0x57, 0xD4, 0x83, 0xB9, 0x14, 0x22, 0x7D, 0x35, 0xD5, 0x47, 0x0B, 0x7E, 0x73, 0xB2, 0x56,
-    0xFC, 0xD4, 0xD9, 0x25, 0x32, 0x0A, 0x05, 0x92, 0xF2, 0x8F, 0x71, 0xDA, 0x93, 0xFC, 0xF3, 0xDD,
-    0xEF, 0xF8, 0x2A, 0x5C, 0xB5, 0xBA, 0x02, 0x0D, 0x5D, 0xD6, 0x7B, 0xE5, 0x7C, 0x0C, 0xD7, 0x4E,
-    0xC7, 0xC8, 0x55, 0x05, 0x1F, 0xFA, 0xE5, 0xE9, 0xC7, 0x41, 0x5C, 0xB9, 0xA9, 0x4B, 0x8F, 0xD8,
-    0xE9, 0x6A, 0x5E, 0x3D, 0x6B, 0x51, 0x3F, 0xAA, 0x04, 0xDA, 0xFF, 0x0B, 0xBF, 0x7C, 0xCB, 0xB8,
-    0xF3, 0xEB, 0xBB, 0x51, 0xA1, 0x7C, 0xD8, 0x6E, 0x8B, 0x0B, 0xB0, 0xDC, 0x21, 0x81, 0x72, 0x75,
-    0x8D, 0x07, 0x4F, 0xFE, 0x16, 0x27, 0xF1, 0x8B, 0x76, 0xE2, 0x79, 0x32, 0x68, 0x25, 0x0F, 0x88,
-    0x37, 0x65, 0x6F, 0xFB, 0xFF, 0x83, 0x77, 0x34, 0x1C, 0x91, 0x17, 0x71, 0xF2, 0xB7, 0xCB, 0x93,
-    0x6F, 0xD1, 0x44, 0x21, 0x9B, 0x0E, 0x17, 0xFD, 0x99, 0x50, 0x71, 0x26, 0x22, 0xA1, 0x05, 0x20,
-    0xEA, 0x8A, 0xF3, 0xAF, 0xA2, 0xA0, 0x46, 0xC1, 0x3F, 0x45, 0xC1, 0x1B, 0xCA, 0xD7, 0xF3, 0xB2,
-    0x7F, 0x64, 0x03, 0x10, 0x5F, 0xC2, 0x1E, 0x27, 0x94, 0xAE, 0xF7, 0x59, 0x3B, 0xCF, 0x24, 0x1F,
-    0xDD, 0x23, 0x4E, 0x36, 0xE5, 0x1B, 0x54, 0xA5, 0x3A, 0xE7, 0x6F, 0xF8, 0x77, 0x06, 0xAE, 0xE0,
-    0xB0, 0x74, 0x22, 0x7E, 0xC4, 0xC9, 0x72, 0xDC, 0x1E, 0x96, 0xA3, 0xF3, 0x36, 0xD0, 0x7E, 0xE1,
-    0xDF, 0x55, 0x06, 0xDF, 0xF7, 0xBD, 0x93, 0x6C, 0x8C, 0x15, 0x19, 0x43, 0x1B, 0x0A, 0x1D, 0x9E,
-    0xF3, 0x47, 0xFD, 0xDC, 0x8F, 0x39, 0xC9, 0xC4, 0x7B, 0xE4, 0x5B, 0x19, 0x57, 0x6B, 0x99, 0xFA,
-    0xBD, 0x6D, 0x33, 0x04, 0x67, 0xF5, 0x73, 0x0A, 0xC7, 0xFE, 0x6A, 0xAD, 0xE8, 0x0E, 0xAD, 0x8C,
-    0xC3, 0xC0, 0xEC, 0xAD, 0xAD, 0xED, 0xCE, 0x02, 0x9A, 0x14, 0xE6, 0x61, 0x49, 0xDA, 0x00, 0x41,
-    0xA3, 0xC5, 0x36, 0x31, 0xB3, 0xBB, 0x21, 0xA1, 0xB8, 0x97, 0x21, 0x1F, 0x6F, 0x9B, 0xD0, 0x8F,
-    0xB2, 0x7B, 0xC2, 0xDB, 0x77, 0x94, 0x5D, 0x2C, 0x2A, 0xCC, 0x04, 0x9C, 0xD6, 0xD2, 0x5A, 0x03,
-    0x39, 0xE4, 0xB8, 0x88, 0x95, 0xA2, 0xAA, 0x0F, 0x51, 0x21, 0x4E, 0xC8, 0xAA, 0x2F, 0x34, 0x60,
-    0xCE, 0xB5, 0xBE, 0xA8, 0xB0, 0xAC, 0x17, 0xD7, 0xBE, 0x6A, 0x19, 0xE7, 0x9D, 0xF9, 0x96, 0xA3,
-    0x99, 0xA5, 0x16, 0x87, 0x5A, 0x9B, 0x2B, 0xD5, 0xEC, 0x3F, 0xB4, 0x06, 0xCB, 0x3E, 0xD3, 0x46,
-    0x4F, 0x1F, 0xDE, 0xE8, 0x61, 0x7F, 0x52, 0x8D, 0xAF, 0x78, 0xF4, 0x8F, 0x75, 0x07, 0xDE, 0x6F,
-    0xA3, 0x6F, 0x18, 0xE9, 0x21, 0xF3, 0x29, 0x4D, 0xF3, 0x16, 0x4F, 0x32, 0x16, 0x7E, 0x81, 0xEB,
-    0x87, 0x34, 0x32, 0xA5, 0xBC, 0xE0, 0xAB, 0xD5, 0xAA, 0x76, 0x6E, 0xF1, 0xC8, 0xD3, 0x84, 0x89,
-    0x1D, 0xAF, 0xF8, 0x5E, 0xE8, 0xFC, 0x88, 0xE5, 0x3E, 0x24, 0xB5, 0x16, 0xDC, 0x9A, 0x0C, 0xD6,
-    0x4B, 0xB9, 0xB1, 0xE3, 0xE9, 0xC8, 0x95, 0x0F, 0xED, 0x8F, 0xBC, 0x16, 0xD9, 0x01, 0x0B, 0xE5,
-    0x0A, 0x28, 0xF3, 0x88, 0x8B, 0x4F, 0xD1, 0x1F, 0x0A, 0xCA, 0x97, 0x49, 0x2F, 0x62, 0x54, 0xB5,
-    0xC4, 0x9F, 0x9B, 0x2B, 0xE5, 0x2D, 0xAB, 0x94, 0x72, 0x11, 0xCB, 0xBF, 0x9D, 0xDD, 0xF7, 0xAE,
-    0x32, 0xEB, 0x57, 0xBD, 0xBF, 0xDC, 0x8E, 0x33, 0xE5, 0xA6, 0xF8, 0xE5, 0x40, 0xE4, 0x09, 0x69,
-    0x7F, 0x92, 0x60, 0xB8, 0xC9, 0xAA, 0x82, 0xC1, 0xA9, 0x71, 0x8B, 0xA1, 0x4A, 0xA8, 0x09, 0x62,
-    0xEA, 0xF4, 0xF8, 0x66, 0xBA, 0xD4, 0xE0, 0x43, 0x69, 0x4C, 0x39, 0x90, 0x08, 0x2B, 0x04, 0x29,
-    0xFB, 0x83, 0xC3, 0x6F, 0x8A, 0xFD, 0x09, 0xBD, 0x0F, 0xCA, 0x17, 0x4A, 0xCC, 0x87, 0x9F, 0xD9,
-    0x20, 0x1D, 0x59, 0x35, 0x22, 0x54, 0x26, 0x2A, 0xF3, 0x27, 0x99, 0x33, 0xE0, 0x16, 0xC5, 0x9C,
-    0xEB, 0x33, 0x31, 0x20, 0x93, 0x66, 0x0C, 0xAE, 0xED, 0xE0, 0x76, 0x5A, 0x85, 0xEB, 0xAC, 0x91,
-    0x84, 0x21, 0x78, 0xAE, 0x34, 0xA3, 0xA6, 0x15, 0x90, 0xCB, 0x21, 0x43, 0x3A, 0xC1, 0x9E, 0x98,
-    0x25, 0x4B, 0xBF, 0x2C, 0x4D, 0x43, 0xCA, 0x9F, 0xAD, 0x9D, 0x92, 0x69, 0x17, 0xE3, 0xE2, 0x35,
-    0x91, 0x16, 0xAF, 0xA9, 0xC6, 0xB5, 0xC7, 0xE8, 0x69, 0x9E, 0x2C, 0x17, 0x2D, 0xA3, 0xCA, 0x5F,
-    0x5C, 0x6A, 0xD1, 0x49, 0x44, 0xC7, 0x8C, 0xB5, 0x4B, 0x97, 0xA1, 0xBF, 0x2F, 0xF8, 0xD7, 0x37,
-    0x19, 0xD9, 0x14, 0x2B, 0xA0, 0x97, 0x7C, 0x2C, 0xA1, 0x82, 0xCB, 0xB4, 0x5E, 0xC6, 0x61, 0xDB,
-    0xEA, 0x5A, 0x92, 0x8E, 0xEC, 0x5D, 0xA9, 0x3B, 0x29, 0xEE, 0x3E, 0xA7, 0xC8, 0xEA, 0xD1, 0x0B,
-    0xAB, 0x3C, 0x3F, 0x4E, 0x2D, 0x86, 0xE1, 0xBB, 0x39, 0xD3, 0x7D, 0x8A, 0x4A, 0x21, 0xFA, 0x68,
-    0xA5, 0x3B, 0x03, 0x4E, 0xE3, 0xB8, 0x68, 0x9B, 0x16, 0xAD, 0x32, 0xCB, 0xFF, 0xFB, 0xAE, 0xB3,
-    0x7B, 0x99, 0xE2, 0xC4, 0xC8, 0x75, 0xD4, 0x6C, 0x4E, 0x32, 0x9D, 0x8C, 0x01, 0x25, 0x90, 0x64,
-    0x5F, 0x74, 0x9D, 0xD0, 0x0F, 0x73, 0xE8, 0xD2, 0x61, 0x19, 0x10, 0x63, 0x5A, 0x14, 0xF7, 0xE9,
-    0xDA, 0x5E, 0x62, 0x12, 0xB4, 0x2B, 0xE4, 0x6F, 0xFB, 0xC5, 0xFE, 0x5E, 0x1E, 0x6E, 0x85, 0x03,
-    0x8C, 0xDA, 0xB5, 0xC5, 0x7A, 0x2D, 0xF7, 0x44, 0xE6, 0xB6, 0xB6, 0x5F, 0xA8, 0xDC, 0xD6, 0x13,
-    0x74, 0xD2, 0x0C, 0x0A, 0x13, 0x19, 0x40, 0xBE, 0x91, 0xEF, 0xE9, 0xB1, 0xF1, 0xDD, 0xE7, 0x56,
-    0x20, 0xCA, 0xD0, 0x82, 0x05, 0x2D, 0xD8, 0x14, 0xCD, 0x4D, 0x86, 0x2F, 0xCD, 0xB5, 0xC5, 0xB8,
-    0x30, 0x64, 0x65, 0xB1, 0x72, 0x61, 0xFF, 0x0D, 0xAD, 0x71, 0xA5, 0xE5, 0xAE, 0xB4, 0xC4, 0x95,
-    0x56, 0xBB, 0xB2, 0x15, 0xAE, 0x88, 0x76, 0x67, 0x4C, 0x1E, 0x24, 0x1A, 0xA3, 0xCF, 0x3D, 0x78,
-    0x43, 0x6B, 0xFE, 0x31, 0xB8, 0xE2, 0x26, 0xA5, 0xE7, 0x3D, 0x9A, 0xFE, 0xF4, 0x75, 0x77, 0xD0,
-    0xD1, 0x14, 0xEF, 0x87, 0xE9, 0x6D, 0x7D, 0xBC, 0xC5, 0xD4, 0x00, 0x8C, 0x3E, 0xB4, 0x90, 0xCD,
-    0xC7, 0x59, 0x5E, 0x6D, 0xE5, 0x4F, 0x2F, 0xCC, 0xA0, 0xFF, 0xC5, 0x73, 0x8C, 0xCE, 0xD6, 0xE0,
-    0xAC, 0x1B, 0xF4, 0xD7, 0x9D, 0x38, 0xEB, 0x9B, 0x2D, 0x3B, 0x61, 0xDB, 0x95, 0x13, 0xDD, 0xA3,
-    0xEE, 0x33, 0x1D, 0x49, 0xA6, 0xEC, 0x36, 0xF8, 0xDF, 0xAE, 0x11, 0x71, 0xD1, 0x91, 0x57, 0xF4,
-    0x4B, 0x4F, 0xF1, 0x27, 0xB1, 0x9C, 0xFC, 0x86, 0xE6, 0x97, 0xD1, 0xB4, 0xA3, 0xF8, 0x76, 0x19,
-    0xBD, 0xCC, 0xA1, 0x2E, 0x46, 0x68, 0x9D, 0x6D, 0x43, 0x2E, 0x26, 0xAF, 0x98, 0x05, 0xA9, 0x33,
-    0x4B, 0x43, 0xD4, 0x63, 0x76, 0xA3, 0x9E, 0xBB, 0xDC, 0xA1, 0x27, 0x1E, 0x72, 0x1F, 0x53, 0x72,
-    0xC6, 0x9D, 0xDC, 0x0F, 0xE4, 0x95, 0x51, 0xBD, 0x24, 0x37, 0x71, 0x50, 0xA1, 0xD4, 0xE7, 0xE6,
-    0x8F, 0x85, 0x45, 0xEB, 0x27, 0x44, 0x5F, 0xF9, 0xF0, 0x1D, 0x83, 0x45, 0xC9, 0x3E, 0x2C, 0x0A,
-    0xD6, 0x40, 0xD0, 0x32, 0x13, 0x77, 0xD4, 0xA7, 0xEC, 0x64, 0xF9, 0xD5, 0x0F, 0x9F, 0x18, 0x04,
-    0x2C, 0x1E, 0xB2, 0xB1, 0x9C, 0xD8, 0x2F, 0x1F, 0xBF, 0x65, 0xC0, 0x8F, 0x3D, 0x3B, 0xF5, 0xF6,
-    0xEE, 0xD5, 0x16, 0x7C, 0x78, 0xDB, 0xB2, 0xD5, 0xAB, 0x4C, 0xAD, 0xA0, 0xC3, 0xB5, 0x97, 0x1E,
-    0x54, 0x0C, 0x76, 0x60, 0x4B, 0x3A, 0xC6, 0x24, 0x86, 0xF7, 0x71, 0x28, 0xE6, 0x21, 0x9D, 0x91,
-    0x9B, 0x8B, 0xF8, 0x0E, 0x0E, 0x5C, 0xC7, 0x0A, 0x87, 0x33, 0x55, 0x72, 0x99, 0x87, 0x3A, 0xBB,
-    0x80, 0xC3, 0x29, 0xC6, 0x34, 0x07, 0x5A, 0xCC, 0x8A, 0x87, 0xAE, 0xC0, 0x08, 0x16, 0xAF, 0x75,
-    0xCC, 0x3A, 0x28, 0x5E, 0x1D, 0x7A, 0x1E, 0xB8, 0xA2, 0x15, 0x0F, 0x0C, 0x64, 0xED, 0x8B, 0x79,
-    0xD1, 0xE8, 0x90, 0x83, 0x8D, 0x76, 0x5A, 0xD6, 0x6A, 0x8C, 0x5A, 0x33, 0x50, 0xBE, 0x94, 0xF0,
-    0xCB, 0x80, 0xA5, 0xB1, 0x2F, 0x46, 0xB5, 0x61, 0x09, 0xA8, 0x1C, 0xC3, 0x63, 0x67, 0x19, 0xE7,
-    0x6D, 0x19, 0x53, 0xFE, 0xD2, 0xDD, 0x4C, 0x0F, 0x80, 0x73, 0x41, 0xEE, 0x66, 0xD9, 0xB5, 0x32,
-    0xBB, 0x59, 0xC6, 0xF7, 0xBA, 0xE4, 0x9D, 0x66, 0xDA, 0x17, 0xD1, 0x6D, 0x5C, 0x78, 0xE5, 0x97,
-    0x2D, 0x2E, 0xBC, 0xDD, 0xF5, 0x59, 0x19, 0x37, 0x85, 0x8B, 0x71, 0x21, 0xF1, 0xAF, 0xE1, 0xC2,
-    0x8B, 0x60, 0x99, 0xB3, 0xAC, 0xA4, 0xCA, 0xF5, 0x4E, 0x03, 0x59, 0xE5, 0x6F, 0xF7, 0x93, 0x6E,
-    0x3A, 0x56, 0xCA, 0x64, 0x4E, 0x3E, 0x5F, 0x3A, 0x3E, 0x97, 0x15, 0x1B, 0x7D, 0xE7, 0x3F, 0x7A,
-    0x12, 0xB1, 0x2D, 0xA9, 0x9D, 0x56, 0xD9, 0x2A, 0x32, 0x54, 0xF6, 0x68, 0x59, 0xDB, 0x0E, 0xAD,
-    0x02, 0x22, 0x12, 0x4B, 0xC9, 0x28, 0x97, 0x72, 0xDC, 0xD4, 0x08, 0x06, 0xC5, 0x66, 0xBF, 0xA2,
-    0xDD, 0xA6, 0x91, 0x0F, 0x98, 0x7E, 0xBA, 0xC1, 0x38, 0xAE, 0x5C, 0x25, 0x5A, 0x25, 0x0F, 0x9F,
-    0x4D, 0x86, 0x73, 0x16, 0x1C, 0x3F, 0xC6, 0xE5, 0x59, 0xC8, 0x74, 0xC9, 0x08, 0x45, 0xC0, 0x6C,
-    0x26, 0x9A, 0x4F, 0xFC, 0xCB, 0x04, 0x64, 0xEF, 0x92, 0x24, 0x3B, 0x4A, 0xDF, 0xA4, 0x02, 0x07,
-    0xFD, 0xF9, 0xA0, 0xDA, 0x90, 0x2A, 0x0E, 0x2D, 0x23, 0x42, 0x69, 0xC5, 0xA3, 0xA1, 0x77, 0xF1,
-    0x65, 0xE5, 0x96, 0x51, 0x1B, 0x6C, 0x26, 0x8E, 0xA6, 0x70, 0x34, 0xE8, 0x46, 0x0F, 0x5D, 0x17,
-    0x7C, 0x34, 0xBF, 0x06, 0x75, 0x6E, 0xB3, 0x49, 0x69, 0x75, 0x41, 0xC7, 0x5C, 0x2B, 0x5D, 0x9B,
-    0x2B, 0x60, 0x35, 0x9D, 0xB1, 0xB6, 0xB5, 0x63, 0xD7, 0xA1, 0xC5, 0xC1, 0xF7, 0xC2, 0xF2, 0x00,
-    0xE0, 0xCA, 0xA5, 0xD2, 0x52, 0xFA, 0x69, 0xA9, 0x4C, 0x23, 0x0A, 0x4F, 0x9E, 0xE0, 0xDE, 0xA8,
-    0xC6, 0xA0, 0x66, 0x89, 0xD9, 0xB8, 0x4D, 0xA9, 0x9F, 0x87, 0x12, 0x29, 0x42, 0x29, 0xE8, 0xDB,
-    0x7C, 0x6F, 0xBB, 0x13, 0xFB, 0x99, 0x0B, 0xFF, 0x51, 0xE2, 0x73, 0x61, 0x13, 0xFA, 0x6E, 0x16,
-    0xB6, 0x46, 0x53, 0xD4, 0xD3, 0x3E, 0x41, 0x6F, 0x09, 0x55, 0xF3, 0x3A, 0x9D, 0xA5, 0x95, 0x27,
-    0xBD, 0x06, 0x3F, 0x8E, 0x16, 0x6B, 0x78, 0x95, 0x2E, 0x0A, 0xFA, 0x4B, 0x3F, 0x3F, 0x93, 0x87,
-    0x6D, 0xC6, 0x76, 0x6E, 0xFA, 0x46, 0x5E, 0xAE, 0x3D, 0x34, 0x8C, 0x4B, 0x27, 0x71, 0x09, 0xA5,
-    0xE2, 0x9D, 0x3E, 0xA2, 0x51, 0x0B, 0x03, 0x79, 0xAF, 0xC9, 0x86, 0xA4, 0x3C, 0x34, 0xBE, 0xC1,
-    0x96, 0x7B, 0x51, 0x98, 0xB5, 0x90, 0xAB, 0xAD, 0xB4, 0x41, 0x3E, 0x98, 0x1A, 0x8F, 0x91, 0x71,
-    0x4A, 0x0B, 0x5F, 0xDA, 0x6A, 0x78, 0x6C, 0x56, 0xBA, 0xB7, 0x75, 0x36, 0x10, 0x5C, 0x98, 0x33,
-    0x3A, 0x41, 0xB9, 0x64, 0xCA, 0x8C, 0xF2, 0xD7, 0x5D, 0x6D, 0x98, 0x76, 0xB1, 0x5C, 0xB2, 0xC3,
-    0x06, 0x92, 0xD3, 0x64, 0x74, 0xFB, 0x83, 0x0D, 0x9F, 0xD4, 0xB2, 0x79, 0xE4, 0xA8, 0x91, 0xD2,
-    0x82, 0xD8, 0x15, 0xF5, 0x2A, 0x03, 0xFB, 0x45, 0xB9, 0x06, 0xEF, 0x7B, 0x4E, 0x18, 0xA6, 0x2C,
-    0x84, 0xF3, 0x4C, 0x99, 0x93, 0x44, 0x7C, 0x6A, 0x64, 0xDC, 0x1C, 0x56, 0x16, 0x83, 0x54, 0x78,
-    0x7F, 0xC6, 0x9F, 0x63, 0x56, 0x5B, 0xCF, 0xD6, 0x4F, 0xBD, 0xD9, 0x00, 0xE6, 0x99, 0x1C, 0xF5,
-    0xA9, 0x5F, 0x1C, 0x3E, 0xA5, 0xE4, 0xF8, 0xCA, 0x83, 0xEB, 0x70, 0xF5, 0xB3, 0x92, 0x11, 0x83,
-    0x9F, 0x13, 0x99, 0x80, 0x9E, 0x93, 0x2A, 0xBD, 0x0C, 0x5A, 0xCE, 0x19, 0x12, 0xD6, 0x18, 0x15,
-    0x4F, 0x4C, 0x1A, 0xBE, 0x21, 0x79, 0x78, 0xD7, 0xB2, 0x73, 0x58, 0x51, 0x8E, 0xDF, 0xD6, 0x0F,
-    0x0B, 0xC5, 0x36, 0xEC, 0x30, 0x59, 0xF5, 0xC0, 0x15, 0xAE, 0x0A, 0xB4, 0xB5, 0xA1, 0x67, 0x76,
-    0x19, 0x23, 0xFA, 0xE6, 0xE1, 0xB3, 0x61, 0x9B, 0x54, 0x61, 0x5F, 0x94, 0x5A, 0x23, 0xA9, 0x18,
-    0xF6, 0xD3, 0xA2, 0x5C, 0xBF, 0x1F, 0xBA, 0xDE, 0xA4, 0x0D, 0xE1, 0x09, 0xD3, 0x7B, 0x0E, 0x08,
-    0xC5, 0x71, 0xA9, 0x21, 0xF2, 0x91, 0xAC, 0x0D, 0xFE, 0x66, 0x0C, 0x5D, 0xA7, 0x35, 0xBF, 0x5C,
-    0xA6, 0x30, 0x6A, 0xBD, 0x1B, 0x21, 0xD9, 0xCA, 0x56, 0x1E, 0xCD, 0x86, 0x2D, 0x10, 0x43, 0x09,
-    0x58, 0x3A, 0x59, 0xF2, 0x1E, 0xD9, 0xE6, 0xC7, 0x85, 0x73, 0xB5, 0xDE, 0xD3, 0xED, 0xFD, 0x25,
-    0x9F, 0xD4, 0xB9, 0x5A, 0x0E, 0xAF, 0xF6, 0x63, 0x30, 0x28, 0x10, 0x23, 0xA1, 0x4E, 0xE0, 0x97,
-    0x2B, 0xDF, 0x71, 0xCD, 0x1A, 0xBA, 0xA2, 0x56, 0x2B, 0xDF, 0x99, 0x01, 0xB9, 0xE5, 0xD8, 0xCE,
-    0xA8, 0x2F, 0xFC, 0x63, 0x2E, 0xE6, 0xAC, 0xCF, 0x58, 0xDE, 0xF5, 0x81, 0x46, 0xCC, 0x09, 0x1F,
-    0x19, 0x72, 0xCD, 0x91, 0xD0, 0x5A, 0xD0, 0x73, 0x21, 0x43, 0x56, 0x2F, 0x7B, 0xA1, 0x91, 0xEB,
-    0x49, 0x5E, 0x26, 0x54, 0xF5, 0xBB, 0x07, 0xE7, 0xD7, 0x61, 0x0B, 0x67, 0xF4, 0x5A, 0xD1, 0x90,
-    0xFA, 0xEB, 0x96, 0xEB, 0xA6, 0xB4, 0xE1, 0xCF, 0x67, 0x23, 0x93, 0x35, 0xB3, 0x85, 0xA5, 0xEC,
-    0x3E, 0xD8, 0x2A, 0x35, 0xF5, 0x96, 0xE2, 0x35, 0x18, 0xC7, 0x4E, 0xFD, 0x62, 0x02, 0x8E, 0x37,
-    0x9B, 0xF8, 0x45, 0x3E, 0x9C, 0xB0, 0xCC, 0xBE, 0x71, 0x99, 0xA9, 0x89, 0xA5, 0xB9, 0xA2, 0x4B,
-    0xC3, 0x2A, 0x83, 0x9E, 0x53, 0xCC, 0xB9, 0x4D, 0xAB, 0x2F, 0xAE, 0xD9, 0xCB, 0x3F, 0x85, 0xE6,
-    0x06, 0xC9, 0xFC, 0x27, 0x7A, 0x59, 0x23, 0xDE, 0x0C, 0x5E, 0x2E, 0x09, 0xF1, 0xC5, 0x69, 0xF5,
-    0xA0, 0x26, 0x27, 0x45, 0x07, 0xF3, 0x29, 0x2F, 0x09, 0x45, 0xB8, 0x86, 0x97, 0xB2, 0x79, 0xB9,
-    0xD6, 0x28, 0x97, 0x9D, 0x6C, 0xE2, 0x36, 0xA4, 0x1C, 0x9F, 0x0E, 0x72, 0xCB, 0x55, 0xCC, 0xA9,
-    0x67, 0xE2, 0x44, 0xA5, 0xE0, 0x83, 0x9B, 0x83, 0xAD, 0x04, 0xE7, 0x2D, 0x3E, 0x5F, 0xB3, 0x6A,
-    0x6A, 0xC6, 0xA5, 0x89, 0x3F, 0xDD, 0x32, 0x58, 0xCE, 0x9F, 0x1F, 0xA8, 0xF3, 0xB9, 0x92, 0x78,
-    0x5C, 0x69, 0x93, 0x19, 0x97, 0x85, 0x33, 0x1F, 0x65, 0x43, 0xF7, 0x1B, 0x17, 0x70, 0x64, 0x0E,
-    0x6D, 0x42, 0x17, 0x51, 0xE0, 0x77, 0xAC, 0x42, 0x68, 0x73, 0x1B, 0x6B, 0x35, 0xD7, 0x52, 0xC4,
-    0x60, 0x2D, 0x88, 0xAD, 0x59, 0xEB, 0x8C, 0xF1, 0x33, 0x5A, 0xD0, 0x27, 0xC4, 0x10, 0x65, 0x6F,
-    0x41, 0x1E, 0x46, 0x4D, 0xD0, 0xC4, 0x2B, 0xF7, 0x8A, 0x93, 0x35, 0x8D, 0xEB, 0x72, 0x95, 0x90,
-    0x25, 0x6F, 0xCD, 0xA6, 0x63, 0xD4, 0x81, 0x12, 0x36, 0xE6, 0x47, 0xB6, 0x3B, 0x8B, 0x3A, 0x18,
-    0x4C, 0x59, 0x8E, 0xFC, 0x01, 0x3B, 0xCA, 0xC4, 0x6F, 0xBF, 0x5E, 0x70, 0x30, 0x7F, 0xA9, 0x38,
-    0x6F, 0xF4, 0x0F, 0x58, 0x42, 0x54, 0x3D, 0x1F, 0xF8, 0xA8, 0x01, 0x27, 0x9C, 0x7D, 0x65, 0x35,
-    0x5C, 0xB1, 0xDF, 0x0D, 0x2D, 0x73, 0x68, 0x51, 0x59, 0xA2, 0x00, 0xBE, 0x32, 0x39, 0x47, 0x53,
-    0x26, 0x93, 0x21, 0x67, 0x87, 0x4E, 0xF4, 0xB6, 0xD8, 0xBD, 0xFF, 0x72, 0x50, 0xDC, 0x11, 0xDF,
-    0x65, 0x02, 0x5A, 0x49, 0xBE, 0x93, 0xDA, 0x22, 0x00, 0xAB, 0x65, 0xD5, 0x2B, 0x2D, 0x7D, 0x6E,
-    0x5B, 0x39, 0x6E, 0x14, 0x21, 0x4A, 0x99, 0xD2, 0xB2, 0x05, 0xA8, 0xFB, 0xB3, 0xC3, 0x48, 0xED,
-    0x66, 0x5E, 0x7A, 0x1A, 0xA3, 0x9B, 0xFC, 0xD7, 0x67, 0xFD, 0xC9, 0x31, 0x85, 0x72, 0xF1, 0xEC,
-    0x72, 0x0D, 0x30, 0x46, 0x71, 0x2D, 0xB7, 0x43, 0xC7, 0x99, 0xEC, 0x54, 0x94, 0x52, 0xD3, 0x58,
-    0x4D, 0x2A, 0xBB, 0x22, 0x82, 0xC1, 0xDC, 0x53, 0x52, 0xF6, 0xB3, 0xCE, 0x60, 0x6B, 0x38, 0x18,
-    0xAF, 0x30, 0x5E, 0xFB, 0x87, 0x41, 0xDC, 0xE7, 0x5B, 0x32, 0x75, 0x31, 0x3D, 0x73, 0xA1, 0xF8,
-    0xF5, 0xE7, 0xB6, 0xDE, 0xE4, 0x90, 0x51, 0xFB, 0xC1, 0x1B, 0x0F, 0x1D, 0x3F, 0xB6, 0x5C, 0x70,
-    0x6C, 0x42, 0x90, 0x9C, 0xD0, 0xFD, 0x59, 0x28, 0xCA, 0xE1, 0x2E, 0x63, 0x46, 0xAE, 0xB2, 0xB3,
-    0x37, 0xEA, 0xE8, 0x3E, 0x8A, 0xF2, 0x4B, 0x77, 0xFD, 0xA4, 0xCF, 0xAF, 0xD2, 0x69, 0xB5, 0x51,
-    0x17, 0x2F, 0xF5, 0xC5, 0x85, 0x0E, 0x8A, 0x65, 0x5A, 0xA2, 0x08, 0x0C, 0x67, 0xE3, 0x5E, 0xC3,
-    0x75, 0x58, 0x17, 0x28, 0xEA, 0xB9, 0x0E, 0x6B, 0xCD, 0xA5, 0x59, 0x67, 0x28, 0xEA, 0xA8, 0x7E,
-    0x82, 0x1A, 0xCA, 0xE9, 0xD6, 0x16, 0xBB, 0x82, 0xE6, 0xDB, 0xF9, 0xC4, 0xC2, 0xB1, 0x9F, 0x3C,
-    0x8B, 0xFB, 0xF9, 0xA9, 0xF2, 0x37, 0x41, 0x94, 0x75, 0x31, 0x07, 0x31, 0xFF, 0xF8, 0x40, 0x48,
-    0x74, 0xC4, 0xF6, 0xE4, 0x0A, 0xD8, 0x50, 0x36, 0xED, 0x55, 0x02, 0xCE, 0x8D, 0x5A, 0x31, 0x1C,
-    0xE9, 0x4D, 0x14, 0x79, 0x54, 0x3E, 0x6A, 0x50, 0x94, 0x5F, 0xE8, 0x8B, 0xB7, 0x7A, 0xD4, 0x34,
-    0xA9, 0x51, 0x54, 0xCC, 0xFC, 0xC6, 0x1D, 0xE6, 0x1E, 0x5E, 0x2B, 0x51, 0xE4, 0xD9, 0x9E, 0x86,
-    0xED, 0xE1, 0xC2, 0x2B, 0x3D, 0xDB, 0x53, 0xB3, 0x88, 0x09, 0x45, 0x14, 0xEC, 0xCC, 0xCF, 0xE4,
-    0x36, 0xAD, 0xD2, 0xD9, 0xBE, 0xBD, 0xE3, 0x09, 0x1B, 0x26, 0x76, 0x43, 0x4E, 0x36, 0xB2, 0x9A,
-    0x07, 0x19, 0x8D, 0xB3, 0xFF, 0xAD, 0xC0, 0xF2, 0x2A, 0xEA, 0xA9, 0xDF, 0x73, 0xD0, 0x3B, 0x21,
-    0xAA, 0x16, 0xA0, 0x3C, 0xA5, 0x55, 0x84, 0x16, 0x17, 0xC4, 0x38, 0x83, 0xF4, 0xAE, 0xA8, 0x47,
-    0x64, 0xB4, 0xD1, 0x8C, 0x59, 0x16, 0x69, 0x63, 0xA9, 0x5D, 0xBC, 0x33, 0x66, 0xE8, 0xD0, 0x5C,
-    0x8F, 0x67, 0xFE, 0x7F, 0x98, 0xA9, 0xB9, 0x36, 0x6D, 0x77, 0xE2, 0x14, 0x98, 0x08, 0x3A, 0x99,
-    0x34, 0xC9, 0x9C, 0x50, 0x8A, 0x1B, 0xCF, 0xF7, 0xAB, 0xB2, 0xB6, 0x40, 0x53, 0x9B, 0x76, 0x34,
-    0x5A, 0xDB, 0x02, 0x4D, 0xEB, 0x8B, 0xAB, 0x69, 0xED, 0xEB, 0x81, 0xD7, 0xB2, 0x87, 0x2C, 0xAC,
-    0xF6, 0xFF, 0x7D, 0x2A, 0xDA, 0x81, 0xF1, 0x4A, 0x3F, 0xC6, 0x78, 0xBD, 0xBF, 0x39, 0xC8, 0x5D,
-    0xC5, 0x24, 0x6E, 0x25, 0x35, 0x4D, 0x65, 0x91, 0xCC, 0x77, 0xFA, 0xE3, 0xC7, 0x37, 0xD6, 0x5B,
-    0x25, 0xCB, 0x64, 0x37, 0x02, 0x6F, 0x05, 0x74, 0x4C, 0xBC, 0xAD, 0x0D, 0xC5, 0xD6, 0x2C, 0xB2,
-    0xE1, 0xEB, 0x1F, 0x6F, 0xBC, 0x66, 0x0F, 0x8C, 0xD7, 0x13, 0x35, 0x37, 0x2E, 0xBF, 0x67, 0x62,
-    0x9F, 0x4B, 0xB6, 0xA6, 0xEB, 0x89, 0x1D, 0x9B, 0x32, 0x23, 0x58, 0x10, 0x62, 0x02, 0xA2, 0xE4,
-    0xAA, 0x79, 0x63, 0xDE, 0xD7, 0x98, 0x83, 0x7E, 0xE4, 0xF8, 0xE6, 0xFE, 0xD2, 0x88, 0x92, 0xE3,
-    0xAB, 0xA5, 0x6B, 0x75, 0x87, 0x7C, 0xCE, 0x3F, 0xDB, 0xFB, 0xA6, 0x64, 0x00, 0x05, 0x31, 0x55,
-    0x89, 0xB3, 0x6A, 0x52, 0x36, 0x69, 0x42, 0x4C, 0x34, 0x28, 0x80, 0x6B, 0x73, 0x6D, 0x53, 0x18,
-    0x9C, 0x91, 0xF3, 0xE1, 0xD9, 0x42, 0x42, 0x02, 0x64, 0x72, 0x78, 0x4B, 0xCB, 0xE1, 0x30, 0xF9,
-    0xF3, 0xC8, 0x09, 0xF3, 0x21, 0xA7, 0xED, 0xFB, 0xCF, 0x52, 0x7F, 0x2D, 0xE5, 0xE4, 0xDE, 0x35,
-    0x14, 0xF6, 0x48, 0x7E, 0x18, 0x64, 0xEF, 0x92, 0xC5, 0x32, 0x44, 0x88, 0xF9, 0x65, 0x79, 0x99,
-    0x59, 0xF2, 0x7E, 0x6C, 0xFF, 0x7B, 0xC3, 0xC4, 0x4F, 0xB8, 0xAC, 0x69, 0xC2, 0x70, 0x1D, 0x66,
-    0xBB, 0xDD, 0xE6, 0x8C, 0xBA, 0xA9, 0xC5, 0x07, 0xE6, 0xA3, 0xCB, 0xCF, 0xB4, 0x0A, 0xB3, 0xAE,
-    0x05, 0x5B, 0x5A, 0x3B, 0x7E, 0x18, 0x7D, 0x82, 0x79, 0xBF, 0x32, 0x5C, 0x7F, 0x1B, 0x15, 0x60,
-    0xF2, 0xB2, 0xA2, 0xB3, 0x96, 0x6C, 0xF1, 0xB3, 0x5A, 0x7D, 0xC2, 0xD8, 0x27, 0xE9, 0x55, 0x94,
-    0xFB, 0x20, 0xFB, 0x94, 0xA5, 0x2F, 0xEC, 0x94, 0x51, 0x89, 0x17, 0x71, 0x1D, 0x52, 0xAD, 0x8F,
-    0x20, 0xDB, 0xAD, 0x16, 0xC8, 0xE6, 0x52, 0xEE, 0x39, 0xC3, 0xB4, 0x38, 0x41, 0x2F, 0x92, 0xB5,
-    0x48, 0x8B, 0x91, 0x1C, 0x52, 0x15, 0x08, 0x66, 0x94, 0x04, 0x82, 0xEF, 0x98, 0x39, 0xA2, 0x1D,
-    0xFB, 0x48, 0x6A, 0xA7, 0x32, 0x0B, 0xBF, 0x17, 0xD2, 0x7E, 0x56, 0xCC, 0x28, 0xA4, 0x83, 0xB0,
-    0xFC, 0xE2, 0x1A, 0x14, 0xF9, 0xCC, 0x16, 0x28, 0x3B, 0xF2, 0x67, 0x47, 0x2D, 0x54, 0x25, 0x03,
-    0x07, 0x99, 0xF4, 0x50, 0x18, 0x93, 0xB7, 0x70, 0xF5, 0x99, 0x91, 0x37, 0x7D, 0x66, 0xFF, 0x81,
-    0x82, 0xF2, 0x42, 0x6D, 0x51, 0xB9, 0x7C, 0x3E, 0xC5, 0x36, 0x69, 0xB3, 0x59, 0xF0, 0x8C, 0xD1,
-    0x0A, 0xD7, 0xCA, 0x97, 0x30, 0xA3, 0x19, 0x9D, 0xDE, 0xDA, 0x92, 0x0B, 0x1E, 0x24, 0x8A, 0x6B,
-    0x0B, 0xB5, 0x98, 0xA6, 0x11, 0x05, 0xF3, 0x2F, 0xD9, 0x19, 0x11, 0xFF, 0x0B, 0x04, 0x19, 0x53,
-    0x87, 0xB1, 0x2F, 0x56, 0xFF, 0x31, 0x8C, 0x81, 0xE0, 0x29, 0x6B, 0xC1, 0x0A, 0x30, 0x3F, 0x53,
-    0x3D, 0x21, 0xC6, 0xEE, 0x63, 0x10, 0xFC, 0x79, 0x28, 0x12, 0x6B, 0x63, 0x91, 0x3C, 0x74, 0x69,
-    0xDF, 0x55, 0x01, 0xDA, 0x7E, 0x0D, 0xE3, 0xF1, 0x01, 0xF4, 0x49, 0xF1, 0xAD, 0xAF, 0x8E, 0x6B,
-    0xD6, 0x34, 0x93, 0xBF, 0xFE, 0x2F, 0x8F, 0x58, 0xDA, 0x77, 0x59, 0x40, 0x11, 0xCA, 0x59, 0xCD,
-    0x6D, 0x52, 0xEF, 0x8B, 0xD0, 0x27, 0x5D, 0xF2, 0xAC, 0x30, 0x83, 0x68, 0xA1, 0x45, 0xC9, 0x87,
-    0x4F, 0xF6, 0x1F, 0x1F, 0xC8, 0x32, 0x55, 0x46, 0x5A, 0x9B, 0x61, 0x0C, 0x48, 0x7D, 0xF0, 0x20,
-    0x9E, 0xDE, 0x7D, 0xAC, 0x75, 0x96, 0xE8, 0x28, 0x9C, 0xCB, 0xEA, 0x79, 0xF0, 0xDF, 0xB7, 0xA1,
-    0xED, 0x4B, 0x4F, 0x21, 0x0C, 0x0E, 0x04, 0x84, 0x83, 0x75, 0x28, 0xBC, 0x8A, 0x4C, 0x7A, 0xE4,
-    0xAA, 0xB9, 0xEB, 0xC5, 0x5B, 0x47, 0xB9, 0xBE, 0x29, 0x81, 0x0A, 0x17, 0x15, 0xD1, 0x62, 0xBA,
-    0x0D, 0xEF, 0x76, 0x75, 0xAE, 0x6C, 0x39, 0xDE, 0xAD, 0x55, 0x73, 0xC1, 0xB6, 0x50, 0x9C, 0x6A,
-    0x31, 0x5D, 0x60, 0xCF, 0x14, 0x5C, 0x5A, 0x77, 0xD7, 0x5A, 0x7A, 0x57, 0x2F, 0x39, 0x4B, 0x3B,
-    0x94, 0x89, 0x34, 0xE2, 0x2A, 0x21, 0xAC, 0x07, 0x44, 0x1A, 0x2D, 0xE6, 0xF1, 0xFA, 0x92, 0x68,
-    0xFB, 0xEB, 0xA4, 0xD9, 0x42, 0x67, 0x5C, 0x91, 0xD7, 0x56, 0x3F, 0xEB, 0x37, 0x06, 0xC6, 0x5D,
-    0xF9, 0x0B, 0xB8, 0x13, 0xBA, 0xEA, 0x36, 0xB4, 0x0A, 0x14, 0x9E, 0x18, 0x96, 0x8B, 0xA7, 0x51,
-    0x0E, 0x68, 0x45, 0xB5, 0xEA, 0x53, 0x89, 0xA7, 0x1F, 0x7E, 0x44, 0x0B, 0xFF, 0x6A, 0x3B, 0x40,
-    0x16, 0x6F, 0x98, 0xF5, 0xD1, 0x12, 0x79, 0xCB, 0xA5, 0x07, 0xE2, 0x93, 0xC4, 0xDB, 0x7B, 0x59,
-    0x52, 0xB5, 0xC2, 0x5C, 0x2D, 0xFB, 0x3D, 0x0E, 0xBF, 0x4B, 0x94, 0x51, 0x09, 0x87, 0xFF, 0x48,
-    0x7A, 0x48, 0x6A, 0xFE, 0x27, 0x2E, 0xAD, 0xDB, 0x07, 0xCC, 0x0D, 0x0C, 0xA6, 0xFB, 0x20, 0x26,
-    0xEA, 0x15, 0x2E, 0xCD, 0xCF, 0x8B, 0x0D, 0x4D, 0x2C, 0x89, 0x52, 0x1E, 0x19, 0xCB, 0x98, 0xAA,
-    0xC6, 0xF0, 0x0C, 0xA6, 0x3E, 0x32, 0x3E, 0xA3, 0x55, 0x84, 0x09, 0x55, 0xA1, 0xDC, 0xFF, 0x82,
-    0x08, 0x9A, 0x21, 0xAA, 0x6E, 0x70, 0xA5, 0xB1, 0x72, 0x33, 0x1F, 0xCB, 0x85, 0x21, 0xA5, 0xFA,
-    0x1F, 0xF9, 0xFD, 0x0C, 0xEF, 0x2A, 0x58, 0x35, 0x54, 0x4B, 0x1C, 0xF2, 0xFF, 0x41, 0xA8, 0xA4,
-    0x1A, 0x16, 0x6F, 0x7B, 0x8B, 0x10, 0x91, 0xBB, 0xAB, 0x90, 0xDE, 0x50, 0x19, 0x2B, 0x88, 0x2D,
-    0xBA, 0x0C, 0x5C, 0xE4, 0x0E, 0x74, 0x47, 0x3A, 0x9C, 0x48, 0xBF, 0x34, 0xA0, 0x32, 0xD7, 0xE7,
-    0x43, 0xB6, 0xE3, 0xDF, 0x15, 0xBF, 0x2F, 0x4D, 0x11, 0xA1, 0x89, 0x92, 0x1D, 0x20, 0xA5, 0x94,
-    0x9F, 0xE1, 0x02, 0xE8, 0xDE, 0xFE, 0x87, 0x83, 0x71, 0x01, 0xF4, 0x6B, 0xE3, 0x02, 0xE8, 0x87,
-    0x36, 0xFD, 0xDD, 0xA3, 0xA9, 0x59, 0xAF, 0x97, 0xBB, 0x71, 0x01, 0x74, 0x56, 0x80, 0x91, 0x34,
-    0x13, 0xAE, 0x92, 0xA8, 0xC6, 0x53, 0x0A, 0x2E, 0x52, 0x2E, 0x5A, 0x09, 0x86, 0x9E, 0x35, 0x6C,
-    0x7B, 0x67, 0x6B, 0x36, 0x12, 0xBA, 0x32, 0xF3, 0xBB, 0xD1, 0x32, 0xA0, 0x5A, 0xB3, 0x71, 0xB2,
-    0xED, 0x87, 0xB3, 0xCE, 0x16, 0xD5, 0xEB, 0x0F, 0x3B, 0xBF, 0x67, 0x6B, 0x36, 0x76, 0x1F, 0x5A,
-    0xB3, 0x31, 0xEE, 0xFF, 0x2F, 0xAD, 0x57, 0x31, 0x8C, 0xD6, 0xC8, 0x15, 0x7E, 0xB6, 0xF9, 0xD7,
-    0xD1, 0x3A, 0xA7, 0x21, 0xD2, 0xAE, 0x94, 0x70, 0x52, 0x9C, 0x32, 0xB7, 0x42, 0xEB, 0x94, 0x14,
-    0x1C, 0xE3, 0xDC, 0x2A, 0x3A, 0x29, 0x29, 0x76, 0x0B, 0x50, 0xA4, 0xA4, 0x40, 0x91, 0x52, 0x10,
-    0x8A, 0x23, 0x45, 0x8A, 0x14, 0xA7, 0x1D, 0xC3, 0x16, 0x57, 0x5C, 0x01, 0x4D, 0x14, 0x29, 0x29,
-    0x20, 0xD2, 0x2A, 0x02, 0x22, 0x5D, 0x9A, 0x14, 0x70, 0x0A, 0xD8, 0xB0, 0x05, 0xC5, 0x15, 0xF1,
-    0xB1, 0x51, 0x28, 0x52, 0xE0, 0x68, 0x39, 0xA1, 0xE4, 0x0A, 0x0C, 0x98, 0x60, 0xC4, 0xD8, 0x2F,
-    0xDF, 0x1B, 0x7B, 0x97, 0x9F, 0xE3, 0x38, 0xF6, 0xA2, 0x1B, 0xEF, 0xFC, 0x9E, 0xF5, 0xBC, 0xF7,
-    0xE6, 0xCD, 0x9B, 0xF7, 0xBE, 0xF7, 0x86, 0xC8, 0xCB, 0xA8, 0x3A, 0x7E, 0xE9, 0xC3, 0x4B, 0xE7,
-    0xAA, 0x3F, 0x64, 0xE7, 0xE8, 0xD5, 0x0F, 0x91, 0x9F, 0x46, 0xB4, 0x78, 0x61, 0xF1, 0x83, 0x68,
-    0xD6, 0xFF, 0x21, 0xCD, 0xBE, 0xFA, 0x59, 0xB8, 0xB8, 0xCC, 0x9B, 0xDC, 0x70, 0xB7, 0x33, 0x60,
-    0xE6, 0xA7, 0xE8, 0xF7, 0xD0, 0x7F, 0x73, 0xC4, 0x35, 0xCD, 0x7C, 0x9B, 0xF9, 0xBF, 0xCC, 0xDD,
-    0xF0, 0xFF, 0x61, 0x76, 0xCD, 0x8E, 0xAF, 0x7C, 0x78, 0x7D, 0xD1, 0x1C, 0x14, 0x33, 0x74, 0xE5,
-    0x2B, 0xFF, 0x5B, 0xA0, 0x63, 0xF3, 0x47, 0x8E, 0x2C, 0x61, 0x81, 0x85, 0x8B, 0x17, 0x33, 0x2C,
-    0x32, 0xF5, 0x5F, 0x58, 0x5D, 0x55, 0x37, 0xAD, 0xDE, 0xB0, 0xF9, 0xC9, 0x15, 0xF5, 0xAF, 0x3E,
-    0xD9, 0xB4, 0x7A, 0xAD, 0x31, 0x5E, 0x1A, 0x35, 0xBA, 0xE0, 0xB0, 0x49, 0x8A, 0x3E, 0xA8, 0x27,
-    0xA9, 0x79, 0xCF, 0xEA, 0xEB, 0x36, 0x2E, 0xFB, 0xB0, 0x9E, 0x0F, 0xAB, 0xE4, 0xAD, 0x56, 0x95,
-    0x5D, 0x58, 0xE7, 0x81, 0xD5, 0x45, 0xAF, 0xEA, 0xFC, 0xFD, 0x56, 0x97, 0x87, 0x27, 0x2B, 0xAA,
-    0xCA, 0xDF, 0x6E, 0xF5, 0xCD, 0x4E, 0xD5, 0x1C, 0xB4, 0xFA, 0x64, 0xA7, 0xCA, 0x3C, 0xAC, 0x75,
-    0xBA, 0x32, 0x19, 0xA4, 0x05, 0x56, 0xD5, 0xE6, 0x64, 0x1F, 0xD5, 0x71, 0xC1, 0xBE, 0x55, 0xA5,
-    0xFE, 0xBE, 0xF5, 0x56, 0x26, 0x64, 0xD6, 0x6C, 0x5C, 0xE7, 0x4B, 0x36, 0xAE, 0x20, 0x2F, 0x2E,
-    0xF3, 0xA0, 0x8D, 0x0B, 0x13, 0x34, 0x93, 0x74, 0x0E, 0x9A, 0x52, 0x52, 0x50, 0x58, 0x93, 0x07,
-    0xD3, 0x68, 0x22, 0x95, 0xF9, 0x3F, 0xFE, 0xE4, 0x67, 0x30, 0xB0, 0x61, 0xFE, 0xC9, 0xD9, 0xDF,
-    0x65, 0x41, 0x45, 0xD4, 0x12, 0x1D, 0xC2, 0x4C, 0x41, 0x41, 0x4D, 0x64, 0xC5, 0x80, 0x14, 0xEF,
-    0xF0, 0xE4, 0x4E, 0x40, 0xD4, 0x88, 0x24, 0x8A, 0x4B, 0x0A, 0x1A, 0x47, 0x03, 0x51, 0x51, 0x11,
-    0x32, 0x3F, 0x61, 0xEE, 0x21, 0x2A, 0x1B, 0xB9, 0x3B, 0xCC, 0xA4, 0x10, 0xE5, 0x05, 0xF5, 0x37,
-    0x86, 0x99, 0xB3, 0xF7, 0xEE, 0x55, 0xA3, 0x5C, 0x59, 0xBE, 0xA4, 0x50, 0x44, 0xF9, 0x7D, 0xC0,
-    0xF7, 0xB9, 0xCB, 0xF9, 0xCF, 0xFC, 0x29, 0x5C, 0xC1, 0x26, 0xBD, 0x07, 0x56, 0x0A, 0x89, 0x56,
-    0x29, 0xEC, 0xC8, 0xD8, 0x90, 0x5B, 0xC3, 0x37, 0xB8, 0x34, 0x15, 0xF4, 0xF8, 0x95, 0xAC, 0x3D,
-    0x59, 0xEA, 0xF4, 0x43, 0x4E, 0x4A, 0xEC, 0x77, 0x92, 0x72, 0x6A, 0x6E, 0x40, 0x44, 0xDC, 0x46,
-    0xB0, 0x5F, 0x5C, 0xCD, 0xD1, 0x44, 0x9E, 0xD4, 0xC3, 0x44, 0x9E, 0xB9, 0x29, 0x99, 0x54, 0x56,
-    0xA6, 0x93, 0x52, 0x08, 0xF6, 0x08, 0x41, 0xD0, 0x99, 0xBB, 0xBD, 0x2E, 0x56, 0x8E, 0x9F, 0xFF,
-    0xF0, 0xFC, 0x6E, 0xBC, 0x5C, 0x9E, 0x85, 0x0B, 0x0B, 0x1F, 0xEC, 0xC6, 0xBF, 0xDD, 0x43, 0xA6,
-    0x7B, 0xF6, 0xF8, 0xD9, 0xAB, 0x1F, 0xE1, 0xF8, 0x25, 0x0D, 0xCF, 0xEE, 0x39, 0xE8, 0xB5, 0xE1,
-    0xD9, 0x2D, 0xC7, 0x76, 0xCB, 0x4B, 0x39, 0x01, 0x34, 0xEE, 0x28, 0xAA, 0x65, 0x60, 0xB8, 0x08,
-    0xDC, 0xD9, 0xEA, 0x8D, 0xC6, 0x97, 0xE8, 0x01, 0x41, 0x4F, 0x6E, 0x10, 0x88, 0xEB, 0x3A, 0xB6,
-    0x2E, 0xAA, 0x8D, 0x1B, 0xE8, 0xB7, 0x5A, 0x9D, 0x8D, 0x44, 0xF1, 0xB5, 0xCB, 0x34, 0x73, 0xC7,
-    0xB7, 0x7A, 0x79, 0x93, 0x2B, 0xC5, 0x99, 0xE1, 0x8F, 0x1E, 0x70, 0x17, 0x71, 0x1B, 0xF1, 0x66,
-    0xD3, 0x27, 0x1B, 0x6D, 0x4E, 0xE6, 0x94, 0x35, 0xC1, 0x7D, 0x2B, 0x4B, 0xDA, 0xB8, 0xE8, 0x8C,
-    0xAC, 0x04, 0xFF, 0xD7, 0x47, 0x0B, 0x1C, 0xB6, 0xF1, 0xAC, 0xBA, 0x05, 0xDF, 0x26, 0x9D, 0x99,
-    0xE0, 0x91, 0x10, 0xC5, 0x85, 0xFA, 0xD8, 0xEA, 0xB7, 0x6B, 0x48, 0x0F, 0x7A, 0x8E, 0x9E, 0x5A,
-    0xD1, 0x51, 0x33, 0x21, 0xAA, 0xC1, 0x19, 0x72, 0xAA, 0x3A, 0xA7, 0xC5, 0x1E, 0xA2, 0xBD, 0x34,
-    0xDD, 0x7C, 0x4E, 0xC5, 0xED, 0x5C, 0x53, 0x5C, 0x8A, 0xCF, 0x0E, 0xEE, 0xCA, 0x35, 0x75, 0xE3,
-    0x78, 0x67, 0x7F, 0x32, 0x5E, 0x6A, 0x87, 0x4D, 0xBB, 0x2D, 0xD9, 0xA8, 0x7A, 0x36, 0x86, 0xE3,
-    0xEF, 0x8C, 0xF5, 0xB6, 0xE5, 0xF4, 0x5A, 0x6B, 0x66, 0xEE, 0xD0, 0xEB, 0x67, 0xE8, 0x9D, 0x34,
-    0xD9, 0xC0, 0xE6, 0x98, 0x72, 0xEB, 0x73, 0x1D, 0xF3, 0x7D, 0xE0, 0xCE, 0x49, 0xEE, 0x43, 0xB6,
-    0xB2, 0x6B, 0x4E, 0x00, 0x02, 0xEA, 0x7E, 0xE7, 0x21, 0x42, 0x3B, 0xB5, 0xD9, 0xE8, 0x65, 0xD8,
-    0x92, 0xB0, 0x29, 0x75, 0xB7, 0xD6, 0xA7, 0x65, 0x9C, 0x9C, 0x1C, 0xC7, 0xF9, 0x60, 0x80, 0xED,
-    0x31, 0x4C, 0x2E, 0xF4, 0x42, 0x83, 0xA0, 0xEB, 0xE2, 0xCD, 0x56, 0x2F, 0x57, 0x1D, 0x05, 0x2D,
-    0xE5, 0xF9, 0xF5, 0x9E, 0x43, 0xD8, 0x22, 0x14, 0x5B, 0xA4, 0xDC, 0x05, 0xDC, 0xCA, 0x21, 0xC2,
-    0x16, 0xBA, 0x91, 0x03, 0x95, 0x96, 0x92, 0xE7, 0xDE, 0x3D, 0xB6, 0xAE, 0xB3, 0xA4, 0x50, 0x45,
-    0x84, 0xA0, 0xF3, 0xD6, 0xF1, 0x25, 0xAA, 0xA3, 0x5A, 0x67, 0xFA, 0x94, 0x15, 0xBC, 0x50, 0xC5,
-    0x55, 0xBA, 0x1A, 0xD4, 0x41, 0x9D, 0xA4, 0xFB, 0xD2, 0xF3, 0x6E, 0x56, 0x67, 0x80, 0x8B, 0xA4,
-    0x00, 0x81, 0x2A, 0x93, 0x02, 0x27, 0x0D, 0x9A, 0xA0, 0x8E, 0x2A, 0xED, 0x37, 0x42, 0x66, 0xBD,
-    0xF5, 0xD9, 0xEC, 0x18, 0x84, 0xE2, 0x28, 0x7A, 0x9C, 0x90, 0xDF, 0x22, 0x8C, 0xC3, 0x8A, 0xCE,
-    0x83, 0x81, 0xC0, 0x29, 0x22, 0xB0, 0x8F, 0xCA, 0x6F, 0x55, 0x01, 0x7A, 0x80, 0xA1, 0xA6, 0xD9,
-    0xEC, 0x17, 0x98, 0x8D, 0x4B, 0xAC, 0x58, 0x31, 0x01, 0xD2, 0x40, 0x66, 0x04, 0x93, 0x84, 0xA8,
-    0x27, 0xB7, 0x00, 0xAD, 0x06, 0x75, 0x9C, 0xF9, 0xE7, 0x44, 0x0D, 0xA0, 0xD4, 0xBB, 0x02, 0x1D,
-    0x1E, 0x53, 0x70, 0x3B, 0x0B, 0x6F, 0x14, 0x6A, 0xAD, 0x8A, 0xBD, 0xFA, 0x10, 0xB5, 0x07, 0x31,
-    0xB1, 0x97, 0x92, 0x2C, 0xAE, 0x55, 0xA3, 0x5C, 0x38, 0xFB, 0x4C, 0xBA, 0x0E, 0x7A, 0xD2, 0x65,
-    0x68, 0xE9, 0xAA, 0x8B, 0xEA, 0xA8, 0x88, 0xA0, 0x4A, 0xA1, 0x5A, 0xE2, 0x34, 0x6E, 0xC2, 0x2E,
-    0xE8, 0x82, 0xDE, 0x67, 0x10, 0x26, 0xE4, 0x8D, 0x4E, 0x01, 0x3A, 0x83, 0xDE, 0xF8, 0x3D, 0x5D,
-    0x8A, 0x9A, 0xA8, 0x8D, 0x5A, 0xD5, 0xC4, 0x45, 0x9E, 0xA9, 0x66, 0x4F, 0x04, 0x6B, 0xC2, 0x8E,
-    0x19, 0x7E, 0x31, 0xC4, 0x2F, 0x86, 0x73, 0x8A, 0xED, 0x24, 0x68, 0x15, 0x17, 0x9C, 0xD4, 0xCA,
-    0x02, 0x35, 0x8A, 0xBC, 0x51, 0xF5, 0x95, 0x88, 0x9B, 0x38, 0xA5, 0xFC, 0x34, 0x7C, 0x47, 0x24,
-    0x20, 0x9E, 0x20, 0x81, 0xB6, 0x25, 0x5C, 0x12, 0x09, 0x51, 0x03, 0xC9, 0x99, 0xAE, 0x54, 0xF1,
-    0x4D, 0xCA, 0xD3, 0xAF, 0x63, 0xE9, 0x75, 0x89, 0xB2, 0x52, 0xDF, 0x05, 0x26, 0xE9, 0x52, 0x3F,
-    0x84, 0x72, 0x78, 0x6D, 0xB9, 0x57, 0xB2, 0x65, 0x7D, 0xC0, 0x11, 0x32, 0x86, 0xDF, 0xB9, 0x97,
-    0xD7, 0x25, 0x45, 0x7C, 0xD3, 0x7A, 0xDB, 0x8E, 0x3A, 0x11, 0xD4, 0xF3, 0x7B, 0x53, 0xE9, 0xC7,
-    0xC2, 0x0E, 0x28, 0x5B, 0x19, 0x5C, 0xFF, 0x04, 0x00, 0x50, 0xDC, 0x8E, 0x5B, 0xDD, 0xE5, 0xD7,
-    0x4E, 0x6C, 0xE0, 0x74, 0x93, 0x02, 0xDE, 0xE7, 0xD9, 0x3C, 0x8B, 0xEF, 0xD5, 0x1E, 0x42, 0x26,
-    0x86, 0xBB, 0x21, 0x2E, 0x54, 0x2D, 0x6E, 0xB1, 0xDD, 0xC4, 0x20, 0x8C, 0xC0, 0x68, 0x60, 0xEC,
-    0x61, 0x6E, 0x6E, 0x74, 0x71, 0xA0, 0xF5, 0x76, 0x77, 0xC1, 0x0F, 0xC2, 0xFD, 0x07, 0x81, 0xC8,
-    0x19, 0xD2, 0x40, 0x1D, 0x56, 0xDE, 0x5F, 0x11, 0x59, 0x98, 0x79, 0xBD, 0x1F, 0x4D, 0xEA, 0xB1,
-    0xC8, 0x40, 0x80, 0xAD, 0xE2, 0x00, 0x14, 0x0C, 0x17, 0x20, 0x72, 0x0E, 0x7C, 0x0F, 0x13, 0x63,
-    0x04, 0x7D, 0x8B, 0x08, 0xFC, 0x97, 0x88, 0x40, 0x57, 0x53, 0x00, 0xE0, 0x2F, 0x48, 0xA5, 0x14,
-    0x13, 0xBD, 0x39, 0x75, 0xDE, 0x9F, 0xA6, 0xC1, 0x46, 0x11, 0xAD, 0x95, 0xCA, 0xAB, 0x17, 0xA9,
-    0x91, 0xF3, 0x9E, 0x0A, 0xEB, 0x6D, 0x33, 0x98, 0xED, 0x78, 0x1E, 0x45, 0x87, 0x43, 0xC0, 0x86,
-    0x77, 0x5A, 0x33, 0x84, 0x3F, 0xB3, 0x9B, 0xC9, 0x45, 0x1F, 0x31, 0xDB, 0x89, 0xEE, 0xB0, 0xA3,
-    0x88, 0x78, 0x64, 0x78, 0xEA, 0xBE, 0x23, 0x9E, 0x06, 0x53, 0x04, 0x36, 0x91, 0xC0, 0xF1, 0x56,
-    0x16, 0x83, 0x72, 0x7E, 0x58, 0x28, 0x45, 0x96, 0x73, 0xC0, 0x81, 0x38, 0xA3, 0x18, 0x91, 0x8F,
-    0x43, 0xD8, 0x13, 0x56, 0x7B, 0x28, 0x5D, 0xA5, 0x1F, 0x7D, 0xF2, 0x24, 0xA7, 0xD5, 0xA3, 0xBF,
-    0x7F, 0x20, 0x0B, 0x25, 0x43, 0xCD, 0x51, 0x2B, 0xFC, 0xD0, 0x89, 0x2E, 0xA5, 0x19, 0xFE, 0x3B,
-    0x6C, 0x23, 0xA0, 0x0A, 0x5F, 0x90, 0x85, 0xF2, 0x1C, 0x49, 0x0E, 0x0B, 0x99, 0xE5, 0xCA, 0x2D,
-    0xA4, 0xAF, 0x77, 0xB4, 0x18, 0x64, 0xE4, 0x55, 0x07, 0x76, 0xF6, 0x76, 0xFC, 0x62, 0xC2, 0x1F,
-    0xF1, 0x03, 0x57, 0xB0, 0x58, 0x51, 0x6C, 0x58, 0x58, 0x55, 0xC3, 0x2E, 0x05, 0xCD, 0x44, 0x19,
-    0xA0, 0x17, 0x22, 0xCE, 0xA5, 0xD6, 0x9D, 0xA9, 0x6C, 0x30, 0x48, 0x37, 0xE8, 0x2D, 0x40, 0x26,
-    0x50, 0xAE, 0xA6, 0xA6, 0x86, 0x92, 0x68, 0x28, 0x17, 0xC6, 0xAA, 0x41, 0xFF, 0x47, 0x3E, 0x3D,
-    0x32, 0xD3, 0x1F, 0x1F, 0x21, 0x3D, 0xF7, 0x17, 0xCF, 0xE9, 0xDE, 0xE0, 0xF1, 0x7A, 0x7A, 0xEE,
-    0x59, 0x70, 0x5F, 0xE7, 0x3F, 0xF3, 0x75, 0xDE, 0x7D, 0x5D, 0xB8, 0x30, 0xEE, 0x62, 0x06, 0x5B,
-    0x36, 0x3D, 0x5C, 0x91, 0x23, 0xE6, 0x0A, 0xAF, 0xF7, 0x99, 0x1B, 0xFD, 0x47, 0xDE, 0x78, 0x72,
-    0xC2, 0xCE, 0x91, 0xBE, 0x99, 0x86, 0x92, 0xF6, 0x51, 0x34, 0xC8, 0x0B, 0x25, 0x05, 0x5E, 0x38,
-    0x29, 0x44, 0x6A, 0x00, 0x7B, 0x99, 0x9A, 0x62, 0x8B, 0xC3, 0x2B, 0x10, 0xD1, 0x14, 0xF6, 0x34,
-    0x04, 0xA1, 0xF3, 0x4F, 0xD9, 0x6B, 0x4F, 0x63, 0xAE, 0x9A, 0x6E, 0x73, 0xCF, 0x5C, 0x18, 0x7E,
-    0xC9, 0x19, 0x25, 0x83, 0x27, 0x27, 0xF5, 0xC0, 0x57, 0xEF, 0x90, 0x38, 0x1F, 0xCD, 0x51, 0x4A,
-    0xDC, 0xC2, 0x59, 0xC5, 0x8F, 0xB0, 0xD3, 0xB0, 0x83, 0x66, 0xD7, 0xF8, 0x07, 0x58, 0x44, 0x54,
-    0xEA, 0x84, 0x98, 0x03, 0xA7, 0x12, 0xCB, 0x8F, 0x2E, 0x3C, 0x2E, 0xF0, 0x11, 0x19, 0xD1, 0x8A,
-    0x2E, 0x2C, 0x2A, 0xEB, 0x02, 0xBA, 0xA8, 0x7A, 0x4A, 0x85, 0x89, 0xFC, 0xE1, 0x8B, 0xAA, 0xA1,
-    0x73, 0xD8, 0x63, 0x75, 0xFC, 0x39, 0x4A, 0x2C, 0x3B, 0xAE, 0x1C, 0x37, 0x33, 0xDC, 0x86, 0xBD,
-    0x92, 0x43, 0x90, 0x32, 0x51, 0x97, 0xF9, 0x6F, 0x79, 0xB9, 0xF9, 0x1A, 0x25, 0x5B, 0x9D, 0x60,
-    0x07, 0x34, 0x0E, 0x10, 0xF1, 0xD8, 0x3C, 0x04, 0xF9, 0xBC, 0x84, 0x04, 0x07, 0x68, 0x97, 0x1F,
-    0x51, 0x42, 0xCE, 0xD3, 0xC8, 0xE1, 0x26, 0xC5, 0xD4, 0xBA, 0x10, 0x3D, 0x0F, 0x2E, 0xD2, 0x15,
-    0xF6, 0xAD, 0x2C, 0x99, 0x0A, 0x46, 0x04, 0x7B, 0x9E, 0xD2, 0x8A, 0xC0, 0x3F, 0x9C, 0xFF, 0x31,
-    0xBB, 0xFA, 0x19, 0xD2, 0xC3, 0xD6, 0x95, 0x6D, 0x5E, 0x3F, 0xD8, 0x04, 0x34, 0xB2, 0x51, 0xF8,
-    0xE2, 0xCE, 0x97, 0x6C, 0x38, 0x94, 0x52, 0xA2, 0xD0, 0x35, 0xE1, 0x43, 0xAF, 0x9E, 0x18, 0x6E,
-    0x5A, 0xCD, 0x2D, 0xBA, 0xFD, 0x82, 0x2E, 0x34, 0x15, 0x7A, 0xD6, 0xBE, 0xB9, 0x97, 0x5A, 0x84,
-    0xF4, 0x6E, 0xFA, 0xFA, 0x1B, 0x2E, 0x4A, 0x05, 0xB8, 0xFA, 0xD8, 0xA1, 0x8D, 0x5D, 0x94, 0x6E,
-    0x3E, 0xA7, 0x8F, 0x73, 0x87, 0x14, 0x0F, 0xF4, 0x08, 0x99, 0x0B, 0xC0, 0x3C, 0x54, 0x2C, 0xCE,
-    0xD3, 0x9A, 0x77, 0x31, 0x89, 0xDE, 0x8D, 0xBD, 0x9F, 0xEA, 0xDD, 0x38, 0x67, 0x85, 0x0E, 0xBD,
-    0x04, 0xEB, 0x08, 0x73, 0x99, 0x73, 0x2C, 0x5F, 0x82, 0xA6, 0xA4, 0xAB, 0xF1, 0x4F, 0xB7, 0xB0,
-    0xE5, 0xD3, 0xE8, 0x13, 0xF3, 0x64, 0x85, 0x80, 0x1E, 0xEA, 0x5E, 0x45, 0x79, 0x5C, 0x4A, 0x59,
-    0x1E, 0x96, 0xBF, 0x1E, 0xD3, 0x6A, 0x1E, 0xF6, 0x31, 0xEA, 0xF3, 0x37, 0x9E, 0x73, 0xC5, 0x23,
-    0x88, 0xA0, 0x26, 0x2E, 0x91, 0x3F, 0xC9, 0xFA, 0xF5, 0xEE, 0x30, 0xF1, 0xAB, 0x6B, 0xAF, 0xC4,
-    0xE7, 0xFF, 0x6F, 0xA7, 0x43, 0xE8, 0x09, 0xEF, 0x15, 0xC7, 0x9B, 0xBC, 0xF7, 0x8F, 0x16, 0x3C,
-    0xC2, 0x7B, 0xED, 0x68, 0x7F, 0x98, 0x34, 0x3C, 0xF5, 0x69, 0x4B, 0xC9, 0x8D, 0x86, 0xE0, 0xBA,
-    0x5E, 0xF3, 0x6D, 0xA9, 0x3D, 0x86, 0x9B, 0x41, 0xFC, 0x37, 0xAB, 0xB6, 0x38, 0x68, 0xF2, 0x53,
-    0x76, 0x26, 0xED, 0x1C, 0x10, 0x41, 0x0E, 0x10, 0x0B, 0xDE, 0x0C, 0x90, 0x12, 0xAC, 0xEA, 0xB7,
-    0xBF, 0x22, 0xB0, 0xDD, 0xD7, 0x89, 0x87, 0x8B, 0x4B, 0x1F, 0x59, 0xE3, 0x33, 0x4A, 0x10, 0x20,
-    0x24, 0x42, 0xF6, 0xDF, 0x90, 0xF6, 0x5D, 0xC0, 0x49, 0xBF, 0x42, 0x56, 0x3B, 0x20, 0x6B, 0x56,
-    0x69, 0x1F, 0x5E, 0xE5, 0x5F, 0x10, 0x79, 0xF9, 0x54, 0x2E, 0x03, 0xC6, 0xE3, 0x9A, 0x80, 0xBB,
-    0xC4, 0x9F, 0x1A, 0xE4, 0x99, 0xB0, 0x84, 0x32, 0xD1, 0x12, 0x54, 0x3F, 0xF8, 0x1D, 0x17, 0x2D,
-    0xFE, 0x19, 0x92, 0xB4, 0x13, 0xAC, 0x7D, 0x5C, 0x46, 0x5B, 0xB7, 0x6A, 0x5F, 0x92, 0x44, 0xCE,
-    0xB4, 0x90, 0xF7, 0x17, 0x20, 0xB7, 0x93, 0x0E, 0xF0, 0x92, 0x03, 0xCB, 0xC2, 0xC7, 0xFF, 0xAC,
-    0xC2, 0x8D, 0x9B, 0x95, 0x17, 0x94, 0xA9, 0xF0, 0x0C, 0x10, 0x62, 0x24, 0x40, 0x21, 0xD3, 0x0E,
-    0x56, 0x79, 0xAE, 0xC1, 0x17, 0x10, 0x8B, 0x14, 0x23, 0xCE, 0x74, 0x25, 0xB7, 0x96, 0xCF, 0x69,
-    0x97, 0x07, 0x5E, 0x2D, 0xE1, 0x06, 0x07, 0x38, 0x06, 0x03, 0xE0, 0xA6, 0x27, 0x05, 0x99, 0xC1,
-    0x25, 0x2F, 0x43, 0x55, 0x89, 0x1B, 0xA1, 0x6F, 0xE3, 0x6B, 0xAE, 0x32, 0xEB, 0x54, 0x85, 0xE2,
-    0x2C, 0xAC, 0x8C, 0xD4, 0x67, 0x7A, 0x28, 0xD1, 0xD6, 0x67, 0xA5, 0x4A, 0x1B, 0x51, 0xC5, 0x14,
-    0x2E, 0xD7, 0xB9, 0xBC, 0x66, 0xB7, 0x8F, 0xEA, 0x25, 0x4D, 0x5C, 0x75, 0x76, 0x49, 0x6A, 0x5F,
-    0x3E, 0x2B, 0xF9, 0x83, 0x45, 0x49, 0xD5, 0x8A, 0x9A, 0x71, 0xF6, 0x52, 0xAE, 0xCB, 0xCF, 0x64,
-    0x6B, 0xE7, 0xD1, 0xB9, 0xF3, 0xDB, 0x63, 0x03, 0xEA, 0x91, 0xDC, 0xAE, 0x30, 0x73, 0x4B, 0x8E,
-    0x80, 0x6F, 0x8B, 0xD8, 0x5E, 0x10, 0x2A, 0xAA, 0x5F, 0x2A, 0x70, 0x1F, 0xED, 0xA8, 0xAC, 0x9C,
-    0xD8, 0xC4, 0xD1, 0x26, 0xE9, 0xCB, 0x18, 0x3C, 0x48, 0xA5, 0x77, 0x24, 0x0B, 0x04, 0xA8, 0x7A,
-    0x84, 0xCB, 0x2D, 0x59, 0xAD, 0x0F, 0x7B, 0xF2, 0xAD, 0xDC, 0xDF, 0xCA, 0xF5, 0x17, 0xF8, 0x56,
-    0xA0, 0x95, 0xD9, 0xB2, 0x93, 0x51, 0x02, 0x60, 0xCD, 0x65, 0x14, 0x37, 0x70, 0x5F, 0x5E, 0x68,
-    0xEB, 0xE4, 0xAD, 0x63, 0x56, 0x76, 0x13, 0xF6, 0xB0, 0x8E, 0xB9, 0x69, 0x5D, 0xAA, 0x7D, 0xB1,
-    0xAD, 0x4C, 0x0B, 0x14, 0xA5, 0x04, 0x38, 0x9D, 0x41, 0x5C, 0xD2, 0x75, 0xF7, 0x5A, 0xF8, 0xB5,
-    0x0D, 0x9A, 0x00, 0x37, 0x7D, 0x8D, 0x82, 0x51, 0x15, 0xC8, 0x26, 0xA8, 0xA0, 0x99, 0x16, 0x81,
-    0x0D, 0xD5, 0x90, 0xBF, 0xA7, 0xA8, 0x15, 0x7F, 0xA6, 0xC9, 0xA5, 0xDB, 0xD9, 0x64, 0xB8, 0x78,
-    0x81, 0xDA, 0x3F, 0xA3, 0x8A, 0x7D, 0x34, 0x08, 0xE1, 0xC2, 0xA2, 0x08, 0x75, 0xB2, 0xA5, 0x3C,
-    0x17, 0x4A, 0x4D, 0x3B, 0xD4, 0xB8, 0x81, 0x4D, 0xD9, 0x24, 0xD9, 0xE8, 0xF5, 0xC3, 0x7E, 0xD6,
-    0x09, 0xF3, 0x46, 0x73, 0xFD, 0x7C, 0xB8, 0xF7, 0xE2, 0xAC, 0xE0, 0x12, 0x66, 0xAB, 0x87, 0x07,
-    0xEC, 0x93, 0x41, 0x87, 0x41, 0xBC, 0x26, 0x03, 0xA1, 0x7F, 0x76, 0x97, 0xFC, 0x12, 0x37, 0xD7,
-    0xD7, 0x86, 0x67, 0xB7, 0x1C, 0xDA, 0x26, 0x2D, 0xF2, 0x66, 0x19, 0x14, 0xBB, 0xA1, 0x17, 0x0E,
-    0x2F, 0x0D, 0x00, 0x4F, 0xAA, 0x4E, 0x5A, 0x6D, 0x77, 0xC7, 0xE1, 0x67, 0x51, 0x75, 0x60, 0xFF,
-    0x81, 0xFD, 0xB8, 0x01, 0x15, 0xBB, 0xDC, 0x47, 0xF6, 0xE5, 0x76, 0xFE, 0x3F, 0xED, 0x53, 0xBD,
-    0x6E, 0x14, 0x31, 0x10, 0x9E, 0xF5, 0x42, 0x56, 0xC2, 0x85, 0xA9, 0x69, 0xAE, 0x45, 0xD7, 0xF8,
-    0x09, 0x72, 0x5E, 0x71, 0xC5, 0x15, 0x57, 0x24, 0x05, 0x11, 0x65, 0xDA, 0x13, 0x0D, 0x6D, 0x8A,
-    0x04, 0xAF, 0x68, 0x52, 0x50, 0x10, 0x09, 0x1E, 0x20, 0xF5, 0xE5, 0x15, 0xB2, 0xD9, 0x25, 0x94,
-    0x29, 0xB0, 0x38, 0x21, 0x24, 0x9A, 0x2C, 0x20, 0x21, 0x21, 0x1A, 0x93, 0x73, 0x82, 0x2F, 0xF1,
-    0x7A, 0x98, 0x8D, 0x08, 0xA4, 0x41, 0x42, 0xA2, 0x65, 0x6C, 0x8D, 0x46, 0xF3, 0xF3, 0x79, 0xE6,
-    0x9B, 0x5D, 0x16, 0x41, 0x21, 0xC3, 0x28, 0x4E, 0x82, 0x1E, 0x9D, 0x06, 0xF1, 0xCE, 0xAA, 0xF5,
-    0xBA, 0xD5, 0x43, 0x17, 0xE5, 0x21, 0x62, 0x8A, 0x36, 0x45, 0x20, 0xB9, 0x5B, 0x6E, 0x42, 0x79,
-    0x25, 0x13, 0xB8, 0x53, 0x00, 0x82, 0x08, 0xA0, 0x6D, 0x7A, 0x5C, 0x0F, 0x54, 0x62, 0x83, 0x18,
-    0xDA, 0x0A, 0xCF, 0x11, 0xCF, 0xA6, 0x31, 0x4F, 0x2D, 0x88, 0xBA, 0x3F, 0x4D, 0xD1, 0x69, 0x1C,
-    0xD5, 0xB0, 0x05, 0x1C, 0x8D, 0xC6, 0x82, 0x05, 0x72, 0x43, 0x38, 0xD5, 0xAF, 0x29, 0xE0, 0x3B,
-    0xD4, 0x47, 0x46, 0x60, 0x8E, 0x5F, 0xB8, 0x05, 0x05, 0xD0, 0x62, 0x86, 0xD8, 0x33, 0xAD, 0x4E,
-    0x5D, 0x10, 0xB3, 0x45, 0x95, 0xA2, 0x67, 0x98, 0x53, 0x56, 0x7F, 0xBA, 0x8B, 0x38, 0x43, 0xB2,
-    0x03, 0xF0, 0x86, 0x52, 0x99, 0xEF, 0x80, 0x0E, 0x20, 0x75, 0x20, 0x6B, 0x68, 0x81, 0xEA, 0x59,
-    0x04, 0x8D, 0xC3, 0x45, 0x25, 0xEA, 0x20, 0xB7, 0x1B, 0x85, 0x50, 0x79, 0x7E, 0xE1, 0x55, 0x7A,
-    0xEA, 0xF9, 0xCC, 0x69, 0x8E, 0x9E, 0x63, 0x41, 0x50, 0xAC, 0xA5, 0xB4, 0x34, 0xC6, 0x5E, 0x1D,
-    0x34, 0xA3, 0x69, 0x67, 0x11, 0x47, 0xB1, 0x4D, 0x86, 0x96, 0x80, 0x1E, 0xB4, 0x19, 0x9A, 0xDE,
-    0xA2, 0xEB, 0x8B, 0xED, 0x80, 0x83, 0xE5, 0x64, 0xFD, 0x05, 0xE2, 0xC3, 0xF3, 0x62, 0x19, 0x44,
-    0xCE, 0x0C, 0xAC, 0xAD, 0x29, 0x7C, 0x3F, 0xDD, 0x05, 0xE2, 0xEB, 0x18, 0x1D, 0xC0, 0x74, 0xAA,
-    0xF1, 0xED, 0xDA, 0x6A, 0xB2, 0xBA, 0x25, 0x5E, 0x3A, 0x99, 0xDA, 0x41, 0xDA, 0x2C, 0xA7, 0x86,
-    0xB4, 0x4C, 0xAC, 0x28, 0xF6, 0x59, 0x73, 0x3F, 0x33, 0x32, 0x71, 0x64, 0xF2, 0x7A, 0x33, 0xEB,
-    0xEE, 0xBE, 0xA8, 0x29, 0xB1, 0xD9, 0xA7, 0x17, 0xF8, 0x33, 0x5F, 0xE1, 0x57, 0xAB, 0xCB, 0xF4,
-    0xC2, 0xA8, 0xDF, 0x6A, 0xC2, 0x76, 0xD9, 0xDF, 0x2D, 0x04, 0xFA, 0xA0, 0x6A, 0x6D, 0xAB, 0x20,
-    0x35, 0x13, 0x35, 0x31, 0x1E, 0x88, 0x98, 0x5F, 0xC6, 0x52, 0x64, 0x18, 0x14, 0x1A, 0x13, 0x41,
-    0x34, 0x09, 0x79, 0x0A, 0xD1, 0x64, 0x3E, 0xE9, 0xA0, 0xE7, 0x88, 0x0A, 0xED, 0x52, 0x04, 0x44,
-    0x76, 0x1E, 0x13, 0x0A, 0x66, 0xCD, 0x2D, 0x04, 0xE5, 0x60, 0xCF, 0x43, 0xB7, 0xB9, 0x57, 0x9F,
-    0x51, 0xA0, 0x93, 0x97, 0xD4, 0xFF, 0x5F, 0xF4, 0xBF, 0x2D, 0x7A, 0x89, 0xA6, 0x6E, 0x6F, 0x12,
-    0x4D, 0x8A, 0xE3, 0x7C, 0xA1, 0x55, 0x3A, 0xB7, 0x9A, 0xD8, 0xAF, 0x56, 0x92, 0x98, 0x2B, 0xBC,
-    0xE7, 0xA5, 0xA8, 0xB7, 0x14, 0xBA, 0x38, 0x7D, 0x6E, 0x69, 0xE2, 0x1B, 0x02, 0x6D, 0x16, 0xF3,
-    0xCB, 0xD8, 0x13, 0xAF, 0x56, 0x6A, 0xA5, 0x20, 0x04, 0xAA, 0x11, 0x47, 0x4D, 0x29, 0xB0, 0xC9,
-    0x5A, 0x78, 0xCC, 0x5C, 0x4B, 0x33, 0x85, 0x04, 0x0D, 0x31, 0x21, 0x3C, 0x54, 0x2E, 0x9B, 0x5B,
-    0x95, 0x7E, 0x73, 0x99, 0xE1, 0x11, 0x2A, 0x4C, 0x72, 0x0D, 0x50, 0xF6, 0xF7, 0x1C, 0x31, 0xD9,
-    0x10, 0x7C, 0x10, 0x68, 0xB8, 0x87, 0x09, 0x70, 0x03, 0xE5, 0xA5, 0xAA, 0xC6, 0xD8, 0x56, 0xE3,
-    0x8B, 0x46, 0x5D, 0xFF, 0xF6, 0xBE, 0xD7, 0x72, 0x02, 0xCC, 0x75, 0x09, 0x32, 0x87, 0x92, 0x7D,
-    0x74, 0x6A, 0x3C, 0x73, 0x52, 0xE7, 0x15, 0xED, 0xC6, 0xF1, 0x4F, 0x56, 0x8E, 0x6C, 0xC9, 0x3F,
-    0x38, 0x6E, 0x26, 0xE5, 0x35, 0xD9, 0xDC, 0xA8, 0x46, 0x5E, 0x22, 0xE2, 0x53, 0x57, 0x6D, 0x9F,
-    0x38, 0xEA, 0xAC, 0x24, 0x5A, 0x64, 0xEE, 0xF9, 0x91, 0x19, 0xB0, 0x93, 0x8E, 0x93, 0xCE, 0xD1,
-    0x03, 0xCF, 0xEB, 0x8D, 0x3F, 0x3D, 0xBC, 0x71, 0xC0, 0x10, 0xB9, 0x3B, 0x90, 0x39, 0x55, 0x53,
-    0xCD, 0x91, 0x51, 0xF2, 0x0D, 0xFD, 0x1E, 0x87, 0x67, 0xFE, 0x67, 0x3B, 0x5D, 0x67, 0x90, 0x45,
-    0x41, 0x23, 0xDD, 0x8E, 0xD0, 0x0B, 0x50, 0x19, 0xE6, 0x77, 0x06, 0x0A, 0xC7, 0x31, 0xCF, 0x72,
-    0x5E, 0xF4, 0xDA, 0x2A, 0xF6, 0x0A, 0x71, 0x75, 0x6A, 0x11, 0x59, 0xFB, 0x03, 0x85, 0x57, 0x31,
-    0x6C, 0x16, 0xC9, 0x15, 0x7E, 0xFF, 0xEE, 0xE1, 0x95, 0xB2, 0x91, 0x86, 0x82, 0x48, 0xC9, 0x91,
-    0xDC, 0xB6, 0x48, 0x11, 0x6C, 0x9B, 0x02, 0x79, 0x17, 0x5C, 0x50, 0xB8, 0x80, 0x48, 0xF8, 0xAE,
-    0x70, 0x61, 0xA5, 0x8B, 0x2E, 0x51, 0xDC, 0xA4, 0x24, 0x37, 0x0B, 0x2E, 0x4E, 0xA9, 0x0E, 0x29,
-    0xE2, 0xAE, 0xB8, 0x22, 0x14, 0x29, 0xC8, 0x4F, 0xE1, 0x86, 0x82, 0x82, 0x78, 0xD6, 0x67, 0x29,
-    0x14, 0x34, 0x8B, 0xD1, 0xE5, 0x0A, 0x0A, 0x2F, 0x06, 0xEB, 0x90, 0x29, 0xBC, 0x70, 0x0B, 0xDE,
-    0x33, 0x33, 0xF3, 0xF2, 0xBD, 0xF9, 0x6D, 0x03, 0x89, 0x2E, 0x59, 0x6B, 0xC6, 0xBB, 0x6F, 0x66,
-    0xDE, 0xBC, 0x79, 0xEF, 0x7B, 0xDF, 0x9B, 0x9F, 0x08, 0x4F, 0xEE, 0x4B, 0x2A, 0xB8, 0x45, 0xEB,
-    0x29, 0xFF, 0xFE, 0xF7, 0xA4, 0x7A, 0xA2, 0xD8, 0x12, 0x8D, 0x78, 0x6A, 0x7C, 0x43, 0x5F, 0x61,
-    0xCE, 0x5A, 0xC3, 0x77, 0x6D, 0xCE, 0x1D, 0xA7, 0x3D, 0x15, 0xAF, 0x1C, 0x25, 0xCC, 0x5C, 0x69,
-    0xE6, 0x36, 0x62, 0x1E, 0x28, 0xF2, 0x50, 0x62, 0x4A, 0x28, 0xDA, 0xBA, 0x40, 0x29, 0x5B, 0x82,
-    0x14, 0x02, 0xAE, 0x29, 0x3C, 0xA3, 0x47, 0x1D, 0xD1, 0xC9, 0x53, 0x18, 0x0E, 0x7B, 0x70, 0xAD,
-    0xB0, 0x28, 0x66, 0x67, 0x4A, 0xF3, 0x6C, 0xF6, 0xAA, 0x1A, 0xBA, 0x5B, 0x11, 0x2B, 0x45, 0xC5,
-    0xA3, 0xAE, 0x8B, 0xDD, 0xA9, 0x0F, 0xA8, 0x58, 0x5F, 0x6F, 0x63, 0x77, 0xFA, 0x24, 0x15, 0x8F,
-    0xD7, 0xEA, 0x88, 0x2F, 0x9D, 0xA6, 0x8C, 0x3F, 0xAD, 0x88, 0xFB, 0xDB, 0x50, 0xFE, 0xD7, 0x2F,
-    0x45, 0x45, 0x07, 0xED, 0x2C, 0xDB, 0xB4, 0x74, 0xF2, 0x0F, 0x25, 0xC5, 0x6B, 0x0D, 0xD1, 0x89,
-    0x13, 0x93, 0xED, 0xE8, 0x38, 0xA4, 0xCC, 0x36, 0xC6, 0x2E, 0x8A, 0x3F, 0xEF, 0xF2, 0x81, 0x8E,
-    0x16, 0x2D, 0x91, 0x86, 0x39, 0x06, 0x8D, 0x2F, 0x5F, 0xBF, 0xC3, 0x67, 0x77, 0x2D, 0x9F, 0xE5,
-    0x01, 0xED, 0x09, 0x5F, 0x61, 0x32, 0x57, 0x1C, 0x99, 0xAF, 0x1C, 0xE9, 0x75, 0x47, 0xC5, 0x0B,
-    0x87, 0x0D, 0xFD, 0x2D, 0x58, 0xD9, 0x43, 0x47, 0x4F, 0x1A, 0xFA, 0xE8, 0x82, 0x9C, 0xD9, 0xBE,
-    0xD3, 0xE0, 0xA1, 0x77, 0x9A, 0x9B, 0xBB, 0x08, 0xF9, 0x70, 0xD8, 0xF6, 0xE5, 0xC7, 0xDD, 0x45,
-    0x58, 0xEB, 0x42, 0x93, 0xF7, 0xB7, 0xD7, 0x84, 0x27, 0xE3, 0xAB, 0x18, 0xEC, 0x47, 0x38, 0x56,
-    0xCC, 0x5F, 0xE2, 0xE8, 0x6F, 0xC6, 0x7F, 0xE7, 0xC7, 0x38, 0x0A, 0x87, 0x26, 0xDF, 0xF3, 0x6E,
-    0xEE, 0x9D, 0xEF, 0x74, 0xC0, 0x72, 0x78, 0xD7, 0x6C, 0x8F, 0x6F, 0x40, 0x66, 0x0F, 0x9A, 0xA8,
-    0xBD, 0x10, 0x94, 0x4F, 0x36, 0xF9, 0x24, 0xF4, 0x79, 0x49, 0x3E, 0xE5, 0xF3, 0xDC, 0x15, 0x1B,
-    0x98, 0x84, 0x17, 0x79, 0xBE, 0xE3, 0xAF, 0xD9, 0x2D, 0x58, 0x6E, 0x32, 0x3B, 0x62, 0x0D, 0x0B,
-    0xA8, 0xD8, 0x18, 0x88, 0x2B, 0xB5, 0xEB, 0xA9, 0x68, 0x62, 0x87, 0xB7, 0x9E, 0x58, 0xB7, 0x89,
-    0x93, 0x81, 0x98, 0x4B, 0x0C, 0x8C, 0x38, 0x0C, 0x70, 0x18, 0xD0, 0x61, 0x20, 0x0F, 0x03, 0xCA,
-    0x60, 0x80, 0xD2, 0x46, 0x76, 0x8B, 0x3B, 0xE9, 0xA3, 0x9E, 0x0E, 0x1F, 0x35, 0x8C, 0xA0, 0x80,
-    0x56, 0x88, 0x9B, 0xBC, 0x2A, 0x86, 0xB4, 0x55, 0x1C, 0x0D, 0xF1, 0xEB, 0x7A, 0x85, 0xDC, 0x90,
-    0x5F, 0x36, 0x66, 0x79, 0x40, 0x54, 0x79, 0x7E, 0xCF, 0x73, 0x65, 0xA7, 0xB3, 0xCB, 0x7A, 0xE1,
-    0x61, 0x2F, 0x82, 0x45, 0xB4, 0xC6, 0xAA, 0x8D, 0xAA, 0x88, 0x5E, 0xB7, 0xAA, 0xD6, 0x43, 0xDC,
-    0x29, 0x4F, 0x36, 0xE2, 0xAA, 0x20, 0x0D, 0x81, 0x1A, 0xC8, 0xF8, 0x0A, 0x1B, 0x0A, 0x2E, 0x48,
-    0x85, 0xBE, 0x10, 0x68, 0x10, 0x97, 0xC0, 0x20, 0x0C, 0xE2, 0xF2, 0x82, 0xEA, 0x63, 0x97, 0xD6,
-    0x45, 0xA3, 0xFA, 0x02, 0x9F, 0x7A, 0xD5, 0xC6, 0x2E, 0xE1, 0x5C, 0x1C, 0xB0, 0x1B, 0xDC, 0xF0,
-    0x19, 0x7B, 0x89, 0x37, 0x50, 0xF3, 0x37, 0x52, 0x9D, 0x64, 0x40, 0x81, 0xD9, 0x50, 0x81, 0xD9,
-    0x48, 0x06, 0x09, 0x8A, 0xEA, 0x45, 0x8C, 0x35, 0x10, 0x03, 0xFB, 0xC0, 0xBB, 0x1E, 0xE4, 0x58,
-    0xEF, 0x61, 0x7B, 0x7C, 0x90, 0x60, 0x45, 0x7A, 0x17, 0x7A, 0x96, 0xFE, 0x6C, 0xE8, 0x4B, 0x3E,
-    0x03, 0xA8, 0x95, 0x7C, 0x8E, 0x1D, 0x7A, 0x85, 0x10, 0x9D, 0x61, 0xD5, 0x9D, 0xE0, 0x9B, 0x3E,
-    0x13, 0xA4, 0x0E, 0x38, 0x00, 0xCC, 0x55, 0x18, 0xE3, 0x36, 0xE6, 0x96, 0xCF, 0x03, 0xDE, 0x96,
-    0xCF, 0x0F, 0x94, 0x79, 0x3E, 0x17, 0xB2, 0x69, 0xC6, 0x89, 0xCA, 0xB3, 0xFC, 0xB3, 0x91, 0xC7,
-    0xAC, 0x05, 0xD1, 0x63, 0x36, 0xA0, 0xA7, 0x2C, 0x1E, 0xCA, 0x39, 0x89, 0x8E, 0x91, 0xA6, 0xA2,
-    0xCA, 0x96, 0xBA, 0xC4, 0x46, 0x43, 0x51, 0x9A, 0xBA, 0x58, 0xEA, 0x53, 0x1B, 0xF7, 0x45, 0xC5,
-    0x4D, 0x11, 0x0D, 0x6A, 0x25, 0xE9, 0xB2, 0x7A, 0xB7, 0xD5, 0x23, 0x9B, 0x69, 0xF8, 0x7D, 0xF5,
-    0x45, 0xB7, 0x32, 0xE5, 0xE1, 0xF1, 0xA7, 0xE2, 0x60, 0xFE, 0x27, 0x9B, 0xE5, 0x9D, 0xA7, 0xC9,
-    0xE3, 0x76, 0xB0, 0xA4, 0xFF, 0xA4, 0x36, 0xEA, 0x78, 0xB7, 0x71, 0x03, 0x15, 0x77, 0xD2, 0x9D,
-    0x32, 0xE6, 0x5A, 0x77, 0x94, 0x03, 0xF2, 0xE0, 0x83, 0xAA, 0xE8, 0x28, 0xEB, 0x63, 0x2F, 0x87,
-    0xCA, 0x5B, 0x78, 0x61, 0x8F, 0x92, 0x57, 0xC2, 0x05, 0xD9, 0x43, 0xF4, 0xB5, 0x5E, 0xDC, 0xFA,
-    0x90, 0xCF, 0x20, 0xB1, 0x47, 0x9C, 0xBC, 0x72, 0xEF, 0x2F, 0xD9, 0x0C, 0x11, 0x9C, 0xED, 0xF4,
-    0xE2, 0xBA, 0xCB, 0xEF, 0x3B, 0x33, 0xDB, 0x9B, 0x73, 0xAF, 0x5C, 0xBE, 0xEE, 0x82, 0xB8, 0xFF,
-    0x01, 0xB1, 0x81, 0x18, 0x4B, 0xF1, 0x46, 0xD9, 0x0B, 0x97, 0x37, 0x11, 0xCF, 0x0A, 0x0C, 0x6C,
-    0xBE, 0x2E, 0x5B, 0x98, 0x59, 0xE6, 0x27, 0x07, 0x80, 0x92, 0x00, 0x49, 0x64, 0x34, 0x7C, 0x9E,
-    0x4A, 0xC4, 0x0D, 0xFB, 0x89, 0xA4, 0x2C, 0xB0, 0xEE, 0x31, 0x22, 0xCF, 0xA6, 0x41, 0xC4, 0x5C,
-    0xCC, 0x9F, 0x73, 0xA3, 0xBB, 0xD4, 0x09, 0x8C, 0x1B, 0x53, 0x03, 0x0C, 0x56, 0x5E, 0x00, 0xD7,
-    0x20, 0xD1, 0x5D, 0x82, 0x39, 0xD7, 0x38, 0x4C, 0xC6, 0x2A, 0x8D, 0xE5, 0x5F, 0x89, 0x9E, 0xFD,
-    0x9D, 0x7E, 0x32, 0x37, 0x27, 0x3B, 0xF4, 0xF4, 0xF1, 0x78, 0x0C, 0x99, 0x19, 0x24, 0x2A, 0x8D,
-    0x20, 0x2E, 0xE2, 0x6D, 0xA4, 0x41, 0xF5, 0x5E, 0xE0, 0x16, 0x31, 0x68, 0x79, 0xEF, 0xEF, 0x07,
-    0x2C, 0xD7, 0x05, 0xD2, 0x59, 0x7C, 0x79, 0x51, 0x04, 0x82, 0xCC, 0x3A, 0xCC, 0x40, 0xBC, 0xE1,
-    0x4B, 0xA8, 0x29, 0xFC, 0x7C, 0x15, 0x73, 0x60, 0xC5, 0x01, 0x12, 0x17, 0xB2, 0x56, 0xD2, 0x0D,
-    0xF1, 0x36, 0x35, 0xA2, 0x0B, 0x08, 0x16, 0xAD, 0xEA, 0x33, 0x10, 0xA3, 0x88, 0x67, 0x11, 0x93,
-    0x07, 0x96, 0x14, 0x18, 0xF8, 0x97, 0xCC, 0x63, 0x49, 0xE0, 0x07, 0x68, 0xBD, 0xF2, 0x4C, 0xB1,
-    0x87, 0x6A, 0x81, 0x4B, 0xD1, 0x48, 0xCA, 0xCA, 0x12, 0xC4, 0x09, 0x50, 0x6F, 0x00, 0x7A, 0xAB,
-    0x40, 0x2F, 0x25, 0x40, 0xCB, 0x19, 0xDA, 0x5D, 0xB4, 0xE7, 0x81, 0x26, 0xC4, 0x92, 0xD8, 0x9F,
-    0x10, 0x70, 0x49, 0xCE, 0xC0, 0x34, 0xF1, 0x9F, 0x34, 0xFE, 0x33, 0xCE, 0xBB, 0x53, 0x27, 0x3B,
-    0x40, 0xFB, 0x5F, 0x84, 0xC9, 0x19, 0x19, 0x66, 0x5A, 0x58, 0x29, 0x96, 0x62, 0xC6, 0xAF, 0x44,
-    0x20, 0xBC, 0xAA, 0x86, 0xC3, 0x04, 0x8F, 0x42, 0x56, 0x08, 0x53, 0x4A, 0x45, 0x90, 0x24, 0x10,
-    0x0E, 0xC8, 0xAE, 0x19, 0x3F, 0x19, 0x97, 0xCC, 0x91, 0xEC, 0x92, 0x15, 0x31, 0xE8, 0x46, 0x8A,
-    0x03, 0xF8, 0x46, 0xEA, 0x84, 0x11, 0x9A, 0xA1, 0xC0, 0x38, 0x61, 0x0E, 0xC9, 0x20, 0x28, 0x4E,
-    0xD7, 0x8B, 0x4F, 0x46, 0x9E, 0xF2, 0xCE, 0x00, 0xF2, 0x95, 0x1A, 0xF4, 0x4E, 0x57, 0x34, 0xA9,
-    0x2D, 0x2A, 0xA7, 0xBA, 0xC4, 0x67, 0x75, 0xF1, 0xA9, 0x4D, 0x39, 0xED, 0xD4, 0x26, 0x2F, 0xF3,
-    0x0C, 0x00, 0x8F, 0x3D, 0x4B, 0xFE, 0xC2, 0x16, 0xB0, 0x00, 0xA8, 0x50, 0xC0, 0x4A, 0xBE, 0x13,
-    0x38, 0x30, 0xED, 0x02, 0x21, 0xC6, 0xFB, 0xD6, 0xEE, 0x5B, 0xA4, 0x27, 0x01, 0xCE, 0x27, 0xA5,
-    0x4A, 0x05, 0xCA, 0x3A, 0x9C, 0x23, 0x03, 0x83, 0xA0, 0xAB, 0x0E, 0x01, 0xCA, 0x5E, 0x32, 0x61,
-    0xE7, 0x3A, 0xF2, 0x29, 0x12, 0x74, 0xCD, 0x82, 0x79, 0xE1, 0x76, 0x07, 0x15, 0x66, 0xA7, 0x46,
-    0x74, 0x5B, 0x9C, 0x5F, 0xA8, 0xA7, 0xA7, 0x1F, 0x03, 0x5C, 0xC9, 0x15, 0xAE, 0xE2, 0xE7, 0xC0,
-    0x87, 0x87, 0x29, 0xEC, 0x4D, 0xBD, 0xC2, 0xE0, 0x9E, 0x7C, 0xC6, 0xE7, 0x33, 0x15, 0x50, 0x51,
-    0xCA, 0x5E, 0x52, 0x64, 0xE5, 0xA0, 0x47, 0xB0, 0x43, 0xC2, 0xE2, 0xDC, 0x2E, 0xF8, 0x54, 0xF1,
-    0x53, 0x0A, 0xB8, 0x10, 0x1A, 0x29, 0xBE, 0x06, 0x37, 0xBF, 0x5C, 0x70, 0x80, 0x10, 0x3F, 0x93,
-    0x68, 0x17, 0xB5, 0xEA, 0x16, 0x5E, 0x7E, 0xB4, 0x2F, 0xD8, 0xE6, 0x27, 0x45, 0xAD, 0x1B, 0x15,
-    0xAA, 0x07, 0xD6, 0x07, 0x38, 0x6D, 0x4D, 0xCE, 0x72, 0xA0, 0x3F, 0xB8, 0x78, 0xFF, 0x70, 0x07,
-    0xD4, 0x1C, 0xB1, 0x2F, 0x23, 0x09, 0x94, 0x64, 0x55, 0xC1, 0xAF, 0xAD, 0xE2, 0x4F, 0x46, 0x67,
-    0x78, 0xAD, 0x85, 0xAF, 0xA7, 0xB1, 0x7B, 0x0C, 0x35, 0xCD, 0x34, 0xAA, 0x5A, 0xBC, 0x37, 0x06,
-    0x86, 0x78, 0x17, 0xF9, 0xC1, 0x80, 0x23, 0x7F, 0xE7, 0xE3, 0x4D, 0x2E, 0xBA, 0xE9, 0xFC, 0x05,
-    0xCF, 0x6C, 0xB2, 0x72, 0xD3, 0x12, 0x9B, 0xD7, 0x1C, 0x4B, 0xB4, 0x53, 0x31, 0xF8, 0x38, 0x34,
-    0x4F, 0xD8, 0x7F, 0x5A, 0x02, 0x5C, 0x0A, 0x9A, 0x04, 0x06, 0x12, 0x58, 0x23, 0x80, 0x93, 0x53,
-    0x66, 0x82, 0x05, 0xD6, 0x15, 0x6C, 0xC4, 0x60, 0xB6, 0x29, 0xF5, 0x91, 0x79, 0x4F, 0xD8, 0xA8,
-    0xCD, 0xDB, 0xBC, 0x11, 0xE4, 0x56, 0x87, 0xA2, 0x2D, 0xBE, 0x36, 0xEF, 0x66, 0x80, 0xD7, 0x0E,
-    0xD5, 0x4E, 0x00, 0x1E, 0xFC, 0x4F, 0x8C, 0x2F, 0x29, 0x44, 0x08, 0x4B, 0x38, 0xD7, 0x22, 0x5E,
-    0x25, 0x7F, 0x85, 0xA3, 0x93, 0x3D, 0x63, 0xE9, 0x6A, 0x74, 0x70, 0xFA, 0xAC, 0xFB, 0x78, 0xBC,
-    0xEC, 0x85, 0xF0, 0xFF, 0x75, 0x93, 0xFD, 0x75, 0x5C, 0x3F, 0xE8, 0x23, 0x76, 0x73, 0x22, 0x10,
-    0xEA, 0xEA, 0x75, 0x3D, 0xA9, 0xA4, 0x80, 0x5C, 0x44, 0xBC, 0xB5, 0x58, 0xE7, 0x13, 0x87, 0x22,
-    0xCA, 0x08, 0x3D, 0x1D, 0x39, 0xAC, 0x61, 0x95, 0x00, 0x02, 0x04, 0xC7, 0x0E, 0x8D, 0xA5, 0x55,
-    0xFC, 0xB8, 0xBD, 0xAA, 0xDB, 0x21, 0x38, 0x4E, 0x0D, 0xAA, 0x42, 0xE6, 0xB5, 0x48, 0xB7, 0x81,
-    0x34, 0x1C, 0x98, 0xF5, 0x13, 0x01, 0x12, 0x08, 0xD9, 0x8B, 0x19, 0xA9, 0x83, 0x0E, 0x7E, 0xD0,
-    0x1E, 0xCD, 0xBD, 0x97, 0x4B, 0x0A, 0x8B, 0xB9, 0x35, 0x14, 0x5D, 0x9D, 0x54, 0x6B, 0x71, 0xDA,
-    0x91, 0x40, 0xE9, 0x00, 0xAC, 0x1D, 0x21, 0xDD, 0x40, 0xE9, 0x14, 0x59, 0xA0, 0x52, 0xDC, 0x6B,
-    0x25, 0xEC, 0x56, 0x52, 0xD9, 0x1E, 0x77, 0x0B, 0xEE, 0x62, 0x62, 0x71, 0x09, 0xF8, 0xBF, 0x1D,
-    0xF0, 0x68, 0x13, 0x7F, 0x2C, 0xC1, 0x86, 0x0E, 0x25, 0x42, 0x3A, 0xD4, 0x18, 0x09, 0xCF, 0x9B,
-    0xDC, 0xFD, 0x3E, 0x64, 0x6E, 0x27, 0xC8, 0x1B, 0xD0, 0x3D, 0x13, 0x07, 0x57, 0x53, 0x13, 0xF7,
-    0x85, 0x3B, 0x21, 0x84, 0x92, 0x2E, 0x26, 0x64, 0x68, 0x28, 0x76, 0x46, 0x48, 0x20, 0x09, 0xF7,
-    0x8D, 0x4C, 0x5E, 0x49, 0x77, 0xBF, 0x3D, 0x95, 0x2E, 0x89, 0x8D, 0xD6, 0xFC, 0xDC, 0x4E, 0xAB,
-    0x7C, 0xCD, 0xAB, 0x99, 0x8D, 0x56, 0x3F, 0x68, 0x82, 0x37, 0xB1, 0x68, 0x45, 0x00, 0x7A, 0x4A,
-    0x7D, 0x51, 0x53, 0xBA, 0xD4, 0xC0, 0xE1, 0xE5, 0xD1, 0x63, 0xA1, 0x9C, 0xFE, 0x07, 0x33, 0xED,
-    0x3F, 0xC9, 0x81, 0x40, 0x66, 0xBC, 0x7F, 0x93, 0xC7, 0x15, 0xBD, 0xCD, 0x3B, 0x42, 0x55, 0xFF,
-    0x5B, 0x20, 0x97, 0x45, 0x2C, 0x5D, 0x9D, 0xE7, 0xB9, 0x50, 0x18, 0x52, 0xA9, 0xB5, 0xBC, 0xC6,
-    0xE1, 0xFA, 0x08, 0xAB, 0x7B, 0xFA, 0x90, 0xEB, 0x58, 0xA8, 0x10, 0x67, 0xCB, 0x27, 0xE9, 0x37,
-    0xB9, 0x26, 0xD6, 0x81, 0xA3, 0x05, 0xBA, 0x09, 0x94, 0xA6, 0x72, 0x01, 0xB0, 0x21, 0xA3, 0x26,
-    0x6D, 0x0A, 0x7B, 0x19, 0x0C, 0x7B, 0xE0, 0x1D, 0x68, 0x75, 0x23, 0xB4, 0x45, 0x9A, 0x91, 0x8B,
-    0x19, 0x4E, 0x29, 0x8C, 0x07, 0xA5, 0xFC, 0x2D, 0x1A, 0x98, 0xCE, 0xC7, 0x36, 0x72, 0xB8, 0x45,
-    0xE0, 0x4F, 0x0D, 0x58, 0x27, 0xBE, 0x90, 0xEA, 0x81, 0xEA, 0xDA, 0x4B, 0xA4, 0xF7, 0x9F, 0x34,
-    0x10, 0xCF, 0xB4, 0x96, 0xFE, 0x8F, 0x4A, 0x7C, 0x7D, 0x4B, 0xF0, 0x46, 0xFF, 0x50, 0x12, 0x02,
-    0x71, 0x01, 0x6A, 0x42, 0x48, 0x11, 0x25, 0x7D, 0x3F, 0x5A, 0xDE, 0x1E, 0xDF, 0x84, 0xE9, 0x18,
-    0xBD, 0x43, 0x6A, 0xB5, 0xAE, 0x4E, 0x93, 0xBA, 0xB7, 0xDB, 0x9E, 0x96, 0x52, 0xE3, 0x20, 0x19,
-    0x34, 0x4A, 0xB7, 0x6A, 0x7F, 0xFA, 0xA3, 0x0A, 0xC8, 0x13, 0xA5, 0xAF, 0x83, 0x63, 0x7F, 0xC3,
-    0xDB, 0x77, 0x42, 0xF0, 0xE4, 0x2B, 0x0F, 0xFD, 0x14, 0xBF, 0xE1, 0x3C, 0xD5, 0xBE, 0xE1, 0xC2,
-    0xFF, 0xEE, 0x25, 0x49, 0x70, 0xE4, 0x70, 0xBD, 0x12, 0xFA, 0x90, 0xA8, 0x4A, 0xB1, 0x5B, 0x7E,
-    0xC5, 0x2D, 0xB0, 0xDE, 0xE5, 0xE0, 0x67, 0xB9, 0x40, 0x09, 0x4B, 0xA5, 0x83, 0x46, 0x9F, 0x58,
-    0x5D, 0xA9, 0x2E, 0xB6, 0x66, 0xBF, 0x17, 0xEF, 0xFD, 0x50, 0x9F, 0x80, 0x3B, 0x46, 0x1C, 0xC8,
-    0x9B, 0x3B, 0x20, 0x02, 0x38, 0x1D, 0xF1, 0x2A, 0x52, 0xA4, 0xD3, 0x75, 0x62, 0x33, 0x54, 0x5B,
-    0x41, 0xEF, 0x32, 0xB6, 0xBC, 0x87, 0xB6, 0x29, 0x37, 0x43, 0xC3, 0x7B, 0x65, 0x28, 0x25, 0x48,
-    0xE1, 0x48, 0x10, 0x26, 0x97, 0x80, 0x5C, 0x2A, 0xD1, 0x5B, 0x39, 0x2D, 0xCF, 0xAF, 0xA5, 0x00,
-    0x5C, 0xBA, 0x2D, 0x67, 0x5E, 0x09, 0xC7, 0x1F, 0xC2, 0x11, 0x10, 0x3C, 0x2F, 0x35, 0x7F, 0x27,
-    0xC7, 0x05, 0xE6, 0x9B, 0x7B, 0x9F, 0xF5, 0xC5, 0xF3, 0x17, 0xE0, 0xB5, 0xFE, 0xD2, 0x6D, 0x7D,
-    0xD7, 0x65, 0xA7, 0xD4, 0x4B, 0x4E, 0xEE, 0x2D, 0x39, 0xBD, 0xFA, 0xA8, 0xE1, 0xF3, 0x21, 0x09,
-    0x04, 0xFE, 0x24, 0xE6, 0x4E, 0x7C, 0x11, 0x28, 0x86, 0xF2, 0x3E, 0xA0, 0x75, 0x7B, 0x7C, 0x5D,
-    0x42, 0xE3, 0x82, 0x57, 0x4A, 0xE9, 0x9A, 0xD1, 0xFD, 0x86, 0x3E, 0xF8, 0x05, 0x7E, 0x05, 0x35,
-    0xC9, 0xA4, 0x28, 0x25, 0x42, 0x37, 0xC0, 0xBA, 0x55, 0x56, 0xD7, 0xFA, 0x2E, 0x7E, 0x48, 0xE8,
-    0xDA, 0xDC, 0xF5, 0x66, 0xD0, 0xEC, 0x31, 0xD6, 0x86, 0xB1, 0xD4, 0xE9, 0xBA, 0xF8, 0xD6, 0xC6,
-    0x3E, 0xFC, 0x4B, 0xBC, 0x7E, 0xC6, 0xDF, 0x20, 0x2F, 0x27, 0x53, 0x4A, 0x28, 0x0B, 0x3A, 0xEF,
-    0x37, 0x13, 0xDC, 0x84, 0x5F, 0x2A, 0xB5, 0xD4, 0x06, 0x37, 0x2F, 0x29, 0x00, 0x00, 0xA7, 0x21,
-    0x7D, 0x43, 0x0E, 0xEC, 0x7F, 0xE9, 0x16, 0xC1, 0xBA, 0x76, 0x3B, 0x0B, 0x3F, 0xDD, 0x86, 0x00,
-    0xD1, 0x80, 0xBC, 0xA9, 0xF1, 0xF8, 0x86, 0x09, 0x0E, 0x0D, 0x7E, 0xFA, 0x37, 0xDB, 0xFF, 0xFF,
-    0xFF, 0xB7, 0xFF, 0xFF, 0xFF, 0xBF, 0x06, 0xE2, 0xD6, 0xD0, 0xD0, 0x10, 0x00, 0x35, 0x8B, 0xB1,
-    0x0D, 0xC2, 0x50, 0x0C, 0x44, 0x4F, 0x08, 0xC9, 0x05, 0x85, 0x47, 0xC9, 0x08, 0x64, 0x23, 0x46,
-    0x20, 0x15, 0x8C, 0x45, 0x46, 0x70, 0x97, 0x96, 0x36, 0x1D, 0x45, 0x8A, 0xDF, 0xC0, 0x71, 0xFF,
-    0xA2, 0x58, 0xB2, 0x9F, 0x9F, 0x7C, 0x06, 0x8E, 0x2A, 0xCF, 0xDC, 0x41, 0x23, 0x77, 0xD0, 0xC8,
-    0xF5, 0xD6, 0xB1, 0x39, 0x92, 0xB3, 0xC1, 0xC7, 0x7B, 0x28, 0xC5, 0x38, 0xDF, 0x4B, 0x31, 0x9E,
-    0x58, 0x92, 0x4D, 0x7F, 0x92, 0xF1, 0xC5, 0x45, 0x72, 0x21, 0x9F, 0xE4, 0x44, 0xB6, 0xE0, 0x2F,
-    0xB4, 0x05, 0xDB, 0xC0, 0x06, 0xAD, 0x12, 0xA3, 0x01, 0xF1, 0x0D, 0x09, 0xE2, 0x93, 0x12, 0x44,
-    0x5D, 0xA7, 0x8E, 0xA5, 0x0B, 0x7C, 0x11, 0x2C, 0x08, 0x0B, 0xCE, 0xEA, 0x3F,
+static const uint8_t notosans_14_boldBitmaps[30406] = {
+    0xC5, 0x9A, 0x3F, 0xAC, 0x25, 0xC7, 0x95, 0xDE, 0x7F, 0xDD, 0xC5, 0x37, 0x0D, 0xA8, 0x01, 0x97,
+    0x82, 0x19, 0x03, 0x26, 0x0D, 0xB4, 0x43, 0x83, 0xC0, 0xAA, 0x63, 0x27, 0x5B, 0x4D, 0x12, 0x86,
+    0x02, 0x05, 0x7C, 0x01, 0x1F, 0x04, 0x98, 0x01, 0xE3, 0x95, 0xE1, 0x9D, 0xD4, 0x81, 0x57, 0xD5,
+    0x24, 0x03, 0x05, 0x0C, 0xC8, 0x40, 0xDA, 0x0D, 0x1C, 0xC8, 0x86, 0x65, 0x5B, 0x7A, 0x0B, 0x83,
+    0x0E, 0x36, 0x10, 0x0C, 0x71, 0xAA, 0x86, 0x13, 0x4C, 0xA0, 0x80, 0x2D, 0x0D, 0xD6, 0x0C, 0x26,
+    0x98, 0x96, 0x48, 0x2E, 0xB1, 0x54, 0x30, 0x4D, 0xB1, 0xC9, 0xD7, 0x33, 0x53, 0x55, 0x9F, 0x83,
+    0xBE, 0x6F, 0x38, 0x14, 0xFF, 0xAE, 0x48, 0x53, 0xF7, 0xDE, 0xBA, 0x5D, 0xD5, 0x55, 0xF7, 0xDC,
+    0xAA, 0xAE, 0x53, 0xE7, 0x7C, 0xE7, 0xAB, 0xF2, 0xAF, 0x17, 0x77, 0x23, 0xBB, 0x1B, 0xD9, 0xDD,
+    0x48, 0xEE, 0x5A, 0x72, 0xD7, 0x52, 0xFF, 0x6A, 0x02, 0x8E, 0x4C, 0xF6, 0x6F, 0x17, 0x17, 0x8F,
+    0xF7, 0x9B, 0xEE, 0x5A, 0x72, 0xCF, 0x1D, 0x3E, 0xFD, 0xE3, 0xDB, 0xC3, 0x8F, 0xFD, 0x04, 0x33,
+    0xFF, 0x39, 0x74, 0x57, 0x37, 0xB8, 0xD2, 0x4E, 0xD4, 0xAB, 0x1B, 0xB0, 0x31, 0x81, 0x33, 0x4B,
+    0x25, 0x49, 0x8D, 0xA4, 0xD4, 0x49, 0x5A, 0x48, 0x36, 0x62, 0x16, 0xB7, 0x37, 0xFF, 0x9E, 0x5E,
+    0xBE, 0xFB, 0xEC, 0xFD, 0x06, 0xF8, 0x6F, 0x2F, 0x90, 0xBA, 0x48, 0x33, 0x5F, 0x81, 0xFE, 0xB9,
+    0x15, 0xF2, 0x79, 0x73, 0x00, 0xFE, 0x0C, 0xF8, 0x3B, 0xB8, 0xAC, 0x97, 0xAC, 0xB4, 0x48, 0xBA,
+    0xAE, 0xBB, 0xB9, 0xFF, 0xED, 0xF4, 0xCD, 0xF0, 0xC2, 0x50, 0xEB, 0x7F, 0x61, 0xB4, 0xD2, 0x28,
+    0x63, 0xA4, 0xA1, 0x0A, 0x1A, 0x08, 0xA2, 0x7E, 0x3D, 0xD3, 0x3E, 0x79, 0xF7, 0xA5, 0x3F, 0x73,
+    0x37, 0x8B, 0xD4, 0x4B, 0x6B, 0x90, 0x86, 0x87, 0xF5, 0x12, 0xFC, 0x1D, 0xD4, 0x13, 0x5C, 0xE0,
+    0xFC, 0xD5, 0xAF, 0x98, 0x15, 0xAB, 0x89, 0x40, 0x25, 0x61, 0x27, 0xDC, 0xB5, 0xB5, 0x4E, 0x98,
+    0xD5, 0x8D, 0x0E, 0xDC, 0xE3, 0xC9, 0xCE, 0x98, 0xB5, 0xBF, 0x9A, 0xC0, 0x3D, 0xBE, 0xB9, 0x11,
+    0xB3, 0xBA, 0x1F, 0x2C, 0x7F, 0x39, 0xF4, 0xD7, 0xD6, 0xEC, 0x4A, 0x25, 0xF5, 0xBF, 0xD4, 0xDA,
+    0xEA, 0xC6, 0x5A, 0xFA, 0xD8, 0xCD, 0xA1, 0x8B, 0x09, 0xEC, 0xD5, 0x64, 0x27, 0xCC, 0xD6, 0xC5,
+    0x0C, 0xBE, 0x4A, 0x76, 0xC2, 0xCE, 0x5D, 0xCC, 0x54, 0x89, 0xDC, 0x45, 0xDC, 0x60, 0xEF, 0x25,
+    0xDA, 0x05, 0x27, 0xC8, 0x54, 0x9A, 0x00, 0x18, 0x0E, 0x9D, 0xEA, 0x34, 0x40, 0xAF, 0x0D, 0x3A,
+    0x69, 0xC0, 0xDE, 0xF1, 0x0B, 0x26, 0x99, 0x04, 0xAA, 0x04, 0x6E, 0xD2, 0x40, 0x93, 0x15, 0x41,
+    0x8A, 0xD0, 0x69, 0x84, 0x5E, 0xB1, 0x4D, 0xBD, 0x92, 0xC9, 0x36, 0xEB, 0xAA, 0xDA, 0x64, 0x93,
+    0x9E, 0x17, 0x52, 0x54, 0xB4, 0x9A, 0xFB, 0x15, 0x2D, 0x8D, 0xFE, 0x5A, 0x19, 0x49, 0x9A, 0xAC,
+    0x74, 0x3B, 0xE3, 0x35, 0x6A, 0xE2, 0x22, 0xE0, 0x5E, 0x7B, 0x2F, 0x15, 0xF7, 0xE2, 0x6F, 0xD7,
+    0xBF, 0xE0, 0x0A, 0x01, 0x37, 0xF6, 0xD1, 0xCE, 0xED, 0x62, 0x12, 0x05, 0x3F, 0xF4, 0xB1, 0x5D,
+    0x4C, 0x42, 0xB8, 0x68, 0x97, 0x3A, 0x11, 0xE8, 0x26, 0xB3, 0x21, 0xFA, 0xC9, 0x6C, 0x04, 0xEC,
+    0x5C, 0x65, 0x1E, 0x1E, 0xFA, 0xD1, 0xAC, 0x04, 0xEC, 0x5C, 0x27, 0xFC, 0x60, 0x17, 0x93, 0x08,
+    0x43, 0x37, 0x99, 0x8D, 0x82, 0x1B, 0xED, 0x6C, 0xB6, 0x5D, 0xDA, 0x64, 0x17, 0x93, 0xAA, 0x8C,
+    0x70, 0xA3, 0x8B, 0xDD, 0xF4, 0x8D, 0x97, 0xF6, 0x71, 0xBB, 0x11, 0x0A, 0xD4, 0x2B, 0xB4, 0x13,
+    0x57, 0xBA, 0xA7, 0xDF, 0x90, 0xF4, 0xA2, 0xA4, 0x23, 0x7F, 0xE7, 0x18, 0x2D, 0xD8, 0xDB, 0x33,
+    0xA1, 0x9B, 0x4C, 0x72, 0xB1, 0x99, 0xFE, 0x23, 0x15, 0xC0, 0xD1, 0x00, 0x0E, 0x48, 0x60, 0x16,
+    0xB0, 0x11, 0x1C, 0xAD, 0x24, 0x2F, 0x65, 0x49, 0xEB, 0x89, 0x3F, 0x19, 0x3E, 0x5A, 0x0B, 0x1B,
+    0x1C, 0x1D, 0xBB, 0x49, 0x66, 0xEB, 0xA6, 0x60, 0x36, 0x1B, 0x1F, 0x3D, 0x7D, 0x52, 0x37, 0xB4,
+    0x2A, 0xDF, 0x57, 0x7D, 0x10, 0x75, 0xC6, 0x24, 0x9A, 0x8D, 0x76, 0xC5, 0x2E, 0x74, 0x33, 0x2E,
+    0xE2, 0x22, 0x61, 0x40, 0x54, 0xE5, 0xB3, 0xEA, 0x0F, 0xAF, 0x5A, 0x13, 0x5E, 0x8B, 0x91, 0xE6,
+    0xFE, 0x8E, 0x26, 0x0D, 0xFA, 0x41, 0xAA, 0xD4, 0xCF, 0x26, 0x69, 0xB4, 0x67, 0x19, 0x77, 0x7B,
+    0x45, 0x61, 0x32, 0x45, 0x83, 0xBD, 0x97, 0x71, 0xB7, 0x37, 0x74, 0x79, 0x36, 0xD9, 0xC7, 0x6E,
+    0xD1, 0x10, 0x5E, 0xD5, 0xD3, 0xD9, 0x48, 0x4B, 0x23, 0x61, 0x34, 0xC3, 0x31, 0x60, 0x12, 0x5D,
+    0xC2, 0xA7, 0x5A, 0xC9, 0x2A, 0xB9, 0xB3, 0xD4, 0x5D, 0x4F, 0xDF, 0x68, 0x12, 0x5F, 0xF0, 0x03,
+    0x5C, 0xD0, 0x5C, 0x49, 0x6B, 0x27, 0x2D, 0xFE, 0xAE, 0x96, 0x57, 0x08, 0x71, 0xA8, 0x04, 0x4D,
+    0x82, 0x7E, 0x01, 0x8D, 0xB4, 0x09, 0xC2, 0x44, 0x9B, 0xC1, 0x4F, 0x34, 0x1F, 0xBD, 0xE8, 0xF4,
+    0x34, 0x48, 0x45, 0xD2, 0x3D, 0x49, 0x33, 0xC0, 0x23, 0x9A, 0x9B, 0x5D, 0xE4, 0xEA, 0xFE, 0x41,
+    0xF3, 0xBF, 0x42, 0x91, 0x4A, 0xD0, 0x6E, 0xE0, 0xE2, 0xD1, 0xD3, 0x99, 0x5E, 0x23, 0xA1, 0x0C,
+    0xB5, 0x14, 0xA9, 0x15, 0xA9, 0x34, 0x60, 0x32, 0xD8, 0xF7, 0x21, 0xDC, 0xFA, 0xE1, 0x23, 0x72,
+    0xD2, 0x2A, 0xE9, 0xB1, 0xA0, 0x99, 0x6A, 0x00, 0xE8, 0x67, 0xE8, 0x36, 0xB0, 0x05, 0x5A, 0x8D,
+    0x34, 0x9A, 0x31, 0xDA, 0xA8, 0x4B, 0xA1, 0x4A, 0x61, 0xA4, 0xF4, 0x33, 0xA1, 0xDD, 0xF0, 0x75,
+    0xC1, 0x8D, 0x61, 0xEC, 0x63, 0x3F, 0x77, 0x77, 0x5F, 0x2E, 0x2F, 0x48, 0xFA, 0xBD, 0xA4, 0xF4,
+    0xBD, 0xD3, 0x70, 0x77, 0xEF, 0x44, 0x5D, 0x80, 0x30, 0x42, 0x3F, 0xD3, 0x49, 0xD1, 0x4B, 0xB5,
+    0x94, 0x5A, 0x69, 0xE9, 0x27, 0xD0, 0x80, 0x49, 0x60, 0x97, 0x63, 0x9C, 0x32, 0x52, 0x31, 0x52,
+    0xAE, 0x7F, 0xE4, 0x0F, 0x8F, 0xC4, 0x9D, 0xB7, 0x19, 0xE8, 0x7F, 0x7F, 0xE7, 0xBB, 0x7A, 0x41,
+    0x4A, 0xBD, 0x14, 0x7B, 0xAD, 0xFB, 0xAC, 0x00, 0xF4, 0xA2, 0x55, 0x46, 0x5A, 0xAD, 0x7E, 0x34,
+    0xFA, 0x69, 0x1F, 0xDF, 0x02, 0xFE, 0xB1, 0x1F, 0xD6, 0x29, 0x64, 0x7B, 0x4F, 0xD9, 0x49, 0x49,
+    0x73, 0x7F, 0x56, 0x70, 0xB7, 0x57, 0x42, 0x98, 0xEA, 0x12, 0xC6, 0xF6, 0x8E, 0x06, 0x77, 0x43,
+    0xDF, 0x95, 0x91, 0xB6, 0x46, 0x1A, 0x6B, 0xAD, 0x70, 0x11, 0x9C, 0x54, 0x1E, 0x48, 0x19, 0x4C,
+    0xDA, 0xC7, 0x63, 0x97, 0xFD, 0xF9, 0xB8, 0x09, 0x42, 0x04, 0x0D, 0x54, 0x02, 0x53, 0xF6, 0x69,
+    0xB4, 0x1B, 0x74, 0xCB, 0x87, 0x7D, 0x3F, 0x34, 0xA9, 0xB5, 0xF7, 0xF4, 0x82, 0x66, 0x82, 0xD6,
+    0x56, 0x5A, 0xDD, 0xEC, 0xDF, 0x15, 0xFE, 0x7A, 0x42, 0x76, 0x69, 0xB7, 0x7E, 0x0D, 0x93, 0x53,
+    0xA6, 0xD7, 0x44, 0xD0, 0x60, 0xA5, 0x51, 0xBF, 0xD6, 0x0B, 0xA9, 0x96, 0x9B, 0xEA, 0x22, 0x9A,
+    0x7B, 0x99, 0xFE, 0x77, 0xB9, 0xD6, 0x93, 0xBB, 0x85, 0x8F, 0xED, 0x83, 0x4F, 0xE0, 0xF2, 0x1D,
+    0x6A, 0x69, 0x6C, 0xA5, 0xB9, 0x2B, 0x61, 0xED, 0x97, 0x36, 0xB9, 0xC9, 0x24, 0x17, 0x4D, 0x76,
+    0xD1, 0x14, 0x37, 0x99, 0xE2, 0x96, 0xB6, 0x74, 0x25, 0x14, 0x2B, 0x15, 0xA3, 0x0F, 0x32, 0x7F,
+    0xF9, 0x5C, 0xDA, 0x87, 0xD5, 0x6C, 0xD0, 0x2D, 0xD5, 0x91, 0xE6, 0x56, 0x8A, 0xAD, 0x0A, 0xED,
+    0x87, 0x3A, 0xEF, 0xDF, 0x2E, 0x6E, 0xFA, 0xC9, 0x7D, 0xC3, 0xFD, 0xC0, 0x3A, 0xED, 0xAF, 0xEA,
+    0x07, 0xC5, 0xAE, 0xDF, 0xB8, 0xBF, 0xE8, 0x00, 0x2E, 0x0D, 0x7A, 0x22, 0xD9, 0xD9, 0x3F, 0x9E,
+    0xEC, 0x7C, 0xEE, 0x4C, 0xAA, 0x09, 0xFC, 0x40, 0x97, 0x69, 0x34, 0x57, 0xDA, 0xF0, 0x99, 0x4E,
+    0x03, 0x9A, 0xA8, 0x35, 0x53, 0xE9, 0x0E, 0x5C, 0xD6, 0x40, 0xAB, 0x99, 0x5A, 0x7B, 0x63, 0xFE,
+    0x05, 0xC0, 0xF7, 0x4E, 0x4F, 0xFF, 0x9B, 0xA4, 0x5B, 0x92, 0xFE, 0xDD, 0xE9, 0xE9, 0x4F, 0x0F,
+    0xF2, 0xEC, 0x03, 0x56, 0xE6, 0x7C, 0xBD, 0x8F, 0x60, 0x67, 0x70, 0x1B, 0xF8, 0x83, 0xD6, 0xD6,
+    0x9A, 0x21, 0x6C, 0xD0, 0xAF, 0x5C, 0xD0, 0x54, 0xE9, 0x0E, 0xA1, 0xE0, 0x35, 0x18, 0x4D, 0xD8,
+    0x19, 0xFE, 0xF5, 0x03, 0xFD, 0xBE, 0xAC, 0xC1, 0x4B, 0x8D, 0xB4, 0xB9, 0xFF, 0xA1, 0xAB, 0x83,
+    0xC9, 0xE0, 0x26, 0x4C, 0x02, 0x45, 0xDC, 0x42, 0x97, 0x30, 0x82, 0x30, 0x62, 0x17, 0x28, 0xF7,
+    0x7F, 0x57, 0x0D, 0x20, 0xE8, 0x36, 0x2A, 0x0D, 0xD8, 0x05, 0x2E, 0x02, 0x5C, 0x2E, 0x23, 0x34,
+    0x52, 0x02, 0xA7, 0x97, 0x35, 0xA0, 0x11, 0x3F, 0x99, 0x04, 0xED, 0xD2, 0x2E, 0x47, 0x3F, 0xAB,
+    0x53, 0x17, 0x9D, 0xE6, 0xD4, 0x3F, 0x2B, 0xCD, 0xAF, 0x38, 0x93, 0xDB, 0xF9, 0xFB, 0xBE, 0x59,
+    0xDA, 0xD9, 0x7F, 0xBF, 0x9D, 0xDB, 0xD9, 0x5F, 0xB1, 0x93, 0xDD, 0xBF, 0xA7, 0xEF, 0x5F, 0xB1,
+    0xB3, 0x9D, 0xF2, 0xF7, 0xDB, 0xA5, 0xFF, 0x4D, 0xF2, 0x46, 0xD2, 0xEA, 0x1E, 0xD3, 0xAA, 0xB9,
+    0x8F, 0x8F, 0x8E, 0x8F, 0x0E, 0x76, 0x86, 0x5D, 0xF5, 0x2E, 0x52, 0xEB, 0xAD, 0xA7, 0x37, 0xF0,
+    0xD2, 0x06, 0x17, 0xA4, 0x09, 0x38, 0x3A, 0x06, 0x8C, 0x22, 0xA0, 0x15, 0x08, 0x05, 0x70, 0x8A,
+    0x60, 0xEF, 0xAD, 0xD0, 0xDE, 0x29, 0x60, 0xB2, 0x8B, 0x54, 0xB2, 0x2B, 0x84, 0x67, 0x05, 0x6E,
+    0x72, 0x91, 0x6E, 0xB1, 0x2B, 0x6D, 0xAA, 0x85, 0xD1, 0xA9, 0x62, 0x25, 0x69, 0x23, 0x48, 0xC2,
+    0x49, 0x8A, 0xDD, 0x8A, 0xDD, 0x6C, 0xC2, 0xC8, 0x14, 0xF0, 0xBF, 0xD2, 0x80, 0xDD, 0x14, 0x31,
+    0xC2, 0xEB, 0x1F, 0x09, 0xD2, 0x1C, 0xA4, 0x2D, 0xBC, 0x13, 0x52, 0x88, 0x6D, 0x0E, 0xD1, 0x1C,
+    0x52, 0x9B, 0xC2, 0xDF, 0x87, 0x35, 0x48, 0x63, 0x90, 0x5E, 0x0A, 0xD2, 0x76, 0xA8, 0x57, 0x88,
+    0xB5, 0xF6, 0x6B, 0x53, 0xC2, 0x3B, 0x21, 0x07, 0x29, 0xED, 0x72, 0x0E, 0xCF, 0xBB, 0x0A, 0x65,
+    0x68, 0xF6, 0x95, 0x9A, 0x1B, 0xBD, 0x23, 0xA3, 0xB1, 0x7A, 0x4C, 0x23, 0x28, 0x82, 0x9B, 0xC1,
+    0xAE, 0xD0, 0x64, 0xA8, 0x04, 0xF8, 0x09, 0xBA, 0x75, 0x5F, 0x9A, 0x28, 0x42, 0xBF, 0x82, 0xD1,
+    0xC0, 0x10, 0xCA, 0xD3, 0x8B, 0x95, 0x12, 0x41, 0xE2, 0x82, 0x34, 0x50, 0x1D, 0xE3, 0xF5, 0x8F,
+    0xB4, 0x52, 0x26, 0x48, 0x5B, 0x2B, 0x69, 0x0E, 0xB1, 0xD5, 0x77, 0x12, 0x5D, 0x0A, 0x91, 0x70,
+    0x33, 0xD1, 0x94, 0x10, 0x71, 0xBF, 0x4B, 0x18, 0x85, 0x88, 0xBB, 0x97, 0x30, 0xE7, 0x77, 0x9A,
+    0x1C, 0x22, 0xE1, 0x97, 0x7B, 0xE3, 0x56, 0xDF, 0x29, 0x2F, 0xEF, 0xC3, 0x3F, 0x08, 0xBC, 0x03,
+    0x5E, 0xFA, 0xB1, 0xF4, 0xB6, 0x74, 0x47, 0xCA, 0x3E, 0xD2, 0x2D, 0x34, 0x89, 0x4A, 0xE0, 0xDF,
+    0x39, 0xED, 0xA4, 0xEB, 0xD2, 0xBB, 0x52, 0xFA, 0x68, 0x4D, 0xA4, 0xBB, 0x7B, 0xFA, 0x37, 0xD2,
+    0x1D, 0xA9, 0x78, 0x69, 0xF4, 0xD2, 0x33, 0x9F, 0x22, 0x24, 0xF2, 0x80, 0x10, 0xE9, 0xA3, 0x35,
+    0x0F, 0x16, 0xEE, 0xDB, 0xCC, 0x37, 0xE9, 0xA5, 0xD9, 0x4A, 0xC9, 0xE8, 0x6E, 0x88, 0x5A, 0xB9,
+    0xD8, 0x25, 0x76, 0x53, 0xE5, 0x16, 0x30, 0x19, 0xF0, 0xD3, 0xC3, 0xA7, 0xFF, 0x33, 0x57, 0x92,
+    0x9F, 0x3A, 0xBD, 0x97, 0x2B, 0xC9, 0xCD, 0xF4, 0xEF, 0x89, 0x5A, 0xFD, 0x4A, 0xBF, 0x68, 0xAA,
+    0xD5, 0xEA, 0xAD, 0xB0, 0x38, 0x49, 0x04, 0x69, 0xA9, 0x82, 0xDE, 0x84, 0x4B, 0xE0, 0x23, 0xFD,
+    0xDB, 0x89, 0xBA, 0x7C, 0x56, 0xE6, 0x9D, 0xD3, 0xF0, 0xB6, 0xF6, 0xD1, 0x69, 0xCF, 0x7C, 0x91,
+    0x5F, 0x45, 0xFA, 0xD9, 0x69, 0x95, 0x6E, 0x48, 0x8F, 0x69, 0xAE, 0x45, 0x9B, 0xE8, 0x17, 0x42,
+    0xFC, 0xD4, 0xAC, 0xCD, 0x46, 0x7A, 0x52, 0xD9, 0x69, 0xA5, 0x5B, 0xF0, 0xB1, 0x12, 0x4D, 0xFA,
+    0xA7, 0x66, 0x43, 0x34, 0xE5, 0x1B, 0x61, 0x75, 0x8A, 0x4A, 0x46, 0x23, 0xE0, 0x23, 0xE1, 0x7A,
+    0xA2, 0x5F, 0x7D, 0x6C, 0x72, 0x93, 0x2A, 0x8D, 0x3E, 0xBA, 0xA5, 0x49, 0x36, 0xE1, 0x5F, 0xD5,
+    0xD0, 0x24, 0x3F, 0xE3, 0x5F, 0xDB, 0x68, 0x24, 0xF0, 0xDA, 0x68, 0xA4, 0x09, 0x7F, 0x4F, 0x34,
+    0xB9, 0xDB, 0xF0, 0x31, 0x4C, 0x4D, 0x32, 0xC2, 0xC7, 0x6E, 0x6B, 0x12, 0x8A, 0x3E, 0x1A, 0x35,
+    0xBB, 0x40, 0x14, 0x7D, 0xDC, 0x21, 0xC1, 0x1F, 0x73, 0x29, 0xA7, 0x3F, 0x0B, 0xD2, 0x4D, 0x29,
+    0x07, 0x69, 0xF2, 0x1B, 0xB8, 0x3B, 0x5A, 0xA8, 0x75, 0xA6, 0x09, 0xAB, 0x5B, 0x1A, 0x71, 0xF2,
+    0xA2, 0x56, 0x2E, 0x19, 0x7B, 0xFB, 0xEC, 0x6C, 0xC3, 0xF9, 0x5B, 0x37, 0x97, 0x3A, 0xC9, 0x3F,
+    0x13, 0xED, 0x1B, 0xB9, 0xB8, 0xD1, 0x3D, 0x79, 0xB6, 0xA9, 0x4E, 0xEE, 0xD6, 0x6F, 0x92, 0x9D,
+    0xE5, 0x9F, 0x5F, 0xDD, 0x13, 0xB9, 0xD8, 0x77, 0x93, 0x3D, 0xDB, 0xFA, 0xD7, 0x66, 0x77, 0x6B,
+    0xF6, 0x61, 0x90, 0x1F, 0x95, 0x4C, 0x2E, 0xB5, 0x66, 0x7B, 0xB6, 0x35, 0x1A, 0xDC, 0xAD, 0xD9,
+    0x26, 0xE4, 0xC7, 0x7E, 0x36, 0xC9, 0xAF, 0xD4, 0xC9, 0x27, 0x4C, 0xF2, 0x05, 0x93, 0xBC, 0x30,
+    0xC9, 0x6B, 0x34, 0xC9, 0x6B, 0x32, 0xC9, 0xFB, 0xC5, 0x24, 0xFF, 0xCC, 0x6A, 0x92, 0xFF, 0x4E,
+    0x32, 0xC9, 0x3F, 0x5F, 0x4C, 0xF2, 0xCF, 0xC9, 0x24, 0x3F, 0xEA, 0x5A, 0xF2, 0xA3, 0xBF, 0x91,
+    0xFC, 0xE8, 0xDE, 0x4B, 0x7E, 0xEC, 0x3E, 0x48, 0x7E, 0x6C, 0x95, 0xFC, 0x68, 0x94, 0xFC, 0x58,
+    0x2B, 0xF9, 0x11, 0x25, 0x3F, 0xE2, 0x93, 0x1F, 0x71, 0xE9, 0x1C, 0xFA, 0x15, 0x68, 0xA5, 0x8D,
+    0x56, 0x52, 0x6C, 0xF5, 0x8E, 0x36, 0xA3, 0xA1, 0x51, 0xAD, 0x11, 0x3F, 0x2B, 0x62, 0x93, 0x9B,
+    0xA9, 0xD5, 0xAD, 0xE0, 0x5F, 0xCF, 0xD0, 0xBD, 0xAF, 0x81, 0x26, 0xFB, 0x89, 0x4A, 0xCF, 0xAC,
+    0xE0, 0x6F, 0x14, 0xE8, 0x17, 0x45, 0x6C, 0xEA, 0x57, 0x9A, 0x62, 0x34, 0x34, 0x22, 0x94, 0xCB,
+    0x1A, 0xAD, 0xA4, 0x48, 0x90, 0x46, 0x2E, 0xA8, 0x0C, 0x50, 0x1D, 0x83, 0xD7, 0x9B, 0xB5, 0x94,
+    0x5B, 0xA9, 0xF4, 0x52, 0x0A, 0xB1, 0xBF, 0x2B, 0xDC, 0xBD, 0x44, 0xB8, 0xBD, 0xD4, 0x0A, 0xD1,
+    0xDE, 0x55, 0xA5, 0x9B, 0x92, 0x7A, 0x69, 0x09, 0x2A, 0xB5, 0x4E, 0x87, 0xF6, 0x00, 0x70, 0x42,
+    0xA4, 0x16, 0x3C, 0x50, 0xE4, 0x6B, 0x1F, 0x87, 0x46, 0xA8, 0xFC, 0xCA, 0x6E, 0x1E, 0xC1, 0x2F,
+    0x40, 0x2B, 0x80, 0xB0, 0x78, 0xFD, 0x64, 0xEF, 0x46, 0x90, 0x96, 0xB6, 0xBC, 0xAC, 0x21, 0xC4,
+    0x2E, 0xB5, 0x89, 0x10, 0x43, 0x6C, 0xCF, 0x33, 0x76, 0x6B, 0xF3, 0xD3, 0x22, 0x48, 0x53, 0x2B,
+    0xCD, 0x04, 0x15, 0xDA, 0xD4, 0xAD, 0x87, 0x56, 0xA6, 0x10, 0x62, 0xBF, 0xB6, 0x09, 0xC5, 0x10,
+    0x9B, 0xD2, 0x26, 0xDC, 0x12, 0x22, 0x8A, 0x00, 0xAD, 0xE6, 0x56, 0xFA, 0x8D, 0x94, 0xDD, 0xDD,
+    0x70, 0x3D, 0x73, 0xD1, 0x47, 0x9A, 0x04, 0x6E, 0xC1, 0x68, 0xC6, 0x6A, 0xC6, 0x69, 0xC2, 0x6B,
+    0xC4, 0x67, 0x08, 0x33, 0xB5, 0xA0, 0xBB, 0x4B, 0xAD, 0xF0, 0x23, 0xDD, 0xDC, 0xDD, 0x44, 0x2D,
+    0x0D, 0x5C, 0x04, 0x2F, 0xA9, 0x93, 0xF4, 0xBA, 0xA4, 0xF7, 0x25, 0x25, 0xEC, 0x76, 0xEE, 0x04,
+    0xC6, 0x83, 0x9B, 0xF8, 0xE3, 0x6E, 0xF8, 0x91, 0xFE, 0xE6, 0x03, 0x46, 0xFF, 0x9F, 0x98, 0xF1,
+    0x11, 0xF7, 0x76, 0xA6, 0xC9, 0x6E, 0x41, 0xAF, 0xEA, 0xAD, 0xB0, 0xD9, 0x83, 0x37, 0x8D, 0x78,
+    0x4D, 0x70, 0x04, 0x61, 0xA0, 0xBD, 0x2B, 0x70, 0x6F, 0x24, 0x90, 0xDD, 0x68, 0x53, 0xBF, 0xEC,
+    0xFE, 0x58, 0x68, 0x68, 0x53, 0x2D, 0xDC, 0x64, 0x12, 0xC2, 0xAE, 0x4D, 0xA2, 0x9F, 0xDD, 0x84,
+    0x8B, 0x02, 0x7D, 0x3B, 0x51, 0x95, 0x7E, 0xC2, 0x24, 0x81, 0x3D, 0x4B, 0xD0, 0x69, 0x02, 0x27,
+    0x40, 0x1B, 0x7B, 0xB4, 0x6B, 0xC4, 0x1E, 0x45, 0xA1, 0x7E, 0xC6, 0xCF, 0xF8, 0xEB, 0x89, 0x3E,
+    0xD1, 0xCF, 0xC2, 0x0A, 0xBB, 0xBA, 0xC9, 0x68, 0x32, 0xA9, 0xDD, 0x2A, 0x6D, 0x95, 0x2A, 0x11,
+    0x02, 0x61, 0x74, 0xD1, 0xBD, 0x1C, 0xDD, 0x64, 0x57, 0xFB, 0xFA, 0x6A, 0x97, 0xBA, 0x34, 0x6B,
+    0x69, 0x12, 0xFE, 0xD5, 0xE4, 0x5E, 0x2D, 0xD8, 0x45, 0xED, 0xA2, 0xC1, 0x24, 0xF7, 0x6C, 0x76,
+    0x91, 0xF0, 0xCC, 0xE4, 0x5E, 0x5C, 0xE8, 0x7E, 0xB7, 0xD8, 0xB3, 0x0D, 0xA3, 0xAD, 0x2E, 0x19,
+    0x94, 0xF1, 0x82, 0x5E, 0x58, 0x45, 0x1A, 0x45, 0xA3, 0x19, 0x34, 0x13, 0x56, 0x70, 0x2B, 0x5D,
+    0x02, 0x37, 0xD3, 0x6D, 0xFD, 0x8A, 0x5B, 0x6C, 0xC2, 0x4F, 0x4D, 0x46, 0xB1, 0x56, 0x2D, 0xD0,
+    0xF3, 0x05, 0xFC, 0xAD, 0x04, 0x4E, 0x2B, 0x58, 0xCD, 0xD0, 0x28, 0x82, 0xD1, 0x08, 0x76, 0x8F,
+    0xC6, 0xE7, 0x43, 0x6D, 0xF8, 0x65, 0xA2, 0xD2, 0x13, 0x05, 0xA3, 0x4A, 0x43, 0x9B, 0x50, 0xEC,
+    0x36, 0xDC, 0xEC, 0x16, 0xFA, 0x35, 0x4C, 0xD8, 0x14, 0x22, 0xFD, 0xBB, 0x1A, 0xD1, 0xF3, 0xA2,
+    0x4D, 0x26, 0xE3, 0xA6, 0x36, 0xD5, 0xC2, 0xAE, 0x76, 0xA5, 0x5F, 0x42, 0xC4, 0xDD, 0xC8, 0x10,
+    0x6E, 0x2F, 0x20, 0x41, 0xA5, 0xED, 0x80, 0xA1, 0x9A, 0xC2, 0x8E, 0x32, 0x70, 0x13, 0xA0, 0xE1,
+    0xE0, 0x26, 0x3F, 0x7E, 0xCB, 0x49, 0xB2, 0x92, 0xAE, 0x69, 0x27, 0x50, 0x36, 0xB0, 0x69, 0x5F,
+    0xE7, 0xA6, 0xEC, 0x13, 0x51, 0x0B, 0x2A, 0x0D, 0xBB, 0x92, 0x85, 0xB8, 0x23, 0x16, 0x37, 0xEF,
+    0xDE, 0xB7, 0x5B, 0x77, 0xA5, 0xB3, 0xE5, 0xF4, 0xF4, 0x07, 0x92, 0xDE, 0xD5, 0xEE, 0xD8, 0x85,
+    0x24, 0x49, 0x51, 0x26, 0xD9, 0xC5, 0x7D, 0xFA, 0xE5, 0x7D, 0x2F, 0x95, 0xD3, 0xFF, 0x12, 0x06,
+    0xFC, 0x88, 0x8B, 0xF4, 0x13, 0x76, 0xC1, 0x2E, 0x34, 0x1B, 0x26, 0x51, 0x67, 0xAA, 0x02, 0xBB,
+    0x3E, 0xB8, 0xCF, 0x68, 0x81, 0x2B, 0xBE, 0xF8, 0x52, 0x15, 0xBE, 0xC0, 0xFB, 0x52, 0xF1, 0xC5,
+    0x97, 0x47, 0x7F, 0x46, 0x13, 0xC1, 0x6C, 0x80, 0x80, 0xB0, 0x80, 0xCB, 0xD0, 0xFF, 0x38, 0x62,
+    0xAF, 0xAD, 0xB4, 0xB3, 0xC7, 0x2C, 0x76, 0xAA, 0x52, 0x95, 0xC8, 0xB8, 0xC1, 0xD3, 0x2C, 0x6E,
+    0x24, 0x7F, 0x63, 0xE4, 0xE1, 0xF1, 0xD2, 0xC9, 0xC9, 0x13, 0x52, 0x7A, 0xF4, 0xF4, 0x74, 0x3C,
+    0x19, 0xBA, 0x0D, 0x0D, 0x76, 0x25, 0x1C, 0x42, 0xD3, 0x56, 0x1B, 0x52, 0xAA, 0xA5, 0x64, 0x5E,
+    0xFA, 0x30, 0x40, 0x7C, 0x44, 0xD9, 0x4A, 0xAB, 0x4A, 0xB8, 0x99, 0x91, 0x5F, 0x4C, 0xD6, 0xD8,
+    0x7D, 0xA0, 0xC7, 0xF4, 0xBA, 0xA4, 0x27, 0x95, 0x73, 0xAB, 0xE7, 0xD7, 0xEA, 0x10, 0xA9, 0x68,
+    0xFC, 0x94, 0xF4, 0x42, 0x41, 0x41, 0x51, 0xD2, 0xA2, 0xF7, 0xFD, 0xAA, 0x68, 0x37, 0xC5, 0x36,
+    0x69, 0x6C, 0x93, 0xC6, 0xE6, 0x90, 0xDA, 0xA4, 0xD8, 0x26, 0x45, 0xBB, 0xE9, 0x7D, 0xBF, 0x4A,
+    0x5A, 0xE4, 0x15, 0x8B, 0x2D, 0x9C, 0x87, 0x63, 0x8D, 0x56, 0x23, 0x45, 0x69, 0xEB, 0xF3, 0xD3,
+    0x46, 0xE0, 0xA7, 0x3F, 0x70, 0xCD, 0xCD, 0xAE, 0xED, 0x46, 0x7F, 0xFF, 0x0B, 0x2B, 0x45, 0xAF,
+    0x44, 0x28, 0x87, 0xD0, 0x81, 0x5D, 0x7F, 0x3E, 0x9E, 0x2A, 0xDD, 0xC8, 0xAD, 0xCE, 0x72, 0x27,
+    0x65, 0x77, 0xE7, 0x72, 0x76, 0x73, 0x9B, 0xFD, 0x7D, 0x58, 0xFD, 0x61, 0xF2, 0xD1, 0x64, 0x37,
+    0x37, 0xD9, 0xDD, 0xB9, 0x9C, 0x3B, 0x29, 0xB7, 0xFA, 0x20, 0xD7, 0xFA, 0x55, 0xE6, 0xA1, 0x83,
+    0xF8, 0x90, 0x31, 0x52, 0xB4, 0xD2, 0xD2, 0xAF, 0xDD, 0xEA, 0xA6, 0x26, 0xF9, 0x68, 0xD2, 0x01,
+    0x6E, 0xEF, 0x29, 0xEE, 0x58, 0xD1, 0xCD, 0xD0, 0x6F, 0xFC, 0x6F, 0x2B, 0x2D, 0x46, 0x5A, 0x08,
+    0x9A, 0xF6, 0x61, 0x1E, 0x63, 0x35, 0x59, 0x2D, 0xAD, 0x92, 0xD1, 0x11, 0x1A, 0x70, 0x13, 0xBD,
+    0x16, 0xAF, 0xD4, 0x49, 0x95, 0x7F, 0x6B, 0xB0, 0x2B, 0x26, 0x73, 0xA8, 0xF9, 0xF4, 0x02, 0x40,
+    0xA5, 0x5F, 0xE5, 0x56, 0x77, 0xBF, 0xF8, 0xD0, 0xB6, 0xEE, 0x30, 0xB4, 0x7B, 0xB9, 0xD6, 0x8D,
+    0xCC, 0x43, 0x26, 0x43, 0x93, 0xBE, 0x89, 0x4D, 0xFD, 0x7F, 0x0F, 0x5B, 0x2F, 0x2D, 0xBD, 0x14,
+    0x2F, 0xE8, 0x0E, 0xEC, 0x0B, 0xCE, 0x6E, 0xFB, 0x68, 0x34, 0x7E, 0x58, 0xFC, 0xB5, 0x26, 0x79,
+    0xBD, 0x21, 0xE9, 0x96, 0xFE, 0x46, 0x61, 0x35, 0x87, 0xF0, 0xB7, 0xD7, 0x46, 0xD0, 0xBC, 0x47,
+    0xD4, 0x9F, 0x5C, 0x8C, 0xD4, 0xD9, 0xBD, 0x51, 0xBA, 0x08, 0xA6, 0xB8, 0x37, 0x3E, 0xE9, 0x33,
+    0x03, 0xFD, 0x64, 0x37, 0x53, 0xF0, 0xE7, 0xD3, 0xAA, 0xD1, 0xCD, 0x76, 0x33, 0xE5, 0x73, 0x32,
+    0xFF, 0x37, 0x7C, 0xA0, 0x14, 0x72, 0xB7, 0x71, 0x4E, 0xC7, 0xFC, 0x21, 0x95, 0x72, 0x7E, 0xA3,
+    0x5F, 0xC3, 0xD8, 0xAF, 0xFD, 0xDC, 0xAD, 0xED, 0xD6, 0x6D, 0x75, 0xE9, 0x36, 0xC2, 0x8B, 0x1B,
+    0xFD, 0xED, 0x44, 0x2B, 0x51, 0xEF, 0xBE, 0x38, 0xD3, 0xAF, 0x8A, 0xED, 0x66, 0xB7, 0xBA, 0x54,
+    0x1A, 0xC2, 0xD8, 0x2F, 0xFD, 0x6C, 0xD4, 0x6E, 0xF8, 0x19, 0x77, 0xFB, 0x5E, 0x51, 0xF8, 0xC4,
+    0xAF, 0xED, 0x40, 0x10, 0x3E, 0xA7, 0xC9, 0x27, 0x7B, 0xA6, 0xEC, 0x75, 0x43, 0x92, 0x94, 0xF4,
+    0xBE, 0xD7, 0x77, 0xE5, 0xD6, 0x46, 0xF8, 0x5B, 0x09, 0x45, 0x7B, 0x56, 0x70, 0xB3, 0xC9, 0x1A,
+    0xED, 0x8A, 0xFC, 0x6C, 0x32, 0xEE, 0xD6, 0x86, 0x06, 0x7B, 0x56, 0x70, 0xD3, 0xE7, 0x56, 0x0C,
+    0x80, 0xD9, 0xFA, 0x6C, 0xDF, 0xDB, 0x19, 0x17, 0xDD, 0xF1, 0xF7, 0x34, 0x38, 0x25, 0x82, 0xE6,
+    0x4A, 0x1A, 0x1B, 0x15, 0x3A, 0x6D, 0xF8, 0x4F, 0x2E, 0xEE, 0xE8, 0x2F, 0x14, 0xCC, 0x4E, 0xB3,
+    0x2E, 0xFD, 0xD6, 0x25, 0x37, 0x37, 0xD9, 0x47, 0x53, 0x42, 0x34, 0x65, 0x8F, 0x2E, 0x6B, 0x85,
+    0x68, 0x8A, 0x8F, 0xA6, 0xB8, 0xB9, 0xC9, 0xFD, 0xD6, 0x25, 0x2B, 0xAD, 0x46, 0x9A, 0x08, 0x85,
+    0x83, 0x91, 0x41, 0x6D, 0x41, 0xEE, 0x8F, 0xB0, 0x04, 0x41, 0x51, 0x4F, 0x16, 0x34, 0x1E, 0x7F,
+    0xAA, 0x95, 0xF9, 0x72, 0xFA, 0x7E, 0xF6, 0x80, 0xBE, 0x7F, 0x6A, 0xDA, 0xFA, 0xDB, 0xBF, 0x57,
+    0xB8, 0x9D, 0xA5, 0x33, 0x4D, 0x36, 0xE1, 0x66, 0x34, 0x9A, 0x82, 0xDD, 0x3E, 0x96, 0x3D, 0x84,
+    0xD5, 0x8F, 0x4B, 0xEF, 0x4A, 0x5B, 0x18, 0xFF, 0x65, 0x3F, 0xD3, 0x6A, 0x40, 0x99, 0x4E, 0x2B,
+    0x41, 0x63, 0xAD, 0x85, 0x26, 0x83, 0xFE, 0x03, 0xFE, 0xA6, 0xF4, 0x7B, 0x69, 0xF5, 0x9A, 0xB9,
+    0x04, 0x5C, 0x84, 0x44, 0x95, 0xA8, 0x13, 0xAD, 0x8A, 0x53, 0xF1, 0x2A, 0x8F, 0xE4, 0xA7, 0x3E,
+    0x91, 0xFE, 0x34, 0x09, 0xA3, 0x7F, 0x6B, 0x54, 0x2A, 0x15, 0x7C, 0xA1, 0x1A, 0x34, 0xB4, 0xF7,
+    0x32, 0xBD, 0x56, 0x82, 0xA6, 0x5A, 0x1A, 0x5A, 0x7D, 0x42, 0x71, 0x43, 0x5A, 0x1A, 0x85, 0xB7,
+    0x42, 0xDE, 0xC9, 0x45, 0xFF, 0xAA, 0x96, 0xC0, 0x37, 0x41, 0x23, 0x7A, 0x66, 0xC1, 0x5F, 0xCB,
+    0xF4, 0x73, 0x18, 0xED, 0xDA, 0x2D, 0x4D, 0x32, 0xB9, 0x2E, 0x84, 0x51, 0xD8, 0xC5, 0x47, 0x93,
+    0xFB, 0x09, 0xFF, 0xE2, 0x82, 0x3D, 0xDB, 0xA8, 0x4B, 0x06, 0x2F, 0xB0, 0x1A, 0xA9, 0x15, 0xC1,
+    0x2D, 0x84, 0xD1, 0x26, 0xC2, 0x33, 0x8B, 0xD1, 0xE0, 0x6E, 0xA4, 0x5A, 0xB3, 0x5D, 0xC2, 0xA8,
+    0xD4, 0x6C, 0xDD, 0xE2, 0xBC, 0xC9, 0x26, 0x75, 0xAF, 0x45, 0xA1, 0xEF, 0xBC, 0xB1, 0xFA, 0xD8,
+    0xBF, 0xB1, 0x5E, 0xE9, 0xE7, 0x26, 0xA5, 0xEE, 0xB5, 0x15, 0x39, 0xF3, 0x5E, 0xC2, 0xDD, 0x8A,
+    0xB9, 0xD0, 0xDC, 0x9B, 0xFB, 0x30, 0xA0, 0xB5, 0x51, 0xC4, 0x25, 0xB4, 0xD0, 0x0A, 0xB7, 0x51,
+    0x69, 0x6C, 0x13, 0x7E, 0xAE, 0xD5, 0xA6, 0x4A, 0xA3, 0xA2, 0x62, 0xB7, 0x86, 0x58, 0xCB, 0xCF,
+    0x38, 0x2D, 0x34, 0x5A, 0x76, 0x86, 0xCA, 0x15, 0xE8, 0x35, 0x61, 0x95, 0xB0, 0x49, 0x63, 0x9B,
+    0xBA, 0xD5, 0x94, 0x5A, 0x46, 0xB8, 0xDF, 0x6A, 0x68, 0xF3, 0x83, 0x63, 0x5D, 0x42, 0xB4, 0xAB,
+    0x3D, 0x1F, 0xAB, 0x8F, 0xFB, 0x58, 0xEB, 0xDC, 0x4F, 0xB8, 0xC3, 0x58, 0xAB, 0x92, 0x77, 0xE4,
+    0xD7, 0xDE, 0x67, 0x47, 0x96, 0x03, 0x3B, 0x72, 0xC0, 0x1F, 0x7F, 0x2B, 0x70, 0x1A, 0xB1, 0x1A,
+    0x31, 0x65, 0x80, 0x5E, 0x7A, 0x75, 0xE7, 0x56, 0xAF, 0x9E, 0x3C, 0x93, 0xA8, 0x77, 0xB7, 0x65,
+    0xB7, 0x1D, 0x32, 0x46, 0xBA, 0x15, 0x53, 0xF6, 0xDC, 0x9D, 0x93, 0x27, 0xA4, 0xEC, 0xA4, 0x1B,
+    0x52, 0xE6, 0xC2, 0x8A, 0xA6, 0x56, 0x83, 0x5B, 0x11, 0x26, 0x61, 0x17, 0x5C, 0xDC, 0xB3, 0xFD,
+    0xDC, 0x89, 0x30, 0xD7, 0x9A, 0x2E, 0x68, 0x22, 0xC4, 0x8F, 0x35, 0xB0, 0x85, 0x3E, 0xE3, 0x56,
+    0x2E, 0x8C, 0x5C, 0xF9, 0x8C, 0xD7, 0x5F, 0xFC, 0x1F, 0x8C, 0x46, 0x2B, 0x1E, 0xC9, 0xB4, 0x2B,
+    0xDD, 0x84, 0x1F, 0xAA, 0x4C, 0xB3, 0xD2, 0xCD, 0xB8, 0x89, 0x90, 0xB8, 0xBC, 0xD4, 0x8A, 0xAE,
+    0x54, 0xA2, 0xF9, 0x48, 0x83, 0x7E, 0x6A, 0x35, 0xB8, 0x84, 0xA6, 0xFA, 0x87, 0x70, 0xE1, 0x27,
+    0x54, 0x2A, 0xD5, 0x2D, 0x49, 0xDF, 0xFF, 0xF7, 0xCA, 0xE3, 0xF9, 0x16, 0xD0, 0x37, 0x19, 0xB8,
+    0x52, 0x6D, 0x95, 0x4C, 0x36, 0xD9, 0x6E, 0x76, 0xEB, 0x17, 0xB7, 0x84, 0x18, 0xAE, 0x8A, 0x70,
+    0x55, 0xB8, 0x25, 0x44, 0xBB, 0xB9, 0xC5, 0x64, 0xBB, 0x55, 0x32, 0x99, 0x2B, 0xD5, 0xC6, 0x37,
+    0x19, 0x8E, 0x78, 0x88, 0x9E, 0x57, 0x08, 0x57, 0x35, 0xF4, 0x8B, 0x8F, 0x76, 0xEB, 0x0F, 0x6D,
+    0x9E, 0x28, 0x95, 0x9E, 0x28, 0xE7, 0xB2, 0xFA, 0xC5, 0xC7, 0x70, 0x55, 0x43, 0xCF, 0x2B, 0x1C,
+    0xF1, 0xD0, 0x7D, 0x56, 0x0E, 0xF6, 0xA8, 0x6F, 0x07, 0x5A, 0xEC, 0x5C, 0xDE, 0x53, 0xDC, 0xE7,
+    0x39, 0x01, 0xA3, 0x09, 0x6A, 0x6D, 0xEC, 0x50, 0x14, 0x77, 0x7B, 0x82, 0xFE, 0xED, 0x0D, 0xEC,
+    0x2A, 0x68, 0x92, 0x9B, 0xA8, 0x4B, 0x93, 0x40, 0x83, 0xC0, 0x47, 0x37, 0xD1, 0x2F, 0x6D, 0xC2,
+    0x96, 0xBF, 0x15, 0x8D, 0xA4, 0xB9, 0x96, 0x94, 0x90, 0x24, 0xFC, 0xB4, 0x03, 0x61, 0x9B, 0xEC,
+    0x46, 0xA5, 0x6F, 0x67, 0x70, 0x6F, 0x68, 0x87, 0xA6, 0xD5, 0x09, 0x50, 0x6B, 0x38, 0x80, 0x52,
+    0x04, 0x07, 0xA6, 0xF3, 0x12, 0x7F, 0xA2, 0x2E, 0x9D, 0x70, 0x40, 0x8F, 0x3B, 0x6D, 0xE9, 0x9F,
+    0x99, 0xC1, 0x3F, 0x56, 0xE0, 0x12, 0x47, 0xC3, 0x9F, 0xA4, 0x4B, 0xDD, 0xB0, 0x81, 0x5D, 0x02,
+    0x98, 0xD4, 0x47, 0xF8, 0x2B, 0x33, 0x3D, 0x48, 0x7F, 0xEF, 0x2C, 0x84, 0xD5, 0xC0, 0xCE, 0xA1,
+    0x1B, 0x25, 0x40, 0x61, 0x80, 0xF0, 0xE3, 0x19, 0xDC, 0x8D, 0x04, 0xDD, 0xA2, 0x81, 0x76, 0xEB,
+    0x16, 0x4C, 0x36, 0x89, 0x4A, 0x68, 0x20, 0xC4, 0x7E, 0xC1, 0xDD, 0x7D, 0x39, 0xD1, 0x69, 0x67,
+    0xF2, 0xB5, 0x18, 0x49, 0xA9, 0xD2, 0x80, 0x46, 0x45, 0xDC, 0xE2, 0x66, 0x9A, 0xDC, 0xAD, 0xA0,
+    0x17, 0xF7, 0xE8, 0xF8, 0xFF, 0x2F, 0x29, 0xDA, 0x4E, 0x07, 0x0C, 0xEF, 0xE3, 0xBE, 0x8D, 0xF7,
+    0xCF, 0x13, 0x74, 0x65, 0x97, 0x76, 0x74, 0x8C, 0x11, 0xB8, 0x99, 0xBA, 0x40, 0x77, 0x40, 0x85,
+    0xD5, 0x4E, 0xE5, 0xED, 0x4C, 0xE7, 0xFB, 0x1F, 0x65, 0x1F, 0x4F, 0x7F, 0xEA, 0xA5, 0x73, 0x92,
+    0xF2, 0x0F, 0x79, 0xC9, 0x77, 0x4E, 0xEF, 0x13, 0x9B, 0x85, 0xEA, 0x84, 0x5A, 0x43, 0xA5, 0x01,
+    0x41, 0x39, 0xE8, 0xDF, 0x57, 0x23, 0xFA, 0xD2, 0x80, 0x5B, 0x71, 0x1A, 0xDC, 0x2F, 0x97, 0x3E,
+    0x86, 0xA3, 0xA1, 0x1A, 0xBE, 0x22, 0xD1, 0x6D, 0x7C, 0xA5, 0xD9, 0xDC, 0xD5, 0x6C, 0x97, 0x6F,
+    0x55, 0xFB, 0xCC, 0xD0, 0xDC, 0x67, 0x6E, 0x7F, 0x2C, 0xBD, 0xFE, 0x11, 0x3A, 0xB6, 0x9C, 0xFE,
+    0xD7, 0x03, 0x51, 0x2B, 0x5D, 0xFF, 0x18, 0x51, 0x7B, 0xFA, 0xB3, 0xFB, 0xDD, 0xD9, 0x2E, 0x0D,
+    0x28, 0xA2, 0x91, 0x30, 0xE0, 0x07, 0x2E, 0x02, 0x56, 0xD9, 0x69, 0xDD, 0x39, 0xBD, 0xCF, 0xA0,
+    0x3C, 0xCF, 0xB3, 0x46, 0x83, 0x74, 0x43, 0x7A, 0x52, 0x99, 0xA3, 0xA7, 0x08, 0x53, 0x93, 0x70,
+    0xD1, 0x6C, 0x1C, 0xF1, 0xE5, 0x84, 0x9D, 0x1C, 0x1E, 0x26, 0xEE, 0xB5, 0xC5, 0x8D, 0x87, 0x87,
+    0x89, 0xD3, 0x6A, 0x95, 0x8D, 0x34, 0x74, 0x85, 0x7A, 0xF7, 0x1E, 0xFD, 0x42, 0x9B, 0x3E, 0xA7,
+    0xA0, 0xC9, 0x48, 0x83, 0x34, 0x39, 0xAD, 0xDF, 0xAA, 0xDF, 0xCD, 0xF6, 0xED, 0xD5, 0xBD, 0x30,
+    0xFE, 0xA7, 0x1D, 0x3A, 0x9F, 0x73, 0xB7, 0x5D, 0xF9, 0x1C, 0x9E, 0x77, 0xCF, 0x6A, 0x3A, 0xA7,
+    0x87, 0x0F, 0x66, 0xC2, 0xCE, 0x3D, 0xB8, 0x72, 0x05, 0x82, 0x12, 0x6C, 0xDD, 0x0A, 0xC7, 0xE7,
+    0x01, 0xE1, 0xD7, 0xC7, 0x50, 0x1E, 0x3D, 0x05, 0x54, 0x1A, 0xD9, 0x57, 0xE1, 0xC1, 0xC8, 0xB6,
+    0xCB, 0x47, 0xEC, 0x7E, 0xAF, 0x99, 0x9D, 0x9A, 0x0B, 0x52, 0x22, 0x94, 0x97, 0x35, 0xBA, 0x15,
+    0xBF, 0xF4, 0x1B, 0x4D, 0xB1, 0x09, 0x74, 0xAD, 0x40, 0xFF, 0xEE, 0x1F, 0xD0, 0x7D, 0x0F, 0x70,
+    0x80, 0x6E, 0xA6, 0x96, 0x4D, 0xA0, 0x57, 0x35, 0xE0, 0x67, 0xB7, 0xE2, 0x97, 0x56, 0xFF, 0xA0,
+    0x0D, 0x49, 0x69, 0x27, 0xF4, 0xB8, 0xAC, 0x37, 0x3F, 0xB4, 0xEE, 0x27, 0x1C, 0x2C, 0xC2, 0x8E,
+    0x0A, 0xC3, 0xC8, 0xBE, 0x11, 0xF7, 0x80, 0xF5, 0xFF, 0x93, 0x74, 0xEC, 0x64, 0xD8, 0x67, 0xE8,
+    0x40, 0x65, 0xB9, 0xD7, 0x16, 0x70, 0x63, 0x80, 0xA3, 0xE1, 0xBE, 0x0F, 0xF8, 0x53, 0x74, 0xCC,
+    0x8E, 0xBF, 0x80, 0x76, 0xF5, 0x23, 0x75, 0xB6, 0x33, 0x7C, 0xAB, 0x9E, 0x3F, 0xE2, 0x09, 0x82,
+    0x46, 0x6A, 0xA9, 0x50, 0x4B, 0x5A, 0x6A, 0xDD, 0x0D, 0x05, 0x4D, 0x95, 0x62, 0x98, 0xE9, 0x36,
+    0xB7, 0x60, 0x64, 0x37, 0x08, 0xD7, 0x3F, 0x89, 0xB9, 0x7D, 0x3D, 0x43, 0xB7, 0x6A, 0xA4, 0x4D,
+    0x6E, 0xC1, 0xA8, 0xCD, 0x54, 0x1A, 0x35, 0x55, 0x8A, 0xBD, 0xFE, 0xB3, 0x66, 0x23, 0x69, 0xA1,
+    0x97, 0x66, 0xAA, 0xA0, 0x97, 0x0E, 0xDA, 0x73, 0xC2, 0x4E, 0x30, 0xED, 0x98, 0xC2, 0xC7, 0x83,
+    0xFF, 0xAE, 0x0E, 0xB4, 0xC4, 0x46, 0x9D, 0xFF, 0x38, 0xEA, 0x32, 0x44, 0xDC, 0xDB, 0x09, 0x53,
+    0xFC, 0x84, 0xBF, 0x21, 0x6C, 0xEA, 0xCB, 0xD3, 0x1A, 0x0F, 0x3E, 0x2A, 0xD1, 0x28, 0x9F, 0xB3,
+    0x1F, 0x97, 0x8E, 0x0F, 0x2C, 0x99, 0x86, 0x9D, 0x9C, 0x69, 0x97, 0x0F, 0x75, 0xFB, 0x6B, 0xE9,
+    0x42, 0xF5, 0x14, 0xA0, 0x19, 0x7A, 0x8D, 0xB4, 0x1F, 0x64, 0xEA, 0xD4, 0xAC, 0xF7, 0x11, 0xC3,
+    0xD7, 0xD2, 0x85, 0x5F, 0x34, 0x13, 0x76, 0x11, 0x14, 0xBB, 0xD0, 0xC4, 0xBF, 0xFA, 0x50, 0x2B,
+    0xBE, 0x06, 0x0E, 0xB9, 0x3A, 0xD9, 0xA1, 0xA5, 0x29, 0x50, 0x67, 0xA8, 0xD3, 0x7D, 0x66, 0x2A,
+    0x68, 0xB4, 0x52, 0xEC, 0xA5, 0xF8, 0x6F, 0x6A, 0xED, 0xD1, 0xA2, 0x5D, 0xAB, 0xA0, 0x49, 0xD2,
+    0x93, 0xFA, 0x5D, 0x0E, 0x93, 0x3D, 0x13, 0xEE, 0xD6, 0x56, 0xE9, 0xF2, 0xDA, 0x65, 0x2F, 0xAD,
+    0xD2, 0xAD, 0x29, 0x6C, 0x6E, 0xB8, 0xB8, 0x6F, 0xEF, 0x63, 0x04, 0xFD, 0x42, 0x75, 0xF0, 0xFA,
+    0x17, 0xF9, 0x4A, 0x24, 0x1F, 0x1D, 0x83, 0xE6, 0xFD, 0x44, 0xD8, 0xE5, 0xA9, 0x5D, 0xFA, 0x78,
+    0x69, 0x77, 0x4F, 0x5F, 0x56, 0x72, 0xBD, 0x74, 0x43, 0x37, 0x0B, 0xFF, 0x7C, 0xE2, 0xE7, 0xCD,
+    0x03, 0xDB, 0x9F, 0xB3, 0x91, 0x96, 0x56, 0x5A, 0xFE, 0xD9, 0x70, 0x38, 0xA4, 0x61, 0x32, 0x97,
+    0xB5, 0x3A, 0xE9, 0x86, 0xEE, 0xEA, 0xF2, 0x6A, 0xF2, 0xCE, 0x6A, 0xF8, 0x9B, 0xB9, 0xD1, 0x33,
+    0x52, 0x76, 0x3A, 0x5B, 0xFB, 0x62, 0xA7, 0x23, 0xF8, 0x72, 0x3C, 0xDF, 0x06, 0x76, 0x02, 0x3F,
+    0x52, 0x25, 0x8E, 0x7C, 0x24, 0x6C, 0x34, 0x79, 0x07, 0xE0, 0xE7, 0xA8, 0xAD, 0x5D, 0x0F, 0x33,
+    0x77, 0xF1, 0x2B, 0x24, 0xED, 0x2E, 0x0D, 0xA0, 0x7D, 0xC3, 0xA9, 0xD9, 0xF6, 0xF9, 0x3B, 0xFA,
+    0x0A, 0x49, 0xC1, 0xA3, 0xE3, 0xFD, 0x04, 0x86, 0x32, 0x75, 0x0E, 0x43, 0xBB, 0xF4, 0xF1, 0x80,
+    0x09, 0xBE, 0x12, 0xF9, 0xF5, 0xD2, 0x0D, 0xCD, 0xE6, 0x62, 0xB3, 0xB9, 0x58, 0xCF, 0xDD, 0x03,
+    0xA6, 0xF6, 0xCB, 0xCB, 0xBE, 0x74, 0x5C, 0x6B, 0x68, 0xCE, 0x83, 0xD3, 0xA7, 0x00, 0x37, 0x9B,
+    0xF2, 0x45, 0xBE, 0xAA, 0x13, 0x34, 0x6A, 0xD4, 0x10, 0xB8, 0xB4, 0x73, 0x8D, 0x9F, 0x4B, 0xF2,
+    0xC1, 0x09, 0xF8, 0x05, 0x2F, 0xDC, 0x8B, 0x8B, 0x1B, 0x75, 0xB4, 0x1B, 0x27, 0x53, 0x40, 0x23,
+    0x6E, 0xC6, 0x6E, 0x5F, 0xB4, 0xF0, 0xE7, 0xF5, 0x6F, 0x53, 0x77, 0x73, 0xF1, 0x4F, 0x0E, 0x3F,
+    0x3F, 0x44, 0x20, 0x9F, 0x4E, 0xF6, 0x7C, 0x2C, 0x0B, 0xD0, 0xAC, 0x76, 0xF0, 0xE5, 0x15, 0x23,
+    0x2D, 0xB6, 0x16, 0x17, 0xF7, 0xE3, 0x90, 0xEE, 0x39, 0x4D, 0x72, 0x9F, 0xC0, 0x8D, 0x7E, 0x06,
+    0x05, 0x77, 0x5E, 0x8C, 0x9C, 0xB0, 0x6F, 0x68, 0xF4, 0xCB, 0xAE, 0x68, 0x94, 0x0F, 0x71, 0xC4,
+    0x57, 0x42, 0xD1, 0x5D, 0x3A, 0xDE, 0x43, 0x99, 0xF3, 0xE3, 0x63, 0x33, 0xF7, 0x03, 0xC2, 0xAF,
+    0x42, 0xFE, 0xD1, 0x31, 0xF4, 0x09, 0x42, 0xA1, 0x2A, 0x7E, 0x6C, 0x56, 0x3B, 0x57, 0xC3, 0xC1,
+    0x8D, 0x7E, 0x05, 0xF2, 0xAB, 0xD5, 0x8E, 0x26, 0xF5, 0xD1, 0xA4, 0x3E, 0x56, 0xAB, 0x1D, 0x3F,
+    0x54, 0xE4, 0xAF, 0x40, 0xF6, 0xC9, 0xEE, 0x7F, 0x9B, 0xC3, 0x99, 0xB5, 0x3A, 0x9D, 0x03, 0x00,
+    0x37, 0xD5, 0xE5, 0x53, 0x48, 0xB6, 0x07, 0x8A, 0x05, 0xA7, 0x54, 0xE9, 0xF6, 0x9D, 0xCB, 0xF2,
+    0x52, 0x0A, 0xBA, 0xB5, 0x84, 0xD4, 0xC7, 0x87, 0x1E, 0xB0, 0xFE, 0x6E, 0xA6, 0xCE, 0xD0, 0x4F,
+    0xE7, 0x7E, 0xFD, 0x4B, 0x4B, 0xBE, 0x74, 0x4C, 0xA5, 0x09, 0xAB, 0x88, 0x5C, 0xB4, 0x73, 0x1F,
+    0x2F, 0xED, 0xEA, 0xF2, 0x65, 0x25, 0x9B, 0xB9, 0xA7, 0xFF, 0x55, 0x21, 0x7C, 0x7B, 0xE3, 0xE7,
+    0xED, 0xF9, 0x83, 0xB6, 0xFB, 0x01, 0x40, 0x7D, 0x8E, 0xE4, 0xD1, 0x4A, 0xF8, 0x7B, 0xE5, 0x69,
+    0xDD, 0x92, 0xD4, 0xEB, 0x2C, 0xF5, 0x6A, 0x97, 0xEA, 0x23, 0x18, 0x4F, 0x2A, 0x04, 0x49, 0x9A,
+    0x9D, 0x24, 0x95, 0x56, 0xEF, 0x48, 0x9A, 0x35, 0x99, 0x02, 0xFD, 0xBA, 0x5B, 0x7F, 0x4C, 0x01,
+    0x37, 0xE3, 0x66, 0x4C, 0xC6, 0xE8, 0xF4, 0xA7, 0x7E, 0xC2, 0x49, 0xD7, 0x33, 0x46, 0x4A, 0x7B,
+    0xE1, 0x5A, 0x7E, 0xB0, 0xD9, 0xFE, 0x9B, 0x5D, 0x00, 0x8A, 0xA6, 0x40, 0xAB, 0xBF, 0x0E, 0x77,
+    0x4F, 0x5F, 0xDA, 0xFF, 0xE7, 0xF0, 0xA7, 0xD5, 0x5E, 0xB8, 0xBF, 0x73, 0xB4, 0x1F, 0x1C, 0x58,
+    0x1B, 0xCD, 0x78, 0xE5, 0x03, 0x85, 0x20, 0x2D, 0xFD, 0x9D, 0xCB, 0x8A, 0x6E, 0xD6, 0xD8, 0x25,
+    0xDC, 0xF5, 0x84, 0x5B, 0x50, 0xBF, 0x20, 0x29, 0x87, 0x58, 0x4B, 0xFA, 0x40, 0xB4, 0x92, 0x6E,
+    0x26, 0xDC, 0x0C, 0xDD, 0x72, 0xF0, 0x43, 0x8D, 0x06, 0x08, 0x6F, 0x06, 0x8D, 0xCD, 0x20, 0x49,
+    0xCA, 0x48, 0x67, 0xD2, 0x4A, 0x28, 0x95, 0x34, 0x72, 0x04, 0x47, 0x70, 0x72, 0x72, 0xE2, 0xA4,
+    0x5B, 0xD2, 0x07, 0x52, 0x3E, 0x39, 0x39, 0x39, 0x39, 0x39, 0x79, 0x4A, 0x87, 0x8D, 0x82, 0xFD,
+    0x12, 0xF6, 0x4B, 0x33, 0x5F, 0xB1, 0xBF, 0x4E, 0xEE, 0x5A, 0x0A, 0xCF, 0x1E, 0xDB, 0xDF, 0x94,
+    0xFE, 0x46, 0x72, 0xCF, 0xAF, 0xBE, 0x1A, 0x9A, 0xB9, 0x7F, 0x7C, 0xB3, 0x53, 0x6E, 0x96, 0x60,
+    0x92, 0x8B, 0xC5, 0x2E, 0xE1, 0x85, 0xCD, 0x4D, 0x4F, 0x1D, 0x1D, 0xDB, 0x39, 0x7C, 0x7B, 0x73,
+    0xBF, 0xCE, 0x76, 0x91, 0xD9, 0xDC, 0xB3, 0xD9, 0x4E, 0xA1, 0x59, 0xDC, 0x70, 0x7C, 0x34, 0x1C,
+    0x71, 0x34, 0x54, 0x83, 0x86, 0x30, 0xFA, 0xEB, 0xC5, 0xC8, 0xA8, 0xDB, 0x6C, 0x6A, 0x93, 0x8B,
+    0xFD, 0xD4, 0xCD, 0x17, 0x79, 0x88, 0x23, 0xFE, 0x1F, 0xBD, 0x98, 0xBF, 0xAF, 0x18, 0xB9, 0x71,
+    0xC7, 0xBF, 0xBB, 0x84, 0x6E, 0x81, 0x2C, 0x60, 0x36, 0x76, 0xE3, 0x14, 0xDB, 0x27, 0xC5, 0xD6,
+    0xA9, 0xB8, 0xB6, 0x10, 0xA4, 0x70, 0x71, 0x0A, 0x72, 0x97, 0x03, 0xE2, 0xE2, 0xB5, 0x41, 0x5C,
+    0xE8, 0x4F, 0xE0, 0x9E, 0x55, 0xB8, 0x10, 0x10, 0xAB, 0x09, 0x52, 0xC6, 0x08, 0x10, 0x20, 0x78,
+    0x57, 0xBC, 0x7F, 0x20, 0x00, 0x69, 0x5F, 0xA1, 0x42, 0xC5, 0xAD, 0x73, 0x50, 0x5E, 0xA1, 0x42,
+    0x9B, 0xC4, 0xC6, 0xE5, 0xA4, 0x42, 0xD4, 0x69, 0x9F, 0xB5, 0xEF, 0x89, 0xE4, 0x27, 0xC5, 0x3E,
+    0xDD, 0x9D, 0xFC, 0x33, 0xF0, 0x25, 0x59, 0xEC, 0x2C, 0x67, 0x86, 0x43, 0x72, 0x97, 0x9C, 0x19,
+    0x7E, 0x97, 0xFD, 0xFC, 0x2F, 0xDD, 0xEE, 0xDE, 0xAF, 0x43, 0x72, 0x37, 0x37, 0x49, 0x92, 0x3A,
+    0xB8, 0x82, 0x1A, 0xE0, 0x0C, 0x9E, 0x66, 0xB5, 0x48, 0x21, 0x6A, 0x4C, 0xEA, 0xEB, 0xE9, 0x3F,
+    0x42, 0x0E, 0x30, 0xC2, 0x83, 0x37, 0x6A, 0xB2, 0x5A, 0x4E, 0x4F, 0xAF, 0xDB, 0xC0, 0x2E, 0x43,
+    0x94, 0xC4, 0x26, 0x29, 0x54, 0x49, 0x8E, 0x28, 0xD9, 0x57, 0x9B, 0xD4, 0x5F, 0x56, 0xC9, 0x14,
+    0x17, 0xD5, 0x60, 0x37, 0x29, 0xBC, 0x8F, 0xE4, 0x16, 0x17, 0x35, 0x24, 0xBB, 0xA9, 0xCF, 0x2D,
+    0x32, 0x9C, 0x12, 0x1B, 0x60, 0x57, 0x00, 0xE4, 0x80, 0x38, 0x6C, 0xB2, 0xBB, 0xCD, 0x32, 0x98,
+    0x2A, 0xF9, 0x9F, 0x32, 0xC9, 0xEE, 0x44, 0x19, 0xE4, 0x21, 0xBD, 0x41, 0x51, 0x7A, 0x83, 0xF8,
+    0x54, 0x1E, 0x16, 0x0F, 0x9B, 0x87, 0xEC, 0xA3, 0x2D, 0x3E, 0x9A, 0xE2, 0xA3, 0xA9, 0x47, 0xD9,
+    0x17, 0xFF, 0x24, 0xE4, 0xEB, 0xFA, 0xC5, 0x73, 0x29, 0xCF, 0xA7, 0x0A, 0xB0, 0x06, 0xD8, 0xC3,
+    0x93, 0x90, 0x43, 0xEC, 0x4B, 0x88, 0xE6, 0x9A, 0xFA, 0x1C, 0x1E, 0x86, 0x2D, 0xC0, 0x72, 0x4D,
+    0xFB, 0x75, 0x3D, 0x21, 0xB6, 0x1C, 0x65, 0x47, 0x78, 0x12, 0x4A, 0x38, 0xA6, 0x6C, 0x0D, 0x54,
+    0x79, 0x38, 0x87, 0xF2, 0xBA, 0x88, 0xEA, 0xB2, 0xF4, 0xFB, 0x14, 0xD2, 0x00, 0x45, 0x0A, 0xB0,
+    0xAB, 0x05, 0x56, 0xF5, 0xC0, 0xAC, 0x71, 0x31, 0x55, 0x0A, 0x93, 0xDD, 0x65, 0x8A, 0xDC, 0x2A,
+    0x9B, 0xC4, 0x2C, 0x17, 0x4D, 0x95, 0x90, 0xDD, 0x65, 0xF2, 0x17, 0x6A, 0x1F, 0x4D, 0x55, 0x53,
+    0x65, 0x77, 0xD9, 0x4D, 0x6E, 0x95, 0x8B, 0x62, 0x36, 0x55, 0xA6, 0x36, 0xE1, 0xEA, 0xF4, 0xAC,
+    0xDE, 0x05, 0xE0, 0x36, 0x40, 0x09, 0x00, 0xBF, 0xA8, 0x92, 0xDC, 0xA3, 0x5D, 0x12, 0xB7, 0x57,
+    0xC9, 0x94, 0x30, 0x4B, 0x76, 0x7B, 0x47, 0xD2, 0x37, 0x26, 0xFF, 0xDA, 0x01, 0xAE, 0xA0, 0x7E,
+    0xC9, 0x35, 0xA4, 0xF0, 0xE4, 0x74, 0x84, 0x07, 0xF0, 0x19, 0xE4, 0x37, 0x6B, 0xA2, 0xC6, 0xAB,
+    0xD3, 0x0F, 0x3E, 0xF7, 0xBA, 0x79, 0x5C, 0x15, 0xE6, 0xB6, 0x9A, 0xA2, 0x71, 0x6D, 0x98, 0x42,
+    0xEC, 0x77, 0x31, 0xDB, 0xBD, 0xAD, 0x0A, 0xB1, 0x61, 0x0A, 0xB3, 0x5B, 0x34, 0xA6, 0x71, 0x75,
+    0xAB, 0x4C, 0xED, 0xF7, 0x31, 0x49, 0xFE, 0x27, 0xD5, 0x6E, 0x52, 0x5F, 0x79, 0xB6, 0x4B, 0x02,
+    0xB2, 0x24, 0x07, 0x48, 0x1A, 0x81, 0x55, 0x1A, 0xF6, 0x70, 0xB7, 0x48, 0x36, 0x8F, 0x2B, 0x51,
+    0x7D, 0xE9, 0xF7, 0x61, 0x97, 0xA9, 0x6D, 0x6D, 0x99, 0x0C, 0x0A, 0xB3, 0x4B, 0x2D, 0xD3, 0xB8,
+    0x76, 0x55, 0xC4, 0x7E, 0x17, 0x91, 0xD8, 0x56, 0xD9, 0xEC, 0x57, 0x85, 0xB9, 0x65, 0x96, 0xA4,
+    0x91, 0xB5, 0x87, 0x7D, 0x80, 0xCD, 0x9D, 0x92, 0x6E, 0x29, 0x44, 0x09, 0xC9, 0x64, 0xC9, 0xAD,
+    0x37, 0xBE, 0x87, 0x1C, 0xAB, 0x60, 0x36, 0xB0, 0xA8, 0x21, 0x4A, 0xCC, 0x32, 0x55, 0xB2, 0xBB,
+    0xE4, 0x9F, 0xFE, 0xFC, 0x84, 0x11, 0xF6, 0x00, 0x73, 0x60, 0x55, 0x73, 0x4B, 0xF2, 0x51, 0xFE,
+    0x02, 0x19, 0xCE, 0xB3, 0x06, 0x4E, 0x92, 0x28, 0x3E, 0x76, 0x5C, 0x20, 0xC7, 0x79, 0x6E, 0x2A,
+    0x27, 0xC9, 0xBE, 0x28, 0x3E, 0xFA, 0xB7, 0x2F, 0x30, 0xD9, 0x9D, 0xE7, 0x61, 0xE1, 0x24, 0x61,
+    0x8A, 0xBF, 0xBF, 0xD9, 0x0B, 0x5C, 0x74, 0xE7, 0xA5, 0x88, 0x13, 0x92, 0x29, 0x9E, 0xC9, 0x5E,
+    0x90, 0xE5, 0xCE, 0x59, 0xC4, 0x09, 0x32, 0xC5, 0x6F, 0xB2, 0x9B, 0xDE, 0xD1, 0x3B, 0x32, 0x7B,
+    0x9F, 0x64, 0x37, 0x1F, 0x35, 0x50, 0xA4, 0x81, 0x45, 0x6A, 0x6E, 0x1D, 0x51, 0x3F, 0x24, 0x0D,
+    0xC5, 0x47, 0x71, 0x81, 0x3A, 0xCE, 0xB3, 0x1C, 0x27, 0xA9, 0xA1, 0xF8, 0x68, 0xB9, 0x40, 0x3E,
+    0x9C, 0x67, 0x93, 0x39, 0x49, 0xC3, 0xC7, 0xC5, 0x47, 0xEC, 0x05, 0xDD, 0xE6, 0xCE, 0xB3, 0x8B,
+    0x9C, 0x3C, 0x2F, 0xA6, 0xF8, 0x8F, 0x92, 0xBD, 0xC0, 0x4F, 0xEE, 0x9C, 0x2C, 0x4E, 0x58, 0x4C,
+    0xF1, 0xC8, 0x5E, 0xB0, 0xC9, 0x9D, 0x13, 0xC5, 0x49, 0x91, 0x29, 0x3E, 0x2A, 0xFC, 0x18, 0x99,
+    0xD2, 0x65, 0xB9, 0x34, 0xA4, 0x16, 0xF9, 0x38, 0x6C, 0x0D, 0x62, 0xEE, 0x72, 0x9F, 0x35, 0x24,
+    0xBF, 0xC8, 0x3F, 0xAD, 0x6A, 0x20, 0xA9, 0x83, 0xA8, 0x01, 0x66, 0xF9, 0x9F, 0x30, 0x35, 0x18,
+    0xD4, 0xE5, 0xAE, 0x6A, 0x48, 0x7D, 0x91, 0x8F, 0x36, 0x37, 0x68, 0xD8, 0xBB, 0xAC, 0x71, 0x1B,
+    0x92, 0x5C, 0xF2, 0x51, 0x7E, 0x95, 0x83, 0xDC, 0x00, 0xA9, 0x03, 0xE2, 0x00, 0xC8, 0xCF, 0x7D,
+    0x6E, 0xAA, 0xC6, 0xD4, 0xEF, 0x0A, 0x71, 0x5C, 0x5B, 0x14, 0xA6, 0x3E, 0xB7, 0x45, 0x63, 0xB2,
+    0x9B, 0x42, 0x74, 0x4B, 0x8B, 0x50, 0x9F, 0x4D, 0xD6, 0x98, 0x6C, 0x52, 0x88, 0x3E, 0xB6, 0xB4,
+    0xA8, 0xAF, 0x61, 0xD7, 0x08, 0x51, 0x81, 0xAA, 0x16, 0x56, 0xF5, 0xF9, 0xEB, 0x92, 0xE4, 0x77,
+    0xC9, 0x5D, 0x92, 0xD4, 0xF2, 0x92, 0x45, 0x96, 0xC7, 0xCC, 0x72, 0x78, 0xD4, 0x52, 0x6A, 0x91,
+    0x7D, 0xF6, 0xF2, 0xE5, 0x2E, 0xE7, 0x1F, 0x3F, 0x4A, 0x6D, 0xC6, 0x9F, 0x44, 0xFB, 0x9F, 0xA5,
+    0xBA, 0xD9, 0xBD, 0xFD, 0x72, 0xA7, 0xCD, 0xEE, 0xF1, 0xBF, 0x67, 0xBB, 0xE2, 0xEF, 0x6C, 0xEE,
+    0x66, 0xA9, 0xF6, 0x79, 0xB6, 0x2F, 0xF7, 0xF1, 0xA3, 0xD5, 0x3D, 0x5E, 0x7D, 0x98, 0xF0, 0x33,
+    0xD9, 0x94, 0xDA, 0xB2, 0xDA, 0x97, 0x7B, 0xC7, 0xE4, 0x1E, 0xAF, 0x36, 0x0B, 0x3F, 0x8F, 0xAB,
+    0xC9, 0x3E, 0x6A, 0xF8, 0x24, 0xAB, 0xC5, 0x47, 0x8D, 0x2F, 0x7F, 0x03, 0xF3, 0xE4, 0x34, 0xBC,
+    0x04, 0xF0, 0xC0, 0xC1, 0xFC, 0x16, 0xE3, 0x2F, 0x33, 0xE9, 0x70, 0x87, 0x96, 0x22, 0xF5, 0xB0,
+    0xA9, 0x07, 0xA6, 0x9E, 0x27, 0x6C, 0x86, 0xA9, 0xA7, 0x65, 0x52, 0x58, 0x88, 0xB2, 0xBB, 0x5B,
+    0x65, 0x18, 0x36, 0x29, 0xDC, 0xCF, 0xD2, 0xF8, 0x1C, 0xA9, 0xCB, 0x3E, 0xAA, 0x3D, 0x94, 0x1F,
+    0x16, 0xC9, 0x25, 0xA2, 0xEC, 0x3E, 0x6E, 0xEA, 0x8B, 0x61, 0xEA, 0x50, 0xB8, 0xBC, 0xCD, 0x64,
+    0x81, 0x59, 0x01, 0x26, 0xBD, 0x45, 0x95, 0xD4, 0x4C, 0x92, 0x07, 0x3E, 0x01, 0xEA, 0x17, 0x4C,
+    0x94, 0xFB, 0x24, 0xCB, 0xFC, 0x6F, 0x30, 0xAB, 0xE7, 0x67, 0x2D, 0x94, 0x1E, 0xEA, 0x08, 0x39,
+    0xC4, 0xF1, 0x0A, 0xB9, 0x57, 0x59, 0xE1, 0x59, 0x6A, 0x09, 0xD1, 0x5E, 0x21, 0x1E, 0x01, 0x23,
+    0xA4, 0x00, 0x2D, 0xA7, 0x53, 0x9F, 0xA5, 0x31, 0x49, 0x21, 0xAA, 0x45, 0xFA, 0x92, 0x78, 0x5C,
+    0x4D, 0xA8, 0x53, 0x07, 0x7B, 0x0F, 0xA5, 0xE3, 0x09, 0x86, 0xB9, 0xF9, 0x36, 0xB3, 0x44, 0x94,
+    0xDC, 0x2A, 0x0D, 0x9B, 0xD4, 0x65, 0xA9, 0x41, 0x47, 0xDA, 0x1E, 0x36, 0xC9, 0x54, 0x1D, 0x16,
+    0xE3, 0x26, 0x75, 0x4C, 0x9A, 0x42, 0xFD, 0xAB, 0x64, 0x21, 0x2B, 0x80, 0xDE, 0xA2, 0x4E, 0x6A,
+    0x6E, 0xC9, 0x03, 0x03, 0x70, 0x0E, 0x5C, 0x00, 0x59, 0x76, 0x7F, 0xDD, 0x78, 0x3E, 0xBA, 0xFF,
+    0x3D, 0x15, 0x3E, 0xAA, 0xDF, 0x99, 0xE5, 0x7E, 0x82, 0x5A, 0x4C, 0x91, 0xDD, 0xFA, 0x2C, 0x1F,
+    0x87, 0xD4, 0x56, 0xB9, 0xD5, 0x26, 0xF9, 0xE8, 0x67, 0x71, 0xB3, 0xA8, 0xC1, 0x26, 0x99, 0x1C,
+    0x26, 0x75, 0xAF, 0xB2, 0x64, 0x59, 0xA5, 0x11, 0x49, 0x6E, 0x97, 0xC4, 0x22, 0x75, 0x48, 0x7F,
+    0x14, 0x92, 0x04, 0xB3, 0x0C, 0xBB, 0x64, 0x99, 0x8E, 0x15, 0xFD, 0xFC, 0xB2, 0xE9, 0xF3, 0x67,
+    0x73, 0x76, 0x75, 0x4B, 0xF2, 0x50, 0x65, 0x00, 0xA2, 0x05, 0x48, 0x43, 0xB1, 0x69, 0xCC, 0x2E,
+    0xD9, 0xD4, 0x67, 0xB7, 0xD8, 0x64, 0x8A, 0x8F, 0x36, 0x99, 0xEA, 0xA3, 0x4D, 0x6D, 0x3D, 0xF8,
+    0x43, 0x7F, 0xD8, 0x1C, 0xF6, 0x47, 0xDB, 0x16, 0x20, 0x1E, 0x7D, 0xAA, 0x39, 0xBB, 0x9A, 0xDE,
+    0x1C, 0x51, 0x37, 0x6E, 0x49, 0x6E, 0x91, 0xDD, 0xC7, 0xA4, 0x31, 0xD9, 0x5D, 0x6E, 0xE9, 0x8A,
+    0x42, 0x34, 0x34, 0x48, 0xDC, 0xA9, 0x92, 0x7F, 0x90, 0x25, 0xC7, 0x76, 0xFD, 0x85, 0x3D, 0x51,
+    0xEA, 0x98, 0x25, 0x4B, 0x94, 0x46, 0x92, 0xE4, 0x9E, 0x6D, 0x12, 0x77, 0xB3, 0x1A, 0x0C, 0x32,
+    0xB5, 0x61, 0xEA, 0xB3, 0x42, 0x1C, 0x36, 0xB9, 0xE4, 0x56, 0x8D, 0x5B, 0x88, 0xB2, 0xD9, 0x47,
+    0x8D, 0xCB, 0x90, 0x64, 0xF7, 0x2E, 0xCB, 0xD4, 0x06, 0x89, 0xD9, 0x47, 0xB9, 0xF5, 0xAB, 0x2A,
+    0xAF, 0x4E, 0xCF, 0xEA, 0x0F, 0xB8, 0x76, 0x06, 0x8A, 0x07, 0x98, 0x24, 0xB9, 0x45, 0x92, 0xDD,
+    0x24, 0x99, 0x22, 0x49, 0x4C, 0x92, 0xBE, 0x31, 0x31, 0x09, 0xBF, 0xC8, 0x3D, 0xDE, 0x64, 0x5F,
+    0x16, 0x99, 0xF2, 0x86, 0xA2, 0xCA, 0x14, 0xA2, 0xB8, 0xBD, 0xCB, 0x9F, 0x03, 0x5B, 0x38, 0x62,
+    0x83, 0xE9, 0x9B, 0x9F, 0xBA, 0xE5, 0xE8, 0xCF, 0x94, 0xEB, 0xDE, 0x7E, 0x49, 0xE1, 0x63, 0x5B,
+    0xD5, 0x5F, 0xA1, 0x3E, 0xCB, 0x3D, 0xCD, 0x1A, 0x93, 0x38, 0x4B, 0x0A, 0xD1, 0xD4, 0x10, 0x5B,
+    0x64, 0xFF, 0x0F, 0xAA, 0x4E, 0xCF, 0xEA, 0x69, 0x78, 0x0A, 0x00, 0x67, 0xC0, 0x01, 0x15, 0x80,
+    0xDD, 0xC7, 0xB6, 0x1E, 0x0E, 0xEC, 0x56, 0x31, 0x85, 0x68, 0xFE, 0x7F, 0xC5, 0x7A, 0x1A, 0xAE,
+    0x4E, 0xF9, 0xAF, 0xE3, 0x6D, 0x78, 0x70, 0x14, 0xF9, 0x5A, 0x3C, 0x12, 0x45, 0x97, 0x8F, 0x30,
+    0xF0, 0xBF, 0x56, 0x6C, 0xFF, 0xD9, 0x93, 0xA4, 0x81, 0x2C, 0x75, 0x20, 0x35, 0x47, 0x3B, 0x9B,
+    0x74, 0xC0, 0x0A, 0x09, 0x49, 0x72, 0x4F, 0xEE, 0x49, 0x16, 0x56, 0x19, 0x40, 0x02, 0x92, 0xDC,
+    0x32, 0x64, 0xD9, 0xD4, 0x30, 0x1F, 0xB0, 0x0E, 0xD9, 0xFD, 0x00, 0x7B, 0x36, 0xB5, 0x4C, 0xA6,
+    0x7E, 0x40, 0x14, 0xB0, 0xC8, 0xC1, 0x22, 0x4B, 0x9D, 0xE4, 0xA3, 0x64, 0x9F, 0x23, 0xC9, 0xDD,
+    0xCF, 0x92, 0x18, 0x92, 0x64, 0xF2, 0xAF, 0xAA, 0xAF, 0xFE, 0x49, 0x26, 0x7B, 0x98, 0xEC, 0x73,
+    0x60, 0x76, 0xF7, 0x81, 0x89, 0x21, 0xF5, 0x98, 0xEC, 0x63, 0x9F, 0xED, 0x73, 0x64, 0x37, 0x77,
+    0x3F, 0xCB, 0x2D, 0x0C, 0xA9, 0xE1, 0x66, 0xF6, 0xD1, 0x66, 0xFB, 0x9C, 0x0F, 0x58, 0xDD, 0x7D,
+    0x40, 0x0C, 0x90, 0x4C, 0xF6, 0x5C, 0xCA, 0xFE, 0x2A, 0x2A, 0xFF, 0x32, 0x3D, 0xB9, 0x25, 0x0F,
+    0x93, 0x87, 0xD5, 0xC3, 0xEE, 0xE3, 0x98, 0x7D, 0xEC, 0x5E, 0xA3, 0xF4, 0x72, 0xF0, 0x36, 0xFB,
+    0x27, 0xE4, 0x6B, 0x94, 0xBF, 0x78, 0x2E, 0x5F, 0xA7, 0x61, 0xF5, 0xB0, 0x37, 0xC0, 0xEC, 0x9E,
+    0xB0, 0xDF, 0x90, 0x41, 0x47, 0xBE, 0xEB, 0x8F, 0xEC, 0xFB, 0xEE, 0xBB, 0x61, 0x71, 0xB0, 0x59,
+    0x28, 0xE6, 0x08, 0x1C, 0xBF, 0x48, 0x43, 0x3A, 0x2C, 0x4C, 0x95, 0x0C, 0x7F, 0xF6, 0xE9, 0xF7,
+    0x78, 0x1F, 0x88, 0x1E, 0xE6, 0xFE, 0x3A, 0x0D, 0xBF, 0x4E, 0xF5, 0x48, 0xA1, 0xAA, 0xCB, 0x1A,
+    0x61, 0x1A, 0x52, 0x0B, 0xCC, 0x3E, 0x0E, 0xF5, 0x8C, 0x6F, 0x21, 0x62, 0x47, 0x97, 0xBB, 0xAC,
+    0xBE, 0x0C, 0x69, 0x5C, 0x65, 0x77, 0x1F, 0x99, 0xE4, 0x9E, 0xF3, 0x41, 0x91, 0xC2, 0x7D, 0x48,
+    0x6A, 0x18, 0x20, 0xAA, 0xCB, 0x1E, 0xA4, 0xE1, 0x39, 0x26, 0x4B, 0xE1, 0x7E, 0xB6, 0x9B, 0x5A,
+    0x86, 0xE4, 0x8E, 0x56, 0x3E, 0xCA, 0xFF, 0xF4, 0x75, 0x87, 0x2D, 0x3F, 0x0F, 0xDB, 0x90, 0xCC,
+    0x31, 0x96, 0x81, 0xBD, 0x41, 0x0D, 0x55, 0x92, 0x74, 0x43, 0x92, 0xDE, 0x0A, 0xC4, 0xEE, 0x1A,
+    0xF1, 0x44, 0x07, 0xB9, 0xAB, 0x72, 0x31, 0x44, 0x93, 0xFB, 0x7C, 0xCD, 0x74, 0x45, 0x2E, 0xBA,
+    0xCB, 0xF7, 0x0E, 0x1B, 0x03, 0x59, 0x16, 0x62, 0xCB, 0x7B, 0x59, 0x6E, 0x75, 0xD1, 0x66, 0x93,
+    0x1B, 0x26, 0x17, 0xDD, 0x6A, 0xB2, 0xCD, 0x72, 0x3F, 0x66, 0x32, 0xD9, 0x25, 0xB9, 0x28, 0x49,
+    0x7F, 0xC8, 0xDE, 0x42, 0x36, 0xB0, 0x7F, 0x6D, 0xF2, 0x49, 0x72, 0x51, 0x62, 0xFA, 0x63, 0x8A,
+    0x85, 0x8D, 0x1A, 0x1E, 0x15, 0xE1, 0x57, 0x53, 0x98, 0x87, 0x97, 0x7C, 0x8B, 0x73, 0xE0, 0x6D,
+    0x2E, 0x4B, 0xCF, 0xCD, 0x4D, 0xC7, 0x26, 0x70, 0x4B, 0x6D, 0xD8, 0xE4, 0xD8, 0x1A, 0xD8, 0x3B,
+    0xEA, 0x3D, 0x5B, 0x8F, 0x8D, 0xD4, 0x2D, 0x92, 0xBB, 0xCF, 0xEC, 0xCF, 0x48, 0x01, 0x72, 0xB8,
+    0x1C, 0x4A, 0x58, 0x8F, 0xA8, 0x3F, 0xA8, 0xC1, 0xC7, 0x16, 0x17, 0xDB, 0xEA, 0x56, 0x53, 0x86,
+    0x7D, 0xC8, 0x16, 0x36, 0x03, 0x8B, 0x42, 0x95, 0x9A, 0x49, 0xB0, 0x1B, 0xA8, 0x16, 0x8A, 0x5B,
+    0x87, 0x9D, 0x79, 0x7C, 0x51, 0xC5, 0x0F, 0x6B, 0xC8, 0x0E, 0x26, 0xE0, 0x4E, 0xBD, 0xC1, 0x0F,
+    0xF7, 0x06, 0xB7, 0x76, 0x99, 0xD9, 0xBD, 0x00, 0x7E, 0x08, 0xD9, 0x51, 0xA7, 0x40, 0xB9, 0xBE,
+    0x1F, 0xBE, 0x13, 0x66, 0xFD, 0xCE, 0x5B, 0x80, 0x5E, 0xCF, 0x60, 0x92, 0x7B, 0x18, 0xA2, 0x6A,
+    0x83, 0xBA, 0xBD, 0xCB, 0x1A, 0xD6, 0x21, 0xC9, 0x4F, 0x3E, 0xB6, 0xA5, 0x41, 0xFD, 0xD6, 0x65,
+    0xB9, 0x38, 0xA4, 0x06, 0xF9, 0x78, 0x72, 0xF9, 0x97, 0xFC, 0x05, 0xC0, 0xE3, 0xD7, 0xA0, 0xAC,
+    0x20, 0xD9, 0x97, 0x59, 0x72, 0x8F, 0x93, 0x84, 0x8F, 0xD7, 0xD9, 0xFB, 0x1A, 0x7D, 0x6D, 0x72,
+    0xC7, 0x9C, 0xBB, 0x34, 0x6C, 0x4C, 0xE3, 0x27, 0x59, 0xFE, 0x19, 0x9F, 0x5F, 0xAF, 0xAE, 0x91,
+    0x88, 0x5F, 0x25, 0x7E, 0xF6, 0x56, 0x04, 0x9A, 0x03, 0x3F, 0xDC, 0xD3, 0x8D, 0x49, 0x6E, 0xE9,
+    0x76, 0xD1, 0x20, 0x3F, 0xBB, 0xB5, 0xCF, 0xDD, 0xDE, 0x67, 0xB9, 0xC5, 0xCF, 0xA8, 0xA1, 0xDB,
+    0xDD, 0xAA, 0x3E, 0xFB, 0xBB, 0xF9, 0xF5, 0xFF, 0x51, 0x73, 0xFC, 0x1E, 0x8D, 0x80, 0xD4, 0xD5,
+    0xF0, 0x6C, 0x97, 0xF8, 0xC1, 0xEE, 0x17, 0xB9, 0xE4, 0xEF, 0xA0, 0xAE, 0x74, 0xBB, 0xDD, 0xC5,
+    0xEC, 0x67, 0xBF, 0xB8, 0xD4, 0xED, 0x86, 0xBE, 0xC8, 0xCF, 0x36, 0x4B, 0x52, 0xE0, 0x9E, 0x83,
+    0x6F, 0x41, 0xFE, 0x9A, 0xFC, 0x22, 0x53, 0x24, 0x17, 0xBF, 0x19, 0xB6, 0x86, 0xAC, 0x81, 0x4D,
+    0xEF, 0x86, 0x45, 0x2D, 0xD2, 0xF8, 0xE2, 0x5E, 0x87, 0x83, 0x8F, 0x61, 0x1F, 0x28, 0xD2, 0x2D,
+    0x85, 0xD9, 0x96, 0x30, 0x0F, 0x25, 0xCC, 0xAE, 0x84, 0xD9, 0x97, 0x30, 0x53, 0xC2, 0xF7, 0x6B,
+    0x09, 0x77, 0x5E, 0x96, 0x70, 0xF7, 0x45, 0x09, 0x6F, 0x7F, 0x5C, 0xC2, 0xED, 0x0F, 0x4B, 0x08,
+    0xA6, 0x84, 0x6A, 0x4A, 0xC8, 0xA6, 0x84, 0xDD, 0x94, 0x90, 0x4C, 0x09, 0xAB, 0x29, 0x6F, 0xFD,
+    0xE8, 0x0F, 0xE6, 0x3E, 0x8D, 0x4B, 0x57, 0x7C, 0x34, 0x30, 0x29, 0x94, 0xCF, 0x81, 0xC7, 0x57,
+    0xED, 0x3B, 0xCC, 0x5D, 0x0E, 0xB3, 0xDD, 0xC2, 0xEC, 0xD6, 0x30, 0x87, 0x18, 0xDE, 0x47, 0xE1,
+    0x4E, 0x51, 0x60, 0x57, 0x20, 0x1D, 0xE5, 0xB3, 0xA2, 0x70, 0x07, 0x85, 0xF7, 0x99, 0xC3, 0x1C,
+    0x96, 0x30, 0xBB, 0x14, 0x66, 0x9B, 0xC3, 0xDC, 0x97, 0x06, 0x90, 0x3F, 0xFE, 0x40, 0x52, 0x7F,
+    0xF9, 0xDD, 0xDC, 0x96, 0x06, 0x85, 0xC9, 0xC7, 0x71, 0x19, 0x52, 0x9F, 0xBA, 0x6C, 0x72, 0x83,
+    0x90, 0x8F, 0x2E, 0x0E, 0x69, 0x48, 0x5D, 0x3E, 0xD9, 0x1B, 0x5C, 0x91, 0xFF, 0x08, 0x0D, 0x2F,
+    0xEA, 0xEB, 0x6D, 0x22, 0xEC, 0xB2, 0x8C, 0xA8, 0xE3, 0x01, 0x4B, 0xCB, 0x67, 0xEC, 0x22, 0x87,
+    0x20, 0xCF, 0xF8, 0x78, 0x71, 0xE1, 0xC1, 0xCB, 0xDD, 0x7E, 0xF4, 0x59, 0xF1, 0xFD, 0x8B, 0x1C,
+    0xDE, 0xFE, 0x78, 0x63, 0xFC, 0xD7, 0x9C, 0xDD, 0x83, 0xCD, 0x07, 0xFB, 0x59, 0xB1, 0xDC, 0xCC,
+    0xE1, 0xDB, 0x44, 0xC6, 0xC5, 0xAF, 0xEE, 0xC1, 0x66, 0x37, 0xFB, 0x59, 0x69, 0xB3, 0xC9, 0x61,
+    0xEE, 0xAF, 0xAA, 0xC6, 0x57, 0xBB, 0xC2, 0xB3, 0xB5, 0x25, 0xCC, 0x7D, 0xAD, 0x1A, 0x5F, 0xD5,
+    0x53, 0x9E, 0x01, 0x01, 0x2A, 0xA7, 0xE1, 0x97, 0x6B, 0xAF, 0xC5, 0xE3, 0xA5, 0xAA, 0x0C, 0x2C,
+    0x16, 0xD2, 0xB8, 0x0D, 0xD9, 0x1D, 0x4B, 0x70, 0xC4, 0xED, 0x7C, 0x4D, 0xB1, 0xC5, 0x47, 0x53,
+    0xDD, 0x62, 0x8A, 0xDB, 0x8E, 0xB8, 0xED, 0xBE, 0x14, 0xB7, 0x01, 0xAE, 0x80, 0xA7, 0xC0, 0xD9,
+    0xC5, 0x7B, 0xF5, 0xFA, 0x95, 0x9E, 0xEE, 0x0A, 0x67, 0x6B, 0xFB, 0x3B, 0x44, 0x49, 0x0A, 0x7D,
+    0x55, 0xF0, 0x2C, 0x01, 0x52, 0xB8, 0xF0, 0x5B, 0x58, 0x6C, 0x0E, 0xB1, 0xCF, 0x21, 0x76, 0x39,
+    0xCC, 0xE6, 0xA0, 0xD8, 0x1D, 0xBA, 0xC5, 0xE6, 0x70, 0xE9, 0xB7, 0x00, 0x29, 0x04, 0x62, 0xB8,
+    0x8B, 0xC2, 0x7C, 0x4B, 0x61, 0xD6, 0xAF, 0xA5, 0xE3, 0x18, 0x6C, 0x37, 0x10, 0x61, 0x1F, 0xCB,
+    0x77, 0x4D, 0x3D, 0x50, 0x73, 0x96, 0x98, 0x65, 0x77, 0x29, 0x1C, 0x92, 0x5F, 0x65, 0x78, 0xF8,
+    0xD7, 0x03, 0xCC, 0x9E, 0x5D, 0x81, 0x49, 0x5F, 0x57, 0x80, 0x5F, 0x00, 0x8F, 0x80, 0x3F, 0x3D,
+    0xB9, 0x7C, 0x47, 0x6E, 0x7D, 0xE3, 0x10, 0xE0, 0xB7, 0x8A, 0x2E, 0xC9, 0xFD, 0x14, 0x75, 0xD9,
+    0xEE, 0x0A, 0x31, 0x44, 0xBB, 0x75, 0xB9, 0x41, 0x6E, 0x19, 0xD7, 0x06, 0x93, 0x8F, 0x5D, 0x34,
+    0x7C, 0x67, 0x53, 0x97, 0x91, 0xDC, 0xE3, 0x55, 0x0D, 0xE5, 0x1A, 0xA7, 0x86, 0x5D, 0xD7, 0x1B,
+    0x5F, 0xBA, 0x06, 0x6B, 0x3E, 0x1E, 0x63, 0x7C, 0xC0, 0x35, 0xB2, 0x65, 0x97, 0xEC, 0xE5, 0x17,
+    0xC8, 0xFC, 0x70, 0x32, 0x1F, 0x7F, 0x13, 0xDB, 0xC2, 0xA6, 0x16, 0xD8, 0x04, 0xB0, 0x8E, 0xBB,
+    0xBF, 0xCF, 0xCD, 0x6A, 0xB2, 0xCD, 0x3E, 0xBA, 0xE8, 0x1F, 0x64, 0x93, 0x4D, 0x09, 0xB3, 0x8B,
+    0xEE, 0xD1, 0x6E, 0xB2, 0x29, 0x21, 0xBA, 0xE8, 0xCE, 0xB3, 0xC9, 0x5D, 0x76, 0xAB, 0x8B, 0x7C,
+    0x9F, 0x1F, 0x64, 0x9F, 0x2C, 0x50, 0x35, 0x02, 0x93, 0x46, 0x98, 0x7F, 0xF7, 0xC0, 0xC7, 0x41,
+    0xD7, 0xDA, 0xD2, 0x67, 0x31, 0x33, 0x13, 0x87, 0xCD, 0xC7, 0x16, 0xB7, 0xCA, 0x91, 0xD4, 0x91,
+    0x8E, 0x8F, 0x71, 0x48, 0x23, 0x8B, 0x2C, 0x59, 0x76, 0x67, 0xEE, 0xF3, 0xB0, 0x99, 0xDA, 0x62,
+    0x90, 0xFB, 0x0F, 0xA6, 0xAE, 0x30, 0xDB, 0xCD, 0xAD, 0xA6, 0xD8, 0x5D, 0xDC, 0xAC, 0x72, 0xCB,
+    0xFF, 0x40, 0xF1, 0x77, 0x27, 0x97, 0x1E, 0x78, 0x06, 0xBC, 0x02, 0xAA, 0x0E, 0xB7, 0x18, 0x57,
+    0xA9, 0xDF, 0xA5, 0xC3, 0x01, 0xE5, 0xA2, 0xC9, 0x5F, 0xC0, 0x93, 0x83, 0x5C, 0x34, 0xC5, 0xAD,
+    0xA6, 0xB8, 0x7A, 0x56, 0x86, 0x03, 0x52, 0x17, 0x9D, 0xFD, 0x7D, 0x39, 0xD6, 0xE3, 0x4D, 0x0A,
+    0xB3, 0x4D, 0xA6, 0x84, 0x79, 0xF8, 0xAA, 0xCF, 0x87, 0xB7, 0x2F, 0xDE, 0x3B, 0x4E, 0xE7, 0xDE,
+    0x7C, 0xCE, 0x43, 0x32, 0xA5, 0xDF, 0x1B, 0xE4, 0x96, 0xAF, 0x2E, 0x3C, 0xBC, 0x7D, 0xF1, 0x5E,
+    0xFD, 0xCE, 0x97, 0xB1, 0xF7, 0x81, 0xC7, 0x8F, 0xC9, 0x18, 0x57, 0xE9, 0xF3, 0x99, 0x79, 0x43,
+    0x90, 0x02, 0x51, 0x2D, 0x48, 0x3D, 0x59, 0xBA, 0x71, 0x3B, 0x5D, 0xAF, 0x71, 0x03, 0xF7, 0xD4,
+    0xC1, 0xAE, 0x01, 0x76, 0xF9, 0x27, 0x21, 0x35, 0xC8, 0x2F, 0x5D, 0x16, 0xD3, 0x90, 0x4C, 0x91,
+    0x7F, 0xE8, 0x53, 0x03, 0xCC, 0xD7, 0x56, 0x75, 0x0A, 0xB3, 0x14, 0xCE, 0x56, 0xC9, 0x3D, 0xDD,
+    0x25, 0x7B, 0x55, 0x25, 0x53, 0xC3, 0x2C, 0x71, 0xC6, 0xA5, 0xDC, 0x53, 0x48, 0xF6, 0x0A, 0x30,
+    0x35, 0x3C, 0x64, 0xE5, 0x6C, 0xB5, 0xD9, 0x3D, 0xDD, 0x5B, 0xEC, 0x55, 0x55, 0xF8, 0xB0, 0x86,
+    0x87, 0x61, 0xE5, 0x0C, 0x92, 0x7B, 0x0A, 0x9B, 0xBD, 0x82, 0x7B, 0xA6, 0x86, 0x59, 0x6D, 0x3D,
+    0x96, 0x76, 0x5C, 0xA5, 0x30, 0xAB, 0xA5, 0xDE, 0xEB, 0x61, 0x1B, 0x61, 0x0B, 0x4F, 0xF8, 0xAC,
+    0x2A, 0x3C, 0xD8, 0x1B, 0xC6, 0xB5, 0xCF, 0xE1, 0x61, 0xF8, 0x0C, 0xF8, 0x0E, 0x6C, 0xE3, 0xF1,
+    0xED, 0x6F, 0xB1, 0x2B, 0xB0, 0x77, 0xB0, 0xFE, 0x49, 0x87, 0xAE, 0xD3, 0xC3, 0xDF, 0x9C, 0xE5,
+    0x1E, 0x62, 0x20, 0x37, 0xEF, 0x1E, 0xC9, 0xA2, 0xE1, 0x6F, 0xFF, 0x3C, 0x24, 0x28, 0x16, 0x66,
+    0xCF, 0xBD, 0x03, 0xC1, 0x49, 0xEA, 0x77, 0xF9, 0xAA, 0x30, 0x8F, 0xE4, 0x7E, 0xEF, 0x21, 0x85,
+    0x99, 0x7F, 0xE3, 0xEE, 0x3E, 0xA6, 0x3E, 0x87, 0x3B, 0x55, 0xEE, 0x51, 0x0D, 0x8B, 0x29, 0x81,
+    0x2C, 0xF7, 0x14, 0xA2, 0xA9, 0xE1, 0x69, 0x91, 0x7B, 0xB4, 0xBB, 0xC5, 0x94, 0xF0, 0x7D, 0xE4,
+    0x1F, 0xEC, 0xF6, 0x72, 0xDC, 0xC3, 0x1C, 0xA0, 0xDF, 0x5B, 0x58, 0xC2, 0xDC, 0xB1, 0x5E, 0x1F,
+    0xAC, 0xDC, 0xA6, 0x18, 0xA8, 0x3D, 0x54, 0x5B, 0x4C, 0x1D, 0xD2, 0x41, 0x76, 0x37, 0xD5, 0x42,
+    0x35, 0x50, 0x15, 0xA8, 0xE2, 0xC3, 0xDA, 0x62, 0xAA, 0xA9, 0xA6, 0xDA, 0x6C, 0xEA, 0x98, 0x4C,
+    0xF5, 0xAB, 0xA9, 0xCD, 0x8F, 0xBE, 0x29, 0xBB, 0x56, 0xB9, 0x0F, 0xB3, 0x8A, 0x5D, 0x5E, 0x67,
+    0x8E, 0x9E, 0x45, 0x90, 0x2C, 0xAC, 0x44, 0xFF, 0x71, 0x51, 0xF8, 0x87, 0xD4, 0x10, 0xBE, 0xC0,
+    0x28, 0xCF, 0x8E, 0x93, 0x92, 0x86, 0x59, 0x86, 0x7B, 0x7F, 0x68, 0x20, 0x77, 0x90, 0x5A, 0xEA,
+    0xA4, 0x6F, 0x48, 0xFF, 0x0D, 0xCD, 0xBD, 0x4D, 0x8C, 0x1E, 0x47, 0x9A, 0x26, 0xF6, 0x64, 0x86,
+    0x8A, 0x39, 0xC3, 0x74, 0x2B, 0x68, 0xA3, 0x6A, 0xB7, 0x67, 0x34, 0x66, 0xCE, 0x61, 0x0C, 0xCC,
+    0x6A, 0xBA, 0x3B, 0xE6, 0x30, 0x07, 0x0D, 0x40, 0x32, 0x52, 0x2D, 0xCC, 0x0A, 0x86, 0x0E, 0xAC,
+    0xC5, 0x56, 0xCD, 0xC0, 0x2B, 0x60, 0xA9, 0xC3, 0x1C, 0x76, 0xB4, 0x33, 0xC3, 0x86, 0x61, 0x03,
+    0x63, 0x40, 0x52, 0x24, 0x45, 0x2F, 0x74, 0xE8, 0x03, 0xE9, 0x43, 0xF7, 0x00, 0x5E, 0x18, 0x2D,
+    0x03, 0x3D, 0xB0, 0xFA, 0x13, 0x76, 0xD9, 0x06, 0x64, 0xA3, 0x67, 0x2D, 0x55, 0x04, 0x49, 0x03,
+    0x04, 0x96, 0x07, 0xA6, 0x44, 0x6B, 0x08, 0xAC, 0xB0, 0x56, 0x76, 0x4B, 0xDD, 0x1A, 0x90, 0x07,
+    0x86, 0xC4, 0xA4, 0x98, 0x55, 0x8C, 0x88, 0xC7, 0x87, 0xC8, 0xAF, 0xAA, 0xA8, 0xBF, 0x96, 0x5A,
+    0x3F, 0xEB, 0xAF, 0xF2, 0x37, 0x32, 0x33, 0xFE, 0x7F, 0xDE, 0x9F, 0xE7, 0x7D, 0xAB, 0x39, 0x1D,
+    0xCD, 0x5B, 0xB1, 0xE9, 0x80, 0xE2, 0x05, 0x75, 0x21, 0xE8, 0x8B, 0x79, 0x8B, 0xFA, 0x6A, 0xD4,
+    0xD7, 0x92, 0xF9, 0xE9, 0x06, 0x00, 0x88, 0x01, 0x98, 0x50, 0xD8, 0xB7, 0x2B, 0xF2, 0x39, 0xF2,
+    0x2A, 0x6F, 0xBC, 0xCB, 0xEE, 0x3E, 0xEB, 0xA0, 0x07, 0xC8, 0x09, 0x22, 0x02, 0xEC, 0xA0, 0x07,
+    0xD4, 0x01, 0x05, 0xDD, 0x6F, 0x68, 0xF2, 0x11, 0xB2, 0x57, 0xF4, 0x30, 0xEB, 0x90, 0x1D, 0xC4,
+    0x00, 0xAC, 0x03, 0x00, 0xD0, 0xF0, 0x2C, 0x2C, 0xC7, 0x82, 0xF4, 0x82, 0xFF, 0xF3, 0x20, 0x22,
+    0x50, 0x85, 0xBD, 0xFD, 0xF1, 0xB8, 0x09, 0x92, 0x2D, 0xC9, 0xF6, 0x5C, 0x5A, 0xB4, 0xFB, 0x9F,
+    0xD5, 0x13, 0xD0, 0x78, 0xC0, 0x5E, 0x5F, 0xBC, 0x40, 0x32, 0x2C, 0xF7, 0x5F, 0x43, 0xF9, 0xC8,
+    0xFB, 0xF1, 0x15, 0x4D, 0x0E, 0xE4, 0x24, 0x07, 0xF3, 0x70, 0x28, 0xA6, 0xA6, 0x93, 0xE7, 0x27,
+    0x04, 0xD9, 0xEB, 0x8E, 0x37, 0x47, 0x45, 0x5E, 0x24, 0xD3, 0xE1, 0x15, 0xD1, 0x01, 0xB0, 0x1D,
+    0x78, 0xDC, 0xC3, 0x5E, 0x48, 0xD0, 0xBD, 0x76, 0x8D, 0xAF, 0x47, 0x39, 0x82, 0x55, 0x80, 0x7A,
+    0x2D, 0x42, 0x04, 0x02, 0x96, 0x2D, 0x24, 0x1D, 0x04, 0x7B, 0x34, 0xA4, 0xAB, 0x48, 0x8F, 0x3F,
+    0x49, 0x1B, 0x80, 0x6D, 0x71, 0xD0, 0xEE, 0x74, 0x15, 0xE9, 0x41, 0x4E, 0x80, 0x6D, 0x01, 0xD5,
+    0x03, 0xF5, 0x08, 0x60, 0x6B, 0xEF, 0xF7, 0x67, 0xC0, 0x07, 0x03, 0xD6, 0x50, 0x71, 0x6A, 0x18,
+    0xF5, 0xEB, 0xC1, 0xE0, 0x3E, 0xDD, 0x41, 0x0F, 0x90, 0x6C, 0x25, 0xBD, 0x7A, 0x33, 0xE8, 0x22,
+    0x1A, 0x6C, 0xE9, 0x76, 0x4B, 0x0F, 0x49, 0x32, 0x94, 0x1C, 0xA1, 0x02, 0xCA, 0x04, 0xA4, 0x75,
+    0xA4, 0x67, 0xFE, 0x24, 0x1A, 0x4E, 0x8A, 0x3D, 0x36, 0xA0, 0x8A, 0xDB, 0x49, 0xDE, 0x99, 0xF4,
+    0xE5, 0xEE, 0xE9, 0x5C, 0xA9, 0x50, 0xEC, 0x00, 0x95, 0xD8, 0x41, 0xF6, 0x30, 0xAD, 0x18, 0x80,
+    0x57, 0xF0, 0x93, 0x03, 0x7C, 0xD6, 0x37, 0x05, 0x43, 0x7D, 0xBA, 0x7F, 0xA6, 0x68, 0x8F, 0x1C,
+    0x91, 0x0E, 0xE5, 0xB5, 0x6E, 0x04, 0x0E, 0xBF, 0xD4, 0x00, 0xC5, 0xDD, 0x87, 0x3D, 0x20, 0x5F,
+    0x6A, 0x80, 0xE2, 0x4E, 0x37, 0x02, 0x87, 0x8F, 0xC8, 0x0E, 0xE5, 0x55, 0xF7, 0x34, 0x70, 0x44,
+    0x09, 0x86, 0xDA, 0x8D, 0x35, 0x4F, 0xF9, 0x6A, 0x28, 0xF0, 0x34, 0x9A, 0x1E, 0xAA, 0x83, 0xBE,
+    0x6E, 0x7B, 0xE0, 0x24, 0x7B, 0x00, 0x2B, 0x39, 0x69, 0x3B, 0x36, 0xEC, 0xDF, 0xDE, 0x82, 0xF0,
+    0x96, 0xFA, 0xC6, 0x2D, 0xAF, 0x75, 0x7D, 0x8B, 0x6C, 0x6E, 0xFB, 0x55, 0x58, 0xF2, 0x0E, 0xC9,
+    0x37, 0x49, 0xFE, 0xD1, 0xE6, 0x66, 0x04, 0xCA, 0x11, 0xA8, 0x7B, 0x40, 0xB5, 0xC0, 0x2B, 0x40,
+    0xB1, 0xFE, 0xE0, 0xE2, 0x38, 0xAF, 0x72, 0x64, 0xFC, 0xC4, 0x72, 0xE8, 0x58, 0xFA, 0x46, 0x70,
+    0xAA, 0x4F, 0xF7, 0x47, 0xEB, 0xFE, 0xC8, 0x11, 0xD1, 0x1F, 0x2D, 0xAF, 0x75, 0x47, 0x45, 0x7F,
+    0xF8, 0x25, 0xD1, 0xBF, 0x5C, 0xDC, 0x6D, 0x35, 0x5B, 0xF9, 0x92, 0x60, 0x5F, 0xDC, 0xE9, 0x8E,
+    0x2A, 0x1C, 0x3E, 0x22, 0xFA, 0xA9, 0xBC, 0xEA, 0x8E, 0x56, 0xEE, 0x88, 0x12, 0xFD, 0xB1, 0xDA,
+    0x8D, 0x47, 0x8B, 0xDB, 0xBE, 0x1A, 0xF0, 0x49, 0xE5, 0x80, 0x26, 0xD3, 0x72, 0x07, 0xD0, 0x4C,
+    0x25, 0x43, 0x73, 0x63, 0x7A, 0x45, 0xDC, 0xF2, 0xF5, 0x15, 0xA7, 0xD4, 0xA9, 0xA0, 0xD9, 0x9B,
+    0x84, 0xDF, 0xEC, 0xF2, 0x37, 0x1A, 0x40, 0x00, 0x84, 0x07, 0xA4, 0x03, 0x34, 0x0E, 0xBE, 0x98,
+    0x16, 0x86, 0x8C, 0x24, 0x6F, 0x6F, 0xDA, 0xCD, 0xF6, 0xDE, 0xA7, 0x40, 0x00, 0x00, 0x70, 0xAF,
+    0x52, 0xDA, 0x03, 0xA9, 0x64, 0xD0, 0xEC, 0xFB, 0x04, 0x39, 0x14, 0x01, 0xBA, 0x93, 0x43, 0x35,
+    0x15, 0x09, 0x9A, 0xB7, 0x48, 0x4D, 0x7F, 0x20, 0x81, 0x2C, 0x77, 0x52, 0x51, 0x04, 0x54, 0xC3,
+    0x41, 0x42, 0x8F, 0x78, 0x71, 0x82, 0xF0, 0x90, 0x17, 0x7F, 0x41, 0xC9, 0x51, 0xB1, 0x05, 0x80,
+    0x4D, 0xD0, 0xB1, 0xB3, 0x9D, 0x69, 0xD7, 0x00, 0xB6, 0x15, 0x13, 0x14, 0x27, 0x58, 0x0E, 0x25,
+    0xD9, 0xD5, 0x1F, 0x7D, 0x4B, 0xFA, 0x8A, 0xBC, 0x6D, 0x98, 0x7F, 0x86, 0x37, 0x47, 0xCB, 0x3F,
+    0x82, 0x48, 0x80, 0x9C, 0x00, 0x3D, 0x00, 0xEC, 0x76, 0x6F, 0x01, 0x00, 0x05, 0x99, 0x6A, 0x32,
+    0x29, 0xC6, 0x67, 0x34, 0xA7, 0x63, 0x9A, 0xD3, 0x31, 0xF3, 0x11, 0xBB, 0xE6, 0x74, 0x4C, 0x71,
+    0x3A, 0x26, 0x39, 0x1D, 0x2B, 0x39, 0x1D, 0xC3, 0x7D, 0x3F, 0x39, 0x06, 0x7C, 0xDA, 0xFD, 0x4F,
+    0xFF, 0xD1, 0x8A, 0x88, 0xE6, 0x9D, 0xA4, 0xDD, 0x7A, 0xED, 0xE4, 0x50, 0x05, 0x84, 0x3F, 0x0E,
+    0x66, 0x32, 0x3D, 0x1E, 0x84, 0x76, 0xC6, 0xDB, 0xA0, 0x4C, 0x29, 0x9D, 0xF0, 0x08, 0xD0, 0xD8,
+    0xBD, 0x00, 0x50, 0x4F, 0x60, 0xAC, 0x7F, 0x11, 0x74, 0x39, 0x4E, 0xF5, 0xD5, 0xA1, 0x39, 0xEE,
+    0x5E, 0xD1, 0x8F, 0x7A, 0xCD, 0xCE, 0x8C, 0xB8, 0x0F, 0x78, 0x06, 0x08, 0x28, 0x13, 0xCA, 0x00,
+    0x99, 0x20, 0x3C, 0x74, 0x42, 0x3D, 0xE0, 0x9B, 0x5B, 0x68, 0x1C, 0xB0, 0x05, 0xDD, 0x01, 0x5B,
+    0x30, 0x00, 0xB6, 0x10, 0x01, 0x6C, 0x95, 0xA1, 0x7C, 0x1E, 0x5B, 0x62, 0x94, 0x1E, 0x5B, 0xB5,
+    0x57, 0x1E, 0x5B, 0xD2, 0x69, 0x8F, 0x3F, 0x53, 0xDD, 0x5D, 0x0F, 0x98, 0xF2, 0x96, 0x07, 0x92,
+    0xB8, 0xEA, 0x51, 0x04, 0x79, 0xDA, 0x43, 0x8C, 0xEA, 0xC5, 0x1D, 0xD4, 0x5E, 0x91, 0x90, 0xBD,
+    0x22, 0xA1, 0x1C, 0x84, 0x87, 0x06, 0x84, 0xCF, 0xA9, 0xC3, 0x76, 0xB0, 0x00, 0x07, 0x68, 0x80,
+    0x13, 0x54, 0xB7, 0x4C, 0x5E, 0x75, 0x72, 0x00, 0xEA, 0xA1, 0xF2, 0x40, 0x39, 0x89, 0x31, 0xA7,
+    0xFF, 0xC0, 0xF3, 0x50, 0x5D, 0x34, 0x6C, 0xEB, 0xC1, 0x2A, 0xFA, 0x72, 0xD2, 0xE5, 0xB3, 0x01,
+    0x7F, 0xA6, 0x3A, 0x18, 0xA0, 0x71, 0xD0, 0x1D, 0xE4, 0x00, 0xE5, 0x50, 0x79, 0xA8, 0x1E, 0x62,
+    0x84, 0xEA, 0x51, 0x06, 0x28, 0x07, 0x44, 0x28, 0x8E, 0xB0, 0x90, 0x8C, 0xD0, 0x10, 0xCC, 0x7D,
+    0x05, 0x78, 0x20, 0x02, 0x11, 0x86, 0x6D, 0x19, 0x70, 0xEC, 0xA4, 0xCB, 0x7D, 0xB4, 0x1E, 0x80,
+    0xA6, 0x6B, 0x1C, 0xEA, 0x04, 0xDD, 0x41, 0x46, 0x18, 0x60, 0xC5, 0x74, 0x11, 0x80, 0x3C, 0x1F,
+    0x0E, 0x9E, 0x6D, 0xE5, 0xD5, 0xB1, 0x19, 0xB6, 0xEC, 0x65, 0xAF, 0x07, 0xCB, 0xE3, 0x3D, 0x87,
+    0x07, 0x26, 0x75, 0xEA, 0xEE, 0x00, 0x18, 0xF1, 0xE6, 0x00, 0x24, 0x79, 0x66, 0x40, 0x11, 0x1A,
+    0x39, 0x40, 0x8C, 0xFA, 0xDC, 0x84, 0xCA, 0x6B, 0x46, 0xC8, 0x5E, 0x33, 0x42, 0x39, 0xC8, 0x01,
+    0xBA, 0x85, 0x1C, 0x00, 0x00, 0x09, 0x50, 0x23, 0x4A, 0xB6, 0x68, 0x3C, 0xF0, 0x2F, 0xB0, 0xFC,
+    0xD5, 0x3E, 0x3F, 0x1B, 0x50, 0x07, 0x08, 0xB6, 0x60, 0x0F, 0xED, 0x21, 0x02, 0x60, 0x1C, 0xAA,
+    0x80, 0x43, 0xFA, 0xF6, 0xC9, 0x8B, 0x64, 0x94, 0x64, 0xAF, 0xD8, 0xEF, 0x7E, 0x88, 0x32, 0x0A,
+    0x87, 0x92, 0x77, 0x3D, 0x0A, 0x72, 0x04, 0x5E, 0x6E, 0x26, 0xE0, 0x3E, 0x1C, 0x5A, 0x3E, 0x97,
+    0x04, 0x20, 0xD8, 0x03, 0x25, 0x27, 0x00, 0x24, 0x00, 0x7D, 0xB3, 0x07, 0xD4, 0x3B, 0x13, 0x20,
+    0x47, 0x02, 0x55, 0xD0, 0x3D, 0xCA, 0x54, 0x05, 0x80, 0x2D, 0x01, 0xE3, 0x74, 0x0F, 0xE5, 0xEB,
+    0x00, 0x99, 0x5E, 0x24, 0x2A, 0x92, 0x43, 0x49, 0x32, 0x80, 0x24, 0x61, 0x7A, 0xE8, 0x41, 0x7B,
+    0xC8, 0x20, 0x27, 0x14, 0x7C, 0x34, 0x02, 0xFA, 0x2D, 0x02, 0x32, 0x00, 0xAB, 0x00, 0x60, 0x07,
+    0x00, 0xC7, 0x5E, 0x01, 0x70, 0xB8, 0xEE, 0x80, 0xEA, 0xE2, 0x00, 0x80, 0x23, 0x00, 0x1D, 0x97,
+    0xB3, 0x9D, 0xA4, 0x07, 0x44, 0x8A, 0x40, 0x99, 0x4C, 0x07, 0xF0, 0xB8, 0x07, 0xCC, 0xC5, 0x08,
+    0xA8, 0xC1, 0x38, 0xC8, 0x51, 0x7A, 0x54, 0x41, 0x44, 0x94, 0x84, 0x75, 0xE0, 0x75, 0xEB, 0x61,
+    0xC8, 0x04, 0x45, 0xD2, 0x49, 0x92, 0xBE, 0x8A, 0x10, 0x49, 0x10, 0xA0, 0x63, 0x87, 0x66, 0x34,
+    0x3D, 0x44, 0xD2, 0x1E, 0xA0, 0x03, 0x14, 0x49, 0x8F, 0x82, 0x24, 0x1D, 0x6A, 0x92, 0x04, 0x34,
+    0xC9, 0x80, 0x32, 0x35, 0x1E, 0x80, 0xF4, 0xC6, 0x01, 0xB0, 0xA7, 0x08, 0x40, 0xC4, 0x2A, 0x00,
+    0x68, 0x7C, 0xB3, 0xB3, 0x38, 0x0B, 0xB6, 0x86, 0xEC, 0xAA, 0x50, 0x90, 0x09, 0x6A, 0xA8, 0xC8,
+    0x29, 0x67, 0x00, 0x35, 0x49, 0x97, 0x23, 0x02, 0x72, 0x95, 0x40, 0x8E, 0x68, 0x3C, 0x60, 0x1C,
+    0xCC, 0xF5, 0xC5, 0xE9, 0x84, 0x82, 0x64, 0xE3, 0x51, 0x91, 0x81, 0x1D, 0x1A, 0xD2, 0x57, 0x4C,
+    0x1D, 0x2A, 0x32, 0xA2, 0x22, 0xD9, 0x55, 0x24, 0x87, 0x2A, 0xC0, 0x8E, 0x55, 0x40, 0x13, 0xAA,
+    0x80, 0x3A, 0x56, 0x01, 0x55, 0xAA, 0x03, 0x44, 0x32, 0x0C, 0x82, 0xBB, 0x87, 0xF4, 0x7B, 0xE9,
+    0x87, 0x22, 0x55, 0x01, 0x55, 0xAC, 0x02, 0xEA, 0xB0, 0xFC, 0xC2, 0x8E, 0x55, 0x3A, 0xC7, 0x61,
+    0x19, 0x5F, 0x44, 0x45, 0x9E, 0x5D, 0xCE, 0x56, 0xA9, 0x1C, 0x50, 0x70, 0x67, 0x04, 0xC8, 0x00,
+    0x1C, 0xAD, 0x03, 0xB0, 0xB2, 0xD7, 0x25, 0x14, 0x07, 0xC0, 0x92, 0x1D, 0x2C, 0x19, 0x60, 0xD3,
+    0x39, 0x76, 0x7A, 0x84, 0xF1, 0x6A, 0x42, 0x95, 0x64, 0x00, 0x78, 0x31, 0x01, 0xEA, 0x5D, 0xB6,
+    0xA8, 0xA2, 0xE9, 0x51, 0xF0, 0xC4, 0x08, 0x98, 0x6B, 0x11, 0x68, 0x6E, 0xB3, 0x45, 0x15, 0xF5,
+    0x80, 0x92, 0x32, 0x00, 0xBC, 0xC0, 0x16, 0x66, 0xD0, 0x23, 0x8C, 0xAF, 0xF9, 0x0B, 0x4E, 0x20,
+    0x19, 0x50, 0x93, 0x13, 0x70, 0x92, 0x6F, 0x03, 0x58, 0x03, 0xB0, 0x82, 0xB2, 0x18, 0xF1, 0xB2,
+    0xEE, 0xD5, 0xC0, 0xC7, 0x26, 0xC1, 0x04, 0x39, 0x93, 0x4E, 0x6C, 0x4B, 0x46, 0xD8, 0x33, 0xA3,
+    0x1A, 0xF4, 0x6B, 0x13, 0xE2, 0x41, 0x88, 0x79, 0xB8, 0xE2, 0x2C, 0x4A, 0xA6, 0x67, 0x50, 0x93,
+    0x6C, 0x6B, 0x92, 0xAE, 0xE6, 0x75, 0x4E, 0x82, 0xAD, 0x64, 0xC9, 0xAE, 0xE6, 0x40, 0x57, 0x31,
+    0xE8, 0x41, 0xBC, 0xCF, 0x66, 0x2C, 0x27, 0x73, 0x2D, 0x16, 0xA1, 0xB9, 0xCD, 0x36, 0x56, 0xD1,
+    0xF4, 0x5B, 0x05, 0x4F, 0x8C, 0x06, 0xE6, 0x6A, 0xD2, 0xAD, 0xF2, 0xBC, 0xD9, 0xC9, 0xA0, 0xE8,
+    0xAA, 0x24, 0xD8, 0x57, 0x84, 0x4D, 0x27, 0xD9, 0x49, 0x92, 0x4E, 0x90, 0xEC, 0xCA, 0x1D, 0xA6,
+    0x16, 0xDF, 0x28, 0xD6, 0x77, 0x87, 0xD5, 0xCA, 0x06, 0x00, 0xD3, 0x03, 0x22, 0x02, 0xD0, 0x0E,
+    0x10, 0x13, 0x80, 0x95, 0x39, 0x6F, 0xCA, 0xA3, 0x0E, 0x66, 0x80, 0x1E, 0xE8, 0x4A, 0x82, 0xAD,
+    0x1C, 0x4B, 0xC2, 0x3A, 0x11, 0x45, 0x44, 0x1D, 0x94, 0x87, 0x1C, 0xD9, 0x42, 0xDD, 0x0D, 0x80,
+    0xA6, 0x03, 0x4C, 0x02, 0x40, 0x0F, 0x14, 0xEC, 0xE6, 0x48, 0xE5, 0x08, 0x40, 0xF7, 0x00, 0xD8,
+    0x7E, 0x54, 0x90, 0x71, 0x28, 0x98, 0x49, 0xC0, 0x66, 0xE7, 0x87, 0x30, 0xE4, 0xC3, 0x24, 0x1F,
+    0x25, 0xD9, 0xF8, 0x3A, 0x19, 0x27, 0x23, 0xA1, 0xEE, 0x04, 0x98, 0x37, 0x7D, 0x49, 0xE3, 0xD4,
+    0x36, 0xCF, 0xF1, 0x12, 0x99, 0x1A, 0xB2, 0x37, 0x7C, 0x7B, 0xF7, 0xDB, 0xDC, 0x37, 0x81, 0xA2,
+    0x05, 0x1A, 0x4E, 0x90, 0xE4, 0x28, 0x48, 0x3A, 0x33, 0x36, 0x51, 0x06, 0xE8, 0x81, 0x9D, 0x88,
+    0x72, 0x82, 0x75, 0xEC, 0xD4, 0x28, 0x27, 0x19, 0xC1, 0x67, 0x09, 0x39, 0x69, 0x0F, 0x9E, 0x66,
+    0x27, 0xA7, 0x86, 0x2D, 0x3B, 0x93, 0xE4, 0x04, 0x4E, 0xEC, 0x0A, 0x5E, 0x99, 0x50, 0x45, 0x76,
+    0xD0, 0x6F, 0x4E, 0x4F, 0xD4, 0x91, 0xCF, 0x91, 0x57, 0x26, 0xC3, 0x91, 0xA7, 0x19, 0xB1, 0x24,
+    0x79, 0xC5, 0x54, 0x3B, 0x9D, 0xB6, 0x4A, 0xD2, 0xCB, 0x53, 0x6C, 0x57, 0xE7, 0x60, 0xCB, 0x4E,
+    0x92, 0x4E, 0x91, 0xEE, 0x0F, 0x4B, 0xE6, 0x72, 0xCB, 0xB1, 0xB0, 0xEC, 0x49, 0x1E, 0xE7, 0x8D,
+    0x68, 0x7B, 0x79, 0x87, 0xD0, 0x6F, 0x4E, 0x05, 0x4F, 0x8E, 0x4D, 0x34, 0xE4, 0x48, 0xBE, 0xD9,
+    0xDB, 0x49, 0xB7, 0xAB, 0x73, 0x0B, 0xB0, 0x47, 0x7D, 0xD3, 0xE1, 0xA8, 0x6C, 0x31, 0x1E, 0x45,
+    0x79, 0xD7, 0xA3, 0x64, 0xBB, 0x4C, 0xB7, 0xE6, 0x04, 0x32, 0x94, 0x64, 0x10, 0x67, 0x95, 0xCF,
+    0xF5, 0xC9, 0xF6, 0x01, 0x46, 0x49, 0x8E, 0x4C, 0xF6, 0x8D, 0x08, 0x1A, 0x2F, 0x22, 0xBB, 0xE6,
+    0x7D, 0x3E, 0xCC, 0x6B, 0x24, 0x8F, 0x33, 0xC6, 0x9A, 0xA7, 0xC7, 0xA2, 0xDD, 0xED, 0x00, 0x96,
+    0xDF, 0xE6, 0x00, 0xF2, 0x2E, 0xD9, 0x2A, 0x92, 0x1C, 0x45, 0xA7, 0x52, 0x49, 0x40, 0x24, 0x68,
+    0x07, 0xB0, 0xAD, 0xC7, 0x03, 0x96, 0x79, 0x4E, 0x26, 0x79, 0x86, 0x2F, 0x92, 0xBC, 0x11, 0xC1,
+    0x16, 0x25, 0x73, 0xAA, 0x9D, 0x0A, 0x80, 0xF2, 0x0D, 0xDD, 0x81, 0xE7, 0xC8, 0x9B, 0xE4, 0x40,
+    0xFE, 0x94, 0x9C, 0x6A, 0xF6, 0x35, 0x27, 0xDC, 0xB7, 0x47, 0x85, 0x1D, 0x2D, 0x1D, 0xCC, 0xCD,
+    0x01, 0x8A, 0x0E, 0x92, 0x80, 0x61, 0x07, 0x63, 0x7A, 0xFC, 0x41, 0xE3, 0x81, 0x7A, 0x82, 0xBD,
+    0x13, 0x2A, 0x32, 0x36, 0x64, 0xD2, 0x63, 0x93, 0x4C, 0x2F, 0x68, 0x9C, 0xA0, 0x75, 0x25, 0xAD,
+    0x2B, 0x93, 0x71, 0x22, 0xE9, 0x5E, 0x04, 0x3D, 0xCA, 0x20, 0x33, 0x81, 0xD3, 0xC3, 0xA6, 0xDC,
+    0xE8, 0x00, 0x60, 0x5B, 0x5F, 0xF2, 0xAE, 0x17, 0x64, 0x5F, 0x9F, 0x67, 0x57, 0xE0, 0xBE, 0x39,
+    0x3C, 0x41, 0x90, 0xBD, 0x24, 0xBD, 0x9A, 0x9A, 0xA0, 0x87, 0x2A, 0x1A, 0x27, 0x92, 0x75, 0x22,
+    0xCD, 0x71, 0xD3, 0x3A, 0x91, 0xE3, 0x1F, 0xAA, 0xA8, 0xA6, 0x26, 0xCC, 0xFD, 0x67, 0x2F, 0xFE,
+    0x02, 0x80, 0x01, 0xCA, 0x98, 0xD7, 0xB1, 0xBA, 0xCB, 0xCD, 0x40, 0xCE, 0x54, 0xE1, 0xB8, 0xB9,
+    0xB9, 0xD9, 0x62, 0x1D, 0xA8, 0x7C, 0x66, 0x19, 0x2C, 0x80, 0x97, 0x00, 0x00, 0x2D, 0x6C, 0xF2,
+    0x82, 0xF4, 0x92, 0xF4, 0x6A, 0xDB, 0x4C, 0x7A, 0xD0, 0xC1, 0x38, 0x1B, 0xED, 0x79, 0x26, 0x7B,
+    0xF1, 0xBD, 0x64, 0x2F, 0xBF, 0x96, 0xEC, 0x9B, 0x17, 0x93, 0xA1, 0x88, 0x3A, 0x56, 0x41, 0x45,
+    0x15, 0x64, 0x7E, 0xBF, 0x6F, 0x98, 0x50, 0xED, 0x36, 0xD9, 0xDA, 0x3A, 0xD0, 0x4C, 0x99, 0x68,
+    0x93, 0x63, 0xCE, 0xCA, 0x3C, 0xA0, 0x45, 0x82, 0x88, 0xC6, 0x15, 0x94, 0x23, 0xEC, 0x05, 0xCE,
+    0xDC, 0x8F, 0x1C, 0xEB, 0xA9, 0xA0, 0x08, 0xD0, 0xE7, 0x89, 0x7A, 0xB4, 0x2D, 0x92, 0x76, 0xD0,
+    0x6F, 0x0E, 0xA8, 0xEE, 0x8E, 0x00, 0x03, 0xA0, 0x12, 0x20, 0x88, 0xBC, 0xA2, 0xE8, 0x3E, 0x0F,
+    0x26, 0x39, 0xA1, 0x3C, 0x17, 0x00, 0x26, 0x40, 0x27, 0x40, 0x6E, 0xCF, 0x39, 0x60, 0xF7, 0x31,
+    0xFB, 0x77, 0x13, 0x68, 0xE9, 0x48, 0x7A, 0xDE, 0x36, 0x23, 0x9D, 0x9C, 0xE8, 0xEA, 0xC0, 0xAE,
+    0x0E, 0xEC, 0xAA, 0x79, 0xAF, 0x03, 0x5D, 0x1D, 0xE8, 0xE4, 0xC4, 0xDB, 0x66, 0x24, 0xE9, 0x69,
+    0xE9, 0x78, 0x3C, 0x81, 0xDD, 0xFA, 0xC7, 0xC6, 0x5D, 0x4C, 0x75, 0x07, 0x56, 0x23, 0xF4, 0xF9,
+    0x08, 0xD1, 0x7F, 0x6B, 0xB7, 0xFF, 0xCA, 0x09, 0xF2, 0x36, 0x51, 0x05, 0xDD, 0x97, 0xAC, 0x03,
+    0xD8, 0x12, 0xC6, 0xE9, 0x5E, 0x0D, 0x55, 0x90, 0x7E, 0x8F, 0xEB, 0x9B, 0x08, 0xD0, 0x74, 0x68,
+    0x6E, 0xF6, 0x10, 0xF4, 0x80, 0x9D, 0xF2, 0x4A, 0x9E, 0xCB, 0xDD, 0xE6, 0xC9, 0x43, 0x0F, 0x38,
+    0x68, 0x3D, 0x04, 0x27, 0x80, 0x13, 0xA0, 0xDF, 0x06, 0x80, 0xDF, 0x5C, 0xFC, 0x10, 0x90, 0x24,
+    0x20, 0x48, 0x07, 0x6C, 0x6E, 0xEE, 0x4E, 0xA0, 0xF4, 0x5F, 0xE1, 0x6A, 0x5F, 0x2E, 0x16, 0xAD,
+    0x64, 0x82, 0xE6, 0x84, 0xCD, 0xCD, 0xF6, 0x0B, 0x99, 0x05, 0x56, 0xB1, 0x06, 0xC8, 0x4E, 0x3A,
+    0x94, 0xB4, 0x3D, 0xA0, 0x39, 0x00, 0x82, 0xC3, 0x3E, 0xCE, 0xE9, 0x2B, 0x26, 0xAE, 0x56, 0xDA,
+    0x62, 0xBD, 0x69, 0x9B, 0x56, 0xDF, 0x08, 0x30, 0xEC, 0x61, 0xE2, 0x1E, 0x33, 0xFA, 0x39, 0x27,
+    0x55, 0x41, 0xB7, 0xA4, 0xD0, 0x6C, 0xC2, 0xBC, 0x64, 0xC9, 0xBB, 0x23, 0x50, 0x6F, 0x27, 0x40,
+    0x44, 0xED, 0x50, 0x50, 0x8E, 0x33, 0xB9, 0xA4, 0x7B, 0xED, 0xD0, 0x78, 0x39, 0xA2, 0x0E, 0x25,
+    0x21, 0xB8, 0xA0, 0x2B, 0x48, 0x4E, 0xB0, 0x24, 0xA1, 0x49, 0xBA, 0x66, 0x84, 0x9C, 0x64, 0x80,
+    0xA0, 0x48, 0x80, 0x79, 0x95, 0x2D, 0xE4, 0x44, 0x97, 0xBB, 0x15, 0x9E, 0x01, 0x80, 0x63, 0x00,
+    0xA0, 0x80, 0xCC, 0x2A, 0xCE, 0x99, 0x30, 0x1E, 0x40, 0xF9, 0xF6, 0xE7, 0x6F, 0xC3, 0xA6, 0x45,
+    0x31, 0xED, 0x71, 0xA1, 0x1C, 0x50, 0xD0, 0xA1, 0xF8, 0x5B, 0xA0, 0xD8, 0x04, 0x4A, 0xE6, 0xBD,
+    0x48, 0x99, 0x2A, 0xCF, 0x84, 0x2B, 0x80, 0x07, 0xF8, 0x36, 0x0C, 0xD9, 0x19, 0xB2, 0x37, 0xE9,
+    0x9C, 0xD7, 0x13, 0x56, 0x9B, 0xE5, 0x90, 0x48, 0xCB, 0x21, 0x31, 0x4F, 0x05, 0x55, 0x04, 0x0A,
+    0xB6, 0x99, 0x69, 0x94, 0x01, 0x79, 0x1D, 0xD2, 0x23, 0xEE, 0xAB, 0xF9, 0x73, 0x8B, 0x4C, 0xB3,
+    0xD0, 0xE3, 0x24, 0xC7, 0x4C, 0x07, 0x61, 0xAD, 0x85, 0x9C, 0x20, 0x12, 0x60, 0x5B, 0x28, 0xB7,
+    0x9C, 0xA1, 0x2A, 0x8E, 0x82, 0x74, 0xE4, 0xA4, 0xE2, 0xE3, 0x82, 0x80, 0xE9, 0x51, 0x07, 0xC0,
+    0xBA, 0xE5, 0xA9, 0x0A, 0x80, 0x1E, 0x20, 0xF8, 0xFA, 0xCB, 0x92, 0x74, 0x86, 0x01, 0x36, 0xE5,
+    0x6C, 0x6F, 0xE6, 0xE2, 0x81, 0x11, 0xB0, 0x27, 0x7B, 0xD8, 0x22, 0x62, 0x6D, 0xD9, 0x35, 0xBE,
+    0xDC, 0xF2, 0xAC, 0xAD, 0xA3, 0x62, 0x0B, 0x06, 0xE8, 0x2B, 0x5E, 0x0E, 0xCA, 0xAD, 0x63, 0xE3,
+    0x73, 0x97, 0x07, 0x00, 0x74, 0x07, 0x28, 0x9F, 0x29, 0x18, 0xA4, 0x3D, 0x76, 0xE7, 0xCB, 0x6E,
+    0x1F, 0xA0, 0x88, 0x80, 0xF6, 0x10, 0x04, 0x9A, 0x5D, 0x3E, 0xEB, 0xF3, 0x94, 0x67, 0x03, 0x6B,
+    0x50, 0x4E, 0xB9, 0x32, 0x6A, 0x07, 0x35, 0x0B, 0xD7, 0xB0, 0xB6, 0xFE, 0x15, 0x94, 0x67, 0xA5,
+    0x2D, 0xD6, 0x53, 0x91, 0x44, 0xB0, 0x9D, 0xE4, 0x00, 0x13, 0x50, 0x6C, 0x7E, 0xDE, 0xF2, 0x14,
+    0xEB, 0xD8, 0x80, 0x72, 0xBA, 0x03, 0x4F, 0x78, 0x08, 0x86, 0x79, 0x1A, 0x5C, 0x6B, 0xE7, 0x98,
+    0xD3, 0x59, 0x58, 0xB2, 0xAF, 0x49, 0x76, 0x96, 0x4C, 0x75, 0x80, 0x1D, 0xAD, 0x2B, 0x78, 0x39,
+    0xA0, 0x8E, 0xD6, 0xC1, 0xDC, 0x08, 0x10, 0xC9, 0x3A, 0xE8, 0xBB, 0x01, 0x82, 0xD6, 0x41, 0x2F,
+    0x43, 0xCC, 0x1B, 0x01, 0x75, 0x98, 0x5F, 0xB6, 0xA3, 0xBD, 0xCE, 0xB4, 0x8C, 0xA7, 0xAF, 0xF7,
+    0x38, 0x1C, 0x40, 0xBF, 0x16, 0x01, 0x11, 0x95, 0x03, 0xF4, 0xD5, 0x11, 0x10, 0x51, 0x03, 0xD0,
+    0xAF, 0xCD, 0xC4, 0x75, 0x13, 0x75, 0x8F, 0x9A, 0x77, 0x22, 0x0A, 0x92, 0x3D, 0xF4, 0xF6, 0xC9,
+    0x08, 0x91, 0x60, 0x7B, 0x18, 0x27, 0x22, 0xEA, 0x00, 0xDD, 0xC3, 0x7E, 0xE0, 0xB2, 0x0A, 0xD0,
+    0x3D, 0xF4, 0x50, 0x45, 0x08, 0x7E, 0x3F, 0x8B, 0x40, 0x23, 0x60, 0x79, 0xB2, 0x47, 0xC9, 0x57,
+    0x23, 0x80, 0x36, 0x17, 0xF1, 0xAB, 0x64, 0xE7, 0xA0, 0x67, 0x36, 0xC4, 0x30, 0xA2, 0x26, 0x07,
+    0x58, 0xA6, 0x1C, 0xD2, 0xEA, 0xBE, 0xE4, 0x5B, 0x11, 0x96, 0xB6, 0x57, 0x64, 0x14, 0xFC, 0x3E,
+    0x7B, 0xE3, 0xEB, 0x58, 0x45, 0xE8, 0xDE, 0x3A, 0x11, 0xEB, 0x00, 0xDD, 0xDB, 0x5E, 0xE4, 0x10,
+    0xE3, 0xAB, 0x28, 0xF8, 0x3D, 0xF6, 0x8A, 0x8C, 0x20, 0x4D, 0x5F, 0xF2, 0x42, 0x04, 0x5A, 0xE0,
+    0xE0, 0xE2, 0x47, 0x82, 0xEC, 0xC8, 0x61, 0x6D, 0x73, 0x1D, 0x40, 0x43, 0xBE, 0x43, 0x6E, 0x93,
+    0xC9, 0x90, 0x27, 0x3C, 0xAA, 0x80, 0x82, 0x80, 0x71, 0x68, 0x76, 0x16, 0xCF, 0x91, 0xEF, 0x92,
+    0xC1, 0x64, 0x46, 0x77, 0xEF, 0x89, 0x47, 0x95, 0x16, 0x7F, 0x93, 0xBF, 0xF9, 0x01, 0x39, 0x94,
+    0x8B, 0x45, 0x2B, 0xC8, 0x4E, 0x90, 0x5D, 0xB1, 0xB9, 0x39, 0x2F, 0x56, 0x11, 0x22, 0x2F, 0xEA,
+    0x5E, 0x8D, 0xCD, 0xA8, 0xFB, 0x2A, 0x18, 0x27, 0x82, 0x25, 0xF7, 0x76, 0xB7, 0x4B, 0x76, 0x40,
+    0x4D, 0xF8, 0xB1, 0x24, 0xBD, 0x20, 0x3D, 0x2C, 0x7B, 0x60, 0x1D, 0x6B, 0x58, 0x79, 0xD4, 0x55,
+    0x3D, 0xCF, 0xF9, 0x86, 0x63, 0xC1, 0x31, 0x93, 0xB9, 0xC5, 0x6E, 0xC2, 0xEF, 0x90, 0xB7, 0xF7,
+    0xB2, 0x14, 0x50, 0x70, 0xF1, 0x82, 0x21, 0x1B, 0xF2, 0x12, 0xF9, 0xEE, 0xBD, 0x4F, 0x00, 0x73,
+    0x7D, 0x71, 0x62, 0xB7, 0xB4, 0x2B, 0x6D, 0xB1, 0x5E, 0xF5, 0x55, 0x2F, 0x92, 0x75, 0x05, 0xD9,
+    0xC2, 0xC4, 0x7D, 0x54, 0xF4, 0xE7, 0xCF, 0x3A, 0x00, 0xC8, 0x01, 0x75, 0x40, 0xC9, 0x3C, 0xCD,
+    0xE1, 0x8B, 0xCA, 0xFA, 0x32, 0x6E, 0x28, 0x9F, 0xF7, 0x59, 0xE8, 0xF4, 0x45, 0x65, 0x7D, 0x37,
+    0x83, 0xDB, 0x64, 0xFC, 0x60, 0x36, 0x96, 0x19, 0x64, 0xB8, 0xF7, 0x89, 0x43, 0xB3, 0xB3, 0xF8,
+    0xEB, 0xDD, 0x9E, 0xD4, 0xA1, 0x69, 0xD1, 0xB4, 0x90, 0x0E, 0xC2, 0x03, 0x1C, 0xA0, 0x26, 0x14,
+    0x7F, 0xFB, 0xB9, 0xB3, 0x68, 0x38, 0x00, 0x27, 0xBB, 0xBC, 0xD6, 0xBF, 0x3C, 0x4B, 0x9D, 0xF9,
+    0x7C, 0xA6, 0x27, 0x9A, 0x61, 0x0D, 0x2B, 0xDF, 0x0E, 0x62, 0x92, 0xB7, 0x13, 0x34, 0x1D, 0xE8,
+    0x51, 0xCC, 0xEB, 0x14, 0x27, 0x43, 0x3E, 0x97, 0x4F, 0x8F, 0xEE, 0x8A, 0xDB, 0x60, 0x1C, 0xAA,
+    0xB4, 0x78, 0xDE, 0x90, 0x15, 0xE9, 0x0D, 0x59, 0xDD, 0xFB, 0x2C, 0x00, 0xE6, 0xFA, 0xE2, 0xD1,
+    0xBD, 0xCF, 0x57, 0xDA, 0x62, 0xBD, 0xF6, 0xD2, 0x97, 0xD1, 0x38, 0x90, 0x80, 0x0E, 0xC0, 0xCA,
+    0xFA, 0x17, 0xD8, 0x6F, 0x36, 0x5B, 0xA0, 0x89, 0xC8, 0x54, 0x3A, 0xB5, 0x83, 0xEE, 0x2C, 0x8A,
+    0xF5, 0xA5, 0xD0, 0x42, 0xF1, 0x6D, 0x28, 0x72, 0x90, 0x64, 0x10, 0xDC, 0xB1, 0x8E, 0x23, 0x56,
+    0x9B, 0x90, 0xC9, 0x1C, 0x68, 0x3F, 0x8B, 0x18, 0x4C, 0xFF, 0x9B, 0x8B, 0xFF, 0x2D, 0x16, 0xA4,
+    0xE9, 0x1B, 0xDE, 0x8A, 0x05, 0xA9, 0x07, 0xA8, 0x5B, 0x44, 0x49, 0x35, 0x42, 0x79, 0xF6, 0x25,
+    0x6B, 0xFE, 0xDC, 0x7A, 0x4D, 0x12, 0x96, 0xF4, 0x85, 0xE5, 0xDB, 0xB3, 0x14, 0x67, 0x3D, 0x17,
+    0xCB, 0x26, 0x94, 0xD1, 0xB4, 0xD5, 0xD8, 0xF4, 0x2B, 0x6D, 0x4E, 0xBF, 0xE0, 0xAB, 0xB1, 0xE6,
+    0x4E, 0x6C, 0xC8, 0xA8, 0xB7, 0x4F, 0x46, 0x3D, 0xD4, 0xD1, 0x38, 0x11, 0xED, 0x07, 0x76, 0xE3,
+    0x44, 0xD4, 0x43, 0x15, 0xF5, 0xD4, 0xC4, 0x86, 0x8C, 0x35, 0xEF, 0xC6, 0x92, 0x57, 0x23, 0xEE,
+    0xCB, 0x2A, 0xB1, 0x43, 0x90, 0x41, 0xFD, 0x8D, 0x9D, 0x14, 0xE9, 0x15, 0xE9, 0x0E, 0x70, 0x1B,
+    0x58, 0xC3, 0x0A, 0x4A, 0x5F, 0x8C, 0x90, 0x77, 0x09, 0x58, 0xF6, 0x28, 0xE8, 0x77, 0x05, 0x0D,
+    0x5F, 0x45, 0xD1, 0x8B, 0xB6, 0x58, 0x17, 0xBD, 0x18, 0x04, 0x6D, 0x0F, 0xB2, 0x83, 0xDE, 0x9B,
+    0x15, 0xBE, 0xD4, 0xA2, 0xCF, 0xA2, 0x14, 0x00, 0xD6, 0x01, 0x75, 0x00, 0xA0, 0xDB, 0x7D, 0xE4,
+    0xD0, 0x57, 0xD0, 0xEA, 0x00, 0x20, 0x3D, 0xD0, 0x8C, 0x79, 0xAF, 0xF7, 0x66, 0x95, 0x2F, 0xBF,
+    0xE8, 0x5F, 0x51, 0xF9, 0xA0, 0x1D, 0x50, 0x8D, 0xC8, 0xB2, 0x09, 0xE9, 0x80, 0x4C, 0xC7, 0x6E,
+    0x00, 0xC5, 0x04, 0x88, 0x31, 0x0B, 0x2F, 0xA4, 0xDF, 0x1D, 0xD3, 0x5F, 0x6A, 0xD1, 0x8B, 0x0D,
+    0x00, 0xD6, 0x67, 0xE6, 0xB9, 0xBA, 0x9D, 0x50, 0xC4, 0x6A, 0xC4, 0xDA, 0x2C, 0x7E, 0xAC, 0x02,
+    0xCA, 0x64, 0x1C, 0xD4, 0x3B, 0x9F, 0x70, 0x91, 0x16, 0x2F, 0x26, 0x43, 0xF2, 0x1D, 0xE6, 0x89,
+    0x97, 0xEF, 0x7C, 0x9A, 0xAF, 0x02, 0xCA, 0x84, 0xCD, 0x16, 0xA8, 0x08, 0x40, 0x13, 0x59, 0x40,
+    0xA0, 0x3B, 0x02, 0x33, 0x69, 0x8F, 0x3C, 0x47, 0x81, 0xDD, 0x4C, 0xA0, 0xCA, 0xE9, 0x9E, 0xA0,
+    0xA8, 0x22, 0xE4, 0x1D, 0x26, 0x68, 0x32, 0x82, 0xDB, 0x66, 0x12, 0x6C, 0xB5, 0x97, 0x01, 0xD6,
+    0xE9, 0xA1, 0x24, 0xD8, 0xD5, 0x41, 0x24, 0x28, 0x2F, 0xA7, 0x5F, 0x12, 0x54, 0x05, 0x94, 0x09,
+    0x8D, 0x87, 0x9C, 0x60, 0x1C, 0xF4, 0xA0, 0xC9, 0x2C, 0x52, 0xCA, 0xCA, 0x44, 0xB2, 0x37, 0x0E,
+    0x7A, 0x28, 0x08, 0xB0, 0xAB, 0xD2, 0xE2, 0xC5, 0x84, 0x86, 0xE4, 0x04, 0x43, 0x72, 0x28, 0x48,
+    0xB2, 0xAB, 0x02, 0xC4, 0x3D, 0x91, 0xCC, 0x6F, 0x7F, 0x52, 0x30, 0x00, 0x94, 0x29, 0xAB, 0xCC,
+    0x45, 0xD6, 0x78, 0x07, 0x68, 0x12, 0xB0, 0x1D, 0xA0, 0x86, 0x55, 0xD4, 0x93, 0x9D, 0xCA, 0x44,
+    0x3A, 0x4B, 0x8E, 0x2A, 0xD6, 0xAC, 0x23, 0xEC, 0x05, 0xA2, 0xF1, 0xD6, 0x55, 0x41, 0x0D, 0x05,
+    0xEB, 0x09, 0xE6, 0x42, 0x42, 0xE3, 0x6D, 0xF7, 0x11, 0x01, 0x00, 0xE4, 0xA0, 0x74, 0xDA, 0xB2,
+    0x0C, 0x53, 0x33, 0xAE, 0x17, 0x2D, 0x00, 0xC9, 0x98, 0xB7, 0x82, 0x03, 0xAC, 0xFB, 0x54, 0x1B,
+    0xFB, 0xDD, 0xAF, 0x00, 0x14, 0x51, 0xBC, 0xCA, 0xBB, 0x9E, 0x9C, 0x9E, 0xAA, 0xC3, 0x2C, 0xF2,
+    0x17, 0x69, 0x89, 0x53, 0x98, 0x39, 0xCF, 0x4F, 0x71, 0xF3, 0xE0, 0xE2, 0x87, 0xE4, 0x5B, 0xE4,
+    0xBF, 0xDA, 0xDC, 0x00, 0x40, 0x5E, 0x25, 0x8F, 0x33, 0x56, 0xEC, 0xEA, 0x00, 0xE5, 0x61, 0x5D,
+    0x49, 0x7C, 0xEC, 0xA5, 0x1E, 0x25, 0xA3, 0xE6, 0x48, 0xF6, 0x4F, 0x2E, 0xFE, 0x57, 0xF2, 0x12,
+    0xB9, 0xB2, 0xB9, 0x91, 0x7B, 0x8A, 0x1E, 0xC0, 0x4E, 0xA4, 0x5F, 0x7E, 0xB9, 0x81, 0xD5, 0x97,
+    0xF1, 0xB4, 0xBE, 0x19, 0x14, 0xC7, 0x8A, 0x2E, 0x33, 0x86, 0x9A, 0x63, 0xDE, 0x2A, 0x76, 0x25,
+    0xF1, 0x69, 0x36, 0xC1, 0x76, 0xF7, 0xAB, 0x0D, 0xAC, 0x06, 0xBC, 0x6C, 0x6E, 0x4E, 0x9A, 0xBE,
+    0x66, 0x97, 0xE3, 0x14, 0xE9, 0xB3, 0x6D, 0x9A, 0x23, 0x79, 0x95, 0x7C, 0x98, 0xC3, 0x27, 0x55,
+    0xC2, 0xF2, 0x52, 0x46, 0x41, 0x1E, 0x67, 0xD4, 0x1C, 0xA1, 0x51, 0x7A, 0x34, 0x1D, 0xB6, 0x50,
+    0xB0, 0x17, 0x6C, 0xCB, 0x17, 0x50, 0x46, 0xFD, 0x56, 0x6A, 0x1C, 0x20, 0x92, 0x7E, 0xEB, 0xA3,
+    0xB6, 0x61, 0xD2, 0x75, 0x1F, 0x6B, 0x6A, 0xBF, 0xC8, 0x2B, 0x81, 0xF2, 0xB0, 0x0E, 0x71, 0x29,
+    0x80, 0x9A, 0x2B, 0xDA, 0x4C, 0xBF, 0xA4, 0x51, 0x94, 0x87, 0x75, 0x82, 0xED, 0xB2, 0x2D, 0x69,
+    0x6F, 0xDE, 0x4D, 0x1F, 0x38, 0x68, 0x8E, 0xF5, 0x44, 0xF6, 0xEA, 0x2D, 0xB2, 0xB5, 0xA7, 0x38,
+    0x94, 0xA9, 0x24, 0xEA, 0xA9, 0x0E, 0x50, 0x83, 0xF2, 0xB0, 0x9D, 0x75, 0x9F, 0x29, 0x48, 0x46,
+    0xE4, 0xB8, 0xCE, 0x30, 0x96, 0x39, 0xFA, 0x79, 0xAE, 0x28, 0xD8, 0xE2, 0xC0, 0xB9, 0x00, 0x34,
+    0x1C, 0xB2, 0x76, 0xA4, 0xD8, 0xA7, 0xD5, 0xB4, 0xAD, 0xBA, 0x98, 0xC0, 0x33, 0x93, 0x48, 0x8D,
+    0xAB, 0xFD, 0xAE, 0x48, 0x53, 0x44, 0x3D, 0xC8, 0x91, 0x9D, 0xBE, 0x9A, 0xC0, 0xE3, 0x9F, 0xE5,
+    0xB6, 0x9D, 0x65, 0x62, 0x80, 0xEE, 0xF1, 0x2F, 0x89, 0x92, 0x01, 0x35, 0x1D, 0x9A, 0x09, 0x58,
+    0x59, 0x87, 0x60, 0x07, 0x46, 0xA8, 0xCB, 0x63, 0xED, 0x95, 0xDB, 0xC8, 0x3D, 0xA3, 0x20, 0xD0,
+    0xF8, 0x2F, 0xE2, 0xA4, 0x3C, 0x44, 0xC2, 0x83, 0xEC, 0x05, 0x03, 0x34, 0x21, 0x38, 0xD3, 0xFD,
+    0x9B, 0x80, 0xF1, 0x30, 0x84, 0x3E, 0xE3, 0x75, 0x97, 0x56, 0xF2, 0x0C, 0xBF, 0x87, 0x2C, 0xFA,
+    0xF4, 0x23, 0x76, 0x79, 0xD3, 0x1F, 0xB0, 0x63, 0xC9, 0x00, 0x1B, 0xD1, 0x4C, 0x80, 0x71, 0xB0,
+    0x97, 0x02, 0xD4, 0x68, 0x5C, 0x15, 0xAB, 0x50, 0xB0, 0x33, 0x4E, 0xFB, 0x2A, 0xC8, 0x00, 0x73,
+    0x81, 0x6D, 0x15, 0xCC, 0x00, 0x73, 0x65, 0x42, 0x45, 0x02, 0x86, 0x13, 0x2A, 0xB2, 0x87, 0xB9,
+    0x4B, 0x54, 0xB1, 0x99, 0x60, 0x9C, 0xED, 0xAB, 0x20, 0x08, 0xE3, 0x9A, 0xA9, 0x0A, 0xA0, 0x33,
+    0x4E, 0xB0, 0xCA, 0x11, 0x82, 0x6E, 0x1F, 0x7F, 0xD1, 0x66, 0x91, 0x3B, 0xD2, 0x72, 0x01, 0x5D,
+    0xD2, 0xA5, 0x43, 0x86, 0x30, 0x2D, 0xE7, 0xD3, 0xFD, 0x01, 0x6A, 0xB4, 0x9D, 0x1A, 0xD5, 0xD0,
+    0x8C, 0xF5, 0xD4, 0x4C, 0x65, 0x6A, 0x26, 0xD8, 0x33, 0x13, 0xD4, 0xCD, 0x80, 0x9A, 0x44, 0x99,
+    0x99, 0xDD, 0x08, 0x35, 0xD2, 0xD5, 0x93, 0x9C, 0xCA, 0x54, 0xB0, 0xB5, 0x9D, 0xF2, 0x6A, 0x10,
+    0xAC, 0x27, 0x98, 0x3D, 0x52, 0xA4, 0x1E, 0x81, 0x32, 0x00, 0x88, 0x33, 0x46, 0x65, 0x05, 0x80,
+    0xED, 0xAA, 0xA8, 0x06, 0x11, 0xEB, 0x49, 0xA4, 0x32, 0x89, 0x04, 0xFB, 0x2C, 0xA1, 0x7E, 0x46,
+    0xD4, 0xDB, 0x44, 0x99, 0x35, 0xA0, 0x23, 0x14, 0x89, 0x3A, 0x69, 0x9F, 0xDF, 0xE8, 0x4C, 0xAF,
+    0x86, 0x3A, 0xD4, 0x13, 0x78, 0x21, 0xA1, 0x99, 0xB0, 0x09, 0x68, 0x8F, 0x7A, 0x42, 0x99, 0x00,
+    0xD3, 0x2E, 0xC9, 0xBE, 0xEA, 0x1E, 0x71, 0xC9, 0x67, 0x3C, 0x5D, 0x5F, 0xFC, 0x6B, 0x32, 0x5A,
+    0xF2, 0x0D, 0x32, 0x62, 0xB3, 0x95, 0x93, 0x48, 0x60, 0xAB, 0x5C, 0xB1, 0x9E, 0xA7, 0x24, 0x3D,
+    0x7C, 0xF6, 0x03, 0xCC, 0xAF, 0x9A, 0x1D, 0x87, 0x3A, 0x2D, 0x7E, 0x34, 0x67, 0xC7, 0x72, 0x77,
+    0x24, 0x8A, 0x00, 0x68, 0x07, 0x31, 0x02, 0xCF, 0x64, 0x7A, 0xF7, 0xE3, 0xA6, 0xA9, 0xBD, 0xF9,
+    0x0A, 0x28, 0x52, 0x73, 0x61, 0xD2, 0xC5, 0xBA, 0x71, 0xF2, 0x3D, 0x42, 0x7F, 0x37, 0x14, 0x41,
+    0xF9, 0x7A, 0xB0, 0x4E, 0x95, 0xCC, 0x34, 0xAC, 0xF2, 0x80, 0x75, 0xF8, 0x65, 0xB7, 0x8B, 0xC5,
+    0x63, 0x64, 0x54, 0xE4, 0x98, 0xF3, 0x24, 0x52, 0x73, 0x73, 0xB2, 0xFA, 0x67, 0x13, 0xCF, 0x5C,
+    0x4C, 0xFF, 0xE8, 0xB3, 0xAC, 0x26, 0x32, 0x0F, 0x85, 0x4F, 0xA8, 0x01, 0x5B, 0x07, 0x39, 0x59,
+    0xC7, 0xEF, 0x86, 0xCA, 0xFF, 0xF2, 0xDA, 0xF9, 0x84, 0x84, 0x92, 0xBE, 0x11, 0x78, 0xEE, 0x56,
+    0xD2, 0xC7, 0x3F, 0x36, 0x27, 0xFB, 0xD1, 0x7D, 0xF7, 0xEE, 0x2D, 0x2A, 0x7A, 0x54, 0x1C, 0x51,
+    0xD1, 0x43, 0xB2, 0x85, 0x09, 0x80, 0x0D, 0x99, 0xEF, 0xFA, 0x87, 0xFB, 0xDF, 0x4D, 0x8B, 0x1F,
+    0x55, 0x64, 0x5C, 0xEE, 0x19, 0x05, 0xA4, 0x06, 0xD8, 0xAE, 0x4C, 0xF7, 0x5C, 0x26, 0xA8, 0x08,
+    0x1B, 0x04, 0x7B, 0x1B, 0x04, 0x87, 0x8A, 0x5D, 0x9D, 0x3E, 0xFC, 0xEE, 0x4C, 0x74, 0xCA, 0x90,
+    0xB5, 0xDB, 0x80, 0xE9, 0xB2, 0x2C, 0x74, 0x8F, 0xCD, 0x32, 0x23, 0xCA, 0x60, 0x02, 0x44, 0x30,
+    0x09, 0x22, 0x18, 0x42, 0x04, 0xC3, 0x4E, 0x04, 0xC3, 0x5E, 0x04, 0x63, 0xBC, 0x08, 0xE6, 0xC4,
+    0x28, 0x82, 0x79, 0x2C, 0x88, 0x60, 0x4E, 0x27, 0x11, 0xCC, 0xB3, 0x14, 0xC1, 0x74, 0xBC, 0x18,
+    0x4C, 0x67, 0xAE, 0x06, 0xD3, 0xE9, 0x5B, 0xC1, 0x74, 0xCD, 0xFB, 0xC1, 0x74, 0x35, 0x83, 0xE9,
+    0x04, 0x83, 0xE9, 0x4A, 0x06, 0xD3, 0x81, 0xC1, 0x74, 0x30, 0xC1, 0x74, 0xD0, 0x01, 0x58, 0x6B,
+    0x21, 0x08, 0xE8, 0x01, 0x65, 0xCC, 0x3A, 0xC3, 0x4C, 0x7B, 0xEA, 0x67, 0xD9, 0x53, 0xF3, 0x2D,
+    0x92, 0x6F, 0xF2, 0xAF, 0x69, 0x47, 0x41, 0xBA, 0x9A, 0x09, 0x0D, 0x27, 0x18, 0x0E, 0x05, 0xD9,
+    0x55, 0x1F, 0x73, 0xEB, 0xBE, 0xC2, 0xFC, 0xEF, 0xFD, 0x38, 0xC3, 0x7E, 0x50, 0x04, 0x00, 0xE5,
+    0x84, 0x3D, 0xAD, 0xE4, 0xA4, 0xA2, 0xBC, 0xC5, 0xA4, 0xC9, 0xC8, 0x6D, 0x73, 0x97, 0xAD, 0x66,
+    0x80, 0xFD, 0xE4, 0x42, 0xCC, 0xB7, 0xBB, 0x49, 0x88, 0x90, 0xC5, 0xD4, 0x36, 0x63, 0xEE, 0x56,
+    0xDA, 0x2C, 0x6F, 0x86, 0x05, 0x01, 0x75, 0x2D, 0x2C, 0x55, 0x6F, 0x74, 0xB3, 0xA2, 0xE0, 0x2B,
+    0x6D, 0xC8, 0x95, 0xB6, 0x58, 0xD7, 0x9D, 0xE9, 0xF4, 0xE5, 0x09, 0x9A, 0x1D, 0x4C, 0xC8, 0x62,
+    0x8C, 0xCF, 0xD9, 0x90, 0xF5, 0x88, 0x59, 0x30, 0x0E, 0xE9, 0x31, 0x2B, 0x71, 0xD0, 0x38, 0x00,
+    0x65, 0xD0, 0x8F, 0xD2, 0xE9, 0x47, 0xB6, 0xC9, 0x87, 0xD7, 0x35, 0x19, 0x20, 0xF8, 0x3A, 0x7B,
+    0xE8, 0xAC, 0x3F, 0x84, 0x1E, 0xA0, 0x7B, 0x91, 0x20, 0x02, 0xF4, 0x00, 0xED, 0x3E, 0xF5, 0xE5,
+    0xBE, 0x3A, 0xFB, 0x40, 0x75, 0x59, 0x2F, 0x82, 0x39, 0x39, 0x89, 0x60, 0x8E, 0x47, 0x11, 0xCC,
+    0xA3, 0x14, 0xC1, 0x3C, 0xCB, 0x8B, 0xC1, 0x74, 0xBC, 0x1A, 0x4C, 0x67, 0xDE, 0x0B, 0xA6, 0x53,
+    0x29, 0x98, 0x4E, 0x7E, 0x54, 0x4D, 0xE9, 0x60, 0x3A, 0x34, 0xC1, 0x74, 0x90, 0xC1, 0x74, 0x10,
+    0x61, 0x6E, 0x54, 0x88, 0x00, 0xAC, 0x9C, 0x9C, 0x80, 0x86, 0x1E, 0x68, 0xD8, 0x03, 0xCD, 0x9E,
+    0x22, 0xE4, 0xDE, 0xCE, 0x73, 0x72, 0xAF, 0xF3, 0x7C, 0x02, 0xF0, 0x71, 0x79, 0xBB, 0x37, 0xC5,
+    0x0A, 0xA2, 0x3C, 0x37, 0x41, 0xB2, 0x87, 0x4E, 0x80, 0xED, 0x71, 0x70, 0xF1, 0x02, 0x50, 0x91,
+    0x2D, 0x0A, 0xB2, 0x07, 0xD6, 0x76, 0x55, 0xBA, 0x25, 0x13, 0x32, 0xAE, 0xE7, 0x1E, 0x2C, 0x4E,
+    0xC5, 0x92, 0x1D, 0xCC, 0x40, 0x07, 0x19, 0xF4, 0x80, 0x92, 0xCD, 0x07, 0xB0, 0x42, 0x7B, 0x00,
+    0xA2, 0xAB, 0x09, 0x50, 0x9E, 0x0E, 0x32, 0xA8, 0x11, 0x55, 0x12, 0x6C, 0xEF, 0xC1, 0xE2, 0x64,
+    0x50, 0xD2, 0x01, 0xA6, 0x36, 0x0F, 0x92, 0x62, 0xB1, 0xE8, 0x4A, 0xD2, 0x95, 0xA4, 0x5B, 0x2A,
+    0x76, 0xBF, 0x10, 0xC4, 0xC2, 0x1A, 0x56, 0x80, 0xDA, 0xD5, 0x3D, 0x0A, 0x66, 0x36, 0xDB, 0x03,
+    0x25, 0x3D, 0xF6, 0x44, 0xBD, 0xFF, 0x49, 0x60, 0x52, 0x45, 0x8B, 0x75, 0x31, 0x08, 0x5F, 0x66,
+    0x31, 0x93, 0x83, 0xDA, 0x0F, 0xE1, 0xF8, 0x22, 0xA0, 0x1A, 0x1B, 0x6B, 0x80, 0x48, 0xBA, 0x47,
+    0x91, 0x54, 0x0F, 0xA4, 0xA6, 0x07, 0x5E, 0x91, 0x0E, 0x58, 0xFD, 0x4F, 0x5A, 0x70, 0x6C, 0xAE,
+    0xAC, 0x83, 0x8D, 0x17, 0x51, 0xBB, 0xCA, 0x27, 0xC8, 0xF3, 0x13, 0x56, 0xBE, 0xC8, 0x82, 0x63,
+    0xAD, 0xDD, 0xA7, 0x53, 0xB3, 0x5D, 0x9E, 0x35, 0x97, 0xB2, 0xD3, 0x8A, 0x3B, 0x2D, 0x2C, 0xD9,
+    0xD5, 0x24, 0x61, 0xAF, 0x73, 0xAC, 0x43, 0x41, 0x67, 0x5D, 0x1D, 0xEA, 0x00, 0xBB, 0xBC, 0x60,
+    0x67, 0x5F, 0xB7, 0xBE, 0x26, 0x23, 0x2C, 0xD3, 0xAC, 0x8B, 0x39, 0xCF, 0x76, 0x7E, 0x4B, 0x0F,
+    0x75, 0x28, 0xD9, 0x5A, 0x27, 0x43, 0x1D, 0x60, 0x06, 0xEB, 0x04, 0xEB, 0x00, 0x19, 0xB0, 0xB2,
+    0x81, 0x66, 0x82, 0xEE, 0xC1, 0x56, 0x84, 0x39, 0xD5, 0x54, 0x4F, 0x54, 0x13, 0xED, 0x48, 0x8E,
+    0x1C, 0x41, 0x07, 0x76, 0x9F, 0xB4, 0x19, 0xFE, 0x30, 0x57, 0x9B, 0x25, 0x7D, 0x9D, 0xCE, 0xB1,
+    0xB5, 0xAE, 0xB9, 0x27, 0x7B, 0xD6, 0x59, 0x27, 0xA7, 0x3A, 0x3E, 0xCE, 0xA5, 0x02, 0x2E, 0xAB,
+    0x8A, 0xEA, 0xD0, 0x8C, 0xF3, 0x5B, 0x22, 0xC1, 0x3A, 0x35, 0xD6, 0x01, 0x74, 0xD6, 0x55, 0xA9,
+    0x0E, 0xD0, 0xDE, 0x7E, 0x98, 0x92, 0x97, 0x7E, 0xA6, 0xA4, 0x9B, 0x3D, 0x4A, 0x5E, 0x3F, 0x9B,
+    0xF4, 0xE5, 0xA4, 0x6F, 0x46, 0xCD, 0xA8, 0x23, 0xB4, 0x87, 0x1E, 0x3E, 0x69, 0x9B, 0x0D, 0x1F,
+    0x06, 0x34, 0x0E, 0xAA, 0x83, 0xDE, 0xD5, 0x48, 0x22, 0x21, 0x41, 0x04, 0xD3, 0xE5, 0xB5, 0x49,
+    0x07, 0x2C, 0xD5, 0x92, 0x5F, 0x76, 0x43, 0xAC, 0x62, 0x45, 0x0E, 0xCD, 0xAB, 0x49, 0xF5, 0x0D,
+    0xFB, 0x92, 0xC3, 0xAC, 0x85, 0x4D, 0xF5, 0xA4, 0x2F, 0x27, 0x79, 0x97, 0x8F, 0x90, 0x3D, 0x47,
+    0x68, 0xFF, 0xCB, 0x79, 0x2D, 0xCC, 0x7C, 0x81, 0xDC, 0xE5, 0x0B, 0x66, 0x6C, 0x60, 0xCD, 0xA1,
+    0x26, 0x7F, 0x4A, 0x46, 0xBD, 0x63, 0x2F, 0x45, 0xAC, 0xCE, 0xEA, 0x02, 0xED, 0x21, 0x38, 0x40,
+    0x72, 0x80, 0x66, 0x9F, 0x01, 0x5E, 0x11, 0xB0, 0x03, 0x4A, 0x02, 0xCD, 0x0E, 0x4A, 0xDA, 0xEF,
+    0xF1, 0x8D, 0xAC, 0x0E, 0x28, 0xC9, 0x16, 0xAB, 0x00, 0x8A, 0x4D, 0x14, 0xEC, 0xC0, 0x16, 0x6C,
+    0xC1, 0xA5, 0xC0, 0xF2, 0x01, 0xBE, 0xAD, 0xC8, 0x86, 0xFC, 0xEE, 0x54, 0x5C, 0x48, 0x80, 0x1D,
+    0x21, 0xD9, 0x17, 0x64, 0x5B, 0x73, 0x82, 0xCA, 0xFA, 0x5C, 0xF9, 0x7E, 0x5F, 0x45, 0x4B, 0x2A,
+    0xF2, 0x51, 0x26, 0x14, 0xEB, 0xC0, 0x5A, 0x8B, 0x9A, 0x28, 0x18, 0x60, 0x7E, 0x30, 0x34, 0xBD,
+    0xEE, 0x66, 0x99, 0xDE, 0x17, 0x9B, 0xE7, 0x4D, 0xC0, 0x7A, 0x18, 0xC2, 0xFC, 0x60, 0x30, 0xED,
+    0x92, 0xA9, 0xFD, 0x55, 0xF3, 0xFC, 0x85, 0x66, 0x4F, 0x67, 0x61, 0x7A, 0xE3, 0x01, 0x8D, 0xE2,
+    0x71, 0x8F, 0x26, 0x65, 0x85, 0x3A, 0x50, 0xD8, 0xF4, 0x6D, 0xF2, 0x5D, 0x72, 0xB2, 0xDD, 0x6F,
+    0xA9, 0x01, 0x35, 0x5B, 0x30, 0xA2, 0xE1, 0x08, 0xCB, 0xAE, 0xA4, 0x47, 0x15, 0x01, 0xFE, 0x05,
+    0xCC, 0x1B, 0xE4, 0x7B, 0xE4, 0x68, 0x38, 0x40, 0xB5, 0xA8, 0x07, 0x14, 0x16, 0x90, 0x3D, 0xFE,
+    0xF5, 0x08, 0x1D, 0x20, 0x27, 0xAC, 0xA0, 0x78, 0x38, 0x96, 0xA1, 0x9A, 0xD8, 0x36, 0xEC, 0x61,
+    0xA7, 0x65, 0xFF, 0xFE, 0x42, 0xEB, 0xF9, 0x63, 0x3A, 0xF3, 0xAF, 0x58, 0xCF, 0x86, 0x64, 0x43,
+    0xF2, 0x1A, 0xC9, 0xDB, 0x24, 0x03, 0xE4, 0xB4, 0x44, 0x20, 0x74, 0x33, 0xE0, 0xE0, 0x57, 0x0B,
+    0xC0, 0x08, 0x60, 0xAB, 0x5D, 0x5A, 0x0A, 0x01, 0xBF, 0x6E, 0xBA, 0x4C, 0x90, 0xDA, 0x0E, 0x58,
+    0x05, 0x02, 0x8A, 0x80, 0x32, 0xA0, 0x66, 0xD2, 0x4C, 0x86, 0xE9, 0x81, 0xB8, 0x51, 0x05, 0x7C,
+    0x78, 0x13, 0x01, 0x82, 0x7F, 0x24, 0x98, 0x0A, 0x26, 0x98, 0x84, 0xAA, 0x47, 0x3D, 0xE0, 0x40,
+    0x00, 0xB6, 0xF0, 0x5F, 0x25, 0xE8, 0x00, 0x3D, 0x14, 0xEB, 0xD8, 0x40, 0x2A, 0x22, 0xE4, 0x7B,
+    0x29, 0x63, 0xF4, 0x1A, 0xEE, 0xCE, 0x2F, 0x05, 0xB3, 0xD6, 0x9A, 0x27, 0xE6, 0x92, 0xFA, 0xCF,
+    0x53, 0xB0, 0x7B, 0x02, 0xE6, 0xD9, 0xAE, 0x07, 0x6A, 0x8F, 0x75, 0x31, 0x22, 0x20, 0xC0, 0xE0,
+    0x77, 0xA1, 0x1C, 0xA0, 0x38, 0x41, 0x33, 0xA1, 0x21, 0xBB, 0xC2, 0xBE, 0x9E, 0xD1, 0xFF, 0x55,
+    0xC8, 0x22, 0x26, 0x18, 0x87, 0x7B, 0x03, 0xB4, 0x03, 0x64, 0x5C, 0x85, 0x60, 0xCA, 0x48, 0xD0,
+    0x8A, 0x03, 0xB0, 0x82, 0x0F, 0x35, 0x52, 0xFC, 0xC8, 0x8C, 0x15, 0x64, 0x80, 0x21, 0xD1, 0x90,
+    0xAE, 0x3C, 0x97, 0x9E, 0xFF, 0x34, 0x8D, 0xF4, 0x89, 0xED, 0xA0, 0x19, 0xF2, 0xF6, 0xD1, 0xED,
+    0x30, 0x2F, 0xD4, 0xF5, 0x28, 0xB3, 0x25, 0x82, 0x61, 0x44, 0x7D, 0x9E, 0x1D, 0x0E, 0x61, 0x96,
+    0x95, 0x4C, 0x28, 0xE3, 0x7E, 0x9C, 0xC7, 0x67, 0xBB, 0x78, 0x27, 0x40, 0x24, 0xD3, 0xC3, 0x5C,
+    0x25, 0x64, 0x50, 0xE9, 0x71, 0x76, 0xCC, 0xEA, 0xD1, 0x80, 0x6A, 0x1F, 0xE4, 0x18, 0xD5, 0x28,
+    0x5B, 0x93, 0x5E, 0x11, 0xA4, 0x97, 0x25, 0xB1, 0x9A, 0x93, 0xD7, 0x7D, 0x99, 0xD8, 0xD6, 0x9C,
+    0xED, 0x42, 0xD8, 0x97, 0xFC, 0x88, 0xDB, 0x04, 0xCD, 0x50, 0xF0, 0xE6, 0xF6, 0x49, 0x1A, 0x32,
+    0x58, 0xBE, 0xE9, 0x6D, 0x50, 0xEE, 0x3E, 0x00, 0x4F, 0x2E, 0xCE, 0x66, 0x98, 0x23, 0xE9, 0xB1,
+    0x32, 0xE3, 0x18, 0xBE, 0x8A, 0x32, 0x95, 0x8B, 0x05, 0x1A, 0x46, 0x18, 0x8E, 0x33, 0xFD, 0x2B,
+    0x22, 0xD4, 0xCD, 0x8F, 0x2F, 0xC4, 0xF2, 0x76, 0x10, 0xA4, 0x6B, 0x12, 0xBF, 0xCF, 0x3B, 0x24,
+    0x2F, 0x33, 0xB2, 0xE6, 0x85, 0x80, 0x16, 0x59, 0x8D, 0x23, 0x5B, 0xD9, 0x81, 0x37, 0x47, 0x54,
+    0x4C, 0x80, 0x64, 0xBB, 0x8B, 0x24, 0xFC, 0x2A, 0x4A, 0xB5, 0xD2, 0x16, 0xAD, 0x82, 0x82, 0xB9,
+    0x19, 0x60, 0xE9, 0x60, 0xA7, 0x65, 0xF2, 0x9F, 0xBB, 0xA5, 0x8A, 0x75, 0x00, 0xEC, 0x01, 0x65,
+    0x01, 0xD1, 0x7B, 0xE0, 0xA8, 0x04, 0xCA, 0xBB, 0x7E, 0xD6, 0x9D, 0xDE, 0xF7, 0xD5, 0x95, 0x32,
+    0x23, 0xD5, 0x1D, 0xE4, 0x4D, 0x87, 0x23, 0x0D, 0xE0, 0x9F, 0x82, 0xB8, 0x3B, 0x64, 0xFC, 0x63,
+    0x8B, 0x2F, 0xA4, 0x29, 0xD7, 0x1E, 0xDE, 0x40, 0x15, 0x6C, 0x07, 0x36, 0x03, 0xD4, 0xC5, 0x09,
+    0xD5, 0xF0, 0x0A, 0xB0, 0xFA, 0x15, 0x36, 0x25, 0x36, 0xD7, 0x5A, 0x39, 0x11, 0xE6, 0xCC, 0x28,
+    0x46, 0x03, 0xFD, 0x88, 0xC7, 0xFA, 0x17, 0xD3, 0x94, 0xA6, 0x83, 0x7A, 0xE3, 0x57, 0xCA, 0xF8,
+    0x8D, 0x00, 0x91, 0x8C, 0x83, 0x7E, 0x27, 0xA2, 0x8A, 0xDA, 0x83, 0x17, 0xF8, 0x73, 0x3B, 0xC9,
+    0x19, 0x9A, 0xEA, 0x60, 0xE8, 0x81, 0x95, 0x00, 0xA0, 0xE9, 0x80, 0xD2, 0xCF, 0x02, 0xE3, 0x32,
+    0x75, 0x40, 0x13, 0x00, 0x98, 0x8E, 0x6D, 0x7D, 0xF7, 0x93, 0x73, 0x1E, 0xF7, 0x6C, 0x09, 0xED,
+    0xCF, 0x6D, 0x24, 0xF9, 0x1E, 0x69, 0x2E, 0xD0, 0x5B, 0x1C, 0xAA, 0x7A, 0xE0, 0xD8, 0x3E, 0x23,
+    0xC8, 0x90, 0x61, 0x28, 0x7F, 0xD9, 0xEE, 0xC9, 0x60, 0xE8, 0x97, 0xAC, 0x0D, 0x00, 0xD8, 0x13,
+    0x3D, 0x00, 0x98, 0x87, 0x23, 0x80, 0x5D, 0x3D, 0x6F, 0x36, 0xEF, 0x82, 0x08, 0x10, 0xC1, 0x76,
+    0x05, 0xBB, 0x82, 0x8D, 0x87, 0xF5, 0xB0, 0xA7, 0x03, 0x74, 0x80, 0xEE, 0xD9, 0x4A, 0xB6, 0xD2,
+    0xAB, 0xA1, 0xE2, 0x50, 0x85, 0x2A, 0x94, 0x29, 0x94, 0x09, 0x44, 0xB2, 0x60, 0xAB, 0x7B, 0x7D,
+    0xA2, 0xD7, 0xAE, 0x9E, 0x9A, 0xAB, 0x53, 0xE3, 0x0B, 0xD6, 0x9E, 0xF5, 0x04, 0x7D, 0x31, 0xA8,
+    0x8B, 0x11, 0xD2, 0xA7, 0x6A, 0x24, 0xCA, 0x68, 0xDA, 0xA4, 0x1D, 0xCC, 0x39, 0xA7, 0xDF, 0x1C,
+    0x20, 0x39, 0xD4, 0x77, 0x47, 0x08, 0x8E, 0x05, 0xB3, 0xDC, 0x51, 0x13, 0x68, 0x08, 0xC9, 0x0E,
+    0x82, 0x5D, 0xC9, 0x1E, 0x60, 0x9F, 0x41, 0xBA, 0x2B, 0xD9, 0x48, 0x9A, 0x2D, 0x66, 0x4C, 0x4A,
+    0x36, 0x21, 0x86, 0x98, 0x6A, 0x0F, 0x60, 0x63, 0x17, 0xCB, 0x59, 0x26, 0x68, 0x5F, 0x46, 0xE3,
+    0x64, 0x04, 0x8F, 0xFB, 0x9A, 0x9D, 0xBE, 0x90, 0x04, 0x7D, 0x33, 0x18, 0x17, 0x83, 0x1C, 0xA5,
+    0x37, 0x5A, 0x04, 0x11, 0xD5, 0x99, 0x57, 0x09, 0x7B, 0xE6, 0xB5, 0xC9, 0x76, 0xCD, 0x2D, 0x6F,
+    0x74, 0x2F, 0x42, 0x90, 0x57, 0x3C, 0x68, 0xC4, 0x9D, 0x09, 0xCD, 0xCD, 0x6E, 0x2B, 0x42, 0xB0,
+    0x6F, 0x08, 0xD0, 0x0B, 0x3A, 0xA8, 0x00, 0x0E, 0xA8, 0x12, 0x94, 0x9F, 0xC5, 0x97, 0x2A, 0xCC,
+    0x50, 0xEC, 0xE6, 0x9D, 0x09, 0x45, 0x14, 0x13, 0x8A, 0x19, 0xA0, 0xF2, 0x95, 0x98, 0xEC, 0x60,
+    0x65, 0x3D, 0xAB, 0xCE, 0x2B, 0x7A, 0x88, 0x89, 0x10, 0x93, 0x1C, 0x96, 0x8A, 0xF3, 0xAF, 0xC2,
+    0x0A, 0xE1, 0x69, 0x31, 0x40, 0x04, 0xE5, 0x20, 0xBD, 0x05, 0x9A, 0x76, 0xDA, 0x63, 0xEB, 0xEA,
+    0x80, 0x92, 0xCD, 0x94, 0xCD, 0x7A, 0xAC, 0xD3, 0xBD, 0x88, 0xB0, 0x4E, 0x79, 0xB0, 0x65, 0x5B,
+    0xB2, 0x0E, 0x10, 0x51, 0xF7, 0xA8, 0x13, 0x67, 0x99, 0x61, 0xC3, 0x2E, 0xF7, 0xDD, 0xAC, 0x66,
+    0xF9, 0x98, 0x12, 0x7F, 0x20, 0x08, 0x6B, 0xEB, 0x80, 0x1A, 0x73, 0x1E, 0x9B, 0x19, 0x83, 0xB6,
+    0x64, 0xE4, 0x49, 0x06, 0x4D, 0x52, 0x92, 0xBC, 0x48, 0x72, 0xC8, 0x08, 0x0E, 0xE5, 0x67, 0xAB,
+    0x8D, 0x90, 0x67, 0xE9, 0x2A, 0x66, 0x02, 0xA5, 0xE4, 0x8C, 0x76, 0x65, 0x97, 0xCB, 0x6E, 0xFA,
+    0x4C, 0xB0, 0xE8, 0x9D, 0xC5, 0xA2, 0x21, 0x79, 0x89, 0xE4, 0xBB, 0xD9, 0x08, 0x6F, 0xB3, 0x45,
+    0x33, 0x9B, 0xE4, 0xB7, 0xD0, 0x4B, 0x5C, 0x75, 0x49, 0x06, 0x45, 0x5E, 0x20, 0xC3, 0xDA, 0x26,
+    0x1D, 0xD4, 0x4C, 0xC4, 0x77, 0xD0, 0x3E, 0x5B, 0xED, 0xB7, 0xBB, 0xF6, 0xFB, 0xDF, 0xDB, 0xD0,
+    0xE4, 0x55, 0x32, 0xEA, 0xA5, 0xFE, 0xA3, 0x48, 0x33, 0xEC, 0x46, 0xF9, 0x0C, 0x01, 0xD9, 0x95,
+    0xE9, 0x7E, 0x79, 0xE5, 0xC8, 0x4A, 0x2C, 0x3D, 0x40, 0x24, 0x40, 0xB9, 0x5D, 0xD9, 0xDB, 0xAF,
+    0x58, 0x8E, 0x99, 0x1A, 0x4E, 0x1F, 0x49, 0x0D, 0x7F, 0x79, 0xE5, 0x58, 0x41, 0xD1, 0xA6, 0x22,
+    0x56, 0x93, 0xBD, 0x97, 0x01, 0xFA, 0xD5, 0xDB, 0x63, 0x15, 0x36, 0x69, 0x5E, 0x63, 0xB0, 0xFD,
+    0x63, 0x13, 0x6C, 0x57, 0x7F, 0xCA, 0x03, 0xD6, 0x5A, 0x19, 0xF2, 0x8D, 0x69, 0x8B, 0x75, 0x6C,
+    0x82, 0xCE, 0x3A, 0xD3, 0x99, 0x76, 0x05, 0xC0, 0x26, 0x04, 0xBB, 0x9A, 0x83, 0x7A, 0x63, 0xB4,
+    0x45, 0xDC, 0xC0, 0x1A, 0x80, 0x7A, 0x68, 0x34, 0xB7, 0x0C, 0xE3, 0x4F, 0x9A, 0x71, 0x1D, 0xED,
+    0x93, 0x8B, 0x1F, 0x90, 0xE4, 0xED, 0xCD, 0xCD, 0x07, 0x17, 0x8B, 0xD3, 0xB9, 0xC2, 0xCE, 0x6F,
+    0x6E, 0x6E, 0xAC, 0x62, 0xED, 0x18, 0x8E, 0xE9, 0xBB, 0x51, 0x72, 0x12, 0xEC, 0xB1, 0x0A, 0x88,
+    0x60, 0xAE, 0x45, 0xD5, 0x41, 0x15, 0xA3, 0xBE, 0x18, 0xF4, 0xE9, 0xD0, 0x14, 0x23, 0xA0, 0xBD,
+    0x0E, 0xFF, 0x45, 0x40, 0xA8, 0x27, 0xD9, 0x1F, 0xE8, 0x56, 0x5A, 0x3D, 0x6E, 0x85, 0xF1, 0xE8,
+    0x78, 0xF4, 0x99, 0xA0, 0xC6, 0xA2, 0x2D, 0x36, 0xD6, 0x5A, 0x73, 0x79, 0x92, 0xEF, 0xA6, 0x32,
+    0xE8, 0xEE, 0x99, 0xBA, 0x2F, 0xDA, 0x75, 0x6C, 0x60, 0xAD, 0xE9, 0xD5, 0x85, 0xA8, 0x9D, 0xA2,
+    0x13, 0xEC, 0xB1, 0xB6, 0x8E, 0xD5, 0xA7, 0x9F, 0x7E, 0xFA, 0xE9, 0x3F, 0xDB, 0x58, 0x0B, 0x3A,
+    0xFF, 0xBD, 0xF0, 0xE0, 0xDA, 0xCA, 0xBA, 0x7C, 0x2F, 0x15, 0x51, 0xB9, 0xE6, 0xC2, 0x54, 0x4C,
+    0xAA, 0x5D, 0x29, 0x5A, 0x3C, 0x05, 0x10, 0xAB, 0x69, 0xF5, 0xE8, 0xEF, 0x3E, 0xA5, 0x1E, 0x9E,
+    0x24, 0xFD, 0x8C, 0x9D, 0xD8, 0x44, 0xC5, 0x41, 0x71, 0xD2, 0x8B, 0xF0, 0x14, 0x8E, 0xAE, 0x62,
+    0xB5, 0x1A, 0x52, 0xF3, 0x5A, 0xD0, 0x97, 0x26, 0x7B, 0x6A, 0xBD, 0xF9, 0x59, 0xD2, 0x17, 0x83,
+    0x7E, 0xD4, 0x6F, 0x15, 0xAD, 0x7D, 0x6C, 0xD2, 0x17, 0x43, 0xE3, 0x62, 0x3D, 0xAC, 0xEE, 0x0F,
+    0x5F, 0x6B, 0x65, 0x00, 0xBB, 0x7A, 0x84, 0x41, 0xD1, 0x62, 0xB3, 0x6D, 0x26, 0x11, 0xF7, 0x54,
+    0x96, 0x87, 0xFF, 0xC1, 0x8D, 0xF4, 0xC7, 0xC3, 0x61, 0xB4, 0xA8, 0xDB, 0xBF, 0x7D, 0x2C, 0xFD,
+    0xED, 0xE3, 0xED, 0x21, 0x00, 0x36, 0x3D, 0xF9, 0x6F, 0x71, 0x78, 0xF7, 0x0F, 0x22, 0x56, 0xA1,
+    0x9E, 0x8C, 0xB7, 0xFD, 0x16, 0x80, 0x15, 0xFD, 0xCA, 0xF8, 0x13, 0x73, 0xB8, 0xEC, 0x84, 0x13,
+    0xEE, 0xF7, 0xFE, 0x5E, 0x07, 0xE0, 0xC1, 0x17, 0x74, 0x10, 0x4E, 0x38, 0xE1, 0x00, 0x40, 0x38,
+    0xE1, 0x74, 0xF8, 0xBD, 0xBF, 0x17, 0xAE, 0xEC, 0x1E, 0x7C, 0x81, 0x1E, 0x28, 0x5E, 0xA8, 0xBD,
+    0x72, 0xB6, 0x0C, 0xCD, 0x1D, 0xFE, 0x20, 0x98, 0xEE, 0x47, 0x62, 0x92, 0x83, 0xEE, 0x92, 0x88,
+    0x35, 0x8F, 0xC7, 0x66, 0x44, 0x19, 0xF4, 0xD5, 0xA8, 0xDC, 0x3D, 0x6D, 0xF0, 0xC1, 0x3A, 0x47,
+    0x19, 0xF5, 0xC5, 0x51, 0x17, 0x6D, 0xE5, 0xE4, 0x70, 0x20, 0x20, 0xFE, 0x83, 0x60, 0x82, 0x1E,
+    0x0A, 0x4C, 0xC7, 0x6A, 0x17, 0x25, 0x8D, 0xFF, 0x77, 0xB9, 0xB6, 0x1F, 0x5C, 0xBC, 0xA0, 0x19,
+    0x8E, 0xE0, 0xC8, 0x43, 0xF8, 0xC6, 0x43, 0xF8, 0xC6, 0x2A, 0x56, 0x01, 0x7C, 0xE7, 0xC8, 0xD7,
+    0xFE, 0x70, 0xEB, 0xA9, 0xE6, 0xC6, 0x08, 0x60, 0x03, 0x2B, 0x4D, 0xAF, 0xCE, 0x27, 0xED, 0x14,
+    0xFB, 0xB9, 0xA1, 0xF6, 0x77, 0x2A, 0x53, 0xC4, 0x0D, 0xAC, 0xAD, 0x62, 0xED, 0x69, 0x3C, 0xAD,
+    0x6F, 0x84, 0x86, 0x63, 0x95, 0xBB, 0xCA, 0x87, 0x9A, 0x63, 0xEE, 0x78, 0xFB, 0xF0, 0x40, 0x7B,
+    0x1D, 0x6F, 0x73, 0x73, 0xF3, 0x04, 0xC9, 0xC5, 0x62, 0xF1, 0xFC, 0xE6, 0xE6, 0xA6, 0x26, 0xFF,
+    0xC3, 0x62, 0xF1, 0x3C, 0x80, 0x7C, 0xF3, 0x77, 0xF9, 0xA6, 0x8C, 0xE2, 0x22, 0xEF, 0xBE, 0x4B,
+    0x8E, 0x2F, 0x37, 0xD3, 0x7D, 0x38, 0x84, 0x7B, 0xBB, 0xEB, 0xE6, 0xE6, 0xE6, 0xE6, 0xE6, 0xE3,
+    0x24, 0x99, 0x2C, 0x49, 0xFE, 0x62, 0xB1, 0x58, 0x2C, 0x7E, 0x04, 0x00, 0xF8, 0x0E, 0xC4, 0x04,
+    0x15, 0x0A, 0xF6, 0x32, 0x41, 0x8F, 0x68, 0xDA, 0x25, 0x99, 0x0C, 0x04, 0xA0, 0x69, 0x21, 0x3C,
+    0x70, 0x2C, 0xBB, 0xB0, 0xC8, 0x01, 0x65, 0x0E, 0xA8, 0xE6, 0x80, 0xEE, 0x03, 0x01, 0x32, 0x07,
+    0xE8, 0x0F, 0x06, 0x3C, 0x08, 0x60, 0x3D, 0x3C, 0xD3, 0x7C, 0x2B, 0xBE, 0xF4, 0x3B, 0xF8, 0x7A,
+    0xAE, 0xD4, 0xA3, 0x9B, 0x4F, 0x69, 0x86, 0xB5, 0xCD, 0x0D, 0x00, 0x96, 0xE9, 0xFF, 0xD8, 0xFC,
+    0xE7, 0x3F, 0xC6, 0xFD, 0x3F, 0xC6, 0xFD, 0x96, 0xE9, 0xC9, 0xC5, 0x8F, 0x00, 0x34, 0x37, 0xC6,
+    0x3F, 0x7C, 0xE6, 0xCF, 0xBF, 0x73, 0xE4, 0x6B, 0x00, 0x0E, 0x3D, 0xF6, 0xCF, 0xF5, 0x85, 0xD1,
+    0xBC, 0x71, 0x3F, 0x00, 0xF5, 0x93, 0xF1, 0xA9, 0x6F, 0xCA, 0xBF, 0x9C, 0xF0, 0x11, 0x75, 0xF2,
+    0x1F, 0x16, 0x8B, 0xE7, 0xF3, 0xC0, 0x77, 0xD5, 0x04, 0xDD, 0x7D, 0x68, 0xE0, 0x03, 0xE5, 0x76,
+    0xB5, 0x5B, 0x5F, 0xE3, 0x2A, 0x0E, 0xE1, 0xC9, 0x3A, 0x9C, 0x74, 0xA1, 0x69, 0x5B, 0x94, 0x3F,
+    0x42, 0xF5, 0x2A, 0x4F, 0x3C, 0x12, 0xEC, 0x19, 0x4F, 0x7D, 0x31, 0x34, 0xC7, 0xFB, 0xA7, 0xB3,
+    0xF8, 0x0C, 0x51, 0x8C, 0x72, 0xD2, 0xD9, 0x72, 0xBC, 0x22, 0xE3, 0x33, 0x8B, 0x17, 0xAF, 0x75,
+    0xF8, 0xE6, 0x5F, 0xA1, 0xFC, 0xBB, 0x16, 0xBF, 0xF1, 0x31, 0x39, 0xB9, 0x67, 0xD0, 0x3E, 0x96,
+    0x9E, 0x1C, 0xEE, 0xC7, 0x70, 0x3F, 0x80, 0xE2, 0xF8, 0x7D, 0x4D, 0x3C, 0xA2, 0x19, 0x1E, 0xB2,
+    0xFE, 0xD0, 0xD0, 0x22, 0x73, 0xE1, 0x5B, 0x80, 0x05, 0x9E, 0x46, 0xDD, 0x1F, 0x51, 0xE9, 0x65,
+    0xCD, 0xE9, 0xAF, 0x1E, 0xF0, 0xF8, 0x5D, 0x60, 0x0B, 0xD8, 0x02, 0x7E, 0x37, 0x33, 0xDA, 0x47,
+    0x14, 0xA7, 0x23, 0xCA, 0x1F, 0x02, 0xEA, 0xB7, 0x8F, 0x34, 0x9C, 0x8E, 0x2A, 0xBF, 0x5A, 0xB4,
+    0x78, 0x18, 0xD5, 0xB3, 0xBD, 0xE2, 0x24, 0x6F, 0xF8, 0xF2, 0xD9, 0x0C, 0x31, 0x79, 0x5E, 0x3D,
+    0x3B, 0x49, 0x78, 0x09, 0xE3, 0xB4, 0xD3, 0xD7, 0x82, 0x08, 0x22, 0x7E, 0x07, 0x00, 0xAE, 0x01,
+    0xEB, 0xF8, 0xDA, 0x13, 0xF8, 0xF7, 0xBF, 0x8F, 0xB3, 0xF8, 0x1F, 0x8B, 0xDF, 0x06, 0xFE, 0x33,
+    0x08, 0xE0, 0x00, 0xB0, 0x82, 0x27, 0x9E, 0x00, 0x9E, 0xFF, 0x6B, 0x00, 0xF8, 0xDA, 0x77, 0x7A,
+    0xE0, 0xF7, 0xAF, 0xDD, 0x07, 0x14, 0x5F, 0xFB, 0xCE, 0x13, 0xC0, 0x7A, 0x7F, 0x00, 0x38, 0x08,
+    0xFC, 0x1A, 0x4A, 0x00, 0xFF, 0x77, 0xF1, 0xFB, 0xF8, 0xED, 0xE2, 0xDF, 0xFF, 0x01, 0x9E, 0x03,
+    0xD6, 0xF1, 0xB5, 0x1C, 0xEF, 0x0B, 0xE5, 0x0B, 0xE5, 0xBF, 0x31, 0xCE, 0xF4, 0xBA, 0xC7, 0x81,
+    0x56, 0xB7, 0xAF, 0x34, 0xD7, 0x86, 0x75, 0x14, 0xF5, 0xA5, 0xF7, 0xFC, 0x53, 0xF2, 0xBC, 0x47,
+    0xB1, 0xD5, 0xD6, 0xF4, 0xCD, 0x8D, 0xE9, 0x18, 0x5E, 0x3E, 0xF2, 0xCC, 0x11, 0x10, 0xD8, 0x02,
+    0xEE, 0x03, 0xC4, 0xAF, 0x99, 0xD7, 0x26, 0x7D, 0xE9, 0x7F, 0x41, 0x8B, 0xB3, 0xAF, 0x3C, 0x53,
+    0x0D, 0x8D, 0xFB, 0x8D, 0x27, 0xAA, 0xA1, 0xEE, 0x5F, 0x31, 0xFF, 0x18, 0x4F, 0x60, 0xFD, 0x99,
+    0xD2, 0xD7, 0x57, 0xC7, 0xFA, 0xDA, 0x53, 0xFA, 0xB1, 0x6F, 0x3C, 0x71, 0xFF, 0xFD, 0x87, 0x9A,
+    0xCA, 0x3F, 0xD5, 0x34, 0xCF, 0x75, 0x40, 0x19, 0xF4, 0x5B, 0x51, 0x39, 0x08, 0xF7, 0x0F, 0xFF,
+    0x1F, 0x1D, 0xEA, 0x41, 0xFA, 0x5F, 0x7F, 0x22, 0xF7, 0x9C, 0xFF, 0x61, 0xEB, 0x2F, 0x7E, 0x7C,
+    0xE4, 0xFE, 0x1F, 0x1F, 0xB9, 0xFF, 0xE8, 0xD6, 0x53, 0xCD, 0xB5, 0xF1, 0x21, 0xD1, 0x9A, 0x5F,
+    0xFC, 0x9B, 0xC2, 0x7D, 0xFD, 0x19, 0x00, 0x78, 0x45, 0x3B, 0x40, 0x04, 0x19, 0x81, 0x93, 0x5E,
+    0x64, 0x4F, 0x01, 0x86, 0x8C, 0xC0, 0x01, 0x9B, 0x3A, 0x7C, 0x9A, 0x77, 0x16, 0x8B, 0xC5, 0xE2,
+    0x5C, 0x76, 0x2E, 0x00, 0x7C, 0xE0, 0x6E, 0x9F, 0x44, 0xFB, 0x68, 0x43, 0x72, 0x11, 0xF4, 0x4D,
+    0x92, 0xD3, 0x53, 0x58, 0xB1, 0xEC, 0x0F, 0xCD, 0xDC, 0xE8, 0xDA, 0x06, 0x80, 0x07, 0xC8, 0x31,
+    0xFB, 0x2A, 0x68, 0x2B, 0xFE, 0xCD, 0x3F, 0xE3, 0xD0, 0xBC, 0x0D, 0x3C, 0x30, 0xEA, 0x16, 0x28,
+    0xC2, 0x2A, 0xF6, 0x99, 0xA7, 0x01, 0x10, 0xED, 0xE6, 0xE6, 0xE6, 0xE6, 0x9F, 0x0C, 0x24, 0xC9,
+    0xC9, 0x92, 0xCC, 0xCC, 0x84, 0xE8, 0x00, 0xA0, 0xC0, 0xCA, 0x59, 0x19, 0xF0, 0xCD, 0x26, 0x1E,
+    0xF9, 0xE6, 0xD1, 0xA7, 0x9B, 0xFF, 0x08, 0x1C, 0x78, 0xF8, 0xEE, 0x95, 0xCA, 0x26, 0x5F, 0xFE,
+    0xFC, 0x59, 0x02, 0xFF, 0xFB, 0xBF, 0xFA, 0xE6, 0xFF, 0xF9, 0xC6, 0x5F, 0xBC, 0x54, 0x9C, 0x6D,
+    0xC2, 0x91, 0x6F, 0x1D, 0x39, 0x7C, 0xE4, 0xF0, 0xB7, 0x9E, 0xAE, 0x47, 0x60, 0x75, 0xE5, 0xC8,
+    0xE1, 0x23, 0x87, 0x8F, 0x1C, 0x3E, 0xF2, 0xAD, 0x63, 0xCF, 0x34, 0xFF, 0x2F, 0x70, 0xE0, 0xAC,
+    0xBD, 0xE4, 0x0E, 0xE3, 0xAF, 0xB0, 0x7D, 0x8A, 0x00, 0xFE, 0x4B, 0x7C, 0xEB, 0xC0, 0x5F, 0xAA,
+    0x94, 0xBF, 0x38, 0xF6, 0x8C, 0xFC, 0x8F, 0x80, 0x17, 0x4E, 0x7E, 0x5D, 0xC7, 0xF1, 0xFF, 0x3A,
+    0x7F, 0xB3, 0x7A, 0xF9, 0xB0, 0xFF, 0xAB, 0xFF, 0xFC, 0xF9, 0x3F, 0xD5, 0x8C, 0x47, 0x8E, 0x1D,
+    0x3E, 0xF2, 0x4D, 0xB9, 0xDC, 0xEE, 0xFF, 0x27, 0xDF, 0x7D, 0xF9, 0xE5, 0xBA, 0x7D, 0xA9, 0x6E,
+    0x5F, 0xC2, 0xC1, 0xE2, 0xB6, 0xFE, 0xE9, 0x70, 0xB8, 0x18, 0xE4, 0xFA, 0x16, 0xB0, 0xBA, 0x22,
+    0xAB, 0x67, 0x5F, 0x73, 0x0F, 0x79, 0xF9, 0x52, 0x11, 0x70, 0x14, 0xAB, 0x6B, 0xDF, 0x3C, 0x22,
+    0xC7, 0x6A, 0xA8, 0xFD, 0xE1, 0xA7, 0x8E, 0x7C, 0x6B, 0x65, 0x1D, 0x22, 0xC3, 0xA6, 0xCA, 0x98,
+    0x75, 0x10, 0xEB, 0xB3, 0x91, 0x84, 0x25, 0xCF, 0x91, 0x37, 0xC8, 0x1D, 0x02, 0xD6, 0x65, 0xAA,
+    0x1E, 0x25, 0x17, 0x2F, 0x64, 0x69, 0xE6, 0x65, 0xF2, 0xBD, 0x7B, 0x9F, 0x00, 0xF6, 0xFA, 0x62,
+    0xF9, 0x4D, 0x86, 0xC2, 0xA2, 0x62, 0xB6, 0x19, 0xD8, 0xBD, 0xCC, 0x90, 0x87, 0x92, 0xC0, 0xBD,
+    0x97, 0xEF, 0xB3, 0x43, 0x49, 0xB2, 0x83, 0x22, 0x13, 0x4A, 0xEE, 0x70, 0x84, 0xF2, 0x05, 0xBB,
+    0x5D, 0x54, 0x9D, 0xD9, 0x03, 0xD8, 0xD1, 0x95, 0xBC, 0xEF, 0xE4, 0x04, 0xE5, 0x49, 0x94, 0x94,
+    0xEC, 0xA1, 0x3C, 0xC7, 0xA5, 0x5C, 0x62, 0xB3, 0x45, 0x33, 0x2E, 0x69, 0xD4, 0x5D, 0xDB, 0xBF,
+    0x8A, 0x8C, 0x86, 0xBC, 0x36, 0x9F, 0x3E, 0x6C, 0x66, 0xF0, 0xA9, 0x4F, 0x98, 0xC5, 0xD8, 0x6D,
+    0x45, 0x86, 0x9A, 0x8C, 0x15, 0xAF, 0x5B, 0xC1, 0xAE, 0xF8, 0x36, 0xDB, 0x7D, 0xCC, 0xC3, 0xF6,
+    0xE6, 0x46, 0x45, 0xB2, 0x20, 0xE9, 0x0C, 0xE9, 0x9B, 0x71, 0xA6, 0xE2, 0xD9, 0x65, 0xD2, 0xBD,
+    0x62, 0x8B, 0xD6, 0xA6, 0x7F, 0xE6, 0x25, 0x19, 0x60, 0xC9, 0xAC, 0x92, 0x9D, 0xF9, 0xA8, 0x07,
+    0xD8, 0xD7, 0xE4, 0x6B, 0x64, 0xD0, 0x3B, 0xF6, 0x52, 0xC0, 0xEA, 0x0C, 0x93, 0x31, 0xF7, 0xCA,
+    0xB0, 0x2D, 0x5B, 0xD8, 0x00, 0xD8, 0x2C, 0xF2, 0x50, 0xDB, 0x10, 0x89, 0xDF, 0xE3, 0x9B, 0xD9,
+    0x79, 0xD5, 0x52, 0x86, 0x6D, 0x3E, 0x0C, 0x42, 0x9C, 0x0F, 0x0E, 0x10, 0xEF, 0x4E, 0xE6, 0xE4,
+    0xA5, 0xF7, 0xC3, 0x31, 0x99, 0xA7, 0x32, 0xE3, 0xAA, 0xF0, 0x59, 0x0F, 0x68, 0x3C, 0x8C, 0x2B,
+    0x88, 0x2A, 0x7C, 0xD6, 0x4B, 0xEB, 0x44, 0x3A, 0x68, 0x47, 0x4D, 0xC7, 0x30, 0x03, 0xF6, 0x34,
+    0x39, 0x02, 0x90, 0xD9, 0xD8, 0x46, 0x90, 0xEC, 0xB2, 0x50, 0x79, 0x00, 0x60, 0x3A, 0x39, 0x01,
+    0x68, 0x06, 0x91, 0xB2, 0xF4, 0x85, 0x1D, 0x50, 0x24, 0xE8, 0x9D, 0x1F, 0x02, 0xB6, 0x95, 0xA4,
+    0x87, 0xEA, 0x05, 0xC9, 0xB6, 0x1E, 0x41, 0xD2, 0x97, 0x11, 0x7A, 0x68, 0x22, 0x08, 0x39, 0x81,
+    0x9D, 0x76, 0x19, 0x03, 0xED, 0x33, 0x1E, 0x3A, 0x40, 0x0F, 0x22, 0x95, 0x84, 0x9C, 0x4A, 0x2E,
+    0xD8, 0x09, 0xBE, 0xC8, 0x2B, 0x74, 0x20, 0xF9, 0x16, 0x07, 0x68, 0x72, 0xE0, 0x00, 0x49, 0xB6,
+    0x4B, 0xFE, 0xCA, 0x38, 0xE8, 0x6C, 0x46, 0xA2, 0xFB, 0xCF, 0x74, 0x22, 0xC9, 0xED, 0x7C, 0x62,
+    0x9F, 0x4F, 0xA3, 0xB9, 0xBE, 0xB0, 0x3B, 0x0C, 0xC6, 0x41, 0xF7, 0x75, 0x34, 0x0E, 0xBA, 0xCF,
+    0x62, 0x95, 0x0F, 0x9C, 0xF2, 0xB3, 0xEB, 0x36, 0x18, 0x07, 0x4D, 0x8E, 0xF9, 0xD4, 0x1B, 0x07,
+    0x3D, 0xC7, 0x89, 0x86, 0xD9, 0x95, 0x18, 0x7D, 0x91, 0xB9, 0x1C, 0xE5, 0x31, 0x0B, 0xE4, 0xF2,
+    0x38, 0xB3, 0x0E, 0x80, 0x7A, 0x7F, 0xAB, 0x43, 0x9D, 0x87, 0x59, 0x56, 0x5D, 0x32, 0x40, 0xF9,
+    0x92, 0x5D, 0x1D, 0xA0, 0x67, 0xB0, 0xAD, 0x75, 0x25, 0x33, 0x96, 0xB5, 0xCE, 0x0F, 0xEF, 0x0D,
+    0xCC, 0xFC, 0x67, 0xC9, 0x36, 0x33, 0x9F, 0xE0, 0x6C, 0x11, 0xB5, 0x0B, 0xF4, 0x6F, 0x3C, 0x94,
+    0x37, 0x0E, 0x7C, 0x98, 0x90, 0xA1, 0x0A, 0xB0, 0xAE, 0xF1, 0x55, 0x84, 0x71, 0x7A, 0x28, 0x58,
+    0x12, 0x55, 0x68, 0x46, 0x34, 0x3B, 0xEC, 0x60, 0x18, 0x50, 0x90, 0x1E, 0x15, 0x39, 0xA0, 0xF1,
+    0xB6, 0x87, 0x71, 0x74, 0x05, 0x0B, 0x76, 0x55, 0x28, 0xD9, 0x36, 0x5E, 0x10, 0xC6, 0x55, 0xA9,
+    0x60, 0x36, 0xF9, 0x93, 0xA1, 0xF1, 0x68, 0xA6, 0xAC, 0x88, 0xB1, 0xFD, 0x2C, 0xDA, 0xCF, 0x07,
+    0xDD, 0xEE, 0xE5, 0xA2, 0xF1, 0x68, 0xA2, 0x71, 0xE0, 0x6D, 0xA2, 0xE2, 0xB5, 0x00, 0xCD, 0x13,
+    0xBE, 0x60, 0x34, 0x4E, 0xF2, 0x36, 0x61, 0xEC, 0xB5, 0x20, 0x02, 0x4F, 0xF8, 0xE6, 0x6A, 0x34,
+    0x8E, 0xF2, 0x36, 0xAB, 0x51, 0x5F, 0x0B, 0xDA, 0xF1, 0xC4, 0xBB, 0x51, 0x44, 0x73, 0xC5, 0xCB,
+    0xDB, 0x34, 0xAD, 0xBE, 0xC6, 0x00, 0x9E, 0x60, 0x2F, 0xA2, 0x21, 0xE4, 0x6D, 0x8E, 0xD0, 0xD7,
+    0xE8, 0xC0, 0x13, 0x11, 0x22, 0x62, 0x03, 0x1B, 0x10, 0x41, 0x4C, 0xA8, 0x26, 0xDD, 0x43, 0x66,
+    0xF4, 0xC6, 0x30, 0xCB, 0x49, 0x72, 0x26, 0xCA, 0xA4, 0x07, 0x48, 0x6F, 0x1D, 0xAC, 0x63, 0x2B,
+    0x62, 0x49, 0x34, 0xBE, 0x0A, 0xB0, 0x9D, 0x9C, 0x44, 0x40, 0xE3, 0x9B, 0x01, 0xBA, 0x67, 0x0B,
+    0x73, 0x31, 0x00, 0x54, 0x3D, 0x8A, 0x44, 0x64, 0x2F, 0x00, 0x35, 0x1D, 0x20, 0x13, 0x00, 0x3D,
+    0x02, 0x05, 0x1D, 0x0E, 0x9E, 0x0B, 0xB3, 0x99, 0x3C, 0xD3, 0x6C, 0x15, 0x8F, 0xF5, 0x5C, 0x7C,
+    0xF5, 0xA9, 0x8D, 0x0F, 0x3E, 0xB3, 0x59, 0xC3, 0xB0, 0x6B, 0x1E, 0xB9, 0x77, 0xB1, 0xD6, 0xA2,
+    0xD8, 0xCC, 0x1D, 0xAC, 0x0E, 0x40, 0x35, 0x65, 0xDB, 0x8E, 0x79, 0x98, 0x28, 0xB6, 0x82, 0x74,
+    0x9A, 0x3C, 0xCD, 0x82, 0xC7, 0xC7, 0x32, 0x19, 0x57, 0x25, 0xEE, 0xFD, 0x66, 0x28, 0x62, 0x95,
+    0x00, 0x99, 0xDA, 0x3F, 0x97, 0xA4, 0x6F, 0x48, 0x57, 0x73, 0x7B, 0x09, 0x43, 0xDB, 0x67, 0x1B,
+    0x10, 0x30, 0xCB, 0x15, 0xBB, 0x7D, 0xE0, 0x56, 0x3B, 0x96, 0xC9, 0xB2, 0xB3, 0xA4, 0x57, 0xE9,
+    0x44, 0xAA, 0x23, 0x78, 0x81, 0x50, 0x9F, 0xDA, 0x36, 0xA0, 0xE0, 0x3C, 0x28, 0xF4, 0x80, 0x83,
+    0x76, 0xCC, 0x56, 0xB6, 0x8C, 0x80, 0x9A, 0x80, 0x62, 0x13, 0x75, 0x44, 0xE3, 0xA1, 0x1D, 0xB6,
+    0xE6, 0x1C, 0x59, 0xC6, 0x79, 0x7B, 0x7D, 0xC3, 0x76, 0xF8, 0xA5, 0x5B, 0x5E, 0x78, 0xA6, 0xA5,
+    0x0D, 0xF0, 0x76, 0x25, 0x52, 0x06, 0x48, 0xA6, 0x45, 0x47, 0x06, 0x49, 0x3A, 0xFB, 0xFA, 0x46,
+    0x1D, 0x00, 0xD3, 0x43, 0xF0, 0xEC, 0xBF, 0x68, 0xC8, 0xCE, 0x70, 0x82, 0x9D, 0x75, 0xBC, 0x28,
+    0x38, 0xAB, 0x4B, 0x47, 0xDB, 0xFD, 0x96, 0x1E, 0x50, 0x27, 0xEC, 0xA9, 0x4B, 0xDB, 0x92, 0x1E,
+    0x75, 0x00, 0xF8, 0x34, 0xCC, 0x15, 0xF2, 0x16, 0xE9, 0x0D, 0x07, 0xAC, 0x01, 0x68, 0xDE, 0x24,
+    0x4D, 0x8B, 0x32, 0xD9, 0x73, 0x37, 0x76, 0xEE, 0x3D, 0x4C, 0x80, 0xBC, 0x7C, 0xE9, 0xD6, 0x18,
+    0xE2, 0x31, 0x35, 0x63, 0x87, 0xEB, 0x50, 0x12, 0xD6, 0x29, 0xFF, 0xB1, 0x17, 0x00, 0x54, 0x2F,
+    0x27, 0x91, 0x60, 0x30, 0x8B, 0xD5, 0xD9, 0xE9, 0x21, 0x23, 0x6A, 0x3F, 0xF1, 0xE2, 0xEF, 0xEC,
+    0xFB, 0x0C, 0x36, 0x36, 0x13, 0x90, 0x27, 0x74, 0x4D, 0x3A, 0x40, 0x92, 0x1E, 0xA8, 0xE2, 0xE3,
+    0x01, 0x28, 0x52, 0x49, 0x00, 0xA6, 0xB3, 0x7C, 0x1B, 0x4D, 0xAF, 0xC8, 0xBE, 0x1A, 0x6B, 0x32,
+    0x94, 0xB1, 0xE4, 0x9F, 0xB0, 0xB3, 0xAD, 0x75, 0xCA, 0x2B, 0xA7, 0x7C, 0x15, 0xA4, 0xAF, 0x43,
+    0xC9, 0xC7, 0x43, 0xC9, 0x3F, 0xA6, 0x4D, 0xB0, 0xE4, 0x15, 0x42, 0x91, 0x57, 0x89, 0x9A, 0x69,
+    0x29, 0xD1, 0xB5, 0x9D, 0x9C, 0x3E, 0xE1, 0xF8, 0xFA, 0x89, 0xED, 0x75, 0x58, 0x92, 0xEC, 0xED,
+    0x1E, 0x7D, 0x17, 0x6D, 0x27, 0xA7, 0x2A, 0xD9, 0x4E, 0x4E, 0x25, 0x77, 0x8F, 0xDB, 0x8F, 0x27,
+    0xDB, 0x49, 0x32, 0xD8, 0x4E, 0x92, 0xA3, 0xED, 0x24, 0xF3, 0x32, 0xF5, 0x65, 0x77, 0xCF, 0xB5,
+    0x4C, 0x4E, 0x94, 0xCC, 0xDA, 0x74, 0x39, 0xEC, 0x3A, 0x46, 0xB2, 0x5D, 0x15, 0x6C, 0x27, 0x47,
+    0xDB, 0xE9, 0xC1, 0x76, 0xD6, 0xD9, 0x53, 0x84, 0x3D, 0x1D, 0x61, 0x39, 0xC1, 0xD2, 0xE7, 0xF3,
+    0xCD, 0x08, 0x7B, 0x9A, 0xB0, 0xA7, 0xD8, 0xD9, 0xCE, 0xF6, 0xB6, 0xD3, 0xDE, 0x76, 0x32, 0xD8,
+    0xAE, 0x8E, 0xD9, 0x35, 0x43, 0x9B, 0x3B, 0x7F, 0x33, 0xCC, 0x36, 0x59, 0xEB, 0xCB, 0x9A, 0x8B,
+    0xB6, 0x6B, 0xA2, 0xED, 0x74, 0xB4, 0x9D, 0x89, 0xB6, 0x63, 0xB4, 0xCF, 0xA6, 0x68, 0x4F, 0xDF,
+    0x89, 0xF6, 0xBB, 0xB7, 0xA2, 0x3D, 0x7E, 0x35, 0xDA, 0x93, 0x17, 0xA3, 0xB5, 0x22, 0xDA, 0x24,
+    0xA2, 0x0D, 0x22, 0xDA, 0x49, 0x44, 0xEB, 0x45, 0xB4, 0x83, 0x88, 0x78, 0x12, 0x2F, 0xA0, 0xF6,
+    0xAA, 0x87, 0xB9, 0x16, 0xB2, 0x5B, 0xB8, 0x9A, 0xFD, 0xEE, 0xB4, 0x20, 0x08, 0x11, 0x1B, 0x0F,
+    0xE3, 0xD8, 0x65, 0x90, 0x49, 0x6B, 0x5C, 0xE3, 0x45, 0x2C, 0x13, 0x1A, 0xAF, 0x1D, 0x58, 0x85,
+    0x2C, 0xA0, 0x35, 0x57, 0x3C, 0x44, 0x4C, 0x33, 0x28, 0x8F, 0x01, 0xA8, 0xD9, 0xCD, 0xC6, 0x68,
+    0x9C, 0xE7, 0xA1, 0x2A, 0x64, 0x82, 0xEA, 0xA0, 0xF5, 0x79, 0x3E, 0x94, 0xEC, 0x00, 0x9E, 0x05,
+    0x6C, 0x57, 0xEF, 0x24, 0xA8, 0x1B, 0x13, 0xEC, 0xB9, 0xA1, 0x4C, 0xBF, 0xE4, 0xF6, 0xF5, 0x13,
+    0x3B, 0x24, 0x6F, 0x90, 0x3C, 0x97, 0x9D, 0x91, 0x01, 0xB6, 0x43, 0x99, 0x32, 0x84, 0x1E, 0xC8,
+    0xE4, 0x67, 0x15, 0x4C, 0xBF, 0xFF, 0xA4, 0x87, 0x62, 0x79, 0x6A, 0xEB, 0xA0, 0x3D, 0x96, 0xA7,
+    0xAE, 0x0E, 0xCA, 0x17, 0x74, 0x72, 0x6A, 0x46, 0x41, 0x27, 0x47, 0x39, 0xE5, 0x53, 0xA8, 0xD8,
+    0x37, 0xBE, 0x0E, 0x92, 0x43, 0xE3, 0x45, 0x94, 0xF4, 0x6A, 0x10, 0xA9, 0x79, 0x73, 0xD4, 0x7D,
+    0x41, 0x75, 0x65, 0x32, 0x0E, 0x34, 0xCF, 0x05, 0xDB, 0xC1, 0xF2, 0x91, 0x44, 0x40, 0xB3, 0x60,
+    0x02, 0x14, 0xC1, 0x00, 0xC8, 0x04, 0x33, 0x01, 0x55, 0x84, 0xF6, 0x30, 0xAE, 0x0E, 0xB0, 0x3F,
+    0xF0, 0x05, 0xA1, 0xDF, 0x09, 0x30, 0x4E, 0x8E, 0x6C, 0x1B, 0x2F, 0xA2, 0xEE, 0x45, 0x04, 0xEB,
+    0x09, 0xEC, 0xCC, 0x79, 0x42, 0x0F, 0x6A, 0xD0, 0x4E, 0x05, 0x39, 0xCA, 0x51, 0x52, 0x84, 0x22,
+    0xD5, 0xFC, 0x29, 0xA1, 0x2F, 0xDE, 0x0D, 0xB6, 0xAD, 0xDF, 0x0F, 0xD4, 0x0E, 0x8C, 0x0D, 0x7B,
+    0x28, 0x96, 0xF4, 0x10, 0x6C, 0xF5, 0x88, 0xBC, 0xF4, 0x17, 0x9C, 0x21, 0xF8, 0x19, 0xCB, 0x41,
+    0x8E, 0x20, 0x99, 0xA9, 0xAB, 0xBC, 0xF4, 0x1B, 0x07, 0x14, 0x4C, 0x67, 0x51, 0x91, 0x13, 0x9A,
+    0x59, 0x27, 0x3E, 0x15, 0x84, 0xF1, 0x55, 0x80, 0x71, 0x8D, 0x07, 0x5B, 0xE3, 0xAA, 0x50, 0x10,
+    0xDA, 0x57, 0xE9, 0x1C, 0xBB, 0xE5, 0x5B, 0xAE, 0x20, 0xDF, 0xC6, 0x2E, 0xCC, 0x7F, 0x2F, 0xC2,
+    0xA5, 0xC7, 0x30, 0x48, 0x32, 0x2C, 0xD3, 0xD8, 0x7D, 0x8B, 0x3B, 0x2D, 0xCC, 0x6C, 0x78, 0x36,
+    0x54, 0x61, 0x85, 0xAE, 0xF1, 0x05, 0x61, 0x9C, 0x08, 0x39, 0x59, 0x92, 0x5D, 0x93, 0xED, 0xD3,
+    0x96, 0x13, 0x42, 0xE3, 0x51, 0x72, 0xBB, 0x0A, 0xA8, 0xC9, 0xDB, 0x39, 0x5E, 0xE3, 0x24, 0xAF,
+    0xB3, 0xF1, 0x75, 0x42, 0xF9, 0x68, 0x10, 0x09, 0x28, 0x38, 0x03, 0x05, 0xAC, 0x03, 0x9A, 0x1D,
+    0xBB, 0xB3, 0x78, 0xBE, 0x22, 0xC9, 0x58, 0x90, 0x24, 0x5B, 0x43, 0x92, 0x7D, 0xE3, 0xF5, 0x00,
+    0x54, 0x41, 0x06, 0xA0, 0x60, 0x9E, 0xB8, 0x9C, 0xF1, 0x40, 0xE3, 0x65, 0x02, 0x1E, 0x0D, 0x05,
+    0xB7, 0x1F, 0x7F, 0x97, 0x50, 0x64, 0x30, 0x6E, 0x76, 0x53, 0x37, 0x4F, 0x4D, 0x4B, 0x12, 0x52,
+    0xF7, 0x30, 0x3C, 0x33, 0x81, 0xBC, 0x93, 0x40, 0x06, 0x76, 0x76, 0xF8, 0x0D, 0x3D, 0xE8, 0x01,
+    0x72, 0x92, 0x1E, 0x99, 0x03, 0x26, 0x49, 0xAF, 0x49, 0x06, 0x99, 0xCE, 0xED, 0x2C, 0x44, 0x12,
+    0x01, 0x60, 0xC7, 0x0E, 0x7A, 0x50, 0x63, 0x71, 0x65, 0x12, 0xE4, 0xAD, 0x04, 0xCD, 0xC0, 0xAE,
+    0xCC, 0x76, 0xE9, 0x4B, 0xBD, 0x2C, 0x54, 0x76, 0x99, 0x33, 0x02, 0x30, 0xB6, 0x03, 0xEA, 0xF7,
+    0x02, 0x66, 0x1C, 0xA2, 0x72, 0x04, 0x44, 0xA8, 0x3D, 0x60, 0xBE, 0x67, 0x3B, 0xD4, 0x64, 0x00,
+    0xC8, 0xEC, 0x88, 0x21, 0x41, 0x04, 0x73, 0xC6, 0x43, 0x5F, 0x9A, 0x4C, 0x5B, 0x8F, 0xE6, 0x74,
+    0x00, 0xAB, 0x49, 0xBB, 0xC6, 0x9B, 0x53, 0xA9, 0x8C, 0xD5, 0x24, 0xBD, 0x76, 0xA6, 0xE3, 0xA3,
+    0xA1, 0x9A, 0xAA, 0x89, 0xAD, 0xE9, 0xB4, 0x9B, 0xCD, 0x18, 0x13, 0x50, 0x30, 0x00, 0xF5, 0x9D,
+    0x11, 0xD0, 0x67, 0x3C, 0xCA, 0xD0, 0x38, 0xC8, 0x41, 0x77, 0x30, 0x24, 0x04, 0x33, 0x34, 0x23,
+    0xC0, 0xAA, 0x4B, 0xA3, 0x08, 0x56, 0x7A, 0xF5, 0x5A, 0xD0, 0x8E, 0xB5, 0x37, 0xCF, 0x4D, 0xCA,
+    0x51, 0xF7, 0xB6, 0x8C, 0xC6, 0x41, 0xC6, 0x4C, 0xCD, 0x64, 0xBB, 0x76, 0x9D, 0x7D, 0xB4, 0x19,
+    0xDB, 0xC1, 0x38, 0x58, 0xE5, 0x60, 0x1C, 0x52, 0xD3, 0xC3, 0xB8, 0x22, 0x4A, 0x0F, 0xE3, 0x44,
+    0xA8, 0x3D, 0xCC, 0xF5, 0x17, 0xB7, 0x1F, 0xCF, 0x16, 0x89, 0xB9, 0x73, 0x91, 0x31, 0x9F, 0x12,
+    0x8C, 0xD3, 0x97, 0x26, 0xE6, 0x93, 0x69, 0x8D, 0xB3, 0x8F, 0x4E, 0xDA, 0x19, 0xC7, 0x6A, 0xD2,
+    0xCE, 0x9C, 0x67, 0x35, 0x35, 0x83, 0xB9, 0x10, 0xAB, 0x49, 0x7A, 0x73, 0x31, 0x54, 0x93, 0x1C,
+    0xCD, 0xA5, 0x50, 0x4D, 0xD5, 0x64, 0xAE, 0x4C, 0xD5, 0x24, 0x42, 0x76, 0xA8, 0xA9, 0x1C, 0x74,
+    0x40, 0xED, 0xA1, 0xD8, 0x95, 0x01, 0xF2, 0x86, 0x87, 0x45, 0xED, 0x23, 0x94, 0x13, 0x41, 0xBB,
+    0x9A, 0x4C, 0x8F, 0x8F, 0x65, 0x4E, 0xD0, 0x92, 0xA4, 0x53, 0xAF, 0x9B, 0x9B, 0x77, 0xA7, 0xDA,
+    0xCB, 0x5B, 0x81, 0x65, 0xA8, 0x46, 0x36, 0xBD, 0x15, 0x41, 0x5F, 0x0C, 0xEA, 0x7C, 0x92, 0x9E,
+    0x8F, 0x79, 0xFB, 0x48, 0x68, 0x7E, 0x16, 0xB4, 0xA3, 0x08, 0x15, 0x49, 0xBA, 0x86, 0x4B, 0xC7,
+    0x3E, 0xB9, 0x24, 0x0E, 0xB6, 0x13, 0x01, 0x60, 0xAB, 0x7B, 0x80, 0x8F, 0x44, 0x00, 0x54, 0x03,
+    0x50, 0x90, 0x00, 0x14, 0xD9, 0x22, 0x8F, 0x45, 0x4D, 0xB2, 0x2D, 0x78, 0xEE, 0x0E, 0x21, 0x27,
+    0x73, 0x31, 0xC2, 0x9C, 0x67, 0x3D, 0x95, 0xAC, 0x42, 0xE3, 0xE5, 0xD8, 0x78, 0xDD, 0x1B, 0x67,
+    0x9C, 0x7D, 0x96, 0x05, 0x0B, 0xCA, 0xB1, 0x0A, 0x22, 0x1A, 0xD7, 0xF8, 0x7A, 0x6A, 0x48, 0x9E,
+    0x22, 0x39, 0x2B, 0x6E, 0x9D, 0xEA, 0x91, 0xEA, 0x11, 0xD5, 0x76, 0x02, 0x54, 0xF6, 0xE9, 0x88,
+    0x72, 0xAE, 0xD2, 0x41, 0xBE, 0x17, 0x2C, 0xA2, 0xBA, 0x38, 0xAA, 0x0B, 0x41, 0x9F, 0x0E, 0xEA,
+    0x42, 0xD0, 0xDF, 0x0E, 0xCD, 0x1B, 0x5E, 0xB9, 0x64, 0x9C, 0x25, 0x39, 0x35, 0x5E, 0x91, 0x64,
+    0x95, 0x0B, 0x74, 0x8A, 0xB0, 0x24, 0x9D, 0x71, 0x72, 0x5A, 0x4E, 0x05, 0xDA, 0x55, 0x01, 0xD2,
+    0xEB, 0xBE, 0x20, 0x0A, 0xEA, 0x01, 0xE6, 0xFA, 0xC2, 0x72, 0x40, 0x43, 0x2E, 0x05, 0x05, 0xE4,
+    0x98, 0x47, 0x1C, 0x61, 0x5C, 0xB3, 0x43, 0x33, 0x34, 0x5E, 0x8E, 0xF6, 0x52, 0xA8, 0x42, 0x15,
+    0x94, 0xE7, 0x29, 0x96, 0xA9, 0x0E, 0x8D, 0x37, 0x8E, 0xDF, 0xA6, 0x08, 0x8D, 0x37, 0xCE, 0x3A,
+    0x3E, 0x17, 0xD4, 0xA0, 0xBC, 0x7A, 0x97, 0x72, 0xAC, 0x83, 0x08, 0xE6, 0x52, 0x28, 0x09, 0x76,
+    0x56, 0x90, 0x1C, 0xAD, 0x20, 0xE9, 0x6D, 0x41, 0x72, 0xB0, 0xB0, 0xAD, 0x71, 0x16, 0xCA, 0x11,
+    0x16, 0xF2, 0x56, 0x80, 0x25, 0x39, 0xC2, 0x32, 0x23, 0x1D, 0x49, 0xB6, 0x76, 0x93, 0xA4, 0xB3,
+    0x45, 0xD4, 0x67, 0x06, 0x5B, 0x06, 0xFD, 0x5D, 0x6F, 0xC5, 0xA4, 0x9F, 0xF3, 0xB6, 0x1A, 0xF5,
+    0xE9, 0xC9, 0xD6, 0x5E, 0x9F, 0x0E, 0x56, 0x0E, 0xFA, 0x54, 0x00, 0x70, 0x08, 0xAA, 0x53, 0x3D,
+    0x52, 0x1D, 0x21, 0x76, 0x66, 0x47, 0x2D, 0x35, 0xB7, 0x51, 0x93, 0x93, 0x20, 0x39, 0x34, 0xDB,
+    0x8F, 0xB3, 0x7D, 0x3E, 0x23, 0x80, 0xD8, 0x65, 0x45, 0x5E, 0x49, 0x1C, 0x78, 0x91, 0x0E, 0x64,
+    0x0F, 0xC9, 0x1D, 0xC0, 0x32, 0x66, 0xA3, 0x81, 0xBC, 0x2C, 0x8B, 0x30, 0x4F, 0x86, 0x32, 0x00,
+    0x0F, 0xB0, 0x53, 0x99, 0x3E, 0x0E, 0x82, 0xDC, 0x86, 0xF9, 0x79, 0x9B, 0x27, 0x43, 0xD3, 0x67,
+    0x06, 0x19, 0x0D, 0x39, 0xC2, 0x2C, 0x9D, 0xB0, 0x16, 0x6D, 0xF1, 0x7C, 0xE5, 0xE5, 0x58, 0x04,
+    0xFD, 0x43, 0xD8, 0x88, 0x03, 0xD9, 0xC7, 0xD7, 0x20, 0xC9, 0xF1, 0x60, 0x2B, 0xA7, 0x4C, 0xAD,
+    0xD7, 0x23, 0x0C, 0x07, 0x18, 0xB6, 0xB3, 0x63, 0x87, 0xD9, 0x68, 0x46, 0x04, 0xA0, 0x09, 0x25,
+    0x39, 0x36, 0xE4, 0xA0, 0x99, 0x5A, 0xF3, 0x7A, 0x0B, 0x3B, 0x23, 0x7A, 0x4D, 0xA6, 0xEA, 0x5D,
+    0x4D, 0x3A, 0x00, 0xAD, 0xE9, 0x74, 0xA7, 0x2F, 0x4F, 0x22, 0x88, 0x60, 0x3B, 0xED, 0x3E, 0xF1,
+    0xD2, 0x74, 0xDA, 0xE9, 0x4B, 0x41, 0x04, 0x11, 0x74, 0xAF, 0x9D, 0x7D, 0x96, 0x8F, 0x04, 0x35,
+    0xCA, 0xDC, 0xD4, 0x64, 0x66, 0xBB, 0x07, 0xE0, 0x5F, 0xA6, 0xB3, 0x33, 0x40, 0x2B, 0xD7, 0xC3,
+    0x87, 0x2E, 0xF7, 0xCC, 0xC9, 0x33, 0x88, 0x36, 0x3F, 0xE2, 0xFE, 0x40, 0x11, 0x44, 0x90, 0x23,
+    0x5B, 0x96, 0x49, 0xF7, 0xDA, 0x99, 0x2B, 0xA3, 0xF4, 0xF2, 0x56, 0x14, 0x41, 0x44, 0xB6, 0x04,
+    0x4D, 0xAF, 0x9D, 0x7E, 0x73, 0x94, 0x5E, 0xDE, 0xD9, 0x17, 0x38, 0x68, 0x67, 0x2E, 0x07, 0xE9,
+    0xB5, 0xE7, 0x3B, 0xD1, 0x8E, 0x8A, 0xE4, 0x54, 0x72, 0xC6, 0xE3, 0x0F, 0x33, 0xE7, 0x73, 0x6F,
+    0x42, 0x1F, 0x4E, 0xFD, 0xA3, 0x91, 0xFC, 0xDF, 0xB3, 0x93, 0x20, 0x04, 0x4B, 0x02, 0x7A, 0x60,
+    0x87, 0x3A, 0xE8, 0x1E, 0x60, 0x73, 0x7B, 0x73, 0xD3, 0x5C, 0xE3, 0x0C, 0x36, 0x63, 0x34, 0x24,
+    0x79, 0xC2, 0x03, 0xFA, 0x6A, 0x00, 0xA4, 0x67, 0x87, 0x2A, 0x28, 0x9F, 0xFD, 0xB2, 0x95, 0x84,
+    0xDD, 0x7E, 0xFC, 0x63, 0x90, 0xFC, 0xFB, 0x70, 0xDC, 0xD9, 0x0B, 0xC6, 0xF6, 0xC9, 0x49, 0x0F,
+    0x55, 0x30, 0x4E, 0x44, 0x7B, 0xFD, 0xC5, 0x64, 0xB3, 0x68, 0x2F, 0xD9, 0xEB, 0x2F, 0x26, 0xE3,
+    0x44, 0xD4, 0x7D, 0x15, 0xD4, 0x76, 0x76, 0xF5, 0xB7, 0x1F, 0xC7, 0x6D, 0x5B, 0x80, 0x27, 0x3D,
+    0xC0, 0xB7, 0x02, 0xC0, 0x89, 0x1D, 0xCC, 0x8E, 0xF2, 0x50, 0x5E, 0x04, 0xC8, 0x11, 0x6C, 0xAB,
+    0x00, 0xE5, 0xCB, 0x04, 0x11, 0x32, 0x68, 0xD6, 0x38, 0xA8, 0x41, 0x0D, 0x10, 0x41, 0x7A, 0x80,
+    0x8F, 0x06, 0xA0, 0xF9, 0x59, 0x5A, 0x62, 0x15, 0x68, 0x1C, 0xD0, 0xDC, 0xEC, 0x97, 0x08, 0x06,
+    0x06, 0x64, 0x27, 0x1B, 0xB3, 0x9F, 0xB2, 0x6C, 0xB4, 0x9C, 0x7D, 0x7A, 0xBC, 0x15, 0xD1, 0x24,
+    0x35, 0x08, 0xFE, 0x13, 0x42, 0x3B, 0x39, 0xD6, 0x13, 0x6C, 0xC7, 0x56, 0x84, 0xC6, 0x43, 0xBF,
+    0x16, 0x51, 0x24, 0xED, 0x20, 0xEF, 0x4C, 0x80, 0xB5, 0xD9, 0x8E, 0x6B, 0x5E, 0x79, 0x5C, 0x56,
+    0xA7, 0xAE, 0xAC, 0x6F, 0x02, 0x65, 0xD4, 0x0E, 0xD0, 0x17, 0x27, 0x40, 0x4C, 0x1A, 0x80, 0x16,
+    0x1E, 0x28, 0xDA, 0xD5, 0x5D, 0xB8, 0x07, 0x44, 0xB4, 0x0E, 0x82, 0x67, 0x3C, 0x04, 0xDF, 0x4A,
+    0x28, 0xF8, 0xF7, 0xD6, 0xC1, 0x3A, 0xE9, 0xA1, 0x7B, 0x11, 0xB3, 0x64, 0xAA, 0x9E, 0x20, 0xBD,
+    0x88, 0x10, 0xB1, 0x20, 0x60, 0x3B, 0xDB, 0x41, 0x7A, 0xED, 0x32, 0x05, 0x0B, 0xF3, 0xDD, 0x09,
+    0x90, 0xB7, 0x02, 0x20, 0x22, 0x01, 0x18, 0xDB, 0x02, 0x92, 0x6E, 0x59, 0x4A, 0x33, 0xCE, 0x96,
+    0x5E, 0x6B, 0x0F, 0xAF, 0x67, 0xE7, 0x6E, 0xF2, 0xDD, 0x04, 0xE8, 0x47, 0x3D, 0x10, 0x1A, 0xB7,
+    0x9B, 0x9D, 0x2F, 0xAC, 0xE8, 0x7B, 0xBF, 0xC2, 0x2E, 0x09, 0x1F, 0xBB, 0x14, 0x93, 0xEB, 0x59,
+    0xF1, 0x8D, 0x9A, 0x0B, 0x66, 0x24, 0x25, 0x5D, 0x86, 0x95, 0x40, 0x8D, 0x90, 0x93, 0x1E, 0x60,
+    0xAE, 0x12, 0xB0, 0x17, 0x88, 0x3A, 0xE8, 0x01, 0x55, 0x90, 0x23, 0x78, 0x3A, 0x02, 0xC6, 0xD1,
+    0x35, 0xDE, 0xF4, 0x10, 0xB1, 0x0A, 0x25, 0xAB, 0x08, 0xE8, 0x5E, 0xF7, 0xBA, 0x37, 0x3D, 0x44,
+    0x2C, 0x59, 0x05, 0x11, 0x01, 0xD3, 0x4B, 0x6F, 0x3B, 0x3D, 0xA0, 0x0A, 0xE0, 0xF1, 0x51, 0x10,
+    0xB0, 0xAE, 0x8A, 0x84, 0xF2, 0x90, 0x13, 0xF4, 0xCD, 0x21, 0xA7, 0x98, 0x8D, 0x82, 0xBF, 0x4F,
+    0x0F, 0x49, 0x37, 0xE7, 0x8B, 0x23, 0x40, 0x32, 0xC3, 0x3A, 0x0A, 0x2E, 0x9D, 0x6F, 0x61, 0x15,
+    0xCB, 0x21, 0x87, 0xA5, 0x88, 0x07, 0xD8, 0x57, 0xDA, 0x17, 0x77, 0xFB, 0xCF, 0xAE, 0x35, 0x25,
+    0xC7, 0x0F, 0xBE, 0xB4, 0x04, 0x05, 0x8B, 0x88, 0x2A, 0x08, 0xB2, 0xD7, 0x1E, 0xD6, 0x91, 0x2C,
+    0x08, 0x39, 0xAA, 0xA9, 0x09, 0x72, 0x2C, 0x28, 0x12, 0x4C, 0x6F, 0x9D, 0x1A, 0x8C, 0x13, 0x49,
+    0x84, 0xEC, 0xD4, 0x69, 0xD0, 0xBD, 0x71, 0xD6, 0x95, 0x2C, 0x52, 0x36, 0xBD, 0xF6, 0xD2, 0x13,
+    0xD6, 0x89, 0x04, 0x7B, 0xC2, 0x57, 0x01, 0x7A, 0x10, 0x3B, 0x31, 0x3B, 0xB3, 0xD2, 0x74, 0x25,
+    0x4F, 0xD1, 0x15, 0xB3, 0xF7, 0x57, 0x48, 0xB6, 0xD0, 0x8C, 0xD9, 0xC7, 0x84, 0x4D, 0x33, 0x1E,
+    0x74, 0x75, 0x5F, 0x41, 0xEA, 0xB0, 0xF4, 0xF0, 0x91, 0x9B, 0xEB, 0xA0, 0xF5, 0xF3, 0x7D, 0x58,
+    0xFE, 0x43, 0x83, 0xA5, 0xF7, 0x93, 0x0E, 0x00, 0x0E, 0x2C, 0x8D, 0xD1, 0x70, 0x80, 0x11, 0xA8,
+    0x96, 0x62, 0xBC, 0xD9, 0x15, 0x83, 0x4C, 0xEA, 0x32, 0x0B, 0x76, 0x68, 0x26, 0xED, 0x67, 0xFB,
+    0x91, 0x3A, 0x9A, 0x7E, 0xB6, 0x1A, 0x11, 0xC9, 0xF4, 0x80, 0x7E, 0x67, 0xEF, 0xF2, 0x6A, 0x42,
+    0x06, 0x6F, 0x81, 0x17, 0xD8, 0xA1, 0x09, 0x32, 0x35, 0xCF, 0x65, 0x42, 0x77, 0xF6, 0x96, 0x58,
+    0x31, 0x4F, 0x63, 0x69, 0x77, 0x9A, 0x3B, 0xD8, 0x2E, 0x29, 0x4D, 0xDD, 0x65, 0xD7, 0x19, 0x8A,
+    0xEC, 0x24, 0x99, 0x4A, 0xDA, 0x9B, 0xA3, 0x1E, 0x3C, 0x2F, 0x05, 0x54, 0xD1, 0x3A, 0xE8, 0x37,
+    0x3E, 0x84, 0x16, 0xBB, 0x9A, 0x0E, 0xD6, 0xA1, 0xB9, 0x9B, 0x32, 0x5F, 0x5C, 0x92, 0x13, 0x0E,
+    0x70, 0x7B, 0x8E, 0xFB, 0xE0, 0xFE, 0x06, 0x33, 0xE3, 0xDC, 0xB0, 0x3B, 0xB3, 0xD7, 0xA9, 0x00,
+    0x00, 0xCD, 0xC3, 0xD6, 0x01, 0xC0, 0x3F, 0xF5, 0x87, 0xF6, 0x77, 0x89, 0x62, 0xAE, 0xAF, 0x59,
+    0x86, 0x5D, 0xCD, 0x50, 0xE1, 0x27, 0x72, 0xDD, 0x0D, 0xB0, 0x6F, 0x03, 0xA4, 0x33, 0xF4, 0xD0,
+    0x59, 0x20, 0x23, 0xD3, 0x09, 0x1C, 0x3E, 0x91, 0x0A, 0x76, 0x87, 0x00, 0xED, 0x95, 0x07, 0x96,
+    0x24, 0x16, 0xE4, 0x94, 0x51, 0x36, 0xF6, 0x62, 0xC8, 0xCC, 0x49, 0x4E, 0xC5, 0x5C, 0xDA, 0xBB,
+    0x35, 0x0E, 0xE6, 0xE2, 0x8C, 0x98, 0xD6, 0x3D, 0x8C, 0x83, 0x3D, 0x4D, 0x54, 0x01, 0x72, 0x6A,
+    0xC6, 0xCC, 0x2E, 0xB2, 0xAF, 0x03, 0xAC, 0xAF, 0x79, 0x83, 0x3B, 0x36, 0x42, 0x93, 0x24, 0x3B,
+    0x90, 0x3B, 0xE4, 0x80, 0x82, 0xB1, 0xE2, 0x00, 0xE0, 0xD0, 0xCC, 0x15, 0x3C, 0xD9, 0x2E, 0xFF,
+    0x83, 0x05, 0xB2, 0x37, 0x0C, 0x40, 0x3F, 0x4E, 0x00, 0xE2, 0xB5, 0x7F, 0xFC, 0xE3, 0xDD, 0xF5,
+    0x25, 0x2F, 0x38, 0xB3, 0x43, 0xC7, 0x65, 0x39, 0xC7, 0xFD, 0xDD, 0xBC, 0x33, 0x11, 0x15, 0x43,
+    0x76, 0xEB, 0xD8, 0x6A, 0x0E, 0x6A, 0xFB, 0x89, 0xE2, 0xAF, 0x39, 0x3B, 0x11, 0x31, 0x0E, 0x00,
+    0x2F, 0x07, 0x20, 0x7B, 0x80, 0xDB, 0x80, 0xB9, 0x1C, 0x60, 0x5D, 0x15, 0xAC, 0xAB, 0x03, 0xEC,
+    0xA5, 0x00, 0xEB, 0x64, 0xD0, 0x43, 0x1D, 0xC0, 0xD3, 0xFC, 0x3E, 0x6F, 0x1B, 0xDF, 0xCC, 0x64,
+    0x34, 0xDF, 0x23, 0x5D, 0xC1, 0xA9, 0xE2, 0x80, 0xA5, 0x9F, 0xEB, 0xCD, 0x8C, 0xD3, 0x9D, 0xB5,
+    0x71, 0xB3, 0x7B, 0xAC, 0xFF, 0xEE, 0xA1, 0x6F, 0x00, 0xC0, 0xA1, 0x3D, 0x0D, 0xF7, 0xFF, 0x1F,
+    0x19, 0x68, 0x14, 0x9B, 0x9B, 0xEB, 0x40, 0x91, 0xCD, 0x7A, 0x35, 0x09, 0xA0, 0xAE, 0x44, 0xB7,
+    0xBF, 0x13, 0xA2, 0x0A, 0xB0, 0xAE, 0xDE, 0x26, 0x1A, 0x2F, 0x92, 0x71, 0x79, 0x6A, 0x2B, 0x08,
+    0x7D, 0x35, 0x42, 0xF7, 0xD2, 0xDB, 0x4E, 0x4E, 0x55, 0x68, 0xBC, 0x48, 0x65, 0x12, 0xA1, 0xA4,
+    0x63, 0xCB, 0x96, 0x5E, 0xBB, 0x66, 0xB0, 0xA9, 0xF1, 0x22, 0x68, 0x7B, 0x79, 0x84, 0x3D, 0x79,
+    0xE5, 0x56, 0x80, 0xE4, 0xAB, 0x8C, 0x28, 0xE9, 0x15, 0x01, 0x3D, 0x0A, 0xB6, 0x59, 0xAC, 0xBE,
+    0x6B, 0x10, 0x76, 0x76, 0x49, 0xA4, 0xC5, 0xEC, 0x84, 0x67, 0xC0, 0xEF, 0x34, 0xD3, 0xD2, 0x09,
+    0xCF, 0xB0, 0xEB, 0x84, 0x27, 0x63, 0x85, 0xF6, 0xF9, 0xCD, 0x1E, 0xE6, 0x85, 0x54, 0x8D, 0x33,
+    0xFF, 0x57, 0xF1, 0xE7, 0x4F, 0x42, 0x91, 0x03, 0x0C, 0x13, 0x60, 0x39, 0x64, 0x41, 0x6B, 0x7E,
+    0xF5, 0xA3, 0x2F, 0x80, 0x9A, 0x63, 0x45, 0x9E, 0x27, 0x83, 0xDE, 0x7E, 0xFC, 0x91, 0xF4, 0x11,
+    0xB6, 0xDC, 0xBB, 0xEE, 0x0A, 0xFF, 0xA7, 0x27, 0x24, 0x09, 0x43, 0x0F, 0x9B, 0x35, 0x88, 0x1F,
+    0xE9, 0x94, 0x21, 0x0F, 0xCD, 0x1E, 0x10, 0x3D, 0x1E, 0xAA, 0x1D, 0xCC, 0x89, 0x2C, 0xCC, 0x2E,
+    0x52, 0xF6, 0xA5, 0x59, 0xBE, 0x17, 0x0E, 0x89, 0xFE, 0xA1, 0xA3, 0x75, 0x07, 0xFD, 0xE6, 0x9C,
+    0x43, 0x76, 0x00, 0x47, 0x94, 0xEF, 0x06, 0x88, 0xFE, 0xEB, 0xA8, 0x3B, 0xA0, 0xDA, 0xDF, 0x20,
+    0x4F, 0x69, 0x46, 0xCB, 0xB0, 0xB5, 0xB9, 0xFE, 0x3B, 0x73, 0xB5, 0x4D, 0x0F, 0x30, 0x19, 0xD2,
+    0x0C, 0xFA, 0x10, 0x56, 0xD0, 0x5C, 0xB9, 0x33, 0xBE, 0x2C, 0xFB, 0x3F, 0x85, 0xBA, 0x32, 0xBE,
+    0xD2, 0xE8, 0xFF, 0x1A, 0x07, 0x9E, 0x87, 0x66, 0x67, 0x98, 0xB6, 0x4E, 0xA4, 0x97, 0xF1, 0x6F,
+    0x77, 0xFD, 0x9E, 0xCE, 0xEE, 0x3C, 0x01, 0xE0, 0x1B, 0x73, 0x0A, 0x45, 0xFB, 0xDB, 0xFB, 0x93,
+    0x2A, 0xA7, 0xAC, 0x61, 0x9A, 0xE1, 0x89, 0x03, 0x7E, 0x4B, 0xB4, 0xF9, 0xE5, 0xF6, 0x10, 0x50,
+    0xEC, 0xB9, 0x7A, 0xFF, 0x84, 0x5F, 0xFE, 0x3F, 0x2D, 0x07, 0xCE, 0xEA, 0x29, 0x4B, 0xBF, 0x9E,
+    0xFB, 0xE3, 0x1E, 0x00, 0xFE, 0xFB, 0xBF, 0x78, 0xE2, 0xD7, 0xF3, 0x84, 0x7E, 0x16, 0x9F, 0xFE,
+    0x97, 0xF5, 0x1C, 0x5D, 0xF6, 0x04, 0xD9, 0x10, 0x85, 0xFB, 0x03, 0xA0, 0xEC, 0xBE, 0xB3, 0x5C,
+    0xF5, 0x67, 0x67, 0xCF, 0xF3, 0xCA, 0x3F, 0x2F, 0x88, 0x87, 0xCF, 0xCD, 0xA5, 0xE9, 0xFE, 0xE0,
+    0x83, 0xF1, 0x3D, 0xB4, 0xEC, 0xE4, 0xCB, 0x3E, 0xBF, 0xBB, 0x74, 0x02, 0x00, 0x7E, 0x1D, 0x45,
+    0x6E, 0x43, 0x0F, 0x0D, 0x7C, 0x7D, 0xF6, 0x39, 0xDD, 0xF4, 0xC0, 0xD1, 0x59, 0x5A, 0x53, 0xFA,
+    0xB9, 0x96, 0xEE, 0x07, 0xF0, 0x6B, 0xFB, 0x53, 0xFF, 0xB8, 0x5F, 0x6E, 0xB4, 0xB2, 0x5D, 0xAA,
+    0xFA, 0xCE, 0xE6, 0x25, 0x50, 0xD0, 0x1D, 0xC8, 0xE3, 0xE0, 0xCF, 0x3F, 0x6D, 0x65, 0x1C, 0x02,
+    0x50, 0x02, 0xA8, 0x97, 0x2D, 0x35, 0xCD, 0x58, 0xC9, 0xCA, 0x01, 0xA6, 0xC5, 0x4F, 0xF0, 0x2D,
+    0xA0, 0x6C, 0x21, 0x3B, 0x2C, 0x4B, 0x71, 0x20, 0xAF, 0xA9, 0xD8, 0xEB, 0x98, 0xB9, 0xF9, 0xEF,
+    0x89, 0xB7, 0x7C, 0x01, 0x0F, 0x76, 0x00, 0xD1, 0x0C, 0x40, 0x33, 0xC8, 0x11, 0x10, 0xE4, 0x84,
+    0x6C, 0x5F, 0x02, 0xE0, 0xBF, 0xD9, 0x75, 0xBF, 0x5C, 0x44, 0x40, 0x8F, 0x30, 0x1D, 0x54, 0x44,
+    0x33, 0xA0, 0x61, 0x5B, 0x4D, 0x90, 0xEC, 0x8B, 0x84, 0x9A, 0x23, 0x4C, 0x27, 0x52, 0x44, 0x33,
+    0x94, 0xC9, 0xB4, 0xD5, 0x54, 0xB0, 0xE9, 0x8B, 0x04, 0x3E, 0x37, 0xC2, 0x74, 0xF6, 0x42, 0x44,
+    0x33, 0xE8, 0xDE, 0xB6, 0xD5, 0xA4, 0x07, 0xD5, 0x17, 0xA9, 0xF1, 0xF5, 0x08, 0x73, 0x66, 0x2C,
+    0x23, 0x9A, 0x37, 0x02, 0x6C, 0x5B, 0xDD, 0x8D, 0x50, 0x7D, 0xC1, 0x94, 0x19, 0x35, 0x94, 0x64,
+    0xC3, 0x16, 0x96, 0x97, 0xE8, 0xA0, 0xF8, 0x53, 0x3A, 0xD4, 0x99, 0xD8, 0xC9, 0x0B, 0x73, 0xC1,
+    0x59, 0x80, 0x8B, 0x5D, 0x98, 0x68, 0x5E, 0xD5, 0x76, 0x09, 0xA1, 0xA6, 0x2F, 0x22, 0x44, 0x00,
+    0x01, 0x9E, 0xB2, 0x0E, 0x0D, 0xE9, 0x00, 0xCB, 0x6E, 0xE9, 0x88, 0x2B, 0xD3, 0xC6, 0x75, 0x82,
+    0x6D, 0x2B, 0x76, 0xAA, 0x17, 0x1C, 0xEA, 0xB1, 0xE4, 0x54, 0xC6, 0x82, 0x09, 0xB6, 0xA5, 0xED,
+    0x54, 0x6F, 0x7F, 0x30, 0xD4, 0xA3, 0xB9, 0x34, 0x95, 0x51, 0xBF, 0x9A, 0x60, 0x4F, 0x7A, 0xD3,
+    0xA9, 0x9B, 0xBE, 0x19, 0x6A, 0x8E, 0xD5, 0x54, 0x32, 0x14, 0x84, 0x0D, 0x30, 0xBC, 0x19, 0xD1,
+    0xF0, 0x06, 0x51, 0x65, 0xDD, 0xFC, 0x3E, 0x1E, 0x69, 0xD9, 0x8D, 0xF2, 0x62, 0x56, 0xBE, 0x30,
+    0xF3, 0xB2, 0x0E, 0x50, 0xE9, 0x85, 0xD9, 0x37, 0x4A, 0xF6, 0xCE, 0xD9, 0xEF, 0x3D, 0xAA, 0x66,
+    0xB9, 0x5F, 0x57, 0xCD, 0xDC, 0xE2, 0x54, 0x85, 0x82, 0xCE, 0xB8, 0x2A, 0x54, 0x01, 0xBA, 0x9F,
+    0x2F, 0xE8, 0xCC, 0x75, 0x4E, 0xCB, 0x77, 0xDC, 0xAE, 0x87, 0xCF, 0x7B, 0x1C, 0xA3, 0x2C, 0x41,
+    0xEA, 0x59, 0x5B, 0xFC, 0xB1, 0xAE, 0x53, 0x98, 0x7E, 0x08, 0x4B, 0xF6, 0x8A, 0x0C, 0xF5, 0x74,
+    0x80, 0xCF, 0x26, 0x28, 0x6F, 0xBB, 0x3A, 0xA8, 0xA1, 0x4A, 0x75, 0x56, 0xB0, 0xB3, 0xB5, 0x4C,
+    0x30, 0x7C, 0xBB, 0x20, 0x53, 0x95, 0xFF, 0x31, 0x40, 0x34, 0xAE, 0xD9, 0xDE, 0xFD, 0xB7, 0x01,
+    0xFF, 0x2D, 0xCD, 0xA5, 0x9B, 0x91, 0x92, 0xEF, 0x64, 0xBB, 0xA2, 0xD1, 0x90, 0xA7, 0xB8, 0x30,
+    0x55, 0xC0, 0x53, 0x8D, 0x47, 0xBB, 0xFF, 0x3F, 0x10, 0xF8, 0x3D, 0xDA, 0xD0, 0xD6, 0x09, 0xD6,
+    0xD0, 0x59, 0xD2, 0xDB, 0xDB, 0x66, 0xB4, 0xBD, 0x9C, 0xAC, 0xAB, 0x43, 0x16, 0xFE, 0xCF, 0xFB,
+    0xA9, 0x6B, 0xC1, 0x5E, 0x62, 0xB0, 0xAF, 0x71, 0xB2, 0xB7, 0x39, 0x5A, 0xD2, 0x5B, 0xCB, 0xDE,
+    0x9E, 0xA1, 0xB7, 0xDD, 0x3F, 0xF5, 0xB6, 0x2B, 0x9C, 0xED, 0x72, 0xA9, 0xF6, 0xEF, 0xF3, 0xCC,
+    0xD9, 0x03, 0xB6, 0xCD, 0x1E, 0xE5, 0x6F, 0x93, 0x7C, 0x83, 0xE4, 0xC9, 0xEC, 0x7C, 0xE3, 0xBD,
+    0xCF, 0xE6, 0x42, 0xE4, 0x43, 0xB7, 0x19, 0x82, 0xCF, 0xDD, 0xCD, 0x72, 0xB9, 0xBD, 0xBE, 0xF9,
+    0x69, 0x34, 0x67, 0xD5, 0x5C, 0x99, 0xBB, 0xFB, 0x47, 0xF8, 0xF1, 0x30, 0x19, 0x59, 0xE1, 0x0C,
+    0xE9, 0x7E, 0xEF, 0x03, 0xFF, 0xCD, 0xEB, 0xA3, 0x76, 0x49, 0x0E, 0x64, 0x92, 0xE4, 0xC0, 0xEB,
+    0x3F, 0x92, 0x23, 0xC0, 0x16, 0x27, 0xB6, 0x37, 0x24, 0xE9, 0x66, 0x6D, 0xDC, 0x1C, 0x78, 0xEF,
+    0xE9, 0xFF, 0x03, 0xED, 0xBC, 0x4D, 0x8C, 0x1E, 0x47, 0x9A, 0x26, 0xF6, 0x64, 0x86, 0x8A, 0x69,
+    0x30, 0x77, 0x37, 0x7A, 0x01, 0x72, 0x67, 0x57, 0xB2, 0x27, 0xF7, 0x64, 0xF4, 0x68, 0x67, 0x98,
+    0x3E, 0xF6, 0x1A, 0x6A, 0x46, 0x4A, 0xC4, 0x40, 0x80, 0x75, 0x20, 0x6D, 0x90, 0xDD, 0xC0, 0xF0,
+    0x50, 0x5E, 0xC0, 0x07, 0xAD, 0x66, 0x31, 0xF4, 0x61, 0x0F, 0x7D, 0x50, 0x2B, 0x42, 0x24, 0x6C,
+    0xC1, 0xAB, 0x03, 0x09, 0xCC, 0x6A, 0x1B, 0xD8, 0x39, 0x88, 0x06, 0x84, 0x85, 0x54, 0x02, 0x86,
+    0x3E, 0xF4, 0x41, 0x33, 0x10, 0x19, 0x41, 0x12, 0x70, 0x1D, 0x78, 0x50, 0xB6, 0xE8, 0x1E, 0x02,
+    0xD6, 0x81, 0x29, 0xB1, 0xB5, 0x9A, 0xA1, 0x0E, 0x0C, 0x92, 0x59, 0x62, 0x90, 0x8C, 0x88, 0xC7,
+    0x87, 0xC8, 0xAF, 0xAA, 0x28, 0x89, 0x2D, 0xF6, 0x74, 0xDB, 0x27, 0xE7, 0x57, 0x11, 0x15, 0x19,
+    0xF9, 0x17, 0x3F, 0x6F, 0xBC, 0xFF, 0x6F, 0x68, 0x72, 0x6A, 0xC8, 0x0C, 0xBD, 0x5D, 0x70, 0x40,
+    0x13, 0x81, 0xAF, 0x15, 0xF2, 0xC6, 0x19, 0x68, 0x72, 0x6C, 0x48, 0x3A, 0x4D, 0xB2, 0xC9, 0x3F,
+    0x62, 0xD0, 0xAE, 0xE2, 0x66, 0x44, 0x93, 0xB5, 0x83, 0xFA, 0x22, 0xA2, 0xA6, 0x76, 0xE8, 0xEE,
+    0x45, 0x54, 0xD4, 0x0E, 0xBD, 0x07, 0x44, 0x06, 0xA0, 0x46, 0x40, 0x46, 0x74, 0xE7, 0x68, 0x2A,
+    0xD2, 0xA3, 0x63, 0x44, 0xC5, 0x0C, 0x60, 0x1F, 0x60, 0xC9, 0x9A, 0x8C, 0x2D, 0xE9, 0xFB, 0x07,
+    0x1B, 0xC6, 0x1A, 0xD4, 0x19, 0x68, 0x03, 0xD0, 0x33, 0xC0, 0x32, 0xD7, 0x64, 0x6E, 0xB3, 0x4D,
+    0xFD, 0x24, 0xA3, 0x35, 0xF2, 0xAB, 0x0C, 0xF5, 0x49, 0x80, 0x3D, 0x37, 0xD5, 0x19, 0x90, 0x33,
+    0xA0, 0x46, 0xD4, 0xC4, 0x7F, 0x6B, 0x03, 0x48, 0x27, 0x18, 0xD1, 0xD2, 0xA0, 0x34, 0x3C, 0xA3,
+    0x0D, 0x35, 0xD1, 0xF9, 0x8A, 0x90, 0xA1, 0x22, 0xD4, 0x08, 0xED, 0x3A, 0xDF, 0x46, 0xD4, 0xAC,
+    0x58, 0x11, 0x90, 0xA1, 0xF3, 0x6A, 0x04, 0xD4, 0x45, 0xB6, 0x01, 0xA8, 0xD8, 0xDD, 0x26, 0x00,
+    0x79, 0x9F, 0x6A, 0x04, 0xA0, 0x6E, 0x3D, 0x0C, 0x00, 0x04, 0xC9, 0x01, 0x80, 0xBD, 0x7E, 0x2F,
+    0x02, 0x90, 0x5B, 0x54, 0x13, 0x20, 0x72, 0xE7, 0x39, 0x00, 0xF6, 0x22, 0xDB, 0x08, 0xC8, 0xB9,
+    0xF3, 0x6A, 0x82, 0xC8, 0x15, 0xC1, 0x01, 0xD6, 0x75, 0xBE, 0x65, 0xEA, 0xE6, 0x8A, 0x50, 0xBC,
+    0x9A, 0xD1, 0x79, 0x30, 0x59, 0x57, 0x11, 0x2D, 0x47, 0x00, 0x80, 0x48, 0x00, 0x96, 0x11, 0xFA,
+    0xCE, 0x53, 0x40, 0x06, 0x10, 0xBD, 0x6F, 0x12, 0x08, 0xED, 0x6A, 0x82, 0xE0, 0x00, 0x1A, 0x8A,
+    0x0C, 0xA8, 0x91, 0x6D, 0x04, 0x3A, 0xCF, 0xCE, 0x03, 0x6D, 0xA2, 0x1A, 0x4B, 0xBB, 0x0D, 0xD0,
+    0x64, 0x5A, 0x07, 0xC8, 0x40, 0xE5, 0x01, 0xE5, 0x29, 0x03, 0x60, 0x1D, 0x9B, 0x84, 0x8A, 0x03,
+    0x6B, 0x1E, 0x13, 0x19, 0x04, 0x29, 0x23, 0x08, 0xC5, 0xDE, 0x83, 0xE8, 0x58, 0xBE, 0xFA, 0x04,
+    0xFF, 0x36, 0x00, 0xA0, 0xE7, 0xD4, 0x92, 0xA1, 0x23, 0x67, 0xB5, 0x41, 0x7F, 0x04, 0xD6, 0x01,
+    0x04, 0x44, 0x04, 0xD4, 0xB4, 0xF6, 0xA7, 0x84, 0xE2, 0x04, 0xD2, 0x08, 0x72, 0x44, 0x45, 0x07,
+    0xD0, 0x40, 0x64, 0x40, 0x06, 0x40, 0x7F, 0xF9, 0xF9, 0x3A, 0x7B, 0x32, 0x58, 0xD2, 0x58, 0x4E,
+    0xA8, 0x3E, 0x04, 0x10, 0x81, 0x2A, 0x00, 0x8D, 0x87, 0xA0, 0x81, 0x8C, 0xC0, 0xB3, 0x06, 0x00,
+    0x60, 0x79, 0x46, 0x91, 0xCF, 0x93, 0xF1, 0x1F, 0x41, 0x8F, 0x10, 0x09, 0x50, 0xEE, 0x69, 0x3B,
+    0x57, 0x8C, 0xE8, 0x38, 0xE3, 0x98, 0x1D, 0x51, 0x13, 0xE8, 0xEF, 0x9E, 0x69, 0xA8, 0xC8, 0xAB,
+    0x64, 0xE8, 0x98, 0x50, 0x45, 0x40, 0x78, 0xA0, 0x1F, 0x50, 0x07, 0x08, 0x0E, 0x50, 0x1E, 0xF5,
+    0xBB, 0xD0, 0x0E, 0xD6, 0x68, 0x57, 0x11, 0xDA, 0x89, 0x04, 0xED, 0x64, 0x80, 0x76, 0xBD, 0x87,
+    0x76, 0xDA, 0x41, 0x3B, 0x0E, 0xD0, 0x97, 0x33, 0xA0, 0xAF, 0x44, 0x40, 0x5F, 0xF7, 0x80, 0xA6,
+    0x07, 0xF4, 0xF5, 0x00, 0xE8, 0xCD, 0x04, 0xE8, 0xCB, 0x04, 0xB4, 0xA3, 0x83, 0x76, 0x7A, 0x82,
+    0x76, 0xFD, 0x0C, 0xED, 0x24, 0x93, 0x76, 0x82, 0x49, 0xBB, 0x8A, 0x49, 0x3B, 0x30, 0xAD, 0xE6,
+    0xF5, 0xB1, 0x19, 0xC0, 0xA1, 0x8D, 0x6A, 0x6A, 0x93, 0x0C, 0x4D, 0x12, 0x59, 0x64, 0xF0, 0x14,
+    0xA1, 0x3E, 0x23, 0xE4, 0x7D, 0x42, 0x90, 0x03, 0x68, 0x3D, 0xD4, 0x8D, 0x0C, 0x19, 0xF4, 0x24,
+    0x72, 0x9B, 0x40, 0xC3, 0x5F, 0xEA, 0x49, 0x92, 0xA1, 0x22, 0x73, 0x99, 0x3A, 0xE5, 0x00, 0xE9,
+    0xCB, 0xF8, 0x63, 0x55, 0xB1, 0xF7, 0xAC, 0x76, 0xE0, 0x9B, 0x11, 0xCA, 0xDB, 0xCD, 0x37, 0x53,
+    0x1B, 0x7F, 0x42, 0x63, 0x37, 0xE9, 0xDB, 0xA8, 0x23, 0xEC, 0x26, 0x87, 0x36, 0xEA, 0x09, 0xF6,
+    0xA3, 0x88, 0x36, 0x13, 0xB0, 0xF4, 0x68, 0x13, 0x0D, 0xEC, 0x95, 0x84, 0x36, 0x6A, 0x0F, 0xBB,
+    0x49, 0xD7, 0x46, 0x9D, 0x61, 0x37, 0xED, 0xDC, 0xC6, 0x9F, 0xD0, 0xD9, 0x8B, 0x4D, 0x6E, 0x23,
+    0xFA, 0xD9, 0x3A, 0xD0, 0x71, 0x68, 0x23, 0xFF, 0x5D, 0x3F, 0xF3, 0xB4, 0x1E, 0x79, 0x9A, 0x86,
+    0xA7, 0x09, 0x9E, 0x8E, 0xE0, 0xDB, 0x1E, 0xE4, 0x08, 0x5A, 0x0F, 0x9E, 0x0E, 0xE0, 0xE9, 0x04,
+    0x9E, 0xE6, 0xC0, 0xD3, 0x74, 0x3C, 0xAD, 0x3C, 0xFF, 0x5D, 0x17, 0x68, 0x9A, 0xDC, 0x79, 0xF4,
+    0xBE, 0xF3, 0x50, 0xA3, 0xE5, 0x40, 0x47, 0x9E, 0x24, 0xC8, 0x37, 0x12, 0xEC, 0x83, 0xC3, 0x01,
+    0x9D, 0xEF, 0x3D, 0x3A, 0xAF, 0x47, 0x74, 0x0F, 0x68, 0xD0, 0x91, 0xD8, 0xCE, 0x0C, 0x3A, 0x6F,
+    0x47, 0x74, 0x5E, 0x79, 0x74, 0xBE, 0x0B, 0xE8, 0x7C, 0x9B, 0xD0, 0x79, 0x51, 0x10, 0x80, 0xE9,
+    0x3C, 0xEC, 0xD8, 0x79, 0x28, 0xDF, 0x79, 0x74, 0x01, 0x00, 0xD0, 0x4F, 0x00, 0xAC, 0x01, 0x14,
+    0x33, 0x40, 0x46, 0x08, 0xD2, 0x97, 0xAA, 0x3A, 0xA3, 0x9F, 0xDB, 0x50, 0x71, 0xE8, 0x27, 0x19,
+    0x60, 0x0D, 0x5D, 0x9D, 0xDB, 0x88, 0x36, 0x68, 0x87, 0xFE, 0x8B, 0x04, 0x58, 0x4E, 0xA8, 0x33,
+    0x1D, 0xDA, 0x40, 0x87, 0xFE, 0x53, 0x1A, 0xD8, 0xD7, 0x39, 0xD4, 0xB9, 0xE6, 0xD0, 0x06, 0x41,
+    0xF4, 0x93, 0x20, 0xAC, 0x69, 0x32, 0x48, 0x07, 0x7B, 0x9A, 0x11, 0x9D, 0x27, 0x9D, 0x48, 0x92,
+    0x11, 0x34, 0x05, 0xC4, 0x9A, 0xD8, 0x44, 0x14, 0x18, 0x6B, 0xA2, 0x9A, 0x16, 0x20, 0x6B, 0x12,
+    0xB1, 0x40, 0x59, 0x93, 0x68, 0x16, 0x30, 0x6B, 0xA2, 0xF2, 0x0B, 0x9C, 0x35, 0xB1, 0xC9, 0x28,
+    0x80, 0xD6, 0x44, 0xD0, 0x41, 0x3B, 0x41, 0x34, 0x11, 0x5D, 0x80, 0x76, 0xE0, 0x48, 0x3A, 0x91,
+    0x14, 0xBD, 0xC8, 0x92, 0xB1, 0xCE, 0xD5, 0x31, 0x56, 0x04, 0xD4, 0x45, 0x02, 0xD2, 0x73, 0x80,
+    0x88, 0x1C, 0x00, 0x5A, 0x03, 0xA8, 0x5B, 0x1E, 0x90, 0x77, 0x08, 0x88, 0xA8, 0x26, 0xA0, 0x60,
+    0x14, 0xA7, 0x46, 0x48, 0xDF, 0x44, 0x88, 0x08, 0xEB, 0x40, 0xB4, 0x51, 0x3B, 0xF4, 0x53, 0x13,
+    0x51, 0x67, 0x7C, 0x77, 0xF1, 0xE6, 0x86, 0x9D, 0x1A, 0x2E, 0xF4, 0x85, 0xAB, 0xE2, 0xAF, 0x7F,
+    0x8C, 0xD4, 0x0E, 0x3D, 0xEF, 0xED, 0x14, 0x3D, 0x80, 0x8A, 0x00, 0xD0, 0x3D, 0xBE, 0x08, 0x58,
+    0xD3, 0xC4, 0x3A, 0xA3, 0xF3, 0x6D, 0x80, 0x76, 0xFD, 0x54, 0x71, 0x57, 0x15, 0x49, 0xD7, 0x93,
+    0x84, 0x25, 0x63, 0xCD, 0x63, 0x27, 0xBE, 0xE5, 0x2E, 0x3E, 0x0C, 0xD0, 0xBC, 0x35, 0x55, 0x24,
+    0x96, 0x55, 0x23, 0xFD, 0xB2, 0x6C, 0xB0, 0x5D, 0xB5, 0xF7, 0xAC, 0x76, 0xE8, 0xB9, 0x45, 0xC0,
+    0xF2, 0x5A, 0x44, 0x4D, 0xAE, 0x7B, 0xB4, 0x4C, 0xDA, 0xA1, 0x9F, 0x2A, 0x96, 0x86, 0xA0, 0xCE,
+    0xE8, 0x3C, 0xDA, 0x50, 0x06, 0xA1, 0x22, 0x49, 0x53, 0xFA, 0xDF, 0x91, 0x0C, 0x78, 0xDC, 0xDD,
+    0xBF, 0xA6, 0x1A, 0xD6, 0x34, 0x64, 0x3F, 0x55, 0xE4, 0x95, 0x00, 0xCD, 0x3B, 0x19, 0xDD, 0xD6,
+    0x51, 0x6B, 0x9A, 0x58, 0x9E, 0x69, 0x49, 0xBA, 0x9A, 0xA4, 0x87, 0x25, 0x23, 0xFA, 0xAD, 0x1F,
+    0xB1, 0x3C, 0x5C, 0xDE, 0xB3, 0xEB, 0xCE, 0x9D, 0x4A, 0x5D, 0x08, 0x5B, 0x43, 0x32, 0x00, 0xD0,
+    0x0B, 0xBD, 0x58, 0x9D, 0x3A, 0xD0, 0x00, 0x4D, 0x84, 0xFC, 0xF5, 0xA7, 0x0F, 0x36, 0x06, 0x68,
+    0x07, 0x92, 0x63, 0x13, 0x21, 0x49, 0x9A, 0x72, 0x9A, 0x9A, 0x08, 0x99, 0xFE, 0x84, 0x5E, 0x3B,
+    0xD0, 0x08, 0xBE, 0x11, 0x21, 0x03, 0x64, 0x2C, 0xCF, 0xEA, 0xCD, 0x08, 0x19, 0x20, 0x52, 0x39,
+    0x55, 0xD7, 0x1E, 0x3D, 0x2D, 0x74, 0xAF, 0x89, 0x0B, 0xAD, 0x71, 0x65, 0xC9, 0x06, 0x00, 0x38,
+    0x78, 0x8E, 0x28, 0x74, 0x79, 0x04, 0x00, 0xC5, 0xB9, 0x9C, 0x96, 0x65, 0x8D, 0x23, 0x80, 0x25,
+    0x67, 0xD4, 0x24, 0x47, 0xB4, 0x24, 0x07, 0xF4, 0x5B, 0x3F, 0x4E, 0x80, 0x35, 0x72, 0x46, 0x9D,
+    0xA1, 0x46, 0xB4, 0x01, 0x1C, 0xD0, 0x4F, 0x82, 0x19, 0xD6, 0x48, 0xF2, 0x85, 0x0C, 0x45, 0xB6,
+    0x01, 0x3C, 0xC7, 0x7E, 0x12, 0xA9, 0x4D, 0xD6, 0xC8, 0x59, 0x3E, 0xC8, 0x50, 0x63, 0xF7, 0x30,
+    0x80, 0x83, 0xBE, 0x35, 0x89, 0x54, 0xC0, 0xAE, 0x34, 0xAB, 0x9F, 0x00, 0x54, 0x1C, 0x80, 0x83,
+    0x36, 0x02, 0x20, 0x47, 0x40, 0x30, 0x01, 0x68, 0x0A, 0x1B, 0xB2, 0x3A, 0xF6, 0xD0, 0x03, 0x2D,
+    0x23, 0x20, 0x99, 0x81, 0x96, 0xFF, 0x71, 0x80, 0x20, 0x80, 0x9A, 0xE8, 0x12, 0xE8, 0x7A, 0x4E,
+    0x6A, 0xEC, 0x98, 0xE4, 0xDC, 0x46, 0xBB, 0x19, 0x45, 0x94, 0xB7, 0x09, 0x8A, 0xA8, 0x9D, 0x72,
+    0x94, 0xB3, 0xF4, 0xEA, 0x72, 0x12, 0x51, 0x7A, 0x3A, 0xFB, 0x62, 0xE8, 0x67, 0x79, 0x37, 0x09,
+    0xBE, 0xC0, 0x0C, 0x9B, 0x6D, 0x99, 0xFC, 0xB7, 0x60, 0x77, 0x40, 0xA0, 0x1A, 0x4E, 0xC4, 0x9D,
+    0x8F, 0xB7, 0x34, 0x68, 0x38, 0x03, 0x24, 0xD0, 0xDF, 0x3F, 0x02, 0x91, 0x6A, 0x1A, 0xED, 0xC8,
+    0x36, 0x76, 0x9C, 0xED, 0xC9, 0xA8, 0xDE, 0x0C, 0xFD, 0xA5, 0x60, 0x2F, 0x45, 0xF5, 0x46, 0xEC,
+    0x2F, 0x07, 0x35, 0x66, 0x5B, 0xF3, 0x34, 0x27, 0x49, 0x46, 0x68, 0x32, 0xC2, 0x92, 0x0E, 0xFB,
+    0xDA, 0x5D, 0x6F, 0xAD, 0x6C, 0x1E, 0x1A, 0x32, 0x34, 0x64, 0x6A, 0x78, 0x93, 0x82, 0xA6, 0x7A,
+    0x9E, 0xA6, 0x4C, 0x95, 0x9A, 0x0A, 0x7B, 0xD6, 0xA4, 0x65, 0xA1, 0xEA, 0x11, 0xE8, 0xE6, 0x85,
+    0x27, 0xA4, 0x03, 0xFA, 0x19, 0x10, 0x1C, 0x30, 0xD8, 0x7C, 0xDC, 0xCB, 0xE5, 0x13, 0xD8, 0x43,
+    0x0E, 0x68, 0xC7, 0x42, 0xFC, 0xD1, 0x19, 0xA0, 0x99, 0x00, 0x15, 0x00, 0x19, 0x81, 0xFA, 0xDD,
+    0xF2, 0xE9, 0x86, 0xB3, 0x20, 0x1D, 0x19, 0xFA, 0x74, 0x5C, 0x10, 0xD0, 0x23, 0xDA, 0x08, 0x58,
+    0xB7, 0xFA, 0xD7, 0x44, 0x40, 0x4D, 0x10, 0xFC, 0xE5, 0x87, 0x92, 0x74, 0x9A, 0x11, 0x36, 0x03,
+    0xE7, 0x0B, 0xFD, 0xEF, 0x0C, 0xAA, 0x08, 0x41, 0xB3, 0xA2, 0xFF, 0x24, 0xD7, 0x49, 0x5E, 0x23,
+    0xB9, 0x45, 0x32, 0x41, 0x86, 0x55, 0x53, 0xCD, 0xD2, 0x99, 0x27, 0xAB, 0x28, 0x84, 0xC4, 0x41,
+    0xD1, 0x43, 0x32, 0xAE, 0x3A, 0xEF, 0x0A, 0xA2, 0x6A, 0x76, 0x57, 0x00, 0x9A, 0x4C, 0xAB, 0xB4,
+    0x7F, 0x7D, 0xEB, 0x28, 0xA4, 0xC7, 0xAF, 0x4F, 0x33, 0x20, 0xE9, 0xB7, 0xD3, 0xB7, 0xDE, 0xB4,
+    0xF7, 0xAC, 0x75, 0xE8, 0x6F, 0xD3, 0x80, 0xA7, 0x88, 0x36, 0x8A, 0x04, 0x35, 0xB6, 0xB1, 0x26,
+    0xE4, 0x2C, 0x67, 0xF4, 0xDE, 0x3A, 0xA8, 0xAB, 0x09, 0xB0, 0xB7, 0x7C, 0x01, 0x89, 0x8A, 0x01,
+    0x10, 0x74, 0x40, 0x93, 0x51, 0xBE, 0x52, 0x96, 0x1F, 0x87, 0x85, 0x2D, 0xF9, 0x66, 0x15, 0x1D,
+    0xF8, 0xF6, 0x0C, 0x7B, 0x39, 0x43, 0x79, 0xEB, 0xE4, 0xDC, 0xCD, 0x6D, 0x14, 0x59, 0x64, 0xD8,
+    0x8B, 0x1C, 0xE4, 0x6C, 0x5D, 0x9D, 0xD5, 0x08, 0xFD, 0x91, 0x87, 0x7C, 0x18, 0x50, 0x33, 0x01,
+    0x8A, 0x80, 0xA4, 0x29, 0xDC, 0x9F, 0xF2, 0xDF, 0x31, 0xA8, 0xBF, 0x5D, 0x2F, 0x9E, 0x3E, 0xF7,
+    0xE0, 0x1D, 0x58, 0xD2, 0xD7, 0x24, 0x5D, 0x4B, 0xB2, 0xC0, 0xDF, 0xEF, 0xBE, 0x17, 0x92, 0x0C,
+    0x82, 0xCC, 0x20, 0x69, 0xF6, 0xEB, 0xCF, 0x87, 0x47, 0x7A, 0xA1, 0x46, 0xC8, 0x50, 0x13, 0x35,
+    0x21, 0x03, 0xD4, 0x08, 0x3D, 0xCA, 0x08, 0x51, 0xA4, 0x8F, 0x59, 0x4D, 0x80, 0xBD, 0x12, 0x51,
+    0x18, 0x3B, 0x48, 0x4E, 0x00, 0x6C, 0xDC, 0xC6, 0x1F, 0x8C, 0x40, 0x21, 0x82, 0x22, 0x73, 0x00,
+    0xF8, 0x66, 0x44, 0xE1, 0x71, 0x44, 0xAA, 0x38, 0xC0, 0xBA, 0x96, 0xB1, 0x9B, 0xA1, 0x78, 0x39,
+    0xA3, 0x66, 0xB4, 0x0E, 0x92, 0x6E, 0x45, 0xAD, 0x0A, 0xF1, 0xFA, 0xF6, 0x22, 0xA0, 0x7C, 0xCD,
+    0xC1, 0x8E, 0x32, 0x80, 0x8E, 0x0E, 0x7C, 0x23, 0xA1, 0xA6, 0x9E, 0x20, 0x48, 0x40, 0x70, 0x06,
+    0x5A, 0xBA, 0xD2, 0xDD, 0x8A, 0x19, 0x90, 0x4C, 0x80, 0xFD, 0x28, 0xA2, 0x49, 0xF2, 0xFE, 0x11,
+    0xE5, 0x7B, 0x5E, 0x22, 0x14, 0xBB, 0x00, 0xFD, 0x18, 0x6A, 0x29, 0x3D, 0x80, 0x67, 0x8D, 0x26,
+    0x29, 0x7D, 0x45, 0x32, 0xAA, 0xB1, 0x21, 0xE9, 0x39, 0x74, 0x24, 0x2F, 0x27, 0x40, 0xFA, 0x22,
+    0xC5, 0x39, 0xA8, 0x11, 0x20, 0xC0, 0x01, 0x22, 0x42, 0xFC, 0xD6, 0x97, 0x6E, 0x6E, 0x58, 0x8E,
+    0x20, 0x59, 0x44, 0x0E, 0x32, 0x43, 0x72, 0x21, 0x6C, 0x0B, 0xE2, 0x2E, 0x8C, 0x1E, 0x50, 0xE7,
+    0x82, 0x25, 0xBF, 0xE5, 0x12, 0xA0, 0xC9, 0x2B, 0xA1, 0x22, 0xD9, 0xFB, 0x86, 0x8C, 0xD6, 0xAD,
+    0xE9, 0xAD, 0xFF, 0x81, 0x80, 0x35, 0x6D, 0x44, 0x9D, 0xD1, 0x7B, 0xB4, 0x01, 0xD6, 0xA1, 0x9F,
+    0xEA, 0x5F, 0x53, 0xFD, 0xD6, 0xF1, 0x88, 0x9A, 0x24, 0xA7, 0x96, 0x24, 0x4D, 0x4F, 0x32, 0x03,
+    0x40, 0x13, 0x00, 0xA0, 0x9B, 0x00, 0x40, 0x1B, 0x00, 0xD5, 0xAE, 0xEA, 0xBD, 0x67, 0x56, 0x9C,
+    0x91, 0xC8, 0xD0, 0x0E, 0xEA, 0x09, 0x8A, 0x09, 0x4D, 0x86, 0xBA, 0xFF, 0xA7, 0x9C, 0xC4, 0x76,
+    0xAF, 0x27, 0xF4, 0xBC, 0x9A, 0x81, 0xB2, 0xC8, 0x0A, 0x6C, 0x2E, 0x45, 0x66, 0x00, 0x8A, 0x1E,
+    0x65, 0xDE, 0x4B, 0xF1, 0x49, 0x38, 0x2E, 0x55, 0xC4, 0xA5, 0xC7, 0x64, 0xCA, 0x55, 0x84, 0x9A,
+    0x9E, 0x21, 0x14, 0x49, 0x48, 0x92, 0xA8, 0xF9, 0x29, 0x57, 0x6F, 0x59, 0x32, 0xEE, 0xCE, 0x16,
+    0x81, 0xF2, 0xDB, 0xB2, 0x0D, 0xE5, 0xD0, 0xDD, 0x4D, 0xA8, 0xA9, 0x46, 0xF4, 0x5F, 0x2F, 0xFC,
+    0xBC, 0xBF, 0x9B, 0xDA, 0x17, 0x4A, 0x81, 0xED, 0x0B, 0x54, 0x99, 0xBC, 0x43, 0x92, 0x2D, 0x49,
+    0xDF, 0xF1, 0x3F, 0x13, 0x98, 0x7B, 0x8F, 0xF6, 0x05, 0x02, 0x3F, 0x5F, 0x15, 0xFE, 0xC7, 0xDE,
+    0x03, 0x35, 0x01, 0xF4, 0x5E, 0xBB, 0x8A, 0x9D, 0x87, 0xDE, 0x8C, 0xE8, 0x6E, 0x13, 0x4D, 0xD4,
+    0x97, 0x5E, 0x67, 0xE7, 0xBD, 0xDE, 0x8C, 0xCF, 0x75, 0xB7, 0xF9, 0xB6, 0x8D, 0x8A, 0x64, 0x43,
+    0xD2, 0xF5, 0x79, 0xDD, 0x43, 0x36, 0x11, 0xE2, 0x22, 0x01, 0xBF, 0x83, 0xDA, 0xB5, 0x03, 0xDA,
+    0x08, 0xC0, 0x3E, 0xA6, 0x70, 0x82, 0xC6, 0x2E, 0x8D, 0x8A, 0x96, 0x5F, 0xF2, 0x93, 0x8C, 0x36,
+    0x5B, 0x07, 0xF5, 0x65, 0x84, 0xF8, 0xAE, 0xC2, 0x6A, 0xDE, 0x64, 0x28, 0x33, 0xB7, 0x4B, 0x78,
+    0x56, 0x1F, 0x73, 0xA4, 0xE6, 0x0D, 0x92, 0xD7, 0xF9, 0x33, 0xDA, 0x59, 0x90, 0xAE, 0x65, 0x5E,
+    0x74, 0x28, 0x53, 0x4D, 0x9A, 0xC7, 0x9D, 0xBA, 0x6D, 0x72, 0xDE, 0x73, 0x02, 0xD0, 0x93, 0x13,
+    0xD0, 0x92, 0x34, 0xA8, 0xF9, 0xE0, 0x5C, 0x02, 0xD4, 0x8C, 0xDE, 0x3F, 0xDB, 0x46, 0x80, 0x2F,
+    0x79, 0x1A, 0xB4, 0x91, 0x72, 0x06, 0xF4, 0x47, 0xE4, 0xC6, 0xC6, 0xB9, 0x48, 0x72, 0xA1, 0x9C,
+    0x64, 0x6A, 0x49, 0x92, 0x63, 0x01, 0x94, 0x42, 0x35, 0x0A, 0x72, 0x07, 0xDA, 0x04, 0x54, 0x80,
+    0x9A, 0x51, 0x79, 0x54, 0xBC, 0x7F, 0x9C, 0xE5, 0x3B, 0x1E, 0xE8, 0xCA, 0x5A, 0xE8, 0x99, 0x00,
+    0xA0, 0x3A, 0xB2, 0xDD, 0xA6, 0x86, 0x13, 0x20, 0xC9, 0x01, 0x92, 0xF4, 0x6B, 0x4D, 0x12, 0x59,
+    0x5E, 0xCE, 0x50, 0x97, 0x67, 0x0E, 0xD2, 0x93, 0x64, 0xEA, 0x49, 0xF2, 0x85, 0x5D, 0x5F, 0x55,
+    0x23, 0x0A, 0xB3, 0x80, 0x8A, 0xA6, 0x19, 0xA0, 0xC8, 0x11, 0x82, 0x9C, 0x81, 0x8E, 0x01, 0xC0,
+    0xDA, 0x2E, 0xB6, 0xEC, 0xFF, 0xD3, 0x4E, 0xD7, 0xDF, 0xDE, 0xE9, 0xBC, 0xB3, 0xA8, 0x96, 0x57,
+    0x3C, 0xFE, 0x64, 0xD7, 0xF1, 0xFF, 0xCA, 0xD8, 0xD8, 0x01, 0x40, 0x3F, 0x02, 0x68, 0x67, 0x00,
+    0x75, 0xC2, 0xAA, 0xF2, 0x69, 0x03, 0xC5, 0x99, 0xBC, 0x4A, 0x3E, 0xCF, 0xA9, 0x26, 0xDA, 0x88,
+    0xDE, 0xC3, 0xBA, 0xC7, 0x16, 0x65, 0x12, 0xE4, 0x61, 0x26, 0xC5, 0x19, 0xD8, 0x8F, 0xFD, 0x00,
+    0x20, 0xBD, 0x9C, 0x00, 0x54, 0xB9, 0x8C, 0x92, 0x2A, 0xE8, 0xB8, 0x5E, 0xB0, 0xF2, 0xDA, 0xCE,
+    0xCC, 0xC3, 0x9A, 0x3A, 0xA3, 0x0D, 0x72, 0x86, 0x35, 0x4D, 0xAA, 0x89, 0x7E, 0x12, 0x19, 0x6A,
+    0x6A, 0x43, 0x4D, 0x34, 0xA9, 0xCE, 0x45, 0xC9, 0x66, 0x0D, 0x0D, 0x64, 0xE8, 0x27, 0xEB, 0x50,
+    0xB1, 0x0D, 0x6A, 0x04, 0xFA, 0x87, 0xB4, 0x53, 0xD1, 0x7E, 0x79, 0x00, 0x24, 0x23, 0x00, 0x5B,
+    0x84, 0x1B, 0xFD, 0x59, 0xEE, 0x67, 0x40, 0x79, 0x7B, 0x8A, 0x40, 0x3F, 0xF7, 0x93, 0x9E, 0x20,
+    0x43, 0x1B, 0xDA, 0x04, 0x19, 0xEB, 0x0C, 0xBA, 0x36, 0xC1, 0x9A, 0x6E, 0x25, 0xC1, 0x0B, 0xA2,
+    0x0D, 0x50, 0xB7, 0x69, 0xEA, 0x8C, 0x36, 0xA3, 0x7E, 0x67, 0xCF, 0x59, 0x00, 0xCA, 0x11, 0x40,
+    0x9D, 0x4F, 0x78, 0xA0, 0x70, 0x7A, 0x40, 0x5F, 0x26, 0x69, 0xFF, 0x76, 0x27, 0x44, 0x82, 0x36,
+    0xD2, 0x77, 0xBE, 0x09, 0x22, 0xC3, 0x3A, 0x6D, 0xAC, 0x13, 0xA9, 0x09, 0xD2, 0xA3, 0xF3, 0xFA,
+    0x54, 0x06, 0xEC, 0x66, 0xB0, 0x6E, 0xD5, 0xD4, 0x02, 0x12, 0x85, 0x83, 0x87, 0xFE, 0x32, 0xD3,
+    0x40, 0x06, 0xFD, 0x46, 0x82, 0x60, 0x13, 0x94, 0x87, 0x1E, 0xB5, 0xA1, 0x91, 0xA1, 0x09, 0x4D,
+    0x12, 0x84, 0x36, 0xCA, 0xDB, 0xB1, 0x09, 0xA0, 0xD3, 0x0E, 0xF6, 0x22, 0xD1, 0xA4, 0x26, 0x42,
+    0x4D, 0x9D, 0x17, 0x84, 0x76, 0xBD, 0xAF, 0x58, 0x11, 0x4D, 0xEC, 0x66, 0x74, 0x9E, 0x03, 0xF4,
+    0x47, 0x01, 0x15, 0xAD, 0x43, 0x43, 0xDE, 0x47, 0x47, 0x72, 0xD0, 0x24, 0x9F, 0xE7, 0x5B, 0x27,
+    0xF8, 0x62, 0x44, 0xCB, 0xCE, 0x17, 0x21, 0x5F, 0x6E, 0x11, 0xE8, 0xBF, 0x88, 0x80, 0x7D, 0xDB,
+    0xA3, 0xCE, 0xDA, 0x15, 0xEA, 0xA8, 0xC6, 0x45, 0xDC, 0xE9, 0x22, 0xDA, 0xF7, 0x39, 0x16, 0xE8,
+    0xB5, 0x9C, 0x50, 0x31, 0x95, 0xA5, 0x65, 0x4D, 0x9B, 0xAC, 0xE9, 0x83, 0x35, 0x7A, 0xB2, 0xAF,
+    0xD3, 0xD8, 0x53, 0x19, 0xF6, 0x74, 0x80, 0xB5, 0x13, 0x2C, 0xFF, 0x0E, 0x96, 0x74, 0x96, 0xF4,
+    0xF6, 0x73, 0x1B, 0xCB, 0xBD, 0x22, 0x5B, 0x53, 0x67, 0x6B, 0x2A, 0x5A, 0x53, 0xB1, 0x10, 0x40,
+    0x91, 0x81, 0x26, 0xE1, 0x80, 0x8D, 0xE8, 0xE9, 0xD1, 0x73, 0x44, 0x97, 0x17, 0x35, 0x28, 0x8B,
+    0x14, 0xC5, 0x08, 0x74, 0xBB, 0xF2, 0x7E, 0x6A, 0x22, 0xD0, 0x8F, 0x4D, 0x04, 0x54, 0xC9, 0xDD,
+    0x4E, 0xAE, 0x5D, 0x13, 0x01, 0x5B, 0x72, 0xD3, 0x44, 0x80, 0xC3, 0xAE, 0x1C, 0x4D, 0x44, 0x45,
+    0x14, 0x3A, 0xDA, 0x44, 0x1C, 0x4F, 0x68, 0x98, 0x19, 0xD1, 0x30, 0x73, 0x46, 0xC3, 0xC4, 0x11,
+    0x0D, 0xE3, 0x53, 0xDB, 0x4C, 0x54, 0xE1, 0x16, 0xA4, 0xDF, 0x59, 0xA2, 0xAA, 0xD0, 0xF0, 0x95,
+    0xBA, 0x56, 0x93, 0xA6, 0x60, 0x96, 0x96, 0x0C, 0x10, 0xE9, 0xC7, 0x19, 0x20, 0x68, 0xA0, 0x9C,
+    0x9A, 0x20, 0xBD, 0x0C, 0x10, 0x51, 0x64, 0x54, 0x19, 0x34, 0xB0, 0x83, 0x9A, 0xA0, 0x46, 0x19,
+    0xD0, 0x79, 0x91, 0xF1, 0x76, 0x00, 0x8D, 0x4A, 0x50, 0xBC, 0x45, 0x48, 0xDE, 0x23, 0x44, 0xF9,
+    0xBA, 0x05, 0x00, 0x65, 0x00, 0x74, 0x23, 0x80, 0xD6, 0x6F, 0xB7, 0x68, 0x03, 0xDA, 0xA1, 0xFF,
+    0x22, 0x96, 0xF9, 0x7A, 0x6C, 0xE1, 0xE6, 0x86, 0xFD, 0x82, 0x64, 0xD6, 0x24, 0x4B, 0xE1, 0x49,
+    0x9E, 0x2A, 0x14, 0x48, 0xE4, 0xA5, 0x87, 0x32, 0xE2, 0xC0, 0xFB, 0x34, 0x35, 0xE9, 0xD1, 0x3F,
+    0xA2, 0xD0, 0x37, 0x4D, 0xFC, 0xD6, 0x44, 0xEE, 0xA4, 0x5F, 0x1E, 0x8F, 0x8F, 0xBB, 0xAF, 0xC8,
+    0x48, 0x6D, 0x04, 0xBA, 0x80, 0xBF, 0xB6, 0x33, 0x2C, 0x27, 0x58, 0x1A, 0xE8, 0xA2, 0x1D, 0xFD,
+    0x0D, 0x35, 0x27, 0x7F, 0x4F, 0xF5, 0xCB, 0xA2, 0xDA, 0xE9, 0x3C, 0x5A, 0x46, 0xED, 0x16, 0x32,
+    0x51, 0x10, 0x61, 0x19, 0xEC, 0x32, 0xE5, 0x34, 0x28, 0x22, 0x6E, 0x11, 0x67, 0x56, 0x8A, 0xA8,
+    0x5F, 0x93, 0x2D, 0x72, 0xEE, 0x2A, 0xFB, 0xE5, 0xF1, 0x6F, 0xBB, 0x8F, 0x71, 0x3B, 0x0B, 0x00,
+    0xC4, 0x0C, 0xA0, 0xF1, 0x2B, 0x70, 0x93, 0xD3, 0x8A, 0x4B, 0x7D, 0xD6, 0xFC, 0x5A, 0xB6, 0x68,
+    0x77, 0x81, 0xA8, 0xA9, 0xF2, 0x9F, 0x16, 0xB6, 0x48, 0xEE, 0xB0, 0x45, 0xD8, 0xC5, 0x04, 0x01,
+    0xEF, 0xB3, 0xC8, 0x97, 0xE0, 0x76, 0x61, 0xF5, 0xD5, 0x6F, 0x16, 0x0A, 0x0B, 0xA8, 0xBF, 0x25,
+    0x29, 0x57, 0x51, 0x4D, 0xCF, 0x50, 0x2D, 0xDF, 0x2A, 0x8C, 0x5F, 0xC5, 0xF2, 0x25, 0xEE, 0x4E,
+    0xF8, 0x66, 0xDA, 0x80, 0x0E, 0x80, 0x2A, 0x62, 0x85, 0x8D, 0xD0, 0x09, 0x60, 0x84, 0xCE, 0xE5,
+    0x1F, 0x51, 0x33, 0x42, 0xDB, 0x41, 0x3C, 0x8C, 0xD0, 0xDA, 0x88, 0x7B, 0x11, 0xFA, 0x84, 0x6B,
+    0xEF, 0x46, 0xE8, 0x75, 0x27, 0x6F, 0x44, 0xE8, 0xD3, 0x93, 0xBC, 0x1A, 0xA1, 0x4F, 0xFB, 0xFE,
+    0x72, 0x84, 0x7E, 0xC3, 0xAB, 0x53, 0x11, 0xFA, 0xD4, 0xAC, 0x0E, 0x45, 0xE8, 0x53, 0x51, 0x8B,
+    0x08, 0x7D, 0x32, 0x66, 0x11, 0xA1, 0x5F, 0xCF, 0x49, 0x44, 0x68, 0xC3, 0x28, 0x22, 0xB4, 0xB1,
+    0x41, 0x30, 0x69, 0xA3, 0x67, 0xC1, 0xA4, 0x8D, 0xF2, 0x82, 0x51, 0x9B, 0x7E, 0x12, 0x05, 0xBD,
+    0x2F, 0x4C, 0xF9, 0x8A, 0xC2, 0x2F, 0x83, 0xD0, 0x2F, 0x63, 0xB1, 0x88, 0x0D, 0x2B, 0x86, 0xCA,
+    0x06, 0xB4, 0x1C, 0x7A, 0x42, 0x70, 0x6C, 0x39, 0x56, 0x9C, 0x6B, 0x06, 0x30, 0xC1, 0x5A, 0x28,
+    0x3B, 0xF4, 0xD7, 0xC7, 0xFE, 0xD6, 0xD8, 0xDE, 0x8B, 0xF2, 0x93, 0xB9, 0x4E, 0xBA, 0xB9, 0x93,
+    0x60, 0x0F, 0x7F, 0x16, 0xEC, 0xD0, 0x7F, 0x1C, 0x53, 0x3F, 0xB6, 0xB3, 0xB6, 0xED, 0x5C, 0x27,
+    0xC9, 0x93, 0x09, 0xF6, 0x05, 0x3A, 0x3B, 0xF4, 0xA3, 0xF2, 0x3D, 0x3F, 0x99, 0x65, 0x68, 0x79,
+    0x27, 0x55, 0xB1, 0x5E, 0x1A, 0x55, 0x68, 0x8E, 0x32, 0x58, 0x51, 0xEE, 0xA5, 0x61, 0x05, 0x4E,
+    0xAB, 0xF7, 0x7E, 0x1B, 0xB2, 0xBD, 0x1F, 0xFB, 0x81, 0x6E, 0xEA, 0x1D, 0x44, 0xEA, 0x56, 0x56,
+    0x8F, 0x86, 0x33, 0x80, 0xB5, 0x61, 0x45, 0xE4, 0x24, 0x01, 0x08, 0x8E, 0x2B, 0x3A, 0x5E, 0xC4,
+    0x88, 0x5B, 0x23, 0xD0, 0x7F, 0x11, 0x00, 0x39, 0x13, 0x68, 0xA2, 0x1A, 0x51, 0xE7, 0x82, 0x71,
+    0x09, 0x68, 0xA7, 0x46, 0xF4, 0xBE, 0x8D, 0x90, 0xF9, 0x7D, 0xA2, 0x21, 0x39, 0xD5, 0x24, 0x23,
+    0x48, 0x12, 0x7A, 0x84, 0x9A, 0x94, 0x87, 0x8C, 0x32, 0xA0, 0xE2, 0x8B, 0x09, 0x50, 0x37, 0x08,
+    0xC8, 0x58, 0xBF, 0xB3, 0xE7, 0xAC, 0x9C, 0x94, 0x53, 0x7F, 0x93, 0xA1, 0xE9, 0xA1, 0xF3, 0x36,
+    0x43, 0x67, 0x69, 0x64, 0x51, 0xF4, 0xBA, 0x7F, 0x59, 0xB3, 0xC8, 0xF7, 0x72, 0xAE, 0x2C, 0x47,
+    0x92, 0x87, 0xF9, 0x65, 0xB2, 0xA3, 0xBC, 0x47, 0xA8, 0xEB, 0xA1, 0xE2, 0x89, 0xB9, 0x4B, 0x9A,
+    0x9C, 0xC9, 0xEB, 0xA3, 0x0D, 0x6A, 0xD8, 0x07, 0xA0, 0x1B, 0x02, 0x20, 0xBD, 0x05, 0x44, 0xEC,
+    0x1D, 0xF0, 0x53, 0x31, 0x3E, 0xC2, 0x70, 0xA9, 0x08, 0x40, 0x72, 0x00, 0x5A, 0x4E, 0x40, 0x01,
+    0x0A, 0xDA, 0x01, 0xB0, 0x6F, 0x4F, 0x80, 0xBA, 0x5A, 0xEC, 0x6F, 0x03, 0xDA, 0xD0, 0x79, 0x88,
+    0x24, 0x22, 0x56, 0xA6, 0xC0, 0xDE, 0x43, 0x3D, 0x38, 0x17, 0xD1, 0x91, 0x34, 0x2D, 0x49, 0x2F,
+    0x48, 0xC6, 0xAA, 0xD8, 0xEF, 0x1C, 0x94, 0x57, 0x13, 0x9A, 0xD4, 0xCD, 0x00, 0x4F, 0x47, 0x40,
+    0xF9, 0xDA, 0x77, 0x43, 0x37, 0x11, 0xFA, 0x54, 0xC4, 0x07, 0x8D, 0xDB, 0xC5, 0xAF, 0x0A, 0xD2,
+    0xB7, 0xA4, 0xFF, 0x47, 0x83, 0x75, 0x45, 0xF0, 0x4D, 0x38, 0xC1, 0x59, 0x91, 0x57, 0xF9, 0x80,
+    0x27, 0x66, 0x91, 0xE8, 0xE4, 0xBD, 0x0C, 0xFD, 0x49, 0x6A, 0xB8, 0x4E, 0x26, 0xC5, 0x7B, 0x73,
+    0x9F, 0xE5, 0xB8, 0xB6, 0xBC, 0x81, 0xF4, 0xA8, 0x48, 0xD2, 0xA1, 0x25, 0x49, 0x40, 0x91, 0x8C,
+    0xA8, 0x73, 0x57, 0x70, 0x8C, 0x76, 0x00, 0xEC, 0xEB, 0x04, 0x20, 0x52, 0x13, 0x01, 0x74, 0xBE,
+    0x7B, 0xB0, 0x71, 0x06, 0x1C, 0x34, 0x69, 0x9A, 0x58, 0x91, 0x19, 0xFD, 0xD4, 0x90, 0x01, 0xBC,
+    0x69, 0x7D, 0xE1, 0x69, 0x5D, 0x79, 0x51, 0x61, 0x60, 0x22, 0x20, 0x67, 0x74, 0x1E, 0xD0, 0x0E,
+    0xFA, 0xE6, 0xC6, 0xA9, 0x8C, 0x8A, 0x64, 0xE7, 0xD1, 0x90, 0xB1, 0x18, 0x6F, 0xFC, 0x6A, 0xA9,
+    0xF0, 0x05, 0x4E, 0x20, 0x1F, 0x92, 0x43, 0x4F, 0x92, 0xB3, 0x30, 0x7D, 0xAE, 0x09, 0x88, 0x0C,
+    0xE5, 0x00, 0x0E, 0xED, 0xBC, 0xC7, 0x92, 0x4C, 0x92, 0x24, 0x79, 0x9A, 0xEF, 0x93, 0xFC, 0x32,
+    0x81, 0x03, 0x6A, 0x16, 0x1D, 0x80, 0xE9, 0x23, 0xD0, 0xFB, 0x8E, 0x6E, 0xCF, 0x1B, 0xE4, 0x2D,
+    0x72, 0x22, 0x3F, 0x25, 0x43, 0xCB, 0xB1, 0x65, 0xC0, 0x53, 0xC0, 0x1A, 0xB0, 0x1F, 0xFB, 0xE5,
+    0xD4, 0x5D, 0x4D, 0x9D, 0x57, 0x9C, 0x1B, 0xCE, 0x05, 0x8A, 0xAB, 0x42, 0x0D, 0xDF, 0x26, 0xBF,
+    0x20, 0xB7, 0x08, 0x68, 0x87, 0xCE, 0x17, 0x96, 0x60, 0xE3, 0x5D, 0x4D, 0x76, 0xE4, 0x26, 0x79,
+    0xFB, 0xD1, 0x2B, 0x80, 0xBE, 0xB9, 0xB1, 0x4E, 0x7E, 0x41, 0xDE, 0x27, 0x73, 0x7D, 0x76, 0xCF,
+    0x19, 0x11, 0xE4, 0x24, 0x92, 0x1E, 0x2B, 0xD2, 0x41, 0x67, 0xA0, 0x5A, 0x16, 0x89, 0x4D, 0x10,
+    0xA4, 0x93, 0xA4, 0xEF, 0xE7, 0x6E, 0x56, 0x63, 0x13, 0xB5, 0x13, 0x8F, 0x12, 0x45, 0x57, 0xB4,
+    0x82, 0x6A, 0x02, 0xFA, 0x80, 0xFF, 0x43, 0x16, 0x20, 0xF1, 0xB0, 0x1C, 0x81, 0x15, 0x63, 0xFC,
+    0x0C, 0x03, 0x60, 0xC9, 0x09, 0x96, 0x24, 0xFA, 0xBC, 0x41, 0xDF, 0x8E, 0x68, 0x73, 0xB5, 0xC2,
+    0x3D, 0x32, 0x60, 0x41, 0xE8, 0xB0, 0x57, 0xC8, 0x45, 0x10, 0x8E, 0x96, 0x24, 0x7B, 0x92, 0xDC,
+    0x8C, 0x40, 0xEF, 0x09, 0xC8, 0xA0, 0x46, 0x34, 0xA9, 0x49, 0x68, 0x08, 0xDE, 0x3F, 0xC1, 0x41,
+    0x92, 0x1C, 0x40, 0x72, 0x40, 0xC3, 0x8C, 0x9D, 0xF6, 0xB7, 0x0C, 0x50, 0xE4, 0xA0, 0xC8, 0xF1,
+    0x0F, 0xA0, 0x17, 0xCD, 0x5D, 0x1B, 0x81, 0xF6, 0xD1, 0x4E, 0x98, 0x36, 0x6A, 0x27, 0x83, 0x9A,
+    0x7A, 0xDF, 0x91, 0x63, 0x4B, 0x9A, 0x8A, 0x45, 0x06, 0x42, 0xFF, 0xFC, 0x0C, 0x48, 0x5F, 0xAC,
+    0x4C, 0x0E, 0x78, 0xF5, 0xD1, 0xF5, 0xB5, 0x87, 0x19, 0xE8, 0xC9, 0x80, 0xBE, 0x68, 0xEC, 0x36,
+    0x6C, 0xAC, 0x67, 0xD4, 0x34, 0xC3, 0x82, 0x64, 0x8B, 0xDA, 0xC2, 0x3A, 0x00, 0xFD, 0xD7, 0x7B,
+    0x75, 0x85, 0x2C, 0x33, 0xD4, 0x46, 0xE5, 0x20, 0xB2, 0x9C, 0x51, 0xF1, 0x79, 0x0E, 0x15, 0x9D,
+    0xCA, 0xC7, 0x39, 0x0A, 0x92, 0x63, 0x91, 0x77, 0x2A, 0xD2, 0x14, 0x23, 0x81, 0x98, 0x7A, 0xB4,
+    0xB3, 0x36, 0xED, 0xAC, 0x4D, 0x3D, 0x1D, 0xD8, 0xA5, 0x2F, 0xFF, 0x1D, 0x74, 0x17, 0xD2, 0x7C,
+    0x08, 0x00, 0xED, 0xAC, 0x0C, 0x80, 0x3A, 0xC9, 0x09, 0x00, 0x0E, 0xD4, 0xD3, 0xD7, 0x25, 0xB9,
+    0x3A, 0xA3, 0x0D, 0xE8, 0x27, 0x35, 0xD6, 0x19, 0xDD, 0xDC, 0x46, 0x58, 0x23, 0x03, 0x68, 0xFA,
+    0xA9, 0x8D, 0xE8, 0xE6, 0x36, 0x88, 0x84, 0x9A, 0x75, 0x16, 0x19, 0x50, 0x93, 0x3D, 0x49, 0xA0,
+    0x89, 0xFD, 0xC4, 0x01, 0xB0, 0xB7, 0x32, 0x0D, 0x20, 0xCB, 0xFA, 0x5B, 0xE4, 0x88, 0xBA, 0x28,
+    0x97, 0x2A, 0xBE, 0x19, 0xEC, 0x08, 0xF0, 0x52, 0x96, 0x11, 0xB0, 0xA3, 0x7D, 0x9D, 0x06, 0x6A,
+    0xEA, 0xA7, 0x7E, 0x86, 0xF2, 0xC5, 0x46, 0x39, 0xD7, 0x19, 0x7A, 0x92, 0x11, 0xD6, 0xC8, 0x28,
+    0x23, 0xFA, 0x09, 0xDC, 0x2C, 0x0D, 0x0A, 0x40, 0x68, 0x1D, 0x80, 0x6E, 0xCC, 0x00, 0xAA, 0xD2,
+    0x83, 0xB6, 0x74, 0x6B, 0x37, 0x62, 0x1C, 0x9B, 0x00, 0x56, 0x84, 0x36, 0x6A, 0x6A, 0x63, 0x13,
+    0xDA, 0x08, 0x35, 0x6A, 0x43, 0x54, 0x6C, 0x82, 0x9A, 0xD0, 0x46, 0xFD, 0x66, 0x5C, 0x61, 0x87,
+    0x8A, 0xE4, 0x54, 0xF0, 0x10, 0xD0, 0x64, 0x7B, 0x2B, 0x00, 0x7C, 0x23, 0xE8, 0x11, 0xCA, 0xEB,
+    0x53, 0x44, 0x93, 0x9A, 0x20, 0x03, 0x68, 0xB4, 0xD1, 0xA3, 0xF2, 0x4D, 0x10, 0x6C, 0x13, 0xB4,
+    0x91, 0x51, 0x4C, 0x07, 0xD0, 0x5F, 0x4C, 0xB0, 0xCD, 0x8C, 0xB9, 0xDD, 0x36, 0xAF, 0x58, 0x9A,
+    0x9E, 0x9C, 0x34, 0x39, 0xE6, 0xF7, 0x79, 0x71, 0xA8, 0x17, 0xAF, 0x03, 0xE9, 0x01, 0x9A, 0xFD,
+    0xE7, 0x62, 0xF1, 0x3A, 0xC8, 0x45, 0x58, 0x6E, 0xF8, 0x88, 0x1E, 0xA5, 0xE2, 0xB9, 0xB7, 0x74,
+    0xB4, 0xE4, 0x67, 0x64, 0xAE, 0x49, 0x83, 0xB5, 0x01, 0xCD, 0x74, 0x10, 0x6C, 0x66, 0xE9, 0xF5,
+    0xF0, 0xC3, 0xED, 0xE9, 0x6A, 0x79, 0x5F, 0x90, 0x73, 0x47, 0xBA, 0xA9, 0x49, 0x80, 0x1A, 0x21,
+    0x62, 0xF5, 0x3E, 0x87, 0x8E, 0xAE, 0x22, 0x87, 0xB5, 0xE3, 0x09, 0xE8, 0x3D, 0x6A, 0xFE, 0x4B,
+    0xE8, 0xBB, 0x64, 0x52, 0xE4, 0xEB, 0xE4, 0x88, 0xB5, 0x22, 0xA1, 0x34, 0x24, 0xAB, 0xC5, 0x81,
+    0x66, 0x02, 0xEC, 0x2A, 0x8D, 0x4B, 0x9A, 0x00, 0xC5, 0x11, 0x92, 0x1C, 0x8A, 0x15, 0xFA, 0x99,
+    0xBC, 0x40, 0x7B, 0x51, 0x2F, 0x7D, 0x0F, 0x82, 0xF2, 0xDF, 0x3F, 0xC3, 0x53, 0x24, 0x1D, 0x49,
+    0xF7, 0x0C, 0xF3, 0x80, 0xEA, 0x08, 0xD0, 0x93, 0x71, 0x95, 0xD6, 0x8E, 0x9D, 0x08, 0x80, 0x1E,
+    0x51, 0x71, 0x40, 0x93, 0x8A, 0x99, 0xC5, 0x8E, 0x40, 0x31, 0x4C, 0x8C, 0x20, 0x67, 0xA0, 0x8F,
+    0x85, 0x6D, 0x15, 0xB9, 0xE0, 0x8A, 0x82, 0x6B, 0xFF, 0x39, 0xDA, 0xA4, 0x36, 0x6C, 0x54, 0xA4,
+    0x57, 0xA4, 0xDB, 0xC3, 0xFB, 0xC0, 0xB3, 0x1B, 0x67, 0x51, 0x91, 0x23, 0x1A, 0x72, 0xC0, 0xDA,
+    0xB1, 0xA3, 0x58, 0xD4, 0x11, 0x15, 0xAF, 0x45, 0x48, 0xAE, 0x7B, 0xE8, 0xA4, 0x9D, 0xE0, 0x16,
+    0xD1, 0xF1, 0x5A, 0x04, 0xB9, 0xEE, 0x9B, 0x87, 0x49, 0x3B, 0xF5, 0xD1, 0x16, 0xAB, 0xA4, 0xAE,
+    0x45, 0xE9, 0xB9, 0xEE, 0xF5, 0xA1, 0xA4, 0x2F, 0x47, 0xB9, 0xC5, 0x6E, 0x54, 0xD7, 0x22, 0xC1,
+    0xF5, 0x7B, 0xB3, 0x48, 0x9A, 0x4E, 0x6E, 0x31, 0x41, 0x5D, 0xA3, 0x07, 0xD7, 0x39, 0x88, 0xA4,
+    0x23, 0xE4, 0x16, 0x47, 0xA8, 0xB1, 0xDE, 0xD8, 0x18, 0x44, 0x51, 0xDF, 0x9A, 0xEA, 0xD8, 0xB1,
+    0x85, 0xBD, 0x96, 0xC9, 0x9A, 0x2E, 0x59, 0xA3, 0x92, 0x35, 0x3A, 0x59, 0xC3, 0x64, 0x4F, 0xE6,
+    0x64, 0x4F, 0xDD, 0x4B, 0xF6, 0xCD, 0xBB, 0xC9, 0x1E, 0xBE, 0x9A, 0xEC, 0x89, 0xCB, 0xC9, 0x5A,
+    0x91, 0x6C, 0x16, 0xC9, 0x46, 0x91, 0x6C, 0x10, 0xC9, 0x7A, 0x91, 0xEC, 0x24, 0x12, 0x0E, 0xD6,
+    0x1E, 0x75, 0xEC, 0x26, 0xB4, 0x5E, 0x1B, 0xB4, 0xE6, 0x83, 0x5D, 0x1A, 0x95, 0x88, 0x86, 0xEB,
+    0x1E, 0x2A, 0x69, 0x57, 0x71, 0x8B, 0x90, 0xBC, 0x16, 0xA1, 0xB9, 0xEE, 0x05, 0x93, 0x76, 0xDD,
+    0xAD, 0x2D, 0x82, 0xEA, 0x5A, 0x6C, 0x66, 0xAE, 0x7B, 0x75, 0x39, 0xE9, 0x8B, 0x49, 0x6E, 0x51,
+    0x7A, 0x75, 0x2D, 0xEA, 0x81, 0xEB, 0x77, 0xA3, 0x48, 0xFA, 0xFA, 0x28, 0xB7, 0x48, 0xA8, 0x6B,
+    0x9C, 0xC1, 0x75, 0x3A, 0x91, 0x74, 0x82, 0xDC, 0xA2, 0x87, 0xBA, 0xC6, 0x01, 0x1C, 0x6A, 0xDF,
+    0x0D, 0x4D, 0x50, 0xAE, 0x09, 0xCA, 0xD5, 0x53, 0x37, 0xEC, 0xE8, 0x3B, 0x7E, 0xCB, 0x8E, 0x49,
+    0xF3, 0x21, 0xD0, 0xCE, 0xDA, 0x2C, 0xA8, 0xE6, 0xEB, 0x88, 0xC6, 0xD2, 0xA0, 0x26, 0x73, 0xD1,
+    0x2F, 0xD4, 0x7C, 0x60, 0x33, 0x38, 0x56, 0x74, 0x76, 0x42, 0x17, 0x94, 0x87, 0x28, 0x7E, 0x41,
+    0x9B, 0x09, 0xE8, 0xB6, 0x38, 0xA0, 0x49, 0x7A, 0x44, 0xC5, 0xF5, 0x19, 0xD0, 0xD7, 0x12, 0xD0,
+    0xCD, 0x34, 0x68, 0xA3, 0xF2, 0x10, 0x6C, 0x13, 0x2A, 0x1A, 0x8E, 0x15, 0x5D, 0xCF, 0xBF, 0x28,
+    0xAA, 0x66, 0x5F, 0xA4, 0xDD, 0xCA, 0xF2, 0x0C, 0x80, 0xA3, 0x40, 0x35, 0x4B, 0x23, 0x62, 0xEF,
+    0x44, 0xEC, 0x5D, 0x35, 0xCB, 0x1D, 0x7B, 0xA8, 0xCD, 0x10, 0xE4, 0x28, 0x49, 0xDF, 0x87, 0x2E,
+    0xAA, 0xA9, 0x49, 0xDA, 0x89, 0x6C, 0x9D, 0xC8, 0xD6, 0xD5, 0x2C, 0x49, 0x64, 0xED, 0x44, 0x56,
+    0x53, 0x93, 0xFA, 0xD0, 0x45, 0x49, 0xCE, 0x82, 0x1C, 0x61, 0x77, 0x91, 0x55, 0xD4, 0xC5, 0x96,
+    0xCA, 0x50, 0x18, 0x90, 0x96, 0x6F, 0xD9, 0x20, 0x08, 0xC1, 0x9A, 0x80, 0x9A, 0x4A, 0x7B, 0x47,
+    0x80, 0xDD, 0xD6, 0xB1, 0x63, 0xFA, 0x1A, 0x17, 0xF3, 0x1E, 0x93, 0x26, 0xC9, 0x75, 0xBF, 0x70,
+    0x6D, 0xD2, 0xD3, 0xA0, 0x89, 0xBD, 0x87, 0xC8, 0x82, 0xA8, 0x09, 0x7B, 0xFF, 0x38, 0x4D, 0x41,
+    0xAA, 0x96, 0x34, 0xD8, 0xC3, 0x3C, 0xEC, 0xD2, 0x4C, 0x96, 0x0E, 0x14, 0x7A, 0x7E, 0xFF, 0x44,
+    0x50, 0x53, 0x13, 0xB5, 0x13, 0xC9, 0xDE, 0x7C, 0x3F, 0x5B, 0xB2, 0xA4, 0x9B, 0xEF, 0x67, 0xED,
+    0x44, 0x52, 0x63, 0x13, 0xFB, 0xFB, 0x7D, 0x5C, 0xE8, 0xF9, 0x4E, 0x07, 0x76, 0xCF, 0x57, 0xF7,
+    0x04, 0xF3, 0xF5, 0xF9, 0x89, 0x0C, 0x3A, 0xD0, 0x59, 0x07, 0x19, 0xD4, 0x84, 0x9A, 0x72, 0x06,
+    0xD4, 0x66, 0x3A, 0x76, 0x6C, 0x7D, 0x77, 0xAF, 0x48, 0xF2, 0x5A, 0x5C, 0x18, 0x6F, 0x11, 0xD5,
+    0x84, 0x8A, 0x6D, 0x44, 0xE1, 0x34, 0xAD, 0xEB, 0xF3, 0x8F, 0x9E, 0x6C, 0xBE, 0x86, 0xAF, 0xCD,
+    0xD7, 0x6F, 0xD5, 0xDD, 0x76, 0xFC, 0x69, 0x21, 0xFB, 0x94, 0x1E, 0x1D, 0xE6, 0x9D, 0x7E, 0x9E,
+    0xA0, 0xA9, 0x57, 0x4E, 0x88, 0xF2, 0x81, 0xCD, 0xD5, 0x00, 0xBA, 0x82, 0x9F, 0xEB, 0x62, 0x2A,
+    0xDD, 0x7F, 0xEC, 0xC4, 0x2C, 0xC9, 0x24, 0x48, 0x0E, 0x24, 0x17, 0x4B, 0x72, 0x13, 0x97, 0x3B,
+    0x68, 0x00, 0xFE, 0xE2, 0xC1, 0x9F, 0x70, 0xD2, 0xA4, 0xEF, 0x8A, 0x28, 0x71, 0x06, 0x38, 0x0A,
+    0xF4, 0xD5, 0x2C, 0x82, 0x72, 0xEA, 0x54, 0xDC, 0xB5, 0xD6, 0x4E, 0xD0, 0xB4, 0xA4, 0xD1, 0xCC,
+    0xE2, 0x8C, 0xF6, 0x00, 0x0D, 0xDA, 0xB8, 0x67, 0x83, 0xCE, 0x32, 0xB6, 0xA4, 0xDB, 0x7F, 0xBC,
+    0xD8, 0x90, 0xBB, 0xF0, 0xF9, 0x33, 0x94, 0xE4, 0x48, 0x86, 0x86, 0xF7, 0x0B, 0x17, 0xF6, 0x58,
+    0x7C, 0x88, 0xFE, 0x46, 0x06, 0xD8, 0x46, 0xB4, 0x51, 0xCE, 0x50, 0x63, 0xEF, 0x2B, 0x42, 0xBB,
+    0x36, 0x80, 0x46, 0xB9, 0x8A, 0x55, 0x86, 0x48, 0x72, 0x46, 0x13, 0x95, 0x83, 0xBC, 0x93, 0x80,
+    0xEE, 0x96, 0x07, 0x14, 0xCD, 0x62, 0xF2, 0x2B, 0x52, 0x45, 0xD1, 0xAE, 0x61, 0x83, 0xAE, 0x18,
+    0x67, 0x24, 0x27, 0x40, 0xA5, 0x6D, 0xC5, 0xF5, 0x2B, 0x1B, 0x67, 0xD1, 0x72, 0xF1, 0xCE, 0x5A,
+    0xA1, 0x45, 0xC1, 0x22, 0xA1, 0x69, 0x47, 0xD3, 0xC6, 0x36, 0x82, 0x83, 0x76, 0x9D, 0x17, 0xA9,
+    0xCE, 0xE8, 0xBC, 0x72, 0x60, 0x13, 0xD1, 0xCE, 0x76, 0x80, 0xFE, 0xC8, 0x43, 0xA4, 0x0C, 0x74,
+    0x1C, 0x8B, 0x7D, 0xB1, 0xA5, 0x29, 0xEA, 0x0B, 0xC1, 0x45, 0xC5, 0xD7, 0xC4, 0x32, 0xAA, 0x7B,
+    0xAD, 0x2F, 0x84, 0x43, 0xD2, 0x00, 0x3C, 0x03, 0x14, 0xF4, 0x99, 0xBA, 0xA9, 0x40, 0xEE, 0xD7,
+    0xD1, 0x27, 0xEC, 0xE9, 0x00, 0x11, 0x7B, 0x8F, 0xDE, 0xAB, 0x11, 0x1C, 0xAC, 0x6B, 0x62, 0xB5,
+    0xE8, 0x6E, 0x89, 0x26, 0x36, 0x01, 0x72, 0x56, 0x23, 0x3A, 0x4F, 0x40, 0x5D, 0x99, 0x01, 0x6D,
+    0x5D, 0xF9, 0x46, 0x5D, 0x6C, 0x50, 0x06, 0x90, 0x09, 0x80, 0xF6, 0xA8, 0x8B, 0x3A, 0x22, 0x2C,
+    0x63, 0xC4, 0xB9, 0xA8, 0x98, 0x80, 0x9F, 0x8A, 0x09, 0xD2, 0xEB, 0x01, 0x6C, 0x66, 0x88, 0xF1,
+    0xC0, 0x2E, 0x56, 0xC4, 0x43, 0xFD, 0x82, 0x68, 0xA2, 0x0C, 0xB0, 0xCE, 0x3A, 0x39, 0x37, 0xB1,
+    0x22, 0xD4, 0xD8, 0x4F, 0x15, 0x45, 0x2C, 0xC2, 0x8D, 0x7D, 0x69, 0x46, 0x13, 0x09, 0xA8, 0xEB,
+    0x8B, 0xE2, 0x52, 0xD2, 0x01, 0x36, 0xAC, 0x86, 0xC0, 0x2F, 0x56, 0x6F, 0xBD, 0xC0, 0x61, 0x69,
+    0xC7, 0x04, 0x30, 0x00, 0xF2, 0x7E, 0x51, 0xF2, 0xFE, 0xF1, 0x91, 0xE2, 0xAA, 0xD2, 0x5F, 0x8D,
+    0xA8, 0x52, 0xEF, 0x20, 0x2F, 0x06, 0x60, 0xDF, 0x82, 0x9B, 0x3A, 0x8F, 0x3A, 0xAB, 0x09, 0xD2,
+    0x5B, 0x07, 0xEB, 0x38, 0x88, 0x54, 0x13, 0x9D, 0x6F, 0x0A, 0x73, 0x27, 0x22, 0x3A, 0xDF, 0x4D,
+    0x50, 0x23, 0x07, 0xE8, 0xCB, 0x11, 0x60, 0x3F, 0xA2, 0xCA, 0x5C, 0xBC, 0x58, 0x5A, 0x3A, 0x40,
+    0x66, 0x00, 0x6A, 0x06, 0x2A, 0x3A, 0xEC, 0x3D, 0x17, 0x01, 0xC5, 0xA9, 0x0C, 0x96, 0xE0, 0x88,
+    0x45, 0x2A, 0x58, 0x3B, 0x72, 0x0C, 0x4D, 0xB4, 0x46, 0x44, 0x65, 0xEA, 0xA8, 0x4C, 0x15, 0xFA,
+    0x01, 0xFB, 0x0A, 0xAC, 0x88, 0x0C, 0x91, 0xB4, 0xAB, 0x28, 0x67, 0xD8, 0x4B, 0x84, 0x1A, 0x95,
+    0xEB, 0xBC, 0x9C, 0xDB, 0x50, 0x51, 0x44, 0xA8, 0x8B, 0x2C, 0x40, 0x91, 0x95, 0x83, 0xBA, 0x3E,
+    0xA1, 0x79, 0x38, 0x17, 0x98, 0xE8, 0xF3, 0x32, 0x16, 0x74, 0x05, 0x24, 0xBA, 0xC2, 0x04, 0xD7,
+    0xE7, 0x62, 0x69, 0x80, 0xCA, 0xCB, 0x48, 0x54, 0xB3, 0x34, 0x60, 0x3B, 0x43, 0x5D, 0x4A, 0x68,
+    0x76, 0xCD, 0x85, 0x9C, 0x21, 0xEF, 0x25, 0x88, 0xC4, 0x01, 0xD4, 0x23, 0xD4, 0xF5, 0x47, 0x2A,
+    0x26, 0xA8, 0xEB, 0x11, 0xF2, 0x2B, 0x9A, 0x26, 0x69, 0x92, 0x2F, 0x91, 0x1C, 0x2D, 0x39, 0x57,
+    0x7F, 0xF9, 0xE7, 0x69, 0xB1, 0xD0, 0xAB, 0xB1, 0x28, 0x5B, 0xC4, 0xA3, 0x15, 0xB5, 0xEF, 0x06,
+    0x11, 0x94, 0x13, 0x41, 0xB9, 0xCA, 0xEF, 0x90, 0x50, 0xE5, 0x44, 0xD4, 0x4E, 0xA4, 0xDD, 0x49,
+    0x39, 0x91, 0xD4, 0x24, 0x92, 0xCA, 0xE7, 0x52, 0x57, 0x6C, 0x35, 0x09, 0xE7, 0x7E, 0x96, 0xCA,
+    0x4B, 0x1F, 0x4D, 0xBA, 0x28, 0x44, 0x35, 0x79, 0xAF, 0xA8, 0x45, 0x8B, 0xE2, 0xF8, 0x89, 0xFE,
+    0x31, 0x42, 0x73, 0x6C, 0x98, 0xA0, 0xB9, 0x38, 0xA4, 0x7E, 0xFD, 0x1F, 0x00, 0xCB, 0x68, 0x99,
+    0x2C, 0x93, 0xFD, 0xE5, 0x51, 0x6B, 0xF0, 0xD8, 0x3F, 0x9A, 0xF2, 0x07, 0xFD, 0xE8, 0xDF, 0x2B,
+    0x03, 0xC4, 0x74, 0x00, 0x40, 0x7F, 0x31, 0x01, 0xB0, 0xCD, 0x0C, 0xEC, 0x66, 0x85, 0xB7, 0x3D,
+    0x93, 0xD8, 0x79, 0x40, 0x44, 0xED, 0x00, 0x79, 0x9B, 0x00, 0xD4, 0xE6, 0x37, 0xAB, 0x37, 0x8E,
+    0x40, 0x6D, 0x92, 0x33, 0xD8, 0x91, 0x41, 0x44, 0x4D, 0xCE, 0xF2, 0x36, 0x61, 0xBD, 0xDA, 0x8C,
+    0xB0, 0x8E, 0x9D, 0x07, 0x0F, 0x45, 0xED, 0x44, 0x92, 0xB7, 0x89, 0x6E, 0x56, 0x9B, 0x11, 0x74,
+    0xEC, 0x1E, 0xD8, 0x2C, 0xA2, 0x26, 0xBD, 0xBC, 0x4D, 0x12, 0x6A, 0x93, 0x3C, 0x03, 0xAE, 0x48,
+    0x9A, 0xD7, 0xA6, 0x70, 0x58, 0x5F, 0x23, 0x69, 0x6D, 0x00, 0xDA, 0x07, 0x19, 0x10, 0xD9, 0x1A,
+    0x80, 0xE7, 0x26, 0x40, 0x7D, 0x19, 0x00, 0xF9, 0x80, 0x3C, 0x23, 0xB2, 0x25, 0xC1, 0x73, 0xA4,
+    0x57, 0x5F, 0xA6, 0xF5, 0x2C, 0x1F, 0x64, 0xF0, 0x72, 0xB6, 0xA6, 0xF7, 0x3C, 0x37, 0xB5, 0x51,
+    0x7D, 0x99, 0x8E, 0x67, 0xF9, 0x80, 0xA4, 0xC8, 0x96, 0x1C, 0x78, 0x8E, 0xF7, 0xA1, 0xA6, 0x86,
+    0xCC, 0x8F, 0xA4, 0x45, 0x83, 0xBC, 0x3B, 0xE9, 0xC2, 0x74, 0x3B, 0x4D, 0xBA, 0x7F, 0x91, 0x37,
+    0x86, 0x6F, 0xDC, 0x93, 0xDF, 0x43, 0xC3, 0xB4, 0x9D, 0x1E, 0x01, 0x8B, 0xB7, 0x8B, 0xF6, 0x11,
+    0x9C, 0x81, 0xC5, 0x6F, 0x5B, 0x92, 0x13, 0x99, 0x25, 0x39, 0xF1, 0xE6, 0x7B, 0x72, 0x06, 0x38,
+    0x60, 0xFD, 0xFE, 0x51, 0x49, 0x3A, 0x32, 0x4A, 0xD2, 0x2D, 0x95, 0xB2, 0xF8, 0x5C, 0x49, 0x7A,
+    0x90, 0x45, 0x59, 0x6F, 0x81, 0xD6, 0xE3, 0x9F, 0x10, 0x35, 0x27, 0xF4, 0x11, 0x78, 0x0F, 0x50,
+    0x13, 0xBA, 0x62, 0x7F, 0x02, 0x5D, 0x93, 0xD0, 0xCD, 0x82, 0xA8, 0x77, 0x98, 0x98, 0x26, 0xD1,
+    0x2D, 0xCE, 0x65, 0x92, 0x13, 0x50, 0xD1, 0xA3, 0x38, 0x45, 0x41, 0x11, 0x40, 0x57, 0x4C, 0x81,
+    0x09, 0x68, 0xA3, 0x75, 0x68, 0x92, 0x0C, 0x10, 0xAC, 0x38, 0xD4, 0x84, 0xE2, 0xA7, 0x34, 0x82,
+    0x81, 0x0E, 0x36, 0xDB, 0xB1, 0xA0, 0xF2, 0xA2, 0x3E, 0x6E, 0xC3, 0x4A, 0xA8, 0xFE, 0xAF, 0x8B,
+    0xF3, 0x89, 0x03, 0x04, 0x27, 0x6C, 0x77, 0x14, 0x7A, 0xAA, 0x59, 0x13, 0x7A, 0x92, 0x51, 0x46,
+    0xE8, 0x8F, 0x59, 0x3C, 0x44, 0x24, 0x23, 0xA0, 0x09, 0xD4, 0x9C, 0x0A, 0x2A, 0x68, 0x8B, 0x77,
+    0x99, 0x83, 0xBA, 0x9B, 0xD1, 0xC6, 0x6E, 0x06, 0x8D, 0xA5, 0xF2, 0x82, 0x0F, 0x53, 0x31, 0x8B,
+    0x3D, 0xA2, 0x3B, 0xFE, 0x27, 0x19, 0xA8, 0x39, 0x16, 0x41, 0xA4, 0x7A, 0xAF, 0x0C, 0x40, 0x3F,
+    0x43, 0x79, 0x19, 0xA1, 0xC7, 0x26, 0x81, 0xAE, 0xF4, 0x9F, 0xA7, 0x32, 0xA0, 0xAF, 0xC7, 0xE2,
+    0xE4, 0xB7, 0x76, 0x82, 0x5B, 0x47, 0xBA, 0xA2, 0xBD, 0x5E, 0x65, 0xC5, 0x3D, 0x46, 0x71, 0x2E,
+    0x9E, 0x34, 0x15, 0x0F, 0xE5, 0xD2, 0xF9, 0x36, 0x82, 0xAE, 0x0B, 0x50, 0x5E, 0x79, 0xF4, 0xB3,
+    0x1D, 0x21, 0xA3, 0x9E, 0x6A, 0xB6, 0xB1, 0xA2, 0xA1, 0xA3, 0xEB, 0x66, 0xEB, 0x6A, 0xEA, 0x09,
+    0x8A, 0xBE, 0x3A, 0xC7, 0x7C, 0xC6, 0x92, 0x73, 0x4F, 0xA6, 0x3D, 0x96, 0x0F, 0x20, 0x19, 0x21,
+    0x23, 0x4D, 0x1B, 0xBB, 0x59, 0xE4, 0x9A, 0x82, 0x50, 0x9F, 0x71, 0x68, 0x13, 0x50, 0x19, 0x4C,
+    0xAF, 0x7C, 0xF0, 0xD7, 0x1F, 0x9C, 0x9D, 0xFE, 0x77, 0x73, 0x16, 0xDF, 0xFD, 0x03, 0xEA, 0xA1,
+    0xC5, 0x81, 0xF7, 0x0E, 0xFC, 0x65, 0xBB, 0xB7, 0xFE, 0xEF, 0xB0, 0xF7, 0xBB, 0x7F, 0xCF, 0x6E,
+    0x1C, 0xE6, 0x55, 0xCE, 0x4C, 0xDB, 0x05, 0x92, 0x0F, 0x49, 0xDE, 0x22, 0xF9, 0xD6, 0xB1, 0xD5,
+    0x71, 0xB4, 0xD8, 0xA1, 0x17, 0x73, 0x74, 0x51, 0x87, 0x30, 0x02, 0xD0, 0x38, 0xFF, 0x3B, 0xFF,
+    0x7B, 0x16, 0x2F, 0xEF, 0x3F, 0x76, 0xEC, 0x10, 0x19, 0x9F, 0xDD, 0xD8, 0x30, 0x00, 0x76, 0x9D,
+    0xB5, 0xB3, 0x72, 0x6C, 0xE6, 0xDE, 0x65, 0xE1, 0xD7, 0x06, 0xFD, 0x46, 0x54, 0x97, 0x62, 0x37,
+    0xE6, 0xC6, 0xEF, 0x6F, 0x67, 0xE5, 0x28, 0xA2, 0xF4, 0xFA, 0xF5, 0xDC, 0xFA, 0xCE, 0xB1, 0x8E,
+    0x72, 0x54, 0xCF, 0xC7, 0xEA, 0xC8, 0x1A, 0xF4, 0xA9, 0xD8, 0x79, 0x7B, 0x28, 0x76, 0x93, 0x15,
+    0xB1, 0x1B, 0xAD, 0x08, 0x9D, 0xD3, 0x62, 0x5E, 0x1B, 0xF6, 0x01, 0x40, 0xEF, 0xD0, 0x78, 0x54,
+    0x11, 0x50, 0x80, 0x34, 0xF5, 0x8F, 0x3F, 0xFF, 0x57, 0x85, 0xC7, 0xFD, 0x93, 0xB7, 0xFF, 0xA3,
+    0x11, 0x13, 0x10, 0x80, 0x83, 0x80, 0x74, 0x10, 0x1E, 0x88, 0x80, 0x06, 0xBA, 0xED, 0x67, 0x2C,
+    0xD0, 0xBB, 0x62, 0xC5, 0x06, 0xBA, 0x11, 0x62, 0x06, 0xCA, 0xAB, 0x5A, 0xD7, 0x14, 0x95, 0x9D,
+    0x26, 0xCD, 0xF2, 0x74, 0x02, 0xD4, 0x00, 0xE9, 0x2A, 0xE1, 0xFF, 0xF1, 0xA2, 0x0D, 0xBC, 0x75,
+    0x6B, 0x5A, 0xDE, 0xAB, 0x00, 0x39, 0xA2, 0x99, 0x01, 0xD4, 0x59, 0xF0, 0x36, 0x93, 0xE5, 0x39,
+    0x7E, 0xC9, 0x99, 0xB1, 0xCF, 0x55, 0x02, 0xD0, 0x00, 0xAF, 0xA1, 0x49, 0xD0, 0xB1, 0x61, 0xD0,
+    0xDC, 0xE4, 0xA8, 0xA7, 0xC6, 0xE3, 0xDF, 0x02, 0xC0, 0xDA, 0xA1, 0xA4, 0xEE, 0xB2, 0x1F, 0x8F,
+    0xAC, 0x61, 0x6D, 0xE0, 0xA0, 0x37, 0xB3, 0x60, 0x17, 0xDA, 0xA8, 0x5C, 0x37, 0xED, 0xC3, 0x1A,
+    0xD6, 0x44, 0xD2, 0x5F, 0x64, 0xE5, 0x8E, 0xBC, 0xF2, 0xEE, 0x5F, 0xBF, 0xFB, 0x24, 0xD0, 0x74,
+    0x16, 0x67, 0xF1, 0xEC, 0x7B, 0xCF, 0xFE, 0xE5, 0x93, 0xC0, 0x11, 0xF6, 0x62, 0x2F, 0xA0, 0xD3,
+    0xCE, 0xAF, 0x36, 0xDF, 0xFD, 0x03, 0x74, 0xFA, 0x9F, 0x51, 0x7E, 0x4F, 0xFE, 0x04, 0xFE, 0x61,
+    0xF9, 0x3D, 0xE9, 0x13, 0xDB, 0xD2, 0xC5, 0x08, 0x39, 0x02, 0x00, 0x53, 0x31, 0x67, 0x42, 0xD3,
+    0x89, 0xE2, 0x1F, 0x70, 0x79, 0xAE, 0x23, 0x00, 0xC8, 0x31, 0x23, 0x02, 0x80, 0x98, 0x7B, 0x57,
+    0x0C, 0xC1, 0xA9, 0xF5, 0xBA, 0x90, 0xFD, 0x17, 0x42, 0xB1, 0x7E, 0xC8, 0x31, 0x77, 0x17, 0xFF,
+    0x0A, 0x7B, 0x7E, 0x55, 0x47, 0x75, 0xF8, 0x2A, 0x27, 0x49, 0xA3, 0x79, 0xE5, 0x0E, 0x53, 0xCB,
+    0xD0, 0xF2, 0xEA, 0x9C, 0xFB, 0xCB, 0xC1, 0x42, 0x9F, 0x8C, 0x5A, 0xDC, 0x8E, 0x72, 0x04, 0x62,
+    0xE7, 0x92, 0x16, 0x33, 0x90, 0x1B, 0xAF, 0xD6, 0x5D, 0x02, 0x74, 0x15, 0xE5, 0x35, 0xAF, 0x06,
+    0x28, 0xA3, 0xC5, 0x56, 0x94, 0x23, 0x3A, 0x27, 0x7F, 0x11, 0xD5, 0x8B, 0x1E, 0x72, 0x14, 0x99,
+    0xED, 0xC3, 0x88, 0xD6, 0x43, 0x11, 0x8C, 0x10, 0x33, 0x1A, 0x0E, 0xB2, 0x18, 0x26, 0x9F, 0x02,
+    0xBE, 0xF7, 0xA8, 0x56, 0x8F, 0x03, 0xD4, 0xB0, 0x32, 0x91, 0x8C, 0xC5, 0x70, 0x0B, 0xA0, 0xA3,
+    0x47, 0x5A, 0x71, 0x2C, 0xAB, 0xFE, 0x01, 0x50, 0x87, 0x82, 0x58, 0x89, 0x45, 0xEA, 0x85, 0xD8,
+    0x4E, 0x3B, 0xE5, 0xCE, 0xED, 0x94, 0xD5, 0x6A, 0xE4, 0xD4, 0xA9, 0xA0, 0xF7, 0xFC, 0x0A, 0xCF,
+    0x9C, 0xC1, 0x9F, 0x0D, 0xFD, 0xE5, 0x39, 0xF7, 0x84, 0x8D, 0x35, 0x7D, 0xC7, 0xDB, 0xD1, 0xF2,
+    0x75, 0xE6, 0x86, 0xB1, 0xE5, 0xD5, 0x99, 0xFD, 0xE5, 0x68, 0xE5, 0xED, 0x54, 0xE5, 0xD6, 0x27,
+    0x79, 0x75, 0x56, 0x87, 0xC7, 0x0C, 0xC8, 0x5F, 0x44, 0xF9, 0x85, 0x57, 0xA7, 0xC7, 0x0C, 0xF4,
+    0xAF, 0x2F, 0x65, 0x5B, 0x06, 0x60, 0x55, 0xCE, 0x88, 0xF2, 0xEA, 0xAC, 0x4E, 0x8F, 0x19, 0x55,
+    0x44, 0xEA, 0xAE, 0x06, 0x75, 0x78, 0x4A, 0x10, 0x01, 0xD6, 0x5E, 0xCA, 0x6C, 0x1E, 0x46, 0x34,
+    0x1E, 0x8A, 0x03, 0x93, 0x60, 0x80, 0x1C, 0x21, 0x13, 0xD4, 0x0C, 0x5B, 0xA8, 0xC7, 0x50, 0xD4,
+    0xA0, 0xC8, 0xB0, 0x50, 0xA6, 0x77, 0xD2, 0xB5, 0x93, 0xF0, 0xD5, 0x3B, 0x40, 0x6E, 0x7D, 0xEB,
+    0x95, 0x51, 0x27, 0x63, 0x1D, 0xE5, 0x28, 0xDD, 0x05, 0x5C, 0x10, 0x5E, 0xF8, 0x7E, 0x78, 0x7A,
+    0x78, 0x17, 0xC8, 0xAD, 0x57, 0xC6, 0x8A, 0xD0, 0x3B, 0x75, 0x32, 0xCA, 0xB1, 0x77, 0xA9, 0xF5,
+    0xD2, 0x5D, 0x10, 0xBE, 0x9D, 0x54, 0x3D, 0x0B, 0xDF, 0x0F, 0xB1, 0x7A, 0x67, 0xAF, 0x79, 0x19,
+    0xCA, 0xB4, 0x1E, 0x19, 0x9D, 0xAB, 0x03, 0x14, 0x9A, 0x09, 0xEF, 0xAA, 0x93, 0x11, 0x56, 0x04,
+    0xE4, 0xD6, 0x57, 0x51, 0x4E, 0x75, 0x90, 0x4E, 0xF8, 0xDE, 0x34, 0x93, 0xC2, 0x5E, 0xF3, 0xAF,
+    0xD5, 0xC9, 0xD8, 0x8D, 0x75, 0x94, 0x13, 0x21, 0x27, 0x2B, 0x02, 0xB4, 0x08, 0x9D, 0xAB, 0x83,
+    0x74, 0x19, 0xD2, 0x5D, 0x10, 0x1E, 0xAF, 0x09, 0xDF, 0x99, 0xFA, 0xEC, 0xD3, 0xC3, 0xBB, 0xD8,
+    0x07, 0xBC, 0x0A, 0x24, 0x54, 0x84, 0xB8, 0x6E, 0x9A, 0x4D, 0x27, 0x4F, 0x4D, 0x5D, 0xE5, 0x0F,
+    0x22, 0x3C, 0x87, 0x57, 0xF1, 0x3D, 0xF4, 0xA6, 0xF3, 0x72, 0x96, 0x41, 0xC6, 0x36, 0xD6, 0x84,
+    0xF2, 0x22, 0x17, 0xB7, 0x83, 0x0B, 0x78, 0x0A, 0x6B, 0x68, 0x5D, 0x1B, 0x61, 0x9D, 0x0C, 0xE0,
+    0xD0, 0xCD, 0x4D, 0x12, 0x49, 0xE4, 0x9A, 0x35, 0xD1, 0xEF, 0x68, 0x2F, 0x9E, 0x82, 0xC6, 0x53,
+    0x98, 0xEB, 0x8C, 0x0F, 0xDA, 0xB9, 0x0D, 0x6D, 0x90, 0x73, 0xE7, 0xAC, 0x91, 0xF3, 0x53, 0x6D,
+    0x80, 0x9C, 0x61, 0x0D, 0xE4, 0xDC, 0x06, 0x40, 0xCE, 0xD6, 0x60, 0x9F, 0x64, 0x5C, 0x13, 0x41,
+    0xD2, 0xB1, 0xF7, 0x32, 0x8A, 0xA4, 0x9D, 0x9D, 0xA5, 0x3F, 0xDF, 0x72, 0xEE, 0x06, 0xD8, 0xD3,
+    0x33, 0x8A, 0xBB, 0x4C, 0xF1, 0x71, 0x5F, 0xBD, 0xE1, 0x03, 0x39, 0xB7, 0xA1, 0x9D, 0xE5, 0xDC,
+    0x19, 0x35, 0x49, 0xF7, 0x4F, 0x61, 0x87, 0x7F, 0x00, 0xE0, 0x1D, 0x00, 0x7A, 0x54, 0x5F, 0x64,
+    0x41, 0x35, 0xAA, 0xBB, 0x49, 0x64, 0x35, 0xAA, 0x1B, 0x49, 0x64, 0x35, 0xF6, 0x37, 0x62, 0x9D,
+    0x95, 0xEB, 0xAF, 0xC6, 0x3A, 0x29, 0xD7, 0x5F, 0x8D, 0x55, 0xEA, 0x5D, 0xF7, 0x71, 0xAC, 0x56,
+    0x80, 0xBA, 0x86, 0xB5, 0x43, 0xA9, 0xCE, 0x7A, 0x52, 0xF7, 0xB2, 0xA0, 0x72, 0xFD, 0x78, 0xA4,
+    0x80, 0xFE, 0x09, 0x0E, 0x9A, 0xB9, 0x21, 0x83, 0x4A, 0xF6, 0xE2, 0x89, 0xCB, 0xB1, 0x8E, 0xBD,
+    0xEB, 0x2F, 0xC7, 0x2A, 0x5A, 0xD3, 0xDD, 0xF2, 0x15, 0x23, 0xBA, 0x5C, 0xF8, 0x22, 0x0F, 0xE4,
+    0x1D, 0x47, 0xF2, 0x01, 0x28, 0xDE, 0xB9, 0xD5, 0x72, 0x6D, 0xDF, 0x02, 0xE2, 0x64, 0x5E, 0x25,
+    0x00, 0x10, 0x03, 0xF0, 0x87, 0xCF, 0x01, 0x8D, 0xF1, 0xA8, 0x7C, 0x33, 0x55, 0x1F, 0x16, 0x6F,
+    0xFA, 0x67, 0xF2, 0x32, 0xA4, 0x15, 0x67, 0x54, 0xA4, 0xC7, 0x6B, 0x68, 0x9D, 0x04, 0xA4, 0x70,
+    0xC0, 0x0F, 0xFE, 0x1B, 0xA0, 0x5A, 0x56, 0xD0, 0x3F, 0x03, 0x9E, 0x03, 0x3E, 0x00, 0x66, 0x54,
+    0x1E, 0x62, 0x44, 0xE3, 0x20, 0x07, 0x74, 0xC0, 0x0F, 0x77, 0xCD, 0xF7, 0x97, 0x83, 0xB8, 0xEC,
+    0xDA, 0x53, 0xA3, 0xAC, 0xFC, 0x01, 0xCC, 0xCF, 0xE1, 0xD5, 0xDD, 0xCB, 0x7A, 0x35, 0x0C, 0x7A,
+    0xB5, 0x9E, 0x97, 0x57, 0x37, 0x65, 0xC1, 0x36, 0xBF, 0x0A, 0xBA, 0x2C, 0x7F, 0x96, 0x90, 0x05,
+    0xBB, 0x18, 0xBA, 0xD6, 0x4E, 0xA4, 0xA3, 0x8B, 0x22, 0x79, 0x79, 0xE0, 0x61, 0x31, 0x80, 0x89,
+    0x50, 0x86, 0x42, 0xC4, 0x7E, 0x04, 0x50, 0x1D, 0x39, 0x20, 0xC6, 0xFD, 0xE5, 0x43, 0x43, 0xEF,
+    0x8A, 0xC7, 0x47, 0x53, 0x9C, 0xD6, 0x51, 0x45, 0x3C, 0xD5, 0x4C, 0x4F, 0x61, 0x78, 0x0D, 0x2F,
+    0x7D, 0x7E, 0xDF, 0xE2, 0xB5, 0xF5, 0xBF, 0xB8, 0xB3, 0x44, 0xB7, 0x44, 0x92, 0x5E, 0x92, 0xC4,
+    0x89, 0x34, 0x60, 0x0F, 0xFF, 0xAF, 0x62, 0x98, 0xE5, 0x8C, 0xF6, 0xA1, 0x07, 0xAC, 0x45, 0x33,
+    0x67, 0x40, 0x1F, 0x9E, 0x44, 0xEC, 0x47, 0xA8, 0x4B, 0x09, 0x07, 0x84, 0x41, 0x35, 0xFD, 0x60,
+    0xBB, 0x6F, 0xAF, 0x6C, 0xF4, 0xBC, 0xC2, 0x3B, 0x8C, 0xC5, 0xFD, 0x5E, 0x94, 0xD8, 0x3B, 0xC8,
+    0xA9, 0xF4, 0x52, 0x0D, 0xA5, 0x31, 0x09, 0xA8, 0x43, 0x71, 0xA4, 0xDF, 0xBE, 0x64, 0xCA, 0x80,
+    0xA4, 0xD2, 0x6E, 0x31, 0x17, 0x66, 0x57, 0xEE, 0xBA, 0x54, 0x78, 0x94, 0xC2, 0x0B, 0x2C, 0x2C,
+    0x81, 0xBA, 0x49, 0x92, 0x5B, 0x7A, 0x77, 0xE5, 0x96, 0x26, 0xF3, 0xC6, 0x59, 0x95, 0x75, 0xD6,
+    0xB9, 0xCA, 0x78, 0xE4, 0xF7, 0x6C, 0xD6, 0x59, 0xE7, 0xFD, 0x5F, 0xAB, 0xDD, 0x9F, 0x75, 0xD6,
+    0xF9, 0xD9, 0xF7, 0xB6, 0x0D, 0x49, 0x33, 0x74, 0x1E, 0x34, 0xD9, 0x16, 0xB3, 0xC0, 0x9B, 0xE4,
+    0xAC, 0xFE, 0x13, 0x2F, 0xDF, 0x3F, 0x11, 0xF7, 0x41, 0x7D, 0x3C, 0x14, 0x0F, 0xA1, 0x12, 0x99,
+    0x58, 0x24, 0x38, 0x3A, 0xC8, 0x00, 0x41, 0x40, 0x7B, 0x74, 0x11, 0x35, 0x1D, 0x94, 0x47, 0x93,
+    0x51, 0x16, 0x21, 0xC0, 0xD2, 0xD7, 0x8C, 0x85, 0x56, 0xED, 0x3E, 0xF6, 0xED, 0x80, 0xB0, 0x47,
+    0x45, 0x83, 0xBE, 0x40, 0x72, 0x5F, 0xFC, 0x27, 0x16, 0x80, 0x5E, 0x2D, 0xFB, 0xCA, 0x26, 0xE8,
+    0x6B, 0xA4, 0xEF, 0xB6, 0xC8, 0xDC, 0x24, 0xF5, 0x9F, 0x78, 0x91, 0x7F, 0x5C, 0xD4, 0x22, 0x22,
+    0x49, 0x0F, 0x50, 0x44, 0x80, 0x8E, 0x00, 0x9D, 0x72, 0x15, 0x9D, 0xF4, 0xA0, 0x13, 0x11, 0xD6,
+    0x80, 0x50, 0x0E, 0xCA, 0xC9, 0x69, 0xE5, 0x7E, 0xB0, 0x5A, 0x93, 0x58, 0x83, 0xF4, 0x90, 0xBE,
+    0xC9, 0x68, 0x72, 0xC5, 0xA1, 0xE2, 0xA0, 0x1C, 0x94, 0xAB, 0x86, 0xD5, 0x97, 0xBB, 0x79, 0x0F,
+    0x43, 0x93, 0x25, 0xE9, 0x78, 0x88, 0x8C, 0x6A, 0xB4, 0x3F, 0xE3, 0xE1, 0xF9, 0xBF, 0x40, 0x7F,
+    0x23, 0x01, 0x6D, 0xE0, 0x00, 0x91, 0x94, 0x43, 0x4D, 0xE9, 0x51, 0xF3, 0x50, 0x84, 0xE0, 0x40,
+    0x08, 0x0E, 0xCA, 0x55, 0x44, 0xEB, 0xA1, 0x51, 0x47, 0xF4, 0x6E, 0xD7, 0x77, 0xAB, 0x01, 0xFB,
+    0x21, 0x12, 0xD4, 0x54, 0xD1, 0xC8, 0x08, 0x3D, 0x09, 0x42, 0x7A, 0xD8, 0x01, 0x47, 0x50, 0x01,
+    0x96, 0xBC, 0x47, 0xF2, 0x7A, 0xB1, 0x29, 0x06, 0xA0, 0x77, 0xA8, 0x72, 0x19, 0x13, 0x3B, 0x40,
+    0x44, 0xA0, 0x1F, 0x77, 0x6A, 0x4C, 0x99, 0x94, 0x71, 0xDB, 0xDD, 0x71, 0xD1, 0xF8, 0x4D, 0xF7,
+    0x35, 0xE7, 0xA0, 0x18, 0x82, 0x62, 0xFC, 0x35, 0x69, 0x0E, 0x8A, 0x53, 0x50, 0x34, 0xE1, 0x87,
+    0xDF, 0x43, 0xF8, 0x21, 0x9E, 0x28, 0xBD, 0xF3, 0x07, 0x00, 0x6C, 0x11, 0x1F, 0x3B, 0x32, 0x2B,
+    0xC6, 0x03, 0x8A, 0xF1, 0x80, 0xFE, 0x96, 0xB4, 0x5C, 0x3B, 0x28, 0x17, 0x71, 0x13, 0xAF, 0x6C,
+    0xBC, 0xA7, 0x17, 0xE5, 0xA5, 0x26, 0xE7, 0x57, 0x15, 0xE3, 0xAB, 0x8A, 0x69, 0x49, 0x79, 0x57,
+    0x4A, 0xCB, 0xB5, 0xA8, 0xC9, 0x59, 0x93, 0xE3, 0x2B, 0x1B, 0x0B, 0xC4, 0x2A, 0x03, 0x64, 0xA0,
+    0x9E, 0x81, 0x76, 0xC4, 0x85, 0xEE, 0xF8, 0x0D, 0x92, 0xA7, 0x49, 0xAE, 0xE9, 0xFB, 0x47, 0x40,
+    0x0F, 0x79, 0x6B, 0x82, 0xED, 0x46, 0x11, 0x95, 0x6B, 0xC6, 0x9F, 0x2C, 0x64, 0xD5, 0x36, 0xB9,
+    0x0B, 0x6A, 0xFC, 0x83, 0x47, 0x40, 0xF1, 0x98, 0x88, 0x72, 0xEE, 0x46, 0x65, 0x2C, 0x62, 0xED,
+    0x9F, 0x0C, 0x27, 0xFE, 0xEE, 0x8E, 0xEF, 0xC4, 0xCF, 0x7F, 0xBF, 0x9E, 0x96, 0xA5, 0xA7, 0x0C,
+    0x70, 0x1E, 0xA8, 0x67, 0xF4, 0x6F, 0xFC, 0x4D, 0x20, 0x79, 0x83, 0xE4, 0xC5, 0xF5, 0x7C, 0x14,
+    0x2A, 0x42, 0x3C, 0x0C, 0xE8, 0x37, 0x67, 0x50, 0xFA, 0x6A, 0xFE, 0x7D, 0x60, 0x81, 0xF8, 0xB1,
+    0xFB, 0x28, 0xCA, 0x1B, 0x14, 0xB3, 0x3D, 0x19, 0xF7, 0x0C, 0x09, 0xD0, 0x80, 0x32, 0xE8, 0x1C,
+    0x5A, 0x0F, 0x31, 0xA3, 0x8E, 0x40, 0x5E, 0xD5, 0xCA, 0xB1, 0xD4, 0xAE, 0x55, 0xB1, 0xF3, 0xB9,
+    0x8D, 0xBA, 0x66, 0xEF, 0x94, 0x41, 0x85, 0xCA, 0xFE, 0x1D, 0x80, 0xEF, 0xB7, 0x64, 0x3E, 0x82,
+    0xA8, 0x48, 0x92, 0xF3, 0x6B, 0x78, 0x9A, 0xE4, 0xF8, 0x73, 0x60, 0xCD, 0xEE, 0xA2, 0x65, 0x47,
+    0x81, 0x86, 0x01, 0x75, 0x7E, 0x7F, 0xC6, 0x07, 0x68, 0xC6, 0xDF, 0x07, 0xDA, 0x43, 0x06, 0x78,
+    0xEE, 0x9F, 0x03, 0xD5, 0x80, 0xFA, 0x0C, 0x20, 0x46, 0x88, 0x53, 0xBF, 0x18, 0xDB, 0x1B, 0xD7,
+    0x7C, 0x5D, 0x2C, 0x0C, 0x78, 0xD6, 0xE6, 0xF7, 0x54, 0xB1, 0x19, 0x26, 0xE8, 0x8C, 0x8A, 0x34,
+    0xCD, 0xBD, 0x4F, 0xA6, 0xE6, 0xF2, 0xC7, 0x53, 0x25, 0xC6, 0x01, 0x62, 0x5C, 0x08, 0xA5, 0x76,
+    0xA8, 0x59, 0x8C, 0xD1, 0xF2, 0xEB, 0x96, 0xE4, 0x3F, 0x28, 0x2A, 0x8B, 0x6E, 0x71, 0x11, 0x7F,
+    0xED, 0xDB, 0xE6, 0xE8, 0xAF, 0xCA, 0xB3, 0xCA, 0x17, 0xDB, 0xE2, 0xCB, 0x40, 0x96, 0xDE, 0xB6,
+    0xBE, 0xF5, 0xFA, 0xC5, 0xA0, 0x8C, 0x3A, 0x15, 0xD4, 0xA5, 0x58, 0xC7, 0xEE, 0x62, 0x94, 0xA3,
+    0x74, 0x49, 0x4E, 0x17, 0x70, 0xA1, 0x99, 0xB4, 0xF0, 0xC2, 0xAB, 0xC2, 0xA2, 0xBD, 0xB3, 0x77,
+    0x78, 0x77, 0xDB, 0x37, 0x40, 0xBB, 0x6D, 0x77, 0x83, 0x12, 0x1B, 0xF6, 0x8D, 0x46, 0x3D, 0xD2,
+    0x3C, 0xEC, 0x3D, 0x94, 0x00, 0xF0, 0xED, 0x00, 0x08, 0x96, 0x88, 0x9F, 0xD7, 0x96, 0x40, 0xAF,
+    0xC7, 0x1C, 0x7F, 0xB5, 0xF3, 0xEE, 0xE2, 0x63, 0x57, 0x5C, 0xAC, 0x5E, 0x5E, 0x14, 0xE2, 0xD5,
+    0xC0, 0x01, 0x50, 0xD7, 0x32, 0x00, 0x5E, 0x0F, 0x80, 0xC8, 0xBD, 0x5B, 0xFC, 0x22, 0xBF, 0xFD,
+    0x78, 0x1A, 0xDB, 0x4D, 0x96, 0x71, 0xC7, 0x83, 0xAB, 0x1F, 0x1E, 0xF7, 0x40, 0x15, 0x00, 0xFC,
+    0x99, 0x9C, 0x01, 0x91, 0xF5, 0x04, 0xC8, 0xC8, 0x01, 0x50, 0xD3, 0x3B, 0xA5, 0x4F, 0x75, 0xD4,
+    0x5F, 0x64, 0x35, 0xBE, 0xF3, 0x8D, 0xE7, 0x8E, 0xA8, 0x6B, 0x59, 0xDF, 0x88, 0x6B, 0xCB, 0x1B,
+    0xD4, 0xB8, 0xC4, 0x57, 0xA9, 0x71, 0xA9, 0xF9, 0xC6, 0xF1, 0x0E, 0xAA, 0x77, 0xD4, 0x08, 0x75,
+    0x2D, 0xA3, 0xC9, 0x6A, 0x82, 0xFE, 0x38, 0xA2, 0xFE, 0xD6, 0x3B, 0x8F, 0xEC, 0x7E, 0xA1, 0x9E,
+    0x16, 0x77, 0xAF, 0x35, 0xA0, 0x10, 0x5D, 0x40, 0x01, 0xD0, 0x88, 0x62, 0x16, 0x59, 0x78, 0xE5,
+    0x65, 0x94, 0x8E, 0x4E, 0x4D, 0xAA, 0x26, 0x0E, 0x20, 0xD6, 0x53, 0xA1, 0xDF, 0xBB, 0xEE, 0x2E,
+    0xAE, 0x35, 0xBB, 0x8E, 0x08, 0xE8, 0x01, 0x4B, 0x24, 0x1E, 0x84, 0x07, 0xEA, 0x33, 0xD2, 0x3D,
+    0x8D, 0xF2, 0x12, 0xBA, 0x28, 0x63, 0x79, 0x77, 0xEB, 0xA5, 0xD3, 0x43, 0xF9, 0xE4, 0x72, 0x77,
+    0x1D, 0xD5, 0xAE, 0x31, 0xE9, 0x2F, 0x67, 0x75, 0x37, 0xEF, 0x1D, 0x00, 0xA0, 0x5A, 0x86, 0xEB,
+    0x7F, 0x2A, 0x72, 0x6F, 0xEF, 0xB0, 0xF7, 0x50, 0xD2, 0x37, 0x72, 0x67, 0xF0, 0xF4, 0xA1, 0xA4,
+    0x6F, 0xA4, 0xCE, 0xA0, 0x3B, 0x95, 0xF4, 0x8D, 0xB4, 0x77, 0xC0, 0x2E, 0xE9, 0xF3, 0x37, 0x90,
+    0x5C, 0xFF, 0x61, 0xF9, 0x3D, 0xE9, 0x13, 0x2A, 0xF6, 0x41, 0xFA, 0x66, 0x14, 0xEE, 0x49, 0xEE,
+    0xAF, 0x0D, 0x50, 0x0D, 0xC2, 0x35, 0xA3, 0xF4, 0x7D, 0x50, 0xF1, 0xC9, 0x9E, 0xA8, 0x4D, 0x3B,
+    0xFD, 0xE0, 0x0F, 0x7F, 0xF0, 0x87, 0xED, 0xF4, 0x64, 0x5F, 0x01, 0xB4, 0xF9, 0xCD, 0x7A, 0x5E,
+    0x67, 0x28, 0xD6, 0xCC, 0xF2, 0x4E, 0xD4, 0x2F, 0x6E, 0x45, 0x79, 0xCD, 0xAB, 0x75, 0x97, 0xF4,
+    0xA1, 0x39, 0xF7, 0x97, 0x48, 0x41, 0x2F, 0x08, 0x00, 0xDF, 0x3F, 0xFF, 0x2A, 0xCE, 0xAF, 0x8E,
+    0x97, 0xF1, 0xB4, 0x01, 0x21, 0x23, 0xB4, 0x17, 0xD7, 0xDD, 0x41, 0x55, 0xF9, 0x28, 0x0F, 0x79,
+    0xCB, 0x07, 0xE4, 0x57, 0x1B, 0x79, 0x10, 0x1E, 0xD2, 0x3D, 0xBB, 0x21, 0x38, 0x6B, 0xBE, 0xE8,
+    0xF0, 0x53, 0xB4, 0x1C, 0x35, 0x4D, 0x1D, 0x21, 0x1D, 0xE2, 0x96, 0xFE, 0x88, 0xB3, 0x0E, 0x00,
+    0x70, 0x62, 0x94, 0x1C, 0xF8, 0x77, 0xAD, 0x87, 0x02, 0x12, 0x1B, 0xB2, 0x1B, 0x93, 0x16, 0x73,
+    0x94, 0x57, 0xEF, 0x5B, 0xC1, 0x50, 0x73, 0x28, 0xA6, 0x33, 0xF2, 0x2A, 0x39, 0x20, 0xA2, 0x9D,
+    0xA0, 0x50, 0x07, 0x48, 0x87, 0x0B, 0x10, 0x33, 0x7A, 0x87, 0x84, 0xD6, 0xA3, 0xCE, 0xD0, 0x3C,
+    0x74, 0xDF, 0x4A, 0x17, 0xFB, 0x37, 0x26, 0x45, 0xD8, 0xD0, 0x3E, 0x0C, 0x4A, 0x6C, 0x85, 0xF6,
+    0xEA, 0xAC, 0x5B, 0x86, 0xB2, 0xBD, 0x47, 0x9D, 0xA0, 0x29, 0x72, 0xEE, 0x5C, 0xD4, 0xF5, 0x56,
+    0x94, 0x57, 0x33, 0x5F, 0xCC, 0xA9, 0x3A, 0xE4, 0xD1, 0xBB, 0x1F, 0xA7, 0x86, 0x63, 0x77, 0x1F,
+    0x00, 0xEA, 0x33, 0x98, 0xF1, 0xC3, 0x6A, 0xFD, 0xDF, 0x93, 0xAF, 0x3C, 0x30, 0x3F, 0x84, 0x1C,
+    0xEA, 0x11, 0xC7, 0x8E, 0x29, 0xFE, 0xDF, 0x1B, 0x67, 0x01, 0xC5, 0xEB, 0x9C, 0x81, 0x8D, 0x0D,
+    0xCD, 0x5F, 0x1E, 0x3B, 0x52, 0x1D, 0xF9, 0xA9, 0xBC, 0x38, 0xF7, 0xC2, 0x1F, 0x14, 0xD3, 0x0F,
+    0xC5, 0x78, 0x50, 0x4C, 0x7D, 0xE5, 0xA5, 0xF9, 0xB0, 0x9E, 0x8E, 0x36, 0x63, 0x5F, 0xCD, 0xD2,
+    0x7C, 0xD8, 0xBA, 0x57, 0x1B, 0xF7, 0x6A, 0xE3, 0x3E, 0x94, 0x6E, 0xEE, 0xC5, 0xF4, 0x21, 0x80,
+    0xF6, 0x74, 0xB0, 0xFC, 0xD2, 0xEB, 0xF3, 0xE2, 0xE1, 0xA8, 0x76, 0xB2, 0x97, 0xEB, 0xB3, 0x4F,
+    0x38, 0x21, 0x78, 0x16, 0xCA, 0x69, 0x6F, 0x63, 0xAF, 0x6B, 0xE9, 0x84, 0x47, 0x84, 0xC2, 0x76,
+    0x61, 0x4F, 0xAE, 0x19, 0x15, 0xC7, 0x31, 0x43, 0x4E, 0x55, 0x84, 0x32, 0x72, 0x6A, 0x42, 0x95,
+    0xA1, 0x78, 0x97, 0x54, 0xF4, 0x7B, 0x32, 0xC8, 0xFA, 0x41, 0xAE, 0xAA, 0x88, 0x66, 0xDA, 0x4B,
+    0xA8, 0x19, 0xEF, 0x07, 0x08, 0x0F, 0x79, 0xF9, 0x3F, 0x53, 0x72, 0xEE, 0x39, 0xA0, 0x84, 0x6F,
+    0xFC, 0xFF, 0x13, 0xFD, 0xF7, 0x9F, 0xE8, 0x3D, 0x1C, 0x98, 0xD6, 0x84, 0x87, 0x6A, 0x79, 0xF7,
+    0xBE, 0x56, 0xE2, 0xAE, 0xD7, 0x8A, 0xDE, 0x1E, 0xAE, 0xF2, 0xA0, 0xF8, 0x42, 0xE8, 0xA5, 0xFB,
+    0xA9, 0xE2, 0x9C, 0x37, 0xFE, 0xDC, 0xA3, 0x9D, 0x9E, 0x92, 0xF4, 0x4D, 0x1E, 0xAA, 0x3C, 0x28,
+    0x9E, 0x0C, 0xEA, 0xB0, 0x53, 0x0A, 0x31, 0x8A, 0xBB, 0x5E, 0x5E, 0x99, 0xCE, 0x4B, 0x4E, 0x4D,
+    0xC2, 0x6B, 0xF5, 0x9C, 0x3A, 0x17, 0x63, 0xC5, 0xB1, 0xCE, 0x90, 0x01, 0x76, 0x6E, 0xEE, 0x7A,
+    0x25, 0x6E, 0xCF, 0xCD, 0xD8, 0x66, 0x58, 0x56, 0x83, 0x06, 0xCE, 0x3F, 0xFB, 0xFE, 0x4C, 0x5E,
+    0x9D, 0x7A, 0xE9, 0xA2, 0xE4, 0xD8, 0x06, 0xBC, 0x8C, 0x76, 0xC4, 0x79, 0xB4, 0x23, 0xCE, 0xDB,
+    0x97, 0x98, 0xEC, 0x4B, 0x0F, 0x27, 0xB5, 0x1B, 0xF6, 0xEE, 0xB9, 0xFE, 0x65, 0xD4, 0x33, 0xDA,
+    0x11, 0xFD, 0x80, 0xF3, 0xF5, 0x67, 0xB3, 0x7A, 0xE9, 0xEA, 0xDC, 0xEB, 0xC1, 0x86, 0x9A, 0x73,
+    0x7B, 0xC3, 0xF7, 0x2F, 0xFA, 0xF3, 0xED, 0xA7, 0x73, 0x3B, 0xBE, 0x7C, 0x7E, 0xD7, 0xF1, 0xEA,
+    0x4F, 0xEC, 0x8B, 0xA1, 0x27, 0xF9, 0xE6, 0x6C, 0xDF, 0xB8, 0x33, 0x77, 0x2E, 0x9E, 0x17, 0x53,
+    0xDF, 0x0F, 0xA1, 0xBD, 0x32, 0x1E, 0xAC, 0xEF, 0xCC, 0xD2, 0x7C, 0x78, 0x5E, 0x4C, 0x7D, 0x87,
+    0xD0, 0xBA, 0x9F, 0x3C, 0xEE, 0xC3, 0x3F, 0xB9, 0x50, 0x93, 0xED, 0x7C, 0xA1, 0x1F, 0xE2, 0x79,
+    0x71, 0x67, 0x96, 0x57, 0x46, 0xD5, 0x7F, 0x1C, 0x2C, 0x2F, 0x7D, 0x15, 0x96, 0xE6, 0xA0, 0x9E,
+    0x81, 0x26, 0x4B, 0x5E, 0x9D, 0xBE, 0x97, 0xD1, 0x45, 0xD8, 0xB1, 0x0E, 0x67, 0x0E, 0x2A, 0xBE,
+    0x94, 0x87, 0x66, 0x68, 0x4D, 0x97, 0x6C, 0xEE, 0x8C, 0x5C, 0xFD, 0x9C, 0xCC, 0x25, 0x02, 0x09,
+    0x7D, 0x1E, 0xA0, 0x38, 0x41, 0x71, 0x46, 0x7F, 0xFF, 0xDF, 0x14, 0xAB, 0x60, 0x04, 0x2A, 0xEE,
+    0xD9, 0x78, 0x57, 0x9F, 0x24, 0xBB, 0xC9, 0x72, 0x33, 0xF6, 0xF4, 0x6C, 0x67, 0xA8, 0xAF, 0x12,
+    0x1A, 0x92, 0x46, 0x17, 0x5F, 0x80, 0x50, 0x42, 0x3C, 0xED, 0x00, 0xF4, 0x9F, 0x1F, 0x41, 0xCB,
+    0x88, 0xBA, 0x58, 0xD0, 0x17, 0x16, 0xB8, 0xFA, 0xD4, 0x03, 0x7F, 0x74, 0xA0, 0xC4, 0x83, 0xA9,
+    0xE2, 0xEA, 0x10, 0x04, 0x93, 0x1D, 0xEC, 0x97, 0x2F, 0x9D, 0x91, 0xC1, 0xFF, 0xBC, 0xA6, 0x94,
+    0x50, 0x9F, 0x7A, 0x2F, 0xD2, 0x81, 0xDF, 0x87, 0xFA, 0xF8, 0xE3, 0x49, 0xA4, 0xE7, 0xFE, 0x08,
+    0xEA, 0xC6, 0x65, 0x57, 0xF3, 0xD5, 0xE7, 0xD0, 0xF1, 0x0D, 0x03, 0xCE, 0x1F, 0xA0, 0xE5, 0xDB,
+    0x7F, 0x01, 0xB5, 0x6C, 0xC3, 0x80, 0x9A, 0x9C, 0xF0, 0x47, 0x7F, 0x36, 0x40, 0x5C, 0x1E, 0x81,
+    0xEF, 0x7F, 0x7F, 0xDB, 0x8D, 0x73, 0x02, 0x19, 0x05, 0x19, 0x24, 0xFF, 0x83, 0xEF, 0x03, 0xBE,
+    0xA7, 0xA6, 0xC2, 0x4C, 0x59, 0x07, 0xF0, 0xF5, 0xB3, 0x1F, 0xF2, 0x85, 0x7B, 0x91, 0x2F, 0x30,
+    0xF0, 0x05, 0xFE, 0x8A, 0x27, 0x09, 0x7B, 0x32, 0xC1, 0x5E, 0x4A, 0xD0, 0x1F, 0x27, 0xA8, 0x3B,
+    0x09, 0x1D, 0xF3, 0xCF, 0x17, 0xA7, 0x98, 0x19, 0x9A, 0x13, 0x70, 0x04, 0x4D, 0x71, 0x33, 0xDB,
+    0x49, 0x5F, 0x37, 0x74, 0xA5, 0x63, 0x47, 0x97, 0x88, 0xFD, 0x92, 0x96, 0xFA, 0x67, 0xD2, 0x51,
+    0x58, 0x26, 0x58, 0x26, 0x3C, 0x93, 0x8E, 0x3E, 0xF2, 0xCC, 0xA2, 0xB3, 0x3C, 0x03, 0xCB, 0xB9,
+    0x22, 0xBD, 0xE0, 0x5F, 0x4C, 0x22, 0xED, 0x5C, 0xFF, 0xD3, 0xBC, 0x01, 0x92, 0x20, 0x89, 0x26,
+    0x02, 0xC7, 0xD3, 0xB1, 0x47, 0xCE, 0xDB, 0x50, 0x8C, 0xC7, 0xF6, 0xE6, 0xC6, 0xBB, 0x8B, 0xA9,
+    0x22, 0x2E, 0x46, 0x8A, 0xC5, 0xAB, 0xB5, 0x7C, 0xA4, 0x30, 0xAB, 0xFD, 0x80, 0xDC, 0xF2, 0x30,
+    0xBD, 0xBA, 0x4E, 0x92, 0x87, 0x49, 0x92, 0x77, 0xF9, 0x4B, 0xA6, 0xF5, 0xC8, 0xB1, 0x8B, 0x15,
+    0xB5, 0x17, 0x84, 0xBA, 0x1E, 0x40, 0x23, 0xEF, 0x65, 0xA8, 0x51, 0x24, 0x1A, 0x39, 0x83, 0x7A,
+    0x6A, 0x12, 0xD4, 0xF5, 0x20, 0x38, 0xC8, 0x7B, 0xB9, 0xE2, 0x28, 0x12, 0x0D, 0x67, 0x50, 0x4F,
+    0x3A, 0x41, 0x5D, 0x0F, 0x3D, 0x07, 0x79, 0x2F, 0x4B, 0x3B, 0x8A, 0x54, 0x76, 0x18, 0x58, 0x38,
+    0xA0, 0x7A, 0x97, 0x33, 0x8A, 0x0C, 0x55, 0x10, 0xC4, 0x05, 0x70, 0xEC, 0x8D, 0x0A, 0xED, 0x24,
+    0x59, 0x07, 0xF1, 0xD0, 0x5D, 0x40, 0x0A, 0xFD, 0xEB, 0xD6, 0x9E, 0x0B, 0x96, 0xE4, 0xF1, 0x07,
+    0x99, 0x26, 0x1E, 0xEC, 0x5E, 0xD7, 0xEB, 0x9F, 0xCC, 0x96, 0xE4, 0x09, 0x92, 0x63, 0x94, 0xD7,
+    0x8D, 0xAA, 0x1F, 0x4E, 0xD2, 0xE9, 0x20, 0xBC, 0xCC, 0x88, 0x35, 0x8D, 0x82, 0x9E, 0xA4, 0x93,
+    0x01, 0x36, 0x1B, 0x2C, 0xDB, 0xCB, 0x48, 0x16, 0x8B, 0x15, 0x27, 0x80, 0x03, 0x1D, 0x44, 0x02,
+    0x87, 0x23, 0x72, 0x16, 0xA9, 0x75, 0x6A, 0x94, 0xB3, 0x02, 0x07, 0x7D, 0x31, 0x8A, 0xD4, 0x14,
+    0xE7, 0xD6, 0x7B, 0x8B, 0xD7, 0x73, 0x26, 0x67, 0x11, 0x05, 0xDF, 0x81, 0xF4, 0x25, 0xFE, 0xB9,
+    0x84, 0x3F, 0x73, 0x80, 0x88, 0xC5, 0xDD, 0x5D, 0xCE, 0x40, 0x4F, 0x8E, 0x80, 0x26, 0x07, 0xA0,
+    0xA0, 0xED, 0xA7, 0x60, 0xF3, 0x00, 0x14, 0xE7, 0x3F, 0x90, 0xA9, 0x88, 0xD6, 0x00, 0xF8, 0x02,
+    0x01, 0x70, 0xE0, 0xF3, 0x0C, 0x1C, 0xF8, 0x22, 0x13, 0x07, 0x4A, 0x46, 0x3E, 0x4F, 0xE9, 0xBF,
+    0xCF, 0xF7, 0x73, 0x37, 0x81, 0x0C, 0x32, 0x80, 0x9C, 0x24, 0x07, 0x72, 0x12, 0x9C, 0x78, 0xD8,
+    0xC3, 0x46, 0x1E, 0x0E, 0xE8, 0x32, 0x5F, 0x8C, 0xA8, 0xC9, 0x43, 0x09, 0x20, 0x5F, 0xE0, 0x3F,
+    0xAB, 0x32, 0x07, 0xAE, 0x33, 0x71, 0xB0, 0xD7, 0x19, 0x39, 0xA8, 0x4F, 0x4A, 0xF0, 0xCC, 0x3E,
+    0x68, 0x28, 0xD3, 0x9D, 0xF2, 0x4D, 0xAC, 0x83, 0x1A, 0xAC, 0x53, 0xA7, 0xE6, 0x36, 0x8A, 0x59,
+    0x19, 0x8E, 0xAA, 0x0E, 0xF2, 0x42, 0xE3, 0x3B, 0x77, 0x6F, 0xD2, 0x55, 0xEC, 0x74, 0x3B, 0xC9,
+    0x8B, 0x77, 0xFC, 0x85, 0x3D, 0xD9, 0xDA, 0x73, 0x7F, 0x6B, 0x49, 0xF2, 0xFF, 0xA4, 0x3D, 0x77,
+    0xEB, 0x6F, 0x9B, 0x1B, 0x53, 0x88, 0xD0, 0x3F, 0x95, 0xD7, 0x9D, 0xB8, 0x37, 0xA6, 0x00, 0xF5,
+    0x61, 0x7B, 0x6B, 0x10, 0x74, 0xDA, 0xA3, 0x8F, 0x0D, 0x51, 0xD1, 0x28, 0x8F, 0x6E, 0x16, 0x19,
+    0xE0, 0xD0, 0x4F, 0xD0, 0x7C, 0x80, 0xE6, 0x2B, 0x92, 0xA6, 0xFB, 0x84, 0xA4, 0xD3, 0x27, 0x3E,
+    0xFF, 0x11, 0x9F, 0x4F, 0x76, 0xA8, 0xD8, 0x7C, 0x95, 0x9E, 0x3E, 0x15, 0xBB, 0x4F, 0x66, 0xFB,
+    0x92, 0xD7, 0x27, 0x3E, 0x4E, 0xFD, 0x2F, 0x92, 0x7D, 0x69, 0xB6, 0x2F, 0x7E, 0x95, 0xFA, 0x8F,
+    0x53, 0xF7, 0xC9, 0x6C, 0x5F, 0x9A, 0x1F, 0x53, 0x6D, 0x4F, 0x7C, 0x9C, 0x9E, 0x3E, 0x15, 0xED,
+    0x4B, 0x33, 0xBA, 0x3B, 0xA9, 0x1F, 0x6B, 0xBE, 0x34, 0x5B, 0x32, 0xF6, 0x1F, 0x93, 0x74, 0xF6,
+    0x25, 0xF2, 0x57, 0x3B, 0xBE, 0xB1, 0x45, 0x26, 0xD3, 0x4C, 0x68, 0x8B, 0xDF, 0x76, 0x2E, 0x35,
+    0x83, 0x1A, 0x6B, 0xDE, 0x48, 0x20, 0xED, 0xD8, 0x93, 0x49, 0xF0, 0x3F, 0x70, 0xD4, 0xBE, 0x4D,
+    0x4D, 0x82, 0x1A, 0xAD, 0x13, 0xA9, 0x8D, 0x50, 0xA3, 0x1D, 0x45, 0xA9, 0xD1, 0xBE, 0x49, 0x82,
+    0x6F, 0x71, 0xEC, 0xC9, 0x04, 0x52, 0x8F, 0x35, 0x2F, 0xA5, 0x95, 0xA8, 0x0B, 0xEC, 0x3F, 0x76,
+    0x0C, 0x2D, 0x39, 0xE3, 0x95, 0x8D, 0x8D, 0x01, 0xB0, 0x01, 0x35, 0x39, 0x0A, 0xD2, 0xD7, 0xBC,
+    0x39, 0x83, 0xE6, 0x29, 0xD8, 0xC5, 0x99, 0xE3, 0xDC, 0x83, 0xF7, 0x56, 0x58, 0xCE, 0x43, 0x3B,
+    0xE0, 0xC4, 0xD6, 0x51, 0xA8, 0x12, 0xA6, 0x5D, 0x42, 0xEA, 0x65, 0x58, 0x02, 0xFD, 0x54, 0x3E,
+    0x6E, 0x04, 0x39, 0x41, 0x31, 0x2C, 0x41, 0x7E, 0x47, 0x20, 0x67, 0xF0, 0x50, 0x82, 0x75, 0x1C,
+    0x94, 0x53, 0xA3, 0x9A, 0xE4, 0xDC, 0x79, 0x91, 0xE4, 0x0C, 0xBE, 0x14, 0xA0, 0xAE, 0x46, 0xC8,
+    0xAF, 0x12, 0xFE, 0x05, 0xB9, 0x71, 0x98, 0xE4, 0x55, 0x92, 0xB3, 0xCC, 0x84, 0xC8, 0x6A, 0x04,
+    0x5F, 0x8C, 0x50, 0x23, 0x4D, 0x79, 0x44, 0x64, 0x70, 0xD0, 0xA3, 0x1A, 0x65, 0x94, 0x73, 0x55,
+    0xC2, 0x11, 0x3B, 0x92, 0x9B, 0x24, 0x6F, 0x93, 0x8C, 0xCB, 0x5E, 0x0A, 0xDF, 0x2F, 0x61, 0x25,
+    0x8A, 0xC5, 0x2B, 0x46, 0x64, 0x40, 0xF0, 0x7F, 0x43, 0xCB, 0x5B, 0xAE, 0xB9, 0xC5, 0x11, 0x7F,
+    0xBE, 0xEC, 0x27, 0x06, 0x3B, 0xA1, 0x62, 0x28, 0xF1, 0x68, 0x3F, 0xD8, 0xBD, 0xAB, 0xC4, 0xB6,
+    0x55, 0x86, 0x03, 0x80, 0x66, 0xD1, 0x28, 0x2F, 0x21, 0xA2, 0xDD, 0x5B, 0x2B, 0x11, 0x9E, 0x63,
+    0x89, 0x52, 0x0D, 0x00, 0x44, 0x5C, 0x85, 0xAA, 0x2B, 0x87, 0x45, 0xAF, 0x0E, 0xA8, 0xB1, 0xEC,
+    0x88, 0xE1, 0xC1, 0xE2, 0x6D, 0xA1, 0xDD, 0x89, 0x5F, 0x55, 0x19, 0xBD, 0xB7, 0x1C, 0xAC, 0x91,
+    0x41, 0xDF, 0xF2, 0x6A, 0x6C, 0xA3, 0x32, 0x49, 0xFA, 0x26, 0x77, 0x4E, 0xBD, 0x11, 0x5B, 0xB6,
+    0x5E, 0x7E, 0xC6, 0x73, 0x3C, 0x14, 0xC5, 0x4C, 0x72, 0xE0, 0xCF, 0xA2, 0x62, 0x86, 0x66, 0x92,
+    0xFC, 0x15, 0xFA, 0x5B, 0x25, 0xA4, 0xD0, 0x1F, 0x29, 0xFA, 0x60, 0x2C, 0x76, 0x93, 0xA2, 0x67,
+    0x2E, 0x13, 0xBC, 0xA8, 0xDD, 0xE4, 0x4A, 0x67, 0xBC, 0x13, 0xC2, 0x1C, 0x00, 0x4D, 0x07, 0xC5,
+    0x80, 0x6E, 0x8B, 0x68, 0xA3, 0x72, 0x75, 0x6E, 0x3D, 0xEC, 0xE5, 0x88, 0xCE, 0x13, 0x22, 0xE9,
+    0x01, 0xF6, 0x96, 0x83, 0xE4, 0x54, 0xBC, 0xAC, 0xD4, 0x8C, 0x7F, 0xD0, 0x46, 0x34, 0x27, 0x69,
+    0xC4, 0x6D, 0xFA, 0x3A, 0x33, 0x83, 0xD9, 0xBA, 0x0B, 0x94, 0xB3, 0xEA, 0x0F, 0xE5, 0xFE, 0x90,
+    0xD1, 0x0E, 0xC3, 0xEE, 0xED, 0xC3, 0xD6, 0xE8, 0xD0, 0x70, 0x2A, 0xAE, 0x07, 0x6A, 0x82, 0xE4,
+    0xDF, 0x42, 0x90, 0x13, 0x48, 0x42, 0xFD, 0x92, 0x63, 0xB7, 0xB5, 0x9E, 0x14, 0xC9, 0x2F, 0x49,
+    0xCE, 0xCA, 0x49, 0xBF, 0xBE, 0xF5, 0xE3, 0xA5, 0xE2, 0x26, 0x7F, 0xA5, 0x9C, 0x1E, 0xB7, 0x23,
+    0x1A, 0xC8, 0x09, 0xEA, 0xF3, 0x6F, 0xD9, 0x9E, 0x6C, 0x97, 0x4A, 0x53, 0x78, 0xA0, 0x66, 0x1E,
+    0xEA, 0x65, 0x63, 0x0D, 0xA7, 0xF8, 0x30, 0x4A, 0xBE, 0x56, 0x3D, 0xCF, 0xCB, 0x13, 0x7A, 0x7F,
+    0x10, 0x82, 0x62, 0x82, 0x1A, 0x0F, 0xA2, 0x49, 0xE2, 0xC1, 0x86, 0x1E, 0x15, 0xEF, 0x25, 0x41,
+    0xAA, 0x51, 0xF1, 0x6E, 0x16, 0x9F, 0x51, 0xF9, 0x83, 0xFD, 0x1D, 0x1E, 0xFA, 0x8C, 0x32, 0x1D,
+    0xEC, 0xBD, 0xE5, 0x43, 0x0A, 0x96, 0xD0, 0x19, 0xE2, 0x19, 0xE6, 0xA1, 0x60, 0xFF, 0x83, 0x8B,
+    0x26, 0x43, 0x10, 0x40, 0x97, 0xB0, 0x72, 0x03, 0xF3, 0x2B, 0x07, 0x39, 0x6D, 0x20, 0x22, 0x81,
+    0xEE, 0xB3, 0x04, 0x4B, 0xF2, 0x01, 0x49, 0x4E, 0xFD, 0xD4, 0x8F, 0xE0, 0xA0, 0xCD, 0x76, 0xD5,
+    0xE7, 0x7C, 0xEB, 0x78, 0x3A, 0x14, 0x21, 0xCB, 0xF6, 0x65, 0x34, 0xB0, 0x97, 0x63, 0xF1, 0xB8,
+    0x11, 0x89, 0x66, 0xD1, 0x60, 0xE0, 0x04, 0x0D, 0xC8, 0x84, 0x9E, 0x1C, 0x9B, 0x07, 0x36, 0xE2,
+    0x4C, 0xBD, 0xEA, 0x7D, 0xE7, 0x5F, 0xD9, 0x38, 0x97, 0x7B, 0x92, 0x7F, 0xF3, 0x3E, 0xF3, 0x59,
+    0xC1, 0x84, 0x1F, 0x33, 0x1D, 0xEB, 0x49, 0x7E, 0x42, 0x72, 0xDE, 0xB5, 0x89, 0x4C, 0x0D, 0x7E,
+    0x7E, 0xC2, 0xF5, 0x65, 0x40, 0x63, 0x89, 0xDD, 0xDE, 0x0E, 0x6B, 0x97, 0x06, 0xD0, 0x1C, 0x2A,
+    0x32, 0x55, 0x8B, 0xCF, 0xB9, 0xE1, 0x8D, 0xE9, 0x8C, 0x9E, 0x02, 0x7A, 0x7F, 0x10, 0x32, 0x48,
+    0x23, 0x92, 0x98, 0x2A, 0x0E, 0x01, 0x7A, 0x3C, 0x88, 0x6E, 0x2E, 0x15, 0xA0, 0x09, 0x50, 0xFE,
+    0x20, 0xDA, 0x24, 0x0D, 0x78, 0x75, 0xFA, 0x5E, 0x9F, 0x73, 0x14, 0x24, 0xD1, 0x93, 0xAE, 0x22,
+    0xCF, 0x14, 0x6A, 0x7D, 0x70, 0x51, 0x35, 0xEC, 0xC3, 0x11, 0x20, 0x56, 0x01, 0x55, 0xAC, 0x03,
+    0xEA, 0x28, 0x8A, 0x1F, 0x6E, 0x54, 0x24, 0xA3, 0x26, 0x19, 0x9F, 0x49, 0xEB, 0xE9, 0x68, 0x13,
+    0xDB, 0x80, 0xEF, 0xCC, 0x22, 0x9A, 0xD8, 0xE4, 0x7D, 0x4D, 0x14, 0x4C, 0x4D, 0xAC, 0x99, 0x9A,
+    0x58, 0xDC, 0x22, 0xAB, 0x9D, 0xB5, 0x7B, 0x1F, 0x68, 0x48, 0x0F, 0x41, 0x06, 0x08, 0x7E, 0x19,
+    0x01, 0x9A, 0x3D, 0xCB, 0xB6, 0x23, 0x72, 0xC6, 0xE2, 0x3F, 0x09, 0x9B, 0x00, 0x48, 0xCE, 0x8B,
+    0x1B, 0x2D, 0x1A, 0x46, 0x00, 0x1D, 0x0D, 0x00, 0xED, 0x5F, 0x3E, 0xD0, 0x9E, 0x8A, 0x8A, 0x8C,
+    0xF6, 0xBF, 0x8C, 0x07, 0x65, 0x7F, 0x39, 0xCB, 0x43, 0xD7, 0x27, 0x7D, 0x75, 0x2C, 0x51, 0x59,
+    0x33, 0x2E, 0x90, 0x13, 0x0E, 0xC8, 0x9F, 0x39, 0xB4, 0xA7, 0x46, 0x0F, 0x0C, 0xDF, 0xDB, 0x57,
+    0xF6, 0xC6, 0x7A, 0x14, 0x33, 0x6D, 0xC7, 0xE1, 0x2F, 0x15, 0x9A, 0xE4, 0xD3, 0xEF, 0x73, 0xC3,
+    0xFC, 0x86, 0x7B, 0x06, 0x29, 0xD2, 0x93, 0xBC, 0x78, 0x9C, 0xC7, 0x20, 0x12, 0xD0, 0x06, 0x90,
+    0xBC, 0x5C, 0x76, 0xCC, 0x00, 0xBA, 0x19, 0x3F, 0x2A, 0x3B, 0x5B, 0xCA, 0xC5, 0xA6, 0xA0, 0xA6,
+    0x85, 0x4D, 0x74, 0xA8, 0x58, 0xB6, 0x91, 0x6A, 0x72, 0xD9, 0x6B, 0x40, 0x46, 0x88, 0x88, 0x25,
+    0xED, 0x81, 0xC8, 0x16, 0x82, 0x19, 0xCF, 0x70, 0x04, 0x53, 0x05, 0xA6, 0x13, 0x38, 0x44, 0xA2,
+    0xE1, 0x0C, 0x5B, 0xE2, 0x29, 0xF9, 0x45, 0x04, 0x45, 0xAC, 0xB2, 0x88, 0x75, 0x12, 0x51, 0x44,
+    0x11, 0x65, 0x10, 0xD9, 0x7A, 0x51, 0xA8, 0xC7, 0x20, 0x38, 0x6F, 0x1B, 0xE4, 0x56, 0x61, 0xCF,
+    0x07, 0x35, 0x00, 0xFC, 0x5B, 0x39, 0x00, 0xF8, 0xB9, 0x34, 0x00, 0xCE, 0x4B, 0xB7, 0x6C, 0x20,
+    0xC6, 0x41, 0x91, 0xE4, 0x24, 0x49, 0x72, 0xAE, 0xCE, 0xDD, 0xDC, 0x78, 0x3F, 0x42, 0x3A, 0xE0,
+    0x43, 0xC8, 0x8B, 0xCE, 0x3C, 0x07, 0x79, 0xE5, 0xDE, 0xF4, 0x1C, 0x24, 0x99, 0x3E, 0x84, 0x0C,
+    0x5A, 0x7B, 0xC8, 0xE9, 0x9F, 0xEE, 0x35, 0x8B, 0x76, 0xEF, 0x61, 0x04, 0x80, 0x7F, 0xC5, 0x9B,
+    0x1F, 0x16, 0x7F, 0x39, 0x00, 0x3D, 0x23, 0x80, 0x3D, 0xDC, 0xC1, 0x79, 0x45, 0xC9, 0x58, 0xD0,
+    0xC5, 0x37, 0xF3, 0xCE, 0x03, 0x78, 0xA6, 0xB0, 0x57, 0x64, 0x86, 0x20, 0x49, 0x27, 0x79, 0xEE,
+    0x2B, 0x4E, 0xDD, 0x2C, 0x7D, 0xEF, 0xD5, 0x28, 0xBD, 0x9C, 0x95, 0x93, 0xBE, 0x0D, 0xDA, 0x49,
+    0xDF, 0x44, 0x6D, 0xA4, 0x17, 0xD1, 0x2E, 0x39, 0xF0, 0xF8, 0xBC, 0x61, 0x1E, 0xAA, 0xC5, 0x61,
+    0xD9, 0x77, 0x64, 0x6A, 0x62, 0xC5, 0x8B, 0x44, 0xEF, 0xB5, 0x6B, 0x62, 0xE7, 0x6B, 0x36, 0xB1,
+    0xE6, 0xB9, 0x25, 0x26, 0xE9, 0xB3, 0xE2, 0xD6, 0xF8, 0x60, 0x58, 0x6D, 0xFB, 0x54, 0x93, 0x33,
+    0x2C, 0x33, 0x7A, 0x72, 0x78, 0x64, 0x63, 0x28, 0x00, 0xFF, 0xFD, 0x11, 0x00, 0xAF, 0x7E, 0x00,
+    0xA0, 0xBF, 0x00, 0xC0, 0x32, 0x00, 0x24, 0x47, 0x30, 0x33, 0x81, 0xB7, 0x7A, 0x3A, 0x7D, 0xED,
+    0xCA, 0xE9, 0x59, 0xDD, 0xBE, 0xF3, 0x19, 0xE5, 0xFC, 0xEA, 0x07, 0x7A, 0x33, 0x75, 0x07, 0xE4,
+    0x16, 0x9B, 0x2B, 0xA7, 0x92, 0xBE, 0xF8, 0xE9, 0xC8, 0xC3, 0xF3, 0xF6, 0x4E, 0x92, 0xD6, 0xAC,
+    0xC6, 0xA2, 0x28, 0x3B, 0xFB, 0x19, 0x40, 0xC3, 0x9B, 0x1B, 0x67, 0x25, 0x17, 0x6F, 0x6A, 0x0E,
+    0x65, 0x73, 0x88, 0x5F, 0x8C, 0xF8, 0xFD, 0xFF, 0x0A, 0xD5, 0xA7, 0x63, 0x53, 0x88, 0x52, 0x53,
+    0x4C, 0x14, 0x9B, 0x51, 0x46, 0xED, 0xF4, 0x66, 0x6C, 0xA2, 0x76, 0x76, 0x33, 0xDB, 0x50, 0xEC,
+    0xBB, 0x93, 0x26, 0x37, 0x63, 0x9B, 0xB4, 0x53, 0x5F, 0x44, 0x91, 0xB5, 0x53, 0x5F, 0xC4, 0x26,
+    0xEB, 0x2F, 0x79, 0x8D, 0x5C, 0x6E, 0x19, 0xAA, 0x4F, 0xCB, 0x3B, 0x7F, 0x31, 0x2E, 0x46, 0xCF,
+    0x65, 0xC7, 0xAE, 0x59, 0xA5, 0xE3, 0x22, 0x6F, 0x6F, 0xD5, 0x45, 0x83, 0xB2, 0x1B, 0x29, 0xDA,
+    0x08, 0xE8, 0x09, 0x82, 0x6F, 0x7D, 0xD0, 0x91, 0x46, 0x33, 0xC0, 0xE6, 0x05, 0xF2, 0xF6, 0x6C,
+    0x6C, 0xBC, 0x6B, 0xC9, 0x2B, 0xCB, 0xB2, 0xB3, 0xE4, 0x57, 0x0B, 0xA9, 0xF9, 0x5F, 0x8E, 0x1D,
+    0x3B, 0x0A, 0x1C, 0x41, 0x35, 0x40, 0x71, 0xB0, 0x19, 0xA4, 0x60, 0xAA, 0xC9, 0x86, 0x51, 0x70,
+    0xAD, 0x4D, 0x4F, 0x89, 0x54, 0x76, 0x95, 0x83, 0x0C, 0x68, 0x19, 0x7B, 0xCE, 0x9A, 0x91, 0xAB,
+    0xFC, 0xF7, 0xF2, 0xD1, 0xF5, 0xFB, 0x47, 0x76, 0xDF, 0xF3, 0xDB, 0xE4, 0x45, 0xA4, 0x61, 0xD2,
+    0x46, 0xF2, 0x0E, 0x61, 0x79, 0x25, 0x0A, 0xAE, 0xC9, 0x71, 0x7B, 0xFB, 0xAC, 0x9A, 0x6C, 0xA3,
+    0x66, 0xEC, 0x6F, 0x93, 0xDE, 0x5E, 0xD4, 0x9F, 0xBF, 0x40, 0x70, 0x68, 0xA3, 0x48, 0xE8, 0xBD,
+    0x9C, 0x61, 0x9D, 0x1A, 0xEB, 0x27, 0xAD, 0x2A, 0x31, 0x6C, 0xFC, 0x8A, 0x20, 0x7B, 0xDF, 0xF3,
+    0x0E, 0x05, 0xD7, 0x7A, 0xAF, 0xC6, 0x9A, 0x22, 0xA1, 0xF7, 0x96, 0x97, 0xA8, 0x19, 0xFB, 0x7B,
+    0xE4, 0x25, 0xFE, 0x5E, 0x3E, 0xBA, 0xEB, 0xD2, 0x6F, 0x54, 0x58, 0xC6, 0x17, 0x82, 0x73, 0xCB,
+    0x1B, 0xA1, 0x0C, 0xB1, 0x76, 0x3D, 0xBD, 0xE6, 0xE6, 0x32, 0xCA, 0xCA, 0xA8, 0x11, 0x34, 0xD8,
+    0x1E, 0x08, 0xCB, 0x4B, 0xE4, 0x8B, 0x71, 0x19, 0xEB, 0x4D, 0xF2, 0x23, 0xF2, 0xC5, 0x58, 0x86,
+    0x5B, 0x3B, 0x35, 0x82, 0xA6, 0x89, 0xE5, 0xE6, 0xDF, 0xE9, 0xE9, 0x23, 0x8D, 0xFD, 0x22, 0x82,
+    0x14, 0xCC, 0x5F, 0x6B, 0xAC, 0x76, 0x6A, 0x84, 0x2D, 0x0F, 0xB5, 0x01, 0xDA, 0x3D, 0xBE, 0xB1,
+    0xE9, 0xC8, 0x37, 0x6E, 0xFE, 0x1D, 0x9E, 0xA2, 0x1A, 0x50, 0xE2, 0x11, 0x25, 0x4B, 0xCC, 0x61,
+    0x84, 0x9E, 0x9F, 0x89, 0xB0, 0xC5, 0xDC, 0x2B, 0x22, 0xAC, 0x69, 0x99, 0xAD, 0x51, 0xDB, 0xD9,
+    0xEF, 0xA5, 0xA3, 0xCB, 0x85, 0xEF, 0xC8, 0x12, 0xAC, 0x11, 0xFC, 0x63, 0x6B, 0x6A, 0xD2, 0x9A,
+    0x8A, 0xB4, 0x06, 0x7A, 0x3B, 0xAA, 0xF3, 0x68, 0xB1, 0x0D, 0x2E, 0x62, 0x21, 0xB1, 0xC4, 0x5E,
+    0x42, 0xE4, 0x8A, 0x06, 0x50, 0x46, 0x06, 0x40, 0x04, 0xD0, 0x40, 0x73, 0xEC, 0x18, 0x7B, 0xB2,
+    0x25, 0x37, 0xC9, 0x89, 0x8C, 0xD6, 0xFD, 0x9B, 0x35, 0xBE, 0xF5, 0x52, 0x44, 0x51, 0x5D, 0x01,
+    0x34, 0x82, 0x33, 0x64, 0x40, 0xC7, 0x19, 0x34, 0xE8, 0x39, 0xC9, 0x00, 0xF4, 0x04, 0x0D, 0xD0,
+    0xCF, 0x32, 0x00, 0xE0, 0x60, 0x4D, 0x3B, 0x74, 0x73, 0x9B, 0xF6, 0x59, 0x12, 0x9A, 0x57, 0xCA,
+    0x9E, 0xCD, 0x9A, 0x13, 0x5A, 0xBA, 0xB5, 0xE1, 0xD1, 0xCD, 0x79, 0x16, 0x6F, 0xDB, 0x71, 0x87,
+    0x31, 0x87, 0x2C, 0xFF, 0xCA, 0xBE, 0x8F, 0xF2, 0xEF, 0x4E, 0x8C, 0x00, 0x66, 0xC8, 0x11, 0x90,
+    0x0E, 0x72, 0x04, 0xF8, 0xBF, 0x4E, 0xFD, 0x08, 0x49, 0x3A, 0x3D, 0x82, 0x64, 0xCD, 0x51, 0x92,
+    0xB3, 0xE4, 0x48, 0x72, 0xB0, 0xBC, 0x46, 0xCE, 0x2D, 0xF9, 0x06, 0x69, 0xC8, 0xD0, 0x30, 0x37,
+    0xA4, 0x69, 0x18, 0x7A, 0x06, 0x34, 0x24, 0x69, 0x56, 0xDB, 0x5F, 0x36, 0xA9, 0xA1, 0x01, 0x9A,
+    0x22, 0x0B, 0x34, 0xA3, 0x32, 0x00, 0x9A, 0x6B, 0x01, 0x3B, 0x9B, 0x3B, 0x2E, 0xFB, 0x01, 0x34,
+    0x66, 0xE5, 0x01, 0x86, 0xFF, 0x07,
 };
 
 static const EpdGlyph notosans_14_boldGlyphs[] = {
@@ -1999,7 +2010,7 @@ static const EpdGlyph notosans_14_boldGlyphs[] = {
     { 4, 30, 16, 6, 23, 30, 6932 }, // |
     { 11, 26, 12, 1, 21, 72, 6962 }, // }
     { 15, 6, 17, 1, 13, 23, 7034 }, // ~
-    { 0, 0, 8, 0, 0, 0, 0 }, //  
+    { 0, 0, 8, 0, 0, 0, 7057 }, //  
     { 6, 22, 8, 1, 16, 33, 0 }, // ¡
     { 13, 23, 17, 2, 22, 75, 33 }, // ¢
     { 16, 22, 17, 1, 22, 88, 108 }, // £
@@ -2010,775 +2021,782 @@ static const EpdGlyph notosans_14_boldGlyphs[] = {
     { 11, 4, 17, 3, 22, 11, 437 }, // ¨
     { 22, 23, 24, 1, 22, 127, 448 }, // ©
     { 10, 12, 11, 0, 22, 30, 575 }, // ª
-    { 16, 14, 18, 1, 15, 56, 605 }, // «
-    { 15, 9, 17, 1, 12, 34, 661 }, // ¬
-    { 9, 4, 9, 0, 10, 9, 695 }, // ­
-    { 22, 23, 24, 1, 22, 127, 704 }, // ®
-    { 16, 4, 15, -1, 26, 16, 831 }, // ¯
-    { 11, 11, 12, 1, 22, 31, 847 }, // °
-    { 15, 19, 17, 1, 19, 72, 878 }, // ±
-    { 10, 13, 11, 0, 25, 33, 950 }, // ²
-    { 11, 14, 11, 0, 25, 39, 983 }, // ³
-    { 9, 6, 11, 1, 23, 14, 1022 }, // ´
-    { 15, 23, 19, 2, 16, 87, 1036 }, // µ
-    { 16, 27, 19, 1, 23, 108, 1123 }, // ¶
-    { 6, 6, 8, 1, 13, 9, 1231 }, // ·
-    { 8, 7, 8, 0, 0, 14, 1240 }, // ¸
-    { 9, 13, 11, 0, 25, 30, 1254 }, // ¹
-    { 11, 12, 11, 0, 22, 33, 1284 }, // º
-    { 16, 14, 18, 1, 15, 56, 1317 }, // »
-    { 24, 21, 24, 0, 21, 126, 1373 }, // ¼
-    { 25, 21, 26, 0, 21, 132, 1499 }, // ½
-    { 24, 22, 25, 1, 22, 132, 1631 }, // ¾
-    { 14, 23, 14, 0, 17, 81, 1763 }, // ¿
-    { 21, 28, 20, 0, 28, 147, 1844 }, // À
-    { 21, 28, 20, 0, 28, 147, 1991 }, // Á
-    { 21, 28, 20, 0, 28, 147, 2138 }, // Â
-    { 21, 28, 20, 0, 28, 147, 2285 }, // Ã
-    { 21, 27, 20, 0, 27, 142, 2432 }, // Ä
-    { 21, 26, 20, 0, 26, 137, 2574 }, // Å
-    { 27, 21, 28, 0, 21, 142, 2711 }, // Æ
-    { 17, 29, 19, 1, 22, 124, 2853 }, // Ç
-    { 13, 28, 16, 2, 28, 91, 2977 }, // È
-    { 13, 28, 16, 2, 28, 91, 3068 }, // É
-    { 13, 28, 16, 2, 28, 91, 3159 }, // Ê
-    { 13, 27, 16, 2, 27, 88, 3250 }, // Ë
-    { 11, 28, 11, 0, 28, 77, 3338 }, // Ì
-    { 11, 28, 11, 0, 28, 77, 3415 }, // Í
-    { 13, 28, 11, -1, 28, 91, 3492 }, // Î
-    { 11, 27, 11, 0, 27, 75, 3583 }, // Ï
-    { 20, 21, 21, 0, 21, 105, 3658 }, // Ð
-    { 20, 28, 24, 2, 28, 140, 3763 }, // Ñ
-    { 21, 29, 23, 1, 28, 153, 3903 }, // Ò
-    { 21, 29, 23, 1, 28, 153, 4056 }, // Ó
-    { 21, 29, 23, 1, 28, 153, 4209 }, // Ô
-    { 21, 29, 23, 1, 28, 153, 4362 }, // Õ
-    { 21, 28, 23, 1, 27, 147, 4515 }, // Ö
-    { 14, 14, 17, 1, 17, 49, 4662 }, // ×
-    { 21, 24, 23, 1, 22, 126, 4711 }, // Ø
-    { 18, 29, 22, 2, 28, 131, 4837 }, // Ù
-    { 18, 29, 22, 2, 28, 131, 4968 }, // Ú
-    { 18, 29, 22, 2, 28, 131, 5099 }, // Û
-    { 18, 28, 22, 2, 27, 126, 5230 }, // Ü
-    { 19, 28, 18, 0, 28, 133, 5356 }, // Ý
-    { 15, 21, 18, 2, 21, 79, 5489 }, // Þ
-    { 18, 24, 21, 2, 23, 108, 5568 }, // ß
-    { 15, 24, 17, 1, 23, 90, 5676 }, // à
-    { 15, 24, 17, 1, 23, 90, 5766 }, // á
-    { 15, 24, 17, 1, 23, 90, 5856 }, // â
-    { 15, 24, 17, 1, 23, 90, 5946 }, // ã
-    { 15, 23, 17, 1, 22, 87, 6036 }, // ä
-    { 15, 26, 17, 1, 25, 98, 6123 }, // å
-    { 25, 18, 27, 1, 17, 113, 6221 }, // æ
-    { 14, 24, 15, 1, 17, 84, 6334 }, // ç
-    { 16, 24, 17, 1, 23, 96, 6418 }, // è
-    { 16, 24, 17, 1, 23, 96, 6514 }, // é
-    { 16, 24, 17, 1, 23, 96, 6610 }, // ê
-    { 16, 23, 17, 1, 22, 92, 6706 }, // ë
-    { 10, 23, 9, -1, 23, 58, 6798 }, // ì
-    { 9, 23, 9, 2, 23, 52, 6856 }, // í
-    { 13, 23, 9, -2, 23, 75, 6908 }, // î
-    { 11, 22, 9, -1, 22, 61, 6983 }, // ï
-    { 16, 24, 18, 1, 23, 96, 7044 }, // ð
-    { 15, 23, 19, 2, 23, 87, 7140 }, // ñ
-    { 16, 24, 18, 1, 23, 96, 7227 }, // ò
-    { 16, 24, 18, 1, 23, 96, 7323 }, // ó
-    { 16, 24, 18, 1, 23, 96, 7419 }, // ô
-    { 16, 24, 18, 1, 23, 96, 7515 }, // õ
-    { 16, 23, 18, 1, 22, 92, 7611 }, // ö
-    { 15, 15, 17, 1, 18, 57, 7703 }, // ÷
-    { 16, 19, 18, 1, 17, 76, 7760 }, // ø
-    { 15, 24, 19, 2, 23, 90, 7836 }, // ù
-    { 15, 24, 19, 2, 23, 90, 7926 }, // ú
-    { 15, 24, 19, 2, 23, 90, 8016 }, // û
-    { 15, 23, 19, 2, 22, 87, 8106 }, // ü
-    { 17, 30, 17, 0, 23, 128, 8193 }, // ý
-    { 16, 30, 18, 2, 23, 120, 8321 }, // þ
-    { 17, 29, 17, 0, 22, 124, 8441 }, // ÿ
-    { 21, 26, 20, 0, 26, 137, 0 }, // Ā
-    { 15, 22, 17, 1, 21, 83, 137 }, // ā
-    { 21, 28, 20, 0, 28, 147, 220 }, // Ă
-    { 15, 24, 17, 1, 23, 90, 367 }, // ă
-    { 21, 28, 20, 0, 21, 147, 457 }, // Ą
-    { 15, 24, 17, 1, 17, 90, 604 }, // ą
-    { 17, 29, 19, 1, 28, 124, 694 }, // Ć
-    { 14, 24, 15, 1, 23, 84, 818 }, // ć
-    { 17, 29, 19, 1, 28, 124, 902 }, // Ĉ
-    { 14, 24, 15, 1, 23, 84, 1026 }, // ĉ
-    { 17, 29, 19, 1, 28, 124, 1110 }, // Ċ
-    { 14, 24, 15, 1, 23, 84, 1234 }, // ċ
-    { 17, 29, 19, 1, 28, 124, 1318 }, // Č
-    { 14, 24, 15, 1, 23, 84, 1442 }, // č
-    { 18, 28, 21, 2, 28, 126, 1526 }, // Ď
-    { 22, 24, 18, 1, 23, 132, 1652 }, // ď
-    { 20, 21, 21, 0, 21, 105, 1784 }, // Đ
-    { 18, 24, 19, 1, 23, 108, 1889 }, // đ
-    { 13, 26, 16, 2, 26, 85, 1997 }, // Ē
-    { 16, 22, 17, 1, 21, 88, 2082 }, // ē
-    { 13, 28, 16, 2, 28, 91, 2170 }, // Ĕ
-    { 16, 24, 17, 1, 23, 96, 2261 }, // ĕ
-    { 13, 28, 16, 2, 28, 91, 2357 }, // Ė
-    { 16, 24, 17, 1, 23, 96, 2448 }, // ė
-    { 13, 28, 16, 2, 21, 91, 2544 }, // Ę
-    { 16, 24, 17, 1, 17, 96, 2635 }, // ę
-    { 14, 28, 16, 2, 28, 98, 2731 }, // Ě
-    { 16, 24, 17, 1, 23, 96, 2829 }, // ě
-    { 18, 29, 21, 1, 28, 131, 2925 }, // Ĝ
-    { 16, 30, 18, 1, 23, 120, 3056 }, // ĝ
-    { 18, 29, 21, 1, 28, 131, 3176 }, // Ğ
-    { 16, 30, 18, 1, 23, 120, 3307 }, // ğ
-    { 18, 29, 21, 1, 28, 131, 3427 }, // Ġ
-    { 16, 30, 18, 1, 23, 120, 3558 }, // ġ
-    { 18, 29, 21, 1, 22, 131, 3678 }, // Ģ
-    { 16, 30, 18, 1, 23, 120, 3809 }, // ģ
-    { 18, 28, 22, 2, 28, 126, 3929 }, // Ĥ
-    { 19, 29, 19, -2, 29, 138, 4055 }, // ĥ
-    { 23, 21, 22, 0, 21, 121, 4193 }, // Ħ
-    { 17, 23, 19, 0, 23, 98, 4314 }, // ħ
-    { 12, 28, 11, -1, 28, 84, 4412 }, // Ĩ
-    { 13, 23, 9, -2, 23, 75, 4496 }, // ĩ
-    { 11, 26, 11, 0, 26, 72, 4571 }, // Ī
-    { 11, 21, 9, -1, 21, 58, 4643 }, // ī
-    { 12, 28, 11, 0, 28, 84, 4701 }, // Ĭ
-    { 12, 23, 9, -1, 23, 69, 4785 }, // ĭ
-    { 11, 28, 11, 0, 21, 77, 4854 }, // Į
-    { 6, 30, 9, 1, 23, 45, 4931 }, // į
-    { 11, 28, 11, 0, 28, 77, 4976 }, // İ
-    { 5, 16, 9, 2, 16, 20, 5053 }, // ı
-    { 19, 28, 21, 0, 21, 133, 5073 }, // Ĳ
-    { 15, 30, 18, 1, 23, 113, 5206 }, // ĳ
-    { 14, 35, 10, -3, 28, 123, 5319 }, // Ĵ
-    { 13, 30, 9, -2, 23, 98, 5442 }, // ĵ
-    { 18, 28, 19, 2, 21, 126, 5540 }, // Ķ
-    { 17, 30, 18, 2, 23, 128, 5666 }, // ķ
-    { 17, 16, 18, 2, 16, 68, 5794 }, // ĸ
-    { 14, 28, 16, 2, 28, 98, 5862 }, // Ĺ
-    { 10, 29, 9, 1, 29, 73, 5960 }, // ĺ
-    { 14, 28, 16, 2, 21, 98, 6033 }, // Ļ
-    { 6, 30, 9, 1, 23, 45, 6131 }, // ļ
-    { 15, 21, 16, 2, 21, 79, 6176 }, // Ľ
-    { 11, 23, 9, 2, 23, 64, 6255 }, // ľ
-    { 14, 21, 16, 2, 21, 74, 6319 }, // Ŀ
-    { 11, 23, 11, 2, 23, 64, 6393 }, // ŀ
-    { 16, 21, 16, 0, 21, 84, 6457 }, // Ł
-    { 11, 23, 9, -1, 23, 64, 6541 }, // ł
-    { 20, 28, 24, 2, 28, 140, 6605 }, // Ń
-    { 15, 23, 19, 2, 23, 87, 6745 }, // ń
-    { 20, 28, 24, 2, 21, 140, 6832 }, // Ņ
-    { 15, 24, 19, 2, 17, 90, 6972 }, // ņ
-    { 20, 28, 24, 2, 28, 140, 7062 }, // Ň
-    { 15, 23, 19, 2, 23, 87, 7202 }, // ň
-    { 22, 21, 23, -1, 21, 116, 7289 }, // ŉ
-    { 20, 28, 24, 2, 21, 140, 7405 }, // Ŋ
-    { 15, 24, 19, 2, 17, 90, 7545 }, // ŋ
-    { 21, 27, 23, 1, 26, 142, 7635 }, // Ō
-    { 16, 22, 18, 1, 21, 88, 7777 }, // ō
-    { 21, 29, 23, 1, 28, 153, 7865 }, // Ŏ
-    { 16, 24, 18, 1, 23, 96, 8018 }, // ŏ
-    { 21, 29, 23, 1, 28, 153, 8114 }, // Ő
-    { 16, 24, 18, 1, 23, 96, 8267 }, // ő
-    { 26, 23, 28, 1, 22, 150, 8363 }, // Œ
-    { 27, 18, 29, 1, 17, 122, 8513 }, // œ
-    { 18, 28, 19, 2, 28, 126, 8635 }, // Ŕ
-    { 12, 23, 13, 2, 23, 69, 8761 }, // ŕ
-    { 18, 28, 19, 2, 21, 126, 8830 }, // Ŗ
-    { 12, 24, 13, 1, 17, 72, 8956 }, // ŗ
-    { 18, 28, 19, 2, 28, 126, 9028 }, // Ř
-    { 13, 23, 13, 1, 23, 75, 9154 }, // ř
-    { 14, 29, 16, 1, 28, 102, 9229 }, // Ś
-    { 13, 24, 15, 1, 23, 78, 9331 }, // ś
-    { 14, 29, 16, 1, 28, 102, 9409 }, // Ŝ
-    { 13, 24, 15, 1, 23, 78, 9511 }, // ŝ
-    { 14, 29, 16, 1, 22, 102, 9589 }, // Ş
-    { 13, 24, 15, 1, 17, 78, 9691 }, // ş
-    { 14, 29, 16, 1, 28, 102, 9769 }, // Š
-    { 13, 24, 15, 1, 23, 78, 9871 }, // š
-    { 17, 28, 17, 0, 21, 119, 9949 }, // Ţ
-    { 12, 27, 13, 0, 20, 81, 10068 }, // ţ
-    { 17, 28, 17, 0, 28, 119, 10149 }, // Ť
-    { 17, 24, 13, 0, 23, 102, 10268 }, // ť
-    { 17, 21, 17, 0, 21, 90, 10370 }, // Ŧ
-    { 12, 21, 13, 0, 20, 63, 10460 }, // ŧ
-    { 18, 29, 22, 2, 28, 131, 10523 }, // Ũ
-    { 15, 24, 19, 2, 23, 90, 10654 }, // ũ
-    { 18, 27, 22, 2, 26, 122, 10744 }, // Ū
-    { 15, 22, 19, 2, 21, 83, 10866 }, // ū
-    { 18, 29, 22, 2, 28, 131, 10949 }, // Ŭ
-    { 15, 24, 19, 2, 23, 90, 11080 }, // ŭ
-    { 18, 31, 22, 2, 30, 140, 11170 }, // Ů
-    { 15, 26, 19, 2, 25, 98, 11310 }, // ů
-    { 18, 29, 22, 2, 28, 131, 11408 }, // Ű
-    { 15, 24, 19, 2, 23, 90, 11539 }, // ű
-    { 18, 28, 22, 2, 21, 126, 11629 }, // Ų
-    { 15, 23, 19, 2, 16, 87, 11755 }, // ų
-    { 29, 28, 28, 0, 28, 203, 11842 }, // Ŵ
-    { 25, 23, 25, 0, 23, 144, 12045 }, // ŵ
-    { 19, 28, 18, 0, 28, 133, 12189 }, // Ŷ
-    { 17, 30, 17, 0, 23, 128, 12322 }, // ŷ
-    { 19, 27, 18, 0, 27, 129, 12450 }, // Ÿ
-    { 17, 28, 17, 0, 28, 119, 12579 }, // Ź
-    { 14, 23, 14, 0, 23, 81, 12698 }, // ź
-    { 17, 28, 17, 0, 28, 119, 12779 }, // Ż
-    { 14, 23, 14, 0, 23, 81, 12898 }, // ż
-    { 17, 28, 17, 0, 28, 119, 12979 }, // Ž
-    { 14, 23, 14, 0, 23, 81, 13098 }, // ž
-    { 10, 23, 11, 2, 23, 58, 13179 }, // ſ
-    { 9, 6, 0, -16, 23, 14, 0 }, // ̀
-    { 9, 6, 0, -11, 23, 14, 14 }, // ́
-    { 12, 6, 0, -6, 23, 18, 28 }, // ̂
-    { 12, 6, 0, -16, 23, 18, 46 }, // ̃
-    { 10, 4, 0, -5, 21, 10, 64 }, // ̄
-    { 14, 4, 0, -7, 25, 14, 74 }, // ̅
-    { 12, 6, 0, -6, 23, 18, 88 }, // ̆
-    { 6, 6, 0, -3, 23, 9, 106 }, // ̇
-    { 12, 4, 0, -6, 22, 12, 115 }, // ̈
-    { 8, 8, 0, -13, 25, 16, 127 }, // ̉
-    { 8, 8, 0, -4, 25, 16, 143 }, // ̊
-    { 14, 6, 0, -5, 23, 21, 159 }, // ̋
-    { 13, 6, 0, -6, 23, 20, 180 }, // ̌
-    { 4, 6, 0, -2, 23, 6, 200 }, // ̍
-    { 8, 6, 0, -4, 23, 12, 206 }, // ̎
-    { 13, 6, 0, -17, 23, 20, 218 }, // ̏
-    { 12, 8, 0, -6, 25, 24, 238 }, // ̐
-    { 12, 6, 0, -6, 23, 18, 262 }, // ̑
-    { 6, 8, 0, -3, 21, 12, 280 }, // ̒
-    { 6, 8, 0, -3, 21, 12, 292 }, // ̓
-    { 6, 8, 0, -3, 21, 12, 304 }, // ̔
-    { 6, 8, 0, -3, 21, 12, 316 }, // ̕
-    { 9, 6, 0, -5, -1, 14, 328 }, // ̖
-    { 10, 6, 0, -5, -1, 15, 342 }, // ̗
-    { 6, 7, 0, -3, 0, 11, 357 }, // ̘
-    { 6, 7, 0, -3, 0, 11, 368 }, // ̙
-    { 8, 8, 9, 0, 23, 16, 379 }, // ̚
-    { 8, 8, 0, -3, 23, 16, 395 }, // ̛
-    { 4, 7, 0, -2, 0, 7, 411 }, // ̜
-    { 8, 6, 0, -4, -1, 12, 418 }, // ̝
-    { 8, 6, 0, -4, -1, 12, 430 }, // ̞
-    { 8, 7, 0, -4, 0, 14, 442 }, // ̟
-    { 7, 3, 0, -4, -3, 6, 456 }, // ̠
-    { 7, 9, 0, -7, 2, 16, 462 }, // ̡
-    { 7, 9, 0, 0, 2, 16, 478 }, // ̢
-    { 6, 6, 0, -13, -1, 9, 494 }, // ̣
-    { 12, 4, 0, -6, -2, 12, 503 }, // ̤
-    { 8, 8, 0, -4, 1, 16, 515 }, // ̥
-    { 6, 6, 0, -3, -1, 9, 531 }, // ̦
-    { 8, 7, 0, -4, 0, 14, 540 }, // ̧
-    { 6, 8, 0, -3, 1, 12, 554 }, // ̨
-    { 4, 6, 0, -2, -1, 6, 566 }, // ̩
-    { 12, 6, 0, -6, -1, 18, 572 }, // ̪
-    { 12, 5, 0, -6, -1, 15, 590 }, // ̫
-    { 13, 6, 0, -6, 0, 20, 605 }, // ̬
-    { 12, 6, 0, -6, -1, 18, 625 }, // ̭
-    { 12, 6, 0, -6, -1, 18, 643 }, // ̮
-    { 12, 6, 0, -6, -1, 18, 661 }, // ̯
-    { 12, 6, 0, -6, -1, 18, 679 }, // ̰
-    { 10, 4, 0, -5, -2, 10, 697 }, // ̱
-    { 14, 3, 0, -7, -2, 11, 707 }, // ̲
-    { 13, 7, 0, -7, 0, 23, 718 }, // ̳
-    { 13, 6, 0, -6, 11, 20, 741 }, // ̴
-    { 14, 4, 0, -7, 10, 14, 761 }, // ̵
-    { 22, 4, 0, -11, 10, 22, 775 }, // ̶
-    { 12, 9, 0, -6, 13, 27, 797 }, // ̷
-    { 14, 25, 0, -7, 23, 88, 824 }, // ̸
-    { 4, 7, 0, -2, 0, 7, 912 }, // ̹
-    { 12, 6, 0, -6, -1, 18, 919 }, // ̺
-    { 12, 7, 0, -6, 0, 21, 937 }, // ̻
-    { 12, 5, 0, -6, -1, 15, 958 }, // ̼
-    { 6, 7, 0, -3, 23, 11, 973 }, // ̽
-    { 4, 10, 0, -2, 26, 10, 984 }, // ̾
-    { 13, 7, 0, -7, 29, 23, 994 }, // ̿
-    { 9, 6, 0, -7, 23, 14, 1017 }, // ̀
-    { 9, 6, 0, -2, 23, 14, 1031 }, // ́
-    { 13, 6, 0, -6, 23, 20, 1045 }, // ͂
-    { 6, 6, 0, -3, 23, 9, 1065 }, // ̓
-    { 17, 6, 0, -7, 23, 26, 1074 }, // ̈́
-    { 7, 6, 0, -2, -1, 11, 1100 }, // ͅ
-    { 14, 6, 0, -7, 23, 21, 1111 }, // ͆
-    { 13, 7, 0, -7, 0, 23, 1132 }, // ͇
-    { 8, 6, 0, -4, -1, 12, 1155 }, // ͈
-    { 6, 6, 0, -3, -1, 9, 1167 }, // ͉
-    { 12, 7, 0, -6, 23, 21, 1176 }, // ͊
-    { 12, 12, 0, -6, 28, 36, 1197 }, // ͋
-    { 12, 9, 0, -6, 26, 27, 1233 }, // ͌
-    { 12, 6, 0, -6, -1, 18, 1260 }, // ͍
-    { 6, 7, 0, -3, 0, 11, 1278 }, // ͎
-    { 22, 21, 0, -11, 21, 116, 1289 }, // ͏
-    { 6, 7, 0, -3, 24, 11, 1405 }, // ͐
-    { 5, 8, 0, -2, 24, 10, 1416 }, // ͑
-    { 12, 8, 0, -6, 25, 24, 1426 }, // ͒
-    { 6, 7, 0, -3, 0, 11, 1450 }, // ͓
-    { 6, 6, 0, -3, -1, 9, 1461 }, // ͔
-    { 6, 6, 0, -3, -1, 9, 1470 }, // ͕
-    { 12, 6, 0, -6, -1, 18, 1479 }, // ͖
-    { 5, 8, 0, -2, 24, 10, 1497 }, // ͗
-    { 6, 6, 0, 2, 23, 9, 1507 }, // ͘
-    { 8, 6, 0, -4, -1, 12, 1516 }, // ͙
-    { 12, 7, 0, -6, 0, 21, 1528 }, // ͚
-    { 6, 6, 0, -3, 23, 9, 1549 }, // ͛
-    { 24, 6, 0, -12, -1, 36, 1558 }, // ͜
-    { 24, 6, 0, -12, 23, 36, 1594 }, // ͝
-    { 18, 3, 0, -9, 20, 14, 1630 }, // ͞
-    { 18, 3, 0, -9, -2, 14, 1644 }, // ͟
-    { 24, 6, 0, -12, 23, 36, 1658 }, // ͠
-    { 24, 7, 0, -12, 26, 42, 1694 }, // ͡
-    { 24, 7, 0, -11, 0, 42, 1736 }, // ͢
-    { 8, 8, 0, -4, 25, 16, 1778 }, // ͣ
-    { 7, 8, 0, -3, 25, 14, 1794 }, // ͤ
-    { 3, 9, 0, -1, 27, 7, 1808 }, // ͥ
-    { 8, 8, 0, -4, 25, 16, 1815 }, // ͦ
-    { 8, 8, 0, -4, 25, 16, 1831 }, // ͧ
-    { 7, 8, 0, -3, 25, 14, 1847 }, // ͨ
-    { 8, 10, 0, -4, 27, 20, 1861 }, // ͩ
-    { 7, 9, 0, -3, 27, 16, 1881 }, // ͪ
-    { 12, 7, 0, -6, 25, 21, 1897 }, // ͫ
-    { 6, 7, 0, -2, 25, 11, 1918 }, // ͬ
-    { 6, 9, 0, -3, 26, 14, 1929 }, // ͭ
-    { 9, 7, 0, -4, 25, 16, 1943 }, // ͮ
-    { 8, 7, 0, -4, 25, 14, 1959 }, // ͯ
-    { 13, 28, 16, 2, 28, 91, 0 }, // Ѐ
-    { 13, 27, 16, 2, 27, 88, 91 }, // Ё
-    { 22, 22, 22, 0, 21, 121, 179 }, // Ђ
-    { 14, 28, 16, 2, 28, 98, 300 }, // Ѓ
-    { 17, 23, 19, 1, 22, 98, 398 }, // Є
-    { 14, 23, 16, 1, 22, 81, 496 }, // Ѕ
-    { 5, 21, 9, 2, 21, 27, 577 }, // І
-    { 10, 28, 10, 0, 28, 70, 604 }, // Ї
-    { 11, 28, 10, -3, 21, 77, 674 }, // Ј
-    { 29, 22, 30, 0, 21, 160, 751 }, // Љ
-    { 28, 21, 31, 2, 21, 147, 911 }, // Њ
-    { 21, 21, 23, 0, 21, 111, 1058 }, // Ћ
-    { 19, 28, 20, 2, 28, 133, 1169 }, // Ќ
-    { 19, 28, 23, 2, 28, 133, 1302 }, // Ѝ
-    { 19, 29, 19, 0, 28, 138, 1435 }, // Ў
-    { 18, 26, 22, 2, 21, 117, 1573 }, // Џ
-    { 21, 21, 20, 0, 21, 111, 1690 }, // А
-    { 16, 21, 19, 2, 21, 84, 1801 }, // Б
-    { 16, 21, 19, 2, 21, 84, 1885 }, // В
-    { 14, 21, 16, 2, 21, 74, 1969 }, // Г
-    { 23, 26, 23, 0, 21, 150, 2043 }, // Д
-    { 13, 21, 16, 2, 21, 69, 2193 }, // Е
-    { 29, 21, 29, 0, 21, 153, 2262 }, // Ж
-    { 15, 23, 17, 1, 22, 87, 2415 }, // З
-    { 19, 21, 23, 2, 21, 100, 2502 }, // И
-    { 19, 28, 23, 2, 28, 133, 2602 }, // Й
-    { 19, 21, 20, 2, 21, 100, 2735 }, // К
-    { 19, 22, 21, 0, 21, 105, 2835 }, // Л
-    { 23, 21, 28, 2, 21, 121, 2940 }, // М
-    { 18, 21, 22, 2, 21, 95, 3061 }, // Н
-    { 21, 23, 23, 1, 22, 121, 3156 }, // О
-    { 18, 21, 22, 2, 21, 95, 3277 }, // П
-    { 15, 21, 18, 2, 21, 79, 3372 }, // Р
-    { 17, 23, 19, 1, 22, 98, 3451 }, // С
-    { 17, 21, 17, 0, 21, 90, 3549 }, // Т
-    { 19, 22, 19, 0, 21, 105, 3639 }, // У
-    { 24, 23, 26, 1, 22, 138, 3744 }, // Ф
-    { 20, 21, 19, 0, 21, 105, 3882 }, // Х
-    { 21, 26, 23, 2, 21, 137, 3987 }, // Ц
-    { 17, 21, 21, 2, 21, 90, 4124 }, // Ч
-    { 27, 21, 31, 2, 21, 142, 4214 }, // Ш
-    { 30, 26, 31, 2, 21, 195, 4356 }, // Щ
-    { 21, 21, 22, 0, 21, 111, 4551 }, // Ъ
-    { 23, 21, 27, 2, 21, 121, 4662 }, // Ы
-    { 16, 21, 19, 2, 21, 84, 4783 }, // Ь
-    { 17, 23, 19, 1, 22, 98, 4867 }, // Э
-    { 27, 23, 30, 2, 22, 156, 4965 }, // Ю
-    { 18, 21, 20, 0, 21, 95, 5121 }, // Я
-    { 15, 18, 17, 1, 17, 68, 5216 }, // а
-    { 16, 24, 18, 1, 23, 96, 5284 }, // б
-    { 15, 16, 17, 2, 16, 60, 5380 }, // в
-    { 12, 16, 14, 2, 16, 48, 5440 }, // г
-    { 19, 21, 19, 0, 16, 100, 5488 }, // д
-    { 15, 18, 17, 1, 17, 68, 5588 }, // е
-    { 26, 16, 25, 0, 16, 104, 5656 }, // ж
-    { 14, 18, 15, 0, 17, 63, 5760 }, // з
-    { 16, 16, 20, 2, 16, 64, 5823 }, // и
-    { 16, 23, 20, 2, 23, 92, 5887 }, // й
-    { 16, 16, 18, 2, 16, 64, 5979 }, // к
-    { 17, 17, 18, 0, 16, 73, 6043 }, // л
-    { 21, 16, 24, 2, 16, 84, 6116 }, // м
-    { 15, 16, 19, 2, 16, 60, 6200 }, // н
-    { 16, 18, 18, 1, 17, 72, 6260 }, // о
-    { 15, 16, 19, 2, 16, 60, 6332 }, // п
-    { 16, 24, 19, 2, 17, 96, 6392 }, // р
-    { 14, 18, 15, 1, 17, 63, 6488 }, // с
-    { 15, 16, 15, 0, 16, 60, 6551 }, // т
-    { 18, 23, 17, -1, 16, 104, 6611 }, // у
-    { 22, 30, 24, 1, 23, 165, 6715 }, // ф
-    { 17, 16, 17, 0, 16, 68, 6880 }, // х
-    { 17, 21, 19, 2, 16, 90, 6948 }, // ц
-    { 16, 16, 19, 1, 16, 64, 7038 }, // ч
-    { 24, 16, 28, 2, 16, 96, 7102 }, // ш
-    { 26, 21, 28, 2, 16, 137, 7198 }, // щ
-    { 19, 16, 20, 0, 16, 76, 7335 }, // ъ
-    { 21, 16, 25, 2, 16, 84, 7411 }, // ы
-    { 15, 16, 17, 2, 16, 60, 7495 }, // ь
-    { 14, 18, 15, 1, 17, 63, 7555 }, // э
-    { 22, 18, 25, 2, 17, 99, 7618 }, // ю
-    { 16, 16, 18, 0, 16, 64, 7717 }, // я
-    { 15, 24, 17, 1, 23, 90, 7781 }, // ѐ
-    { 15, 23, 17, 1, 22, 87, 7871 }, // ё
-    { 17, 30, 19, 0, 23, 128, 7958 }, // ђ
-    { 12, 23, 14, 2, 23, 69, 8086 }, // ѓ
-    { 14, 18, 15, 1, 17, 63, 8155 }, // є
-    { 13, 18, 15, 1, 17, 59, 8218 }, // ѕ
-    { 5, 23, 9, 2, 23, 29, 8277 }, // і
-    { 9, 23, 9, 0, 23, 52, 8306 }, // ї
-    { 9, 30, 9, -2, 23, 68, 8358 }, // ј
-    { 25, 17, 26, 0, 16, 107, 8426 }, // љ
-    { 24, 16, 27, 2, 16, 96, 8533 }, // њ
-    { 17, 23, 19, 0, 23, 98, 8629 }, // ћ
-    { 16, 23, 18, 2, 23, 92, 8727 }, // ќ
-    { 16, 23, 20, 2, 23, 92, 8819 }, // ѝ
-    { 18, 30, 17, -1, 23, 135, 8911 }, // ў
-    { 15, 21, 19, 2, 16, 79, 9046 }, // џ
-    { 28, 21, 28, 0, 21, 147, 9125 }, // Ѡ
-    { 25, 16, 26, 0, 16, 100, 9272 }, // ѡ
-    { 19, 21, 20, 0, 21, 100, 9372 }, // Ѣ
-    { 19, 20, 19, 0, 20, 95, 9472 }, // ѣ
-    { 25, 23, 28, 2, 22, 144, 9567 }, // Ѥ
-    { 21, 18, 23, 2, 17, 95, 9711 }, // ѥ
-    { 22, 21, 21, 0, 21, 116, 9806 }, // Ѧ
-    { 19, 16, 19, 0, 16, 76, 9922 }, // ѧ
-    { 28, 21, 29, 2, 21, 147, 9998 }, // Ѩ
-    { 25, 16, 26, 2, 16, 100, 10145 }, // ѩ
-    { 23, 21, 23, 0, 21, 121, 10245 }, // Ѫ
-    { 18, 16, 18, 0, 16, 72, 10366 }, // ѫ
-    { 29, 21, 31, 2, 21, 153, 10438 }, // Ѭ
-    { 24, 16, 26, 2, 16, 96, 10591 }, // ѭ
-    { 18, 33, 18, 0, 26, 149, 10687 }, // Ѯ
-    { 16, 27, 16, 0, 20, 108, 10836 }, // ѯ
-    { 22, 21, 26, 2, 21, 116, 10944 }, // Ѱ
-    { 21, 30, 25, 2, 23, 158, 11060 }, // ѱ
-    { 21, 23, 23, 1, 22, 121, 11218 }, // Ѳ
-    { 16, 18, 18, 1, 17, 72, 11339 }, // ѳ
-    { 21, 21, 21, 0, 21, 111, 11411 }, // Ѵ
-    { 18, 17, 18, 0, 17, 77, 11522 }, // ѵ
-    { 21, 28, 21, 0, 28, 147, 11599 }, // Ѷ
-    { 18, 23, 18, 0, 23, 104, 11746 }, // ѷ
-    { 38, 29, 38, 1, 22, 276, 11850 }, // Ѹ
-    { 34, 24, 34, 1, 17, 204, 12126 }, // ѹ
-    { 22, 25, 24, 1, 23, 138, 12330 }, // Ѻ
-    { 18, 20, 20, 1, 18, 90, 12468 }, // ѻ
-    { 30, 33, 32, 1, 32, 248, 12558 }, // Ѽ
-    { 26, 28, 28, 1, 27, 182, 12806 }, // ѽ
-    { 28, 27, 28, 0, 27, 189, 12988 }, // Ѿ
-    { 25, 22, 26, 0, 22, 138, 13177 }, // ѿ
-    { 18, 29, 20, 1, 22, 131, 13315 }, // Ҁ
-    { 14, 24, 15, 1, 17, 84, 13446 }, // ҁ
-    { 16, 20, 18, 1, 19, 80, 13530 }, // ҂
-    { 12, 6, 0, -14, 22, 18, 13610 }, // ҃
-    { 12, 6, 0, -14, 23, 18, 13628 }, // ҄
-    { 5, 7, 0, -10, 24, 9, 13646 }, // ҅
-    { 5, 7, 0, -10, 24, 9, 13655 }, // ҆
-    { 12, 5, 0, -6, 27, 15, 13664 }, // ҇
-    { 34, 31, 0, -17, 23, 264, 13679 }, // ҈
-    { 34, 33, 0, -17, 24, 281, 13943 }, // ҉
-    { 25, 35, 27, 2, 28, 219, 14224 }, // Ҋ
-    { 21, 29, 23, 2, 23, 153, 14443 }, // ҋ
-    { 18, 21, 19, 0, 21, 95, 14596 }, // Ҍ
-    { 17, 23, 18, 0, 23, 98, 14691 }, // ҍ
-    { 15, 21, 18, 2, 21, 79, 14789 }, // Ҏ
-    { 16, 24, 18, 2, 17, 96, 14868 }, // ҏ
-    { 15, 26, 17, 2, 26, 98, 14964 }, // Ґ
-    { 12, 21, 15, 2, 21, 63, 15062 }, // ґ
-    { 16, 21, 16, 0, 21, 84, 15125 }, // Ғ
-    { 14, 16, 14, 0, 16, 56, 15209 }, // ғ
-    { 18, 29, 21, 2, 21, 131, 15265 }, // Ҕ
-    { 15, 24, 18, 2, 16, 90, 15396 }, // ҕ
-    { 30, 28, 30, 0, 21, 210, 15486 }, // Җ
-    { 28, 22, 27, -1, 16, 154, 15696 }, // җ
-    { 15, 29, 17, 1, 22, 109, 15850 }, // Ҙ
-    { 14, 24, 15, 0, 17, 84, 15959 }, // ҙ
-    { 20, 28, 22, 2, 21, 140, 16043 }, // Қ
-    { 17, 22, 19, 2, 16, 94, 16183 }, // қ
-    { 18, 21, 20, 2, 21, 95, 16277 }, // Ҝ
-    { 16, 16, 18, 2, 16, 64, 16372 }, // ҝ
-    { 20, 21, 20, 1, 21, 105, 16436 }, // Ҟ
-    { 19, 23, 18, 0, 23, 110, 16541 }, // ҟ
-    { 22, 21, 21, 0, 21, 116, 16651 }, // Ҡ
-    { 21, 16, 20, 0, 16, 84, 16767 }, // ҡ
-    { 22, 28, 25, 2, 21, 154, 16851 }, // Ң
-    { 19, 22, 22, 2, 16, 105, 17005 }, // ң
-    { 23, 21, 24, 2, 21, 121, 17110 }, // Ҥ
-    { 21, 16, 22, 2, 16, 84, 17231 }, // ҥ
-    { 30, 29, 33, 2, 21, 218, 17315 }, // Ҧ
-    { 23, 24, 26, 2, 16, 138, 17533 }, // ҧ
-    { 21, 24, 23, 1, 22, 126, 17671 }, // Ҩ
-    { 18, 19, 19, 1, 17, 86, 17797 }, // ҩ
-    { 17, 29, 19, 1, 22, 124, 17883 }, // Ҫ
-    { 14, 24, 15, 1, 17, 84, 18007 }, // ҫ
-    { 17, 28, 17, 0, 21, 119, 18091 }, // Ҭ
-    { 16, 22, 16, 0, 16, 88, 18210 }, // ҭ
-    { 19, 21, 18, 0, 21, 100, 18298 }, // Ү
-    { 17, 23, 17, 0, 16, 98, 18398 }, // ү
-    { 19, 21, 18, 0, 21, 100, 18496 }, // Ұ
-    { 17, 23, 17, 0, 16, 98, 18596 }, // ұ
-    { 22, 28, 22, 0, 21, 154, 18694 }, // Ҳ
-    { 19, 22, 19, 0, 16, 105, 18848 }, // ҳ
-    { 27, 28, 27, 0, 21, 189, 18953 }, // Ҵ
-    { 23, 22, 23, 0, 16, 127, 19142 }, // ҵ
-    { 22, 28, 23, 1, 21, 154, 19269 }, // Ҷ
-    { 20, 22, 21, 1, 16, 110, 19423 }, // ҷ
-    { 18, 21, 21, 1, 21, 95, 19533 }, // Ҹ
-    { 17, 16, 19, 1, 16, 68, 19628 }, // ҹ
-    { 18, 21, 21, 2, 21, 95, 19696 }, // Һ
-    { 15, 23, 19, 2, 23, 87, 19791 }, // һ
-    { 26, 23, 28, 0, 22, 150, 19878 }, // Ҽ
-    { 21, 18, 21, -1, 17, 95, 20028 }, // ҽ
-    { 26, 29, 28, 0, 22, 189, 20123 }, // Ҿ
-    { 21, 23, 21, -1, 17, 121, 20312 }, // ҿ
-    { 11, 21, 11, 0, 21, 58, 20433 }, // Ӏ
-    { 29, 28, 29, 0, 28, 203, 20491 }, // Ӂ
-    { 26, 23, 25, 0, 23, 150, 20694 }, // ӂ
-    { 19, 29, 22, 2, 21, 138, 20844 }, // Ӄ
-    { 16, 24, 19, 2, 16, 96, 20982 }, // ӄ
-    { 24, 28, 24, 0, 21, 168, 21078 }, // Ӆ
-    { 21, 22, 21, 0, 16, 116, 21246 }, // ӆ
-    { 18, 29, 22, 2, 21, 131, 21362 }, // Ӈ
-    { 16, 24, 19, 2, 16, 96, 21493 }, // ӈ
-    { 23, 28, 25, 2, 21, 161, 21589 }, // Ӊ
-    { 20, 22, 22, 2, 16, 110, 21750 }, // ӊ
-    { 18, 28, 21, 1, 21, 126, 21860 }, // Ӌ
-    { 16, 22, 19, 1, 16, 88, 21986 }, // ӌ
-    { 28, 28, 30, 2, 21, 196, 22074 }, // Ӎ
-    { 25, 22, 27, 2, 16, 138, 22270 }, // ӎ
-    { 11, 21, 11, 0, 21, 58, 22408 }, // ӏ
-    { 21, 28, 20, 0, 28, 147, 22466 }, // Ӑ
-    { 15, 24, 17, 1, 23, 90, 22613 }, // ӑ
-    { 21, 27, 20, 0, 27, 142, 22703 }, // Ӓ
-    { 15, 23, 17, 1, 22, 87, 22845 }, // ӓ
-    { 27, 21, 28, 0, 21, 142, 22932 }, // Ӕ
-    { 25, 18, 27, 1, 17, 113, 23074 }, // ӕ
-    { 13, 28, 16, 2, 28, 91, 23187 }, // Ӗ
-    { 16, 24, 17, 1, 23, 96, 23278 }, // ӗ
-    { 21, 23, 24, 2, 22, 121, 23374 }, // Ә
-    { 16, 18, 17, 1, 17, 72, 23495 }, // ә
-    { 21, 28, 24, 2, 27, 147, 23567 }, // Ӛ
-    { 16, 23, 17, 1, 22, 92, 23714 }, // ӛ
-    { 29, 27, 29, 0, 27, 196, 23806 }, // Ӝ
-    { 26, 22, 25, 0, 22, 143, 24002 }, // ӝ
-    { 15, 28, 17, 1, 27, 105, 24145 }, // Ӟ
-    { 14, 23, 15, 0, 22, 81, 24250 }, // ӟ
-    { 17, 22, 17, 0, 21, 94, 24331 }, // Ӡ
-    { 16, 23, 17, 0, 16, 92, 24425 }, // ӡ
-    { 19, 26, 23, 2, 26, 124, 24517 }, // Ӣ
-    { 16, 21, 20, 2, 21, 84, 24641 }, // ӣ
-    { 19, 27, 23, 2, 27, 129, 24725 }, // Ӥ
-    { 16, 22, 20, 2, 22, 88, 24854 }, // ӥ
-    { 21, 28, 23, 1, 27, 147, 24942 }, // Ӧ
-    { 16, 23, 18, 1, 22, 92, 25089 }, // ӧ
-    { 21, 23, 23, 1, 22, 121, 25181 }, // Ө
-    { 16, 18, 18, 1, 17, 72, 25302 }, // ө
-    { 21, 28, 23, 1, 27, 147, 25374 }, // Ӫ
-    { 16, 23, 18, 1, 22, 92, 25521 }, // ӫ
-    { 17, 28, 19, 1, 27, 119, 25613 }, // Ӭ
-    { 14, 23, 15, 1, 22, 81, 25732 }, // ӭ
-    { 19, 27, 19, 0, 26, 129, 25813 }, // Ӯ
-    { 18, 28, 17, -1, 21, 126, 25942 }, // ӯ
-    { 19, 28, 19, 0, 27, 133, 26068 }, // Ӱ
-    { 18, 29, 17, -1, 22, 131, 26201 }, // ӱ
-    { 19, 29, 19, 0, 28, 138, 26332 }, // Ӳ
-    { 17, 30, 17, 0, 23, 128, 26470 }, // ӳ
-    { 17, 27, 21, 2, 27, 115, 26598 }, // Ӵ
-    { 16, 22, 19, 1, 22, 88, 26713 }, // ӵ
-    { 14, 28, 16, 2, 21, 98, 26801 }, // Ӷ
-    { 12, 22, 14, 2, 16, 66, 26899 }, // ӷ
-    { 23, 27, 27, 2, 27, 156, 26965 }, // Ӹ
-    { 21, 22, 25, 2, 22, 116, 27121 }, // ӹ
-    { 16, 29, 16, 0, 21, 116, 27237 }, // Ӻ
-    { 14, 23, 14, 0, 16, 81, 27353 }, // ӻ
-    { 21, 29, 21, 0, 21, 153, 27434 }, // Ӽ
-    { 18, 23, 19, 0, 16, 104, 27587 }, // ӽ
-    { 20, 21, 20, 0, 21, 105, 27691 }, // Ӿ
-    { 17, 16, 17, 0, 16, 68, 27796 }, // ӿ
-    { 0, 0, 15, 0, 0, 0, 0 }, //  
-    { 0, 0, 29, 0, 0, 0, 0 }, //  
-    { 0, 0, 15, 0, 0, 0, 0 }, //  
-    { 0, 0, 29, 0, 0, 0, 0 }, //  
-    { 0, 0, 10, 0, 0, 0, 0 }, //  
-    { 0, 0, 7, 0, 0, 0, 0 }, //  
-    { 0, 0, 5, 0, 0, 0, 0 }, //  
-    { 0, 0, 17, 0, 0, 0, 0 }, //  
-    { 0, 0, 8, 0, 0, 0, 0 }, //  
-    { 0, 0, 5, 0, 0, 0, 0 }, //  
-    { 0, 0, 3, 0, 0, 0, 0 }, //  
-    { 0, 0, 0, 0, 0, 0, 0 }, // ​
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‍
-    { 8, 25, 0, -1, 21, 50, 0 }, // ‎
-    { 8, 25, 0, -7, 21, 50, 50 }, // ‏
-    { 9, 4, 9, 0, 10, 9, 100 }, // ‐
-    { 9, 4, 9, 0, 10, 9, 109 }, // ‑
-    { 15, 4, 17, 1, 12, 15, 118 }, // ‒
-    { 13, 4, 15, 1, 10, 13, 133 }, // –
-    { 28, 4, 29, 1, 10, 28, 146 }, // —
-    { 28, 4, 29, 1, 10, 28, 174 }, // ―
-    { 12, 30, 16, 2, 23, 90, 202 }, // ‖
-    { 14, 7, 12, -1, 0, 25, 292 }, // ‗
-    { 6, 8, 6, 0, 21, 12, 317 }, // ‘
-    { 6, 8, 6, 0, 21, 12, 329 }, // ’
-    { 7, 8, 8, 0, 4, 14, 341 }, // ‚
-    { 6, 8, 6, 0, 21, 12, 355 }, // ‛
-    { 13, 8, 13, 0, 21, 26, 367 }, // “
-    { 13, 8, 13, 0, 21, 26, 393 }, // ”
-    { 14, 8, 15, 0, 4, 28, 419 }, // „
-    { 13, 8, 13, 0, 21, 26, 447 }, // ‟
-    { 13, 23, 15, 1, 23, 75, 473 }, // †
-    { 13, 23, 15, 1, 23, 75, 548 }, // ‡
-    { 9, 10, 11, 1, 16, 23, 623 }, // •
-    { 10, 12, 11, 1, 17, 30, 646 }, // ‣
-    { 6, 6, 15, 4, 5, 9, 676 }, // ․
-    { 15, 6, 17, 1, 5, 23, 685 }, // ‥
-    { 23, 6, 25, 1, 5, 35, 708 }, // …
-    { 6, 6, 8, 1, 11, 9, 743 }, // ‧
-    { 0, 0, 18, 0, 0, 0, 752 }, //  
-    { 0, 0, 18, 0, 0, 0, 752 }, //  
-    { 8, 22, 0, -1, 18, 44, 752 }, // ‪
-    { 8, 22, 0, -7, 18, 44, 796 }, // ‫
-    { 8, 25, 0, -4, 21, 50, 840 }, // ‬
-    { 8, 25, 0, -4, 21, 50, 890 }, // ‭
-    { 8, 25, 0, -4, 21, 50, 940 }, // ‮
-    { 0, 0, 5, 0, 0, 0, 990 }, //  
-    { 37, 23, 37, 0, 22, 213, 990 }, // ‰
-    { 48, 23, 49, 0, 22, 276, 1203 }, // ‱
-    { 9, 8, 9, 1, 21, 18, 1479 }, // ′
-    { 15, 8, 15, 1, 21, 30, 1497 }, // ″
-    { 21, 8, 22, 1, 21, 42, 1527 }, // ‴
-    { 9, 8, 12, 1, 21, 18, 1569 }, // ‵
-    { 15, 8, 19, 1, 21, 30, 1587 }, // ‶
-    { 22, 8, 25, 1, 21, 44, 1617 }, // ‷
-    { 12, 10, 12, 0, 3, 30, 1661 }, // ‸
-    { 9, 14, 11, 1, 15, 32, 1691 }, // ‹
-    { 9, 14, 11, 1, 15, 32, 1723 }, // ›
-    { 23, 23, 25, 1, 22, 133, 1755 }, // ※
-    { 14, 22, 17, 1, 21, 77, 1888 }, // ‼
-    { 14, 23, 14, 0, 22, 81, 1965 }, // ‽
-    { 16, 4, 15, -1, 26, 16, 2046 }, // ‾
-    { 18, 7, 18, 0, 0, 32, 2062 }, // ‿
-    { 18, 8, 18, 0, 24, 36, 2094 }, // ⁀
-    { 12, 19, 12, 0, 12, 57, 2130 }, // ⁁
-    { 33, 28, 33, 0, 23, 231, 2187 }, // ⁂
-    { 9, 4, 9, 1, 10, 9, 2418 }, // ⁃
-    { 16, 21, 4, -6, 21, 84, 2427 }, // ⁄
-    { 7, 26, 10, 2, 21, 46, 2511 }, // ⁅
-    { 8, 26, 10, 0, 21, 52, 2557 }, // ⁆
-    { 28, 23, 28, 0, 22, 161, 2609 }, // ⁇
-    { 21, 23, 22, 0, 22, 121, 2770 }, // ⁈
-    { 21, 23, 22, 1, 22, 121, 2891 }, // ⁉
-    { 15, 16, 17, 1, 16, 60, 3012 }, // ⁊
-    { 16, 27, 19, 2, 23, 108, 3072 }, // ⁋
-    { 16, 15, 19, 1, 16, 60, 3180 }, // ⁌
-    { 16, 15, 19, 2, 16, 60, 3240 }, // ⁍
-    { 15, 15, 16, 0, 8, 57, 3300 }, // ⁎
-    { 7, 21, 8, 1, 17, 37, 3357 }, // ⁏
-    { 18, 31, 18, 0, 24, 140, 3394 }, // ⁐
-    { 15, 30, 16, 0, 23, 113, 3534 }, // ⁑
-    { 13, 23, 12, 0, 22, 75, 3647 }, // ⁒
-    { 28, 6, 29, 1, 11, 42, 3722 }, // ⁓
-    { 18, 7, 18, 0, 0, 32, 3764 }, // ⁔
-    { 16, 15, 16, 0, 15, 60, 3796 }, // ⁕
-    { 15, 23, 17, 1, 22, 87, 3856 }, // ⁖
-    { 27, 8, 27, 1, 21, 54, 3943 }, // ⁗
-    { 23, 23, 25, 1, 22, 133, 3997 }, // ⁘
-    { 23, 23, 25, 1, 22, 133, 4130 }, // ⁙
-    { 6, 23, 8, 1, 22, 35, 4263 }, // ⁚
-    { 18, 24, 20, 1, 23, 108, 4298 }, // ⁛
-    { 23, 23, 25, 1, 22, 133, 4406 }, // ⁜
-    { 6, 24, 8, 1, 23, 36, 4539 }, // ⁝
-    { 6, 23, 8, 1, 22, 35, 4575 }, // ⁞
-    { 0, 0, 6, 0, 0, 0, 4610 }, //  
-    { 0, 0, 18, 0, 0, 0, 4610 }, // ⁠
-    { 0, 0, 18, 0, 0, 0, 4610 }, // ⁡
-    { 0, 0, 18, 0, 0, 0, 4610 }, // ⁢
-    { 0, 0, 18, 0, 0, 0, 4610 }, // ⁣
-    { 0, 0, 18, 0, 0, 0, 4610 }, // ⁤
-    { 0, 0, 0, 0, 0, 0, 4610 }, // ⁦
-    { 0, 0, 0, 0, 0, 0, 4610 }, // ⁧
-    { 0, 0, 0, 0, 0, 0, 4610 }, // ⁨
-    { 0, 0, 0, 0, 0, 0, 4610 }, // ⁩
-    { 8, 25, 0, -4, 21, 50, 4610 }, // ⁪
-    { 8, 25, 0, -4, 21, 50, 4660 }, // ⁫
-    { 8, 25, 0, -4, 21, 50, 4710 }, // ⁬
-    { 8, 25, 0, -4, 21, 50, 4760 }, // ⁭
-    { 8, 25, 0, -4, 21, 50, 4810 }, // ⁮
-    { 8, 25, 0, -4, 21, 50, 4860 }, // ⁯
-    { 11, 14, 11, 0, 25, 39, 0 }, // ⁰
-    { 4, 14, 6, 1, 22, 14, 39 }, // ⁱ
-    { 11, 13, 11, 0, 25, 36, 53 }, // ⁴
-    { 10, 14, 11, 1, 25, 35, 89 }, // ⁵
-    { 11, 14, 11, 0, 25, 39, 124 }, // ⁶
-    { 11, 13, 11, 0, 25, 36, 163 }, // ⁷
-    { 11, 14, 11, 0, 25, 39, 199 }, // ⁸
-    { 11, 14, 11, 0, 25, 39, 238 }, // ⁹
-    { 9, 9, 10, 1, 22, 21, 277 }, // ⁺
-    { 9, 3, 10, 1, 19, 7, 298 }, // ⁻
-    { 9, 7, 10, 1, 21, 16, 305 }, // ⁼
-    { 6, 17, 7, 1, 27, 26, 321 }, // ⁽
-    { 6, 17, 7, 0, 27, 26, 347 }, // ⁾
-    { 10, 11, 12, 1, 19, 28, 373 }, // ⁿ
-    { 11, 14, 11, 0, 9, 39, 401 }, // ₀
-    { 9, 13, 11, 0, 9, 30, 440 }, // ₁
-    { 10, 13, 11, 0, 9, 33, 470 }, // ₂
-    { 11, 14, 11, 0, 9, 39, 503 }, // ₃
-    { 11, 13, 11, 0, 9, 36, 542 }, // ₄
-    { 10, 14, 11, 1, 9, 35, 578 }, // ₅
-    { 11, 14, 11, 0, 9, 39, 613 }, // ₆
-    { 11, 13, 11, 0, 9, 36, 652 }, // ₇
-    { 11, 14, 11, 0, 9, 39, 688 }, // ₈
-    { 11, 14, 11, 0, 9, 39, 727 }, // ₉
-    { 9, 9, 10, 1, 7, 21, 766 }, // ₊
-    { 9, 3, 10, 1, 4, 7, 787 }, // ₋
-    { 9, 7, 10, 1, 6, 16, 794 }, // ₌
-    { 6, 17, 7, 1, 11, 26, 810 }, // ₍
-    { 6, 17, 7, 0, 11, 26, 836 }, // ₎
-    { 10, 10, 11, 0, 7, 25, 862 }, // ₐ
-    { 11, 10, 11, 0, 7, 28, 887 }, // ₑ
-    { 11, 10, 12, 0, 7, 28, 915 }, // ₒ
-    { 11, 10, 11, 0, 7, 28, 943 }, // ₓ
-    { 11, 10, 11, 0, 7, 28, 971 }, // ₔ
-    { 10, 14, 12, 1, 11, 35, 999 }, // ₕ
-    { 11, 14, 12, 1, 11, 39, 1034 }, // ₖ
-    { 4, 14, 6, 1, 11, 14, 1073 }, // ₗ
-    { 17, 10, 19, 1, 7, 43, 1087 }, // ₘ
-    { 10, 10, 12, 1, 7, 25, 1130 }, // ₙ
-    { 11, 14, 12, 1, 7, 39, 1155 }, // ₚ
-    { 9, 10, 10, 0, 7, 23, 1194 }, // ₛ
-    { 8, 12, 8, 0, 9, 24, 1217 }, // ₜ
-    { 17, 22, 17, 0, 22, 94, 0 }, // ₠
-    { 18, 25, 18, 0, 23, 113, 94 }, // ₡
-    { 16, 23, 17, 1, 22, 92, 207 }, // ₢
-    { 16, 21, 17, 0, 21, 84, 299 }, // ₣
-    { 16, 22, 17, 1, 22, 88, 383 }, // ₤
-    { 25, 24, 28, 2, 20, 150, 471 }, // ₥
-    { 17, 21, 17, 0, 21, 90, 621 }, // ₦
-    { 23, 22, 26, 2, 21, 127, 711 }, // ₧
-    { 24, 22, 27, 2, 21, 132, 838 }, // ₨
-    { 22, 21, 22, 0, 21, 116, 970 }, // ₩
-    { 23, 21, 27, 2, 21, 121, 1086 }, // ₪
-    { 18, 28, 19, 1, 23, 126, 1207 }, // ₫
-    { 17, 22, 17, 0, 21, 94, 1333 }, // €
-    { 17, 21, 17, 0, 21, 90, 1427 }, // ₭
-    { 17, 21, 17, 0, 21, 90, 1517 }, // ₮
-    { 29, 29, 29, 0, 22, 211, 1607 }, // ₯
-    { 17, 29, 18, 0, 22, 124, 1818 }, // ₰
-    { 17, 21, 17, 0, 21, 90, 1942 }, // ₱
-    { 18, 26, 21, 1, 23, 117, 2032 }, // ₲
-    { 19, 21, 19, 0, 21, 100, 2149 }, // ₳
-    { 17, 23, 17, 0, 22, 98, 2249 }, // ₴
-    { 17, 26, 19, 1, 23, 111, 2347 }, // ₵
-    { 20, 21, 20, 0, 20, 105, 2458 }, // ₶
-    { 21, 25, 21, 0, 22, 132, 2563 }, // ₷
-    { 17, 21, 17, 0, 21, 90, 2695 }, // ₸
-    { 15, 21, 17, 1, 21, 79, 2785 }, // ₹
-    { 16, 22, 17, 0, 21, 88, 2864 }, // ₺
-    { 24, 23, 24, 0, 22, 138, 2952 }, // ₻
-    { 24, 21, 26, 1, 21, 126, 3090 }, // ₼
-    { 17, 21, 18, 0, 21, 90, 3216 }, // ₽
-    { 21, 23, 23, 1, 23, 121, 3306 }, // ₾
-    { 14, 27, 17, 2, 24, 95, 3427 }, // ₿
-    { 14, 23, 15, 1, 17, 81, 3522 }, // ⃀
-    { 15, 4, 17, 1, 12, 15, 0 }, // −
-    { 27, 28, 29, 1, 23, 189, 0 }, // �
+    { 16, 14, 18, 1, 15, 56, 7057 }, // «
+    { 15, 9, 17, 1, 12, 34, 605 }, // ¬
+    { 9, 4, 9, 0, 10, 9, 639 }, // ­
+    { 22, 23, 24, 1, 22, 127, 648 }, // ®
+    { 16, 4, 15, -1, 26, 16, 775 }, // ¯
+    { 11, 11, 12, 1, 22, 31, 791 }, // °
+    { 15, 19, 17, 1, 19, 72, 822 }, // ±
+    { 10, 13, 11, 0, 25, 33, 894 }, // ²
+    { 11, 14, 11, 0, 25, 39, 927 }, // ³
+    { 9, 6, 11, 1, 23, 14, 966 }, // ´
+    { 15, 23, 19, 2, 16, 87, 980 }, // µ
+    { 16, 27, 19, 1, 23, 108, 1067 }, // ¶
+    { 6, 6, 8, 1, 13, 9, 1175 }, // ·
+    { 8, 7, 8, 0, 0, 14, 1184 }, // ¸
+    { 9, 13, 11, 0, 25, 30, 1198 }, // ¹
+    { 11, 12, 11, 0, 22, 33, 1228 }, // º
+    { 16, 14, 18, 1, 15, 56, 7113 }, // »
+    { 24, 21, 24, 0, 21, 126, 1261 }, // ¼
+    { 25, 21, 26, 0, 21, 132, 1387 }, // ½
+    { 24, 22, 25, 1, 22, 132, 1519 }, // ¾
+    { 14, 23, 14, 0, 17, 81, 1651 }, // ¿
+    { 21, 28, 20, 0, 28, 147, 7169 }, // À
+    { 21, 28, 20, 0, 28, 147, 7316 }, // Á
+    { 21, 28, 20, 0, 28, 147, 7463 }, // Â
+    { 21, 28, 20, 0, 28, 147, 1732 }, // Ã
+    { 21, 27, 20, 0, 27, 142, 7610 }, // Ä
+    { 21, 26, 20, 0, 26, 137, 1879 }, // Å
+    { 27, 21, 28, 0, 21, 142, 2016 }, // Æ
+    { 17, 29, 19, 1, 22, 124, 7752 }, // Ç
+    { 13, 28, 16, 2, 28, 91, 7876 }, // È
+    { 13, 28, 16, 2, 28, 91, 7967 }, // É
+    { 13, 28, 16, 2, 28, 91, 8058 }, // Ê
+    { 13, 27, 16, 2, 27, 88, 8149 }, // Ë
+    { 11, 28, 11, 0, 28, 77, 8237 }, // Ì
+    { 11, 28, 11, 0, 28, 77, 8314 }, // Í
+    { 13, 28, 11, -1, 28, 91, 8391 }, // Î
+    { 11, 27, 11, 0, 27, 75, 8482 }, // Ï
+    { 20, 21, 21, 0, 21, 105, 2158 }, // Ð
+    { 20, 28, 24, 2, 28, 140, 8557 }, // Ñ
+    { 21, 29, 23, 1, 28, 153, 8697 }, // Ò
+    { 21, 29, 23, 1, 28, 153, 8850 }, // Ó
+    { 21, 29, 23, 1, 28, 153, 9003 }, // Ô
+    { 21, 29, 23, 1, 28, 153, 2263 }, // Õ
+    { 21, 28, 23, 1, 27, 147, 9156 }, // Ö
+    { 14, 14, 17, 1, 17, 49, 2416 }, // ×
+    { 21, 24, 23, 1, 22, 126, 2465 }, // Ø
+    { 18, 29, 22, 2, 28, 131, 9303 }, // Ù
+    { 18, 29, 22, 2, 28, 131, 9434 }, // Ú
+    { 18, 29, 22, 2, 28, 131, 9565 }, // Û
+    { 18, 28, 22, 2, 27, 126, 9696 }, // Ü
+    { 19, 28, 18, 0, 28, 133, 2591 }, // Ý
+    { 15, 21, 18, 2, 21, 79, 2724 }, // Þ
+    { 18, 24, 21, 2, 23, 108, 2803 }, // ß
+    { 15, 24, 17, 1, 23, 90, 9822 }, // à
+    { 15, 24, 17, 1, 23, 90, 9912 }, // á
+    { 15, 24, 17, 1, 23, 90, 10002 }, // â
+    { 15, 24, 17, 1, 23, 90, 2911 }, // ã
+    { 15, 23, 17, 1, 22, 87, 10092 }, // ä
+    { 15, 26, 17, 1, 25, 98, 3001 }, // å
+    { 25, 18, 27, 1, 17, 113, 3099 }, // æ
+    { 14, 24, 15, 1, 17, 84, 10179 }, // ç
+    { 16, 24, 17, 1, 23, 96, 10263 }, // è
+    { 16, 24, 17, 1, 23, 96, 10359 }, // é
+    { 16, 24, 17, 1, 23, 96, 10455 }, // ê
+    { 16, 23, 17, 1, 22, 92, 10551 }, // ë
+    { 10, 23, 9, -1, 23, 58, 10643 }, // ì
+    { 9, 23, 9, 2, 23, 52, 10701 }, // í
+    { 13, 23, 9, -2, 23, 75, 10753 }, // î
+    { 11, 22, 9, -1, 22, 61, 10828 }, // ï
+    { 16, 24, 18, 1, 23, 96, 3212 }, // ð
+    { 15, 23, 19, 2, 23, 87, 10889 }, // ñ
+    { 16, 24, 18, 1, 23, 96, 10976 }, // ò
+    { 16, 24, 18, 1, 23, 96, 11072 }, // ó
+    { 16, 24, 18, 1, 23, 96, 11168 }, // ô
+    { 16, 24, 18, 1, 23, 96, 3308 }, // õ
+    { 16, 23, 18, 1, 22, 92, 11264 }, // ö
+    { 15, 15, 17, 1, 18, 57, 3404 }, // ÷
+    { 16, 19, 18, 1, 17, 76, 3461 }, // ø
+    { 15, 24, 19, 2, 23, 90, 11356 }, // ù
+    { 15, 24, 19, 2, 23, 90, 11446 }, // ú
+    { 15, 24, 19, 2, 23, 90, 11536 }, // û
+    { 15, 23, 19, 2, 22, 87, 11626 }, // ü
+    { 17, 30, 17, 0, 23, 128, 3537 }, // ý
+    { 16, 30, 18, 2, 23, 120, 3665 }, // þ
+    { 17, 29, 17, 0, 22, 124, 3785 }, // ÿ
+    { 21, 26, 20, 0, 26, 137, 3909 }, // Ā
+    { 15, 22, 17, 1, 21, 83, 4046 }, // ā
+    { 21, 28, 20, 0, 28, 147, 4129 }, // Ă
+    { 15, 24, 17, 1, 23, 90, 4276 }, // ă
+    { 21, 28, 20, 0, 21, 147, 4366 }, // Ą
+    { 15, 24, 17, 1, 17, 90, 4513 }, // ą
+    { 17, 29, 19, 1, 28, 124, 4603 }, // Ć
+    { 14, 24, 15, 1, 23, 84, 4727 }, // ć
+    { 17, 29, 19, 1, 28, 124, 4811 }, // Ĉ
+    { 14, 24, 15, 1, 23, 84, 4935 }, // ĉ
+    { 17, 29, 19, 1, 28, 124, 5019 }, // Ċ
+    { 14, 24, 15, 1, 23, 84, 5143 }, // ċ
+    { 17, 29, 19, 1, 28, 124, 5227 }, // Č
+    { 14, 24, 15, 1, 23, 84, 5351 }, // č
+    { 18, 28, 21, 2, 28, 126, 5435 }, // Ď
+    { 22, 24, 18, 1, 23, 132, 5561 }, // ď
+    { 20, 21, 21, 0, 21, 105, 5693 }, // Đ
+    { 18, 24, 19, 1, 23, 108, 5798 }, // đ
+    { 13, 26, 16, 2, 26, 85, 5906 }, // Ē
+    { 16, 22, 17, 1, 21, 88, 5991 }, // ē
+    { 13, 28, 16, 2, 28, 91, 6079 }, // Ĕ
+    { 16, 24, 17, 1, 23, 96, 6170 }, // ĕ
+    { 13, 28, 16, 2, 28, 91, 6266 }, // Ė
+    { 16, 24, 17, 1, 23, 96, 6357 }, // ė
+    { 13, 28, 16, 2, 21, 91, 6453 }, // Ę
+    { 16, 24, 17, 1, 17, 96, 6544 }, // ę
+    { 14, 28, 16, 2, 28, 98, 6640 }, // Ě
+    { 16, 24, 17, 1, 23, 96, 6738 }, // ě
+    { 18, 29, 21, 1, 28, 131, 6834 }, // Ĝ
+    { 16, 30, 18, 1, 23, 120, 6965 }, // ĝ
+    { 18, 29, 21, 1, 28, 131, 7085 }, // Ğ
+    { 16, 30, 18, 1, 23, 120, 7216 }, // ğ
+    { 18, 29, 21, 1, 28, 131, 7336 }, // Ġ
+    { 16, 30, 18, 1, 23, 120, 7467 }, // ġ
+    { 18, 29, 21, 1, 22, 131, 7587 }, // Ģ
+    { 16, 30, 18, 1, 23, 120, 7718 }, // ģ
+    { 18, 28, 22, 2, 28, 126, 7838 }, // Ĥ
+    { 19, 29, 19, -2, 29, 138, 7964 }, // ĥ
+    { 23, 21, 22, 0, 21, 121, 8102 }, // Ħ
+    { 17, 23, 19, 0, 23, 98, 8223 }, // ħ
+    { 12, 28, 11, -1, 28, 84, 8321 }, // Ĩ
+    { 13, 23, 9, -2, 23, 75, 8405 }, // ĩ
+    { 11, 26, 11, 0, 26, 72, 8480 }, // Ī
+    { 11, 21, 9, -1, 21, 58, 8552 }, // ī
+    { 12, 28, 11, 0, 28, 84, 8610 }, // Ĭ
+    { 12, 23, 9, -1, 23, 69, 8694 }, // ĭ
+    { 11, 28, 11, 0, 21, 77, 8763 }, // Į
+    { 6, 30, 9, 1, 23, 45, 8840 }, // į
+    { 11, 28, 11, 0, 28, 77, 8885 }, // İ
+    { 5, 16, 9, 2, 16, 20, 8962 }, // ı
+    { 19, 28, 21, 0, 21, 133, 8982 }, // Ĳ
+    { 15, 30, 18, 1, 23, 113, 9115 }, // ĳ
+    { 14, 35, 10, -3, 28, 123, 9228 }, // Ĵ
+    { 13, 30, 9, -2, 23, 98, 9351 }, // ĵ
+    { 18, 28, 19, 2, 21, 126, 9449 }, // Ķ
+    { 17, 30, 18, 2, 23, 128, 9575 }, // ķ
+    { 17, 16, 18, 2, 16, 68, 9703 }, // ĸ
+    { 14, 28, 16, 2, 28, 98, 9771 }, // Ĺ
+    { 10, 29, 9, 1, 29, 73, 9869 }, // ĺ
+    { 14, 28, 16, 2, 21, 98, 9942 }, // Ļ
+    { 6, 30, 9, 1, 23, 45, 10040 }, // ļ
+    { 15, 21, 16, 2, 21, 79, 10085 }, // Ľ
+    { 11, 23, 9, 2, 23, 64, 10164 }, // ľ
+    { 14, 21, 16, 2, 21, 74, 10228 }, // Ŀ
+    { 11, 23, 11, 2, 23, 64, 10302 }, // ŀ
+    { 16, 21, 16, 0, 21, 84, 10366 }, // Ł
+    { 11, 23, 9, -1, 23, 64, 10450 }, // ł
+    { 20, 28, 24, 2, 28, 140, 10514 }, // Ń
+    { 15, 23, 19, 2, 23, 87, 10654 }, // ń
+    { 20, 28, 24, 2, 21, 140, 10741 }, // Ņ
+    { 15, 24, 19, 2, 17, 90, 10881 }, // ņ
+    { 20, 28, 24, 2, 28, 140, 10971 }, // Ň
+    { 15, 23, 19, 2, 23, 87, 11111 }, // ň
+    { 22, 21, 23, -1, 21, 116, 11198 }, // ŉ
+    { 20, 28, 24, 2, 21, 140, 11314 }, // Ŋ
+    { 15, 24, 19, 2, 17, 90, 11454 }, // ŋ
+    { 21, 27, 23, 1, 26, 142, 11544 }, // Ō
+    { 16, 22, 18, 1, 21, 88, 11686 }, // ō
+    { 21, 29, 23, 1, 28, 153, 11774 }, // Ŏ
+    { 16, 24, 18, 1, 23, 96, 11927 }, // ŏ
+    { 21, 29, 23, 1, 28, 153, 12023 }, // Ő
+    { 16, 24, 18, 1, 23, 96, 12176 }, // ő
+    { 26, 23, 28, 1, 22, 150, 11713 }, // Œ
+    { 27, 18, 29, 1, 17, 122, 11863 }, // œ
+    { 18, 28, 19, 2, 28, 126, 12272 }, // Ŕ
+    { 12, 23, 13, 2, 23, 69, 12398 }, // ŕ
+    { 18, 28, 19, 2, 21, 126, 12467 }, // Ŗ
+    { 12, 24, 13, 1, 17, 72, 12593 }, // ŗ
+    { 18, 28, 19, 2, 28, 126, 12665 }, // Ř
+    { 13, 23, 13, 1, 23, 75, 12791 }, // ř
+    { 14, 29, 16, 1, 28, 102, 12866 }, // Ś
+    { 13, 24, 15, 1, 23, 78, 12968 }, // ś
+    { 14, 29, 16, 1, 28, 102, 13046 }, // Ŝ
+    { 13, 24, 15, 1, 23, 78, 13148 }, // ŝ
+    { 14, 29, 16, 1, 22, 102, 13226 }, // Ş
+    { 13, 24, 15, 1, 17, 78, 13328 }, // ş
+    { 14, 29, 16, 1, 28, 102, 13406 }, // Š
+    { 13, 24, 15, 1, 23, 78, 13508 }, // š
+    { 17, 28, 17, 0, 21, 119, 13586 }, // Ţ
+    { 12, 27, 13, 0, 20, 81, 13705 }, // ţ
+    { 17, 28, 17, 0, 28, 119, 13786 }, // Ť
+    { 17, 24, 13, 0, 23, 102, 13905 }, // ť
+    { 17, 21, 17, 0, 21, 90, 14007 }, // Ŧ
+    { 12, 21, 13, 0, 20, 63, 14097 }, // ŧ
+    { 18, 29, 22, 2, 28, 131, 14160 }, // Ũ
+    { 15, 24, 19, 2, 23, 90, 14291 }, // ũ
+    { 18, 27, 22, 2, 26, 122, 14381 }, // Ū
+    { 15, 22, 19, 2, 21, 83, 14503 }, // ū
+    { 18, 29, 22, 2, 28, 131, 14586 }, // Ŭ
+    { 15, 24, 19, 2, 23, 90, 14717 }, // ŭ
+    { 18, 31, 22, 2, 30, 140, 14807 }, // Ů
+    { 15, 26, 19, 2, 25, 98, 14947 }, // ů
+    { 18, 29, 22, 2, 28, 131, 15045 }, // Ű
+    { 15, 24, 19, 2, 23, 90, 15176 }, // ű
+    { 18, 28, 22, 2, 21, 126, 15266 }, // Ų
+    { 15, 23, 19, 2, 16, 87, 15392 }, // ų
+    { 29, 28, 28, 0, 28, 203, 15479 }, // Ŵ
+    { 25, 23, 25, 0, 23, 144, 15682 }, // ŵ
+    { 19, 28, 18, 0, 28, 133, 15826 }, // Ŷ
+    { 17, 30, 17, 0, 23, 128, 15959 }, // ŷ
+    { 19, 27, 18, 0, 27, 129, 16087 }, // Ÿ
+    { 17, 28, 17, 0, 28, 119, 16216 }, // Ź
+    { 14, 23, 14, 0, 23, 81, 16335 }, // ź
+    { 17, 28, 17, 0, 28, 119, 16416 }, // Ż
+    { 14, 23, 14, 0, 23, 81, 16535 }, // ż
+    { 17, 28, 17, 0, 28, 119, 16616 }, // Ž
+    { 14, 23, 14, 0, 23, 81, 16735 }, // ž
+    { 10, 23, 11, 2, 23, 58, 16816 }, // ſ
+    { 9, 6, 0, -16, 23, 14, 16874 }, // ̀
+    { 9, 6, 0, -11, 23, 14, 16888 }, // ́
+    { 12, 6, 0, -6, 23, 18, 16902 }, // ̂
+    { 12, 6, 0, -16, 23, 18, 16920 }, // ̃
+    { 10, 4, 0, -5, 21, 10, 16938 }, // ̄
+    { 14, 4, 0, -7, 25, 14, 16948 }, // ̅
+    { 12, 6, 0, -6, 23, 18, 16962 }, // ̆
+    { 6, 6, 0, -3, 23, 9, 16980 }, // ̇
+    { 12, 4, 0, -6, 22, 12, 16989 }, // ̈
+    { 8, 8, 0, -13, 25, 16, 17001 }, // ̉
+    { 8, 8, 0, -4, 25, 16, 17017 }, // ̊
+    { 14, 6, 0, -5, 23, 21, 17033 }, // ̋
+    { 13, 6, 0, -6, 23, 20, 17054 }, // ̌
+    { 4, 6, 0, -2, 23, 6, 17074 }, // ̍
+    { 8, 6, 0, -4, 23, 12, 17080 }, // ̎
+    { 13, 6, 0, -17, 23, 20, 17092 }, // ̏
+    { 12, 8, 0, -6, 25, 24, 17112 }, // ̐
+    { 12, 6, 0, -6, 23, 18, 17136 }, // ̑
+    { 6, 8, 0, -3, 21, 12, 17154 }, // ̒
+    { 6, 8, 0, -3, 21, 12, 17166 }, // ̓
+    { 6, 8, 0, -3, 21, 12, 17178 }, // ̔
+    { 6, 8, 0, -3, 21, 12, 17190 }, // ̕
+    { 9, 6, 0, -5, -1, 14, 17202 }, // ̖
+    { 10, 6, 0, -5, -1, 15, 17216 }, // ̗
+    { 6, 7, 0, -3, 0, 11, 17231 }, // ̘
+    { 6, 7, 0, -3, 0, 11, 17242 }, // ̙
+    { 8, 8, 9, 0, 23, 16, 17253 }, // ̚
+    { 8, 8, 0, -3, 23, 16, 17269 }, // ̛
+    { 4, 7, 0, -2, 0, 7, 17285 }, // ̜
+    { 8, 6, 0, -4, -1, 12, 17292 }, // ̝
+    { 8, 6, 0, -4, -1, 12, 17304 }, // ̞
+    { 8, 7, 0, -4, 0, 14, 17316 }, // ̟
+    { 7, 3, 0, -4, -3, 6, 17330 }, // ̠
+    { 7, 9, 0, -7, 2, 16, 17336 }, // ̡
+    { 7, 9, 0, 0, 2, 16, 17352 }, // ̢
+    { 6, 6, 0, -13, -1, 9, 17368 }, // ̣
+    { 12, 4, 0, -6, -2, 12, 17377 }, // ̤
+    { 8, 8, 0, -4, 1, 16, 17389 }, // ̥
+    { 6, 6, 0, -3, -1, 9, 17405 }, // ̦
+    { 8, 7, 0, -4, 0, 14, 17414 }, // ̧
+    { 6, 8, 0, -3, 1, 12, 17428 }, // ̨
+    { 4, 6, 0, -2, -1, 6, 17440 }, // ̩
+    { 12, 6, 0, -6, -1, 18, 17446 }, // ̪
+    { 12, 5, 0, -6, -1, 15, 17464 }, // ̫
+    { 13, 6, 0, -6, 0, 20, 17479 }, // ̬
+    { 12, 6, 0, -6, -1, 18, 17499 }, // ̭
+    { 12, 6, 0, -6, -1, 18, 17517 }, // ̮
+    { 12, 6, 0, -6, -1, 18, 17535 }, // ̯
+    { 12, 6, 0, -6, -1, 18, 17553 }, // ̰
+    { 10, 4, 0, -5, -2, 10, 17571 }, // ̱
+    { 14, 3, 0, -7, -2, 11, 17581 }, // ̲
+    { 13, 7, 0, -7, 0, 23, 17592 }, // ̳
+    { 13, 6, 0, -6, 11, 20, 17615 }, // ̴
+    { 14, 4, 0, -7, 10, 14, 17635 }, // ̵
+    { 22, 4, 0, -11, 10, 22, 17649 }, // ̶
+    { 12, 9, 0, -6, 13, 27, 17671 }, // ̷
+    { 14, 25, 0, -7, 23, 88, 17698 }, // ̸
+    { 4, 7, 0, -2, 0, 7, 17786 }, // ̹
+    { 12, 6, 0, -6, -1, 18, 17793 }, // ̺
+    { 12, 7, 0, -6, 0, 21, 17811 }, // ̻
+    { 12, 5, 0, -6, -1, 15, 17832 }, // ̼
+    { 6, 7, 0, -3, 23, 11, 17847 }, // ̽
+    { 4, 10, 0, -2, 26, 10, 17858 }, // ̾
+    { 13, 7, 0, -7, 29, 23, 17868 }, // ̿
+    { 9, 6, 0, -7, 23, 14, 17891 }, // ̀
+    { 9, 6, 0, -2, 23, 14, 17905 }, // ́
+    { 13, 6, 0, -6, 23, 20, 17919 }, // ͂
+    { 6, 6, 0, -3, 23, 9, 17939 }, // ̓
+    { 17, 6, 0, -7, 23, 26, 17948 }, // ̈́
+    { 7, 6, 0, -2, -1, 11, 17974 }, // ͅ
+    { 14, 6, 0, -7, 23, 21, 17985 }, // ͆
+    { 13, 7, 0, -7, 0, 23, 18006 }, // ͇
+    { 8, 6, 0, -4, -1, 12, 18029 }, // ͈
+    { 6, 6, 0, -3, -1, 9, 18041 }, // ͉
+    { 12, 7, 0, -6, 23, 21, 18050 }, // ͊
+    { 12, 12, 0, -6, 28, 36, 18071 }, // ͋
+    { 12, 9, 0, -6, 26, 27, 18107 }, // ͌
+    { 12, 6, 0, -6, -1, 18, 18134 }, // ͍
+    { 6, 7, 0, -3, 0, 11, 18152 }, // ͎
+    { 22, 21, 0, -11, 21, 116, 18163 }, // ͏
+    { 6, 7, 0, -3, 24, 11, 18279 }, // ͐
+    { 5, 8, 0, -2, 24, 10, 18290 }, // ͑
+    { 12, 8, 0, -6, 25, 24, 18300 }, // ͒
+    { 6, 7, 0, -3, 0, 11, 18324 }, // ͓
+    { 6, 6, 0, -3, -1, 9, 18335 }, // ͔
+    { 6, 6, 0, -3, -1, 9, 18344 }, // ͕
+    { 12, 6, 0, -6, -1, 18, 18353 }, // ͖
+    { 5, 8, 0, -2, 24, 10, 18371 }, // ͗
+    { 6, 6, 0, 2, 23, 9, 18381 }, // ͘
+    { 8, 6, 0, -4, -1, 12, 18390 }, // ͙
+    { 12, 7, 0, -6, 0, 21, 18402 }, // ͚
+    { 6, 6, 0, -3, 23, 9, 18423 }, // ͛
+    { 24, 6, 0, -12, -1, 36, 18432 }, // ͜
+    { 24, 6, 0, -12, 23, 36, 18468 }, // ͝
+    { 18, 3, 0, -9, 20, 14, 18504 }, // ͞
+    { 18, 3, 0, -9, -2, 14, 18518 }, // ͟
+    { 24, 6, 0, -12, 23, 36, 18532 }, // ͠
+    { 24, 7, 0, -12, 26, 42, 18568 }, // ͡
+    { 24, 7, 0, -11, 0, 42, 18610 }, // ͢
+    { 8, 8, 0, -4, 25, 16, 18652 }, // ͣ
+    { 7, 8, 0, -3, 25, 14, 18668 }, // ͤ
+    { 3, 9, 0, -1, 27, 7, 18682 }, // ͥ
+    { 8, 8, 0, -4, 25, 16, 18689 }, // ͦ
+    { 8, 8, 0, -4, 25, 16, 18705 }, // ͧ
+    { 7, 8, 0, -3, 25, 14, 18721 }, // ͨ
+    { 8, 10, 0, -4, 27, 20, 18735 }, // ͩ
+    { 7, 9, 0, -3, 27, 16, 18755 }, // ͪ
+    { 12, 7, 0, -6, 25, 21, 18771 }, // ͫ
+    { 6, 7, 0, -2, 25, 11, 18792 }, // ͬ
+    { 6, 9, 0, -3, 26, 14, 18803 }, // ͭ
+    { 9, 7, 0, -4, 25, 16, 18817 }, // ͮ
+    { 8, 7, 0, -4, 25, 14, 18833 }, // ͯ
+    { 13, 28, 16, 2, 28, 91, 18847 }, // Ѐ
+    { 13, 27, 16, 2, 27, 88, 0 }, // Ё
+    { 22, 22, 22, 0, 21, 121, 18938 }, // Ђ
+    { 14, 28, 16, 2, 28, 98, 19059 }, // Ѓ
+    { 17, 23, 19, 1, 22, 98, 19157 }, // Є
+    { 14, 23, 16, 1, 22, 81, 19255 }, // Ѕ
+    { 5, 21, 9, 2, 21, 27, 19336 }, // І
+    { 10, 28, 10, 0, 28, 70, 19363 }, // Ї
+    { 11, 28, 10, -3, 21, 77, 19433 }, // Ј
+    { 29, 22, 30, 0, 21, 160, 19510 }, // Љ
+    { 28, 21, 31, 2, 21, 147, 19670 }, // Њ
+    { 21, 21, 23, 0, 21, 111, 19817 }, // Ћ
+    { 19, 28, 20, 2, 28, 133, 19928 }, // Ќ
+    { 19, 28, 23, 2, 28, 133, 20061 }, // Ѝ
+    { 19, 29, 19, 0, 28, 138, 20194 }, // Ў
+    { 18, 26, 22, 2, 21, 117, 20332 }, // Џ
+    { 21, 21, 20, 0, 21, 111, 88 }, // А
+    { 16, 21, 19, 2, 21, 84, 199 }, // Б
+    { 16, 21, 19, 2, 21, 84, 283 }, // В
+    { 14, 21, 16, 2, 21, 74, 367 }, // Г
+    { 23, 26, 23, 0, 21, 150, 441 }, // Д
+    { 13, 21, 16, 2, 21, 69, 591 }, // Е
+    { 29, 21, 29, 0, 21, 153, 660 }, // Ж
+    { 15, 23, 17, 1, 22, 87, 813 }, // З
+    { 19, 21, 23, 2, 21, 100, 900 }, // И
+    { 19, 28, 23, 2, 28, 133, 1000 }, // Й
+    { 19, 21, 20, 2, 21, 100, 1133 }, // К
+    { 19, 22, 21, 0, 21, 105, 1233 }, // Л
+    { 23, 21, 28, 2, 21, 121, 1338 }, // М
+    { 18, 21, 22, 2, 21, 95, 1459 }, // Н
+    { 21, 23, 23, 1, 22, 121, 1554 }, // О
+    { 18, 21, 22, 2, 21, 95, 1675 }, // П
+    { 15, 21, 18, 2, 21, 79, 1770 }, // Р
+    { 17, 23, 19, 1, 22, 98, 1849 }, // С
+    { 17, 21, 17, 0, 21, 90, 1947 }, // Т
+    { 19, 22, 19, 0, 21, 105, 2037 }, // У
+    { 24, 23, 26, 1, 22, 138, 2142 }, // Ф
+    { 20, 21, 19, 0, 21, 105, 2280 }, // Х
+    { 21, 26, 23, 2, 21, 137, 2385 }, // Ц
+    { 17, 21, 21, 2, 21, 90, 2522 }, // Ч
+    { 27, 21, 31, 2, 21, 142, 2612 }, // Ш
+    { 30, 26, 31, 2, 21, 195, 2754 }, // Щ
+    { 21, 21, 22, 0, 21, 111, 2949 }, // Ъ
+    { 23, 21, 27, 2, 21, 121, 3060 }, // Ы
+    { 16, 21, 19, 2, 21, 84, 3181 }, // Ь
+    { 17, 23, 19, 1, 22, 98, 3265 }, // Э
+    { 27, 23, 30, 2, 22, 156, 3363 }, // Ю
+    { 18, 21, 20, 0, 21, 95, 3519 }, // Я
+    { 15, 18, 17, 1, 17, 68, 3614 }, // а
+    { 16, 24, 18, 1, 23, 96, 3682 }, // б
+    { 15, 16, 17, 2, 16, 60, 3778 }, // в
+    { 12, 16, 14, 2, 16, 48, 3838 }, // г
+    { 19, 21, 19, 0, 16, 100, 3886 }, // д
+    { 15, 18, 17, 1, 17, 68, 3986 }, // е
+    { 26, 16, 25, 0, 16, 104, 4054 }, // ж
+    { 14, 18, 15, 0, 17, 63, 4158 }, // з
+    { 16, 16, 20, 2, 16, 64, 4221 }, // и
+    { 16, 23, 20, 2, 23, 92, 4285 }, // й
+    { 16, 16, 18, 2, 16, 64, 4377 }, // к
+    { 17, 17, 18, 0, 16, 73, 4441 }, // л
+    { 21, 16, 24, 2, 16, 84, 4514 }, // м
+    { 15, 16, 19, 2, 16, 60, 4598 }, // н
+    { 16, 18, 18, 1, 17, 72, 4658 }, // о
+    { 15, 16, 19, 2, 16, 60, 4730 }, // п
+    { 16, 24, 19, 2, 17, 96, 4790 }, // р
+    { 14, 18, 15, 1, 17, 63, 4886 }, // с
+    { 15, 16, 15, 0, 16, 60, 4949 }, // т
+    { 18, 23, 17, -1, 16, 104, 5009 }, // у
+    { 22, 30, 24, 1, 23, 165, 5113 }, // ф
+    { 17, 16, 17, 0, 16, 68, 5278 }, // х
+    { 17, 21, 19, 2, 16, 90, 5346 }, // ц
+    { 16, 16, 19, 1, 16, 64, 5436 }, // ч
+    { 24, 16, 28, 2, 16, 96, 5500 }, // ш
+    { 26, 21, 28, 2, 16, 137, 5596 }, // щ
+    { 19, 16, 20, 0, 16, 76, 5733 }, // ъ
+    { 21, 16, 25, 2, 16, 84, 5809 }, // ы
+    { 15, 16, 17, 2, 16, 60, 5893 }, // ь
+    { 14, 18, 15, 1, 17, 63, 5953 }, // э
+    { 22, 18, 25, 2, 17, 99, 6016 }, // ю
+    { 16, 16, 18, 0, 16, 64, 6115 }, // я
+    { 15, 24, 17, 1, 23, 90, 20449 }, // ѐ
+    { 15, 23, 17, 1, 22, 87, 6179 }, // ё
+    { 17, 30, 19, 0, 23, 128, 20539 }, // ђ
+    { 12, 23, 14, 2, 23, 69, 20667 }, // ѓ
+    { 14, 18, 15, 1, 17, 63, 20736 }, // є
+    { 13, 18, 15, 1, 17, 59, 20799 }, // ѕ
+    { 5, 23, 9, 2, 23, 29, 20858 }, // і
+    { 9, 23, 9, 0, 23, 52, 20887 }, // ї
+    { 9, 30, 9, -2, 23, 68, 20939 }, // ј
+    { 25, 17, 26, 0, 16, 107, 21007 }, // љ
+    { 24, 16, 27, 2, 16, 96, 21114 }, // њ
+    { 17, 23, 19, 0, 23, 98, 21210 }, // ћ
+    { 16, 23, 18, 2, 23, 92, 21308 }, // ќ
+    { 16, 23, 20, 2, 23, 92, 21400 }, // ѝ
+    { 18, 30, 17, -1, 23, 135, 21492 }, // ў
+    { 15, 21, 19, 2, 16, 79, 21627 }, // џ
+    { 28, 21, 28, 0, 21, 147, 21706 }, // Ѡ
+    { 25, 16, 26, 0, 16, 100, 21853 }, // ѡ
+    { 19, 21, 20, 0, 21, 100, 21953 }, // Ѣ
+    { 19, 20, 19, 0, 20, 95, 22053 }, // ѣ
+    { 25, 23, 28, 2, 22, 144, 22148 }, // Ѥ
+    { 21, 18, 23, 2, 17, 95, 22292 }, // ѥ
+    { 22, 21, 21, 0, 21, 116, 22387 }, // Ѧ
+    { 19, 16, 19, 0, 16, 76, 22503 }, // ѧ
+    { 28, 21, 29, 2, 21, 147, 22579 }, // Ѩ
+    { 25, 16, 26, 2, 16, 100, 22726 }, // ѩ
+    { 23, 21, 23, 0, 21, 121, 22826 }, // Ѫ
+    { 18, 16, 18, 0, 16, 72, 22947 }, // ѫ
+    { 29, 21, 31, 2, 21, 153, 23019 }, // Ѭ
+    { 24, 16, 26, 2, 16, 96, 23172 }, // ѭ
+    { 18, 33, 18, 0, 26, 149, 23268 }, // Ѯ
+    { 16, 27, 16, 0, 20, 108, 23417 }, // ѯ
+    { 22, 21, 26, 2, 21, 116, 23525 }, // Ѱ
+    { 21, 30, 25, 2, 23, 158, 23641 }, // ѱ
+    { 21, 23, 23, 1, 22, 121, 23799 }, // Ѳ
+    { 16, 18, 18, 1, 17, 72, 23920 }, // ѳ
+    { 21, 21, 21, 0, 21, 111, 23992 }, // Ѵ
+    { 18, 17, 18, 0, 17, 77, 24103 }, // ѵ
+    { 21, 28, 21, 0, 28, 147, 24180 }, // Ѷ
+    { 18, 23, 18, 0, 23, 104, 24327 }, // ѷ
+    { 38, 29, 38, 1, 22, 276, 24431 }, // Ѹ
+    { 34, 24, 34, 1, 17, 204, 24707 }, // ѹ
+    { 22, 25, 24, 1, 23, 138, 24911 }, // Ѻ
+    { 18, 20, 20, 1, 18, 90, 25049 }, // ѻ
+    { 30, 33, 32, 1, 32, 248, 25139 }, // Ѽ
+    { 26, 28, 28, 1, 27, 182, 25387 }, // ѽ
+    { 28, 27, 28, 0, 27, 189, 25569 }, // Ѿ
+    { 25, 22, 26, 0, 22, 138, 25758 }, // ѿ
+    { 18, 29, 20, 1, 22, 131, 25896 }, // Ҁ
+    { 14, 24, 15, 1, 17, 84, 26027 }, // ҁ
+    { 16, 20, 18, 1, 19, 80, 26111 }, // ҂
+    { 12, 6, 0, -14, 22, 18, 26191 }, // ҃
+    { 12, 6, 0, -14, 23, 18, 26209 }, // ҄
+    { 5, 7, 0, -10, 24, 9, 26227 }, // ҅
+    { 5, 7, 0, -10, 24, 9, 26236 }, // ҆
+    { 12, 5, 0, -6, 27, 15, 26245 }, // ҇
+    { 34, 31, 0, -17, 23, 264, 26260 }, // ҈
+    { 34, 33, 0, -17, 24, 281, 26524 }, // ҉
+    { 25, 35, 27, 2, 28, 219, 26805 }, // Ҋ
+    { 21, 29, 23, 2, 23, 153, 27024 }, // ҋ
+    { 18, 21, 19, 0, 21, 95, 27177 }, // Ҍ
+    { 17, 23, 18, 0, 23, 98, 27272 }, // ҍ
+    { 15, 21, 18, 2, 21, 79, 27370 }, // Ҏ
+    { 16, 24, 18, 2, 17, 96, 27449 }, // ҏ
+    { 15, 26, 17, 2, 26, 98, 27545 }, // Ґ
+    { 12, 21, 15, 2, 21, 63, 27643 }, // ґ
+    { 16, 21, 16, 0, 21, 84, 27706 }, // Ғ
+    { 14, 16, 14, 0, 16, 56, 27790 }, // ғ
+    { 18, 29, 21, 2, 21, 131, 0 }, // Ҕ
+    { 15, 24, 18, 2, 16, 90, 131 }, // ҕ
+    { 30, 28, 30, 0, 21, 210, 221 }, // Җ
+    { 28, 22, 27, -1, 16, 154, 431 }, // җ
+    { 15, 29, 17, 1, 22, 109, 585 }, // Ҙ
+    { 14, 24, 15, 0, 17, 84, 694 }, // ҙ
+    { 20, 28, 22, 2, 21, 140, 778 }, // Қ
+    { 17, 22, 19, 2, 16, 94, 918 }, // қ
+    { 18, 21, 20, 2, 21, 95, 1012 }, // Ҝ
+    { 16, 16, 18, 2, 16, 64, 1107 }, // ҝ
+    { 20, 21, 20, 1, 21, 105, 1171 }, // Ҟ
+    { 19, 23, 18, 0, 23, 110, 1276 }, // ҟ
+    { 22, 21, 21, 0, 21, 116, 1386 }, // Ҡ
+    { 21, 16, 20, 0, 16, 84, 1502 }, // ҡ
+    { 22, 28, 25, 2, 21, 154, 1586 }, // Ң
+    { 19, 22, 22, 2, 16, 105, 1740 }, // ң
+    { 23, 21, 24, 2, 21, 121, 1845 }, // Ҥ
+    { 21, 16, 22, 2, 16, 84, 1966 }, // ҥ
+    { 30, 29, 33, 2, 21, 218, 2050 }, // Ҧ
+    { 23, 24, 26, 2, 16, 138, 2268 }, // ҧ
+    { 21, 24, 23, 1, 22, 126, 2406 }, // Ҩ
+    { 18, 19, 19, 1, 17, 86, 2532 }, // ҩ
+    { 17, 29, 19, 1, 22, 124, 2618 }, // Ҫ
+    { 14, 24, 15, 1, 17, 84, 2742 }, // ҫ
+    { 17, 28, 17, 0, 21, 119, 2826 }, // Ҭ
+    { 16, 22, 16, 0, 16, 88, 2945 }, // ҭ
+    { 19, 21, 18, 0, 21, 100, 3033 }, // Ү
+    { 17, 23, 17, 0, 16, 98, 3133 }, // ү
+    { 19, 21, 18, 0, 21, 100, 3231 }, // Ұ
+    { 17, 23, 17, 0, 16, 98, 3331 }, // ұ
+    { 22, 28, 22, 0, 21, 154, 3429 }, // Ҳ
+    { 19, 22, 19, 0, 16, 105, 3583 }, // ҳ
+    { 27, 28, 27, 0, 21, 189, 3688 }, // Ҵ
+    { 23, 22, 23, 0, 16, 127, 3877 }, // ҵ
+    { 22, 28, 23, 1, 21, 154, 4004 }, // Ҷ
+    { 20, 22, 21, 1, 16, 110, 4158 }, // ҷ
+    { 18, 21, 21, 1, 21, 95, 4268 }, // Ҹ
+    { 17, 16, 19, 1, 16, 68, 4363 }, // ҹ
+    { 18, 21, 21, 2, 21, 95, 4431 }, // Һ
+    { 15, 23, 19, 2, 23, 87, 4526 }, // һ
+    { 26, 23, 28, 0, 22, 150, 4613 }, // Ҽ
+    { 21, 18, 21, -1, 17, 95, 4763 }, // ҽ
+    { 26, 29, 28, 0, 22, 189, 4858 }, // Ҿ
+    { 21, 23, 21, -1, 17, 121, 5047 }, // ҿ
+    { 11, 21, 11, 0, 21, 58, 5168 }, // Ӏ
+    { 29, 28, 29, 0, 28, 203, 5226 }, // Ӂ
+    { 26, 23, 25, 0, 23, 150, 5429 }, // ӂ
+    { 19, 29, 22, 2, 21, 138, 5579 }, // Ӄ
+    { 16, 24, 19, 2, 16, 96, 5717 }, // ӄ
+    { 24, 28, 24, 0, 21, 168, 5813 }, // Ӆ
+    { 21, 22, 21, 0, 16, 116, 5981 }, // ӆ
+    { 18, 29, 22, 2, 21, 131, 6097 }, // Ӈ
+    { 16, 24, 19, 2, 16, 96, 6228 }, // ӈ
+    { 23, 28, 25, 2, 21, 161, 6324 }, // Ӊ
+    { 20, 22, 22, 2, 16, 110, 6485 }, // ӊ
+    { 18, 28, 21, 1, 21, 126, 6595 }, // Ӌ
+    { 16, 22, 19, 1, 16, 88, 6721 }, // ӌ
+    { 28, 28, 30, 2, 21, 196, 6809 }, // Ӎ
+    { 25, 22, 27, 2, 16, 138, 7005 }, // ӎ
+    { 11, 21, 11, 0, 21, 58, 7143 }, // ӏ
+    { 21, 28, 20, 0, 28, 147, 7201 }, // Ӑ
+    { 15, 24, 17, 1, 23, 90, 7348 }, // ӑ
+    { 21, 27, 20, 0, 27, 142, 7438 }, // Ӓ
+    { 15, 23, 17, 1, 22, 87, 7580 }, // ӓ
+    { 27, 21, 28, 0, 21, 142, 7667 }, // Ӕ
+    { 25, 18, 27, 1, 17, 113, 7809 }, // ӕ
+    { 13, 28, 16, 2, 28, 91, 7922 }, // Ӗ
+    { 16, 24, 17, 1, 23, 96, 8013 }, // ӗ
+    { 21, 23, 24, 2, 22, 121, 8109 }, // Ә
+    { 16, 18, 17, 1, 17, 72, 8230 }, // ә
+    { 21, 28, 24, 2, 27, 147, 8302 }, // Ӛ
+    { 16, 23, 17, 1, 22, 92, 8449 }, // ӛ
+    { 29, 27, 29, 0, 27, 196, 8541 }, // Ӝ
+    { 26, 22, 25, 0, 22, 143, 8737 }, // ӝ
+    { 15, 28, 17, 1, 27, 105, 8880 }, // Ӟ
+    { 14, 23, 15, 0, 22, 81, 8985 }, // ӟ
+    { 17, 22, 17, 0, 21, 94, 9066 }, // Ӡ
+    { 16, 23, 17, 0, 16, 92, 9160 }, // ӡ
+    { 19, 26, 23, 2, 26, 124, 9252 }, // Ӣ
+    { 16, 21, 20, 2, 21, 84, 9376 }, // ӣ
+    { 19, 27, 23, 2, 27, 129, 9460 }, // Ӥ
+    { 16, 22, 20, 2, 22, 88, 9589 }, // ӥ
+    { 21, 28, 23, 1, 27, 147, 9677 }, // Ӧ
+    { 16, 23, 18, 1, 22, 92, 9824 }, // ӧ
+    { 21, 23, 23, 1, 22, 121, 9916 }, // Ө
+    { 16, 18, 18, 1, 17, 72, 10037 }, // ө
+    { 21, 28, 23, 1, 27, 147, 10109 }, // Ӫ
+    { 16, 23, 18, 1, 22, 92, 10256 }, // ӫ
+    { 17, 28, 19, 1, 27, 119, 10348 }, // Ӭ
+    { 14, 23, 15, 1, 22, 81, 10467 }, // ӭ
+    { 19, 27, 19, 0, 26, 129, 10548 }, // Ӯ
+    { 18, 28, 17, -1, 21, 126, 10677 }, // ӯ
+    { 19, 28, 19, 0, 27, 133, 10803 }, // Ӱ
+    { 18, 29, 17, -1, 22, 131, 10936 }, // ӱ
+    { 19, 29, 19, 0, 28, 138, 11067 }, // Ӳ
+    { 17, 30, 17, 0, 23, 128, 11205 }, // ӳ
+    { 17, 27, 21, 2, 27, 115, 11333 }, // Ӵ
+    { 16, 22, 19, 1, 22, 88, 11448 }, // ӵ
+    { 14, 28, 16, 2, 21, 98, 11536 }, // Ӷ
+    { 12, 22, 14, 2, 16, 66, 11634 }, // ӷ
+    { 23, 27, 27, 2, 27, 156, 11700 }, // Ӹ
+    { 21, 22, 25, 2, 22, 116, 11856 }, // ӹ
+    { 16, 29, 16, 0, 21, 116, 11972 }, // Ӻ
+    { 14, 23, 14, 0, 16, 81, 12088 }, // ӻ
+    { 21, 29, 21, 0, 21, 153, 12169 }, // Ӽ
+    { 18, 23, 19, 0, 16, 104, 12322 }, // ӽ
+    { 20, 21, 20, 0, 21, 105, 12426 }, // Ӿ
+    { 17, 16, 17, 0, 16, 68, 12531 }, // ӿ
+    { 0, 0, 15, 0, 0, 0, 12599 }, //  
+    { 0, 0, 29, 0, 0, 0, 12599 }, //  
+    { 0, 0, 15, 0, 0, 0, 12599 }, //  
+    { 0, 0, 29, 0, 0, 0, 12599 }, //  
+    { 0, 0, 10, 0, 0, 0, 12599 }, //  
+    { 0, 0, 7, 0, 0, 0, 12599 }, //  
+    { 0, 0, 5, 0, 0, 0, 12599 }, //  
+    { 0, 0, 17, 0, 0, 0, 12599 }, //  
+    { 0, 0, 8, 0, 0, 0, 12599 }, //  
+    { 0, 0, 5, 0, 0, 0, 12599 }, //  
+    { 0, 0, 3, 0, 0, 0, 12599 }, //  
+    { 0, 0, 0, 0, 0, 0, 12599 }, // ​
+    { 0, 0, 0, 0, 0, 0, 12599 }, // ‌
+    { 0, 0, 0, 0, 0, 0, 12599 }, // ‍
+    { 8, 25, 0, -1, 21, 50, 12599 }, // ‎
+    { 8, 25, 0, -7, 21, 50, 12649 }, // ‏
+    { 9, 4, 9, 0, 10, 9, 12699 }, // ‐
+    { 9, 4, 9, 0, 10, 9, 12708 }, // ‑
+    { 15, 4, 17, 1, 12, 15, 12717 }, // ‒
+    { 13, 4, 15, 1, 10, 13, 11985 }, // –
+    { 28, 4, 29, 1, 10, 28, 11998 }, // —
+    { 28, 4, 29, 1, 10, 28, 12732 }, // ―
+    { 12, 30, 16, 2, 23, 90, 12760 }, // ‖
+    { 14, 7, 12, -1, 0, 25, 12850 }, // ‗
+    { 6, 8, 6, 0, 21, 12, 12026 }, // ‘
+    { 6, 8, 6, 0, 21, 12, 12038 }, // ’
+    { 7, 8, 8, 0, 4, 14, 12875 }, // ‚
+    { 6, 8, 6, 0, 21, 12, 12889 }, // ‛
+    { 13, 8, 13, 0, 21, 26, 12050 }, // “
+    { 13, 8, 13, 0, 21, 26, 12076 }, // ”
+    { 14, 8, 15, 0, 4, 28, 12901 }, // „
+    { 13, 8, 13, 0, 21, 26, 12929 }, // ‟
+    { 13, 23, 15, 1, 23, 75, 12955 }, // †
+    { 13, 23, 15, 1, 23, 75, 13030 }, // ‡
+    { 9, 10, 11, 1, 16, 23, 13105 }, // •
+    { 10, 12, 11, 1, 17, 30, 13128 }, // ‣
+    { 6, 6, 15, 4, 5, 9, 13158 }, // ․
+    { 15, 6, 17, 1, 5, 23, 13167 }, // ‥
+    { 23, 6, 25, 1, 5, 35, 12102 }, // …
+    { 6, 6, 8, 1, 11, 9, 13190 }, // ‧
+    { 0, 0, 18, 0, 0, 0, 13199 }, //  
+    { 0, 0, 18, 0, 0, 0, 13199 }, //  
+    { 8, 22, 0, -1, 18, 44, 13199 }, // ‪
+    { 8, 22, 0, -7, 18, 44, 13243 }, // ‫
+    { 8, 25, 0, -4, 21, 50, 13287 }, // ‬
+    { 8, 25, 0, -4, 21, 50, 13337 }, // ‭
+    { 8, 25, 0, -4, 21, 50, 13387 }, // ‮
+    { 0, 0, 5, 0, 0, 0, 13437 }, //  
+    { 37, 23, 37, 0, 22, 213, 13437 }, // ‰
+    { 48, 23, 49, 0, 22, 276, 13650 }, // ‱
+    { 9, 8, 9, 1, 21, 18, 13926 }, // ′
+    { 15, 8, 15, 1, 21, 30, 13944 }, // ″
+    { 21, 8, 22, 1, 21, 42, 13974 }, // ‴
+    { 9, 8, 12, 1, 21, 18, 14016 }, // ‵
+    { 15, 8, 19, 1, 21, 30, 14034 }, // ‶
+    { 22, 8, 25, 1, 21, 44, 14064 }, // ‷
+    { 12, 10, 12, 0, 3, 30, 14108 }, // ‸
+    { 9, 14, 11, 1, 15, 32, 14138 }, // ‹
+    { 9, 14, 11, 1, 15, 32, 14170 }, // ›
+    { 23, 23, 25, 1, 22, 133, 14202 }, // ※
+    { 14, 22, 17, 1, 21, 77, 14335 }, // ‼
+    { 14, 23, 14, 0, 22, 81, 14412 }, // ‽
+    { 16, 4, 15, -1, 26, 16, 14493 }, // ‾
+    { 18, 7, 18, 0, 0, 32, 14509 }, // ‿
+    { 18, 8, 18, 0, 24, 36, 14541 }, // ⁀
+    { 12, 19, 12, 0, 12, 57, 14577 }, // ⁁
+    { 33, 28, 33, 0, 23, 231, 14634 }, // ⁂
+    { 9, 4, 9, 1, 10, 9, 14865 }, // ⁃
+    { 16, 21, 4, -6, 21, 84, 14874 }, // ⁄
+    { 7, 26, 10, 2, 21, 46, 14958 }, // ⁅
+    { 8, 26, 10, 0, 21, 52, 15004 }, // ⁆
+    { 28, 23, 28, 0, 22, 161, 15056 }, // ⁇
+    { 21, 23, 22, 0, 22, 121, 15217 }, // ⁈
+    { 21, 23, 22, 1, 22, 121, 15338 }, // ⁉
+    { 15, 16, 17, 1, 16, 60, 15459 }, // ⁊
+    { 16, 27, 19, 2, 23, 108, 15519 }, // ⁋
+    { 16, 15, 19, 1, 16, 60, 15627 }, // ⁌
+    { 16, 15, 19, 2, 16, 60, 15687 }, // ⁍
+    { 15, 15, 16, 0, 8, 57, 15747 }, // ⁎
+    { 7, 21, 8, 1, 17, 37, 15804 }, // ⁏
+    { 18, 31, 18, 0, 24, 140, 15841 }, // ⁐
+    { 15, 30, 16, 0, 23, 113, 15981 }, // ⁑
+    { 13, 23, 12, 0, 22, 75, 16094 }, // ⁒
+    { 28, 6, 29, 1, 11, 42, 16169 }, // ⁓
+    { 18, 7, 18, 0, 0, 32, 16211 }, // ⁔
+    { 16, 15, 16, 0, 15, 60, 16243 }, // ⁕
+    { 15, 23, 17, 1, 22, 87, 16303 }, // ⁖
+    { 27, 8, 27, 1, 21, 54, 16390 }, // ⁗
+    { 23, 23, 25, 1, 22, 133, 16444 }, // ⁘
+    { 23, 23, 25, 1, 22, 133, 16577 }, // ⁙
+    { 6, 23, 8, 1, 22, 35, 16710 }, // ⁚
+    { 18, 24, 20, 1, 23, 108, 16745 }, // ⁛
+    { 23, 23, 25, 1, 22, 133, 16853 }, // ⁜
+    { 6, 24, 8, 1, 23, 36, 16986 }, // ⁝
+    { 6, 23, 8, 1, 22, 35, 17022 }, // ⁞
+    { 0, 0, 6, 0, 0, 0, 17057 }, //  
+    { 0, 0, 18, 0, 0, 0, 17057 }, // ⁠
+    { 0, 0, 18, 0, 0, 0, 17057 }, // ⁡
+    { 0, 0, 18, 0, 0, 0, 17057 }, // ⁢
+    { 0, 0, 18, 0, 0, 0, 17057 }, // ⁣
+    { 0, 0, 18, 0, 0, 0, 17057 }, // ⁤
+    { 0, 0, 0, 0, 0, 0, 17057 }, // ⁦
+    { 0, 0, 0, 0, 0, 0, 17057 }, // ⁧
+    { 0, 0, 0, 0, 0, 0, 17057 }, // ⁨
+    { 0, 0, 0, 0, 0, 0, 17057 }, // ⁩
+    { 8, 25, 0, -4, 21, 50, 17057 }, // ⁪
+    { 8, 25, 0, -4, 21, 50, 17107 }, // ⁫
+    { 8, 25, 0, -4, 21, 50, 17157 }, // ⁬
+    { 8, 25, 0, -4, 21, 50, 17207 }, // ⁭
+    { 8, 25, 0, -4, 21, 50, 17257 }, // ⁮
+    { 8, 25, 0, -4, 21, 50, 17307 }, // ⁯
+    { 11, 14, 11, 0, 25, 39, 17357 }, // ⁰
+    { 4, 14, 6, 1, 22, 14, 17396 }, // ⁱ
+    { 11, 13, 11, 0, 25, 36, 17410 }, // ⁴
+    { 10, 14, 11, 1, 25, 35, 17446 }, // ⁵
+    { 11, 14, 11, 0, 25, 39, 17481 }, // ⁶
+    { 11, 13, 11, 0, 25, 36, 17520 }, // ⁷
+    { 11, 14, 11, 0, 25, 39, 17556 }, // ⁸
+    { 11, 14, 11, 0, 25, 39, 17595 }, // ⁹
+    { 9, 9, 10, 1, 22, 21, 17634 }, // ⁺
+    { 9, 3, 10, 1, 19, 7, 17655 }, // ⁻
+    { 9, 7, 10, 1, 21, 16, 17662 }, // ⁼
+    { 6, 17, 7, 1, 27, 26, 17678 }, // ⁽
+    { 6, 17, 7, 0, 27, 26, 17704 }, // ⁾
+    { 10, 11, 12, 1, 19, 28, 17730 }, // ⁿ
+    { 11, 14, 11, 0, 9, 39, 17758 }, // ₀
+    { 9, 13, 11, 0, 9, 30, 17797 }, // ₁
+    { 10, 13, 11, 0, 9, 33, 17827 }, // ₂
+    { 11, 14, 11, 0, 9, 39, 17860 }, // ₃
+    { 11, 13, 11, 0, 9, 36, 17899 }, // ₄
+    { 10, 14, 11, 1, 9, 35, 17935 }, // ₅
+    { 11, 14, 11, 0, 9, 39, 17970 }, // ₆
+    { 11, 13, 11, 0, 9, 36, 18009 }, // ₇
+    { 11, 14, 11, 0, 9, 39, 18045 }, // ₈
+    { 11, 14, 11, 0, 9, 39, 18084 }, // ₉
+    { 9, 9, 10, 1, 7, 21, 18123 }, // ₊
+    { 9, 3, 10, 1, 4, 7, 18144 }, // ₋
+    { 9, 7, 10, 1, 6, 16, 18151 }, // ₌
+    { 6, 17, 7, 1, 11, 26, 18167 }, // ₍
+    { 6, 17, 7, 0, 11, 26, 18193 }, // ₎
+    { 10, 10, 11, 0, 7, 25, 18219 }, // ₐ
+    { 11, 10, 11, 0, 7, 28, 18244 }, // ₑ
+    { 11, 10, 12, 0, 7, 28, 18272 }, // ₒ
+    { 11, 10, 11, 0, 7, 28, 18300 }, // ₓ
+    { 11, 10, 11, 0, 7, 28, 18328 }, // ₔ
+    { 10, 14, 12, 1, 11, 35, 18356 }, // ₕ
+    { 11, 14, 12, 1, 11, 39, 18391 }, // ₖ
+    { 4, 14, 6, 1, 11, 14, 18430 }, // ₗ
+    { 17, 10, 19, 1, 7, 43, 18444 }, // ₘ
+    { 10, 10, 12, 1, 7, 25, 18487 }, // ₙ
+    { 11, 14, 12, 1, 7, 39, 18512 }, // ₚ
+    { 9, 10, 10, 0, 7, 23, 18551 }, // ₛ
+    { 8, 12, 8, 0, 9, 24, 18574 }, // ₜ
+    { 17, 22, 17, 0, 22, 94, 18598 }, // ₠
+    { 18, 25, 18, 0, 23, 113, 18692 }, // ₡
+    { 16, 23, 17, 1, 22, 92, 18805 }, // ₢
+    { 16, 21, 17, 0, 21, 84, 18897 }, // ₣
+    { 16, 22, 17, 1, 22, 88, 18981 }, // ₤
+    { 25, 24, 28, 2, 20, 150, 19069 }, // ₥
+    { 17, 21, 17, 0, 21, 90, 19219 }, // ₦
+    { 23, 22, 26, 2, 21, 127, 19309 }, // ₧
+    { 24, 22, 27, 2, 21, 132, 19436 }, // ₨
+    { 22, 21, 22, 0, 21, 116, 19568 }, // ₩
+    { 23, 21, 27, 2, 21, 121, 19684 }, // ₪
+    { 18, 28, 19, 1, 23, 126, 19805 }, // ₫
+    { 17, 22, 17, 0, 21, 94, 19931 }, // €
+    { 17, 21, 17, 0, 21, 90, 20025 }, // ₭
+    { 17, 21, 17, 0, 21, 90, 20115 }, // ₮
+    { 29, 29, 29, 0, 22, 211, 20205 }, // ₯
+    { 17, 29, 18, 0, 22, 124, 20416 }, // ₰
+    { 17, 21, 17, 0, 21, 90, 20540 }, // ₱
+    { 18, 26, 21, 1, 23, 117, 20630 }, // ₲
+    { 19, 21, 19, 0, 21, 100, 20747 }, // ₳
+    { 17, 23, 17, 0, 22, 98, 20847 }, // ₴
+    { 17, 26, 19, 1, 23, 111, 20945 }, // ₵
+    { 20, 21, 20, 0, 20, 105, 21056 }, // ₶
+    { 21, 25, 21, 0, 22, 132, 21161 }, // ₷
+    { 17, 21, 17, 0, 21, 90, 21293 }, // ₸
+    { 15, 21, 17, 1, 21, 79, 21383 }, // ₹
+    { 16, 22, 17, 0, 21, 88, 21462 }, // ₺
+    { 24, 23, 24, 0, 22, 138, 21550 }, // ₻
+    { 24, 21, 26, 1, 21, 126, 21688 }, // ₼
+    { 17, 21, 18, 0, 21, 90, 21814 }, // ₽
+    { 21, 23, 23, 1, 23, 121, 21904 }, // ₾
+    { 14, 27, 17, 2, 24, 95, 22025 }, // ₿
+    { 14, 23, 15, 1, 17, 81, 22120 }, // ⃀
+    { 15, 4, 17, 1, 12, 15, 22201 }, // −
+    { 24, 23, 23, 0, 23, 138, 22216 }, // ﬀ
+    { 19, 23, 20, 0, 23, 110, 22354 }, // ﬁ
+    { 18, 23, 20, 0, 23, 104, 22464 }, // ﬂ
+    { 30, 23, 31, 0, 23, 173, 22568 }, // ﬃ
+    { 30, 23, 31, 0, 23, 173, 22741 }, // ﬄ
+    { 20, 24, 23, 2, 23, 120, 22914 }, // ﬅ
+    { 26, 24, 27, 1, 23, 156, 23034 }, // ﬆ
+    { 27, 28, 29, 1, 23, 189, 23190 }, // �
 };
 
 static const EpdUnicodeInterval notosans_14_boldIntervals[] = {
@@ -2796,31 +2814,297 @@ static const EpdUnicodeInterval notosans_14_boldIntervals[] = {
     { 0x2090, 0x209C, 0x33D },
     { 0x20A0, 0x20C0, 0x34A },
     { 0x2212, 0x2212, 0x36B },
-    { 0xFFFD, 0xFFFD, 0x36C },
+    { 0xFB00, 0xFB06, 0x36C },
+    { 0xFFFD, 0xFFFD, 0x373 },
 };
 
 static const EpdFontGroup notosans_14_boldGroups[] = {
-    { 0, 3524, 7057, 97, 0 },
-    { 3524, 3605, 8565, 96, 97 },
-    { 7129, 4624, 13237, 128, 193 },
-    { 11753, 1320, 1973, 112, 321 },
-    { 13073, 11988, 27864, 256, 433 },
-    { 25061, 2312, 4910, 111, 689 },
-    { 27373, 640, 1241, 42, 800 },
-    { 28013, 2096, 3603, 33, 842 },
-    { 30109, 16, 15, 1, 875 },
-    { 30125, 112, 189, 1, 876 },
+    { 0, 4937, 12137, 151, 2 },
+    { 4937, 3004, 6266, 66, 434 },
+    { 7941, 11566, 27846, 371, 0 },
+    { 19507, 10899, 23379, 296, 581 },
+};
+
+static const uint8_t notosans_14_boldGlyphGroups[884] = {
+    2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2,
+    2, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 2, 2,
+    2, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 0, 0, 3, 3, 3, 0, 0, 3, 3, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+};
+
+static const uint8_t notosans_14_boldKernLeftClasses[884] = {
+    0, 0, 0, 0, 2, 0, 0, 0, 63, 2, 27, 0, 0, 0, 6, 34,
+    6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 12, 0, 39, 16, 31, 56, 0, 0, 0, 0, 39, 22, 0,
+    0, 16, 43, 16, 0, 0, 13, 42, 37, 37, 39, 17, 64, 27, 0, 0,
+    0, 70, 0, 0, 29, 61, 0, 29, 49, 0, 0, 0, 0, 0, 0, 0,
+    0, 29, 29, 0, 24, 0, 61, 0, 32, 32, 71, 32, 0, 27, 0, 0,
+    0, 0, 68, 0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 30, 0, 0, 0,
+    55, 12, 12, 12, 12, 12, 12, 31, 39, 31, 31, 31, 31, 0, 0, 0,
+    0, 16, 0, 16, 16, 16, 16, 16, 0, 16, 42, 42, 42, 42, 17, 43,
+    0, 0, 0, 0, 0, 0, 0, 29, 0, 29, 29, 29, 29, 0, 0, 69,
+    69, 29, 0, 29, 29, 29, 29, 29, 0, 29, 0, 0, 0, 0, 32, 29,
+    32, 12, 0, 12, 0, 46, 0, 39, 0, 39, 0, 39, 0, 39, 0, 16,
+    21, 16, 0, 31, 29, 31, 29, 31, 29, 31, 29, 31, 29, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65, 0, 69, 0, 0, 73,
+    0, 0, 0, 0, 0, 0, 0, 39, 0, 71, 22, 0, 22, 0, 22, 21,
+    22, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 29, 16,
+    29, 16, 29, 31, 29, 0, 24, 0, 24, 0, 24, 0, 0, 0, 0, 0,
+    0, 0, 0, 13, 61, 13, 36, 13, 61, 42, 0, 42, 0, 42, 0, 42,
+    0, 42, 0, 42, 0, 37, 32, 17, 32, 17, 64, 0, 64, 0, 64, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 59, 59, 25, 15, 26, 42, 0, 0, 0, 18, 18, 25, 10, 0, 1,
+    0, 8, 0, 0, 15, 3, 59, 10, 0, 0, 0, 10, 0, 0, 0, 11,
+    0, 23, 26, 15, 1, 47, 10, 3, 0, 0, 3, 18, 0, 18, 11, 11,
+    0, 48, 57, 52, 38, 4, 5, 20, 52, 40, 40, 20, 40, 40, 40, 5,
+    40, 5, 51, 38, 14, 5, 20, 4, 40, 40, 4, 7, 40, 7, 5, 5,
+    40, 5, 5, 58, 45, 51, 66, 0, 67, 72, 7, 7, 60, 20, 40, 14,
+    40, 11, 50, 44, 7, 26, 51, 8, 41, 8, 41, 0, 0, 0, 0, 42,
+    0, 0, 5, 11, 5, 1, 50, 1, 50, 14, 14, 11, 5, 11, 5, 11,
+    50, 26, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 4, 44, 7, 23,
+    5, 9, 33, 19, 53, 0, 0, 35, 0, 42, 52, 35, 0, 10, 20, 10,
+    20, 10, 20, 3, 4, 19, 33, 0, 0, 0, 5, 26, 51, 9, 33, 28,
+    42, 28, 42, 35, 0, 3, 4, 3, 4, 0, 0, 0, 0, 40, 62, 40,
+    62, 0, 10, 20, 0, 0, 3, 4, 0, 0, 3, 4, 0, 0, 3, 4,
+    0, 8, 48, 8, 48, 59, 62, 59, 62, 11, 5, 11, 5, 10, 20, 42,
+    52, 0, 0, 0, 40, 0, 40, 11, 5, 11, 5, 11, 5, 11, 5, 1,
+    14, 1, 14, 1, 14, 0, 40, 9, 33, 0, 40, 19, 53, 35, 0, 10,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 34, 34, 34, 0, 0, 2, 2, 6, 0, 2, 2, 6,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 30, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 0, 0, 0,
+    0, 0, 0, 0,
+};
+
+static const uint8_t notosans_14_boldKernRightClasses[884] = {
+    0, 0, 0, 63, 5, 0, 0, 0, 51, 5, 0, 42, 0, 0, 2, 28,
+    2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 39, 0, 0,
+    0, 54, 0, 7, 0, 3, 0, 0, 0, 3, 0, 0, 43, 0, 0, 0,
+    0, 3, 0, 3, 0, 0, 18, 47, 30, 30, 60, 23, 0, 0, 0, 42,
+    0, 0, 0, 20, 58, 1, 1, 1, 0, 24, 58, 0, 69, 58, 58, 17,
+    17, 1, 17, 1, 17, 24, 0, 17, 22, 22, 22, 22, 51, 0, 0, 42,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 0, 0, 0,
+    0, 7, 7, 7, 7, 7, 7, 62, 3, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 3, 3, 3, 3, 3, 0, 3, 47, 47, 47, 47, 23, 0,
+    0, 1, 20, 20, 20, 20, 20, 20, 1, 1, 1, 1, 1, 0, 0, 0,
+    0, 0, 0, 1, 1, 1, 1, 1, 0, 1, 17, 17, 17, 17, 22, 58,
+    22, 7, 20, 7, 20, 7, 20, 3, 1, 3, 1, 3, 1, 3, 1, 0,
+    1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 3, 24, 3,
+    24, 3, 24, 3, 24, 0, 58, 0, 68, 0, 61, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 58, 17, 0, 58, 0, 58, 0, 58,
+    0, 58, 0, 0, 0, 17, 0, 17, 0, 0, 0, 0, 17, 3, 1, 3,
+    1, 3, 1, 3, 1, 0, 17, 0, 17, 0, 0, 0, 24, 0, 0, 0,
+    24, 0, 0, 18, 0, 18, 0, 18, 0, 47, 17, 47, 17, 47, 17, 47,
+    17, 47, 17, 47, 17, 30, 22, 23, 22, 23, 0, 51, 0, 51, 0, 51,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4, 0, 31, 66, 0, 0, 34, 27, 0, 4, 0, 0, 11,
+    0, 8, 0, 0, 0, 40, 0, 13, 67, 0, 0, 0, 27, 0, 0, 31,
+    0, 0, 31, 4, 11, 50, 13, 0, 16, 0, 0, 4, 0, 0, 67, 0,
+    53, 6, 59, 39, 39, 19, 15, 10, 33, 39, 39, 39, 29, 39, 39, 15,
+    39, 39, 15, 21, 14, 15, 10, 39, 9, 39, 39, 21, 39, 39, 33, 39,
+    56, 15, 15, 36, 39, 15, 64, 0, 65, 44, 29, 39, 36, 39, 39, 14,
+    39, 12, 48, 55, 0, 0, 25, 8, 19, 0, 25, 0, 0, 0, 25, 67,
+    0, 16, 0, 12, 6, 52, 48, 52, 48, 12, 6, 12, 6, 12, 6, 12,
+    48, 12, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 25, 55, 36, 0,
+    25, 0, 25, 55, 0, 0, 25, 13, 10, 67, 33, 0, 25, 0, 25, 0,
+    36, 37, 21, 0, 25, 0, 25, 0, 25, 12, 6, 12, 6, 4, 21, 46,
+    57, 46, 57, 13, 10, 37, 21, 16, 9, 16, 9, 0, 25, 35, 38, 35,
+    38, 0, 13, 10, 0, 25, 45, 19, 0, 25, 0, 25, 16, 9, 0, 25,
+    0, 8, 41, 8, 41, 8, 41, 0, 6, 0, 41, 0, 41, 13, 10, 67,
+    33, 0, 0, 0, 39, 0, 39, 12, 6, 12, 6, 12, 6, 67, 33, 11,
+    14, 11, 14, 11, 14, 16, 9, 0, 25, 0, 39, 55, 0, 13, 10, 13,
+    10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 28, 28, 28, 0, 0, 32, 5, 2, 0, 32, 5, 2,
+    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 49, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0,
+};
+
+static const int8_t notosans_14_boldKernMatrix[5180] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 1, -1, 0, -4, -1, -1, 0, 0, 0, 0, -2, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, -1, -2, -1, -1, 0, -1, 0, -1, 0, -1, 1, 0, -1, 0, -3, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0,
+    0, -2, 0, 0, 1, 0, -1, -2, -2, 0, 0, 1, 0, 1, 1, 0, 0, -1, 1, -2, -1, 1, 0, 0, -1, 0, 0, -1, 0, -1, 1, 0, 0, 1, 0, 0, 1, 1, 0, 0, -2, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, -2, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 1, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 1, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 1, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, -1, 0, 0, 0, 0, -2, 0, -1, -1, 0, 0, 0, -2, 0, -2, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 2, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, -2, 0, 0, 0, -1, -1, -1, 0, 0, -1, 0, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, -2, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 1, 0, -2, 0, -2, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, -2, 0, -1, 0, 0, 0, -1, -2, -1, -1, 0, 0, -1, 0, -1, 0, -1, 0, 0, -2, 0, -1, -2, 0, 0, 0, -1, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, -2, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 1, 0, -2, 0, -1, 0, -2, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 1, 1, -1, 0, -2, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -2, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, -3, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 1, 0, -1, 0, -2, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, 1, 1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 1, 0, 0, 0, 0, 3, 0, 0, 0, 0, 2, 0,
+    0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -4, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -5, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, -2, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 3, 2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, -2, 0, 0, 0, -1, 0, -2, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0,
+    0, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -2, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -4, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 1, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const EpdLigaturePair notosans_14_boldLigatures[] = {
+    { 0x66, 0x66, 0xFB00 },
+    { 0x66, 0x69, 0xFB01 },
+    { 0x66, 0x6C, 0xFB02 },
+    { 0xFB00, 0x69, 0xFB03 },
+    { 0xFB00, 0x6C, 0xFB04 },
+};
+
+static const uint16_t notosans_14_boldGlyphLookup[368] = {
+    0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0001, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, 0x0010, 0x0011,
+    0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, 0x0020, 0x0021,
+    0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, 0x0030, 0x0031,
+    0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, 0x0040, 0x0041,
+    0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051,
+    0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, 0x0060, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070,
+    0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, 0x0080,
+    0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F, 0x0090,
+    0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F, 0x00A0,
+    0x00A1, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF, 0x00B0,
+    0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF, 0x00C0,
+    0x02B1, 0x02B2, 0x02B3, 0x02B4, 0x02B5, 0x02B6, 0x02B7, 0x02B8, 0x02B9, 0x02BA, 0x02BB, 0x02BC, 0x02BD, 0x02BE, 0x02BF, 0x02C0,
+    0x02C1, 0x02C2, 0x02C3, 0x02C4, 0x02C5, 0x02C6, 0x02C7, 0x02C8, 0x02C9, 0x02CA, 0x02CB, 0x02CC, 0x02CD, 0x02CE, 0x02CF, 0x02D0,
+    0x02D1, 0x02D2, 0x02D3, 0x02D4, 0x02D5, 0x02D6, 0x02D7, 0x02D8, 0x02D9, 0x02DA, 0x02DB, 0x02DC, 0x02DD, 0x02DE, 0x02DF, 0x02E0,
+    0x02E1, 0x02E2, 0x02E3, 0x02E4, 0x02E5, 0x02E6, 0x02E7, 0x02E8, 0x02E9, 0x02EA, 0x02EB, 0x02EC, 0x02ED, 0x02EE, 0x02EF, 0x02F0,
+    0x02F1, 0x02F2, 0x02F3, 0x02F4, 0x02F5, 0x02F6, 0x02F7, 0x02F8, 0x02F9, 0x02FA, 0x02FB, 0x02FC, 0x02FD, 0x02FE, 0x02FF, 0x0300,
+    0x0301, 0x0302, 0x0303, 0x0304, 0x0305, 0x0306, 0x0307, 0x0308, 0x0309, 0x030A, 0x030B, 0x030C, 0x030D, 0x030E, 0x030F, 0x0310,
+    0x0311, 0x0312, 0x0313, 0x0314, 0x0315, 0xFFFF, 0x0316, 0x0317, 0x0318, 0x0319, 0x031A, 0x031B, 0x031C, 0x031D, 0x031E, 0x031F,
 };
 
 static const EpdFontData notosans_14_bold = {
     notosans_14_boldBitmaps,
     notosans_14_boldGlyphs,
     notosans_14_boldIntervals,
-    15,
+    16,
     40,
     32,
     -9,
     true,
     notosans_14_boldGroups,
-    10,
+    4,
+    notosans_14_boldKernLeftClasses,
+    notosans_14_boldKernRightClasses,
+    notosans_14_boldKernMatrix,
+    70,
+    notosans_14_boldLigatures,
+    5,
+    0x4000000001ull,
+    notosans_14_boldGlyphLookup,
+    notosans_14_boldGlyphGroups,
+    false,
+    nullptr,
 };
@@ -3,2122 +3,2156 @@
  * name: notosans_14_bolditalic
  * size: 14
  * mode: 2-bit  compressed: true
- * Command used: fontconvert.py notosans_14_bolditalic 14 ../builtinFonts/source/NotoSans/NotoSans-BoldItalic.ttf --2bit --compress
+ * Command used: fontconvert.py notosans_14_bolditalic 14 ../builtinFonts/source/NotoSans/NotoSans-BoldItalic.ttf --2bit --compress --frequency-corpus ../../../test/hyphenation_eval/resources/english_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/french_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/german_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/italian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/russian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/spanish_hyphenation_tests.txt
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t notosans_14_bolditalicBitmaps[33754] = {
-    0x8D, 0x59, 0x3F, 0xAC, 0xDF, 0x56, 0x15, 0xBE, 0xB6, 0x93, 0x58, 0xAD, 0x07, 0x33, 0xB4, 0x02,
-    0xA5, 0x12, 0x5E, 0x51, 0x80, 0x7A, 0x65, 0x40, 0x5C, 0x87, 0x08, 0x3A, 0x30, 0x24, 0x03, 0xA9,
-    0x90, 0x3A, 0x94, 0x81, 0x05, 0x96, 0xB7, 0x30, 0x30, 0xC5, 0xAE, 0x3A, 0x20, 0xC1, 0xD0, 0x08,
-    0x09, 0x16, 0x86, 0x66, 0x08, 0x52, 0xF9, 0x75, 0xC8, 0xC2, 0x08, 0xEF, 0xBA, 0xC9, 0xD0, 0xA1,
-    0x43, 0x4D, 0x22, 0xC1, 0xD0, 0x21, 0x0E, 0x4D, 0x89, 0x68, 0x87, 0xE7, 0x36, 0x7E, 0xC4, 0x49,
-    0xEC, 0x7B, 0xF8, 0xBE, 0x73, 0xFD, 0xFB, 0xBD, 0x97, 0xB4, 0x02, 0x7E, 0x89, 0x7F, 0xEF, 0xD9,
-    0xBE, 0x7F, 0xCF, 0xF9, 0xCE, 0x77, 0xBE, 0x73, 0x9F, 0x71, 0x6D, 0x3E, 0x1B, 0x69, 0xF2, 0x31,
-    0x12, 0x53, 0x0E, 0xB1, 0x37, 0xB6, 0x4B, 0x66, 0x63, 0xDB, 0x74, 0x32, 0xAE, 0xCA, 0x07, 0x23,
-    0x46, 0x3F, 0x27, 0x0D, 0x9E, 0xBA, 0x2E, 0x5B, 0x4C, 0xDD, 0x98, 0xCA, 0xE4, 0x77, 0x96, 0xE2,
-    0xE6, 0x5C, 0x5C, 0x9F, 0xCB, 0x1B, 0x53, 0xF9, 0xFA, 0x68, 0xCF, 0x0D, 0x36, 0x19, 0xCE, 0xC4,
-    0x97, 0x8D, 0xF9, 0x73, 0xDE, 0x9A, 0x64, 0xB0, 0xC6, 0x14, 0xAF, 0x4D, 0xC6, 0xFC, 0x25, 0xEF,
-    0xD6, 0xBB, 0x77, 0x30, 0x9E, 0x88, 0x5C, 0xC7, 0x25, 0x19, 0xAE, 0xC9, 0x5C, 0x4A, 0x7B, 0x13,
-    0x8F, 0x16, 0x83, 0xB5, 0x98, 0x10, 0x8F, 0xFE, 0xCA, 0x77, 0x2F, 0xE1, 0x9A, 0x4D, 0x9D, 0x0E,
-    0x26, 0x9A, 0xCA, 0xC6, 0x64, 0xDD, 0x62, 0x0C, 0xC6, 0x36, 0x66, 0x2E, 0x70, 0xD7, 0xFF, 0xC5,
-    0xAC, 0x9F, 0x3C, 0x5C, 0xA7, 0xE4, 0x2E, 0xFB, 0x1A, 0x91, 0x25, 0x96, 0xFD, 0x39, 0x59, 0xBE,
-    0x7D, 0x22, 0x99, 0x7F, 0x61, 0x12, 0xFF, 0x27, 0x13, 0x0B, 0x7A, 0x89, 0x47, 0x77, 0xE9, 0x4C,
-    0x8A, 0x9B, 0x18, 0x93, 0x26, 0xEF, 0xE3, 0x7A, 0x6F, 0xFA, 0x79, 0xFA, 0xC6, 0x54, 0x1F, 0xC8,
-    0x50, 0x8B, 0xF4, 0xE8, 0x5E, 0x9D, 0x72, 0x77, 0x8D, 0xF9, 0x2A, 0x86, 0xFC, 0x26, 0xAE, 0xAF,
-    0x6D, 0xE7, 0x88, 0xB1, 0xF9, 0x4B, 0xE8, 0x8E, 0x2D, 0x24, 0xB2, 0x18, 0x5B, 0x15, 0xB7, 0xA6,
-    0x18, 0xFB, 0xC8, 0xFB, 0xA2, 0x4D, 0x26, 0xDB, 0xCC, 0x26, 0xEF, 0x3C, 0x76, 0x58, 0xA7, 0xE3,
-    0xBE, 0x89, 0xE6, 0xF2, 0xDD, 0x4F, 0xF7, 0xD3, 0x43, 0x6F, 0x4B, 0xC9, 0xE5, 0xFE, 0xA1, 0xF8,
-    0x52, 0xF6, 0xDE, 0xB8, 0x3F, 0x17, 0x77, 0xE6, 0xFA, 0x07, 0x83, 0xC9, 0x6F, 0xCE, 0x65, 0x6B,
-    0x7C, 0xDE, 0x8B, 0xC9, 0x06, 0x7B, 0x6E, 0x32, 0xB5, 0x59, 0x8A, 0x2E, 0x19, 0x93, 0xD1, 0x19,
-    0xDB, 0xE4, 0x32, 0xC6, 0xB3, 0x29, 0xA5, 0x29, 0x5A, 0x53, 0x4E, 0xE6, 0x89, 0x4F, 0x09, 0x0B,
-    0x98, 0x1A, 0x7B, 0xC0, 0xD7, 0x8C, 0xDB, 0x3B, 0x58, 0x55, 0x3E, 0x58, 0x98, 0x79, 0xCE, 0xB9,
-    0xC3, 0x0C, 0x0F, 0xED, 0x07, 0xF8, 0xCA, 0xB0, 0x46, 0x13, 0x61, 0x93, 0x58, 0xF8, 0x98, 0xCC,
-    0x89, 0x48, 0xEC, 0x13, 0xA9, 0x7B, 0x89, 0x25, 0x5D, 0xA4, 0x91, 0xC6, 0x49, 0x6B, 0xBB, 0x5C,
-    0xDA, 0x7C, 0x8A, 0xA4, 0x4B, 0xE4, 0x77, 0x32, 0x62, 0x48, 0x18, 0x2F, 0xC7, 0xD7, 0x00, 0xF7,
-    0xBC, 0x04, 0x63, 0x5D, 0xA0, 0x5D, 0xE1, 0x5D, 0xB8, 0x16, 0x7E, 0x8D, 0xAF, 0x98, 0x64, 0x02,
-    0x1A, 0xE0, 0xFC, 0xB2, 0x8B, 0x3C, 0xE6, 0x35, 0x75, 0x85, 0x9B, 0xA2, 0x37, 0xCE, 0xAC, 0x3F,
-    0x2B, 0xAC, 0x1C, 0xCF, 0xB1, 0x20, 0xE1, 0xA3, 0xF0, 0xAB, 0x33, 0xD1, 0xC2, 0xAE, 0xB8, 0xC3,
-    0x96, 0xCE, 0x84, 0x9D, 0xC0, 0xA9, 0x78, 0x84, 0xE6, 0xD1, 0xCC, 0xD7, 0xC6, 0xEB, 0x7F, 0x39,
-    0xF6, 0x5F, 0x9F, 0xE0, 0x15, 0xDA, 0x60, 0x28, 0x60, 0x30, 0x1B, 0x38, 0x44, 0xD9, 0xC1, 0x46,
-    0x78, 0x1F, 0x2F, 0x7C, 0x96, 0xF7, 0xE6, 0x74, 0xB3, 0xA2, 0x00, 0x56, 0x01, 0x82, 0x30, 0xDE,
-    0x8B, 0x40, 0x93, 0x5C, 0xAB, 0x52, 0xF1, 0xEE, 0xAC, 0x83, 0x21, 0x6A, 0x19, 0x53, 0x79, 0xAD,
-    0x72, 0xCE, 0xA4, 0xF3, 0xBE, 0xC9, 0xDE, 0x99, 0xCD, 0xC9, 0x64, 0x34, 0xE6, 0x19, 0x62, 0xB9,
-    0x42, 0x27, 0xFC, 0x84, 0xC9, 0x08, 0x2C, 0x00, 0x16, 0xB7, 0x29, 0x6C, 0xF0, 0xA6, 0x88, 0x87,
-    0x41, 0xA6, 0x8B, 0xF5, 0xC5, 0xEA, 0xC9, 0xB7, 0xC0, 0x35, 0x4C, 0xFB, 0xC3, 0x64, 0x49, 0xE7,
-    0x6C, 0xCC, 0x87, 0xA2, 0xB5, 0x8D, 0x35, 0x67, 0x36, 0xE7, 0xE5, 0x43, 0x39, 0x94, 0xF9, 0x64,
-    0x32, 0xBB, 0x0F, 0xE6, 0xBA, 0xC1, 0xB8, 0x1A, 0x2F, 0x08, 0x11, 0xDA, 0x80, 0xD6, 0xE1, 0xEA,
-    0x4D, 0x86, 0x89, 0xB1, 0x1D, 0x2E, 0x3F, 0x34, 0xF8, 0x5F, 0x8D, 0xA2, 0xA7, 0x1B, 0x1D, 0x7D,
-    0x62, 0x69, 0x4C, 0xA1, 0x8E, 0x43, 0xD8, 0x7E, 0xB0, 0x24, 0x92, 0xF8, 0x14, 0xD0, 0xCF, 0x67,
-    0x5C, 0x63, 0x2C, 0x05, 0x42, 0x98, 0x61, 0x6C, 0xFB, 0x84, 0xD7, 0x62, 0xBB, 0x74, 0xB6, 0x5D,
-    0x86, 0x2B, 0x9F, 0x6C, 0x57, 0x0C, 0xB6, 0xB7, 0x43, 0x79, 0x28, 0x6D, 0x01, 0xD0, 0x67, 0x08,
-    0x0E, 0x20, 0xC5, 0x98, 0x13, 0x1C, 0xD8, 0xE1, 0xF7, 0x36, 0x95, 0x3E, 0x93, 0xA9, 0x90, 0x25,
-    0xF7, 0x12, 0x2F, 0x75, 0xFB, 0xAD, 0xB2, 0x37, 0xF9, 0xC8, 0x75, 0x71, 0x49, 0x35, 0xC0, 0x79,
-    0xFC, 0xDE, 0xB5, 0xC6, 0x1E, 0xBF, 0x0F, 0x1F, 0x07, 0x17, 0x0B, 0xF1, 0xC5, 0x15, 0x7E, 0x22,
-    0x55, 0x5E, 0xD9, 0x3E, 0x32, 0x39, 0x60, 0x99, 0xEC, 0xB6, 0xD6, 0x68, 0x67, 0x10, 0x0A, 0x7E,
-    0xDF, 0x5E, 0x2D, 0xDE, 0xF1, 0x6A, 0x70, 0x55, 0x18, 0xE2, 0xE3, 0x4D, 0x05, 0x9F, 0xF4, 0x70,
-    0xC8, 0x58, 0x72, 0x2C, 0xFD, 0xBC, 0x20, 0x97, 0x23, 0x78, 0x28, 0xE6, 0x03, 0xFF, 0xAA, 0x37,
-    0x3F, 0x4E, 0x00, 0x19, 0xB0, 0x96, 0x8E, 0x8D, 0x48, 0x88, 0xDC, 0x88, 0x80, 0x6D, 0x8C, 0x5D,
-    0x18, 0x2E, 0x98, 0xA2, 0xA4, 0x0F, 0xC7, 0xED, 0x55, 0xE1, 0xFE, 0xE1, 0xF7, 0xA4, 0xC7, 0xC0,
-    0x2D, 0x91, 0xBF, 0xC7, 0xED, 0x3F, 0xA7, 0x23, 0x73, 0x4D, 0x5C, 0x87, 0x43, 0x87, 0x7A, 0x66,
-    0x6F, 0x13, 0x46, 0x3A, 0x00, 0xF8, 0xDE, 0x07, 0x06, 0x6F, 0x01, 0xEE, 0x88, 0xBD, 0xA2, 0x77,
-    0x0D, 0xC2, 0xAF, 0xCB, 0x87, 0x7C, 0xC8, 0xFC, 0x35, 0xFF, 0x3A, 0x83, 0x87, 0xA4, 0x75, 0x66,
-    0xE3, 0xFE, 0x15, 0x5C, 0x99, 0xCE, 0x61, 0x4D, 0x06, 0xFB, 0x40, 0x50, 0x6B, 0x80, 0xC1, 0xB4,
-    0xD2, 0x63, 0xD9, 0xA3, 0xFA, 0x75, 0xE7, 0x78, 0x3A, 0x1D, 0x6E, 0x88, 0x18, 0x80, 0xD8, 0xA9,
-    0x39, 0xF5, 0x32, 0xD7, 0x50, 0x8C, 0x61, 0x43, 0x3A, 0x40, 0xDD, 0x55, 0x06, 0x4E, 0xFB, 0xAD,
-    0x9B, 0xC0, 0x9B, 0x70, 0x33, 0x02, 0xBC, 0x04, 0xEB, 0x81, 0x92, 0xD7, 0x4F, 0xE4, 0x16, 0xCC,
-    0x30, 0x07, 0x48, 0x3C, 0xFC, 0x51, 0x22, 0x6A, 0x09, 0x5D, 0x49, 0xD1, 0xFF, 0x04, 0xDC, 0x20,
-    0x15, 0x38, 0xAE, 0x23, 0xD7, 0xB9, 0xA1, 0x1C, 0x5C, 0x5B, 0x0C, 0xAE, 0xC1, 0x55, 0xF1, 0x67,
-    0xD9, 0xBB, 0xB6, 0xEE, 0xEA, 0x8F, 0x40, 0x0D, 0xBA, 0x50, 0xC4, 0x9E, 0xF4, 0x0A, 0x09, 0xB2,
-    0x74, 0xB2, 0x1A, 0x6A, 0xB0, 0x5C, 0xB9, 0x41, 0xAA, 0xD0, 0xCD, 0xA9, 0xD1, 0x65, 0x5D, 0x1F,
-    0xAD, 0x5C, 0x33, 0x0E, 0xFB, 0x60, 0xED, 0x62, 0x6D, 0x88, 0x5C, 0xB1, 0x6B, 0x18, 0xA9, 0x75,
-    0x57, 0x8F, 0xAF, 0xAB, 0xC6, 0x80, 0xD8, 0x4C, 0xAB, 0x1B, 0x92, 0x73, 0x02, 0xAC, 0xDB, 0xB6,
-    0xEC, 0x61, 0xD4, 0x09, 0x31, 0x2E, 0x2F, 0x91, 0x0E, 0x17, 0xE5, 0xEC, 0x18, 0x3F, 0x13, 0x45,
-    0x14, 0x50, 0xEE, 0x31, 0x27, 0x32, 0x55, 0xCF, 0x0C, 0x95, 0x0F, 0x24, 0x38, 0x8C, 0x8F, 0xCC,
-    0xD2, 0xD0, 0xC6, 0x30, 0x41, 0x15, 0x28, 0x6C, 0x05, 0x62, 0x21, 0x33, 0xE1, 0x92, 0x2F, 0x35,
-    0xB6, 0x6D, 0x6F, 0xA1, 0xF3, 0xF9, 0x01, 0x81, 0x01, 0x06, 0xC4, 0x7C, 0xB7, 0xD0, 0xF9, 0x3C,
-    0x4C, 0x8A, 0x58, 0x18, 0x4A, 0xA9, 0x9B, 0xD3, 0xBF, 0x59, 0x82, 0xD5, 0xB0, 0xD8, 0x6C, 0x7E,
-    0xE6, 0xFB, 0xD2, 0x59, 0xB8, 0x46, 0xDD, 0x36, 0x6D, 0x51, 0x12, 0xA1, 0x0F, 0xFE, 0x2D, 0xE6,
-    0xEA, 0xF1, 0xA0, 0x3C, 0x09, 0x87, 0xBA, 0x0E, 0x86, 0x6C, 0x4E, 0x84, 0x46, 0x70, 0x18, 0xDC,
-    0x60, 0xBB, 0x27, 0x9B, 0x85, 0xCF, 0xF3, 0x24, 0xD0, 0x1A, 0x18, 0x02, 0xD5, 0x95, 0x2D, 0x48,
-    0xE9, 0xD2, 0xEE, 0xD5, 0x15, 0x58, 0x10, 0x73, 0x7B, 0xF5, 0x01, 0x96, 0x5F, 0x7A, 0x78, 0xA1,
-    0x31, 0x75, 0x0F, 0x6B, 0xDD, 0x55, 0x3F, 0x33, 0x47, 0xE0, 0xD9, 0x88, 0x07, 0x30, 0xF7, 0x1E,
-    0xAC, 0xFA, 0x2C, 0x3B, 0xFE, 0x6C, 0xB3, 0xF9, 0x03, 0xDC, 0x74, 0x0F, 0xD7, 0xAF, 0x36, 0x9B,
-    0x3F, 0xAE, 0xC3, 0x1D, 0xE7, 0xB4, 0xAD, 0xD5, 0x61, 0xFF, 0x14, 0x0E, 0x2A, 0x74, 0xA8, 0x0A,
-    0x43, 0x75, 0xEA, 0x09, 0x85, 0x7C, 0x41, 0x5B, 0xF7, 0x9C, 0xC6, 0xF9, 0x0A, 0x13, 0x45, 0x4C,
-    0x9C, 0x78, 0xF7, 0x95, 0x63, 0xAB, 0x77, 0x13, 0x5D, 0x01, 0xAB, 0x95, 0xBF, 0x93, 0x53, 0xDC,
-    0x21, 0x20, 0x0C, 0x48, 0x60, 0xCD, 0x79, 0xF8, 0xBF, 0x10, 0x7C, 0x24, 0x32, 0xBF, 0xF3, 0x74,
-    0xC5, 0xFB, 0x18, 0xB3, 0x21, 0xE6, 0x89, 0x7A, 0xF2, 0x24, 0x32, 0xF7, 0x65, 0x82, 0x80, 0x09,
-    0x9A, 0xF9, 0x07, 0xBE, 0xBB, 0x0B, 0xF8, 0x90, 0x1E, 0xD2, 0x09, 0x59, 0x02, 0x9C, 0x0E, 0x28,
-    0x48, 0xBF, 0x14, 0x6D, 0x2D, 0xC3, 0xBE, 0x7D, 0x4D, 0x5E, 0xED, 0xF7, 0x6D, 0x32, 0xE5, 0xDD,
-    0x25, 0x88, 0x83, 0xBC, 0xDD, 0xDF, 0x67, 0x16, 0x5E, 0xF6, 0xF3, 0xAE, 0x6C, 0xE6, 0xFD, 0xBC,
-    0xB5, 0xDF, 0xC5, 0x77, 0xE7, 0x90, 0x89, 0xF3, 0xC7, 0x72, 0xAD, 0xAF, 0x53, 0xB9, 0x2D, 0x8D,
-    0x3D, 0x0B, 0x72, 0x84, 0x91, 0x35, 0x55, 0x0C, 0x6A, 0x12, 0x5F, 0x7D, 0x99, 0x24, 0x23, 0xCA,
-    0x0D, 0x42, 0x58, 0x46, 0x9B, 0xCB, 0x7C, 0x93, 0x68, 0xB0, 0x6A, 0xD4, 0x4E, 0x04, 0x3F, 0x9A,
-    0xDB, 0x83, 0x16, 0x74, 0xEC, 0xD0, 0xF7, 0x33, 0xEC, 0xC7, 0x21, 0x8B, 0x27, 0x73, 0xD1, 0x21,
-    0x1B, 0xD5, 0x55, 0x24, 0xCC, 0x86, 0x23, 0x90, 0x5A, 0x7F, 0x7C, 0xAD, 0xD7, 0x30, 0x29, 0x44,
-    0x75, 0x88, 0xCC, 0x29, 0x93, 0x20, 0xA2, 0xC1, 0xBE, 0xC3, 0xA4, 0x76, 0x1E, 0x82, 0x03, 0x4C,
-    0x6A, 0x32, 0xE4, 0x51, 0x38, 0x31, 0x91, 0x90, 0x75, 0xDB, 0x8C, 0x5B, 0xC7, 0x12, 0x07, 0xD2,
-    0x36, 0x48, 0xC1, 0xF6, 0xC5, 0x90, 0x22, 0xBC, 0xDF, 0x0E, 0xD1, 0x9A, 0x90, 0x11, 0xF8, 0x0B,
-    0x9F, 0x19, 0x50, 0xCE, 0x08, 0x43, 0x03, 0xFA, 0x55, 0x31, 0x16, 0xC0, 0x56, 0x84, 0x76, 0x3D,
-    0x69, 0x31, 0xE1, 0x30, 0xC4, 0xE9, 0x2E, 0x3F, 0x3C, 0x34, 0x8C, 0x07, 0x1A, 0x15, 0x61, 0xE4,
-    0xA1, 0xEF, 0x04, 0x18, 0x01, 0x84, 0x0C, 0x89, 0x41, 0xA3, 0x53, 0xB9, 0x97, 0xA1, 0xA9, 0xFC,
-    0x43, 0x27, 0x2A, 0xE5, 0x9A, 0x74, 0xD9, 0x3D, 0xEA, 0x8D, 0xB2, 0x21, 0xF6, 0xF9, 0xD1, 0x35,
-    0xA3, 0x54, 0xAE, 0x0B, 0x8A, 0xC4, 0xA3, 0xDD, 0xF3, 0x9C, 0xC8, 0xD2, 0x7F, 0x9C, 0x23, 0xE5,
-    0xDB, 0x52, 0x67, 0x6B, 0xEA, 0x01, 0xA1, 0x51, 0xF7, 0xD4, 0x8D, 0x4D, 0x8D, 0xD0, 0xC6, 0xD2,
-    0xB3, 0x19, 0xD4, 0x5F, 0x82, 0x30, 0xF1, 0x08, 0x02, 0xC1, 0xC3, 0x3A, 0xC5, 0x08, 0x9E, 0x70,
-    0xAD, 0x34, 0xA9, 0x47, 0x73, 0x3B, 0x60, 0xE3, 0x68, 0xFE, 0x89, 0xD2, 0xBA, 0x06, 0x32, 0x39,
-    0x7C, 0xD2, 0x39, 0xF4, 0xB6, 0xC7, 0x14, 0xA3, 0x52, 0x3E, 0xFD, 0xC5, 0xE5, 0xEE, 0x58, 0x56,
-    0x36, 0x57, 0xA9, 0xFD, 0x8C, 0xDD, 0xB2, 0xEC, 0x8E, 0x7A, 0xD7, 0x96, 0x05, 0x5B, 0xFA, 0xCD,
-    0x95, 0xD0, 0x5D, 0x6D, 0xA5, 0xAF, 0xC2, 0xC8, 0xDD, 0x7F, 0x19, 0x99, 0x83, 0x1C, 0x1F, 0x99,
-    0x44, 0xF0, 0xB9, 0x91, 0x8F, 0x33, 0xBD, 0xDD, 0x71, 0x5B, 0xB0, 0xD3, 0xCA, 0x4A, 0x18, 0xDB,
-    0x5F, 0x43, 0x5A, 0xAD, 0xE2, 0xAA, 0x1E, 0xB6, 0x5E, 0x98, 0x8E, 0xBC, 0xB0, 0xD9, 0xE4, 0x53,
-    0x2A, 0xC8, 0xCE, 0x25, 0x14, 0x70, 0xE5, 0xA0, 0xD5, 0x30, 0x2C, 0xBC, 0x00, 0x8E, 0xEB, 0xE9,
-    0x71, 0xE8, 0x71, 0x78, 0xC1, 0x0D, 0x34, 0x0E, 0xD9, 0x52, 0xB3, 0xC5, 0xE5, 0x95, 0xFF, 0x31,
-    0x27, 0x64, 0x3A, 0xEC, 0xD5, 0xD1, 0xAE, 0x83, 0xDA, 0x1B, 0x2B, 0x54, 0x1D, 0x8F, 0xCE, 0x7C,
-    0xD3, 0xAE, 0x6F, 0x36, 0xD7, 0x68, 0x80, 0x60, 0x01, 0xBC, 0x91, 0x60, 0xAD, 0xD0, 0x87, 0xBE,
-    0x4B, 0xD6, 0x3E, 0xD8, 0x57, 0xBD, 0xBE, 0xF1, 0xFA, 0xA6, 0xA2, 0x93, 0xBA, 0x90, 0x8B, 0xA8,
-    0x0F, 0xC8, 0x89, 0x2D, 0xB9, 0x81, 0x50, 0x11, 0x35, 0x04, 0xAD, 0x85, 0xD5, 0x32, 0x67, 0x21,
-    0xB5, 0xD1, 0x2A, 0xAE, 0xD1, 0x94, 0x8F, 0x4E, 0xC5, 0x10, 0xC4, 0x03, 0xE1, 0xAC, 0xBD, 0x1D,
-    0x53, 0x1C, 0x85, 0x9C, 0xC2, 0x4C, 0x94, 0x1D, 0xD4, 0x9A, 0x30, 0x08, 0x51, 0xC9, 0x61, 0xEB,
-    0x56, 0x3B, 0x65, 0x47, 0x8D, 0x38, 0x68, 0x19, 0xC8, 0x39, 0x59, 0x79, 0x1A, 0x8D, 0x38, 0x31,
-    0xE7, 0xC1, 0xFA, 0x60, 0xD8, 0xD3, 0x8E, 0x55, 0x06, 0x8C, 0x34, 0x2B, 0x6F, 0x9A, 0x60, 0x21,
-    0xB4, 0x41, 0xA6, 0x90, 0x2A, 0x85, 0x1D, 0x9B, 0x58, 0x98, 0x8B, 0x00, 0x45, 0x68, 0x97, 0x0E,
-    0x5F, 0xF9, 0x20, 0x5C, 0x30, 0xF2, 0x52, 0xEC, 0x19, 0x24, 0xE2, 0x7A, 0xA2, 0x83, 0x39, 0x8C,
-    0x41, 0x95, 0x92, 0x28, 0x28, 0xAD, 0x8C, 0xE6, 0x28, 0xF4, 0x21, 0x87, 0x0D, 0x98, 0x32, 0x45,
-    0xE8, 0xD1, 0xF7, 0xB5, 0xDA, 0x99, 0x22, 0x59, 0x21, 0xC3, 0x85, 0xCC, 0xBA, 0x34, 0xE6, 0x60,
-    0x4C, 0x75, 0xCC, 0x48, 0xFE, 0x8B, 0x8C, 0x34, 0x1E, 0x19, 0x69, 0xF3, 0x16, 0xC2, 0xE8, 0x06,
-    0x22, 0x89, 0x25, 0x89, 0xB1, 0x14, 0x55, 0xA0, 0x16, 0x2C, 0xD4, 0x93, 0x9E, 0x53, 0xE9, 0x32,
-    0xDC, 0x10, 0x4F, 0x70, 0x0E, 0x54, 0xBC, 0xB4, 0xC9, 0xE3, 0xC9, 0x78, 0x04, 0x1C, 0x52, 0xF9,
-    0xED, 0x2E, 0xFF, 0x64, 0x8C, 0x97, 0x25, 0x9A, 0x41, 0x25, 0xEF, 0x77, 0xF6, 0x8D, 0x21, 0x99,
-    0x7D, 0xFA, 0x29, 0x7C, 0xFA, 0xEB, 0xDE, 0x97, 0x1D, 0x78, 0xB1, 0xB8, 0x81, 0x0A, 0x2E, 0xFB,
-    0x70, 0x42, 0xF6, 0x1B, 0x5C, 0x8D, 0x45, 0x0A, 0xD4, 0x5E, 0xDD, 0x14, 0x7D, 0x0D, 0x4D, 0x1B,
-    0x2D, 0x29, 0xC3, 0xB3, 0x6C, 0x6B, 0xC8, 0x9A, 0x64, 0x4E, 0x3D, 0x73, 0x58, 0x6B, 0x5B, 0xD2,
-    0xB5, 0x1D, 0x29, 0xC3, 0x91, 0x6F, 0x00, 0x25, 0x2E, 0x80, 0x89, 0x83, 0x29, 0x1A, 0xE9, 0x0B,
-    0x34, 0x85, 0x71, 0x4C, 0x7E, 0x30, 0x32, 0xA7, 0xED, 0xF5, 0x45, 0x1F, 0x2F, 0x48, 0x85, 0x48,
-    0x6E, 0x90, 0x8F, 0xC6, 0x5E, 0xF7, 0xF9, 0x80, 0x8C, 0x39, 0x6B, 0xB2, 0xFE, 0x94, 0xED, 0xCB,
-    0x7B, 0x14, 0x40, 0xF5, 0x01, 0x2B, 0x0A, 0xA1, 0x98, 0xA2, 0xAF, 0x1C, 0x64, 0x7B, 0xCF, 0x2A,
-    0x42, 0x58, 0x71, 0x96, 0x2C, 0x3F, 0x09, 0x97, 0x23, 0x75, 0xA3, 0x01, 0x48, 0xDC, 0x62, 0x19,
-    0x8F, 0xDC, 0x98, 0xA0, 0x4E, 0xC2, 0x12, 0x49, 0x2D, 0x30, 0xCB, 0x02, 0x4A, 0x4B, 0x16, 0x40,
-    0x03, 0x6A, 0x97, 0xD6, 0x85, 0x07, 0xA8, 0x79, 0xF1, 0x16, 0xAE, 0xC9, 0xF5, 0x0B, 0xC1, 0x45,
-    0x0A, 0xEA, 0x41, 0x4D, 0x16, 0x85, 0x6E, 0x5B, 0xF8, 0x57, 0x34, 0x02, 0x7C, 0xA0, 0x63, 0xC0,
-    0x9A, 0x60, 0xB9, 0xA0, 0x8C, 0x73, 0x35, 0x30, 0xDD, 0x4A, 0xD1, 0x0B, 0x29, 0xBA, 0x5F, 0x29,
-    0xBA, 0x18, 0x18, 0x2D, 0x31, 0xB9, 0x1A, 0x6C, 0x4D, 0xEA, 0xC5, 0xCB, 0x95, 0x9E, 0x8C, 0xFB,
-    0xF8, 0x42, 0xE0, 0x4E, 0xC6, 0x09, 0xD1, 0xAC, 0x4A, 0xB7, 0xEC, 0x57, 0x25, 0x77, 0x4C, 0xC5,
-    0xFF, 0xAF, 0x1D, 0x25, 0x9F, 0xDB, 0x51, 0xFF, 0x7F, 0xEC, 0x68, 0x4F, 0x77, 0xB4, 0xEC, 0x76,
-    0x84, 0xF9, 0x22, 0x02, 0xDA, 0x94, 0x5C, 0x14, 0x05, 0x19, 0x78, 0xD0, 0x04, 0xFE, 0x21, 0x77,
-    0x33, 0x8D, 0x73, 0x97, 0x55, 0xE6, 0x1D, 0x29, 0x03, 0x89, 0x62, 0xC4, 0x4A, 0xA9, 0x5A, 0x42,
-    0x22, 0x82, 0x5E, 0xB3, 0x87, 0x5C, 0x5A, 0x20, 0xC1, 0x4A, 0x43, 0xC1, 0xDD, 0x80, 0xD6, 0x9C,
-    0xB0, 0x34, 0x39, 0x2B, 0x1A, 0x07, 0xD8, 0xA5, 0x83, 0x6C, 0x4B, 0x16, 0x65, 0x72, 0x06, 0x9B,
-    0x66, 0xF7, 0xB5, 0x30, 0x27, 0x55, 0x20, 0xEA, 0x3E, 0x66, 0xAC, 0x7C, 0x89, 0xB1, 0xAD, 0x97,
-    0x90, 0x5E, 0xBB, 0x90, 0x68, 0xAD, 0xE6, 0xFF, 0x86, 0xC5, 0x47, 0x50, 0x87, 0x56, 0xAF, 0x0B,
-    0x88, 0xAB, 0x4B, 0x2F, 0x4B, 0xCB, 0x05, 0xD6, 0x58, 0x40, 0x41, 0xB9, 0xF3, 0x9C, 0xF2, 0xF6,
-    0xC2, 0x0B, 0xCF, 0x67, 0x5E, 0xCA, 0x0E, 0xDA, 0xA5, 0xD5, 0xA0, 0x53, 0x52, 0x55, 0xB1, 0x59,
-    0xA9, 0x03, 0x22, 0x09, 0x54, 0x9E, 0xAC, 0x25, 0x02, 0xA3, 0x8E, 0x81, 0x49, 0x62, 0x21, 0x6F,
-    0xAC, 0x1E, 0x4B, 0x16, 0x34, 0xD4, 0x4D, 0xA7, 0xB3, 0xB2, 0x5E, 0xC2, 0x6D, 0xF2, 0x6B, 0x54,
-    0x26, 0x44, 0x97, 0x92, 0x41, 0x4F, 0x28, 0x18, 0x6A, 0x7F, 0xCC, 0xA7, 0x3C, 0xA9, 0x89, 0x8C,
-    0x3C, 0xDD, 0x28, 0x43, 0x2A, 0xD9, 0xD8, 0x01, 0x86, 0x2E, 0xFD, 0x1E, 0x01, 0x0D, 0x5F, 0x30,
-    0x71, 0x60, 0x5D, 0x3E, 0x28, 0x21, 0x96, 0x74, 0xE5, 0xBD, 0x99, 0x0E, 0x45, 0x28, 0xBD, 0xCE,
-    0xC1, 0x51, 0x5E, 0x7B, 0x86, 0x0F, 0xC2, 0x2D, 0x9B, 0x62, 0xBA, 0x00, 0x71, 0x82, 0x40, 0x62,
-    0x7D, 0xDD, 0xB9, 0x26, 0x5A, 0x58, 0x44, 0xFF, 0x83, 0xA5, 0x31, 0xBA, 0xE4, 0x9F, 0x60, 0xD5,
-    0x9E, 0xAC, 0xA7, 0x16, 0xA4, 0xCE, 0xA7, 0xC5, 0x59, 0xB5, 0x64, 0x7A, 0x50, 0xD0, 0x20, 0x72,
-    0xB3, 0x87, 0x9E, 0xBB, 0xB3, 0xEF, 0x42, 0x9E, 0x20, 0xC2, 0x0A, 0xB0, 0x08, 0x04, 0x84, 0x6D,
-    0xA0, 0xCF, 0xEA, 0x56, 0xA8, 0xE1, 0x16, 0x9E, 0x0F, 0xF4, 0xAC, 0x61, 0xCA, 0x03, 0xC4, 0xAB,
-    0x6D, 0xBD, 0x53, 0x46, 0xF8, 0x6C, 0x46, 0xE3, 0xD9, 0xBE, 0x37, 0x00, 0x4D, 0x9F, 0x2E, 0xE5,
-    0xBB, 0x33, 0x6B, 0x1F, 0x87, 0xFA, 0x5B, 0x20, 0xB0, 0x90, 0xBE, 0x1F, 0xCD, 0xE9, 0x83, 0x11,
-    0xF1, 0xDE, 0x17, 0x0A, 0x5F, 0x53, 0xB3, 0x80, 0x07, 0x08, 0x80, 0x55, 0xA6, 0x48, 0xF0, 0x99,
-    0xA8, 0xB6, 0x04, 0x67, 0x68, 0x04, 0xC3, 0x3E, 0x04, 0x69, 0x4B, 0x9F, 0x4B, 0x55, 0x52, 0xF2,
-    0x93, 0x7F, 0x53, 0xE2, 0x1C, 0xC6, 0xA5, 0xB7, 0xCA, 0x7B, 0xBB, 0x03, 0x0E, 0x3D, 0xAE, 0x09,
-    0x07, 0x37, 0x61, 0x5B, 0xC1, 0x6C, 0xA9, 0x56, 0x7F, 0xF6, 0x40, 0x8B, 0x25, 0xE6, 0x80, 0x72,
-    0xD0, 0xFC, 0xD0, 0x70, 0xBE, 0x59, 0x87, 0x66, 0xC2, 0xCA, 0xE8, 0x33, 0x2A, 0x1D, 0x1B, 0x4E,
-    0x23, 0x5E, 0x87, 0xF4, 0x1B, 0x00, 0x4D, 0x1F, 0x11, 0xCB, 0xA8, 0xDA, 0x81, 0xDA, 0x73, 0x90,
-    0xA7, 0x9C, 0xB5, 0x7E, 0x93, 0x2B, 0x5E, 0x42, 0x89, 0xA7, 0x13, 0x16, 0xCB, 0x9A, 0xDB, 0xF3,
-    0x5D, 0xEC, 0x0E, 0x6B, 0x72, 0x27, 0xBE, 0x48, 0xEA, 0x0A, 0xB0, 0x4C, 0xA5, 0x34, 0xB0, 0x17,
-    0x12, 0xB2, 0xCA, 0xB8, 0x92, 0x71, 0xBC, 0x2A, 0x48, 0x4A, 0x57, 0x62, 0x59, 0x23, 0x8E, 0x9B,
-    0x0A, 0x6E, 0xD9, 0xEA, 0x2F, 0xCB, 0x41, 0xBF, 0xA0, 0xE1, 0xA3, 0xCD, 0x15, 0xCA, 0xF5, 0xA6,
-    0x54, 0xCE, 0xD1, 0xF1, 0x72, 0xC6, 0x5C, 0xC7, 0xC5, 0x31, 0x64, 0x1B, 0x1E, 0x76, 0xA4, 0x03,
-    0x8F, 0x46, 0xD6, 0x7B, 0x48, 0xD1, 0x2C, 0xDC, 0xFB, 0x63, 0xF7, 0xAB, 0xF4, 0xB6, 0x15, 0x0F,
-    0x5E, 0x78, 0xBF, 0x5C, 0x60, 0xA0, 0xD5, 0x8B, 0x39, 0xBD, 0x61, 0x4F, 0x67, 0x6A, 0x53, 0x57,
-    0xB6, 0xB2, 0x2C, 0xB7, 0xF0, 0xAF, 0x68, 0xF3, 0x2E, 0xEF, 0x73, 0x16, 0x5E, 0x43, 0x3A, 0xA4,
-    0x63, 0x02, 0xF5, 0x9D, 0xCC, 0x1C, 0x15, 0xDB, 0x32, 0x4C, 0x32, 0x80, 0x2F, 0xAA, 0x00, 0x1E,
-    0xD8, 0x38, 0x8D, 0xB3, 0x3C, 0xDC, 0xCF, 0x4F, 0xDE, 0x1F, 0xAD, 0x2B, 0xEF, 0x9E, 0xB8, 0x8F,
-    0xF6, 0x74, 0x0F, 0x20, 0x99, 0x33, 0x5A, 0x98, 0x7C, 0x47, 0x0F, 0x1B, 0xD4, 0xC4, 0x89, 0x56,
-    0x20, 0xE8, 0xF1, 0x3E, 0xC0, 0x74, 0x1E, 0x52, 0x26, 0xEB, 0xCD, 0x9C, 0x0C, 0x58, 0x00, 0x96,
-    0x12, 0x8F, 0x79, 0x17, 0x4D, 0x18, 0x6F, 0x3E, 0x63, 0xCC, 0x5B, 0xCF, 0x5F, 0xBC, 0x08, 0x81,
-    0xFD, 0xB7, 0xCD, 0xE6, 0xCA, 0xC5, 0xB3, 0xA8, 0xBF, 0xD8, 0x24, 0x0A, 0x4C, 0x63, 0x87, 0xFD,
-    0x48, 0x90, 0xEB, 0x84, 0xA7, 0x16, 0x7B, 0x73, 0x31, 0xE5, 0xB3, 0x45, 0x11, 0x69, 0xBB, 0x6C,
-    0xAA, 0x5B, 0x42, 0x2C, 0x0F, 0x25, 0x2F, 0xC2, 0x94, 0xA5, 0xAE, 0xFB, 0xA7, 0xB2, 0x4A, 0x5B,
-    0x8A, 0x6B, 0xB3, 0xC5, 0x36, 0xA1, 0x1A, 0x59, 0x85, 0x2F, 0x8D, 0xA7, 0xBE, 0x77, 0x4D, 0x10,
-    0x1E, 0xE1, 0xA1, 0x6B, 0x23, 0xCF, 0x3C, 0x45, 0xBE, 0x7F, 0x88, 0x0C, 0x39, 0xA5, 0x33, 0xC5,
-    0x44, 0xC4, 0x70, 0x62, 0x19, 0x8D, 0xC0, 0x45, 0xB5, 0x42, 0x6D, 0x1B, 0x89, 0x12, 0xA7, 0x3B,
-    0x64, 0xF1, 0x88, 0x00, 0xBB, 0x8D, 0xEC, 0x30, 0x10, 0x05, 0xD1, 0x56, 0x9E, 0x23, 0x58, 0x58,
-    0x6B, 0x4F, 0xB9, 0x7F, 0xE5, 0xBB, 0xCC, 0xF2, 0xBD, 0xCA, 0xEE, 0x55, 0x2F, 0x60, 0x5A, 0xE2,
-    0x0B, 0x00, 0x4D, 0xE5, 0x65, 0xB4, 0x62, 0xF5, 0x0A, 0x07, 0x8C, 0x26, 0xDA, 0xAE, 0x52, 0x19,
-    0xEC, 0x08, 0x88, 0x44, 0xD2, 0x0A, 0xD8, 0x04, 0x71, 0x0E, 0xDD, 0xE9, 0x89, 0xCD, 0x8E, 0x96,
-    0x80, 0xA6, 0xC7, 0x4C, 0x83, 0x92, 0x99, 0xAB, 0x68, 0x0B, 0x6A, 0x43, 0xC3, 0xDA, 0x1F, 0x3C,
-    0x03, 0x1D, 0x06, 0x6B, 0x64, 0xBE, 0xD0, 0xC3, 0x57, 0x88, 0x17, 0xCF, 0x2A, 0x0E, 0xF6, 0x38,
-    0xB1, 0x9D, 0xA9, 0x5E, 0x54, 0x03, 0x81, 0x65, 0xF3, 0x25, 0x1F, 0xC1, 0x75, 0x5A, 0x3F, 0x8F,
-    0x7B, 0x24, 0xDE, 0xEB, 0x50, 0x29, 0x99, 0xBF, 0xAA, 0xF9, 0xCD, 0x69, 0x2C, 0x7E, 0x83, 0x69,
-    0x33, 0xD1, 0x91, 0x1E, 0x6E, 0xAB, 0x65, 0x4A, 0xD4, 0x4C, 0x89, 0x5D, 0xA5, 0xD4, 0xC8, 0x98,
-    0xAA, 0xC2, 0xA2, 0xC3, 0x36, 0x28, 0xC0, 0x84, 0xE2, 0x90, 0xA9, 0xE0, 0xD5, 0xC3, 0x2A, 0xEC,
-    0x4C, 0x85, 0x54, 0x3E, 0xAD, 0x91, 0xA7, 0x07, 0x26, 0xDA, 0xBC, 0xEC, 0xD7, 0x10, 0xD5, 0x8C,
-    0xCA, 0x1C, 0x1B, 0x9A, 0x1F, 0x55, 0x32, 0x6B, 0xE7, 0xF8, 0x1A, 0xA9, 0x9D, 0x13, 0xDB, 0x6D,
-    0x54, 0x6F, 0x2B, 0xE2, 0x0C, 0xD9, 0xFA, 0xFE, 0x44, 0xB0, 0x24, 0xF2, 0x7B, 0x51, 0x13, 0x01,
-    0x0B, 0x3D, 0xD1, 0x82, 0xBA, 0x6A, 0xA1, 0x85, 0x30, 0x02, 0xDC, 0x0A, 0xB8, 0x80, 0x3D, 0xC6,
-    0x4C, 0x0D, 0x89, 0x35, 0x5A, 0xE0, 0x25, 0x96, 0xB2, 0x3F, 0x02, 0x0A, 0xE2, 0xF9, 0x12, 0x74,
-    0x04, 0x60, 0xD9, 0xA4, 0x2C, 0x2A, 0xF6, 0xFC, 0xFF, 0x81, 0xA4, 0x0E, 0x48, 0x5A, 0x88, 0xA4,
-    0xD6, 0x2E, 0x40, 0x12, 0x70, 0x84, 0x64, 0x81, 0x75, 0x70, 0xCA, 0x86, 0xEB, 0x40, 0xA1, 0x37,
-    0xF0, 0x9C, 0x71, 0xBB, 0x8E, 0xA3, 0x87, 0x8A, 0x39, 0x05, 0x11, 0x92, 0x05, 0xF5, 0xBE, 0x0D,
-    0xFB, 0xCA, 0x07, 0x3D, 0xBB, 0x57, 0xFD, 0x9E, 0x32, 0x8F, 0xA8, 0x68, 0x7F, 0xEA, 0x44, 0xBF,
-    0x5E, 0xF5, 0x07, 0xC3, 0x92, 0x0A, 0x69, 0x31, 0xDB, 0xEE, 0xA1, 0x36, 0xE6, 0xC8, 0x54, 0x1C,
-    0xFE, 0x09, 0x09, 0x3B, 0x6D, 0x25, 0x6C, 0x74, 0x4C, 0xC2, 0x76, 0x6A, 0xFF, 0x23, 0x85, 0x0B,
-    0xB5, 0xF2, 0x36, 0x6A, 0x88, 0x70, 0x64, 0xA1, 0x6C, 0xA7, 0xF5, 0xF4, 0x56, 0xF5, 0xA8, 0xEB,
-    0x68, 0x85, 0xFC, 0x08, 0xB0, 0xD0, 0x97, 0xCC, 0x03, 0x65, 0x5F, 0x43, 0x39, 0x30, 0x53, 0xDD,
-    0xF0, 0x68, 0xC7, 0xA3, 0x0E, 0x8C, 0x92, 0x91, 0xEE, 0xA9, 0x4E, 0x08, 0x8D, 0x48, 0xDE, 0x44,
-    0x29, 0x04, 0x91, 0x1E, 0xB3, 0x94, 0xB7, 0x9D, 0x1D, 0x58, 0x0E, 0x11, 0xCD, 0xD3, 0x3A, 0x8B,
-    0x16, 0x38, 0x8E, 0xF7, 0x94, 0x8F, 0xDC, 0x74, 0xFF, 0xC5, 0xA6, 0x48, 0x9E, 0x32, 0x05, 0x96,
-    0x97, 0x2D, 0xE0, 0xE2, 0xE2, 0x3D, 0x88, 0xEE, 0x21, 0x7B, 0x2C, 0x8F, 0xC4, 0x27, 0xF2, 0x77,
-    0x39, 0x24, 0x24, 0xEA, 0x81, 0x87, 0xA5, 0x05, 0xD2, 0x3F, 0xB3, 0x7F, 0xEC, 0x35, 0x62, 0x98,
-    0x3E, 0x98, 0xE4, 0x81, 0x06, 0xB0, 0x4A, 0xDD, 0x52, 0x28, 0x95, 0x1A, 0x4C, 0x1A, 0x64, 0xEB,
-    0xEB, 0x56, 0x54, 0x1D, 0x84, 0xD7, 0xBB, 0x89, 0x0C, 0xA6, 0xE9, 0x30, 0xC9, 0xCC, 0x29, 0x40,
-    0x11, 0x48, 0xF7, 0x3D, 0x73, 0x52, 0x3A, 0xB3, 0x3F, 0x7B, 0x57, 0xD4, 0x5E, 0xD8, 0xD8, 0x50,
-    0x3E, 0xF5, 0xB0, 0xE5, 0x50, 0x4F, 0x9D, 0x69, 0x21, 0x26, 0xF7, 0x46, 0xD7, 0xD9, 0x0F, 0x11,
-    0xC7, 0xB7, 0x91, 0x8A, 0xB0, 0xD5, 0x47, 0xD8, 0x1F, 0xD4, 0x81, 0xEC, 0xF5, 0xA8, 0x67, 0x5A,
-    0x7B, 0x47, 0x7E, 0xC9, 0xF3, 0x3B, 0x9E, 0xD7, 0xA0, 0xEA, 0xB9, 0x6B, 0xCC, 0x97, 0xB6, 0x9E,
-    0x19, 0x98, 0x00, 0x2D, 0x5D, 0xC6, 0xA2, 0xFD, 0x23, 0xFE, 0x41, 0x40, 0xA1, 0x85, 0x69, 0xD0,
-    0x15, 0x0A, 0x44, 0xA5, 0xC8, 0x4C, 0x41, 0xD0, 0x70, 0xEA, 0x8C, 0x39, 0x96, 0x94, 0x16, 0xCE,
-    0x14, 0x10, 0xCC, 0xC5, 0x67, 0x28, 0x67, 0x7D, 0xB4, 0xA6, 0xC6, 0xCF, 0x7B, 0x7A, 0xDC, 0x59,
-    0x98, 0xE4, 0xBC, 0xF8, 0x64, 0x4B, 0xCE, 0xE3, 0x8E, 0x9C, 0xC7, 0x1D, 0x39, 0x37, 0x47, 0xE7,
-    0x90, 0xEE, 0x8E, 0x9E, 0x43, 0x06, 0x72, 0x9E, 0x31, 0x54, 0xA5, 0x27, 0x8C, 0xAB, 0x8E, 0x5B,
-    0x35, 0x9C, 0x5E, 0xC1, 0xB0, 0xF9, 0xCD, 0x25, 0x5A, 0xA0, 0x3F, 0x0F, 0x28, 0xC6, 0x1B, 0xCB,
-    0xC3, 0x88, 0x23, 0x64, 0x56, 0x5B, 0xE0, 0x96, 0x47, 0xC0, 0x0D, 0xB8, 0xD6, 0x4F, 0x26, 0x77,
-    0x49, 0x57, 0x0E, 0x54, 0x3C, 0xA5, 0xDA, 0x7A, 0x51, 0xFB, 0x92, 0x6E, 0x49, 0x5A, 0x85, 0xD7,
-    0x6C, 0x1D, 0xCB, 0xB3, 0x55, 0xDD, 0x3B, 0x99, 0x33, 0x95, 0xA2, 0x9D, 0x92, 0xDA, 0x49, 0xFD,
-    0xA3, 0x80, 0x63, 0xA6, 0xCD, 0x28, 0x46, 0x41, 0x89, 0xF3, 0x0B, 0xCB, 0x0F, 0x81, 0x41, 0x4C,
-    0x49, 0xB9, 0x36, 0x90, 0xAC, 0x30, 0x21, 0xFF, 0xC3, 0xD8, 0x7F, 0xAD, 0x2C, 0x4B, 0x85, 0x86,
-    0xA2, 0xE6, 0x82, 0xD1, 0xE0, 0x56, 0x29, 0xF6, 0x54, 0x70, 0x2B, 0x29, 0x03, 0x41, 0x3D, 0xE0,
-    0x85, 0x87, 0xCC, 0x32, 0x3C, 0xEA, 0x41, 0xA4, 0xD4, 0x37, 0x69, 0xFD, 0xC7, 0x50, 0xE3, 0x87,
-    0x88, 0xFB, 0xB1, 0x0E, 0x87, 0x68, 0x75, 0xC3, 0xA3, 0x25, 0x94, 0x05, 0x68, 0x8E, 0x6C, 0x3E,
-    0xB0, 0x62, 0xB3, 0x2A, 0xE7, 0x80, 0xF7, 0xEB, 0x3E, 0x9C, 0x59, 0x7F, 0x00, 0xC8, 0xDC, 0x1E,
-    0x54, 0x2F, 0xE6, 0xCA, 0xB7, 0x15, 0x45, 0x9A, 0x06, 0xAA, 0x6D, 0xCA, 0x91, 0xD5, 0x99, 0x45,
-    0x66, 0x00, 0xCA, 0x46, 0x8E, 0x22, 0x23, 0x80, 0xFF, 0x8E, 0x8C, 0x08, 0xB5, 0xEB, 0x8F, 0xE1,
-    0x24, 0x7B, 0xE3, 0xFE, 0xE8, 0x2A, 0xFB, 0xDE, 0xFD, 0x91, 0x85, 0xE5, 0xAD, 0x7F, 0x23, 0xE0,
-    0x6E, 0xDF, 0x78, 0x00, 0x3D, 0x7C, 0x70, 0xEE, 0x01, 0x4F, 0xA2, 0x13, 0xE4, 0xF6, 0xD2, 0x53,
-    0x24, 0x94, 0x33, 0x8B, 0x55, 0x7E, 0x43, 0xE2, 0x8E, 0xAA, 0x76, 0x90, 0x78, 0x19, 0x80, 0xC8,
-    0x61, 0x9E, 0xA5, 0x1A, 0x16, 0x6A, 0xF2, 0x07, 0x7A, 0xF4, 0xD8, 0x07, 0xE9, 0x6F, 0x28, 0x74,
-    0xD2, 0x70, 0x22, 0x63, 0x82, 0x22, 0x2B, 0x1F, 0xCC, 0xA1, 0xE2, 0x2E, 0x46, 0x15, 0xD6, 0x75,
-    0xF8, 0x0B, 0xA5, 0x6E, 0x96, 0x11, 0xCD, 0xF2, 0x50, 0xCF, 0x35, 0xA8, 0x2D, 0x5B, 0x35, 0x30,
-    0xF0, 0x5C, 0x76, 0x64, 0xA8, 0x9B, 0x18, 0xB2, 0xF8, 0x90, 0xD2, 0xF2, 0x1E, 0x33, 0xC0, 0x81,
-    0xAA, 0xA8, 0x7E, 0x4D, 0x42, 0x7A, 0x24, 0x90, 0x6A, 0x36, 0x59, 0xB6, 0x29, 0x25, 0xA4, 0x0D,
-    0x34, 0x3B, 0xA3, 0xD9, 0x42, 0x8F, 0x71, 0x96, 0xED, 0x01, 0x98, 0x09, 0xE7, 0x6B, 0x3D, 0xFF,
-    0x58, 0xF2, 0xFC, 0xAB, 0xB3, 0x66, 0x3A, 0x9A, 0x0D, 0x05, 0x58, 0x12, 0xC0, 0x91, 0x04, 0x74,
-    0xF1, 0xF4, 0xAC, 0x78, 0x78, 0xD1, 0x68, 0x56, 0x91, 0xA1, 0xD0, 0xD3, 0xC5, 0xAF, 0x03, 0x42,
-    0x3C, 0x36, 0x6B, 0x78, 0xB2, 0x99, 0x0D, 0x0A, 0x63, 0x48, 0x25, 0xEA, 0xA8, 0xB2, 0x55, 0x24,
-    0x42, 0xDB, 0xD3, 0x78, 0xA3, 0xEA, 0xA0, 0x17, 0x78, 0xBE, 0xD1, 0xE9, 0x6B, 0x08, 0x37, 0xA5,
-    0xE9, 0x96, 0x7F, 0x2E, 0x63, 0xC1, 0xA0, 0x35, 0xDB, 0xA8, 0xD3, 0x44, 0x57, 0x8C, 0xD9, 0xFF,
-    0x2F, 0x9F, 0x9F, 0x9A, 0x17, 0x2B, 0x32, 0x2D, 0x87, 0x74, 0x3D, 0x4F, 0x59, 0x56, 0xE1, 0x56,
-    0xAA, 0x50, 0xE3, 0x80, 0xA2, 0xE2, 0x13, 0xD9, 0x25, 0x56, 0x71, 0xA7, 0x7F, 0xC9, 0xF9, 0x9C,
-    0x90, 0x3B, 0xC5, 0xE3, 0xDF, 0x96, 0x5B, 0x3D, 0x0D, 0x9B, 0x9C, 0xBA, 0x6A, 0x4E, 0x88, 0xAF,
-    0x78, 0xBE, 0xFC, 0xE6, 0x2B, 0xE2, 0x2F, 0x44, 0xE1, 0x1C, 0xFF, 0x3F, 0xC5, 0x5A, 0xBF, 0x93,
-    0xDD, 0xD4, 0x15, 0xBE, 0x7A, 0xF2, 0x5A, 0x13, 0x34, 0x89, 0x52, 0xD8, 0x45, 0x08, 0x83, 0x1A,
-    0x8A, 0x0C, 0x93, 0x41, 0xFF, 0xC0, 0x2E, 0x57, 0x36, 0x33, 0xA1, 0x70, 0xB1, 0x5B, 0x78, 0xD3,
-    0xB8, 0x70, 0x9D, 0x6A, 0xFF, 0x01, 0x6C, 0xC9, 0x78, 0x32, 0x14, 0x29, 0xEC, 0x22, 0x24, 0x05,
-    0x05, 0x14, 0xC9, 0x0C, 0xB3, 0x2E, 0x9C, 0x82, 0xC2, 0x99, 0x61, 0x57, 0xC2, 0x2E, 0x28, 0x28,
-    0x10, 0x38, 0x13, 0x17, 0x14, 0x08, 0x9B, 0x40, 0x62, 0x17, 0x2B, 0x8C, 0x8C, 0xB5, 0xBB, 0x92,
-    0x4E, 0xBE, 0xEF, 0x5C, 0xBD, 0xDD, 0x75, 0x98, 0xF1, 0x84, 0xC1, 0x2C, 0x8B, 0x25, 0xDE, 0xEA,
-    0x5D, 0x9D, 0x73, 0xEE, 0xF9, 0xF9, 0x9D, 0x73, 0xD7, 0x84, 0xA5, 0x3F, 0x1A, 0xDB, 0xF8, 0x83,
-    0x89, 0x73, 0xC3, 0x9F, 0xA3, 0x6F, 0x99, 0xC2, 0x44, 0xB5, 0x19, 0x4D, 0x5C, 0xF9, 0xBD, 0xB1,
-    0x65, 0xD0, 0x9B, 0x22, 0x8F, 0x3A, 0x23, 0x69, 0xDC, 0xCC, 0x04, 0x6B, 0xBD, 0xD3, 0xBA, 0xD0,
-    0x44, 0xB9, 0xF1, 0x5A, 0xE3, 0x15, 0x9F, 0x9B, 0x42, 0x2A, 0x2B, 0x7D, 0x28, 0x57, 0x4E, 0x48,
-    0x6E, 0x92, 0xC6, 0x80, 0x9A, 0xC9, 0x4A, 0x13, 0xF6, 0x06, 0xAF, 0x9A, 0xB0, 0xC3, 0xFF, 0x4A,
-    0x13, 0x8C, 0x5E, 0x89, 0x55, 0x33, 0x91, 0x32, 0x90, 0xCE, 0x44, 0xFF, 0x30, 0x06, 0x5F, 0xC4,
-    0xA9, 0x31, 0x2B, 0x66, 0xFE, 0x93, 0x8C, 0xA9, 0x09, 0x44, 0x52, 0x83, 0x85, 0x66, 0x26, 0x7F,
-    0xAA, 0x0D, 0x18, 0x2B, 0x2D, 0xFC, 0x86, 0x0F, 0x24, 0x65, 0x6C, 0x85, 0x8B, 0x8B, 0x44, 0x06,
-    0xAE, 0x6E, 0xCC, 0x82, 0xBC, 0x6E, 0x94, 0xA9, 0x89, 0x1A, 0xA3, 0x3C, 0x75, 0xA5, 0x27, 0x77,
-    0xD7, 0x2F, 0x87, 0x22, 0x92, 0x5B, 0x2E, 0x15, 0x2E, 0xFD, 0x89, 0x99, 0xA5, 0x1B, 0xC5, 0xDA,
-    0x45, 0x91, 0xD1, 0x17, 0xA9, 0xA3, 0x3A, 0xCB, 0xAD, 0xB1, 0x5E, 0x67, 0x7A, 0xBF, 0xF1, 0x9B,
-    0xA8, 0x4A, 0xF2, 0x64, 0x77, 0x80, 0x8C, 0x43, 0x24, 0xD2, 0xFD, 0x6C, 0xC1, 0x2F, 0x8D, 0xA3,
-    0x9A, 0x95, 0x92, 0x46, 0x6D, 0xD8, 0x42, 0x0C, 0xBC, 0x51, 0xFA, 0x7D, 0xD4, 0x1A, 0xFB, 0x9E,
-    0x98, 0xD9, 0x60, 0x4B, 0x13, 0x7F, 0xD2, 0x1A, 0x23, 0x23, 0x16, 0x0A, 0xD6, 0x17, 0x1D, 0x38,
-    0x43, 0xFE, 0x04, 0x8C, 0xBD, 0x33, 0x03, 0x76, 0x97, 0xE5, 0x66, 0x76, 0x75, 0x7C, 0xCB, 0x64,
-    0x22, 0x06, 0xF2, 0xD4, 0xF8, 0x9E, 0x9B, 0xAD, 0xB1, 0x2B, 0x0A, 0x6D, 0x36, 0xF7, 0x7F, 0x7E,
-    0x67, 0xBE, 0xFD, 0xE0, 0x18, 0xD6, 0x4A, 0x4E, 0xBD, 0xD8, 0x2F, 0x7A, 0x6F, 0x34, 0x3F, 0x0F,
-    0xB0, 0x39, 0x2A, 0x26, 0x06, 0xCB, 0x42, 0x4C, 0xF4, 0x10, 0x42, 0xF9, 0xBD, 0xDF, 0x05, 0x4D,
-    0xD4, 0xC4, 0x65, 0x52, 0xC3, 0xA2, 0xD8, 0xAA, 0x05, 0x93, 0xB8, 0x77, 0xAA, 0x88, 0x9A, 0xE7,
-    0x20, 0xC5, 0xE6, 0x15, 0x6E, 0xAD, 0x3A, 0x2A, 0xDB, 0x4A, 0x34, 0x3E, 0x59, 0x4B, 0x72, 0xB3,
-    0x2B, 0xC2, 0xB2, 0x9D, 0xEB, 0x1F, 0xF6, 0x83, 0x11, 0x70, 0x8F, 0x2A, 0x93, 0xA5, 0x3E, 0x24,
-    0xDC, 0x30, 0xD7, 0x8E, 0xCA, 0xAB, 0x4D, 0xEC, 0xC1, 0xC0, 0x17, 0xAB, 0xF3, 0x5E, 0xBA, 0xB8,
-    0x18, 0x95, 0x66, 0x76, 0x2B, 0xC7, 0x3B, 0xCF, 0xBE, 0x13, 0x43, 0xCB, 0xBB, 0x27, 0xA0, 0xF4,
-    0x48, 0x3F, 0x3E, 0xD4, 0xA7, 0x8B, 0xF0, 0x8C, 0xD9, 0xCD, 0xF2, 0x9C, 0x31, 0x8B, 0x89, 0x8F,
-    0xD7, 0xCA, 0x36, 0x94, 0x0B, 0x4D, 0x50, 0x7B, 0xE6, 0x1C, 0x9C, 0xCA, 0x24, 0xB9, 0xB1, 0x77,
-    0x0B, 0x18, 0x71, 0x4D, 0x70, 0x33, 0x0B, 0x8E, 0x75, 0x78, 0xA7, 0x12, 0x89, 0x6E, 0xF7, 0x99,
-    0x7F, 0xBF, 0x8D, 0x2E, 0x55, 0xE7, 0xEC, 0xAC, 0x19, 0xE2, 0xEB, 0xB0, 0xD2, 0xD0, 0x1A, 0xF8,
-    0xC8, 0xCF, 0x71, 0x3B, 0x07, 0x77, 0x93, 0x97, 0x07, 0x7F, 0x8C, 0xBA, 0xA8, 0xB7, 0x8D, 0x6D,
-    0xA4, 0x2C, 0xAE, 0x8B, 0x91, 0x8B, 0xA3, 0xC9, 0x60, 0x0A, 0x5B, 0x49, 0x9A, 0x34, 0x45, 0x19,
-    0x35, 0xB6, 0x0C, 0xEB, 0x24, 0xF7, 0xCC, 0x11, 0x6A, 0x7C, 0x1B, 0x76, 0xFF, 0x12, 0xD7, 0xEF,
-    0x57, 0x57, 0x37, 0x21, 0x22, 0x94, 0x11, 0x60, 0x5B, 0xF4, 0xF6, 0xF3, 0x60, 0x7B, 0xFA, 0xF9,
-    0xF5, 0x65, 0xB9, 0x23, 0x0F, 0x60, 0xAF, 0xC7, 0xA9, 0xC0, 0x0E, 0xB3, 0x26, 0xF6, 0xA5, 0x83,
-    0x0A, 0x96, 0xC2, 0x6A, 0x71, 0xD1, 0xAF, 0x96, 0xA0, 0x82, 0x25, 0xBF, 0x7A, 0xF6, 0x1D, 0xBF,
-    0x7A, 0xD7, 0xDB, 0x4D, 0x2D, 0xDC, 0xE3, 0x1D, 0x5F, 0x2A, 0xA8, 0x60, 0x29, 0x81, 0x0A, 0xFC,
-    0xAA, 0x83, 0x0A, 0x96, 0x82, 0x12, 0x2A, 0xA8, 0x5E, 0x84, 0x0A, 0x96, 0xBC, 0x07, 0x0D, 0x19,
-    0x3F, 0x46, 0x05, 0xB0, 0xA5, 0x5C, 0x87, 0xA4, 0x74, 0x3D, 0xFC, 0x16, 0x77, 0x33, 0xE9, 0xE3,
-    0x7B, 0xDD, 0x86, 0xFF, 0x75, 0x13, 0x7E, 0x58, 0x26, 0xC9, 0x85, 0xDE, 0x4A, 0x95, 0x8D, 0xE6,
-    0x69, 0x48, 0xB8, 0x00, 0x9D, 0x58, 0x2C, 0x82, 0xD8, 0x3E, 0xD5, 0x5F, 0xF2, 0xD7, 0xA3, 0xEB,
-    0xB2, 0x7E, 0x16, 0x9E, 0x8D, 0x5D, 0x77, 0xAB, 0xD9, 0xEB, 0x2B, 0x8F, 0x7E, 0xAB, 0x8B, 0x19,
-    0x4D, 0xFB, 0x3A, 0xC9, 0xCD, 0x5A, 0x85, 0x5D, 0xC1, 0x48, 0xDE, 0x85, 0x81, 0xDF, 0x23, 0xE2,
-    0xE1, 0xEC, 0xB6, 0x84, 0x97, 0x85, 0x2D, 0x74, 0xD1, 0xC2, 0x91, 0xF0, 0xCF, 0x2B, 0x10, 0x42,
-    0xE5, 0xA6, 0xA4, 0xE9, 0x00, 0x82, 0x47, 0x8B, 0xD4, 0x36, 0xE6, 0x6A, 0x43, 0x0D, 0xD9, 0xE5,
-    0x3F, 0x43, 0xAA, 0x3A, 0xDB, 0x56, 0xD2, 0xAB, 0x46, 0x72, 0xC9, 0x8B, 0x3C, 0x4B, 0xB9, 0x25,
-    0x0B, 0x53, 0xC0, 0xD3, 0xB3, 0x32, 0xEC, 0x3C, 0x9A, 0x27, 0x64, 0x12, 0xB1, 0x15, 0x12, 0x8A,
-    0x98, 0xB8, 0xD1, 0xBC, 0x92, 0xD4, 0x08, 0x5B, 0xC9, 0x23, 0x26, 0xA0, 0xAC, 0x4C, 0x98, 0x60,
-    0xA4, 0x0C, 0xC7, 0x98, 0x1E, 0x2C, 0xB0, 0xB6, 0x7C, 0x8A, 0x64, 0xD1, 0x5B, 0x8D, 0x15, 0xBC,
-    0x7C, 0x30, 0xCA, 0x35, 0x29, 0x8C, 0xFC, 0x6D, 0xEE, 0xBD, 0xC8, 0x11, 0xD2, 0x43, 0x79, 0x10,
-    0x68, 0x7C, 0x37, 0x93, 0x76, 0xB1, 0xC0, 0x25, 0xFF, 0x73, 0xF1, 0x19, 0xBF, 0xB3, 0xB8, 0x62,
-    0x5C, 0x01, 0x2E, 0x73, 0x0C, 0x97, 0xF9, 0x7F, 0xAF, 0xBF, 0xFC, 0xCA, 0x4B, 0xB3, 0x1B, 0x02,
-    0x17, 0xAC, 0x8E, 0x99, 0xB0, 0xCC, 0x72, 0x04, 0xD6, 0x1B, 0xBB, 0xF2, 0x21, 0x6C, 0xF6, 0x54,
-    0x1E, 0xF4, 0x3E, 0x6C, 0xD8, 0x59, 0x39, 0x71, 0xB3, 0x41, 0x22, 0x0D, 0x1B, 0x24, 0xD2, 0xA8,
-    0xF2, 0x90, 0x0D, 0xCA, 0x59, 0x47, 0x79, 0xA5, 0x4F, 0x3E, 0xBD, 0xD9, 0x9C, 0x3F, 0x1F, 0xDC,
-    0xAB, 0x36, 0x36, 0xA2, 0x5B, 0x9F, 0x41, 0xD8, 0x13, 0x70, 0x1B, 0xA6, 0x41, 0x2F, 0x0D, 0x10,
-    0xBE, 0x61, 0x97, 0x40, 0x45, 0x31, 0x34, 0x12, 0x21, 0xDB, 0x20, 0x87, 0xCA, 0x4B, 0x3D, 0xFF,
-    0x1F, 0x0C, 0x49, 0x13, 0xB7, 0x59, 0x65, 0x6B, 0x49, 0x0B, 0xB8, 0x7C, 0x82, 0xF4, 0x79, 0x04,
-    0x71, 0x61, 0x9E, 0x4E, 0xCD, 0x26, 0x95, 0x80, 0x57, 0x25, 0xF5, 0xDB, 0x40, 0xC8, 0x13, 0x69,
-    0x21, 0x29, 0xFD, 0x4B, 0x75, 0x00, 0x55, 0x0D, 0xF8, 0x0F, 0xDF, 0x5A, 0x44, 0x65, 0x1F, 0x36,
-    0x4F, 0xE7, 0xC9, 0x7B, 0x3D, 0xC4, 0xEC, 0xEC, 0x09, 0x29, 0xED, 0x72, 0x6D, 0xBB, 0xE0, 0x3E,
-    0xB4, 0x96, 0x22, 0x85, 0x3C, 0xA4, 0x49, 0x37, 0x32, 0xE3, 0x77, 0xC9, 0x29, 0x48, 0xEF, 0xEF,
-    0x48, 0x1E, 0x97, 0x99, 0xF4, 0x7E, 0x7B, 0xF4, 0x8A, 0xE4, 0x23, 0x89, 0x24, 0x88, 0xFD, 0x6E,
-    0xE2, 0x09, 0x5B, 0x80, 0x7C, 0x81, 0x44, 0x68, 0x62, 0x29, 0xFD, 0x56, 0x99, 0xE6, 0xE6, 0x4E,
-    0x87, 0xED, 0x82, 0x10, 0xBC, 0xC3, 0x64, 0x10, 0x45, 0xB9, 0x16, 0x79, 0xD8, 0x64, 0x09, 0x18,
-    0x5E, 0x6C, 0x0B, 0xC9, 0x07, 0x9B, 0x57, 0x02, 0xB6, 0xE0, 0x04, 0x9A, 0xFC, 0x37, 0x18, 0x6F,
-    0x60, 0xD9, 0x49, 0x2A, 0x68, 0x0D, 0x5E, 0x08, 0xC2, 0xC8, 0x9A, 0x36, 0x0D, 0x90, 0x01, 0x3A,
-    0x38, 0x62, 0x07, 0xC6, 0x48, 0x5D, 0x1E, 0xEB, 0x49, 0x15, 0x62, 0x8B, 0x49, 0x19, 0xDC, 0xEB,
-    0x40, 0xDF, 0x83, 0x38, 0xD8, 0x9E, 0xDF, 0x62, 0x99, 0x77, 0xB5, 0x86, 0xC2, 0xE1, 0x43, 0x20,
-    0x38, 0x2B, 0x4A, 0x0B, 0xA5, 0x86, 0xF5, 0x38, 0x7B, 0xDB, 0x84, 0xB7, 0xFB, 0xB0, 0xFF, 0xFB,
-    0xDA, 0xAD, 0x26, 0xEE, 0x0A, 0xB9, 0x54, 0x65, 0x6D, 0x36, 0x24, 0x39, 0xFC, 0xCB, 0xED, 0xD9,
-    0xF4, 0xD1, 0x07, 0x28, 0x5A, 0x6D, 0xB2, 0x5C, 0x63, 0x7D, 0x76, 0x95, 0x32, 0x15, 0x48, 0x08,
-    0x36, 0x5D, 0x2F, 0xFE, 0xCD, 0x0D, 0xC0, 0x76, 0xD8, 0x51, 0xE2, 0x0A, 0x24, 0xF2, 0x7D, 0xD2,
-    0xB2, 0xB6, 0x31, 0x89, 0xFF, 0x62, 0xEE, 0x7A, 0xE4, 0x0E, 0x31, 0x04, 0x4F, 0xF3, 0x19, 0x94,
-    0x21, 0xB9, 0x2F, 0x29, 0x57, 0x40, 0x60, 0x5B, 0x7B, 0xE1, 0x70, 0xE6, 0x3D, 0x04, 0x65, 0x22,
-    0xE3, 0x4C, 0x63, 0x1B, 0x3F, 0x5A, 0x46, 0xD5, 0x77, 0x63, 0x3A, 0x77, 0xC2, 0x4A, 0xA3, 0x2C,
-    0x8E, 0xCF, 0x69, 0x32, 0x37, 0x84, 0x4C, 0x47, 0x96, 0x4A, 0x64, 0x86, 0x8A, 0x76, 0x21, 0x6D,
-    0xB1, 0x56, 0x42, 0x43, 0x05, 0x56, 0x7F, 0x8C, 0x47, 0x12, 0x40, 0x98, 0x16, 0x39, 0x25, 0x83,
-    0x27, 0xFA, 0x03, 0x02, 0x37, 0xDE, 0xB9, 0xD2, 0x69, 0xB1, 0x43, 0xC5, 0x80, 0xC2, 0x71, 0x83,
-    0x1C, 0x28, 0x58, 0xA8, 0xB9, 0x0D, 0x82, 0xC6, 0xDE, 0x04, 0x35, 0x39, 0xDB, 0xB8, 0xE0, 0xF1,
-    0x56, 0x71, 0x0B, 0x86, 0xB9, 0x28, 0x96, 0x52, 0x14, 0x64, 0x7E, 0x7A, 0x6F, 0x67, 0x0C, 0x3B,
-    0x15, 0x23, 0xD2, 0xD4, 0xC8, 0x12, 0x67, 0xB7, 0x4A, 0x27, 0x87, 0x11, 0x3A, 0xC4, 0x90, 0x50,
-    0x22, 0xC8, 0xA0, 0x82, 0xC4, 0x0D, 0x36, 0x64, 0x2B, 0xDC, 0xB2, 0xBB, 0x57, 0x6B, 0x95, 0xC4,
-    0xE3, 0xCD, 0x57, 0x99, 0x98, 0x60, 0x54, 0x94, 0x18, 0xCE, 0xD6, 0x5A, 0x54, 0xF8, 0x96, 0x50,
-    0x81, 0x4A, 0x39, 0x9E, 0x72, 0xD3, 0x0D, 0x59, 0x42, 0x16, 0xD4, 0x02, 0x56, 0xCE, 0x91, 0xA5,
-    0xEA, 0xF8, 0xA1, 0xCB, 0xA2, 0x16, 0x1A, 0xFD, 0x0A, 0xF6, 0xA4, 0xCE, 0x35, 0x23, 0x2F, 0xF2,
-    0x9B, 0x05, 0x86, 0xDC, 0x04, 0x80, 0xA8, 0x36, 0x95, 0xC6, 0x97, 0x7A, 0xB2, 0x90, 0x11, 0x6A,
-    0x4F, 0xC5, 0xB1, 0x70, 0x2A, 0x67, 0x23, 0xE8, 0x3D, 0x75, 0xF2, 0x04, 0x3D, 0x6A, 0xB7, 0x5A,
-    0xC9, 0x93, 0x75, 0xB8, 0x86, 0x62, 0x92, 0x8C, 0x68, 0x81, 0x76, 0x82, 0xB8, 0x4C, 0x9A, 0x94,
-    0x08, 0xB2, 0xF9, 0xA8, 0x74, 0xA0, 0x77, 0x42, 0x1C, 0x54, 0x08, 0xAA, 0x6B, 0xA0, 0x74, 0x7F,
-    0x98, 0x34, 0xB3, 0x5F, 0xB4, 0x0F, 0xDB, 0x4A, 0x73, 0x6E, 0x09, 0x77, 0xCA, 0x84, 0xE8, 0x57,
-    0xD8, 0x68, 0x48, 0x66, 0x11, 0x35, 0xE0, 0x3D, 0xA2, 0x1F, 0xA0, 0x21, 0xA7, 0x1E, 0x15, 0x89,
-    0xDA, 0x09, 0xBF, 0xE9, 0x9D, 0x72, 0x54, 0x22, 0xD5, 0x4D, 0x71, 0x62, 0x70, 0xAA, 0xA1, 0x40,
-    0xAA, 0x99, 0x88, 0xEA, 0xA0, 0x62, 0x54, 0x1E, 0xD5, 0x0B, 0xF6, 0x25, 0xAA, 0x16, 0x8A, 0xF3,
-    0x60, 0xD2, 0x0A, 0x51, 0x16, 0x09, 0xD3, 0xD7, 0x55, 0xFD, 0x5A, 0xD5, 0xF4, 0x29, 0xF4, 0x13,
-    0xF4, 0x99, 0x02, 0x38, 0xF9, 0x83, 0xDA, 0x34, 0x69, 0x28, 0x37, 0xDC, 0xDD, 0x95, 0x0C, 0xB9,
-    0x20, 0xEB, 0x6F, 0xF3, 0x29, 0x91, 0x1A, 0xE8, 0xCE, 0xF4, 0x1D, 0x0D, 0x19, 0x62, 0xAB, 0x2B,
-    0xBD, 0xEE, 0x54, 0xC9, 0xB3, 0x34, 0xF3, 0xD7, 0xD8, 0x91, 0x87, 0x61, 0x94, 0x04, 0x60, 0x2D,
-    0x49, 0x30, 0xF9, 0x0A, 0x83, 0x5E, 0x2B, 0x10, 0x2B, 0x93, 0x75, 0x6F, 0xB9, 0xA2, 0xB4, 0xAD,
-    0xAF, 0x1B, 0x2D, 0xEB, 0x32, 0x02, 0xA0, 0x88, 0x79, 0xCA, 0x64, 0x35, 0x89, 0x93, 0xE4, 0x44,
-    0x88, 0x44, 0xE7, 0x51, 0x58, 0x11, 0xBC, 0xA6, 0x8F, 0x04, 0x66, 0xED, 0x12, 0x02, 0x72, 0xCA,
-    0xBF, 0xAE, 0x52, 0xAA, 0x9E, 0xB7, 0x06, 0xCB, 0x00, 0x99, 0x15, 0xC9, 0xF8, 0x94, 0x2F, 0xD0,
-    0x1B, 0xCC, 0xB1, 0xC0, 0x8D, 0x27, 0xA4, 0x98, 0x55, 0xAE, 0x32, 0x3B, 0xB2, 0x84, 0x8E, 0x1A,
-    0xE0, 0xCC, 0xCE, 0x73, 0xE4, 0x0D, 0xC8, 0x40, 0x89, 0x73, 0x6C, 0x02, 0xB9, 0x15, 0x3E, 0x30,
-    0x4E, 0xD5, 0x96, 0xE9, 0x20, 0xA6, 0x71, 0xC7, 0xF5, 0xCB, 0xBE, 0x2B, 0xC8, 0xEA, 0xA9, 0xEE,
-    0x61, 0x37, 0xC9, 0xCC, 0x95, 0x64, 0x17, 0xEF, 0xAC, 0xE7, 0xA1, 0x73, 0xA1, 0x4E, 0x69, 0x92,
-    0x6F, 0xEA, 0x24, 0xB0, 0xD3, 0xC5, 0x34, 0x47, 0xEC, 0xF2, 0xC3, 0xB2, 0x5D, 0x58, 0x61, 0x1C,
-    0xF0, 0xAA, 0x10, 0x32, 0x70, 0xE6, 0xDA, 0xE6, 0x5E, 0xEA, 0xAD, 0xFC, 0xB0, 0x6C, 0xBD, 0xF6,
-    0x05, 0x7C, 0x8D, 0xD8, 0xA2, 0x73, 0x07, 0x65, 0x77, 0x20, 0x38, 0xA7, 0x25, 0x70, 0xE8, 0x14,
-    0xCE, 0xC6, 0x10, 0x77, 0x48, 0x46, 0x26, 0x20, 0x93, 0xEC, 0xAC, 0xA7, 0xF0, 0x8F, 0x4A, 0x6D,
-    0x3A, 0xF9, 0x90, 0xFA, 0xF7, 0x7C, 0xA5, 0x76, 0x0C, 0xD9, 0xDD, 0x75, 0xA3, 0xAF, 0xA3, 0x87,
-    0x50, 0x9A, 0xBA, 0x51, 0xFA, 0x2E, 0xCC, 0x1E, 0x6B, 0xB9, 0x35, 0x6E, 0x93, 0x28, 0x9B, 0xF0,
-    0xB9, 0x3A, 0x02, 0xA5, 0x78, 0x50, 0x99, 0xA3, 0x46, 0x69, 0xB0, 0x3B, 0x1B, 0xD5, 0x14, 0x7C,
-    0x67, 0x8A, 0x69, 0x82, 0xDD, 0x56, 0xBF, 0xC6, 0x4E, 0x03, 0x14, 0x0B, 0xF7, 0x76, 0x28, 0x14,
-    0x71, 0xE1, 0x34, 0xA1, 0xA8, 0xF3, 0xC0, 0x22, 0xD5, 0x2A, 0x37, 0x29, 0x12, 0xDB, 0xA9, 0xB9,
-    0xCE, 0xD0, 0xD9, 0xC9, 0x86, 0x9E, 0x4A, 0x6C, 0x46, 0x7D, 0x81, 0x91, 0xBE, 0xA2, 0x86, 0x2F,
-    0xDD, 0x2E, 0xD9, 0x98, 0x31, 0x7C, 0x20, 0x0E, 0x99, 0xF1, 0x02, 0x37, 0xA8, 0xD8, 0x91, 0x29,
-    0x14, 0x0C, 0xC3, 0x63, 0x7C, 0xD0, 0x8B, 0xF0, 0xC0, 0xBE, 0x0F, 0x28, 0x83, 0xD2, 0x7B, 0x7A,
-    0xAA, 0x46, 0x3F, 0x04, 0xBF, 0xE8, 0x55, 0x40, 0x98, 0xB8, 0xF6, 0xFB, 0x2C, 0xD5, 0x0C, 0xEB,
-    0x7E, 0xA8, 0xBF, 0x44, 0x8D, 0x56, 0x9A, 0xAC, 0x55, 0x0A, 0xAA, 0xE3, 0x46, 0x43, 0x95, 0x1A,
-    0x24, 0x6F, 0xF0, 0x21, 0xCD, 0x70, 0xD2, 0x0E, 0x16, 0x05, 0x6E, 0x91, 0x27, 0x4C, 0x01, 0x35,
-    0xB2, 0x41, 0xEE, 0x94, 0x68, 0xE5, 0xB2, 0x2B, 0x22, 0xC1, 0xD4, 0x19, 0x82, 0x74, 0x9E, 0x29,
-    0xEA, 0xAD, 0xB1, 0x03, 0x7C, 0x2E, 0x67, 0x02, 0xE0, 0x12, 0xF6, 0x70, 0x80, 0xE4, 0x6B, 0xBC,
-    0x27, 0x6F, 0x0A, 0xF2, 0x7F, 0x32, 0xBE, 0x15, 0xB7, 0xD8, 0x5A, 0x81, 0xEC, 0x17, 0xA0, 0x17,
-    0x42, 0xFB, 0x0D, 0xE4, 0x8C, 0xE5, 0xF7, 0x04, 0xDD, 0x01, 0x96, 0x45, 0xF4, 0x53, 0x2B, 0xFB,
-    0xBE, 0x06, 0x34, 0xF1, 0x22, 0x1D, 0x6B, 0xB7, 0x65, 0x3D, 0x60, 0x16, 0x5A, 0x62, 0x1F, 0x0E,
-    0x74, 0x79, 0x20, 0x2D, 0x43, 0xA7, 0x96, 0xD9, 0xDD, 0x63, 0x9B, 0x08, 0xD8, 0x58, 0x79, 0x0C,
-    0x89, 0x3C, 0xA4, 0xCB, 0xE3, 0x81, 0xBF, 0x3B, 0x10, 0xA2, 0x7F, 0xD2, 0x21, 0x5B, 0x14, 0xCB,
-    0x0D, 0x40, 0x7A, 0x6F, 0xCB, 0x22, 0x8D, 0x9A, 0xE2, 0x22, 0x3C, 0x33, 0x17, 0xBC, 0x38, 0x42,
-    0x61, 0x58, 0x1F, 0x6E, 0x43, 0xA4, 0x32, 0x46, 0x89, 0xC4, 0x7B, 0x68, 0xEC, 0x3B, 0xC5, 0x80,
-    0x95, 0x07, 0x81, 0x00, 0xE3, 0x84, 0x13, 0x84, 0x50, 0x68, 0x23, 0x36, 0xA2, 0xAE, 0xC0, 0x6B,
-    0x26, 0x53, 0x04, 0x1F, 0x30, 0xB1, 0xCD, 0xBA, 0x83, 0x68, 0xC3, 0x2B, 0x68, 0x56, 0x51, 0xF5,
-    0x31, 0x12, 0x76, 0x8A, 0x16, 0x50, 0x2A, 0xEE, 0x03, 0xF4, 0x23, 0x3D, 0xAA, 0x4B, 0x30, 0x20,
-    0x5D, 0xFA, 0x83, 0xCE, 0x18, 0x40, 0x08, 0x37, 0xD6, 0x54, 0xDC, 0xC2, 0x1E, 0x59, 0x26, 0xD2,
-    0x5B, 0x87, 0x5F, 0x93, 0x06, 0xDF, 0x66, 0xB5, 0x6D, 0x61, 0x89, 0x78, 0x3C, 0x23, 0x0C, 0xAE,
-    0xD1, 0x68, 0x50, 0xC3, 0x8B, 0xF2, 0xBD, 0xD4, 0xC7, 0xF8, 0x99, 0x72, 0x6B, 0x3E, 0xB5, 0x13,
-    0x2A, 0x95, 0x97, 0xFE, 0x38, 0x02, 0x29, 0x1C, 0x63, 0xE6, 0xA2, 0x39, 0x5C, 0x32, 0xF1, 0x3B,
-    0x60, 0x5A, 0x6F, 0x65, 0x1E, 0x73, 0x87, 0xAD, 0x21, 0xAD, 0x9B, 0x97, 0x5F, 0xE1, 0x7C, 0x43,
-    0xE7, 0x1A, 0x28, 0xDB, 0x35, 0x68, 0x78, 0xE9, 0xC2, 0x8F, 0xA3, 0xA1, 0x17, 0x02, 0x04, 0x6D,
-    0xB1, 0xCC, 0x64, 0x84, 0x76, 0x01, 0xCE, 0x9D, 0x1F, 0x40, 0x41, 0x87, 0x2A, 0xCB, 0x11, 0xB3,
-    0xE0, 0xD7, 0x5E, 0x8B, 0x6E, 0xF7, 0xFA, 0x18, 0x37, 0x91, 0xD6, 0x0A, 0xC2, 0x07, 0x8E, 0x65,
-    0x02, 0x41, 0xCB, 0x6B, 0xEB, 0xAC, 0x2C, 0x5E, 0x6B, 0x66, 0xDD, 0x33, 0xA8, 0xF7, 0xD3, 0xCF,
-    0x73, 0x94, 0x71, 0x83, 0x91, 0xD9, 0x4F, 0x2D, 0xEE, 0x76, 0x81, 0xFE, 0x3B, 0x4D, 0xD0, 0xDF,
-    0x99, 0x02, 0x20, 0xDD, 0x93, 0x01, 0xBD, 0xDF, 0x43, 0xC8, 0x18, 0xDD, 0x81, 0x8C, 0xC9, 0x0D,
-    0xC8, 0x98, 0x21, 0xFE, 0xD8, 0xB3, 0xD9, 0x1B, 0x6D, 0xD8, 0xDB, 0x0F, 0x6B, 0x20, 0xB2, 0xAD,
-    0x32, 0x46, 0x63, 0x0E, 0xD7, 0xB5, 0x68, 0x10, 0x0F, 0xC8, 0x98, 0x90, 0x66, 0x46, 0x19, 0x9F,
-    0xD9, 0xF3, 0x61, 0x57, 0xFD, 0x15, 0x63, 0x38, 0x80, 0x4F, 0xC5, 0x29, 0x4A, 0xD8, 0x37, 0x32,
-    0x3A, 0xC7, 0x01, 0xB9, 0x2C, 0x40, 0xAB, 0xC9, 0x1B, 0xF4, 0xD5, 0x21, 0xDB, 0x44, 0x7A, 0x6B,
-    0x91, 0xD5, 0xE2, 0x06, 0x59, 0x24, 0x21, 0x26, 0xB4, 0x35, 0x47, 0x5F, 0x95, 0x8E, 0x09, 0xE2,
-    0x46, 0xBB, 0x76, 0x90, 0x86, 0xBE, 0x24, 0x87, 0xE6, 0xD8, 0xE0, 0xEB, 0x94, 0x10, 0x2A, 0x4F,
-    0xC6, 0xB5, 0xDE, 0x68, 0x82, 0x0A, 0x38, 0xF4, 0x32, 0xC5, 0xB8, 0x1F, 0x59, 0x0E, 0xEB, 0x97,
-    0x53, 0x61, 0x53, 0xEC, 0xA2, 0x52, 0xCD, 0xB1, 0xC1, 0x61, 0x0B, 0xC4, 0x2A, 0x67, 0x92, 0x41,
-    0x8B, 0x0C, 0xC7, 0x72, 0x68, 0x96, 0xC3, 0x16, 0x18, 0x69, 0x21, 0x9D, 0xAB, 0xF1, 0x90, 0x05,
-    0x7A, 0x25, 0x82, 0x9B, 0x8D, 0x80, 0x4B, 0xDE, 0x48, 0x9B, 0x5D, 0x8B, 0xD3, 0x03, 0x7E, 0x7E,
-    0xD8, 0xCA, 0x59, 0x99, 0xE6, 0xAF, 0x2C, 0xAA, 0x4C, 0xDD, 0x7E, 0xB7, 0xDF, 0xA7, 0x72, 0x64,
-    0xD4, 0x91, 0x0C, 0xC4, 0xB0, 0x35, 0x02, 0x01, 0x0E, 0x09, 0xD9, 0xE0, 0xA3, 0x68, 0xE5, 0x4F,
-    0x21, 0xE6, 0xB6, 0xB5, 0xE4, 0x22, 0x91, 0xB1, 0x4A, 0x25, 0x5A, 0x87, 0x2B, 0x07, 0x6C, 0x14,
-    0xFE, 0xB0, 0xA6, 0xCE, 0xE6, 0xF3, 0x50, 0x05, 0x45, 0xDC, 0xAF, 0x02, 0x59, 0xD6, 0x6F, 0x2D,
-    0xE8, 0x51, 0xEB, 0x9E, 0xCC, 0xE4, 0xAF, 0x2C, 0xA3, 0xAD, 0xCE, 0x7F, 0x23, 0x6D, 0x54, 0xC2,
-    0x81, 0x33, 0xA3, 0x1C, 0xDB, 0xA9, 0xB1, 0xCD, 0x0E, 0x9D, 0xD3, 0x80, 0x4E, 0x42, 0xB4, 0x38,
-    0x4E, 0xA3, 0xDF, 0x34, 0x96, 0xFF, 0xB8, 0xD7, 0xF7, 0x90, 0x5E, 0x35, 0xE5, 0x0B, 0x6D, 0x07,
-    0xB4, 0x7A, 0x72, 0x42, 0xEC, 0xC2, 0xD2, 0x64, 0x0D, 0x1A, 0x7C, 0xAA, 0x85, 0x6D, 0x0F, 0xD7,
-    0xA3, 0x44, 0xB2, 0xDD, 0xF7, 0xA0, 0x96, 0xB0, 0xA7, 0x93, 0xD8, 0xCF, 0xB4, 0x99, 0x59, 0xE6,
-    0x7C, 0xAD, 0xB7, 0x8A, 0x40, 0x54, 0x65, 0xB9, 0x10, 0x5E, 0xB1, 0xAA, 0xF2, 0x45, 0xF6, 0xE4,
-    0x86, 0xE3, 0x00, 0x02, 0x86, 0xB0, 0xCB, 0x91, 0x7B, 0xEC, 0x4D, 0x26, 0x27, 0x59, 0xE6, 0xE4,
-    0xBA, 0x4F, 0x74, 0x5A, 0x4E, 0x19, 0x34, 0xA5, 0x28, 0xD8, 0x3F, 0x5A, 0x34, 0xF3, 0x21, 0xA4,
-    0xB6, 0x4E, 0x90, 0x23, 0xDD, 0xAB, 0x54, 0x0A, 0x06, 0xC1, 0x93, 0xF3, 0x15, 0xB3, 0xB9, 0x6F,
-    0x02, 0xDB, 0x6C, 0x7A, 0xD2, 0x8F, 0x01, 0xC7, 0xD6, 0xB0, 0x62, 0xAC, 0xE3, 0xD1, 0xB0, 0xE3,
-    0xC4, 0x2D, 0x2B, 0xA3, 0x96, 0x23, 0xD1, 0x02, 0xD6, 0xA7, 0xDD, 0x8B, 0x32, 0xAB, 0x8A, 0x2F,
-    0xA4, 0x04, 0x12, 0x2D, 0x13, 0x29, 0xCA, 0x90, 0x9E, 0x9E, 0xCE, 0xE7, 0x11, 0xD1, 0x1C, 0xE7,
-    0xE5, 0x8A, 0xF3, 0xE6, 0xD9, 0xE1, 0x89, 0xD0, 0x7F, 0x04, 0xD7, 0xB5, 0x8F, 0xE0, 0xBA, 0x27,
-    0x42, 0x9F, 0xBA, 0x1A, 0x02, 0x34, 0x61, 0xBB, 0xB5, 0x96, 0xA9, 0x6B, 0x50, 0xF7, 0xB1, 0xBD,
-    0x0E, 0xE7, 0x7A, 0x47, 0x0E, 0xEC, 0x70, 0x53, 0xE1, 0xEB, 0x35, 0xE7, 0xC7, 0x61, 0x17, 0xB5,
-    0xB3, 0x91, 0xF3, 0xC8, 0x93, 0x84, 0x3D, 0xE4, 0xC1, 0xA0, 0xE1, 0xAC, 0x6D, 0x26, 0x6F, 0x68,
-    0xFF, 0x09, 0x70, 0xB4, 0x85, 0x88, 0xB9, 0xD9, 0xB9, 0xB6, 0x96, 0x68, 0x31, 0xB9, 0xD1, 0x99,
-    0x04, 0x3B, 0x88, 0x4F, 0xD6, 0x7B, 0x01, 0xF9, 0x44, 0x76, 0x70, 0xCC, 0x59, 0x3B, 0x40, 0x27,
-    0x1D, 0x5E, 0xAC, 0xF4, 0xE2, 0x67, 0xF5, 0x80, 0x63, 0xE6, 0x89, 0x6A, 0x8A, 0x94, 0x36, 0x04,
-    0x8A, 0x1A, 0xE0, 0xF1, 0xEC, 0x9D, 0x41, 0x6F, 0x58, 0x93, 0x93, 0x63, 0xDC, 0x46, 0x03, 0x32,
-    0x4E, 0xCD, 0x5C, 0xC2, 0x78, 0x5A, 0x43, 0x07, 0xCD, 0xA4, 0xC0, 0xAE, 0x95, 0x93, 0xDD, 0x78,
-    0xE7, 0x8F, 0xF0, 0x0E, 0xAB, 0x38, 0x38, 0xE3, 0xFD, 0x36, 0x2A, 0x5D, 0xC5, 0xE1, 0x85, 0x54,
-    0xE0, 0xC2, 0x96, 0x6A, 0xB0, 0x16, 0x12, 0xA7, 0xF3, 0x4C, 0x3F, 0x63, 0x29, 0x64, 0x53, 0xDD,
-    0x45, 0xE3, 0x99, 0x93, 0x8C, 0xA6, 0x5A, 0x5D, 0xFD, 0xDB, 0x07, 0x44, 0xF2, 0x5B, 0x1E, 0x10,
-    0x79, 0xDA, 0x49, 0xB7, 0x3C, 0x5E, 0xE2, 0xE9, 0xC8, 0x2F, 0x89, 0xEB, 0x53, 0xF3, 0x46, 0xA3,
-    0xA7, 0x1D, 0x54, 0x05, 0x23, 0x81, 0x01, 0xCC, 0x64, 0x94, 0x4D, 0x81, 0x70, 0x7A, 0x42, 0xED,
-    0x48, 0x69, 0xEC, 0x7A, 0xA4, 0x94, 0x4A, 0x5E, 0xEE, 0x91, 0xC6, 0x91, 0xFE, 0xE4, 0x37, 0xF2,
-    0x3E, 0x76, 0xC9, 0x26, 0xBF, 0xB8, 0x9B, 0x32, 0x07, 0x90, 0x6F, 0xDC, 0xCD, 0xB4, 0xD1, 0xB7,
-    0x8A, 0xC7, 0x2F, 0x3B, 0x69, 0x59, 0x05, 0x80, 0x01, 0x98, 0x85, 0xC0, 0x81, 0x43, 0xBF, 0xA9,
-    0x1E, 0x7D, 0x6F, 0xCA, 0xAB, 0x66, 0xF2, 0x7E, 0xD7, 0x1D, 0x8E, 0x80, 0xBD, 0x2B, 0x93, 0xD4,
-    0xB1, 0x1E, 0x65, 0xB1, 0xA1, 0x6B, 0xA2, 0x21, 0x6A, 0x91, 0xBB, 0x5B, 0x12, 0xB7, 0x1F, 0x15,
-    0x0D, 0x6D, 0x57, 0xB0, 0x19, 0xBB, 0x9B, 0x6A, 0x32, 0x64, 0x09, 0xCF, 0xEA, 0x50, 0x9B, 0x52,
-    0xC8, 0xE2, 0x66, 0x0B, 0x04, 0x62, 0xF1, 0xC9, 0x86, 0x60, 0xD1, 0xEF, 0x8B, 0xF4, 0x40, 0xE3,
-    0xE9, 0xB9, 0xDE, 0x80, 0x94, 0x2D, 0xE8, 0x09, 0x70, 0x13, 0xCD, 0xFA, 0x51, 0xF1, 0x15, 0xCC,
-    0xC5, 0x83, 0xA8, 0x64, 0xE7, 0x32, 0xE9, 0x32, 0xFD, 0xA2, 0x02, 0xFC, 0x2D, 0x72, 0xBD, 0x25,
-    0xD2, 0xE0, 0xE7, 0x1A, 0xFB, 0x48, 0x09, 0x48, 0x9E, 0x35, 0xBB, 0x05, 0x2D, 0x83, 0x3E, 0x8C,
-    0xA3, 0xD5, 0x83, 0x45, 0x86, 0x1F, 0x51, 0x43, 0xF8, 0x71, 0x36, 0x7D, 0xE4, 0xDC, 0x88, 0x10,
-    0x36, 0x60, 0x19, 0x72, 0xA3, 0xDC, 0x69, 0x8F, 0x9C, 0x8B, 0x1A, 0x97, 0x08, 0x39, 0x35, 0xEE,
-    0xF9, 0x0F, 0x66, 0xC7, 0x2A, 0xCE, 0x4E, 0x1A, 0x76, 0x6F, 0x09, 0xC7, 0x51, 0xCC, 0xFD, 0xB4,
-    0x2B, 0xE0, 0x01, 0x3B, 0xEB, 0x16, 0xCD, 0xBB, 0xCD, 0x37, 0xA7, 0x01, 0xE0, 0x77, 0x24, 0x82,
-    0x76, 0x2E, 0xFA, 0x6A, 0x00, 0x85, 0x7D, 0x8D, 0x7C, 0x57, 0x31, 0xB4, 0xBE, 0x55, 0xBF, 0x36,
-    0xC1, 0xCE, 0x00, 0xA5, 0xB0, 0x28, 0x4C, 0x26, 0x44, 0x4E, 0xF8, 0x69, 0xD8, 0xEA, 0x38, 0xA5,
-    0xB8, 0xD3, 0x05, 0xF3, 0x73, 0x87, 0xD6, 0x02, 0x42, 0x46, 0x1D, 0x82, 0xA5, 0x43, 0x6B, 0xD6,
-    0xF2, 0xC8, 0x94, 0x67, 0x52, 0x28, 0xB3, 0x08, 0x47, 0x0D, 0x45, 0xB4, 0xFF, 0x3C, 0xB4, 0xAC,
-    0xF7, 0x22, 0x9A, 0x8D, 0xFB, 0x12, 0x9E, 0x6C, 0x95, 0xDA, 0x1F, 0xC6, 0xB0, 0xC3, 0x5E, 0xAF,
-    0x16, 0x5D, 0x97, 0xD4, 0xEB, 0x81, 0x69, 0x93, 0x2D, 0x6A, 0xE3, 0x96, 0x68, 0xFB, 0x07, 0xE1,
-    0x79, 0xA8, 0x02, 0x3F, 0xE9, 0x78, 0x9E, 0x90, 0x52, 0xF1, 0x0A, 0x07, 0x2C, 0x8A, 0xBB, 0xA2,
-    0x01, 0x67, 0x17, 0xBF, 0x9F, 0xD6, 0x1D, 0x08, 0x99, 0xDC, 0x0D, 0x7F, 0xF6, 0x73, 0x7B, 0x28,
-    0x39, 0x03, 0x8E, 0xE3, 0x2B, 0xF9, 0xA7, 0x9C, 0x42, 0xCB, 0x69, 0xEB, 0x70, 0x40, 0x0F, 0xF7,
-    0xB0, 0x37, 0xC5, 0xD5, 0xDA, 0x1F, 0x8B, 0x3C, 0xFA, 0x66, 0x34, 0xD9, 0x07, 0xBD, 0x3F, 0xC6,
-    0x5D, 0xD6, 0x58, 0x2D, 0xA9, 0x9D, 0x9E, 0xD4, 0x7A, 0xE6, 0x71, 0x21, 0xF3, 0xBD, 0x29, 0xAF,
-    0xBA, 0x4E, 0x08, 0xFA, 0xE2, 0x08, 0x67, 0xF4, 0xBB, 0xF9, 0x04, 0xE7, 0x7B, 0x53, 0x56, 0xB0,
-    0xF9, 0x82, 0xB1, 0xE3, 0x86, 0xE1, 0x9C, 0x9F, 0x0D, 0xF6, 0xCA, 0x94, 0xAD, 0x12, 0x4E, 0x66,
-    0x79, 0x42, 0xCD, 0x60, 0x5C, 0x6B, 0x93, 0x16, 0xD8, 0xA6, 0x46, 0x77, 0x50, 0xEA, 0xD5, 0xF1,
-    0x24, 0x1C, 0x17, 0x40, 0xBF, 0x4B, 0xB2, 0xD9, 0x67, 0x3A, 0x2E, 0x44, 0x1B, 0x3E, 0xC2, 0x39,
-    0x3E, 0x67, 0x53, 0xA0, 0xE7, 0xAA, 0x1A, 0x8C, 0x5D, 0x71, 0x70, 0x0A, 0x34, 0x83, 0xD1, 0x33,
-    0x1D, 0xCA, 0x37, 0xF6, 0x41, 0xF1, 0x31, 0xEA, 0xD0, 0x25, 0xB4, 0xF0, 0x20, 0x4A, 0xC9, 0xEF,
-    0x75, 0x46, 0x20, 0xF9, 0x00, 0xBA, 0xF7, 0x01, 0x67, 0x5E, 0x1B, 0x63, 0x3A, 0x54, 0x4D, 0xB2,
-    0x21, 0x47, 0x07, 0xE9, 0x34, 0x57, 0x45, 0x26, 0x44, 0xAB, 0xAE, 0x3D, 0xAA, 0x6B, 0x7C, 0x98,
-    0xBB, 0xDF, 0x9C, 0x1F, 0xF9, 0xAD, 0xA2, 0xC6, 0x1E, 0xE3, 0x59, 0x88, 0x3B, 0x53, 0xC8, 0xF0,
-    0x96, 0x9B, 0x68, 0x1C, 0x01, 0xF7, 0x2D, 0x9E, 0x20, 0xD7, 0x81, 0x4E, 0xAC, 0x4E, 0xA1, 0xBE,
-    0xA1, 0x31, 0x92, 0x97, 0xA4, 0xC9, 0xAE, 0x4B, 0x1F, 0xDF, 0xDE, 0x19, 0xC3, 0xED, 0xBE, 0x78,
-    0x75, 0x44, 0x2F, 0x54, 0xF4, 0xA8, 0x82, 0x43, 0x04, 0xA7, 0xE6, 0xD9, 0x93, 0x0E, 0xAD, 0x00,
-    0xEC, 0x8A, 0x6D, 0x13, 0xA6, 0xF3, 0xEA, 0x41, 0x77, 0xD2, 0x59, 0x98, 0x22, 0x35, 0xF6, 0xCB,
-    0xD9, 0x3E, 0x74, 0x87, 0x83, 0xF6, 0x3C, 0xF0, 0xF3, 0xE9, 0x87, 0xF4, 0x4E, 0x1E, 0x03, 0xF2,
-    0xB8, 0x0F, 0xEE, 0x2A, 0x7A, 0xDA, 0xC7, 0xB3, 0x40, 0xA2, 0x51, 0x62, 0x45, 0x60, 0x35, 0x54,
-    0xE5, 0x53, 0x58, 0x27, 0x5B, 0x55, 0x24, 0xB7, 0x90, 0xC6, 0x3E, 0xEA, 0x27, 0x2B, 0x11, 0x91,
-    0x90, 0x0D, 0x13, 0x2B, 0x77, 0xAD, 0x6E, 0x3B, 0x85, 0xCD, 0x93, 0xE3, 0xC2, 0x09, 0x25, 0x41,
-    0x57, 0xC1, 0xC3, 0x9A, 0xB3, 0xC8, 0x59, 0x40, 0x57, 0xC7, 0xA7, 0x23, 0xD9, 0x27, 0xC6, 0x25,
-    0xBC, 0xD0, 0x9A, 0xB0, 0x81, 0x8F, 0x20, 0x9D, 0x3D, 0xD2, 0xB3, 0xA2, 0xBA, 0x36, 0x49, 0x1D,
-    0xA0, 0xF1, 0x9B, 0x71, 0xBC, 0x03, 0xAF, 0x80, 0x52, 0x19, 0xB4, 0x09, 0xBC, 0x0E, 0x31, 0x3C,
-    0x32, 0x8A, 0x53, 0xC6, 0x71, 0x56, 0x32, 0xF8, 0xE3, 0x2E, 0x18, 0x12, 0xFE, 0x2D, 0x43, 0x01,
-    0x2E, 0x67, 0x51, 0x28, 0x5F, 0x6E, 0xD4, 0xE7, 0xE6, 0x2D, 0x55, 0xF1, 0x98, 0x96, 0x8A, 0xE7,
-    0x43, 0x3C, 0x8D, 0xE5, 0x5F, 0x75, 0xB0, 0x2B, 0x60, 0x2F, 0x60, 0x4B, 0xCD, 0x76, 0x78, 0x2D,
-    0xA9, 0x38, 0xFF, 0xFB, 0x98, 0xA7, 0x7C, 0x77, 0x78, 0x66, 0xF1, 0x25, 0xFF, 0x6C, 0x60, 0x8B,
-    0xA7, 0xC7, 0xCC, 0x56, 0x21, 0x01, 0xAF, 0x9E, 0x2F, 0x70, 0x82, 0xE6, 0xB0, 0xAA, 0x62, 0x74,
-    0x37, 0x9D, 0xC6, 0xB2, 0xE7, 0xF5, 0xC8, 0x41, 0xD1, 0xF5, 0x30, 0x1F, 0xAA, 0xCC, 0xBB, 0x15,
-    0xD7, 0x35, 0xB8, 0xBF, 0x7A, 0x68, 0xE6, 0xBE, 0x53, 0x51, 0x48, 0x30, 0x9E, 0xFE, 0x2A, 0x02,
-    0x11, 0xF0, 0x00, 0xE5, 0xA7, 0x0F, 0x7B, 0xCF, 0xA5, 0x2D, 0xA4, 0x32, 0x8A, 0x4B, 0xF0, 0x4D,
-    0x25, 0xE4, 0x78, 0xD6, 0x86, 0x83, 0x8F, 0x5A, 0xF3, 0x40, 0x2A, 0x37, 0x4C, 0x87, 0xCD, 0x10,
-    0x2F, 0xF9, 0x6C, 0xF4, 0x1C, 0xC3, 0x6F, 0xB7, 0x0F, 0x91, 0x8B, 0xBF, 0xC7, 0x76, 0x53, 0x87,
-    0xAF, 0x97, 0xFF, 0x02, 0xC5, 0x5B, 0x3D, 0x93, 0xE5, 0x54, 0x7A, 0x3E, 0x92, 0xB6, 0x51, 0x15,
-    0x0A, 0xB4, 0xC1, 0x74, 0xB2, 0x1B, 0x28, 0x71, 0xE2, 0xAD, 0x2D, 0xF4, 0x0F, 0x90, 0x58, 0xAA,
-    0x4C, 0x40, 0x30, 0x1D, 0xF4, 0xEC, 0x56, 0x99, 0x80, 0xC4, 0x91, 0xD7, 0x55, 0xE3, 0x1F, 0x60,
-    0x23, 0x61, 0x02, 0x57, 0x39, 0x61, 0xFE, 0x01, 0x13, 0x10, 0x8C, 0xDB, 0xC1, 0x24, 0x0E, 0x01,
-    0x09, 0x26, 0x20, 0x98, 0x60, 0x04, 0x53, 0x36, 0x81, 0x83, 0xBD, 0x78, 0xC1, 0x5B, 0x35, 0x13,
-    0x8C, 0x00, 0xB1, 0xAB, 0xE9, 0x96, 0x74, 0xFC, 0x3C, 0xCF, 0x39, 0xBA, 0xF7, 0xF6, 0x7C, 0x60,
-    0xBC, 0x40, 0xD3, 0x53, 0x57, 0xD3, 0x7D, 0xAF, 0x74, 0xCE, 0xFB, 0xFD, 0x3E, 0xEF, 0xFB, 0x9E,
-    0x6B, 0xCC, 0x33, 0x27, 0x37, 0x8C, 0x49, 0xED, 0xE4, 0x2F, 0x07, 0x57, 0x8E, 0x8C, 0xFB, 0x89,
-    0x6C, 0x69, 0x4C, 0x62, 0x6B, 0x7E, 0x80, 0x4B, 0x6E, 0x5B, 0x63, 0x8A, 0x07, 0xB8, 0x34, 0x57,
-    0x71, 0xB1, 0x79, 0x6B, 0xC2, 0x19, 0x97, 0x68, 0xCA, 0x3A, 0x93, 0x0C, 0xB8, 0x64, 0x7D, 0xB6,
-    0x31, 0x45, 0x87, 0x4B, 0x75, 0xEF, 0xE6, 0xC6, 0x58, 0x6B, 0xFB, 0x80, 0x97, 0x88, 0x97, 0x78,
-    0x32, 0x69, 0x9F, 0x8E, 0xB8, 0x64, 0xBD, 0x49, 0x87, 0x62, 0x83, 0x4B, 0xD5, 0x9A, 0x64, 0x34,
-    0xCF, 0x9E, 0x5C, 0xC7, 0xE2, 0x83, 0x29, 0x6C, 0x6F, 0x0E, 0xFD, 0xEE, 0x45, 0xFF, 0x5E, 0x60,
-    0xA7, 0x25, 0xB6, 0x76, 0x4E, 0x97, 0xAB, 0x53, 0x36, 0xA6, 0x53, 0xD1, 0x27, 0x63, 0xD1, 0x25,
-    0x63, 0xD5, 0xA6, 0x43, 0xD3, 0xA6, 0x7D, 0xD3, 0x66, 0x78, 0x15, 0x9B, 0xA6, 0xAD, 0xBA, 0xE6,
-    0x7F, 0x6C, 0x5B, 0x59, 0xDB, 0xE6, 0xB6, 0x69, 0x93, 0xB9, 0xA8, 0x4D, 0xC9, 0x45, 0x0E, 0xCC,
-    0xA1, 0x31, 0x59, 0xF9, 0x3C, 0x2E, 0xF7, 0xC4, 0xDE, 0x48, 0xA6, 0x3A, 0x7C, 0x72, 0xC9, 0x5C,
-    0x30, 0x8F, 0x87, 0xD8, 0xB2, 0x30, 0xEF, 0x98, 0xE2, 0xFE, 0x68, 0x32, 0xF0, 0x19, 0x73, 0x23,
-    0x4F, 0xC5, 0xF7, 0xC2, 0xAB, 0x18, 0xC9, 0x17, 0xFC, 0x46, 0x2E, 0x13, 0x6C, 0x21, 0x3E, 0xC2,
-    0xB9, 0x01, 0x6B, 0x5F, 0x82, 0xFB, 0xE6, 0xE5, 0xDE, 0xB1, 0x91, 0x77, 0x55, 0x19, 0xD8, 0x60,
-    0x01, 0x6D, 0xF1, 0x28, 0x2E, 0x48, 0x7B, 0x9B, 0xE1, 0x42, 0x76, 0x26, 0x31, 0x01, 0xD2, 0x8B,
-    0xF7, 0x2D, 0x16, 0xBB, 0x3C, 0x9A, 0x68, 0x76, 0x3C, 0x18, 0xF3, 0x1A, 0x5E, 0xC9, 0xC6, 0xFF,
-    0x12, 0x0E, 0xB8, 0xA4, 0xA7, 0xB8, 0x64, 0x58, 0xDE, 0xE4, 0x1B, 0xB3, 0xFD, 0xF9, 0xCE, 0x1C,
-    0xBD, 0x0B, 0x86, 0xB0, 0x7C, 0x02, 0x5D, 0xA5, 0x10, 0x54, 0xFA, 0x10, 0xAF, 0x19, 0x5B, 0xCE,
-    0xEB, 0x0E, 0x87, 0xE0, 0x36, 0xB4, 0xDC, 0xBB, 0x27, 0xCB, 0xA4, 0x84, 0xFB, 0x1F, 0xAE, 0x9F,
-    0xE7, 0xF6, 0x1A, 0x84, 0x00, 0x29, 0x80, 0xA3, 0x3A, 0xB5, 0xF7, 0x27, 0x83, 0xDF, 0xAF, 0xC7,
-    0x8B, 0x88, 0x33, 0x26, 0x90, 0xDA, 0x49, 0x76, 0xC1, 0xC7, 0xF8, 0x57, 0xC4, 0xB5, 0x33, 0xF2,
-    0x54, 0x75, 0xEB, 0x5B, 0xBC, 0x1D, 0xFB, 0xFE, 0xC4, 0x64, 0xCB, 0x5F, 0xF7, 0xB0, 0x4F, 0x28,
-    0x0D, 0x17, 0xDC, 0x66, 0x3F, 0xC3, 0x1A, 0xB2, 0xD4, 0x43, 0x5C, 0x61, 0x39, 0x50, 0xBA, 0x69,
-    0x4A, 0x13, 0x0F, 0x5B, 0x1A, 0x12, 0xBB, 0x81, 0x61, 0xB4, 0xA9, 0x5D, 0x8C, 0xFD, 0xFC, 0xDF,
-    0x93, 0x59, 0x5B, 0x71, 0x5F, 0xC8, 0xD7, 0xE4, 0xA0, 0xA1, 0xA9, 0x4D, 0xB8, 0x38, 0x2A, 0xB2,
-    0xF9, 0x15, 0x2C, 0x3C, 0x99, 0xCA, 0x72, 0x97, 0x12, 0x86, 0x4B, 0xEB, 0x3D, 0x26, 0x2D, 0x58,
-    0x30, 0xA6, 0x32, 0xAB, 0x37, 0x37, 0x30, 0xC0, 0xB4, 0xC3, 0xF2, 0x07, 0x17, 0xCC, 0x63, 0x00,
-    0x42, 0x8A, 0x09, 0x16, 0x36, 0x9A, 0xE2, 0xC3, 0x3E, 0x1A, 0x93, 0xFE, 0xA0, 0x3C, 0x28, 0xBF,
-    0x17, 0x1E, 0xF5, 0x93, 0x89, 0x96, 0xD6, 0xD3, 0x92, 0xF4, 0x66, 0xEF, 0xE7, 0xC2, 0xF4, 0xC8,
-    0xBD, 0x5A, 0x13, 0xE3, 0x61, 0x18, 0x7B, 0x34, 0xAE, 0xFB, 0x87, 0x76, 0x24, 0x87, 0x85, 0x1D,
-    0xD3, 0xE5, 0x95, 0x5F, 0x61, 0x31, 0xEC, 0xE3, 0x6F, 0xE2, 0xB6, 0xE0, 0x8F, 0x8E, 0xD1, 0xE0,
-    0x49, 0xFB, 0x6B, 0xDC, 0x35, 0xF1, 0xE6, 0x08, 0xB1, 0x2C, 0x28, 0xB5, 0xF0, 0x11, 0xD8, 0xC1,
-    0xB2, 0xE9, 0xEF, 0x29, 0x00, 0xC5, 0x96, 0xC9, 0x1B, 0xEF, 0x85, 0x72, 0x77, 0x64, 0x8E, 0xCD,
-    0x0C, 0xA6, 0x2A, 0xC6, 0x2E, 0x58, 0x6B, 0xB6, 0x78, 0xF3, 0x12, 0x0D, 0xB5, 0x23, 0x1A, 0x14,
-    0x2C, 0xAF, 0x94, 0xF9, 0xE0, 0x76, 0xE3, 0xF2, 0x55, 0x2B, 0xD6, 0xC8, 0xA5, 0x7B, 0xE1, 0xF7,
-    0xEA, 0xEB, 0xBF, 0x93, 0x1A, 0x33, 0x4B, 0x8B, 0x18, 0x7C, 0x10, 0x3B, 0xC6, 0x3F, 0xB3, 0x84,
-    0x20, 0xB5, 0xB8, 0xDC, 0xFB, 0x30, 0x9A, 0x5A, 0xB3, 0xDB, 0x05, 0xCF, 0x5C, 0xE3, 0x05, 0x1B,
-    0xD3, 0xD3, 0x4D, 0x63, 0x2D, 0x82, 0x67, 0x5D, 0x81, 0xF5, 0x32, 0x1B, 0xE1, 0xC0, 0x29, 0xE4,
-    0x0C, 0x5E, 0x43, 0x5E, 0xC0, 0x11, 0x2E, 0x33, 0xDE, 0x8B, 0x10, 0x8B, 0x46, 0x18, 0x53, 0x36,
-    0x40, 0x0C, 0x39, 0x43, 0x6B, 0xB5, 0x49, 0x07, 0x18, 0x4B, 0xD6, 0xC7, 0xB6, 0xCE, 0x4E, 0xB1,
-    0x5E, 0x6E, 0x69, 0x97, 0x16, 0x61, 0xBD, 0xB0, 0xE3, 0x9E, 0xE5, 0x54, 0xB7, 0x28, 0xB8, 0xEA,
-    0x43, 0xCA, 0xAA, 0x79, 0x53, 0xF2, 0xBB, 0xDC, 0xF2, 0xFA, 0x2C, 0x4D, 0x9A, 0xB4, 0x15, 0x5F,
-    0x2C, 0xFC, 0x6D, 0x59, 0xE8, 0x62, 0x16, 0x82, 0x65, 0xAC, 0xA2, 0x74, 0x53, 0xF2, 0xD1, 0x53,
-    0xB1, 0x88, 0x58, 0x03, 0xE5, 0x80, 0x3D, 0x0D, 0xA3, 0x16, 0xE5, 0x90, 0xE9, 0xCA, 0x70, 0xC7,
-    0xD8, 0x85, 0xEB, 0xA7, 0x52, 0x2C, 0xB9, 0x02, 0x31, 0xCC, 0x1D, 0xC9, 0x82, 0x18, 0x66, 0x5C,
-    0x5C, 0x76, 0x8C, 0x93, 0x46, 0xEC, 0x31, 0x39, 0x6A, 0xC9, 0x37, 0xD8, 0x03, 0x2B, 0x3D, 0x7F,
-    0x6F, 0x43, 0x2B, 0xB6, 0x61, 0x08, 0xF9, 0x57, 0x50, 0x83, 0x7D, 0xCB, 0xCE, 0xD1, 0x92, 0x2F,
-    0xD7, 0xB3, 0x01, 0x3E, 0xD4, 0xB4, 0xB6, 0x8E, 0x17, 0xDC, 0x5E, 0xF4, 0x62, 0xBA, 0xBA, 0x6F,
-    0xC7, 0xD0, 0xD9, 0x8B, 0x72, 0xE6, 0x8E, 0x67, 0x31, 0x45, 0x73, 0x91, 0x98, 0xFD, 0x96, 0x9D,
-    0x42, 0x64, 0x70, 0x54, 0xD5, 0xA6, 0xF9, 0x72, 0xA1, 0xB5, 0x0D, 0x14, 0x3E, 0xF4, 0xFD, 0x92,
-    0x75, 0x12, 0xB5, 0x65, 0xDE, 0x41, 0xC4, 0x0D, 0xFE, 0x82, 0xB8, 0x9B, 0x3A, 0xED, 0xE1, 0xB2,
-    0x4D, 0x2D, 0x0D, 0xE4, 0x63, 0xE5, 0x2D, 0xAA, 0x59, 0x90, 0x48, 0x9A, 0xFF, 0x1E, 0xBD, 0xC2,
-    0x83, 0x93, 0x13, 0x6E, 0xD1, 0x2A, 0x69, 0xAF, 0x90, 0x01, 0x14, 0x31, 0x97, 0xD0, 0x63, 0x66,
-    0x6E, 0x22, 0x43, 0xA2, 0xE8, 0xB0, 0xAE, 0xA3, 0xAE, 0xB9, 0xF7, 0xAF, 0x5C, 0xAE, 0x4C, 0x9D,
-    0xC5, 0xF5, 0xEE, 0xCD, 0xDA, 0x6C, 0xEF, 0x8C, 0x75, 0x27, 0x10, 0x89, 0x1E, 0x77, 0x5C, 0xE2,
-    0xA3, 0x9F, 0x01, 0x22, 0xB8, 0x47, 0xB6, 0x9B, 0x55, 0xB0, 0x0F, 0xC6, 0x1D, 0x3B, 0xA5, 0x33,
-    0xB3, 0x6C, 0x7E, 0x17, 0x7F, 0x5C, 0x1E, 0xAE, 0x4E, 0xB0, 0xAF, 0x0F, 0x40, 0x44, 0xB2, 0xBC,
-    0x6D, 0x9C, 0x92, 0xB0, 0x60, 0xFD, 0xCB, 0xC8, 0xE5, 0x68, 0xC8, 0xFA, 0xA1, 0x63, 0x21, 0x28,
-    0xE1, 0xA3, 0xCF, 0x1B, 0x58, 0xF1, 0x82, 0xC0, 0x9D, 0x33, 0xC6, 0x36, 0xA3, 0x7C, 0xC5, 0x03,
-    0x03, 0x67, 0x56, 0x75, 0xEC, 0x25, 0xA6, 0x10, 0x2F, 0x87, 0x4B, 0x7B, 0xCF, 0x4D, 0x7E, 0x7A,
-    0x52, 0x46, 0x4E, 0x0B, 0x96, 0x0F, 0xF4, 0xF2, 0x18, 0x65, 0x4A, 0x21, 0x8A, 0xC1, 0xDF, 0x97,
-    0x9D, 0x9E, 0xD4, 0x21, 0xB5, 0xCF, 0xF5, 0xB4, 0x30, 0x28, 0x38, 0x0E, 0x86, 0x68, 0x13, 0x9D,
-    0x36, 0x25, 0x61, 0x09, 0x11, 0x48, 0xE0, 0xEC, 0x25, 0x86, 0xCA, 0xC0, 0x33, 0x25, 0x64, 0x3B,
-    0xFB, 0xD2, 0x14, 0xCE, 0x05, 0x4C, 0xDE, 0xFE, 0x95, 0xFD, 0x10, 0x2B, 0xC0, 0x7C, 0xEA, 0xE6,
-    0x5E, 0xB9, 0x8D, 0xA9, 0x63, 0xD8, 0x16, 0x12, 0xD4, 0xA4, 0x58, 0x12, 0xAC, 0x81, 0x85, 0x01,
-    0x4C, 0xE9, 0x91, 0x2E, 0xAB, 0xF8, 0xEA, 0x7F, 0x2C, 0x44, 0x46, 0x2A, 0x90, 0xED, 0x3B, 0x46,
-    0x1E, 0x05, 0x0F, 0x32, 0x55, 0xB4, 0x2E, 0x97, 0x26, 0xCB, 0xC9, 0x35, 0xF1, 0xE4, 0xE9, 0x75,
-    0x6F, 0x8E, 0x3E, 0xCC, 0xF0, 0x4E, 0xF2, 0x48, 0x8E, 0x12, 0x27, 0xD1, 0x51, 0x6B, 0xBA, 0x5D,
-    0xD7, 0xA8, 0x8F, 0x3B, 0xB6, 0x99, 0xFA, 0x3B, 0x33, 0xB4, 0x5A, 0x01, 0x15, 0x21, 0x29, 0x52,
-    0xB6, 0x45, 0xE7, 0xF4, 0x40, 0x7B, 0x09, 0xED, 0xC9, 0xDB, 0x86, 0x26, 0xC7, 0x27, 0xB9, 0x8D,
-    0xDE, 0x5C, 0xBC, 0x16, 0x0A, 0xE7, 0x01, 0x26, 0x5E, 0x4E, 0xAE, 0xBB, 0xC7, 0xBD, 0x08, 0xF0,
-    0x91, 0xD9, 0xBD, 0x32, 0xD0, 0x1C, 0x9F, 0xFA, 0x44, 0x94, 0xED, 0xE7, 0xA0, 0x3F, 0xDB, 0xD0,
-    0x66, 0xB7, 0xEA, 0xE4, 0x30, 0x0C, 0x37, 0x59, 0x6A, 0xE1, 0x34, 0xC6, 0x49, 0x98, 0xDF, 0x11,
-    0xDE, 0xAF, 0x60, 0x7A, 0xB7, 0x19, 0x72, 0x25, 0x59, 0xC6, 0xAA, 0x2B, 0x5E, 0x87, 0x32, 0x7C,
-    0xD2, 0x29, 0x6F, 0x52, 0x96, 0xD8, 0x65, 0x81, 0x69, 0x45, 0x3E, 0x74, 0x28, 0xA9, 0x2B, 0x5D,
-    0xC3, 0xBE, 0x8B, 0x02, 0xE3, 0x7E, 0xD2, 0x88, 0x27, 0x6F, 0x84, 0xB2, 0x63, 0xE9, 0xCC, 0xB9,
-    0xD5, 0x25, 0xA0, 0x09, 0xD0, 0x50, 0x87, 0x13, 0x5C, 0x80, 0x24, 0xC4, 0x14, 0xCB, 0x4A, 0x01,
-    0x18, 0x37, 0x0A, 0xD3, 0x14, 0x5A, 0x67, 0x4B, 0xB0, 0xDE, 0x51, 0x75, 0x29, 0x78, 0x67, 0x30,
-    0x0B, 0xB9, 0x10, 0x94, 0x27, 0xEE, 0x13, 0x39, 0x6E, 0xFD, 0xCB, 0xD5, 0x17, 0x5A, 0xE9, 0xCF,
-    0x07, 0x8B, 0x2B, 0x74, 0x16, 0x69, 0x0A, 0x74, 0xE5, 0x9F, 0x0C, 0x60, 0x20, 0x46, 0xD8, 0xF0,
-    0x28, 0xC2, 0x65, 0xAA, 0xC4, 0x99, 0x12, 0xD1, 0xC4, 0x3D, 0xC4, 0x9F, 0xC1, 0xFC, 0x45, 0x6C,
-    0xB7, 0x79, 0xB0, 0xDE, 0xE6, 0x41, 0x14, 0x0B, 0x88, 0x81, 0xF6, 0x8D, 0x19, 0xF2, 0x45, 0x56,
-    0xB0, 0x3D, 0x42, 0x70, 0xD5, 0x5A, 0x58, 0x50, 0x44, 0x44, 0x8B, 0x3C, 0x58, 0xB4, 0xD9, 0xF2,
-    0x8A, 0x65, 0xA4, 0x55, 0xB8, 0xDD, 0x60, 0xF5, 0x87, 0xAB, 0x5F, 0x33, 0xF3, 0x16, 0x8A, 0x90,
-    0x35, 0xB1, 0x8C, 0x29, 0xEA, 0x66, 0x47, 0x46, 0xD5, 0xBF, 0x87, 0xE4, 0x54, 0x60, 0x75, 0xDB,
-    0x15, 0x0F, 0x9B, 0x9E, 0x89, 0x20, 0x9D, 0x42, 0xC6, 0xDE, 0xE6, 0x75, 0xD8, 0x64, 0xC7, 0x0C,
-    0x90, 0x03, 0xE4, 0x33, 0x43, 0x31, 0x66, 0x97, 0x04, 0xAE, 0x99, 0xF4, 0x7D, 0x86, 0xBD, 0xBE,
-    0xDC, 0xF7, 0xA5, 0xA2, 0x8F, 0x3F, 0x6F, 0x86, 0x80, 0x4C, 0x55, 0x78, 0x3D, 0x63, 0x37, 0x2E,
-    0x4F, 0x1E, 0x99, 0xA8, 0x4F, 0x00, 0x1E, 0x4E, 0x95, 0xA0, 0x7B, 0x5E, 0x14, 0x8C, 0xCC, 0xC5,
-    0x4A, 0xE2, 0x00, 0xFF, 0xA2, 0x0D, 0xEC, 0xD2, 0xDE, 0xDC, 0x88, 0x8E, 0x90, 0x04, 0xAE, 0xFA,
-    0xB8, 0x00, 0x49, 0x38, 0x8C, 0x4C, 0x13, 0xA6, 0x83, 0x0A, 0xE9, 0x44, 0xFB, 0xE9, 0xFB, 0xE2,
-    0x6C, 0x42, 0xCE, 0xC6, 0x00, 0x31, 0xAF, 0xB8, 0xA0, 0xDC, 0x73, 0xFE, 0x8B, 0x91, 0x04, 0x50,
-    0x48, 0x49, 0xE7, 0x64, 0xA0, 0x83, 0xB3, 0x2D, 0x37, 0x37, 0x09, 0xC8, 0x2F, 0x91, 0x7C, 0xE1,
-    0x4B, 0x14, 0xC6, 0xE8, 0x63, 0x39, 0x18, 0x3A, 0x39, 0x01, 0x24, 0xB2, 0x28, 0xA6, 0x72, 0xFB,
-    0x11, 0xB6, 0xB3, 0xA0, 0x3B, 0x9E, 0x90, 0x6B, 0xF2, 0x0D, 0x1C, 0xDE, 0x96, 0xB6, 0x8B, 0x80,
-    0x42, 0x3F, 0x6F, 0x7A, 0x82, 0x04, 0x44, 0x21, 0x84, 0x2E, 0xEC, 0x78, 0xCD, 0xEC, 0x00, 0x37,
-    0x21, 0x8D, 0xE8, 0x09, 0x28, 0xBE, 0xB4, 0xDB, 0xD6, 0x4D, 0xC4, 0x8A, 0xE1, 0xE8, 0xDF, 0x27,
-    0xE1, 0x88, 0x0A, 0x5B, 0xB0, 0x5A, 0xFC, 0xF0, 0x92, 0x50, 0x9C, 0x08, 0xF8, 0x7B, 0xC0, 0x4E,
-    0x44, 0x40, 0x18, 0x15, 0xCC, 0x2C, 0x04, 0x8F, 0xB7, 0x15, 0x3B, 0xC4, 0x32, 0xD3, 0x64, 0x00,
-    0x1B, 0x99, 0x6E, 0x05, 0x0B, 0x89, 0x17, 0x89, 0x63, 0x22, 0xF7, 0x89, 0x71, 0x9F, 0x2C, 0x27,
-    0x8D, 0xAA, 0x72, 0x59, 0x90, 0x92, 0xC3, 0xFA, 0x09, 0x9E, 0xD9, 0xD0, 0x32, 0xFC, 0x33, 0x55,
-    0x1B, 0xAC, 0x9F, 0x8C, 0xFC, 0x64, 0x66, 0xE6, 0xD6, 0x27, 0x82, 0xAF, 0xC4, 0xB1, 0x28, 0x74,
-    0x4C, 0xF2, 0xF5, 0xCC, 0xC2, 0xBE, 0x0D, 0x8E, 0xD6, 0x8A, 0xE1, 0x5C, 0xDE, 0xDC, 0x4F, 0x91,
-    0xC5, 0xED, 0xD9, 0x64, 0x0F, 0x94, 0x61, 0xA7, 0xC8, 0x7E, 0x82, 0xBA, 0xBA, 0xAD, 0x5A, 0xC2,
-    0xBD, 0x8C, 0xF2, 0x19, 0x25, 0x34, 0x68, 0x0A, 0xD4, 0x56, 0xAB, 0xD0, 0xF6, 0xDE, 0xC4, 0xBD,
-    0x5C, 0x51, 0x4C, 0x3A, 0x3A, 0x88, 0x80, 0xC5, 0x0B, 0xEC, 0x9B, 0xD7, 0xBE, 0xB2, 0xF2, 0x8A,
-    0x9E, 0x37, 0x89, 0x7C, 0xE4, 0xC0, 0x9B, 0x13, 0xA3, 0xBA, 0x4B, 0x1A, 0x7C, 0x90, 0x96, 0xA4,
-    0x07, 0x8D, 0x50, 0x24, 0x92, 0x21, 0xE8, 0x73, 0xCC, 0x89, 0x59, 0xBC, 0x07, 0x88, 0x10, 0x4A,
-    0x76, 0x78, 0x8F, 0x15, 0xBF, 0x76, 0x74, 0xDA, 0xEE, 0xC4, 0x5A, 0x22, 0xDF, 0x73, 0x2F, 0x7D,
-    0x66, 0x91, 0xB7, 0x6C, 0x3E, 0x84, 0x0B, 0x20, 0x2A, 0x4C, 0x2B, 0xB2, 0x77, 0x6D, 0x64, 0x03,
-    0xD8, 0x60, 0x60, 0x01, 0xDE, 0x17, 0x20, 0xF6, 0x39, 0x05, 0xB6, 0x05, 0xB5, 0x13, 0xD9, 0xCA,
-    0x37, 0xAC, 0xFA, 0xD3, 0xA1, 0x00, 0xAD, 0x8E, 0x2B, 0x55, 0xEA, 0xCF, 0x99, 0x62, 0x79, 0x17,
-    0xF6, 0x3E, 0x19, 0x22, 0xDC, 0xA3, 0xC0, 0xFB, 0x1A, 0x68, 0x6F, 0x94, 0x6F, 0x5A, 0x54, 0x8B,
-    0x0E, 0x3F, 0xD1, 0x31, 0xF9, 0x18, 0x61, 0x05, 0xF3, 0x99, 0xA7, 0xCB, 0x95, 0x26, 0xB5, 0xCB,
-    0xF0, 0xA0, 0x8B, 0x7E, 0xCB, 0x17, 0xC3, 0x43, 0xE1, 0x97, 0x69, 0xAC, 0xC3, 0x3D, 0x4B, 0xD8,
-    0xDB, 0xD3, 0x01, 0x9B, 0x3D, 0x9F, 0x4C, 0x07, 0xCE, 0x8E, 0x90, 0x3F, 0x79, 0x37, 0x84, 0xA2,
-    0x16, 0x0D, 0xC5, 0xA4, 0xBF, 0x6B, 0xAE, 0xEF, 0xFE, 0x0E, 0x77, 0x7F, 0xF7, 0x2E, 0x81, 0x12,
-    0x83, 0x36, 0x2B, 0x06, 0x3D, 0x76, 0x5E, 0x6B, 0x81, 0x82, 0x16, 0x61, 0x60, 0x12, 0x4C, 0xE2,
-    0xAC, 0xD9, 0x16, 0xBF, 0xA0, 0x8D, 0x36, 0x44, 0x16, 0x40, 0x2E, 0x01, 0x49, 0xAA, 0x92, 0xC2,
-    0x51, 0x3A, 0x31, 0xB8, 0xA8, 0x27, 0x05, 0x62, 0x43, 0x6A, 0xEC, 0x99, 0x93, 0x1B, 0x29, 0x40,
-    0x86, 0x9D, 0x3C, 0xC4, 0x55, 0x2E, 0x07, 0x1D, 0x4E, 0x6D, 0xB1, 0xB4, 0xE9, 0x74, 0xE5, 0x54,
-    0x88, 0x3D, 0x72, 0x29, 0x0D, 0x02, 0xA9, 0xD4, 0x4E, 0xBA, 0x24, 0x40, 0x5B, 0xDC, 0x1F, 0x84,
-    0x67, 0xD5, 0xD6, 0x3A, 0xFA, 0xC1, 0x64, 0x8B, 0x14, 0xC2, 0x0C, 0x82, 0x04, 0x82, 0xCD, 0x98,
-    0x3E, 0x0E, 0xCC, 0x9F, 0x2D, 0x5B, 0x90, 0x97, 0x08, 0x63, 0xC1, 0x96, 0x75, 0x17, 0xE5, 0x98,
-    0xF5, 0xBA, 0x13, 0xCB, 0x50, 0x8C, 0xA0, 0x2C, 0x76, 0x15, 0x37, 0xA5, 0x08, 0xBA, 0x58, 0xD6,
-    0x58, 0x09, 0xB1, 0x70, 0x4F, 0x93, 0xA8, 0xA4, 0x43, 0x7E, 0x35, 0xE6, 0x5D, 0x87, 0xB9, 0x10,
-    0xF6, 0x52, 0xAF, 0x97, 0xB5, 0x9E, 0x9F, 0x8C, 0xE2, 0xE5, 0x2E, 0xD9, 0x80, 0x04, 0x27, 0x4B,
-    0xE7, 0x00, 0x95, 0x64, 0x89, 0x5D, 0xE4, 0x7B, 0x4E, 0x01, 0xA1, 0x14, 0x10, 0x49, 0x01, 0xE1,
-    0xC0, 0x88, 0x99, 0x97, 0xC4, 0x73, 0xC5, 0x67, 0x28, 0x90, 0x5C, 0x38, 0xDD, 0xE6, 0xB3, 0xC0,
-    0x51, 0x66, 0x96, 0x1D, 0xFC, 0x25, 0x65, 0x1B, 0xF6, 0x56, 0x29, 0x78, 0x7C, 0x9C, 0x3A, 0xC2,
-    0xB1, 0x25, 0x03, 0x06, 0xF6, 0x24, 0x9C, 0xF3, 0x2D, 0x36, 0xB6, 0x92, 0x06, 0x7D, 0x9C, 0xB1,
-    0x49, 0x88, 0xE8, 0xAF, 0xA7, 0x13, 0x82, 0x49, 0x8B, 0x9B, 0x58, 0xB1, 0x45, 0x70, 0x36, 0xFE,
-    0x0A, 0x28, 0xA6, 0x5F, 0x1B, 0xF7, 0xEB, 0x24, 0x69, 0xD8, 0x4D, 0xC6, 0xC8, 0x5F, 0x23, 0x1A,
-    0x5B, 0x16, 0xD2, 0x31, 0x8A, 0x2D, 0x19, 0x0C, 0xE4, 0x57, 0x30, 0x52, 0xB0, 0xCC, 0x1E, 0x99,
-    0x39, 0xC9, 0xEF, 0xC6, 0xB1, 0x49, 0x79, 0x30, 0x90, 0x72, 0x53, 0xB0, 0xDE, 0xD4, 0x64, 0x77,
-    0x21, 0xA1, 0x78, 0x50, 0x12, 0x09, 0xF5, 0x20, 0x24, 0x9F, 0xE1, 0xC1, 0x0E, 0x54, 0x05, 0xCC,
-    0xA6, 0x2C, 0xCD, 0x21, 0x75, 0xD7, 0xFA, 0x53, 0xE8, 0x50, 0x46, 0xFE, 0x5B, 0xAB, 0x04, 0x6D,
-    0xC5, 0x3D, 0xA5, 0x93, 0x2D, 0xE6, 0xDC, 0x4F, 0x03, 0x52, 0x62, 0x64, 0x6B, 0xEC, 0x47, 0x42,
-    0xEA, 0x74, 0xAF, 0x42, 0x41, 0xAA, 0x66, 0x59, 0xA8, 0x02, 0x14, 0xAE, 0xA5, 0x72, 0x1F, 0xD0,
-    0x33, 0x9E, 0x14, 0xA4, 0x41, 0x7A, 0x53, 0x83, 0x80, 0x99, 0x2D, 0x83, 0x01, 0xDB, 0x53, 0x24,
-    0x58, 0x08, 0x8E, 0x38, 0x2A, 0xFC, 0xB3, 0xA4, 0x36, 0xBC, 0x5D, 0xE5, 0x8F, 0x6A, 0x36, 0xAA,
-    0x9F, 0x7F, 0x85, 0x37, 0x47, 0x46, 0x73, 0xA6, 0x1F, 0x56, 0x27, 0xCC, 0x89, 0x2B, 0x36, 0x65,
-    0x6F, 0x91, 0x29, 0x27, 0xBF, 0x3B, 0xC2, 0x44, 0x22, 0x62, 0xD3, 0x15, 0x92, 0x05, 0xCB, 0xFE,
-    0x3A, 0x6A, 0x35, 0xCA, 0x64, 0xF3, 0xDE, 0x17, 0x18, 0xAE, 0x25, 0xC3, 0xBF, 0xE8, 0x38, 0xE1,
-    0xB9, 0xDB, 0xB7, 0x25, 0xF9, 0x13, 0xB1, 0xFB, 0xDA, 0xF2, 0xA2, 0xBD, 0xB3, 0xEE, 0x78, 0xE6,
-    0xE6, 0x62, 0x7C, 0x25, 0x4A, 0x72, 0xF7, 0x80, 0x92, 0xB2, 0x30, 0x3E, 0x60, 0xC7, 0x85, 0xDD,
-    0xDC, 0xA2, 0x7E, 0x4F, 0xE0, 0xDD, 0xA5, 0x21, 0xB7, 0x0F, 0x59, 0xE4, 0x72, 0xA4, 0x87, 0x9B,
-    0x90, 0x4A, 0x9A, 0x14, 0x89, 0xE1, 0x0E, 0xD9, 0xEA, 0xEE, 0xAB, 0xAB, 0xEF, 0x75, 0x78, 0x58,
-    0x7E, 0x82, 0xB8, 0x7F, 0xA3, 0x63, 0x2E, 0xAE, 0x10, 0x6E, 0x3A, 0xF1, 0x80, 0x55, 0x53, 0x08,
-    0xB8, 0xA4, 0xFC, 0x51, 0xC4, 0x12, 0x76, 0xD9, 0x9A, 0xA5, 0x46, 0x87, 0x4B, 0xDA, 0x5B, 0x7A,
-    0x25, 0x6E, 0x0D, 0x97, 0x0A, 0xCB, 0xDA, 0x86, 0x6B, 0x53, 0xE5, 0xAC, 0x98, 0xD8, 0x7E, 0x40,
-    0xDC, 0xB3, 0x72, 0xE7, 0x17, 0xE9, 0xC9, 0xC0, 0x08, 0x20, 0x01, 0x04, 0xC5, 0x48, 0x8B, 0x14,
-    0x55, 0xC5, 0x8C, 0x83, 0xBF, 0x8B, 0x56, 0xEA, 0xDA, 0xC3, 0x5D, 0xAD, 0x6B, 0xC8, 0x79, 0x7C,
-    0xA2, 0xA6, 0xF3, 0xB6, 0x51, 0xE7, 0x44, 0xCE, 0x50, 0x25, 0x4D, 0x30, 0x56, 0xED, 0x15, 0xE7,
-    0x31, 0x6C, 0x13, 0x64, 0xE6, 0x9B, 0x0A, 0xA9, 0x9C, 0x6B, 0xDF, 0x82, 0x17, 0x4C, 0xA0, 0x9B,
-    0x31, 0x30, 0xA1, 0x96, 0xD9, 0x15, 0x49, 0x55, 0x2A, 0xBD, 0x85, 0x48, 0x09, 0x1E, 0xC2, 0x25,
-    0xA6, 0xED, 0x14, 0x3D, 0x9D, 0x08, 0xC6, 0x96, 0xEE, 0x21, 0x51, 0xE9, 0xAB, 0x2A, 0x5D, 0x83,
-    0x59, 0xC8, 0xE8, 0xD0, 0x09, 0xBD, 0x82, 0xA7, 0x65, 0xA3, 0x30, 0x26, 0x84, 0x51, 0x47, 0x13,
-    0x1D, 0xEA, 0x0E, 0x78, 0x3B, 0xA3, 0x04, 0x29, 0x1D, 0x39, 0x2D, 0x73, 0xC3, 0x43, 0xA0, 0x16,
-    0x9B, 0x12, 0x76, 0x54, 0x30, 0xDD, 0x88, 0x39, 0x3E, 0xA3, 0xF1, 0xD2, 0x7C, 0x9E, 0xDA, 0x40,
-    0xA6, 0xD8, 0x8A, 0x56, 0xAA, 0x55, 0x53, 0x67, 0x23, 0x06, 0x49, 0x8E, 0xEB, 0x40, 0x49, 0xD9,
-    0xFB, 0x37, 0x8D, 0x3E, 0x03, 0xB9, 0xF6, 0x2B, 0xEB, 0x3D, 0x20, 0x4A, 0x56, 0x7B, 0xA9, 0xDA,
-    0x40, 0x30, 0x21, 0x6C, 0x42, 0xFB, 0xAC, 0x6A, 0x49, 0xF5, 0x68, 0x2B, 0xCB, 0x35, 0xB6, 0xB6,
-    0x6B, 0x6C, 0x5D, 0x43, 0xD4, 0x66, 0x0D, 0x51, 0xF1, 0x5E, 0x88, 0x2A, 0xD7, 0x10, 0xF5, 0x58,
-    0x04, 0x3B, 0x17, 0xCD, 0xA6, 0x35, 0x9A, 0xAD, 0xB1, 0x7C, 0x79, 0x52, 0x2C, 0x1F, 0x76, 0xB1,
-    0xFC, 0xE4, 0x06, 0xA0, 0xF9, 0x2D, 0xD0, 0xCB, 0x0E, 0xD1, 0x1E, 0x56, 0xB5, 0xAA, 0xA3, 0xA3,
-    0x9D, 0x64, 0xB6, 0xC1, 0x38, 0x61, 0x7B, 0x50, 0x09, 0xD1, 0x05, 0xF1, 0xCD, 0x37, 0x04, 0xF1,
-    0x68, 0x2F, 0x88, 0x6F, 0xD7, 0xE6, 0x73, 0x2D, 0x01, 0xFF, 0xA1, 0x68, 0xAF, 0xCA, 0xB4, 0x47,
-    0x64, 0x9A, 0x52, 0x98, 0x3D, 0x4C, 0xCE, 0xBE, 0xB1, 0x39, 0xDF, 0x68, 0xD8, 0xEF, 0x29, 0x9C,
-    0x7F, 0xB3, 0x7C, 0x7A, 0xA3, 0x61, 0x45, 0x54, 0x1F, 0xC3, 0xC4, 0x6E, 0x01, 0xEF, 0xDE, 0x46,
-    0x8C, 0xBD, 0x03, 0x34, 0xF5, 0x2F, 0xA5, 0x43, 0x54, 0xDE, 0x7B, 0x97, 0x9D, 0xF7, 0xC6, 0xFB,
-    0xDE, 0x3B, 0xEC, 0xBC, 0xF7, 0x49, 0x89, 0xFA, 0xFF, 0x02, 0x1D, 0xF1, 0x90, 0x8E, 0xC5, 0x86,
-    0x06, 0x6A, 0xC3, 0x49, 0x37, 0x79, 0x3B, 0x9A, 0xDD, 0x9A, 0xD5, 0xBD, 0x13, 0x12, 0xCB, 0x7E,
-    0xC0, 0x4A, 0xEB, 0xB7, 0xB1, 0x88, 0x8F, 0xE6, 0x18, 0xF6, 0x5E, 0xDD, 0x5A, 0x92, 0x31, 0x6F,
-    0xBF, 0xD1, 0x22, 0x92, 0xF3, 0x66, 0xBC, 0x6E, 0x3F, 0x41, 0xE9, 0x96, 0x0D, 0x09, 0xCD, 0x15,
-    0x72, 0x24, 0x25, 0xD8, 0x68, 0xCE, 0x20, 0x31, 0xBA, 0xE6, 0xF3, 0xD3, 0xCC, 0xD8, 0xB8, 0xF4,
-    0xA4, 0x8C, 0xE6, 0x72, 0x99, 0x30, 0x3F, 0xB6, 0x45, 0x96, 0x69, 0xA6, 0xD8, 0x7E, 0x6A, 0xC7,
-    0x04, 0x88, 0x75, 0x61, 0x6E, 0xD6, 0x47, 0x31, 0x1D, 0xCF, 0x03, 0xFA, 0x35, 0xE2, 0xBB, 0x1E,
-    0xBA, 0xCB, 0x59, 0x69, 0xEF, 0x72, 0xD2, 0xB9, 0x10, 0x03, 0xDC, 0x00, 0xAC, 0x50, 0x70, 0x96,
-    0x17, 0xB0, 0xF5, 0xD2, 0x82, 0xBE, 0x80, 0xFA, 0xAC, 0x13, 0xF6, 0xC6, 0xF0, 0x46, 0x74, 0xC6,
-    0x24, 0x94, 0xFD, 0xD7, 0x18, 0x23, 0x27, 0x5D, 0xEE, 0x51, 0x38, 0x4C, 0x45, 0xDB, 0xC0, 0x82,
-    0x9A, 0x37, 0x90, 0x96, 0x6A, 0x8B, 0x07, 0x97, 0x68, 0xAA, 0x70, 0x7F, 0xF2, 0x50, 0x15, 0xE8,
-    0x19, 0x53, 0x53, 0x61, 0x5B, 0xDE, 0x8F, 0xEC, 0xD9, 0x05, 0xC4, 0x7E, 0x1C, 0x48, 0x42, 0x56,
-    0x89, 0x95, 0x2D, 0xCA, 0x34, 0xAF, 0xF8, 0xDC, 0x40, 0xF1, 0xA9, 0x58, 0xAA, 0xB7, 0x95, 0x79,
-    0xD4, 0x37, 0x5D, 0x30, 0x35, 0x28, 0xB9, 0x10, 0x60, 0x8A, 0xB9, 0xEA, 0x53, 0xE8, 0x14, 0xAC,
-    0x5B, 0x21, 0x02, 0x76, 0xA5, 0x89, 0xB6, 0x89, 0xC0, 0x19, 0x5D, 0xC2, 0x47, 0xDE, 0x9C, 0x94,
-    0x44, 0x4D, 0x31, 0x10, 0xA8, 0xB0, 0x50, 0x68, 0x39, 0x86, 0x64, 0x22, 0x2F, 0x41, 0x13, 0x7B,
-    0xE9, 0xC8, 0xEC, 0x13, 0x33, 0xEB, 0x03, 0xC0, 0x09, 0x53, 0x5D, 0xDD, 0x64, 0x9B, 0x70, 0x06,
-    0x53, 0x35, 0x02, 0x3D, 0xCB, 0xAE, 0x0F, 0x16, 0xC7, 0x14, 0x1E, 0x1C, 0xD3, 0x2F, 0x78, 0x7F,
-    0xFE, 0x87, 0x81, 0xA1, 0xF0, 0x41, 0x1B, 0xD1, 0xDE, 0x0D, 0xEE, 0xC7, 0x02, 0x4D, 0x19, 0x03,
-    0xD2, 0xB2, 0x1C, 0x81, 0x34, 0xD8, 0xF8, 0x21, 0x40, 0xED, 0xCF, 0x43, 0x00, 0x85, 0xFB, 0x58,
-    0x4A, 0x50, 0xB3, 0x5C, 0x91, 0x75, 0xD7, 0x07, 0x31, 0x45, 0x82, 0x12, 0xEA, 0x36, 0x4A, 0xA8,
-    0xB3, 0xBD, 0x12, 0xAA, 0xF8, 0x7F, 0x96, 0x50, 0xFB, 0x9B, 0x31, 0x84, 0x73, 0x27, 0xB6, 0xE4,
-    0x0E, 0xFC, 0x78, 0x98, 0xFF, 0x57, 0x01, 0xCD, 0xA2, 0xC9, 0x95, 0xDC, 0x67, 0x8D, 0x7C, 0xBA,
-    0xAD, 0x95, 0xFC, 0xA8, 0x96, 0x20, 0x0C, 0xD2, 0x84, 0xC4, 0xAA, 0xD6, 0x8F, 0x8F, 0x04, 0xAC,
-    0xFC, 0x48, 0x25, 0xFD, 0x00, 0xA1, 0x8D, 0xB6, 0x90, 0x3F, 0x60, 0x8D, 0x0D, 0x11, 0x71, 0x42,
-    0x40, 0x63, 0x30, 0xE4, 0x9E, 0xE2, 0x80, 0x30, 0x88, 0x88, 0x84, 0x12, 0x8B, 0x96, 0x42, 0x52,
-    0x6B, 0x9F, 0xE6, 0x40, 0x7D, 0xE9, 0x3E, 0x17, 0xC0, 0x94, 0xE5, 0xE2, 0x71, 0xED, 0xC9, 0x68,
-    0x98, 0x9A, 0xDF, 0x82, 0xB5, 0x15, 0x2F, 0x7D, 0x65, 0x87, 0x43, 0x6A, 0x01, 0xEA, 0x7C, 0x15,
-    0x17, 0x06, 0x91, 0x4C, 0x33, 0x99, 0x5E, 0x8E, 0x25, 0x07, 0x94, 0x37, 0xA6, 0xBD, 0x5B, 0x50,
-    0x23, 0x12, 0x26, 0x60, 0x6D, 0x4F, 0x4E, 0x5B, 0x99, 0x27, 0xFB, 0x36, 0x34, 0xBC, 0xCE, 0x19,
-    0x5E, 0xC0, 0xD9, 0x0D, 0x4D, 0x60, 0xDF, 0xF0, 0xEE, 0xCB, 0xF0, 0x5E, 0xA5, 0xE1, 0xAD, 0x32,
-    0x7C, 0x91, 0xF6, 0x03, 0x19, 0x1A, 0x67, 0x78, 0x43, 0xFC, 0x90, 0xF7, 0xA7, 0x67, 0x83, 0x2C,
-    0x97, 0x86, 0x57, 0xD1, 0xF0, 0x38, 0xF7, 0xAE, 0x90, 0x66, 0x69, 0x78, 0x91, 0x0C, 0x2F, 0x95,
-    0xE1, 0x39, 0x3B, 0xA8, 0xEA, 0x15, 0x36, 0x1C, 0x36, 0x0E, 0x9C, 0x96, 0x4F, 0x01, 0xA7, 0x32,
-    0xBC, 0x3B, 0xDF, 0xD1, 0xF0, 0xF6, 0x13, 0xC3, 0xCF, 0x6C, 0xAB, 0xE0, 0x26, 0x3C, 0x27, 0x54,
-    0xF5, 0x8B, 0x13, 0x0E, 0xD3, 0x68, 0x66, 0x1A, 0x1A, 0x5D, 0x59, 0x1B, 0xAE, 0x41, 0x33, 0x9B,
-    0x6D, 0x23, 0x17, 0x82, 0x3A, 0x6D, 0x86, 0xC8, 0xD6, 0xD9, 0x14, 0x73, 0x1E, 0x96, 0xB2, 0x72,
-    0x41, 0xD4, 0x8A, 0x66, 0x06, 0xD9, 0x59, 0x99, 0x54, 0x89, 0x19, 0x97, 0x64, 0x42, 0xC4, 0x4C,
-    0x75, 0x41, 0xB9, 0x8D, 0x28, 0x8C, 0x4F, 0xAB, 0x4D, 0x31, 0x04, 0x56, 0x7D, 0x2F, 0x8E, 0x5B,
-    0x16, 0xD7, 0x26, 0x86, 0xAC, 0x6A, 0xDF, 0xF8, 0x7A, 0xC2, 0x4C, 0xA5, 0xE1, 0xE1, 0x04, 0xCE,
-    0x30, 0xA7, 0x74, 0xBE, 0x3A, 0x40, 0xF9, 0xBF, 0x87, 0xB9, 0xFC, 0x0E, 0xF0, 0xAF, 0x6A, 0x93,
-    0xD3, 0x45, 0x87, 0x17, 0xEC, 0xD5, 0x0D, 0x00, 0x5F, 0x5B, 0x7C, 0x6A, 0xFF, 0x59, 0x41, 0x99,
-    0x73, 0xC3, 0x90, 0x83, 0xC6, 0x9F, 0xAE, 0xFD, 0x4D, 0x33, 0x85, 0xCC, 0x43, 0x37, 0x39, 0x44,
-    0x54, 0x33, 0x5D, 0xF2, 0x5D, 0x03, 0xEB, 0xC5, 0xF2, 0xF8, 0x4D, 0x25, 0x71, 0xAE, 0xC6, 0x18,
-    0x2C, 0xD1, 0xF6, 0xE4, 0x36, 0x57, 0xA2, 0xC4, 0x2E, 0xAD, 0x5E, 0x23, 0x82, 0x1E, 0x5F, 0x03,
-    0xAD, 0x99, 0x07, 0x15, 0xAA, 0x4F, 0x39, 0x06, 0x66, 0x87, 0x6E, 0x31, 0x62, 0xF8, 0x27, 0x5A,
-    0xE5, 0x58, 0x2D, 0xE5, 0xBB, 0x6C, 0xF2, 0x0F, 0x4C, 0xE3, 0x13, 0x41, 0xEB, 0x6B, 0x31, 0xB1,
-    0x62, 0xB9, 0x3D, 0x65, 0xF2, 0x73, 0xEA, 0x5A, 0x4C, 0xB3, 0x89, 0x63, 0xC4, 0x35, 0x22, 0x0A,
-    0x48, 0x17, 0xDB, 0xC4, 0xFE, 0x55, 0x27, 0xBE, 0x55, 0xF0, 0x76, 0x62, 0x3C, 0xD2, 0x98, 0x59,
-    0x9C, 0xB3, 0x35, 0x69, 0x5B, 0xB1, 0x8E, 0x77, 0x43, 0x0D, 0xD6, 0x80, 0x6E, 0x6D, 0x89, 0x30,
-    0x21, 0xE6, 0x8D, 0x1A, 0x3F, 0x8E, 0xFB, 0xD8, 0x8D, 0x04, 0x1D, 0x97, 0x57, 0x0E, 0x8E, 0x20,
-    0x3E, 0xFA, 0xDE, 0x2D, 0xC6, 0x11, 0x04, 0xC0, 0xFC, 0x57, 0xB8, 0xE7, 0x68, 0x6D, 0x06, 0x6A,
-    0xF0, 0xA4, 0xA6, 0x80, 0x3A, 0x3C, 0xFF, 0x69, 0xCB, 0x64, 0x56, 0xD9, 0x95, 0x30, 0x55, 0xD0,
-    0xBA, 0x35, 0xEB, 0x8C, 0x18, 0x36, 0xD2, 0x81, 0x88, 0xBD, 0x55, 0x5D, 0x96, 0xF9, 0xC1, 0x60,
-    0xED, 0x26, 0x90, 0xF9, 0xC2, 0x79, 0xF7, 0x9E, 0x17, 0x3D, 0xA3, 0x06, 0x15, 0x5B, 0x9A, 0x6E,
-    0x26, 0x23, 0x3C, 0x74, 0x8A, 0x3F, 0xBB, 0x74, 0x51, 0x62, 0xAB, 0x36, 0x4C, 0x45, 0x91, 0x12,
-    0x38, 0x93, 0x31, 0x61, 0x0C, 0x9B, 0x54, 0x27, 0x37, 0x54, 0xB4, 0x42, 0x27, 0xD4, 0x98, 0xAD,
-    0x19, 0x40, 0x2C, 0xC3, 0xAB, 0x2F, 0x6B, 0x98, 0xAC, 0x5D, 0x51, 0x0A, 0x22, 0x9D, 0x8B, 0x09,
-    0xAE, 0xB3, 0xE5, 0xE9, 0xC6, 0x71, 0xBC, 0x5D, 0xFF, 0x11, 0xB1, 0x88, 0x0A, 0xAF, 0xAA, 0x75,
-    0xE8, 0x0E, 0x21, 0xF3, 0xD8, 0xC2, 0x5B, 0x96, 0x53, 0x0C, 0x58, 0x4D, 0x3A, 0x57, 0xF6, 0x75,
-    0x8B, 0xCA, 0x1A, 0xF1, 0x12, 0x8E, 0x3E, 0xD1, 0xDC, 0xD3, 0xE9, 0xD5, 0x99, 0x25, 0xB4, 0xA5,
-    0x0D, 0x80, 0x6A, 0x5C, 0x4F, 0xDF, 0xA6, 0x28, 0x34, 0xDE, 0x2A, 0x68, 0x64, 0x9F, 0xDA, 0x39,
-    0xB8, 0xCE, 0x5E, 0x1B, 0x4A, 0x6E, 0xBB, 0x68, 0xF4, 0xD9, 0xD1, 0xF2, 0x2E, 0xF9, 0x2C, 0x76,
-    0x58, 0xAE, 0x53, 0x11, 0x5F, 0xAC, 0x28, 0xA8, 0x1E, 0xAF, 0xE3, 0xC5, 0x87, 0xAC, 0x94, 0x66,
-    0xE3, 0xC6, 0x8B, 0xF7, 0xC9, 0x04, 0x0D, 0x61, 0x17, 0xAF, 0x55, 0xEB, 0x23, 0x02, 0x41, 0xBB,
-    0x9C, 0x6E, 0x4B, 0xB7, 0x95, 0x25, 0xE6, 0xA5, 0x48, 0xFE, 0x89, 0xE5, 0xAF, 0x0A, 0x65, 0x38,
-    0x4F, 0xCF, 0xD6, 0x1B, 0xCD, 0x06, 0x77, 0x71, 0x68, 0x0B, 0xEA, 0xA0, 0x76, 0x9D, 0x4A, 0x98,
-    0xB4, 0x35, 0x9B, 0x1D, 0x1E, 0x41, 0x14, 0x2F, 0x0F, 0x01, 0x38, 0x43, 0x74, 0x93, 0xE6, 0x60,
-    0x35, 0xB1, 0xF5, 0x15, 0x45, 0xEB, 0x90, 0xE3, 0xE0, 0x90, 0xE3, 0x7E, 0x45, 0xE1, 0x0B, 0x2D,
-    0xCD, 0xB2, 0x23, 0xA2, 0xB0, 0x0A, 0xF1, 0x33, 0x59, 0x1A, 0x56, 0x30, 0x90, 0xD2, 0xA0, 0x72,
-    0xBC, 0xE8, 0x18, 0x21, 0x59, 0x8B, 0xB7, 0xC5, 0xD7, 0xF4, 0x6A, 0xD7, 0x74, 0x2D, 0x55, 0x05,
-    0x36, 0xB7, 0x38, 0xCE, 0x87, 0xF4, 0xEC, 0x0B, 0x56, 0x25, 0xA0, 0xEF, 0x5B, 0xC8, 0xCC, 0x8B,
-    0x9E, 0x75, 0xE6, 0xAE, 0xEB, 0x2E, 0xB5, 0xAA, 0xBC, 0x63, 0xEC, 0x66, 0xD0, 0x5E, 0x07, 0x13,
-    0x66, 0xCE, 0xBB, 0xF8, 0x8F, 0x30, 0xCC, 0x07, 0x84, 0x1B, 0x90, 0x78, 0xAD, 0x4C, 0xE9, 0xE9,
-    0x55, 0x31, 0xD4, 0x3D, 0x0E, 0x35, 0xCF, 0x0D, 0xF4, 0x98, 0xE4, 0x88, 0x47, 0x67, 0x77, 0xBC,
-    0xE8, 0xD0, 0xC3, 0xBE, 0xE3, 0x6F, 0x3C, 0xA9, 0x91, 0xD2, 0xE1, 0xA9, 0x2E, 0x37, 0x8C, 0x23,
-    0xE7, 0xC5, 0x86, 0xDC, 0x40, 0x5F, 0xCC, 0xA4, 0xA5, 0x92, 0x21, 0x0C, 0xA3, 0x97, 0xC2, 0xFC,
-    0x68, 0x9E, 0xA5, 0x07, 0x83, 0x0E, 0x35, 0xC6, 0x93, 0x4E, 0x62, 0x5E, 0x78, 0x4D, 0x7D, 0x0F,
-    0x7A, 0x94, 0xB8, 0x07, 0xDD, 0xC8, 0x0B, 0xEC, 0x71, 0x33, 0xDB, 0x17, 0x6F, 0xF6, 0xA2, 0x80,
-    0x7D, 0xE7, 0x35, 0xD7, 0x83, 0x6D, 0x6A, 0x2D, 0x5C, 0xDC, 0x41, 0x0D, 0xF2, 0x1D, 0x7B, 0xAD,
-    0x24, 0xD3, 0xE3, 0x45, 0x42, 0xFE, 0x68, 0x91, 0xE0, 0x40, 0xA5, 0xF5, 0x4D, 0x3D, 0xB6, 0xF5,
-    0x09, 0x87, 0x0E, 0xB7, 0xE1, 0xE9, 0x9A, 0xCE, 0x0C, 0x68, 0xDC, 0xBB, 0xDC, 0x84, 0xF1, 0x9B,
-    0x32, 0xDA, 0xD6, 0x3A, 0x6C, 0x6E, 0xAB, 0x50, 0x19, 0xFD, 0x21, 0x39, 0x77, 0xC0, 0xCC, 0xB8,
-    0x64, 0xA6, 0xF1, 0xFE, 0xCC, 0xAE, 0x70, 0xF9, 0xDA, 0xAF, 0xD5, 0xEF, 0xEF, 0x62, 0x67, 0x21,
-    0xF5, 0x7A, 0xC0, 0x0D, 0x15, 0x6E, 0xE0, 0x4A, 0x04, 0x55, 0xB8, 0xFD, 0x76, 0xE3, 0xDC, 0x72,
-    0xD4, 0xDC, 0xE6, 0xEC, 0xFC, 0xD5, 0x7F, 0x2F, 0xE3, 0x9B, 0xDD, 0x21, 0x36, 0xCE, 0x22, 0x59,
-    0x0C, 0x30, 0x77, 0xA4, 0xAA, 0x6C, 0xFE, 0x12, 0x25, 0x7D, 0xA3, 0x99, 0x23, 0xD6, 0x9F, 0xFD,
-    0xD2, 0xAC, 0x9D, 0x9F, 0x3A, 0xCE, 0xFB, 0x61, 0xB9, 0xDA, 0x3F, 0x14, 0x75, 0xDB, 0x1D, 0x8A,
-    0xF2, 0x56, 0xFA, 0x9D, 0xB9, 0x52, 0xF8, 0xFC, 0x4C, 0xB4, 0x5B, 0x66, 0xE3, 0x7B, 0x6C, 0x96,
-    0xFC, 0x34, 0x5A, 0x0B, 0x44, 0xEB, 0x21, 0x2A, 0x09, 0x2E, 0x16, 0x47, 0x7D, 0x48, 0x8B, 0x6D,
-    0xBA, 0xB5, 0xB1, 0x73, 0x84, 0x74, 0x42, 0xBA, 0xE9, 0xA6, 0x15, 0xD6, 0xCD, 0x08, 0x3D, 0xDE,
-    0xF5, 0x43, 0x1D, 0x42, 0x21, 0x58, 0xFA, 0x01, 0xBB, 0x00, 0x20, 0x28, 0x19, 0xD7, 0x4C, 0xF0,
-    0x19, 0xC9, 0x6E, 0x50, 0x67, 0x8D, 0xB1, 0x2A, 0xBE, 0x59, 0x80, 0x80, 0x2D, 0xA7, 0x84, 0x09,
-    0x62, 0x91, 0xD4, 0x42, 0xFB, 0x6C, 0x59, 0x6D, 0x40, 0x73, 0xA2, 0xB5, 0x3B, 0x93, 0xED, 0x3C,
-    0xAC, 0x32, 0xC1, 0xAB, 0x3D, 0x9B, 0x69, 0x1A, 0xE7, 0x49, 0x1E, 0x3C, 0x75, 0x14, 0x7F, 0xB1,
-    0x38, 0x15, 0x69, 0xB4, 0xB3, 0x3D, 0x11, 0x74, 0x75, 0x29, 0xC5, 0x63, 0xAA, 0xAE, 0xEF, 0x3D,
-    0x18, 0x7E, 0x1F, 0xB8, 0x7E, 0x18, 0x6B, 0x5C, 0x8D, 0xBD, 0xF2, 0xD9, 0x9F, 0x67, 0x8C, 0xF8,
-    0xA4, 0x3B, 0xA1, 0x39, 0x79, 0x15, 0xB9, 0x1E, 0x50, 0x77, 0xC0, 0x7E, 0x2E, 0x79, 0x8D, 0x5D,
-    0x80, 0xE4, 0xE6, 0xCB, 0x7A, 0xC2, 0x53, 0xE7, 0x9E, 0x08, 0xB2, 0x9F, 0x70, 0xEE, 0xA9, 0x59,
-    0x98, 0x2C, 0x00, 0xE6, 0x91, 0xD2, 0xC1, 0xB0, 0x5C, 0x68, 0x76, 0x09, 0x51, 0xE7, 0x9A, 0x9A,
-    0xC9, 0x29, 0xCA, 0xC9, 0xDB, 0xBC, 0x1D, 0x2F, 0x1A, 0x58, 0x34, 0xDA, 0xC5, 0x75, 0x4F, 0x60,
-    0x59, 0x33, 0x5F, 0x10, 0x33, 0x0F, 0x03, 0x4C, 0x8F, 0x77, 0xD1, 0xDB, 0xC7, 0xBA, 0xE8, 0xFB,
-    0x5D, 0xBA, 0xD5, 0x7D, 0xF7, 0xBB, 0x74, 0xB1, 0x4F, 0x14, 0x0C, 0x53, 0x3C, 0x27, 0xF0, 0x1B,
-    0x56, 0xE1, 0x24, 0xE7, 0x9A, 0x2A, 0x16, 0xB6, 0x9D, 0x1B, 0xEA, 0x31, 0xE1, 0xB6, 0xD8, 0x75,
-    0xFA, 0xF9, 0x7C, 0xFC, 0x68, 0x0F, 0xA4, 0x5B, 0x87, 0x02, 0x1F, 0x21, 0x75, 0xD4, 0x05, 0x31,
-    0x4B, 0x09, 0x44, 0xE2, 0x9A, 0xED, 0x28, 0xB4, 0xB0, 0x26, 0x14, 0xCB, 0x22, 0x9B, 0xE7, 0xB6,
-    0x78, 0x6C, 0x8B, 0xA7, 0xB6, 0xF2, 0xF3, 0x31, 0xE7, 0x87, 0x60, 0xCE, 0x4F, 0x76, 0x89, 0x83,
-    0x4D, 0xF0, 0x22, 0x42, 0x64, 0x5E, 0x86, 0xD3, 0xDF, 0x90, 0xDF, 0x50, 0xD6, 0x44, 0xE8, 0xD9,
-    0x07, 0xCD, 0x7F, 0x94, 0x4F, 0x6F, 0x6D, 0xC9, 0xD6, 0x86, 0x23, 0xA9, 0x53, 0xC7, 0x9C, 0xDC,
-    0x11, 0xB4, 0x6F, 0x43, 0x2D, 0x03, 0x01, 0x3E, 0x83, 0x0A, 0x17, 0xF3, 0x5B, 0x7B, 0xE3, 0x31,
-    0x6A, 0x1F, 0x6D, 0x98, 0x32, 0x8F, 0x47, 0xBD, 0xB4, 0x40, 0xC8, 0x67, 0x5F, 0xB2, 0xF6, 0x7D,
-    0xD0, 0x07, 0x81, 0x33, 0x41, 0x59, 0x9A, 0xCF, 0x0B, 0x96, 0x4E, 0xC6, 0xC3, 0x5C, 0xA4, 0x8D,
-    0xD5, 0xC6, 0x70, 0xC4, 0x90, 0x20, 0xB3, 0x2E, 0x77, 0xC7, 0x8C, 0x11, 0x6E, 0xD9, 0x20, 0x39,
-    0xEB, 0x5D, 0xFA, 0x8C, 0xDF, 0xA7, 0x37, 0x6C, 0x61, 0x09, 0x5B, 0x13, 0x01, 0x33, 0x43, 0xA8,
-    0x0B, 0x27, 0x72, 0xEE, 0xF4, 0xDB, 0xEC, 0x7A, 0xDC, 0xCA, 0x16, 0x3A, 0xAB, 0xA5, 0x76, 0xB8,
-    0x9A, 0xDC, 0x6C, 0x93, 0x0B, 0x23, 0x30, 0xEB, 0xF0, 0x28, 0x9D, 0x86, 0x77, 0xEA, 0xD7, 0x16,
-    0x3D, 0x6C, 0x35, 0xE7, 0x59, 0x36, 0xE5, 0xA1, 0x58, 0x47, 0x3D, 0xD8, 0xD6, 0xDD, 0x95, 0xD7,
-    0xE1, 0x1C, 0xB7, 0xA1, 0x3D, 0xE3, 0x3C, 0x68, 0x30, 0xEF, 0x00, 0x7E, 0x5D, 0x72, 0xF8, 0x9D,
-    0x63, 0x46, 0xD4, 0x33, 0x81, 0x15, 0xE0, 0xE3, 0x7A, 0x2C, 0xEB, 0x7C, 0xE5, 0x43, 0x6C, 0x61,
-    0x6B, 0x26, 0x7A, 0x6E, 0x9E, 0xA9, 0xF7, 0xC0, 0x66, 0xEB, 0xCB, 0x44, 0x28, 0x0F, 0xBA, 0xD4,
-    0x7E, 0x82, 0x84, 0xF8, 0xD1, 0xE4, 0x71, 0xE0, 0xC9, 0x09, 0xA3, 0xAB, 0x83, 0x97, 0x25, 0x8B,
-    0x9C, 0x1F, 0x85, 0xD9, 0x67, 0x4F, 0xDE, 0x36, 0x8C, 0xAC, 0x21, 0x61, 0xB7, 0x2F, 0xB4, 0x54,
-    0x0C, 0x13, 0xD6, 0x03, 0xE5, 0x8E, 0x4C, 0xC1, 0xCC, 0xE0, 0x6B, 0x03, 0x05, 0x50, 0x24, 0x1D,
-    0x09, 0xC1, 0xD8, 0x0A, 0x0E, 0xD6, 0xC9, 0x6D, 0x36, 0x10, 0xD0, 0x2C, 0xE0, 0x7F, 0xAE, 0x10,
-    0x26, 0xB2, 0xD6, 0x8B, 0x8B, 0xA3, 0xE0, 0xB0, 0x8F, 0x81, 0x39, 0x16, 0xB9, 0x83, 0xFA, 0x80,
-    0xF3, 0xBE, 0xA4, 0x2F, 0x96, 0x5D, 0x1E, 0x33, 0x4F, 0x5B, 0x78, 0xD5, 0x22, 0x7B, 0xEF, 0xDC,
-    0x39, 0x73, 0x0F, 0xF6, 0xBF, 0x3F, 0xDD, 0x6A, 0x2F, 0x9D, 0x49, 0x28, 0x98, 0x55, 0xFE, 0xE1,
-    0xB9, 0xF5, 0xA2, 0x3F, 0xF5, 0xC1, 0x8F, 0x24, 0x00, 0xB9, 0x1C, 0xD3, 0xC3, 0x6B, 0xEF, 0x18,
-    0xF3, 0x5C, 0x8A, 0xF4, 0xF6, 0x06, 0x94, 0x73, 0x46, 0x4C, 0x34, 0x6C, 0x8B, 0xA2, 0xEF, 0xD1,
-    0x00, 0x02, 0xD6, 0x7F, 0xD1, 0x42, 0xD4, 0xB9, 0xB0, 0x85, 0x34, 0xF3, 0xB0, 0xDD, 0xC4, 0xD9,
-    0xE3, 0xA5, 0x55, 0x02, 0x62, 0x54, 0x12, 0x00, 0x37, 0x2C, 0xAA, 0x36, 0x42, 0x7E, 0x60, 0xF7,
-    0xDC, 0x27, 0xAE, 0xAA, 0xB3, 0xFA, 0xA4, 0x53, 0xA1, 0xF3, 0xE4, 0x4F, 0x66, 0x22, 0x3C, 0x40,
-    0x92, 0xD1, 0x49, 0x41, 0x30, 0x1B, 0x61, 0x6D, 0xF1, 0xA7, 0xAB, 0x56, 0xC1, 0x1F, 0xBE, 0x70,
-    0xE4, 0x8A, 0xE7, 0xFC, 0x2E, 0x52, 0x22, 0xAB, 0xD2, 0xEC, 0xF5, 0x71, 0x47, 0x95, 0x44, 0x40,
-    0x63, 0x60, 0xA9, 0x37, 0x6E, 0x71, 0xAC, 0x6B, 0xEA, 0x50, 0x0A, 0xB2, 0x07, 0x8A, 0x61, 0x1D,
-    0xC8, 0xF1, 0x58, 0x1D, 0x44, 0x4F, 0x41, 0x18, 0x9A, 0x84, 0x24, 0x21, 0x9B, 0x70, 0xA2, 0xB8,
-    0x30, 0x3D, 0x6B, 0x16, 0x94, 0x97, 0xFE, 0x5B, 0x08, 0x82, 0x35, 0xC6, 0x5E, 0xA7, 0xDA, 0x37,
-    0xFB, 0x5F, 0x43, 0x50, 0x03, 0x94, 0xB5, 0xA6, 0x7D, 0xA4, 0x01, 0xCA, 0x16, 0x58, 0x8B, 0x5D,
-    0x36, 0x30, 0x7F, 0xBC, 0x19, 0xB3, 0x83, 0x6A, 0x35, 0x32, 0xAA, 0x3E, 0x46, 0x79, 0x6A, 0xCF,
-    0xA0, 0xE8, 0xAF, 0x91, 0x40, 0x06, 0xB0, 0xC7, 0x2F, 0x22, 0x68, 0x87, 0xD7, 0xFC, 0xB9, 0x20,
-    0x7E, 0xDF, 0x21, 0x14, 0x0E, 0xD9, 0x0E, 0xE7, 0x5C, 0x50, 0x89, 0x5D, 0xFD, 0x52, 0xB9, 0xBE,
-    0xE6, 0xA8, 0x9E, 0x47, 0x53, 0xCE, 0xC6, 0x1F, 0x03, 0xDF, 0xA5, 0xBE, 0xAA, 0x0E, 0x97, 0x8A,
-    0x47, 0x31, 0xD8, 0x40, 0x85, 0x16, 0x9B, 0x0F, 0x59, 0x85, 0x45, 0x73, 0xCA, 0x6A, 0x06, 0x26,
-    0xD9, 0xE6, 0x8B, 0x5A, 0x49, 0x76, 0x8C, 0x26, 0xF8, 0xEB, 0x59, 0x9F, 0x6F, 0xD2, 0xBE, 0xB8,
-    0xD9, 0x42, 0x24, 0xEF, 0x4F, 0x0D, 0xFB, 0xB4, 0xE9, 0x97, 0x13, 0xB5, 0x55, 0xBD, 0xFC, 0x05,
-    0x8A, 0xC0, 0xAF, 0x26, 0x9E, 0x1F, 0x2C, 0xEE, 0x74, 0x0D, 0xB2, 0xCF, 0xD2, 0x04, 0x33, 0x8A,
-    0xDF, 0xB3, 0x91, 0x5F, 0x19, 0x48, 0x89, 0x5B, 0x6B, 0x42, 0xC4, 0x8A, 0xA3, 0x98, 0x3E, 0x50,
-    0x87, 0xA0, 0x8D, 0x1D, 0xB4, 0x73, 0xAD, 0x66, 0x97, 0xEB, 0x75, 0x52, 0xDB, 0x1D, 0x41, 0x34,
-    0x0B, 0xFB, 0x17, 0xF1, 0xA8, 0x61, 0x57, 0xB9, 0x6D, 0x87, 0x17, 0x75, 0x3E, 0xB0, 0xFB, 0x56,
-    0x0C, 0x28, 0x66, 0xDA, 0x6A, 0xE0, 0x89, 0x0E, 0x8B, 0xFA, 0xB3, 0x78, 0xDF, 0x0E, 0x08, 0x19,
-    0x1F, 0x9C, 0x0D, 0x55, 0x5B, 0xDC, 0xFA, 0x6A, 0x68, 0xCA, 0xE2, 0xF6, 0x57, 0x03, 0x48, 0xBD,
-    0x73, 0xF7, 0x8F, 0xB0, 0x9C, 0xDF, 0xDD, 0xFA, 0x13, 0x74, 0xFE, 0xE0, 0xC5, 0x3F, 0xB1, 0xC3,
-    0x1F, 0x81, 0xA6, 0x7C, 0x21, 0x92, 0xCB, 0x21, 0xF0, 0x56, 0xD7, 0x1A, 0x6E, 0x29, 0xA4, 0xA7,
-    0x76, 0x6B, 0x35, 0xBA, 0xDA, 0x8B, 0xE2, 0xD3, 0xB9, 0x9F, 0xC3, 0xDD, 0x99, 0x02, 0x36, 0x7D,
-    0x42, 0xEA, 0xAE, 0xD8, 0x30, 0x3A, 0xC9, 0x5F, 0x41, 0x45, 0x67, 0x9A, 0x97, 0x27, 0x13, 0x3F,
-    0xD4, 0xD9, 0x84, 0x4E, 0x70, 0x5C, 0x10, 0x3B, 0x50, 0xC7, 0x65, 0xF4, 0xBD, 0x5F, 0x82, 0x53,
-    0x0D, 0x18, 0xA9, 0xB5, 0xC7, 0x87, 0x87, 0x1E, 0x14, 0xAA, 0x51, 0x45, 0x05, 0x06, 0x0B, 0xC7,
-    0x1F, 0xFC, 0xB2, 0xC5, 0x6E, 0x0C, 0x5C, 0xD5, 0x3A, 0x29, 0xC4, 0x71, 0x75, 0xAB, 0x6E, 0x27,
-    0x4F, 0x0C, 0xB4, 0xC2, 0x59, 0x08, 0xB5, 0x79, 0x47, 0x58, 0xFF, 0x31, 0x16, 0xC8, 0x58, 0x40,
-    0xA6, 0x7F, 0x20, 0x84, 0x78, 0xC0, 0x56, 0x05, 0xCD, 0x96, 0xF0, 0xD9, 0xB5, 0x9E, 0x74, 0x7C,
-    0x8D, 0xDD, 0x1C, 0xB7, 0xB9, 0x50, 0x06, 0x4B, 0x91, 0x5F, 0xB8, 0x23, 0xE4, 0x6B, 0xF6, 0xD0,
-    0xB0, 0xD8, 0xE4, 0x11, 0x14, 0x36, 0x02, 0xED, 0x55, 0x40, 0x67, 0xE1, 0xE6, 0x1F, 0xF7, 0x67,
-    0xE4, 0xC6, 0xBE, 0xC1, 0x40, 0xC0, 0xCE, 0x8C, 0x7C, 0x53, 0xDF, 0x38, 0xB2, 0x2F, 0xA2, 0x36,
-    0x1D, 0x40, 0x4E, 0xF5, 0x16, 0x81, 0xC6, 0xEC, 0x50, 0x77, 0xA8, 0x53, 0x86, 0xF3, 0x7A, 0x28,
-    0x79, 0x7B, 0x78, 0xB9, 0x5F, 0x0B, 0xED, 0x6E, 0x1D, 0x72, 0xAE, 0x87, 0x97, 0x7D, 0xE1, 0x1B,
-    0x3D, 0xFD, 0xFB, 0x35, 0x99, 0x15, 0x14, 0xB6, 0x3A, 0x64, 0xC6, 0x93, 0xC0, 0x7C, 0x9E, 0x22,
-    0x4F, 0x24, 0xC3, 0xF5, 0xD8, 0x1A, 0xFB, 0x24, 0x2A, 0xEC, 0x95, 0x12, 0xF4, 0xA5, 0x80, 0x15,
-    0xBE, 0x3F, 0x72, 0xE3, 0x72, 0x72, 0x83, 0xCD, 0x9A, 0x4D, 0xC2, 0xB3, 0x4B, 0x85, 0x5B, 0x8F,
-    0xC6, 0x99, 0xFA, 0xB1, 0x16, 0x8B, 0x96, 0x65, 0xD7, 0x46, 0x74, 0xE3, 0x35, 0x1E, 0x34, 0x1F,
-    0xCC, 0x95, 0xCA, 0x35, 0x2F, 0xB8, 0x11, 0x45, 0xAB, 0x43, 0x36, 0xBD, 0xB6, 0xA3, 0xCE, 0xF9,
-    0x56, 0xF6, 0xF0, 0x8A, 0xCA, 0xF1, 0x15, 0x01, 0x9E, 0xFB, 0xE2, 0x49, 0xFD, 0xA4, 0x2F, 0x9E,
-    0x5C, 0x08, 0x83, 0xE4, 0x71, 0x25, 0x78, 0xE3, 0x27, 0x50, 0x2B, 0xF6, 0x26, 0x7B, 0x2C, 0x39,
-    0x0F, 0x7E, 0xE3, 0xC6, 0x6A, 0xDC, 0x85, 0x33, 0x2B, 0x8E, 0x54, 0x27, 0x6D, 0x45, 0x70, 0x0D,
-    0x0C, 0x1F, 0x2F, 0x57, 0xB8, 0x5E, 0x69, 0xD5, 0xCE, 0xEA, 0xBF, 0xC5, 0xD7, 0x4E, 0x2E, 0x82,
-    0xB7, 0x43, 0xFC, 0x4B, 0x36, 0xA0, 0x81, 0xAE, 0x94, 0xA9, 0xF1, 0xD9, 0x6E, 0x29, 0x88, 0xDC,
-    0x57, 0x5E, 0x46, 0x95, 0x6B, 0x62, 0x50, 0xC7, 0x33, 0x54, 0x48, 0x94, 0xBE, 0xA8, 0x68, 0xDD,
-    0x4B, 0x73, 0x30, 0x1E, 0x54, 0xF8, 0xFC, 0x78, 0xFB, 0xC5, 0x01, 0xC7, 0xA6, 0x4B, 0xF5, 0xB9,
-    0xBA, 0xC9, 0x9D, 0x3B, 0xBD, 0x51, 0x6C, 0xCA, 0xBD, 0x13, 0x01, 0xC3, 0xB7, 0x73, 0x7E, 0x77,
-    0xDF, 0xB9, 0x63, 0xFD, 0x8F, 0xDF, 0xD7, 0x3A, 0x2D, 0xFD, 0xD6, 0x1F, 0x05, 0x54, 0x71, 0xA8,
-    0xAF, 0xE9, 0xFC, 0x2F, 0x8D, 0x55, 0x4D, 0x6C, 0xDC, 0x54, 0x10, 0x1E, 0xFB, 0x65, 0x63, 0x88,
-    0x69, 0xDD, 0x43, 0x56, 0x40, 0xFF, 0x5C, 0x21, 0x90, 0xAA, 0x92, 0xED, 0xF6, 0xD0, 0x43, 0x2A,
-    0x79, 0xF3, 0x1C, 0x82, 0x28, 0xA2, 0x87, 0x6C, 0x21, 0x56, 0x0F, 0x1C, 0x9A, 0x63, 0x55, 0x84,
-    0x9A, 0xC3, 0x1E, 0xB6, 0x62, 0x13, 0x3B, 0x29, 0x52, 0x24, 0x2A, 0xD1, 0x08, 0x0E, 0x1C, 0xC9,
-    0x81, 0x43, 0xD9, 0x0A, 0x69, 0x0F, 0x39, 0xB4, 0x52, 0x12, 0x9B, 0x04, 0x29, 0x52, 0x7B, 0xC0,
-    0x29, 0x42, 0x45, 0xF4, 0x50, 0x57, 0xAD, 0x40, 0x4A, 0x2F, 0xAF, 0xE0, 0xAA, 0x6E, 0xFA, 0xBC,
-    0xC3, 0x3C, 0xA7, 0x05, 0x8A, 0x54, 0x09, 0x6B, 0x6D, 0x79, 0xDF, 0x9B, 0x99, 0x37, 0x33, 0xDF,
-    0xF7, 0x8D, 0xCB, 0x2E, 0x4F, 0x2C, 0x61, 0xA4, 0x9A, 0x84, 0x31, 0xF0, 0x00, 0x03, 0x0C, 0x42,
-    0xD7, 0x77, 0x4B, 0x00, 0x50, 0x76, 0x35, 0x4C, 0x0C, 0x14, 0xF6, 0x1D, 0xE9, 0xBB, 0xF9, 0x18,
-    0x94, 0x69, 0x4D, 0xCF, 0x8D, 0x15, 0x7C, 0x7C, 0x1B, 0x51, 0x2C, 0xDA, 0x69, 0x3F, 0xD4, 0x61,
-    0x67, 0xFB, 0x4B, 0x44, 0x1F, 0x6F, 0x7B, 0x63, 0x3B, 0xDB, 0xED, 0x73, 0x88, 0x92, 0x23, 0x4E,
-    0x7B, 0x5E, 0xBD, 0x1F, 0xBC, 0x94, 0xDD, 0xD9, 0x0C, 0x47, 0x31, 0x33, 0x31, 0xD0, 0x5C, 0x00,
-    0xEB, 0x1E, 0x19, 0xBA, 0x60, 0x8F, 0x24, 0xDD, 0xEA, 0x6A, 0x16, 0x9A, 0xD3, 0x29, 0xE8, 0x78,
-    0x1E, 0x8F, 0x77, 0x59, 0x1A, 0x9E, 0x4B, 0xFB, 0x5C, 0xCD, 0xAD, 0xA6, 0x53, 0xF2, 0x72, 0xED,
-    0x72, 0x6D, 0x4A, 0x56, 0x53, 0xCD, 0xD5, 0xC6, 0xCA, 0xAE, 0xBF, 0x26, 0x2D, 0x81, 0x2C, 0xE3,
-    0xC1, 0x92, 0x19, 0x97, 0xE8, 0x38, 0xCA, 0xC2, 0xD7, 0x72, 0x7E, 0x2D, 0xB5, 0x30, 0x36, 0x91,
-    0x6C, 0xA0, 0x34, 0x72, 0x3F, 0x5B, 0xE2, 0xD6, 0xEA, 0xED, 0xEC, 0x14, 0x94, 0x4B, 0x23, 0x42,
-    0x4E, 0xD9, 0xB3, 0xEB, 0xE9, 0x52, 0xB5, 0x6F, 0x66, 0xBE, 0x3C, 0x5C, 0xE7, 0x6B, 0x99, 0x75,
-    0x5D, 0x1A, 0x22, 0xD7, 0x52, 0x0E, 0xF5, 0x12, 0xB4, 0x80, 0x65, 0xDA, 0xE8, 0xFA, 0xE8, 0xAB,
-    0x07, 0x87, 0x74, 0x11, 0x52, 0xAD, 0x19, 0xF4, 0x03, 0x45, 0xAD, 0x22, 0x43, 0xB4, 0x37, 0xE4,
-    0xA2, 0xF6, 0x80, 0x12, 0x81, 0x5C, 0x97, 0x2C, 0x33, 0x85, 0x2D, 0x78, 0xEC, 0x47, 0x65, 0x60,
-    0x39, 0x93, 0x66, 0x6A, 0x09, 0x3B, 0xE6, 0x11, 0xA7, 0x3E, 0x20, 0xFF, 0xF1, 0x0F, 0xE9, 0xDB,
-    0xAB, 0x62, 0xEC, 0xBF, 0x3B, 0xE5, 0x61, 0xD4, 0x73, 0x96, 0x31, 0x41, 0x41, 0x3C, 0x08, 0x23,
-    0x3F, 0xA2, 0xF5, 0xA0, 0x44, 0xE5, 0x83, 0x96, 0x7C, 0x38, 0x2A, 0xCB, 0x82, 0x45, 0x3D, 0xF4,
-    0xA7, 0xA1, 0xFF, 0x6C, 0xC9, 0xDA, 0xF1, 0x44, 0xA3, 0x77, 0x60, 0x28, 0x0F, 0x5C, 0x8A, 0xA0,
-    0x09, 0x86, 0x0B, 0x1D, 0xB0, 0x00, 0x04, 0xBC, 0x08, 0xE4, 0xEE, 0x47, 0x55, 0x61, 0xA5, 0xD5,
-    0xCC, 0xCE, 0xCC, 0x84, 0xCC, 0x8C, 0xF3, 0x3F, 0xAD, 0x8B, 0x49, 0x2B, 0x98, 0xD3, 0x03, 0x0B,
-    0x9A, 0xBB, 0x1E, 0x61, 0x0A, 0x70, 0xE0, 0x22, 0x97, 0x46, 0x60, 0xB8, 0xA6, 0x8A, 0x43, 0xAE,
-    0x8E, 0xDD, 0x3D, 0x73, 0x77, 0x00, 0xE6, 0xE1, 0xF4, 0x25, 0x54, 0x3E, 0x65, 0xB0, 0x63, 0x53,
-    0xE8, 0x12, 0xBA, 0x10, 0x8E, 0x60, 0x84, 0x31, 0x8F, 0xA1, 0x2F, 0xB0, 0xA3, 0x6A, 0x91, 0x17,
-    0xFF, 0x85, 0x4B, 0x5B, 0xEA, 0xDF, 0x80, 0x26, 0xF9, 0x9D, 0x9C, 0x47, 0xFF, 0x06, 0xA7, 0xE4,
-    0x72, 0xB1, 0x2C, 0x53, 0x27, 0x75, 0x96, 0x25, 0x17, 0x2A, 0x4F, 0x1E, 0x77, 0x4D, 0xC1, 0xA9,
-    0x59, 0x2C, 0xB1, 0x52, 0x43, 0x82, 0x3C, 0x21, 0xFD, 0xCC, 0x8F, 0x99, 0xE0, 0x2C, 0xB5, 0x22,
-    0x3E, 0x8F, 0x31, 0x02, 0x94, 0x5C, 0x69, 0x4F, 0xA7, 0x55, 0x5A, 0x34, 0x92, 0x53, 0xD0, 0xD7,
-    0x6E, 0x1B, 0x88, 0x2B, 0x31, 0x08, 0x01, 0x4D, 0x07, 0x2A, 0x25, 0x28, 0x0A, 0xEE, 0x0C, 0xEE,
-    0xB9, 0x92, 0xB7, 0xF8, 0x2D, 0x41, 0xEF, 0xFD, 0x50, 0xB6, 0x22, 0x7F, 0x46, 0x86, 0x2E, 0x47,
-    0xD7, 0xC0, 0x00, 0x3C, 0x57, 0x51, 0x0F, 0xB8, 0x04, 0x8E, 0x01, 0xBF, 0x26, 0x78, 0x10, 0x96,
-    0x28, 0x6C, 0x3F, 0xF4, 0x0F, 0x81, 0xE4, 0xF7, 0x32, 0x1B, 0x05, 0x31, 0x8A, 0xD2, 0xA0, 0x0E,
-    0xD9, 0x38, 0x8C, 0x68, 0x6D, 0x74, 0x27, 0x21, 0xAB, 0x6B, 0x45, 0x93, 0x73, 0xB6, 0x8E, 0x8F,
-    0x05, 0x62, 0xD6, 0x32, 0xB3, 0x12, 0xEC, 0x20, 0x7E, 0xCE, 0x23, 0xAE, 0x22, 0x96, 0xBC, 0x7A,
-    0xD9, 0xF3, 0x8E, 0x21, 0xE6, 0xA7, 0xDB, 0xED, 0xA0, 0xE4, 0x79, 0xE4, 0x98, 0x13, 0x65, 0x03,
-    0xD5, 0x24, 0xCF, 0x1B, 0x21, 0x8F, 0x03, 0xED, 0x76, 0xD1, 0xC5, 0x65, 0x5D, 0xE0, 0x66, 0xE6,
-    0xA3, 0x1C, 0x32, 0xF3, 0x12, 0xE5, 0x47, 0xEB, 0x27, 0x11, 0x7F, 0x47, 0x7C, 0xE0, 0x79, 0x63,
-    0x44, 0xEF, 0xE2, 0x1D, 0xB1, 0x1B, 0xAA, 0x67, 0x0C, 0x7F, 0x5F, 0x1D, 0x30, 0x32, 0xE0, 0x99,
-    0x8E, 0xB1, 0x9D, 0x03, 0x4F, 0xC0, 0x72, 0xA1, 0xE7, 0x9F, 0x5D, 0x49, 0x77, 0x95, 0x52, 0x64,
-    0x0A, 0x96, 0x45, 0xBA, 0x6D, 0x3A, 0x9A, 0xA9, 0x0E, 0x4C, 0x2A, 0xE4, 0x22, 0xD2, 0x16, 0xE1,
-    0x09, 0x43, 0x74, 0x9B, 0xF4, 0x47, 0xCB, 0x54, 0xC7, 0x15, 0xEA, 0xF1, 0xFF, 0x77, 0x3E, 0xA0,
-    0x0E, 0xEA, 0x83, 0xCC, 0x88, 0x1C, 0x73, 0x35, 0x3D, 0x02, 0xFB, 0xE1, 0x15, 0x07, 0x06, 0x9A,
-    0xE0, 0x5C, 0xF1, 0x5A, 0x54, 0x20, 0xC9, 0x52, 0x05, 0x45, 0x79, 0xC4, 0x6B, 0x35, 0x60, 0xB0,
-    0x03, 0x8D, 0x10, 0x45, 0xBB, 0x3D, 0xAF, 0x42, 0x3C, 0xCC, 0x6A, 0x53, 0x1F, 0x13, 0x2E, 0xF4,
-    0xDE, 0x03, 0x95, 0x96, 0x2D, 0x08, 0x51, 0xD1, 0x50, 0x27, 0x80, 0x19, 0x2F, 0xB1, 0xD8, 0x24,
-    0xCE, 0x39, 0xBA, 0x50, 0xE9, 0x3D, 0xAF, 0x79, 0x6E, 0xD9, 0xA5, 0xF1, 0xA1, 0xE5, 0x9A, 0xD4,
-    0xEA, 0x9A, 0x67, 0xE4, 0x44, 0xDD, 0x38, 0x54, 0x38, 0x3D, 0x03, 0x8B, 0x5D, 0xC0, 0x72, 0xDA,
-    0x94, 0x27, 0x23, 0x69, 0xB9, 0x75, 0xD0, 0xDA, 0x54, 0x15, 0x5E, 0x38, 0x27, 0xC3, 0x0B, 0xA2,
-    0xCB, 0x57, 0xE5, 0x41, 0x3B, 0xBA, 0x0C, 0x05, 0x96, 0x2C, 0xE5, 0x47, 0x1F, 0xF9, 0xD7, 0x55,
-    0xED, 0x16, 0xE2, 0xC3, 0x8D, 0xF6, 0x95, 0x18, 0x2A, 0xA4, 0x8F, 0xFD, 0xA0, 0x07, 0xCF, 0xCF,
-    0x41, 0x8D, 0x80, 0x21, 0x6B, 0xF6, 0x36, 0x8D, 0x80, 0x77, 0xA6, 0xE7, 0xCB, 0xC7, 0xBA, 0x1F,
-    0xC5, 0x03, 0x2C, 0x72, 0xA8, 0xAA, 0x9E, 0xC6, 0xFB, 0xB8, 0xF6, 0x75, 0x28, 0x3B, 0xB8, 0x7E,
-    0x6C, 0x0B, 0x18, 0x9A, 0x72, 0xDC, 0x2D, 0x7E, 0xD0, 0x3B, 0xB7, 0xDB, 0xCE, 0x5B, 0xB5, 0x30,
-    0x6D, 0x98, 0x31, 0x2C, 0x00, 0x29, 0x46, 0x27, 0x04, 0x54, 0x6B, 0x08, 0xD5, 0x01, 0x0B, 0xB3,
-    0x8A, 0x9D, 0x14, 0xBD, 0x68, 0x70, 0x14, 0x0B, 0x7E, 0x44, 0xB3, 0x04, 0xA6, 0xDD, 0xBD, 0x26,
-    0x9D, 0x3B, 0xBB, 0x91, 0x19, 0x6C, 0x0B, 0xE4, 0x09, 0x7B, 0xE5, 0x91, 0xA5, 0x25, 0x15, 0x28,
-    0x74, 0x7F, 0x43, 0x32, 0xC9, 0xF2, 0x09, 0xB5, 0x71, 0x03, 0x68, 0x78, 0x6D, 0x1B, 0x87, 0xAB,
-    0x87, 0x60, 0x0E, 0x3E, 0xD5, 0xF6, 0x01, 0xBC, 0x04, 0xE4, 0xD3, 0xAB, 0x72, 0x18, 0x1F, 0xA7,
-    0x83, 0xBE, 0x52, 0x56, 0xDB, 0x26, 0x08, 0xEC, 0x43, 0x37, 0x28, 0x39, 0x6D, 0xDB, 0x04, 0xAD,
-    0xD6, 0xE3, 0x5E, 0x85, 0x27, 0xBC, 0x00, 0x3A, 0xED, 0xFE, 0xA0, 0x1D, 0x82, 0x7D, 0xDA, 0xD5,
-    0xC3, 0x30, 0x5B, 0x04, 0xDB, 0x8A, 0x7B, 0x51, 0xBF, 0xA8, 0x7F, 0xE7, 0x47, 0xBE, 0x12, 0xF6,
-    0xA0, 0x99, 0x70, 0x1B, 0xDF, 0x85, 0xDE, 0xEF, 0xE5, 0x10, 0x8B, 0x68, 0xC0, 0xF5, 0x82, 0xB6,
-    0x4C, 0xB2, 0x9A, 0xD9, 0x0C, 0x2D, 0xB7, 0xD6, 0x94, 0x97, 0x8D, 0x54, 0x71, 0x45, 0xD5, 0xFE,
-    0x05, 0xEB, 0x1A, 0x34, 0xDC, 0x1E, 0xAA, 0xEE, 0xD5, 0x97, 0xF8, 0x48, 0xB2, 0x2B, 0xEE, 0x9B,
-    0x33, 0x13, 0x3B, 0x5A, 0x9C, 0x7A, 0x0F, 0xE6, 0x34, 0x77, 0x89, 0x25, 0xF6, 0x9A, 0xB0, 0xAE,
-    0x35, 0x96, 0xB7, 0x0F, 0xC6, 0x03, 0xBB, 0x89, 0x53, 0xE6, 0x13, 0x4E, 0x6D, 0xCD, 0x71, 0x42,
-    0x27, 0xF8, 0xFC, 0x03, 0x9C, 0x49, 0xF7, 0x8A, 0xD7, 0x14, 0x56, 0xD5, 0x9B, 0xE9, 0xD9, 0xA5,
-    0x56, 0x67, 0x70, 0x1B, 0xFD, 0xCE, 0x76, 0x5B, 0xF6, 0x0D, 0x71, 0xD8, 0x80, 0xF0, 0xD7, 0x45,
-    0x3D, 0x7A, 0x5D, 0xD1, 0x55, 0xBF, 0x9F, 0xD3, 0xD3, 0x7F, 0xAB, 0xEB, 0xC2, 0x99, 0x54, 0x57,
-    0xBA, 0xA1, 0x6F, 0x0B, 0xAA, 0x09, 0x75, 0x06, 0xEF, 0x6E, 0x91, 0x58, 0x17, 0x85, 0xC9, 0x0C,
-    0xD2, 0x27, 0x22, 0x7B, 0xC6, 0xE4, 0x4D, 0x65, 0x42, 0x48, 0xB7, 0x47, 0xB1, 0x90, 0x32, 0x0A,
-    0x8F, 0x84, 0x48, 0x60, 0x7F, 0xEB, 0x6F, 0xA9, 0x30, 0x27, 0xFC, 0xC7, 0xB6, 0x00, 0xD0, 0x71,
-    0xD3, 0x85, 0x16, 0xD1, 0x05, 0x2F, 0x65, 0xFC, 0x9E, 0xB2, 0x9D, 0x84, 0x5E, 0x9A, 0xF3, 0x3B,
-    0x68, 0x6F, 0xC7, 0x53, 0x29, 0x9A, 0xB8, 0x49, 0xA8, 0xD2, 0x66, 0x00, 0x85, 0x84, 0xAD, 0x47,
-    0x40, 0xA3, 0xBA, 0xAB, 0xCA, 0xF8, 0x6C, 0xEE, 0xA9, 0x8C, 0x9E, 0x5C, 0xCC, 0xA5, 0xE0, 0xDE,
-    0x89, 0xA4, 0xD0, 0xBD, 0xF4, 0xD5, 0xB3, 0x10, 0x05, 0x0B, 0x0A, 0x5E, 0x83, 0xFE, 0xB6, 0x9D,
-    0x3B, 0x4E, 0xD3, 0x69, 0x36, 0x27, 0x53, 0xDE, 0xA1, 0x95, 0x79, 0x6B, 0xB1, 0xE2, 0xF0, 0xAC,
-    0xE6, 0xD6, 0xC6, 0x6D, 0xB2, 0xB4, 0xF4, 0xC0, 0x5D, 0x70, 0x2C, 0x63, 0x26, 0xEE, 0x80, 0x36,
-    0x67, 0x67, 0xCA, 0xB6, 0xE1, 0x4C, 0x92, 0x34, 0x48, 0x68, 0x3D, 0x03, 0x15, 0x87, 0x2E, 0xE5,
-    0x3B, 0x44, 0x70, 0xEA, 0x73, 0xE1, 0x5A, 0x54, 0x01, 0xA1, 0xFF, 0xA6, 0x17, 0xA4, 0x07, 0x16,
-    0xBD, 0x91, 0xF8, 0xA9, 0xE3, 0xEC, 0xB5, 0x8C, 0xA3, 0xD3, 0x0F, 0xE3, 0x6A, 0xA7, 0x58, 0xB5,
-    0x60, 0xEF, 0x78, 0x55, 0xD6, 0x0A, 0xC7, 0x85, 0x46, 0xA7, 0xD3, 0x33, 0x3E, 0x5E, 0xED, 0xCA,
-    0x5A, 0x6D, 0x2B, 0x54, 0x73, 0x61, 0x61, 0xA1, 0xA3, 0x16, 0xFD, 0x15, 0x41, 0x92, 0xD5, 0x12,
-    0xD3, 0x25, 0xA6, 0x3D, 0xE0, 0xEB, 0x71, 0x85, 0x45, 0x35, 0x35, 0x26, 0xEA, 0x2F, 0xAF, 0xDC,
-    0xDC, 0xBE, 0x47, 0x7C, 0x12, 0x48, 0x16, 0x43, 0x49, 0x1B, 0xFE, 0x93, 0xB8, 0x6A, 0xC4, 0x2C,
-    0x65, 0xB7, 0xD8, 0xF5, 0xF8, 0x2F, 0xD5, 0x7D, 0x4D, 0xAC, 0xDD, 0xE6, 0x99, 0x1E, 0xCF, 0x39,
-    0x96, 0x4E, 0x63, 0x02, 0xA1, 0x17, 0x16, 0x30, 0x89, 0x07, 0x61, 0x17, 0x41, 0x51, 0x04, 0xD3,
-    0x70, 0x33, 0x8B, 0x2C, 0x26, 0x21, 0x6D, 0xA1, 0x30, 0x50, 0x2F, 0xA4, 0x01, 0x2C, 0x7B, 0x61,
-    0xA0, 0x1A, 0x14, 0xDD, 0x34, 0x33, 0xED, 0xED, 0xA6, 0x40, 0x50, 0x24, 0x21, 0x6D, 0x01, 0xF5,
-    0x42, 0x0B, 0x0B, 0xC5, 0x4C, 0xBA, 0x98, 0x45, 0xB4, 0xF0, 0x00, 0xC9, 0x55, 0x31, 0x77, 0xD3,
-    0x45, 0x80, 0x3A, 0x21, 0x2D, 0xA1, 0x23, 0xA0, 0x5E, 0x88, 0xB1, 0x91, 0x66, 0x91, 0x85, 0x69,
-    0xCB, 0x1E, 0x77, 0xE4, 0x85, 0x68, 0x8B, 0x8A, 0xA8, 0x2B, 0x92, 0x5F, 0x9F, 0xE7, 0x79, 0x3F,
-    0x9E, 0x73, 0xAE, 0x24, 0xA7, 0xCE, 0xD4, 0x46, 0xA6, 0xD7, 0xBE, 0x47, 0xF7, 0x9E, 0x1F, 0xF2,
-    0xFB, 0xDE, 0xEF, 0xFD, 0x79, 0xDE, 0xDF, 0x1B, 0x04, 0x67, 0x82, 0x20, 0x48, 0xAB, 0x20, 0x58,
-    0xF7, 0xF8, 0xA1, 0xC4, 0x77, 0x58, 0xE3, 0xE1, 0x74, 0xA0, 0x2F, 0xE7, 0xC6, 0x20, 0x77, 0x2E,
-    0x8B, 0x9D, 0xAB, 0x42, 0xE7, 0xDA, 0xD5, 0xC4, 0x27, 0xB3, 0x20, 0xC8, 0xF1, 0x89, 0xA4, 0xC5,
-    0x9B, 0xA7, 0xFD, 0x0B, 0x2B, 0xBC, 0x80, 0x77, 0x0E, 0x7C, 0xA7, 0x9E, 0x8C, 0x70, 0xA9, 0xD5,
-    0xC8, 0x77, 0x06, 0xFE, 0x9D, 0x87, 0xFB, 0x45, 0xC4, 0x8F, 0x3B, 0xD7, 0x2F, 0x78, 0x4D, 0xFB,
-    0x7A, 0x2D, 0xCE, 0x82, 0xFC, 0x54, 0x13, 0xC4, 0x57, 0xFA, 0x60, 0xD5, 0xBC, 0x16, 0x6C, 0xBE,
-    0x3E, 0xAF, 0xDB, 0xA6, 0xCE, 0x39, 0xFC, 0xE2, 0x5A, 0x7C, 0xC4, 0xAD, 0xF1, 0xDD, 0x04, 0x69,
-    0xE3, 0x3F, 0x24, 0x1A, 0x0C, 0xA4, 0xC1, 0x8D, 0x0B, 0x41, 0xC4, 0x97, 0x9C, 0xAD, 0x60, 0x58,
-    0xB8, 0xA0, 0xAC, 0x93, 0x66, 0x35, 0xE2, 0x7D, 0x69, 0x9D, 0x56, 0xAB, 0x11, 0xEF, 0x2B, 0xAB,
-    0xF2, 0x7F, 0xEC, 0x0D, 0x51, 0x5F, 0xBA, 0xCC, 0x3D, 0xE3, 0xEA, 0xA8, 0x2D, 0xBB, 0x99, 0x6C,
-    0x67, 0xB0, 0xD0, 0xB8, 0xDB, 0x59, 0x4B, 0x82, 0x4B, 0x2F, 0x3C, 0x45, 0xB9, 0x16, 0xAE, 0x23,
-    0xC3, 0xED, 0xBB, 0xA0, 0xC4, 0xD2, 0xB9, 0x6C, 0x6D, 0x2E, 0xC2, 0x1E, 0x16, 0x7A, 0xFF, 0x66,
-    0x4D, 0x38, 0x8A, 0xD5, 0xE0, 0x77, 0x13, 0x3E, 0xF0, 0xBE, 0x18, 0x3F, 0x2C, 0xA7, 0xDD, 0xF7,
-    0xD9, 0xD7, 0x13, 0xEE, 0xBD, 0xC0, 0xEF, 0x7B, 0x0C, 0xDC, 0xE1, 0x41, 0x95, 0xF6, 0xC1, 0xE3,
-    0x6B, 0xD1, 0xB0, 0xB2, 0xA5, 0x2D, 0xDD, 0x99, 0x67, 0xB9, 0x8A, 0x7A, 0x45, 0x02, 0xE2, 0x87,
-    0x6A, 0x3D, 0xE2, 0x19, 0xDE, 0xC6, 0x6E, 0xCC, 0x15, 0xB8, 0x6C, 0x11, 0xC4, 0xEE, 0x39, 0x12,
-    0xD9, 0x05, 0xA2, 0xF6, 0xDA, 0xDD, 0xDD, 0xF2, 0x06, 0x7E, 0x7B, 0x0F, 0x1F, 0x9D, 0x02, 0x91,
-    0xE8, 0xC6, 0xB0, 0xC2, 0x92, 0x78, 0x50, 0xFA, 0x76, 0xBC, 0x07, 0x56, 0x85, 0xCD, 0x06, 0x29,
-    0x9E, 0x88, 0x5C, 0x81, 0x27, 0x70, 0xF9, 0xB2, 0xB6, 0xE5, 0xA6, 0xF5, 0xE9, 0x20, 0xAF, 0xBF,
-    0xFF, 0x9C, 0xAB, 0x78, 0xD0, 0x39, 0x16, 0x1A, 0x83, 0xE4, 0xC1, 0xE3, 0xDA, 0x0D, 0xE8, 0x9B,
-    0x57, 0xD8, 0xAF, 0x2B, 0xA2, 0x6E, 0xC1, 0xC3, 0xC5, 0x35, 0xD3, 0x7A, 0xA5, 0x67, 0x87, 0xF9,
-    0xD9, 0xB8, 0x5D, 0x3A, 0x2C, 0x14, 0xEB, 0xE5, 0xB2, 0x49, 0x8E, 0x53, 0x55, 0xF4, 0x41, 0xB7,
-    0xBA, 0x3B, 0x04, 0xAF, 0x7D, 0x73, 0xC3, 0x49, 0x19, 0x0F, 0x16, 0x84, 0xC2, 0xD5, 0xB8, 0x30,
-    0xFC, 0x9E, 0x6F, 0x7E, 0x1F, 0x75, 0x3C, 0xF8, 0x1D, 0xDC, 0x13, 0x1D, 0xF9, 0xBD, 0xF1, 0xBF,
-    0x8B, 0xCC, 0xA2, 0x3C, 0x29, 0x82, 0x0F, 0x93, 0x43, 0xC8, 0x6B, 0x65, 0xA1, 0xB7, 0x47, 0x9D,
-    0xDE, 0x8F, 0x85, 0xE8, 0x18, 0xB9, 0x31, 0x17, 0x6C, 0xDE, 0xE4, 0xEC, 0x4D, 0x3C, 0xA6, 0xB2,
-    0xD2, 0x49, 0xF9, 0xF7, 0x83, 0x3C, 0x5F, 0x2B, 0x79, 0xFA, 0xD5, 0x12, 0xE4, 0x0F, 0xF1, 0x3E,
-    0xFB, 0x8A, 0xC9, 0x13, 0xA4, 0x9C, 0xE3, 0x39, 0xF3, 0x5C, 0x5A, 0xD1, 0xD9, 0x69, 0x19, 0x65,
-    0x41, 0xC6, 0xC0, 0x35, 0x74, 0x44, 0xB8, 0x11, 0x59, 0x16, 0x57, 0x5F, 0x8F, 0x99, 0xF8, 0xA0,
-    0x24, 0x01, 0xD3, 0x1A, 0x27, 0x5F, 0x93, 0x1B, 0xF4, 0xA9, 0xBC, 0x8A, 0x6E, 0xE7, 0x3D, 0x76,
-    0x80, 0x9D, 0x80, 0xFC, 0x2E, 0x4B, 0x1A, 0x50, 0x30, 0x26, 0x41, 0xCB, 0x4A, 0x54, 0xC5, 0xBA,
-    0x4B, 0x90, 0x76, 0xE9, 0x4E, 0x52, 0x94, 0x6E, 0xB8, 0x36, 0x75, 0x19, 0x64, 0x0E, 0xC7, 0x59,
-    0xEB, 0x12, 0x69, 0x87, 0xC3, 0x9B, 0xB2, 0x0D, 0x73, 0xA5, 0xF5, 0x62, 0x12, 0xFF, 0x71, 0xC3,
-    0xD8, 0x29, 0xF7, 0x8C, 0x75, 0x71, 0x85, 0xAE, 0xE0, 0xCE, 0xB1, 0x3A, 0x6E, 0x1E, 0xBB, 0xE6,
-    0xBE, 0x70, 0x97, 0xD1, 0x76, 0xE4, 0x78, 0x21, 0x37, 0x8B, 0x21, 0x79, 0x66, 0xFF, 0x60, 0x2A,
-    0xFB, 0x90, 0x97, 0x48, 0xDB, 0xB4, 0xC1, 0x25, 0xF3, 0x0A, 0xF7, 0xC6, 0x0B, 0x58, 0x3D, 0xD7,
-    0xC9, 0x4B, 0x64, 0x79, 0x83, 0x4B, 0xB8, 0x03, 0x87, 0xC5, 0x92, 0x3C, 0x91, 0x84, 0x26, 0xCB,
-    0xF1, 0x9C, 0xBB, 0xF0, 0x69, 0x05, 0xFA, 0xE2, 0x46, 0xA0, 0x8B, 0x07, 0x04, 0xBA, 0x4A, 0xAB,
-    0xF5, 0x20, 0x86, 0x2B, 0xC1, 0x72, 0xD8, 0x14, 0x04, 0x3A, 0x8B, 0xDA, 0xA8, 0xB5, 0xB3, 0x3F,
-    0xF6, 0x2C, 0x19, 0x80, 0x97, 0xD1, 0xB5, 0x24, 0x65, 0x2B, 0x4A, 0x62, 0xF0, 0xEC, 0x96, 0xC7,
-    0xB8, 0x07, 0x48, 0x90, 0xD1, 0x35, 0xEC, 0x71, 0xBC, 0xAB, 0x89, 0x3C, 0xE1, 0x9E, 0x14, 0xBF,
-    0x81, 0x0E, 0x71, 0x8B, 0x87, 0x70, 0x72, 0x3C, 0x7B, 0x8A, 0x01, 0x97, 0x03, 0xC5, 0x25, 0x46,
-    0xC1, 0x7B, 0xC2, 0x3E, 0x6D, 0x03, 0xE9, 0x15, 0x10, 0x52, 0x9F, 0xC1, 0xEF, 0x49, 0x8B, 0xDF,
-    0xB9, 0xA0, 0x82, 0xEB, 0x04, 0x2D, 0x82, 0x35, 0xF7, 0x75, 0x8C, 0xF2, 0x67, 0x2C, 0x90, 0x92,
-    0x71, 0xD6, 0xE4, 0x91, 0xE0, 0xA7, 0x5A, 0xEC, 0x66, 0x49, 0xB8, 0x17, 0x2E, 0xB2, 0xC6, 0x7E,
-    0x1B, 0x1C, 0x64, 0xD8, 0x2D, 0xA1, 0x0D, 0xB0, 0xEF, 0x81, 0x97, 0xC7, 0x2B, 0x45, 0x09, 0x66,
-    0xAA, 0xF3, 0x83, 0x3A, 0xEA, 0xD2, 0x6B, 0x78, 0x25, 0x79, 0x0B, 0xAF, 0x44, 0xEF, 0xE0, 0x95,
-    0x57, 0xDA, 0x32, 0x4B, 0x7E, 0xD5, 0xA5, 0x55, 0x74, 0xA7, 0x8F, 0xA0, 0x41, 0x06, 0x7E, 0x6C,
-    0xC4, 0x91, 0xE7, 0x20, 0x5A, 0x96, 0x90, 0xE9, 0x20, 0xCB, 0x7C, 0xA5, 0x5A, 0x83, 0xA9, 0x6A,
-    0xE9, 0x1F, 0x7E, 0x2D, 0x06, 0x92, 0x25, 0x7F, 0x6A, 0xA0, 0xB0, 0xF3, 0xC9, 0x92, 0x4B, 0x9C,
-    0xD5, 0x9E, 0x89, 0x1C, 0xA8, 0x87, 0x2D, 0xB8, 0x0C, 0x04, 0x4A, 0x78, 0xDE, 0x6B, 0x0A, 0x33,
-    0x96, 0x04, 0xE9, 0x48, 0x6A, 0x30, 0xD2, 0xBA, 0x97, 0xD8, 0x50, 0x4A, 0xD2, 0x37, 0x70, 0xB5,
-    0xF0, 0xDE, 0x40, 0x56, 0x93, 0x8A, 0xE3, 0x69, 0x44, 0x14, 0x0B, 0xA9, 0x11, 0x7E, 0x04, 0x0F,
-    0x20, 0xE2, 0xB7, 0x29, 0x23, 0x09, 0x1F, 0x42, 0x27, 0xCD, 0xD6, 0x6C, 0x09, 0x01, 0x5E, 0xA5,
-    0x9E, 0xC0, 0x9B, 0xC9, 0xA8, 0x0D, 0xD6, 0x8A, 0x4B, 0x83, 0x9C, 0xC3, 0xCE, 0x2B, 0xE1, 0xCE,
-    0x2B, 0x19, 0xDF, 0x56, 0xF9, 0x57, 0x0A, 0x71, 0xE6, 0x6A, 0xF7, 0x95, 0xA5, 0x33, 0xB6, 0x86,
-    0xF9, 0x29, 0x6B, 0xF1, 0x1D, 0x79, 0x4A, 0x16, 0xC8, 0x79, 0xDE, 0x30, 0xAE, 0x91, 0x46, 0x92,
-    0xB4, 0x1E, 0xBF, 0xE8, 0xD5, 0x3E, 0x8D, 0x82, 0x54, 0xF0, 0xC0, 0x95, 0x62, 0xB9, 0xE9, 0x4D,
-    0xE8, 0x84, 0x11, 0x16, 0x37, 0xFA, 0x18, 0x4F, 0x95, 0x4F, 0x77, 0xB8, 0x40, 0x5C, 0x83, 0x10,
-    0x79, 0x16, 0x38, 0x10, 0x3C, 0xEC, 0x40, 0xD0, 0xF4, 0xC6, 0x01, 0xD5, 0xB8, 0xAB, 0x62, 0xDE,
-    0x82, 0x37, 0x23, 0x4F, 0x40, 0x5A, 0x82, 0xF4, 0xE7, 0x64, 0xB0, 0x53, 0x3D, 0xAE, 0x81, 0xBB,
-    0x85, 0x32, 0x2A, 0xB4, 0x76, 0x0D, 0x0D, 0xCB, 0x92, 0xAB, 0xE2, 0x2D, 0x29, 0x9D, 0xD4, 0x3F,
-    0xE4, 0xAC, 0x25, 0xC5, 0x78, 0xD6, 0xF7, 0xF1, 0xA1, 0x83, 0xE8, 0xAD, 0x1D, 0xF5, 0x06, 0xA4,
-    0x2E, 0x69, 0x71, 0xAE, 0x7D, 0xDC, 0x86, 0x63, 0x38, 0x1D, 0x48, 0xA4, 0x4C, 0xF8, 0xA5, 0xF0,
-    0x53, 0x28, 0x7A, 0xD9, 0xE4, 0x35, 0x3F, 0x9D, 0xD0, 0x82, 0xB9, 0x22, 0x6D, 0xC1, 0x83, 0x65,
-    0x15, 0x91, 0xE5, 0xF3, 0x8A, 0xCA, 0xF8, 0x92, 0xEE, 0xDF, 0xF1, 0xF2, 0x81, 0x8C, 0xE7, 0x1A,
-    0x5A, 0x25, 0xA0, 0x9C, 0x61, 0x29, 0xD2, 0x5A, 0x79, 0x0D, 0x09, 0x71, 0xD4, 0x32, 0x3D, 0x35,
-    0x02, 0x38, 0x49, 0xAB, 0xA1, 0x76, 0xF1, 0xAB, 0xAF, 0xB7, 0xAB, 0x2F, 0x6C, 0xF5, 0xD1, 0xBC,
-    0xFA, 0x19, 0x03, 0x3C, 0xFC, 0xC9, 0x6A, 0x67, 0x9F, 0xBB, 0x4F, 0x9A, 0xFE, 0x9C, 0x48, 0x73,
-    0x27, 0x3B, 0x44, 0xF4, 0xA1, 0xFB, 0x06, 0x71, 0xC3, 0x77, 0xA7, 0xB5, 0xD4, 0x7B, 0x45, 0x75,
-    0x06, 0x6D, 0xD9, 0x51, 0xCF, 0xF2, 0x4A, 0xA4, 0x09, 0x05, 0x09, 0xA7, 0x88, 0x33, 0xC5, 0x4D,
-    0xA5, 0x2C, 0x02, 0x69, 0x0A, 0x4A, 0x65, 0x59, 0x79, 0x15, 0x87, 0xB3, 0x70, 0xD9, 0xA3, 0xEE,
-    0xF0, 0x92, 0xFB, 0xDF, 0xD2, 0x6F, 0x03, 0x8F, 0xCA, 0xF5, 0x89, 0x54, 0x1E, 0x79, 0x00, 0xC7,
-    0xA5, 0x53, 0xE0, 0x72, 0x92, 0x86, 0xAC, 0x91, 0x36, 0x27, 0xB0, 0x3C, 0x7C, 0xA7, 0x06, 0x31,
-    0xB8, 0xEB, 0xF6, 0xC8, 0xAE, 0xB9, 0x82, 0x50, 0x67, 0xB6, 0xFF, 0xEA, 0x7C, 0x66, 0x81, 0xE0,
-    0xD0, 0x60, 0x16, 0xF6, 0xC8, 0xAE, 0xC1, 0x8F, 0x17, 0x65, 0xC9, 0xB9, 0xC7, 0x5C, 0xC6, 0x23,
-    0xA6, 0x4A, 0x86, 0xA9, 0x07, 0x5C, 0xD1, 0x55, 0xB9, 0xA9, 0x48, 0xEA, 0xA5, 0x2C, 0x64, 0x8C,
-    0x56, 0x63, 0x38, 0x92, 0x67, 0xA3, 0x36, 0xC7, 0x1A, 0xC3, 0x2E, 0xBD, 0xC2, 0xAB, 0xC6, 0x1F,
-    0x4D, 0x29, 0xF5, 0x49, 0x7A, 0xD3, 0xDB, 0x1C, 0xB3, 0x48, 0x54, 0xAD, 0x95, 0x59, 0x24, 0x27,
-    0x6E, 0xDE, 0xBB, 0xCE, 0x77, 0x27, 0x7D, 0xF9, 0x8C, 0x24, 0xF4, 0xCA, 0x40, 0x54, 0x11, 0x0F,
-    0xE2, 0xCC, 0xC0, 0xD5, 0x54, 0xA6, 0x41, 0x34, 0x2D, 0xA7, 0x05, 0xD6, 0x52, 0xB6, 0x38, 0xFC,
-    0x09, 0xD7, 0xC0, 0x62, 0x28, 0x53, 0x9D, 0xAD, 0xCC, 0x43, 0x15, 0xF1, 0x0B, 0x51, 0xDE, 0x10,
-    0x1C, 0xBE, 0xE0, 0xB2, 0xC7, 0xC0, 0x24, 0x66, 0x27, 0x57, 0xDA, 0x7E, 0x70, 0xEC, 0x12, 0xF4,
-    0x04, 0xB6, 0xB5, 0x20, 0x2B, 0xCA, 0xC4, 0x3D, 0x31, 0x7A, 0xF9, 0x9F, 0x89, 0xB4, 0x9E, 0xC2,
-    0x3F, 0x7F, 0xC2, 0x3D, 0x45, 0xF5, 0x8E, 0xF5, 0x16, 0x21, 0x19, 0x6A, 0x21, 0x03, 0x0A, 0x89,
-    0xC5, 0xBE, 0x17, 0x10, 0x0A, 0xB0, 0x6C, 0xB7, 0x04, 0xC3, 0x52, 0x03, 0xE6, 0x5C, 0x49, 0x4A,
-    0xDD, 0x98, 0xDC, 0x6C, 0xC2, 0x2E, 0xFE, 0x10, 0xBC, 0x19, 0xDD, 0xC2, 0x2B, 0x61, 0x87, 0x57,
-    0xAE, 0xF4, 0x79, 0x11, 0x5F, 0x1F, 0x92, 0x3A, 0xFC, 0xF5, 0x08, 0xEE, 0x1E, 0x27, 0xD9, 0x52,
-    0x7D, 0x2C, 0xC3, 0x2B, 0xAE, 0xC2, 0x2B, 0x8E, 0x7C, 0xEF, 0x1A, 0xBE, 0xD2, 0x52, 0x37, 0x76,
-    0x04, 0x04, 0xFE, 0x2B, 0xA9, 0x20, 0xC0, 0xA1, 0x4E, 0x9B, 0x96, 0x18, 0xA7, 0x46, 0xCA, 0x9D,
-    0xF8, 0xDD, 0xA8, 0xE6, 0xB4, 0x06, 0x09, 0x69, 0xCB, 0x32, 0xE9, 0x5A, 0x3C, 0x45, 0x14, 0x40,
-    0x0E, 0x48, 0x6B, 0x10, 0x3A, 0xE6, 0x79, 0xAD, 0x07, 0x3C, 0x2C, 0x5D, 0x49, 0x76, 0x97, 0x62,
-    0x22, 0x68, 0x8B, 0x79, 0xD0, 0xE1, 0x00, 0x5E, 0x5C, 0x4E, 0xE2, 0x9B, 0x27, 0x1D, 0xE9, 0x99,
-    0xF2, 0x33, 0xF8, 0x9D, 0x56, 0x9A, 0x7C, 0x28, 0xE6, 0x8F, 0x4C, 0x6B, 0x92, 0xE2, 0x39, 0x0D,
-    0x9B, 0x09, 0x99, 0x58, 0x86, 0xE6, 0x56, 0xD8, 0xA4, 0x32, 0xA8, 0xB1, 0x1A, 0xCC, 0xBC, 0x45,
-    0xAD, 0x61, 0x92, 0x40, 0xD0, 0x5D, 0x76, 0x73, 0x49, 0x34, 0x62, 0xE0, 0x4F, 0x48, 0xCF, 0x20,
-    0xA0, 0xEC, 0x1F, 0xF7, 0xD0, 0x7D, 0xD1, 0xD1, 0x24, 0x3B, 0xA2, 0x0B, 0xD8, 0x01, 0xEE, 0xA4,
-    0x96, 0xA8, 0x98, 0xA6, 0xEF, 0xC1, 0x20, 0xA0, 0x27, 0x6E, 0x03, 0x35, 0x03, 0x33, 0x43, 0x96,
-    0xAA, 0xA8, 0x6C, 0xF1, 0x7F, 0x4C, 0x4D, 0x53, 0xAD, 0xEE, 0xF5, 0x8B, 0x09, 0x17, 0x2E, 0xB3,
-    0xF8, 0xED, 0x3A, 0xFA, 0xB0, 0x5D, 0x0E, 0xE3, 0x62, 0x00, 0xD1, 0xAE, 0xD5, 0xE9, 0x2B, 0xA0,
-    0xF3, 0xB8, 0xFE, 0x88, 0x34, 0xAE, 0x27, 0x1C, 0x6F, 0xF7, 0xB3, 0xE4, 0x0A, 0x20, 0x7E, 0x78,
-    0x9D, 0xC4, 0x6E, 0x7F, 0x56, 0x82, 0x7B, 0xA6, 0xD0, 0xD5, 0xF8, 0x64, 0x53, 0x0E, 0x38, 0xB1,
-    0x71, 0x0D, 0x90, 0x80, 0x3D, 0xE7, 0x80, 0x09, 0xAB, 0x61, 0xCD, 0x33, 0x48, 0x8B, 0x1C, 0x8C,
-    0x21, 0xE1, 0x85, 0x48, 0xB7, 0xC4, 0x03, 0xC4, 0x59, 0x58, 0xA6, 0x10, 0xAB, 0xA0, 0x96, 0xBD,
-    0x22, 0x0C, 0x9B, 0x40, 0xDC, 0xF7, 0x0F, 0xFA, 0x60, 0x83, 0x87, 0xA8, 0x06, 0x9C, 0xBD, 0x42,
-    0x93, 0x43, 0x18, 0x62, 0x0A, 0x47, 0x26, 0x27, 0x7F, 0xE0, 0x95, 0xBC, 0x32, 0x4B, 0x23, 0xD3,
-    0x5B, 0xDE, 0x95, 0x4E, 0x2B, 0x8C, 0xFC, 0xEE, 0x90, 0xD0, 0x3F, 0x8B, 0x7B, 0xD8, 0xDA, 0x10,
-    0x2E, 0x0A, 0x0E, 0x18, 0xE2, 0xB6, 0x1A, 0x13, 0x42, 0x0C, 0x1C, 0xD8, 0x8A, 0xA7, 0xBA, 0xE6,
-    0x43, 0x38, 0x48, 0x97, 0xF1, 0xA1, 0xC3, 0xAF, 0x09, 0xB9, 0x21, 0x6F, 0x12, 0xA0, 0xEB, 0x2A,
-    0x9E, 0x5E, 0x10, 0x0E, 0x9C, 0x88, 0xDD, 0x88, 0x5A, 0x05, 0x52, 0x4F, 0xCF, 0x3A, 0x40, 0xAB,
-    0x15, 0xE0, 0x5A, 0x0A, 0xD9, 0x61, 0x4D, 0x9F, 0x68, 0x54, 0x57, 0x3B, 0x46, 0xD5, 0x5E, 0x79,
-    0x88, 0x51, 0x7D, 0xD0, 0xDC, 0xE6, 0x7C, 0x85, 0xB7, 0xBB, 0x40, 0xCC, 0x54, 0x4B, 0xAF, 0x85,
-    0xA6, 0x23, 0xCB, 0x9A, 0xE6, 0x44, 0x6A, 0x19, 0xAC, 0x33, 0x8A, 0xBF, 0xD2, 0x7A, 0xAF, 0x97,
-    0xDD, 0xC2, 0xFB, 0x20, 0xA0, 0xA0, 0x43, 0x79, 0xE3, 0xB4, 0x14, 0x49, 0x70, 0xD4, 0x57, 0xDA,
-    0xC5, 0x87, 0xBF, 0x85, 0xC3, 0x74, 0xFF, 0x47, 0xD7, 0xB3, 0x5F, 0xF6, 0xA9, 0x1C, 0x26, 0x10,
-    0x6D, 0xE4, 0x37, 0x16, 0x37, 0x94, 0x72, 0x01, 0x1B, 0xEF, 0x07, 0x55, 0x76, 0x15, 0xEA, 0x33,
-    0x92, 0x18, 0xD2, 0xC1, 0x83, 0xE5, 0xF7, 0x72, 0x76, 0xA6, 0x46, 0xBB, 0x1B, 0x55, 0x1D, 0x6D,
-    0x15, 0xF7, 0xC4, 0xEF, 0xB5, 0x24, 0xCB, 0xE1, 0xBD, 0x19, 0x79, 0x8B, 0xD2, 0x22, 0xAE, 0x20,
-    0x38, 0xA8, 0x70, 0xD8, 0x21, 0xC1, 0xF2, 0x62, 0xE2, 0xC7, 0xD2, 0x2B, 0xB4, 0x7A, 0x1F, 0x4F,
-    0xBC, 0xA8, 0xBC, 0x63, 0xDE, 0x2A, 0xE2, 0xE6, 0x08, 0xF3, 0x71, 0x77, 0xEA, 0xFC, 0x44, 0x0F,
-    0xB8, 0xC1, 0x97, 0x4B, 0x61, 0x14, 0xE9, 0x5F, 0xE9, 0x5A, 0xE2, 0xDD, 0xC5, 0xD6, 0x05, 0x90,
-    0x96, 0x93, 0xE4, 0x85, 0x52, 0xE3, 0x7F, 0x4A, 0x03, 0xFE, 0x84, 0x9C, 0x96, 0xC4, 0x79, 0x63,
-    0x05, 0x6E, 0x4C, 0xA0, 0x3E, 0xF3, 0x2E, 0x06, 0xEA, 0x5B, 0x71, 0x11, 0x50, 0x52, 0x58, 0x05,
-    0x34, 0x68, 0x0B, 0x99, 0x87, 0x94, 0x53, 0xB4, 0xA0, 0x5B, 0x3A, 0xAA, 0x84, 0x93, 0x04, 0x3C,
-    0xAE, 0x2A, 0xBB, 0xF2, 0x29, 0x57, 0xCB, 0x8A, 0x0A, 0xAD, 0x63, 0x6D, 0xE4, 0x31, 0xAC, 0xF5,
-    0xB8, 0x13, 0xDC, 0x2E, 0xB5, 0x08, 0x3B, 0x39, 0xE1, 0x60, 0x9A, 0x67, 0x32, 0x6D, 0x45, 0x8F,
-    0x13, 0x26, 0x1B, 0x7C, 0x2E, 0x9B, 0xB3, 0x26, 0xDF, 0x83, 0x4A, 0x24, 0x6B, 0xF2, 0x81, 0x8E,
-    0x4A, 0x1B, 0x15, 0x96, 0x5C, 0xCA, 0xAD, 0x12, 0x98, 0x0C, 0xCA, 0x49, 0xE6, 0x6D, 0x90, 0xCD,
-    0xA3, 0xD5, 0x71, 0x3C, 0x99, 0xA4, 0xC5, 0x99, 0x2C, 0xE8, 0x09, 0x40, 0x3C, 0x74, 0x69, 0x32,
-    0x2E, 0x0C, 0x26, 0xAE, 0x0A, 0x73, 0x49, 0x13, 0xF9, 0x29, 0xB0, 0x65, 0xF1, 0x5B, 0x32, 0xFB,
-    0x06, 0x5B, 0x1E, 0x92, 0x91, 0x5D, 0xE5, 0x66, 0xCF, 0xA6, 0xDF, 0x20, 0xFE, 0x1D, 0x74, 0xC9,
-    0x3D, 0x1C, 0x7F, 0x95, 0x71, 0x9B, 0xA4, 0xA6, 0x8B, 0x10, 0xD1, 0xD8, 0x13, 0x53, 0xF3, 0x06,
-    0x2F, 0x51, 0x53, 0x90, 0x2B, 0x4E, 0xD2, 0x2B, 0xA1, 0x15, 0x58, 0x91, 0x31, 0xC8, 0x82, 0x0B,
-    0x37, 0xDB, 0xDB, 0x47, 0x6F, 0x90, 0x03, 0x1E, 0x12, 0x7F, 0x68, 0x3D, 0xC6, 0x30, 0x47, 0x5D,
-    0xDA, 0x78, 0x76, 0xBE, 0xBD, 0x07, 0xEE, 0xDD, 0x70, 0xFF, 0xA0, 0x6D, 0x68, 0xF9, 0xA6, 0xF2,
-    0xF4, 0x20, 0x9A, 0xC8, 0x3F, 0xF7, 0x4E, 0xBA, 0x1E, 0x44, 0x05, 0xC6, 0x4F, 0x0A, 0x3D, 0xD0,
-    0x9D, 0xBB, 0xEF, 0x12, 0x99, 0x1C, 0x7B, 0xEF, 0xDD, 0xC3, 0x49, 0x2C, 0x0F, 0x2F, 0x8D, 0xE2,
-    0x2B, 0x2C, 0x5B, 0x74, 0x99, 0x19, 0x8C, 0x8B, 0x97, 0xB9, 0xC0, 0x15, 0xF4, 0xEE, 0x5A, 0x36,
-    0x2E, 0xD2, 0xCD, 0x37, 0x3F, 0xBB, 0xF9, 0x3D, 0xF1, 0xD1, 0xE7, 0xE7, 0x9F, 0xED, 0x76, 0x5A,
-    0x93, 0x9B, 0xDF, 0xC3, 0xDD, 0x65, 0xF7, 0xBD, 0x67, 0x32, 0xF4, 0xB2, 0x7D, 0xCF, 0xB4, 0xEF,
-    0x6E, 0x1C, 0x1C, 0x9E, 0xD3, 0x4A, 0x5C, 0x63, 0xFF, 0xF4, 0xB6, 0x30, 0x0B, 0x70, 0xCD, 0x0A,
-    0xDA, 0x87, 0x27, 0xE4, 0x0E, 0x98, 0xE4, 0xF2, 0x45, 0xC6, 0x5F, 0x3A, 0x6A, 0x09, 0xB2, 0x26,
-    0x35, 0xC5, 0x83, 0x1A, 0x66, 0x3C, 0x4D, 0xC4, 0xD3, 0xED, 0x44, 0xA3, 0x6E, 0xEF, 0xC9, 0x79,
-    0xAD, 0x12, 0x40, 0x57, 0x91, 0x13, 0x42, 0x34, 0x10, 0x66, 0x67, 0x25, 0x3C, 0xF7, 0x50, 0xEA,
-    0x8B, 0x21, 0x25, 0x83, 0xD4, 0x04, 0x1F, 0xC4, 0x28, 0x81, 0x20, 0xFA, 0x0C, 0x75, 0x09, 0xC7,
-    0x8B, 0x19, 0xEB, 0xCA, 0x8E, 0x53, 0xF3, 0xC4, 0xB7, 0xB9, 0x34, 0x28, 0xF3, 0x82, 0x1A, 0x84,
-    0xF7, 0xA2, 0x36, 0x24, 0x80, 0xCF, 0x7F, 0xE1, 0x9A, 0x14, 0xDE, 0xF8, 0xCA, 0x11, 0xF0, 0x17,
-    0x14, 0x0D, 0xBE, 0x51, 0x12, 0x9D, 0x36, 0x86, 0x2B, 0xA3, 0x5E, 0xF0, 0x1F, 0x8A, 0x08, 0x1C,
-    0xAB, 0x4F, 0xF6, 0x24, 0xEA, 0x8E, 0x9E, 0x3B, 0x8A, 0xD8, 0x77, 0x50, 0x2E, 0xA3, 0x17, 0x4B,
-    0xA7, 0x60, 0xC3, 0xA4, 0x90, 0x54, 0x7C, 0x3B, 0x1F, 0x78, 0xB7, 0xE5, 0xA4, 0x78, 0x80, 0x3C,
-    0x93, 0xE1, 0x13, 0x3C, 0x13, 0x7E, 0x1D, 0xC7, 0x5D, 0x96, 0x94, 0x11, 0x91, 0x09, 0xEF, 0x09,
-    0x1E, 0x09, 0xE2, 0xDE, 0x43, 0x44, 0x69, 0x69, 0x10, 0xF3, 0xCC, 0xF3, 0xE6, 0xF6, 0xAC, 0xBC,
-    0xBB, 0x56, 0x2D, 0xCE, 0x9C, 0xED, 0x79, 0x44, 0xA4, 0x13, 0x57, 0x31, 0xC9, 0xB1, 0xFC, 0xFE,
-    0x73, 0xAE, 0x5B, 0xCF, 0xD1, 0xC7, 0xA5, 0x34, 0xCF, 0xE3, 0x3B, 0x4A, 0x0F, 0x14, 0x7B, 0x82,
-    0xE6, 0x88, 0x4E, 0xD0, 0x14, 0x18, 0xA1, 0x60, 0x67, 0x8A, 0x74, 0x2A, 0x29, 0xE9, 0x09, 0x10,
-    0x0D, 0x98, 0x19, 0x02, 0x95, 0xC2, 0x75, 0x07, 0x81, 0xD6, 0x8C, 0x65, 0xE8, 0x8D, 0x38, 0x1E,
-    0x79, 0xF5, 0xC2, 0x44, 0x2D, 0x6D, 0x4D, 0x40, 0xEF, 0x4B, 0x4B, 0x5F, 0x3A, 0x45, 0xA6, 0x8A,
-    0xB2, 0xA0, 0x05, 0x87, 0x1F, 0x0C, 0x9A, 0x01, 0xE3, 0xB4, 0x0C, 0xD4, 0xF4, 0xBC, 0x44, 0x11,
-    0xF3, 0x1C, 0xD2, 0xBB, 0x7B, 0x3C, 0x39, 0x79, 0x33, 0x29, 0xCD, 0xE1, 0x48, 0xA2, 0x2E, 0xA5,
-    0x1C, 0x66, 0xF5, 0x7C, 0xDC, 0xEB, 0xE0, 0xCA, 0x62, 0x47, 0xC9, 0x74, 0x00, 0x6F, 0x71, 0x20,
-    0xF8, 0x26, 0x17, 0xF3, 0x30, 0x2B, 0x90, 0x25, 0x26, 0xE2, 0x62, 0x00, 0xCC, 0x3D, 0x3F, 0x05,
-    0xE6, 0x2F, 0x84, 0xCE, 0x42, 0x13, 0xBC, 0xE0, 0x29, 0x62, 0xA9, 0x73, 0x44, 0x70, 0x95, 0x34,
-    0x1F, 0x3F, 0x53, 0x43, 0x27, 0xE4, 0x0D, 0xB5, 0x1F, 0xDD, 0x3E, 0x41, 0x78, 0x1F, 0x04, 0x9C,
-    0x22, 0x58, 0xDB, 0x3B, 0x1D, 0x15, 0xCA, 0xDA, 0x9D, 0xA5, 0x9A, 0x11, 0x1F, 0xD4, 0x74, 0x0D,
-    0x21, 0xF8, 0x03, 0xE5, 0x9A, 0xAC, 0xAA, 0x27, 0xD3, 0x06, 0x9B, 0x1F, 0x13, 0x6C, 0x47, 0x87,
-    0x5D, 0x16, 0x2B, 0x77, 0xAA, 0xC6, 0x79, 0xCD, 0x5F, 0xC7, 0x47, 0x99, 0x9C, 0xD8, 0x31, 0x9A,
-    0x75, 0x77, 0x01, 0xB3, 0x4C, 0xD2, 0xD0, 0x82, 0x01, 0x86, 0x41, 0x91, 0x3B, 0x52, 0xB0, 0x4D,
-    0xC7, 0xBC, 0x05, 0xF4, 0xEA, 0x08, 0x03, 0x70, 0x1B, 0xFB, 0x86, 0x4C, 0x1B, 0x73, 0xF2, 0x2E,
-    0x7A, 0x5F, 0x16, 0xB9, 0xD1, 0xE2, 0x01, 0xF3, 0x0D, 0x42, 0xC1, 0x08, 0xC0, 0x1B, 0xAC, 0x15,
-    0x0E, 0x10, 0x54, 0xFB, 0x18, 0xE3, 0xA4, 0x92, 0xC3, 0x92, 0x82, 0x7B, 0x81, 0xA7, 0x03, 0x58,
-    0x4C, 0x86, 0x03, 0x1C, 0x8A, 0xBA, 0xA4, 0x8D, 0x3B, 0x1E, 0xD5, 0x9A, 0xC4, 0xA1, 0xA1, 0xF0,
-    0x36, 0x70, 0x41, 0x10, 0x2A, 0xDC, 0x36, 0x04, 0x0D, 0x95, 0x25, 0x28, 0x04, 0xEF, 0x66, 0x49,
-    0x1C, 0xC4, 0x08, 0x53, 0xC7, 0xB0, 0x27, 0xBD, 0x2B, 0x39, 0x43, 0xD5, 0xEF, 0x2F, 0x0D, 0x5A,
-    0x54, 0xB2, 0xA6, 0xE2, 0xA7, 0xD3, 0x0C, 0x59, 0x34, 0xA4, 0xBA, 0x85, 0x82, 0xBE, 0x1A, 0x0F,
-    0x5E, 0x2C, 0x28, 0x12, 0x0A, 0x7F, 0x11, 0xC8, 0x60, 0x2B, 0x00, 0x57, 0xE9, 0xDD, 0x7C, 0x80,
-    0x15, 0xA5, 0xC4, 0x95, 0x70, 0xD2, 0x18, 0x30, 0xA2, 0x6E, 0x87, 0x89, 0x83, 0x18, 0x12, 0x06,
-    0x65, 0xE5, 0xCF, 0xE5, 0x4B, 0xE3, 0x06, 0x82, 0xDC, 0x3B, 0x5C, 0x1B, 0x0A, 0x14, 0x02, 0x38,
-    0xBB, 0x7E, 0x35, 0x91, 0x27, 0xF9, 0xA9, 0xB0, 0x4F, 0x6E, 0x97, 0x1D, 0x65, 0x8D, 0x54, 0x4A,
-    0x0F, 0x2F, 0x98, 0xA2, 0xA7, 0xDD, 0xEB, 0xD6, 0xF4, 0xC2, 0xE1, 0x42, 0x51, 0x0F, 0x8C, 0x3B,
-    0x11, 0x25, 0xBE, 0x46, 0xE3, 0x3D, 0x82, 0xA0, 0x21, 0x4E, 0xBB, 0x4A, 0x60, 0x1D, 0xC9, 0x7C,
-    0x31, 0x7C, 0x91, 0xFC, 0x3D, 0x48, 0xDB, 0xEB, 0x93, 0x45, 0x04, 0x93, 0x77, 0xA4, 0xC9, 0x7E,
-    0x39, 0xD1, 0xAF, 0x5C, 0x7B, 0x6D, 0x98, 0x9B, 0xBA, 0x8E, 0x26, 0x77, 0x53, 0x3B, 0x85, 0xBF,
-    0x29, 0x3F, 0xD8, 0x29, 0x40, 0x4A, 0xBF, 0xB1, 0x03, 0x45, 0x5E, 0x74, 0x0B, 0xAC, 0xD3, 0x35,
-    0x49, 0x03, 0x47, 0x26, 0xA7, 0xBF, 0x06, 0x38, 0x22, 0x9A, 0xDB, 0x09, 0xEE, 0x09, 0xD9, 0x15,
-    0xA9, 0x1B, 0x97, 0x19, 0x7D, 0x16, 0x39, 0x38, 0x8F, 0x02, 0x9E, 0x40, 0x19, 0xC4, 0x38, 0xDB,
-    0xE7, 0x14, 0x4A, 0xC3, 0x5A, 0xFE, 0x26, 0x83, 0x6B, 0xEA, 0x1C, 0xDE, 0x5C, 0xE7, 0x20, 0xEF,
-    0x31, 0x00, 0x02, 0xC8, 0x66, 0xD8, 0x0B, 0x6F, 0xC8, 0xAB, 0x8B, 0xE9, 0x5A, 0xB5, 0x74, 0x7D,
-    0xC2, 0x9E, 0x67, 0x4D, 0x34, 0x02, 0x04, 0xDF, 0x02, 0x48, 0xE2, 0xBB, 0x6C, 0xCA, 0x37, 0xF9,
-    0xD1, 0x9B, 0xE0, 0xA3, 0xBD, 0x0A, 0x1C, 0x5B, 0x68, 0x19, 0x27, 0x82, 0x67, 0x83, 0x7C, 0x81,
-    0x83, 0x3F, 0x49, 0x6D, 0x02, 0x11, 0xE6, 0x9E, 0x2C, 0x0E, 0xF8, 0x59, 0x5C, 0xDF, 0xC7, 0x25,
-    0x63, 0x78, 0xCB, 0xF2, 0x17, 0xA0, 0xAE, 0x06, 0x28, 0xA7, 0xFC, 0x0D, 0xC6, 0x88, 0x5D, 0x16,
-    0x98, 0x6F, 0xC5, 0xA8, 0x34, 0xF0, 0x5A, 0xFC, 0x91, 0xA3, 0x6B, 0x06, 0x5D, 0x03, 0x51, 0x23,
-    0xC4, 0x0A, 0x78, 0x79, 0xEA, 0x73, 0x49, 0x73, 0x2B, 0x75, 0x47, 0x5B, 0x1F, 0x84, 0x77, 0xCF,
-    0xF2, 0x5D, 0x44, 0x03, 0x8C, 0x21, 0x32, 0x82, 0x94, 0xD4, 0x32, 0xD6, 0x90, 0x3F, 0x9A, 0x91,
-    0xB8, 0x89, 0x14, 0x69, 0xAD, 0xCE, 0x0E, 0xCB, 0x09, 0xE4, 0x8F, 0xFA, 0x88, 0x56, 0x33, 0x6D,
-    0x66, 0x29, 0x5F, 0xD0, 0xFE, 0xC0, 0xBC, 0x80, 0x2F, 0xB0, 0x60, 0x06, 0xF4, 0x69, 0x19, 0xBA,
-    0x95, 0x83, 0x26, 0xAB, 0xE2, 0x9B, 0x55, 0x89, 0x4B, 0xE5, 0xAB, 0x3B, 0x70, 0x48, 0x87, 0xE4,
-    0xED, 0x26, 0xBA, 0xF5, 0xD1, 0x58, 0x66, 0xF9, 0x2B, 0xD7, 0xAE, 0x0F, 0x8B, 0x31, 0x2D, 0xA1,
-    0xC8, 0x5A, 0x18, 0xC6, 0x22, 0xBD, 0xE2, 0x5E, 0xC7, 0x07, 0xA3, 0x29, 0xEC, 0xD6, 0x7D, 0x0A,
-    0x21, 0x23, 0x6C, 0x71, 0xDA, 0x34, 0x54, 0x1F, 0xB0, 0x49, 0x03, 0xD5, 0xD9, 0x71, 0x79, 0x0B,
-    0x67, 0x4F, 0x1A, 0x83, 0x52, 0x04, 0xE1, 0x63, 0x3D, 0x0F, 0x6E, 0x0B, 0xA8, 0x22, 0xB9, 0x13,
-    0xC6, 0x67, 0xD7, 0x32, 0x7C, 0x4B, 0x17, 0xF8, 0xF0, 0x39, 0x59, 0xBD, 0x54, 0x18, 0xA5, 0x5F,
-    0xBB, 0x67, 0x06, 0xA8, 0xBD, 0x91, 0x71, 0x07, 0x7A, 0x4D, 0x04, 0x61, 0x04, 0x21, 0x14, 0x1A,
-    0x5A, 0x77, 0xDE, 0x2A, 0xE9, 0x72, 0xEA, 0x61, 0x3A, 0x31, 0xD9, 0x82, 0x4A, 0xF4, 0xD8, 0x1C,
-    0xC7, 0x4C, 0xBA, 0xE5, 0xE0, 0x46, 0x08, 0x2C, 0x68, 0xF1, 0x4B, 0x28, 0xB4, 0x85, 0x83, 0x87,
-    0x07, 0xE9, 0x23, 0xB5, 0x57, 0x3A, 0x60, 0x1E, 0xAE, 0x14, 0xC7, 0xF6, 0x70, 0x3B, 0xFA, 0xB4,
-    0x16, 0x39, 0x22, 0x58, 0x6B, 0x4B, 0x68, 0x9A, 0x74, 0x76, 0x58, 0x6E, 0x03, 0xD4, 0xD2, 0x4D,
-    0xDC, 0x71, 0x58, 0xB8, 0x0B, 0xD8, 0x70, 0x26, 0x92, 0xF0, 0xC9, 0x3E, 0x1C, 0xB9, 0xBB, 0xAE,
-    0x6C, 0x14, 0x9A, 0x72, 0x20, 0x68, 0xFC, 0x31, 0xDD, 0x75, 0x68, 0x1C, 0x25, 0x77, 0x8E, 0x06,
-    0xB4, 0x8B, 0x0D, 0x8C, 0xA0, 0xF3, 0x37, 0x32, 0x2C, 0x02, 0x7D, 0xB4, 0x76, 0xCF, 0x55, 0x94,
-    0xFF, 0x4E, 0xDE, 0x0A, 0x1D, 0xBD, 0x51, 0x1F, 0x5A, 0x99, 0x26, 0x5A, 0xBA, 0x27, 0x2F, 0x9A,
-    0x62, 0x6D, 0xB4, 0xDF, 0x39, 0x32, 0x1B, 0xE4, 0xBA, 0x79, 0x72, 0xCD, 0x5D, 0xE1, 0x79, 0xBA,
-    0x7B, 0xDC, 0xFB, 0x2F, 0xB1, 0xE6, 0x02, 0x80, 0xBC, 0x4D, 0x9A, 0xBC, 0x4E, 0xA8, 0x31, 0xC0,
-    0x5A, 0xA6, 0x31, 0x85, 0x29, 0xB1, 0x93, 0xD7, 0x9D, 0xE2, 0x7E, 0xE0, 0x3A, 0x50, 0x81, 0xDF,
-    0xA2, 0x37, 0x5F, 0x1E, 0x76, 0x5E, 0x66, 0xD2, 0x22, 0xEC, 0x2D, 0x5F, 0x20, 0x0C, 0xA9, 0x58,
-    0x10, 0xC9, 0x00, 0x30, 0xCF, 0x1D, 0x62, 0x47, 0x60, 0x87, 0x46, 0xFC, 0x1C, 0xA4, 0x6F, 0x60,
-    0x5B, 0x8E, 0x6B, 0x9E, 0x46, 0x1F, 0x26, 0x4D, 0x94, 0xF7, 0x93, 0xD2, 0xA8, 0x3D, 0x2C, 0x15,
-    0x91, 0x79, 0xEA, 0x34, 0x0C, 0x5F, 0xA3, 0x82, 0x57, 0xF8, 0x95, 0x3F, 0x84, 0x77, 0x77, 0x9D,
-    0x94, 0x6D, 0x18, 0x56, 0xE4, 0xB2, 0x14, 0x99, 0x41, 0x68, 0x7E, 0x9A, 0xCE, 0x40, 0xE2, 0x23,
-    0x96, 0xD0, 0x83, 0x77, 0x5D, 0xDE, 0xC2, 0x80, 0xBC, 0x8C, 0x6D, 0x80, 0x35, 0xCF, 0x43, 0x29,
-    0x25, 0xD7, 0xA7, 0xD5, 0x10, 0xF6, 0xEE, 0x49, 0x58, 0x68, 0x88, 0x59, 0xE1, 0x4E, 0xE1, 0x95,
-    0xF2, 0xB2, 0x83, 0x28, 0xD7, 0xF9, 0x07, 0x63, 0x49, 0x72, 0x59, 0x0C, 0xB8, 0xA1, 0xA6, 0x2B,
-    0x76, 0xEF, 0xB3, 0x98, 0x02, 0x7F, 0x54, 0x16, 0xA5, 0x88, 0xDA, 0x39, 0x87, 0x80, 0xA5, 0x83,
-    0xC5, 0xC0, 0x56, 0x04, 0xED, 0xCC, 0xCD, 0x30, 0x94, 0x78, 0x87, 0x5E, 0x1A, 0x77, 0xA8, 0xB0,
-    0xB9, 0xB6, 0xA2, 0x8D, 0x6B, 0x63, 0x7C, 0xED, 0x43, 0xDA, 0xEB, 0x98, 0x59, 0x01, 0xFA, 0x17,
-    0x19, 0xAC, 0x78, 0xCF, 0xA8, 0xCE, 0x6F, 0xAF, 0x76, 0x6E, 0x43, 0x17, 0x4F, 0xA9, 0x3B, 0x35,
-    0x46, 0x23, 0xE8, 0x47, 0xEF, 0x5C, 0xB9, 0x5F, 0xBA, 0x72, 0x61, 0xCB, 0xCF, 0xE0, 0xF0, 0xAE,
-    0x42, 0x06, 0x99, 0x81, 0x81, 0xB4, 0x5D, 0xC7, 0x89, 0x9E, 0xEA, 0xA2, 0x21, 0xBD, 0xED, 0x5A,
-    0x48, 0xE4, 0xEB, 0xF8, 0xF0, 0xC2, 0xBD, 0xD2, 0x89, 0xB3, 0x88, 0x1D, 0xC3, 0x39, 0xEF, 0x85,
-    0xB5, 0xD0, 0x11, 0x87, 0xE7, 0x41, 0x19, 0xA5, 0xB5, 0xB7, 0xDB, 0xAF, 0x25, 0x2A, 0xB6, 0xCC,
-    0xA0, 0x3C, 0x87, 0x97, 0x33, 0xBD, 0x4C, 0x7C, 0x50, 0xC5, 0x7A, 0x99, 0x70, 0x2F, 0xA4, 0x0A,
-    0x73, 0x2F, 0x4D, 0x4B, 0xF0, 0x5D, 0x5D, 0xFE, 0x2F, 0xF0, 0x5F, 0x1B, 0xBB, 0x3B, 0x6E, 0xC2,
-    0x4B, 0x9D, 0x1B, 0x7E, 0x06, 0xCC, 0x81, 0x35, 0x64, 0x50, 0x93, 0x8F, 0x49, 0xDB, 0x7E, 0xB6,
-    0xB7, 0x1A, 0x79, 0x2B, 0xE7, 0xDE, 0xE2, 0xAD, 0x60, 0xFF, 0x71, 0x2B, 0x92, 0x26, 0x78, 0xCC,
-    0x0E, 0x71, 0x76, 0x3B, 0xE5, 0xF2, 0xE2, 0x52, 0x32, 0xB2, 0xD4, 0xFE, 0xE0, 0xEB, 0xE7, 0x37,
-    0x09, 0xE7, 0x5F, 0x08, 0x79, 0x65, 0x0C, 0x81, 0x33, 0x5F, 0xA5, 0xB4, 0x06, 0x95, 0x42, 0x2C,
-    0x4D, 0xC5, 0x3B, 0x5A, 0xDC, 0x24, 0x53, 0x42, 0x83, 0x89, 0x91, 0x85, 0x72, 0x85, 0x24, 0x60,
-    0xD2, 0x18, 0x09, 0x79, 0xDA, 0xCA, 0x02, 0x81, 0xF7, 0x6E, 0x9F, 0x26, 0xFE, 0x05, 0x90, 0x9E,
-    0x08, 0x5A, 0xA1, 0x1B, 0x27, 0xD8, 0x6C, 0x5C, 0x31, 0xFD, 0xB9, 0x94, 0xDE, 0x33, 0x03, 0x25,
-    0x0E, 0xD6, 0xA2, 0x25, 0x20, 0x48, 0xEF, 0x51, 0xEC, 0x4A, 0xD7, 0x33, 0x58, 0x04, 0xEE, 0x28,
-    0x4C, 0x9D, 0x6D, 0xC2, 0x08, 0xE3, 0x4E, 0x18, 0x61, 0x7C, 0x96, 0x50, 0x99, 0x80, 0xA1, 0xC5,
-    0x35, 0x19, 0xF4, 0x17, 0xCB, 0x58, 0xC6, 0x2D, 0x12, 0xE2, 0x09, 0x65, 0x3B, 0xA6, 0x59, 0x29,
-    0x2E, 0x60, 0x62, 0x4B, 0xE6, 0x20, 0x86, 0xE5, 0x53, 0xCC, 0xA8, 0x02, 0xB9, 0x0C, 0xCB, 0x4B,
-    0x6E, 0x29, 0x1F, 0xB5, 0x39, 0x71, 0xB6, 0xE3, 0x85, 0x57, 0xEE, 0x4B, 0x6B, 0xF7, 0xB4, 0x83,
-    0x11, 0xA7, 0x85, 0xB6, 0x73, 0x32, 0xD3, 0x38, 0x30, 0x82, 0x00, 0x30, 0xA5, 0xD8, 0x0D, 0x91,
-    0x08, 0x58, 0x8F, 0x00, 0x97, 0x58, 0x2D, 0xBF, 0xCC, 0x83, 0x64, 0xD0, 0x7F, 0xD2, 0xA2, 0x08,
-    0xC4, 0x98, 0xDB, 0xB8, 0x84, 0xF7, 0xDA, 0x79, 0x31, 0x64, 0xCE, 0x53, 0x74, 0xE7, 0x1C, 0xD3,
-    0x94, 0xAE, 0x93, 0x7F, 0x01, 0x01, 0xB0, 0x54, 0x8F, 0xEE, 0xB3, 0x90, 0x52, 0xB3, 0x50, 0x5A,
-    0x15, 0x8E, 0x42, 0xBB, 0x44, 0x85, 0xCA, 0x21, 0x4B, 0x0B, 0xB7, 0x3C, 0x1C, 0xD0, 0x83, 0x86,
-    0xF1, 0x3A, 0x9C, 0xE3, 0x41, 0x3E, 0x31, 0x14, 0x52, 0x2D, 0xF5, 0x4B, 0x27, 0x1F, 0x6B, 0x66,
-    0x4C, 0x41, 0x5E, 0x0A, 0x4F, 0x55, 0x1E, 0xF0, 0x36, 0x99, 0xF4, 0x59, 0x40, 0xA9, 0xF0, 0x45,
-    0x28, 0xBA, 0xB7, 0x40, 0x0C, 0x7C, 0x47, 0x57, 0xDA, 0x8D, 0xA2, 0xFA, 0xAC, 0x60, 0x9A, 0x8F,
-    0x28, 0x85, 0x76, 0xBC, 0x95, 0x62, 0x82, 0x8A, 0x28, 0x2D, 0x00, 0xFE, 0x53, 0xD0, 0x78, 0xB6,
-    0x6B, 0x57, 0xDC, 0x1A, 0x0A, 0x88, 0x8A, 0x3F, 0x1A, 0x36, 0xDA, 0x63, 0xB6, 0x69, 0xB4, 0x91,
-    0x3B, 0xDA, 0x83, 0xEA, 0x96, 0x4A, 0x94, 0x77, 0xCE, 0x6B, 0x28, 0x5C, 0x7A, 0x17, 0x99, 0xD2,
-    0xFA, 0x49, 0x67, 0xAE, 0x6C, 0xC0, 0x10, 0x31, 0xDF, 0x43, 0xBD, 0x3A, 0x6E, 0x6B, 0x04, 0x72,
-    0x79, 0x51, 0xB5, 0xE2, 0xCA, 0x8D, 0xCF, 0x0A, 0xC3, 0x85, 0x10, 0x10, 0x77, 0xF4, 0x65, 0x46,
-    0x55, 0x06, 0xF0, 0x32, 0x72, 0x14, 0xDB, 0xB5, 0x8E, 0x09, 0xEB, 0xB6, 0xD0, 0xD3, 0xBC, 0xAF,
-    0x87, 0xDA, 0xB8, 0x33, 0xF0, 0x36, 0x21, 0xCD, 0xE0, 0xB6, 0xF7, 0x4F, 0x7B, 0x1B, 0xB7, 0x72,
-    0x4F, 0x36, 0xB1, 0x4A, 0x12, 0x9A, 0xE5, 0xD6, 0xC6, 0x85, 0x8C, 0x0C, 0x93, 0x55, 0x81, 0x2F,
-    0x42, 0x8A, 0x84, 0x02, 0xDA, 0xD4, 0xA7, 0xAD, 0x82, 0x60, 0xB1, 0xFF, 0xF0, 0xF4, 0xC5, 0x2C,
-    0xAF, 0x29, 0x6B, 0x64, 0x2F, 0xE7, 0x45, 0x28, 0x98, 0x23, 0x1F, 0x69, 0xE6, 0x13, 0x99, 0x73,
-    0xD9, 0x81, 0x8F, 0x63, 0x28, 0x22, 0xCB, 0x24, 0x83, 0xA5, 0xBA, 0x2C, 0xDA, 0x20, 0x97, 0x7F,
-    0x7D, 0xB5, 0x4E, 0xF3, 0x62, 0x1C, 0x57, 0xEF, 0xB6, 0xB3, 0x3D, 0x5A, 0x2A, 0x82, 0xAB, 0x08,
-    0x11, 0x61, 0x58, 0x63, 0xC1, 0x5C, 0x85, 0x91, 0x2C, 0x1A, 0xA4, 0x48, 0x69, 0x38, 0xD7, 0x72,
-    0x50, 0x39, 0x33, 0xBB, 0x47, 0x03, 0xB0, 0x89, 0xBF, 0xC5, 0xED, 0x7D, 0x06, 0x9E, 0x1C, 0x5B,
-    0x2A, 0x29, 0xC5, 0xC3, 0xC6, 0xCB, 0xDC, 0x63, 0xE2, 0x5F, 0xAE, 0xE7, 0x97, 0xC3, 0xCD, 0xCB,
-    0x97, 0x48, 0xE1, 0x5A, 0x4E, 0xCA, 0x5D, 0x91, 0x47, 0xF1, 0x30, 0xE5, 0xC7, 0x02, 0x55, 0x0F,
-    0xC0, 0x78, 0x3D, 0x2F, 0xC7, 0xB9, 0x56, 0x80, 0x13, 0xD0, 0xE5, 0x59, 0xAE, 0xA3, 0x64, 0xB1,
-    0x42, 0x2F, 0xE7, 0x15, 0xD2, 0xF2, 0x21, 0xC3, 0x28, 0x14, 0xD0, 0xC5, 0xA4, 0xD4, 0x3D, 0x6C,
-    0x3A, 0x8C, 0xCE, 0x0B, 0x0C, 0x28, 0xB8, 0x53, 0x78, 0x6D, 0x72, 0x2D, 0xDE, 0x88, 0xCF, 0x44,
-    0xBD, 0x3C, 0xA6, 0xC7, 0x8D, 0x2D, 0x16, 0x12, 0xB4, 0xA5, 0x1E, 0x19, 0xAB, 0xA3, 0x62, 0x5A,
-    0x4A, 0x11, 0x52, 0x51, 0x01, 0xE7, 0x59, 0xAE, 0xCE, 0xD2, 0x81, 0x86, 0xFE, 0x98, 0x53, 0x6B,
-    0x21, 0xA4, 0x50, 0x53, 0x0C, 0x17, 0x12, 0xBD, 0x11, 0xC7, 0x01, 0xA6, 0x0E, 0x29, 0x23, 0x59,
-    0x9D, 0xAA, 0x01, 0x00, 0x83, 0xE1, 0xA4, 0x65, 0x3B, 0xA1, 0xCA, 0x87, 0x4A, 0x43, 0x20, 0x69,
-    0x58, 0x4C, 0x0F, 0x91, 0x86, 0xE1, 0xD3, 0x4A, 0x83, 0x8A, 0xA6, 0x12, 0x1F, 0xD1, 0x30, 0x3D,
-    0x51, 0x6C, 0x73, 0xDD, 0x8C, 0x55, 0x28, 0xF3, 0x45, 0x4C, 0x8B, 0x4B, 0x81, 0x75, 0xAE, 0xF0,
-    0xB8, 0xB9, 0x3E, 0x45, 0x73, 0x26, 0xCB, 0x0C, 0xC5, 0xF7, 0xA8, 0x90, 0x68, 0xD2, 0x1B, 0x42,
-    0x01, 0x15, 0x11, 0xA4, 0x8D, 0x92, 0xA6, 0xB0, 0xEE, 0x9D, 0x45, 0x38, 0x15, 0xB1, 0xE1, 0x5D,
-    0xE4, 0x45, 0x6D, 0x12, 0x49, 0x9F, 0x89, 0x3B, 0xB3, 0x38, 0x8D, 0x3B, 0xC4, 0x15, 0x38, 0x2B,
-    0x3D, 0x37, 0xF8, 0x6C, 0x15, 0x43, 0xBF, 0x9B, 0x64, 0x55, 0x4E, 0xA6, 0x64, 0x2C, 0x4E, 0x31,
-    0x23, 0x52, 0x9D, 0x79, 0xFA, 0x26, 0x28, 0x5F, 0xC4, 0xCA, 0x27, 0x65, 0x16, 0x98, 0x3B, 0xF8,
-    0x98, 0x7C, 0x76, 0x8D, 0xE9, 0xA3, 0x92, 0x27, 0x3B, 0x98, 0xA3, 0x0D, 0x5B, 0x47, 0xC2, 0x74,
-    0x1E, 0xAB, 0x59, 0x24, 0xA6, 0xB1, 0x50, 0x3A, 0x7D, 0xB6, 0x20, 0x55, 0x21, 0x44, 0x4F, 0x0B,
-    0x95, 0x7D, 0x16, 0x5B, 0x7A, 0x92, 0x87, 0x62, 0xD6, 0x98, 0x76, 0x9B, 0x3A, 0x7C, 0x29, 0xB5,
-    0xB4, 0x1C, 0x55, 0x7F, 0xC1, 0x58, 0xE3, 0x15, 0x8A, 0xED, 0x6A, 0x8A, 0x59, 0x40, 0xC4, 0xCB,
-    0x31, 0xF4, 0xFA, 0x3A, 0x73, 0x50, 0x02, 0xA2, 0xE0, 0x11, 0x58, 0x97, 0x35, 0x5D, 0x29, 0xF0,
-    0x73, 0x4F, 0xF6, 0x84, 0xEB, 0x43, 0x5C, 0x11, 0x31, 0x67, 0x06, 0xB0, 0x3B, 0x31, 0x94, 0x71,
-    0xC5, 0x61, 0x61, 0x81, 0x3B, 0x7B, 0xB3, 0xA5, 0xF4, 0xBA, 0x14, 0xFE, 0x59, 0x04, 0xE4, 0x00,
-    0xDD, 0x98, 0x80, 0x95, 0x18, 0x52, 0x19, 0x05, 0x5D, 0x5D, 0x4B, 0xF0, 0xBA, 0x82, 0x2B, 0xDB,
-    0x0B, 0xAB, 0x3A, 0x25, 0x80, 0xE1, 0xB5, 0x8F, 0xF4, 0x60, 0x56, 0x7A, 0x64, 0x1C, 0x9C, 0xC1,
-    0x18, 0x3E, 0x12, 0xA5, 0xC0, 0x4C, 0xB6, 0x4C, 0x2C, 0xB1, 0xD0, 0xCC, 0xD1, 0x42, 0x5E, 0x86,
-    0x18, 0x65, 0xC9, 0x5B, 0x0E, 0xF0, 0x38, 0xF9, 0xF0, 0xDE, 0x2D, 0x66, 0xB3, 0xDE, 0x50, 0xB0,
-    0xEB, 0x65, 0x69, 0x2F, 0xC6, 0xEF, 0x43, 0xB0, 0x71, 0xA1, 0x60, 0x93, 0x0F, 0xCC, 0x93, 0xF1,
-    0x59, 0xC6, 0xC4, 0x58, 0x89, 0x7D, 0x37, 0x0B, 0x9F, 0x58, 0x58, 0xBA, 0x43, 0x46, 0xCB, 0xA8,
-    0x10, 0xA9, 0x3B, 0x61, 0x2A, 0xD7, 0x13, 0xA8, 0xEE, 0x18, 0xC1, 0x23, 0x34, 0x87, 0xB7, 0x36,
-    0xC6, 0x87, 0xE5, 0x40, 0x5C, 0xAC, 0x78, 0xC8, 0x26, 0xCE, 0x16, 0x0C, 0x54, 0xD3, 0x8B, 0x81,
-    0x00, 0x15, 0xA2, 0x23, 0x60, 0xFA, 0x4B, 0x3D, 0x2E, 0xAC, 0xF2, 0x4B, 0x42, 0xBC, 0x70, 0x7F,
-    0x9D, 0xF1, 0x7A, 0x8E, 0xA2, 0x4A, 0x5D, 0x0A, 0xF7, 0xEB, 0x85, 0x81, 0x67, 0xC9, 0xD3, 0xD4,
-    0x63, 0x43, 0x5E, 0x4F, 0xEB, 0x95, 0x23, 0x9E, 0x81, 0xC9, 0x63, 0x4A, 0x3C, 0x77, 0xD9, 0xD1,
-    0x1C, 0x03, 0xD3, 0x51, 0x2C, 0xF0, 0xA9, 0x94, 0x16, 0xCF, 0x2B, 0x55, 0x16, 0xE0, 0xE8, 0xA7,
-    0x4B, 0x0C, 0x92, 0x97, 0x0D, 0x54, 0x09, 0x60, 0x39, 0xD1, 0x35, 0x43, 0x4E, 0x14, 0x6A, 0xF9,
-    0x48, 0x4B, 0x77, 0x30, 0xED, 0xBF, 0x1A, 0xAC, 0xAC, 0xDE, 0x48, 0xFF, 0xB4, 0xF3, 0x3F, 0x38,
-    0xC5, 0x56, 0xD5, 0x5C, 0xFA, 0x87, 0xCE, 0xA6, 0xFD, 0xD3, 0x7B, 0x99, 0x65, 0xDC, 0xB0, 0x5D,
-    0xBB, 0x1F, 0xBC, 0x46, 0x45, 0xAE, 0x28, 0x73, 0x6D, 0xA9, 0x77, 0xC2, 0xBD, 0xF7, 0x82, 0x23,
-    0x35, 0x3F, 0x0A, 0x01, 0x66, 0x7C, 0x3B, 0x9D, 0xD2, 0xDC, 0xD1, 0x65, 0x77, 0x3F, 0xA8, 0x18,
-    0x33, 0xA2, 0xCE, 0x11, 0xB1, 0xE5, 0x7B, 0x6F, 0xC2, 0xD5, 0x50, 0xF5, 0xFF, 0x65, 0x3A, 0xC3,
-    0x45, 0x74, 0x81, 0x65, 0xDA, 0xE8, 0xE2, 0x36, 0xDF, 0x65, 0x00, 0x07, 0xC4, 0xA2, 0xDF, 0x5A,
-    0x31, 0x7D, 0x23, 0x72, 0x3F, 0x6E, 0xE0, 0x6D, 0xCE, 0xCF, 0x48, 0x9C, 0x22, 0xC2, 0x1D, 0xB8,
-    0xD7, 0xB3, 0xAC, 0x9D, 0xA2, 0x9E, 0x0F, 0xB1, 0xBB, 0xE9, 0xAC, 0xC2, 0xC7, 0x8A, 0x13, 0x77,
-    0x56, 0x9E, 0x91, 0xBE, 0x7D, 0x0B, 0x88, 0xED, 0x1A, 0x73, 0xDA, 0xF1, 0x75, 0xA8, 0xB4, 0xE4,
-    0x2D, 0x20, 0x8A, 0xF4, 0x32, 0x54, 0x71, 0x7A, 0x19, 0x82, 0x85, 0x87, 0xB4, 0xC9, 0x5F, 0x9C,
-    0xA0, 0xD2, 0x9F, 0xA4, 0x15, 0xA7, 0x0B, 0x20, 0x61, 0x64, 0x55, 0xC4, 0x4D, 0x56, 0x8F, 0x81,
-    0x96, 0xE5, 0xA9, 0x06, 0x22, 0xE2, 0x13, 0x59, 0xB9, 0x59, 0x65, 0xE8, 0xCC, 0x32, 0x2F, 0xD2,
-    0x6B, 0xB7, 0x80, 0x98, 0x26, 0xB8, 0x78, 0xF1, 0x5B, 0x43, 0xFA, 0xE6, 0x98, 0x5C, 0x1D, 0x92,
-    0xCB, 0xA3, 0xB2, 0xB7, 0xCA, 0xF0, 0x0A, 0xCD, 0x28, 0xF9, 0x0A, 0xED, 0x95, 0xA8, 0xEC, 0x6C,
-    0x35, 0x0D, 0x8A, 0xF0, 0x9F, 0x55, 0x42, 0xF3, 0x23, 0x95, 0x4A, 0x8D, 0x31, 0x20, 0xD8, 0x7E,
-    0xF9, 0x8B, 0xC9, 0xC2, 0xF9, 0x8D, 0x05, 0xF7, 0xED, 0x17, 0xC6, 0x4F, 0xEF, 0x8E, 0x25, 0x1D,
-    0xFE, 0xE4, 0x0D, 0xB0, 0x52, 0x72, 0x7D, 0x80, 0xBB, 0x88, 0x3D, 0x5C, 0x05, 0x5E, 0x75, 0x2F,
-    0xF7, 0x58, 0x3C, 0x7C, 0xCB, 0x93, 0x03, 0x3C, 0x34, 0x48, 0xCD, 0x95, 0x11, 0x48, 0x19, 0x86,
-    0xE1, 0x5A, 0x4F, 0x11, 0x82, 0x42, 0x5E, 0xC1, 0x1B, 0xE9, 0x98, 0x0A, 0x4E, 0x6A, 0xFA, 0xBA,
-    0x58, 0xFB, 0xBD, 0x96, 0xBE, 0x36, 0x34, 0x45, 0xB3, 0x1A, 0x72, 0x85, 0xA3, 0xC6, 0xE5, 0xD6,
-    0xBE, 0x34, 0xE9, 0x2F, 0xE0, 0x73, 0xBF, 0x0E, 0xE9, 0x1E, 0x5D, 0xD8, 0x25, 0x1F, 0xFC, 0x7A,
-    0x48, 0x5E, 0xC7, 0x8D, 0x3B, 0x88, 0x04, 0xF6, 0xD8, 0xE7, 0x57, 0xFA, 0xFC, 0x87, 0x6F, 0x8D,
-    0x71, 0x23, 0x6A, 0xB8, 0x49, 0x61, 0xAD, 0x49, 0x3F, 0x8F, 0x81, 0x25, 0x40, 0x69, 0x02, 0x0D,
-    0xC2, 0xD3, 0x6B, 0x3B, 0x27, 0x9B, 0xF0, 0x86, 0x38, 0x8B, 0xC7, 0xB6, 0x50, 0x0E, 0x55, 0xF1,
-    0x79, 0xA5, 0x32, 0x18, 0x1F, 0x1B, 0x58, 0x1A, 0x71, 0x7E, 0x00, 0x62, 0x82, 0xDA, 0xCB, 0x0B,
-    0x2A, 0x3E, 0xA6, 0x59, 0xA8, 0x95, 0x08, 0xC4, 0x53, 0x31, 0x13, 0x15, 0x02, 0xCC, 0x08, 0xEC,
-    0x02, 0x15, 0x02, 0x69, 0x33, 0xD8, 0x03, 0x65, 0x3B, 0x88, 0x1A, 0x5A, 0xFF, 0x16, 0x5A, 0x77,
-    0xF5, 0x6B, 0x55, 0xD9, 0xB1, 0x08, 0x83, 0x87, 0x98, 0xFB, 0x12, 0x1C, 0x28, 0xC0, 0x32, 0xCD,
-    0x56, 0xBD, 0x4B, 0x8B, 0xB0, 0x9D, 0xD2, 0x22, 0x7A, 0x67, 0x4C, 0xAA, 0xE4, 0xF2, 0x90, 0x54,
-    0xD0, 0xF8, 0x09, 0x73, 0xF2, 0xA5, 0xD2, 0x2A, 0x84, 0x3C, 0x12, 0x33, 0x19, 0x5E, 0x45, 0xA6,
-    0xC9, 0xB0, 0x05, 0x43, 0xEF, 0x38, 0xB7, 0x85, 0x55, 0xB3, 0x49, 0x63, 0x2A, 0x1D, 0xFD, 0x0A,
-    0x21, 0xC8, 0xFE, 0x25, 0x39, 0xA6, 0x96, 0xAD, 0x5B, 0xF9, 0x8C, 0x4C, 0x6A, 0xF9, 0x0F, 0xBA,
-    0x35, 0xEE, 0x2C, 0x33, 0x5D, 0x8E, 0x3C, 0x04, 0xED, 0xFD, 0x8E, 0x63, 0x90, 0x09, 0x27, 0xD6,
-    0xD2, 0xA0, 0xC0, 0x77, 0x63, 0x11, 0x27, 0x4B, 0x63, 0xA0, 0xDD, 0xDE, 0x75, 0x8C, 0x13, 0x53,
-    0x21, 0x82, 0x23, 0x0B, 0xE8, 0xD3, 0x50, 0x5E, 0xD1, 0x44, 0xE9, 0xC9, 0x72, 0x16, 0x76, 0x54,
-    0x49, 0xCD, 0xBC, 0x2E, 0x63, 0x49, 0x09, 0x13, 0x52, 0xE0, 0x1D, 0x1C, 0x73, 0xF2, 0xC3, 0x46,
-    0x47, 0xD9, 0x88, 0xA8, 0xA3, 0xD5, 0x17, 0x56, 0xAB, 0xF1, 0xEC, 0x3D, 0x87, 0x35, 0xAF, 0x6F,
-    0x0F, 0xF0, 0x2D, 0x4E, 0x0E, 0x25, 0xB6, 0xFC, 0xFA, 0x98, 0x82, 0x8D, 0x5A, 0x17, 0xBD, 0x33,
-    0xAC, 0xFA, 0xFC, 0xE9, 0x2E, 0x5F, 0x8C, 0x10, 0x87, 0xB8, 0xF6, 0x0E, 0xC4, 0x77, 0x69, 0x28,
-    0x52, 0xC2, 0x42, 0x45, 0x4F, 0xA3, 0xC9, 0xB0, 0x6B, 0x10, 0xFA, 0x6B, 0x43, 0xB6, 0xEE, 0xE6,
-    0x43, 0xF0, 0xE8, 0x4E, 0x25, 0xA0, 0x7E, 0x82, 0x95, 0x5E, 0xEC, 0xB3, 0xDC, 0xD2, 0xA9, 0xE8,
-    0xB5, 0x57, 0xC0, 0x33, 0xF3, 0xA2, 0x6B, 0x0E, 0x23, 0x05, 0xDD, 0x1E, 0x28, 0xC4, 0x7B, 0x8C,
-    0x24, 0xCF, 0x89, 0xEC, 0x98, 0x80, 0x24, 0xBD, 0x9B, 0xCD, 0xEF, 0xAC, 0x2D, 0xBB, 0xAE, 0xAA,
-    0x09, 0x65, 0x3E, 0xE7, 0xEA, 0x86, 0x45, 0x70, 0xBC, 0x08, 0xBE, 0xCF, 0x7C, 0xEF, 0xED, 0xA9,
-    0x50, 0xE2, 0xF2, 0x09, 0xDC, 0x6B, 0xED, 0xA3, 0x7C, 0xD9, 0xB2, 0x8E, 0xE7, 0x1C, 0x5E, 0x4C,
-    0x6D, 0x37, 0xD2, 0x02, 0xF9, 0x7A, 0xB8, 0x45, 0xB9, 0x9B, 0xA2, 0x06, 0xD2, 0x7D, 0xD4, 0xD7,
-    0x54, 0x83, 0x6D, 0xDF, 0x0B, 0xD2, 0xBF, 0xF3, 0x85, 0xDF, 0xC4, 0xED, 0x2B, 0xAF, 0x3E, 0x32,
-    0xC6, 0xC8, 0x7D, 0xC2, 0xA3, 0x65, 0xB0, 0x8E, 0x69, 0xA6, 0xE4, 0x1D, 0x2A, 0x78, 0xF7, 0x4C,
-    0xC7, 0xA0, 0x15, 0x7E, 0x6D, 0x98, 0xC6, 0xC5, 0xE1, 0xBC, 0x8C, 0x5F, 0x97, 0x70, 0x43, 0x19,
-    0x91, 0x2B, 0x33, 0xE8, 0x86, 0xCB, 0xE3, 0x12, 0xE8, 0x07, 0x4A, 0xB6, 0x8B, 0xBB, 0x04, 0xEA,
-    0x46, 0xA1, 0x78, 0x47, 0xDF, 0xD4, 0xD9, 0xDE, 0x99, 0x60, 0x76, 0x7F, 0xB5, 0x09, 0xC7, 0x58,
-    0xC4, 0x4C, 0x71, 0x12, 0x4B, 0x71, 0x46, 0xED, 0x6E, 0x9A, 0xB9, 0xD9, 0x16, 0x3B, 0x56, 0x9B,
-    0x00, 0x0A, 0x57, 0xAB, 0x80, 0x85, 0xC4, 0x9E, 0x0A, 0x1D, 0x6C, 0xF4, 0xA2, 0x63, 0x00, 0x8A,
-    0x9E, 0x34, 0x7E, 0x58, 0x49, 0x82, 0xE0, 0x5C, 0xAE, 0xA8, 0xF8, 0xC8, 0x56, 0x57, 0x46, 0x56,
-    0x77, 0x52, 0x35, 0xBB, 0xA7, 0x19, 0xDA, 0x01, 0x2B, 0xBB, 0xF5, 0x08, 0x28, 0xF0, 0xB7, 0x74,
-    0x57, 0x7D, 0x86, 0xAD, 0xF3, 0xD5, 0x0E, 0x16, 0x39, 0x52, 0xC5, 0xB5, 0x39, 0xFF, 0xB6, 0x28,
-    0xB7, 0x59, 0xF0, 0xA6, 0xEC, 0xD1, 0x02, 0x70, 0x72, 0xA8, 0x2D, 0xE7, 0xE2, 0xE0, 0xB3, 0xAD,
-    0x58, 0x13, 0xB3, 0x1E, 0x2D, 0x0B, 0x4D, 0x24, 0xC3, 0xEA, 0x8B, 0xDB, 0x67, 0x9E, 0x67, 0x09,
-    0x80, 0xEA, 0x00, 0xDC, 0xA0, 0x07, 0x41, 0x7B, 0x95, 0x60, 0xA8, 0x48, 0x99, 0x0A, 0xB4, 0x61,
-    0xA1, 0x67, 0x15, 0x8F, 0x2F, 0x28, 0x92, 0x30, 0xD9, 0xA1, 0xEC, 0x54, 0x5F, 0x04, 0x96, 0x8F,
-    0x8F, 0x59, 0xC5, 0x0A, 0xEB, 0x3A, 0xC6, 0x5D, 0x59, 0x41, 0x09, 0x06, 0xE5, 0xDB, 0x87, 0xFB,
-    0x0E, 0xB2, 0x70, 0x88, 0xEB, 0x7E, 0x38, 0xED, 0xBB, 0x3D, 0x00, 0x49, 0x88, 0xD2, 0x3B, 0x80,
-    0x09, 0xCC, 0xC6, 0xD1, 0x4D, 0x5A, 0xD2, 0x88, 0x3D, 0x26, 0xEA, 0xAD, 0xEF, 0x52, 0x9E, 0x6F,
-    0x51, 0x55, 0xC3, 0x96, 0xE4, 0xF7, 0x52, 0xE6, 0xCF, 0x05, 0xF4, 0x94, 0xDC, 0xDD, 0x02, 0xBD,
-    0x27, 0x01, 0xF4, 0x40, 0x38, 0x86, 0xE8, 0xB0, 0xC2, 0x77, 0x19, 0x70, 0x87, 0xEC, 0x07, 0x13,
-    0xEB, 0x9F, 0xEF, 0xA9, 0xD4, 0xB3, 0xF6, 0xB5, 0x99, 0x56, 0x7C, 0xC9, 0x3A, 0xF5, 0xB9, 0xBC,
-    0x3F, 0x87, 0x6F, 0xCA, 0x42, 0x27, 0x1A, 0x6F, 0x70, 0xCC, 0x21, 0xAB, 0x87, 0x52, 0xCA, 0x77,
-    0x05, 0x28, 0x03, 0xB7, 0x9F, 0x95, 0x4D, 0xF1, 0xAF, 0xB0, 0x97, 0xB7, 0x5B, 0x5D, 0x87, 0xAE,
-    0x18, 0x79, 0x3B, 0x72, 0x76, 0x91, 0x63, 0x7F, 0x0C, 0x73, 0x0B, 0x85, 0x8F, 0x87, 0x67, 0xE8,
-    0x36, 0x46, 0xB8, 0xD5, 0x4F, 0x23, 0x10, 0xE2, 0xB4, 0x77, 0x0B, 0xE3, 0x06, 0x40, 0x0F, 0xE4,
-    0x4B, 0x07, 0xBA, 0x8B, 0x84, 0x46, 0xD3, 0x35, 0x52, 0xCF, 0x92, 0xB9, 0x4C, 0x40, 0x33, 0xE4,
-    0x1A, 0xD2, 0xC2, 0x27, 0xF4, 0x64, 0xF2, 0xA7, 0x26, 0xC2, 0x56, 0x58, 0xCB, 0x1E, 0xEB, 0x8F,
-    0xAE, 0x53, 0xE6, 0x0F, 0xC0, 0x60, 0x93, 0x50, 0x4C, 0xE7, 0x2B, 0x22, 0xD2, 0xD1, 0x17, 0x44,
-    0x2C, 0x29, 0x50, 0x27, 0xFE, 0xF9, 0x69, 0x29, 0x72, 0x58, 0xBA, 0x60, 0xDD, 0x40, 0x02, 0xDB,
-    0x6F, 0x6D, 0x16, 0xF0, 0xFF, 0xBA, 0xC1, 0x9D, 0xAF, 0x3D, 0x97, 0xCD, 0xAD, 0x0F, 0xC3, 0xFC,
-    0x83, 0xB3, 0xBC, 0xB1, 0x3B, 0x2C, 0x4D, 0x1A, 0x59, 0xDA, 0x69, 0xF7, 0x6D, 0x58, 0xB3, 0x49,
-    0xAE, 0x69, 0xA1, 0x81, 0xB8, 0x5B, 0xD5, 0xF7, 0x10, 0x6A, 0x51, 0x2B, 0xB9, 0xA7, 0x46, 0xA5,
-    0x1D, 0xA9, 0xDD, 0x33, 0x86, 0x3F, 0x70, 0xAE, 0xB1, 0x82, 0x28, 0xCC, 0x39, 0xF6, 0x69, 0xC3,
-    0x77, 0xE3, 0xB8, 0x59, 0x39, 0x4E, 0x6C, 0x9E, 0x5E, 0x63, 0x11, 0x02, 0x6B, 0x39, 0x6F, 0x0D,
-    0x2A, 0xA6, 0x68, 0x96, 0x13, 0x74, 0xE9, 0x48, 0x47, 0xBD, 0xA4, 0x8B, 0xF2, 0x3E, 0x16, 0x10,
-    0x3B, 0x55, 0x2B, 0xF6, 0x02, 0x0A, 0xC6, 0x94, 0x86, 0xF1, 0x7D, 0x60, 0x40, 0xCE, 0xF2, 0x46,
-    0x74, 0xA3, 0x7E, 0x0E, 0x6C, 0xF8, 0xDD, 0x2C, 0x0E, 0x66, 0x81, 0x29, 0xE7, 0x1F, 0x92, 0xF9,
-    0x87, 0xA3, 0x31, 0x5B, 0xA2, 0x87, 0x35, 0x5D, 0x64, 0xB1, 0xB8, 0xC2, 0x46, 0x3C, 0x51, 0xE0,
-    0xB4, 0x71, 0xAF, 0x63, 0x52, 0x14, 0x68, 0x77, 0x62, 0xDA, 0x42, 0x25, 0xEC, 0xE5, 0x53, 0x4E,
-    0x6F, 0x4A, 0x6A, 0xE6, 0x2F, 0xC2, 0x1E, 0x27, 0x0B, 0xDD, 0x84, 0x97, 0xA6, 0x54, 0x0D, 0x04,
-    0x59, 0xFA, 0xC3, 0x46, 0x89, 0xE4, 0xE8, 0x26, 0x7D, 0x6C, 0xF8, 0x63, 0x4A, 0x59, 0x71, 0x67,
-    0x83, 0xF5, 0x62, 0x70, 0x19, 0xA9, 0xF6, 0xC5, 0x13, 0x7F, 0xCF, 0x9C, 0x95, 0xC5, 0x36, 0x6D,
-    0xBF, 0xA9, 0x31, 0x4B, 0x6D, 0x73, 0x8F, 0xFA, 0xD3, 0x58, 0xF9, 0xC4, 0x6B, 0x30, 0xEB, 0xCA,
-    0xD4, 0xF2, 0xFB, 0x0B, 0x4A, 0x2A, 0xCD, 0x09, 0x74, 0x74, 0x23, 0x7D, 0x4E, 0x7D, 0xEA, 0x83,
-    0xCC, 0x00, 0x48, 0x3F, 0x29, 0xEB, 0x04, 0xF0, 0x7D, 0x80, 0xB1, 0x59, 0x3A, 0xAA, 0xB3, 0xFC,
-    0xB2, 0x0B, 0xAC, 0x3E, 0x5C, 0x35, 0x59, 0x34, 0x8A, 0xA0, 0xD2, 0x95, 0x41, 0xE9, 0xB1, 0xCC,
-    0x2A, 0xB3, 0x42, 0xBE, 0x7D, 0x0D, 0x2B, 0xFC, 0x9F, 0x9E, 0x31, 0x80, 0xC4, 0xF6, 0x11, 0xBB,
-    0x70, 0xE6, 0x8B, 0x74, 0x44, 0xFB, 0xC5, 0xC5, 0x0D, 0x19, 0xBF, 0x45, 0x2B, 0x24, 0x23, 0xC1,
-    0x14, 0x07, 0xB1, 0xBE, 0x7B, 0xC9, 0xFD, 0x4B, 0x58, 0xDF, 0x42, 0x4E, 0x9B, 0x03, 0x50, 0x15,
-    0x5F, 0x7F, 0xCC, 0x0A, 0xB5, 0xB2, 0x80, 0x22, 0x6C, 0x9F, 0x52, 0x7A, 0x9D, 0x79, 0x97, 0x4A,
-    0xF9, 0x60, 0x5A, 0x40, 0xED, 0xE4, 0xF7, 0x8E, 0x9C, 0x8F, 0xED, 0x3B, 0x35, 0x48, 0xFC, 0x1D,
-    0xD3, 0xC8, 0x7F, 0xDC, 0x1A, 0x64, 0xF5, 0x34, 0xF9, 0x86, 0xFD, 0x63, 0x14, 0x5B, 0xEE, 0x54,
-    0x0E, 0x2D, 0x59, 0xEB, 0xCA, 0x40, 0x69, 0xC7, 0xFC, 0x67, 0xC9, 0x18, 0x6F, 0xB7, 0x74, 0x1F,
-    0x36, 0x51, 0xC9, 0xFE, 0x11, 0x18, 0xDC, 0x51, 0x1C, 0xB3, 0x52, 0x2E, 0x31, 0xE0, 0xA2, 0xF4,
-    0x4F, 0x62, 0xFF, 0x88, 0xC4, 0x0C, 0xC5, 0xCB, 0x28, 0x28, 0xA1, 0xB5, 0x1E, 0x15, 0x4C, 0xA1,
-    0x43, 0xB1, 0xB4, 0x9A, 0x17, 0xC6, 0x53, 0x3A, 0x66, 0x9E, 0x71, 0x62, 0x09, 0x35, 0x19, 0x2B,
-    0x8A, 0x4A, 0x77, 0xA0, 0x70, 0x99, 0xAF, 0xCC, 0xCA, 0x79, 0x78, 0x65, 0x1F, 0xC2, 0xC3, 0xE0,
-    0x59, 0x2B, 0x54, 0xB9, 0x78, 0x55, 0x5C, 0x29, 0xF3, 0xDD, 0xE5, 0x2C, 0x2D, 0xFD, 0x17, 0x4F,
-    0xF0, 0x2C, 0xBF, 0xAF, 0x85, 0x7F, 0x47, 0x6F, 0x11, 0x2B, 0xFC, 0xB3, 0x23, 0xEC, 0xCA, 0x2D,
-    0xE5, 0x1D, 0x68, 0x75, 0x92, 0x79, 0xA7, 0x01, 0x46, 0x37, 0xBD, 0x7D, 0xF1, 0x4B, 0xE5, 0xBB,
-    0x14, 0xD5, 0xF2, 0x1A, 0x2D, 0xB0, 0xCB, 0x55, 0xCC, 0xE1, 0x82, 0x13, 0x59, 0x7C, 0x4F, 0x91,
-    0xE9, 0x83, 0x86, 0xAE, 0x16, 0x15, 0x45, 0xF4, 0x6B, 0xF2, 0xAF, 0xBB, 0x3A, 0xC5, 0xEE, 0xEC,
-    0x28, 0xF8, 0x02, 0x8A, 0xDC, 0x62, 0xA0, 0x78, 0x62, 0x78, 0x73, 0x5E, 0xDB, 0xB1, 0x33, 0x67,
-    0x32, 0xAB, 0xC6, 0xB5, 0xF6, 0x10, 0xD5, 0xE4, 0x9E, 0x3C, 0x47, 0x0E, 0x7D, 0x64, 0x9B, 0x3D,
-    0xC7, 0xA5, 0x89, 0x77, 0x15, 0x90, 0x92, 0x87, 0x05, 0x12, 0xBC, 0xA3, 0x9A, 0x43, 0xA7, 0x12,
-    0x23, 0xC6, 0x53, 0x55, 0x91, 0x9D, 0x13, 0xD6, 0xB1, 0xA2, 0x33, 0x6F, 0x14, 0x9B, 0x86, 0x0E,
-    0x80, 0x3D, 0x8F, 0x69, 0xE1, 0x61, 0x15, 0x7B, 0x26, 0x11, 0xD7, 0xC0, 0xC4, 0xCC, 0x96, 0x39,
-    0x70, 0x67, 0x74, 0x7B, 0x62, 0x4D, 0x3E, 0x9C, 0x0A, 0xC6, 0x30, 0x9C, 0x3B, 0x75, 0x87, 0xA8,
-    0x17, 0xAF, 0x31, 0xEB, 0x01, 0x04, 0x49, 0xC5, 0x29, 0xEC, 0x99, 0x82, 0x02, 0xEA, 0xF9, 0x88,
-    0xC4, 0x14, 0x8B, 0x7D, 0xB8, 0x62, 0x26, 0x65, 0xC1, 0xF2, 0xDE, 0x3D, 0x96, 0x17, 0xBD, 0x5E,
-    0x37, 0x47, 0xCB, 0xC8, 0x3E, 0x6F, 0x77, 0xD8, 0x1F, 0xD1, 0x5D, 0x23, 0x5E, 0xA4, 0xDA, 0xF5,
-    0x09, 0x0B, 0x74, 0x00, 0x73, 0x79, 0x63, 0x9D, 0x4A, 0x56, 0x8D, 0x2C, 0xA0, 0x34, 0xCD, 0xB9,
-    0x22, 0xF2, 0x98, 0xAA, 0x43, 0xD4, 0x73, 0x61, 0x4F, 0xCD, 0x20, 0x0E, 0x4E, 0xDA, 0x7F, 0x35,
-    0xB7, 0x88, 0x66, 0x55, 0xC1, 0x2D, 0x0F, 0x0B, 0x78, 0x8D, 0xE5, 0xF6, 0x1A, 0x95, 0x2F, 0x02,
-    0x9A, 0xB5, 0xE0, 0x52, 0x7D, 0x68, 0x00, 0x44, 0x7D, 0x34, 0xBD, 0xF0, 0xA4, 0x45, 0xD2, 0x09,
-    0x6E, 0x7C, 0x88, 0x0F, 0x46, 0x49, 0xD9, 0x6B, 0x56, 0x13, 0x3C, 0xC7, 0x04, 0xF3, 0x42, 0xE5,
-    0x97, 0xF5, 0x6E, 0x18, 0x10, 0xF7, 0xE3, 0xB5, 0xDD, 0x0C, 0x9C, 0x3C, 0x57, 0xAE, 0xEA, 0xE0,
-    0x1B, 0x21, 0x24, 0xF6, 0xAC, 0x81, 0x57, 0xE5, 0x2D, 0x70, 0x3C, 0xCB, 0x8F, 0x87, 0xC7, 0x56,
-    0xF5, 0x37, 0xBE, 0x19, 0x02, 0x67, 0xBE, 0x6D, 0x55, 0x2E, 0x56, 0x65, 0x08, 0xA0, 0xF3, 0x11,
-    0x14, 0x60, 0xFD, 0x7B, 0x41, 0xC8, 0xD8, 0xCC, 0x91, 0x23, 0x81, 0xC2, 0x4D, 0xDD, 0x94, 0x9F,
-    0x79, 0xF6, 0x9F, 0x7A, 0x33, 0xDB, 0x3D, 0x01, 0xA8, 0x82, 0x67, 0x9A, 0xEF, 0x3F, 0x0E, 0xCF,
-    0x34, 0xFC, 0x60, 0xEA, 0xBE, 0x1B, 0xD6, 0x5F, 0x0D, 0x00, 0xC2, 0xDB, 0x7C, 0xF5, 0x56, 0xF7,
-    0x55, 0x8A, 0xCE, 0xCA, 0xBD, 0x07, 0x62, 0x7C, 0x34, 0xEE, 0x0D, 0xDF, 0x0B, 0xFE, 0x9D, 0xF6,
-    0xFA, 0xDE, 0x5C, 0xF0, 0xEC, 0x4F, 0xFC, 0x0F, 0xFC, 0x5D, 0x16, 0xD9, 0x3F, 0x3E, 0x22, 0x3E,
-    0x7D, 0x60, 0x18, 0xD4, 0xB5, 0x96, 0x68, 0xFE, 0xFD, 0x55, 0x66, 0x6F, 0xCE, 0x1E, 0xA3, 0x70,
-    0x3E, 0x16, 0xFC, 0xDF, 0xBF, 0xFE, 0x8D, 0x15, 0x8F, 0x5C, 0x48, 0x7B, 0xD3, 0xCC, 0x2F, 0x3F,
-    0x27, 0x41, 0xFD, 0x0F, 0xFF, 0xF6, 0x4F, 0xBE, 0xA0, 0x17, 0x82, 0x0B, 0xC1, 0xA7, 0xFF, 0x92,
-    0xDE, 0xCF, 0x0B, 0x59, 0x69, 0xC6, 0xB0, 0x16, 0xD5, 0x1F, 0x62, 0x95, 0xC5, 0xBF, 0xDF, 0x60,
-    0x71, 0x7E, 0xCD, 0x2A, 0xAD, 0xF4, 0xC6, 0xE1, 0x2B, 0x07, 0x7E, 0x37, 0xC5, 0x1F, 0xDE, 0x7F,
-    0xBD, 0x6F, 0xCC, 0x69, 0x90, 0xB9, 0x42, 0x7C, 0xCE, 0xDC, 0x46, 0x7A, 0xFC, 0x42, 0xB0, 0x68,
-    0xBD, 0xB2, 0x4C, 0xA5, 0x69, 0x79, 0x20, 0x01, 0x3D, 0x93, 0x6F, 0xCE, 0x65, 0xAB, 0xAD, 0xA7,
-    0xD2, 0x17, 0xF1, 0xFD, 0x8F, 0x76, 0xEF, 0xFE, 0x49, 0x5F, 0x5F, 0xF5, 0x7A, 0x77, 0x65, 0xA9,
-    0xF1, 0xF4, 0x82, 0x31, 0xE0, 0xCA, 0x55, 0xC7, 0xCD, 0xA8, 0xFD, 0xD9, 0xA7, 0x25, 0x06, 0xA9,
-    0xBF, 0x24, 0x07, 0xCF, 0x27, 0x35, 0x3B, 0x1A, 0x6B, 0xD6, 0xAD, 0x66, 0xC1, 0x4F, 0x82, 0xAF,
-    0x4B, 0xC1, 0x03, 0x96, 0xCD, 0xBB, 0x38, 0x6E, 0x4C, 0xB3, 0xC3, 0x9C, 0x76, 0xFC, 0xF7, 0x5D,
-    0xF9, 0xC7, 0xC1, 0xD7, 0x0A, 0x76, 0x52, 0xB9, 0x39, 0x14, 0x93, 0x28, 0x81, 0x9A, 0x48, 0xB7,
-    0x1D, 0xDB, 0x04, 0x5A, 0x60, 0xD6, 0x62, 0x85, 0x60, 0x54, 0x68, 0x1F, 0x11, 0x9C, 0x32, 0x1B,
-    0x00, 0xD0, 0xC3, 0x32, 0x1B, 0xC6, 0x10, 0xE1, 0x7F, 0x00, 0xC0, 0xC5, 0x4D, 0x7C, 0xA7, 0x67,
-    0x4A, 0x99, 0xEE, 0x61, 0xD4, 0x95, 0xF8, 0x60, 0x79, 0x0E, 0x1F, 0x7C, 0x19, 0x58, 0x1F, 0xBE,
-    0x5E, 0x95, 0x17, 0xE1, 0x1D, 0x78, 0x26, 0x41, 0x7A, 0xB3, 0xA5, 0x1F, 0xEA, 0xFC, 0x15, 0xD8,
-    0x54, 0x56, 0xAC, 0x5D, 0x5F, 0xD2, 0xA3, 0x7E, 0x8B, 0xA1, 0x0A, 0x07, 0xE0, 0xB3, 0x32, 0x9B,
-    0x2E, 0x8F, 0xC3, 0x90, 0xBE, 0x09, 0x9B, 0xC8, 0x69, 0xB4, 0x4C, 0x37, 0x7A, 0x6C, 0x0C, 0x92,
-    0x22, 0x56, 0x83, 0xC1, 0x93, 0x8A, 0xF7, 0xD4, 0x06, 0x8A, 0x8E, 0x65, 0x33, 0x3B, 0x01, 0xB4,
-    0xA8, 0xFD, 0xAE, 0xA0, 0xB2, 0x5B, 0x29, 0x77, 0xAE, 0x64, 0xA4, 0x2F, 0x5B, 0x56, 0x5E, 0x9C,
-    0x49, 0x4A, 0x3E, 0xC7, 0xEE, 0x98, 0x0A, 0x5A, 0x79, 0x4C, 0x2C, 0x2A, 0x72, 0x0E, 0x80, 0x1E,
-    0xC8, 0x27, 0x51, 0x51, 0xDB, 0xA6, 0x1B, 0xB4, 0x30, 0x73, 0xAF, 0xA5, 0x7D, 0xAD, 0x98, 0xEB,
-    0x34, 0x83, 0xE3, 0xE5, 0x0D, 0x3A, 0x96, 0x0C, 0x9C, 0x67, 0x56, 0x5A, 0xE4, 0x33, 0x80, 0xEE,
-    0xC7, 0x2A, 0xA1, 0x5E, 0x29, 0x35, 0xC9, 0x16, 0x22, 0x9A, 0xD9, 0xD5, 0x4E, 0x39, 0x43, 0xA8,
-    0x1A, 0x28, 0x1F, 0x2F, 0x2C, 0x52, 0x0F, 0x6D, 0xB6, 0x8A, 0x26, 0x55, 0x9B, 0x5D, 0xCB, 0x6E,
-    0xCF, 0x39, 0xDF, 0xB0, 0xAB, 0x87, 0x16, 0xEE, 0xAF, 0x2F, 0x24, 0x5C, 0x2C, 0x9C, 0x9B, 0xF7,
-    0xF2, 0x3B, 0x03, 0x4D, 0x5E, 0x7C, 0x07, 0x77, 0x48, 0x95, 0x30, 0x6E, 0xD7, 0xCC, 0x94, 0xAA,
-    0x0A, 0xFA, 0xD5, 0x4D, 0x38, 0xA9, 0xB2, 0x6A, 0xC5, 0x82, 0xD1, 0xFC, 0xA5, 0x39, 0x1F, 0x71,
-    0xFB, 0xAF, 0x60, 0x47, 0x92, 0xB2, 0x01, 0xF0, 0x11, 0x60, 0xA1, 0x63, 0xD6, 0x58, 0xA3, 0xEC,
-    0x8D, 0x3D, 0xC6, 0x6F, 0xBB, 0xD9, 0xC9, 0xBD, 0xBF, 0x51, 0x76, 0x53, 0xCB, 0xBD, 0x6A, 0xA1,
-    0x3E, 0xF3, 0x54, 0x27, 0x81, 0x23, 0x79, 0x9F, 0x29, 0x45, 0x99, 0x02, 0xAC, 0x88, 0xB1, 0x75,
-    0x2B, 0x9A, 0xC4, 0xEE, 0x87, 0x47, 0x5C, 0x91, 0x5F, 0x7D, 0x1B, 0x5B, 0x67, 0xF5, 0xCA, 0x1D,
-    0x95, 0x1D, 0xF7, 0x73, 0xE5, 0x45, 0xBB, 0x9C, 0x16, 0x49, 0x01, 0x92, 0x36, 0xBF, 0xA1, 0xF2,
-    0x22, 0xF0, 0x79, 0xC2, 0x64, 0x3E, 0x17, 0x7A, 0x51, 0xDB, 0xEE, 0xDE, 0xF6, 0x93, 0xBA, 0x7B,
-    0x77, 0xAB, 0x6B, 0xEF, 0xEB, 0xEE, 0xF5, 0x97, 0x7F, 0x48, 0x77, 0xEF, 0xD6, 0x5D, 0x50, 0x41,
-    0xE7, 0x36, 0x69, 0xEF, 0x94, 0x36, 0x6C, 0xAD, 0xC6, 0x6C, 0xFF, 0xC2, 0x9C, 0xE5, 0x5D, 0xDF,
-    0x57, 0x2C, 0xAE, 0x24, 0xDE, 0x9C, 0xC8, 0xDB, 0xA9, 0x3B, 0xDF, 0x6D, 0xBC, 0x6A, 0x1F, 0xDE,
-    0x78, 0xE5, 0xCC, 0xBD, 0x5D, 0x29, 0x8A, 0xCC, 0x10, 0xC1, 0xF4, 0xA3, 0x07, 0xCB, 0x38, 0xC3,
-    0xFB, 0x5B, 0xB4, 0x78, 0xE5, 0x51, 0x2D, 0x8E, 0x4C, 0x1B, 0xB9, 0x1B, 0xAF, 0x5A, 0x8B, 0xA8,
-    0x95, 0x72, 0xCF, 0xD5, 0x73, 0xFC, 0x7E, 0xA0, 0xB4, 0xDD, 0xA7, 0x09, 0x3F, 0x6D, 0x4B, 0xD8,
-    0x7E, 0xA6, 0x2E, 0x64, 0x5F, 0xA8, 0xE7, 0x98, 0x79, 0xA9, 0xD9, 0xFD, 0xC0, 0xD3, 0x60, 0x62,
-    0xED, 0xEA, 0xE0, 0x41, 0x2E, 0x73, 0x91, 0x54, 0x24, 0xB3, 0xC0, 0x90, 0x1A, 0xFD, 0xE2, 0xFD,
-    0xD2, 0x56, 0x98, 0x70, 0x29, 0x8A, 0x98, 0x64, 0xF2, 0xBE, 0x58, 0x07, 0x5A, 0x31, 0x19, 0x89,
-    0xA5, 0xAB, 0xD5, 0xB7, 0xF5, 0xAD, 0xBE, 0x72, 0xCC, 0x59, 0xE8, 0xBA, 0x70, 0x67, 0x27, 0x02,
-    0xF3, 0xA4, 0x61, 0x06, 0x3E, 0xBF, 0x32, 0x30, 0x99, 0xA3, 0x54, 0x9D, 0xF5, 0x0A, 0x47, 0xC3,
-    0xF2, 0x06, 0xD9, 0x8A, 0x92, 0x0C, 0xAC, 0x7B, 0x77, 0x2E, 0x9C, 0x27, 0x0F, 0x12, 0xB3, 0xAA,
-    0xE7, 0x8C, 0x09, 0x2D, 0x62, 0x90, 0xB2, 0xC8, 0xD9, 0x95, 0xC3, 0x68, 0x46, 0xAC, 0xEA, 0x72,
-    0x56, 0xD9, 0xC8, 0x19, 0x10, 0x53, 0x7C, 0xE4, 0x14, 0x09, 0x29, 0x0F, 0x3E, 0x1C, 0xAC, 0x89,
-    0xDC, 0xAA, 0x58, 0xD4, 0x46, 0x1A, 0xC4, 0xF7, 0x54, 0xD4, 0xBF, 0x9A, 0xF2, 0x6B, 0x4A, 0xE4,
-    0xBD, 0xD1, 0x4B, 0x93, 0xB6, 0xEE, 0x69, 0x32, 0xC2, 0x68, 0xFD, 0x67, 0x70, 0x04, 0x95, 0x35,
-    0x84, 0x94, 0xC5, 0x87, 0x05, 0xF3, 0x5C, 0x2A, 0xE2, 0xCA, 0xD2, 0x1A, 0x0E, 0x57, 0x2E, 0xAC,
-    0xD8, 0x6F, 0x7A, 0xA6, 0x77, 0xE2, 0x30, 0x33, 0x8A, 0xF2, 0xE5, 0xCB, 0x33, 0x23, 0xEE, 0x74,
-    0x4F, 0xCC, 0x11, 0x7B, 0xD6, 0x07, 0xB2, 0xBC, 0xA2, 0x0E, 0x41, 0x3B, 0xD6, 0x89, 0x81, 0x42,
-    0xC3, 0xE2, 0x2C, 0xA3, 0x33, 0xB7, 0x03, 0xE6, 0x8C, 0xD4, 0xAB, 0x05, 0x72, 0x29, 0x44, 0xFA,
-    0xCB, 0x69, 0xAF, 0xB5, 0x4C, 0xDF, 0x64, 0xC8, 0x56, 0x31, 0xEE, 0x43, 0xF7, 0xA1, 0xB6, 0x1D,
-    0x76, 0x96, 0xEB, 0x76, 0x27, 0x27, 0xAB, 0x0F, 0x4C, 0xBA, 0xD3, 0xA9, 0x7B, 0x91, 0x2D, 0x52,
-    0x2B, 0xD7, 0xC4, 0x4D, 0xE8, 0xEA, 0x94, 0xF5, 0x81, 0xF1, 0x10, 0xEC, 0xB4, 0x04, 0xF8, 0xCE,
-    0x5C, 0x59, 0xA6, 0x6D, 0x7B, 0x42, 0x30, 0x97, 0xB1, 0x3D, 0x7A, 0xF1, 0xF3, 0x6E, 0x3A, 0xEB,
-    0x7D, 0xC9, 0x00, 0x67, 0x28, 0xD0, 0x5C, 0x7E, 0x4D, 0xA1, 0x21, 0x2F, 0xEF, 0x5B, 0x5F, 0xFF,
-    0xEF, 0x57, 0xC5, 0xC8, 0x46, 0xDF, 0xC4, 0x6E, 0x12, 0x57, 0xC1, 0x9F, 0xF6, 0xAA, 0x10, 0x2A,
-    0x2F, 0xCC, 0x5E, 0x2A, 0xF3, 0xC7, 0xEC, 0xAE, 0x54, 0x02, 0x91, 0xE5, 0x45, 0x59, 0x00, 0x82,
-    0x15, 0x64, 0xA5, 0x82, 0x81, 0xFC, 0xCA, 0x52, 0x90, 0xCB, 0x49, 0x71, 0x6A, 0xF3, 0x4D, 0x39,
-    0x35, 0xE1, 0x9E, 0x4E, 0x85, 0xFD, 0xF9, 0x72, 0xB3, 0xDC, 0xD3, 0xCA, 0x1A, 0xAB, 0x4E, 0x39,
-    0x61, 0xD2, 0x64, 0x35, 0xFD, 0x98, 0xBC, 0xC2, 0x40, 0x02, 0x56, 0x47, 0xA9, 0xDA, 0x54, 0x32,
-    0x99, 0x6D, 0xB4, 0x5E, 0xF5, 0x6A, 0xB6, 0x92, 0x9B, 0xE4, 0xB5, 0x53, 0xBF, 0x67, 0xCC, 0x02,
-    0x16, 0x5F, 0xCD, 0x38, 0xA6, 0x74, 0x3A, 0xE9, 0xC9, 0x72, 0xE5, 0x8A, 0x88, 0x10, 0xD2, 0xFA,
-    0xEA, 0x2F, 0x26, 0xA1, 0xC0, 0x66, 0xE5, 0x8D, 0x93, 0x00, 0xF0, 0x1D, 0xB0, 0x3F, 0xBD, 0x16,
-    0x4B, 0x4D, 0x5B, 0xB0, 0x27, 0x58, 0x8C, 0x7E, 0x9A, 0x82, 0xD4, 0xE6, 0xD7, 0x0A, 0x25, 0xD2,
-    0x33, 0x06, 0x92, 0xE1, 0xD4, 0xFE, 0x11, 0x23, 0x5C, 0x5F, 0x61, 0x8A, 0xF7, 0x3C, 0x63, 0x71,
-    0x34, 0xE6, 0x7E, 0xD7, 0xD8, 0x30, 0x24, 0x9F, 0xBB, 0xD6, 0xF4, 0x81, 0x87, 0xEE, 0xFA, 0x3C,
-    0x77, 0xFD, 0x96, 0x76, 0xED, 0x58, 0xCE, 0xF2, 0x1F, 0x59, 0x5D, 0xF9, 0x25, 0xF5, 0x6C, 0x45,
-    0xD6, 0xD2, 0xA1, 0xFC, 0x59, 0x59, 0x25, 0xEF, 0xC4, 0x30, 0x99, 0xFF, 0x1D, 0xFA, 0xEB, 0x6D,
-    0xDE, 0x15, 0x74, 0xCC, 0xAF, 0x0D, 0x41, 0x78, 0x4F, 0x01, 0xF7, 0x4A, 0x3B, 0x5A, 0xF0, 0x66,
-    0xC9, 0x1D, 0x36, 0xC8, 0xC1, 0x33, 0x4C, 0x7F, 0x45, 0x8C, 0x72, 0x0B, 0x42, 0xFF, 0x3F, 0x93,
-    0x56, 0x31, 0x89, 0xB9, 0xF5, 0x83, 0xC6, 0x1E, 0xFE, 0x55, 0x96, 0xB8, 0x77, 0xA8, 0xE9, 0x7A,
-    0x6E, 0x60, 0xD4, 0xB2, 0x4B, 0x1D, 0x16, 0x97, 0xAD, 0xC3, 0x2A, 0x3F, 0xF1, 0xB0, 0xCE, 0x6D,
-    0x0F, 0x0B, 0x4E, 0x8C, 0x0A, 0x9B, 0xAC, 0xDB, 0x8E, 0x35, 0xC2, 0xBC, 0xCF, 0xEC, 0x03, 0x6D,
-    0xEC, 0x18, 0x75, 0x9D, 0xA2, 0x95, 0x8A, 0x34, 0x99, 0x65, 0x62, 0x69, 0xE2, 0x82, 0xF8, 0x64,
-    0xCE, 0x57, 0xBF, 0x85, 0xB5, 0x93, 0x59, 0xF2, 0x9B, 0xB8, 0xA8, 0x35, 0xF3, 0x61, 0x59, 0xB7,
-    0x26, 0x9F, 0xAF, 0x6E, 0x59, 0xB8, 0x67, 0x8D, 0xFB, 0xCD, 0x4A, 0x3D, 0x02, 0x54, 0x65, 0x72,
-    0x58, 0x4E, 0x51, 0x4F, 0x5F, 0x65, 0x09, 0x06, 0x0C, 0x7F, 0xC6, 0x83, 0xA8, 0x4A, 0xF6, 0x0C,
-    0xE6, 0x0C, 0x62, 0xA8, 0xC8, 0x82, 0x7A, 0xD7, 0x51, 0xF6, 0xF3, 0x9B, 0xD4, 0xF4, 0x4E, 0x7D,
-    0xDE, 0x92, 0x11, 0xDA, 0x23, 0x56, 0x9F, 0x5B, 0x48, 0x84, 0x85, 0x6E, 0x4C, 0xD6, 0xC1, 0x4D,
-    0x19, 0xC5, 0xCC, 0x59, 0xBA, 0x69, 0x84, 0x5B, 0xA8, 0x5E, 0xA6, 0x89, 0x60, 0xBB, 0x6B, 0xAC,
-    0xC6, 0xE1, 0x1E, 0x67, 0xCA, 0xD7, 0xC9, 0x54, 0x57, 0xC1, 0x92, 0xE5, 0x2B, 0x74, 0x27, 0xF2,
-    0xD6, 0x96, 0xBD, 0x70, 0x22, 0x17, 0xC7, 0x2E, 0x4C, 0xF2, 0xB7, 0x18, 0x8E, 0xB5, 0xB6, 0x38,
-    0xF6, 0xF4, 0xF4, 0x3A, 0x0A, 0xA9, 0xC6, 0x1A, 0xF8, 0x11, 0x5A, 0x4F, 0x15, 0x1C, 0xF2, 0x94,
-    0xE7, 0x9E, 0x49, 0x63, 0x83, 0x6D, 0x53, 0x9F, 0xDB, 0x3F, 0xD0, 0x7C, 0x05, 0xC3, 0x68, 0xB4,
-    0x07, 0x6E, 0xDB, 0xEE, 0xA7, 0x06, 0xBD, 0xE9, 0xBE, 0x46, 0xC0, 0xC3, 0xFF, 0x3C, 0xB1, 0x5E,
-    0x8C, 0xAD, 0xEF, 0x13, 0x6D, 0xD0, 0xFD, 0x32, 0xF3, 0xB0, 0x0E, 0x1F, 0x9B, 0xF1, 0xA0, 0x06,
-    0x14, 0x9B, 0x05, 0xC0, 0x13, 0xB2, 0x4C, 0x3C, 0x13, 0xF2, 0xB9, 0x19, 0x6C, 0xD5, 0x35, 0xE0,
-    0x76, 0xEF, 0x9F, 0xED, 0x16, 0xD6, 0x61, 0xAB, 0x4A, 0x94, 0x70, 0xBA, 0x48, 0x23, 0x75, 0x05,
-    0x9F, 0x9A, 0x58, 0x30, 0x35, 0xFB, 0xB4, 0xBA, 0xBE, 0xC4, 0x27, 0x6E, 0x7C, 0x70, 0x7B, 0xF9,
-    0x23, 0xDB, 0x3B, 0xAF, 0x4B, 0x53, 0xC5, 0xF5, 0xD2, 0xE2, 0x06, 0x6B, 0x01, 0x34, 0xD3, 0x4F,
-    0x32, 0x68, 0xAD, 0x47, 0x7F, 0xAA, 0x40, 0x21, 0x0D, 0x8C, 0x08, 0x46, 0x05, 0x65, 0x5F, 0x36,
-    0x2F, 0x4F, 0xBE, 0xDE, 0x64, 0xB5, 0xF9, 0x74, 0xBC, 0xFB, 0xE9, 0xCD, 0xCB, 0x56, 0xC1, 0x22,
-    0x72, 0x10, 0xCD, 0x6B, 0x9B, 0x8E, 0xFD, 0x2D, 0x4E, 0x88, 0xF9, 0xF6, 0x69, 0x35, 0x9D, 0x04,
-    0xDA, 0xB1, 0xB6, 0xAC, 0x7C, 0x1B, 0xE5, 0x4C, 0x37, 0xC6, 0xAE, 0x7D, 0x7B, 0xB6, 0x75, 0xB2,
-    0x24, 0xEA, 0xE9, 0xE6, 0x98, 0x0B, 0xDF, 0x6A, 0xAA, 0x90, 0xF6, 0xA6, 0x71, 0xD9, 0xFF, 0x93,
-    0x6F, 0x8C, 0x8E, 0xAA, 0xF7, 0x0A, 0xBD, 0x45, 0x7D, 0x58, 0xEA, 0xCF, 0x55, 0x4B, 0xB3, 0x16,
-    0xA8, 0xC6, 0x53, 0xA9, 0xEF, 0xE8, 0xF0, 0x55, 0x1E, 0x10, 0x53, 0x36, 0xCA, 0xFD, 0x8A, 0x4C,
-    0xAC, 0x4E, 0x66, 0xE7, 0x7D, 0x9D, 0x0C, 0x2A, 0xDD, 0x09, 0xD9, 0x84, 0xC5, 0x46, 0x27, 0xF5,
-    0x78, 0x29, 0x7A, 0x45, 0x0A, 0x58, 0x99, 0xCF, 0xA4, 0x40, 0x15, 0x74, 0x60, 0xA5, 0x7F, 0x76,
-    0xC3, 0xA3, 0x3E, 0x5C, 0xAA, 0x08, 0xE3, 0x17, 0x9F, 0x93, 0x4D, 0x8F, 0x2C, 0xFC, 0x6B, 0xA3,
-    0x14, 0x2C, 0x95, 0xE3, 0xF3, 0xC2, 0x46, 0x65, 0x6D, 0x44, 0xB9, 0xDE, 0xC0, 0xFD, 0x45, 0xAE,
-    0xEE, 0x74, 0x27, 0x51, 0x56, 0xA8, 0xC0, 0x48, 0x0C, 0xE1, 0x50, 0x12, 0xBE, 0x66, 0x63, 0xB0,
-    0x63, 0x41, 0xEE, 0x2F, 0xDD, 0x79, 0x95, 0x78, 0xC3, 0x13, 0xE9, 0x09, 0x88, 0xD2, 0x3A, 0xBE,
-    0xA5, 0x8E, 0xE8, 0xB7, 0x5B, 0x99, 0x8D, 0xCD, 0x5A, 0x72, 0x85, 0xD8, 0xF8, 0x84, 0xA2, 0xCF,
-    0x2B, 0x2B, 0x6E, 0x95, 0x5F, 0x90, 0x4C, 0x47, 0xDC, 0xCF, 0x45, 0xA9, 0x34, 0xC0, 0xE0, 0xFB,
-    0x86, 0xDD, 0xDD, 0x8B, 0x81, 0xDC, 0xCE, 0x35, 0x70, 0x58, 0x15, 0x0D, 0xA1, 0x83, 0x62, 0x82,
-    0x90, 0x43, 0x9A, 0xAF, 0x43, 0xFE, 0x81, 0x92, 0xD2, 0xBA, 0x3C, 0x39, 0x30, 0x49, 0x33, 0xA4,
-    0x15, 0x33, 0xBA, 0x95, 0x8C, 0x3D, 0x53, 0x81, 0x8D, 0x63, 0xFA, 0x83, 0x85, 0x86, 0x63, 0x2E,
-    0x00, 0x3F, 0xFD, 0x89, 0x0D, 0x59, 0xD0, 0xB9, 0x07, 0xA7, 0xF3, 0x9D, 0xCC, 0x50, 0x32, 0x69,
-    0x30, 0x04, 0x3B, 0xF7, 0xA2, 0xE9, 0x91, 0x20, 0x61, 0xE2, 0x07, 0x5E, 0x43, 0x7E, 0xC5, 0x8D,
-    0xE5, 0x95, 0x7E, 0x2A, 0x5F, 0x6E, 0xA7, 0xF2, 0x7C, 0x3B, 0x96, 0xE7, 0x3F, 0x1A, 0xCA, 0xAB,
-    0xB7, 0xFA, 0xFC, 0x2D, 0xB9, 0x36, 0x1C, 0xA3, 0x30, 0x28, 0xB7, 0xFF, 0xF8, 0x7A, 0xD8, 0x0D,
-    0xE1, 0x7D, 0x96, 0xF1, 0xA1, 0x6C, 0xE1, 0xDE, 0x3F, 0x08, 0x74, 0x17, 0x39, 0x3B, 0x0B, 0x75,
-    0x63, 0x25, 0x99, 0xC7, 0x06, 0x1A, 0xD5, 0xB1, 0x22, 0x51, 0xCB, 0xDA, 0xD0, 0xC1, 0x8E, 0x33,
-    0x79, 0x7F, 0x90, 0xC8, 0x97, 0x5B, 0xAE, 0x3F, 0x21, 0x48, 0x84, 0x77, 0x31, 0x0F, 0x54, 0x51,
-    0xBE, 0xD7, 0x8D, 0xAE, 0xBF, 0xA4, 0x2B, 0x5D, 0x04, 0x97, 0x3A, 0x5D, 0xDA, 0xD7, 0xC6, 0x27,
-    0x3B, 0xED, 0xA7, 0xB9, 0xA2, 0xDE, 0x9F, 0xDC, 0x7E, 0x1A, 0x7C, 0x42, 0xFB, 0xE9, 0x7A, 0x7A,
-    0x55, 0x25, 0xAF, 0x91, 0x2A, 0x0D, 0x76, 0x80, 0xFA, 0x03, 0x2E, 0xC5, 0xB6, 0x5F, 0x0A, 0xC6,
-    0xAD, 0xAC, 0x17, 0x03, 0x63, 0x85, 0x41, 0x72, 0xD3, 0xDD, 0x64, 0x22, 0x8A, 0xA5, 0xE5, 0x15,
-    0x60, 0xA8, 0x8A, 0x62, 0x17, 0x0C, 0xDB, 0xAB, 0x71, 0xA1, 0x57, 0xD1, 0x2E, 0xF3, 0xE7, 0x2C,
-    0xF6, 0x89, 0x94, 0x89, 0x32, 0xB7, 0xAD, 0xE5, 0xAB, 0xCB, 0x49, 0xAF, 0x26, 0xB7, 0xF9, 0xEA,
-    0xD2, 0x5D, 0x27, 0xD7, 0x82, 0x4D, 0x2A, 0x95, 0xCE, 0x05, 0x9B, 0x6C, 0xA2, 0x8D, 0x44, 0xB1,
-    0x9C, 0xE6, 0x5C, 0xB7, 0xEB, 0x81, 0xEC, 0xBE, 0x14, 0xCD, 0x39, 0xF6, 0x8F, 0x33, 0x43, 0xA0,
-    0x81, 0x38, 0x2C, 0x60, 0x53, 0x3D, 0x7B, 0xC8, 0x4E, 0xD1, 0xFC, 0x87, 0x3E, 0x7B, 0x9A, 0x6A,
-    0x5A, 0x51, 0xAB, 0x7C, 0xA9, 0xF7, 0xCA, 0x76, 0xBD, 0xB7, 0xE5, 0xC3, 0xBD, 0xB7, 0xBC, 0x58,
-    0x8D, 0xB4, 0x4F, 0x6A, 0x1F, 0x62, 0xDE, 0xBE, 0xE2, 0x7F, 0x65, 0x91, 0xF8, 0x74, 0x50, 0xAC,
-    0x74, 0x10, 0x88, 0x77, 0x5F, 0x3A, 0x28, 0x74, 0xDE, 0x01, 0x1A, 0x4C, 0xFA, 0x76, 0x9D, 0x20,
-    0x95, 0x93, 0x68, 0x86, 0x04, 0x53, 0x83, 0xB5, 0x5A, 0x20, 0x22, 0x1B, 0xE6, 0xB3, 0xD2, 0x28,
-    0x10, 0xF5, 0x6D, 0xBF, 0xC9, 0x26, 0xC2, 0x1F, 0xCA, 0xDE, 0x65, 0x96, 0x98, 0x50, 0x67, 0x4A,
-    0x3C, 0xA7, 0x7D, 0xF7, 0xDD, 0xFE, 0x66, 0x76, 0x47, 0x6B, 0x0A, 0x64, 0xB5, 0xC9, 0x19, 0xE4,
-    0x73, 0xCC, 0x52, 0x59, 0x97, 0x5C, 0xBE, 0xB1, 0xE2, 0x11, 0x56, 0xAE, 0x43, 0x03, 0x5E, 0x2C,
-    0x59, 0x3A, 0xC3, 0x3D, 0x30, 0x94, 0xA2, 0x4D, 0x04, 0xA3, 0xF3, 0xD9, 0x3F, 0x37, 0xF8, 0x5E,
-    0xDA, 0xD2, 0x23, 0xE3, 0x5C, 0x95, 0x9D, 0xAE, 0x57, 0xA2, 0x7B, 0x71, 0xF6, 0xF6, 0xE9, 0xFB,
-    0xFC, 0x5E, 0xEB, 0xD9, 0x65, 0x01, 0xD6, 0xE0, 0x2D, 0x2F, 0x9C, 0x9F, 0xDA, 0xB7, 0xEC, 0xA6,
-    0x6F, 0x8A, 0xF5, 0xB8, 0xA8, 0x58, 0x4A, 0x4F, 0x0A, 0x30, 0xB4, 0x99, 0x2F, 0x9D, 0x58, 0xB9,
-    0x98, 0x1B, 0x76, 0x0D, 0xCE, 0xDD, 0x52, 0x87, 0x98, 0xA2, 0x10, 0x99, 0xA4, 0x25, 0x9A, 0x2E,
-    0x46, 0x6C, 0xF2, 0x7B, 0x8A, 0xD6, 0x96, 0xD3, 0x2D, 0x94, 0x9F, 0xFC, 0x84, 0x54, 0x72, 0xB9,
-    0x4D, 0xF4, 0x4A, 0xED, 0x11, 0xFD, 0x34, 0x1A, 0xBE, 0x83, 0x8B, 0x47, 0x1D, 0xCD, 0xDA, 0xBD,
-    0xC9, 0xDF, 0x50, 0xC8, 0x77, 0x69, 0x55, 0x39, 0x95, 0xDF, 0xBD, 0x26, 0xCF, 0x40, 0x7D, 0xE2,
-    0xEE, 0xA7, 0xA6, 0x8B, 0xAB, 0x69, 0xED, 0xDA, 0x08, 0x1A, 0x06, 0xFE, 0x8A, 0xFA, 0x11, 0xAC,
-    0x4F, 0x5A, 0xF7, 0x4B, 0xAB, 0x39, 0x73, 0x2D, 0xB6, 0xDC, 0xE7, 0x61, 0x0C, 0x40, 0x5A, 0x0E,
-    0x46, 0x9A, 0x32, 0x99, 0x5F, 0xC5, 0x8F, 0xCF, 0x58, 0x51, 0x28, 0x27, 0xFE, 0xC8, 0xA2, 0xA8,
-    0x61, 0xC7, 0xEA, 0x43, 0xE7, 0xD2, 0x51, 0xB3, 0x9A, 0x51, 0x6B, 0xCD, 0xDE, 0x56, 0x45, 0x4A,
-    0x63, 0xA3, 0x0F, 0xD4, 0x9B, 0x0F, 0xE4, 0x37, 0x2E, 0xB9, 0xDE, 0x0A, 0x29, 0xB7, 0x75, 0x2E,
-    0xF7, 0xE5, 0xAF, 0x7D, 0x22, 0x65, 0x83, 0x38, 0x66, 0x9D, 0x08, 0x55, 0x11, 0xDF, 0x71, 0xEE,
-    0xE3, 0x09, 0x27, 0x98, 0xFE, 0xFC, 0xEC, 0xED, 0x93, 0x16, 0x40, 0x61, 0x31, 0xA4, 0xCC, 0x31,
-    0x65, 0x70, 0x25, 0xBB, 0x21, 0xC9, 0x65, 0x26, 0xAE, 0x28, 0x9B, 0x70, 0xDC, 0x73, 0xA7, 0xB1,
-    0x13, 0xA2, 0x77, 0x58, 0x1E, 0x66, 0x72, 0x1E, 0xD1, 0xAE, 0xE5, 0x95, 0xD1, 0x25, 0x0B, 0x67,
-    0x30, 0xFF, 0xE8, 0x45, 0x56, 0x06, 0xB1, 0xE8, 0x9D, 0x6E, 0x85, 0x4A, 0xDE, 0x19, 0xFE, 0x61,
-    0x8D, 0x69, 0xC1, 0xD1, 0x24, 0x0C, 0x09, 0x12, 0x2E, 0x70, 0x8B, 0x0B, 0x26, 0x33, 0xD6, 0xEE,
-    0x2F, 0x1D, 0x7B, 0x63, 0x6C, 0x22, 0x1B, 0x58, 0xE3, 0x6C, 0xEB, 0xC3, 0x31, 0x3B, 0x2A, 0xF9,
-    0x06, 0x63, 0xF1, 0x14, 0x26, 0x4D, 0x1D, 0x13, 0xF9, 0xC9, 0x97, 0x86, 0x76, 0x36, 0xEF, 0x1F,
-    0xB7, 0x2A, 0x01, 0x68, 0xA1, 0x9F, 0xAB, 0x3B, 0xF3, 0xB9, 0xBC, 0xB0, 0x60, 0x53, 0x6B, 0xC9,
-    0xBE, 0x00, 0x96, 0x9C, 0x40, 0xC3, 0x72, 0x2E, 0x54, 0x39, 0xEB, 0xC6, 0x1F, 0x05, 0x1C, 0xD5,
-    0xB1, 0xF4, 0xDF, 0xDA, 0xDA, 0xBA, 0xB3, 0x9D, 0xF1, 0xA2, 0x11, 0x6E, 0xFA, 0xE5, 0x0B, 0xDA,
-    0x1C, 0x87, 0x3E, 0xF0, 0x48, 0x7E, 0xCE, 0x13, 0x61, 0xFB, 0xE4, 0x65, 0x82, 0x9E, 0xF4, 0x9D,
-    0x16, 0x3A, 0xE8, 0xEB, 0xB8, 0xDF, 0x95, 0x9F, 0xBB, 0xF5, 0xF8, 0x47, 0x49, 0x9B, 0xDF, 0xA3,
-    0x4F, 0x0B, 0x2B, 0x9D, 0xA8, 0xF1, 0x74, 0x62, 0x37, 0x08, 0x48, 0xB7, 0xA0, 0xE3, 0xFF, 0x15,
-    0x5C, 0x60, 0x59, 0x63, 0x4B, 0xBF, 0xA7, 0x68, 0x90, 0xB7, 0x15, 0x50, 0x5F, 0x83, 0x6F, 0x65,
-    0xEA, 0xD9, 0x50, 0x93, 0xFF, 0x4D, 0xDC, 0x96, 0xAF, 0x60, 0xE9, 0xD7, 0xF2, 0xB6, 0xBC, 0xE9,
-    0x9A, 0x5C, 0x25, 0xE3, 0x58, 0x36, 0x27, 0x03, 0x7D, 0x17, 0x4B, 0xFF, 0x0E, 0x96, 0xFE, 0xDF,
-    0x76, 0x54, 0xFB, 0x26, 0xA2, 0x24, 0xDD, 0x35, 0xEC, 0x44, 0x9E, 0x2C, 0xBE, 0xF6, 0xB1, 0x8D,
-    0x75, 0x60, 0xE5, 0x06, 0x96, 0x76, 0xE8, 0xD8, 0xC8, 0x49, 0x67, 0x8C, 0xC5, 0x97, 0xF2, 0xD2,
-    0x98, 0x99, 0x14, 0xCA, 0x61, 0xF1, 0x24, 0x5D, 0x7A, 0x75, 0x26, 0x5A, 0xC7, 0x79, 0xB6, 0x89,
-    0x1D, 0xAE, 0x06, 0xAF, 0x34, 0x49, 0x3D, 0x69, 0x31, 0x3D, 0x09, 0x8B, 0x30, 0x39, 0x16, 0x74,
-    0xE3, 0x06, 0x63, 0xDE, 0xB2, 0x81, 0x79, 0x3D, 0x79, 0x65, 0xCF, 0x76, 0x21, 0xAF, 0xFF, 0x55,
-    0xC5, 0xBF, 0xBC, 0xEF, 0xC9, 0x61, 0x37, 0xAD, 0xA3, 0xBE, 0x04, 0x8B, 0x33, 0x99, 0x7A, 0x0B,
-    0xD2, 0xA9, 0x64, 0x6E, 0x1B, 0x47, 0xF8, 0xA3, 0x04, 0xFA, 0xE7, 0x3C, 0xFC, 0x3F, 0xE0, 0xAE,
-    0xAB, 0x58, 0x79, 0xE7, 0xF2, 0xDB, 0x7F, 0xEA, 0xAE, 0xA8, 0x98, 0x78, 0x2D, 0xA9, 0xE0, 0x0E,
-    0x2F, 0x78, 0xC6, 0xB7, 0x6B, 0x1A, 0xFB, 0x1B, 0x00, 0xB2, 0x6C, 0x6F, 0x7E, 0xF7, 0x85, 0xDA,
-    0x66, 0x19, 0xD9, 0x00, 0xA4, 0x40, 0x5E, 0xEB, 0x36, 0xB8, 0x1B, 0x58, 0xA5, 0x8D, 0x2F, 0xE9,
-    0x1D, 0x4E, 0x44, 0x63, 0x74, 0x1B, 0x47, 0x92, 0x7C, 0x78, 0x1D, 0x1B, 0xDA, 0x7B, 0xBB, 0xDB,
-    0x1B, 0xD4, 0xF8, 0xA8, 0xAA, 0x97, 0x78, 0xFA, 0x2B, 0xAF, 0x84, 0x4A, 0xE5, 0x85, 0x8A, 0xDF,
-    0xDF, 0xE4, 0x90, 0x2A, 0x43, 0x20, 0xBB, 0xBD, 0xC6, 0xBF, 0xB3, 0xAD, 0x3D, 0x50, 0x89, 0xB3,
-    0x73, 0x95, 0x8D, 0x9E, 0xFC, 0x1C, 0x36, 0x2F, 0x29, 0xA5, 0xF8, 0x48, 0x47, 0x2E, 0x37, 0x52,
-    0xCA, 0xF8, 0x36, 0x7D, 0xBD, 0x50, 0x65, 0xFD, 0xD0, 0x07, 0xF5, 0x4E, 0xE0, 0xF9, 0x21, 0x75,
-    0xF0, 0xC5, 0x7D, 0x75, 0xF0, 0xB9, 0x7C, 0x9A, 0x50, 0x8D, 0x6F, 0xF5, 0x91, 0x78, 0x55, 0x66,
-    0x8C, 0x34, 0x59, 0x94, 0xC8, 0xBA, 0xBD, 0x83, 0x4D, 0x43, 0xF5, 0xB6, 0xD6, 0xD3, 0x9B, 0x46,
-    0x0E, 0x78, 0x63, 0xEA, 0xC0, 0x24, 0x50, 0xA1, 0x7A, 0xCE, 0xD9, 0x68, 0x6C, 0x1C, 0x20, 0xAD,
-    0x0D, 0x6B, 0x51, 0x07, 0x96, 0x62, 0x2D, 0x47, 0x0B, 0xDB, 0xAD, 0x87, 0xFC, 0x15, 0x6D, 0xEB,
-    0x9E, 0xA1, 0xF9, 0xC4, 0x08, 0xBD, 0x70, 0xCE, 0x4F, 0xA0, 0xB0, 0xA7, 0xDD, 0xAF, 0x14, 0xB0,
-    0x0B, 0x27, 0x19, 0x72, 0xAC, 0xD8, 0xAD, 0x75, 0xEC, 0x2B, 0xB3, 0x88, 0x9D, 0x02, 0x31, 0x2B,
-    0x36, 0x88, 0xB3, 0xC4, 0x78, 0x90, 0x0B, 0x48, 0x70, 0x4D, 0x17, 0x35, 0x1A, 0x6D, 0x65, 0x2A,
-    0x4A, 0xD7, 0x92, 0xC3, 0x26, 0x11, 0x20, 0x2A, 0x9F, 0xF6, 0xD9, 0x30, 0xE7, 0x67, 0x0B, 0x1A,
-    0x14, 0x3C, 0x16, 0xFC, 0xC3, 0x69, 0xE9, 0xFD, 0xFB, 0x05, 0xAD, 0x6C, 0x8C, 0x57, 0xA7, 0x85,
-    0x64, 0x4B, 0x77, 0x86, 0x90, 0x26, 0x0B, 0x55, 0x7F, 0xCA, 0xE9, 0x0C, 0x01, 0x6B, 0xE8, 0xC1,
-    0x04, 0x30, 0x71, 0x2C, 0x4A, 0xCE, 0x54, 0xC6, 0x68, 0xA6, 0x4E, 0x46, 0x40, 0x42, 0x00, 0xB2,
-    0x05, 0x7F, 0xB5, 0x67, 0xFD, 0x7F, 0x81, 0xF5, 0x61, 0x5B, 0x19, 0x85, 0x95, 0x20, 0xFF, 0xC6,
-    0xD0, 0x95, 0x45, 0x04, 0x7D, 0x0C, 0x05, 0x28, 0xF4, 0xB0, 0xB4, 0x92, 0xFD, 0xFB, 0x47, 0x84,
-    0xF2, 0x96, 0x96, 0x35, 0xA8, 0x34, 0x57, 0xE5, 0x2B, 0x07, 0x6A, 0x40, 0xAA, 0x0D, 0xD8, 0xB8,
-    0x8D, 0x2C, 0xA5, 0x0A, 0x7D, 0xCA, 0x3A, 0x9B, 0xA8, 0x27, 0xDA, 0x28, 0x0E, 0x83, 0x59, 0x6C,
-    0x52, 0x93, 0x59, 0xF0, 0x40, 0x1D, 0xBA, 0xC1, 0x4A, 0x6D, 0x12, 0xEC, 0xD3, 0x22, 0xD7, 0xA9,
-    0xBB, 0x73, 0x21, 0x59, 0xB0, 0xE4, 0xB0, 0x75, 0x7D, 0xB0, 0xC2, 0x82, 0x00, 0x7A, 0xA1, 0xE9,
-    0x57, 0x7B, 0x0C, 0x70, 0xBF, 0xC2, 0xF4, 0xCF, 0x94, 0x32, 0x4E, 0xDE, 0x72, 0x70, 0x92, 0x2B,
-    0x1E, 0xDB, 0x54, 0xE0, 0x35, 0x9B, 0x28, 0x9E, 0xF9, 0xA3, 0x5B, 0xE7, 0x6F, 0x97, 0x57, 0x58,
-    0x8E, 0xE0, 0x45, 0x16, 0xF8, 0x75, 0xDC, 0x6B, 0x36, 0x15, 0x6B, 0xB5, 0xA6, 0x28, 0xAA, 0xDD,
-    0x8D, 0x7D, 0x57, 0x85, 0x5A, 0x3C, 0x94, 0xD3, 0xD1, 0xE2, 0xCE, 0xAA, 0x25, 0xA4, 0x87, 0xBD,
-    0x64, 0x8A, 0xA2, 0xA7, 0xB7, 0xC2, 0x6A, 0x91, 0xE8, 0x28, 0x3C, 0x2A, 0x33, 0x8F, 0x0D, 0x16,
-    0x3F, 0x9E, 0x43, 0x31, 0xDD, 0x4E, 0x28, 0x26, 0x3C, 0x12, 0x8A, 0xE9, 0x3E, 0x45, 0x28, 0x46,
-    0x1E, 0xFC, 0x7D, 0x93, 0x97, 0x64, 0xC3, 0x36, 0x41, 0x9A, 0x31, 0x98, 0xED, 0x95, 0x50, 0xA0,
-    0xBC, 0x30, 0xD6, 0xB8, 0xFF, 0x5D, 0x29, 0x6F, 0x56, 0xB8, 0x76, 0x9C, 0x2B, 0x7D, 0x66, 0xC6,
-    0x50, 0x07, 0xAF, 0xC5, 0xBC, 0x52, 0x35, 0xBD, 0x5A, 0x99, 0x6C, 0x27, 0x8F, 0xBC, 0x74, 0x6A,
-    0xA1, 0x9D, 0xE4, 0x93, 0xAB, 0xD3, 0x77, 0x07, 0x37, 0xF9, 0xF7, 0x0D, 0x9B, 0x79, 0x44, 0x82,
-    0x2E, 0x20, 0xF6, 0xD7, 0xCB, 0x41, 0x79, 0x05, 0xD0, 0xB8, 0x56, 0x0A, 0x7C, 0x53, 0x78, 0x54,
-    0xB2, 0x3D, 0x53, 0x31, 0x05, 0xEB, 0x0A, 0xD2, 0x84, 0x98, 0xE5, 0x16, 0xEA, 0xAD, 0x0C, 0xEA,
-    0x55, 0x46, 0x06, 0x52, 0xA0, 0x58, 0xB9, 0x4D, 0xB1, 0x91, 0x47, 0x8E, 0xF3, 0x07, 0xB6, 0xCD,
-    0x46, 0x0A, 0x41, 0x00, 0xD2, 0xD2, 0x6E, 0xD3, 0x23, 0x8A, 0x18, 0x6E, 0x0D, 0x4C, 0x51, 0xE8,
-    0x44, 0x7C, 0x9F, 0x6A, 0x36, 0xCB, 0x8C, 0xE1, 0xF6, 0xB2, 0x0A, 0x3E, 0xEB, 0xB0, 0x54, 0xEB,
-    0x5D, 0xB6, 0xAD, 0xBE, 0x97, 0x4F, 0xAD, 0xF0, 0xEE, 0x85, 0xC0, 0x70, 0x54, 0xB6, 0x83, 0xA3,
-    0xE2, 0x0D, 0x8E, 0xAA, 0xD5, 0x68, 0x4C, 0xCC, 0xC6, 0xFE, 0x6C, 0x4E, 0xEC, 0xB9, 0x5B, 0x1A,
-    0x8E, 0x12, 0x42, 0xCC, 0xC7, 0x07, 0xB0, 0xCD, 0x3E, 0xE5, 0x44, 0x01, 0xA4, 0xC9, 0x7A, 0x6D,
-    0xB7, 0xEE, 0xDB, 0x51, 0x08, 0xB4, 0xA9, 0x4D, 0x59, 0xF7, 0xF0, 0x38, 0xD9, 0x00, 0x7B, 0x16,
-    0x47, 0x8E, 0x73, 0xFC, 0x18, 0x07, 0x7B, 0xBE, 0x87, 0x9E, 0xBE, 0x5D, 0x76, 0xC4, 0x86, 0x0E,
-    0xCA, 0xA0, 0x3C, 0x6F, 0x0D, 0xB0, 0xDF, 0x76, 0x6A, 0xD4, 0x8D, 0x14, 0xAE, 0x28, 0xB8, 0x9F,
-    0xB0, 0x35, 0xD6, 0x9E, 0xCC, 0x1F, 0xFD, 0xB2, 0x5A, 0x81, 0x07, 0xDF, 0x4C, 0xCF, 0x54, 0x36,
-    0x4B, 0xE9, 0x72, 0x8E, 0x92, 0x90, 0x67, 0x61, 0x83, 0xCA, 0xF8, 0xD3, 0x84, 0xF3, 0xBA, 0x59,
-    0xAF, 0xEF, 0xE1, 0xDC, 0xF3, 0x2C, 0x3D, 0xA8, 0xFD, 0xA4, 0xB2, 0xE8, 0x56, 0xC7, 0x9A, 0xC5,
-    0xF4, 0x5A, 0x93, 0x43, 0x64, 0xA7, 0xE4, 0x5C, 0x5F, 0x66, 0xEB, 0xEE, 0x67, 0x31, 0x88, 0x99,
-    0x5C, 0xEE, 0x59, 0xD7, 0xE8, 0xC2, 0x3B, 0x2D, 0x07, 0xFE, 0xC5, 0xEE, 0x45, 0xB8, 0x9B, 0x4D,
-    0x3E, 0xC0, 0xB4, 0xE5, 0x4F, 0xBA, 0x26, 0x75, 0x6F, 0x02, 0x19, 0x30, 0xB7, 0x0D, 0x9D, 0xB6,
-    0x76, 0x3D, 0xC5, 0xD5, 0xC6, 0xD2, 0xF9, 0x36, 0xE5, 0x19, 0x10, 0xDB, 0x14, 0x3B, 0x1F, 0x9C,
-    0x32, 0x9C, 0xB0, 0x70, 0x1B, 0xAC, 0xC3, 0x45, 0xE2, 0x34, 0xDB, 0x05, 0x4F, 0x98, 0x87, 0xB7,
-    0x64, 0xCA, 0xAD, 0xD1, 0x18, 0x80, 0x7A, 0x75, 0xAF, 0x8D, 0xB1, 0xE8, 0x3B, 0x5D, 0x0A, 0xE0,
-    0x79, 0xA7, 0xCB, 0xC1, 0xEB, 0xB7, 0xBA, 0x31, 0x2F, 0xA2, 0x5B, 0xBF, 0x1E, 0x20, 0xCB, 0xD7,
-    0xEF, 0x75, 0x65, 0x10, 0xBF, 0xE9, 0x38, 0xFC, 0xE9, 0x4D, 0x07, 0x48, 0x9B, 0x5E, 0x76, 0xAF,
-    0xC3, 0xFF, 0xB9, 0x0C, 0xC3, 0x39, 0xE4, 0x2F, 0x3A, 0x9F, 0x72, 0xB7, 0x75, 0x58, 0x5D, 0xB6,
-    0xE5, 0x74, 0xE4, 0x31, 0xD9, 0x99, 0x2C, 0xF6, 0x3F, 0x7B, 0x24, 0x10, 0xB6, 0xB8, 0x99, 0xDC,
-    0x5B, 0xCD, 0xE3, 0x81, 0x54, 0xB4, 0x47, 0xF0, 0x1D, 0x0D, 0x85, 0x4D, 0xE8, 0x95, 0x3F, 0xB7,
-    0xF4, 0x8E, 0x27, 0x69, 0xB5, 0x47, 0x73, 0xF7, 0x06, 0x9D, 0xF4, 0x37, 0xD5, 0xB1, 0xCB, 0xB1,
-    0x7F, 0x5D, 0x4C, 0x47, 0x76, 0xCD, 0xAA, 0xDF, 0x05, 0x23, 0x54, 0xFB, 0x58, 0xC5, 0x1C, 0xC2,
-    0x1A, 0xFC, 0xE8, 0xB4, 0xD6, 0x67, 0xFE, 0x28, 0x3B, 0x2A, 0x63, 0xB4, 0xE1, 0x7A, 0x10, 0xC6,
-    0x13, 0xB0, 0xE1, 0x69, 0x06, 0xA9, 0xB9, 0x3C, 0x28, 0x30, 0xBE, 0xE6, 0x3A, 0x1F, 0x9F, 0xCB,
-    0x0F, 0x7F, 0x06, 0xCF, 0x63, 0xE2, 0x74, 0x9A, 0x68, 0xDA, 0x03, 0xCC, 0x88, 0x86, 0x94, 0x85,
-    0x52, 0xDE, 0x07, 0xE0, 0xB8, 0x15, 0x76, 0x28, 0xB1, 0xC6, 0x11, 0x8A, 0xB8, 0x2E, 0xFF, 0x56,
-    0x93, 0x95, 0x61, 0xD3, 0xE9, 0x07, 0xA4, 0xD6, 0xF0, 0x15, 0xAC, 0xEB, 0x9F, 0x04, 0xD6, 0xAF,
-    0x15, 0xBD, 0xCB, 0x88, 0x43, 0xD5, 0xED, 0xAA, 0x78, 0x0D, 0x29, 0x0D, 0x2D, 0xD2, 0xA7, 0x52,
-    0x8C, 0xCA, 0xA6, 0x94, 0xDA, 0x56, 0x5D, 0xC2, 0x79, 0xA5, 0x49, 0x65, 0x63, 0x4A, 0xB5, 0x53,
-    0xD6, 0x95, 0x52, 0x21, 0x36, 0xF0, 0x36, 0x0F, 0x54, 0x40, 0xDD, 0x0A, 0xDB, 0xAC, 0xAC, 0x83,
-    0x03, 0x5B, 0xD4, 0x3E, 0xB1, 0xE3, 0xA8, 0xC3, 0xE1, 0xD0, 0xC9, 0xA2, 0x4C, 0x47, 0x2F, 0xC1,
-    0xBF, 0xBE, 0x02, 0xD9, 0xBE, 0xDA, 0x05, 0xF1, 0x53, 0xDB, 0xD8, 0xD7, 0x67, 0xB2, 0x45, 0xB5,
-    0x02, 0x54, 0x06, 0x53, 0x06, 0x0B, 0x97, 0xDA, 0x66, 0x54, 0x35, 0xA7, 0xDA, 0x47, 0x3E, 0x7B,
-    0x5E, 0xE6, 0x57, 0xC3, 0x77, 0x95, 0x23, 0x15, 0x21, 0x00, 0x3D, 0xF6, 0x7F, 0xC4, 0x67, 0x55,
-    0x8B, 0x42, 0xED, 0x2D, 0x4B, 0x5D, 0x69, 0xA2, 0x69, 0x3C, 0x5D, 0x9A, 0x73, 0xAF, 0x95, 0x05,
-    0x8F, 0x07, 0x1B, 0xD9, 0xEC, 0xCC, 0x0B, 0x8D, 0x7C, 0x90, 0x90, 0x97, 0x88, 0x3A, 0x0D, 0xEB,
-    0x5C, 0x11, 0xD3, 0xA8, 0xAF, 0xC2, 0xEA, 0xFA, 0x37, 0xFB, 0xFC, 0x29, 0x53, 0xE9, 0xE3, 0x8C,
-    0xD7, 0x47, 0x58, 0x53, 0xF7, 0xD4, 0x14, 0x77, 0x11, 0x98, 0x26, 0x6D, 0x38, 0x64, 0x81, 0x65,
-    0x21, 0xC0, 0xCF, 0x6A, 0x7B, 0x2A, 0xD5, 0xB9, 0x58, 0x16, 0xF1, 0xE1, 0x9F, 0xD3, 0xE4, 0x6B,
-    0x9A, 0x34, 0x43, 0xA1, 0xE5, 0xBB, 0xAE, 0x5F, 0xD4, 0x6A, 0xB8, 0x80, 0xEF, 0xC8, 0x69, 0x19,
-    0xA0, 0x02, 0x3B, 0x73, 0xB3, 0x6D, 0x23, 0x55, 0x0E, 0xED, 0xB3, 0xEE, 0xD8, 0xE9, 0xA1, 0x9D,
-    0x8C, 0x5B, 0x5C, 0x3B, 0x97, 0x2A, 0x14, 0xBF, 0x69, 0x10, 0xF9, 0xE1, 0x7E, 0xB6, 0x9A, 0x47,
-    0xBA, 0x5A, 0xE1, 0xC6, 0xC3, 0x4B, 0x15, 0x0E, 0xF7, 0x8B, 0xA5, 0x67, 0xF0, 0xC2, 0xEA, 0xFD,
-    0x4E, 0x64, 0x27, 0x60, 0xE1, 0x93, 0x6A, 0x49, 0x66, 0x49, 0x35, 0xE0, 0xAA, 0xD9, 0x82, 0xCF,
-    0x7C, 0x34, 0x34, 0xA7, 0xAC, 0xBE, 0x4A, 0x77, 0x59, 0x6E, 0xCE, 0x3A, 0xA0, 0x3D, 0x92, 0x64,
-    0xD0, 0x3C, 0xA7, 0xF2, 0x46, 0x26, 0x97, 0xC1, 0xE2, 0xF1, 0xC5, 0x1F, 0xCC, 0xAB, 0xA8, 0xD4,
-    0x19, 0xB6, 0x75, 0x96, 0xF6, 0xF0, 0xDB, 0x9A, 0x57, 0x8B, 0xF9, 0x90, 0x5F, 0xB2, 0x10, 0x6C,
-    0xE5, 0xFD, 0x65, 0xF3, 0x2B, 0x7C, 0xC8, 0x76, 0xCF, 0x31, 0xDB, 0x66, 0x64, 0x6F, 0x53, 0xB7,
-    0xEF, 0x5E, 0xF2, 0x43, 0x18, 0x6C, 0xAA, 0x42, 0xC1, 0x51, 0x4B, 0x2B, 0xF7, 0x97, 0xAA, 0x39,
-    0x18, 0xAD, 0x98, 0x47, 0x35, 0x01, 0x9B, 0xD2, 0xFB, 0xA5, 0x88, 0xC6, 0x29, 0x5B, 0xC3, 0xEA,
-    0x02, 0xA1, 0xBE, 0x8D, 0xFF, 0x59, 0x7C, 0xDB, 0xB1, 0x1C, 0x1F, 0x97, 0x7E, 0xD7, 0xFD, 0xC2,
-    0x9D, 0x62, 0x7B, 0x2A, 0x98, 0x94, 0x93, 0x9D, 0xAC, 0x90, 0x20, 0xD3, 0xEE, 0x75, 0x91, 0xEF,
-    0x45, 0x2C, 0x7B, 0x2A, 0xBD, 0x04, 0x7E, 0x7D, 0x5D, 0xEF, 0xFA, 0x7C, 0x53, 0x66, 0x4D, 0x21,
-    0x0C, 0xA1, 0x2D, 0xA6, 0x03, 0x0E, 0x14, 0x5C, 0x6F, 0x0A, 0x08, 0xA5, 0x1B, 0x2D, 0x87, 0x93,
-    0x2D, 0x4A, 0xF3, 0xA0, 0x5B, 0x0D, 0x62, 0x74, 0xD3, 0xA5, 0x29, 0x9C, 0x4C, 0xC8, 0x38, 0xCD,
-    0x77, 0x4D, 0xD8, 0x0A, 0xCF, 0x7A, 0xDA, 0x53, 0xBC, 0xC4, 0x77, 0x75, 0xC4, 0xAA, 0x5D, 0x14,
-    0xCC, 0x7B, 0x11, 0x76, 0xE1, 0x54, 0xBB, 0x1C, 0xD2, 0x62, 0x67, 0xEE, 0x7E, 0xA8, 0x03, 0x61,
-    0xC2, 0xA0, 0xFD, 0x62, 0x46, 0xA4, 0x5F, 0x6A, 0xC2, 0xC3, 0xB1, 0x4B, 0x24, 0x17, 0x67, 0x3F,
-    0x9C, 0x77, 0xCF, 0x8F, 0x84, 0x3F, 0xB0, 0x24, 0xE7, 0x86, 0x90, 0x3D, 0x43, 0xB0, 0xB5, 0xA3,
-    0x3C, 0x0B, 0xCF, 0x70, 0xF3, 0xD5, 0x92, 0xAB, 0x86, 0x6E, 0x9D, 0x69, 0xF2, 0x45, 0xF7, 0xF5,
-    0x07, 0x4B, 0xCB, 0x58, 0xCE, 0xC5, 0xC1, 0xA4, 0x0A, 0x31, 0x46, 0xDB, 0x19, 0xE5, 0x2C, 0x97,
-    0x0A, 0x07, 0x9B, 0x89, 0xA0, 0x00, 0x5F, 0xE5, 0x54, 0xB7, 0xC8, 0xAC, 0x81, 0x5A, 0xA9, 0xE2,
-    0xEB, 0x56, 0xED, 0x60, 0x4E, 0x54, 0xE8, 0x87, 0xA5, 0xE7, 0x26, 0x8F, 0x2B, 0xEF, 0x5B, 0xA5,
-    0xBF, 0x9E, 0xAC, 0xD9, 0xF4, 0xBC, 0x66, 0x00, 0xC6, 0x43, 0xFA, 0xBA, 0x32, 0xB8, 0x95, 0x2A,
-    0xE3, 0xA3, 0x51, 0xC9, 0xBF, 0x80, 0x7E, 0x09, 0xF3, 0xA6, 0x04, 0xAC, 0xAC, 0x7C, 0x57, 0x93,
-    0x58, 0xC5, 0xF6, 0x8D, 0xD6, 0xDB, 0xBD, 0x64, 0xD5, 0x58, 0x61, 0x41, 0x69, 0x8C, 0x7B, 0x4A,
-    0x06, 0x6A, 0xD9, 0x7C, 0xEF, 0x81, 0xFD, 0x2C, 0x6D, 0x1A, 0x47, 0x9D, 0xC0, 0xBE, 0x64, 0x74,
-    0x09, 0xBA, 0x08, 0x7A, 0xA4, 0x20, 0x57, 0xAD, 0x71, 0xAE, 0xE1, 0x10, 0x37, 0x9A, 0xBB, 0x76,
-    0x59, 0x45, 0xCD, 0xAB, 0x31, 0xFF, 0x60, 0xF2, 0x5E, 0x54, 0xBD, 0xA3, 0xAD, 0x6E, 0x4E, 0x72,
-    0xAA, 0xD8, 0xDB, 0xA6, 0x32, 0xE8, 0x56, 0x25, 0xE1, 0x58, 0x35, 0x11, 0x75, 0x0F, 0x85, 0x0B,
-    0x14, 0xA9, 0x50, 0x38, 0xEC, 0x78, 0x96, 0xD4, 0x4B, 0x57, 0x3C, 0x32, 0x17, 0x24, 0x2E, 0xDB,
-    0xEF, 0x59, 0x7C, 0x96, 0x8B, 0x0C, 0x5F, 0xDC, 0x26, 0x4B, 0x8E, 0x5B, 0x6B, 0x94, 0x60, 0x59,
-    0xF0, 0xAD, 0x1F, 0xB8, 0xFA, 0x91, 0xA3, 0x7F, 0x9F, 0xA0, 0x24, 0xFF, 0x56, 0xCA, 0x93, 0xE6,
-    0x13, 0x51, 0x68, 0xCF, 0xCF, 0x64, 0xDB, 0x16, 0xE7, 0xA5, 0xE2, 0x46, 0x2F, 0xBD, 0x7F, 0x9C,
-    0xD5, 0xBE, 0xEC, 0xC3, 0x57, 0x7C, 0xE8, 0x82, 0x71, 0x34, 0x35, 0x38, 0x6C, 0x03, 0x29, 0xB4,
-    0x63, 0x4F, 0xF6, 0x5C, 0xED, 0xDB, 0x4C, 0xEB, 0x2F, 0x04, 0x4A, 0xC0, 0x4A, 0x0A, 0x2F, 0x51,
-    0x3F, 0xBC, 0x27, 0x56, 0x3C, 0xC1, 0xC3, 0x2D, 0x19, 0x68, 0x3F, 0x9E, 0x25, 0xAC, 0x3D, 0xAB,
-    0x4A, 0x0D, 0x27, 0x2C, 0xCC, 0xFA, 0x26, 0x56, 0xB0, 0x66, 0x23, 0x1D, 0xD6, 0xD6, 0x3F, 0x37,
-    0x7A, 0x99, 0xE6, 0x89, 0xA6, 0xFE, 0x2F, 0x3E, 0x2C, 0x5C, 0x67, 0x51, 0xD8, 0xE5, 0x81, 0x74,
-    0xD2, 0xB0, 0x5B, 0x31, 0x95, 0xD6, 0x8F, 0x71, 0xFE, 0xD9, 0x7B, 0x4F, 0xA8, 0x94, 0x4C, 0x13,
-    0xED, 0x70, 0xEF, 0xBB, 0xBE, 0x57, 0x7B, 0x77, 0x20, 0x5C, 0xB1, 0x38, 0x43, 0x9D, 0x1A, 0x0D,
-    0xDE, 0xF3, 0x71, 0x73, 0xC8, 0x4A, 0x59, 0xC0, 0x0B, 0x66, 0x0D, 0xCD, 0x97, 0x4E, 0x7A, 0x3F,
-    0x18, 0x74, 0x7D, 0x1F, 0x7E, 0x7C, 0x8C, 0x03, 0x0C, 0x0E, 0x4B, 0x8D, 0x60, 0xAE, 0xA4, 0x91,
-    0x9E, 0xD8, 0x80, 0xF9, 0xE0, 0xCB, 0xFB, 0x17, 0x7D, 0x9E, 0xCC, 0xAE, 0x72, 0xE6, 0xCC, 0xB6,
-    0xC2, 0xB1, 0xA4, 0xC7, 0x9A, 0xF7, 0x1C, 0x23, 0x3B, 0xCE, 0xA3, 0x7C, 0x39, 0xB4, 0x16, 0xB8,
-    0x0A, 0x18, 0x34, 0xBC, 0xD7, 0x2F, 0xC7, 0xF5, 0xA1, 0x26, 0xEB, 0x10, 0x37, 0x8D, 0xEC, 0x84,
-    0x9E, 0x58, 0x72, 0xE8, 0x38, 0x8B, 0x96, 0x9C, 0xE2, 0xF2, 0x42, 0xB5, 0x90, 0xFC, 0x18, 0xCC,
-    0x31, 0x40, 0x8C, 0x9F, 0x2B, 0x1C, 0xA8, 0xFB, 0x11, 0xA8, 0x93, 0x7E, 0xBE, 0xB4, 0xE9, 0xA3,
-    0xFB, 0xAF, 0x2A, 0xB1, 0xBB, 0xE4, 0x2A, 0xAC, 0xAC, 0x5C, 0x19, 0xD4, 0x8A, 0xC3, 0x8B, 0xE8,
-    0xD1, 0xB0, 0x22, 0x70, 0x93, 0x7C, 0xE1, 0x48, 0x35, 0x75, 0xDA, 0xB7, 0x7C, 0x52, 0x83, 0x99,
-    0xD8, 0xA6, 0x9A, 0x43, 0x6A, 0xD8, 0xE6, 0x34, 0x61, 0x51, 0x63, 0x0E, 0x71, 0x8A, 0x2B, 0x5F,
-    0xA8, 0x2B, 0x7B, 0x2E, 0x84, 0x61, 0x22, 0xF3, 0x5A, 0xB4, 0x9B, 0x2D, 0x64, 0xEA, 0x94, 0x62,
-    0x1E, 0x73, 0xD0, 0x71, 0x44, 0x06, 0xD6, 0x28, 0xE5, 0x35, 0x97, 0x0A, 0x37, 0x6B, 0x01, 0xCE,
-    0x86, 0xF4, 0x3C, 0x39, 0x95, 0x9C, 0xDB, 0xC2, 0x6D, 0x96, 0xA7, 0xF0, 0x4A, 0xFA, 0x32, 0x5E,
-    0xC1, 0xBE, 0x81, 0x43, 0x08, 0x1C, 0xDF, 0x6E, 0x98, 0xCF, 0xE4, 0x04, 0x28, 0xE8, 0x56, 0x5C,
-    0x6D, 0x98, 0xE7, 0x3A, 0xA7, 0x93, 0x46, 0x20, 0x73, 0xB0, 0xB7, 0xCB, 0x68, 0xA5, 0xA8, 0xE7,
-    0xC2, 0x76, 0x0A, 0xA8, 0xE8, 0x82, 0x6F, 0x86, 0xC5, 0x4E, 0x8D, 0x2F, 0x64, 0xB3, 0x61, 0xC6,
-    0x41, 0xD1, 0x66, 0x3F, 0xCD, 0x97, 0xA9, 0x26, 0xB8, 0x6A, 0xAC, 0xCD, 0x57, 0x0A, 0xC4, 0x59,
-    0x1F, 0x38, 0x2B, 0xA6, 0xFA, 0xF5, 0x98, 0x50, 0xEB, 0x63, 0x61, 0xEE, 0x2C, 0x98, 0xE6, 0xE9,
-    0xD6, 0x8F, 0x24, 0xFB, 0x56, 0x48, 0x7C, 0x44, 0x5F, 0x56, 0xBA, 0xEE, 0x7B, 0x3B, 0x37, 0x79,
-    0xB0, 0x35, 0xEC, 0x90, 0x34, 0x83, 0x89, 0x59, 0x4F, 0xBE, 0xA3, 0x63, 0x3C, 0x3A, 0x98, 0x77,
-    0xDC, 0x19, 0xCC, 0x0B, 0x70, 0xAB, 0x87, 0x7E, 0x3B, 0x98, 0x37, 0xDD, 0x0C, 0xE6, 0x7D, 0x68,
-    0x6B, 0x98, 0x04, 0x31, 0xAE, 0x49, 0xF7, 0x75, 0xD5, 0x6F, 0xD5, 0x12, 0x7B, 0x24, 0x59, 0x1A,
-    0xD7, 0xA6, 0xB7, 0xCB, 0x37, 0xB1, 0xAB, 0x57, 0xE0, 0x8A, 0xE7, 0x40, 0x4C, 0xAC, 0xA0, 0x07,
-    0x77, 0x1C, 0xC0, 0x79, 0xC3, 0xD9, 0x7F, 0x8C, 0x93, 0x7D, 0x79, 0x8A, 0xA9, 0xD5, 0x1B, 0x86,
-    0xF4, 0xD4, 0x1B, 0x91, 0xFD, 0x7F, 0xDB, 0xE4, 0x46, 0xCE, 0x83, 0x59, 0x62, 0xB1, 0x85, 0x74,
-    0x62, 0xF0, 0x93, 0x38, 0xFB, 0x0D, 0x27, 0xF3, 0xF9, 0xEE, 0x27, 0x59, 0xD7, 0x5C, 0xC9, 0xBA,
-    0x73, 0xBB, 0x7A, 0x79, 0xF7, 0x64, 0xBA, 0xFC, 0x4D, 0xC7, 0xBA, 0x15, 0x9C, 0xCC, 0x8D, 0x4B,
-    0x23, 0xB7, 0x87, 0xEF, 0x83, 0xC3, 0x4B, 0x3A, 0x99, 0xE9, 0x13, 0x4E, 0x46, 0x68, 0xDE, 0xC1,
-    0x61, 0x17, 0x94, 0x38, 0x22, 0x69, 0x7B, 0x9C, 0xAA, 0xA2, 0x79, 0x17, 0x2C, 0x8D, 0xBC, 0x81,
-    0x2D, 0x66, 0x8B, 0x79, 0x62, 0x96, 0x4D, 0x2D, 0x1E, 0x82, 0x63, 0x67, 0xF2, 0x6A, 0xFB, 0xF7,
-    0x5F, 0xF8, 0xC3, 0x89, 0x33, 0x1A, 0x41, 0xD8, 0x79, 0x1D, 0x48, 0x0C, 0x90, 0x0C, 0xEB, 0xF7,
-    0xF7, 0xF8, 0x07, 0x5A, 0xAC, 0x0E, 0xD3, 0x8C, 0x83, 0xAC, 0x3D, 0x58, 0x3D, 0xFA, 0x68, 0xA4,
-    0xEA, 0xDF, 0x72, 0xDB, 0x71, 0x35, 0xF5, 0xF0, 0x62, 0xC1, 0x57, 0x19, 0x49, 0xE1, 0x1F, 0xBD,
-    0x18, 0xE0, 0x78, 0x03, 0xA3, 0x6B, 0x52, 0xCB, 0x09, 0x2B, 0xD7, 0x80, 0x9E, 0xFC, 0xD7, 0xF1,
-    0xC8, 0x89, 0x59, 0x39, 0x4D, 0x44, 0x67, 0xDB, 0x59, 0xEC, 0xEF, 0x0B, 0x57, 0x57, 0xBE, 0xD8,
-    0xE9, 0xD8, 0x99, 0x67, 0x83, 0x4D, 0x09, 0xA2, 0x62, 0x5D, 0x79, 0xCD, 0x40, 0x80, 0x4D, 0x98,
-    0xB5, 0x9A, 0x23, 0x4D, 0xC9, 0x5C, 0x8E, 0x2A, 0x0E, 0x79, 0x49, 0x05, 0x10, 0xCC, 0x80, 0x0E,
-    0xF4, 0x63, 0x4B, 0xD9, 0x7D, 0xD7, 0xF8, 0xBC, 0x9D, 0xF5, 0x69, 0x25, 0x9B, 0xD6, 0x5D, 0xE0,
-    0xA5, 0xE0, 0xF8, 0x81, 0xE2, 0x7E, 0x32, 0x29, 0xB2, 0x77, 0x53, 0xB0, 0xE5, 0xC0, 0x6F, 0xEF,
-    0x17, 0x3B, 0x05, 0x44, 0x5B, 0x7D, 0xCD, 0x34, 0xAF, 0x9F, 0x08, 0x53, 0x29, 0x10, 0xC5, 0x4E,
-    0xAA, 0x4A, 0x41, 0x30, 0xFD, 0x1D, 0x0B, 0xBA, 0x0A, 0x6F, 0x32, 0x46, 0xC7, 0xFE, 0xC2, 0xE8,
-    0x03, 0x26, 0x74, 0x59, 0xE8, 0x14, 0xD9, 0x4C, 0xAF, 0xCA, 0x7B, 0x58, 0x82, 0x75, 0x8A, 0xDB,
-    0xAE, 0xB7, 0x00, 0xB5, 0x0D, 0x34, 0x5D, 0x47, 0xE3, 0x75, 0xAC, 0x0F, 0xD1, 0x57, 0x06, 0xF4,
-    0x9C, 0x6B, 0x51, 0x32, 0x50, 0x97, 0x5E, 0xED, 0xFC, 0xC1, 0x1F, 0xE9, 0x58, 0x60, 0x03, 0x6E,
-    0xC0, 0xC2, 0x34, 0x5A, 0x30, 0xCD, 0xD6, 0xD5, 0x4C, 0x75, 0x05, 0xAA, 0x58, 0x15, 0x0F, 0xF4,
-    0xD7, 0xA8, 0xBC, 0x54, 0x65, 0x70, 0xB4, 0x03, 0x09, 0x17, 0xB5, 0x56, 0x68, 0xCB, 0xA6, 0x1F,
-    0x9B, 0xA3, 0x1B, 0x78, 0x13, 0xBB, 0x24, 0xA8, 0xBB, 0xA4, 0xBF, 0xD8, 0xA3, 0xB1, 0x15, 0x36,
-    0x86, 0xA0, 0xD8, 0x26, 0x29, 0xBE, 0xCB, 0x4E, 0xCC, 0x09, 0x9E, 0x85, 0x64, 0xEC, 0x3E, 0xF1,
-    0xFA, 0x5D, 0xD0, 0xE8, 0xD8, 0xE9, 0x33, 0xDE, 0xBF, 0x63, 0x65, 0x09, 0xCC, 0x0F, 0x74, 0xFE,
-    0xB2, 0x67, 0xD9, 0xC5, 0xDC, 0x2F, 0xFA, 0xBB, 0xF9, 0x23, 0x24, 0xC1, 0xE2, 0xD9, 0x13, 0x99,
-    0x75, 0xAD, 0xC1, 0x7D, 0x06, 0x9A, 0x63, 0xEF, 0x7A, 0x30, 0x44, 0xF8, 0xEC, 0xE3, 0xB3, 0x9F,
-    0xB6, 0x98, 0x2C, 0xCA, 0x17, 0x0E, 0x56, 0xE9, 0x64, 0xE7, 0xE6, 0xEC, 0xCF, 0x17, 0x71, 0x76,
-    0x4F, 0x27, 0x3D, 0xA6, 0x09, 0x4B, 0xEC, 0xBF, 0x15, 0xC9, 0xD4, 0x80, 0x6B, 0xF9, 0xF1, 0xC4,
-    0xCD, 0x51, 0x0A, 0xEB, 0x3C, 0xCF, 0xB7, 0xD1, 0x6E, 0x0D, 0xB9, 0x20, 0x86, 0x3B, 0xD0, 0xBB,
-    0xC7, 0xF9, 0xA8, 0x7D, 0xCD, 0xD1, 0xBA, 0x7E, 0xCD, 0x4C, 0x17, 0x65, 0xD9, 0x0E, 0x75, 0x9B,
-    0xF3, 0xF8, 0x5C, 0x07, 0x4B, 0xC3, 0x11, 0xA2, 0xA9, 0xA2, 0xEE, 0xDA, 0x7A, 0x41, 0x34, 0xC6,
-    0xA7, 0x14, 0x6C, 0xA3, 0xDA, 0x2B, 0xAF, 0xF5, 0xA4, 0x1B, 0xD3, 0xF0, 0xEE, 0x8A, 0x3B, 0xCB,
-    0x4A, 0x58, 0xFE, 0x75, 0x8D, 0x26, 0xEE, 0x25, 0xE5, 0xFE, 0x4F, 0x2B, 0x6D, 0xFF, 0x14, 0xD3,
-    0x67, 0xF5, 0x47, 0x44, 0xA6, 0x57, 0x2D, 0x48, 0xE8, 0xD4, 0xF4, 0xBA, 0x53, 0xF4, 0xFB, 0xC0,
-    0x5F, 0xDE, 0xF0, 0xAD, 0xBA, 0x9F, 0x54, 0x2C, 0xEE, 0xFF, 0xE4, 0xD3, 0x3C, 0x2A, 0x8F, 0x5E,
-    0xCD, 0x61, 0x16, 0xC8, 0x42, 0x74, 0xF6, 0x87, 0x21, 0x9C, 0xE5, 0x90, 0x29, 0xDA, 0xA5, 0xED,
-    0xC9, 0x57, 0x29, 0xBF, 0x26, 0x81, 0x62, 0xCD, 0x08, 0xEB, 0x5E, 0x55, 0xD6, 0x12, 0xBD, 0xD8,
-    0xDE, 0x5F, 0x73, 0xFD, 0x0F, 0x65, 0xC4, 0xB3, 0xA0, 0x96, 0x77, 0x8F, 0x84, 0xB6, 0x82, 0xD5,
-    0x51, 0x1D, 0x65, 0x93, 0xBF, 0x2A, 0xE2, 0xFD, 0xC9, 0x8E, 0x4B, 0x21, 0x37, 0x0D, 0x98, 0x82,
-    0x9F, 0xAC, 0xC1, 0x28, 0x4E, 0x25, 0xA8, 0xF4, 0x67, 0x33, 0xD8, 0xBF, 0x93, 0x2C, 0x10, 0x1A,
-    0x99, 0xFB, 0x62, 0xE8, 0x07, 0xFA, 0xFF, 0xCD, 0x69, 0xE1, 0x34, 0xA4, 0x46, 0x83, 0x63, 0x42,
-    0x4E, 0x9A, 0xA3, 0x77, 0x1E, 0x6E, 0xE6, 0x7C, 0x7D, 0x16, 0xAD, 0x0C, 0xB7, 0x4F, 0x6B, 0xF2,
-    0xFD, 0xD2, 0x06, 0x68, 0x14, 0x36, 0x93, 0x71, 0xF7, 0xF3, 0xFF, 0x44, 0x95, 0x8E, 0x95, 0x0D,
-    0x66, 0xD9, 0xFC, 0xE5, 0xAE, 0xDF, 0xBA, 0xD9, 0x01, 0x37, 0x8E, 0x7C, 0x31, 0x55, 0xEC, 0x76,
-    0x0B, 0xA9, 0x9A, 0xE0, 0x4B, 0x9A, 0x00, 0x51, 0x69, 0x7E, 0x52, 0xDC, 0x6F, 0x07, 0x21, 0x7C,
-    0x5E, 0x35, 0x33, 0x7F, 0xC1, 0x9A, 0x19, 0xD7, 0x7F, 0x8A, 0x9A, 0x19, 0xA6, 0x92, 0x7C, 0x8B,
-    0xAC, 0xA9, 0xB8, 0x64, 0xE3, 0xEF, 0x69, 0x62, 0x15, 0x53, 0x56, 0x2B, 0xFE, 0xB9, 0x10, 0x25,
-    0xED, 0xA2, 0x7B, 0xA3, 0x37, 0x1C, 0xA9, 0x6F, 0x47, 0xB4, 0x08, 0x63, 0xAA, 0x76, 0x7B, 0xBE,
-    0x76, 0x8F, 0x84, 0x3E, 0x75, 0x78, 0x31, 0xEE, 0x20, 0x65, 0x04, 0x03, 0xD1, 0x60, 0x79, 0x31,
-    0x1F, 0xE5, 0x30, 0xAA, 0x7F, 0xC1, 0xCA, 0x9F, 0x33, 0x3F, 0x2C, 0x6A, 0x8E, 0x47, 0x3F, 0x30,
-    0xF9, 0x9F, 0x5E, 0x71, 0xF1, 0x49, 0x93, 0xFF, 0xCF, 0x38, 0x9C, 0xC4, 0x52, 0xC1, 0x81, 0x68,
-    0x1E, 0x54, 0x82, 0x55, 0xBD, 0xE0, 0x38, 0x64, 0x3D, 0x7D, 0x5B, 0x90, 0x47, 0xFD, 0x31, 0xF3,
-    0xE4, 0x7F, 0x46, 0x8F, 0xA5, 0x84, 0x99, 0x34, 0x3A, 0x32, 0xF9, 0xFF, 0xA1, 0x5B, 0x1D, 0x6C,
-    0xAB, 0x8F, 0x3A, 0xF7, 0xAA, 0xFE, 0x02, 0x85, 0x7C, 0xED, 0xE3, 0xA5, 0xFB, 0xD1, 0x76, 0xAB,
-    0x0B, 0x8E, 0xEC, 0x61, 0x6B, 0x32, 0x96, 0x69, 0x1D, 0xB8, 0xC5, 0xFF, 0x01, 0xB5, 0x58, 0x3F,
-    0x8C, 0x16, 0xC7, 0x15, 0x7F, 0xBB, 0xCB, 0xDD, 0x8A, 0x5B, 0x59, 0x43, 0x01, 0x4A, 0x02, 0x51,
-    0xD6, 0x65, 0x72, 0xC2, 0x6C, 0x8A, 0x14, 0x14, 0x81, 0x59, 0xE7, 0x0A, 0x4B, 0x89, 0x14, 0x5F,
-    0x01, 0x35, 0x8D, 0x0B, 0x42, 0x11, 0x52, 0x52, 0xA0, 0xEC, 0x62, 0x8A, 0x14, 0x29, 0x72, 0x8A,
-    0x92, 0xB4, 0x26, 0x12, 0x05, 0xBE, 0xC2, 0x34, 0x91, 0x82, 0x2C, 0xE3, 0x5D, 0x38, 0x29, 0x14,
-    0x2E, 0x58, 0xE7, 0x8A, 0x48, 0x71, 0xC1, 0x2A, 0x24, 0x8A, 0x14, 0x0A, 0x06, 0x58, 0xC2, 0xDA,
-    0xCC, 0xEC, 0xCB, 0xEF, 0xCD, 0x7C, 0x1F, 0xF7, 0xE1, 0x60, 0x73, 0x96, 0x92, 0x9D, 0x9B, 0x6F,
-    0x77, 0xE7, 0xCF, 0xFB, 0x37, 0xEF, 0xFD, 0xDE, 0xDB, 0x23, 0x8A, 0x6A, 0xEA, 0xCF, 0x5C, 0x7B,
-    0xFF, 0xDA, 0xA5, 0xFE, 0xF7, 0xF5, 0x25, 0x7A, 0x79, 0x23, 0x8A, 0xCB, 0x8C, 0x8E, 0xBC, 0x7B,
-    0xE4, 0xBD, 0x6C, 0x25, 0xFE, 0x21, 0xAD, 0xBC, 0xBC, 0xAD, 0x6E, 0xBE, 0xC9, 0x77, 0xF9, 0x31,
-    0xDB, 0x67, 0x0F, 0x15, 0xF3, 0xBF, 0x99, 0xF9, 0x36, 0xFA, 0x81, 0x93, 0x27, 0x4F, 0x1C, 0xDC,
-    0xDC, 0xBC, 0xC8, 0x6C, 0x35, 0xF3, 0x2D, 0xE6, 0x11, 0x6F, 0xB8, 0xAE, 0xE0, 0x8D, 0xC3, 0xA0,
-    0xDC, 0x2A, 0x7F, 0xFB, 0xD2, 0x39, 0x48, 0x56, 0xD1, 0xF5, 0xFF, 0xF9, 0xDF, 0x2A, 0x9D, 0x5E,
-    0x3A, 0x79, 0x72, 0x9D, 0x79, 0x5A, 0xD9, 0xDC, 0xDC, 0x00, 0x13, 0x48, 0xBC, 0xC6, 0xA2, 0xCC,
-    0x66, 0x49, 0xD7, 0x23, 0x9B, 0x8C, 0xD9, 0xA0, 0x4C, 0xD1, 0xEB, 0xF6, 0x40, 0x19, 0xBB, 0xC4,
-    0x66, 0xA3, 0x32, 0x79, 0x57, 0xB4, 0xBA, 0x3C, 0x40, 0xD1, 0x89, 0xC4, 0xA5, 0x56, 0x0D, 0xAA,
-    0xC7, 0x7B, 0x7D, 0x9C, 0x9A, 0xE2, 0xA3, 0x07, 0xB6, 0x52, 0x5B, 0x66, 0x3F, 0x5D, 0x4F, 0xFB,
-    0xBC, 0x75, 0xC9, 0x58, 0xB4, 0x4D, 0x82, 0x1D, 0x1C, 0xBB, 0xDC, 0xE8, 0x2D, 0x17, 0x9D, 0x10,
-    0x2A, 0x79, 0x8F, 0xC7, 0x6C, 0xD0, 0x2D, 0x67, 0x43, 0xDE, 0x71, 0x6C, 0xF3, 0x56, 0x27, 0x63,
-    0xB4, 0x2E, 0x14, 0x97, 0xD6, 0xF5, 0xCD, 0x29, 0x1D, 0x31, 0x97, 0x8E, 0xAA, 0xC7, 0x9C, 0xEA,
-    0xF5, 0xDB, 0x36, 0xE9, 0x8B, 0x92, 0xB3, 0x47, 0xB6, 0xF8, 0xC4, 0x54, 0xA7, 0x6E, 0xB8, 0x2A,
-    0x19, 0xAC, 0xDA, 0x1E, 0x8A, 0x0B, 0xE5, 0x7E, 0x48, 0x4C, 0x89, 0x25, 0x9A, 0x88, 0x74, 0x49,
-    0xAA, 0xA5, 0xA4, 0x8F, 0x7E, 0xFB, 0xE9, 0xE9, 0x86, 0x27, 0x98, 0xEF, 0xC7, 0x57, 0xFF, 0xDA,
-    0x26, 0x3D, 0x45, 0x03, 0xD1, 0x07, 0x98, 0x27, 0x99, 0x4F, 0x0D, 0x25, 0x30, 0xA6, 0x83, 0x39,
-    0x4B, 0x2A, 0x5A, 0x52, 0x46, 0xF6, 0x47, 0x13, 0xCD, 0xAE, 0xA6, 0x44, 0x27, 0x4F, 0x90, 0xAC,
-    0xEF, 0x31, 0xCC, 0x21, 0x3D, 0x91, 0x53, 0x48, 0x0C, 0xF9, 0x9E, 0xA1, 0x2B, 0xE9, 0x1D, 0x2D,
-    0xA9, 0x1B, 0x65, 0xCE, 0xDC, 0x16, 0xE8, 0x9A, 0x9B, 0x9A, 0x0A, 0xF2, 0xCC, 0x70, 0x5E, 0x44,
-    0x3C, 0xEB, 0x78, 0xEB, 0x72, 0x5E, 0x93, 0x53, 0xDD, 0x92, 0x9F, 0x9B, 0x6C, 0x15, 0x53, 0x51,
-    0x63, 0xE2, 0x12, 0xA9, 0x1A, 0xEC, 0x94, 0x8D, 0xD8, 0x14, 0x98, 0x1D, 0xF4, 0x90, 0x0E, 0xF4,
-    0x07, 0xDA, 0x43, 0xB4, 0xBC, 0xE6, 0xAA, 0x7B, 0xAE, 0x6A, 0xD7, 0x97, 0x68, 0x69, 0xCD, 0xC6,
-    0x53, 0xD3, 0xE9, 0xA7, 0x36, 0x9D, 0xAA, 0x5A, 0xB7, 0x25, 0xC9, 0x20, 0x2D, 0x25, 0x56, 0x5A,
-    0xD3, 0xA1, 0x7D, 0x62, 0x33, 0xAB, 0x6C, 0x55, 0x4B, 0x2B, 0x09, 0x0D, 0x93, 0xCD, 0x1D, 0x0C,
-    0x94, 0x67, 0xAE, 0xBC, 0x7F, 0x65, 0x37, 0xDE, 0x2F, 0x6D, 0xF5, 0xDD, 0xD5, 0xF7, 0x76, 0xE3,
-    0xF7, 0xBE, 0x51, 0xE5, 0x76, 0x5A, 0x5C, 0xBF, 0xBC, 0xC9, 0x8E, 0x9F, 0x51, 0x68, 0xBB, 0xDF,
-    0x41, 0xAF, 0x84, 0xB6, 0xDB, 0x1D, 0xB3, 0x2B, 0xC3, 0xC1, 0x4A, 0xE0, 0x24, 0x6C, 0xFC, 0x81,
-    0x10, 0x73, 0x89, 0x03, 0x23, 0xCA, 0xB7, 0xC7, 0x58, 0x26, 0x62, 0xAB, 0x6B, 0x39, 0x25, 0xD2,
-    0x17, 0x47, 0xF8, 0x06, 0x56, 0x0E, 0xFA, 0xE2, 0xE0, 0x4F, 0x2B, 0x1D, 0x3E, 0x94, 0x7B, 0x6A,
-    0x9A, 0xFC, 0x4F, 0x23, 0x1D, 0xDA, 0xA8, 0x4E, 0xDD, 0x7D, 0xC8, 0x46, 0xF1, 0x45, 0xB6, 0xAE,
-    0x92, 0xDF, 0x82, 0xCF, 0xFE, 0xEA, 0x91, 0xAD, 0xDE, 0xE9, 0xAA, 0x5F, 0x3C, 0x70, 0xC5, 0x6D,
-    0x03, 0x8F, 0x72, 0xC5, 0x4D, 0xEB, 0xC0, 0x00, 0xD4, 0xF4, 0x9D, 0xD6, 0xC1, 0x49, 0xF4, 0xDA,
-    0xA7, 0xF0, 0x6E, 0x84, 0xD1, 0x50, 0x9D, 0xBD, 0x69, 0xE1, 0xA2, 0xFA, 0x47, 0x0F, 0xC1, 0x53,
-    0xF5, 0x09, 0xBB, 0x9C, 0x4D, 0x6C, 0xA9, 0xE0, 0x9A, 0x9D, 0xB8, 0x4A, 0x83, 0xB1, 0x32, 0xC8,
-    0x1D, 0xD1, 0x73, 0x57, 0x61, 0x28, 0xED, 0xC3, 0xA3, 0x66, 0xEF, 0x7D, 0xE1, 0xB1, 0x4B, 0x86,
-    0xF0, 0x38, 0x57, 0x47, 0x54, 0x36, 0x53, 0x64, 0xC3, 0x63, 0x32, 0xEA, 0x7A, 0xF6, 0x48, 0x4E,
-    0xF5, 0x6E, 0xF6, 0x38, 0xD7, 0x4C, 0xF6, 0xDD, 0xB4, 0xD5, 0xA1, 0x9E, 0x7E, 0x5A, 0xC6, 0x63,
-    0xFA, 0x78, 0xD2, 0x05, 0x13, 0x8F, 0x29, 0xB7, 0xCC, 0xFA, 0x14, 0xF7, 0xCC, 0x29, 0x8F, 0x73,
-    0x25, 0xB7, 0x5D, 0x13, 0x4D, 0xF9, 0xAD, 0xA1, 0xD1, 0x5B, 0x8F, 0x5D, 0x8E, 0xA8, 0xF9, 0xB3,
-    0x2D, 0x6E, 0x77, 0xAE, 0x41, 0x18, 0xA8, 0x7E, 0x52, 0x4F, 0x8C, 0xAE, 0xA0, 0xDE, 0x4C, 0xDF,
-    0xDB, 0xFD, 0x04, 0xBB, 0xA9, 0x8F, 0x31, 0xFD, 0x68, 0xD4, 0x65, 0x32, 0x24, 0x43, 0x53, 0x6C,
-    0x8D, 0x53, 0xD1, 0x22, 0xF2, 0x98, 0xDF, 0x10, 0xFF, 0xEF, 0xE7, 0xAA, 0xA7, 0x6C, 0x22, 0x89,
-    0xB1, 0x5A, 0x39, 0x98, 0x60, 0x26, 0xD8, 0xBE, 0xA0, 0x61, 0x0D, 0xF2, 0x8E, 0x74, 0x9B, 0xCA,
-    0x2D, 0xAF, 0x63, 0xC0, 0xB3, 0xBE, 0x80, 0x65, 0x08, 0x58, 0x97, 0x9A, 0xC4, 0xAA, 0x2E, 0x35,
-    0x45, 0xAB, 0x3A, 0x8D, 0x49, 0x47, 0xAB, 0x74, 0xC5, 0xCF, 0x67, 0x30, 0xAB, 0x32, 0x30, 0x72,
-    0x57, 0x61, 0x21, 0x27, 0x43, 0xDE, 0xCA, 0xB2, 0x09, 0xD6, 0xB7, 0xA9, 0x89, 0x46, 0x59, 0xBF,
-    0x52, 0xAF, 0x46, 0x97, 0x81, 0x00, 0xBA, 0xCE, 0x5B, 0xD5, 0x83, 0xD6, 0x40, 0x23, 0x5D, 0xA9,
-    0x7E, 0x00, 0xBC, 0xCB, 0xBB, 0xBC, 0x65, 0x9A, 0x12, 0x83, 0x4D, 0x35, 0xB6, 0xD0, 0x98, 0x75,
-    0x58, 0x8E, 0x39, 0xD5, 0xAB, 0x1E, 0xB7, 0xC8, 0x53, 0x87, 0x6D, 0x53, 0xBF, 0xC4, 0x91, 0x4B,
-    0x0C, 0xA8, 0xD4, 0xD7, 0x13, 0x13, 0x5F, 0x5A, 0xA9, 0xBF, 0x23, 0xC7, 0xF7, 0x7D, 0x01, 0x1D,
-    0xD5, 0xD3, 0x1F, 0xDB, 0xF4, 0x23, 0x3A, 0xF6, 0x5A, 0xDC, 0x9F, 0x53, 0xD4, 0x0F, 0x49, 0x0B,
-    0xCD, 0xF2, 0x12, 0x88, 0x39, 0x2A, 0x44, 0x6A, 0x66, 0x93, 0x89, 0xAA, 0x56, 0x0D, 0x31, 0x43,
-    0xC9, 0xAC, 0x47, 0xC8, 0xD2, 0x3A, 0x8C, 0xD1, 0xD4, 0xB9, 0x49, 0xA0, 0x26, 0x66, 0x32, 0x9B,
-    0xBA, 0xD4, 0x25, 0x53, 0x3C, 0x01, 0x55, 0xBC, 0x5B, 0x44, 0xA5, 0x74, 0x18, 0xA6, 0x4E, 0x3B,
-    0x35, 0xC6, 0x06, 0xC4, 0x86, 0x6C, 0x4C, 0x1C, 0x20, 0xB2, 0x27, 0x38, 0x10, 0xF0, 0x47, 0x77,
-    0x58, 0x4E, 0x32, 0x0C, 0x27, 0x70, 0x18, 0x5E, 0x82, 0xD5, 0xEB, 0x13, 0x00, 0xE9, 0x29, 0x72,
-    0xBA, 0x53, 0x60, 0xAB, 0xBB, 0xC2, 0xC5, 0x53, 0x56, 0x36, 0x5C, 0x5E, 0xA3, 0x18, 0xAF, 0xF0,
-    0x9C, 0x51, 0xC1, 0x9D, 0x8A, 0x1E, 0x9C, 0x85, 0x08, 0x97, 0xF1, 0x14, 0x95, 0xBA, 0xCB, 0x24,
-    0x01, 0x0C, 0x59, 0xAF, 0xC6, 0x64, 0x88, 0x6B, 0x2C, 0xC1, 0xD2, 0x58, 0x62, 0xA8, 0x69, 0x21,
-    0x20, 0xB4, 0x20, 0x9C, 0x62, 0x2D, 0x52, 0x44, 0x1C, 0x01, 0xD1, 0x4C, 0x61, 0x62, 0x11, 0x57,
-    0x77, 0xBA, 0x13, 0x64, 0x82, 0x66, 0x38, 0xC0, 0x31, 0x1D, 0x81, 0xAC, 0x4D, 0xA9, 0x0C, 0x24,
-    0xE7, 0x19, 0x22, 0xFA, 0x4B, 0x40, 0xCC, 0xAF, 0x13, 0x08, 0xCB, 0x5C, 0x86, 0x58, 0x00, 0x7C,
-    0x09, 0x7A, 0x05, 0x38, 0x1E, 0x01, 0xBB, 0x1D, 0xD0, 0xB7, 0x70, 0xBC, 0xC4, 0x45, 0xA7, 0x7F,
-    0x39, 0xA8, 0x6D, 0x9B, 0x3C, 0x99, 0x22, 0x9E, 0xA8, 0x81, 0x55, 0x1C, 0x80, 0x73, 0x9E, 0x01,
-    0x66, 0xD1, 0x53, 0xCA, 0x7B, 0x2C, 0xB6, 0xE8, 0x28, 0x87, 0x4B, 0xCD, 0xA2, 0xAA, 0x61, 0xA0,
-    0x2E, 0xB3, 0x0A, 0xC9, 0x14, 0xF8, 0x43, 0xDF, 0xFC, 0x1E, 0xD1, 0x51, 0x1C, 0x95, 0x51, 0xE5,
-    0xA1, 0x36, 0x05, 0x41, 0x6A, 0xFE, 0x3E, 0x0B, 0xB9, 0x89, 0x22, 0xC0, 0x79, 0xDA, 0x45, 0xE6,
-    0x5B, 0x44, 0xE7, 0x8E, 0x12, 0x1D, 0xFE, 0x2E, 0xD1, 0xD7, 0x67, 0x1C, 0x2E, 0x03, 0x17, 0x80,
-    0x16, 0xC7, 0x60, 0x09, 0x49, 0x01, 0x18, 0x19, 0x77, 0x46, 0xC0, 0x30, 0x0F, 0x23, 0x38, 0x51,
-    0x1C, 0x2F, 0x25, 0x77, 0x40, 0xEF, 0x35, 0x22, 0x73, 0x8E, 0xD4, 0x05, 0x43, 0xE7, 0x93, 0x36,
-    0xE9, 0xD4, 0xF3, 0x11, 0xEE, 0x41, 0xC9, 0xC3, 0xCF, 0x6C, 0x20, 0xC4, 0x6D, 0xDC, 0xFF, 0x3C,
-    0xBC, 0xF2, 0xD5, 0xA0, 0x43, 0xC5, 0xF7, 0xBC, 0xEC, 0x51, 0xC3, 0x21, 0x9C, 0x53, 0x0E, 0x98,
-    0x91, 0xF2, 0x8D, 0x70, 0x7F, 0x1A, 0xD0, 0x21, 0xB5, 0xB3, 0x18, 0xFF, 0x20, 0x17, 0x58, 0xA3,
-    0x0F, 0x97, 0x90, 0x86, 0x7B, 0x09, 0x29, 0xDA, 0x00, 0x93, 0x7D, 0x9E, 0xA1, 0xA5, 0x7C, 0xCD,
-    0x80, 0x89, 0xA6, 0xCC, 0x81, 0x2C, 0xBF, 0x53, 0xC2, 0xD6, 0x57, 0x91, 0xC3, 0xFE, 0x35, 0x66,
-    0x8C, 0xB0, 0x44, 0x12, 0x05, 0xCA, 0xC0, 0xBA, 0x60, 0xA2, 0xED, 0x01, 0xCF, 0x44, 0xDF, 0xAF,
-    0xC1, 0x64, 0x20, 0xBD, 0x0D, 0x50, 0xB2, 0x15, 0x80, 0x09, 0x56, 0xBB, 0x0E, 0x72, 0xAF, 0x22,
-    0x97, 0x2E, 0x4B, 0x66, 0x5D, 0x16, 0x41, 0x36, 0x50, 0x47, 0xBC, 0xC9, 0xDB, 0x3C, 0xF0, 0x0C,
-    0x81, 0x3C, 0x28, 0x79, 0xF5, 0x44, 0x0C, 0x49, 0xBC, 0x21, 0x3F, 0x4A, 0x22, 0xF6, 0x09, 0xD9,
-    0x67, 0x54, 0xF2, 0xD2, 0xEA, 0x72, 0x96, 0x7F, 0x63, 0xEB, 0x11, 0x78, 0x6E, 0x20, 0x2D, 0xC8,
-    0xDE, 0x3C, 0x47, 0x4C, 0x4C, 0x3C, 0xDB, 0x14, 0x0C, 0xC9, 0x65, 0xCA, 0x5D, 0xCC, 0xE2, 0x64,
-    0xB2, 0x1E, 0xFB, 0xB0, 0x5F, 0xE8, 0x84, 0xF7, 0xBC, 0xA3, 0xEC, 0xB3, 0xDA, 0xCF, 0x8F, 0xA4,
-    0x7F, 0xE3, 0xDF, 0xCD, 0x42, 0x01, 0x01, 0x52, 0xF2, 0xEE, 0xD6, 0x65, 0x1E, 0x79, 0xE7, 0xE0,
-    0xA6, 0x08, 0xCB, 0xA0, 0xDB, 0x26, 0xDC, 0x13, 0xF2, 0x72, 0xE4, 0xBC, 0x0C, 0xBA, 0x15, 0x45,
-    0xE4, 0xDD, 0xCA, 0xFB, 0x4A, 0x23, 0xF3, 0x11, 0x0F, 0xF4, 0xB5, 0x67, 0xBC, 0x84, 0xF7, 0xB0,
-    0xC3, 0x3B, 0x3A, 0xEB, 0xE5, 0x6A, 0x2C, 0x32, 0xEC, 0x0E, 0xB4, 0x4F, 0x74, 0x88, 0x6B, 0x2D,
-    0xC9, 0x80, 0x61, 0xE6, 0x07, 0xF0, 0xCD, 0xE2, 0x77, 0xAC, 0xFE, 0xC1, 0x37, 0x10, 0x52, 0xEB,
-    0x22, 0x17, 0xCE, 0x17, 0xBC, 0x72, 0x23, 0xC9, 0x2C, 0x9B, 0xC4, 0xAD, 0x13, 0x46, 0x74, 0xF6,
-    0xF2, 0x57, 0xE1, 0x1C, 0x06, 0xF1, 0x7F, 0xCC, 0x49, 0xC8, 0xF3, 0x82, 0x5C, 0xCF, 0x5F, 0xEB,
-    0x44, 0xFB, 0x69, 0x4E, 0xC8, 0xE1, 0x44, 0x25, 0x7E, 0x49, 0xE3, 0x0C, 0x47, 0x8A, 0xA1, 0xD1,
-    0x1E, 0x09, 0xC4, 0x67, 0x25, 0x10, 0x4C, 0x73, 0x17, 0x51, 0x97, 0x8F, 0x88, 0xBB, 0xD4, 0x42,
-    0xA0, 0x98, 0x97, 0x11, 0xD0, 0xE0, 0xAB, 0x06, 0x40, 0x05, 0x6A, 0x3E, 0x50, 0x99, 0x52, 0x4B,
-    0x4A, 0x22, 0x5D, 0x21, 0x10, 0x4B, 0x25, 0x38, 0x0D, 0x31, 0x14, 0x60, 0x59, 0xCE, 0x73, 0xF2,
-    0x86, 0xA2, 0x85, 0x98, 0x8C, 0x4A, 0xCC, 0xA4, 0xD6, 0x2B, 0x20, 0xCC, 0xB9, 0x45, 0x6C, 0x82,
-    0x5A, 0xE9, 0x21, 0x2D, 0xF8, 0x3B, 0x8B, 0xCD, 0x15, 0x52, 0x2B, 0x1C, 0x0F, 0x09, 0x08, 0xD8,
-    0xF2, 0xBA, 0x3B, 0x3B, 0x62, 0x13, 0x70, 0x09, 0x59, 0x10, 0xB8, 0x04, 0x64, 0x02, 0xD6, 0x49,
-    0xF5, 0x66, 0x44, 0x08, 0x01, 0x4E, 0x6A, 0x0C, 0xCA, 0x37, 0x68, 0x95, 0x0D, 0xF2, 0xA6, 0x5B,
-    0x51, 0x88, 0x7D, 0x75, 0xB6, 0x70, 0xED, 0xA7, 0x68, 0x5D, 0x0E, 0x1A, 0x1C, 0x0B, 0x40, 0x55,
-    0x0D, 0x70, 0x48, 0x9D, 0xD4, 0x7D, 0xB2, 0xAE, 0xF4, 0xDA, 0xA3, 0x62, 0xB4, 0x00, 0x88, 0x47,
-    0xE8, 0xAD, 0xB7, 0x8A, 0xB8, 0x2A, 0xCE, 0x1A, 0x36, 0x12, 0xC2, 0x7E, 0xC4, 0xF8, 0x13, 0x99,
-    0x8F, 0x4C, 0xCF, 0x46, 0x42, 0x46, 0x96, 0xA3, 0x44, 0xFD, 0xD6, 0xB0, 0x3D, 0x96, 0xB3, 0x43,
-    0x9F, 0xD0, 0xF9, 0x05, 0x5D, 0xC6, 0x65, 0xCD, 0x88, 0xDE, 0x1D, 0xCB, 0xF7, 0xD3, 0x31, 0x60,
-    0xC6, 0x6E, 0xFA, 0xB7, 0x0F, 0x7A, 0x24, 0x9B, 0x10, 0xF8, 0x13, 0x48, 0xA1, 0xCA, 0x1D, 0x8F,
-    0x4B, 0xAF, 0x5E, 0xD0, 0xE7, 0x73, 0xB2, 0x4E, 0xD6, 0xD3, 0x59, 0x76, 0x0C, 0xE0, 0x10, 0xFD,
-    0xD0, 0xCD, 0x88, 0x49, 0x74, 0xFB, 0x25, 0x7D, 0x94, 0x75, 0xE8, 0x5D, 0xC3, 0x9F, 0xEE, 0x40,
-    0x55, 0x45, 0x7B, 0xE0, 0xF6, 0xC7, 0xB3, 0x0E, 0xC0, 0x04, 0x54, 0x98, 0x9A, 0xD7, 0x05, 0x8F,
-    0x2A, 0x36, 0x19, 0x5F, 0x28, 0x9B, 0x0A, 0xA9, 0x04, 0xA7, 0x88, 0x7A, 0x60, 0xAF, 0xC4, 0xE8,
-    0xDE, 0x50, 0x8B, 0x48, 0x69, 0x8A, 0x7C, 0xB5, 0xF1, 0xBC, 0x5F, 0x9E, 0xF4, 0xC9, 0x00, 0xFE,
-    0x80, 0x56, 0xD1, 0xF1, 0x85, 0xB0, 0xF0, 0xF8, 0x4B, 0x02, 0xC0, 0x24, 0x08, 0x4C, 0x02, 0xC1,
-    0xB4, 0x80, 0xC1, 0xFF, 0x87, 0x4B, 0x32, 0x02, 0x49, 0x4A, 0x90, 0xF4, 0x8D, 0xC2, 0x06, 0x49,
-    0x81, 0x7C, 0x56, 0x78, 0x96, 0x16, 0x66, 0x78, 0x25, 0x36, 0x90, 0xB8, 0xBF, 0x96, 0x23, 0x22,
-    0x3E, 0x1B, 0x44, 0xD4, 0xAB, 0x9D, 0xC7, 0x64, 0x3C, 0x75, 0x54, 0x8D, 0xFB, 0xA9, 0xB8, 0xDF,
-    0x06, 0x10, 0x2E, 0x04, 0xBF, 0xD6, 0x05, 0xD2, 0xE2, 0x72, 0x01, 0xE4, 0xAB, 0x80, 0x6C, 0x89,
-    0x20, 0xBC, 0xBE, 0xE7, 0xF9, 0x34, 0xE5, 0x32, 0x9C, 0xC7, 0x43, 0x7A, 0xC4, 0xFD, 0x3A, 0x35,
-    0x70, 0xBD, 0xE2, 0xE1, 0x18, 0x30, 0x3C, 0x2E, 0x85, 0xF1, 0xDE, 0x50, 0xB6, 0x75, 0xF9, 0x6D,
-    0xAB, 0xEE, 0xA2, 0xB2, 0x69, 0xDE, 0xB6, 0xCB, 0x32, 0x51, 0x05, 0x70, 0x0B, 0xE0, 0x15, 0x30,
-    0x67, 0x9A, 0x8F, 0xAA, 0x00, 0x71, 0xC3, 0x52, 0x64, 0x73, 0x33, 0x65, 0xB6, 0x8A, 0x59, 0x3E,
-    0xD7, 0x76, 0x8A, 0x4C, 0x64, 0x52, 0x9C, 0xCA, 0x79, 0xE4, 0x45, 0xDE, 0x88, 0x10, 0x7B, 0x72,
-    0x0D, 0xBA, 0x3C, 0x88, 0x5B, 0x7F, 0x1E, 0x78, 0x3E, 0x4B, 0x31, 0x08, 0x1F, 0xDF, 0x2B, 0xA9,
-    0x0C, 0xCE, 0x76, 0x59, 0x4D, 0x06, 0x49, 0xED, 0x28, 0xEC, 0x75, 0xF8, 0x55, 0x01, 0x10, 0xF9,
-    0xD0, 0x4A, 0xFA, 0x32, 0xDD, 0xFA, 0x9B, 0x51, 0x4F, 0xEE, 0x0D, 0x92, 0xB6, 0xA5, 0xDE, 0x3E,
-    0xC3, 0xBC, 0x29, 0x9F, 0xB0, 0xD2, 0xE1, 0xB8, 0xF2, 0x35, 0xD5, 0x66, 0x4F, 0xEF, 0x9B, 0x6C,
-    0xFB, 0xAE, 0x89, 0xD7, 0x7A, 0xF9, 0x60, 0x0B, 0x45, 0x8D, 0x84, 0xA0, 0x84, 0x18, 0x40, 0x09,
-    0x65, 0x11, 0x15, 0xDD, 0xBC, 0x0C, 0x0C, 0x42, 0x5E, 0xF6, 0x11, 0x97, 0x8A, 0xB2, 0x1D, 0xCD,
-    0xAB, 0xDD, 0xC5, 0x0B, 0xDA, 0xCB, 0x3E, 0xD9, 0xEE, 0x7C, 0x16, 0x42, 0x15, 0x5E, 0xBD, 0x31,
-    0xA0, 0xC4, 0xDF, 0x92, 0x8A, 0xFB, 0x63, 0x87, 0x6A, 0x97, 0x18, 0x75, 0xB0, 0x54, 0x8D, 0x15,
-    0xEA, 0x64, 0xD2, 0x6B, 0x46, 0x4B, 0x41, 0x58, 0x5C, 0x1C, 0xA4, 0x22, 0xBC, 0xB2, 0x72, 0xE1,
-    0x32, 0xCD, 0x71, 0x50, 0x3E, 0x03, 0x3D, 0x3D, 0x9C, 0xB6, 0x67, 0x56, 0xF8, 0x14, 0xBD, 0xE7,
-    0x45, 0x7E, 0xF3, 0x13, 0xF4, 0x83, 0x82, 0xD5, 0x11, 0xE7, 0x38, 0xDB, 0xCC, 0x41, 0x42, 0x14,
-    0x42, 0x92, 0x81, 0x8B, 0xF2, 0x8B, 0x9C, 0x2D, 0x54, 0xE9, 0x81, 0xB6, 0xF6, 0x75, 0x6F, 0x30,
-    0xF3, 0x5B, 0x33, 0x11, 0xA2, 0x52, 0x8A, 0x24, 0x7D, 0xCB, 0x09, 0x2C, 0x9E, 0x12, 0xB2, 0x16,
-    0xFA, 0x7F, 0x1E, 0xD5, 0x16, 0xAF, 0x23, 0xB4, 0x23, 0xB2, 0xDD, 0x21, 0x7B, 0xE4, 0x0B, 0x37,
-    0x78, 0x2B, 0x3A, 0x2F, 0xB2, 0x0D, 0x22, 0x0B, 0xCB, 0xAA, 0x95, 0xFF, 0x82, 0x9C, 0x96, 0x2F,
-    0xCB, 0xEA, 0x2F, 0x4E, 0xB7, 0xEB, 0xFF, 0xBD, 0x11, 0x52, 0x55, 0xDB, 0x76, 0x39, 0x54, 0x42,
-    0x41, 0x07, 0x2D, 0x72, 0x01, 0x55, 0x69, 0xFE, 0xF5, 0xF1, 0xB9, 0x0B, 0xD9, 0x67, 0xC9, 0xA7,
-    0x33, 0xB0, 0xF3, 0xDC, 0x3C, 0x33, 0x4F, 0x7D, 0xDF, 0x0B, 0x37, 0xC8, 0x01, 0x48, 0x9A, 0x0A,
-    0xBA, 0x48, 0x81, 0x4A, 0xDF, 0x90, 0xF1, 0x65, 0x8F, 0x20, 0x3E, 0xEF, 0x5F, 0xCE, 0xFA, 0x95,
-    0x32, 0x71, 0x59, 0xAF, 0xBB, 0x74, 0xCA, 0xFA, 0xAA, 0x0F, 0xCF, 0xF1, 0x98, 0xF5, 0xF2, 0x61,
-    0xED, 0xD7, 0x2C, 0xFC, 0xFA, 0xFF, 0xA7, 0xB8, 0xC5, 0xDF, 0x59, 0xD1, 0xB1, 0xB0, 0x26, 0xC2,
-    0xDE, 0xDC, 0xD3, 0xAC, 0x02, 0xCD, 0x2E, 0x3C, 0x87, 0xF1, 0xF9, 0x4A, 0xFF, 0x35, 0x06, 0xC7,
-    0xFA, 0x27, 0x0A, 0xE7, 0xCB, 0x33, 0xC4, 0xDA, 0x9A, 0xF4, 0xA3, 0x69, 0x25, 0x44, 0x4A, 0x6C,
-    0x2B, 0x99, 0x7A, 0xEB, 0x40, 0x71, 0x1F, 0x8E, 0x5F, 0x46, 0xBF, 0x9E, 0x90, 0x55, 0x0C, 0xAD,
-    0x0A, 0xD7, 0x23, 0x14, 0x23, 0xB7, 0xF2, 0xC3, 0x4B, 0xB4, 0xF0, 0xFD, 0xFB, 0x15, 0xBE, 0x9D,
-    0x5F, 0x09, 0x6D, 0xB7, 0x3B, 0xB4, 0x2D, 0x46, 0x65, 0xD2, 0x2E, 0x69, 0x77, 0xB3, 0x5E, 0x76,
-    0x20, 0x4F, 0xA3, 0xEE, 0x55, 0xA6, 0x18, 0xB5, 0xDD, 0xDD, 0x8E, 0xB8, 0xCE, 0xFA, 0xA3, 0x87,
-    0x8F, 0x1E, 0xCE, 0xFA, 0xDD, 0x71, 0x81, 0x1E, 0xF5, 0x57, 0xD3, 0xFC, 0x3F, 0x5D, 0x54, 0xBD,
-    0x6F, 0x1C, 0x45, 0x14, 0x7F, 0x3B, 0x23, 0x79, 0xA4, 0xAC, 0xC4, 0xA4, 0x47, 0xCA, 0xD4, 0x08,
-    0xC5, 0xF3, 0x0F, 0xC4, 0x37, 0xEB, 0x9C, 0x44, 0x63, 0x09, 0xD2, 0x44, 0x14, 0x14, 0xF4, 0x50,
-    0xB8, 0x4D, 0x81, 0x6F, 0x36, 0xB8, 0x48, 0xE1, 0x82, 0x6B, 0x80, 0x32, 0x14, 0x2E, 0x12, 0x53,
-    0xB8, 0x49, 0x11, 0xA4, 0xCB, 0xCD, 0xC6, 0x2E, 0x5C, 0xB8, 0xD9, 0x04, 0x21, 0x97, 0x2C, 0x18,
-    0x89, 0xAF, 0xC2, 0x63, 0x6B, 0x4C, 0xC6, 0x62, 0x76, 0x1F, 0x6F, 0xCE, 0x46, 0x46, 0xEC, 0x5C,
-    0x71, 0x3B, 0xF3, 0x76, 0xDE, 0xFB, 0x7D, 0xBC, 0x07, 0xB6, 0x96, 0xD8, 0x38, 0x1C, 0xC7, 0x41,
-    0xEF, 0xA5, 0x41, 0x1E, 0x07, 0xF3, 0x45, 0xDB, 0x5B, 0xE1, 0x7B, 0xB3, 0x8F, 0x7D, 0x89, 0x5D,
-    0xD9, 0x03, 0x3D, 0xC5, 0xD4, 0xF0, 0x16, 0x64, 0x93, 0xD4, 0xE7, 0xC1, 0x70, 0x3F, 0x12, 0xED,
-    0xEC, 0x46, 0x0D, 0xC5, 0x13, 0x10, 0x09, 0x64, 0x02, 0x13, 0x01, 0x03, 0x7B, 0x13, 0xCA, 0x23,
-    0xAF, 0xB6, 0xBC, 0xD9, 0x8D, 0x16, 0xD3, 0x27, 0x2E, 0x82, 0x6A, 0x40, 0xD7, 0x6C, 0xE7, 0x1B,
-    0x95, 0x53, 0xF0, 0x0E, 0x64, 0x05, 0x36, 0x15, 0x98, 0x40, 0x04, 0x90, 0x2D, 0x98, 0xF7, 0x3F,
-    0x4C, 0x86, 0x8E, 0x62, 0x4E, 0x01, 0x6F, 0x07, 0x81, 0x9D, 0x3D, 0x19, 0x07, 0xFA, 0x06, 0x06,
-    0xE4, 0x88, 0xEA, 0x55, 0xB2, 0xDC, 0x27, 0xB5, 0x7F, 0x31, 0x08, 0xF4, 0x62, 0xC8, 0x51, 0x4B,
-    0x3B, 0x4F, 0x25, 0xF6, 0x92, 0xEE, 0xE0, 0x11, 0x4A, 0xBF, 0xB8, 0xA6, 0x06, 0x07, 0xD0, 0x5F,
-    0x6F, 0xD0, 0xF7, 0xE0, 0x6A, 0x4A, 0x3A, 0xD8, 0xB1, 0x9F, 0xCB, 0x63, 0xAF, 0xB0, 0xB2, 0xA1,
-    0xC4, 0x60, 0xE5, 0x59, 0xD4, 0x87, 0x7E, 0x50, 0xE8, 0xD5, 0xE2, 0x36, 0x98, 0x57, 0x0A, 0x6B,
-    0x74, 0x6B, 0xDD, 0xDC, 0xDC, 0x8D, 0xBD, 0xFC, 0x79, 0xC0, 0x31, 0xF6, 0xC5, 0xD7, 0x1E, 0xCC,
-    0x7B, 0x1F, 0x25, 0x3A, 0xB2, 0xBF, 0x2C, 0xE0, 0xB7, 0xF0, 0x00, 0x6E, 0x15, 0xDF, 0xFE, 0xEE,
-    0xF0, 0x87, 0xEF, 0xEE, 0xDD, 0x02, 0x51, 0x17, 0x53, 0xB8, 0x7F, 0xDF, 0xE0, 0x1F, 0x3B, 0xDB,
-    0x00, 0x82, 0xC0, 0xEE, 0x50, 0x4A, 0x8B, 0x07, 0x54, 0x16, 0x3D, 0x9F, 0x41, 0xE0, 0x5D, 0xD9,
-    0xC8, 0x4A, 0xC1, 0x08, 0x56, 0xE0, 0x0E, 0x6D, 0xE4, 0x75, 0x87, 0xFE, 0x2F, 0x83, 0xCA, 0x11,
-    0x1E, 0x02, 0x3C, 0xBF, 0xDA, 0xCE, 0x6B, 0x06, 0x11, 0x02, 0xF3, 0xBC, 0x2D, 0x6B, 0x45, 0xAF,
-    0x8B, 0x87, 0x1F, 0x7A, 0x71, 0x92, 0x84, 0x4F, 0x65, 0x9B, 0x64, 0x13, 0xE5, 0xC3, 0xA8, 0x56,
-    0x83, 0x66, 0x9E, 0xF8, 0x7F, 0x87, 0x4D, 0xC1, 0x55, 0x92, 0x2A, 0xC7, 0xF2, 0xBC, 0x37, 0x9B,
-    0xA1, 0x97, 0x47, 0xDE, 0xAC, 0xBF, 0x4C, 0x4E, 0x9E, 0x25, 0xFB, 0x08, 0x13, 0x69, 0x2A, 0x2F,
-    0x59, 0x5D, 0x9A, 0x8A, 0x9E, 0xE1, 0x4B, 0x4C, 0x1A, 0xEB, 0xE3, 0x00, 0xA6, 0x12, 0x9E, 0xD8,
-    0x92, 0x1D, 0xF1, 0xA5, 0x9A, 0x82, 0xCA, 0x5D, 0x6F, 0x39, 0x46, 0x8E, 0xA9, 0x78, 0xD8, 0x03,
-    0xBD, 0x73, 0x12, 0x94, 0xD0, 0x37, 0xC5, 0x00, 0x25, 0x85, 0x63, 0x30, 0xE8, 0x2D, 0x7A, 0xD8,
-    0x9D, 0x2A, 0x6C, 0x8D, 0x6B, 0x2A, 0x0B, 0x2C, 0x32, 0xD7, 0xA8, 0x00, 0x9F, 0x46, 0xA0, 0xCB,
-    0xD4, 0xC1, 0x57, 0x48, 0x7C, 0xEA, 0x4B, 0x3E, 0xD9, 0xC2, 0x12, 0xEA, 0xCA, 0x12, 0xFC, 0x8D,
-    0x2F, 0x0F, 0xBC, 0x5E, 0xEB, 0xEC, 0x95, 0x25, 0x7E, 0x03, 0xFD, 0x3F, 0x4B, 0xA8, 0x0A, 0x5C,
-    0x62, 0xD7, 0x96, 0x78, 0xEB, 0xBF, 0x96, 0x78, 0x97, 0x44, 0x6B, 0xDD, 0x89, 0xC8, 0x75, 0x93,
-    0x25, 0x04, 0x0E, 0x64, 0x89, 0x09, 0x3F, 0x8D, 0x6A, 0xFF, 0x3C, 0x9B, 0x53, 0x2C, 0xCC, 0x79,
-    0x63, 0xE7, 0x89, 0xCA, 0xF8, 0xA8, 0x78, 0x9F, 0x91, 0x91, 0xEB, 0x72, 0x38, 0x30, 0xDA, 0x08,
-    0x19, 0x8D, 0x5E, 0x6C, 0x10, 0x52, 0x46, 0x48, 0x2F, 0x32, 0xA5, 0xFC, 0x94, 0x72, 0xFA, 0x82,
-    0x58, 0x42, 0x6F, 0x36, 0xA3, 0x19, 0x47, 0xF3, 0x28, 0x68, 0xF4, 0x25, 0xD6, 0x59, 0xEE, 0x79,
-    0xA5, 0x71, 0x75, 0x70, 0xB2, 0x4D, 0x86, 0x87, 0x24, 0xBF, 0xCF, 0xA9, 0x53, 0xB1, 0xD6, 0x81,
-    0x5D, 0x5A, 0xA7, 0xB0, 0xCA, 0x75, 0x0B, 0xAC, 0x0D, 0x3C, 0x83, 0xDB, 0x6C, 0xF7, 0x29, 0xE2,
-    0x97, 0x17, 0xD5, 0x6D, 0x28, 0xAB, 0xA2, 0xBE, 0x76, 0x85, 0xC6, 0xBF, 0x76, 0x9E, 0x64, 0x53,
-    0xEC, 0x12, 0x7B, 0x00, 0x0F, 0x8A, 0x85, 0xBA, 0x12, 0x34, 0xB9, 0xE0, 0x52, 0xF2, 0xBC, 0xFE,
-    0x75, 0x05, 0x25, 0xED, 0x38, 0x39, 0x66, 0x19, 0x66, 0xCC, 0x97, 0xCD, 0x32, 0x44, 0xDE, 0x2A,
-    0x88, 0xA2, 0x59, 0x61, 0x9D, 0xCE, 0xB9, 0xE2, 0x33, 0x83, 0x7B, 0xD1, 0x91, 0x11, 0x26, 0xFC,
-    0x75, 0x50, 0x65, 0x93, 0xF4, 0x16, 0x09, 0x53, 0x4F, 0x56, 0xA0, 0x70, 0x95, 0xEB, 0xF5, 0xE6,
-    0x71, 0xB7, 0x61, 0xF1, 0x10, 0xA7, 0x33, 0x28, 0xBB, 0x9B, 0x06, 0xC1, 0x4D, 0x49, 0x43, 0xE2,
-    0x65, 0xEB, 0xD8, 0x8F, 0x36, 0xF8, 0x9F, 0xCD, 0x64, 0x56, 0x1E, 0xFD, 0x94, 0xF2, 0x41, 0xCD,
-    0xBC, 0x86, 0x17, 0xBA, 0x92, 0x3F, 0xD6, 0x8C, 0x00, 0xDB, 0x1A, 0x34, 0x35, 0x0D, 0xC9, 0xF6,
-    0xB8, 0x52, 0xFB, 0x5E, 0x36, 0x33, 0x60, 0x98, 0xFB, 0xE2, 0x9E, 0x01, 0x2A, 0x27, 0xEB, 0xBF,
-    0xEF, 0x47, 0x72, 0xD3, 0x13, 0x72, 0x4D, 0xC8, 0xB7, 0xA1, 0x88, 0xC0, 0x02, 0x30, 0x0F, 0xFC,
-    0xD7, 0x8E, 0xAC, 0x23, 0xC2, 0xA5, 0x47, 0x93, 0xAC, 0xAF, 0x3D, 0x3A, 0x22, 0x71, 0x89, 0x86,
-    0x0D, 0x62, 0xA2, 0xA2, 0xC9, 0x41, 0xDA, 0x4C, 0x20, 0x5A, 0xD8, 0xB0, 0xA0, 0x27, 0x20, 0x11,
-    0x38, 0x92, 0xC7, 0x22, 0xCC, 0x0C, 0x18, 0xD1, 0xC9, 0x9A, 0x9C, 0xB8, 0x2D, 0x3A, 0x55, 0xCD,
-    0xB8, 0x97, 0xF5, 0x06, 0xA3, 0x2A, 0x46, 0x45, 0x28, 0x5B, 0x43, 0x8D, 0xC1, 0x0E, 0xBA, 0x39,
-    0xFC, 0x3D, 0xB8, 0xD6, 0x7E, 0x70, 0x1E, 0xF5, 0x38, 0x8C, 0xF2, 0x1C, 0xDA, 0xEC, 0x26, 0xE2,
-    0x55, 0xD0, 0x77, 0xFD, 0x8C, 0xA8, 0xC8, 0xE9, 0x64, 0x1D, 0x54, 0xC5, 0x0F, 0x3A, 0xE5, 0x3A,
-    0xF7, 0xF1, 0x5E, 0x30, 0xC4, 0xD4, 0x28, 0x47, 0xAC, 0x35, 0x33, 0x3A, 0x8E, 0x34, 0x7A, 0xCE,
-    0x62, 0x81, 0x3D, 0x4B, 0x36, 0x97, 0xD7, 0xD1, 0x3C, 0xA3, 0x29, 0xF6, 0xA2, 0x3C, 0xA5, 0x5E,
-    0xF1, 0xF2, 0x71, 0x4D, 0x3E, 0x24, 0x9E, 0xCD, 0xE2, 0xC7, 0x06, 0x8E, 0xAF, 0xC3, 0xCD, 0x39,
-    0x50, 0x0F, 0xB9, 0x5A, 0x9C, 0xAE, 0x26, 0xD7, 0xAB, 0x48, 0x53, 0x80, 0x37, 0xAA, 0xB7, 0xBD,
-    0xAA, 0x75, 0x45, 0x55, 0x53, 0x6F, 0x4F, 0xC0, 0x7A, 0xDD, 0xFE, 0x03, 0x6D, 0x57, 0x31, 0x6C,
-    0xDD, 0xD6, 0x15, 0xBD, 0xE4, 0xAB, 0xC4, 0xB6, 0x04, 0xFA, 0x3C, 0x38, 0x30, 0x60, 0x0D, 0xEC,
-    0xD8, 0xA2, 0xA8, 0xB9, 0x66, 0x70, 0xFC, 0xE8, 0x7A, 0xD0, 0x90, 0x41, 0x1A, 0xEC, 0x7A, 0xF0,
-    0xE0, 0xB5, 0xE8, 0xA2, 0x0E, 0x1D, 0x32, 0xA8, 0xE6, 0x87, 0x3D, 0x78, 0xF0, 0xE2, 0x25, 0xE9,
-    0x98, 0x16, 0x48, 0x50, 0x57, 0x46, 0xA1, 0x0C, 0x1D, 0x0A, 0x34, 0x09, 0xA9, 0x6A, 0xE8, 0xE0,
-    0xA1, 0x8C, 0x8B, 0xC2, 0x28, 0x3A, 0x94, 0x51, 0x03, 0xA8, 0xB5, 0x06, 0x3D, 0xC7, 0x74, 0x42,
-    0x49, 0xE4, 0xBB, 0x39, 0xF7, 0xF2, 0x7F, 0xC9, 0x43, 0x69, 0xFF, 0xF7, 0xBF, 0x1E, 0x1F, 0xDF,
-    0xBB, 0xF7, 0xDC, 0x73, 0xCF, 0xBD, 0x24, 0xC2, 0x95, 0x70, 0x43, 0x96, 0x07, 0x7C, 0x46, 0x4A,
-    0xC3, 0x2D, 0x4A, 0x46, 0xA2, 0x38, 0xE0, 0x06, 0xC7, 0x5B, 0x8F, 0xDC, 0x0E, 0x73, 0xE6, 0x2B,
-    0xBE, 0x3F, 0x38, 0xFE, 0x8C, 0xAD, 0x27, 0xB7, 0xDF, 0x63, 0x25, 0x07, 0x62, 0xE6, 0x22, 0x65,
-    0xAE, 0x09, 0x93, 0x64, 0x7A, 0xA2, 0x28, 0xDC, 0x20, 0xAA, 0x78, 0x46, 0x4E, 0x37, 0xF4, 0x34,
-    0xBF, 0x92, 0xDD, 0x9A, 0xE8, 0xC7, 0x97, 0x88, 0x56, 0xB8, 0xC3, 0x61, 0xB8, 0x81, 0x47, 0x67,
-    0x96, 0x4F, 0x06, 0xAC, 0x5E, 0x6D, 0x13, 0xBE, 0xFC, 0x16, 0xB9, 0x17, 0x9F, 0xFB, 0x88, 0xD7,
-    0xDE, 0x2E, 0xD2, 0x61, 0xF3, 0x32, 0xB9, 0xBD, 0xCF, 0x5B, 0xE2, 0x35, 0x5B, 0x98, 0xF1, 0x9D,
-    0x4D, 0xB2, 0x5F, 0x3F, 0x6D, 0xB1, 0xA7, 0xC5, 0xE6, 0xFD, 0x3B, 0x14, 0xF1, 0x7F, 0x0E, 0xC8,
-    0x30, 0xEC, 0x35, 0xB2, 0x15, 0xF6, 0x9B, 0xD1, 0xA5, 0x8D, 0x82, 0xC8, 0x77, 0x30, 0xFB, 0xEE,
-    0x6C, 0x71, 0x6A, 0xCA, 0x5F, 0xE0, 0xC3, 0x2D, 0x56, 0x8D, 0xC4, 0xC7, 0xDB, 0x75, 0x3E, 0xD0,
-    0x79, 0xC3, 0xB8, 0x53, 0xC1, 0x1C, 0x2B, 0xF6, 0x72, 0xFC, 0x5B, 0x9F, 0x7B, 0x57, 0x9A, 0x90,
-    0xB0, 0x77, 0x6D, 0xF5, 0x3F, 0x33, 0x8A, 0x83, 0x4D, 0x20, 0x13, 0xB2, 0x86, 0xDC, 0x97, 0x23,
-    0xC5, 0xBC, 0xB1, 0x03, 0x5F, 0x82, 0x87, 0xA9, 0x8C, 0xBF, 0xF4, 0xC4, 0x23, 0x3C, 0xBB, 0x8E,
-    0x8D, 0x32, 0x78, 0x1F, 0x8B, 0x25, 0x0E, 0x3F, 0x70, 0x4E, 0x47, 0x25, 0xB6, 0x4E, 0x06, 0x39,
-    0x03, 0x76, 0xD8, 0x4E, 0x30, 0x7C, 0xF7, 0xFA, 0x62, 0x5D, 0x2F, 0xEB, 0xE0, 0x12, 0x66, 0x1D,
-    0xD6, 0xAD, 0x8C, 0xEB, 0x62, 0x60, 0x41, 0xB2, 0xE9, 0x12, 0x03, 0x3B, 0x01, 0x32, 0x12, 0x0B,
-    0xF3, 0x96, 0x4E, 0xAF, 0x3C, 0x14, 0xE2, 0x64, 0x81, 0x87, 0x07, 0x18, 0xF0, 0x5E, 0xAB, 0xB6,
-    0xEB, 0x49, 0x31, 0xD6, 0x46, 0xDB, 0xE1, 0xF7, 0xB2, 0x4D, 0xA7, 0x46, 0xE8, 0xE1, 0xD1, 0xC6,
-    0xAB, 0x75, 0xCA, 0xE1, 0xBA, 0xD8, 0x5C, 0x50, 0xE6, 0xE7, 0xF6, 0xA4, 0xEA, 0xF3, 0xF3, 0xAD,
-    0x87, 0xA9, 0xE0, 0xEF, 0x14, 0x17, 0x9E, 0x87, 0x49, 0xFD, 0x21, 0xA3, 0x7F, 0x44, 0x9D, 0x4E,
-    0x61, 0xA7, 0x21, 0xEF, 0xB0, 0xA8, 0xCC, 0xB9, 0xE2, 0x3A, 0x3F, 0xC4, 0xE2, 0xDE, 0xF2, 0x6D,
-    0x7E, 0xC6, 0x86, 0x23, 0xAE, 0xCB, 0x9A, 0x67, 0x65, 0x93, 0xF9, 0xB2, 0xCE, 0x7D, 0xDA, 0xE7,
-    0x6D, 0xDA, 0x03, 0xBE, 0x0E, 0xEE, 0xF1, 0xB5, 0x01, 0x96, 0x81, 0x38, 0x58, 0x04, 0xEA, 0xD4,
-    0xDC, 0xCA, 0xED, 0xAA, 0x93, 0xDB, 0x25, 0x6E, 0x1B, 0x50, 0x89, 0xCA, 0x1D, 0xCE, 0x2B, 0xDC,
-    0xA6, 0x4C, 0x23, 0x66, 0x6B, 0x8D, 0x59, 0x73, 0xE6, 0x37, 0xE2, 0x90, 0x36, 0x49, 0x80, 0x19,
-    0x55, 0x6B, 0x6B, 0xCB, 0xD1, 0x40, 0xEC, 0xF3, 0x99, 0x3D, 0x34, 0x5D, 0x74, 0xEC, 0x1D, 0x7C,
-    0x7B, 0x7C, 0x04, 0x60, 0xF9, 0xB3, 0x6A, 0x7B, 0xFB, 0xBF, 0xE6, 0x45, 0x37, 0x46, 0xD5, 0xC6,
-    0xFB, 0x4D, 0x89, 0x99, 0x55, 0xF1, 0xCA, 0xD6, 0xC7, 0x5D, 0x34, 0xD8, 0x8A, 0xF2, 0x19, 0xFB,
-    0x18, 0x76, 0x93, 0x2B, 0xAA, 0xD6, 0xF8, 0x14, 0xFE, 0x28, 0x03, 0x04, 0x57, 0x52, 0xCE, 0x93,
-    0x30, 0xA9, 0x11, 0x6C, 0x58, 0x43, 0x77, 0x15, 0xA0, 0x21, 0x42, 0xAE, 0xB9, 0x8E, 0x88, 0xD8,
-    0xEE, 0x0A, 0x40, 0x35, 0x63, 0x5E, 0xC4, 0x21, 0x66, 0xDB, 0x50, 0xF5, 0x13, 0x7E, 0x9F, 0x5B,
-    0xA0, 0x77, 0xC8, 0x1D, 0xF2, 0xE0, 0x09, 0x0F, 0x42, 0xC1, 0xB2, 0x88, 0xF9, 0x43, 0xCA, 0x6B,
-    0xC2, 0xB3, 0xC2, 0xA1, 0x9A, 0xCC, 0xA0, 0xF1, 0x0C, 0x94, 0x00, 0xF6, 0x72, 0x16, 0x8F, 0xC2,
-    0x97, 0x9A, 0xE5, 0x30, 0x2F, 0xE1, 0x2F, 0x7B, 0xF5, 0x12, 0x47, 0x95, 0x6A, 0x49, 0x2C, 0xE1,
-    0x13, 0xDA, 0xEA, 0x97, 0x30, 0x45, 0xD8, 0x63, 0x24, 0x0F, 0x93, 0xC1, 0xF6, 0x19, 0x17, 0x79,
-    0x9B, 0xEF, 0x81, 0x84, 0x3C, 0x83, 0x01, 0xC0, 0x3A, 0x1D, 0xAB, 0xAB, 0xB5, 0x3D, 0xE6, 0x97,
-    0x30, 0x1A, 0x6E, 0x83, 0x15, 0xD8, 0xA2, 0xCD, 0x35, 0x3B, 0xC9, 0x8D, 0xE4, 0x76, 0x41, 0xCC,
-    0x21, 0x62, 0xD0, 0x30, 0xEF, 0x93, 0x01, 0x9C, 0xCA, 0x7D, 0xDE, 0x96, 0x33, 0x18, 0xC3, 0x57,
-    0xF9, 0x07, 0x71, 0x30, 0x83, 0x19, 0x2A, 0xF6, 0x99, 0xB7, 0x5F, 0xE1, 0xB4, 0x6A, 0xE6, 0xF6,
-    0x79, 0x8A, 0xFC, 0x79, 0x58, 0xD3, 0xC5, 0x7D, 0xD4, 0xDB, 0xC6, 0xB6, 0xB6, 0x71, 0x72, 0x8F,
-    0x06, 0x13, 0xE2, 0xDE, 0xF8, 0x4C, 0x26, 0x11, 0xD2, 0x92, 0x9C, 0x39, 0xBC, 0xDB, 0x83, 0x22,
-    0xBF, 0xB2, 0xB5, 0xF1, 0x43, 0x57, 0xD2, 0xC6, 0xC1, 0xC9, 0x41, 0x00, 0x94, 0x80, 0x31, 0x0D,
-    0x81, 0xF9, 0x37, 0xC9, 0xFE, 0xD3, 0x97, 0x1D, 0x65, 0x1B, 0xE9, 0xDF, 0x6A, 0xFA, 0xA4, 0xCF,
-    0xEF, 0x50, 0x7C, 0xD2, 0x7C, 0xEA, 0xE1, 0x62, 0x0C, 0x1F, 0xF3, 0x1E, 0xA1, 0x40, 0x24, 0x72,
-    0x8F, 0x6C, 0x93, 0x88, 0x28, 0x77, 0x10, 0x17, 0xE4, 0x49, 0x26, 0xD9, 0xD4, 0xC7, 0x9A, 0x58,
-    0x8D, 0xAB, 0x93, 0xA3, 0x9F, 0x32, 0x04, 0xA6, 0xA2, 0xB4, 0x2B, 0x8B, 0xD4, 0x3F, 0x72, 0xAB,
-    0x9E, 0x42, 0xBE, 0xDB, 0x55, 0x64, 0x9F, 0x0E, 0xE5, 0x5A, 0x1B, 0x8D, 0xEE, 0x81, 0x0F, 0x94,
-    0xEF, 0xF6, 0x55, 0xD6, 0x18, 0xCC, 0xEC, 0xE1, 0x49, 0xCC, 0xE4, 0xB5, 0xE9, 0x38, 0xFB, 0x7B,
-    0x4F, 0xA5, 0xDD, 0x1B, 0x1C, 0x9E, 0x1C, 0xDD, 0x5F, 0x21, 0x3E, 0xD9, 0x5F, 0x3E, 0x60, 0xC2,
-    0x0C, 0xE5, 0x0D, 0x9E, 0xAC, 0x57, 0xF0, 0x63, 0x57, 0xC4, 0x2C, 0x1E, 0x4A, 0xE1, 0x81, 0x7B,
-    0xC0, 0xFC, 0xF0, 0x8C, 0x86, 0x9A, 0x3E, 0x30, 0x12, 0xB6, 0x84, 0xF9, 0x50, 0x2A, 0x69, 0x90,
-    0x81, 0xD1, 0x3A, 0xE0, 0xCC, 0x07, 0x24, 0x97, 0x64, 0x1A, 0xE0, 0x67, 0x44, 0x77, 0x95, 0x29,
-    0x05, 0x58, 0xF0, 0x07, 0x31, 0xCF, 0x3C, 0xBC, 0xC8, 0x3D, 0xC8, 0x90, 0xB7, 0x3A, 0x20, 0x09,
-    0x73, 0xAF, 0x21, 0x29, 0xBD, 0x44, 0x4A, 0xE0, 0x38, 0xF0, 0x08, 0xDD, 0x83, 0x56, 0x81, 0x9F,
-    0xAE, 0x37, 0x6E, 0xA8, 0x94, 0x82, 0x2D, 0x3F, 0xDF, 0xDA, 0x5A, 0x4C, 0x46, 0x12, 0x1E, 0x49,
-    0x6B, 0x51, 0x02, 0x1B, 0x6E, 0xCF, 0x62, 0x2E, 0xCE, 0x21, 0x4D, 0x40, 0x1A, 0x50, 0xE0, 0xBB,
-    0xFC, 0x7C, 0x46, 0xC2, 0x60, 0x51, 0x1B, 0x72, 0xD8, 0xED, 0x42, 0xB8, 0x3E, 0x31, 0xBB, 0x14,
-    0x5E, 0x8B, 0x60, 0x18, 0xE1, 0xB7, 0xDC, 0x32, 0xFC, 0x9E, 0x97, 0x85, 0x72, 0x88, 0xC7, 0xC6,
-    0xE2, 0xCF, 0xFA, 0x94, 0x73, 0x20, 0x4E, 0x9D, 0x01, 0xB2, 0xDA, 0x41, 0xF3, 0x6A, 0x6C, 0xC5,
-    0x77, 0x45, 0xA3, 0xAE, 0xC1, 0x6F, 0xB6, 0x03, 0xD6, 0x02, 0x8B, 0x38, 0x60, 0xB7, 0x1F, 0x31,
-    0x3F, 0x97, 0x00, 0xB1, 0xB0, 0x2F, 0x4C, 0xC4, 0x4D, 0x87, 0x52, 0x02, 0x09, 0x9B, 0x30, 0xB4,
-    0xF0, 0x1E, 0x8B, 0x33, 0x9F, 0xC1, 0xDD, 0x16, 0xFC, 0x74, 0x0D, 0x36, 0x70, 0x35, 0xAC, 0x15,
-    0x05, 0xBA, 0x26, 0xC9, 0x2B, 0xA9, 0x5A, 0x8A, 0x34, 0x8A, 0x38, 0x99, 0xF1, 0x17, 0x38, 0x44,
-    0x00, 0x86, 0x3D, 0x20, 0xB2, 0x2A, 0x5D, 0x36, 0x7E, 0x1F, 0x9C, 0xF8, 0x14, 0x9F, 0x40, 0x71,
-    0x3E, 0x4E, 0x93, 0xA9, 0x66, 0x93, 0x90, 0x05, 0x89, 0x26, 0x6A, 0x29, 0x5A, 0xAB, 0xDE, 0xCD,
-    0xAF, 0x98, 0x35, 0xA9, 0x12, 0x56, 0xD7, 0x44, 0xE7, 0x44, 0x52, 0xB3, 0x77, 0xAB, 0x30, 0x87,
-    0x52, 0x94, 0x06, 0xD9, 0x2D, 0x49, 0x68, 0x44, 0xAE, 0x54, 0x79, 0x25, 0x2F, 0x21, 0x95, 0x2A,
-    0xDC, 0xAE, 0x51, 0x3A, 0x22, 0x87, 0x59, 0x53, 0x10, 0x88, 0x6C, 0x7C, 0x11, 0x81, 0x65, 0x28,
-    0x86, 0x48, 0x08, 0xDB, 0x57, 0x87, 0x1E, 0x70, 0x0D, 0xAE, 0x46, 0xD1, 0x48, 0x42, 0x56, 0xBB,
-    0xFB, 0x43, 0xCA, 0xA9, 0xB7, 0x7B, 0xBC, 0x0D, 0x05, 0x4C, 0x3A, 0xA1, 0x14, 0xFF, 0x7A, 0x10,
-    0xC6, 0x80, 0x30, 0x16, 0xE5, 0x28, 0x3F, 0x54, 0x63, 0x52, 0x3F, 0x89, 0xED, 0x24, 0x00, 0x34,
-    0x59, 0x44, 0x65, 0x31, 0xC9, 0xBD, 0x0A, 0xA1, 0x4A, 0xC7, 0x6B, 0x6B, 0x4E, 0x6D, 0x4E, 0x85,
-    0x03, 0x99, 0xC4, 0xD3, 0x7D, 0x29, 0x41, 0xDD, 0x59, 0x0C, 0xD5, 0xAE, 0x0E, 0xA2, 0x35, 0x4F,
-    0xF0, 0x6C, 0x79, 0xD8, 0x08, 0x59, 0x67, 0x32, 0x88, 0xE3, 0xB8, 0xF9, 0x6D, 0x71, 0xF6, 0xB2,
-    0xFC, 0xFA, 0xC4, 0x21, 0x8E, 0x01, 0xC8, 0x18, 0xFE, 0x1A, 0x3C, 0x3D, 0xDC, 0x83, 0x57, 0x6B,
-    0x77, 0x99, 0xEE, 0xA4, 0x52, 0x7D, 0xBE, 0xA5, 0x25, 0x48, 0x21, 0x51, 0xF5, 0xB9, 0x25, 0x46,
-    0xAB, 0x32, 0x6A, 0xAD, 0x90, 0x3D, 0x45, 0xB1, 0xE6, 0xA5, 0x0B, 0x4C, 0x3C, 0xE6, 0x16, 0xA5,
-    0x94, 0x05, 0xE4, 0x51, 0x14, 0x19, 0x19, 0x9B, 0xB5, 0x17, 0xC6, 0x9B, 0x41, 0x22, 0xDC, 0xE7,
-    0x61, 0x3B, 0x14, 0x48, 0x8A, 0x02, 0x64, 0xC7, 0x3A, 0xD8, 0x9F, 0x21, 0xDC, 0x71, 0x58, 0x27,
-    0xA5, 0xAE, 0x06, 0x4D, 0xB8, 0x29, 0x04, 0x20, 0x9E, 0x40, 0x50, 0x2E, 0x4A, 0x49, 0x90, 0x5A,
-    0x1B, 0x0B, 0xBB, 0xC0, 0xB3, 0x0E, 0x5C, 0xAE, 0x6A, 0x37, 0xF6, 0x4B, 0x11, 0xEF, 0xA2, 0x0A,
-    0x0E, 0xB6, 0xA0, 0xB2, 0xDD, 0xC4, 0xFD, 0x18, 0x99, 0xD4, 0xDB, 0xE7, 0x8F, 0x5C, 0xE3, 0xF8,
-    0x05, 0xB4, 0x8D, 0x25, 0x12, 0x23, 0xC8, 0x67, 0x7D, 0xD9, 0xF4, 0xA8, 0x53, 0xF7, 0x9E, 0x42,
-    0x97, 0x6E, 0xDB, 0x3E, 0xE1, 0xB1, 0x6A, 0xAC, 0x50, 0xD6, 0x8A, 0xE5, 0xDA, 0x3B, 0x68, 0xB5,
-    0x4B, 0xEB, 0x53, 0x98, 0x93, 0xA0, 0x05, 0xA1, 0x16, 0xC0, 0xFD, 0xC2, 0xF3, 0x52, 0xD0, 0x70,
-    0x82, 0x69, 0xB6, 0x8F, 0xF5, 0xF6, 0x95, 0x60, 0x87, 0x2B, 0x92, 0x01, 0xB5, 0x5D, 0xCA, 0x2E,
-    0xA2, 0xAD, 0xBC, 0x1E, 0xF4, 0x0E, 0x6D, 0xBC, 0xBA, 0x39, 0x16, 0x60, 0x12, 0x0B, 0x77, 0x94,
-    0x4C, 0x69, 0x07, 0x64, 0xD1, 0x58, 0xE1, 0xD0, 0x6A, 0x06, 0xC1, 0xCB, 0x16, 0x55, 0xBE, 0x12,
-    0x21, 0x04, 0x28, 0x89, 0x26, 0xF7, 0x63, 0xA6, 0xA8, 0xD0, 0xF8, 0x6B, 0xE4, 0xFC, 0xC5, 0xAD,
-    0xC7, 0x7C, 0x4F, 0xF6, 0xBD, 0x58, 0xF1, 0x71, 0x21, 0x8D, 0xDA, 0x05, 0x0E, 0x37, 0xE4, 0x24,
-    0x30, 0x91, 0x83, 0x76, 0x6A, 0x8A, 0x64, 0xA0, 0x25, 0xCA, 0x8F, 0x6E, 0xA1, 0x73, 0x02, 0x60,
-    0xBA, 0x57, 0x26, 0x6C, 0x89, 0x8A, 0x53, 0xDF, 0xC4, 0x4D, 0xE9, 0x8B, 0x16, 0x4D, 0x4B, 0x23,
-    0x90, 0x92, 0xEB, 0x3F, 0x3E, 0x1F, 0xF1, 0xBD, 0x05, 0xA4, 0xCD, 0x19, 0xA4, 0xD0, 0x91, 0xE6,
-    0x8A, 0x78, 0xD6, 0x21, 0x4E, 0x89, 0x74, 0x7A, 0xB9, 0x9C, 0x85, 0x48, 0xC9, 0x72, 0xC3, 0x6B,
-    0x57, 0x71, 0x4E, 0xF8, 0x78, 0xD2, 0x31, 0xAB, 0xFD, 0x87, 0x36, 0x47, 0xA7, 0x90, 0x2E, 0x29,
-    0x71, 0x8B, 0xA5, 0x02, 0xAD, 0x45, 0x02, 0xDD, 0x18, 0x84, 0xD0, 0x21, 0x92, 0xBE, 0x0A, 0x57,
-    0x22, 0xC3, 0x8E, 0x0C, 0x7E, 0x65, 0xBC, 0x7D, 0xB4, 0x8E, 0x92, 0x34, 0x4E, 0x38, 0x22, 0x13,
-    0xC1, 0x09, 0x44, 0xB0, 0x05, 0x2F, 0x00, 0xA2, 0x19, 0x85, 0x27, 0x08, 0xED, 0xD9, 0x9D, 0xAE,
-    0x48, 0x11, 0x4F, 0xED, 0x37, 0xF0, 0x5F, 0xD5, 0xE0, 0x35, 0x01, 0x15, 0x3F, 0x5B, 0xCD, 0xFF,
-    0x9A, 0x94, 0xA5, 0xE4, 0x42, 0x55, 0x08, 0x46, 0xE7, 0x26, 0xBA, 0x4D, 0x6D, 0x1A, 0x08, 0xA4,
-    0xD1, 0x9E, 0x11, 0xCD, 0x77, 0x90, 0x58, 0xCC, 0x23, 0x3F, 0x4D, 0xDB, 0x21, 0xFA, 0xE0, 0x67,
-    0x3F, 0xC4, 0xA9, 0xFF, 0x3E, 0x7C, 0x39, 0xA4, 0xAE, 0xDC, 0x76, 0xF5, 0x9F, 0xF7, 0x5E, 0x9C,
-    0x74, 0x26, 0xDC, 0xC9, 0xE4, 0x58, 0xE1, 0x50, 0x25, 0x2A, 0x6B, 0xDF, 0x7E, 0x86, 0x28, 0x74,
-    0x7F, 0xDA, 0x84, 0xDB, 0x91, 0x80, 0x2E, 0x21, 0x32, 0x73, 0x0F, 0x27, 0x91, 0x9B, 0x5F, 0xA7,
-    0x93, 0x78, 0xAE, 0xBF, 0xB8, 0x7D, 0xFC, 0x88, 0xC4, 0xEF, 0x68, 0xD1, 0x9B, 0xBA, 0xD7, 0xF4,
-    0xEC, 0xFF, 0x4E, 0x6A, 0xBF, 0x27, 0xE1, 0x63, 0x74, 0x8D, 0x2B, 0x93, 0x24, 0x56, 0x2A, 0xA8,
-    0xE3, 0xD2, 0x4D, 0x24, 0x56, 0xD6, 0x45, 0x8F, 0x79, 0x96, 0x4A, 0xC3, 0x89, 0x44, 0x15, 0x8E,
-    0x4B, 0xDB, 0x31, 0x4E, 0x3E, 0xCB, 0x26, 0x5A, 0xCE, 0x9A, 0x69, 0x63, 0x49, 0xB9, 0xBC, 0x99,
-    0x5A, 0x52, 0x57, 0x9F, 0xA3, 0xF2, 0x5F, 0xD2, 0x37, 0xB6, 0xCB, 0x10, 0x50, 0xF4, 0x1C, 0x50,
-    0xD8, 0xE5, 0x19, 0x58, 0x8E, 0x5A, 0xC3, 0x85, 0x43, 0x5D, 0x2C, 0xB1, 0xC5, 0xEF, 0x06, 0x0A,
-    0x49, 0x1F, 0x87, 0xB4, 0x33, 0x83, 0xED, 0xD2, 0x01, 0xB4, 0xE8, 0xB2, 0xAF, 0xD0, 0x7B, 0x68,
-    0x5B, 0x89, 0x02, 0x02, 0xE8, 0xA7, 0x86, 0x72, 0xA1, 0x64, 0x82, 0x67, 0xBA, 0x8B, 0x53, 0xAE,
-    0x80, 0x61, 0x34, 0xBC, 0x35, 0x61, 0xD0, 0xA5, 0x53, 0x4B, 0x39, 0xFF, 0xD5, 0x1A, 0x80, 0x38,
-    0xCB, 0xBE, 0x73, 0xEE, 0x12, 0x6D, 0x8E, 0xED, 0x1F, 0x71, 0xE2, 0x33, 0xF4, 0x37, 0x27, 0x48,
-    0xFE, 0x6B, 0xC9, 0xC3, 0x49, 0x27, 0x84, 0x58, 0x07, 0xE1, 0x0F, 0x34, 0xBD, 0x5E, 0x88, 0xFA,
-    0x53, 0x16, 0x5E, 0xAB, 0xD5, 0xDA, 0x3F, 0xE6, 0x3A, 0xAA, 0x96, 0xCF, 0xC7, 0x52, 0x7B, 0xCC,
-    0x4A, 0x12, 0x61, 0x43, 0x08, 0x2A, 0xA7, 0xD5, 0x5A, 0xBB, 0xF4, 0x5D, 0x84, 0xFB, 0x88, 0xEF,
-    0x8E, 0x16, 0x45, 0x1B, 0x2C, 0xC7, 0x3F, 0x69, 0x8C, 0x40, 0xAE, 0x41, 0xBD, 0xC3, 0xB7, 0xF5,
-    0x29, 0xBE, 0xAD, 0x5F, 0x5A, 0x4F, 0x7B, 0x69, 0x07, 0x6C, 0xA7, 0x25, 0xC7, 0x0B, 0x84, 0x99,
-    0x36, 0x73, 0xC2, 0x53, 0xD9, 0x58, 0xDB, 0x03, 0x49, 0x3F, 0x7D, 0x41, 0x11, 0x96, 0x22, 0xD5,
-    0x35, 0xF9, 0xA1, 0x7F, 0x5E, 0x8B, 0x88, 0xF3, 0xCB, 0x7C, 0x0B, 0x15, 0x04, 0xA7, 0x9A, 0xE9,
-    0x3D, 0x08, 0x09, 0x29, 0xEF, 0x02, 0xDA, 0xF5, 0x2F, 0xA3, 0xA6, 0x6A, 0x7D, 0xD7, 0xB7, 0x82,
-    0xA8, 0xFA, 0xC7, 0xFC, 0x55, 0xCC, 0x4E, 0x9D, 0x19, 0x7D, 0xF4, 0x4B, 0x0C, 0xDE, 0xCF, 0x87,
-    0x65, 0xC9, 0xEF, 0x4A, 0xBB, 0x0E, 0x9C, 0x99, 0x4D, 0x42, 0x79, 0xEF, 0x9F, 0x54, 0xED, 0xDF,
-    0x47, 0x2F, 0xF0, 0x64, 0x15, 0x2D, 0x89, 0x4D, 0x0B, 0xC3, 0xD6, 0x4E, 0x52, 0xAE, 0x15, 0xED,
-    0x6C, 0x50, 0x8D, 0xA7, 0x89, 0xF6, 0x82, 0x13, 0xAC, 0xA5, 0x8B, 0xDB, 0x7C, 0x2C, 0xEF, 0x06,
-    0xFA, 0x82, 0xC0, 0x85, 0xF4, 0xD3, 0x72, 0xEC, 0x47, 0x28, 0x1D, 0x97, 0x61, 0xC6, 0xF7, 0xC4,
-    0x30, 0x79, 0xC3, 0xEB, 0xE5, 0x38, 0x70, 0x8C, 0x3D, 0x3A, 0x51, 0xB4, 0xE6, 0x5A, 0x3D, 0x4B,
-    0x08, 0xBF, 0x6B, 0xD3, 0x50, 0x79, 0x23, 0xF2, 0x33, 0xF5, 0x2A, 0x48, 0x92, 0xB6, 0x6C, 0xD2,
-    0xCE, 0xF6, 0x46, 0xDA, 0x22, 0x69, 0x60, 0xCB, 0xBA, 0x6A, 0xB2, 0x63, 0xF6, 0xE9, 0xA4, 0xEA,
-    0x10, 0x49, 0xE4, 0x8F, 0x91, 0xD7, 0x44, 0xF1, 0xEA, 0xCD, 0x37, 0x89, 0xBE, 0x01, 0xD3, 0x5A,
-    0xE5, 0xFF, 0xFF, 0xF1, 0xFF, 0xAF, 0xFF, 0xFF, 0x00, 0x00, 0x35, 0x8B, 0xB1, 0x0D, 0xC2, 0x50,
-    0x0C, 0x44, 0x4F, 0x08, 0xC9, 0x05, 0x85, 0x47, 0xC9, 0x08, 0x64, 0x23, 0x46, 0x20, 0x15, 0x8C,
-    0x45, 0x46, 0x70, 0x97, 0x96, 0x36, 0x1D, 0x45, 0x8A, 0xDF, 0xC0, 0x71, 0xFF, 0xA2, 0x58, 0xB2,
-    0x9F, 0x9F, 0x7C, 0x06, 0x8E, 0x2A, 0xCF, 0xDC, 0x41, 0x23, 0x77, 0xD0, 0xC8, 0xF5, 0xD6, 0xB1,
-    0x39, 0x92, 0xB3, 0xC1, 0xC7, 0x7B, 0x28, 0xC5, 0x38, 0xDF, 0x4B, 0x31, 0x9E, 0x58, 0x92, 0x4D,
-    0x7F, 0x92, 0xF1, 0xC5, 0x45, 0x72, 0x21, 0x9F, 0xE4, 0x44, 0xB6, 0xE0, 0x2F, 0xB4, 0x05, 0xDB,
-    0xC0, 0x06, 0xAD, 0x12, 0xA3, 0x01, 0xF1, 0x0D, 0x09, 0xE2, 0x93, 0x12, 0x44, 0x5D, 0xA7, 0x8E,
-    0xA5, 0x0B, 0x7C, 0x11, 0x2C, 0x08, 0x0B, 0xCE, 0xEA, 0x3F,
+static const uint8_t notosans_14_bolditalicBitmaps[34293] = {
+    0xC5, 0x9B, 0x31, 0xEC, 0xE7, 0xC6, 0x95, 0xDF, 0x3F, 0xE4, 0x68, 0x45, 0x9C, 0x59, 0x8C, 0x0B,
+    0x2D, 0x12, 0xC8, 0x40, 0xD8, 0x06, 0x4A, 0x62, 0xB6, 0x29, 0xE2, 0x1B, 0x5A, 0x42, 0x4E, 0x85,
+    0x0B, 0x6D, 0xB1, 0x6B, 0x04, 0x70, 0xA1, 0x14, 0x69, 0x92, 0x66, 0x9B, 0x14, 0x29, 0x12, 0x0D,
+    0x7D, 0x2A, 0x0E, 0x48, 0x0A, 0x2F, 0x02, 0xE4, 0x9A, 0x2B, 0xA4, 0x42, 0x01, 0x7C, 0x7F, 0x17,
+    0x9B, 0x22, 0x85, 0x8B, 0xF3, 0xCE, 0x48, 0x5B, 0xA8, 0x50, 0x21, 0x4A, 0x02, 0xCE, 0x85, 0x0A,
+    0x51, 0xE7, 0x55, 0x84, 0x48, 0xC5, 0x8E, 0x24, 0xEE, 0x89, 0x5A, 0x0D, 0xE7, 0x7B, 0x05, 0xF9,
+    0xFB, 0xFF, 0xFF, 0x2B, 0xFB, 0xEE, 0x7C, 0xB1, 0xAC, 0x10, 0xFB, 0xC3, 0x2E, 0xC9, 0xE1, 0xCC,
+    0x9B, 0x37, 0x6F, 0xDE, 0xFB, 0xBE, 0xEF, 0x9B, 0x25, 0x44, 0x9B, 0xD1, 0x68, 0x97, 0x4A, 0xF4,
+    0xA9, 0x2E, 0xB8, 0xC9, 0x64, 0x5C, 0x6C, 0x56, 0xC2, 0x60, 0x13, 0x02, 0x80, 0x2B, 0x98, 0x4C,
+    0x98, 0xDA, 0x0D, 0x3F, 0x32, 0x60, 0xDF, 0xDF, 0xBA, 0xB7, 0x73, 0xF7, 0x5A, 0xEE, 0xEF, 0xAE,
+    0xFD, 0x8B, 0x8B, 0x7B, 0x26, 0x39, 0x93, 0x9E, 0xAA, 0x6F, 0xC1, 0x5F, 0xD8, 0x88, 0x49, 0x0E,
+    0xBA, 0x1F, 0xAF, 0xF0, 0x0B, 0x3B, 0x1D, 0x77, 0xAF, 0xAE, 0x04, 0x49, 0xAF, 0x49, 0x52, 0x2B,
+    0x69, 0xE5, 0x85, 0x66, 0xA6, 0x5E, 0xDC, 0x80, 0x8D, 0x19, 0x27, 0xE9, 0x2D, 0x49, 0x7A, 0x56,
+    0x52, 0xC6, 0x37, 0x89, 0x6A, 0xED, 0x47, 0xDA, 0x69, 0x03, 0x67, 0x12, 0xE4, 0x6E, 0xA4, 0x9D,
+    0x7F, 0xC1, 0x71, 0xD9, 0xFD, 0xF7, 0xB8, 0xEE, 0xE1, 0x24, 0xA4, 0xAD, 0xD6, 0x9D, 0x6C, 0xB6,
+    0x7F, 0xF5, 0x98, 0xC9, 0xFF, 0x09, 0x53, 0xFE, 0x37, 0xB5, 0x12, 0xA8, 0x80, 0xD3, 0x44, 0xA3,
+    0x44, 0xAD, 0x15, 0xF3, 0xE6, 0x8A, 0x79, 0x63, 0xFD, 0x8F, 0xCD, 0x4F, 0x56, 0x7F, 0x5F, 0xC9,
+    0x4B, 0xB3, 0x93, 0x86, 0xC7, 0xC3, 0x3D, 0xF8, 0x27, 0xC0, 0xBF, 0x00, 0xFE, 0xE9, 0x69, 0x8C,
+    0x5A, 0xF0, 0x02, 0x4E, 0x98, 0x64, 0xB4, 0xE1, 0x86, 0xEE, 0x9D, 0xB5, 0x5E, 0x09, 0x76, 0xEE,
+    0xA2, 0x59, 0xDD, 0x98, 0xB1, 0x53, 0xB1, 0x13, 0xBE, 0x59, 0xEE, 0x50, 0xE5, 0xFE, 0xF5, 0x4F,
+    0xEE, 0x34, 0x0F, 0x8A, 0xEB, 0x65, 0xF5, 0xD9, 0x03, 0x95, 0x5E, 0x37, 0x7F, 0xF2, 0x59, 0xEE,
+    0xDE, 0xCF, 0xFE, 0x07, 0x09, 0xFB, 0x76, 0xEE, 0x23, 0xC5, 0xCE, 0xA2, 0x4D, 0xEE, 0x99, 0x15,
+    0xCF, 0xD6, 0x4D, 0x66, 0x31, 0x4B, 0xC0, 0x8D, 0x56, 0x4B, 0x9D, 0xE9, 0x35, 0x76, 0x91, 0x7E,
+    0xE5, 0x91, 0xAB, 0xDF, 0x00, 0xAF, 0x09, 0xBC, 0x32, 0xF4, 0xEF, 0x0B, 0x6C, 0x72, 0x11, 0x93,
+    0x6D, 0x02, 0xB5, 0x19, 0xDC, 0xBB, 0x19, 0x5A, 0x6D, 0x50, 0x69, 0x85, 0x5A, 0x8B, 0xC9, 0x46,
+    0xAA, 0x8B, 0x91, 0x9F, 0x55, 0xAB, 0xD9, 0x34, 0x6A, 0x0C, 0x8A, 0x6E, 0xB2, 0x8A, 0x76, 0xAD,
+    0x34, 0x19, 0xFD, 0xA9, 0x16, 0xBC, 0x24, 0xAC, 0xA4, 0x44, 0xD0, 0xB3, 0x05, 0xAE, 0x01, 0xF6,
+    0xFD, 0xAD, 0x7B, 0x2D, 0xF7, 0x2F, 0x2E, 0xAE, 0x7E, 0x19, 0xB3, 0xE2, 0xA2, 0xC9, 0xF4, 0x53,
+    0x55, 0xB0, 0x09, 0x3F, 0x98, 0x4C, 0x37, 0x13, 0x38, 0xFE, 0x1E, 0xEA, 0x8C, 0x4D, 0xB8, 0x88,
+    0x30, 0xA7, 0x7F, 0x06, 0xAA, 0x0D, 0xB3, 0x62, 0x13, 0x5D, 0xE4, 0xA9, 0x7D, 0x26, 0x4D, 0xC2,
+    0xAC, 0xD4, 0x99, 0x2A, 0x53, 0x6D, 0x50, 0xA0, 0x80, 0x2E, 0xFD, 0x29, 0x50, 0xA8, 0x36, 0xEA,
+    0x8C, 0xC9, 0x34, 0x2B, 0x6D, 0xC2, 0x26, 0xFA, 0x09, 0x37, 0x22, 0xEA, 0x8D, 0x66, 0xC5, 0xCE,
+    0x3C, 0x39, 0x1E, 0x56, 0x30, 0x81, 0x1B, 0xA8, 0x32, 0xDF, 0x6D, 0x66, 0x74, 0x7B, 0x68, 0x54,
+    0xC2, 0xF7, 0x83, 0x36, 0xBC, 0x96, 0x46, 0x3F, 0x1E, 0x42, 0xA0, 0xC9, 0x77, 0x68, 0x5F, 0xCD,
+    0x5C, 0x31, 0x0B, 0xFC, 0x01, 0x70, 0x65, 0x00, 0x07, 0x64, 0x30, 0x09, 0x6C, 0x04, 0x47, 0x23,
+    0xE9, 0x25, 0xA9, 0x78, 0x69, 0xBD, 0xE1, 0x6F, 0x0C, 0x8F, 0xBE, 0x85, 0xBF, 0x80, 0xEA, 0xBA,
+    0xD9, 0x9A, 0xDC, 0x2E, 0x36, 0x75, 0xD1, 0x8D, 0x8E, 0xA7, 0xCE, 0x9E, 0xD3, 0xAF, 0xF4, 0x40,
+    0xF9, 0x8A, 0xC9, 0xE1, 0xDD, 0xEC, 0xC7, 0x01, 0x10, 0xE0, 0x47, 0x70, 0x11, 0xBA, 0x19, 0x6C,
+    0x82, 0x76, 0x01, 0x93, 0xA1, 0xDE, 0x8E, 0x06, 0x7F, 0x5F, 0xA3, 0xEA, 0xAB, 0x8D, 0x2E, 0xAE,
+    0x5A, 0x23, 0x9D, 0x16, 0xBC, 0x32, 0x7A, 0x77, 0x33, 0x32, 0xA5, 0xD9, 0x6A, 0xD9, 0x5C, 0xCB,
+    0x2E, 0xB5, 0xBA, 0x54, 0x97, 0x3E, 0xD5, 0xC5, 0xCD, 0xA6, 0xB8, 0xD9, 0x6C, 0x6E, 0x6A, 0xB2,
+    0x9B, 0xDA, 0xEC, 0x26, 0xBB, 0xBA, 0xA9, 0x4B, 0x6E, 0x76, 0xA9, 0x7F, 0xA0, 0xD8, 0x49, 0x43,
+    0xAB, 0x42, 0xAD, 0x05, 0x1E, 0x03, 0x08, 0xD4, 0x8A, 0x8D, 0xE6, 0x56, 0x6B, 0xA7, 0xCD, 0x16,
+    0xD5, 0x9B, 0x8F, 0xFF, 0xB2, 0x9F, 0xB1, 0x0B, 0x26, 0x53, 0x09, 0x7C, 0xE4, 0x91, 0xFB, 0x10,
+    0x71, 0x97, 0xEF, 0xF7, 0x2B, 0xAC, 0xD4, 0xD2, 0x64, 0xA4, 0x8C, 0x3E, 0xD6, 0x60, 0x07, 0x37,
+    0x57, 0xD8, 0x15, 0xCC, 0xF9, 0xD4, 0x46, 0x08, 0x11, 0xC2, 0x04, 0x3A, 0xFD, 0x22, 0x95, 0x22,
+    0x95, 0x46, 0x2A, 0x0D, 0xD4, 0xFA, 0xE8, 0x6C, 0x90, 0x34, 0x7B, 0x69, 0xE9, 0xA5, 0xBC, 0x77,
+    0xFE, 0x1D, 0xDD, 0xAA, 0xA4, 0xB5, 0x96, 0x32, 0xE5, 0xF9, 0xC2, 0xBF, 0x35, 0x05, 0xEA, 0xB2,
+    0xF7, 0xDD, 0x66, 0xAA, 0xB0, 0xE0, 0x34, 0xE2, 0x36, 0xF0, 0x8A, 0xD0, 0x27, 0xB0, 0xCB, 0xE9,
+    0x37, 0xD0, 0xA7, 0x2F, 0xFE, 0xB5, 0x66, 0x49, 0x51, 0x12, 0x37, 0xB5, 0xC0, 0x13, 0x70, 0xC8,
+    0xA4, 0x09, 0x42, 0x02, 0x9F, 0xC1, 0x8B, 0xBD, 0xA7, 0xFB, 0x13, 0xEE, 0xCD, 0x44, 0xFF, 0x4E,
+    0xA6, 0x7B, 0x5F, 0x74, 0x73, 0x18, 0x6D, 0x72, 0x93, 0x4D, 0x36, 0xB5, 0xE5, 0x76, 0x79, 0x51,
+    0x52, 0x92, 0x94, 0x9F, 0x3A, 0x0B, 0xFF, 0x77, 0x5F, 0xCA, 0x26, 0xEF, 0x32, 0xA1, 0x01, 0xFA,
+    0x7D, 0x83, 0xC5, 0x46, 0x9A, 0x6B, 0x69, 0x41, 0x5C, 0x5A, 0xF8, 0x05, 0x8C, 0x0A, 0x95, 0x94,
+    0xF0, 0x12, 0x8F, 0xFF, 0x50, 0x13, 0x74, 0xCB, 0x3E, 0x21, 0x34, 0x80, 0x9F, 0x06, 0x5C, 0xEA,
+    0xFF, 0x47, 0x58, 0x5B, 0x29, 0xD7, 0xD2, 0x4A, 0xAF, 0x7B, 0x70, 0xE5, 0xA4, 0xF0, 0x2A, 0x6C,
+    0x58, 0xE5, 0xDD, 0x24, 0xBE, 0xF8, 0x37, 0x46, 0xD0, 0xE6, 0x5D, 0x92, 0x6E, 0xFE, 0x77, 0xB8,
+    0x77, 0x35, 0x38, 0x69, 0xF2, 0xD2, 0x1C, 0x52, 0x9F, 0x42, 0xEC, 0x52, 0x18, 0xBB, 0x14, 0x86,
+    0x2E, 0x85, 0xB1, 0x9F, 0x43, 0xF4, 0x93, 0xFF, 0x40, 0xD1, 0x49, 0x58, 0x6D, 0xD4, 0x9A, 0xE1,
+    0x31, 0x68, 0x25, 0x99, 0x43, 0x51, 0xC9, 0x49, 0x0B, 0xD8, 0xBC, 0x4F, 0xCE, 0x94, 0xDD, 0x39,
+    0xA2, 0x01, 0x14, 0xC1, 0x4F, 0xE0, 0xE6, 0x5D, 0xDB, 0xDD, 0xD1, 0xB0, 0xDD, 0x2E, 0x1A, 0x56,
+    0x1A, 0xF7, 0x86, 0x61, 0x3A, 0x97, 0x5A, 0x0B, 0xB5, 0x14, 0x6B, 0x69, 0x45, 0xCF, 0x08, 0x3F,
+    0xBA, 0xD8, 0xCF, 0x36, 0xB5, 0x6B, 0xB3, 0xA2, 0x67, 0x33, 0xBD, 0x36, 0x6A, 0xAD, 0xD4, 0xDA,
+    0x30, 0xD2, 0x64, 0x64, 0x73, 0x5D, 0xD0, 0x20, 0xFA, 0xD9, 0xC5, 0x66, 0xB5, 0xA9, 0x2E, 0x46,
+    0xB5, 0x08, 0xD2, 0x68, 0xA5, 0x88, 0xD7, 0xB0, 0xBB, 0xB0, 0xC3, 0x10, 0x3B, 0xE5, 0x4A, 0x5A,
+    0xED, 0xE6, 0x53, 0x88, 0xEE, 0x9D, 0x82, 0x9E, 0x4B, 0xA6, 0xB8, 0x68, 0x57, 0xE1, 0xDF, 0x29,
+    0x46, 0xCF, 0x49, 0xB9, 0x93, 0x52, 0x2F, 0x3F, 0x3E, 0xF9, 0xDF, 0xB7, 0x5D, 0x6B, 0x1A, 0x69,
+    0xF3, 0x1F, 0xFC, 0x91, 0x26, 0xA7, 0x82, 0x34, 0xD7, 0x5A, 0x4F, 0x56, 0x52, 0x15, 0x23, 0x23,
+    0xB3, 0xF1, 0xCA, 0xE5, 0x4D, 0x79, 0x05, 0x17, 0xC3, 0x14, 0xA2, 0x1F, 0x1F, 0xDB, 0x1B, 0xE1,
+    0x92, 0x11, 0x6E, 0x7A, 0xB4, 0xD9, 0x7E, 0x5D, 0x1D, 0x4C, 0xC6, 0x8F, 0x36, 0x51, 0xE8, 0xA3,
+    0x59, 0x78, 0xE1, 0xFC, 0xD5, 0xCB, 0xD0, 0x8F, 0xB4, 0x85, 0x5A, 0x33, 0x61, 0xA5, 0x2F, 0xB4,
+    0x1A, 0xF1, 0x33, 0x95, 0xEE, 0x51, 0x85, 0x0D, 0x7A, 0x8D, 0xB4, 0x5A, 0xA8, 0x34, 0xC3, 0xCD,
+    0x11, 0xBE, 0x05, 0xF0, 0x1F, 0xCE, 0xCE, 0xFE, 0xA7, 0xA4, 0x0F, 0x25, 0xFD, 0xD7, 0xB3, 0xB3,
+    0x3F, 0x3F, 0xBA, 0xBB, 0xEC, 0xD3, 0x4E, 0x5A, 0x9F, 0xA0, 0x59, 0xA0, 0xDB, 0xA0, 0xD7, 0x40,
+    0xAB, 0x89, 0x4A, 0xCB, 0x6E, 0xF2, 0xDD, 0x4A, 0xAD, 0xB9, 0x0A, 0x1B, 0xA1, 0x0C, 0xBD, 0xC6,
+    0x4A, 0x13, 0xCD, 0x02, 0xFF, 0xF8, 0x92, 0xF4, 0x61, 0x35, 0xD2, 0x24, 0xE5, 0xFE, 0x4F, 0xF5,
+    0x38, 0x6E, 0xC2, 0x2E, 0x34, 0x99, 0xB6, 0x60, 0xF7, 0x3F, 0x1B, 0x6D, 0xC6, 0x64, 0x28, 0xE7,
+    0x2B, 0x3D, 0x60, 0x32, 0xB5, 0x06, 0x42, 0xA4, 0x9B, 0x61, 0x00, 0x78, 0x5C, 0xB7, 0xA0, 0x92,
+    0x0A, 0x58, 0x49, 0x11, 0x7F, 0x8F, 0x3E, 0x55, 0x82, 0x66, 0x35, 0x2B, 0x54, 0xD9, 0xA6, 0x56,
+    0xF3, 0xD6, 0x45, 0xAF, 0x74, 0xC7, 0xFD, 0x58, 0xCF, 0xCF, 0x77, 0x9C, 0x59, 0xED, 0xF4, 0x82,
+    0x6F, 0x92, 0x8D, 0x77, 0xEE, 0xD8, 0xB9, 0x8B, 0xDB, 0x1D, 0x3B, 0xF5, 0x63, 0xBE, 0x63, 0xA3,
+    0x7B, 0x3A, 0xDF, 0xB1, 0x53, 0x68, 0x96, 0x3B, 0xF6, 0x4B, 0xDD, 0x9E, 0x7D, 0xA3, 0xF7, 0x34,
+    0xBA, 0xEF, 0x97, 0x66, 0xA3, 0x8F, 0xB0, 0x2F, 0x2C, 0x34, 0x65, 0xF8, 0x47, 0x91, 0x4A, 0x52,
+    0x84, 0x5E, 0x1A, 0xA1, 0x3A, 0xBB, 0x05, 0x60, 0x34, 0x40, 0x5F, 0x00, 0xAD, 0xD0, 0x2A, 0x81,
+    0xBB, 0x1F, 0xA9, 0xB7, 0x00, 0xF6, 0xD3, 0x0C, 0xE1, 0x07, 0x09, 0x93, 0xBB, 0x89, 0x7E, 0xF2,
+    0x43, 0xA5, 0xAA, 0x60, 0x97, 0x66, 0xC5, 0x7F, 0x74, 0x7B, 0x36, 0x92, 0x62, 0x27, 0x09, 0x49,
+    0xB9, 0xC9, 0xD8, 0xE4, 0x66, 0xDC, 0xAB, 0x02, 0x3D, 0xB7, 0x62, 0x36, 0x1F, 0x69, 0x57, 0x9C,
+    0xEE, 0x61, 0xB4, 0x47, 0xDD, 0xD8, 0x4A, 0x05, 0x8D, 0x2E, 0xD9, 0xA5, 0x16, 0xC2, 0xCD, 0x5D,
+    0x6A, 0x72, 0xAD, 0x9F, 0xED, 0xBB, 0xD5, 0x48, 0x09, 0x27, 0x4D, 0x4D, 0xAE, 0x45, 0x18, 0xED,
+    0x62, 0x17, 0x34, 0x68, 0xE8, 0x96, 0x2E, 0x19, 0x55, 0xFA, 0x99, 0xE6, 0x5E, 0xCA, 0x46, 0x2A,
+    0x38, 0x95, 0x8B, 0xF8, 0xF0, 0x05, 0x84, 0xDD, 0xE7, 0xAC, 0xA8, 0x84, 0x68, 0xC5, 0xB7, 0xF0,
+    0x33, 0x18, 0xB1, 0xEF, 0x4E, 0x42, 0xDC, 0xB7, 0x26, 0x76, 0x01, 0xDC, 0x04, 0x95, 0x06, 0x68,
+    0xB6, 0xF3, 0x47, 0x33, 0xA0, 0x89, 0xA1, 0xD2, 0x07, 0xB7, 0x31, 0x52, 0xC6, 0x48, 0x89, 0x4A,
+    0x65, 0x80, 0xAB, 0x00, 0x4E, 0xB7, 0x40, 0x5A, 0x69, 0xA4, 0x4C, 0x2F, 0xAD, 0x68, 0xF4, 0xC9,
+    0x6C, 0xF8, 0xD9, 0x26, 0x34, 0xFA, 0x58, 0xAB, 0x16, 0x6D, 0xB6, 0x2B, 0x7D, 0x72, 0x13, 0x1A,
+    0x85, 0x29, 0x4D, 0xA6, 0x5B, 0xFA, 0x44, 0x88, 0x1A, 0x9B, 0x62, 0x36, 0x5C, 0xEA, 0x52, 0xA3,
+    0xD1, 0x7F, 0xAC, 0xB5, 0xD6, 0xBE, 0x91, 0x17, 0x9C, 0x56, 0xC0, 0xED, 0xB7, 0x73, 0x23, 0x2D,
+    0xB5, 0x94, 0xD1, 0xB8, 0x8B, 0x7B, 0xEE, 0x65, 0x75, 0xF6, 0x0A, 0xD2, 0x86, 0x3B, 0x79, 0xD9,
+    0x73, 0xD7, 0x7B, 0xB4, 0xEC, 0x12, 0x34, 0xE5, 0xEC, 0xE5, 0xFD, 0x73, 0x15, 0x9C, 0x34, 0x9E,
+    0xF7, 0x3C, 0xFD, 0x1D, 0x3D, 0xC3, 0xA3, 0x3D, 0x4B, 0xF3, 0xAF, 0xF7, 0x7C, 0xD9, 0xD3, 0xBB,
+    0x73, 0xDF, 0xB6, 0xEB, 0xE9, 0xF0, 0x4A, 0x19, 0x95, 0xDB, 0x73, 0xAB, 0xA1, 0x1E, 0x7C, 0x3A,
+    0xAD, 0xC2, 0x7A, 0xB1, 0x0A, 0x67, 0x67, 0x76, 0x6D, 0xB4, 0xBA, 0xA9, 0xD7, 0x5B, 0x1A, 0x82,
+    0x9A, 0x8D, 0x26, 0xDB, 0x85, 0x7E, 0x76, 0x33, 0x1A, 0x34, 0x99, 0x5C, 0xE9, 0x83, 0x90, 0x6A,
+    0xED, 0xDE, 0xB2, 0x50, 0x49, 0xB7, 0x0E, 0xFF, 0xEF, 0x26, 0xC2, 0x60, 0x17, 0xDC, 0xD4, 0x64,
+    0xBA, 0x54, 0x8B, 0x36, 0xA3, 0xB1, 0x2E, 0xB8, 0x09, 0x0D, 0x76, 0xC1, 0xC5, 0xE3, 0xCD, 0xD9,
+    0xED, 0x8C, 0x0E, 0x0D, 0x68, 0xB0, 0xDA, 0xB5, 0xB5, 0x7F, 0xB3, 0xA2, 0xD1, 0x1C, 0xDF, 0x74,
+    0x09, 0x7F, 0xBC, 0x29, 0xB4, 0x2B, 0x1A, 0xCC, 0xB6, 0xBF, 0x01, 0xAF, 0xB9, 0x55, 0x41, 0x8A,
+    0x95, 0x26, 0xEC, 0x02, 0x82, 0x2E, 0x51, 0x0B, 0xDC, 0x8C, 0xD9, 0xC0, 0x45, 0x9A, 0x0C, 0x61,
+    0xC4, 0xAE, 0xA0, 0x81, 0x2E, 0xED, 0xE0, 0x21, 0xE1, 0xF6, 0xAF, 0x83, 0x26, 0xA0, 0x59, 0x77,
+    0x33, 0xD3, 0x80, 0xC9, 0xBB, 0x36, 0x43, 0xC4, 0x94, 0xDD, 0x02, 0x7D, 0xA4, 0x12, 0xB4, 0x17,
+    0x8D, 0x9A, 0xBC, 0x87, 0x17, 0x8D, 0x98, 0xC3, 0x4F, 0xFB, 0x48, 0x2D, 0xB0, 0x2B, 0xB8, 0x09,
+    0x23, 0x9E, 0x0C, 0x2B, 0x41, 0xB1, 0x56, 0xA6, 0xD5, 0x01, 0x11, 0xDD, 0x54, 0x0B, 0x9B, 0x6A,
+    0x0D, 0x4D, 0xAE, 0x34, 0xD6, 0xAA, 0x34, 0xA2, 0x51, 0x11, 0x37, 0x29, 0x62, 0x93, 0x22, 0x4D,
+    0x0E, 0x13, 0x75, 0xF1, 0x33, 0x28, 0xCC, 0xE0, 0xB4, 0x80, 0x55, 0x81, 0x46, 0x8A, 0xD4, 0xB2,
+    0x0B, 0xE8, 0x19, 0x81, 0x9B, 0x42, 0xA4, 0x4B, 0x76, 0xA5, 0xC9, 0x46, 0xD4, 0x05, 0x3F, 0xA1,
+    0xC1, 0xAE, 0xB8, 0x58, 0x6B, 0x5F, 0x10, 0x93, 0xC1, 0x47, 0xDA, 0x0C, 0x1A, 0x2F, 0x2B, 0xA9,
+    0xFC, 0x26, 0x25, 0x2D, 0x17, 0x4A, 0x3A, 0xFB, 0x69, 0x2F, 0xDD, 0x95, 0x56, 0x27, 0x0D, 0xB8,
+    0x4C, 0xA5, 0xD9, 0x28, 0xE2, 0x0A, 0x3E, 0xD3, 0x68, 0x6A, 0x15, 0x51, 0x46, 0x99, 0x4E, 0xD1,
+    0x2A, 0x9A, 0x2F, 0x57, 0xCA, 0x86, 0x0F, 0x43, 0xF7, 0xDE, 0x64, 0x3F, 0x5E, 0xEA, 0x6D, 0xAB,
+    0xB2, 0x70, 0x6F, 0x4E, 0xEE, 0x27, 0xC9, 0xE4, 0xD2, 0x7C, 0x52, 0x70, 0xFF, 0x6D, 0x2E, 0xFD,
+    0xD4, 0x2C, 0x77, 0xBA, 0xBB, 0x99, 0xD0, 0xFE, 0x6A, 0x75, 0xD1, 0xA6, 0xE0, 0x4D, 0x46, 0x8D,
+    0x66, 0x3F, 0x76, 0xB3, 0xCF, 0xED, 0x52, 0x6D, 0x8D, 0x46, 0xD1, 0x47, 0x9F, 0x6C, 0x32, 0xB9,
+    0x29, 0x55, 0xC1, 0x45, 0x17, 0xBB, 0x19, 0xDC, 0x42, 0x9B, 0xD0, 0x8C, 0x8B, 0x8D, 0x22, 0xA2,
+    0xD7, 0xD0, 0xAC, 0xA8, 0xD0, 0x4F, 0x46, 0x19, 0x61, 0xEF, 0x2F, 0x26, 0xE3, 0x6F, 0xCE, 0xDD,
+    0x5C, 0x6F, 0x2E, 0x86, 0xD1, 0x26, 0xD5, 0x1B, 0xEE, 0xB5, 0x62, 0x53, 0x55, 0x4C, 0x76, 0xB1,
+    0x59, 0xED, 0x27, 0x85, 0x7E, 0xEA, 0x3F, 0x5C, 0x10, 0xFE, 0x7E, 0x34, 0x19, 0x89, 0x6E, 0xAE,
+    0x95, 0x09, 0x43, 0xA3, 0xB9, 0xCE, 0x58, 0x0D, 0x36, 0xD1, 0x67, 0x5C, 0xC4, 0xA7, 0x4B, 0xE8,
+    0x06, 0x2B, 0x45, 0x9C, 0x94, 0xD0, 0xC3, 0xB0, 0x18, 0x8D, 0x5D, 0x6E, 0x0A, 0x6D, 0xB6, 0x99,
+    0x66, 0xEB, 0x16, 0xCC, 0xD6, 0x27, 0xCC, 0xE6, 0x66, 0xCC, 0xE6, 0x26, 0x9A, 0xEC, 0x26, 0xDA,
+    0xEC, 0x27, 0x6C, 0xF6, 0x13, 0x76, 0x75, 0x13, 0x7D, 0x72, 0x33, 0x7E, 0x76, 0x4B, 0xA5, 0xD8,
+    0x95, 0x1F, 0x69, 0xB0, 0x52, 0xD9, 0xDD, 0x31, 0x5E, 0x23, 0x3B, 0x6E, 0x70, 0x7A, 0x65, 0xF7,
+    0x74, 0x87, 0x8B, 0xDE, 0xD0, 0xE8, 0xE6, 0xC3, 0x45, 0x77, 0xA9, 0x4B, 0xB5, 0x6A, 0xE1, 0x66,
+    0x37, 0x77, 0xD9, 0x48, 0x1A, 0xDD, 0xE1, 0x9E, 0x08, 0x1F, 0x5D, 0xDB, 0x7D, 0xA7, 0x86, 0xDD,
+    0x9A, 0x2B, 0x01, 0xFD, 0x7C, 0x20, 0xB9, 0x4B, 0x28, 0xFE, 0xEF, 0x9B, 0x91, 0xF9, 0xB5, 0x19,
+    0xCD, 0xBF, 0xC5, 0x8C, 0x6E, 0x6A, 0xB0, 0xDA, 0x91, 0xD2, 0x72, 0x60, 0xDF, 0xCA, 0xCF, 0x40,
+    0xBF, 0xB0, 0x03, 0x32, 0x9A, 0xC2, 0xEE, 0x7F, 0x9C, 0x6E, 0x61, 0xA4, 0x09, 0x2F, 0x0D, 0x6D,
+    0x09, 0x19, 0x8D, 0x21, 0xDA, 0xC5, 0x6C, 0x08, 0x37, 0xED, 0x81, 0x08, 0x45, 0xF7, 0x20, 0x2C,
+    0xE6, 0x70, 0x82, 0x43, 0x23, 0x45, 0xC2, 0xDD, 0x0D, 0xBB, 0xF6, 0x09, 0x7D, 0x5F, 0x74, 0xC9,
+    0xAE, 0x95, 0x08, 0xB1, 0x9F, 0xCD, 0x66, 0x36, 0x5C, 0x72, 0x53, 0xAD, 0x81, 0x3D, 0xBC, 0xDF,
+    0x63, 0x87, 0x4F, 0xB9, 0xD2, 0x47, 0xD9, 0x88, 0x6F, 0x9B, 0xB2, 0x47, 0x1D, 0x23, 0xA8, 0x35,
+    0xED, 0x81, 0xD6, 0x15, 0xB0, 0x1A, 0xA9, 0x4F, 0xE8, 0xD0, 0x4D, 0xE0, 0xA6, 0x6B, 0xF8, 0xE9,
+    0x85, 0x1F, 0x2A, 0x7A, 0x69, 0xF0, 0xDA, 0xE8, 0x34, 0xC3, 0x13, 0xE0, 0xA4, 0xCD, 0x49, 0x9B,
+    0x97, 0xB2, 0x97, 0x32, 0x6E, 0x3E, 0x3E, 0x89, 0xE0, 0xE3, 0xEE, 0x54, 0x35, 0x82, 0x06, 0x2A,
+    0xED, 0x8B, 0x50, 0xEB, 0x18, 0x77, 0xDB, 0x1D, 0x76, 0x9B, 0x77, 0xC7, 0x62, 0x57, 0x4E, 0x2B,
+    0x66, 0xB6, 0x4A, 0x34, 0xB9, 0x16, 0x4D, 0xAE, 0x0B, 0xED, 0x6A, 0x36, 0xEC, 0x6A, 0x36, 0xEC,
+    0xD2, 0x64, 0xBA, 0xD4, 0x66, 0xFA, 0x64, 0x57, 0xDC, 0x6C, 0x17, 0xDC, 0x64, 0x13, 0x2E, 0x76,
+    0x09, 0x1F, 0xFB, 0x44, 0x88, 0x6E, 0x46, 0xA3, 0x9B, 0xD0, 0xE0, 0xA6, 0x5A, 0xB8, 0xD4, 0x14,
+    0xFA, 0x72, 0x33, 0x63, 0xA5, 0x85, 0x46, 0x9A, 0x21, 0x94, 0x1D, 0x09, 0xE1, 0x47, 0xFA, 0x0F,
+    0x33, 0x4D, 0x76, 0x11, 0xBD, 0x98, 0xE9, 0x92, 0x8B, 0xA6, 0x98, 0x8C, 0x8F, 0x2E, 0xB6, 0x6B,
+    0xBD, 0x21, 0xFA, 0xA9, 0x9F, 0xEB, 0xCD, 0x64, 0xBA, 0x29, 0x8C, 0xD5, 0x66, 0x13, 0xDD, 0x5F,
+    0x15, 0x28, 0x2E, 0x62, 0x3F, 0x5E, 0xA1, 0x08, 0xAC, 0x26, 0x50, 0x06, 0xAB, 0x61, 0xCF, 0x5A,
+    0xDA, 0x0D, 0xF0, 0x63, 0x55, 0x68, 0xBF, 0x28, 0xD8, 0x15, 0xF7, 0xFA, 0x8A, 0x9F, 0x6B, 0x75,
+    0xB3, 0xD1, 0x68, 0x17, 0x37, 0xDA, 0x82, 0x8F, 0x22, 0xAC, 0x66, 0x33, 0xD9, 0x68, 0xB6, 0xC9,
+    0xA6, 0xFE, 0x7E, 0x0C, 0xA3, 0x8B, 0x25, 0x98, 0x8C, 0x9A, 0x4F, 0x73, 0x37, 0x9B, 0xEC, 0xDE,
+    0x48, 0x1A, 0xEC, 0x27, 0x5B, 0xFF, 0x7A, 0xC6, 0xBD, 0x99, 0x42, 0x3F, 0x21, 0xF7, 0x74, 0x16,
+    0xE6, 0x61, 0x6E, 0x3E, 0x5F, 0xB0, 0xF7, 0xE7, 0x4E, 0x11, 0x27, 0x7C, 0x01, 0xAD, 0x95, 0x12,
+    0x46, 0xB1, 0xD1, 0x88, 0x15, 0xDD, 0x06, 0x6E, 0xD9, 0x77, 0x70, 0x9F, 0x70, 0x33, 0x3E, 0x1A,
+    0x81, 0x86, 0x7E, 0x61, 0xF7, 0xBF, 0x4D, 0xB6, 0x19, 0xEC, 0x12, 0x22, 0xF4, 0x1F, 0x9E, 0x13,
+    0x1C, 0xA8, 0xC0, 0x4E, 0xDC, 0xEC, 0xD3, 0xDA, 0xD5, 0xD6, 0x28, 0x03, 0xEE, 0xFE, 0x02, 0x46,
+    0x7D, 0x82, 0x3E, 0xF9, 0x48, 0xA5, 0x51, 0x23, 0x36, 0x1B, 0x81, 0x62, 0x93, 0x69, 0x37, 0xEC,
+    0x8A, 0x9F, 0x71, 0x3B, 0x1B, 0xF1, 0xE2, 0x46, 0x9F, 0xFA, 0xD9, 0x94, 0x4A, 0x28, 0xDA, 0xD4,
+    0x25, 0xF4, 0xCC, 0x46, 0xBB, 0x84, 0x88, 0x7F, 0x29, 0x61, 0xB4, 0xED, 0x29, 0x5E, 0xAD, 0xB4,
+    0x23, 0x62, 0x34, 0xEE, 0x91, 0x65, 0xDF, 0xBB, 0xE9, 0x08, 0xEE, 0x6E, 0xDA, 0x53, 0x73, 0x7C,
+    0xDC, 0x2D, 0x07, 0xBC, 0xB4, 0x07, 0xE4, 0x56, 0x2A, 0xF4, 0x52, 0x3A, 0x21, 0xC8, 0x15, 0x2A,
+    0xC5, 0x63, 0xC7, 0x69, 0x3A, 0x2D, 0xCB, 0x09, 0x7F, 0xB9, 0x04, 0xF5, 0x6F, 0x68, 0xF8, 0xF0,
+    0xEC, 0xE5, 0x46, 0xD2, 0xD8, 0x4B, 0x1B, 0x92, 0x12, 0x58, 0x0D, 0x8D, 0xA6, 0x5A, 0x09, 0x81,
+    0x1B, 0xB1, 0x13, 0x4D, 0xA2, 0xCE, 0x1C, 0xF7, 0xDD, 0x44, 0xBB, 0xDF, 0x97, 0x4B, 0xF7, 0x07,
+    0xF4, 0x76, 0x03, 0x5D, 0xA4, 0x4D, 0x98, 0xED, 0x1A, 0x5A, 0xF1, 0x1B, 0x4F, 0x9E, 0x81, 0x08,
+    0x78, 0xFC, 0xE0, 0x06, 0x37, 0xBA, 0xD8, 0xC7, 0x3E, 0x76, 0xD1, 0x4E, 0x76, 0xB6, 0xB3, 0x4D,
+    0x6D, 0x6A, 0x52, 0xB3, 0x98, 0xD5, 0xAC, 0x26, 0xD7, 0x19, 0xE8, 0x85, 0x55, 0x34, 0x9A, 0x69,
+    0x16, 0xAA, 0x0D, 0x02, 0xB8, 0x88, 0xDD, 0xEF, 0xF3, 0xA3, 0xF7, 0x17, 0x72, 0xD9, 0xE9, 0x91,
+    0xFB, 0xEA, 0xE6, 0x54, 0x2B, 0x11, 0x32, 0x4F, 0xFD, 0x39, 0xC0, 0x1F, 0x02, 0x61, 0x57, 0xB1,
+    0xD1, 0x40, 0xAB, 0x11, 0xFB, 0x66, 0xC4, 0x3D, 0x37, 0x11, 0xDA, 0x99, 0x6C, 0x92, 0x59, 0x4D,
+    0x6A, 0x52, 0xBD, 0xD8, 0xA9, 0x5A, 0xDD, 0x48, 0x7E, 0x0A, 0x7E, 0x7A, 0xF5, 0xC6, 0x8D, 0x4E,
+    0xFA, 0xCB, 0xB3, 0xB3, 0x97, 0x6F, 0x7C, 0x5F, 0x66, 0x33, 0xAB, 0x49, 0xD5, 0xEE, 0x69, 0x5C,
+    0xBA, 0x53, 0x29, 0x97, 0x46, 0xDA, 0x6C, 0xB9, 0x99, 0xBB, 0xD5, 0x66, 0x97, 0xDA, 0xD5, 0x4D,
+    0xED, 0xEA, 0xA3, 0x5D, 0x42, 0xB4, 0x7B, 0xCA, 0x1B, 0xDD, 0x1C, 0xA2, 0x9F, 0xC2, 0xFF, 0x51,
+    0xF4, 0x52, 0xEC, 0x15, 0x62, 0xBB, 0xB9, 0x71, 0xCF, 0x46, 0x0E, 0xE0, 0x6B, 0xF2, 0xB1, 0xF6,
+    0x61, 0xDC, 0x81, 0xC7, 0xFE, 0x30, 0xC4, 0xAA, 0x28, 0x13, 0xA4, 0xD1, 0x7D, 0xE1, 0x93, 0x5D,
+    0x9B, 0xDC, 0xE4, 0x4A, 0x55, 0xC1, 0xC7, 0x30, 0x74, 0xC9, 0xC5, 0x36, 0xDB, 0x64, 0x4A, 0x93,
+    0x2B, 0xD5, 0x42, 0x31, 0x3C, 0xD0, 0xE4, 0xA4, 0xD9, 0xBE, 0xA7, 0xB9, 0x49, 0x9A, 0xA0, 0x3A,
+    0xC1, 0xF3, 0xB5, 0x92, 0xA2, 0xD3, 0x6A, 0xCB, 0x8F, 0x9E, 0xD6, 0x80, 0x9B, 0x69, 0xB6, 0x73,
+    0xBC, 0x10, 0x46, 0xDA, 0x15, 0x42, 0xA4, 0xD1, 0x0F, 0xA3, 0x53, 0xAE, 0xA4, 0x68, 0xB4, 0x50,
+    0x9D, 0xA4, 0xA4, 0x79, 0xC4, 0x10, 0x35, 0x9C, 0x1B, 0xAC, 0x51, 0x37, 0x57, 0x2A, 0x05, 0x2F,
+    0x4D, 0xB6, 0xDC, 0xCC, 0x95, 0x06, 0x45, 0x97, 0xDA, 0xD5, 0x6C, 0x84, 0xC1, 0x47, 0xBB, 0xB4,
+    0x19, 0x11, 0xC6, 0x2E, 0xB5, 0x6B, 0x5D, 0x08, 0xD1, 0x4F, 0x6D, 0xE9, 0x32, 0x4E, 0x8A, 0xB5,
+    0x4A, 0xA6, 0x2D, 0x6E, 0xDC, 0xD9, 0x20, 0x00, 0xBF, 0x61, 0x77, 0x0F, 0x6E, 0x37, 0xBB, 0xF8,
+    0xD8, 0xBF, 0x53, 0xD0, 0x73, 0xCB, 0xCD, 0xEC, 0xA5, 0xD7, 0xA4, 0xB5, 0x2D, 0xAF, 0xD0, 0xCF,
+    0x10, 0x22, 0x95, 0xC6, 0x7F, 0x6E, 0xA4, 0x64, 0xA4, 0x58, 0xEB, 0x8B, 0x53, 0xB6, 0x7C, 0x05,
+    0x68, 0x15, 0xF7, 0x6D, 0xDC, 0x68, 0x81, 0x3E, 0x0D, 0xBB, 0xD0, 0xFB, 0x34, 0x14, 0xB1, 0x12,
+    0x78, 0xAD, 0xF0, 0xFC, 0x83, 0x61, 0x9F, 0x59, 0x2D, 0x76, 0xEF, 0xBC, 0x43, 0x6A, 0x9D, 0x66,
+    0xDD, 0xCF, 0xC7, 0x16, 0x35, 0x1B, 0x7B, 0x8C, 0xDD, 0x9B, 0x5F, 0x64, 0x32, 0xC7, 0xC7, 0xF5,
+    0xED, 0x15, 0xAC, 0x22, 0xB8, 0xD3, 0xAE, 0x3E, 0x65, 0xC4, 0xED, 0xDC, 0xE8, 0xB3, 0xB5, 0x91,
+    0x36, 0xA3, 0x3F, 0x53, 0xA5, 0x41, 0x51, 0xB1, 0x9F, 0xDD, 0xD4, 0xAE, 0x5D, 0x32, 0x5B, 0x9B,
+    0x51, 0x2D, 0x7C, 0x0C, 0xD1, 0xCD, 0x7D, 0xEA, 0x97, 0xB6, 0xDC, 0xCC, 0x95, 0x24, 0x9C, 0x42,
+    0xAC, 0xD5, 0xCF, 0x17, 0x86, 0x62, 0xC4, 0x0B, 0x3F, 0xD2, 0xD0, 0x49, 0x63, 0x23, 0x8D, 0xDC,
+    0x2C, 0xBF, 0x85, 0x25, 0x4D, 0x55, 0xD1, 0x46, 0x90, 0xA2, 0xDB, 0x7C, 0xB2, 0xB9, 0xC9, 0x4D,
+    0x41, 0x95, 0xF0, 0x31, 0x8C, 0xFD, 0xEC, 0x26, 0xBB, 0xD8, 0x64, 0xB6, 0xE6, 0x5C, 0x8E, 0x8B,
+    0x87, 0xB9, 0xC9, 0x3B, 0xCB, 0x56, 0x67, 0xFC, 0xD4, 0x64, 0xDC, 0x3E, 0x2F, 0x9B, 0x2A, 0xD1,
+    0x27, 0x53, 0xF6, 0x2C, 0xC0, 0xC7, 0x76, 0x45, 0xC3, 0x57, 0x18, 0x7D, 0x7F, 0xE0, 0x8F, 0x3A,
+    0x83, 0x9B, 0x68, 0x36, 0x4E, 0x9F, 0xEF, 0xB9, 0x71, 0x25, 0xE8, 0x13, 0xA6, 0x3C, 0x02, 0x61,
+    0xD7, 0x13, 0x84, 0xAD, 0x2E, 0x41, 0xD8, 0x09, 0xB3, 0x5D, 0x46, 0xB8, 0xDD, 0xC2, 0xCF, 0x44,
+    0xBB, 0x53, 0x16, 0xED, 0x76, 0xF4, 0x79, 0x8E, 0x7A, 0x9A, 0x7C, 0x68, 0xC1, 0x5E, 0x18, 0x6C,
+    0x53, 0x2A, 0x55, 0x1A, 0xFB, 0xD9, 0xCF, 0x66, 0xB3, 0x2B, 0xEE, 0x6E, 0xA1, 0xC9, 0x1A, 0xF1,
+    0x9A, 0x69, 0x95, 0x41, 0x9A, 0xB0, 0x12, 0x95, 0x5E, 0x5A, 0xE8, 0x93, 0x62, 0x5D, 0x9A, 0x0D,
+    0x37, 0xB9, 0x64, 0x72, 0xA5, 0xC1, 0x47, 0xBB, 0x1E, 0xA3, 0xB8, 0xD8, 0x64, 0x42, 0xB4, 0x2B,
+    0x1A, 0x76, 0x55, 0xCC, 0xBF, 0x59, 0x15, 0xE6, 0x2B, 0xAA, 0x00, 0xD7, 0x6E, 0xB5, 0x86, 0xEE,
+    0x0D, 0xDD, 0x55, 0x6A, 0xBF, 0xD4, 0x43, 0x15, 0xA3, 0x5F, 0xEA, 0x81, 0xA2, 0xA2, 0x4F, 0x5D,
+    0x72, 0x73, 0xB7, 0x34, 0xB9, 0x4B, 0x6D, 0xAE, 0x4B, 0xBB, 0xD6, 0x05, 0x3D, 0xB3, 0xA1, 0xC1,
+    0x4D, 0xC2, 0x45, 0x9B, 0x7C, 0xEC, 0x52, 0x93, 0xFB, 0xD4, 0xAE, 0x75, 0x69, 0x57, 0xB3, 0x9D,
+    0x5E, 0x47, 0xE1, 0x62, 0x77, 0xBC, 0x3E, 0x1F, 0x88, 0xEE, 0x0D, 0x4D, 0xED, 0x97, 0xCA, 0x46,
+    0xBF, 0x14, 0x8A, 0x3E, 0xBA, 0xD9, 0xA6, 0x2E, 0x35, 0xB9, 0x5D, 0xEB, 0x62, 0x36, 0x34, 0x08,
+    0x37, 0xF9, 0x68, 0x53, 0xFF, 0x95, 0x87, 0xD1, 0xC7, 0x2E, 0x7D, 0x85, 0xD3, 0xCA, 0x76, 0xBB,
+    0xB9, 0x84, 0xC9, 0xFD, 0xAA, 0x10, 0xDE, 0x4B, 0xB5, 0x7C, 0x6C, 0x1F, 0x16, 0xDC, 0xC7, 0x2B,
+    0xBA, 0x39, 0x37, 0x39, 0x44, 0xF7, 0xBE, 0xFE, 0x44, 0x46, 0x5A, 0x8D, 0x34, 0xD6, 0xBA, 0x07,
+    0xDF, 0x3E, 0xAD, 0x4C, 0x0A, 0x11, 0xEF, 0x44, 0x2B, 0xAD, 0xE8, 0x03, 0x45, 0xBB, 0x36, 0xB9,
+    0x12, 0x3E, 0x76, 0x73, 0x93, 0xEB, 0x6D, 0x87, 0x22, 0xD9, 0x64, 0x34, 0xFA, 0xD8, 0xA5, 0x36,
+    0x1B, 0x11, 0x1E, 0x68, 0xDA, 0x39, 0x85, 0x50, 0xE8, 0x3E, 0xD5, 0x50, 0x97, 0xEA, 0x08, 0x8D,
+    0xBF, 0xBE, 0xD2, 0xCB, 0xB9, 0x86, 0xD3, 0x9D, 0x4A, 0x5B, 0x31, 0x27, 0xE7, 0xBC, 0x9C, 0x3B,
+    0xE7, 0xE5, 0xDC, 0x39, 0x8F, 0x17, 0x3C, 0x64, 0x78, 0x5F, 0xD1, 0x9D, 0x9C, 0x73, 0x0E, 0x23,
+    0x83, 0x06, 0x38, 0xE1, 0xB8, 0x03, 0xC3, 0x99, 0xED, 0x08, 0xC7, 0x60, 0xDF, 0xDE, 0xAA, 0x2D,
+    0xC4, 0xFE, 0x7E, 0x36, 0xD2, 0xE8, 0x56, 0x1A, 0x5D, 0x58, 0xE6, 0x70, 0x32, 0xDC, 0xFE, 0xC2,
+    0x70, 0x77, 0xBB, 0x06, 0xA0, 0xD5, 0x3D, 0x23, 0xC5, 0xA0, 0xD5, 0xAE, 0x0D, 0x1A, 0xB0, 0x1B,
+    0x84, 0x15, 0xA3, 0x85, 0x56, 0x91, 0xAE, 0x80, 0x4B, 0xD4, 0xFA, 0xD6, 0xE0, 0xE7, 0xA0, 0xDC,
+    0x4A, 0x83, 0xD7, 0xC4, 0x95, 0xDD, 0xB1, 0x39, 0x08, 0x50, 0x68, 0xB5, 0x79, 0x65, 0xAF, 0xFC,
+    0x9D, 0xED, 0xBA, 0x5D, 0xB1, 0x0B, 0x36, 0xD1, 0x25, 0xFA, 0x19, 0x37, 0xE1, 0x26, 0x5C, 0xC4,
+    0xBF, 0x35, 0x38, 0x8D, 0x4E, 0xA3, 0xD5, 0xC0, 0x35, 0x9A, 0x8C, 0xEA, 0x82, 0x8F, 0xFA, 0xCA,
+    0xE6, 0xAE, 0x0B, 0x21, 0x6A, 0x70, 0xB3, 0x8B, 0x76, 0xB1, 0xA9, 0xC9, 0x4D, 0x36, 0xAA, 0x54,
+    0x69, 0xF4, 0x6F, 0x6B, 0xB2, 0xFA, 0x72, 0x31, 0x7A, 0x90, 0x71, 0x8B, 0xDF, 0x49, 0x34, 0x3F,
+    0x9A, 0xCD, 0xC7, 0x36, 0xFB, 0x68, 0x17, 0x17, 0xFB, 0xE4, 0xA2, 0x8B, 0x2E, 0x86, 0xD1, 0x45,
+    0xD1, 0xBF, 0x56, 0x76, 0xCE, 0xFA, 0xDD, 0x95, 0xEE, 0xBD, 0x84, 0xD5, 0x84, 0x55, 0xC4, 0x6A,
+    0xC0, 0x6A, 0x87, 0x25, 0x6E, 0xEC, 0x17, 0x93, 0x5D, 0x74, 0x4B, 0x9B, 0x5D, 0xF4, 0x8B, 0x5D,
+    0x5C, 0xD4, 0xD2, 0x25, 0xF7, 0xAA, 0x16, 0x37, 0xB9, 0xD7, 0xBE, 0x5C, 0x7C, 0x74, 0x77, 0x3F,
+    0x5B, 0xC2, 0xE0, 0xDE, 0xF8, 0x6C, 0x11, 0xEE, 0xCD, 0x77, 0xFE, 0x7A, 0xC3, 0xBD, 0x77, 0xF7,
+    0xF3, 0x4C, 0x7F, 0xFF, 0x99, 0xCF, 0x57, 0x7A, 0x19, 0x25, 0xFA, 0x62, 0x34, 0xD3, 0x67, 0xA3,
+    0x48, 0x9F, 0x8D, 0x46, 0xFA, 0xC5, 0x08, 0x08, 0xB1, 0x5B, 0xD1, 0xA0, 0x68, 0x8A, 0xCD, 0x34,
+    0xD9, 0x47, 0xEC, 0xE7, 0x1B, 0xF4, 0x9A, 0x77, 0xE8, 0x8F, 0x12, 0x34, 0x3B, 0x23, 0xC3, 0x8E,
+    0xC8, 0xFA, 0xCF, 0xF3, 0x9E, 0x71, 0x77, 0x8B, 0x9B, 0xD1, 0xE8, 0xF7, 0x0A, 0x25, 0x7E, 0x34,
+    0x1B, 0x3E, 0xB6, 0x19, 0x17, 0xED, 0x82, 0x8B, 0x7D, 0xC2, 0x45, 0x37, 0xE1, 0x62, 0x88, 0xF4,
+    0x93, 0xA0, 0x7B, 0xBB, 0x40, 0xF7, 0xAB, 0x0C, 0xF6, 0xC3, 0x15, 0xEC, 0xFD, 0x04, 0x56, 0xF3,
+    0x11, 0x84, 0x5A, 0x8D, 0xD0, 0x88, 0x83, 0xE8, 0x6A, 0xF2, 0x79, 0xD8, 0x48, 0xF0, 0x94, 0x22,
+    0x38, 0x0D, 0x47, 0xC8, 0x70, 0x33, 0xC0, 0xCE, 0xAF, 0xCD, 0x9D, 0x34, 0x5C, 0x7D, 0x3E, 0x43,
+    0x88, 0xB4, 0x1B, 0xF8, 0x69, 0xF7, 0x93, 0x09, 0xB3, 0x5B, 0x57, 0xA5, 0x81, 0xEE, 0x8B, 0x1B,
+    0x48, 0x9B, 0x91, 0x52, 0x27, 0x45, 0xF8, 0x67, 0x91, 0x2E, 0x63, 0x34, 0xE2, 0xEF, 0xD1, 0x26,
+    0x10, 0xD8, 0x99, 0x6A, 0x83, 0x3E, 0x62, 0x32, 0x84, 0xB1, 0x52, 0xA2, 0x5F, 0x30, 0x1A, 0xF8,
+    0x4E, 0x86, 0x7E, 0xA2, 0xDA, 0xA0, 0x8B, 0xBB, 0x9B, 0x8E, 0x98, 0x15, 0xFC, 0xB8, 0xE7, 0x6C,
+    0x0B, 0x95, 0x06, 0xAA, 0x97, 0xE1, 0xCE, 0xDF, 0x71, 0xFD, 0x7B, 0xBE, 0x3B, 0x60, 0x57, 0x8C,
+    0x06, 0xC2, 0x4C, 0xB3, 0x9E, 0x80, 0x5B, 0x1F, 0xB1, 0x33, 0x66, 0x05, 0x41, 0xBF, 0x52, 0x8B,
+    0x5A, 0xD1, 0x68, 0xAE, 0xF4, 0x9B, 0x80, 0xDC, 0xE3, 0x1A, 0x2B, 0x45, 0xFC, 0xC4, 0x93, 0x03,
+    0x3C, 0xFE, 0x0A, 0x8F, 0xA9, 0x0C, 0x1F, 0x4A, 0x7A, 0xE9, 0x47, 0x2A, 0xD7, 0xAA, 0x83, 0xC7,
+    0xFF, 0x36, 0x03, 0xFF, 0xA5, 0x5A, 0xD0, 0xB3, 0x9B, 0x29, 0x76, 0xB5, 0xD9, 0x25, 0x97, 0x14,
+    0xC3, 0x6B, 0x42, 0x2F, 0x16, 0xFC, 0xAB, 0xC2, 0x4D, 0x1A, 0xFA, 0x14, 0xA2, 0x4D, 0x2E, 0xB6,
+    0x73, 0x3F, 0x56, 0x3C, 0x06, 0xD7, 0xAA, 0xA1, 0x49, 0x5D, 0x6C, 0xD7, 0x7E, 0x6A, 0x72, 0x97,
+    0xCC, 0x66, 0x97, 0x5A, 0x6D, 0x46, 0xCF, 0xE4, 0x5A, 0x6D, 0x6E, 0xB6, 0x3E, 0x75, 0x8B, 0x9F,
+    0xDC, 0xAC, 0x21, 0xBC, 0x58, 0xE8, 0x59, 0x79, 0x8C, 0x6F, 0x03, 0xD5, 0xF5, 0xD3, 0xA2, 0x75,
+    0x33, 0xEC, 0xD4, 0x6E, 0x3F, 0x72, 0x70, 0x92, 0x9C, 0x20, 0xB7, 0xC6, 0xDD, 0xBC, 0x6A, 0x65,
+    0xB0, 0x5F, 0x26, 0x08, 0x37, 0x23, 0x26, 0x07, 0xE8, 0xDF, 0xCE, 0xA0, 0x66, 0xA1, 0x5D, 0xBA,
+    0x09, 0x1F, 0xFD, 0x68, 0xB6, 0xAA, 0xD0, 0x3D, 0xFC, 0xD9, 0x8A, 0xA4, 0xD4, 0x48, 0x8A, 0x4E,
+    0x52, 0x25, 0x4C, 0xB6, 0x2B, 0x36, 0xF9, 0x88, 0x7B, 0xA7, 0x80, 0x9E, 0xDF, 0x1D, 0x09, 0xD5,
+    0x0D, 0x1E, 0x61, 0x4B, 0xE3, 0x0E, 0x69, 0xE1, 0xFA, 0x49, 0x0A, 0xA3, 0xE1, 0x10, 0xC3, 0x6A,
+    0x84, 0x5E, 0x71, 0xA7, 0x93, 0x09, 0x37, 0x23, 0xA8, 0x8F, 0xD4, 0x5B, 0x1F, 0x77, 0x3E, 0xB9,
+    0x5D, 0xBA, 0x89, 0x2E, 0x75, 0x33, 0x6E, 0xEA, 0x66, 0xFC, 0x47, 0xB7, 0x67, 0x24, 0xA5, 0x4A,
+    0x3B, 0xA2, 0x52, 0x6A, 0x32, 0x36, 0xD9, 0x15, 0x9B, 0xBA, 0x84, 0x5D, 0xDC, 0x8C, 0x5D, 0x8E,
+    0xF0, 0xCC, 0xD5, 0xE1, 0xD8, 0x45, 0x46, 0x0B, 0xD8, 0xBF, 0xCA, 0xE0, 0xC7, 0x02, 0x4F, 0x9C,
+    0xAB, 0xE4, 0x1B, 0x93, 0xA5, 0x99, 0x7E, 0x0E, 0xF6, 0xD3, 0xED, 0x10, 0xA3, 0x8D, 0xCB, 0xE5,
+    0xBA, 0xC7, 0x37, 0xA7, 0x92, 0x6F, 0x88, 0x06, 0x7F, 0x81, 0x23, 0x0E, 0x35, 0x79, 0x2F, 0x6E,
+    0x73, 0xC5, 0xC7, 0xA3, 0x86, 0xE0, 0x27, 0x80, 0x1B, 0x47, 0xB7, 0xCD, 0x7A, 0x18, 0x88, 0x9D,
+    0x38, 0xAF, 0x4F, 0x9D, 0xC8, 0xE8, 0x4E, 0x9A, 0x5A, 0x29, 0x99, 0x73, 0x1E, 0x39, 0xEE, 0xE0,
+    0xB6, 0x2D, 0x67, 0xB7, 0x8C, 0xB4, 0x20, 0x65, 0x9C, 0xB4, 0x3F, 0x5C, 0x0F, 0x99, 0x75, 0x80,
+    0xE5, 0xEE, 0xE1, 0xD9, 0xD8, 0xEE, 0x5A, 0x59, 0xD1, 0x5E, 0x08, 0xB8, 0x31, 0x1C, 0x25, 0xB9,
+    0xE3, 0xD7, 0xC7, 0xBD, 0xEA, 0xFD, 0xFB, 0x1D, 0xF6, 0xCA, 0x35, 0xB0, 0x07, 0x33, 0x61, 0x3F,
+    0xCD, 0xD8, 0xD9, 0x8D, 0xD5, 0x50, 0x5D, 0xFB, 0xFD, 0x0E, 0x5B, 0x2D, 0xDF, 0x05, 0x75, 0x13,
+    0xEE, 0x8D, 0x44, 0x13, 0xD7, 0x4B, 0xF6, 0x76, 0x34, 0xF1, 0xD2, 0xD0, 0x4B, 0xF1, 0x54, 0x82,
+    0xDE, 0x2B, 0xEB, 0x11, 0xFA, 0x87, 0x67, 0x83, 0x3D, 0xD5, 0x5A, 0xA4, 0x1D, 0x19, 0xF6, 0x33,
+    0x8F, 0x16, 0xAB, 0xFD, 0x47, 0x67, 0xF4, 0x52, 0xB4, 0xD2, 0x6C, 0xA4, 0x75, 0x9F, 0xA8, 0xC6,
+    0x9D, 0xB6, 0x9E, 0xC0, 0xC3, 0x3E, 0xC9, 0x46, 0x85, 0xA0, 0xD9, 0x2A, 0xD3, 0x6D, 0x3B, 0x00,
+    0xF9, 0x6D, 0x81, 0x75, 0x23, 0xCC, 0xFE, 0x75, 0xAB, 0x0D, 0xB8, 0x72, 0x7D, 0x2F, 0x12, 0xB8,
+    0x19, 0xC2, 0x40, 0xB5, 0x9D, 0xC6, 0x00, 0xAF, 0x99, 0xA0, 0x19, 0x29, 0xD2, 0x6D, 0x47, 0x65,
+    0x3B, 0xED, 0x4A, 0xEC, 0x13, 0xBF, 0xCE, 0x88, 0x8D, 0xBF, 0xC6, 0x88, 0x35, 0x02, 0x77, 0x74,
+    0xB3, 0xB3, 0xF1, 0x37, 0x06, 0x8C, 0x22, 0x56, 0x33, 0xEE, 0xF5, 0x44, 0xA9, 0x33, 0xD7, 0x0F,
+    0x6F, 0xF6, 0xFB, 0x18, 0xCF, 0xFE, 0x71, 0x22, 0x74, 0xB3, 0xC9, 0x7E, 0x68, 0xA6, 0x9F, 0x5F,
+    0x64, 0x67, 0x85, 0x5E, 0x2B, 0x52, 0xC4, 0x2F, 0x7F, 0x5B, 0x69, 0xC0, 0xFD, 0xC6, 0xD2, 0x40,
+    0x97, 0xA8, 0x14, 0x71, 0x9A, 0x6B, 0x69, 0xDC, 0x95, 0x78, 0x5C, 0xDD, 0xFC, 0x87, 0x80, 0xBE,
+    0x5C, 0xA0, 0x95, 0x22, 0x7C, 0xAF, 0xCD, 0xC0, 0xB5, 0xEA, 0x3C, 0xFD, 0xD9, 0xA8, 0x33, 0x6E,
+    0xC5, 0xA6, 0x4A, 0x09, 0x17, 0x5B, 0x4D, 0x55, 0xC1, 0x69, 0x6C, 0x17, 0x24, 0x5C, 0x34, 0x5F,
+    0x6E, 0x88, 0xEE, 0xDD, 0xB5, 0x59, 0x09, 0xCF, 0xA5, 0x7E, 0x36, 0xD9, 0xC5, 0x30, 0xD8, 0x14,
+    0x5E, 0xCC, 0xF8, 0x51, 0x3B, 0xCD, 0xED, 0xC7, 0x76, 0x69, 0xBF, 0xD8, 0x70, 0xB1, 0xFB, 0x32,
+    0x21, 0x9C, 0x62, 0xB3, 0x12, 0x44, 0x3F, 0x55, 0x5A, 0x09, 0x18, 0x4D, 0x26, 0xD3, 0x0A, 0x9B,
+    0xE8, 0xF2, 0xC9, 0x79, 0xBB, 0xF9, 0x54, 0x9E, 0x6C, 0x16, 0xA0, 0x5E, 0x2F, 0x47, 0x92, 0x6F,
+    0x96, 0xFE, 0xDE, 0x6D, 0xFB, 0xF0, 0x7B, 0xE3, 0x91, 0x5A, 0x37, 0xCB, 0x41, 0x5D, 0xFE, 0xFF,
+    0x10, 0xA8, 0xBA, 0xC1, 0xEE, 0x55, 0x70, 0x1A, 0xF7, 0x8D, 0x6E, 0xD6, 0x36, 0x51, 0x5D, 0x3B,
+    0xED, 0x87, 0x6F, 0x58, 0xA0, 0xEF, 0x36, 0x13, 0x84, 0xE7, 0x66, 0x08, 0x76, 0x86, 0xEF, 0xB5,
+    0xE3, 0xA5, 0x18, 0xF7, 0x0D, 0xCB, 0x72, 0x83, 0x23, 0x8A, 0xED, 0x10, 0xC4, 0xCE, 0x47, 0x1C,
+    0xBA, 0x38, 0x03, 0xF1, 0x8D, 0x52, 0xDB, 0xE7, 0x68, 0x24, 0x1E, 0xAE, 0xD3, 0xE4, 0x93, 0x54,
+    0xA7, 0xE8, 0xF3, 0x4D, 0x0B, 0x74, 0xE5, 0xFA, 0xC5, 0x09, 0x3A, 0xA8, 0x37, 0x37, 0xD2, 0x2E,
+    0x76, 0xE2, 0xCA, 0x70, 0x32, 0xE8, 0x6F, 0x58, 0xA0, 0xFF, 0x6C, 0x47, 0x28, 0x7D, 0xA4, 0x2A,
+    0x2E, 0xC2, 0xCF, 0xBB, 0xE1, 0x92, 0xF9, 0x7C, 0xB3, 0xB2, 0x5C, 0xB9, 0x76, 0x44, 0xBA, 0x0C,
+    0x55, 0x06, 0xEE, 0x5C, 0xE0, 0xE8, 0xAF, 0x85, 0x54, 0xAD, 0xAE, 0x1F, 0xC5, 0xD9, 0x19, 0xC2,
+    0x48, 0xB5, 0x5D, 0x18, 0xE6, 0xD7, 0xD2, 0xFF, 0x23, 0x41, 0x6B, 0x79, 0x24, 0x68, 0x7D, 0x1D,
+    0xFD, 0xDB, 0x3F, 0x4E, 0xF4, 0x77, 0x57, 0xFA, 0xD7, 0x17, 0xBA, 0xA7, 0x67, 0x1E, 0xE1, 0x34,
+    0x7E, 0x77, 0xC2, 0xF9, 0xFF, 0x95, 0x0A, 0xB6, 0x23, 0xF5, 0x06, 0xDF, 0x49, 0xE0, 0x06, 0xFE,
+    0x2C, 0xD1, 0x95, 0x1D, 0x1F, 0x5D, 0xB9, 0xB6, 0x07, 0x62, 0x1F, 0xC1, 0x1F, 0xCB, 0x79, 0xFD,
+    0x08, 0xAC, 0x13, 0xD2, 0x6C, 0xA5, 0xA8, 0x49, 0xCF, 0xE6, 0x7A, 0x73, 0xB3, 0x5D, 0xF4, 0x47,
+    0x7A, 0x5D, 0xCA, 0xBD, 0x34, 0x86, 0x8F, 0x86, 0xBA, 0xEC, 0x95, 0xB1, 0x6E, 0xAD, 0xA3, 0x93,
+    0x70, 0xCA, 0xF4, 0xBA, 0x75, 0x98, 0xCA, 0xF5, 0x3D, 0xEB, 0xDD, 0xC0, 0x4D, 0xD4, 0xF9, 0x7C,
+    0x43, 0xFF, 0xCE, 0x3D, 0xDF, 0xE0, 0x58, 0xC3, 0x1D, 0xC0, 0x95, 0x7A, 0xE5, 0xDA, 0x21, 0x75,
+    0xA7, 0x81, 0x1D, 0x73, 0x25, 0xBB, 0xD9, 0xA5, 0x4B, 0xED, 0xE2, 0x66, 0xBB, 0xB8, 0xB7, 0x42,
+    0xF2, 0x52, 0x0C, 0x2A, 0x84, 0x8F, 0x06, 0xC2, 0x71, 0x98, 0xD0, 0xCF, 0xED, 0xE9, 0xB0, 0xC6,
+    0x0E, 0xFF, 0xAF, 0x00, 0xDD, 0xD3, 0x09, 0x75, 0x93, 0xC9, 0x61, 0xB8, 0x84, 0x0D, 0xAB, 0xFD,
+    0x84, 0x89, 0x91, 0x92, 0x5B, 0xDC, 0x5B, 0x22, 0x3C, 0xB7, 0x9A, 0xCD, 0xBD, 0x15, 0x3E, 0xD9,
+    0x4F, 0x27, 0xCF, 0xFD, 0xC3, 0x5B, 0x84, 0x91, 0x5A, 0xD0, 0x14, 0xFE, 0x97, 0xDD, 0xE1, 0x1F,
+    0xAD, 0xEE, 0xC1, 0x35, 0xA8, 0xAE, 0xA3, 0xA1, 0x9B, 0xEB, 0x8C, 0x1B, 0xAA, 0x01, 0x4C, 0xAE,
+    0x44, 0x88, 0x6E, 0xB6, 0x4B, 0x93, 0x2B, 0x11, 0x46, 0x37, 0xD9, 0xE5, 0x38, 0xB9, 0xE3, 0x26,
+    0x9B, 0x9A, 0x0C, 0xD5, 0x0D, 0x9A, 0x0D, 0xBB, 0xD0, 0x4F, 0x84, 0xD3, 0xCA, 0x88, 0x4A, 0xD4,
+    0xC2, 0x14, 0xCC, 0x46, 0x93, 0x69, 0x32, 0xED, 0xCE, 0x22, 0x2D, 0x74, 0x89, 0xFE, 0x9C, 0x48,
+    0x8A, 0xF8, 0x08, 0x57, 0x07, 0x94, 0x8C, 0x16, 0xFB, 0x69, 0x76, 0xE3, 0x9D, 0x23, 0xC7, 0xFB,
+    0x07, 0x76, 0xD2, 0x4C, 0x3F, 0xB7, 0x9F, 0x6C, 0xF6, 0xD3, 0x7C, 0xA1, 0x91, 0x7F, 0xA8, 0x18,
+    0xFB, 0xFA, 0x4C, 0xDF, 0xA3, 0xD1, 0xFD, 0x88, 0xB4, 0xD2, 0x35, 0xE5, 0x02, 0x52, 0xD9, 0xD7,
+    0x34, 0x54, 0x39, 0x6C, 0xF4, 0xF7, 0x95, 0x8C, 0x7E, 0x29, 0x5C, 0xEA, 0x92, 0x29, 0x08, 0x1F,
+    0x8F, 0xEA, 0x83, 0x06, 0x37, 0xD9, 0x64, 0xB6, 0x4A, 0xB8, 0xD8, 0xA7, 0x26, 0xD7, 0xE5, 0xD0,
+    0x9B, 0xC9, 0x47, 0xBB, 0x4B, 0x26, 0x3D, 0xEE, 0xF9, 0xD3, 0x85, 0x07, 0x69, 0x35, 0x56, 0xFB,
+    0xA1, 0xAB, 0xA8, 0xBF, 0xD4, 0x0F, 0x36, 0x53, 0xDC, 0xDC, 0x6E, 0xA2, 0xFF, 0x3C, 0x13, 0x6E,
+    0xCF, 0xA6, 0x84, 0xD1, 0xFE, 0x75, 0xC1, 0xBF, 0x91, 0x4D, 0xE9, 0x56, 0x9F, 0x9C, 0x34, 0x3A,
+    0xAD, 0xF4, 0x65, 0xD8, 0x6B, 0x31, 0x7F, 0xAB, 0x49, 0xFF, 0xCE, 0x3D, 0xDF, 0xD8, 0x01, 0x8B,
+    0x36, 0xEC, 0xA7, 0x99, 0x62, 0xD6, 0x53, 0x12, 0xF4, 0xBB, 0xF6, 0xDC, 0x3D, 0x3D, 0xA3, 0x6E,
+    0x32, 0x6B, 0xB8, 0x9C, 0xE8, 0xD4, 0x9A, 0xF1, 0x4A, 0x8D, 0x94, 0xDC, 0x83, 0xF0, 0xB6, 0x06,
+    0xFD, 0x64, 0xAD, 0xE5, 0x63, 0xBB, 0x89, 0xFE, 0xE3, 0x15, 0xDD, 0x9E, 0xCD, 0x16, 0xC6, 0xEE,
+    0x53, 0xA1, 0x3F, 0x29, 0x5D, 0xB6, 0xD2, 0x6C, 0x55, 0x68, 0x75, 0x6B, 0x67, 0x11, 0xAF, 0x5C,
+    0x3B, 0x92, 0x2C, 0x17, 0x0F, 0xB0, 0xE7, 0x2F, 0x22, 0x76, 0x97, 0x4C, 0x6E, 0xD7, 0x4A, 0xA6,
+    0x10, 0x46, 0x0D, 0x6E, 0x72, 0xF1, 0x9C, 0xB5, 0x96, 0xD9, 0xD0, 0x28, 0xDC, 0xE4, 0x62, 0x97,
+    0xBA, 0xA3, 0x9A, 0x51, 0xE9, 0x07, 0x1A, 0x9C, 0xEE, 0x4F, 0x56, 0xBF, 0x4C, 0xE8, 0xAD, 0x7C,
+    0xD4, 0xBE, 0xAA, 0xEB, 0xC7, 0x79, 0xD0, 0x02, 0x55, 0x39, 0x16, 0xF3, 0x09, 0xBE, 0xE6, 0x51,
+    0x6E, 0x1C, 0xC5, 0xF0, 0x20, 0x08, 0xCF, 0x4F, 0x84, 0x2A, 0x73, 0xF5, 0x38, 0x2B, 0xFB, 0xB5,
+    0x8D, 0xD2, 0xFE, 0x78, 0xA1, 0x4D, 0x85, 0x3A, 0xBB, 0xF1, 0x11, 0x04, 0xE8, 0xA3, 0x4D, 0xFD,
+    0xDC, 0x64, 0xFB, 0x55, 0xF6, 0xBE, 0x9F, 0xDB, 0x6C, 0x17, 0x53, 0x4C, 0x46, 0x83, 0xF0, 0xD1,
+    0x47, 0x97, 0xBA, 0xD4, 0xAD, 0xCD, 0xD6, 0x6F, 0x48, 0x61, 0x70, 0x7A, 0x3E, 0x1A, 0x3D, 0x9B,
+    0x2E, 0xEA, 0x6F, 0xC0, 0xE3, 0x92, 0x14, 0x09, 0x3A, 0x1D, 0xD3, 0x57, 0x46, 0x0F, 0x83, 0x34,
+    0xD9, 0xB2, 0xFB, 0xF9, 0x79, 0xAF, 0xA3, 0xD2, 0xAE, 0xD0, 0x2D, 0xB8, 0x09, 0x42, 0x44, 0x67,
+    0x3F, 0x35, 0x85, 0x46, 0x4A, 0x76, 0xA1, 0xD7, 0x0E, 0x0A, 0xB4, 0xA1, 0x13, 0x79, 0x6E, 0xF7,
+    0x63, 0xD1, 0x3E, 0x82, 0x3B, 0x8E, 0xB5, 0x45, 0xBB, 0x42, 0xA5, 0x0F, 0xC2, 0xC3, 0xB3, 0xC1,
+    0x48, 0xC7, 0x59, 0x92, 0x9D, 0xEE, 0xD8, 0xCF, 0x4B, 0x3E, 0xF6, 0xE8, 0x7F, 0x4B, 0xA8, 0x35,
+    0x57, 0xD2, 0x4B, 0xCA, 0x8D, 0x24, 0x15, 0xBB, 0x79, 0xFD, 0x58, 0x7D, 0xB2, 0x05, 0xB9, 0xD9,
+    0xE6, 0x5A, 0x3E, 0xDA, 0xFC, 0xFC, 0x16, 0xA2, 0x95, 0xD6, 0x30, 0x5A, 0x69, 0x0A, 0xA3, 0x7D,
+    0xF8, 0x0A, 0x61, 0xEC, 0x13, 0x84, 0xE8, 0x16, 0xF0, 0xEF, 0x6B, 0xAB, 0x5E, 0x76, 0x92, 0x34,
+    0x77, 0x2A, 0xD2, 0x6C, 0x34, 0x79, 0x8D, 0x3C, 0x41, 0x35, 0xF0, 0xE4, 0xD9, 0xD9, 0x8B, 0x52,
+    0x76, 0xD2, 0xEB, 0xD2, 0xFA, 0xE4, 0xD9, 0xD9, 0xD9, 0xD9, 0xD9, 0x4F, 0x9D, 0xA4, 0xFD, 0xA1,
+    0xF6, 0x53, 0x20, 0x92, 0x56, 0x7E, 0x51, 0x65, 0xB3, 0xB6, 0x8B, 0x4D, 0xFD, 0xEC, 0xE2, 0xD5,
+    0xA1, 0xDE, 0x4C, 0x6E, 0x57, 0x9B, 0xBA, 0xA9, 0x8F, 0x6E, 0xB8, 0x0A, 0xBF, 0x68, 0xE6, 0x2E,
+    0x6E, 0x66, 0xED, 0x63, 0x30, 0xAB, 0x4D, 0xAA, 0xB7, 0x2E, 0xB9, 0xBB, 0x5B, 0x75, 0xFD, 0xEA,
+    0x50, 0x6F, 0xDD, 0xEC, 0xEE, 0x6E, 0xED, 0xE2, 0xA2, 0xDA, 0xA5, 0x9B, 0x54, 0xE7, 0x2E, 0x3A,
+    0xB3, 0x56, 0xD7, 0xAE, 0x72, 0x85, 0x2B, 0x5C, 0x31, 0xD9, 0x64, 0x93, 0xC3, 0x14, 0xA6, 0xF0,
+    0x6E, 0x6E, 0xB3, 0xCD, 0x7E, 0xF4, 0xA3, 0x1F, 0x07, 0x06, 0x86, 0xBF, 0x01, 0xAD, 0x98, 0xBF,
+    0xEE, 0xEF, 0xB6, 0x79, 0xC6, 0x3F, 0x12, 0x63, 0x0B, 0x08, 0x81, 0xD2, 0x43, 0x3C, 0xB4, 0x2E,
+    0xA0, 0xA5, 0x53, 0x17, 0x5D, 0x02, 0x95, 0x78, 0xC8, 0x90, 0xC1, 0x1E, 0x1C, 0x7B, 0xC8, 0xE0,
+    0x0B, 0xE8, 0xE0, 0x3B, 0x28, 0x15, 0x7B, 0xE8, 0xD0, 0xC1, 0x1E, 0x7A, 0x01, 0x19, 0x32, 0xD9,
+    0xC3, 0xB9, 0x81, 0xC0, 0xA4, 0x73, 0x80, 0x76, 0xC8, 0x60, 0xBA, 0x46, 0x9A, 0xA1, 0x43, 0x14,
+    0xD8, 0x40, 0x0A, 0x67, 0x30, 0x9D, 0xE8, 0xD4, 0x3C, 0x27, 0x14, 0x9F, 0x0E, 0xFA, 0xFE, 0xCE,
+    0xF9, 0x39, 0x6D, 0x87, 0x16, 0x11, 0xF0, 0xD5, 0x57, 0x10, 0x29, 0x91, 0x7A, 0xFF, 0x3C, 0xEF,
+    0xF3, 0xBC, 0x00, 0xF0, 0xB3, 0x79, 0x25, 0xBC, 0xB2, 0x33, 0x3F, 0xAC, 0x98, 0xFD, 0x67, 0x3C,
+    0x3D, 0xA4, 0x93, 0x20, 0xAD, 0xB3, 0x94, 0xAC, 0x54, 0x4C, 0x07, 0xB4, 0x42, 0x48, 0xB0, 0x14,
+    0xB0, 0xFD, 0xFD, 0xF7, 0x8C, 0x54, 0x90, 0x1A, 0x41, 0x62, 0x29, 0xE0, 0x2A, 0x98, 0x13, 0x10,
+    0xB7, 0x99, 0x4F, 0xDE, 0xDF, 0x9C, 0x54, 0x8C, 0x54, 0x07, 0xE9, 0x04, 0x8C, 0x56, 0x98, 0x3B,
+    0xA0, 0x06, 0x56, 0x05, 0xFC, 0x97, 0x89, 0xF1, 0x8C, 0xE0, 0x7E, 0xDF, 0x20, 0x7E, 0xFF, 0xC0,
+    0xB4, 0x39, 0xB3, 0xE4, 0xB0, 0xA2, 0xA1, 0x63, 0x0F, 0x53, 0xF1, 0x5F, 0x3C, 0x28, 0x46, 0x52,
+    0x9A, 0x25, 0x21, 0xA9, 0x4D, 0x0D, 0x57, 0xFC, 0x8E, 0xFF, 0x44, 0xA0, 0x57, 0x2A, 0xE3, 0x19,
+    0x12, 0xB6, 0xE2, 0xA5, 0xCD, 0x49, 0xFB, 0x24, 0x1D, 0xA3, 0xD4, 0xD0, 0x0A, 0x3E, 0xC3, 0x5C,
+    0x60, 0x6A, 0x30, 0xAA, 0xAF, 0x48, 0x0D, 0x2F, 0xA5, 0xF9, 0x89, 0xAA, 0x6D, 0x93, 0xC6, 0x4E,
+    0x4C, 0x5A, 0x97, 0xE2, 0x93, 0xAB, 0x73, 0xB1, 0xA7, 0xED, 0x0F, 0x64, 0x6E, 0x8B, 0xE1, 0xF5,
+    0x18, 0xF0, 0xFA, 0xFC, 0xB2, 0xCD, 0x24, 0x35, 0x16, 0xA9, 0xA2, 0xCD, 0x17, 0x73, 0x12, 0x93,
+    0x2B, 0xA6, 0x13, 0xD2, 0x5C, 0x46, 0x7D, 0xA0, 0xCD, 0x49, 0x07, 0x5E, 0x02, 0x49, 0xEB, 0xD4,
+    0x46, 0xB1, 0xEC, 0xE6, 0x44, 0xAB, 0x3B, 0xCC, 0x49, 0xC8, 0x73, 0x31, 0x22, 0x7C, 0xA1, 0x3A,
+    0x4A, 0x4A, 0xEE, 0xDA, 0x4D, 0x5F, 0xB9, 0xDB, 0x7D, 0x7E, 0xB6, 0xFB, 0xED, 0xDA, 0xBD, 0xBB,
+    0xDB, 0xFD, 0x9D, 0x2F, 0xFE, 0xE7, 0x9B, 0xE9, 0xDE, 0x77, 0xDE, 0xBF, 0x09, 0x4C, 0x52, 0x07,
+    0x2B, 0x75, 0x70, 0xD2, 0x09, 0x4E, 0x6A, 0x30, 0xEF, 0x53, 0x03, 0x9F, 0x6D, 0x05, 0x9F, 0x5C,
+    0x85, 0x90, 0xDC, 0x01, 0x71, 0x9B, 0x0B, 0x68, 0x5D, 0x0A, 0x88, 0x65, 0x67, 0x10, 0x3E, 0x63,
+    0x4E, 0x7C, 0x62, 0x6A, 0x84, 0x84, 0xAB, 0xC4, 0xC4, 0x5C, 0xD0, 0x86, 0xDF, 0xD1, 0xFA, 0x6D,
+    0x3D, 0xF9, 0x40, 0xFF, 0xE1, 0x24, 0xA9, 0xCD, 0x92, 0x54, 0x17, 0x49, 0x3A, 0x96, 0x1D, 0x5C,
+    0xB9, 0xBC, 0xE0, 0x13, 0x2C, 0x7B, 0x48, 0xE0, 0xF7, 0x17, 0x57, 0x78, 0x71, 0xC5, 0x5F, 0xC1,
+    0x96, 0x27, 0xA9, 0x7C, 0xE3, 0xAB, 0xE7, 0x02, 0xB6, 0xC1, 0xA8, 0xF7, 0x7F, 0x7A, 0xE7, 0x33,
+    0x66, 0x29, 0xD9, 0x06, 0xE6, 0x4F, 0xBF, 0xDA, 0xF6, 0xF7, 0x7F, 0x62, 0xA4, 0x86, 0xD4, 0x09,
+    0xD2, 0x0A, 0xF3, 0x8E, 0x98, 0x0F, 0x7C, 0x32, 0x0D, 0x6D, 0xC4, 0x6D, 0x2E, 0xAE, 0x81, 0x88,
+    0x5B, 0x4C, 0x8C, 0xDD, 0x9C, 0xF6, 0x04, 0xD3, 0x5C, 0x09, 0x3B, 0xD8, 0xC3, 0x3F, 0xEC, 0xC0,
+    0xFC, 0x55, 0xF7, 0x05, 0xF0, 0x5F, 0x4A, 0x00, 0x51, 0x3A, 0x2E, 0x13, 0x2A, 0x01, 0x5E, 0x12,
+    0x60, 0xF4, 0xD6, 0x67, 0x1D, 0x58, 0x6A, 0xFC, 0x41, 0x83, 0x41, 0x0F, 0xDB, 0x7C, 0xC0, 0xDC,
+    0x5C, 0xF1, 0x3B, 0x28, 0x87, 0x14, 0x13, 0xAE, 0x8F, 0x7D, 0xD0, 0x4A, 0x2C, 0xEE, 0x30, 0x9D,
+    0x49, 0xF8, 0x64, 0x1B, 0xFE, 0xB8, 0x76, 0x06, 0xC0, 0x4B, 0x57, 0xBC, 0x24, 0x2B, 0x35, 0x9E,
+    0xFC, 0x48, 0xEB, 0x0B, 0x84, 0x0C, 0xEE, 0x00, 0xD3, 0x60, 0x14, 0xCF, 0x7D, 0x20, 0x26, 0x75,
+    0x06, 0x3D, 0x86, 0xA8, 0x1D, 0x5E, 0x3A, 0x81, 0x98, 0x9E, 0x19, 0x69, 0xEA, 0xF6, 0x9F, 0x5E,
+    0xD2, 0xF7, 0x24, 0x6D, 0x51, 0xDA, 0xAC, 0xFA, 0xCA, 0xB0, 0x02, 0x3E, 0x8D, 0xDA, 0xE6, 0x32,
+    0x68, 0x9F, 0x2A, 0x3A, 0xC6, 0x93, 0xD8, 0x10, 0x41, 0xF8, 0xE4, 0xB5, 0xCD, 0xFB, 0xF2, 0xE5,
+    0x6E, 0x8F, 0xF9, 0x77, 0x87, 0x39, 0xDD, 0x1F, 0x1A, 0xB2, 0x87, 0xF0, 0x0F, 0x6B, 0xD8, 0xE6,
+    0xCF, 0xDA, 0x92, 0xED, 0x7F, 0x9E, 0xAE, 0x98, 0xB3, 0x9B, 0x86, 0x84, 0x08, 0x5A, 0xC3, 0x36,
+    0x2B, 0x2D, 0xD9, 0x2A, 0xB9, 0x62, 0xB4, 0x9B, 0x86, 0xCA, 0xD0, 0x09, 0x07, 0x71, 0xBB, 0x03,
+    0x91, 0x25, 0x85, 0x15, 0x5B, 0x7C, 0x02, 0x29, 0xC3, 0xAC, 0x04, 0xBC, 0xF8, 0x14, 0x63, 0xB0,
+    0x9D, 0x90, 0x26, 0x6D, 0xF3, 0x6E, 0x94, 0xED, 0x31, 0xAA, 0x98, 0x36, 0xA8, 0x21, 0xD4, 0x09,
+    0x5B, 0x8C, 0xDB, 0x92, 0xC3, 0x83, 0xEC, 0x0E, 0xFF, 0x71, 0x31, 0x6D, 0xF9, 0xB4, 0x21, 0xF7,
+    0x9B, 0x4E, 0x78, 0xB7, 0xC4, 0x75, 0xF9, 0xF7, 0xC3, 0x27, 0xF7, 0x75, 0x75, 0xC5, 0xA8, 0x99,
+    0x36, 0xE8, 0x1C, 0x3A, 0x41, 0xC4, 0x75, 0x11, 0x3E, 0x39, 0x6D, 0xAE, 0x18, 0xA5, 0xA9, 0x0E,
+    0xCA, 0x63, 0x07, 0x9F, 0x47, 0xE1, 0xCA, 0xA0, 0x75, 0x6A, 0x68, 0x1B, 0x3B, 0x4A, 0x68, 0x8B,
+    0x09, 0x9F, 0x43, 0x66, 0x2E, 0x7E, 0x67, 0x6A, 0x7E, 0x67, 0x54, 0x2C, 0x20, 0x15, 0xF0, 0xAA,
+    0x30, 0x4B, 0x60, 0x9B, 0xCF, 0x8C, 0xDD, 0x35, 0xD0, 0x77, 0x05, 0x3E, 0xF9, 0xCC, 0x5C, 0x5C,
+    0xC3, 0xB6, 0x41, 0x98, 0x7E, 0x05, 0xBF, 0x6B, 0xF8, 0x34, 0x68, 0x05, 0x82, 0xB4, 0xDF, 0x92,
+    0x4C, 0x52, 0x62, 0x96, 0x1A, 0x63, 0x27, 0x26, 0x7C, 0x76, 0x15, 0xD3, 0xD0, 0x4A, 0x48, 0xAE,
+    0x60, 0xEB, 0x20, 0x10, 0x4B, 0x61, 0x2E, 0xA6, 0x33, 0x76, 0x7C, 0xC6, 0xE7, 0xA9, 0x61, 0x1A,
+    0x21, 0x11, 0x92, 0xAD, 0xB8, 0x8A, 0xB6, 0x51, 0xB8, 0xE3, 0x2F, 0x54, 0x06, 0xA1, 0x93, 0xA5,
+    0x38, 0xAD, 0x63, 0x47, 0x19, 0x9F, 0x6F, 0x56, 0xF5, 0x95, 0x41, 0xBB, 0x51, 0xC2, 0x9F, 0x84,
+    0xC6, 0xA4, 0x64, 0x95, 0x50, 0x43, 0x8D, 0x59, 0xC9, 0x29, 0x99, 0x3F, 0xD6, 0xA1, 0x37, 0x42,
+    0x5C, 0xE7, 0x5F, 0x67, 0xF7, 0xBB, 0x32, 0xB6, 0x73, 0x68, 0xC2, 0x7F, 0x9C, 0xFD, 0xBB, 0xC5,
+    0xB4, 0x73, 0xFA, 0xAA, 0x13, 0xDE, 0xCD, 0x7D, 0xC9, 0xF6, 0xF8, 0x70, 0x79, 0xD8, 0x88, 0xF6,
+    0xB3, 0xC3, 0x27, 0x57, 0x3E, 0x8C, 0x53, 0xA5, 0x5B, 0xE5, 0xB8, 0xCE, 0x7B, 0x6C, 0xF6, 0x18,
+    0xCF, 0x49, 0xAB, 0xF0, 0x29, 0x14, 0x57, 0x4C, 0x9B, 0xCE, 0xA1, 0xE3, 0xB7, 0x90, 0x96, 0x0C,
+    0x3E, 0xA3, 0x75, 0x2E, 0xF8, 0x34, 0x35, 0xE6, 0x32, 0x76, 0x6C, 0x43, 0x9B, 0xE9, 0x4F, 0x47,
+    0x42, 0xB2, 0x8D, 0xA5, 0x8C, 0x7A, 0xFF, 0x41, 0x45, 0xD2, 0x89, 0xD7, 0x05, 0x03, 0xBA, 0x46,
+    0x4C, 0xC7, 0x55, 0xB4, 0x5E, 0x80, 0x23, 0x9E, 0x3D, 0x73, 0x6F, 0x24, 0xA4, 0x41, 0x77, 0x21,
+    0x35, 0xC4, 0xC7, 0xE0, 0xA4, 0xED, 0x32, 0xBF, 0x9E, 0xA8, 0x18, 0xAD, 0x73, 0x9D, 0x4E, 0x6C,
+    0x73, 0x95, 0xA9, 0xCD, 0x07, 0xE6, 0x5C, 0x0A, 0xE6, 0xF4, 0x3B, 0xA6, 0xF9, 0xCC, 0xD4, 0x7C,
+    0xC6, 0xB6, 0x90, 0x70, 0x35, 0x24, 0xDC, 0xE1, 0x33, 0x4B, 0xF1, 0x3B, 0x61, 0x5F, 0x8E, 0x41,
+    0x69, 0xEE, 0x3F, 0xD2, 0x6A, 0xA5, 0xCE, 0x28, 0x1D, 0x10, 0xB4, 0x01, 0xAF, 0xDE, 0x61, 0xC0,
+    0x2C, 0x29, 0x4D, 0x92, 0xF6, 0x51, 0xD2, 0x81, 0x56, 0xD3, 0xF0, 0x79, 0x10, 0x73, 0x21, 0x26,
+    0xDB, 0xF0, 0xFB, 0xD8, 0x71, 0x77, 0x23, 0xE9, 0x1B, 0x23, 0xE6, 0x36, 0x32, 0x35, 0x7C, 0x1A,
+    0xAF, 0x91, 0xCD, 0x36, 0x7C, 0xBE, 0x37, 0x12, 0xD2, 0x28, 0xC0, 0xEB, 0x3D, 0x8C, 0x94, 0x09,
+    0xD2, 0x6A, 0x2F, 0x8C, 0x8C, 0xD9, 0x1D, 0xE6, 0x1C, 0x84, 0xCF, 0x73, 0x31, 0xE7, 0xD8, 0x89,
+    0xC9, 0xE7, 0xB7, 0xAA, 0x91, 0x44, 0x90, 0xB2, 0x95, 0x76, 0xE2, 0x17, 0xAF, 0xE2, 0x8E, 0x5B,
+    0x5D, 0x9E, 0xCB, 0xAD, 0x30, 0xF8, 0xFD, 0x56, 0xAD, 0x6F, 0xD5, 0xE1, 0x42, 0xA1, 0xCF, 0xB9,
+    0x15, 0xEC, 0x13, 0x3D, 0x79, 0x90, 0x7C, 0xE5, 0x3B, 0x53, 0x07, 0x94, 0x60, 0x3E, 0xE0, 0xDA,
+    0xCA, 0xFD, 0x47, 0xA7, 0x76, 0xAB, 0xF6, 0xD7, 0x9D, 0x1D, 0x8C, 0xD6, 0x81, 0x59, 0xAF, 0x17,
+    0x24, 0x61, 0xA4, 0xC2, 0xA4, 0xC7, 0x97, 0xD5, 0xBC, 0x74, 0x7A, 0xE9, 0x0C, 0x52, 0x8B, 0x52,
+    0xC5, 0xEF, 0x17, 0xD0, 0xFB, 0x74, 0xBD, 0x25, 0x26, 0xD0, 0x06, 0x5A, 0x19, 0x04, 0x83, 0xAE,
+    0xED, 0x9A, 0x7E, 0x2D, 0x30, 0xB5, 0x0B, 0xEA, 0x6C, 0xBD, 0xC0, 0xD1, 0x1D, 0x30, 0x35, 0xC6,
+    0x8E, 0x18, 0xB4, 0xFA, 0x8C, 0x92, 0xAD, 0x57, 0x54, 0xF8, 0x1D, 0x9F, 0x96, 0x82, 0x3D, 0xDC,
+    0xC1, 0xD0, 0x6D, 0x03, 0xFF, 0xF0, 0x04, 0xF7, 0xFB, 0x0E, 0x63, 0x17, 0x37, 0x6F, 0x3A, 0x25,
+    0x30, 0xCA, 0x40, 0x2C, 0x5C, 0x04, 0x87, 0xA5, 0xC2, 0x5F, 0xC5, 0x06, 0x56, 0x0D, 0x46, 0x9D,
+    0x40, 0xAC, 0x70, 0x01, 0xEA, 0xB3, 0x63, 0xC9, 0x00, 0xF6, 0x00, 0xF8, 0xBB, 0xBE, 0xC2, 0x4B,
+    0x92, 0x56, 0x16, 0xDD, 0x8A, 0x95, 0xB4, 0x2D, 0xA7, 0x2B, 0xE1, 0x98, 0xAB, 0x69, 0xA6, 0xDB,
+    0x86, 0x88, 0x0F, 0x4F, 0xC2, 0x36, 0x17, 0xB1, 0xE4, 0xA9, 0xF9, 0xE4, 0xCA, 0xD8, 0xDD, 0x61,
+    0x1A, 0x7A, 0x59, 0x43, 0x47, 0x29, 0x1E, 0xF1, 0x7B, 0xCA, 0x4E, 0x92, 0x76, 0x24, 0x29, 0x33,
+    0x49, 0xDA, 0xE0, 0x79, 0xBD, 0x06, 0x10, 0x57, 0x9E, 0x7A, 0xEE, 0xB9, 0x57, 0x01, 0x96, 0x1D,
+    0xBF, 0x13, 0x92, 0x11, 0x68, 0x5D, 0x0E, 0x4C, 0x1F, 0xB4, 0x32, 0x35, 0x57, 0xC1, 0x1D, 0x31,
+    0xC1, 0xF2, 0xDB, 0x06, 0x04, 0x65, 0x40, 0x1D, 0x18, 0x55, 0x00, 0xA7, 0x15, 0x88, 0x1D, 0x98,
+    0xD4, 0x00, 0xFF, 0xE5, 0x01, 0x46, 0x7E, 0x87, 0xA5, 0x84, 0xC4, 0xA0, 0x55, 0x2B, 0xAE, 0x1A,
+    0x81, 0x92, 0x6D, 0xD8, 0x13, 0x57, 0x09, 0x3B, 0xBE, 0x70, 0x2F, 0xD8, 0xA7, 0x7B, 0xC1, 0xBE,
+    0xDD, 0x4F, 0x83, 0xED, 0xFF, 0x18, 0xEC, 0x73, 0x41, 0x9B, 0xED, 0xEF, 0xC7, 0x27, 0x46, 0x92,
+    0x92, 0x24, 0x95, 0x20, 0xA9, 0x72, 0x0B, 0x33, 0xC4, 0x2D, 0xEA, 0x2E, 0x6F, 0x3D, 0xFF, 0x53,
+    0xA6, 0xCA, 0x92, 0xB5, 0x99, 0xD3, 0x1D, 0xF8, 0x24, 0xA6, 0x36, 0x17, 0xE2, 0xDB, 0x1D, 0x57,
+    0x7D, 0x46, 0x2F, 0x9F, 0xCC, 0xC5, 0xE7, 0x51, 0x46, 0xF8, 0xDD, 0x4B, 0xE7, 0xA0, 0xBB, 0x7A,
+    0xFB, 0xED, 0x2F, 0x94, 0x2E, 0xFA, 0x8A, 0xD6, 0x8B, 0x54, 0x0D, 0xBA, 0xBD, 0xDA, 0x74, 0x6E,
+    0x01, 0x9A, 0x4D, 0x23, 0x24, 0xD3, 0x2E, 0x10, 0x0A, 0xC9, 0x36, 0xB4, 0xD9, 0x86, 0x36, 0x77,
+    0xDC, 0x4E, 0xB8, 0xE3, 0xC2, 0x29, 0x5D, 0x90, 0x37, 0x97, 0xB1, 0x5F, 0x36, 0xF1, 0xBB, 0x39,
+    0xAF, 0x53, 0x48, 0xE6, 0x24, 0xA4, 0xA9, 0x5D, 0xD0, 0x18, 0xB7, 0xA9, 0x11, 0x37, 0x77, 0x5C,
+    0xA7, 0x7B, 0xAF, 0x58, 0xE7, 0x32, 0x8A, 0xB9, 0x8C, 0xC2, 0xEF, 0x83, 0xDE, 0x8F, 0x4F, 0x3E,
+    0x38, 0x59, 0x24, 0x49, 0xC9, 0x48, 0xCF, 0x02, 0x4C, 0x89, 0xAB, 0x5C, 0xC4, 0xCD, 0x95, 0x51,
+    0xD7, 0xB5, 0x36, 0x57, 0xC6, 0x7E, 0xEF, 0x5A, 0x77, 0x73, 0xE6, 0x6F, 0xDE, 0xBF, 0xBB, 0xBE,
+    0x96, 0xF3, 0x69, 0x6A, 0xE8, 0x6E, 0x8E, 0x6D, 0x68, 0xFD, 0x93, 0x39, 0xFD, 0x62, 0x2F, 0xCF,
+    0xE6, 0xF4, 0xF7, 0xF5, 0xC5, 0x83, 0x27, 0xEF, 0x48, 0x92, 0xB4, 0x5F, 0x7F, 0xF5, 0xDA, 0xD8,
+    0x79, 0xC1, 0xF2, 0x0D, 0xA0, 0xC3, 0x05, 0x34, 0xCB, 0x0E, 0x5C, 0x99, 0x0B, 0x0C, 0xAF, 0xE1,
+    0x75, 0x60, 0x24, 0x08, 0x2A, 0x4C, 0xFA, 0xEF, 0x08, 0x73, 0xBE, 0x0A, 0x51, 0x07, 0xEE, 0x96,
+    0x0E, 0xEB, 0xFC, 0xE8, 0xAD, 0x36, 0x88, 0x98, 0x96, 0x7D, 0x6A, 0xE6, 0x24, 0x24, 0x9F, 0x5C,
+    0x9B, 0xDA, 0xA8, 0x35, 0x7E, 0xA1, 0x62, 0xA5, 0x13, 0x49, 0xB8, 0x8B, 0x52, 0x67, 0x98, 0x77,
+    0x73, 0x11, 0xC6, 0x90, 0xEE, 0xA8, 0xAE, 0x39, 0xD1, 0x76, 0xC7, 0x75, 0x6D, 0x1B, 0x04, 0x68,
+    0x9B, 0x1F, 0x81, 0x3B, 0x46, 0x69, 0x1B, 0x74, 0xD1, 0xD2, 0x62, 0xA4, 0x36, 0x8A, 0xF0, 0x4B,
+    0xED, 0x7E, 0xB7, 0xCD, 0xC8, 0x9C, 0xC4, 0x6D, 0x29, 0x21, 0xB9, 0x63, 0x94, 0x6D, 0x08, 0xBF,
+    0x5F, 0xBC, 0xD2, 0xD5, 0x51, 0x1F, 0x68, 0xD3, 0xEA, 0xA5, 0x32, 0x17, 0x23, 0xD5, 0x51, 0xF8,
+    0x7B, 0x38, 0xF7, 0x4D, 0xC6, 0x7E, 0x8F, 0xE5, 0x4E, 0xE7, 0xCA, 0x28, 0x65, 0xA4, 0x8E, 0x97,
+    0xF2, 0xFC, 0x28, 0x34, 0xDB, 0x8C, 0xC6, 0x4E, 0xB8, 0x53, 0x26, 0xED, 0x7F, 0x51, 0x26, 0x00,
+    0xCF, 0xAB, 0x32, 0x4A, 0xF5, 0x32, 0x53, 0x7F, 0x20, 0xBE, 0xC5, 0x5C, 0x6F, 0x14, 0x71, 0x6A,
+    0x97, 0x31, 0x7F, 0xF8, 0xC6, 0x25, 0x7B, 0xCC, 0x4D, 0xB8, 0xA5, 0xE1, 0x87, 0x6F, 0x56, 0x18,
+    0xB4, 0x82, 0x2F, 0x30, 0x75, 0x18, 0x95, 0xFE, 0xFE, 0x75, 0x1D, 0xD3, 0x9D, 0x0A, 0x1C, 0xA5,
+    0x0D, 0xBE, 0x73, 0x0F, 0xF4, 0xDC, 0xC1, 0x4B, 0x7A, 0x0F, 0xD3, 0x58, 0xD4, 0xB9, 0x0C, 0xB5,
+    0x13, 0x37, 0xDF, 0x63, 0xC3, 0xEF, 0x4B, 0x1D, 0xB4, 0xB9, 0xC3, 0x55, 0x7C, 0x99, 0x9A, 0x6D,
+    0x4C, 0x6D, 0x90, 0xE9, 0x0C, 0x22, 0x7E, 0xA1, 0x95, 0x90, 0xBC, 0x94, 0x98, 0x8B, 0x93, 0x0A,
+    0xB6, 0x4D, 0x52, 0x65, 0xD4, 0x28, 0xD3, 0x41, 0x5B, 0xDC, 0xB4, 0x11, 0xB2, 0xCF, 0x7E, 0x67,
+    0x29, 0xAE, 0xD8, 0xC6, 0x5C, 0xA7, 0x36, 0x68, 0x9B, 0xDB, 0x28, 0xFC, 0xE3, 0xB7, 0x4E, 0xB4,
+    0x4D, 0x52, 0xC7, 0x67, 0x82, 0x4E, 0x5C, 0x61, 0x54, 0xBD, 0xE2, 0x69, 0xBD, 0x6C, 0x71, 0x61,
+    0x70, 0xC2, 0x4B, 0x85, 0xA5, 0x3F, 0x68, 0xB8, 0x66, 0x3A, 0x53, 0x43, 0xEB, 0x28, 0x42, 0x22,
+    0xA6, 0xB9, 0x30, 0x17, 0x5B, 0x31, 0x7A, 0xA3, 0x73, 0xE9, 0x05, 0x2B, 0xA5, 0xAB, 0x64, 0x8D,
+    0x7A, 0xA5, 0x32, 0xE8, 0x9D, 0x13, 0x94, 0x04, 0x4A, 0x21, 0x11, 0xF3, 0x52, 0x08, 0xBB, 0xAB,
+    0x84, 0x62, 0xCE, 0x8B, 0xC2, 0x5F, 0xC7, 0xD4, 0x5D, 0xB6, 0xFA, 0xFA, 0xB0, 0x52, 0x9B, 0xF4,
+    0xA6, 0x8C, 0xD0, 0xA6, 0xD5, 0xE7, 0x98, 0x5C, 0xF1, 0xBB, 0x69, 0xEE, 0x40, 0xE6, 0x24, 0x6C,
+    0x5A, 0x7D, 0xF6, 0xFB, 0x5C, 0xDC, 0xB9, 0xB4, 0xF1, 0x72, 0x76, 0xDC, 0x8C, 0x5E, 0xC9, 0x7C,
+    0xEB, 0xA9, 0x81, 0x9F, 0x3F, 0x19, 0x75, 0x32, 0xAB, 0x13, 0xF5, 0x78, 0xD0, 0xE7, 0x98, 0x7E,
+    0x15, 0x3E, 0x57, 0x3E, 0x64, 0xF9, 0xAD, 0x92, 0x97, 0x8A, 0x3F, 0x43, 0x09, 0xC5, 0x1D, 0x31,
+    0xBB, 0x23, 0xA6, 0xDB, 0x6F, 0x73, 0xE5, 0x0A, 0x4E, 0x9F, 0xFD, 0xAE, 0xE4, 0xA5, 0xD5, 0xE9,
+    0x64, 0xD4, 0xCE, 0xD3, 0x05, 0xAC, 0x32, 0x41, 0xC7, 0x20, 0xB5, 0xA9, 0x9B, 0xD3, 0x55, 0x73,
+    0xCE, 0x65, 0x6A, 0xCB, 0x93, 0x58, 0xBD, 0xF4, 0x9E, 0x97, 0x92, 0xCF, 0xA1, 0xF8, 0xE4, 0x0E,
+    0x9F, 0xDD, 0xB1, 0x94, 0xF9, 0x70, 0x52, 0x99, 0xA4, 0x44, 0xEC, 0x4F, 0x6B, 0xE0, 0xA0, 0x93,
+    0x45, 0x27, 0x5E, 0x8D, 0x7D, 0x29, 0x10, 0x12, 0x93, 0x18, 0x75, 0x20, 0x6D, 0xB3, 0x0E, 0x54,
+    0xB1, 0xE7, 0x95, 0xCE, 0x4A, 0x7F, 0x3D, 0x5E, 0xD4, 0x22, 0x8D, 0x3A, 0x6F, 0xF1, 0xF4, 0x2A,
+    0x2C, 0xDA, 0xB1, 0x97, 0x52, 0xDE, 0xF9, 0x9B, 0xB9, 0xDD, 0xD2, 0x62, 0x2E, 0x60, 0x1A, 0xCB,
+    0x2E, 0x82, 0x7C, 0xF6, 0xD2, 0xE1, 0x1F, 0x87, 0x36, 0x57, 0x23, 0xDB, 0x88, 0x0F, 0x3B, 0x4B,
+    0xD1, 0xEA, 0xAA, 0xCF, 0x53, 0x73, 0xC7, 0x28, 0x73, 0x0E, 0x5A, 0xE3, 0x27, 0x4A, 0x4E, 0x4A,
+    0xE3, 0x45, 0xB9, 0xEF, 0x45, 0xAD, 0xD5, 0x46, 0x50, 0x19, 0xA4, 0x6A, 0xFA, 0xD4, 0x6C, 0x9B,
+    0x9A, 0x3B, 0x6C, 0x5D, 0x1E, 0xC5, 0xC3, 0x4B, 0xD9, 0x4B, 0xAB, 0x7F, 0xF2, 0xDE, 0x05, 0xF4,
+    0x3B, 0x2C, 0xC7, 0xB4, 0x39, 0x69, 0xB3, 0xD2, 0x36, 0xE8, 0x84, 0xE7, 0xEE, 0x55, 0xFC, 0x83,
+    0xB0, 0xCD, 0xE7, 0xA8, 0xDD, 0x1E, 0x56, 0x69, 0xD1, 0xAA, 0x51, 0x95, 0xB9, 0xBA, 0x12, 0x3E,
+    0x87, 0xF8, 0x51, 0x77, 0x15, 0xA6, 0xB6, 0xFC, 0x46, 0x80, 0xFF, 0x55, 0x0F, 0xFB, 0x25, 0x1C,
+    0xCF, 0x4B, 0x17, 0x28, 0x81, 0xEB, 0xFA, 0xB2, 0x01, 0xB2, 0x87, 0x4F, 0xE0, 0x77, 0x99, 0xF3,
+    0xA6, 0x1B, 0x0F, 0x16, 0xFD, 0x58, 0x83, 0xAA, 0xD1, 0xBE, 0xEC, 0x4E, 0x5B, 0x38, 0xC6, 0x93,
+    0xA5, 0xB2, 0xC2, 0x9D, 0x07, 0xDF, 0x52, 0xB6, 0xD2, 0xE6, 0x75, 0x8E, 0xAB, 0xDF, 0xB9, 0x04,
+    0xCE, 0xB7, 0x63, 0x45, 0x8F, 0x99, 0x95, 0x79, 0x5D, 0x2B, 0xB6, 0x42, 0xFC, 0xE7, 0x75, 0xA9,
+    0x51, 0xB2, 0x52, 0x0E, 0xDA, 0x79, 0x6E, 0x65, 0xAA, 0x83, 0x6C, 0x1D, 0xBB, 0x3B, 0xCC, 0xE9,
+    0x8A, 0x39, 0xE7, 0x62, 0xDA, 0x52, 0xA6, 0xE6, 0x77, 0x5B, 0x7D, 0x76, 0x87, 0x4F, 0xAE, 0x84,
+    0xB4, 0x94, 0x98, 0x7C, 0x89, 0x29, 0xEE, 0xF1, 0x5F, 0x95, 0x83, 0xBE, 0x4C, 0x5E, 0x6F, 0x25,
+    0x77, 0x2E, 0x1B, 0x2B, 0xF0, 0x22, 0xAF, 0x11, 0x86, 0x13, 0xFF, 0x72, 0xC3, 0xAB, 0x60, 0x95,
+    0xE0, 0xB5, 0x2B, 0x0F, 0xFE, 0x0C, 0xEF, 0x1F, 0x44, 0xCC, 0xCB, 0x3E, 0x1F, 0xA6, 0x9B, 0x8E,
+    0xCF, 0x4A, 0xA6, 0xF9, 0x42, 0xF8, 0x45, 0xC3, 0x4A, 0x2B, 0x97, 0xB6, 0x3A, 0x19, 0x14, 0x0B,
+    0xF3, 0x57, 0x62, 0xEC, 0xAE, 0xE2, 0x73, 0x4C, 0xA6, 0x99, 0x4E, 0x48, 0x4B, 0xB1, 0x6D, 0xB8,
+    0xB2, 0xB9, 0xE0, 0xA5, 0x34, 0x48, 0xC2, 0x3E, 0x7E, 0xB3, 0xE2, 0xB3, 0xCF, 0x08, 0x31, 0xB5,
+    0xA9, 0xB1, 0xE4, 0xB9, 0x20, 0xE2, 0x66, 0x9A, 0x39, 0x99, 0x77, 0x57, 0xD0, 0x1A, 0xD2, 0x9B,
+    0x6D, 0xEC, 0x46, 0xBB, 0xAB, 0x4E, 0xF8, 0xEC, 0xF7, 0xBB, 0x2C, 0x1F, 0xB4, 0xA3, 0x62, 0xB5,
+    0x59, 0x25, 0x2F, 0x7C, 0x47, 0x6D, 0xD4, 0x61, 0x54, 0x9C, 0xD2, 0xFC, 0x65, 0x8A, 0x22, 0x06,
+    0xF3, 0x75, 0x33, 0xAD, 0x2D, 0xBF, 0xDE, 0xDD, 0x1F, 0xBE, 0x3A, 0xE3, 0x1A, 0xDE, 0xFD, 0xF8,
+    0xB3, 0x36, 0x9C, 0x3E, 0xBA, 0x62, 0x8B, 0xAA, 0xDF, 0xFC, 0x43, 0x7D, 0xD4, 0x91, 0xEB, 0xF6,
+    0x98, 0xAA, 0x2F, 0x3E, 0x2D, 0x59, 0x9B, 0x18, 0x44, 0xDC, 0xE2, 0xE6, 0x77, 0xBF, 0xBB, 0xC3,
+    0x1D, 0x53, 0x9B, 0xDA, 0xA0, 0xEB, 0xE6, 0x15, 0xA0, 0x87, 0x93, 0xDA, 0x74, 0xBE, 0xA1, 0x51,
+    0xC4, 0x4D, 0x9B, 0xCF, 0x3E, 0xBB, 0xE2, 0xCA, 0xD4, 0xA6, 0x36, 0x6A, 0x14, 0xDA, 0x9E, 0x86,
+    0x7A, 0x54, 0x19, 0xA5, 0x3A, 0xE9, 0x07, 0xCD, 0x35, 0x73, 0xBA, 0xC3, 0xF4, 0xA5, 0x98, 0xEE,
+    0x77, 0xD3, 0xFD, 0x6E, 0x4E, 0x9F, 0xA7, 0xE6, 0xB3, 0x6D, 0x7E, 0x77, 0xC7, 0x72, 0x84, 0xE2,
+    0x2E, 0x11, 0xB3, 0x0E, 0xAA, 0x4F, 0x43, 0x7D, 0x68, 0xCB, 0x31, 0x36, 0x9D, 0x46, 0xEA, 0x46,
+    0xBF, 0x92, 0xD1, 0xA0, 0xE9, 0x1C, 0x64, 0xDB, 0xD8, 0x5D, 0x35, 0xDD, 0x1D, 0x97, 0x73, 0xE7,
+    0x32, 0xB5, 0xE5, 0x99, 0x73, 0x8F, 0x90, 0x5C, 0xB9, 0x3A, 0x47, 0x80, 0x29, 0x31, 0x13, 0xFC,
+    0x9D, 0x60, 0x79, 0xA4, 0xEC, 0xDA, 0xF4, 0x0D, 0xC1, 0xE2, 0xB3, 0xCF, 0x53, 0x33, 0x8D, 0x98,
+    0x42, 0x72, 0xD5, 0x9E, 0xA3, 0x88, 0x47, 0xDC, 0x9D, 0xD4, 0x50, 0x14, 0xF3, 0xEF, 0xB5, 0x8D,
+    0x7D, 0x58, 0xF1, 0xF9, 0x4F, 0x55, 0x47, 0xDC, 0x9E, 0xD2, 0x08, 0x18, 0xE2, 0x49, 0xD4, 0xBE,
+    0xE8, 0x9C, 0xF4, 0x7A, 0x52, 0x62, 0x3E, 0x18, 0x05, 0x7E, 0xC7, 0x9C, 0xE0, 0xD3, 0xF5, 0xB7,
+    0x33, 0xEA, 0xBB, 0x3F, 0xB9, 0x80, 0x75, 0x1F, 0x54, 0x2F, 0x2D, 0x77, 0xF1, 0x13, 0x7B, 0x8E,
+    0x62, 0xF9, 0x58, 0x0F, 0x55, 0x9C, 0xF4, 0x47, 0x9D, 0x46, 0xBF, 0xD2, 0x23, 0x6D, 0x4A, 0xB1,
+    0x2C, 0x7B, 0xC8, 0xCB, 0x61, 0xEB, 0x52, 0x6C, 0xBB, 0x10, 0x13, 0xBD, 0x7C, 0x22, 0xFC, 0x47,
+    0x22, 0xA4, 0xB9, 0x84, 0xB4, 0xEC, 0xB6, 0x2E, 0xBB, 0xAD, 0xE6, 0x74, 0x87, 0x39, 0xD1, 0xCB,
+    0xED, 0xDE, 0x70, 0xDC, 0x96, 0xDD, 0x56, 0x06, 0xE1, 0xAA, 0x69, 0x84, 0xE4, 0x0E, 0xD3, 0xF1,
+    0x79, 0x2E, 0xC4, 0x55, 0xDB, 0xD8, 0xA7, 0xC6, 0x54, 0xFD, 0xCE, 0xFC, 0x95, 0xC0, 0xFF, 0xE2,
+    0x00, 0xF9, 0x84, 0xE9, 0xE7, 0xAD, 0x4D, 0xBA, 0x68, 0x85, 0xD0, 0x00, 0xE5, 0x1B, 0x2D, 0x9D,
+    0xCB, 0x0D, 0x2C, 0x6D, 0x83, 0xBF, 0xD5, 0x0E, 0x12, 0x18, 0xED, 0x60, 0x1F, 0xDF, 0x17, 0x29,
+    0x17, 0x51, 0xDE, 0xEF, 0x58, 0x97, 0x69, 0xCF, 0x28, 0xF4, 0x06, 0x56, 0x1D, 0x96, 0x5B, 0xC7,
+    0x52, 0xAB, 0x7F, 0xAC, 0x50, 0x96, 0x12, 0xFE, 0xE1, 0x74, 0xC7, 0x92, 0xF5, 0x8F, 0xCD, 0x95,
+    0xE5, 0xB3, 0x6E, 0x9A, 0xAD, 0xFA, 0xAE, 0x4C, 0xF7, 0x39, 0x6E, 0x7A, 0xE5, 0x58, 0x72, 0xFC,
+    0xB9, 0x5C, 0x09, 0x39, 0xFC, 0xF6, 0x8C, 0xC5, 0xE9, 0x6A, 0x06, 0x6B, 0x67, 0x92, 0xB6, 0xFB,
+    0xEB, 0x0C, 0x9D, 0x9B, 0xAB, 0xAE, 0x2E, 0x85, 0x2B, 0xDC, 0xDC, 0x87, 0xB6, 0xE5, 0x18, 0x35,
+    0x68, 0x33, 0xA7, 0xAB, 0xD8, 0x1A, 0x13, 0xF3, 0xD7, 0x0D, 0xBC, 0x32, 0xC4, 0x13, 0xD0, 0x0E,
+    0x56, 0x2B, 0x04, 0x81, 0x51, 0x03, 0xFF, 0xBB, 0x8A, 0xD1, 0x5C, 0x58, 0x8A, 0xCF, 0x83, 0xD6,
+    0x98, 0xE6, 0x3A, 0x68, 0xFD, 0x7F, 0xC0, 0xCE, 0xA3, 0x20, 0x75, 0xAF, 0x57, 0x4E, 0x77, 0xDA,
+    0xC6, 0x6A, 0x1A, 0x4C, 0xF5, 0x92, 0x72, 0xB6, 0xF8, 0xEC, 0x0E, 0xE1, 0xFF, 0xA5, 0x0D, 0x5A,
+    0x76, 0xDB, 0xB4, 0xF9, 0xCF, 0x4E, 0xF4, 0xCA, 0xE1, 0x9A, 0x7F, 0xA4, 0x12, 0xA5, 0x8F, 0xA4,
+    0x3E, 0xE8, 0xDD, 0x03, 0x7C, 0x62, 0xD0, 0xA5, 0x48, 0x7D, 0x06, 0xAD, 0x53, 0x1D, 0x3B, 0xF1,
+    0xED, 0x8E, 0x36, 0x9F, 0xB5, 0xDE, 0x2D, 0x3F, 0xB5, 0xB9, 0x4C, 0xED, 0xDA, 0x26, 0xF1, 0x9D,
+    0x8E, 0x56, 0x9F, 0xB5, 0xFA, 0xE4, 0x8A, 0x4F, 0x73, 0x99, 0xDA, 0x5C, 0x6C, 0x33, 0xB2, 0xCD,
+    0x74, 0xF4, 0x76, 0x1F, 0xB5, 0x29, 0xC7, 0x7F, 0xD3, 0x23, 0x95, 0x59, 0x5F, 0xAB, 0x37, 0xA3,
+    0x43, 0xED, 0x43, 0xFC, 0xE1, 0x9A, 0x5F, 0x59, 0x79, 0x01, 0xF8, 0x73, 0x2F, 0x75, 0xCE, 0xFA,
+    0x5A, 0xD2, 0xA7, 0x3A, 0xD4, 0x42, 0xF1, 0x87, 0x6B, 0xB6, 0xB1, 0xF2, 0xC2, 0xE5, 0xC4, 0x3B,
+    0xD9, 0x99, 0x01, 0x5C, 0xF1, 0x4A, 0xCC, 0x2A, 0x58, 0x55, 0x86, 0x37, 0x9E, 0x36, 0xFE, 0x7F,
+    0xB9, 0xB2, 0x48, 0xAB, 0x93, 0x0E, 0xA3, 0x07, 0x42, 0x57, 0x6A, 0x97, 0xB9, 0x4C, 0x6D, 0x6A,
+    0xA6, 0x73, 0xEB, 0x9B, 0xAC, 0x83, 0x3A, 0x0C, 0xAF, 0x5E, 0x02, 0x61, 0x6A, 0xB6, 0xC2, 0xB2,
+    0x5F, 0x26, 0x14, 0x98, 0x73, 0x6A, 0xE0, 0xCA, 0xF2, 0xE8, 0x55, 0x42, 0x92, 0xEA, 0xD8, 0x8D,
+    0xD4, 0xDC, 0xE1, 0x7A, 0x3C, 0x7C, 0x0A, 0xC9, 0x7F, 0xA2, 0x51, 0xE8, 0x07, 0xCD, 0x56, 0x73,
+    0x2E, 0xFB, 0x5C, 0x96, 0xA2, 0xD5, 0xFF, 0x51, 0x2F, 0x37, 0xA2, 0xEA, 0x5C, 0x08, 0x5A, 0xE3,
+    0x76, 0xC1, 0xD9, 0xD3, 0x36, 0xC2, 0x79, 0xAF, 0x8D, 0x70, 0xBE, 0x86, 0xBB, 0x9A, 0xEF, 0xC5,
+    0xF5, 0x58, 0xE7, 0x62, 0xDB, 0x72, 0x81, 0x59, 0x9B, 0x8B, 0x3B, 0x9C, 0x54, 0xAC, 0x94, 0x06,
+    0xF5, 0x3B, 0x50, 0x1C, 0x62, 0x25, 0x2A, 0xCD, 0x6A, 0xE3, 0xF7, 0xB4, 0xE2, 0x77, 0x6C, 0x1B,
+    0x3F, 0xD0, 0x28, 0x25, 0x69, 0x7F, 0xF1, 0xCD, 0x83, 0xA9, 0x61, 0xF4, 0x97, 0x93, 0xBE, 0x2F,
+    0xFD, 0x58, 0xDA, 0xBC, 0x2E, 0x3F, 0x5D, 0xA5, 0xB1, 0x11, 0x2B, 0x4B, 0x99, 0xD5, 0xD0, 0x26,
+    0x55, 0x73, 0xBA, 0x73, 0x29, 0xAE, 0x84, 0xE4, 0x73, 0xF8, 0x79, 0x27, 0xBE, 0x2D, 0x1D, 0x63,
+    0x77, 0x52, 0x72, 0xD5, 0x4B, 0xF8, 0x4F, 0xF4, 0x41, 0x43, 0x97, 0xBF, 0x96, 0x3D, 0x24, 0x9F,
+    0xB5, 0xEA, 0x1D, 0x99, 0x36, 0x4A, 0xC7, 0x5C, 0x8C, 0xB4, 0xC6, 0x34, 0x6A, 0x07, 0x78, 0x01,
+    0x18, 0xA2, 0xF6, 0xE1, 0xD6, 0x4A, 0x4B, 0xF6, 0x9C, 0x1A, 0x5A, 0x63, 0x72, 0x87, 0xAD, 0x68,
+    0xD3, 0x6A, 0xA5, 0xC2, 0x22, 0x31, 0x48, 0x05, 0xFF, 0x59, 0xC7, 0x35, 0x9F, 0x47, 0x99, 0x46,
+    0xC8, 0x21, 0xB9, 0x6A, 0xAB, 0x11, 0x5A, 0xB1, 0x3F, 0xDE, 0x99, 0x3F, 0xAD, 0x2C, 0x9F, 0x56,
+    0xDC, 0xC3, 0xF2, 0x14, 0x48, 0xFE, 0x0C, 0x34, 0xEA, 0xBF, 0x00, 0xC5, 0xBD, 0x4D, 0xAC, 0x25,
+    0xC7, 0x95, 0x26, 0xF6, 0x65, 0x06, 0x5F, 0xC5, 0x34, 0xD3, 0xEA, 0xE0, 0xA2, 0x1E, 0xDC, 0x4D,
+    0xA9, 0x95, 0x0D, 0x43, 0x06, 0xDA, 0xB4, 0xA8, 0xEC, 0x45, 0x2F, 0x38, 0xC0, 0x2B, 0x46, 0x16,
+    0x69, 0x8F, 0x8C, 0xE1, 0xA2, 0x5E, 0xDB, 0xF5, 0x24, 0xC0, 0x04, 0x4C, 0x2D, 0xBC, 0x18, 0xAB,
+    0x67, 0x5C, 0x5A, 0xD0, 0x00, 0x07, 0x26, 0x19, 0x49, 0xD2, 0x36, 0x81, 0x69, 0xC0, 0x2C, 0xD8,
+    0x9E, 0xEE, 0xC5, 0x2C, 0x54, 0x0B, 0x0D, 0xC0, 0x7E, 0xB4, 0x5D, 0x5C, 0x70, 0xA1, 0x06, 0x58,
+    0x8C, 0x60, 0x95, 0x0D, 0x02, 0xC3, 0x05, 0x93, 0x2A, 0xB7, 0x69, 0x58, 0x0B, 0x26, 0x45, 0x4A,
+    0xF2, 0x90, 0x8B, 0x0A, 0x92, 0x41, 0x31, 0xAA, 0x2A, 0x22, 0x3E, 0x2F, 0x22, 0xEF, 0x7D, 0xAF,
+    0xF8, 0x23, 0xCB, 0x23, 0x89, 0xBA, 0xC0, 0xFB, 0xB9, 0x37, 0xFF, 0xE2, 0xF7, 0x9C, 0xEF, 0x9C,
+    0xF3, 0x9D, 0x73, 0xD1, 0x39, 0x51, 0xA0, 0xBD, 0xC8, 0xE8, 0x27, 0x00, 0xC0, 0x89, 0x0B, 0xB0,
+    0x50, 0x0B, 0x0A, 0xFA, 0x59, 0x24, 0x68, 0x27, 0x13, 0xEC, 0xA4, 0x22, 0x38, 0xF6, 0xBE, 0x25,
+    0xB4, 0x6F, 0xCE, 0x02, 0x00, 0xA0, 0x26, 0x34, 0x01, 0x8D, 0x7D, 0x07, 0x96, 0xB3, 0x66, 0xEA,
+    0xF8, 0xDC, 0x69, 0x4E, 0x18, 0x3C, 0x44, 0x06, 0x8C, 0x43, 0x97, 0x00, 0x3B, 0xA1, 0x8B, 0x80,
+    0x75, 0x90, 0xA5, 0x71, 0x9A, 0xA9, 0x25, 0x9D, 0x64, 0x84, 0xFA, 0x3F, 0x80, 0x08, 0xF4, 0x23,
+    0xB0, 0x8F, 0xCD, 0x6B, 0x28, 0x23, 0x24, 0x39, 0x42, 0x33, 0xA1, 0xE5, 0x5F, 0x2D, 0x50, 0x11,
+    0x80, 0x71, 0x40, 0x4B, 0x00, 0x5D, 0x04, 0xA0, 0x67, 0x40, 0x93, 0x23, 0xC8, 0x0C, 0x49, 0x7A,
+    0xEC, 0xF0, 0x9F, 0x03, 0x22, 0x03, 0x50, 0x1E, 0x80, 0x9D, 0xEA, 0x99, 0x0D, 0xDF, 0x3D, 0x3C,
+    0xDF, 0x91, 0x9C, 0x34, 0x99, 0x41, 0xD2, 0xE3, 0xF7, 0xD0, 0x8E, 0x97, 0xEC, 0xB9, 0xA7, 0xC8,
+    0x22, 0xC8, 0x45, 0x2D, 0x66, 0xD2, 0xD0, 0x4D, 0x44, 0x12, 0x5E, 0x78, 0x35, 0x0F, 0xD3, 0x70,
+    0x33, 0xB7, 0x64, 0x56, 0x64, 0xFC, 0xFD, 0x1D, 0xE1, 0x50, 0xEF, 0x6A, 0x1C, 0x47, 0x15, 0xBA,
+    0xD0, 0x12, 0x66, 0xD2, 0x4E, 0x24, 0x15, 0xA0, 0x5F, 0x26, 0xDA, 0xAC, 0x1D, 0xFA, 0x1F, 0x07,
+    0x80, 0x05, 0x50, 0x74, 0x80, 0x8D, 0x68, 0xC8, 0x84, 0x81, 0x9C, 0x9A, 0x07, 0xF3, 0x3E, 0x60,
+    0x26, 0xB4, 0x17, 0xCB, 0x05, 0x18, 0x12, 0x1D, 0xB9, 0xA0, 0x21, 0x80, 0x61, 0x01, 0xDA, 0x0C,
+    0x00, 0x2F, 0x1D, 0xBD, 0xFE, 0x0B, 0x7C, 0xFA, 0x83, 0x93, 0xC0, 0xC0, 0x49, 0x92, 0xA3, 0xFE,
+    0x59, 0x6A, 0x0A, 0xEE, 0x90, 0x11, 0x50, 0x11, 0xE8, 0x0B, 0x60, 0x09, 0xF5, 0x31, 0x61, 0x44,
+    0x12, 0x51, 0x7A, 0xE5, 0x7B, 0x37, 0x2C, 0x05, 0x9A, 0x1E, 0x9A, 0x40, 0x9F, 0xEA, 0x50, 0x28,
+    0xFF, 0x35, 0x98, 0xE9, 0xA5, 0xE7, 0x72, 0x4B, 0xCE, 0x27, 0x78, 0x1D, 0x38, 0x09, 0xF4, 0xF7,
+    0x2D, 0x1C, 0xAE, 0x46, 0xDB, 0xB9, 0xB0, 0x19, 0x7F, 0x4E, 0xC0, 0x50, 0x38, 0x41, 0xCD, 0x30,
+    0xA3, 0x58, 0x80, 0x4B, 0xF8, 0xE1, 0x09, 0x3E, 0xE9, 0xFB, 0x86, 0xA9, 0x7B, 0x6A, 0x7E, 0xBC,
+    0x19, 0xF7, 0xF6, 0x94, 0x43, 0xFB, 0xC6, 0x14, 0x80, 0xAF, 0xBE, 0xD0, 0x03, 0xCD, 0xCD, 0xD3,
+    0x1E, 0x50, 0x2F, 0xF4, 0x40, 0xF3, 0xF1, 0x14, 0x80, 0xAF, 0xEE, 0xA9, 0x09, 0xED, 0x55, 0xF7,
+    0x18, 0xB0, 0x37, 0x08, 0xA6, 0xCE, 0x85, 0x8E, 0x4F, 0x78, 0xB9, 0x34, 0x78, 0x0C, 0xFD, 0x8C,
+    0x61, 0x82, 0x7E, 0xD7, 0xCE, 0xC0, 0x39, 0xCE, 0x00, 0x76, 0xEA, 0xA3, 0xBB, 0xB7, 0x67, 0x52,
+    0xFD, 0x24, 0x19, 0xF1, 0x41, 0x50, 0xCF, 0xCC, 0x8F, 0xE9, 0xD6, 0xE7, 0xFE, 0x32, 0x8B, 0xC8,
+    0x01, 0x23, 0x0C, 0x79, 0x9D, 0xE4, 0xCF, 0x49, 0xFE, 0xB7, 0x07, 0x07, 0x2F, 0x01, 0x4D, 0x04,
+    0xE4, 0x02, 0xF4, 0x13, 0xF0, 0x38, 0x80, 0xB3, 0x77, 0x1D, 0x9E, 0xE1, 0xDB, 0xFC, 0x88, 0xE9,
+    0x97, 0x76, 0x45, 0xE7, 0xD6, 0xF7, 0x82, 0xB1, 0x7B, 0x6A, 0x3E, 0xD5, 0xCD, 0x7B, 0x7B, 0x62,
+    0x3E, 0xD5, 0xBE, 0x31, 0x9D, 0x12, 0xF3, 0x57, 0x5F, 0x10, 0xF3, 0x8B, 0xCD, 0xCD, 0x51, 0x73,
+    0x54, 0x2F, 0x08, 0xCE, 0xCD, 0xC7, 0xD3, 0xA9, 0x01, 0x5F, 0xDD, 0x13, 0x73, 0x6C, 0xAF, 0xBA,
+    0x53, 0xD2, 0xED, 0x0D, 0x62, 0xBE, 0xB7, 0x73, 0xE1, 0x54, 0xF3, 0x91, 0x97, 0x0B, 0x7E, 0x59,
+    0x57, 0x60, 0xC9, 0xCB, 0x24, 0x15, 0x19, 0x01, 0xF4, 0xB1, 0x65, 0xEA, 0xDF, 0x8B, 0x97, 0xC4,
+    0x87, 0xBE, 0x7B, 0xCD, 0x0D, 0xC3, 0x13, 0x49, 0x73, 0x36, 0x05, 0x77, 0x4E, 0xC0, 0xCE, 0x08,
+    0x68, 0x00, 0x09, 0x10, 0x1E, 0x50, 0x0E, 0xD0, 0x38, 0x71, 0xC8, 0xC3, 0x87, 0xC8, 0x62, 0xC8,
+    0x78, 0x60, 0xFE, 0xF9, 0xFE, 0xAD, 0x47, 0x81, 0xDA, 0xC7, 0x63, 0x63, 0x32, 0xE1, 0xDC, 0x2C,
+    0x18, 0x05, 0x53, 0xF3, 0x44, 0x06, 0x12, 0x44, 0x82, 0xF2, 0xD0, 0xAE, 0x29, 0xE8, 0x02, 0x06,
+    0x06, 0x4D, 0xAF, 0xE9, 0x1B, 0x3B, 0x69, 0xBA, 0x97, 0x38, 0x8E, 0x19, 0xC2, 0x9F, 0xB0, 0xA3,
+    0xF6, 0xB8, 0xE8, 0xA1, 0x66, 0xE8, 0x33, 0x7F, 0x9D, 0x34, 0x17, 0x73, 0x1D, 0x00, 0x70, 0x00,
+    0x4E, 0x9C, 0xEC, 0x64, 0xC6, 0x1D, 0x00, 0xDA, 0x29, 0xDF, 0x10, 0xC6, 0x75, 0xB1, 0x21, 0xF4,
+    0xDC, 0x45, 0x70, 0xD4, 0xB3, 0x4C, 0x20, 0x7A, 0x2F, 0x13, 0xEC, 0x34, 0x2C, 0x22, 0x83, 0x93,
+    0xF2, 0x22, 0xC3, 0xB8, 0xC1, 0xB7, 0x04, 0x5D, 0x57, 0xFA, 0x02, 0x4D, 0x06, 0x90, 0x6F, 0x3A,
+    0xC9, 0xA4, 0x31, 0x2C, 0x00, 0x38, 0x1E, 0xDF, 0xAD, 0xC6, 0x01, 0x6D, 0x01, 0xA0, 0x36, 0xAB,
+    0x10, 0x2D, 0x99, 0x14, 0x99, 0x34, 0xCB, 0x8B, 0x86, 0x61, 0xCF, 0x32, 0xEC, 0xF1, 0x13, 0x3F,
+    0x96, 0x61, 0xCF, 0x30, 0xEC, 0x69, 0x86, 0xBD, 0x9E, 0x61, 0x4F, 0x32, 0xEC, 0xE1, 0x64, 0xD8,
+    0x03, 0x7E, 0xD5, 0x9F, 0x1F, 0xFC, 0x49, 0x33, 0x9A, 0x2B, 0x54, 0x49, 0xCF, 0x27, 0xD1, 0x39,
+    0x33, 0x99, 0xE9, 0xA5, 0x7F, 0x71, 0x93, 0xAF, 0x45, 0xE0, 0xF6, 0x49, 0x26, 0xC1, 0xCB, 0x8C,
+    0x9A, 0xA7, 0xAF, 0x7A, 0x58, 0x74, 0x1E, 0x05, 0x6A, 0x6E, 0x12, 0x06, 0xD7, 0x46, 0xB4, 0x05,
+    0x4C, 0xC3, 0x9B, 0x57, 0xFD, 0xE3, 0x8F, 0xCB, 0xF7, 0xE6, 0x4B, 0x97, 0xD4, 0x1B, 0x6F, 0x25,
+    0xCD, 0xD3, 0x9C, 0x9B, 0x11, 0xB8, 0x73, 0xC4, 0x4B, 0x50, 0x01, 0xBD, 0xEB, 0x38, 0x8A, 0x20,
+    0xE9, 0x51, 0x60, 0x89, 0xC1, 0x89, 0x67, 0x16, 0xE9, 0x81, 0x8C, 0x0C, 0xF4, 0x4E, 0x4F, 0x68,
+    0x53, 0xE7, 0xEF, 0x9C, 0x86, 0x97, 0x93, 0x4C, 0x22, 0xEA, 0xD3, 0x74, 0xFA, 0xCC, 0xA2, 0xA3,
+    0xFC, 0x20, 0x29, 0x8E, 0x30, 0xE2, 0x63, 0x0F, 0x35, 0x5F, 0x32, 0x10, 0x71, 0x78, 0xC0, 0xC3,
+    0x8A, 0x1B, 0x9C, 0x7A, 0x67, 0x98, 0x44, 0x38, 0xF1, 0x1C, 0xA7, 0x02, 0xF4, 0x6E, 0x70, 0x68,
+    0xE3, 0xFA, 0x4C, 0x91, 0x21, 0x3D, 0x6C, 0x80, 0x46, 0x4F, 0x27, 0x02, 0x2C, 0x31, 0x4C, 0x78,
+    0x3B, 0x36, 0x09, 0x50, 0xB3, 0x9A, 0x01, 0x83, 0x02, 0xB4, 0xA9, 0xF3, 0x76, 0xEA, 0xBC, 0x19,
+    0xE8, 0xF4, 0x53, 0xC1, 0x72, 0xCA, 0x7A, 0x9A, 0x29, 0x3F, 0x48, 0x10, 0x11, 0xBD, 0x43, 0xEF,
+    0x90, 0xD1, 0x64, 0xA8, 0x05, 0xC3, 0x0C, 0x0B, 0x91, 0x20, 0x3D, 0xCC, 0x04, 0x3D, 0x4A, 0x16,
+    0x11, 0x31, 0x30, 0x0E, 0x0E, 0xE4, 0xDC, 0xD8, 0x09, 0xDD, 0xDC, 0xD1, 0x63, 0x70, 0xF2, 0xBD,
+    0x08, 0x83, 0xA6, 0x8D, 0xC8, 0x80, 0x08, 0x22, 0xA2, 0xB9, 0xB8, 0x74, 0x1E, 0x2D, 0xD1, 0x3B,
+    0xB4, 0xD6, 0xE9, 0x11, 0xE8, 0x96, 0xD2, 0x3E, 0x8B, 0xEE, 0x27, 0xA9, 0x4B, 0x7F, 0x7B, 0xEE,
+    0x0D, 0xDF, 0x47, 0xCB, 0x67, 0x66, 0x13, 0x4C, 0x1E, 0x26, 0x06, 0xD4, 0x3E, 0x23, 0xA9, 0x57,
+    0x3D, 0x44, 0x18, 0xCE, 0x2C, 0xE8, 0x16, 0x73, 0x31, 0xA2, 0x77, 0x96, 0x09, 0x7A, 0x3C, 0xB4,
+    0xFF, 0x0F, 0x0A, 0x30, 0xB8, 0x36, 0x01, 0x43, 0x55, 0x58, 0xDA, 0x61, 0x08, 0xE8, 0x12, 0x1A,
+    0x02, 0x7F, 0xB8, 0x59, 0x42, 0x22, 0xA2, 0xC9, 0x00, 0xD1, 0x70, 0x6A, 0xE9, 0x04, 0x27, 0xC1,
+    0xB1, 0x21, 0x60, 0x27, 0xE8, 0xA5, 0xE9, 0xF2, 0x83, 0x2F, 0x93, 0x71, 0x60, 0x69, 0x19, 0x71,
+    0xF4, 0x6A, 0x8A, 0x98, 0xD1, 0xF0, 0xA6, 0x07, 0xC8, 0x08, 0xEC, 0x75, 0x11, 0xD8, 0xC1, 0x1D,
+    0x9B, 0xE3, 0x2A, 0x03, 0xE8, 0x38, 0x01, 0x82, 0x0B, 0xD0, 0x32, 0x01, 0xA0, 0x05, 0x60, 0xCF,
+    0x39, 0x40, 0xBF, 0xEA, 0x81, 0xE1, 0x47, 0x09, 0x50, 0xDE, 0x8C, 0xE8, 0x42, 0x3F, 0x43, 0x26,
+    0x19, 0x21, 0x72, 0x53, 0xD0, 0xF0, 0xD0, 0x4E, 0x55, 0x0D, 0x19, 0x32, 0x41, 0x93, 0x44, 0xEF,
+    0xA1, 0x9D, 0x8A, 0x50, 0x5E, 0x26, 0x88, 0x2C, 0x0A, 0xC0, 0xD3, 0xAC, 0xDA, 0x01, 0xBB, 0x00,
+    0x04, 0x47, 0x60, 0xB0, 0xA8, 0x8B, 0x56, 0xCC, 0x1E, 0xE8, 0xAE, 0x39, 0x40, 0x25, 0x00, 0xCD,
+    0x2D, 0x0D, 0xB3, 0x71, 0x6D, 0xD7, 0x40, 0x57, 0x9B, 0xD5, 0xFD, 0x22, 0xD5, 0x56, 0xB5, 0x79,
+    0x70, 0xB5, 0x51, 0xF6, 0x74, 0xAE, 0x6D, 0xD2, 0x73, 0xBF, 0x34, 0x3C, 0xB4, 0x93, 0x22, 0x09,
+    0x43, 0x26, 0x41, 0xD2, 0xF7, 0x1E, 0xDA, 0x71, 0x02, 0x65, 0x82, 0xC8, 0x7A, 0x81, 0xFA, 0x68,
+    0xD3, 0x9C, 0x81, 0xA4, 0x03, 0x24, 0x59, 0xFB, 0x4D, 0x72, 0xAA, 0x9F, 0x06, 0x40, 0x26, 0xE3,
+    0x00, 0x80, 0x7F, 0x19, 0x01, 0x60, 0xF0, 0x1C, 0x01, 0xC8, 0x5C, 0xB7, 0x35, 0x9F, 0xE0, 0xE1,
+    0xB3, 0xC0, 0xE0, 0x07, 0x72, 0x82, 0xC8, 0x2D, 0x19, 0x00, 0x3A, 0x4D, 0x02, 0x7D, 0x79, 0x2E,
+    0x01, 0x10, 0xF5, 0xF6, 0xB0, 0xF5, 0xF6, 0x7D, 0xBD, 0xBD, 0x28, 0x55, 0x32, 0x58, 0x07, 0x1E,
+    0x3E, 0x0B, 0x15, 0xD0, 0x93, 0x4E, 0x10, 0x2D, 0x99, 0x60, 0x1C, 0x34, 0xE9, 0x00, 0xCD, 0xF3,
+    0x75, 0xCE, 0xE4, 0xAA, 0x7B, 0x23, 0x38, 0x19, 0x2F, 0x32, 0xCC, 0xA2, 0x3C, 0x38, 0x19, 0xD7,
+    0xB2, 0x25, 0xBA, 0x44, 0xFA, 0xE1, 0x43, 0x72, 0xE2, 0xF7, 0x99, 0x45, 0x19, 0xCA, 0x85, 0x3E,
+    0x0C, 0x1E, 0xD6, 0x71, 0x92, 0x45, 0x64, 0x68, 0xDF, 0x7B, 0xC9, 0xC9, 0xBC, 0xC7, 0xD8, 0x92,
+    0x9C, 0x14, 0x19, 0xA0, 0x8F, 0xAD, 0x92, 0xE1, 0xFC, 0xA3, 0x00, 0x4B, 0x44, 0x43, 0x7A, 0xB4,
+    0x8B, 0x99, 0xD1, 0x8C, 0x1B, 0xD1, 0xDF, 0xD8, 0x0C, 0x28, 0xD2, 0x41, 0x93, 0x1E, 0xBC, 0x61,
+    0x83, 0xE0, 0xD4, 0x27, 0x59, 0xD0, 0x25, 0x95, 0x20, 0x73, 0x1F, 0x20, 0xF2, 0xE0, 0xEB, 0xD8,
+    0x8A, 0xAC, 0x67, 0xC8, 0xA4, 0x67, 0x74, 0xC9, 0xCC, 0x50, 0xC9, 0xCC, 0x50, 0x51, 0xCF, 0x18,
+    0xBC, 0x5E, 0x60, 0x16, 0x1D, 0x1A, 0xBA, 0xBE, 0x3C, 0xC8, 0x51, 0x91, 0x05, 0x82, 0x0C, 0x80,
+    0xE1, 0x04, 0x60, 0x1F, 0xB8, 0x0D, 0x3B, 0x62, 0x69, 0x82, 0x9D, 0xCC, 0xE5, 0xD2, 0x7B, 0xC5,
+    0x04, 0x4D, 0x80, 0x0E, 0x7D, 0x81, 0x64, 0x6C, 0xA8, 0x17, 0xE3, 0xEC, 0xD3, 0xBE, 0x8D, 0x5F,
+    0xC1, 0xED, 0x9B, 0xE6, 0x7F, 0x0D, 0x8D, 0xCD, 0x97, 0xD0, 0xAD, 0x2B, 0x30, 0x80, 0xD7, 0x6D,
+    0x14, 0x1C, 0x87, 0x24, 0x33, 0x6C, 0x52, 0xB1, 0x61, 0xEE, 0xBD, 0xF8, 0x38, 0x0F, 0x5E, 0xBD,
+    0x9D, 0xF5, 0x32, 0x5C, 0xC9, 0x7A, 0x36, 0x22, 0xE9, 0x97, 0x93, 0x4C, 0xFA, 0x4A, 0xE8, 0x92,
+    0x7E, 0x6D, 0x51, 0x41, 0x5F, 0x73, 0xBD, 0xD7, 0x84, 0x5E, 0x74, 0xC2, 0xF1, 0x36, 0x0E, 0x64,
+    0x80, 0x31, 0x9C, 0xF0, 0x95, 0x66, 0xDC, 0x0E, 0xDA, 0xCE, 0xFE, 0x0A, 0xE1, 0x8C, 0xAB, 0x72,
+    0x5F, 0xC4, 0x75, 0x7D, 0x03, 0x10, 0x09, 0x2A, 0xEA, 0xB9, 0x65, 0x5B, 0xA0, 0x97, 0xDE, 0xAB,
+    0x04, 0x36, 0x84, 0x0A, 0x7A, 0x86, 0x7D, 0x20, 0x41, 0x5E, 0x27, 0xA0, 0x39, 0x43, 0x30, 0x02,
+    0x03, 0x81, 0x86, 0x73, 0x85, 0x40, 0x20, 0x80, 0xDE, 0xAF, 0x37, 0x1F, 0x96, 0x55, 0xB3, 0x68,
+    0x07, 0xC8, 0xB4, 0x62, 0x41, 0xE8, 0xB9, 0x6A, 0x17, 0x99, 0x80, 0x96, 0xFF, 0x12, 0xA8, 0x53,
+    0xCA, 0x51, 0x91, 0x5E, 0xA6, 0x2E, 0xB7, 0x04, 0x27, 0x4E, 0x7A, 0xD1, 0xB3, 0x8A, 0xCA, 0xCB,
+    0x2C, 0x93, 0x64, 0x4B, 0x72, 0x5A, 0xD1, 0xE3, 0xD8, 0xF3, 0x5F, 0xD7, 0xCB, 0xCB, 0xAA, 0xC0,
+    0xF4, 0xBC, 0x4E, 0xF8, 0x08, 0x40, 0x32, 0x02, 0x20, 0x33, 0xEA, 0xB8, 0xC2, 0xF8, 0x21, 0xA0,
+    0x25, 0xF4, 0x02, 0x15, 0xC0, 0x11, 0xDA, 0x75, 0x09, 0x0D, 0x1B, 0x2E, 0xE8, 0xD2, 0x90, 0x01,
+    0xFD, 0x16, 0x1D, 0xC0, 0x33, 0x09, 0x10, 0x49, 0x7B, 0xA0, 0xF7, 0x5C, 0x00, 0x3B, 0xD1, 0x43,
+    0x94, 0x86, 0x1E, 0x2A, 0x80, 0x33, 0x8C, 0x03, 0xA7, 0x96, 0x10, 0x05, 0x5D, 0x9C, 0xFA, 0x00,
+    0x7D, 0x95, 0x74, 0xE0, 0x19, 0x66, 0xC8, 0x34, 0x70, 0xC2, 0xE0, 0x9B, 0x11, 0xE0, 0x04, 0x40,
+    0x66, 0x00, 0x27, 0xAC, 0xDF, 0xE0, 0x1F, 0xD8, 0x08, 0xA0, 0xE5, 0xD1, 0x3C, 0xB4, 0x59, 0x3A,
+    0xC1, 0x9B, 0x4B, 0x43, 0x7A, 0xFC, 0xB0, 0x0F, 0x38, 0xB9, 0x81, 0xDF, 0xBC, 0x1C, 0x1B, 0xA6,
+    0xD2, 0x90, 0x1C, 0xF9, 0x33, 0x3A, 0xB3, 0x68, 0xAF, 0x7D, 0x17, 0x55, 0x68, 0x8B, 0x4C, 0xE0,
+    0x7D, 0x84, 0x76, 0xD6, 0xF5, 0x7E, 0xF0, 0x2A, 0x76, 0x49, 0xE6, 0x96, 0xFF, 0x82, 0x30, 0xA4,
+    0xEB, 0x78, 0xCD, 0xC3, 0x5E, 0x8D, 0xAB, 0x34, 0x3A, 0x59, 0x9F, 0x28, 0xAF, 0x39, 0x74, 0x4F,
+    0xCD, 0xE8, 0x9E, 0x9A, 0x21, 0xAF, 0xB9, 0xDA, 0x8A, 0x93, 0xF5, 0x59, 0xDA, 0xBF, 0xD4, 0x30,
+    0x15, 0x49, 0x66, 0x55, 0xCE, 0xA5, 0x3E, 0xAA, 0xA4, 0x7D, 0x17, 0xF5, 0xDC, 0x45, 0xE3, 0x54,
+    0xB0, 0x4E, 0x79, 0xEB, 0x7A, 0x6F, 0x9D, 0x5E, 0xAC, 0x33, 0xB3, 0xFD, 0x19, 0x9D, 0x21, 0xDD,
+    0x40, 0xEB, 0xBA, 0xAC, 0x27, 0x1C, 0xF5, 0x47, 0xFB, 0x4B, 0x5C, 0x1A, 0x66, 0x32, 0x49, 0x92,
+    0xCC, 0x2A, 0x9F, 0xE3, 0x7D, 0xA5, 0x0F, 0x2A, 0x37, 0x45, 0x2F, 0x2A, 0x8A, 0xAC, 0x67, 0x15,
+    0xCF, 0x25, 0xE3, 0x14, 0x19, 0xAC, 0x53, 0xE4, 0x64, 0xA7, 0xFE, 0xC6, 0xFF, 0x04, 0x3B, 0x69,
+    0x0F, 0x58, 0x67, 0x3C, 0x60, 0x7F, 0xC2, 0xD8, 0xCC, 0x9A, 0x24, 0xE7, 0x81, 0x96, 0x9C, 0xBB,
+    0xAC, 0x35, 0x47, 0x8C, 0xD8, 0x2C, 0x62, 0x31, 0x7F, 0x1D, 0xF2, 0x46, 0x46, 0xC7, 0x80, 0x96,
+    0x0E, 0x8A, 0x33, 0xF4, 0x35, 0x8F, 0x2F, 0x75, 0x01, 0x90, 0x11, 0xF6, 0xED, 0x28, 0x37, 0xB8,
+    0x25, 0xE8, 0x64, 0x66, 0x15, 0xAD, 0x53, 0x91, 0x93, 0x0A, 0x1C, 0x7B, 0xCF, 0x71, 0xF0, 0x1C,
+    0xF5, 0x62, 0x1D, 0x9D, 0x21, 0xC7, 0x81, 0x19, 0x92, 0xCB, 0x76, 0x48, 0xA0, 0x96, 0x6F, 0x40,
+    0x97, 0x4B, 0xB0, 0x4C, 0x08, 0x83, 0xC7, 0xFE, 0xFA, 0xE0, 0xA1, 0xA0, 0x21, 0x9D, 0x24, 0xBD,
+    0xCA, 0xE7, 0xC2, 0x10, 0x54, 0xD4, 0x4B, 0x97, 0x8C, 0xEB, 0x92, 0x71, 0x5D, 0xB4, 0x93, 0x8A,
+    0x76, 0x52, 0xC1, 0x4E, 0x75, 0xBC, 0xCC, 0x5B, 0x74, 0x9A, 0x9C, 0x14, 0x0B, 0x5A, 0xBE, 0x03,
+    0xDC, 0xB6, 0xAA, 0x09, 0x3D, 0xA2, 0x29, 0x80, 0x0C, 0x40, 0x37, 0x01, 0x55, 0x8C, 0x7F, 0x7F,
+    0x83, 0x32, 0x0F, 0x0E, 0x46, 0x9C, 0x04, 0x44, 0x00, 0xFA, 0x05, 0x30, 0x23, 0xF0, 0x43, 0x00,
+    0xC0, 0x6D, 0x68, 0x79, 0x6D, 0x92, 0xE4, 0x22, 0x49, 0x2F, 0xF8, 0x40, 0x6E, 0x29, 0x38, 0xF1,
+    0x7E, 0x7A, 0x73, 0x99, 0xA9, 0xFF, 0xC9, 0x8D, 0xD2, 0x5D, 0x4F, 0xF6, 0xC9, 0x92, 0xF4, 0x6C,
+    0x53, 0xEF, 0x87, 0xAC, 0xA2, 0x64, 0x97, 0x40, 0x16, 0x18, 0x16, 0x68, 0x7B, 0x1D, 0xDD, 0x78,
+    0x34, 0x63, 0xBB, 0x63, 0x15, 0xE6, 0xD5, 0x08, 0x12, 0x09, 0x80, 0x5A, 0x50, 0x91, 0x70, 0xC5,
+    0xB5, 0x93, 0xC8, 0x30, 0xAE, 0x4B, 0xD0, 0x4E, 0x05, 0x68, 0x37, 0x78, 0x68, 0xA7, 0x67, 0x68,
+    0x67, 0x1D, 0x86, 0x99, 0x40, 0xFF, 0xA3, 0x02, 0xF4, 0x6F, 0x27, 0x40, 0xFD, 0x3C, 0x02, 0xEA,
+    0x9A, 0x07, 0x14, 0x17, 0xA0, 0xA3, 0x5B, 0xF5, 0xB3, 0xE4, 0x66, 0x3F, 0xC8, 0xB4, 0x01, 0x97,
+    0xDA, 0x03, 0x77, 0x55, 0x65, 0x31, 0x02, 0x3A, 0x03, 0xD0, 0xCB, 0xB6, 0x61, 0x1C, 0xAB, 0x64,
+    0xAA, 0xC6, 0x99, 0x07, 0x44, 0x59, 0x65, 0x87, 0x48, 0xD6, 0x6D, 0x8C, 0xB7, 0x08, 0x7E, 0x44,
+    0xA7, 0x52, 0x97, 0x1A, 0xC2, 0xB8, 0xDE, 0xCB, 0xD4, 0x66, 0x18, 0xA7, 0x5D, 0x97, 0x44, 0x02,
+    0x27, 0xE3, 0xFA, 0xD0, 0x65, 0x41, 0xD8, 0x8F, 0x38, 0x2B, 0x32, 0x82, 0x96, 0xE8, 0x3F, 0xE0,
+    0xD4, 0x96, 0xA6, 0x3E, 0xF0, 0xD3, 0x22, 0x4A, 0x55, 0xF5, 0xF2, 0xA8, 0x9A, 0x80, 0x32, 0x38,
+    0x34, 0x45, 0x3B, 0xE0, 0x87, 0xFD, 0x78, 0x0C, 0x9B, 0xFC, 0x2E, 0xC6, 0xE5, 0xC4, 0xE1, 0xB3,
+    0x80, 0x62, 0x5A, 0x7F, 0xED, 0x1C, 0x6C, 0x6C, 0x75, 0xC1, 0x71, 0xBD, 0xA1, 0xAA, 0x18, 0xC0,
+    0x01, 0xFA, 0x9A, 0x5B, 0x71, 0x10, 0x07, 0x57, 0x11, 0x87, 0x48, 0xFD, 0x5C, 0x61, 0x50, 0xEF,
+    0xFB, 0x05, 0x7A, 0xEE, 0x17, 0x98, 0x77, 0x2F, 0x2E, 0x20, 0xE9, 0x1B, 0x92, 0x5E, 0x90, 0xF4,
+    0x32, 0x41, 0x79, 0x15, 0xA1, 0x7C, 0xEF, 0xA1, 0x82, 0x5E, 0xA0, 0x82, 0x71, 0xE8, 0x22, 0x6E,
+    0x3F, 0xBC, 0x80, 0x81, 0x01, 0x9A, 0x1E, 0xBB, 0xEB, 0xD3, 0x7F, 0x23, 0xD2, 0x63, 0x07, 0xBB,
+    0x40, 0x3F, 0xDE, 0x0B, 0xF4, 0xEF, 0x26, 0x40, 0x31, 0x02, 0x82, 0x33, 0x8E, 0x36, 0xE4, 0x17,
+    0xD6, 0xC7, 0x5D, 0x9C, 0x84, 0xC6, 0x8B, 0xD0, 0xEF, 0x45, 0xF4, 0xF4, 0x90, 0x74, 0xBF, 0x59,
+    0x49, 0x59, 0x21, 0x64, 0x01, 0xC0, 0x08, 0x74, 0xF4, 0xB5, 0x1F, 0x6D, 0xB6, 0x80, 0xFA, 0x20,
+    0x01, 0xF6, 0x01, 0x5F, 0xBB, 0x31, 0xCC, 0x66, 0x6C, 0xD8, 0x14, 0xA8, 0x20, 0x23, 0xCC, 0xBB,
+    0x17, 0x17, 0x41, 0xD2, 0xF5, 0x24, 0x41, 0x32, 0xC9, 0x04, 0xE5, 0xF5, 0x02, 0xFD, 0x32, 0x01,
+    0x9E, 0x89, 0x10, 0xB9, 0xF6, 0xA1, 0x5A, 0xE1, 0xDD, 0xB2, 0xFE, 0xD3, 0x06, 0x00, 0xEA, 0x06,
+    0xAA, 0x07, 0xA2, 0xA2, 0x47, 0xFC, 0x86, 0x7A, 0x74, 0xA9, 0x8A, 0xA9, 0x6E, 0xAE, 0x06, 0xB1,
+    0xBA, 0x5E, 0xD1, 0x6F, 0x75, 0xA5, 0x6C, 0x24, 0x4C, 0xBB, 0xC1, 0x05, 0xE0, 0x46, 0xC0, 0xEC,
+    0x6E, 0x01, 0x1C, 0xCF, 0xA3, 0x23, 0x3D, 0x2A, 0xBC, 0x7B, 0x2F, 0x81, 0x1E, 0x17, 0x64, 0x59,
+    0x77, 0x42, 0xC3, 0x11, 0xE8, 0xD2, 0x66, 0x13, 0x6C, 0xAD, 0xD5, 0x3E, 0x00, 0x30, 0xF3, 0xE6,
+    0xA3, 0x52, 0x51, 0xF7, 0x6D, 0xE8, 0xCB, 0x7F, 0xEA, 0x2B, 0x08, 0xAD, 0x60, 0x96, 0xEF, 0x00,
+    0xCD, 0x3E, 0x00, 0xEC, 0xEE, 0x03, 0x9C, 0xA0, 0x22, 0x60, 0x47, 0xC8, 0xB0, 0x6D, 0x43, 0xC7,
+    0xA5, 0x21, 0x9D, 0x62, 0x01, 0x7F, 0xFA, 0x42, 0x97, 0x01, 0xBD, 0xA0, 0xE1, 0x08, 0x99, 0xAA,
+    0xE8, 0xB1, 0x13, 0xDA, 0x52, 0x5B, 0xD1, 0xE7, 0x07, 0xA1, 0x99, 0x60, 0xE8, 0xA1, 0x39, 0x56,
+    0x27, 0xC3, 0xCE, 0x59, 0x00, 0x26, 0x00, 0x92, 0x1E, 0x30, 0xCF, 0x2C, 0xE8, 0x82, 0x9A, 0xB1,
+    0xBB, 0x75, 0x41, 0x7C, 0x51, 0x7D, 0x6C, 0xCE, 0x02, 0x3A, 0x41, 0x30, 0x42, 0xBF, 0xE2, 0x45,
+    0xEC, 0xFC, 0xCE, 0x58, 0x25, 0xF9, 0xAF, 0xDD, 0x47, 0x00, 0x40, 0x3F, 0x03, 0xA0, 0x5B, 0xDB,
+    0xD2, 0xF9, 0x63, 0xF2, 0xF0, 0x8B, 0x9B, 0x47, 0x00, 0x83, 0x83, 0xAC, 0x5E, 0x4D, 0x11, 0x8F,
+    0xDC, 0x14, 0xB1, 0x21, 0x9D, 0x66, 0x54, 0xE5, 0xC1, 0xFB, 0x38, 0x42, 0x2F, 0x9B, 0x93, 0x3E,
+    0xE1, 0xFA, 0xE4, 0xB7, 0x9C, 0x66, 0x6A, 0x48, 0x27, 0x18, 0xD0, 0x8C, 0x40, 0xB3, 0x8F, 0x7D,
+    0x74, 0x7E, 0x70, 0x50, 0x6F, 0x27, 0xA0, 0xA7, 0x03, 0x74, 0xDA, 0xA8, 0xC7, 0x2F, 0xB2, 0x77,
+    0xFB, 0x38, 0x8B, 0x2C, 0x22, 0x4C, 0xBF, 0x40, 0x73, 0x42, 0x5F, 0xD6, 0xE5, 0x55, 0x41, 0x64,
+    0x6D, 0x34, 0x27, 0x55, 0x1E, 0x1C, 0x87, 0x50, 0x9F, 0x66, 0xE6, 0x8A, 0xE3, 0xAD, 0xAB, 0xDA,
+    0xCB, 0x4E, 0xF5, 0x7F, 0xF3, 0xD1, 0x3F, 0x86, 0x66, 0x42, 0xCF, 0x04, 0xC1, 0xB0, 0x0A, 0xB1,
+    0xB3, 0x38, 0x0B, 0x94, 0x36, 0x01, 0xFA, 0x8C, 0x5F, 0xC5, 0xA8, 0x22, 0x8E, 0x9E, 0x52, 0x6D,
+    0x37, 0xCD, 0x02, 0x18, 0xD2, 0xC1, 0x92, 0x0B, 0x38, 0x19, 0x0F, 0x8E, 0x7D, 0x04, 0xA1, 0x62,
+    0x43, 0x74, 0xA9, 0x25, 0xBA, 0x24, 0x0A, 0xBA, 0x24, 0x32, 0x54, 0x14, 0x09, 0x2A, 0xCA, 0x84,
+    0x3E, 0x74, 0x09, 0x83, 0x57, 0x11, 0x66, 0x51, 0x01, 0x74, 0xBD, 0x97, 0x9C, 0xFA, 0x1B, 0xD5,
+    0x16, 0x89, 0xD0, 0xE4, 0x7C, 0x8B, 0x01, 0x07, 0x98, 0x2B, 0x09, 0x80, 0x79, 0x25, 0x00, 0xB0,
+    0xCF, 0x2C, 0x00, 0x78, 0xC6, 0x01, 0xE0, 0xED, 0x58, 0xF5, 0xBF, 0x7E, 0xBF, 0x00, 0x0D, 0x4B,
+    0x01, 0x24, 0x99, 0x01, 0x55, 0xCE, 0x25, 0xA0, 0x0F, 0x2A, 0x01, 0xDA, 0x77, 0x11, 0xD0, 0x73,
+    0x17, 0x00, 0xE3, 0x54, 0x00, 0xAC, 0x53, 0x1E, 0xB0, 0x53, 0xEF, 0x01, 0x3B, 0x0D, 0x0B, 0x60,
+    0x9D, 0x99, 0x01, 0xFB, 0x56, 0x55, 0xAB, 0x74, 0xC0, 0xC0, 0x6B, 0x0E, 0xE8, 0x8A, 0x9E, 0x80,
+    0x15, 0xC1, 0x7E, 0x71, 0x46, 0x6B, 0x43, 0xD4, 0xE5, 0xA2, 0x59, 0xB6, 0x8F, 0x9C, 0x81, 0xDE,
+    0xA3, 0xD9, 0x37, 0x13, 0xEC, 0x07, 0x05, 0x1D, 0x19, 0x60, 0x49, 0x27, 0xF8, 0x4D, 0xD6, 0x11,
+    0xE5, 0x38, 0xCC, 0x32, 0xC1, 0x62, 0xF0, 0x22, 0xC1, 0x4E, 0xCA, 0xB7, 0x05, 0x76, 0xEA, 0x92,
+    0xC8, 0x18, 0xA2, 0x59, 0x57, 0x94, 0x2D, 0x16, 0xB0, 0x3F, 0x89, 0xEB, 0x84, 0x37, 0x87, 0x87,
+    0x40, 0x5D, 0x69, 0x7E, 0x0B, 0x19, 0x14, 0xB9, 0x08, 0x32, 0x36, 0x64, 0x86, 0x25, 0xA1, 0x97,
+    0x8A, 0x3E, 0x44, 0x5A, 0x5B, 0x67, 0xDF, 0xFD, 0x9B, 0x8D, 0x51, 0xE6, 0x04, 0xE9, 0xEB, 0x87,
+    0x13, 0xB6, 0x67, 0xCA, 0x04, 0x34, 0x3C, 0x7C, 0xB6, 0x5E, 0x5E, 0x7B, 0xB9, 0x00, 0x77, 0x1E,
+    0x5E, 0x40, 0xBD, 0x64, 0xFB, 0x30, 0x93, 0xA1, 0x58, 0x40, 0x26, 0x95, 0x55, 0x30, 0x6E, 0xB8,
+    0x5A, 0xC0, 0x33, 0xE1, 0x5C, 0x32, 0xE4, 0x65, 0x32, 0x76, 0xE5, 0x07, 0xA8, 0x93, 0x84, 0x86,
+    0xD3, 0xD7, 0x45, 0xD5, 0xD1, 0xAE, 0x5D, 0x1D, 0xE3, 0x68, 0xC6, 0x66, 0xC4, 0xBD, 0x48, 0x10,
+    0xC5, 0x8E, 0x18, 0xE8, 0x57, 0x4B, 0x6A, 0x7F, 0x03, 0x0C, 0xEA, 0xB2, 0x9A, 0xE4, 0x3A, 0x62,
+    0xAB, 0x29, 0x7A, 0x0B, 0x80, 0xBC, 0x71, 0x38, 0x8A, 0xD5, 0xCE, 0x84, 0x20, 0x3D, 0x8C, 0x5B,
+    0x03, 0x18, 0x9C, 0x6A, 0x7F, 0x1A, 0x02, 0xE8, 0x6F, 0x1C, 0x4E, 0xED, 0x6A, 0x8B, 0x4F, 0x82,
+    0x8C, 0xC0, 0x49, 0x9C, 0x6D, 0x82, 0x58, 0xC4, 0x0D, 0x3B, 0x2A, 0x46, 0x74, 0x9C, 0x36, 0x46,
+    0x88, 0xE4, 0x0C, 0x72, 0x51, 0xA4, 0xE3, 0xCC, 0x6F, 0xA6, 0x36, 0xEB, 0x45, 0x05, 0xFE, 0x03,
+    0xBE, 0x42, 0xA6, 0x81, 0x9C, 0xEC, 0xBB, 0xE3, 0x56, 0xA6, 0xC6, 0xD6, 0x69, 0x12, 0x9A, 0x09,
+    0x03, 0xCF, 0x6F, 0xED, 0x18, 0x88, 0xB8, 0xAA, 0x47, 0xEB, 0x56, 0xF9, 0xBA, 0x01, 0xC0, 0x2C,
+    0xD0, 0xE4, 0xD4, 0x93, 0x73, 0x47, 0x7A, 0xB1, 0xB5, 0x75, 0x5D, 0xD5, 0xA5, 0x5D, 0x39, 0x3C,
+    0x2F, 0xAA, 0x3F, 0x37, 0x41, 0x57, 0xE7, 0x15, 0xBA, 0xB8, 0x8A, 0x19, 0x8E, 0x55, 0x2A, 0xF4,
+    0x37, 0x0E, 0xA7, 0xAE, 0x8E, 0x68, 0x04, 0x59, 0xB6, 0x36, 0x7E, 0x95, 0xFA, 0x0E, 0xD8, 0x6A,
+    0xEA, 0x5F, 0xBB, 0x43, 0x9B, 0x55, 0x20, 0xC9, 0xD0, 0x92, 0x09, 0x9C, 0x56, 0x73, 0xDF, 0x6F,
+    0xCC, 0xFD, 0xC3, 0x1F, 0x80, 0xCC, 0xD0, 0x24, 0x14, 0xE9, 0x8E, 0x8C, 0xF8, 0xF5, 0xCC, 0xDE,
+    0x03, 0xB2, 0x1C, 0x5E, 0xA8, 0x97, 0xAF, 0x43, 0x50, 0xFD, 0xEC, 0x9B, 0x9F, 0xDE, 0x01, 0xF2,
+    0xC6, 0xAA, 0x88, 0xFA, 0xE3, 0x3A, 0xE8, 0xDF, 0x78, 0xA1, 0xE5, 0x7A, 0xD7, 0x74, 0xE4, 0xD4,
+    0x2F, 0x13, 0x04, 0x47, 0xB4, 0x09, 0x68, 0xC6, 0x66, 0x1F, 0xCA, 0x99, 0x11, 0xC3, 0xAB, 0x61,
+    0x45, 0xE5, 0x26, 0x00, 0x38, 0x58, 0xE7, 0x50, 0x91, 0x0B, 0x34, 0x39, 0x35, 0x64, 0xAE, 0x5A,
+    0xE2, 0x48, 0x0B, 0xA4, 0x0D, 0xF2, 0xB1, 0xEF, 0xFE, 0x4D, 0xF5, 0x18, 0x6D, 0xFC, 0x51, 0xAB,
+    0x14, 0x88, 0xC7, 0x95, 0x86, 0x4C, 0xEB, 0x22, 0x84, 0xAD, 0x0B, 0x35, 0xD6, 0xBB, 0xE3, 0x24,
+    0x76, 0xA1, 0x9C, 0x99, 0xDA, 0x64, 0x47, 0x68, 0x8E, 0x90, 0x9C, 0x8E, 0x5A, 0x60, 0x32, 0x40,
+    0x2E, 0x20, 0x13, 0x38, 0x73, 0x34, 0x6E, 0x98, 0xF5, 0xA2, 0x82, 0x0A, 0xE7, 0x92, 0x24, 0x53,
+    0x4B, 0x46, 0xD8, 0x77, 0x47, 0x0C, 0x4B, 0x9D, 0xBD, 0x86, 0xD3, 0xD7, 0x37, 0x7B, 0xC1, 0x61,
+    0xE0, 0xF9, 0x8D, 0xB0, 0x38, 0x00, 0x30, 0x24, 0xA0, 0x65, 0x04, 0x86, 0x37, 0x02, 0x44, 0x92,
+    0x1E, 0x1B, 0x14, 0x51, 0x35, 0x55, 0xB5, 0xBB, 0x48, 0xA7, 0xF8, 0x6E, 0x81, 0x0D, 0xF8, 0x9A,
+    0xE4, 0x56, 0x0F, 0x4E, 0x5B, 0x3D, 0x78, 0xFB, 0xE1, 0x05, 0x4E, 0x86, 0x4F, 0xE5, 0x96, 0xB9,
+    0x0F, 0x1D, 0xBD, 0x99, 0x61, 0x1C, 0xC7, 0xB6, 0x88, 0x02, 0x15, 0x54, 0x86, 0x76, 0x7D, 0x79,
+    0x90, 0x18, 0x56, 0x71, 0xBB, 0xA0, 0xE7, 0xF5, 0xCD, 0xBE, 0xDE, 0x1D, 0xAB, 0x0A, 0xD6, 0x9C,
+    0xA0, 0x5F, 0xF1, 0xD0, 0x93, 0x3D, 0x6A, 0x86, 0xF1, 0x2F, 0xC1, 0x50, 0x4F, 0x86, 0x9C, 0xF5,
+    0x75, 0xEB, 0xFB, 0xA0, 0x92, 0x4A, 0x6D, 0x11, 0x19, 0xF6, 0x09, 0x42, 0xCF, 0xD6, 0x29, 0x3F,
+    0x78, 0x99, 0xBA, 0x24, 0x4A, 0xCB, 0x96, 0xA3, 0xFD, 0x19, 0x5D, 0x4F, 0x7A, 0xC1, 0x9B, 0x09,
+    0xC3, 0x07, 0xC7, 0xF7, 0x92, 0xF6, 0xF2, 0xA7, 0x36, 0x34, 0x64, 0x84, 0x61, 0xC4, 0x09, 0x2E,
+    0x55, 0x4F, 0xEE, 0x43, 0xF8, 0xCE, 0xA1, 0xBB, 0x41, 0xA0, 0xA7, 0x07, 0x7A, 0x6E, 0x3C, 0x4C,
+    0x5F, 0xE4, 0x48, 0xEC, 0x60, 0x07, 0x62, 0x51, 0x0E, 0xBC, 0xB8, 0xA0, 0xA7, 0x47, 0xCB, 0xE5,
+    0xC8, 0x3E, 0xFF, 0x02, 0x46, 0xA2, 0x62, 0x64, 0xBF, 0x5A, 0xDF, 0x0D, 0x47, 0x1C, 0x43, 0x5D,
+    0x5F, 0xE8, 0x9A, 0x58, 0xA3, 0xBF, 0x90, 0x79, 0x83, 0x0B, 0x8E, 0x59, 0xE4, 0x5F, 0xD0, 0x48,
+    0x34, 0x2C, 0x23, 0x6C, 0x15, 0x74, 0x09, 0x2C, 0x17, 0x97, 0x8E, 0x63, 0x3B, 0x1A, 0x0F, 0x08,
+    0x02, 0xE8, 0xE3, 0x2A, 0xCB, 0x45, 0xC1, 0xE1, 0xA1, 0x8A, 0x92, 0x51, 0xCF, 0x03, 0x5F, 0xE7,
+    0x68, 0x29, 0x33, 0x64, 0x52, 0x01, 0xC3, 0xA2, 0x17, 0x70, 0xE4, 0x2C, 0x52, 0xC3, 0x9F, 0x5A,
+    0xDF, 0x92, 0x74, 0x2D, 0x59, 0xD0, 0x90, 0xE7, 0x8F, 0x22, 0x97, 0xE8, 0xC2, 0xEA, 0x9A, 0x68,
+    0x12, 0x00, 0x35, 0x6F, 0xED, 0xA6, 0x66, 0x1F, 0x68, 0xE3, 0xFA, 0x79, 0x01, 0x60, 0xC7, 0x23,
+    0xB0, 0xAA, 0x7F, 0xFB, 0x23, 0xD1, 0x1C, 0x00, 0x68, 0xB8, 0x00, 0x0D, 0x13, 0xD0, 0x14, 0x3D,
+    0xA1, 0xC9, 0x22, 0x00, 0x67, 0xB7, 0x16, 0x3B, 0xC7, 0x36, 0x43, 0xCF, 0xE0, 0xD8, 0xFB, 0xEA,
+    0x29, 0x19, 0xBC, 0x28, 0xE8, 0x22, 0x38, 0x8A, 0x7A, 0x04, 0xF5, 0x48, 0x39, 0xB4, 0x5E, 0x70,
+    0x5D, 0x41, 0x79, 0x1B, 0x89, 0xA9, 0xD7, 0x2C, 0xA2, 0x40, 0xAD, 0xD7, 0x18, 0xD7, 0x6C, 0x8E,
+    0x44, 0x0C, 0x8B, 0xC8, 0xD5, 0x9F, 0x2B, 0x72, 0x85, 0xAF, 0x8A, 0x40, 0xC7, 0x05, 0xDD, 0x47,
+    0x19, 0xCA, 0xF7, 0xAE, 0xD9, 0xDF, 0x58, 0x0C, 0xB7, 0xE8, 0xCD, 0xE3, 0x2A, 0x52, 0xBF, 0x9A,
+    0xD1, 0x5F, 0xE3, 0xDC, 0x91, 0x49, 0xF0, 0x0D, 0x82, 0xCE, 0x38, 0xB3, 0x28, 0xDF, 0x7B, 0x99,
+    0xBA, 0xD8, 0x16, 0x91, 0xC1, 0x91, 0xD0, 0xB3, 0xD9, 0x0C, 0xDA, 0xB1, 0x0F, 0x9D, 0x71, 0xBD,
+    0x47, 0xED, 0x64, 0x6D, 0x87, 0x4C, 0xE8, 0xBD, 0x20, 0xC9, 0xDC, 0x93, 0xA4, 0x37, 0x24, 0xE9,
+    0x94, 0x87, 0x9E, 0x6B, 0xF3, 0x5B, 0x1E, 0x5E, 0x4C, 0x50, 0x5C, 0x95, 0x06, 0x47, 0x90, 0x4C,
+    0xF5, 0x42, 0x0C, 0x1E, 0xD6, 0x81, 0x93, 0x28, 0xA8, 0x9D, 0xEB, 0x3D, 0x8C, 0x83, 0x75, 0x2D,
+    0xD1, 0x16, 0x74, 0x11, 0x2A, 0x40, 0x2F, 0xEB, 0x13, 0xEB, 0x6C, 0xCF, 0x80, 0x76, 0xE8, 0x48,
+    0xA7, 0xD6, 0x1F, 0x70, 0x04, 0xD8, 0x8C, 0x0D, 0x87, 0xD0, 0x16, 0x66, 0x41, 0x16, 0xC1, 0xAB,
+    0x14, 0x6C, 0x28, 0x73, 0xC3, 0x2E, 0xB5, 0x45, 0x45, 0x91, 0x95, 0x17, 0xB9, 0xF7, 0x22, 0x0D,
+    0x5E, 0xA6, 0x61, 0xE9, 0xA2, 0x9E, 0x55, 0xD0, 0x4E, 0xF9, 0xDA, 0xAB, 0xCF, 0xF4, 0x82, 0xAE,
+    0x7B, 0x8D, 0x0B, 0x2C, 0x17, 0x90, 0x0E, 0x7D, 0xAE, 0xF8, 0x49, 0xF9, 0x3A, 0xBC, 0x83, 0xAF,
+    0xFA, 0x6C, 0x6D, 0x57, 0x35, 0x4D, 0xA6, 0xAA, 0xE1, 0x39, 0xA2, 0x61, 0xDD, 0xBB, 0x92, 0x80,
+    0x5E, 0x6F, 0x63, 0x59, 0x71, 0x4F, 0x69, 0x3D, 0x6F, 0x04, 0xCB, 0x74, 0x6F, 0x97, 0x76, 0xEA,
+    0x3A, 0x12, 0x35, 0x92, 0x68, 0xDD, 0xEA, 0xBC, 0x97, 0xEB, 0xFB, 0x09, 0x7A, 0x5E, 0xDF, 0xB7,
+    0x47, 0xEF, 0x7D, 0x55, 0xA0, 0x77, 0x1E, 0x5E, 0x80, 0xDD, 0x60, 0xD0, 0xB3, 0x75, 0xD7, 0x72,
+    0xEA, 0x58, 0x99, 0x18, 0x7D, 0xAE, 0x8D, 0x23, 0xB6, 0xC6, 0x2F, 0x27, 0x88, 0x5C, 0xBB, 0x60,
+    0x1C, 0xDA, 0x52, 0x5D, 0x80, 0x7A, 0xAE, 0x2D, 0x4D, 0x80, 0xF1, 0x50, 0x8C, 0xB0, 0x5C, 0x5A,
+    0x72, 0xC4, 0x89, 0xC3, 0x67, 0x15, 0x93, 0x62, 0x5A, 0x21, 0x2E, 0xD1, 0x10, 0x35, 0x2C, 0x50,
+    0xD7, 0x80, 0x4C, 0xEB, 0x5C, 0xD5, 0x29, 0x1C, 0x3C, 0x86, 0x05, 0x7A, 0x86, 0x76, 0x30, 0x0E,
+    0x38, 0x89, 0x93, 0xB8, 0x17, 0x09, 0xFA, 0xBD, 0x80, 0x81, 0xBE, 0xBA, 0xB5, 0xF6, 0x7F, 0x6B,
+    0x63, 0xBB, 0x83, 0x1D, 0xB1, 0x28, 0xC7, 0x8B, 0xCB, 0x40, 0xDF, 0x72, 0x59, 0x05, 0xCC, 0xBF,
+    0xD1, 0xD8, 0x1A, 0x2E, 0x1D, 0x0B, 0x48, 0xD7, 0x70, 0x86, 0x0A, 0x00, 0x81, 0xDE, 0xA3, 0x25,
+    0xA0, 0x17, 0x88, 0x0C, 0x68, 0x07, 0x59, 0x2D, 0x6E, 0x15, 0x01, 0x8E, 0xE8, 0x3D, 0x1A, 0x02,
+    0xC6, 0x43, 0xD7, 0xAB, 0x2D, 0x67, 0x74, 0x33, 0x84, 0x07, 0x2E, 0x55, 0xCC, 0xC5, 0xF3, 0x50,
+    0xF9, 0x28, 0x8E, 0x03, 0xA0, 0x4D, 0x90, 0x19, 0x32, 0x1D, 0x29, 0x1B, 0xE5, 0xD7, 0xB1, 0xAC,
+    0x1B, 0xC0, 0x38, 0x18, 0x07, 0x3B, 0xD5, 0xBD, 0x57, 0x27, 0xA0, 0x2D, 0x10, 0x19, 0x22, 0x41,
+    0x26, 0xB4, 0x01, 0x6A, 0xC6, 0x30, 0x42, 0x03, 0xFA, 0x1D, 0x0C, 0xB1, 0x8A, 0xD3, 0xAD, 0x3E,
+    0x6B, 0x6A, 0xCB, 0x50, 0x8E, 0xE0, 0x6F, 0x81, 0xE5, 0xA2, 0x98, 0xD0, 0x67, 0x80, 0x23, 0x54,
+    0x6D, 0xF8, 0xE0, 0x21, 0x0A, 0xA0, 0x67, 0x88, 0x54, 0x1D, 0x0A, 0xB1, 0xBA, 0x92, 0x02, 0x9A,
+    0xDA, 0x7B, 0x49, 0x88, 0x7A, 0x75, 0xC7, 0x0C, 0x10, 0xC6, 0x0D, 0x5E, 0x45, 0x91, 0x1B, 0xC2,
+    0xB8, 0x61, 0x51, 0x41, 0xE4, 0x86, 0xB0, 0xF5, 0xDF, 0xD4, 0x10, 0x30, 0x5C, 0x7A, 0xDF, 0x92,
+    0x93, 0x75, 0x8A, 0x49, 0x14, 0x48, 0x8E, 0x75, 0xC1, 0x68, 0x07, 0xED, 0x1A, 0xA2, 0x21, 0xBA,
+    0x88, 0x2E, 0x41, 0x2F, 0xD0, 0x4B, 0xED, 0xA6, 0x4C, 0x10, 0x09, 0x83, 0x47, 0xEF, 0x61, 0x27,
+    0xD8, 0x49, 0x64, 0x88, 0x02, 0xE5, 0xA1, 0x42, 0x1D, 0x91, 0x96, 0x68, 0x08, 0x15, 0xD1, 0x27,
+    0xE8, 0x59, 0xB0, 0x34, 0xC4, 0xC0, 0x28, 0x13, 0x2C, 0xE7, 0xEA, 0xFA, 0xE3, 0xB8, 0x9A, 0x9F,
+    0xF8, 0x2E, 0x3D, 0xD0, 0x90, 0x00, 0x24, 0x03, 0x2A, 0x89, 0xE9, 0xF8, 0xCB, 0x42, 0x3B, 0x99,
+    0x5B, 0xA2, 0xF7, 0x5D, 0x82, 0x9E, 0xD4, 0x31, 0x0B, 0x45, 0xBB, 0xDE, 0x37, 0xAC, 0x06, 0x68,
+    0x81, 0x5E, 0x54, 0x00, 0x47, 0xE3, 0x64, 0x6A, 0x88, 0xDE, 0x77, 0x11, 0x76, 0xD2, 0xB3, 0xC8,
+    0x20, 0x54, 0x90, 0x69, 0xCB, 0x44, 0x99, 0xBA, 0x28, 0x32, 0xF4, 0xAC, 0x3C, 0x08, 0xE3, 0x64,
+    0x6A, 0x89, 0xD5, 0xE7, 0xAE, 0xE7, 0x6A, 0x0C, 0xB5, 0x17, 0xE3, 0x4A, 0xDF, 0xD2, 0x19, 0x00,
+    0xCF, 0x1F, 0x61, 0xD3, 0xBC, 0xC6, 0xF9, 0x87, 0xAB, 0x11, 0x6D, 0x12, 0x1E, 0x3B, 0xE3, 0x06,
+    0x92, 0x35, 0xE5, 0xF8, 0x7D, 0xC0, 0x8D, 0x57, 0x7D, 0xF0, 0xAB, 0x81, 0x51, 0x5D, 0x32, 0xB7,
+    0xD2, 0x5C, 0xE2, 0x16, 0xD7, 0xE0, 0x53, 0x1E, 0x9C, 0x23, 0xEC, 0xBE, 0x71, 0x79, 0xA9, 0x50,
+    0xED, 0x8E, 0x13, 0x17, 0x0B, 0x56, 0x4B, 0x94, 0xA8, 0x88, 0xEC, 0xB8, 0xBF, 0x93, 0x1E, 0x82,
+    0x01, 0xEA, 0x83, 0x04, 0x3D, 0xBD, 0x84, 0x93, 0x1B, 0x4F, 0xE3, 0xBA, 0x3F, 0x5B, 0xD6, 0xDB,
+    0x89, 0x5C, 0x1F, 0x22, 0x37, 0xBC, 0xB0, 0x58, 0x9F, 0xD0, 0x6F, 0xB6, 0xFB, 0x66, 0xAB, 0x1F,
+    0xF3, 0xF0, 0x70, 0x42, 0xC3, 0x11, 0xCF, 0x11, 0xB0, 0xA5, 0x1A, 0xC2, 0x76, 0x06, 0xA0, 0xE7,
+    0x96, 0x50, 0xBE, 0xE5, 0x28, 0x53, 0xC3, 0xA9, 0x65, 0xC3, 0x09, 0x9C, 0xE8, 0xA0, 0x67, 0x3A,
+    0x28, 0x4F, 0x07, 0x99, 0xEC, 0x8C, 0xB6, 0x98, 0x05, 0xA0, 0x5D, 0x00, 0xCD, 0x00, 0x28, 0x56,
+    0xAF, 0x8A, 0x43, 0x4B, 0x15, 0x00, 0xDE, 0x4F, 0x40, 0xCF, 0xD6, 0xA1, 0xF7, 0x2A, 0x42, 0x26,
+    0x41, 0xB4, 0x05, 0x66, 0x06, 0x47, 0x15, 0xA1, 0x5D, 0xCB, 0x5B, 0x56, 0x88, 0x71, 0xD5, 0x21,
+    0xB7, 0xE2, 0x93, 0x6E, 0xC1, 0x31, 0x47, 0xDD, 0xE7, 0x05, 0x57, 0xAA, 0x71, 0x2E, 0x4B, 0xC3,
+    0x86, 0xD3, 0xB0, 0x98, 0x45, 0x64, 0x15, 0xA1, 0xAF, 0x14, 0xC8, 0xC4, 0x09, 0x86, 0x0B, 0x3A,
+    0x26, 0x80, 0x9C, 0xA1, 0x48, 0x34, 0xFC, 0x7E, 0xC0, 0xE0, 0xE9, 0xDA, 0x22, 0x33, 0xF4, 0xAC,
+    0xBD, 0x48, 0x0D, 0x47, 0xE3, 0xD4, 0x31, 0x24, 0x2A, 0x12, 0x6A, 0xAC, 0x4C, 0x2D, 0x2B, 0x32,
+    0xDA, 0xAD, 0x83, 0x6E, 0x96, 0xDE, 0xF7, 0xB1, 0x2D, 0xA2, 0x40, 0xCF, 0x9C, 0x44, 0xD2, 0x0B,
+    0xF4, 0x6B, 0x11, 0xF2, 0x66, 0x01, 0x2C, 0x1D, 0x14, 0x33, 0x40, 0x7A, 0xF4, 0xD7, 0x39, 0xB6,
+    0x54, 0x09, 0xC3, 0x62, 0x66, 0x91, 0x05, 0xA1, 0x5D, 0x1F, 0x64, 0xB5, 0x64, 0x3F, 0xD7, 0x81,
+    0xAC, 0x02, 0xA0, 0x1D, 0x1A, 0xAE, 0x4E, 0x9D, 0x05, 0xE0, 0x08, 0x91, 0xEA, 0x2C, 0xDA, 0x09,
+    0xA2, 0xDC, 0x7A, 0x52, 0x5C, 0x35, 0x50, 0x75, 0xBF, 0xF6, 0x37, 0x0E, 0x27, 0x4B, 0x0A, 0x32,
+    0x2A, 0x72, 0x06, 0x76, 0x47, 0xA8, 0x88, 0xB6, 0x00, 0x66, 0x82, 0x9A, 0x37, 0xAA, 0xE1, 0xB8,
+    0x6C, 0x75, 0x1B, 0xD9, 0xBA, 0x11, 0x51, 0xCB, 0x46, 0x44, 0xC9, 0x63, 0x22, 0x6A, 0xDC, 0x88,
+    0xA8, 0x4F, 0x49, 0xB0, 0x5B, 0xA4, 0x59, 0xDA, 0x48, 0xB3, 0x8D, 0x2C, 0x2F, 0x9F, 0x25, 0xCB,
+    0xC3, 0x91, 0x2C, 0x3F, 0x7C, 0x76, 0x20, 0xAF, 0x90, 0x51, 0x73, 0x1B, 0xCD, 0xEE, 0xD6, 0xCB,
+    0x1D, 0xC4, 0xD1, 0xC8, 0x6C, 0x85, 0x71, 0x97, 0xA0, 0xAA, 0x42, 0xAC, 0x42, 0x7C, 0xF9, 0x25,
+    0x42, 0x5C, 0x1C, 0x13, 0xE2, 0xDB, 0x7B, 0x2B, 0x8F, 0xDE, 0x41, 0x8F, 0xD8, 0x05, 0xA0, 0x67,
+    0x33, 0x2A, 0xAF, 0x9D, 0x4C, 0x6A, 0x6E, 0xD9, 0x2D, 0xE0, 0x53, 0xCB, 0xAD, 0x8E, 0x86, 0xE3,
+    0x3E, 0x85, 0x5B, 0x3F, 0x1C, 0x3F, 0xDF, 0xD1, 0xB0, 0x41, 0x54, 0x3F, 0xCA, 0xD0, 0x57, 0x22,
+    0xCC, 0xAB, 0x1E, 0xF6, 0x35, 0x07, 0xFE, 0xB3, 0xB1, 0x22, 0xAA, 0x75, 0xF7, 0x96, 0xA3, 0xDD,
+    0x2B, 0x8F, 0xEF, 0xDE, 0x70, 0xB4, 0x7B, 0x3F, 0x4B, 0x51, 0xFF, 0x7F, 0x81, 0x0E, 0x19, 0x54,
+    0xD4, 0x8B, 0x9E, 0x39, 0xB1, 0x4D, 0x32, 0xD5, 0xED, 0xCF, 0x11, 0x22, 0xD7, 0x7B, 0x9A, 0x77,
+    0x0F, 0x57, 0x2A, 0xDE, 0xB2, 0x69, 0xEB, 0xAF, 0xB2, 0x22, 0x5E, 0xCF, 0x32, 0xE9, 0xC5, 0x5C,
+    0x29, 0x5D, 0x1C, 0xDC, 0x2F, 0x5D, 0x11, 0xDD, 0xAD, 0xCB, 0x78, 0xF3, 0xF8, 0x34, 0xA2, 0xE7,
+    0x04, 0x4B, 0x08, 0x46, 0x0C, 0x44, 0xC7, 0x19, 0x03, 0x01, 0x1D, 0xAB, 0xF3, 0xF9, 0xF3, 0x96,
+    0x31, 0xAA, 0x7A, 0x52, 0xA1, 0xAA, 0xB3, 0x2E, 0x56, 0xCC, 0x2F, 0x0A, 0xFA, 0x02, 0x9B, 0x24,
+    0xDF, 0x62, 0xEC, 0xE8, 0x54, 0xC1, 0xB0, 0x1E, 0x92, 0x09, 0xC3, 0xB2, 0x02, 0xFA, 0x8D, 0xC4,
+    0xAF, 0x3E, 0xF4, 0xAA, 0xB3, 0x94, 0xAF, 0x3A, 0xE9, 0x16, 0x11, 0xA3, 0x32, 0xDA, 0x04, 0x1D,
+    0xA1, 0x7C, 0x43, 0x0F, 0xED, 0x3A, 0xCE, 0x4D, 0x81, 0xE6, 0xD4, 0x05, 0x90, 0xD0, 0x4E, 0xDC,
+    0xCC, 0x20, 0xFA, 0x1F, 0x47, 0x19, 0x61, 0xCF, 0xF8, 0x61, 0x11, 0x49, 0x3B, 0x3B, 0x2A, 0x6F,
+    0x9F, 0x4A, 0x30, 0x13, 0x95, 0x6F, 0x8A, 0x48, 0x66, 0xEA, 0x42, 0x77, 0x3D, 0x43, 0xBB, 0xFE,
+    0xA6, 0x07, 0xA1, 0xE9, 0x64, 0x84, 0x25, 0x86, 0xB9, 0x61, 0x84, 0x85, 0xE0, 0x2C, 0x12, 0x3A,
+    0x42, 0xF9, 0x1A, 0x48, 0xC3, 0xC1, 0xAA, 0x1B, 0x8C, 0x5B, 0x8D, 0xA5, 0x69, 0x6B, 0x99, 0x0B,
+    0x6F, 0xE7, 0x26, 0xD9, 0x0C, 0x6B, 0xE9, 0x74, 0x36, 0x5E, 0x25, 0x99, 0x44, 0x01, 0x1B, 0xC2,
+    0x38, 0x3B, 0x0D, 0x8B, 0x9E, 0x55, 0x50, 0x5E, 0x64, 0x99, 0xC0, 0xF6, 0x13, 0x1F, 0x26, 0x99,
+    0x1A, 0x02, 0x3A, 0xA0, 0xF3, 0xE0, 0x02, 0xED, 0x24, 0x1D, 0x88, 0x81, 0xA3, 0x8C, 0x60, 0xC1,
+    0x30, 0x0B, 0x26, 0x10, 0xEA, 0x5A, 0x10, 0x09, 0xE6, 0xDC, 0xD2, 0x2F, 0x6D, 0xD6, 0xCE, 0x4E,
+    0xCA, 0xB3, 0xCD, 0xD0, 0x97, 0x4B, 0xED, 0x94, 0x76, 0x32, 0xAA, 0xF7, 0x0B, 0x86, 0x79, 0xF8,
+    0x79, 0x00, 0x61, 0xAE, 0x39, 0x91, 0x40, 0xA2, 0x5F, 0x5A, 0x26, 0xD8, 0x51, 0x72, 0x69, 0x13,
+    0x14, 0x47, 0xE5, 0x31, 0x24, 0x68, 0x07, 0xE3, 0x6F, 0x85, 0x00, 0x04, 0x2A, 0x51, 0xA1, 0xF6,
+    0xAF, 0x4A, 0xD6, 0x23, 0x3F, 0x08, 0x74, 0x97, 0xD1, 0xBF, 0xCA, 0xB9, 0xBB, 0x79, 0xCC, 0x84,
+    0xD2, 0xFF, 0x3F, 0x4D, 0xA8, 0xE3, 0x0F, 0x33, 0x63, 0x7D, 0x52, 0xEF, 0x36, 0xA3, 0xB9, 0x83,
+    0x9D, 0x11, 0x30, 0x4D, 0x06, 0x60, 0x87, 0x19, 0x00, 0x33, 0x80, 0x96, 0xF3, 0x76, 0x95, 0xFC,
+    0x4E, 0x57, 0xC2, 0xCE, 0xD8, 0x8C, 0xB0, 0x6D, 0x82, 0x88, 0x5C, 0xC3, 0x47, 0xF4, 0x35, 0x1C,
+    0x07, 0x00, 0xEA, 0x32, 0xC7, 0x26, 0xD9, 0x8C, 0xE1, 0x1A, 0xBD, 0xE0, 0x1B, 0x84, 0xF6, 0xBD,
+    0x17, 0x05, 0x95, 0xB3, 0xD0, 0xC5, 0xB6, 0x80, 0xA3, 0x9E, 0x95, 0x17, 0xB9, 0x21, 0xB4, 0x1B,
+    0xBC, 0x4C, 0x6D, 0x81, 0x9D, 0xF4, 0xAC, 0x82, 0x48, 0xEB, 0x79, 0x55, 0x80, 0x89, 0x04, 0x40,
+    0xC6, 0x8D, 0x4F, 0x46, 0x2D, 0x00, 0x86, 0x2B, 0xDE, 0xCE, 0xFA, 0x9B, 0x1F, 0x32, 0xEC, 0x76,
+    0x37, 0x99, 0xA0, 0xF8, 0x50, 0x82, 0x4A, 0x32, 0xA1, 0x8F, 0x32, 0x55, 0x5A, 0xF0, 0xB0, 0x74,
+    0x11, 0x7A, 0x56, 0x01, 0xDA, 0x29, 0x5F, 0x6F, 0x68, 0xA7, 0xDE, 0x83, 0xD3, 0xB0, 0x80, 0xA3,
+    0x9E, 0xC1, 0xBA, 0x51, 0x8D, 0x83, 0xF6, 0xE8, 0x3C, 0x38, 0xD7, 0x85, 0xD7, 0x14, 0x0C, 0x84,
+    0x0C, 0xB7, 0x2C, 0xBC, 0xF7, 0x82, 0x48, 0x30, 0x0F, 0x2D, 0xFD, 0xD2, 0x6E, 0xC6, 0xF0, 0xFE,
+    0x04, 0xED, 0xA8, 0x3C, 0xEA, 0xC2, 0x0B, 0xF2, 0x7A, 0xC1, 0x30, 0xAB, 0x9B, 0x01, 0xC4, 0x40,
+    0x27, 0x12, 0x0C, 0xD1, 0x2F, 0x60, 0x84, 0x19, 0x5B, 0x2E, 0x6D, 0x82, 0xE0, 0xA8, 0x3C, 0x54,
+    0x82, 0x76, 0xAB, 0x2F, 0xD7, 0x4C, 0x1B, 0xD8, 0xB0, 0x6B, 0x2B, 0x38, 0x1D, 0x3F, 0x07, 0x9C,
+    0xEA, 0x2E, 0xA3, 0x7F, 0xED, 0xD7, 0x5C, 0x78, 0xC7, 0x15, 0xC3, 0x9D, 0x74, 0xE8, 0x38, 0x57,
+    0x3C, 0x67, 0x67, 0x00, 0x77, 0x1D, 0x4E, 0xA8, 0xE6, 0x29, 0xE9, 0x80, 0x83, 0x8D, 0xC3, 0xF5,
+    0x0B, 0x25, 0x16, 0x7E, 0x56, 0x4C, 0xC5, 0x46, 0xF4, 0x4C, 0x0D, 0x99, 0x54, 0x3E, 0x17, 0xEC,
+    0xAC, 0xDF, 0x2E, 0xB0, 0x6F, 0xFA, 0x96, 0xC6, 0x75, 0x37, 0x0A, 0xF4, 0x7B, 0x11, 0x3C, 0xB7,
+    0xC8, 0x64, 0x9D, 0x7E, 0x8B, 0x4F, 0x53, 0x90, 0x51, 0x90, 0x53, 0xCB, 0x77, 0x50, 0xF9, 0xB3,
+    0x67, 0xB1, 0x0F, 0xA4, 0xD6, 0x03, 0xBC, 0xB8, 0x00, 0x86, 0x6E, 0x33, 0xBE, 0xFB, 0xBF, 0x0B,
+    0xF2, 0xE4, 0x2F, 0x35, 0x89, 0x7F, 0x13, 0xA4, 0x2B, 0xE0, 0xEC, 0xEE, 0x08, 0xE8, 0xAB, 0x09,
+    0x50, 0x81, 0x40, 0x9B, 0x06, 0x07, 0x3C, 0x2E, 0x17, 0xA0, 0x19, 0xB7, 0x2C, 0x93, 0x2F, 0x73,
+    0x5E, 0x3B, 0x2D, 0x48, 0x02, 0xBC, 0x61, 0x03, 0x74, 0x6C, 0xE8, 0x64, 0x41, 0x97, 0x40, 0x07,
+    0x33, 0xF7, 0x01, 0x22, 0xB7, 0x04, 0xF4, 0xAC, 0x17, 0x88, 0x5C, 0x33, 0x6C, 0xF4, 0x8C, 0x2E,
+    0xC9, 0x0C, 0xD0, 0x99, 0x19, 0x2A, 0x8A, 0xBC, 0x72, 0x0E, 0xCD, 0x22, 0x38, 0xF6, 0x09, 0x7D,
+    0x79, 0xB0, 0x7A, 0x7B, 0x96, 0xB5, 0xF7, 0x95, 0xA8, 0xB8, 0xF6, 0xF2, 0x60, 0x67, 0xBF, 0xB2,
+    0x76, 0xF5, 0x95, 0x04, 0x11, 0xF5, 0x84, 0xE1, 0xBE, 0x00, 0xEC, 0x6F, 0x9C, 0x81, 0x1D, 0x27,
+    0x34, 0xA4, 0x43, 0x4F, 0x3A, 0xF0, 0xFF, 0xE4, 0xD8, 0x65, 0x51, 0xA0, 0x97, 0x2E, 0x35, 0xC4,
+    0xB0, 0x65, 0xFE, 0x17, 0xD8, 0x49, 0x85, 0xB6, 0xC0, 0xB8, 0x2E, 0x89, 0x82, 0x7E, 0x0D, 0x0C,
+    0x4E, 0x35, 0x02, 0x39, 0x94, 0x71, 0x4B, 0x54, 0xDE, 0x1D, 0x37, 0xD1, 0x80, 0x15, 0xA4, 0xAB,
+    0x05, 0xC0, 0xD9, 0x4D, 0x58, 0xED, 0x3A, 0xA0, 0x6B, 0x52, 0x4F, 0x80, 0x7D, 0x8F, 0x4E, 0xC5,
+    0x2E, 0x1D, 0x97, 0x53, 0xC6, 0x0D, 0x5E, 0x25, 0xC1, 0x07, 0x39, 0x6A, 0x72, 0x16, 0x64, 0x80,
+    0x61, 0x42, 0x97, 0xF4, 0x0C, 0x3E, 0x49, 0xA8, 0xD0, 0xFB, 0x86, 0xE0, 0xD4, 0xFB, 0x2E, 0xB5,
+    0x05, 0x7A, 0xD6, 0xB3, 0xA0, 0xC8, 0x18, 0x42, 0xE5, 0xA0, 0xDA, 0x8A, 0x5D, 0x74, 0x8D, 0xE3,
+    0xAF, 0x9A, 0x53, 0x3F, 0x10, 0x9A, 0x6C, 0x5D, 0x77, 0x93, 0xD0, 0x8C, 0xE0, 0x02, 0xC9, 0x15,
+    0x49, 0xBB, 0x8A, 0x98, 0x42, 0x45, 0x4C, 0xC7, 0x91, 0xF4, 0x6A, 0x60, 0x40, 0xF3, 0x3C, 0x04,
+    0x39, 0xC3, 0x90, 0x63, 0x57, 0x6C, 0x02, 0x27, 0xEB, 0x54, 0x10, 0x19, 0x84, 0x9E, 0x7B, 0x2F,
+    0x53, 0x4B, 0xD0, 0xE9, 0x8F, 0x6C, 0x10, 0xAB, 0xB3, 0x71, 0x94, 0xA4, 0x83, 0xBD, 0x92, 0xA1,
+    0xE2, 0xE0, 0xC1, 0xD3, 0x44, 0xEF, 0x55, 0x5C, 0xED, 0x75, 0x91, 0x45, 0x86, 0xF6, 0x7A, 0xBE,
+    0x85, 0xB8, 0x59, 0x36, 0x66, 0x8D, 0x47, 0x8D, 0xA0, 0x6D, 0x09, 0x73, 0x79, 0x98, 0xE5, 0x2F,
+    0x88, 0xE1, 0x5A, 0x02, 0xB9, 0x08, 0x4E, 0xE8, 0xD3, 0xB6, 0xBD, 0x2A, 0x6C, 0xDD, 0x4A, 0xB7,
+    0x40, 0xAC, 0x5B, 0x02, 0x59, 0x32, 0x56, 0x1C, 0x96, 0x2B, 0xAD, 0x66, 0x77, 0x85, 0x3B, 0x67,
+    0x7F, 0x29, 0x43, 0x41, 0xF1, 0x9D, 0x3A, 0x5D, 0x35, 0x08, 0x55, 0x6C, 0x82, 0x5E, 0x06, 0x0F,
+    0x8E, 0x7A, 0x16, 0x09, 0x1C, 0x6B, 0x6E, 0x88, 0xD3, 0x5E, 0xB0, 0xEE, 0xC1, 0x4A, 0xBA, 0x6D,
+    0x48, 0x5F, 0x67, 0x4C, 0x2F, 0xD6, 0x81, 0xA7, 0x09, 0x99, 0x44, 0xA9, 0xF6, 0xBE, 0x9D, 0x54,
+    0x10, 0x19, 0xDA, 0xAB, 0x00, 0x3B, 0xE3, 0x2C, 0x4E, 0xC2, 0xB6, 0x09, 0xFA, 0x19, 0x8F, 0x9E,
+    0x0E, 0x8A, 0x47, 0x3A, 0x2E, 0x0F, 0x73, 0x93, 0xAD, 0x6B, 0x4B, 0x25, 0x28, 0x08, 0x4E, 0x90,
+    0xEB, 0xAC, 0x74, 0xE9, 0xD3, 0xE0, 0x78, 0xF8, 0x24, 0x38, 0xAE, 0x60, 0x8A, 0xAB, 0x33, 0xCB,
+    0x8E, 0x15, 0x06, 0xEC, 0x6E, 0xB7, 0xE5, 0x79, 0xE8, 0x0A, 0xD2, 0xD1, 0x97, 0x8B, 0x4E, 0x25,
+    0x8C, 0x62, 0x8B, 0xF1, 0x3D, 0xD0, 0x71, 0xAC, 0x7C, 0x2A, 0xC5, 0x69, 0x43, 0xAC, 0x42, 0x15,
+    0xE2, 0x2A, 0x00, 0x22, 0x37, 0x63, 0xC3, 0xF1, 0xF1, 0x6F, 0xD1, 0xF5, 0xE4, 0x2C, 0xEB, 0x0A,
+    0x99, 0x36, 0xC4, 0xAE, 0xDD, 0x7D, 0x34, 0x15, 0x1A, 0xC3, 0x8E, 0x90, 0x7E, 0xFB, 0xE0, 0x81,
+    0xE7, 0x05, 0xE9, 0x06, 0x16, 0x70, 0xFA, 0x9E, 0xC8, 0x95, 0xDC, 0x34, 0x94, 0x1A, 0x06, 0x1C,
+    0x58, 0x65, 0xA6, 0x4A, 0xC0, 0xE0, 0xFF, 0xBD, 0x86, 0x93, 0x65, 0x6A, 0xC9, 0x59, 0x32, 0xAF,
+    0xB7, 0xDE, 0xDD, 0xFF, 0x25, 0x61, 0xAC, 0xDF, 0x6E, 0xAF, 0x8E, 0x93, 0x81, 0x5E, 0xAD, 0x64,
+    0xA0, 0x75, 0x95, 0xFE, 0xDA, 0xBD, 0x02, 0x70, 0x82, 0xEF, 0x40, 0xD7, 0x60, 0x6B, 0xC3, 0x77,
+    0x93, 0x20, 0xEE, 0x10, 0x1B, 0xC3, 0x88, 0x2B, 0x34, 0x63, 0x04, 0x74, 0xA9, 0xAD, 0x6F, 0xE9,
+    0x6A, 0xC3, 0xAB, 0x43, 0x63, 0x1F, 0x66, 0x7E, 0xFC, 0x5B, 0x95, 0x7C, 0x6B, 0x98, 0xD1, 0x73,
+    0x01, 0x2E, 0xAD, 0xC1, 0x0C, 0x33, 0x01, 0x83, 0xC3, 0x8E, 0x99, 0xA0, 0x38, 0xD6, 0x10, 0x29,
+    0x80, 0x8E, 0xEF, 0x08, 0xD2, 0x59, 0x46, 0x15, 0x25, 0x38, 0x42, 0x65, 0xC0, 0x46, 0x08, 0x06,
+    0x74, 0x95, 0x67, 0x0F, 0xED, 0xD1, 0xF2, 0xF6, 0xD1, 0x2C, 0x96, 0xA9, 0x23, 0x47, 0xC3, 0x19,
+    0xFD, 0xD1, 0x0E, 0x33, 0x68, 0x1E, 0xF2, 0x18, 0x72, 0x0D, 0x63, 0xED, 0x60, 0x67, 0x44, 0x16,
+    0x11, 0xF2, 0xFD, 0x52, 0xA7, 0xA8, 0xE1, 0x72, 0x8C, 0x09, 0x73, 0xAE, 0x8C, 0xD0, 0x2C, 0x50,
+    0xA4, 0x6B, 0xF8, 0x6E, 0x82, 0xF6, 0xCD, 0xCA, 0x43, 0x5D, 0xD6, 0x70, 0xCF, 0x90, 0x57, 0x1E,
+    0x9F, 0xE0, 0xB2, 0x61, 0x26, 0xA6, 0x75, 0x8A, 0xAA, 0xEF, 0x63, 0xDE, 0x81, 0xCC, 0x78, 0xFC,
+    0x5B, 0x74, 0xB2, 0x0A, 0xC8, 0x8C, 0x86, 0x65, 0xC3, 0x6C, 0xDC, 0xC7, 0x59, 0x64, 0x19, 0x61,
+    0x3F, 0x83, 0xEF, 0x63, 0xCB, 0x28, 0x48, 0xD7, 0x91, 0x93, 0x8A, 0xB2, 0x6E, 0xA1, 0x5C, 0x15,
+    0x81, 0x60, 0x00, 0x6C, 0xAA, 0x13, 0x55, 0xC7, 0x1B, 0x3F, 0x90, 0x05, 0x96, 0x09, 0x96, 0x01,
+    0x86, 0xD5, 0x6B, 0xA0, 0xC9, 0xAC, 0xC9, 0x6C, 0xC8, 0x54, 0xB3, 0x5C, 0x3E, 0xE9, 0x3D, 0x76,
+    0x9F, 0xF2, 0x1E, 0x1F, 0xF7, 0x4E, 0x6D, 0xB6, 0xEF, 0x71, 0xEF, 0x94, 0x5C, 0x15, 0x85, 0x8C,
+    0x40, 0x9B, 0x80, 0x6F, 0x27, 0xC0, 0x06, 0xC0, 0x9E, 0xAF, 0x49, 0x77, 0x1A, 0xB0, 0x40, 0x41,
+    0xC7, 0x6C, 0x98, 0x0C, 0xD3, 0x97, 0xF3, 0xD9, 0x4F, 0xDA, 0xFE, 0xF3, 0xC6, 0x19, 0xFE, 0xFA,
+    0xA8, 0x39, 0x69, 0x4E, 0x8A, 0xA3, 0x5C, 0x56, 0x27, 0x73, 0x93, 0xF0, 0xED, 0x04, 0x1B, 0x61,
+    0xE6, 0xCA, 0x57, 0x2A, 0x6D, 0x82, 0x3E, 0xE3, 0x31, 0xDC, 0x2A, 0x73, 0x7E, 0x1B, 0x9D, 0x5B,
+    0x23, 0x9A, 0x0B, 0x60, 0xD1, 0xDC, 0x1F, 0xA0, 0x87, 0xB1, 0x4D, 0xFF, 0x39, 0xD4, 0x82, 0x96,
+    0x1C, 0x0D, 0x53, 0x43, 0xFA, 0xC6, 0xFE, 0xDD, 0xF8, 0xF9, 0x2E, 0x1D, 0x91, 0x80, 0x3E, 0xEC,
+    0x43, 0x73, 0x02, 0x0B, 0xB0, 0x52, 0xAF, 0x7E, 0x95, 0xD6, 0xEA, 0x9A, 0xFA, 0x03, 0xCB, 0x82,
+    0xBF, 0xE0, 0xB3, 0x9F, 0x6A, 0xED, 0x27, 0x1D, 0x85, 0x68, 0x46, 0x08, 0x8F, 0x36, 0x01, 0x05,
+    0x2D, 0xF9, 0x4D, 0xF2, 0x65, 0xD2, 0x7F, 0x39, 0x9F, 0x6D, 0x0B, 0xC0, 0x51, 0x90, 0xA7, 0x49,
+    0x67, 0xE8, 0x45, 0x75, 0x68, 0x6B, 0x87, 0x3E, 0xEC, 0x0B, 0x46, 0xB0, 0x40, 0x71, 0x3C, 0xA2,
+    0xD7, 0xC2, 0x8C, 0xA1, 0xE6, 0x5A, 0x09, 0x72, 0x86, 0x7C, 0x99, 0x13, 0x9A, 0x15, 0x39, 0x01,
+    0x1C, 0x45, 0x6E, 0x08, 0x99, 0x5A, 0x42, 0xA6, 0xB6, 0xA0, 0x8B, 0x95, 0xF5, 0x95, 0xAB, 0x6F,
+    0xB7, 0xF7, 0x1B, 0xD6, 0x97, 0x5E, 0x54, 0xA8, 0xCE, 0x5D, 0xED, 0x7A, 0x0F, 0xE3, 0x06, 0x0F,
+    0xEB, 0xF4, 0x02, 0x4E, 0x7A, 0x06, 0x47, 0x3D, 0xB7, 0x84, 0xF6, 0xB2, 0x60, 0x28, 0xE7, 0x12,
+    0x14, 0x19, 0x20, 0xC9, 0xA5, 0xBA, 0x33, 0x8F, 0xCC, 0xCA, 0x36, 0x4B, 0xD7, 0xF2, 0xE6, 0x02,
+    0x32, 0xE0, 0xC5, 0x3E, 0xE0, 0xE4, 0x9A, 0xF7, 0xD5, 0x7B, 0x91, 0xBA, 0xD8, 0x50, 0x14, 0xD8,
+    0x89, 0xA3, 0x9E, 0xB5, 0xDB, 0x22, 0x7E, 0x8A, 0x0C, 0x4E, 0x84, 0x9E, 0xB5, 0xEB, 0x7D, 0xEF,
+    0x55, 0x92, 0x49, 0x96, 0x86, 0x0F, 0x70, 0xD4, 0xBC, 0x36, 0x2B, 0xBE, 0xE1, 0xC1, 0xD7, 0xD3,
+    0x8A, 0x7F, 0x0E, 0x0F, 0x47, 0x80, 0x15, 0x56, 0x8D, 0xC0, 0xC1, 0xC1, 0xEF, 0xA4, 0xB3, 0xB7,
+    0x1F, 0xFE, 0x00, 0x92, 0x19, 0x2D, 0xB9, 0x35, 0x30, 0x1A, 0x42, 0x3B, 0x3B, 0xF5, 0x5E, 0x2F,
+    0x5D, 0x54, 0x41, 0x64, 0x91, 0x8E, 0x1C, 0x07, 0xBE, 0xA6, 0xC5, 0x88, 0x2C, 0x52, 0xC3, 0x66,
+    0x13, 0xB1, 0xEC, 0x83, 0x0D, 0x82, 0x25, 0x83, 0xD9, 0x40, 0xE5, 0xDE, 0xAD, 0xC3, 0xB5, 0xDF,
+    0xEC, 0xA3, 0xF5, 0x72, 0x46, 0x53, 0xAC, 0x03, 0xB8, 0xE5, 0x94, 0x6F, 0x47, 0xFA, 0x8B, 0xED,
+    0xEE, 0x2E, 0x4E, 0x42, 0xB9, 0x61, 0x6C, 0x8B, 0x75, 0xD0, 0x9C, 0x2B, 0xBF, 0x7A, 0x05, 0xB9,
+    0xBF, 0xB9, 0xB9, 0x6D, 0xC6, 0x4D, 0x2C, 0x5E, 0x5F, 0x02, 0xF0, 0xE8, 0x37, 0x36, 0xBF, 0xF4,
+    0xA5, 0xCD, 0x81, 0xDF, 0xD1, 0x00, 0xE0, 0xE4, 0xAA, 0x1E, 0x1E, 0x7F, 0x11, 0xF8, 0x86, 0x1A,
+    0xD1, 0x3D, 0x35, 0xA3, 0xB9, 0xE9, 0x81, 0x21, 0x6C, 0x8D, 0x81, 0xDF, 0xE0, 0x02, 0x68, 0xCE,
+    0xEE, 0x8E, 0x10, 0x45, 0xCF, 0x68, 0xCA, 0x30, 0x03, 0xB9, 0x9F, 0x81, 0xA4, 0x1C, 0x70, 0x72,
+    0x9B, 0x4C, 0x93, 0xA1, 0x42, 0x43, 0xC8, 0x04, 0xEB, 0x1A, 0x62, 0x58, 0x60, 0x27, 0x15, 0xA0,
+    0x97, 0x5B, 0x8E, 0x54, 0x6B, 0x86, 0x93, 0x0A, 0xD0, 0xB3, 0x48, 0x50, 0xFE, 0xB3, 0x8F, 0x64,
+    0x0C, 0x1E, 0x74, 0x7D, 0xAC, 0xA3, 0x20, 0xC8, 0x0C, 0x18, 0x96, 0x95, 0x55, 0xB4, 0x19, 0xF8,
+    0xDD, 0xD3, 0xFB, 0xD5, 0x68, 0x1C, 0xAE, 0x66, 0x34, 0x69, 0x70, 0xE8, 0x9F, 0x88, 0x47, 0xAD,
+    0x6A, 0x08, 0xBD, 0xE6, 0x38, 0x2F, 0x6B, 0x8E, 0xB3, 0x38, 0x9E, 0xE3, 0xEC, 0x8F, 0x72, 0x9C,
+    0xD7, 0x40, 0x14, 0x9D, 0x4C, 0xB2, 0xA0, 0x0F, 0x36, 0x40, 0xF3, 0xDA, 0x0C, 0x66, 0x03, 0xF0,
+    0xF5, 0xB4, 0x9A, 0xBC, 0x5F, 0xD8, 0x3C, 0x77, 0x0B, 0x80, 0x61, 0x5C, 0xD9, 0xF7, 0xB8, 0x04,
+    0x00, 0xBC, 0x00, 0xC0, 0x2E, 0xC7, 0xE9, 0xF7, 0x32, 0x81, 0x6D, 0x81, 0x71, 0xFC, 0x84, 0xE3,
+    0xAF, 0x2D, 0xB0, 0x8E, 0xA3, 0x5E, 0xB4, 0x53, 0x41, 0x79, 0x99, 0x64, 0x12, 0x6C, 0xD8, 0x70,
+    0x32, 0x3F, 0xE2, 0xAC, 0x78, 0x33, 0x08, 0x7E, 0x94, 0xA0, 0x83, 0x01, 0xC6, 0x4B, 0xEB, 0x13,
+    0x1E, 0x5F, 0xF9, 0x30, 0xEA, 0x06, 0xD0, 0x72, 0x3A, 0x4E, 0xF3, 0xAF, 0x42, 0x45, 0x56, 0xFB,
+    0xC5, 0x54, 0x7F, 0x5E, 0x2C, 0x00, 0x60, 0xC7, 0x8C, 0x95, 0xFE, 0x7C, 0xA4, 0xFA, 0xCC, 0xD4,
+    0x16, 0x33, 0x89, 0x02, 0xF5, 0x7E, 0x41, 0x1F, 0x61, 0x5F, 0x89, 0xE0, 0x22, 0xB2, 0x5A, 0x04,
+    0xA7, 0xDE, 0x6B, 0x37, 0x14, 0x70, 0x24, 0x18, 0x45, 0x12, 0xA9, 0xBB, 0xE9, 0x87, 0x45, 0x79,
+    0x7D, 0xD1, 0x11, 0xFA, 0xE5, 0x64, 0x65, 0x04, 0xD5, 0x07, 0x49, 0xCF, 0x22, 0x99, 0x07, 0xDE,
+    0x27, 0xD4, 0x87, 0x69, 0x78, 0x35, 0x40, 0xBF, 0x36, 0x5B, 0xED, 0x50, 0x6C, 0x93, 0x33, 0xC4,
+    0xCD, 0x28, 0xE9, 0xA1, 0xE8, 0x7A, 0x4E, 0xD0, 0x05, 0x26, 0x01, 0xF4, 0x0D, 0x17, 0x08, 0x3A,
+    0x59, 0xA1, 0x5D, 0x75, 0xB1, 0x56, 0x5D, 0xAF, 0x58, 0x15, 0xFE, 0x88, 0x9A, 0x91, 0x03, 0x19,
+    0xD5, 0xB2, 0x52, 0xF3, 0x56, 0x67, 0xD0, 0x34, 0x04, 0x91, 0xB4, 0xD3, 0xA1, 0x4B, 0xDA, 0x99,
+    0xA0, 0x82, 0x76, 0x0C, 0xBD, 0xD7, 0x2F, 0x33, 0xE8, 0x59, 0x5F, 0xBE, 0x19, 0x8C, 0xD3, 0x57,
+    0x3E, 0x0C, 0x76, 0xD4, 0xAF, 0x7E, 0x18, 0x08, 0xFD, 0xDA, 0xD5, 0x5F, 0x64, 0xE8, 0x37, 0xAF,
+    0x7C, 0x9C, 0x30, 0x5C, 0xBB, 0xFF, 0xE3, 0x88, 0x81, 0x82, 0x1E, 0x43, 0x11, 0x5C, 0x30, 0x24,
+    0x41, 0x87, 0x21, 0x09, 0x4E, 0x18, 0x82, 0xE0, 0xC6, 0xCD, 0x68, 0x62, 0xB5, 0xBD, 0x64, 0x2C,
+    0x95, 0xEF, 0xB2, 0x7B, 0x14, 0x4B, 0xFF, 0xAD, 0x26, 0x4D, 0x56, 0x50, 0xD8, 0x97, 0x75, 0x02,
+    0x9B, 0xA2, 0x1D, 0x64, 0x50, 0xF3, 0xB1, 0xF0, 0xE7, 0xEF, 0x20, 0x23, 0x69, 0x10, 0x0B, 0x44,
+    0xB4, 0x80, 0x39, 0xE3, 0xD1, 0x2E, 0x8F, 0x1D, 0x8F, 0x0D, 0x83, 0x4F, 0x65, 0x0C, 0x7E, 0x58,
+    0x44, 0x69, 0x08, 0x3A, 0xE5, 0x7B, 0x0F, 0xDE, 0x9F, 0xD1, 0x05, 0xEB, 0x60, 0xBE, 0xEF, 0x21,
+    0x98, 0x2B, 0xEA, 0x6E, 0xE9, 0x81, 0x3E, 0x6F, 0xC8, 0xB8, 0xC7, 0xB3, 0xBE, 0xDA, 0xA3, 0xAC,
+    0xAF, 0x35, 0xD6, 0xB8, 0xB1, 0x06, 0x76, 0xC7, 0x0D, 0xE3, 0xEA, 0x33, 0xF3, 0x4A, 0x7A, 0x32,
+    0xC1, 0x92, 0xBE, 0x25, 0x39, 0x75, 0x6B, 0x8E, 0xF4, 0x0C, 0x74, 0x05, 0xC0, 0x96, 0xAE, 0xA5,
+    0xC3, 0x9A, 0x91, 0xD9, 0xC7, 0x95, 0x51, 0xAA, 0x36, 0xF0, 0xFD, 0x13, 0x27, 0x96, 0xC3, 0x67,
+    0x1B, 0x92, 0x4B, 0x47, 0x72, 0xD4, 0xF5, 0x7E, 0xCD, 0xD9, 0x8D, 0x99, 0x54, 0x8D, 0x96, 0x72,
+    0xE4, 0x3E, 0xAB, 0x61, 0xA5, 0xD8, 0x90, 0x01, 0x07, 0xA6, 0x3A, 0x2F, 0x5A, 0x8E, 0x90, 0x79,
+    0x25, 0x97, 0x78, 0x80, 0xD5, 0x29, 0x20, 0x33, 0xD0, 0x5F, 0x3F, 0x80, 0xAE, 0x37, 0x86, 0x21,
+    0x6F, 0x4D, 0xB8, 0x98, 0x3E, 0x2B, 0xE1, 0xE2, 0x0B, 0xE9, 0x20, 0x80, 0x66, 0xD3, 0xE0, 0x65,
+    0x8D, 0xBC, 0x6C, 0xB0, 0x37, 0xC8, 0x28, 0xC9, 0x79, 0xE7, 0xDB, 0x35, 0x9C, 0xD4, 0x72, 0x44,
+    0x1F, 0x6A, 0x28, 0x31, 0x01, 0xAC, 0x81, 0x45, 0x33, 0x43, 0x96, 0x83, 0x51, 0x93, 0x63, 0xCD,
+    0x0A, 0xF5, 0xBF, 0x42, 0xBA, 0xC5, 0x17, 0xD1, 0xB7, 0x5D, 0xEC, 0xA2, 0x5B, 0x06, 0x87, 0xA2,
+    0x1D, 0x7A, 0x3A, 0x08, 0xBA, 0x6D, 0x0B, 0x44, 0x4D, 0xF5, 0x88, 0x30, 0xCC, 0xD8, 0xF9, 0xF6,
+    0x6A, 0x38, 0xB4, 0x1C, 0xAB, 0xE1, 0xC8, 0xA9, 0x3E, 0x8E, 0xAB, 0x91, 0x61, 0x66, 0xC0, 0xFC,
+    0xF4, 0xEC, 0x96, 0x30, 0x5F, 0xBB, 0x59, 0x55, 0xFD, 0x90, 0x01, 0xC5, 0xB9, 0xB2, 0x16, 0xF4,
+    0x32, 0x1E, 0x8B, 0x84, 0x87, 0x5F, 0x6D, 0xF3, 0xD7, 0xF3, 0x6E, 0xA1, 0xB3, 0x7F, 0xFA, 0x3C,
+    0x57, 0x67, 0xE9, 0x2F, 0x56, 0x0A, 0x1C, 0x6C, 0x02, 0x64, 0x01, 0xB0, 0x3B, 0xEA, 0x45, 0x79,
+    0x19, 0x9A, 0x84, 0xB3, 0x9B, 0x52, 0x22, 0x63, 0x2D, 0x25, 0xB2, 0x3B, 0x36, 0x5C, 0x24, 0x7D,
+    0xFF, 0x76, 0x32, 0x63, 0x3E, 0x8B, 0xDD, 0x8A, 0xBB, 0x2F, 0xF3, 0xE6, 0x5B, 0xA4, 0x7F, 0xB1,
+    0x0F, 0x27, 0xB1, 0x8F, 0x3B, 0x0F, 0xFF, 0x47, 0xD2, 0xF0, 0xAD, 0x83, 0xB3, 0x77, 0x1E, 0x1E,
+    0x3E, 0x45, 0x26, 0x4D, 0x3E, 0x71, 0x70, 0xB0, 0x7F, 0x12, 0x07, 0x41, 0xBC, 0x7D, 0xC3, 0x9E,
+    0x61, 0xEC, 0x38, 0x35, 0x23, 0xA0, 0xDE, 0x23, 0xCD, 0x88, 0xFE, 0xFE, 0xA5, 0x0C, 0x57, 0xA2,
+    0xED, 0x9E, 0x08, 0x68, 0xF9, 0x97, 0xFC, 0xF3, 0x22, 0x82, 0x7D, 0x2A, 0xDC, 0x3E, 0x36, 0xE3,
+    0x10, 0x1E, 0x4F, 0x3F, 0x3C, 0xF5, 0xC3, 0x53, 0x8F, 0xA7, 0x21, 0x34, 0x63, 0x73, 0x76, 0x77,
+    0x34, 0xAF, 0x24, 0xE5, 0x29, 0xA2, 0x9E, 0x2E, 0x75, 0xF3, 0x0E, 0xF6, 0x71, 0x16, 0xBB, 0xA6,
+    0xC9, 0xFA, 0xD5, 0xA0, 0x38, 0x77, 0x1C, 0x9B, 0xB3, 0xD8, 0xB9, 0xFF, 0xFD, 0x78, 0x49, 0xAB,
+    0x2B, 0x6F, 0xC5, 0x7F, 0x84, 0xDD, 0x9D, 0xFB, 0x7D, 0x7A, 0xBC, 0x7F, 0xFA, 0xF5, 0x70, 0x69,
+    0xB8, 0xFD, 0xC9, 0x0B, 0xBB, 0xA7, 0xF7, 0xF5, 0x2B, 0x51, 0xFD, 0x28, 0x49, 0x9F, 0x9B, 0xA0,
+    0xB1, 0xBF, 0x83, 0x47, 0x21, 0x62, 0x73, 0xE6, 0xF5, 0x33, 0x7F, 0xF8, 0x8D, 0x7B, 0x5B, 0x6F,
+    0x39, 0xD9, 0x88, 0x93, 0xC0, 0x59, 0x0C, 0x14, 0x64, 0xFF, 0x6E, 0x7A, 0xB1, 0xF9, 0x68, 0x6C,
+    0x46, 0xE4, 0x36, 0x89, 0xD8, 0xF9, 0xDE, 0xEB, 0xD9, 0xB8, 0x5D, 0x88, 0x2C, 0x52, 0x17, 0x94,
+    0xEF, 0x67, 0xED, 0x34, 0x76, 0x41, 0xFD, 0xDA, 0x07, 0xC9, 0xF4, 0x57, 0xFC, 0xD9, 0x4F, 0x1E,
+    0xD9, 0x3D, 0xCD, 0x36, 0x8B, 0x28, 0x7C, 0x33, 0xE2, 0x00, 0xD6, 0x19, 0xA7, 0x9D, 0x9E, 0x76,
+    0x46, 0x00, 0xCD, 0xF2, 0xE0, 0x99, 0xB4, 0xEB, 0x85, 0xBB, 0x0D, 0xC0, 0xC3, 0xED, 0xDF, 0xA9,
+    0x74, 0xEA, 0xCF, 0x97, 0xA6, 0x2E, 0xA7, 0x74, 0xD7, 0x73, 0x0E, 0x8F, 0x40, 0x8E, 0x78, 0x1E,
+    0x0A, 0xF0, 0xF8, 0x3D, 0xE0, 0xA0, 0x7A, 0x50, 0xC3, 0x10, 0xFB, 0xD8, 0x2D, 0x00, 0xE4, 0x5F,
+    0x5E, 0x7D, 0xDD, 0x3F, 0xA6, 0xA6, 0xF3, 0xED, 0xA4, 0xF0, 0xC8, 0x97, 0xAF, 0x33, 0x00, 0x77,
+    0x3D, 0xAB, 0x93, 0x9C, 0xE4, 0xD8, 0x55, 0x2F, 0x1F, 0xF6, 0xFA, 0x72, 0xEE, 0x9D, 0xAF, 0xE3,
+    0x02, 0xBE, 0xFB, 0x1C, 0xAB, 0xBC, 0xEB, 0xE7, 0xCE, 0xB7, 0x09, 0x05, 0xF6, 0x7E, 0x3A, 0xCE,
+    0x7A, 0xC6, 0xED, 0x53, 0xEF, 0x06, 0xA7, 0x9D, 0x9E, 0xF4, 0xFF, 0xA5, 0x53, 0x9F, 0xDA, 0x1F,
+    0xA0, 0x49, 0xFA, 0xED, 0xAC, 0xDD, 0xF1, 0xC9, 0xD9, 0x19, 0xB5, 0x7F, 0x29, 0x85, 0xBD, 0xB0,
+    0xF7, 0x52, 0xD2, 0xBE, 0x01, 0xA0, 0xE7, 0xD2, 0x79, 0x8D, 0xB3, 0x10, 0x8B, 0x0A, 0x32, 0x21,
+    0x7D, 0x3B, 0x99, 0x68, 0x66, 0xE1, 0xB5, 0x08, 0xCA, 0xE9, 0x0B, 0x9C, 0x09, 0xEC, 0x8C, 0xA9,
+    0x7F, 0x22, 0x0C, 0xC2, 0x6B, 0xB9, 0xFC, 0x23, 0xDC, 0x7E, 0x78, 0x28, 0xC9, 0xCB, 0x33, 0xBC,
+    0xC7, 0x23, 0x7B, 0xB8, 0x7B, 0xA7, 0xE2, 0xEF, 0xE7, 0xEF, 0xF9, 0xA3, 0xBF, 0xCD, 0x8F, 0xEA,
+    0x37, 0x3D, 0x80, 0x93, 0xD8, 0x55, 0xCE, 0x3C, 0x99, 0xEC, 0xA8, 0x39, 0x4A, 0x4E, 0x38, 0xA8,
+    0x5C, 0x55, 0x9D, 0xA0, 0x39, 0xE9, 0x57, 0xBD, 0x9E, 0xEC, 0x0E, 0x76, 0xC6, 0x93, 0x38, 0x79,
+    0x2F, 0x92, 0x7E, 0x2F, 0xF6, 0xF4, 0x1D, 0x27, 0x9C, 0x05, 0x0E, 0xD0, 0xF3, 0x34, 0xA9, 0xDE,
+    0x2D, 0x8F, 0x21, 0xD6, 0x14, 0xEC, 0x26, 0x8B, 0xD7, 0x79, 0xD3, 0x93, 0xF1, 0xD1, 0x2E, 0xEE,
+    0xE0, 0x0E, 0xDC, 0x79, 0x78, 0x81, 0xBC, 0x42, 0xEE, 0x1C, 0xEC, 0xEF, 0x1E, 0x1C, 0x3C, 0x40,
+    0xE6, 0xEF, 0x1E, 0x1E, 0x4E, 0x3B, 0x07, 0x07, 0xA7, 0xC9, 0x7C, 0xE7, 0xE1, 0xE1, 0x04, 0x60,
+    0xF7, 0xE0, 0xE0, 0x7E, 0x32, 0xDE, 0x75, 0x78, 0x58, 0x0B, 0x3A, 0xB5, 0x9E, 0x37, 0xA2, 0x61,
+    0xBA, 0xB7, 0xCB, 0x3B, 0x38, 0x89, 0xBB, 0x0E, 0x0F, 0x1F, 0x22, 0x7F, 0x4E, 0x7E, 0x74, 0x70,
+    0x70, 0x56, 0x73, 0x2D, 0xE3, 0xC3, 0x62, 0xC9, 0x35, 0x90, 0x5D, 0x5F, 0xCF, 0x43, 0x46, 0xE8,
+    0xD8, 0x72, 0xEE, 0x33, 0xF4, 0x02, 0x35, 0x6E, 0x0D, 0xE4, 0xB5, 0x0E, 0xD0, 0x30, 0x02, 0x62,
+    0x01, 0xF0, 0x22, 0x6A, 0x35, 0x24, 0xE1, 0x01, 0x3C, 0x86, 0x4A, 0x72, 0x6B, 0x03, 0x80, 0x7B,
+    0x01, 0x74, 0xAE, 0xD6, 0x4C, 0x82, 0x06, 0x20, 0xE7, 0x5F, 0xFD, 0xE2, 0xBB, 0x00, 0xE0, 0x76,
+    0x44, 0xE9, 0xF6, 0xBA, 0x2B, 0xE1, 0xEF, 0xE3, 0x4F, 0xF0, 0x07, 0x7B, 0xF8, 0xFA, 0x23, 0xD8,
+    0xFB, 0xDB, 0x83, 0x47, 0xC9, 0x78, 0x70, 0xB0, 0x0F, 0x40, 0x33, 0xFD, 0xFD, 0x83, 0x47, 0x1F,
+    0xC6, 0x3D, 0xCF, 0xE3, 0x61, 0x4B, 0x7F, 0x78, 0x78, 0x01, 0x80, 0xFA, 0x38, 0x9E, 0x7A, 0xFC,
+    0x9F, 0x3C, 0x7F, 0xCF, 0x1F, 0x01, 0xB8, 0x0D, 0x77, 0x3F, 0xDA, 0x7B, 0xE5, 0xB4, 0x7F, 0xD8,
+    0x03, 0x40, 0x37, 0x5F, 0x12, 0x73, 0x37, 0x29, 0xEC, 0xB5, 0xFE, 0x5E, 0x00, 0x9F, 0x37, 0x78,
+    0xE3, 0xEE, 0xC8, 0x89, 0x4D, 0x6E, 0x52, 0xB3, 0xDF, 0x1C, 0xC8, 0xAC, 0xC2, 0x30, 0xDB, 0x1A,
+    0x2F, 0x38, 0x36, 0x2D, 0x7D, 0xDC, 0xC1, 0x1D, 0xF8, 0x6E, 0x97, 0x1E, 0x72, 0x49, 0x8D, 0xFB,
+    0x68, 0x0E, 0x21, 0x16, 0x3E, 0xF3, 0x54, 0xB2, 0xCF, 0xF8, 0xA2, 0xAF, 0xA4, 0x6F, 0xF4, 0xEE,
+    0x87, 0xD5, 0x06, 0x10, 0x41, 0x7F, 0xF3, 0xBA, 0xF9, 0x51, 0xAA, 0x39, 0x14, 0x1F, 0xBF, 0x7B,
+    0xF8, 0xB7, 0x33, 0xEE, 0x7E, 0x1E, 0xEA, 0x4F, 0xD0, 0x4E, 0x9F, 0xDF, 0x86, 0x9D, 0xFB, 0x7D,
+    0xBA, 0x57, 0x3D, 0xFD, 0x56, 0xB8, 0x34, 0xFC, 0x83, 0x27, 0x2E, 0xEC, 0x3E, 0x50, 0xFE, 0x62,
+    0xFE, 0xBA, 0x70, 0x7B, 0xB8, 0x0D, 0xB7, 0x3D, 0xFC, 0x1F, 0xF3, 0x95, 0xEF, 0xDB, 0xF4, 0x3C,
+    0x5F, 0x7F, 0xA0, 0x4E, 0xCC, 0x0E, 0xA0, 0x47, 0xE8, 0x11, 0x1A, 0x27, 0xCE, 0x7F, 0xA5, 0xCF,
+    0x8F, 0x9E, 0xB2, 0xE1, 0xE1, 0x6E, 0xC6, 0x0B, 0x68, 0x13, 0xDA, 0x08, 0x5C, 0xA8, 0x60, 0xF8,
+    0xEB, 0x8A, 0xF1, 0xEE, 0x7E, 0x01, 0xD0, 0xCD, 0x0F, 0x6B, 0xFA, 0x17, 0x8C, 0xDB, 0xDF, 0x01,
+    0x9E, 0x18, 0xBF, 0xDA, 0xDD, 0x4F, 0x3E, 0xFD, 0x6E, 0x94, 0xA2, 0x4E, 0xF2, 0xF7, 0xFA, 0xCB,
+    0xD7, 0x55, 0xB3, 0xDC, 0x0D, 0xE3, 0xB4, 0xD3, 0x6F, 0x24, 0x91, 0x44, 0xFE, 0x1E, 0x00, 0xBC,
+    0x01, 0xEC, 0xE3, 0x4B, 0xDF, 0xC1, 0xBF, 0xFA, 0x53, 0x9C, 0xC7, 0x7F, 0xD3, 0xFC, 0x31, 0xF0,
+    0x6F, 0x41, 0x00, 0x27, 0x80, 0x1D, 0x7C, 0xE7, 0x3B, 0xC0, 0x85, 0xBF, 0x06, 0x80, 0x2F, 0x7D,
+    0x6F, 0x06, 0xFE, 0xF4, 0x8D, 0xDB, 0x80, 0xE6, 0x4B, 0xDF, 0xFB, 0x0E, 0xB0, 0x3F, 0x9F, 0x00,
+    0x6E, 0x07, 0xFE, 0x1E, 0x5A, 0x00, 0xFF, 0x5B, 0xF3, 0xA7, 0xF8, 0xE3, 0xE6, 0x5F, 0xFD, 0x19,
+    0x9E, 0x06, 0xF6, 0xF1, 0xA5, 0x7A, 0xDF, 0x67, 0xDB, 0x67, 0xDB, 0xFF, 0xC5, 0x38, 0x33, 0xEB,
+    0x19, 0xF7, 0x74, 0x8B, 0xEE, 0xF9, 0x1F, 0xE1, 0xC4, 0xCB, 0xE9, 0x5E, 0xE1, 0xEE, 0x6D, 0xFD,
+    0x09, 0x34, 0x2F, 0x8D, 0x9A, 0x4F, 0xDE, 0xB0, 0x6A, 0x3C, 0xF5, 0x48, 0xFA, 0xA1, 0x0C, 0x50,
+    0x0E, 0xB7, 0x01, 0xF8, 0x1F, 0x44, 0x91, 0x5E, 0xCF, 0x1F, 0x4F, 0x00, 0xF6, 0x2F, 0xE9, 0xFB,
+    0x97, 0x2F, 0xCF, 0xB7, 0x9F, 0xEF, 0x96, 0xDE, 0xBD, 0xF8, 0xF8, 0x3F, 0xC4, 0xF9, 0x66, 0xBC,
+    0x24, 0x96, 0xFE, 0x15, 0xAF, 0x5E, 0x7D, 0xF8, 0xA5, 0xDF, 0xBF, 0x67, 0xFE, 0xFA, 0x57, 0x6E,
+    0x47, 0xEC, 0xD6, 0x35, 0x55, 0xE5, 0x38, 0x20, 0xA6, 0xFF, 0xFE, 0x3F, 0xE1, 0x93, 0xE1, 0xAB,
+    0xFE, 0xDF, 0x19, 0x01, 0x0C, 0x3F, 0x0E, 0xFF, 0xF4, 0xD2, 0xA3, 0xCF, 0xDF, 0xF3, 0xA5, 0xE7,
+    0xEF, 0xF9, 0xD2, 0x3F, 0x2D, 0x8F, 0xF6, 0x6F, 0xF8, 0x3F, 0x93, 0xB0, 0xFF, 0xF7, 0x8B, 0xAD,
+    0xFB, 0xDA, 0x8B, 0x00, 0xDA, 0xF7, 0x33, 0x00, 0x73, 0x5F, 0x19, 0x71, 0x2E, 0xB4, 0x64, 0x8D,
+    0x2C, 0x70, 0x01, 0xCE, 0xF1, 0x9D, 0xBA, 0x88, 0x5B, 0x9F, 0x01, 0x98, 0x27, 0x39, 0xA2, 0x8F,
+    0xB7, 0x9C, 0xF2, 0xEF, 0xF3, 0x1D, 0xE0, 0xCE, 0xC3, 0xC3, 0xC3, 0x33, 0x24, 0xAF, 0x90, 0xF4,
+    0x07, 0x07, 0x07, 0x67, 0xEF, 0x3A, 0x3C, 0xFC, 0x1B, 0x53, 0x77, 0x61, 0xDE, 0x3D, 0x38, 0x38,
+    0xBB, 0x49, 0xF3, 0xBC, 0x31, 0xE2, 0x51, 0x45, 0xF2, 0xB9, 0xA8, 0xDF, 0x23, 0xE9, 0x1F, 0xC3,
+    0x09, 0xCB, 0xE9, 0x0E, 0xE0, 0xA8, 0x30, 0x50, 0xC7, 0x1B, 0xB5, 0xA2, 0xC2, 0x04, 0x92, 0x9C,
+    0xD5, 0x75, 0xC0, 0xBA, 0x02, 0x60, 0xF8, 0x67, 0xE7, 0x37, 0xDB, 0x68, 0xC3, 0x1A, 0x1B, 0x77,
+    0x0F, 0x0E, 0x0E, 0xBE, 0xBD, 0x68, 0xB2, 0x7A, 0xE6, 0x56, 0xDD, 0x2D, 0x26, 0x00, 0x68, 0xD0,
+    0xFE, 0x07, 0x7D, 0xDE, 0xDB, 0x7B, 0x64, 0xEF, 0x91, 0x47, 0x1E, 0x0B, 0xFA, 0x79, 0xA0, 0xB9,
+    0xA0, 0x5E, 0xBC, 0x7B, 0x4F, 0xC7, 0x53, 0xE3, 0xA9, 0xEF, 0xF4, 0x1E, 0x50, 0xED, 0x34, 0xBE,
+    0xB0, 0xA7, 0xE4, 0x93, 0xF3, 0xF3, 0x68, 0xCE, 0xF7, 0x71, 0x6F, 0xEF, 0x91, 0xBD, 0x87, 0xF7,
+    0x1E, 0x0B, 0xC3, 0x0C, 0xDC, 0x76, 0xDB, 0xD7, 0xEF, 0xDE, 0xDB, 0xDB, 0xDB, 0x7B, 0xE4, 0x91,
+    0xC7, 0xC2, 0xBD, 0xDF, 0x03, 0xDA, 0xF3, 0xF6, 0x15, 0x77, 0x37, 0x7C, 0xFB, 0xB3, 0x36, 0x01,
+    0x50, 0x10, 0xEE, 0xDF, 0x5D, 0x4C, 0xD8, 0xDB, 0xFB, 0xAA, 0x92, 0xDF, 0x7C, 0xE2, 0xE3, 0x79,
+    0x78, 0x1E, 0x80, 0x82, 0xC2, 0x57, 0xBF, 0x33, 0xA4, 0x53, 0x7B, 0x7B, 0x7B, 0x8F, 0x3C, 0xF2,
+    0xC2, 0xC3, 0xCF, 0x3F, 0x7F, 0xDB, 0x77, 0xBE, 0x33, 0x94, 0x74, 0xEA, 0x54, 0xBD, 0xD5, 0x23,
+    0x2F, 0xBC, 0xF0, 0xC2, 0xF3, 0xCF, 0x3F, 0x7F, 0xDB, 0x77, 0xCC, 0x65, 0xAF, 0xB0, 0xD7, 0x2C,
+    0xDD, 0x08, 0x81, 0x8F, 0xF4, 0xEB, 0xF3, 0xDD, 0xC2, 0x9D, 0x6A, 0x03, 0xB0, 0xFF, 0x6F, 0x5F,
+    0xFE, 0xF1, 0xEF, 0xFF, 0x91, 0xFF, 0xAF, 0xA7, 0x24, 0x66, 0xEC, 0x34, 0xA7, 0x3F, 0x74, 0xDA,
+    0xC9, 0x59, 0x04, 0xF1, 0xA6, 0xF8, 0xD1, 0x5C, 0x03, 0x2D, 0xDA, 0xAD, 0x24, 0x02, 0x8B, 0x1A,
+    0x65, 0x3A, 0xC2, 0xAD, 0x19, 0x86, 0x1C, 0xFB, 0xEA, 0x79, 0xF6, 0xB7, 0x24, 0x93, 0x0D, 0x47,
+    0x69, 0x67, 0x1E, 0x64, 0x82, 0x21, 0x31, 0xF8, 0x0A, 0x3D, 0x44, 0xDE, 0xF0, 0x37, 0x1C, 0x30,
+    0xDC, 0x38, 0x9C, 0xD4, 0x9A, 0x76, 0xD6, 0x6C, 0x48, 0xFD, 0x62, 0x43, 0x88, 0x97, 0x95, 0xFD,
+    0xFE, 0x69, 0x14, 0xF3, 0xEE, 0xF9, 0x9A, 0xEF, 0xC4, 0xDA, 0x82, 0xD4, 0x10, 0x76, 0xDE, 0xC4,
+    0xE0, 0x66, 0xED, 0x44, 0x96, 0x09, 0xD6, 0xD9, 0xFF, 0xFD, 0x5C, 0x52, 0xD1, 0x72, 0xE4, 0x03,
+    0x9C, 0x95, 0xB7, 0x5B, 0xC7, 0xC9, 0xC1, 0x58, 0xF9, 0x42, 0xDB, 0xB6, 0x0C, 0xEE, 0x88, 0x2A,
+    0xB4, 0x49, 0x14, 0x1C, 0x7F, 0x59, 0xA2, 0xE0, 0xB6, 0x4D, 0x9F, 0xB2, 0x39, 0x6E, 0x39, 0xAF,
+    0xFF, 0x94, 0x6D, 0xB2, 0x09, 0x54, 0xBD, 0x83, 0xB5, 0xDF, 0x19, 0xBC, 0x71, 0xD1, 0xE9, 0x88,
+    0x93, 0xB2, 0x6C, 0xB2, 0xD5, 0x02, 0xD0, 0xF2, 0xE0, 0x2C, 0xD6, 0x78, 0x69, 0x82, 0x26, 0x9D,
+    0xCC, 0x07, 0x67, 0x61, 0xDC, 0xE6, 0xC1, 0x0B, 0x20, 0x38, 0x36, 0xE8, 0xF9, 0x2D, 0x0F, 0x6E,
+    0xF2, 0x15, 0xE5, 0x2D, 0x69, 0x30, 0xF2, 0x53, 0xD1, 0x17, 0xFC, 0xDA, 0xD1, 0x97, 0x93, 0x00,
+    0xF4, 0x2C, 0x53, 0xCD, 0xAE, 0xE0, 0xA4, 0x42, 0xC3, 0x9A, 0xB2, 0xA1, 0x67, 0x91, 0xAA, 0x65,
+    0xB9, 0x7E, 0x5A, 0x6B, 0x4F, 0x2E, 0x22, 0x6F, 0x62, 0x77, 0xFD, 0x19, 0xA7, 0x7E, 0x1E, 0xC4,
+    0xF5, 0x84, 0x17, 0x4F, 0x1D, 0xAB, 0xE0, 0x51, 0x49, 0x1D, 0x5D, 0x84, 0x28, 0x00, 0x47, 0x98,
+    0xED, 0xFB, 0x0C, 0x10, 0x30, 0x0E, 0x83, 0x87, 0xBA, 0xE5, 0xFD, 0xB2, 0xBE, 0x6F, 0x88, 0x35,
+    0x3D, 0x6E, 0xE5, 0x53, 0x1E, 0xCB, 0x54, 0xFF, 0x44, 0x14, 0x58, 0xC5, 0xCF, 0x23, 0xD7, 0xAD,
+    0x51, 0xE3, 0xB6, 0x6C, 0xCF, 0x17, 0xC4, 0x5D, 0x36, 0xC0, 0xD2, 0xB5, 0x4C, 0xD5, 0xE4, 0xDD,
+    0x98, 0x1C, 0xA1, 0x16, 0xBB, 0xE3, 0x58, 0xED, 0x1B, 0xBF, 0x56, 0x65, 0xA9, 0x44, 0xB6, 0x61,
+    0x01, 0xA0, 0x42, 0x65, 0xA6, 0x11, 0xDA, 0x01, 0xE8, 0xBD, 0xCC, 0x23, 0xD0, 0x16, 0x58, 0x2E,
+    0x80, 0x9E, 0x15, 0x39, 0x43, 0x24, 0x90, 0x04, 0x8C, 0x53, 0x1F, 0x99, 0x88, 0x2E, 0x36, 0x04,
+    0x1D, 0x38, 0x0E, 0x4B, 0x97, 0xD0, 0x7B, 0x51, 0x60, 0x9D, 0x28, 0xD0, 0xB3, 0x8A, 0xB0, 0xB3,
+    0x48, 0x2D, 0xEF, 0x67, 0x82, 0x79, 0x97, 0x5E, 0x73, 0xAC, 0x89, 0x28, 0x33, 0x48, 0x42, 0x07,
+    0x28, 0x96, 0x63, 0xE5, 0x75, 0xE6, 0xA6, 0x60, 0x65, 0x77, 0x43, 0x26, 0xE8, 0x19, 0x18, 0x16,
+    0x10, 0x00, 0x27, 0x99, 0x80, 0xEA, 0x7A, 0x43, 0xEF, 0x6B, 0x10, 0xD5, 0x89, 0x5C, 0x7B, 0x54,
+    0xB3, 0x0E, 0x37, 0xDB, 0x90, 0xA9, 0xE1, 0xE1, 0xC5, 0x62, 0x63, 0x97, 0xA0, 0x67, 0xED, 0xF5,
+    0xD2, 0x10, 0xC6, 0x71, 0xEC, 0x52, 0x43, 0x91, 0x30, 0x2C, 0x5D, 0xEA, 0x3D, 0x38, 0x9A, 0xC5,
+    0x3A, 0xC1, 0x8B, 0x14, 0x05, 0x3D, 0x19, 0x54, 0x80, 0x25, 0x47, 0xE3, 0x04, 0x79, 0xFE, 0x57,
+    0xDD, 0xD0, 0x17, 0xB6, 0x1B, 0x7A, 0xFA, 0xD4, 0x86, 0x76, 0xDA, 0xC9, 0x24, 0x13, 0x8C, 0xB3,
+    0xAE, 0x8B, 0x2A, 0x82, 0x23, 0x47, 0xE5, 0x55, 0x4D, 0x36, 0xAE, 0x2E, 0x8F, 0x2E, 0x6D, 0x5C,
+    0x11, 0x22, 0x61, 0x93, 0x79, 0x76, 0xF6, 0x68, 0x8D, 0x75, 0x09, 0xDA, 0xC9, 0x5C, 0xC7, 0xB5,
+    0x8B, 0x82, 0x10, 0xA5, 0x25, 0xC0, 0xD3, 0x1C, 0x61, 0x1C, 0x27, 0xF4, 0x9E, 0x13, 0xBA, 0x52,
+    0x29, 0x1D, 0xAE, 0x26, 0x4A, 0xC2, 0x30, 0xAD, 0x55, 0xD1, 0xBA, 0xA8, 0x3D, 0x44, 0x96, 0x09,
+    0x60, 0x5D, 0xA3, 0xDA, 0x57, 0x3A, 0x85, 0x8A, 0xE0, 0x24, 0x32, 0xB4, 0x07, 0xAB, 0x4B, 0x64,
+    0x67, 0x7F, 0xC3, 0x4D, 0xAA, 0x54, 0x38, 0xE9, 0xB7, 0xFE, 0xBD, 0x9D, 0x23, 0x06, 0x5B, 0x57,
+    0x60, 0x9C, 0xE4, 0xD4, 0x2F, 0x82, 0x73, 0x17, 0x5A, 0x7A, 0x91, 0x1A, 0x26, 0x10, 0x2C, 0x30,
+    0x93, 0xB5, 0xD3, 0x30, 0x9B, 0x8B, 0xB3, 0x0A, 0xFA, 0x35, 0x2F, 0xD2, 0x70, 0x35, 0x81, 0xEA,
+    0xAD, 0x02, 0xF3, 0x8C, 0xB7, 0xE3, 0xF0, 0xE3, 0xA0, 0x9D, 0xFA, 0x38, 0x2A, 0x2F, 0x98, 0x44,
+    0x6A, 0x98, 0x9B, 0x02, 0x43, 0xD8, 0x71, 0x20, 0xB4, 0x53, 0x9C, 0x94, 0x17, 0x74, 0x32, 0x36,
+    0x9C, 0xDB, 0x0D, 0x1D, 0xAA, 0x49, 0x22, 0x02, 0xE6, 0xBE, 0xB4, 0xB2, 0xB9, 0x61, 0xF3, 0x71,
+    0x86, 0x64, 0xEF, 0xD1, 0x45, 0x91, 0x20, 0x33, 0x38, 0x0A, 0x62, 0x58, 0xAA, 0xDF, 0x96, 0x13,
+    0x08, 0xEB, 0x30, 0xCC, 0x7A, 0x86, 0x8C, 0x83, 0x07, 0xA8, 0x02, 0xA0, 0x5F, 0x8D, 0x40, 0x77,
+    0x33, 0x61, 0x0D, 0x54, 0x6A, 0x02, 0x50, 0x1C, 0x51, 0xC5, 0x08, 0xAC, 0x5B, 0x5D, 0x99, 0xDF,
+    0xA5, 0x5F, 0x59, 0xF0, 0x1D, 0xC3, 0x86, 0x06, 0xBF, 0xB3, 0x5D, 0xAB, 0x44, 0xEF, 0x61, 0x9D,
+    0x4C, 0xD0, 0x4B, 0x5B, 0xA0, 0x02, 0x38, 0x89, 0x74, 0xEC, 0x48, 0x77, 0xEC, 0xC8, 0x28, 0x53,
+    0x65, 0x9F, 0xF5, 0x1E, 0x76, 0xEA, 0x12, 0xF4, 0x2C, 0x8E, 0x1F, 0x69, 0x59, 0x97, 0x75, 0x57,
+    0x0E, 0xED, 0x2C, 0xB8, 0x96, 0x62, 0x48, 0x30, 0x24, 0xD7, 0xB5, 0x51, 0x57, 0x4D, 0xE5, 0xA3,
+    0x2F, 0xB5, 0x78, 0xEE, 0x3A, 0x67, 0x32, 0xAD, 0x15, 0x49, 0xCA, 0x8A, 0xB9, 0x77, 0x8E, 0x38,
+    0x35, 0x86, 0xBE, 0x21, 0xA3, 0x28, 0x32, 0x75, 0x49, 0x26, 0x15, 0xBA, 0x38, 0x7C, 0x64, 0x83,
+    0x26, 0x67, 0x4D, 0x8E, 0xFA, 0xC6, 0xF9, 0x2A, 0x34, 0x17, 0x60, 0x08, 0x72, 0x52, 0xD5, 0x21,
+    0x31, 0x35, 0xCC, 0x47, 0x93, 0xFE, 0xE9, 0x1C, 0xAC, 0xA9, 0x06, 0x1D, 0x9B, 0xB1, 0xA5, 0x3E,
+    0x96, 0x83, 0x75, 0x85, 0x92, 0x0D, 0xBB, 0xDC, 0x52, 0xA5, 0xB6, 0xA8, 0x20, 0xB2, 0xF2, 0x22,
+    0xF5, 0x35, 0xFF, 0x2A, 0xE9, 0xF9, 0x93, 0x39, 0x58, 0xC3, 0xB2, 0xAD, 0xF1, 0x70, 0x17, 0x1D,
+    0x34, 0x47, 0xE8, 0xB2, 0x46, 0x0A, 0xB6, 0xCE, 0xA7, 0xA5, 0x3A, 0x9F, 0x32, 0x8E, 0xE5, 0x10,
+    0x8D, 0x2D, 0x39, 0x83, 0xF4, 0x58, 0x56, 0x89, 0x00, 0xE3, 0xD1, 0x71, 0x06, 0x39, 0x49, 0x66,
+    0x28, 0x4E, 0xD8, 0x54, 0x90, 0xD0, 0x5E, 0x62, 0xA8, 0x19, 0xD9, 0x68, 0x8F, 0xF7, 0xCB, 0x66,
+    0x58, 0x2E, 0x03, 0xB3, 0xE4, 0xB7, 0x1C, 0x1D, 0xFA, 0x80, 0x96, 0x07, 0xA3, 0x66, 0x12, 0xE4,
+    0xA4, 0x7F, 0xBA, 0x2F, 0x6A, 0x21, 0x11, 0xC1, 0xD3, 0x4B, 0xCF, 0x02, 0x72, 0x69, 0x19, 0x37,
+    0xCD, 0xE8, 0xB8, 0x08, 0xD2, 0x91, 0x41, 0x85, 0xAE, 0x61, 0x6D, 0x2D, 0x23, 0x44, 0x75, 0xFD,
+    0xD6, 0x44, 0xAC, 0x05, 0xA2, 0xFC, 0xFE, 0x68, 0xE6, 0xCA, 0x6C, 0x1E, 0x2D, 0xA7, 0x23, 0x8F,
+    0x6A, 0x75, 0x66, 0x8E, 0xEB, 0x22, 0xDE, 0xA8, 0x9C, 0x5B, 0x8B, 0x20, 0x37, 0xAC, 0x89, 0x80,
+    0x7A, 0x96, 0xA9, 0xAE, 0x4C, 0xC8, 0x57, 0x66, 0x6D, 0xA6, 0x9C, 0xC5, 0x4F, 0xFC, 0x26, 0x45,
+    0xA1, 0x2D, 0x50, 0xB1, 0xAE, 0xBC, 0x63, 0x1C, 0xE3, 0xDE, 0x57, 0x49, 0xBC, 0x65, 0x28, 0xA7,
+    0x63, 0x99, 0x04, 0x2B, 0x31, 0xFE, 0x28, 0xC5, 0xF4, 0xB3, 0x93, 0x9C, 0xDC, 0x27, 0x92, 0x9C,
+    0x86, 0xF5, 0xF0, 0xBC, 0x39, 0xDC, 0x6D, 0x0F, 0x3F, 0x47, 0x28, 0xCE, 0x60, 0x44, 0x77, 0x1D,
+    0xA8, 0x89, 0xE2, 0x58, 0x73, 0xF2, 0x2B, 0x63, 0xBA, 0x29, 0xDF, 0x4E, 0x95, 0xDE, 0xEE, 0x00,
+    0x91, 0x64, 0x3E, 0x0B, 0x18, 0x67, 0x99, 0xD0, 0x45, 0x45, 0x7A, 0x10, 0x7C, 0x8F, 0x93, 0xF2,
+    0xBD, 0xEF, 0x52, 0x53, 0x1A, 0xC2, 0x38, 0x3D, 0xF7, 0x4B, 0x17, 0x1F, 0x4C, 0x0D, 0xC1, 0x33,
+    0x9C, 0x54, 0xA1, 0xA7, 0x87, 0x65, 0x52, 0x11, 0x0D, 0x33, 0x4E, 0xD6, 0x65, 0xD1, 0x10, 0x1C,
+    0xD1, 0x12, 0x1C, 0x21, 0x4A, 0x43, 0xAC, 0x14, 0x36, 0x99, 0xDA, 0x02, 0xC8, 0xFC, 0xED, 0x02,
+    0x74, 0x5C, 0xAB, 0x55, 0x90, 0x41, 0x91, 0x64, 0xEA, 0xBD, 0x8A, 0x5D, 0x1A, 0xBC, 0x0A, 0x22,
+    0xE9, 0x45, 0x05, 0x99, 0xF4, 0xAC, 0xA2, 0x4A, 0xDA, 0x75, 0x64, 0x30, 0x4E, 0x90, 0xB3, 0x75,
+    0xB0, 0x65, 0x3C, 0x16, 0x50, 0xFB, 0xCC, 0xDD, 0x00, 0x34, 0x6C, 0xC6, 0xA6, 0x7C, 0xC6, 0x6E,
+    0x48, 0xBF, 0xEA, 0x6E, 0xC0, 0xC1, 0xEA, 0x15, 0x96, 0x9B, 0xB4, 0x57, 0x3D, 0x1D, 0xC9, 0xB9,
+    0xDE, 0x77, 0xB9, 0x2D, 0x0D, 0x47, 0xBD, 0xE8, 0x45, 0x64, 0x95, 0xA0, 0xAF, 0x10, 0x32, 0x59,
+    0x07, 0xCB, 0x50, 0x25, 0x23, 0x39, 0xA3, 0xBF, 0x49, 0x34, 0xEC, 0x3D, 0x86, 0x85, 0x93, 0xC8,
+    0x5D, 0x82, 0x76, 0x7A, 0x91, 0xA9, 0x25, 0xAC, 0xEB, 0x57, 0x66, 0x5A, 0x17, 0x57, 0xA1, 0x92,
+    0x01, 0x98, 0xAD, 0x5F, 0x59, 0xC6, 0x86, 0x5D, 0xDC, 0xB6, 0x75, 0x9B, 0x3D, 0xA9, 0x6F, 0xC9,
+    0x9E, 0x1C, 0xBC, 0x75, 0xDA, 0x5B, 0x67, 0x17, 0xFB, 0x23, 0xCE, 0x86, 0xD7, 0x9C, 0xE6, 0x39,
+    0xA7, 0xF2, 0x50, 0x2B, 0x40, 0x35, 0xFB, 0x3B, 0xFB, 0xE8, 0x9D, 0x1E, 0xA1, 0x9F, 0x5A, 0x73,
+    0x5C, 0x60, 0xD3, 0x31, 0xDF, 0xB5, 0x71, 0xA2, 0x80, 0xE8, 0xD7, 0x10, 0x57, 0x90, 0x09, 0xC3,
+    0xAC, 0x17, 0xD8, 0x27, 0x88, 0xA6, 0xA8, 0x58, 0x79, 0x82, 0xEA, 0x83, 0x0C, 0xE8, 0xD7, 0x3C,
+    0x40, 0x3B, 0x56, 0xF7, 0x62, 0xC7, 0x79, 0x4D, 0x53, 0xD7, 0x61, 0x75, 0x1C, 0xCB, 0x4D, 0x4A,
+    0x53, 0x4B, 0xE0, 0x76, 0x1B, 0x01, 0x4D, 0x57, 0xC1, 0x61, 0x5B, 0xC6, 0xDF, 0x44, 0x97, 0x4E,
+    0x03, 0x18, 0xD6, 0xE4, 0xA6, 0x52, 0xE5, 0x6C, 0x9B, 0x80, 0x61, 0x69, 0x33, 0x7A, 0xCF, 0x49,
+    0x05, 0xD8, 0x2B, 0x19, 0xDA, 0x89, 0xD2, 0x87, 0x86, 0x50, 0xDE, 0x38, 0x99, 0x60, 0x5E, 0x26,
+    0x06, 0x5F, 0xAB, 0x19, 0x3A, 0x15, 0x7A, 0x2F, 0x0B, 0x8C, 0x33, 0x4E, 0x47, 0x51, 0x1A, 0x36,
+    0x5C, 0x94, 0x97, 0x49, 0x71, 0xB2, 0xAE, 0xF7, 0xA6, 0x88, 0x0C, 0x73, 0x85, 0x69, 0xF0, 0xE0,
+    0x43, 0xD7, 0x3C, 0x47, 0x91, 0xA9, 0x5F, 0x4D, 0x50, 0x0C, 0x34, 0x33, 0x06, 0x5E, 0x61, 0x01,
+    0x4C, 0xEE, 0xE8, 0x01, 0xFA, 0x81, 0x23, 0x04, 0x27, 0x13, 0xB1, 0x72, 0x36, 0x31, 0x2C, 0x2A,
+    0xB4, 0xB9, 0x52, 0x17, 0xF5, 0xAC, 0xBC, 0x4C, 0xDA, 0xF5, 0xBE, 0x8B, 0xDA, 0xF5, 0x5E, 0x79,
+    0xED, 0x06, 0xDF, 0x7B, 0xED, 0x8C, 0xD7, 0xB3, 0x76, 0xF4, 0xC6, 0xE9, 0xCB, 0xF4, 0x1C, 0x87,
+    0xAB, 0x7C, 0x9F, 0x18, 0xDE, 0xBB, 0xF9, 0x61, 0x42, 0xCF, 0x57, 0x19, 0xA1, 0xF8, 0x34, 0x3D,
+    0x14, 0x05, 0x67, 0x74, 0x59, 0x70, 0x42, 0x65, 0xEA, 0x63, 0x38, 0xCA, 0xD3, 0x1A, 0x48, 0xAF,
+    0xEB, 0xCF, 0xD2, 0xAC, 0xDC, 0x93, 0x96, 0x37, 0xD0, 0xD6, 0xA2, 0x2B, 0x49, 0x90, 0x59, 0x26,
+    0x59, 0xBA, 0xD8, 0x52, 0xC5, 0x96, 0x2A, 0x88, 0xA2, 0x7C, 0x97, 0xFB, 0x1B, 0x36, 0x0D, 0x64,
+    0xD0, 0xA4, 0xD3, 0xBC, 0xBE, 0xF5, 0x2B, 0x0D, 0x01, 0x68, 0x92, 0xCD, 0x40, 0x5B, 0x48, 0x40,
+    0xF0, 0x0D, 0x02, 0x82, 0x4D, 0x45, 0xFD, 0x04, 0x64, 0x6A, 0xF8, 0xBF, 0x8E, 0x5D, 0x6C, 0x49,
+    0xAF, 0x82, 0x20, 0x93, 0xF2, 0xA2, 0x3C, 0x98, 0x7A, 0x2F, 0x92, 0x48, 0x43, 0xFD, 0xBD, 0x88,
+    0xDC, 0x25, 0x3D, 0x0B, 0xDA, 0xA0, 0x5D, 0x43, 0x2E, 0xC6, 0xC1, 0x70, 0xBC, 0x85, 0xCB, 0x0F,
+    0x3D, 0x63, 0xE0, 0x79, 0x68, 0xB7, 0xD6, 0x73, 0x55, 0x64, 0x80, 0x75, 0xBA, 0x3C, 0xE7, 0xC1,
+    0xC9, 0x2E, 0xD8, 0x07, 0x4F, 0x73, 0x02, 0xC0, 0x1A, 0x15, 0xA3, 0xA8, 0x4C, 0xFC, 0x8B, 0xE5,
+    0xF0, 0x07, 0x10, 0x15, 0x6B, 0x8A, 0x6A, 0x44, 0xAF, 0x7F, 0x64, 0x52, 0x1E, 0x40, 0x17, 0x95,
+    0x07, 0xA0, 0x82, 0x0A, 0xF5, 0x4F, 0x5C, 0xF7, 0x2C, 0x6E, 0x43, 0xEF, 0x25, 0xFF, 0xEA, 0x45,
+    0x0C, 0x4B, 0xB5, 0x89, 0xE6, 0x5A, 0xD2, 0xC4, 0xD5, 0xBA, 0x48, 0xC7, 0xF1, 0x9E, 0x48, 0x18,
+    0x38, 0xF6, 0x5E, 0x92, 0xB0, 0x93, 0x61, 0x10, 0x45, 0xF0, 0xAF, 0x9C, 0x0A, 0x83, 0x07, 0xB4,
+    0xE3, 0x88, 0x86, 0xAC, 0xA5, 0x01, 0xD7, 0x92, 0xBE, 0x0B, 0xF8, 0xD7, 0xE5, 0xA0, 0xE6, 0xDD,
+    0x57, 0x2A, 0x32, 0xEC, 0x64, 0x97, 0x47, 0x45, 0x6E, 0x48, 0xAF, 0x7C, 0x4B, 0x3A, 0xE3, 0x9A,
+    0x3A, 0xDC, 0x95, 0x37, 0x47, 0xB7, 0x16, 0x9F, 0xEB, 0x2A, 0x19, 0x78, 0x01, 0x86, 0x37, 0x97,
+    0xCD, 0x5E, 0x3B, 0xE3, 0xD1, 0xB0, 0xF3, 0x10, 0xE5, 0x21, 0x5F, 0xB9, 0xB1, 0x8A, 0x0C, 0x6B,
+    0x71, 0xA3, 0x37, 0x3F, 0x8C, 0xB0, 0xAF, 0x7D, 0x98, 0xC0, 0xFE, 0xED, 0xD4, 0x96, 0xE1, 0x6A,
+    0x92, 0x49, 0x5F, 0x4E, 0x2A, 0xEA, 0xCB, 0xB9, 0xF7, 0xFA, 0x72, 0xD6, 0x8B, 0x79, 0xA2, 0x18,
+    0x67, 0x4F, 0x97, 0x4A, 0x14, 0x93, 0x74, 0x00, 0x13, 0xD0, 0x5F, 0x9B, 0x21, 0x52, 0x06, 0xEC,
+    0x99, 0x05, 0xCA, 0x6F, 0xAA, 0xD4, 0x54, 0xAD, 0x1C, 0xDA, 0x62, 0xCD, 0xA4, 0x5F, 0xFB, 0x30,
+    0x76, 0xB1, 0xE8, 0x97, 0xD9, 0x5F, 0x4D, 0xFA, 0x47, 0x79, 0x78, 0x25, 0x0D, 0x97, 0x33, 0xF4,
+    0x0C, 0x1D, 0x21, 0xAA, 0x31, 0x63, 0x1C, 0x98, 0xD0, 0x45, 0x0C, 0x74, 0xE0, 0x28, 0x4A, 0x82,
+    0x0A, 0xE0, 0x43, 0x0E, 0x44, 0xFF, 0x7E, 0x46, 0xEF, 0x45, 0xEE, 0xE7, 0x96, 0x87, 0xF6, 0xEF,
+    0x4A, 0x35, 0x06, 0x16, 0x41, 0xB2, 0x96, 0xF0, 0xA9, 0xF5, 0x57, 0xAF, 0x67, 0x0B, 0x3B, 0x71,
+    0x78, 0xD5, 0xAB, 0x30, 0xBC, 0x9D, 0xEC, 0x48, 0x99, 0xF4, 0x2B, 0xB1, 0xF7, 0x7C, 0x3A, 0x9A,
+    0x27, 0x4A, 0xEF, 0xED, 0xFD, 0x69, 0x78, 0xBB, 0x28, 0xAF, 0xAF, 0x64, 0xE3, 0x28, 0x92, 0x7E,
+    0x2D, 0x2A, 0xAF, 0x1D, 0x0A, 0x04, 0x47, 0x19, 0xA0, 0xF3, 0x9A, 0x28, 0x41, 0xA8, 0x9B, 0x5E,
+    0x24, 0xD8, 0x73, 0x4E, 0x2D, 0x22, 0x19, 0x18, 0x92, 0xB9, 0x3D, 0xD2, 0x2F, 0x8B, 0xFE, 0x3B,
+    0x5A, 0xBE, 0x5C, 0x44, 0xCE, 0xEC, 0xC2, 0xF0, 0xF3, 0x5F, 0xA4, 0xE1, 0x65, 0x0E, 0xAF, 0x06,
+    0xAA, 0xC0, 0xFE, 0x6A, 0x34, 0x57, 0xA2, 0xF9, 0xFE, 0xD5, 0xDC, 0x2F, 0x84, 0x20, 0x59, 0x20,
+    0xB9, 0x52, 0xC7, 0x2B, 0x5F, 0x86, 0x01, 0x0D, 0xD7, 0x14, 0x24, 0x8E, 0x80, 0x79, 0xAA, 0x60,
+    0x85, 0xAF, 0xD5, 0xA4, 0x6D, 0xC8, 0x00, 0x74, 0x64, 0xAE, 0x85, 0x91, 0x01, 0xFD, 0x46, 0xE2,
+    0x08, 0xFB, 0x97, 0xC9, 0x4C, 0x60, 0x17, 0xCD, 0xD4, 0x16, 0x15, 0x8C, 0x13, 0x49, 0x79, 0xE3,
+    0xBA, 0xD4, 0x7B, 0xED, 0x54, 0x18, 0xBC, 0x76, 0x83, 0xD7, 0x8B, 0x76, 0x7A, 0xD1, 0xB3, 0x76,
+    0xD0, 0xEB, 0x6A, 0x4A, 0x18, 0x48, 0x0F, 0xB5, 0x68, 0x07, 0xE9, 0xED, 0x08, 0xF1, 0x8B, 0x0C,
+    0xB4, 0x0C, 0x40, 0xCF, 0x84, 0x1A, 0xB9, 0x23, 0x89, 0x36, 0x59, 0x3D, 0x8A, 0x48, 0x3D, 0x75,
+    0xBE, 0xE8, 0x49, 0xBD, 0x95, 0x07, 0x37, 0x5C, 0x4E, 0x83, 0xD3, 0x4F, 0xA5, 0xC1, 0x41, 0xCF,
+    0x96, 0xA4, 0x13, 0x49, 0x55, 0x0C, 0xEB, 0x48, 0x72, 0xEA, 0x52, 0x35, 0xA3, 0x38, 0x69, 0xA7,
+    0x12, 0x54, 0x68, 0xAA, 0x25, 0x03, 0xE5, 0xAB, 0xE1, 0x6C, 0x9E, 0xF1, 0x68, 0x79, 0xF8, 0x1C,
+    0x13, 0xD6, 0xB9, 0xAB, 0x7B, 0xAC, 0x52, 0xF4, 0xC9, 0x0C, 0x99, 0xBA, 0xC8, 0x87, 0x3C, 0xEC,
+    0x44, 0xE5, 0x09, 0x15, 0xF4, 0x5B, 0x54, 0x1E, 0xBC, 0x3F, 0x0D, 0x9E, 0xE8, 0xBD, 0x7D, 0xB2,
+    0xA8, 0xD0, 0x50, 0x79, 0x3D, 0x73, 0x1C, 0x7E, 0x42, 0x91, 0x54, 0x10, 0x59, 0xCF, 0xC6, 0xD9,
+    0x49, 0xBF, 0x9A, 0xBA, 0xD4, 0x45, 0xA0, 0x74, 0x24, 0x47, 0x73, 0x1F, 0x49, 0x37, 0xCC, 0x86,
+    0x9C, 0x95, 0xEF, 0xFC, 0x30, 0x8B, 0x84, 0xDC, 0xCF, 0x28, 0x18, 0xBE, 0xBF, 0xC0, 0x90, 0x5C,
+    0x30, 0x90, 0xCC, 0xD5, 0xB6, 0x74, 0x22, 0x3F, 0x74, 0x93, 0xA1, 0x29, 0xF2, 0xA3, 0x54, 0x60,
+    0xEF, 0x4F, 0x76, 0x70, 0xC3, 0xCB, 0x59, 0xBF, 0xEA, 0x95, 0xA7, 0x7A, 0x2B, 0x89, 0x68, 0xBE,
+    0x19, 0x4C, 0x93, 0xF5, 0xE5, 0x54, 0xCB, 0x1C, 0xDD, 0x01, 0x3C, 0xDA, 0x26, 0x40, 0xAB, 0x04,
+    0xF4, 0x9C, 0x00, 0x55, 0xC3, 0xDB, 0x63, 0xFD, 0x5A, 0x86, 0x81, 0x0C, 0x50, 0xD7, 0x4D, 0xC2,
+    0xED, 0xC7, 0xAC, 0xC0, 0x2E, 0xD5, 0x94, 0xB0, 0xE6, 0x90, 0x33, 0x04, 0x0B, 0x6A, 0x44, 0x5D,
+    0x92, 0xE3, 0xBA, 0x75, 0x6B, 0xF6, 0xAF, 0x5E, 0xB6, 0xA9, 0xBC, 0x33, 0x70, 0xAE, 0x16, 0x32,
+    0x1B, 0x3B, 0x32, 0xA1, 0x27, 0x27, 0xE8, 0xEB, 0x9B, 0xB2, 0xC1, 0xF5, 0xD7, 0xCA, 0xAC, 0x9F,
+    0xD7, 0x4A, 0x5C, 0xD5, 0xAE, 0xC2, 0x89, 0x09, 0x8F, 0xCB, 0x84, 0xF6, 0xA3, 0x52, 0xA9, 0xA8,
+    0x5F, 0xAE, 0xA5, 0xBA, 0x3C, 0x34, 0x39, 0xB6, 0x73, 0xBF, 0xF1, 0x0B, 0xF5, 0x6B, 0x34, 0xDB,
+    0xE4, 0xD5, 0x16, 0x6A, 0xEC, 0x71, 0x7F, 0x4E, 0x9F, 0x71, 0xFB, 0xEA, 0x4F, 0x6B, 0xC9, 0x77,
+    0xA0, 0xFF, 0xF5, 0xEA, 0x7D, 0x33, 0x13, 0x6A, 0x2E, 0xC0, 0x40, 0x8E, 0x30, 0x0C, 0x9B, 0x4C,
+    0xF7, 0x2E, 0xC8, 0x68, 0x9C, 0x76, 0xC3, 0x5B, 0x05, 0x04, 0x1F, 0x08, 0x32, 0x89, 0xA4, 0xDD,
+    0xB0, 0xF4, 0x9E, 0xE0, 0x68, 0x9E, 0x4E, 0x22, 0xB5, 0x79, 0x58, 0x94, 0x57, 0xDE, 0x8E, 0x66,
+    0xD2, 0x97, 0x73, 0x9B, 0xDB, 0xD2, 0x45, 0x15, 0xFA, 0x30, 0x44, 0x7D, 0x99, 0x4E, 0x73, 0x8D,
+    0xA2, 0xD6, 0xBE, 0x47, 0xE0, 0x4E, 0xFE, 0xCB, 0x8D, 0x1D, 0xBD, 0xF2, 0xCD, 0xED, 0x36, 0xD9,
+    0x66, 0xCD, 0xAD, 0xDB, 0x94, 0xBB, 0x5B, 0x8E, 0x0C, 0x5D, 0xB7, 0x19, 0xFA, 0x9A, 0x9A, 0x53,
+    0xCB, 0xAC, 0x51, 0xA4, 0x2E, 0x2A, 0xAF, 0x67, 0x3E, 0x41, 0x91, 0x55, 0x18, 0x16, 0x3D, 0x53,
+    0x64, 0x91, 0x7A, 0xAF, 0x9D, 0xB9, 0x5C, 0x44, 0x92, 0x49, 0xCF, 0xC6, 0xD9, 0x2B, 0xB9, 0x8B,
+    0x2A, 0x6A, 0xC7, 0x91, 0xDF, 0x4C, 0xCA, 0x0F, 0xDE, 0x38, 0xCA, 0x2C, 0x4A, 0xFF, 0x33, 0x4E,
+    0xAB, 0x7C, 0x26, 0x03, 0x6A, 0x05, 0xF2, 0x35, 0x0F, 0x31, 0x62, 0xAD, 0x68, 0xB2, 0x36, 0x8A,
+    0xDB, 0x06, 0xB7, 0x47, 0x19, 0x40, 0x9F, 0x4C, 0x4F, 0xF9, 0xC8, 0x06, 0xC1, 0x51, 0xA5, 0x5A,
+    0x64, 0x25, 0x42, 0xE4, 0xDE, 0x43, 0xE4, 0xE1, 0xA3, 0x83, 0x6F, 0x67, 0xCD, 0x4A, 0xBE, 0x64,
+    0xD2, 0x24, 0x93, 0x71, 0xE8, 0x92, 0x71, 0x50, 0x51, 0x3B, 0xF4, 0x5E, 0xCF, 0xD0, 0x8B, 0xF6,
+    0xA0, 0xEB, 0xF3, 0xE7, 0xA5, 0xA7, 0x7C, 0x32, 0xE7, 0xA6, 0x0F, 0xD6, 0x0D, 0x6F, 0x17, 0xD8,
+    0x37, 0x6F, 0x1C, 0xD2, 0x90, 0x37, 0x48, 0xBE, 0x57, 0x0E, 0x6B, 0xCE, 0xCD, 0xF4, 0x99, 0x39,
+    0x37, 0x66, 0xAA, 0x2C, 0x10, 0x7E, 0x98, 0xD0, 0xF1, 0x35, 0x0F, 0x73, 0x53, 0x3B, 0xC1, 0x0A,
+    0xF4, 0x12, 0x38, 0x75, 0x47, 0x40, 0xEF, 0x34, 0xD1, 0xE4, 0x2E, 0x42, 0x46, 0xED, 0xD0, 0xFF,
+    0xA4, 0x00, 0xFA, 0x19, 0x0F, 0x14, 0x3B, 0x41, 0xDC, 0x4C, 0x35, 0xA0, 0x5C, 0xED, 0xF2, 0x6A,
+    0x78, 0x3B, 0xA0, 0xCB, 0xDB, 0xCA, 0xB4, 0x0D, 0x8D, 0x93, 0x34, 0x4E, 0x51, 0xBB, 0xE1, 0x86,
+    0x76, 0x7A, 0xD6, 0xCE, 0x4E, 0xDA, 0x11, 0xC3, 0xE5, 0x82, 0xE1, 0x6A, 0x42, 0xFF, 0xE3, 0x88,
+    0xFE, 0x4D, 0x0F, 0xC5, 0x19, 0x8A, 0x0E, 0x8A, 0x63, 0xAD, 0x9E, 0x92, 0x81, 0x9D, 0x3F, 0x3F,
+    0x0B, 0xE8, 0x57, 0x22, 0xA0, 0x1F, 0xF0, 0x80, 0x51, 0x33, 0x70, 0x49, 0x4D, 0x47, 0xA9, 0x28,
+    0xFD, 0x82, 0xA6, 0x18, 0x07, 0x9D, 0x88, 0x96, 0x1F, 0x26, 0xF4, 0xE5, 0x35, 0x0F, 0x3A, 0xED,
+    0x64, 0x02, 0xA1, 0x97, 0x36, 0x37, 0x44, 0x17, 0x54, 0xC4, 0x30, 0x1B, 0x07, 0x73, 0x5F, 0x41,
+    0x53, 0x94, 0x87, 0x8C, 0x76, 0xAA, 0x21, 0x7F, 0x7D, 0x71, 0x01, 0x0A, 0x51, 0x89, 0xCC, 0x47,
+    0x99, 0xFE, 0xD6, 0xAF, 0x11, 0xFD, 0xDD, 0xFF, 0x70, 0x1F, 0xFA, 0xD5, 0x88, 0xFE, 0x6A, 0x82,
+    0x5C, 0x12, 0x5A, 0x7F, 0xEF, 0xB6, 0x01, 0xBF, 0x6E, 0x07, 0x8F, 0xBD, 0xCE, 0x6D, 0x72, 0x3A,
+    0xB6, 0x74, 0x87, 0xB5, 0xEA, 0xFD, 0x9A, 0xF9, 0x03, 0x00, 0x5C, 0x64, 0xE5, 0x63, 0x98, 0x05,
+    0xD6, 0x11, 0x2A, 0x6A, 0x8F, 0x3E, 0x68, 0x27, 0x53, 0x1F, 0x20, 0xB2, 0xF2, 0xA2, 0x74, 0x09,
+    0xE0, 0x7D, 0xB9, 0x61, 0xCD, 0xA9, 0xB5, 0x23, 0x27, 0x8E, 0xE8, 0x7D, 0xBF, 0x6C, 0xF2, 0x82,
+    0xA2, 0x5E, 0xFA, 0x00, 0x41, 0xB0, 0xF7, 0x32, 0x03, 0x9C, 0xF4, 0x6B, 0x01, 0x1C, 0x61, 0x9D,
+    0xFA, 0x30, 0xD5, 0x34, 0xA1, 0xB6, 0x64, 0xA8, 0x0C, 0xE3, 0x61, 0x89, 0x86, 0x3F, 0xB5, 0x01,
+    0x3D, 0x47, 0xE8, 0x5A, 0x20, 0xD0, 0xAD, 0x8B, 0xB2, 0x62, 0xFC, 0xD5, 0x31, 0x80, 0x9D, 0xE3,
+    0x5B, 0x77, 0x9B, 0x0D, 0xBF, 0xB1, 0x64, 0x9B, 0x8B, 0x9B, 0x0D, 0x63, 0xCB, 0xF6, 0x5B, 0x7D,
+    0x36, 0xE7, 0x5C, 0xBF, 0x65, 0x28, 0x3A, 0x4E, 0xF5, 0x6B, 0x08, 0x58, 0xF3, 0x89, 0x7A, 0xD2,
+    0x69, 0xA7, 0x82, 0xCA, 0xE7, 0x82, 0xF2, 0x5D, 0xEA, 0xB2, 0x28, 0x22, 0x89, 0x2C, 0x0A, 0xAC,
+    0xB3, 0xF7, 0xB1, 0x21, 0x06, 0x3F, 0xCC, 0x1C, 0x8D, 0xEB, 0xA2, 0x8C, 0xD6, 0x0D, 0x8B, 0x28,
+    0x28, 0xDA, 0x55, 0xB2, 0xDE, 0xF7, 0x97, 0xB6, 0xC0, 0x38, 0x75, 0xAD, 0x32, 0xE7, 0x04, 0x63,
+    0xCD, 0x44, 0xB2, 0xA9, 0xFA, 0xE1, 0x6B, 0xB6, 0x41, 0x84, 0x24, 0x6A, 0x92, 0x16, 0xA7, 0x9A,
+    0x97, 0xB4, 0x7A, 0x94, 0xB7, 0xA5, 0x40, 0x74, 0xED, 0xDC, 0xED, 0xEB, 0x6C, 0x88, 0x4D, 0x19,
+    0xC5, 0x8D, 0xAC, 0x5C, 0x6B, 0x23, 0x37, 0x53, 0xAD, 0x19, 0x02, 0x7C, 0x99, 0xCB, 0xFA, 0x95,
+    0x44, 0x66, 0x4D, 0x72, 0x21, 0x74, 0xFC, 0xA1, 0x9D, 0x87, 0x08, 0x95, 0x54, 0x42, 0x4B, 0x99,
+    0x00, 0x73, 0x99, 0xA8, 0xBE, 0x41, 0x99, 0xF4, 0x8C, 0x86, 0xCA, 0x03, 0xF6, 0x4A, 0x02, 0xF4,
+    0xC2, 0xB1, 0x32, 0xB7, 0x6A, 0x9E, 0x5B, 0x69, 0xF9, 0xDF, 0x3D, 0x50, 0x01, 0xD2, 0x28, 0xB9,
+    0xDE, 0x78, 0xAC, 0x9E, 0x92, 0x3A, 0xF6, 0xCD, 0x85, 0xED, 0x30, 0xDE, 0x0B, 0x34, 0x55, 0x49,
+    0x38, 0xB9, 0x7E, 0x89, 0xC3, 0x93, 0xFC, 0xCF, 0x06, 0xCF, 0x49, 0x26, 0xE3, 0xC0, 0xC1, 0xD7,
+    0x75, 0xFD, 0x41, 0x41, 0x97, 0xEC, 0x24, 0x4A, 0xEF, 0xEF, 0xA3, 0x20, 0x39, 0xD9, 0xAA, 0x21,
+    0x2A, 0x28, 0x6F, 0x13, 0x80, 0x3F, 0xB8, 0x65, 0x7E, 0xE2, 0x4A, 0xBC, 0x79, 0x07, 0x00, 0x1E,
+    0xA9, 0x12, 0xF9, 0xCF, 0x7D, 0x85, 0xAC, 0xEB, 0x98, 0xDC, 0x53, 0xFF, 0xD4, 0x11, 0x6B, 0x8F,
+    0x15, 0xC7, 0x6A, 0x39, 0x4B, 0x8E, 0x18, 0x18, 0x06, 0x2E, 0xB0, 0xF4, 0x3D, 0x43, 0xCB, 0xF7,
+    0x16, 0x65, 0x93, 0x20, 0x46, 0x74, 0xB9, 0x4B, 0x00, 0x44, 0x51, 0x11, 0x80, 0x28, 0xBD, 0x07,
+    0x20, 0xCA, 0x50, 0xFF, 0xE8, 0xA5, 0xFE, 0x99, 0x81, 0xCA, 0xD8, 0x24, 0x64, 0xD6, 0x73, 0x43,
+    0x74, 0x49, 0xCF, 0x6D, 0x81, 0x8A, 0x7A, 0x16, 0x19, 0x7D, 0xD0, 0x8B, 0x48, 0xD0, 0x7E, 0x08,
+    0x32, 0x81, 0xB3, 0xA2, 0xE5, 0x45, 0x4E, 0x5D, 0x05, 0x98, 0x82, 0x34, 0x8C, 0x80, 0x8D, 0x1D,
+    0xCF, 0x03, 0xCD, 0x1A, 0xAF, 0x6B, 0x7E, 0x50, 0x53, 0x52, 0x46, 0xA0, 0x09, 0xC6, 0x03, 0xDD,
+    0x3F, 0xFC, 0xF2, 0xB4, 0xA1, 0x4E, 0xE2, 0x11, 0x00, 0x68, 0x66, 0x00, 0xB8, 0xFB, 0xD6, 0xB4,
+    0xE4, 0x96, 0xB3, 0x09, 0x30, 0xBC, 0x9F, 0x51, 0x32, 0x75, 0x0C, 0xFA, 0xA3, 0x0B, 0x7F, 0x68,
+    0x7F, 0x42, 0x00, 0xF6, 0xB5, 0x00, 0x34, 0x34, 0x0E, 0x90, 0x99, 0xD8, 0x1D, 0xFB, 0x9B, 0xB1,
+    0x2D, 0xB0, 0x17, 0x17, 0x15, 0x44, 0xB1, 0x93, 0x76, 0xEA, 0x17, 0x6C, 0x08, 0xBE, 0x52, 0x7A,
+    0x3E, 0x94, 0x15, 0x49, 0xFA, 0x9E, 0x1F, 0x92, 0xE8, 0x4B, 0xCB, 0x65, 0xDB, 0xB6, 0x9D, 0xCA,
+    0xC7, 0xB6, 0x64, 0x0D, 0x0D, 0x04, 0x00, 0xF2, 0xFE, 0xA7, 0x1C, 0x80, 0xDB, 0x6E, 0x3B, 0x9E,
+    0x0C, 0x36, 0xCC, 0x0D, 0x55, 0x04, 0xC7, 0x2E, 0xE9, 0x59, 0x24, 0xE8, 0xB7, 0x38, 0xF6, 0x1E,
+    0x94, 0x09, 0xC6, 0xC9, 0xD4, 0xFB, 0x96, 0x18, 0x16, 0xE3, 0x54, 0x02, 0x4F, 0x13, 0x66, 0xA9,
+    0x9C, 0xCE, 0x49, 0x2F, 0xBD, 0xEF, 0x6B, 0x1E, 0x30, 0x63, 0x97, 0x1A, 0x4A, 0x2E, 0x7A, 0x96,
+    0x49, 0xF3, 0x32, 0xA1, 0x3E, 0x2A, 0x54, 0x01, 0xFA, 0xCD, 0x0F, 0x93, 0x75, 0x20, 0xCF, 0x7C,
+    0x9C, 0xD1, 0x32, 0x69, 0x2E, 0x90, 0x9C, 0x2D, 0x01, 0xC5, 0x96, 0x01, 0xD0, 0x51, 0x56, 0x7F,
+    0xBF, 0x4A, 0x6B, 0xC5, 0xCF, 0x1F, 0xAC, 0xD1, 0x2E, 0xB4, 0x37, 0x6F, 0x7A, 0xA0, 0x79, 0x79,
+    0x5E, 0x6E, 0x19, 0xBC, 0xDF, 0xBA, 0x39, 0xBC, 0x4E, 0xD1, 0xF5, 0x3A, 0x78, 0xB5, 0xF0, 0x7A,
+    0xB1, 0x4E, 0x11, 0xB7, 0xC3, 0x6C, 0x92, 0x67, 0xFA, 0xF0, 0xA9, 0xDA, 0x2A, 0xDB, 0x12, 0x73,
+    0x32, 0x6F, 0x3F, 0xDA, 0x80, 0xB8, 0x86, 0xD7, 0xFF, 0xE7, 0x6A, 0x16, 0x89, 0xCA, 0xDA, 0xCF,
+    0xC7, 0xEB, 0xB3, 0x1C, 0x7D, 0x6B, 0x91, 0x76, 0xC7, 0xCB, 0xB9, 0x7C, 0xB2, 0x34, 0xF0, 0xE9,
+    0x5A, 0x1A, 0x58, 0x7C, 0x4E, 0x69, 0x60, 0x68, 0xFA, 0x86, 0x05, 0x2D, 0x3F, 0xBF, 0x3E, 0xC6,
+    0x2A, 0x5B, 0x67, 0x40, 0xCC, 0xB8, 0xA7, 0x73, 0x30, 0x0F, 0x55, 0xF0, 0xDA, 0x14, 0x00, 0x5C,
+    0xD0, 0x7E, 0x90, 0xEE, 0x10, 0xF3, 0x3D, 0xA7, 0xBA, 0x09, 0xFA, 0xCD, 0x95, 0x87, 0xC5, 0x09,
+    0x60, 0x40, 0xFB, 0x7E, 0x82, 0x98, 0xFF, 0x00, 0xDD, 0x04, 0xC8, 0x5B, 0xA6, 0xA4, 0x27, 0x35,
+    0x8B, 0x39, 0x38, 0xFB, 0x27, 0xAB, 0x9A, 0x0D, 0x5F, 0x66, 0x32, 0x2C, 0x66, 0x79, 0xFC, 0x24,
+    0x4E, 0xA2, 0xFB, 0x79, 0x09, 0x8F, 0x76, 0xF3, 0xD7, 0x80, 0xDC, 0x7B, 0x23, 0xAE, 0x86, 0xAF,
+    0xA1, 0xF9, 0x01, 0x04, 0xDF, 0x11, 0xE4, 0xFB, 0xF9, 0x5C, 0x7A, 0x0C, 0xFF, 0x25, 0x00, 0xB4,
+    0xEF, 0x6C, 0xE2, 0x10, 0xEB, 0x8C, 0x7F, 0x5D, 0x6E, 0xBE, 0x1A, 0xE3, 0x8F, 0x6F, 0xD9, 0x3E,
+    0x71, 0xCD, 0x34, 0xAC, 0x15, 0x80, 0x16, 0x7C, 0x45, 0x8C, 0xF5, 0xE4, 0xF1, 0x0E, 0xA0, 0x39,
+    0x8A, 0xA5, 0xFF, 0x92, 0x57, 0xFD, 0x7A, 0xB4, 0x13, 0xE7, 0x75, 0xAC, 0x92, 0xF9, 0xE9, 0x6F,
+    0xCD, 0x00, 0xF0, 0x5F, 0xFD, 0x93, 0xEF, 0xFC, 0x1E, 0x00, 0x9C, 0xC0, 0x79, 0xFC, 0xEA, 0x2F,
+    0xE3, 0x2A, 0xC2, 0x54, 0x04, 0xD0, 0x13, 0x8D, 0xFB, 0x33, 0xA0, 0x9D, 0xBE, 0xB7, 0xC5, 0xE2,
+    0xD8, 0x16, 0xEA, 0x5D, 0x93, 0xB3, 0x01, 0x7C, 0xF5, 0xE2, 0xDA, 0x9B, 0xE9, 0xCF, 0x3E, 0x79,
+    0xBF, 0x7B, 0x36, 0xA1, 0xD2, 0x4D, 0x84, 0x6F, 0x93, 0xDD, 0xA3, 0x00, 0x00, 0xBF, 0x87, 0xC6,
+    0xAF, 0xC2, 0x52, 0x03, 0x7F, 0xB0, 0x7E, 0x0D, 0x43, 0x3F, 0x03, 0xA7, 0x36, 0xE1, 0x5D, 0xBF,
+    0x8E, 0xD2, 0xEF, 0x03, 0xF8, 0x7B, 0xC7, 0x9F, 0xFE, 0x79, 0xAF, 0xAF, 0xAD, 0x72, 0x57, 0xD4,
+    0xA8, 0xA2, 0x3E, 0x5F, 0x17, 0xA0, 0xA0, 0x3B, 0x51, 0x95, 0xDA, 0x3F, 0xFE, 0x55, 0x07, 0xE3,
+    0x0E, 0x00, 0x2D, 0x80, 0x6E, 0x33, 0x53, 0x1B, 0x43, 0x43, 0x3A, 0xC0, 0x8C, 0xF8, 0x21, 0xBE,
+    0x01, 0xB4, 0x23, 0xD4, 0x84, 0x4D, 0x2F, 0x4E, 0xD4, 0x45, 0x73, 0x6C, 0x71, 0xD6, 0xE9, 0xFF,
+    0xC4, 0x9D, 0xFF, 0x06, 0x77, 0x4D, 0x10, 0x11, 0xDC, 0xB8, 0x62, 0x86, 0xF5, 0x6B, 0x83, 0xC2,
+    0xF1, 0x1A, 0xD0, 0x6B, 0x61, 0x03, 0xED, 0x40, 0xDF, 0x14, 0x28, 0x4E, 0x5D, 0x80, 0xCD, 0xD0,
+    0x4E, 0x32, 0xD4, 0x8A, 0x08, 0x22, 0xB5, 0x85, 0xE8, 0x97, 0xFE, 0xE3, 0x08, 0x3B, 0x72, 0x98,
+    0x45, 0x52, 0xC1, 0xA2, 0x96, 0x52, 0xD0, 0x4F, 0x27, 0xE5, 0x9B, 0xAC, 0x9D, 0x99, 0xBA, 0x8F,
+    0x73, 0x9B, 0xA1, 0xAF, 0x79, 0xE5, 0x6B, 0x0D, 0x06, 0xC9, 0x80, 0x82, 0x9E, 0x93, 0x64, 0xB4,
+    0x09, 0x03, 0xAF, 0xD2, 0x81, 0x54, 0xB9, 0x82, 0xC1, 0xD5, 0xE2, 0xA8, 0x48, 0xBF, 0x6E, 0x36,
+    0x4E, 0xDB, 0xCD, 0xBC, 0xFD, 0x86, 0x88, 0xFF, 0x17, 0xC5, 0xBD, 0x4D, 0xAC, 0x66, 0xC5, 0x99,
+    0x26, 0xF8, 0x9C, 0x13, 0x64, 0x9E, 0x71, 0x1E, 0x75, 0x05, 0x0B, 0x90, 0xBB, 0xA0, 0xE4, 0xA8,
+    0xC5, 0x68, 0x54, 0x45, 0xD9, 0x44, 0x2F, 0x6A, 0xE1, 0x05, 0x64, 0x1C, 0x48, 0x69, 0x90, 0xC6,
+    0x52, 0x93, 0x0B, 0xD2, 0x5E, 0xB0, 0xC8, 0xD1, 0xA8, 0x16, 0x35, 0x94, 0x34, 0xB7, 0x16, 0xB3,
+    0xB0, 0x5A, 0x40, 0x1C, 0x48, 0x69, 0x58, 0xB0, 0x70, 0xAA, 0x55, 0x76, 0x2F, 0x7A, 0x61, 0x5A,
+    0xCA, 0xD2, 0xA4, 0x2F, 0x9A, 0xCA, 0x5A, 0x58, 0x1A, 0x4F, 0x77, 0x9A, 0x88, 0xCC, 0x94, 0x0A,
+    0x69, 0x58, 0x70, 0x00, 0x55, 0xA3, 0x19, 0x2F, 0x08, 0x48, 0x3C, 0x74, 0xC1, 0x22, 0x03, 0x38,
+    0x69, 0x22, 0x33, 0x23, 0xE2, 0x99, 0x45, 0x9C, 0xEF, 0xDE, 0x8B, 0xC1, 0x6D, 0xBA, 0xE4, 0x52,
+    0x7F, 0x1F, 0xDF, 0xBD, 0x37, 0xCF, 0x77, 0x7E, 0xE2, 0x8D, 0x78, 0xE3, 0xFD, 0x7D, 0xDE, 0x17,
+    0x14, 0xE8, 0x59, 0x85, 0x21, 0x81, 0x8F, 0x10, 0x23, 0xB9, 0x40, 0x31, 0x00, 0xC7, 0x26, 0x00,
+    0x00, 0xAC, 0x97, 0x71, 0x4C, 0x1D, 0xC1, 0x59, 0x07, 0xB9, 0x8A, 0x02, 0xC2, 0x78, 0x15, 0x87,
+    0xDC, 0x57, 0x38, 0x6F, 0x16, 0x99, 0x44, 0x06, 0xA7, 0x76, 0x4C, 0x10, 0xD6, 0xDB, 0x30, 0x14,
+    0x5D, 0x61, 0x48, 0x9E, 0xE3, 0x6D, 0xAE, 0xB2, 0x68, 0xE2, 0x2E, 0xA8, 0x05, 0x10, 0x19, 0x80,
+    0x9D, 0x01, 0x19, 0x81, 0xBE, 0x02, 0x78, 0x60, 0x06, 0xCC, 0x02, 0x98, 0x05, 0xC7, 0xDD, 0x87,
+    0xD3, 0x48, 0xCE, 0x92, 0x9C, 0x46, 0x12, 0x20, 0xD0, 0x11, 0xE8, 0xF9, 0x13, 0x08, 0x72, 0x11,
+    0xE4, 0x2A, 0xC8, 0x3C, 0xE4, 0xB1, 0x8C, 0x59, 0x54, 0x99, 0x44, 0x95, 0xAB, 0x28, 0x2A, 0x8E,
+    0x59, 0xDF, 0x76, 0x49, 0x93, 0xD1, 0x90, 0xB3, 0x61, 0x02, 0x00, 0xC8, 0x15, 0x20, 0xA0, 0x22,
+    0x0C, 0x29, 0xC8, 0x68, 0x58, 0x61, 0x3C, 0x86, 0x0C, 0xB8, 0xF9, 0xC8, 0xD7, 0x1D, 0xFF, 0xE6,
+    0xBC, 0x26, 0xCF, 0x91, 0xC5, 0xBC, 0x6F, 0x3F, 0xCB, 0x1D, 0xAD, 0x57, 0x9F, 0x65, 0x51, 0x0D,
+    0x79, 0x85, 0x8C, 0x03, 0x13, 0xBA, 0xD3, 0x80, 0xE1, 0x05, 0x08, 0x32, 0xC2, 0x92, 0x7E, 0x24,
+    0x0B, 0x38, 0x9B, 0x20, 0xD7, 0x9E, 0x20, 0x54, 0x54, 0xF1, 0x7F, 0x62, 0x4F, 0xED, 0x82, 0x09,
+    0xCC, 0x82, 0xE4, 0x6C, 0xC8, 0x30, 0x90, 0x2B, 0xDC, 0x87, 0x7B, 0xB3, 0x5C, 0xB1, 0x82, 0x13,
+    0xA0, 0x62, 0xA3, 0x0B, 0x3A, 0x00, 0xA2, 0x00, 0x30, 0x1E, 0xDB, 0x4B, 0x44, 0xE7, 0x61, 0x0D,
+    0x31, 0x92, 0x09, 0xFC, 0x25, 0xBD, 0x4C, 0x43, 0xEE, 0x08, 0xEB, 0x55, 0x18, 0x72, 0x5F, 0x60,
+    0xBD, 0xF1, 0x63, 0x16, 0xF9, 0x2E, 0xCE, 0xF6, 0xD5, 0x77, 0xE2, 0x98, 0x1D, 0xE1, 0x3E, 0xE3,
+    0x22, 0xC9, 0x04, 0x3A, 0x42, 0x7D, 0xC2, 0xD8, 0xD7, 0x4E, 0xCF, 0x66, 0x41, 0x38, 0xB8, 0xFD,
+    0x90, 0x01, 0xB8, 0xB9, 0xCD, 0xCA, 0xEE, 0xD5, 0x17, 0x00, 0x7A, 0xB7, 0x2E, 0xC6, 0x0B, 0x32,
+    0xC1, 0x90, 0xD3, 0x40, 0x46, 0x38, 0x12, 0x32, 0x01, 0xE0, 0xD4, 0x16, 0xAC, 0x0D, 0x3A, 0x02,
+    0xA2, 0xA2, 0xAD, 0x5A, 0x5B, 0x4F, 0x0F, 0x8C, 0x09, 0x00, 0xB7, 0xDB, 0x77, 0x44, 0xA3, 0xB2,
+    0x3F, 0x38, 0xAF, 0x1C, 0x3C, 0x53, 0xE4, 0xF6, 0x19, 0x12, 0x30, 0xAE, 0x20, 0x63, 0x47, 0xC6,
+    0x9E, 0x8C, 0x82, 0xFB, 0xE7, 0x45, 0x69, 0x43, 0x1D, 0x72, 0xBB, 0xA7, 0x5C, 0xDB, 0x47, 0xC5,
+    0xF6, 0x64, 0x1D, 0x36, 0x76, 0xF1, 0xED, 0xB9, 0x30, 0x8D, 0x61, 0x96, 0xA1, 0xDD, 0x24, 0x83,
+    0x1B, 0x43, 0xC9, 0xD8, 0xEE, 0xD2, 0x13, 0x90, 0xA4, 0x17, 0x64, 0xE8, 0xC8, 0x15, 0xBA, 0x5E,
+    0x6C, 0x03, 0xDB, 0x9D, 0xA9, 0x22, 0x30, 0xE6, 0x6D, 0xB4, 0x9C, 0xDA, 0x41, 0xC0, 0xB0, 0xC0,
+    0x32, 0xC3, 0x31, 0x83, 0x1F, 0x5E, 0x00, 0x01, 0x10, 0x38, 0xCE, 0x27, 0xA0, 0x59, 0x60, 0x98,
+    0x61, 0x98, 0xDB, 0x48, 0x8F, 0x8E, 0x36, 0xB6, 0x3B, 0x1E, 0x1D, 0xD9, 0xFA, 0xE5, 0x23, 0xAB,
+    0x00, 0xB8, 0x3F, 0xC1, 0xB0, 0x42, 0x92, 0x71, 0x20, 0xD9, 0xD7, 0x8E, 0x0B, 0x27, 0x95, 0x8C,
+    0x17, 0x54, 0x11, 0xEE, 0xD5, 0x0C, 0xF5, 0x49, 0xC5, 0x98, 0x39, 0xF5, 0x34, 0xFE, 0xE0, 0x2E,
+    0x26, 0x02, 0x3A, 0x75, 0xBF, 0x74, 0x6D, 0x84, 0x9A, 0x19, 0x03, 0x57, 0xA0, 0x9B, 0x00, 0x90,
+    0xEB, 0x40, 0x7A, 0x4D, 0x82, 0x1F, 0x5E, 0x10, 0xA5, 0x3D, 0xD4, 0x7A, 0xF4, 0xE4, 0x24, 0xC9,
+    0xC9, 0x90, 0x1D, 0xCF, 0xD6, 0x31, 0xCB, 0xAC, 0x83, 0x8E, 0x9C, 0xEC, 0xB5, 0xDC, 0x51, 0xC5,
+    0x31, 0x03, 0x26, 0x00, 0x9C, 0x20, 0x73, 0xFF, 0x21, 0x17, 0xC9, 0x0A, 0xC3, 0x00, 0x77, 0xAB,
+    0x2D, 0x9F, 0x5E, 0xFA, 0x02, 0xBB, 0x74, 0x84, 0xF1, 0x32, 0x41, 0xAE, 0x22, 0x0B, 0x02, 0x6E,
+    0xB6, 0xB3, 0xF3, 0x10, 0x79, 0x4C, 0x2A, 0x02, 0x66, 0xE1, 0xA9, 0x02, 0x74, 0x94, 0x91, 0x33,
+    0x20, 0x3F, 0xA6, 0x0E, 0x00, 0xDC, 0xA5, 0x8F, 0x32, 0x00, 0x41, 0x12, 0x00, 0x2C, 0x19, 0x00,
+    0xA8, 0x3B, 0x95, 0x00, 0x44, 0xB5, 0xAF, 0x47, 0x00, 0x7C, 0x2D, 0x71, 0x06, 0x74, 0xE4, 0x63,
+    0x19, 0x18, 0x8A, 0x8C, 0x66, 0x01, 0x38, 0xB3, 0x27, 0x60, 0xA2, 0x8A, 0xEA, 0xF6, 0x2C, 0x73,
+    0x5F, 0xC1, 0xDC, 0x73, 0x32, 0xCB, 0xC8, 0xD9, 0x2E, 0x22, 0xC3, 0xB4, 0x5D, 0x0F, 0x36, 0xC9,
+    0x25, 0x23, 0x80, 0x8D, 0x17, 0xB7, 0xBD, 0x86, 0x43, 0x46, 0x3C, 0xDC, 0x71, 0xBB, 0x97, 0x59,
+    0x61, 0xE7, 0x31, 0x0B, 0x2E, 0xE3, 0x3A, 0xD0, 0x1B, 0x82, 0x1D, 0x73, 0x77, 0x36, 0xC9, 0x68,
+    0x6E, 0x02, 0xEE, 0x39, 0x8E, 0x19, 0x18, 0xB2, 0x0E, 0x9C, 0x00, 0xFB, 0x76, 0xDD, 0x8B, 0xC0,
+    0x48, 0xB2, 0x02, 0x70, 0x24, 0x17, 0x40, 0xDE, 0xE6, 0x47, 0x05, 0xE8, 0x38, 0xAE, 0x66, 0x01,
+    0x4C, 0xE0, 0xA9, 0x0A, 0xA8, 0x2C, 0xA3, 0x5E, 0x4F, 0x1B, 0x3E, 0x47, 0xB0, 0x0A, 0x06, 0x15,
+    0x46, 0x2E, 0x66, 0xED, 0x0B, 0x54, 0xC6, 0x74, 0x64, 0x38, 0x62, 0x23, 0xC1, 0x36, 0x12, 0xC6,
+    0x6D, 0xAB, 0x6E, 0x24, 0x9C, 0x78, 0xA9, 0xFD, 0xBE, 0x9F, 0x2B, 0x4C, 0x93, 0x40, 0x19, 0xB7,
+    0x9F, 0xE4, 0x74, 0x37, 0xEC, 0xD2, 0x98, 0x4F, 0x34, 0x86, 0x3F, 0xF6, 0x32, 0x31, 0xB0, 0xA2,
+    0xE3, 0x2D, 0xC0, 0x31, 0x00, 0xF7, 0x17, 0x00, 0xCE, 0x1F, 0x32, 0xFB, 0x50, 0xC7, 0xBF, 0xBA,
+    0x9F, 0x8F, 0x92, 0x9C, 0x1D, 0x39, 0x8F, 0xAC, 0x13, 0xBA, 0x04, 0xC0, 0x00, 0x18, 0x17, 0xA0,
+    0x4F, 0xC0, 0x03, 0x05, 0x90, 0xDC, 0xF6, 0xFB, 0xEE, 0xB5, 0xC7, 0x65, 0x24, 0x67, 0xC3, 0xD2,
+    0x4F, 0x26, 0xA0, 0xAF, 0x80, 0x59, 0x4E, 0xB8, 0x04, 0xDE, 0x82, 0xE2, 0x82, 0xEF, 0x72, 0xC2,
+    0x98, 0x00, 0xF7, 0x77, 0x93, 0x4E, 0x8E, 0x1C, 0xC9, 0xC5, 0x32, 0x60, 0x88, 0x80, 0x6E, 0x0F,
+    0x51, 0x1E, 0x7F, 0x91, 0x30, 0x72, 0x82, 0x3B, 0xBF, 0xCD, 0xFE, 0x22, 0x2A, 0x64, 0x14, 0xC4,
+    0x90, 0x7B, 0xA2, 0x67, 0xC7, 0x09, 0x7C, 0x8E, 0x33, 0xCC, 0xC2, 0x19, 0x32, 0xD2, 0x63, 0xC8,
+    0xCE, 0xA3, 0xAF, 0x76, 0x01, 0xC8, 0x00, 0x18, 0x46, 0x40, 0xDE, 0xC9, 0xC0, 0x90, 0x39, 0xA3,
+    0xAF, 0x3A, 0x02, 0x7C, 0xAC, 0x00, 0x66, 0xA1, 0x87, 0x8A, 0x3A, 0x62, 0xC8, 0xA2, 0xFE, 0xA4,
+    0xAF, 0x20, 0x67, 0x4E, 0x8A, 0x8B, 0xF1, 0x82, 0x11, 0x9B, 0x38, 0xEC, 0xEB, 0x01, 0xBF, 0x18,
+    0xBF, 0x89, 0x2C, 0x8C, 0x19, 0xBB, 0x59, 0xB7, 0x8B, 0x8A, 0x2A, 0xF5, 0x55, 0x54, 0x98, 0x85,
+    0x5E, 0x14, 0x13, 0x61, 0x5E, 0xCB, 0x18, 0x2A, 0x27, 0x38, 0x2E, 0x90, 0xCC, 0x00, 0x4D, 0x80,
+    0xFA, 0x98, 0xE8, 0x29, 0x13, 0x74, 0x70, 0x1F, 0x9E, 0x2A, 0x82, 0xAB, 0xF1, 0x9A, 0x43, 0x06,
+    0xE3, 0xB6, 0x7E, 0x2A, 0x00, 0x5D, 0x01, 0xA0, 0xFD, 0x26, 0x36, 0x1F, 0x98, 0x61, 0x96, 0x8E,
+    0x93, 0x5C, 0x3B, 0xCE, 0x43, 0x7E, 0x88, 0x73, 0xCF, 0x6F, 0x70, 0x06, 0x5F, 0xA4, 0x87, 0x79,
+    0x8B, 0x7E, 0x47, 0xB5, 0x5D, 0xD0, 0xD3, 0x2C, 0x00, 0xDD, 0xF2, 0x9B, 0xA8, 0x7E, 0xB1, 0xA0,
+    0x5D, 0xA3, 0x22, 0x57, 0x0C, 0xF9, 0x5F, 0x11, 0x7D, 0xFD, 0x7D, 0xB3, 0x80, 0x93, 0xCC, 0xED,
+    0x39, 0xE8, 0x08, 0xE7, 0xF5, 0xBB, 0x6A, 0x15, 0xE5, 0x3F, 0x14, 0x98, 0x77, 0x38, 0x0F, 0x99,
+    0x01, 0xF6, 0xF5, 0x8C, 0xF1, 0x0E, 0x01, 0xD2, 0x43, 0x32, 0xA3, 0xA3, 0x59, 0xA0, 0x3F, 0x23,
+    0x44, 0xB5, 0x2B, 0xCC, 0x2F, 0xE8, 0x45, 0xFE, 0xB4, 0xC0, 0xFE, 0xDF, 0x3A, 0x8E, 0x09, 0x9C,
+    0xB6, 0xC5, 0x5A, 0x05, 0x61, 0x79, 0x95, 0x93, 0xE6, 0xBB, 0x9C, 0x25, 0x13, 0xE7, 0x9E, 0x85,
+    0x1E, 0x32, 0x3A, 0x8F, 0x21, 0xBB, 0x05, 0x3D, 0xED, 0x02, 0xD0, 0xFD, 0xC6, 0xC5, 0x3A, 0x77,
+    0xB8, 0x58, 0x6A, 0xC5, 0x98, 0x45, 0x45, 0x5F, 0xE1, 0x3C, 0x38, 0xC9, 0x04, 0xB3, 0x08, 0xEE,
+    0xB4, 0xC6, 0x4E, 0x8F, 0x39, 0x66, 0x48, 0xD2, 0x83, 0xCC, 0x3B, 0xCD, 0x34, 0x94, 0x8E, 0x1D,
+    0x67, 0x1D, 0x4C, 0x10, 0x45, 0x66, 0x98, 0xB7, 0x08, 0x91, 0x9D, 0x87, 0xBD, 0xB1, 0x62, 0x64,
+    0xD9, 0x48, 0xFB, 0xB4, 0xA2, 0xA3, 0x8A, 0xD0, 0x91, 0x73, 0x5F, 0xC7, 0x0C, 0xB3, 0x98, 0x20,
+    0x72, 0x4F, 0x58, 0x2F, 0x13, 0x0C, 0x63, 0xC7, 0xC7, 0x99, 0xC1, 0x57, 0x59, 0xC1, 0x2B, 0xE4,
+    0x44, 0x0F, 0xE3, 0xDD, 0x02, 0x15, 0xED, 0x82, 0x31, 0x9B, 0x00, 0x51, 0x4D, 0x04, 0xB8, 0x17,
+    0x01, 0x7B, 0x23, 0x02, 0x8A, 0x09, 0x6D, 0xF6, 0x44, 0xB5, 0x1E, 0xE0, 0xE3, 0x09, 0xB0, 0x57,
+    0x09, 0xE8, 0x68, 0x16, 0x8C, 0x49, 0x66, 0x88, 0xD2, 0x71, 0x02, 0x27, 0x13, 0x61, 0xFD, 0x98,
+    0xA1, 0x63, 0xC7, 0x19, 0x96, 0x41, 0x66, 0xC7, 0x45, 0x47, 0xD2, 0xBB, 0xE5, 0x8C, 0xBB, 0xC2,
+    0x09, 0xEE, 0xD5, 0x0A, 0xB8, 0x1F, 0x24, 0x80, 0x36, 0xB6, 0x61, 0x77, 0xE4, 0x8C, 0xBE, 0x5A,
+    0x0F, 0x51, 0x4D, 0x80, 0x28, 0x2A, 0x42, 0x64, 0x99, 0x30, 0xE4, 0x31, 0x63, 0x4C, 0xA2, 0x42,
+    0xAE, 0x3D, 0x01, 0xB3, 0xC0, 0x4D, 0x32, 0xC2, 0x2C, 0x43, 0x86, 0x8A, 0x3D, 0x31, 0x64, 0x70,
+    0xEE, 0x2B, 0x1A, 0x1B, 0x44, 0x18, 0xBF, 0x7D, 0xB3, 0x7F, 0x29, 0x83, 0x64, 0xB3, 0xD1, 0x26,
+    0x49, 0x72, 0xFB, 0xA6, 0x62, 0x4C, 0xE0, 0x24, 0xB6, 0x6B, 0xD4, 0xEE, 0x9A, 0xDB, 0xFF, 0xBA,
+    0x62, 0x64, 0xE2, 0x24, 0x58, 0x8D, 0x07, 0x7F, 0x7D, 0xCF, 0xA4, 0x03, 0xD1, 0xDA, 0x04, 0xBB,
+    0xDF, 0x6D, 0x21, 0xB3, 0x0C, 0x19, 0x84, 0x8E, 0x43, 0x06, 0x67, 0x1D, 0x44, 0x01, 0x67, 0x19,
+    0x45, 0x81, 0x6D, 0x0A, 0x9B, 0x5E, 0x92, 0x15, 0xE6, 0x97, 0x67, 0xD7, 0x8E, 0x30, 0x7E, 0xCC,
+    0x1D, 0xA1, 0xC3, 0x58, 0x5F, 0xE2, 0x64, 0x78, 0x2D, 0x83, 0x55, 0x45, 0xC1, 0x75, 0x33, 0x24,
+    0xC0, 0xCD, 0x84, 0x80, 0x0A, 0x00, 0xDC, 0x04, 0xF4, 0x17, 0x1B, 0xED, 0x9C, 0x65, 0x84, 0x61,
+    0x18, 0x32, 0x14, 0xD7, 0x9E, 0x18, 0x58, 0x1A, 0xFD, 0x8D, 0x18, 0xC8, 0xB8, 0x59, 0x7F, 0x2A,
+    0xA2, 0xCD, 0x41, 0x9B, 0x84, 0x36, 0x0B, 0x90, 0x24, 0x0F, 0xBE, 0xAE, 0x18, 0x13, 0xDA, 0x4C,
+    0x6C, 0x57, 0xAB, 0xA3, 0x57, 0x1F, 0x7C, 0x5D, 0x00, 0xE3, 0x9B, 0x08, 0x21, 0x0C, 0xE3, 0x90,
+    0x41, 0x7A, 0x1D, 0x06, 0x12, 0x9C, 0xF5, 0xCD, 0xD3, 0xA2, 0xC0, 0xCD, 0x90, 0x51, 0x14, 0xC0,
+    0x92, 0x11, 0x3D, 0xDB, 0x3E, 0x63, 0x05, 0xCC, 0x2F, 0xCF, 0xAE, 0xE8, 0x08, 0xB3, 0x60, 0xCC,
+    0x1D, 0x01, 0x1D, 0x86, 0x0C, 0x70, 0xD2, 0x01, 0x22, 0xB7, 0xA7, 0x36, 0xD3, 0xAC, 0x69, 0xCC,
+    0xED, 0x97, 0x3D, 0x50, 0x3A, 0x05, 0x00, 0x67, 0x91, 0x01, 0x70, 0x1A, 0x32, 0x00, 0x62, 0xCC,
+    0x40, 0x47, 0x8C, 0x09, 0xE8, 0xD9, 0xB4, 0x42, 0x85, 0xBC, 0x7D, 0x01, 0xA2, 0x40, 0x91, 0xB3,
+    0xC8, 0xD0, 0x64, 0x18, 0x32, 0x0C, 0xB9, 0x8E, 0x09, 0x66, 0xD1, 0x59, 0xAE, 0x30, 0x7E, 0x2C,
+    0x72, 0x85, 0xF5, 0xA2, 0xA8, 0x08, 0x37, 0x8B, 0xAA, 0x22, 0x38, 0x89, 0xAA, 0x03, 0x38, 0x89,
+    0x6A, 0x96, 0x8E, 0x10, 0xC5, 0xF8, 0x8E, 0x3B, 0x35, 0xBA, 0xC9, 0x4A, 0xD9, 0xD4, 0x96, 0x89,
+    0x00, 0x7E, 0xEF, 0xBB, 0x0C, 0x68, 0x16, 0x17, 0x00, 0xC9, 0x0A, 0x00, 0x23, 0x9B, 0x26, 0xBB,
+    0x07, 0x40, 0x9B, 0x65, 0x92, 0x80, 0x26, 0x13, 0xC0, 0x1F, 0xDA, 0x05, 0xA2, 0x80, 0x80, 0x8C,
+    0x43, 0x06, 0xAC, 0x6F, 0x53, 0xEC, 0xB8, 0xC8, 0x55, 0x90, 0x8B, 0xF1, 0x92, 0xBC, 0x42, 0xD8,
+    0xB7, 0xF9, 0x62, 0xEE, 0xAB, 0xA0, 0x0E, 0x32, 0x8D, 0x99, 0x93, 0x59, 0xD4, 0xA7, 0x19, 0x84,
+    0x7D, 0x27, 0x0E, 0xB9, 0xE7, 0xE1, 0x58, 0xEC, 0x02, 0x40, 0x10, 0xC0, 0x6D, 0xB7, 0x02, 0x82,
+    0x9C, 0x01, 0xC9, 0x04, 0x40, 0xD7, 0xE9, 0xA8, 0xDA, 0xEF, 0x5C, 0x46, 0x93, 0xE3, 0x86, 0x09,
+    0xE0, 0xAD, 0x97, 0x20, 0x38, 0x03, 0x43, 0xED, 0xE8, 0x65, 0x1E, 0x19, 0xD5, 0xAA, 0x98, 0x74,
+    0x34, 0xD7, 0xB3, 0x09, 0xF6, 0x5A, 0x36, 0x8B, 0x3B, 0x95, 0xCD, 0x42, 0x91, 0x8D, 0xE7, 0x90,
+    0x8D, 0xE7, 0xB8, 0x9A, 0x85, 0x32, 0x9A, 0x40, 0x13, 0x4C, 0x74, 0xF4, 0xAA, 0x58, 0x62, 0x24,
+    0xEB, 0xFF, 0x28, 0xB8, 0xB9, 0x0B, 0x11, 0x38, 0x6D, 0xE3, 0xE1, 0x63, 0x75, 0x45, 0xC7, 0x8A,
+    0x81, 0x19, 0xB2, 0xDE, 0x05, 0xBD, 0xEA, 0x60, 0x02, 0xB3, 0xBD, 0xC6, 0xE2, 0xAE, 0xA5, 0xEA,
+    0x5E, 0x88, 0xD5, 0xBD, 0x18, 0x8B, 0x7B, 0xF1, 0xE3, 0xEC, 0x5E, 0xFD, 0x34, 0xD9, 0xB7, 0x18,
+    0x0D, 0xE9, 0x15, 0x99, 0x05, 0x99, 0x71, 0xCF, 0x90, 0x8F, 0x98, 0xF1, 0x4D, 0xCD, 0x13, 0xCD,
+    0x07, 0xA8, 0xCE, 0x4B, 0xE2, 0x04, 0x6C, 0xD8, 0xE6, 0x40, 0xAD, 0x9B, 0xF2, 0x17, 0x75, 0x73,
+    0x8B, 0x60, 0x16, 0xA0, 0xE3, 0x04, 0x0C, 0xE5, 0xE0, 0x50, 0x00, 0xC0, 0x05, 0x53, 0xC7, 0x5F,
+    0x5E, 0x82, 0x20, 0x73, 0x73, 0x76, 0x3A, 0xD6, 0x09, 0xD0, 0xD3, 0x66, 0x1B, 0xE0, 0xE7, 0x00,
+    0xC4, 0x0A, 0x08, 0xB7, 0x34, 0xEB, 0xA0, 0x5D, 0x79, 0x38, 0x98, 0xD4, 0x91, 0xDE, 0x30, 0xC9,
+    0xFA, 0xE4, 0xA3, 0x9C, 0x60, 0x02, 0x86, 0x02, 0x58, 0x8F, 0xB1, 0x39, 0x5E, 0x63, 0x02, 0x9C,
+    0xC7, 0xC0, 0xEF, 0x7A, 0xC3, 0xDC, 0x91, 0x5E, 0x70, 0xC5, 0x10, 0x00, 0x03, 0xF4, 0x2B, 0xA0,
+    0x67, 0xBC, 0xBC, 0x42, 0xB2, 0x99, 0xE8, 0x00, 0x34, 0x59, 0x0C, 0x59, 0x2C, 0x99, 0x2D, 0x99,
+    0xBE, 0xE0, 0x06, 0x38, 0xDF, 0xCE, 0xE5, 0x74, 0xE8, 0x35, 0xD6, 0x46, 0xEF, 0x81, 0x47, 0x51,
+    0x2F, 0x60, 0x64, 0x82, 0xE4, 0x0A, 0xC9, 0x23, 0x86, 0xFA, 0x17, 0x5C, 0x8A, 0x83, 0x97, 0xBC,
+    0xCA, 0xC9, 0x2D, 0x5D, 0x66, 0x36, 0x84, 0xBE, 0xC1, 0x1B, 0x4C, 0x82, 0x6F, 0xF3, 0x26, 0xBD,
+    0x89, 0x2A, 0x0F, 0x59, 0xD4, 0x8E, 0x93, 0xF5, 0xD6, 0xEB, 0x38, 0xA6, 0x31, 0xF5, 0x15, 0x9C,
+    0x38, 0x99, 0x45, 0xAE, 0x32, 0x8A, 0x0C, 0x36, 0xB7, 0x2D, 0xEA, 0x38, 0xA6, 0xBE, 0xF6, 0x15,
+    0x9C, 0xF4, 0x4D, 0xB3, 0xC8, 0xB5, 0xE7, 0xF5, 0x0C, 0x42, 0x15, 0xEB, 0x55, 0x84, 0xF3, 0x3B,
+    0xB7, 0x08, 0x80, 0x99, 0x81, 0xE6, 0x1B, 0x6D, 0xD2, 0xED, 0xC0, 0x90, 0xDD, 0x87, 0xF1, 0xE0,
+    0xB9, 0x02, 0x1D, 0x75, 0x10, 0xB5, 0x23, 0xE8, 0x65, 0x54, 0x11, 0x3C, 0x55, 0x30, 0xAE, 0xCE,
+    0xC3, 0xFE, 0x38, 0x42, 0xB0, 0x00, 0x86, 0x33, 0x7A, 0x46, 0x40, 0x95, 0x9D, 0x57, 0x76, 0xD4,
+    0x7B, 0xEB, 0xBF, 0xDC, 0x7B, 0xB3, 0xB3, 0x28, 0xD6, 0x8F, 0xD9, 0x78, 0xB9, 0x1A, 0xAF, 0xA3,
+    0xF1, 0xC6, 0x1B, 0xEF, 0x66, 0xED, 0x09, 0x7D, 0xB5, 0x42, 0xBD, 0x95, 0xA1, 0x7E, 0xB1, 0x42,
+    0xBE, 0x13, 0x21, 0xB9, 0x40, 0xD2, 0x43, 0x72, 0xC2, 0xC8, 0xCD, 0x01, 0xCA, 0x6D, 0xF7, 0x1D,
+    0x75, 0x82, 0x74, 0x6C, 0xDC, 0x21, 0x23, 0x4C, 0x30, 0x4B, 0x4F, 0xB8, 0x59, 0xA6, 0x8E, 0xA0,
+    0x17, 0x79, 0xC8, 0x90, 0xAB, 0x59, 0xA0, 0xDF, 0x24, 0x60, 0x7F, 0x1C, 0x01, 0x72, 0x82, 0x60,
+    0x02, 0x46, 0xFA, 0x6D, 0xF4, 0x26, 0x00, 0xFB, 0xDC, 0xC7, 0x40, 0x66, 0x68, 0x32, 0x36, 0x01,
+    0x22, 0xCA, 0x6E, 0x66, 0xAC, 0xDF, 0x28, 0x1A, 0x12, 0xCC, 0x62, 0xFD, 0x98, 0xB7, 0x78, 0x84,
+    0x8E, 0x22, 0x8B, 0x0C, 0xE3, 0xDD, 0xDC, 0x67, 0x19, 0xA1, 0xAF, 0x56, 0x74, 0xC5, 0x78, 0xA8,
+    0x5F, 0xAC, 0x40, 0x21, 0x20, 0xB9, 0x00, 0xCC, 0x80, 0xE4, 0x04, 0xB8, 0xCD, 0x32, 0xB6, 0xE4,
+    0x3C, 0x90, 0x09, 0x8E, 0x9C, 0xBA, 0xB3, 0x37, 0x4F, 0xFF, 0x9A, 0xDF, 0x0B, 0x1D, 0x60, 0x42,
+    0x47, 0xC8, 0xBC, 0x69, 0x5E, 0x37, 0xDB, 0x05, 0x43, 0x96, 0x09, 0x30, 0x6F, 0x12, 0x4D, 0x5B,
+    0x43, 0x71, 0x05, 0xC0, 0x8A, 0x8D, 0x1C, 0xB8, 0x15, 0x80, 0xE6, 0x0C, 0x0C, 0xCC, 0xD8, 0x99,
+    0x73, 0x9F, 0x56, 0x60, 0xCC, 0x2A, 0xA2, 0xE3, 0xC4, 0x09, 0x26, 0xC8, 0xFA, 0x92, 0xCC, 0xB0,
+    0x7C, 0x94, 0x93, 0x60, 0xB4, 0x01, 0x86, 0x07, 0x0E, 0x4C, 0x93, 0xBB, 0xC6, 0xEF, 0x2C, 0xD8,
+    0xC6, 0x3C, 0xE3, 0xE6, 0x36, 0xC0, 0x2E, 0x32, 0xC3, 0x04, 0x13, 0xA1, 0xA3, 0x5B, 0x20, 0x57,
+    0x4E, 0x90, 0x77, 0xEA, 0xF6, 0x40, 0xC1, 0x08, 0xF4, 0xF4, 0x80, 0xA0, 0xDF, 0xA8, 0xD7, 0x8C,
+    0x80, 0x7D, 0x27, 0xA2, 0xE3, 0xE3, 0xF5, 0x25, 0x51, 0x07, 0x46, 0x99, 0x05, 0xA3, 0x5E, 0x05,
+    0xC3, 0x16, 0x1C, 0x68, 0xCF, 0x33, 0x7E, 0x0B, 0xDD, 0x34, 0xB6, 0xDC, 0x87, 0x26, 0xB3, 0x79,
+    0x8B, 0xE4, 0xB5, 0x6C, 0xC9, 0x64, 0x5F, 0x25, 0xF9, 0x9D, 0x0C, 0x1D, 0xC0, 0x59, 0x14, 0xC8,
+    0x15, 0xC6, 0x83, 0x9B, 0xC6, 0x74, 0xBE, 0xAF, 0x90, 0xA9, 0xE9, 0x52, 0x51, 0x20, 0x23, 0xAC,
+    0xEF, 0x88, 0x21, 0x43, 0x07, 0xB8, 0x59, 0x54, 0xC8, 0x15, 0x66, 0x39, 0xB8, 0xC0, 0x7E, 0xF8,
+    0x32, 0xD3, 0x48, 0x92, 0x33, 0x49, 0xAE, 0x92, 0x9B, 0xD3, 0xA8, 0xE2, 0x81, 0xE5, 0x6E, 0x96,
+    0x83, 0x29, 0xB1, 0x87, 0x53, 0x02, 0x18, 0x52, 0x7D, 0x46, 0x7E, 0x52, 0x1D, 0x69, 0xDE, 0x38,
+    0x7B, 0xF3, 0x54, 0x0B, 0xA0, 0xE8, 0x30, 0x66, 0x51, 0xE0, 0x66, 0xB3, 0xC8, 0x55, 0x64, 0x10,
+    0x6D, 0xE7, 0x8A, 0x0A, 0x37, 0xBB, 0x30, 0x96, 0x3D, 0x9E, 0xB6, 0x64, 0x11, 0x5C, 0xB9, 0xC8,
+    0x32, 0x66, 0xDC, 0x05, 0xE3, 0x37, 0xAF, 0xCC, 0x4E, 0xC0, 0xB8, 0x33, 0xE6, 0x4F, 0xBC, 0x34,
+    0x26, 0xE8, 0x60, 0x16, 0x70, 0xE6, 0x24, 0xCA, 0x90, 0xA1, 0xA2, 0x8A, 0xB0, 0xDE, 0xCD, 0x7D,
+    0x15, 0x05, 0x72, 0x95, 0x11, 0xC6, 0x5B, 0xDF, 0xB1, 0xE3, 0x34, 0xE6, 0x81, 0xFF, 0x96, 0x41,
+    0x92, 0x9C, 0x14, 0x99, 0xA1, 0x78, 0x36, 0x6E, 0xE1, 0x98, 0x23, 0x22, 0xF9, 0xC3, 0x19, 0x1D,
+    0x09, 0x8C, 0x4C, 0x80, 0x61, 0xD8, 0x7C, 0x93, 0x66, 0xED, 0x1C, 0x9C, 0x5F, 0x0E, 0x45, 0x82,
+    0x0E, 0x43, 0x32, 0xCB, 0x98, 0xCC, 0x22, 0x57, 0xEB, 0x65, 0xB4, 0x5E, 0x47, 0x37, 0x9B, 0xE0,
+    0x66, 0xB7, 0xB8, 0xFF, 0xC8, 0xC5, 0x92, 0xDE, 0xD0, 0xF9, 0x31, 0xB9, 0x9D, 0x6C, 0xBC, 0x88,
+    0x8E, 0x19, 0xFD, 0xF6, 0x81, 0x48, 0xC0, 0xB0, 0x36, 0xCA, 0x64, 0x04, 0x64, 0x00, 0xEE, 0x3B,
+    0x3F, 0x26, 0xE8, 0xC0, 0x59, 0x54, 0xB9, 0xC2, 0xBC, 0x41, 0x0C, 0x59, 0x47, 0xD8, 0xAB, 0x15,
+    0x63, 0x32, 0xEF, 0x46, 0x9E, 0x2B, 0x0F, 0xCA, 0xD5, 0x5E, 0x7B, 0x83, 0x43, 0x79, 0x48, 0x47,
+    0x7B, 0x87, 0x55, 0x90, 0x5C, 0x34, 0x59, 0x60, 0xAB, 0xF3, 0x50, 0x63, 0x46, 0x17, 0x39, 0xE3,
+    0x1B, 0x72, 0x45, 0xBF, 0x10, 0xF8, 0xE7, 0x2A, 0xB6, 0x48, 0x0C, 0x4C, 0x80, 0x0E, 0x22, 0x9B,
+    0x65, 0xC8, 0x66, 0x19, 0x93, 0xF5, 0x72, 0xB5, 0x7F, 0xA7, 0xA2, 0xFB, 0x81, 0x8E, 0xEE, 0x75,
+    0x1B, 0xDD, 0x0D, 0x06, 0x4B, 0x2E, 0x86, 0xCE, 0x8F, 0xC5, 0x7A, 0x3C, 0xED, 0x66, 0x7C, 0x9F,
+    0x13, 0x7E, 0x7A, 0x44, 0xB4, 0x1F, 0x44, 0x94, 0xAC, 0xDF, 0x6C, 0x90, 0x5D, 0xE4, 0xA9, 0xC5,
+    0xD7, 0x3E, 0x61, 0xE8, 0x49, 0x7A, 0x43, 0x56, 0xC1, 0xDB, 0x8C, 0x26, 0x08, 0x0E, 0x19, 0x3A,
+    0x3A, 0xDF, 0x53, 0x26, 0x98, 0xC0, 0x49, 0x14, 0x15, 0x61, 0xAF, 0x10, 0x43, 0xD6, 0x01, 0xEE,
+    0x5A, 0x85, 0x4C, 0xCD, 0xD2, 0xDB, 0xC5, 0x0E, 0x45, 0xDE, 0x84, 0xA6, 0x9B, 0x37, 0x29, 0xB6,
+    0x02, 0x22, 0xBB, 0xA5, 0xAB, 0x2C, 0x70, 0xA4, 0x37, 0xC5, 0x46, 0x99, 0x87, 0x3C, 0xD4, 0x4D,
+    0xD8, 0xBB, 0x59, 0x87, 0x4D, 0xFE, 0x97, 0x21, 0x83, 0xFD, 0xAF, 0x1D, 0xCC, 0x43, 0xDE, 0x05,
+    0x24, 0x00, 0x74, 0x2E, 0x6D, 0x71, 0xA6, 0x26, 0xDE, 0x60, 0xAA, 0x5B, 0x21, 0x38, 0x9B, 0x70,
+    0x51, 0x27, 0xB8, 0x17, 0x23, 0xBD, 0xA8, 0xE6, 0xD5, 0x0C, 0xBD, 0xD2, 0xDE, 0xFC, 0x0B, 0x5E,
+    0x23, 0xC9, 0x3C, 0x90, 0xE4, 0xDC, 0x93, 0x3C, 0xBF, 0x31, 0x7E, 0xBB, 0x67, 0x63, 0xFF, 0x66,
+    0x00, 0x99, 0x08, 0x00, 0xF6, 0xD6, 0x93, 0x0B, 0x40, 0x72, 0x02, 0x9A, 0xB1, 0xE8, 0xB8, 0xE0,
+    0x30, 0xB8, 0x0B, 0xC0, 0x96, 0xCD, 0x4A, 0x23, 0xF3, 0xBD, 0xB2, 0xC8, 0x9B, 0xC9, 0x7A, 0xFD,
+    0xD1, 0xF5, 0x0A, 0xEE, 0xBD, 0xB3, 0xEE, 0x65, 0x4B, 0xD2, 0x3B, 0x32, 0x41, 0xD5, 0xBF, 0xDE,
+    0x84, 0x90, 0xF3, 0x40, 0xC7, 0xF9, 0x0F, 0x9A, 0x79, 0x20, 0x48, 0xDF, 0x2C, 0x10, 0xDC, 0x83,
+    0xFF, 0xFA, 0xA4, 0xB9, 0xF9, 0x40, 0x26, 0xB4, 0x5D, 0x72, 0xE4, 0x2E, 0x07, 0x72, 0xF2, 0x9F,
+    0x80, 0x78, 0x91, 0xD1, 0xB6, 0x0F, 0xEC, 0xBC, 0x05, 0x56, 0x65, 0xDC, 0xE2, 0xDB, 0xB0, 0x0C,
+    0x23, 0x2B, 0x48, 0xDF, 0x71, 0x39, 0x12, 0x78, 0xEE, 0x09, 0x98, 0x80, 0xCD, 0x8B, 0xD8, 0xC5,
+    0xA5, 0x13, 0x36, 0x7F, 0xA3, 0x23, 0x60, 0x23, 0x4C, 0xBB, 0xBA, 0xD1, 0x77, 0x18, 0xAF, 0x9A,
+    0x1A, 0x23, 0xD5, 0x16, 0x25, 0xEA, 0xD9, 0x6C, 0xA5, 0x7E, 0x0B, 0x7E, 0xE3, 0x89, 0x23, 0xE7,
+    0x0E, 0x09, 0xC6, 0x0F, 0x05, 0x32, 0x82, 0x6D, 0x07, 0x0E, 0x59, 0x10, 0x30, 0x5E, 0x07, 0x1D,
+    0x01, 0x37, 0xF3, 0x51, 0x4E, 0x00, 0x45, 0x56, 0x09, 0xE8, 0x4B, 0x0B, 0xDB, 0x0D, 0xD9, 0xFE,
+    0x20, 0x03, 0x90, 0x77, 0x9A, 0x35, 0xAF, 0xDB, 0x44, 0x77, 0x24, 0x63, 0xB3, 0xF1, 0xE9, 0x01,
+    0xF0, 0x17, 0x89, 0x33, 0x30, 0x56, 0xFD, 0x26, 0x01, 0xD8, 0xC8, 0xA1, 0x00, 0x03, 0x45, 0xD3,
+    0x88, 0xAB, 0x8A, 0x3A, 0x42, 0x70, 0x76, 0xB3, 0x5D, 0xA0, 0xB3, 0x28, 0xE0, 0xDC, 0xD1, 0xCB,
+    0xD8, 0x13, 0xB2, 0xB4, 0x91, 0x01, 0x38, 0xD3, 0x86, 0x3C, 0x06, 0xED, 0x01, 0xC0, 0x3D, 0x96,
+    0xD0, 0x62, 0x85, 0x00, 0x00, 0xB5, 0x99, 0x82, 0xC7, 0x8E, 0x90, 0xA5, 0x57, 0xD8, 0x59, 0x95,
+    0x9E, 0x61, 0x5C, 0x47, 0x7A, 0xCD, 0x89, 0x3D, 0x13, 0x54, 0x92, 0xD1, 0xBE, 0x0F, 0xB8, 0x2B,
+    0x55, 0x26, 0x60, 0xC8, 0xFA, 0x5D, 0x02, 0x30, 0x6F, 0x57, 0x1B, 0x80, 0x81, 0x8D, 0x0A, 0xDB,
+    0x46, 0x2F, 0x2B, 0x6F, 0x64, 0x00, 0x1C, 0x57, 0xE3, 0x01, 0x13, 0x28, 0x4A, 0x0B, 0xD9, 0x99,
+    0x15, 0x9A, 0xCF, 0xB1, 0x63, 0x12, 0x0C, 0x3A, 0x48, 0xCE, 0x76, 0xED, 0x0B, 0x74, 0x6A, 0x21,
+    0xBB, 0xBB, 0xFE, 0xB1, 0x41, 0xAB, 0x0A, 0x48, 0x72, 0xC5, 0x40, 0x72, 0xEA, 0x79, 0x86, 0x11,
+    0x9C, 0xC6, 0x02, 0xB3, 0x80, 0xB3, 0x8A, 0x30, 0x61, 0xC8, 0x90, 0xA9, 0xAF, 0x10, 0x15, 0x9C,
+    0xC0, 0xD9, 0xF8, 0xA6, 0xEA, 0x54, 0xDC, 0x6D, 0x02, 0x59, 0x80, 0xBF, 0xDE, 0xAB, 0x80, 0x6E,
+    0x0A, 0x83, 0x40, 0xDF, 0xD6, 0x66, 0xFA, 0xAD, 0xA1, 0xAB, 0x16, 0x11, 0xDC, 0x62, 0x28, 0x84,
+    0xBA, 0xED, 0x72, 0x4F, 0x38, 0xAF, 0x83, 0x28, 0xA2, 0xC0, 0x2C, 0xC6, 0x8B, 0x32, 0x64, 0x98,
+    0x65, 0x97, 0x35, 0xF0, 0x80, 0x4E, 0xF8, 0xC6, 0x25, 0xA2, 0x6B, 0xF9, 0xA1, 0x15, 0xE0, 0xC1,
+    0x5E, 0x32, 0x64, 0xDB, 0x89, 0xBB, 0xAD, 0xAE, 0xC9, 0x00, 0x70, 0xE2, 0x8C, 0x21, 0x8B, 0x02,
+    0xE8, 0xA8, 0x22, 0xC0, 0xC9, 0x7A, 0x88, 0xDC, 0x57, 0x40, 0x45, 0xB9, 0x02, 0x6E, 0x36, 0x1E,
+    0xA2, 0x74, 0x04, 0x5A, 0xE0, 0x99, 0xB3, 0x0E, 0x10, 0x05, 0x9C, 0xA0, 0xA3, 0xC8, 0xE8, 0x38,
+    0xAB, 0xD8, 0xED, 0x65, 0x38, 0xFE, 0x80, 0x8B, 0x60, 0x35, 0x15, 0x92, 0x91, 0x0B, 0x0C, 0xE7,
+    0xBB, 0x77, 0x36, 0xB3, 0x0A, 0x07, 0x51, 0xBC, 0xE6, 0x8F, 0x1E, 0x3A, 0x7F, 0x47, 0x79, 0x85,
+    0x01, 0xDD, 0xB6, 0x65, 0x23, 0x64, 0xD9, 0x0B, 0x50, 0xD1, 0x2C, 0x30, 0xC1, 0x2C, 0x30, 0xDE,
+    0x78, 0x38, 0x6F, 0x3D, 0x38, 0xB9, 0xB9, 0x23, 0x38, 0xF5, 0x04, 0xDB, 0xE0, 0xCE, 0xE6, 0x8E,
+    0x60, 0xEA, 0x99, 0x19, 0x05, 0x13, 0xBD, 0x60, 0xBC, 0x67, 0xDB, 0xEB, 0x87, 0xE6, 0x91, 0x9B,
+    0x36, 0xDB, 0xA0, 0xFB, 0xC9, 0x2E, 0x14, 0xB3, 0x1E, 0x09, 0xC5, 0x8C, 0x9F, 0x0B, 0xC5, 0xAC,
+    0x5F, 0x21, 0x14, 0x43, 0x8C, 0x09, 0x9C, 0x8F, 0x84, 0x62, 0xAC, 0x1F, 0x32, 0xF4, 0x61, 0x90,
+    0xA6, 0x60, 0xA7, 0xAF, 0x9C, 0xDF, 0x79, 0x61, 0x7A, 0x05, 0xFE, 0xC1, 0x65, 0xC0, 0x34, 0xBB,
+    0xB6, 0xA0, 0x19, 0xD4, 0x07, 0x8C, 0x61, 0x16, 0x15, 0xB7, 0x98, 0x97, 0x09, 0x63, 0x12, 0x05,
+    0x9C, 0x8D, 0x97, 0xEB, 0x40, 0x12, 0x8E, 0x8C, 0x92, 0xAC, 0xE0, 0x0F, 0xED, 0xA2, 0xA2, 0x28,
+    0xFD, 0x11, 0xBB, 0x69, 0x3B, 0x2F, 0x63, 0x97, 0xDD, 0x11, 0xB5, 0x4D, 0xF6, 0x83, 0x2E, 0xA3,
+    0x27, 0x27, 0x68, 0x2E, 0xE8, 0xB8, 0x73, 0x06, 0xCD, 0x02, 0x37, 0x89, 0x0C, 0xB9, 0x36, 0x53,
+    0x6F, 0xCC, 0x50, 0xB1, 0xCD, 0xC2, 0xCE, 0xD4, 0x13, 0xCD, 0xD4, 0xF3, 0x6D, 0x1A, 0x0C, 0xC9,
+    0x59, 0x90, 0x2D, 0xBC, 0x7D, 0x60, 0x39, 0xEE, 0x2E, 0x08, 0x8D, 0x66, 0x15, 0x61, 0x7C, 0x47,
+    0x0C, 0xCC, 0x3A, 0xC0, 0xF1, 0x5C, 0x81, 0xE4, 0x6A, 0x3C, 0x9A, 0xA0, 0xD0, 0xCB, 0x81, 0xBA,
+    0xE0, 0xB4, 0xDB, 0x33, 0xCD, 0x6E, 0x77, 0x1E, 0xBF, 0xEB, 0xB0, 0x54, 0xDC, 0x5C, 0xB6, 0x43,
+    0x79, 0xCF, 0x69, 0x7B, 0xFC, 0x03, 0xE7, 0xD1, 0xEC, 0xA8, 0xE9, 0x88, 0x1D, 0xA5, 0x0E, 0xEC,
+    0xA8, 0x05, 0x3C, 0x95, 0x21, 0xA3, 0xF5, 0x1D, 0x87, 0x02, 0x1D, 0xED, 0x2D, 0xD7, 0xEC, 0x28,
+    0x45, 0x66, 0xD8, 0xF2, 0x05, 0xDB, 0x66, 0x9F, 0x80, 0x62, 0x44, 0xDF, 0x42, 0x56, 0xCB, 0x11,
+    0xF7, 0xED, 0xF3, 0x26, 0xD0, 0x8E, 0xE3, 0xC3, 0x90, 0x38, 0xE9, 0xEB, 0x05, 0x3C, 0x1B, 0x45,
+    0xB6, 0x5E, 0x7F, 0x52, 0xC1, 0x17, 0xD3, 0x58, 0xF5, 0x4D, 0xB7, 0x5A, 0xD2, 0xB3, 0x12, 0xEE,
+    0xC5, 0x04, 0x98, 0x05, 0x4F, 0x11, 0x82, 0x19, 0x92, 0x11, 0x96, 0x73, 0x5F, 0x9A, 0x4D, 0x68,
+    0x3C, 0x50, 0x9B, 0x3F, 0x7A, 0xDF, 0x0C, 0xC0, 0x64, 0x74, 0x0C, 0x60, 0x84, 0xE4, 0x3C, 0xD0,
+    0xC3, 0x16, 0x68, 0x42, 0x30, 0x82, 0x19, 0x8A, 0x5E, 0x30, 0xA2, 0x56, 0xC8, 0x1B, 0xCB, 0x70,
+    0x67, 0x85, 0xB5, 0x93, 0xB9, 0xB4, 0xF4, 0xB9, 0x74, 0x99, 0x90, 0x9F, 0xAE, 0xF2, 0x7A, 0x86,
+    0x79, 0x3D, 0x58, 0x15, 0x50, 0xF5, 0xB9, 0xE4, 0xA6, 0x61, 0x7D, 0x45, 0x5D, 0xCB, 0xD0, 0x57,
+    0x53, 0x95, 0x11, 0x1C, 0x3F, 0x8B, 0xC6, 0x8B, 0xAC, 0xF8, 0x5C, 0x85, 0x0A, 0x36, 0x8F, 0x2B,
+    0xEC, 0x23, 0x0C, 0x86, 0x6F, 0xE6, 0x81, 0x20, 0x65, 0x54, 0x69, 0x60, 0x32, 0xDE, 0x78, 0x45,
+    0x0F, 0x00, 0x5D, 0x3D, 0x9A, 0xEC, 0x71, 0xF3, 0x91, 0x1C, 0x4F, 0xB3, 0x13, 0x3A, 0x1E, 0xD8,
+    0x3A, 0x8C, 0xE0, 0xDA, 0x31, 0x76, 0x8C, 0x3D, 0xA3, 0x60, 0xEC, 0x19, 0x07, 0x06, 0xC1, 0x28,
+    0xB9, 0x88, 0x3B, 0x51, 0xDD, 0x58, 0x86, 0xCF, 0x56, 0xE3, 0xFC, 0xF8, 0xD9, 0x6A, 0x8D, 0x97,
+    0x9F, 0xAE, 0xC5, 0xCE, 0xF2, 0xD3, 0x5F, 0x65, 0x37, 0xC9, 0xEB, 0x77, 0x56, 0x07, 0xF5, 0x26,
+    0x23, 0xA1, 0xDF, 0xE4, 0x42, 0x98, 0xAB, 0xBC, 0xC2, 0x6C, 0xAE, 0xF2, 0x51, 0x66, 0xFB, 0x1C,
+    0x5B, 0x84, 0x72, 0x1B, 0x87, 0x5A, 0x0E, 0x73, 0x3A, 0x76, 0x3E, 0x88, 0x8A, 0x76, 0xFB, 0xBF,
+    0x7B, 0x4B, 0x60, 0x8C, 0x6A, 0x41, 0x9F, 0x65, 0x04, 0x0C, 0x57, 0x60, 0x60, 0xFC, 0x9C, 0x7D,
+    0x27, 0x0B, 0x80, 0x91, 0x33, 0x20, 0x18, 0xD0, 0x8C, 0x7E, 0xD0, 0x01, 0x70, 0x7B, 0x1E, 0x30,
+    0xAF, 0x45, 0x40, 0xBF, 0x99, 0x01, 0x19, 0xED, 0x84, 0x71, 0x55, 0x0B, 0x86, 0x3C, 0x24, 0x88,
+    0xD2, 0x55, 0x74, 0xDC, 0x77, 0x33, 0x76, 0x21, 0xAC, 0xB6, 0x41, 0xDB, 0xFE, 0x93, 0xA9, 0xC5,
+    0xEA, 0x44, 0x11, 0x15, 0xE0, 0x23, 0x04, 0x74, 0xC0, 0xBD, 0x38, 0x03, 0x33, 0x55, 0x98, 0xAB,
+    0x19, 0x8A, 0x09, 0x03, 0x97, 0x03, 0xA3, 0xD0, 0xC4, 0x57, 0x3A, 0xE6, 0x3A, 0x90, 0x45, 0xD6,
+    0xBD, 0xAC, 0x92, 0xCC, 0x26, 0x8E, 0x69, 0xE7, 0x03, 0x38, 0x2F, 0xA3, 0xF3, 0x2A, 0x3A, 0x6F,
+    0x82, 0xF3, 0x76, 0x71, 0xFF, 0x1F, 0xBD, 0x25, 0xBD, 0xA6, 0xF3, 0x63, 0x31, 0x73, 0xD3, 0xB9,
+    0xC3, 0xF2, 0x33, 0x40, 0x7E, 0x52, 0x00, 0xF9, 0x5E, 0x06, 0x46, 0xBF, 0x1E, 0x15, 0xF1, 0x82,
+    0xD3, 0x46, 0xAB, 0xE4, 0x0C, 0x68, 0x7A, 0xC0, 0xDC, 0xF0, 0x1B, 0xA9, 0xD4, 0x1E, 0x7D, 0xD1,
+    0x1E, 0x22, 0xAB, 0xA5, 0x51, 0xAA, 0xA2, 0x0A, 0x30, 0x8B, 0x0A, 0xB0, 0x1F, 0x5E, 0x0A, 0x60,
+    0xCB, 0x45, 0x33, 0x0A, 0x92, 0x71, 0xC8, 0x90, 0x51, 0x26, 0xC8, 0xA8, 0x22, 0xE4, 0x6A, 0x02,
+    0xE4, 0x6A, 0x3D, 0xC6, 0x04, 0xF9, 0x7C, 0x84, 0xBE, 0x96, 0xA0, 0x5F, 0x5D, 0xA1, 0x1E, 0x3D,
+    0x8C, 0x7D, 0xFD, 0x4E, 0x48, 0x84, 0x6E, 0x76, 0xC9, 0x40, 0xB6, 0xB5, 0x22, 0x1B, 0x31, 0xE4,
+    0x0A, 0x0C, 0xB9, 0x45, 0xA8, 0xF8, 0x62, 0x02, 0x00, 0x1D, 0x39, 0x01, 0x18, 0x4A, 0x4B, 0xEA,
+    0xF3, 0x39, 0xEE, 0x5F, 0x04, 0x74, 0xD4, 0xE4, 0x0C, 0x51, 0x7A, 0x72, 0x05, 0xE8, 0x0D, 0x09,
+    0xA8, 0xFA, 0xF2, 0x2E, 0xF7, 0xEA, 0x5B, 0xF0, 0x38, 0x03, 0x50, 0xED, 0xF6, 0xCD, 0xFD, 0x06,
+    0x9C, 0x07, 0xF7, 0x2F, 0x42, 0xAE, 0x50, 0xA4, 0x17, 0x44, 0x4F, 0x66, 0x58, 0x0F, 0xD3, 0xAE,
+    0xDA, 0xE8, 0xFC, 0x39, 0x43, 0xC7, 0xB2, 0xB3, 0xD7, 0x8B, 0x2C, 0x7B, 0x7C, 0xB4, 0xAA, 0x55,
+    0x96, 0xAE, 0x9A, 0x20, 0x93, 0x28, 0x66, 0x91, 0x69, 0x2F, 0x5B, 0x2F, 0xC9, 0xD5, 0x79, 0x49,
+    0xCE, 0x6E, 0x56, 0xB7, 0xFF, 0x0A, 0x6E, 0x36, 0x11, 0x70, 0xDE, 0x46, 0xC0, 0xBD, 0xC7, 0xD4,
+    0x2D, 0x86, 0xCD, 0x77, 0x74, 0xE4, 0x32, 0x16, 0x63, 0x38, 0x61, 0xDA, 0x94, 0x15, 0x00, 0x8B,
+    0x8A, 0x61, 0xD5, 0xBE, 0x31, 0x37, 0xCB, 0xA1, 0x5D, 0xBB, 0x83, 0x2A, 0xCC, 0x0D, 0x5F, 0xF1,
+    0xE5, 0x50, 0x85, 0xDB, 0xFB, 0x93, 0xD8, 0xD4, 0xC9, 0x06, 0xDC, 0xF8, 0x72, 0xA8, 0xC2, 0xED,
+    0xFD, 0xB9, 0xDF, 0x18, 0x7C, 0x16, 0x64, 0x02, 0xEE, 0x9D, 0xEE, 0x85, 0x0C, 0xDA, 0xF7, 0x59,
+    0x2D, 0x30, 0x8C, 0x18, 0x18, 0x0E, 0x8D, 0x4F, 0x5B, 0x9A, 0x35, 0x47, 0x66, 0x70, 0xE1, 0x64,
+    0xBD, 0x5E, 0x4C, 0x90, 0xAB, 0x5C, 0xF7, 0xF2, 0x40, 0xE6, 0x9E, 0x4C, 0x70, 0x1F, 0x4E, 0xD0,
+    0x01, 0x5B, 0x3C, 0x7E, 0xFE, 0xE6, 0x6E, 0x14, 0x1E, 0x9A, 0xE7, 0x8F, 0x38, 0x4B, 0x7B, 0x3C,
+    0x8F, 0x81, 0x0C, 0x50, 0x64, 0x80, 0x7D, 0xB9, 0x85, 0x60, 0xFD, 0xE6, 0x2F, 0x37, 0xBF, 0x62,
+    0x0B, 0xD9, 0xEE, 0x91, 0x93, 0xDE, 0xA6, 0x3D, 0x1A, 0xEE, 0xF3, 0x79, 0xCE, 0xA2, 0xC8, 0x04,
+    0x1D, 0xCD, 0xD2, 0x71, 0xE6, 0xAC, 0xB2, 0xE0, 0xBF, 0xE5, 0x32, 0x90, 0xA5, 0x81, 0x79, 0x06,
+    0xAE, 0x00, 0x4E, 0x1F, 0x06, 0x67, 0x61, 0x58, 0x40, 0x66, 0x71, 0x5E, 0xA5, 0x16, 0xD5, 0xB2,
+    0xBE, 0x7B, 0x8A, 0x1D, 0x99, 0x35, 0xF9, 0x1E, 0xFF, 0x9E, 0x8F, 0xAF, 0x43, 0x36, 0xDE, 0x04,
+    0xF6, 0x14, 0x0D, 0x48, 0x30, 0x0D, 0x0C, 0xDB, 0x4D, 0x9E, 0x91, 0x33, 0x44, 0x72, 0xDB, 0x0E,
+    0x7C, 0x70, 0x58, 0x8E, 0xFA, 0x7C, 0x75, 0x82, 0x22, 0x67, 0x58, 0x72, 0xEE, 0xEA, 0x25, 0x4E,
+    0x1D, 0x06, 0xEE, 0xEC, 0x32, 0x19, 0x0F, 0x72, 0x38, 0x53, 0xE7, 0x9A, 0x07, 0x1D, 0x15, 0x49,
+    0xCF, 0xFA, 0x72, 0x1D, 0x6B, 0xDB, 0x64, 0xCE, 0x73, 0x1A, 0xAA, 0xA8, 0xB0, 0x51, 0xD6, 0x3D,
+    0x4E, 0x8A, 0x5C, 0xA1, 0xC9, 0x09, 0x8A, 0xCB, 0x66, 0xC6, 0x8C, 0xCF, 0xAD, 0xB0, 0x8F, 0xC7,
+    0x3E, 0x9B, 0x59, 0x84, 0xCB, 0x07, 0xA2, 0x90, 0x01, 0x0D, 0x21, 0x14, 0x7F, 0x6F, 0xB2, 0x01,
+    0x70, 0x1E, 0x1D, 0x71, 0xEC, 0xE5, 0x3C, 0x90, 0xD1, 0x91, 0x2F, 0xF2, 0x7B, 0xC5, 0x2C, 0x2A,
+    0x12, 0x3C, 0x97, 0xC7, 0x2C, 0xC9, 0x45, 0xB1, 0x40, 0x71, 0xDE, 0x31, 0xDC, 0xEE, 0x6E, 0xFA,
+    0xD5, 0x66, 0xDD, 0xB2, 0x49, 0xF2, 0x6E, 0x7D, 0x10, 0x5F, 0x78, 0x75, 0x15, 0x32, 0x76, 0x9C,
+    0x44, 0x6E, 0xF2, 0xB0, 0x81, 0xA4, 0x3C, 0x64, 0x1C, 0xD3, 0x98, 0x01, 0x1D, 0xCC, 0xE2, 0x16,
+    0xC0, 0x78, 0x0E, 0x15, 0x80, 0x3B, 0x95, 0x4D, 0x00, 0x3A, 0xAA, 0xEB, 0x0D, 0xED, 0xD0, 0x9C,
+    0xA8, 0xB1, 0xB9, 0xB0, 0x4D, 0xC0, 0xB6, 0xED, 0x19, 0x01, 0x98, 0x5F, 0x55, 0x13, 0x80, 0x9E,
+    0x2F, 0xAE, 0xCE, 0x03, 0x2A, 0x9B, 0x2B, 0x9C, 0xD0, 0xD1, 0x53, 0x54, 0x40, 0x96, 0x21, 0x8F,
+    0x19, 0x60, 0xD0, 0x41, 0xAD, 0x18, 0x09, 0x4E, 0x26, 0xC0, 0x46, 0x91, 0xE1, 0xBC, 0xE0, 0x24,
+    0xE3, 0xA6, 0xF7, 0xB4, 0x08, 0x0D, 0x58, 0xE0, 0x1A, 0xE3, 0x3E, 0x1E, 0x01, 0xA0, 0x0F, 0xCF,
+    0x7C, 0x81, 0x9E, 0x9E, 0xD3, 0x90, 0x3A, 0x2E, 0xBA, 0xC2, 0x4D, 0x2E, 0xF7, 0x5C, 0x65, 0xD4,
+    0x9C, 0x3B, 0xCE, 0x1C, 0xEA, 0x84, 0x31, 0xAB, 0xC0, 0x19, 0xB0, 0x57, 0xAB, 0x8A, 0x80, 0x28,
+    0xF6, 0x83, 0xBA, 0x79, 0x51, 0xCB, 0x11, 0x69, 0x75, 0xA3, 0xD2, 0x03, 0x32, 0xBA, 0x53, 0x19,
+    0x10, 0x55, 0x46, 0xB3, 0xB4, 0x51, 0x73, 0xEA, 0x99, 0x54, 0x54, 0x9C, 0x4D, 0xED, 0x2B, 0x98,
+    0x06, 0x4E, 0x7A, 0xE9, 0x39, 0xDF, 0x05, 0x00, 0x98, 0x80, 0x3E, 0x3E, 0xD3, 0xE2, 0xB3, 0xF6,
+    0xF1, 0x88, 0xF1, 0xB9, 0xC3, 0x64, 0xC9, 0x71, 0x16, 0xC8, 0xCD, 0x2C, 0xC3, 0xC9, 0x1F, 0x71,
+    0xB9, 0x0B, 0x6A, 0xDD, 0xD4, 0x3C, 0x01, 0x38, 0xDF, 0x3D, 0x45, 0xDF, 0x91, 0x33, 0x6C, 0x9D,
+    0xA0, 0x99, 0x80, 0xE3, 0x9C, 0x1A, 0x73, 0xEF, 0x20, 0x40, 0x1D, 0x9F, 0xFF, 0xE5, 0x71, 0x2E,
+    0x8E, 0x0C, 0x9A, 0x0C, 0x3D, 0x79, 0xBE, 0x71, 0xB4, 0x7A, 0x34, 0x80, 0xDA, 0x8B, 0xE4, 0x8E,
+    0xEA, 0x93, 0x3D, 0x2E, 0x3D, 0x19, 0x04, 0xB9, 0x7C, 0x0D, 0x9C, 0xD1, 0x57, 0x40, 0xAE, 0x78,
+    0x99, 0xB3, 0xE0, 0xFB, 0x50, 0x5C, 0x70, 0xAF, 0x5B, 0x00, 0x37, 0xA3, 0xE7, 0xF1, 0x49, 0x27,
+    0x4D, 0x7A, 0xC7, 0xD2, 0x91, 0x73, 0xD3, 0xBE, 0xBA, 0x01, 0xD6, 0x0A, 0x0C, 0xE9, 0x07, 0x72,
+    0x05, 0xC6, 0xB2, 0xED, 0x69, 0xE7, 0x9B, 0x75, 0x22, 0x13, 0xD0, 0x71, 0x6D, 0x51, 0xD8, 0xFE,
+    0x12, 0x67, 0x40, 0xE6, 0xA3, 0x88, 0x29, 0xB3, 0xDC, 0x0D, 0x99, 0xC5, 0xFB, 0xF7, 0x73, 0x36,
+    0x4D, 0x2F, 0x65, 0x28, 0xDE, 0x02, 0xBA, 0xD3, 0xCD, 0xF1, 0xF2, 0x82, 0xCC, 0x6D, 0xBB, 0x9D,
+    0xB1, 0xB1, 0x5D, 0x2E, 0xB8, 0xC3, 0x36, 0x85, 0xF6, 0x88, 0x9E, 0xE7, 0x9B, 0x36, 0x6C, 0xBE,
+    0xB4, 0x4E, 0x00, 0xB8, 0x83, 0x84, 0x1D, 0xB1, 0x1F, 0xEF, 0x86, 0x89, 0xC3, 0x6D, 0x57, 0x61,
+    0xDB, 0x90, 0x03, 0xEE, 0x3F, 0x30, 0xE6, 0x71, 0xDF, 0xFE, 0x4B, 0x5B, 0x9E, 0xAC, 0xDD, 0xE5,
+    0xCC, 0x99, 0x9D, 0x85, 0x11, 0xE1, 0xC2, 0x90, 0x61, 0x53, 0x57, 0x61, 0x0A, 0xDC, 0xA4, 0x09,
+    0xE3, 0x15, 0xBD, 0x8C, 0x92, 0x61, 0x48, 0xE3, 0x9D, 0xD4, 0x97, 0xE1, 0x76, 0x01, 0x4F, 0x65,
+    0xC2, 0x5C, 0x2D, 0xC6, 0xCB, 0x58, 0x55, 0x18, 0x12, 0xC7, 0xB5, 0x2F, 0xEE, 0x54, 0x06, 0xED,
+    0x4C, 0x18, 0x7A, 0xE3, 0x15, 0x17, 0x15, 0x06, 0xC6, 0x71, 0xED, 0x19, 0x45, 0x06, 0x13, 0x08,
+    0x93, 0x61, 0x67, 0x55, 0xA0, 0x03, 0x70, 0x62, 0xFF, 0x02, 0x06, 0x16, 0xF4, 0x24, 0x70, 0xE6,
+    0xCC, 0xB4, 0x61, 0x7C, 0x8C, 0x77, 0xB3, 0x8A, 0x26, 0x8C, 0x49, 0xAE, 0xA2, 0x1C, 0x24, 0x5F,
+    0xDC, 0xAC, 0xA3, 0x59, 0x64, 0x92, 0x51, 0x14, 0x91, 0x3B, 0x76, 0x04, 0xBD, 0xF5, 0x36, 0xA8,
+    0xD5, 0xAD, 0x82, 0xB5, 0x80, 0xC5, 0x42, 0x16, 0xE5, 0x71, 0x77, 0x0B, 0x33, 0x3C, 0x1A, 0x36,
+    0x0B, 0xA3, 0x6D, 0x99, 0xCB, 0xF2, 0x68, 0xB6, 0x50, 0x64, 0xE8, 0xD4, 0x11, 0xAA, 0xC2, 0xCE,
+    0x92, 0x93, 0x5E, 0x46, 0x7A, 0x19, 0x07, 0x46, 0x91, 0x05, 0x53, 0x57, 0xFB, 0x5A, 0xE1, 0x1E,
+    0xA9, 0x6E, 0x32, 0x0B, 0x8D, 0x97, 0xD1, 0x3D, 0x1E, 0x45, 0x36, 0x2F, 0xA4, 0xAE, 0x9A, 0xAB,
+    0x05, 0x6E, 0x6F, 0x21, 0xCC, 0x3B, 0xC1, 0x78, 0xC9, 0x28, 0xE3, 0xC0, 0x75, 0x48, 0x1D, 0x73,
+    0x5F, 0xE0, 0x32, 0x08, 0x53, 0x61, 0xBC, 0x24, 0x54, 0x18, 0x38, 0x8D, 0xA9, 0xC9, 0xB9, 0x31,
+    0x56, 0xF4, 0xD9, 0xCC, 0x78, 0x78, 0x9C, 0x0F, 0xE3, 0x56, 0x5E, 0x46, 0x1D, 0x86, 0x2C, 0x53,
+    0x5F, 0x45, 0x01, 0x27, 0xC2, 0x78, 0xEB, 0x55, 0xD4, 0x61, 0xCC, 0x72, 0x15, 0x55, 0x64, 0x70,
+    0x22, 0xAC, 0xB7, 0xDE, 0x44, 0x15, 0x55, 0x1A, 0x8A, 0x2E, 0x20, 0xDD, 0x64, 0x78, 0xD6, 0x0B,
+    0x3E, 0x16, 0xD1, 0xF6, 0xDD, 0xC9, 0xD1, 0x03, 0x4E, 0x86, 0x4D, 0xD6, 0x3D, 0x73, 0xE4, 0x21,
+    0x40, 0xE7, 0xCA, 0x96, 0xC9, 0x35, 0x64, 0x04, 0x6F, 0xBB, 0x55, 0x70, 0x56, 0x79, 0xA8, 0x18,
+    0xB3, 0xCC, 0x18, 0x8A, 0x5A, 0x21, 0x8A, 0x8E, 0x10, 0xC5, 0x04, 0x88, 0x62, 0x16, 0x0C, 0xD9,
+    0x2C, 0x18, 0xB3, 0x5D, 0x20, 0xB3, 0x5D, 0x5A, 0x4C, 0x55, 0x47, 0x13, 0x60, 0x83, 0x59, 0x3B,
+    0x7A, 0x55, 0x9F, 0xE4, 0x24, 0xC9, 0x0A, 0x41, 0xAE, 0x80, 0xE5, 0x8C, 0x23, 0x1B, 0x51, 0x2D,
+    0x22, 0x39, 0x0C, 0x3E, 0x1D, 0x8A, 0xA5, 0x00, 0xCB, 0x38, 0x90, 0xD1, 0xDC, 0x74, 0x6F, 0x72,
+    0xE2, 0x0F, 0x52, 0x4F, 0xEB, 0xC7, 0x42, 0xE8, 0x8F, 0x12, 0x78, 0x29, 0x88, 0xE2, 0x66, 0xF5,
+    0x09, 0xC1, 0x17, 0xAA, 0xCA, 0x92, 0x0C, 0x92, 0x15, 0x23, 0xCF, 0x03, 0xD3, 0x6F, 0xA2, 0xE4,
+    0xA6, 0x5B, 0x05, 0x27, 0x99, 0x87, 0xD2, 0xF2, 0x36, 0x0D, 0x55, 0x51, 0xF4, 0xCD, 0x33, 0xDF,
+    0x2B, 0x86, 0x2D, 0xDB, 0xC8, 0x6C, 0x48, 0x66, 0xEB, 0x31, 0x66, 0xEB, 0x21, 0x93, 0xF1, 0x07,
+    0x21, 0x83, 0x08, 0x7A, 0x55, 0x7E, 0x13, 0x25, 0x00, 0xE0, 0x12, 0x14, 0x73, 0x47, 0x66, 0x59,
+    0xD4, 0xEA, 0xBC, 0xBE, 0x5E, 0xE1, 0xDE, 0xB9, 0xBD, 0x4F, 0x4B, 0xDE, 0x26, 0xF9, 0x51, 0xDD,
+    0xE7, 0x5E, 0x18, 0xB2, 0x9B, 0xCD, 0xBB, 0x7C, 0x81, 0x82, 0x4C, 0x82, 0x9C, 0x7B, 0xBE, 0x8F,
+    0xC6, 0x8A, 0x97, 0xE5, 0x8C, 0xAE, 0x1A, 0xDF, 0x64, 0x22, 0x7E, 0xA6, 0xA6, 0xFF, 0xCC, 0xCA,
+    0xFC, 0xD3, 0xD2, 0xA3, 0x87, 0xA5, 0xAB, 0xC6, 0x0F, 0x2B, 0x8F, 0xCA, 0xE5, 0xA3, 0x2B, 0xB3,
+    0xDA, 0x37, 0x09, 0xF7, 0x83, 0xD4, 0xD3, 0x7E, 0xF8, 0x72, 0x21, 0xF9, 0x11, 0xC9, 0x4B, 0xB7,
+    0x5F, 0x2E, 0x6E, 0x56, 0x9F, 0xD4, 0xDF, 0xB0, 0x32, 0xC3, 0xF2, 0x33, 0x80, 0x7A, 0x69, 0xA6,
+    0xC4, 0xE7, 0x76, 0xDA, 0x1E, 0x67, 0x68, 0x72, 0x06, 0x59, 0x21, 0x3F, 0x64, 0xC4, 0xD4, 0x71,
+    0xDE, 0x24, 0x95, 0x6D, 0x08, 0xAA, 0x63, 0x67, 0x6C, 0x13, 0x7F, 0x9B, 0x84, 0xCD, 0xB8, 0xF7,
+    0x0C, 0xE7, 0x96, 0xED, 0x16, 0x04, 0x60, 0x03, 0xA0, 0xF3, 0xF0, 0xCB, 0x3D, 0x4E, 0x76, 0xC3,
+    0x61, 0x36, 0xE5, 0xD0, 0x4D, 0x00, 0x9E, 0x19, 0x67, 0xF9, 0x71, 0x01, 0xB5, 0x3F, 0xE4, 0xB6,
+    0xE3, 0x0C, 0x70, 0xF4, 0x03, 0x89, 0xFF, 0x56, 0xAF, 0x00, 0x67, 0x8C, 0x19, 0xFB, 0xF4, 0x9A,
+    0x59, 0x90, 0xF3, 0xBD, 0x0D, 0xAE, 0x01, 0x13, 0xFF, 0x4C, 0x95, 0x81, 0x9C, 0x2D, 0x83, 0xE0,
+    0xDA, 0xC8, 0xE9, 0xF6, 0xF7, 0x01, 0x38, 0xFA, 0x0D, 0xEC, 0x74, 0xEC, 0xCC, 0x66, 0xAA, 0x76,
+    0xDC, 0x62, 0x5D, 0x76, 0x91, 0x2B, 0x4C, 0xEC, 0x6B, 0x8B, 0x7A, 0xC8, 0x04, 0x19, 0xC7, 0x8C,
+    0xBE, 0x88, 0x02, 0xD8, 0xE7, 0x09, 0xC8, 0xC8, 0x09, 0x22, 0xBB, 0x19, 0x70, 0xCE, 0xA3, 0x41,
+    0xB1, 0x5B, 0x98, 0x81, 0x2B, 0x00, 0x9D, 0x77, 0xD6, 0xD4, 0x58, 0x81, 0xE3, 0x97, 0x88, 0x26,
+    0x08, 0xE1, 0x38, 0x01, 0xBA, 0xE2, 0x90, 0x03, 0x9F, 0xDA, 0x9F, 0x8F, 0x00, 0x88, 0x0E, 0xE5,
+    0xB5, 0x9D, 0x45, 0x69, 0x38, 0x24, 0xE3, 0xE5, 0x0A, 0xE3, 0x75, 0x84, 0xF1, 0x66, 0x81, 0xF1,
+    0xCE, 0x43, 0x2F, 0x04, 0xD4, 0x9B, 0x15, 0x50, 0xD7, 0x33, 0x20, 0x3F, 0x48, 0x80, 0xBC, 0x11,
+    0x01, 0xC9, 0xB0, 0xE5, 0x31, 0xC7, 0x96, 0xC1, 0xC4, 0x86, 0x1D, 0x18, 0x0E, 0x0D, 0xD4, 0x08,
+    0x3C, 0xD0, 0xC8, 0x9F, 0x00, 0x53, 0x0E, 0x91, 0x01, 0x49, 0x03, 0x70, 0x2A, 0x00, 0xE6, 0xD5,
+    0x75, 0x5B, 0xF8, 0x23, 0x51, 0x78, 0x0F, 0x1D, 0x64, 0x84, 0x5A, 0x45, 0x81, 0xCC, 0x70, 0xF3,
+    0x90, 0xA1, 0xA2, 0xA8, 0x10, 0xB9, 0x27, 0xE0, 0x26, 0x4E, 0x50, 0xC1, 0x79, 0x88, 0x6C, 0x16,
+    0x80, 0x3A, 0x00, 0xFA, 0x46, 0x04, 0x06, 0x26, 0xB4, 0x0C, 0x6E, 0x7B, 0xDC, 0x48, 0x6C, 0x2A,
+    0xB6, 0xE7, 0x8C, 0xEE, 0x65, 0xFA, 0x6D, 0x41, 0x34, 0x97, 0x6D, 0xE0, 0x3B, 0xBB, 0xFB, 0x69,
+    0x39, 0x03, 0x55, 0xFB, 0xB6, 0xC7, 0x7E, 0x6D, 0x7B, 0xFD, 0xD7, 0x98, 0xA3, 0x63, 0xA7, 0xCF,
+    0x6C, 0xFE, 0x9D, 0xC8, 0xC6, 0x43, 0x24, 0x33, 0xA3, 0x4F, 0x7A, 0x02, 0x4E, 0xEF, 0xDC, 0x0E,
+    0x15, 0x31, 0x26, 0x91, 0x31, 0x14, 0x70, 0x12, 0x84, 0x0E, 0xDD, 0x06, 0xF2, 0x02, 0xE1, 0x3C,
+    0xF4, 0x62, 0x16, 0x0C, 0x49, 0x47, 0x80, 0x72, 0x05, 0xCC, 0x6B, 0x09, 0x18, 0xEF, 0x64, 0xA0,
+    0x63, 0x05, 0x5A, 0x22, 0x59, 0x72, 0xDA, 0xB2, 0xC0, 0x2D, 0x20, 0xE6, 0x02, 0xF0, 0x14, 0xE3,
+    0x96, 0x0A, 0x1E, 0xB9, 0xB6, 0x9D, 0x7D, 0xE8, 0xEC, 0x74, 0x4F, 0xDC, 0x3B, 0x41, 0x54, 0xB3,
+    0xA0, 0x2F, 0x7A, 0x41, 0x57, 0xD4, 0x02, 0x64, 0xE9, 0x81, 0x7B, 0x76, 0x7E, 0x5A, 0x57, 0x5B,
+    0x94, 0x6F, 0xCC, 0x0D, 0xE9, 0xD4, 0xD6, 0x8D, 0xE0, 0xD4, 0x66, 0x6C, 0x5C, 0x8D, 0x47, 0x57,
+    0x74, 0x00, 0xEC, 0x0F, 0xE2, 0x36, 0x65, 0xE2, 0x4E, 0xDE, 0xE5, 0xC7, 0x35, 0x77, 0x51, 0x8A,
+    0x8E, 0x7E, 0x17, 0xC1, 0x6D, 0xD1, 0xEE, 0x15, 0xCD, 0xAA, 0xE9, 0x2F, 0x65, 0x6C, 0x1E, 0xA0,
+    0x29, 0x87, 0x98, 0xA3, 0x61, 0xB9, 0xDC, 0x54, 0x97, 0xFC, 0xB8, 0x6C, 0x8B, 0x7A, 0x98, 0xF3,
+    0xD0, 0x0B, 0x67, 0x51, 0xE4, 0x0A, 0xE3, 0xB7, 0xE0, 0x9B, 0x7B, 0x7E, 0x97, 0xE6, 0x3B, 0x55,
+    0xA0, 0xA2, 0x59, 0x7A, 0x0A, 0xC2, 0x04, 0x43, 0x96, 0x8E, 0x3B, 0x4C, 0xED, 0x89, 0x0F, 0xE9,
+    0xF1, 0xDB, 0xA0, 0xEF, 0xCF, 0xC8, 0x59, 0x24, 0x07, 0xF9, 0x5E, 0x3E, 0xE2, 0x05, 0x89, 0x02,
+    0x3E, 0x1E, 0x45, 0xB6, 0x5E, 0x7D, 0x52, 0xE1, 0x5E, 0x4F, 0xA2, 0x9A, 0x45, 0xAE, 0x9C, 0x78,
+    0x8D, 0x67, 0x39, 0x92, 0x59, 0x91, 0x41, 0x25, 0x4E, 0x10, 0xB9, 0x91, 0xE8, 0x66, 0x88, 0xD2,
+    0x08, 0xFD, 0x8A, 0x88, 0xF1, 0xE9, 0x37, 0x1D, 0xDC, 0xE0, 0xBD, 0x43, 0xBD, 0xD0, 0x82, 0x84,
+    0xE4, 0x04, 0xC3, 0x23, 0xA0, 0x5F, 0xF1, 0xEB, 0xA7, 0x36, 0x2F, 0xE7, 0x37, 0x82, 0xC5, 0xEB,
+    0x36, 0x2E, 0x8F, 0x6E, 0x03, 0x79, 0xE8, 0xDB, 0x13, 0x58, 0x21, 0xB8, 0x42, 0xD1, 0x03, 0x6C,
+    0x39, 0x64, 0x15, 0x00, 0xD7, 0x68, 0xDA, 0x50, 0xCA, 0x97, 0xD5, 0x04, 0x40, 0xBD, 0x95, 0x01,
+    0x74, 0xC5, 0xCC, 0x00, 0xE4, 0x11, 0x9B, 0xFE, 0x20, 0x44, 0x0C, 0x15, 0x44, 0x1B, 0x99, 0xF5,
+    0x80, 0x59, 0xC6, 0xD4, 0x66, 0x71, 0x06, 0xAC, 0x97, 0x2B, 0x36, 0x60, 0x1C, 0x38, 0xAB, 0x9B,
+    0x80, 0x5C, 0x7B, 0x72, 0xEE, 0x08, 0x43, 0x4E, 0x2A, 0x0A, 0x32, 0xF7, 0x84, 0xFD, 0x7B, 0x06,
+    0x13, 0xC6, 0x2C, 0x28, 0x0A, 0xDC, 0xAC, 0xA3, 0xF5, 0x72, 0xED, 0x39, 0x66, 0x10, 0x26, 0xB8,
+    0x59, 0x45, 0x99, 0x65, 0xEA, 0xF9, 0x32, 0x67, 0x4E, 0x86, 0x8C, 0x2A, 0x0A, 0x32, 0xF5, 0x84,
+    0x61, 0x6A, 0xFB, 0x6F, 0x7C, 0x6E, 0xDD, 0xB9, 0x47, 0x7D, 0x36, 0x33, 0x20, 0x3E, 0x2F, 0xA3,
+    0xA0, 0x22, 0x60, 0xBD, 0x9B, 0xD1, 0xD7, 0xB6, 0x5C, 0x32, 0x02, 0x66, 0xB1, 0x1E, 0x60, 0xCF,
+    0x33, 0x18, 0xB2, 0x24, 0x67, 0x1D, 0x0C, 0xE9, 0x39, 0xF1, 0x23, 0x9E, 0xCA, 0x43, 0x16, 0x45,
+    0x45, 0x1D, 0xE5, 0xEA, 0xBC, 0x9B, 0xCD, 0x9B, 0xB5, 0x63, 0x4F, 0xB9, 0x0A, 0xBA, 0xD5, 0xF8,
+    0x91, 0x7C, 0x8E, 0x18, 0xB8, 0x8E, 0x69, 0x27, 0xB2, 0x7F, 0x17, 0xA5, 0x0C, 0x37, 0x4F, 0x63,
+    0x64, 0x6E, 0x4A, 0x81, 0x9C, 0x61, 0xF8, 0x6B, 0xD7, 0xFF, 0x77, 0x9C, 0x20, 0xE9, 0x21, 0xB8,
+    0x1C, 0xC0, 0xAB, 0xFE, 0x11, 0xC5, 0x0E, 0xF5, 0x22, 0xE4, 0x06, 0xA6, 0x52, 0x3C, 0x0A, 0xA4,
+    0x0A, 0xF8, 0x7D, 0x7A, 0x28, 0x7A, 0x28, 0x02, 0x2A, 0x1D, 0x04, 0xA3, 0xFF, 0xC9, 0x30, 0x33,
+    0x3F, 0x84, 0x09, 0x92, 0xE9, 0x2B, 0x60, 0x66, 0xBA, 0xBD, 0x0C, 0x40, 0x37, 0x01, 0xB8, 0xCB,
+    0x96, 0x6C, 0xE6, 0x9A, 0x57, 0x2B, 0x38, 0x71, 0x16, 0x55, 0xE6, 0x96, 0xB4, 0x93, 0x77, 0xCA,
+    0xA6, 0x38, 0x4C, 0x05, 0xD0, 0x34, 0xF1, 0xD4, 0xA4, 0xA8, 0x60, 0x01, 0xF4, 0x9D, 0x8C, 0x9E,
+    0x8F, 0xDF, 0x7E, 0x49, 0xAD, 0x86, 0x9E, 0xB3, 0xA5, 0xCC, 0x2D, 0x2F, 0xB6, 0x45, 0x39, 0xDA,
+    0xAC, 0x7F, 0xAD, 0xC1, 0x9F, 0xA7, 0x96, 0x33, 0xEB, 0x77, 0xF1, 0x68, 0x1D, 0x60, 0x02, 0xAC,
+    0x17, 0x04, 0x38, 0xE9, 0x15, 0x7D, 0x05, 0xE7, 0x6D, 0x4A, 0xE4, 0xEA, 0x3C, 0xA0, 0x3F, 0xC8,
+    0x00, 0x2C, 0x17, 0xE0, 0x0C, 0xF9, 0x04, 0x7A, 0x92, 0x71, 0x4B, 0xBB, 0x1A, 0xB2, 0x02, 0x4F,
+    0xB2, 0x9C, 0x06, 0xCC, 0x3B, 0x2B, 0x20, 0xA8, 0x23, 0xA0, 0xA3, 0xF5, 0xE8, 0x38, 0x71, 0x86,
+    0x4C, 0x3D, 0x01, 0xFA, 0x21, 0x63, 0x2C, 0x90, 0x09, 0x36, 0xA0, 0x45, 0xDF, 0xBE, 0x84, 0xD4,
+    0xDC, 0x48, 0x3D, 0x41, 0x5E, 0x80, 0x25, 0x97, 0x9E, 0x24, 0x8E, 0x3B, 0x5E, 0x3C, 0x24, 0xB5,
+    0xE3, 0xE3, 0x11, 0x6A, 0x35, 0x01, 0x9C, 0xAD, 0x97, 0x8D, 0x3D, 0xBB, 0x19, 0xE1, 0xA9, 0x9F,
+    0xFD, 0xFB, 0x9F, 0xBD, 0x14, 0xFE, 0xDD, 0xFC, 0x12, 0x7E, 0xFB, 0x1B, 0xE8, 0xA7, 0x11, 0x0F,
+    0xFE, 0xE4, 0xC1, 0xBF, 0x19, 0x4F, 0xF4, 0xFF, 0x03, 0x4E, 0xFC, 0xF6, 0xF7, 0x03, 0xFB, 0x8F,
+    0xF3, 0x3A, 0x6F, 0x32, 0x1F, 0xFC, 0x61, 0xC9, 0x5F, 0x91, 0x7C, 0x9D, 0xE4, 0xBD, 0x67, 0xCE,
+    0x3C, 0x71, 0xDF, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0x45, 0x43, 0xEE, 0x6C, 0xDC, 0x86, 0x12, 0x24,
+    0x99, 0x00, 0x58, 0xFC, 0xFC, 0x77, 0xFE, 0xDF, 0x03, 0xF8, 0xF3, 0x63, 0x67, 0xCE, 0x9C, 0x26,
+    0xEB, 0x89, 0xFD, 0xFD, 0xF3, 0x00, 0xEE, 0x3D, 0x73, 0xE6, 0x14, 0x99, 0x1F, 0xD8, 0xDF, 0x9F,
+    0xBA, 0x27, 0x44, 0x19, 0xB2, 0x5C, 0x65, 0xD0, 0xDE, 0xCC, 0x27, 0xE1, 0xF4, 0x6B, 0x1F, 0x67,
+    0x2B, 0xAF, 0xC5, 0x7B, 0xBA, 0x27, 0x8E, 0x9D, 0x36, 0x57, 0xEB, 0x90, 0x8C, 0xE7, 0x90, 0x64,
+    0x60, 0x9F, 0x65, 0x30, 0xCF, 0x67, 0x11, 0xF4, 0xC4, 0xF1, 0xD3, 0xAC, 0x7F, 0x11, 0xED, 0xD9,
+    0x2B, 0xC5, 0x8A, 0x35, 0xCB, 0xB7, 0x56, 0xFD, 0xDC, 0x74, 0xCF, 0x0E, 0x18, 0x58, 0x01, 0x33,
+    0x41, 0x7A, 0x88, 0xD0, 0xFD, 0xF0, 0xD6, 0x9F, 0x3B, 0x56, 0x43, 0xFE, 0xCB, 0x4B, 0xFF, 0xAF,
+    0x17, 0x01, 0xDD, 0x0A, 0x5C, 0x06, 0x0C, 0x20, 0x3D, 0x86, 0x08, 0x91, 0x80, 0x02, 0xD8, 0x09,
+    0xDA, 0x43, 0x46, 0x88, 0xBC, 0x4B, 0x92, 0x6C, 0x59, 0x4A, 0x07, 0xA0, 0x02, 0xC8, 0x00, 0x32,
+    0xFA, 0x16, 0xAE, 0xCC, 0x82, 0x4C, 0x10, 0x11, 0x10, 0xF1, 0x08, 0x1C, 0x68, 0xC1, 0x31, 0x79,
+    0x65, 0x52, 0x4D, 0x3B, 0x78, 0x43, 0x37, 0x43, 0x6F, 0x38, 0x50, 0xBB, 0x45, 0x5F, 0xB8, 0x21,
+    0xCF, 0x14, 0x4F, 0x31, 0x1B, 0x5E, 0x63, 0x36, 0xBC, 0xCA, 0x2C, 0x09, 0x3D, 0x03, 0x78, 0x09,
+    0x72, 0x46, 0x85, 0xCC, 0x1D, 0xA3, 0xE6, 0x35, 0xAE, 0x66, 0x1D, 0x56, 0xFC, 0x14, 0x77, 0x01,
+    0xC7, 0x4F, 0x15, 0xFB, 0x51, 0xB1, 0xFE, 0xF4, 0x31, 0x1C, 0x3B, 0x95, 0xFB, 0xEA, 0x16, 0x73,
+    0x27, 0x0F, 0xD5, 0xCE, 0xC6, 0x4F, 0x38, 0x7D, 0x4C, 0x64, 0xF7, 0x4E, 0xB6, 0xF3, 0xF4, 0xD4,
+    0xC5, 0x7F, 0x7F, 0xF1, 0xAB, 0xB0, 0xD6, 0x4B, 0x78, 0x09, 0x0F, 0xFC, 0xE4, 0x81, 0xBF, 0xF9,
+    0x2A, 0x4C, 0x85, 0x13, 0x38, 0x01, 0xD8, 0x72, 0xF8, 0xEE, 0xE7, 0xDF, 0xFE, 0x06, 0x6C, 0xF9,
+    0x4B, 0xB4, 0xF7, 0x57, 0xBF, 0x02, 0xFF, 0xAC, 0xBD, 0xBF, 0xEA, 0x15, 0xBB, 0x70, 0x66, 0x6E,
+    0xF5, 0x38, 0x82, 0xB1, 0xE1, 0x6E, 0xC9, 0x49, 0x2E, 0x00, 0xD4, 0x5B, 0xA9, 0x4F, 0x68, 0x7A,
+    0xCA, 0x02, 0x80, 0x39, 0x97, 0xA4, 0x07, 0x20, 0x56, 0x73, 0x6E, 0x05, 0x00, 0x3B, 0xAC, 0xAF,
+    0x00, 0xC0, 0x10, 0x9D, 0xFA, 0xBB, 0x84, 0xFB, 0xCF, 0xDB, 0xB3, 0xD7, 0x3F, 0x61, 0x94, 0x3C,
+    0xC7, 0x5C, 0x2C, 0xCF, 0x31, 0x6B, 0xEE, 0xFD, 0xE0, 0xD3, 0x6C, 0x7F, 0xBC, 0xD8, 0x17, 0x3E,
+    0x2E, 0xFA, 0xF5, 0x58, 0x80, 0xA2, 0xAF, 0xE6, 0x22, 0x17, 0x98, 0x73, 0xC9, 0xBC, 0xE3, 0x0B,
+    0xC6, 0x68, 0x4E, 0xDD, 0xCA, 0xCA, 0x77, 0x59, 0xAC, 0x76, 0xEF, 0x6A, 0x86, 0x99, 0xCC, 0x77,
+    0x3E, 0xC9, 0x66, 0x96, 0x41, 0xB0, 0x28, 0xC6, 0x3E, 0x43, 0x73, 0x66, 0x81, 0x05, 0x5C, 0x10,
+    0x3B, 0xB9, 0xD6, 0xFD, 0x5A, 0xDE, 0x3D, 0x62, 0x08, 0x3B, 0x1D, 0x03, 0x11, 0x77, 0x7F, 0x2E,
+    0x62, 0x93, 0xBD, 0x3B, 0x72, 0x00, 0x8C, 0xB1, 0x76, 0x1B, 0x84, 0x4F, 0x24, 0x33, 0xEF, 0x10,
+    0xCE, 0x45, 0x86, 0x5D, 0xF9, 0xE0, 0x8E, 0x32, 0x00, 0xEA, 0x6A, 0xB6, 0xF7, 0x07, 0xFC, 0x2F,
+    0x53, 0x9F, 0x86, 0x9B, 0xD5, 0x68, 0x82, 0x69, 0xA0, 0x27, 0xCD, 0x59, 0x06, 0x72, 0x60, 0xDA,
+    0x11, 0xF9, 0x56, 0x71, 0x5D, 0x55, 0xAF, 0xAE, 0xCE, 0x5C, 0xBB, 0x59, 0x94, 0x87, 0x7C, 0x33,
+    0xEB, 0xD7, 0x97, 0xE2, 0xC6, 0x08, 0x19, 0xAA, 0xFC, 0x2C, 0x1A, 0x7B, 0x35, 0xEF, 0xE8, 0x7D,
+    0x3D, 0x54, 0x0C, 0x51, 0xBE, 0x51, 0xDC, 0xF8, 0x69, 0x32, 0x93, 0x58, 0xC5, 0xEA, 0xF4, 0xB5,
+    0x54, 0xB5, 0x17, 0x09, 0xE4, 0x63, 0xCC, 0x86, 0x61, 0x47, 0xFA, 0xC0, 0xD8, 0x65, 0xF4, 0x9C,
+    0x65, 0x81, 0xDB, 0x85, 0xCA, 0xEE, 0xDE, 0x80, 0xBC, 0x63, 0x44, 0x81, 0xF1, 0x43, 0x44, 0x81,
+    0x9A, 0xFB, 0x97, 0x00, 0xF3, 0x5C, 0x81, 0x13, 0x19, 0x65, 0x88, 0x22, 0xCB, 0x65, 0x88, 0xDA,
+    0xCB, 0xC5, 0x40, 0xCD, 0x05, 0x0F, 0xE0, 0x22, 0x60, 0x9E, 0x2B, 0x63, 0xEC, 0xB3, 0x8C, 0x66,
+    0x96, 0x8B, 0x15, 0x19, 0x14, 0xAB, 0xF2, 0x43, 0xD4, 0xBE, 0xC2, 0x4C, 0x79, 0x88, 0x5D, 0x92,
+    0x8B, 0xC1, 0x89, 0xF9, 0x81, 0xEE, 0x02, 0xEC, 0x64, 0x66, 0xE5, 0x65, 0x18, 0xA2, 0x58, 0x91,
+    0x70, 0xD1, 0x3E, 0x9A, 0x45, 0x52, 0x8B, 0xF2, 0x44, 0x15, 0x71, 0x88, 0x7A, 0x36, 0x53, 0x46,
+    0x1A, 0x97, 0x13, 0xF3, 0x03, 0xF6, 0xD1, 0x2C, 0x83, 0x0C, 0xF6, 0xD1, 0xDC, 0x65, 0x19, 0xCD,
+    0x6C, 0xE6, 0x3C, 0xC4, 0x21, 0xEA, 0xB9, 0xA0, 0x88, 0xA8, 0xBC, 0x9C, 0x7F, 0x2E, 0x62, 0xFF,
+    0xD2, 0x89, 0xF9, 0x8F, 0xD1, 0x01, 0x0F, 0xA1, 0x5B, 0x21, 0x03, 0xFE, 0x4F, 0x3F, 0xBC, 0x86,
+    0x87, 0xBF, 0xD5, 0x87, 0xEF, 0x4B, 0x84, 0x55, 0x78, 0xDC, 0x0D, 0x35, 0xC9, 0x55, 0x26, 0x99,
+    0x65, 0x1E, 0xB3, 0xA8, 0x68, 0x76, 0x16, 0x8C, 0x1F, 0x03, 0x26, 0xE0, 0x74, 0x97, 0xE1, 0x66,
+    0x15, 0x45, 0x81, 0xF3, 0x72, 0x1D, 0xF3, 0x50, 0x86, 0x22, 0x6A, 0x5F, 0xA1, 0x1B, 0x5B, 0x74,
+    0x13, 0xD0, 0x4D, 0x63, 0xC4, 0x3C, 0x2C, 0x32, 0xF5, 0x51, 0xAE, 0x72, 0x1D, 0x93, 0x28, 0x22,
+    0xE8, 0x00, 0x4E, 0x70, 0x33, 0xCC, 0xD2, 0xAC, 0xCE, 0x66, 0x07, 0xEA, 0x80, 0x63, 0x20, 0xE7,
+    0x27, 0xB4, 0x37, 0xB5, 0x2B, 0x66, 0x91, 0x59, 0x54, 0xB3, 0xE8, 0xD2, 0xD7, 0x71, 0x72, 0x9C,
+    0x7E, 0x86, 0xBE, 0x9A, 0x05, 0x18, 0x93, 0x5C, 0x01, 0x1D, 0x44, 0x01, 0xDC, 0x0C, 0x4E, 0x7D,
+    0xED, 0x26, 0xB3, 0x8C, 0x69, 0x5C, 0xE5, 0x3A, 0x06, 0x99, 0xC4, 0xDA, 0xCF, 0x72, 0xC5, 0x02,
+    0xF4, 0x0B, 0x00, 0xE7, 0x9D, 0x97, 0x59, 0x66, 0x70, 0xE6, 0x2C, 0x57, 0xB9, 0x76, 0xEC, 0x08,
+    0x1D, 0x75, 0xEC, 0x6B, 0x5F, 0x61, 0x16, 0xB3, 0x6C, 0xE0, 0x61, 0xE3, 0x87, 0x34, 0x24, 0xB8,
+    0xC9, 0x4D, 0x32, 0x8E, 0x11, 0xC4, 0x11, 0x60, 0xC9, 0x31, 0x1C, 0x83, 0xC8, 0x22, 0xC3, 0x2D,
+    0x6E, 0x19, 0xCB, 0x58, 0x60, 0x67, 0x3B, 0x63, 0xDA, 0x02, 0x4F, 0x2E, 0x09, 0x72, 0x21, 0xB3,
+    0x2E, 0x3C, 0x46, 0xBD, 0x98, 0x17, 0x57, 0xF9, 0x56, 0x16, 0x9F, 0xD5, 0x8E, 0x15, 0xAE, 0x42,
+    0x17, 0xC8, 0xBC, 0x13, 0xF0, 0xDB, 0xEE, 0x99, 0x20, 0x32, 0x7A, 0x4E, 0x70, 0x0B, 0x54, 0x38,
+    0x08, 0x61, 0x39, 0xF2, 0x2A, 0x49, 0xD9, 0x74, 0x1A, 0xFE, 0x12, 0xF8, 0x83, 0x3F, 0x05, 0xBE,
+    0xFD, 0x10, 0xBA, 0x28, 0xA7, 0xFB, 0xFD, 0xC0, 0x0A, 0xB8, 0xF7, 0x8F, 0xD4, 0x16, 0xD0, 0x0F,
+    0x4B, 0x17, 0xBF, 0x01, 0x7C, 0xFF, 0xDB, 0xC0, 0x37, 0xFF, 0x05, 0xF0, 0xCF, 0xB7, 0x27, 0x5C,
+    0x00, 0x06, 0x0F, 0x3C, 0x0C, 0xF4, 0x11, 0x90, 0x00, 0xD2, 0xE1, 0x91, 0x00, 0xA8, 0x76, 0x64,
+    0x0C, 0x80, 0xF5, 0x10, 0xEF, 0x00, 0xFA, 0x5B, 0x40, 0xFC, 0x3E, 0xE4, 0x73, 0x11, 0x4F, 0x0B,
+    0x2F, 0x16, 0xF9, 0xF9, 0x1D, 0x2E, 0x37, 0xE7, 0x67, 0xB7, 0xA1, 0xD1, 0xF6, 0x6D, 0x1F, 0x9E,
+    0xDD, 0xDC, 0x8B, 0x4B, 0x8D, 0x06, 0xCB, 0x8F, 0x52, 0x8B, 0x5D, 0xB1, 0x6D, 0xE7, 0xA1, 0x65,
+    0x3E, 0x30, 0xF0, 0x4A, 0xFB, 0x7D, 0xA7, 0x49, 0x87, 0x21, 0x6F, 0x7B, 0xFC, 0xB2, 0xF2, 0x00,
+    0xF0, 0xCA, 0x31, 0x91, 0x64, 0x00, 0xCC, 0x8C, 0xF3, 0x62, 0xC5, 0xDD, 0x72, 0x01, 0x90, 0xA1,
+    0x4E, 0x45, 0xF4, 0xC1, 0x60, 0x2C, 0x09, 0xE0, 0x8F, 0x27, 0x41, 0x5E, 0xF2, 0x86, 0x1F, 0xA6,
+    0x91, 0x8C, 0x9D, 0x63, 0x85, 0x69, 0x25, 0x0C, 0x93, 0xC9, 0xF7, 0x62, 0xE0, 0x95, 0xC9, 0xDC,
+    0x98, 0x31, 0xDC, 0x59, 0x61, 0xDE, 0x8A, 0x18, 0xB2, 0xC5, 0x10, 0x2A, 0xF0, 0x73, 0xB9, 0xE0,
+    0x0F, 0xB5, 0xC7, 0x71, 0x91, 0x80, 0xE3, 0x13, 0x80, 0xF3, 0xB8, 0xF7, 0xCC, 0xE3, 0x7C, 0x8B,
+    0x2B, 0x37, 0x09, 0xD4, 0xE5, 0x1D, 0x79, 0x0D, 0xF4, 0xE3, 0x37, 0xF5, 0x87, 0xB2, 0xAB, 0xD9,
+    0x1C, 0x23, 0x00, 0xE5, 0x01, 0x98, 0x69, 0x53, 0xAF, 0x7D, 0x06, 0x30, 0xC4, 0xDD, 0x04, 0x99,
+    0x19, 0x4D, 0xF5, 0x1E, 0xDE, 0x6C, 0x0C, 0x07, 0x17, 0xB5, 0x89, 0xE4, 0x34, 0x70, 0xE9, 0x19,
+    0x41, 0xC0, 0xCC, 0x90, 0x0B, 0x86, 0x88, 0x3E, 0x63, 0xFB, 0xB7, 0x5A, 0x30, 0xDE, 0x9E, 0x7B,
+    0x46, 0x30, 0xC1, 0xFC, 0x15, 0xD4, 0x82, 0x31, 0x1E, 0xB1, 0x0F, 0x94, 0xC7, 0x18, 0x21, 0xCA,
+    0x69, 0x30, 0xC1, 0x16, 0xDC, 0xB7, 0xDF, 0x5C, 0x6B, 0x49, 0x2F, 0x18, 0x30, 0xAC, 0xE8, 0x0A,
+    0xE0, 0x00, 0xE3, 0x21, 0xDB, 0xBF, 0x33, 0xE0, 0x70, 0xC2, 0x79, 0xC1, 0xD0, 0x71, 0xC5, 0xD7,
+    0x0F, 0x9E, 0x25, 0x17, 0x0C, 0xEB, 0xE1, 0xB3, 0xBB, 0xBD, 0xA5, 0x67, 0x84, 0xCB, 0x78, 0xE0,
+    0x27, 0x47, 0x6B, 0x58, 0xEE, 0xE7, 0x6C, 0x58, 0x14, 0x29, 0xC8, 0x8F, 0xC9, 0xA4, 0x7F, 0x44,
+    0xF9, 0x4B, 0x5E, 0x99, 0xE5, 0x7A, 0x5A, 0xB4, 0xF2, 0x3C, 0xE3, 0xA1, 0x22, 0xC6, 0x8C, 0xB1,
+    0xA2, 0xE7, 0x24, 0x38, 0x83, 0x01, 0x0C, 0xB0, 0x2B, 0xCC, 0x0A, 0x99, 0x31, 0x66, 0xF4, 0xB5,
+    0x3D, 0x67, 0x37, 0xAE, 0xCF, 0xBF, 0x4E, 0x03, 0xF7, 0x60, 0x77, 0xA3, 0x02, 0x41, 0xC0, 0x79,
+    0x98, 0x88, 0x21, 0xA1, 0x2F, 0xC0, 0x5D, 0x47, 0x51, 0x81, 0x2E, 0xC1, 0x5C, 0x27, 0x17, 0x95,
+    0xC8, 0x3C, 0x64, 0xFD, 0x23, 0xF6, 0x3C, 0xBE, 0xE1, 0xF1, 0x56, 0xB3, 0x60, 0xC8, 0x32, 0x62,
+    0xAC, 0x43, 0x86, 0xAC, 0x7D, 0x85, 0xAC, 0x70, 0x93, 0x2C, 0x30, 0x5B, 0xEC, 0x22, 0x43, 0x24,
+    0xD4, 0x56, 0xA9, 0x79, 0x64, 0x4F, 0x76, 0x93, 0xC8, 0x18, 0x72, 0xCF, 0x49, 0x10, 0xCE, 0x83,
+    0x5E, 0x05, 0x98, 0xE5, 0x68, 0xAA, 0xBA, 0x27, 0x6C, 0x81, 0xCC, 0x9A, 0x15, 0x26, 0x90, 0x19,
+    0x7C, 0xA4, 0xEC, 0xA5, 0x21, 0xF7, 0xD8, 0x81, 0x2C, 0xDD, 0x0C, 0xD1, 0x62, 0x7D, 0x51, 0x46,
+    0x8C, 0x84, 0xF1, 0x70, 0xB1, 0xAB, 0x18, 0x0B, 0xC6, 0x15, 0xC6, 0xC3, 0xF8, 0xBE, 0x00, 0xDC,
+    0xE1, 0x59, 0x76, 0xAF, 0x7B, 0xD0, 0x9D, 0x86, 0xC8, 0x30, 0x0B, 0xF4, 0xDA, 0x71, 0x86, 0x5B,
+    0x86, 0xD2, 0x32, 0x90, 0xC0, 0x84, 0x63, 0xCD, 0x79, 0xCC, 0x24, 0x3F, 0x25, 0xE9, 0xD1, 0x97,
+    0xC6, 0xAA, 0xAE, 0x41, 0x77, 0xCC, 0x76, 0x24, 0x02, 0x9C, 0x0E, 0x8E, 0xD4, 0x83, 0x23, 0x3B,
+    0xE7, 0xD3, 0x90, 0xAB, 0x71, 0xCC, 0x0F, 0x2B, 0x96, 0x87, 0x15, 0xEB, 0xC3, 0x8A, 0xFC, 0x92,
+    0x4F, 0x7D, 0x58, 0x31, 0x3F, 0xAC, 0x98, 0x1E, 0x56, 0x5C, 0x1E, 0x56, 0xF7, 0xE0, 0x61, 0x85,
+    0xAF, 0xF4, 0xF9, 0xA3, 0xFB, 0x00, 0x38, 0xD6, 0x81, 0xAC, 0x8A, 0xAC, 0x86, 0xE9, 0xA4, 0x61,
+    0x3A, 0x69, 0xBF, 0xE4, 0xB3, 0xFB, 0x4E, 0xB1, 0x9D, 0x8F, 0x3D, 0x16, 0xB2, 0x80, 0xA4, 0x27,
+    0x19, 0x93, 0x61, 0x4A, 0x86, 0xF9, 0x3F, 0xF3, 0x49, 0x24, 0x23, 0xC9, 0xC5, 0xF1, 0xD6, 0xA1,
+    0xA8, 0xB2, 0xB8, 0xAB, 0xCB, 0x38, 0x39, 0x2E, 0xE0, 0x25, 0x0C, 0xAC, 0xEE, 0x11, 0xC7, 0x02,
+    0xCB, 0x38, 0xF2, 0xB9, 0xC9, 0x59, 0x8C, 0xA9, 0x40, 0x5E, 0xCD, 0xF8, 0x9A, 0x58, 0x81, 0xAF,
+    0x35, 0x5B, 0x64, 0xCC, 0x32, 0xCB, 0xD4, 0x9F, 0xFF, 0x3C, 0x5F, 0x9E, 0x01, 0x41, 0x10, 0x0E,
+    0x0E, 0x16, 0x27, 0x8F, 0x6C, 0x0B, 0x74, 0xA4, 0xC7, 0xB0, 0x74, 0x11, 0xDF, 0x00, 0xBE, 0x8F,
+    0x6F, 0x03, 0xDF, 0xC4, 0x11, 0x19, 0xFC, 0x4F, 0xF0, 0xFA, 0x4B, 0xE0, 0x0F, 0xF0, 0xA7, 0xC0,
+    0xB7, 0xF1, 0x10, 0xBA, 0x08, 0x39, 0xDD, 0xEF, 0x31, 0xB4, 0x32, 0xC1, 0xF7, 0x0F, 0x4E, 0x2A,
+    0xDB, 0x1C, 0x74, 0x19, 0xF8, 0x99, 0x9A, 0x21, 0x6F, 0xAF, 0xE8, 0xC8, 0x4B, 0x4B, 0xE7, 0x58,
+    0x1A, 0xB8, 0xD3, 0xA6, 0x7B, 0xA0, 0x6F, 0xF8, 0x26, 0x84, 0xF5, 0x10, 0x81, 0xD3, 0x66, 0x02,
+    0xFA, 0xE9, 0x88, 0x90, 0xB7, 0x4D, 0xB2, 0x89, 0xF0, 0x2C, 0x60, 0x3E, 0xF2, 0x18, 0x58, 0xDD,
+    0x74, 0x7C, 0xC3, 0xB4, 0x4E, 0x1D, 0xC3, 0x69, 0x38, 0x07, 0xE8, 0x4F, 0x52, 0x93, 0xE1, 0xFD,
+    0x54, 0xB0, 0xCD, 0x25, 0xD4, 0xA2, 0x5E, 0xCF, 0xF2, 0x3A, 0xC5, 0xEA, 0x9E, 0xCF, 0xC7, 0xA7,
+    0x02, 0xD8, 0x26, 0xDC, 0x9A, 0xF0, 0x6A, 0x32, 0xA7, 0xEE, 0x8E, 0xCA, 0x26, 0xE2, 0xD6, 0x63,
+    0x5D, 0x56, 0xB1, 0x8E, 0xD9, 0xF6, 0xD4, 0xDE, 0xCC, 0x87, 0x46, 0x66, 0xC7, 0x7A, 0x1E, 0x78,
+    0x5A, 0x92, 0x3C, 0xDF, 0x65, 0x4D, 0x92, 0x5C, 0xCD, 0x74, 0x1F, 0xC9, 0xF0, 0x34, 0x70, 0x7C,
+    0x53, 0x31, 0xDD, 0xE9, 0xF6, 0xB1, 0x9C, 0xFA, 0xBA, 0xB7, 0x8C, 0x33, 0xE2, 0xB7, 0x80, 0x6F,
+    0xFF, 0x29, 0xF0, 0xCD, 0x3F, 0x04, 0xEE, 0x82, 0x08, 0xE8, 0x44, 0x98, 0x86, 0x6B, 0xEF, 0x45,
+    0xF9, 0xD9, 0x47, 0xAB, 0x20, 0x17, 0x90, 0xD3, 0x53, 0xE4, 0xBE, 0x25, 0x69, 0x1B, 0x38, 0x12,
+    0x3D, 0xE9, 0xC7, 0x3B, 0x37, 0xE2, 0xF8, 0xD6, 0xF5, 0xD8, 0x9F, 0x0A, 0x1E, 0x22, 0x6C, 0xD9,
+    0x84, 0x63, 0x0D, 0x03, 0x68, 0x22, 0x44, 0x6D, 0x20, 0xC4, 0xBB, 0x8F, 0x08, 0x90, 0x0B, 0x0D,
+    0xD5, 0x55, 0x00, 0xBB, 0xA0, 0x4F, 0x5F, 0x5C, 0x3D, 0xE5, 0x21, 0x6A, 0xBB, 0xBC, 0x00, 0xC7,
+    0x27, 0x98, 0x73, 0xC9, 0x3E, 0xB6, 0xF6, 0xD9, 0x5C, 0xCB, 0x66, 0x96, 0x6F, 0x14, 0x75, 0x35,
+    0x83, 0x32, 0x14, 0xB9, 0x0C, 0xD1, 0x8E, 0xB1, 0xC2, 0x9C, 0x8A, 0x66, 0x88, 0x5D, 0xD2, 0xE7,
+    0x56, 0x83, 0x13, 0xF3, 0xC5, 0x13, 0xCF, 0x5D, 0x38, 0x88, 0xD9, 0xBA, 0xE9, 0x00, 0xF3, 0xD8,
+    0xC2, 0xA4, 0x7A, 0xD9, 0x10, 0xCB, 0x5F, 0x7C, 0xFD, 0xCF, 0x00, 0xEE, 0x6B, 0x95, 0x0E, 0x6A,
+    0x05, 0xC6, 0x62, 0x17, 0x40, 0xC7, 0x57, 0xB0, 0x95, 0xFC, 0x7D, 0xE9, 0xAB, 0x3B, 0x0A, 0xC7,
+    0x3F, 0x84, 0xDF, 0xE2, 0xCF, 0xB6, 0x21, 0x74, 0x13, 0x01, 0x98, 0x57, 0x0B, 0xD0, 0xF3, 0xEC,
+    0x0A, 0x8C, 0xD9, 0x78, 0xFC, 0xBA, 0x54, 0x3B, 0xFA, 0x7A, 0x10, 0x87, 0x43, 0xCE, 0x87, 0xB7,
+    0x7D, 0xF0, 0x37, 0x5E, 0xD0, 0x27, 0x00, 0x45, 0xAD, 0x68, 0xC9, 0x46, 0xE8, 0x48, 0x00, 0xD6,
+    0xBF, 0x04, 0xE0, 0xCF, 0x71, 0x4C, 0x64, 0xFB, 0x76, 0x31, 0xFE, 0xF4, 0x17, 0x2F, 0x34, 0xAF,
+    0x16, 0xFB, 0x56, 0x3E, 0xDE, 0x2C, 0xA1, 0x46, 0x83, 0x89, 0x5B, 0x08, 0xAD, 0xCB, 0x5F, 0xFA,
+    0xAC, 0x7B, 0x80, 0x63, 0x22, 0x03, 0x54, 0x6B, 0x7B, 0x9A, 0x8E, 0x04, 0x8C, 0x3F, 0xFD, 0xB9,
+    0x55, 0x3E, 0xF2, 0x72, 0xD3, 0x96, 0x82, 0x3A, 0x48, 0xE7, 0xE3, 0xF7, 0x01, 0xE0, 0xF8, 0x79,
+    0xEC, 0xF4, 0xFE, 0x85, 0x31, 0x9C, 0x98, 0x44, 0x19, 0x83, 0x59, 0x86, 0x3A, 0x06, 0x1B, 0xDA,
+    0xDF, 0x7D, 0x1A, 0x83, 0x9E, 0xB7, 0x73, 0x8E, 0xFC, 0x34, 0xDC, 0x65, 0xF1, 0x76, 0x3F, 0x37,
+    0xA3, 0xE3, 0xC8, 0x39, 0x5D, 0x1A, 0x83, 0x9A, 0x44, 0x19, 0x83, 0x6D, 0xF7, 0x5C, 0xDA, 0xDF,
+    0xED, 0xF8, 0xEE, 0xCC, 0x21, 0x34, 0xDF, 0xF1, 0x83, 0x6A, 0x96, 0x0B, 0x9B, 0xC4, 0xBA, 0x56,
+    0xCD, 0xA7, 0xF5, 0x44, 0xDB, 0x29, 0x7D, 0xB6, 0x1F, 0x54, 0xB3, 0xFC, 0xD9, 0xBD, 0xFA, 0x06,
+    0x69, 0xA7, 0xEE, 0x5F, 0x57, 0xF2, 0xD3, 0x88, 0x07, 0x0C, 0xC9, 0x07, 0xD1, 0x5F, 0x27, 0xF9,
+    0xC9, 0x4B, 0x38, 0xE2, 0xFF, 0xFE, 0x17, 0xF8, 0xCE, 0xFF, 0xAC, 0xBD, 0xBF, 0xEA, 0x15, 0x26,
+    0xEB, 0x24, 0xE3, 0xB0, 0x08, 0xFF, 0x55, 0xCE, 0xEF, 0x67, 0xA0, 0x9B, 0x84, 0x1F, 0x16, 0x19,
+    0x75, 0x32, 0xF9, 0xAB, 0x5D, 0xD1, 0xCF, 0x63, 0xF8, 0xF6, 0x37, 0xBF, 0xFD, 0xCD, 0x31, 0x7C,
+    0xB5, 0xA7, 0x00, 0x76, 0xFE, 0x2F, 0xA4, 0xDC, 0xCE, 0x92, 0xDE, 0xF1, 0x54, 0xAA, 0xFA, 0x6A,
+    0xAE, 0xF2, 0xFA, 0x6A, 0x7E, 0xB0, 0x14, 0x3B, 0xC4, 0x62, 0xAE, 0xB1, 0x8C, 0x0C, 0x63, 0x01,
+    0x80, 0xEE, 0xBC, 0x11, 0x0B, 0xA4, 0xCF, 0xEA, 0xF9, 0xD5, 0x88, 0x78, 0x72, 0x58, 0x2E, 0x9F,
+    0x98, 0xD1, 0x5D, 0xC4, 0x90, 0x21, 0x33, 0x4C, 0x02, 0xD7, 0xFE, 0xB3, 0x75, 0x7C, 0x3B, 0xAA,
+    0x17, 0xA3, 0xB9, 0x94, 0x2C, 0xF3, 0x53, 0x2E, 0x41, 0x79, 0xE8, 0xB9, 0xDF, 0x7F, 0x49, 0xD1,
+    0x3B, 0x8A, 0x00, 0x39, 0xC1, 0xE6, 0x8E, 0x19, 0xC3, 0x0A, 0xB9, 0xC0, 0xFC, 0xCB, 0xEF, 0x65,
+    0x43, 0xEF, 0x9A, 0xCC, 0xB9, 0x7F, 0x1D, 0x18, 0xEC, 0x8D, 0x53, 0x2B, 0xF4, 0x8C, 0x4A, 0x41,
+    0xAA, 0x37, 0xB2, 0x15, 0x31, 0xAB, 0x6B, 0xB7, 0xEA, 0xC0, 0x38, 0x54, 0x00, 0x38, 0xBE, 0xFF,
+    0x13, 0xC9, 0x22, 0x99, 0x21, 0x12, 0xC6, 0x08, 0xB9, 0xC0, 0xCC, 0x70, 0x40, 0x39, 0x3C, 0xA0,
+    0x67, 0xC0, 0xCD, 0x8A, 0xBE, 0xDA, 0x53, 0xF1, 0x15, 0x79, 0x3D, 0x2A, 0x4E, 0x76, 0x1D, 0xB9,
+    0x5A, 0xF9, 0x49, 0xD2, 0xAF, 0xC5, 0xAA, 0x18, 0x55, 0xF3, 0x6A, 0x5E, 0x99, 0x14, 0x67, 0xBA,
+    0xEF, 0x84, 0x57, 0xCC, 0xA3, 0xA9, 0xC8, 0xF7, 0x2A, 0x4F, 0xB1, 0x74, 0xFF, 0x26, 0xC2, 0xFC,
+    0xF7, 0x4F, 0x66, 0xC5, 0xD9, 0xBE, 0x0F, 0x00, 0xDD, 0x82, 0xEF, 0xE3, 0x1B, 0xDD, 0xCB, 0xFF,
+    0xE0, 0xF8, 0xF7, 0xFF, 0xD7, 0xE9, 0x6F, 0x60, 0x98, 0xBB, 0xF3, 0x38, 0x73, 0xC6, 0xF0, 0xC3,
+    0xFD, 0x0B, 0xC0, 0xC0, 0xFC, 0xD4, 0xFE, 0x0C, 0x58, 0xBE, 0xDA, 0x8C, 0xF2, 0xA7, 0xB1, 0x8A,
+    0x30, 0x7A, 0x39, 0x29, 0x9C, 0xC4, 0xC3, 0x78, 0x08, 0x4F, 0xE3, 0x69, 0x3C, 0x8D, 0x87, 0xF0,
+    0x30, 0x1E, 0x84, 0x02, 0x80, 0x88, 0x15, 0x3F, 0xDB, 0x0E, 0x3F, 0x8D, 0xA7, 0x71, 0x19, 0x09,
+    0x6B, 0x1F, 0xC5, 0x32, 0xCE, 0x0A, 0x4F, 0x6F, 0xDA, 0xEC, 0xB5, 0x38, 0xDC, 0xC8, 0x43, 0xCC,
+    0xE3, 0x92, 0xA5, 0x4F, 0xF2, 0xB9, 0xA4, 0x1E, 0x59, 0x75, 0x1F, 0x8D, 0x88, 0x7F, 0xDC, 0x9F,
+    0x87, 0x9B, 0x24, 0x67, 0x72, 0xBC, 0x59, 0xCC, 0xB9, 0xB5, 0xC8, 0xB7, 0xA3, 0xD9, 0xBB, 0x92,
+    0x9D, 0xFC, 0x24, 0xDB, 0x17, 0x98, 0x25, 0xFD, 0x96, 0x83, 0x3A, 0x7E, 0x7E, 0x28, 0x3D, 0xAF,
+    0x30, 0x6B, 0xCE, 0xD7, 0x57, 0x98, 0x69, 0x88, 0x70, 0x90, 0x01, 0x05, 0xCA, 0x77, 0x19, 0xD8,
+    0x5B, 0x04, 0x93, 0x60, 0xEE, 0x9E, 0x2B, 0xE8, 0x32, 0x44, 0x6E, 0xAD, 0x08, 0xBA, 0x8A, 0x71,
+    0x85, 0xE1, 0x6A, 0x18, 0x2D, 0x23, 0x2E, 0x9D, 0x57, 0x5C, 0x8C, 0xF3, 0x93, 0x45, 0x9F, 0x7A,
+    0xE7, 0xD5, 0x8A, 0xBF, 0x48, 0x18, 0x22, 0xD4, 0xAB, 0x3F, 0xA2, 0x62, 0x6C, 0xE9, 0x5D, 0xF4,
+    0x17, 0x31, 0x64, 0xA8, 0x8D, 0x25, 0xC4, 0x67, 0x71, 0x7C, 0x35, 0xEA, 0xEF, 0x04, 0xBB, 0xB1,
+    0xC4, 0x7F, 0x82, 0xFE, 0x35, 0x96, 0x50, 0x13, 0x5C, 0xEE, 0x0F, 0x59, 0xE2, 0xF7, 0x8E, 0xB2,
+    0xC4, 0x9F, 0xAC, 0x23, 0x17, 0x77, 0x63, 0x58, 0x61, 0x26, 0x54, 0x0E, 0xAC, 0xEA, 0x8D, 0xFC,
+    0xAC, 0xF8, 0x38, 0xA9, 0x6B, 0x37, 0xCB, 0xC8, 0xD0, 0x6A, 0x73, 0x4E, 0xEC, 0x5F, 0x54, 0xCC,
+    0x9A, 0x19, 0x22, 0x42, 0x06, 0x28, 0x0F, 0x33, 0xA1, 0xA2, 0xCF, 0x10, 0x2B, 0x64, 0x84, 0xF6,
+    0x30, 0x13, 0xB0, 0xB7, 0xF4, 0x4C, 0xE2, 0x56, 0x1E, 0x62, 0x16, 0x1F, 0xE7, 0x9E, 0xB1, 0xA3,
+    0x97, 0x8C, 0xE6, 0x5C, 0x32, 0xA7, 0x92, 0x79, 0x61, 0xD5, 0x8C, 0x2D, 0x0B, 0xDB, 0xBD, 0x32,
+    0x69, 0x3E, 0x52, 0x9D, 0x5C, 0xB2, 0x11, 0x6B, 0x96, 0x6F, 0x55, 0x0E, 0xCC, 0xDD, 0x77, 0x02,
+    0xEC, 0xF1, 0xBD, 0x55, 0x73, 0x6A, 0xE1, 0x94, 0xDE, 0xE3, 0xA7, 0xF8, 0x56, 0x7F, 0xE9, 0x27,
+    0xE4, 0x0F, 0x6F, 0x4D, 0xDF, 0xC2, 0x38, 0x75, 0xF3, 0x21, 0x57, 0x68, 0xFE, 0x6A, 0xFF, 0x22,
+    0x60, 0x79, 0x89, 0x11, 0xC0, 0xF7, 0xBB, 0x28, 0x96, 0x71, 0x96, 0xD0, 0x78, 0x78, 0x5B, 0xF2,
+    0xCB, 0xB8, 0x7C, 0xC0, 0x15, 0x40, 0x17, 0x84, 0x97, 0xD3, 0x83, 0xB8, 0xDC, 0xC7, 0xD1, 0x3F,
+    0x88, 0x24, 0x16, 0x85, 0x34, 0xF8, 0x87, 0xFB, 0xA0, 0x01, 0xF4, 0xE9, 0xA7, 0x86, 0x57, 0x93,
+    0x93, 0x3E, 0x3D, 0x2B, 0xDE, 0x5C, 0xD5, 0xE8, 0xB3, 0x7E, 0x31, 0x5A, 0xCE, 0xCF, 0x3E, 0x8C,
+    0xCE, 0x4D, 0xAE, 0xE8, 0x73, 0xD7, 0xC3, 0x33, 0x96, 0xAF, 0xF1, 0xFC, 0x65, 0x8C, 0xE1, 0x6E,
+    0x43, 0xB8, 0xF3, 0x5D, 0x05, 0xB3, 0x7E, 0xF1, 0x7A, 0x3C, 0xF9, 0x8C, 0xF8, 0xC8, 0x3F, 0x7B,
+    0x79, 0x7C, 0xFB, 0xDD, 0x6C, 0x08, 0x37, 0xF7, 0x51, 0xE3, 0xE7, 0x7A, 0x92, 0xEF, 0xCC, 0x3D,
+    0x67, 0xD8, 0x19, 0x7A, 0x81, 0xCE, 0x50, 0x3F, 0x9E, 0xD4, 0xB5, 0x28, 0xFD, 0x65, 0xF4, 0x9C,
+    0x14, 0xE7, 0xD3, 0x06, 0xB8, 0xDC, 0x33, 0x5A, 0x5E, 0x8B, 0x27, 0xE5, 0xB9, 0xA8, 0x39, 0xE9,
+    0x00, 0x5C, 0x40, 0x97, 0xD0, 0xAF, 0xE8, 0x23, 0xC4, 0x07, 0x41, 0x30, 0x0F, 0x6B, 0xE3, 0xD1,
+    0x2C, 0xE7, 0x43, 0x1E, 0x3D, 0x29, 0x02, 0x2E, 0x00, 0xCF, 0x00, 0xBA, 0x45, 0x87, 0xE3, 0xB3,
+    0x48, 0x16, 0xCF, 0x58, 0xE8, 0x67, 0x21, 0x09, 0x41, 0xDF, 0xD5, 0x84, 0xCB, 0x06, 0x66, 0x08,
+    0x72, 0xCE, 0xC0, 0x85, 0x21, 0xA8, 0xE9, 0xB2, 0x88, 0x72, 0x7E, 0xA6, 0x8F, 0xD2, 0x9F, 0xEC,
+    0xD6, 0x71, 0x31, 0x48, 0xE8, 0x5F, 0x0D, 0xAF, 0xE0, 0x4E, 0x75, 0x8B, 0x7D, 0xFC, 0x66, 0xD2,
+    0xA7, 0xD6, 0x93, 0xD2, 0x67, 0x75, 0x2E, 0x3C, 0x3B, 0xBC, 0xB1, 0xEA, 0x47, 0xE3, 0xE5, 0xD1,
+    0x67, 0x23, 0xE2, 0x49, 0x39, 0xAF, 0x6A, 0x12, 0xAF, 0x06, 0xE5, 0x82, 0x3B, 0x7B, 0x75, 0x35,
+    0xD2, 0xA7, 0x93, 0xC3, 0x1B, 0xAB, 0xFE, 0x8E, 0xBF, 0x6C, 0x44, 0x4C, 0x72, 0xC2, 0x27, 0xA9,
+    0x63, 0xE9, 0xB3, 0xED, 0xA3, 0x11, 0xC1, 0x88, 0xE5, 0xE4, 0xB0, 0xFC, 0x7C, 0xFC, 0x38, 0x4B,
+    0x46, 0xF9, 0xE3, 0x59, 0x4D, 0xD0, 0x80, 0x69, 0x65, 0xFE, 0x55, 0xF0, 0xCD, 0xF5, 0xEE, 0x57,
+    0x20, 0x13, 0xDC, 0x3C, 0x7C, 0xFC, 0x48, 0x76, 0x45, 0x25, 0x74, 0x8B, 0xF0, 0xAA, 0xD8, 0xA2,
+    0x66, 0x3D, 0x19, 0x18, 0x9C, 0xC4, 0xB3, 0xB0, 0xB1, 0x99, 0x2F, 0x18, 0xB6, 0x8E, 0x3B, 0x92,
+    0x05, 0x63, 0x7D, 0x12, 0x43, 0xD9, 0x25, 0x3F, 0xFB, 0xFD, 0x8B, 0xE6, 0x0A, 0xA9, 0xA2, 0xE3,
+    0x0B, 0xD9, 0xF0, 0x0D, 0xCA, 0x08, 0xF3, 0x41, 0x6A, 0x5D, 0x36, 0xD8, 0xDA, 0xC9, 0x79, 0xC8,
+    0xD8, 0xBC, 0xF5, 0xAE, 0x9E, 0x01, 0xDC, 0x96, 0x1C, 0x93, 0x3C, 0x30, 0x4A, 0x86, 0x6B, 0x1E,
+    0xF8, 0xD6, 0x83, 0xAD, 0xC1, 0xD2, 0xB0, 0x95, 0x9A, 0xCF, 0x92, 0x77, 0x32, 0x1C, 0x1F, 0x0B,
+    0x03, 0x1F, 0x7A, 0x18, 0xE6, 0xE3, 0x77, 0x63, 0xC7, 0xC7, 0xBF, 0x33, 0x8D, 0xF9, 0xE9, 0x87,
+    0x60, 0xDE, 0x7B, 0x37, 0x80, 0x8F, 0xCB, 0x49, 0x94, 0xEF, 0x3F, 0x0D, 0xF9, 0xD9, 0x9B, 0x01,
+    0x86, 0x12, 0x70, 0xE9, 0xFB, 0xE8, 0x78, 0xFD, 0xA3, 0x23, 0x5D, 0x14, 0x06, 0x72, 0xC6, 0x83,
+    0x7B, 0x13, 0x10, 0x57, 0xA0, 0x7F, 0x7E, 0x3E, 0x84, 0xAD, 0xBE, 0x8F, 0xB1, 0x41, 0x0D, 0x0B,
+    0x78, 0xFB, 0x92, 0xD7, 0x19, 0xF7, 0x88, 0x1D, 0x4C, 0xB0, 0x41, 0x04, 0xFB, 0x7F, 0x17, 0x75,
+    0x34, 0x56, 0xD4, 0x81, 0xD1, 0x04, 0xF7, 0x0F, 0xA2, 0xC8, 0x08, 0xB3, 0x54, 0x88, 0xAA, 0x16,
+    0x98, 0x4F, 0x0A, 0x7A, 0xEE, 0x5D, 0x81, 0x64, 0x6D, 0x5D, 0xDB, 0xFA, 0xF6, 0xC4, 0x1D, 0x50,
+    0x50, 0x91, 0x7E, 0x87, 0x6F, 0xF6, 0x82, 0x5C, 0x61, 0xBF, 0xD0, 0x11, 0x8E, 0x3F, 0x7C, 0x62,
+    0x77, 0x5E, 0x6B, 0x01, 0x77, 0xD0, 0x71, 0xE7, 0xFE, 0x72, 0x1A, 0x23, 0x39, 0x81, 0x8C, 0x38,
+    0xC6, 0x33, 0x47, 0x13, 0xE2, 0xE1, 0x68, 0x47, 0x8B, 0xA9, 0x45, 0x74, 0x0C, 0x33, 0x7A, 0xFE,
+    0x28, 0x34, 0xDB, 0xCA, 0x6E, 0x40, 0xE6, 0xEE, 0x52, 0xFD, 0x09, 0xC6, 0x0D, 0x8C, 0xDD, 0x2A,
+    0x1C, 0xBA, 0xBD, 0x9B, 0xA7, 0x5B, 0xB1, 0x98, 0x63, 0x2B, 0x73, 0x68, 0xE3, 0x19, 0x13, 0xD0,
+    0xF1, 0xC3, 0xFD, 0xF3, 0xE3, 0xD6, 0x43, 0xAF, 0x60, 0x43, 0xC5, 0x6E, 0xF4, 0x6C, 0x61, 0xE4,
+    0x6E, 0xDD, 0x85, 0x9B, 0xB2, 0x5E, 0x59, 0x60, 0x35, 0x1D, 0xBD, 0xBE, 0x41, 0x32, 0x49, 0x9E,
+    0xE5, 0xDB, 0x14, 0xEC, 0xE8, 0xAD, 0xE7, 0x6C, 0x17, 0x15, 0x5B, 0xB1, 0xB7, 0x0E, 0x63, 0x12,
+    0xA5, 0x35, 0x32, 0x3C, 0x95, 0x7B, 0xC2, 0x5C, 0x61, 0x47, 0xAF, 0xA2, 0xF3, 0x0C, 0x63, 0xD2,
+    0xC1, 0xAD, 0xA2, 0xC8, 0xD5, 0x16, 0x50, 0x64, 0x43, 0xD8, 0x2B, 0xD4, 0xCE, 0xAB, 0x08, 0x35,
+    0x03, 0x80, 0xF4, 0xD8, 0xFA, 0x63, 0x1D, 0x49, 0x62, 0x8F, 0xCB, 0x50, 0x91, 0xE1, 0x82, 0xF4,
+    0x92, 0x5D, 0x06, 0xA3, 0x9E, 0xE5, 0x0D, 0xB1, 0x76, 0xB7, 0xA3, 0x81, 0xE3, 0xCB, 0xB7, 0x14,
+    0xC9, 0x37, 0xDC, 0xA5, 0x4B, 0xFF, 0x49, 0x7C, 0xBC, 0x96, 0xCE, 0xED, 0xFD, 0x78, 0xB1, 0x24,
+    0x1F, 0x23, 0x19, 0xA5, 0xBF, 0xBD, 0x76, 0x59, 0x3A, 0xE8, 0x99, 0xB1, 0x4F, 0x92, 0x30, 0x93,
+    0x0B, 0x22, 0x8E, 0x05, 0xB6, 0x55, 0xDE, 0xD5, 0x09, 0x5B, 0x25, 0x17, 0x04, 0xB9, 0x00, 0x5D,
+    0xC3, 0xDA, 0xBA, 0x47, 0x5A, 0x26, 0xDF, 0x2C, 0x4F, 0x40, 0x46, 0xB9, 0x9E, 0xC4, 0x90, 0x45,
+    0xD1, 0x53, 0x5F, 0x7B, 0xCA, 0x05, 0xEE, 0x51, 0xFE, 0x98, 0xC1, 0x90, 0x37, 0xB8, 0x4A, 0xF2,
+    0x35, 0xE6, 0x81, 0x9C, 0xED, 0xD4, 0xF3, 0xAF, 0xA1, 0xFD, 0x61, 0x3F, 0x9C, 0xA6, 0x8D, 0x50,
+    0x31, 0x24, 0xC0, 0xCE, 0x7D, 0x01, 0x14, 0x3D, 0x01, 0xC1, 0x68, 0x3C, 0x60, 0xD3, 0x0E, 0xA0,
+    0x6B, 0xEB, 0xD4, 0x0A, 0x4D, 0x7D, 0xC3, 0x2D, 0x6F, 0xED, 0xF7, 0x26, 0x00, 0x14, 0x15, 0xC0,
+    0x90, 0x65, 0x52, 0x9C, 0x74, 0xD0, 0xEF, 0x91, 0xE0, 0xCC, 0x1F, 0x33, 0x89, 0x32, 0x16, 0xF7,
+    0x88, 0x97, 0xB7, 0xF9, 0x69, 0xEB, 0xAD, 0x20, 0x13, 0x7A, 0x32, 0xE8, 0x04, 0x49, 0xC2, 0x14,
+    0x98, 0x6B, 0x19, 0x26, 0x77, 0x94, 0x2B, 0x74, 0x1A, 0xB2, 0x0E, 0xD0, 0x51, 0x07, 0x3B, 0xC3,
+    0xCE, 0x7C, 0x84, 0x7F, 0xD4, 0x57, 0x91, 0x45, 0x76, 0x8C, 0x2A, 0xCA, 0x5F, 0x91, 0x93, 0x9B,
+    0xCD, 0x07, 0x87, 0xED, 0x64, 0xFA, 0xB5, 0x4F, 0x5D, 0x92, 0x8B, 0x0C, 0x72, 0x31, 0x93, 0x9B,
+    0x0D, 0xB2, 0xA8, 0x7D, 0x12, 0x51, 0x25, 0xB9, 0x48, 0xCF, 0x60, 0x61, 0xC4, 0x8D, 0xE7, 0x13,
+    0xB2, 0x7E, 0x46, 0x7A, 0x11, 0xF3, 0x6A, 0xB1, 0xF7, 0xD1, 0x9D, 0x8F, 0xAA, 0x20, 0xC9, 0x3C,
+    0xD6, 0x4A, 0xBE, 0x34, 0x7C, 0xF0, 0xE6, 0xA7, 0x2B, 0xD4, 0xDE, 0xF8, 0xBA, 0xC7, 0xCF, 0x93,
+    0x7E, 0x16, 0xFD, 0x9D, 0xE5, 0x95, 0x88, 0x91, 0x3D, 0x3D, 0x74, 0x1A, 0x0B, 0xE0, 0xBC, 0x8E,
+    0x10, 0x15, 0xCE, 0x43, 0xAE, 0xA2, 0x00, 0xD0, 0x4C, 0x50, 0x5E, 0x90, 0xA9, 0xCF, 0x30, 0xE4,
+    0x62, 0xFC, 0x70, 0xEB, 0xBB, 0x14, 0x09, 0x0E, 0xE3, 0x6A, 0xA7, 0x31, 0x5E, 0x34, 0x8F, 0x45,
+    0x54, 0x7D, 0x6D, 0x75, 0x90, 0x6F, 0x66, 0xFB, 0x78, 0xE8, 0x8A, 0x79, 0x31, 0x56, 0xE8, 0x6B,
+    0xC9, 0xA9, 0x45, 0x64, 0xFB, 0xF8, 0x7B, 0x19, 0xE6, 0xC5, 0x58, 0xB5, 0x17, 0x2B, 0xD5, 0x5B,
+    0x09, 0x56, 0xBE, 0x97, 0xCD, 0x34, 0xC6, 0x62, 0x5E, 0x8D, 0xA0, 0xBA, 0x7A, 0x81, 0x90, 0xEF,
+    0x65, 0xE8, 0xA5, 0x2B, 0xC6, 0xDF, 0x9F, 0xA1, 0xAF, 0x91, 0x9C, 0xFA, 0x6C, 0xC9, 0x05, 0xE6,
+    0x45, 0xF2, 0xFC, 0xE7, 0x01, 0x0A, 0xAD, 0xDF, 0x46, 0xAB, 0x0F, 0xAB, 0x80, 0xE5, 0x56, 0x24,
+    0xDF, 0x9D, 0xB6, 0x33, 0x74, 0x76, 0x33, 0x1C, 0x39, 0xF5, 0x24, 0x21, 0xF8, 0x18, 0x5B, 0xC3,
+    0x2D, 0xB9, 0xF6, 0x05, 0x2A, 0xF6, 0xB9, 0x15, 0x5D, 0xEA, 0x20, 0x32, 0x74, 0x18, 0x13, 0x74,
+    0x94, 0x2B, 0x74, 0xB2, 0x11, 0x92, 0x8C, 0x18, 0xF9, 0x51, 0x44, 0xCF, 0x17, 0xC3, 0x91, 0xDA,
+    0x85, 0x7B, 0xCF, 0x9C, 0x69, 0x9D, 0x67, 0xF0, 0xD4, 0xFE, 0xFE, 0xA1, 0x4F, 0xBE, 0xB6, 0xF2,
+    0x08, 0xC3, 0x0C, 0x59, 0xCF, 0xCE, 0x3D, 0xA7, 0xBB, 0x61, 0x96, 0x06, 0x1D, 0x38, 0xC1, 0x0F,
+    0x67, 0x34, 0x20, 0x33, 0x3D, 0x4C, 0x00, 0xBE, 0x5E, 0x9F, 0x68, 0x9C, 0x6D, 0x99, 0x0F, 0xD0,
+    0x7D, 0xCD, 0x03, 0x14, 0xFC, 0x51, 0x84, 0x22, 0x01, 0xC7, 0x88, 0x8E, 0x65, 0xC3, 0xB7, 0x99,
+    0x65, 0x2C, 0x30, 0x5E, 0x25, 0x58, 0x6F, 0x22, 0x9C, 0xA7, 0x07, 0x9F, 0xE7, 0x04, 0x9E, 0xAA,
+    0x00, 0x65, 0x46, 0x47, 0x1D, 0x1B, 0xA8, 0xE0, 0x4F, 0xC8, 0x0F, 0x5B, 0xE9, 0x92, 0x25, 0x6B,
+    0x63, 0xDC, 0x86, 0x80, 0x5C, 0xCD, 0xD2, 0x8A, 0x0E, 0x54, 0xD4, 0xB1, 0xB5, 0x20, 0xD3, 0x41,
+    0x26, 0x98, 0x45, 0xE6, 0x16, 0x11, 0x1C, 0x49, 0x9E, 0x22, 0xF9, 0x06, 0xC9, 0x68, 0xC9, 0x84,
+    0x96, 0x97, 0xF8, 0xCB, 0x06, 0x52, 0xB0, 0xA5, 0xC1, 0xA9, 0x65, 0x02, 0x54, 0xF9, 0x43, 0x68,
+    0xBE, 0x02, 0xCD, 0x8A, 0x5E, 0x97, 0x76, 0x70, 0x2C, 0x80, 0xE2, 0x86, 0xBE, 0xD6, 0xE1, 0xB0,
+    0xAF, 0xC0, 0x21, 0x88, 0xB2, 0x4E, 0x2D, 0x14, 0xDE, 0xBA, 0x67, 0x6D, 0x1D, 0x11, 0x7F, 0xE8,
+    0xEA, 0x36, 0x95, 0x0B, 0xD0, 0xEA, 0x90, 0xB0, 0xA1, 0xAA, 0x1A, 0xDA, 0x19, 0x80, 0x9B, 0xB7,
+    0xB2, 0x90, 0x5D, 0x4B, 0x08, 0x36, 0xA4, 0x99, 0xF5, 0x7B, 0xEF, 0x77, 0x15, 0x3A, 0x3A, 0x4E,
+    0x6E, 0x96, 0xC9, 0xDD, 0x88, 0x66, 0x19, 0xB3, 0xF1, 0x45, 0xC6, 0xA1, 0x2A, 0x6F, 0x5E, 0xC8,
+    0x23, 0xC7, 0x28, 0xDF, 0xE3, 0x25, 0x9E, 0xCA, 0xC3, 0x4A, 0x72, 0xE2, 0xBF, 0xC9, 0x86, 0x15,
+    0x96, 0x45, 0xF2, 0x7D, 0xE8, 0x1B, 0xA5, 0xA5, 0xE3, 0x4E, 0x1F, 0x6D, 0x4A, 0x58, 0x3F, 0xD7,
+    0x9B, 0xB0, 0x15, 0x69, 0xEF, 0x5C, 0x7A, 0x71, 0x24, 0xA6, 0xD1, 0x35, 0xAC, 0xDD, 0x0A, 0x28,
+    0x66, 0xC0, 0x7C, 0x92, 0x01, 0x7B, 0x65, 0xF7, 0xC3, 0x5D, 0xCB, 0x80, 0xBB, 0x96, 0x00, 0xFB,
+    0x5A, 0x04, 0xEC, 0x8D, 0xA5, 0xF5, 0xAB, 0x69, 0x88, 0x0D, 0x95, 0x81, 0xFF, 0x46, 0x26, 0xE0,
+    0x21, 0x95, 0x81, 0x9F, 0x9B, 0x8C, 0xAE, 0xB2, 0x40, 0xF0, 0xB3, 0x0A, 0x79, 0xE3, 0xBD, 0x0A,
+    0xFD, 0xF8, 0xF3, 0xC4, 0xB3, 0x63, 0x47, 0xE0, 0xAE, 0xEE, 0x00, 0xED, 0x27, 0x2A, 0x80, 0x27,
+    0xCB, 0x0E, 0x0B, 0xC8, 0x9D, 0x3F, 0x6F, 0xEB, 0xB4, 0x53, 0x5D, 0x19, 0xF2, 0x36, 0x43, 0xC7,
+    0x9E, 0x20, 0x59, 0x14, 0xC9, 0xC5, 0x78, 0x15, 0xBE, 0x5E, 0xBE, 0x57, 0x4F, 0x91, 0x4C, 0xBA,
+    0x5E, 0xAA, 0x13, 0x1F, 0xE3, 0x24, 0x77, 0xE8, 0x1A, 0xC5, 0x84, 0xBE, 0x9E, 0xFE, 0xD2, 0x4E,
+    0xA7, 0xD3, 0x41, 0x68, 0x1A, 0xD2, 0x03, 0x03, 0x6F, 0xA1, 0xDF, 0xAA, 0x78, 0x57, 0x41, 0x3A,
+    0x6F, 0x4A, 0x3A, 0xD6, 0xF1, 0x5A, 0x80, 0xCC, 0x72, 0x82, 0x0D, 0x4F, 0xA3, 0x67, 0x1F, 0x21,
+    0x93, 0xFC, 0xF0, 0xA2, 0x59, 0x0C, 0x3F, 0xE6, 0x23, 0xE4, 0x0B, 0x79, 0x64, 0x51, 0x51, 0xCB,
+    0x68, 0x97, 0x64, 0x3D, 0xCF, 0xBD, 0x59, 0x05, 0xCF, 0xCA, 0x34, 0xB0, 0xB8, 0x45, 0xB2, 0x75,
+    0x74, 0xCA, 0xCD, 0x76, 0xE8, 0x56, 0x00, 0xE3, 0x61, 0x7F, 0xA2, 0xA1, 0x62, 0x6B, 0xE4, 0xD2,
+    0x35, 0x7A, 0x1B, 0x56, 0x04, 0x80, 0xB9, 0xB1, 0x00, 0xEA, 0x83, 0x15, 0x90, 0x37, 0x0B, 0x04,
+    0x49, 0x76, 0x24, 0xE9, 0x7B, 0xB6, 0xEE, 0x62, 0xC4, 0xC8, 0x96, 0xF2, 0x27, 0xB1, 0x77, 0xF3,
+    0x7B, 0x65, 0x92, 0x6B, 0x6B, 0xBC, 0x62, 0x16, 0x51, 0x30, 0xAE, 0x1D, 0x37, 0x34, 0x8A, 0x9B,
+    0x9D, 0xDF, 0x0A, 0xAC, 0x01, 0xB8, 0x02, 0x38, 0xA6, 0x56, 0xAD, 0x64, 0x5E, 0x26, 0xBA, 0x49,
+    0x1E, 0xF4, 0x37, 0x8C, 0xF7, 0xED, 0xBF, 0xCC, 0x73, 0x24, 0xF3, 0x7D, 0x8E, 0xB7, 0x27, 0xC9,
+    0x8C, 0xAF, 0xB3, 0x9E, 0x19, 0xD9, 0x8A, 0x6F, 0xEA, 0x61, 0xD7, 0xA1, 0x8A, 0x63, 0xD0, 0xB7,
+    0x9E, 0x0C, 0x20, 0xEB, 0xAE, 0xF2, 0x69, 0xD7, 0xB8, 0x74, 0xB3, 0x89, 0x7C, 0xB3, 0x8B, 0x76,
+    0x46, 0xCB, 0x22, 0x48, 0x07, 0x93, 0x2E, 0xDF, 0xD3, 0xF1, 0xDC, 0x6E, 0x4A, 0x97, 0xC3, 0x29,
+    0xF5, 0x30, 0xCB, 0x49, 0x80, 0xD3, 0x0A, 0x91, 0x07, 0x0F, 0x19, 0x35, 0x60, 0x96, 0x04, 0xF0,
+    0x5C, 0x80, 0xE0, 0xE3, 0x8F, 0x60, 0x60, 0xBD, 0xDC, 0xE4, 0x98, 0x6C, 0x0D, 0xC8, 0x6E, 0xE1,
+    0xC8, 0x94, 0x1E, 0x6B, 0x71, 0xFE, 0x63, 0x13, 0x44, 0x1C, 0x22, 0xFA, 0x2C, 0x12, 0x50, 0xBB,
+    0x82, 0x9E, 0x24, 0x07, 0x92, 0xBC, 0x42, 0x92, 0xF1, 0xFE, 0x72, 0xF6, 0xD6, 0xE9, 0x06, 0x01,
+    0xE3, 0x44, 0xC0, 0x78, 0xEB, 0xA1, 0xA2, 0x0E, 0x2D, 0x05, 0x29, 0x8A, 0xC8, 0x5B, 0x3D, 0xE4,
+    0xEE, 0x9B, 0x75, 0x1A, 0xD3, 0xC0, 0x55, 0x14, 0xB0, 0x80, 0x50, 0xC4, 0xE7, 0x3B, 0x65, 0x8C,
+    0x6C, 0x4D, 0x09, 0x3C, 0xB0, 0x6B, 0x94, 0x31, 0x41, 0x54, 0xDC, 0xFD, 0xB9, 0xA6, 0x36, 0x36,
+    0x00, 0xAD, 0x31, 0xD9, 0x76, 0x07, 0xD7, 0x3A, 0x31, 0xC4, 0x83, 0xC3, 0x32, 0x77, 0x17, 0xFE,
+    0xFC, 0x8F, 0x8D, 0xB7, 0xEF, 0xDC, 0xF8, 0x34, 0x8F, 0xC6, 0x5E, 0x32, 0xFE, 0x3F, 0xBC, 0xF7,
+    0xF1, 0x9D, 0x55, 0xD4, 0x67, 0x15, 0xB7, 0x3A, 0x3F, 0x47, 0x2E, 0x90, 0xDF, 0x79, 0x7B, 0x01,
+    0xD6, 0x9F, 0x3D, 0x0D, 0x1C, 0xEB, 0xBA, 0xA9, 0x95, 0x20, 0x89, 0x8D, 0xC2, 0x26, 0xE4, 0x0E,
+    0x0A, 0x2A, 0xB7, 0x83, 0x8E, 0x4C, 0xF7, 0x5D, 0xBA, 0x7D, 0x11, 0xA2, 0xEC, 0x5A, 0xA2, 0xF8,
+    0xA3, 0x2D, 0x51, 0x7E, 0xC3, 0x41, 0x8C, 0xE4, 0x6A, 0xC8, 0x85, 0x3C, 0x83, 0xFB, 0x9B, 0x48,
+    0x74, 0xE4, 0x29, 0xB2, 0x1C, 0xFB, 0x5E, 0x3D, 0x0D, 0xB5, 0x76, 0x2F, 0x73, 0x1E, 0x99, 0x60,
+    0xEA, 0x04, 0xCE, 0xE8, 0x78, 0xD8, 0xAF, 0x4B, 0xAE, 0x9B, 0x3A, 0x5B, 0xB6, 0xF6, 0x5E, 0x53,
+    0x8B, 0x63, 0x1A, 0x0F, 0x18, 0x7F, 0x37, 0xEC, 0x2F, 0x02, 0x1C, 0xC3, 0x71, 0xD6, 0x49, 0x71,
+    0x82, 0xE6, 0xF1, 0xB9, 0x6B, 0xBD, 0x43, 0x26, 0xC3, 0xF3, 0xB0, 0x19, 0xF8, 0xDF, 0x33, 0xEA,
+    0x90, 0xFA, 0x3A, 0xAE, 0x22, 0xCB, 0x75, 0xCC, 0x32, 0xEA, 0x55, 0xFD, 0x8A, 0x41, 0xB7, 0xF6,
+    0xA5, 0x30, 0x0C, 0x9B, 0x41, 0x79, 0x50, 0xBD, 0x1D, 0x81, 0xF1, 0xDA, 0x02, 0x9C, 0x94, 0x13,
+    0x90, 0x1F, 0x6E, 0x73, 0xB0, 0x8E, 0xCD, 0xA4, 0xDC, 0xFE, 0x0A, 0x62, 0x81, 0x9C, 0xD5, 0xD7,
+    0xEE, 0x7E, 0x10, 0x4F, 0x97, 0xF0, 0xD3, 0x9E, 0x7C, 0xDB, 0xCB, 0xDB, 0x77, 0x2A, 0xCC, 0xA9,
+    0xE1, 0x7C, 0x93, 0x13, 0x2B, 0x80, 0x8F, 0xEA, 0xFF, 0x81, 0xE6, 0x5E, 0x68, 0x7A, 0x40, 0x1D,
+    0xE9, 0xA1, 0xDA, 0xCA, 0xCA, 0xF4, 0x91, 0x32, 0xE1, 0xA3, 0xC5, 0xC2, 0x6E, 0x02, 0xB0, 0xC7,
+    0x5B, 0x6D, 0x65, 0x3C, 0x0C, 0x37, 0x5F, 0x84, 0xA9, 0xE3, 0xF3, 0x45, 0x66, 0x51, 0x45, 0x1E,
+    0xF2, 0x90, 0x45, 0x16, 0x79, 0x4C, 0x43, 0x16, 0x59, 0xAE, 0x63, 0x1A, 0xB2, 0x8C, 0xE3, 0x3A,
+    0x26, 0x19, 0x8F, 0x9D, 0x6E, 0x5D, 0x78, 0xE5, 0xAA, 0x03, 0xD0, 0xFA, 0xE7, 0xAA, 0x68, 0x3C,
+    0xA0, 0x03, 0x46, 0xDE, 0xDA, 0xCC, 0x83, 0x0D, 0xEA, 0x9F, 0xA1, 0xA2, 0x5E, 0xE1, 0x66, 0xB3,
+    0x88, 0x02, 0x4E, 0x32, 0x0E, 0x19, 0xD6, 0x9B, 0x78, 0x9C, 0x4F, 0x72, 0x72, 0xAD, 0x30, 0x81,
+    0xB3, 0x24, 0xDF, 0xC7, 0xFD, 0xE5, 0x74, 0xB3, 0xFA, 0x8F, 0xF3, 0xC3, 0xAD, 0xC7, 0x00, 0x19,
+    0xD1, 0xB9, 0xBF, 0xDF, 0x5C, 0xB1, 0x5D, 0x77, 0xE9, 0xBF, 0xFD, 0x5F, 0x01, 0xC4, 0xB8, 0xFD,
+    0x38, 0xCE, 0xB5, 0x99, 0x09, 0x82, 0xAC, 0x50, 0x4D, 0x50, 0x9E, 0xFB, 0x7F, 0xE0, 0x3E, 0x78,
+    0x61, 0x06, 0x5F, 0x7B, 0x6C, 0xEA, 0x29, 0xC7, 0x49, 0x50, 0xCA, 0x26, 0xCA, 0x45, 0xF9, 0xDC,
+    0x8F, 0xD6, 0xD9, 0x8F, 0x07, 0x35, 0xFC, 0x7A, 0x05, 0xEE, 0xBB, 0xC4, 0xDB, 0xB3, 0xD9, 0x1C,
+    0x04, 0x4E, 0xB6, 0x75, 0x87, 0xFA, 0xDB, 0xBF, 0x05, 0x1E, 0x7A, 0x08, 0x90, 0xBF, 0xB7, 0x83,
+    0x3F, 0x26, 0x28, 0x72, 0x1E, 0xC9, 0x28, 0xCA, 0xD8, 0xCA, 0x82, 0x8C, 0xB7, 0x5E, 0x05, 0x13,
+    0xC6, 0xEA, 0xA2, 0x68, 0x65, 0x9C, 0x01, 0x86, 0x84, 0x0A, 0x76, 0x19, 0x57, 0x99, 0x44, 0x16,
+    0x15, 0x04, 0x67, 0xEB, 0xDD, 0xA2, 0x6E, 0x33, 0x8E, 0x4D, 0xAA, 0xAF, 0x20, 0x17, 0x88, 0x6B,
+    0xBE, 0x51, 0xF5, 0xED, 0x6F, 0x03, 0x07, 0xA0, 0xB4, 0x26, 0x44, 0x4E, 0x03, 0x7D, 0x0B, 0xD4,
+    0x8C, 0x0C, 0xAC, 0x80, 0xE2, 0x1B, 0xCC, 0x80, 0x89, 0xA7, 0xD8, 0x1A, 0x86, 0x34, 0x35, 0x32,
+    0xE4, 0xD6, 0x46, 0xA5, 0x35, 0xE2, 0xD8, 0x8A, 0x3F, 0xC9, 0x05, 0xC7, 0x78, 0x66, 0xEF, 0xE6,
+    0x84, 0x8E, 0xBB, 0xFE, 0xD9, 0x3A, 0x00, 0xAD, 0x07, 0x04, 0x44, 0x69, 0xED, 0xA8, 0xF2, 0xCE,
+    0x7D, 0x73, 0x4D, 0x1D, 0x6D, 0x3E, 0xDC, 0x06, 0x55, 0x6E, 0xC2, 0x78, 0x6B, 0xC1, 0xDD, 0x57,
+    0x00, 0x3A, 0x6C, 0xA0, 0xE5, 0xCD, 0xA5, 0x13, 0xAD, 0xA9, 0xC7, 0x98, 0x81, 0x3F, 0xE1, 0xF3,
+    0x6E, 0x05, 0x0C, 0x05, 0x23, 0x60, 0x8A, 0xE0, 0x02, 0x98, 0xB0, 0xEB, 0xF7, 0xBB, 0xA5, 0x13,
+    0xB2, 0xF1, 0x80, 0xAB, 0x2A, 0x02, 0x96, 0xDF, 0xC9, 0x80, 0x8E, 0x53, 0xD9, 0xAD, 0x75, 0x93,
+    0x4F, 0x03, 0xB3, 0x8A, 0x90, 0xE4, 0x98, 0x31, 0x90, 0xE7, 0x2A, 0x70, 0xF6, 0xE6, 0xC4, 0x09,
+    0x43, 0x86, 0xF1, 0xE8, 0x1B, 0x3D, 0x9C, 0xC7, 0xBC, 0xB5, 0x4D, 0x81, 0x8C, 0x38, 0xFC, 0xBA,
+    0xEE, 0xBE, 0x4E, 0xBB, 0xAF, 0xD5, 0xEE, 0x6B, 0x7B, 0xF8, 0xF5, 0x91, 0x56, 0xC9, 0x3A, 0x02,
+    0xE8, 0x2F, 0x25, 0xEC, 0x34, 0x5F, 0x43, 0x85, 0xEF, 0x60, 0xE1, 0x47, 0xC7, 0xBE, 0x1C, 0x8E,
+    0xFD, 0xB1, 0x0C, 0xE8, 0xF8, 0x68, 0xDD, 0xCD, 0x57, 0x7B, 0xFA, 0xEF, 0x76, 0xEC, 0xE5, 0x0B,
+    0x63, 0xD7, 0xFF, 0x98, 0xB1, 0x9F, 0x6E, 0xB5, 0xE0, 0x3D, 0xDF, 0x2D, 0x1B, 0x33, 0x99, 0x88,
+    0x8E, 0x45, 0xF1, 0x5A, 0xDD, 0xF8, 0x49, 0xF9, 0x1D, 0x4B, 0xEC, 0x58, 0xAA, 0xD5, 0x73, 0xD7,
+    0x31, 0x6D, 0x5C, 0xC5, 0xA9, 0x6B, 0x05, 0xDA, 0xB1, 0x31, 0xD6, 0x23, 0xDC, 0x78, 0x43, 0xC7,
+    0xC6, 0x5B, 0x7D, 0x05, 0x4C, 0x68, 0x9D, 0x44, 0x44, 0xD9, 0x78, 0xC3, 0xF8, 0x36, 0xF4, 0x21,
+    0xC3, 0xF9, 0x31, 0x01, 0x6E, 0x6E, 0x7D, 0x7F, 0xE5, 0xDA, 0x9A, 0x97, 0xB4, 0x04, 0xF5, 0xEE,
+    0x5E, 0xAD, 0x3D, 0x41, 0xBB, 0x97, 0x0E, 0x8D, 0x57, 0xDB, 0x1D, 0x0F, 0xB9, 0x0D, 0x63, 0xE3,
+    0xD6, 0x1D, 0xC3, 0x41, 0x30, 0x36, 0x88, 0xEE, 0xC6, 0x73, 0x10, 0xF5, 0xB0, 0x8D, 0xE4, 0x8E,
+    0xFC, 0x91, 0xDE, 0x25, 0xEB, 0x01, 0x57, 0x25, 0xDF, 0xAB, 0xC0, 0xC0, 0xD5, 0xB6, 0xCA, 0x86,
+    0x78, 0x8A, 0x77, 0x19, 0x0F, 0xB4, 0x52, 0xD7, 0xCD, 0xEE, 0x1D, 0x9A, 0x87, 0xC9, 0xA4, 0xC3,
+    0xC1, 0x04, 0xC0, 0x92, 0xE4, 0xA9, 0x0C, 0x9C, 0xBD, 0xF9, 0x5D, 0x3E, 0xD1, 0x60, 0xDC, 0x6D,
+    0xEF, 0x1C, 0xCC, 0x80, 0x4C, 0x1B, 0x5D, 0x66, 0x11, 0x19, 0xC6, 0x03, 0xDC, 0xB6, 0xD0, 0xC1,
+    0x14, 0xE8, 0xD0, 0x9A, 0xB7, 0xB4, 0x13, 0x1B, 0x7C, 0xBF, 0xD1, 0xB6, 0x9B, 0x03, 0x58, 0xDF,
+    0xF6, 0x62, 0x5F, 0xDB, 0x94, 0xEE, 0xF6, 0xE4, 0xE1, 0x24, 0xF4, 0xDC, 0xD6, 0xDE, 0xA5, 0x3F,
+    0x61, 0xF3, 0xEA, 0xFD, 0x8E, 0x01, 0xDA, 0x2C, 0x80, 0xF3, 0x21, 0x17, 0x34, 0xD5, 0x74, 0xBC,
+    0x79, 0x08, 0xEE, 0xA0, 0x2B, 0xC0, 0x04, 0x98, 0x55, 0x35, 0x9D, 0xAB, 0x62, 0x93, 0x00, 0x1E,
+    0x30, 0xCB, 0xC0, 0x0A, 0x10, 0xE4, 0x8A, 0x21, 0x0F, 0xA4, 0x87, 0x8E, 0xC7, 0x79, 0x66, 0x5B,
+    0xBF, 0xDD, 0x9A, 0x34, 0xDE, 0x85, 0xF5, 0xA2, 0xD5, 0x0E, 0x34, 0x45, 0xD1, 0x7A, 0x9C, 0x2D,
+    0x5B, 0x4D, 0xAD, 0x5C, 0x81, 0x21, 0xC3, 0xBC, 0x3B, 0x41, 0x07, 0x90, 0x00, 0x27, 0xC1, 0x0C,
+    0x91, 0x21, 0x18, 0xA0, 0x22, 0x70, 0x7A, 0xD7, 0x4F, 0xA5, 0xC9, 0x8A, 0xE3, 0x2E, 0x62, 0x87,
+    0xD4, 0x06, 0x5C, 0x6E, 0x8E, 0xC0, 0x7C, 0x04, 0x42, 0x01, 0x6C, 0xF9, 0x68, 0x70, 0xEB, 0xC6,
+    0xDA, 0x5A, 0xDA, 0x06, 0x95, 0x81, 0xAE, 0x15, 0x77, 0x0E, 0x11, 0x9C, 0xA0, 0x18, 0x46, 0x66,
+    0xD1, 0xFE, 0xDF, 0x0B, 0x9A, 0x75, 0x24, 0x3D, 0xE7, 0xBF, 0xFD, 0x7A, 0x7D, 0x62, 0x9B, 0x55,
+    0x99, 0x01, 0xE3, 0x1B, 0xCE, 0x09, 0x30, 0xAD, 0x58, 0x52, 0xB3, 0x21, 0xE0, 0x6B, 0x13, 0x84,
+    0x59, 0x64, 0x6C, 0x9D, 0x87, 0xFE, 0xA8, 0xE3, 0xEC, 0xDE, 0x98, 0x1C, 0x73, 0xC7, 0xD2, 0x93,
+    0x8B, 0xE0, 0x3A, 0x6C, 0xED, 0x29, 0xEE, 0x39, 0x52, 0xB2, 0x07, 0x00, 0xCB, 0x51, 0x48, 0x53,
+    0x5B, 0x12, 0xB9, 0xAD, 0x4C, 0x73, 0xC5, 0xFE, 0x61, 0x6F, 0x01, 0xB0, 0x42, 0x2E, 0x80, 0xF4,
+    0x90, 0x0B, 0xC0, 0xFF, 0x2D, 0xE8, 0x05, 0x92, 0xF4, 0x76, 0x01, 0xC9, 0x9E, 0x8B, 0x24, 0x57,
+    0xC9, 0x85, 0xE4, 0xE4, 0xF8, 0x76, 0xB3, 0x1B, 0x5E, 0x20, 0x67, 0x32, 0x0D, 0xAC, 0x03, 0x39,
+    0x0F, 0x4C, 0xBA, 0x99, 0xD2, 0xE4, 0x8C, 0xA1, 0x81, 0x95, 0x87, 0x32, 0x70, 0x06, 0x86, 0xE6,
+    0xEF, 0x0D, 0x8B, 0x99, 0x01, 0x0C, 0x6F, 0xA7, 0x36, 0x79, 0x47, 0x5B, 0x83, 0x0E, 0x6D, 0x6A,
+    0xEF, 0x02, 0xF0, 0xFF, 0x03,
 };
 
 static const EpdGlyph notosans_14_bolditalicGlyphs[] = {
@@ -2219,7 +2253,7 @@ static const EpdGlyph notosans_14_bolditalicGlyphs[] = {
     { 4, 30, 16, 6, 23, 30, 7604 }, // |
     { 13, 26, 10, -2, 21, 85, 7634 }, // }
     { 15, 6, 17, 1, 13, 23, 7719 }, // ~
-    { 0, 0, 8, 0, 0, 0, 0 }, //  
+    { 0, 0, 8, 0, 0, 0, 7742 }, //  
     { 10, 22, 8, -2, 16, 55, 0 }, // ¡
     { 14, 23, 16, 2, 22, 81, 55 }, // ¢
     { 19, 22, 16, -1, 22, 105, 136 }, // £
@@ -2230,774 +2264,781 @@ static const EpdGlyph notosans_14_bolditalicGlyphs[] = {
     { 11, 4, 16, 5, 22, 11, 509 }, // ¨
     { 22, 23, 24, 1, 22, 127, 520 }, // ©
     { 11, 12, 11, 2, 22, 33, 647 }, // ª
-    { 16, 14, 17, 1, 15, 56, 680 }, // «
-    { 15, 9, 17, 1, 12, 34, 736 }, // ¬
-    { 9, 4, 9, 0, 10, 9, 770 }, // ­
-    { 22, 23, 24, 1, 22, 127, 779 }, // ®
-    { 15, 4, 12, 2, 26, 15, 906 }, // ¯
-    { 11, 11, 12, 1, 22, 31, 921 }, // °
-    { 15, 19, 17, 1, 19, 72, 952 }, // ±
-    { 12, 13, 11, 1, 25, 39, 1024 }, // ²
-    { 11, 14, 11, 2, 25, 39, 1063 }, // ³
-    { 9, 6, 9, 3, 23, 14, 1102 }, // ´
-    { 19, 23, 18, -1, 16, 110, 1116 }, // µ
-    { 16, 27, 19, 2, 23, 108, 1226 }, // ¶
-    { 7, 6, 8, 1, 13, 11, 1334 }, // ·
-    { 7, 7, 6, -3, 0, 13, 1345 }, // ¸
-    { 10, 13, 11, 2, 25, 33, 1358 }, // ¹
-    { 10, 11, 11, 2, 21, 28, 1391 }, // º
-    { 16, 14, 16, 0, 15, 56, 1419 }, // »
-    { 22, 21, 24, 2, 21, 116, 1475 }, // ¼
-    { 23, 21, 26, 2, 21, 121, 1591 }, // ½
-    { 24, 21, 25, 1, 21, 126, 1712 }, // ¾
-    { 13, 23, 14, -1, 17, 75, 1838 }, // ¿
-    { 19, 28, 18, -2, 28, 133, 1913 }, // À
-    { 20, 28, 18, -2, 28, 140, 2046 }, // Á
-    { 20, 28, 18, -2, 28, 140, 2186 }, // Â
-    { 21, 28, 18, -2, 28, 147, 2326 }, // Ã
-    { 20, 27, 18, -2, 27, 135, 2473 }, // Ä
-    { 19, 30, 18, -2, 30, 143, 2608 }, // Å
-    { 30, 21, 26, -2, 21, 158, 2751 }, // Æ
-    { 19, 29, 18, 1, 22, 138, 2909 }, // Ç
-    { 17, 28, 16, 0, 28, 119, 3047 }, // È
-    { 17, 28, 16, 0, 28, 119, 3166 }, // É
-    { 17, 28, 16, 0, 28, 119, 3285 }, // Ê
-    { 17, 27, 16, 0, 27, 115, 3404 }, // Ë
-    { 14, 28, 11, -1, 28, 98, 3519 }, // Ì
-    { 16, 28, 11, -1, 28, 112, 3617 }, // Í
-    { 16, 28, 11, -1, 28, 112, 3729 }, // Î
-    { 15, 27, 11, -1, 27, 102, 3841 }, // Ï
-    { 19, 21, 20, 0, 21, 100, 3943 }, // Ð
-    { 23, 28, 22, 0, 28, 161, 4043 }, // Ñ
-    { 20, 29, 21, 1, 28, 145, 4204 }, // Ò
-    { 20, 29, 21, 1, 28, 145, 4349 }, // Ó
-    { 20, 29, 21, 1, 28, 145, 4494 }, // Ô
-    { 20, 29, 21, 1, 28, 145, 4639 }, // Õ
-    { 20, 28, 21, 1, 27, 140, 4784 }, // Ö
-    { 14, 14, 17, 2, 17, 49, 4924 }, // ×
-    { 20, 24, 21, 1, 22, 120, 4973 }, // Ø
-    { 20, 29, 20, 1, 28, 145, 5093 }, // Ù
-    { 20, 29, 20, 1, 28, 145, 5238 }, // Ú
-    { 20, 29, 20, 1, 28, 145, 5383 }, // Û
-    { 20, 28, 20, 1, 27, 140, 5528 }, // Ü
-    { 18, 28, 16, 2, 28, 126, 5668 }, // Ý
-    { 17, 21, 18, 0, 21, 90, 5794 }, // Þ
-    { 23, 30, 19, -4, 23, 173, 5884 }, // ß
-    { 16, 24, 17, 1, 23, 96, 6057 }, // à
-    { 16, 24, 17, 1, 23, 96, 6153 }, // á
-    { 16, 24, 17, 1, 23, 96, 6249 }, // â
-    { 17, 24, 17, 1, 23, 102, 6345 }, // ã
-    { 16, 23, 17, 1, 22, 92, 6447 }, // ä
-    { 16, 26, 17, 1, 25, 104, 6539 }, // å
-    { 24, 18, 25, 1, 17, 108, 6643 }, // æ
-    { 14, 24, 14, 1, 17, 84, 6751 }, // ç
-    { 15, 24, 16, 1, 23, 90, 6835 }, // è
-    { 15, 24, 16, 1, 23, 90, 6925 }, // é
-    { 16, 24, 16, 1, 23, 96, 7015 }, // ê
-    { 15, 23, 16, 1, 22, 87, 7111 }, // ë
-    { 9, 23, 9, 0, 23, 52, 7198 }, // ì
-    { 12, 23, 9, 0, 23, 69, 7250 }, // í
-    { 12, 23, 9, 0, 23, 69, 7319 }, // î
-    { 12, 22, 9, 0, 22, 66, 7388 }, // ï
-    { 16, 24, 17, 1, 23, 96, 7454 }, // ð
-    { 18, 23, 18, 0, 23, 104, 7550 }, // ñ
-    { 15, 24, 17, 1, 23, 90, 7654 }, // ò
-    { 15, 24, 17, 1, 23, 90, 7744 }, // ó
-    { 15, 24, 17, 1, 23, 90, 7834 }, // ô
-    { 16, 24, 17, 1, 23, 96, 7924 }, // õ
-    { 15, 23, 17, 1, 22, 87, 8020 }, // ö
-    { 15, 15, 17, 1, 18, 57, 8107 }, // ÷
-    { 17, 19, 17, 0, 17, 81, 8164 }, // ø
-    { 17, 24, 18, 1, 23, 102, 8245 }, // ù
-    { 17, 24, 18, 1, 23, 102, 8347 }, // ú
-    { 17, 24, 18, 1, 23, 102, 8449 }, // û
-    { 17, 23, 18, 1, 22, 98, 8551 }, // ü
-    { 20, 30, 15, -3, 23, 150, 8649 }, // ý
-    { 18, 30, 17, -1, 23, 135, 8799 }, // þ
-    { 20, 29, 15, -3, 22, 145, 8934 }, // ÿ
-    { 20, 26, 18, -2, 26, 130, 0 }, // Ā
-    { 16, 22, 17, 1, 21, 88, 130 }, // ā
-    { 20, 28, 18, -2, 28, 140, 218 }, // Ă
-    { 16, 24, 17, 1, 23, 96, 358 }, // ă
-    { 19, 29, 18, -2, 21, 138, 454 }, // Ą
-    { 16, 25, 17, 1, 17, 100, 592 }, // ą
-    { 19, 29, 18, 1, 28, 138, 692 }, // Ć
-    { 15, 24, 14, 1, 23, 90, 830 }, // ć
-    { 19, 29, 18, 1, 28, 138, 920 }, // Ĉ
-    { 15, 24, 14, 1, 23, 90, 1058 }, // ĉ
-    { 19, 29, 18, 1, 28, 138, 1148 }, // Ċ
-    { 14, 24, 14, 1, 23, 84, 1286 }, // ċ
-    { 19, 29, 18, 1, 28, 138, 1370 }, // Č
-    { 16, 24, 14, 1, 23, 96, 1508 }, // č
-    { 20, 28, 20, 0, 28, 140, 1604 }, // Ď
-    { 24, 24, 20, 1, 23, 144, 1744 }, // ď
-    { 19, 21, 20, 0, 21, 100, 1888 }, // Đ
-    { 19, 24, 17, 1, 23, 114, 1988 }, // đ
-    { 17, 26, 16, 0, 26, 111, 2102 }, // Ē
-    { 15, 22, 16, 1, 21, 83, 2213 }, // ē
-    { 18, 28, 16, 0, 28, 126, 2296 }, // Ĕ
-    { 15, 24, 16, 1, 23, 90, 2422 }, // ĕ
-    { 17, 28, 16, 0, 28, 119, 2512 }, // Ė
-    { 15, 24, 16, 1, 23, 90, 2631 }, // ė
-    { 17, 29, 16, 0, 21, 124, 2721 }, // Ę
-    { 15, 24, 16, 1, 17, 90, 2845 }, // ę
-    { 19, 28, 16, 0, 28, 133, 2935 }, // Ě
-    { 17, 24, 16, 1, 23, 102, 3068 }, // ě
-    { 19, 29, 20, 1, 28, 138, 3170 }, // Ĝ
-    { 17, 30, 17, 0, 23, 128, 3308 }, // ĝ
-    { 19, 29, 20, 1, 28, 138, 3436 }, // Ğ
-    { 17, 30, 17, 0, 23, 128, 3574 }, // ğ
-    { 19, 29, 20, 1, 28, 138, 3702 }, // Ġ
-    { 17, 30, 17, 0, 23, 128, 3840 }, // ġ
-    { 19, 29, 20, 1, 22, 138, 3968 }, // Ģ
-    { 17, 30, 17, 0, 23, 128, 4106 }, // ģ
-    { 21, 28, 20, 0, 28, 147, 4234 }, // Ĥ
-    { 17, 29, 18, 0, 29, 124, 4381 }, // ĥ
-    { 23, 21, 20, 0, 21, 121, 4505 }, // Ħ
-    { 16, 23, 18, 0, 23, 92, 4626 }, // ħ
-    { 16, 28, 11, -1, 28, 112, 4718 }, // Ĩ
-    { 13, 23, 9, 0, 23, 75, 4830 }, // ĩ
-    { 15, 26, 11, -1, 26, 98, 4905 }, // Ī
-    { 12, 21, 9, 0, 21, 63, 5003 }, // ī
-    { 16, 28, 11, -1, 28, 112, 5066 }, // Ĭ
-    { 13, 23, 9, 0, 23, 75, 5178 }, // ĭ
-    { 14, 29, 11, -1, 21, 102, 5253 }, // Į
-    { 12, 31, 9, -2, 23, 93, 5355 }, // į
-    { 14, 28, 11, -1, 28, 98, 5448 }, // İ
-    { 9, 16, 9, 0, 16, 36, 5546 }, // ı
-    { 23, 28, 21, -1, 21, 161, 5582 }, // Ĳ
-    { 19, 30, 17, 0, 23, 143, 5743 }, // ĳ
-    { 19, 35, 10, -5, 28, 167, 5886 }, // Ĵ
-    { 16, 30, 9, -4, 23, 120, 6053 }, // ĵ
-    { 21, 28, 18, 0, 21, 147, 6173 }, // Ķ
-    { 18, 30, 17, 0, 23, 135, 6320 }, // ķ
-    { 18, 16, 17, 0, 16, 72, 6455 }, // ĸ
-    { 15, 28, 15, 0, 28, 105, 6527 }, // Ĺ
-    { 14, 29, 9, 0, 29, 102, 6632 }, // ĺ
-    { 14, 28, 15, 0, 21, 98, 6734 }, // Ļ
-    { 12, 30, 9, -2, 23, 90, 6832 }, // ļ
-    { 17, 21, 15, 0, 21, 90, 6922 }, // Ľ
-    { 16, 23, 11, 0, 23, 92, 7012 }, // ľ
-    { 15, 21, 15, 0, 21, 79, 7104 }, // Ŀ
-    { 14, 23, 13, 0, 23, 81, 7183 }, // ŀ
-    { 15, 21, 15, -1, 21, 79, 7264 }, // Ł
-    { 11, 23, 10, 0, 23, 64, 7343 }, // ł
-    { 23, 28, 22, 0, 28, 161, 7407 }, // Ń
-    { 17, 23, 18, 0, 23, 98, 7568 }, // ń
-    { 23, 28, 22, 0, 21, 161, 7666 }, // Ņ
-    { 17, 24, 18, 0, 17, 102, 7827 }, // ņ
-    { 23, 28, 22, 0, 28, 161, 7929 }, // Ň
-    { 18, 23, 18, 0, 23, 104, 8090 }, // ň
-    { 20, 21, 21, 0, 21, 105, 8194 }, // ŉ
-    { 23, 28, 22, 0, 21, 161, 8299 }, // Ŋ
-    { 17, 24, 18, 0, 17, 102, 8460 }, // ŋ
-    { 20, 27, 21, 1, 26, 135, 8562 }, // Ō
-    { 15, 22, 17, 1, 21, 83, 8697 }, // ō
-    { 20, 29, 21, 1, 28, 145, 8780 }, // Ŏ
-    { 16, 24, 17, 1, 23, 96, 8925 }, // ŏ
-    { 22, 29, 21, 1, 28, 160, 9021 }, // Ő
-    { 19, 24, 17, 1, 23, 114, 9181 }, // ő
-    { 27, 23, 26, 1, 22, 156, 9295 }, // Œ
-    { 24, 18, 26, 1, 17, 108, 9451 }, // œ
-    { 18, 28, 18, 0, 28, 126, 9559 }, // Ŕ
-    { 15, 23, 12, 0, 23, 87, 9685 }, // ŕ
-    { 18, 28, 18, 0, 21, 126, 9772 }, // Ŗ
-    { 15, 24, 12, -1, 17, 90, 9898 }, // ŗ
-    { 19, 28, 18, 0, 28, 133, 9988 }, // Ř
-    { 16, 23, 12, 0, 23, 92, 10121 }, // ř
-    { 17, 29, 15, 0, 28, 124, 10213 }, // Ś
-    { 15, 24, 14, 0, 23, 90, 10337 }, // ś
-    { 17, 29, 15, 0, 28, 124, 10427 }, // Ŝ
-    { 15, 24, 14, 0, 23, 90, 10551 }, // ŝ
-    { 16, 29, 15, 0, 22, 116, 10641 }, // Ş
-    { 14, 24, 14, 0, 17, 84, 10757 }, // ş
-    { 18, 29, 15, 0, 28, 131, 10841 }, // Š
-    { 16, 24, 14, 0, 23, 96, 10972 }, // š
-    { 16, 28, 16, 2, 21, 112, 11068 }, // Ţ
-    { 12, 27, 12, 1, 20, 81, 11180 }, // ţ
-    { 16, 28, 16, 2, 28, 112, 11261 }, // Ť
-    { 15, 24, 12, 1, 23, 90, 11373 }, // ť
-    { 16, 21, 16, 2, 21, 84, 11463 }, // Ŧ
-    { 13, 21, 12, 0, 20, 69, 11547 }, // ŧ
-    { 20, 29, 20, 1, 28, 145, 11616 }, // Ũ
-    { 17, 24, 18, 1, 23, 102, 11761 }, // ũ
-    { 20, 27, 20, 1, 26, 135, 11863 }, // Ū
-    { 17, 22, 18, 1, 21, 94, 11998 }, // ū
-    { 20, 29, 20, 1, 28, 145, 12092 }, // Ŭ
-    { 17, 24, 18, 1, 23, 102, 12237 }, // ŭ
-    { 20, 31, 20, 1, 30, 155, 12339 }, // Ů
-    { 17, 26, 18, 1, 25, 111, 12494 }, // ů
-    { 21, 29, 20, 1, 28, 153, 12605 }, // Ű
-    { 19, 24, 18, 1, 23, 114, 12758 }, // ű
-    { 20, 29, 20, 1, 21, 145, 12872 }, // Ų
-    { 17, 24, 18, 1, 16, 102, 13017 }, // ų
-    { 27, 28, 26, 2, 28, 189, 13119 }, // Ŵ
-    { 24, 23, 23, 1, 23, 138, 13308 }, // ŵ
-    { 18, 28, 16, 2, 28, 126, 13446 }, // Ŷ
-    { 20, 30, 15, -3, 23, 150, 13572 }, // ŷ
-    { 18, 27, 16, 2, 27, 122, 13722 }, // Ÿ
-    { 19, 28, 16, -1, 28, 133, 13844 }, // Ź
-    { 16, 23, 14, -1, 23, 92, 13977 }, // ź
-    { 19, 28, 16, -1, 28, 133, 14069 }, // Ż
-    { 15, 23, 14, -1, 23, 87, 14202 }, // ż
-    { 19, 28, 16, -1, 28, 133, 14289 }, // Ž
-    { 17, 23, 14, -1, 23, 98, 14422 }, // ž
-    { 18, 30, 10, -4, 23, 135, 14520 }, // ſ
-    { 8, 6, 0, -13, 23, 12, 0 }, // ̀
-    { 9, 6, 0, -7, 23, 14, 12 }, // ́
-    { 12, 6, 0, -4, 23, 18, 26 }, // ̂
-    { 13, 6, 0, -13, 23, 20, 44 }, // ̃
-    { 10, 4, 0, -3, 21, 10, 64 }, // ̄
-    { 14, 4, 0, -4, 25, 14, 74 }, // ̅
-    { 11, 6, 0, -3, 23, 17, 88 }, // ̆
-    { 5, 6, 0, 0, 23, 8, 105 }, // ̇
-    { 11, 4, 0, -3, 22, 11, 113 }, // ̈
-    { 7, 8, 0, -9, 25, 14, 124 }, // ̉
-    { 8, 8, 0, -1, 25, 16, 138 }, // ̊
-    { 14, 6, 0, -3, 23, 21, 154 }, // ̋
-    { 12, 6, 0, -3, 23, 18, 175 }, // ̌
-    { 5, 9, 0, 0, 23, 12, 193 }, // ̍
-    { 10, 6, 0, -2, 23, 15, 205 }, // ̎
-    { 12, 6, 0, -14, 23, 18, 220 }, // ̏
-    { 11, 8, 0, -3, 25, 22, 238 }, // ̐
-    { 11, 6, 0, -3, 23, 17, 260 }, // ̑
-    { 8, 8, 0, -2, 21, 16, 277 }, // ̒
-    { 8, 8, 0, -2, 21, 16, 293 }, // ̓
-    { 5, 8, 0, 0, 21, 10, 309 }, // ̔
-    { 8, 8, 0, -2, 21, 16, 319 }, // ̕
-    { 7, 6, 0, -6, -1, 11, 335 }, // ̖
-    { 9, 6, 0, -7, -1, 14, 346 }, // ̗
-    { 7, 7, 0, -6, 0, 13, 360 }, // ̘
-    { 7, 7, 0, -6, 0, 13, 373 }, // ̙
-    { 10, 9, 9, 2, 23, 23, 386 }, // ̚
-    { 9, 8, 0, -2, 23, 18, 409 }, // ̛
-    { 5, 7, 0, -2, 0, 9, 427 }, // ̜
-    { 7, 6, 0, -6, -1, 11, 436 }, // ̝
-    { 8, 6, 0, -6, -1, 12, 447 }, // ̞
-    { 7, 7, 0, -6, 0, 13, 459 }, // ̟
-    { 7, 3, 0, -6, -3, 6, 472 }, // ̠
-    { 9, 9, 0, -7, 2, 21, 478 }, // ̡
-    { 8, 9, 0, -4, 2, 18, 499 }, // ̢
-    { 6, 6, 0, -14, -1, 9, 517 }, // ̣
-    { 11, 4, 0, -8, -2, 11, 526 }, // ̤
-    { 8, 8, 0, -6, 0, 16, 537 }, // ̥
-    { 7, 6, 0, 1, -1, 11, 553 }, // ̦
-    { 8, 7, 0, -6, 0, 14, 564 }, // ̧
-    { 7, 8, 0, -6, 0, 14, 578 }, // ̨
-    { 6, 9, 0, -5, 0, 14, 592 }, // ̩
-    { 13, 6, 0, -9, -1, 20, 606 }, // ̪
-    { 12, 5, 0, -8, -1, 15, 626 }, // ̫
-    { 13, 6, 0, -8, -1, 20, 641 }, // ̬
-    { 13, 6, 0, -9, -1, 20, 661 }, // ̭
-    { 12, 6, 0, -8, -1, 18, 681 }, // ̮
-    { 11, 6, 0, -8, -1, 17, 699 }, // ̯
-    { 13, 6, 0, -9, -1, 20, 716 }, // ̰
-    { 11, 4, 0, -8, -2, 11, 736 }, // ̱
-    { 14, 3, 0, -9, -2, 11, 747 }, // ̲
-    { 14, 7, 0, -10, 0, 25, 758 }, // ̳
-    { 13, 6, 0, -7, 11, 20, 783 }, // ̴
-    { 13, 4, 0, -7, 10, 13, 803 }, // ̵
-    { 22, 4, 0, -11, 10, 22, 816 }, // ̶
-    { 12, 9, 0, -6, 13, 27, 838 }, // ̷
-    { 18, 25, 0, -9, 23, 113, 865 }, // ̸
-    { 6, 7, 0, -3, 0, 11, 978 }, // ̹
-    { 12, 6, 0, -8, -1, 18, 989 }, // ̺
-    { 12, 7, 0, -8, 0, 21, 1007 }, // ̻
-    { 12, 5, 0, -8, -1, 15, 1028 }, // ̼
-    { 8, 7, 0, -1, 23, 14, 1043 }, // ̽
-    { 7, 10, 0, -1, 26, 18, 1057 }, // ̾
-    { 14, 7, 0, -4, 29, 25, 1075 }, // ̿
-    { 7, 6, 0, -3, 23, 11, 1100 }, // ̀
-    { 8, 6, 0, 0, 23, 12, 1111 }, // ́
-    { 13, 6, 0, 4, 23, 20, 1123 }, // ͂
-    { 6, 6, 0, 0, 23, 9, 1143 }, // ̓
-    { 17, 6, 0, -5, 23, 26, 1152 }, // ̈́
-    { 6, 6, 0, -4, -1, 9, 1178 }, // ͅ
-    { 13, 6, 0, -4, 23, 20, 1187 }, // ͆
-    { 14, 7, 0, -10, 0, 25, 1207 }, // ͇
-    { 10, 6, 0, -7, 0, 15, 1232 }, // ͈
-    { 6, 6, 0, -5, -1, 9, 1247 }, // ͉
-    { 11, 7, 0, -3, 23, 20, 1256 }, // ͊
-    { 12, 12, 0, -3, 28, 36, 1276 }, // ͋
-    { 12, 9, 0, -3, 26, 27, 1312 }, // ͌
-    { 11, 6, 0, -8, -1, 17, 1339 }, // ͍
-    { 6, 7, 0, -5, 0, 11, 1356 }, // ͎
-    { 22, 21, 0, -11, 21, 116, 1367 }, // ͏
-    { 5, 7, 0, 0, 24, 9, 1483 }, // ͐
-    { 6, 7, 0, 3, 25, 11, 1492 }, // ͑
-    { 11, 8, 0, -3, 25, 22, 1503 }, // ͒
-    { 7, 7, 0, -5, 0, 13, 1525 }, // ͓
-    { 6, 6, 0, -5, -1, 9, 1538 }, // ͔
-    { 6, 6, 0, -4, -1, 9, 1547 }, // ͕
-    { 12, 6, 0, -7, -1, 18, 1556 }, // ͖
-    { 6, 7, 0, 2, 24, 11, 1574 }, // ͗
-    { 5, 6, 0, 0, 23, 8, 1585 }, // ͘
-    { 7, 6, 0, -6, -1, 11, 1593 }, // ͙
-    { 12, 7, 0, -8, 0, 21, 1604 }, // ͚
-    { 6, 6, 0, 0, 23, 9, 1625 }, // ͛
-    { 23, 6, 0, -13, -1, 35, 1634 }, // ͜
-    { 23, 6, 0, -9, 23, 35, 1669 }, // ͝
-    { 17, 4, 0, -6, 21, 17, 1704 }, // ͞
-    { 16, 4, 0, -10, -1, 16, 1721 }, // ͟
-    { 24, 6, 0, -9, 23, 36, 1737 }, // ͠
-    { 23, 7, 0, -8, 26, 41, 1773 }, // ͡
-    { 24, 7, 0, -15, 0, 42, 1814 }, // ͢
-    { 8, 8, 0, -1, 25, 16, 1856 }, // ͣ
-    { 8, 8, 0, -1, 25, 16, 1872 }, // ͤ
-    { 5, 9, 0, 1, 27, 12, 1888 }, // ͥ
-    { 8, 8, 0, -1, 25, 16, 1900 }, // ͦ
-    { 8, 8, 0, -1, 25, 16, 1916 }, // ͧ
-    { 7, 8, 0, 0, 25, 14, 1932 }, // ͨ
-    { 9, 10, 0, -1, 27, 23, 1946 }, // ͩ
-    { 8, 9, 0, -1, 27, 18, 1969 }, // ͪ
-    { 12, 7, 0, -3, 25, 21, 1987 }, // ͫ
-    { 7, 7, 0, 0, 25, 13, 2008 }, // ͬ
-    { 6, 9, 0, 0, 26, 14, 2021 }, // ͭ
-    { 7, 7, 0, 0, 25, 13, 2035 }, // ͮ
-    { 9, 7, 0, -2, 25, 16, 2048 }, // ͯ
-    { 17, 28, 15, 0, 28, 119, 0 }, // Ѐ
-    { 17, 28, 15, 0, 28, 119, 119 }, // Ё
-    { 18, 22, 21, 2, 21, 99, 238 }, // Ђ
-    { 18, 28, 15, 0, 28, 126, 337 }, // Ѓ
-    { 18, 23, 18, 1, 22, 104, 463 }, // Є
-    { 16, 23, 15, 0, 22, 92, 567 }, // Ѕ
-    { 10, 21, 9, 0, 21, 53, 659 }, // І
-    { 13, 28, 9, 0, 28, 91, 712 }, // Ї
-    { 15, 28, 9, -5, 21, 105, 803 }, // Ј
-    { 30, 22, 28, -2, 21, 165, 908 }, // Љ
-    { 27, 21, 27, 0, 21, 142, 1073 }, // Њ
-    { 18, 21, 21, 2, 21, 95, 1215 }, // Ћ
-    { 21, 28, 18, 0, 28, 147, 1310 }, // Ќ
-    { 21, 28, 20, 0, 28, 147, 1457 }, // Ѝ
-    { 21, 29, 17, 0, 28, 153, 1604 }, // Ў
-    { 21, 26, 20, 0, 21, 137, 1757 }, // Џ
-    { 19, 21, 18, -2, 21, 100, 1894 }, // А
-    { 17, 21, 17, 0, 21, 90, 1994 }, // Б
-    { 19, 21, 18, 0, 21, 100, 2084 }, // В
-    { 17, 21, 15, 0, 21, 90, 2184 }, // Г
-    { 24, 26, 21, -3, 21, 156, 2274 }, // Д
-    { 17, 21, 15, 0, 21, 90, 2430 }, // Е
-    { 31, 21, 26, -2, 21, 163, 2520 }, // Ж
-    { 17, 23, 17, 0, 22, 98, 2683 }, // З
-    { 21, 21, 20, 0, 21, 111, 2781 }, // И
-    { 21, 28, 20, 0, 28, 147, 2892 }, // Й
-    { 21, 21, 18, 0, 21, 111, 3039 }, // К
-    { 22, 22, 20, -1, 21, 121, 3150 }, // Л
-    { 26, 21, 25, 0, 21, 137, 3271 }, // М
-    { 21, 21, 20, 0, 21, 111, 3408 }, // Н
-    { 20, 23, 21, 1, 22, 115, 3519 }, // О
-    { 21, 21, 20, 0, 21, 111, 3634 }, // П
-    { 18, 21, 17, 0, 21, 95, 3745 }, // Р
-    { 18, 23, 17, 1, 22, 104, 3840 }, // С
-    { 16, 21, 15, 2, 21, 84, 3944 }, // Т
-    { 21, 22, 17, 0, 21, 116, 4028 }, // У
-    { 25, 23, 26, 1, 22, 144, 4144 }, // Ф
-    { 23, 21, 18, -2, 21, 121, 4288 }, // Х
-    { 21, 26, 20, 0, 21, 137, 4409 }, // Ц
-    { 18, 21, 19, 2, 21, 95, 4546 }, // Ч
-    { 30, 21, 29, 0, 21, 158, 4641 }, // Ш
-    { 29, 26, 29, 0, 21, 189, 4799 }, // Щ
-    { 18, 21, 20, 2, 21, 95, 4988 }, // Ъ
-    { 26, 21, 26, 0, 21, 137, 5083 }, // Ы
-    { 17, 21, 17, 0, 21, 90, 5220 }, // Ь
-    { 18, 23, 18, 0, 22, 104, 5310 }, // Э
-    { 29, 23, 29, 0, 22, 167, 5414 }, // Ю
-    { 21, 21, 18, -2, 21, 111, 5581 }, // Я
-    { 17, 18, 17, 0, 17, 77, 5692 }, // а
-    { 16, 24, 16, 1, 23, 96, 5769 }, // б
-    { 16, 18, 16, 0, 17, 72, 5865 }, // в
-    { 15, 18, 14, -1, 17, 68, 5937 }, // г
-    { 17, 24, 17, 0, 23, 102, 6005 }, // д
-    { 16, 18, 15, 0, 17, 72, 6107 }, // е
-    { 30, 18, 28, -1, 17, 135, 6179 }, // ж
-    { 14, 18, 15, 0, 17, 63, 6314 }, // з
-    { 16, 17, 17, 1, 16, 68, 6377 }, // и
-    { 16, 24, 17, 1, 23, 96, 6445 }, // й
-    { 18, 16, 16, 0, 16, 72, 6541 }, // к
-    { 19, 17, 18, -1, 16, 81, 6613 }, // л
-    { 23, 16, 23, 0, 16, 92, 6694 }, // м
-    { 17, 16, 17, 0, 16, 68, 6786 }, // н
-    { 16, 18, 17, 0, 17, 72, 6854 }, // о
-    { 16, 17, 17, 0, 17, 68, 6926 }, // п
-    { 18, 24, 18, -1, 17, 108, 6994 }, // р
-    { 14, 18, 14, 0, 17, 63, 7102 }, // с
-    { 25, 17, 26, 0, 17, 107, 7165 }, // т
-    { 19, 23, 16, -2, 16, 110, 7272 }, // у
-    { 21, 30, 22, 0, 23, 158, 7382 }, // ф
-    { 19, 16, 15, -2, 16, 76, 7540 }, // х
-    { 16, 20, 18, 1, 16, 80, 7616 }, // ц
-    { 15, 16, 17, 2, 16, 60, 7696 }, // ч
-    { 25, 17, 26, 1, 16, 107, 7756 }, // ш
-    { 25, 20, 27, 1, 16, 125, 7863 }, // щ
-    { 17, 17, 18, 1, 16, 73, 7988 }, // ъ
-    { 23, 17, 23, 0, 16, 98, 8061 }, // ы
-    { 16, 17, 16, 0, 16, 68, 8159 }, // ь
-    { 13, 18, 14, 0, 17, 59, 8227 }, // э
-    { 23, 18, 24, 0, 17, 104, 8286 }, // ю
-    { 18, 16, 16, -2, 16, 72, 8390 }, // я
-    { 16, 24, 15, 0, 23, 96, 8462 }, // ѐ
-    { 16, 23, 15, 0, 22, 92, 8558 }, // ё
-    { 16, 30, 17, 0, 23, 120, 8650 }, // ђ
-    { 16, 24, 14, -1, 23, 96, 8770 }, // ѓ
-    { 14, 18, 14, 0, 17, 63, 8866 }, // є
-    { 14, 18, 13, 0, 17, 63, 8929 }, // ѕ
-    { 10, 23, 8, 0, 23, 58, 8992 }, // і
-    { 11, 23, 8, 0, 23, 64, 9050 }, // ї
-    { 14, 30, 8, -4, 23, 105, 9114 }, // ј
-    { 26, 17, 25, -1, 16, 111, 9219 }, // љ
-    { 24, 17, 24, 0, 16, 102, 9330 }, // њ
-    { 16, 23, 17, 0, 23, 92, 9432 }, // ћ
-    { 18, 23, 16, 0, 23, 104, 9524 }, // ќ
-    { 16, 24, 17, 1, 23, 96, 9628 }, // ѝ
-    { 19, 30, 16, -2, 23, 143, 9724 }, // ў
-    { 16, 22, 17, 1, 16, 88, 9867 }, // џ
-    { 27, 21, 26, 2, 21, 142, 9955 }, // Ѡ
-    { 24, 16, 24, 1, 16, 96, 10097 }, // ѡ
-    { 16, 21, 18, 1, 21, 84, 10193 }, // Ѣ
-    { 24, 18, 25, 0, 17, 108, 10277 }, // ѣ
-    { 28, 23, 26, 0, 22, 161, 10385 }, // Ѥ
-    { 23, 18, 22, 0, 17, 104, 10546 }, // ѥ
-    { 20, 21, 20, -2, 21, 105, 10650 }, // Ѧ
-    { 18, 16, 17, -2, 16, 72, 10755 }, // ѧ
-    { 26, 21, 27, 0, 21, 137, 10827 }, // Ѩ
-    { 23, 16, 24, 0, 16, 92, 10964 }, // ѩ
-    { 24, 21, 21, -2, 21, 126, 11056 }, // Ѫ
-    { 20, 16, 17, -2, 16, 80, 11182 }, // ѫ
-    { 30, 21, 29, 0, 21, 158, 11262 }, // Ѭ
-    { 25, 16, 24, 0, 16, 100, 11420 }, // ѭ
-    { 20, 33, 17, -2, 26, 165, 11520 }, // Ѯ
-    { 18, 27, 15, -2, 20, 122, 11685 }, // ѯ
-    { 23, 21, 24, 3, 21, 121, 11807 }, // Ѱ
-    { 22, 30, 24, 1, 23, 165, 11928 }, // ѱ
-    { 20, 23, 21, 1, 22, 115, 12093 }, // Ѳ
-    { 15, 18, 17, 1, 17, 68, 12208 }, // ѳ
-    { 19, 21, 19, 2, 21, 100, 12276 }, // Ѵ
-    { 16, 17, 16, 1, 17, 68, 12376 }, // ѵ
-    { 19, 28, 19, 2, 28, 133, 12444 }, // Ѷ
-    { 16, 23, 16, 1, 23, 92, 12577 }, // ѷ
-    { 37, 29, 36, 1, 22, 269, 12669 }, // Ѹ
-    { 33, 24, 32, 1, 17, 198, 12938 }, // ѹ
-    { 21, 25, 22, 1, 23, 132, 13136 }, // Ѻ
-    { 17, 20, 18, 1, 18, 85, 13268 }, // ѻ
-    { 28, 32, 30, 1, 31, 224, 13353 }, // Ѽ
-    { 23, 27, 25, 1, 26, 156, 13577 }, // ѽ
-    { 27, 27, 26, 2, 27, 183, 13733 }, // Ѿ
-    { 24, 22, 24, 1, 22, 132, 13916 }, // ѿ
-    { 19, 29, 18, 1, 22, 138, 14048 }, // Ҁ
-    { 14, 24, 14, 1, 17, 84, 14186 }, // ҁ
-    { 16, 20, 18, 1, 19, 80, 14270 }, // ҂
-    { 12, 6, 0, -12, 22, 18, 14350 }, // ҃
-    { 12, 6, 0, -12, 23, 18, 14368 }, // ҄
-    { 5, 7, 0, -8, 24, 9, 14386 }, // ҅
-    { 6, 7, 0, -9, 24, 11, 14395 }, // ҆
-    { 13, 5, 0, -3, 27, 17, 14406 }, // ҇
-    { 34, 31, 0, -17, 23, 264, 14423 }, // ҈
-    { 34, 33, 0, -17, 24, 281, 14687 }, // ҉
-    { 23, 35, 24, 0, 28, 202, 14968 }, // Ҋ
-    { 18, 29, 18, 1, 23, 131, 15170 }, // ҋ
-    { 16, 21, 17, 0, 21, 84, 15301 }, // Ҍ
-    { 14, 24, 17, 1, 23, 84, 15385 }, // ҍ
-    { 18, 21, 18, 0, 21, 95, 15469 }, // Ҏ
-    { 18, 24, 17, -1, 17, 108, 15564 }, // ҏ
-    { 18, 26, 15, 0, 26, 117, 15672 }, // Ґ
-    { 16, 21, 13, 0, 21, 84, 15789 }, // ґ
-    { 17, 21, 15, 0, 21, 90, 15873 }, // Ғ
-    { 16, 16, 14, -1, 16, 64, 15963 }, // ғ
-    { 17, 29, 19, 0, 21, 124, 16027 }, // Ҕ
-    { 15, 24, 17, 0, 16, 90, 16151 }, // ҕ
-    { 30, 28, 27, -2, 21, 210, 16241 }, // Җ
-    { 30, 23, 28, -1, 17, 173, 16451 }, // җ
-    { 17, 30, 17, 0, 22, 128, 16624 }, // Ҙ
-    { 14, 25, 15, 0, 17, 88, 16752 }, // ҙ
-    { 21, 28, 20, 0, 21, 147, 16840 }, // Қ
-    { 18, 22, 18, 0, 16, 99, 16987 }, // қ
-    { 21, 21, 18, 0, 21, 111, 17086 }, // Ҝ
-    { 18, 16, 17, 1, 16, 72, 17197 }, // ҝ
-    { 21, 21, 18, 0, 21, 111, 17269 }, // Ҟ
-    { 18, 23, 17, 0, 23, 104, 17380 }, // ҟ
-    { 21, 21, 20, 2, 21, 111, 17484 }, // Ҡ
-    { 20, 16, 19, 1, 16, 80, 17595 }, // ҡ
-    { 21, 28, 22, 0, 21, 147, 17675 }, // Ң
-    { 19, 22, 20, 0, 16, 105, 17822 }, // ң
-    { 25, 21, 22, 0, 21, 132, 17927 }, // Ҥ
-    { 23, 16, 21, 0, 16, 92, 18059 }, // ҥ
-    { 28, 29, 30, 0, 21, 203, 18151 }, // Ҧ
-    { 23, 24, 25, 0, 16, 138, 18354 }, // ҧ
-    { 20, 24, 21, 1, 22, 120, 18492 }, // Ҩ
-    { 16, 19, 18, 1, 17, 76, 18612 }, // ҩ
-    { 19, 30, 18, 1, 22, 143, 18688 }, // Ҫ
-    { 14, 25, 14, 1, 17, 88, 18831 }, // ҫ
-    { 16, 28, 15, 2, 21, 112, 18919 }, // Ҭ
-    { 26, 23, 27, 0, 17, 150, 19031 }, // ҭ
-    { 18, 21, 16, 2, 21, 95, 19181 }, // Ү
-    { 16, 23, 15, 1, 16, 92, 19276 }, // ү
-    { 19, 21, 16, 1, 21, 100, 19368 }, // Ұ
-    { 18, 23, 15, -1, 16, 104, 19468 }, // ұ
-    { 22, 28, 20, -2, 21, 154, 19572 }, // Ҳ
-    { 20, 22, 17, -2, 16, 110, 19726 }, // ҳ
-    { 22, 28, 24, 2, 21, 154, 19836 }, // Ҵ
-    { 18, 22, 20, 1, 16, 99, 19990 }, // ҵ
-    { 19, 28, 22, 2, 21, 133, 20089 }, // Ҷ
-    { 16, 22, 19, 2, 16, 88, 20222 }, // ҷ
-    { 18, 21, 20, 2, 21, 95, 20310 }, // Ҹ
-    { 16, 16, 18, 2, 16, 64, 20405 }, // ҹ
-    { 18, 21, 20, 0, 21, 95, 20469 }, // Һ
-    { 17, 23, 18, 0, 23, 98, 20564 }, // һ
-    { 23, 23, 23, 0, 22, 133, 20662 }, // Ҽ
-    { 19, 18, 19, 0, 17, 86, 20795 }, // ҽ
-    { 23, 29, 23, 0, 22, 167, 20881 }, // Ҿ
-    { 19, 23, 19, 0, 17, 110, 21048 }, // ҿ
-    { 14, 21, 11, -1, 21, 74, 21158 }, // Ӏ
-    { 31, 28, 26, -2, 28, 217, 21232 }, // Ӂ
-    { 30, 24, 28, -1, 23, 180, 21449 }, // ӂ
-    { 21, 29, 20, 0, 21, 153, 21629 }, // Ӄ
-    { 18, 24, 18, 0, 16, 108, 21782 }, // ӄ
-    { 23, 28, 22, -1, 21, 161, 21890 }, // Ӆ
-    { 20, 23, 19, -1, 17, 115, 22051 }, // ӆ
-    { 21, 29, 20, 0, 21, 153, 22166 }, // Ӈ
-    { 18, 24, 18, 0, 16, 108, 22319 }, // ӈ
-    { 22, 28, 22, 0, 21, 154, 22427 }, // Ӊ
-    { 19, 22, 20, 0, 16, 105, 22581 }, // ӊ
-    { 18, 28, 20, 2, 21, 126, 22686 }, // Ӌ
-    { 15, 22, 17, 2, 16, 83, 22812 }, // ӌ
-    { 27, 28, 28, 0, 21, 189, 22895 }, // Ӎ
-    { 24, 22, 24, 0, 16, 132, 23084 }, // ӎ
-    { 14, 21, 11, -1, 21, 74, 23216 }, // ӏ
-    { 21, 28, 18, -2, 28, 147, 23290 }, // Ӑ
-    { 16, 24, 17, 1, 23, 96, 23437 }, // ӑ
-    { 20, 27, 18, -2, 27, 135, 23533 }, // Ӓ
-    { 16, 23, 17, 1, 22, 92, 23668 }, // ӓ
-    { 30, 21, 26, -2, 21, 158, 23760 }, // Ӕ
-    { 24, 18, 25, 1, 17, 108, 23918 }, // ӕ
-    { 18, 28, 16, 0, 28, 126, 24026 }, // Ӗ
-    { 17, 24, 16, 1, 23, 102, 24152 }, // ӗ
-    { 19, 23, 19, 0, 22, 110, 24254 }, // Ә
-    { 15, 18, 16, 0, 17, 68, 24364 }, // ә
-    { 19, 28, 19, 0, 27, 133, 24432 }, // Ӛ
-    { 15, 23, 16, 0, 22, 87, 24565 }, // ӛ
-    { 31, 27, 26, -2, 27, 210, 24652 }, // Ӝ
-    { 30, 23, 28, -1, 22, 173, 24862 }, // ӝ
-    { 17, 28, 17, 0, 27, 119, 25035 }, // Ӟ
-    { 15, 23, 15, 0, 22, 87, 25154 }, // ӟ
-    { 18, 22, 16, -1, 21, 99, 25241 }, // Ӡ
-    { 18, 24, 16, -2, 16, 108, 25340 }, // ӡ
-    { 21, 26, 20, 0, 26, 137, 25448 }, // Ӣ
-    { 17, 22, 18, 1, 21, 94, 25585 }, // ӣ
-    { 21, 27, 20, 0, 27, 142, 25679 }, // Ӥ
-    { 17, 23, 18, 1, 22, 98, 25821 }, // ӥ
-    { 20, 28, 21, 1, 27, 140, 25919 }, // Ӧ
-    { 15, 23, 17, 1, 22, 87, 26059 }, // ӧ
-    { 20, 23, 21, 1, 22, 115, 26146 }, // Ө
-    { 15, 18, 17, 1, 17, 68, 26261 }, // ө
-    { 20, 28, 21, 1, 27, 140, 26329 }, // Ӫ
-    { 15, 23, 17, 1, 22, 87, 26469 }, // ӫ
-    { 18, 28, 18, 0, 27, 126, 26556 }, // Ӭ
-    { 14, 23, 14, 0, 22, 81, 26682 }, // ӭ
-    { 21, 27, 17, 0, 26, 142, 26763 }, // Ӯ
-    { 20, 28, 15, -3, 21, 140, 26905 }, // ӯ
-    { 21, 28, 17, 0, 27, 147, 27045 }, // Ӱ
-    { 20, 29, 15, -3, 22, 145, 27192 }, // ӱ
-    { 21, 29, 17, 0, 28, 153, 27337 }, // Ӳ
-    { 21, 30, 15, -3, 23, 158, 27490 }, // ӳ
-    { 18, 27, 19, 2, 27, 122, 27648 }, // Ӵ
-    { 15, 22, 17, 2, 22, 83, 27770 }, // ӵ
-    { 17, 28, 15, 0, 21, 119, 27853 }, // Ӷ
-    { 15, 22, 14, 0, 16, 83, 27972 }, // ӷ
-    { 26, 27, 26, 0, 27, 176, 28055 }, // Ӹ
-    { 23, 23, 23, 0, 22, 133, 28231 }, // ӹ
-    { 17, 29, 15, 0, 21, 124, 28364 }, // Ӻ
-    { 16, 24, 14, -1, 16, 96, 28488 }, // ӻ
-    { 22, 29, 20, -2, 21, 160, 28584 }, // Ӽ
-    { 19, 24, 17, -2, 16, 114, 28744 }, // ӽ
-    { 23, 21, 18, -2, 21, 121, 28858 }, // Ӿ
-    { 19, 16, 15, -2, 16, 76, 28979 }, // ӿ
-    { 0, 0, 15, 0, 0, 0, 0 }, //  
-    { 0, 0, 29, 0, 0, 0, 0 }, //  
-    { 0, 0, 15, 0, 0, 0, 0 }, //  
-    { 0, 0, 29, 0, 0, 0, 0 }, //  
-    { 0, 0, 10, 0, 0, 0, 0 }, //  
-    { 0, 0, 7, 0, 0, 0, 0 }, //  
-    { 0, 0, 5, 0, 0, 0, 0 }, //  
-    { 0, 0, 16, 0, 0, 0, 0 }, //  
-    { 0, 0, 8, 0, 0, 0, 0 }, //  
-    { 0, 0, 5, 0, 0, 0, 0 }, //  
-    { 0, 0, 3, 0, 0, 0, 0 }, //  
-    { 0, 0, 0, 0, 0, 0, 0 }, // ​
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‍
-    { 8, 25, 0, -1, 21, 50, 0 }, // ‎
-    { 8, 25, 0, -7, 21, 50, 50 }, // ‏
-    { 9, 4, 9, 0, 10, 9, 100 }, // ‐
-    { 9, 4, 9, 0, 10, 9, 109 }, // ‑
-    { 15, 4, 16, 1, 12, 15, 118 }, // ‒
-    { 14, 4, 14, 0, 10, 14, 133 }, // –
-    { 28, 4, 28, 0, 10, 28, 147 }, // —
-    { 28, 4, 28, 0, 10, 28, 175 }, // ―
-    { 12, 30, 16, 2, 23, 90, 203 }, // ‖
-    { 14, 7, 12, -4, 0, 25, 293 }, // ‗
-    { 8, 8, 6, 1, 21, 16, 318 }, // ‘
-    { 8, 8, 6, 1, 21, 16, 334 }, // ’
-    { 8, 8, 8, -2, 4, 16, 350 }, // ‚
-    { 5, 8, 6, 3, 21, 10, 366 }, // ‛
-    { 14, 8, 13, 1, 21, 28, 376 }, // “
-    { 14, 8, 13, 1, 21, 28, 404 }, // ”
-    { 14, 8, 15, -2, 4, 28, 432 }, // „
-    { 11, 8, 13, 3, 21, 22, 460 }, // ‟
-    { 13, 23, 15, 2, 23, 75, 482 }, // †
-    { 16, 23, 15, 0, 23, 92, 557 }, // ‡
-    { 10, 10, 11, 1, 16, 25, 649 }, // •
-    { 10, 12, 10, 1, 17, 30, 674 }, // ‣
-    { 6, 6, 15, 3, 5, 9, 704 }, // ․
-    { 14, 6, 17, 0, 5, 21, 713 }, // ‥
-    { 22, 6, 24, 0, 5, 33, 734 }, // …
-    { 6, 6, 9, 2, 11, 9, 767 }, // ‧
-    { 0, 0, 18, 0, 0, 0, 776 }, //  
-    { 0, 0, 18, 0, 0, 0, 776 }, //  
-    { 8, 22, 0, -1, 18, 44, 776 }, // ‪
-    { 8, 22, 0, -7, 18, 44, 820 }, // ‫
-    { 8, 25, 0, -4, 21, 50, 864 }, // ‬
-    { 8, 25, 0, -4, 21, 50, 914 }, // ‭
-    { 8, 25, 0, -4, 21, 50, 964 }, // ‮
-    { 0, 0, 5, 0, 0, 0, 1014 }, //  
-    { 34, 23, 36, 1, 22, 196, 1014 }, // ‰
-    { 45, 23, 46, 1, 22, 259, 1210 }, // ‱
-    { 10, 8, 8, 1, 21, 20, 1469 }, // ′
-    { 16, 8, 15, 1, 21, 32, 1489 }, // ″
-    { 23, 8, 22, 1, 21, 46, 1521 }, // ‴
-    { 8, 8, 8, 2, 21, 16, 1567 }, // ‵
-    { 14, 8, 15, 2, 21, 28, 1583 }, // ‶
-    { 21, 8, 22, 2, 21, 42, 1611 }, // ‷
-    { 11, 10, 10, -3, 3, 28, 1653 }, // ‸
-    { 9, 14, 10, 1, 15, 32, 1681 }, // ‹
-    { 9, 14, 9, 0, 15, 32, 1713 }, // ›
-    { 24, 23, 25, 0, 22, 138, 1745 }, // ※
-    { 18, 22, 16, 0, 21, 99, 1883 }, // ‼
-    { 13, 23, 13, 2, 22, 75, 1982 }, // ‽
-    { 15, 4, 12, 2, 26, 15, 2057 }, // ‾
-    { 16, 7, 16, -2, 0, 28, 2072 }, // ‿
-    { 16, 8, 16, 2, 24, 32, 2100 }, // ⁀
-    { 15, 19, 11, -3, 12, 72, 2132 }, // ⁁
-    { 33, 27, 34, -1, 23, 223, 2204 }, // ⁂
-    { 9, 5, 9, 0, 10, 12, 2427 }, // ⁃
-    { 20, 21, 4, -8, 21, 105, 2439 }, // ⁄
-    { 13, 26, 10, -1, 21, 85, 2544 }, // ⁅
-    { 13, 26, 10, -2, 21, 85, 2629 }, // ⁆
-    { 26, 23, 26, 2, 22, 150, 2714 }, // ⁇
-    { 21, 23, 22, 2, 22, 121, 2864 }, // ⁈
-    { 23, 23, 22, 0, 22, 133, 2985 }, // ⁉
-    { 15, 16, 16, 1, 16, 60, 3118 }, // ⁊
-    { 16, 27, 18, 2, 23, 108, 3178 }, // ⁋
-    { 16, 15, 19, 1, 16, 60, 3286 }, // ⁌
-    { 16, 15, 19, 2, 16, 60, 3346 }, // ⁍
-    { 15, 15, 16, -1, 8, 57, 3406 }, // ⁎
-    { 8, 21, 8, 1, 17, 42, 3463 }, // ⁏
-    { 20, 31, 16, -2, 24, 155, 3505 }, // ⁐
-    { 18, 30, 16, -1, 23, 135, 3660 }, // ⁑
-    { 13, 23, 12, 0, 22, 75, 3795 }, // ⁒
-    { 28, 7, 29, 1, 12, 49, 3870 }, // ⁓
-    { 16, 7, 16, -3, 0, 28, 3919 }, // ⁔
-    { 16, 16, 17, 0, 15, 64, 3947 }, // ⁕
-    { 14, 23, 16, 1, 22, 81, 4011 }, // ⁖
-    { 27, 8, 26, 1, 21, 54, 4092 }, // ⁗
-    { 23, 23, 25, 1, 22, 133, 4146 }, // ⁘
-    { 23, 23, 25, 1, 22, 133, 4279 }, // ⁙
-    { 6, 23, 8, 1, 22, 35, 4412 }, // ⁚
-    { 19, 24, 21, 1, 23, 114, 4447 }, // ⁛
-    { 24, 23, 24, 0, 22, 138, 4561 }, // ⁜
-    { 6, 24, 8, 1, 23, 36, 4699 }, // ⁝
-    { 5, 23, 8, 2, 22, 29, 4735 }, // ⁞
-    { 0, 0, 6, 0, 0, 0, 4764 }, //  
-    { 0, 0, 18, 0, 0, 0, 4764 }, // ⁠
-    { 0, 0, 18, 0, 0, 0, 4764 }, // ⁡
-    { 0, 0, 18, 0, 0, 0, 4764 }, // ⁢
-    { 0, 0, 18, 0, 0, 0, 4764 }, // ⁣
-    { 0, 0, 18, 0, 0, 0, 4764 }, // ⁤
-    { 0, 0, 18, 0, 0, 0, 4764 }, // ⁦
-    { 0, 0, 18, 0, 0, 0, 4764 }, // ⁧
-    { 0, 0, 18, 0, 0, 0, 4764 }, // ⁨
-    { 0, 0, 18, 0, 0, 0, 4764 }, // ⁩
-    { 8, 25, 0, -4, 21, 50, 4764 }, // ⁪
-    { 8, 25, 0, -4, 21, 50, 4814 }, // ⁫
-    { 8, 25, 0, -4, 21, 50, 4864 }, // ⁬
-    { 8, 25, 0, -4, 21, 50, 4914 }, // ⁭
-    { 8, 25, 0, -4, 21, 50, 4964 }, // ⁮
-    { 8, 25, 0, -4, 21, 50, 5014 }, // ⁯
-    { 11, 14, 11, 2, 25, 39, 0 }, // ⁰
-    { 6, 14, 7, 2, 22, 21, 39 }, // ⁱ
-    { 12, 13, 11, 1, 25, 39, 60 }, // ⁴
-    { 11, 14, 11, 2, 25, 39, 99 }, // ⁵
-    { 11, 14, 11, 2, 25, 39, 138 }, // ⁶
-    { 12, 13, 11, 2, 25, 39, 177 }, // ⁷
-    { 11, 14, 11, 2, 25, 39, 216 }, // ⁸
-    { 11, 14, 11, 2, 25, 39, 255 }, // ⁹
-    { 9, 9, 11, 3, 22, 21, 294 }, // ⁺
-    { 9, 3, 11, 3, 19, 7, 315 }, // ⁻
-    { 10, 7, 12, 3, 21, 18, 322 }, // ⁼
-    { 8, 17, 7, 3, 26, 34, 340 }, // ⁽
-    { 8, 17, 7, 0, 26, 34, 374 }, // ⁾
-    { 12, 11, 11, 1, 19, 33, 408 }, // ⁿ
-    { 11, 14, 11, -1, 9, 39, 441 }, // ₀
-    { 10, 13, 11, -1, 9, 33, 480 }, // ₁
-    { 12, 13, 11, -2, 9, 39, 513 }, // ₂
-    { 11, 14, 11, -2, 9, 39, 552 }, // ₃
-    { 12, 13, 11, -2, 9, 39, 591 }, // ₄
-    { 11, 14, 11, -1, 9, 39, 630 }, // ₅
-    { 11, 14, 11, -1, 9, 39, 669 }, // ₆
-    { 12, 13, 11, -1, 9, 39, 708 }, // ₇
-    { 12, 14, 11, -2, 9, 42, 747 }, // ₈
-    { 11, 14, 11, -1, 9, 39, 789 }, // ₉
-    { 9, 9, 11, 0, 7, 21, 828 }, // ₊
-    { 9, 3, 11, 0, 4, 7, 849 }, // ₋
-    { 9, 7, 12, 0, 6, 16, 856 }, // ₌
-    { 8, 17, 7, 0, 11, 34, 872 }, // ₍
-    { 7, 17, 7, -3, 11, 30, 906 }, // ₎
-    { 11, 10, 11, -1, 7, 28, 936 }, // ₐ
-    { 10, 10, 10, -1, 7, 25, 964 }, // ₑ
-    { 10, 10, 11, -1, 7, 25, 989 }, // ₒ
-    { 13, 10, 10, -3, 7, 33, 1014 }, // ₓ
-    { 11, 10, 10, -2, 7, 28, 1047 }, // ₔ
-    { 12, 14, 13, -1, 11, 42, 1075 }, // ₕ
-    { 13, 14, 11, -1, 11, 46, 1117 }, // ₖ
-    { 7, 14, 7, -1, 11, 25, 1163 }, // ₗ
-    { 17, 10, 19, -1, 7, 43, 1188 }, // ₘ
-    { 11, 10, 11, -2, 7, 28, 1231 }, // ₙ
-    { 12, 14, 11, -3, 7, 42, 1259 }, // ₚ
-    { 9, 10, 10, -1, 7, 23, 1301 }, // ₛ
-    { 8, 12, 8, -1, 9, 24, 1324 }, // ₜ
-    { 17, 22, 17, 1, 22, 94, 0 }, // ₠
-    { 19, 25, 16, 0, 23, 119, 94 }, // ₡
-    { 18, 23, 17, 0, 22, 104, 213 }, // ₢
-    { 18, 21, 16, 0, 21, 95, 317 }, // ₣
-    { 19, 22, 16, -1, 22, 105, 412 }, // ₤
-    { 25, 24, 26, 0, 20, 150, 517 }, // ₥
-    { 18, 21, 17, 0, 21, 95, 667 }, // ₦
-    { 25, 22, 25, 0, 21, 138, 762 }, // ₧
-    { 27, 22, 26, 0, 21, 149, 900 }, // ₨
-    { 23, 21, 21, 0, 21, 121, 1049 }, // ₩
-    { 26, 21, 25, 0, 21, 137, 1170 }, // ₪
-    { 20, 28, 17, 0, 23, 140, 1307 }, // ₫
-    { 18, 23, 16, 0, 22, 104, 1447 }, // €
-    { 20, 21, 17, 0, 21, 105, 1551 }, // ₭
-    { 17, 21, 15, 1, 21, 90, 1656 }, // ₮
-    { 29, 29, 29, 0, 22, 211, 1746 }, // ₯
-    { 20, 29, 17, -2, 22, 145, 1957 }, // ₰
-    { 18, 21, 17, 0, 21, 95, 2102 }, // ₱
-    { 19, 26, 20, 1, 23, 124, 2197 }, // ₲
-    { 21, 21, 18, -2, 21, 111, 2321 }, // ₳
-    { 18, 23, 17, 0, 22, 104, 2432 }, // ₴
-    { 19, 26, 18, 1, 23, 124, 2536 }, // ₵
-    { 21, 21, 20, 0, 20, 111, 2660 }, // ₶
-    { 22, 25, 20, -1, 22, 138, 2771 }, // ₷
-    { 17, 21, 15, 1, 21, 90, 2909 }, // ₸
-    { 15, 21, 16, 2, 21, 79, 2999 }, // ₹
-    { 16, 22, 16, 0, 21, 88, 3078 }, // ₺
-    { 19, 23, 19, 1, 22, 110, 3166 }, // ₻
-    { 24, 21, 24, -1, 21, 126, 3276 }, // ₼
-    { 19, 21, 17, -1, 21, 100, 3402 }, // ₽
-    { 20, 24, 18, -1, 24, 120, 3502 }, // ₾
-    { 17, 27, 16, 0, 24, 115, 3622 }, // ₿
-    { 9, 4, 9, 0, 10, 9, 0 }, // −
-    { 27, 28, 29, 1, 23, 189, 0 }, // �
+    { 16, 14, 17, 1, 15, 56, 7742 }, // «
+    { 15, 9, 17, 1, 12, 34, 680 }, // ¬
+    { 9, 4, 9, 0, 10, 9, 714 }, // ­
+    { 22, 23, 24, 1, 22, 127, 723 }, // ®
+    { 15, 4, 12, 2, 26, 15, 850 }, // ¯
+    { 11, 11, 12, 1, 22, 31, 865 }, // °
+    { 15, 19, 17, 1, 19, 72, 896 }, // ±
+    { 12, 13, 11, 1, 25, 39, 968 }, // ²
+    { 11, 14, 11, 2, 25, 39, 1007 }, // ³
+    { 9, 6, 9, 3, 23, 14, 1046 }, // ´
+    { 19, 23, 18, -1, 16, 110, 1060 }, // µ
+    { 16, 27, 19, 2, 23, 108, 1170 }, // ¶
+    { 7, 6, 8, 1, 13, 11, 1278 }, // ·
+    { 7, 7, 6, -3, 0, 13, 1289 }, // ¸
+    { 10, 13, 11, 2, 25, 33, 1302 }, // ¹
+    { 10, 11, 11, 2, 21, 28, 1335 }, // º
+    { 16, 14, 16, 0, 15, 56, 7798 }, // »
+    { 22, 21, 24, 2, 21, 116, 1363 }, // ¼
+    { 23, 21, 26, 2, 21, 121, 1479 }, // ½
+    { 24, 21, 25, 1, 21, 126, 1600 }, // ¾
+    { 13, 23, 14, -1, 17, 75, 1726 }, // ¿
+    { 19, 28, 18, -2, 28, 133, 7854 }, // À
+    { 20, 28, 18, -2, 28, 140, 7987 }, // Á
+    { 20, 28, 18, -2, 28, 140, 8127 }, // Â
+    { 21, 28, 18, -2, 28, 147, 1801 }, // Ã
+    { 20, 27, 18, -2, 27, 135, 8267 }, // Ä
+    { 19, 30, 18, -2, 30, 143, 1948 }, // Å
+    { 30, 21, 26, -2, 21, 158, 2091 }, // Æ
+    { 19, 29, 18, 1, 22, 138, 8402 }, // Ç
+    { 17, 28, 16, 0, 28, 119, 8540 }, // È
+    { 17, 28, 16, 0, 28, 119, 8659 }, // É
+    { 17, 28, 16, 0, 28, 119, 8778 }, // Ê
+    { 17, 27, 16, 0, 27, 115, 8897 }, // Ë
+    { 14, 28, 11, -1, 28, 98, 9012 }, // Ì
+    { 16, 28, 11, -1, 28, 112, 9110 }, // Í
+    { 16, 28, 11, -1, 28, 112, 9222 }, // Î
+    { 15, 27, 11, -1, 27, 102, 9334 }, // Ï
+    { 19, 21, 20, 0, 21, 100, 2249 }, // Ð
+    { 23, 28, 22, 0, 28, 161, 9436 }, // Ñ
+    { 20, 29, 21, 1, 28, 145, 9597 }, // Ò
+    { 20, 29, 21, 1, 28, 145, 9742 }, // Ó
+    { 20, 29, 21, 1, 28, 145, 9887 }, // Ô
+    { 20, 29, 21, 1, 28, 145, 2349 }, // Õ
+    { 20, 28, 21, 1, 27, 140, 10032 }, // Ö
+    { 14, 14, 17, 2, 17, 49, 2494 }, // ×
+    { 20, 24, 21, 1, 22, 120, 2543 }, // Ø
+    { 20, 29, 20, 1, 28, 145, 10172 }, // Ù
+    { 20, 29, 20, 1, 28, 145, 10317 }, // Ú
+    { 20, 29, 20, 1, 28, 145, 10462 }, // Û
+    { 20, 28, 20, 1, 27, 140, 10607 }, // Ü
+    { 18, 28, 16, 2, 28, 126, 2663 }, // Ý
+    { 17, 21, 18, 0, 21, 90, 2789 }, // Þ
+    { 23, 30, 19, -4, 23, 173, 2879 }, // ß
+    { 16, 24, 17, 1, 23, 96, 10747 }, // à
+    { 16, 24, 17, 1, 23, 96, 10843 }, // á
+    { 16, 24, 17, 1, 23, 96, 10939 }, // â
+    { 17, 24, 17, 1, 23, 102, 3052 }, // ã
+    { 16, 23, 17, 1, 22, 92, 11035 }, // ä
+    { 16, 26, 17, 1, 25, 104, 3154 }, // å
+    { 24, 18, 25, 1, 17, 108, 3258 }, // æ
+    { 14, 24, 14, 1, 17, 84, 11127 }, // ç
+    { 15, 24, 16, 1, 23, 90, 11211 }, // è
+    { 15, 24, 16, 1, 23, 90, 11301 }, // é
+    { 16, 24, 16, 1, 23, 96, 11391 }, // ê
+    { 15, 23, 16, 1, 22, 87, 11487 }, // ë
+    { 9, 23, 9, 0, 23, 52, 11574 }, // ì
+    { 12, 23, 9, 0, 23, 69, 11626 }, // í
+    { 12, 23, 9, 0, 23, 69, 11695 }, // î
+    { 12, 22, 9, 0, 22, 66, 11764 }, // ï
+    { 16, 24, 17, 1, 23, 96, 3366 }, // ð
+    { 18, 23, 18, 0, 23, 104, 11830 }, // ñ
+    { 15, 24, 17, 1, 23, 90, 11934 }, // ò
+    { 15, 24, 17, 1, 23, 90, 12024 }, // ó
+    { 15, 24, 17, 1, 23, 90, 12114 }, // ô
+    { 16, 24, 17, 1, 23, 96, 3462 }, // õ
+    { 15, 23, 17, 1, 22, 87, 12204 }, // ö
+    { 15, 15, 17, 1, 18, 57, 3558 }, // ÷
+    { 17, 19, 17, 0, 17, 81, 3615 }, // ø
+    { 17, 24, 18, 1, 23, 102, 12291 }, // ù
+    { 17, 24, 18, 1, 23, 102, 12393 }, // ú
+    { 17, 24, 18, 1, 23, 102, 12495 }, // û
+    { 17, 23, 18, 1, 22, 98, 12597 }, // ü
+    { 20, 30, 15, -3, 23, 150, 3696 }, // ý
+    { 18, 30, 17, -1, 23, 135, 3846 }, // þ
+    { 20, 29, 15, -3, 22, 145, 3981 }, // ÿ
+    { 20, 26, 18, -2, 26, 130, 4126 }, // Ā
+    { 16, 22, 17, 1, 21, 88, 4256 }, // ā
+    { 20, 28, 18, -2, 28, 140, 4344 }, // Ă
+    { 16, 24, 17, 1, 23, 96, 4484 }, // ă
+    { 19, 29, 18, -2, 21, 138, 4580 }, // Ą
+    { 16, 25, 17, 1, 17, 100, 4718 }, // ą
+    { 19, 29, 18, 1, 28, 138, 4818 }, // Ć
+    { 15, 24, 14, 1, 23, 90, 4956 }, // ć
+    { 19, 29, 18, 1, 28, 138, 5046 }, // Ĉ
+    { 15, 24, 14, 1, 23, 90, 5184 }, // ĉ
+    { 19, 29, 18, 1, 28, 138, 5274 }, // Ċ
+    { 14, 24, 14, 1, 23, 84, 5412 }, // ċ
+    { 19, 29, 18, 1, 28, 138, 5496 }, // Č
+    { 16, 24, 14, 1, 23, 96, 5634 }, // č
+    { 20, 28, 20, 0, 28, 140, 5730 }, // Ď
+    { 24, 24, 20, 1, 23, 144, 5870 }, // ď
+    { 19, 21, 20, 0, 21, 100, 6014 }, // Đ
+    { 19, 24, 17, 1, 23, 114, 6114 }, // đ
+    { 17, 26, 16, 0, 26, 111, 6228 }, // Ē
+    { 15, 22, 16, 1, 21, 83, 6339 }, // ē
+    { 18, 28, 16, 0, 28, 126, 6422 }, // Ĕ
+    { 15, 24, 16, 1, 23, 90, 6548 }, // ĕ
+    { 17, 28, 16, 0, 28, 119, 6638 }, // Ė
+    { 15, 24, 16, 1, 23, 90, 6757 }, // ė
+    { 17, 29, 16, 0, 21, 124, 6847 }, // Ę
+    { 15, 24, 16, 1, 17, 90, 6971 }, // ę
+    { 19, 28, 16, 0, 28, 133, 7061 }, // Ě
+    { 17, 24, 16, 1, 23, 102, 7194 }, // ě
+    { 19, 29, 20, 1, 28, 138, 7296 }, // Ĝ
+    { 17, 30, 17, 0, 23, 128, 7434 }, // ĝ
+    { 19, 29, 20, 1, 28, 138, 7562 }, // Ğ
+    { 17, 30, 17, 0, 23, 128, 7700 }, // ğ
+    { 19, 29, 20, 1, 28, 138, 7828 }, // Ġ
+    { 17, 30, 17, 0, 23, 128, 7966 }, // ġ
+    { 19, 29, 20, 1, 22, 138, 8094 }, // Ģ
+    { 17, 30, 17, 0, 23, 128, 8232 }, // ģ
+    { 21, 28, 20, 0, 28, 147, 8360 }, // Ĥ
+    { 17, 29, 18, 0, 29, 124, 8507 }, // ĥ
+    { 23, 21, 20, 0, 21, 121, 8631 }, // Ħ
+    { 16, 23, 18, 0, 23, 92, 8752 }, // ħ
+    { 16, 28, 11, -1, 28, 112, 8844 }, // Ĩ
+    { 13, 23, 9, 0, 23, 75, 8956 }, // ĩ
+    { 15, 26, 11, -1, 26, 98, 9031 }, // Ī
+    { 12, 21, 9, 0, 21, 63, 9129 }, // ī
+    { 16, 28, 11, -1, 28, 112, 9192 }, // Ĭ
+    { 13, 23, 9, 0, 23, 75, 9304 }, // ĭ
+    { 14, 29, 11, -1, 21, 102, 9379 }, // Į
+    { 12, 31, 9, -2, 23, 93, 9481 }, // į
+    { 14, 28, 11, -1, 28, 98, 9574 }, // İ
+    { 9, 16, 9, 0, 16, 36, 9672 }, // ı
+    { 23, 28, 21, -1, 21, 161, 9708 }, // Ĳ
+    { 19, 30, 17, 0, 23, 143, 9869 }, // ĳ
+    { 19, 35, 10, -5, 28, 167, 10012 }, // Ĵ
+    { 16, 30, 9, -4, 23, 120, 10179 }, // ĵ
+    { 21, 28, 18, 0, 21, 147, 10299 }, // Ķ
+    { 18, 30, 17, 0, 23, 135, 10446 }, // ķ
+    { 18, 16, 17, 0, 16, 72, 10581 }, // ĸ
+    { 15, 28, 15, 0, 28, 105, 10653 }, // Ĺ
+    { 14, 29, 9, 0, 29, 102, 10758 }, // ĺ
+    { 14, 28, 15, 0, 21, 98, 10860 }, // Ļ
+    { 12, 30, 9, -2, 23, 90, 10958 }, // ļ
+    { 17, 21, 15, 0, 21, 90, 11048 }, // Ľ
+    { 16, 23, 11, 0, 23, 92, 11138 }, // ľ
+    { 15, 21, 15, 0, 21, 79, 11230 }, // Ŀ
+    { 14, 23, 13, 0, 23, 81, 11309 }, // ŀ
+    { 15, 21, 15, -1, 21, 79, 11390 }, // Ł
+    { 11, 23, 10, 0, 23, 64, 11469 }, // ł
+    { 23, 28, 22, 0, 28, 161, 11533 }, // Ń
+    { 17, 23, 18, 0, 23, 98, 11694 }, // ń
+    { 23, 28, 22, 0, 21, 161, 11792 }, // Ņ
+    { 17, 24, 18, 0, 17, 102, 11953 }, // ņ
+    { 23, 28, 22, 0, 28, 161, 12055 }, // Ň
+    { 18, 23, 18, 0, 23, 104, 12216 }, // ň
+    { 20, 21, 21, 0, 21, 105, 12320 }, // ŉ
+    { 23, 28, 22, 0, 21, 161, 12425 }, // Ŋ
+    { 17, 24, 18, 0, 17, 102, 12586 }, // ŋ
+    { 20, 27, 21, 1, 26, 135, 12688 }, // Ō
+    { 15, 22, 17, 1, 21, 83, 12823 }, // ō
+    { 20, 29, 21, 1, 28, 145, 12906 }, // Ŏ
+    { 16, 24, 17, 1, 23, 96, 13051 }, // ŏ
+    { 22, 29, 21, 1, 28, 160, 13147 }, // Ő
+    { 19, 24, 17, 1, 23, 114, 13307 }, // ő
+    { 27, 23, 26, 1, 22, 156, 12695 }, // Œ
+    { 24, 18, 26, 1, 17, 108, 12851 }, // œ
+    { 18, 28, 18, 0, 28, 126, 13421 }, // Ŕ
+    { 15, 23, 12, 0, 23, 87, 13547 }, // ŕ
+    { 18, 28, 18, 0, 21, 126, 13634 }, // Ŗ
+    { 15, 24, 12, -1, 17, 90, 13760 }, // ŗ
+    { 19, 28, 18, 0, 28, 133, 13850 }, // Ř
+    { 16, 23, 12, 0, 23, 92, 13983 }, // ř
+    { 17, 29, 15, 0, 28, 124, 14075 }, // Ś
+    { 15, 24, 14, 0, 23, 90, 14199 }, // ś
+    { 17, 29, 15, 0, 28, 124, 14289 }, // Ŝ
+    { 15, 24, 14, 0, 23, 90, 14413 }, // ŝ
+    { 16, 29, 15, 0, 22, 116, 14503 }, // Ş
+    { 14, 24, 14, 0, 17, 84, 14619 }, // ş
+    { 18, 29, 15, 0, 28, 131, 14703 }, // Š
+    { 16, 24, 14, 0, 23, 96, 14834 }, // š
+    { 16, 28, 16, 2, 21, 112, 14930 }, // Ţ
+    { 12, 27, 12, 1, 20, 81, 15042 }, // ţ
+    { 16, 28, 16, 2, 28, 112, 15123 }, // Ť
+    { 15, 24, 12, 1, 23, 90, 15235 }, // ť
+    { 16, 21, 16, 2, 21, 84, 15325 }, // Ŧ
+    { 13, 21, 12, 0, 20, 69, 15409 }, // ŧ
+    { 20, 29, 20, 1, 28, 145, 15478 }, // Ũ
+    { 17, 24, 18, 1, 23, 102, 15623 }, // ũ
+    { 20, 27, 20, 1, 26, 135, 15725 }, // Ū
+    { 17, 22, 18, 1, 21, 94, 15860 }, // ū
+    { 20, 29, 20, 1, 28, 145, 15954 }, // Ŭ
+    { 17, 24, 18, 1, 23, 102, 16099 }, // ŭ
+    { 20, 31, 20, 1, 30, 155, 16201 }, // Ů
+    { 17, 26, 18, 1, 25, 111, 16356 }, // ů
+    { 21, 29, 20, 1, 28, 153, 16467 }, // Ű
+    { 19, 24, 18, 1, 23, 114, 16620 }, // ű
+    { 20, 29, 20, 1, 21, 145, 16734 }, // Ų
+    { 17, 24, 18, 1, 16, 102, 16879 }, // ų
+    { 27, 28, 26, 2, 28, 189, 16981 }, // Ŵ
+    { 24, 23, 23, 1, 23, 138, 17170 }, // ŵ
+    { 18, 28, 16, 2, 28, 126, 17308 }, // Ŷ
+    { 20, 30, 15, -3, 23, 150, 17434 }, // ŷ
+    { 18, 27, 16, 2, 27, 122, 17584 }, // Ÿ
+    { 19, 28, 16, -1, 28, 133, 17706 }, // Ź
+    { 16, 23, 14, -1, 23, 92, 17839 }, // ź
+    { 19, 28, 16, -1, 28, 133, 17931 }, // Ż
+    { 15, 23, 14, -1, 23, 87, 18064 }, // ż
+    { 19, 28, 16, -1, 28, 133, 18151 }, // Ž
+    { 17, 23, 14, -1, 23, 98, 18284 }, // ž
+    { 18, 30, 10, -4, 23, 135, 18382 }, // ſ
+    { 8, 6, 0, -13, 23, 12, 18517 }, // ̀
+    { 9, 6, 0, -7, 23, 14, 18529 }, // ́
+    { 12, 6, 0, -4, 23, 18, 18543 }, // ̂
+    { 13, 6, 0, -13, 23, 20, 18561 }, // ̃
+    { 10, 4, 0, -3, 21, 10, 18581 }, // ̄
+    { 14, 4, 0, -4, 25, 14, 18591 }, // ̅
+    { 11, 6, 0, -3, 23, 17, 18605 }, // ̆
+    { 5, 6, 0, 0, 23, 8, 18622 }, // ̇
+    { 11, 4, 0, -3, 22, 11, 18630 }, // ̈
+    { 7, 8, 0, -9, 25, 14, 18641 }, // ̉
+    { 8, 8, 0, -1, 25, 16, 18655 }, // ̊
+    { 14, 6, 0, -3, 23, 21, 18671 }, // ̋
+    { 12, 6, 0, -3, 23, 18, 18692 }, // ̌
+    { 5, 9, 0, 0, 23, 12, 18710 }, // ̍
+    { 10, 6, 0, -2, 23, 15, 18722 }, // ̎
+    { 12, 6, 0, -14, 23, 18, 18737 }, // ̏
+    { 11, 8, 0, -3, 25, 22, 18755 }, // ̐
+    { 11, 6, 0, -3, 23, 17, 18777 }, // ̑
+    { 8, 8, 0, -2, 21, 16, 18794 }, // ̒
+    { 8, 8, 0, -2, 21, 16, 18810 }, // ̓
+    { 5, 8, 0, 0, 21, 10, 18826 }, // ̔
+    { 8, 8, 0, -2, 21, 16, 18836 }, // ̕
+    { 7, 6, 0, -6, -1, 11, 18852 }, // ̖
+    { 9, 6, 0, -7, -1, 14, 18863 }, // ̗
+    { 7, 7, 0, -6, 0, 13, 18877 }, // ̘
+    { 7, 7, 0, -6, 0, 13, 18890 }, // ̙
+    { 10, 9, 9, 2, 23, 23, 18903 }, // ̚
+    { 9, 8, 0, -2, 23, 18, 18926 }, // ̛
+    { 5, 7, 0, -2, 0, 9, 18944 }, // ̜
+    { 7, 6, 0, -6, -1, 11, 18953 }, // ̝
+    { 8, 6, 0, -6, -1, 12, 18964 }, // ̞
+    { 7, 7, 0, -6, 0, 13, 18976 }, // ̟
+    { 7, 3, 0, -6, -3, 6, 18989 }, // ̠
+    { 9, 9, 0, -7, 2, 21, 18995 }, // ̡
+    { 8, 9, 0, -4, 2, 18, 19016 }, // ̢
+    { 6, 6, 0, -14, -1, 9, 19034 }, // ̣
+    { 11, 4, 0, -8, -2, 11, 19043 }, // ̤
+    { 8, 8, 0, -6, 0, 16, 19054 }, // ̥
+    { 7, 6, 0, 1, -1, 11, 19070 }, // ̦
+    { 8, 7, 0, -6, 0, 14, 19081 }, // ̧
+    { 7, 8, 0, -6, 0, 14, 19095 }, // ̨
+    { 6, 9, 0, -5, 0, 14, 19109 }, // ̩
+    { 13, 6, 0, -9, -1, 20, 19123 }, // ̪
+    { 12, 5, 0, -8, -1, 15, 19143 }, // ̫
+    { 13, 6, 0, -8, -1, 20, 19158 }, // ̬
+    { 13, 6, 0, -9, -1, 20, 19178 }, // ̭
+    { 12, 6, 0, -8, -1, 18, 19198 }, // ̮
+    { 11, 6, 0, -8, -1, 17, 19216 }, // ̯
+    { 13, 6, 0, -9, -1, 20, 19233 }, // ̰
+    { 11, 4, 0, -8, -2, 11, 19253 }, // ̱
+    { 14, 3, 0, -9, -2, 11, 19264 }, // ̲
+    { 14, 7, 0, -10, 0, 25, 19275 }, // ̳
+    { 13, 6, 0, -7, 11, 20, 19300 }, // ̴
+    { 13, 4, 0, -7, 10, 13, 19320 }, // ̵
+    { 22, 4, 0, -11, 10, 22, 19333 }, // ̶
+    { 12, 9, 0, -6, 13, 27, 19355 }, // ̷
+    { 18, 25, 0, -9, 23, 113, 19382 }, // ̸
+    { 6, 7, 0, -3, 0, 11, 19495 }, // ̹
+    { 12, 6, 0, -8, -1, 18, 19506 }, // ̺
+    { 12, 7, 0, -8, 0, 21, 19524 }, // ̻
+    { 12, 5, 0, -8, -1, 15, 19545 }, // ̼
+    { 8, 7, 0, -1, 23, 14, 19560 }, // ̽
+    { 7, 10, 0, -1, 26, 18, 19574 }, // ̾
+    { 14, 7, 0, -4, 29, 25, 19592 }, // ̿
+    { 7, 6, 0, -3, 23, 11, 19617 }, // ̀
+    { 8, 6, 0, 0, 23, 12, 19628 }, // ́
+    { 13, 6, 0, 4, 23, 20, 19640 }, // ͂
+    { 6, 6, 0, 0, 23, 9, 19660 }, // ̓
+    { 17, 6, 0, -5, 23, 26, 19669 }, // ̈́
+    { 6, 6, 0, -4, -1, 9, 19695 }, // ͅ
+    { 13, 6, 0, -4, 23, 20, 19704 }, // ͆
+    { 14, 7, 0, -10, 0, 25, 19724 }, // ͇
+    { 10, 6, 0, -7, 0, 15, 19749 }, // ͈
+    { 6, 6, 0, -5, -1, 9, 19764 }, // ͉
+    { 11, 7, 0, -3, 23, 20, 19773 }, // ͊
+    { 12, 12, 0, -3, 28, 36, 19793 }, // ͋
+    { 12, 9, 0, -3, 26, 27, 19829 }, // ͌
+    { 11, 6, 0, -8, -1, 17, 19856 }, // ͍
+    { 6, 7, 0, -5, 0, 11, 19873 }, // ͎
+    { 22, 21, 0, -11, 21, 116, 19884 }, // ͏
+    { 5, 7, 0, 0, 24, 9, 20000 }, // ͐
+    { 6, 7, 0, 3, 25, 11, 20009 }, // ͑
+    { 11, 8, 0, -3, 25, 22, 20020 }, // ͒
+    { 7, 7, 0, -5, 0, 13, 20042 }, // ͓
+    { 6, 6, 0, -5, -1, 9, 20055 }, // ͔
+    { 6, 6, 0, -4, -1, 9, 20064 }, // ͕
+    { 12, 6, 0, -7, -1, 18, 20073 }, // ͖
+    { 6, 7, 0, 2, 24, 11, 20091 }, // ͗
+    { 5, 6, 0, 0, 23, 8, 20102 }, // ͘
+    { 7, 6, 0, -6, -1, 11, 20110 }, // ͙
+    { 12, 7, 0, -8, 0, 21, 20121 }, // ͚
+    { 6, 6, 0, 0, 23, 9, 20142 }, // ͛
+    { 23, 6, 0, -13, -1, 35, 20151 }, // ͜
+    { 23, 6, 0, -9, 23, 35, 20186 }, // ͝
+    { 17, 4, 0, -6, 21, 17, 20221 }, // ͞
+    { 16, 4, 0, -10, -1, 16, 20238 }, // ͟
+    { 24, 6, 0, -9, 23, 36, 20254 }, // ͠
+    { 23, 7, 0, -8, 26, 41, 20290 }, // ͡
+    { 24, 7, 0, -15, 0, 42, 20331 }, // ͢
+    { 8, 8, 0, -1, 25, 16, 20373 }, // ͣ
+    { 8, 8, 0, -1, 25, 16, 20389 }, // ͤ
+    { 5, 9, 0, 1, 27, 12, 20405 }, // ͥ
+    { 8, 8, 0, -1, 25, 16, 20417 }, // ͦ
+    { 8, 8, 0, -1, 25, 16, 20433 }, // ͧ
+    { 7, 8, 0, 0, 25, 14, 20449 }, // ͨ
+    { 9, 10, 0, -1, 27, 23, 20463 }, // ͩ
+    { 8, 9, 0, -1, 27, 18, 20486 }, // ͪ
+    { 12, 7, 0, -3, 25, 21, 20504 }, // ͫ
+    { 7, 7, 0, 0, 25, 13, 20525 }, // ͬ
+    { 6, 9, 0, 0, 26, 14, 20538 }, // ͭ
+    { 7, 7, 0, 0, 25, 13, 20552 }, // ͮ
+    { 9, 7, 0, -2, 25, 16, 20565 }, // ͯ
+    { 17, 28, 15, 0, 28, 119, 20581 }, // Ѐ
+    { 17, 28, 15, 0, 28, 119, 0 }, // Ё
+    { 18, 22, 21, 2, 21, 99, 20700 }, // Ђ
+    { 18, 28, 15, 0, 28, 126, 20799 }, // Ѓ
+    { 18, 23, 18, 1, 22, 104, 20925 }, // Є
+    { 16, 23, 15, 0, 22, 92, 21029 }, // Ѕ
+    { 10, 21, 9, 0, 21, 53, 21121 }, // І
+    { 13, 28, 9, 0, 28, 91, 21174 }, // Ї
+    { 15, 28, 9, -5, 21, 105, 21265 }, // Ј
+    { 30, 22, 28, -2, 21, 165, 21370 }, // Љ
+    { 27, 21, 27, 0, 21, 142, 21535 }, // Њ
+    { 18, 21, 21, 2, 21, 95, 21677 }, // Ћ
+    { 21, 28, 18, 0, 28, 147, 21772 }, // Ќ
+    { 21, 28, 20, 0, 28, 147, 21919 }, // Ѝ
+    { 21, 29, 17, 0, 28, 153, 22066 }, // Ў
+    { 21, 26, 20, 0, 21, 137, 22219 }, // Џ
+    { 19, 21, 18, -2, 21, 100, 119 }, // А
+    { 17, 21, 17, 0, 21, 90, 219 }, // Б
+    { 19, 21, 18, 0, 21, 100, 309 }, // В
+    { 17, 21, 15, 0, 21, 90, 409 }, // Г
+    { 24, 26, 21, -3, 21, 156, 499 }, // Д
+    { 17, 21, 15, 0, 21, 90, 655 }, // Е
+    { 31, 21, 26, -2, 21, 163, 745 }, // Ж
+    { 17, 23, 17, 0, 22, 98, 908 }, // З
+    { 21, 21, 20, 0, 21, 111, 1006 }, // И
+    { 21, 28, 20, 0, 28, 147, 1117 }, // Й
+    { 21, 21, 18, 0, 21, 111, 1264 }, // К
+    { 22, 22, 20, -1, 21, 121, 1375 }, // Л
+    { 26, 21, 25, 0, 21, 137, 1496 }, // М
+    { 21, 21, 20, 0, 21, 111, 1633 }, // Н
+    { 20, 23, 21, 1, 22, 115, 1744 }, // О
+    { 21, 21, 20, 0, 21, 111, 1859 }, // П
+    { 18, 21, 17, 0, 21, 95, 1970 }, // Р
+    { 18, 23, 17, 1, 22, 104, 2065 }, // С
+    { 16, 21, 15, 2, 21, 84, 2169 }, // Т
+    { 21, 22, 17, 0, 21, 116, 2253 }, // У
+    { 25, 23, 26, 1, 22, 144, 2369 }, // Ф
+    { 23, 21, 18, -2, 21, 121, 2513 }, // Х
+    { 21, 26, 20, 0, 21, 137, 2634 }, // Ц
+    { 18, 21, 19, 2, 21, 95, 2771 }, // Ч
+    { 30, 21, 29, 0, 21, 158, 2866 }, // Ш
+    { 29, 26, 29, 0, 21, 189, 3024 }, // Щ
+    { 18, 21, 20, 2, 21, 95, 3213 }, // Ъ
+    { 26, 21, 26, 0, 21, 137, 3308 }, // Ы
+    { 17, 21, 17, 0, 21, 90, 3445 }, // Ь
+    { 18, 23, 18, 0, 22, 104, 3535 }, // Э
+    { 29, 23, 29, 0, 22, 167, 3639 }, // Ю
+    { 21, 21, 18, -2, 21, 111, 3806 }, // Я
+    { 17, 18, 17, 0, 17, 77, 3917 }, // а
+    { 16, 24, 16, 1, 23, 96, 3994 }, // б
+    { 16, 18, 16, 0, 17, 72, 4090 }, // в
+    { 15, 18, 14, -1, 17, 68, 4162 }, // г
+    { 17, 24, 17, 0, 23, 102, 4230 }, // д
+    { 16, 18, 15, 0, 17, 72, 4332 }, // е
+    { 30, 18, 28, -1, 17, 135, 4404 }, // ж
+    { 14, 18, 15, 0, 17, 63, 4539 }, // з
+    { 16, 17, 17, 1, 16, 68, 4602 }, // и
+    { 16, 24, 17, 1, 23, 96, 4670 }, // й
+    { 18, 16, 16, 0, 16, 72, 4766 }, // к
+    { 19, 17, 18, -1, 16, 81, 4838 }, // л
+    { 23, 16, 23, 0, 16, 92, 4919 }, // м
+    { 17, 16, 17, 0, 16, 68, 5011 }, // н
+    { 16, 18, 17, 0, 17, 72, 5079 }, // о
+    { 16, 17, 17, 0, 17, 68, 5151 }, // п
+    { 18, 24, 18, -1, 17, 108, 5219 }, // р
+    { 14, 18, 14, 0, 17, 63, 5327 }, // с
+    { 25, 17, 26, 0, 17, 107, 5390 }, // т
+    { 19, 23, 16, -2, 16, 110, 5497 }, // у
+    { 21, 30, 22, 0, 23, 158, 5607 }, // ф
+    { 19, 16, 15, -2, 16, 76, 5765 }, // х
+    { 16, 20, 18, 1, 16, 80, 5841 }, // ц
+    { 15, 16, 17, 2, 16, 60, 5921 }, // ч
+    { 25, 17, 26, 1, 16, 107, 5981 }, // ш
+    { 25, 20, 27, 1, 16, 125, 6088 }, // щ
+    { 17, 17, 18, 1, 16, 73, 6213 }, // ъ
+    { 23, 17, 23, 0, 16, 98, 6286 }, // ы
+    { 16, 17, 16, 0, 16, 68, 6384 }, // ь
+    { 13, 18, 14, 0, 17, 59, 6452 }, // э
+    { 23, 18, 24, 0, 17, 104, 6511 }, // ю
+    { 18, 16, 16, -2, 16, 72, 6615 }, // я
+    { 16, 24, 15, 0, 23, 96, 22356 }, // ѐ
+    { 16, 23, 15, 0, 22, 92, 6687 }, // ё
+    { 16, 30, 17, 0, 23, 120, 22452 }, // ђ
+    { 16, 24, 14, -1, 23, 96, 22572 }, // ѓ
+    { 14, 18, 14, 0, 17, 63, 22668 }, // є
+    { 14, 18, 13, 0, 17, 63, 22731 }, // ѕ
+    { 10, 23, 8, 0, 23, 58, 22794 }, // і
+    { 11, 23, 8, 0, 23, 64, 22852 }, // ї
+    { 14, 30, 8, -4, 23, 105, 22916 }, // ј
+    { 26, 17, 25, -1, 16, 111, 23021 }, // љ
+    { 24, 17, 24, 0, 16, 102, 23132 }, // њ
+    { 16, 23, 17, 0, 23, 92, 23234 }, // ћ
+    { 18, 23, 16, 0, 23, 104, 23326 }, // ќ
+    { 16, 24, 17, 1, 23, 96, 23430 }, // ѝ
+    { 19, 30, 16, -2, 23, 143, 23526 }, // ў
+    { 16, 22, 17, 1, 16, 88, 23669 }, // џ
+    { 27, 21, 26, 2, 21, 142, 23757 }, // Ѡ
+    { 24, 16, 24, 1, 16, 96, 23899 }, // ѡ
+    { 16, 21, 18, 1, 21, 84, 23995 }, // Ѣ
+    { 24, 18, 25, 0, 17, 108, 24079 }, // ѣ
+    { 28, 23, 26, 0, 22, 161, 24187 }, // Ѥ
+    { 23, 18, 22, 0, 17, 104, 24348 }, // ѥ
+    { 20, 21, 20, -2, 21, 105, 24452 }, // Ѧ
+    { 18, 16, 17, -2, 16, 72, 24557 }, // ѧ
+    { 26, 21, 27, 0, 21, 137, 24629 }, // Ѩ
+    { 23, 16, 24, 0, 16, 92, 24766 }, // ѩ
+    { 24, 21, 21, -2, 21, 126, 24858 }, // Ѫ
+    { 20, 16, 17, -2, 16, 80, 24984 }, // ѫ
+    { 30, 21, 29, 0, 21, 158, 25064 }, // Ѭ
+    { 25, 16, 24, 0, 16, 100, 25222 }, // ѭ
+    { 20, 33, 17, -2, 26, 165, 25322 }, // Ѯ
+    { 18, 27, 15, -2, 20, 122, 25487 }, // ѯ
+    { 23, 21, 24, 3, 21, 121, 25609 }, // Ѱ
+    { 22, 30, 24, 1, 23, 165, 25730 }, // ѱ
+    { 20, 23, 21, 1, 22, 115, 25895 }, // Ѳ
+    { 15, 18, 17, 1, 17, 68, 26010 }, // ѳ
+    { 19, 21, 19, 2, 21, 100, 26078 }, // Ѵ
+    { 16, 17, 16, 1, 17, 68, 26178 }, // ѵ
+    { 19, 28, 19, 2, 28, 133, 26246 }, // Ѷ
+    { 16, 23, 16, 1, 23, 92, 26379 }, // ѷ
+    { 37, 29, 36, 1, 22, 269, 26471 }, // Ѹ
+    { 33, 24, 32, 1, 17, 198, 26740 }, // ѹ
+    { 21, 25, 22, 1, 23, 132, 26938 }, // Ѻ
+    { 17, 20, 18, 1, 18, 85, 27070 }, // ѻ
+    { 28, 32, 30, 1, 31, 224, 27155 }, // Ѽ
+    { 23, 27, 25, 1, 26, 156, 27379 }, // ѽ
+    { 27, 27, 26, 2, 27, 183, 27535 }, // Ѿ
+    { 24, 22, 24, 1, 22, 132, 27718 }, // ѿ
+    { 19, 29, 18, 1, 22, 138, 27850 }, // Ҁ
+    { 14, 24, 14, 1, 17, 84, 27988 }, // ҁ
+    { 16, 20, 18, 1, 19, 80, 28072 }, // ҂
+    { 12, 6, 0, -12, 22, 18, 28152 }, // ҃
+    { 12, 6, 0, -12, 23, 18, 28170 }, // ҄
+    { 5, 7, 0, -8, 24, 9, 28188 }, // ҅
+    { 6, 7, 0, -9, 24, 11, 28197 }, // ҆
+    { 13, 5, 0, -3, 27, 17, 28208 }, // ҇
+    { 34, 31, 0, -17, 23, 264, 28225 }, // ҈
+    { 34, 33, 0, -17, 24, 281, 28489 }, // ҉
+    { 23, 35, 24, 0, 28, 202, 28770 }, // Ҋ
+    { 18, 29, 18, 1, 23, 131, 0 }, // ҋ
+    { 16, 21, 17, 0, 21, 84, 131 }, // Ҍ
+    { 14, 24, 17, 1, 23, 84, 215 }, // ҍ
+    { 18, 21, 18, 0, 21, 95, 299 }, // Ҏ
+    { 18, 24, 17, -1, 17, 108, 394 }, // ҏ
+    { 18, 26, 15, 0, 26, 117, 502 }, // Ґ
+    { 16, 21, 13, 0, 21, 84, 619 }, // ґ
+    { 17, 21, 15, 0, 21, 90, 703 }, // Ғ
+    { 16, 16, 14, -1, 16, 64, 793 }, // ғ
+    { 17, 29, 19, 0, 21, 124, 857 }, // Ҕ
+    { 15, 24, 17, 0, 16, 90, 981 }, // ҕ
+    { 30, 28, 27, -2, 21, 210, 1071 }, // Җ
+    { 30, 23, 28, -1, 17, 173, 1281 }, // җ
+    { 17, 30, 17, 0, 22, 128, 1454 }, // Ҙ
+    { 14, 25, 15, 0, 17, 88, 1582 }, // ҙ
+    { 21, 28, 20, 0, 21, 147, 1670 }, // Қ
+    { 18, 22, 18, 0, 16, 99, 1817 }, // қ
+    { 21, 21, 18, 0, 21, 111, 1916 }, // Ҝ
+    { 18, 16, 17, 1, 16, 72, 2027 }, // ҝ
+    { 21, 21, 18, 0, 21, 111, 2099 }, // Ҟ
+    { 18, 23, 17, 0, 23, 104, 2210 }, // ҟ
+    { 21, 21, 20, 2, 21, 111, 2314 }, // Ҡ
+    { 20, 16, 19, 1, 16, 80, 2425 }, // ҡ
+    { 21, 28, 22, 0, 21, 147, 2505 }, // Ң
+    { 19, 22, 20, 0, 16, 105, 2652 }, // ң
+    { 25, 21, 22, 0, 21, 132, 2757 }, // Ҥ
+    { 23, 16, 21, 0, 16, 92, 2889 }, // ҥ
+    { 28, 29, 30, 0, 21, 203, 2981 }, // Ҧ
+    { 23, 24, 25, 0, 16, 138, 3184 }, // ҧ
+    { 20, 24, 21, 1, 22, 120, 3322 }, // Ҩ
+    { 16, 19, 18, 1, 17, 76, 3442 }, // ҩ
+    { 19, 30, 18, 1, 22, 143, 3518 }, // Ҫ
+    { 14, 25, 14, 1, 17, 88, 3661 }, // ҫ
+    { 16, 28, 15, 2, 21, 112, 3749 }, // Ҭ
+    { 26, 23, 27, 0, 17, 150, 3861 }, // ҭ
+    { 18, 21, 16, 2, 21, 95, 4011 }, // Ү
+    { 16, 23, 15, 1, 16, 92, 4106 }, // ү
+    { 19, 21, 16, 1, 21, 100, 4198 }, // Ұ
+    { 18, 23, 15, -1, 16, 104, 4298 }, // ұ
+    { 22, 28, 20, -2, 21, 154, 4402 }, // Ҳ
+    { 20, 22, 17, -2, 16, 110, 4556 }, // ҳ
+    { 22, 28, 24, 2, 21, 154, 4666 }, // Ҵ
+    { 18, 22, 20, 1, 16, 99, 4820 }, // ҵ
+    { 19, 28, 22, 2, 21, 133, 4919 }, // Ҷ
+    { 16, 22, 19, 2, 16, 88, 5052 }, // ҷ
+    { 18, 21, 20, 2, 21, 95, 5140 }, // Ҹ
+    { 16, 16, 18, 2, 16, 64, 5235 }, // ҹ
+    { 18, 21, 20, 0, 21, 95, 5299 }, // Һ
+    { 17, 23, 18, 0, 23, 98, 5394 }, // һ
+    { 23, 23, 23, 0, 22, 133, 5492 }, // Ҽ
+    { 19, 18, 19, 0, 17, 86, 5625 }, // ҽ
+    { 23, 29, 23, 0, 22, 167, 5711 }, // Ҿ
+    { 19, 23, 19, 0, 17, 110, 5878 }, // ҿ
+    { 14, 21, 11, -1, 21, 74, 5988 }, // Ӏ
+    { 31, 28, 26, -2, 28, 217, 6062 }, // Ӂ
+    { 30, 24, 28, -1, 23, 180, 6279 }, // ӂ
+    { 21, 29, 20, 0, 21, 153, 6459 }, // Ӄ
+    { 18, 24, 18, 0, 16, 108, 6612 }, // ӄ
+    { 23, 28, 22, -1, 21, 161, 6720 }, // Ӆ
+    { 20, 23, 19, -1, 17, 115, 6881 }, // ӆ
+    { 21, 29, 20, 0, 21, 153, 6996 }, // Ӈ
+    { 18, 24, 18, 0, 16, 108, 7149 }, // ӈ
+    { 22, 28, 22, 0, 21, 154, 7257 }, // Ӊ
+    { 19, 22, 20, 0, 16, 105, 7411 }, // ӊ
+    { 18, 28, 20, 2, 21, 126, 7516 }, // Ӌ
+    { 15, 22, 17, 2, 16, 83, 7642 }, // ӌ
+    { 27, 28, 28, 0, 21, 189, 7725 }, // Ӎ
+    { 24, 22, 24, 0, 16, 132, 7914 }, // ӎ
+    { 14, 21, 11, -1, 21, 74, 8046 }, // ӏ
+    { 21, 28, 18, -2, 28, 147, 8120 }, // Ӑ
+    { 16, 24, 17, 1, 23, 96, 8267 }, // ӑ
+    { 20, 27, 18, -2, 27, 135, 8363 }, // Ӓ
+    { 16, 23, 17, 1, 22, 92, 8498 }, // ӓ
+    { 30, 21, 26, -2, 21, 158, 8590 }, // Ӕ
+    { 24, 18, 25, 1, 17, 108, 8748 }, // ӕ
+    { 18, 28, 16, 0, 28, 126, 8856 }, // Ӗ
+    { 17, 24, 16, 1, 23, 102, 8982 }, // ӗ
+    { 19, 23, 19, 0, 22, 110, 9084 }, // Ә
+    { 15, 18, 16, 0, 17, 68, 9194 }, // ә
+    { 19, 28, 19, 0, 27, 133, 9262 }, // Ӛ
+    { 15, 23, 16, 0, 22, 87, 9395 }, // ӛ
+    { 31, 27, 26, -2, 27, 210, 9482 }, // Ӝ
+    { 30, 23, 28, -1, 22, 173, 9692 }, // ӝ
+    { 17, 28, 17, 0, 27, 119, 9865 }, // Ӟ
+    { 15, 23, 15, 0, 22, 87, 9984 }, // ӟ
+    { 18, 22, 16, -1, 21, 99, 10071 }, // Ӡ
+    { 18, 24, 16, -2, 16, 108, 10170 }, // ӡ
+    { 21, 26, 20, 0, 26, 137, 10278 }, // Ӣ
+    { 17, 22, 18, 1, 21, 94, 10415 }, // ӣ
+    { 21, 27, 20, 0, 27, 142, 10509 }, // Ӥ
+    { 17, 23, 18, 1, 22, 98, 10651 }, // ӥ
+    { 20, 28, 21, 1, 27, 140, 10749 }, // Ӧ
+    { 15, 23, 17, 1, 22, 87, 10889 }, // ӧ
+    { 20, 23, 21, 1, 22, 115, 10976 }, // Ө
+    { 15, 18, 17, 1, 17, 68, 11091 }, // ө
+    { 20, 28, 21, 1, 27, 140, 11159 }, // Ӫ
+    { 15, 23, 17, 1, 22, 87, 11299 }, // ӫ
+    { 18, 28, 18, 0, 27, 126, 11386 }, // Ӭ
+    { 14, 23, 14, 0, 22, 81, 11512 }, // ӭ
+    { 21, 27, 17, 0, 26, 142, 11593 }, // Ӯ
+    { 20, 28, 15, -3, 21, 140, 11735 }, // ӯ
+    { 21, 28, 17, 0, 27, 147, 11875 }, // Ӱ
+    { 20, 29, 15, -3, 22, 145, 12022 }, // ӱ
+    { 21, 29, 17, 0, 28, 153, 12167 }, // Ӳ
+    { 21, 30, 15, -3, 23, 158, 12320 }, // ӳ
+    { 18, 27, 19, 2, 27, 122, 12478 }, // Ӵ
+    { 15, 22, 17, 2, 22, 83, 12600 }, // ӵ
+    { 17, 28, 15, 0, 21, 119, 12683 }, // Ӷ
+    { 15, 22, 14, 0, 16, 83, 12802 }, // ӷ
+    { 26, 27, 26, 0, 27, 176, 12885 }, // Ӹ
+    { 23, 23, 23, 0, 22, 133, 13061 }, // ӹ
+    { 17, 29, 15, 0, 21, 124, 13194 }, // Ӻ
+    { 16, 24, 14, -1, 16, 96, 13318 }, // ӻ
+    { 22, 29, 20, -2, 21, 160, 13414 }, // Ӽ
+    { 19, 24, 17, -2, 16, 114, 13574 }, // ӽ
+    { 23, 21, 18, -2, 21, 121, 13688 }, // Ӿ
+    { 19, 16, 15, -2, 16, 76, 13809 }, // ӿ
+    { 0, 0, 15, 0, 0, 0, 13885 }, //  
+    { 0, 0, 29, 0, 0, 0, 13885 }, //  
+    { 0, 0, 15, 0, 0, 0, 13885 }, //  
+    { 0, 0, 29, 0, 0, 0, 13885 }, //  
+    { 0, 0, 10, 0, 0, 0, 13885 }, //  
+    { 0, 0, 7, 0, 0, 0, 13885 }, //  
+    { 0, 0, 5, 0, 0, 0, 13885 }, //  
+    { 0, 0, 16, 0, 0, 0, 13885 }, //  
+    { 0, 0, 8, 0, 0, 0, 13885 }, //  
+    { 0, 0, 5, 0, 0, 0, 13885 }, //  
+    { 0, 0, 3, 0, 0, 0, 13885 }, //  
+    { 0, 0, 0, 0, 0, 0, 13885 }, // ​
+    { 0, 0, 0, 0, 0, 0, 13885 }, // ‌
+    { 0, 0, 0, 0, 0, 0, 13885 }, // ‍
+    { 8, 25, 0, -1, 21, 50, 13885 }, // ‎
+    { 8, 25, 0, -7, 21, 50, 13935 }, // ‏
+    { 9, 4, 9, 0, 10, 9, 13985 }, // ‐
+    { 9, 4, 9, 0, 10, 9, 13994 }, // ‑
+    { 15, 4, 16, 1, 12, 15, 14003 }, // ‒
+    { 14, 4, 14, 0, 10, 14, 12959 }, // –
+    { 28, 4, 28, 0, 10, 28, 12973 }, // —
+    { 28, 4, 28, 0, 10, 28, 14018 }, // ―
+    { 12, 30, 16, 2, 23, 90, 14046 }, // ‖
+    { 14, 7, 12, -4, 0, 25, 14136 }, // ‗
+    { 8, 8, 6, 1, 21, 16, 13001 }, // ‘
+    { 8, 8, 6, 1, 21, 16, 13017 }, // ’
+    { 8, 8, 8, -2, 4, 16, 14161 }, // ‚
+    { 5, 8, 6, 3, 21, 10, 14177 }, // ‛
+    { 14, 8, 13, 1, 21, 28, 13033 }, // “
+    { 14, 8, 13, 1, 21, 28, 13061 }, // ”
+    { 14, 8, 15, -2, 4, 28, 14187 }, // „
+    { 11, 8, 13, 3, 21, 22, 14215 }, // ‟
+    { 13, 23, 15, 2, 23, 75, 14237 }, // †
+    { 16, 23, 15, 0, 23, 92, 14312 }, // ‡
+    { 10, 10, 11, 1, 16, 25, 14404 }, // •
+    { 10, 12, 10, 1, 17, 30, 14429 }, // ‣
+    { 6, 6, 15, 3, 5, 9, 14459 }, // ․
+    { 14, 6, 17, 0, 5, 21, 14468 }, // ‥
+    { 22, 6, 24, 0, 5, 33, 13089 }, // …
+    { 6, 6, 9, 2, 11, 9, 14489 }, // ‧
+    { 0, 0, 18, 0, 0, 0, 14498 }, //  
+    { 0, 0, 18, 0, 0, 0, 14498 }, //  
+    { 8, 22, 0, -1, 18, 44, 14498 }, // ‪
+    { 8, 22, 0, -7, 18, 44, 14542 }, // ‫
+    { 8, 25, 0, -4, 21, 50, 14586 }, // ‬
+    { 8, 25, 0, -4, 21, 50, 14636 }, // ‭
+    { 8, 25, 0, -4, 21, 50, 14686 }, // ‮
+    { 0, 0, 5, 0, 0, 0, 14736 }, //  
+    { 34, 23, 36, 1, 22, 196, 14736 }, // ‰
+    { 45, 23, 46, 1, 22, 259, 14932 }, // ‱
+    { 10, 8, 8, 1, 21, 20, 15191 }, // ′
+    { 16, 8, 15, 1, 21, 32, 15211 }, // ″
+    { 23, 8, 22, 1, 21, 46, 15243 }, // ‴
+    { 8, 8, 8, 2, 21, 16, 15289 }, // ‵
+    { 14, 8, 15, 2, 21, 28, 15305 }, // ‶
+    { 21, 8, 22, 2, 21, 42, 15333 }, // ‷
+    { 11, 10, 10, -3, 3, 28, 15375 }, // ‸
+    { 9, 14, 10, 1, 15, 32, 15403 }, // ‹
+    { 9, 14, 9, 0, 15, 32, 15435 }, // ›
+    { 24, 23, 25, 0, 22, 138, 15467 }, // ※
+    { 18, 22, 16, 0, 21, 99, 15605 }, // ‼
+    { 13, 23, 13, 2, 22, 75, 15704 }, // ‽
+    { 15, 4, 12, 2, 26, 15, 15779 }, // ‾
+    { 16, 7, 16, -2, 0, 28, 15794 }, // ‿
+    { 16, 8, 16, 2, 24, 32, 15822 }, // ⁀
+    { 15, 19, 11, -3, 12, 72, 15854 }, // ⁁
+    { 33, 27, 34, -1, 23, 223, 15926 }, // ⁂
+    { 9, 5, 9, 0, 10, 12, 16149 }, // ⁃
+    { 20, 21, 4, -8, 21, 105, 16161 }, // ⁄
+    { 13, 26, 10, -1, 21, 85, 16266 }, // ⁅
+    { 13, 26, 10, -2, 21, 85, 16351 }, // ⁆
+    { 26, 23, 26, 2, 22, 150, 16436 }, // ⁇
+    { 21, 23, 22, 2, 22, 121, 16586 }, // ⁈
+    { 23, 23, 22, 0, 22, 133, 16707 }, // ⁉
+    { 15, 16, 16, 1, 16, 60, 16840 }, // ⁊
+    { 16, 27, 18, 2, 23, 108, 16900 }, // ⁋
+    { 16, 15, 19, 1, 16, 60, 17008 }, // ⁌
+    { 16, 15, 19, 2, 16, 60, 17068 }, // ⁍
+    { 15, 15, 16, -1, 8, 57, 17128 }, // ⁎
+    { 8, 21, 8, 1, 17, 42, 17185 }, // ⁏
+    { 20, 31, 16, -2, 24, 155, 17227 }, // ⁐
+    { 18, 30, 16, -1, 23, 135, 17382 }, // ⁑
+    { 13, 23, 12, 0, 22, 75, 17517 }, // ⁒
+    { 28, 7, 29, 1, 12, 49, 17592 }, // ⁓
+    { 16, 7, 16, -3, 0, 28, 17641 }, // ⁔
+    { 16, 16, 17, 0, 15, 64, 17669 }, // ⁕
+    { 14, 23, 16, 1, 22, 81, 17733 }, // ⁖
+    { 27, 8, 26, 1, 21, 54, 17814 }, // ⁗
+    { 23, 23, 25, 1, 22, 133, 17868 }, // ⁘
+    { 23, 23, 25, 1, 22, 133, 18001 }, // ⁙
+    { 6, 23, 8, 1, 22, 35, 18134 }, // ⁚
+    { 19, 24, 21, 1, 23, 114, 18169 }, // ⁛
+    { 24, 23, 24, 0, 22, 138, 18283 }, // ⁜
+    { 6, 24, 8, 1, 23, 36, 18421 }, // ⁝
+    { 5, 23, 8, 2, 22, 29, 18457 }, // ⁞
+    { 0, 0, 6, 0, 0, 0, 18486 }, //  
+    { 0, 0, 18, 0, 0, 0, 18486 }, // ⁠
+    { 0, 0, 18, 0, 0, 0, 18486 }, // ⁡
+    { 0, 0, 18, 0, 0, 0, 18486 }, // ⁢
+    { 0, 0, 18, 0, 0, 0, 18486 }, // ⁣
+    { 0, 0, 18, 0, 0, 0, 18486 }, // ⁤
+    { 0, 0, 18, 0, 0, 0, 18486 }, // ⁦
+    { 0, 0, 18, 0, 0, 0, 18486 }, // ⁧
+    { 0, 0, 18, 0, 0, 0, 18486 }, // ⁨
+    { 0, 0, 18, 0, 0, 0, 18486 }, // ⁩
+    { 8, 25, 0, -4, 21, 50, 18486 }, // ⁪
+    { 8, 25, 0, -4, 21, 50, 18536 }, // ⁫
+    { 8, 25, 0, -4, 21, 50, 18586 }, // ⁬
+    { 8, 25, 0, -4, 21, 50, 18636 }, // ⁭
+    { 8, 25, 0, -4, 21, 50, 18686 }, // ⁮
+    { 8, 25, 0, -4, 21, 50, 18736 }, // ⁯
+    { 11, 14, 11, 2, 25, 39, 18786 }, // ⁰
+    { 6, 14, 7, 2, 22, 21, 18825 }, // ⁱ
+    { 12, 13, 11, 1, 25, 39, 18846 }, // ⁴
+    { 11, 14, 11, 2, 25, 39, 18885 }, // ⁵
+    { 11, 14, 11, 2, 25, 39, 18924 }, // ⁶
+    { 12, 13, 11, 2, 25, 39, 18963 }, // ⁷
+    { 11, 14, 11, 2, 25, 39, 19002 }, // ⁸
+    { 11, 14, 11, 2, 25, 39, 19041 }, // ⁹
+    { 9, 9, 11, 3, 22, 21, 19080 }, // ⁺
+    { 9, 3, 11, 3, 19, 7, 19101 }, // ⁻
+    { 10, 7, 12, 3, 21, 18, 19108 }, // ⁼
+    { 8, 17, 7, 3, 26, 34, 19126 }, // ⁽
+    { 8, 17, 7, 0, 26, 34, 19160 }, // ⁾
+    { 12, 11, 11, 1, 19, 33, 19194 }, // ⁿ
+    { 11, 14, 11, -1, 9, 39, 19227 }, // ₀
+    { 10, 13, 11, -1, 9, 33, 19266 }, // ₁
+    { 12, 13, 11, -2, 9, 39, 19299 }, // ₂
+    { 11, 14, 11, -2, 9, 39, 19338 }, // ₃
+    { 12, 13, 11, -2, 9, 39, 19377 }, // ₄
+    { 11, 14, 11, -1, 9, 39, 19416 }, // ₅
+    { 11, 14, 11, -1, 9, 39, 19455 }, // ₆
+    { 12, 13, 11, -1, 9, 39, 19494 }, // ₇
+    { 12, 14, 11, -2, 9, 42, 19533 }, // ₈
+    { 11, 14, 11, -1, 9, 39, 19575 }, // ₉
+    { 9, 9, 11, 0, 7, 21, 19614 }, // ₊
+    { 9, 3, 11, 0, 4, 7, 19635 }, // ₋
+    { 9, 7, 12, 0, 6, 16, 19642 }, // ₌
+    { 8, 17, 7, 0, 11, 34, 19658 }, // ₍
+    { 7, 17, 7, -3, 11, 30, 19692 }, // ₎
+    { 11, 10, 11, -1, 7, 28, 19722 }, // ₐ
+    { 10, 10, 10, -1, 7, 25, 19750 }, // ₑ
+    { 10, 10, 11, -1, 7, 25, 19775 }, // ₒ
+    { 13, 10, 10, -3, 7, 33, 19800 }, // ₓ
+    { 11, 10, 10, -2, 7, 28, 19833 }, // ₔ
+    { 12, 14, 13, -1, 11, 42, 19861 }, // ₕ
+    { 13, 14, 11, -1, 11, 46, 19903 }, // ₖ
+    { 7, 14, 7, -1, 11, 25, 19949 }, // ₗ
+    { 17, 10, 19, -1, 7, 43, 19974 }, // ₘ
+    { 11, 10, 11, -2, 7, 28, 20017 }, // ₙ
+    { 12, 14, 11, -3, 7, 42, 20045 }, // ₚ
+    { 9, 10, 10, -1, 7, 23, 20087 }, // ₛ
+    { 8, 12, 8, -1, 9, 24, 20110 }, // ₜ
+    { 17, 22, 17, 1, 22, 94, 20134 }, // ₠
+    { 19, 25, 16, 0, 23, 119, 20228 }, // ₡
+    { 18, 23, 17, 0, 22, 104, 20347 }, // ₢
+    { 18, 21, 16, 0, 21, 95, 20451 }, // ₣
+    { 19, 22, 16, -1, 22, 105, 20546 }, // ₤
+    { 25, 24, 26, 0, 20, 150, 20651 }, // ₥
+    { 18, 21, 17, 0, 21, 95, 20801 }, // ₦
+    { 25, 22, 25, 0, 21, 138, 20896 }, // ₧
+    { 27, 22, 26, 0, 21, 149, 21034 }, // ₨
+    { 23, 21, 21, 0, 21, 121, 21183 }, // ₩
+    { 26, 21, 25, 0, 21, 137, 21304 }, // ₪
+    { 20, 28, 17, 0, 23, 140, 21441 }, // ₫
+    { 18, 23, 16, 0, 22, 104, 21581 }, // €
+    { 20, 21, 17, 0, 21, 105, 21685 }, // ₭
+    { 17, 21, 15, 1, 21, 90, 21790 }, // ₮
+    { 29, 29, 29, 0, 22, 211, 21880 }, // ₯
+    { 20, 29, 17, -2, 22, 145, 22091 }, // ₰
+    { 18, 21, 17, 0, 21, 95, 22236 }, // ₱
+    { 19, 26, 20, 1, 23, 124, 22331 }, // ₲
+    { 21, 21, 18, -2, 21, 111, 22455 }, // ₳
+    { 18, 23, 17, 0, 22, 104, 22566 }, // ₴
+    { 19, 26, 18, 1, 23, 124, 22670 }, // ₵
+    { 21, 21, 20, 0, 20, 111, 22794 }, // ₶
+    { 22, 25, 20, -1, 22, 138, 22905 }, // ₷
+    { 17, 21, 15, 1, 21, 90, 23043 }, // ₸
+    { 15, 21, 16, 2, 21, 79, 23133 }, // ₹
+    { 16, 22, 16, 0, 21, 88, 23212 }, // ₺
+    { 19, 23, 19, 1, 22, 110, 23300 }, // ₻
+    { 24, 21, 24, -1, 21, 126, 23410 }, // ₼
+    { 19, 21, 17, -1, 21, 100, 23536 }, // ₽
+    { 20, 24, 18, -1, 24, 120, 23636 }, // ₾
+    { 17, 27, 16, 0, 24, 115, 23756 }, // ₿
+    { 9, 4, 9, 0, 10, 9, 23871 }, // −
+    { 28, 30, 21, -4, 23, 210, 23880 }, // ﬀ
+    { 25, 30, 20, -4, 23, 188, 24090 }, // ﬁ
+    { 25, 30, 20, -4, 23, 188, 24278 }, // ﬂ
+    { 34, 30, 29, -4, 23, 255, 24466 }, // ﬃ
+    { 35, 30, 29, -4, 23, 263, 24721 }, // ﬄ
+    { 27, 30, 22, -4, 23, 203, 24984 }, // ﬅ
+    { 27, 24, 26, 0, 23, 162, 25187 }, // ﬆ
+    { 27, 28, 29, 1, 23, 189, 25349 }, // �
 };
 
 static const EpdUnicodeInterval notosans_14_bolditalicIntervals[] = {
@@ -3015,31 +3056,302 @@ static const EpdUnicodeInterval notosans_14_bolditalicIntervals[] = {
     { 0x2090, 0x209C, 0x33D },
     { 0x20A0, 0x20BF, 0x34A },
     { 0x2212, 0x2212, 0x36A },
-    { 0xFFFD, 0xFFFD, 0x36B },
+    { 0xFB00, 0xFB06, 0x36B },
+    { 0xFFFD, 0xFFFD, 0x372 },
 };
 
 static const EpdFontGroup notosans_14_bolditalicGroups[] = {
-    { 0, 4028, 7742, 97, 0 },
-    { 4028, 3880, 9079, 96, 97 },
-    { 7908, 5696, 14655, 128, 193 },
-    { 13604, 1458, 2064, 112, 321 },
-    { 15062, 12983, 29055, 256, 433 },
-    { 28045, 2448, 5064, 111, 689 },
-    { 30493, 943, 1348, 42, 800 },
-    { 31436, 2194, 3737, 32, 842 },
-    { 33630, 12, 9, 1, 874 },
-    { 33642, 112, 189, 1, 875 },
+    { 0, 5629, 13122, 151, 2 },
+    { 5629, 3422, 6779, 66, 434 },
+    { 9051, 12862, 28972, 362, 0 },
+    { 21913, 12380, 25538, 304, 572 },
+};
+
+static const uint8_t notosans_14_bolditalicGlyphGroups[883] = {
+    2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2,
+    2, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 2, 2,
+    2, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 0, 0, 3, 3, 3, 0, 0, 3, 3, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+};
+
+static const uint8_t notosans_14_bolditalicKernLeftClasses[883] = {
+    0, 0, 71, 0, 2, 0, 0, 0, 61, 2, 19, 0, 0, 0, 7, 25,
+    7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 14, 47, 41, 15, 33, 64, 0, 0, 0, 0, 41, 22, 0,
+    0, 15, 46, 15, 0, 0, 11, 47, 38, 38, 41, 17, 66, 19, 0, 0,
+    0, 70, 0, 0, 29, 75, 0, 29, 60, 0, 0, 0, 0, 63, 0, 0,
+    0, 29, 29, 0, 31, 0, 59, 0, 36, 36, 63, 36, 0, 19, 0, 0,
+    0, 0, 68, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 34, 0, 0, 0,
+    62, 14, 14, 14, 14, 14, 14, 33, 41, 33, 33, 33, 33, 0, 0, 0,
+    0, 15, 0, 15, 15, 15, 15, 15, 0, 15, 47, 47, 47, 47, 17, 46,
+    0, 0, 0, 0, 0, 0, 0, 29, 0, 29, 29, 29, 29, 0, 0, 0,
+    72, 29, 0, 29, 29, 29, 29, 29, 0, 29, 0, 0, 0, 0, 36, 29,
+    36, 14, 0, 14, 0, 14, 0, 41, 0, 41, 0, 41, 0, 41, 0, 15,
+    32, 15, 0, 33, 29, 33, 29, 33, 29, 33, 29, 33, 29, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65, 0, 72, 0, 0, 76,
+    0, 0, 0, 0, 0, 0, 0, 41, 63, 63, 22, 0, 22, 0, 22, 32,
+    22, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 29, 15,
+    29, 15, 29, 33, 29, 0, 31, 0, 31, 0, 31, 0, 0, 0, 0, 0,
+    0, 0, 0, 11, 59, 11, 58, 11, 59, 47, 0, 47, 0, 47, 0, 47,
+    0, 47, 0, 47, 0, 38, 36, 17, 36, 17, 66, 0, 66, 0, 66, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 13, 10, 26, 74, 0, 0, 73, 13, 13, 52, 8, 0, 1,
+    0, 6, 56, 44, 10, 4, 0, 8, 44, 0, 0, 8, 0, 0, 0, 12,
+    0, 27, 26, 10, 1, 45, 8, 4, 0, 0, 4, 13, 0, 13, 12, 12,
+    0, 42, 51, 30, 40, 39, 40, 18, 30, 42, 42, 50, 42, 42, 42, 3,
+    37, 3, 18, 37, 20, 3, 50, 23, 42, 42, 23, 5, 42, 5, 3, 3,
+    42, 40, 40, 48, 40, 18, 67, 0, 57, 69, 5, 5, 37, 50, 42, 20,
+    42, 1, 55, 43, 5, 26, 0, 6, 35, 6, 35, 0, 0, 0, 0, 44,
+    30, 0, 0, 12, 3, 1, 55, 1, 55, 20, 20, 12, 3, 12, 3, 1,
+    55, 26, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 39, 43, 5, 27,
+    3, 9, 53, 16, 54, 0, 28, 21, 0, 44, 30, 21, 0, 8, 18, 8,
+    18, 8, 18, 4, 39, 16, 53, 0, 28, 0, 3, 26, 0, 9, 39, 24,
+    47, 24, 47, 21, 0, 4, 39, 4, 39, 0, 0, 0, 28, 42, 40, 42,
+    40, 0, 8, 18, 0, 18, 4, 39, 0, 0, 4, 39, 0, 0, 4, 39,
+    0, 6, 0, 6, 0, 0, 40, 0, 40, 12, 3, 12, 3, 8, 18, 44,
+    30, 0, 0, 0, 0, 0, 0, 12, 3, 12, 3, 12, 3, 12, 3, 1,
+    20, 1, 20, 1, 20, 0, 42, 9, 53, 0, 42, 16, 54, 21, 0, 8,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 25, 25, 25, 0, 0, 2, 2, 7, 0, 2, 2, 7,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 34, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 77, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 78, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 60, 0, 0, 0, 0,
+    0, 0, 0,
+};
+
+static const uint8_t notosans_14_bolditalicKernRightClasses[883] = {
+    0, 0, 0, 70, 8, 0, 0, 0, 65, 8, 0, 28, 0, 0, 2, 24,
+    2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27, 27, 0, 0,
+    0, 58, 0, 10, 0, 4, 0, 0, 0, 4, 0, 0, 41, 0, 0, 0,
+    0, 4, 0, 4, 0, 0, 19, 49, 39, 39, 62, 29, 0, 0, 0, 28,
+    0, 0, 0, 18, 0, 1, 1, 1, 64, 22, 0, 0, 64, 0, 0, 11,
+    11, 1, 11, 1, 11, 22, 0, 11, 20, 20, 0, 20, 53, 0, 0, 28,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 30, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 47, 0, 0, 0,
+    0, 10, 10, 10, 10, 10, 10, 71, 4, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4, 4, 4, 4, 4, 0, 4, 49, 49, 49, 49, 29, 0,
+    64, 1, 18, 18, 18, 18, 18, 18, 1, 1, 1, 1, 1, 0, 0, 0,
+    0, 0, 11, 1, 1, 1, 1, 1, 0, 1, 11, 11, 11, 11, 20, 0,
+    20, 10, 18, 10, 18, 10, 18, 4, 1, 4, 1, 4, 1, 4, 1, 0,
+    1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 4, 22, 4,
+    22, 4, 22, 4, 22, 0, 0, 0, 72, 0, 63, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 64, 0, 0, 11, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 11, 0, 11, 0, 11, 0, 0, 11, 4, 1, 4,
+    1, 4, 1, 4, 1, 0, 11, 0, 11, 0, 0, 0, 22, 0, 22, 0,
+    22, 0, 22, 19, 0, 19, 0, 19, 0, 49, 11, 49, 11, 49, 11, 49,
+    11, 49, 11, 49, 11, 39, 20, 29, 20, 29, 0, 53, 0, 53, 0, 53,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 3, 0, 35, 69, 0, 0, 32, 31, 0, 3, 0, 0, 15,
+    0, 13, 0, 0, 0, 45, 0, 17, 42, 0, 0, 0, 31, 0, 0, 35,
+    0, 0, 35, 3, 15, 46, 17, 0, 5, 0, 0, 3, 0, 0, 42, 0,
+    67, 14, 68, 14, 36, 54, 14, 21, 36, 56, 56, 27, 33, 27, 27, 14,
+    27, 27, 14, 27, 9, 14, 61, 56, 6, 56, 56, 16, 56, 56, 21, 27,
+    66, 14, 14, 26, 36, 14, 60, 0, 59, 48, 33, 27, 26, 27, 56, 9,
+    56, 43, 40, 51, 0, 0, 23, 13, 34, 0, 23, 0, 0, 0, 23, 42,
+    36, 5, 23, 12, 7, 43, 40, 43, 40, 12, 7, 12, 7, 12, 7, 43,
+    40, 12, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 23, 51, 26, 0,
+    23, 0, 23, 51, 0, 0, 23, 17, 36, 42, 36, 0, 23, 0, 23, 51,
+    26, 44, 16, 0, 23, 0, 23, 0, 23, 12, 7, 12, 7, 3, 23, 50,
+    57, 50, 57, 17, 21, 44, 16, 5, 6, 5, 6, 0, 23, 37, 38, 37,
+    38, 0, 17, 21, 0, 23, 52, 34, 0, 23, 0, 23, 5, 6, 0, 23,
+    0, 13, 55, 13, 55, 13, 55, 0, 7, 51, 36, 51, 36, 17, 21, 42,
+    36, 0, 0, 0, 23, 0, 23, 12, 7, 12, 7, 12, 7, 42, 21, 15,
+    9, 15, 9, 15, 9, 5, 6, 0, 23, 0, 56, 51, 0, 17, 21, 17,
+    21, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 24, 24, 24, 0, 0, 25, 8, 2, 0, 25, 8, 2,
+    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 30, 47, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 73, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 74, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 0, 0, 0, 0,
+    0, 0, 0,
+};
+
+static const int8_t notosans_14_bolditalicKernMatrix[5925] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 2, -1, 0, 0, -1, -2, 0, -2, -1, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, -2, -1, -1, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 1, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, 1, 0, 1, 0, -2, 0, 1, -2, -1, 0, -2, 0, 1, 0, 1, -1, 1, 0, 0, -1, 0, 0, 0, 1, 0, 0, 0, 0, -1, 0, -1, -2, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, -2, 0, 0, 0, 0, 0, 0, -2, 0, 0, -1, 0, 0, 0, 1, 0, 0, 0, 2, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, -1, -2, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 4, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -3, 0, -4, -2, 0, -2, -2, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, -3, -2, 0, -2, -1, 0, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 1, 1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, -1, -2, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2, 0, 0, 0, -2, -2, 0, -1, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 1, 0, -1, 0, 1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, -1, -2, 0, -1, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0, -2, 0, -1, -1, -2, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 1, -1, 1, 0, 0, -2, 0, -2, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 1, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, -2, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -2, 0, -1, 0, -2, 0, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -2, 0, -2, -1, 0, -2, -1, 0, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 1, 0, 0, -1, -1, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -2, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 3, 1, 0, 0, 1, -1, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, -1, -1, 0, -1, 0, 0, 0, 0, 1, 0, 0, -1, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, 1, 4, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -4, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -2, 0, -2, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -2, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -3, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, -1, -2, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, -1, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -4, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -3, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -1, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, -2, -1, 0, -2, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+};
+
+static const EpdLigaturePair notosans_14_bolditalicLigatures[] = {
+    { 0x66, 0x66, 0xFB00 },
+    { 0x66, 0x69, 0xFB01 },
+    { 0x66, 0x6C, 0xFB02 },
+    { 0xFB00, 0x69, 0xFB03 },
+    { 0xFB00, 0x6C, 0xFB04 },
+};
+
+static const uint16_t notosans_14_bolditalicGlyphLookup[368] = {
+    0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0001, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, 0x0010, 0x0011,
+    0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, 0x0020, 0x0021,
+    0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, 0x0030, 0x0031,
+    0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, 0x0040, 0x0041,
+    0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051,
+    0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, 0x0060, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070,
+    0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, 0x0080,
+    0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F, 0x0090,
+    0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F, 0x00A0,
+    0x00A1, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF, 0x00B0,
+    0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF, 0x00C0,
+    0x02B1, 0x02B2, 0x02B3, 0x02B4, 0x02B5, 0x02B6, 0x02B7, 0x02B8, 0x02B9, 0x02BA, 0x02BB, 0x02BC, 0x02BD, 0x02BE, 0x02BF, 0x02C0,
+    0x02C1, 0x02C2, 0x02C3, 0x02C4, 0x02C5, 0x02C6, 0x02C7, 0x02C8, 0x02C9, 0x02CA, 0x02CB, 0x02CC, 0x02CD, 0x02CE, 0x02CF, 0x02D0,
+    0x02D1, 0x02D2, 0x02D3, 0x02D4, 0x02D5, 0x02D6, 0x02D7, 0x02D8, 0x02D9, 0x02DA, 0x02DB, 0x02DC, 0x02DD, 0x02DE, 0x02DF, 0x02E0,
+    0x02E1, 0x02E2, 0x02E3, 0x02E4, 0x02E5, 0x02E6, 0x02E7, 0x02E8, 0x02E9, 0x02EA, 0x02EB, 0x02EC, 0x02ED, 0x02EE, 0x02EF, 0x02F0,
+    0x02F1, 0x02F2, 0x02F3, 0x02F4, 0x02F5, 0x02F6, 0x02F7, 0x02F8, 0x02F9, 0x02FA, 0x02FB, 0x02FC, 0x02FD, 0x02FE, 0x02FF, 0x0300,
+    0x0301, 0x0302, 0x0303, 0x0304, 0x0305, 0x0306, 0x0307, 0x0308, 0x0309, 0x030A, 0x030B, 0x030C, 0x030D, 0x030E, 0x030F, 0x0310,
+    0x0311, 0x0312, 0x0313, 0x0314, 0x0315, 0xFFFF, 0x0316, 0x0317, 0x0318, 0x0319, 0x031A, 0x031B, 0x031C, 0x031D, 0x031E, 0x031F,
 };
 
 static const EpdFontData notosans_14_bolditalic = {
     notosans_14_bolditalicBitmaps,
     notosans_14_bolditalicGlyphs,
     notosans_14_bolditalicIntervals,
-    15,
+    16,
     40,
     32,
     -9,
     true,
     notosans_14_bolditalicGroups,
-    10,
+    4,
+    notosans_14_bolditalicKernLeftClasses,
+    notosans_14_bolditalicKernRightClasses,
+    notosans_14_bolditalicKernMatrix,
+    75,
+    notosans_14_bolditalicLigatures,
+    5,
+    0x4000000001ull,
+    notosans_14_bolditalicGlyphLookup,
+    notosans_14_bolditalicGlyphGroups,
+    false,
+    nullptr,
 };
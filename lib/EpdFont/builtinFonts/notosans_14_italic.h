@@ -3,1955 +3,1972 @@
  * name: notosans_14_italic
  * size: 14
  * mode: 2-bit  compressed: true
- * Command used: fontconvert.py notosans_14_italic 14 ../builtinFonts/source/NotoSans/NotoSans-Italic.ttf --2bit --compress
+ * Command used: fontconvert.py notosans_14_italic 14 ../builtinFonts/source/NotoSans/NotoSans-Italic.ttf --2bit --compress --frequency-corpus ../../../test/hyphenation_eval/resources/english_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/french_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/german_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/italian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/russian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/spanish_hyphenation_tests.txt
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t notosans_14_italicBitmaps[31082] = {
-    0xA5, 0x59, 0x3D, 0xAC, 0xDD, 0x66, 0x19, 0x7E, 0x6D, 0xB7, 0x31, 0xAA, 0x45, 0xBE, 0x0C, 0x0D,
-    0x50, 0xAE, 0x88, 0x3B, 0x30, 0x04, 0x54, 0x8E, 0x57, 0x86, 0x7B, 0x8E, 0x9D, 0x56, 0xD0, 0x81,
-    0xA1, 0x19, 0x72, 0xE8, 0x90, 0x21, 0x0C, 0x0C, 0x05, 0x09, 0x65, 0xE9, 0x90, 0x0A, 0x9F, 0x7B,
-    0xDC, 0x66, 0xE8, 0xD0, 0x21, 0x57, 0x88, 0xB2, 0x20, 0x41, 0x90, 0x32, 0x54, 0x17, 0x89, 0x76,
-    0x08, 0xD2, 0xAD, 0x74, 0x72, 0xED, 0x24, 0x12, 0x19, 0x3A, 0xD4, 0x69, 0x14, 0x18, 0x3A, 0xC4,
-    0xA5, 0x01, 0xA4, 0x74, 0xA8, 0xD3, 0x38, 0x8A, 0xDB, 0xF8, 0x1C, 0xF3, 0x3C, 0xAF, 0x7D, 0xEE,
-    0x4F, 0xD3, 0x88, 0x56, 0x1C, 0x5D, 0xFB, 0xDE, 0xE3, 0x9F, 0xF7, 0x7B, 0x7F, 0x9F, 0xF7, 0x79,
-    0xBF, 0x2B, 0xA1, 0xF8, 0x89, 0x97, 0xDB, 0xA5, 0x34, 0x32, 0x12, 0x13, 0xB9, 0x19, 0xFE, 0xAC,
-    0x65, 0x28, 0x46, 0xDC, 0xCC, 0x2A, 0xE4, 0xBC, 0xF0, 0x63, 0x45, 0x4E, 0x69, 0x35, 0x32, 0x95,
-    0x47, 0x45, 0x06, 0xDE, 0xE9, 0xA2, 0x1E, 0x9A, 0x67, 0xB3, 0xF2, 0x94, 0xEF, 0x3D, 0x9D, 0xBF,
-    0xF5, 0xD4, 0x63, 0x76, 0x22, 0x72, 0xCA, 0xC9, 0x44, 0xCE, 0xBB, 0xF8, 0xAB, 0xF4, 0x22, 0x9C,
-    0x0C, 0x5E, 0x2A, 0x70, 0xB2, 0xF3, 0x43, 0x62, 0xFF, 0xF9, 0x56, 0xFA, 0x86, 0xDB, 0xB6, 0x6D,
-    0x63, 0x1D, 0x7F, 0xFD, 0xED, 0xA3, 0x10, 0x0D, 0xA9, 0x46, 0x4A, 0x91, 0x43, 0x3C, 0x0D, 0xED,
-    0x42, 0x42, 0xDC, 0xCD, 0xF5, 0xF4, 0x80, 0x10, 0x5F, 0xC4, 0xC9, 0x07, 0x38, 0x65, 0xAB, 0xD2,
-    0x7F, 0xF6, 0xE3, 0xF8, 0x0E, 0xEE, 0x6D, 0x45, 0xE2, 0xB7, 0x50, 0x6B, 0xAB, 0x91, 0xFA, 0x94,
-    0x58, 0xE5, 0x79, 0xB1, 0xCB, 0xB7, 0xF0, 0x1B, 0x42, 0xE7, 0x38, 0xA6, 0x85, 0x88, 0x3F, 0xC7,
-    0x9B, 0x6D, 0x22, 0xCE, 0x3B, 0xB9, 0x38, 0xA7, 0x73, 0x71, 0x71, 0x78, 0xCF, 0xE4, 0x4F, 0x1A,
-    0x93, 0x85, 0x6F, 0xB6, 0x12, 0xB4, 0xB5, 0x58, 0x6B, 0x58, 0xEB, 0x29, 0x88, 0xA4, 0xFC, 0xC3,
-    0xCB, 0x35, 0xA6, 0x19, 0xB4, 0x4B, 0x1B, 0xE8, 0x39, 0x34, 0xF0, 0xCB, 0xC0, 0xC9, 0xBD, 0xC4,
-    0x48, 0xE5, 0x66, 0x6E, 0xB6, 0xEA, 0xC0, 0x33, 0xC6, 0xC9, 0x65, 0xD3, 0xBD, 0x54, 0xC8, 0x0F,
-    0xEC, 0xAB, 0xB7, 0xDF, 0xF6, 0x92, 0xF2, 0x76, 0x7B, 0xB5, 0xAC, 0xEF, 0x56, 0xB3, 0xB0, 0xD9,
-    0xAC, 0x8C, 0x53, 0xC7, 0x78, 0x4A, 0x56, 0x07, 0x30, 0x70, 0xE8, 0x45, 0xB1, 0x0C, 0x68, 0x83,
-    0x0F, 0x93, 0x22, 0x23, 0xB8, 0x83, 0x5F, 0xCF, 0x40, 0xA0, 0x75, 0xBF, 0x74, 0x33, 0x09, 0x0A,
-    0x2E, 0x18, 0xF5, 0x0B, 0xBB, 0x2D, 0xFE, 0x4A, 0x71, 0x72, 0x8B, 0x50, 0x24, 0x90, 0x58, 0x10,
-    0x8F, 0x52, 0x9C, 0xC2, 0xCB, 0xC4, 0x24, 0x6B, 0x30, 0xC9, 0xC3, 0xF3, 0x21, 0xEC, 0x12, 0xD8,
-    0x25, 0x7E, 0x03, 0x03, 0xEB, 0x5A, 0xEA, 0xF0, 0x48, 0xE5, 0x5E, 0xAC, 0xEC, 0x72, 0x64, 0x12,
-    0xE7, 0x93, 0x72, 0x44, 0x39, 0xB5, 0x78, 0x95, 0x53, 0x4A, 0x90, 0x79, 0x85, 0xDB, 0x66, 0xA6,
-    0x6D, 0x11, 0xEA, 0x36, 0x0F, 0x22, 0x5D, 0x6B, 0x30, 0x1A, 0xC6, 0xA7, 0xCE, 0xBF, 0x75, 0x16,
-    0xDE, 0xC5, 0x02, 0x01, 0xC2, 0x2D, 0x95, 0x84, 0xE2, 0xE6, 0xC8, 0x04, 0x13, 0x21, 0x0B, 0x46,
-    0xBC, 0x13, 0x0B, 0x96, 0x9D, 0x61, 0x61, 0x3C, 0xA3, 0x27, 0x2F, 0xC1, 0x57, 0x3C, 0xBB, 0x8A,
-    0xD0, 0xC2, 0x20, 0x39, 0x2B, 0x82, 0x58, 0xF9, 0xEA, 0xBD, 0x4D, 0xF8, 0x9F, 0xF7, 0xBA, 0x6F,
-    0x15, 0x42, 0xC6, 0x3F, 0x63, 0x44, 0x84, 0x52, 0x46, 0xBC, 0xA4, 0xBF, 0xF1, 0x1D, 0xB2, 0x62,
-    0xCA, 0x1F, 0xF1, 0x95, 0x4E, 0x8C, 0x7E, 0x60, 0xAD, 0xC7, 0x4C, 0x92, 0x17, 0x3D, 0x31, 0x15,
-    0x6E, 0x2D, 0x7E, 0xBA, 0xEE, 0xB6, 0x73, 0x49, 0xBF, 0x91, 0x8C, 0x5E, 0x14, 0x73, 0x39, 0x73,
-    0xCA, 0xA1, 0x7C, 0xDD, 0xD6, 0xDC, 0xD1, 0x0F, 0x32, 0x92, 0x49, 0x64, 0x76, 0xFF, 0x1A, 0x9F,
-    0x18, 0x3F, 0x87, 0x5C, 0x4A, 0xDB, 0xB6, 0x78, 0xE0, 0x9E, 0x26, 0xCF, 0x51, 0x2F, 0x0F, 0xAD,
-    0xD2, 0x24, 0xB1, 0x5D, 0xEC, 0x47, 0xEE, 0x99, 0xF6, 0xE2, 0xF8, 0xE8, 0xA3, 0xE6, 0xCA, 0xED,
-    0xE6, 0x71, 0x8A, 0xAC, 0x3B, 0x1D, 0xA0, 0x2F, 0xD7, 0x31, 0x70, 0xD6, 0x4C, 0xE8, 0x17, 0x78,
-    0x87, 0xAA, 0x53, 0x77, 0x5E, 0x71, 0x0A, 0x86, 0x87, 0x46, 0xE9, 0xE3, 0x13, 0x5C, 0xC1, 0x4D,
-    0x3F, 0xDA, 0x2D, 0xA0, 0xFB, 0x20, 0x46, 0x0E, 0xF2, 0x34, 0x7C, 0xB9, 0xB1, 0x11, 0x20, 0x93,
-    0xB8, 0x39, 0x3C, 0x7A, 0xBA, 0x90, 0x11, 0x1E, 0xAE, 0x67, 0xE2, 0x7C, 0x08, 0x7F, 0x3C, 0x97,
-    0xC8, 0x64, 0x28, 0xF6, 0xED, 0x4A, 0xCC, 0x95, 0x9C, 0x77, 0xAC, 0x6A, 0x22, 0x26, 0xAB, 0x64,
-    0xCD, 0x29, 0x9D, 0xD2, 0x2B, 0xC2, 0xC8, 0xB4, 0xB8, 0xD7, 0xB2, 0x18, 0x21, 0xD2, 0x4B, 0xFC,
-    0x22, 0xAC, 0xD2, 0x59, 0x7A, 0x72, 0xBF, 0xC9, 0xA0, 0x49, 0x05, 0xCF, 0x05, 0xD0, 0xCC, 0x29,
-    0xAC, 0xED, 0x3F, 0x73, 0x28, 0x3B, 0x83, 0xD2, 0xD4, 0xB7, 0xCB, 0xAC, 0x44, 0xA6, 0x10, 0x32,
-    0xB7, 0x1B, 0x79, 0x52, 0x2E, 0x88, 0xEA, 0xAC, 0x07, 0xBC, 0x8E, 0xA8, 0x0B, 0x5E, 0x45, 0xD6,
-    0x41, 0x5F, 0x28, 0x3F, 0xC5, 0x57, 0xDA, 0x41, 0x23, 0xF1, 0x3E, 0x9E, 0x76, 0x70, 0xD7, 0xE0,
-    0x4E, 0x38, 0x1E, 0x47, 0x70, 0x6D, 0x0E, 0x0F, 0x67, 0x2A, 0xD7, 0x83, 0xDC, 0xB4, 0x97, 0x7B,
-    0x80, 0x9E, 0xD9, 0x96, 0x39, 0xEB, 0x64, 0x42, 0x48, 0x80, 0x84, 0x0E, 0x21, 0xEF, 0x60, 0x1A,
-    0x75, 0x52, 0xB8, 0x8E, 0xD3, 0x1F, 0xF4, 0xAD, 0xC9, 0x4E, 0xC9, 0x34, 0x99, 0xB6, 0x0B, 0x94,
-    0x34, 0x5E, 0xD1, 0x40, 0xF0, 0x7D, 0xC8, 0x14, 0x0F, 0x87, 0xBF, 0x09, 0xB1, 0xB8, 0x51, 0xA3,
-    0x14, 0x3E, 0x80, 0xBF, 0x2E, 0x21, 0xAF, 0xF1, 0xEE, 0x0C, 0x56, 0xB2, 0x28, 0x73, 0x2F, 0x33,
-    0x89, 0x49, 0x00, 0x61, 0x90, 0xD1, 0x2E, 0xA0, 0xDF, 0xFC, 0xE0, 0x78, 0x7A, 0xAC, 0x0B, 0xC2,
-    0xB0, 0x57, 0x07, 0x47, 0xD8, 0x56, 0x16, 0x74, 0xF7, 0x6E, 0x6D, 0xE8, 0xD5, 0x72, 0x27, 0x52,
-    0xB4, 0xFD, 0xD6, 0x3A, 0x14, 0xAD, 0xE4, 0x7B, 0xC7, 0xF9, 0xA5, 0xEC, 0x14, 0x0D, 0x7A, 0x3D,
-    0xFA, 0xC0, 0x5F, 0xD8, 0x2F, 0xF0, 0x3C, 0xD4, 0x9C, 0xB6, 0xEB, 0x5D, 0x28, 0x14, 0x20, 0xDB,
-    0x12, 0x17, 0x12, 0x0F, 0x16, 0x6E, 0x75, 0xB6, 0x85, 0x9D, 0xE9, 0x94, 0x30, 0x0C, 0x2A, 0xEB,
-    0x5E, 0x5B, 0x79, 0x73, 0xB7, 0x0C, 0x11, 0xFB, 0xA6, 0x8B, 0x3D, 0xF2, 0xAA, 0x1A, 0xA2, 0x04,
-    0x50, 0x7B, 0xC8, 0x9B, 0xDA, 0x2D, 0x7C, 0x54, 0x68, 0xA3, 0xCE, 0x64, 0x7D, 0xFA, 0x6D, 0x5B,
-    0xC1, 0x8A, 0x8B, 0xE3, 0xF1, 0xB4, 0x97, 0xB4, 0x27, 0xEB, 0x96, 0xB2, 0xE3, 0x3D, 0x79, 0x68,
-    0xFA, 0x3C, 0xEC, 0xAF, 0xD4, 0xDB, 0x57, 0xBA, 0x4F, 0xB0, 0x40, 0x1E, 0xB6, 0x12, 0x46, 0x73,
-    0xBC, 0x5E, 0x7B, 0xA8, 0x25, 0xE6, 0xC9, 0x0C, 0x9E, 0xA8, 0x9D, 0xD2, 0xAE, 0x53, 0xB1, 0x81,
-    0xBF, 0x78, 0xC8, 0xAD, 0xB7, 0x64, 0x4D, 0xB6, 0x20, 0xA6, 0xF1, 0x91, 0xF1, 0xA8, 0xF7, 0xF7,
-    0xE0, 0x6D, 0x0F, 0xC8, 0x60, 0x72, 0x93, 0xFB, 0x1A, 0xA3, 0x7C, 0xC7, 0xF8, 0x29, 0xCA, 0x1A,
-    0x38, 0xBA, 0x65, 0x57, 0x6E, 0xEE, 0x94, 0x80, 0x10, 0x64, 0xAD, 0x0F, 0x18, 0x88, 0xF9, 0x72,
-    0x2C, 0xE6, 0x62, 0x25, 0x53, 0xA7, 0x74, 0x1B, 0xB7, 0xBD, 0x0F, 0x1C, 0x7A, 0x0E, 0xF0, 0xD3,
-    0xDB, 0xE1, 0x77, 0x69, 0x67, 0xB2, 0x03, 0x16, 0x2A, 0xBC, 0xCD, 0x6D, 0x48, 0xE9, 0x23, 0xEF,
-    0xE6, 0x61, 0x32, 0xB7, 0x0B, 0xD9, 0xF3, 0x79, 0xDC, 0x29, 0xFD, 0x6C, 0x2A, 0x47, 0xBB, 0x07,
-    0x9C, 0x5A, 0xE6, 0x32, 0x90, 0x07, 0x3F, 0x8F, 0x8B, 0x36, 0xB5, 0x4C, 0x0B, 0xA0, 0x92, 0x1F,
-    0xEA, 0xC5, 0x03, 0xEA, 0x12, 0x40, 0xED, 0xCE, 0x4F, 0x2E, 0x06, 0x89, 0x97, 0xC2, 0xAF, 0xE9,
-    0x3A, 0x8E, 0xBC, 0xEB, 0x18, 0x27, 0x7B, 0xE7, 0xE1, 0x05, 0x94, 0x9B, 0xA6, 0x52, 0xBE, 0x23,
-    0x7B, 0x3C, 0x26, 0xB4, 0x2C, 0x36, 0x36, 0x36, 0xD6, 0xA3, 0x2E, 0x26, 0xE9, 0x17, 0x1D, 0xBA,
-    0x12, 0xA4, 0xA5, 0xB9, 0x05, 0xB9, 0x08, 0xA9, 0x49, 0xB6, 0x11, 0x7E, 0x5F, 0xBB, 0x8E, 0x2C,
-    0x1C, 0x3C, 0xDD, 0x68, 0x3C, 0x63, 0xFD, 0x69, 0x18, 0x50, 0x96, 0x49, 0x22, 0x0B, 0x16, 0x1A,
-    0xBC, 0x87, 0xFC, 0x30, 0xCB, 0x55, 0xBF, 0xA5, 0xF5, 0x98, 0x6A, 0x19, 0xAA, 0x7F, 0xF6, 0x6D,
-    0x41, 0x63, 0xBB, 0x65, 0xA5, 0xA4, 0xEB, 0xDF, 0xAC, 0x69, 0x08, 0x04, 0xB0, 0x84, 0x4B, 0x00,
-    0x34, 0xB2, 0x2A, 0x96, 0xB4, 0xF6, 0x4E, 0xE7, 0xFE, 0xFD, 0xD2, 0xF7, 0x91, 0x5C, 0xD9, 0x6A,
-    0x65, 0x92, 0x81, 0xDC, 0xC9, 0x62, 0xB4, 0xB0, 0x1B, 0x76, 0xEE, 0x64, 0x87, 0x62, 0x13, 0xF9,
-    0xF2, 0xD7, 0x62, 0x15, 0xB1, 0xBF, 0x92, 0x55, 0x6E, 0x31, 0xF0, 0x9D, 0xE2, 0xD7, 0x97, 0xCA,
-    0x55, 0xB7, 0x3D, 0xD3, 0x46, 0x95, 0x5B, 0x79, 0x05, 0x53, 0xBE, 0x0B, 0x54, 0x57, 0x0D, 0x38,
-    0xCF, 0xC7, 0x5B, 0xCB, 0x75, 0xE5, 0x97, 0xBF, 0xD5, 0xCC, 0xE7, 0x9F, 0x0B, 0xE9, 0xEC, 0x1E,
-    0xE1, 0xA9, 0x00, 0xE6, 0x98, 0x13, 0x42, 0xAC, 0x46, 0x90, 0xD0, 0x04, 0x00, 0xD8, 0x56, 0xC5,
-    0xDE, 0x01, 0x49, 0x31, 0x01, 0xA9, 0x65, 0xDF, 0x45, 0x3F, 0xBA, 0xB5, 0x51, 0xA2, 0xF8, 0x26,
-    0xB8, 0x6C, 0x9E, 0x61, 0x55, 0x23, 0xF8, 0x35, 0x4C, 0x08, 0x27, 0x5A, 0x94, 0xD3, 0x45, 0x82,
-    0xC7, 0x16, 0x62, 0xAE, 0x9F, 0x2C, 0x98, 0x89, 0x58, 0x28, 0xC0, 0xDB, 0x5E, 0x16, 0x08, 0x31,
-    0xD4, 0xAA, 0x9D, 0xDC, 0x6E, 0x2C, 0xAA, 0x42, 0xEC, 0x09, 0xE5, 0x24, 0xCA, 0xDF, 0xAE, 0xD8,
-    0x52, 0xD8, 0x5E, 0x32, 0xC0, 0x2A, 0x9A, 0xA0, 0x55, 0x63, 0xE1, 0xC6, 0xCD, 0xF7, 0xCD, 0xF1,
-    0x24, 0x73, 0xEC, 0xE6, 0x76, 0x7F, 0x5F, 0x44, 0xB8, 0x54, 0xDA, 0x8B, 0x23, 0xA7, 0x08, 0x31,
-    0x60, 0x37, 0x9A, 0x8B, 0xC8, 0x7B, 0xAD, 0x5D, 0x0D, 0x18, 0x71, 0x49, 0x9D, 0xD0, 0x2C, 0x2F,
-    0x66, 0x1D, 0xC8, 0x2B, 0xC8, 0xF9, 0x49, 0x87, 0x89, 0x80, 0xAD, 0x27, 0x50, 0x00, 0x0A, 0xAE,
-    0x79, 0x17, 0x1F, 0x08, 0xEF, 0xAE, 0xCC, 0x8F, 0xC3, 0x80, 0xC4, 0xAD, 0xA0, 0xBC, 0x81, 0xE2,
-    0x32, 0x63, 0x83, 0xCC, 0x01, 0x37, 0x23, 0x28, 0xEA, 0x14, 0x70, 0xD5, 0xC8, 0xA3, 0x9B, 0xB0,
-    0xC0, 0x05, 0xAC, 0x48, 0xBC, 0x97, 0x1A, 0x65, 0x11, 0x3C, 0x8D, 0xE7, 0xA8, 0x7F, 0x03, 0xD3,
-    0xD3, 0x68, 0x6D, 0x9C, 0xE6, 0x2E, 0xBB, 0x59, 0x0A, 0xD0, 0x81, 0x78, 0xE0, 0x44, 0x8A, 0x63,
-    0x3E, 0x3E, 0xC6, 0xAA, 0x67, 0x08, 0xA8, 0x26, 0x0F, 0x85, 0xD4, 0x9C, 0x58, 0x0F, 0x34, 0x6A,
-    0xDB, 0xC8, 0x5C, 0x1F, 0xAB, 0x29, 0xEC, 0x62, 0x2C, 0x37, 0x66, 0xF6, 0xA8, 0x3F, 0xD6, 0xF0,
-    0xFA, 0x52, 0xD4, 0x97, 0x92, 0x99, 0x13, 0xEB, 0x21, 0x93, 0xC7, 0x43, 0x64, 0xEE, 0x42, 0xFE,
-    0xFE, 0xB3, 0x02, 0x9F, 0x03, 0xCC, 0x32, 0x6F, 0xFE, 0xA3, 0x99, 0x4D, 0xD6, 0x32, 0xED, 0x1D,
-    0xC9, 0xF6, 0xA2, 0x5E, 0xD5, 0x0C, 0xE3, 0x8B, 0x5E, 0x06, 0x1C, 0x6D, 0x10, 0x75, 0x93, 0x59,
-    0xCF, 0xE3, 0x0F, 0x80, 0x24, 0x9D, 0xC3, 0x2A, 0x01, 0xA4, 0x7A, 0x59, 0x88, 0x76, 0x69, 0x01,
-    0x7C, 0x22, 0x58, 0x07, 0x4A, 0xD1, 0x7E, 0xDA, 0x37, 0x43, 0x2C, 0xB8, 0x69, 0x93, 0x22, 0xD1,
-    0x85, 0x11, 0xD4, 0x98, 0x40, 0x7D, 0x9B, 0xC9, 0xC5, 0x6C, 0x81, 0x5E, 0x58, 0x89, 0x99, 0xE1,
-    0x66, 0x50, 0xA4, 0x85, 0x99, 0x6D, 0xE3, 0xDC, 0x1D, 0x3F, 0xDF, 0x3D, 0x8E, 0x36, 0x10, 0x23,
-    0x63, 0xF4, 0x71, 0x93, 0x84, 0xDD, 0xE3, 0xE8, 0x29, 0xFA, 0xB8, 0x68, 0xCE, 0xF1, 0xFD, 0xB0,
-    0x85, 0x15, 0x09, 0xD5, 0x0C, 0x34, 0x3D, 0xA9, 0x74, 0xA5, 0x4B, 0x07, 0x6A, 0xCE, 0xDE, 0xEF,
-    0x09, 0x1D, 0x46, 0x1F, 0xCE, 0xF4, 0x7B, 0x5A, 0xC3, 0xBF, 0x5A, 0x40, 0x99, 0x5E, 0xA2, 0xF7,
-    0x6A, 0xE5, 0x0A, 0xF4, 0x6F, 0xD0, 0xB9, 0x60, 0xD8, 0x79, 0x78, 0xD6, 0x79, 0xA7, 0x56, 0xFF,
-    0x5A, 0xFD, 0xED, 0x52, 0xBD, 0xCB, 0xDB, 0x3D, 0x41, 0xEA, 0xDE, 0x46, 0x55, 0x4E, 0xE7, 0x70,
-    0x44, 0x24, 0x4F, 0x74, 0x7E, 0x60, 0x1F, 0x84, 0x5F, 0x6B, 0xA4, 0x31, 0xCA, 0x3B, 0x81, 0x19,
-    0xC0, 0x14, 0x5C, 0xB0, 0x4B, 0xE4, 0xF5, 0x08, 0x19, 0xEB, 0xFC, 0x03, 0x2B, 0x4D, 0xD8, 0x53,
-    0x99, 0xAB, 0x2D, 0x62, 0x41, 0x78, 0x16, 0xD6, 0xA7, 0x8F, 0xA5, 0xED, 0x12, 0x9A, 0x8C, 0x10,
-    0x15, 0xE5, 0x11, 0x24, 0x20, 0x2E, 0xE9, 0xDF, 0x4C, 0x15, 0x8C, 0xA5, 0xF7, 0x45, 0x25, 0xEA,
-    0x5F, 0x51, 0x9F, 0x8B, 0x3A, 0x96, 0x4A, 0x19, 0x3A, 0x90, 0x5A, 0xAB, 0xDB, 0xA8, 0xF0, 0x48,
-    0x93, 0x0C, 0xA9, 0xC5, 0xCC, 0x62, 0x1F, 0x43, 0x09, 0x46, 0xE2, 0xCC, 0x89, 0x88, 0x68, 0xEA,
-    0xF7, 0xF1, 0xF4, 0xCC, 0xBA, 0x97, 0xC9, 0xA0, 0xB6, 0x71, 0x8E, 0x6B, 0xE7, 0xC3, 0x4C, 0xEA,
-    0xCA, 0xB9, 0x96, 0x59, 0xB7, 0x4B, 0x9C, 0x9D, 0xF7, 0x4A, 0xF7, 0x72, 0xEE, 0x5E, 0x2E, 0xBC,
-    0x4B, 0x39, 0xF8, 0xB2, 0x79, 0xA5, 0x08, 0xDC, 0xDC, 0x1C, 0x29, 0x86, 0x68, 0xF6, 0x56, 0xB9,
-    0xE9, 0x21, 0x3E, 0x25, 0xA0, 0x20, 0x90, 0x4F, 0x0A, 0x86, 0xFD, 0x1E, 0xBE, 0x0F, 0x21, 0x9A,
-    0x9C, 0x19, 0x5D, 0x0E, 0xCA, 0x5E, 0x80, 0x06, 0x9B, 0xC2, 0x06, 0xC7, 0xC0, 0x0D, 0x88, 0xA0,
-    0x78, 0x40, 0x4F, 0xE0, 0x9F, 0xD6, 0x7D, 0xD8, 0x66, 0xDF, 0x01, 0xFD, 0x75, 0x3E, 0x04, 0x83,
-    0x72, 0xAE, 0x96, 0x56, 0xE9, 0xE4, 0x95, 0x05, 0x4E, 0x3E, 0x63, 0x3A, 0xC4, 0x4C, 0x28, 0x14,
-    0xAA, 0x89, 0x02, 0x37, 0xC3, 0x10, 0xF0, 0x13, 0xC8, 0x37, 0xAF, 0x41, 0xBC, 0xFB, 0x2E, 0x88,
-    0x86, 0x73, 0x03, 0xA9, 0x63, 0xB7, 0xA4, 0xB7, 0x2D, 0xFD, 0xB2, 0xC0, 0x4A, 0x4A, 0xAA, 0x3A,
-    0x4A, 0xB4, 0x4E, 0x98, 0xC4, 0x60, 0x93, 0x03, 0xBD, 0x6A, 0x16, 0x3F, 0x1C, 0x9C, 0x10, 0xDD,
-    0xD0, 0x46, 0xA5, 0x41, 0x9A, 0xD9, 0xB7, 0x49, 0xAF, 0x30, 0x96, 0x48, 0xC0, 0x02, 0x6A, 0xC8,
-    0xE3, 0xEF, 0x90, 0x40, 0x9E, 0x41, 0x78, 0x2F, 0x84, 0x0C, 0x3A, 0x93, 0xE7, 0x65, 0x3C, 0xD5,
-    0x00, 0x66, 0xFC, 0xDC, 0xAD, 0xED, 0x05, 0xEB, 0x2F, 0x17, 0xED, 0x93, 0x5D, 0x23, 0x20, 0xD2,
-    0xA4, 0x28, 0x86, 0xF9, 0x71, 0x46, 0x9D, 0x20, 0x39, 0x21, 0x75, 0xC7, 0x31, 0x44, 0x68, 0x26,
-    0x88, 0x4D, 0x83, 0x91, 0xAE, 0xF6, 0x00, 0xA2, 0x5A, 0xB6, 0xED, 0xB9, 0x2F, 0x59, 0xB6, 0xFF,
-    0x87, 0x05, 0x66, 0x8F, 0x05, 0xFE, 0xD2, 0x02, 0x43, 0x0B, 0xE6, 0xBB, 0x2D, 0x58, 0xC9, 0x7B,
-    0x28, 0xE8, 0x4E, 0xE4, 0x99, 0x20, 0x27, 0xBB, 0x8D, 0xC2, 0x60, 0x27, 0x17, 0x60, 0xD4, 0xA8,
-    0x37, 0x6A, 0xB4, 0x63, 0x14, 0x3A, 0x14, 0x24, 0x19, 0xA0, 0xBA, 0x79, 0x1D, 0xEA, 0x81, 0x53,
-    0xF8, 0x30, 0x23, 0x40, 0xDC, 0x47, 0x38, 0x93, 0x08, 0x32, 0x7D, 0x31, 0xBF, 0xE4, 0xB3, 0xBE,
-    0x87, 0x01, 0x14, 0x39, 0x69, 0x36, 0xD2, 0x1E, 0xD9, 0x24, 0xF8, 0xB0, 0xAA, 0x96, 0x87, 0x5D,
-    0x69, 0x76, 0xEA, 0xDC, 0x27, 0x3E, 0x6E, 0xDA, 0xEC, 0x69, 0xD3, 0x9E, 0xAC, 0xF2, 0xF0, 0xFA,
-    0xDF, 0x41, 0xF2, 0xA2, 0x95, 0x2A, 0x5C, 0x06, 0x10, 0x47, 0x32, 0x82, 0x86, 0xD6, 0xF0, 0x38,
-    0x78, 0xE2, 0xFA, 0xB1, 0xEE, 0xF1, 0xA4, 0x9B, 0x03, 0x82, 0x2F, 0xF0, 0xF2, 0xAC, 0x6F, 0x27,
-    0x75, 0xC7, 0xD8, 0xAC, 0x25, 0xC6, 0xEE, 0xC6, 0x59, 0x88, 0x00, 0xF5, 0x61, 0x97, 0x83, 0x38,
-    0xE4, 0x2E, 0x3B, 0x9A, 0x54, 0x6C, 0x14, 0x99, 0x8E, 0x84, 0x6C, 0x94, 0xDA, 0x3F, 0x7C, 0xAE,
-    0x03, 0x89, 0x33, 0x67, 0xF9, 0x38, 0x8C, 0x96, 0x21, 0x1E, 0xB7, 0x76, 0xA1, 0xDF, 0x0C, 0xE5,
-    0xAA, 0x0D, 0xC8, 0xA9, 0xD1, 0xEA, 0x5C, 0xFA, 0xDF, 0xDD, 0xCE, 0x20, 0x0C, 0x6A, 0x3E, 0x28,
-    0x99, 0xB9, 0x8C, 0x8B, 0x45, 0xDD, 0x35, 0x4D, 0x2E, 0xD5, 0x40, 0xAB, 0x89, 0x8E, 0x0F, 0x3E,
-    0x01, 0x37, 0x83, 0x5D, 0xC4, 0xC4, 0x21, 0x14, 0x35, 0x47, 0x58, 0xF7, 0x54, 0x22, 0xE6, 0x18,
-    0x09, 0xD7, 0xDC, 0x20, 0x03, 0x4E, 0x3A, 0xE7, 0x99, 0xA2, 0xEF, 0x91, 0x9B, 0x34, 0xC8, 0x5F,
-    0x13, 0x1B, 0xD1, 0x79, 0x37, 0x43, 0x7D, 0x90, 0x45, 0xA6, 0x99, 0x8D, 0xA4, 0x00, 0x4F, 0xA8,
-    0x03, 0x32, 0x85, 0x19, 0x2A, 0xF9, 0x04, 0x23, 0xEB, 0x5E, 0x46, 0x71, 0x81, 0xCC, 0xC3, 0x08,
-    0xDF, 0x02, 0x09, 0xC9, 0xDD, 0xAC, 0x36, 0x36, 0x0A, 0x32, 0x76, 0xD0, 0x13, 0xE3, 0x91, 0xE0,
-    0x2D, 0x1F, 0xB3, 0xF8, 0x50, 0xDC, 0x77, 0x12, 0xD2, 0x8B, 0x3B, 0x99, 0x73, 0x23, 0x91, 0x61,
-    0x89, 0xAA, 0xC7, 0xA0, 0x28, 0x21, 0x70, 0x08, 0xE4, 0x99, 0x93, 0x3F, 0x17, 0x64, 0x5F, 0xD1,
-    0x5A, 0xF4, 0xE9, 0x75, 0x64, 0x3C, 0xA7, 0x57, 0x87, 0xC3, 0x29, 0xA1, 0x3B, 0x57, 0xE0, 0x1D,
-    0xD1, 0xFB, 0x74, 0xC3, 0x7D, 0x6A, 0x9B, 0x66, 0x7D, 0xF2, 0x69, 0x7F, 0x12, 0x0E, 0xE1, 0xCE,
-    0x47, 0x0C, 0xFB, 0x15, 0xC6, 0x9C, 0x61, 0x61, 0x61, 0xA1, 0xFF, 0x94, 0xB4, 0xAE, 0xEE, 0xC6,
-    0x62, 0xC8, 0x99, 0x74, 0x38, 0x87, 0x28, 0xCD, 0x48, 0x37, 0x02, 0xDC, 0xF5, 0x91, 0x73, 0x18,
-    0xF0, 0x13, 0x76, 0x13, 0x2F, 0xE3, 0xB4, 0x0C, 0xBF, 0x5E, 0x2B, 0x55, 0x9E, 0x0D, 0xC1, 0x56,
-    0xFB, 0x90, 0x1C, 0xD8, 0x35, 0x0E, 0x79, 0x5A, 0x10, 0xA8, 0x3F, 0x87, 0xBC, 0xE5, 0xFB, 0x1B,
-    0x6F, 0x66, 0x5D, 0x8E, 0x2A, 0x3F, 0xF1, 0x97, 0x34, 0x84, 0x42, 0x30, 0xCE, 0xEB, 0xC0, 0xB1,
-    0x43, 0x52, 0xF2, 0x5D, 0x8F, 0x6E, 0x33, 0x16, 0x7A, 0x23, 0x78, 0x7D, 0x7C, 0xD4, 0x61, 0x07,
-    0x0C, 0xD9, 0x3F, 0xC5, 0x2C, 0xF8, 0xE3, 0x1F, 0xEB, 0xC1, 0x7A, 0xA8, 0xC9, 0xB0, 0x1B, 0xE4,
-    0x99, 0x46, 0xCC, 0xC4, 0x3D, 0x20, 0xAF, 0x08, 0xBF, 0x0D, 0xF2, 0xE1, 0x31, 0x8E, 0x75, 0xDF,
-    0x3F, 0x27, 0xE7, 0xBD, 0x24, 0xE6, 0xD6, 0x48, 0x0E, 0xDC, 0x19, 0x58, 0xA5, 0x6E, 0x75, 0x54,
-    0x5E, 0x32, 0x73, 0x01, 0xA3, 0x19, 0xB1, 0xC8, 0xD3, 0xD5, 0x1E, 0x9D, 0x7C, 0x95, 0x55, 0x64,
-    0xA7, 0x95, 0xA8, 0x76, 0x07, 0x67, 0xFD, 0x6A, 0x4A, 0x8D, 0x61, 0x1F, 0x62, 0x2E, 0x87, 0x80,
-    0xBB, 0x15, 0x42, 0xCB, 0xBD, 0x18, 0x27, 0x13, 0x10, 0x60, 0x8F, 0x9B, 0x2C, 0x32, 0x80, 0xCC,
-    0x55, 0x3C, 0xB7, 0xB9, 0xA9, 0x73, 0x1E, 0x66, 0xCF, 0xF1, 0x18, 0xFD, 0xFF, 0x6F, 0x1B, 0x1B,
-    0x67, 0x8F, 0x91, 0x83, 0x01, 0xE6, 0x1F, 0x91, 0x95, 0xE2, 0xB0, 0xA4, 0x4D, 0xEC, 0xCC, 0x4F,
-    0xD4, 0x5E, 0xE1, 0x56, 0x46, 0x67, 0x22, 0x0E, 0x31, 0x4E, 0x01, 0x88, 0x2F, 0x26, 0x4A, 0x3F,
-    0x18, 0x44, 0x32, 0xCA, 0x20, 0x89, 0x01, 0x09, 0xA1, 0xFD, 0x71, 0x14, 0xB4, 0x67, 0xC4, 0x9B,
-    0xFB, 0x3B, 0xBB, 0x36, 0x0F, 0x03, 0xD3, 0x1A, 0xA0, 0x76, 0x17, 0x33, 0xE7, 0xBD, 0xBF, 0x37,
-    0x40, 0x94, 0x0B, 0xD0, 0x77, 0xE2, 0x74, 0xD8, 0x3C, 0x44, 0x98, 0x27, 0xCC, 0x22, 0x84, 0xA8,
-    0x21, 0x3D, 0x06, 0x7D, 0xC5, 0x78, 0xE3, 0x16, 0x01, 0x26, 0xC1, 0x61, 0xDA, 0xCA, 0x6A, 0x50,
-    0x77, 0xFC, 0xC6, 0xFB, 0x14, 0x99, 0x90, 0x85, 0xD7, 0xCF, 0x06, 0x3A, 0x47, 0x74, 0xE4, 0xC3,
-    0xDA, 0x26, 0x1B, 0xF8, 0xCE, 0xEC, 0x99, 0x30, 0xF2, 0x5F, 0x03, 0xA7, 0xC5, 0xD4, 0x92, 0xF4,
-    0x53, 0x54, 0x37, 0x28, 0x75, 0x19, 0xA6, 0xEA, 0x50, 0x3D, 0xE2, 0x3F, 0xBC, 0x7C, 0xF2, 0x15,
-    0x54, 0x63, 0x33, 0x93, 0xC5, 0xF3, 0x0B, 0xCC, 0xAC, 0x30, 0x4B, 0x19, 0xAA, 0x53, 0x42, 0x1D,
-    0x32, 0xF5, 0x11, 0x16, 0x20, 0xB6, 0x78, 0x7A, 0xD1, 0x43, 0x0F, 0xB1, 0x4A, 0x00, 0x24, 0x8D,
-    0xF7, 0x5A, 0xB4, 0xE9, 0xF4, 0x2A, 0xE2, 0xA6, 0xFC, 0xAE, 0x56, 0xED, 0x7E, 0x53, 0x07, 0xD1,
-    0x08, 0x39, 0xFF, 0x5A, 0xE6, 0x5E, 0x2B, 0x56, 0x3E, 0x40, 0xE6, 0x62, 0x1E, 0x46, 0x6E, 0xEE,
-    0xD6, 0x6E, 0x1F, 0xB4, 0xCB, 0xFC, 0x6D, 0xED, 0x78, 0x4E, 0x71, 0x8F, 0xD3, 0xC4, 0xA4, 0xF7,
-    0xE1, 0x92, 0x76, 0xBB, 0x9F, 0xA1, 0xDB, 0x20, 0x49, 0xAD, 0xB5, 0x63, 0xDB, 0x1A, 0x77, 0x5C,
-    0xFC, 0x73, 0x66, 0xEC, 0x10, 0xF4, 0x07, 0x2E, 0xD6, 0xFD, 0x45, 0x42, 0x31, 0xEB, 0x89, 0x7B,
-    0x19, 0xD3, 0xB2, 0x43, 0x28, 0x8C, 0x50, 0xF5, 0x63, 0xF0, 0xD4, 0x95, 0xCC, 0xDC, 0x9D, 0x16,
-    0x0C, 0x3D, 0xC2, 0x42, 0xCC, 0x0B, 0xB9, 0xFD, 0x95, 0x31, 0xF6, 0xDC, 0x82, 0x61, 0x7C, 0xF4,
-    0x22, 0x83, 0xEF, 0x63, 0x64, 0x74, 0xCA, 0x01, 0x06, 0x8E, 0x05, 0xDA, 0xCA, 0x1C, 0xEA, 0x1E,
-    0x30, 0x49, 0x07, 0xD9, 0xFD, 0x7A, 0x2F, 0x01, 0x5F, 0xB9, 0x23, 0x69, 0xA5, 0xD5, 0xFF, 0xCC,
-    0x8B, 0x1C, 0x79, 0x51, 0x5B, 0xF7, 0xAE, 0x33, 0x2F, 0x62, 0xE4, 0x45, 0x0C, 0x05, 0x62, 0xEE,
-    0x68, 0xC0, 0x7C, 0xCC, 0xE6, 0xC8, 0x87, 0x8C, 0x63, 0x13, 0x60, 0x3D, 0x42, 0x5E, 0x40, 0x1F,
-    0xC4, 0x01, 0x59, 0xEB, 0xA2, 0x21, 0xE0, 0xEE, 0x23, 0xD0, 0x29, 0xEC, 0x77, 0x2B, 0xCF, 0x09,
-    0xE0, 0xDD, 0x2E, 0xC9, 0xDD, 0x9C, 0x9C, 0x08, 0x67, 0xB8, 0x17, 0x82, 0xE9, 0x2E, 0xE8, 0x80,
-    0x09, 0x0F, 0x8B, 0xF2, 0xDA, 0x9D, 0xDD, 0xCD, 0x73, 0x7D, 0xE5, 0x7D, 0x19, 0x12, 0xD7, 0x91,
-    0xA7, 0x65, 0xC5, 0x42, 0xCB, 0x94, 0x23, 0xC9, 0x17, 0x9B, 0x37, 0x5B, 0x9A, 0x27, 0x6F, 0x80,
-    0x50, 0x01, 0xBE, 0x0D, 0xF0, 0x3E, 0x54, 0x22, 0xE0, 0xFC, 0x13, 0x0B, 0xBD, 0x8F, 0x1E, 0xF6,
-    0x71, 0xA6, 0xE4, 0xD3, 0x80, 0x73, 0x19, 0xE4, 0xA0, 0x1F, 0xD5, 0x4A, 0x3D, 0xA9, 0x2C, 0x3B,
-    0xF7, 0x50, 0x07, 0x2B, 0xA8, 0x02, 0xAD, 0x6A, 0x08, 0xF5, 0xBB, 0x3F, 0xFB, 0x5D, 0xAD, 0x87,
-    0xEE, 0x75, 0x89, 0xA0, 0x3C, 0x10, 0xE1, 0xDB, 0x6D, 0x39, 0x6D, 0x50, 0x6E, 0x77, 0xEF, 0x6E,
-    0xC1, 0xB1, 0x6D, 0x12, 0xA2, 0x1B, 0xB4, 0xBA, 0xC5, 0xD2, 0x48, 0xA8, 0x22, 0x47, 0x6E, 0x8E,
-    0xF7, 0xC0, 0x21, 0x61, 0x79, 0x4C, 0xFD, 0x50, 0x82, 0x09, 0xEF, 0x98, 0x88, 0x5B, 0xA1, 0x3E,
-    0x37, 0xBE, 0xAB, 0x40, 0x78, 0x1F, 0x2C, 0x02, 0xE7, 0xA1, 0xAE, 0xA5, 0xF6, 0x9E, 0x0D, 0xB8,
-    0x02, 0xC2, 0xF6, 0xAF, 0x06, 0xD4, 0x6F, 0x59, 0xCE, 0x33, 0xE0, 0x6F, 0xC3, 0x8D, 0xD3, 0xDD,
-    0x61, 0xF3, 0x23, 0x85, 0x92, 0x22, 0xD4, 0x8D, 0x5C, 0x02, 0x0E, 0xEE, 0xAE, 0xDC, 0x44, 0x07,
-    0x80, 0x22, 0xBF, 0x6B, 0xEC, 0xCA, 0xAA, 0xFD, 0x84, 0x8E, 0xF1, 0x2E, 0x83, 0xA3, 0x23, 0x47,
-    0x67, 0xB1, 0x38, 0x9F, 0xA0, 0xBB, 0xBE, 0x86, 0x99, 0x18, 0xF1, 0x06, 0x63, 0xF7, 0xA3, 0x39,
-    0xB5, 0xE7, 0xF6, 0x5A, 0x9F, 0x4F, 0x87, 0x61, 0xA1, 0xF1, 0xDB, 0xC8, 0xBD, 0x71, 0xBC, 0x24,
-    0x9E, 0x80, 0xD1, 0xFA, 0xA8, 0x5C, 0x70, 0xD4, 0x44, 0xDB, 0x33, 0x7B, 0x54, 0xB0, 0x9D, 0xC1,
-    0x54, 0xC3, 0x2D, 0x2D, 0xF0, 0x46, 0x8C, 0xB7, 0x9F, 0x61, 0xDD, 0x21, 0x20, 0xC5, 0x8F, 0x8E,
-    0xEE, 0x2D, 0x91, 0x61, 0xD7, 0x26, 0xBB, 0x96, 0xF3, 0xD5, 0x01, 0x31, 0xED, 0x01, 0xF1, 0x8F,
-    0x5D, 0x49, 0x44, 0xBB, 0x37, 0xDC, 0x3E, 0x47, 0x76, 0xCE, 0x06, 0xD1, 0xEA, 0x34, 0xF3, 0xD7,
-    0x7E, 0xE6, 0xD5, 0xBA, 0xAF, 0xD7, 0x68, 0xE2, 0xF8, 0x0A, 0x12, 0x6C, 0x52, 0xB5, 0xBE, 0xE9,
-    0x6F, 0xCF, 0x57, 0x7C, 0xED, 0xE4, 0x4D, 0x50, 0xC1, 0x6C, 0xEB, 0xC7, 0x79, 0xD8, 0x8D, 0x55,
-    0xA5, 0xB2, 0x32, 0x6E, 0xB4, 0x81, 0x6C, 0x50, 0x08, 0x5E, 0xD7, 0xD9, 0xEB, 0xBB, 0x40, 0xD1,
-    0x76, 0x61, 0xA1, 0x5B, 0xF6, 0x1B, 0x53, 0x6E, 0x24, 0x74, 0xC6, 0xCA, 0x67, 0xBF, 0x6F, 0xE7,
-    0x2B, 0xD7, 0x23, 0x6A, 0x4C, 0x1A, 0x10, 0x59, 0xBC, 0xEA, 0xF4, 0xFB, 0xDB, 0xB4, 0x47, 0xC2,
-    0xC6, 0x6A, 0x33, 0x40, 0xB9, 0xBD, 0x2E, 0x2F, 0xE0, 0x2B, 0x7A, 0x96, 0x56, 0x20, 0xC2, 0x68,
-    0x75, 0xD5, 0x17, 0x69, 0xF5, 0x6D, 0x87, 0x11, 0x09, 0x91, 0x4D, 0xFA, 0x6E, 0xB0, 0x06, 0xE3,
-    0x43, 0x74, 0x03, 0xD3, 0x77, 0x83, 0x17, 0xC4, 0xFE, 0x13, 0x92, 0xFA, 0x59, 0x82, 0x7A, 0xE4,
-    0xE6, 0x43, 0x54, 0x1E, 0xAA, 0x93, 0xB1, 0xE0, 0x4E, 0x9B, 0x6E, 0x59, 0x06, 0xCA, 0x3B, 0xDC,
-    0x77, 0x50, 0x69, 0xC3, 0x6E, 0xCF, 0x04, 0xA4, 0x80, 0x9D, 0xEC, 0xB0, 0x7C, 0x5B, 0xF6, 0xBD,
-    0x9A, 0x81, 0x2B, 0xD7, 0xF4, 0xAB, 0x8F, 0xB0, 0x9E, 0x77, 0xCA, 0xA1, 0xFD, 0x51, 0x04, 0xCE,
-    0xBB, 0x7A, 0x1E, 0x5C, 0x10, 0xE4, 0x07, 0x83, 0x6C, 0xB5, 0x89, 0x32, 0xF1, 0xBD, 0xD3, 0xB9,
-    0x73, 0x2D, 0x3F, 0x85, 0xE9, 0x26, 0x76, 0xCF, 0x24, 0xCE, 0xFB, 0xD1, 0x4B, 0x68, 0x2C, 0xA5,
-    0xFB, 0x17, 0x71, 0x16, 0xF4, 0x4D, 0x08, 0xBA, 0x47, 0x2A, 0x44, 0x4A, 0xF0, 0x82, 0x3C, 0x16,
-    0x81, 0x91, 0x20, 0x97, 0xE1, 0x83, 0x98, 0x55, 0xFE, 0x2A, 0xC6, 0xD3, 0x7B, 0xDC, 0xA6, 0xC4,
-    0x41, 0xD6, 0xE4, 0x90, 0xF2, 0x72, 0x73, 0xF9, 0x1E, 0xE7, 0x56, 0x56, 0x3A, 0x20, 0xA0, 0xD1,
-    0x7F, 0x0B, 0x4D, 0x90, 0x66, 0xF0, 0x3C, 0x0C, 0x3B, 0x6B, 0xB1, 0x5C, 0xFB, 0xFF, 0x10, 0xB8,
-    0xB9, 0x0E, 0x8A, 0xCA, 0x88, 0x94, 0x7B, 0x32, 0x29, 0xC4, 0x67, 0x2C, 0x56, 0x09, 0x0B, 0xA4,
-    0x56, 0xAC, 0x77, 0x31, 0x8A, 0xED, 0x65, 0x4F, 0xA7, 0x75, 0xA3, 0x85, 0x08, 0xAF, 0x98, 0xA1,
-    0x49, 0xC8, 0x7A, 0xE7, 0x65, 0x9B, 0xFB, 0xC9, 0x8C, 0x2C, 0x37, 0x97, 0x36, 0xD6, 0x11, 0x4D,
-    0x19, 0x9F, 0xC8, 0x75, 0x9F, 0x60, 0xD4, 0xCD, 0xD8, 0xA5, 0xF2, 0x98, 0x3E, 0xE2, 0x8D, 0xA2,
-    0x1A, 0x8C, 0x61, 0x2B, 0x04, 0xAD, 0x77, 0x75, 0x3F, 0xFA, 0x57, 0x1C, 0x2F, 0xBD, 0x9B, 0x0A,
-    0x62, 0x9A, 0x4B, 0x83, 0x25, 0x88, 0xE9, 0x3F, 0x52, 0x56, 0x30, 0x31, 0x27, 0xFC, 0x81, 0x0A,
-    0xDB, 0x9C, 0xC3, 0xC9, 0x76, 0xD1, 0x8E, 0x84, 0x6F, 0xD3, 0x1D, 0x3F, 0x17, 0xEB, 0x3F, 0x7F,
-    0x78, 0xE9, 0xC1, 0x1F, 0x2C, 0xBD, 0x1F, 0xA3, 0x77, 0xAD, 0x4C, 0x91, 0xC0, 0x53, 0xEE, 0x1D,
-    0xFB, 0xF9, 0x7D, 0xB5, 0x63, 0x5E, 0xA9, 0x6E, 0x8B, 0x6D, 0x45, 0xBC, 0x3F, 0xD0, 0xEE, 0x84,
-    0xA5, 0xD8, 0x8C, 0x67, 0xCB, 0xCC, 0x7F, 0x93, 0x81, 0x42, 0x74, 0xD4, 0x68, 0xBB, 0x4D, 0x30,
-    0x72, 0xFD, 0x7B, 0x61, 0xA5, 0x98, 0x44, 0x7E, 0x21, 0xFF, 0x05, 0xBD, 0x59, 0x3F, 0x8C, 0x1C,
-    0xE7, 0x75, 0x7F, 0x33, 0x1F, 0xEF, 0x46, 0xD0, 0x00, 0xFA, 0xAE, 0x38, 0x07, 0x74, 0x14, 0xDD,
-    0xA8, 0x50, 0x61, 0x07, 0x47, 0x4E, 0x7B, 0x01, 0x6E, 0x77, 0x86, 0x56, 0x91, 0x00, 0x2A, 0x74,
-    0x85, 0xCF, 0x2E, 0x52, 0x48, 0x65, 0xBA, 0x4B, 0xA1, 0xE2, 0x1C, 0xEC, 0xDD, 0x0E, 0xA5, 0x82,
-    0x85, 0x03, 0x98, 0x30, 0x60, 0x97, 0x06, 0x0D, 0xB8, 0x70, 0x98, 0x82, 0x2C, 0x58, 0xB0, 0x18,
-    0xDE, 0x8E, 0xA4, 0x42, 0x45, 0x0A, 0x8D, 0xA1, 0x18, 0x2A, 0x82, 0x80, 0xA3, 0x30, 0x42, 0x80,
-    0x10, 0x08, 0x47, 0xD2, 0x58, 0x1C, 0x4A, 0xB3, 0xFB, 0xE5, 0xF7, 0x7B, 0x33, 0xBB, 0x77, 0xB2,
-    0x03, 0x27, 0xB1, 0x4F, 0x5C, 0xDC, 0xEE, 0xDD, 0xED, 0x7C, 0xF3, 0xDE, 0xFB, 0xDE, 0x9F, 0xDF,
-    0xFB, 0xBD, 0x6F, 0xE4, 0xB2, 0x44, 0x45, 0x50, 0x4B, 0x23, 0x7C, 0xAD, 0x8B, 0x5F, 0x48, 0x2D,
-    0xBB, 0xB2, 0x25, 0x61, 0x6A, 0x4A, 0xAF, 0x96, 0x5C, 0x12, 0xB1, 0x59, 0x50, 0xFA, 0x8D, 0x74,
-    0xF8, 0x73, 0x2D, 0xD5, 0x75, 0xF2, 0x86, 0xC8, 0x25, 0x91, 0xF8, 0x17, 0x32, 0x73, 0xE2, 0xBE,
-    0x97, 0xCD, 0x45, 0x8E, 0x05, 0x97, 0x25, 0x4A, 0x25, 0x2C, 0xC4, 0xAF, 0x05, 0xAB, 0xF9, 0xBF,
-    0xED, 0xFF, 0x99, 0xCA, 0x46, 0xB8, 0xE8, 0x64, 0xB6, 0x10, 0xF3, 0xCF, 0x22, 0x95, 0xDE, 0x7F,
-    0x41, 0x96, 0xAF, 0x19, 0x94, 0x4F, 0x5D, 0x25, 0xB6, 0xDC, 0xD6, 0xD5, 0x32, 0xC6, 0x3B, 0x28,
-    0xF1, 0x31, 0xC1, 0x1B, 0xF2, 0x44, 0x5A, 0xBC, 0x6D, 0x06, 0x91, 0x6E, 0x2E, 0x81, 0x73, 0x85,
-    0x98, 0xE5, 0x3A, 0xB3, 0x5C, 0xC7, 0xCB, 0xBC, 0xDB, 0xBB, 0xB7, 0xBF, 0x9F, 0x26, 0xCE, 0xB5,
-    0xC6, 0x39, 0x97, 0x6E, 0x88, 0xB7, 0xF5, 0xEC, 0x8F, 0x3F, 0x70, 0xAE, 0x4E, 0xBE, 0xDF, 0x44,
-    0x72, 0x09, 0xDB, 0x7A, 0x17, 0x5B, 0xBC, 0x23, 0xBB, 0x5B, 0xB2, 0x65, 0xAA, 0xC8, 0x77, 0xEE,
-    0xA3, 0xCF, 0x17, 0xC7, 0x2F, 0x8A, 0x2F, 0x41, 0x21, 0xF6, 0x6A, 0x0D, 0x7D, 0x23, 0x28, 0xB7,
-    0x99, 0xA9, 0xFC, 0x1A, 0xF2, 0x76, 0xBD, 0x46, 0x6C, 0xDA, 0x8A, 0x5F, 0xE5, 0xD0, 0x03, 0x45,
-    0x16, 0x5A, 0x8D, 0xA3, 0x29, 0x0B, 0x89, 0xA0, 0x81, 0xF7, 0xA9, 0xE2, 0x9B, 0x8B, 0x5F, 0xEA,
-    0x97, 0x6B, 0xAF, 0xED, 0xCB, 0xEA, 0x4B, 0xB5, 0xDC, 0xFB, 0x8F, 0x9F, 0xFD, 0x40, 0x7F, 0x74,
-    0xBB, 0x5B, 0xFD, 0xDF, 0x3F, 0x80, 0x1B, 0x64, 0x13, 0x4E, 0x74, 0x99, 0x59, 0xCC, 0x24, 0x86,
-    0x43, 0xB0, 0x96, 0xFB, 0x0A, 0xE0, 0x8F, 0x10, 0x2E, 0x85, 0xBB, 0xC2, 0x62, 0x8E, 0xCD, 0x75,
-    0x7E, 0xED, 0xD5, 0x61, 0x11, 0x66, 0x51, 0x36, 0x92, 0xF8, 0xC3, 0x52, 0x22, 0x5C, 0x0D, 0x9B,
-    0x7E, 0xB5, 0x81, 0xA6, 0x48, 0x5E, 0xF4, 0x3A, 0x81, 0x5F, 0x7C, 0xD7, 0x0E, 0x4E, 0x8D, 0xCC,
-    0xBF, 0xBC, 0xDD, 0x5C, 0x7F, 0x69, 0xF8, 0x0F, 0x4A, 0xF0, 0xF1, 0xF1, 0xAD, 0x8C, 0x6E, 0x8A,
-    0x53, 0x3A, 0x6D, 0x24, 0xB5, 0xBF, 0x48, 0xEB, 0x17, 0x3C, 0xD7, 0x05, 0x6F, 0x15, 0x63, 0x2F,
-    0xDD, 0xDE, 0x81, 0xAB, 0xBD, 0x0F, 0x53, 0xC8, 0x7D, 0xEE, 0xB6, 0xC5, 0x4D, 0x5F, 0x22, 0x15,
-    0xC4, 0xEA, 0x9F, 0x8F, 0xF5, 0xDB, 0x9D, 0x30, 0x13, 0xEF, 0x83, 0xE2, 0x48, 0x64, 0xFB, 0x92,
-    0xEF, 0x3A, 0x53, 0xD4, 0x81, 0x4B, 0x6B, 0x6E, 0x75, 0xC4, 0xC8, 0x47, 0x99, 0x24, 0x3F, 0x39,
-    0x80, 0xE8, 0x03, 0xC7, 0xA0, 0xAC, 0x0D, 0xAA, 0xFF, 0xDE, 0xDE, 0x7A, 0xA7, 0x3C, 0xDC, 0x09,
-    0xAE, 0xA5, 0x6F, 0xDC, 0x0E, 0x43, 0xF8, 0x7E, 0x6C, 0xFE, 0xAB, 0x8C, 0xFE, 0x4A, 0x64, 0xC3,
-    0x93, 0xC8, 0x2F, 0x23, 0xBF, 0x8E, 0xBF, 0x53, 0xC7, 0x57, 0x9A, 0xF8, 0x4A, 0x1B, 0x16, 0x9D,
-    0x34, 0xB1, 0xC4, 0xA6, 0x34, 0x65, 0x2E, 0x13, 0x9B, 0x5A, 0x8F, 0x5E, 0x92, 0xFD, 0xFD, 0xFD,
-    0x57, 0x11, 0xCD, 0x19, 0xC2, 0xC8, 0xCD, 0x8A, 0xF7, 0x95, 0x5F, 0x82, 0x70, 0x5B, 0xF7, 0xF6,
-    0xFE, 0xDE, 0xEF, 0xDD, 0x6C, 0xFC, 0x44, 0xEA, 0x17, 0x8C, 0x6B, 0xB1, 0xD9, 0x51, 0x58, 0x6C,
-    0xEF, 0x98, 0x72, 0x84, 0xCD, 0x8E, 0x4C, 0xF9, 0xDC, 0x6D, 0x53, 0x4E, 0xB0, 0xD9, 0xC4, 0xA5,
-    0xF6, 0xB6, 0x81, 0xE9, 0x8F, 0xD3, 0x51, 0x84, 0xCD, 0x9A, 0xB2, 0xC5, 0x66, 0x47, 0x41, 0xB1,
-    0x7D, 0xC9, 0x94, 0x63, 0x6C, 0x76, 0x24, 0xCD, 0xFF, 0xB6, 0xD9, 0xD0, 0xB9, 0xCF, 0x9C, 0x63,
-    0x31, 0x4D, 0xAB, 0xE8, 0xD6, 0xBB, 0xC5, 0xE5, 0x43, 0x79, 0x9C, 0xD9, 0x43, 0x79, 0x50, 0x8E,
-    0xAC, 0xCB, 0xE2, 0xEB, 0xBA, 0x8E, 0x5E, 0x3D, 0xFB, 0x6B, 0xFF, 0x60, 0xFF, 0x35, 0xEC, 0xEE,
-    0xE6, 0xAD, 0x9B, 0x37, 0x7E, 0xE7, 0x9A, 0x3C, 0xAB, 0x72, 0x5D, 0xFF, 0x92, 0x93, 0x74, 0xDA,
-    0xF9, 0x7E, 0x85, 0xFA, 0xF4, 0x4B, 0x24, 0x86, 0x45, 0xA6, 0x6A, 0x91, 0x5E, 0x86, 0xE6, 0x06,
-    0xB5, 0xE8, 0x9D, 0xC8, 0xAC, 0xF3, 0x70, 0x6D, 0x0B, 0x79, 0xF1, 0x27, 0x8D, 0xE9, 0xE8, 0xA3,
-    0x20, 0x93, 0xC3, 0xD4, 0xBE, 0xF2, 0xB0, 0x3E, 0xD0, 0xE4, 0xD8, 0xB3, 0x45, 0x1E, 0x14, 0x13,
-    0x41, 0x29, 0x7F, 0x5B, 0xFC, 0x0C, 0xEE, 0xC9, 0xE5, 0x08, 0x95, 0x8A, 0xE8, 0xB7, 0xF8, 0x13,
-    0x4E, 0xCF, 0x3C, 0x02, 0x42, 0x0C, 0xDF, 0xB2, 0x08, 0xB0, 0xDF, 0x04, 0x7A, 0x4C, 0x85, 0x9A,
-    0x46, 0xFA, 0x15, 0x41, 0x19, 0xB4, 0x32, 0xF3, 0x1F, 0xA5, 0xD6, 0xB5, 0xB5, 0x3C, 0x5E, 0x58,
-    0x89, 0x2E, 0xF4, 0xB1, 0xC0, 0x2D, 0xC8, 0x47, 0x46, 0x6C, 0x24, 0x7D, 0x09, 0x40, 0xDE, 0xF0,
-    0xF2, 0x9C, 0xEB, 0xE0, 0x9D, 0x2E, 0x72, 0xED, 0x76, 0x8C, 0x77, 0xF2, 0x7B, 0xDE, 0x5C, 0x03,
-    0xE1, 0xDB, 0xC8, 0xE6, 0x6D, 0x59, 0x3B, 0xDC, 0x16, 0xD9, 0xF9, 0x3F, 0xBE, 0x5F, 0xBA, 0x78,
-    0x31, 0xFA, 0xA7, 0x4F, 0xDB, 0x4D, 0xEC, 0xFE, 0x05, 0x39, 0x01, 0x90, 0x7D, 0x72, 0xEB, 0x1A,
-    0xA2, 0x71, 0x23, 0x7A, 0xC7, 0x6D, 0x1D, 0xFA, 0xA5, 0x45, 0x39, 0xD7, 0x61, 0x76, 0x49, 0x6A,
-    0x53, 0x6C, 0x29, 0xF4, 0xA4, 0x5F, 0x34, 0x77, 0x10, 0xEA, 0x7F, 0x45, 0xD0, 0xFF, 0xA2, 0x7C,
-    0xE1, 0xD0, 0xDA, 0x47, 0x40, 0x32, 0x5F, 0xF6, 0xFC, 0x6A, 0x57, 0x26, 0x61, 0x06, 0x40, 0xF0,
-    0xEA, 0xB1, 0x8C, 0x83, 0xC2, 0x16, 0xAD, 0x2D, 0xE6, 0x21, 0x5D, 0x97, 0x23, 0x39, 0xBD, 0x72,
-    0xB7, 0xDF, 0xD7, 0x45, 0xEC, 0x1C, 0xF8, 0x69, 0xD3, 0x19, 0xDC, 0x17, 0xFC, 0x8C, 0x70, 0x75,
-    0x07, 0x91, 0x61, 0x06, 0x23, 0x3C, 0x97, 0x85, 0x1A, 0xC5, 0xAB, 0xAC, 0xDC, 0x08, 0xD3, 0xC6,
-    0x16, 0xBB, 0x61, 0x36, 0x93, 0x7A, 0x12, 0xDC, 0x35, 0x6F, 0x15, 0x7F, 0x57, 0xCA, 0xC8, 0xBC,
-    0x0F, 0x64, 0xD9, 0xDD, 0x45, 0xB9, 0x16, 0x15, 0x72, 0xF4, 0x56, 0x65, 0x53, 0x94, 0xF1, 0x5D,
-    0x84, 0x1E, 0xEE, 0x33, 0x05, 0x94, 0x3C, 0x47, 0x1D, 0xC8, 0x84, 0xA9, 0x20, 0x26, 0x50, 0x72,
-    0x57, 0x80, 0x1C, 0xC0, 0x21, 0x40, 0x18, 0xFD, 0x3C, 0x92, 0x5E, 0x8D, 0x29, 0x58, 0x10, 0x95,
-    0x5D, 0x6F, 0xE5, 0x8E, 0x7D, 0xD5, 0x41, 0xD1, 0xD5, 0xB4, 0xB6, 0x10, 0xB2, 0x0B, 0x4D, 0x58,
-    0x02, 0x73, 0xC2, 0x0C, 0x99, 0x13, 0x16, 0x1E, 0x31, 0x0E, 0x02, 0x51, 0xCC, 0x0D, 0x2B, 0xE4,
-    0x2E, 0x8C, 0x67, 0x2E, 0xB9, 0x7A, 0x17, 0xC0, 0x86, 0x8C, 0x99, 0x01, 0xD3, 0xB2, 0x29, 0x20,
-    0xA6, 0xF6, 0x51, 0x7E, 0x23, 0x9A, 0x80, 0xB5, 0x3E, 0x33, 0xED, 0x1B, 0x2D, 0xB4, 0xFA, 0x73,
-    0xDE, 0xE1, 0x35, 0x90, 0x06, 0xB5, 0x13, 0x3F, 0x93, 0x5D, 0x8B, 0xDC, 0x08, 0xDF, 0x2A, 0x93,
-    0x6B, 0x0F, 0xEB, 0xBB, 0xE1, 0x9D, 0xB8, 0x8D, 0xFC, 0xFB, 0x84, 0xE6, 0x43, 0x24, 0x45, 0xFB,
-    0x1C, 0x76, 0x70, 0xD9, 0xBC, 0x5D, 0x21, 0x21, 0x16, 0x33, 0xE8, 0xB4, 0xD0, 0x01, 0x0C, 0xDD,
-    0xA5, 0x15, 0x01, 0x53, 0x8D, 0xDD, 0x80, 0x3B, 0x9A, 0x0B, 0x40, 0x4C, 0x96, 0x00, 0x26, 0x37,
-    0xB0, 0x1D, 0x9A, 0x8D, 0x1E, 0x32, 0xE5, 0x95, 0xB0, 0x62, 0xD1, 0x8D, 0x75, 0x69, 0xAE, 0x3F,
-    0xC7, 0xF2, 0x62, 0xF2, 0xB0, 0x8D, 0x5C, 0xE3, 0xFD, 0x03, 0x33, 0x0C, 0x09, 0xED, 0xB1, 0xF4,
-    0x92, 0xB3, 0x6D, 0xC1, 0x1B, 0xA4, 0xB1, 0x9F, 0x18, 0xC8, 0xF6, 0x17, 0x44, 0x36, 0xA4, 0xE6,
-    0x3D, 0x28, 0x1E, 0x61, 0x45, 0x82, 0x42, 0x8B, 0x5E, 0xA6, 0x9A, 0x06, 0x8B, 0xC6, 0xC8, 0x5F,
-    0xE6, 0x3F, 0xD2, 0x1E, 0xC9, 0x8A, 0xF6, 0xE6, 0x24, 0xB9, 0xF9, 0x8F, 0x45, 0x0C, 0xC9, 0x70,
-    0xD5, 0x08, 0xB6, 0xD8, 0x6B, 0xB0, 0xEA, 0x01, 0x6E, 0x9E, 0x37, 0x7D, 0xC2, 0x7B, 0xC4, 0x1D,
-    0x58, 0x76, 0xDA, 0xA5, 0x10, 0x9B, 0x53, 0xC5, 0x82, 0xE2, 0xEA, 0x55, 0x4B, 0x5C, 0x0D, 0xBA,
-    0xC3, 0xFB, 0xD2, 0x2B, 0x37, 0x75, 0xDD, 0x6B, 0x97, 0x0E, 0x2E, 0xA5, 0x7A, 0x6C, 0xB0, 0x15,
-    0xD5, 0x6F, 0xD9, 0xE7, 0x68, 0x80, 0xF9, 0xE2, 0x66, 0x2E, 0xB4, 0x00, 0x57, 0x4C, 0x49, 0x13,
-    0x32, 0x74, 0xDB, 0x31, 0xC1, 0xBF, 0x03, 0x12, 0x69, 0x9B, 0xD9, 0xA4, 0xEA, 0xAA, 0xEF, 0x4C,
-    0xD2, 0x22, 0x7F, 0x46, 0x00, 0x01, 0x6F, 0xD5, 0x64, 0xB1, 0xAC, 0x37, 0x01, 0x01, 0x10, 0x0B,
-    0xD7, 0xF9, 0x8F, 0x8B, 0xDE, 0x02, 0x8B, 0x76, 0xE8, 0x35, 0x08, 0x72, 0x02, 0x97, 0xA9, 0x01,
-    0x2D, 0x2A, 0x38, 0x82, 0x3E, 0x43, 0xB4, 0xA5, 0x7E, 0xFB, 0x9F, 0x37, 0x69, 0x4F, 0x94, 0xE2,
-    0x62, 0x43, 0xF5, 0x57, 0x21, 0xA9, 0x65, 0x77, 0x7F, 0xAF, 0xD4, 0x38, 0x78, 0x29, 0xD4, 0x47,
-    0x0D, 0xF2, 0x71, 0x4C, 0xEC, 0x7B, 0x23, 0xAA, 0x14, 0xDC, 0x97, 0x95, 0xDF, 0x2C, 0xF7, 0x1F,
-    0xAA, 0x83, 0x08, 0x09, 0xF1, 0x64, 0x70, 0x80, 0x74, 0xBB, 0xD2, 0xEB, 0x37, 0xC0, 0xD7, 0xDE,
-    0x00, 0x9B, 0x8D, 0x45, 0x2D, 0x00, 0x24, 0x63, 0x3B, 0x34, 0x41, 0x16, 0x37, 0x6F, 0x89, 0xDA,
-    0x00, 0xE3, 0x80, 0x50, 0xF4, 0x41, 0x44, 0x7C, 0x57, 0x8E, 0x71, 0xD4, 0xB3, 0x04, 0x8F, 0x90,
-    0xD6, 0x50, 0xC0, 0xCB, 0x30, 0x60, 0xEF, 0xA2, 0x9C, 0xBE, 0xFA, 0xBC, 0xC8, 0x06, 0x13, 0x18,
-    0x02, 0x5A, 0x60, 0x3E, 0x2C, 0x7A, 0x03, 0x18, 0x01, 0xD5, 0x7F, 0x44, 0xF1, 0x50, 0xAF, 0x01,
-    0xA0, 0xF6, 0x90, 0x4E, 0xA0, 0x72, 0xFA, 0x5F, 0x75, 0x33, 0x45, 0xA9, 0xFA, 0x2D, 0xBA, 0x7F,
-    0xD0, 0x8C, 0x1A, 0xEA, 0xA5, 0xFE, 0xED, 0x0E, 0x7A, 0x23, 0xF2, 0x1D, 0xCD, 0xAE, 0xF7, 0xB5,
-    0x77, 0xD6, 0x80, 0xC5, 0x10, 0x80, 0x71, 0xDD, 0xEB, 0xB7, 0xAF, 0xF5, 0xFE, 0x0F, 0xCA, 0x46,
-    0xD5, 0x6B, 0x8E, 0xD1, 0xFD, 0x13, 0xF2, 0x2E, 0x68, 0x8F, 0x91, 0x02, 0xF4, 0x3E, 0x74, 0xA8,
-    0x65, 0x2F, 0xD7, 0x62, 0x3E, 0xA2, 0xF3, 0xC9, 0xAE, 0x96, 0xBA, 0x63, 0x26, 0xAA, 0xFA, 0x8A,
-    0xBF, 0xE6, 0xF3, 0xFD, 0xEF, 0x52, 0x9D, 0x96, 0x91, 0xF9, 0x48, 0x79, 0x9D, 0x7D, 0xA7, 0xD6,
-    0x24, 0xF8, 0x8E, 0xFE, 0x4A, 0x14, 0xA1, 0x25, 0xD7, 0x12, 0xF1, 0x5A, 0xD0, 0xA9, 0x0C, 0xDA,
-    0x43, 0xFE, 0x0A, 0x4B, 0xFB, 0x6B, 0x90, 0x97, 0x88, 0x7F, 0xAB, 0x44, 0xD2, 0xBD, 0x93, 0x9B,
-    0x33, 0xD1, 0xE4, 0x56, 0x74, 0xAF, 0xB5, 0xBC, 0x50, 0x4D, 0x24, 0x5F, 0x88, 0xC3, 0x31, 0xD4,
-    0xC5, 0xE4, 0x6F, 0x1D, 0x29, 0xE0, 0x4C, 0x6D, 0xE0, 0x6B, 0xBA, 0x48, 0x01, 0xF9, 0xA0, 0x18,
-    0x57, 0x0E, 0x7D, 0x7C, 0xC7, 0xCA, 0x26, 0x27, 0xE4, 0x22, 0x95, 0xC0, 0x3A, 0x61, 0x4D, 0x6A,
-    0xF6, 0x76, 0xCB, 0x2F, 0x8B, 0x9E, 0xD3, 0x68, 0xDB, 0x60, 0x49, 0x19, 0x6D, 0xA5, 0xD9, 0x37,
-    0x45, 0xCD, 0x9B, 0xB2, 0xD5, 0x36, 0x3D, 0xFD, 0x94, 0x38, 0xEB, 0x1B, 0x24, 0x61, 0x70, 0xFD,
-    0x04, 0x1A, 0xE6, 0x32, 0x14, 0xE3, 0x8A, 0x77, 0x11, 0xA2, 0xB7, 0x4E, 0x9B, 0xF3, 0x54, 0x0B,
-    0xBA, 0x13, 0x7A, 0xA8, 0xE9, 0x43, 0xC2, 0xA5, 0x7C, 0xD3, 0x25, 0xF4, 0x07, 0x9D, 0x01, 0x55,
-    0x29, 0xDD, 0x40, 0x0B, 0x51, 0x94, 0xCA, 0x30, 0xE2, 0x81, 0x6D, 0xF2, 0xCD, 0x1D, 0x2F, 0x45,
-    0xE1, 0x05, 0x6F, 0x83, 0x1C, 0xEB, 0x5E, 0xB8, 0x9A, 0x9D, 0x6F, 0xE3, 0x6B, 0xD4, 0xC7, 0xBD,
-    0x24, 0x58, 0x45, 0x0E, 0xFC, 0x80, 0xF9, 0x58, 0xA3, 0xC8, 0x37, 0xBE, 0xC6, 0xFD, 0x6D, 0x00,
-    0xE3, 0x81, 0x8C, 0x78, 0xFB, 0xE9, 0xDE, 0xAA, 0xA0, 0xBE, 0x0E, 0x5D, 0x6B, 0x7D, 0xF0, 0x87,
-    0xBC, 0xBE, 0xB3, 0x1C, 0x11, 0x70, 0x69, 0xBA, 0x50, 0x0D, 0xB9, 0xDE, 0x0C, 0x59, 0x10, 0xCF,
-    0xBE, 0x91, 0xF7, 0x33, 0xC6, 0xD9, 0xFF, 0xC7, 0xAA, 0x07, 0xC1, 0xF0, 0xF5, 0x7F, 0xDF, 0x55,
-    0x9E, 0x6E, 0x83, 0xCD, 0xA1, 0xD3, 0xDB, 0x49, 0x4B, 0xEA, 0xA5, 0x6C, 0x83, 0xEA, 0x86, 0xF0,
-    0xA5, 0xCE, 0xBC, 0xCF, 0xCB, 0x46, 0x0D, 0xA5, 0x84, 0xA4, 0xDF, 0xCE, 0xA8, 0xBF, 0xED, 0xCC,
-    0xE5, 0x1E, 0x76, 0x21, 0x2E, 0x5E, 0x60, 0xA3, 0x75, 0x9F, 0x07, 0x11, 0x4A, 0x99, 0x96, 0xD6,
-    0x32, 0x09, 0x8A, 0xB5, 0x5E, 0xC5, 0x39, 0x6A, 0x20, 0xC9, 0xDA, 0x95, 0x18, 0xEB, 0xB2, 0x25,
-    0xAF, 0x47, 0x8D, 0xE2, 0x62, 0xA5, 0xD9, 0x97, 0xF7, 0x1A, 0x5A, 0xF5, 0x80, 0xD7, 0xDF, 0x4B,
-    0x7F, 0x8E, 0xFB, 0x70, 0x4C, 0xBE, 0x72, 0xB9, 0xEF, 0x5D, 0xD0, 0x00, 0x0F, 0x21, 0x02, 0x2C,
-    0x37, 0x77, 0x9D, 0xF5, 0x8B, 0x16, 0xF3, 0x1B, 0xF0, 0x44, 0xCC, 0x7C, 0x0D, 0x6C, 0x36, 0xC4,
-    0xC1, 0x90, 0xD4, 0x50, 0xD1, 0x7F, 0x4C, 0xCB, 0xDA, 0xBF, 0xFE, 0x78, 0xCF, 0x3C, 0x40, 0x70,
-    0xA3, 0x57, 0x31, 0x8D, 0xDD, 0x83, 0xF5, 0xA6, 0x86, 0x48, 0x9B, 0x41, 0xC3, 0x3D, 0x2C, 0x0F,
-    0x6A, 0x6C, 0x61, 0x8A, 0xB5, 0x61, 0xE3, 0x3D, 0xF9, 0x9E, 0x4B, 0x91, 0x07, 0x15, 0x40, 0xEA,
-    0xDF, 0x45, 0xB3, 0x17, 0xA9, 0x9A, 0x54, 0xB7, 0xA9, 0x09, 0xBB, 0xAE, 0xA6, 0xB0, 0x28, 0x3D,
-    0xD3, 0x27, 0x2F, 0xCB, 0x8C, 0xBE, 0x70, 0xFA, 0x91, 0xC9, 0xC4, 0x03, 0xA8, 0xE6, 0xFE, 0x67,
-    0x25, 0x50, 0x11, 0xC9, 0xDE, 0x98, 0x5F, 0x81, 0x8E, 0x99, 0xB2, 0x01, 0xE5, 0x2A, 0x72, 0x1F,
-    0xB0, 0x38, 0x61, 0xB7, 0x1E, 0xA3, 0x29, 0xA6, 0x70, 0x8B, 0x15, 0xFB, 0x0A, 0x58, 0x90, 0xFD,
-    0x61, 0x16, 0x4B, 0xF0, 0x3E, 0x50, 0xDC, 0xDC, 0x4F, 0x47, 0xD8, 0x20, 0xB6, 0xEE, 0x39, 0xBA,
-    0x67, 0x41, 0x9C, 0xBE, 0x37, 0x74, 0xCB, 0x7E, 0x32, 0xA3, 0x5F, 0xC9, 0x63, 0x74, 0x8C, 0x3A,
-    0xED, 0xD9, 0xB3, 0x27, 0xC4, 0x55, 0x8C, 0xAB, 0xF3, 0xF5, 0x05, 0xFB, 0x46, 0xE7, 0xA3, 0x29,
-    0x83, 0x00, 0x62, 0xAB, 0xF7, 0x88, 0xD9, 0xF4, 0x2E, 0xF1, 0x29, 0xC7, 0x7F, 0xFE, 0xA7, 0x64,
-    0xEB, 0xEF, 0xE3, 0xFE, 0x24, 0x21, 0xA0, 0x22, 0xCD, 0xC2, 0x0F, 0x18, 0x59, 0x4E, 0xC2, 0xDA,
-    0x2A, 0x8A, 0x24, 0x05, 0x3A, 0x4D, 0x33, 0xF4, 0xFF, 0x19, 0x5C, 0xD6, 0x0F, 0x28, 0x5E, 0xBF,
-    0x6F, 0xC5, 0xA6, 0x6E, 0xC0, 0x3E, 0xC5, 0x3D, 0xE5, 0xCD, 0x9B, 0x4F, 0xDD, 0x12, 0xFD, 0x8C,
-    0x39, 0xB6, 0x12, 0xF5, 0x63, 0xA6, 0x67, 0xB5, 0x45, 0xFB, 0x36, 0x9F, 0xB6, 0x25, 0x9B, 0x48,
-    0x09, 0xB3, 0x08, 0xF9, 0x5D, 0xDB, 0xE7, 0xC8, 0x29, 0x97, 0x8A, 0x17, 0x69, 0xDF, 0x0B, 0xDC,
-    0x95, 0x59, 0x06, 0xC2, 0x93, 0x80, 0xE5, 0xCB, 0xB1, 0x52, 0xA1, 0x18, 0x77, 0xD5, 0x54, 0xF4,
-    0x1E, 0xE2, 0x19, 0xE3, 0x3F, 0xC9, 0xE1, 0x4E, 0xF3, 0xD9, 0xD2, 0x92, 0xE3, 0x84, 0x48, 0xDD,
-    0x0D, 0xED, 0xF0, 0x24, 0xD0, 0xBC, 0x2D, 0x65, 0x9A, 0x46, 0x15, 0x58, 0x41, 0xCC, 0x66, 0x17,
-    0x32, 0x29, 0x65, 0x85, 0x72, 0x7E, 0x3D, 0x19, 0x56, 0x3F, 0xE3, 0xA7, 0x67, 0xD8, 0xC4, 0x53,
-    0x32, 0x62, 0x53, 0x3C, 0xE4, 0xC2, 0x24, 0x41, 0x27, 0xEC, 0x82, 0xCA, 0x7C, 0x82, 0xAA, 0x5C,
-    0x28, 0x8B, 0x09, 0x40, 0xD2, 0xBF, 0xAC, 0xE5, 0xD8, 0x16, 0x51, 0x96, 0x40, 0x44, 0xF7, 0x2D,
-    0x31, 0x4B, 0xFB, 0x9E, 0x41, 0xA0, 0xDA, 0x31, 0xCD, 0xEB, 0x24, 0x29, 0x63, 0x90, 0x17, 0x09,
-    0x6B, 0x44, 0x2A, 0x6A, 0x61, 0xDF, 0xB8, 0x0B, 0x4B, 0xE9, 0x72, 0x5B, 0xF8, 0x75, 0x1E, 0xA5,
-    0x41, 0x99, 0x63, 0xC6, 0xCB, 0xF0, 0x31, 0x96, 0x2E, 0x41, 0x12, 0x76, 0x09, 0xCA, 0xB7, 0x4D,
-    0x78, 0xDA, 0x93, 0x44, 0x99, 0xA9, 0xE3, 0x63, 0x09, 0xAA, 0xA8, 0x43, 0xB0, 0x2C, 0xDA, 0x7E,
-    0x1A, 0xB6, 0xBE, 0x1E, 0x79, 0x34, 0x32, 0x66, 0xB4, 0xB6, 0x4F, 0x1D, 0x45, 0xF0, 0xEB, 0xDB,
-    0xAE, 0x92, 0x0A, 0xCD, 0xE0, 0x30, 0x3B, 0xED, 0xBC, 0xAC, 0xBB, 0xFC, 0x2B, 0x40, 0x31, 0xC2,
-    0x6A, 0xAF, 0x46, 0xF2, 0x84, 0xC5, 0x0A, 0x57, 0x02, 0x32, 0x21, 0x02, 0x1E, 0x4B, 0x53, 0x97,
-    0x57, 0x40, 0x41, 0x9B, 0x62, 0xF9, 0x84, 0x48, 0x45, 0x1A, 0x64, 0x51, 0xDB, 0x00, 0x0A, 0x22,
-    0x13, 0x76, 0x36, 0xE3, 0x58, 0xD9, 0xE0, 0x63, 0x71, 0xAA, 0xEB, 0x1B, 0xD2, 0x37, 0x64, 0xE5,
-    0xBC, 0xCA, 0x16, 0xD8, 0x78, 0x96, 0x3D, 0xF9, 0x29, 0x5A, 0xA2, 0x67, 0x65, 0xD3, 0x74, 0xE0,
-    0xE4, 0x23, 0x65, 0xB7, 0xBB, 0xB2, 0xEA, 0xD6, 0x4F, 0xD3, 0x27, 0x17, 0x44, 0x9B, 0x38, 0xA6,
-    0x4C, 0x84, 0xE7, 0xA5, 0xB5, 0x33, 0xA9, 0x7C, 0x79, 0x10, 0xDD, 0xE1, 0x0A, 0x44, 0xD3, 0x59,
-    0x3C, 0xE7, 0x32, 0x14, 0x6D, 0x49, 0xB0, 0x61, 0xF6, 0x98, 0x13, 0x6C, 0x13, 0x0E, 0x76, 0xE9,
-    0xF2, 0x16, 0x0D, 0xC7, 0x94, 0x11, 0xBB, 0x18, 0x47, 0x31, 0x58, 0x62, 0x2A, 0x6D, 0x12, 0x30,
-    0x0E, 0x79, 0x97, 0x01, 0x47, 0xA6, 0xAC, 0xEA, 0xE9, 0x69, 0x55, 0xD3, 0x1D, 0xC4, 0xB8, 0xA4,
-    0x87, 0x39, 0x82, 0xEE, 0x00, 0x81, 0x50, 0x91, 0x83, 0x72, 0xB7, 0x18, 0x39, 0xEA, 0x88, 0x1C,
-    0x34, 0xB5, 0x19, 0x99, 0x3D, 0x86, 0x6D, 0xA4, 0x12, 0x1A, 0x12, 0x90, 0xC3, 0x3C, 0x2C, 0x14,
-    0x98, 0x3C, 0x37, 0xC0, 0x65, 0xDB, 0x07, 0xD7, 0x3B, 0x4B, 0x3A, 0xAA, 0x9E, 0x86, 0x29, 0x2B,
-    0x9E, 0xF4, 0xDF, 0xB3, 0x9B, 0x8E, 0xF5, 0xF4, 0x21, 0x65, 0xC5, 0xC6, 0x68, 0x4C, 0x2D, 0x4A,
-    0x15, 0x55, 0x10, 0x41, 0x5B, 0xAE, 0x34, 0xFE, 0xC8, 0x66, 0x64, 0xDF, 0xD3, 0x2B, 0x0B, 0xD7,
-    0x86, 0x70, 0x5B, 0xB2, 0xAF, 0xE2, 0x29, 0x2A, 0x3A, 0x3D, 0xC2, 0x50, 0xAF, 0xCD, 0xE6, 0x7A,
-    0x18, 0x53, 0xB2, 0x8D, 0x74, 0x94, 0xAC, 0x2E, 0x50, 0xD7, 0xB0, 0x94, 0xAB, 0x00, 0x2A, 0x1B,
-    0x0C, 0xAA, 0x32, 0xE1, 0x30, 0x16, 0x2B, 0x29, 0x7C, 0x47, 0xCD, 0xA3, 0x94, 0xC6, 0xB2, 0x0F,
-    0x93, 0xA8, 0xC6, 0x62, 0x75, 0xB0, 0xED, 0x68, 0x74, 0xCC, 0x9D, 0x40, 0xC6, 0x84, 0x01, 0x8C,
-    0x37, 0x51, 0xAC, 0xF6, 0x87, 0xA8, 0x5E, 0x53, 0x02, 0xFE, 0xBC, 0x86, 0x4E, 0x52, 0x13, 0x12,
-    0x59, 0x8E, 0x97, 0x11, 0x37, 0x38, 0x63, 0xA5, 0xC5, 0xE5, 0x2A, 0xD5, 0x74, 0xC0, 0xAD, 0x06,
-    0x4E, 0x3C, 0x91, 0xD5, 0x01, 0xEB, 0xF3, 0xD5, 0xB7, 0x64, 0xD6, 0x4D, 0xCC, 0xFC, 0xB5, 0x36,
-    0xAC, 0x02, 0xCC, 0x6F, 0xA8, 0x6B, 0x28, 0x4A, 0xB0, 0x98, 0xC3, 0xEE, 0x11, 0x6E, 0xCC, 0xD5,
-    0xD5, 0x16, 0xEF, 0x18, 0x79, 0x38, 0x4D, 0x13, 0xFF, 0x51, 0x1A, 0xBB, 0x1F, 0x49, 0x38, 0x8F,
-    0x86, 0xF6, 0x4C, 0x5A, 0x8D, 0x0D, 0x2E, 0xDD, 0xA9, 0x03, 0x6E, 0x7A, 0x8E, 0xF2, 0x37, 0xFB,
-    0xE9, 0x88, 0x95, 0x82, 0xF6, 0x2D, 0x23, 0x04, 0x68, 0x63, 0x50, 0x70, 0x1E, 0xF2, 0x39, 0xA0,
-    0x46, 0xCD, 0x8E, 0x8E, 0xA7, 0x9C, 0x4E, 0x97, 0xC3, 0xE9, 0xB9, 0xC8, 0xC6, 0x27, 0x07, 0xCE,
-    0x08, 0xEF, 0x35, 0x2F, 0x5B, 0x55, 0xD6, 0xB9, 0xF8, 0x05, 0x18, 0x61, 0x1E, 0x21, 0xA3, 0x4D,
-    0xA6, 0x6F, 0x8E, 0x95, 0x7A, 0x80, 0xB1, 0x71, 0x7E, 0x3A, 0x9E, 0x2F, 0x5F, 0x9F, 0xA5, 0xC6,
-    0x3D, 0xB8, 0xEF, 0xB2, 0xE4, 0xA7, 0x8F, 0xDA, 0xA9, 0xDF, 0x22, 0x0A, 0x47, 0xB6, 0x08, 0x41,
-    0xB5, 0x72, 0xB4, 0x07, 0x36, 0xF6, 0xDC, 0x9B, 0xDB, 0xD4, 0x47, 0xDE, 0x1F, 0x89, 0x75, 0x0D,
-    0xEA, 0xEA, 0x98, 0x55, 0x86, 0x44, 0xE5, 0x21, 0x21, 0xB3, 0x9D, 0xE3, 0x88, 0xD7, 0x46, 0xB3,
-    0xE2, 0x9B, 0xC6, 0x7D, 0xFA, 0xC8, 0x35, 0x66, 0x61, 0x23, 0x94, 0x7E, 0xAA, 0x25, 0x1E, 0x3E,
-    0x41, 0x63, 0x2B, 0x92, 0x5F, 0xDF, 0x88, 0xF5, 0x44, 0x16, 0x99, 0x8E, 0x3C, 0x25, 0x03, 0x9D,
-    0x28, 0x09, 0x1D, 0x1E, 0x18, 0x80, 0xFD, 0xD9, 0xF2, 0x19, 0x8F, 0xE7, 0x0D, 0xB8, 0x13, 0x09,
-    0xB6, 0xD3, 0x8F, 0x80, 0x35, 0xE7, 0x38, 0xFF, 0x44, 0xBC, 0x01, 0xCF, 0x98, 0xE3, 0x79, 0x0F,
-    0xEA, 0x2B, 0x1A, 0x7F, 0x40, 0x12, 0x21, 0x8B, 0x57, 0xAA, 0x7B, 0x82, 0xDE, 0x37, 0x86, 0x51,
-    0xAF, 0x66, 0x07, 0xD7, 0x9C, 0xBB, 0x8A, 0x6A, 0xBE, 0xB7, 0x54, 0x42, 0x8D, 0x49, 0x7A, 0x11,
-    0x74, 0x54, 0x09, 0xF9, 0x5E, 0x5F, 0x37, 0x5E, 0xFF, 0xA0, 0x82, 0x46, 0x54, 0x4B, 0xDA, 0xE5,
-    0x61, 0x48, 0x87, 0xBC, 0xE4, 0xC7, 0x2D, 0xC0, 0x28, 0x6B, 0x05, 0xC8, 0x84, 0xE8, 0x3E, 0x5F,
-    0x4D, 0x1D, 0xA6, 0xE5, 0x96, 0x12, 0x07, 0x2A, 0xCF, 0x9A, 0x83, 0x48, 0x18, 0x5D, 0x90, 0x85,
-    0x2B, 0x9E, 0x41, 0xEE, 0x4C, 0xAB, 0x33, 0x9F, 0xC8, 0xDD, 0x30, 0xDB, 0xE8, 0xBB, 0xE4, 0x1F,
-    0x68, 0xE1, 0x05, 0x4F, 0xEC, 0x9B, 0xB5, 0xA9, 0x3A, 0x79, 0xFD, 0x99, 0xE5, 0x49, 0xC2, 0x2C,
-    0xE3, 0xD9, 0xFB, 0x93, 0xF8, 0xCD, 0xC6, 0x54, 0xB0, 0x2D, 0x97, 0xA3, 0xB1, 0x77, 0x12, 0xB9,
-    0x05, 0x4C, 0xF3, 0x57, 0x43, 0x12, 0x2D, 0x9B, 0xCB, 0xEB, 0x91, 0xEB, 0x3C, 0xA2, 0x08, 0x03,
-    0x61, 0x10, 0x50, 0x24, 0xD4, 0x48, 0x7D, 0xF6, 0x0B, 0x69, 0xBC, 0x86, 0x0F, 0x38, 0x4C, 0x65,
-    0xCA, 0x00, 0x04, 0x1F, 0x3D, 0x3E, 0xB3, 0x29, 0x4F, 0x5D, 0xC6, 0x3A, 0xC3, 0xEE, 0x11, 0x9E,
-    0x88, 0xBF, 0x8C, 0x92, 0xE6, 0xE2, 0xB7, 0x09, 0x53, 0x90, 0x1B, 0x53, 0x87, 0x1E, 0x85, 0xE0,
-    0x12, 0xCF, 0xA9, 0x0A, 0x42, 0x02, 0x47, 0x44, 0x5E, 0x6A, 0x7B, 0x0A, 0xB0, 0x49, 0xC7, 0x46,
-    0x2D, 0x66, 0xA1, 0xC8, 0xAB, 0xF7, 0x54, 0xC0, 0xFF, 0xE7, 0x7E, 0x8F, 0xE0, 0x59, 0x74, 0xF1,
-    0x6A, 0xD2, 0x79, 0x36, 0x15, 0x9E, 0x8F, 0xD0, 0x4B, 0xCB, 0x45, 0x91, 0xCA, 0xA9, 0x99, 0x52,
-    0x23, 0xE9, 0x0F, 0x35, 0xC7, 0x32, 0x3C, 0xC8, 0x62, 0xBF, 0xDB, 0x11, 0xF3, 0x39, 0x32, 0x14,
-    0x60, 0xCD, 0xA6, 0x11, 0x3D, 0xCA, 0x64, 0x8B, 0xC4, 0x84, 0xF9, 0x83, 0xD5, 0xCF, 0xFF, 0xBC,
-    0xF6, 0xDC, 0xBC, 0x0E, 0x7E, 0x73, 0x50, 0x47, 0x59, 0xC8, 0x92, 0x41, 0x0B, 0x60, 0x47, 0xD0,
-    0x37, 0xE0, 0x9A, 0xA5, 0xC3, 0xB2, 0x89, 0x52, 0xD2, 0x3B, 0x52, 0xD1, 0x80, 0xB8, 0xAF, 0x19,
-    0xB2, 0x07, 0xFB, 0xDC, 0xCB, 0x85, 0x0E, 0x31, 0x3B, 0x28, 0x80, 0xE5, 0x31, 0xDB, 0xB3, 0x28,
-    0x4E, 0xF3, 0x1E, 0x66, 0xCE, 0xC7, 0x1F, 0x63, 0xA6, 0x2D, 0xE2, 0x34, 0x29, 0x82, 0x92, 0x6C,
-    0x8B, 0x24, 0x0D, 0xD6, 0x27, 0x3C, 0x5F, 0xCF, 0x12, 0x7D, 0xBE, 0x84, 0x2F, 0x4B, 0x3E, 0xD9,
-    0x21, 0xF9, 0x42, 0xA2, 0x2F, 0xBF, 0x1C, 0x26, 0xFC, 0x01, 0xC3, 0xEF, 0x0E, 0x78, 0xDE, 0x43,
-    0xE1, 0xFA, 0x13, 0xCE, 0x4D, 0x62, 0x3F, 0x9E, 0x21, 0x67, 0x8E, 0x29, 0x33, 0x86, 0x03, 0x5B,
-    0x90, 0xCD, 0x52, 0x09, 0x7B, 0x07, 0xCB, 0xFF, 0xAD, 0x96, 0xE8, 0x2F, 0xD1, 0x58, 0xA2, 0x2C,
-    0x28, 0x93, 0xF4, 0x04, 0x03, 0x22, 0x1A, 0xCC, 0x7C, 0x99, 0x3B, 0xA9, 0x8A, 0xF6, 0x4F, 0x1F,
-    0x9F, 0x0C, 0x40, 0xF8, 0x47, 0x4B, 0x46, 0xAE, 0x86, 0x7C, 0xD0, 0x87, 0x51, 0xF4, 0xDD, 0x82,
-    0xE3, 0xAF, 0x97, 0x7A, 0xE7, 0x22, 0x99, 0x13, 0xA3, 0x7B, 0xB3, 0x60, 0x5F, 0xDE, 0x05, 0x0B,
-    0x1D, 0xA4, 0x7A, 0x27, 0x29, 0x31, 0xC5, 0x3C, 0x39, 0x80, 0x93, 0xA3, 0xAB, 0xAD, 0x0E, 0x16,
-    0x20, 0x11, 0xFE, 0x27, 0x48, 0x91, 0xF7, 0x0A, 0x49, 0x98, 0x24, 0x88, 0xE1, 0xAF, 0xC0, 0x5B,
-    0x83, 0xCA, 0x43, 0xE3, 0x8D, 0x33, 0x8B, 0x10, 0x86, 0x2E, 0x5D, 0x31, 0x22, 0xC9, 0x23, 0x0D,
-    0xB4, 0x2F, 0xD7, 0x57, 0xC7, 0x84, 0x7F, 0xAC, 0xD8, 0xA8, 0xE7, 0x9E, 0xE4, 0xFD, 0x5A, 0xF6,
-    0x6B, 0xFB, 0xFB, 0xDF, 0x75, 0xCE, 0x7D, 0xE9, 0x94, 0x8D, 0xFD, 0x8F, 0x4B, 0x2E, 0xC8, 0xFA,
-    0x17, 0x97, 0xA0, 0xB5, 0x93, 0xC5, 0xF7, 0x1B, 0xBF, 0x31, 0x2D, 0xA6, 0xD9, 0x0E, 0x4C, 0x2B,
-    0x07, 0x13, 0x9B, 0xA0, 0x78, 0x72, 0x90, 0xB6, 0x3C, 0xB6, 0x69, 0x1B, 0x8F, 0xA5, 0x8E, 0x40,
-    0xB5, 0x2C, 0x12, 0xC7, 0x56, 0x00, 0x66, 0xC8, 0x1C, 0xCF, 0x1A, 0xF9, 0x33, 0x39, 0x13, 0x5D,
-    0x36, 0x69, 0x25, 0xE2, 0xCD, 0x70, 0xFE, 0xD5, 0xA7, 0xA6, 0x7F, 0x5D, 0xFE, 0x06, 0xE9, 0x96,
-    0xA3, 0x00, 0x5A, 0x6C, 0xA9, 0xE1, 0x11, 0x37, 0x10, 0xBD, 0xE6, 0x79, 0x2A, 0x3A, 0x46, 0x95,
-    0xE8, 0xC9, 0x2B, 0x1F, 0x7D, 0xF2, 0x34, 0xB5, 0xEF, 0x14, 0xC7, 0xE8, 0x14, 0x09, 0x3A, 0x85,
-    0xFD, 0x5D, 0x16, 0x50, 0xF4, 0x2C, 0xE0, 0xEE, 0x6A, 0x58, 0x3A, 0x1F, 0xF9, 0x03, 0x0B, 0x20,
-    0xCF, 0xA3, 0xB7, 0x2F, 0x03, 0x91, 0x07, 0xF8, 0x3C, 0x17, 0xF9, 0xDA, 0xA9, 0xDF, 0xAC, 0xB5,
-    0x5B, 0xAF, 0x9F, 0x76, 0xEA, 0xF3, 0xB1, 0x5D, 0xE7, 0x0E, 0x6F, 0xF5, 0x04, 0xA0, 0xFD, 0xED,
-    0xB9, 0xE3, 0x4F, 0x45, 0x7E, 0x89, 0x92, 0x0E, 0x4A, 0x85, 0x01, 0xC3, 0x5F, 0x00, 0x5C, 0x42,
-    0xD6, 0xA4, 0x27, 0xF6, 0x7E, 0xAD, 0x87, 0x53, 0x3C, 0x9F, 0x61, 0x77, 0xD9, 0xA5, 0x83, 0x3F,
-    0x27, 0x75, 0xBC, 0xCF, 0x16, 0x4A, 0xCA, 0x1B, 0x11, 0x58, 0xA7, 0xCB, 0xC3, 0x64, 0x55, 0xA3,
-    0xE7, 0x05, 0xD5, 0xF0, 0xF5, 0xAC, 0x1E, 0x1E, 0x6F, 0x2C, 0xA7, 0xD7, 0xC1, 0x8E, 0xF1, 0x30,
-    0x0C, 0x9D, 0x3E, 0x93, 0x46, 0x23, 0x1E, 0x4D, 0xE7, 0x12, 0x1D, 0x1D, 0x14, 0x18, 0xEA, 0x1A,
-    0xBF, 0x43, 0xF7, 0xC5, 0x98, 0x97, 0x8E, 0x95, 0xD4, 0x2B, 0xD7, 0xCF, 0xF5, 0xA4, 0xB7, 0xD5,
-    0xD3, 0xF0, 0xB0, 0x88, 0x40, 0x6F, 0xC3, 0x36, 0xA8, 0xCD, 0x43, 0x57, 0x4B, 0x33, 0xAB, 0xE4,
-    0x08, 0xC9, 0x16, 0x0D, 0x4F, 0xE7, 0x95, 0x75, 0x36, 0x03, 0x62, 0xC5, 0x72, 0x3A, 0x72, 0x94,
-    0xAD, 0x28, 0x2D, 0x92, 0xCD, 0xF5, 0x33, 0x23, 0xC7, 0x7A, 0x26, 0x7F, 0x2E, 0xD4, 0xA2, 0x4F,
-    0x1D, 0x45, 0x8F, 0x99, 0x2A, 0xC5, 0xF1, 0x68, 0x39, 0xE7, 0xB0, 0x17, 0xD6, 0x3C, 0xB7, 0x22,
-    0x77, 0xB6, 0xDC, 0xE9, 0x88, 0x3B, 0x7D, 0xCC, 0xF3, 0x62, 0x0E, 0x00, 0x41, 0xB3, 0x64, 0xC1,
-    0x47, 0xCB, 0x27, 0x8E, 0xF1, 0xD2, 0xFD, 0xFC, 0x3A, 0xEE, 0x86, 0x93, 0x76, 0xF9, 0x6F, 0xBD,
-    0x5B, 0x3F, 0x90, 0xDC, 0xD6, 0x79, 0xFF, 0x00, 0xF0, 0x88, 0x44, 0x98, 0x04, 0x2C, 0xC8, 0xB1,
-    0xA2, 0x1B, 0x0B, 0x29, 0x54, 0x28, 0x9E, 0x98, 0x68, 0x5D, 0xDC, 0x2E, 0x60, 0x6B, 0x62, 0xCF,
-    0x44, 0x85, 0xAE, 0xE0, 0x59, 0x33, 0xE1, 0x4C, 0xA4, 0xC2, 0x85, 0x93, 0x14, 0x6C, 0x9C, 0x19,
-    0x4E, 0x66, 0xF7, 0x0E, 0x92, 0x0A, 0x17, 0x2A, 0x74, 0xF1, 0x8C, 0x32, 0xE9, 0xC2, 0x82, 0x85,
-    0xC3, 0x14, 0x52, 0xC1, 0xE2, 0x32, 0xD9, 0xE3, 0xC2, 0x76, 0xA1, 0xC2, 0x85, 0x20, 0x4B, 0x1C,
-    0x15, 0x29, 0x04, 0x59, 0x64, 0x3C, 0x93, 0x14, 0x82, 0x64, 0x28, 0xC2, 0x99, 0xD8, 0x43, 0x7E,
-    0xBF, 0xEF, 0x3D, 0x60, 0xF7, 0x48, 0x86, 0x43, 0x99, 0xBC, 0xDB, 0x21, 0x56, 0x7B, 0xC0, 0xC3,
-    0xFB, 0xFE, 0xBE, 0xEF, 0xFB, 0x7D, 0xDF, 0x7B, 0x12, 0x09, 0xBB, 0x42, 0x9C, 0x6E, 0x21, 0xB2,
-    0xB6, 0x95, 0x8A, 0x7E, 0x9C, 0x1A, 0x5F, 0x49, 0x26, 0x12, 0x34, 0xF8, 0x71, 0x27, 0x17, 0x89,
-    0x27, 0x22, 0xDE, 0x87, 0xF8, 0xD1, 0x6E, 0x88, 0x44, 0xCF, 0x15, 0xE2, 0x55, 0x23, 0x91, 0xA9,
-    0x57, 0x4A, 0x98, 0x8D, 0xC5, 0xA9, 0xDC, 0x4A, 0x92, 0xAE, 0x93, 0xA0, 0xEB, 0x2A, 0x39, 0xBC,
-    0xF6, 0x96, 0xC4, 0x98, 0x83, 0x0F, 0xD3, 0x56, 0xA4, 0x89, 0x32, 0x09, 0x5F, 0xAB, 0xF0, 0xEE,
-    0x14, 0x33, 0xE6, 0x4A, 0x2F, 0xC6, 0xD5, 0x93, 0x5B, 0x2F, 0x9F, 0x95, 0x79, 0x3B, 0xF1, 0x16,
-    0x2F, 0x35, 0x41, 0xE9, 0xD7, 0x61, 0xEE, 0x55, 0x31, 0xE6, 0x4F, 0xC4, 0x2B, 0xC7, 0xB8, 0xA6,
-    0xE2, 0x17, 0x33, 0xBC, 0x37, 0x93, 0x10, 0x57, 0x9C, 0x4D, 0x64, 0x27, 0x4D, 0xDC, 0x4F, 0xD3,
-    0xB8, 0x7B, 0x43, 0x82, 0x45, 0x24, 0xA2, 0xB3, 0xFC, 0x81, 0xBC, 0x2C, 0x72, 0xD9, 0x07, 0xCF,
-    0x1D, 0x48, 0x3A, 0x98, 0x5E, 0xE4, 0x8C, 0xD8, 0x4F, 0xC4, 0x21, 0x87, 0x62, 0xE5, 0x19, 0x83,
-    0x15, 0xF7, 0x4B, 0xC8, 0x12, 0xBE, 0x24, 0x46, 0x20, 0xBF, 0x80, 0xC0, 0x89, 0x07, 0x35, 0xD4,
-    0x61, 0xA6, 0x12, 0xC9, 0x44, 0x66, 0xE2, 0x51, 0x9A, 0xB8, 0xEB, 0x72, 0x15, 0x09, 0x9C, 0x4F,
-    0x05, 0x4F, 0x6A, 0xAF, 0x02, 0x57, 0x94, 0x29, 0x03, 0xA5, 0xC4, 0x07, 0xA5, 0x99, 0xA1, 0xFF,
-    0xB4, 0x03, 0x89, 0x31, 0xDA, 0xEF, 0x40, 0x6F, 0x53, 0x1E, 0x9F, 0x70, 0x6A, 0x0F, 0xF2, 0x3F,
-    0xCF, 0x0C, 0xFB, 0x34, 0x07, 0xB9, 0x0F, 0x7F, 0x91, 0x2B, 0xF3, 0xB4, 0x86, 0xF2, 0xDE, 0x40,
-    0xE9, 0x64, 0x9D, 0xC6, 0x20, 0xE7, 0xE1, 0x7F, 0x5F, 0xAB, 0xC8, 0x38, 0x6D, 0xF1, 0x1C, 0xF8,
-    0xFE, 0x18, 0x0A, 0x68, 0xC8, 0xB6, 0x31, 0x85, 0x50, 0x61, 0x01, 0x2E, 0x1F, 0xBF, 0xDD, 0x12,
-    0x14, 0xF6, 0x41, 0x30, 0xE4, 0x8F, 0xCD, 0x47, 0x67, 0x1D, 0x9A, 0x85, 0x46, 0xC4, 0xCB, 0xCD,
-    0xFC, 0xFE, 0x07, 0xF8, 0xDD, 0xF6, 0x76, 0x39, 0x47, 0xBB, 0x80, 0x72, 0x68, 0xAF, 0x00, 0x84,
-    0x1D, 0x6B, 0x2F, 0xBF, 0xBB, 0x25, 0x11, 0x25, 0xB8, 0xF5, 0xB5, 0x2C, 0xC6, 0x9B, 0x11, 0x8D,
-    0xC5, 0x19, 0x38, 0x1B, 0xC4, 0x17, 0x9A, 0x11, 0x12, 0xC0, 0xCD, 0xCC, 0x03, 0xBD, 0xC9, 0xA9,
-    0x13, 0x31, 0x72, 0x39, 0x1C, 0x91, 0x60, 0x4A, 0xBF, 0x71, 0x76, 0x65, 0xDE, 0x35, 0x98, 0x13,
-    0x1E, 0xEE, 0xA8, 0x3A, 0xD7, 0x52, 0x7D, 0x3E, 0x56, 0xC2, 0xB0, 0x7A, 0xEF, 0x28, 0x73, 0x8E,
-    0x94, 0xE4, 0xE6, 0x95, 0xA0, 0x54, 0x12, 0x98, 0x1D, 0x7A, 0x23, 0x21, 0xB2, 0x3F, 0x33, 0x33,
-    0xCF, 0xE8, 0x2E, 0x9C, 0xFB, 0x4F, 0x1D, 0x70, 0xE8, 0x75, 0xA5, 0x99, 0x94, 0x5F, 0x1E, 0xDE,
-    0xF1, 0x3A, 0x5C, 0xBF, 0x2E, 0x31, 0x2D, 0xD6, 0x47, 0xEA, 0x9C, 0x88, 0x3C, 0x9B, 0xEA, 0x1C,
-    0x70, 0xBC, 0x66, 0x4F, 0xEA, 0x30, 0x3D, 0x63, 0x9C, 0x26, 0xBE, 0x45, 0x69, 0xBA, 0xEF, 0x67,
-    0x37, 0x54, 0xD4, 0x58, 0xA5, 0x05, 0xEB, 0x4E, 0xA5, 0x42, 0xC4, 0x3A, 0x31, 0x3D, 0x0B, 0xA2,
-    0xF8, 0x58, 0x34, 0xC9, 0xA1, 0x71, 0x5A, 0xCE, 0xE9, 0xF6, 0xF4, 0xFF, 0x44, 0x96, 0x9F, 0xA8,
-    0xDB, 0x95, 0x1D, 0x0C, 0x9C, 0xEF, 0xFE, 0xB5, 0xCC, 0xF1, 0xF7, 0x8E, 0xE5, 0x4F, 0xAD, 0x98,
-    0x1B, 0x5D, 0xA9, 0xA7, 0xCE, 0xEC, 0x83, 0x23, 0x92, 0x50, 0x34, 0xCA, 0x2B, 0x0B, 0xBE, 0x52,
-    0x9E, 0x4E, 0xDD, 0x0E, 0xBA, 0x8B, 0x3A, 0xBC, 0xB0, 0x66, 0x85, 0x98, 0xE9, 0x6B, 0xA7, 0xD3,
-    0x9E, 0xE0, 0x7C, 0xD7, 0xED, 0x5A, 0x6F, 0xF1, 0x57, 0x6E, 0xA3, 0x1A, 0x9A, 0xA9, 0x1C, 0x58,
-    0xCB, 0xB0, 0x86, 0x3B, 0x08, 0x41, 0x63, 0x2C, 0x24, 0x8B, 0xB0, 0x54, 0xA1, 0x15, 0x55, 0x08,
-    0xD5, 0xBE, 0x81, 0x41, 0xFE, 0x2F, 0x73, 0x55, 0x8B, 0xEA, 0xDB, 0x49, 0x4F, 0xC2, 0x16, 0xD0,
-    0xBD, 0x97, 0x4F, 0x24, 0x8A, 0x95, 0xB0, 0x8F, 0x57, 0xCF, 0x3E, 0xBA, 0x6F, 0x6D, 0xC2, 0xA0,
-    0x7E, 0xB6, 0x27, 0x32, 0x1A, 0x33, 0xB4, 0x65, 0x76, 0x85, 0x9E, 0x5D, 0x0A, 0xA4, 0x5C, 0x84,
-    0x37, 0xE7, 0x25, 0xA6, 0xDE, 0x49, 0xA1, 0xA2, 0x16, 0x0A, 0x0A, 0xF2, 0xD8, 0x84, 0x68, 0xAF,
-    0x84, 0x2F, 0x8E, 0x41, 0xC7, 0x2B, 0x41, 0x61, 0x0A, 0xA1, 0x82, 0x02, 0x2C, 0xB4, 0x61, 0x2A,
-    0xE1, 0x2B, 0x95, 0xB8, 0x35, 0xC6, 0xED, 0x60, 0x5C, 0x94, 0x8F, 0x25, 0xA8, 0xFD, 0xDB, 0x17,
-    0x17, 0xB0, 0xF3, 0x21, 0x82, 0xF9, 0xC1, 0xD2, 0xF8, 0x4E, 0x3D, 0xA1, 0xDD, 0x42, 0x3A, 0xC7,
-    0x67, 0xD4, 0xC8, 0x18, 0xAB, 0x5B, 0xBC, 0x5F, 0xF1, 0x19, 0x9E, 0x38, 0x37, 0xC8, 0xFF, 0xBC,
-    0xA5, 0x09, 0xDF, 0x04, 0x87, 0x0C, 0x18, 0xD4, 0x5A, 0x42, 0x49, 0x19, 0x30, 0x2B, 0xDA, 0x8E,
-    0x61, 0x83, 0x12, 0x4E, 0x29, 0x2A, 0x5E, 0xC0, 0xBF, 0x96, 0x3F, 0x63, 0x38, 0x66, 0xCE, 0x17,
-    0x18, 0x3F, 0xC4, 0xED, 0x1A, 0x10, 0xD0, 0x10, 0x22, 0xA7, 0x06, 0xCF, 0x53, 0x11, 0xBD, 0x2F,
-    0x2E, 0x41, 0xCE, 0x0C, 0x43, 0xA7, 0x98, 0x52, 0x65, 0xC4, 0x1C, 0x51, 0xAA, 0x73, 0xE3, 0xFD,
-    0xE6, 0xE2, 0xED, 0x4D, 0xEF, 0x93, 0xAE, 0xCB, 0xA2, 0x17, 0x60, 0x92, 0x7D, 0xCA, 0x5E, 0x51,
-    0x4A, 0x04, 0x27, 0xD9, 0xC7, 0x70, 0xBF, 0xC2, 0x1A, 0xD8, 0x11, 0x8A, 0xE9, 0x1C, 0x7C, 0xBF,
-    0x4B, 0x7D, 0xFA, 0x60, 0x4C, 0x05, 0xCA, 0x4A, 0xE6, 0x03, 0xE1, 0x27, 0xFE, 0xED, 0x77, 0xB0,
-    0x20, 0x7C, 0x6A, 0xED, 0xC5, 0x5B, 0x2A, 0xA1, 0x0A, 0xD8, 0x41, 0xBE, 0xE4, 0x1F, 0xBB, 0x4C,
-    0xA5, 0x6B, 0x20, 0x1C, 0x65, 0x53, 0xD1, 0x46, 0x90, 0x4C, 0x05, 0x9B, 0x19, 0x96, 0x5A, 0x95,
-    0xCA, 0xCF, 0x83, 0x5A, 0x65, 0x52, 0x91, 0x54, 0xA2, 0x53, 0xC6, 0x64, 0x35, 0xB4, 0x8B, 0xC9,
-    0xB7, 0x4C, 0x96, 0xD0, 0x55, 0x85, 0x6B, 0xB1, 0x75, 0x81, 0x52, 0x90, 0x09, 0x3A, 0x38, 0x2F,
-    0x3A, 0x09, 0x43, 0x14, 0x38, 0xCD, 0x90, 0x5D, 0xD3, 0xF0, 0xE6, 0x96, 0x09, 0x99, 0xA9, 0xF2,
-    0xA9, 0x5E, 0x3A, 0xB6, 0xD7, 0x36, 0x5E, 0xEF, 0xA7, 0x42, 0x06, 0xC0, 0x9A, 0x28, 0x1D, 0x43,
-    0x61, 0xBD, 0x81, 0x94, 0x79, 0xF2, 0x93, 0x26, 0x4E, 0xC7, 0x61, 0x16, 0xBE, 0x9E, 0xFB, 0xEF,
-    0x97, 0xEB, 0x1F, 0x43, 0xF8, 0x9D, 0x2E, 0x8B, 0x53, 0xDA, 0x81, 0xB4, 0x60, 0x96, 0xB0, 0x38,
-    0x0D, 0xD7, 0xCB, 0x23, 0x98, 0x90, 0xEE, 0x75, 0x1A, 0xDF, 0x7E, 0x7A, 0x19, 0xAE, 0x58, 0xC1,
-    0xF1, 0xF2, 0xC1, 0xE7, 0x8E, 0x83, 0xE1, 0x67, 0x9C, 0xCC, 0xCB, 0x37, 0xC0, 0x77, 0x2A, 0xCC,
-    0xDE, 0x16, 0x1B, 0x34, 0x54, 0x94, 0x77, 0x10, 0x67, 0xFB, 0xD2, 0x80, 0xF3, 0x57, 0x2B, 0xA7,
-    0x1E, 0x3B, 0x37, 0x38, 0x39, 0x58, 0x0F, 0x8A, 0x61, 0xE9, 0x80, 0x77, 0xAF, 0x76, 0x20, 0x72,
-    0x2B, 0x3B, 0x87, 0x96, 0xCF, 0x35, 0x4B, 0x2E, 0x39, 0x1A, 0xC8, 0x8E, 0x83, 0x79, 0x86, 0x2F,
-    0xB0, 0x00, 0x5D, 0xBA, 0x59, 0xEF, 0x4A, 0xF3, 0x8C, 0xE1, 0xEB, 0x20, 0x7E, 0x15, 0x48, 0xA8,
-    0x91, 0x66, 0x26, 0x53, 0x70, 0x1E, 0x75, 0x87, 0x7E, 0xD7, 0xB8, 0xF5, 0xD1, 0xF0, 0xF5, 0x32,
-    0xF8, 0x76, 0x6C, 0xF8, 0x3A, 0x0E, 0xF6, 0xDC, 0xC2, 0x0C, 0x3A, 0x8F, 0x07, 0x5C, 0xB7, 0x63,
-    0xBE, 0x50, 0x98, 0x98, 0xF5, 0xD5, 0x7D, 0xA3, 0x90, 0xAF, 0x71, 0xC1, 0x32, 0xB1, 0x33, 0x99,
-    0x8C, 0xB0, 0xC0, 0x2A, 0x4D, 0xA2, 0x0E, 0xDC, 0x9B, 0xE1, 0xCF, 0xFD, 0x75, 0x65, 0x02, 0xEF,
-    0x8E, 0x1C, 0xAB, 0xCB, 0x9C, 0x91, 0x4D, 0xE6, 0xD9, 0x10, 0x01, 0x6F, 0x0E, 0x48, 0x5A, 0x1B,
-    0x54, 0xA1, 0xAA, 0xD7, 0x68, 0xFB, 0x93, 0x26, 0x28, 0xC2, 0x0C, 0xBA, 0x8F, 0x81, 0x59, 0xCB,
-    0x75, 0x48, 0xD4, 0x40, 0xF9, 0xB2, 0x7F, 0x57, 0xB4, 0x7D, 0x92, 0x62, 0xF9, 0x43, 0x26, 0xDF,
-    0xB4, 0xB9, 0x2D, 0x42, 0x8C, 0xF4, 0xDF, 0x67, 0xC2, 0x8C, 0x28, 0x85, 0x05, 0x09, 0xEB, 0x26,
-    0x7F, 0xE4, 0xC1, 0xE2, 0x2F, 0x66, 0xEE, 0xC2, 0x0E, 0x0D, 0x87, 0xB4, 0x20, 0x46, 0x1C, 0xCD,
-    0x20, 0x41, 0xEE, 0x74, 0x55, 0x0B, 0xED, 0x86, 0xB9, 0xF3, 0x22, 0x7E, 0xC8, 0x38, 0xCC, 0x15,
-    0x34, 0xC9, 0x04, 0xD9, 0x26, 0xC8, 0x91, 0x43, 0x1A, 0xE7, 0x10, 0xE1, 0xCB, 0x67, 0xA4, 0xD1,
-    0x70, 0x6B, 0x01, 0x0A, 0xA7, 0xA4, 0xC9, 0xF0, 0x4E, 0xF8, 0x3A, 0x90, 0x66, 0x5A, 0xA9, 0x6E,
-    0x07, 0x44, 0x99, 0x74, 0x11, 0x72, 0x09, 0xEC, 0x93, 0x45, 0x05, 0x71, 0x19, 0x23, 0x0E, 0xE2,
-    0x50, 0x22, 0x8C, 0x8E, 0x04, 0x66, 0x31, 0x14, 0xCB, 0x9B, 0x50, 0xEF, 0x0D, 0x44, 0xAF, 0x79,
-    0x1A, 0xE6, 0xFF, 0x51, 0xB8, 0xDD, 0x01, 0xF0, 0x6C, 0x0D, 0xFA, 0x0C, 0x98, 0xAA, 0xDE, 0x40,
-    0xF3, 0xB6, 0x73, 0x2B, 0xA8, 0xA0, 0xD5, 0x4A, 0x4E, 0x2B, 0x6E, 0x96, 0x97, 0x5D, 0xD8, 0x5D,
-    0xAE, 0xD3, 0x68, 0xB0, 0x10, 0x13, 0x4E, 0x9F, 0x3D, 0x9D, 0xF9, 0x61, 0x0A, 0x6D, 0x41, 0xFF,
-    0x1F, 0x5C, 0xCC, 0x63, 0xDA, 0xAC, 0xCF, 0x8E, 0x44, 0x01, 0x9A, 0x2A, 0x39, 0x35, 0xF5, 0x0A,
-    0xFD, 0x46, 0x90, 0xDC, 0xA5, 0x0A, 0xCE, 0xED, 0x84, 0xCC, 0x3E, 0x18, 0x37, 0x05, 0x45, 0x3F,
-    0xDF, 0xC6, 0x53, 0x98, 0x2B, 0xCC, 0xA2, 0x12, 0x8E, 0xB0, 0x83, 0x64, 0x07, 0x7B, 0xED, 0x8A,
-    0x8D, 0x39, 0x4F, 0x8A, 0x53, 0x3C, 0xCD, 0x08, 0x46, 0x97, 0x58, 0x7A, 0x90, 0x5C, 0xCA, 0xAE,
-    0x20, 0x04, 0x4F, 0xA4, 0x7B, 0xF1, 0x10, 0x52, 0x01, 0x6D, 0x42, 0xEF, 0x8C, 0xC0, 0x21, 0xA5,
-    0x2F, 0x65, 0x8C, 0xA9, 0xA2, 0x74, 0xA6, 0x79, 0x8F, 0x2A, 0x71, 0x1B, 0xD4, 0x25, 0x0B, 0x8D,
-    0xBF, 0x41, 0xF7, 0x9B, 0x5C, 0xE6, 0xBF, 0xA2, 0x16, 0x69, 0xA5, 0x51, 0x9F, 0xDE, 0x33, 0x7F,
-    0x37, 0xCE, 0x69, 0x7D, 0x98, 0xD5, 0x48, 0x98, 0xAE, 0x1A, 0xF1, 0xD9, 0x15, 0xF4, 0x73, 0x02,
-    0x92, 0xAB, 0xDD, 0x83, 0x1E, 0x72, 0xFC, 0x60, 0x85, 0xF8, 0x49, 0x48, 0x7E, 0x42, 0xBE, 0x6D,
-    0x45, 0x14, 0x8A, 0xC8, 0x70, 0xE4, 0x65, 0xCB, 0x4A, 0x2D, 0xB5, 0xF7, 0xAF, 0x1B, 0x50, 0xA1,
-    0x0A, 0x5D, 0x93, 0x13, 0x73, 0x7B, 0x5D, 0xF9, 0xC4, 0x83, 0x1A, 0xBB, 0xC2, 0x17, 0x50, 0x26,
-    0x54, 0xA1, 0x2C, 0x57, 0x5E, 0x44, 0x8E, 0x31, 0x0D, 0x8B, 0x2C, 0x0F, 0x81, 0x05, 0xD2, 0x11,
-    0xC9, 0x80, 0x98, 0x52, 0xD5, 0xBA, 0x71, 0x84, 0xE0, 0xE6, 0x54, 0x10, 0xBA, 0xCB, 0x51, 0x7F,
-    0x75, 0x08, 0x77, 0x5B, 0x76, 0x78, 0x8A, 0xF7, 0x27, 0x66, 0xB8, 0x57, 0x86, 0x76, 0xF8, 0xD4,
-    0xD1, 0xE1, 0xB9, 0x01, 0x6B, 0x63, 0xA3, 0x24, 0x2E, 0xFD, 0x04, 0x7A, 0x68, 0x00, 0x78, 0x8A,
-    0x8D, 0x25, 0x7D, 0xB9, 0x2B, 0x16, 0x4E, 0xAD, 0x9A, 0x88, 0xB7, 0x1B, 0xB8, 0xE4, 0x17, 0x5D,
-    0xE3, 0x7C, 0x79, 0xB3, 0x75, 0x0F, 0x65, 0x82, 0x3A, 0x6B, 0x02, 0xCD, 0x4C, 0x40, 0x7A, 0x06,
-    0x97, 0x6C, 0xC0, 0x5E, 0x03, 0x4B, 0xA1, 0x44, 0x74, 0x01, 0x88, 0x5C, 0x44, 0x34, 0xAF, 0x84,
-    0xAF, 0x14, 0x63, 0xB8, 0xE4, 0x88, 0xEA, 0xC0, 0x3C, 0x7B, 0xA2, 0x2C, 0xB0, 0x02, 0x4E, 0x5F,
-    0xBC, 0xBD, 0x75, 0xF1, 0x36, 0x8A, 0xC8, 0xAE, 0x7B, 0x83, 0x5F, 0x45, 0x32, 0x3C, 0x41, 0xA0,
-    0xF6, 0xE9, 0x38, 0x50, 0xDB, 0x9C, 0xCB, 0x21, 0xD9, 0xDA, 0xDA, 0x16, 0xD5, 0x85, 0x79, 0x42,
-    0x65, 0xA8, 0x92, 0x0C, 0xE0, 0xD3, 0x27, 0xE0, 0x20, 0x58, 0x7D, 0x72, 0x44, 0x14, 0x77, 0x7E,
-    0x8D, 0x91, 0x5F, 0x9C, 0xFD, 0x2D, 0x2B, 0xCA, 0x53, 0x99, 0xD4, 0x5D, 0xED, 0x7C, 0xF9, 0x5F,
-    0xAD, 0xDB, 0x41, 0x5F, 0xF7, 0x13, 0x25, 0xA3, 0x28, 0xCE, 0xFD, 0x45, 0x59, 0x83, 0x3B, 0xCD,
-    0x5F, 0x29, 0x38, 0xE7, 0x06, 0x0C, 0x6C, 0x8B, 0x30, 0x42, 0x18, 0xC2, 0x1A, 0x2E, 0xD0, 0xD8,
-    0x28, 0x8D, 0xCE, 0x4C, 0x6F, 0x98, 0x98, 0x34, 0x44, 0x47, 0xA7, 0x5A, 0x6B, 0x83, 0xC9, 0x63,
-    0x53, 0x0B, 0x30, 0x31, 0xB1, 0x7F, 0x30, 0x33, 0x83, 0xE6, 0x44, 0xFB, 0x15, 0xED, 0x74, 0x2A,
-    0x68, 0xFE, 0x1C, 0x69, 0x7B, 0x23, 0xAC, 0x6C, 0xC1, 0x75, 0x95, 0xAF, 0xC2, 0x9E, 0xEA, 0x0F,
-    0xA2, 0x46, 0x17, 0xB5, 0xAC, 0xA8, 0xB5, 0x45, 0x3D, 0xC0, 0xE8, 0xD8, 0xAC, 0xC3, 0x2E, 0xF7,
-    0xA0, 0xC0, 0x73, 0xA6, 0x0D, 0x82, 0x68, 0xC7, 0x14, 0xE4, 0x2F, 0x21, 0x4D, 0xA3, 0xDC, 0x31,
-    0xC3, 0xC6, 0x26, 0x24, 0x8C, 0x0D, 0x37, 0x93, 0x23, 0x8F, 0x6B, 0x7D, 0x4C, 0x9A, 0x78, 0x9B,
-    0xF1, 0x3A, 0xE8, 0xCA, 0xA4, 0xCB, 0x91, 0x26, 0x95, 0x25, 0xBC, 0x00, 0xEE, 0x67, 0x1C, 0x00,
-    0x16, 0x46, 0x9C, 0x0E, 0x2F, 0x27, 0x7C, 0x9D, 0x8F, 0x48, 0x4C, 0xFB, 0x34, 0x8C, 0x40, 0xBB,
-    0x6E, 0xFE, 0x4D, 0xD5, 0x11, 0xEA, 0x08, 0xDB, 0xBF, 0x78, 0x6C, 0x5C, 0xAD, 0xC9, 0x33, 0x1B,
-    0x6E, 0x3E, 0x3F, 0xE4, 0xDC, 0x1A, 0xEB, 0x9E, 0x48, 0xC9, 0x4D, 0xCD, 0x97, 0xE2, 0x23, 0xDC,
-    0x1C, 0x61, 0x74, 0xAC, 0xE6, 0x20, 0x1B, 0xE4, 0x6B, 0xDA, 0x97, 0xAD, 0xB4, 0x5C, 0xAD, 0x34,
-    0x63, 0xB5, 0xDB, 0xD1, 0xBF, 0xB5, 0xA8, 0x77, 0x06, 0x88, 0x05, 0x93, 0x91, 0x83, 0xCB, 0xF4,
-    0x70, 0xA2, 0x1F, 0x44, 0x9D, 0xE0, 0x03, 0x2D, 0x99, 0x19, 0x5B, 0x1C, 0x52, 0x6C, 0x6D, 0xA8,
-    0x77, 0x77, 0x85, 0xA5, 0x45, 0x0C, 0x1A, 0x98, 0xB2, 0xC6, 0x84, 0x31, 0xA6, 0x5F, 0xFE, 0xCC,
-    0x30, 0xF1, 0x75, 0x84, 0xA8, 0xEB, 0x98, 0x27, 0xDC, 0x75, 0x5A, 0x13, 0x9D, 0xCE, 0xF4, 0xBD,
-    0x84, 0x01, 0xFB, 0xC1, 0xD9, 0x08, 0xE7, 0xA0, 0x36, 0x5B, 0xA8, 0x8E, 0x55, 0x2D, 0xB6, 0x70,
-    0x6D, 0xEF, 0xFA, 0xBB, 0x51, 0x7F, 0x88, 0x7A, 0xAC, 0x15, 0x74, 0x99, 0xBA, 0xD8, 0x55, 0xAF,
-    0x40, 0x50, 0xC7, 0x7A, 0xCD, 0x46, 0x0E, 0xE2, 0x0B, 0xA2, 0x1C, 0x6E, 0x20, 0x7B, 0x94, 0x78,
-    0x13, 0x0A, 0xA9, 0x41, 0xC1, 0x63, 0xC9, 0x11, 0x99, 0x75, 0x05, 0x96, 0x2B, 0xB3, 0xE0, 0x28,
-    0x82, 0xAE, 0xC4, 0xD8, 0x54, 0x58, 0x5A, 0x76, 0x21, 0x44, 0x72, 0x1D, 0x52, 0x0C, 0x97, 0x02,
-    0x43, 0x96, 0x12, 0x64, 0xC3, 0xD4, 0xA1, 0x6C, 0xC8, 0x19, 0x95, 0xCA, 0x0A, 0xE2, 0x63, 0xA8,
-    0x4B, 0xEB, 0x20, 0x8D, 0xD3, 0x8C, 0xFA, 0x84, 0xAB, 0x6C, 0x6C, 0x49, 0xC2, 0xB5, 0xFB, 0x37,
-    0xA2, 0x85, 0xD9, 0x59, 0x3C, 0x9A, 0xE2, 0xDA, 0x87, 0xEE, 0x9E, 0x19, 0xE2, 0xD3, 0x55, 0xE7,
-    0x8A, 0xD4, 0x2E, 0x50, 0x3A, 0xCB, 0x33, 0xAF, 0xC4, 0x55, 0xA0, 0x32, 0xCA, 0xBD, 0x22, 0xC8,
-    0xFD, 0x3C, 0xCC, 0x82, 0x3C, 0x44, 0x4C, 0x8E, 0x52, 0xE4, 0x3F, 0x90, 0x06, 0x2C, 0x03, 0x73,
-    0x31, 0xD8, 0x18, 0x83, 0x87, 0x91, 0xAE, 0xFE, 0x99, 0x2D, 0xC1, 0x2D, 0x3E, 0xFC, 0x5E, 0x69,
-    0xA2, 0xF1, 0xA1, 0xD8, 0x26, 0x81, 0xF6, 0x0F, 0x78, 0x07, 0xD1, 0x51, 0xEA, 0x50, 0x4B, 0xEE,
-    0x21, 0x3C, 0xDB, 0xC0, 0x7E, 0x57, 0x15, 0x3F, 0xDC, 0xAC, 0xEF, 0x2E, 0xED, 0xFB, 0x9B, 0x93,
-    0xBB, 0x6E, 0x3A, 0x47, 0x6E, 0x66, 0x26, 0xAD, 0xFB, 0xAC, 0x81, 0xF0, 0x60, 0x8E, 0xEB, 0xB4,
-    0x59, 0x1E, 0x80, 0x9B, 0x70, 0x02, 0x22, 0x45, 0xA7, 0x46, 0x78, 0x81, 0xCA, 0x37, 0x2D, 0x37,
-    0x7F, 0x76, 0x34, 0x90, 0x7C, 0xD5, 0x68, 0xD3, 0x0F, 0xCA, 0xD4, 0x5B, 0xB0, 0x66, 0x34, 0x1D,
-    0xE3, 0xB6, 0x0F, 0x45, 0x22, 0x1B, 0x37, 0x82, 0xA0, 0x9B, 0x46, 0x08, 0x83, 0xC8, 0xB6, 0x31,
-    0x6E, 0xB8, 0x15, 0x90, 0xC5, 0x18, 0x50, 0xC4, 0xFB, 0x90, 0x6D, 0x85, 0x96, 0x71, 0x00, 0x73,
-    0x75, 0xC8, 0xE0, 0xE1, 0xCF, 0x6A, 0x6A, 0x0A, 0x81, 0x58, 0xE3, 0x00, 0xF1, 0x82, 0xB0, 0x89,
-    0xE7, 0xD0, 0x4F, 0x42, 0x98, 0x05, 0xB7, 0x67, 0x46, 0x17, 0xBD, 0xFB, 0x16, 0xD6, 0x10, 0xA1,
-    0x98, 0xDA, 0x61, 0x80, 0x60, 0xF7, 0xE4, 0x9F, 0xA5, 0xC9, 0x7E, 0xCA, 0xCE, 0x28, 0x42, 0x32,
-    0x3C, 0x09, 0xB3, 0x57, 0x98, 0x11, 0x55, 0x80, 0xF7, 0x9F, 0x40, 0x05, 0x9F, 0xE6, 0xCA, 0x4C,
-    0xF8, 0x09, 0x02, 0xCD, 0xAB, 0x50, 0x53, 0xDA, 0x28, 0x2B, 0x31, 0x26, 0x31, 0xD6, 0x8F, 0xB2,
-    0x81, 0xF4, 0xD8, 0x2A, 0xBE, 0x36, 0xBD, 0x43, 0xC5, 0x0C, 0x57, 0x57, 0xE7, 0x8E, 0x7F, 0x8F,
-    0xB9, 0xCF, 0x52, 0x8B, 0x9E, 0x06, 0x94, 0xBE, 0x04, 0xD7, 0x54, 0xAC, 0x2A, 0x7F, 0xE8, 0x98,
-    0x3D, 0xD6, 0xEA, 0x03, 0xC5, 0x87, 0xD6, 0x1E, 0x30, 0xFD, 0x3E, 0xDF, 0xC4, 0x0B, 0x18, 0x74,
-    0x6A, 0x45, 0x3F, 0x66, 0xE8, 0xF4, 0x28, 0x09, 0x33, 0xFF, 0x5D, 0x24, 0x32, 0x93, 0x1E, 0x8F,
-    0xA6, 0x85, 0x47, 0x65, 0x4C, 0x3F, 0x0D, 0x29, 0xF2, 0x95, 0xAC, 0x07, 0x50, 0x26, 0x98, 0x6A,
-    0x4C, 0x5A, 0x89, 0xFA, 0x13, 0x4D, 0x0C, 0x36, 0xCE, 0xFA, 0x7D, 0x28, 0x2E, 0xC9, 0xD4, 0x64,
-    0xC8, 0x19, 0xE6, 0x83, 0xD1, 0x7B, 0x2C, 0xF9, 0xBE, 0x69, 0x96, 0xE1, 0x84, 0x4D, 0x7F, 0xD4,
-    0x8B, 0x19, 0x16, 0xAE, 0x07, 0x64, 0xF1, 0x75, 0x5D, 0x66, 0xAB, 0x6E, 0x6C, 0xDD, 0xDE, 0xBA,
-    0x31, 0xA6, 0x61, 0xD2, 0x08, 0xAC, 0xDB, 0xB3, 0xB6, 0xBA, 0xBD, 0x95, 0xB2, 0x13, 0xD7, 0x73,
-    0x1D, 0xFC, 0xA2, 0xF4, 0x3E, 0xAE, 0xA4, 0x81, 0x5B, 0x5E, 0x96, 0xE8, 0xEC, 0x43, 0xC5, 0xF9,
-    0x52, 0x97, 0xEA, 0x6A, 0xDC, 0x7F, 0xB0, 0x02, 0x4F, 0x05, 0x39, 0x80, 0x2A, 0xEA, 0xDC, 0x67,
-    0x1F, 0xA4, 0x40, 0xA3, 0x1D, 0xE6, 0x9B, 0x95, 0x2C, 0x44, 0xED, 0xAC, 0x49, 0x3B, 0xF3, 0x3E,
-    0xA9, 0xC2, 0xEF, 0xA6, 0xBD, 0x76, 0xC6, 0xA4, 0xE1, 0x2F, 0x73, 0x98, 0xCA, 0xBD, 0xE4, 0x7C,
-    0x7A, 0x84, 0xF3, 0xB7, 0x65, 0x1B, 0x90, 0x19, 0x1E, 0x8A, 0x35, 0x0B, 0x1D, 0x83, 0xBF, 0x23,
-    0x92, 0x1C, 0x6C, 0x6D, 0x82, 0x81, 0x98, 0x35, 0x81, 0x98, 0x0C, 0xD4, 0x68, 0x78, 0xB7, 0xC9,
-    0x68, 0x9A, 0xC6, 0x55, 0xD8, 0xFA, 0x75, 0x58, 0x07, 0xAD, 0x5C, 0xD2, 0xBC, 0xE4, 0xAC, 0xE4,
-    0x25, 0xDB, 0xBA, 0xD5, 0xC0, 0xA2, 0x51, 0x5B, 0xD7, 0x25, 0x17, 0xD1, 0x12, 0x79, 0x4F, 0x99,
-    0xFD, 0xE6, 0x34, 0x46, 0xA7, 0x5F, 0x19, 0xCC, 0x78, 0x07, 0xEB, 0xDF, 0xFD, 0x2D, 0x80, 0x95,
-    0x87, 0x35, 0x54, 0x7B, 0xEF, 0x61, 0x9D, 0x79, 0x45, 0x4D, 0x50, 0x3A, 0x23, 0xAC, 0x05, 0xEE,
-    0x02, 0x52, 0x25, 0x7E, 0x8D, 0x11, 0xC0, 0x25, 0x7C, 0x3E, 0x8F, 0x58, 0x93, 0xC6, 0xE2, 0xBF,
-    0x8B, 0x4C, 0xE1, 0x7D, 0x94, 0x8E, 0x90, 0xE3, 0xD9, 0x20, 0xEB, 0x48, 0xEF, 0x90, 0x39, 0x76,
-    0x9F, 0xA4, 0x2E, 0x98, 0xEA, 0xC8, 0xB3, 0x36, 0x3F, 0xBF, 0x0C, 0x22, 0x57, 0x20, 0xFB, 0x67,
-    0x84, 0xAA, 0xB7, 0x89, 0xEF, 0xF6, 0x01, 0x55, 0xA7, 0x18, 0x35, 0x43, 0x20, 0x6B, 0xE1, 0x9C,
-    0xED, 0x2A, 0x54, 0x05, 0xA8, 0xE4, 0x82, 0x2F, 0x13, 0xF1, 0x79, 0x01, 0xE3, 0xE9, 0x2E, 0xCC,
-    0x89, 0x09, 0x21, 0xAB, 0x15, 0x0B, 0x83, 0xB7, 0xCA, 0xA1, 0x2D, 0x94, 0xE5, 0xEE, 0xD2, 0xA3,
-    0xCA, 0x33, 0xF4, 0xD7, 0x6D, 0x7D, 0x76, 0xD9, 0x56, 0x41, 0xA9, 0xA1, 0x82, 0xC5, 0x36, 0xA2,
-    0x79, 0xD9, 0xE5, 0x90, 0x80, 0x69, 0x80, 0x8D, 0x8E, 0x61, 0x83, 0xE9, 0xE4, 0xD4, 0xE1, 0x20,
-    0x94, 0xE8, 0xB6, 0xC6, 0x67, 0x4C, 0x82, 0x85, 0xE9, 0x81, 0x9F, 0x7B, 0x2C, 0x3A, 0xA0, 0x97,
-    0x68, 0x8D, 0xD9, 0xAE, 0xD6, 0xA8, 0x7F, 0xF9, 0x9D, 0x43, 0xFF, 0xB5, 0xF7, 0xBB, 0x2A, 0xBD,
-    0x73, 0x7B, 0x21, 0x3B, 0x40, 0x0F, 0x31, 0x5C, 0x3E, 0x2C, 0x89, 0x2D, 0x20, 0x75, 0x83, 0x41,
-    0x53, 0x53, 0x07, 0x97, 0x9C, 0x9B, 0xF5, 0x01, 0xD6, 0x43, 0x72, 0xE4, 0xE6, 0xC3, 0xAB, 0x27,
-    0x07, 0x6A, 0xB9, 0x47, 0x3D, 0xD1, 0xA0, 0x9E, 0x60, 0xA9, 0x9E, 0x4F, 0x7B, 0xF5, 0xC8, 0x52,
-    0x3D, 0x53, 0x9B, 0x52, 0x8C, 0x04, 0xC4, 0x4B, 0xAC, 0x37, 0xF0, 0xC5, 0xDE, 0xC9, 0x0F, 0x54,
-    0x41, 0x85, 0x51, 0x90, 0xA9, 0xCF, 0xDC, 0xAF, 0x5A, 0x9F, 0xE9, 0xB2, 0xEE, 0x9B, 0x62, 0xD0,
-    0xCE, 0xA9, 0x6D, 0xDB, 0x1E, 0xE2, 0xFA, 0x06, 0xAC, 0x06, 0xA9, 0x66, 0x65, 0x07, 0xD7, 0x1D,
-    0x36, 0x05, 0xEA, 0xF5, 0x06, 0x2C, 0xA2, 0x56, 0x2E, 0x55, 0xDF, 0x12, 0xFE, 0x9C, 0x7D, 0x76,
-    0xCE, 0x36, 0xC3, 0x14, 0xEE, 0xE7, 0xF8, 0x2B, 0xE0, 0x3E, 0x49, 0xC2, 0x90, 0xD1, 0x62, 0x46,
-    0xFF, 0x13, 0x62, 0xFB, 0x17, 0xB8, 0xD7, 0x4B, 0xB0, 0x5D, 0x6E, 0x33, 0x9A, 0x2C, 0xC4, 0xAF,
-    0x51, 0xCE, 0xB3, 0xA5, 0xA9, 0x10, 0xE8, 0xB0, 0xAF, 0xCC, 0x63, 0x48, 0xC8, 0xE2, 0xCD, 0x76,
-    0xB2, 0xD7, 0x6F, 0x81, 0x34, 0x8A, 0xC2, 0x7F, 0x6A, 0xDD, 0xDA, 0x69, 0xA2, 0x8C, 0xB9, 0x1A,
-    0x71, 0x5D, 0x62, 0x16, 0x21, 0x13, 0xF1, 0x3E, 0x47, 0xD0, 0x7C, 0x1D, 0x4B, 0x18, 0xF2, 0x01,
-    0xB0, 0x44, 0xE9, 0xC2, 0x6D, 0xF0, 0x7A, 0xA6, 0x98, 0x4A, 0x3F, 0xBB, 0x2E, 0x37, 0x0C, 0x37,
-    0xB4, 0x8C, 0x01, 0xB3, 0x87, 0xAB, 0xD1, 0x2B, 0x3E, 0x4C, 0xB9, 0xC3, 0x0C, 0x82, 0xDF, 0x9E,
-    0x67, 0x10, 0x3C, 0x41, 0x91, 0x2F, 0xDB, 0xF4, 0x9D, 0x36, 0x4E, 0x31, 0x21, 0x41, 0xCF, 0x3B,
-    0x78, 0x2B, 0x8E, 0x59, 0xAF, 0x31, 0xF7, 0xFC, 0x96, 0xC9, 0xE7, 0x5D, 0x88, 0xB2, 0x9D, 0xD0,
-    0x2A, 0xD4, 0xD7, 0xCF, 0x71, 0xEB, 0x86, 0xAF, 0x1B, 0x03, 0x05, 0xF7, 0x4A, 0xCA, 0x80, 0xFD,
-    0xCF, 0x2E, 0x35, 0x04, 0x75, 0x55, 0x3D, 0x23, 0xBB, 0x52, 0x05, 0xDC, 0x87, 0x30, 0xCD, 0x2F,
-    0x23, 0x9A, 0x73, 0x23, 0xD5, 0x92, 0xED, 0xE0, 0x52, 0x1E, 0xA7, 0xD1, 0x2B, 0x8D, 0x24, 0x30,
-    0xCB, 0x6C, 0x2C, 0x2E, 0x96, 0x43, 0xF0, 0x0E, 0x6A, 0x2A, 0xA6, 0x80, 0x99, 0xF8, 0xEF, 0x55,
-    0x92, 0xF8, 0x70, 0xD2, 0xB0, 0x88, 0xB3, 0xB0, 0x63, 0xFF, 0x7A, 0xE8, 0xAF, 0x6C, 0x9E, 0x25,
-    0x0C, 0x64, 0x89, 0xF4, 0x1A, 0x68, 0x9D, 0xE7, 0xC6, 0xEB, 0xE5, 0xA7, 0xB9, 0xC8, 0xFB, 0x58,
-    0xA2, 0x66, 0x8B, 0x3B, 0xEE, 0xE6, 0x41, 0x44, 0xAF, 0x21, 0x20, 0xA7, 0xDD, 0x98, 0x40, 0x2A,
-    0x95, 0x91, 0x72, 0x10, 0xEA, 0xB9, 0xD5, 0x3E, 0xBF, 0x34, 0xC1, 0xB6, 0xF6, 0xCB, 0x67, 0x9B,
-    0x29, 0x28, 0x28, 0x65, 0xCE, 0xD2, 0x27, 0x53, 0xD3, 0x25, 0xA9, 0xB3, 0x10, 0x15, 0x13, 0xBA,
-    0x2B, 0xAC, 0xED, 0x8C, 0x4E, 0xCF, 0xAE, 0xB1, 0x6F, 0x93, 0x49, 0x4C, 0x18, 0x02, 0x6E, 0x9E,
-    0x06, 0x5C, 0x70, 0x7A, 0x38, 0x7D, 0x49, 0xF7, 0x5C, 0xE0, 0xDF, 0x17, 0x2B, 0xAC, 0xFE, 0x6D,
-    0x02, 0xCE, 0x9C, 0xB5, 0x03, 0xC6, 0xD2, 0x65, 0x63, 0xA7, 0x52, 0x32, 0xF4, 0x53, 0xA0, 0x50,
-    0xD4, 0x19, 0x0E, 0xB3, 0x55, 0x92, 0xDE, 0x80, 0x2B, 0x82, 0x44, 0xBC, 0x90, 0x23, 0x9F, 0x39,
-    0x5B, 0x22, 0x2E, 0x9B, 0x09, 0x95, 0xB7, 0x70, 0x16, 0x5B, 0x17, 0x3C, 0xED, 0x10, 0xC0, 0xFE,
-    0x8C, 0x6B, 0xAD, 0xFA, 0xF8, 0xBE, 0x82, 0x5E, 0x2D, 0x4E, 0x89, 0xDB, 0x46, 0x94, 0x06, 0x85,
-    0xDF, 0xA1, 0x16, 0x45, 0x5D, 0x06, 0x0C, 0xF7, 0xC5, 0x56, 0x6A, 0x1E, 0x43, 0x23, 0x23, 0xCD,
-    0x2E, 0x06, 0x66, 0xF0, 0x6D, 0x7A, 0x9B, 0x06, 0x47, 0x06, 0x92, 0x9D, 0x8C, 0x9D, 0xE2, 0x80,
-    0xF4, 0xA8, 0xD1, 0x6E, 0xB9, 0x79, 0x01, 0x45, 0x5C, 0x2A, 0xC0, 0xCE, 0x73, 0x28, 0x9F, 0x0E,
-    0x2E, 0xBD, 0x7B, 0xBB, 0x0D, 0x0A, 0xAF, 0x93, 0x11, 0x56, 0x5E, 0x2B, 0xA3, 0x98, 0x0C, 0xD1,
-    0xA8, 0x95, 0x5F, 0x4F, 0x61, 0x8E, 0xAE, 0x98, 0xA8, 0x38, 0x5A, 0x97, 0xE2, 0x9B, 0xBB, 0x84,
-    0xA8, 0x96, 0xB4, 0x21, 0x1E, 0x91, 0xD7, 0xF4, 0x46, 0xEB, 0xEC, 0xC2, 0xCC, 0xF3, 0xAE, 0x70,
-    0xBB, 0x82, 0x45, 0x6A, 0x1F, 0x9A, 0x2F, 0x98, 0x90, 0x76, 0x9F, 0x04, 0xB8, 0x03, 0x3F, 0x9E,
-    0x23, 0x3C, 0x2C, 0x2E, 0xB6, 0xE0, 0x75, 0x1F, 0x51, 0x6A, 0x0C, 0x09, 0xF5, 0x42, 0x3C, 0x98,
-    0x22, 0xD8, 0xB7, 0xDC, 0x0E, 0xA3, 0xB9, 0xC2, 0x6E, 0x21, 0xE1, 0x9B, 0xAC, 0xDD, 0x66, 0x90,
-    0x94, 0x95, 0x69, 0xA2, 0xB8, 0x76, 0xAC, 0x0D, 0xAF, 0x30, 0x07, 0x2F, 0x85, 0xC1, 0xEE, 0x8E,
-    0x6A, 0x51, 0xB7, 0x14, 0x4C, 0x5B, 0xDE, 0x40, 0xD2, 0x27, 0x10, 0x8B, 0x3E, 0x43, 0xF5, 0xBC,
-    0xFD, 0xB2, 0x4B, 0xA3, 0xE4, 0x7D, 0xC9, 0x6E, 0x2B, 0xFA, 0xF0, 0x9E, 0x8A, 0xBE, 0x34, 0xF8,
-    0xEC, 0x78, 0x98, 0xB4, 0x1F, 0x0B, 0x73, 0x99, 0xE5, 0x5C, 0xBB, 0x0B, 0x21, 0xCF, 0xC2, 0x0C,
-    0xEF, 0x20, 0x6D, 0x1C, 0x64, 0x3C, 0xA4, 0x31, 0x1F, 0x58, 0x83, 0x77, 0x58, 0xA7, 0xE0, 0x04,
-    0xA3, 0x61, 0xBF, 0x94, 0xB1, 0xB0, 0x19, 0x66, 0x0C, 0xCD, 0xA8, 0x0D, 0x73, 0x8E, 0x40, 0xF5,
-    0xFF, 0xA0, 0x74, 0x75, 0x1C, 0xC2, 0x9D, 0x05, 0xD9, 0xEB, 0x58, 0x44, 0x75, 0xA3, 0x7B, 0xB4,
-    0x3C, 0x0C, 0x60, 0x23, 0x17, 0x44, 0xA3, 0x0D, 0xFC, 0x8F, 0xFE, 0x99, 0xB0, 0x8F, 0xB2, 0xF5,
-    0xA0, 0x78, 0xFA, 0xC0, 0x5A, 0xD0, 0x2A, 0xEC, 0x82, 0x49, 0x28, 0x74, 0x3D, 0x0B, 0xA4, 0x7B,
-    0xEC, 0xC1, 0xD6, 0x4C, 0x82, 0x70, 0xDB, 0x7D, 0x7B, 0xAF, 0x77, 0xB5, 0xFE, 0xE2, 0x1B, 0x8E,
-    0xB6, 0x70, 0x73, 0xB3, 0x93, 0x41, 0xF3, 0x23, 0xDE, 0xD9, 0x44, 0x92, 0xCB, 0x90, 0x54, 0xE2,
-    0xEC, 0x47, 0xCE, 0x5C, 0xF7, 0x54, 0xE2, 0xAE, 0xEF, 0xFB, 0xAC, 0xA5, 0x6C, 0x42, 0xFA, 0xFA,
-    0xCF, 0xEB, 0x37, 0xE3, 0x1C, 0xEE, 0xC7, 0x77, 0xEE, 0xC1, 0x7A, 0x6A, 0x1B, 0x18, 0xB9, 0x52,
-    0x80, 0x48, 0x0E, 0xDB, 0x4E, 0x76, 0x93, 0x88, 0x20, 0x7C, 0x17, 0x71, 0x8A, 0x5B, 0x2D, 0xB5,
-    0xC9, 0x11, 0x6B, 0x76, 0xBF, 0x1C, 0x6B, 0x90, 0x47, 0x23, 0xC2, 0xB4, 0x86, 0x73, 0x9E, 0x39,
-    0x56, 0x09, 0x9C, 0x4D, 0x2D, 0xCC, 0x41, 0xB1, 0xAE, 0xD9, 0xC4, 0x35, 0x4D, 0x82, 0xDF, 0x5B,
-    0x82, 0x63, 0xE2, 0xF4, 0xB2, 0xED, 0x75, 0xEF, 0x5B, 0xF4, 0x87, 0xEB, 0x34, 0x37, 0xA7, 0xB8,
-    0xE5, 0x7C, 0x89, 0xC7, 0x37, 0xF2, 0x1B, 0xDF, 0x65, 0xEB, 0x95, 0x2C, 0x55, 0x3A, 0x23, 0xD7,
-    0x06, 0xA8, 0xB8, 0xAD, 0x2E, 0x0C, 0x2D, 0x2A, 0x9E, 0x91, 0x36, 0xEC, 0x0E, 0x79, 0x80, 0x8B,
-    0x58, 0xFF, 0x6D, 0xDD, 0x84, 0xE4, 0x62, 0xBE, 0xCC, 0xB9, 0xDC, 0x03, 0x59, 0xD9, 0x96, 0xFB,
-    0xFC, 0xDE, 0x6D, 0xB9, 0xE3, 0x32, 0x00, 0x14, 0xEE, 0x67, 0x33, 0x39, 0x0F, 0x2D, 0xF3, 0x38,
-    0xC0, 0x70, 0x10, 0xE2, 0xF4, 0x21, 0x0F, 0x7E, 0x08, 0xE4, 0xEA, 0x43, 0x4F, 0xAE, 0x73, 0x72,
-    0x6E, 0xBF, 0x35, 0x46, 0x60, 0x42, 0xD0, 0xA0, 0x04, 0x2B, 0x40, 0x34, 0x4C, 0x9C, 0xF2, 0xED,
-    0xA4, 0xEB, 0x5A, 0x5E, 0xE7, 0x5E, 0xBA, 0x79, 0x61, 0x80, 0x43, 0x91, 0x81, 0x43, 0xF7, 0xED,
-    0x4B, 0xB4, 0xCB, 0x56, 0x92, 0xD3, 0x6F, 0x35, 0xAE, 0x6E, 0x37, 0xE6, 0x66, 0xF7, 0x21, 0x10,
-    0xCD, 0x33, 0x3A, 0x86, 0x2A, 0xFC, 0x3B, 0xFC, 0xBE, 0x61, 0x93, 0xE0, 0x8F, 0x58, 0xF1, 0xC6,
-    0xE0, 0xFA, 0x2A, 0x02, 0xFC, 0xA5, 0xAD, 0x7B, 0xFA, 0x93, 0x43, 0x23, 0x35, 0x25, 0x55, 0x76,
-    0xFD, 0x72, 0x44, 0xB4, 0x50, 0x55, 0x3C, 0x22, 0xE5, 0xB7, 0x72, 0x06, 0x02, 0x85, 0xF1, 0x1B,
-    0x1C, 0xC7, 0x2E, 0xDF, 0xC2, 0x40, 0x78, 0xA7, 0x6F, 0xB1, 0x3E, 0x7E, 0xB1, 0xFA, 0x56, 0xCA,
-    0x06, 0xFD, 0xEB, 0xEF, 0x01, 0xCD, 0x01, 0x29, 0x65, 0xFD, 0x77, 0xBB, 0x10, 0x62, 0xFD, 0x66,
-    0x7A, 0x6F, 0x13, 0x21, 0xE9, 0xBB, 0x0F, 0x53, 0xFD, 0x97, 0xB4, 0x12, 0xB5, 0x5C, 0xF5, 0x0F,
-    0xC3, 0xDB, 0x37, 0xE6, 0xFF, 0x0A, 0x0B, 0x2D, 0xE4, 0xDC, 0xE2, 0xC2, 0x43, 0xF3, 0xF6, 0xFF,
-    0xA8, 0xD5, 0xEB, 0xDA, 0xA8, 0x2B, 0xEF, 0xAF, 0x56, 0x0D, 0x18, 0x67, 0x10, 0x51, 0x83, 0xF6,
-    0xEB, 0xA0, 0x8B, 0xE0, 0xED, 0xE6, 0xF3, 0x74, 0x08, 0x24, 0xCC, 0xAF, 0x31, 0x49, 0xB7, 0x78,
-    0xCD, 0x2B, 0x23, 0xD1, 0x80, 0xAD, 0x20, 0x5B, 0x21, 0x4B, 0x98, 0xF1, 0x0C, 0x0C, 0x78, 0x72,
-    0x6A, 0x3D, 0x78, 0x32, 0xB6, 0xC3, 0x1B, 0x8D, 0x70, 0x91, 0x68, 0xD7, 0xC8, 0x6E, 0xCE, 0xE8,
-    0x91, 0x12, 0x1E, 0xA2, 0x91, 0x84, 0x47, 0x84, 0x28, 0x1C, 0xBE, 0xFA, 0x5D, 0x50, 0x27, 0x3D,
-    0x05, 0x54, 0xBD, 0x01, 0x16, 0x6A, 0xF9, 0x16, 0x2A, 0xF9, 0x33, 0x4E, 0xDF, 0x3A, 0xFE, 0x21,
-    0xE6, 0x9A, 0x41, 0x44, 0xA2, 0xF9, 0xE5, 0xF6, 0x44, 0xAA, 0x48, 0x7E, 0x28, 0x75, 0x46, 0xD0,
-    0xE3, 0xD4, 0x1E, 0x97, 0xDB, 0x76, 0x3F, 0x4D, 0x93, 0xEE, 0x0D, 0x09, 0xFB, 0x93, 0x7E, 0x0E,
-    0xFB, 0x0F, 0x21, 0x2B, 0x07, 0xBB, 0x2B, 0xC0, 0x43, 0x79, 0x86, 0xFF, 0xDC, 0xF2, 0x2F, 0xB5,
-    0xEE, 0x23, 0x26, 0x3D, 0xFF, 0xBD, 0xB8, 0xDC, 0xFF, 0x63, 0x73, 0xB8, 0x17, 0x17, 0x7A, 0x1B,
-    0x51, 0xDC, 0x2A, 0x18, 0x36, 0x97, 0x66, 0x10, 0x1E, 0xA9, 0x2E, 0x84, 0x4B, 0x22, 0x80, 0xF8,
-    0x44, 0x83, 0xDC, 0x0E, 0xB7, 0x4B, 0x33, 0xD4, 0xE3, 0x58, 0x65, 0x5F, 0x43, 0x3C, 0x1E, 0x79,
-    0xB2, 0x3F, 0x64, 0x46, 0xBE, 0xCE, 0x23, 0x3C, 0x8C, 0x13, 0xED, 0xCA, 0x86, 0xDE, 0x89, 0x19,
-    0x8C, 0x47, 0x33, 0xFF, 0x18, 0x58, 0x83, 0xE7, 0x4E, 0x3D, 0x82, 0xF1, 0x33, 0x8F, 0xCF, 0x60,
-    0xB2, 0x4E, 0x2A, 0x3C, 0x21, 0x1B, 0xFA, 0xF8, 0xFB, 0x5B, 0x7F, 0xC4, 0x88, 0xFE, 0x36, 0x3B,
-    0xD4, 0xE9, 0x32, 0x4D, 0x9F, 0x9C, 0x0D, 0xE5, 0xDF, 0x85, 0xF5, 0xA9, 0xF8, 0xCF, 0x61, 0x7E,
-    0x17, 0xE9, 0xF6, 0xC7, 0x19, 0x4B, 0xD5, 0xC7, 0x2B, 0xB2, 0x93, 0x22, 0x70, 0xC5, 0xCC, 0x9D,
-    0x15, 0x8F, 0xA1, 0x72, 0x4D, 0x57, 0x3C, 0xEA, 0xD9, 0x17, 0x0E, 0x7B, 0x46, 0x86, 0xE5, 0xC9,
-    0xAB, 0x91, 0x4B, 0x19, 0x42, 0x6B, 0x45, 0x73, 0x50, 0x8B, 0xC7, 0xF3, 0x8A, 0xD8, 0x2A, 0x40,
-    0x87, 0x97, 0x30, 0x60, 0x98, 0x62, 0xF8, 0x64, 0xB9, 0xA1, 0xCA, 0x03, 0x6C, 0x7A, 0xD4, 0x0B,
-    0x25, 0xEC, 0x1C, 0xAB, 0x03, 0x4B, 0xCE, 0xE9, 0x86, 0xDA, 0x53, 0xCE, 0x01, 0xA7, 0x44, 0xDF,
-    0x43, 0xBC, 0x7D, 0xAD, 0x90, 0x80, 0xD7, 0x77, 0x8A, 0x81, 0x8D, 0x27, 0x52, 0xE7, 0x0A, 0x65,
-    0x75, 0x2A, 0xD5, 0x5A, 0x98, 0xB2, 0x94, 0xA6, 0xB0, 0x2C, 0xB7, 0x09, 0xF4, 0xE0, 0x2D, 0x3C,
-    0x38, 0xC6, 0x1D, 0x09, 0x0F, 0x37, 0xB9, 0x67, 0x8E, 0x6C, 0x47, 0x71, 0xC3, 0xEE, 0x93, 0x5C,
-    0xBA, 0xF7, 0x2A, 0x3D, 0x8F, 0x7A, 0x22, 0xC6, 0x63, 0x68, 0xE7, 0x31, 0x59, 0xD3, 0x6C, 0x65,
-    0xF3, 0xC7, 0x23, 0x06, 0x60, 0x32, 0x34, 0xE7, 0x31, 0x1F, 0xD9, 0x70, 0x0F, 0x3C, 0x8B, 0x6B,
-    0x12, 0xD1, 0xDC, 0x7C, 0x6B, 0x27, 0x71, 0xA6, 0xBD, 0x8C, 0x3D, 0x1E, 0x0F, 0x56, 0x60, 0x3B,
-    0x38, 0x32, 0xBB, 0xA2, 0xA8, 0x24, 0x4B, 0xF6, 0x0B, 0x90, 0xD9, 0xA2, 0xE7, 0x51, 0xD3, 0x49,
-    0x80, 0xA2, 0xFA, 0x4E, 0xCE, 0xD3, 0x85, 0xFB, 0x15, 0x3B, 0xF4, 0xA3, 0x09, 0xD9, 0x8C, 0x42,
-    0x9A, 0x32, 0x7C, 0x0E, 0x46, 0x9F, 0xF8, 0x39, 0x78, 0x8D, 0xBC, 0x72, 0x23, 0xC8, 0xFD, 0x9F,
-    0x55, 0xA1, 0x57, 0x38, 0x55, 0xE3, 0xE1, 0xAD, 0xC9, 0x06, 0x00, 0x9A, 0x44, 0xE7, 0xF9, 0x8A,
-    0xF7, 0xAE, 0x84, 0xA8, 0x58, 0xBF, 0xCC, 0xBD, 0x8F, 0x90, 0x82, 0x0A, 0xE2, 0x86, 0xB0, 0xD2,
-    0x92, 0xA5, 0x26, 0x41, 0xD8, 0xCB, 0xAD, 0x87, 0x2E, 0xA7, 0xD9, 0x10, 0xE2, 0x2E, 0xB9, 0x9E,
-    0x90, 0x31, 0x48, 0x7F, 0xB9, 0x17, 0xE4, 0x66, 0xCE, 0x15, 0xF9, 0xE1, 0x04, 0xB0, 0x33, 0xFC,
-    0x71, 0x1E, 0x00, 0x02, 0x8E, 0xE4, 0x4E, 0x9A, 0x78, 0xC5, 0xF9, 0xEB, 0x7E, 0x31, 0xF2, 0x7E,
-    0x99, 0x22, 0xE8, 0x4C, 0xF6, 0xC2, 0x74, 0x14, 0x3E, 0xFF, 0x6A, 0xE5, 0xBD, 0x57, 0xED, 0x8D,
-    0x64, 0x34, 0xF2, 0x5F, 0xCF, 0xBD, 0x0F, 0xF3, 0xCB, 0x8D, 0x8C, 0xAE, 0xFB, 0xFF, 0x22, 0x60,
-    0xE2, 0x1F, 0x20, 0x65, 0x09, 0x50, 0xE2, 0x31, 0xAE, 0x40, 0xAB, 0x7A, 0x2C, 0x83, 0xCA, 0x20,
-    0xFC, 0x62, 0x16, 0x8F, 0xA1, 0xD9, 0x3D, 0x40, 0xFE, 0x4D, 0xC3, 0x12, 0x38, 0x40, 0xE9, 0xE8,
-    0x34, 0xDC, 0xA2, 0x88, 0x00, 0x29, 0xC2, 0x94, 0xFD, 0xF1, 0x44, 0xCF, 0x48, 0xFB, 0x39, 0x12,
-    0xDA, 0xFB, 0x08, 0x56, 0xFF, 0x03, 0xF4, 0x86, 0xE0, 0x40, 0xC0, 0x79, 0xDF, 0x6C, 0x59, 0x9A,
-    0x8B, 0xF5, 0x99, 0xE9, 0x0D, 0xEA, 0xDC, 0x3C, 0x8C, 0xCF, 0xA3, 0xC5, 0x32, 0x3E, 0x6F, 0x65,
-    0x1D, 0x12, 0xDF, 0x53, 0x22, 0x3F, 0xD5, 0x8D, 0x21, 0x6D, 0x7E, 0x79, 0xFC, 0x0F, 0xC8, 0xE6,
-    0xBA, 0xA5, 0x66, 0xFD, 0x51, 0x8B, 0x42, 0x22, 0x2A, 0xCE, 0xB8, 0x41, 0x2C, 0xF1, 0xBF, 0x24,
-    0xF5, 0x11, 0x1B, 0x8A, 0x7A, 0x82, 0xA5, 0xB0, 0x67, 0x3D, 0x74, 0xDF, 0x8B, 0x39, 0x5E, 0x81,
-    0x86, 0x1E, 0xD7, 0xE5, 0xED, 0x79, 0x65, 0xC1, 0x9F, 0xA9, 0x2A, 0xC7, 0x6C, 0x89, 0x83, 0xC2,
-    0x93, 0xEE, 0x6A, 0x45, 0x77, 0x0C, 0xA2, 0xEB, 0x32, 0x57, 0xAD, 0xF7, 0x08, 0x59, 0x17, 0x49,
-    0x1F, 0x56, 0x3B, 0x84, 0x02, 0xA0, 0x93, 0xC2, 0xBD, 0x76, 0x4D, 0x4F, 0x18, 0xA7, 0x86, 0x65,
-    0xA7, 0x5D, 0x39, 0x7F, 0xAC, 0x2E, 0xB3, 0xBD, 0x7A, 0x94, 0x77, 0xB1, 0x32, 0x74, 0x79, 0xAE,
-    0x17, 0x34, 0xDD, 0x83, 0xAD, 0x2D, 0xCE, 0x57, 0x79, 0xDA, 0x34, 0x50, 0x7C, 0xC6, 0xD3, 0x20,
-    0xAD, 0x61, 0x67, 0x6F, 0xA8, 0xE7, 0x9E, 0xBA, 0x76, 0x55, 0x3A, 0x9E, 0xAD, 0xDC, 0x31, 0x07,
-    0xC9, 0xED, 0x2E, 0x5D, 0xA8, 0x1D, 0x0C, 0x65, 0x7F, 0x6C, 0x68, 0x25, 0x46, 0x30, 0x02, 0x26,
-    0x4C, 0xEB, 0x6B, 0x13, 0xE2, 0x01, 0x47, 0x8C, 0x62, 0x4C, 0x0A, 0xDA, 0x0B, 0xF9, 0xC6, 0xB5,
-    0xB7, 0x56, 0x59, 0x8F, 0x8E, 0x9C, 0xA3, 0xBE, 0x9B, 0x75, 0x9E, 0x16, 0xB9, 0x57, 0x4A, 0x2A,
-    0x2C, 0x7E, 0x73, 0x6B, 0x53, 0x65, 0xA1, 0x50, 0x26, 0x45, 0x90, 0x39, 0x36, 0x8E, 0x86, 0x0D,
-    0xB7, 0xBF, 0xBD, 0xB6, 0x4B, 0x88, 0xBD, 0xF5, 0x52, 0x31, 0x9C, 0x89, 0x37, 0x3D, 0x82, 0xFD,
-    0xA1, 0xC2, 0x68, 0x95, 0x4E, 0x7F, 0x58, 0xBC, 0x6B, 0x8D, 0x1C, 0xF7, 0x1E, 0x4A, 0x0E, 0x56,
-    0x0E, 0x25, 0x1F, 0xB3, 0x6D, 0xB8, 0xFB, 0xCC, 0xA6, 0xF8, 0xC6, 0xD4, 0x04, 0xAC, 0xC5, 0x80,
-    0xA6, 0x1F, 0xD1, 0x36, 0x67, 0xCD, 0xFF, 0x3B, 0xE2, 0x74, 0xD5, 0xD1, 0x5E, 0x74, 0xF0, 0xA0,
-    0xDD, 0xE2, 0x87, 0xDB, 0x42, 0x26, 0xFE, 0x3D, 0x7A, 0x3C, 0x3E, 0x33, 0xA6, 0xA5, 0x00, 0x3C,
-    0x50, 0x26, 0xFF, 0x07, 0x8D, 0x54, 0x4F, 0x68, 0x14, 0x57, 0x18, 0xFF, 0xDE, 0xBC, 0x8D, 0xA3,
-    0x3B, 0x49, 0x66, 0x85, 0xB5, 0x58, 0xDD, 0x64, 0xA4, 0x78, 0x58, 0x42, 0x92, 0x59, 0xE8, 0x1E,
-    0x56, 0x98, 0xCD, 0x4C, 0xCD, 0xC1, 0xA2, 0x2D, 0xAC, 0xE8, 0xDA, 0xA3, 0x81, 0x7A, 0x92, 0x16,
-    0xF7, 0xB0, 0x87, 0x08, 0x6B, 0x76, 0x34, 0x15, 0x0F, 0x85, 0x76, 0x29, 0x85, 0xD2, 0x3F, 0xB4,
-    0x16, 0x3C, 0xC4, 0x91, 0xD2, 0x1C, 0x3C, 0xA4, 0xB0, 0x71, 0x9F, 0x49, 0x55, 0xD0, 0x1E, 0x5E,
-    0xEC, 0x21, 0xA0, 0xA5, 0x4E, 0xD1, 0x94, 0x6A, 0x0F, 0x7D, 0x2D, 0x03, 0x4E, 0xEA, 0x66, 0x5F,
-    0xBF, 0xB7, 0x6B, 0xB5, 0xDE, 0xFA, 0xD8, 0x99, 0x9D, 0x79, 0xDF, 0x9B, 0xEF, 0x7D, 0xDF, 0xEF,
-    0xCF, 0x4B, 0x53, 0x61, 0xC1, 0x02, 0xE5, 0x09, 0x28, 0x99, 0x6C, 0x51, 0xE7, 0x0E, 0x78, 0x00,
-    0x69, 0x30, 0x39, 0x95, 0x10, 0x2F, 0x14, 0xE9, 0x0A, 0x24, 0x88, 0x97, 0x30, 0xE2, 0x8C, 0x25,
-    0xDB, 0x8E, 0x29, 0x52, 0xE0, 0xD5, 0xA5, 0x2B, 0xAF, 0x95, 0x4B, 0x23, 0x41, 0x60, 0x49, 0xB9,
-    0x14, 0x04, 0x8D, 0x5D, 0xE4, 0x4B, 0x72, 0x5F, 0x8A, 0xBA, 0x20, 0x1E, 0xA4, 0x9B, 0xED, 0x63,
-    0x40, 0x4C, 0xBA, 0xCA, 0xA2, 0x46, 0xDA, 0x3D, 0x73, 0x85, 0x84, 0xE3, 0xEE, 0x2C, 0xCB, 0x83,
-    0xD1, 0x78, 0xF2, 0xE3, 0xE4, 0x4F, 0x46, 0x61, 0xBA, 0xCE, 0x52, 0x00, 0xA5, 0x34, 0x0D, 0x63,
-    0x73, 0x36, 0x1C, 0x37, 0xFC, 0xE9, 0x61, 0x48, 0xA5, 0x20, 0x05, 0x93, 0xAC, 0x66, 0xD9, 0x20,
-    0x99, 0x2E, 0x70, 0x77, 0xA0, 0x3C, 0x72, 0x2C, 0x63, 0x96, 0x8B, 0x2C, 0x00, 0xE8, 0xCB, 0xB7,
-    0x43, 0x11, 0xD7, 0x8A, 0x76, 0x72, 0x93, 0x97, 0xEE, 0x83, 0x78, 0x82, 0x88, 0x9A, 0x16, 0x2E,
-    0x50, 0x26, 0x08, 0x16, 0x3B, 0x05, 0x96, 0x47, 0x22, 0x6D, 0xCB, 0xF6, 0x02, 0x5D, 0x96, 0x91,
-    0xB9, 0x01, 0x09, 0x20, 0x17, 0x74, 0x79, 0xEE, 0xD1, 0x5F, 0x6C, 0xC8, 0x23, 0x00, 0x61, 0x51,
-    0x67, 0xB1, 0x4D, 0xC3, 0xC5, 0x3E, 0x8F, 0x86, 0xA7, 0x4C, 0x16, 0xD9, 0x94, 0x4F, 0x13, 0xA8,
-    0x9D, 0x2A, 0x16, 0x8B, 0x63, 0x43, 0x89, 0xFF, 0xCE, 0xA5, 0x7B, 0x58, 0xB0, 0x04, 0x1C, 0x36,
-    0xF8, 0x0C, 0x0D, 0x8B, 0x0A, 0x0B, 0x30, 0x5F, 0xFA, 0x7D, 0xE3, 0x2D, 0xE6, 0x60, 0x73, 0x30,
-    0xAD, 0xAD, 0x99, 0x1B, 0xC5, 0x12, 0xEE, 0x8B, 0x83, 0xCA, 0xF6, 0xC8, 0x25, 0x06, 0x05, 0xD0,
-    0x7D, 0xB8, 0x0C, 0x26, 0x80, 0x80, 0x2D, 0x6A, 0xBE, 0x0D, 0xB1, 0x26, 0x0C, 0xEE, 0x7A, 0xBB,
-    0x41, 0x3F, 0x30, 0xEB, 0x73, 0x47, 0xF7, 0x80, 0xF8, 0x26, 0x38, 0x3B, 0xD7, 0x5B, 0x11, 0xC0,
-    0xC8, 0x9C, 0xDB, 0xD6, 0x99, 0xEE, 0x1B, 0x2A, 0x37, 0x18, 0xE0, 0x58, 0xF2, 0xC4, 0x83, 0x31,
-    0x6C, 0xE3, 0x78, 0x20, 0xC3, 0x6E, 0xDE, 0xD0, 0xF4, 0x6A, 0x44, 0x18, 0x67, 0x17, 0x6D, 0x31,
-    0xA3, 0x5E, 0xB1, 0x81, 0xA6, 0xE1, 0x2F, 0xEE, 0x6B, 0xDB, 0x0C, 0x26, 0xDC, 0x22, 0x12, 0x62,
-    0xEE, 0xBD, 0xCF, 0xE3, 0xD2, 0x76, 0x04, 0x75, 0x95, 0x7E, 0x61, 0x4E, 0x4F, 0xB7, 0x14, 0xA8,
-    0x74, 0x45, 0x88, 0x6A, 0x1A, 0xA8, 0x27, 0x4C, 0x36, 0xAE, 0x3D, 0x6A, 0x76, 0x00, 0x11, 0x72,
-    0x28, 0x2B, 0xEE, 0x6D, 0x63, 0xBD, 0x5A, 0x18, 0x15, 0x2D, 0x7D, 0x29, 0x8C, 0xB2, 0x30, 0x12,
-    0xCC, 0xB9, 0xB2, 0x3D, 0x0D, 0xCE, 0x65, 0x70, 0x04, 0x4C, 0x97, 0x10, 0x7D, 0x80, 0x8A, 0x33,
-    0x78, 0x72, 0xB1, 0x66, 0xDF, 0x13, 0xF8, 0x9C, 0x82, 0x43, 0xBC, 0x68, 0x5A, 0x5E, 0x8B, 0xD3,
-    0x08, 0xB6, 0x21, 0x5D, 0x60, 0x33, 0x7D, 0x83, 0xFC, 0x29, 0x9A, 0xFA, 0x59, 0x48, 0x37, 0x34,
-    0x87, 0xDE, 0x92, 0xA1, 0x0C, 0x11, 0x11, 0x72, 0x81, 0xCA, 0xE5, 0xBF, 0xE3, 0xD0, 0x44, 0x5D,
-    0x10, 0x2F, 0x5D, 0xE7, 0xF7, 0xFF, 0x90, 0x43, 0x46, 0x94, 0x22, 0xE0, 0xCA, 0xAF, 0xE4, 0x4A,
-    0xB9, 0xB4, 0xAD, 0x5C, 0x3E, 0x2A, 0xE5, 0xAF, 0x41, 0x70, 0x1E, 0xF3, 0x6A, 0x12, 0x21, 0x0B,
-    0x02, 0xD5, 0x38, 0xCE, 0xEB, 0x52, 0x8A, 0x72, 0xB9, 0x0C, 0x28, 0x2F, 0x33, 0x1A, 0xB5, 0x65,
-    0x5C, 0xB0, 0x50, 0x5E, 0x58, 0xDD, 0xC5, 0x96, 0xEC, 0x1C, 0x0F, 0xE6, 0x70, 0x49, 0xB9, 0xDC,
-    0x92, 0x52, 0x76, 0x02, 0x1C, 0x17, 0x15, 0x34, 0x4D, 0xA8, 0xFB, 0x36, 0xB7, 0x39, 0x0D, 0x91,
-    0xE5, 0x7F, 0xC7, 0x38, 0x5E, 0x0E, 0x5E, 0x31, 0x00, 0x11, 0x4A, 0x3A, 0xA8, 0x18, 0x06, 0x8A,
-    0x90, 0x67, 0xA1, 0xE8, 0x79, 0xC8, 0xF8, 0xFF, 0xA1, 0x63, 0x5D, 0x82, 0x88, 0x18, 0x35, 0x8C,
-    0xF7, 0x7D, 0xC8, 0xC2, 0x76, 0x07, 0x46, 0x11, 0xB5, 0xEF, 0xCA, 0x35, 0x29, 0xE3, 0x72, 0xB9,
-    0x84, 0x51, 0xC4, 0x71, 0x4F, 0xB9, 0x56, 0x85, 0xC2, 0x3C, 0x54, 0x5B, 0x52, 0xF4, 0xDA, 0x34,
-    0x1F, 0xC7, 0xC5, 0x99, 0x77, 0xE7, 0x0B, 0x43, 0xF8, 0x9C, 0x80, 0xB1, 0x9A, 0x85, 0x84, 0xB8,
-    0xA2, 0x2A, 0xBA, 0xE9, 0xF8, 0x29, 0xCA, 0x0D, 0xA5, 0x06, 0x4D, 0x4C, 0xF4, 0xEA, 0x57, 0xA8,
-    0xEC, 0x08, 0x02, 0xFF, 0x19, 0x2A, 0x11, 0xFE, 0x3D, 0xD5, 0xA2, 0xC6, 0x13, 0xA4, 0x64, 0xF9,
-    0x6D, 0xC3, 0x5F, 0x50, 0x68, 0xBF, 0x68, 0xC4, 0x11, 0x8A, 0x42, 0x72, 0x54, 0xC5, 0x3B, 0xBC,
-    0x54, 0x9B, 0xAE, 0xDE, 0xBD, 0x37, 0x33, 0xB1, 0x5B, 0x4C, 0x21, 0xD9, 0x2F, 0x9B, 0x93, 0xBC,
-    0x63, 0xFB, 0x5D, 0x91, 0xCA, 0xF6, 0x44, 0x70, 0xE9, 0x9C, 0x0F, 0xD5, 0xCB, 0x60, 0xEC, 0x07,
-    0x50, 0x05, 0x92, 0x17, 0x76, 0xA4, 0x4F, 0x77, 0x54, 0x46, 0x5B, 0x11, 0xD1, 0x42, 0xAD, 0x68,
-    0xA1, 0xD1, 0xB6, 0x1D, 0x94, 0xD7, 0xBF, 0x45, 0xC1, 0x73, 0x53, 0x35, 0xD1, 0x97, 0x3F, 0x28,
-    0x97, 0x3F, 0x6C, 0xB5, 0x2B, 0x92, 0xEF, 0xEB, 0x21, 0x3F, 0x08, 0x60, 0x03, 0x0C, 0xC1, 0xA6,
-    0x46, 0xC6, 0xDA, 0xA8, 0x15, 0x5B, 0x51, 0xD5, 0xE0, 0x28, 0x62, 0x85, 0x67, 0xB7, 0x51, 0xED,
-    0xC1, 0x80, 0x29, 0x9B, 0x19, 0x43, 0xBD, 0x18, 0x8D, 0xBC, 0xBD, 0x21, 0xAA, 0x36, 0x47, 0x5D,
-    0xC0, 0x69, 0x6F, 0xD8, 0x98, 0x94, 0xE8, 0xCF, 0x58, 0xA7, 0x3D, 0x00, 0x2A, 0xD6, 0xD2, 0xBA,
-    0x49, 0xC2, 0x31, 0xA8, 0x33, 0x97, 0xB9, 0xAB, 0x6D, 0xDA, 0xA6, 0x1B, 0x15, 0x15, 0x58, 0x55,
-    0xD2, 0x1B, 0x98, 0x82, 0x9B, 0x39, 0x68, 0xC0, 0x7B, 0x64, 0x17, 0x40, 0x3F, 0xE0, 0x37, 0x9B,
-    0x00, 0xFA, 0x60, 0x0A, 0xF7, 0x3A, 0xFF, 0x89, 0x5A, 0x35, 0x50, 0x41, 0xEE, 0x72, 0xAB, 0x58,
-    0x16, 0x19, 0xA8, 0xE0, 0x6C, 0x89, 0xE3, 0x82, 0x24, 0xC0, 0x66, 0xD0, 0x30, 0xFA, 0x3D, 0xC9,
-    0xC1, 0x2E, 0x72, 0x33, 0x0F, 0xE7, 0xBA, 0xC9, 0x7A, 0x79, 0xE7, 0xB4, 0x39, 0xED, 0x9B, 0x3A,
-    0xAB, 0x73, 0x97, 0x43, 0xC1, 0x08, 0x5D, 0x4B, 0xBE, 0xAE, 0xBC, 0x7A, 0xBA, 0xE7, 0x55, 0xA5,
-    0xE9, 0x47, 0xEB, 0x7C, 0x70, 0xEB, 0x2F, 0xE8, 0x65, 0x17, 0x94, 0xD9, 0x3F, 0xA2, 0x1D, 0x5D,
-    0xB8, 0xFC, 0xB1, 0x82, 0xAC, 0xB4, 0xE8, 0x4E, 0x86, 0x3B, 0x79, 0xB2, 0x61, 0x84, 0x16, 0x6B,
-    0xCE, 0xEC, 0x87, 0x06, 0xF1, 0x16, 0x69, 0x68, 0xDD, 0x10, 0xE6, 0xAD, 0xEA, 0x95, 0xC1, 0x02,
-    0x1F, 0xCD, 0xC0, 0xE8, 0xB0, 0x61, 0x8E, 0x45, 0xDD, 0xD3, 0x90, 0xFA, 0x1F, 0x1C, 0x92, 0x67,
-    0xA2, 0x61, 0xF1, 0x8A, 0xD2, 0xBD, 0x7D, 0x37, 0x42, 0x9B, 0xCD, 0x17, 0x06, 0xF0, 0x77, 0xB2,
-    0x53, 0xB3, 0x56, 0x45, 0x5E, 0x87, 0xD6, 0x9D, 0xA6, 0xC6, 0x76, 0x8F, 0x2A, 0xD4, 0x6E, 0x2B,
-    0xBC, 0x62, 0x13, 0x3B, 0xBA, 0x02, 0xEE, 0xDA, 0x11, 0xE9, 0x41, 0x5D, 0x4A, 0xDC, 0x75, 0xC7,
-    0x45, 0x0F, 0x0F, 0x19, 0x84, 0xF2, 0xA8, 0xBA, 0x2D, 0x21, 0xCA, 0x16, 0xB3, 0x1F, 0x1E, 0x91,
-    0x3E, 0x72, 0xD9, 0xC1, 0xCE, 0x83, 0x8F, 0x41, 0xAD, 0x7C, 0x82, 0x76, 0x59, 0x53, 0xA6, 0x72,
-    0x91, 0x62, 0x7C, 0x6F, 0x23, 0xB1, 0x87, 0x41, 0x71, 0xEB, 0x49, 0xD9, 0x00, 0x67, 0xE2, 0x33,
-    0xD9, 0x69, 0x1D, 0xF0, 0xE0, 0x84, 0xE4, 0x58, 0x8D, 0x3A, 0xD2, 0xB4, 0xD6, 0x3A, 0xE6, 0x42,
-    0x41, 0x83, 0xFB, 0x00, 0x4E, 0xE0, 0xA9, 0x85, 0x2E, 0x53, 0xC2, 0x34, 0x3E, 0x55, 0x48, 0x35,
-    0xD4, 0x6D, 0x73, 0x97, 0x25, 0xA1, 0xAC, 0x28, 0xEF, 0x28, 0x2F, 0xC6, 0x5D, 0xD8, 0x7B, 0xE4,
-    0x11, 0x6F, 0xF0, 0x9D, 0x6C, 0x26, 0x97, 0xCD, 0xE5, 0x73, 0xF3, 0x36, 0xA2, 0x4B, 0x5E, 0xFB,
-    0x39, 0x77, 0x69, 0x21, 0x4C, 0x82, 0xEB, 0x43, 0x5F, 0x5F, 0xA2, 0x3F, 0x93, 0xCD, 0xE7, 0xA6,
-    0x88, 0xB7, 0xE7, 0xF6, 0xE9, 0x1F, 0xF4, 0x5C, 0x96, 0x5D, 0xC5, 0xF3, 0x39, 0x91, 0xE9, 0xCF,
-    0x66, 0xF2, 0xCF, 0xBF, 0x38, 0xB8, 0x86, 0x18, 0x4C, 0xE9, 0x78, 0xC8, 0xA0, 0x04, 0x21, 0x49,
-    0xDE, 0xEC, 0x65, 0xAC, 0x3C, 0x8D, 0x27, 0x21, 0x0F, 0xD7, 0xF4, 0xCF, 0x47, 0x33, 0x8D, 0xB7,
-    0xB5, 0x37, 0xFA, 0xA7, 0x72, 0x89, 0x52, 0x69, 0xCF, 0xC3, 0xAF, 0xAF, 0x5E, 0xBD, 0x99, 0x4C,
-    0xE6, 0xF2, 0x79, 0xC6, 0xAE, 0x6F, 0xA2, 0x90, 0x28, 0x3D, 0xCC, 0x68, 0x7E, 0x9E, 0x42, 0x05,
-    0x36, 0x1B, 0xFB, 0x1A, 0x2C, 0x97, 0x49, 0x2A, 0x57, 0xC3, 0x56, 0xFF, 0xC6, 0x40, 0x7F, 0xE5,
-    0x55, 0xF8, 0x4D, 0x63, 0xB8, 0xEF, 0x40, 0x56, 0x3F, 0x4F, 0x7D, 0x83, 0x65, 0x78, 0xA5, 0xF2,
-    0x0F, 0xD5, 0x7D, 0x4D, 0x8C, 0xE4, 0xE6, 0x79, 0xE6, 0x47, 0x52, 0x33, 0xB4, 0x45, 0xEC, 0x52,
-    0x0B, 0x48, 0x1B, 0x7B, 0x26, 0x31, 0x73, 0xF0, 0x41, 0x36, 0xEC, 0xE1, 0x25, 0x87, 0x2C, 0xD0,
-    0x55, 0xE4, 0x48, 0x58, 0xE8, 0xA0, 0x83, 0xC7, 0xC0, 0xB4, 0x05, 0xAC, 0x80, 0x1D, 0x1F, 0x72,
-    0x70, 0xBC, 0x3F, 0xBD, 0x07, 0x2F, 0xA0, 0x00, 0x55, 0x5D, 0x94, 0x06, 0x88, 0x0F, 0x39, 0x68,
-    0xB2, 0x1B, 0x7B, 0x8F, 0x99, 0x00, 0x73, 0xB0, 0x5B, 0xD8, 0x28, 0x07, 0x1D, 0x26, 0x4E, 0x75,
-    0x17, 0x3D, 0x03, 0xAC, 0x0E, 0x3A, 0x88, 0x92, 0xAC, 0xE8, 0xE0, 0x83, 0x68, 0x4B, 0x03, 0x2D,
-    0x22, 0xEC, 0x0E, 0x25, 0x71, 0x22, 0xB6, 0x86, 0x55, 0xDC, 0xE7, 0x79, 0x3E, 0xB2, 0xBA, 0x7A,
-    0x34, 0x92, 0x15, 0xDB, 0xB2, 0x37, 0xAD, 0xA9, 0xFE, 0xA9, 0x22, 0x3F, 0xBE, 0xDF, 0xFB, 0xBD,
-    0x3F, 0xCF, 0xFB, 0xF3, 0x7D, 0x32, 0xE6, 0xBC, 0x31, 0x66, 0x8A, 0x57, 0x8C, 0x57, 0x98, 0x1A,
-    0xE3, 0xE5, 0xF8, 0x05, 0x3F, 0xF9, 0x56, 0xB7, 0x32, 0x09, 0x5E, 0xE3, 0xED, 0xF3, 0xBA, 0x64,
-    0xDE, 0xBF, 0x1A, 0xBC, 0x6A, 0x63, 0x9C, 0xCA, 0x18, 0xB7, 0xEB, 0x0A, 0xAF, 0xEB, 0x72, 0xEF,
-    0xC6, 0x76, 0xEA, 0x15, 0xC6, 0xF8, 0xB8, 0x3B, 0xC0, 0x2B, 0xE4, 0x2B, 0x33, 0x26, 0xC2, 0x48,
-    0xD1, 0xF6, 0x36, 0x86, 0xEA, 0x34, 0x94, 0xFD, 0xAA, 0xB7, 0xF0, 0xC2, 0x48, 0xD5, 0x13, 0x66,
-    0xF8, 0xFA, 0x14, 0x9E, 0x85, 0x9F, 0x75, 0x82, 0xD7, 0x03, 0xB3, 0xED, 0x73, 0x9A, 0xDE, 0x18,
-    0xAF, 0x11, 0x5E, 0x93, 0x7E, 0xEC, 0xE5, 0x9E, 0x31, 0x5D, 0x57, 0x9A, 0xEE, 0x99, 0x06, 0xE3,
-    0x2F, 0xDD, 0xCA, 0x8C, 0xBD, 0xD2, 0x24, 0x7C, 0xF9, 0x85, 0x19, 0x63, 0xFC, 0x29, 0xC6, 0x6F,
-    0xC3, 0xCC, 0x6B, 0xC2, 0x87, 0xBA, 0x32, 0x7A, 0xA8, 0xC3, 0x53, 0xEE, 0x23, 0xB5, 0x0F, 0xE0,
-    0xB5, 0x0F, 0xAA, 0x40, 0x19, 0x29, 0x09, 0xF1, 0xE7, 0x3D, 0xC3, 0x3C, 0x96, 0x78, 0xF8, 0xF2,
-    0x63, 0xE7, 0x81, 0x97, 0xC7, 0x57, 0x69, 0xEF, 0xBE, 0xEB, 0x3C, 0xFA, 0x15, 0x19, 0xAF, 0x19,
-    0x14, 0x74, 0x6F, 0xE2, 0x85, 0xD9, 0xAF, 0xCE, 0x3E, 0x67, 0xC8, 0xC8, 0x38, 0xB3, 0xC3, 0x68,
-    0x78, 0xDE, 0x4B, 0x6A, 0x38, 0xE9, 0x1C, 0x4C, 0x6A, 0x4D, 0xB2, 0x0D, 0x2E, 0x95, 0xFD, 0x10,
-    0xBA, 0x2E, 0xC1, 0xCB, 0xAD, 0xFB, 0x8B, 0xCD, 0x22, 0xFB, 0xBC, 0x38, 0x6A, 0xFC, 0x8E, 0xB4,
-    0x9D, 0xEB, 0x1F, 0xE3, 0xE3, 0x31, 0x09, 0x6E, 0xC7, 0x53, 0x9C, 0xA6, 0xA7, 0xB3, 0x7F, 0xE9,
-    0xDE, 0x25, 0x5E, 0x33, 0xDC, 0x1F, 0xE1, 0x0F, 0x97, 0x64, 0xCC, 0x48, 0x6D, 0x4F, 0xFD, 0x30,
-    0x8B, 0x38, 0xFB, 0x8E, 0xB3, 0x30, 0x33, 0x0C, 0x13, 0x83, 0xBD, 0x1A, 0x3B, 0xC6, 0xD4, 0xBC,
-    0x12, 0x24, 0xCE, 0xED, 0xAF, 0x85, 0x7E, 0x4D, 0xEC, 0xAF, 0x55, 0xFF, 0xAB, 0x5F, 0xB8, 0xFC,
-    0xD5, 0x4E, 0xDA, 0x79, 0xB7, 0x0C, 0x5E, 0xCC, 0xBE, 0xB0, 0x65, 0xE9, 0xC2, 0x07, 0xE0, 0xCD,
-    0x98, 0x93, 0xC4, 0x53, 0x62, 0x32, 0x14, 0xBC, 0x03, 0xAB, 0xE6, 0xA4, 0x0D, 0x1F, 0x8D, 0xC8,
-    0x5B, 0x7C, 0x94, 0xF0, 0x23, 0x2C, 0x5F, 0x4C, 0xC6, 0x88, 0x01, 0x62, 0xF0, 0xDC, 0xF2, 0xB6,
-    0x11, 0x7B, 0xB9, 0x02, 0xB1, 0x5D, 0x00, 0xC8, 0x03, 0x2E, 0xD6, 0xC7, 0xB9, 0x3E, 0x86, 0x0E,
-    0x38, 0xFD, 0xC7, 0x95, 0x98, 0xC7, 0x8F, 0x27, 0x76, 0x6E, 0xF6, 0x6E, 0xBF, 0x32, 0xB3, 0x25,
-    0xD6, 0x22, 0x35, 0x9F, 0x97, 0x9E, 0x84, 0x60, 0x39, 0x7E, 0x44, 0xF6, 0x47, 0xBC, 0x7D, 0x21,
-    0x13, 0xD7, 0xA9, 0x4C, 0x18, 0x9E, 0x2B, 0x89, 0xFB, 0xB9, 0x98, 0x9A, 0xA5, 0x64, 0x41, 0x33,
-    0xAC, 0xCD, 0xEC, 0x87, 0x9A, 0xD8, 0x0C, 0x4C, 0x02, 0x2D, 0x07, 0xCF, 0x6A, 0x4E, 0x2D, 0xFE,
-    0x03, 0xC5, 0x0D, 0xC4, 0x27, 0xC8, 0x31, 0x5D, 0x8C, 0x94, 0xE1, 0xA2, 0x11, 0x06, 0xC4, 0x8F,
-    0x29, 0x46, 0xC2, 0xB5, 0x2D, 0xDE, 0xF6, 0x0A, 0xB7, 0xF9, 0x57, 0xB8, 0xB6, 0xB8, 0x50, 0x25,
-    0xB5, 0x64, 0x23, 0x29, 0x40, 0xCC, 0xE1, 0x91, 0x4E, 0x19, 0x73, 0x55, 0xB3, 0xE4, 0xCC, 0xC7,
-    0x92, 0x3F, 0x4C, 0x26, 0x12, 0x21, 0x64, 0x81, 0xE5, 0x16, 0x39, 0x59, 0x6A, 0xDE, 0xE0, 0x85,
-    0x73, 0xB8, 0xFD, 0xF8, 0x8D, 0x94, 0x52, 0xD4, 0x75, 0x99, 0xC7, 0xEF, 0x1D, 0xEF, 0x6C, 0xDC,
-    0x56, 0xDC, 0x0E, 0xF2, 0x09, 0xB9, 0x33, 0xD5, 0x12, 0xF8, 0x45, 0xCB, 0x3B, 0xE7, 0x62, 0x7E,
-    0xF8, 0xE3, 0x1A, 0x6F, 0xB8, 0x35, 0x46, 0xDF, 0x3F, 0xB9, 0xE2, 0x6A, 0x61, 0x80, 0x31, 0xF5,
-    0x2B, 0x93, 0x22, 0xE2, 0xCF, 0xA5, 0xF3, 0xD8, 0xAD, 0x6D, 0x2B, 0xAE, 0xE3, 0xDE, 0xD8, 0x70,
-    0x65, 0x48, 0x09, 0x54, 0x31, 0x95, 0xDA, 0x84, 0x1F, 0x2C, 0x72, 0x3F, 0x77, 0x1B, 0xBC, 0x99,
-    0x80, 0xB0, 0x30, 0xC7, 0x34, 0x4B, 0xF0, 0xBC, 0xC6, 0x95, 0x13, 0xBC, 0x19, 0xEB, 0xCD, 0x51,
-    0xFF, 0xA6, 0xC4, 0x24, 0xED, 0x45, 0x5B, 0x32, 0x7E, 0x86, 0xEF, 0x70, 0xD1, 0x9D, 0x41, 0x6D,
-    0xA0, 0xC4, 0x78, 0x9C, 0x5F, 0x8A, 0xEB, 0x7E, 0xE1, 0x71, 0x0C, 0x5C, 0x3E, 0xC7, 0x2F, 0x5E,
-    0x19, 0xA7, 0x26, 0x7C, 0x08, 0xC3, 0x4C, 0xA3, 0x0C, 0xCA, 0xC0, 0xD5, 0xE7, 0x1A, 0x8E, 0xB9,
-    0x82, 0x75, 0x4C, 0xF2, 0x46, 0xE4, 0x62, 0x0B, 0x06, 0x60, 0x21, 0xBC, 0x12, 0xB3, 0x25, 0x0F,
-    0x30, 0x05, 0x2D, 0x09, 0x45, 0x56, 0x4A, 0x2E, 0x1A, 0xA4, 0xE2, 0x76, 0xB9, 0xDD, 0x82, 0xDF,
-    0x25, 0xB9, 0x03, 0x1D, 0x9C, 0x36, 0x17, 0xCD, 0x74, 0xBC, 0x69, 0x01, 0x51, 0x37, 0x33, 0x4A,
-    0xFB, 0x98, 0x6A, 0x30, 0x9E, 0xE0, 0x93, 0x18, 0x7A, 0x91, 0x46, 0x54, 0x82, 0xF0, 0x61, 0x7C,
-    0x12, 0x3E, 0x59, 0x99, 0x36, 0xC8, 0xE7, 0xB4, 0x43, 0x78, 0xD0, 0xC3, 0x05, 0x3E, 0xB9, 0x5E,
-    0x82, 0xC5, 0xEF, 0x56, 0x58, 0x81, 0x43, 0xE9, 0x09, 0x85, 0x23, 0x02, 0x43, 0xD2, 0x80, 0x62,
-    0xE0, 0xB6, 0xE4, 0xE5, 0x92, 0xCF, 0x81, 0x6C, 0x84, 0x14, 0x78, 0x3C, 0x34, 0xBA, 0x49, 0x6D,
-    0x6D, 0xCC, 0xD1, 0xD7, 0x98, 0x52, 0x4C, 0x72, 0xA8, 0x30, 0x05, 0xD6, 0x35, 0xB1, 0xD3, 0xA1,
-    0x5E, 0x42, 0x52, 0x71, 0x77, 0x0D, 0xEA, 0xBC, 0x12, 0x5C, 0x0A, 0x7E, 0x0C, 0xA6, 0x46, 0x14,
-    0x9F, 0x11, 0x97, 0xED, 0x36, 0xE6, 0xE5, 0x74, 0x03, 0xAF, 0x23, 0xCA, 0x79, 0xCB, 0x95, 0xE4,
-    0xDB, 0xB0, 0x05, 0x1E, 0x95, 0x3D, 0xA4, 0x85, 0x38, 0x31, 0xC8, 0xDF, 0x88, 0x4F, 0xE3, 0xEC,
-    0x40, 0xEE, 0x94, 0x2C, 0x9A, 0xDB, 0x6F, 0x60, 0x67, 0x43, 0x6A, 0x6B, 0x7C, 0x73, 0xB8, 0x12,
-    0xF8, 0xDD, 0xE3, 0xE2, 0xF8, 0x39, 0x98, 0x1C, 0xE4, 0xA0, 0x2A, 0x84, 0x20, 0x80, 0x22, 0xB0,
-    0x3B, 0x4C, 0xA1, 0x9B, 0x11, 0xA9, 0x8B, 0xA9, 0x7F, 0x09, 0xAD, 0xFC, 0x2E, 0xA5, 0x8A, 0xA6,
-    0x16, 0x46, 0x46, 0x62, 0x64, 0xBF, 0x51, 0x4B, 0x25, 0xEE, 0xE6, 0x5E, 0x6B, 0x44, 0x28, 0x23,
-    0x2B, 0x99, 0x3B, 0x4C, 0x9C, 0x7A, 0x0D, 0x55, 0x0E, 0x2F, 0xE0, 0x75, 0x3D, 0x07, 0xCB, 0xB0,
-    0xA8, 0x15, 0x0C, 0x47, 0x8D, 0x3B, 0x1A, 0x3C, 0x77, 0x42, 0x0D, 0x85, 0xC4, 0xD3, 0x88, 0x86,
-    0xFF, 0xB0, 0x57, 0x51, 0x78, 0xA8, 0x3E, 0x0F, 0x83, 0xB8, 0x9F, 0x81, 0x85, 0x0D, 0x9E, 0x95,
-    0x4C, 0xF5, 0x14, 0x5C, 0x92, 0x86, 0xD6, 0x19, 0x9D, 0xD3, 0x43, 0xE6, 0x83, 0x0F, 0xCD, 0xAC,
-    0x55, 0x77, 0x3E, 0xF8, 0x0B, 0x3C, 0x15, 0xF6, 0x35, 0x79, 0x76, 0x85, 0x37, 0xA3, 0x9C, 0x26,
-    0x0F, 0x53, 0x1D, 0x4B, 0x7A, 0x28, 0x8A, 0x64, 0x3A, 0x56, 0xAD, 0x71, 0x6E, 0x3D, 0xD6, 0xE2,
-    0x4A, 0x98, 0x6C, 0xD8, 0x5E, 0x0C, 0xB2, 0xBA, 0x44, 0xE5, 0x31, 0xDE, 0x8D, 0x9D, 0x0A, 0x23,
-    0x1F, 0xE8, 0x7A, 0x2A, 0x7D, 0x98, 0x39, 0x35, 0xED, 0x83, 0x53, 0x39, 0x4B, 0x5C, 0xDF, 0xE0,
-    0xFA, 0x1A, 0x1F, 0xED, 0x90, 0x59, 0x74, 0x60, 0x31, 0xAE, 0xF4, 0x8B, 0x31, 0x38, 0x0A, 0x1A,
-    0x5A, 0x2C, 0xE1, 0x81, 0x53, 0x9F, 0xE8, 0x70, 0x25, 0xDD, 0xE1, 0xE1, 0xA7, 0xE5, 0x9B, 0xE0,
-    0x43, 0xA4, 0x37, 0x5C, 0xFB, 0xF1, 0xF6, 0x8E, 0xAC, 0xA7, 0xCC, 0xA5, 0x2B, 0xF3, 0x89, 0x1B,
-    0x35, 0x69, 0x8E, 0x52, 0xF3, 0x0D, 0x8E, 0x58, 0x1B, 0x29, 0x17, 0x1F, 0x2C, 0x6B, 0x86, 0x5F,
-    0x68, 0x57, 0xA9, 0x58, 0x86, 0xF4, 0xF7, 0xD6, 0x5E, 0x86, 0x05, 0x12, 0x86, 0x01, 0x2E, 0xDC,
-    0xD8, 0x7E, 0xFC, 0x27, 0xB2, 0x47, 0x4D, 0xC4, 0xEF, 0x05, 0xE9, 0x8E, 0x64, 0xDE, 0xE7, 0x42,
-    0x2D, 0x25, 0x1D, 0x7B, 0x78, 0xF6, 0x32, 0xBE, 0x3F, 0xF8, 0xE9, 0x20, 0x97, 0x20, 0x73, 0x4B,
-    0xB3, 0x6B, 0x05, 0xB4, 0xA5, 0xB0, 0x52, 0x5C, 0xB9, 0x82, 0xBC, 0x03, 0xF6, 0x09, 0xB6, 0xC4,
-    0xCC, 0x83, 0x7C, 0x9F, 0xE6, 0x3E, 0x7C, 0x92, 0x4F, 0x1A, 0x87, 0x8F, 0x90, 0xC0, 0x28, 0xFA,
-    0x5A, 0x6E, 0xDD, 0xC4, 0x00, 0x10, 0xF0, 0xB5, 0xBB, 0xBB, 0x4B, 0xF1, 0x6C, 0x46, 0xB1, 0xD4,
-    0x69, 0xC2, 0x47, 0x86, 0xF9, 0x9C, 0x14, 0x24, 0x69, 0x43, 0x9F, 0xB3, 0x0F, 0x91, 0xC4, 0x03,
-    0x1A, 0x43, 0xA9, 0xF1, 0x4B, 0x7C, 0x03, 0x97, 0x72, 0xD7, 0xFA, 0x4A, 0xD0, 0x30, 0x1D, 0x00,
-    0x07, 0xCC, 0x09, 0x04, 0xE1, 0xDF, 0x9C, 0xA4, 0x2A, 0x1E, 0xF4, 0xEB, 0x32, 0xEE, 0x51, 0x1D,
-    0x95, 0x03, 0x86, 0x0A, 0xD7, 0x24, 0x78, 0xEC, 0x03, 0x3B, 0x99, 0x5D, 0x5A, 0xAE, 0xCD, 0xE6,
-    0x72, 0x07, 0xE5, 0x77, 0xE0, 0xD5, 0x67, 0x12, 0x7D, 0xF0, 0xE7, 0x7E, 0xBB, 0xC2, 0xB2, 0x6F,
-    0x09, 0xE7, 0x1B, 0xD3, 0x73, 0x47, 0x34, 0x55, 0xE1, 0x3E, 0xED, 0xC4, 0x5F, 0x52, 0x31, 0x5F,
-    0x80, 0xE0, 0xC1, 0x24, 0x51, 0x28, 0xF1, 0x89, 0x57, 0x4E, 0x4C, 0xE2, 0x56, 0xF8, 0xF0, 0xC9,
-    0x2A, 0xC4, 0x27, 0x35, 0xBC, 0x7D, 0x45, 0xB3, 0x39, 0x9F, 0xD3, 0x00, 0xD0, 0x03, 0xE2, 0x5E,
-    0x18, 0xB1, 0x15, 0x1D, 0x57, 0x47, 0xCD, 0x5C, 0xC8, 0x23, 0xA6, 0xD6, 0x29, 0x7E, 0xD5, 0x90,
-    0x0E, 0x5A, 0x2C, 0x67, 0xC5, 0x99, 0x1C, 0x33, 0x59, 0x24, 0xD4, 0x23, 0x03, 0x3C, 0xDA, 0x50,
-    0xE0, 0x8E, 0x28, 0x75, 0x3A, 0x5A, 0xE2, 0xDB, 0xB4, 0xA1, 0x87, 0xFC, 0x04, 0x8F, 0x19, 0x99,
-    0x09, 0xEC, 0x61, 0x3A, 0x82, 0x3D, 0xCC, 0x61, 0x35, 0xBD, 0x2A, 0xC6, 0x87, 0x4D, 0x04, 0x26,
-    0xE0, 0xAD, 0x31, 0xED, 0x18, 0xAC, 0xF7, 0x0B, 0x30, 0x2B, 0xDE, 0x5B, 0xE4, 0x23, 0xAC, 0x59,
-    0x63, 0x66, 0x25, 0x6E, 0x8B, 0x2B, 0xDA, 0x75, 0xC2, 0x07, 0xAF, 0x16, 0x3F, 0x62, 0x6B, 0xA0,
-    0x22, 0x40, 0x16, 0xC9, 0x66, 0x48, 0xD1, 0xA4, 0x79, 0x0D, 0x69, 0x92, 0xB0, 0xC4, 0xA3, 0xA0,
-    0xC0, 0x25, 0xBB, 0x84, 0x65, 0x60, 0x67, 0xC2, 0x95, 0x3D, 0xDC, 0xA5, 0xCA, 0xD0, 0xE2, 0x52,
-    0xC4, 0xAC, 0x7F, 0xC1, 0x3A, 0x86, 0x99, 0x9C, 0x44, 0xCC, 0x29, 0x8C, 0x29, 0x61, 0xAD, 0x45,
-    0x31, 0xBD, 0xCE, 0x38, 0xB4, 0x62, 0x00, 0x0D, 0x8F, 0xE7, 0xF2, 0xA5, 0xB4, 0x98, 0x78, 0x86,
-    0xD5, 0x8D, 0x39, 0x7D, 0x24, 0xB4, 0xBE, 0xEA, 0x35, 0x46, 0xBA, 0x82, 0x7F, 0x63, 0x5E, 0x85,
-    0xA1, 0xAD, 0xC2, 0xCC, 0x39, 0x28, 0x0D, 0x18, 0xAF, 0xC2, 0x0D, 0xB1, 0x91, 0x41, 0xC5, 0x4F,
-    0x80, 0x03, 0xAF, 0xF2, 0x80, 0x53, 0xC6, 0x06, 0xC8, 0xC0, 0x2B, 0x06, 0x58, 0x00, 0x19, 0x5B,
-    0xA4, 0x61, 0x45, 0x20, 0xE7, 0xE1, 0xE1, 0x49, 0x05, 0x5E, 0x9A, 0x68, 0x6E, 0x0E, 0x60, 0xEA,
-    0x76, 0xCD, 0x99, 0xAB, 0xC6, 0x7F, 0x31, 0x85, 0x8D, 0xF4, 0x5E, 0xCB, 0xF1, 0x4F, 0xFE, 0x06,
-    0x86, 0xBA, 0x35, 0xF3, 0x2D, 0x73, 0x75, 0x0C, 0xA1, 0x4E, 0xB7, 0x60, 0x90, 0x1F, 0x2E, 0xCE,
-    0x80, 0x8F, 0xF9, 0xD5, 0x88, 0xF6, 0xFB, 0x4C, 0x98, 0x61, 0x01, 0xFC, 0xE7, 0xE1, 0xAD, 0xC7,
-    0xCE, 0x7B, 0x05, 0xF8, 0x95, 0x8E, 0x2A, 0x1F, 0x8C, 0x0E, 0x6B, 0x7E, 0x8C, 0x45, 0xA3, 0xCD,
-    0x87, 0xE1, 0xC1, 0x7F, 0x67, 0xA4, 0x59, 0x31, 0x5D, 0xF5, 0xD8, 0xE8, 0x1D, 0x70, 0x67, 0x6A,
-    0x64, 0x7B, 0xF1, 0x4F, 0xFE, 0x41, 0x53, 0xA9, 0x8D, 0xEC, 0xA5, 0x5B, 0x41, 0x53, 0xBB, 0x8A,
-    0xBA, 0x5F, 0x42, 0x57, 0x1F, 0xA3, 0xC3, 0xE2, 0xD0, 0x98, 0x35, 0xE7, 0x9D, 0xCB, 0x4E, 0xE0,
-    0x5B, 0x94, 0x62, 0xDC, 0x88, 0xC6, 0x29, 0xE6, 0xE8, 0x63, 0x3B, 0xFA, 0x00, 0x6A, 0x0B, 0x22,
-    0x11, 0x18, 0x95, 0x37, 0x4F, 0xD3, 0x43, 0x06, 0x65, 0x40, 0xFF, 0x82, 0x05, 0x8B, 0x1E, 0x02,
-    0x1B, 0xA6, 0x42, 0x86, 0xA0, 0xC1, 0xFB, 0x39, 0xDD, 0x1D, 0xB5, 0x75, 0x3A, 0xA6, 0xCC, 0xD1,
-    0xB0, 0x5D, 0xA7, 0x5D, 0xC3, 0x05, 0x6E, 0x95, 0x50, 0x43, 0xF7, 0x8D, 0x24, 0x21, 0x28, 0xDD,
-    0x25, 0x5C, 0x9E, 0x6B, 0x97, 0x90, 0xC6, 0xF5, 0x7E, 0xAB, 0x8C, 0xD6, 0x27, 0xD1, 0xC6, 0x6E,
-    0xB7, 0x9C, 0x56, 0x3B, 0x78, 0x3C, 0x43, 0x81, 0x72, 0x8E, 0x3C, 0x5E, 0x45, 0x91, 0x2E, 0x3D,
-    0xB9, 0xBD, 0x92, 0x56, 0xA5, 0xC0, 0x8C, 0xD6, 0x1E, 0x2F, 0xA3, 0xC7, 0x4B, 0x07, 0x8F, 0x17,
-    0x73, 0x5A, 0xE3, 0x0D, 0x7F, 0x0A, 0x27, 0x01, 0xC9, 0xC0, 0x63, 0xBC, 0x1B, 0x0B, 0xBA, 0x95,
-    0x56, 0xB0, 0x3A, 0xC6, 0x08, 0x74, 0x2A, 0xD6, 0x49, 0xC0, 0x56, 0xD1, 0x52, 0x24, 0xDB, 0x0B,
-    0x3A, 0xAA, 0xD4, 0x03, 0x95, 0xCE, 0x10, 0x2E, 0x8C, 0x7B, 0x47, 0x45, 0x3B, 0x73, 0xEC, 0xCD,
-    0x7F, 0x62, 0xB0, 0xB1, 0x19, 0x5A, 0xFC, 0xD3, 0x82, 0x0D, 0x72, 0x8A, 0xCE, 0xFB, 0x81, 0xC7,
-    0x6F, 0x9C, 0xFF, 0x58, 0x0F, 0x33, 0x58, 0xB2, 0x79, 0x0F, 0x36, 0x06, 0x13, 0x5E, 0x7F, 0xD8,
-    0x59, 0xE1, 0xA7, 0x53, 0x4B, 0x28, 0x88, 0x42, 0xC1, 0x2B, 0x99, 0x0C, 0x69, 0x1E, 0x42, 0x82,
-    0x9C, 0xBA, 0x9B, 0x62, 0xA8, 0x31, 0xEF, 0x99, 0x47, 0x9C, 0x39, 0x23, 0x9C, 0x9F, 0xF2, 0xC1,
-    0xB4, 0xDA, 0xD1, 0x40, 0x37, 0x03, 0x1F, 0x4B, 0x37, 0x4D, 0x75, 0x44, 0x05, 0x27, 0x0F, 0x28,
-    0x44, 0xEB, 0x38, 0x49, 0x5F, 0x02, 0x1A, 0xE2, 0x84, 0xB3, 0x73, 0x89, 0x5C, 0x83, 0x88, 0x05,
-    0xDD, 0x62, 0x51, 0xB8, 0x4B, 0xAF, 0x98, 0xC1, 0x18, 0x4F, 0x4C, 0x13, 0x42, 0x4C, 0x03, 0x80,
-    0xE3, 0xD6, 0x4C, 0x08, 0xB0, 0x64, 0x30, 0xCD, 0x7C, 0x4C, 0x3C, 0x73, 0x9D, 0xA8, 0xA7, 0x49,
-    0xB8, 0xB2, 0x2E, 0x8C, 0x68, 0x50, 0x86, 0xC5, 0xF4, 0x24, 0x61, 0xC0, 0xDB, 0x2B, 0x42, 0x07,
-    0x2C, 0xB1, 0xD9, 0xF9, 0x89, 0x8D, 0x14, 0x06, 0x64, 0x69, 0x9F, 0x1F, 0x91, 0x25, 0x50, 0xF5,
-    0x86, 0xE1, 0x13, 0x31, 0x13, 0x26, 0xED, 0x15, 0x0A, 0x6C, 0xC6, 0xFD, 0xB4, 0xCC, 0x6D, 0xCE,
-    0x66, 0xC1, 0x49, 0x24, 0x44, 0xA7, 0x33, 0xDE, 0xD7, 0xD1, 0x53, 0xBE, 0x4D, 0x47, 0xF7, 0x3C,
-    0xA3, 0x34, 0xF2, 0x6C, 0x4A, 0x26, 0x36, 0x4E, 0x6F, 0x5E, 0x85, 0x6D, 0x31, 0xCE, 0xB4, 0xD7,
-    0x9E, 0x5F, 0x84, 0xE0, 0x9C, 0xBB, 0x21, 0xB8, 0xE2, 0x13, 0x20, 0xB8, 0x18, 0x08, 0xEE, 0x1C,
-    0xA3, 0x8C, 0x2A, 0xE1, 0xB7, 0x41, 0x7C, 0xEC, 0xB7, 0x62, 0x40, 0x73, 0x27, 0x33, 0xFC, 0x80,
-    0x85, 0x31, 0xC4, 0xC1, 0x1E, 0xE7, 0xD6, 0x30, 0x4C, 0xD9, 0x7C, 0xB3, 0x64, 0x28, 0x08, 0x6D,
-    0x9E, 0x9A, 0xA5, 0x33, 0x13, 0x70, 0x73, 0xBA, 0xDB, 0x65, 0xCF, 0xB3, 0x75, 0x5E, 0x23, 0xEF,
-    0x87, 0xAE, 0xFB, 0xE8, 0x3F, 0xD6, 0x0B, 0xFE, 0x9C, 0x46, 0x48, 0x16, 0x95, 0xE1, 0x14, 0xE6,
-    0x3A, 0xE5, 0x83, 0x27, 0xD6, 0xA6, 0xD2, 0x18, 0x85, 0xB4, 0xD7, 0x8D, 0x35, 0xAF, 0xB4, 0xAE,
-    0x32, 0x49, 0x11, 0xE6, 0x2D, 0xBC, 0x0C, 0x55, 0xAB, 0xE4, 0x8C, 0x35, 0x04, 0x21, 0x01, 0x07,
-    0x28, 0x34, 0x84, 0xCC, 0xD3, 0x5C, 0x1A, 0xA9, 0x01, 0xF0, 0x83, 0x03, 0xC0, 0x71, 0xD5, 0x34,
-    0x53, 0xDB, 0xDF, 0xB8, 0xB5, 0xBD, 0x63, 0xE3, 0x2C, 0xE2, 0x0B, 0x7C, 0xAD, 0x3E, 0x9A, 0xA4,
-    0xE2, 0xE3, 0x48, 0x32, 0x1F, 0x47, 0x52, 0xA9, 0x21, 0x3E, 0x44, 0x52, 0x3E, 0x90, 0xD4, 0xAC,
-    0x49, 0x4A, 0x2D, 0x49, 0xE7, 0x2D, 0x49, 0x8D, 0x48, 0xEA, 0x6A, 0x0B, 0xA2, 0xAB, 0xCD, 0x1F,
-    0xAE, 0xFD, 0x61, 0x43, 0x6B, 0xE3, 0x5E, 0x8A, 0x3B, 0x86, 0x6E, 0xA9, 0x79, 0x60, 0xB6, 0xA1,
-    0xB5, 0xA3, 0x0D, 0xAD, 0x5D, 0xFD, 0x90, 0xC6, 0x37, 0x37, 0x1F, 0x3C, 0x0B, 0x41, 0x51, 0x68,
-    0xD7, 0x82, 0xC6, 0x39, 0xDD, 0x1D, 0x2D, 0x95, 0x9F, 0x3B, 0x0D, 0xC4, 0x05, 0xAE, 0x75, 0xA7,
-    0xA0, 0xA1, 0x8A, 0x88, 0x82, 0x63, 0xD3, 0x0B, 0x5D, 0x9F, 0x0E, 0x90, 0x2D, 0xB5, 0xC2, 0xA7,
-    0xC4, 0x81, 0x11, 0x1C, 0xB2, 0x11, 0x04, 0x48, 0x71, 0x56, 0x57, 0x84, 0x2A, 0xBA, 0x14, 0xD2,
-    0xF7, 0xC1, 0xA2, 0xC0, 0x78, 0xA5, 0x5F, 0x51, 0x08, 0x09, 0x86, 0xF1, 0x84, 0x9A, 0x98, 0xC0,
-    0x41, 0x74, 0x1A, 0xE6, 0xC2, 0x28, 0x50, 0x9B, 0x84, 0x06, 0x16, 0x70, 0x39, 0x3A, 0xBB, 0xC8,
-    0x46, 0x42, 0x8C, 0x00, 0x30, 0x9D, 0x7C, 0x70, 0x6C, 0xED, 0x0C, 0xA7, 0x48, 0x73, 0x34, 0xB7,
-    0x93, 0x56, 0x18, 0x44, 0x78, 0x72, 0x05, 0x4A, 0x0E, 0x33, 0xFF, 0xCC, 0x12, 0x8A, 0xD3, 0x12,
-    0xD6, 0x47, 0xE0, 0x30, 0xF4, 0x06, 0x61, 0xC2, 0x9C, 0x23, 0xC3, 0xDB, 0x9F, 0xAD, 0x7F, 0xA7,
-    0x85, 0x39, 0xC8, 0x38, 0x60, 0x0F, 0xD3, 0x0A, 0x41, 0x49, 0xEF, 0x92, 0xCC, 0xCC, 0x7E, 0x2F,
-    0x95, 0x62, 0x26, 0xA7, 0xC6, 0xE7, 0xF8, 0x04, 0xA4, 0x95, 0x61, 0x48, 0xF3, 0xC0, 0xF6, 0x6C,
-    0xC3, 0x44, 0xD3, 0x60, 0xC9, 0x28, 0xD1, 0x00, 0x2E, 0x9D, 0x4B, 0x27, 0x57, 0x30, 0x0F, 0x4B,
-    0x13, 0xD1, 0x98, 0x9E, 0xD8, 0xB0, 0x47, 0x08, 0xEB, 0x6D, 0x2A, 0x61, 0xA1, 0xC8, 0x20, 0xA8,
-    0x4F, 0x33, 0x61, 0x70, 0x00, 0x08, 0x08, 0x9C, 0x5A, 0x6A, 0xFD, 0x13, 0x3E, 0x6A, 0xCC, 0xC1,
-    0xC6, 0xA6, 0x56, 0x4E, 0x83, 0xE1, 0x25, 0xF5, 0x48, 0x30, 0x3E, 0xA3, 0x91, 0x46, 0xD0, 0x73,
-    0x63, 0x87, 0xB4, 0x85, 0xA9, 0xF2, 0x22, 0x13, 0x41, 0x79, 0x97, 0xE1, 0x10, 0x43, 0x25, 0x90,
-    0xCA, 0xB8, 0x1C, 0xCB, 0xB2, 0x8F, 0xB5, 0xA0, 0x37, 0x85, 0x74, 0x2D, 0x11, 0x17, 0xC6, 0x44,
-    0x33, 0x04, 0x4C, 0x66, 0x21, 0x8C, 0xDB, 0xE7, 0xC4, 0xEE, 0xC5, 0xC8, 0x72, 0x94, 0xC9, 0x8D,
-    0x9D, 0x14, 0x3E, 0x61, 0x62, 0xC3, 0xCD, 0xA9, 0xD6, 0x42, 0x41, 0x39, 0x16, 0x31, 0xA2, 0xAA,
-    0x27, 0x19, 0x51, 0x27, 0x23, 0x3A, 0xF2, 0xCD, 0x3D, 0x44, 0x34, 0x11, 0x65, 0xD0, 0xD7, 0x96,
-    0xF1, 0x00, 0x15, 0x89, 0x46, 0xDD, 0xA7, 0x01, 0x4D, 0x68, 0x61, 0x28, 0xE8, 0x31, 0xAD, 0xA0,
-    0x39, 0x5D, 0x7E, 0xD1, 0xEB, 0xDE, 0x2D, 0x93, 0xEF, 0xDF, 0x7C, 0xA8, 0x76, 0x5B, 0xC0, 0xB6,
-    0x6A, 0x2E, 0xCF, 0x3D, 0xA6, 0x6C, 0x43, 0xE2, 0xAF, 0xE1, 0xD2, 0x10, 0x72, 0x06, 0x44, 0x8B,
-    0x85, 0x5A, 0x9C, 0x6D, 0x82, 0xB9, 0xD7, 0xDD, 0x02, 0xA8, 0x78, 0x24, 0xEB, 0x73, 0x9D, 0xF8,
-    0x3A, 0x0D, 0x80, 0x47, 0xAE, 0x1E, 0xA6, 0x4C, 0x6A, 0x0D, 0xD9, 0x2F, 0x1A, 0xA2, 0xF0, 0x4F,
-    0x97, 0x26, 0xDC, 0xE9, 0xB2, 0xE8, 0x6F, 0xA3, 0x22, 0xC6, 0x73, 0x93, 0x94, 0x68, 0xC0, 0xC5,
-    0x42, 0xBB, 0xD5, 0x84, 0xE8, 0xDD, 0x10, 0xFD, 0xFA, 0xC5, 0x44, 0xB9, 0x89, 0x28, 0x4D, 0xC0,
-    0xF3, 0x10, 0xD3, 0xF0, 0xC8, 0x4C, 0x02, 0x83, 0xD3, 0xD0, 0x33, 0x60, 0x98, 0xC3, 0x9D, 0x1C,
-    0x9E, 0x3A, 0x4A, 0xFD, 0xEB, 0xD0, 0x01, 0xC8, 0xDC, 0x23, 0x90, 0x10, 0x2C, 0x55, 0x98, 0x3F,
-    0x5E, 0xB6, 0x26, 0x86, 0x80, 0x52, 0x74, 0x3C, 0x2C, 0x55, 0x84, 0x9B, 0x67, 0x2B, 0x7B, 0xEF,
-    0xCE, 0x9B, 0x4C, 0xA2, 0x9C, 0x79, 0x4C, 0xD1, 0x93, 0x10, 0x21, 0xA2, 0xCF, 0xC2, 0x59, 0x14,
-    0xDE, 0x2A, 0xF5, 0x1A, 0xD1, 0x58, 0x4B, 0x86, 0xC2, 0xFC, 0x5E, 0xB0, 0x39, 0x63, 0x40, 0xC0,
-    0xFB, 0x4E, 0x9C, 0xC3, 0xF3, 0x21, 0x06, 0x37, 0x1B, 0xEB, 0x89, 0xD7, 0x93, 0x49, 0x85, 0x25,
-    0xCA, 0xC6, 0xEF, 0xDE, 0x2B, 0x67, 0x67, 0xBB, 0x8B, 0x08, 0x27, 0x81, 0x2C, 0x6B, 0x58, 0xFF,
-    0xE7, 0x11, 0xAD, 0xD2, 0x9E, 0x22, 0x8E, 0x7C, 0x19, 0x1C, 0x03, 0x41, 0x0D, 0x35, 0x26, 0xC1,
-    0x22, 0xCF, 0x30, 0x95, 0x59, 0x63, 0x97, 0xF4, 0x34, 0xF8, 0xDF, 0xE5, 0xC9, 0xF7, 0xEB, 0x38,
-    0x1D, 0x47, 0x59, 0xF8, 0xB5, 0x3C, 0xB8, 0x5E, 0x46, 0x3F, 0xC3, 0x0A, 0x2F, 0x3A, 0x2E, 0x20,
-    0xC4, 0x84, 0x02, 0x43, 0x8A, 0x8A, 0x7B, 0x21, 0x11, 0x59, 0x64, 0x29, 0x72, 0x0E, 0xCD, 0xBD,
-    0xE9, 0xC9, 0x06, 0x01, 0xC0, 0xC8, 0x2C, 0xCA, 0x13, 0x4B, 0x53, 0x85, 0x37, 0x24, 0x7F, 0x53,
-    0xCA, 0x5A, 0x4C, 0x6D, 0x0B, 0xF2, 0x46, 0xBE, 0x5F, 0x38, 0x9A, 0x91, 0x2B, 0x3D, 0x3B, 0xEC,
-    0x10, 0x48, 0x0E, 0x2F, 0x56, 0x13, 0x1B, 0x5A, 0xC9, 0xEB, 0xD3, 0x09, 0x40, 0x75, 0x2B, 0xA6,
-    0xEB, 0x1A, 0x8A, 0xB5, 0xD7, 0xE5, 0x67, 0xCC, 0xAC, 0x0A, 0x69, 0x14, 0x67, 0xF9, 0x3D, 0x56,
-    0xFC, 0x9C, 0xC5, 0x25, 0xB0, 0xC4, 0xFC, 0xC9, 0xE3, 0xA5, 0x74, 0x27, 0x96, 0x4A, 0x21, 0x14,
-    0xEF, 0x32, 0x87, 0x43, 0x1F, 0x88, 0x58, 0xDA, 0xB5, 0xF9, 0x17, 0xCD, 0x7E, 0xD8, 0xAD, 0x1C,
-    0x82, 0x71, 0xB8, 0x58, 0x37, 0x33, 0xDF, 0x8A, 0xB0, 0xA8, 0x90, 0xA2, 0x87, 0x4B, 0xE2, 0x43,
-    0xAE, 0x0C, 0x93, 0x21, 0x63, 0x86, 0xB1, 0x0C, 0x62, 0x01, 0xC8, 0x41, 0x41, 0x1B, 0x41, 0xFA,
-    0x27, 0x66, 0x36, 0x08, 0x94, 0x3F, 0x08, 0xD4, 0x97, 0xCC, 0x65, 0x73, 0x15, 0x76, 0xE7, 0x70,
-    0x1F, 0x32, 0x55, 0x0C, 0xB0, 0xE1, 0x41, 0x73, 0xF2, 0xC9, 0xA3, 0x31, 0x0A, 0x44, 0x16, 0x90,
-    0xFD, 0xF9, 0xD1, 0x83, 0x26, 0x4C, 0xF1, 0x41, 0x88, 0xF0, 0xA0, 0x03, 0x60, 0xDC, 0x3A, 0xCA,
-    0xFE, 0x2E, 0x4F, 0xBA, 0x0B, 0x66, 0x56, 0x3F, 0x61, 0x75, 0xE9, 0x8A, 0xF9, 0x63, 0xE2, 0x48,
-    0x40, 0xEA, 0x8A, 0xB1, 0x08, 0x73, 0x34, 0x64, 0x95, 0xFF, 0x32, 0xF3, 0x7F, 0x00, 0x90, 0xB0,
-    0xB2, 0xE1, 0x45, 0xA0, 0xF8, 0x87, 0xE8, 0x11, 0x1A, 0x65, 0x04, 0x12, 0x79, 0x92, 0x98, 0x99,
-    0x48, 0x58, 0x93, 0xBD, 0xBD, 0x4B, 0x30, 0x1B, 0x00, 0xAE, 0x1F, 0x3C, 0x53, 0xE0, 0x6D, 0x0A,
-    0xAD, 0x7C, 0xC2, 0xE0, 0xA1, 0xAC, 0x73, 0x22, 0xE8, 0xAE, 0x74, 0x9F, 0x4F, 0x9F, 0xC6, 0x00,
-    0x2E, 0x86, 0xFD, 0x4C, 0x68, 0xB9, 0x1B, 0x8B, 0x7A, 0xF0, 0x05, 0xB3, 0xFE, 0xE5, 0x2C, 0x04,
-    0x76, 0x6D, 0x99, 0x13, 0x82, 0x88, 0x56, 0xE6, 0x4C, 0xED, 0xBD, 0x6E, 0xFC, 0xD7, 0xCD, 0xD6,
-    0x73, 0x08, 0xCA, 0xFC, 0x17, 0xB2, 0x08, 0x14, 0x3C, 0xE1, 0xBD, 0x52, 0x06, 0x17, 0xF3, 0xAB,
-    0x23, 0x53, 0x6F, 0x45, 0x40, 0x61, 0xF8, 0x73, 0xEE, 0x54, 0x5F, 0x45, 0xC4, 0x1B, 0x3B, 0x37,
-    0x53, 0x84, 0x89, 0x51, 0x89, 0x70, 0x81, 0x88, 0xD5, 0xCB, 0x99, 0xE8, 0xC0, 0x24, 0x4F, 0x61,
-    0x92, 0x63, 0xA6, 0x0D, 0x68, 0x26, 0x98, 0x97, 0xA1, 0xAF, 0x00, 0xAB, 0x1A, 0x98, 0xD4, 0x9A,
-    0x2F, 0x1A, 0x90, 0x30, 0xF5, 0xAA, 0x48, 0x00, 0xC0, 0x2B, 0x12, 0xAC, 0x08, 0x83, 0x2B, 0x05,
-    0x4F, 0x50, 0x36, 0x8F, 0xD9, 0x94, 0xEF, 0xD1, 0xCD, 0x34, 0x11, 0x2E, 0x03, 0x5E, 0x87, 0x31,
-    0x88, 0x99, 0x2D, 0x06, 0x64, 0x78, 0x17, 0xC6, 0xE4, 0xCF, 0x72, 0xC2, 0x31, 0x9A, 0xEA, 0x28,
-    0x5D, 0x22, 0xC6, 0x66, 0x9A, 0x72, 0x88, 0x7C, 0x2F, 0xEF, 0x64, 0xDE, 0x0B, 0x5D, 0x1E, 0xED,
-    0xEF, 0x64, 0x8B, 0x2C, 0xC1, 0x84, 0xE7, 0xE0, 0x74, 0xB5, 0x6B, 0xC2, 0xA7, 0x2A, 0xC4, 0x7D,
-    0x50, 0x52, 0x3E, 0x09, 0x2A, 0xC0, 0x20, 0xCD, 0x66, 0x41, 0x23, 0xA5, 0x41, 0x99, 0x6E, 0x7F,
-    0x30, 0x00, 0xF7, 0x23, 0xB8, 0xA1, 0xD7, 0x1F, 0xAF, 0x10, 0xA6, 0xEE, 0x9B, 0x95, 0xCC, 0x01,
-    0xC0, 0x19, 0x98, 0x4B, 0x98, 0x22, 0x27, 0xDD, 0x4A, 0xA9, 0x30, 0x73, 0x18, 0xC0, 0xA0, 0x72,
-    0x1A, 0x6F, 0x05, 0x04, 0xFF, 0x8F, 0xA0, 0x79, 0x14, 0x43, 0x26, 0x20, 0x40, 0xC1, 0x26, 0x60,
-    0x99, 0xF6, 0xE0, 0x4F, 0xB9, 0x2D, 0x73, 0xFA, 0x50, 0xCA, 0xF7, 0xBD, 0xCB, 0x80, 0x75, 0xB2,
-    0xC4, 0x16, 0xF6, 0x9A, 0xDE, 0x6F, 0x85, 0x1B, 0xCA, 0xF7, 0x19, 0x28, 0x9F, 0xE9, 0x95, 0xCF,
-    0x5C, 0x8E, 0xB3, 0xD3, 0xA5, 0x79, 0xA7, 0xAB, 0x16, 0xAD, 0xF3, 0xFE, 0xF7, 0xFF, 0xF1, 0xC6,
-    0xBE, 0xBB, 0x04, 0x1E, 0x1C, 0x63, 0x7A, 0x2B, 0x21, 0x62, 0x84, 0xA5, 0xE4, 0xB0, 0x9D, 0xA1,
-    0x99, 0x28, 0x7F, 0x43, 0x6F, 0x56, 0x9A, 0x36, 0x64, 0x82, 0xA4, 0x89, 0x64, 0xA8, 0x19, 0x63,
-    0x38, 0x55, 0xA2, 0xFC, 0xCE, 0x58, 0x39, 0x7D, 0x26, 0xA6, 0x39, 0x73, 0xE3, 0x5C, 0x26, 0x1E,
-    0xC9, 0x14, 0xC6, 0xEA, 0x47, 0x6C, 0x93, 0xF0, 0x08, 0xE4, 0xE8, 0x3A, 0x94, 0x4C, 0x65, 0x2A,
-    0xCD, 0x8C, 0xE8, 0xEC, 0x10, 0x50, 0x1A, 0xF7, 0x0D, 0x62, 0xD1, 0xBF, 0x06, 0x75, 0x5F, 0x10,
-    0xF6, 0x1E, 0x12, 0x8A, 0x9A, 0x7A, 0x3C, 0x60, 0x6B, 0xFA, 0x49, 0x84, 0xB2, 0x70, 0x2E, 0x4C,
-    0xD3, 0x34, 0xC7, 0xFC, 0x5D, 0x8F, 0xC1, 0x9B, 0xDE, 0x83, 0x0A, 0xA2, 0xF0, 0xC6, 0x1D, 0xBC,
-    0x33, 0x63, 0x8A, 0xEC, 0xED, 0x9B, 0x40, 0xD5, 0x13, 0xF8, 0xE3, 0x20, 0x6F, 0x13, 0x18, 0x9B,
-    0xE7, 0x0B, 0xC4, 0x00, 0x90, 0x3F, 0xFF, 0xA7, 0x79, 0x6C, 0x26, 0xAD, 0x57, 0x06, 0x2F, 0x40,
-    0x72, 0x1A, 0x20, 0x11, 0x18, 0xA0, 0x89, 0x5F, 0xC6, 0x2F, 0xFC, 0x2F, 0x26, 0xE3, 0x56, 0x78,
-    0xDA, 0x6A, 0x23, 0xCA, 0x91, 0x9F, 0x1E, 0x0F, 0xE0, 0x74, 0x32, 0xAC, 0xC6, 0x15, 0xF3, 0x65,
-    0x21, 0x5A, 0xAD, 0xEF, 0x9C, 0x18, 0x97, 0xEB, 0x41, 0x84, 0x3D, 0x2B, 0x6C, 0x5E, 0x54, 0xF1,
-    0x09, 0x73, 0xA3, 0xB7, 0xB9, 0x30, 0x00, 0xCB, 0x35, 0x73, 0x0B, 0x00, 0x0D, 0x8D, 0xE2, 0xC8,
-    0x28, 0xDD, 0x34, 0x35, 0xD5, 0x47, 0x9A, 0x9A, 0x62, 0xD3, 0xD4, 0x1C, 0x78, 0x5D, 0xD3, 0x3D,
-    0xD2, 0x3D, 0xB4, 0x34, 0xA9, 0x63, 0xD3, 0xF8, 0x22, 0x4D, 0x60, 0xED, 0x94, 0x71, 0xFF, 0x7B,
-    0xC5, 0xF0, 0x95, 0xC6, 0xBC, 0x9D, 0x50, 0xD2, 0x5D, 0x78, 0xC0, 0x59, 0x90, 0x47, 0xD5, 0xEC,
-    0xD9, 0x9B, 0x5E, 0xF7, 0x46, 0x79, 0xF2, 0xD2, 0xE8, 0xC3, 0x35, 0x11, 0x90, 0x71, 0xC5, 0x7C,
-    0x89, 0x48, 0x69, 0x90, 0x80, 0xF0, 0x48, 0x02, 0x9A, 0xB5, 0x04, 0xE0, 0xF3, 0x78, 0x58, 0xFB,
-    0xDC, 0xEB, 0x25, 0x60, 0x4A, 0xEB, 0x00, 0xE7, 0x97, 0x00, 0xE5, 0x4F, 0xCC, 0x22, 0x4D, 0xF2,
-    0x5D, 0xEF, 0xF5, 0xEC, 0x36, 0x4C, 0xD7, 0xA3, 0x1D, 0x6C, 0x40, 0xEB, 0xAD, 0x60, 0xA5, 0x53,
-    0x56, 0xCE, 0x3E, 0xAD, 0xA7, 0x3C, 0xDF, 0xF2, 0x29, 0x5E, 0xAB, 0xA7, 0xB4, 0x66, 0x9D, 0x8D,
-    0xEF, 0x4B, 0x04, 0x16, 0xB1, 0x9A, 0x2F, 0xEF, 0x19, 0x79, 0xD5, 0x6F, 0xEF, 0x6F, 0x14, 0x01,
-    0x85, 0x50, 0x11, 0x6A, 0xC1, 0xD7, 0x38, 0x87, 0x8F, 0xD4, 0x44, 0xA7, 0xA4, 0xA8, 0xFF, 0xD9,
-    0x38, 0x4C, 0xC2, 0x75, 0x02, 0x6F, 0x29, 0xCD, 0xB8, 0x8B, 0x38, 0xEF, 0x4B, 0x14, 0x02, 0x39,
-    0xA0, 0x09, 0x79, 0xCF, 0x02, 0x08, 0x95, 0x04, 0xCF, 0x8C, 0xE0, 0x55, 0xEA, 0xB8, 0x83, 0x2D,
-    0x8B, 0xBF, 0xBE, 0x20, 0xF9, 0x10, 0x2A, 0x20, 0xCC, 0x87, 0xF9, 0xCD, 0x03, 0xD6, 0x4C, 0x98,
-    0x26, 0x3C, 0x00, 0x00, 0xEF, 0x58, 0x55, 0xEC, 0x60, 0xF8, 0xA4, 0x9B, 0x60, 0x8B, 0x9C, 0x90,
-    0xC2, 0x4F, 0x8C, 0x86, 0xF1, 0x9D, 0xDB, 0xC4, 0x78, 0x75, 0xF2, 0xF5, 0x05, 0xF0, 0xEB, 0x2B,
-    0x50, 0xBC, 0x9A, 0x8B, 0x1A, 0x23, 0xB4, 0x7D, 0x12, 0x58, 0x7A, 0xF0, 0xA8, 0x74, 0x6F, 0x2B,
-    0xF3, 0x27, 0x17, 0x0A, 0xE9, 0x4D, 0x64, 0xC5, 0xB3, 0x0E, 0xBB, 0xA5, 0x47, 0x9F, 0xC9, 0xA8,
-    0xB0, 0x12, 0x27, 0xDA, 0x7B, 0x0C, 0xDE, 0x82, 0xC2, 0x2F, 0x6D, 0x6D, 0xF7, 0x8A, 0x39, 0xFD,
-    0x26, 0x83, 0x32, 0xCC, 0xB9, 0xF2, 0x6E, 0xCD, 0x52, 0x9A, 0x24, 0x4C, 0x17, 0xC8, 0x24, 0xA7,
-    0x2D, 0x18, 0x91, 0xDB, 0x88, 0x60, 0x3B, 0x56, 0x40, 0x61, 0x96, 0xA0, 0x3B, 0xF4, 0x12, 0xAC,
-    0x27, 0x84, 0x59, 0xCD, 0x85, 0x8B, 0x8C, 0xB2, 0x7D, 0x44, 0xED, 0x98, 0x5A, 0xC7, 0xBC, 0xF4,
-    0x4C, 0x1C, 0x67, 0x79, 0xD4, 0xD9, 0xFB, 0x81, 0xAD, 0x21, 0xEE, 0x35, 0x00, 0x1E, 0x4C, 0xAC,
-    0x2B, 0x19, 0x48, 0x9F, 0xE5, 0x2C, 0x85, 0x4E, 0xC9, 0xCE, 0xDC, 0xEC, 0xD2, 0x83, 0x0A, 0xFA,
-    0x67, 0x40, 0x77, 0x69, 0x9C, 0x46, 0xF0, 0xC8, 0xB1, 0x20, 0x2D, 0xE9, 0xEE, 0xA5, 0xF4, 0xB9,
-    0x01, 0x47, 0xEE, 0x14, 0x58, 0x08, 0xB3, 0x7A, 0xBC, 0xD8, 0x37, 0xCD, 0xAE, 0x19, 0x01, 0xFB,
-    0x85, 0xD9, 0xEC, 0xBB, 0x5D, 0xF7, 0x14, 0x58, 0x60, 0x8D, 0x9F, 0x00, 0x2A, 0x03, 0xDE, 0x07,
-    0x7D, 0xBC, 0xC7, 0xA5, 0xB6, 0x7E, 0xD7, 0x85, 0xE2, 0x8C, 0x21, 0x69, 0xF9, 0x77, 0xD6, 0x58,
-    0xAF, 0xEE, 0x01, 0x59, 0x8A, 0xC1, 0x80, 0x61, 0x1E, 0x06, 0x6D, 0x63, 0x67, 0xE5, 0x0B, 0x90,
-    0x65, 0x81, 0x55, 0x0E, 0xFE, 0x60, 0x56, 0xA8, 0x76, 0x33, 0x42, 0xED, 0x01, 0x90, 0x99, 0xA3,
-    0x38, 0xC7, 0x5D, 0xEC, 0x19, 0xDC, 0x63, 0x9C, 0xFD, 0xBE, 0xB0, 0xD5, 0x80, 0xF6, 0x7A, 0x51,
-    0x3A, 0xEF, 0x77, 0x8D, 0xDB, 0x65, 0xAD, 0xB7, 0x44, 0x8C, 0x53, 0x2B, 0x19, 0x68, 0xFD, 0x57,
-    0xCE, 0x84, 0x80, 0xD3, 0xFB, 0x2F, 0x77, 0xED, 0xBF, 0xC6, 0xBD, 0xFF, 0x3A, 0x9E, 0x06, 0xC1,
-    0x43, 0xEE, 0x01, 0x44, 0x89, 0x5A, 0x9B, 0x84, 0x30, 0x27, 0x2C, 0x2A, 0xB5, 0x28, 0x90, 0x35,
-    0x26, 0xD5, 0xA2, 0xCD, 0x49, 0xE0, 0x40, 0x4C, 0x57, 0x08, 0x91, 0xB7, 0xD6, 0x12, 0xA3, 0xB8,
-    0x30, 0x3B, 0x70, 0x52, 0x58, 0xE6, 0x72, 0xCD, 0xCD, 0x82, 0x9F, 0x3C, 0x48, 0x90, 0xC8, 0xB4,
-    0x25, 0xAB, 0x56, 0x77, 0xF7, 0x26, 0x90, 0xB0, 0x45, 0x57, 0xDE, 0x01, 0xE5, 0x8E, 0x79, 0x13,
-    0x80, 0xD2, 0x05, 0x2E, 0xFA, 0x46, 0xD9, 0x0B, 0x6C, 0xA5, 0x42, 0x70, 0xD0, 0xA8, 0x38, 0xEC,
-    0xB6, 0xA2, 0x9F, 0x56, 0xBC, 0xFE, 0x22, 0x34, 0xC3, 0xE2, 0x2A, 0x15, 0xC9, 0xEE, 0x61, 0x46,
-    0x8A, 0x19, 0x7A, 0x09, 0x21, 0xE0, 0x06, 0x91, 0x06, 0xA3, 0x54, 0xE6, 0x30, 0x08, 0xF1, 0x11,
-    0x8E, 0x62, 0xDE, 0x63, 0x92, 0x7B, 0x36, 0x8D, 0xB7, 0xBC, 0xB7, 0xF2, 0xCF, 0x7D, 0xD1, 0xF4,
-    0x97, 0x87, 0xA9, 0xAA, 0x1C, 0x5E, 0x69, 0xD3, 0x9F, 0x8A, 0x88, 0x9B, 0xF5, 0xBB, 0x95, 0x0D,
-    0x98, 0x25, 0x2D, 0x60, 0xD1, 0xAE, 0xE9, 0x1F, 0xA3, 0x5B, 0xE5, 0x84, 0x94, 0x45, 0x2E, 0x8D,
-    0x12, 0x88, 0xBC, 0xD7, 0xE6, 0x4D, 0xC3, 0xD4, 0x26, 0x0D, 0xFB, 0x94, 0xC7, 0x48, 0xA6, 0x41,
-    0x49, 0x0E, 0xDC, 0xF4, 0x58, 0xC5, 0xB4, 0xCF, 0x82, 0xA4, 0x13, 0x3A, 0xD1, 0xA9, 0xC8, 0x25,
-    0xEC, 0xA9, 0xEE, 0x45, 0xB4, 0xA2, 0x42, 0x0E, 0x1D, 0x84, 0x9E, 0xDD, 0x38, 0x1F, 0x1C, 0x72,
-    0x8C, 0x45, 0x47, 0x04, 0x06, 0xED, 0x55, 0x02, 0x80, 0xE1, 0x28, 0x8B, 0xDF, 0x0E, 0xB3, 0x9A,
-    0x13, 0x85, 0xB4, 0x09, 0xB0, 0x41, 0x50, 0xC4, 0x17, 0x3B, 0xC5, 0xC6, 0x2B, 0x66, 0x83, 0x05,
-    0xAB, 0xEE, 0x17, 0xB9, 0x0F, 0x52, 0x93, 0x69, 0x12, 0x22, 0x63, 0x65, 0x71, 0x2C, 0xA7, 0xA8,
-    0xF2, 0x34, 0x57, 0x71, 0x77, 0x7B, 0xE7, 0x7B, 0xA9, 0xAB, 0x42, 0x48, 0xF0, 0x0F, 0xCF, 0x20,
-    0xE0, 0x1D, 0x2B, 0xC5, 0x52, 0x33, 0x97, 0xED, 0xB3, 0xD0, 0x32, 0x8F, 0x95, 0x57, 0x24, 0xD0,
-    0x88, 0x01, 0x2C, 0x21, 0xBE, 0x9C, 0x26, 0x4D, 0x58, 0x5F, 0xAC, 0xFC, 0x18, 0x11, 0x3E, 0x05,
-    0xA8, 0xD2, 0xD5, 0xCE, 0xFB, 0x6F, 0xB7, 0x6E, 0x07, 0x43, 0xD8, 0x02, 0x7E, 0x55, 0x1B, 0x10,
-    0x8C, 0x22, 0x9C, 0x51, 0x84, 0x9D, 0x0F, 0x89, 0xF0, 0xC8, 0x7A, 0xC5, 0xF3, 0x36, 0x5A, 0x55,
-    0x55, 0x39, 0xB3, 0x35, 0xD9, 0xFB, 0x87, 0x85, 0xF8, 0xD5, 0xF0, 0x2B, 0x69, 0x97, 0x76, 0xF4,
-    0xA5, 0xDE, 0x2D, 0x33, 0x28, 0xC1, 0x65, 0x73, 0xCA, 0xE2, 0x31, 0x8F, 0xB0, 0x9A, 0x58, 0x3A,
-    0xB2, 0x58, 0x9A, 0xA0, 0x8D, 0xB4, 0x8E, 0xE4, 0x54, 0x13, 0x16, 0x97, 0x81, 0x70, 0x8B, 0x5D,
-    0xF7, 0x26, 0xAC, 0xE1, 0xC4, 0xE9, 0x5E, 0x2A, 0xED, 0x08, 0x97, 0x4F, 0x42, 0x8C, 0x73, 0xEA,
-    0xD6, 0x6B, 0x8C, 0xF5, 0xBB, 0x0D, 0x4E, 0xC1, 0x3C, 0x9F, 0xB2, 0xE9, 0xB6, 0xB1, 0x15, 0xB9,
-    0xB1, 0x05, 0xC8, 0x58, 0x5A, 0xCA, 0x0E, 0x98, 0x36, 0x91, 0xDD, 0x65, 0x1C, 0xFD, 0x12, 0x95,
-    0x90, 0x19, 0xE4, 0x33, 0xA4, 0xED, 0x47, 0x60, 0x81, 0x73, 0x93, 0xB0, 0x61, 0x9D, 0x52, 0x1C,
-    0x0F, 0x68, 0x82, 0x1A, 0x4E, 0xAB, 0xED, 0xB0, 0x7B, 0x22, 0x52, 0x5F, 0x45, 0x66, 0x7E, 0xF5,
-    0xD0, 0xC3, 0xF9, 0x1B, 0xFB, 0xA0, 0x1E, 0x11, 0x28, 0x4C, 0xB2, 0xF2, 0xAC, 0x4E, 0x09, 0xEF,
-    0x0D, 0x86, 0xD2, 0x4A, 0x72, 0x33, 0xA5, 0x97, 0xD8, 0xF2, 0xBF, 0x5A, 0x00, 0xC8, 0x35, 0xC1,
-    0x98, 0x0C, 0x90, 0x90, 0x7E, 0xCB, 0x27, 0x18, 0x05, 0x90, 0x2E, 0x99, 0xB0, 0x71, 0xBB, 0x9C,
-    0xA5, 0xAE, 0x30, 0x11, 0xAC, 0x6B, 0x08, 0xEB, 0xE6, 0xFE, 0xB5, 0x8A, 0x59, 0x95, 0x91, 0x5F,
-    0x4C, 0x19, 0x31, 0x22, 0x44, 0x33, 0xE1, 0xD3, 0x69, 0x82, 0xE7, 0x25, 0x73, 0x33, 0xAF, 0x99,
-    0x7F, 0x74, 0xB0, 0xA4, 0xCE, 0x8A, 0x75, 0x1B, 0xF5, 0x69, 0x14, 0x6B, 0xEC, 0x76, 0xCA, 0x80,
-    0xE1, 0x57, 0x54, 0xCB, 0x7A, 0x45, 0x45, 0x16, 0x8B, 0x01, 0xE4, 0xEB, 0x0B, 0xB2, 0x38, 0x96,
-    0xC0, 0x43, 0xD6, 0xC2, 0x92, 0xC6, 0x71, 0x91, 0x8D, 0xF1, 0xC0, 0xFF, 0xCB, 0x34, 0xD7, 0x16,
-    0xB0, 0xB6, 0x7F, 0xFD, 0x25, 0xC6, 0xF8, 0xFF, 0xDE, 0x7B, 0x1E, 0x13, 0xA9, 0x98, 0xBF, 0x5D,
-    0xA4, 0x71, 0x39, 0xF4, 0x56, 0xAC, 0xFB, 0x35, 0x98, 0x92, 0xED, 0xBA, 0xD5, 0x89, 0x9D, 0xED,
-    0xB4, 0x6F, 0xE7, 0xE0, 0x4A, 0xCD, 0x68, 0x00, 0x3B, 0xB3, 0x7C, 0x0C, 0x5E, 0x38, 0xC0, 0x8A,
-    0x4D, 0xC1, 0xF0, 0x97, 0x85, 0x9A, 0xC2, 0xEB, 0x85, 0xDB, 0x4C, 0xBF, 0xD1, 0x31, 0x77, 0xB3,
-    0x58, 0x0D, 0xA9, 0x01, 0x37, 0xA3, 0x05, 0x08, 0x69, 0xFC, 0xCC, 0xF4, 0x70, 0xC6, 0xE2, 0xA1,
-    0xC0, 0x13, 0x13, 0x9F, 0x4A, 0x45, 0x50, 0xDE, 0x13, 0x19, 0x58, 0x06, 0xE0, 0x0C, 0x59, 0x73,
-    0x62, 0x3B, 0xAA, 0xDE, 0x9C, 0x49, 0x08, 0x22, 0x09, 0x9A, 0x2B, 0xFF, 0x15, 0x08, 0x76, 0x96,
-    0x60, 0x01, 0x92, 0xAE, 0x66, 0x7E, 0x75, 0x75, 0xAC, 0x47, 0x80, 0xAB, 0x75, 0xB2, 0x7B, 0x93,
-    0x75, 0x5C, 0x68, 0x36, 0x96, 0xBE, 0xFB, 0xFA, 0x84, 0xE1, 0x2C, 0x53, 0xE2, 0xA9, 0x4D, 0x17,
-    0x79, 0x16, 0xE1, 0xEE, 0x0A, 0x25, 0x4B, 0xA0, 0x46, 0x82, 0x3A, 0x3E, 0x8D, 0x41, 0xCE, 0x90,
-    0x19, 0x8E, 0x37, 0x7C, 0x75, 0xB6, 0x0D, 0x6D, 0x6E, 0x74, 0x71, 0x98, 0x2A, 0xA7, 0x3D, 0xDC,
-    0xA9, 0x9C, 0x7D, 0xA9, 0x6C, 0xD2, 0x58, 0xEB, 0xC1, 0x4E, 0x84, 0xEC, 0xF3, 0x60, 0x19, 0x73,
-    0x34, 0xC4, 0xE9, 0xB6, 0x40, 0x29, 0xD7, 0x79, 0x85, 0x0E, 0x82, 0xC9, 0xB1, 0x1C, 0xC6, 0xEC,
-    0xD5, 0xCB, 0x01, 0x8B, 0x9C, 0x2A, 0x2F, 0xCB, 0x0E, 0xA8, 0x5D, 0x8A, 0x7D, 0x2F, 0x5D, 0x1E,
-    0xA8, 0x3C, 0x53, 0x29, 0x71, 0xC6, 0x4F, 0x46, 0xAE, 0x8C, 0x97, 0x6A, 0xE5, 0x70, 0x1D, 0x78,
-    0x20, 0xF8, 0x5D, 0xCB, 0x7D, 0x0C, 0xC6, 0xE0, 0xAA, 0x51, 0x6D, 0x12, 0x0C, 0x64, 0x39, 0x41,
-    0x21, 0xFE, 0x7F, 0x26, 0x1E, 0x63, 0xCB, 0xCA, 0xCB, 0xE4, 0xAB, 0xAF, 0x74, 0x93, 0x51, 0x9D,
-    0x43, 0xF5, 0x6E, 0xEF, 0xAD, 0xB7, 0x10, 0x54, 0x84, 0x8F, 0x42, 0xE4, 0xB6, 0x22, 0x46, 0xC9,
-    0x13, 0x02, 0x30, 0x60, 0x8B, 0x31, 0x4D, 0x50, 0x0D, 0xFB, 0xE7, 0xE5, 0x44, 0x48, 0x66, 0x32,
-    0x35, 0x57, 0x09, 0x04, 0x60, 0xC9, 0x34, 0x3A, 0xC1, 0xF8, 0xFB, 0xA5, 0x71, 0xDF, 0x85, 0xF1,
-    0x7F, 0xA9, 0x62, 0x85, 0x92, 0x98, 0x45, 0xF5, 0xF3, 0xF9, 0xD5, 0xC6, 0xD4, 0x0D, 0xE0, 0x5E,
-    0x0D, 0xEB, 0x56, 0x31, 0xBB, 0x30, 0x8A, 0xDC, 0x72, 0x34, 0xA6, 0x41, 0x9B, 0x90, 0x48, 0x4C,
-    0xC4, 0xAF, 0x6C, 0x21, 0x94, 0x3D, 0x46, 0x1D, 0x93, 0xA5, 0xE1, 0x5F, 0x2B, 0x19, 0x7B, 0x95,
-    0x6E, 0xE7, 0x25, 0x26, 0x22, 0x13, 0x5F, 0xE5, 0x7D, 0x38, 0xAF, 0x8E, 0xC5, 0x1F, 0xAE, 0x42,
-    0xE3, 0xDD, 0x7A, 0xEC, 0xAD, 0xB7, 0xC0, 0x2B, 0x12, 0xAC, 0xD8, 0x17, 0xF6, 0xF2, 0xC7, 0xD5,
-    0x34, 0xC8, 0x49, 0xF3, 0x58, 0x44, 0x37, 0xA4, 0xFA, 0xF9, 0xA2, 0x01, 0xD9, 0x91, 0xE8, 0x9E,
-    0x5B, 0xC2, 0xAF, 0x90, 0x72, 0xD0, 0x47, 0x9C, 0xBC, 0x00, 0x0C, 0x76, 0xDE, 0x2B, 0xB0, 0xF2,
-    0x6F, 0xC0, 0xA0, 0xFB, 0xD7, 0xE0, 0x48, 0x60, 0xD3, 0xB8, 0xDC, 0x15, 0x99, 0x0E, 0x2B, 0xDA,
-    0x36, 0x35, 0xC8, 0xAE, 0x1B, 0xD8, 0x8B, 0xAA, 0x89, 0x60, 0x2A, 0xE6, 0x71, 0xF8, 0x50, 0x39,
-    0x19, 0xC7, 0x5E, 0x31, 0x19, 0x4D, 0xBD, 0x62, 0xA4, 0x14, 0x8A, 0x3A, 0x72, 0x20, 0x21, 0xC9,
-    0xF6, 0xF6, 0x52, 0x45, 0xC3, 0xC2, 0xA8, 0xC7, 0xC8, 0x28, 0x35, 0x08, 0x91, 0xA0, 0x48, 0x05,
-    0xCF, 0x13, 0x67, 0x84, 0x07, 0xAA, 0xEB, 0xAB, 0xBB, 0x8B, 0x45, 0x6B, 0xBF, 0xAC, 0xF1, 0xCE,
-    0x98, 0x91, 0xAE, 0xAB, 0x9A, 0x6A, 0x98, 0xB5, 0xAC, 0x3D, 0x22, 0x80, 0xA5, 0x10, 0xA6, 0xAC,
-    0x6E, 0x52, 0x4E, 0x1B, 0x3A, 0x41, 0xD6, 0x59, 0x28, 0x72, 0x4A, 0x10, 0xDE, 0xBB, 0x07, 0x28,
-    0xA8, 0x34, 0xCE, 0x07, 0x7B, 0x0B, 0x2B, 0xBD, 0x0C, 0xD6, 0x8D, 0xCF, 0xAA, 0x5A, 0xB8, 0x50,
-    0x15, 0x1E, 0x4B, 0xB4, 0x58, 0xD0, 0x06, 0x8D, 0x6D, 0xDE, 0xA7, 0x8E, 0x98, 0x69, 0x9C, 0xC0,
-    0x9B, 0xB8, 0x65, 0x04, 0x6C, 0x98, 0x22, 0x5C, 0xDC, 0xA2, 0xDF, 0xA4, 0xBF, 0x03, 0x5E, 0xD0,
-    0x34, 0xC2, 0x0C, 0xF3, 0x38, 0xB0, 0xD9, 0x71, 0xE6, 0x03, 0x5B, 0xA9, 0x21, 0x02, 0x2B, 0x0B,
-    0x05, 0x6C, 0x13, 0xD8, 0x2B, 0x7C, 0x9A, 0x4C, 0x39, 0x97, 0x05, 0xDA, 0xCC, 0x75, 0xE9, 0x52,
-    0x2C, 0x4C, 0xDD, 0xCE, 0xE8, 0xBD, 0x09, 0x73, 0x47, 0x5C, 0xB6, 0x1A, 0x6B, 0x93, 0xC3, 0x88,
-    0x07, 0xF9, 0x94, 0xE2, 0x3D, 0x26, 0x24, 0x1D, 0x33, 0x20, 0xC1, 0x37, 0xBF, 0x98, 0x3B, 0xCC,
-    0x52, 0x20, 0x54, 0xC4, 0xD4, 0xE6, 0xB1, 0xED, 0x1F, 0xBA, 0xA2, 0xA9, 0xD5, 0x18, 0xB8, 0xC5,
-    0x00, 0x7B, 0xCF, 0x54, 0x24, 0x9A, 0x21, 0x0B, 0x02, 0x49, 0xEA, 0x57, 0xA5, 0xDE, 0xA8, 0xBF,
-    0xAB, 0xA4, 0x98, 0xEC, 0x16, 0xEB, 0x30, 0x49, 0xAC, 0xD5, 0x18, 0xF6, 0xEC, 0xA9, 0x0A, 0xC1,
-    0x0F, 0x56, 0x6B, 0xCB, 0xCF, 0x23, 0xCD, 0x34, 0x0E, 0xD3, 0xAB, 0x10, 0x38, 0x98, 0x55, 0xAC,
-    0xD6, 0x88, 0x68, 0xD9, 0x98, 0x3F, 0x02, 0x87, 0xBD, 0x97, 0x88, 0xA4, 0x94, 0x0A, 0x03, 0xF4,
-    0x5B, 0x34, 0xC4, 0x0A, 0x50, 0xA2, 0x4B, 0x71, 0x6E, 0x52, 0xF9, 0x6A, 0x7F, 0x33, 0x1A, 0x55,
-    0xB0, 0x7A, 0xC0, 0x6B, 0x52, 0x8B, 0x26, 0xB6, 0xD9, 0xF4, 0xA2, 0x54, 0xF3, 0x51, 0x91, 0x6E,
-    0xF8, 0x85, 0x9A, 0x1F, 0xB4, 0xB0, 0x36, 0x2B, 0xD0, 0xB6, 0x4A, 0x9D, 0xD5, 0x5F, 0x6C, 0x54,
-    0xF1, 0x92, 0x7F, 0x58, 0xC1, 0xF6, 0xC0, 0x90, 0x38, 0x7B, 0x7B, 0xB9, 0xB5, 0x4C, 0x0E, 0xB4,
-    0xD6, 0x7F, 0x12, 0x02, 0xF0, 0xC6, 0x9B, 0xAA, 0x23, 0x9D, 0x54, 0xD6, 0xBF, 0x34, 0xE3, 0xC7,
-    0xAA, 0x3E, 0xCC, 0xEA, 0xFB, 0x2A, 0x4E, 0x83, 0xE3, 0xAB, 0xDE, 0x81, 0x2A, 0x8D, 0x51, 0x1C,
-    0x75, 0x92, 0x80, 0xEE, 0xFF, 0xB0, 0x52, 0xC9, 0x3C, 0xF9, 0x0B, 0x4B, 0x37, 0x73, 0x1B, 0xEC,
-    0xAE, 0xB0, 0xCD, 0x11, 0x8E, 0x52, 0xD4, 0x41, 0xDE, 0x30, 0x1C, 0x61, 0x42, 0x2A, 0x7C, 0xB2,
-    0x26, 0x6A, 0x22, 0xCF, 0x63, 0x42, 0x06, 0x86, 0x54, 0xF8, 0x4F, 0xCD, 0x17, 0x05, 0xCB, 0xC6,
-    0x13, 0xE6, 0xAF, 0xC2, 0x7C, 0x6A, 0x5A, 0xAE, 0x3D, 0xA4, 0xC2, 0x24, 0x59, 0x0D, 0x87, 0x2A,
-    0x81, 0x77, 0x55, 0xC0, 0x70, 0x66, 0xE7, 0xD6, 0xE5, 0x8A, 0xA9, 0x59, 0xE7, 0x51, 0xE6, 0xEB,
-    0x02, 0xDE, 0x50, 0xCC, 0x4B, 0xFB, 0xBA, 0x85, 0xC2, 0xC5, 0x60, 0xF0, 0xD5, 0x9C, 0xD7, 0x15,
-    0x3F, 0x7F, 0xD0, 0x2F, 0x22, 0x86, 0x3D, 0xB0, 0x12, 0x94, 0xFB, 0x87, 0x29, 0xF6, 0x61, 0x3A,
-    0x71, 0xAA, 0x09, 0x16, 0xFE, 0x9A, 0xD4, 0x9C, 0x79, 0x84, 0x31, 0x7B, 0xA7, 0x1A, 0xAC, 0x28,
-    0x2C, 0x12, 0xE4, 0x22, 0x07, 0xDA, 0x8F, 0xAF, 0xBF, 0xCC, 0x9A, 0x9E, 0xFA, 0xE0, 0xDE, 0xEC,
-    0x57, 0x40, 0xCF, 0x3D, 0xFE, 0xAC, 0xF8, 0x28, 0x68, 0xB5, 0x15, 0xD8, 0x4B, 0x7D, 0xD2, 0xBC,
-    0xD8, 0x29, 0x99, 0x74, 0xCB, 0xE3, 0x0C, 0xAE, 0x83, 0xA9, 0x71, 0x6A, 0x6E, 0x8B, 0xB5, 0x72,
-    0xDF, 0xC1, 0xE5, 0xC1, 0x0B, 0x94, 0x69, 0x16, 0x6D, 0xDA, 0xD5, 0xDE, 0xDE, 0x33, 0xEF, 0xD1,
-    0xEC, 0x3E, 0x8D, 0xF1, 0xF6, 0x09, 0x46, 0x2A, 0x86, 0x45, 0x6C, 0x45, 0x69, 0x11, 0x84, 0x44,
-    0x85, 0xDF, 0xB8, 0xE4, 0x3E, 0x80, 0x96, 0x7A, 0xDD, 0xAC, 0x1D, 0x3E, 0xFD, 0xBF, 0x95, 0xF5,
-    0x4E, 0xBE, 0xDF, 0x32, 0x56, 0x8B, 0x10, 0x98, 0xCC, 0xFB, 0x6C, 0x19, 0x86, 0x84, 0xFA, 0xF7,
-    0xD9, 0xB2, 0x69, 0xA4, 0x7C, 0xF7, 0x51, 0xB6, 0x6C, 0x61, 0x6B, 0x43, 0x40, 0x39, 0xE1, 0x1B,
-    0x05, 0x2C, 0x0C, 0x66, 0xB3, 0x54, 0x7F, 0xDC, 0xD8, 0xD6, 0xB6, 0x69, 0x14, 0x18, 0xDC, 0x2B,
-    0xA3, 0x98, 0x60, 0xA2, 0xEC, 0x85, 0x48, 0xD9, 0x5C, 0xC6, 0x38, 0x83, 0x69, 0xA0, 0x86, 0xF9,
-    0x20, 0x0C, 0x6D, 0xAE, 0x62, 0xA8, 0x80, 0x28, 0x89, 0x76, 0xDA, 0x6F, 0xFB, 0x92, 0xA5, 0x18,
-    0xF5, 0x2D, 0xE3, 0xFC, 0x15, 0x50, 0xDB, 0xF3, 0xAC, 0xDD, 0xA4, 0x61, 0x36, 0x62, 0x3A, 0x89,
-    0x58, 0x9A, 0xB5, 0xC4, 0x46, 0x38, 0x68, 0x3E, 0x36, 0xCE, 0x3B, 0x50, 0xB3, 0x17, 0x80, 0xE4,
-    0xA7, 0xB6, 0xC7, 0x0B, 0xA2, 0x49, 0xBC, 0x71, 0x82, 0xF8, 0xAD, 0x1D, 0x40, 0x59, 0x4C, 0x2E,
-    0x3F, 0xF7, 0x55, 0x0A, 0x99, 0x75, 0xEB, 0x6C, 0x74, 0x5E, 0x81, 0x84, 0xE4, 0x3D, 0x10, 0x56,
-    0xB0, 0x27, 0x83, 0x8D, 0xBF, 0xEA, 0x6B, 0x64, 0xF0, 0xAF, 0xBC, 0x8E, 0xBC, 0xA6, 0xDC, 0x58,
-    0xCD, 0xEA, 0xF1, 0xD9, 0xDA, 0xA2, 0xBC, 0xF0, 0x62, 0x21, 0x3C, 0x65, 0x82, 0xA7, 0x31, 0xD6,
-    0x01, 0x13, 0xEB, 0x43, 0x5F, 0xAC, 0x57, 0xF7, 0x0A, 0x76, 0xFE, 0x01, 0x8C, 0xB8, 0x6F, 0xB1,
-    0x55, 0x0E, 0xFA, 0x7E, 0x8C, 0xB8, 0xCA, 0x02, 0xCA, 0x53, 0x98, 0x16, 0x80, 0x29, 0x88, 0x9E,
-    0xB2, 0x56, 0x8A, 0xC0, 0x57, 0x3E, 0xBC, 0x61, 0x67, 0xD1, 0x58, 0x50, 0x2F, 0x66, 0x23, 0xDE,
-    0x84, 0x1D, 0xB0, 0xC6, 0x7B, 0x1D, 0xDC, 0x62, 0x62, 0x80, 0x1D, 0x0C, 0x9B, 0xB5, 0x67, 0x49,
-    0x48, 0xDF, 0x80, 0x65, 0x6B, 0x4C, 0x94, 0x14, 0x63, 0xB1, 0xA6, 0x80, 0x81, 0x91, 0xC4, 0x18,
-    0x8B, 0x32, 0x13, 0xA0, 0xAD, 0x2F, 0x4B, 0x72, 0x22, 0xD0, 0x45, 0xE9, 0xA9, 0xD8, 0xB4, 0x49,
-    0x09, 0x02, 0xA0, 0x9C, 0xF2, 0x93, 0xD8, 0xEB, 0x3D, 0x78, 0xCB, 0x1A, 0x8F, 0x00, 0x5B, 0x6C,
-    0x31, 0x44, 0x94, 0xCD, 0x55, 0x3E, 0x37, 0xFB, 0x4C, 0x7E, 0x4A, 0xB2, 0xBC, 0x6B, 0x95, 0x82,
-    0xEE, 0x2C, 0xFC, 0x5A, 0x46, 0x30, 0xD1, 0x9A, 0xD1, 0xC4, 0x48, 0xCA, 0xCC, 0xFB, 0x88, 0xAF,
-    0x28, 0x69, 0x40, 0xD8, 0x56, 0xDA, 0x7C, 0xD6, 0xEA, 0x29, 0x71, 0x44, 0xBA, 0x92, 0xBA, 0xBE,
-    0x77, 0xC9, 0xAE, 0xF1, 0x10, 0x8C, 0x98, 0x4D, 0x0D, 0x88, 0x7A, 0xBB, 0x13, 0xB7, 0xFD, 0x1B,
-    0xB2, 0x65, 0x4C, 0x5B, 0x7C, 0xC9, 0x38, 0x97, 0xDD, 0x4E, 0x25, 0xD0, 0x1C, 0x52, 0xCB, 0x4E,
-    0x28, 0xB7, 0x56, 0x09, 0xB1, 0x64, 0xE1, 0x27, 0x16, 0x22, 0x67, 0xA3, 0x2A, 0x13, 0x0F, 0x31,
-    0x53, 0x8F, 0xCC, 0xFB, 0x5A, 0x7F, 0x0E, 0x13, 0xF1, 0x50, 0x25, 0x07, 0x36, 0x66, 0x41, 0x10,
-    0x74, 0x5C, 0x9D, 0xE3, 0x7A, 0x08, 0x2C, 0x64, 0x78, 0x17, 0x0B, 0xEE, 0x83, 0x66, 0x4A, 0x78,
-    0x58, 0xDB, 0xD6, 0x55, 0xA2, 0x07, 0x4A, 0x7A, 0x4F, 0x85, 0x57, 0x1E, 0x27, 0xB7, 0xA7, 0xD6,
-    0xB2, 0xDB, 0x38, 0x16, 0x38, 0x29, 0x4F, 0xC9, 0x8B, 0xFB, 0x4E, 0xDC, 0x93, 0x43, 0xFD, 0x9D,
-    0x29, 0x24, 0x76, 0x55, 0x98, 0x0E, 0xB1, 0x73, 0x58, 0x7E, 0x2B, 0xCE, 0x60, 0xAD, 0x13, 0xF2,
-    0x60, 0xCA, 0xE6, 0x31, 0x76, 0x17, 0x7A, 0x6F, 0x31, 0x6F, 0xF8, 0x2C, 0x6D, 0xCF, 0xBC, 0x2F,
-    0xE2, 0xFB, 0xAF, 0xD3, 0x72, 0x52, 0xA4, 0x5A, 0x76, 0x73, 0xFD, 0x5C, 0xD0, 0x08, 0x60, 0xA6,
-    0x09, 0x8B, 0x73, 0x71, 0x1E, 0xDD, 0x7C, 0xAB, 0xB5, 0xAD, 0xC7, 0xEC, 0xD9, 0x10, 0xAB, 0x4D,
-    0x90, 0x1E, 0x35, 0xBF, 0x3A, 0x8B, 0x4B, 0x6C, 0xC2, 0xF6, 0x6E, 0x23, 0x9E, 0xFF, 0xB7, 0x01,
-    0xD6, 0x3B, 0x7A, 0x14, 0x80, 0x19, 0x86, 0xED, 0xB0, 0x56, 0xA2, 0x32, 0xDA, 0x81, 0x21, 0x46,
-    0x64, 0x00, 0x69, 0x8C, 0x2E, 0x32, 0xD7, 0xFB, 0xDA, 0xEB, 0x45, 0x28, 0x87, 0x65, 0xA3, 0xFA,
-    0x93, 0x1B, 0x12, 0xE7, 0x1F, 0x5A, 0x79, 0x13, 0x2E, 0xDE, 0x52, 0xBF, 0x99, 0xF3, 0xB5, 0xB3,
-    0x69, 0x2F, 0x61, 0xBD, 0x4A, 0x19, 0x65, 0x6C, 0xF0, 0xF5, 0xB9, 0x8D, 0x1B, 0x57, 0xE9, 0x4E,
-    0xCD, 0xA4, 0x7C, 0x08, 0x51, 0x5D, 0x3D, 0x92, 0xD6, 0xB3, 0x94, 0x1A, 0xEE, 0x34, 0xBE, 0xE0,
-    0x46, 0xAE, 0xBB, 0xE7, 0x0A, 0x88, 0x82, 0xEB, 0x12, 0x89, 0xB9, 0x4C, 0x2F, 0xB0, 0x91, 0x06,
-    0xB7, 0xB6, 0x1A, 0xA6, 0x82, 0x3A, 0xC5, 0xDE, 0x3B, 0x26, 0xC2, 0xB0, 0x78, 0xCA, 0xEC, 0xE3,
-    0x17, 0x95, 0xC4, 0xE1, 0x9B, 0x59, 0x58, 0xAC, 0x7D, 0x82, 0xDB, 0x19, 0xFC, 0xC0, 0xA2, 0x8C,
-    0x11, 0x7E, 0xC8, 0x13, 0xF8, 0x5D, 0x41, 0xEF, 0x09, 0xFD, 0x53, 0x42, 0xC8, 0xBD, 0x22, 0xC4,
-    0x4C, 0xD8, 0xF3, 0x12, 0x5B, 0x24, 0x7E, 0xF6, 0xE4, 0xDF, 0x0C, 0x73, 0x08, 0x35, 0x0F, 0xCA,
-    0x9A, 0x9F, 0x6D, 0x6A, 0x9B, 0x73, 0x90, 0x2E, 0x98, 0xB1, 0x9B, 0xB5, 0xDE, 0xE1, 0x37, 0x3F,
-    0x3B, 0x63, 0xD3, 0xB0, 0x5A, 0x42, 0x2D, 0x71, 0x31, 0xC9, 0x0D, 0x5E, 0xA7, 0xD5, 0x7A, 0x3F,
-    0x77, 0x81, 0x76, 0x08, 0x0A, 0xC7, 0xEC, 0x48, 0x8B, 0x59, 0x4E, 0xC1, 0x3C, 0xE0, 0xD6, 0x8A,
-    0xA5, 0x5F, 0x87, 0x25, 0xA1, 0x08, 0xD0, 0xF0, 0xCF, 0x21, 0x24, 0x8E, 0x2D, 0xDE, 0xC6, 0xB6,
-    0x71, 0xFC, 0x47, 0x07, 0xFF, 0x93, 0x7F, 0x65, 0xD9, 0xEF, 0x9B, 0xE3, 0x5F, 0x13, 0xE5, 0x2D,
-    0x7E, 0xAE, 0xB8, 0x2D, 0x7C, 0x5A, 0x3D, 0xDB, 0x53, 0x01, 0x1C, 0xD7, 0x82, 0x0C, 0x45, 0xCC,
-    0x99, 0xBA, 0x98, 0x76, 0xD5, 0x01, 0xA2, 0x1A, 0x4D, 0xC3, 0x9C, 0x11, 0x23, 0xF7, 0x2E, 0x63,
-    0x96, 0x2E, 0xE8, 0x54, 0x88, 0xD8, 0x62, 0xA7, 0xD0, 0x1C, 0x83, 0xB1, 0x32, 0x0E, 0xF0, 0x41,
-    0x6B, 0x57, 0x47, 0xB0, 0x6B, 0x10, 0x8B, 0x31, 0xC6, 0x1F, 0x8F, 0x98, 0x34, 0x36, 0xAB, 0xCA,
-    0x7D, 0x8F, 0x5E, 0x02, 0x4C, 0x52, 0xCA, 0x9D, 0xCD, 0x62, 0x0C, 0x5A, 0xD2, 0x0D, 0x86, 0x10,
-    0xFF, 0x98, 0xE0, 0xED, 0xB7, 0xC1, 0xC5, 0xDF, 0xFD, 0x17, 0xDE, 0x31, 0x8A, 0xBF, 0xC5, 0x34,
-    0xF4, 0x7F, 0xA3, 0x11, 0x85, 0x75, 0x60, 0xFD, 0xC6, 0x66, 0x70, 0x19, 0x9B, 0x31, 0xA8, 0x6D,
-    0x6C, 0xC2, 0x97, 0xD6, 0x2E, 0xC9, 0x10, 0xE7, 0xC3, 0x56, 0x00, 0x3A, 0x46, 0x57, 0x99, 0x03,
-    0x7A, 0x17, 0x66, 0x29, 0x0A, 0x1F, 0x81, 0x75, 0x19, 0x3D, 0x11, 0x22, 0x90, 0xBC, 0x9D, 0x8F,
-    0x6B, 0xE3, 0x2E, 0xA9, 0xFE, 0x36, 0x01, 0x62, 0xBF, 0x66, 0x80, 0x2C, 0x58, 0x58, 0x77, 0x75,
-    0xF6, 0x09, 0x66, 0x9B, 0x9C, 0xB6, 0x5F, 0xBF, 0xDD, 0x01, 0xDE, 0xF4, 0x95, 0x73, 0x45, 0xDA,
-    0xED, 0xF0, 0x66, 0xBE, 0xD1, 0xC4, 0x44, 0xCB, 0x28, 0x63, 0xCD, 0xA8, 0x3B, 0x60, 0x0B, 0x8A,
-    0x12, 0x98, 0xBB, 0x7D, 0x64, 0x1E, 0x0C, 0xD7, 0x36, 0xBD, 0xA7, 0x8E, 0xFA, 0xE2, 0x0B, 0x62,
-    0x21, 0x44, 0x42, 0xB1, 0xBA, 0x53, 0x83, 0x75, 0xF1, 0x65, 0x32, 0xE4, 0x1F, 0xD7, 0xE9, 0xB2,
-    0xFB, 0x9C, 0x8E, 0x8A, 0xA9, 0x07, 0x31, 0x9F, 0x6B, 0xF3, 0xBB, 0x36, 0x77, 0xE7, 0x0F, 0x61,
-    0xB0, 0x63, 0x3B, 0x97, 0xFE, 0x10, 0x37, 0xCE, 0x9E, 0xA6, 0x71, 0xE8, 0xFB, 0xAB, 0x99, 0x9D,
-    0x7B, 0xB7, 0xBD, 0xCF, 0x2B, 0xBE, 0x32, 0x62, 0xAF, 0x31, 0x04, 0xCB, 0x1F, 0x9A, 0x98, 0x3B,
-    0x66, 0xB2, 0x96, 0xB8, 0xEB, 0x73, 0xA2, 0xD1, 0x5F, 0x2F, 0xC9, 0x57, 0x4E, 0xED, 0xED, 0xCF,
-    0x3A, 0xAE, 0x9E, 0xF2, 0x19, 0xA9, 0xD9, 0xA9, 0xE3, 0xD5, 0x7C, 0x96, 0x7D, 0x85, 0x85, 0xC7,
-    0x79, 0xFD, 0x9D, 0xDF, 0x33, 0x0F, 0xCE, 0xA2, 0xDF, 0xFB, 0x8E, 0xB9, 0xF7, 0x92, 0x49, 0x56,
-    0xE9, 0xD5, 0x9D, 0xF6, 0x6F, 0x9C, 0x1F, 0x50, 0x17, 0xDE, 0xEC, 0xEF, 0x1F, 0x3A, 0x15, 0xBE,
-    0xE2, 0xF7, 0xB4, 0xA5, 0xC7, 0x04, 0xD1, 0x55, 0x94, 0x49, 0x08, 0xCA, 0x66, 0x04, 0x5C, 0xFC,
-    0xBB, 0x5E, 0x6A, 0x2F, 0x4E, 0xEF, 0xA3, 0x53, 0xBD, 0xCF, 0xFC, 0xE2, 0xAF, 0x3F, 0xB6, 0xF6,
-    0xF0, 0x52, 0xA2, 0x75, 0xF4, 0xBA, 0xEF, 0x7E, 0x43, 0x8C, 0xF8, 0xAF, 0xFF, 0xE9, 0x9B, 0x9F,
-    0xD5, 0x07, 0xE6, 0x92, 0xF9, 0xE4, 0x5F, 0xF4, 0xB6, 0x5C, 0x3C, 0x21, 0x4D, 0x30, 0xDA, 0xC9,
-    0xFF, 0x80, 0x91, 0xFA, 0x7F, 0x19, 0x58, 0x6B, 0xCC, 0x7A, 0x23, 0x13, 0x38, 0xD7, 0x73, 0xFC,
-    0x0B, 0xCF, 0x0E, 0x11, 0xFD, 0x1F, 0xDC, 0x39, 0xDE, 0x1F, 0x0E, 0xC6, 0x6A, 0xD0, 0xFB, 0x7A,
-    0x00, 0x86, 0xFA, 0xFE, 0xD9, 0xA1, 0x8C, 0xC0, 0xAE, 0x03, 0x1A, 0xB7, 0x80, 0xD7, 0x45, 0x45,
-    0x2F, 0x1D, 0x7D, 0x33, 0xAD, 0xB8, 0xF4, 0x2F, 0xF1, 0xFA, 0xCC, 0xE6, 0xD3, 0x3F, 0xEA, 0xCB,
-    0x66, 0x36, 0xDD, 0xD4, 0xB3, 0xB9, 0xBF, 0xE4, 0x52, 0xD0, 0x5A, 0xC6, 0xE4, 0x27, 0xAD, 0x25,
-    0xFD, 0x8F, 0x9F, 0x94, 0x19, 0xE4, 0xBE, 0x4B, 0x1B, 0x34, 0xAC, 0x54, 0xD3, 0xB7, 0x7B, 0x11,
-    0x76, 0xCF, 0x52, 0xC4, 0xB1, 0x67, 0xF8, 0x20, 0x0A, 0xED, 0x30, 0x0B, 0x6B, 0xD9, 0xA3, 0x81,
-    0x5D, 0x83, 0x48, 0x7E, 0xE5, 0x2E, 0xA3, 0xBB, 0xA5, 0x7A, 0xB2, 0x29, 0xEB, 0x87, 0x3B, 0xB9,
-    0x2D, 0xA2, 0xB0, 0xBF, 0x60, 0xB0, 0x4F, 0x88, 0x31, 0xE6, 0xF4, 0x7E, 0x0D, 0xD1, 0x1B, 0xC2,
-    0x63, 0x76, 0x1F, 0x26, 0x57, 0x59, 0x46, 0x61, 0xE2, 0xBF, 0xAE, 0x81, 0xD6, 0x5F, 0x82, 0xC5,
-    0x61, 0xDC, 0x4A, 0x64, 0x1C, 0x30, 0xD4, 0x0A, 0xB3, 0xDA, 0x67, 0x10, 0x84, 0x6F, 0x84, 0xFC,
-    0x11, 0x9B, 0x72, 0xCE, 0xB0, 0xAB, 0x6D, 0xCC, 0xAC, 0x53, 0xC2, 0x38, 0x0E, 0x2B, 0x1C, 0x9F,
-    0x43, 0xE4, 0x93, 0x54, 0x07, 0x16, 0x00, 0x59, 0x07, 0x23, 0xF0, 0x1C, 0x9B, 0x01, 0x9F, 0xCB,
-    0x39, 0x9C, 0x1F, 0x48, 0x99, 0x00, 0x91, 0x02, 0x6E, 0x3F, 0x53, 0xD9, 0x10, 0xE8, 0x7C, 0xDF,
-    0xA4, 0x64, 0xBE, 0xC5, 0x84, 0x31, 0x33, 0x84, 0xCC, 0xA2, 0xAD, 0x73, 0x97, 0xA9, 0x72, 0x97,
-    0x65, 0xA2, 0xBE, 0x79, 0x5B, 0x3E, 0x06, 0x6E, 0xCD, 0x26, 0x60, 0xD9, 0xAE, 0x7B, 0x33, 0x4D,
-    0xBA, 0xA7, 0xEB, 0x70, 0x89, 0xB5, 0x4D, 0x99, 0x6D, 0xE7, 0xC3, 0xB9, 0xE8, 0x61, 0xFF, 0xE4,
-    0xFB, 0x87, 0x3C, 0xD3, 0x89, 0xE5, 0x39, 0x47, 0x8D, 0x17, 0xF5, 0xC6, 0xB6, 0xA1, 0x0F, 0xE5,
-    0x99, 0x8A, 0xCD, 0x3C, 0x13, 0x10, 0xB6, 0xDB, 0xEC, 0x7E, 0xA3, 0xF3, 0x37, 0xF2, 0x4C, 0xEB,
-    0xDA, 0xCF, 0xE9, 0xD5, 0xE5, 0x90, 0xF5, 0x86, 0xF3, 0xFC, 0xDB, 0xBF, 0xD3, 0x76, 0xE4, 0x44,
-    0x7C, 0x59, 0xD7, 0x21, 0xD6, 0x48, 0xC2, 0xD4, 0xB3, 0xB5, 0xA1, 0x49, 0x62, 0x66, 0xCC, 0xE2,
-    0xF6, 0x35, 0x8F, 0x99, 0x82, 0xDD, 0xCA, 0x2C, 0x1F, 0x27, 0x4E, 0x42, 0x6C, 0xA4, 0xC2, 0xF3,
-    0xD8, 0xEE, 0x70, 0xBB, 0x6F, 0xEA, 0x15, 0xCF, 0xB5, 0x7E, 0xB1, 0xDB, 0x04, 0xAF, 0xCE, 0xCA,
-    0x50, 0x1B, 0x19, 0x9E, 0x4D, 0x89, 0x87, 0x80, 0xF1, 0xC5, 0xD8, 0x64, 0xA3, 0xEF, 0x72, 0xA8,
-    0x93, 0x7D, 0xB8, 0xB4, 0xBD, 0xE8, 0x4B, 0xDB, 0xEC, 0x1B, 0xF0, 0x37, 0x4B, 0xDB, 0xEC, 0x3B,
-    0x0B, 0x9F, 0xBA, 0x56, 0xF9, 0xD5, 0xDF, 0xC2, 0xB6, 0x87, 0xAD, 0xF9, 0x40, 0xA5, 0xED, 0x25,
-    0xAE, 0x7F, 0x8C, 0x2D, 0x81, 0x2C, 0xB2, 0xDD, 0x73, 0xCC, 0xB0, 0x06, 0xB9, 0xD9, 0xDC, 0xB5,
-    0xB4, 0xB1, 0x53, 0x8F, 0x9B, 0xC8, 0x16, 0xAA, 0x25, 0x5D, 0xD9, 0x6C, 0xFB, 0x74, 0x3F, 0x66,
-    0x8F, 0x42, 0xB8, 0xD1, 0x41, 0x7A, 0xD7, 0x99, 0x98, 0x3E, 0x14, 0x0C, 0x86, 0x1A, 0xE8, 0xBD,
-    0x7B, 0x35, 0x4B, 0x4B, 0xD1, 0xF6, 0xB9, 0x3B, 0x76, 0x86, 0xE5, 0x1F, 0xB1, 0x33, 0xCC, 0x7E,
-    0x6C, 0x3E, 0x8A, 0xBA, 0xCD, 0xA6, 0xD4, 0xD3, 0x37, 0xCE, 0xE1, 0x12, 0x5B, 0xF4, 0xBA, 0x93,
-    0xBA, 0xF1, 0xDD, 0xA8, 0xDB, 0xDB, 0x83, 0xDC, 0xE5, 0xD1, 0xDE, 0xE5, 0xDE, 0x9B, 0x34, 0x46,
-    0x79, 0x27, 0x6E, 0xE4, 0xC8, 0xBD, 0xE1, 0x6F, 0x0E, 0x61, 0xBD, 0x8F, 0xCC, 0xD4, 0x40, 0xC7,
-    0x72, 0xFB, 0x3C, 0x3F, 0xBF, 0x2B, 0x97, 0x5E, 0xA5, 0x7F, 0x69, 0x8D, 0xD6, 0x3B, 0x8B, 0xF3,
-    0x30, 0xF5, 0x99, 0xBE, 0xA9, 0x62, 0x75, 0x36, 0x3B, 0x35, 0x03, 0xA0, 0x29, 0x5E, 0x44, 0x1B,
-    0xF3, 0xF5, 0x9E, 0x3F, 0xC6, 0x05, 0xA1, 0xF6, 0x24, 0xDC, 0xEF, 0xAE, 0x94, 0x30, 0x63, 0x7B,
-    0x91, 0x50, 0x94, 0xE8, 0x2C, 0xEE, 0xA0, 0x93, 0x19, 0x3E, 0x3C, 0xC5, 0xAB, 0x66, 0x59, 0xC3,
-    0xAD, 0x35, 0x90, 0xF8, 0xF0, 0xD1, 0x9C, 0x19, 0x5E, 0x16, 0x30, 0x87, 0x0E, 0x05, 0x9F, 0x25,
-    0xA9, 0xCF, 0x06, 0x35, 0xFB, 0x93, 0x16, 0x65, 0xBF, 0xEA, 0x6A, 0x34, 0x61, 0xF2, 0xD7, 0xAB,
-    0xD5, 0x09, 0x1D, 0x70, 0x0F, 0xD2, 0x3A, 0xE3, 0xC8, 0x94, 0x54, 0x13, 0x9E, 0x6D, 0x04, 0x14,
-    0x05, 0x1B, 0xC7, 0xB1, 0x60, 0x77, 0x2C, 0x68, 0x6C, 0xC2, 0x03, 0x0B, 0xDF, 0xD4, 0x4B, 0x6A,
-    0x92, 0x69, 0x6D, 0x81, 0xA3, 0xBA, 0x09, 0x6A, 0xF6, 0x76, 0x63, 0x2A, 0x4D, 0xA2, 0xA0, 0x88,
-    0x01, 0xA8, 0xD9, 0x65, 0xC6, 0x07, 0x08, 0x94, 0x1B, 0x38, 0x8C, 0xCF, 0x12, 0xD4, 0x2D, 0xD6,
-    0x9A, 0x0B, 0xA7, 0xCB, 0xD8, 0x4C, 0x22, 0xDB, 0x79, 0x64, 0x1E, 0xE3, 0xF5, 0xCE, 0x29, 0xD3,
-    0x4B, 0xE6, 0xD1, 0x8F, 0xFB, 0x09, 0x4F, 0xEE, 0x35, 0x41, 0x1D, 0xAE, 0x98, 0xA3, 0xCA, 0x1F,
-    0x58, 0xBA, 0x55, 0xFC, 0x12, 0xA3, 0xA8, 0x27, 0xD5, 0xA1, 0x38, 0xB2, 0x3B, 0x23, 0x2B, 0xB5,
-    0x71, 0xF8, 0xD7, 0x2A, 0xDB, 0xD8, 0x94, 0x29, 0x70, 0xA3, 0x1D, 0x0D, 0x2F, 0xBE, 0xA4, 0x2E,
-    0x8F, 0x50, 0x99, 0x92, 0x6A, 0x42, 0x01, 0x89, 0x1F, 0x62, 0x61, 0xCD, 0x6D, 0xC3, 0x74, 0x9F,
-    0xDE, 0x60, 0x04, 0xA7, 0x1B, 0xB1, 0x49, 0xB7, 0xB3, 0x8D, 0x4D, 0xE3, 0x4D, 0x07, 0xE5, 0xE7,
-    0x9B, 0x94, 0x5A, 0x01, 0x77, 0xCE, 0x7D, 0x7A, 0x9B, 0x43, 0xBE, 0x4A, 0x37, 0xDA, 0xBB, 0x45,
-    0x36, 0x51, 0xEF, 0x5A, 0x58, 0xC0, 0xD8, 0xF6, 0x97, 0x6A, 0xB7, 0x7A, 0x4E, 0xC3, 0xF9, 0xFA,
-    0xE0, 0x44, 0xAD, 0xB1, 0xCE, 0x49, 0x1F, 0x7C, 0x7A, 0x9D, 0x5D, 0x76, 0x11, 0xB3, 0x95, 0x75,
-    0x17, 0xB2, 0xE9, 0xB3, 0xE6, 0x82, 0x48, 0x2A, 0x66, 0xDE, 0x98, 0xAB, 0xE9, 0xBD, 0xC2, 0xE8,
-    0x94, 0xB1, 0xD5, 0x82, 0xC4, 0xBE, 0x4F, 0x69, 0x65, 0xF6, 0x63, 0xC4, 0x5A, 0x51, 0x25, 0x44,
-    0x96, 0xD0, 0x08, 0xA8, 0x71, 0x99, 0x7B, 0xE4, 0xCC, 0x61, 0x1A, 0xD9, 0xEC, 0xBD, 0xB7, 0x6E,
-    0x34, 0x51, 0xE2, 0x67, 0xEB, 0x58, 0x32, 0xE6, 0x01, 0xE5, 0xBE, 0x7F, 0x60, 0xB4, 0x7D, 0x21,
-    0x50, 0xCB, 0x28, 0x93, 0x29, 0x04, 0xE1, 0xEC, 0x17, 0x27, 0x2A, 0x26, 0x56, 0x0B, 0x5F, 0xCC,
-    0x14, 0x96, 0x30, 0x9D, 0x11, 0x39, 0xAC, 0x57, 0xED, 0xB3, 0xB4, 0x47, 0x08, 0x5B, 0x1E, 0xCF,
-    0x7C, 0x05, 0xBD, 0x6D, 0x3A, 0xB1, 0x39, 0xB1, 0x6C, 0x3D, 0xB1, 0xBF, 0x2B, 0xE1, 0x11, 0xD8,
-    0x00, 0x1C, 0xB2, 0x84, 0x31, 0x5B, 0x4F, 0x0C, 0x94, 0x2D, 0x18, 0x15, 0x32, 0x0E, 0xB4, 0x13,
-    0x8B, 0x39, 0xB1, 0x05, 0xE3, 0x24, 0x26, 0x4E, 0xC3, 0xA3, 0x89, 0xD1, 0x6B, 0xBA, 0xB5, 0xDD,
-    0x0E, 0x6B, 0xEB, 0x6C, 0x5F, 0x6F, 0x9C, 0x77, 0x5E, 0x2B, 0xDD, 0x77, 0x6F, 0xA6, 0xDE, 0x7B,
-    0x00, 0x8C, 0x6F, 0x20, 0x02, 0xFB, 0x29, 0x64, 0xFD, 0xA6, 0xC5, 0x99, 0xE1, 0xD3, 0x99, 0x86,
-    0x0C, 0x2F, 0x80, 0xF6, 0x33, 0xA0, 0x7D, 0x6B, 0x6E, 0xC6, 0x0F, 0x26, 0xB6, 0xCE, 0xB6, 0xA6,
-    0xF1, 0xC2, 0x4F, 0xFC, 0xD2, 0xEB, 0x2A, 0x84, 0xC6, 0xDD, 0xF3, 0x6C, 0x20, 0xDD, 0x25, 0xF3,
-    0x49, 0x23, 0x37, 0xBB, 0xBC, 0xC6, 0xEC, 0xFF, 0xEE, 0xC0, 0xFC, 0xDB, 0x77, 0x67, 0xFE, 0x98,
-    0x09, 0x48, 0x4B, 0xA3, 0x73, 0x8C, 0xC6, 0x63, 0x35, 0xC8, 0x1F, 0x80, 0xA7, 0xAD, 0x71, 0xF6,
-    0xCF, 0x0F, 0xFB, 0xB4, 0xC8, 0xFB, 0x1A, 0xBC, 0x47, 0x98, 0x12, 0xA7, 0x5E, 0x05, 0x35, 0xF8,
-    0xF9, 0x1D, 0xF4, 0x8B, 0xF7, 0xC5, 0x9D, 0xBC, 0x17, 0xFD, 0x09, 0xD0, 0x60, 0x83, 0x6F, 0x7E,
-    0xF5, 0xC0, 0x8C, 0x99, 0x04, 0xE5, 0x2C, 0x46, 0x14, 0xC9, 0x89, 0x7A, 0xFF, 0xA9, 0x91, 0xAD,
-    0xB6, 0xBE, 0xB6, 0x7D, 0x90, 0xCD, 0x32, 0x95, 0x71, 0x29, 0x3F, 0x2C, 0x90, 0x29, 0x6B, 0x03,
-    0x82, 0xF7, 0xB9, 0x78, 0xDC, 0x06, 0x99, 0x47, 0xD9, 0xD0, 0xC8, 0xCE, 0x84, 0x10, 0x6B, 0x00,
-    0x31, 0x45, 0xFC, 0xDB, 0x7B, 0xE6, 0xD4, 0x0E, 0x8C, 0xF5, 0x9F, 0x3E, 0x53, 0xB2, 0xC1, 0x8B,
-    0x9C, 0xC3, 0x2B, 0xE6, 0xD5, 0xAF, 0xC3, 0x95, 0x53, 0xCB, 0xC9, 0x96, 0x09, 0x95, 0x81, 0xA5,
-    0xE6, 0xA7, 0x6A, 0xE5, 0xBF, 0x95, 0x6A, 0x9A, 0x18, 0x6D, 0xA5, 0xCA, 0x55, 0x66, 0x50, 0x65,
-    0x5A, 0xC5, 0x68, 0xEE, 0x87, 0x71, 0xD8, 0x54, 0xAF, 0x02, 0xB5, 0xCA, 0xD2, 0xAC, 0x44, 0xAB,
-    0x68, 0xCD, 0xD8, 0x91, 0xC6, 0xA3, 0xF5, 0x6E, 0x6D, 0x3F, 0x66, 0x2F, 0x67, 0xB9, 0x5A, 0x95,
-    0x6D, 0x15, 0xB3, 0x13, 0x7B, 0xB9, 0x43, 0x7F, 0xEC, 0xFF, 0x84, 0x65, 0x6D, 0x6E, 0xB3, 0xEF,
-    0x8E, 0xE5, 0x17, 0x55, 0xA7, 0x96, 0xCC, 0x4F, 0x7A, 0x4B, 0x71, 0xC5, 0xDC, 0x8B, 0x71, 0xBC,
-    0x22, 0xB2, 0x8D, 0x5A, 0xF3, 0x61, 0xF3, 0xAD, 0x76, 0x29, 0x46, 0xB6, 0xD0, 0xD0, 0xAA, 0xBE,
-    0xCE, 0x37, 0x59, 0x7B, 0x8F, 0xEC, 0x03, 0xD9, 0xC3, 0x9D, 0x54, 0x00, 0x7C, 0x77, 0xFA, 0x72,
-    0xE9, 0x55, 0xB3, 0xC6, 0x48, 0x8B, 0x25, 0x57, 0xB5, 0x23, 0x40, 0x34, 0x87, 0xE7, 0x6D, 0x2D,
-    0x5E, 0x73, 0xEC, 0xF7, 0x75, 0xF5, 0x75, 0x79, 0x95, 0xE6, 0x6D, 0x75, 0xDE, 0xEF, 0x6C, 0x4A,
-    0x83, 0x86, 0x32, 0x7C, 0x95, 0x5B, 0xAA, 0xB5, 0xC5, 0xA7, 0x2F, 0xD6, 0xDB, 0x7A, 0xFD, 0x66,
-    0xC9, 0x5E, 0xBB, 0x88, 0xF8, 0x6F, 0x3E, 0x94, 0xEF, 0x6D, 0x05, 0x9F, 0x73, 0xDB, 0xBB, 0x84,
-    0xBB, 0xBA, 0x25, 0xBB, 0xE4, 0xF7, 0xB2, 0xB8, 0x7F, 0xAA, 0x38, 0x65, 0x1F, 0x3A, 0x55, 0x99,
-    0x43, 0x4F, 0x6B, 0xB9, 0xA8, 0x76, 0xE7, 0xA1, 0xCA, 0xFF, 0xDA, 0x52, 0x64, 0x6F, 0x88, 0x87,
-    0x1B, 0x0A, 0xCD, 0x74, 0xA6, 0xDC, 0x72, 0x60, 0x7B, 0x53, 0x97, 0xDB, 0x8F, 0xD9, 0xFE, 0xF0,
-    0x58, 0xBE, 0x97, 0xB3, 0xD7, 0xCE, 0x09, 0x15, 0x8F, 0x0A, 0x63, 0x37, 0x4F, 0xA8, 0x16, 0x61,
-    0x3B, 0x4A, 0x0E, 0xCF, 0xA9, 0xF7, 0xA0, 0x63, 0xDD, 0x82, 0x2D, 0xD3, 0xBA, 0x73, 0x96, 0x6A,
-    0xEF, 0x59, 0xAB, 0xAD, 0x3E, 0xC1, 0xCB, 0xBA, 0x73, 0x9C, 0x70, 0x3A, 0xDE, 0x1B, 0x54, 0x3D,
-    0x33, 0xD6, 0x76, 0x22, 0xEF, 0x2D, 0x75, 0x2D, 0x8C, 0xB5, 0x03, 0xA3, 0x0F, 0x24, 0xDB, 0x8D,
-    0x2C, 0x94, 0x67, 0xBD, 0xC2, 0x81, 0x76, 0xE1, 0xDA, 0x18, 0x49, 0x3E, 0xD1, 0xEF, 0x8E, 0xB6,
-    0x4B, 0xEF, 0xED, 0xED, 0x69, 0xFB, 0x19, 0x56, 0xE1, 0x83, 0xBD, 0x83, 0xDE, 0xF9, 0xBA, 0xDA,
-    0xB7, 0xA9, 0x0A, 0xB7, 0x76, 0xA1, 0xB3, 0x4F, 0x5B, 0xAD, 0x30, 0x98, 0x22, 0x22, 0xD9, 0xB3,
-    0xAD, 0xF6, 0xAB, 0x96, 0xDC, 0x73, 0x9C, 0xB0, 0xEE, 0xE3, 0xBE, 0xAB, 0x24, 0x2F, 0x2B, 0xD2,
-    0x4C, 0x16, 0xF4, 0x7B, 0xDB, 0x37, 0xF2, 0xEC, 0xA2, 0x87, 0xC1, 0x88, 0x73, 0xB6, 0x93, 0x2F,
-    0xCA, 0x8F, 0x72, 0x63, 0x03, 0xD6, 0xA3, 0xCD, 0x63, 0x69, 0xEA, 0xF0, 0x84, 0x2D, 0x91, 0x1F,
-    0x98, 0xD3, 0x25, 0x0C, 0x7E, 0x77, 0xAD, 0x72, 0x96, 0x07, 0x89, 0x49, 0x60, 0xD2, 0xFD, 0x22,
-    0x99, 0x9B, 0xD6, 0xBB, 0xCD, 0x9A, 0x0F, 0xB3, 0xFC, 0x50, 0xB7, 0x74, 0x8C, 0x5F, 0x82, 0xD7,
-    0xF1, 0x4B, 0x3B, 0x77, 0xEA, 0xE8, 0xBB, 0x65, 0x78, 0xB1, 0x4A, 0xD2, 0xB6, 0x75, 0x56, 0x01,
-    0xF0, 0x69, 0xD7, 0xFD, 0x2C, 0x0D, 0xB8, 0x2B, 0xD5, 0x79, 0xA8, 0xF7, 0xE2, 0xA7, 0x19, 0xB6,
-    0x36, 0xC6, 0x3B, 0xBC, 0x0F, 0x44, 0x39, 0x29, 0x60, 0x2B, 0x20, 0x4F, 0xD7, 0x8C, 0x60, 0xD3,
-    0x27, 0x5E, 0x39, 0x41, 0x5C, 0x30, 0x99, 0x07, 0xF9, 0x1C, 0xAF, 0x66, 0x12, 0x5C, 0xAB, 0xC6,
-    0xFE, 0x6B, 0x45, 0xF2, 0x70, 0x97, 0x81, 0x43, 0xE7, 0x5C, 0x72, 0xE9, 0xFE, 0xA0, 0xFC, 0x14,
-    0xD2, 0x0E, 0x9F, 0xA7, 0xF8, 0x64, 0xEA, 0xAC, 0x56, 0xCA, 0xEC, 0x0B, 0x7D, 0x80, 0x43, 0x37,
-    0x74, 0xA2, 0xE9, 0x5B, 0x1D, 0xE5, 0xC8, 0x83, 0x4F, 0x9E, 0x76, 0x50, 0x97, 0x0E, 0x43, 0x9F,
-    0x27, 0xE4, 0xA1, 0x39, 0x5E, 0xC5, 0xD1, 0xE8, 0xEE, 0xCE, 0x19, 0xED, 0x97, 0xD6, 0xB6, 0xAB,
-    0x0B, 0xAF, 0x9E, 0xBF, 0xB3, 0xD7, 0xE8, 0x17, 0x6E, 0xB9, 0xDA, 0xDC, 0x1F, 0x7C, 0xCB, 0xB6,
-    0x35, 0x2A, 0x2D, 0xB1, 0x79, 0xA6, 0x46, 0x7F, 0xAD, 0xE8, 0x06, 0xB9, 0x60, 0xDC, 0xD6, 0xAC,
-    0x45, 0x74, 0x1E, 0x4D, 0x77, 0x2E, 0x3C, 0x5E, 0x06, 0x0D, 0x6E, 0x6A, 0x59, 0x41, 0x50, 0xA8,
-    0x90, 0x28, 0x58, 0x60, 0x2E, 0x28, 0x62, 0x5B, 0x4B, 0xAD, 0xA6, 0x53, 0x9A, 0xE8, 0xB9, 0x36,
-    0xFA, 0x8F, 0x65, 0x6D, 0xD8, 0x15, 0x68, 0x7B, 0x02, 0xF5, 0xF1, 0x54, 0xDB, 0x6F, 0xA3, 0x9A,
-    0x72, 0xE8, 0xB6, 0x1B, 0xE8, 0xCC, 0xD6, 0x72, 0xAC, 0xFC, 0x39, 0xF5, 0x10, 0x99, 0xCA, 0x99,
-    0x8F, 0x94, 0x50, 0x74, 0xD8, 0x1D, 0x52, 0x45, 0x00, 0x82, 0x61, 0xCA, 0xE2, 0x52, 0xA2, 0x1D,
-    0x44, 0x7E, 0xDE, 0xC8, 0xDB, 0x32, 0x19, 0xEA, 0x42, 0x5E, 0x94, 0x7F, 0xB9, 0xDB, 0xAC, 0x4B,
-    0xFB, 0xE2, 0xF2, 0xD2, 0xC4, 0x7D, 0xCB, 0xB8, 0x7F, 0x05, 0x8B, 0xF2, 0x08, 0x0F, 0x08, 0x49,
-    0xD9, 0xFA, 0x32, 0x56, 0xFD, 0xB3, 0xA4, 0x9B, 0x98, 0xAB, 0x63, 0x13, 0x31, 0x99, 0x79, 0x07,
-    0x03, 0xD3, 0x51, 0x31, 0x83, 0x8F, 0x9B, 0x17, 0xB6, 0x15, 0x5F, 0xBB, 0x7C, 0xFB, 0x3D, 0x26,
-    0x85, 0xE9, 0x4F, 0x64, 0x58, 0x83, 0x11, 0x36, 0x3E, 0x44, 0x6C, 0xB5, 0xCB, 0x23, 0xED, 0xCF,
-    0x67, 0xDE, 0x8B, 0x75, 0x4D, 0x1A, 0x93, 0xBC, 0xB1, 0x9D, 0xB3, 0xCC, 0x0E, 0x07, 0xCB, 0x3E,
-    0x5B, 0xD4, 0x4B, 0x9E, 0xD7, 0x75, 0x85, 0xA3, 0xCD, 0x54, 0x77, 0x6E, 0xF1, 0x93, 0x38, 0xB2,
-    0x00, 0x40, 0x1B, 0x98, 0x72, 0x97, 0x02, 0x49, 0xB6, 0x23, 0xBB, 0xD6, 0xAE, 0x93, 0x68, 0x16,
-    0x78, 0x44, 0x75, 0xC4, 0x4E, 0xC2, 0x17, 0xE9, 0xBC, 0x72, 0x4B, 0x77, 0xD0, 0x1F, 0xFF, 0x91,
-    0x40, 0x8B, 0x22, 0x82, 0xB6, 0xF5, 0x2E, 0xF7, 0x63, 0x9B, 0x07, 0x3F, 0xCD, 0x7D, 0x69, 0xFB,
-    0xDC, 0xDF, 0x39, 0x43, 0x98, 0xAE, 0x9C, 0xFC, 0xC6, 0x46, 0x7F, 0xB9, 0xB2, 0x68, 0x0D, 0x81,
-    0x01, 0xDD, 0x7E, 0x60, 0x4E, 0xB1, 0x8B, 0x3D, 0x53, 0x83, 0x04, 0x9D, 0x3D, 0x42, 0x10, 0xEB,
-    0xDC, 0x99, 0x44, 0x20, 0xC4, 0xA2, 0x06, 0x7A, 0x1D, 0x3D, 0x7E, 0xAE, 0x6D, 0x9E, 0xDC, 0xC2,
-    0xE3, 0x34, 0x92, 0xAC, 0x45, 0xDE, 0xEA, 0x12, 0x49, 0xF1, 0xD6, 0x9D, 0x3E, 0xED, 0x9C, 0x34,
-    0x28, 0x78, 0x1A, 0x76, 0xDF, 0xFB, 0xF9, 0xDE, 0x6A, 0xEF, 0x6C, 0xAD, 0xC3, 0x24, 0xAC, 0xED,
-    0xD7, 0x6E, 0x5F, 0x6D, 0x83, 0xB3, 0xFB, 0xE3, 0xC6, 0xFD, 0x16, 0xDE, 0x64, 0xF3, 0x93, 0xB6,
-    0xDF, 0x0F, 0x3F, 0x7C, 0x92, 0xDB, 0x4F, 0xFC, 0xFE, 0x13, 0x96, 0xE7, 0xD5, 0x45, 0xA0, 0x12,
-    0x7F, 0xBB, 0x46, 0xFB, 0x9A, 0xA5, 0x5C, 0xB7, 0x4D, 0x43, 0xCD, 0xED, 0x5C, 0xBF, 0xBC, 0xB7,
-    0x77, 0xF2, 0xCF, 0x70, 0xF1, 0xFC, 0xDB, 0x07, 0x3F, 0x14, 0x40, 0x21, 0xD2, 0xA2, 0x78, 0x6B,
-    0x67, 0x1E, 0x6B, 0x21, 0xDA, 0x98, 0x37, 0xD2, 0xC6, 0x7B, 0xCD, 0x6F, 0x64, 0x62, 0xEE, 0xDB,
-    0x86, 0x76, 0xB9, 0x37, 0x33, 0x36, 0x12, 0x67, 0xE1, 0xD2, 0xAF, 0x11, 0x8F, 0xD3, 0x0A, 0xB8,
-    0x43, 0xFF, 0xB4, 0x26, 0xAB, 0x02, 0x65, 0x1A, 0x64, 0xE6, 0x0C, 0x1D, 0x0E, 0x77, 0xDE, 0x81,
-    0x17, 0x93, 0xD8, 0xB6, 0x0D, 0xB5, 0x63, 0xED, 0x99, 0x65, 0xC0, 0xE8, 0x54, 0x94, 0x9D, 0x7D,
-    0x60, 0xC6, 0x64, 0xAF, 0x2B, 0x62, 0x88, 0xA1, 0xFB, 0xA3, 0x47, 0xEF, 0x16, 0x90, 0xD3, 0x00,
-    0x55, 0xF6, 0x35, 0xA8, 0xD3, 0x26, 0x40, 0x3E, 0x91, 0xB2, 0x7B, 0x59, 0xE9, 0x62, 0x75, 0x2F,
-    0xCF, 0xEF, 0xE8, 0x5E, 0x5E, 0xD9, 0xEE, 0xE5, 0x3E, 0x72, 0x6F, 0xED, 0xE0, 0x30, 0x75, 0x3C,
-    0x8B, 0x26, 0xB2, 0xC4, 0x27, 0x76, 0xD4, 0xE9, 0xC7, 0x12, 0xEE, 0xA4, 0xCD, 0xC8, 0x7F, 0xB2,
-    0x9E, 0x04, 0x67, 0xAB, 0x79, 0x08, 0xA1, 0x0F, 0x41, 0xF8, 0xB3, 0x3D, 0xE1, 0x07, 0x20, 0x7C,
-    0x2B, 0xE4, 0x0B, 0x26, 0x14, 0x77, 0x3E, 0x77, 0x3C, 0x93, 0x70, 0x9C, 0xC0, 0xC9, 0xE7, 0xC2,
-    0x3F, 0xBB, 0x76, 0xAD, 0x6E, 0xB7, 0x66, 0xC1, 0xF5, 0xBF, 0xAC, 0x66, 0x8B, 0x03, 0x97, 0x04,
-    0x42, 0x8B, 0x42, 0x10, 0x58, 0xB6, 0xE6, 0xF7, 0xFA, 0x76, 0x4C, 0xB0, 0x76, 0x72, 0xDC, 0x9E,
-    0x1E, 0x8F, 0xD0, 0xFF, 0x5D, 0xEA, 0xBD, 0xDD, 0xD5, 0x7E, 0x77, 0xBB, 0x0D, 0xDE, 0x34, 0xBB,
-    0x4C, 0xC3, 0x7F, 0x3C, 0xC3, 0xDD, 0x6A, 0x3E, 0x6C, 0xC3, 0xFB, 0xA8, 0x34, 0x42, 0x13, 0x17,
-    0xE6, 0x56, 0xD7, 0x38, 0xEF, 0xBF, 0xDA, 0x22, 0x70, 0x9F, 0x78, 0x77, 0xEB, 0xE2, 0xFB, 0x88,
-    0x46, 0xD4, 0xD1, 0x46, 0x3A, 0x46, 0x0D, 0x3B, 0x11, 0x8B, 0xF3, 0xC1, 0x21, 0x64, 0xC6, 0x65,
-    0x7A, 0x87, 0x3A, 0xAB, 0x6D, 0x88, 0xC1, 0xB5, 0x3F, 0x67, 0x69, 0x6C, 0x8B, 0x21, 0xD6, 0xC5,
-    0xEB, 0xA5, 0xD9, 0xA9, 0x92, 0xEE, 0x59, 0x36, 0xBE, 0xCA, 0xF9, 0xAE, 0x7E, 0x98, 0x0E, 0x98,
-    0xA4, 0x3D, 0x82, 0x27, 0x92, 0x5B, 0x0B, 0x5B, 0x84, 0x17, 0x9C, 0x95, 0xD9, 0xE9, 0x77, 0xCE,
-    0xDA, 0xFD, 0x6C, 0x7D, 0xD7, 0xDD, 0x4E, 0x69, 0x58, 0xE4, 0x0B, 0x6F, 0x00, 0x24, 0xA7, 0xE3,
-    0x27, 0xC6, 0x66, 0x0C, 0x39, 0x98, 0x36, 0xCD, 0xC9, 0x86, 0xED, 0x24, 0x6C, 0x19, 0x18, 0xD8,
-    0xA7, 0x70, 0xD5, 0x1E, 0x4D, 0x74, 0x59, 0x47, 0xE9, 0x44, 0x43, 0x86, 0xE2, 0xB7, 0x36, 0x05,
-    0xBB, 0x2F, 0xB8, 0x5A, 0xFB, 0x26, 0x1B, 0xEE, 0x8C, 0xCD, 0xAF, 0x6B, 0x76, 0xF2, 0xC0, 0xB6,
-    0x75, 0x6B, 0x43, 0x79, 0x74, 0x0E, 0x01, 0x3F, 0x9E, 0x0E, 0xA8, 0xA0, 0x4F, 0x0F, 0x4D, 0x86,
-    0xBC, 0xCB, 0xF1, 0xBF, 0x6D, 0x5D, 0x62, 0xBD, 0x73, 0x64, 0xD1, 0x60, 0x7C, 0x63, 0x8F, 0x62,
-    0x90, 0xFB, 0x8C, 0xAD, 0x88, 0x85, 0x37, 0x8B, 0xBE, 0x86, 0x77, 0x67, 0x5A, 0xF8, 0xFF, 0xCB,
-    0x13, 0x31, 0xD8, 0xC7, 0x49, 0xEE, 0x9C, 0x11, 0x85, 0x7F, 0x6F, 0xA7, 0xD0, 0x19, 0xB3, 0xD1,
-    0xCF, 0x49, 0x0A, 0x2E, 0x21, 0x32, 0xD8, 0xC9, 0x66, 0xA5, 0x57, 0x04, 0x2B, 0x73, 0xA1, 0x08,
-    0xCD, 0xEA, 0x1C, 0x38, 0x32, 0xE1, 0x63, 0x62, 0x79, 0x2B, 0x38, 0x8E, 0x27, 0xC5, 0x7F, 0x56,
-    0x60, 0xB8, 0xBA, 0x2B, 0xB5, 0xAA, 0x08, 0x45, 0x37, 0xEC, 0x4D, 0xA3, 0x33, 0xA6, 0x71, 0x48,
-    0xBC, 0x62, 0x62, 0xE4, 0x41, 0x6A, 0x55, 0xCA, 0xB9, 0x2D, 0xB1, 0x75, 0x4B, 0xBF, 0x83, 0x69,
-    0x82, 0x9B, 0x6D, 0x6D, 0x15, 0x20, 0xBD, 0x7B, 0xE0, 0xEF, 0x7F, 0x28, 0xA8, 0x7E, 0xA5, 0x1C,
-    0x32, 0x1A, 0xDD, 0x25, 0xBA, 0xF4, 0x12, 0xA0, 0x2E, 0x62, 0xC7, 0x73, 0xC8, 0x86, 0x60, 0xD9,
-    0xF8, 0xC4, 0xFA, 0x9C, 0x46, 0xBC, 0x66, 0x70, 0x4A, 0x41, 0x9C, 0x5B, 0x19, 0x55, 0x6A, 0x4C,
-    0x0D, 0x7F, 0xAD, 0xAD, 0xA2, 0xFF, 0xFE, 0xC9, 0xA5, 0xD1, 0x06, 0x06, 0xEF, 0xA8, 0xE7, 0xE3,
-    0xCA, 0xC7, 0x84, 0xD7, 0x6A, 0xC3, 0x85, 0x68, 0x16, 0x0B, 0x9E, 0x5A, 0x93, 0xD9, 0xB4, 0xB0,
-    0xCF, 0x42, 0x61, 0x7E, 0x64, 0x1C, 0x06, 0xCB, 0xCE, 0x15, 0x9E, 0x99, 0x13, 0xD0, 0xA9, 0x00,
-    0x8C, 0xF1, 0xBB, 0x6C, 0xAD, 0x73, 0xCA, 0x90, 0x00, 0xF1, 0x7B, 0x1F, 0x3C, 0x43, 0xA1, 0xB3,
-    0x60, 0x75, 0xD2, 0x37, 0x20, 0x6A, 0xAF, 0x99, 0xF6, 0x89, 0xAB, 0x3F, 0xC4, 0xEE, 0xEB, 0x1D,
-    0x91, 0x6C, 0xED, 0x11, 0x67, 0x1E, 0x4E, 0x3D, 0x54, 0x46, 0x27, 0x83, 0x09, 0x28, 0x0A, 0x0C,
-    0x72, 0x99, 0x0B, 0x13, 0x67, 0xCE, 0x2D, 0x8F, 0xBD, 0x8E, 0x05, 0x33, 0x57, 0xD5, 0x89, 0x21,
-    0x13, 0x36, 0x59, 0x2B, 0x99, 0x94, 0x4E, 0xAD, 0x0F, 0xD4, 0x0A, 0x73, 0xF2, 0x47, 0xA9, 0x2A,
-    0x7C, 0xC1, 0x0D, 0x9E, 0x0C, 0x36, 0x12, 0x08, 0xD4, 0xE6, 0xD7, 0xB9, 0x36, 0x49, 0xD7, 0xEA,
-    0xF0, 0x60, 0xAC, 0xCD, 0x7C, 0xA3, 0xCA, 0x1C, 0xDC, 0x44, 0xD8, 0x9A, 0xA9, 0xBF, 0x34, 0xF1,
-    0xAD, 0xA5, 0x09, 0x5B, 0x63, 0xD3, 0x5E, 0xA1, 0xB1, 0x15, 0x00, 0xFF, 0x08, 0x0E, 0x7C, 0x6A,
-    0xD1, 0x7B, 0xAE, 0x20, 0xB7, 0x8F, 0x62, 0x65, 0x6D, 0xE2, 0x8D, 0xA3, 0x09, 0xBE, 0x78, 0xD7,
-    0x55, 0xFD, 0x15, 0xC2, 0xF8, 0xB1, 0xDD, 0x4B, 0x7E, 0x74, 0x22, 0x57, 0x63, 0xF7, 0x13, 0xA7,
-    0x07, 0x94, 0xC4, 0xBE, 0x41, 0xB9, 0xE7, 0xF2, 0x6F, 0x20, 0x5B, 0xB1, 0xEE, 0x8D, 0x12, 0xEE,
-    0x99, 0x0F, 0x82, 0xFD, 0x80, 0xF9, 0x75, 0x65, 0x2B, 0xB6, 0xFA, 0x0E, 0xF2, 0x70, 0xA3, 0x4D,
-    0x0D, 0xCB, 0xF9, 0x71, 0x60, 0x67, 0xB4, 0x01, 0x76, 0xA6, 0xBF, 0x08, 0xEC, 0x38, 0x3B, 0x16,
-    0x61, 0x32, 0x40, 0x0A, 0x36, 0x3E, 0xEA, 0xB3, 0xA6, 0x9C, 0xC9, 0xBD, 0xA9, 0x73, 0xF9, 0x58,
-    0x6B, 0x37, 0x1B, 0xDF, 0x60, 0x4D, 0x5C, 0x44, 0xDA, 0x71, 0x99, 0xBC, 0x7D, 0x33, 0x4D, 0x96,
-    0x13, 0x73, 0xEA, 0xA1, 0x8D, 0xAD, 0xE7, 0x6A, 0xA9, 0xD6, 0xB8, 0x1C, 0x6B, 0x6A, 0x86, 0x63,
-    0xDC, 0x24, 0xF6, 0xE7, 0x2C, 0x9C, 0xE6, 0xE1, 0x50, 0xA9, 0xF1, 0x96, 0x44, 0x46, 0x41, 0x6B,
-    0x6E, 0x33, 0xFA, 0x70, 0x80, 0x73, 0xCF, 0x34, 0x44, 0xBB, 0x93, 0xC6, 0x7B, 0x03, 0xBE, 0xBF,
-    0xF6, 0x5E, 0xC9, 0x9D, 0x77, 0x2A, 0x7C, 0xF7, 0x5E, 0xAE, 0xFC, 0xEB, 0x3C, 0xC7, 0x27, 0xB8,
-    0xC6, 0x83, 0xC7, 0xC2, 0xA7, 0x4A, 0xC4, 0x2E, 0xE1, 0xD9, 0x92, 0x2D, 0x8A, 0x4E, 0x75, 0x95,
-    0xDA, 0x5F, 0xB1, 0xBD, 0xCD, 0xBC, 0x5B, 0x72, 0xB9, 0xDF, 0xC7, 0xDF, 0x23, 0xC3, 0x26, 0xE7,
-    0x09, 0x82, 0xB8, 0xE4, 0xDC, 0x1C, 0x56, 0x39, 0xA9, 0xAE, 0xD2, 0x04, 0x97, 0x47, 0x2D, 0x20,
-    0x36, 0x16, 0x8B, 0x36, 0x92, 0xE6, 0xFB, 0xA6, 0x2F, 0xD3, 0xFD, 0x90, 0xFF, 0xE0, 0xDF, 0xB8,
-    0x61, 0xDC, 0x6B, 0xDD, 0x9B, 0x26, 0x98, 0xBB, 0xAF, 0x9B, 0xE8, 0xAA, 0xF7, 0xA2, 0x19, 0xE1,
-    0x5B, 0x3A, 0xA9, 0xFD, 0x17, 0xD2, 0xBA, 0x0A, 0xBE, 0xFB, 0xE4, 0xCF, 0xAA, 0xF0, 0x91, 0x8B,
-    0xD7, 0xCA, 0xD0, 0x7B, 0xE1, 0x62, 0x11, 0x7A, 0x2F, 0x62, 0xC5, 0xBD, 0xFF, 0xE3, 0xE7, 0x67,
-    0xBC, 0x96, 0xAD, 0xA1, 0x75, 0xD0, 0x6E, 0x01, 0xBA, 0xD4, 0xB6, 0x96, 0xC9, 0x12, 0xE5, 0xB1,
-    0xF2, 0xE0, 0x10, 0x0A, 0xFC, 0x7A, 0x3C, 0xA2, 0x1C, 0xE2, 0x55, 0xE6, 0xAE, 0x57, 0x8A, 0xB9,
-    0x8E, 0x75, 0x86, 0xA8, 0x6D, 0x85, 0xCE, 0x21, 0x90, 0x87, 0xAB, 0x6C, 0x54, 0xA1, 0x43, 0xC6,
-    0x00, 0x2C, 0x8C, 0x4E, 0x19, 0xE3, 0xB2, 0xDA, 0x63, 0xC6, 0x28, 0xA6, 0xDA, 0x02, 0xA2, 0xAD,
-    0xFE, 0x6A, 0xFD, 0x58, 0xED, 0x3D, 0x3B, 0x1C, 0x53, 0x67, 0x6A, 0x1D, 0x1B, 0xA4, 0x6C, 0x23,
-    0x9B, 0xB6, 0xFA, 0xA3, 0x09, 0x4F, 0x41, 0xE8, 0xE9, 0x5E, 0xC2, 0xFF, 0x51, 0x5A, 0x23, 0xDB,
-    0x6F, 0xA7, 0x38, 0x5D, 0x3E, 0x68, 0x16, 0xED, 0xC4, 0x5B, 0x5E, 0x68, 0x82, 0xD2, 0xAF, 0xB9,
-    0x57, 0xCE, 0x76, 0xBF, 0xB2, 0xB5, 0x82, 0xCD, 0xAD, 0x3C, 0x96, 0x80, 0x91, 0x1D, 0x7B, 0x63,
-    0x6C, 0x59, 0x33, 0x71, 0x6F, 0xA6, 0x71, 0xF7, 0x34, 0x82, 0xC7, 0xA8, 0xAF, 0x4F, 0xAB, 0x1F,
-    0x8E, 0xCD, 0xE8, 0x6C, 0xCD, 0x30, 0xE7, 0x3E, 0xB7, 0xD9, 0xF4, 0x52, 0xF7, 0xBB, 0x32, 0x35,
-    0x35, 0x06, 0x83, 0x3C, 0x3E, 0xCD, 0x7B, 0x2D, 0xB7, 0x33, 0x8B, 0x1E, 0x2E, 0x74, 0x7E, 0x9A,
-    0x3D, 0x24, 0x0D, 0x13, 0xD3, 0x19, 0x14, 0x3C, 0x40, 0x4D, 0x60, 0x88, 0xF3, 0x8A, 0x6D, 0xAE,
-    0x53, 0x8D, 0x7F, 0x0D, 0xA7, 0x75, 0x11, 0xFC, 0x69, 0x2D, 0x82, 0xE7, 0x83, 0xF9, 0x4C, 0xEE,
-    0x3B, 0x38, 0xE1, 0x1C, 0xF1, 0xF4, 0xD7, 0x32, 0x2B, 0xB2, 0xB6, 0xB5, 0x1E, 0x5B, 0x87, 0x26,
-    0xB0, 0x32, 0x06, 0x5A, 0x6C, 0xE3, 0xC1, 0xCF, 0x24, 0x36, 0xA1, 0x6A, 0x31, 0xF6, 0x08, 0x20,
-    0xA3, 0x63, 0x3F, 0x69, 0x6A, 0x6C, 0x8C, 0xD5, 0xB0, 0x30, 0x8B, 0x87, 0x2A, 0x43, 0x13, 0x14,
-    0xE1, 0xAB, 0xDB, 0x72, 0x6A, 0x99, 0x1D, 0x91, 0x4F, 0x38, 0xD8, 0x5B, 0xD8, 0x8C, 0x6A, 0x7F,
-    0x08, 0x4E, 0x62, 0xCD, 0xF4, 0xD8, 0xDA, 0xE7, 0x5D, 0x3C, 0x2E, 0xB6, 0x75, 0xB9, 0x5D, 0xA3,
-    0xD2, 0x9C, 0x39, 0x5D, 0x7C, 0x73, 0x91, 0x22, 0x82, 0x79, 0xBD, 0xCB, 0x92, 0xEF, 0xDF, 0x6C,
-    0x66, 0x6E, 0x03, 0x3D, 0x9E, 0x86, 0x79, 0x50, 0xD1, 0xA4, 0xC0, 0xD3, 0x5E, 0x87, 0xB3, 0x73,
-    0x96, 0x21, 0xF7, 0xF5, 0x14, 0x53, 0x66, 0x07, 0x05, 0x16, 0xB8, 0x0F, 0x52, 0xE7, 0xA4, 0xB1,
-    0xA4, 0x30, 0xA1, 0x75, 0x74, 0x9A, 0x68, 0x91, 0x7F, 0xDE, 0xEB, 0xDE, 0xBD, 0xD9, 0xD5, 0xDE,
-    0x4A, 0xBB, 0x12, 0x52, 0x61, 0x1B, 0x3F, 0xFB, 0x2A, 0xCC, 0xEE, 0xC4, 0x78, 0xB7, 0xEB, 0xFE,
-    0xB4, 0x9A, 0x3E, 0x6B, 0xB5, 0x51, 0x1D, 0xFC, 0xA8, 0x1A, 0xAA, 0xF6, 0x84, 0x75, 0x29, 0x27,
-    0xFA, 0x51, 0x55, 0x4A, 0xCE, 0x69, 0x18, 0x4A, 0x1B, 0xDC, 0x99, 0x90, 0xB9, 0x35, 0xDF, 0xDC,
-    0xE0, 0xEE, 0x2C, 0xD8, 0xE5, 0x9A, 0x7B, 0x87, 0x71, 0x16, 0xB3, 0x77, 0x9A, 0x81, 0x86, 0x5F,
-    0x8C, 0x9D, 0x03, 0x66, 0x39, 0x79, 0xF6, 0x4F, 0x7C, 0x74, 0x9C, 0x86, 0xAF, 0x1D, 0xB2, 0x27,
-    0x4D, 0xA4, 0x3E, 0x99, 0xEC, 0x08, 0x9D, 0x9D, 0xE4, 0x66, 0x31, 0xE2, 0xEF, 0xE8, 0x92, 0xB6,
-    0xBD, 0x25, 0xE9, 0x70, 0xCE, 0x60, 0x3E, 0xF8, 0x82, 0xC2, 0x46, 0x3B, 0x27, 0x1E, 0xCF, 0x4F,
-    0x62, 0x7D, 0x19, 0x29, 0xFF, 0x18, 0x68, 0xA9, 0xC1, 0x95, 0xF1, 0xA3, 0x85, 0xDA, 0xC2, 0xCC,
-    0x3E, 0x77, 0xB9, 0x64, 0x73, 0xE3, 0x57, 0x7E, 0xED, 0xB7, 0x3A, 0xDF, 0x43, 0x65, 0x71, 0xAB,
-    0x3B, 0x8B, 0x92, 0x79, 0x37, 0xFF, 0xCF, 0x17, 0xD6, 0xA5, 0x86, 0xC3, 0x86, 0x3F, 0xE7, 0xD9,
-    0x16, 0xEC, 0xCF, 0xBB, 0xEF, 0x35, 0x71, 0x1A, 0x11, 0xCF, 0x4E, 0xE9, 0x36, 0x62, 0x9D, 0xE3,
-    0xC1, 0x3E, 0xC0, 0x73, 0xC3, 0xB9, 0x16, 0x91, 0x7A, 0x7A, 0x20, 0xFB, 0x9F, 0xDD, 0x40, 0x95,
-    0x66, 0x07, 0xAC, 0xA0, 0x98, 0x38, 0x87, 0x3C, 0x0F, 0xD1, 0x26, 0xFA, 0x44, 0x75, 0x3B, 0xA4,
-    0x2C, 0xA6, 0x3D, 0xF9, 0xDB, 0x73, 0x5C, 0xDC, 0xB1, 0xAA, 0xD6, 0x46, 0x87, 0x50, 0x0B, 0xEE,
-    0x0C, 0xDE, 0x67, 0x45, 0x07, 0x7E, 0xB4, 0x68, 0x75, 0xA6, 0x01, 0x8C, 0xF9, 0x2C, 0x9D, 0xE5,
-    0xEA, 0xEF, 0xE4, 0xB1, 0xAC, 0x6B, 0x0E, 0x39, 0xD5, 0x96, 0x5A, 0x5F, 0xB3, 0x2F, 0x0E, 0xCF,
-    0xFD, 0xD5, 0xA6, 0x33, 0x18, 0x32, 0x6B, 0xBB, 0x63, 0x5B, 0x50, 0xFC, 0x8C, 0xFB, 0xCF, 0x03,
-    0xEF, 0xDF, 0xB7, 0xDE, 0xE1, 0xC9, 0x27, 0x3C, 0x25, 0x5D, 0xFE, 0x9C, 0x7B, 0x27, 0xE9, 0xBF,
-    0x0D, 0xBC, 0x2F, 0x39, 0xE1, 0xF1, 0x92, 0x14, 0x93, 0x4B, 0xF7, 0x6F, 0x1C, 0x75, 0xFC, 0xE9,
-    0x9C, 0xD8, 0x07, 0x83, 0x1A, 0x72, 0xFF, 0x45, 0x7D, 0xF4, 0x30, 0xF5, 0xAB, 0x55, 0xFE, 0xF7,
-    0x0E, 0xD6, 0x07, 0x03, 0x34, 0x0C, 0x0C, 0x12, 0xF0, 0x91, 0xB8, 0xA4, 0x94, 0x98, 0xB0, 0x95,
-    0xE0, 0x5A, 0x1A, 0x14, 0x90, 0xB3, 0x08, 0xF2, 0x7B, 0x42, 0x16, 0x63, 0x65, 0xC8, 0x81, 0x6F,
-    0xEF, 0xD9, 0x7D, 0x5B, 0xB6, 0x07, 0xC0, 0x52, 0x67, 0x1B, 0x82, 0xF1, 0xE7, 0x65, 0xDB, 0x08,
-    0xF4, 0x00, 0x8B, 0x0C, 0x41, 0xB1, 0x91, 0xD2, 0x29, 0x87, 0xBE, 0x81, 0x37, 0x21, 0xC0, 0xDC,
-    0xFD, 0xB0, 0x33, 0x9C, 0x02, 0xFC, 0x6D, 0x6D, 0x07, 0x69, 0xCD, 0xB7, 0x9F, 0xA9, 0x2D, 0xA2,
-    0x8B, 0xEC, 0xC9, 0xB4, 0x66, 0x63, 0xBB, 0x20, 0xD5, 0x9D, 0xAD, 0x78, 0xFF, 0x5A, 0xE7, 0x8E,
-    0xF5, 0x1B, 0xFE, 0xC2, 0xBB, 0x9C, 0xCE, 0x38, 0x33, 0x6F, 0x82, 0x83, 0x72, 0xA3, 0x8A, 0x4D,
-    0x43, 0x9D, 0x0F, 0xA0, 0x05, 0xDB, 0x3E, 0x7F, 0xD4, 0x4C, 0xF2, 0x9B, 0x3C, 0xC5, 0x30, 0x54,
-    0x80, 0x0E, 0x77, 0xB6, 0x9D, 0xFE, 0x8A, 0x7D, 0x47, 0x26, 0x3C, 0xEE, 0xA0, 0xBD, 0x82, 0xFB,
-    0xA5, 0x6A, 0xF5, 0x1D, 0x9D, 0xFC, 0x2D, 0x9E, 0x8C, 0x28, 0xA7, 0x0D, 0x2D, 0xA3, 0xE3, 0x3E,
-    0x79, 0xE4, 0xB4, 0x7F, 0x3D, 0x33, 0xBD, 0x6F, 0xD0, 0x64, 0xE9, 0xF1, 0x71, 0x2D, 0xE6, 0x1A,
-    0xCB, 0x1B, 0x77, 0x67, 0x17, 0x3C, 0x75, 0x84, 0x67, 0xEC, 0x98, 0x5D, 0x92, 0xD4, 0x42, 0x48,
-    0x64, 0xF2, 0xB5, 0x7B, 0x29, 0x96, 0x15, 0x62, 0x3A, 0x9D, 0x7B, 0x21, 0xC2, 0x17, 0x21, 0x30,
-    0xBB, 0xEC, 0xA5, 0x60, 0xD6, 0x5C, 0x1E, 0xFF, 0x40, 0xDD, 0x27, 0x61, 0x01, 0x0A, 0xA2, 0x12,
-    0xC0, 0x26, 0xD6, 0x56, 0xF9, 0xAE, 0x0F, 0xE7, 0xB4, 0xD7, 0xBC, 0x3F, 0x92, 0xC5, 0x3D, 0xEA,
-    0x47, 0x74, 0x0E, 0x52, 0xEB, 0xD8, 0x76, 0x60, 0xE5, 0x22, 0xD8, 0xB6, 0x24, 0xD0, 0xD6, 0x03,
-    0xF7, 0x9D, 0x5A, 0x49, 0xEB, 0xE1, 0xD8, 0x9C, 0x97, 0xB8, 0xC5, 0x14, 0xC2, 0x14, 0x16, 0x71,
-    0xC6, 0x1E, 0xAE, 0xA0, 0x4B, 0xEF, 0x68, 0xD9, 0xFF, 0xE7, 0xB0, 0xA9, 0x63, 0xD8, 0x8C, 0x58,
-    0xF5, 0xDE, 0xE0, 0xF7, 0x3F, 0xFB, 0xCB, 0xAD, 0x04, 0x27, 0xC0, 0x3D, 0x57, 0xEF, 0x7D, 0xB0,
-    0xB7, 0xF7, 0xEC, 0x2F, 0xB5, 0x12, 0x57, 0xED, 0x4A, 0x9C, 0x34, 0xD9, 0xD1, 0x4A, 0x10, 0x62,
-    0x14, 0x76, 0x25, 0xE8, 0x65, 0xE2, 0x61, 0x25, 0xF0, 0xA0, 0xE7, 0xC9, 0xB6, 0xF5, 0x4A, 0x20,
-    0x90, 0xF9, 0x88, 0x95, 0xA0, 0x07, 0xD5, 0x11, 0x80, 0x9B, 0x5E, 0x8E, 0x29, 0x0C, 0xE5, 0x2C,
-    0xDE, 0xD4, 0x1E, 0x94, 0x38, 0xDD, 0x2C, 0xDB, 0xA5, 0xFD, 0x61, 0x89, 0xB5, 0x8E, 0xE7, 0x22,
-    0xC6, 0x3D, 0xB1, 0x7D, 0xA1, 0x4F, 0x03, 0x08, 0x26, 0x6F, 0x96, 0x01, 0x93, 0xF4, 0x8F, 0x80,
-    0x84, 0x38, 0x1D, 0x5F, 0xA7, 0x88, 0xA4, 0x56, 0xB6, 0x11, 0xE6, 0x01, 0xFF, 0x3A, 0xEB, 0x06,
-    0x6F, 0x59, 0xE7, 0xD2, 0xFF, 0xDE, 0xD2, 0xF4, 0xC7, 0xE4, 0x32, 0xC6, 0x0B, 0x61, 0x31, 0x0B,
-    0x36, 0x5A, 0x1D, 0x1D, 0x07, 0x11, 0xE6, 0x69, 0x88, 0xB7, 0x0A, 0x1A, 0x38, 0xF5, 0xFF, 0xD0,
-    0x81, 0xCA, 0xD0, 0xF5, 0x76, 0xE6, 0x37, 0x79, 0xF2, 0x21, 0x9F, 0x1D, 0x6C, 0x3E, 0x9B, 0x95,
-    0xB0, 0xCB, 0x2A, 0x2C, 0xA9, 0x86, 0xA1, 0x0D, 0xEA, 0x6A, 0xB8, 0x68, 0x14, 0xE9, 0xAB, 0x5E,
-    0x39, 0xEF, 0x0F, 0xEB, 0xDD, 0xA2, 0xAF, 0x3F, 0x7A, 0xB6, 0xCE, 0xE7, 0xAB, 0xFA, 0x43, 0xE4,
-    0x95, 0xB0, 0x12, 0xB2, 0x3B, 0xDA, 0x22, 0x9D, 0xD9, 0xB7, 0x5D, 0xE6, 0x04, 0x82, 0xBE, 0xF9,
-    0xFB, 0xBE, 0x7B, 0x8C, 0x36, 0x79, 0xDB, 0x78, 0xE5, 0x98, 0x31, 0xFC, 0x8D, 0x9D, 0x6C, 0x2D,
-    0xE1, 0x14, 0x11, 0xD1, 0x87, 0x88, 0x60, 0x9D, 0x8D, 0xE7, 0xF1, 0xD5, 0x3A, 0xE1, 0xCC, 0xF0,
-    0x87, 0xCE, 0xF9, 0x84, 0x8D, 0x35, 0x2A, 0x6B, 0x12, 0x23, 0x19, 0x6E, 0xA4, 0x31, 0xDC, 0x44,
-    0x63, 0xC2, 0x35, 0x11, 0xAC, 0x50, 0xB9, 0x24, 0x42, 0xBB, 0x38, 0xA2, 0x01, 0x2E, 0x1E, 0x9D,
-    0x86, 0xD3, 0xF4, 0x6F, 0x6B, 0x53, 0x8C, 0xDD, 0x10, 0x63, 0x9C, 0x73, 0x58, 0x98, 0xE8, 0x11,
-    0xEE, 0x3F, 0xD7, 0xF9, 0x3A, 0xC5, 0xF1, 0x5D, 0x4E, 0x7C, 0xDE, 0x54, 0x3E, 0x02, 0x8A, 0x0C,
-    0x85, 0x49, 0x75, 0xFE, 0xAC, 0xCE, 0x7C, 0x1A, 0xDB, 0x4D, 0xC1, 0x2A, 0xD0, 0x29, 0xDC, 0x94,
-    0xAE, 0x4F, 0xC8, 0xFD, 0x7F, 0x24, 0xCA, 0xB8, 0x99, 0xF6, 0xBB, 0xB1, 0x24, 0x10, 0xBB, 0xEB,
-    0xDD, 0x83, 0xA9, 0x2D, 0x4D, 0xAB, 0xBF, 0x36, 0xA9, 0x8F, 0x36, 0xF7, 0x5B, 0x4A, 0x1E, 0x3D,
-    0x46, 0xC9, 0xD6, 0x06, 0x25, 0xA7, 0x58, 0x99, 0xE3, 0x89, 0x53, 0x3A, 0xBF, 0x4D, 0xFF, 0x07,
-    0x00, 0x9D, 0x73, 0xAA, 0x8D, 0xB6, 0x73, 0x25, 0x03, 0x75, 0x2C, 0x34, 0xC7, 0xA6, 0xAF, 0xDF,
-    0x5A, 0x53, 0xC2, 0x8D, 0x15, 0x6A, 0x8D, 0x66, 0xBB, 0xB5, 0x4A, 0x86, 0xF6, 0x60, 0xA0, 0x6C,
-    0x33, 0x37, 0x34, 0x74, 0x81, 0xB9, 0xFD, 0xFF, 0x65, 0x82, 0x6D, 0xE9, 0x0D, 0xDB, 0x30, 0x70,
-    0xD9, 0x86, 0xFD, 0x30, 0x13, 0xDB, 0x9C, 0xC4, 0x45, 0x48, 0x14, 0xB7, 0xB2, 0x27, 0x67, 0xE3,
-    0xCD, 0xB1, 0xF6, 0x07, 0xED, 0xF3, 0x5C, 0x87, 0xE2, 0x77, 0x78, 0xF8, 0x2C, 0xC3, 0x93, 0x83,
-    0xE1, 0xC0, 0xFA, 0xCD, 0xE2, 0xFE, 0x9D, 0xA7, 0xD8, 0xE3, 0x81, 0x01, 0x30, 0x24, 0x1E, 0x7A,
-    0xF4, 0xBC, 0x5F, 0xF6, 0x3C, 0x9E, 0x4F, 0xD4, 0xD2, 0x59, 0xFC, 0xE2, 0xC6, 0xD7, 0x5D, 0x02,
-    0xA5, 0xD2, 0x36, 0xC0, 0x6F, 0x36, 0xA2, 0xE9, 0xDA, 0xB4, 0x97, 0xE7, 0xBB, 0xB6, 0x9C, 0x0E,
-    0x2D, 0xA6, 0x77, 0xFE, 0xAD, 0xB3, 0xBE, 0x36, 0xB6, 0x34, 0x58, 0x1B, 0xD5, 0xC7, 0x26, 0x16,
-    0xF6, 0xE8, 0xA4, 0x36, 0x39, 0x2A, 0xB3, 0x11, 0xA4, 0x1C, 0xB5, 0x7C, 0xFD, 0xF6, 0x4E, 0x76,
-    0x94, 0xF5, 0x90, 0x58, 0xA8, 0x7F, 0xD0, 0x7C, 0xF3, 0x33, 0x9B, 0x50, 0xEA, 0xD3, 0x38, 0xDB,
-    0x47, 0xB9, 0x70, 0x9D, 0xA5, 0xFB, 0xC1, 0xDE, 0xA5, 0x8F, 0x3C, 0x95, 0xD4, 0x39, 0xD8, 0x56,
-    0x5B, 0xB7, 0xDA, 0x84, 0x3F, 0x74, 0x54, 0x69, 0x98, 0x6D, 0x38, 0x1A, 0x6E, 0x92, 0x94, 0xD1,
-    0x9C, 0x0C, 0x29, 0x4C, 0x50, 0xF7, 0x38, 0xAD, 0x42, 0xC9, 0xBD, 0x15, 0xF6, 0xA0, 0xA3, 0x4B,
-    0x3C, 0x01, 0x6D, 0x77, 0x2F, 0x0B, 0x8E, 0xC4, 0xAA, 0x56, 0x13, 0x31, 0xBB, 0x6D, 0x92, 0x0F,
-    0x35, 0x38, 0xB7, 0x5A, 0x53, 0x3E, 0xD3, 0x36, 0x39, 0xBB, 0x07, 0x2A, 0xB3, 0xBB, 0x97, 0x7F,
-    0x23, 0x45, 0xFD, 0x7C, 0x5D, 0xD4, 0x5F, 0xD7, 0xF3, 0x99, 0x26, 0x75, 0x39, 0x0C, 0x0F, 0xA8,
-    0xE6, 0xC9, 0x62, 0xF0, 0x32, 0xF7, 0xA6, 0x3C, 0xE3, 0x44, 0x67, 0x70, 0x73, 0x6D, 0xC2, 0xEF,
-    0x42, 0x04, 0xDF, 0x2F, 0x8F, 0x1A, 0x14, 0xD8, 0x40, 0x44, 0xF3, 0xE9, 0xBC, 0xCF, 0x5C, 0xDB,
-    0xDC, 0x1E, 0x16, 0xDB, 0x6A, 0x2F, 0xE7, 0x0C, 0x41, 0x29, 0xF7, 0x30, 0xE9, 0xD0, 0x81, 0x51,
-    0x3F, 0xFE, 0x5F, 0xE6, 0xB6, 0x21, 0x80, 0x3C, 0xFB, 0xE4, 0x93, 0x54, 0x5B, 0xBF, 0x16, 0x4A,
-    0xCD, 0x22, 0x9A, 0x24, 0xF5, 0xE9, 0x13, 0x9E, 0xA8, 0x3B, 0x4C, 0xC3, 0xB3, 0xD3, 0x28, 0x8E,
-    0x4D, 0xC3, 0x67, 0x6F, 0x51, 0xA7, 0xE3, 0x32, 0xEF, 0x3A, 0x8D, 0xA9, 0x61, 0xEC, 0xF1, 0xFF,
-    0x00, 0xB5, 0x58, 0x31, 0x6C, 0x1C, 0xC7, 0x15, 0xFD, 0xBB, 0x73, 0xD4, 0x46, 0xDA, 0x58, 0xC3,
-    0x82, 0x02, 0x94, 0xD8, 0xF2, 0xBA, 0x50, 0x21, 0x08, 0xE4, 0x9D, 0x0B, 0x15, 0x0C, 0xB0, 0xB7,
-    0x3B, 0x21, 0x0B, 0x01, 0x29, 0x22, 0x16, 0x62, 0x02, 0x38, 0x45, 0xD2, 0x46, 0x85, 0xE3, 0x42,
-    0x85, 0x02, 0x1C, 0x79, 0x2B, 0xA9, 0x4C, 0x61, 0x36, 0x49, 0x1B, 0x05, 0x50, 0x21, 0x1D, 0x02,
-    0x5B, 0xC5, 0x15, 0x17, 0xE5, 0x28, 0x2E, 0x25, 0x38, 0x2C, 0x5C, 0x68, 0xAD, 0x14, 0x2A, 0x54,
-    0x78, 0x65, 0x06, 0x08, 0x90, 0x20, 0xF0, 0x28, 0x5A, 0x27, 0x47, 0x69, 0xEF, 0x26, 0xEF, 0xCF,
-    0xDE, 0x89, 0xB4, 0x2D, 0x9B, 0x74, 0x82, 0xCC, 0x72, 0xF7, 0x66, 0x66, 0xFF, 0xFF, 0xF3, 0xFF,
-    0xCC, 0xFF, 0xEF, 0xFF, 0x25, 0x91, 0x93, 0x50, 0x7E, 0xA1, 0x77, 0xBB, 0x77, 0x2D, 0xFF, 0x5D,
-    0x72, 0x8D, 0xF6, 0xBF, 0x88, 0x5C, 0xE5, 0x53, 0xFD, 0x66, 0xFD, 0x3D, 0xFF, 0x88, 0xFB, 0x03,
-    0x3A, 0xB2, 0xFF, 0x15, 0x1B, 0x69, 0x36, 0x97, 0x97, 0xC6, 0x3F, 0xDF, 0xED, 0x74, 0xAE, 0x19,
-    0x63, 0xEE, 0x76, 0x3A, 0x1D, 0xC8, 0x22, 0x61, 0x4C, 0x19, 0x1B, 0x73, 0x79, 0x79, 0x79, 0x89,
-    0xAA, 0x86, 0x91, 0xA9, 0x26, 0xD1, 0x06, 0xC7, 0x96, 0xB9, 0xED, 0xF3, 0x6E, 0x8E, 0x9E, 0xAB,
-    0x28, 0x93, 0x5D, 0xF1, 0x8F, 0xFF, 0xB2, 0xA3, 0xAD, 0x74, 0x69, 0xCC, 0x27, 0x9D, 0xCE, 0x75,
-    0xF4, 0x20, 0xB9, 0x61, 0xCC, 0x07, 0x2C, 0xBC, 0xEB, 0xA5, 0x91, 0xA3, 0x65, 0xB2, 0x2E, 0xF4,
-    0x14, 0x39, 0x85, 0x4C, 0x23, 0x57, 0x4B, 0xD5, 0x12, 0xE9, 0x14, 0xD1, 0x92, 0x4C, 0x57, 0xAB,
-    0x51, 0x76, 0x94, 0xFA, 0xFD, 0x7E, 0x2B, 0x0C, 0xC3, 0x1A, 0x75, 0x8F, 0x3A, 0xBA, 0x29, 0xF2,
-    0x96, 0x97, 0x16, 0xF2, 0x8A, 0x6E, 0x2C, 0xE6, 0xB1, 0x9F, 0xCD, 0x4C, 0x29, 0xA7, 0x88, 0x84,
-    0x5E, 0x17, 0x79, 0xE9, 0x6F, 0x16, 0x72, 0x41, 0x07, 0x22, 0x0D, 0xFD, 0x64, 0x86, 0xA5, 0x1C,
-    0xC3, 0xBC, 0xB7, 0x3B, 0x9F, 0x35, 0xFD, 0x64, 0xDE, 0xA7, 0x5E, 0x3D, 0xF6, 0x3F, 0xBC, 0xFB,
-    0x44, 0xB7, 0x42, 0x29, 0xC5, 0xBD, 0x54, 0x4F, 0xD7, 0x58, 0xC7, 0x92, 0x44, 0x4E, 0x52, 0x51,
-    0x48, 0x94, 0x1F, 0xFA, 0xF1, 0x6F, 0xDE, 0x37, 0xA3, 0xDB, 0xCF, 0xBA, 0x22, 0xA5, 0xA3, 0x44,
-    0x17, 0xC9, 0xCD, 0x48, 0x12, 0x5E, 0x39, 0x9A, 0xFC, 0x84, 0x9A, 0x50, 0x97, 0xFC, 0x94, 0x62,
-    0xE6, 0xF2, 0xF2, 0xF1, 0x16, 0xBA, 0xB0, 0x15, 0x93, 0x14, 0xA1, 0x8F, 0x2E, 0x58, 0x61, 0x29,
-    0x61, 0x53, 0x1D, 0x17, 0xB3, 0x60, 0xA7, 0x56, 0x45, 0x24, 0x13, 0x82, 0x08, 0x26, 0x9A, 0x5A,
-    0xBC, 0xAC, 0x98, 0x68, 0xF4, 0x7C, 0xC0, 0xF4, 0x13, 0x22, 0x31, 0x26, 0xC2, 0xB3, 0x88, 0x4B,
-    0x5C, 0xC3, 0xB8, 0x6C, 0x94, 0x3E, 0x2F, 0xB4, 0xC6, 0x2F, 0x8C, 0x92, 0x23, 0xC7, 0x94, 0x8D,
-    0x91, 0x18, 0xD2, 0xF7, 0x98, 0x6C, 0xE6, 0xCE, 0x68, 0x38, 0x3D, 0x45, 0x33, 0x31, 0xDD, 0x69,
-    0xD3, 0xA8, 0x4D, 0xE5, 0x0C, 0xF1, 0x90, 0x4E, 0x62, 0x82, 0x4A, 0x4C, 0x39, 0x78, 0x0C, 0x1D,
-    0x9E, 0xA6, 0xA5, 0x29, 0x7F, 0x7B, 0x50, 0xD6, 0xE8, 0xC2, 0x8D, 0xDB, 0x37, 0x0E, 0xE2, 0x96,
-    0x7C, 0x9D, 0xBE, 0x79, 0xFA, 0xBD, 0x83, 0x38, 0xA4, 0xBD, 0xA8, 0x3D, 0xDC, 0xBD, 0xDC, 0x64,
-    0xFF, 0x8B, 0x39, 0xDE, 0xA1, 0xEA, 0x3A, 0x38, 0x07, 0xBD, 0x52, 0x5D, 0x07, 0xE5, 0xA8, 0x5A,
-    0xA0, 0xC9, 0xC3, 0xC0, 0x37, 0xA9, 0x75, 0xCD, 0x22, 0xB4, 0x27, 0x51, 0x17, 0x19, 0x8E, 0x15,
-    0x47, 0xD0, 0x74, 0x78, 0x16, 0x3E, 0x08, 0x2F, 0x00, 0x61, 0x08, 0x7F, 0x20, 0xEA, 0x79, 0x77,
-    0x79, 0xEB, 0x7D, 0xD5, 0x6D, 0xBD, 0xAD, 0x0E, 0xE5, 0x3D, 0x29, 0x83, 0xA1, 0x30, 0x5B, 0xF7,
-    0xB6, 0x1F, 0x3E, 0xD0, 0xFD, 0x95, 0xB8, 0xEC, 0x15, 0x32, 0x70, 0xF3, 0x51, 0x20, 0xE9, 0x9F,
-    0x79, 0x9D, 0xC4, 0xDD, 0x5C, 0x86, 0xF0, 0x97, 0x62, 0xCE, 0x79, 0x9A, 0x36, 0x59, 0x74, 0x1D,
-    0xF2, 0xBC, 0x34, 0x14, 0x0F, 0x93, 0x16, 0x69, 0x88, 0xBE, 0xE4, 0xAB, 0x26, 0x35, 0xE5, 0xD9,
-    0x4D, 0xED, 0x27, 0xCE, 0x73, 0x1D, 0xAF, 0xB3, 0x57, 0x0D, 0x1C, 0xC3, 0x6B, 0xD5, 0xC8, 0x51,
-    0xB4, 0xDB, 0x1C, 0x43, 0x74, 0xC9, 0xF6, 0x26, 0x1A, 0xC3, 0x27, 0x16, 0x53, 0x91, 0xD9, 0xDE,
-    0x58, 0x6D, 0xB4, 0x50, 0x64, 0x41, 0xC5, 0x31, 0xD6, 0x1D, 0xED, 0x92, 0x48, 0x8B, 0xAA, 0x37,
-    0x36, 0x00, 0xAD, 0xEB, 0x9F, 0xFD, 0xD3, 0x5F, 0xE8, 0x6D, 0xF2, 0xD7, 0xC6, 0x56, 0xA4, 0xED,
-    0xA2, 0x15, 0x35, 0x57, 0x1A, 0xFE, 0x56, 0x56, 0xF4, 0xC7, 0xA6, 0x6C, 0xE7, 0xA1, 0x7C, 0xAC,
-    0xB5, 0xAC, 0xBB, 0xDB, 0x90, 0x55, 0xD9, 0xF3, 0x30, 0x09, 0x49, 0x2E, 0x64, 0x41, 0x28, 0x1E,
-    0xC1, 0x8A, 0xCA, 0xA8, 0xFB, 0xEA, 0x12, 0x2F, 0xD7, 0xBC, 0xE4, 0xDD, 0x57, 0xDD, 0xB1, 0x65,
-    0xE7, 0x94, 0x16, 0x99, 0xC8, 0x8A, 0x56, 0xE0, 0x2F, 0xE4, 0x63, 0xF3, 0xBC, 0x4F, 0x53, 0x28,
-    0xB7, 0x91, 0x04, 0x85, 0x6B, 0xA8, 0xB2, 0x91, 0xE0, 0x88, 0xF0, 0xF4, 0x81, 0x03, 0x6A, 0x2F,
-    0x91, 0x74, 0x82, 0x4E, 0x61, 0x1C, 0x50, 0x24, 0x93, 0xC0, 0x4F, 0xE5, 0x62, 0xE6, 0x5D, 0xC9,
-    0x45, 0xAA, 0x9D, 0xEC, 0x22, 0x5D, 0xB3, 0x6F, 0x30, 0x79, 0x35, 0x2F, 0x1C, 0xDD, 0x6F, 0x60,
-    0xE7, 0x16, 0x53, 0xBC, 0xEE, 0x91, 0x0E, 0xC1, 0xE8, 0x2D, 0x64, 0x6E, 0x02, 0x9A, 0xA6, 0xBC,
-    0x8C, 0xB1, 0x9B, 0xCD, 0x1F, 0x69, 0x06, 0xE2, 0xB1, 0x0E, 0xA4, 0xD2, 0x3D, 0xE9, 0x25, 0xDD,
-    0x50, 0x5C, 0x49, 0x4F, 0x1D, 0x6F, 0x06, 0x72, 0xF1, 0xB1, 0x1E, 0x04, 0xF2, 0x6C, 0xAA, 0x7B,
-    0xA1, 0xF4, 0xAE, 0xA6, 0xDD, 0x70, 0x4E, 0x5C, 0xD9, 0xCC, 0x4F, 0x1D, 0x3F, 0xCC, 0xDA, 0xCC,
-    0x91, 0x53, 0x92, 0xBC, 0x45, 0xB7, 0x32, 0x6F, 0x31, 0x09, 0x7D, 0x91, 0xBE, 0x36, 0x47, 0x67,
-    0x72, 0x6C, 0xF8, 0x34, 0xB5, 0x1C, 0xED, 0x65, 0x81, 0x5A, 0xA5, 0x3E, 0x5C, 0xA5, 0x01, 0x84,
-    0xF0, 0x13, 0x0E, 0x55, 0x97, 0xF8, 0x57, 0xE4, 0x38, 0xBB, 0x01, 0xF5, 0x9D, 0x01, 0xD3, 0x34,
-    0x81, 0x14, 0x93, 0xA6, 0xA8, 0xA0, 0x5A, 0x93, 0x82, 0x44, 0x7C, 0x54, 0x00, 0x2D, 0xF0, 0xDE,
-    0x01, 0x32, 0x04, 0x8A, 0xE3, 0x77, 0x85, 0xA1, 0x86, 0x27, 0xE1, 0x63, 0x19, 0xC3, 0x45, 0x70,
-    0x8E, 0x41, 0xA5, 0x9D, 0x8B, 0xBF, 0xE7, 0xD0, 0x23, 0x5E, 0xA1, 0x38, 0x13, 0x4F, 0x94, 0xFC,
-    0xAD, 0xAA, 0x81, 0x72, 0x05, 0x04, 0x03, 0x50, 0x83, 0xDD, 0xCB, 0x98, 0x3D, 0x50, 0x60, 0x87,
-    0x90, 0x01, 0x41, 0x32, 0x64, 0x26, 0xDE, 0x66, 0xE2, 0x0C, 0xE8, 0x38, 0xD1, 0x94, 0x85, 0x72,
-    0x67, 0xE0, 0x0C, 0xFC, 0xCC, 0xCF, 0x1A, 0x50, 0xB7, 0xA4, 0x52, 0xE4, 0x22, 0x97, 0x89, 0x54,
-    0x2B, 0xD4, 0x72, 0x35, 0x40, 0x35, 0x95, 0x49, 0x84, 0xD5, 0x0A, 0xD2, 0x1E, 0xDC, 0x32, 0xA0,
-    0xD7, 0xA9, 0x47, 0xDD, 0xB1, 0x47, 0x31, 0x96, 0x38, 0x89, 0xD0, 0x41, 0x1A, 0xA4, 0x1B, 0xD4,
-    0x86, 0xD4, 0xA5, 0xCA, 0x1F, 0x0F, 0x99, 0x34, 0x36, 0x45, 0x7D, 0xA7, 0x74, 0x8A, 0xBE, 0xAB,
-    0x21, 0xA8, 0x05, 0xBC, 0x85, 0x69, 0xE2, 0xC3, 0xDC, 0xFB, 0x34, 0xF1, 0x87, 0xE4, 0x17, 0x24,
-    0x53, 0xC6, 0x4F, 0x39, 0x11, 0x04, 0x7D, 0xDA, 0x38, 0x76, 0xA2, 0x75, 0x08, 0x1D, 0xFB, 0xB0,
-    0x79, 0x6A, 0x8C, 0x75, 0xCA, 0x37, 0x89, 0xBE, 0x7D, 0x86, 0x68, 0x7E, 0x16, 0x30, 0x28, 0x09,
-    0x8A, 0xFC, 0xED, 0x0E, 0x68, 0xC7, 0x5E, 0xDA, 0x18, 0x91, 0xB3, 0xF3, 0x93, 0x14, 0x81, 0xAA,
-    0x4F, 0x10, 0x9D, 0x01, 0xDD, 0xEC, 0xCF, 0xAC, 0x3C, 0xA4, 0x54, 0x9A, 0x87, 0x1C, 0xF4, 0x32,
-    0x86, 0x63, 0xEE, 0x11, 0x98, 0x20, 0xC5, 0x53, 0xB6, 0x37, 0x87, 0x28, 0xC6, 0xAB, 0x11, 0xD1,
-    0x89, 0x5B, 0x24, 0x7E, 0x45, 0x74, 0xEB, 0x1D, 0x3A, 0xEA, 0x29, 0x91, 0xCE, 0xD3, 0x45, 0x91,
-    0xD0, 0xDE, 0xD0, 0xAA, 0xA2, 0x09, 0x6B, 0x57, 0xBF, 0xF5, 0x6A, 0x04, 0x4F, 0xB6, 0x2A, 0x3C,
-    0xA8, 0xA6, 0x5F, 0x35, 0x3F, 0x5A, 0xAB, 0x02, 0xD1, 0x86, 0x27, 0xF9, 0x9F, 0xFD, 0xDC, 0xCE,
-    0xFF, 0xA1, 0x52, 0xD5, 0xBF, 0x57, 0x91, 0xF5, 0x65, 0x15, 0xB5, 0xD8, 0x73, 0xB4, 0xC3, 0xD0,
-    0xCD, 0x55, 0x16, 0xCA, 0x79, 0x47, 0xEC, 0x4A, 0x21, 0x4D, 0xFB, 0x0A, 0xAE, 0xAF, 0x9D, 0x02,
-    0xDA, 0x46, 0x9E, 0xF2, 0x87, 0x1A, 0x52, 0x7F, 0x4F, 0xCE, 0x86, 0x19, 0x50, 0x80, 0x24, 0x10,
-    0x6F, 0x64, 0xD8, 0xA1, 0x12, 0x49, 0x93, 0xE8, 0x8F, 0x70, 0x12, 0x98, 0x27, 0xDF, 0x45, 0x7A,
-    0x01, 0x77, 0x59, 0xA7, 0x86, 0x9B, 0x43, 0xD5, 0x16, 0xBD, 0x01, 0x7D, 0xA7, 0xD8, 0x73, 0x0E,
-    0xDB, 0x82, 0x81, 0xE2, 0x51, 0x3C, 0x3C, 0x76, 0x9E, 0xFB, 0x7C, 0x82, 0x7D, 0x76, 0x26, 0xAA,
-    0xF6, 0x80, 0x89, 0xA8, 0x31, 0xB1, 0xB0, 0x18, 0x9B, 0x68, 0x07, 0xAC, 0x10, 0xE3, 0x1E, 0xA3,
-    0xC7, 0x58, 0x3B, 0xAB, 0x29, 0xB9, 0x39, 0x8D, 0xD5, 0x9E, 0x08, 0xE9, 0x55, 0x98, 0x33, 0xE2,
-    0xBF, 0xE0, 0x3C, 0xCB, 0x8B, 0x2C, 0x6F, 0x68, 0xE9, 0xFA, 0x76, 0x95, 0x82, 0x9D, 0xD9, 0x31,
-    0xA9, 0x6B, 0x10, 0x10, 0xCC, 0x86, 0x45, 0x90, 0x09, 0xE1, 0xAA, 0xEC, 0x0F, 0x8A, 0x35, 0x02,
-    0x5F, 0x7C, 0x9E, 0xE2, 0x01, 0x9D, 0x46, 0x15, 0xE0, 0x5B, 0x69, 0x53, 0x2B, 0x5F, 0x92, 0xA2,
-    0xF9, 0x0F, 0x3A, 0x20, 0xAC, 0x4C, 0x06, 0x81, 0x7B, 0xA4, 0xD0, 0x58, 0xCA, 0x64, 0xF5, 0x63,
-    0xFD, 0x89, 0x34, 0xAA, 0xFC, 0x73, 0xCD, 0x35, 0x39, 0x5C, 0x34, 0x30, 0x65, 0x7D, 0xA1, 0x94,
-    0xDF, 0x1F, 0x5A, 0xB1, 0x91, 0x95, 0x1F, 0xDB, 0x67, 0xC4, 0xD9, 0xBA, 0xCA, 0xDD, 0xE8, 0x20,
-    0x9B, 0x8A, 0x82, 0x1A, 0x88, 0xA6, 0x8C, 0xBD, 0xA5, 0xCD, 0x23, 0xB8, 0x3B, 0x34, 0xAF, 0xCA,
-    0x00, 0x74, 0x64, 0xB5, 0x41, 0x7B, 0x5A, 0x15, 0x62, 0xF0, 0xEA, 0x58, 0xB1, 0x63, 0xE3, 0xB9,
-    0x6E, 0xA5, 0xCF, 0x30, 0xA8, 0x55, 0xED, 0xD5, 0x91, 0xF2, 0xFF, 0x0C, 0x67, 0x89, 0xFD, 0xB5,
-    0x0D, 0x5E, 0xAF, 0xCF, 0xA1, 0xAE, 0x03, 0x16, 0x08, 0x7B, 0x63, 0xE4, 0x7F, 0x2E, 0x75, 0xB0,
-    0x70, 0x44, 0x2E, 0x02, 0x98, 0xE2, 0xC4, 0x4B, 0x59, 0x11, 0x36, 0xAF, 0x87, 0x31, 0xD0, 0x33,
-    0xDD, 0x8D, 0x21, 0xEB, 0xF2, 0x53, 0x14, 0xA4, 0xC8, 0xE3, 0x1B, 0x24, 0x4A, 0x17, 0x75, 0x47,
-    0xE6, 0xA8, 0x17, 0xAB, 0x21, 0xE6, 0x10, 0x2C, 0x5E, 0xDE, 0x36, 0xDA, 0x2D, 0xA4, 0x1A, 0xB1,
-    0xCD, 0x32, 0x8D, 0xB9, 0x84, 0xE0, 0x02, 0xA2, 0xE4, 0x23, 0xB4, 0x39, 0x2D, 0xE6, 0x37, 0xB1,
-    0x8A, 0xF8, 0x01, 0xEB, 0xDA, 0x5C, 0x6E, 0x44, 0xBC, 0xDB, 0x11, 0x27, 0x98, 0x80, 0x03, 0xE7,
-    0xF3, 0xB6, 0x2E, 0xB1, 0x51, 0x25, 0x9B, 0xD8, 0x26, 0x99, 0x41, 0x03, 0x14, 0x25, 0x58, 0x18,
-    0xB0, 0x7D, 0xBA, 0xD3, 0xB9, 0x81, 0x22, 0xF1, 0xC9, 0xF2, 0xF2, 0x4F, 0x13, 0xBB, 0xC9, 0xBC,
-    0x48, 0x5C, 0x39, 0x92, 0xAC, 0x66, 0x80, 0x53, 0x2C, 0x78, 0x52, 0xEC, 0x94, 0x2F, 0x66, 0xAA,
-    0xBA, 0xB4, 0x40, 0x3D, 0x38, 0x08, 0x03, 0x53, 0xE8, 0xB6, 0x79, 0xBA, 0x69, 0xCC, 0x7D, 0xCF,
-    0x98, 0x56, 0x60, 0x86, 0x18, 0xFE, 0x1B, 0xC3, 0x8F, 0xAB, 0x61, 0x89, 0xE1, 0x36, 0x86, 0xD2,
-    0x33, 0x79, 0x78, 0x62, 0x9A, 0xF4, 0x45, 0x12, 0x9B, 0x00, 0x40, 0x44, 0x7A, 0x08, 0x58, 0x78,
-    0xF9, 0xF0, 0x08, 0xC7, 0x1D, 0x5D, 0xE8, 0xDC, 0xE0, 0xF2, 0x57, 0x9A, 0x9D, 0x56, 0xC3, 0x14,
-    0xB3, 0x70, 0x8B, 0xD9, 0xF6, 0x4B, 0xEE, 0x78, 0x7C, 0x43, 0x93, 0x59, 0x60, 0x53, 0x49, 0x1B,
-    0xA6, 0xBC, 0x80, 0x32, 0xB5, 0x6D, 0x4C, 0xF2, 0xCB, 0xB6, 0xC9, 0x2F, 0xE2, 0x25, 0xEE, 0x01,
-    0xEE, 0xF2, 0x2B, 0x6E, 0x7E, 0x0F, 0x3D, 0x91, 0x47, 0xCD, 0x4E, 0xB5, 0x71, 0x5C, 0x02, 0xD6,
-    0x6D, 0xC0, 0xCD, 0x61, 0x8F, 0xCD, 0x0F, 0x01, 0x6B, 0x3B, 0x6F, 0x91, 0x07, 0xE9, 0xF1, 0x07,
-    0xD7, 0xC4, 0x23, 0x45, 0xD1, 0xEB, 0x38, 0x9D, 0x90, 0x3C, 0xF6, 0x79, 0x77, 0x52, 0x3C, 0x7A,
-    0x59, 0x9C, 0x0C, 0x5F, 0x8C, 0xC6, 0xED, 0x3C, 0x03, 0x77, 0x44, 0x03, 0x17, 0x99, 0xF4, 0xC4,
-    0x64, 0x12, 0xE7, 0x6D, 0xD1, 0x91, 0xEB, 0x18, 0x4D, 0x8C, 0x8F, 0xC4, 0x00, 0x49, 0x15, 0x42,
-    0xFE, 0xBF, 0x1A, 0xE3, 0x35, 0xAF, 0x33, 0xCF, 0x58, 0xAB, 0x89, 0x21, 0x9B, 0x2C, 0x66, 0xBF,
-    0x00, 0xED, 0x0A, 0x5A, 0xF8, 0xC8, 0xA9, 0x0B, 0x78, 0x06, 0x99, 0x39, 0x87, 0x39, 0xF3, 0xEB,
-    0xEB, 0x78, 0x0C, 0xC9, 0x2D, 0xDF, 0x22, 0xF1, 0x57, 0x05, 0xD3, 0x35, 0x6E, 0x84, 0xF0, 0x19,
-    0xDE, 0x28, 0x67, 0x8F, 0xC5, 0xFF, 0x13, 0xBB, 0x53, 0xB8, 0x8F, 0x72, 0xD9, 0x50, 0xBD, 0x19,
-    0x78, 0xA3, 0x0D, 0x25, 0x6C, 0x7E, 0xC0, 0xA7, 0x00, 0xB1, 0x75, 0x56, 0x19, 0xBF, 0x4D, 0xFE,
-    0x85, 0x9B, 0xDB, 0x3A, 0x1E, 0x09, 0x31, 0x74, 0x9F, 0xE5, 0x9E, 0x4D, 0x7C, 0x1B, 0x8C, 0x23,
-    0x59, 0xDB, 0x8C, 0x14, 0xCD, 0x06, 0xEA, 0x17, 0xE6, 0x7A, 0x70, 0x35, 0x05, 0xA6, 0x98, 0xFC,
-    0x24, 0x7B, 0x13, 0xBE, 0xCD, 0x1C, 0x7C, 0x0C, 0x35, 0x8C, 0x72, 0x76, 0x3C, 0x9C, 0x05, 0xDD,
-    0xC2, 0xB6, 0xCF, 0x63, 0x37, 0x5E, 0x7B, 0x83, 0xE8, 0x5B, 0x36, 0x2B, 0xA1, 0xC4, 0x17, 0x0B,
-    0x69, 0x2E, 0x1E, 0xDC, 0xCB, 0xE9, 0x5F, 0xF7, 0x13, 0xC0, 0x32, 0x00, 0x6B, 0xC8, 0x9F, 0x55,
-    0xA3, 0xD3, 0xEF, 0x8F, 0x6E, 0x52, 0x0C, 0x3C, 0x7A, 0xF6, 0xB1, 0x12, 0x9F, 0x6C, 0xA1, 0xB4,
-    0xD9, 0xD4, 0xF6, 0x93, 0xC0, 0x4D, 0x77, 0x8D, 0xF7, 0x33, 0x12, 0x03, 0x9B, 0x2A, 0xBF, 0xD4,
-    0x18, 0x40, 0x10, 0x41, 0xAB, 0xC4, 0x85, 0xCA, 0x4B, 0x1A, 0x03, 0x5C, 0xC2, 0x02, 0x10, 0xB3,
-    0x28, 0x94, 0xEE, 0x6A, 0x91, 0x0F, 0x9A, 0x52, 0xA1, 0x87, 0x1A, 0xA9, 0x68, 0x4A, 0xC1, 0xD5,
-    0x52, 0x77, 0x8E, 0x42, 0x59, 0x55, 0x54, 0xB3, 0x3E, 0xA2, 0x24, 0x59, 0x3B, 0x39, 0xE1, 0x77,
-    0x6D, 0x42, 0x8E, 0xD5, 0xF8, 0x13, 0x66, 0xDF, 0x66, 0x13, 0xC7, 0x16, 0x53, 0x0E, 0x57, 0xB9,
-    0xFB, 0x11, 0x73, 0x4E, 0x7F, 0x2D, 0x4B, 0x95, 0x6B, 0xAB, 0x25, 0xEC, 0x6A, 0x53, 0x7B, 0x8C,
-    0x43, 0x29, 0xD3, 0x66, 0x39, 0xDB, 0xB6, 0xFB, 0xF5, 0x6B, 0xDB, 0x2C, 0xDB, 0xE0, 0x27, 0xEF,
-    0x16, 0x71, 0x3D, 0xB5, 0x6F, 0xB3, 0x69, 0xAC, 0xCF, 0x4B, 0xC8, 0x87, 0xAC, 0x47, 0xC9, 0xC5,
-    0x08, 0xA0, 0x2C, 0x6A, 0xAF, 0xCE, 0x7C, 0x8E, 0xB0, 0x16, 0xB5, 0xA3, 0x5A, 0x95, 0x47, 0x4B,
-    0xB2, 0x90, 0x46, 0x87, 0xBE, 0x42, 0x3E, 0xF4, 0x77, 0xCE, 0x22, 0x55, 0x7D, 0x06, 0xC2, 0x51,
-    0x54, 0xE5, 0xDC, 0x97, 0xB5, 0x9A, 0x85, 0xE8, 0xEA, 0x8B, 0xCE, 0x0A, 0xAD, 0xBD, 0xB0, 0xBE,
-    0x0A, 0x76, 0x46, 0x8A, 0xA6, 0x9B, 0xA3, 0xAA, 0xCC, 0xEB, 0x6E, 0x49, 0x77, 0xDC, 0x3C, 0xC0,
-    0xD7, 0x4A, 0x9D, 0xFF, 0x1D, 0xB0, 0x4B, 0x60, 0xBB, 0x17, 0x3A, 0x1B, 0x9D, 0xCE, 0xBB, 0xF6,
-    0x2B, 0xBD, 0xC3, 0xDD, 0xE4, 0x8B, 0x04, 0x8E, 0xAA, 0xC3, 0x03, 0x56, 0xDD, 0xBC, 0xC1, 0xC2,
-    0xB0, 0x3F, 0x90, 0x1B, 0xEC, 0x25, 0x20, 0xFA, 0x0E, 0x9F, 0xD4, 0xFA, 0xE8, 0x8E, 0x3D, 0xFB,
-    0xD6, 0x68, 0xD4, 0x1A, 0x7F, 0x3C, 0xAE, 0xCF, 0x90, 0xDC, 0x7A, 0x52, 0xA2, 0x78, 0x52, 0x65,
-    0x5B, 0x6E, 0xAE, 0x51, 0x4D, 0x6E, 0x15, 0xE5, 0x71, 0x72, 0xD6, 0xCA, 0xF6, 0xB9, 0x54, 0xD1,
-    0x9E, 0xCF, 0xB2, 0x6F, 0xF0, 0x49, 0xF7, 0x4A, 0x75, 0x1D, 0x94, 0x03, 0xDF, 0xB8, 0x03, 0x89,
-    0x5A, 0x5B, 0xA4, 0x07, 0xA1, 0x67, 0x0E, 0x07, 0x75, 0x9D, 0x97, 0x49, 0xDD, 0x18, 0xC4, 0xE5,
-    0xC1, 0x38, 0xDC, 0xC4, 0xCF, 0xE7, 0x67, 0xE7, 0x67, 0xFD, 0xFC, 0x60, 0xAB, 0xC0, 0x8E, 0xE4,
-    0x9B, 0x59, 0xFE, 0x1F, 0x45, 0x53, 0xBF, 0x6F, 0x5B, 0x45, 0x1C, 0xFF, 0xDC, 0x1D, 0xF0, 0x44,
-    0x9E, 0xE2, 0x63, 0x00, 0x09, 0xB5, 0xC9, 0xF3, 0xD2, 0xA1, 0x83, 0x1D, 0x2F, 0x19, 0x3C, 0x3C,
-    0xE3, 0x4B, 0x22, 0x51, 0x89, 0x0E, 0x45, 0x02, 0xAB, 0x43, 0x91, 0xC8, 0x3F, 0x00, 0xC9, 0xF0,
-    0x06, 0x0B, 0xDC, 0xFA, 0xDA, 0x0E, 0x1D, 0x3A, 0x34, 0x42, 0x30, 0x75, 0x20, 0x03, 0x48, 0x90,
-    0x4A, 0xC4, 0x83, 0x07, 0x57, 0x4D, 0xE3, 0x4B, 0x32, 0x74, 0xA8, 0x84, 0x4E, 0xAA, 0x10, 0x03,
-    0x03, 0x2F, 0xE9, 0x82, 0x64, 0x29, 0x3D, 0x21, 0x03, 0x56, 0x6B, 0xE7, 0xF8, 0x9E, 0x1B, 0xCA,
-    0x7B, 0xD2, 0xFD, 0xF8, 0xDE, 0xE7, 0xBE, 0xDF, 0xCF, 0x7D, 0x3E, 0x77, 0xE8, 0xAB, 0xFA, 0x38,
-    0xDE, 0xCF, 0x9D, 0x4C, 0xF0, 0xA7, 0x95, 0x29, 0x7B, 0x6A, 0xCA, 0xA9, 0x38, 0x30, 0x69, 0x4D,
-    0x2E, 0xBD, 0xC8, 0xE3, 0x11, 0xC2, 0xE7, 0xCE, 0x21, 0x12, 0x26, 0x5F, 0x9C, 0x8B, 0xA9, 0xCD,
-    0xDE, 0x05, 0xF8, 0x06, 0x76, 0x50, 0x34, 0xD1, 0x0E, 0xFE, 0xD1, 0x69, 0x57, 0x4A, 0x6E, 0xDD,
-    0xB5, 0xFE, 0x5D, 0x3F, 0x41, 0x19, 0xC2, 0xA0, 0x0A, 0x6C, 0x6D, 0x56, 0x4E, 0xA6, 0xA3, 0x48,
-    0xC1, 0xDB, 0xB8, 0xAF, 0xD0, 0x0A, 0x2B, 0x29, 0xE2, 0x95, 0x81, 0xAB, 0x0C, 0x43, 0xD2, 0x35,
-    0x5D, 0x1F, 0x4B, 0xCD, 0x2D, 0x05, 0xA3, 0x6D, 0xB3, 0xBB, 0x26, 0xB5, 0x73, 0x52, 0xC2, 0x75,
-    0x93, 0xE8, 0x99, 0x29, 0xE6, 0x84, 0x98, 0xD9, 0xFA, 0x8A, 0x52, 0x46, 0x06, 0x0E, 0x0B, 0x61,
-    0xF7, 0x10, 0xC5, 0xD0, 0xF5, 0x42, 0x67, 0xD1, 0x24, 0x04, 0x91, 0x9F, 0xC4, 0xD7, 0x73, 0x97,
-    0xC4, 0x37, 0xEC, 0x7B, 0x43, 0x31, 0x61, 0x7F, 0xB9, 0x34, 0xBA, 0xA5, 0xD3, 0x66, 0x7C, 0xF3,
-    0xB9, 0x7B, 0x49, 0x7E, 0x17, 0x54, 0xE6, 0x86, 0x75, 0x49, 0xC2, 0x0E, 0xF3, 0x05, 0x79, 0xC5,
-    0xF6, 0x27, 0xF8, 0xC8, 0xA0, 0x8B, 0x8A, 0xD8, 0x36, 0x75, 0x4B, 0x08, 0xA6, 0xB9, 0xE1, 0xE6,
-    0xF2, 0x2F, 0xDE, 0x0B, 0x13, 0x46, 0x4C, 0x35, 0x1A, 0xDE, 0x87, 0xBD, 0xDE, 0x37, 0x1A, 0x54,
-    0xE4, 0xA4, 0x7F, 0x42, 0x47, 0xB6, 0x0B, 0xCC, 0x49, 0x34, 0x85, 0xA5, 0x86, 0xE5, 0xB1, 0x2A,
-    0x23, 0x63, 0xB9, 0x30, 0x31, 0x5E, 0x23, 0x64, 0xA4, 0x24, 0x9D, 0xA3, 0xCB, 0x6D, 0x88, 0x77,
-    0x84, 0x29, 0xA2, 0x2B, 0x4C, 0x99, 0xE5, 0x12, 0x1F, 0xE2, 0xCD, 0x8A, 0x3E, 0xBE, 0x5A, 0x5C,
-    0x3A, 0xCA, 0xE7, 0x53, 0x7E, 0x40, 0xDC, 0xC4, 0x2D, 0x95, 0x75, 0xE2, 0x19, 0xAC, 0x12, 0xB7,
-    0xF6, 0x58, 0xAE, 0xEC, 0xE5, 0xE5, 0x1A, 0x7F, 0x62, 0xCA, 0x2D, 0xF1, 0x6B, 0x58, 0x7D, 0xA4,
-    0x7B, 0x69, 0x51, 0x78, 0x2B, 0xA7, 0x2A, 0x9D, 0x8F, 0x73, 0x7F, 0xE9, 0x33, 0x38, 0x61, 0x92,
-    0x90, 0x52, 0xA2, 0x15, 0x6A, 0xA3, 0xAD, 0xA5, 0xD7, 0xE7, 0x24, 0xA8, 0x28, 0xA9, 0x43, 0x81,
-    0x1E, 0x62, 0x4D, 0x8D, 0x54, 0xA4, 0x92, 0xF4, 0xAE, 0xED, 0x35, 0xFA, 0x01, 0xF3, 0xD6, 0x29,
-    0x86, 0xAD, 0x81, 0x34, 0xE5, 0x2E, 0x08, 0x28, 0x97, 0xD0, 0x92, 0xF7, 0x6C, 0x65, 0x32, 0x35,
-    0x97, 0x6B, 0x8C, 0x51, 0x31, 0x51, 0x8F, 0x0D, 0x54, 0x95, 0x1C, 0x10, 0x7B, 0xF9, 0x6E, 0xFF,
-    0x8E, 0x1F, 0xD3, 0x36, 0xC2, 0x36, 0xC1, 0xB7, 0xC8, 0x28, 0xB2, 0xD1, 0x41, 0x82, 0x79, 0x9D,
-    0xF4, 0x4F, 0x2B, 0x76, 0x54, 0x51, 0x6E, 0xDB, 0x76, 0x30, 0x0A, 0x67, 0x6D, 0x71, 0x12, 0x59,
-    0x8A, 0x27, 0x10, 0xBF, 0xE7, 0xF5, 0x6F, 0x6F, 0x9A, 0xB4, 0x25, 0x0E, 0x74, 0x33, 0x95, 0xCB,
-    0xA7, 0x97, 0xE8, 0x8D, 0xAD, 0xCD, 0xBA, 0x37, 0x74, 0x3F, 0x58, 0xC8, 0x43, 0x4C, 0x29, 0x77,
-    0xED, 0xD5, 0x24, 0x0A, 0x2B, 0x78, 0xA9, 0xC7, 0xB2, 0x75, 0x65, 0x29, 0xCC, 0x35, 0x17, 0x8D,
-    0xF9, 0xDF, 0xAE, 0x19, 0x5F, 0x54, 0xBD, 0xAE, 0xBC, 0x30, 0x70, 0xC5, 0x90, 0x86, 0xDD, 0x47,
-    0x7B, 0x24, 0xC5, 0xBE, 0x2D, 0xA7, 0x24, 0x59, 0x5A, 0xF9, 0xD4, 0xF8, 0x1D, 0x76, 0x41, 0x53,
-    0xE5, 0xDA, 0x4C, 0x5F, 0xF7, 0x75, 0x20, 0xB3, 0x81, 0x45, 0xCC, 0xE2, 0xF2, 0x37, 0x75, 0xAF,
-    0xAB, 0x34, 0x10, 0x0A, 0x0A, 0xEF, 0x34, 0x2E, 0xF9, 0x29, 0x53, 0xE9, 0x0F, 0x1B, 0x1F, 0x03,
-    0x75, 0x7F, 0xC7, 0x93, 0xF7, 0xC2, 0xA4, 0x9C, 0xFC, 0xEC, 0xBE, 0x52, 0x37, 0x85, 0xE3, 0x26,
-    0x98, 0xF9, 0x76, 0x00, 0x77, 0x90, 0x51, 0xE4, 0xFF, 0xBF, 0x49, 0xD7, 0xC6, 0x4D, 0x4D, 0x57,
-    0x09, 0x21, 0xD8, 0x0F, 0xAB, 0xBB, 0xC7, 0x89, 0x78, 0x62, 0x4A, 0x19, 0x7F, 0x8C, 0x6A, 0x27,
-    0xBA, 0x8D, 0x61, 0xED, 0x4B, 0x36, 0x5A, 0x65, 0xF7, 0xF9, 0x60, 0xCF, 0x66, 0xAE, 0xF4, 0xC5,
-    0xC3, 0xCA, 0x77, 0x31, 0x98, 0x45, 0xED, 0x13, 0x7E, 0x42, 0x78, 0xEC, 0x0E, 0xE7, 0x49, 0x97,
-    0xB9, 0x8C, 0x3D, 0x46, 0xA9, 0x23, 0x1E, 0xA9, 0x6E, 0xED, 0x73, 0xBA, 0xC4, 0x5C, 0x9D, 0xE7,
-    0xA6, 0x83, 0x23, 0x8B, 0x07, 0x8A, 0x54, 0xA1, 0xB7, 0xC2, 0x8E, 0x21, 0x6E, 0x43, 0x0A, 0x5D,
-    0x62, 0x86, 0xF7, 0xC4, 0xBD, 0xF0, 0x94, 0x24, 0xAE, 0xEC, 0xFB, 0x23, 0x9B, 0xE5, 0x69, 0xAD,
-    0x25, 0x46, 0x60, 0x8A, 0x62, 0x74, 0xB8, 0x75, 0xC4, 0x67, 0xD4, 0xE0, 0xA1, 0x54, 0x87, 0xF9,
-    0x6C, 0x89, 0x11, 0x99, 0x2A, 0xE5, 0x25, 0x32, 0x1F, 0x60, 0x7D, 0x0A, 0x89, 0xA6, 0x10, 0xA6,
-    0xF3, 0x6E, 0xA1, 0xCC, 0x7E, 0x53, 0x0B, 0x56, 0x3C, 0x43, 0x35, 0x8B, 0x56, 0x4C, 0xA7, 0x3C,
-    0x83, 0x9C, 0xA9, 0xFF, 0x9E, 0x75, 0x49, 0x8A, 0xEB, 0x76, 0xBD, 0x84, 0xD7, 0xCF, 0xF0, 0xCD,
-    0xC2, 0x83, 0x9F, 0x77, 0xE4, 0xD2, 0xB0, 0x94, 0xB0, 0xBC, 0x54, 0xE2, 0x26, 0x4D, 0x85, 0xA9,
-    0x56, 0x85, 0x5E, 0xCC, 0x22, 0xB5, 0xBE, 0x1E, 0xA3, 0xD3, 0x99, 0xC1, 0x26, 0xBF, 0xB8, 0x51,
-    0x78, 0x61, 0xAE, 0x46, 0xCB, 0xF9, 0xBC, 0x44, 0xA7, 0x2A, 0xF6, 0x6C, 0x21, 0x56, 0x59, 0xCA,
-    0x4D, 0x1E, 0x83, 0xBF, 0xAF, 0x67, 0x07, 0xD3, 0xB5, 0x82, 0x44, 0x56, 0x65, 0x36, 0x97, 0x91,
-    0x6E, 0x56, 0xEE, 0x9A, 0xA7, 0x23, 0xA1, 0x31, 0x1F, 0x94, 0x25, 0xFF, 0xC1, 0x7F, 0x94, 0x3F,
-    0x95, 0x68, 0x2A, 0x35, 0x1B, 0x06, 0x81, 0xBF, 0xEF, 0xB5, 0x2D, 0xC7, 0x1C, 0x7F, 0x7E, 0xF6,
-    0x8F, 0xF9, 0xF0, 0x8A, 0x0A, 0x58, 0x64, 0x36, 0xFA, 0x3A, 0xB6, 0xFF, 0x02, 0x55, 0x57, 0x3D,
-    0x6C, 0x1C, 0xC7, 0x15, 0x7E, 0xBB, 0x63, 0x72, 0x01, 0x2E, 0xC0, 0x51, 0xE3, 0x24, 0xD6, 0x0F,
-    0xB7, 0x71, 0x61, 0x20, 0x31, 0xB7, 0x71, 0x11, 0x20, 0x77, 0xBB, 0xA3, 0x08, 0x48, 0x8A, 0x14,
-    0x62, 0xA1, 0x4B, 0x23, 0x20, 0x76, 0x69, 0xC4, 0x09, 0x98, 0xC2, 0x31, 0x58, 0xDC, 0xF1, 0x96,
-    0x08, 0x52, 0xA5, 0xA0, 0x62, 0x20, 0x69, 0x02, 0x24, 0x2E, 0x12, 0x20, 0xA6, 0x0A, 0xAB, 0x10,
-    0x02, 0x19, 0x3A, 0xF2, 0xC6, 0x52, 0x91, 0x32, 0x2B, 0xD8, 0x96, 0x0B, 0x01, 0xD1, 0x1A, 0x91,
-    0x2D, 0x84, 0x2A, 0x38, 0x8A, 0x96, 0xD6, 0xDE, 0x71, 0x6F, 0x27, 0xDF, 0x9B, 0x3D, 0x91, 0xD2,
-    0x11, 0xDC, 0xBB, 0x9B, 0xBF, 0xF7, 0xDE, 0xF7, 0xBE, 0xF7, 0xBD, 0x39, 0x22, 0x22, 0xCF, 0x16,
-    0x94, 0x5A, 0x2D, 0x4A, 0x8F, 0x22, 0x45, 0x54, 0x13, 0x05, 0x39, 0x51, 0x4C, 0x3B, 0x7F, 0xAF,
-    0x85, 0x7D, 0x5A, 0x44, 0xBD, 0x8B, 0xD9, 0x88, 0x52, 0x51, 0xD0, 0xAE, 0x54, 0xD4, 0xEC, 0x7D,
-    0x48, 0xD6, 0x56, 0x14, 0x7D, 0xAE, 0x28, 0xC1, 0xE6, 0x12, 0xAB, 0x35, 0xAF, 0x26, 0x1A, 0x37,
-    0x24, 0x30, 0xD3, 0xBE, 0xC4, 0x6D, 0x4D, 0xDE, 0x9D, 0x9C, 0xBC, 0xC6, 0x50, 0x60, 0x2D, 0xC9,
-    0x66, 0xA8, 0xE5, 0x81, 0x24, 0xF9, 0xCF, 0x1F, 0xAB, 0xF0, 0xD3, 0xDB, 0x5A, 0x14, 0x45, 0xE1,
-    0x9B, 0x6B, 0xD7, 0xA9, 0xEE, 0x74, 0x28, 0x39, 0x77, 0x8E, 0xE4, 0x45, 0x49, 0xC1, 0x17, 0xBF,
-    0xC9, 0xBC, 0x6F, 0x6E, 0xE5, 0x94, 0x18, 0x43, 0xB2, 0x7C, 0x97, 0xFC, 0xBA, 0x43, 0x94, 0xFE,
-    0xF9, 0x15, 0x0A, 0xAD, 0xCD, 0xC4, 0x81, 0xCD, 0xBC, 0x3B, 0x05, 0x11, 0x26, 0xE9, 0xD5, 0x57,
-    0xE7, 0x86, 0xC8, 0x1B, 0x57, 0x24, 0x61, 0x61, 0x98, 0xFF, 0x92, 0x66, 0x30, 0xCC, 0x1E, 0x61,
-    0x91, 0x84, 0x57, 0xF0, 0x17, 0x9E, 0xBD, 0x5F, 0xA6, 0xFE, 0xFD, 0x32, 0xF1, 0x9B, 0xB5, 0x04,
-    0x93, 0x5D, 0x04, 0xD2, 0x85, 0xCB, 0xDD, 0x50, 0x53, 0x22, 0x33, 0x4A, 0xB1, 0x28, 0xDA, 0xC6,
-    0x5A, 0xBB, 0x08, 0xF7, 0xAD, 0x0B, 0x83, 0x3C, 0x6C, 0x84, 0xD7, 0xDA, 0xB7, 0xC0, 0x66, 0xD6,
-    0xBB, 0x44, 0x5D, 0x18, 0x8A, 0xA8, 0x8D, 0xD5, 0x87, 0x79, 0xE2, 0x38, 0xDD, 0x20, 0x56, 0xC2,
-    0x39, 0x85, 0xAD, 0xFA, 0x64, 0x10, 0xFF, 0x1F, 0xED, 0x67, 0x34, 0xC4, 0xEE, 0x85, 0xC9, 0xDA,
-    0xC9, 0x20, 0x6C, 0x1E, 0xBF, 0xC6, 0x70, 0x94, 0x17, 0xC8, 0xFC, 0x7B, 0xED, 0x91, 0x0C, 0x27,
-    0x23, 0x4F, 0xFD, 0xF9, 0xCA, 0xD3, 0xCD, 0x0E, 0xBB, 0x54, 0xD0, 0xB7, 0x0E, 0x2F, 0xB5, 0x10,
-    0x7F, 0x1B, 0x1F, 0x42, 0xB6, 0xF4, 0xCE, 0xFE, 0x5F, 0xDB, 0x75, 0x88, 0xC0, 0xED, 0xF6, 0x76,
-    0x7B, 0x3D, 0x95, 0x22, 0x33, 0xD8, 0x60, 0x15, 0x9F, 0xBF, 0xE0, 0xAC, 0xAC, 0xB8, 0x67, 0xC7,
-    0x3D, 0xAF, 0x13, 0x7D, 0x10, 0x6F, 0x1D, 0x15, 0xF4, 0xD8, 0x3E, 0xB1, 0xB5, 0xF7, 0xF4, 0xAE,
-    0x3D, 0xDC, 0xF3, 0x1B, 0xB2, 0x59, 0xEA, 0x57, 0x64, 0x29, 0x16, 0x06, 0xC9, 0xE7, 0x44, 0x57,
-    0x94, 0x04, 0x39, 0x63, 0x15, 0xEA, 0xC0, 0x50, 0x5F, 0x6A, 0x69, 0x68, 0x24, 0xB3, 0x18, 0x33,
-    0x52, 0x0D, 0x73, 0xAA, 0x22, 0x7A, 0xAA, 0xBD, 0x32, 0xF6, 0xEF, 0x69, 0xDF, 0x24, 0xC1, 0xBF,
-    0xF0, 0xEC, 0x4A, 0x99, 0x61, 0xE7, 0xEA, 0x73, 0xE6, 0xCC, 0x49, 0xAC, 0x14, 0x2B, 0xA4, 0xBE,
-    0x10, 0x5A, 0x54, 0x9E, 0xF1, 0x2C, 0xDD, 0xA0, 0x9B, 0xBA, 0x4B, 0x5D, 0x83, 0xC1, 0x4E, 0xA0,
-    0xBF, 0x7B, 0x70, 0x75, 0x1A, 0xC1, 0xED, 0xAD, 0x8F, 0x3F, 0x1E, 0xA8, 0xEE, 0x8A, 0xA4, 0x37,
-    0xFF, 0x74, 0xEF, 0xB3, 0x21, 0x06, 0xCE, 0x4C, 0xF7, 0xA6, 0xEA, 0x86, 0xC4, 0x4A, 0xFF, 0x3E,
-    0x49, 0x1A, 0xEB, 0x40, 0x47, 0x60, 0x4D, 0x50, 0xE2, 0x80, 0x19, 0x40, 0x4D, 0xF9, 0xE4, 0x09,
-    0xA3, 0x00, 0x90, 0x28, 0xF8, 0x9A, 0x33, 0x67, 0x38, 0xF1, 0x23, 0xAF, 0x64, 0x3C, 0xBB, 0x4C,
-    0x81, 0xE8, 0x42, 0x16, 0xE8, 0xE0, 0x56, 0xEE, 0x1B, 0xF1, 0xB8, 0xA4, 0x5A, 0x1C, 0x59, 0x93,
-    0x5C, 0x9E, 0xDA, 0x4A, 0xDA, 0x52, 0x66, 0x81, 0xBD, 0x22, 0x30, 0x83, 0x6D, 0x9C, 0xBC, 0x3E,
-    0xEF, 0x58, 0xE5, 0x9C, 0x62, 0x46, 0x93, 0x9B, 0x01, 0xC3, 0x31, 0x93, 0x1A, 0xCC, 0x04, 0x35,
-    0x87, 0x72, 0x0A, 0xDF, 0xD8, 0x26, 0xD7, 0x0C, 0x9E, 0x9B, 0xEB, 0x30, 0x4D, 0x23, 0xC1, 0xD1,
-    0xD6, 0x9E, 0xA3, 0x06, 0x90, 0x79, 0x40, 0xA5, 0x67, 0x80, 0xB1, 0xF1, 0x9F, 0x94, 0x6F, 0xC3,
-    0xE3, 0xFF, 0xE4, 0x24, 0x8A, 0xE8, 0x76, 0xCE, 0xF9, 0x04, 0x4C, 0xA8, 0x13, 0xC0, 0x1B, 0xDC,
-    0x35, 0xD4, 0x20, 0xD3, 0x25, 0xA5, 0x99, 0xCC, 0xC0, 0xE2, 0x5C, 0xAA, 0x9A, 0x84, 0x89, 0x68,
-    0x84, 0x9C, 0x46, 0x70, 0x47, 0x14, 0x31, 0x75, 0xDF, 0x0A, 0xF3, 0x84, 0x92, 0xA1, 0x05, 0x62,
-    0x69, 0xDC, 0x38, 0x38, 0x15, 0xF9, 0x79, 0xA0, 0xA5, 0x2A, 0x85, 0x11, 0xBA, 0xEB, 0xD5, 0x7E,
-    0x01, 0x74, 0xA8, 0x14, 0x3A, 0xD5, 0x7D, 0x32, 0xE7, 0xCC, 0x2A, 0x75, 0x64, 0x47, 0x2A, 0x29,
-    0xB6, 0x39, 0xF4, 0x4F, 0x6F, 0x15, 0x4B, 0xD3, 0xE9, 0x74, 0xC2, 0xD4, 0xB0, 0xD9, 0xFA, 0xE6,
-    0xFA, 0xA6, 0x0A, 0xB7, 0x83, 0x6D, 0xF2, 0x1F, 0x6E, 0x3D, 0xCC, 0xE8, 0x1F, 0xFA, 0xBD, 0x9C,
-    0x5E, 0xC7, 0x26, 0x0A, 0xAF, 0x07, 0x37, 0x50, 0x72, 0x3E, 0xC2, 0x6C, 0x70, 0x1C, 0xA5, 0x2A,
-    0xCE, 0x50, 0x47, 0x8E, 0xB4, 0xB1, 0xE5, 0xE4, 0xA6, 0x96, 0x61, 0xEF, 0xD2, 0x50, 0x75, 0xE0,
-    0x9D, 0xCC, 0xFA, 0x48, 0x44, 0xA0, 0x47, 0x54, 0xBE, 0x12, 0xE8, 0x8A, 0xCA, 0x24, 0xD0, 0x08,
-    0xBB, 0x1B, 0x66, 0xC6, 0x37, 0x1D, 0x79, 0xDE, 0xF8, 0x45, 0x5F, 0xFE, 0xB0, 0x10, 0xF9, 0x8D,
-    0x48, 0x20, 0xF7, 0x55, 0x2C, 0xE0, 0x74, 0xB9, 0x1A, 0xE8, 0xF0, 0x13, 0x2C, 0xD2, 0x72, 0xCB,
-    0x74, 0xC2, 0x0C, 0x0B, 0x5E, 0x63, 0x4F, 0x73, 0x14, 0x48, 0x24, 0x50, 0x93, 0x84, 0x05, 0x70,
-    0x21, 0x01, 0xCF, 0x0D, 0x75, 0xA5, 0x6D, 0xD4, 0x31, 0x8B, 0xB8, 0xD8, 0x98, 0xF5, 0x4B, 0x57,
-    0xA7, 0x0C, 0x3F, 0xFC, 0xEC, 0x6D, 0x2A, 0xCE, 0x39, 0x79, 0x7B, 0xF0, 0x32, 0xB5, 0x31, 0x89,
-    0x49, 0x54, 0x51, 0x9C, 0x45, 0x20, 0x29, 0xE8, 0x81, 0x41, 0x30, 0x1A, 0x30, 0x22, 0x8B, 0x48,
-    0x69, 0x4E, 0x03, 0x94, 0x11, 0x92, 0x3A, 0x42, 0x58, 0x78, 0xDB, 0x83, 0xF3, 0x21, 0x66, 0xF4,
-    0xCD, 0x1C, 0x01, 0x42, 0x04, 0xE2, 0x12, 0xA7, 0xBF, 0xF4, 0xCC, 0x5C, 0xAF, 0xE7, 0xAA, 0xCD,
-    0xD0, 0xE9, 0x9D, 0x1D, 0xF5, 0x62, 0xD9, 0x62, 0xFD, 0x67, 0x7D, 0xA7, 0x33, 0xAC, 0x97, 0xAE,
-    0x36, 0x61, 0x84, 0x16, 0x76, 0x7B, 0x0A, 0xF2, 0x58, 0xD3, 0x52, 0x83, 0x1D, 0x5C, 0xF1, 0xCC,
-    0x20, 0xA7, 0x0D, 0xCE, 0xDD, 0x78, 0x3E, 0xD2, 0x46, 0xC2, 0x72, 0x11, 0x16, 0x0B, 0x1C, 0x0A,
-    0xF6, 0x8E, 0x67, 0x2D, 0xB9, 0xB0, 0x0D, 0xEC, 0x1D, 0x51, 0x84, 0x7A, 0xF2, 0x2A, 0x26, 0x70,
-    0x46, 0x03, 0x7C, 0x00, 0x23, 0x32, 0x0A, 0x3F, 0xC1, 0xA6, 0x04, 0x1F, 0xE8, 0x10, 0x1F, 0xD6,
-    0xED, 0xFE, 0x07, 0x9C, 0x54, 0xBD, 0x60, 0x87, 0x97, 0x40, 0x9C, 0x01, 0xF3, 0x9D, 0x79, 0x0C,
-    0x1B, 0xA0, 0x3B, 0xB4, 0x25, 0x93, 0x8C, 0x68, 0xA4, 0x70, 0x62, 0xCA, 0xE2, 0x35, 0x62, 0x17,
-    0x9C, 0x5E, 0x5A, 0xB7, 0xB1, 0x37, 0xEC, 0xAD, 0x39, 0xA9, 0x64, 0xEF, 0xBD, 0xF2, 0x57, 0x44,
-    0xBB, 0xEC, 0x26, 0xCE, 0x40, 0xC9, 0xC3, 0x39, 0x86, 0xE4, 0x2D, 0x4A, 0xEB, 0x11, 0xAD, 0xA4,
-    0x3C, 0x58, 0xB6, 0x83, 0x11, 0x26, 0x53, 0x2C, 0x5C, 0x41, 0x05, 0x7A, 0x2C, 0x41, 0x48, 0x1F,
-    0x79, 0xCF, 0x15, 0xFC, 0x99, 0xB6, 0x11, 0x40, 0x90, 0x30, 0x49, 0xAF, 0xAB, 0xF5, 0x76, 0xCE,
-    0x77, 0xA3, 0x5D, 0xDA, 0x25, 0x97, 0x48, 0x56, 0xBC, 0xD6, 0x25, 0x76, 0x2A, 0x9A, 0xBF, 0x29,
-    0xD7, 0x56, 0xA2, 0x36, 0xB1, 0x73, 0x0C, 0x63, 0xFA, 0xB9, 0x82, 0x8B, 0xA9, 0x6F, 0x0D, 0x4C,
-    0x25, 0xE1, 0xD7, 0x35, 0x07, 0x23, 0x55, 0x3F, 0xD0, 0x5E, 0x15, 0x53, 0x9F, 0x85, 0x2A, 0x81,
-    0x52, 0x65, 0x31, 0xAA, 0x64, 0x24, 0xFF, 0x68, 0x69, 0xD3, 0x2F, 0x23, 0x38, 0x01, 0x85, 0x8D,
-    0xC1, 0xA0, 0xB1, 0xF3, 0x83, 0xAA, 0x53, 0xCE, 0x8D, 0xB2, 0x6D, 0x1C, 0x73, 0x9F, 0xE6, 0x6F,
-    0x45, 0xDB, 0xB7, 0xE6, 0x6F, 0xF9, 0x71, 0x28, 0x3E, 0x97, 0x1C, 0xD7, 0x9D, 0xC7, 0xE4, 0x00,
-    0xB7, 0xC9, 0xF5, 0x0F, 0x32, 0x90, 0x56, 0x81, 0xDA, 0x25, 0xC9, 0xDF, 0x3A, 0x2C, 0xF1, 0xDF,
-    0x60, 0xB3, 0x38, 0xE0, 0xAC, 0xB2, 0x05, 0xCE, 0x92, 0x63, 0x2B, 0x6B, 0x43, 0x3F, 0x45, 0xED,
-    0xFF, 0xEF, 0x51, 0x06, 0x9E, 0x21, 0xBF, 0x4F, 0x0C, 0xAA, 0x27, 0x54, 0x86, 0xCA, 0xEF, 0x08,
-    0xAE, 0x2E, 0xF9, 0x4C, 0x35, 0x9D, 0x4F, 0xAE, 0xE0, 0x36, 0x99, 0x6B, 0x66, 0x6E, 0x7E, 0x3C,
-    0x61, 0x2C, 0xD1, 0x13, 0xFF, 0x30, 0x46, 0x8B, 0x80, 0x62, 0x4E, 0x77, 0x9A, 0x8B, 0xC8, 0x1F,
-    0x84, 0x01, 0xB5, 0xA3, 0x02, 0xFD, 0xCE, 0xFE, 0xD5, 0x49, 0xCA, 0xCA, 0x5F, 0x83, 0x8F, 0x89,
-    0x37, 0x43, 0x86, 0x67, 0xE8, 0x60, 0xD5, 0x49, 0xB3, 0x62, 0xAC, 0xB9, 0x1F, 0xBE, 0xD0, 0xC1,
-    0x9E, 0xBD, 0x36, 0xB8, 0x8D, 0x36, 0xB8, 0x09, 0x80, 0xA4, 0xE3, 0xFB, 0x97, 0x75, 0x8C, 0x36,
-    0x1B, 0x98, 0x73, 0x20, 0xB7, 0xAF, 0x11, 0x47, 0x87, 0x58, 0x67, 0x70, 0xC4, 0x06, 0xAC, 0x87,
-    0x0A, 0x29, 0xB3, 0x16, 0x4D, 0xC1, 0x9A, 0x9A, 0x0E, 0x87, 0x52, 0xAF, 0x88, 0xA2, 0xF6, 0xF3,
-    0x41, 0xA8, 0xA1, 0xE5, 0x9B, 0x42, 0x8F, 0x44, 0xB9, 0x21, 0xB3, 0xE8, 0xD1, 0xF9, 0x12, 0xE8,
-    0x73, 0x43, 0xB5, 0x57, 0x5A, 0xC8, 0x57, 0x5A, 0xE9, 0xE2, 0x30, 0xF9, 0xAB, 0x70, 0xFC, 0xE7,
-    0x87, 0x1C, 0x31, 0xC4, 0xDC, 0xCE, 0xBA, 0xFC, 0xE0, 0xA6, 0xEF, 0x95, 0x5D, 0x42, 0xF7, 0xB5,
-    0x33, 0xA6, 0x69, 0x0D, 0x8A, 0x26, 0x5C, 0x18, 0x31, 0x77, 0x65, 0xE8, 0x36, 0x3F, 0x1C, 0x55,
-    0x10, 0x89, 0x64, 0x62, 0x00, 0x05, 0x0D, 0xB6, 0x03, 0x72, 0x99, 0xA5, 0x8C, 0xE0, 0xE0, 0xA4,
-    0xD9, 0xAE, 0x03, 0xC1, 0x88, 0xAB, 0xEF, 0x90, 0x69, 0xEB, 0x9A, 0x86, 0xB3, 0xCF, 0x0C, 0x13,
-    0x66, 0x69, 0x67, 0x67, 0x9C, 0xB1, 0x8D, 0x85, 0x9E, 0xFD, 0x0A, 0x28, 0x94, 0xF4, 0xB2, 0x9D,
-    0xF4, 0xD8, 0xAA, 0x89, 0xF7, 0x77, 0x3E, 0x74, 0x30, 0x39, 0x2E, 0x1E, 0xA7, 0xB4, 0xA1, 0x5F,
-    0xB8, 0xCB, 0x01, 0xB4, 0xA1, 0x6C, 0xAF, 0x0A, 0xF3, 0x8B, 0x48, 0xC1, 0xBC, 0xBF, 0x82, 0xA0,
-    0x01, 0xE2, 0x5F, 0x7E, 0x46, 0x63, 0x81, 0x1B, 0x80, 0x97, 0xC3, 0xE0, 0x35, 0x9C, 0xD0, 0x41,
-    0x0C, 0x12, 0xF4, 0x0A, 0x32, 0xAF, 0xF4, 0x73, 0x40, 0x78, 0x0D, 0x13, 0x3C, 0xB8, 0x0C, 0x27,
-    0x82, 0x0C, 0x48, 0x43, 0x53, 0xD0, 0x33, 0x83, 0x02, 0xD1, 0xCF, 0x96, 0x61, 0xEB, 0xD1, 0x8F,
-    0x94, 0xBB, 0x7F, 0x9C, 0xB1, 0x0F, 0x5A, 0x72, 0x30, 0x7E, 0xDE, 0xB1, 0xB5, 0x3C, 0xE4, 0x51,
-    0xA8, 0xB6, 0x8E, 0x69, 0xB1, 0xB9, 0x3A, 0x7D, 0x9F, 0xD1, 0x5A, 0x3C, 0xBC, 0xFC, 0xB9, 0x8A,
-    0x71, 0xBA, 0x30, 0xAE, 0xF2, 0x2B, 0x30, 0x19, 0xDE, 0xF7, 0xBD, 0x76, 0x1D, 0xDA, 0x1F, 0x8B,
-    0x02, 0xB8, 0x5A, 0x06, 0x2C, 0xB8, 0x7D, 0x50, 0x01, 0x1F, 0x12, 0x14, 0x33, 0xC4, 0xC6, 0xD5,
-    0xC8, 0x89, 0xDA, 0x72, 0xDD, 0x20, 0x18, 0xD6, 0xBB, 0xDF, 0xF7, 0x5B, 0xDC, 0x5A, 0x00, 0xDC,
-    0x25, 0xC5, 0xE1, 0x41, 0x43, 0x7E, 0x48, 0x57, 0x41, 0xEE, 0xD6, 0x11, 0xBA, 0x16, 0x39, 0x64,
-    0xE4, 0x7D, 0xF7, 0x31, 0x55, 0x6F, 0xBF, 0x76, 0x3A, 0xC8, 0x7F, 0x70, 0xF3, 0xDF, 0x5F, 0x96,
-    0x67, 0xCB, 0x8D, 0xEF, 0x0F, 0xC4, 0xC6, 0xD9, 0xE5, 0x94, 0x76, 0x43, 0x31, 0x56, 0xF2, 0xE8,
-    0xAE, 0x55, 0xFE, 0x01, 0x98, 0x4A, 0xC5, 0xAF, 0x41, 0xC1, 0x37, 0xCE, 0x2E, 0xB3, 0xFA, 0x72,
-    0x88, 0x90, 0xDD, 0x19, 0xB2, 0x3C, 0x5B, 0x60, 0x0D, 0xE6, 0xCB, 0x4C, 0xAF, 0xB7, 0xC6, 0xB7,
-    0x9B, 0x94, 0x13, 0xCF, 0x82, 0xC3, 0x54, 0x8E, 0xE6, 0xCA, 0x9B, 0xCE, 0xE9, 0xDD, 0x9D, 0xDF,
-    0x9D, 0x46, 0x73, 0x55, 0xAE, 0x5A, 0x2F, 0x99, 0xED, 0x73, 0x19, 0xAE, 0x22, 0x06, 0x74, 0x6F,
-    0xBE, 0xA6, 0x62, 0x7D, 0xDA, 0xB2, 0x16, 0xFC, 0x18, 0x30, 0x15, 0x38, 0x1C, 0xC1, 0x55, 0xF6,
-    0xDF, 0xF6, 0xBC, 0x7E, 0x7B, 0x86, 0xDB, 0x5B, 0xB4, 0x7C, 0x62, 0xD3, 0x6C, 0x6E, 0x30, 0x67,
-    0x45, 0xEC, 0x5C, 0x38, 0x45, 0xC9, 0xA2, 0xC1, 0x61, 0x57, 0x68, 0xFC, 0x80, 0x22, 0x84, 0xB3,
-    0xCA, 0xF2, 0x34, 0xC1, 0x75, 0x15, 0xA9, 0x63, 0x31, 0x45, 0x21, 0xBF, 0x74, 0xC1, 0x50, 0x82,
-    0x63, 0x06, 0x40, 0x6F, 0x84, 0xD9, 0x2A, 0xD4, 0xC8, 0x11, 0x1A, 0x95, 0xFC, 0xAD, 0x55, 0x11,
-    0x30, 0x88, 0xB9, 0x4C, 0x8E, 0xB1, 0x07, 0xC4, 0xFE, 0x11, 0x1B, 0x0C, 0x61, 0xF1, 0xDD, 0x15,
-    0x66, 0x17, 0xAE, 0x6F, 0xE2, 0xE1, 0x57, 0xBD, 0xB5, 0x90, 0xB9, 0xB9, 0xD8, 0xEC, 0x7C, 0x64,
-    0xC0, 0x38, 0x9F, 0xEB, 0x51, 0x80, 0x5D, 0xB4, 0x4C, 0x8F, 0xBF, 0xCC, 0xDF, 0x10, 0x07, 0x07,
-    0xB7, 0x74, 0xF4, 0xC5, 0xC3, 0x03, 0x1A, 0x2C, 0x05, 0xC6, 0x35, 0xA8, 0x31, 0xCB, 0xFB, 0x76,
-    0x9B, 0x8C, 0x53, 0xF3, 0x6B, 0x4B, 0xDA, 0x9C, 0x70, 0x69, 0xF5, 0x44, 0xF7, 0x18, 0x41, 0xA7,
-    0x10, 0x2D, 0x40, 0xAE, 0x33, 0xD0, 0xCB, 0x33, 0xC7, 0x03, 0xB0, 0x83, 0x15, 0x06, 0xD7, 0xB8,
-    0xD8, 0x2F, 0xBD, 0x4A, 0x14, 0x52, 0xA7, 0x80, 0x69, 0x04, 0x3D, 0xCA, 0x43, 0xDC, 0x01, 0xF0,
-    0x07, 0x86, 0xE3, 0xAF, 0x02, 0x68, 0x95, 0xCB, 0xCF, 0x79, 0xAE, 0x0F, 0xE3, 0x30, 0x62, 0x74,
-    0x85, 0x49, 0xDA, 0x4C, 0x05, 0x76, 0xC2, 0x37, 0x0A, 0x68, 0xC3, 0xEC, 0xA7, 0x96, 0x4D, 0xCF,
-    0xDA, 0x16, 0x35, 0x02, 0xB5, 0xB0, 0x30, 0x52, 0x80, 0x79, 0x04, 0x67, 0x82, 0x02, 0xBC, 0x1D,
-    0xE3, 0x2A, 0x3D, 0x36, 0x28, 0xB8, 0x19, 0x2E, 0xC4, 0x7F, 0x9B, 0x4B, 0x73, 0xE4, 0x2E, 0x7D,
-    0x0D, 0xFB, 0x55, 0xB5, 0x59, 0x71, 0x29, 0xF1, 0xCD, 0x73, 0x97, 0xEC, 0x82, 0x5B, 0x5A, 0xCE,
-    0x0F, 0xFC, 0x0E, 0x41, 0x62, 0x0B, 0x72, 0xA5, 0xE9, 0xDB, 0x7B, 0x35, 0x85, 0x47, 0x17, 0x20,
-    0xC5, 0xBF, 0x0B, 0x14, 0xEE, 0xFF, 0xA8, 0xA3, 0x91, 0x84, 0x02, 0x57, 0xCB, 0xCB, 0xE0, 0x0B,
-    0x7E, 0x8A, 0xB8, 0x53, 0xC4, 0x8B, 0x0F, 0x37, 0xD6, 0x76, 0x0C, 0x27, 0x9C, 0xBB, 0xED, 0xAD,
-    0x16, 0xCC, 0x7C, 0x73, 0xD2, 0x6B, 0x81, 0x49, 0x1D, 0x93, 0xBC, 0x3B, 0x9A, 0x7C, 0xFC, 0xF8,
-    0xE1, 0x1F, 0x40, 0x43, 0x60, 0x36, 0xE6, 0x5F, 0x10, 0x97, 0xA1, 0x56, 0x5E, 0x8D, 0x08, 0x6B,
-    0xBE, 0x7C, 0xE0, 0x9F, 0xCB, 0xAD, 0x14, 0x79, 0x58, 0x20, 0x2E, 0x15, 0x22, 0x34, 0xA9, 0xD7,
-    0x71, 0x07, 0x0C, 0x73, 0x56, 0xB3, 0xC8, 0xDD, 0xFB, 0x44, 0x91, 0x00, 0x0E, 0x08, 0xBC, 0x1E,
-    0x78, 0x63, 0x35, 0xC4, 0x9A, 0x31, 0xAE, 0x1D, 0xC1, 0x4F, 0x10, 0x20, 0x9C, 0x85, 0xAF, 0xF4,
-    0x7F, 0xB3, 0xFF, 0xCF, 0xFF, 0xFF, 0x60, 0x68, 0x00, 0x00, 0x35, 0x8B, 0xB1, 0x0D, 0xC2, 0x50,
-    0x0C, 0x44, 0x4F, 0x08, 0xC9, 0x05, 0x85, 0x47, 0xC9, 0x08, 0x64, 0x23, 0x46, 0x20, 0x15, 0x8C,
-    0x45, 0x46, 0x70, 0x97, 0x96, 0x36, 0x1D, 0x45, 0x8A, 0xDF, 0xC0, 0x71, 0xFF, 0xA2, 0x58, 0xB2,
-    0x9F, 0x9F, 0x7C, 0x06, 0x8E, 0x2A, 0xCF, 0xDC, 0x41, 0x23, 0x77, 0xD0, 0xC8, 0xF5, 0xD6, 0xB1,
-    0x39, 0x92, 0xB3, 0xC1, 0xC7, 0x7B, 0x28, 0xC5, 0x38, 0xDF, 0x4B, 0x31, 0x9E, 0x58, 0x92, 0x4D,
-    0x7F, 0x92, 0xF1, 0xC5, 0x45, 0x72, 0x21, 0x9F, 0xE4, 0x44, 0xB6, 0xE0, 0x2F, 0xB4, 0x05, 0xDB,
-    0xC0, 0x06, 0xAD, 0x12, 0xA3, 0x01, 0xF1, 0x0D, 0x09, 0xE2, 0x93, 0x12, 0x44, 0x5D, 0xA7, 0x8E,
-    0xA5, 0x0B, 0x7C, 0x11, 0x2C, 0x08, 0x0B, 0xCE, 0xEA, 0x3F,
+static const uint8_t notosans_14_italicBitmaps[31360] = {
+    0xBD, 0x9A, 0x31, 0x8C, 0x25, 0xC7, 0x99, 0xDF, 0x7F, 0x55, 0xC5, 0x61, 0x09, 0x6C, 0x98, 0xB5,
+    0xC1, 0xD2, 0xA7, 0xF3, 0xC2, 0xEC, 0x0B, 0x14, 0xE8, 0x0E, 0x77, 0xD3, 0xA9, 0x82, 0x79, 0xDD,
+    0x45, 0x2E, 0x6C, 0x05, 0x17, 0x70, 0x82, 0x1D, 0x2B, 0x60, 0x40, 0x05, 0x0E, 0xE4, 0x03, 0x8C,
+    0x4D, 0x14, 0x50, 0xF0, 0x7B, 0xFB, 0x8A, 0x64, 0xA0, 0x40, 0x01, 0x17, 0x07, 0xCB, 0x89, 0x01,
+    0x9B, 0x06, 0x14, 0x1C, 0xF6, 0x00, 0x4B, 0xC1, 0x1A, 0xD8, 0x03, 0x7A, 0xE6, 0x15, 0xB9, 0x80,
+    0x37, 0x60, 0xC0, 0xA2, 0x08, 0xDE, 0x05, 0x0A, 0x58, 0x32, 0x29, 0x1B, 0xA0, 0x02, 0x15, 0xA5,
+    0x26, 0xB6, 0x28, 0xF6, 0x7B, 0xE5, 0xA0, 0xFB, 0xCD, 0xCE, 0x8A, 0x22, 0x4E, 0xBA, 0x5B, 0xB1,
+    0x31, 0x3D, 0x33, 0xAF, 0x5E, 0xF5, 0x57, 0xF5, 0xD5, 0xF7, 0xD5, 0xFF, 0xFB, 0xBE, 0x7F, 0x35,
+    0x1D, 0xB5, 0xAB, 0x82, 0x4C, 0x8C, 0xB4, 0x18, 0xAB, 0xBD, 0x4C, 0x64, 0x16, 0x18, 0xB4, 0x17,
+    0x91, 0xDB, 0x00, 0x08, 0xAB, 0x92, 0x18, 0x59, 0x73, 0x00, 0x87, 0xD5, 0x2B, 0x31, 0x2F, 0xCC,
+    0xD7, 0x7D, 0x7A, 0xB1, 0xAE, 0x9E, 0x0D, 0x3F, 0xFA, 0xF3, 0x27, 0xA4, 0x83, 0x17, 0x95, 0x87,
+    0xDB, 0xDA, 0x41, 0xAA, 0x2C, 0x24, 0x03, 0x22, 0x1A, 0x90, 0xE1, 0x69, 0xE4, 0xDF, 0x7E, 0xB8,
+    0xF9, 0x1B, 0x5D, 0x4A, 0x19, 0xC5, 0xF3, 0xDF, 0xFF, 0xBB, 0x63, 0x0C, 0xB7, 0xC1, 0x90, 0xE0,
+    0x69, 0x12, 0x2C, 0x64, 0xA4, 0x2B, 0xA5, 0x84, 0xAE, 0x94, 0x12, 0x3E, 0x23, 0xA4, 0x06, 0x15,
+    0x0E, 0x41, 0xF9, 0x23, 0xE6, 0xEB, 0x49, 0xE0, 0x5F, 0x83, 0x38, 0xB3, 0xD4, 0x65, 0x64, 0x7D,
+    0x36, 0x92, 0x5F, 0x44, 0xA4, 0xDB, 0xC8, 0xF4, 0x23, 0x44, 0x4A, 0xB0, 0x4D, 0xB0, 0x8E, 0x50,
+    0x6F, 0x41, 0x15, 0x87, 0x7A, 0x33, 0xA0, 0x5E, 0x09, 0xE8, 0x57, 0x02, 0xD5, 0xD5, 0xF0, 0x27,
+    0xC6, 0xF8, 0xEE, 0x87, 0x85, 0xA6, 0x64, 0xC4, 0x0D, 0x0B, 0x7F, 0x0E, 0x1C, 0x01, 0x5F, 0xDD,
+    0x8F, 0xB1, 0xF6, 0x3C, 0xCD, 0x66, 0xC4, 0xB0, 0x30, 0x18, 0x7B, 0xA8, 0x42, 0xE5, 0x0C, 0x83,
+    0xF6, 0xDA, 0x1F, 0x29, 0x2F, 0xA2, 0x51, 0x81, 0x3B, 0xFA, 0x8D, 0xC8, 0x5F, 0xC8, 0xB7, 0x3F,
+    0xFA, 0xBB, 0xCA, 0xA5, 0x8F, 0xCA, 0xDB, 0x29, 0x7F, 0x3C, 0xF4, 0xDD, 0x78, 0x67, 0x30, 0x2A,
+    0x2F, 0x8F, 0x94, 0xE7, 0xE8, 0x90, 0xC4, 0xA2, 0xB2, 0x4B, 0x0E, 0x55, 0x38, 0xA4, 0x26, 0x19,
+    0x6B, 0x38, 0x52, 0xDE, 0x58, 0x73, 0x35, 0x54, 0x4E, 0x7C, 0x9A, 0xB4, 0xA7, 0x89, 0x00, 0x76,
+    0x1E, 0x58, 0x17, 0x0B, 0x9B, 0x62, 0xD1, 0xB1, 0x83, 0x86, 0x25, 0x64, 0x12, 0x2A, 0x56, 0x1E,
+    0xE3, 0x6E, 0x40, 0x5D, 0x45, 0xE8, 0xB6, 0x40, 0x71, 0x50, 0x8F, 0xA0, 0x72, 0x26, 0x77, 0xCF,
+    0x0C, 0xFA, 0xF5, 0x41, 0xA6, 0xD6, 0x38, 0xF5, 0xCB, 0xD4, 0xA2, 0x8B, 0xCD, 0x54, 0x83, 0x4A,
+    0x34, 0xBE, 0x8A, 0xBA, 0x78, 0x53, 0x4A, 0xED, 0xAA, 0x12, 0x1A, 0x8B, 0x05, 0x0E, 0xDB, 0xC5,
+    0xF2, 0xC5, 0xDB, 0x3F, 0x7A, 0x0D, 0x15, 0xC8, 0x34, 0x68, 0xCF, 0x40, 0x87, 0x0E, 0x8C, 0x18,
+    0x2B, 0x13, 0x2D, 0x2A, 0xB0, 0xA4, 0xF2, 0xF4, 0x18, 0x47, 0x9E, 0x7E, 0x55, 0x8E, 0x1E, 0xED,
+    0x39, 0x42, 0x06, 0x6A, 0x78, 0x0D, 0x2A, 0x4B, 0x0D, 0x47, 0x70, 0x07, 0x99, 0xD0, 0x7E, 0xFE,
+    0x34, 0xA0, 0x3C, 0x35, 0x2C, 0x11, 0x89, 0xCA, 0xD3, 0xC2, 0x30, 0xFD, 0x15, 0x09, 0xE3, 0x58,
+    0xA2, 0x02, 0x2D, 0x32, 0xCD, 0x62, 0x00, 0x58, 0x42, 0xE5, 0xE1, 0x36, 0xDF, 0xAE, 0x30, 0x43,
+    0xA2, 0xDE, 0xFD, 0xBB, 0x9B, 0xBA, 0x6C, 0xD9, 0xFC, 0x4B, 0xD7, 0x7E, 0x1B, 0x73, 0xD7, 0xAB,
+    0xB4, 0xE0, 0x5F, 0xC8, 0x04, 0x4F, 0x4F, 0x0F, 0x1C, 0x00, 0x09, 0xCC, 0xC5, 0x3F, 0x27, 0x2F,
+    0x9C, 0x3C, 0x57, 0x4A, 0xD9, 0x94, 0x12, 0x3F, 0xF3, 0x1D, 0x4F, 0x02, 0xC7, 0x55, 0xE8, 0x44,
+    0x32, 0x6E, 0x29, 0xE3, 0x93, 0x74, 0xC5, 0x94, 0xD7, 0x4F, 0x8E, 0x0F, 0xCC, 0xBD, 0x8F, 0xC6,
+    0xCB, 0x00, 0x79, 0x9A, 0x43, 0x0B, 0x32, 0x81, 0xB1, 0xD0, 0x83, 0x0E, 0xD0, 0x81, 0x48, 0x60,
+    0x1C, 0xF4, 0xA0, 0x22, 0x34, 0xC0, 0x30, 0x75, 0x5F, 0x81, 0x4A, 0x50, 0xDB, 0x8B, 0x02, 0xA6,
+    0xAB, 0x1E, 0x51, 0x65, 0xA4, 0x7B, 0x69, 0x94, 0x83, 0x4C, 0xC6, 0xE9, 0xD0, 0x63, 0x5E, 0x89,
+    0xB4, 0xB5, 0x25, 0xF7, 0xA8, 0xF7, 0x13, 0xE6, 0x39, 0xC7, 0x6A, 0x81, 0xFC, 0x68, 0xC0, 0xDC,
+    0x0B, 0xB4, 0xB5, 0x15, 0xC3, 0x0A, 0xE3, 0x07, 0x6E, 0xA8, 0xA4, 0x52, 0x15, 0x3B, 0x6B, 0xCA,
+    0x80, 0x29, 0x20, 0x2C, 0x50, 0xB9, 0x3A, 0x76, 0xC3, 0xA6, 0xDF, 0x5C, 0x7F, 0xD2, 0x78, 0x15,
+    0x19, 0x58, 0xD2, 0x60, 0x9C, 0x8A, 0xE2, 0xFC, 0xDF, 0x20, 0x12, 0x3D, 0x1D, 0xC6, 0xED, 0x3D,
+    0xCB, 0xB1, 0x2E, 0x03, 0x5B, 0x39, 0xF2, 0x27, 0x9C, 0x02, 0xAB, 0xF9, 0x5E, 0x02, 0x23, 0x88,
+    0x01, 0x74, 0x84, 0xDA, 0xC3, 0x1A, 0x44, 0x86, 0x2A, 0x42, 0xE3, 0xE0, 0x14, 0xD4, 0x00, 0xC6,
+    0x43, 0x77, 0x72, 0x62, 0x37, 0xA5, 0x84, 0x52, 0x8A, 0x07, 0xA0, 0x2A, 0x8E, 0xCD, 0x2C, 0xF7,
+    0x12, 0xFD, 0x05, 0x99, 0xFD, 0x24, 0xB3, 0x8A, 0x34, 0xC5, 0xD2, 0x65, 0x78, 0x6A, 0x63, 0x27,
+    0x29, 0x3A, 0x4E, 0x2B, 0xA8, 0xE2, 0xB4, 0xB6, 0xC6, 0xBF, 0xC8, 0xDA, 0xAD, 0xCB, 0x8E, 0xBA,
+    0x0C, 0x70, 0x19, 0xA6, 0xE7, 0xE5, 0x08, 0xD5, 0x08, 0xF5, 0x1D, 0x58, 0x0D, 0x90, 0x13, 0xEA,
+    0xA7, 0x09, 0xF3, 0x46, 0xA2, 0x51, 0x91, 0x5E, 0x05, 0x31, 0x68, 0xAF, 0x43, 0xE5, 0x8D, 0x33,
+    0xAE, 0xC5, 0xB8, 0x75, 0x29, 0xBB, 0x4D, 0x29, 0xDB, 0xA7, 0x4E, 0xD6, 0xD7, 0x26, 0x23, 0x2C,
+    0xE6, 0xE9, 0x2C, 0xA1, 0x2B, 0x83, 0x28, 0x25, 0x54, 0x1F, 0xDE, 0x62, 0x31, 0xF9, 0xC3, 0xDE,
+    0x52, 0x03, 0xE8, 0x0F, 0x6F, 0xD2, 0x94, 0x81, 0x3F, 0x7D, 0x7E, 0x00, 0x9D, 0xA6, 0x89, 0x36,
+    0xF3, 0x3C, 0x66, 0xC3, 0x9F, 0x3E, 0x49, 0x1D, 0xBB, 0xB2, 0x63, 0x5D, 0x6E, 0x4E, 0xA6, 0x00,
+    0x10, 0x25, 0xB1, 0x2E, 0xAE, 0xCA, 0x70, 0x36, 0xE9, 0xD6, 0x4D, 0xAA, 0x1B, 0x0F, 0x8B, 0x66,
+    0x10, 0xF7, 0xCB, 0x50, 0x6D, 0x75, 0xEA, 0x9C, 0x0E, 0xE3, 0x64, 0x7B, 0x63, 0x19, 0x16, 0xA8,
+    0x90, 0x69, 0x54, 0x22, 0xEB, 0x58, 0x7B, 0x53, 0x46, 0xAA, 0xE2, 0xC0, 0x42, 0x5D, 0xCA, 0xB0,
+    0x29, 0xE5, 0xF5, 0x93, 0x93, 0xF5, 0x2C, 0xE9, 0x21, 0xAF, 0xDB, 0xCB, 0x5E, 0x3E, 0xE4, 0x87,
+    0x66, 0xF6, 0xC3, 0xB9, 0x25, 0x9F, 0xB7, 0x4C, 0x57, 0xB3, 0x43, 0x95, 0x42, 0x67, 0xB7, 0x62,
+    0x20, 0x57, 0x5E, 0xA5, 0x06, 0xE3, 0x7A, 0x16, 0x64, 0x95, 0x64, 0xDE, 0x20, 0x4B, 0xA0, 0xD9,
+    0xA1, 0xF3, 0x19, 0x37, 0x38, 0x53, 0x91, 0xB1, 0x46, 0xA4, 0x1E, 0xFD, 0xE3, 0x44, 0x53, 0x05,
+    0x46, 0x13, 0x4C, 0xA8, 0xCB, 0x8E, 0xBA, 0x84, 0x07, 0xCA, 0xAF, 0x07, 0xAA, 0x92, 0x39, 0x93,
+    0x83, 0x0E, 0x2A, 0x75, 0x68, 0x3F, 0x50, 0x6B, 0xCF, 0xB2, 0x46, 0xA4, 0x25, 0xE6, 0xF5, 0x81,
+    0xB5, 0x4A, 0x7A, 0xD4, 0xE5, 0xD3, 0xA8, 0xCB, 0x73, 0x16, 0x3B, 0xEB, 0x51, 0x4F, 0x6E, 0x67,
+    0xFC, 0x25, 0xB1, 0x65, 0x53, 0x82, 0x2C, 0x79, 0x6F, 0x79, 0x1D, 0x3A, 0xB7, 0x95, 0x91, 0x87,
+    0xAE, 0xCB, 0x2A, 0xD5, 0x7E, 0xCD, 0xF1, 0xD4, 0x41, 0x65, 0xB6, 0x1C, 0xF2, 0xD9, 0xEB, 0x32,
+    0x1D, 0xB5, 0xAB, 0xBC, 0x0A, 0x22, 0x31, 0xF0, 0x35, 0x00, 0x2E, 0x41, 0x03, 0x4D, 0xBC, 0xF0,
+    0x13, 0x30, 0x01, 0x36, 0x0E, 0x36, 0x37, 0x61, 0x13, 0xA6, 0x88, 0x71, 0x7D, 0x5E, 0xBC, 0x4B,
+    0x80, 0x99, 0x5C, 0x29, 0x3C, 0x90, 0x7D, 0x72, 0x72, 0xF2, 0x5C, 0x29, 0xBB, 0x5B, 0xB7, 0x6E,
+    0xDD, 0xB4, 0x93, 0x4D, 0x36, 0xBF, 0xED, 0x86, 0x26, 0xB2, 0x8E, 0x6C, 0x82, 0xD8, 0x04, 0x8A,
+    0xC3, 0xB8, 0x73, 0x84, 0x7F, 0xBC, 0xDC, 0xEC, 0xCA, 0x70, 0xF8, 0xEC, 0x08, 0x3D, 0x2C, 0x61,
+    0x09, 0x23, 0x62, 0xA0, 0x8A, 0x34, 0x8E, 0x1D, 0x6A, 0x40, 0x7B, 0x8C, 0xC5, 0xEC, 0x47, 0xFD,
+    0x32, 0xAC, 0x61, 0x03, 0xA7, 0xF3, 0xFA, 0x3C, 0x7E, 0x76, 0x13, 0x64, 0x29, 0x03, 0x6C, 0x6E,
+    0xFE, 0x51, 0xC6, 0x04, 0xC4, 0xC0, 0x08, 0x22, 0x55, 0x0E, 0x54, 0x58, 0xB2, 0xC9, 0xD5, 0x2B,
+    0xA1, 0xFE, 0x34, 0xD5, 0x35, 0x59, 0xFB, 0xA3, 0xC1, 0xB8, 0x43, 0x7E, 0xE5, 0x97, 0x0C, 0xFA,
+    0x3D, 0x19, 0x94, 0x7F, 0x7A, 0x69, 0x6C, 0xCD, 0xFF, 0x8A, 0x47, 0x64, 0x75, 0xCF, 0x0F, 0x3A,
+    0x1E, 0xD6, 0x2A, 0xFE, 0xA7, 0x37, 0xD2, 0x91, 0x2E, 0xAF, 0x16, 0x3B, 0xE8, 0xA1, 0x8A, 0x32,
+    0xC1, 0x64, 0xA8, 0x69, 0x37, 0x80, 0xDE, 0x9E, 0x9C, 0xED, 0xC7, 0xE5, 0xAF, 0xFE, 0x33, 0x4C,
+    0x8E, 0xC8, 0x8E, 0x49, 0xEF, 0x36, 0x41, 0xB3, 0x04, 0xF3, 0x02, 0x98, 0xBB, 0x1E, 0x1D, 0x06,
+    0x54, 0x5A, 0x20, 0x06, 0xE3, 0xC8, 0x2A, 0xB2, 0xA4, 0xA7, 0x2B, 0x85, 0xA6, 0x14, 0x6F, 0x3E,
+    0xBC, 0x95, 0x2A, 0xCF, 0x4A, 0x45, 0xCC, 0xD5, 0x84, 0xFA, 0x69, 0x86, 0x3C, 0x42, 0xB7, 0x82,
+    0xCA, 0xB3, 0xDE, 0x39, 0x9A, 0xB2, 0xC3, 0xBC, 0x7B, 0x3D, 0xAA, 0xC8, 0x28, 0x06, 0x1A, 0x7A,
+    0x2A, 0xDF, 0x20, 0x93, 0x71, 0x22, 0xAB, 0x20, 0x47, 0x51, 0xCA, 0xC0, 0xA6, 0x0C, 0x74, 0x5C,
+    0x77, 0xC6, 0xC9, 0x41, 0x05, 0x5A, 0x91, 0x30, 0xBE, 0x47, 0xA5, 0x16, 0x91, 0x8D, 0x63, 0xD4,
+    0xE1, 0xF1, 0xAD, 0x28, 0x65, 0xCB, 0xA6, 0x7C, 0x70, 0x1E, 0xDF, 0x77, 0x56, 0x94, 0x92, 0xE4,
+    0xEE, 0x99, 0x17, 0xE5, 0x08, 0x62, 0x9C, 0x7C, 0x91, 0x1B, 0x40, 0xC7, 0x64, 0x5A, 0x1D, 0xA6,
+    0x7D, 0xCF, 0xB8, 0x6F, 0xF4, 0x13, 0xC8, 0xD3, 0x03, 0xB5, 0x9B, 0x30, 0x91, 0xB5, 0xFB, 0x63,
+    0xAA, 0x52, 0x1C, 0xEB, 0x12, 0x26, 0xFB, 0xAC, 0x77, 0x76, 0x6A, 0xD9, 0x3E, 0xBF, 0xC3, 0x38,
+    0x3D, 0x88, 0x01, 0xE3, 0x1B, 0xE8, 0x65, 0x42, 0x87, 0x16, 0x5A, 0x15, 0x50, 0x71, 0x09, 0x6D,
+    0xE5, 0xD1, 0x61, 0x84, 0x53, 0xE3, 0x30, 0x7E, 0x80, 0x5C, 0x43, 0xF3, 0x6C, 0x42, 0xA7, 0x16,
+    0x31, 0xAA, 0xC8, 0xC6, 0xDE, 0x38, 0xD9, 0x04, 0x5D, 0x4A, 0x64, 0x53, 0x6E, 0x02, 0xEB, 0x32,
+    0xB2, 0x29, 0x23, 0xDB, 0x93, 0x6B, 0x0C, 0x93, 0x09, 0x64, 0x9A, 0x6E, 0x15, 0x41, 0x05, 0xD0,
+    0xA5, 0xB8, 0xAA, 0x14, 0x6B, 0xDE, 0x3D, 0xC1, 0xB8, 0x29, 0x8A, 0xD5, 0x4C, 0x9E, 0xDD, 0xCE,
+    0xF7, 0x8D, 0x93, 0x6B, 0xE7, 0xA2, 0x7E, 0x27, 0x99, 0x01, 0xAA, 0x52, 0xAC, 0x29, 0xC5, 0x7E,
+    0x9E, 0xCC, 0x0B, 0xC8, 0x3F, 0x5F, 0x57, 0xCA, 0x07, 0xD4, 0xA5, 0xF8, 0x6A, 0xFB, 0x6F, 0x7A,
+    0xB9, 0x05, 0xD6, 0xF3, 0x42, 0x8A, 0x3C, 0xAF, 0xAA, 0x8A, 0xF3, 0x83, 0x95, 0x17, 0x25, 0x8D,
+    0x34, 0xC5, 0x78, 0xF1, 0x8D, 0x34, 0x42, 0x6B, 0x3C, 0x3A, 0xF4, 0xB0, 0xD4, 0x91, 0xCA, 0x77,
+    0x96, 0x2C, 0x76, 0xD4, 0x56, 0x97, 0x92, 0xA8, 0xCA, 0x27, 0x73, 0x30, 0x5C, 0xC2, 0x1D, 0x99,
+    0x50, 0xD1, 0x38, 0x8C, 0x6D, 0x61, 0x25, 0x06, 0x64, 0xAA, 0x3C, 0x95, 0x6F, 0xA0, 0x25, 0xC3,
+    0xA0, 0x02, 0xDA, 0xD7, 0xA5, 0x14, 0x36, 0xA5, 0x8C, 0xEA, 0xE3, 0x93, 0x6F, 0x4C, 0xDD, 0x17,
+    0xB0, 0x14, 0x69, 0xEA, 0x6E, 0x5C, 0x37, 0x75, 0x17, 0x83, 0x0E, 0x68, 0x5F, 0x43, 0x43, 0x0F,
+    0x19, 0xBA, 0x42, 0x5D, 0x1C, 0x2B, 0x68, 0xA0, 0xF2, 0xA8, 0x08, 0x03, 0x2C, 0xA1, 0x01, 0xF3,
+    0x9B, 0x9F, 0x1D, 0x2A, 0x20, 0x06, 0xE8, 0xA1, 0x81, 0x4D, 0x66, 0x5D, 0x00, 0xB4, 0x87, 0x7E,
+    0x72, 0xAE, 0x0C, 0xB5, 0x45, 0x26, 0x68, 0xA6, 0x25, 0x58, 0x4C, 0x2B, 0xDC, 0x4F, 0xAB, 0x93,
+    0xC1, 0x58, 0xC4, 0xFC, 0x75, 0x82, 0x76, 0xFA, 0x7A, 0x4E, 0x90, 0xA6, 0xA7, 0x75, 0x62, 0xBD,
+    0xA5, 0x2A, 0x96, 0x3F, 0x9E, 0xD6, 0x41, 0x87, 0xCA, 0x8B, 0x4C, 0xE6, 0x06, 0xC6, 0xD6, 0x4E,
+    0x0C, 0x3A, 0xD2, 0x88, 0x8C, 0x4C, 0x37, 0xA0, 0xAD, 0x1D, 0xEA, 0x1F, 0x22, 0xAC, 0x46, 0xA8,
+    0x4A, 0x80, 0xB2, 0x06, 0xF3, 0xFA, 0x00, 0x83, 0x71, 0xD4, 0xF4, 0xC8, 0xA4, 0x22, 0x2D, 0x1D,
+    0x2A, 0x8A, 0x81, 0x15, 0xC6, 0x6B, 0x4F, 0x4F, 0x8F, 0x8A, 0xB0, 0x64, 0x5E, 0x8B, 0x01, 0x31,
+    0x20, 0x13, 0x32, 0xA1, 0x22, 0x2A, 0xA0, 0x3D, 0x95, 0xC7, 0x78, 0x8C, 0xC3, 0x58, 0x6A, 0x68,
+    0xA0, 0x85, 0x16, 0x6E, 0x9C, 0x5C, 0x5B, 0x97, 0x71, 0x53, 0x46, 0xD6, 0x20, 0xB6, 0x6C, 0x2C,
+    0x6A, 0x4B, 0x71, 0x54, 0x23, 0x9F, 0x3A, 0x4C, 0x2F, 0xEE, 0x7B, 0x0E, 0xB3, 0xBC, 0xEF, 0x59,
+    0x66, 0xF5, 0xBE, 0x27, 0x0F, 0xEA, 0x1D, 0x2F, 0x3E, 0x4A, 0xEA, 0x1D, 0xAF, 0x7E, 0x9C, 0xF4,
+    0xDD, 0xA0, 0xEF, 0xC6, 0xEA, 0x8D, 0x60, 0xAE, 0x06, 0xF3, 0x72, 0x6C, 0x74, 0x30, 0xCF, 0xC4,
+    0x45, 0xE5, 0x8D, 0x48, 0x77, 0x2A, 0x5F, 0x93, 0x92, 0x71, 0x0D, 0xBF, 0x8C, 0xC6, 0xB6, 0xDC,
+    0xF7, 0x35, 0x0B, 0x8A, 0x6B, 0x58, 0x52, 0xE8, 0xE8, 0x39, 0xA5, 0xE5, 0x0E, 0x3D, 0x0B, 0x58,
+    0xC1, 0x21, 0x1B, 0x58, 0x50, 0x60, 0x41, 0x71, 0x2C, 0xC5, 0xA7, 0x9E, 0x5E, 0xFE, 0x2A, 0x90,
+    0xD5, 0xFB, 0x91, 0x41, 0xBD, 0x9D, 0x44, 0x52, 0x61, 0x10, 0x49, 0xFB, 0x5E, 0xA6, 0xCA, 0x2F,
+    0x55, 0x34, 0xAE, 0x55, 0xC1, 0xD8, 0x46, 0x7B, 0x83, 0xF9, 0x4B, 0x5F, 0x63, 0xBE, 0xE7, 0x1A,
+    0xF4, 0x5B, 0xAE, 0x45, 0xBD, 0x67, 0x17, 0xC8, 0xC2, 0x12, 0x51, 0xE8, 0x61, 0xC7, 0x1D, 0x38,
+    0x9D, 0x9D, 0xBE, 0x2A, 0x37, 0x91, 0xA5, 0x44, 0xBA, 0x70, 0x3D, 0xAA, 0x8C, 0xF1, 0x8D, 0xA3,
+    0x76, 0x23, 0x74, 0x55, 0x80, 0xB1, 0x03, 0xF9, 0x51, 0x86, 0xEA, 0xCD, 0x00, 0x4D, 0x03, 0x8C,
+    0x23, 0xA8, 0x5F, 0x25, 0xA8, 0x5F, 0xF5, 0x70, 0xDA, 0x81, 0x4A, 0x3D, 0x34, 0x2F, 0x65, 0x18,
+    0xD5, 0x40, 0x1D, 0x74, 0x96, 0x3B, 0xAA, 0x52, 0x02, 0xB2, 0x64, 0xE6, 0x40, 0xB0, 0xDE, 0x59,
+    0x36, 0x25, 0xB1, 0x7D, 0x3E, 0x93, 0x19, 0xC5, 0xC0, 0x4A, 0x26, 0x5A, 0x99, 0x58, 0xA8, 0xC8,
+    0x4A, 0x05, 0x46, 0xED, 0x65, 0xAE, 0xDE, 0xBD, 0x1E, 0x4D, 0x29, 0xD6, 0x94, 0x1F, 0xFC, 0x8E,
+    0xDB, 0xF6, 0x9F, 0xA1, 0x81, 0x79, 0x48, 0x83, 0x7A, 0xAF, 0x81, 0x09, 0x3A, 0xCB, 0xED, 0x45,
+    0x0D, 0xAE, 0x84, 0x19, 0x0A, 0xA6, 0x5F, 0x8D, 0x03, 0x3A, 0x7B, 0x51, 0xA9, 0x91, 0xCC, 0xA9,
+    0x18, 0x68, 0x67, 0xA5, 0xDA, 0x07, 0x4A, 0xE9, 0xA1, 0x2A, 0x25, 0x98, 0xB2, 0xC5, 0x7C, 0x3F,
+    0x63, 0x6C, 0x4F, 0xCD, 0x8A, 0x86, 0x8E, 0x96, 0x86, 0x16, 0xE3, 0x56, 0x18, 0xBF, 0xA4, 0x0A,
+    0xFD, 0x1C, 0xC3, 0xD0, 0x25, 0xD2, 0x95, 0x91, 0xF2, 0xCC, 0x1D, 0x91, 0xA7, 0x5D, 0xB5, 0xBF,
+    0xE5, 0x00, 0x62, 0x3B, 0xD5, 0x7D, 0xD4, 0x19, 0xE4, 0x0E, 0x58, 0xCF, 0xC9, 0xAA, 0xF1, 0xD3,
+    0xAE, 0x33, 0x1E, 0x1A, 0xF7, 0x6D, 0xB1, 0x61, 0x5D, 0x46, 0x9A, 0x12, 0xE1, 0x18, 0xBA, 0x52,
+    0xC6, 0xAE, 0x94, 0xF1, 0xA9, 0x17, 0xDE, 0xBD, 0x36, 0x75, 0x77, 0x53, 0x1D, 0xD0, 0xFC, 0x96,
+    0x55, 0xEE, 0xE7, 0x70, 0x92, 0xA7, 0x8C, 0x4D, 0xEC, 0x31, 0xF6, 0x22, 0xCE, 0x7A, 0x90, 0x11,
+    0x99, 0x8C, 0xC3, 0xF8, 0x05, 0xB4, 0x22, 0xC1, 0x50, 0x79, 0xB4, 0xEF, 0xA0, 0x21, 0x43, 0x56,
+    0x01, 0x15, 0x6B, 0xA8, 0x6D, 0x0F, 0xBD, 0xDA, 0x77, 0x77, 0x2B, 0x58, 0x88, 0x84, 0xB8, 0x80,
+    0x7E, 0x3D, 0x62, 0x0A, 0x40, 0x2A, 0xCB, 0x11, 0x5D, 0x4A, 0x40, 0x9F, 0x7B, 0xD0, 0x11, 0xD4,
+    0xCF, 0x59, 0xCC, 0xDD, 0x80, 0x8E, 0x79, 0x0A, 0x9A, 0x43, 0xE5, 0x19, 0x65, 0x62, 0x45, 0x4F,
+    0x47, 0x4D, 0x6D, 0xB5, 0x37, 0x9E, 0x41, 0x07, 0x16, 0x2A, 0x61, 0x9E, 0x49, 0xA8, 0x98, 0x21,
+    0x2F, 0xE1, 0xB0, 0x85, 0xEA, 0x3D, 0x10, 0xC5, 0x4D, 0x8B, 0x67, 0xE2, 0x1C, 0x23, 0xEF, 0xA0,
+    0x22, 0xF5, 0x0D, 0x64, 0xC6, 0xBC, 0xE5, 0xD9, 0xA1, 0x7F, 0x9C, 0xD8, 0x78, 0x99, 0x7A, 0xDA,
+    0x44, 0x6E, 0x68, 0x96, 0xF4, 0x95, 0x37, 0x2F, 0xD0, 0xCA, 0xA4, 0xEF, 0xFA, 0x9A, 0x5E, 0x85,
+    0x64, 0x5C, 0x2D, 0xD2, 0x91, 0x0E, 0xDA, 0x67, 0x23, 0x93, 0x48, 0x4B, 0xE5, 0x07, 0x96, 0x2D,
+    0xA9, 0xA7, 0x36, 0x2C, 0x16, 0xE8, 0x37, 0x9D, 0x79, 0x01, 0x7E, 0xE5, 0xD5, 0x7B, 0x8E, 0x45,
+    0xE2, 0xBE, 0xC7, 0x0C, 0x74, 0x11, 0x35, 0x52, 0x25, 0xD8, 0x22, 0x33, 0x74, 0xF3, 0x5E, 0xAC,
+    0x61, 0x85, 0xB1, 0x64, 0x8C, 0x53, 0x09, 0xED, 0x2B, 0x8F, 0x0A, 0xB5, 0x45, 0xA6, 0x16, 0x44,
+    0xCA, 0xC0, 0xA7, 0x09, 0xD8, 0xF8, 0xD9, 0xF9, 0x58, 0x03, 0x14, 0x0B, 0xEA, 0xE7, 0x1E, 0xAA,
+    0x7B, 0x1E, 0x1A, 0x15, 0x60, 0x25, 0x13, 0x64, 0x91, 0x50, 0x89, 0x3C, 0x95, 0xC5, 0xB5, 0x65,
+    0x35, 0xE1, 0xDC, 0x02, 0xFA, 0x16, 0x91, 0x1B, 0x54, 0xAA, 0xA9, 0x82, 0xB1, 0xC6, 0x19, 0xD7,
+    0x51, 0xF9, 0x1E, 0xED, 0x33, 0xEA, 0x9D, 0x84, 0xFA, 0xB9, 0x47, 0x16, 0x8B, 0x28, 0x9F, 0xE3,
+    0x03, 0x17, 0xCA, 0xA1, 0xCA, 0x03, 0x4D, 0x29, 0x51, 0x95, 0xB2, 0xE5, 0xCF, 0x6E, 0xFD, 0xD0,
+    0x4F, 0x3E, 0xCA, 0x0D, 0xA6, 0xFA, 0x4C, 0xED, 0xF3, 0x92, 0xC6, 0x4E, 0x05, 0xC7, 0x83, 0x24,
+    0x25, 0x5C, 0xE8, 0x7A, 0x9E, 0xB1, 0x9C, 0x02, 0xCD, 0xF7, 0x4F, 0x8E, 0x55, 0x29, 0x85, 0xAE,
+    0x94, 0x04, 0x66, 0x87, 0xD9, 0x51, 0x5F, 0x9B, 0xC1, 0x7A, 0x01, 0x47, 0x0F, 0x83, 0x7C, 0x42,
+    0x24, 0x64, 0x7C, 0x18, 0xE4, 0x1D, 0xC6, 0x3E, 0x00, 0xF9, 0xEE, 0x1A, 0x5D, 0xE6, 0xCF, 0x7E,
+    0xC0, 0xED, 0xCA, 0x2D, 0xB5, 0x3F, 0x52, 0x61, 0xA1, 0xE2, 0xA1, 0x48, 0x35, 0xC9, 0xD8, 0xA1,
+    0x72, 0xBD, 0xF6, 0x4B, 0xE5, 0x17, 0x2A, 0x52, 0xED, 0x30, 0x3B, 0x0E, 0x56, 0xBF, 0xCF, 0x28,
+    0x3C, 0x08, 0x25, 0x0B, 0x38, 0xE2, 0xA9, 0x7E, 0x1E, 0x0D, 0x33, 0xE9, 0xA7, 0x46, 0x78, 0xFA,
+    0x0E, 0x0C, 0x09, 0xFD, 0x46, 0xE4, 0x2F, 0x94, 0x27, 0x55, 0xAE, 0xB2, 0x86, 0x23, 0x0E, 0x65,
+    0xE4, 0xC8, 0xC0, 0x9D, 0x3B, 0x90, 0x00, 0x9E, 0x3A, 0x39, 0xA9, 0x4B, 0xF9, 0xDF, 0xB7, 0x6E,
+    0xBD, 0x76, 0x4D, 0x87, 0x96, 0xA4, 0xFD, 0x63, 0x5C, 0x89, 0x5F, 0x65, 0x33, 0x2E, 0xD5, 0xF6,
+    0x85, 0x5C, 0x45, 0x3D, 0x18, 0xAF, 0x52, 0x83, 0x4A, 0x1D, 0x2A, 0xB6, 0xA8, 0xB8, 0x42, 0x87,
+    0x9E, 0xCA, 0xF7, 0x18, 0xDF, 0xD3, 0xB8, 0x25, 0x6B, 0xDB, 0xC9, 0x5F, 0xD8, 0xA6, 0xBC, 0x4A,
+    0xB5, 0xAD, 0x1F, 0xB0, 0x36, 0x9F, 0x07, 0xA6, 0xB9, 0x71, 0x7C, 0x5C, 0x06, 0x71, 0xFF, 0xEF,
+    0x47, 0xB9, 0xE3, 0x54, 0x8D, 0xAC, 0xD4, 0x84, 0xCD, 0x0B, 0x1D, 0x58, 0x55, 0x9E, 0xDE, 0x78,
+    0x46, 0xE3, 0xC8, 0xC6, 0xC9, 0x54, 0x7B, 0x1D, 0x9B, 0x58, 0xFB, 0xC5, 0xA6, 0x70, 0xD4, 0xE4,
+    0x29, 0xBF, 0xA9, 0x3E, 0xA1, 0x29, 0xBE, 0x7B, 0xF7, 0xB5, 0xC6, 0x61, 0xDC, 0x9C, 0x7C, 0x88,
+    0xF3, 0x64, 0xA3, 0xF2, 0xC8, 0x04, 0x2B, 0x30, 0xE1, 0x4B, 0xA2, 0x14, 0x4C, 0x71, 0x73, 0x15,
+    0x35, 0x15, 0x4A, 0x93, 0x87, 0xD1, 0xCF, 0xD3, 0x33, 0x16, 0xB4, 0xE7, 0xFA, 0xCB, 0x89, 0xCD,
+    0xD8, 0xB3, 0xFB, 0xC6, 0x8E, 0x33, 0xD6, 0xB6, 0xC3, 0xF8, 0x06, 0x95, 0x8C, 0x27, 0xAB, 0x48,
+    0x2B, 0x06, 0x6A, 0x3B, 0xE5, 0xDB, 0x2A, 0x55, 0x5E, 0x66, 0x91, 0xC4, 0x96, 0x4E, 0xFE, 0xC2,
+    0x56, 0xE5, 0x7D, 0xCF, 0xE6, 0xED, 0x84, 0x00, 0xB8, 0x92, 0x69, 0x8A, 0xEF, 0xFE, 0x3A, 0x37,
+    0xB6, 0x35, 0xCE, 0x7C, 0xCF, 0xEB, 0x77, 0xE2, 0x95, 0x9F, 0x96, 0x12, 0xD7, 0xC5, 0x35, 0xF6,
+    0xA1, 0xD9, 0x3D, 0x2E, 0x4A, 0xF1, 0xF5, 0xF9, 0xEC, 0x2E, 0x03, 0x9B, 0x04, 0x65, 0x98, 0xD6,
+    0xAC, 0xB9, 0x90, 0x76, 0xEB, 0x5F, 0x3B, 0xEA, 0x92, 0x10, 0x37, 0xAE, 0x9D, 0xCF, 0x78, 0xCA,
+    0xC5, 0x7F, 0x43, 0x8D, 0x07, 0x09, 0xFA, 0x67, 0x1A, 0xF3, 0xDC, 0x58, 0xDB, 0x69, 0x3F, 0x55,
+    0x11, 0xD6, 0x69, 0x42, 0x28, 0x78, 0x3C, 0x3F, 0x81, 0x29, 0xF7, 0xBC, 0xF9, 0x78, 0x1D, 0xAB,
+    0xA8, 0x07, 0x95, 0x18, 0x65, 0xA2, 0x63, 0xC4, 0xF8, 0x16, 0x15, 0x6B, 0x2B, 0x86, 0xCA, 0xD3,
+    0xCB, 0x44, 0x47, 0x4F, 0xE3, 0x6A, 0x9A, 0xA0, 0xD2, 0xE1, 0xC0, 0x66, 0xB7, 0xA4, 0xDA, 0x36,
+    0x70, 0xC9, 0xB8, 0x09, 0xB2, 0xE7, 0xF1, 0xBE, 0x23, 0x47, 0xEA, 0x32, 0x22, 0x36, 0xC3, 0x3F,
+    0xEA, 0x17, 0x81, 0x8F, 0x4B, 0x16, 0xF7, 0xDF, 0x1D, 0xE5, 0x8E, 0xA5, 0x1A, 0x59, 0xAA, 0xC4,
+    0x52, 0x45, 0x7A, 0x1D, 0xC8, 0x95, 0x27, 0x1B, 0x2F, 0x06, 0xE3, 0x64, 0x32, 0x56, 0xA6, 0x1A,
+    0x15, 0x1B, 0x54, 0x68, 0xD1, 0x7E, 0x41, 0xE5, 0x79, 0x8C, 0x8E, 0x6E, 0x66, 0x2B, 0x7F, 0xC0,
+    0x20, 0x06, 0x99, 0x64, 0x52, 0x51, 0x05, 0xED, 0x2B, 0x6F, 0xBC, 0x71, 0xC6, 0xD6, 0x34, 0x13,
+    0x30, 0xF1, 0x18, 0x74, 0xD0, 0x5E, 0x60, 0x37, 0x7F, 0x30, 0xEF, 0xBC, 0xDF, 0x25, 0x89, 0x9B,
+    0x92, 0xA7, 0xFD, 0x8E, 0x55, 0x89, 0x4D, 0x64, 0x63, 0x7F, 0xBB, 0x7A, 0xFD, 0x5E, 0x3D, 0xFE,
+    0x86, 0x41, 0x25, 0x91, 0x8C, 0x97, 0xA9, 0x43, 0xA5, 0x1E, 0xF5, 0x7F, 0x12, 0xEA, 0x27, 0x1E,
+    0xFD, 0x0B, 0x4F, 0x55, 0x02, 0xE6, 0xFD, 0x88, 0x79, 0x39, 0x51, 0xDB, 0x4C, 0x4D, 0x4F, 0x43,
+    0x4B, 0x4B, 0xC3, 0x82, 0xDA, 0x01, 0x95, 0x57, 0x91, 0xCC, 0x8A, 0x7A, 0xFA, 0x77, 0x66, 0xB5,
+    0x3E, 0x97, 0xEB, 0x82, 0xD7, 0x1A, 0x57, 0x45, 0x3E, 0x2A, 0x69, 0x3D, 0x8A, 0xFB, 0x7F, 0xFF,
+    0xF1, 0xC7, 0x67, 0x72, 0x47, 0x71, 0x9D, 0xCC, 0x14, 0x1A, 0x95, 0x18, 0xE9, 0x54, 0x24, 0xD3,
+    0xEA, 0x20, 0x06, 0x16, 0x95, 0x97, 0x89, 0xA5, 0xF1, 0x32, 0xD1, 0x1B, 0xA7, 0x22, 0xD9, 0x58,
+    0x15, 0xC8, 0x35, 0xDA, 0x8B, 0xA1, 0xA1, 0xF2, 0x32, 0xB5, 0x18, 0x2F, 0xD3, 0x02, 0xE3, 0xE6,
+    0x0C, 0xE2, 0xB5, 0x26, 0xF2, 0x51, 0xC9, 0xE2, 0xFE, 0xCF, 0x46, 0x59, 0xCE, 0xB7, 0x73, 0xAF,
+    0x23, 0xA3, 0x0E, 0x8C, 0x17, 0xCD, 0x56, 0x5B, 0x95, 0x1A, 0x54, 0xEC, 0xD0, 0xB1, 0x43, 0x87,
+    0x96, 0xCA, 0x73, 0xE5, 0x03, 0x64, 0x19, 0xE9, 0xFE, 0xCB, 0x28, 0x07, 0x91, 0x6B, 0xA7, 0x52,
+    0x4F, 0x75, 0x37, 0xD2, 0xD4, 0x96, 0x7E, 0x89, 0xFA, 0x65, 0xC2, 0x7C, 0xCF, 0xB3, 0xAA, 0x51,
+    0xE9, 0x06, 0xB5, 0xDD, 0xCA, 0x4C, 0x29, 0x8E, 0xBD, 0x3F, 0x7D, 0xB5, 0x8A, 0x98, 0xBA, 0x58,
+    0xFD, 0xDE, 0xF3, 0x49, 0xEE, 0x38, 0x65, 0x43, 0x6D, 0x3B, 0x54, 0x30, 0x8E, 0x41, 0x07, 0x56,
+    0x32, 0xD1, 0x9C, 0x7B, 0xB0, 0x71, 0x32, 0xE9, 0x24, 0xB2, 0xDC, 0x89, 0x91, 0x5F, 0x97, 0x91,
+    0x45, 0x93, 0xA9, 0xED, 0xF1, 0xC3, 0x5B, 0x64, 0x31, 0x85, 0xC9, 0x29, 0xE4, 0xFC, 0xFE, 0x80,
+    0xB8, 0x99, 0x01, 0xF1, 0xBF, 0x4F, 0x5B, 0xC2, 0x5E, 0x24, 0xDC, 0x7E, 0x23, 0xD9, 0x79, 0xAD,
+    0xB1, 0x47, 0x6B, 0x5F, 0xDF, 0xF8, 0x66, 0x95, 0x91, 0x23, 0x8C, 0xD0, 0x42, 0x6D, 0xA9, 0x3C,
+    0x2A, 0x41, 0x86, 0x05, 0xD4, 0xE7, 0xF5, 0x55, 0x06, 0xAE, 0x7F, 0xC0, 0xA6, 0xF8, 0xB3, 0x7F,
+    0x1B, 0xBA, 0xA9, 0xAC, 0x4A, 0xB0, 0xB6, 0x54, 0x19, 0xD6, 0x1E, 0x39, 0x42, 0x6D, 0xA7, 0xDA,
+    0xEB, 0x2B, 0x8C, 0xA6, 0xEC, 0x44, 0xD9, 0xEE, 0x89, 0x29, 0x6D, 0x49, 0x34, 0x5C, 0xF9, 0xF5,
+    0x7F, 0x2D, 0xDB, 0x2B, 0xEF, 0xDA, 0x1E, 0xE3, 0xC9, 0x18, 0x2B, 0x12, 0x0D, 0x6A, 0xE6, 0xB7,
+    0x57, 0xE8, 0x40, 0x37, 0x8A, 0xE2, 0xB1, 0xC8, 0x9B, 0x7C, 0x4B, 0x07, 0x7A, 0xED, 0xC9, 0x95,
+    0x67, 0x30, 0x4E, 0x4C, 0xBB, 0xCF, 0xAA, 0x38, 0x9B, 0x32, 0xB4, 0x54, 0x7E, 0x81, 0xF1, 0xAB,
+    0x39, 0x1A, 0xDC, 0x90, 0xBF, 0xB0, 0x5D, 0x79, 0x15, 0x33, 0x47, 0x83, 0x6F, 0x21, 0xFF, 0x47,
+    0xA2, 0xFE, 0xBA, 0x67, 0x34, 0x56, 0x87, 0x05, 0x1D, 0x83, 0x18, 0x54, 0x34, 0xCE, 0xB8, 0x7E,
+    0xA2, 0x2C, 0x1B, 0x44, 0xCA, 0xE8, 0x37, 0x3D, 0x66, 0x31, 0x71, 0x26, 0xC5, 0xA2, 0x46, 0xF8,
+    0x2A, 0xFF, 0x8A, 0xC7, 0xBF, 0xEB, 0xD5, 0x40, 0x5E, 0xB2, 0xB1, 0xB5, 0x0A, 0xE6, 0xB6, 0x4A,
+    0x0B, 0xF9, 0x73, 0xBB, 0x52, 0xE1, 0xE8, 0xB6, 0xF1, 0x0B, 0xFD, 0xA6, 0x1B, 0x54, 0x18, 0xEE,
+    0x34, 0x2C, 0xEA, 0xEA, 0x95, 0xA0, 0xDE, 0x09, 0x2F, 0xF6, 0x2C, 0x96, 0xFA, 0x55, 0xA7, 0x7E,
+    0x62, 0xBF, 0x93, 0x58, 0x24, 0xFD, 0x3F, 0x51, 0x3B, 0xD6, 0x9E, 0xCE, 0xAB, 0x8C, 0xCC, 0x74,
+    0xC0, 0xB7, 0x78, 0xC2, 0x1A, 0x6B, 0xBC, 0x4C, 0xC6, 0xB3, 0xAC, 0x3C, 0xE6, 0xBB, 0x01, 0x71,
+    0x3F, 0x42, 0x17, 0xA1, 0x4A, 0xA0, 0x32, 0xC8, 0x02, 0xE2, 0x7E, 0x40, 0x0C, 0x3D, 0x64, 0x63,
+    0x19, 0x65, 0x62, 0x64, 0xC5, 0x29, 0xC6, 0xF1, 0x2D, 0xE4, 0x6B, 0x22, 0x51, 0xDB, 0xF9, 0x84,
+    0x40, 0x07, 0x5A, 0xBA, 0x29, 0x23, 0x92, 0xC9, 0x38, 0x2A, 0xDF, 0x43, 0xAD, 0x22, 0x1C, 0x35,
+    0x40, 0xCA, 0xA0, 0x7E, 0xE2, 0xC1, 0xAC, 0x80, 0x26, 0xCD, 0xE9, 0xB4, 0x18, 0xE7, 0x98, 0x44,
+    0xCB, 0xEC, 0x84, 0xB5, 0x9B, 0x9A, 0x65, 0xF1, 0x50, 0x65, 0x00, 0xFE, 0xEA, 0xD6, 0x4D, 0x53,
+    0x76, 0x9C, 0xBC, 0x10, 0x10, 0x19, 0xDA, 0xA9, 0xC6, 0x4E, 0x70, 0x7A, 0x6E, 0xF1, 0x11, 0x3A,
+    0xA8, 0x3C, 0x62, 0x80, 0xAE, 0x8C, 0xBA, 0x14, 0x0F, 0xFF, 0x11, 0xB5, 0xA5, 0xFA, 0x00, 0xE3,
+    0xE6, 0xF4, 0xE1, 0x70, 0x0F, 0x62, 0x4B, 0xC8, 0x5C, 0x49, 0xAC, 0x1D, 0x6B, 0x87, 0x0E, 0x0F,
+    0x72, 0x0E, 0xE5, 0x2F, 0xA4, 0x1D, 0x8E, 0xEA, 0x03, 0x54, 0x86, 0x7F, 0x8F, 0xF8, 0x7F, 0xFF,
+    0xED, 0x3B, 0x9F, 0xFD, 0x89, 0xF0, 0xA4, 0x45, 0x67, 0x58, 0x4F, 0xE0, 0x9F, 0x1E, 0x2E, 0xFB,
+    0x49, 0x70, 0x34, 0x65, 0x5E, 0x1B, 0xD8, 0x38, 0xCE, 0x2C, 0x4B, 0x38, 0x04, 0x63, 0x51, 0x1E,
+    0x91, 0xA0, 0xDF, 0x7B, 0xFE, 0x0F, 0x3D, 0x9D, 0xE7, 0x89, 0xC9, 0x63, 0x65, 0x71, 0xB2, 0x94,
+    0xFF, 0xBB, 0x13, 0x9B, 0x2D, 0xFC, 0x07, 0xB8, 0x24, 0xA8, 0x65, 0xA8, 0x65, 0x6A, 0x9E, 0x4D,
+    0xCD, 0x33, 0x43, 0xF3, 0x4C, 0xAE, 0xFC, 0xC8, 0xD0, 0xD0, 0xA8, 0xA0, 0x42, 0xCF, 0xD2, 0x58,
+    0x23, 0x22, 0x80, 0xE4, 0x58, 0xC6, 0x23, 0x96, 0x95, 0x33, 0x2F, 0x25, 0x91, 0x5A, 0x5A, 0xED,
+    0x8D, 0xCF, 0xC6, 0x6F, 0x2B, 0xDF, 0x6B, 0xDF, 0xAB, 0xD0, 0x8B, 0xB0, 0x3F, 0x3F, 0x13, 0x76,
+    0xA6, 0xED, 0x3A, 0x26, 0x05, 0x58, 0xC2, 0x14, 0xCC, 0x67, 0xDB, 0xA8, 0x7D, 0x01, 0xF4, 0xA9,
+    0x87, 0xD3, 0x04, 0x8B, 0x25, 0x74, 0x06, 0xEA, 0xAB, 0x01, 0xE3, 0x07, 0x74, 0x98, 0xF0, 0x45,
+    0x24, 0x99, 0x28, 0x65, 0x64, 0x53, 0x0A, 0xDD, 0xAD, 0xBF, 0xF5, 0xCD, 0xC4, 0xF5, 0x2D, 0x8C,
+    0xC7, 0x7C, 0x37, 0xA2, 0xDE, 0x4F, 0xB0, 0x1D, 0xA6, 0x40, 0x21, 0x8E, 0x67, 0x63, 0x93, 0xE7,
+    0x48, 0xCF, 0xED, 0x0B, 0x03, 0x4F, 0x11, 0x44, 0x65, 0x98, 0x4E, 0xC4, 0x3E, 0xF5, 0x53, 0x65,
+    0xC1, 0x62, 0x09, 0x2A, 0xA5, 0x69, 0x74, 0x46, 0x63, 0x67, 0x0A, 0x8D, 0x8C, 0x48, 0x32, 0x61,
+    0x4A, 0xF1, 0x6C, 0x4A, 0x41, 0xFD, 0xFA, 0x56, 0x4F, 0x83, 0x18, 0xC8, 0xA8, 0x60, 0xE6, 0xF3,
+    0xB2, 0x56, 0x25, 0x18, 0x67, 0xAE, 0x85, 0xCB, 0xCC, 0x25, 0x4A, 0x01, 0xF2, 0x1D, 0x58, 0xC8,
+    0x80, 0xE0, 0xB1, 0xFD, 0x51, 0x8D, 0x9D, 0xA7, 0xB0, 0x71, 0x60, 0x7A, 0x90, 0xF7, 0xFD, 0x34,
+    0x03, 0x73, 0xD7, 0x23, 0x86, 0x05, 0x74, 0x2A, 0x4C, 0x13, 0xC8, 0x2A, 0x52, 0xD3, 0xA0, 0x4A,
+    0x49, 0x6C, 0x4A, 0xC1, 0x7C, 0x78, 0x2B, 0xC9, 0x44, 0x6D, 0x5B, 0x18, 0x8C, 0xC7, 0xBC, 0x94,
+    0x21, 0x77, 0x60, 0xEE, 0x4D, 0xC4, 0x8E, 0xC0, 0xC2, 0xD0, 0x82, 0xB9, 0x1A, 0xE1, 0xF8, 0xCB,
+    0x17, 0x48, 0xEB, 0xC9, 0x20, 0x6E, 0xDE, 0x00, 0x9F, 0xFA, 0x89, 0x48, 0x55, 0xFF, 0xE0, 0x61,
+    0x3C, 0x9A, 0x54, 0x57, 0x69, 0xC1, 0x44, 0x97, 0xBA, 0x76, 0xD2, 0xBC, 0x2B, 0x85, 0xAA, 0x94,
+    0xC4, 0xEE, 0xD6, 0x0F, 0x69, 0x10, 0x83, 0x8A, 0x18, 0x3B, 0x42, 0xAE, 0x1D, 0xE6, 0x95, 0x04,
+    0xE3, 0x6A, 0x0F, 0xEC, 0x7F, 0x40, 0xCA, 0x73, 0x00, 0xBE, 0xBD, 0x2F, 0xE0, 0xD3, 0x54, 0x54,
+    0x3E, 0x7E, 0x36, 0x17, 0xD4, 0x88, 0xE3, 0x0B, 0xC1, 0xE6, 0x88, 0xE9, 0xE4, 0xEE, 0x60, 0x9E,
+    0xD2, 0x1F, 0x80, 0xC9, 0x84, 0x6B, 0x53, 0x01, 0xA4, 0xC3, 0xD4, 0x7B, 0x31, 0xB3, 0xF9, 0x7F,
+    0xA8, 0xF1, 0x0E, 0xE6, 0xCA, 0xB1, 0x78, 0xD4, 0xFB, 0x11, 0x63, 0x13, 0x8F, 0xCD, 0x03, 0xFE,
+    0x61, 0xF4, 0xBB, 0x84, 0xF2, 0x03, 0xDA, 0x0F, 0x48, 0x7B, 0x7C, 0xEE, 0x41, 0x7F, 0x88, 0xB1,
+    0x0E, 0x26, 0xE3, 0xAF, 0xF6, 0xA7, 0xB2, 0xF3, 0x3E, 0x29, 0x23, 0xEB, 0xDD, 0x05, 0x7E, 0x73,
+    0xE6, 0x3B, 0x27, 0x60, 0xEB, 0x7E, 0xE3, 0x73, 0x0B, 0xC6, 0xA2, 0x03, 0x32, 0x41, 0x8F, 0x2C,
+    0x51, 0x94, 0x71, 0x86, 0xA1, 0x11, 0x9A, 0x29, 0x63, 0x4F, 0x7B, 0xD9, 0xAA, 0x24, 0xD6, 0xBB,
+    0xF3, 0x31, 0x67, 0xB6, 0x74, 0x80, 0x7A, 0xD2, 0xA5, 0x7B, 0xC0, 0x96, 0x3E, 0xFC, 0xF5, 0x39,
+    0x99, 0xDA, 0xEC, 0xD0, 0x25, 0x4D, 0x7E, 0x50, 0x7B, 0xF4, 0x0E, 0x31, 0x24, 0x96, 0xDA, 0x1F,
+    0x4C, 0x43, 0x3C, 0xC2, 0x11, 0x40, 0xA4, 0x23, 0x1A, 0xED, 0x71, 0x5F, 0xD9, 0xDB, 0xA1, 0x2B,
+    0xE8, 0x12, 0xF7, 0x5C, 0x6E, 0xF5, 0x39, 0x5C, 0xAE, 0x7A, 0x88, 0xCB, 0x35, 0x16, 0x31, 0xA1,
+    0xA4, 0x4C, 0xC8, 0x12, 0x67, 0xBA, 0xF8, 0x80, 0x4B, 0xD0, 0xC5, 0x1F, 0xC1, 0xA6, 0x44, 0x88,
+    0x6B, 0xFF, 0xA0, 0xE2, 0xFC, 0x02, 0x19, 0xCD, 0xFD, 0xA9, 0xF8, 0x54, 0x47, 0xCA, 0x08, 0x28,
+    0x7F, 0x11, 0xB9, 0x37, 0x9F, 0x40, 0x53, 0x76, 0xA8, 0xED, 0xE3, 0x3B, 0x3A, 0xC7, 0x28, 0x33,
+    0x22, 0x1B, 0x8F, 0x4A, 0xA7, 0x60, 0xEE, 0x26, 0x68, 0x6A, 0x07, 0xFD, 0x29, 0xC8, 0x5F, 0x26,
+    0x30, 0x6F, 0x79, 0xE8, 0x3A, 0x10, 0x79, 0x84, 0xEA, 0x9D, 0x04, 0x5D, 0xE5, 0x91, 0xB9, 0x76,
+    0x18, 0xDF, 0x59, 0xB1, 0x65, 0xED, 0x9A, 0xC8, 0xA6, 0x6C, 0xA1, 0x29, 0x8E, 0x7D, 0x52, 0x77,
+    0xC0, 0x8C, 0x4D, 0xC6, 0xCF, 0x98, 0xA4, 0xFD, 0x7E, 0x86, 0x5F, 0xE8, 0x4C, 0x84, 0x05, 0x1A,
+    0x0F, 0xB2, 0x58, 0x68, 0x6A, 0x90, 0xF1, 0x69, 0x38, 0x38, 0x9F, 0xCA, 0x17, 0xB7, 0x26, 0x80,
+    0x4C, 0x4B, 0x30, 0x6F, 0x24, 0xF8, 0x92, 0xB4, 0x17, 0xA2, 0x4A, 0xB3, 0x3F, 0x88, 0x2A, 0xCF,
+    0x6C, 0x9C, 0x89, 0x74, 0x9C, 0xC1, 0x0D, 0x95, 0x60, 0x6C, 0x2C, 0x2A, 0x8D, 0x50, 0xDD, 0x8B,
+    0xD0, 0x34, 0x16, 0xFA, 0x7E, 0x4F, 0xE0, 0xBE, 0xE5, 0xE1, 0x46, 0x07, 0x72, 0x18, 0x67, 0xB1,
+    0x67, 0x3A, 0xA2, 0x92, 0x09, 0xAC, 0x6D, 0x1D, 0xAB, 0x4C, 0x53, 0x8A, 0xA5, 0x2A, 0x11, 0xA6,
+    0xE3, 0xD8, 0x6B, 0xFB, 0x64, 0x4E, 0x85, 0xBD, 0x4D, 0x2A, 0xF7, 0x00, 0xE7, 0xB9, 0x33, 0x91,
+    0x94, 0x2A, 0x19, 0x8B, 0x71, 0x4B, 0x58, 0xC8, 0x84, 0x48, 0xC6, 0x53, 0xF9, 0x16, 0x5A, 0x06,
+    0xC8, 0xDA, 0xA3, 0x43, 0x33, 0x33, 0x9C, 0xBD, 0x8A, 0xA8, 0x58, 0x5B, 0x8C, 0x5D, 0xC2, 0x52,
+    0x9E, 0x1F, 0xD1, 0x34, 0xB0, 0x62, 0x85, 0x4A, 0xEC, 0xD8, 0x20, 0x4A, 0x19, 0x10, 0x65, 0xF7,
+    0x60, 0xAC, 0xA7, 0x98, 0xF9, 0xAF, 0xDA, 0x4E, 0x65, 0x07, 0xC6, 0x3E, 0x88, 0x00, 0x5F, 0xE0,
+    0x4C, 0x0E, 0xEC, 0x9C, 0xF3, 0xAA, 0x02, 0x2C, 0x16, 0xA0, 0xC3, 0x11, 0xE7, 0xB1, 0xE1, 0x8B,
+    0x5C, 0x93, 0xC7, 0x40, 0xF9, 0x01, 0x6A, 0x15, 0xE0, 0x2B, 0x07, 0x17, 0x3C, 0xE4, 0x70, 0x16,
+    0x3D, 0xEE, 0x09, 0x65, 0x63, 0x7B, 0x58, 0xAA, 0xB4, 0x27, 0x94, 0x67, 0xFE, 0x59, 0x0C, 0xD5,
+    0x3C, 0xAF, 0x89, 0x7F, 0xD6, 0x01, 0x15, 0x6A, 0xA8, 0xE9, 0xA7, 0x63, 0x4D, 0x15, 0x2B, 0x4F,
+    0x6D, 0x6B, 0xCB, 0x48, 0xE7, 0x1A, 0xCF, 0xBA, 0x6C, 0x61, 0x7D, 0xEE, 0xA7, 0x07, 0x76, 0xCE,
+    0x2D, 0xE3, 0x9C, 0x24, 0x2C, 0xD9, 0x43, 0xFE, 0xA3, 0x61, 0xE1, 0xC4, 0xF1, 0x44, 0x84, 0x1A,
+    0x37, 0x05, 0xB2, 0xDB, 0x0F, 0x5E, 0xAA, 0x7A, 0x24, 0xF2, 0x2F, 0x4F, 0x07, 0xDD, 0xAA, 0x80,
+    0xF9, 0x9E, 0x63, 0xA1, 0x02, 0x97, 0xE6, 0x01, 0x1E, 0x85, 0x7C, 0x81, 0xC5, 0x5C, 0x8D, 0xD4,
+    0x57, 0x23, 0x07, 0xC2, 0x3D, 0x38, 0x3F, 0x7D, 0x04, 0xB2, 0xFF, 0x29, 0x0C, 0xE2, 0x6D, 0xF8,
+    0xDA, 0x94, 0xF1, 0x25, 0x38, 0x42, 0x9E, 0x21, 0x66, 0x87, 0x52, 0x71, 0x8A, 0x8A, 0xF6, 0x42,
+    0xD4, 0xBE, 0x1E, 0xD9, 0x14, 0x76, 0x7F, 0x19, 0x4F, 0xC9, 0x2D, 0x6D, 0x43, 0xFD, 0x9C, 0xBB,
+    0xFE, 0xDD, 0x52, 0x5E, 0x2A, 0x3B, 0x4E, 0xF7, 0x83, 0x88, 0x01, 0x3A, 0xFB, 0x65, 0x5D, 0x0A,
+    0xEB, 0xDD, 0x04, 0x1C, 0x07, 0x16, 0x71, 0x5E, 0xC8, 0xC9, 0xB8, 0x47, 0x72, 0xB1, 0x71, 0x6C,
+    0x0A, 0xDD, 0x5F, 0xE7, 0x2A, 0x18, 0x97, 0xC9, 0x0D, 0xF5, 0xD5, 0x78, 0x25, 0xAE, 0x4B, 0xD6,
+    0x25, 0x73, 0x7A, 0x1E, 0xB9, 0x75, 0x80, 0xCE, 0x7E, 0x59, 0x94, 0xE2, 0x75, 0x89, 0x93, 0xA7,
+    0x1D, 0x4F, 0x85, 0x57, 0xA0, 0x5F, 0x72, 0xA7, 0x72, 0x97, 0x26, 0x84, 0xFA, 0x27, 0xCE, 0xF0,
+    0x31, 0x81, 0x79, 0x39, 0xA9, 0x38, 0xF2, 0xCD, 0x2F, 0xED, 0x53, 0xF5, 0x8D, 0x93, 0x65, 0x54,
+    0x9F, 0x34, 0x2F, 0x0F, 0x2A, 0x66, 0x72, 0xCF, 0xAA, 0x15, 0x67, 0x75, 0xD9, 0xE9, 0x92, 0xE5,
+    0x79, 0x4E, 0xA4, 0x03, 0x6C, 0xF9, 0x66, 0x5D, 0x46, 0x51, 0x32, 0xC2, 0x4E, 0x2F, 0x51, 0x26,
+    0xEE, 0xB0, 0xE0, 0xB1, 0xDF, 0x85, 0xB5, 0x3B, 0xC6, 0xF8, 0xE9, 0x5D, 0xBB, 0xE5, 0xEC, 0x81,
+    0x7F, 0x0A, 0x03, 0x3A, 0xD0, 0x30, 0x9D, 0xC8, 0x1A, 0xCB, 0x12, 0x99, 0x30, 0xF3, 0xCB, 0x75,
+    0xDA, 0xD3, 0x40, 0x9E, 0x30, 0xF8, 0x32, 0x62, 0xA4, 0xCE, 0x62, 0x48, 0xB5, 0x48, 0xC7, 0xD8,
+    0xDF, 0xF3, 0x79, 0x01, 0x8D, 0xF6, 0x63, 0x73, 0x9E, 0xD8, 0x3C, 0x61, 0x59, 0x20, 0x06, 0xAA,
+    0x07, 0x9D, 0x6A, 0xE8, 0x51, 0x09, 0xE3, 0x58, 0x5C, 0x7C, 0xC9, 0x0F, 0x38, 0x16, 0x50, 0xAE,
+    0x7A, 0x36, 0x25, 0xF2, 0xB5, 0x3A, 0x9E, 0xD7, 0x57, 0x4F, 0xC8, 0x1D, 0xEA, 0x5E, 0x89, 0xE2,
+    0xFE, 0xCF, 0x46, 0x36, 0xBE, 0xB1, 0x9D, 0xD7, 0xC1, 0x78, 0x99, 0xF4, 0xF4, 0x8A, 0x47, 0x47,
+    0x8F, 0x71, 0x1D, 0x3A, 0x18, 0x27, 0x93, 0x0E, 0x8C, 0x32, 0xD1, 0x32, 0x52, 0x9F, 0x37, 0xCE,
+    0x09, 0xF7, 0x8C, 0x20, 0x77, 0x66, 0x34, 0x99, 0x36, 0xE2, 0xE3, 0x9F, 0xC0, 0xA6, 0x60, 0x7E,
+    0xB6, 0xE1, 0x94, 0x1B, 0x3A, 0x32, 0x36, 0xC8, 0x94, 0xA9, 0xEE, 0x05, 0x9A, 0x1A, 0xC6, 0x89,
+    0x87, 0xAC, 0xBF, 0xEE, 0x19, 0x6B, 0xA7, 0x43, 0x67, 0xCF, 0xE8, 0x4A, 0xA4, 0xD9, 0x5E, 0xA8,
+    0x8D, 0xBB, 0x29, 0x94, 0xD5, 0x53, 0xBE, 0x33, 0x27, 0x39, 0xFF, 0x6C, 0xC9, 0xC7, 0x13, 0xD1,
+    0xB2, 0x8E, 0xE8, 0xBB, 0x9E, 0xA5, 0xF6, 0xC2, 0x8A, 0x47, 0x22, 0xF9, 0x31, 0xA0, 0xAF, 0x51,
+    0xB1, 0x47, 0x72, 0xF3, 0xBC, 0x9E, 0x3C, 0xB3, 0x34, 0xC5, 0xAB, 0x4F, 0xAE, 0xFB, 0xC6, 0xD6,
+    0x2F, 0x65, 0xBA, 0xCA, 0xD3, 0xB7, 0xC8, 0x8F, 0x06, 0xAA, 0x7B, 0x9E, 0xAE, 0x81, 0xDC, 0xA3,
+    0xDF, 0x4E, 0x74, 0x3A, 0x8A, 0xC1, 0x84, 0xC6, 0x99, 0x92, 0xA9, 0x8A, 0x7D, 0xB0, 0x12, 0x3A,
+    0xCE, 0x51, 0x7D, 0x98, 0x4B, 0xB7, 0xC9, 0x8C, 0x8F, 0x82, 0x27, 0xBB, 0x80, 0xD7, 0xF3, 0x0B,
+    0x78, 0x77, 0xF6, 0xB9, 0xC4, 0x23, 0x92, 0x3F, 0xE3, 0xB5, 0x2C, 0x96, 0xEA, 0x9E, 0xE7, 0x50,
+    0x46, 0x66, 0x28, 0x78, 0x24, 0xF2, 0x05, 0x16, 0xF3, 0x72, 0xC2, 0x5C, 0x8D, 0x3C, 0xFE, 0x00,
+    0xAF, 0x1F, 0xCD, 0xDC, 0xE7, 0x14, 0xB2, 0x94, 0xE2, 0x65, 0x29, 0xA5, 0x24, 0xB5, 0x15, 0xDB,
+    0x93, 0x6B, 0x2A, 0xD3, 0x82, 0xCC, 0xD4, 0x16, 0x46, 0x2A, 0x0F, 0xA7, 0xFB, 0x92, 0x25, 0x43,
+    0xED, 0x58, 0x40, 0x15, 0xA8, 0xCB, 0x4E, 0x26, 0xAA, 0x52, 0xDC, 0x88, 0xFA, 0xF8, 0xC4, 0x76,
+    0xFB, 0x77, 0x01, 0x17, 0xA0, 0x12, 0x35, 0xD0, 0x53, 0x79, 0xA8, 0x9D, 0x4A, 0xA0, 0x06, 0x32,
+    0xB0, 0x76, 0x37, 0x4E, 0xAE, 0x51, 0x95, 0x52, 0x0A, 0x34, 0xD3, 0xEB, 0x9D, 0x13, 0x1C, 0x57,
+    0x99, 0xEB, 0x81, 0x4D, 0xB9, 0x5A, 0xB2, 0xFA, 0xE4, 0xFA, 0x5B, 0x3F, 0x1B, 0xAB, 0xA0, 0x0A,
+    0x0B, 0xE3, 0xE4, 0xC8, 0xA2, 0x41, 0x66, 0xFA, 0x16, 0x99, 0xF4, 0xB0, 0x42, 0x96, 0x12, 0x96,
+    0xA8, 0xB2, 0x9B, 0xA0, 0x81, 0x1E, 0x1D, 0x61, 0x49, 0x95, 0x60, 0x45, 0x9D, 0xA0, 0xB3, 0x67,
+    0xA3, 0xB8, 0x69, 0x4A, 0xDE, 0x94, 0x20, 0x4B, 0xA8, 0x8B, 0x63, 0x6F, 0x79, 0x35, 0x9D, 0xA4,
+    0xBF, 0x74, 0x72, 0x72, 0x7C, 0x5E, 0x4C, 0x95, 0x32, 0x35, 0x96, 0x52, 0xF2, 0x53, 0x27, 0x27,
+    0x27, 0x27, 0x27, 0xC7, 0xDC, 0xD6, 0xBE, 0x15, 0xC9, 0xB8, 0x53, 0x95, 0x0E, 0x10, 0x83, 0xF1,
+    0xAD, 0x4C, 0xC6, 0x2E, 0x95, 0x3F, 0x80, 0xDB, 0x4F, 0x8A, 0xB4, 0x50, 0x71, 0xA9, 0xFD, 0x60,
+    0x5E, 0x4E, 0xCD, 0xD5, 0xD8, 0x55, 0xE1, 0xF2, 0x81, 0x15, 0x43, 0xAB, 0xD2, 0xA9, 0x8A, 0x63,
+    0xF5, 0xFA, 0x60, 0x9E, 0x4D, 0xB5, 0xF2, 0x47, 0x95, 0xBB, 0x7C, 0xC0, 0x01, 0x97, 0xF9, 0x4A,
+    0xC7, 0x19, 0xE3, 0x9A, 0x9D, 0x18, 0xD7, 0x6C, 0xC5, 0x78, 0x99, 0x4B, 0x1C, 0xFF, 0x7F, 0xB5,
+    0x98, 0x31, 0xAC, 0x24, 0x49, 0x7D, 0xC6, 0x7F, 0x55, 0xC5, 0x6D, 0x5B, 0xD7, 0x41, 0x81, 0xC4,
+    0xC9, 0x32, 0x2B, 0xB9, 0x12, 0x02, 0x40, 0x62, 0x2B, 0xB6, 0x74, 0xD3, 0x5D, 0x7B, 0x1B, 0x5C,
+    0xE0, 0x80, 0x43, 0xE2, 0x99, 0xE0, 0x82, 0x4B, 0x6D, 0x27, 0x2F, 0x21, 0x00, 0x69, 0x66, 0x5F,
+    0x9F, 0x4F, 0x72, 0x42, 0xB2, 0x92, 0xCD, 0xA5, 0xBE, 0x60, 0x03, 0x73, 0x48, 0x26, 0x21, 0x38,
+    0xCB, 0xFD, 0x76, 0x0A, 0xAF, 0xE4, 0x0B, 0x36, 0x70, 0x09, 0x90, 0x08, 0x08, 0xAE, 0x30, 0xB7,
+    0xB2, 0x64, 0x82, 0x2B, 0x43, 0x1D, 0xAE, 0xBD, 0xED, 0x99, 0x3F, 0x41, 0xCF, 0xDB, 0x7B, 0x08,
+    0x73, 0x19, 0x2D, 0xCD, 0xB4, 0xA6, 0x35, 0xD3, 0xFD, 0xFD, 0xFF, 0xF5, 0xFD, 0xBF, 0xEF, 0xAB,
+    0x01, 0x80, 0xFA, 0x22, 0xD4, 0x19, 0xCA, 0x37, 0xB9, 0x3A, 0xBC, 0x1C, 0x19, 0xE5, 0xC8, 0x70,
+    0xF6, 0x35, 0x76, 0xC0, 0x7C, 0x7A, 0x35, 0xA0, 0x82, 0x2A, 0xA0, 0x45, 0x92, 0x11, 0x89, 0xE6,
+    0xF1, 0x59, 0x30, 0x09, 0xBA, 0x08, 0x7D, 0x04, 0x1B, 0xC1, 0x4E, 0xE0, 0x02, 0xB8, 0xB3, 0x33,
+    0xBC, 0x08, 0xA3, 0x1C, 0x01, 0x55, 0x81, 0x23, 0xB0, 0x9F, 0x60, 0x28, 0xE0, 0xB7, 0x60, 0x5F,
+    0x03, 0xFB, 0x30, 0xD2, 0xA5, 0x8A, 0x29, 0x1B, 0x54, 0xB5, 0x13, 0xCD, 0x64, 0xB6, 0xCC, 0x8C,
+    0x22, 0x78, 0x91, 0x68, 0xFF, 0xE7, 0xED, 0xD2, 0x47, 0x76, 0x26, 0x63, 0xEF, 0x14, 0xCC, 0xCF,
+    0x1B, 0xB4, 0x05, 0xC6, 0x1D, 0xF4, 0x11, 0x2F, 0x12, 0xEC, 0x0A, 0xE5, 0x15, 0x55, 0x4F, 0x50,
+    0x3D, 0x2B, 0x0E, 0x93, 0x40, 0x7D, 0xF4, 0x8F, 0xB0, 0x97, 0xC4, 0xF8, 0xFD, 0x23, 0x76, 0x72,
+    0xD1, 0x24, 0x55, 0x55, 0x61, 0x60, 0xC6, 0x4E, 0x03, 0x5D, 0xB2, 0x93, 0x2E, 0x5D, 0xD2, 0x4D,
+    0x7D, 0xF8, 0xF5, 0x85, 0xBD, 0x2C, 0x8C, 0xF2, 0x3E, 0xE0, 0x8F, 0xF7, 0xB0, 0x22, 0x98, 0xC7,
+    0xE7, 0x45, 0x55, 0x1E, 0x30, 0x63, 0x27, 0x8F, 0xC9, 0x76, 0x52, 0xD5, 0x24, 0x16, 0x55, 0xD4,
+    0x81, 0xBD, 0x34, 0x46, 0xA9, 0xD8, 0xE9, 0x3C, 0x9A, 0x44, 0x53, 0x05, 0xCF, 0x4C, 0x97, 0x06,
+    0x74, 0xB1, 0x13, 0x4B, 0x97, 0x78, 0xA0, 0xEA, 0x73, 0xC2, 0x5E, 0x84, 0x51, 0x9E, 0x00, 0x5E,
+    0x0E, 0x8C, 0x72, 0xF8, 0xC4, 0x0E, 0x17, 0x30, 0x05, 0x4C, 0x5E, 0xAB, 0xF8, 0x7F, 0x3B, 0x7C,
+    0xAA, 0x74, 0x00, 0x40, 0x8B, 0x34, 0xB0, 0x22, 0x19, 0x86, 0xB3, 0xF3, 0x80, 0x2A, 0x6C, 0xA1,
+    0x8F, 0xBA, 0xC0, 0x80, 0x8D, 0xA8, 0xC2, 0x00, 0x7D, 0xA4, 0xC2, 0x40, 0x17, 0xA1, 0xE2, 0xA1,
+    0x8B, 0x34, 0xF0, 0x98, 0x0C, 0x0D, 0x17, 0xE8, 0x22, 0x33, 0x0C, 0xE8, 0x82, 0x2E, 0xD8, 0x09,
+    0x3B, 0xB1, 0x81, 0x05, 0x55, 0x78, 0xED, 0xF1, 0xD9, 0xAB, 0x3F, 0x31, 0x22, 0x22, 0xCD, 0x89,
+    0x88, 0xA4, 0x19, 0x70, 0x26, 0x03, 0xB3, 0x0D, 0x60, 0xF2, 0x06, 0xB0, 0xB7, 0xDF, 0x02, 0xBE,
+    0xF0, 0xC7, 0xE1, 0x52, 0x3F, 0xE9, 0xCC, 0x5D, 0xBA, 0x68, 0x32, 0x0B, 0x26, 0x99, 0x64, 0x0A,
+    0xBA, 0x74, 0xC9, 0x46, 0xA8, 0x5D, 0xF4, 0x01, 0xE6, 0x3E, 0x5E, 0x02, 0x5B, 0xFB, 0x7A, 0x03,
+    0x06, 0xFB, 0x72, 0x06, 0x9C, 0xFB, 0x4A, 0x04, 0xAC, 0x08, 0xA7, 0x45, 0x00, 0xEE, 0xDE, 0xBD,
+    0x0B, 0xA8, 0xB6, 0xF1, 0x80, 0x29, 0x5B, 0x3B, 0x81, 0x8D, 0x73, 0x1F, 0x61, 0x0C, 0xAD, 0x4B,
+    0x70, 0x49, 0x33, 0x05, 0xDD, 0xA8, 0xAA, 0xD0, 0x65, 0x55, 0x68, 0xB8, 0xA8, 0x0B, 0x33, 0x23,
+    0x26, 0xB3, 0xBB, 0x1A, 0x9B, 0x89, 0xBD, 0x54, 0xFE, 0xE2, 0xC6, 0x02, 0x3C, 0x38, 0xAD, 0xCB,
+    0x00, 0xEC, 0x80, 0x05, 0xBA, 0xC2, 0x28, 0x13, 0xE3, 0x01, 0x5E, 0x38, 0x9F, 0xD6, 0xA5, 0xD5,
+    0xE5, 0x77, 0x97, 0xBB, 0xCF, 0xDF, 0xE0, 0x22, 0x5E, 0x88, 0xE0, 0xA5, 0xC2, 0x67, 0xD7, 0x15,
+    0x1E, 0xB1, 0x13, 0x63, 0x34, 0x19, 0x9F, 0x55, 0xC5, 0x55, 0x66, 0xEC, 0x25, 0x1E, 0xFB, 0x4F,
+    0xD8, 0xA9, 0x7F, 0x14, 0x4D, 0xEA, 0x1E, 0x66, 0x55, 0x4D, 0xAA, 0xCC, 0x26, 0x6F, 0x19, 0x75,
+    0xF1, 0xD8, 0xD7, 0x8B, 0x8D, 0x26, 0x55, 0x93, 0x55, 0x69, 0xAA, 0x32, 0xCF, 0x6C, 0x19, 0xB6,
+    0x78, 0xEC, 0x25, 0x76, 0xEA, 0x8E, 0x98, 0xA4, 0x05, 0x55, 0xD9, 0xC3, 0xCC, 0x18, 0x18, 0x01,
+    0xBE, 0x4C, 0x81, 0x7E, 0x9A, 0x41, 0x1D, 0x17, 0xC0, 0x35, 0xAE, 0x1D, 0xBA, 0x60, 0x0A, 0x0D,
+    0xB3, 0x30, 0xA0, 0x8F, 0xB8, 0xA0, 0x24, 0xF4, 0x91, 0xA7, 0x49, 0x17, 0x9E, 0x14, 0x1A, 0xF3,
+    0xCC, 0x86, 0xED, 0x80, 0x0B, 0x1B, 0x1B, 0xFA, 0x38, 0x74, 0xD1, 0x14, 0xAF, 0x0B, 0xCD, 0xB1,
+    0xB0, 0xB1, 0x61, 0xC0, 0xD9, 0xC9, 0x85, 0xFE, 0x51, 0xEC, 0xA2, 0xF9, 0xEF, 0xA8, 0x0B, 0x4F,
+    0x13, 0x8D, 0x8B, 0xCC, 0x06, 0x5F, 0x70, 0xA1, 0x2F, 0xF4, 0xD1, 0x54, 0x4C, 0x01, 0x8F, 0xAA,
+    0x34, 0xDC, 0x64, 0x32, 0x0D, 0x17, 0x6C, 0x64, 0x66, 0x41, 0x17, 0x1B, 0xB1, 0xD3, 0x25, 0x6C,
+    0xFA, 0x84, 0xAA, 0x77, 0xA1, 0x97, 0x0C, 0xA3, 0x00, 0x4F, 0xEE, 0x82, 0x49, 0x33, 0x38, 0x2A,
+    0xCC, 0xA6, 0x60, 0x72, 0x97, 0xB0, 0x93, 0x9D, 0xD8, 0xE1, 0xD1, 0x85, 0x81, 0x3E, 0xB2, 0x30,
+    0xAC, 0xB2, 0x64, 0x45, 0x32, 0x4A, 0xE4, 0x00, 0xFE, 0xEC, 0xD5, 0x88, 0xC9, 0xCC, 0xB0, 0xC1,
+    0xC6, 0xD3, 0x6C, 0xCC, 0xD8, 0x80, 0x9D, 0x54, 0x39, 0x4D, 0x8C, 0xC7, 0x64, 0x4C, 0x66, 0x80,
+    0x0D, 0x5D, 0x3A, 0x0D, 0xCC, 0x4C, 0x1F, 0xB1, 0x13, 0x0D, 0x2A, 0x36, 0xE0, 0x51, 0x05, 0x93,
+    0xF1, 0x7C, 0x66, 0xC1, 0x14, 0x23, 0x81, 0x81, 0x31, 0x61, 0xD2, 0x95, 0xD0, 0x46, 0xD8, 0x07,
+    0x5B, 0xE0, 0x22, 0x9A, 0x03, 0x8C, 0x45, 0x49, 0xC0, 0xCD, 0x3C, 0xC8, 0xD8, 0xBB, 0xDC, 0x7A,
+    0x87, 0xEE, 0x3F, 0x83, 0x7D, 0x0D, 0xF3, 0xD3, 0x68, 0x7E, 0x1A, 0xF5, 0xAF, 0x8A, 0x2A, 0x85,
+    0xBA, 0x30, 0xBF, 0xC8, 0x3B, 0x03, 0x83, 0x0D, 0x2F, 0xDA, 0x60, 0xEF, 0xA4, 0x5B, 0x5D, 0x34,
+    0xF1, 0x1D, 0xA7, 0x8B, 0x2A, 0xB7, 0xEC, 0xD4, 0x98, 0xBB, 0x77, 0xE3, 0xC0, 0xA0, 0x7E, 0x9D,
+    0x5C, 0xB0, 0x61, 0x53, 0xBA, 0xD8, 0x45, 0x5B, 0x75, 0x51, 0xC5, 0x2C, 0x34, 0x66, 0x0E, 0x0C,
+    0x0C, 0xDC, 0xC2, 0x05, 0xF0, 0x70, 0x8B, 0x01, 0x06, 0x06, 0xD8, 0xB1, 0x83, 0xED, 0x5A, 0xCB,
+    0x0C, 0x6D, 0x2D, 0xA5, 0xA2, 0xAA, 0x2A, 0xE8, 0xA2, 0x45, 0xA4, 0x18, 0x11, 0xC9, 0xE6, 0xF1,
+    0xD9, 0xD7, 0x93, 0x49, 0x74, 0xB1, 0x8B, 0xF4, 0xB1, 0x8F, 0xD8, 0x68, 0xA7, 0xB5, 0xC5, 0x2E,
+    0xB8, 0x80, 0xC3, 0x81, 0xC7, 0x9F, 0x6E, 0x3C, 0x9C, 0x2A, 0xEE, 0x24, 0x81, 0x48, 0xC1, 0xBE,
+    0x7F, 0xB3, 0x70, 0xA0, 0xCF, 0x7D, 0xC2, 0xC6, 0xBB, 0xE0, 0x5E, 0x2A, 0xB0, 0xB3, 0x13, 0xB4,
+    0x1D, 0x98, 0xFF, 0x2A, 0xE0, 0xBE, 0x12, 0x61, 0x37, 0x80, 0x2E, 0x0D, 0xEC, 0xC3, 0x0C, 0x83,
+    0x9D, 0xD0, 0x65, 0x04, 0x1B, 0x2F, 0x61, 0x66, 0xA1, 0xCF, 0xFA, 0xA0, 0x8E, 0xE8, 0x75, 0x09,
+    0x9F, 0xB0, 0xCE, 0x0C, 0x5E, 0xE4, 0xC0, 0x28, 0x72, 0x60, 0x38, 0x3B, 0x5B, 0xD8, 0xC1, 0xB2,
+    0x56, 0x34, 0x43, 0xA5, 0xA1, 0x0A, 0x15, 0x5D, 0x54, 0xC1, 0x14, 0x5D, 0x30, 0xD9, 0x14, 0x4C,
+    0x32, 0x99, 0x2E, 0x9A, 0x44, 0x1F, 0xBB, 0x88, 0x9D, 0xFA, 0x88, 0x9D, 0x6C, 0xC4, 0x05, 0x3B,
+    0xE1, 0x71, 0x01, 0x8F, 0x83, 0x01, 0x0F, 0x1B, 0x06, 0xD8, 0x82, 0x3F, 0x06, 0xAC, 0x1C, 0x30,
+    0x8F, 0xF7, 0x49, 0x55, 0xB5, 0x30, 0xE3, 0xF1, 0xF4, 0xD1, 0x4E, 0xBA, 0xAC, 0x26, 0xC1, 0x5D,
+    0x66, 0x46, 0xC6, 0xB3, 0x7D, 0xB0, 0x22, 0xC1, 0xC8, 0x13, 0x54, 0x39, 0xE9, 0xE0, 0x70, 0x32,
+    0xAA, 0x2E, 0xF1, 0xBB, 0x17, 0x4F, 0x47, 0x2F, 0xEF, 0xD3, 0x8B, 0x44, 0x73, 0xBC, 0xFD, 0x03,
+    0x8E, 0x80, 0x9F, 0x56, 0xA1, 0x60, 0x66, 0x95, 0x48, 0x55, 0x4F, 0x2E, 0x60, 0x0A, 0x30, 0xB2,
+    0xEA, 0x0A, 0xC3, 0xF5, 0x2B, 0xBA, 0x9E, 0xBE, 0xCC, 0x7E, 0xFA, 0x33, 0xB4, 0x48, 0xA2, 0x93,
+    0x06, 0xBC, 0xB2, 0x76, 0x6A, 0x14, 0x59, 0x5E, 0x78, 0xF5, 0xF1, 0xD7, 0x3E, 0xD1, 0x61, 0xAE,
+    0x94, 0x6C, 0x5E, 0xD5, 0xEC, 0x99, 0x84, 0xD7, 0xDF, 0x37, 0x2B, 0x93, 0x51, 0xB5, 0x8F, 0xD8,
+    0xE8, 0xE0, 0x92, 0xCD, 0x2A, 0x19, 0x1E, 0x5D, 0x68, 0x74, 0xD1, 0x46, 0x6C, 0xD8, 0xC1, 0x60,
+    0x0A, 0xCC, 0x0E, 0x54, 0x69, 0x60, 0x7E, 0x16, 0xC1, 0x5E, 0x02, 0xEE, 0x0A, 0xB7, 0x6A, 0x57,
+    0xB8, 0x0F, 0x80, 0xCB, 0x30, 0x1E, 0x01, 0x49, 0x2B, 0xF4, 0x8F, 0x0F, 0x3B, 0x5D, 0x45, 0x0C,
+    0x75, 0x7E, 0x0F, 0x7A, 0x91, 0x42, 0x2F, 0xFB, 0x7D, 0xD2, 0x07, 0x93, 0x2E, 0x78, 0xC0, 0x96,
+    0x66, 0x63, 0x1F, 0xFB, 0x1F, 0x56, 0x16, 0xB6, 0x1E, 0x3B, 0x75, 0x0F, 0xB3, 0xAA, 0xCC, 0x03,
+    0x0E, 0xFB, 0x30, 0xEB, 0x42, 0x1B, 0x19, 0xF0, 0xBA, 0x9A, 0xD4, 0x67, 0x9B, 0x76, 0x37, 0x16,
+    0x46, 0xF9, 0xE5, 0x11, 0xF6, 0x72, 0x0C, 0x70, 0xFE, 0x13, 0xD6, 0x7A, 0xD7, 0xA6, 0x9C, 0x9E,
+    0xEF, 0x60, 0x87, 0x0D, 0x34, 0xEC, 0x64, 0x0A, 0x5D, 0xEC, 0x23, 0x26, 0xB9, 0x80, 0x2E, 0xC3,
+    0xA9, 0x2C, 0x9E, 0x16, 0x60, 0x1F, 0x81, 0x31, 0x00, 0x17, 0x00, 0x12, 0xC0, 0xFC, 0x32, 0x42,
+    0xFF, 0x6E, 0x04, 0x6F, 0x12, 0xEC, 0x74, 0x81, 0xA6, 0x4E, 0xF2, 0xDA, 0x47, 0x66, 0x5C, 0x60,
+    0x77, 0x9A, 0x9E, 0x8F, 0x19, 0x37, 0xC0, 0xCC, 0xEE, 0x44, 0xE5, 0xC6, 0xBC, 0x0A, 0xE4, 0x35,
+    0x3E, 0x67, 0x5D, 0x30, 0xC9, 0x14, 0xBA, 0x64, 0x32, 0x7D, 0x34, 0x09, 0xFB, 0x31, 0x9F, 0x83,
+    0x8D, 0x38, 0xAE, 0xF8, 0x3C, 0xE2, 0xCF, 0xCE, 0xEE, 0xBE, 0xE2, 0x45, 0xA4, 0x8C, 0x22, 0x52,
+    0xAE, 0xE8, 0xB3, 0xBE, 0x25, 0x56, 0x3B, 0xE6, 0xC6, 0xD4, 0x45, 0x9C, 0x2E, 0xF4, 0x71, 0xC6,
+    0x94, 0x01, 0x9A, 0x0D, 0x6C, 0xAE, 0x5F, 0xCC, 0x1E, 0x5A, 0x9F, 0xD8, 0x71, 0x50, 0x17, 0x78,
+    0x91, 0xA8, 0xE4, 0x69, 0x3E, 0xF5, 0x6C, 0x77, 0x95, 0xC9, 0xE2, 0xE9, 0xD6, 0x15, 0xD8, 0x9E,
+    0x2E, 0x7A, 0x74, 0xE6, 0x16, 0xC3, 0xAA, 0xA8, 0x03, 0x26, 0xB1, 0x61, 0x47, 0x17, 0xD9, 0xAE,
+    0x9A, 0x3A, 0x33, 0x63, 0x23, 0x0B, 0x6D, 0x95, 0xD7, 0x8A, 0x0D, 0xAA, 0xAA, 0x82, 0x43, 0x15,
+    0x5D, 0xF0, 0xE8, 0x62, 0x0A, 0x23, 0x26, 0x9B, 0xCC, 0x80, 0x49, 0x26, 0xB1, 0xA3, 0x4B, 0x5D,
+    0x64, 0xBB, 0xCA, 0xD3, 0x4C, 0x1F, 0xED, 0x44, 0x5B, 0x25, 0xAA, 0x62, 0x83, 0x0B, 0xAA, 0xE2,
+    0x70, 0x67, 0x7F, 0xF5, 0xE1, 0xD9, 0x39, 0x5E, 0x44, 0x44, 0x18, 0x45, 0x44, 0x8E, 0x7F, 0x18,
+    0x52, 0xFA, 0x24, 0x48, 0x7C, 0x12, 0xA4, 0x6C, 0x12, 0x9B, 0xDF, 0x87, 0x14, 0xAF, 0x20, 0xB5,
+    0x67, 0x90, 0xC2, 0x0A, 0xE9, 0x6B, 0x2B, 0xA4, 0x36, 0x8A, 0x88, 0x48, 0x05, 0x4E, 0x0A, 0xF1,
+    0xEC, 0xA4, 0xD7, 0x93, 0xC9, 0xEB, 0xA7, 0x7B, 0x5E, 0x02, 0xA3, 0x04, 0x5E, 0xB8, 0xB8, 0x36,
+    0xB5, 0x9B, 0x6B, 0x53, 0x7B, 0xFC, 0x2E, 0x88, 0x44, 0x3E, 0xFA, 0x7E, 0x51, 0x45, 0x37, 0x5D,
+    0x58, 0x4C, 0x61, 0x36, 0x99, 0xD9, 0x24, 0x96, 0x2E, 0xAA, 0xD6, 0x47, 0x53, 0x6C, 0x3C, 0x4F,
+    0x56, 0x24, 0x38, 0x79, 0x7F, 0xBD, 0xCF, 0x96, 0x01, 0x98, 0x19, 0x80, 0x85, 0x1D, 0x27, 0xF2,
+    0xA9, 0xCA, 0x0C, 0xAA, 0xD0, 0x40, 0x17, 0x2A, 0x98, 0xAC, 0x8E, 0xF7, 0x31, 0x49, 0x8B, 0x84,
+    0x2E, 0x99, 0x8F, 0xF6, 0xA9, 0x8F, 0x26, 0x77, 0xA5, 0x8F, 0x26, 0xE9, 0x62, 0xA7, 0x2E, 0xAA,
+    0x6A, 0x43, 0x1F, 0x55, 0x75, 0xD8, 0xA8, 0x8B, 0xC7, 0x4E, 0xA6, 0x8C, 0xB8, 0x60, 0xD3, 0x80,
+    0xBB, 0xBD, 0x9F, 0x36, 0x78, 0x39, 0xB2, 0x65, 0x94, 0xCC, 0xBC, 0x3E, 0xBD, 0xAD, 0x25, 0xBA,
+    0x00, 0xF3, 0x5A, 0xB4, 0x9D, 0x60, 0x03, 0xEA, 0x78, 0x9F, 0x5E, 0x0E, 0x8C, 0xDF, 0x3B, 0xD0,
+    0xD4, 0x62, 0x92, 0xAA, 0x8E, 0x2E, 0xCD, 0xB8, 0x3B, 0x85, 0xD9, 0x4E, 0xA6, 0xEC, 0xF0, 0xB7,
+    0xEB, 0x9F, 0x2E, 0xBD, 0xC8, 0x34, 0x4A, 0xBE, 0x8A, 0x69, 0x09, 0x2F, 0x82, 0xB9, 0xE7, 0x0A,
+    0x70, 0x79, 0x62, 0xA5, 0x2E, 0xA7, 0x46, 0xB9, 0x00, 0x5D, 0x32, 0x22, 0x05, 0x91, 0x85, 0x17,
+    0xCE, 0x2E, 0xAE, 0x49, 0xB4, 0x29, 0x27, 0x51, 0x5A, 0x80, 0x83, 0xBA, 0x77, 0xE3, 0xC8, 0x5E,
+    0x0E, 0x38, 0x69, 0xF0, 0xDC, 0x35, 0x3D, 0x9A, 0xD1, 0x92, 0x31, 0x99, 0xBD, 0x54, 0xEC, 0xD4,
+    0xD7, 0x9B, 0x85, 0x1D, 0x0F, 0xE8, 0x8A, 0x2E, 0x5D, 0xA6, 0x8F, 0x7D, 0x1C, 0xC1, 0x85, 0x41,
+    0x35, 0x18, 0xA8, 0x7D, 0x84, 0xD6, 0xC5, 0x11, 0x4C, 0xF6, 0xD2, 0xC0, 0x4E, 0x22, 0x09, 0x76,
+    0xE6, 0xF1, 0x39, 0xE8, 0x62, 0xC3, 0x0C, 0x36, 0x6E, 0x75, 0x81, 0x41, 0x97, 0x3E, 0xA2, 0xAA,
+    0x9D, 0x5C, 0xC0, 0xC6, 0x81, 0x01, 0x2E, 0x55, 0xE5, 0x40, 0x9F, 0xBB, 0xC8, 0x41, 0x09, 0x1E,
+    0x25, 0x92, 0x69, 0xB0, 0x3F, 0x00, 0xF0, 0x29, 0x00, 0x9E, 0x97, 0xB6, 0x1A, 0xE5, 0xF8, 0xF8,
+    0x3C, 0xE8, 0xCA, 0x16, 0x3B, 0xE9, 0xC2, 0x0E, 0x1B, 0x75, 0x61, 0xA0, 0x4B, 0x54, 0xDC, 0xD4,
+    0x45, 0xC6, 0xC9, 0xC3, 0x28, 0x0B, 0x8C, 0x92, 0xD1, 0x4F, 0xCE, 0x03, 0x6E, 0xDA, 0xC2, 0xA2,
+    0xCB, 0xEA, 0xF4, 0x97, 0x6C, 0xE8, 0xB2, 0xAA, 0x8C, 0xF4, 0xD1, 0x14, 0x46, 0x7C, 0xA0, 0xC1,
+    0xCD, 0xFC, 0x79, 0x23, 0xBF, 0xCA, 0xE3, 0x9B, 0x1F, 0xBC, 0x54, 0xF5, 0xE2, 0x26, 0x53, 0x66,
+    0xEC, 0xC3, 0xCC, 0xE0, 0x82, 0xAA, 0x33, 0xFD, 0xBF, 0x17, 0x46, 0x1B, 0x55, 0x1B, 0xB1, 0x69,
+    0x66, 0x7F, 0xBB, 0xF5, 0xB3, 0x91, 0x0F, 0x8B, 0x91, 0x97, 0x27, 0xC2, 0x55, 0xF7, 0x6E, 0x2E,
+    0x68, 0x39, 0xE0, 0x9E, 0x04, 0x2E, 0x02, 0xAA, 0xAD, 0x7D, 0xEF, 0x22, 0xD8, 0xBF, 0x3F, 0x60,
+    0xCF, 0x65, 0x72, 0xFF, 0xEA, 0x92, 0x8F, 0xA6, 0x8C, 0x41, 0x97, 0x11, 0x5D, 0x76, 0xE8, 0xB2,
+    0xC5, 0x94, 0x2D, 0x26, 0x6F, 0xE9, 0xD2, 0x16, 0x1B, 0x37, 0xB8, 0x30, 0xF2, 0x00, 0x2B, 0x0B,
+    0x46, 0xD2, 0x1A, 0x0C, 0x6E, 0x36, 0xAC, 0x14, 0xF3, 0xE4, 0x3C, 0x2E, 0xCC, 0x2E, 0x74, 0x0F,
+    0x0B, 0xCB, 0x06, 0xFF, 0xB2, 0xC8, 0xB4, 0x97, 0x6A, 0xE3, 0xAB, 0x79, 0xC1, 0xF7, 0x51, 0x95,
+    0x1D, 0xDE, 0x94, 0x2E, 0x3B, 0x59, 0xB8, 0x38, 0xAE, 0xBF, 0x3D, 0x7F, 0x1F, 0x91, 0xE9, 0xD6,
+    0xD7, 0x2B, 0x0C, 0x60, 0x03, 0x36, 0xE2, 0x93, 0xDA, 0x27, 0x73, 0x0C, 0xA6, 0x61, 0x0A, 0x54,
+    0xD8, 0x81, 0x8D, 0xCF, 0x6B, 0x91, 0xC9, 0xCB, 0xC4, 0x67, 0x81, 0xE7, 0x5E, 0xC1, 0x48, 0xC5,
+    0x7E, 0xD0, 0x56, 0x27, 0x7E, 0x56, 0x4C, 0x80, 0x01, 0x9F, 0x5B, 0x27, 0xBF, 0xCE, 0x17, 0xB7,
+    0xE5, 0x8D, 0xA2, 0x0E, 0x1E, 0x53, 0x1B, 0xFD, 0xBB, 0x89, 0xD1, 0x43, 0x9B, 0xE9, 0x7E, 0x54,
+    0x18, 0xFB, 0xA8, 0x9A, 0xC3, 0xC6, 0x91, 0x03, 0x17, 0x92, 0xB8, 0x68, 0xEB, 0x92, 0xDE, 0xAC,
+    0x8C, 0x12, 0xC7, 0x37, 0xAB, 0x0F, 0x83, 0x9B, 0xEC, 0x57, 0x62, 0xFF, 0x30, 0xBB, 0x9F, 0x8B,
+    0xE4, 0xBD, 0x4C, 0x1E, 0xFA, 0x88, 0x2E, 0x2B, 0xA2, 0xF4, 0xBC, 0x12, 0x99, 0xDC, 0x8A, 0x48,
+    0x3D, 0xE1, 0xF9, 0x70, 0xA3, 0x75, 0x47, 0x36, 0xEC, 0xF3, 0x73, 0x07, 0x8A, 0x7D, 0x0C, 0xAD,
+    0x8B, 0x3B, 0xD0, 0xC5, 0x9B, 0x0C, 0x7D, 0x6C, 0x0E, 0xF0, 0x26, 0xCD, 0xC0, 0x5E, 0x24, 0x83,
+    0x11, 0x91, 0x00, 0xF6, 0x8D, 0xB2, 0x5D, 0xB7, 0x56, 0x05, 0x4C, 0xD9, 0x74, 0x11, 0xDC, 0xED,
+    0x62, 0x03, 0xAA, 0xF5, 0x71, 0xC4, 0x48, 0xBC, 0xC5, 0x45, 0xB1, 0x8D, 0xCA, 0x45, 0xFC, 0xD4,
+    0x4A, 0x3F, 0xB5, 0xBF, 0xA7, 0x45, 0xF8, 0xD6, 0xAB, 0x19, 0x16, 0xF0, 0x60, 0x27, 0x5C, 0x34,
+    0x32, 0x29, 0xC9, 0xF0, 0x00, 0xFA, 0x88, 0x2A, 0x30, 0x7F, 0x9E, 0x4B, 0x2B, 0x47, 0x25, 0x07,
+    0x78, 0x05, 0xF4, 0xC4, 0x5F, 0x3B, 0x4C, 0x9E, 0xB1, 0x77, 0x32, 0x3B, 0x3B, 0xA9, 0xB2, 0xA3,
+    0xFF, 0x61, 0x61, 0xE8, 0x23, 0x75, 0xA0, 0x8B, 0x15, 0xDF, 0x45, 0x16, 0x47, 0x9F, 0xB7, 0x5C,
+    0x5C, 0x11, 0xAA, 0xBB, 0x22, 0xD4, 0x17, 0x79, 0x8B, 0x77, 0xBA, 0xA8, 0x9E, 0x5C, 0xA2, 0x25,
+    0x5D, 0xC5, 0x86, 0x2F, 0x70, 0xE3, 0xF5, 0x8F, 0xEF, 0x91, 0x1A, 0xAE, 0x4B, 0xCC, 0x1F, 0x3F,
+    0x68, 0x6B, 0x83, 0x2E, 0x5B, 0xEC, 0x0F, 0x0B, 0x0F, 0xBA, 0xD8, 0x55, 0x37, 0xFD, 0x5B, 0x1C,
+    0xE5, 0x35, 0x2E, 0xEA, 0x37, 0xD7, 0x59, 0xBA, 0xCF, 0xDF, 0x50, 0x69, 0xAA, 0x98, 0xA2, 0x8B,
+    0x8D, 0x26, 0x8F, 0x98, 0x34, 0xD3, 0xFD, 0xA8, 0xD2, 0x4B, 0xA2, 0x97, 0x88, 0x7D, 0x23, 0x63,
+    0x5F, 0x2A, 0x38, 0x1A, 0x9E, 0x99, 0x91, 0x81, 0x01, 0xCF, 0x06, 0x37, 0xC1, 0xDB, 0x6F, 0xDF,
+    0xC3, 0xC9, 0x11, 0xFD, 0xD1, 0xF7, 0x12, 0x03, 0x5B, 0xBA, 0xD4, 0x47, 0xE6, 0x67, 0x0E, 0xB5,
+    0x9A, 0x13, 0xBA, 0xE8, 0xC2, 0xC0, 0x40, 0x97, 0x4C, 0x62, 0x66, 0x8B, 0x0F, 0x7D, 0x1C, 0x0B,
+    0x8B, 0x69, 0x6B, 0xEA, 0x01, 0xBE, 0x0B, 0x5F, 0x9A, 0x6C, 0xA6, 0x5B, 0x94, 0x80, 0x4C, 0xB7,
+    0x0A, 0xB7, 0xAA, 0x79, 0x8F, 0xEE, 0x3D, 0x5E, 0xFC, 0x01, 0x4F, 0x4A, 0xF7, 0x68, 0x72, 0x9E,
+    0xF9, 0x9B, 0xE6, 0xC7, 0xB9, 0x7F, 0x23, 0xBE, 0xB3, 0xA1, 0xBE, 0xE8, 0xBA, 0x68, 0xCD, 0x8F,
+    0xF3, 0xAC, 0xCA, 0x97, 0xB7, 0x76, 0xF2, 0xEA, 0x83, 0x50, 0x4D, 0x76, 0xD9, 0x86, 0x0D, 0x8B,
+    0x2A, 0x26, 0xDA, 0xC9, 0xC3, 0x7D, 0x3E, 0x47, 0x65, 0x50, 0x85, 0x41, 0x17, 0x76, 0x26, 0xB3,
+    0x35, 0x99, 0xB9, 0x4B, 0xB4, 0x5E, 0xA4, 0xF6, 0x22, 0xD5, 0x4E, 0xBA, 0xD8, 0x60, 0x8A, 0xC3,
+    0x64, 0x8F, 0x49, 0x23, 0x5D, 0x1C, 0xE8, 0xE3, 0x06, 0x1B, 0xB9, 0xD9, 0x30, 0xB2, 0x30, 0x7E,
+    0x67, 0x31, 0x85, 0xE6, 0x82, 0x29, 0x0B, 0xFD, 0xC3, 0x8C, 0x77, 0x81, 0x79, 0xC6, 0xFC, 0xAA,
+    0x60, 0xBF, 0x1D, 0xD9, 0x7A, 0x4C, 0xD9, 0xE1, 0xC2, 0x41, 0x37, 0x44, 0x26, 0xAE, 0x76, 0xBE,
+    0x6F, 0x9D, 0x4F, 0xE6, 0x91, 0x44, 0x77, 0x79, 0x3E, 0xED, 0xA7, 0xD1, 0x34, 0x66, 0x1B, 0x4D,
+    0xB9, 0x8B, 0xFD, 0xBB, 0xC2, 0xA6, 0x8F, 0xAA, 0x0C, 0xF4, 0xB1, 0x32, 0x76, 0x91, 0xE6, 0xE9,
+    0xD2, 0x82, 0x33, 0x99, 0xD9, 0x06, 0x93, 0xF9, 0x42, 0x9F, 0xB1, 0x4E, 0x42, 0xF7, 0xDE, 0xAB,
+    0x45, 0x1F, 0xB9, 0xE4, 0x88, 0x0B, 0x23, 0x26, 0xB9, 0x89, 0xDA, 0x27, 0x76, 0xBA, 0xE0, 0x59,
+    0xB0, 0x71, 0xC4, 0x64, 0x17, 0x75, 0xE9, 0x8B, 0x6A, 0xE6, 0xA8, 0x16, 0x7E, 0x23, 0x0B, 0x1B,
+    0xDF, 0x70, 0x04, 0xFA, 0xEB, 0x81, 0x65, 0x77, 0x0A, 0x7F, 0x7D, 0x04, 0xB8, 0xF9, 0x84, 0x51,
+    0xE2, 0xF8, 0x9D, 0xB7, 0xC6, 0x80, 0x0B, 0xD8, 0xB8, 0xC6, 0x5E, 0x4E, 0xBE, 0x65, 0xAF, 0x0D,
+    0xDF, 0x9F, 0x28, 0x11, 0x4E, 0xC3, 0xC7, 0x5B, 0x7E, 0xBA, 0x99, 0xF9, 0x5F, 0x29, 0xFB, 0x45,
+    0xFD, 0xDF, 0x9B, 0xBF, 0x79, 0x7C, 0xA9, 0x0F, 0x48, 0x18, 0x4C, 0xE3, 0xC8, 0x60, 0x0A, 0x0B,
+    0x43, 0x97, 0x68, 0x6B, 0x85, 0x6C, 0xFB, 0xA8, 0x57, 0x37, 0xCB, 0x2C, 0x36, 0x98, 0x44, 0x73,
+    0x74, 0x89, 0xEA, 0xE9, 0xA3, 0x2A, 0x23, 0x7D, 0xD4, 0x65, 0xC0, 0x4E, 0x26, 0x6F, 0x58, 0x2B,
+    0x47, 0xBD, 0x45, 0xC5, 0x4E, 0x26, 0x33, 0xAF, 0x27, 0x8F, 0x87, 0x99, 0x8A, 0x2A, 0x7D, 0xA4,
+    0x8B, 0x1B, 0xB0, 0x77, 0x0A, 0x6C, 0x5C, 0x80, 0xBA, 0x80, 0xFE, 0x45, 0x84, 0xFE, 0x5F, 0x80,
+    0x3F, 0x2F, 0xC0, 0x38, 0x9D, 0x2C, 0xCE, 0xE4, 0x53, 0x94, 0x50, 0x57, 0x3B, 0x88, 0xCF, 0x2C,
+    0xA0, 0x24, 0x41, 0xD7, 0x7E, 0xC7, 0xEF, 0x4E, 0x19, 0xBC, 0x9D, 0x1C, 0x54, 0x95, 0xD3, 0x0F,
+    0xCF, 0x1B, 0x5C, 0x48, 0x63, 0xFC, 0xE5, 0x07, 0xD9, 0xA6, 0xAD, 0xBF, 0x5D, 0xFB, 0xB8, 0x8C,
+    0xB4, 0xEE, 0xDD, 0x64, 0xC3, 0x6E, 0x56, 0xA5, 0xFB, 0x59, 0xF4, 0x6C, 0x17, 0x93, 0xFB, 0x47,
+    0x71, 0xA0, 0xCD, 0x26, 0x79, 0x93, 0xB7, 0x5D, 0xF6, 0x8F, 0xFE, 0x63, 0x61, 0x2F, 0x47, 0x94,
+    0x1C, 0xAF, 0xED, 0x72, 0x74, 0xB9, 0xDA, 0xDC, 0xA4, 0x53, 0x84, 0xEC, 0x23, 0x70, 0x9F, 0x2F,
+    0xE1, 0x71, 0xC1, 0x24, 0x37, 0x31, 0xDB, 0x88, 0xB3, 0x71, 0x4D, 0xD8, 0x17, 0x09, 0xEC, 0xC9,
+    0xBA, 0xCD, 0x11, 0xCC, 0xD3, 0x88, 0x2E, 0x15, 0x5D, 0x3D, 0xAA, 0x9A, 0xA4, 0x1A, 0x33, 0x0B,
+    0x2E, 0x5C, 0x97, 0x9A, 0xF2, 0x07, 0xA5, 0x26, 0x5D, 0x97, 0x9A, 0x07, 0x46, 0x9A, 0xBC, 0x2C,
+    0x2F, 0x1D, 0x08, 0xAA, 0xAC, 0x48, 0x86, 0xAB, 0x5D, 0xC2, 0xE7, 0xD0, 0xFF, 0x50, 0xD8, 0x0D,
+    0xF4, 0xEF, 0x26, 0x96, 0x2D, 0xF6, 0xDB, 0x51, 0xD7, 0x99, 0x8B, 0x3E, 0xBA, 0x72, 0xF1, 0xFD,
+    0x0F, 0x8C, 0xFC, 0x22, 0xDF, 0xB8, 0xB7, 0x59, 0x9D, 0x60, 0x5E, 0xBB, 0xD7, 0x58, 0x61, 0xDC,
+    0xE7, 0x8B, 0x5D, 0x54, 0xF5, 0x8A, 0x01, 0xF6, 0x63, 0x06, 0xB4, 0x67, 0x0C, 0x88, 0xAA, 0xFA,
+    0xAB, 0xB5, 0x8F, 0xE6, 0xC4, 0x80, 0x1D, 0x3E, 0xF4, 0x69, 0xCB, 0x18, 0x6C, 0xDC, 0xB2, 0x0F,
+    0x63, 0xBC, 0x6B, 0xDE, 0x9B, 0x9E, 0xC6, 0x51, 0xFE, 0x52, 0x1E, 0x4D, 0x6E, 0x31, 0x47, 0x1B,
+    0x08, 0x7C, 0x1A, 0xFE, 0x58, 0x4F, 0x79, 0x77, 0x71, 0x8B, 0x39, 0x9A, 0x85, 0xC0, 0xA7, 0x59,
+    0xE0, 0x44, 0x89, 0x53, 0x4F, 0x4E, 0xC1, 0x95, 0x2F, 0xBD, 0x0D, 0x17, 0x47, 0xF8, 0xDB, 0xCB,
+    0xD3, 0x1A, 0x5E, 0xFD, 0x2D, 0x78, 0x3C, 0x06, 0x44, 0xB2, 0x7A, 0xF2, 0x72, 0xD5, 0x85, 0x45,
+    0x17, 0xE6, 0xD3, 0xB9, 0xA9, 0x66, 0x0A, 0x22, 0x09, 0x2F, 0x01, 0x5E, 0x41, 0xDF, 0x83, 0x2F,
+    0x9A, 0x04, 0x9B, 0x2E, 0xC2, 0xB6, 0x8F, 0x30, 0xDB, 0x09, 0x16, 0x1B, 0xA0, 0x39, 0xC9, 0x54,
+    0x2F, 0x8B, 0x2A, 0xFE, 0xAB, 0x7B, 0x5D, 0x06, 0xBC, 0xC9, 0x03, 0xEE, 0x4E, 0x1E, 0x70, 0x26,
+    0x0D, 0x8C, 0x5D, 0xF4, 0xE1, 0x41, 0x1F, 0xAD, 0x2C, 0x76, 0x32, 0x92, 0x6D, 0xE0, 0xB3, 0x80,
+    0x9E, 0x56, 0x13, 0x82, 0x11, 0xEC, 0x84, 0x49, 0xA8, 0xA7, 0x47, 0xF6, 0x52, 0xC7, 0xAF, 0xEE,
+    0xED, 0xD4, 0xFD, 0x38, 0x51, 0x2B, 0xBB, 0x01, 0x6F, 0xA3, 0x7B, 0x5D, 0x24, 0x5E, 0x39, 0xEA,
+    0xFE, 0x9E, 0x96, 0x23, 0xDF, 0x7A, 0x2D, 0xC1, 0x02, 0x6E, 0xA5, 0x67, 0xB5, 0x72, 0x30, 0x22,
+    0x81, 0x3E, 0x62, 0x0A, 0x34, 0x58, 0x3E, 0xC5, 0xC1, 0xC8, 0x01, 0x39, 0x40, 0x00, 0xEE, 0x73,
+    0xF3, 0x7D, 0x6C, 0xB0, 0x92, 0x55, 0x31, 0x1F, 0x5E, 0x04, 0xCF, 0xC2, 0xA2, 0x8B, 0x0B, 0x5D,
+    0x1C, 0x4C, 0x61, 0x63, 0xF2, 0x0E, 0x93, 0x2E, 0x24, 0xB2, 0xEB, 0x65, 0xA1, 0x8F, 0x4B, 0x1F,
+    0x99, 0xED, 0x34, 0x63, 0xA7, 0xDA, 0x47, 0x55, 0x1C, 0x5B, 0x46, 0x5D, 0x4C, 0xB1, 0x71, 0xC0,
+    0x49, 0x35, 0x6B, 0x3A, 0x80, 0x4F, 0x03, 0xEA, 0xED, 0x7F, 0x66, 0x94, 0x85, 0xE3, 0xDB, 0x4D,
+    0x57, 0x9A, 0xC9, 0x54, 0x93, 0x57, 0xCF, 0x52, 0x07, 0x93, 0xD9, 0x4B, 0xC2, 0x4B, 0xE4, 0x6E,
+    0x17, 0x59, 0xFA, 0x68, 0x8A, 0x9D, 0x6C, 0xB4, 0xC1, 0x07, 0xC7, 0x03, 0xFC, 0xBA, 0xAD, 0xC8,
+    0x5B, 0x06, 0x1B, 0x75, 0xFC, 0xC6, 0xB3, 0x74, 0x56, 0x4F, 0x11, 0x2A, 0x5C, 0xD2, 0xDC, 0x64,
+    0xEF, 0x14, 0x5D, 0x06, 0x75, 0xEC, 0x44, 0xA6, 0xBD, 0x4C, 0xFD, 0x4A, 0xE7, 0x3E, 0xC2, 0x0E,
+    0x4C, 0xD5, 0x93, 0x93, 0x76, 0x15, 0xA1, 0x7E, 0x0B, 0xBD, 0xBD, 0x5F, 0x8C, 0x25, 0xD5, 0x9D,
+    0xE7, 0xF9, 0x39, 0x71, 0xAA, 0x2A, 0x6C, 0xC2, 0x70, 0xAA, 0xA5, 0x62, 0x06, 0x53, 0x40, 0x58,
+    0x2B, 0x3F, 0x54, 0xA3, 0xA2, 0x02, 0x69, 0x79, 0xA8, 0x96, 0xF2, 0x46, 0x1C, 0x28, 0x4D, 0x7B,
+    0xD4, 0xEC, 0xCA, 0xD9, 0x1A, 0xD2, 0x48, 0x6B, 0x69, 0x40, 0x1A, 0x3F, 0xB8, 0x7B, 0x66, 0xB6,
+    0x78, 0x60, 0xA4, 0xF2, 0xE8, 0xDE, 0xBC, 0x01, 0xB5, 0x23, 0x1E, 0xBC, 0x5A, 0xE7, 0xB6, 0xDA,
+    0xBD, 0x7F, 0xD5, 0x43, 0x4B, 0x3C, 0xE0, 0xB4, 0x66, 0xE1, 0xA1, 0x1E, 0x6A, 0x66, 0xA2, 0xEA,
+    0x1E, 0x60, 0x67, 0x2C, 0xB5, 0x47, 0xEA, 0x83, 0x69, 0x84, 0x34, 0xBD, 0xBB, 0x84, 0x0D, 0x0C,
+    0xD3, 0xB6, 0x34, 0x75, 0xC0, 0xE1, 0x26, 0xCA, 0xC4, 0xBD, 0xBF, 0x7D, 0x38, 0x71, 0x6F, 0x66,
+    0x01, 0x8D, 0xDD, 0x6D, 0xC3, 0x95, 0xB2, 0x32, 0x33, 0x22, 0x32, 0xCE, 0xEF, 0x77, 0xFE, 0xFC,
+    0xFE, 0x7E, 0x7F, 0xBF, 0xE2, 0x0C, 0xB9, 0x4B, 0x03, 0x1D, 0x00, 0xC7, 0x48, 0x1C, 0x81, 0x2D,
+    0xEE, 0x22, 0xB3, 0xDA, 0xAB, 0x40, 0x43, 0x85, 0xA9, 0x53, 0x9F, 0x74, 0x0C, 0x54, 0x1C, 0xB5,
+    0x00, 0xF0, 0x38, 0xDC, 0x03, 0xC5, 0x33, 0x2C, 0x04, 0xF9, 0x4A, 0xBD, 0x84, 0x5D, 0xA8, 0x20,
+    0xB7, 0x64, 0x8E, 0x24, 0xC0, 0x00, 0x15, 0x98, 0xF8, 0xCB, 0x9C, 0xE3, 0xD9, 0x6A, 0x60, 0xB1,
+    0x42, 0xFF, 0x39, 0xB4, 0xF0, 0x38, 0x1C, 0x61, 0xFD, 0x59, 0x74, 0x30, 0x97, 0x16, 0xE3, 0x4F,
+    0x93, 0x04, 0xA0, 0x04, 0x52, 0x0F, 0x4C, 0x81, 0xCC, 0x01, 0x3D, 0x60, 0x6A, 0xA8, 0x64, 0x49,
+    0x2A, 0xE2, 0xD0, 0xEB, 0xE7, 0xF4, 0xFA, 0x39, 0x53, 0x43, 0x12, 0x40, 0x5D, 0xD9, 0xD9, 0xB1,
+    0x95, 0x48, 0xAF, 0x45, 0xC4, 0x1E, 0x47, 0xDD, 0x75, 0xD3, 0x1F, 0xBC, 0x22, 0x12, 0xAA, 0x87,
+    0xBB, 0x9C, 0x7B, 0x32, 0xAB, 0x5F, 0x72, 0x84, 0x4B, 0x6C, 0xDD, 0xC5, 0x5D, 0xBA, 0xCD, 0x13,
+    0x91, 0x1F, 0xFE, 0xD5, 0x6A, 0xF7, 0x0B, 0x24, 0xA4, 0x0E, 0xF3, 0x44, 0x20, 0x73, 0x13, 0x52,
+    0x6F, 0x6A, 0xDD, 0x26, 0x21, 0x09, 0x6C, 0xA9, 0x0E, 0x63, 0x7B, 0x92, 0xB6, 0x81, 0xE9, 0x14,
+    0x4C, 0x09, 0x5A, 0xA0, 0x92, 0x15, 0xB9, 0x88, 0x25, 0x75, 0x71, 0xE0, 0xFD, 0xD5, 0xB3, 0x54,
+    0xB2, 0xE2, 0xE8, 0x23, 0x3B, 0x6C, 0x2E, 0xD2, 0x03, 0xEA, 0xED, 0x3F, 0xFE, 0xC6, 0xDB, 0x7F,
+    0xFC, 0x8D, 0xB7, 0xFF, 0x18, 0x80, 0xBB, 0xE2, 0xCF, 0xDF, 0x68, 0x81, 0x13, 0x50, 0x48, 0xAD,
+    0x57, 0x0B, 0x0A, 0x8E, 0xD0, 0x83, 0x0E, 0x90, 0x76, 0x90, 0x2D, 0x61, 0xB1, 0x22, 0x73, 0x4B,
+    0xA6, 0x0C, 0x49, 0x50, 0x21, 0x73, 0x59, 0x9D, 0xD7, 0x13, 0x8A, 0xD7, 0x3C, 0xF9, 0x12, 0xB2,
+    0x2E, 0x3E, 0xAD, 0x1D, 0xE4, 0x7C, 0x41, 0x0D, 0x88, 0xB8, 0x44, 0xFA, 0x71, 0x52, 0x73, 0xFD,
+    0x17, 0x2F, 0x74, 0x7B, 0x5F, 0x1C, 0x7F, 0x2B, 0xA4, 0x86, 0xE2, 0xAD, 0xE7, 0x6A, 0x4C, 0x4D,
+    0x61, 0xB5, 0x87, 0x09, 0x21, 0x59, 0xD9, 0x70, 0xA7, 0x92, 0x21, 0xBD, 0xE8, 0x4A, 0x65, 0x4F,
+    0x9F, 0xCD, 0x1C, 0xEA, 0x35, 0xDB, 0xC1, 0x2D, 0xCF, 0x1B, 0xE0, 0x7D, 0x02, 0x98, 0xE7, 0x0D,
+    0xF0, 0x9E, 0xED, 0xE0, 0x96, 0xB3, 0x59, 0x8D, 0x7A, 0xC5, 0xCD, 0xE0, 0xF4, 0x3D, 0x89, 0x0C,
+    0xDA, 0x85, 0x54, 0x6C, 0x48, 0x1D, 0x4C, 0xC8, 0x2D, 0x79, 0x4D, 0xF5, 0xED, 0xF3, 0x1E, 0xCE,
+    0x8B, 0x07, 0x8E, 0x8E, 0x43, 0xFF, 0x8F, 0xE6, 0xB9, 0x17, 0xFD, 0x85, 0xB3, 0xE9, 0x53, 0xF6,
+    0xF1, 0xE7, 0xB3, 0x8C, 0x70, 0xA9, 0xD4, 0xFF, 0xC5, 0xE7, 0x7F, 0x9F, 0x9D, 0x9D, 0x9D, 0x2F,
+    0x8B, 0xC8, 0x42, 0x24, 0x40, 0x0E, 0xEA, 0x86, 0x6F, 0xD8, 0x4A, 0x8C, 0xBC, 0xB0, 0xB3, 0xFD,
+    0xB1, 0x1C, 0x14, 0xD7, 0x09, 0x77, 0x6A, 0xE9, 0xD3, 0x8B, 0x6E, 0x92, 0xB9, 0xD3, 0x67, 0xB5,
+    0x9F, 0xA8, 0xD7, 0xEC, 0x44, 0xFB, 0x5B, 0x9E, 0xD7, 0x7E, 0xCA, 0xFB, 0x54, 0x62, 0xCD, 0xF3,
+    0x5A, 0x3C, 0xEF, 0xD9, 0x49, 0xCE, 0x2D, 0x67, 0xB5, 0xEF, 0xD5, 0x2B, 0x6E, 0x92, 0xBA, 0xD3,
+    0xF7, 0x68, 0x5F, 0x6A, 0x17, 0x26, 0x74, 0xBF, 0x88, 0x83, 0x4C, 0xE4, 0xA7, 0x22, 0x1D, 0x30,
+    0x6F, 0xF3, 0xE7, 0x5E, 0x72, 0x67, 0x2E, 0xF0, 0x5E, 0x6D, 0x2E, 0xF0, 0x86, 0x9F, 0x18, 0xA9,
+    0x8B, 0x3D, 0x8E, 0x02, 0x01, 0xCC, 0xE1, 0x6F, 0x3B, 0xE7, 0x77, 0x1E, 0x11, 0x91, 0xFD, 0xE7,
+    0xF6, 0x9F, 0xFE, 0xD0, 0x3D, 0x6E, 0x02, 0x40, 0xE2, 0x87, 0xAB, 0x76, 0x3E, 0x24, 0x49, 0xCB,
+    0x5D, 0x24, 0x9E, 0x29, 0x86, 0x34, 0x9E, 0xBC, 0x33, 0x64, 0xD2, 0x2D, 0x04, 0x75, 0x95, 0xC5,
+    0xA0, 0x12, 0xCF, 0x5D, 0x68, 0xF7, 0x77, 0x3A, 0x3D, 0xA0, 0x02, 0x69, 0xCD, 0x05, 0x6B, 0x1E,
+    0xFC, 0x49, 0x38, 0xDF, 0x03, 0x6C, 0x1B, 0xD7, 0xA4, 0x6E, 0x8A, 0x85, 0xDF, 0x24, 0xA9, 0xB5,
+    0xA7, 0x61, 0x86, 0x71, 0x99, 0xA3, 0xA7, 0xC1, 0x58, 0x53, 0xAB, 0x40, 0x47, 0x41, 0x8E, 0x6E,
+    0x93, 0xC0, 0x84, 0x8A, 0xD4, 0xEB, 0x96, 0x81, 0x09, 0x85, 0x4B, 0x7D, 0xDA, 0xB3, 0x48, 0xAE,
+    0x59, 0x23, 0x7D, 0xE0, 0xBD, 0x95, 0x21, 0x3F, 0x12, 0xD7, 0x82, 0x02, 0xD0, 0x2D, 0x30, 0x21,
+    0xEE, 0x6B, 0x9A, 0xF5, 0xC9, 0x55, 0x22, 0x43, 0x26, 0x32, 0xE4, 0xD2, 0x9F, 0x2E, 0xA4, 0x3F,
+    0x5D, 0x7D, 0xCC, 0x57, 0x2E, 0xFD, 0x69, 0x23, 0xFD, 0xE9, 0x44, 0xFA, 0xD3, 0x1C, 0xBD, 0x70,
+    0x1A, 0xCE, 0xFE, 0x92, 0x5F, 0x5F, 0xBC, 0xED, 0xB6, 0xFC, 0xFB, 0xEF, 0xF6, 0x27, 0xD0, 0xEE,
+    0x4E, 0xAE, 0xB2, 0xC5, 0x3B, 0xCF, 0x3D, 0xD5, 0xC1, 0xD3, 0xF9, 0x8B, 0x72, 0xD7, 0x85, 0xC4,
+    0x1B, 0xB6, 0x54, 0xC8, 0xEA, 0x7B, 0x08, 0xDA, 0xDD, 0x05, 0xB0, 0xB0, 0x3F, 0xEF, 0x2E, 0xDD,
+    0x72, 0x56, 0xFF, 0xBF, 0xBC, 0x67, 0x7F, 0xCB, 0xDF, 0x79, 0xC1, 0x98, 0x6B, 0xEC, 0xC2, 0x6D,
+    0xA8, 0x90, 0x06, 0x8C, 0x5D, 0x38, 0xFA, 0xF4, 0x8F, 0xC9, 0x1C, 0x97, 0x98, 0xA2, 0xBD, 0xF6,
+    0x18, 0xCE, 0xC0, 0x96, 0x0A, 0xA8, 0xD6, 0xF0, 0x74, 0x66, 0x3B, 0xE3, 0xB6, 0xB2, 0x7A, 0x41,
+    0x98, 0xA6, 0x97, 0xF5, 0x45, 0xF7, 0xCF, 0x3D, 0x13, 0xFD, 0x67, 0x24, 0xED, 0xD6, 0x16, 0xB9,
+    0x76, 0x2D, 0xA1, 0x78, 0xAE, 0x35, 0x56, 0xC4, 0x5D, 0x86, 0x90, 0x3A, 0xB4, 0xDB, 0x82, 0x5B,
+    0xE0, 0x36, 0x08, 0xCC, 0xA1, 0x63, 0xE1, 0xB8, 0xCC, 0x37, 0x5A, 0xA6, 0x70, 0x89, 0x2D, 0x98,
+    0x30, 0x21, 0x0E, 0xA3, 0x5D, 0x0E, 0xAA, 0x35, 0xC7, 0x7A, 0x2E, 0x99, 0x2F, 0x8B, 0xDB, 0xCA,
+    0x9E, 0xB0, 0xC1, 0xA4, 0x8E, 0x2D, 0x7D, 0xD1, 0x61, 0xD0, 0x9E, 0xAC, 0x4E, 0x5A, 0x32, 0xA7,
+    0x02, 0x99, 0x23, 0x90, 0xD5, 0x74, 0x98, 0x9A, 0xCB, 0x18, 0xCB, 0x14, 0x23, 0x61, 0x0B, 0x2D,
+    0x03, 0x6A, 0x61, 0x49, 0xEB, 0xF9, 0x12, 0x42, 0xA2, 0x5A, 0x26, 0x70, 0x0B, 0x59, 0x4D, 0xE2,
+    0x55, 0xE0, 0xD6, 0x9E, 0x2D, 0x92, 0x25, 0xC6, 0xA2, 0xBA, 0xA4, 0x05, 0xED, 0xA6, 0x49, 0xCD,
+    0x96, 0x61, 0x20, 0xBB, 0xE8, 0xAB, 0xA7, 0x7E, 0x12, 0x2E, 0x67, 0x97, 0x8A, 0x3E, 0x4F, 0x5E,
+    0x07, 0xED, 0x2F, 0x04, 0xE8, 0x6F, 0xB9, 0x05, 0xCE, 0xE8, 0x17, 0x5A, 0x52, 0xB7, 0x5A, 0xD4,
+    0x74, 0x46, 0x06, 0x4A, 0xD8, 0x22, 0x73, 0xA4, 0xB5, 0x0A, 0xF0, 0x78, 0x14, 0xB6, 0x4B, 0xD4,
+    0x10, 0x45, 0x1B, 0x00, 0x4F, 0xA3, 0x5A, 0xB4, 0xC7, 0x38, 0xE6, 0xA8, 0x81, 0xAC, 0x25, 0xAF,
+    0x29, 0x61, 0x0A, 0x0D, 0x34, 0xB0, 0xCB, 0x17, 0xAA, 0x9F, 0xF4, 0xB9, 0x74, 0xEA, 0x3B, 0x80,
+    0xB2, 0x27, 0x20, 0xEF, 0xB6, 0xA0, 0x94, 0x0E, 0x1E, 0xCF, 0x5B, 0x38, 0xAE, 0x36, 0x9B, 0xAA,
+    0x03, 0x74, 0x0F, 0x64, 0x3D, 0x60, 0x1A, 0xA0, 0x98, 0x02, 0x93, 0x29, 0x30, 0x6C, 0x81, 0xEA,
+    0x26, 0xA0, 0xC3, 0x04, 0x52, 0x5F, 0x82, 0xA9, 0x4B, 0xC8, 0x29, 0xA0, 0x12, 0x81, 0x85, 0x08,
+    0xAC, 0xF6, 0x9F, 0x23, 0x09, 0xE4, 0x56, 0xB7, 0x18, 0x6B, 0x1C, 0xA6, 0xCE, 0x6B, 0x4C, 0x5D,
+    0x81, 0x71, 0xB3, 0x51, 0xAB, 0x5C, 0x06, 0xDE, 0x77, 0xF0, 0xD8, 0x59, 0x38, 0x7D, 0x0B, 0xA4,
+    0x4F, 0x59, 0x58, 0xD4, 0xA0, 0x0E, 0x93, 0xB2, 0x22, 0x5E, 0x2C, 0x43, 0xA4, 0xC3, 0x3C, 0x02,
+    0xE6, 0x25, 0x47, 0xEA, 0x3B, 0x74, 0x98, 0xA0, 0x3A, 0x53, 0xD3, 0xEB, 0x96, 0x29, 0x0D, 0x95,
+    0x08, 0x85, 0x88, 0x33, 0x3F, 0xDE, 0x0F, 0x99, 0x63, 0xA6, 0x5B, 0xCC, 0xB9, 0x80, 0xFE, 0x61,
+    0x0F, 0xFD, 0x00, 0xD5, 0x7A, 0xEC, 0x42, 0x64, 0x00, 0xAA, 0xF8, 0x6D, 0xB9, 0xDC, 0x79, 0x08,
+    0x54, 0xD7, 0x03, 0xE8, 0x1F, 0x76, 0x00, 0xE6, 0xC5, 0x00, 0x90, 0x3F, 0x10, 0x00, 0x2A, 0xDD,
+    0x02, 0x34, 0xDA, 0x03, 0xAA, 0x4F, 0x45, 0x6A, 0x74, 0xC8, 0x44, 0x6A, 0x32, 0x6F, 0x5E, 0xDD,
+    0x81, 0x5C, 0xA4, 0x8E, 0x6F, 0xB4, 0xC0, 0xD5, 0xFD, 0x05, 0x40, 0x1F, 0x8F, 0x6F, 0xA0, 0x8A,
+    0x3A, 0xB5, 0x04, 0x8C, 0x63, 0x77, 0xE7, 0x21, 0x0A, 0x98, 0xCB, 0xC0, 0x2E, 0x2C, 0x64, 0x80,
+    0x5C, 0xF6, 0x60, 0x21, 0x3D, 0xFA, 0x67, 0xE7, 0x7B, 0x4C, 0x9D, 0x76, 0xCC, 0xD0, 0x21, 0x09,
+    0x64, 0x2E, 0x73, 0xE4, 0xB6, 0x84, 0x92, 0x0E, 0xFA, 0xAF, 0xBE, 0xB5, 0xAD, 0xDF, 0x10, 0xA9,
+    0xF3, 0x2F, 0xCB, 0x92, 0x2B, 0xBA, 0x45, 0x07, 0x63, 0x31, 0xF5, 0x14, 0xAE, 0x24, 0x81, 0x34,
+    0x98, 0x9A, 0x39, 0x25, 0x59, 0xA7, 0xAE, 0x7F, 0x45, 0x6C, 0x2A, 0xD2, 0x52, 0xC8, 0x9B, 0x00,
+    0x27, 0xB0, 0xE8, 0x55, 0x06, 0x85, 0xF4, 0xD0, 0xCE, 0xDD, 0x66, 0xAA, 0xA1, 0x58, 0x59, 0x32,
+    0x91, 0x1A, 0xB9, 0x7F, 0x51, 0x9B, 0x96, 0x8A, 0xAB, 0xB0, 0xAB, 0x03, 0x0C, 0x85, 0x45, 0x87,
+    0x01, 0xB2, 0xEF, 0xB5, 0x50, 0x14, 0x16, 0x9A, 0x06, 0xF4, 0x4F, 0x03, 0x98, 0x3F, 0x73, 0xB0,
+    0x5B, 0x41, 0xD2, 0x0D, 0xE3, 0x9C, 0x5D, 0x4D, 0x5B, 0x74, 0x30, 0x9E, 0xB9, 0xCD, 0xDB, 0xAC,
+    0xA7, 0x10, 0xB1, 0x64, 0xD2, 0x02, 0xDB, 0x70, 0x02, 0x95, 0x3A, 0xA6, 0x15, 0x79, 0x3D, 0xA4,
+    0xAD, 0x7E, 0xA7, 0xC7, 0xAC, 0xA0, 0xAA, 0x49, 0x07, 0xD4, 0xFB, 0x81, 0x5D, 0xE3, 0xF2, 0xBA,
+    0x4A, 0x5B, 0x86, 0x53, 0xE8, 0xD1, 0xDC, 0xE1, 0x33, 0xB0, 0xE8, 0x4B, 0x32, 0x91, 0x81, 0xCA,
+    0x17, 0x81, 0x15, 0x59, 0x48, 0x7A, 0xF2, 0x5E, 0x07, 0xCA, 0x21, 0xF3, 0x0C, 0x8D, 0x71, 0x49,
+    0x68, 0x72, 0x9B, 0xFA, 0xA6, 0x20, 0xAF, 0x9B, 0x82, 0x92, 0xA1, 0x62, 0x60, 0xA8, 0x92, 0x40,
+    0x5F, 0xA5, 0x3E, 0xE9, 0xAA, 0xBC, 0xD6, 0xA1, 0xD8, 0x25, 0x6D, 0xF3, 0x01, 0xE3, 0x4C, 0xA0,
+    0xB2, 0x59, 0x9F, 0xAC, 0xC8, 0x45, 0x3A, 0xCA, 0x42, 0x6A, 0x4E, 0xB3, 0xBD, 0x99, 0x91, 0xA3,
+    0x16, 0x8C, 0x83, 0x2A, 0xCA, 0xDC, 0xA4, 0x05, 0x15, 0x29, 0x9A, 0x40, 0x53, 0xA2, 0xFA, 0x02,
+    0x1D, 0x72, 0x32, 0x6F, 0xAC, 0xA9, 0x4D, 0x5D, 0x91, 0xB9, 0x86, 0xD4, 0xF5, 0xE8, 0x57, 0x02,
+    0xFA, 0x27, 0x8E, 0x44, 0x2C, 0x4A, 0x80, 0x61, 0x34, 0x45, 0xBA, 0x28, 0xD4, 0x93, 0x10, 0x65,
+    0xBA, 0x6E, 0xA3, 0xA5, 0x95, 0xB9, 0x78, 0xB0, 0x93, 0x10, 0x0D, 0xA9, 0x12, 0x94, 0x88, 0xCD,
+    0x44, 0xEA, 0x82, 0x39, 0x3D, 0xBB, 0xDA, 0x33, 0xE4, 0xE8, 0xD0, 0x60, 0x2E, 0x06, 0x66, 0xA6,
+    0xD6, 0x61, 0xC2, 0xFC, 0xFE, 0x95, 0xF4, 0x99, 0xAC, 0xA8, 0x76, 0xA0, 0x8F, 0xAF, 0xCA, 0x0F,
+    0x14, 0xC4, 0x51, 0x80, 0xC5, 0x12, 0x10, 0xF1, 0x70, 0x85, 0x01, 0x4A, 0x72, 0xC8, 0xC9, 0x1C,
+    0x99, 0x4B, 0x5B, 0x74, 0x9B, 0x06, 0xE8, 0xB2, 0x16, 0xA6, 0xA6, 0x85, 0x22, 0xF5, 0xE3, 0x2A,
+    0xEA, 0xB6, 0x01, 0x3A, 0xE3, 0x61, 0xAA, 0x96, 0x50, 0x60, 0x3C, 0xC6, 0x31, 0xA0, 0x5B, 0x0A,
+    0xE8, 0xC8, 0x1C, 0x53, 0x74, 0xA0, 0x38, 0x91, 0xF4, 0x98, 0x6F, 0xCA, 0x80, 0xF6, 0xD2, 0xA3,
+    0x3A, 0x65, 0x47, 0x12, 0x2A, 0x46, 0xC3, 0x90, 0xDC, 0x01, 0x0B, 0x0F, 0x14, 0x3E, 0x1E, 0x6D,
+    0x7B, 0x82, 0xBC, 0x3B, 0x4B, 0x29, 0x1D, 0x8F, 0xE7, 0xED, 0x46, 0xFE, 0x9C, 0x6C, 0x4F, 0xB1,
+    0x18, 0xA6, 0x7A, 0xF9, 0x48, 0x9F, 0xB5, 0x69, 0x67, 0x9C, 0x0E, 0x05, 0x3A, 0x54, 0xE8, 0xB6,
+    0x44, 0xB7, 0x33, 0x52, 0xDF, 0x90, 0xB9, 0x06, 0xE3, 0x1A, 0x8A, 0x7A, 0xCA, 0xDC, 0x56, 0xC9,
+    0x35, 0x5B, 0xC8, 0xB7, 0xC8, 0x96, 0x39, 0x58, 0xA2, 0x60, 0xD1, 0xD7, 0x20, 0xD3, 0x35, 0x99,
+    0xAE, 0x49, 0x9F, 0xB2, 0x24, 0x2B, 0xE0, 0xF8, 0xAF, 0x6F, 0x8C, 0x93, 0xFE, 0xD1, 0x85, 0xD5,
+    0xF2, 0xC6, 0xEB, 0x52, 0x57, 0x7F, 0x74, 0xAD, 0x9F, 0x27, 0xBD, 0x16, 0x66, 0xC6, 0x65, 0x41,
+    0x85, 0x86, 0xBC, 0x36, 0x2F, 0x05, 0x1A, 0xB5, 0x34, 0x36, 0x11, 0xF1, 0x33, 0x8C, 0x74, 0x49,
+    0x60, 0x17, 0x32, 0x97, 0xF4, 0x50, 0x90, 0xB7, 0x30, 0x45, 0x1C, 0xAA, 0xCF, 0x17, 0xEE, 0xF3,
+    0x5A, 0xDE, 0xBD, 0x26, 0x9D, 0x5E, 0x99, 0x5C, 0x6A, 0xEC, 0x7A, 0x9B, 0xA1, 0xDD, 0x59, 0xF4,
+    0x5F, 0xF5, 0x20, 0x1E, 0x25, 0x90, 0x5F, 0xAB, 0xB9, 0x2B, 0x75, 0x71, 0xE3, 0xA8, 0xC0, 0xC9,
+    0x3F, 0x09, 0x4A, 0x96, 0x21, 0xFD, 0xD9, 0xF9, 0x90, 0xD7, 0x59, 0xA8, 0xD0, 0x61, 0x82, 0x0E,
+    0x4D, 0xFC, 0x6A, 0x1B, 0x52, 0x1F, 0xB9, 0xC8, 0x6D, 0xC5, 0x55, 0x0A, 0xE9, 0x49, 0xC5, 0xC3,
+    0x09, 0xE0, 0x28, 0xC7, 0x91, 0x27, 0x5D, 0x26, 0x2B, 0xB6, 0x4C, 0xC0, 0xC6, 0x05, 0x50, 0x57,
+    0x2D, 0x85, 0x38, 0x7D, 0xFD, 0xBC, 0x2B, 0x6C, 0xFE, 0x44, 0x4F, 0x95, 0x39, 0x9A, 0x92, 0xE4,
+    0x9D, 0x8E, 0xEC, 0x7B, 0x8E, 0xAA, 0x80, 0xBE, 0x21, 0x7D, 0x39, 0x50, 0xA5, 0xAD, 0xEA, 0x8C,
+    0x2F, 0x6A, 0x23, 0x3D, 0x99, 0x8C, 0x24, 0xE7, 0x90, 0x74, 0x50, 0x58, 0xE2, 0x49, 0x3A, 0xBA,
+    0xB3, 0xF3, 0x90, 0x88, 0xBC, 0x2F, 0xB2, 0x5A, 0x9F, 0xAB, 0x0F, 0x3E, 0x72, 0x84, 0x63, 0x3F,
+    0xBF, 0x87, 0x42, 0x06, 0x56, 0x0F, 0x77, 0x49, 0xA7, 0x7B, 0xED, 0xCD, 0x90, 0xB9, 0xB2, 0x31,
+    0xB6, 0x99, 0xE6, 0x2A, 0x34, 0xB9, 0xF6, 0x4D, 0x61, 0x6C, 0x5F, 0x94, 0x84, 0xBC, 0x49, 0x82,
+    0x09, 0xA9, 0x37, 0x6D, 0x5E, 0x1B, 0x59, 0x51, 0x2E, 0x3A, 0xEE, 0xD8, 0x1C, 0x59, 0x6E, 0x05,
+    0xD4, 0xDA, 0x5D, 0x89, 0x7E, 0x8B, 0x3D, 0x58, 0x79, 0x6E, 0x87, 0x67, 0x99, 0x92, 0x7A, 0xD5,
+    0x51, 0xA1, 0xBD, 0xEA, 0x30, 0xB5, 0x71, 0x94, 0x4C, 0xA1, 0xD1, 0x2D, 0x49, 0x28, 0x20, 0x75,
+    0x3D, 0x98, 0xCC, 0xC1, 0x56, 0x09, 0xFC, 0x55, 0x00, 0xFD, 0xBA, 0x85, 0x6C, 0x00, 0x72, 0x0F,
+    0xCC, 0xD7, 0xDA, 0xC9, 0xD4, 0xE3, 0x79, 0x4B, 0xDB, 0xF1, 0xF2, 0x22, 0x10, 0x77, 0x5B, 0xFC,
+    0x6C, 0xBC, 0x90, 0x12, 0xC8, 0xED, 0x61, 0xD7, 0xA4, 0xA8, 0x99, 0xCC, 0x97, 0xE4, 0xB3, 0xF3,
+    0x2E, 0xEB, 0x93, 0x2E, 0x19, 0x98, 0x31, 0x60, 0x6C, 0x89, 0xF6, 0x39, 0xAA, 0xCB, 0x1C, 0x8D,
+    0x0E, 0x54, 0xF4, 0x98, 0xBA, 0x24, 0x73, 0xB9, 0x4B, 0xDB, 0xAC, 0x4F, 0x83, 0xFE, 0x89, 0x04,
+    0xBA, 0x45, 0xCB, 0x4C, 0x59, 0xF2, 0xD1, 0x49, 0xD3, 0x6D, 0x94, 0x2F, 0x4C, 0x47, 0xA3, 0x31,
+    0x4E, 0x2D, 0xDA, 0xF7, 0x90, 0x9F, 0x6B, 0xE1, 0xC4, 0xB1, 0x83, 0x79, 0xE2, 0x58, 0xCD, 0xDD,
+    0xE4, 0xA8, 0x8E, 0x19, 0xC6, 0xD1, 0x31, 0x43, 0xB7, 0x3A, 0x60, 0xEA, 0x1C, 0x0A, 0x7A, 0x68,
+    0x32, 0x87, 0x0A, 0x25, 0xE8, 0x17, 0x03, 0x18, 0x53, 0xC3, 0xA4, 0x01, 0xDE, 0xF3, 0x90, 0x08,
+    0xD1, 0x51, 0x8A, 0x27, 0x7B, 0xB6, 0xB6, 0x51, 0x8B, 0xF5, 0xF4, 0xE7, 0x0E, 0x8A, 0x61, 0x54,
+    0xDD, 0x80, 0x11, 0x8F, 0x92, 0x25, 0x1C, 0xDD, 0xB1, 0x87, 0x94, 0x7B, 0x55, 0x8F, 0x66, 0xC6,
+    0xFB, 0x2E, 0x6A, 0x77, 0xFD, 0x9A, 0x8B, 0x46, 0x46, 0x7E, 0xCE, 0x47, 0x1B, 0x63, 0xA6, 0x5B,
+    0x4C, 0x5D, 0xA2, 0x42, 0x12, 0xA8, 0x44, 0xC8, 0x44, 0x02, 0xAB, 0xFD, 0xE7, 0x28, 0x50, 0x9D,
+    0x6E, 0x31, 0x76, 0x80, 0x3E, 0xAF, 0x31, 0x17, 0x03, 0x0C, 0x51, 0xC3, 0x1B, 0xF1, 0x14, 0xE2,
+    0x37, 0xC3, 0xFD, 0x5A, 0xE4, 0xCA, 0x67, 0x78, 0x14, 0x2E, 0xA4, 0x35, 0xC8, 0x00, 0x4A, 0xFC,
+    0xA1, 0x9D, 0x45, 0x6E, 0x47, 0x63, 0x25, 0xEB, 0x89, 0xD6, 0x4A, 0xF2, 0x9E, 0x8B, 0xE6, 0x0A,
+    0xC3, 0x16, 0xA4, 0xBE, 0x83, 0x4A, 0xFB, 0x68, 0xB0, 0x98, 0xBA, 0x84, 0x29, 0x0D, 0x5A, 0x24,
+    0x50, 0x88, 0x38, 0x56, 0xFB, 0xCF, 0x91, 0x39, 0x66, 0x94, 0xD0, 0xE9, 0x80, 0x6E, 0xF3, 0x1A,
+    0x53, 0x0F, 0x50, 0xA5, 0x1E, 0x9A, 0x38, 0xFE, 0x5D, 0xAA, 0xC5, 0x88, 0x23, 0x95, 0xF5, 0xF1,
+    0xF9, 0x35, 0x31, 0xF7, 0xC9, 0x19, 0x5B, 0x69, 0x0D, 0x59, 0x3D, 0xEE, 0xFC, 0x16, 0xB8, 0x62,
+    0xC1, 0x44, 0x7B, 0xE0, 0x57, 0x26, 0x7D, 0x0B, 0x54, 0x1B, 0xDD, 0xF0, 0xD4, 0x41, 0xFA, 0xE7,
+    0xA0, 0x87, 0xF5, 0xBA, 0xDC, 0x0A, 0xE4, 0x75, 0x3C, 0xA5, 0xA6, 0x86, 0xCC, 0x1E, 0x18, 0x97,
+    0xA9, 0xBC, 0x49, 0x2E, 0x42, 0xF1, 0xE6, 0xDF, 0xAD, 0x0B, 0x17, 0x77, 0xAC, 0x71, 0xF1, 0x20,
+    0xEB, 0xF5, 0xA1, 0x9D, 0x8D, 0x7B, 0xDA, 0xB8, 0xF1, 0xE2, 0x30, 0xAA, 0xB5, 0xCC, 0x8D, 0x1B,
+    0xBD, 0xB2, 0x90, 0xF6, 0x6A, 0x8F, 0x85, 0xF4, 0xA4, 0xB2, 0x5C, 0xDB, 0x08, 0x47, 0x2D, 0xAA,
+    0x87, 0x12, 0x4C, 0x8D, 0xF6, 0x9B, 0x8D, 0xB2, 0xD8, 0x63, 0x21, 0x54, 0xAF, 0x3E, 0x9D, 0xB5,
+    0xD0, 0x43, 0x11, 0x4F, 0xCE, 0x2C, 0x92, 0xDF, 0xC4, 0x37, 0x37, 0x51, 0x97, 0x57, 0xF6, 0x0B,
+    0x4A, 0x04, 0x2D, 0x6D, 0x7C, 0xA9, 0xB2, 0xD1, 0x32, 0xD7, 0x02, 0xFA, 0x47, 0x2D, 0xDA, 0x4F,
+    0x58, 0x0B, 0xEE, 0x4F, 0x9A, 0x9F, 0x6D, 0x58, 0x81, 0x38, 0xFA, 0xCB, 0x74, 0xC6, 0x1E, 0x8F,
+    0x9B, 0xA6, 0x78, 0x73, 0x0C, 0x41, 0x5D, 0x85, 0x12, 0x0A, 0x30, 0x35, 0xA9, 0x47, 0x05, 0x68,
+    0xA0, 0x80, 0xCC, 0xA1, 0x3A, 0xA8, 0xEC, 0x17, 0x52, 0x19, 0xA8, 0x56, 0x71, 0xD3, 0x2A, 0x3B,
+    0x0A, 0xC1, 0x01, 0xF8, 0xFC, 0x21, 0xB1, 0x94, 0xCB, 0x1E, 0x73, 0x19, 0x58, 0xEC, 0xFD, 0x43,
+    0x16, 0xA3, 0x44, 0xAD, 0xD6, 0xAB, 0xB8, 0x56, 0x7C, 0xDD, 0x28, 0x73, 0xAB, 0x0F, 0x72, 0x52,
+    0xAC, 0x05, 0xF1, 0x12, 0xC8, 0xDB, 0x63, 0x36, 0x11, 0x69, 0xC9, 0xA5, 0x1B, 0x8D, 0xA1, 0x6D,
+    0x68, 0xA0, 0x82, 0x63, 0x76, 0x13, 0xFD, 0xDA, 0x4B, 0x64, 0xD0, 0xCB, 0xFF, 0x2E, 0xE9, 0xA1,
+    0x87, 0x06, 0x4A, 0xC8, 0x2D, 0x69, 0x0C, 0x9D, 0x45, 0x26, 0x52, 0x0F, 0x4B, 0xEA, 0x5C, 0x02,
+    0xD2, 0xC7, 0x09, 0xB1, 0x0A, 0xB6, 0x52, 0x47, 0xFA, 0x7D, 0x07, 0x32, 0xCE, 0xF7, 0x5A, 0x6F,
+    0x7F, 0xB2, 0x6B, 0x71, 0x1C, 0xAB, 0xDD, 0x94, 0xBC, 0x00, 0x71, 0xA4, 0x21, 0xEA, 0xF3, 0x5F,
+    0x71, 0x6F, 0x6D, 0x63, 0x49, 0xEB, 0xCB, 0x30, 0x29, 0x41, 0x49, 0x3D, 0x9E, 0xD0, 0x13, 0x07,
+    0x0C, 0xB1, 0x90, 0x1E, 0xF3, 0xEA, 0xA2, 0xA5, 0x67, 0x6E, 0x73, 0xCB, 0x90, 0x04, 0x32, 0x57,
+    0x44, 0x11, 0xAD, 0xDB, 0x09, 0x94, 0xA9, 0x8B, 0x86, 0xE3, 0xCC, 0x38, 0x32, 0xDF, 0xC3, 0x60,
+    0x2C, 0xE6, 0x89, 0x40, 0xD2, 0x15, 0x30, 0xD7, 0x2D, 0xB9, 0x2B, 0xC9, 0xBA, 0xF4, 0xAD, 0xAF,
+    0x2E, 0x99, 0xCB, 0x8A, 0x4C, 0xAE, 0x1F, 0x2C, 0xBE, 0xEA, 0xA6, 0x40, 0x6E, 0x2C, 0x24, 0xEF,
+    0x04, 0xA0, 0xDC, 0x02, 0xF4, 0x0F, 0x88, 0x5A, 0x4D, 0x5D, 0xCD, 0x1C, 0x2C, 0x86, 0x06, 0xAA,
+    0x6F, 0x4B, 0x4D, 0xD6, 0xA6, 0x1D, 0x0C, 0x54, 0x50, 0xA0, 0x03, 0x3A, 0x50, 0x42, 0x89, 0x6E,
+    0x49, 0x3D, 0x33, 0x68, 0xA2, 0x9D, 0xCB, 0x00, 0x0D, 0x45, 0x4D, 0xEA, 0xD2, 0x0E, 0xAA, 0xE4,
+    0x9A, 0x25, 0x91, 0x3E, 0x10, 0x45, 0xC8, 0x18, 0x0A, 0xFD, 0x54, 0x1C, 0xB0, 0x03, 0xCD, 0x97,
+    0xC3, 0x4D, 0xDF, 0xFD, 0x39, 0x88, 0x04, 0x8E, 0x3E, 0xFC, 0x26, 0x30, 0x8D, 0x0C, 0xCA, 0xD0,
+    0x50, 0xFD, 0xCF, 0x52, 0x67, 0x6D, 0xDA, 0xD1, 0x53, 0x51, 0xA0, 0x83, 0x0E, 0x94, 0x4C, 0xD0,
+    0x6D, 0xEA, 0x99, 0xD1, 0x44, 0x92, 0x06, 0x1A, 0x8A, 0x3A, 0x75, 0x59, 0x47, 0x95, 0x5C, 0xB3,
+    0x89, 0xF4, 0x21, 0x72, 0x74, 0x24, 0x2E, 0x59, 0x47, 0x26, 0x81, 0xA3, 0x63, 0x0C, 0x6F, 0x2E,
+    0x03, 0x0B, 0x19, 0x58, 0xEE, 0x3C, 0x44, 0x17, 0x89, 0x48, 0x0E, 0xBB, 0x22, 0x1E, 0x52, 0x91,
+    0x3A, 0x13, 0xB1, 0xE6, 0xD5, 0x9D, 0x28, 0x32, 0x6D, 0xF4, 0x27, 0x8A, 0xD1, 0x7C, 0x29, 0x81,
+    0xDD, 0x9D, 0x87, 0x36, 0xAF, 0xA2, 0x92, 0x3A, 0x97, 0x56, 0xC5, 0x11, 0x4E, 0xF6, 0x14, 0xE2,
+    0xAA, 0x3F, 0xE8, 0x0B, 0x5B, 0x9A, 0xDA, 0x7C, 0xD3, 0xA5, 0xAF, 0xB4, 0x27, 0x7F, 0x28, 0xD2,
+    0xCE, 0xA5, 0x2E, 0x36, 0x81, 0xE9, 0x19, 0x18, 0x7F, 0x4C, 0x89, 0xB8, 0x5C, 0x6A, 0x4E, 0x00,
+    0xC7, 0x38, 0x41, 0x6A, 0x2F, 0xA0, 0x25, 0xA0, 0xC4, 0x6D, 0xF6, 0xDC, 0x27, 0x41, 0xF0, 0x17,
+    0x55, 0xAD, 0xDD, 0x16, 0x95, 0x58, 0xC4, 0x8F, 0x8A, 0x8F, 0x93, 0x3D, 0x99, 0x04, 0x7D, 0xBD,
+    0xA8, 0xAF, 0xD0, 0x9B, 0xDA, 0x3C, 0x19, 0x54, 0x57, 0xAA, 0xAB, 0xA9, 0x48, 0x3D, 0x97, 0x3A,
+    0xF3, 0x9B, 0xA3, 0x33, 0x03, 0xDD, 0xA9, 0x3A, 0x97, 0x81, 0xF9, 0x6A, 0xA4, 0xF3, 0xE8, 0x38,
+    0x5C, 0x75, 0xA3, 0x20, 0xFB, 0x24, 0x88, 0x67, 0x1B, 0x66, 0x50, 0x58, 0x92, 0x7A, 0xBD, 0x95,
+    0x16, 0x75, 0x22, 0x83, 0xBE, 0x5E, 0x3C, 0xD9, 0xE9, 0xB6, 0xA7, 0x6F, 0x98, 0x95, 0xEA, 0x6A,
+    0x2E, 0xAB, 0x54, 0xFA, 0xA4, 0xBB, 0x51, 0x7C, 0x3D, 0x9A, 0xCB, 0xA0, 0x46, 0xF1, 0xF5, 0x49,
+    0x90, 0x97, 0xF8, 0xF8, 0xD0, 0x19, 0x60, 0x0B, 0x28, 0x6D, 0x34, 0x96, 0x95, 0xFD, 0xDB, 0xEC,
+    0x0D, 0xCF, 0xDF, 0xAD, 0x49, 0x1D, 0xDA, 0xA1, 0x02, 0x4C, 0x2C, 0x26, 0xC0, 0x71, 0x50, 0x1C,
+    0x41, 0xBB, 0x29, 0xC9, 0x8F, 0x42, 0x14, 0xBC, 0x73, 0x3E, 0xD1, 0x2D, 0x73, 0x9C, 0x6D, 0xED,
+    0x27, 0x98, 0xDC, 0xB2, 0xF0, 0xE8, 0x2E, 0x5A, 0x15, 0xA0, 0x16, 0x35, 0x0B, 0xA1, 0xFA, 0x83,
+    0x3E, 0xF3, 0xA6, 0xEE, 0xE9, 0x0B, 0xF2, 0x73, 0xED, 0xC9, 0x76, 0x2E, 0x7D, 0x2A, 0x3D, 0x57,
+    0x3E, 0x20, 0x6D, 0x6F, 0x53, 0x22, 0x2E, 0xDD, 0x68, 0xF2, 0xED, 0x51, 0xB7, 0xE5, 0x3D, 0xA4,
+    0xAF, 0x78, 0x54, 0xC8, 0xE1, 0xC4, 0xC6, 0x43, 0x8D, 0xFA, 0xC3, 0x65, 0xCB, 0xBF, 0xD7, 0x24,
+    0xCB, 0xF1, 0x51, 0xB3, 0x51, 0x0B, 0x6B, 0x6B, 0x7B, 0x06, 0x64, 0x4E, 0x49, 0x18, 0x28, 0xC4,
+    0x38, 0xF5, 0x70, 0x18, 0xA0, 0x34, 0x8E, 0xD4, 0x37, 0x30, 0x4D, 0x5B, 0x32, 0x57, 0x59, 0x7A,
+    0xB5, 0x22, 0xB7, 0xA9, 0x48, 0x88, 0xE2, 0x76, 0x34, 0x50, 0x00, 0xE3, 0xC1, 0x0C, 0x60, 0xBE,
+    0x59, 0x63, 0x6C, 0x40, 0xAD, 0xD3, 0x42, 0x27, 0xDB, 0x53, 0x54, 0x92, 0x53, 0xBD, 0x2A, 0x75,
+    0x51, 0xE7, 0xDE, 0x38, 0x1D, 0x32, 0xC7, 0xB0, 0x71, 0x47, 0x66, 0xA4, 0xBE, 0x20, 0x09, 0x99,
+    0x63, 0x48, 0x02, 0x57, 0x99, 0xB2, 0xB0, 0xC6, 0xFD, 0x5B, 0x9F, 0xC8, 0xF5, 0x40, 0xD1, 0x35,
+    0x60, 0xCB, 0xD1, 0xFB, 0x8A, 0xDE, 0x89, 0x7A, 0x33, 0x0B, 0xCC, 0x25, 0x70, 0x4C, 0x3C, 0xC0,
+    0xA3, 0x89, 0x25, 0xE3, 0x12, 0xCC, 0x05, 0x12, 0xA9, 0x0F, 0xB4, 0xA7, 0x5A, 0xAC, 0xAC, 0x12,
+    0x19, 0x58, 0xFC, 0xF9, 0x57, 0x5D, 0xE1, 0x21, 0x5D, 0x6B, 0xC7, 0xBC, 0xE6, 0x20, 0xF5, 0x94,
+    0x7A, 0xA0, 0x21, 0x17, 0xE3, 0x12, 0x09, 0x03, 0xB7, 0xCE, 0x8D, 0x43, 0xB7, 0x03, 0xCC, 0x32,
+    0x47, 0xEA, 0x76, 0xA1, 0xD1, 0x1D, 0xA6, 0xCE, 0x5B, 0xD5, 0x31, 0x8F, 0xB1, 0xC9, 0x3D, 0x46,
+    0x99, 0x73, 0x1B, 0xCA, 0xDF, 0x05, 0x95, 0x40, 0x2A, 0x07, 0x3B, 0x88, 0xF3, 0xF5, 0xD3, 0xC8,
+    0x30, 0x45, 0x1E, 0x5E, 0x71, 0x95, 0xB9, 0xAD, 0x30, 0xAE, 0x40, 0x07, 0xE3, 0x18, 0x74, 0x4B,
+    0xA9, 0x3A, 0x72, 0xDB, 0x90, 0xB9, 0x02, 0x1D, 0x32, 0x97, 0xF4, 0x2A, 0x24, 0x4B, 0xAA, 0xE4,
+    0x9A, 0xCD, 0xE4, 0x6D, 0xC7, 0xE2, 0x07, 0x01, 0x45, 0x3F, 0x86, 0xEB, 0x0B, 0xC0, 0xD4, 0xE9,
+    0x5E, 0xE1, 0x94, 0x88, 0xE3, 0xE4, 0xE8, 0x24, 0xDB, 0xC3, 0x8B, 0x78, 0xEA, 0x90, 0xF5, 0xF3,
+    0x29, 0x70, 0xCE, 0xD1, 0xB5, 0xBF, 0x18, 0x80, 0xAF, 0x1D, 0x1A, 0xFC, 0xD3, 0xE0, 0xFC, 0x53,
+    0xDA, 0xDB, 0xEB, 0xBC, 0x65, 0x20, 0x8A, 0x23, 0x5D, 0x1F, 0x78, 0x6A, 0x76, 0xBC, 0x7E, 0x69,
+    0x74, 0x95, 0xCB, 0x83, 0x4C, 0xD3, 0xA7, 0xB1, 0xED, 0xD5, 0xF6, 0xDA, 0x69, 0x16, 0x07, 0xE6,
+    0xCB, 0x16, 0x15, 0x0C, 0x07, 0x27, 0x2F, 0x87, 0x33, 0x34, 0xD0, 0xEB, 0x16, 0xED, 0x4D, 0x4D,
+    0x6E, 0x67, 0xD0, 0x24, 0x21, 0x8E, 0x6A, 0xEA, 0x12, 0x26, 0x74, 0xA8, 0x90, 0x8A, 0x88, 0x2B,
+    0x44, 0x84, 0xE5, 0xCE, 0xCE, 0xF8, 0xB8, 0x25, 0x67, 0x1A, 0x1F, 0xD7, 0xAD, 0x19, 0x1F, 0x9F,
+    0xA9, 0x0E, 0x15, 0x52, 0x17, 0x8D, 0xB5, 0x32, 0x4E, 0x92, 0xF1, 0x50, 0x05, 0xE8, 0x7B, 0xB4,
+    0xDF, 0x3A, 0x18, 0x9F, 0x0F, 0xC8, 0xC2, 0xD9, 0x38, 0x4D, 0x0D, 0xD0, 0x17, 0x9E, 0x9F, 0x49,
+    0xAF, 0xDE, 0x7B, 0x75, 0x48, 0x56, 0x4C, 0xF5, 0xC0, 0x54, 0x07, 0xA6, 0xBA, 0xA5, 0x49, 0x3D,
+    0x7D, 0xE6, 0xE8, 0x8D, 0x53, 0x9D, 0xA9, 0x93, 0x60, 0x6C, 0x12, 0x72, 0x74, 0x5B, 0xA0, 0x7D,
+    0x49, 0xEA, 0x26, 0x31, 0x5C, 0xC8, 0x65, 0x0A, 0x28, 0x31, 0x35, 0xC6, 0x3E, 0xFC, 0xD6, 0xCE,
+    0x57, 0xDF, 0xAA, 0x44, 0x44, 0xBE, 0x25, 0x22, 0xE2, 0xAB, 0xCD, 0x1D, 0xED, 0x49, 0x9D, 0x12,
+    0x91, 0xC0, 0x42, 0x64, 0xA0, 0xDA, 0xD9, 0xD9, 0xC5, 0xD4, 0xE4, 0xE3, 0x9D, 0x40, 0x12, 0x68,
+    0xA0, 0x8F, 0x06, 0x9F, 0xA9, 0xC9, 0x6D, 0xEA, 0x63, 0xCA, 0x66, 0x7D, 0xE7, 0x06, 0x56, 0x92,
+    0xC5, 0x3E, 0xA9, 0x08, 0xEA, 0xCA, 0xCE, 0xC8, 0xCA, 0xED, 0x35, 0x9D, 0x74, 0xEA, 0xBD, 0xFF,
+    0x34, 0x24, 0x42, 0x93, 0x7C, 0x14, 0x2B, 0xB5, 0xEA, 0x4C, 0xAD, 0x3E, 0x9A, 0x95, 0xA3, 0x1C,
+    0x67, 0xF1, 0x84, 0x4F, 0x45, 0xD8, 0xCA, 0x36, 0xD1, 0x33, 0x2D, 0x81, 0x5C, 0x6A, 0x52, 0x1F,
+    0x47, 0x6E, 0xE2, 0x66, 0x36, 0xF6, 0x20, 0xBA, 0xEB, 0xE2, 0xB4, 0x76, 0xD1, 0x26, 0x2F, 0xA2,
+    0x2F, 0xA0, 0x7D, 0x8C, 0x1F, 0x34, 0xF1, 0xA1, 0x45, 0x4F, 0x2A, 0x01, 0x94, 0x3D, 0x92, 0xF5,
+    0xA7, 0x73, 0x19, 0xB6, 0x4C, 0x18, 0x1D, 0xAE, 0x67, 0xA0, 0x43, 0x75, 0x24, 0x81, 0x24, 0xA0,
+    0x5B, 0xB4, 0x27, 0x75, 0x64, 0x0E, 0xE3, 0xE2, 0xDC, 0x91, 0x13, 0xE7, 0x38, 0x9E, 0x43, 0x71,
+    0x5A, 0x06, 0x6E, 0x8D, 0x61, 0x90, 0x4A, 0x48, 0xA5, 0x25, 0x3D, 0x30, 0x69, 0x7A, 0x30, 0x16,
+    0x15, 0xA2, 0xB3, 0x10, 0xA0, 0x8C, 0xD4, 0x4C, 0x6F, 0xB8, 0xDD, 0x41, 0x01, 0x49, 0x20, 0x91,
+    0x96, 0xB9, 0x40, 0x26, 0x6D, 0x25, 0x6E, 0xE7, 0xA1, 0x48, 0x92, 0xF6, 0xE4, 0x96, 0x86, 0x24,
+    0x60, 0x6A, 0x26, 0xC4, 0xC4, 0x59, 0x05, 0x3D, 0xDA, 0x93, 0x43, 0x83, 0x6E, 0x31, 0x16, 0x4E,
+    0xB0, 0x97, 0xB8, 0x7B, 0xC8, 0xA5, 0x66, 0xD1, 0xAE, 0xE3, 0x17, 0xBF, 0x36, 0xAA, 0x8E, 0xF2,
+    0xC5, 0xAD, 0xC4, 0x2D, 0x56, 0x2C, 0xDA, 0x28, 0xEB, 0x6E, 0xB2, 0x4C, 0x50, 0x1D, 0x99, 0xA3,
+    0xB8, 0x81, 0x9A, 0x1B, 0x08, 0x2D, 0x63, 0xDC, 0xAC, 0x12, 0x72, 0xA9, 0x99, 0xAD, 0xDD, 0x56,
+    0xDD, 0x42, 0x07, 0xD3, 0xE8, 0xD6, 0x7E, 0xF0, 0xF7, 0x1A, 0xED, 0x51, 0x1B, 0x13, 0x6B, 0xD1,
+    0x33, 0x17, 0xB8, 0x00, 0x97, 0x61, 0x0B, 0xCE, 0x40, 0xF6, 0xE7, 0xB0, 0x8A, 0xB2, 0x45, 0xA1,
+    0x03, 0xC3, 0x28, 0xEA, 0x93, 0x3D, 0x3A, 0x66, 0x14, 0x64, 0x4E, 0xB7, 0x74, 0x4C, 0x29, 0x30,
+    0x87, 0x7E, 0xAC, 0xB5, 0xE7, 0x12, 0x81, 0x4B, 0x6C, 0x61, 0xF6, 0xD4, 0x10, 0xA5, 0xD3, 0xF1,
+    0x75, 0x2C, 0x61, 0x63, 0xFB, 0x69, 0x09, 0x4A, 0x7A, 0x52, 0xBF, 0x76, 0x54, 0x4B, 0x30, 0x1B,
+    0xC7, 0x75, 0xF8, 0xC0, 0xEF, 0x3D, 0x4C, 0x0E, 0x01, 0x44, 0x32, 0xA9, 0x53, 0x09, 0xF0, 0x8C,
+    0xF6, 0xB9, 0x6D, 0x92, 0x60, 0xEA, 0x89, 0x0A, 0x99, 0xAB, 0xE8, 0xB5, 0xCF, 0x69, 0x74, 0x6B,
+    0x2C, 0x95, 0xD0, 0x29, 0xE9, 0xB5, 0x67, 0x46, 0x1E, 0xCF, 0x55, 0xE6, 0x74, 0x88, 0x07, 0xAE,
+    0x63, 0x16, 0x4F, 0x62, 0x11, 0x3D, 0xAC, 0x12, 0xDD, 0xD2, 0x63, 0x6C, 0xEA, 0x99, 0x52, 0x90,
+    0x04, 0x06, 0x4C, 0xAD, 0x5B, 0x26, 0x18, 0xAB, 0x3A, 0xA6, 0x64, 0x2E, 0x09, 0x14, 0x18, 0x97,
+    0x49, 0x5D, 0x32, 0x17, 0xD5, 0xAD, 0xE5, 0x74, 0x45, 0x0C, 0x09, 0x1B, 0x71, 0x50, 0xF5, 0xC0,
+    0xEF, 0xC5, 0xE8, 0xE5, 0x09, 0x2A, 0x66, 0x54, 0x5C, 0xE1, 0x14, 0x5F, 0xDC, 0xC8, 0xA7, 0x67,
+    0xD4, 0xD3, 0x74, 0x49, 0x50, 0x9D, 0x0E, 0x49, 0xD0, 0x6D, 0x12, 0xB4, 0xD7, 0x6D, 0xEA, 0xB4,
+    0xCF, 0x5C, 0xEA, 0x4C, 0x9D, 0x39, 0x63, 0x8D, 0xCB, 0xAD, 0xA9, 0x73, 0x8C, 0x2D, 0xC8, 0x29,
+    0x29, 0x98, 0x50, 0x32, 0x65, 0x42, 0xB3, 0x16, 0x66, 0xF1, 0x14, 0x26, 0x01, 0xBE, 0xD4, 0x46,
+    0x69, 0x1C, 0xA3, 0xB6, 0xDB, 0x63, 0xFC, 0x40, 0x1C, 0xF4, 0x3D, 0x74, 0x06, 0xC6, 0xD3, 0xC7,
+    0x8D, 0xD1, 0xD6, 0xC3, 0x5E, 0xFC, 0x0D, 0x21, 0xD8, 0x1B, 0x5C, 0xFB, 0x0F, 0xC6, 0x65, 0x6F,
+    0x08, 0x63, 0x6C, 0x2E, 0xD6, 0x51, 0xAD, 0xA7, 0x01, 0x25, 0x5D, 0x04, 0xE5, 0x1C, 0xDB, 0x5E,
+    0x87, 0xB4, 0xD5, 0x00, 0x79, 0x8F, 0xEA, 0x02, 0xB9, 0x0A, 0x6C, 0x8F, 0xD4, 0xFC, 0xE6, 0x8D,
+    0x82, 0xE4, 0x6F, 0x2A, 0x6D, 0x0E, 0x25, 0x9C, 0x06, 0x58, 0xB4, 0x24, 0xCB, 0xE8, 0x69, 0xA7,
+    0x3E, 0x73, 0xAA, 0xA7, 0x67, 0x17, 0x63, 0xF3, 0x5A, 0x75, 0x69, 0x4B, 0xA1, 0x7A, 0x92, 0xB0,
+    0x0B, 0x65, 0x5E, 0xA3, 0x5F, 0x6B, 0x61, 0x36, 0x40, 0x26, 0x1E, 0x64, 0x0E, 0xE6, 0x85, 0x0E,
+    0x3A, 0x53, 0x93, 0xD3, 0x90, 0x04, 0xDD, 0x52, 0x52, 0xA1, 0xDB, 0x31, 0xBE, 0x9C, 0x3A, 0x9A,
+    0x28, 0x05, 0x36, 0x1F, 0xED, 0xC7, 0x85, 0x30, 0x44, 0xDF, 0x61, 0x63, 0x82, 0x7D, 0x48, 0xFF,
+    0x1C, 0x2C, 0xD9, 0xB3, 0x74, 0x3A, 0xA8, 0x60, 0x5C, 0x12, 0xAA, 0x98, 0xE4, 0xF8, 0x51, 0x40,
+    0xFF, 0x85, 0x23, 0xBD, 0xE6, 0xC8, 0xC4, 0x63, 0xDE, 0x68, 0x31, 0x4F, 0x06, 0x72, 0xDB, 0x93,
+    0xD3, 0x50, 0x50, 0x8E, 0xAB, 0x9F, 0xD7, 0x9B, 0xA1, 0xCB, 0x71, 0xE2, 0xBB, 0x18, 0x3B, 0x54,
+    0x16, 0x78, 0xE6, 0xF0, 0xBB, 0x8B, 0xBF, 0xC5, 0xBB, 0x4F, 0xC0, 0x80, 0x0E, 0x64, 0x8E, 0xB5,
+    0x0B, 0x3E, 0x26, 0xE0, 0xFB, 0xBF, 0x81, 0xCC, 0x2E, 0x61, 0x77, 0xE7, 0xA1, 0xB9, 0x0C, 0x0B,
+    0x19, 0xE0, 0x56, 0xB8, 0x82, 0xEA, 0xD0, 0x1E, 0x63, 0x0F, 0x34, 0xF4, 0xE6, 0xD1, 0xD9, 0x8D,
+    0x43, 0xC4, 0xF7, 0x7F, 0x60, 0x88, 0x3A, 0xAA, 0xC7, 0x1B, 0xD5, 0xC2, 0xAF, 0x4A, 0x18, 0x31,
+    0xB9, 0xAD, 0x02, 0xDA, 0x93, 0xD6, 0x1B, 0xA8, 0x8E, 0xA3, 0x84, 0x9E, 0xF4, 0x06, 0xA9, 0x3F,
+    0x25, 0x09, 0x98, 0x51, 0xCE, 0xA6, 0x6B, 0x51, 0xDC, 0x92, 0xAF, 0x6F, 0xD5, 0x4C, 0xC6, 0x57,
+    0x1A, 0xCB, 0x65, 0xB4, 0xE3, 0x9E, 0x78, 0x0C, 0xA7, 0x2A, 0x24, 0xC1, 0xD4, 0xA6, 0x9E, 0x32,
+    0xD1, 0x4E, 0x75, 0x77, 0x92, 0x7D, 0x60, 0x1B, 0x8F, 0xDB, 0x7E, 0xDC, 0xC6, 0x93, 0x98, 0x5E,
+    0xCD, 0xC6, 0x6D, 0xDF, 0x43, 0xFA, 0xD6, 0x8E, 0xCD, 0x45, 0x58, 0x53, 0x9D, 0xBD, 0xD4, 0xEA,
+    0x1F, 0x06, 0xFA, 0x8E, 0xD9, 0x05, 0xF2, 0x13, 0xBF, 0x94, 0x9C, 0x6F, 0x51, 0x1F, 0x90, 0xFB,
+    0x1F, 0x3F, 0x81, 0x47, 0x32, 0x57, 0x1A, 0x57, 0x9A, 0xFA, 0xD4, 0xC7, 0x4D, 0x60, 0x9C, 0x9D,
+    0x9A, 0xD9, 0x61, 0x2D, 0x94, 0x3A, 0x8A, 0xA3, 0x0C, 0x8D, 0x7E, 0x23, 0x98, 0xDF, 0xB6, 0xEB,
+    0xD9, 0x29, 0x51, 0x87, 0x26, 0xCE, 0x47, 0x31, 0x74, 0x40, 0xF9, 0xEC, 0x06, 0xCA, 0x9F, 0x67,
+    0x77, 0xA0, 0xE8, 0xC9, 0x5B, 0x8A, 0x96, 0xBC, 0x43, 0xDD, 0xC0, 0xC9, 0xF5, 0x9D, 0xED, 0x85,
+    0x0C, 0x85, 0x48, 0x5C, 0x2F, 0xDD, 0xD2, 0x33, 0x23, 0x5F, 0x2B, 0xA3, 0x99, 0x2D, 0x82, 0x19,
+    0xD2, 0xCE, 0x74, 0xD9, 0xC0, 0x79, 0x8C, 0xD3, 0xAD, 0x3A, 0xA4, 0x97, 0xC6, 0xD0, 0x2D, 0x66,
+    0x2D, 0xB5, 0x69, 0x88, 0x87, 0xE8, 0xC0, 0xF2, 0x9E, 0xC1, 0x19, 0x16, 0x30, 0x41, 0x60, 0x82,
+    0xD4, 0x4C, 0xD5, 0xFB, 0x8E, 0x26, 0xF9, 0xA9, 0xA7, 0xD7, 0x6F, 0xB4, 0x74, 0xFA, 0xE5, 0xA0,
+    0x82, 0xF6, 0x9D, 0x0A, 0xA9, 0x6B, 0x92, 0x90, 0xB9, 0xA9, 0x6E, 0x4D, 0x5D, 0x6A, 0x6F, 0x6C,
+    0x91, 0x3A, 0x83, 0x79, 0xD0, 0xE5, 0x98, 0x6F, 0xD6, 0x05, 0xE9, 0x9F, 0xD5, 0x25, 0xFA, 0x75,
+    0x3B, 0x21, 0x11, 0xA6, 0x28, 0xA1, 0x81, 0x15, 0x97, 0xE1, 0x0A, 0xC0, 0x43, 0xD1, 0x3B, 0xD2,
+    0xE3, 0x9A, 0x9F, 0x39, 0x10, 0x22, 0x4F, 0x17, 0x2D, 0xEF, 0x48, 0xAF, 0xDE, 0x7B, 0x6B, 0x48,
+    0x84, 0x2B, 0x7A, 0x60, 0xA6, 0x03, 0x4D, 0xDA, 0x32, 0xA4, 0x9E, 0xE1, 0xB0, 0xA9, 0x9A, 0x5B,
+    0x1D, 0x0A, 0x74, 0x5B, 0x91, 0xB6, 0x15, 0xA9, 0x2F, 0x63, 0x16, 0xE6, 0x53, 0x63, 0x82, 0xC3,
+    0x1E, 0x8B, 0xB1, 0xA3, 0xCB, 0xC2, 0x16, 0x87, 0xB3, 0x4B, 0xBF, 0x2A, 0x3F, 0x87, 0x72, 0xAF,
+    0x4C, 0x80, 0x0B, 0xA3, 0x17, 0x64, 0xE3, 0x28, 0xDB, 0x30, 0xD1, 0x1E, 0x4C, 0x6E, 0x23, 0xF8,
+    0x11, 0xDD, 0xAD, 0x75, 0xE1, 0xA7, 0xBA, 0xA6, 0x8A, 0xA3, 0x31, 0xAD, 0xF1, 0x4E, 0x17, 0x01,
+    0x03, 0x95, 0x5D, 0x07, 0x5C, 0x7E, 0xD5, 0x39, 0xD0, 0x61, 0xF4, 0x31, 0x87, 0xC3, 0x3E, 0xEA,
+    0xEF, 0x3C, 0xB0, 0x4A, 0x2F, 0xBE, 0x22, 0xC1, 0xBE, 0xFF, 0xD6, 0x92, 0xB9, 0x33, 0x75, 0xE1,
+    0x74, 0x6B, 0x5A, 0xD5, 0xE9, 0xC0, 0x8C, 0x9E, 0x82, 0x59, 0xF4, 0x83, 0x5B, 0xE3, 0x54, 0xA7,
+    0x5B, 0x1A, 0xD5, 0x51, 0xDD, 0x70, 0xF1, 0x97, 0x9F, 0x1E, 0xD7, 0x25, 0x1F, 0x9E, 0x9E, 0x7C,
+    0x33, 0x3D, 0xD9, 0xC1, 0xF4, 0x5C, 0x5B, 0x4F, 0x0F, 0x07, 0xD3, 0x33, 0x1B, 0x55, 0x4A, 0xE4,
+    0x20, 0xE9, 0xA2, 0xBF, 0x81, 0x96, 0x1A, 0xD4, 0xD7, 0x80, 0xA7, 0x0B, 0x1F, 0x27, 0x28, 0xFA,
+    0x67, 0xC9, 0xDF, 0xD4, 0x3F, 0xC3, 0x38, 0x36, 0x41, 0xB1, 0x02, 0x8E, 0xEC, 0x8E, 0xE1, 0xA1,
+    0x16, 0x58, 0xAC, 0x40, 0x4B, 0x7F, 0x28, 0x83, 0x9B, 0x6C, 0x92, 0x02, 0xDD, 0xC9, 0x9E, 0x15,
+    0x3A, 0x64, 0x2D, 0x69, 0x5B, 0x81, 0x79, 0xB1, 0x83, 0xCA, 0x38, 0x68, 0x76, 0x21, 0x79, 0xB7,
+    0x83, 0xEC, 0xFB, 0x0E, 0xAA, 0x0A, 0x18, 0x06, 0x48, 0xDF, 0x08, 0x50, 0x7C, 0xD9, 0xC1, 0x50,
+    0x40, 0xD6, 0xEE, 0x42, 0xC5, 0x92, 0xB4, 0x53, 0x2B, 0x16, 0x75, 0x22, 0xD2, 0xC5, 0x01, 0xA3,
+    0x62, 0x29, 0xA4, 0x46, 0x84, 0x31, 0xCE, 0xCC, 0xC9, 0x37, 0x49, 0x64, 0xA0, 0xFA, 0xA3, 0x21,
+    0xE9, 0x54, 0x9F, 0xD7, 0x3A, 0x34, 0x64, 0x2F, 0xB5, 0x14, 0xB9, 0xA5, 0x99, 0xA2, 0xDF, 0x0D,
+    0x98, 0x6F, 0x3A, 0x66, 0x39, 0x3A, 0xEC, 0x92, 0xDB, 0x65, 0xD2, 0x23, 0x52, 0xB3, 0xE8, 0xC6,
+    0xDD, 0xBC, 0x97, 0x10, 0x21, 0x83, 0x99, 0xB4, 0x60, 0x56, 0x87, 0xA5, 0xD7, 0xA7, 0x04, 0x83,
+    0xE2, 0x8B, 0xEC, 0x11, 0x32, 0x12, 0xE9, 0x63, 0xF0, 0x6B, 0xFB, 0xD7, 0x03, 0xBF, 0x80, 0xED,
+    0x13, 0xA0, 0xDB, 0x1E, 0xCC, 0xC5, 0x16, 0xCE, 0x64, 0x35, 0x5C, 0xB8, 0x0B, 0x38, 0xBE, 0x96,
+    0x25, 0x89, 0xBC, 0x09, 0x85, 0xAC, 0x40, 0xEE, 0x5F, 0xD4, 0xBA, 0xC7, 0xB8, 0xAC, 0x25, 0x6D,
+    0x8D, 0x43, 0x87, 0xC2, 0xA2, 0x43, 0x45, 0x34, 0xF5, 0x92, 0x70, 0x05, 0x92, 0xD0, 0x10, 0xF9,
+    0xD6, 0x61, 0x80, 0xB4, 0x1D, 0x20, 0xF3, 0x03, 0x18, 0xD7, 0x40, 0x51, 0xEF, 0x42, 0x45, 0x65,
+    0xD5, 0x92, 0xBC, 0xCD, 0x7A, 0x32, 0x11, 0x3F, 0xAE, 0x5D, 0x9C, 0xD3, 0x13, 0x47, 0xA1, 0x34,
+    0x35, 0x85, 0xA9, 0xC9, 0xB3, 0x9A, 0xBB, 0xD2, 0x1A, 0xB5, 0x36, 0xA7, 0xCF, 0xEF, 0xC1, 0x42,
+    0x60, 0xF5, 0xD5, 0xC0, 0x15, 0x76, 0xD9, 0xC5, 0xB8, 0x82, 0x24, 0x98, 0x9A, 0x26, 0xF5, 0x14,
+    0x2A, 0x60, 0x5C, 0x83, 0x6E, 0x0B, 0x54, 0x97, 0x3A, 0x06, 0xD5, 0x33, 0xA3, 0xB2, 0x57, 0xD1,
+    0xB2, 0x82, 0x62, 0xB9, 0x11, 0x6C, 0x0F, 0xC5, 0xC3, 0xFD, 0x11, 0xAA, 0x60, 0xBE, 0xB2, 0x2C,
+    0x24, 0xB0, 0xFC, 0xEA, 0x40, 0xCF, 0x15, 0xD5, 0x51, 0x26, 0x21, 0x7E, 0xE9, 0x96, 0x99, 0xF6,
+    0x0C, 0xA9, 0x4B, 0xBB, 0x4C, 0xC4, 0x1B, 0x59, 0x62, 0xBE, 0xDD, 0x63, 0x6C, 0x43, 0xCE, 0x8C,
+    0x82, 0x8A, 0x92, 0x82, 0x12, 0x53, 0xCF, 0x30, 0x6E, 0x4A, 0xE6, 0xA3, 0x15, 0xAB, 0x2C, 0x0C,
+    0x31, 0xB8, 0x1E, 0x03, 0xD4, 0xD1, 0x38, 0xBB, 0x29, 0xE9, 0x78, 0x47, 0xC8, 0x77, 0x1F, 0x4D,
+    0x56, 0x50, 0xB8, 0xB5, 0xF3, 0x3A, 0xFA, 0xB6, 0xE6, 0x43, 0xBE, 0x6D, 0x1B, 0x2D, 0x95, 0x4F,
+    0x86, 0xC8, 0xF1, 0x33, 0x1A, 0x7C, 0x84, 0x68, 0x67, 0x2B, 0x0B, 0x9C, 0xCA, 0xBC, 0xFE, 0xDE,
+    0xC0, 0xEC, 0x7A, 0x9D, 0xF5, 0xB0, 0xD8, 0x90, 0x96, 0x5B, 0x92, 0x00, 0x55, 0x24, 0x6D, 0xB2,
+    0xC9, 0x1C, 0x9A, 0xFA, 0x10, 0xE0, 0x14, 0x13, 0x9F, 0xDA, 0x8A, 0x19, 0xF5, 0x6D, 0xF8, 0x78,
+    0xC1, 0xFD, 0x49, 0x30, 0x77, 0x82, 0x6D, 0x2E, 0x65, 0x35, 0x5D, 0x8F, 0x92, 0x1A, 0xDD, 0x6F,
+    0xCE, 0xF0, 0xA9, 0xCC, 0xF3, 0x8E, 0x90, 0xBE, 0xFE, 0xBF, 0x52, 0xB4, 0xB0, 0x38, 0x30, 0x0F,
+    0x67, 0x1F, 0xEB, 0x15, 0xB5, 0x9B, 0x8D, 0x94, 0x74, 0x31, 0x55, 0x3B, 0x9A, 0x94, 0x6B, 0x2D,
+    0x9C, 0x4A, 0x4B, 0x25, 0x03, 0x72, 0xFF, 0xE5, 0xF5, 0x56, 0x5B, 0x7F, 0x25, 0x1D, 0xA8, 0x25,
+    0x30, 0x77, 0x31, 0xA6, 0x9F, 0xAC, 0x80, 0xF9, 0x08, 0x20, 0x34, 0x8E, 0x8D, 0x78, 0x2D, 0xEA,
+    0xC7, 0xD5, 0x82, 0xB9, 0x0C, 0x14, 0xB2, 0x8E, 0x80, 0x1C, 0xB5, 0x18, 0x4F, 0xEA, 0x49, 0x3D,
+    0x7A, 0x9D, 0x96, 0x52, 0x8B, 0xBD, 0x44, 0x24, 0xB9, 0x7E, 0xD2, 0x8E, 0xAE, 0xBC, 0x43, 0x2D,
+    0xA1, 0x68, 0x51, 0x02, 0xD9, 0x98, 0x2E, 0xA9, 0xD1, 0x7E, 0x4F, 0x87, 0x4A, 0xFA, 0x54, 0xBA,
+    0x28, 0x2D, 0x8F, 0x8E, 0x99, 0x63, 0x71, 0xE8, 0x1F, 0xB5, 0x18, 0xDB, 0x71, 0x64, 0x64, 0xE1,
+    0x93, 0xE2, 0x40, 0x6D, 0xA3, 0x06, 0x10, 0x47, 0xD7, 0xA9, 0x60, 0x46, 0x77, 0xF9, 0x6F, 0xCD,
+    0xC1, 0x27, 0x44, 0xE9, 0x85, 0x31, 0xEA, 0x7B, 0x65, 0xB4, 0x83, 0x72, 0x38, 0x76, 0x05, 0xB2,
+    0x37, 0x81, 0xF3, 0x6F, 0xB2, 0x10, 0x77, 0xF5, 0xB7, 0x7D, 0x15, 0x49, 0x0A, 0x30, 0xB7, 0x64,
+    0x3D, 0xCC, 0x1D, 0xC9, 0x00, 0xB9, 0x8D, 0xE6, 0xF5, 0x17, 0x19, 0x8C, 0xAC, 0x94, 0x2C, 0x51,
+    0x2D, 0x3C, 0x0F, 0x45, 0x3C, 0xCC, 0x17, 0x38, 0x76, 0x85, 0xE4, 0x3A, 0x87, 0x12, 0x54, 0xEF,
+    0x7E, 0x38, 0x41, 0xF5, 0x49, 0x2D, 0xC0, 0x71, 0x6C, 0x5A, 0x37, 0x9C, 0x29, 0x41, 0x6A, 0xB2,
+    0x0D, 0x24, 0xE0, 0xD8, 0xCA, 0x26, 0x22, 0x5C, 0xFD, 0x6D, 0xBF, 0x16, 0x3D, 0x0E, 0xE6, 0x11,
+    0x0E, 0x99, 0x0E, 0x71, 0x11, 0x72, 0x3B, 0x0A, 0xA5, 0x3D, 0x1D, 0x8C, 0xAC, 0x98, 0x8B, 0xE5,
+    0x44, 0x84, 0x46, 0x57, 0x22, 0xC3, 0xAD, 0x8F, 0xBC, 0xFA, 0xD0, 0xC6, 0x30, 0xC8, 0xA3, 0x61,
+    0xF0, 0x91, 0x1E, 0xFA, 0x47, 0x61, 0x5C, 0x0F, 0x27, 0xDE, 0x5C, 0x8C, 0xC3, 0x67, 0x40, 0xE6,
+    0xE3, 0x33, 0xAA, 0x85, 0x7F, 0xEC, 0xE1, 0xEA, 0xA6, 0xAE, 0x49, 0x3B, 0x0A, 0x8E, 0xAD, 0x9E,
+    0x59, 0x88, 0x3F, 0xBF, 0xF3, 0xA1, 0x48, 0xDD, 0x26, 0xA4, 0x68, 0x99, 0x81, 0x04, 0x25, 0x2E,
+    0xF1, 0x18, 0x98, 0xC3, 0x04, 0x3A, 0x9E, 0x73, 0xBA, 0x1F, 0x0D, 0xDA, 0x2D, 0xED, 0xC9, 0x73,
+    0x4B, 0xB6, 0x8C, 0xC6, 0xAC, 0x5A, 0x07, 0x1B, 0x7F, 0xFD, 0x6C, 0xAD, 0x83, 0x0A, 0x5B, 0x70,
+    0x89, 0x7F, 0xD6, 0xF2, 0x8E, 0x4D, 0x02, 0x27, 0x7F, 0xBE, 0xB7, 0x10, 0x7F, 0xF2, 0x55, 0xFB,
+    0x61, 0x77, 0xBA, 0x5A, 0xFB, 0xE1, 0x33, 0x98, 0x41, 0x35, 0x90, 0x0F, 0x60, 0x7F, 0x29, 0xDA,
+    0xEE, 0x5E, 0x7C, 0x87, 0xB9, 0x2C, 0xB9, 0x75, 0xF9, 0xD0, 0x2F, 0x4D, 0xDB, 0x5F, 0x33, 0xAD,
+    0x5A, 0x86, 0x5C, 0xDA, 0x8F, 0x9E, 0x56, 0x8E, 0x03, 0xC7, 0x95, 0x25, 0x1B, 0xEE, 0x84, 0x52,
+    0x02, 0x89, 0x5B, 0xD8, 0x8D, 0x20, 0xE1, 0xCC, 0x08, 0x12, 0x1C, 0xB4, 0x47, 0xB7, 0x39, 0x18,
+    0xDB, 0xC0, 0x54, 0x87, 0xA8, 0xBC, 0x4D, 0x3D, 0x81, 0x52, 0x85, 0x88, 0x62, 0xCC, 0x5C, 0x39,
+    0x3E, 0xDE, 0xA7, 0x1E, 0xED, 0x73, 0xC8, 0x69, 0xD6, 0x69, 0x8A, 0xCC, 0x91, 0xDB, 0xDC, 0x32,
+    0x50, 0xD5, 0x85, 0x63, 0x2E, 0x4B, 0x98, 0x6F, 0xF2, 0x81, 0xCA, 0x1E, 0xC1, 0x74, 0x5B, 0x94,
+    0xD2, 0x71, 0xF6, 0x00, 0x28, 0x9C, 0xEC, 0xF1, 0xF5, 0xD4, 0xD3, 0xA4, 0x8E, 0x3E, 0x73, 0x1C,
+    0x04, 0xEA, 0xAD, 0x6E, 0x47, 0xC3, 0xDF, 0x97, 0x64, 0x6E, 0x82, 0x71, 0xB3, 0x11, 0x38, 0xB6,
+    0x9B, 0x5C, 0xB3, 0x95, 0x7C, 0x0B, 0xB3, 0xC6, 0xBC, 0x29, 0x19, 0xC0, 0x48, 0x60, 0x1D, 0x1F,
+    0x27, 0x69, 0x47, 0xFA, 0xDD, 0x48, 0x3F, 0x5D, 0xE6, 0x48, 0x5D, 0xB5, 0xA6, 0x7F, 0xCD, 0x6E,
+    0x6E, 0x9B, 0x35, 0x60, 0xD4, 0xD4, 0x98, 0x7A, 0x06, 0x13, 0x15, 0x50, 0x21, 0xDB, 0xA4, 0x59,
+    0x1A, 0x54, 0xA7, 0x3A, 0x8C, 0xD3, 0x7D, 0x32, 0x90, 0x8A, 0x78, 0x52, 0xE9, 0xD7, 0xB2, 0xC0,
+    0x48, 0x4B, 0x2E, 0xED, 0xDA, 0x9A, 0xFE, 0xF5, 0xF0, 0x53, 0x7F, 0x16, 0x32, 0x7B, 0x09, 0x72,
+    0x59, 0xE3, 0x2F, 0xD7, 0x02, 0xF5, 0x53, 0x5B, 0xB0, 0xCF, 0xF0, 0x28, 0xB7, 0x10, 0x30, 0xE2,
+    0xD1, 0x62, 0xD7, 0xDA, 0xF3, 0xD7, 0xC2, 0x20, 0x27, 0x6B, 0x50, 0xEF, 0x3B, 0x30, 0xA9, 0x85,
+    0xB3, 0x37, 0x03, 0x97, 0x9E, 0x07, 0xE4, 0x10, 0xC8, 0xF7, 0xD3, 0x5B, 0x43, 0xFE, 0x35, 0xE8,
+    0x6B, 0x96, 0xF4, 0x9C, 0x23, 0x4D, 0x1C, 0xFA, 0xA9, 0x3A, 0x22, 0x63, 0x7F, 0x9D, 0x2C, 0x2B,
+    0xBB, 0x0D, 0x85, 0x71, 0xA8, 0x30, 0x05, 0x93, 0x3A, 0x08, 0x5B, 0x1C, 0x98, 0xD0, 0x97, 0x23,
+    0x0F, 0x07, 0x18, 0xA4, 0x49, 0x12, 0x50, 0xC1, 0x8C, 0xAB, 0x18, 0x21, 0x4B, 0xA9, 0x23, 0xF5,
+    0xC5, 0x1A, 0xD8, 0xAB, 0x5B, 0x74, 0x9B, 0x5B, 0x8C, 0x9D, 0xC2, 0xF4, 0x20, 0xB5, 0x58, 0xC0,
+    0x8C, 0x19, 0x3A, 0xB0, 0x62, 0x81, 0x12, 0xE9, 0x50, 0xB2, 0xF1, 0xC2, 0xB8, 0xF5, 0xA8, 0x25,
+    0xFF, 0x92, 0xC7, 0x5C, 0xF4, 0x64, 0x17, 0x3D, 0xD9, 0x03, 0x7E, 0x43, 0xC6, 0x4D, 0x56, 0x3D,
+    0x9D, 0x7A, 0x1A, 0x15, 0x28, 0x69, 0x30, 0xB6, 0x24, 0x75, 0xC6, 0x26, 0x21, 0xF5, 0xF4, 0x49,
+    0xA0, 0x64, 0x20, 0xB7, 0x25, 0x99, 0x33, 0x56, 0x87, 0xD4, 0x27, 0xBD, 0x0A, 0x6A, 0xC9, 0x6E,
+    0x72, 0xCD, 0x1A, 0x79, 0xC3, 0x21, 0x2F, 0x07, 0xD4, 0xA7, 0xB5, 0x78, 0x33, 0x22, 0x60, 0x34,
+    0x86, 0x1D, 0x03, 0xA0, 0xDF, 0x24, 0x2A, 0xC3, 0x88, 0x4C, 0xFC, 0x95, 0x17, 0xEE, 0x63, 0x51,
+    0xA9, 0x51, 0x11, 0x2D, 0xE2, 0xBF, 0x1E, 0xA0, 0x99, 0x02, 0x5C, 0x4E, 0x6B, 0xE0, 0xC4, 0x26,
+    0xE8, 0x92, 0xC4, 0xF8, 0x60, 0x4F, 0xD6, 0x52, 0x55, 0xE8, 0x9E, 0xFC, 0x41, 0x97, 0x08, 0xD9,
+    0x8B, 0x81, 0xF7, 0x9D, 0x6E, 0x1B, 0xAE, 0x84, 0x24, 0x14, 0x4C, 0xA6, 0xF4, 0x99, 0xCB, 0x0D,
+    0xD3, 0x24, 0x98, 0x73, 0xAE, 0x64, 0x9A, 0xBA, 0x90, 0xDB, 0x5C, 0xB7, 0x5B, 0x99, 0x4B, 0x5F,
+    0x08, 0x46, 0x7B, 0x15, 0x7A, 0xFD, 0x62, 0x60, 0xBA, 0x45, 0xD7, 0x91, 0x9F, 0x61, 0x32, 0x45,
+    0xFF, 0x19, 0x66, 0x17, 0xDE, 0x73, 0xFA, 0x75, 0xA8, 0x3C, 0x52, 0x63, 0x02, 0x85, 0x43, 0x77,
+    0x64, 0x2D, 0x0C, 0x24, 0xDD, 0x26, 0xDE, 0x17, 0x53, 0x23, 0x55, 0x20, 0x62, 0x45, 0xA2, 0xA5,
+    0x7F, 0x90, 0x15, 0x49, 0x6A, 0xF5, 0x34, 0x5F, 0x9F, 0x52, 0x59, 0xF3, 0x94, 0xCB, 0x3A, 0x15,
+    0x26, 0xBC, 0x6F, 0x2B, 0xED, 0xCF, 0x5C, 0x4A, 0xFD, 0x44, 0x7F, 0xDF, 0x0E, 0xDA, 0x4F, 0x2F,
+    0x1B, 0x3B, 0x31, 0x0F, 0x3E, 0x19, 0xF4, 0xCB, 0xE1, 0xF2, 0x84, 0xC9, 0x24, 0xFD, 0xA6, 0xD3,
+    0xAF, 0xB9, 0x0B, 0x3D, 0x93, 0x4B, 0xE9, 0xBF, 0x44, 0xBF, 0xCE, 0x3F, 0x6F, 0xA9, 0xDA, 0x74,
+    0x40, 0x0F, 0x54, 0x35, 0x45, 0xAD, 0xC3, 0x38, 0x59, 0xC9, 0x10, 0x63, 0x52, 0x45, 0x0E, 0x97,
+    0xB3, 0x9A, 0xED, 0x48, 0xD2, 0x27, 0x52, 0x84, 0x13, 0xD9, 0xAD, 0xEA, 0x08, 0xB2, 0xA5, 0x3C,
+    0x33, 0xF2, 0xBA, 0x51, 0x7C, 0x9F, 0x6E, 0x05, 0xC1, 0x11, 0xA0, 0xCC, 0x1C, 0xA5, 0x71, 0xDC,
+    0x96, 0x1C, 0xF6, 0xE8, 0x3E, 0x01, 0xD6, 0x39, 0xCA, 0x08, 0x0B, 0x59, 0x5B, 0xC8, 0xDA, 0x1D,
+    0x12, 0xAB, 0x22, 0x2B, 0x2A, 0x11, 0x9F, 0xEC, 0xEF, 0x0F, 0xC4, 0xF2, 0x8D, 0xB4, 0x8D, 0xB9,
+    0xA9, 0x0D, 0x12, 0x37, 0xE9, 0x80, 0xDD, 0xC3, 0xA0, 0xD6, 0xE5, 0xA1, 0x47, 0x0F, 0x10, 0xAE,
+    0x1E, 0x92, 0xEB, 0x3B, 0x3B, 0x54, 0x22, 0x41, 0x8B, 0xC8, 0x08, 0x8C, 0xC8, 0x1D, 0x0C, 0x91,
+    0x9C, 0xCB, 0x1B, 0x7F, 0xEE, 0xF6, 0xFD, 0x67, 0x10, 0x69, 0xD5, 0xCE, 0x3C, 0x42, 0xAA, 0xC7,
+    0x7C, 0x95, 0x71, 0x70, 0x25, 0x92, 0x5F, 0xC6, 0xB1, 0xAA, 0xC8, 0x58, 0x6E, 0x41, 0x24, 0xA4,
+    0x22, 0xEE, 0x63, 0xC1, 0x36, 0x85, 0x48, 0xAB, 0x45, 0x96, 0xDC, 0xBD, 0xFF, 0xDC, 0x61, 0xD2,
+    0xF3, 0x1B, 0x10, 0xC5, 0x1F, 0x24, 0xDD, 0xF8, 0x8F, 0xE2, 0xF2, 0x0A, 0x50, 0x7C, 0x7B, 0x67,
+    0x5B, 0x8B, 0x08, 0x95, 0x48, 0x88, 0x2A, 0x22, 0xF5, 0x70, 0x85, 0x83, 0x94, 0x2D, 0xBF, 0xBF,
+    0xBF, 0x67, 0x64, 0xC5, 0xCE, 0x23, 0x7E, 0x83, 0x0E, 0x8F, 0x31, 0x82, 0x2B, 0x1B, 0x0F, 0x23,
+    0x56, 0xEE, 0xAF, 0x61, 0xD3, 0x32, 0x44, 0x3E, 0x3E, 0x0C, 0xCF, 0xCD, 0x0E, 0xC1, 0x73, 0x3F,
+    0xE1, 0xB5, 0x39, 0xC2, 0x09, 0x26, 0xDA, 0xB3, 0x35, 0x8B, 0x02, 0x6B, 0xB9, 0xB1, 0xA6, 0x7F,
+    0xC5, 0xB5, 0x39, 0x11, 0xAB, 0x28, 0x94, 0x84, 0x1B, 0xA3, 0xB2, 0xD9, 0xC7, 0xE5, 0x4D, 0x7F,
+    0xB9, 0x64, 0xAA, 0xF6, 0x1F, 0x04, 0x8A, 0xD7, 0x71, 0x69, 0x17, 0x7E, 0x2C, 0x42, 0x3B, 0xA1,
+    0x43, 0xCE, 0x65, 0xED, 0x8F, 0xB0, 0x6D, 0xDC, 0x95, 0xD4, 0x6F, 0x61, 0xE1, 0x04, 0xC6, 0x6B,
+    0xA1, 0xBF, 0x3C, 0xD1, 0x2F, 0x73, 0x44, 0xD9, 0x23, 0x59, 0x7F, 0xC7, 0x06, 0x80, 0x31, 0x97,
+    0x4A, 0xFE, 0xDD, 0xCE, 0xF6, 0xDD, 0xFB, 0xFB, 0xB9, 0xC8, 0x8B, 0xFB, 0xFB, 0x7B, 0x5F, 0x50,
+    0x7F, 0xAC, 0xDE, 0x90, 0x30, 0x0F, 0xCA, 0x72, 0xA2, 0x19, 0xBE, 0x86, 0x32, 0xFA, 0x35, 0xD7,
+    0xED, 0x9D, 0xA8, 0x9E, 0xBC, 0xAA, 0xDA, 0x33, 0xD5, 0x45, 0x77, 0x1F, 0xD9, 0xDE, 0xFB, 0xAF,
+    0x9C, 0xFB, 0x7F, 0xB2, 0xB3, 0x17, 0xE6, 0xEE, 0x38, 0x6C, 0x9F, 0xD0, 0x6D, 0x6F, 0x2E, 0xB6,
+    0x67, 0xB2, 0xFA, 0xC2, 0x5D, 0x1C, 0x3F, 0xCE, 0x71, 0xCE, 0xB9, 0x69, 0x5E, 0x20, 0x2E, 0x0D,
+    0x9C, 0x00, 0xED, 0xBB, 0xAD, 0x3C, 0xBB, 0xE8, 0xC3, 0x29, 0x20, 0x7D, 0xE9, 0x07, 0x6D, 0xE8,
+    0xA7, 0x93, 0xE2, 0xA6, 0x63, 0xF6, 0xC4, 0x51, 0xFA, 0x52, 0x85, 0x69, 0xD2, 0x5E, 0xD6, 0x2E,
+    0x28, 0x2C, 0x8F, 0x92, 0x5B, 0xD5, 0x25, 0x9F, 0xBD, 0xED, 0xAC, 0x7E, 0x49, 0x3A, 0xB3, 0xE4,
+    0x08, 0xEA, 0x99, 0x54, 0x9E, 0xFA, 0xF1, 0xBB, 0xEE, 0x4E, 0xAB, 0xA0, 0x9D, 0xA4, 0xAE, 0x2F,
+    0x74, 0x7B, 0xE5, 0xA8, 0xD5, 0xED, 0xCC, 0xB8, 0xAE, 0xD0, 0xFE, 0x82, 0x62, 0x3A, 0x9B, 0x4C,
+    0x26, 0xF7, 0xDC, 0x79, 0xE4, 0xF0, 0xB5, 0x71, 0x2E, 0xDC, 0x11, 0x1E, 0xCA, 0xFC, 0xAE, 0x6E,
+    0x27, 0x58, 0xC0, 0xFC, 0x9D, 0x9F, 0x2C, 0x1F, 0x76, 0x5B, 0xCA, 0xC2, 0x85, 0xE4, 0x2D, 0xB3,
+    0x9C, 0x6C, 0x07, 0x15, 0x91, 0x07, 0xC3, 0xDD, 0xDF, 0x75, 0x9C, 0x25, 0xAD, 0xB9, 0x84, 0x81,
+    0xC0, 0x67, 0x63, 0x58, 0xBA, 0x4F, 0x42, 0xE6, 0x2B, 0xFB, 0x45, 0xD2, 0x07, 0x2F, 0xD6, 0x7E,
+    0x2B, 0xB5, 0xA8, 0xDA, 0xB0, 0x75, 0xF2, 0xFA, 0xA2, 0x83, 0xBB, 0x9F, 0xAD, 0x86, 0xD4, 0xA5,
+    0x75, 0x66, 0x01, 0x32, 0xB6, 0x72, 0x39, 0xFF, 0xE6, 0x3D, 0x3C, 0xCA, 0xEF, 0xEF, 0x4B, 0x0B,
+    0xA0, 0x5B, 0x63, 0xA7, 0x2A, 0x64, 0xFF, 0xE2, 0x4A, 0x11, 0x76, 0x41, 0xB7, 0x93, 0xD4, 0x35,
+    0x59, 0x7D, 0xE5, 0x4B, 0x43, 0xE1, 0x28, 0xAB, 0x09, 0x47, 0x94, 0x79, 0xE0, 0x0D, 0xDF, 0x6F,
+    0xDF, 0x96, 0xED, 0xBD, 0xFF, 0x9A, 0xFE, 0x3F, 0xCD, 0x85, 0x0B, 0x0B, 0x77, 0x1C, 0xF4, 0xCB,
+    0x21, 0x3C, 0x7E, 0x02, 0x6D, 0x83, 0x71, 0x67, 0x92, 0x1F, 0x37, 0x2B, 0xB4, 0x0B, 0x5B, 0xDA,
+    0x4D, 0x1E, 0x18, 0x14, 0x24, 0x6D, 0x37, 0xC9, 0xD3, 0x17, 0xDB, 0xEE, 0x14, 0x77, 0xEF, 0x3F,
+    0x5B, 0xC9, 0x70, 0x81, 0xAD, 0x4B, 0x6C, 0x05, 0x2E, 0x6C, 0x73, 0x1C, 0x78, 0x6C, 0xEB, 0x96,
+    0x6F, 0x5C, 0x99, 0x16, 0xAF, 0x07, 0xE0, 0x38, 0xFF, 0xC0, 0x4F, 0x4C, 0x6E, 0x17, 0x5E, 0x77,
+    0xDC, 0x0A, 0xDB, 0x14, 0x2E, 0x5D, 0xAA, 0x77, 0x42, 0x93, 0xFE, 0x0B, 0x4E, 0xEC, 0x25, 0x5B,
+    0xFA, 0xFB, 0xD2, 0x4A, 0xAB, 0x2C, 0xEA, 0x19, 0x2D, 0x2F, 0xFD, 0xBC, 0x6F, 0xCD, 0x71, 0xAC,
+    0xB2, 0x27, 0xE6, 0xFE, 0x8D, 0x6B, 0x72, 0x67, 0xD6, 0x1D, 0x57, 0x54, 0xF2, 0x2F, 0xE5, 0xE5,
+    0x9D, 0xED, 0x5B, 0x77, 0x76, 0x1E, 0x11, 0xF9, 0x4F, 0xFB, 0xFB, 0x4F, 0xC7, 0x03, 0x3A, 0xDC,
+    0xBD, 0xBF, 0x6F, 0x81, 0x5B, 0x77, 0x76, 0x52, 0x91, 0xB0, 0xB3, 0xB3, 0x83, 0xB2, 0x47, 0x4C,
+    0x77, 0xBA, 0x90, 0xFE, 0x6C, 0x1E, 0x8E, 0xC3, 0xDD, 0xFB, 0xDF, 0x59, 0xC8, 0xEA, 0xF7, 0xF7,
+    0x9F, 0xBD, 0x75, 0x67, 0x67, 0x67, 0x67, 0x21, 0x22, 0xAB, 0xFD, 0xFD, 0xFD, 0xFD, 0xEF, 0xC4,
+    0x34, 0xDB, 0xBC, 0x2E, 0x7C, 0xE1, 0x75, 0x7B, 0x08, 0xA8, 0xB5, 0x46, 0xDA, 0xF6, 0x51, 0xAA,
+    0xAF, 0x5D, 0x3E, 0x73, 0xE8, 0x56, 0x77, 0x70, 0x2B, 0xFB, 0xE5, 0x6F, 0x7D, 0x0D, 0x20, 0x53,
+    0xE1, 0x74, 0x96, 0x7D, 0xB3, 0xE6, 0x14, 0xB7, 0x6D, 0x71, 0xFA, 0x02, 0x5B, 0xFF, 0x7A, 0x67,
+    0x2A, 0xD2, 0xEF, 0xEC, 0x6C, 0x03, 0x95, 0x0C, 0xBF, 0xB5, 0x33, 0x7D, 0x9C, 0xB3, 0xCF, 0xF3,
+    0xF8, 0x42, 0x42, 0x64, 0xD3, 0xBC, 0xD7, 0x4F, 0x76, 0xFF, 0xE9, 0xF3, 0x67, 0xEF, 0x04, 0x8E,
+    0x70, 0xCF, 0x34, 0x0F, 0xC6, 0x55, 0xE1, 0xF1, 0x00, 0x90, 0xF9, 0x99, 0xF6, 0x59, 0x6D, 0xD8,
+    0x4A, 0x42, 0xB9, 0x11, 0x5B, 0xC3, 0xED, 0xFB, 0xFB, 0xF5, 0x66, 0x56, 0xBA, 0x5B, 0x77, 0x76,
+    0xC6, 0xBD, 0x98, 0xF8, 0x23, 0x6A, 0x3B, 0xAF, 0x87, 0xAC, 0xBE, 0xAC, 0x2C, 0x1F, 0x38, 0x88,
+    0x77, 0xEB, 0x21, 0x75, 0x5B, 0x06, 0xB8, 0xDD, 0x1E, 0x1F, 0xF4, 0x6B, 0x7F, 0xF1, 0xFA, 0x6E,
+    0xF9, 0xC5, 0xF0, 0xA8, 0x82, 0xCF, 0x9B, 0x73, 0x7E, 0x55, 0xD4, 0x80, 0x16, 0x19, 0xCA, 0xFD,
+    0xEF, 0x3E, 0x55, 0xF3, 0xF8, 0x25, 0xB2, 0xDF, 0x81, 0xA7, 0xC7, 0x8E, 0x09, 0x07, 0x23, 0xEA,
+    0x71, 0x44, 0x48, 0x5F, 0x7A, 0x39, 0x74, 0x97, 0xA7, 0x93, 0xFC, 0xA6, 0x63, 0xF6, 0xD6, 0xDF,
+    0x95, 0x7F, 0xFF, 0x1C, 0x17, 0x12, 0x6F, 0xE0, 0x08, 0x47, 0xEF, 0xFB, 0x5D, 0x79, 0xE9, 0x5B,
+    0x8B, 0xE1, 0x31, 0xF1, 0x5F, 0x8A, 0x33, 0x7F, 0x0B, 0x14, 0x70, 0x27, 0xC7, 0xF6, 0xEE, 0xC8,
+    0x97, 0xD3, 0xC9, 0xA2, 0x7B, 0x3C, 0xF3, 0x3C, 0x0A, 0x5D, 0x34, 0x25, 0x49, 0xDE, 0xBC, 0xD9,
+    0x48, 0x73, 0x47, 0x16, 0x80, 0x6C, 0xEF, 0xBE, 0x62, 0x19, 0x1E, 0x2F, 0xFC, 0x71, 0x05, 0x4F,
+    0xD8, 0xBB, 0xB2, 0x73, 0x22, 0x4F, 0xFD, 0xB8, 0x4F, 0x75, 0x9C, 0x80, 0xC7, 0xF2, 0x17, 0xAF,
+    0x1B, 0xD5, 0xDE, 0xC3, 0xDC, 0x55, 0xAE, 0x7A, 0x6D, 0xD0, 0x83, 0x5E, 0x3E, 0x06, 0xF0, 0x1A,
+    0x6C, 0x73, 0xF3, 0xA3, 0xFC, 0xE9, 0xBD, 0xEC, 0xF1, 0x3F, 0xA8, 0x2F, 0xC0, 0xE7, 0xD0, 0x70,
+    0x0C, 0x8E, 0xF2, 0xE8, 0xA3, 0xF0, 0xF4, 0xFF, 0x02, 0x70, 0xF3, 0x63, 0x1E, 0xEE, 0x7D, 0xED,
+    0x08, 0xA8, 0x9B, 0x1F, 0x7B, 0x14, 0xB6, 0xFD, 0x31, 0xB8, 0x09, 0x3E, 0x43, 0x02, 0xFC, 0xDF,
+    0xEA, 0x5E, 0xBE, 0xA0, 0xFE, 0xF4, 0x3E, 0x9E, 0x82, 0x6D, 0x6E, 0x8E, 0xEF, 0x7D, 0x36, 0x79,
+    0x36, 0xF9, 0x57, 0x73, 0x37, 0xF7, 0x95, 0xE7, 0x6C, 0xD6, 0x56, 0xB9, 0xFC, 0x7D, 0xD2, 0x07,
+    0x2F, 0x3E, 0x11, 0xCF, 0xEA, 0x33, 0x5A, 0x5E, 0xFA, 0xF1, 0x75, 0x7F, 0xCB, 0x6F, 0xFC, 0x90,
+    0x81, 0x0A, 0x05, 0xFC, 0x81, 0x5E, 0xA5, 0xA1, 0xF2, 0xEF, 0xD5, 0xC0, 0xF6, 0x95, 0xEA, 0x5C,
+    0x7B, 0xD2, 0xDF, 0xB4, 0x97, 0xB5, 0xB9, 0x6B, 0x76, 0x7F, 0x87, 0x3D, 0x65, 0xAF, 0xE8, 0x36,
+    0xFF, 0x5E, 0x30, 0xDF, 0x7F, 0xFC, 0xEA, 0x2D, 0x67, 0xFD, 0xE9, 0x3B, 0x38, 0x7D, 0x57, 0x66,
+    0xEE, 0xE9, 0x38, 0xD1, 0x0C, 0x5F, 0xD3, 0xF5, 0xFF, 0xF4, 0x0F, 0xE4, 0xC9, 0xEE, 0xAE, 0xF0,
+    0x5F, 0x59, 0xA0, 0xF8, 0x8B, 0xEE, 0x1B, 0x57, 0xA6, 0xCF, 0x9F, 0xBD, 0xF9, 0xF9, 0xB3, 0x37,
+    0x7F, 0x63, 0x35, 0xCD, 0x5F, 0x0B, 0xF7, 0xA5, 0x2C, 0xFE, 0x63, 0x93, 0xB8, 0x2F, 0x9E, 0x06,
+    0x92, 0x1F, 0x04, 0xA0, 0x37, 0x1E, 0xAE, 0x52, 0xBD, 0xF5, 0x15, 0xB1, 0xCC, 0x45, 0x6A, 0xB8,
+    0xFD, 0x3B, 0x96, 0x4B, 0x40, 0xF6, 0x08, 0x90, 0xBD, 0xD8, 0x41, 0xEE, 0x8A, 0xBF, 0xFC, 0x8A,
+    0xD4, 0x4A, 0x64, 0x05, 0x6A, 0xFF, 0x0F, 0x61, 0x2E, 0xF2, 0xBE, 0x88, 0xBC, 0xB5, 0x13, 0xD5,
+    0xD6, 0x30, 0x17, 0x19, 0x6E, 0xDD, 0xD9, 0x79, 0x88, 0x1D, 0xC0, 0x8A, 0xEC, 0xB1, 0x55, 0xFE,
+    0xEF, 0xB2, 0x5A, 0x3C, 0x68, 0x39, 0x2F, 0xDE, 0x8E, 0x56, 0xFE, 0xE2, 0x3A, 0xE4, 0x22, 0x3D,
+    0xD5, 0x9B, 0x9C, 0xF7, 0x95, 0x85, 0xA6, 0x04, 0xB2, 0xFF, 0x0D, 0x60, 0x6F, 0xAC, 0x3B, 0x07,
+    0xC2, 0x42, 0x44, 0xE4, 0x3F, 0xEE, 0xEF, 0xEF, 0xEF, 0xF7, 0x00, 0x37, 0x8F, 0x60, 0x5D, 0x7B,
+    0xCB, 0x3F, 0x39, 0x75, 0xC7, 0xBD, 0xA7, 0xEE, 0xBD, 0xEF, 0xDE, 0xE7, 0x8B, 0xC7, 0x40, 0xDD,
+    0xFF, 0xFF, 0xDD, 0xFB, 0xDD, 0xCB, 0xED, 0x4D, 0x54, 0x35, 0x47, 0x8F, 0x1E, 0xF9, 0xDC, 0x1D,
+    0xA7, 0xEE, 0xBB, 0xF7, 0x51, 0x65, 0x7F, 0xEB, 0x07, 0x4F, 0xFC, 0x87, 0xF4, 0xDE, 0x53, 0xEE,
+    0x85, 0x25, 0x47, 0x8E, 0xDC, 0xF1, 0xB9, 0x53, 0x77, 0xDC, 0x77, 0xF0, 0x17, 0xBF, 0xFB, 0xD6,
+    0x7D, 0x29, 0x8F, 0xA6, 0x14, 0x0E, 0x52, 0x6E, 0x52, 0xFF, 0x6D, 0x7C, 0xE3, 0x63, 0xE3, 0xFD,
+    0x9B, 0xB8, 0x8F, 0x7F, 0x97, 0xFE, 0x1F, 0xA7, 0xEF, 0xD8, 0xFB, 0x47, 0xC9, 0x7F, 0xF3, 0xB9,
+    0x47, 0xEF, 0x3D, 0xB2, 0xBD, 0xFD, 0x5B, 0x7F, 0xF9, 0x27, 0x2F, 0xBC, 0xF0, 0xA7, 0x37, 0xDD,
+    0x74, 0xEF, 0x7D, 0xF7, 0x39, 0xF7, 0xEF, 0x8F, 0x69, 0x8E, 0x6C, 0xFF, 0xE5, 0x1D, 0x49, 0x7D,
+    0x9F, 0xE6, 0x31, 0x3E, 0x93, 0x7D, 0x69, 0xCF, 0xDD, 0x7B, 0xC7, 0x4D, 0x2A, 0x00, 0xBF, 0x51,
+    0x7F, 0xEF, 0xE6, 0xCF, 0x3D, 0xF6, 0x5F, 0xF3, 0x9F, 0x13, 0xC7, 0x91, 0x23, 0x37, 0x9F, 0x4A,
+    0x9F, 0xD6, 0x75, 0xE6, 0xEE, 0xF0, 0x8F, 0x3D, 0x16, 0xD3, 0xE6, 0x1B, 0x88, 0x92, 0x1D, 0xCD,
+    0x3C, 0x3B, 0x1A, 0x45, 0x2B, 0x2A, 0x59, 0x51, 0xEE, 0x3C, 0xF4, 0x01, 0xE8, 0xCD, 0x81, 0xF1,
+    0x28, 0xE2, 0xB5, 0x88, 0xD3, 0x6F, 0xED, 0xD8, 0xB5, 0xC8, 0x39, 0x9C, 0x3C, 0xCC, 0x2D, 0xE4,
+    0x3B, 0x3B, 0x14, 0x22, 0x54, 0xB2, 0xA2, 0x10, 0xE9, 0x2A, 0x91, 0xEE, 0xD6, 0xF9, 0xCE, 0xF6,
+    0x26, 0xC2, 0x36, 0x39, 0x04, 0x2B, 0x5D, 0xEE, 0x83, 0x48, 0x8B, 0x7C, 0xB7, 0x57, 0x81, 0xE5,
+    0x98, 0x16, 0xA8, 0x74, 0x4B, 0x95, 0x7A, 0xCA, 0xD4, 0x31, 0xCB, 0x1C, 0x83, 0xA9, 0x75, 0x6F,
+    0x1E, 0x90, 0x36, 0x7F, 0x40, 0xEA, 0x43, 0xF5, 0x7D, 0x57, 0xA2, 0x9E, 0xD7, 0x3E, 0x8A, 0xB0,
+    0x23, 0x6B, 0xE3, 0x6E, 0x49, 0x25, 0xCB, 0x8F, 0xE5, 0xE3, 0x23, 0xA2, 0x65, 0x1F, 0xE2, 0xE3,
+    0x50, 0x50, 0x70, 0xDD, 0x8D, 0xE6, 0x4D, 0x32, 0x11, 0xA7, 0x57, 0xF7, 0x5F, 0x62, 0x05, 0x14,
+    0x6B, 0x64, 0x76, 0xB3, 0xC6, 0x31, 0x77, 0xD1, 0xB8, 0x74, 0x7A, 0x84, 0xAE, 0x5A, 0xDD, 0xAE,
+    0xBB, 0x25, 0x85, 0x43, 0x60, 0xB7, 0x08, 0xA2, 0x58, 0xD4, 0x9F, 0x27, 0x39, 0x70, 0x4D, 0xB7,
+    0x0F, 0x55, 0x27, 0x56, 0x32, 0xB0, 0xBA, 0xFF, 0xD2, 0x47, 0x05, 0x8A, 0xD9, 0x04, 0x8A, 0xBB,
+    0x43, 0x81, 0xE2, 0xFC, 0x17, 0x07, 0x8A, 0x0B, 0x4C, 0xAD, 0x5B, 0xD5, 0xD1, 0x8C, 0x90, 0x0E,
+    0xD5, 0x8D, 0x4D, 0xA6, 0x6E, 0xEC, 0x37, 0x15, 0x68, 0x46, 0xA6, 0xD5, 0xBB, 0x6D, 0xF6, 0x67,
+    0xF5, 0x5D, 0x5B, 0x9B, 0x72, 0xE6, 0x35, 0x20, 0xE5, 0x30, 0xA8, 0xD2, 0x7E, 0x74, 0xA8, 0x36,
+    0xF5, 0x14, 0x6C, 0x70, 0x5F, 0x37, 0xA6, 0x92, 0xC6, 0x4C, 0x53, 0x71, 0x90, 0x69, 0xFA, 0xEB,
+    0x72, 0x64, 0x07, 0x29, 0xB4, 0x03, 0xFC, 0x67, 0x6E, 0x49, 0x03, 0xF3, 0x25, 0x99, 0x58, 0x3E,
+    0x6F, 0x63, 0x44, 0x4D, 0x1C, 0x90, 0xC7, 0x6F, 0xC5, 0xCE, 0x23, 0x35, 0x50, 0x46, 0x44, 0xC5,
+    0x84, 0x3C, 0x26, 0xCF, 0x8B, 0xA8, 0x4C, 0xAB, 0x88, 0x5F, 0x2A, 0x01, 0x3A, 0xE6, 0xDF, 0x81,
+    0x24, 0x30, 0x97, 0x16, 0xDD, 0x72, 0xF5, 0xB9, 0x1E, 0xED, 0x19, 0x18, 0x48, 0x1D, 0x3D, 0x33,
+    0x32, 0xA7, 0x3A, 0x4A, 0x4C, 0x9D, 0x04, 0x26, 0x18, 0x9B, 0x04, 0x66, 0x14, 0xE8, 0x36, 0xE2,
+    0x1E, 0x7D, 0xD2, 0xFF, 0xC6, 0x40, 0xEA, 0x1F, 0x09, 0x55, 0x47, 0x26, 0xE2, 0x2A, 0x8F, 0x39,
+    0x54, 0xD7, 0x56, 0xC4, 0x8E, 0x04, 0xED, 0xBA, 0xB5, 0x43, 0xC7, 0x08, 0x90, 0x8A, 0x90, 0xD9,
+    0x71, 0xB6, 0x22, 0x26, 0x0A, 0x63, 0x99, 0x80, 0xBA, 0xBE, 0xF3, 0xD5, 0xB7, 0x2C, 0x85, 0x88,
+    0x48, 0xAD, 0x63, 0x9F, 0xA2, 0x12, 0xFA, 0x64, 0xD0, 0x9E, 0xDC, 0x66, 0x6E, 0x8A, 0x0A, 0xCC,
+    0x32, 0x47, 0x41, 0xEA, 0x07, 0x74, 0x4B, 0x63, 0x6A, 0x26, 0x98, 0x17, 0x3A, 0x52, 0x9F, 0x74,
+    0x39, 0x5C, 0x39, 0xB6, 0x4A, 0x02, 0x46, 0xA4, 0x2E, 0x41, 0xA4, 0xA6, 0x10, 0xE9, 0x8C, 0xC8,
+    0x52, 0x3D, 0xFC, 0xB3, 0x11, 0x05, 0xBD, 0x86, 0xAA, 0x6F, 0x6A, 0xD2, 0x97, 0xFB, 0x96, 0x4A,
+    0x96, 0x98, 0x9F, 0x2F, 0x5C, 0xEA, 0x92, 0x3E, 0x19, 0x81, 0xEF, 0xAE, 0x8C, 0x11, 0xA3, 0x2E,
+    0x75, 0x4C, 0x93, 0x40, 0x41, 0x8F, 0x71, 0x93, 0xF1, 0xE2, 0x81, 0xDF, 0xBC, 0xDE, 0xE3, 0x67,
+    0x36, 0xA8, 0xA0, 0x03, 0x70, 0xCB, 0x8C, 0x92, 0xB4, 0xA5, 0xA7, 0x24, 0xF5, 0x3A, 0x50, 0x50,
+    0x41, 0xA3, 0x03, 0xBA, 0x2D, 0x2C, 0xE6, 0x81, 0x0E, 0x66, 0x79, 0x4D, 0x22, 0xFD, 0x08, 0x04,
+    0x2D, 0x1F, 0xA9, 0xA1, 0x2B, 0x20, 0x75, 0x13, 0x28, 0x18, 0xA0, 0x57, 0x1D, 0xBA, 0xD5, 0x2D,
+    0xB9, 0xCD, 0x1C, 0x4D, 0x5C, 0x92, 0x2A, 0xC2, 0xA8, 0xD6, 0x0E, 0x63, 0xBF, 0xC6, 0xB9, 0x44,
+    0x54, 0x61, 0x04, 0xD2, 0x6C, 0xFA, 0x9C, 0x34, 0x30, 0x50, 0x82, 0x60, 0x6A, 0x16, 0x75, 0xEA,
+    0x99, 0xFB, 0x24, 0x50, 0x76, 0x34, 0x94, 0x53, 0x4A, 0x8A, 0x02, 0x63, 0x73, 0x53, 0xA7, 0xDE,
+    0x9C, 0xF3, 0x49, 0x30, 0x4F, 0x04, 0x86, 0xCC, 0x35, 0x94, 0xA9, 0xAB, 0x30, 0xE7, 0xBC, 0xA9,
+    0xD3, 0x97, 0xDA, 0xD4, 0x27, 0xEF, 0x06, 0x15, 0xB8, 0x1E, 0x68, 0x28, 0x3B, 0x4A, 0xF2, 0x1E,
+    0x63, 0xB3, 0x81, 0xD4, 0x27, 0x03, 0x49, 0x60, 0x19, 0x91, 0x49, 0xDE, 0x80, 0xA9, 0x1B, 0xC8,
+    0xAF, 0x8D, 0x69, 0x9D, 0xC3, 0x28, 0xC4, 0xDC, 0x36, 0x30, 0xA8, 0x40, 0xE6, 0xB5, 0xA7, 0x8A,
+    0xEC, 0x14, 0x98, 0x9A, 0x29, 0x03, 0x74, 0xA9, 0x47, 0xB7, 0x15, 0x64, 0x2F, 0x04, 0xC8, 0x37,
+    0x15, 0xF8, 0xEF, 0x7B, 0xA2, 0x5B, 0xAF, 0xC3, 0x58, 0x1A, 0xC2, 0x30, 0xBA, 0xA6, 0x6A, 0x05,
+    0x5A, 0x5A, 0x30, 0xCB, 0x4D, 0xDC, 0xAE, 0x80, 0x49, 0x6C, 0x07, 0x54, 0x42, 0xC3, 0x0C, 0xFA,
+    0x08, 0x5E, 0x6B, 0x50, 0x1D, 0x3D, 0x49, 0xA0, 0x23, 0x09, 0x2A, 0xC4, 0xD6, 0x54, 0xDA, 0xEB,
+    0x40, 0xEA, 0x74, 0x4B, 0xE6, 0xB4, 0x8F, 0xE0, 0x4D, 0x53, 0x67, 0x2E, 0x36, 0xF2, 0xC9, 0x31,
+    0x35, 0x05, 0xB9, 0xA5, 0x22, 0xDF, 0xD9, 0xD9, 0xA5, 0x10, 0x59, 0x8E, 0x7D, 0x74, 0x52, 0xB7,
+    0x6E, 0x51, 0x15, 0xB1, 0x4C, 0x35, 0x63, 0xAF, 0xAD, 0xA3, 0x91, 0xD4, 0x31, 0x9D, 0x7C, 0x69,
+    0x2D, 0xA5, 0xCF, 0x7B, 0x44, 0x58, 0x7D, 0xD5, 0x5F, 0xA1, 0xDF, 0x65, 0x52, 0x51, 0x98, 0x7A,
+    0xFE, 0x94, 0xC8, 0x93, 0xB2, 0xFA, 0x60, 0xF5, 0xF0, 0xA9, 0x54, 0x56, 0xCC, 0x57, 0x1B, 0x01,
+    0xF9, 0xD7, 0xE2, 0xFA, 0x8F, 0x42, 0xB7, 0x68, 0xD5, 0x7B, 0xD2, 0x27, 0x52, 0x0F, 0x7A, 0x49,
+    0xA3, 0x3B, 0x1A, 0x1D, 0x7E, 0x31, 0x04, 0xA6, 0xFC, 0x90, 0xF4, 0x2F, 0xE0, 0xC8, 0x55, 0xC8,
+    0x07, 0xC8, 0xDB, 0x1B, 0x6B, 0xBA, 0x2D, 0xC9, 0xA6, 0xA6, 0xFB, 0xD8, 0xCA, 0x6A, 0x59, 0x71,
+    0xE6, 0xE1, 0x2E, 0xFE, 0x69, 0x07, 0x15, 0x14, 0x9E, 0xF3, 0x1D, 0xD5, 0x9B, 0x98, 0x76, 0xC3,
+    0xBC, 0x87, 0x8A, 0x53, 0x89, 0x48, 0x9D, 0x8D, 0x95, 0x60, 0x27, 0xAF, 0x53, 0x89, 0xAB, 0xBE,
+    0xFD, 0x74, 0x65, 0xC9, 0xED, 0x08, 0xE2, 0x53, 0x22, 0x6E, 0x21, 0x6D, 0xE4, 0x7F, 0x53, 0x18,
+    0xF7, 0x19, 0x25, 0x11, 0xA1, 0x7E, 0x62, 0x93, 0xAF, 0x5C, 0x7C, 0xA5, 0xFD, 0x1B, 0xE4, 0x2B,
+    0x2D, 0x70, 0x84, 0x8A, 0x6A, 0x0C, 0x83, 0x3C, 0x43, 0xA7, 0xBA, 0x24, 0x24, 0x41, 0xB7, 0xDA,
+    0xA7, 0x2E, 0x73, 0xC6, 0x99, 0xDA, 0xD8, 0x9C, 0x82, 0x92, 0x09, 0xDC, 0x6F, 0x8B, 0x2D, 0xFD,
+    0xB6, 0xBB, 0x6D, 0x04, 0x5E, 0x3F, 0x83, 0xB1, 0x2A, 0x44, 0xB9, 0x37, 0x21, 0xF5, 0xB1, 0xBC,
+    0xB6, 0xDF, 0x5C, 0x0D, 0x94, 0x11, 0x9C, 0x78, 0x24, 0x82, 0x1D, 0x0F, 0x45, 0x5B, 0x9E, 0x39,
+    0x04, 0x4F, 0x3D, 0x84, 0x32, 0xCD, 0x3E, 0x0A, 0x65, 0x3A, 0xB9, 0x01, 0x5C, 0xF9, 0x70, 0x40,
+    0x3C, 0x0B, 0x0B, 0xEC, 0xEF, 0xEF, 0x01, 0x73, 0xE9, 0x80, 0x62, 0x7F, 0x80, 0x18, 0xB1, 0x26,
+    0xF5, 0xB1, 0xF7, 0xA0, 0xF6, 0x40, 0xAF, 0x7E, 0x7E, 0x1D, 0x26, 0x2C, 0x24, 0x90, 0x53, 0xFD,
+    0xEE, 0x82, 0xCC, 0x99, 0x3A, 0x73, 0xBA, 0xD5, 0xAD, 0xEA, 0x54, 0x47, 0xC7, 0x94, 0x86, 0x92,
+    0x8A, 0x2B, 0x64, 0xBE, 0xB8, 0x28, 0x20, 0xE2, 0x56, 0x60, 0xA4, 0x1E, 0x43, 0x12, 0x3C, 0xC3,
+    0x29, 0xD0, 0x3E, 0xB6, 0xC2, 0x8B, 0x55, 0x7C, 0x25, 0x11, 0xDF, 0x1E, 0x01, 0xEE, 0xEC, 0xEE,
+    0x9C, 0xFF, 0xB6, 0x4D, 0x44, 0x44, 0x7C, 0xF6, 0xE3, 0xEF, 0xFE, 0x7C, 0xE1, 0x4B, 0x8C, 0x35,
+    0xAE, 0x63, 0x42, 0x91, 0x3A, 0x3A, 0x9A, 0x02, 0xED, 0x75, 0x3B, 0x60, 0x5C, 0x71, 0xAE, 0x25,
+    0x97, 0xDE, 0x58, 0x72, 0xB1, 0x87, 0xA0, 0x46, 0xBF, 0xB0, 0x34, 0xE5, 0x27, 0x7F, 0xBB, 0xD2,
+    0x94, 0x03, 0x2C, 0xCC, 0x08, 0x61, 0x38, 0x84, 0x85, 0x79, 0x86, 0xDF, 0xA3, 0xA3, 0x57, 0x41,
+    0x87, 0x24, 0x18, 0xA7, 0xDB, 0x0A, 0xED, 0x1B, 0xD2, 0x1F, 0x74, 0x64, 0xE2, 0xC9, 0xC4, 0x61,
+    0x2E, 0xB6, 0x98, 0x07, 0x02, 0x39, 0x3D, 0x05, 0x0D, 0xD5, 0x61, 0x94, 0xB3, 0xB2, 0xE3, 0xE9,
+    0x38, 0xE4, 0x2C, 0x1E, 0x1F, 0x9B, 0x90, 0xDD, 0x9E, 0x3A, 0xFA, 0x02, 0xED, 0x7B, 0xF2, 0x73,
+    0x2D, 0xD3, 0xDC, 0x26, 0x61, 0x8A, 0x79, 0x32, 0x30, 0x31, 0xB5, 0x0A, 0x13, 0xB2, 0x17, 0x02,
+    0x55, 0xEA, 0x92, 0x3E, 0x27, 0xF7, 0xBB, 0xC9, 0x35, 0x64, 0x39, 0x55, 0xF2, 0x72, 0x1B, 0xDF,
+    0xF0, 0xF4, 0xB1, 0x1A, 0xED, 0x4A, 0x30, 0xAF, 0x05, 0x30, 0x72, 0x68, 0xA6, 0x92, 0x9A, 0xDB,
+    0x31, 0x96, 0x9E, 0x32, 0x6E, 0xB9, 0x92, 0x24, 0x16, 0x66, 0x1B, 0x1B, 0x13, 0x53, 0x53, 0xED,
+    0xA1, 0xAB, 0x40, 0xBF, 0xDC, 0x81, 0xF9, 0xB2, 0x83, 0x33, 0x5B, 0xC0, 0xBF, 0x69, 0x41, 0x5D,
+    0x5B, 0x37, 0x34, 0x33, 0x6E, 0xD4, 0x79, 0x49, 0x58, 0x37, 0xEC, 0x18, 0x40, 0xE5, 0x0E, 0xF2,
+    0x25, 0x30, 0xAF, 0xE3, 0x60, 0x5F, 0xCF, 0xD1, 0x6D, 0x83, 0x39, 0xD7, 0x32, 0x33, 0xB5, 0x0A,
+    0x33, 0xB2, 0x17, 0x02, 0x65, 0xE6, 0xE8, 0x4A, 0x52, 0xD7, 0x51, 0xA4, 0x8E, 0x21, 0x27, 0x6B,
+    0xA7, 0xCC, 0xEF, 0xEF, 0xB3, 0x46, 0xCB, 0xCF, 0x42, 0x2A, 0x5F, 0xAA, 0xB1, 0xA0, 0x9E, 0xFF,
+    0x10, 0xC2, 0x24, 0x8F, 0xFB, 0xB9, 0x41, 0x07, 0xF4, 0x1B, 0x01, 0xE3, 0xC8, 0xBF, 0xEC, 0x28,
+    0xA1, 0x89, 0xA9, 0xD7, 0x36, 0xE2, 0xA1, 0xCF, 0xB5, 0xE4, 0x35, 0x8D, 0xA9, 0x59, 0xA1, 0xDB,
+    0x92, 0xB4, 0x27, 0x67, 0xA0, 0x6A, 0x19, 0x74, 0x48, 0xC4, 0xA5, 0xDE, 0x38, 0x53, 0x51, 0x50,
+    0xD0, 0x37, 0x74, 0x34, 0xE9, 0x8B, 0x21, 0x73, 0xAA, 0x9B, 0xA4, 0x7E, 0x46, 0xFA, 0x83, 0x60,
+    0x2E, 0x06, 0xCC, 0xB7, 0x6C, 0x95, 0x43, 0xD5, 0xD0, 0x74, 0xB0, 0x70, 0x4A, 0x1C, 0x6A, 0x85,
+    0x8E, 0x30, 0x59, 0xE3, 0x37, 0xEA, 0xE7, 0x76, 0x8E, 0xD5, 0x3C, 0xD3, 0x50, 0xA1, 0x5F, 0x69,
+    0xE9, 0xC9, 0x4D, 0xAD, 0x5B, 0xFA, 0x12, 0x53, 0x6B, 0xDF, 0x53, 0x52, 0xE8, 0x96, 0x9E, 0xDE,
+    0xD4, 0xA6, 0x4D, 0x5D, 0xC9, 0xA2, 0x2E, 0x69, 0xD2, 0xFF, 0xA2, 0x42, 0x12, 0xB6, 0x1A, 0x63,
+    0xD3, 0x97, 0x5E, 0x0E, 0x0D, 0xE6, 0x1F, 0xEA, 0xEF, 0x39, 0xCA, 0x60, 0xAE, 0xC0, 0xC2, 0x16,
+    0xED, 0xDA, 0xA8, 0xDA, 0x18, 0x6A, 0x99, 0x48, 0x10, 0x59, 0x1D, 0x3D, 0xBF, 0x63, 0x0F, 0xD5,
+    0xF1, 0xCC, 0xA5, 0xCE, 0x44, 0x58, 0x3E, 0x3C, 0x98, 0x3A, 0x7B, 0xB9, 0x63, 0x96, 0xA3, 0x7F,
+    0x10, 0x98, 0x95, 0x98, 0x97, 0x7C, 0xD2, 0xCF, 0xBE, 0x22, 0x99, 0x48, 0xBD, 0x58, 0xAD, 0x41,
+    0x6D, 0x49, 0xBD, 0xB0, 0x60, 0x72, 0xA9, 0x61, 0x76, 0x7D, 0x0E, 0x89, 0xD0, 0x80, 0x09, 0x2A,
+    0x40, 0x45, 0xE6, 0x50, 0x3D, 0x15, 0xA4, 0x1E, 0x91, 0xBA, 0x40, 0x8B, 0xB8, 0x81, 0xDC, 0x16,
+    0xE7, 0x5A, 0x1A, 0xCA, 0xDC, 0x26, 0x81, 0xBE, 0x21, 0x73, 0xE9, 0x2B, 0x81, 0xBC, 0xAE, 0x8C,
+    0xA3, 0x92, 0xAE, 0x84, 0x62, 0x75, 0x83, 0x71, 0x40, 0xEA, 0x38, 0x26, 0x6F, 0xD2, 0x90, 0x8A,
+    0x78, 0x53, 0x2B, 0xF9, 0xDD, 0x29, 0x5D, 0xB4, 0xAD, 0xAD, 0x71, 0x90, 0x04, 0x1D, 0x7B, 0x32,
+    0xEE, 0xC6, 0x70, 0x55, 0x4C, 0x22, 0xF5, 0x40, 0x2A, 0x22, 0xE2, 0x58, 0x88, 0xC8, 0x80, 0x79,
+    0x75, 0xBE, 0xB3, 0x03, 0xBD, 0x0E, 0x80, 0xB1, 0x15, 0xA0, 0xD6, 0x7F, 0x19, 0xFB, 0x39, 0xAA,
+    0xD8, 0x12, 0xC8, 0x78, 0x48, 0x3D, 0xF3, 0xFA, 0xF3, 0x4C, 0x49, 0x44, 0xDA, 0xCC, 0xC5, 0x46,
+    0x0F, 0xA3, 0x2B, 0xF0, 0x0C, 0x27, 0xAF, 0x33, 0xA1, 0x10, 0x97, 0x53, 0xBD, 0xFA, 0x74, 0xE6,
+    0x0A, 0x1B, 0x13, 0x5E, 0xF4, 0x99, 0x83, 0x52, 0xB7, 0x90, 0x8B, 0x88, 0xCB, 0x44, 0xA4, 0xD5,
+    0xA1, 0x60, 0xBC, 0x33, 0x49, 0x02, 0xE4, 0xCC, 0x20, 0x73, 0xC6, 0x7F, 0x46, 0xB7, 0x4A, 0x84,
+    0x8E, 0x5C, 0xEA, 0x8D, 0x30, 0xB8, 0xCC, 0x58, 0x5F, 0x5A, 0x39, 0x50, 0x62, 0xC1, 0xFC, 0xF7,
+    0x40, 0x73, 0x19, 0xF4, 0x0F, 0x02, 0x54, 0xA9, 0x43, 0x75, 0x06, 0x8C, 0x2C, 0xC7, 0xCE, 0x08,
+    0x6F, 0xBF, 0xDD, 0x52, 0x98, 0x07, 0x9D, 0xEA, 0xB6, 0x72, 0xCC, 0x0B, 0x61, 0xCA, 0x34, 0x73,
+    0x9D, 0x6E, 0x4B, 0xDD, 0x16, 0x74, 0xC6, 0x75, 0xDA, 0x15, 0xC6, 0xE5, 0x4C, 0x67, 0x5C, 0x56,
+    0x1D, 0xDC, 0x5E, 0xC7, 0xB7, 0xCF, 0x3D, 0xBC, 0xD7, 0x92, 0xBC, 0xDB, 0xA2, 0x5F, 0x0E, 0x98,
+    0x27, 0x02, 0xB9, 0x74, 0x54, 0xD2, 0xD1, 0x5C, 0xEE, 0xE9, 0xFA, 0x26, 0x09, 0x5D, 0x93, 0xFA,
+    0x30, 0x35, 0x4F, 0x84, 0x49, 0x9E, 0xB4, 0x93, 0x52, 0xFB, 0x32, 0xD6, 0x0B, 0x26, 0x81, 0x34,
+    0x60, 0x6A, 0x2A, 0xC7, 0x04, 0x25, 0x56, 0x75, 0x98, 0xFF, 0x8B, 0xCC, 0xD1, 0x5C, 0xA6, 0x40,
+    0xBF, 0x1C, 0xE8, 0xA9, 0x52, 0xA7, 0xBD, 0xEA, 0x8C, 0xCD, 0x45, 0x64, 0xC9, 0x42, 0x44, 0x7A,
+    0xFD, 0xB3, 0x87, 0xDF, 0x7E, 0x3B, 0x98, 0xBA, 0x30, 0x0F, 0xBA, 0x09, 0xDD, 0x56, 0xAE, 0x82,
+    0x79, 0x21, 0xCC, 0x32, 0x37, 0xCD, 0x5C, 0x57, 0xEA, 0xB6, 0xD4, 0x6D, 0x5F, 0xD0, 0x99, 0xEF,
+    0xF9, 0x5E, 0xBB, 0x22, 0x37, 0x2E, 0x67, 0xDA, 0x44, 0xC2, 0x9F, 0xE1, 0xF6, 0x9A, 0x8E, 0xCA,
+    0xA9, 0x8E, 0x85, 0x4B, 0x82, 0xFA, 0xA9, 0x4F, 0x82, 0x7E, 0xC3, 0xEB, 0x36, 0x7D, 0xB1, 0xD5,
+    0xAD, 0x79, 0x32, 0xA4, 0x22, 0x12, 0x32, 0x11, 0x09, 0xC6, 0x0D, 0x7D, 0x67, 0x9E, 0x08, 0x5D,
+    0x6F, 0xCE, 0xB5, 0xA1, 0xCF, 0xB3, 0x17, 0x42, 0x53, 0x98, 0x07, 0xDA, 0x69, 0x59, 0x68, 0x3F,
+    0x9D, 0xCC, 0xB4, 0x9F, 0xA0, 0x45, 0x24, 0x60, 0x44, 0xC4, 0x51, 0xED, 0xEC, 0x2C, 0xA1, 0x21,
+    0xF3, 0xD0, 0x47, 0x48, 0x5A, 0xDA, 0x82, 0x6E, 0x77, 0x19, 0xA1, 0xA5, 0x98, 0xAB, 0x40, 0x22,
+    0x2B, 0x88, 0xC5, 0xBB, 0x69, 0xDB, 0x5D, 0x85, 0x32, 0xF5, 0x03, 0x49, 0x28, 0x92, 0x80, 0xA9,
+    0x87, 0xD4, 0xD1, 0xE8, 0x36, 0x47, 0xB7, 0xC6, 0xCE, 0x28, 0x98, 0xD2, 0xD1, 0x27, 0x41, 0xFB,
+    0xD4, 0x19, 0x67, 0x6C, 0x94, 0xDA, 0xDC, 0xB4, 0xBF, 0xFF, 0x2C, 0x0B, 0x91, 0x96, 0x9F, 0xEF,
+    0x2F, 0xE2, 0xEE, 0xD5, 0xBE, 0x82, 0xF4, 0xA5, 0x16, 0xCC, 0x02, 0x12, 0x11, 0xA8, 0x16, 0x0B,
+    0x74, 0xDB, 0x97, 0x14, 0xDA, 0x37, 0x74, 0x79, 0x12, 0x32, 0x37, 0x4D, 0xDD, 0x24, 0x69, 0x73,
+    0x1D, 0x8C, 0x9D, 0xE4, 0x76, 0x8B, 0x8E, 0x69, 0x22, 0x22, 0x5D, 0x12, 0x8C, 0x88, 0x38, 0x53,
+    0x57, 0x3B, 0x3B, 0x57, 0x99, 0x30, 0x23, 0x6D, 0x55, 0xEC, 0x4E, 0x9C, 0x39, 0xD5, 0xE9, 0x68,
+    0x0A, 0x44, 0xEF, 0xEF, 0x95, 0x80, 0xF6, 0x18, 0x89, 0x7B, 0x74, 0x65, 0x59, 0x88, 0x88, 0x58,
+    0xFD, 0xB3, 0x87, 0xBB, 0x61, 0x8E, 0xA9, 0x0B, 0xDD, 0xCE, 0x98, 0xA8, 0xCE, 0xD8, 0x4E, 0x05,
+    0xE3, 0xA6, 0xDA, 0x67, 0x6E, 0x96, 0x04, 0x53, 0x97, 0x3A, 0x98, 0xBA, 0xA4, 0x37, 0xB6, 0xA4,
+    0x4F, 0x7D, 0xA3, 0x3A, 0xDD, 0xE6, 0xBA, 0xCD, 0x9C, 0x71, 0x4D, 0x11, 0x1D, 0x87, 0x67, 0x6E,
+    0xDA, 0xDF, 0x7F, 0x96, 0x2E, 0x17, 0x19, 0x54, 0x67, 0xF6, 0xBF, 0x1B, 0x92, 0x90, 0xB9, 0xCC,
+    0x25, 0x41, 0xFB, 0x02, 0xDD, 0xAA, 0x30, 0xA0, 0x5B, 0xFE, 0x6D, 0x20, 0x15, 0x91, 0x25, 0x99,
+    0xC8, 0x62, 0x81, 0x71, 0x43, 0x69, 0x6A, 0xF3, 0x64, 0x98, 0x64, 0xCE, 0x9C, 0x6B, 0xB7, 0x52,
+    0x97, 0x67, 0x6E, 0x9A, 0xBA, 0xC2, 0xD8, 0xCB, 0xDA, 0x97, 0x05, 0xBD, 0xF6, 0x93, 0x09, 0x9D,
+    0x6E, 0xE1, 0x6B, 0xA9, 0x43, 0xBF, 0x3C, 0x40, 0xDE, 0x00, 0x0B, 0x8B, 0x5A, 0xF4, 0x20, 0xD2,
+    0x91, 0xEF, 0x15, 0x0E, 0x1B, 0x73, 0x76, 0x87, 0xDB, 0x24, 0xAB, 0x0E, 0xB8, 0x0A, 0x22, 0x36,
+    0x5A, 0x13, 0x3B, 0x8B, 0x7A, 0xCC, 0x0D, 0x6D, 0x1C, 0xFF, 0xCD, 0x0F, 0xC6, 0x43, 0x36, 0x70,
+    0x4C, 0x56, 0x64, 0xB2, 0xB2, 0x6A, 0xF5, 0x87, 0x87, 0xD2, 0x54, 0xD5, 0x8F, 0x57, 0xB5, 0x12,
+    0x19, 0x50, 0xFB, 0xFB, 0x23, 0x86, 0x47, 0x71, 0x82, 0xF4, 0x89, 0x81, 0xE4, 0x8D, 0x37, 0x41,
+    0x2C, 0xC7, 0xC4, 0x52, 0x49, 0x4B, 0xF9, 0x70, 0x18, 0x53, 0x22, 0x63, 0x58, 0xE3, 0xA4, 0xC7,
+    0xAC, 0x46, 0x05, 0x9A, 0xB9, 0x28, 0x6F, 0xD7, 0xE1, 0x8D, 0xC2, 0xF1, 0x8F, 0x57, 0x64, 0xD2,
+    0x52, 0xFD, 0x61, 0xA4, 0x7B, 0x46, 0x6C, 0xA5, 0x6C, 0x62, 0x0E, 0x8E, 0xCC, 0x65, 0x2E, 0x73,
+    0x3D, 0x03, 0x83, 0xA9, 0x4D, 0x6D, 0x9E, 0xE8, 0x54, 0xA7, 0xBA, 0x82, 0x82, 0x42, 0x87, 0x24,
+    0x24, 0xA1, 0xA4, 0xA4, 0xD4, 0x5E, 0x7B, 0xED, 0x67, 0xCC, 0x98, 0xA6, 0x3E, 0x73, 0xC6, 0xCD,
+    0x18, 0x54, 0xA7, 0x83, 0xA9, 0x2B, 0xAA, 0xBA, 0xCB, 0x1D, 0x22, 0x12, 0x88, 0x38, 0x6E, 0x35,
+    0xDF, 0x5E, 0xF3, 0x15, 0x21, 0xEC, 0x31, 0xDB, 0xD8, 0x6C, 0x9A, 0x03, 0x1E, 0x80, 0x4A, 0x63,
+    0x5C, 0x48, 0x85, 0xF5, 0x43, 0xA3, 0x7F, 0xCE, 0x33, 0xA9, 0x3B, 0x95, 0xFA, 0x5C, 0x85, 0x9C,
+    0x26, 0xF5, 0x8D, 0x6E, 0xF3, 0x73, 0xAD, 0xB1, 0x33, 0x63, 0xA7, 0x2A, 0x4C, 0x93, 0x90, 0xBD,
+    0x18, 0x4C, 0x5D, 0x18, 0x57, 0xD2, 0x97, 0x74, 0xA9, 0xEF, 0x53, 0x57, 0xE8, 0xB6, 0x50, 0x9D,
+    0x71, 0xBD, 0x71, 0xC5, 0x4B, 0x3F, 0x18, 0xA8, 0xA2, 0x03, 0xFC, 0xE6, 0xB8, 0x02, 0xA6, 0xFE,
+    0xD0, 0x58, 0xC5, 0xC6, 0x77, 0x1C, 0xE3, 0x3C, 0x7B, 0x24, 0x22, 0x2D, 0x95, 0x3F, 0xDF, 0xEA,
+    0x1E, 0xE3, 0x8A, 0x9A, 0xBC, 0x1E, 0xA0, 0xCA, 0x3C, 0x0C, 0x15, 0x24, 0xEF, 0xF4, 0x90, 0x7D,
+    0x5F, 0x44, 0xA4, 0x10, 0x91, 0x61, 0xB5, 0xBF, 0xFF, 0xDD, 0x9F, 0x06, 0xC8, 0xBF, 0xE5, 0xE0,
+    0x4A, 0x05, 0x3A, 0x34, 0x50, 0x3C, 0xD1, 0xC3, 0xA0, 0x3B, 0x72, 0x9F, 0xF6, 0xC9, 0x2A, 0x02,
+    0xA4, 0x93, 0x03, 0x10, 0xC9, 0xC9, 0xFF, 0x4C, 0x22, 0xCB, 0x88, 0x66, 0xA7, 0xCF, 0xEB, 0x64,
+    0x83, 0x66, 0x8F, 0x81, 0xCC, 0x03, 0x34, 0x7B, 0x12, 0x66, 0x1F, 0x46, 0xB3, 0x6F, 0x81, 0x79,
+    0xC3, 0xA3, 0x65, 0x02, 0x4B, 0xDD, 0x92, 0xDB, 0x32, 0x76, 0xAD, 0x99, 0x51, 0x60, 0x5C, 0x12,
+    0x54, 0x47, 0x4E, 0x85, 0x0A, 0xA9, 0x8F, 0xAD, 0xD2, 0xBA, 0xDC, 0x62, 0xCE, 0x05, 0xE8, 0x27,
+    0x60, 0xBE, 0xE9, 0xE0, 0x72, 0x07, 0xD9, 0x35, 0xA2, 0x9C, 0x4E, 0x87, 0x11, 0x3F, 0xAA, 0x03,
+    0xF0, 0x75, 0xD4, 0x9F, 0x04, 0xAA, 0xEF, 0x39, 0xD5, 0xE5, 0xD6, 0xD4, 0x13, 0x1A, 0x3A, 0xDD,
+    0xEA, 0x36, 0xC7, 0xD4, 0x3D, 0x45, 0xEA, 0x68, 0x4A, 0xD4, 0x3B, 0x81, 0xF4, 0xFB, 0x35, 0x66,
+    0x16, 0x3B, 0x87, 0x89, 0x45, 0x0F, 0x70, 0x54, 0xD9, 0x38, 0x51, 0xFA, 0xE5, 0x0E, 0x8A, 0xCC,
+    0xC1, 0xA5, 0x7B, 0x0E, 0x90, 0x2B, 0xDA, 0xC1, 0x6A, 0x02, 0xD5, 0x4F, 0x3D, 0xC6, 0x97, 0xB1,
+    0x99, 0x5B, 0x45, 0x41, 0xEA, 0x93, 0xC0, 0x40, 0x41, 0x6E, 0x55, 0xD0, 0x21, 0xAA, 0xB1, 0xCE,
+    0x38, 0xCC, 0xFD, 0x5D, 0xB4, 0xF2, 0xCC, 0x45, 0x0F, 0x7D, 0x03, 0xD9, 0xB7, 0x2C, 0x5C, 0x0D,
+    0x90, 0xAE, 0x03, 0x62, 0xBA, 0x1B, 0x0F, 0xD8, 0x43, 0xB7, 0xA2, 0xBA, 0x2B, 0xD1, 0xB6, 0x72,
+    0x81, 0xF4, 0x85, 0x16, 0x15, 0x0D, 0xCA, 0xDB, 0xE1, 0xEB, 0x53, 0xCC, 0x3B, 0x81, 0x59, 0xEA,
+    0x75, 0x6B, 0x6C, 0xC1, 0x84, 0x9E, 0x3E, 0x75, 0xBA, 0x2D, 0xC9, 0x5E, 0x08, 0x14, 0xA6, 0x66,
+    0x3A, 0x45, 0xBD, 0xDB, 0xA2, 0x5F, 0xB7, 0x98, 0x06, 0x2A, 0x0F, 0xC2, 0x0D, 0xF5, 0x3A, 0xB2,
+    0xB7, 0xCE, 0x62, 0x44, 0xE8, 0x70, 0xE5, 0xCF, 0xC7, 0x34, 0x56, 0x1F, 0x2D, 0x4D, 0x8A, 0x7A,
+    0xAC, 0x3A, 0x1C, 0xA0, 0x3A, 0x56, 0x73, 0x77, 0xE6, 0x61, 0xC8, 0x51, 0x5D, 0x05, 0x49, 0x98,
+    0x60, 0x5E, 0xE8, 0x21, 0x73, 0x1D, 0xB3, 0xCC, 0x43, 0xA1, 0x47, 0x0D, 0x3E, 0x98, 0x3A, 0xB7,
+    0x03, 0xE8, 0x50, 0x44, 0x1B, 0x22, 0xAF, 0x9B, 0xD4, 0x19, 0x07, 0x57, 0x54, 0x28, 0xA9, 0x40,
+    0x07, 0xFD, 0x62, 0xA0, 0x81, 0xA2, 0x36, 0x5F, 0xAE, 0x55, 0x0F, 0x03, 0x93, 0x29, 0xBA, 0x23,
+    0xF7, 0xBC, 0xE7, 0x49, 0xFB, 0x64, 0x45, 0x72, 0x8D, 0xB8, 0xDB, 0xD2, 0x8E, 0xB8, 0xE3, 0x72,
+    0x37, 0xEE, 0xBA, 0xD9, 0xBA, 0x08, 0x33, 0x1C, 0x2A, 0xB9, 0xE4, 0xF0, 0x09, 0xC8, 0x47, 0xB9,
+    0x53, 0xAC, 0xAB, 0xFD, 0x62, 0x23, 0xBF, 0x93, 0x6F, 0xF2, 0x9B, 0xA8, 0xA7, 0x13, 0x19, 0xE8,
+    0x31, 0xAE, 0xFA, 0xA3, 0x41, 0xB7, 0xCC, 0x92, 0x4E, 0xF5, 0x99, 0xD3, 0x6D, 0x5E, 0xEB, 0x50,
+    0x90, 0xD3, 0x90, 0xB9, 0x29, 0xBD, 0x6E, 0x29, 0x54, 0xC8, 0x5C, 0x6E, 0x69, 0xA2, 0x3E, 0xD7,
+    0xC1, 0x3C, 0x10, 0x92, 0x80, 0xA9, 0x4B, 0x63, 0x33, 0xC7, 0x8C, 0xCB, 0x0D, 0x39, 0x3A, 0x24,
+    0x6F, 0x78, 0x76, 0xC9, 0x6D, 0x7A, 0x0D, 0x96, 0x49, 0x8F, 0xE9, 0x62, 0xCC, 0xAA, 0x72, 0xB1,
+    0x16, 0x76, 0xA4, 0x62, 0x0D, 0xD2, 0x2E, 0x6E, 0xA4, 0x36, 0x4E, 0x77, 0x84, 0xCF, 0xAE, 0x1B,
+    0xF3, 0x81, 0x1E, 0x43, 0x70, 0xC7, 0xEC, 0x08, 0xAC, 0x28, 0xC4, 0x92, 0x89, 0x38, 0x64, 0x21,
+    0xCE, 0xB4, 0x5F, 0x2F, 0xEA, 0xAB, 0x50, 0xE9, 0x00, 0xB3, 0xC2, 0xC6, 0x9E, 0x75, 0xFA, 0x6D,
+    0x0F, 0xE6, 0x39, 0xA0, 0x6C, 0x80, 0xF7, 0x03, 0xA4, 0xAF, 0x3B, 0x28, 0x36, 0x95, 0x2B, 0x3F,
+    0x0A, 0x50, 0xA5, 0x2D, 0x49, 0x6F, 0xFC, 0x76, 0xE1, 0xF2, 0x6B, 0x6F, 0x0F, 0x31, 0xE6, 0x98,
+    0xC9, 0x9B, 0x63, 0x4F, 0xC4, 0xEC, 0x50, 0x13, 0x0A, 0xB5, 0xD8, 0xA3, 0x90, 0x56, 0xBF, 0x2F,
+    0x6D, 0xF1, 0xF7, 0xB2, 0x17, 0x7A, 0xF2, 0x07, 0x1D, 0x65, 0x09, 0xD7, 0x3B, 0xF4, 0x4F, 0x1C,
+    0xF9, 0x79, 0x98, 0x36, 0xE8, 0x77, 0x02, 0xF9, 0xC5, 0x96, 0xC1, 0xBC, 0xF6, 0xBA, 0x37, 0xB2,
+    0x24, 0x93, 0xE8, 0xD5, 0x1F, 0xEE, 0xD9, 0x98, 0x5E, 0x8F, 0xFB, 0x6D, 0x65, 0x81, 0xAD, 0x63,
+    0x03, 0xA0, 0xBE, 0x7C, 0xBF, 0x5D, 0x57, 0x04, 0x8D, 0x81, 0xFC, 0x08, 0x72, 0x86, 0xDB, 0x0E,
+    0xFD, 0xE1, 0xCA, 0x9E, 0xEF, 0xD0, 0x32, 0x18, 0x69, 0x59, 0x7D, 0xC9, 0x76, 0x73, 0x5B, 0x59,
+    0x50, 0x7D, 0xDA, 0x02, 0xC6, 0xC5, 0x82, 0xC4, 0xDC, 0x02, 0xD9, 0x4B, 0x01, 0xC6, 0x4C, 0x08,
+    0xE6, 0x7B, 0x1E, 0x60, 0x88, 0xB2, 0xFA, 0x9B, 0x8E, 0x5B, 0x51, 0xDD, 0x80, 0xF6, 0x14, 0xC6,
+    0x31, 0x43, 0x87, 0x81, 0xCC, 0x31, 0x33, 0x8E, 0x01, 0xE3, 0x1A, 0x4C, 0x9D, 0x74, 0x69, 0xAB,
+    0x7A, 0xE6, 0x54, 0xF5, 0xA2, 0x2D, 0x9C, 0x12, 0x11, 0x09, 0xA4, 0xE2, 0x17, 0x11, 0xA1, 0xBF,
+    0x0D, 0x90, 0x3C, 0x33, 0x62, 0xA1, 0xD1, 0x2F, 0x2F, 0x1C, 0xFC, 0xF0, 0x89, 0xE7, 0xD7, 0x3C,
+    0x18, 0xD6, 0xFD, 0x3A, 0xD2, 0xFA, 0xF0, 0x69, 0x53, 0x57, 0xED, 0xA2, 0xD6, 0xD2, 0xCE, 0x07,
+    0x7D, 0xFD, 0xD1, 0xCF, 0xCE, 0x1F, 0xE8, 0x88, 0x8D, 0x06, 0x23, 0x71, 0x45, 0x09, 0x64, 0xAF,
+    0x5B, 0xD0, 0xEF, 0xB9, 0xA4, 0xE5, 0xE7, 0x81, 0x9E, 0xB2, 0x61, 0x42, 0x91, 0x93, 0x63, 0xBE,
+    0xE7, 0x33, 0x97, 0xF9, 0x65, 0xDA, 0x99, 0x36, 0x17, 0x91, 0x56, 0xC9, 0x8F, 0xC4, 0xA3, 0xD6,
+    0xE5, 0x45, 0xE2, 0x80, 0x7F, 0x73, 0xF5, 0x5F, 0x01, 0xD4, 0xF5, 0x17, 0xB8, 0xF1, 0x33, 0x25,
+    0x09, 0xE8, 0x1F, 0x05, 0x8C, 0xC3, 0x7C, 0xCB, 0x51, 0xC1, 0xAC, 0x82, 0x9E, 0x24, 0x1A, 0x19,
+    0xE6, 0x62, 0x04, 0x6A, 0x99, 0x9A, 0x5D, 0x92, 0x50, 0xA2, 0x7B, 0x4C, 0xDD, 0x93, 0xB7, 0x4C,
+    0x75, 0x40, 0x6A, 0x1D, 0x8C, 0xCB, 0x84, 0xDC, 0x56, 0x6C, 0x0D, 0x34, 0x34, 0xFA, 0x47, 0x41,
+    0xFB, 0x24, 0xE4, 0x99, 0x2B, 0x48, 0x7D, 0x97, 0xDF, 0xDF, 0x91, 0x3F, 0xE8, 0x4A, 0xE3, 0x28,
+    0x27, 0x0C, 0x53, 0x58, 0x85, 0xE4, 0xA7, 0x9E, 0x44, 0x48, 0x05, 0xD2, 0x1E, 0x13, 0xCB, 0x16,
+    0x2A, 0x7B, 0x68, 0x42, 0xF6, 0xF7, 0x9F, 0x85, 0xEC, 0x27, 0x3F, 0x69, 0xE1, 0x8E, 0x9B, 0xF5,
+    0x0D, 0x14, 0x7F, 0x9D, 0xDB, 0x49, 0xFE, 0x20, 0x30, 0x60, 0xBE, 0x5C, 0xEB, 0x96, 0x69, 0x89,
+    0xA9, 0x75, 0xDB, 0x53, 0x62, 0xCE, 0xB5, 0xF4, 0x34, 0xA6, 0xD6, 0xAD, 0x6E, 0x4B, 0xAA, 0x3A,
+    0xA7, 0x4F, 0x56, 0xF4, 0x49, 0xC8, 0x2F, 0xA7, 0x2E, 0x73, 0xEF, 0x86, 0x09, 0xB9, 0xF9, 0xD2,
+    0x8B, 0x81, 0xC9, 0x05, 0x93, 0xC3, 0xFB, 0xAE, 0xEC, 0x48, 0x96, 0x2C, 0xEA, 0x31, 0x00, 0xB2,
+    0x29, 0xE9, 0x50, 0x22, 0x21, 0x59, 0xDD, 0x7F, 0x21, 0x19, 0x46, 0xA0, 0xC9, 0x30, 0xE2, 0x4B,
+    0xAA, 0x43, 0xF5, 0xEC, 0xC9, 0xE1, 0xC6, 0x76, 0x1B, 0xE0, 0x49, 0xB3, 0xEE, 0x68, 0xD3, 0x8D,
+    0x5E, 0x77, 0x26, 0x01, 0xE6, 0xFD, 0x1A, 0x81, 0x63, 0x0F, 0xB5, 0xA8, 0x59, 0x77, 0x94, 0xC9,
+    0x01, 0x4E, 0x5E, 0xA7, 0x10, 0x57, 0xBD, 0xFA, 0x74, 0x51, 0x63, 0xEA, 0xB1, 0x06, 0xF6, 0xA0,
+    0x3A, 0xF7, 0x70, 0xB8, 0xEC, 0xB8, 0x92, 0x81, 0x5C, 0x20, 0x8F, 0xAD, 0x1A, 0x6E, 0xE8, 0x91,
+    0xB0, 0x76, 0x83, 0x55, 0xCC, 0xFD, 0x9C, 0xCD, 0x1C, 0xF3, 0x6F, 0x59, 0x32, 0x19, 0x03, 0xAB,
+    0xD2, 0xA2, 0xDE, 0x1D, 0x8E, 0x6B, 0x7F, 0x7A, 0x92, 0x39, 0x8A, 0xD7, 0x2D, 0xE9, 0xBA, 0x35,
+    0xA6, 0x74, 0xA8, 0xB0, 0x44, 0xFB, 0xDB, 0x62, 0x73, 0xCB, 0xCD, 0x92, 0x9C, 0xBE, 0x7D, 0xFF,
+    0xCA, 0x5C, 0x86, 0xE9, 0x18, 0x11, 0xB1, 0x9C, 0xEF, 0x8A, 0x55, 0x33, 0xAF, 0x4F, 0x03, 0xA7,
+    0x9A, 0xEE, 0xF1, 0x3B, 0x39, 0x35, 0xCF, 0xEF, 0x7C, 0x9C, 0x9B, 0xF6, 0xA8, 0x56, 0xF6, 0xF2,
+    0xF9, 0xE1, 0x79, 0xF5, 0x2C, 0x90, 0xAC, 0x1B, 0xC3, 0x8D, 0x5A, 0x84, 0xD3, 0xE9, 0x3A, 0xBF,
+    0x78, 0xC3, 0x46, 0x4C, 0x7A, 0x20, 0xED, 0x41, 0x02, 0x28, 0x69, 0xB9, 0x43, 0xDB, 0xF8, 0xB0,
+    0x3D, 0x0E, 0xEA, 0xA0, 0x54, 0xF4, 0x63, 0x3E, 0xBF, 0x17, 0xE5, 0xE1, 0x5E, 0x15, 0x1B, 0x9D,
+    0xCB, 0x53, 0x5F, 0xF1, 0x00, 0xFF, 0xEC, 0x9F, 0x3E, 0xFA, 0xD9, 0xF8, 0xFF, 0x8F, 0xEC, 0xF1,
+    0xCB, 0x7F, 0xE6, 0x2E, 0x2E, 0x9E, 0x11, 0x20, 0x17, 0x94, 0xBB, 0x0F, 0x92, 0xFA, 0xB1, 0xF5,
+    0xD4, 0x6E, 0xBA, 0xED, 0x1C, 0xE0, 0x1C, 0xE1, 0xAE, 0xE7, 0xD6, 0x1E, 0xFD, 0x7D, 0x1F, 0x7C,
+    0xDF, 0xD9, 0xB5, 0xB0, 0x5A, 0x9F, 0xFB, 0x75, 0xB9, 0x9E, 0x01, 0xE0, 0xB3, 0xD1, 0x56, 0x83,
+    0x40, 0x05, 0xB7, 0xC5, 0x96, 0xA2, 0xE4, 0x7E, 0xDC, 0x1D, 0x63, 0x42, 0x2F, 0xE9, 0x63, 0x86,
+    0x3E, 0xA6, 0x6E, 0xED, 0x2F, 0x60, 0x21, 0x46, 0x36, 0x13, 0xAB, 0x63, 0xEC, 0xAF, 0xDA, 0xCB,
+    0x86, 0x38, 0x31, 0xEE, 0x58, 0x94, 0xA4, 0xFF, 0xE4, 0x97, 0x9D, 0x8C, 0xE3, 0x40, 0x42, 0xAC,
+    0x6E, 0x48, 0xFA, 0x71, 0xDB, 0xCA, 0x98, 0x5A, 0x99, 0x5B, 0x2E, 0x73, 0x06, 0x12, 0x8B, 0xA9,
+    0x59, 0x73, 0x71, 0x6C, 0x53, 0x90, 0x0B, 0xA0, 0xD6, 0x5B, 0xF2, 0xF4, 0x47, 0xBC, 0x3D, 0x69,
+    0x93, 0x10, 0xBB, 0x2A, 0xA8, 0xEB, 0xE7, 0x1D, 0xCC, 0x57, 0xC0, 0xD1, 0xED, 0x8D, 0x7C, 0xE2,
+    0x0A, 0x0D, 0x6A, 0x49, 0x4F, 0x3A, 0xD0, 0x61, 0x06, 0x15, 0xA8, 0x2E, 0x27, 0x81, 0xA6, 0xD3,
+    0xAD, 0xEA, 0x3A, 0xED, 0xF5, 0xCB, 0x41, 0x7B, 0xF3, 0x64, 0x48, 0x5D, 0xA1, 0xDB, 0xCC, 0x4D,
+    0xB5, 0x37, 0x75, 0x97, 0x3A, 0x73, 0xAE, 0x4D, 0x9D, 0xC9, 0x5C, 0xE6, 0xF2, 0x02, 0x53, 0x9F,
+    0x99, 0x61, 0x6C, 0xD9, 0x93, 0x53, 0x05, 0x0A, 0xE6, 0x8E, 0x62, 0x7B, 0x61, 0xA9, 0xC2, 0xD5,
+    0x68, 0x00, 0x45, 0x05, 0x63, 0xEA, 0xB5, 0x06, 0x2E, 0x37, 0x86, 0xFC, 0x43, 0x6B, 0x52, 0xA6,
+    0x6C, 0x31, 0x50, 0x7D, 0x37, 0x44, 0x17, 0xE8, 0xA1, 0x5F, 0x15, 0x09, 0xDD, 0x99, 0x65, 0x1E,
+    0xB0, 0x89, 0x8F, 0x83, 0x67, 0x75, 0xDC, 0x0F, 0x65, 0x34, 0x64, 0x62, 0x9C, 0xE9, 0xE8, 0x72,
+    0x5B, 0x89, 0xD4, 0x85, 0x74, 0x1F, 0xE8, 0x17, 0x73, 0x43, 0x9C, 0xC9, 0x1F, 0x8E, 0x33, 0x65,
+    0x2F, 0xB5, 0x49, 0xBF, 0xFB, 0x15, 0x49, 0xC7, 0x38, 0xD3, 0xFF, 0x0F, 0xD5, 0xBC, 0x4F, 0xAC,
+    0x1C, 0xC7, 0x9D, 0xE7, 0xF9, 0x89, 0x0C, 0x92, 0xD9, 0x66, 0x8E, 0x15, 0x3C, 0x50, 0xD3, 0x6A,
+    0xC9, 0x64, 0xF6, 0xC1, 0x07, 0x8D, 0x87, 0x64, 0xCE, 0x41, 0x07, 0x0E, 0xB6, 0xAA, 0x32, 0x24,
+    0x02, 0x23, 0x60, 0x04, 0xAC, 0x38, 0x58, 0xBE, 0x31, 0xD0, 0x5A, 0xAC, 0x7C, 0xD8, 0x83, 0x47,
+    0xB3, 0xDD, 0xF4, 0x81, 0xBB, 0xE0, 0xEC, 0x56, 0xB1, 0x42, 0x12, 0x76, 0x7C, 0xD0, 0x41, 0xEC,
+    0x9E, 0x75, 0xEF, 0xA1, 0x81, 0x35, 0x07, 0xD0, 0x00, 0xD2, 0xD3, 0xA2, 0xC5, 0x03, 0xB1, 0xA0,
+    0xED, 0x7C, 0xAF, 0x82, 0x24, 0x66, 0x75, 0x30, 0xB0, 0x4A, 0x59, 0xAD, 0xD6, 0x41, 0xC0, 0x2A,
+    0x65, 0xC9, 0xE3, 0x19, 0x09, 0xDD, 0x0C, 0x59, 0x29, 0x2B, 0x49, 0x66, 0xD5, 0x6F, 0x0F, 0x91,
+    0xF5, 0xDE, 0xA3, 0x2C, 0xD9, 0xEE, 0x6E, 0x7B, 0x06, 0x5B, 0x85, 0xE2, 0x63, 0x55, 0x65, 0x45,
+    0xFC, 0x7E, 0x19, 0xBF, 0xF8, 0xFD, 0xFD, 0xFE, 0x02, 0xA0, 0x04, 0xE3, 0xD0, 0x35, 0x0F, 0xAC,
+    0x2E, 0x19, 0xE9, 0x98, 0x9F, 0xC1, 0x38, 0xD2, 0x1A, 0x15, 0xA0, 0x82, 0x09, 0x18, 0x4B, 0xEA,
+    0x49, 0x44, 0x9C, 0x48, 0x37, 0xA1, 0x34, 0x56, 0xBF, 0x51, 0xD3, 0xB6, 0x4C, 0x4B, 0xE6, 0xA9,
+    0x08, 0xF3, 0x15, 0x9C, 0x86, 0xF9, 0xCA, 0xB2, 0x90, 0xC0, 0xF2, 0x89, 0x9E, 0x8E, 0x5E, 0xB5,
+    0xCC, 0x92, 0xC0, 0x24, 0x09, 0x4C, 0x74, 0x73, 0x68, 0xA6, 0xEB, 0x2B, 0x7D, 0x5A, 0x5F, 0xE8,
+    0xB2, 0x37, 0xE7, 0x8D, 0x11, 0xB1, 0x46, 0x5E, 0xB1, 0xC6, 0x66, 0x3E, 0x27, 0xA1, 0x88, 0x94,
+    0x30, 0x01, 0x66, 0xC0, 0x14, 0xA8, 0x00, 0x1E, 0xCC, 0x1A, 0x4C, 0x2E, 0x36, 0x7D, 0xE7, 0x89,
+    0x90, 0xAC, 0xD8, 0x62, 0x41, 0x6E, 0x4B, 0x74, 0x6D, 0x1C, 0x6D, 0x5A, 0x33, 0x4B, 0x02, 0x05,
+    0x3D, 0xC6, 0x4F, 0xD0, 0x8D, 0x79, 0xE6, 0x7A, 0x48, 0xC3, 0xF7, 0xBA, 0x64, 0x65, 0x7A, 0x6E,
+    0x4B, 0xCF, 0xB8, 0x58, 0x92, 0xDB, 0xAF, 0xFB, 0xD4, 0xD3, 0x26, 0x81, 0x7D, 0x74, 0xC0, 0x18,
+    0xC8, 0x81, 0xCC, 0xB3, 0xF3, 0x28, 0x86, 0xC9, 0xC7, 0xC0, 0x94, 0xB9, 0xF4, 0x2C, 0xA4, 0x67,
+    0xB5, 0xF9, 0x02, 0x2D, 0xA8, 0x16, 0x92, 0x10, 0x5F, 0xBA, 0x01, 0x5D, 0x43, 0xEA, 0xE3, 0x00,
+    0xC6, 0x83, 0x71, 0x60, 0x6C, 0x1C, 0xF4, 0x0B, 0x39, 0x81, 0xF8, 0x49, 0xE6, 0xA1, 0x02, 0xE3,
+    0x0E, 0x6E, 0xB6, 0x88, 0x90, 0x6F, 0x9C, 0x4E, 0x02, 0x14, 0x71, 0xE8, 0x71, 0x1C, 0xB9, 0x8A,
+    0x03, 0x77, 0x60, 0x2C, 0xEA, 0xAE, 0xAF, 0xF9, 0x22, 0xEA, 0xF4, 0x1E, 0xEA, 0x1E, 0xF8, 0xC9,
+    0x69, 0x16, 0xD2, 0xB0, 0x90, 0xFA, 0x17, 0xA8, 0x9B, 0x7C, 0x1E, 0x75, 0x9B, 0x9B, 0xB6, 0x14,
+    0x9F, 0x6F, 0x5E, 0xCA, 0x3C, 0x49, 0x80, 0x0E, 0xC6, 0x28, 0x11, 0x16, 0xE2, 0xF5, 0xFA, 0x3D,
+    0x39, 0x64, 0x1E, 0xDD, 0x40, 0xBB, 0x87, 0x8E, 0xE5, 0xC6, 0x19, 0xBA, 0x2F, 0xB8, 0x4B, 0x6F,
+    0x5A, 0x32, 0xE9, 0x31, 0x22, 0xD6, 0xB8, 0xC2, 0x1B, 0x9B, 0x36, 0x39, 0x3A, 0x14, 0x24, 0xA1,
+    0x44, 0xB5, 0x13, 0x54, 0x3B, 0x43, 0xB5, 0x53, 0x92, 0x50, 0x45, 0x0E, 0x02, 0x64, 0x75, 0x64,
+    0xBF, 0xB4, 0x87, 0x93, 0x15, 0xA5, 0xB4, 0x14, 0xE2, 0xE0, 0xF4, 0x9A, 0xCE, 0xFA, 0x33, 0x74,
+    0x92, 0x8B, 0xCB, 0xA4, 0xD7, 0x61, 0xEE, 0x3A, 0x1D, 0xC6, 0xCC, 0x72, 0xCC, 0x63, 0x5E, 0xBF,
+    0xD1, 0xD0, 0xB6, 0xCC, 0xA0, 0x00, 0xE3, 0x49, 0x1B, 0x74, 0xF8, 0x52, 0xD6, 0x6A, 0x69, 0x59,
+    0x34, 0xC3, 0xAA, 0xEB, 0x9A, 0x0A, 0xE3, 0x74, 0xAD, 0x5B, 0x32, 0x9F, 0xFA, 0xAC, 0x46, 0x37,
+    0x99, 0x2F, 0x2C, 0x49, 0x30, 0x6E, 0x1B, 0xE8, 0xCC, 0xC3, 0x1D, 0x50, 0xE5, 0x69, 0x03, 0x4C,
+    0x0A, 0xE3, 0x81, 0xA2, 0x28, 0x01, 0xCC, 0x76, 0x0F, 0x60, 0x24, 0x00, 0x94, 0xB3, 0x16, 0xA0,
+    0xAF, 0x7A, 0x40, 0xB7, 0xDD, 0x0C, 0xC8, 0xEA, 0xAE, 0x04, 0x0A, 0xD7, 0xE6, 0x16, 0x2E, 0xA8,
+    0x60, 0x3C, 0xAA, 0x4B, 0x42, 0x5A, 0x93, 0x06, 0xDD, 0xE8, 0x4F, 0x30, 0x5E, 0xD7, 0x4A, 0x5C,
+    0x49, 0xEA, 0x11, 0x0B, 0x83, 0x70, 0x0E, 0x8B, 0x35, 0xAC, 0xD5, 0x20, 0x99, 0xBB, 0x7F, 0x0E,
+    0x93, 0x2C, 0x39, 0x48, 0xD6, 0x9A, 0x15, 0xD3, 0x44, 0xFC, 0xBD, 0xCB, 0x24, 0x14, 0xAF, 0x43,
+    0x6F, 0x9E, 0xEE, 0x20, 0x09, 0x63, 0xE3, 0x21, 0xF3, 0x61, 0x06, 0xE4, 0xE9, 0xF5, 0x00, 0x2C,
+    0x44, 0x1C, 0x24, 0x22, 0x2B, 0xC0, 0x3C, 0xFB, 0x7A, 0x0B, 0xCC, 0x8C, 0xAE, 0x41, 0x87, 0xA9,
+    0xB1, 0x50, 0x3C, 0xD2, 0x94, 0x90, 0xF4, 0xC6, 0x6E, 0xA1, 0xC5, 0x8F, 0x91, 0x90, 0x77, 0x2A,
+    0x20, 0x7E, 0xDF, 0x1E, 0x3A, 0x5A, 0x20, 0x0A, 0xE9, 0x2E, 0xA5, 0x51, 0xC0, 0xD5, 0xE9, 0x81,
+    0x6E, 0x71, 0x2C, 0xA4, 0xE5, 0x1F, 0x1F, 0xE8, 0x81, 0xED, 0xCF, 0x88, 0x5C, 0x0F, 0x69, 0xA0,
+    0x14, 0x47, 0xB9, 0x84, 0x7B, 0xCF, 0xBA, 0x28, 0x2D, 0x49, 0x00, 0x15, 0x76, 0x25, 0x39, 0x6B,
+    0xCE, 0x31, 0xF7, 0x73, 0x11, 0x0A, 0x69, 0xE1, 0x38, 0x70, 0x14, 0x30, 0x71, 0x52, 0x75, 0x01,
+    0xD2, 0x0E, 0x94, 0x05, 0xB5, 0xB8, 0x98, 0x88, 0xF0, 0xAF, 0x9E, 0x68, 0xA0, 0x8F, 0x8B, 0xED,
+    0xC8, 0xBD, 0x16, 0xA7, 0xA4, 0x81, 0x6D, 0xC8, 0x7C, 0xD4, 0x66, 0x5F, 0x65, 0xCB, 0xC8, 0x4A,
+    0xC9, 0x12, 0xAE, 0xC0, 0x51, 0x48, 0x3D, 0x2A, 0xB0, 0xBF, 0x25, 0xED, 0xA2, 0x78, 0x4D, 0x49,
+    0x9B, 0x24, 0x70, 0x01, 0xE3, 0xD3, 0x86, 0x09, 0x17, 0x50, 0x6D, 0x1A, 0xC8, 0xFC, 0x1C, 0x8A,
+    0x34, 0x40, 0x57, 0x82, 0x7E, 0x23, 0x40, 0x3E, 0x07, 0x16, 0x01, 0xF4, 0xA7, 0x35, 0x98, 0xE7,
+    0x3D, 0x8C, 0x73, 0x87, 0x0A, 0x05, 0x64, 0xBE, 0x84, 0x92, 0x19, 0x74, 0xF4, 0xA4, 0x35, 0xB7,
+    0x6C, 0x4E, 0x22, 0x54, 0xE8, 0x9E, 0xC8, 0x2E, 0xC6, 0x02, 0x23, 0x22, 0xD3, 0x51, 0x15, 0xDD,
+    0x0B, 0xBC, 0xC0, 0x8B, 0xB4, 0x49, 0x50, 0x21, 0xF3, 0x49, 0x28, 0xD0, 0xA1, 0x42, 0xFF, 0x38,
+    0xA0, 0xDF, 0xF6, 0xA4, 0x02, 0x99, 0x80, 0x79, 0xCD, 0x61, 0x9E, 0xF3, 0x98, 0x53, 0x81, 0x5C,
+    0x75, 0x14, 0x6C, 0x31, 0xA1, 0x0C, 0x63, 0xF2, 0x61, 0xD7, 0xDD, 0xA5, 0x9F, 0x1C, 0xEC, 0xDF,
+    0xCB, 0x98, 0xDB, 0x61, 0xEC, 0x07, 0x0D, 0xD9, 0x8D, 0x15, 0x14, 0xA6, 0x81, 0x6E, 0xBE, 0xC3,
+    0x98, 0x85, 0x45, 0x0F, 0xFA, 0x4E, 0x58, 0x33, 0x56, 0x38, 0x54, 0x58, 0x40, 0x76, 0x43, 0xA0,
+    0x34, 0xBB, 0x8C, 0x75, 0xE4, 0x24, 0x2D, 0x71, 0xEB, 0xBE, 0xC0, 0xBF, 0xA0, 0xFD, 0x67, 0x9D,
+    0xFA, 0xE8, 0xAD, 0x26, 0xF9, 0xD9, 0x4D, 0xAB, 0x3F, 0x5E, 0xA2, 0xDF, 0x6B, 0xD1, 0x6F, 0xD7,
+    0xA4, 0x37, 0x6D, 0xA4, 0xFD, 0x79, 0x87, 0x79, 0xDE, 0x63, 0x9E, 0x0C, 0xE4, 0x27, 0x3A, 0x8A,
+    0x51, 0xC5, 0xE4, 0xC1, 0x92, 0x31, 0xB9, 0xDB, 0xA5, 0xF1, 0xC9, 0xBF, 0x48, 0x1B, 0x2D, 0xE1,
+    0x02, 0xB9, 0xBC, 0xDA, 0x90, 0xF9, 0x0B, 0x50, 0xA4, 0x0D, 0x74, 0x17, 0x40, 0xBF, 0xD5, 0x40,
+    0x7E, 0x61, 0x7D, 0xF3, 0xEF, 0x7C, 0xFE, 0xCD, 0x9F, 0xB0, 0xB5, 0xA6, 0x51, 0xDD, 0x45, 0xE3,
+    0x1E, 0x5D, 0x9F, 0x2C, 0x5E, 0x24, 0x95, 0x1E, 0xB5, 0x75, 0x26, 0x4A, 0x70, 0xC7, 0x8B, 0xB4,
+    0x49, 0xAB, 0x42, 0x56, 0x27, 0xA1, 0xB0, 0x3A, 0x6C, 0xA1, 0x7F, 0xFC, 0x19, 0xFA, 0x5F, 0x73,
+    0x98, 0xE7, 0xEA, 0xCF, 0xDE, 0x7B, 0xC6, 0xE4, 0xAE, 0x14, 0x54, 0x57, 0x0A, 0x69, 0xB8, 0x77,
+    0x4E, 0xEE, 0x99, 0x50, 0xC2, 0x98, 0x1E, 0xA6, 0x3A, 0x40, 0x65, 0x3C, 0xF4, 0x25, 0xD0, 0xF5,
+    0xC0, 0x9D, 0x00, 0x4A, 0x3C, 0x24, 0x9F, 0xD6, 0xA0, 0xDF, 0x0B, 0xA0, 0x9B, 0x0E, 0xD2, 0x7A,
+    0x0B, 0x52, 0x5F, 0x42, 0xE6, 0x73, 0x87, 0x71, 0x99, 0xC7, 0x58, 0x1D, 0xC8, 0xAD, 0x6A, 0x29,
+    0xA0, 0xE7, 0xA9, 0x4D, 0xEE, 0x3F, 0x2B, 0x3E, 0xFF, 0xD7, 0x2F, 0x37, 0xB9, 0xA3, 0xCD, 0x1D,
+    0xD3, 0xDC, 0x51, 0xE4, 0x0E, 0xF3, 0x8E, 0x43, 0x8B, 0x83, 0x3B, 0x35, 0x4C, 0x7B, 0x28, 0x8C,
+    0xC3, 0x3C, 0xD3, 0xA2, 0xEB, 0x12, 0xD5, 0xEA, 0x86, 0x29, 0x5B, 0x14, 0x18, 0xCF, 0x14, 0xAE,
+    0x26, 0x01, 0xDD, 0x18, 0x87, 0xB1, 0x13, 0x98, 0xA9, 0x96, 0x24, 0x64, 0x9E, 0xCC, 0x17, 0x30,
+    0xA1, 0x83, 0x56, 0xD7, 0xA4, 0x3E, 0x17, 0x11, 0x16, 0x22, 0xBD, 0xFE, 0x64, 0xE3, 0xEB, 0xF1,
+    0xF2, 0x31, 0x4C, 0x55, 0x88, 0x97, 0x1B, 0x57, 0xC6, 0xCB, 0x55, 0x9B, 0xD6, 0xA4, 0x7F, 0x91,
+    0x43, 0xD1, 0x56, 0x20, 0x7E, 0xAD, 0xC2, 0x3A, 0xA2, 0x48, 0x46, 0x99, 0x9F, 0x0E, 0x9A, 0xE2,
+    0x05, 0x0E, 0xDA, 0x31, 0xBA, 0xCE, 0x51, 0x21, 0xF3, 0x54, 0x49, 0xA0, 0xA4, 0xC3, 0xB8, 0x09,
+    0x69, 0x9D, 0x8B, 0x84, 0x4C, 0xA4, 0xD7, 0x81, 0x09, 0x1D, 0xC6, 0x8D, 0x49, 0xEB, 0x3C, 0x4E,
+    0x58, 0xE9, 0x86, 0x32, 0xB4, 0x98, 0xCF, 0xDA, 0x72, 0xDD, 0x0C, 0x93, 0x1D, 0x86, 0x29, 0x2C,
+    0x96, 0x54, 0x20, 0x4B, 0x3A, 0xB8, 0x75, 0x86, 0x16, 0x15, 0x50, 0x2D, 0x49, 0x20, 0x09, 0xE8,
+    0xF8, 0x6F, 0x83, 0x6E, 0xD0, 0x35, 0xBA, 0x26, 0xF5, 0xA4, 0x22, 0xE2, 0xC9, 0x44, 0xC4, 0x61,
+    0xDE, 0xDC, 0x78, 0xD2, 0x61, 0x1C, 0xB9, 0xC5, 0x58, 0x72, 0xC8, 0xA1, 0x80, 0x02, 0x26, 0x30,
+    0x81, 0x31, 0x4C, 0x60, 0x06, 0x33, 0xA8, 0x60, 0x0A, 0x15, 0x54, 0x91, 0x80, 0x17, 0x38, 0xB8,
+    0x79, 0xD1, 0x58, 0x64, 0xA9, 0x02, 0xF9, 0xA6, 0x2B, 0x86, 0x59, 0x4B, 0x98, 0x0C, 0x93, 0xCE,
+    0x60, 0x3E, 0xCC, 0xD6, 0x43, 0x8F, 0x71, 0x18, 0x47, 0x07, 0x2D, 0xB9, 0x25, 0x1F, 0x7E, 0x50,
+    0xAC, 0x7F, 0x50, 0x33, 0x06, 0xE6, 0x22, 0x2D, 0x64, 0x22, 0x62, 0x61, 0xB9, 0xF1, 0xF5, 0x00,
+    0xC6, 0x51, 0x80, 0x6A, 0xD1, 0x0D, 0x14, 0x30, 0x86, 0x24, 0x90, 0xD6, 0x30, 0x81, 0x0A, 0x74,
+    0x8D, 0xF1, 0x30, 0x83, 0x5B, 0xA7, 0xC9, 0x3C, 0x46, 0x5A, 0x7A, 0x94, 0x48, 0x63, 0x1C, 0x05,
+    0x73, 0xDB, 0xA2, 0x03, 0x7D, 0x0E, 0x13, 0xB2, 0x1F, 0x05, 0xD2, 0x9A, 0x49, 0x09, 0x53, 0xF4,
+    0x7B, 0x0D, 0x99, 0x67, 0x32, 0x83, 0x1E, 0xFD, 0x53, 0x8F, 0x71, 0x4C, 0x2A, 0x54, 0x4B, 0x5A,
+    0x43, 0x54, 0xE4, 0x44, 0x3B, 0x0D, 0x3A, 0x5A, 0x85, 0x6D, 0x60, 0x3F, 0x73, 0x0F, 0xCC, 0x25,
+    0x00, 0xA9, 0xB4, 0x10, 0xD5, 0x34, 0x9B, 0x9B, 0x9B, 0x60, 0x44, 0x02, 0xEA, 0xF6, 0xE6, 0xF6,
+    0x60, 0x7C, 0x93, 0xC0, 0x14, 0x26, 0x64, 0x1E, 0x5D, 0xD3, 0xC3, 0x14, 0x23, 0x2E, 0xF3, 0x88,
+    0xD8, 0x9E, 0xFC, 0xE1, 0xDE, 0xB8, 0x24, 0xA4, 0x4D, 0xCB, 0x84, 0x32, 0x47, 0x37, 0xC9, 0xCF,
+    0x02, 0x33, 0x8A, 0x09, 0xA9, 0x4F, 0x3E, 0xAE, 0xA9, 0x28, 0x59, 0x6B, 0x54, 0x66, 0x3B, 0xF4,
+    0x24, 0x1D, 0xA8, 0x87, 0x05, 0x28, 0xC4, 0x83, 0x92, 0x9A, 0x3D, 0x8F, 0x62, 0x05, 0x85, 0x04,
+    0xCC, 0xAD, 0xFD, 0xE8, 0x0E, 0xD8, 0xE6, 0x81, 0xC6, 0xF8, 0x54, 0xAE, 0x07, 0xB5, 0xDC, 0x2E,
+    0x29, 0xF5, 0xA7, 0x75, 0x5A, 0x97, 0x15, 0xBD, 0xBE, 0xE3, 0x8D, 0x2B, 0x7B, 0xD5, 0x6A, 0xF1,
+    0xB9, 0x9D, 0xF4, 0xAA, 0xCD, 0xDE, 0xF1, 0xB9, 0xED, 0x2B, 0xD5, 0xE6, 0xDF, 0x6E, 0xCC, 0xB3,
+    0xA1, 0xB4, 0x7D, 0xAF, 0x56, 0x99, 0xD8, 0x54, 0xE4, 0x5D, 0x9B, 0x89, 0x74, 0xA8, 0x47, 0x06,
+    0x2B, 0xFE, 0x40, 0x07, 0xD2, 0xA1, 0x6F, 0x1D, 0xC2, 0x78, 0x65, 0x73, 0x5B, 0x86, 0x12, 0xE9,
+    0xC6, 0x3A, 0x54, 0x53, 0xDD, 0x4C, 0xAB, 0xD4, 0x4F, 0xAB, 0xCC, 0x57, 0x55, 0xE6, 0xBB, 0x69,
+    0x76, 0x3D, 0x4C, 0xD2, 0xB7, 0xEA, 0xF2, 0x94, 0x38, 0x23, 0x72, 0x3A, 0x11, 0x09, 0x1C, 0xCE,
+    0xA2, 0x93, 0xC2, 0x7C, 0x65, 0x95, 0x48, 0x48, 0x56, 0x0F, 0x9F, 0x4F, 0x7A, 0x50, 0xFD, 0x70,
+    0xF3, 0x2F, 0x0C, 0xAE, 0xA6, 0x71, 0x90, 0xD6, 0xD1, 0x74, 0xD2, 0xAF, 0x3F, 0xF4, 0xD1, 0x8E,
+    0x52, 0x01, 0xB9, 0x1B, 0x96, 0x68, 0xEE, 0x7E, 0x8F, 0x4C, 0xC4, 0x31, 0x97, 0x1A, 0xAE, 0x0C,
+    0x46, 0x55, 0xFB, 0x68, 0x86, 0xF6, 0x77, 0xD1, 0xAA, 0x72, 0x1A, 0x20, 0xBB, 0x45, 0x21, 0xBE,
+    0x7C, 0xF3, 0x52, 0xE1, 0x30, 0x6E, 0x70, 0xFC, 0x54, 0x0B, 0x53, 0x28, 0x60, 0x70, 0xC0, 0x66,
+    0x60, 0xEA, 0xDF, 0x51, 0x22, 0x18, 0x71, 0x9C, 0x07, 0x13, 0xC7, 0x0B, 0xEC, 0xEF, 0xD0, 0x3D,
+    0x9C, 0x86, 0x52, 0xA4, 0x2F, 0x45, 0xFA, 0x7B, 0x9F, 0x7C, 0xF3, 0xCC, 0x8E, 0xC3, 0x9C, 0xDB,
+    0xA8, 0x1E, 0x3E, 0xEB, 0x92, 0x56, 0x03, 0x13, 0x5D, 0xF4, 0x35, 0xF6, 0xFA, 0x04, 0xFA, 0x13,
+    0xD0, 0x2B, 0x48, 0x57, 0x3B, 0x9E, 0xFA, 0x5A, 0x73, 0x47, 0xBF, 0xE4, 0x34, 0x70, 0xA9, 0x70,
+    0x59, 0xC3, 0x68, 0xDE, 0xE7, 0x42, 0x3E, 0x3B, 0xFB, 0xE4, 0x13, 0x4D, 0xD6, 0xE9, 0x15, 0x7D,
+    0xD2, 0x21, 0x14, 0xF4, 0x94, 0x18, 0x3F, 0xC1, 0x38, 0xDD, 0xE4, 0x36, 0xAD, 0x69, 0x33, 0x9F,
+    0x04, 0xA6, 0x3A, 0x50, 0x51, 0xD0, 0x31, 0xC1, 0xB8, 0x31, 0xC6, 0xEA, 0x3A, 0x27, 0xF5, 0x2A,
+    0x7E, 0x3D, 0xD3, 0x0D, 0x3D, 0x79, 0xDB, 0x32, 0x21, 0xE9, 0xF7, 0x78, 0x67, 0xC6, 0xED, 0xCA,
+    0x9F, 0x8A, 0x9B, 0x60, 0x0A, 0xC0, 0xBD, 0x8C, 0xA1, 0x9A, 0xA0, 0xBA, 0x02, 0x1D, 0x72, 0xB2,
+    0xDA, 0x58, 0xE3, 0x8C, 0x2B, 0xC9, 0x7C, 0x45, 0xEA, 0x3B, 0xF4, 0x1B, 0x01, 0xFD, 0xA1, 0x27,
+    0x11, 0x8B, 0x92, 0x2F, 0xE0, 0xBA, 0x89, 0xAF, 0xB4, 0x8E, 0x2A, 0xEE, 0x9B, 0x24, 0xFF, 0x36,
+    0x90, 0x3F, 0xEA, 0xE9, 0x8D, 0x4D, 0xFD, 0x98, 0x09, 0x5D, 0x12, 0x74, 0x63, 0x5C, 0xE6, 0x2B,
+    0x8A, 0xB4, 0x66, 0x5A, 0xC2, 0x47, 0x01, 0xFD, 0x9A, 0xC3, 0x54, 0x50, 0x36, 0xB0, 0x80, 0xA4,
+    0x8D, 0xBF, 0x2F, 0xE3, 0x14, 0xBA, 0x8E, 0x5A, 0xB3, 0xDA, 0x75, 0x46, 0x0A, 0xDD, 0x90, 0xBB,
+    0x0A, 0xE3, 0x73, 0xB2, 0x5A, 0xD7, 0xBA, 0xA1, 0xD3, 0x81, 0x22, 0x09, 0xA4, 0xBE, 0x83, 0xB6,
+    0x87, 0x49, 0x05, 0xD9, 0x92, 0x48, 0xED, 0x20, 0x79, 0x5A, 0xA4, 0x56, 0x22, 0x31, 0x58, 0x64,
+    0xF2, 0x59, 0x71, 0x3C, 0xE0, 0xF8, 0x9A, 0x0A, 0xE4, 0x76, 0x8A, 0xF1, 0xC6, 0xA6, 0x3E, 0x8E,
+    0x9C, 0x44, 0xBD, 0x9E, 0xF9, 0x8A, 0x24, 0xCC, 0x60, 0x5A, 0x42, 0x9E, 0x83, 0x7E, 0xCD, 0xC1,
+    0x1D, 0x1F, 0xE9, 0xCE, 0x42, 0x24, 0xBC, 0x94, 0x8E, 0x5C, 0x96, 0x71, 0x64, 0x5D, 0x0F, 0x2E,
+    0xD3, 0x7A, 0x3A, 0x72, 0x98, 0x61, 0x2C, 0x1D, 0xC6, 0xE9, 0x40, 0xEA, 0x33, 0x8F, 0xAE, 0x73,
+    0x4B, 0x12, 0x26, 0xA0, 0x42, 0x37, 0x58, 0x5B, 0x16, 0x1E, 0x28, 0x2D, 0x30, 0x07, 0x10, 0x0B,
+    0xFA, 0x43, 0x0F, 0xD9, 0xAB, 0x1E, 0x0A, 0x5D, 0xC3, 0x2C, 0x09, 0xD0, 0xA9, 0x80, 0x0E, 0x74,
+    0x64, 0x9E, 0x2D, 0x9B, 0x5B, 0xE6, 0xF5, 0x04, 0x4A, 0xBF, 0x76, 0xD3, 0x8C, 0x5B, 0x9B, 0xB2,
+    0x7C, 0xC7, 0x05, 0xBE, 0x17, 0x5E, 0xE4, 0x7E, 0x72, 0x72, 0xA7, 0x1B, 0xE3, 0xA9, 0x8C, 0xC7,
+    0x3C, 0xE6, 0xA3, 0x71, 0x2F, 0x6B, 0x30, 0x4D, 0xDC, 0x81, 0x5A, 0x20, 0xF9, 0xD4, 0x93, 0x84,
+    0x0E, 0xD5, 0xE6, 0xA8, 0x4E, 0x37, 0xF4, 0x2C, 0x7C, 0x8F, 0x69, 0x06, 0x29, 0x1E, 0x7D, 0xD6,
+    0xA6, 0x9D, 0xA6, 0x14, 0xE9, 0xB3, 0xE7, 0x45, 0x44, 0xFF, 0x78, 0x73, 0xB5, 0xF9, 0x70, 0x4B,
+    0x09, 0x55, 0xD4, 0xFD, 0x69, 0x8D, 0x71, 0x49, 0x88, 0x91, 0x8C, 0x6A, 0xA3, 0xDA, 0x37, 0x96,
+    0x72, 0xEF, 0x37, 0x3D, 0x2A, 0xEC, 0xFD, 0xC6, 0xC7, 0x6F, 0xD2, 0xE1, 0x9B, 0x72, 0x63, 0x63,
+    0x69, 0x73, 0x11, 0x09, 0xA9, 0x88, 0xF4, 0x3B, 0xDE, 0xBE, 0xB1, 0x6B, 0xD3, 0xAD, 0xC2, 0x8E,
+    0x9F, 0x7F, 0x2F, 0x5F, 0xDB, 0xDC, 0x3C, 0xF0, 0x9C, 0x48, 0xA8, 0x9E, 0xDA, 0x7E, 0xC9, 0xB8,
+    0xCC, 0xD3, 0xD1, 0x63, 0xAC, 0x71, 0x2A, 0xD0, 0x52, 0x90, 0xA3, 0x9B, 0x24, 0x30, 0x66, 0x42,
+    0xEA, 0x75, 0x43, 0xCF, 0x98, 0xC2, 0xEB, 0x3A, 0xED, 0x98, 0x24, 0x37, 0x9D, 0x96, 0x4E, 0x9C,
+    0x59, 0xA6, 0x2D, 0xFB, 0xC8, 0xED, 0x20, 0x28, 0xC5, 0x7A, 0x1B, 0x8D, 0x01, 0x65, 0x33, 0xC7,
+    0x09, 0xE3, 0x98, 0x18, 0xCB, 0x38, 0x87, 0x69, 0x01, 0x55, 0x09, 0xFD, 0x04, 0xBA, 0x18, 0x30,
+    0xAA, 0x50, 0x91, 0x84, 0x2D, 0xD2, 0xA6, 0xDC, 0x94, 0xBA, 0x10, 0xA9, 0x93, 0xEF, 0x3F, 0xF6,
+    0x79, 0x01, 0xF9, 0x69, 0x28, 0x43, 0x7C, 0xAD, 0xB7, 0xD3, 0x5E, 0x07, 0x79, 0xBF, 0xBD, 0x9F,
+    0xE4, 0xDF, 0x34, 0x4C, 0x27, 0x64, 0xAF, 0xD6, 0xF4, 0x15, 0xE6, 0x39, 0x9F, 0xB4, 0x15, 0xF3,
+    0xCC, 0xE7, 0x61, 0xFE, 0xCA, 0x4A, 0xCB, 0x7B, 0xCD, 0x81, 0x8B, 0x43, 0xE4, 0xDE, 0xC7, 0xC1,
+    0xC5, 0x91, 0xB7, 0x90, 0x47, 0xE2, 0xCB, 0x38, 0xEA, 0xEC, 0x97, 0x12, 0xAE, 0x6C, 0x37, 0x4E,
+    0x9F, 0x6E, 0xA7, 0xD9, 0xC3, 0xA1, 0x32, 0x49, 0x98, 0x99, 0xB4, 0x29, 0x5F, 0x19, 0x08, 0xDF,
+    0x7E, 0xCC, 0x33, 0x32, 0x9E, 0x91, 0x71, 0x9C, 0x37, 0x96, 0x2B, 0x77, 0x67, 0x12, 0xEE, 0x26,
+    0x70, 0x7A, 0x9F, 0x79, 0xEE, 0xFA, 0xF5, 0xB6, 0x1F, 0xCD, 0xB3, 0x1B, 0xDF, 0x0D, 0xF3, 0xC5,
+    0x76, 0x22, 0xEF, 0x35, 0x07, 0xC2, 0x0C, 0x93, 0x79, 0x9A, 0x9E, 0x23, 0xC6, 0x41, 0x0B, 0xB9,
+    0xDD, 0xD1, 0x8F, 0x83, 0x66, 0xB9, 0x3B, 0x42, 0xFF, 0x03, 0xAB, 0x3F, 0x94, 0x36, 0x95, 0x3B,
+    0x7D, 0xF6, 0x3E, 0x17, 0x8C, 0x67, 0xF2, 0xCB, 0x6F, 0x78, 0x12, 0xAA, 0xB8, 0x54, 0x5F, 0x9C,
+    0x46, 0xE8, 0x8A, 0x9A, 0x4F, 0xA4, 0x53, 0x9F, 0xBE, 0xD9, 0x27, 0x2B, 0xA6, 0xBA, 0x67, 0xAA,
+    0x03, 0x53, 0xDD, 0x50, 0xA5, 0x35, 0x5D, 0xE6, 0xE9, 0x8C, 0x57, 0xAD, 0x71, 0x49, 0x30, 0x36,
+    0x09, 0x39, 0xBA, 0x29, 0xD0, 0xF5, 0x84, 0xD4, 0x8F, 0xF7, 0xA4, 0x63, 0x72, 0x71, 0x90, 0x8B,
+    0x40, 0x76, 0x2B, 0xED, 0x48, 0x7A, 0x8C, 0x67, 0x0E, 0x15, 0xC6, 0x93, 0x5D, 0xFF, 0xE3, 0x16,
+    0xFA, 0x51, 0x09, 0xE5, 0xB3, 0x37, 0x1A, 0xCE, 0x86, 0x52, 0x5E, 0x91, 0x2E, 0x11, 0x91, 0x0E,
+    0xB5, 0x7A, 0xC9, 0xAE, 0x7D, 0x92, 0x7E, 0xD7, 0x3D, 0xA9, 0x80, 0xC1, 0x6D, 0x29, 0x01, 0xD4,
+    0x8A, 0xB3, 0x90, 0x89, 0x04, 0xC8, 0xA5, 0x5B, 0x7B, 0x28, 0x9C, 0x6D, 0x48, 0xA4, 0xC7, 0xFC,
+    0x64, 0x8B, 0xC2, 0x4E, 0xCE, 0x4F, 0x98, 0xB4, 0x15, 0xB3, 0xAE, 0x3B, 0xD0, 0x2D, 0x44, 0x9A,
+    0x52, 0x56, 0x3B, 0xB7, 0x2F, 0x09, 0x83, 0xBE, 0x5F, 0x72, 0x89, 0xB9, 0x34, 0x91, 0xE6, 0xD3,
+    0xFC, 0x17, 0x64, 0xC1, 0xB8, 0x9D, 0x7D, 0x5A, 0xC0, 0x60, 0xFD, 0xE3, 0x3E, 0xFE, 0x8D, 0x70,
+    0xA7, 0xC3, 0xB0, 0x71, 0xEE, 0xDA, 0x3C, 0x50, 0x0A, 0xB9, 0xB8, 0x21, 0xCF, 0xB2, 0x9B, 0x1E,
+    0x9A, 0xAE, 0xF3, 0x2E, 0x77, 0xBF, 0x77, 0xE8, 0x1A, 0xD5, 0x42, 0x05, 0x05, 0x2C, 0x3A, 0xE6,
+    0x02, 0xC0, 0xF1, 0x98, 0x59, 0x28, 0xA2, 0x88, 0x99, 0x9B, 0x35, 0x40, 0xBA, 0xB2, 0x7C, 0xE6,
+    0x91, 0xB9, 0xA4, 0xE1, 0xC2, 0x5A, 0xB1, 0xE8, 0x5A, 0xD7, 0x3A, 0x90, 0x84, 0xB4, 0x36, 0x1E,
+    0xDA, 0xD4, 0x17, 0x16, 0xAA, 0xCC, 0x6F, 0x01, 0x53, 0xF3, 0x74, 0x07, 0x4C, 0xCC, 0xA3, 0x0D,
+    0x90, 0xE7, 0x8F, 0x7B, 0xC0, 0x88, 0xC4, 0x24, 0xC5, 0x12, 0xE0, 0xC2, 0x85, 0x0B, 0x80, 0xEA,
+    0xC6, 0x05, 0x31, 0x0F, 0xE2, 0xC0, 0xF8, 0x2A, 0xF3, 0x50, 0xDA, 0x2E, 0xAD, 0x61, 0x8B, 0x4E,
+    0x07, 0x92, 0x8E, 0x56, 0x05, 0xD2, 0x46, 0x05, 0x3A, 0x72, 0x9F, 0x04, 0x2A, 0xCA, 0xC1, 0x91,
+    0x87, 0x4B, 0x07, 0x1C, 0xA0, 0xEB, 0x13, 0x00, 0xD9, 0x5F, 0x46, 0x16, 0x22, 0x5F, 0x6A, 0x97,
+    0x83, 0xFC, 0x22, 0x2F, 0x70, 0xD6, 0xCD, 0x1B, 0x5D, 0x67, 0x2B, 0x9E, 0xAC, 0x0D, 0xAB, 0xD3,
+    0x18, 0x37, 0x4D, 0x6B, 0x28, 0x92, 0x30, 0x01, 0x2A, 0xF3, 0x74, 0x80, 0x24, 0x8C, 0x33, 0x0F,
+    0x59, 0xCC, 0xD5, 0x94, 0x22, 0x2D, 0xD0, 0x95, 0xA9, 0x87, 0xD4, 0x77, 0x39, 0x50, 0xEA, 0x7A,
+    0x0A, 0xAA, 0xCD, 0x69, 0x21, 0x77, 0x95, 0x0E, 0x94, 0x7D, 0xD2, 0xA4, 0x82, 0x38, 0x63, 0xD3,
+    0x1E, 0x0B, 0x60, 0x3F, 0x3F, 0xF0, 0x4F, 0x7F, 0x21, 0xA8, 0x7E, 0xA3, 0x59, 0x67, 0x34, 0xE4,
+    0x22, 0x5A, 0xA4, 0xC1, 0xD4, 0x79, 0xC3, 0x18, 0x53, 0xAB, 0x10, 0x83, 0xD0, 0x32, 0xDA, 0x9C,
+    0x8E, 0x24, 0xA4, 0x35, 0x99, 0xCF, 0xA1, 0xA4, 0x8A, 0x32, 0x9A, 0x36, 0x83, 0x58, 0xAA, 0x1E,
+    0xC8, 0x3D, 0xBF, 0x7F, 0x60, 0x09, 0x22, 0x35, 0x5A, 0x86, 0x80, 0x6C, 0x9D, 0xDA, 0xF8, 0xFC,
+    0xF0, 0x5A, 0xEA, 0x98, 0x26, 0xAC, 0x17, 0x18, 0x97, 0xBB, 0x98, 0x16, 0x4E, 0x7D, 0x41, 0xEA,
+    0x77, 0x95, 0xC3, 0x5A, 0xB3, 0x17, 0x16, 0xE6, 0xEC, 0x4F, 0x7A, 0x32, 0x69, 0x49, 0xC5, 0xED,
+    0xEC, 0x39, 0x81, 0x4C, 0xC4, 0xA3, 0x6F, 0xBF, 0xDC, 0x40, 0x1B, 0x9D, 0xD5, 0x29, 0x14, 0x51,
+    0xF4, 0x8C, 0x23, 0xAD, 0x75, 0x43, 0x12, 0x54, 0x0B, 0x1D, 0x15, 0x8C, 0x29, 0x21, 0xC7, 0x38,
+    0x8C, 0xD7, 0x35, 0xBA, 0x51, 0x01, 0x15, 0x22, 0x5F, 0x25, 0x4C, 0x30, 0x8E, 0x12, 0x5D, 0x53,
+    0x38, 0xF5, 0x89, 0x16, 0xCF, 0xA2, 0x16, 0x47, 0x19, 0xF6, 0xAF, 0x33, 0x61, 0xD3, 0x9D, 0x4D,
+    0x56, 0x30, 0x78, 0xDA, 0xEC, 0xB7, 0xC0, 0x81, 0xEF, 0x5B, 0x32, 0x09, 0x64, 0x3F, 0xE9, 0x48,
+    0xEB, 0x31, 0x3A, 0xE4, 0xD0, 0x0E, 0xF1, 0xEB, 0x84, 0x96, 0x9C, 0x19, 0x99, 0x2F, 0xD0, 0x4D,
+    0xE6, 0x93, 0xA0, 0x1B, 0x3A, 0x5A, 0x7A, 0x66, 0xE9, 0x92, 0xE2, 0x93, 0x25, 0xA6, 0x27, 0xA6,
+    0xBD, 0x0C, 0x90, 0xB9, 0xB8, 0xE7, 0x06, 0x77, 0xE0, 0xB7, 0x16, 0xBD, 0xFB, 0x1C, 0x8A, 0x75,
+    0x14, 0x9B, 0xD6, 0x03, 0x57, 0xAA, 0x8B, 0x6A, 0xE8, 0xAB, 0x9F, 0xBB, 0xAA, 0x7F, 0x87, 0x30,
+    0x7E, 0x42, 0x8B, 0xB1, 0x91, 0xB5, 0x24, 0x0C, 0xEE, 0x6F, 0x45, 0x62, 0xB7, 0x61, 0x21, 0x90,
+    0x2F, 0x87, 0xA5, 0xFD, 0xCF, 0x93, 0xAD, 0x18, 0xAF, 0x15, 0xA8, 0xB1, 0x83, 0xC6, 0x4D, 0x9B,
+    0x9D, 0xBC, 0xDC, 0x6F, 0x22, 0x5B, 0x31, 0x02, 0x4E, 0xAC, 0x97, 0xD4, 0x0F, 0xAE, 0xD5, 0x69,
+    0x7E, 0x99, 0xB3, 0x33, 0xDE, 0xE3, 0xEC, 0xCC, 0x7E, 0x95, 0xB3, 0xA3, 0xCE, 0x46, 0x0F, 0x33,
+    0x5D, 0xED, 0x26, 0xFF, 0x8C, 0xDD, 0xC9, 0x9A, 0x72, 0x2F, 0x1C, 0xB4, 0xEA, 0xD2, 0x8C, 0xEC,
+    0x5A, 0x60, 0x92, 0x79, 0xDA, 0x09, 0x99, 0xEF, 0x28, 0x75, 0x9D, 0xF4, 0xC6, 0x15, 0x4D, 0xF9,
+    0xE1, 0x4D, 0x5B, 0x2E, 0xA7, 0xDC, 0xFF, 0x48, 0x4C, 0x2D, 0x30, 0x8E, 0x86, 0x60, 0xE1, 0xD1,
+    0x12, 0xC7, 0x9A, 0xC5, 0xA5, 0xCA, 0x7C, 0x14, 0xFB, 0xD3, 0xD1, 0x9D, 0x56, 0x4B, 0x16, 0x16,
+    0xBD, 0x44, 0x1C, 0x59, 0xCF, 0x1D, 0x87, 0xA9, 0xD4, 0xA7, 0x9E, 0x13, 0x5D, 0xF2, 0xA9, 0x67,
+    0xDA, 0xE9, 0xF7, 0x3C, 0x5D, 0xAB, 0xDF, 0xF0, 0xEA, 0xA3, 0xA0, 0xDF, 0xF0, 0xFA, 0x47, 0x21,
+    0xBD, 0x51, 0xA7, 0x37, 0x9A, 0xEC, 0x7A, 0x6D, 0x4E, 0xD5, 0xE6, 0x99, 0xA6, 0x48, 0x6B, 0xF3,
+    0x70, 0x33, 0xCE, 0xBC, 0x51, 0xE1, 0x6A, 0xE6, 0x73, 0x42, 0x30, 0xAE, 0xE0, 0x67, 0x8D, 0xB1,
+    0x13, 0x3E, 0xF5, 0x39, 0x63, 0xC4, 0x15, 0x4C, 0x11, 0xCA, 0xD3, 0x15, 0x5B, 0x94, 0xE1, 0x2A,
+    0x15, 0x65, 0xC3, 0x10, 0xC0, 0xAE, 0x63, 0xB1, 0x7C, 0x4F, 0xD2, 0x7C, 0x0B, 0x80, 0x33, 0xF0,
+    0x12, 0xBC, 0xC4, 0x8A, 0x64, 0xA9, 0x04, 0xDD, 0x27, 0x37, 0xC9, 0xAA, 0xE4, 0x1D, 0xF2, 0xAB,
+    0xFA, 0x35, 0xC6, 0x57, 0xF5, 0x6B, 0x76, 0xDA, 0xA6, 0x3F, 0xB4, 0x6D, 0xC8, 0xBE, 0xFD, 0xF4,
+    0xBB, 0xC1, 0x3C, 0xFA, 0xEC, 0xF5, 0xC6, 0xE8, 0x1F, 0x3E, 0x5B, 0x1B, 0xFD, 0x9A, 0xAE, 0x73,
+    0xFD, 0x57, 0xA9, 0x3F, 0xA1, 0xFB, 0xD4, 0x8F, 0x93, 0x36, 0xEB, 0x47, 0x49, 0x30, 0x2D, 0x40,
+    0x00, 0x92, 0x66, 0x3D, 0xB9, 0x71, 0x7B, 0x42, 0x81, 0xDF, 0x8C, 0x45, 0x3C, 0x4E, 0x0B, 0x57,
+    0x33, 0x8F, 0x5A, 0x2D, 0x41, 0xED, 0xA8, 0xB9, 0xA8, 0xEB, 0x2C, 0xB0, 0x02, 0xB2, 0x0E, 0x98,
+    0x84, 0x18, 0x55, 0x60, 0x9E, 0x04, 0xFA, 0x11, 0xA4, 0x75, 0x0B, 0xA5, 0xAE, 0x51, 0xAD, 0x71,
+    0x18, 0x37, 0x81, 0x29, 0x15, 0x5A, 0x24, 0x50, 0x88, 0x78, 0x56, 0x9B, 0xAF, 0x90, 0x79, 0x66,
+    0x4C, 0xA0, 0xD5, 0x01, 0xDD, 0xE4, 0x0E, 0xE3, 0x7A, 0x28, 0xD3, 0x1A, 0x2A, 0xB8, 0x9F, 0x17,
+    0xC8, 0x69, 0x31, 0xFF, 0x7B, 0x13, 0x95, 0xEC, 0xE1, 0x38, 0xF5, 0x03, 0xCD, 0x83, 0x2C, 0xFA,
+    0xA9, 0x5E, 0x3E, 0xD9, 0x65, 0x4D, 0xDA, 0x1A, 0xAF, 0x43, 0x81, 0x0E, 0x25, 0xBA, 0x99, 0xA0,
+    0x9B, 0x19, 0x69, 0x5D, 0x91, 0xF9, 0x0A, 0xE3, 0x2B, 0x0A, 0x37, 0x65, 0x6E, 0xCB, 0xE4, 0xA6,
+    0x2D, 0xE4, 0x79, 0xB2, 0x65, 0x4E, 0xB4, 0x4C, 0x0A, 0x0B, 0xED, 0x04, 0xCC, 0xA9, 0x06, 0x4E,
+    0xDF, 0xB7, 0x87, 0x35, 0xD5, 0x02, 0xA5, 0x1B, 0x58, 0xBB, 0xE3, 0xA1, 0x98, 0x82, 0x7E, 0xCB,
+    0x47, 0xCE, 0xF2, 0x53, 0x35, 0x3A, 0x8C, 0x61, 0xA6, 0x1B, 0x8C, 0x9B, 0xA0, 0x42, 0x12, 0x28,
+    0x45, 0xA2, 0x33, 0xB4, 0xDA, 0x7C, 0x85, 0x22, 0xE6, 0x3A, 0x8D, 0xED, 0xA1, 0xCB, 0x1D, 0xE6,
+    0xD9, 0x00, 0x7D, 0xF4, 0xE0, 0x15, 0x16, 0x73, 0xAA, 0x21, 0x3F, 0xD5, 0xB0, 0x5F, 0xED, 0xDE,
+    0xD3, 0xDF, 0x08, 0x57, 0x14, 0x31, 0x7A, 0x2A, 0xE3, 0x9F, 0xE5, 0x72, 0xE3, 0x0C, 0xA8, 0xB6,
+    0x03, 0xD0, 0xEF, 0xB6, 0x00, 0xE6, 0x7A, 0x00, 0xC8, 0x1F, 0x89, 0x25, 0xA3, 0x98, 0x39, 0xA8,
+    0x62, 0x8C, 0xD5, 0xA5, 0x22, 0x0E, 0x1D, 0x32, 0x11, 0x47, 0x56, 0x9B, 0x37, 0x37, 0x20, 0x17,
+    0x71, 0x71, 0x44, 0x0B, 0x6C, 0x6F, 0x2E, 0x62, 0x46, 0x35, 0xBA, 0x2B, 0x94, 0x51, 0x4D, 0x4F,
+    0xA2, 0x7E, 0xBE, 0xB0, 0x71, 0x86, 0x22, 0xD6, 0xE5, 0x2E, 0xC0, 0x42, 0x7A, 0x78, 0xA0, 0xFE,
+    0xC6, 0xC2, 0x6A, 0x79, 0xEF, 0x1D, 0x71, 0xE5, 0x9F, 0xDE, 0xEC, 0xE6, 0x49, 0xA7, 0x85, 0x99,
+    0xF1, 0x59, 0x50, 0xA1, 0x22, 0x77, 0xE6, 0x46, 0xA0, 0x52, 0x4B, 0x63, 0x13, 0x91, 0x7A, 0x86,
+    0x91, 0x36, 0x09, 0x5C, 0x80, 0xCC, 0x27, 0x1D, 0x14, 0xE4, 0x0D, 0x4C, 0x11, 0x8F, 0xEA, 0xF2,
+    0x85, 0xFF, 0x3D, 0x2D, 0x3F, 0xBB, 0x29, 0xAD, 0x5E, 0x99, 0x5C, 0x1C, 0x16, 0x65, 0x21, 0x75,
+    0xC7, 0x49, 0xFD, 0x14, 0x7D, 0xA7, 0x85, 0x3D, 0x89, 0xB6, 0xBD, 0xD5, 0xC1, 0x2F, 0xAA, 0xA1,
+    0x8A, 0xB8, 0x4C, 0xC4, 0x9A, 0x37, 0x37, 0xBE, 0xB0, 0x4A, 0x79, 0x61, 0xE3, 0xCC, 0xCE, 0x50,
+    0xFC, 0x03, 0x2E, 0xD1, 0x66, 0x3E, 0xF9, 0xA4, 0x22, 0x91, 0x7A, 0xED, 0x6F, 0xAB, 0x85, 0xA3,
+    0x10, 0xAF, 0x6F, 0x15, 0xAE, 0xB0, 0x13, 0x3A, 0xBA, 0xCC, 0xA7, 0xF5, 0x44, 0x6D, 0x2B, 0x91,
+    0x26, 0x95, 0x8E, 0xC2, 0x42, 0x15, 0xA7, 0x4E, 0x6B, 0x30, 0xF5, 0x01, 0x72, 0xE9, 0xC9, 0xC5,
+    0xED, 0x7A, 0x67, 0x07, 0x64, 0x89, 0x12, 0xE9, 0xC8, 0x2F, 0xE6, 0xCD, 0x3A, 0x4F, 0xD0, 0xAF,
+    0xDD, 0xEF, 0x6A, 0x6D, 0x0E, 0x67, 0xB0, 0xFF, 0x09, 0x7F, 0x40, 0xA4, 0x4F, 0x45, 0xE4, 0x9A,
+    0x5C, 0xA4, 0x2B, 0x2D, 0xC5, 0x63, 0x35, 0x3A, 0xF4, 0xB0, 0x65, 0x3C, 0xB9, 0xAB, 0x48, 0x43,
+    0xDA, 0xA6, 0x3D, 0x85, 0xAC, 0x62, 0x59, 0x3C, 0xEE, 0x9D, 0x45, 0xC3, 0x5C, 0xEA, 0xF4, 0x8F,
+    0x17, 0xD1, 0xA4, 0x9A, 0x58, 0xE8, 0xCD, 0xBC, 0x7A, 0xA5, 0x4F, 0x44, 0xBC, 0x7C, 0xA7, 0x2B,
+    0x6C, 0xAE, 0x6B, 0x1D, 0x66, 0x54, 0xBA, 0x29, 0x5C, 0x29, 0x0D, 0x8B, 0x76, 0xCD, 0xE6, 0x3E,
+    0xC8, 0x75, 0x8D, 0x0A, 0x63, 0xF8, 0xD2, 0x1E, 0xAF, 0x92, 0xB3, 0x52, 0x93, 0x8B, 0x38, 0x75,
+    0x4B, 0xAD, 0xD6, 0xB9, 0x58, 0xE3, 0x07, 0xF2, 0x33, 0x3F, 0xC4, 0x68, 0x69, 0x0D, 0x1B, 0x15,
+    0x67, 0x45, 0xFC, 0x5C, 0xA4, 0xCF, 0x6F, 0x61, 0x9E, 0x6D, 0x49, 0xDA, 0x2D, 0x28, 0x8D, 0x27,
+    0xAB, 0x7B, 0x54, 0x97, 0x79, 0xE6, 0xCC, 0xED, 0xDC, 0x27, 0x22, 0x0D, 0xA9, 0xBC, 0xBF, 0xEB,
+    0xBF, 0xAA, 0x30, 0xA2, 0x48, 0x3D, 0xEE, 0xAB, 0xEB, 0x79, 0xFF, 0x6E, 0xEC, 0xAC, 0x15, 0x59,
+    0xD4, 0xDD, 0x45, 0x2C, 0x28, 0xFE, 0x4E, 0xF2, 0xFF, 0x0F, 0x7F, 0xFF, 0x10, 0x00, 0x49, 0x33,
+    0x05, 0x30, 0xCF, 0x04, 0x80, 0xFB, 0x92, 0xCF, 0x92, 0xFE, 0x5F, 0xC2, 0xDF, 0x87, 0x7D, 0x10,
+    0xC6, 0x51, 0x4C, 0x2E, 0x1E, 0xDE, 0x4D, 0x7A, 0xFF, 0x16, 0x8A, 0xB2, 0x87, 0xA3, 0x26, 0x37,
+    0xBA, 0x4E, 0x7D, 0xBB, 0x3B, 0xD9, 0x03, 0xB7, 0x28, 0x24, 0xA4, 0xDF, 0xD9, 0x06, 0xB3, 0xAE,
+    0xD2, 0xAB, 0x9E, 0xB2, 0x23, 0x5F, 0x41, 0xD6, 0x40, 0x15, 0xA1, 0x04, 0xD7, 0x6D, 0x56, 0x8B,
+    0x34, 0xB9, 0xD4, 0xEC, 0x07, 0xE6, 0xB2, 0x42, 0x64, 0xC5, 0x53, 0x9B, 0x7D, 0x9C, 0xCE, 0x0C,
+    0x19, 0xCB, 0xE1, 0x6D, 0xEE, 0xA0, 0xBC, 0x04, 0xF3, 0x15, 0xDC, 0x3B, 0xF7, 0x11, 0x27, 0xB0,
+    0x93, 0xD2, 0x69, 0xD6, 0xB8, 0x81, 0xF7, 0x99, 0x5B, 0x91, 0x25, 0x67, 0xA5, 0x89, 0xB2, 0xF6,
+    0xD4, 0xE6, 0x8B, 0x2C, 0xA4, 0xE7, 0xA9, 0x97, 0xDB, 0xE8, 0xD1, 0xE5, 0x2E, 0x72, 0xDE, 0xC5,
+    0x9F, 0x19, 0x17, 0xB7, 0xFB, 0xBC, 0x83, 0xBF, 0xBF, 0x22, 0x06, 0x18, 0x51, 0x30, 0xEE, 0xC6,
+    0x78, 0xE4, 0x16, 0xE6, 0xBC, 0x7F, 0xA0, 0x47, 0x24, 0x50, 0xAC, 0x2C, 0x60, 0xA4, 0x5E, 0x97,
+    0x39, 0x36, 0xCE, 0xEC, 0x82, 0x49, 0x4A, 0x8C, 0xA3, 0xF4, 0xBA, 0xA1, 0x68, 0x54, 0x4B, 0xDE,
+    0x52, 0x61, 0xB6, 0x28, 0x30, 0xDF, 0xC5, 0xB8, 0xEC, 0x87, 0x5E, 0xD7, 0xE9, 0x8D, 0x46, 0xB5,
+    0xBA, 0x6E, 0xA9, 0x74, 0x33, 0xA5, 0x4C, 0x42, 0x81, 0x79, 0x3A, 0x18, 0xAF, 0xEB, 0x56, 0x37,
+    0x2A, 0x74, 0xAA, 0xA5, 0xAA, 0x98, 0x32, 0x99, 0x52, 0x60, 0xB6, 0x30, 0x2E, 0x5D, 0xA1, 0xEB,
+    0x44, 0x50, 0x2D, 0x0B, 0xA8, 0x28, 0x6D, 0xCC, 0xC2, 0x4A, 0x43, 0x2E, 0x0D, 0xFB, 0x37, 0x2C,
+    0x40, 0x72, 0x91, 0x6F, 0xA6, 0x35, 0x55, 0xEA, 0xE9, 0x32, 0x4F, 0x6B, 0x9C, 0x8A, 0xD9, 0x16,
+    0xAB, 0x9B, 0x02, 0xDD, 0x94, 0xA4, 0xF5, 0x84, 0xCC, 0x8F, 0x31, 0x7E, 0x36, 0x98, 0xB2, 0x0B,
+    0xC9, 0x4D, 0x5B, 0xCA, 0xF3, 0x98, 0xBB, 0x0D, 0xB4, 0xAE, 0xAF, 0x12, 0xCD, 0x34, 0x87, 0x0F,
+    0xEC, 0x95, 0xEC, 0x64, 0x48, 0x91, 0xEA, 0x9E, 0x09, 0xC9, 0x8A, 0xDC, 0x2A, 0xB1, 0x99, 0xE7,
+    0x4E, 0x9D, 0x04, 0x6E, 0x05, 0x3A, 0xAA, 0x8A, 0x31, 0xD3, 0x09, 0xB9, 0x1D, 0x1B, 0x9B, 0xF9,
+    0x49, 0xEA, 0x75, 0x28, 0x92, 0x40, 0x97, 0xD3, 0x33, 0x36, 0x76, 0x42, 0x6E, 0x5C, 0x6E, 0xB3,
+    0x1F, 0xFA, 0xD4, 0xEB, 0x9F, 0xFA, 0x24, 0x70, 0xA7, 0xA6, 0x63, 0xDE, 0x30, 0xA6, 0x08, 0xE4,
+    0x36, 0x0B, 0x64, 0x5E, 0xB7, 0xE8, 0x10, 0x89, 0x31, 0xCF, 0x04, 0xCC, 0xA9, 0x86, 0x03, 0xBB,
+    0x46, 0xFB, 0x37, 0xC3, 0xE9, 0xA1, 0xF5, 0x4E, 0x36, 0xCF, 0x84, 0xCF, 0xEE, 0xE2, 0x62, 0x65,
+    0x63, 0xBD, 0x44, 0x1E, 0x5E, 0x38, 0xD3, 0x50, 0xB2, 0x0D, 0x17, 0x74, 0x80, 0xBE, 0xB0, 0x51,
+    0xE5, 0x67, 0xAF, 0x36, 0x50, 0x14, 0x16, 0xAA, 0x0A, 0xF4, 0xC7, 0x01, 0xCC, 0x6B, 0x1E, 0x2E,
+    0x94, 0x90, 0xB4, 0xFD, 0x60, 0xF1, 0xB7, 0xD3, 0x06, 0x1D, 0x4C, 0xCD, 0xDC, 0xE6, 0x4D, 0xD6,
+    0x51, 0x88, 0x58, 0x32, 0x19, 0xC2, 0x39, 0xF6, 0x01, 0x55, 0x8E, 0x6E, 0x2A, 0x12, 0x2E, 0xEE,
+    0x78, 0x42, 0xDB, 0x36, 0x1A, 0xB6, 0xB3, 0xBE, 0xB0, 0xF9, 0xD3, 0x1D, 0x65, 0xE6, 0xA9, 0x26,
+    0x24, 0x1F, 0xB5, 0x64, 0xAF, 0x7A, 0xCA, 0x02, 0xBA, 0x8A, 0xF4, 0xF5, 0x40, 0x99, 0x36, 0xAA,
+    0x35, 0x75, 0xE1, 0x8C, 0x74, 0x64, 0xB2, 0x57, 0x8B, 0x66, 0x72, 0x91, 0x44, 0xA4, 0xA1, 0xAC,
+    0xCF, 0x36, 0xBA, 0xC3, 0xF8, 0xC2, 0x91, 0xBB, 0x1E, 0xCA, 0xAC, 0x8E, 0x25, 0xE9, 0xE4, 0xA3,
+    0x0E, 0xB2, 0x1F, 0x8A, 0x88, 0x14, 0x22, 0xD2, 0xAF, 0x36, 0x37, 0x5F, 0xFE, 0x38, 0x40, 0xFE,
+    0xBC, 0x87, 0xAD, 0x12, 0x74, 0xA8, 0xA0, 0x78, 0xBA, 0x83, 0x5E, 0xB7, 0xE4, 0x75, 0xDA, 0x25,
+    0x2B, 0x32, 0x91, 0x9A, 0x64, 0x37, 0x14, 0x7C, 0xE0, 0x3F, 0x92, 0xC8, 0x92, 0xF2, 0x4F, 0xFB,
+    0xA4, 0xA5, 0xCB, 0x5D, 0x12, 0x2A, 0xB2, 0x1B, 0x0D, 0x45, 0x2E, 0xD2, 0xCF, 0x45, 0x7E, 0x16,
+    0x30, 0xCF, 0x79, 0x66, 0x39, 0x49, 0x98, 0x91, 0xDB, 0x65, 0xD2, 0x21, 0xE2, 0x58, 0xB4, 0x7B,
+    0xA8, 0x4D, 0x7D, 0x18, 0xAC, 0xC1, 0xEF, 0x7F, 0xE9, 0x6F, 0xB7, 0x12, 0x22, 0xD2, 0x2F, 0x44,
+    0xE4, 0xE3, 0xDB, 0x9B, 0x9B, 0xAF, 0xFC, 0xAD, 0x56, 0xE2, 0x6A, 0x5C, 0x89, 0x03, 0xB8, 0xDD,
+    0x95, 0x70, 0x14, 0x52, 0xC7, 0x95, 0x30, 0x4F, 0x77, 0x14, 0xEB, 0x95, 0x10, 0x91, 0x57, 0x45,
+    0x64, 0x77, 0x25, 0x8A, 0xB4, 0xFE, 0x82, 0x95, 0x50, 0x61, 0x04, 0x55, 0x7E, 0xB7, 0x95, 0xCB,
+    0xA4, 0x8D, 0x39, 0x8B, 0xF7, 0xD3, 0x7E, 0x50, 0x3D, 0xBB, 0x65, 0x3B, 0x1B, 0xCD, 0xB6, 0x6A,
+    0x11, 0xE9, 0x29, 0x45, 0xD8, 0xBF, 0xF1, 0xE4, 0x90, 0x06, 0x50, 0xED, 0x67, 0xCA, 0x80, 0xA5,
+    0xFD, 0xEF, 0xD5, 0xC2, 0x15, 0x22, 0x36, 0x95, 0xD5, 0x60, 0xB7, 0x0F, 0xC1, 0x24, 0xF3, 0xE6,
+    0xD9, 0xA0, 0xDC, 0xEF, 0xEF, 0xD5, 0xCE, 0x4D, 0xFA, 0x9D, 0x25, 0x98, 0x88, 0x8B, 0x19, 0x83,
+    0xB1, 0x22, 0x75, 0x29, 0x31, 0x08, 0x89, 0x90, 0x40, 0xE3, 0xAD, 0xA9, 0x4B, 0xA9, 0x8D, 0xD4,
+    0xEC, 0x03, 0x90, 0xE5, 0xA0, 0xE8, 0x06, 0x3D, 0x13, 0xCB, 0x81, 0x99, 0xC7, 0xF8, 0x1C, 0xB6,
+    0x18, 0x47, 0x95, 0x50, 0x90, 0x04, 0x3A, 0x52, 0x6F, 0x3C, 0xC6, 0xCE, 0x60, 0xA2, 0x43, 0x64,
+    0x5B, 0x85, 0x0E, 0xF4, 0xDB, 0x1E, 0xCC, 0x16, 0x90, 0x87, 0x75, 0xD2, 0xA8, 0x5B, 0x3B, 0x2C,
+    0x4B, 0x20, 0x6F, 0xA0, 0x5C, 0x31, 0xF8, 0x92, 0x83, 0xAF, 0x20, 0xCB, 0x78, 0xA7, 0x76, 0xE6,
+    0xE6, 0x9B, 0x24, 0x97, 0x54, 0x20, 0xB7, 0x69, 0x4D, 0x8F, 0xB1, 0x69, 0x1D, 0x01, 0x17, 0x9D,
+    0x0A, 0x24, 0xC1, 0x38, 0x32, 0x5F, 0x41, 0xAE, 0x1B, 0x18, 0x15, 0xC0, 0xEE, 0xDC, 0x33, 0xA0,
+    0x08, 0xC0, 0xDC, 0x0E, 0x09, 0xAB, 0xB4, 0x1E, 0x4C, 0x61, 0x12, 0x86, 0x14, 0x8E, 0xEA, 0x21,
+    0x11, 0x3F, 0xC4, 0x20, 0xC0, 0xA1, 0x7D, 0xA0, 0xEB, 0x6E, 0x88, 0x57, 0xEE, 0x52, 0x86, 0x13,
+    0xC8, 0x6D, 0x05, 0xBD, 0x0A, 0x64, 0xB5, 0xAE, 0x29, 0x63, 0x71, 0xA5, 0xC0, 0x38, 0xA6, 0xF4,
+    0xD0, 0xA6, 0x35, 0xBA, 0x29, 0x21, 0xBB, 0x16, 0x20, 0x37, 0x0E, 0xC6, 0x15, 0x11, 0xA5, 0xA1,
+    0x64, 0x9D, 0xAA, 0xCD, 0xDD, 0xDA, 0xE3, 0xAC, 0x41, 0xAD, 0x40, 0x4B, 0x03, 0x66, 0x09, 0xEC,
+    0x1F, 0xA6, 0x5A, 0x13, 0x91, 0xFF, 0x02, 0x11, 0x07, 0x1C, 0x5F, 0x23, 0x47, 0xB5, 0xCC, 0x30,
+    0x9E, 0x96, 0x19, 0xBA, 0xD1, 0x01, 0xE3, 0x72, 0x28, 0xE8, 0xA0, 0xCA, 0x3C, 0x2A, 0x4C, 0x40,
+    0x5F, 0x0F, 0x60, 0x76, 0x88, 0xF8, 0xB4, 0x86, 0x44, 0x80, 0xB4, 0x8D, 0xB9, 0xBB, 0xE8, 0x11,
+    0xE8, 0x66, 0x6F, 0xF2, 0x27, 0xF7, 0x50, 0xF4, 0xC0, 0xC2, 0x0D, 0x50, 0xAF, 0xD3, 0x90, 0x3F,
+    0x5A, 0x43, 0x3B, 0x06, 0x73, 0xAA, 0x86, 0x2B, 0xC7, 0x07, 0xA3, 0x31, 0x40, 0x3E, 0x66, 0x49,
+    0x40, 0x87, 0xD4, 0x53, 0x58, 0x63, 0xE9, 0x63, 0x8D, 0xBF, 0x62, 0x82, 0x0A, 0x3A, 0xC4, 0x02,
+    0x9D, 0x71, 0xFD, 0xB0, 0xD7, 0xA7, 0x13, 0xE0, 0xE7, 0x01, 0xF4, 0x4D, 0x0B, 0xE9, 0x8E, 0xDF,
+    0x7D, 0x61, 0x7D, 0x73, 0x4A, 0x1B, 0x4B, 0xD3, 0x46, 0x1C, 0x94, 0x2D, 0x3B, 0xD1, 0x68, 0xA4,
+    0xE4, 0xB1, 0xBB, 0x28, 0x19, 0xED, 0xA1, 0xE4, 0x7E, 0x78, 0x91, 0x29, 0x69, 0xAD, 0x5A, 0x4A,
+    0x74, 0xAD, 0x5A, 0x8C, 0x33, 0x9E, 0x09, 0x53, 0xA8, 0x74, 0x43, 0x12, 0x0A, 0x62, 0x89, 0xD3,
+    0x64, 0x1E, 0x46, 0x3B, 0x94, 0xBC, 0x63, 0x21, 0xEB, 0x81, 0xBC, 0x1E, 0x4A, 0x86, 0xAA, 0x5D,
+    0x47, 0xFA, 0x3B, 0xB9, 0xA1, 0x35, 0x0A, 0x2C, 0x59, 0xC5, 0xE9, 0xEC, 0x21, 0xE8, 0x0A, 0x18,
+    0x1B, 0xB7, 0x57, 0x7F, 0x30, 0x8D, 0xE0, 0xA4, 0x2A, 0xF3, 0x94, 0xBA, 0xC1, 0xB8, 0x16, 0x5D,
+    0xEF, 0xF9, 0x70, 0x92, 0x04, 0x8C, 0xDB, 0x22, 0xAD, 0x4D, 0xFD, 0xBB, 0x21, 0x11, 0xE9, 0xC9,
+    0x65, 0x7B, 0x48, 0x45, 0xDD, 0x55, 0xDC, 0x9F, 0xAC, 0x3F, 0x1C, 0x72, 0x66, 0x87, 0x20, 0x7B,
+    0x3A, 0xD0, 0x15, 0x7B, 0xE6, 0xBB, 0x9F, 0xE4, 0xDF, 0x04, 0x66, 0xEB, 0x82, 0xD1, 0x67, 0x2A,
+    0x5A, 0x37, 0x63, 0x45, 0x6B, 0x0F, 0xD4, 0xD4, 0x41, 0x07, 0xB9, 0xFD, 0xB5, 0x20, 0x9D, 0xF5,
+    0xAF, 0x06, 0xBE, 0x5E, 0xB0, 0x30, 0x6F, 0x60, 0xF1, 0x19, 0x20, 0x9A, 0xB1, 0x51, 0xA9, 0xED,
+    0xFF, 0x42, 0xC8, 0xE9, 0x1A, 0x62, 0xFA, 0xD9, 0xF7, 0x02, 0x12, 0x13, 0x25, 0x61, 0x8F, 0x8E,
+    0x1A, 0x62, 0x93, 0xE8, 0xF6, 0x84, 0x29, 0x83, 0xA1, 0x62, 0x4F, 0x90, 0xB2, 0x0B, 0xF9, 0x9A,
+    0x32, 0x01, 0x2A, 0x26, 0x40, 0xCF, 0x8C, 0x21, 0x03, 0xAC, 0x5A, 0x2A, 0x50, 0x81, 0x0E, 0x92,
+    0x40, 0x0B, 0xBA, 0x51, 0xAB, 0x17, 0xD0, 0x75, 0x22, 0x62, 0xD3, 0x5A, 0xDF, 0x5E, 0xD4, 0x99,
+    0xD7, 0x4D, 0x1A, 0x32, 0xAF, 0xEB, 0x24, 0x18, 0x97, 0x7A, 0xD5, 0x1A, 0x9B, 0x79, 0xD5, 0xE6,
+    0x18, 0x9F, 0x84, 0x02, 0xE3, 0x74, 0x28, 0xC9, 0xAD, 0xA9, 0x27, 0xE4, 0x0F, 0x2F, 0xDC, 0x98,
+    0x42, 0x56, 0x4C, 0x29, 0xA5, 0xA1, 0x1A, 0xB4, 0x07, 0x5D, 0x41, 0xC4, 0x0F, 0xF2, 0x8D, 0xDF,
+    0xD9, 0xEB, 0x4A, 0x5D, 0x84, 0x7F, 0xA0, 0x6B, 0x18, 0xA7, 0x1E, 0xA6, 0x99, 0x87, 0xCA, 0x38,
+    0xE8, 0x8D, 0x85, 0x2E, 0x97, 0x86, 0xB6, 0x90, 0x5E, 0x85, 0xE2, 0x9F, 0x2D, 0x92, 0x30, 0xA1,
+    0xD0, 0xCD, 0x84, 0xFC, 0x54, 0x33, 0x21, 0xD7, 0xF5, 0x84, 0x32, 0xF5, 0x85, 0xDD, 0xCE, 0xBC,
+    0x91, 0xDE, 0x38, 0x2D, 0x8D, 0xB1, 0x71, 0x63, 0xE4, 0x31, 0x1F, 0xE2, 0xF5, 0xED, 0xCD, 0x8B,
+    0xB4, 0xC3, 0x9E, 0x2E, 0xD6, 0xB8, 0x90, 0xA1, 0xD2, 0xAC, 0xB6, 0x37, 0x48, 0x44, 0x1C, 0x0B,
+    0xA9, 0x77, 0x3E, 0x64, 0xBA, 0xBE, 0xD2, 0xED, 0x31, 0x34, 0xF3, 0x7A, 0x50, 0x9A, 0xD3, 0x75,
+    0x0A, 0xD3, 0xC2, 0x13, 0x1E, 0x8A, 0x06, 0x0E, 0x5C, 0x04, 0xF8, 0xDA, 0xE6, 0x45, 0x2D, 0x3D,
+    0x17, 0x36, 0x5D, 0xB6, 0x2B, 0x56, 0x2D, 0x4A, 0x84, 0x42, 0xC2, 0xBA, 0x48, 0xBA, 0x47, 0xEA,
+    0x7A, 0x90, 0x58, 0xAA, 0x8C, 0x20, 0xE7, 0x64, 0x1B, 0x4A, 0x4F, 0x72, 0xE9, 0x3F, 0x4B, 0x51,
+    0xDF, 0xEF, 0x14, 0xF5, 0x77, 0xEA, 0xF9, 0x06, 0x48, 0xE6, 0x80, 0x5E, 0x02, 0xEA, 0x12, 0x7C,
+    0x93, 0x83, 0xD6, 0x58, 0xE3, 0x93, 0x60, 0x3C, 0xD3, 0xCC, 0x63, 0xBE, 0x5D, 0xA3, 0x3E, 0x6D,
+    0x76, 0x01, 0x0A, 0xBA, 0x8B, 0xEA, 0x53, 0x7D, 0x5A, 0xA3, 0xDA, 0x0A, 0x3A, 0x63, 0xE9, 0x93,
+    0x40, 0xCF, 0xDC, 0x6F, 0x61, 0x02, 0x70, 0x75, 0xC8, 0x2D, 0x1B, 0xE0, 0xBB, 0x3E, 0x02, 0x02,
+    0x0E, 0x5C, 0xFC, 0x9B, 0x30, 0x59, 0xC3, 0x3C, 0x2E, 0x94, 0x58, 0x54, 0x64, 0xD2, 0x81, 0xF9,
+    0x62, 0x26, 0x2B, 0x72, 0x1B, 0xB3, 0x7B, 0x93, 0x5D, 0x36, 0x74, 0x64, 0xA3, 0xBE, 0x8B, 0x8D,
+    0x54, 0x24, 0x24, 0x22, 0xDD, 0x17, 0xB1, 0x31, 0x63, 0x0B, 0xE3, 0x40, 0x39, 0x9A, 0xA7, 0xAE,
+    0x7E, 0xFF, 0xEA, 0xA5, 0xE6, 0xDF, 0xBA, 0x4B, 0xFC, 0xEA, 0x27, 0x24, 0x36, 0xE3, 0xC4, 0x4B,
+    0x27, 0xFE, 0x3C, 0x3B, 0x98, 0xFC, 0x53, 0x0E, 0xFE, 0xEA, 0x67, 0x29, 0x46, 0xAE, 0x6D, 0x9C,
+    0x1E, 0xFE, 0xDC, 0xBF, 0xB9, 0x79, 0x49, 0x44, 0xAE, 0x6F, 0x6E, 0x6E, 0xAE, 0xF7, 0x4A, 0x29,
+    0x22, 0x11, 0x4B, 0x24, 0x22, 0xDD, 0xBD, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0xA7, 0xE1, 0x38, 0x77,
+    0xEC, 0xA4, 0x36, 0x57, 0xF4, 0x5F, 0xFD, 0x2D, 0xFF, 0x13, 0xAB, 0xDA, 0x46, 0xE4, 0xC7, 0x9B,
+    0x9B, 0x2F, 0x00, 0xF7, 0x6E, 0x6C, 0x14, 0x22, 0xFF, 0x7E, 0x63, 0xE3, 0x34, 0xA7, 0x8D, 0xBF,
+    0x90, 0x04, 0x63, 0xA7, 0xBA, 0xBE, 0x87, 0xAA, 0xAA, 0xA6, 0xA3, 0xD1, 0x68, 0x1F, 0xA7, 0xEF,
+    0xD5, 0x61, 0x2B, 0x6D, 0xFA, 0xEC, 0x5A, 0x6B, 0x1E, 0x09, 0xB9, 0xAE, 0xC7, 0x99, 0x3B, 0x99,
+    0x71, 0xF5, 0x44, 0x99, 0xFD, 0xF0, 0xFA, 0x47, 0x61, 0x3A, 0x32, 0x46, 0xDF, 0xF0, 0xE1, 0xD0,
+    0xBE, 0x58, 0xC5, 0xD5, 0x0D, 0xC6, 0x32, 0x82, 0xE6, 0xC0, 0xD7, 0xFF, 0xF4, 0x15, 0x59, 0x7D,
+    0xFF, 0xF6, 0x15, 0xED, 0xB9, 0x07, 0xCE, 0x91, 0xD4, 0x18, 0x18, 0xA1, 0x02, 0x99, 0x63, 0x8C,
+    0x6A, 0xC9, 0x3C, 0x25, 0xF4, 0xD1, 0xC0, 0x0C, 0xD1, 0xD6, 0x4E, 0xBE, 0x3D, 0x80, 0xF6, 0x14,
+    0x22, 0x88, 0xF4, 0x2A, 0xF1, 0x51, 0xAA, 0xA6, 0xF1, 0xA2, 0x21, 0x63, 0x4F, 0x60, 0xFF, 0xA9,
+    0xA7, 0x6D, 0x21, 0xC2, 0xEA, 0x4E, 0x87, 0xDE, 0xBD, 0x48, 0x87, 0x75, 0x9A, 0xDC, 0xB4, 0x65,
+    0x5F, 0xF6, 0xE5, 0xB2, 0xEC, 0x8B, 0x3E, 0x6B, 0x80, 0x8B, 0x18, 0x87, 0x58, 0xB3, 0x52, 0xD2,
+    0x17, 0x2B, 0xBD, 0xE4, 0x1F, 0x03, 0x1C, 0xDE, 0x5E, 0x2D, 0x0F, 0xED, 0xE7, 0x70, 0xC9, 0xF6,
+    0x9C, 0xD5, 0x9C, 0xFE, 0x30, 0x87, 0xF6, 0x67, 0xEF, 0x75, 0xFD, 0x3E, 0x9E, 0x7A, 0xF1, 0xFB,
+    0x2F, 0xFE, 0x3A, 0x72, 0x70, 0x89, 0x4B, 0x7C, 0xED, 0xA5, 0xAF, 0xFD, 0xF9, 0xAF, 0x23, 0x01,
+    0x1C, 0xE4, 0x20, 0xCC, 0x97, 0xBB, 0xCF, 0xC4, 0xFD, 0xEA, 0x27, 0xCC, 0x97, 0xDF, 0x22, 0x3E,
+    0x7F, 0xFD, 0x5F, 0xF0, 0xE5, 0xF8, 0xFC, 0x75, 0x7F, 0x31, 0xE4, 0x74, 0x02, 0xA9, 0x83, 0x4C,
+    0x3C, 0x01, 0x68, 0x47, 0x8C, 0x81, 0x13, 0xBA, 0xCE, 0x1C, 0x68, 0x3F, 0x56, 0x01, 0x98, 0x6A,
+    0x3F, 0x02, 0x52, 0x37, 0x32, 0x16, 0xB8, 0x9A, 0x5E, 0x6F, 0x80, 0xCC, 0x5E, 0x99, 0xFE, 0x91,
+    0x3D, 0xD0, 0x5C, 0x35, 0x26, 0x5F, 0x6A, 0x79, 0xF5, 0xC6, 0x7B, 0x6F, 0xFD, 0x28, 0x54, 0xB3,
+    0xB2, 0xBF, 0xDA, 0x9A, 0x3C, 0x69, 0x56, 0xB9, 0xE1, 0x67, 0xCD, 0x09, 0xF4, 0xF5, 0xC6, 0x8C,
+    0x92, 0x9A, 0xF6, 0xB8, 0xFA, 0xD8, 0x8F, 0x39, 0xA1, 0xEB, 0x13, 0x53, 0xED, 0x53, 0x3F, 0xD2,
+    0x6F, 0xB9, 0x29, 0x41, 0xFB, 0xD1, 0xF9, 0xCC, 0x8E, 0x19, 0x9B, 0x47, 0xAF, 0x85, 0xCC, 0xA9,
+    0x3B, 0xA1, 0xDC, 0x52, 0x81, 0xAC, 0x53, 0x62, 0x81, 0x7D, 0x7B, 0x0B, 0xCE, 0xD1, 0xBD, 0x3C,
+    0x3F, 0x04, 0x1A, 0x7E, 0x2D, 0xE7, 0xA7, 0xBC, 0x8E, 0x79, 0xDA, 0x81, 0x6C, 0x60, 0xA4, 0xEB,
+    0x01, 0xCB, 0x3F, 0xD0, 0x0E, 0x9C, 0xD7, 0x7E, 0x88, 0xCC, 0x06, 0x06, 0x80, 0x2B, 0xD9, 0xA3,
+    0xFF, 0xF7, 0xFB, 0xFC, 0x11, 0xD9, 0xC5, 0x81, 0x0B, 0x3F, 0x6F, 0xA7, 0x93, 0xF1, 0xAC, 0xC8,
+    0x5E, 0xAD, 0xDB, 0x6A, 0x60, 0xE5, 0xBD, 0x66, 0x64, 0xDE, 0x0D, 0xC1, 0x9C, 0x48, 0xDE, 0xF3,
+    0xA3, 0x81, 0x9F, 0xB7, 0xDC, 0x08, 0xF3, 0x48, 0x9D, 0x8F, 0xF4, 0xDB, 0x6E, 0x3A, 0x30, 0xF5,
+    0x9A, 0x3D, 0xCF, 0x54, 0xFB, 0xF1, 0xF9, 0xF4, 0x35, 0x7B, 0x65, 0xE0, 0xEC, 0x71, 0x1B, 0x74,
+    0xAD, 0xEB, 0x76, 0x9A, 0x67, 0x8F, 0x34, 0x03, 0x7B, 0xE9, 0x4D, 0x9F, 0xC3, 0xC2, 0xE5, 0x6D,
+    0x22, 0xD1, 0x0D, 0x56, 0x70, 0x08, 0xA6, 0x74, 0x2A, 0xE8, 0x3A, 0x75, 0x86, 0x23, 0x3C, 0x08,
+    0xD3, 0x9C, 0x89, 0x71, 0x79, 0xE6, 0xCD, 0xA9, 0x3A, 0x7D, 0xA6, 0xD1, 0x3E, 0xA8, 0xFA, 0x1C,
+    0x97, 0x1E, 0x84, 0x69, 0x9E, 0x79, 0xF3, 0x6C, 0xD3, 0xAA, 0x50, 0x15, 0x8C, 0xCD, 0x29, 0x9F,
+    0x3E, 0xD3, 0x5C, 0x25, 0x8C, 0x0C, 0x47, 0xD2, 0x47, 0xEA, 0xC4, 0x5D, 0x7A, 0x90, 0xB1, 0x79,
+    0x3A, 0x8C, 0x4C, 0x52, 0x9F, 0x3C, 0x38, 0xCE, 0xF5, 0xBB, 0x21, 0x37, 0x36, 0x5C, 0x35, 0xA9,
+    0xBB, 0x32, 0xD2, 0xCF, 0xF8, 0x07, 0xEF, 0x1B, 0xE7, 0xE6, 0xD4, 0xBB, 0xA1, 0xCB, 0xCD, 0xA3,
+    0x3E, 0x5C, 0x1D, 0x99, 0xF4, 0x59, 0x7F, 0x65, 0x74, 0x5C, 0x3F, 0x73, 0xAD, 0x79, 0xF0, 0xBE,
+    0x2F, 0xA1, 0xE0, 0x38, 0xAA, 0xC7, 0x5C, 0xE6, 0x72, 0x9D, 0x9E, 0x72, 0xA3, 0x4C, 0xFB, 0xAF,
+    0x1C, 0xE7, 0xA1, 0x86, 0xC0, 0x21, 0xA6, 0x2A, 0xA4, 0x75, 0x6E, 0x2F, 0x50, 0x31, 0xA6, 0xC0,
+    0xD8, 0xCC, 0x69, 0x0F, 0x09, 0x99, 0xD3, 0x5E, 0xC7, 0x04, 0x63, 0xA5, 0xBA, 0xB4, 0xCE, 0xED,
+    0x98, 0x73, 0x3B, 0x2B, 0x67, 0x69, 0xD9, 0x37, 0x26, 0x77, 0xFA, 0xF5, 0x56, 0xB5, 0x74, 0x69,
+    0xAD, 0x98, 0x90, 0x5B, 0x8C, 0x63, 0x36, 0x40, 0x31, 0x3B, 0x48, 0xEB, 0x09, 0x90, 0x3F, 0xEE,
+    0x18, 0x33, 0x6F, 0xF4, 0x87, 0x8D, 0xEA, 0x29, 0x67, 0x94, 0xB5, 0xFE, 0xC8, 0x9A, 0xEF, 0xDA,
+    0x7D, 0xE8, 0x66, 0x06, 0x74, 0xAA, 0x85, 0x49, 0x84, 0x84, 0x91, 0xDB, 0x08, 0x57, 0xEA, 0x68,
+    0x55, 0x3B, 0x21, 0x77, 0xE9, 0x35, 0xA7, 0x3A, 0xEE, 0x1B, 0x1C, 0xB3, 0x52, 0x75, 0xAA, 0xCB,
+    0xEA, 0xAC, 0x2E, 0x28, 0xE8, 0xE9, 0x75, 0xA3, 0x1B, 0xE3, 0x8C, 0x9D, 0x31, 0x4D, 0x42, 0x12,
+    0x8C, 0x37, 0x6E, 0xC2, 0x98, 0x96, 0x90, 0xFA, 0xD4, 0xE7, 0x1C, 0xE5, 0x2A, 0x57, 0xF4, 0x4E,
+    0xE6, 0xFF, 0xB0, 0x72, 0x3A, 0xE4, 0x3E, 0xF7, 0x0B, 0xE6, 0xAA, 0xE3, 0x74, 0x94, 0xC7, 0x03,
+    0xE2, 0x4B, 0x69, 0x4F, 0xDC, 0xEA, 0x55, 0x5B, 0x25, 0x61, 0x9A, 0x84, 0xA9, 0x6E, 0x7A, 0xFD,
+    0x7A, 0xAB, 0x7F, 0xD8, 0xA4, 0x37, 0x5D, 0xB6, 0x24, 0x6B, 0x31, 0x1E, 0x63, 0x31, 0xEB, 0x81,
+    0xEE, 0x83, 0x39, 0x2C, 0x60, 0x6B, 0xED, 0xED, 0x67, 0x22, 0x1F, 0xC7, 0xE4, 0x28, 0xFF, 0x08,
+    0xFE, 0xDE, 0x43, 0x70, 0xF2, 0x18, 0x04, 0x43, 0xEA, 0xD3, 0x0F, 0xB6, 0x59, 0xB7, 0xF5, 0x50,
+    0xAC, 0x50, 0xB7, 0x9E, 0xF0, 0xA9, 0x23, 0x1C, 0x81, 0x87, 0x1E, 0x82, 0x63, 0xDF, 0x80, 0xFB,
+    0x40, 0x39, 0x38, 0x09, 0x19, 0xA8, 0x1A, 0x46, 0x90, 0x01, 0x0D, 0x1C, 0x83, 0xD4, 0x42, 0x03,
+    0xC7, 0xA3, 0x97, 0xBB, 0x82, 0x23, 0x97, 0xD1, 0xCF, 0xC1, 0xE5, 0x6F, 0x71, 0x4F, 0x6A, 0xB5,
+    0x3F, 0xC9, 0x39, 0x7D, 0x57, 0x09, 0x4E, 0x05, 0xF6, 0xB6, 0xC2, 0x70, 0x22, 0xBE, 0xB3, 0x57,
+    0x22, 0x09, 0x3F, 0x8A, 0x1F, 0x3F, 0x20, 0xFF, 0xFC, 0x62, 0xDC, 0x88, 0x31, 0x15, 0x90, 0x7D,
+    0xF2, 0x2F, 0x00, 0xF8, 0x5E, 0x24, 0x35, 0xBB, 0x11, 0x2F, 0xAB, 0x4C, 0xDC, 0xB5, 0x75, 0x01,
+    0xF0, 0x25, 0x18, 0x25, 0x36, 0x3A, 0x5B, 0x43, 0x03, 0x18, 0x23, 0x0E, 0x65, 0x96, 0x7D, 0x04,
+    0xD5, 0x1E, 0x83, 0x49, 0x6A, 0xB3, 0x65, 0x40, 0xC9, 0xFF, 0x89, 0x5A, 0x48, 0x47, 0x2E, 0x42,
+    0xB9, 0xA8, 0xC9, 0xA4, 0xD7, 0x7F, 0x05, 0xFC, 0xC0, 0x31, 0x1B, 0x81, 0x79, 0x9E, 0xB4, 0x09,
+    0xD0, 0x9F, 0xA0, 0x48, 0x1A, 0x52, 0x3F, 0xE5, 0xF7, 0x53, 0xCF, 0x7E, 0x3A, 0xF8, 0x12, 0x90,
+    0x58, 0xCA, 0x55, 0xB9, 0xBC, 0xF7, 0x0C, 0x90, 0xD4, 0xEB, 0xB4, 0xC3, 0x1A, 0xF4, 0xD7, 0x0D,
+    0x9E, 0x60, 0xEA, 0x07, 0xD7, 0xF0, 0xC4, 0xFA, 0x4D, 0x18, 0x3C, 0x9A, 0xCC, 0xB1, 0xA6, 0x2E,
+    0xFA, 0x50, 0x49, 0x33, 0xF8, 0x88, 0x66, 0x3D, 0xC8, 0xD5, 0xA8, 0x73, 0x56, 0x98, 0x15, 0xF9,
+    0x99, 0x01, 0x3F, 0x3F, 0x86, 0xD1, 0x1A, 0x33, 0xDF, 0x41, 0x8B, 0x6A, 0x51, 0xE2, 0x13, 0xF1,
+    0x11, 0xEC, 0x9E, 0x7A, 0x32, 0x8F, 0x71, 0x98, 0x35, 0xFA, 0xBE, 0x80, 0xF2, 0x0C, 0x65, 0xC7,
+    0xD7, 0x5E, 0x80, 0x6C, 0x85, 0x59, 0xB1, 0x7F, 0xF6, 0x0B, 0xA3, 0x04, 0x54, 0x20, 0x69, 0xD0,
+    0x8D, 0x92, 0x5A, 0xC9, 0xDE, 0x51, 0xD6, 0x00, 0xFE, 0xF5, 0xEC, 0xF7, 0x56, 0xEB, 0xD1, 0x86,
+    0xFA, 0xCF, 0xC5, 0x44, 0x9A, 0x52, 0xDA, 0x5C, 0xFA, 0x13, 0x8F, 0xF4, 0xE6, 0xE1, 0xE5, 0xBA,
+    0xFD, 0x71, 0x0A, 0x25, 0x11, 0xA5, 0x4E, 0x4F, 0x34, 0xD1, 0xF4, 0x64, 0x0D, 0xBA, 0xA5, 0x70,
+    0xE4, 0x35, 0x2B, 0x98, 0xA3, 0x5B, 0x54, 0x47, 0xEA, 0x07, 0x6B, 0x9F, 0x7A, 0xCC, 0xE0, 0x5C,
+    0xEE, 0x3E, 0xE2, 0x16, 0x9B, 0x43, 0x69, 0x59, 0x40, 0x69, 0xD9, 0x82, 0x12, 0x0E, 0xC7, 0xC4,
+    0x13, 0xC0, 0x03, 0x2B, 0x9B, 0xBD, 0x21, 0x62, 0xCB, 0xEC, 0xE2, 0x82, 0x3E, 0xC6, 0xA8, 0x2A,
+    0xE4, 0x96, 0xD4, 0xCF, 0xA0, 0x4C, 0x02, 0xAA, 0x35, 0x9E, 0xC2, 0x4D, 0x48, 0x3A, 0x5A, 0x4A,
+    0x97, 0x7A, 0x1D, 0x51, 0x97, 0x5C, 0xA5, 0x45, 0xD7, 0xDA, 0xEF, 0xEE, 0x21, 0x50, 0x8E, 0xFD,
+    0xE4, 0x9E, 0x6D, 0x16, 0xE8, 0x3E, 0x69, 0xC9, 0x6A, 0x65, 0x77, 0x66, 0xC3, 0xF8, 0x62, 0x45,
+    0xDA, 0xCC, 0x25, 0x24, 0xAD, 0xB1, 0xAB, 0xD8, 0x79, 0x58, 0x82, 0x0E, 0xC6, 0x41, 0xAF, 0x6B,
+    0x18, 0xAB, 0x30, 0x60, 0x7D, 0x4A, 0x3B, 0x81, 0xD2, 0x1A, 0xCB, 0x1C, 0xED, 0x99, 0x0C, 0xA8,
+    0xD2, 0xF3, 0xE4, 0x70, 0xFC, 0x33, 0xBC, 0x9E, 0xE6, 0x30, 0xF4, 0x94, 0x96, 0x39, 0xA6, 0x26,
+    0xF7, 0x3A, 0xA0, 0x2C, 0x87, 0xE0, 0x6B, 0x9B, 0x9B, 0x2F, 0x8A, 0xC8, 0x47, 0x1B, 0x1B, 0x4F,
+    0xBA, 0x75, 0x8F, 0x02, 0x65, 0x14, 0x24, 0x13, 0x3F, 0x19, 0xFA, 0x17, 0xD6, 0x3E, 0x4D, 0xBF,
+    0xF3, 0x09, 0xA0, 0x45, 0x5A, 0x23, 0xD2, 0x8D, 0x72, 0x69, 0xC3, 0x5C, 0x3E, 0xBE, 0x26, 0xF2,
+    0x5A, 0x2A, 0x32, 0xCD, 0x65, 0x19, 0xE6, 0xF2, 0xE9, 0x35, 0x91, 0x77, 0xE2, 0xDB, 0x3E, 0xCC,
+    0xE5, 0xBD, 0x6B, 0x22, 0x26, 0x95, 0x66, 0x74, 0xE4, 0x10, 0xE1, 0x1C, 0xFA, 0x5A, 0x8D, 0x49,
+    0x2D, 0xA3, 0x23, 0x7C, 0xC1, 0xDB, 0x83, 0x89, 0x8D, 0x25, 0x03, 0x2D, 0xD2, 0x1B, 0xB9, 0x35,
+    0x2D, 0xA4, 0x3D, 0x56, 0x4A, 0x7B, 0x6C, 0xFE, 0x39, 0xAF, 0x72, 0x78, 0xE5, 0xD2, 0x1E, 0xCB,
+    0x24, 0xC6, 0xCE, 0x4F, 0x6D, 0xBE, 0xC0, 0x5C, 0xC4, 0xFD, 0xAB, 0xB9, 0x34, 0xE7, 0x4A, 0x69,
+    0xCF, 0x95, 0xD2, 0x9D, 0x2B, 0xA5, 0xFF, 0x82, 0x57, 0x7B, 0xAE, 0x94, 0x30, 0x17, 0xF1, 0x73,
+    0xB9, 0x35, 0x64, 0x04, 0x7D, 0xDC, 0x68, 0x2D, 0xC7, 0xB5, 0x47, 0xFE, 0x6B, 0x58, 0xDC, 0xFA,
+    0x03, 0x52, 0xE9, 0x29, 0xFF, 0xFD, 0x25, 0xFD, 0xB6, 0x65, 0x72, 0x14, 0x1D, 0x46, 0xA4, 0x74,
+    0xC3, 0x7E, 0x8B, 0xD0, 0xC0, 0xD2, 0x2D, 0x77, 0xDE, 0x0D, 0x8F, 0x33, 0xBA, 0x31, 0x6E, 0x42,
+    0x97, 0x34, 0x99, 0x3B, 0xB2, 0xB7, 0xFD, 0x41, 0xDD, 0x7A, 0xC2, 0x93, 0x3A, 0x02, 0x47, 0xE0,
+    0x21, 0x1E, 0x82, 0x63, 0x44, 0x0D, 0xF9, 0xDB, 0x7A, 0xFC, 0x23, 0xF8, 0x7B, 0x3C, 0x04, 0x27,
+    0x39, 0x06, 0x01, 0x43, 0xEA, 0x49, 0x3F, 0xD8, 0x66, 0x57, 0x69, 0xEF, 0x81, 0x01, 0x5D, 0x41,
+    0xD5, 0xC7, 0x40, 0x1E, 0x87, 0x54, 0xBE, 0xF3, 0x02, 0xA9, 0x2C, 0x49, 0xFA, 0x3F, 0x40, 0xFF,
+    0xD4, 0xA2, 0x43, 0x88, 0xF5, 0xFF, 0x87, 0x32, 0x0F, 0xAA, 0xD9, 0x9B, 0x3A, 0xFE, 0x3B, 0xFC,
+    0x5C, 0xB5, 0xC9, 0xDB, 0x8D, 0x29, 0xEC, 0xD5, 0xC3, 0xBA, 0x8E, 0x5B, 0x49, 0x7B, 0x72, 0x68,
+    0x49, 0x3D, 0x27, 0x20, 0x90, 0x7A, 0xC6, 0x10, 0xC8, 0x5C, 0x74, 0xD7, 0x8D, 0x9D, 0x8D, 0x92,
+    0xDB, 0x4D, 0xC4, 0x64, 0x2E, 0x5E, 0x00, 0xEA, 0xB9, 0xAC, 0x2C, 0xC7, 0x72, 0x7B, 0x56, 0x5E,
+    0xC8, 0x9F, 0xF5, 0x1C, 0x10, 0x69, 0xBE, 0x0A, 0x3C, 0x75, 0x29, 0xB6, 0x3C, 0x15, 0x62, 0xD5,
+    0xAD, 0xB4, 0xC9, 0x1C, 0x97, 0x8F, 0xC0, 0xC9, 0x87, 0xE0, 0x2B, 0xBF, 0x0F, 0xBF, 0x83, 0x72,
+    0x90, 0x78, 0xF4, 0x23, 0xBE, 0xD1, 0x3F, 0xBA, 0xD1, 0xF0, 0xF3, 0xD7, 0x1C, 0xE5, 0x0A, 0xF2,
+    0x25, 0xA5, 0xC8, 0xEA, 0x6B, 0xAF, 0xAC, 0x5E, 0xA2, 0x5C, 0xC2, 0xED, 0x77, 0xAC, 0xFE, 0xF1,
+    0xAB, 0x75, 0xFA, 0xCC, 0xB5, 0xA0, 0x12, 0x0F, 0xC9, 0x9E, 0x06, 0xE6, 0xAC, 0x46, 0x77, 0x6B,
+    0xC4, 0xCB, 0xDD, 0x0F, 0xDD, 0xA0, 0x7A, 0xB8, 0x00, 0xEA, 0x73, 0x97, 0x66, 0x0A, 0xA5, 0x23,
+    0xAB, 0xE1, 0x34, 0xD3, 0x3C, 0xBB, 0x1E, 0x74, 0xD3, 0x8D, 0x8D, 0xCD, 0xB3, 0xEB, 0xCD, 0x55,
+    0xDA, 0xB1, 0xD1, 0x3E, 0x7D, 0xA6, 0xB9, 0x72, 0x9C, 0x91, 0x89, 0x1E, 0xD5, 0xB1, 0x8C, 0x83,
+    0x89, 0xBB, 0xB8, 0x93, 0x62, 0x49, 0x5A, 0xD6, 0x31, 0xF8, 0x80, 0x0F, 0xFE, 0xE5, 0x8F, 0x31,
+    0x90, 0xBD, 0x1A, 0x80, 0xE5, 0x05, 0x20, 0x7B, 0xDD, 0xEE, 0x54, 0x54, 0xBF, 0xE8, 0x11, 0x6D,
+    0x6D, 0x9C, 0xA2, 0x65, 0x4F, 0x46, 0x34, 0xA6, 0x2D, 0x66, 0x73, 0x20, 0x7B, 0xAF, 0x59, 0x37,
+    0x01, 0x7D, 0xF1, 0xC3, 0x32, 0x24, 0xD9, 0x63, 0xE7, 0x4F, 0xC4, 0xD1, 0xFC, 0x8A, 0x87, 0xAE,
+    0x81, 0x6A, 0x0E, 0x98, 0xB7, 0x02, 0xD0, 0x1F, 0x8E, 0xB0, 0xCE, 0xC9, 0xFC, 0xC2, 0xE1, 0xBB,
+    0x2E, 0xDC, 0x37, 0x99, 0x4F, 0xF6, 0x45, 0x3B, 0xBA, 0x6E, 0xC3, 0x39, 0xF0, 0x05, 0xE3, 0xEF,
+    0x07, 0xF5, 0x68, 0x20, 0xF9, 0xA4, 0x87, 0xD5, 0x64, 0xA7, 0x91, 0xF6, 0x17, 0x1E, 0xFB, 0xF6,
+    0xB6, 0xF2, 0xF4, 0xC3, 0x07, 0x91, 0xFB, 0xB8, 0xD9, 0x4F, 0x00, 0xE3, 0xA4, 0x31, 0x36, 0x6B,
+    0x4E, 0x24, 0x3D, 0xDB, 0x49, 0x93, 0xBB, 0xC4, 0x9D, 0xE0, 0xD2, 0xDE, 0x0B, 0x48, 0x1A, 0x78,
+    0x6A, 0x73, 0xB1, 0xB9, 0xF9, 0xBC, 0x88, 0x48, 0xBF, 0xB9, 0xB9, 0xD8, 0xDC, 0x74, 0x9F, 0xBD,
+    0x40, 0xD9, 0x13, 0x9C, 0xE6, 0x42, 0xD2, 0x14, 0x36, 0x6B, 0x4E, 0xE8, 0x8E, 0x71, 0xD2, 0xE4,
+    0x7B, 0x2F, 0x80, 0xDF, 0x03, 0x0E, 0x6D, 0xAD, 0xB6, 0xBF, 0x0A, 0x30, 0x5D, 0xAD, 0xA6, 0x43,
+    0x8C, 0xB8, 0x75, 0x18, 0xF3, 0xEA, 0x47, 0xFD, 0x71, 0xB0, 0xFD, 0xDC, 0x5C, 0xBB, 0xC8, 0x3E,
+    0xF3, 0x6A, 0xDB, 0xDF, 0x87, 0xBA, 0xD8, 0xCF, 0x1F, 0xF7, 0x96, 0x3D, 0x61, 0xD9, 0xDF, 0x20,
+    0xA4, 0xFB, 0x72, 0x7C, 0xFE, 0xBA, 0xBF, 0x28, 0xFB, 0xA2, 0x33, 0x21, 0xAD, 0xB5, 0xFF, 0x75,
+    0xAE, 0x4F, 0x1C, 0x28, 0xAB, 0x7D, 0x5A, 0x9B, 0x50, 0x74, 0x65, 0xFF, 0xEB, 0xFD, 0x22, 0x71,
+    0x59, 0x73, 0xF2, 0xD8, 0xC9, 0x63, 0x59, 0xF3, 0xEB, 0xCD, 0x02, 0x73, 0xF7, 0x37, 0xE4, 0x7C,
+    0x61, 0xCB, 0x3E, 0xBB, 0xDE, 0x04, 0x73, 0x94, 0x9F, 0xD5, 0x66, 0xA4, 0xDE, 0xF3, 0xC7, 0x47,
+    0xFA, 0x86, 0x1F, 0x8D, 0xCD, 0xC3, 0x77, 0x9A, 0xA1, 0x1E, 0x11, 0xBE, 0x4A, 0xAA, 0x7D, 0xF3,
+    0xD0, 0x57, 0x32, 0xED, 0x9B, 0x73, 0xF7, 0x41, 0x72, 0x91, 0x8A, 0xDC, 0xA7, 0x15, 0x9F, 0xBA,
+    0xD1, 0x15, 0x63, 0x92, 0x3A, 0x5C, 0x58, 0xFC, 0x99, 0x2C, 0x39, 0x8E, 0xF6, 0x9C, 0x84, 0xCD,
+    0x4B, 0xC5, 0x4A, 0x7B, 0x4E, 0x92, 0x5A, 0xA4, 0xCE, 0x16, 0x96, 0x29, 0xDA, 0x33, 0x22, 0x3B,
+    0xF5, 0x61, 0x28, 0x5A, 0x80, 0xB3, 0xAE, 0xEC, 0x8D, 0x4B, 0x6A, 0x46, 0xA4, 0xAF, 0xF8, 0xED,
+    0xB3, 0xC6, 0x85, 0x60, 0x0C, 0xE1, 0xCA, 0xD1, 0xF4, 0xA6, 0xCF, 0x1B, 0xE0, 0xE0, 0xE6, 0x9F,
+    0xC8, 0x92, 0xD4, 0x13, 0x38, 0x81, 0xF6, 0xB4, 0xE4, 0x68, 0xCF, 0x55, 0x72, 0x74, 0xCD, 0x79,
+    0x60, 0x61, 0xCB, 0x65, 0xF6, 0x74, 0x13, 0x8E, 0x66, 0xCF, 0xD4, 0x93, 0x56, 0x2F, 0xD5, 0x27,
+    0x61, 0x94, 0x7E, 0xDB, 0x8D, 0xCE, 0x67, 0xCF, 0xDE, 0x0E, 0x91, 0xF8, 0x6D, 0xCA, 0xDE, 0x3C,
+    0x53, 0x87, 0xA3, 0x47, 0xD5, 0xBB, 0xCD, 0x09, 0xF3, 0x44, 0xBD, 0x58, 0xF2, 0xDF, 0x78, 0xAE,
+    0x50, 0xE8, 0x57, 0x7C, 0x59, 0x03, 0xCA, 0x25, 0x3E, 0xF1, 0x5F, 0x7F, 0x53, 0x44, 0xFB, 0xC4,
+    0x27, 0x5E, 0xD9, 0x8D, 0x8D, 0x88, 0xE2, 0x10, 0xD9, 0xD8, 0x80, 0xC5, 0x6A, 0xB1, 0x82, 0xA4,
+    0x3E, 0xA1, 0x82, 0xE1, 0xBC, 0xAE, 0x0D, 0xE7, 0x55, 0x93, 0xD9, 0xE3, 0x9C, 0x53, 0x8D, 0xF6,
+    0x19, 0xFB, 0x80, 0xD4, 0x1A, 0x46, 0x5C, 0x49, 0xEA, 0xCC, 0x1E, 0xE7, 0xB2, 0xF6, 0x39, 0x57,
+    0xB4, 0x3F, 0xAE, 0x1A, 0xC3, 0x69, 0xBE, 0x54, 0xB8, 0xBF, 0x9E, 0xE5, 0x0F, 0xFF, 0xB8, 0x39,
+    0x32, 0x4A, 0x6E, 0xB8, 0xD1, 0x79, 0xFD, 0x6D, 0x7B, 0xEE, 0x72, 0x76, 0x90, 0x6F, 0xB0, 0xCD,
+    0xBC, 0x37, 0xA7, 0xAE, 0x35, 0xC7, 0xC7, 0xC9, 0x1B, 0xFE, 0xF8, 0x54, 0xBF, 0xE5, 0x46, 0xE7,
+    0xF5, 0xAB, 0xEE, 0xEA, 0x28, 0xD7, 0x52, 0x47, 0xDC, 0xDF, 0x83, 0x59, 0x23, 0x8F, 0xFF, 0x21,
+    0x41, 0xFB, 0xA3, 0x5C, 0xD1, 0xDE, 0x30, 0x55, 0x4D, 0x66, 0x99, 0x3B, 0x23, 0xEE, 0xAB, 0x06,
+    0x46, 0x10, 0xC8, 0x2C, 0x57, 0xC9, 0x1C, 0x57, 0x31, 0x96, 0x16, 0x23, 0x61, 0x2E, 0x8E, 0x85,
+    0x33, 0xE2, 0x0E, 0x0D, 0xD7, 0xA8, 0xB3, 0xE4, 0x0D, 0x49, 0x40, 0x7B, 0xCC, 0xC3, 0x4C, 0xCD,
+    0xCB, 0x75, 0x11, 0xE1, 0xAE, 0x89, 0xA3, 0xA7, 0xF0, 0xE9, 0x55, 0xF5, 0xA1, 0x3D, 0x19, 0x8C,
+    0xD1, 0xD7, 0x9A, 0xED, 0xC5, 0xF3, 0xD2, 0x33, 0x42, 0x7B, 0xCE, 0x93, 0x6C, 0xBA, 0xB2, 0x4F,
+    0x2D, 0x01, 0x83, 0x12, 0x77, 0x74, 0x31, 0xCC, 0x78, 0xD9, 0xE6, 0xE6, 0x95, 0x7A, 0xDE, 0x00,
+    0x3C, 0x50, 0xE7, 0xCB, 0xB4, 0x26, 0x70, 0x14, 0xFD, 0x4E, 0x53, 0x7E, 0xF7, 0x59, 0x3F, 0x9A,
+    0xEA, 0x1B, 0xEE, 0xFC, 0xC8, 0x3C, 0x32, 0x08, 0xD1, 0x81, 0xCD, 0x4B, 0xA5, 0x78, 0x8E, 0xA3,
+    0x02, 0x66, 0xB0, 0x77, 0xE3, 0x9D, 0x37, 0xA9, 0xE7, 0x38, 0xC4, 0xFB, 0xF1, 0x48, 0x1D, 0x8E,
+    0x1B, 0xED, 0x2F, 0x84, 0xB4, 0x4F, 0x7E, 0x1E, 0xCE, 0x67, 0x8F, 0xD9, 0xAB, 0x57, 0xCC, 0xA3,
+    0x1F, 0x86, 0xBC, 0x03, 0xD4, 0xF7, 0x98, 0x77, 0x46, 0x5F, 0xAF, 0x8F, 0x8F, 0x92, 0x37, 0xFC,
+    0xA8, 0x78, 0xD2, 0x4B, 0xA5, 0x1E, 0x75, 0x04, 0xC6, 0x07, 0x17, 0x2E, 0x96, 0x8B, 0x2E, 0xF2,
+    0x10, 0x5F, 0xE6, 0xEB, 0xDF, 0x29, 0xC5, 0x9D, 0xE4, 0xCB, 0x68, 0x8B, 0xE5, 0xDE, 0x8D, 0xC7,
+    0xA5, 0x89, 0x59, 0xB7, 0x77, 0x37, 0xCE, 0x40, 0x29, 0xCF, 0x4B, 0x0D, 0xDA, 0x8F, 0x92, 0xDA,
+    0x70, 0x65, 0xE7, 0xEE, 0x8E, 0x08, 0x89, 0x4F, 0xAD, 0x89, 0x11, 0xE0, 0x65, 0xCE, 0x31, 0xDA,
+    0xF3, 0x3C, 0xCF, 0x15, 0x82, 0x6A, 0xB4, 0xCF, 0xEC, 0x51, 0x0E, 0xA3, 0x5E, 0xFC, 0xC6, 0xF6,
+    0x5F, 0x1F, 0xD5, 0x6F, 0xF8, 0x63, 0xE7, 0x92, 0x1F, 0x72, 0xF2, 0x72, 0xFA, 0x1C, 0xED, 0xF8,
+    0x7F, 0x51, 0xDD, 0x37, 0xD4, 0xF7, 0x92, 0x0F, 0xAF, 0xD5, 0xE7, 0xC2, 0xB1, 0xFF, 0x79, 0xAB,
+    0x78, 0x21, 0x43, 0xD5, 0x8C, 0xFF, 0xDB, 0x64, 0x85, 0x7A, 0x91, 0xED, 0xF6, 0x88, 0xBE, 0xE1,
+    0xBE, 0x72, 0x4E, 0xFD, 0x90, 0x63, 0x97, 0xF5, 0xAB, 0xF6, 0xCA, 0xF8, 0x8F, 0x58, 0xD8, 0xC4,
+    0x3E, 0x98, 0xF8, 0xCB, 0xFC, 0xB8, 0xE6, 0x07, 0x96, 0x31, 0x4C, 0x51, 0x7F, 0x8D, 0x7E, 0x0E,
+    0xA3, 0xDD, 0x31, 0xE5, 0x93, 0xAB, 0xFA, 0x65, 0xCF, 0x49, 0x0C, 0x4F, 0x5C, 0x97, 0x1F, 0xD7,
+    0xE7, 0x9A, 0xD1, 0x78, 0xAA, 0x3B, 0x94, 0xE5, 0x24, 0xDA, 0xF2, 0x2D, 0xB2, 0xFB, 0xED, 0x87,
+    0x5B, 0xC6, 0xBE, 0xDB, 0x7C, 0xF9, 0x98, 0x7A, 0xC3, 0x1F, 0x3B, 0xA9, 0x5F, 0xB5, 0x27, 0x2F,
+    0xA7, 0xFF, 0x94, 0x6F, 0x29, 0x1B, 0x77, 0xE0, 0xB7, 0xC8, 0x94, 0x6B, 0xAE, 0xDC, 0x73, 0x5C,
+    0xBD, 0x6D, 0x4F, 0xD4, 0xFA, 0x26, 0x27, 0xCF, 0xA5, 0xA7, 0xFC, 0xE5, 0xE3, 0x07, 0x69, 0x94,
+    0x5D, 0x6F, 0xEB, 0x63, 0x46, 0x3F, 0x5D, 0x7F, 0xEB, 0x18, 0xFB, 0xEF, 0x4F, 0x2E, 0xDD, 0xF3,
+    0x83, 0xFF, 0xA7, 0x32, 0x0F, 0xB7, 0xC7, 0x8E, 0xAA, 0xE6, 0xD8, 0xB1, 0xC4, 0x8F, 0x46, 0xDA,
+    0x9F, 0x3C, 0xA9, 0xDD, 0x43, 0xE7, 0x52, 0xFB, 0xAD, 0x6F, 0x65, 0x5C, 0xBE, 0x7C, 0x90, 0x4B,
+    0xC9, 0x63, 0x17, 0xEF, 0xB9, 0xE3, 0x67, 0xE9, 0x23, 0xCD, 0x11, 0xC3, 0xE5, 0x93, 0xFA, 0x5A,
+    0x7D, 0x4F, 0x66, 0xCF, 0x8D, 0x12, 0xDF, 0x64, 0x24, 0xFF, 0xC4, 0x7D, 0xF9, 0x43, 0x3F, 0x4B,
+    0x1F, 0x69, 0xEE, 0x31, 0x9C, 0x3B, 0xA9, 0xEA, 0xC6, 0xA4, 0xEE, 0x7C, 0xF1, 0x67, 0xFE, 0xBD,
+    0x4E, 0x3B, 0x8E, 0xC0, 0x65, 0xB4, 0x87, 0xE4, 0x25, 0xF3, 0xE7, 0xC7, 0x38, 0x82, 0x71, 0xAA,
+    0x65, 0xC4, 0xE8, 0xDF, 0x5D, 0x9D, 0xD7, 0x09, 0x5F, 0x49, 0x6E, 0x3F, 0xF0, 0x1F, 0x8F, 0x70,
+    0x59, 0xFB, 0x7B, 0x78, 0x48, 0xD5, 0xE9, 0xFF, 0x96, 0xD5, 0x31, 0xA4, 0x6D, 0x28, 0xC5, 0xEB,
+    0x56, 0x91, 0xDB, 0x1D, 0x27, 0xBD, 0x60, 0xF3, 0xC5, 0x5E, 0xCB, 0xA7, 0x4D, 0xBE, 0xF1, 0xB8,
+    0xAB, 0x28, 0x75, 0xC3, 0x96, 0xB1, 0xAC, 0xB6, 0x5F, 0x42, 0xA4, 0x23, 0x7F, 0xD3, 0x32, 0x89,
+    0xE1, 0x64, 0xEA, 0x63, 0x78, 0xB9, 0x58, 0x0D, 0x80, 0x72, 0x00, 0x7D, 0xC3, 0xA3, 0x5E, 0xAF,
+    0x51, 0xAB, 0x40, 0x2A, 0x82, 0x59, 0xCD, 0xBD, 0xB9, 0x69, 0x30, 0xAF, 0x3E, 0x6A, 0xB3, 0x37,
+    0x6E, 0x78, 0xDD, 0x34, 0x4D, 0x12, 0x2E, 0x5F, 0xA1, 0x1F, 0x8D, 0x98, 0x1C, 0x39, 0x82, 0x79,
+    0xDC, 0x90, 0xBE, 0xF5, 0xAC, 0x53, 0x3F, 0xBF, 0x5E, 0x33, 0x09, 0x01, 0xD3, 0x9E, 0x23, 0xE9,
+    0x47, 0x50, 0xFE, 0x1F, 0xB1, 0xD9, 0x55, 0xDF, 0x14, 0xA7, 0x5E, 0x6F, 0x20, 0x04, 0xF8, 0xEA,
+    0x8E, 0xDB, 0xA2, 0x16, 0x1D, 0x46, 0x84, 0x79, 0xFD, 0x87, 0x2C, 0x23, 0x6C, 0x2E, 0x6D, 0x86,
+    0xBA, 0x96, 0x85, 0x82, 0x3F, 0x69, 0xCB, 0xE4, 0x9D, 0x76, 0x92, 0xAC, 0x4E, 0x4F, 0x74, 0xCB,
+    0x58, 0x37, 0x8C, 0x53, 0xCF, 0x38, 0x8B, 0x9D, 0x52, 0xA5, 0xB1, 0xE4, 0xCF, 0x83, 0x91, 0x03,
+    0x68, 0x11, 0x58, 0x0C, 0x45, 0xF7, 0x54, 0x24, 0xC2, 0xE7, 0x96, 0x1B, 0x67, 0x76, 0xFA, 0xD3,
+    0xEF, 0x42, 0xB8, 0x8F, 0x07, 0xC7, 0x23, 0x13, 0xB1, 0x5A, 0xC4, 0xDF, 0x75, 0x2A, 0xCD, 0x2B,
+    0x1F, 0x38, 0xE6, 0xD2, 0xB0, 0xFF, 0xD6, 0xE9, 0xCF, 0x3F, 0xAA, 0x66, 0xD1, 0xC2, 0x5C, 0x1A,
+    0x4C, 0x7D, 0x2C, 0x0E, 0x39, 0x59, 0x97, 0xB0, 0xA7, 0xC3, 0x95, 0xF7, 0xAF, 0x36, 0x63, 0x13,
+    0xC7, 0xDF, 0xFF, 0xE4, 0x4C, 0xBC, 0xC5, 0xBF, 0xFB, 0xC9, 0x99, 0x88, 0x32, 0xF8, 0x97, 0x1F,
+    0xBC, 0x30, 0xC4, 0xE7, 0x6E, 0x80, 0x77, 0x6D, 0x6D, 0x6C, 0xD8, 0x52, 0xA4, 0xD3, 0x32, 0x64,
+    0x28, 0xA2, 0x6B, 0x75, 0x34, 0xA6, 0x05, 0x63, 0xD2, 0x0F, 0x2E, 0x15, 0x4F, 0xDF, 0x69, 0xF8,
+    0x48, 0x3E, 0x96, 0x5E, 0x7D, 0xFA, 0x97, 0xF2, 0xC9, 0x76, 0xB2, 0x42, 0x5C, 0x19, 0x9B, 0x6A,
+    0x75, 0xA0, 0xA7, 0xD4, 0x0D, 0x1D, 0x93, 0xB4, 0xD6, 0x2D, 0xE3, 0xCC, 0xA7, 0x81, 0xA9, 0xF1,
+    0x26, 0x50, 0x19, 0x57, 0x34, 0x74, 0xC6, 0xCE, 0x6B, 0xBA, 0x9C, 0x4F, 0xBD, 0x6A, 0x8B, 0xE4,
+    0x6D, 0x9F, 0x84, 0x49, 0xFA, 0x9A, 0x4F, 0xC2, 0xD8, 0x18, 0xA7, 0x9B, 0x21, 0x79, 0x12, 0xA7,
+    0xDB, 0xEB, 0x43, 0x16, 0xD6, 0x60, 0x1A, 0xED, 0x75, 0xA7, 0x82, 0x12, 0xAE, 0xF2, 0x03, 0x3F,
+    0x66, 0x1C, 0x0C, 0x66, 0x94, 0xFA, 0x7F, 0x78, 0xF3, 0xE5, 0xDB, 0xB9, 0x88, 0x3C, 0xFD, 0xBD,
+    0xEF, 0xCD, 0xEC, 0xF8, 0xA8, 0xE1, 0xC9, 0x3F, 0x7B, 0xFB, 0x2F, 0xE6, 0x22, 0xF2, 0xC0, 0xED,
+    0xED, 0xDB, 0xF6, 0xAA, 0x19, 0x33, 0x4E, 0xDE, 0xC1, 0xB0, 0xF0, 0xA9, 0xCF, 0x9B, 0x24, 0xA4,
+    0x2D, 0x57, 0x59, 0xC6, 0x9E, 0x0F, 0x8A, 0x5B, 0x03, 0x74, 0x8A, 0xF4, 0x3F, 0xAC, 0x40, 0x05,
+    0xE3, 0xA1, 0x8A, 0x69, 0xB2, 0x31, 0x18, 0x9B, 0x9F, 0x72, 0xA9, 0x4F, 0xAF, 0xD7, 0x49, 0xD0,
+    0x1F, 0xB5, 0xF4, 0xFA, 0x8E, 0x84, 0xC9, 0x13, 0xB7, 0xA5, 0x33, 0xD2, 0x1A, 0x97, 0xCA, 0x45,
+    0x5D, 0x27, 0x61, 0xA8, 0x1B, 0x4E, 0x19, 0xC3, 0x89, 0x98, 0x9C, 0x4B, 0x3D, 0xBA, 0x4E, 0x02,
+    0xB4, 0x74, 0x50, 0x86, 0xF1, 0x50, 0xCF, 0xE6, 0x10, 0x94, 0xB7, 0x62, 0x15, 0xC3, 0x03, 0x17,
+    0xCE, 0x36, 0x40, 0x15, 0x1D, 0x3B, 0x15, 0x62, 0x8E, 0xAE, 0x78, 0x9F, 0x56, 0x05, 0xE9, 0x55,
+    0x48, 0x3E, 0x6E, 0xBF, 0x99, 0x84, 0xF4, 0xBD, 0x1A, 0xDD, 0xE4, 0x37, 0x6A, 0xB4, 0x88, 0x6E,
+    0xD0, 0xD2, 0xE9, 0x96, 0xF4, 0x2F, 0x03, 0x2B, 0x32, 0xDF, 0x52, 0x3A, 0xE3, 0x3A, 0x4C, 0x6D,
+    0x6C, 0x8F, 0x0E, 0x39, 0x15, 0x49, 0xC8, 0x99, 0xA2, 0x9B, 0x82, 0xF1, 0x37, 0xB2, 0x7A, 0xC2,
+    0x64, 0x2E, 0x7E, 0x4C, 0x59, 0xAC, 0x06, 0xF7, 0x37, 0xA9, 0x53, 0x6F, 0x6C, 0xAB, 0x83, 0xF6,
+    0x63, 0xD5, 0x27, 0x8D, 0x61, 0x41, 0xAB, 0x7D, 0xE9, 0xA7, 0x84, 0x23, 0xE1, 0x04, 0x23, 0x33,
+    0x32, 0xD6, 0xE8, 0xE7, 0x53, 0x9F, 0x5E, 0x7F, 0xE3, 0x7A, 0x73, 0xF0, 0xF6, 0xED, 0xDB, 0xB7,
+    0xB4, 0x88, 0x88, 0x3B, 0x7B, 0xE1, 0xEC, 0x05, 0x9B, 0x3D, 0x9F, 0x3E, 0x4F, 0xF2, 0xD3, 0xA7,
+    0x7F, 0xEA, 0xF8, 0xBF, 0xFC, 0xFF, 0x54, 0x73, 0x3C, 0x1C, 0x09, 0x64, 0x57, 0xD2, 0xAB, 0x24,
+    0x7D, 0xD2, 0xC3, 0x2A, 0xA6, 0x35, 0x0A, 0x87, 0xF1, 0x99, 0x07, 0x0A, 0x69, 0x38, 0x41, 0x29,
+    0x4B, 0xC6, 0x8C, 0x99, 0xDB, 0x11, 0x53, 0x8C, 0x9B, 0x72, 0x95, 0xD4, 0x57, 0xB4, 0xBF, 0x97,
+    0xFA, 0x8E, 0x76, 0x92, 0xFA, 0x56, 0x85, 0x71, 0xE6, 0x42, 0x12, 0x46, 0xE6, 0xE1, 0x90, 0x34,
+    0x53, 0xF3, 0x48, 0xA3, 0xEB, 0xAB, 0xB9, 0x6E, 0xB4, 0xEF, 0x0A, 0x5D, 0xA7, 0xBE, 0x3D, 0x91,
+    0xFA, 0xEC, 0x5A, 0x18, 0x67, 0xDE, 0x3C, 0x1D, 0x46, 0x99, 0x33, 0x8F, 0x34, 0x0F, 0x1A, 0x6B,
+    0x74, 0x4D, 0x4E, 0xAE, 0x3D, 0x13, 0x4E, 0xA4, 0x3E, 0xE9, 0x99, 0x64, 0x22, 0x81, 0xB1, 0x91,
+    0x3D, 0xAD, 0x63, 0xF9, 0x70, 0xF0, 0xC4, 0xC1, 0x97, 0x6F, 0x43, 0x29, 0x3D, 0x6C, 0x5C, 0xB0,
+    0xA0, 0x02, 0x6A, 0x3B, 0xF3, 0x94, 0x52, 0xA0, 0x6F, 0xE5, 0x1D, 0x85, 0xCB, 0x6B, 0x3A, 0x4A,
+    0x32, 0x4F, 0x1F, 0xE1, 0x9E, 0x2D, 0xC6, 0xA5, 0x35, 0xB3, 0x88, 0x6B, 0xA9, 0x30, 0x3E, 0x09,
+    0x6C, 0x93, 0xFA, 0xAC, 0xC5, 0xF8, 0x1F, 0xD4, 0x14, 0xF2, 0x3C, 0x14, 0xED, 0x74, 0x37, 0x83,
+    0xC3, 0xC6, 0xC6, 0x99, 0x08, 0x46, 0xBF, 0x7F, 0x73, 0xD3, 0xDE, 0xBD, 0x6D, 0x6B, 0x8A, 0xBF,
+    0x98, 0xC6, 0xCA, 0x4E, 0xBF, 0xA7, 0xEB, 0x75, 0xFF, 0xD6, 0x86, 0x45, 0xA4, 0xE7, 0xE0, 0x6A,
+    0xD3, 0x92, 0x0F, 0x91, 0x94, 0x16, 0xF1, 0x91, 0xDC, 0x62, 0x07, 0x9C, 0x62, 0x07, 0x1D, 0x92,
+    0x35, 0xFB, 0xA1, 0x94, 0x06, 0x16, 0xCB, 0x21, 0x7C, 0xCA, 0x63, 0x2D, 0x3B, 0x77, 0xBA, 0x51,
+    0x1D, 0xC6, 0xE6, 0x8E, 0x99, 0xEA, 0x48, 0x42, 0xEE, 0xC8, 0xAE, 0x75, 0x30, 0xC9, 0x1D, 0x7C,
+    0xD2, 0xC1, 0x59, 0xF9, 0xE0, 0x92, 0x16, 0x11, 0xBF, 0x5F, 0xE6, 0x67, 0xD0, 0x61, 0x06, 0xC6,
+    0x76, 0x30, 0x4D, 0x02, 0x49, 0xD0, 0xCD, 0x1A, 0x22, 0x91, 0x5B, 0xD5, 0xC6, 0x76, 0xE1, 0x8A,
+    0x02, 0x3A, 0x8C, 0x88, 0x68, 0x11, 0xF1, 0x1B, 0xF3, 0x8D, 0xD3, 0x3B, 0xB5, 0x64, 0xD5, 0x7E,
+    0x0B, 0xB6, 0x7A, 0x28, 0x3A, 0x30, 0x21, 0x62, 0x3C, 0x8B, 0xF6, 0x1B, 0x94, 0x7D, 0xC5, 0xD1,
+    0xB2, 0x03, 0xD3, 0xC6, 0x0F, 0xF3, 0x00, 0x65, 0x0F, 0x47, 0x4B, 0x50, 0x77, 0xB5, 0x73, 0xAF,
+    0xB3, 0x5F, 0xD1, 0x10, 0x94, 0x11, 0xF5, 0x7E, 0xDC, 0x9E, 0x8D, 0xDF, 0x25, 0x5D, 0x0C, 0x1C,
+    0xB7, 0xD8, 0x29, 0xE4, 0x47, 0x92, 0xA0, 0x8B, 0xB1, 0x53, 0x17, 0x6F, 0x4D, 0x4B, 0x1E, 0x17,
+    0x76, 0xB8, 0x87, 0x05, 0x4F, 0x59, 0xDD, 0x50, 0x26, 0x12, 0x74, 0xCD, 0x24, 0xFB, 0x0F, 0x7D,
+    0xEA, 0xA9, 0x8C, 0x9D, 0xA6, 0x5E, 0x75, 0x05, 0xD3, 0xCC, 0xA7, 0x61, 0xC2, 0xD4, 0xB8, 0xC2,
+    0x8F, 0xA9, 0xCC, 0x9F, 0x0A, 0x17, 0x92, 0x36, 0x97, 0x8E, 0xB9, 0x34, 0xC5, 0xCA, 0xB2, 0x88,
+    0x6D, 0x17, 0xDD, 0xA1, 0x3D, 0x67, 0x1F, 0x0D, 0xF4, 0x0E, 0xB1, 0xEE, 0x90, 0x73, 0xD1, 0xCD,
+    0x6E, 0xAC, 0x38, 0x84, 0xC5, 0xAB, 0x75, 0xB2, 0xA5, 0x9D, 0x42, 0xE6, 0xC2, 0x50, 0xE2, 0x0F,
+    0x47, 0x41, 0xFB, 0x16, 0x4C, 0xEA, 0x61, 0x34, 0x06, 0x7E, 0xDE, 0x80, 0xBE, 0x09, 0x64, 0xED,
+    0x1A, 0x08, 0x34, 0x85, 0x83, 0x3A, 0xC0, 0xB4, 0xAC, 0xD1, 0x3F, 0xFB, 0xD0, 0x51, 0x48, 0x8E,
+    0xFA, 0x38, 0x4C, 0x31, 0x99, 0x0D, 0xB4, 0xF7, 0xC5, 0xB6, 0x13, 0x7E, 0xE1, 0x14, 0xA1, 0x0B,
+    0x7B, 0x11, 0x29, 0x8B, 0x5B, 0x50, 0x4A, 0xC0, 0x7C, 0x67, 0x41, 0x5A, 0xA7, 0xFE, 0x1F, 0xDE,
+    0xDE, 0x5C, 0x3D, 0x2E, 0x22, 0xF5, 0x04, 0x63, 0x8D, 0x4D, 0xFD, 0xBF, 0xFC, 0xE0, 0xE5, 0x5B,
+    0xA5, 0x88, 0xD8, 0x9E, 0x9E, 0x89, 0x5A, 0x62, 0x64, 0x49, 0x2A, 0xDD, 0xAE, 0xB1, 0xFA, 0x2C,
+    0xDE, 0x84, 0x6E, 0x8F, 0x7A, 0x3E, 0x0F, 0x6A, 0xB1, 0x42, 0x89, 0xF4, 0x2C, 0xDE, 0x79, 0xC2,
+    0x17, 0xAF, 0x37, 0xA4, 0xE1, 0x08, 0xF4, 0x89, 0x27, 0x77, 0x23, 0x74, 0xD0, 0x9E, 0x09, 0xE7,
+    0x49, 0xEB, 0xCC, 0x52, 0x21, 0x62, 0xBC, 0x91, 0xD0, 0xF3, 0xC9, 0xDC, 0xF8, 0xA3, 0xBA, 0xE9,
+    0x93, 0x7A, 0x96, 0xF9, 0x51, 0xEA, 0x2F, 0x68, 0x5F, 0xE9, 0xF6, 0xBC, 0x71, 0xF9, 0x87, 0x0F,
+    0xB7, 0xCC, 0x45, 0x62, 0x2F, 0x22, 0xED, 0xDA, 0x16, 0xD9, 0x9D, 0xDE, 0x10, 0xDD, 0xAD, 0xFB,
+    0x5E, 0x4C, 0x45, 0xEC, 0x0E, 0x61, 0x3C, 0x1D, 0x1A, 0x5F, 0x54, 0x3B, 0x26, 0x11, 0x91, 0xA5,
+    0x16, 0x91, 0x78, 0x2E, 0x1C, 0x39, 0x05, 0xA9, 0xC4, 0xB4, 0xA1, 0xB4, 0x74, 0xE4, 0x36, 0x09,
+    0x18, 0xAB, 0x1B, 0x8C, 0x35, 0x1E, 0xE3, 0x72, 0x17, 0x3B, 0xC3, 0x32, 0x3F, 0xDB, 0x35, 0xB6,
+    0x67, 0x57, 0x90, 0x4B, 0x0F, 0x9F, 0xEC, 0x42, 0xD5, 0xDA, 0x61, 0x0F, 0xEA, 0x70, 0x70, 0x73,
+    0x73, 0xE1, 0x44, 0xA4, 0xDF, 0xBF, 0x21, 0x3F, 0x41, 0x2D, 0x5A, 0xEE, 0x95, 0x5B, 0x1B, 0x5A,
+    0x44, 0x42, 0xF1, 0xC1, 0xE6, 0x4B, 0x74, 0xC3, 0x95, 0x6A, 0x67, 0x49, 0x57, 0xFC, 0x0F, 0xA4,
+    0xF1, 0xCC, 0x97, 0x76, 0x6F, 0x5F, 0xA8, 0x6A, 0xE0, 0x01, 0xB9, 0x18, 0xC1, 0x37, 0xDF, 0xFD,
+    0xEF, 0x58, 0x68, 0xC7, 0x5C, 0xD5, 0x94, 0x5C, 0x26, 0xB7, 0x23, 0x8C, 0x37, 0xE8, 0x26, 0x75,
+    0xAA, 0x4D, 0x6A, 0x2A, 0x2E, 0x53, 0x32, 0xC2, 0xF8, 0x7B, 0xD0, 0x21, 0x75, 0xF4, 0x49, 0x4D,
+    0x41, 0x20, 0x6D, 0x46, 0xB0, 0xBC, 0x07, 0xF2, 0x0F, 0xFF, 0x89, 0x4D, 0x44, 0x1A, 0x1E, 0x90,
+    0xF7, 0xA3, 0x70, 0x1C, 0x65, 0x4F, 0xEA, 0x47, 0xD5, 0x19, 0x8C, 0x08, 0x64, 0xBE, 0xE0, 0xC0,
+    0xEA, 0xE5, 0xDB, 0x7F, 0x22, 0x22, 0xCB, 0x03, 0x9F, 0x3C, 0xF1, 0xA6, 0x2D, 0xA8, 0xD0, 0xC1,
+    0x78, 0x26, 0x74, 0x11, 0x88, 0x30, 0x55, 0xF1, 0x3A, 0x7A, 0xDD, 0x60, 0xDC, 0x38, 0x62, 0xD9,
+    0x72, 0xA6, 0xB1, 0x0B, 0x74, 0x42, 0xD9, 0xEB, 0x26, 0xB6, 0x26, 0xD9, 0xBB, 0xA0, 0x9A, 0xCC,
+    0xA5, 0x85, 0xF9, 0x1F, 0x4F, 0x87, 0x76, 0xE5, 0xDC, 0xAD, 0x9D, 0x94, 0x78, 0x4A, 0xC6, 0x1C,
+    0xA2, 0xAA, 0x88, 0x90, 0x8D, 0x08, 0xB4, 0x8A, 0x27, 0xC7, 0xC4, 0xF3, 0x35, 0x4A, 0xFB, 0xCD,
+    0x07, 0xEF, 0x4F, 0xEB, 0xFF, 0xEA, 0x07, 0xFF, 0xEF, 0xBB, 0xED, 0x57, 0xDA, 0xF3, 0x27, 0x67,
+    0xFA, 0xFC, 0x57, 0xEE, 0x29, 0xD9, 0xCA, 0xF4, 0xC2, 0x9A, 0x3B, 0x7F, 0x29, 0x36, 0xB9, 0x29,
+    0x4B, 0x68, 0xFE, 0xC7, 0xF3, 0xF0, 0xD0, 0x57, 0xEE, 0x19, 0x8A, 0x82, 0x64, 0x22, 0x4B, 0x23,
+    0xB2, 0xDC, 0xBF, 0x11, 0xD1, 0xD8, 0xFB, 0x37, 0x36, 0x4E, 0x97, 0x22, 0x5D, 0x29, 0xD2, 0x7E,
+    0x21, 0x5C, 0x69, 0xEF, 0x51, 0x22, 0x9F, 0xD7, 0x2A, 0x2F, 0xD2, 0xE5, 0x22, 0x0D, 0xDB, 0x3B,
+    0xC7, 0x8D, 0x94, 0x22, 0x4F, 0x8B, 0xAC, 0x60, 0x16, 0x53, 0x33, 0x73, 0xB4, 0x04, 0xCC, 0x7F,
+    0x8A, 0xE3, 0x4D, 0xE3, 0x18, 0x6B, 0xD4, 0xD4, 0x1A, 0xFD, 0x54, 0x0E, 0xE9, 0xA9, 0xDD, 0x93,
+    0x4F, 0x0E, 0x31, 0x39, 0x10, 0x28, 0xE5, 0x22, 0x8B, 0xF7, 0xC9, 0x97, 0x70, 0xA2, 0x4F, 0x3D,
+    0xB7, 0xC4, 0x29, 0x79, 0x9F, 0xA2, 0x83, 0x45, 0x60, 0xDF, 0xA9, 0xC0, 0x44, 0x37, 0xCC, 0x76,
+    0x91, 0xCE, 0x3A, 0x18, 0x97, 0xD7, 0xE6, 0x7F, 0x15, 0x9B, 0xCB, 0x92, 0x42, 0x2E, 0xEE, 0xF1,
+    0x97, 0x6A, 0x48, 0xEE, 0x78, 0x30, 0x99, 0x83, 0x73, 0x47, 0x41, 0x35, 0x57, 0x40, 0xFF, 0xF4,
+    0x27, 0x1B, 0xA7, 0x33, 0x11, 0x09, 0x07, 0x56, 0x9B, 0xAF, 0x04, 0xD5, 0x90, 0xD4, 0x99, 0x45,
+    0xDB, 0x11, 0xDC, 0xC3, 0x47, 0xEF, 0xD6, 0x0F, 0xE9, 0x9B, 0x37, 0xAF, 0xFB, 0xFC, 0xAD, 0x9F,
+    0xDE, 0x64, 0x76, 0x30, 0x0D, 0x69, 0x33, 0x40, 0x6B, 0xF4, 0xF3, 0x71, 0x31, 0x0E, 0x0D, 0x6E,
+    0x4B, 0xB9, 0xDA, 0x95, 0xA5, 0x13, 0xBB, 0x7A, 0x6F, 0xBC, 0x5B, 0x08, 0xAB, 0x76, 0x7A, 0xD6,
+    0xEF, 0x5D, 0xDA, 0x01, 0xB6, 0x52, 0x8A, 0x08, 0xA6, 0x29, 0x92, 0x56, 0x75, 0xBA, 0x31, 0xBE,
+    0x64, 0x42, 0x95, 0xD6, 0x69, 0x9D, 0xF9, 0x8A, 0x8A, 0xCA, 0x78, 0xE3, 0x8D, 0xEF, 0xE8, 0xE8,
+    0x8C, 0x85, 0xFC, 0xE1, 0x96, 0x08, 0x8D, 0xA3, 0x88, 0x67, 0x02, 0x0E, 0xBD, 0x0A, 0xA9, 0xDC,
+    0x82, 0x42, 0x04, 0x96, 0xFF, 0x5C, 0xD0, 0x0D, 0xCB, 0x68, 0xA2, 0x2A, 0xD2, 0x5A, 0x07, 0x72,
+    0x6B, 0x1C, 0x15, 0xE3, 0xD8, 0xB6, 0xB1, 0xE0, 0x95, 0x0F, 0x16, 0x21, 0x15, 0x59, 0x72, 0xFF,
+    0xEA, 0xDF, 0x0D, 0xAA, 0x39, 0x07, 0x8C, 0xAC, 0x60, 0x2E, 0xDD, 0x00, 0x85, 0x98, 0xAD, 0x75,
+    0xF9, 0x7A, 0xDF, 0x37, 0x0D, 0xA8, 0xBA, 0x01, 0xF5, 0x7A, 0x3D, 0xA0, 0x30, 0xE7, 0xD2, 0x93,
+    0xC8, 0xDB, 0x3D, 0xD9, 0x9D, 0x53, 0x8E, 0xE2, 0xB9, 0xD4, 0x52, 0x9A, 0x0C, 0x2A, 0x63, 0xA0,
+    0xBB, 0xE7, 0x1E, 0x54, 0x7B, 0xE4, 0x48, 0x1C, 0x45, 0xDF, 0xFD, 0x4F, 0x12, 0x76, 0x2C, 0x46,
+    0xB7, 0xD3, 0x92, 0x58, 0x58, 0xD8, 0xFF, 0xE4, 0xAD, 0x8D, 0x78, 0x63, 0x4A, 0x91, 0x15, 0xA8,
+    0xD7, 0x3D, 0xC9, 0x0D, 0x8F, 0xBE, 0xE1, 0x99, 0x8B, 0x63, 0x21, 0x0D, 0xCB, 0x27, 0x5A, 0x3A,
+    0xD5, 0xAB, 0x96, 0x3E, 0x09, 0x54, 0x49, 0xA0, 0xD7, 0x8D, 0x6A, 0x75, 0x9D, 0x35, 0xA9, 0x88,
+    0xCD, 0x64, 0x89, 0xF1, 0x67, 0x9D, 0x71, 0x59, 0x6D, 0xAC, 0x6E, 0x86, 0xF3, 0x14, 0x9A, 0x09,
+    0x69, 0x3D, 0xC1, 0xF8, 0x99, 0x5A, 0xD8, 0xB9, 0x2C, 0x59, 0x48, 0x4D, 0xFA, 0x18, 0x64, 0x06,
+    0xEE, 0xB9, 0x07, 0x06, 0x80, 0x0D, 0x70, 0x78, 0xD8, 0x34, 0x89, 0x78, 0x90, 0xB6, 0x10, 0xE2,
+    0xA9, 0x6E, 0x50, 0xC4, 0xE5, 0x8C, 0x9D, 0x66, 0xC3, 0x67, 0xF3, 0xCD, 0x97, 0x6F, 0x5B, 0x72,
+    0x11, 0x59, 0xC1, 0xEF, 0xFE, 0x64, 0x63, 0xEB, 0x34, 0xF1, 0x6C, 0x32, 0x98, 0xAE, 0x03, 0x8A,
+    0x31, 0x90, 0x79, 0x15, 0xE3, 0x92, 0x2C, 0x16, 0x0E, 0x27, 0x51, 0x38, 0x86, 0x61, 0x63, 0x7A,
+    0x34, 0x8F, 0xB2, 0x53, 0x41, 0x54, 0xC4, 0x30, 0x8D, 0x05, 0xC4, 0x30, 0x84, 0x27, 0x43, 0x68,
+    0x63, 0x3C, 0xC3, 0xA9, 0x26, 0x64, 0x5E, 0xB5, 0xC0, 0xB6, 0xCA, 0x3D, 0xCC, 0x83, 0xE9, 0x81,
+    0x15, 0xA5, 0x5B, 0x9F, 0x88, 0x08, 0x14, 0xFD, 0x61, 0x30, 0xF2, 0x98, 0x47, 0xB5, 0xF1, 0x30,
+    0xC0, 0x03, 0x76, 0xEF, 0xE9, 0x50, 0xF9, 0x07, 0xEA, 0x12, 0xB9, 0x84, 0x09, 0x3C, 0xF9, 0x9D,
+    0xD8, 0x86, 0x39, 0x86, 0x9C, 0xD4, 0x47, 0xEF, 0x2E, 0x82, 0x76, 0x75, 0x43, 0x0B, 0x63, 0x72,
+    0x4B, 0xEA, 0x93, 0x30, 0xB8, 0x1A, 0xC6, 0xEB, 0x06, 0xBA, 0x18, 0x1C, 0xC4, 0x93, 0x03, 0xE3,
+    0x0F, 0xFC, 0x30, 0xC3, 0x64, 0xF7, 0x88, 0x86, 0x0A, 0xA0, 0x70, 0xC0, 0x3C, 0xEC, 0xE4, 0x9A,
+    0x77, 0x89, 0x9C, 0x7E, 0x86, 0xC8, 0x9D, 0x39, 0x67, 0xE4, 0x90, 0x7F, 0x90, 0x84, 0xCF, 0x10,
+    0x39, 0xFB, 0x25, 0x44, 0xB2, 0x43, 0x64, 0xF9, 0x9B, 0x22, 0x52, 0x31, 0x48, 0xC5, 0x35, 0x1B,
+    0xC5, 0x22, 0xB7, 0x51, 0x06, 0xB6, 0x06, 0xC1, 0xB8, 0xB4, 0x96, 0x8C, 0xB5, 0x68, 0x44, 0xD9,
+    0xB8, 0x14, 0x85, 0x23, 0xF5, 0x51, 0x3A, 0x8A, 0x41, 0x3C, 0xBA, 0x28, 0x1F, 0xF1, 0xB8, 0xAF,
+    0x71, 0x84, 0x74, 0x46, 0xC2, 0x26, 0x64, 0x5E, 0x87, 0x28, 0x23, 0xC6, 0x45, 0x21, 0x19, 0x47,
+    0x29, 0x51, 0x21, 0x8A, 0x49, 0xEC, 0x9F, 0x8D, 0xCC, 0x59, 0xDD, 0x0C, 0x83, 0xD9, 0x74, 0x38,
+    0x3B, 0x2C, 0xDF, 0x91, 0x95, 0x41, 0x58, 0xD6, 0xD2, 0xB2, 0x16, 0x97, 0x41, 0x5E, 0xD6, 0x02,
+    0xB3, 0x47, 0x62, 0xF6, 0x32, 0x7A, 0xA3, 0x89, 0x8C, 0x9A, 0x81, 0xD1, 0x69, 0x64, 0x34, 0xE2,
+    0x52, 0x8B, 0xE1, 0x48, 0xDC, 0x8E, 0x71, 0x64, 0xF4, 0xE1, 0x36, 0x32, 0x9A, 0xFD, 0x36, 0x18,
+    0x9D, 0xFC, 0x36, 0x18, 0x05, 0x8C, 0x58, 0x40, 0xC4, 0x81, 0xF1, 0x85, 0x85, 0xF1, 0x50, 0x62,
+    0x6D, 0x21, 0xF3, 0xA9, 0x87, 0x09, 0x8B, 0x4D, 0x68, 0x73, 0xE9, 0x48, 0xFD, 0xEF, 0xFE, 0xC4,
+    0x52, 0x0C, 0x89, 0x9D, 0x8A, 0x78, 0xA2, 0x0F, 0xC6, 0x1A, 0x37, 0x84, 0xBB, 0xF1, 0x10, 0x85,
+    0x18, 0xE5, 0x4D, 0x28, 0x59, 0xE3, 0x51, 0x7C, 0x3C, 0x88, 0x2E, 0x62, 0x8A, 0xCB, 0x1E, 0x5D,
+    0x53, 0x06, 0x72, 0xCB, 0xBE, 0x41, 0xE2, 0xE2, 0xB9, 0x24, 0xF1, 0xB4, 0x92, 0x9E, 0x01, 0xDD,
+    0x48, 0xB2, 0xDC, 0x53, 0x1A, 0x81, 0x44, 0x1A, 0xC0, 0x48, 0x0F, 0xE4, 0x76, 0x0E, 0x4C, 0x28,
+    0x18, 0x68, 0x66, 0xCC, 0x18, 0xCE, 0xAE, 0x94, 0xBC, 0x98, 0x88, 0x18, 0xE9, 0xB3, 0xF7, 0xFF,
+    0x70, 0xFF, 0xF2, 0x4C, 0x3C, 0x31, 0x37, 0xA2, 0x4E, 0x63, 0x6B, 0x43, 0x1A, 0x8F, 0xFB, 0x5B,
+    0x45, 0x1B, 0xED, 0x75, 0x03, 0x59, 0xD0, 0x35, 0xA8, 0x36, 0x6A, 0xB7, 0xA8, 0xA0, 0x32, 0xCF,
+    0x45, 0x1D, 0x32, 0x8F, 0x48, 0x93, 0x8A, 0x9D, 0x8B, 0x4D, 0xC4, 0x2A, 0xBB, 0x83, 0x31, 0x8F,
+    0xC8, 0x8C, 0x58, 0x2E, 0x8F, 0x7F, 0x62, 0x9F, 0xAB, 0x89, 0x7F, 0x44, 0x6A, 0xC0, 0xFC, 0xA7,
+    0xB3, 0x35, 0xD0, 0x62, 0xE2, 0xE9, 0xB5, 0xA6, 0x06, 0xF9, 0xD7, 0x4D, 0x51, 0x63, 0x44, 0xFC,
+    0xBC, 0x46, 0x44, 0x12, 0xA9, 0x8D, 0x48, 0x6B, 0xA4, 0x16, 0x11, 0xBB, 0x90, 0xB7, 0x44, 0xDA,
+    0x4C, 0xE4, 0xDB, 0xF1, 0x68, 0xE5, 0x54, 0x56, 0xA9, 0x88, 0x4B, 0xA5, 0x2B, 0xA4, 0x23, 0x15,
+    0x11, 0x71, 0xA4, 0x22, 0xD2, 0x41, 0xBA, 0x4C, 0xC5, 0x41, 0x1A, 0x4C, 0x37, 0x14, 0x7B, 0x81,
+    0xF4, 0xAD, 0x0E, 0x58, 0x9F, 0x80, 0x91, 0xC6, 0xFD, 0x9B, 0xBA, 0x9D, 0xC2, 0xD1, 0xFF, 0x07,
 };
 
 static const EpdGlyph notosans_14_italicGlyphs[] = {
@@ -2052,7 +2069,7 @@ static const EpdGlyph notosans_14_italicGlyphs[] = {
     { 3, 31, 16, 7, 23, 24, 6941 }, // |
     { 13, 26, 10, -2, 21, 85, 6965 }, // }
     { 14, 5, 17, 2, 13, 18, 7050 }, // ~
-    { 0, 0, 8, 0, 0, 0, 0 }, //  
+    { 0, 0, 8, 0, 0, 0, 7068 }, //  
     { 9, 22, 8, -1, 16, 50, 0 }, // ¡
     { 13, 23, 16, 3, 22, 75, 50 }, // ¢
     { 18, 22, 16, -1, 22, 99, 125 }, // £
@@ -2063,774 +2080,781 @@ static const EpdGlyph notosans_14_italicGlyphs[] = {
     { 9, 4, 16, 6, 22, 9, 471 }, // ¨
     { 22, 23, 24, 1, 22, 127, 480 }, // ©
     { 10, 11, 10, 2, 22, 28, 607 }, // ª
-    { 13, 13, 14, 1, 14, 43, 635 }, // «
-    { 14, 9, 17, 2, 12, 32, 678 }, // ¬
-    { 9, 3, 9, 0, 9, 7, 710 }, // ­
-    { 22, 23, 24, 1, 22, 127, 717 }, // ®
-    { 13, 3, 11, 2, 25, 10, 844 }, // ¯
-    { 10, 10, 12, 1, 22, 25, 854 }, // °
-    { 14, 18, 17, 2, 18, 63, 879 }, // ±
-    { 10, 13, 10, 2, 25, 33, 942 }, // ²
-    { 10, 14, 10, 2, 25, 35, 975 }, // ³
-    { 7, 6, 8, 3, 23, 11, 1010 }, // ´
-    { 18, 23, 17, -1, 16, 104, 1021 }, // µ
-    { 16, 27, 19, 2, 23, 108, 1125 }, // ¶
-    { 5, 5, 7, 2, 13, 7, 1233 }, // ·
-    { 7, 7, 6, -3, 0, 13, 1240 }, // ¸
-    { 7, 13, 10, 4, 25, 23, 1253 }, // ¹
-    { 9, 11, 10, 2, 22, 25, 1276 }, // º
-    { 13, 13, 14, 0, 14, 43, 1301 }, // »
-    { 19, 21, 21, 2, 21, 100, 1344 }, // ¼
-    { 21, 21, 23, 2, 21, 111, 1444 }, // ½
-    { 22, 21, 23, 1, 21, 116, 1555 }, // ¾
-    { 12, 22, 13, -1, 16, 66, 1671 }, // ¿
-    { 17, 28, 16, -2, 28, 119, 1737 }, // À
-    { 19, 28, 16, -2, 28, 133, 1856 }, // Á
-    { 18, 28, 16, -2, 28, 126, 1989 }, // Â
-    { 20, 27, 16, -2, 27, 135, 2115 }, // Ã
-    { 18, 27, 16, -2, 27, 122, 2250 }, // Ä
-    { 17, 29, 16, -2, 29, 124, 2372 }, // Å
-    { 28, 21, 24, -2, 21, 147, 2496 }, // Æ
-    { 17, 29, 17, 2, 22, 124, 2643 }, // Ç
-    { 16, 28, 15, 1, 28, 112, 2767 }, // È
-    { 16, 28, 15, 1, 28, 112, 2879 }, // É
-    { 16, 28, 15, 1, 28, 112, 2991 }, // Ê
-    { 16, 27, 15, 1, 27, 108, 3103 }, // Ë
-    { 13, 28, 9, -1, 28, 91, 3211 }, // Ì
-    { 14, 28, 9, -1, 28, 98, 3302 }, // Í
-    { 14, 28, 9, -1, 28, 98, 3400 }, // Î
-    { 14, 27, 9, -1, 27, 95, 3498 }, // Ï
-    { 19, 21, 19, 0, 21, 100, 3593 }, // Ð
-    { 20, 27, 21, 1, 27, 135, 3693 }, // Ñ
-    { 19, 29, 21, 2, 28, 138, 3828 }, // Ò
-    { 19, 29, 21, 2, 28, 138, 3966 }, // Ó
-    { 19, 29, 21, 2, 28, 138, 4104 }, // Ô
-    { 19, 28, 21, 2, 27, 133, 4242 }, // Õ
-    { 19, 28, 21, 2, 27, 133, 4375 }, // Ö
-    { 14, 14, 17, 2, 17, 49, 4508 }, // ×
-    { 20, 24, 21, 1, 22, 120, 4557 }, // Ø
-    { 19, 29, 20, 2, 28, 138, 4677 }, // Ù
-    { 19, 29, 20, 2, 28, 138, 4815 }, // Ú
-    { 19, 29, 20, 2, 28, 138, 4953 }, // Û
-    { 19, 28, 20, 2, 27, 133, 5091 }, // Ü
-    { 16, 28, 15, 2, 28, 112, 5224 }, // Ý
-    { 15, 21, 17, 1, 21, 79, 5336 }, // Þ
-    { 21, 30, 17, -4, 23, 158, 5415 }, // ß
-    { 16, 24, 17, 1, 23, 96, 5573 }, // à
-    { 16, 24, 17, 1, 23, 96, 5669 }, // á
-    { 16, 24, 17, 1, 23, 96, 5765 }, // â
-    { 16, 23, 17, 1, 22, 92, 5861 }, // ã
-    { 16, 23, 17, 1, 22, 92, 5953 }, // ä
-    { 16, 25, 17, 1, 24, 100, 6045 }, // å
-    { 23, 17, 24, 1, 16, 98, 6145 }, // æ
-    { 13, 23, 13, 1, 16, 75, 6243 }, // ç
-    { 13, 24, 15, 1, 23, 78, 6318 }, // è
-    { 14, 24, 15, 1, 23, 84, 6396 }, // é
-    { 13, 24, 15, 1, 23, 78, 6480 }, // ê
-    { 13, 23, 15, 1, 22, 75, 6558 }, // ë
-    { 8, 23, 8, 0, 23, 46, 6633 }, // ì
-    { 11, 23, 8, 0, 23, 64, 6679 }, // í
-    { 11, 23, 8, 0, 23, 64, 6743 }, // î
-    { 11, 22, 8, 0, 22, 61, 6807 }, // ï
-    { 16, 24, 17, 1, 23, 96, 6868 }, // ð
-    { 17, 22, 17, 0, 22, 94, 6964 }, // ñ
-    { 15, 24, 16, 1, 23, 90, 7058 }, // ò
-    { 15, 24, 16, 1, 23, 90, 7148 }, // ó
-    { 15, 24, 16, 1, 23, 90, 7238 }, // ô
-    { 15, 23, 16, 1, 22, 87, 7328 }, // õ
-    { 15, 23, 16, 1, 22, 87, 7415 }, // ö
-    { 14, 14, 17, 2, 17, 49, 7502 }, // ÷
-    { 16, 19, 16, 0, 17, 76, 7551 }, // ø
-    { 16, 24, 17, 1, 23, 96, 7627 }, // ù
-    { 16, 24, 17, 1, 23, 96, 7723 }, // ú
-    { 16, 24, 17, 1, 23, 96, 7819 }, // û
-    { 16, 23, 17, 1, 22, 92, 7915 }, // ü
-    { 19, 30, 14, -3, 23, 143, 8007 }, // ý
-    { 17, 30, 17, -1, 23, 128, 8150 }, // þ
-    { 19, 29, 14, -3, 22, 138, 8278 }, // ÿ
-    { 18, 25, 16, -2, 25, 113, 0 }, // Ā
-    { 16, 21, 17, 1, 20, 84, 113 }, // ā
-    { 19, 27, 16, -2, 27, 129, 197 }, // Ă
-    { 16, 23, 17, 1, 22, 92, 326 }, // ă
-    { 17, 28, 16, -2, 21, 119, 418 }, // Ą
-    { 16, 23, 17, 1, 16, 92, 537 }, // ą
-    { 17, 29, 17, 2, 28, 124, 629 }, // Ć
-    { 14, 24, 13, 1, 23, 84, 753 }, // ć
-    { 17, 29, 17, 2, 28, 124, 837 }, // Ĉ
-    { 13, 24, 13, 1, 23, 78, 961 }, // ĉ
-    { 17, 28, 17, 2, 27, 119, 1039 }, // Ċ
-    { 13, 23, 13, 1, 22, 75, 1158 }, // ċ
-    { 17, 29, 17, 2, 28, 124, 1233 }, // Č
-    { 14, 24, 13, 1, 23, 84, 1357 }, // č
-    { 18, 28, 19, 1, 28, 126, 1441 }, // Ď
-    { 22, 24, 18, 1, 23, 132, 1567 }, // ď
-    { 19, 21, 19, 0, 21, 100, 1699 }, // Đ
-    { 18, 24, 17, 1, 23, 108, 1799 }, // đ
-    { 16, 25, 15, 1, 25, 100, 1907 }, // Ē
-    { 13, 21, 15, 1, 20, 69, 2007 }, // ē
-    { 16, 27, 15, 1, 27, 108, 2076 }, // Ĕ
-    { 14, 23, 15, 1, 22, 81, 2184 }, // ĕ
-    { 16, 27, 15, 1, 27, 108, 2265 }, // Ė
-    { 13, 23, 15, 1, 22, 75, 2373 }, // ė
-    { 16, 28, 15, 1, 21, 112, 2448 }, // Ę
-    { 13, 23, 15, 1, 16, 75, 2560 }, // ę
-    { 16, 28, 15, 1, 28, 112, 2635 }, // Ě
-    { 14, 24, 15, 1, 23, 84, 2747 }, // ě
-    { 18, 29, 20, 2, 28, 131, 2831 }, // Ĝ
-    { 17, 30, 17, 0, 23, 128, 2962 }, // ĝ
-    { 18, 28, 20, 2, 27, 126, 3090 }, // Ğ
-    { 17, 29, 17, 0, 22, 124, 3216 }, // ğ
-    { 18, 28, 20, 2, 27, 126, 3340 }, // Ġ
-    { 17, 29, 17, 0, 22, 124, 3466 }, // ġ
-    { 18, 29, 20, 2, 22, 131, 3590 }, // Ģ
-    { 17, 30, 17, 0, 23, 128, 3721 }, // ģ
-    { 19, 28, 20, 1, 28, 133, 3849 }, // Ĥ
-    { 16, 30, 17, 0, 30, 120, 3982 }, // ĥ
-    { 21, 21, 20, 1, 21, 111, 4102 }, // Ħ
-    { 16, 23, 17, 0, 23, 92, 4213 }, // ħ
-    { 15, 27, 9, -1, 27, 102, 4305 }, // Ĩ
-    { 12, 22, 8, 0, 22, 66, 4407 }, // ĩ
-    { 14, 25, 9, -1, 25, 88, 4473 }, // Ī
-    { 11, 20, 8, 0, 20, 55, 4561 }, // ī
-    { 14, 27, 9, -1, 27, 95, 4616 }, // Ĭ
-    { 11, 22, 8, 0, 22, 61, 4711 }, // ĭ
-    { 13, 28, 9, -1, 21, 91, 4772 }, // Į
-    { 9, 29, 8, -1, 22, 66, 4863 }, // į
-    { 13, 27, 9, -1, 27, 88, 4929 }, // İ
-    { 7, 16, 8, 0, 16, 28, 5017 }, // ı
-    { 19, 27, 17, -1, 21, 129, 5045 }, // Ĳ
-    { 16, 29, 15, 0, 22, 116, 5174 }, // ĳ
-    { 17, 34, 8, -5, 28, 145, 5290 }, // Ĵ
-    { 15, 30, 8, -4, 23, 113, 5435 }, // ĵ
-    { 18, 28, 16, 1, 21, 126, 5548 }, // Ķ
-    { 16, 30, 14, 0, 23, 120, 5674 }, // ķ
-    { 16, 16, 14, 0, 16, 64, 5794 }, // ĸ
-    { 12, 28, 14, 1, 28, 84, 5858 }, // Ĺ
-    { 12, 30, 8, 0, 30, 90, 5942 }, // ĺ
-    { 12, 28, 14, 1, 21, 84, 6032 }, // Ļ
-    { 11, 30, 8, -2, 23, 83, 6116 }, // ļ
-    { 15, 21, 14, 1, 21, 79, 6199 }, // Ľ
-    { 13, 23, 8, 0, 23, 75, 6278 }, // ľ
-    { 12, 21, 14, 1, 21, 63, 6353 }, // Ŀ
-    { 11, 23, 9, 0, 23, 64, 6416 }, // ŀ
-    { 13, 21, 14, 0, 21, 69, 6480 }, // Ł
-    { 9, 23, 8, 0, 23, 52, 6549 }, // ł
-    { 20, 28, 21, 1, 28, 140, 6601 }, // Ń
-    { 16, 23, 17, 0, 23, 92, 6741 }, // ń
-    { 20, 28, 21, 1, 21, 140, 6833 }, // Ņ
-    { 16, 24, 17, 0, 17, 96, 6973 }, // ņ
-    { 20, 28, 21, 1, 28, 140, 7069 }, // Ň
-    { 16, 23, 17, 0, 23, 92, 7209 }, // ň
-    { 17, 21, 19, 1, 21, 90, 7301 }, // ŉ
-    { 20, 27, 21, 1, 21, 135, 7391 }, // Ŋ
-    { 16, 23, 17, 0, 16, 92, 7526 }, // ŋ
-    { 19, 26, 21, 2, 25, 124, 7618 }, // Ō
-    { 15, 21, 16, 1, 20, 79, 7742 }, // ō
-    { 19, 28, 21, 2, 27, 133, 7821 }, // Ŏ
-    { 15, 23, 16, 1, 22, 87, 7954 }, // ŏ
-    { 20, 29, 21, 2, 28, 145, 8041 }, // Ő
-    { 17, 24, 16, 1, 23, 102, 8186 }, // ő
-    { 25, 23, 25, 2, 22, 144, 8288 }, // Œ
-    { 24, 17, 25, 1, 16, 102, 8432 }, // œ
-    { 16, 28, 17, 1, 28, 112, 8534 }, // Ŕ
-    { 14, 23, 12, 0, 23, 81, 8646 }, // ŕ
-    { 16, 28, 17, 1, 21, 112, 8727 }, // Ŗ
-    { 14, 23, 12, -1, 16, 81, 8839 }, // ŗ
-    { 16, 28, 17, 1, 28, 112, 8920 }, // Ř
-    { 15, 23, 12, 0, 23, 87, 9032 }, // ř
-    { 16, 29, 15, 0, 28, 116, 9119 }, // Ś
-    { 13, 24, 13, 0, 23, 78, 9235 }, // ś
-    { 16, 29, 15, 0, 28, 116, 9313 }, // Ŝ
-    { 13, 24, 13, 0, 23, 78, 9429 }, // ŝ
-    { 16, 29, 15, 0, 22, 116, 9507 }, // Ş
-    { 13, 23, 13, 0, 16, 75, 9623 }, // ş
-    { 16, 29, 15, 0, 28, 116, 9698 }, // Š
-    { 14, 24, 13, 0, 23, 84, 9814 }, // š
-    { 16, 28, 15, 2, 21, 112, 9898 }, // Ţ
-    { 11, 27, 10, 0, 20, 75, 10010 }, // ţ
-    { 16, 28, 15, 2, 28, 112, 10085 }, // Ť
-    { 12, 24, 10, 1, 23, 72, 10197 }, // ť
-    { 16, 21, 15, 2, 21, 84, 10269 }, // Ŧ
-    { 11, 21, 10, 0, 20, 58, 10353 }, // ŧ
-    { 19, 28, 20, 2, 27, 133, 10411 }, // Ũ
-    { 16, 23, 17, 1, 22, 92, 10544 }, // ũ
-    { 19, 26, 20, 2, 25, 124, 10636 }, // Ū
-    { 16, 21, 17, 1, 20, 84, 10760 }, // ū
-    { 19, 28, 20, 2, 27, 133, 10844 }, // Ŭ
-    { 16, 23, 17, 1, 22, 92, 10977 }, // ŭ
-    { 19, 30, 20, 2, 29, 143, 11069 }, // Ů
-    { 16, 25, 17, 1, 24, 100, 11212 }, // ů
-    { 19, 29, 20, 2, 28, 138, 11312 }, // Ű
-    { 17, 24, 17, 1, 23, 102, 11450 }, // ű
-    { 19, 28, 20, 2, 21, 133, 11552 }, // Ų
-    { 16, 23, 17, 1, 16, 92, 11685 }, // ų
-    { 25, 28, 25, 3, 28, 175, 11777 }, // Ŵ
-    { 22, 23, 21, 1, 23, 127, 11952 }, // ŵ
-    { 16, 28, 15, 2, 28, 112, 12079 }, // Ŷ
-    { 19, 30, 14, -3, 23, 143, 12191 }, // ŷ
-    { 16, 27, 15, 2, 27, 108, 12334 }, // Ÿ
-    { 18, 28, 15, -1, 28, 126, 12442 }, // Ź
-    { 15, 23, 13, -1, 23, 87, 12568 }, // ź
-    { 18, 27, 15, -1, 27, 122, 12655 }, // Ż
-    { 14, 22, 13, -1, 22, 77, 12777 }, // ż
-    { 18, 28, 15, -1, 28, 126, 12854 }, // Ž
-    { 15, 23, 13, -1, 23, 87, 12980 }, // ž
-    { 17, 30, 8, -4, 23, 128, 13067 }, // ſ
-    { 6, 6, 0, -12, 23, 9, 0 }, // ̀
-    { 7, 6, 0, -7, 23, 11, 9 }, // ́
-    { 10, 6, 0, -3, 23, 15, 20 }, // ̂
-    { 12, 5, 0, -13, 22, 15, 35 }, // ̃
-    { 9, 3, 0, -2, 20, 7, 50 }, // ̄
-    { 13, 3, 0, -3, 25, 10, 57 }, // ̅
-    { 9, 5, 0, -2, 22, 12, 67 }, // ̆
-    { 4, 4, 0, 1, 22, 4, 79 }, // ̇
-    { 9, 4, 0, -2, 22, 9, 83 }, // ̈
-    { 6, 7, 0, -9, 24, 11, 92 }, // ̉
-    { 7, 7, 0, -1, 24, 13, 103 }, // ̊
-    { 12, 6, 0, -2, 23, 18, 116 }, // ̋
-    { 10, 6, 0, -2, 23, 15, 134 }, // ̌
-    { 5, 9, 0, 0, 23, 12, 149 }, // ̍
-    { 9, 6, 0, -2, 23, 14, 161 }, // ̎
-    { 11, 6, 0, -15, 23, 17, 175 }, // ̏
-    { 10, 8, 0, -2, 25, 20, 192 }, // ̐
-    { 9, 5, 0, -2, 22, 12, 212 }, // ̑
-    { 6, 8, 0, -1, 21, 12, 224 }, // ̒
-    { 6, 8, 0, -1, 21, 12, 236 }, // ̓
-    { 4, 8, 0, 0, 21, 8, 248 }, // ̔
-    { 6, 8, 0, -1, 21, 12, 256 }, // ̕
-    { 6, 6, 0, -6, -1, 9, 268 }, // ̖
-    { 7, 6, 0, -5, -1, 11, 277 }, // ̗
-    { 6, 7, 0, -5, 0, 11, 288 }, // ̘
-    { 7, 7, 0, -6, 0, 13, 299 }, // ̙
-    { 10, 9, 10, 2, 23, 23, 312 }, // ̚
-    { 8, 7, 0, -2, 23, 14, 335 }, // ̛
-    { 5, 7, 0, -2, 0, 9, 349 }, // ̜
-    { 7, 6, 0, -6, -1, 11, 358 }, // ̝
-    { 8, 6, 0, -6, -1, 12, 369 }, // ̞
-    { 7, 7, 0, -6, 0, 13, 381 }, // ̟
-    { 7, 3, 0, -6, -3, 6, 394 }, // ̠
-    { 7, 9, 0, -6, 2, 16, 400 }, // ̡
-    { 6, 9, 0, -3, 2, 14, 416 }, // ̢
-    { 4, 5, 0, -13, -1, 5, 430 }, // ̣
-    { 9, 4, 0, -7, -2, 9, 435 }, // ̤
-    { 7, 7, 0, -6, 0, 13, 444 }, // ̥
-    { 5, 6, 0, 2, -1, 8, 457 }, // ̦
-    { 6, 7, 0, -5, 0, 11, 465 }, // ̧
-    { 6, 7, 0, -5, 0, 11, 476 }, // ̨
-    { 5, 9, 0, -5, 0, 12, 487 }, // ̩
-    { 12, 6, 0, -8, -1, 18, 499 }, // ̪
-    { 12, 5, 0, -8, -1, 15, 517 }, // ̫
-    { 10, 6, 0, -7, 0, 15, 532 }, // ̬
-    { 10, 6, 0, -7, -1, 15, 547 }, // ̭
-    { 9, 5, 0, -6, -1, 12, 562 }, // ̮
-    { 9, 5, 0, -7, -1, 12, 574 }, // ̯
-    { 11, 5, 0, -8, -1, 14, 586 }, // ̰
-    { 9, 3, 0, -7, -2, 7, 600 }, // ̱
-    { 13, 3, 0, -9, -2, 10, 607 }, // ̲
-    { 14, 7, 0, -9, 0, 25, 617 }, // ̳
-    { 12, 5, 0, -6, 10, 15, 642 }, // ̴
-    { 12, 3, 0, -6, 10, 9, 657 }, // ̵
-    { 20, 3, 0, -10, 10, 15, 666 }, // ̶
-    { 10, 7, 0, -5, 12, 18, 681 }, // ̷
-    { 16, 25, 0, -8, 23, 100, 699 }, // ̸
-    { 5, 8, 0, -2, 1, 10, 799 }, // ̹
-    { 12, 6, 0, -8, -1, 18, 809 }, // ̺
-    { 12, 7, 0, -8, 0, 21, 827 }, // ̻
-    { 12, 5, 0, -8, -1, 15, 848 }, // ̼
-    { 8, 7, 0, -1, 23, 14, 863 }, // ̽
-    { 7, 10, 0, -1, 26, 18, 877 }, // ̾
-    { 14, 7, 0, -3, 29, 25, 895 }, // ̿
-    { 6, 6, 0, -2, 23, 9, 920 }, // ̀
-    { 7, 6, 0, 1, 23, 11, 929 }, // ́
-    { 12, 5, 0, 4, 22, 15, 940 }, // ͂
-    { 6, 6, 0, 0, 23, 9, 955 }, // ̓
-    { 11, 6, 0, -3, 23, 17, 964 }, // ̈́
-    { 5, 5, 0, -4, -2, 7, 981 }, // ͅ
-    { 14, 6, 0, -4, 23, 21, 988 }, // ͆
-    { 14, 7, 0, -9, 0, 25, 1009 }, // ͇
-    { 9, 6, 0, -7, 0, 14, 1034 }, // ͈
-    { 7, 6, 0, -5, -1, 11, 1048 }, // ͉
-    { 11, 7, 0, -3, 23, 20, 1059 }, // ͊
-    { 12, 11, 0, -3, 27, 33, 1079 }, // ͋
-    { 12, 8, 0, -3, 25, 24, 1112 }, // ͌
-    { 11, 6, 0, -8, -1, 17, 1136 }, // ͍
-    { 6, 7, 0, -5, 0, 11, 1153 }, // ͎
-    { 22, 21, 0, -11, 21, 116, 1164 }, // ͏
-    { 5, 7, 0, 0, 24, 9, 1280 }, // ͐
-    { 5, 7, 0, 3, 24, 9, 1289 }, // ͑
-    { 9, 8, 0, -2, 25, 18, 1298 }, // ͒
-    { 7, 7, 0, -5, 0, 13, 1316 }, // ͓
-    { 6, 6, 0, -5, -1, 9, 1329 }, // ͔
-    { 6, 6, 0, -4, -1, 9, 1338 }, // ͕
-    { 12, 6, 0, -7, -1, 18, 1347 }, // ͖
-    { 4, 8, 0, 3, 25, 8, 1365 }, // ͗
-    { 4, 4, 0, 1, 22, 4, 1373 }, // ͘
-    { 7, 6, 0, -6, -1, 11, 1377 }, // ͙
-    { 12, 7, 0, -8, 0, 21, 1388 }, // ͚
-    { 6, 6, 0, 0, 23, 9, 1409 }, // ͛
-    { 22, 6, 0, -13, -1, 33, 1418 }, // ͜
-    { 21, 6, 0, -8, 23, 32, 1451 }, // ͝
-    { 15, 3, 0, -5, 20, 12, 1483 }, // ͞
-    { 16, 3, 0, -10, -2, 12, 1495 }, // ͟
-    { 22, 5, 0, -8, 22, 28, 1507 }, // ͠
-    { 21, 6, 0, -8, 25, 32, 1535 }, // ͡
-    { 22, 6, 0, -14, -1, 33, 1567 }, // ͢
-    { 8, 8, 0, -1, 25, 16, 1600 }, // ͣ
-    { 6, 8, 0, 0, 25, 12, 1616 }, // ͤ
-    { 4, 9, 0, 1, 27, 9, 1628 }, // ͥ
-    { 7, 7, 0, -1, 25, 13, 1637 }, // ͦ
-    { 8, 8, 0, -1, 25, 16, 1650 }, // ͧ
-    { 6, 8, 0, 0, 25, 12, 1666 }, // ͨ
-    { 8, 10, 0, -1, 27, 20, 1678 }, // ͩ
-    { 7, 9, 0, -1, 27, 16, 1698 }, // ͪ
-    { 11, 7, 0, -3, 25, 20, 1714 }, // ͫ
-    { 6, 7, 0, 0, 25, 11, 1734 }, // ͬ
-    { 5, 9, 0, 1, 26, 12, 1745 }, // ͭ
-    { 7, 7, 0, 0, 25, 13, 1757 }, // ͮ
-    { 8, 7, 0, -1, 25, 14, 1770 }, // ͯ
-    { 16, 28, 15, 0, 28, 112, 0 }, // Ѐ
-    { 16, 27, 15, 0, 27, 108, 112 }, // Ё
-    { 16, 22, 19, 2, 21, 88, 220 }, // Ђ
-    { 16, 28, 14, 0, 28, 112, 308 }, // Ѓ
-    { 18, 23, 17, 1, 22, 104, 420 }, // Є
-    { 16, 23, 15, 0, 22, 92, 524 }, // Ѕ
-    { 9, 21, 8, 0, 21, 48, 616 }, // І
-    { 11, 27, 8, 0, 27, 75, 664 }, // Ї
-    { 14, 27, 8, -5, 21, 95, 739 }, // Ј
-    { 28, 22, 27, -2, 21, 154, 834 }, // Љ
-    { 26, 21, 27, 0, 21, 137, 988 }, // Њ
-    { 17, 21, 20, 2, 21, 90, 1125 }, // Ћ
-    { 19, 28, 16, 0, 28, 133, 1215 }, // Ќ
-    { 21, 28, 20, 0, 28, 147, 1348 }, // Ѝ
-    { 19, 28, 16, 0, 27, 133, 1495 }, // Ў
-    { 20, 26, 19, 0, 21, 130, 1628 }, // Џ
-    { 17, 21, 17, -2, 21, 90, 1758 }, // А
-    { 17, 21, 16, 0, 21, 90, 1848 }, // Б
-    { 17, 21, 17, 0, 21, 90, 1938 }, // В
-    { 16, 21, 14, 0, 21, 84, 2028 }, // Г
-    { 23, 26, 20, -3, 21, 150, 2112 }, // Д
-    { 16, 21, 15, 0, 21, 84, 2262 }, // Е
-    { 28, 21, 23, -2, 21, 147, 2346 }, // Ж
-    { 16, 23, 15, -1, 22, 92, 2493 }, // З
-    { 21, 21, 20, 0, 21, 111, 2585 }, // И
-    { 21, 27, 20, 0, 27, 142, 2696 }, // Й
-    { 19, 21, 16, 0, 21, 100, 2838 }, // К
-    { 22, 22, 20, -2, 21, 121, 2938 }, // Л
-    { 25, 21, 24, 0, 21, 132, 3059 }, // М
-    { 20, 21, 20, 0, 21, 105, 3191 }, // Н
-    { 19, 23, 20, 1, 22, 110, 3296 }, // О
-    { 20, 21, 19, 0, 21, 105, 3406 }, // П
-    { 17, 21, 16, 0, 21, 90, 3511 }, // Р
-    { 18, 23, 17, 1, 22, 104, 3601 }, // С
-    { 16, 21, 15, 2, 21, 84, 3705 }, // Т
-    { 19, 22, 16, 0, 21, 105, 3789 }, // У
-    { 22, 23, 23, 1, 22, 127, 3894 }, // Ф
-    { 20, 21, 16, -2, 21, 105, 4021 }, // Х
-    { 20, 26, 20, 0, 21, 130, 4126 }, // Ц
-    { 17, 21, 18, 2, 21, 90, 4256 }, // Ч
-    { 28, 21, 28, 0, 21, 147, 4346 }, // Ш
-    { 28, 26, 28, 0, 21, 182, 4493 }, // Щ
-    { 16, 21, 19, 2, 21, 84, 4675 }, // Ъ
-    { 24, 21, 23, 0, 21, 126, 4759 }, // Ы
-    { 15, 21, 16, 0, 21, 79, 4885 }, // Ь
-    { 17, 23, 17, 0, 22, 98, 4964 }, // Э
-    { 27, 23, 27, 0, 22, 156, 5062 }, // Ю
-    { 19, 21, 17, -2, 21, 100, 5218 }, // Я
-    { 15, 17, 17, 1, 16, 64, 5318 }, // а
-    { 16, 24, 16, 1, 23, 96, 5382 }, // б
-    { 14, 17, 15, 1, 16, 60, 5478 }, // в
-    { 13, 17, 13, 0, 16, 56, 5538 }, // г
-    { 15, 24, 16, 1, 23, 90, 5594 }, // д
-    { 13, 17, 14, 1, 16, 56, 5684 }, // е
-    { 27, 17, 26, -1, 16, 115, 5740 }, // ж
-    { 13, 17, 13, 0, 16, 56, 5855 }, // з
-    { 15, 17, 17, 1, 16, 64, 5911 }, // и
-    { 15, 23, 17, 1, 22, 87, 5975 }, // й
-    { 16, 16, 15, 0, 16, 64, 6062 }, // к
-    { 18, 17, 17, -2, 16, 77, 6126 }, // л
-    { 22, 16, 22, 0, 16, 88, 6203 }, // м
-    { 16, 16, 17, 0, 16, 64, 6291 }, // н
-    { 15, 17, 16, 1, 16, 64, 6355 }, // о
-    { 15, 16, 16, 0, 16, 60, 6419 }, // п
-    { 17, 23, 17, -1, 16, 98, 6479 }, // р
-    { 13, 17, 13, 1, 16, 56, 6577 }, // с
-    { 24, 16, 25, 0, 16, 96, 6633 }, // т
-    { 19, 23, 14, -3, 16, 110, 6729 }, // у
-    { 18, 30, 20, 1, 23, 135, 6839 }, // ф
-    { 17, 16, 13, -2, 16, 68, 6974 }, // х
-    { 15, 21, 17, 1, 16, 79, 7042 }, // ц
-    { 14, 16, 16, 2, 16, 56, 7121 }, // ч
-    { 24, 17, 25, 1, 16, 102, 7177 }, // ш
-    { 24, 21, 26, 1, 16, 126, 7279 }, // щ
-    { 16, 17, 17, 1, 16, 68, 7405 }, // ъ
-    { 20, 17, 21, 1, 16, 85, 7473 }, // ы
-    { 13, 17, 15, 1, 16, 56, 7558 }, // ь
-    { 13, 17, 14, 0, 16, 56, 7614 }, // э
-    { 22, 17, 23, 0, 16, 94, 7670 }, // ю
-    { 16, 16, 15, -1, 16, 64, 7764 }, // я
-    { 13, 24, 14, 1, 23, 78, 7828 }, // ѐ
-    { 14, 23, 14, 1, 22, 81, 7906 }, // ё
-    { 16, 30, 17, 0, 23, 120, 7987 }, // ђ
-    { 14, 24, 13, 0, 23, 84, 8107 }, // ѓ
-    { 13, 17, 14, 1, 16, 56, 8191 }, // є
-    { 13, 17, 13, 0, 16, 56, 8247 }, // ѕ
-    { 8, 22, 8, 0, 22, 44, 8303 }, // і
-    { 10, 22, 7, 0, 22, 55, 8347 }, // ї
-    { 12, 29, 7, -4, 22, 87, 8402 }, // ј
-    { 25, 17, 24, -2, 16, 107, 8489 }, // љ
-    { 23, 17, 24, 0, 16, 98, 8596 }, // њ
-    { 16, 23, 17, 0, 23, 92, 8694 }, // ћ
-    { 16, 23, 15, 0, 23, 92, 8786 }, // ќ
-    { 15, 24, 17, 1, 23, 90, 8878 }, // ѝ
-    { 19, 29, 14, -3, 22, 138, 8968 }, // ў
-    { 15, 22, 17, 1, 16, 83, 9106 }, // џ
-    { 27, 22, 27, 2, 21, 149, 9189 }, // Ѡ
-    { 23, 16, 23, 1, 16, 92, 9338 }, // ѡ
-    { 14, 21, 17, 2, 21, 74, 9430 }, // Ѣ
-    { 23, 18, 24, 0, 17, 104, 9504 }, // ѣ
-    { 26, 23, 25, 1, 22, 150, 9608 }, // Ѥ
-    { 21, 17, 20, 0, 16, 90, 9758 }, // ѥ
-    { 19, 21, 18, -2, 21, 100, 9848 }, // Ѧ
-    { 16, 16, 16, -2, 16, 64, 9948 }, // ѧ
-    { 23, 21, 25, 1, 21, 121, 10012 }, // Ѩ
-    { 20, 16, 21, 0, 16, 80, 10133 }, // ѩ
-    { 23, 21, 19, -2, 21, 121, 10213 }, // Ѫ
-    { 19, 16, 18, -2, 16, 76, 10334 }, // ѫ
-    { 27, 21, 27, 1, 21, 142, 10410 }, // Ѭ
-    { 24, 16, 23, 0, 16, 96, 10552 }, // ѭ
-    { 18, 32, 16, -2, 25, 144, 10648 }, // Ѯ
-    { 16, 26, 13, -2, 20, 104, 10792 }, // ѯ
-    { 22, 21, 22, 3, 21, 116, 10896 }, // Ѱ
-    { 19, 30, 21, 1, 23, 143, 11012 }, // ѱ
-    { 19, 23, 21, 2, 22, 110, 11155 }, // Ѳ
-    { 15, 17, 16, 1, 16, 64, 11265 }, // ѳ
-    { 18, 21, 17, 2, 21, 95, 11329 }, // Ѵ
-    { 15, 16, 13, 1, 16, 60, 11424 }, // ѵ
-    { 18, 28, 17, 2, 28, 126, 11484 }, // Ѷ
-    { 15, 23, 13, 1, 23, 87, 11610 }, // ѷ
-    { 35, 29, 35, 2, 22, 254, 11697 }, // Ѹ
-    { 31, 23, 30, 1, 16, 179, 11951 }, // ѹ
-    { 19, 25, 22, 2, 23, 119, 12130 }, // Ѻ
-    { 15, 20, 17, 1, 18, 75, 12249 }, // ѻ
-    { 26, 32, 28, 2, 31, 208, 12324 }, // Ѽ
-    { 21, 27, 23, 1, 26, 142, 12532 }, // ѽ
-    { 27, 27, 27, 2, 26, 183, 12674 }, // Ѿ
-    { 23, 21, 23, 1, 21, 121, 12857 }, // ѿ
-    { 17, 29, 17, 2, 22, 124, 12978 }, // Ҁ
-    { 13, 23, 13, 1, 16, 75, 13102 }, // ҁ
-    { 16, 20, 18, 1, 19, 80, 13177 }, // ҂
-    { 12, 5, 0, -12, 21, 15, 13257 }, // ҃
-    { 12, 5, 0, -12, 22, 15, 13272 }, // ҄
-    { 4, 6, 0, -8, 23, 6, 13287 }, // ҅
-    { 4, 6, 0, -8, 23, 6, 13293 }, // ҆
-    { 12, 4, 0, -2, 26, 12, 13299 }, // ҇
-    { 34, 31, 0, -17, 23, 264, 13311 }, // ҈
-    { 34, 33, 0, -17, 24, 281, 13575 }, // ҉
-    { 20, 34, 21, 1, 28, 170, 13856 }, // Ҋ
-    { 16, 29, 17, 1, 23, 116, 14026 }, // ҋ
-    { 14, 21, 16, 1, 21, 74, 14142 }, // Ҍ
-    { 13, 24, 15, 1, 23, 78, 14216 }, // ҍ
-    { 16, 21, 17, 1, 21, 84, 14294 }, // Ҏ
-    { 17, 23, 17, -1, 16, 98, 14378 }, // ҏ
-    { 16, 26, 14, 1, 26, 104, 14476 }, // Ґ
-    { 14, 21, 11, 0, 21, 74, 14580 }, // ґ
-    { 16, 21, 14, 1, 21, 84, 14654 }, // Ғ
-    { 13, 16, 11, 0, 16, 52, 14738 }, // ғ
-    { 16, 29, 18, 1, 21, 116, 14790 }, // Ҕ
-    { 13, 24, 15, 0, 16, 78, 14906 }, // ҕ
-    { 28, 27, 24, -2, 21, 189, 14984 }, // Җ
-    { 27, 22, 25, -1, 16, 149, 15173 }, // җ
-    { 16, 29, 15, -1, 22, 116, 15322 }, // Ҙ
-    { 13, 23, 13, 0, 16, 75, 15438 }, // ҙ
-    { 19, 27, 18, 1, 21, 129, 15513 }, // Қ
-    { 16, 22, 15, 0, 16, 88, 15642 }, // қ
-    { 19, 21, 17, 1, 21, 100, 15730 }, // Ҝ
-    { 16, 16, 14, 0, 16, 64, 15830 }, // ҝ
-    { 19, 21, 16, 1, 21, 100, 15894 }, // Ҟ
-    { 16, 23, 14, 0, 23, 92, 15994 }, // ҟ
-    { 20, 21, 19, 2, 21, 105, 16086 }, // Ҡ
-    { 17, 16, 17, 1, 16, 68, 16191 }, // ҡ
-    { 19, 27, 20, 1, 21, 129, 16259 }, // Ң
-    { 17, 22, 18, 0, 16, 94, 16388 }, // ң
-    { 24, 21, 22, 1, 21, 126, 16482 }, // Ҥ
-    { 22, 16, 20, 0, 16, 88, 16608 }, // ҥ
-    { 26, 29, 29, 1, 21, 189, 16696 }, // Ҧ
-    { 22, 24, 24, 0, 16, 132, 16885 }, // ҧ
-    { 18, 24, 21, 2, 22, 108, 17017 }, // Ҩ
-    { 16, 17, 18, 1, 16, 68, 17125 }, // ҩ
-    { 17, 29, 17, 2, 22, 124, 17193 }, // Ҫ
-    { 13, 23, 13, 1, 16, 75, 17317 }, // ҫ
-    { 16, 27, 15, 2, 21, 108, 17392 }, // Ҭ
-    { 25, 22, 26, 0, 16, 138, 17500 }, // ҭ
-    { 16, 21, 15, 2, 21, 84, 17638 }, // Ү
-    { 15, 23, 14, 1, 16, 87, 17722 }, // ү
-    { 17, 21, 15, 1, 21, 90, 17809 }, // Ұ
-    { 17, 23, 14, -1, 16, 98, 17899 }, // ұ
-    { 20, 27, 17, -2, 21, 135, 17997 }, // Ҳ
-    { 17, 22, 15, -1, 16, 94, 18132 }, // ҳ
-    { 21, 27, 23, 2, 21, 142, 18226 }, // Ҵ
-    { 18, 22, 19, 1, 16, 99, 18368 }, // ҵ
-    { 16, 27, 19, 3, 21, 108, 18467 }, // Ҷ
-    { 14, 22, 16, 2, 16, 77, 18575 }, // ҷ
-    { 16, 21, 19, 3, 21, 84, 18652 }, // Ҹ
-    { 14, 16, 16, 2, 16, 56, 18736 }, // ҹ
-    { 16, 21, 19, 1, 21, 84, 18792 }, // Һ
-    { 16, 23, 17, 0, 23, 92, 18876 }, // һ
-    { 22, 23, 22, 1, 22, 127, 18968 }, // Ҽ
-    { 16, 17, 17, 1, 16, 68, 19095 }, // ҽ
-    { 22, 28, 22, 1, 22, 154, 19163 }, // Ҿ
-    { 16, 22, 17, 1, 16, 88, 19317 }, // ҿ
-    { 13, 21, 9, -1, 21, 69, 19405 }, // Ӏ
-    { 28, 27, 23, -2, 27, 189, 19474 }, // Ӂ
-    { 27, 23, 26, -1, 22, 156, 19663 }, // ӂ
-    { 19, 29, 19, 1, 21, 138, 19819 }, // Ӄ
-    { 16, 24, 15, 0, 16, 96, 19957 }, // ӄ
-    { 21, 27, 19, -1, 21, 142, 20053 }, // Ӆ
-    { 17, 22, 16, -2, 16, 94, 20195 }, // ӆ
-    { 19, 29, 20, 1, 21, 138, 20289 }, // Ӈ
-    { 17, 24, 18, 0, 16, 102, 20427 }, // ӈ
-    { 19, 27, 20, 1, 21, 129, 20529 }, // Ӊ
-    { 17, 22, 18, 0, 16, 94, 20658 }, // ӊ
-    { 16, 27, 19, 3, 21, 108, 20752 }, // Ӌ
-    { 15, 22, 17, 2, 16, 83, 20860 }, // ӌ
-    { 24, 27, 25, 1, 21, 162, 20943 }, // Ӎ
-    { 20, 22, 20, 0, 16, 110, 21105 }, // ӎ
-    { 13, 21, 9, -1, 21, 69, 21215 }, // ӏ
-    { 19, 27, 16, -2, 27, 129, 21284 }, // Ӑ
-    { 16, 23, 17, 1, 22, 92, 21413 }, // ӑ
-    { 18, 27, 16, -2, 27, 122, 21505 }, // Ӓ
-    { 16, 23, 17, 1, 22, 92, 21627 }, // ӓ
-    { 28, 21, 24, -2, 21, 147, 21719 }, // Ӕ
-    { 23, 17, 24, 1, 16, 98, 21866 }, // ӕ
-    { 16, 27, 15, 1, 27, 108, 21964 }, // Ӗ
-    { 15, 23, 15, 1, 22, 87, 22072 }, // ӗ
-    { 18, 23, 19, 1, 22, 104, 22159 }, // Ә
-    { 14, 17, 14, 0, 16, 60, 22263 }, // ә
-    { 18, 28, 19, 1, 27, 126, 22323 }, // Ӛ
-    { 14, 23, 14, 0, 22, 81, 22449 }, // ӛ
-    { 28, 27, 23, -2, 27, 189, 22530 }, // Ӝ
-    { 27, 23, 26, -1, 22, 156, 22719 }, // ӝ
-    { 16, 28, 15, -1, 27, 112, 22875 }, // Ӟ
-    { 13, 23, 13, 0, 22, 75, 22987 }, // ӟ
-    { 16, 22, 15, 0, 21, 88, 23062 }, // Ӡ
-    { 16, 23, 14, -2, 16, 92, 23150 }, // ӡ
-    { 21, 25, 20, 0, 25, 132, 23242 }, // Ӣ
-    { 16, 21, 17, 1, 20, 84, 23374 }, // ӣ
-    { 21, 27, 20, 0, 27, 142, 23458 }, // Ӥ
-    { 16, 23, 17, 1, 22, 92, 23600 }, // ӥ
-    { 19, 28, 21, 2, 27, 133, 23692 }, // Ӧ
-    { 15, 23, 16, 1, 22, 87, 23825 }, // ӧ
-    { 19, 23, 21, 2, 22, 110, 23912 }, // Ө
-    { 15, 17, 16, 1, 16, 64, 24022 }, // ө
-    { 19, 28, 21, 2, 27, 133, 24086 }, // Ӫ
-    { 15, 23, 16, 1, 22, 87, 24219 }, // ӫ
-    { 17, 28, 17, 0, 27, 119, 24306 }, // Ӭ
-    { 13, 23, 14, 0, 22, 75, 24425 }, // ӭ
-    { 19, 26, 16, 0, 25, 124, 24500 }, // Ӯ
-    { 19, 27, 14, -3, 20, 129, 24624 }, // ӯ
-    { 19, 28, 16, 0, 27, 133, 24753 }, // Ӱ
-    { 19, 29, 14, -3, 22, 138, 24886 }, // ӱ
-    { 19, 29, 16, 0, 28, 138, 25024 }, // Ӳ
-    { 19, 30, 14, -3, 23, 143, 25162 }, // ӳ
-    { 17, 27, 18, 2, 27, 115, 25305 }, // Ӵ
-    { 14, 22, 16, 2, 22, 77, 25420 }, // ӵ
-    { 16, 27, 14, 1, 21, 108, 25497 }, // Ӷ
-    { 13, 22, 11, 0, 16, 72, 25605 }, // ӷ
-    { 24, 27, 23, 0, 27, 162, 25677 }, // Ӹ
-    { 20, 23, 21, 1, 22, 115, 25839 }, // ӹ
-    { 17, 27, 14, 0, 21, 115, 25954 }, // Ӻ
-    { 14, 22, 11, -1, 16, 77, 26069 }, // ӻ
-    { 20, 27, 15, -2, 21, 135, 26146 }, // Ӽ
-    { 17, 22, 14, -2, 16, 94, 26281 }, // ӽ
-    { 20, 21, 15, -2, 21, 105, 26375 }, // Ӿ
-    { 17, 16, 14, -2, 16, 68, 26480 }, // ӿ
-    { 0, 0, 15, 0, 0, 0, 0 }, //  
-    { 0, 0, 29, 0, 0, 0, 0 }, //  
-    { 0, 0, 15, 0, 0, 0, 0 }, //  
-    { 0, 0, 29, 0, 0, 0, 0 }, //  
-    { 0, 0, 10, 0, 0, 0, 0 }, //  
-    { 0, 0, 7, 0, 0, 0, 0 }, //  
-    { 0, 0, 5, 0, 0, 0, 0 }, //  
-    { 0, 0, 16, 0, 0, 0, 0 }, //  
-    { 0, 0, 7, 0, 0, 0, 0 }, //  
-    { 0, 0, 5, 0, 0, 0, 0 }, //  
-    { 0, 0, 3, 0, 0, 0, 0 }, //  
-    { 0, 0, 0, 0, 0, 0, 0 }, // ​
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‍
-    { 8, 25, 0, -1, 21, 50, 0 }, // ‎
-    { 8, 25, 0, -7, 21, 50, 50 }, // ‏
-    { 9, 3, 9, 0, 9, 7, 100 }, // ‐
-    { 9, 3, 9, 0, 9, 7, 107 }, // ‑
-    { 15, 3, 16, 1, 12, 12, 114 }, // ‒
-    { 14, 4, 14, 0, 10, 14, 126 }, // –
-    { 28, 4, 28, 0, 10, 28, 140 }, // —
-    { 28, 4, 28, 0, 10, 28, 168 }, // ―
-    { 9, 31, 16, 4, 23, 70, 196 }, // ‖
-    { 13, 7, 12, -3, 0, 23, 266 }, // ‗
-    { 7, 8, 5, 1, 21, 14, 289 }, // ‘
-    { 7, 8, 5, 1, 21, 14, 303 }, // ’
-    { 7, 8, 7, -2, 4, 14, 317 }, // ‚
-    { 4, 8, 5, 3, 21, 8, 331 }, // ‛
-    { 12, 8, 10, 1, 21, 24, 339 }, // “
-    { 12, 8, 10, 1, 21, 24, 363 }, // ”
-    { 12, 8, 12, -2, 4, 24, 387 }, // „
-    { 9, 8, 10, 3, 21, 18, 411 }, // ‟
-    { 11, 23, 14, 3, 23, 64, 429 }, // †
-    { 15, 23, 14, 0, 23, 87, 493 }, // ‡
-    { 8, 8, 11, 2, 15, 16, 580 }, // •
-    { 10, 10, 11, 1, 16, 25, 596 }, // ‣
-    { 4, 5, 15, 4, 4, 5, 621 }, // ․
-    { 12, 5, 15, 0, 4, 15, 626 }, // ‥
-    { 20, 5, 22, 0, 4, 25, 641 }, // …
-    { 5, 5, 7, 1, 10, 7, 666 }, // ‧
-    { 0, 0, 18, 0, 0, 0, 673 }, //  
-    { 0, 0, 18, 0, 0, 0, 673 }, //  
-    { 8, 22, 0, -1, 18, 44, 673 }, // ‪
-    { 8, 22, 0, -7, 18, 44, 717 }, // ‫
-    { 8, 25, 0, -4, 21, 50, 761 }, // ‬
-    { 8, 25, 0, -4, 21, 50, 811 }, // ‭
-    { 8, 25, 0, -4, 21, 50, 861 }, // ‮
-    { 0, 0, 5, 0, 0, 0, 911 }, //  
-    { 30, 23, 33, 2, 22, 173, 911 }, // ‰
-    { 40, 23, 42, 2, 22, 230, 1084 }, // ‱
-    { 8, 8, 6, 1, 21, 16, 1314 }, // ′
-    { 13, 8, 11, 1, 21, 26, 1330 }, // ″
-    { 18, 8, 16, 1, 21, 36, 1356 }, // ‴
-    { 5, 8, 8, 3, 21, 10, 1392 }, // ‵
-    { 10, 8, 12, 3, 21, 20, 1402 }, // ‶
-    { 14, 8, 17, 3, 21, 28, 1422 }, // ‷
-    { 11, 10, 12, -3, 3, 28, 1450 }, // ‸
-    { 8, 13, 8, 1, 14, 26, 1478 }, // ‹
-    { 8, 13, 8, 0, 14, 26, 1504 }, // ›
-    { 22, 23, 24, 1, 22, 127, 1530 }, // ※
-    { 15, 22, 14, 0, 21, 83, 1657 }, // ‼
-    { 12, 23, 13, 2, 22, 69, 1740 }, // ‽
-    { 13, 3, 11, 2, 25, 10, 1809 }, // ‾
-    { 16, 7, 16, -2, 0, 28, 1819 }, // ‿
-    { 16, 7, 16, 2, 24, 28, 1847 }, // ⁀
-    { 14, 19, 10, -3, 12, 67, 1875 }, // ⁁
-    { 31, 27, 33, 0, 23, 210, 1942 }, // ⁂
-    { 8, 3, 8, 0, 9, 6, 2152 }, // ⁃
-    { 18, 21, 4, -7, 21, 95, 2158 }, // ⁄
-    { 12, 26, 8, -1, 21, 78, 2253 }, // ⁅
-    { 12, 26, 8, -3, 21, 78, 2331 }, // ⁆
-    { 24, 23, 25, 2, 22, 138, 2409 }, // ⁇
-    { 19, 23, 20, 2, 22, 110, 2547 }, // ⁈
-    { 21, 23, 20, 0, 22, 121, 2657 }, // ⁉
-    { 15, 16, 15, 1, 16, 60, 2778 }, // ⁊
-    { 15, 27, 17, 3, 23, 102, 2838 }, // ⁋
-    { 16, 15, 19, 1, 16, 60, 2940 }, // ⁌
-    { 16, 15, 19, 2, 16, 60, 3000 }, // ⁍
-    { 15, 15, 16, -1, 8, 57, 3060 }, // ⁎
-    { 7, 21, 7, 0, 17, 37, 3117 }, // ⁏
-    { 20, 31, 16, -2, 24, 155, 3154 }, // ⁐
-    { 17, 30, 16, 0, 23, 128, 3309 }, // ⁑
-    { 11, 23, 11, 0, 22, 64, 3437 }, // ⁒
-    { 26, 5, 29, 2, 11, 33, 3501 }, // ⁓
-    { 16, 7, 16, -3, 0, 28, 3534 }, // ⁔
-    { 16, 16, 17, 0, 15, 64, 3562 }, // ⁕
-    { 13, 23, 15, 1, 22, 75, 3626 }, // ⁖
-    { 23, 8, 21, 1, 21, 46, 3701 }, // ⁗
-    { 22, 23, 24, 1, 22, 127, 3747 }, // ⁘
-    { 22, 23, 24, 1, 22, 127, 3874 }, // ⁙
-    { 4, 23, 6, 1, 22, 23, 4001 }, // ⁚
-    { 17, 23, 19, 1, 22, 98, 4024 }, // ⁛
-    { 22, 23, 23, 1, 22, 127, 4122 }, // ⁜
-    { 4, 22, 8, 2, 21, 22, 4249 }, // ⁝
-    { 5, 23, 8, 2, 22, 29, 4271 }, // ⁞
-    { 0, 0, 6, 0, 0, 0, 4300 }, //  
-    { 0, 0, 18, 0, 0, 0, 4300 }, // ⁠
-    { 0, 0, 18, 0, 0, 0, 4300 }, // ⁡
-    { 0, 0, 18, 0, 0, 0, 4300 }, // ⁢
-    { 0, 0, 18, 0, 0, 0, 4300 }, // ⁣
-    { 0, 0, 18, 0, 0, 0, 4300 }, // ⁤
-    { 0, 0, 18, 0, 0, 0, 4300 }, // ⁦
-    { 0, 0, 18, 0, 0, 0, 4300 }, // ⁧
-    { 0, 0, 18, 0, 0, 0, 4300 }, // ⁨
-    { 0, 0, 18, 0, 0, 0, 4300 }, // ⁩
-    { 8, 25, 0, -4, 21, 50, 4300 }, // ⁪
-    { 8, 25, 0, -4, 21, 50, 4350 }, // ⁫
-    { 8, 25, 0, -4, 21, 50, 4400 }, // ⁬
-    { 8, 25, 0, -4, 21, 50, 4450 }, // ⁭
-    { 8, 25, 0, -4, 21, 50, 4500 }, // ⁮
-    { 8, 25, 0, -4, 21, 50, 4550 }, // ⁯
-    { 10, 14, 10, 2, 25, 35, 0 }, // ⁰
-    { 5, 14, 7, 2, 22, 18, 35 }, // ⁱ
-    { 10, 13, 10, 2, 25, 33, 53 }, // ⁴
-    { 10, 14, 10, 2, 25, 35, 86 }, // ⁵
-    { 10, 14, 10, 3, 25, 35, 121 }, // ⁶
-    { 10, 13, 10, 3, 25, 33, 156 }, // ⁷
-    { 10, 14, 10, 2, 25, 35, 189 }, // ⁸
-    { 10, 14, 10, 2, 25, 35, 224 }, // ⁹
-    { 8, 9, 10, 3, 22, 18, 259 }, // ⁺
-    { 8, 3, 10, 3, 19, 6, 277 }, // ⁻
-    { 8, 6, 10, 3, 21, 12, 283 }, // ⁼
-    { 7, 17, 5, 3, 27, 30, 295 }, // ⁽
-    { 7, 17, 5, 0, 27, 30, 325 }, // ⁾
-    { 10, 10, 11, 2, 18, 25, 355 }, // ⁿ
-    { 10, 14, 10, -1, 9, 35, 380 }, // ₀
-    { 7, 13, 10, 0, 9, 23, 415 }, // ₁
-    { 11, 13, 10, -2, 9, 36, 438 }, // ₂
-    { 11, 14, 10, -2, 9, 39, 474 }, // ₃
-    { 10, 13, 10, -1, 9, 33, 513 }, // ₄
-    { 10, 14, 10, -1, 9, 35, 546 }, // ₅
-    { 10, 14, 10, -1, 9, 35, 581 }, // ₆
-    { 11, 13, 10, -1, 9, 36, 616 }, // ₇
-    { 10, 14, 10, -1, 9, 35, 652 }, // ₈
-    { 10, 14, 10, -1, 9, 35, 687 }, // ₉
-    { 9, 9, 10, -1, 6, 21, 722 }, // ₊
-    { 9, 3, 10, -1, 4, 7, 743 }, // ₋
-    { 9, 6, 10, -1, 5, 14, 750 }, // ₌
-    { 7, 17, 5, 0, 11, 30, 764 }, // ₍
-    { 8, 17, 5, -4, 11, 34, 794 }, // ₎
-    { 10, 10, 11, -1, 7, 25, 828 }, // ₐ
-    { 9, 10, 9, -1, 7, 23, 853 }, // ₑ
-    { 10, 10, 11, -1, 7, 25, 876 }, // ₒ
-    { 12, 10, 9, -3, 7, 30, 901 }, // ₓ
-    { 9, 10, 9, -2, 7, 23, 931 }, // ₔ
-    { 10, 14, 13, 0, 11, 35, 954 }, // ₕ
-    { 10, 14, 10, 0, 11, 35, 989 }, // ₖ
-    { 5, 14, 7, 0, 11, 18, 1024 }, // ₗ
-    { 16, 10, 18, 0, 7, 40, 1042 }, // ₘ
-    { 11, 10, 11, -2, 7, 28, 1082 }, // ₙ
-    { 11, 14, 11, -2, 7, 39, 1110 }, // ₚ
-    { 8, 10, 9, -1, 7, 20, 1149 }, // ₛ
-    { 7, 12, 6, -1, 9, 21, 1169 }, // ₜ
-    { 15, 22, 16, 2, 22, 83, 0 }, // ₠
-    { 17, 25, 16, 1, 23, 107, 83 }, // ₡
-    { 16, 23, 16, 1, 22, 92, 190 }, // ₢
-    { 17, 21, 16, 0, 21, 90, 282 }, // ₣
-    { 18, 22, 16, -1, 22, 99, 372 }, // ₤
-    { 24, 24, 26, 0, 20, 144, 471 }, // ₥
-    { 17, 21, 16, 0, 21, 90, 615 }, // ₦
-    { 21, 22, 22, 0, 21, 116, 705 }, // ₧
-    { 24, 22, 23, 0, 21, 132, 821 }, // ₨
-    { 21, 21, 18, 0, 21, 111, 953 }, // ₩
-    { 24, 21, 23, 0, 21, 126, 1064 }, // ₪
-    { 19, 28, 17, 0, 23, 133, 1190 }, // ₫
-    { 18, 23, 16, 0, 22, 104, 1323 }, // €
-    { 19, 21, 16, 0, 21, 100, 1427 }, // ₭
-    { 17, 21, 15, 1, 21, 90, 1527 }, // ₮
-    { 28, 29, 28, 0, 22, 203, 1617 }, // ₯
-    { 19, 29, 16, -2, 22, 138, 1820 }, // ₰
-    { 17, 21, 16, 1, 21, 90, 1958 }, // ₱
-    { 18, 26, 20, 2, 23, 117, 2048 }, // ₲
-    { 20, 21, 16, -2, 21, 105, 2165 }, // ₳
-    { 18, 23, 15, -1, 22, 104, 2270 }, // ₴
-    { 17, 26, 17, 2, 23, 111, 2374 }, // ₵
-    { 18, 21, 17, 0, 20, 95, 2485 }, // ₶
-    { 21, 25, 19, -1, 22, 132, 2580 }, // ₷
-    { 16, 21, 14, 1, 21, 84, 2712 }, // ₸
-    { 15, 21, 16, 2, 21, 79, 2796 }, // ₹
-    { 16, 22, 16, 0, 21, 88, 2875 }, // ₺
-    { 19, 23, 20, 1, 22, 110, 2963 }, // ₻
-    { 22, 21, 22, -1, 21, 116, 3073 }, // ₼
-    { 19, 21, 17, -1, 21, 100, 3189 }, // ₽
-    { 20, 24, 17, -1, 24, 120, 3289 }, // ₾
-    { 16, 27, 16, 1, 24, 108, 3409 }, // ₿
-    { 9, 3, 9, 0, 9, 7, 0 }, // −
-    { 27, 28, 29, 1, 23, 189, 0 }, // �
+    { 13, 13, 14, 1, 14, 43, 7068 }, // «
+    { 14, 9, 17, 2, 12, 32, 635 }, // ¬
+    { 9, 3, 9, 0, 9, 7, 667 }, // ­
+    { 22, 23, 24, 1, 22, 127, 674 }, // ®
+    { 13, 3, 11, 2, 25, 10, 801 }, // ¯
+    { 10, 10, 12, 1, 22, 25, 811 }, // °
+    { 14, 18, 17, 2, 18, 63, 836 }, // ±
+    { 10, 13, 10, 2, 25, 33, 899 }, // ²
+    { 10, 14, 10, 2, 25, 35, 932 }, // ³
+    { 7, 6, 8, 3, 23, 11, 967 }, // ´
+    { 18, 23, 17, -1, 16, 104, 978 }, // µ
+    { 16, 27, 19, 2, 23, 108, 1082 }, // ¶
+    { 5, 5, 7, 2, 13, 7, 1190 }, // ·
+    { 7, 7, 6, -3, 0, 13, 1197 }, // ¸
+    { 7, 13, 10, 4, 25, 23, 1210 }, // ¹
+    { 9, 11, 10, 2, 22, 25, 1233 }, // º
+    { 13, 13, 14, 0, 14, 43, 7111 }, // »
+    { 19, 21, 21, 2, 21, 100, 1258 }, // ¼
+    { 21, 21, 23, 2, 21, 111, 1358 }, // ½
+    { 22, 21, 23, 1, 21, 116, 1469 }, // ¾
+    { 12, 22, 13, -1, 16, 66, 1585 }, // ¿
+    { 17, 28, 16, -2, 28, 119, 7154 }, // À
+    { 19, 28, 16, -2, 28, 133, 7273 }, // Á
+    { 18, 28, 16, -2, 28, 126, 7406 }, // Â
+    { 20, 27, 16, -2, 27, 135, 1651 }, // Ã
+    { 18, 27, 16, -2, 27, 122, 7532 }, // Ä
+    { 17, 29, 16, -2, 29, 124, 1786 }, // Å
+    { 28, 21, 24, -2, 21, 147, 1910 }, // Æ
+    { 17, 29, 17, 2, 22, 124, 7654 }, // Ç
+    { 16, 28, 15, 1, 28, 112, 7778 }, // È
+    { 16, 28, 15, 1, 28, 112, 7890 }, // É
+    { 16, 28, 15, 1, 28, 112, 8002 }, // Ê
+    { 16, 27, 15, 1, 27, 108, 8114 }, // Ë
+    { 13, 28, 9, -1, 28, 91, 8222 }, // Ì
+    { 14, 28, 9, -1, 28, 98, 8313 }, // Í
+    { 14, 28, 9, -1, 28, 98, 8411 }, // Î
+    { 14, 27, 9, -1, 27, 95, 8509 }, // Ï
+    { 19, 21, 19, 0, 21, 100, 2057 }, // Ð
+    { 20, 27, 21, 1, 27, 135, 8604 }, // Ñ
+    { 19, 29, 21, 2, 28, 138, 8739 }, // Ò
+    { 19, 29, 21, 2, 28, 138, 8877 }, // Ó
+    { 19, 29, 21, 2, 28, 138, 9015 }, // Ô
+    { 19, 28, 21, 2, 27, 133, 2157 }, // Õ
+    { 19, 28, 21, 2, 27, 133, 9153 }, // Ö
+    { 14, 14, 17, 2, 17, 49, 2290 }, // ×
+    { 20, 24, 21, 1, 22, 120, 2339 }, // Ø
+    { 19, 29, 20, 2, 28, 138, 9286 }, // Ù
+    { 19, 29, 20, 2, 28, 138, 9424 }, // Ú
+    { 19, 29, 20, 2, 28, 138, 9562 }, // Û
+    { 19, 28, 20, 2, 27, 133, 9700 }, // Ü
+    { 16, 28, 15, 2, 28, 112, 2459 }, // Ý
+    { 15, 21, 17, 1, 21, 79, 2571 }, // Þ
+    { 21, 30, 17, -4, 23, 158, 2650 }, // ß
+    { 16, 24, 17, 1, 23, 96, 9833 }, // à
+    { 16, 24, 17, 1, 23, 96, 9929 }, // á
+    { 16, 24, 17, 1, 23, 96, 10025 }, // â
+    { 16, 23, 17, 1, 22, 92, 2808 }, // ã
+    { 16, 23, 17, 1, 22, 92, 10121 }, // ä
+    { 16, 25, 17, 1, 24, 100, 2900 }, // å
+    { 23, 17, 24, 1, 16, 98, 3000 }, // æ
+    { 13, 23, 13, 1, 16, 75, 10213 }, // ç
+    { 13, 24, 15, 1, 23, 78, 10288 }, // è
+    { 14, 24, 15, 1, 23, 84, 10366 }, // é
+    { 13, 24, 15, 1, 23, 78, 10450 }, // ê
+    { 13, 23, 15, 1, 22, 75, 10528 }, // ë
+    { 8, 23, 8, 0, 23, 46, 10603 }, // ì
+    { 11, 23, 8, 0, 23, 64, 10649 }, // í
+    { 11, 23, 8, 0, 23, 64, 10713 }, // î
+    { 11, 22, 8, 0, 22, 61, 10777 }, // ï
+    { 16, 24, 17, 1, 23, 96, 3098 }, // ð
+    { 17, 22, 17, 0, 22, 94, 10838 }, // ñ
+    { 15, 24, 16, 1, 23, 90, 10932 }, // ò
+    { 15, 24, 16, 1, 23, 90, 11022 }, // ó
+    { 15, 24, 16, 1, 23, 90, 11112 }, // ô
+    { 15, 23, 16, 1, 22, 87, 3194 }, // õ
+    { 15, 23, 16, 1, 22, 87, 11202 }, // ö
+    { 14, 14, 17, 2, 17, 49, 3281 }, // ÷
+    { 16, 19, 16, 0, 17, 76, 3330 }, // ø
+    { 16, 24, 17, 1, 23, 96, 11289 }, // ù
+    { 16, 24, 17, 1, 23, 96, 11385 }, // ú
+    { 16, 24, 17, 1, 23, 96, 11481 }, // û
+    { 16, 23, 17, 1, 22, 92, 11577 }, // ü
+    { 19, 30, 14, -3, 23, 143, 3406 }, // ý
+    { 17, 30, 17, -1, 23, 128, 3549 }, // þ
+    { 19, 29, 14, -3, 22, 138, 3677 }, // ÿ
+    { 18, 25, 16, -2, 25, 113, 3815 }, // Ā
+    { 16, 21, 17, 1, 20, 84, 3928 }, // ā
+    { 19, 27, 16, -2, 27, 129, 4012 }, // Ă
+    { 16, 23, 17, 1, 22, 92, 4141 }, // ă
+    { 17, 28, 16, -2, 21, 119, 4233 }, // Ą
+    { 16, 23, 17, 1, 16, 92, 4352 }, // ą
+    { 17, 29, 17, 2, 28, 124, 4444 }, // Ć
+    { 14, 24, 13, 1, 23, 84, 4568 }, // ć
+    { 17, 29, 17, 2, 28, 124, 4652 }, // Ĉ
+    { 13, 24, 13, 1, 23, 78, 4776 }, // ĉ
+    { 17, 28, 17, 2, 27, 119, 4854 }, // Ċ
+    { 13, 23, 13, 1, 22, 75, 4973 }, // ċ
+    { 17, 29, 17, 2, 28, 124, 5048 }, // Č
+    { 14, 24, 13, 1, 23, 84, 5172 }, // č
+    { 18, 28, 19, 1, 28, 126, 5256 }, // Ď
+    { 22, 24, 18, 1, 23, 132, 5382 }, // ď
+    { 19, 21, 19, 0, 21, 100, 5514 }, // Đ
+    { 18, 24, 17, 1, 23, 108, 5614 }, // đ
+    { 16, 25, 15, 1, 25, 100, 5722 }, // Ē
+    { 13, 21, 15, 1, 20, 69, 5822 }, // ē
+    { 16, 27, 15, 1, 27, 108, 5891 }, // Ĕ
+    { 14, 23, 15, 1, 22, 81, 5999 }, // ĕ
+    { 16, 27, 15, 1, 27, 108, 6080 }, // Ė
+    { 13, 23, 15, 1, 22, 75, 6188 }, // ė
+    { 16, 28, 15, 1, 21, 112, 6263 }, // Ę
+    { 13, 23, 15, 1, 16, 75, 6375 }, // ę
+    { 16, 28, 15, 1, 28, 112, 6450 }, // Ě
+    { 14, 24, 15, 1, 23, 84, 6562 }, // ě
+    { 18, 29, 20, 2, 28, 131, 6646 }, // Ĝ
+    { 17, 30, 17, 0, 23, 128, 6777 }, // ĝ
+    { 18, 28, 20, 2, 27, 126, 6905 }, // Ğ
+    { 17, 29, 17, 0, 22, 124, 7031 }, // ğ
+    { 18, 28, 20, 2, 27, 126, 7155 }, // Ġ
+    { 17, 29, 17, 0, 22, 124, 7281 }, // ġ
+    { 18, 29, 20, 2, 22, 131, 7405 }, // Ģ
+    { 17, 30, 17, 0, 23, 128, 7536 }, // ģ
+    { 19, 28, 20, 1, 28, 133, 7664 }, // Ĥ
+    { 16, 30, 17, 0, 30, 120, 7797 }, // ĥ
+    { 21, 21, 20, 1, 21, 111, 7917 }, // Ħ
+    { 16, 23, 17, 0, 23, 92, 8028 }, // ħ
+    { 15, 27, 9, -1, 27, 102, 8120 }, // Ĩ
+    { 12, 22, 8, 0, 22, 66, 8222 }, // ĩ
+    { 14, 25, 9, -1, 25, 88, 8288 }, // Ī
+    { 11, 20, 8, 0, 20, 55, 8376 }, // ī
+    { 14, 27, 9, -1, 27, 95, 8431 }, // Ĭ
+    { 11, 22, 8, 0, 22, 61, 8526 }, // ĭ
+    { 13, 28, 9, -1, 21, 91, 8587 }, // Į
+    { 9, 29, 8, -1, 22, 66, 8678 }, // į
+    { 13, 27, 9, -1, 27, 88, 8744 }, // İ
+    { 7, 16, 8, 0, 16, 28, 8832 }, // ı
+    { 19, 27, 17, -1, 21, 129, 8860 }, // Ĳ
+    { 16, 29, 15, 0, 22, 116, 8989 }, // ĳ
+    { 17, 34, 8, -5, 28, 145, 9105 }, // Ĵ
+    { 15, 30, 8, -4, 23, 113, 9250 }, // ĵ
+    { 18, 28, 16, 1, 21, 126, 9363 }, // Ķ
+    { 16, 30, 14, 0, 23, 120, 9489 }, // ķ
+    { 16, 16, 14, 0, 16, 64, 9609 }, // ĸ
+    { 12, 28, 14, 1, 28, 84, 9673 }, // Ĺ
+    { 12, 30, 8, 0, 30, 90, 9757 }, // ĺ
+    { 12, 28, 14, 1, 21, 84, 9847 }, // Ļ
+    { 11, 30, 8, -2, 23, 83, 9931 }, // ļ
+    { 15, 21, 14, 1, 21, 79, 10014 }, // Ľ
+    { 13, 23, 8, 0, 23, 75, 10093 }, // ľ
+    { 12, 21, 14, 1, 21, 63, 10168 }, // Ŀ
+    { 11, 23, 9, 0, 23, 64, 10231 }, // ŀ
+    { 13, 21, 14, 0, 21, 69, 10295 }, // Ł
+    { 9, 23, 8, 0, 23, 52, 10364 }, // ł
+    { 20, 28, 21, 1, 28, 140, 10416 }, // Ń
+    { 16, 23, 17, 0, 23, 92, 10556 }, // ń
+    { 20, 28, 21, 1, 21, 140, 10648 }, // Ņ
+    { 16, 24, 17, 0, 17, 96, 10788 }, // ņ
+    { 20, 28, 21, 1, 28, 140, 10884 }, // Ň
+    { 16, 23, 17, 0, 23, 92, 11024 }, // ň
+    { 17, 21, 19, 1, 21, 90, 11116 }, // ŉ
+    { 20, 27, 21, 1, 21, 135, 11206 }, // Ŋ
+    { 16, 23, 17, 0, 16, 92, 11341 }, // ŋ
+    { 19, 26, 21, 2, 25, 124, 11433 }, // Ō
+    { 15, 21, 16, 1, 20, 79, 11557 }, // ō
+    { 19, 28, 21, 2, 27, 133, 11636 }, // Ŏ
+    { 15, 23, 16, 1, 22, 87, 11769 }, // ŏ
+    { 20, 29, 21, 2, 28, 145, 11856 }, // Ő
+    { 17, 24, 16, 1, 23, 102, 12001 }, // ő
+    { 25, 23, 25, 2, 22, 144, 11669 }, // Œ
+    { 24, 17, 25, 1, 16, 102, 11813 }, // œ
+    { 16, 28, 17, 1, 28, 112, 12103 }, // Ŕ
+    { 14, 23, 12, 0, 23, 81, 12215 }, // ŕ
+    { 16, 28, 17, 1, 21, 112, 12296 }, // Ŗ
+    { 14, 23, 12, -1, 16, 81, 12408 }, // ŗ
+    { 16, 28, 17, 1, 28, 112, 12489 }, // Ř
+    { 15, 23, 12, 0, 23, 87, 12601 }, // ř
+    { 16, 29, 15, 0, 28, 116, 12688 }, // Ś
+    { 13, 24, 13, 0, 23, 78, 12804 }, // ś
+    { 16, 29, 15, 0, 28, 116, 12882 }, // Ŝ
+    { 13, 24, 13, 0, 23, 78, 12998 }, // ŝ
+    { 16, 29, 15, 0, 22, 116, 13076 }, // Ş
+    { 13, 23, 13, 0, 16, 75, 13192 }, // ş
+    { 16, 29, 15, 0, 28, 116, 13267 }, // Š
+    { 14, 24, 13, 0, 23, 84, 13383 }, // š
+    { 16, 28, 15, 2, 21, 112, 13467 }, // Ţ
+    { 11, 27, 10, 0, 20, 75, 13579 }, // ţ
+    { 16, 28, 15, 2, 28, 112, 13654 }, // Ť
+    { 12, 24, 10, 1, 23, 72, 13766 }, // ť
+    { 16, 21, 15, 2, 21, 84, 13838 }, // Ŧ
+    { 11, 21, 10, 0, 20, 58, 13922 }, // ŧ
+    { 19, 28, 20, 2, 27, 133, 13980 }, // Ũ
+    { 16, 23, 17, 1, 22, 92, 14113 }, // ũ
+    { 19, 26, 20, 2, 25, 124, 14205 }, // Ū
+    { 16, 21, 17, 1, 20, 84, 14329 }, // ū
+    { 19, 28, 20, 2, 27, 133, 14413 }, // Ŭ
+    { 16, 23, 17, 1, 22, 92, 14546 }, // ŭ
+    { 19, 30, 20, 2, 29, 143, 14638 }, // Ů
+    { 16, 25, 17, 1, 24, 100, 14781 }, // ů
+    { 19, 29, 20, 2, 28, 138, 14881 }, // Ű
+    { 17, 24, 17, 1, 23, 102, 15019 }, // ű
+    { 19, 28, 20, 2, 21, 133, 15121 }, // Ų
+    { 16, 23, 17, 1, 16, 92, 15254 }, // ų
+    { 25, 28, 25, 3, 28, 175, 15346 }, // Ŵ
+    { 22, 23, 21, 1, 23, 127, 15521 }, // ŵ
+    { 16, 28, 15, 2, 28, 112, 15648 }, // Ŷ
+    { 19, 30, 14, -3, 23, 143, 15760 }, // ŷ
+    { 16, 27, 15, 2, 27, 108, 15903 }, // Ÿ
+    { 18, 28, 15, -1, 28, 126, 16011 }, // Ź
+    { 15, 23, 13, -1, 23, 87, 16137 }, // ź
+    { 18, 27, 15, -1, 27, 122, 16224 }, // Ż
+    { 14, 22, 13, -1, 22, 77, 16346 }, // ż
+    { 18, 28, 15, -1, 28, 126, 16423 }, // Ž
+    { 15, 23, 13, -1, 23, 87, 16549 }, // ž
+    { 17, 30, 8, -4, 23, 128, 16636 }, // ſ
+    { 6, 6, 0, -12, 23, 9, 16764 }, // ̀
+    { 7, 6, 0, -7, 23, 11, 16773 }, // ́
+    { 10, 6, 0, -3, 23, 15, 16784 }, // ̂
+    { 12, 5, 0, -13, 22, 15, 16799 }, // ̃
+    { 9, 3, 0, -2, 20, 7, 16814 }, // ̄
+    { 13, 3, 0, -3, 25, 10, 16821 }, // ̅
+    { 9, 5, 0, -2, 22, 12, 16831 }, // ̆
+    { 4, 4, 0, 1, 22, 4, 16843 }, // ̇
+    { 9, 4, 0, -2, 22, 9, 16847 }, // ̈
+    { 6, 7, 0, -9, 24, 11, 16856 }, // ̉
+    { 7, 7, 0, -1, 24, 13, 16867 }, // ̊
+    { 12, 6, 0, -2, 23, 18, 16880 }, // ̋
+    { 10, 6, 0, -2, 23, 15, 16898 }, // ̌
+    { 5, 9, 0, 0, 23, 12, 16913 }, // ̍
+    { 9, 6, 0, -2, 23, 14, 16925 }, // ̎
+    { 11, 6, 0, -15, 23, 17, 16939 }, // ̏
+    { 10, 8, 0, -2, 25, 20, 16956 }, // ̐
+    { 9, 5, 0, -2, 22, 12, 16976 }, // ̑
+    { 6, 8, 0, -1, 21, 12, 16988 }, // ̒
+    { 6, 8, 0, -1, 21, 12, 17000 }, // ̓
+    { 4, 8, 0, 0, 21, 8, 17012 }, // ̔
+    { 6, 8, 0, -1, 21, 12, 17020 }, // ̕
+    { 6, 6, 0, -6, -1, 9, 17032 }, // ̖
+    { 7, 6, 0, -5, -1, 11, 17041 }, // ̗
+    { 6, 7, 0, -5, 0, 11, 17052 }, // ̘
+    { 7, 7, 0, -6, 0, 13, 17063 }, // ̙
+    { 10, 9, 10, 2, 23, 23, 17076 }, // ̚
+    { 8, 7, 0, -2, 23, 14, 17099 }, // ̛
+    { 5, 7, 0, -2, 0, 9, 17113 }, // ̜
+    { 7, 6, 0, -6, -1, 11, 17122 }, // ̝
+    { 8, 6, 0, -6, -1, 12, 17133 }, // ̞
+    { 7, 7, 0, -6, 0, 13, 17145 }, // ̟
+    { 7, 3, 0, -6, -3, 6, 17158 }, // ̠
+    { 7, 9, 0, -6, 2, 16, 17164 }, // ̡
+    { 6, 9, 0, -3, 2, 14, 17180 }, // ̢
+    { 4, 5, 0, -13, -1, 5, 17194 }, // ̣
+    { 9, 4, 0, -7, -2, 9, 17199 }, // ̤
+    { 7, 7, 0, -6, 0, 13, 17208 }, // ̥
+    { 5, 6, 0, 2, -1, 8, 17221 }, // ̦
+    { 6, 7, 0, -5, 0, 11, 17229 }, // ̧
+    { 6, 7, 0, -5, 0, 11, 17240 }, // ̨
+    { 5, 9, 0, -5, 0, 12, 17251 }, // ̩
+    { 12, 6, 0, -8, -1, 18, 17263 }, // ̪
+    { 12, 5, 0, -8, -1, 15, 17281 }, // ̫
+    { 10, 6, 0, -7, 0, 15, 17296 }, // ̬
+    { 10, 6, 0, -7, -1, 15, 17311 }, // ̭
+    { 9, 5, 0, -6, -1, 12, 17326 }, // ̮
+    { 9, 5, 0, -7, -1, 12, 17338 }, // ̯
+    { 11, 5, 0, -8, -1, 14, 17350 }, // ̰
+    { 9, 3, 0, -7, -2, 7, 17364 }, // ̱
+    { 13, 3, 0, -9, -2, 10, 17371 }, // ̲
+    { 14, 7, 0, -9, 0, 25, 17381 }, // ̳
+    { 12, 5, 0, -6, 10, 15, 17406 }, // ̴
+    { 12, 3, 0, -6, 10, 9, 17421 }, // ̵
+    { 20, 3, 0, -10, 10, 15, 17430 }, // ̶
+    { 10, 7, 0, -5, 12, 18, 17445 }, // ̷
+    { 16, 25, 0, -8, 23, 100, 17463 }, // ̸
+    { 5, 8, 0, -2, 1, 10, 17563 }, // ̹
+    { 12, 6, 0, -8, -1, 18, 17573 }, // ̺
+    { 12, 7, 0, -8, 0, 21, 17591 }, // ̻
+    { 12, 5, 0, -8, -1, 15, 17612 }, // ̼
+    { 8, 7, 0, -1, 23, 14, 17627 }, // ̽
+    { 7, 10, 0, -1, 26, 18, 17641 }, // ̾
+    { 14, 7, 0, -3, 29, 25, 17659 }, // ̿
+    { 6, 6, 0, -2, 23, 9, 17684 }, // ̀
+    { 7, 6, 0, 1, 23, 11, 17693 }, // ́
+    { 12, 5, 0, 4, 22, 15, 17704 }, // ͂
+    { 6, 6, 0, 0, 23, 9, 17719 }, // ̓
+    { 11, 6, 0, -3, 23, 17, 17728 }, // ̈́
+    { 5, 5, 0, -4, -2, 7, 17745 }, // ͅ
+    { 14, 6, 0, -4, 23, 21, 17752 }, // ͆
+    { 14, 7, 0, -9, 0, 25, 17773 }, // ͇
+    { 9, 6, 0, -7, 0, 14, 17798 }, // ͈
+    { 7, 6, 0, -5, -1, 11, 17812 }, // ͉
+    { 11, 7, 0, -3, 23, 20, 17823 }, // ͊
+    { 12, 11, 0, -3, 27, 33, 17843 }, // ͋
+    { 12, 8, 0, -3, 25, 24, 17876 }, // ͌
+    { 11, 6, 0, -8, -1, 17, 17900 }, // ͍
+    { 6, 7, 0, -5, 0, 11, 17917 }, // ͎
+    { 22, 21, 0, -11, 21, 116, 17928 }, // ͏
+    { 5, 7, 0, 0, 24, 9, 18044 }, // ͐
+    { 5, 7, 0, 3, 24, 9, 18053 }, // ͑
+    { 9, 8, 0, -2, 25, 18, 18062 }, // ͒
+    { 7, 7, 0, -5, 0, 13, 18080 }, // ͓
+    { 6, 6, 0, -5, -1, 9, 18093 }, // ͔
+    { 6, 6, 0, -4, -1, 9, 18102 }, // ͕
+    { 12, 6, 0, -7, -1, 18, 18111 }, // ͖
+    { 4, 8, 0, 3, 25, 8, 18129 }, // ͗
+    { 4, 4, 0, 1, 22, 4, 18137 }, // ͘
+    { 7, 6, 0, -6, -1, 11, 18141 }, // ͙
+    { 12, 7, 0, -8, 0, 21, 18152 }, // ͚
+    { 6, 6, 0, 0, 23, 9, 18173 }, // ͛
+    { 22, 6, 0, -13, -1, 33, 18182 }, // ͜
+    { 21, 6, 0, -8, 23, 32, 18215 }, // ͝
+    { 15, 3, 0, -5, 20, 12, 18247 }, // ͞
+    { 16, 3, 0, -10, -2, 12, 18259 }, // ͟
+    { 22, 5, 0, -8, 22, 28, 18271 }, // ͠
+    { 21, 6, 0, -8, 25, 32, 18299 }, // ͡
+    { 22, 6, 0, -14, -1, 33, 18331 }, // ͢
+    { 8, 8, 0, -1, 25, 16, 18364 }, // ͣ
+    { 6, 8, 0, 0, 25, 12, 18380 }, // ͤ
+    { 4, 9, 0, 1, 27, 9, 18392 }, // ͥ
+    { 7, 7, 0, -1, 25, 13, 18401 }, // ͦ
+    { 8, 8, 0, -1, 25, 16, 18414 }, // ͧ
+    { 6, 8, 0, 0, 25, 12, 18430 }, // ͨ
+    { 8, 10, 0, -1, 27, 20, 18442 }, // ͩ
+    { 7, 9, 0, -1, 27, 16, 18462 }, // ͪ
+    { 11, 7, 0, -3, 25, 20, 18478 }, // ͫ
+    { 6, 7, 0, 0, 25, 11, 18498 }, // ͬ
+    { 5, 9, 0, 1, 26, 12, 18509 }, // ͭ
+    { 7, 7, 0, 0, 25, 13, 18521 }, // ͮ
+    { 8, 7, 0, -1, 25, 14, 18534 }, // ͯ
+    { 16, 28, 15, 0, 28, 112, 18548 }, // Ѐ
+    { 16, 27, 15, 0, 27, 108, 0 }, // Ё
+    { 16, 22, 19, 2, 21, 88, 18660 }, // Ђ
+    { 16, 28, 14, 0, 28, 112, 18748 }, // Ѓ
+    { 18, 23, 17, 1, 22, 104, 18860 }, // Є
+    { 16, 23, 15, 0, 22, 92, 18964 }, // Ѕ
+    { 9, 21, 8, 0, 21, 48, 19056 }, // І
+    { 11, 27, 8, 0, 27, 75, 19104 }, // Ї
+    { 14, 27, 8, -5, 21, 95, 19179 }, // Ј
+    { 28, 22, 27, -2, 21, 154, 19274 }, // Љ
+    { 26, 21, 27, 0, 21, 137, 19428 }, // Њ
+    { 17, 21, 20, 2, 21, 90, 19565 }, // Ћ
+    { 19, 28, 16, 0, 28, 133, 19655 }, // Ќ
+    { 21, 28, 20, 0, 28, 147, 19788 }, // Ѝ
+    { 19, 28, 16, 0, 27, 133, 19935 }, // Ў
+    { 20, 26, 19, 0, 21, 130, 20068 }, // Џ
+    { 17, 21, 17, -2, 21, 90, 108 }, // А
+    { 17, 21, 16, 0, 21, 90, 198 }, // Б
+    { 17, 21, 17, 0, 21, 90, 288 }, // В
+    { 16, 21, 14, 0, 21, 84, 378 }, // Г
+    { 23, 26, 20, -3, 21, 150, 462 }, // Д
+    { 16, 21, 15, 0, 21, 84, 612 }, // Е
+    { 28, 21, 23, -2, 21, 147, 696 }, // Ж
+    { 16, 23, 15, -1, 22, 92, 843 }, // З
+    { 21, 21, 20, 0, 21, 111, 935 }, // И
+    { 21, 27, 20, 0, 27, 142, 1046 }, // Й
+    { 19, 21, 16, 0, 21, 100, 1188 }, // К
+    { 22, 22, 20, -2, 21, 121, 1288 }, // Л
+    { 25, 21, 24, 0, 21, 132, 1409 }, // М
+    { 20, 21, 20, 0, 21, 105, 1541 }, // Н
+    { 19, 23, 20, 1, 22, 110, 1646 }, // О
+    { 20, 21, 19, 0, 21, 105, 1756 }, // П
+    { 17, 21, 16, 0, 21, 90, 1861 }, // Р
+    { 18, 23, 17, 1, 22, 104, 1951 }, // С
+    { 16, 21, 15, 2, 21, 84, 2055 }, // Т
+    { 19, 22, 16, 0, 21, 105, 2139 }, // У
+    { 22, 23, 23, 1, 22, 127, 2244 }, // Ф
+    { 20, 21, 16, -2, 21, 105, 2371 }, // Х
+    { 20, 26, 20, 0, 21, 130, 2476 }, // Ц
+    { 17, 21, 18, 2, 21, 90, 2606 }, // Ч
+    { 28, 21, 28, 0, 21, 147, 2696 }, // Ш
+    { 28, 26, 28, 0, 21, 182, 2843 }, // Щ
+    { 16, 21, 19, 2, 21, 84, 3025 }, // Ъ
+    { 24, 21, 23, 0, 21, 126, 3109 }, // Ы
+    { 15, 21, 16, 0, 21, 79, 3235 }, // Ь
+    { 17, 23, 17, 0, 22, 98, 3314 }, // Э
+    { 27, 23, 27, 0, 22, 156, 3412 }, // Ю
+    { 19, 21, 17, -2, 21, 100, 3568 }, // Я
+    { 15, 17, 17, 1, 16, 64, 3668 }, // а
+    { 16, 24, 16, 1, 23, 96, 3732 }, // б
+    { 14, 17, 15, 1, 16, 60, 3828 }, // в
+    { 13, 17, 13, 0, 16, 56, 3888 }, // г
+    { 15, 24, 16, 1, 23, 90, 3944 }, // д
+    { 13, 17, 14, 1, 16, 56, 4034 }, // е
+    { 27, 17, 26, -1, 16, 115, 4090 }, // ж
+    { 13, 17, 13, 0, 16, 56, 4205 }, // з
+    { 15, 17, 17, 1, 16, 64, 4261 }, // и
+    { 15, 23, 17, 1, 22, 87, 4325 }, // й
+    { 16, 16, 15, 0, 16, 64, 4412 }, // к
+    { 18, 17, 17, -2, 16, 77, 4476 }, // л
+    { 22, 16, 22, 0, 16, 88, 4553 }, // м
+    { 16, 16, 17, 0, 16, 64, 4641 }, // н
+    { 15, 17, 16, 1, 16, 64, 4705 }, // о
+    { 15, 16, 16, 0, 16, 60, 4769 }, // п
+    { 17, 23, 17, -1, 16, 98, 4829 }, // р
+    { 13, 17, 13, 1, 16, 56, 4927 }, // с
+    { 24, 16, 25, 0, 16, 96, 4983 }, // т
+    { 19, 23, 14, -3, 16, 110, 5079 }, // у
+    { 18, 30, 20, 1, 23, 135, 5189 }, // ф
+    { 17, 16, 13, -2, 16, 68, 5324 }, // х
+    { 15, 21, 17, 1, 16, 79, 5392 }, // ц
+    { 14, 16, 16, 2, 16, 56, 5471 }, // ч
+    { 24, 17, 25, 1, 16, 102, 5527 }, // ш
+    { 24, 21, 26, 1, 16, 126, 5629 }, // щ
+    { 16, 17, 17, 1, 16, 68, 5755 }, // ъ
+    { 20, 17, 21, 1, 16, 85, 5823 }, // ы
+    { 13, 17, 15, 1, 16, 56, 5908 }, // ь
+    { 13, 17, 14, 0, 16, 56, 5964 }, // э
+    { 22, 17, 23, 0, 16, 94, 6020 }, // ю
+    { 16, 16, 15, -1, 16, 64, 6114 }, // я
+    { 13, 24, 14, 1, 23, 78, 20198 }, // ѐ
+    { 14, 23, 14, 1, 22, 81, 6178 }, // ё
+    { 16, 30, 17, 0, 23, 120, 20276 }, // ђ
+    { 14, 24, 13, 0, 23, 84, 20396 }, // ѓ
+    { 13, 17, 14, 1, 16, 56, 20480 }, // є
+    { 13, 17, 13, 0, 16, 56, 20536 }, // ѕ
+    { 8, 22, 8, 0, 22, 44, 20592 }, // і
+    { 10, 22, 7, 0, 22, 55, 20636 }, // ї
+    { 12, 29, 7, -4, 22, 87, 20691 }, // ј
+    { 25, 17, 24, -2, 16, 107, 20778 }, // љ
+    { 23, 17, 24, 0, 16, 98, 20885 }, // њ
+    { 16, 23, 17, 0, 23, 92, 20983 }, // ћ
+    { 16, 23, 15, 0, 23, 92, 21075 }, // ќ
+    { 15, 24, 17, 1, 23, 90, 21167 }, // ѝ
+    { 19, 29, 14, -3, 22, 138, 21257 }, // ў
+    { 15, 22, 17, 1, 16, 83, 21395 }, // џ
+    { 27, 22, 27, 2, 21, 149, 21478 }, // Ѡ
+    { 23, 16, 23, 1, 16, 92, 21627 }, // ѡ
+    { 14, 21, 17, 2, 21, 74, 21719 }, // Ѣ
+    { 23, 18, 24, 0, 17, 104, 21793 }, // ѣ
+    { 26, 23, 25, 1, 22, 150, 21897 }, // Ѥ
+    { 21, 17, 20, 0, 16, 90, 22047 }, // ѥ
+    { 19, 21, 18, -2, 21, 100, 22137 }, // Ѧ
+    { 16, 16, 16, -2, 16, 64, 22237 }, // ѧ
+    { 23, 21, 25, 1, 21, 121, 22301 }, // Ѩ
+    { 20, 16, 21, 0, 16, 80, 22422 }, // ѩ
+    { 23, 21, 19, -2, 21, 121, 22502 }, // Ѫ
+    { 19, 16, 18, -2, 16, 76, 22623 }, // ѫ
+    { 27, 21, 27, 1, 21, 142, 22699 }, // Ѭ
+    { 24, 16, 23, 0, 16, 96, 22841 }, // ѭ
+    { 18, 32, 16, -2, 25, 144, 22937 }, // Ѯ
+    { 16, 26, 13, -2, 20, 104, 23081 }, // ѯ
+    { 22, 21, 22, 3, 21, 116, 23185 }, // Ѱ
+    { 19, 30, 21, 1, 23, 143, 23301 }, // ѱ
+    { 19, 23, 21, 2, 22, 110, 23444 }, // Ѳ
+    { 15, 17, 16, 1, 16, 64, 23554 }, // ѳ
+    { 18, 21, 17, 2, 21, 95, 23618 }, // Ѵ
+    { 15, 16, 13, 1, 16, 60, 23713 }, // ѵ
+    { 18, 28, 17, 2, 28, 126, 23773 }, // Ѷ
+    { 15, 23, 13, 1, 23, 87, 23899 }, // ѷ
+    { 35, 29, 35, 2, 22, 254, 23986 }, // Ѹ
+    { 31, 23, 30, 1, 16, 179, 24240 }, // ѹ
+    { 19, 25, 22, 2, 23, 119, 24419 }, // Ѻ
+    { 15, 20, 17, 1, 18, 75, 24538 }, // ѻ
+    { 26, 32, 28, 2, 31, 208, 24613 }, // Ѽ
+    { 21, 27, 23, 1, 26, 142, 24821 }, // ѽ
+    { 27, 27, 27, 2, 26, 183, 24963 }, // Ѿ
+    { 23, 21, 23, 1, 21, 121, 25146 }, // ѿ
+    { 17, 29, 17, 2, 22, 124, 25267 }, // Ҁ
+    { 13, 23, 13, 1, 16, 75, 25391 }, // ҁ
+    { 16, 20, 18, 1, 19, 80, 25466 }, // ҂
+    { 12, 5, 0, -12, 21, 15, 25546 }, // ҃
+    { 12, 5, 0, -12, 22, 15, 25561 }, // ҄
+    { 4, 6, 0, -8, 23, 6, 25576 }, // ҅
+    { 4, 6, 0, -8, 23, 6, 25582 }, // ҆
+    { 12, 4, 0, -2, 26, 12, 25588 }, // ҇
+    { 34, 31, 0, -17, 23, 264, 25600 }, // ҈
+    { 34, 33, 0, -17, 24, 281, 25864 }, // ҉
+    { 20, 34, 21, 1, 28, 170, 26145 }, // Ҋ
+    { 16, 29, 17, 1, 23, 116, 26315 }, // ҋ
+    { 14, 21, 16, 1, 21, 74, 26431 }, // Ҍ
+    { 13, 24, 15, 1, 23, 78, 0 }, // ҍ
+    { 16, 21, 17, 1, 21, 84, 78 }, // Ҏ
+    { 17, 23, 17, -1, 16, 98, 162 }, // ҏ
+    { 16, 26, 14, 1, 26, 104, 260 }, // Ґ
+    { 14, 21, 11, 0, 21, 74, 364 }, // ґ
+    { 16, 21, 14, 1, 21, 84, 438 }, // Ғ
+    { 13, 16, 11, 0, 16, 52, 522 }, // ғ
+    { 16, 29, 18, 1, 21, 116, 574 }, // Ҕ
+    { 13, 24, 15, 0, 16, 78, 690 }, // ҕ
+    { 28, 27, 24, -2, 21, 189, 768 }, // Җ
+    { 27, 22, 25, -1, 16, 149, 957 }, // җ
+    { 16, 29, 15, -1, 22, 116, 1106 }, // Ҙ
+    { 13, 23, 13, 0, 16, 75, 1222 }, // ҙ
+    { 19, 27, 18, 1, 21, 129, 1297 }, // Қ
+    { 16, 22, 15, 0, 16, 88, 1426 }, // қ
+    { 19, 21, 17, 1, 21, 100, 1514 }, // Ҝ
+    { 16, 16, 14, 0, 16, 64, 1614 }, // ҝ
+    { 19, 21, 16, 1, 21, 100, 1678 }, // Ҟ
+    { 16, 23, 14, 0, 23, 92, 1778 }, // ҟ
+    { 20, 21, 19, 2, 21, 105, 1870 }, // Ҡ
+    { 17, 16, 17, 1, 16, 68, 1975 }, // ҡ
+    { 19, 27, 20, 1, 21, 129, 2043 }, // Ң
+    { 17, 22, 18, 0, 16, 94, 2172 }, // ң
+    { 24, 21, 22, 1, 21, 126, 2266 }, // Ҥ
+    { 22, 16, 20, 0, 16, 88, 2392 }, // ҥ
+    { 26, 29, 29, 1, 21, 189, 2480 }, // Ҧ
+    { 22, 24, 24, 0, 16, 132, 2669 }, // ҧ
+    { 18, 24, 21, 2, 22, 108, 2801 }, // Ҩ
+    { 16, 17, 18, 1, 16, 68, 2909 }, // ҩ
+    { 17, 29, 17, 2, 22, 124, 2977 }, // Ҫ
+    { 13, 23, 13, 1, 16, 75, 3101 }, // ҫ
+    { 16, 27, 15, 2, 21, 108, 3176 }, // Ҭ
+    { 25, 22, 26, 0, 16, 138, 3284 }, // ҭ
+    { 16, 21, 15, 2, 21, 84, 3422 }, // Ү
+    { 15, 23, 14, 1, 16, 87, 3506 }, // ү
+    { 17, 21, 15, 1, 21, 90, 3593 }, // Ұ
+    { 17, 23, 14, -1, 16, 98, 3683 }, // ұ
+    { 20, 27, 17, -2, 21, 135, 3781 }, // Ҳ
+    { 17, 22, 15, -1, 16, 94, 3916 }, // ҳ
+    { 21, 27, 23, 2, 21, 142, 4010 }, // Ҵ
+    { 18, 22, 19, 1, 16, 99, 4152 }, // ҵ
+    { 16, 27, 19, 3, 21, 108, 4251 }, // Ҷ
+    { 14, 22, 16, 2, 16, 77, 4359 }, // ҷ
+    { 16, 21, 19, 3, 21, 84, 4436 }, // Ҹ
+    { 14, 16, 16, 2, 16, 56, 4520 }, // ҹ
+    { 16, 21, 19, 1, 21, 84, 4576 }, // Һ
+    { 16, 23, 17, 0, 23, 92, 4660 }, // һ
+    { 22, 23, 22, 1, 22, 127, 4752 }, // Ҽ
+    { 16, 17, 17, 1, 16, 68, 4879 }, // ҽ
+    { 22, 28, 22, 1, 22, 154, 4947 }, // Ҿ
+    { 16, 22, 17, 1, 16, 88, 5101 }, // ҿ
+    { 13, 21, 9, -1, 21, 69, 5189 }, // Ӏ
+    { 28, 27, 23, -2, 27, 189, 5258 }, // Ӂ
+    { 27, 23, 26, -1, 22, 156, 5447 }, // ӂ
+    { 19, 29, 19, 1, 21, 138, 5603 }, // Ӄ
+    { 16, 24, 15, 0, 16, 96, 5741 }, // ӄ
+    { 21, 27, 19, -1, 21, 142, 5837 }, // Ӆ
+    { 17, 22, 16, -2, 16, 94, 5979 }, // ӆ
+    { 19, 29, 20, 1, 21, 138, 6073 }, // Ӈ
+    { 17, 24, 18, 0, 16, 102, 6211 }, // ӈ
+    { 19, 27, 20, 1, 21, 129, 6313 }, // Ӊ
+    { 17, 22, 18, 0, 16, 94, 6442 }, // ӊ
+    { 16, 27, 19, 3, 21, 108, 6536 }, // Ӌ
+    { 15, 22, 17, 2, 16, 83, 6644 }, // ӌ
+    { 24, 27, 25, 1, 21, 162, 6727 }, // Ӎ
+    { 20, 22, 20, 0, 16, 110, 6889 }, // ӎ
+    { 13, 21, 9, -1, 21, 69, 6999 }, // ӏ
+    { 19, 27, 16, -2, 27, 129, 7068 }, // Ӑ
+    { 16, 23, 17, 1, 22, 92, 7197 }, // ӑ
+    { 18, 27, 16, -2, 27, 122, 7289 }, // Ӓ
+    { 16, 23, 17, 1, 22, 92, 7411 }, // ӓ
+    { 28, 21, 24, -2, 21, 147, 7503 }, // Ӕ
+    { 23, 17, 24, 1, 16, 98, 7650 }, // ӕ
+    { 16, 27, 15, 1, 27, 108, 7748 }, // Ӗ
+    { 15, 23, 15, 1, 22, 87, 7856 }, // ӗ
+    { 18, 23, 19, 1, 22, 104, 7943 }, // Ә
+    { 14, 17, 14, 0, 16, 60, 8047 }, // ә
+    { 18, 28, 19, 1, 27, 126, 8107 }, // Ӛ
+    { 14, 23, 14, 0, 22, 81, 8233 }, // ӛ
+    { 28, 27, 23, -2, 27, 189, 8314 }, // Ӝ
+    { 27, 23, 26, -1, 22, 156, 8503 }, // ӝ
+    { 16, 28, 15, -1, 27, 112, 8659 }, // Ӟ
+    { 13, 23, 13, 0, 22, 75, 8771 }, // ӟ
+    { 16, 22, 15, 0, 21, 88, 8846 }, // Ӡ
+    { 16, 23, 14, -2, 16, 92, 8934 }, // ӡ
+    { 21, 25, 20, 0, 25, 132, 9026 }, // Ӣ
+    { 16, 21, 17, 1, 20, 84, 9158 }, // ӣ
+    { 21, 27, 20, 0, 27, 142, 9242 }, // Ӥ
+    { 16, 23, 17, 1, 22, 92, 9384 }, // ӥ
+    { 19, 28, 21, 2, 27, 133, 9476 }, // Ӧ
+    { 15, 23, 16, 1, 22, 87, 9609 }, // ӧ
+    { 19, 23, 21, 2, 22, 110, 9696 }, // Ө
+    { 15, 17, 16, 1, 16, 64, 9806 }, // ө
+    { 19, 28, 21, 2, 27, 133, 9870 }, // Ӫ
+    { 15, 23, 16, 1, 22, 87, 10003 }, // ӫ
+    { 17, 28, 17, 0, 27, 119, 10090 }, // Ӭ
+    { 13, 23, 14, 0, 22, 75, 10209 }, // ӭ
+    { 19, 26, 16, 0, 25, 124, 10284 }, // Ӯ
+    { 19, 27, 14, -3, 20, 129, 10408 }, // ӯ
+    { 19, 28, 16, 0, 27, 133, 10537 }, // Ӱ
+    { 19, 29, 14, -3, 22, 138, 10670 }, // ӱ
+    { 19, 29, 16, 0, 28, 138, 10808 }, // Ӳ
+    { 19, 30, 14, -3, 23, 143, 10946 }, // ӳ
+    { 17, 27, 18, 2, 27, 115, 11089 }, // Ӵ
+    { 14, 22, 16, 2, 22, 77, 11204 }, // ӵ
+    { 16, 27, 14, 1, 21, 108, 11281 }, // Ӷ
+    { 13, 22, 11, 0, 16, 72, 11389 }, // ӷ
+    { 24, 27, 23, 0, 27, 162, 11461 }, // Ӹ
+    { 20, 23, 21, 1, 22, 115, 11623 }, // ӹ
+    { 17, 27, 14, 0, 21, 115, 11738 }, // Ӻ
+    { 14, 22, 11, -1, 16, 77, 11853 }, // ӻ
+    { 20, 27, 15, -2, 21, 135, 11930 }, // Ӽ
+    { 17, 22, 14, -2, 16, 94, 12065 }, // ӽ
+    { 20, 21, 15, -2, 21, 105, 12159 }, // Ӿ
+    { 17, 16, 14, -2, 16, 68, 12264 }, // ӿ
+    { 0, 0, 15, 0, 0, 0, 12332 }, //  
+    { 0, 0, 29, 0, 0, 0, 12332 }, //  
+    { 0, 0, 15, 0, 0, 0, 12332 }, //  
+    { 0, 0, 29, 0, 0, 0, 12332 }, //  
+    { 0, 0, 10, 0, 0, 0, 12332 }, //  
+    { 0, 0, 7, 0, 0, 0, 12332 }, //  
+    { 0, 0, 5, 0, 0, 0, 12332 }, //  
+    { 0, 0, 16, 0, 0, 0, 12332 }, //  
+    { 0, 0, 7, 0, 0, 0, 12332 }, //  
+    { 0, 0, 5, 0, 0, 0, 12332 }, //  
+    { 0, 0, 3, 0, 0, 0, 12332 }, //  
+    { 0, 0, 0, 0, 0, 0, 12332 }, // ​
+    { 0, 0, 0, 0, 0, 0, 12332 }, // ‌
+    { 0, 0, 0, 0, 0, 0, 12332 }, // ‍
+    { 8, 25, 0, -1, 21, 50, 12332 }, // ‎
+    { 8, 25, 0, -7, 21, 50, 12382 }, // ‏
+    { 9, 3, 9, 0, 9, 7, 12432 }, // ‐
+    { 9, 3, 9, 0, 9, 7, 12439 }, // ‑
+    { 15, 3, 16, 1, 12, 12, 12446 }, // ‒
+    { 14, 4, 14, 0, 10, 14, 11915 }, // –
+    { 28, 4, 28, 0, 10, 28, 11929 }, // —
+    { 28, 4, 28, 0, 10, 28, 12458 }, // ―
+    { 9, 31, 16, 4, 23, 70, 12486 }, // ‖
+    { 13, 7, 12, -3, 0, 23, 12556 }, // ‗
+    { 7, 8, 5, 1, 21, 14, 11957 }, // ‘
+    { 7, 8, 5, 1, 21, 14, 11971 }, // ’
+    { 7, 8, 7, -2, 4, 14, 12579 }, // ‚
+    { 4, 8, 5, 3, 21, 8, 12593 }, // ‛
+    { 12, 8, 10, 1, 21, 24, 11985 }, // “
+    { 12, 8, 10, 1, 21, 24, 12009 }, // ”
+    { 12, 8, 12, -2, 4, 24, 12601 }, // „
+    { 9, 8, 10, 3, 21, 18, 12625 }, // ‟
+    { 11, 23, 14, 3, 23, 64, 12643 }, // †
+    { 15, 23, 14, 0, 23, 87, 12707 }, // ‡
+    { 8, 8, 11, 2, 15, 16, 12794 }, // •
+    { 10, 10, 11, 1, 16, 25, 12810 }, // ‣
+    { 4, 5, 15, 4, 4, 5, 12835 }, // ․
+    { 12, 5, 15, 0, 4, 15, 12840 }, // ‥
+    { 20, 5, 22, 0, 4, 25, 12033 }, // …
+    { 5, 5, 7, 1, 10, 7, 12855 }, // ‧
+    { 0, 0, 18, 0, 0, 0, 12862 }, //  
+    { 0, 0, 18, 0, 0, 0, 12862 }, //  
+    { 8, 22, 0, -1, 18, 44, 12862 }, // ‪
+    { 8, 22, 0, -7, 18, 44, 12906 }, // ‫
+    { 8, 25, 0, -4, 21, 50, 12950 }, // ‬
+    { 8, 25, 0, -4, 21, 50, 13000 }, // ‭
+    { 8, 25, 0, -4, 21, 50, 13050 }, // ‮
+    { 0, 0, 5, 0, 0, 0, 13100 }, //  
+    { 30, 23, 33, 2, 22, 173, 13100 }, // ‰
+    { 40, 23, 42, 2, 22, 230, 13273 }, // ‱
+    { 8, 8, 6, 1, 21, 16, 13503 }, // ′
+    { 13, 8, 11, 1, 21, 26, 13519 }, // ″
+    { 18, 8, 16, 1, 21, 36, 13545 }, // ‴
+    { 5, 8, 8, 3, 21, 10, 13581 }, // ‵
+    { 10, 8, 12, 3, 21, 20, 13591 }, // ‶
+    { 14, 8, 17, 3, 21, 28, 13611 }, // ‷
+    { 11, 10, 12, -3, 3, 28, 13639 }, // ‸
+    { 8, 13, 8, 1, 14, 26, 13667 }, // ‹
+    { 8, 13, 8, 0, 14, 26, 13693 }, // ›
+    { 22, 23, 24, 1, 22, 127, 13719 }, // ※
+    { 15, 22, 14, 0, 21, 83, 13846 }, // ‼
+    { 12, 23, 13, 2, 22, 69, 13929 }, // ‽
+    { 13, 3, 11, 2, 25, 10, 13998 }, // ‾
+    { 16, 7, 16, -2, 0, 28, 14008 }, // ‿
+    { 16, 7, 16, 2, 24, 28, 14036 }, // ⁀
+    { 14, 19, 10, -3, 12, 67, 14064 }, // ⁁
+    { 31, 27, 33, 0, 23, 210, 14131 }, // ⁂
+    { 8, 3, 8, 0, 9, 6, 14341 }, // ⁃
+    { 18, 21, 4, -7, 21, 95, 14347 }, // ⁄
+    { 12, 26, 8, -1, 21, 78, 14442 }, // ⁅
+    { 12, 26, 8, -3, 21, 78, 14520 }, // ⁆
+    { 24, 23, 25, 2, 22, 138, 14598 }, // ⁇
+    { 19, 23, 20, 2, 22, 110, 14736 }, // ⁈
+    { 21, 23, 20, 0, 22, 121, 14846 }, // ⁉
+    { 15, 16, 15, 1, 16, 60, 14967 }, // ⁊
+    { 15, 27, 17, 3, 23, 102, 15027 }, // ⁋
+    { 16, 15, 19, 1, 16, 60, 15129 }, // ⁌
+    { 16, 15, 19, 2, 16, 60, 15189 }, // ⁍
+    { 15, 15, 16, -1, 8, 57, 15249 }, // ⁎
+    { 7, 21, 7, 0, 17, 37, 15306 }, // ⁏
+    { 20, 31, 16, -2, 24, 155, 15343 }, // ⁐
+    { 17, 30, 16, 0, 23, 128, 15498 }, // ⁑
+    { 11, 23, 11, 0, 22, 64, 15626 }, // ⁒
+    { 26, 5, 29, 2, 11, 33, 15690 }, // ⁓
+    { 16, 7, 16, -3, 0, 28, 15723 }, // ⁔
+    { 16, 16, 17, 0, 15, 64, 15751 }, // ⁕
+    { 13, 23, 15, 1, 22, 75, 15815 }, // ⁖
+    { 23, 8, 21, 1, 21, 46, 15890 }, // ⁗
+    { 22, 23, 24, 1, 22, 127, 15936 }, // ⁘
+    { 22, 23, 24, 1, 22, 127, 16063 }, // ⁙
+    { 4, 23, 6, 1, 22, 23, 16190 }, // ⁚
+    { 17, 23, 19, 1, 22, 98, 16213 }, // ⁛
+    { 22, 23, 23, 1, 22, 127, 16311 }, // ⁜
+    { 4, 22, 8, 2, 21, 22, 16438 }, // ⁝
+    { 5, 23, 8, 2, 22, 29, 16460 }, // ⁞
+    { 0, 0, 6, 0, 0, 0, 16489 }, //  
+    { 0, 0, 18, 0, 0, 0, 16489 }, // ⁠
+    { 0, 0, 18, 0, 0, 0, 16489 }, // ⁡
+    { 0, 0, 18, 0, 0, 0, 16489 }, // ⁢
+    { 0, 0, 18, 0, 0, 0, 16489 }, // ⁣
+    { 0, 0, 18, 0, 0, 0, 16489 }, // ⁤
+    { 0, 0, 18, 0, 0, 0, 16489 }, // ⁦
+    { 0, 0, 18, 0, 0, 0, 16489 }, // ⁧
+    { 0, 0, 18, 0, 0, 0, 16489 }, // ⁨
+    { 0, 0, 18, 0, 0, 0, 16489 }, // ⁩
+    { 8, 25, 0, -4, 21, 50, 16489 }, // ⁪
+    { 8, 25, 0, -4, 21, 50, 16539 }, // ⁫
+    { 8, 25, 0, -4, 21, 50, 16589 }, // ⁬
+    { 8, 25, 0, -4, 21, 50, 16639 }, // ⁭
+    { 8, 25, 0, -4, 21, 50, 16689 }, // ⁮
+    { 8, 25, 0, -4, 21, 50, 16739 }, // ⁯
+    { 10, 14, 10, 2, 25, 35, 16789 }, // ⁰
+    { 5, 14, 7, 2, 22, 18, 16824 }, // ⁱ
+    { 10, 13, 10, 2, 25, 33, 16842 }, // ⁴
+    { 10, 14, 10, 2, 25, 35, 16875 }, // ⁵
+    { 10, 14, 10, 3, 25, 35, 16910 }, // ⁶
+    { 10, 13, 10, 3, 25, 33, 16945 }, // ⁷
+    { 10, 14, 10, 2, 25, 35, 16978 }, // ⁸
+    { 10, 14, 10, 2, 25, 35, 17013 }, // ⁹
+    { 8, 9, 10, 3, 22, 18, 17048 }, // ⁺
+    { 8, 3, 10, 3, 19, 6, 17066 }, // ⁻
+    { 8, 6, 10, 3, 21, 12, 17072 }, // ⁼
+    { 7, 17, 5, 3, 27, 30, 17084 }, // ⁽
+    { 7, 17, 5, 0, 27, 30, 17114 }, // ⁾
+    { 10, 10, 11, 2, 18, 25, 17144 }, // ⁿ
+    { 10, 14, 10, -1, 9, 35, 17169 }, // ₀
+    { 7, 13, 10, 0, 9, 23, 17204 }, // ₁
+    { 11, 13, 10, -2, 9, 36, 17227 }, // ₂
+    { 11, 14, 10, -2, 9, 39, 17263 }, // ₃
+    { 10, 13, 10, -1, 9, 33, 17302 }, // ₄
+    { 10, 14, 10, -1, 9, 35, 17335 }, // ₅
+    { 10, 14, 10, -1, 9, 35, 17370 }, // ₆
+    { 11, 13, 10, -1, 9, 36, 17405 }, // ₇
+    { 10, 14, 10, -1, 9, 35, 17441 }, // ₈
+    { 10, 14, 10, -1, 9, 35, 17476 }, // ₉
+    { 9, 9, 10, -1, 6, 21, 17511 }, // ₊
+    { 9, 3, 10, -1, 4, 7, 17532 }, // ₋
+    { 9, 6, 10, -1, 5, 14, 17539 }, // ₌
+    { 7, 17, 5, 0, 11, 30, 17553 }, // ₍
+    { 8, 17, 5, -4, 11, 34, 17583 }, // ₎
+    { 10, 10, 11, -1, 7, 25, 17617 }, // ₐ
+    { 9, 10, 9, -1, 7, 23, 17642 }, // ₑ
+    { 10, 10, 11, -1, 7, 25, 17665 }, // ₒ
+    { 12, 10, 9, -3, 7, 30, 17690 }, // ₓ
+    { 9, 10, 9, -2, 7, 23, 17720 }, // ₔ
+    { 10, 14, 13, 0, 11, 35, 17743 }, // ₕ
+    { 10, 14, 10, 0, 11, 35, 17778 }, // ₖ
+    { 5, 14, 7, 0, 11, 18, 17813 }, // ₗ
+    { 16, 10, 18, 0, 7, 40, 17831 }, // ₘ
+    { 11, 10, 11, -2, 7, 28, 17871 }, // ₙ
+    { 11, 14, 11, -2, 7, 39, 17899 }, // ₚ
+    { 8, 10, 9, -1, 7, 20, 17938 }, // ₛ
+    { 7, 12, 6, -1, 9, 21, 17958 }, // ₜ
+    { 15, 22, 16, 2, 22, 83, 17979 }, // ₠
+    { 17, 25, 16, 1, 23, 107, 18062 }, // ₡
+    { 16, 23, 16, 1, 22, 92, 18169 }, // ₢
+    { 17, 21, 16, 0, 21, 90, 18261 }, // ₣
+    { 18, 22, 16, -1, 22, 99, 18351 }, // ₤
+    { 24, 24, 26, 0, 20, 144, 18450 }, // ₥
+    { 17, 21, 16, 0, 21, 90, 18594 }, // ₦
+    { 21, 22, 22, 0, 21, 116, 18684 }, // ₧
+    { 24, 22, 23, 0, 21, 132, 18800 }, // ₨
+    { 21, 21, 18, 0, 21, 111, 18932 }, // ₩
+    { 24, 21, 23, 0, 21, 126, 19043 }, // ₪
+    { 19, 28, 17, 0, 23, 133, 19169 }, // ₫
+    { 18, 23, 16, 0, 22, 104, 19302 }, // €
+    { 19, 21, 16, 0, 21, 100, 19406 }, // ₭
+    { 17, 21, 15, 1, 21, 90, 19506 }, // ₮
+    { 28, 29, 28, 0, 22, 203, 19596 }, // ₯
+    { 19, 29, 16, -2, 22, 138, 19799 }, // ₰
+    { 17, 21, 16, 1, 21, 90, 19937 }, // ₱
+    { 18, 26, 20, 2, 23, 117, 20027 }, // ₲
+    { 20, 21, 16, -2, 21, 105, 20144 }, // ₳
+    { 18, 23, 15, -1, 22, 104, 20249 }, // ₴
+    { 17, 26, 17, 2, 23, 111, 20353 }, // ₵
+    { 18, 21, 17, 0, 20, 95, 20464 }, // ₶
+    { 21, 25, 19, -1, 22, 132, 20559 }, // ₷
+    { 16, 21, 14, 1, 21, 84, 20691 }, // ₸
+    { 15, 21, 16, 2, 21, 79, 20775 }, // ₹
+    { 16, 22, 16, 0, 21, 88, 20854 }, // ₺
+    { 19, 23, 20, 1, 22, 110, 20942 }, // ₻
+    { 22, 21, 22, -1, 21, 116, 21052 }, // ₼
+    { 19, 21, 17, -1, 21, 100, 21168 }, // ₽
+    { 20, 24, 17, -1, 24, 120, 21268 }, // ₾
+    { 16, 27, 16, 1, 24, 108, 21388 }, // ₿
+    { 9, 3, 9, 0, 9, 7, 21496 }, // −
+    { 27, 30, 19, -4, 23, 203, 21503 }, // ﬀ
+    { 22, 30, 17, -4, 23, 165, 21706 }, // ﬁ
+    { 22, 30, 17, -4, 23, 165, 21871 }, // ﬂ
+    { 31, 30, 26, -4, 23, 233, 22036 }, // ﬃ
+    { 31, 30, 26, -4, 23, 233, 22269 }, // ﬄ
+    { 23, 30, 18, -4, 23, 173, 22502 }, // ﬅ
+    { 24, 24, 22, 0, 23, 144, 22675 }, // ﬆ
+    { 27, 28, 29, 1, 23, 189, 22819 }, // �
 };
 
 static const EpdUnicodeInterval notosans_14_italicIntervals[] = {
@@ -2848,31 +2872,302 @@ static const EpdUnicodeInterval notosans_14_italicIntervals[] = {
     { 0x2090, 0x209C, 0x33D },
     { 0x20A0, 0x20BF, 0x34A },
     { 0x2212, 0x2212, 0x36A },
-    { 0xFFFD, 0xFFFD, 0x36B },
+    { 0xFB00, 0xFB06, 0x36B },
+    { 0xFFFD, 0xFFFD, 0x372 },
 };
 
 static const EpdFontGroup notosans_14_italicGroups[] = {
-    { 0, 3739, 7068, 97, 0 },
-    { 3739, 3764, 8416, 96, 97 },
-    { 7503, 4981, 13195, 128, 193 },
-    { 12484, 1325, 1784, 112, 321 },
-    { 13809, 11840, 26548, 256, 433 },
-    { 25649, 2259, 4600, 111, 689 },
-    { 27908, 905, 1190, 42, 800 },
-    { 28813, 2148, 3517, 32, 842 },
-    { 30961, 9, 7, 1, 874 },
-    { 30970, 112, 189, 1, 875 },
+    { 0, 5295, 12058, 151, 2 },
+    { 5295, 3306, 6259, 66, 434 },
+    { 8601, 11747, 26505, 364, 0 },
+    { 20348, 11012, 23008, 302, 574 },
+};
+
+static const uint8_t notosans_14_italicGlyphGroups[883] = {
+    2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2,
+    2, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 2, 2,
+    2, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 0, 0, 3, 3, 3, 0, 0, 3, 3, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+};
+
+static const uint8_t notosans_14_italicKernLeftClasses[883] = {
+    0, 0, 71, 0, 2, 0, 0, 0, 60, 2, 20, 0, 0, 0, 7, 24,
+    7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 14, 47, 40, 15, 32, 63, 0, 0, 0, 0, 40, 22, 0,
+    0, 15, 46, 15, 0, 0, 11, 47, 37, 37, 40, 17, 65, 20, 0, 0,
+    0, 70, 0, 0, 30, 76, 0, 30, 59, 0, 0, 0, 0, 62, 0, 0,
+    0, 30, 30, 0, 27, 0, 58, 0, 36, 36, 62, 36, 0, 20, 0, 0,
+    0, 0, 68, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 0, 0, 0,
+    61, 14, 14, 14, 14, 14, 14, 32, 40, 32, 32, 32, 32, 0, 0, 0,
+    0, 15, 0, 15, 15, 15, 15, 15, 0, 15, 47, 47, 47, 47, 17, 46,
+    0, 0, 0, 0, 0, 0, 0, 30, 0, 30, 30, 30, 30, 0, 0, 0,
+    72, 30, 0, 30, 30, 30, 30, 30, 0, 30, 0, 0, 0, 0, 36, 30,
+    36, 14, 0, 14, 0, 14, 0, 40, 0, 40, 0, 40, 0, 40, 0, 15,
+    41, 15, 0, 32, 30, 32, 30, 32, 30, 32, 30, 32, 30, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 0, 72, 0, 0, 77,
+    0, 0, 0, 0, 0, 0, 0, 40, 62, 62, 22, 0, 22, 0, 22, 41,
+    22, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 30, 15,
+    30, 15, 30, 32, 30, 0, 27, 0, 27, 0, 27, 0, 0, 0, 0, 0,
+    0, 0, 0, 11, 58, 11, 67, 11, 58, 47, 0, 47, 0, 47, 0, 47,
+    0, 47, 0, 47, 0, 37, 36, 17, 36, 17, 65, 0, 65, 0, 65, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 13, 9, 26, 75, 0, 0, 73, 13, 13, 51, 8, 0, 1,
+    0, 6, 56, 44, 9, 4, 0, 8, 44, 0, 0, 8, 0, 0, 0, 12,
+    0, 28, 26, 9, 1, 45, 8, 4, 0, 0, 4, 13, 0, 13, 12, 12,
+    0, 42, 52, 31, 39, 38, 39, 19, 31, 42, 42, 49, 42, 42, 42, 3,
+    35, 3, 19, 35, 18, 3, 49, 23, 42, 42, 23, 5, 42, 5, 3, 3,
+    42, 39, 39, 50, 39, 19, 66, 0, 57, 69, 5, 5, 35, 49, 42, 18,
+    42, 1, 55, 43, 5, 26, 0, 6, 34, 6, 34, 0, 0, 0, 0, 44,
+    31, 0, 0, 12, 3, 1, 55, 1, 55, 18, 18, 12, 3, 12, 3, 1,
+    55, 26, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 38, 43, 5, 28,
+    3, 10, 53, 16, 54, 0, 29, 21, 0, 44, 31, 21, 0, 8, 19, 8,
+    19, 8, 19, 4, 38, 16, 53, 0, 29, 0, 3, 26, 0, 10, 38, 25,
+    47, 25, 47, 21, 0, 4, 38, 4, 38, 0, 0, 0, 29, 42, 39, 42,
+    39, 0, 8, 19, 0, 19, 4, 38, 0, 0, 4, 38, 0, 0, 4, 38,
+    0, 6, 0, 6, 0, 0, 39, 0, 39, 12, 3, 12, 3, 8, 19, 44,
+    31, 0, 0, 0, 0, 0, 0, 12, 3, 12, 3, 12, 3, 12, 3, 1,
+    18, 1, 18, 1, 18, 0, 42, 10, 53, 0, 42, 16, 54, 21, 0, 8,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 24, 24, 24, 0, 0, 2, 2, 7, 0, 2, 2, 7,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 33, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 74, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 78, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 59, 0, 0, 0, 0,
+    0, 0, 0,
+};
+
+static const uint8_t notosans_14_italicKernRightClasses[883] = {
+    0, 0, 0, 69, 9, 0, 0, 0, 65, 9, 0, 29, 0, 0, 3, 24,
+    3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 26, 0, 0,
+    0, 58, 0, 10, 0, 4, 0, 0, 0, 4, 0, 0, 41, 0, 0, 0,
+    0, 4, 0, 4, 0, 0, 19, 49, 39, 39, 62, 27, 0, 0, 0, 29,
+    0, 0, 0, 18, 0, 1, 1, 1, 64, 22, 0, 0, 64, 0, 0, 11,
+    11, 1, 11, 1, 11, 22, 0, 11, 20, 20, 0, 20, 53, 0, 0, 29,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 47, 0, 0, 0,
+    0, 10, 10, 10, 10, 10, 10, 71, 4, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4, 4, 4, 4, 4, 0, 4, 49, 49, 49, 49, 27, 0,
+    64, 1, 18, 18, 18, 18, 18, 18, 1, 1, 1, 1, 1, 0, 0, 0,
+    0, 0, 11, 1, 1, 1, 1, 1, 0, 1, 11, 11, 11, 11, 20, 0,
+    20, 10, 18, 10, 18, 10, 18, 4, 1, 4, 1, 4, 1, 4, 1, 0,
+    1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 4, 22, 4,
+    22, 4, 22, 4, 22, 0, 0, 0, 69, 0, 63, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 64, 0, 0, 11, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 11, 0, 11, 0, 11, 0, 0, 11, 4, 1, 4,
+    1, 4, 1, 4, 1, 0, 11, 0, 11, 0, 0, 0, 22, 0, 22, 0,
+    22, 0, 22, 19, 0, 19, 0, 19, 0, 49, 11, 49, 11, 49, 11, 49,
+    11, 49, 11, 49, 11, 39, 20, 27, 20, 27, 0, 53, 0, 53, 0, 53,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 2, 0, 34, 70, 0, 0, 32, 30, 0, 2, 0, 0, 15,
+    0, 13, 0, 0, 0, 45, 0, 17, 42, 0, 0, 0, 30, 0, 0, 34,
+    0, 0, 34, 2, 15, 46, 17, 0, 5, 0, 0, 2, 0, 0, 42, 0,
+    67, 14, 68, 14, 35, 54, 14, 21, 35, 56, 56, 26, 36, 26, 26, 14,
+    26, 26, 14, 26, 8, 14, 61, 56, 6, 56, 56, 16, 56, 56, 21, 26,
+    66, 14, 14, 31, 35, 14, 60, 0, 59, 48, 36, 26, 31, 26, 56, 8,
+    56, 43, 40, 51, 0, 0, 23, 13, 33, 0, 23, 0, 0, 0, 23, 42,
+    35, 5, 23, 12, 7, 43, 40, 43, 40, 12, 7, 12, 7, 12, 7, 43,
+    40, 12, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 23, 51, 31, 0,
+    23, 0, 23, 51, 0, 0, 23, 17, 35, 42, 35, 0, 23, 0, 23, 51,
+    31, 44, 16, 0, 23, 0, 23, 0, 23, 12, 7, 12, 7, 2, 23, 50,
+    57, 50, 57, 17, 21, 44, 16, 5, 6, 5, 6, 0, 23, 37, 38, 37,
+    38, 0, 17, 21, 0, 23, 52, 33, 0, 23, 0, 23, 5, 6, 0, 23,
+    0, 13, 55, 13, 55, 13, 55, 0, 7, 51, 35, 51, 35, 17, 21, 42,
+    35, 0, 0, 0, 23, 0, 23, 12, 7, 12, 7, 12, 7, 42, 21, 15,
+    8, 15, 8, 15, 8, 5, 6, 0, 23, 0, 56, 51, 0, 17, 21, 17,
+    21, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 24, 24, 24, 0, 0, 25, 9, 3, 0, 25, 9, 3,
+    0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28, 47, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 72, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 73, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 0, 0, 0, 0,
+    0, 0, 0,
+};
+
+static const int8_t notosans_14_italicKernMatrix[5846] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, 0, -1, -1, 0, 0, 0, 0, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, -2, 1, 0, -1, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, -2, -1, -1, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 1, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0,
+    0, -2, 1, 0, 0, 1, 0, -2, 1, 0, -2, -1, 0, -2, 0, 1, 0, 1, -1, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 1, 0, -2, 0, 0, -1, 0, 0, 1, 0, 0, 1, 0, 0, -2, 0, 0, 0, 0, 0, 0, -2, 0, 0, -1, 0, 0, 0, 1, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, -2, -1, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 4, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -3, 0, 0, -4, -2, 0, -2, -2, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, -3, -2, 0, -1, -2, 0, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 1, 0, 1, 0, -1, 0, 1, -1, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, -1, -2, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2, 0, 0, 0, -2, -2, 0, -1, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 1, 0, 0, 1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, -2, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, 1, -2, 1, 0, 0, -1, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 1, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, 0, -1, -2, -1, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0, -2, 0, 0, 0, 0, -2, 0, -1, 0, -1, -2, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, -2, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -2, 0, -1, 0, -2, 0, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, -1, 0, -2, -1, 0, -1, -2, 0, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, -1, 0, 0, -1, -1, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, -2, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0,
+    0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 3, 0, 0, 0, 0, 0, 0, 0, 0, 3, 1, 0, 0, 1, -1, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 1, 0, 0, -1, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 1, 1, 0, 4, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, 0, -1, -1, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, -4, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -4, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -2, 0, -1, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, -1, -1, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, -1, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -4, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -3, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, -2, -1, 0, 0, -2, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -1, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+};
+
+static const EpdLigaturePair notosans_14_italicLigatures[] = {
+    { 0x66, 0x66, 0xFB00 },
+    { 0x66, 0x69, 0xFB01 },
+    { 0x66, 0x6C, 0xFB02 },
+    { 0xFB00, 0x69, 0xFB03 },
+    { 0xFB00, 0x6C, 0xFB04 },
+};
+
+static const uint16_t notosans_14_italicGlyphLookup[368] = {
+    0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0001, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, 0x0010, 0x0011,
+    0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, 0x0020, 0x0021,
+    0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, 0x0030, 0x0031,
+    0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, 0x0040, 0x0041,
+    0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051,
+    0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, 0x0060, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070,
+    0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, 0x0080,
+    0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F, 0x0090,
+    0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F, 0x00A0,
+    0x00A1, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF, 0x00B0,
+    0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF, 0x00C0,
+    0x02B1, 0x02B2, 0x02B3, 0x02B4, 0x02B5, 0x02B6, 0x02B7, 0x02B8, 0x02B9, 0x02BA, 0x02BB, 0x02BC, 0x02BD, 0x02BE, 0x02BF, 0x02C0,
+    0x02C1, 0x02C2, 0x02C3, 0x02C4, 0x02C5, 0x02C6, 0x02C7, 0x02C8, 0x02C9, 0x02CA, 0x02CB, 0x02CC, 0x02CD, 0x02CE, 0x02CF, 0x02D0,
+    0x02D1, 0x02D2, 0x02D3, 0x02D4, 0x02D5, 0x02D6, 0x02D7, 0x02D8, 0x02D9, 0x02DA, 0x02DB, 0x02DC, 0x02DD, 0x02DE, 0x02DF, 0x02E0,
+    0x02E1, 0x02E2, 0x02E3, 0x02E4, 0x02E5, 0x02E6, 0x02E7, 0x02E8, 0x02E9, 0x02EA, 0x02EB, 0x02EC, 0x02ED, 0x02EE, 0x02EF, 0x02F0,
+    0x02F1, 0x02F2, 0x02F3, 0x02F4, 0x02F5, 0x02F6, 0x02F7, 0x02F8, 0x02F9, 0x02FA, 0x02FB, 0x02FC, 0x02FD, 0x02FE, 0x02FF, 0x0300,
+    0x0301, 0x0302, 0x0303, 0x0304, 0x0305, 0x0306, 0x0307, 0x0308, 0x0309, 0x030A, 0x030B, 0x030C, 0x030D, 0x030E, 0x030F, 0x0310,
+    0x0311, 0x0312, 0x0313, 0x0314, 0x0315, 0xFFFF, 0x0316, 0x0317, 0x0318, 0x0319, 0x031A, 0x031B, 0x031C, 0x031D, 0x031E, 0x031F,
 };
 
 static const EpdFontData notosans_14_italic = {
     notosans_14_italicBitmaps,
     notosans_14_italicGlyphs,
     notosans_14_italicIntervals,
-    15,
+    16,
     40,
     32,
     -9,
     true,
     notosans_14_italicGroups,
-    10,
+    4,
+    notosans_14_italicKernLeftClasses,
+    notosans_14_italicKernRightClasses,
+    notosans_14_italicKernMatrix,
+    74,
+    notosans_14_italicLigatures,
+    5,
+    0x4000000001ull,
+    notosans_14_italicGlyphLookup,
+    notosans_14_italicGlyphGroups,
+    false,
+    nullptr,
 };
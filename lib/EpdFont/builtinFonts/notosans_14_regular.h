@@ -3,1731 +3,1730 @@
  * name: notosans_14_regular
  * size: 14
  * mode: 2-bit  compressed: true
- * Command used: fontconvert.py notosans_14_regular 14 ../builtinFonts/source/NotoSans/NotoSans-Regular.ttf --2bit --compress
+ * Command used: fontconvert.py notosans_14_regular 14 ../builtinFonts/source/NotoSans/NotoSans-Regular.ttf --2bit --compress --frequency-corpus ../../../test/hyphenation_eval/resources/english_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/french_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/german_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/italian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/russian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/spanish_hyphenation_tests.txt
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t notosans_14_regularBitmaps[27503] = {
-    0xBD, 0x58, 0x3D, 0x8C, 0xDC, 0xC6, 0x15, 0x7E, 0xE4, 0x44, 0x26, 0x12, 0x02, 0x99, 0x14, 0x52,
-    0x2C, 0x44, 0xB0, 0xD8, 0xC6, 0x82, 0xEF, 0x58, 0x07, 0x58, 0xFE, 0xC8, 0x02, 0xEC, 0x42, 0x85,
-    0xAE, 0xD0, 0xCA, 0x40, 0xAE, 0x48, 0x0A, 0x15, 0x46, 0x02, 0xE4, 0x5A, 0x17, 0xFB, 0x43, 0xDB,
-    0x85, 0x0B, 0x15, 0x3E, 0x03, 0x49, 0xE5, 0x22, 0x2A, 0x94, 0xC4, 0xB9, 0x14, 0x4A, 0xA1, 0x00,
-    0x17, 0x80, 0x7B, 0x1C, 0x49, 0x85, 0x0B, 0x17, 0x47, 0xF9, 0xA0, 0xA4, 0x50, 0x21, 0xC2, 0x77,
-    0x8A, 0x61, 0xBB, 0x10, 0x6D, 0x51, 0x11, 0x4F, 0xE2, 0x72, 0xF2, 0xBD, 0xE1, 0x9E, 0xEE, 0xA4,
-    0x93, 0xCF, 0x0A, 0x10, 0x64, 0x77, 0xB9, 0xF3, 0xC3, 0x99, 0xC7, 0x37, 0xEF, 0x7D, 0xEF, 0x8F,
-    0x93, 0xC9, 0x64, 0x38, 0x1C, 0x0C, 0x06, 0xBD, 0xEE, 0x43, 0x74, 0x78, 0xAD, 0x9D, 0x1C, 0x0E,
-    0xDD, 0xF5, 0x77, 0xEE, 0xE5, 0x69, 0x35, 0x1F, 0x38, 0x17, 0x4E, 0x7E, 0xA6, 0xDE, 0xFA, 0xE5,
-    0xF7, 0xC9, 0x56, 0x2F, 0x11, 0x49, 0xBA, 0x42, 0xD4, 0x13, 0x8A, 0xAC, 0x42, 0x12, 0xB9, 0xC9,
-    0x5B, 0x44, 0x81, 0x55, 0xD0, 0xCA, 0xC3, 0xCB, 0x5F, 0x0A, 0xAD, 0x75, 0x73, 0x68, 0xA9, 0x7F,
-    0x7F, 0x81, 0x56, 0x1D, 0x45, 0x76, 0x7E, 0x7C, 0x77, 0xB9, 0x85, 0x7B, 0xDA, 0x2C, 0xA0, 0x39,
-    0x2C, 0xA7, 0xD2, 0x8D, 0x49, 0xA8, 0x1E, 0x2F, 0x28, 0x89, 0xDE, 0xDA, 0x59, 0x6E, 0x3E, 0x73,
-    0xB8, 0xB0, 0xEB, 0xC5, 0x2F, 0xC8, 0xD1, 0x5A, 0x8D, 0x5B, 0x2D, 0xCA, 0x2B, 0x87, 0xE5, 0xAB,
-    0x39, 0x05, 0xD8, 0xD4, 0xCC, 0x91, 0x3D, 0xBD, 0x42, 0xB6, 0x2E, 0xC8, 0xD2, 0x53, 0xA2, 0xA8,
-    0x25, 0xFA, 0x5B, 0x8B, 0xDD, 0x0D, 0xB9, 0x27, 0x4B, 0x9A, 0x73, 0xAF, 0xC5, 0x57, 0x46, 0xF2,
-    0x91, 0x2E, 0x23, 0xDD, 0xD2, 0xA1, 0xB5, 0xD8, 0x90, 0xB2, 0x73, 0xA2, 0x17, 0x66, 0xD4, 0x29,
-    0x4B, 0xE8, 0x38, 0x79, 0x19, 0x89, 0x5C, 0xE4, 0x15, 0xAD, 0xD2, 0xC0, 0x49, 0x24, 0x39, 0x49,
-    0xCF, 0x2E, 0x68, 0x95, 0x59, 0x72, 0x93, 0x9E, 0x9B, 0xA0, 0x7B, 0xB5, 0xE4, 0xD9, 0xE0, 0x58,
-    0xD2, 0x73, 0xDE, 0xFB, 0x58, 0x9F, 0xCA, 0xAB, 0xAA, 0x1A, 0x78, 0x7A, 0xFE, 0xB8, 0xC8, 0xC7,
-    0xEF, 0x5E, 0x63, 0x66, 0x57, 0x03, 0xAB, 0x24, 0x29, 0x72, 0x8F, 0xEC, 0x82, 0xBB, 0x03, 0x3E,
-    0x82, 0x8C, 0xE7, 0xED, 0x02, 0x83, 0xB2, 0x47, 0x01, 0xC9, 0xBB, 0x0A, 0xA4, 0xA2, 0x92, 0x1F,
-    0xFB, 0xA3, 0xD9, 0xE3, 0xBD, 0x96, 0xFF, 0x34, 0xE6, 0xA4, 0x5A, 0x23, 0x72, 0x94, 0x84, 0x2C,
-    0x4B, 0x1B, 0xE3, 0x01, 0x35, 0x98, 0x4C, 0x86, 0x44, 0x56, 0x85, 0x3B, 0xE4, 0xF3, 0x4A, 0x07,
-    0x67, 0x24, 0x57, 0xC7, 0xD6, 0x82, 0xDC, 0xAC, 0xA9, 0x71, 0x8B, 0x28, 0x09, 0x44, 0x29, 0x6A,
-    0xDF, 0xAA, 0x28, 0x7A, 0x3F, 0x19, 0x90, 0xD0, 0xCA, 0x8B, 0x29, 0xCA, 0x05, 0x78, 0xA9, 0x29,
-    0x8B, 0x97, 0x74, 0x22, 0xB5, 0xBE, 0x86, 0xAE, 0x8E, 0xFD, 0x84, 0x16, 0xB0, 0x3D, 0x0C, 0x83,
-    0x20, 0x98, 0x7B, 0xE5, 0x28, 0x5D, 0x71, 0x55, 0x60, 0x97, 0x32, 0x4E, 0x45, 0x21, 0xE3, 0x81,
-    0x5D, 0xBA, 0x2A, 0xA2, 0x46, 0x94, 0x52, 0xF9, 0x94, 0x5A, 0x95, 0xC8, 0xB9, 0x13, 0x52, 0x4A,
-    0x95, 0x55, 0x5A, 0xCB, 0xF3, 0x38, 0x8B, 0xAB, 0x44, 0x6E, 0x97, 0x78, 0x54, 0x8D, 0xD9, 0x01,
-    0x0D, 0x71, 0xA6, 0x70, 0xF6, 0x0D, 0x30, 0x1A, 0x60, 0xB6, 0xC6, 0xC6, 0x52, 0xE4, 0xAE, 0xF2,
-    0xE8, 0x65, 0x73, 0x40, 0xAC, 0x26, 0x0F, 0x2D, 0x9F, 0x90, 0x9C, 0xE5, 0xF2, 0x37, 0xD9, 0x5D,
-    0xFD, 0xAF, 0x4C, 0x7F, 0x41, 0x91, 0x22, 0x77, 0x8D, 0xAC, 0xAF, 0xC1, 0xB8, 0x54, 0x6E, 0x3E,
-    0xA2, 0xA3, 0x76, 0x4C, 0x87, 0x76, 0x15, 0xCE, 0x5A, 0x82, 0x86, 0x31, 0xB4, 0xFA, 0xDB, 0x7D,
-    0x1F, 0x58, 0x19, 0x6B, 0xC8, 0x69, 0xDF, 0x5D, 0x33, 0x3C, 0xE4, 0x7C, 0x5A, 0x36, 0x81, 0xE7,
-    0xBC, 0xA3, 0x74, 0xA3, 0x9B, 0xFE, 0x59, 0x03, 0x5A, 0xA2, 0x0A, 0x02, 0x05, 0x73, 0x68, 0x5D,
-    0x6E, 0xA1, 0x08, 0xB4, 0x01, 0xB7, 0x32, 0x41, 0x6B, 0x9B, 0x76, 0x60, 0xDA, 0x18, 0xAD, 0x28,
-    0xB8, 0x4D, 0x3B, 0xCD, 0xD8, 0x3A, 0xA7, 0x48, 0x17, 0xA2, 0x72, 0x73, 0x2F, 0x96, 0xAA, 0x21,
-    0x79, 0xAA, 0xA0, 0x10, 0xC2, 0x4D, 0xB1, 0xE1, 0x1B, 0xA0, 0xE1, 0x13, 0x45, 0x9E, 0x0F, 0x3D,
-    0xA5, 0x64, 0xF1, 0xF0, 0x63, 0x0C, 0xF9, 0x6E, 0x40, 0xA2, 0xC4, 0xE2, 0xB7, 0x2B, 0x4A, 0xB1,
-    0xB7, 0x00, 0xCA, 0x0D, 0x3C, 0x8D, 0xC6, 0xBD, 0xD8, 0xCB, 0xFD, 0x2A, 0x1A, 0x46, 0xF2, 0xB4,
-    0xC8, 0xC1, 0x15, 0x30, 0x11, 0x1F, 0xD0, 0x61, 0x36, 0x1C, 0x9D, 0xC3, 0x5A, 0x0A, 0x59, 0x78,
-    0xC5, 0x51, 0x60, 0x84, 0x69, 0x10, 0x31, 0x28, 0x20, 0x50, 0x1C, 0x86, 0x4F, 0xC7, 0x68, 0xC1,
-    0xAC, 0x55, 0xA3, 0x49, 0x9E, 0xD5, 0xDC, 0xEC, 0x9F, 0xCD, 0xB4, 0xFE, 0x06, 0xF6, 0xA6, 0xC8,
-    0xE0, 0x27, 0xB7, 0x21, 0x4A, 0x99, 0x1F, 0x2B, 0x0E, 0x1B, 0x1A, 0x7B, 0x48, 0x32, 0xFC, 0x1A,
-    0x00, 0x32, 0xA1, 0x0C, 0x78, 0xEB, 0xC3, 0x3A, 0xC8, 0xC7, 0xDD, 0x08, 0xDB, 0xD2, 0xEE, 0x49,
-    0xCC, 0xC3, 0xE8, 0x65, 0x72, 0x4B, 0x90, 0x04, 0xAA, 0x60, 0x78, 0x86, 0x4F, 0x9E, 0x76, 0x71,
-    0xDB, 0x01, 0x6A, 0xC5, 0x5D, 0x2C, 0xFD, 0x1C, 0x94, 0xBE, 0xC6, 0x44, 0x35, 0x20, 0xAA, 0x81,
-    0x80, 0x01, 0x54, 0xC1, 0x76, 0x11, 0x42, 0xD0, 0x3E, 0x20, 0xE1, 0x31, 0xD8, 0x63, 0xAB, 0x84,
-    0x55, 0xEB, 0xAF, 0xD9, 0x15, 0x1C, 0xE9, 0x2F, 0xDE, 0xEC, 0x98, 0xC0, 0x8A, 0x0E, 0x34, 0xD8,
-    0x02, 0xF4, 0xC6, 0x6C, 0xBC, 0x0F, 0x57, 0x2E, 0xC1, 0xCD, 0x00, 0x43, 0xE6, 0x2E, 0xAF, 0xC2,
-    0x4D, 0xF2, 0x2F, 0x2F, 0x83, 0x87, 0x9A, 0xFE, 0xBC, 0x88, 0x73, 0x0A, 0x40, 0x4D, 0xCC, 0xC4,
-    0xE2, 0x77, 0x0C, 0x43, 0xA3, 0xE4, 0x9F, 0x4A, 0xEC, 0x06, 0x64, 0x94, 0xA7, 0xB1, 0x60, 0x61,
-    0x66, 0x78, 0x30, 0x27, 0x57, 0xB3, 0x85, 0x90, 0x53, 0x18, 0x29, 0xEE, 0x11, 0x28, 0x55, 0xE3,
-    0x42, 0xDC, 0xD6, 0x95, 0x57, 0x39, 0xD5, 0x98, 0xC4, 0xD7, 0x35, 0xB9, 0xAC, 0xDD, 0x33, 0x31,
-    0x05, 0x0C, 0x9E, 0x94, 0xDC, 0xAB, 0x15, 0x85, 0x76, 0xE5, 0x94, 0xD0, 0x6E, 0x6C, 0x33, 0x59,
-    0x80, 0x6D, 0x26, 0xE2, 0x7F, 0xAC, 0xAC, 0x64, 0x20, 0x51, 0x77, 0x0C, 0x46, 0x9D, 0x05, 0xB0,
-    0x74, 0x86, 0x33, 0xF9, 0x25, 0xBB, 0x9C, 0xCD, 0xD6, 0xE5, 0x4F, 0xAF, 0x13, 0xE5, 0x0E, 0x06,
-    0x0B, 0x1A, 0xEB, 0xD2, 0xC1, 0x93, 0x7C, 0x2C, 0xAB, 0x49, 0xBE, 0x0B, 0x0C, 0xBA, 0xCA, 0xAA,
-    0x64, 0x22, 0x13, 0xEF, 0xD3, 0x1A, 0x9A, 0x8A, 0xD9, 0xE9, 0x39, 0xF7, 0x35, 0x8D, 0x68, 0x0C,
-    0xA2, 0x11, 0xE4, 0x96, 0xEE, 0x40, 0x12, 0x08, 0x96, 0xB9, 0x5D, 0xE1, 0xF0, 0x89, 0xBB, 0xE7,
-    0xF0, 0x36, 0xD4, 0x3B, 0xD6, 0xB9, 0x53, 0x79, 0x79, 0x84, 0x33, 0x57, 0x24, 0x5F, 0x57, 0xE4,
-    0xCF, 0xB0, 0x0C, 0x9D, 0xB9, 0xD7, 0xF1, 0x58, 0xB7, 0x70, 0x20, 0xB5, 0xB6, 0x74, 0xF5, 0x05,
-    0xB5, 0xCB, 0x6A, 0x77, 0x24, 0x1B, 0xB4, 0xC6, 0x70, 0x2C, 0xB5, 0x71, 0xB8, 0x6C, 0xB4, 0x34,
-    0x6C, 0xDB, 0xC1, 0x8E, 0x4F, 0x9D, 0x59, 0xDF, 0x40, 0x16, 0xAD, 0xA3, 0x68, 0xCF, 0xE7, 0x2C,
-    0xEC, 0x48, 0xBE, 0x5D, 0xFA, 0x22, 0xFF, 0xE9, 0xCC, 0x09, 0xE2, 0xBE, 0xA5, 0x41, 0x2C, 0x27,
-    0x0F, 0xC6, 0x5A, 0x93, 0x05, 0x7A, 0xF0, 0x53, 0x34, 0x5E, 0x26, 0x9E, 0x21, 0x87, 0xBD, 0x5E,
-    0x06, 0x01, 0xF9, 0x33, 0x8D, 0x5B, 0x9D, 0x51, 0x68, 0x6D, 0xBC, 0xC1, 0xE3, 0xCF, 0x91, 0x7E,
-    0xFF, 0x0D, 0x4C, 0x9E, 0x58, 0x59, 0xB9, 0x08, 0x38, 0xC2, 0x79, 0x33, 0x31, 0xB2, 0x79, 0xF7,
-    0x18, 0xE4, 0xBC, 0xD9, 0x04, 0xB0, 0x4D, 0x1E, 0x0E, 0x38, 0x65, 0xC2, 0x46, 0x0C, 0x39, 0xD9,
-    0x5B, 0x44, 0xDF, 0x9B, 0x91, 0x81, 0x69, 0x8C, 0x75, 0x1D, 0x58, 0x53, 0x83, 0x03, 0xDF, 0xFC,
-    0x42, 0x56, 0x09, 0xEC, 0xC8, 0x2D, 0x98, 0x33, 0x68, 0x67, 0xD5, 0x78, 0xB3, 0xC7, 0x0F, 0x5F,
-    0x60, 0xAA, 0x76, 0x63, 0x68, 0xB3, 0x80, 0x7F, 0xF2, 0x90, 0x39, 0xD0, 0x10, 0x0E, 0xF9, 0x5B,
-    0x16, 0xB0, 0x30, 0x61, 0xBD, 0xB2, 0xEA, 0xED, 0xD2, 0x88, 0xA3, 0x92, 0x31, 0x0C, 0x6C, 0xE0,
-    0x51, 0x76, 0x59, 0xF5, 0xE6, 0xE0, 0x30, 0xD5, 0x5C, 0x0F, 0xE1, 0x87, 0xFF, 0x95, 0x50, 0xF3,
-    0x30, 0x14, 0x47, 0xCD, 0x3D, 0xFE, 0x77, 0x55, 0x0F, 0xF3, 0x52, 0x0D, 0x7A, 0xA2, 0x9C, 0xCF,
-    0xAB, 0x80, 0x74, 0xA5, 0x0B, 0x1F, 0xAC, 0xCC, 0xC7, 0x33, 0x0F, 0x91, 0x1B, 0x9D, 0xD6, 0x46,
-    0x9E, 0xD9, 0xEF, 0x16, 0x19, 0xC7, 0x9A, 0x3D, 0x0E, 0xFD, 0xFC, 0xB7, 0xD4, 0xA9, 0x8D, 0x1C,
-    0xE6, 0x36, 0xE2, 0x85, 0x8F, 0xD8, 0x4E, 0xD7, 0x4D, 0x18, 0x20, 0x83, 0x65, 0xF0, 0x06, 0x39,
-    0x23, 0x8A, 0x74, 0xEC, 0x31, 0xB0, 0x70, 0x48, 0x9F, 0x4F, 0x30, 0x65, 0xEB, 0xAB, 0x69, 0xB4,
-    0xF2, 0x97, 0x12, 0xB7, 0x11, 0xDA, 0x62, 0x2C, 0xC6, 0x0E, 0xEF, 0x14, 0x9B, 0x0C, 0x1B, 0x68,
-    0xDA, 0x30, 0x6E, 0x23, 0xBD, 0x05, 0x57, 0xA9, 0x55, 0xD8, 0xBF, 0x5C, 0xC2, 0xFD, 0x81, 0x47,
-    0xAA, 0x77, 0x2F, 0x1B, 0x73, 0x08, 0x54, 0xBA, 0x65, 0x3B, 0x8E, 0x43, 0x5A, 0xC4, 0xD8, 0x6A,
-    0x70, 0x0F, 0xAE, 0x92, 0x86, 0xB3, 0x2B, 0xE5, 0x39, 0xDC, 0x03, 0x2D, 0x9D, 0x47, 0x1C, 0xCA,
-    0x4D, 0xF0, 0xC8, 0xDA, 0x18, 0x26, 0x56, 0x39, 0xED, 0xC9, 0xD4, 0x58, 0x37, 0x2E, 0xF6, 0x68,
-    0x2C, 0x52, 0xE3, 0x93, 0xD8, 0x98, 0xD8, 0x92, 0xCC, 0x21, 0xC3, 0x9D, 0x09, 0x3E, 0x6C, 0x43,
-    0xC6, 0xFF, 0x75, 0x83, 0x31, 0xAB, 0x76, 0x9B, 0xDE, 0x84, 0x8D, 0xB2, 0xDA, 0x61, 0x33, 0xD6,
-    0x02, 0x31, 0xD7, 0x82, 0x53, 0x10, 0xB0, 0x8D, 0x68, 0x47, 0x5E, 0x0E, 0x3E, 0xC6, 0xE8, 0x58,
-    0xCC, 0xB8, 0xBC, 0x9E, 0x77, 0x1C, 0x3A, 0x1B, 0x79, 0xC7, 0xA2, 0xB3, 0xB9, 0xD3, 0xD9, 0x98,
-    0xDD, 0xE2, 0x35, 0x66, 0xF1, 0xD8, 0x6C, 0x0F, 0xFB, 0x4B, 0x95, 0x21, 0x18, 0xB1, 0xEE, 0x71,
-    0x90, 0x33, 0x5A, 0x6F, 0xDC, 0xE9, 0x2F, 0xB0, 0x78, 0x89, 0xDD, 0x39, 0x56, 0xD1, 0x6C, 0xA0,
-    0xF5, 0x75, 0xE0, 0x77, 0xBB, 0xBF, 0xB0, 0xEF, 0x0E, 0x06, 0xD8, 0x03, 0xE1, 0x47, 0xC6, 0xF3,
-    0x1D, 0x44, 0x24, 0x61, 0xFE, 0x4B, 0x3C, 0x31, 0x7C, 0x06, 0x91, 0xC7, 0x83, 0xC7, 0xD0, 0xDE,
-    0xE6, 0xA3, 0xB7, 0x14, 0x6D, 0xBD, 0x80, 0x8C, 0x81, 0x3A, 0x3B, 0x33, 0x72, 0x72, 0xF3, 0x99,
-    0x38, 0x8D, 0x18, 0x8D, 0x3C, 0x41, 0x9B, 0xC9, 0x0A, 0x5D, 0xD6, 0x74, 0x68, 0xF1, 0x3A, 0x84,
-    0xE8, 0xB3, 0x73, 0x4C, 0x21, 0x52, 0xBB, 0x8C, 0x62, 0x78, 0x8D, 0x71, 0x0C, 0x90, 0x64, 0xCB,
-    0x56, 0x4A, 0xC6, 0x12, 0x7D, 0xE8, 0xD6, 0xE0, 0x1F, 0x4F, 0x74, 0xDF, 0xC7, 0xF3, 0xEF, 0x81,
-    0x68, 0x03, 0x0E, 0x22, 0xE6, 0x67, 0x7D, 0xDF, 0x04, 0x8C, 0xF5, 0x1E, 0x7B, 0xFD, 0xED, 0x7E,
-    0x7F, 0xFC, 0xEC, 0x15, 0x4F, 0x4F, 0xA8, 0xAC, 0xCD, 0x5A, 0x27, 0xFF, 0xAE, 0x6F, 0x36, 0xC5,
-    0x19, 0xBD, 0xD8, 0xC9, 0xE1, 0x4F, 0x87, 0xCF, 0xDD, 0x41, 0x5A, 0xD3, 0x8C, 0xA7, 0xDE, 0xD4,
-    0xBA, 0xC4, 0x07, 0x98, 0x40, 0x80, 0x6B, 0x90, 0xE0, 0x08, 0x22, 0x1C, 0x61, 0x22, 0x82, 0x44,
-    0x23, 0x88, 0x14, 0x32, 0xAA, 0x70, 0x05, 0xB8, 0xE4, 0x12, 0x4B, 0x1F, 0xBC, 0x69, 0x80, 0x2B,
-    0x72, 0x38, 0x83, 0x58, 0xC3, 0x0A, 0xC9, 0xB1, 0xBB, 0xC1, 0x16, 0x0F, 0xC1, 0xCD, 0xAE, 0x41,
-    0x23, 0x8A, 0x2B, 0x80, 0x10, 0x44, 0x47, 0x14, 0x1C, 0xA4, 0xA6, 0x83, 0x07, 0x06, 0x12, 0x2D,
-    0xE0, 0x90, 0x44, 0xEC, 0xCE, 0x36, 0x1B, 0x76, 0x6E, 0x11, 0x34, 0x15, 0x6D, 0xDE, 0x65, 0x2F,
-    0x19, 0x60, 0xE9, 0x83, 0xCD, 0xF5, 0x84, 0xBC, 0xB0, 0x87, 0xFC, 0x64, 0x73, 0x13, 0xD0, 0x0C,
-    0xC2, 0x00, 0x51, 0xE3, 0xFA, 0xE6, 0x8D, 0x92, 0xEA, 0x30, 0x80, 0x61, 0x8B, 0xCD, 0x3C, 0xB5,
-    0xCB, 0x30, 0x10, 0x79, 0x80, 0x6E, 0xE8, 0xA8, 0x10, 0x01, 0x79, 0x15, 0x5D, 0x79, 0x26, 0x0E,
-    0x03, 0x9A, 0x94, 0xE8, 0xC2, 0x2F, 0xA2, 0x1B, 0x29, 0x74, 0xE1, 0x52, 0x42, 0x93, 0x8F, 0x14,
-    0x38, 0xAF, 0xD8, 0xA8, 0xF9, 0xE0, 0x39, 0x3A, 0xF0, 0xD7, 0x41, 0x50, 0xA3, 0xF3, 0x09, 0x9E,
-    0xD1, 0x83, 0x5C, 0x36, 0xAE, 0xD6, 0xE8, 0x48, 0x25, 0x36, 0x20, 0xA1, 0x20, 0xB0, 0x6A, 0x74,
-    0xA4, 0x42, 0xAC, 0x8C, 0xD0, 0xB1, 0x2B, 0x74, 0xE4, 0x75, 0xD8, 0xCC, 0x18, 0x1D, 0xFB, 0x01,
-    0x3A, 0x72, 0xCA, 0x36, 0x83, 0x8E, 0xCD, 0x1D, 0x99, 0xEF, 0x00, 0x94, 0xA3, 0x0A, 0x07, 0xD4,
-    0x36, 0x5E, 0xCA, 0x21, 0x51, 0xA7, 0xE4, 0x6C, 0xA4, 0x66, 0x2B, 0x6E, 0x38, 0xFE, 0x0C, 0xA3,
-    0x99, 0xDB, 0xA2, 0xE8, 0x59, 0x7F, 0xE6, 0x2E, 0xAF, 0x1B, 0x71, 0x3E, 0x93, 0x9A, 0x4C, 0x06,
-    0x54, 0x44, 0x89, 0x28, 0xE0, 0xE7, 0x1C, 0x9E, 0x63, 0x13, 0xF2, 0x4D, 0xB0, 0x8E, 0xF4, 0x45,
-    0x02, 0xFA, 0xC4, 0x9D, 0x5F, 0x37, 0xAC, 0x27, 0x4E, 0xDA, 0x90, 0x24, 0x42, 0x68, 0xBE, 0x9C,
-    0xE5, 0x70, 0x15, 0x12, 0x87, 0x3B, 0x8B, 0x35, 0xC7, 0xCE, 0x48, 0x2F, 0xB3, 0x2A, 0x58, 0x23,
-    0xEC, 0x72, 0xD9, 0xA6, 0x9E, 0x1A, 0xFE, 0xBF, 0x4F, 0xF0, 0x63, 0xFE, 0x23, 0x8E, 0x6E, 0xC4,
-    0x78, 0x20, 0xC9, 0x36, 0xEB, 0xC0, 0x79, 0x5E, 0x62, 0xBF, 0x43, 0xE1, 0xB9, 0x4C, 0xB1, 0xD3,
-    0x0D, 0x0C, 0xF2, 0xEC, 0x3D, 0x97, 0x28, 0x18, 0x9A, 0xBC, 0x26, 0x02, 0xB3, 0xE1, 0x39, 0x4E,
-    0x34, 0x1B, 0x93, 0xC7, 0x07, 0x48, 0xF4, 0xA0, 0x28, 0xEC, 0x73, 0x66, 0xFB, 0x88, 0x9D, 0x34,
-    0x7B, 0x5A, 0x3A, 0xA6, 0x0B, 0x84, 0x94, 0xAB, 0xD3, 0x43, 0xAB, 0x51, 0xE7, 0x1F, 0x82, 0xAE,
-    0x81, 0x23, 0xE0, 0x80, 0xED, 0x18, 0xBE, 0xF8, 0xEA, 0xF2, 0x3F, 0xD6, 0x68, 0xD8, 0xAD, 0x40,
-    0xE3, 0xDE, 0x5A, 0x7E, 0xA1, 0x01, 0xEF, 0xC6, 0xEF, 0x76, 0x79, 0x92, 0xE6, 0xAB, 0xBF, 0x78,
-    0xA7, 0x6F, 0x84, 0xF8, 0x3F, 0xB8, 0x90, 0x7A, 0xC8, 0xDF, 0xC3, 0x4C, 0x3E, 0xC7, 0x70, 0x1B,
-    0x4A, 0x08, 0x87, 0xFF, 0xD5, 0x44, 0x5D, 0x75, 0x46, 0xED, 0x23, 0xC6, 0x4B, 0xD5, 0xC6, 0xBE,
-    0x82, 0xDA, 0x01, 0x58, 0x24, 0x08, 0xCC, 0x31, 0x02, 0xBE, 0x73, 0x8B, 0xBD, 0x1F, 0xFB, 0xD9,
-    0x77, 0x4B, 0x44, 0x3C, 0xAE, 0xB1, 0xE0, 0x2C, 0x45, 0x01, 0xA7, 0xC8, 0x85, 0x10, 0xB0, 0x5F,
-    0x60, 0x8C, 0xB0, 0x4C, 0x5C, 0x00, 0xC1, 0x7D, 0x72, 0x4C, 0xC3, 0x4D, 0x91, 0x73, 0x28, 0xC0,
-    0x72, 0x2E, 0x19, 0x48, 0x8E, 0x38, 0x02, 0xE7, 0x9D, 0x94, 0x8C, 0xE6, 0xBA, 0x4A, 0x8F, 0xBD,
-    0x30, 0x98, 0x62, 0xC4, 0x6C, 0x20, 0xCB, 0xC0, 0x0F, 0xBA, 0x47, 0xB2, 0x0E, 0xD0, 0x88, 0xDB,
-    0x9D, 0xCE, 0xF0, 0x8B, 0x6B, 0x5A, 0x5D, 0x25, 0x58, 0xB0, 0xB8, 0x81, 0x78, 0xEC, 0x28, 0x0F,
-    0xEE, 0x26, 0x41, 0xF9, 0xC6, 0x45, 0x62, 0x28, 0x0A, 0x1F, 0xB4, 0x52, 0x14, 0x72, 0x32, 0xB1,
-    0xCA, 0x01, 0x07, 0x5E, 0xB1, 0x51, 0xD8, 0xC8, 0xE6, 0xE4, 0xFB, 0x31, 0xD7, 0x2A, 0xFE, 0xC0,
-    0x3C, 0x7E, 0x84, 0x0C, 0x9C, 0xBD, 0x16, 0x52, 0x1F, 0x70, 0x87, 0xE7, 0x6A, 0x93, 0xB7, 0x8B,
-    0xAE, 0x5C, 0x40, 0x24, 0xC0, 0x19, 0x3D, 0x34, 0x32, 0x41, 0x11, 0xA3, 0xBC, 0x84, 0x5D, 0x23,
-    0xA7, 0x95, 0x20, 0xEE, 0xDC, 0xC0, 0xC6, 0x14, 0x0B, 0x25, 0x47, 0x7D, 0x0E, 0xD1, 0x11, 0x97,
-    0x06, 0x5C, 0x7D, 0x80, 0xB0, 0x44, 0x9A, 0xE8, 0xA2, 0x4C, 0x72, 0x90, 0x26, 0x88, 0xC2, 0xE6,
-    0x1A, 0x36, 0x84, 0x7B, 0x75, 0x51, 0x8A, 0x53, 0xC3, 0x49, 0x43, 0xC2, 0x7F, 0x78, 0x86, 0xBC,
-    0xC6, 0x65, 0x58, 0x68, 0x84, 0x87, 0x45, 0xB5, 0x91, 0x5B, 0x8A, 0x21, 0x9E, 0x9C, 0x02, 0xFD,
-    0xF2, 0x36, 0x50, 0xC5, 0x95, 0x0A, 0xE7, 0x2B, 0x26, 0x71, 0x79, 0x22, 0xB8, 0x17, 0xCF, 0x98,
-    0x18, 0xEF, 0x4D, 0xBD, 0x39, 0x39, 0x35, 0x16, 0xD7, 0x05, 0xB6, 0xB0, 0xCB, 0x01, 0xB8, 0x8A,
-    0xA9, 0xBB, 0x04, 0x7B, 0x32, 0x03, 0x6F, 0xB7, 0x54, 0xCE, 0x96, 0xDE, 0xE9, 0xF7, 0x61, 0x16,
-    0x2D, 0xC8, 0xD4, 0xD9, 0x43, 0xFD, 0xE8, 0xA6, 0xCF, 0x92, 0x76, 0xD5, 0x81, 0x4D, 0x3F, 0x9B,
-    0xAE, 0x5C, 0x1C, 0xB0, 0x37, 0x00, 0x41, 0x4E, 0x9E, 0x38, 0x26, 0xB2, 0x3E, 0x6B, 0x56, 0xAC,
-    0x60, 0x29, 0x72, 0x1D, 0xC3, 0xA6, 0xC4, 0xF5, 0x05, 0x16, 0x01, 0x12, 0x00, 0x43, 0x68, 0x4A,
-    0x80, 0x2A, 0x42, 0xC8, 0x39, 0x32, 0xA4, 0xE7, 0xFC, 0x1E, 0x99, 0x8C, 0xA7, 0x27, 0x3E, 0x32,
-    0x15, 0x10, 0xC4, 0xCD, 0xAA, 0x3B, 0x0E, 0x60, 0x56, 0xD0, 0xCB, 0xB5, 0x82, 0xE6, 0x50, 0x1C,
-    0x95, 0x6E, 0xE2, 0xC6, 0x92, 0x7A, 0x34, 0x8F, 0xFC, 0xB7, 0x87, 0x75, 0xAB, 0xAB, 0xB3, 0x34,
-    0x15, 0xD9, 0x31, 0xC2, 0x87, 0xBE, 0xB6, 0xB2, 0xB2, 0x42, 0x67, 0xAD, 0xDA, 0xAE, 0xA0, 0x9E,
-    0x02, 0x75, 0xDB, 0xE5, 0x2D, 0x18, 0x65, 0xF2, 0x77, 0xA7, 0x32, 0xD2, 0x00, 0x6F, 0xE0, 0xFA,
-    0x48, 0x0A, 0x53, 0xF7, 0xB6, 0x17, 0xD7, 0x95, 0x8D, 0x5C, 0x71, 0xAD, 0xA4, 0x28, 0x25, 0xEF,
-    0x76, 0xE2, 0x21, 0x5A, 0x0F, 0xFC, 0x56, 0xCE, 0xDE, 0x5C, 0xD8, 0x4F, 0xD6, 0x59, 0x8F, 0x87,
-    0xC8, 0xB2, 0x52, 0x36, 0xF5, 0x0F, 0x32, 0x80, 0x6A, 0x82, 0x0C, 0xA3, 0x99, 0xEC, 0x56, 0xCB,
-    0x4B, 0xF0, 0x80, 0xA8, 0x30, 0xFE, 0x0D, 0xFD, 0x23, 0x74, 0x44, 0xBE, 0xB2, 0xEA, 0x4C, 0x79,
-    0xD7, 0xBE, 0xD2, 0x53, 0xF7, 0x75, 0x56, 0x38, 0xB2, 0x07, 0x7F, 0x1B, 0xFE, 0x41, 0x65, 0xE7,
-    0xF2, 0x91, 0x61, 0x09, 0xF2, 0x43, 0x7A, 0xCB, 0x95, 0xD1, 0xD0, 0x94, 0xA9, 0xAC, 0xB7, 0xC6,
-    0x28, 0x53, 0x54, 0x56, 0x82, 0xD2, 0x88, 0x8B, 0xAF, 0xAE, 0x00, 0xA5, 0x6F, 0x71, 0xD0, 0xC7,
-    0xAA, 0x40, 0xE8, 0xA6, 0x8A, 0x3E, 0xC8, 0x6E, 0xD4, 0x34, 0x3E, 0xA3, 0x68, 0x12, 0x92, 0x75,
-    0x1F, 0x1A, 0xFB, 0x27, 0xD4, 0xF3, 0x0B, 0x94, 0x74, 0xA0, 0x5C, 0x61, 0xB8, 0x51, 0x92, 0x77,
-    0x5A, 0xD1, 0x54, 0xE6, 0xB2, 0xF2, 0xF4, 0x83, 0xDC, 0xD3, 0xA7, 0x63, 0xA6, 0xBC, 0xB4, 0x85,
-    0xDC, 0xA6, 0x70, 0xB7, 0x96, 0xB8, 0xA2, 0x47, 0xB0, 0xDB, 0x84, 0x31, 0x8C, 0xFA, 0x6F, 0x3C,
-    0xE0, 0x12, 0x64, 0x65, 0xE5, 0x4F, 0x79, 0xE7, 0x0C, 0x67, 0x08, 0x6B, 0xE9, 0x28, 0x52, 0xB2,
-    0x9C, 0x9D, 0x34, 0xEF, 0xC5, 0xE5, 0x37, 0x48, 0xA4, 0xAC, 0x0E, 0x0F, 0xE6, 0xE7, 0x3E, 0x5C,
-    0x46, 0xD5, 0xFC, 0xE2, 0xFD, 0x58, 0xEC, 0xCC, 0x1C, 0xFC, 0xA3, 0xA5, 0xFC, 0xBC, 0xD4, 0xF7,
-    0xF2, 0xF6, 0x9C, 0x7E, 0xBD, 0xB0, 0xA6, 0x11, 0x40, 0x5B, 0x93, 0xB3, 0x87, 0x79, 0x3E, 0x0B,
-    0x07, 0x55, 0x1C, 0x6D, 0xE8, 0xC7, 0xA2, 0x8A, 0x62, 0x1F, 0x45, 0xCC, 0xED, 0x78, 0x8C, 0xE0,
-    0x7A, 0x68, 0x47, 0x0E, 0x9C, 0xAC, 0x37, 0x3F, 0x5C, 0xF0, 0x4C, 0x6E, 0xBD, 0xC4, 0x7E, 0xAD,
-    0x53, 0x58, 0xBA, 0xAF, 0xB9, 0x9A, 0x25, 0xD0, 0xE0, 0xE9, 0xF6, 0x5C, 0x93, 0xC5, 0xEE, 0x2D,
-    0x94, 0x9B, 0x13, 0x12, 0x5F, 0x29, 0x0A, 0xD3, 0x83, 0x9B, 0xE2, 0x70, 0x9A, 0xA2, 0xA8, 0x7B,
-    0x33, 0x7D, 0xF2, 0x03, 0xF7, 0x99, 0xE2, 0x6B, 0xCA, 0x3D, 0xE4, 0xDF, 0xE9, 0xF3, 0x7C, 0x81,
-    0x8A, 0x92, 0x8B, 0xB6, 0x6F, 0x61, 0x50, 0x59, 0x97, 0x52, 0x8A, 0x5C, 0x94, 0x44, 0xA9, 0x28,
-    0xD9, 0xE3, 0x40, 0x2B, 0xEE, 0x3A, 0xA0, 0xDA, 0x20, 0x00, 0x15, 0x94, 0xF9, 0xB1, 0x99, 0xE4,
-    0x7B, 0xEC, 0x73, 0x26, 0xAE, 0x12, 0x28, 0x73, 0x60, 0xF8, 0xE9, 0x33, 0x3F, 0xE7, 0xFD, 0x2D,
-    0xBB, 0x7D, 0xF5, 0x9E, 0xAE, 0xC7, 0xFA, 0x42, 0xFB, 0xC6, 0xA3, 0x9B, 0xE3, 0x25, 0x05, 0xDB,
-    0x0A, 0xD7, 0xD8, 0x79, 0xB4, 0x15, 0x17, 0x42, 0x30, 0x03, 0x94, 0xFC, 0x77, 0x59, 0x85, 0x7E,
-    0xCA, 0x6C, 0xC0, 0x28, 0x9E, 0x6F, 0xFA, 0xBC, 0x57, 0xBB, 0xEB, 0xBA, 0xCA, 0xB6, 0x96, 0x3E,
-    0x81, 0x35, 0x20, 0x3F, 0xFC, 0x2A, 0xFF, 0x4E, 0x41, 0x72, 0x43, 0x7E, 0x65, 0xCA, 0x14, 0xF7,
-    0xFE, 0x52, 0xEE, 0x25, 0xA2, 0x8C, 0x60, 0x02, 0xF0, 0x19, 0x0D, 0xB4, 0x9D, 0xEE, 0xBD, 0x78,
-    0x2E, 0xE2, 0xD7, 0x2B, 0xB1, 0x5D, 0xCA, 0xDC, 0xBC, 0x6C, 0x4A, 0x28, 0x9B, 0x1A, 0xE0, 0x9D,
-    0xF7, 0xB6, 0xEC, 0x7B, 0xBA, 0x71, 0xDB, 0xD7, 0x1A, 0x5F, 0xD9, 0x15, 0x1E, 0xFE, 0x0D, 0xBC,
-    0xF1, 0x93, 0x66, 0xC8, 0x51, 0xCD, 0x07, 0x6E, 0x9B, 0x8C, 0x9C, 0xCF, 0x34, 0x6A, 0xFE, 0xBB,
-    0xBA, 0xF2, 0x3D, 0x0D, 0x15, 0xC4, 0xDF, 0x62, 0xE0, 0xBB, 0x70, 0x7C, 0xED, 0xB9, 0xE1, 0x18,
-    0xED, 0x87, 0xE3, 0x3E, 0x2B, 0x3D, 0x7F, 0xEC, 0xD6, 0x85, 0xE9, 0xDA, 0xF6, 0xE9, 0x9A, 0x32,
-    0x16, 0xBC, 0x91, 0xE7, 0xB3, 0xFE, 0x6C, 0x7D, 0xD1, 0xD3, 0x4D, 0x74, 0x32, 0x1D, 0x18, 0x3F,
-    0x0B, 0x2F, 0x81, 0x68, 0xE9, 0xA2, 0xF4, 0xC8, 0x4A, 0x13, 0x54, 0x27, 0xC6, 0xE1, 0x87, 0xE7,
-    0x69, 0x82, 0x3A, 0xDE, 0x47, 0x0C, 0x37, 0xAF, 0x3C, 0x5E, 0xE2, 0xA7, 0x20, 0x82, 0x7E, 0xF9,
-    0xA1, 0xD6, 0xC7, 0xEE, 0x2C, 0x0C, 0xD9, 0xA9, 0xEC, 0xFB, 0xE3, 0x5C, 0x1D, 0xF4, 0x4B, 0x64,
-    0x31, 0x16, 0xA0, 0x6A, 0x7F, 0xA8, 0x9E, 0x47, 0x57, 0xA3, 0x09, 0xC9, 0xCD, 0x4A, 0xB4, 0xBE,
-    0x7E, 0x54, 0x8C, 0xA7, 0xF3, 0x9C, 0x2E, 0x7C, 0x44, 0xF4, 0xC7, 0x59, 0x24, 0x07, 0xEA, 0x6A,
-    0x7E, 0xD1, 0x15, 0x82, 0x34, 0xBF, 0x48, 0xAD, 0x00, 0x46, 0xC4, 0x39, 0xF3, 0xCE, 0x05, 0xCE,
-    0x86, 0x53, 0xC1, 0x21, 0x24, 0x0B, 0xE7, 0x67, 0x4F, 0x4D, 0xB0, 0x7B, 0x93, 0x7E, 0x90, 0xD0,
-    0x1F, 0x2A, 0x54, 0xAC, 0xD8, 0xCF, 0x69, 0x9F, 0x54, 0x32, 0xA5, 0xDA, 0xA7, 0x5E, 0x29, 0xF2,
-    0xA1, 0x7D, 0x2F, 0xF7, 0xA8, 0x46, 0xA4, 0x45, 0xF8, 0xE9, 0x79, 0xA2, 0x70, 0xAE, 0x96, 0x81,
-    0x8C, 0xE5, 0x99, 0x64, 0x75, 0x80, 0x54, 0x9D, 0xDF, 0xF9, 0x20, 0x87, 0x5F, 0x4F, 0xAC, 0x47,
-    0x09, 0x36, 0x89, 0x29, 0xBF, 0x34, 0x91, 0x25, 0xE7, 0x19, 0x70, 0xC4, 0x53, 0x3A, 0x41, 0xD6,
-    0xC5, 0xA1, 0xA9, 0xE0, 0x53, 0x6A, 0x50, 0xFB, 0xD4, 0x21, 0xD9, 0xF7, 0xE0, 0x63, 0x90, 0x96,
-    0x71, 0xF8, 0xE7, 0x1C, 0x12, 0x02, 0x63, 0x53, 0x1A, 0x49, 0x80, 0xCE, 0x8B, 0x91, 0xCE, 0xF0,
-    0x7B, 0x65, 0x38, 0xE1, 0xD1, 0x9E, 0x33, 0xB9, 0x7C, 0x26, 0x94, 0x4C, 0xA1, 0x09, 0xDB, 0x35,
-    0x55, 0x0E, 0xC2, 0x78, 0x84, 0x43, 0xE2, 0x4C, 0xEF, 0x01, 0x4F, 0x38, 0x13, 0x57, 0x23, 0x99,
-    0x32, 0xB9, 0xA1, 0x98, 0xBD, 0x32, 0x0C, 0x1E, 0xBF, 0xFD, 0xE2, 0xB7, 0x25, 0x38, 0xB0, 0xCB,
-    0x41, 0xFC, 0xC4, 0xCA, 0x47, 0x63, 0x3D, 0x3D, 0xD2, 0x6F, 0xB8, 0xAC, 0x17, 0xE5, 0x6E, 0x78,
-    0x6C, 0xD8, 0xE9, 0xF3, 0xFB, 0x58, 0xC5, 0x08, 0x04, 0xAC, 0x4C, 0x68, 0x6E, 0xC9, 0xFA, 0x2B,
-    0xF2, 0x16, 0xB1, 0xCD, 0xAB, 0x52, 0x26, 0xE8, 0x9A, 0xFB, 0x69, 0xF7, 0x2A, 0x17, 0x94, 0x71,
-    0x56, 0x1C, 0xC7, 0xE7, 0xF4, 0x6C, 0xDF, 0x02, 0x68, 0x59, 0xD6, 0x2C, 0x10, 0x2B, 0xA1, 0xDE,
-    0x41, 0x1F, 0xFA, 0x19, 0x9E, 0x17, 0xF3, 0xAB, 0x9B, 0x90, 0x4C, 0x96, 0xC7, 0x6C, 0xEF, 0x74,
-    0x41, 0x10, 0xF9, 0xAD, 0x0B, 0x15, 0xE5, 0x4E, 0xC1, 0xB4, 0x9F, 0x5E, 0xE0, 0xC5, 0x6E, 0xC3,
-    0x6F, 0xB7, 0x97, 0xBB, 0xA0, 0x34, 0xAE, 0xE8, 0x3D, 0xDD, 0x2E, 0xBD, 0x62, 0x73, 0xE2, 0xFE,
-    0xAB, 0xF8, 0x3F, 0xC5, 0x59, 0x3D, 0x70, 0xDC, 0xC6, 0x15, 0x7E, 0xC0, 0x4A, 0x82, 0x23, 0xCC,
-    0x68, 0x59, 0x50, 0x89, 0xAC, 0xC4, 0x42, 0x0A, 0x15, 0x89, 0x87, 0x22, 0x5A, 0x15, 0x87, 0x03,
-    0x64, 0xCF, 0x24, 0x85, 0x0B, 0x73, 0x32, 0x3A, 0x67, 0x26, 0x2E, 0xE4, 0xC2, 0x85, 0x27, 0x29,
-    0x98, 0xC2, 0x85, 0x8A, 0x3B, 0x1E, 0x64, 0x15, 0x2E, 0x52, 0x98, 0x29, 0x54, 0x79, 0x26, 0x71,
-    0x66, 0x32, 0x93, 0x09, 0x1B, 0xAA, 0x48, 0xA1, 0x24, 0x20, 0xB1, 0x12, 0x0B, 0x17, 0x2A, 0x84,
-    0x98, 0xE3, 0x49, 0x91, 0x42, 0x88, 0x45, 0xC5, 0x13, 0xA9, 0x10, 0x24, 0xC3, 0x21, 0x48, 0xE2,
-    0xB0, 0xF9, 0xDE, 0xE2, 0x8E, 0x12, 0x2D, 0xC7, 0x96, 0x2D, 0x45, 0x3E, 0x72, 0x71, 0xF8, 0xDB,
-    0xF7, 0xB7, 0xEF, 0x7D, 0xEF, 0xBD, 0xBD, 0x7E, 0xD3, 0x0C, 0x88, 0x8E, 0x77, 0xF8, 0xD3, 0xE7,
-    0xCF, 0x0A, 0x3E, 0xD3, 0x84, 0x8F, 0x9D, 0x11, 0xFD, 0x89, 0x68, 0xB8, 0x68, 0x6B, 0x6D, 0x37,
-    0xAF, 0x9E, 0xAB, 0x89, 0xF0, 0xDF, 0x25, 0x92, 0x11, 0x39, 0x19, 0x59, 0x25, 0xD1, 0xC0, 0x5C,
-    0x88, 0x9C, 0x28, 0xC1, 0x59, 0x66, 0x59, 0x5A, 0x2B, 0x4F, 0xE7, 0xD4, 0x8D, 0xC8, 0x8D, 0x0C,
-    0x81, 0x29, 0x32, 0x1F, 0x47, 0x67, 0xE4, 0xEB, 0x8A, 0x16, 0x40, 0x11, 0x44, 0xA8, 0xC2, 0x28,
-    0xF7, 0x8E, 0xC3, 0x5B, 0x3D, 0x0A, 0xB5, 0x8E, 0x9E, 0x6F, 0x96, 0x1E, 0x7A, 0x66, 0x15, 0x64,
-    0xB8, 0x78, 0x1F, 0xF6, 0x4E, 0xE3, 0x9D, 0x86, 0xC7, 0x11, 0xA2, 0xF3, 0xFF, 0x6A, 0xBA, 0x1E,
-    0x58, 0xAE, 0xD8, 0x85, 0x8C, 0xDC, 0xB8, 0xA0, 0xCE, 0x31, 0x12, 0x97, 0x73, 0xEA, 0x48, 0x72,
-    0x54, 0x42, 0xA5, 0xDC, 0x4E, 0xCF, 0xEF, 0xE8, 0x95, 0x99, 0xFD, 0xA7, 0x20, 0x09, 0x0B, 0xEB,
-    0x4B, 0x45, 0xF2, 0x5C, 0x49, 0xAE, 0x0A, 0x49, 0x64, 0x4E, 0x66, 0x17, 0x90, 0xA6, 0x84, 0x0E,
-    0x09, 0xD9, 0x45, 0x40, 0x14, 0xF8, 0x44, 0xEE, 0x75, 0xBC, 0xAB, 0x63, 0x62, 0xC2, 0x8E, 0xD6,
-    0x45, 0x2B, 0x2C, 0xD4, 0x3E, 0xB8, 0x7C, 0x2B, 0xDE, 0x73, 0x83, 0x64, 0xDC, 0x8A, 0x45, 0x9D,
-    0xFB, 0x9F, 0x56, 0xDF, 0xBD, 0x77, 0xF6, 0x13, 0x0C, 0x73, 0xAA, 0x59, 0xCE, 0x6A, 0x9A, 0x02,
-    0x17, 0x08, 0x61, 0x35, 0x50, 0x66, 0x44, 0xAE, 0x2E, 0x5C, 0x95, 0x8A, 0x4C, 0x14, 0x05, 0xF5,
-    0xBB, 0x24, 0xDD, 0x1C, 0x97, 0xEF, 0x2A, 0x1B, 0xD6, 0x72, 0x61, 0x26, 0x2F, 0x86, 0x58, 0xB0,
-    0xED, 0xEB, 0xB4, 0x00, 0x69, 0x6C, 0x3D, 0x62, 0xCA, 0x53, 0xE4, 0x8B, 0x7F, 0xA8, 0x72, 0xF1,
-    0xC8, 0x98, 0x93, 0x0F, 0x59, 0xC9, 0xBF, 0xB9, 0x1C, 0xB3, 0x38, 0x7E, 0x24, 0xA0, 0x6A, 0x40,
-    0x85, 0xDD, 0x44, 0xC5, 0x73, 0x96, 0xAE, 0x9D, 0xF3, 0xAA, 0x6B, 0x45, 0x33, 0x27, 0x5D, 0xF0,
-    0xFC, 0x7B, 0x04, 0x53, 0x1E, 0xBA, 0x28, 0x31, 0x69, 0x87, 0x40, 0x57, 0x9A, 0xD3, 0x4D, 0x73,
-    0xF7, 0xA4, 0x1B, 0x93, 0xB5, 0xAE, 0x60, 0xA3, 0x99, 0x13, 0xB6, 0xAE, 0x85, 0x2A, 0x1C, 0x1D,
-    0x15, 0x8E, 0x62, 0x62, 0x5E, 0xC4, 0x92, 0x84, 0x17, 0xE6, 0x41, 0x7A, 0x5E, 0xB3, 0x29, 0xF7,
-    0x1B, 0xCE, 0xB6, 0x8E, 0xFF, 0x5D, 0x91, 0x24, 0x71, 0x45, 0xDF, 0xDB, 0xE8, 0x14, 0xB2, 0xE3,
-    0x5C, 0xBD, 0x53, 0xAC, 0x1E, 0xA1, 0xA9, 0xFD, 0xD4, 0x15, 0x59, 0x28, 0x72, 0x5F, 0x14, 0xDE,
-    0x0B, 0xF8, 0x2F, 0x5D, 0x55, 0x53, 0x2D, 0x63, 0x98, 0xDE, 0x2A, 0xFD, 0x08, 0xF7, 0xEC, 0x2C,
-    0x60, 0x0A, 0x87, 0x7B, 0xBD, 0x9F, 0x68, 0xAD, 0xDF, 0xC7, 0x60, 0x9B, 0x61, 0xF0, 0x42, 0x83,
-    0xA9, 0x1C, 0x5F, 0x4E, 0xE9, 0x5A, 0xD7, 0xBD, 0xD3, 0x5F, 0xA8, 0xAA, 0xBF, 0x45, 0xC5, 0x73,
-    0x42, 0x57, 0x50, 0x35, 0x70, 0xD5, 0xCC, 0x49, 0x91, 0x05, 0x50, 0x35, 0x10, 0xD9, 0xA1, 0x8B,
-    0x22, 0xEB, 0x43, 0xD5, 0x50, 0x47, 0xF2, 0xA2, 0x80, 0xE0, 0x9B, 0x51, 0xE0, 0x41, 0x55, 0x91,
-    0x55, 0x50, 0x35, 0x70, 0xD4, 0xCC, 0x09, 0x91, 0x75, 0xA1, 0x6A, 0x40, 0xE5, 0x97, 0xA8, 0x4A,
-    0x34, 0x71, 0x3B, 0x9C, 0x0E, 0x73, 0x6F, 0x79, 0x4D, 0xCD, 0x9E, 0xA5, 0xCD, 0x58, 0x9E, 0xA5,
-    0x1B, 0x59, 0x20, 0x75, 0xEC, 0x2F, 0x9A, 0x37, 0x4F, 0x90, 0x89, 0x19, 0xF6, 0x7C, 0x04, 0x00,
-    0x2E, 0xAD, 0xDE, 0x56, 0xCF, 0xD7, 0xBA, 0xFE, 0xF9, 0xF2, 0xAD, 0xF7, 0x1E, 0x7E, 0x4A, 0xF4,
-    0x9A, 0x21, 0x9E, 0x6A, 0x7D, 0x0F, 0x36, 0x50, 0x07, 0x2A, 0xA9, 0x3F, 0x88, 0x13, 0xB6, 0xA9,
-    0xB2, 0x33, 0xAB, 0xD8, 0xFD, 0xD3, 0x7A, 0xA8, 0x95, 0xBB, 0x25, 0x74, 0x79, 0x1C, 0x82, 0x76,
-    0xE0, 0xDE, 0xDF, 0x2E, 0xDC, 0x11, 0x59, 0x35, 0xDC, 0x18, 0x62, 0x8B, 0xAB, 0xB7, 0x2A, 0x9F,
-    0xBD, 0xC3, 0x9A, 0xF3, 0xE3, 0x4A, 0xAA, 0xBE, 0x15, 0xD1, 0x1B, 0x64, 0xBF, 0xAB, 0xA8, 0x9B,
-    0x90, 0xB8, 0xFD, 0xC5, 0x5F, 0x0B, 0x2B, 0x24, 0x6F, 0x97, 0x76, 0x93, 0xEA, 0xED, 0xDB, 0xD7,
-    0x47, 0xC7, 0x92, 0x7D, 0x08, 0x0F, 0x13, 0xD0, 0x7B, 0xBF, 0xCC, 0x07, 0x82, 0xD4, 0xAE, 0xDE,
-    0xEA, 0x7B, 0xBA, 0x9C, 0x09, 0xC7, 0x63, 0xF8, 0x99, 0x31, 0xB9, 0xEF, 0x63, 0x48, 0x0C, 0x1B,
-    0x83, 0xF6, 0xBD, 0x39, 0x43, 0xF4, 0xA8, 0xE3, 0xFB, 0x47, 0xA6, 0x57, 0x9B, 0x95, 0x69, 0x17,
-    0x8A, 0xAE, 0x62, 0xDC, 0x5D, 0xBE, 0x5A, 0x91, 0xF5, 0x5E, 0xDA, 0xDD, 0x79, 0x99, 0x0A, 0xF9,
-    0xC0, 0x3F, 0x04, 0x72, 0x2B, 0xDA, 0x4E, 0xDC, 0xE8, 0x6C, 0x87, 0x8A, 0x42, 0xAC, 0x29, 0x29,
-    0xA9, 0x33, 0x6B, 0xE7, 0x61, 0x4A, 0xDF, 0x5D, 0xA4, 0x29, 0x1B, 0xA1, 0x92, 0x8B, 0xA2, 0x4B,
-    0x5D, 0x27, 0x73, 0xF2, 0x01, 0x0D, 0x5C, 0x25, 0x15, 0xCC, 0x53, 0xC3, 0x1F, 0x9D, 0x2C, 0x11,
-    0xF9, 0xC0, 0xCA, 0x4F, 0xB4, 0x8A, 0x25, 0xBC, 0x32, 0xA1, 0x22, 0x8F, 0xFC, 0x3E, 0x1B, 0x7F,
-    0x4D, 0xD1, 0x25, 0x76, 0x41, 0x8F, 0xFD, 0x91, 0x1D, 0xAD, 0x43, 0x67, 0xF9, 0xD4, 0x38, 0xA6,
-    0x9D, 0x3D, 0x8B, 0xD3, 0xBE, 0x60, 0xA4, 0x89, 0x1A, 0xF8, 0x7F, 0x3E, 0x9B, 0xD3, 0x0F, 0x3A,
-    0xCE, 0x6F, 0x78, 0x5D, 0xEF, 0xE5, 0x80, 0xAB, 0x99, 0x59, 0xBC, 0xE6, 0xBC, 0x95, 0x93, 0x1B,
-    0x6F, 0xA7, 0x8B, 0x10, 0x16, 0xB1, 0x0B, 0x8F, 0xF7, 0xB1, 0x70, 0x64, 0xE7, 0x2C, 0xF9, 0x2C,
-    0x03, 0x1B, 0x3C, 0x61, 0x18, 0x53, 0x9F, 0xFC, 0x4B, 0xC0, 0x20, 0xF1, 0x76, 0x8C, 0x47, 0x60,
-    0x0B, 0xC7, 0x77, 0x63, 0x76, 0x90, 0x4B, 0x8C, 0x7B, 0x6E, 0xCC, 0x81, 0x70, 0xC9, 0x3D, 0xF7,
-    0x47, 0x9C, 0xDE, 0xD5, 0x25, 0x5D, 0x0A, 0x9E, 0x73, 0x94, 0xFB, 0x36, 0xBB, 0xC1, 0xEB, 0x05,
-    0x47, 0x0B, 0x48, 0xB1, 0xCC, 0x1C, 0x34, 0x25, 0xFB, 0xC3, 0x31, 0xF3, 0xAD, 0x98, 0x21, 0xD3,
-    0x85, 0x0E, 0x02, 0x11, 0x9D, 0xC1, 0x85, 0x55, 0xAB, 0xEC, 0x3C, 0x22, 0xFE, 0xAC, 0xB3, 0xCD,
-    0x2F, 0xED, 0x03, 0x8B, 0x13, 0xAC, 0x98, 0x65, 0x64, 0x02, 0x89, 0x5F, 0xE4, 0x98, 0x85, 0xD0,
-    0xE6, 0x30, 0x74, 0x15, 0x87, 0xA9, 0xB4, 0x8A, 0x67, 0x11, 0x1C, 0x92, 0xAA, 0x69, 0xAB, 0xB8,
-    0x24, 0xF3, 0x54, 0xFF, 0x58, 0xFD, 0x35, 0x9E, 0xCF, 0x03, 0x01, 0x85, 0xAD, 0xBC, 0x03, 0xC3,
-    0x48, 0xFB, 0x32, 0x8B, 0x7E, 0xCC, 0x89, 0xA1, 0x21, 0x6B, 0x1C, 0x08, 0xAD, 0x59, 0x1D, 0xE0,
-    0x17, 0x68, 0xE2, 0x36, 0xFC, 0xFE, 0x18, 0x2B, 0x43, 0x4E, 0xC1, 0x6E, 0x6B, 0xF0, 0xB3, 0xFD,
-    0xBC, 0x6E, 0x8C, 0xC1, 0x49, 0x45, 0x91, 0x03, 0x8B, 0x99, 0x7F, 0x9C, 0x30, 0xB2, 0x96, 0xAC,
-    0x9A, 0xC9, 0x31, 0x05, 0x2D, 0x0E, 0x6F, 0xD7, 0x0E, 0x02, 0xF0, 0xE8, 0xE2, 0x38, 0x2A, 0x43,
-    0x3E, 0x2C, 0x50, 0x0B, 0xED, 0xE6, 0xC5, 0xDD, 0x7C, 0xD3, 0xD2, 0x67, 0x3E, 0x24, 0x39, 0x87,
-    0x74, 0xA1, 0x9D, 0xFD, 0x09, 0x03, 0xCB, 0x3B, 0x80, 0x90, 0x3E, 0x60, 0x5E, 0x30, 0xDE, 0xCB,
-    0x08, 0x6F, 0x24, 0x50, 0x1D, 0x6E, 0x92, 0x23, 0xF8, 0xE1, 0xEA, 0x08, 0xC5, 0x48, 0x70, 0x9C,
-    0x7B, 0x4B, 0x4B, 0x35, 0xE7, 0xAA, 0x12, 0xB9, 0x4E, 0x14, 0x98, 0xE1, 0x64, 0xC0, 0x7D, 0x09,
-    0xBB, 0x93, 0x1F, 0xB6, 0x3C, 0x11, 0x65, 0xAD, 0x14, 0x36, 0xF3, 0x90, 0xD1, 0x38, 0x61, 0x59,
-    0xF4, 0x34, 0x85, 0x98, 0xE3, 0x28, 0xE0, 0x50, 0x18, 0xE2, 0xE0, 0xAC, 0xE3, 0x10, 0xB0, 0x1B,
-    0x45, 0x46, 0xB8, 0xA7, 0x24, 0xC4, 0x7E, 0x9A, 0xE6, 0x9C, 0x89, 0xAC, 0xB5, 0x0C, 0x20, 0x3F,
-    0xE9, 0x96, 0xCC, 0x7F, 0x62, 0x04, 0xCE, 0x92, 0x34, 0xC4, 0x10, 0x8C, 0x50, 0x92, 0xA1, 0x24,
-    0x61, 0x98, 0xBF, 0xC1, 0x09, 0x9D, 0xC1, 0xA5, 0xE6, 0xF5, 0xCD, 0x42, 0x0E, 0x8F, 0x3E, 0x27,
-    0xD7, 0x8A, 0x4C, 0x66, 0x06, 0x6C, 0x66, 0x04, 0x54, 0x8C, 0x9D, 0x5B, 0x4B, 0x29, 0x9B, 0x39,
-    0xE0, 0x92, 0xA3, 0xE6, 0x4C, 0x56, 0x42, 0x27, 0xF1, 0x4F, 0x0E, 0x8E, 0x6B, 0x98, 0x0F, 0xD0,
-    0xDE, 0x67, 0x62, 0xD8, 0xF8, 0x09, 0x4C, 0x62, 0x1B, 0xA3, 0xD0, 0xD3, 0x14, 0xC0, 0x02, 0x5A,
-    0x90, 0xC7, 0xA4, 0x8B, 0x37, 0xF1, 0x28, 0x66, 0x88, 0x7F, 0x89, 0xB9, 0x71, 0xAD, 0xE0, 0x71,
-    0xDC, 0x69, 0xAC, 0x87, 0xB8, 0xC3, 0x59, 0x8C, 0xE3, 0xB9, 0xC2, 0x7D, 0xE7, 0x0A, 0x08, 0x84,
-    0x0C, 0x2E, 0x25, 0x4A, 0x02, 0x57, 0x79, 0xBC, 0x56, 0x5D, 0x2E, 0xAC, 0x12, 0x54, 0x06, 0x88,
-    0x74, 0xE4, 0x9B, 0xDC, 0xDA, 0x5E, 0x5A, 0x56, 0x5C, 0xB6, 0x44, 0x50, 0x2C, 0xE4, 0x72, 0x60,
-    0xC0, 0xFA, 0x54, 0x7D, 0x5E, 0x46, 0x5E, 0xF1, 0x8C, 0xAB, 0x2B, 0xE4, 0x0E, 0x04, 0xB9, 0x29,
-    0x4E, 0xB6, 0x47, 0x9C, 0x2F, 0x13, 0x13, 0x5F, 0x81, 0x51, 0xDD, 0x37, 0x35, 0x8A, 0x8C, 0x59,
-    0x14, 0x57, 0xF1, 0x03, 0x91, 0xF3, 0x03, 0xBB, 0x10, 0xAC, 0x61, 0x45, 0xCC, 0x2B, 0xA1, 0x10,
-    0xF3, 0xC0, 0x11, 0x0F, 0x50, 0x6C, 0x60, 0x86, 0xBC, 0xB5, 0x54, 0x19, 0xFA, 0xAC, 0x6B, 0xC1,
-    0x56, 0x84, 0x64, 0x4C, 0x0A, 0xAE, 0x00, 0x1E, 0x03, 0x93, 0x13, 0x61, 0x15, 0xA9, 0xC7, 0xB8,
-    0x62, 0xA5, 0x0D, 0x3B, 0x4C, 0xE9, 0x34, 0xA7, 0x12, 0x01, 0x4B, 0xF1, 0xB0, 0x98, 0xE9, 0xCA,
-    0x38, 0x4C, 0x76, 0xEB, 0xA5, 0x3D, 0x05, 0x14, 0xFB, 0x2E, 0xBB, 0xA7, 0x37, 0xB9, 0xE0, 0xA5,
-    0x72, 0xB7, 0x90, 0xC0, 0x52, 0x38, 0x1F, 0x8A, 0x4F, 0x5E, 0x1C, 0x06, 0x9A, 0xF1, 0x23, 0xF6,
-    0x6E, 0x5E, 0xA7, 0x83, 0x2B, 0xED, 0x8A, 0x5A, 0x73, 0x06, 0x05, 0x26, 0xD9, 0x2A, 0x6E, 0x43,
-    0x02, 0x4A, 0x8D, 0x20, 0xDF, 0xCB, 0x17, 0x7A, 0x2F, 0x66, 0x26, 0x2C, 0x83, 0x16, 0x47, 0xDA,
-    0x0B, 0x3C, 0x81, 0xD8, 0x6B, 0x37, 0x7B, 0xD1, 0x67, 0x9F, 0xF0, 0x05, 0xE6, 0x40, 0x0D, 0xCD,
-    0xF5, 0xD6, 0x69, 0xC3, 0xD3, 0xB8, 0x06, 0xE7, 0x82, 0xD6, 0xA9, 0x9F, 0x08, 0x69, 0x40, 0x98,
-    0xCC, 0x49, 0x36, 0xE4, 0xBE, 0x9F, 0x01, 0x67, 0xAD, 0x36, 0x60, 0x9F, 0x8C, 0xD4, 0x53, 0x54,
-    0xFA, 0xD4, 0x75, 0xD5, 0x01, 0x5A, 0x6C, 0x43, 0x40, 0xB4, 0x4F, 0xBA, 0xBD, 0xDE, 0xDE, 0x39,
-    0xED, 0x05, 0x92, 0x3A, 0x93, 0xBE, 0xD0, 0x13, 0x9F, 0xC3, 0x94, 0xE7, 0x68, 0xBD, 0x0E, 0x02,
-    0xA7, 0x61, 0x66, 0x1F, 0xC8, 0x80, 0x05, 0x80, 0x85, 0xD3, 0x26, 0x6D, 0x90, 0x56, 0xBF, 0xE4,
-    0x2F, 0x1D, 0x61, 0x0D, 0x0F, 0x23, 0x02, 0xA4, 0x72, 0x15, 0x52, 0x4A, 0xC4, 0x65, 0x63, 0x95,
-    0x36, 0x70, 0xA5, 0x01, 0xE2, 0xC6, 0xC9, 0xBE, 0xF0, 0xC4, 0x05, 0xDF, 0x0A, 0xCC, 0x42, 0xE5,
-    0x36, 0xF6, 0xDD, 0x32, 0x11, 0x1F, 0xB2, 0xD9, 0x40, 0x00, 0x95, 0xA0, 0x17, 0xE1, 0xC5, 0x47,
-    0x3A, 0xF8, 0xFA, 0x45, 0x50, 0xB1, 0x44, 0x96, 0x74, 0xDD, 0xCB, 0xF1, 0xF1, 0x71, 0x29, 0xF9,
-    0x96, 0xAE, 0x1E, 0x95, 0x80, 0x55, 0xA2, 0x86, 0x09, 0x91, 0x12, 0x75, 0x13, 0xB1, 0x29, 0x2B,
-    0x12, 0x9F, 0xFE, 0x0C, 0xE0, 0x98, 0x93, 0x9F, 0xE1, 0xE0, 0x14, 0x38, 0x58, 0x95, 0x09, 0x0D,
-    0xD3, 0x0B, 0xF1, 0x61, 0xF0, 0x9D, 0x4F, 0x4F, 0xD3, 0x20, 0xD4, 0x35, 0x2D, 0x84, 0x98, 0x30,
-    0x30, 0xF7, 0x76, 0x9F, 0xD6, 0x93, 0x19, 0x66, 0xAE, 0x97, 0x89, 0x9B, 0xAF, 0x18, 0xB0, 0xAD,
-    0x99, 0x7C, 0xCC, 0xF9, 0x6D, 0x0A, 0xBE, 0xED, 0x44, 0xB4, 0x83, 0x90, 0x3E, 0xC4, 0x5E, 0x3E,
-    0xC1, 0x53, 0xB8, 0xA2, 0x58, 0x47, 0xFC, 0x04, 0x21, 0xC0, 0x78, 0x1D, 0x68, 0x1B, 0x04, 0x10,
-    0x67, 0xFD, 0x2A, 0xCA, 0xC0, 0x0E, 0x9A, 0x9A, 0xF5, 0xCB, 0x15, 0x4E, 0xA4, 0x12, 0xEB, 0xC0,
-    0xB3, 0x20, 0x00, 0x8F, 0xF5, 0x4C, 0xAA, 0x20, 0x00, 0xCE, 0xAC, 0x67, 0x76, 0x89, 0x13, 0xB9,
-    0xB6, 0x8E, 0xAA, 0x03, 0x27, 0xF6, 0x26, 0x4E, 0xE4, 0x08, 0x8B, 0x3D, 0xC4, 0x89, 0xCD, 0x27,
-    0x32, 0x33, 0xD1, 0xD4, 0x86, 0xA1, 0x89, 0xD2, 0x36, 0xB5, 0x4A, 0x7A, 0x30, 0xAD, 0xB9, 0x80,
-    0x0B, 0x1A, 0x22, 0x2E, 0xD1, 0x64, 0xCC, 0x67, 0xC8, 0xE7, 0x4E, 0xC1, 0x2D, 0x4D, 0xC5, 0x01,
-    0x5C, 0xFB, 0x3C, 0x87, 0x83, 0xBD, 0xCB, 0x01, 0x1E, 0x7E, 0xDE, 0xC1, 0x3C, 0xE5, 0xF7, 0x16,
-    0x00, 0x9C, 0x40, 0x6D, 0xCC, 0xAD, 0x41, 0x45, 0xA0, 0x69, 0x81, 0x41, 0x4D, 0xDE, 0x01, 0x0F,
-    0xE6, 0x6E, 0xFA, 0x50, 0x13, 0xCE, 0x8C, 0x25, 0x06, 0xEB, 0x5A, 0x34, 0x0F, 0xF6, 0xE4, 0xFA,
-    0xA7, 0x2C, 0xD0, 0x61, 0x53, 0xB2, 0x47, 0x5C, 0x0D, 0x03, 0x73, 0xC4, 0x47, 0xDC, 0x4A, 0xA1,
-    0x83, 0x44, 0x12, 0xDA, 0xF7, 0x8D, 0x08, 0x64, 0x45, 0x8C, 0x25, 0xD5, 0x21, 0x20, 0x54, 0x0A,
-    0x4F, 0xE9, 0xA0, 0x26, 0x86, 0x6D, 0xA2, 0x6F, 0x46, 0x16, 0xC3, 0x52, 0x95, 0xE3, 0x83, 0x1D,
-    0xBD, 0xF6, 0x60, 0x26, 0x7E, 0xAA, 0xB2, 0x60, 0x31, 0x5E, 0xCC, 0x29, 0xF0, 0x62, 0xA9, 0x16,
-    0x44, 0x61, 0x55, 0x35, 0xF2, 0xA4, 0xC9, 0xC5, 0x02, 0x4D, 0x5C, 0x53, 0x51, 0xE8, 0xE4, 0x52,
-    0x79, 0xE7, 0x0B, 0x1A, 0x7C, 0x8F, 0xAC, 0x71, 0x65, 0x0C, 0xBB, 0xB9, 0x7A, 0xA3, 0x64, 0x19,
-    0xB9, 0x85, 0x1E, 0xB2, 0x8C, 0x92, 0x65, 0xF4, 0x59, 0xC6, 0x3E, 0xCB, 0x58, 0x42, 0x46, 0x91,
-    0x43, 0x46, 0x57, 0x41, 0x28, 0x2F, 0x0A, 0x39, 0x67, 0xE3, 0x80, 0x04, 0xDA, 0x45, 0xFD, 0x14,
-    0xA2, 0xEF, 0x85, 0x8C, 0x98, 0xB2, 0xE0, 0x9D, 0x61, 0x19, 0xB9, 0x4B, 0x73, 0x10, 0xA2, 0x85,
-    0x60, 0x19, 0x39, 0x55, 0x47, 0xF2, 0x57, 0x90, 0xD1, 0x36, 0xF6, 0x62, 0x5F, 0x72, 0xB3, 0x71,
-    0x06, 0x34, 0xAE, 0xCD, 0x8E, 0xDE, 0xFA, 0x11, 0x97, 0xE4, 0x5D, 0xDE, 0x62, 0xF9, 0x2D, 0x50,
-    0xE7, 0x63, 0xBC, 0xB4, 0x55, 0x7E, 0xA5, 0x1B, 0x37, 0x18, 0xC0, 0xB9, 0xAC, 0xF3, 0xD1, 0xD2,
-    0x8A, 0x2D, 0x4A, 0xCD, 0xFE, 0x8A, 0x65, 0x7A, 0x58, 0x93, 0x22, 0xF7, 0xC3, 0x88, 0xA8, 0xB5,
-    0x4D, 0x4E, 0xE6, 0x90, 0x37, 0x99, 0x75, 0xEE, 0xA9, 0xF0, 0x66, 0x98, 0xE1, 0x4D, 0x10, 0xE2,
-    0x26, 0xBB, 0x42, 0xF0, 0x54, 0xA8, 0xFE, 0xA7, 0xDA, 0x90, 0xFE, 0xBF, 0xEB, 0x0D, 0x27, 0xF5,
-    0x18, 0x7B, 0xB9, 0x8C, 0x9D, 0x7B, 0x66, 0xD7, 0x3B, 0x79, 0x0B, 0xE0, 0x2B, 0xB2, 0xDA, 0x73,
-    0xE3, 0x1D, 0xDC, 0x40, 0xFD, 0x6D, 0x17, 0xAB, 0x5C, 0x52, 0x6E, 0xD8, 0x35, 0x67, 0x73, 0x38,
-    0x5D, 0x35, 0xEE, 0x14, 0xB8, 0x69, 0x91, 0xAA, 0x5D, 0x6F, 0x31, 0x1E, 0xE3, 0x30, 0xE5, 0xBA,
-    0xAE, 0x8F, 0x22, 0x26, 0x44, 0x15, 0xE3, 0x03, 0x78, 0x65, 0xEC, 0xC3, 0xBF, 0x4C, 0x2D, 0x9E,
-    0x70, 0x0B, 0x85, 0xDA, 0xCD, 0x2E, 0x60, 0xA5, 0x70, 0x40, 0xC6, 0x8B, 0x4D, 0x35, 0xC9, 0x65,
-    0xE5, 0xC3, 0xE5, 0xD4, 0x67, 0x6E, 0x04, 0xAD, 0x4B, 0x31, 0x2F, 0x7E, 0xCC, 0xB9, 0x08, 0x52,
-    0x89, 0xEC, 0xC0, 0x48, 0x46, 0x56, 0x1D, 0x60, 0xDD, 0x4B, 0x72, 0xD7, 0x32, 0xF2, 0x91, 0xF1,
-    0xF9, 0x32, 0x87, 0xF3, 0x8B, 0x6D, 0x5D, 0x4A, 0x98, 0xAB, 0xDB, 0x8B, 0x76, 0xE7, 0x46, 0x63,
-    0xD0, 0x6D, 0xF3, 0x2F, 0x97, 0x88, 0x51, 0x18, 0x79, 0x6A, 0x00, 0xAB, 0xF5, 0xCD, 0x6E, 0x9B,
-    0xC4, 0xF0, 0x01, 0x83, 0x23, 0x64, 0xB8, 0x82, 0x12, 0x60, 0xB5, 0x19, 0x00, 0xEE, 0x04, 0x0B,
-    0x9D, 0xD0, 0x10, 0xCF, 0x5D, 0xE8, 0x60, 0xF1, 0x6A, 0x27, 0x18, 0x7D, 0xF3, 0x3D, 0x4D, 0x75,
-    0xE2, 0xEB, 0x22, 0xF1, 0x18, 0x4B, 0xA7, 0xCC, 0x02, 0x21, 0xCA, 0xD1, 0xFE, 0x71, 0x89, 0xE7,
-    0xA8, 0x31, 0xCA, 0xDB, 0xE9, 0xA2, 0xAB, 0x1B, 0x7B, 0xC3, 0xCB, 0x4C, 0xA4, 0xF8, 0xA6, 0xDC,
-    0x7B, 0xA5, 0xF0, 0x75, 0x3D, 0xBC, 0x39, 0x1F, 0x92, 0x7B, 0x87, 0xEC, 0x1D, 0x45, 0x4D, 0x41,
-    0xC3, 0x05, 0x1A, 0x5E, 0xD3, 0xA3, 0x22, 0xAD, 0x3A, 0xC6, 0xB4, 0xD3, 0x6D, 0xF1, 0x16, 0x71,
-    0x8D, 0x0E, 0x1D, 0xDA, 0x1C, 0xF6, 0x75, 0xA9, 0xED, 0x37, 0x9D, 0x96, 0xAB, 0xD1, 0x66, 0xE5,
-    0x0E, 0x0A, 0xE9, 0xB6, 0x64, 0xFB, 0xBA, 0xD4, 0xE6, 0x2C, 0xD2, 0xE7, 0xB2, 0xBF, 0xE8, 0x02,
-    0xFD, 0xD2, 0xBE, 0x56, 0xCD, 0x83, 0x0D, 0x8A, 0x95, 0xCA, 0x5D, 0x1C, 0x9A, 0x86, 0x97, 0xCB,
-    0x59, 0x9F, 0xAC, 0x57, 0x55, 0xAA, 0xEF, 0xEA, 0x0B, 0x49, 0x4D, 0x7E, 0xC2, 0xD4, 0xC4, 0x8E,
-    0xB2, 0x46, 0x95, 0xA5, 0x43, 0xBD, 0x79, 0x45, 0xE7, 0x85, 0xD5, 0x3A, 0x51, 0xE5, 0x01, 0xD0,
-    0xB2, 0xFB, 0x9D, 0xCF, 0xD7, 0x25, 0x05, 0x98, 0xC3, 0xB3, 0x43, 0x4E, 0xC4, 0x3D, 0x4C, 0x79,
-    0xD1, 0x34, 0x8D, 0x2D, 0xCD, 0xE5, 0x0D, 0xD4, 0xE2, 0xF1, 0x9F, 0x9D, 0xD2, 0x98, 0x14, 0x3A,
-    0xC2, 0x31, 0x0F, 0x27, 0x68, 0x54, 0xBC, 0xAD, 0x57, 0xAF, 0x29, 0xD6, 0x71, 0x15, 0xF0, 0x97,
-    0x90, 0x77, 0x3D, 0xF6, 0x3E, 0xD1, 0xBA, 0xEF, 0x37, 0x92, 0xB5, 0xB2, 0xD2, 0x1C, 0x09, 0x29,
-    0x04, 0xDF, 0x86, 0xB6, 0x5C, 0xFD, 0x37, 0x54, 0xED, 0x8E, 0x69, 0x27, 0xA5, 0xB2, 0x0C, 0x29,
-    0x78, 0x6C, 0x6F, 0xD4, 0x3B, 0x13, 0x03, 0xBD, 0x75, 0xE3, 0x6D, 0x9D, 0xB9, 0xB5, 0xF4, 0xFB,
-    0x7A, 0xCC, 0xC1, 0x98, 0xB3, 0x15, 0xDF, 0xE7, 0x82, 0xC9, 0xDE, 0xCC, 0xAD, 0x35, 0xAD, 0x5D,
-    0xDE, 0x0C, 0xCD, 0x1D, 0x24, 0x93, 0xD6, 0x61, 0x7C, 0xC4, 0xB8, 0x56, 0xE9, 0x2B, 0xD9, 0x82,
-    0x11, 0x0D, 0x7E, 0x7E, 0x7F, 0x7F, 0xDA, 0x8B, 0x26, 0x3D, 0x0B, 0x9C, 0x40, 0x94, 0x56, 0x3C,
-    0x04, 0xB2, 0x63, 0xA6, 0x1B, 0xF1, 0x16, 0x89, 0xB5, 0xDA, 0xEE, 0x37, 0x16, 0x74, 0xB4, 0xE2,
-    0xBD, 0x24, 0xA6, 0xC6, 0x21, 0x0A, 0x42, 0x3C, 0x9F, 0xFD, 0xAF, 0xC5, 0xE2, 0x03, 0x4D, 0x64,
-    0x43, 0x81, 0xD5, 0x1F, 0x55, 0xE8, 0x8D, 0xD7, 0x0A, 0xCE, 0x51, 0x62, 0xF3, 0x66, 0x6F, 0x88,
-    0x44, 0xB1, 0xB9, 0xBD, 0xB4, 0x34, 0x68, 0xA3, 0x24, 0x6C, 0xB7, 0x02, 0x64, 0x6E, 0xC5, 0x21,
-    0x42, 0x3F, 0x45, 0x29, 0x37, 0xDD, 0x3A, 0x21, 0x88, 0xDA, 0xBB, 0x95, 0xF5, 0x38, 0xE8, 0x1F,
-    0x87, 0x26, 0x87, 0x61, 0x6D, 0x7A, 0x7E, 0xEF, 0x65, 0x25, 0xB2, 0x59, 0x58, 0x62, 0xEE, 0x71,
-    0x69, 0x46, 0xDC, 0x2A, 0x66, 0xBC, 0x11, 0xFE, 0xAD, 0xDD, 0xCD, 0x03, 0x9A, 0xDF, 0x40, 0xAD,
-    0x9C, 0xBB, 0x1B, 0xF3, 0xE7, 0x10, 0xC8, 0xA1, 0x69, 0x9A, 0xC3, 0x85, 0xDE, 0x4F, 0x37, 0xB1,
-    0x58, 0xC3, 0xA5, 0xA5, 0x3F, 0x98, 0x2D, 0x58, 0xB3, 0x44, 0x30, 0x2F, 0x35, 0x74, 0x84, 0x5B,
-    0x4A, 0x4E, 0xC1, 0xA0, 0x70, 0x18, 0x8D, 0x5F, 0x0D, 0x2C, 0x2A, 0x59, 0xB4, 0x37, 0xEC, 0xC2,
-    0x55, 0x3E, 0xA3, 0xD9, 0xC3, 0x5F, 0xD6, 0x9C, 0x17, 0xA3, 0xAD, 0xE6, 0x5D, 0x4B, 0x3A, 0xFA,
-    0xF9, 0xAF, 0x98, 0x2F, 0xB6, 0xA4, 0x80, 0x2F, 0x95, 0xE2, 0x6E, 0x39, 0x6B, 0x95, 0x73, 0xC6,
-    0x8E, 0x47, 0xD9, 0x3B, 0xE0, 0x8A, 0x06, 0x39, 0xBF, 0xE4, 0x94, 0x2C, 0xF9, 0xC2, 0xC7, 0x59,
-    0x3D, 0xC6, 0xFC, 0xA3, 0xB8, 0x85, 0xFB, 0xF0, 0xAD, 0xFF, 0x7D, 0x62, 0x3E, 0x27, 0x6D, 0x45,
-    0xC3, 0x65, 0xB4, 0xE8, 0xC8, 0x20, 0x12, 0x56, 0x4F, 0xD1, 0x12, 0x96, 0x5C, 0xB3, 0xB8, 0x2D,
-    0x02, 0xFF, 0xE2, 0x77, 0x70, 0xA9, 0xA6, 0x94, 0x37, 0xCF, 0x54, 0x7E, 0x64, 0xD7, 0x40, 0x5E,
-    0x20, 0x29, 0x25, 0xFD, 0xF1, 0x18, 0xB4, 0xED, 0x78, 0x05, 0x45, 0x0B, 0x99, 0x39, 0x70, 0x5C,
-    0x60, 0x1D, 0x57, 0x6A, 0x56, 0x8B, 0x02, 0x61, 0xF6, 0x4B, 0x99, 0x6A, 0xCA, 0x86, 0x6A, 0x0C,
-    0x03, 0xAF, 0x7B, 0x95, 0x7B, 0x4D, 0x97, 0xE9, 0xC6, 0xFC, 0xD5, 0x82, 0x56, 0x56, 0x49, 0xDC,
-    0xCE, 0x1E, 0x65, 0x23, 0xB7, 0xCB, 0xDD, 0x2A, 0xAD, 0x92, 0xC1, 0x20, 0x23, 0xDB, 0x03, 0x09,
-    0x9D, 0xFC, 0xD2, 0xF4, 0xD2, 0xEE, 0xA7, 0xF3, 0x99, 0x17, 0x8B, 0x22, 0x6C, 0x37, 0x31, 0xEA,
-    0xC1, 0x58, 0xC0, 0xC1, 0x7D, 0x41, 0xEB, 0x90, 0xE1, 0x24, 0xB2, 0x21, 0xAC, 0x9B, 0x9B, 0x7E,
-    0x64, 0x22, 0xAC, 0x29, 0x57, 0x16, 0xDA, 0x6A, 0x85, 0x53, 0x16, 0xC7, 0xC7, 0xA4, 0x2D, 0x78,
-    0x12, 0xF4, 0x79, 0xA0, 0x29, 0xC6, 0x0A, 0x9B, 0xB7, 0xED, 0x1C, 0xBD, 0xD7, 0x64, 0x23, 0xEB,
-    0x49, 0xD0, 0x9F, 0x06, 0x64, 0xEB, 0x17, 0x94, 0xB8, 0xA3, 0x63, 0xE7, 0x94, 0xBE, 0xDF, 0xD1,
-    0x3C, 0x11, 0xDB, 0x00, 0x28, 0x4A, 0xBF, 0x1D, 0xAF, 0xDD, 0x2F, 0x2A, 0x9E, 0x08, 0x6D, 0xC6,
-    0x8C, 0x61, 0x6B, 0xF6, 0xB1, 0x35, 0x7A, 0xBD, 0xDE, 0x4B, 0x08, 0x41, 0x8F, 0x5B, 0xC6, 0xC9,
-    0x87, 0x77, 0x6B, 0x8A, 0x16, 0xBF, 0x26, 0x8D, 0x88, 0xBF, 0x81, 0xD6, 0x55, 0x17, 0x2D, 0x73,
-    0x09, 0xE6, 0x3E, 0x98, 0xF7, 0xAB, 0x01, 0x95, 0x09, 0x9A, 0xD1, 0x64, 0xE0, 0xAA, 0x64, 0xE0,
-    0x51, 0x82, 0x6E, 0xB0, 0x0E, 0x2B, 0x30, 0x2F, 0xC0, 0x3C, 0x77, 0x73, 0x34, 0xFC, 0xB1, 0x0F,
-    0xE6, 0xCF, 0x80, 0x1B, 0x57, 0x6A, 0xEC, 0xEB, 0x2B, 0xED, 0x92, 0xF3, 0xFE, 0x8A, 0xE9, 0x82,
-    0x0E, 0xC4, 0xF4, 0xC3, 0x47, 0xF0, 0xC9, 0x84, 0x1C, 0x78, 0x6F, 0x13, 0x46, 0xE1, 0x47, 0x5A,
-    0xAF, 0x3A, 0xFA, 0x83, 0xDC, 0x68, 0x70, 0xDA, 0xC8, 0xC9, 0xB8, 0xD1, 0x6F, 0xDB, 0xCB, 0xE8,
-    0xB1, 0x69, 0x02, 0x12, 0x05, 0x07, 0x27, 0xBA, 0x72, 0x2F, 0x76, 0x54, 0x00, 0xC7, 0x9F, 0x7B,
-    0x5C, 0x9A, 0xF8, 0xEF, 0x3A, 0xA8, 0xC3, 0x12, 0x3A, 0x62, 0x4F, 0x20, 0xF1, 0x2B, 0xFD, 0xB0,
-    0x72, 0xA3, 0x14, 0x8D, 0xAF, 0x77, 0xF2, 0xE1, 0x68, 0x76, 0xB7, 0x79, 0xE4, 0x5E, 0x96, 0xFB,
-    0x97, 0xEA, 0x01, 0x6B, 0xD2, 0xF3, 0xC4, 0x62, 0x5A, 0x25, 0xD2, 0xD0, 0x95, 0x82, 0x7F, 0xB0,
-    0xB0, 0x4A, 0x19, 0x33, 0xF2, 0x75, 0x29, 0x40, 0x41, 0x8C, 0x5E, 0xC7, 0x02, 0x30, 0xF3, 0x9E,
-    0xA3, 0x7B, 0x2D, 0x26, 0xC9, 0x3F, 0x66, 0xC2, 0x78, 0xC3, 0xD8, 0x38, 0x85, 0x28, 0x5A, 0x1F,
-    0x49, 0xDA, 0xFA, 0x0F, 0xAE, 0x92, 0xA2, 0x0E, 0x6D, 0x68, 0xB7, 0xB6, 0x64, 0x30, 0xF0, 0xDB,
-    0x9F, 0x39, 0x76, 0x2F, 0x9D, 0x2D, 0x4A, 0x38, 0x91, 0xFE, 0x3A, 0x45, 0x51, 0xB3, 0x82, 0x5A,
-    0xB9, 0x5E, 0x21, 0xFB, 0x1E, 0x7A, 0xB2, 0xAB, 0x8A, 0xBC, 0x79, 0x24, 0x4F, 0x88, 0xF3, 0x1F,
-    0xB0, 0xBB, 0x0A, 0xC4, 0xF7, 0x95, 0x55, 0xA5, 0xCA, 0xBB, 0xB2, 0xA3, 0x47, 0xEE, 0xFB, 0x1A,
-    0x52, 0xCD, 0xED, 0x21, 0x75, 0x9F, 0xB2, 0x31, 0x19, 0xB7, 0x7E, 0xBC, 0xE9, 0x78, 0xFC, 0xC0,
-    0xC4, 0x35, 0x0F, 0xC6, 0x74, 0x90, 0x49, 0x76, 0x4D, 0x19, 0xCB, 0x3F, 0xC1, 0xC2, 0xFD, 0x18,
-    0xD2, 0x65, 0x2C, 0xA3, 0x3E, 0x5E, 0x2E, 0xA8, 0x0F, 0x05, 0xAA, 0x3E, 0xD9, 0x9F, 0xE4, 0x24,
-    0xAE, 0x47, 0xED, 0xEF, 0x9F, 0x79, 0xBB, 0x6F, 0x58, 0xB7, 0x59, 0xCB, 0x6F, 0x7D, 0x1C, 0x65,
-    0xAF, 0xCF, 0xEB, 0x0C, 0xD5, 0xFF, 0x0B, 0xC5, 0x5A, 0x3F, 0x6C, 0x1C, 0xD7, 0x99, 0xFF, 0xDE,
-    0x8C, 0xB8, 0x73, 0xC9, 0xE0, 0x30, 0x2A, 0x28, 0x9C, 0x23, 0xE2, 0x3C, 0x57, 0x5E, 0x8C, 0x88,
-    0xD3, 0xA4, 0x48, 0xC1, 0xDD, 0x19, 0x9D, 0x90, 0xA4, 0x70, 0x21, 0x22, 0xA7, 0x75, 0x80, 0x53,
-    0xA1, 0x14, 0x2E, 0x8C, 0x00, 0x07, 0xA6, 0x48, 0x91, 0x62, 0xFF, 0xE5, 0x02, 0xDC, 0x15, 0x29,
-    0x8E, 0x45, 0x8C, 0x2B, 0x52, 0x9C, 0x8B, 0x00, 0x49, 0x28, 0x20, 0x76, 0xE1, 0x42, 0x07, 0x0C,
-    0xB9, 0x63, 0xAB, 0x10, 0x70, 0x2E, 0x34, 0x32, 0x73, 0xB8, 0xC2, 0x85, 0x26, 0x31, 0x89, 0x03,
-    0xE4, 0x42, 0xE3, 0x68, 0x04, 0x0D, 0xAD, 0xD9, 0x7D, 0xF7, 0xFB, 0xBD, 0x99, 0x25, 0x69, 0x93,
-    0xB2, 0x48, 0x8A, 0x4C, 0x96, 0xDC, 0xDD, 0xB7, 0x33, 0xF3, 0xDE, 0xFB, 0xFE, 0x7F, 0xBF, 0xEF,
-    0xBD, 0x27, 0xA1, 0x4E, 0x45, 0xB4, 0x1E, 0x89, 0xEA, 0x5E, 0x93, 0xE6, 0x55, 0xE2, 0xED, 0xE4,
-    0xF8, 0x08, 0x71, 0x4F, 0x9E, 0x26, 0x22, 0xEE, 0x5D, 0x34, 0x3A, 0x1D, 0x11, 0x95, 0xC7, 0x22,
-    0x5E, 0x52, 0x88, 0xB4, 0xED, 0x5C, 0xAC, 0xDC, 0x49, 0xC4, 0x1B, 0x79, 0x23, 0xE9, 0x4B, 0x20,
-    0x96, 0xD6, 0x13, 0xF1, 0xB4, 0x2E, 0x65, 0xB0, 0x76, 0x33, 0xC7, 0x6D, 0x3B, 0xF5, 0x23, 0x3C,
-    0x8C, 0x1E, 0xFE, 0x95, 0x0C, 0xFD, 0x7D, 0x0C, 0x12, 0x57, 0x18, 0xA4, 0xB0, 0xF1, 0x24, 0x26,
-    0xBD, 0xD0, 0x8D, 0x38, 0xDF, 0xDB, 0x5B, 0xE8, 0x3A, 0xFA, 0x2F, 0x07, 0xA3, 0x86, 0x98, 0x2B,
-    0xC1, 0xB8, 0x72, 0x21, 0x76, 0xB5, 0xF6, 0x77, 0xAE, 0xDF, 0x4D, 0x2C, 0x10, 0xB0, 0x91, 0x4B,
-    0x18, 0x8B, 0x7F, 0x7F, 0xE4, 0x3F, 0xD2, 0xBA, 0x17, 0x4C, 0x3D, 0x39, 0x8F, 0x7E, 0x7F, 0x27,
-    0xAB, 0x22, 0x99, 0x33, 0xC2, 0xCC, 0x18, 0xD5, 0xD2, 0x20, 0x54, 0x96, 0x67, 0x4C, 0x80, 0x28,
-    0x91, 0x21, 0xDE, 0xF6, 0x84, 0xBF, 0x62, 0xCE, 0x0D, 0x9E, 0xEC, 0x8F, 0x41, 0x89, 0x8F, 0x39,
-    0xA4, 0xF2, 0x22, 0x50, 0x88, 0x09, 0x03, 0xE9, 0x91, 0xE7, 0x52, 0x9C, 0x14, 0x13, 0x07, 0x1A,
-    0x12, 0xD1, 0xA0, 0xC7, 0x79, 0xB0, 0x36, 0x26, 0x3D, 0x6D, 0x05, 0xBA, 0x2A, 0xF4, 0x50, 0x05,
-    0x04, 0x60, 0xFF, 0x21, 0xA7, 0x38, 0xD0, 0xDF, 0x8F, 0x2C, 0xF9, 0x0A, 0xA7, 0x0F, 0x74, 0xC2,
-    0xB9, 0xE7, 0xCC, 0xB4, 0x5F, 0x9D, 0x46, 0x81, 0x2E, 0xDD, 0xD5, 0x21, 0x06, 0xC7, 0x93, 0x31,
-    0x87, 0x57, 0xD7, 0x93, 0xB1, 0xFE, 0x54, 0xBF, 0x09, 0xDE, 0x83, 0x58, 0xDC, 0x87, 0x62, 0x3F,
-    0x4D, 0xD4, 0xA4, 0x54, 0x3A, 0xD4, 0x4F, 0xDE, 0xD7, 0x59, 0xAE, 0xFE, 0x3C, 0x42, 0x47, 0xC3,
-    0xA5, 0xBC, 0x7F, 0x42, 0xA1, 0x50, 0x56, 0x1E, 0xE7, 0xED, 0x50, 0x62, 0x63, 0x0A, 0x6B, 0x1E,
-    0x8A, 0x90, 0xB1, 0xCE, 0x0C, 0xF1, 0x52, 0x19, 0x4D, 0x80, 0x01, 0x50, 0x1F, 0xE8, 0x0A, 0xAA,
-    0xB8, 0x9D, 0x4B, 0x0C, 0xF2, 0x3F, 0x48, 0xA4, 0x82, 0x2E, 0xEE, 0x64, 0x4E, 0x05, 0xFA, 0x93,
-    0x71, 0xB9, 0x24, 0xE7, 0xA1, 0x03, 0x85, 0xC9, 0x96, 0xEA, 0x81, 0x31, 0xA4, 0x9A, 0x62, 0x46,
-    0x8C, 0xA2, 0x38, 0x7A, 0xD5, 0xBC, 0xFB, 0x62, 0x1E, 0x91, 0x73, 0x8D, 0x8A, 0x16, 0xF4, 0x96,
-    0x84, 0x5A, 0x47, 0xC3, 0xAD, 0x85, 0x24, 0xC4, 0xC3, 0x7C, 0xFB, 0xA0, 0xC4, 0x85, 0x04, 0x28,
-    0x3C, 0x23, 0x93, 0x4E, 0xA3, 0x4B, 0x3B, 0x6B, 0x2E, 0x84, 0xBC, 0x80, 0x59, 0xD4, 0xEC, 0x87,
-    0x91, 0xDA, 0x78, 0xB5, 0x35, 0x82, 0xC5, 0x64, 0xD0, 0x1F, 0x18, 0xBD, 0x20, 0x86, 0x1F, 0xDE,
-    0x0E, 0x20, 0x0D, 0xF3, 0xAF, 0xEA, 0x49, 0xC7, 0x34, 0x36, 0x6B, 0x72, 0xFD, 0x72, 0x69, 0x88,
-    0xEA, 0x50, 0x91, 0xD0, 0xBC, 0x91, 0x4F, 0xDF, 0x4C, 0xC5, 0xA9, 0xD7, 0xD1, 0x4A, 0x5B, 0x4A,
-    0xEB, 0xC4, 0x85, 0x39, 0xCC, 0xD5, 0xA3, 0x49, 0x88, 0x69, 0x03, 0xF4, 0xF3, 0xF1, 0x94, 0x0F,
-    0x62, 0xE6, 0x1A, 0xA5, 0x9F, 0x31, 0x27, 0x98, 0xC4, 0xCD, 0xC5, 0xD1, 0xE2, 0x6C, 0xE6, 0x76,
-    0xBA, 0x28, 0x91, 0x8A, 0x5E, 0x94, 0x13, 0x3C, 0x29, 0x0E, 0xE9, 0x78, 0x4B, 0xF6, 0x5E, 0x2B,
-    0x7A, 0x15, 0x96, 0x3F, 0x51, 0x7A, 0x75, 0x45, 0xE8, 0x34, 0x7C, 0x0F, 0xC4, 0x88, 0xD0, 0xD0,
-    0xB9, 0x4B, 0xF8, 0xE7, 0x38, 0xA9, 0x66, 0xC4, 0xCF, 0x7E, 0xF8, 0x78, 0xD4, 0x9A, 0x46, 0x17,
-    0xE9, 0x4A, 0x23, 0x18, 0x14, 0x64, 0x70, 0xCD, 0x30, 0xC1, 0xC7, 0xD1, 0xFD, 0xEF, 0x67, 0xF3,
-    0x59, 0x7A, 0xD5, 0xD5, 0x95, 0xFB, 0xF8, 0x9F, 0xD1, 0x95, 0xA4, 0x96, 0x86, 0xEE, 0x3D, 0x26,
-    0x3A, 0x66, 0x5A, 0x8B, 0x61, 0x21, 0x7A, 0xC9, 0xD1, 0x1A, 0x03, 0x46, 0xA4, 0x7E, 0x1E, 0x7F,
-    0x4E, 0x82, 0xBB, 0x31, 0xDE, 0x2E, 0x2C, 0x4D, 0x74, 0x2D, 0xA5, 0xB3, 0xD7, 0x85, 0xC2, 0x34,
-    0x85, 0x3B, 0xF2, 0xAF, 0x26, 0x0A, 0x2E, 0x1F, 0x24, 0x52, 0xAB, 0xE2, 0xA4, 0xBA, 0x88, 0x84,
-    0xA6, 0x89, 0xF0, 0xD3, 0x09, 0xC8, 0x05, 0xE6, 0x67, 0x10, 0xAC, 0xCD, 0x17, 0xC4, 0xE9, 0x69,
-    0x44, 0x56, 0x12, 0x7B, 0xFB, 0x9F, 0x74, 0xD4, 0x16, 0x35, 0xB1, 0x53, 0xD0, 0xD5, 0xC6, 0xE0,
-    0x3F, 0x03, 0x33, 0x15, 0x1A, 0xEE, 0x6D, 0x34, 0xFA, 0x68, 0x38, 0x9B, 0x68, 0x0C, 0x66, 0x8D,
-    0xFE, 0xEC, 0x56, 0xD5, 0x3C, 0xCC, 0x5E, 0xE8, 0xBE, 0xFD, 0x9A, 0x8E, 0xCC, 0x80, 0xD4, 0xCC,
-    0xEC, 0x55, 0x30, 0x36, 0x16, 0xE4, 0xBB, 0x20, 0xCF, 0x05, 0x45, 0x52, 0xF0, 0x36, 0x48, 0x59,
-    0x49, 0x0B, 0x90, 0x51, 0x15, 0xE2, 0x6D, 0xAD, 0x14, 0x10, 0x23, 0xC8, 0x0B, 0xA9, 0x91, 0x0E,
-    0x39, 0xEB, 0xF3, 0x91, 0x2F, 0x7C, 0xB4, 0xF9, 0x11, 0xF2, 0x6E, 0x20, 0x36, 0xBA, 0xA5, 0x5E,
-    0x01, 0xCB, 0x9D, 0x14, 0xA2, 0x74, 0xF1, 0x6E, 0xAD, 0x24, 0xC3, 0x96, 0xCD, 0x90, 0x65, 0x3F,
-    0x06, 0x5F, 0x50, 0x41, 0x90, 0xE2, 0xC3, 0xC9, 0xF1, 0xA1, 0x4A, 0x6A, 0xA4, 0xE2, 0x47, 0xCC,
-    0x8F, 0xFE, 0xDF, 0x3C, 0xBE, 0x26, 0xFD, 0x10, 0xF1, 0x7D, 0x10, 0xA2, 0x43, 0xDF, 0x5C, 0xDB,
-    0xBD, 0x5B, 0xCD, 0x7A, 0x98, 0xBE, 0x7E, 0x6A, 0xF8, 0xC3, 0xC8, 0x95, 0xEC, 0x67, 0xB0, 0x4D,
-    0xD5, 0x46, 0xF2, 0xCA, 0xCD, 0x1D, 0xF1, 0x71, 0x59, 0x75, 0x07, 0xB4, 0xE7, 0x48, 0x6D, 0x5C,
-    0x49, 0xC9, 0x9A, 0x3D, 0xB9, 0x3E, 0x81, 0xD6, 0x87, 0x51, 0x05, 0x13, 0x21, 0x5F, 0xD0, 0x5C,
-    0x1B, 0xAA, 0xF3, 0x2E, 0x83, 0xF5, 0x94, 0x4C, 0xA1, 0x33, 0x03, 0xAF, 0x1F, 0xC5, 0xE4, 0x27,
-    0x75, 0x0B, 0x68, 0xB0, 0x8F, 0xB1, 0x5E, 0x35, 0xD6, 0xE8, 0xE8, 0x0A, 0xBF, 0xA5, 0xCE, 0x65,
-    0x10, 0xEE, 0x55, 0xAD, 0x37, 0xB7, 0xBB, 0xCB, 0x85, 0x99, 0xD8, 0xE4, 0x18, 0x23, 0x49, 0xFE,
-    0xD0, 0xFA, 0xB6, 0xD6, 0xF9, 0x4E, 0x77, 0xF9, 0xC0, 0x1D, 0xFC, 0x40, 0x1F, 0x38, 0x1F, 0x2D,
-    0x97, 0xD9, 0x31, 0xD4, 0xD9, 0x2C, 0x23, 0xAF, 0x6C, 0xC1, 0xFC, 0x32, 0x77, 0x6B, 0xE5, 0xA7,
-    0x85, 0xC4, 0xA1, 0xC9, 0x60, 0xE1, 0xA0, 0xFB, 0xFD, 0x27, 0x48, 0x52, 0xC3, 0xB5, 0xB5, 0x5F,
-    0xA7, 0x66, 0x04, 0x9A, 0x17, 0xFD, 0x74, 0x2A, 0x2F, 0x81, 0xF7, 0xD4, 0x85, 0xB0, 0x60, 0x9A,
-    0x2D, 0xF9, 0x2B, 0x95, 0xBA, 0x18, 0x6C, 0x64, 0x43, 0x1E, 0x73, 0xB5, 0x51, 0xE9, 0x02, 0xF3,
-    0x74, 0xBA, 0xDD, 0x03, 0x14, 0x18, 0x24, 0x80, 0xA0, 0xAE, 0xBD, 0x37, 0xBB, 0x07, 0xEE, 0xD0,
-    0x1F, 0xD1, 0x07, 0xCC, 0x61, 0x00, 0x0B, 0x63, 0x7D, 0x4B, 0x65, 0xCC, 0xBB, 0xAE, 0xDE, 0x75,
-    0xBD, 0x17, 0x20, 0x94, 0x43, 0x40, 0xE6, 0xF4, 0xF5, 0x59, 0x78, 0x38, 0x15, 0x42, 0x4D, 0xD4,
-    0x2F, 0x6B, 0xD7, 0xFE, 0xC1, 0x5E, 0xA0, 0x3B, 0x39, 0xA1, 0xA7, 0xA2, 0x60, 0x66, 0x5E, 0xA4,
-    0x62, 0xE4, 0x71, 0x66, 0xCD, 0x3E, 0x7E, 0x17, 0x8C, 0x91, 0x27, 0x23, 0xAB, 0x12, 0x75, 0xA3,
-    0xCE, 0xBB, 0xEF, 0xD6, 0x09, 0x7E, 0x1D, 0x73, 0x21, 0x06, 0xCD, 0x45, 0x48, 0x4F, 0x56, 0xEE,
-    0x45, 0x81, 0x1F, 0x51, 0xFB, 0xE1, 0xA8, 0x09, 0x56, 0x35, 0x11, 0x57, 0xDF, 0xEC, 0x5E, 0x39,
-    0x44, 0x74, 0x14, 0x2A, 0xB8, 0xD8, 0xEE, 0x46, 0x87, 0xF1, 0x87, 0x3E, 0xB5, 0x56, 0x18, 0x07,
-    0xDB, 0x56, 0xAE, 0x8A, 0x8A, 0x79, 0x89, 0x81, 0xB0, 0x41, 0x5E, 0xAD, 0x69, 0x64, 0xE9, 0xA9,
-    0x6C, 0x7C, 0xA7, 0xF4, 0x23, 0x17, 0x88, 0x01, 0xF8, 0xC5, 0x7E, 0xB2, 0xDD, 0x1D, 0x0E, 0xB5,
-    0x7E, 0xF2, 0xD9, 0xDA, 0x1A, 0xDC, 0x89, 0xC3, 0x21, 0xC0, 0x52, 0xD5, 0x5E, 0xA6, 0x46, 0x21,
-    0x8C, 0x7D, 0x0C, 0xF2, 0xE6, 0x67, 0x21, 0x9C, 0xF1, 0xDC, 0x63, 0xEA, 0x89, 0xF1, 0xB0, 0x3B,
-    0xEA, 0x33, 0xDE, 0x9F, 0x6F, 0x14, 0x37, 0x46, 0x86, 0x42, 0x56, 0xC9, 0xEC, 0x69, 0xB4, 0x42,
-    0x86, 0xC4, 0x2A, 0x9B, 0xB8, 0xCD, 0xD8, 0x5A, 0x87, 0x77, 0x03, 0xFC, 0x3A, 0x35, 0xA4, 0xF2,
-    0xF4, 0x6D, 0xC8, 0x50, 0xE3, 0x52, 0x37, 0xE6, 0x9C, 0x04, 0x52, 0xEE, 0x7B, 0xE8, 0x13, 0x20,
-    0x36, 0x49, 0x8C, 0x68, 0x66, 0xE5, 0xEE, 0x8E, 0x2C, 0x24, 0xC8, 0x2E, 0x9A, 0x58, 0x6A, 0xAB,
-    0x26, 0x62, 0x0E, 0x82, 0x22, 0x82, 0x83, 0xAA, 0x10, 0x99, 0xED, 0xCC, 0x07, 0x66, 0xA9, 0x51,
-    0xCB, 0x42, 0xF1, 0x35, 0x06, 0x8D, 0xF0, 0xCD, 0xF1, 0x3D, 0xC4, 0x8C, 0xAB, 0x89, 0xAC, 0x23,
-    0x64, 0x3C, 0x46, 0xA4, 0xF8, 0x5F, 0x44, 0x8C, 0x1B, 0x08, 0x14, 0x0C, 0x18, 0xF8, 0xB9, 0x89,
-    0x78, 0xF1, 0x6A, 0x2A, 0x13, 0x86, 0x0B, 0x5F, 0x3F, 0x49, 0x7D, 0x7D, 0x15, 0x69, 0xBB, 0x5D,
-    0x47, 0x55, 0x28, 0x5E, 0x42, 0xFB, 0x17, 0x4E, 0x01, 0x51, 0x47, 0x0B, 0x48, 0x2F, 0x74, 0x54,
-    0x91, 0x4B, 0xF2, 0x0E, 0x15, 0x00, 0xFA, 0x87, 0xE5, 0xBE, 0x84, 0x06, 0x8E, 0xB7, 0xE0, 0x66,
-    0xB0, 0x3F, 0xBD, 0xBA, 0x90, 0x78, 0x0C, 0xCF, 0x1B, 0x33, 0x66, 0x69, 0x09, 0x26, 0xE9, 0x9A,
-    0x44, 0xD6, 0xB0, 0x6E, 0xEB, 0xBC, 0x61, 0xFD, 0xC2, 0x0A, 0x65, 0x13, 0x07, 0x64, 0x7D, 0x40,
-    0x40, 0x07, 0xB9, 0x06, 0x0A, 0x1F, 0x31, 0x12, 0x74, 0x2B, 0x47, 0xDC, 0x42, 0xCE, 0x19, 0xEB,
-    0x1D, 0x03, 0xD6, 0x54, 0xD4, 0x12, 0x17, 0x00, 0xCD, 0x43, 0x6E, 0xF2, 0x27, 0x32, 0x4B, 0x6D,
-    0xAD, 0x49, 0x2B, 0xD2, 0xBA, 0xED, 0x6D, 0xAF, 0x14, 0x03, 0xF1, 0xC1, 0x57, 0x70, 0x15, 0xD0,
-    0x13, 0x6C, 0xEE, 0xE7, 0x9A, 0x61, 0x1F, 0xA6, 0xF0, 0x21, 0x62, 0xFF, 0x95, 0xC2, 0x9A, 0x30,
-    0xE2, 0x3B, 0x1A, 0x99, 0x68, 0x19, 0xF6, 0x43, 0xCB, 0x51, 0x39, 0xD5, 0xB4, 0x8D, 0x14, 0x04,
-    0x9B, 0x6D, 0xE9, 0x5D, 0xF6, 0x98, 0x7A, 0x68, 0x09, 0x62, 0x8D, 0xF6, 0x01, 0x91, 0x3F, 0x17,
-    0xC7, 0x26, 0x3A, 0x04, 0xCD, 0x78, 0xAB, 0xBB, 0xB3, 0x9F, 0x15, 0xC7, 0x7C, 0xB9, 0x98, 0x1A,
-    0x76, 0x36, 0x95, 0x70, 0xAB, 0x95, 0xDB, 0xBC, 0x1A, 0x8C, 0x1A, 0x02, 0x08, 0x50, 0x0C, 0xF4,
-    0x30, 0x80, 0x64, 0xC6, 0x9E, 0xAE, 0x1A, 0xF6, 0xE6, 0x08, 0xC0, 0x25, 0x30, 0xA0, 0x1C, 0x78,
-    0xC6, 0xCA, 0x01, 0x6C, 0xDC, 0x04, 0x56, 0x1A, 0x00, 0xA6, 0xA8, 0x58, 0xE0, 0x61, 0xAC, 0x5E,
-    0x90, 0x5B, 0xF7, 0x15, 0x41, 0x14, 0x56, 0x8F, 0xE2, 0xCD, 0x66, 0x78, 0xDF, 0xB8, 0x12, 0xD1,
-    0x5F, 0x64, 0xC0, 0xB8, 0x95, 0xD7, 0x42, 0x9C, 0x97, 0xB3, 0x34, 0x6F, 0x43, 0x91, 0x01, 0x6A,
-    0x69, 0xED, 0xD7, 0xB7, 0x10, 0xEC, 0x67, 0x6E, 0x8D, 0x1E, 0x8B, 0x0C, 0x2E, 0x77, 0xE1, 0x70,
-    0x8F, 0x88, 0x59, 0x18, 0x86, 0x0E, 0x5C, 0x40, 0x60, 0xD2, 0x77, 0xF1, 0x7E, 0xB4, 0xDD, 0xED,
-    0x1E, 0xFE, 0xC4, 0x81, 0x0B, 0x86, 0x29, 0x5A, 0x0F, 0xFD, 0xD8, 0x4C, 0xBB, 0x08, 0x5C, 0xA2,
-    0x22, 0xB5, 0xDF, 0xD4, 0x68, 0x81, 0x94, 0xE9, 0x61, 0x8D, 0x85, 0x12, 0x45, 0x18, 0x92, 0xC8,
-    0x78, 0x7B, 0x25, 0x71, 0x0B, 0x84, 0x98, 0x0D, 0xA8, 0x05, 0x6A, 0xEA, 0xE0, 0x19, 0x34, 0x92,
-    0xA3, 0x35, 0x18, 0xF0, 0x6E, 0x99, 0xF0, 0x99, 0xB0, 0x59, 0xCD, 0x0D, 0xBA, 0xDD, 0x1B, 0xBF,
-    0xD7, 0x7C, 0x3D, 0xE4, 0xC7, 0xC4, 0x5C, 0xDD, 0xF7, 0x00, 0x83, 0xB0, 0xC1, 0x68, 0x88, 0xED,
-    0x48, 0x65, 0x37, 0x92, 0x03, 0x0F, 0x3C, 0xB7, 0x29, 0x0D, 0x0F, 0x7C, 0xAF, 0x3C, 0xF8, 0x0D,
-    0x2C, 0xBE, 0x92, 0xEB, 0xFF, 0x73, 0xAD, 0xB9, 0x36, 0x2F, 0xEE, 0x1D, 0x24, 0x9A, 0xFB, 0x28,
-    0x54, 0x2B, 0x94, 0xB6, 0xB9, 0xF4, 0xC9, 0x14, 0x69, 0x3D, 0xCA, 0x5B, 0x45, 0xE7, 0xFC, 0xE2,
-    0x1B, 0x1D, 0x5D, 0x7D, 0xD3, 0xCF, 0xCF, 0xD3, 0x94, 0x60, 0xD4, 0x19, 0xFE, 0x09, 0x00, 0x8F,
-    0xF9, 0x0F, 0x18, 0xEC, 0x01, 0xE8, 0x34, 0x03, 0x96, 0x3F, 0xE2, 0x80, 0xE6, 0xF5, 0x86, 0x51,
-    0xC3, 0x91, 0xFF, 0x87, 0xFA, 0x8E, 0x9E, 0x18, 0x04, 0x16, 0xE8, 0x7F, 0xD1, 0x25, 0xB4, 0xEC,
-    0x47, 0x47, 0xFA, 0xB0, 0x74, 0x81, 0x80, 0x3B, 0xD4, 0x1F, 0xE8, 0xCA, 0x74, 0x57, 0x6F, 0xB1,
-    0xA6, 0xCE, 0x9F, 0xFB, 0xF1, 0x03, 0xF9, 0x8F, 0xE8, 0x52, 0xA8, 0x13, 0x70, 0xBD, 0x2C, 0x27,
-    0x9C, 0x75, 0x59, 0x7E, 0x2E, 0x4B, 0xA1, 0xFE, 0x69, 0x33, 0xC6, 0x51, 0xA7, 0x1E, 0x4F, 0xC7,
-    0x53, 0x27, 0x7D, 0xDE, 0xDF, 0x78, 0x82, 0x18, 0xF3, 0xAE, 0xCA, 0xEC, 0x04, 0x7F, 0xDB, 0xD6,
-    0x54, 0xE6, 0x55, 0x14, 0xBB, 0x09, 0xC1, 0x55, 0x6B, 0x84, 0xC6, 0x61, 0xFF, 0x97, 0xB3, 0x25,
-    0x3B, 0xE9, 0x7C, 0x6F, 0x0A, 0x0F, 0x89, 0x38, 0x46, 0x1D, 0x93, 0x8F, 0x3E, 0xDF, 0x1B, 0xF1,
-    0xE7, 0x5F, 0xE3, 0xA9, 0xFA, 0x93, 0x2E, 0x9D, 0x04, 0x58, 0x19, 0x8C, 0xF7, 0x9C, 0x54, 0xE5,
-    0x7E, 0x74, 0xFC, 0x9F, 0xA8, 0xFA, 0x7A, 0x7A, 0xCA, 0x78, 0xCA, 0xC0, 0x12, 0x98, 0x1A, 0xCD,
-    0x41, 0x14, 0x67, 0x8E, 0xBA, 0x48, 0x08, 0xFE, 0xBD, 0xDC, 0xFE, 0x24, 0xF1, 0xFE, 0x5B, 0x5E,
-    0xAA, 0xA3, 0xF7, 0xE8, 0xAB, 0x2B, 0xD2, 0x89, 0xE5, 0x33, 0x73, 0xF5, 0xED, 0x2F, 0x6D, 0x66,
-    0x8C, 0x7D, 0x1D, 0x06, 0x5C, 0x3B, 0x3D, 0x17, 0x4A, 0x88, 0x84, 0x63, 0x60, 0x32, 0x0A, 0xFD,
-    0x71, 0x66, 0x7D, 0x0A, 0xDA, 0xDB, 0x4D, 0x8D, 0x8F, 0xA2, 0xE0, 0x05, 0xFF, 0x03, 0x2E, 0x47,
-    0x0D, 0x27, 0x32, 0x2C, 0x48, 0x35, 0xC8, 0x46, 0xF4, 0x0F, 0x0B, 0xFB, 0xD3, 0x02, 0x41, 0x69,
-    0xD9, 0xB8, 0xD1, 0x45, 0x9A, 0x32, 0x74, 0x0C, 0x27, 0x0B, 0x8E, 0xD1, 0x1C, 0xC8, 0x38, 0xE7,
-    0x7A, 0x0B, 0xDC, 0x7F, 0x1D, 0x01, 0x7F, 0x03, 0x11, 0x60, 0x80, 0xA0, 0x3A, 0xC0, 0x85, 0x10,
-    0x19, 0x20, 0xAC, 0x57, 0xB9, 0x0A, 0x2E, 0x65, 0xE1, 0xED, 0xAD, 0xA0, 0x16, 0x65, 0x35, 0xAB,
-    0x87, 0xE0, 0x13, 0x55, 0xAE, 0x17, 0x21, 0xAA, 0xA1, 0xAC, 0x41, 0x17, 0x86, 0x10, 0x3F, 0xF1,
-    0x22, 0xAB, 0xC4, 0x18, 0x21, 0x10, 0xA0, 0xCD, 0x62, 0x73, 0xB0, 0x17, 0x2C, 0x99, 0x4F, 0xA8,
-    0x04, 0x8B, 0xA9, 0x2A, 0x9F, 0x65, 0x93, 0x66, 0xA1, 0xE8, 0xC0, 0x97, 0xFA, 0x55, 0x2C, 0xA1,
-    0x9B, 0x78, 0x49, 0x6C, 0xE7, 0x6E, 0x52, 0x11, 0xD3, 0x72, 0xE5, 0x6C, 0x83, 0x45, 0x43, 0x26,
-    0xE3, 0x20, 0x32, 0x17, 0x79, 0xCF, 0x1F, 0xC5, 0xB2, 0xEE, 0x26, 0x36, 0xF0, 0x99, 0x01, 0x73,
-    0xD2, 0x24, 0xC0, 0x25, 0x22, 0x40, 0x33, 0xD3, 0x39, 0xC6, 0x84, 0x8B, 0xAF, 0x9A, 0x47, 0x2A,
-    0x37, 0x09, 0x25, 0x76, 0x53, 0xF7, 0x7D, 0xE0, 0xE4, 0x81, 0xB8, 0xF7, 0x99, 0xD1, 0xC5, 0x7D,
-    0x5C, 0x62, 0x8C, 0xD4, 0xDC, 0x53, 0xA5, 0x9B, 0xB8, 0xA9, 0x99, 0x5D, 0x2A, 0xAE, 0x41, 0x55,
-    0xE6, 0xBF, 0x6F, 0x46, 0x6C, 0x96, 0x9F, 0x0E, 0xC3, 0xB7, 0x47, 0xFC, 0x61, 0x60, 0x70, 0x89,
-    0x2C, 0xAE, 0x96, 0xFD, 0x11, 0xA8, 0xE9, 0xD5, 0x50, 0x29, 0x06, 0x98, 0x4C, 0x82, 0xE7, 0x7D,
-    0x9D, 0x78, 0xD6, 0x59, 0x09, 0x31, 0x0D, 0xF7, 0x8A, 0x5B, 0x96, 0xF7, 0x46, 0x46, 0xC4, 0xFF,
-    0x20, 0xC2, 0x7D, 0x3F, 0x8F, 0x83, 0x67, 0x7C, 0x40, 0xA4, 0xF7, 0xF2, 0x5B, 0x4B, 0xE7, 0xD0,
-    0xC9, 0xBB, 0x1A, 0xD9, 0xB7, 0xE1, 0x61, 0x85, 0xBC, 0xDB, 0x96, 0x6F, 0x9D, 0x90, 0x80, 0xB8,
-    0x13, 0xB7, 0xE3, 0xA5, 0xF8, 0xC7, 0xF1, 0x72, 0x2C, 0xCF, 0xFB, 0xFB, 0xB2, 0x81, 0x81, 0x98,
-    0x90, 0x23, 0xFD, 0x51, 0x61, 0x8D, 0x9E, 0x3B, 0xE5, 0xC1, 0xBF, 0xF3, 0x08, 0x34, 0x55, 0xFC,
-    0xFA, 0xC1, 0x3B, 0x1C, 0xA5, 0xC1, 0x62, 0x1C, 0xED, 0x8B, 0x3F, 0xEF, 0xC1, 0xF2, 0xC7, 0x09,
-    0x3C, 0xD0, 0xAC, 0x55, 0x86, 0x99, 0x28, 0x80, 0x04, 0xF5, 0x85, 0x87, 0x91, 0x7D, 0x51, 0x2E,
-    0x4D, 0xCD, 0x62, 0x05, 0x67, 0x0F, 0x60, 0xD5, 0xD0, 0xE0, 0x5E, 0x23, 0x0A, 0x0A, 0xB7, 0xB2,
-    0x91, 0x46, 0x6D, 0xFD, 0xC5, 0x5B, 0x06, 0x58, 0xCE, 0x45, 0xFB, 0x57, 0xC8, 0x66, 0x5E, 0xD3,
-    0x58, 0x20, 0xF1, 0x6C, 0x1B, 0x55, 0x8C, 0xBD, 0x39, 0x61, 0x23, 0x47, 0xE3, 0xFE, 0x48, 0xDA,
-    0x4B, 0xEB, 0x68, 0x00, 0xEB, 0xB5, 0x97, 0xFC, 0x91, 0xBD, 0x09, 0x17, 0x69, 0xB7, 0xED, 0xDC,
-    0xDE, 0x84, 0x84, 0x00, 0x3A, 0x2B, 0x34, 0xE0, 0x95, 0x6D, 0x09, 0xAE, 0x00, 0x6C, 0x56, 0x68,
-    0x38, 0x8F, 0xD0, 0x08, 0xB8, 0xE2, 0x43, 0xF8, 0xE9, 0x4C, 0xD0, 0x08, 0xB8, 0x06, 0x34, 0x31,
-    0xCB, 0x6E, 0x70, 0x27, 0x4E, 0xD3, 0xAB, 0xD1, 0x9F, 0x31, 0xD3, 0xD6, 0x65, 0x3D, 0x8A, 0xB5,
-    0x7E, 0x75, 0xFA, 0x9D, 0x6A, 0x2C, 0xEE, 0x47, 0x99, 0x74, 0x30, 0xE1, 0x27, 0x09, 0x43, 0xE2,
-    0x97, 0x7E, 0x65, 0xE0, 0xC1, 0xDE, 0x2C, 0x49, 0x6A, 0x8A, 0x06, 0xCA, 0xBE, 0x76, 0x1B, 0x81,
-    0x73, 0xF3, 0x83, 0x14, 0xA4, 0x22, 0xCA, 0x6C, 0xA2, 0xB0, 0x6A, 0x2F, 0x01, 0x81, 0x6C, 0x22,
-    0xDE, 0xB4, 0xDB, 0xAA, 0x44, 0xC3, 0x4B, 0x40, 0x61, 0x88, 0x86, 0x55, 0xA0, 0xE1, 0xDD, 0x06,
-    0x61, 0x43, 0x34, 0xAC, 0x27, 0x68, 0x78, 0x24, 0x75, 0x88, 0x86, 0xC5, 0x86, 0x97, 0xEE, 0x85,
-    0x19, 0x83, 0xBE, 0x8A, 0x06, 0xB1, 0x9A, 0x58, 0x03, 0x24, 0xF7, 0xBA, 0x5F, 0x12, 0x8C, 0x8D,
-    0xB7, 0x56, 0x3E, 0xC8, 0x65, 0x1D, 0x31, 0xEB, 0x93, 0xF4, 0xB9, 0x24, 0xF3, 0x6B, 0xFF, 0x86,
-    0x40, 0x61, 0xDC, 0xC5, 0x4A, 0x6A, 0xBC, 0xBB, 0x8C, 0x3F, 0xB3, 0x8E, 0x18, 0xF0, 0xDE, 0x98,
-    0x40, 0xB1, 0xDA, 0xAB, 0xBB, 0xCE, 0x58, 0x3B, 0xCC, 0x2B, 0x3D, 0x3B, 0xB5, 0x80, 0xEC, 0xB9,
-    0x84, 0x19, 0xCE, 0x2A, 0xE8, 0x13, 0x6B, 0x87, 0x4B, 0xBA, 0x56, 0xDE, 0x98, 0x1A, 0x0D, 0xD8,
-    0x00, 0x7F, 0xF7, 0x5F, 0x2F, 0x8F, 0x47, 0x45, 0x4F, 0xEB, 0x6F, 0x3B, 0x18, 0x11, 0x45, 0x2D,
-    0x92, 0x35, 0xC6, 0x44, 0x28, 0xB4, 0x33, 0x87, 0xD2, 0xE9, 0x1D, 0xB1, 0x71, 0x24, 0xE5, 0xBB,
-    0xE9, 0x7E, 0xE5, 0xBB, 0x69, 0xA3, 0x7C, 0x29, 0xD1, 0x70, 0x37, 0xD1, 0x08, 0x59, 0x37, 0x3D,
-    0x9D, 0x49, 0x22, 0x34, 0x92, 0x68, 0x37, 0x9E, 0x41, 0xDF, 0x63, 0x72, 0xA1, 0xBF, 0xF8, 0x74,
-    0x46, 0x16, 0x0B, 0xAD, 0xD5, 0x5D, 0xC5, 0x6F, 0x53, 0xF1, 0xFD, 0xE3, 0x28, 0x9E, 0x29, 0x64,
-    0xEF, 0x0B, 0x18, 0x37, 0xA8, 0x8C, 0xB7, 0x73, 0x2D, 0x07, 0xE5, 0x22, 0x3E, 0xE6, 0xBA, 0xCB,
-    0xBB, 0x85, 0x19, 0x8C, 0x03, 0x35, 0x54, 0x84, 0x3A, 0x71, 0x25, 0x45, 0x5E, 0x74, 0x72, 0xF8,
-    0x8E, 0x2A, 0xB9, 0x74, 0x5C, 0xD1, 0x95, 0xFB, 0x61, 0xB3, 0x1D, 0x23, 0xE1, 0x61, 0x1F, 0xE6,
-    0x2E, 0x9F, 0x1B, 0x50, 0x11, 0x31, 0xFB, 0x56, 0x18, 0xC5, 0xCE, 0x81, 0xBD, 0x82, 0x14, 0x09,
-    0x0A, 0x1C, 0x99, 0x79, 0x69, 0x7A, 0xAA, 0x5E, 0x6D, 0x10, 0x41, 0x7C, 0xA9, 0x0B, 0xDE, 0x82,
-    0xBF, 0x23, 0xF7, 0xF1, 0x0A, 0x0C, 0xC9, 0xCE, 0xC3, 0x7A, 0xB3, 0xA9, 0xEA, 0xD7, 0x65, 0xCB,
-    0xEE, 0x9B, 0xD7, 0x30, 0x51, 0xE9, 0x47, 0x56, 0x8E, 0xD2, 0x2B, 0x33, 0xCB, 0x9C, 0xE3, 0xA6,
-    0x56, 0xFF, 0x0A, 0x01, 0x90, 0xC7, 0xED, 0x1D, 0x17, 0x95, 0x20, 0xC6, 0x6B, 0x1C, 0xE7, 0x2F,
-    0xC1, 0xDF, 0xC8, 0x82, 0xDF, 0xBA, 0x30, 0xFA, 0x69, 0xBD, 0x98, 0xD1, 0xAC, 0x25, 0x9C, 0x0A,
-    0x9F, 0xB2, 0x3C, 0x4F, 0x4B, 0x5F, 0xA7, 0xD9, 0x70, 0x11, 0xE9, 0x1F, 0xA0, 0xDE, 0x45, 0x87,
-    0x35, 0xAC, 0xFA, 0x8B, 0x30, 0x2B, 0x17, 0x10, 0xE5, 0x07, 0x08, 0x21, 0x18, 0x59, 0xE5, 0xF0,
-    0x95, 0x24, 0x17, 0x25, 0xA7, 0xC9, 0x70, 0xB3, 0x5B, 0xA2, 0xCD, 0x7A, 0x1F, 0x5E, 0x85, 0xBB,
-    0xA3, 0x26, 0xDD, 0x6B, 0x0E, 0xCB, 0x01, 0xC6, 0x29, 0x6E, 0x4E, 0x96, 0xC6, 0xF9, 0xEB, 0x82,
-    0xC8, 0x6C, 0x6A, 0x32, 0xE0, 0xE1, 0x06, 0x8C, 0x1F, 0x3D, 0x11, 0x65, 0x58, 0x03, 0x32, 0xD6,
-    0x75, 0xAF, 0x35, 0x37, 0xF2, 0x7D, 0x3D, 0x6A, 0x7C, 0x5A, 0x0F, 0x05, 0x98, 0xCA, 0x1B, 0x6E,
-    0x29, 0x98, 0x83, 0xBC, 0x52, 0x8E, 0x66, 0xF2, 0x86, 0x9A, 0x60, 0x4B, 0xC6, 0x5C, 0x87, 0xCB,
-    0x87, 0x3A, 0x71, 0xB7, 0x56, 0xEE, 0xDE, 0xDB, 0x00, 0x62, 0x1F, 0xE6, 0x0A, 0x10, 0xD3, 0xAA,
-    0xC4, 0xFB, 0x59, 0xC6, 0x2D, 0x20, 0xB2, 0x35, 0xE9, 0xDE, 0xB8, 0x93, 0x72, 0x55, 0x94, 0xFC,
-    0x4E, 0xD7, 0xD6, 0xFE, 0x2D, 0x35, 0x51, 0xB8, 0x6D, 0x5C, 0xDC, 0x36, 0x8F, 0x71, 0x9B, 0x60,
-    0x6A, 0xF6, 0x9A, 0x26, 0xA5, 0xBC, 0x0E, 0xB6, 0xBF, 0x4B, 0x69, 0xE9, 0x11, 0x11, 0xA2, 0x6A,
-    0xD8, 0xBF, 0x56, 0xC7, 0x04, 0xBB, 0xA9, 0x00, 0xBC, 0xBD, 0x0C, 0x1A, 0xEA, 0x5F, 0xB1, 0x58,
-    0x96, 0xCE, 0x6B, 0xE3, 0x04, 0x11, 0x26, 0x6B, 0x1B, 0xC4, 0x6A, 0xED, 0x7B, 0xDB, 0x19, 0x21,
-    0x2D, 0x9F, 0x09, 0x61, 0x13, 0x9D, 0xD7, 0xB8, 0x43, 0x41, 0x98, 0xDB, 0xC1, 0x3B, 0x88, 0x90,
-    0x92, 0xD0, 0xCF, 0x69, 0xFA, 0x99, 0xDD, 0x92, 0x75, 0xE6, 0x6C, 0x94, 0xE0, 0x94, 0x44, 0x6E,
-    0xE6, 0x69, 0x5D, 0x5E, 0xBF, 0x35, 0xFE, 0xE8, 0xE1, 0x2F, 0xC6, 0x23, 0x54, 0xCA, 0xEB, 0xBC,
-    0x1E, 0x1F, 0xFA, 0x71, 0x36, 0xD4, 0xCC, 0x5E, 0x8C, 0xE8, 0xE4, 0x9E, 0x2B, 0xBC, 0x8D, 0x04,
-    0xBE, 0xD6, 0x2A, 0x6E, 0x8D, 0x3F, 0x7C, 0xBA, 0x0D, 0x4D, 0x05, 0x09, 0x1E, 0xFD, 0xB2, 0x22,
-    0x61, 0x86, 0x79, 0x31, 0xC4, 0x25, 0x82, 0x10, 0x65, 0x12, 0xDD, 0x9C, 0xC9, 0x7F, 0x96, 0xB1,
-    0x8E, 0xAC, 0x4E, 0x42, 0x73, 0x67, 0x27, 0xD9, 0x65, 0xF9, 0x7E, 0xD2, 0x46, 0xAE, 0x1D, 0x67,
-    0xC8, 0xB3, 0x73, 0xC7, 0x91, 0xAC, 0xF1, 0xB3, 0x66, 0x2F, 0xB0, 0x86, 0x85, 0x8D, 0x7F, 0x2D,
-    0x70, 0xE5, 0x41, 0xBF, 0x37, 0x99, 0xBB, 0x15, 0xD6, 0x71, 0xBE, 0x5D, 0x7F, 0x85, 0x91, 0x09,
-    0xF4, 0x8E, 0xF1, 0xD3, 0xC8, 0x6C, 0x52, 0x38, 0x55, 0x0D, 0x32, 0xF6, 0x25, 0x84, 0x8F, 0x56,
-    0x5B, 0x15, 0xEC, 0x9B, 0x0E, 0x6A, 0x1C, 0x19, 0x95, 0x02, 0x8C, 0xCC, 0x33, 0x82, 0x5B, 0x6A,
-    0x8A, 0x1B, 0x4B, 0xBF, 0xE5, 0xEB, 0x2A, 0xBC, 0x1C, 0xF7, 0x4C, 0x42, 0x45, 0x31, 0x14, 0x64,
-    0xC8, 0xD8, 0x11, 0x8A, 0x2E, 0x33, 0xE4, 0xBA, 0x19, 0xAA, 0xF3, 0xBA, 0xAC, 0x0F, 0x75, 0x19,
-    0xC0, 0x47, 0x96, 0x8D, 0x0C, 0xE1, 0x08, 0x70, 0x09, 0xF1, 0xAF, 0x26, 0xDC, 0xB1, 0x3D, 0x5F,
-    0xE7, 0xF6, 0xD3, 0xA5, 0x76, 0x9E, 0xFB, 0x9E, 0x16, 0x5C, 0xE5, 0x4E, 0xE6, 0x4B, 0x31, 0x6F,
-    0xAE, 0x9D, 0x84, 0xDA, 0x53, 0x25, 0xEC, 0x52, 0x6D, 0xA9, 0x41, 0xED, 0xE6, 0x68, 0x5E, 0xAC,
-    0x53, 0xEE, 0xB1, 0x09, 0xEB, 0x99, 0x83, 0x0A, 0x43, 0xB3, 0x4B, 0xE2, 0x24, 0xD6, 0xDB, 0x91,
-    0x3D, 0x91, 0x67, 0xEE, 0x3A, 0x9C, 0xAA, 0x60, 0x21, 0x49, 0xC8, 0xD3, 0xBD, 0x9D, 0x41, 0xB6,
-    0xDC, 0x59, 0x9E, 0x3F, 0xA1, 0x19, 0x30, 0x72, 0xF2, 0xDD, 0xBD, 0xBE, 0xDD, 0x35, 0x42, 0x39,
-    0x8D, 0x37, 0xB1, 0xAB, 0x3D, 0xDB, 0x27, 0xEE, 0xD5, 0x07, 0x2A, 0x2E, 0x72, 0x43, 0xC3, 0xC0,
-    0xE7, 0xBF, 0xE5, 0x33, 0x70, 0xCB, 0x07, 0xBF, 0xD4, 0x7A, 0x61, 0x7B, 0xB9, 0x4F, 0x60, 0x75,
-    0xE0, 0x83, 0xB5, 0x3D, 0xF8, 0xC9, 0x21, 0x8D, 0x4B, 0x1C, 0x0B, 0xBA, 0x5A, 0xC2, 0xF7, 0xC5,
-    0x0A, 0xC9, 0x8D, 0x4B, 0x3F, 0x2A, 0xE7, 0xD9, 0x92, 0x4E, 0x7D, 0xD4, 0xC1, 0xCB, 0x77, 0x73,
-    0xD0, 0x99, 0xF0, 0x63, 0x5E, 0x9D, 0x9A, 0xA7, 0x9F, 0x70, 0xAF, 0x12, 0xF5, 0x20, 0xAE, 0xAB,
-    0xE9, 0x6F, 0x31, 0x5F, 0xAE, 0x36, 0xBA, 0x06, 0x1B, 0xF6, 0xE5, 0xD9, 0x5F, 0xB3, 0x3D, 0x31,
-    0x68, 0x0A, 0xBA, 0x80, 0xAB, 0xCD, 0xE8, 0xFC, 0xE1, 0xCD, 0x07, 0xBF, 0x7D, 0xD6, 0xBC, 0xAD,
-    0x9B, 0x9F, 0xAD, 0x72, 0x63, 0xBF, 0x75, 0xF3, 0xC1, 0xEA, 0x11, 0xE9, 0x3C, 0x5C, 0xB6, 0x43,
-    0xFD, 0xB1, 0x9E, 0x1C, 0x2A, 0x5B, 0xC5, 0x18, 0x7D, 0x1E, 0x00, 0x60, 0x09, 0x85, 0xE6, 0x54,
-    0x5C, 0x05, 0x02, 0xA3, 0x3A, 0x6F, 0x31, 0x8E, 0xEF, 0x70, 0x9F, 0x92, 0x47, 0x03, 0xFE, 0x13,
-    0x35, 0xEE, 0xFF, 0xA5, 0xC7, 0xBA, 0xF0, 0xEF, 0x91, 0x59, 0x81, 0xB7, 0xF2, 0x0D, 0x1E, 0x63,
-    0xDA, 0x42, 0xAC, 0xE1, 0x29, 0x20, 0x47, 0x37, 0x40, 0x6B, 0x59, 0x49, 0x98, 0xFE, 0xC8, 0x1B,
-    0x6B, 0x49, 0x87, 0xC9, 0xB9, 0x3A, 0x8C, 0xBD, 0x21, 0xD6, 0x2F, 0x93, 0xA3, 0xC0, 0xE6, 0xC1,
-    0xBA, 0x78, 0x1F, 0x17, 0xF6, 0x34, 0xD0, 0x4F, 0xB3, 0xE1, 0x64, 0xD1, 0x58, 0x3F, 0xF7, 0xE7,
-    0x90, 0xEE, 0x77, 0xCF, 0x88, 0xF5, 0x4E, 0x46, 0xF6, 0xEC, 0x42, 0x59, 0xD4, 0x4B, 0x51, 0x81,
-    0x9B, 0x21, 0xD8, 0x4E, 0xA3, 0x20, 0xF1, 0x08, 0x2E, 0x86, 0xBA, 0xDE, 0x87, 0xB0, 0x35, 0xEA,
-    0x14, 0x9D, 0x36, 0x93, 0xBD, 0x10, 0xE1, 0xCB, 0x6A, 0x24, 0xDF, 0x40, 0xB6, 0x33, 0x0B, 0x5E,
-    0xC3, 0x62, 0xF7, 0x7C, 0xD8, 0xD9, 0x2A, 0xA0, 0x05, 0x28, 0xFE, 0x63, 0x8B, 0x87, 0x0B, 0xC4,
-    0x9B, 0xCE, 0x32, 0xEA, 0x0B, 0xF1, 0x61, 0x6D, 0x41, 0x2C, 0x0F, 0x11, 0xCC, 0x00, 0x2D, 0xE5,
-    0x1D, 0xB8, 0xFC, 0xCB, 0x2F, 0x33, 0x24, 0xED, 0x01, 0xA1, 0xB3, 0xD5, 0x08, 0x43, 0x84, 0xFB,
-    0x3B, 0x91, 0xEC, 0x1D, 0xF9, 0x6B, 0x07, 0xE8, 0x01, 0x21, 0x6F, 0x72, 0x2A, 0x7C, 0xCD, 0x5D,
-    0x46, 0x05, 0x7E, 0x0F, 0x75, 0x64, 0x06, 0xF8, 0x9A, 0x81, 0x89, 0x8C, 0x69, 0xB7, 0xE6, 0x89,
-    0x0B, 0xBE, 0x27, 0xD5, 0x0F, 0x2F, 0x7C, 0x9C, 0x9A, 0x1D, 0x3A, 0x89, 0x41, 0x7C, 0x68, 0xEF,
-    0xC8, 0xD8, 0x9C, 0x0A, 0x52, 0xAC, 0x48, 0x8C, 0x15, 0x5C, 0x9B, 0x03, 0x54, 0xCD, 0xB9, 0x25,
-    0xDC, 0xF3, 0x22, 0x0F, 0x8E, 0x1B, 0x9D, 0xAF, 0x97, 0x8F, 0xE5, 0xEB, 0xF1, 0x51, 0x2A, 0x6E,
-    0x07, 0x65, 0xE8, 0x34, 0x8C, 0xC2, 0x3F, 0x6A, 0xBD, 0xE1, 0xE8, 0x0F, 0x33, 0x28, 0xFE, 0xAC,
-    0xB4, 0x80, 0x7B, 0x17, 0xB2, 0x66, 0xED, 0x88, 0xA7, 0xF7, 0x5E, 0xA6, 0x09, 0xFF, 0x9E, 0xDB,
-    0x69, 0x3C, 0x39, 0x11, 0x9D, 0x5C, 0x05, 0x07, 0xCF, 0xED, 0xE9, 0x7D, 0x98, 0xBB, 0xC9, 0x32,
-    0x48, 0xA3, 0xB9, 0x41, 0xA0, 0x7F, 0x34, 0x5F, 0x1D, 0x95, 0xD7, 0x5B, 0x88, 0xBB, 0x95, 0x89,
-    0x6F, 0x2A, 0x0E, 0xB0, 0xA2, 0x90, 0xEB, 0x8B, 0x92, 0x95, 0x03, 0xB7, 0xFE, 0xD1, 0x8B, 0xEB,
-    0xAF, 0x4F, 0x12, 0x29, 0xBD, 0xC8, 0xB9, 0x1B, 0x39, 0x69, 0x47, 0x16, 0x17, 0x81, 0xAD, 0x62,
-    0x29, 0x7A, 0x52, 0xA9, 0xDC, 0x49, 0x0A, 0x3B, 0xB3, 0xD3, 0x80, 0x6B, 0x17, 0xDE, 0xA8, 0x74,
-    0x93, 0x58, 0x02, 0x3B, 0xF5, 0x91, 0x96, 0x7B, 0xBE, 0x74, 0x00, 0xF2, 0x30, 0x16, 0xF2, 0x2D,
-    0x34, 0xA9, 0xFE, 0x04, 0x10, 0x7B, 0x5F, 0xEC, 0xFB, 0x23, 0xF1, 0x63, 0xF1, 0xD6, 0xCD, 0x82,
-    0x9D, 0x9F, 0x9B, 0x83, 0x5F, 0x00, 0xAD, 0x04, 0x5B, 0x53, 0x73, 0x02, 0xCD, 0xEC, 0x25, 0x9B,
-    0x45, 0x37, 0x42, 0x07, 0x31, 0x30, 0xA1, 0x29, 0xE5, 0x30, 0x91, 0xF1, 0x97, 0xD9, 0xE9, 0xC3,
-    0x8B, 0x62, 0xBD, 0x25, 0x5F, 0xEF, 0x03, 0xC3, 0x92, 0x66, 0x40, 0xD0, 0xDB, 0xB9, 0xFD, 0x90,
-    0x3B, 0x5C, 0xDE, 0x92, 0x14, 0x7E, 0x14, 0x17, 0x80, 0xC6, 0x60, 0x19, 0xE4, 0x7A, 0x4E, 0x52,
-    0xA2, 0xB0, 0xF3, 0xAE, 0xA4, 0xF6, 0x66, 0xB6, 0xE8, 0xD3, 0xFD, 0x7B, 0x20, 0xB5, 0x27, 0x8F,
-    0x32, 0x19, 0x64, 0xE8, 0x04, 0x3D, 0xB8, 0x15, 0x17, 0x8F, 0x3C, 0x60, 0x82, 0xCC, 0x9C, 0x38,
-    0xA3, 0x10, 0x49, 0x16, 0x8F, 0x89, 0x71, 0x7C, 0x9E, 0x1A, 0x9B, 0xC1, 0x40, 0x56, 0x57, 0x3D,
-    0x20, 0x88, 0xD0, 0x40, 0xF4, 0x12, 0x35, 0x11, 0xD7, 0x0C, 0x21, 0x8A, 0xCC, 0xAC, 0x0F, 0x43,
-    0x14, 0xF5, 0x49, 0x85, 0xB0, 0xDF, 0x30, 0x40, 0x35, 0xFB, 0xCF, 0x3C, 0x80, 0xB7, 0xFF, 0x42,
-    0x73, 0x70, 0x81, 0xBD, 0x78, 0x70, 0x01, 0x2C, 0x37, 0x0C, 0xBF, 0x22, 0x34, 0x6B, 0xA3, 0x9D,
-    0xF7, 0x73, 0xE9, 0x38, 0xA9, 0x2A, 0xBC, 0x11, 0x57, 0xA4, 0x01, 0xD7, 0xA1, 0x50, 0x94, 0xB8,
-    0x8A, 0x98, 0xFE, 0x0F, 0x90, 0xF3, 0xDD, 0x91, 0x78, 0x98, 0x39, 0x00, 0x95, 0xC3, 0xD1, 0x6E,
-    0xE5, 0x45, 0xCC, 0x1D, 0xD7, 0x33, 0x0E, 0x4D, 0xA6, 0xB5, 0xA6, 0xB3, 0xED, 0xE4, 0x00, 0xC6,
-    0xE3, 0xBD, 0x07, 0xC9, 0x8F, 0xE6, 0xF7, 0x2F, 0xE1, 0xA9, 0x4F, 0xCB, 0xBA, 0xDA, 0xE6, 0x59,
-    0xAD, 0x8E, 0x59, 0x10, 0xE5, 0xB1, 0x55, 0x2E, 0x84, 0x4B, 0x07, 0x97, 0xCC, 0x92, 0xF4, 0x84,
-    0x4B, 0x72, 0x55, 0x73, 0x4A, 0x77, 0xF8, 0x2C, 0xB6, 0x3E, 0x77, 0x81, 0xC7, 0xE3, 0x78, 0x7C,
-    0x83, 0xC5, 0x7C, 0x59, 0x6F, 0x10, 0xD4, 0xF3, 0xFA, 0x28, 0x34, 0x91, 0xF8, 0x1F, 0xAF, 0xAD,
-    0xBD, 0x9D, 0x18, 0x44, 0xC6, 0x23, 0x89, 0xB3, 0xA3, 0x26, 0x35, 0x27, 0x6E, 0x83, 0xFC, 0x9A,
-    0x43, 0x34, 0xCD, 0xC9, 0xA0, 0xF5, 0x06, 0x2D, 0xE2, 0xD1, 0x9D, 0x6E, 0xF7, 0x6A, 0x8D, 0x1F,
-    0xA6, 0x2C, 0x07, 0x9C, 0x59, 0x39, 0xD0, 0x6B, 0xCA, 0x81, 0x57, 0xD6, 0x7E, 0x33, 0xE4, 0x56,
-    0x63, 0xC5, 0x8A, 0xBB, 0xAE, 0x97, 0x51, 0x3B, 0xB3, 0x7C, 0xE7, 0x99, 0x37, 0x6E, 0x28, 0x99,
-    0xC7, 0xFB, 0x3C, 0x66, 0x33, 0x35, 0x83, 0x34, 0x2B, 0x72, 0xB4, 0x85, 0xDD, 0x23, 0x06, 0x3C,
-    0x6E, 0x12, 0x20, 0x65, 0xFC, 0x70, 0xED, 0x66, 0x4D, 0x89, 0x3A, 0x48, 0xC9, 0xF3, 0x88, 0xDE,
-    0xE8, 0x76, 0xFF, 0xB1, 0xD9, 0x42, 0x36, 0xA7, 0x67, 0xD6, 0xCD, 0xFF, 0xEC, 0xF4, 0xD4, 0x71,
-    0xE9, 0x54, 0x20, 0xD4, 0xE3, 0x01, 0xB7, 0x9F, 0x27, 0x46, 0x1F, 0x7E, 0x3A, 0x3B, 0x86, 0x78,
-    0xCA, 0x52, 0x05, 0xBA, 0x5E, 0x84, 0x33, 0xDC, 0x49, 0xB9, 0x29, 0x3F, 0x6D, 0x54, 0x77, 0x6C,
-    0xA9, 0xCE, 0x5B, 0xFA, 0x43, 0x9D, 0x57, 0xB8, 0xE2, 0x1F, 0xB2, 0xEE, 0x7E, 0x58, 0x43, 0xFE,
-    0x1F, 0x85, 0x54, 0x5F, 0x68, 0x1C, 0x45, 0x18, 0xFF, 0xCD, 0xCE, 0x5D, 0xAE, 0xCD, 0xE6, 0x6E,
-    0x0F, 0xB9, 0xD8, 0x16, 0x92, 0x6C, 0x91, 0x22, 0x67, 0x9A, 0x64, 0x0F, 0x3D, 0x4A, 0x2A, 0x7B,
-    0xB7, 0xD3, 0x0A, 0x06, 0xCC, 0x83, 0x27, 0x26, 0x0A, 0x15, 0xEA, 0x3D, 0xF4, 0xA1, 0x84, 0xAA,
-    0x27, 0x1C, 0x34, 0xC2, 0x25, 0x77, 0x4D, 0x44, 0xF1, 0xED, 0xDE, 0xFA, 0x24, 0xDE, 0x83, 0x4A,
-    0x7A, 0xA5, 0x34, 0x2F, 0x42, 0x0B, 0x69, 0x32, 0xB6, 0x42, 0xB1, 0x22, 0x2E, 0xB6, 0x7A, 0xF8,
-    0xE7, 0x61, 0x5F, 0xAC, 0x85, 0x3C, 0xB8, 0xE2, 0x3E, 0x1C, 0x65, 0xEF, 0xC6, 0xD9, 0xDD, 0x58,
-    0x1B, 0x4B, 0x71, 0x77, 0xD8, 0x99, 0x9D, 0x6F, 0xBE, 0x6F, 0xBE, 0xF9, 0xFD, 0x7E, 0xDF, 0x0C,
-    0xC3, 0x47, 0x97, 0x78, 0x70, 0xC1, 0x48, 0x49, 0xE3, 0x7E, 0x82, 0x9B, 0x60, 0x40, 0x09, 0x16,
-    0x57, 0xFB, 0xC4, 0xED, 0xD6, 0xE8, 0x6F, 0x88, 0x13, 0x16, 0xD3, 0xBC, 0x91, 0xA2, 0xF0, 0xF3,
-    0xBA, 0x9B, 0x06, 0xB3, 0x44, 0x47, 0xF4, 0x86, 0xE7, 0xD9, 0x78, 0xBB, 0xBD, 0x2A, 0x84, 0x2F,
-    0xBB, 0x46, 0x19, 0xE7, 0xD9, 0xA4, 0x25, 0xB8, 0x70, 0xA4, 0x6B, 0x66, 0x69, 0x29, 0x1B, 0x23,
-    0xD4, 0xAE, 0x15, 0xD5, 0x2F, 0x1B, 0x87, 0xFA, 0x83, 0xBE, 0x62, 0x17, 0x8C, 0x55, 0x9E, 0x85,
-    0xEA, 0x4C, 0x6D, 0x4C, 0x4F, 0xE4, 0x47, 0x4C, 0x53, 0xF7, 0x08, 0x23, 0x6C, 0xCE, 0x98, 0xB1,
-    0xBB, 0x45, 0x75, 0xC5, 0x59, 0xD4, 0xC0, 0xD2, 0xD2, 0xF3, 0x75, 0x5E, 0x30, 0xB4, 0xC6, 0x96,
-    0x43, 0x7D, 0xC4, 0x01, 0x53, 0x3E, 0x59, 0x60, 0xA3, 0x18, 0xBD, 0xA7, 0x9F, 0x19, 0x8E, 0x33,
-    0x43, 0xB5, 0xB5, 0x55, 0x97, 0xDA, 0x32, 0x63, 0x13, 0xE9, 0x18, 0x5A, 0xD0, 0x19, 0xF1, 0x06,
-    0x06, 0xF7, 0x56, 0x95, 0xDB, 0xC2, 0xD7, 0xFA, 0xD2, 0x8F, 0x7C, 0x4A, 0x84, 0x57, 0xBC, 0x78,
-    0x93, 0x8D, 0xCA, 0x5C, 0x29, 0xAF, 0x69, 0x0D, 0xCF, 0xA0, 0xAE, 0x45, 0x98, 0xCA, 0x7D, 0xED,
-    0x9C, 0x6B, 0x50, 0xDB, 0x24, 0x28, 0x52, 0xD7, 0x20, 0x9E, 0xC6, 0xAE, 0x50, 0x9E, 0x09, 0xE7,
-    0x3D, 0x43, 0x71, 0x4C, 0x99, 0x92, 0xEA, 0x18, 0xD8, 0x50, 0x9C, 0x38, 0x29, 0x6D, 0x6A, 0xAB,
-    0xCE, 0x15, 0x99, 0x06, 0xC6, 0x9E, 0xDC, 0xEE, 0xBF, 0xE6, 0x8C, 0x49, 0x5C, 0x54, 0x76, 0x75,
-    0xB6, 0x7F, 0xF5, 0x0D, 0x99, 0x2B, 0xB0, 0x25, 0x16, 0x2E, 0x43, 0x7B, 0xF0, 0x42, 0xE3, 0x16,
-    0xF1, 0x8C, 0x1B, 0xDD, 0x41, 0x20, 0x5E, 0xAC, 0xAE, 0x57, 0x8B, 0x71, 0xA5, 0x41, 0x39, 0xE5,
-    0x87, 0xEF, 0x59, 0x3E, 0x30, 0xBE, 0x66, 0xF9, 0xC1, 0x1F, 0xE5, 0xD2, 0x15, 0x41, 0x6F, 0xF9,
-    0x87, 0xEF, 0x51, 0xAE, 0x34, 0xC6, 0xD7, 0xEA, 0xBD, 0x60, 0x4E, 0x27, 0x6E, 0xD0, 0xF6, 0xFD,
-    0xD5, 0xB3, 0x18, 0x34, 0xE6, 0x85, 0xAD, 0x37, 0xE3, 0xEB, 0x1C, 0x05, 0xAB, 0x80, 0x7F, 0x01,
-    0xDD, 0x8D, 0x22, 0x8A, 0x85, 0xDA, 0x7A, 0x49, 0x23, 0x8E, 0x6E, 0xEB, 0xE4, 0xFE, 0xA6, 0x60,
-    0x04, 0xEE, 0x24, 0xE5, 0x8B, 0x89, 0x3B, 0x96, 0x3D, 0x17, 0x41, 0x38, 0xDE, 0x5E, 0xB3, 0x84,
-    0x6F, 0xC2, 0x9C, 0xC6, 0x84, 0x6C, 0x19, 0x64, 0xE4, 0x76, 0x15, 0x33, 0x79, 0x74, 0xB3, 0xA6,
-    0x6F, 0x7B, 0x40, 0x08, 0x7C, 0xF1, 0x21, 0xE0, 0x23, 0xF6, 0x95, 0x3F, 0x25, 0xFB, 0x3F, 0x20,
-    0xBE, 0x8B, 0xDB, 0x5D, 0xE0, 0x4A, 0x5D, 0xE8, 0xDE, 0xC4, 0x23, 0xBA, 0x18, 0x9E, 0x9F, 0x9F,
-    0x15, 0xA2, 0xBF, 0xD0, 0x6E, 0x37, 0x83, 0xB3, 0xEE, 0x48, 0x44, 0x0E, 0xA5, 0xE1, 0x05, 0xF9,
-    0x27, 0xBB, 0xC0, 0x55, 0xEB, 0x8E, 0x4E, 0x6D, 0xF9, 0xD3, 0xAA, 0x27, 0x5D, 0x1F, 0x92, 0x92,
-    0xB4, 0x86, 0xFE, 0x51, 0x84, 0x28, 0x06, 0x36, 0x50, 0x6F, 0x18, 0xB6, 0x61, 0x53, 0x07, 0x31,
-    0x44, 0xCF, 0x94, 0x14, 0x08, 0x50, 0x03, 0xE4, 0x09, 0x5C, 0x28, 0x8E, 0x04, 0x15, 0x09, 0x2E,
-    0x91, 0x0B, 0xC8, 0x78, 0xD4, 0x68, 0x07, 0x46, 0xF5, 0x1F, 0x63, 0x21, 0x34, 0x9E, 0x92, 0x47,
-    0xDD, 0x18, 0x4D, 0x8D, 0x6E, 0x94, 0x0E, 0x61, 0x7F, 0x04, 0x4E, 0x61, 0xBE, 0x66, 0x05, 0x19,
-    0xCE, 0x85, 0x0C, 0xF7, 0xBF, 0x98, 0x3F, 0xB9, 0x8E, 0x94, 0x6C, 0x5B, 0x41, 0x36, 0x17, 0x02,
-    0x9A, 0xB6, 0xBD, 0xA3, 0xCB, 0x67, 0x24, 0x7A, 0x72, 0x9C, 0x9E, 0x3D, 0x69, 0x5D, 0xF7, 0xEA,
-    0xBF, 0xA4, 0xE4, 0xD8, 0xB8, 0xE2, 0xD5, 0x26, 0xB5, 0xB7, 0xBB, 0x78, 0xEC, 0x91, 0x33, 0xC4,
-    0x27, 0x1E, 0x71, 0x89, 0x2C, 0x35, 0x94, 0x34, 0x7B, 0x89, 0x3A, 0x05, 0x39, 0xFA, 0x0F, 0x86,
-    0xE3, 0x9A, 0x53, 0x1B, 0x93, 0x39, 0x62, 0x1C, 0xA4, 0x3B, 0xF3, 0xCD, 0x77, 0x9F, 0x2C, 0x17,
-    0x33, 0xEE, 0x41, 0x02, 0x64, 0xA9, 0x5D, 0xA0, 0x81, 0x18, 0x80, 0x84, 0x10, 0xBD, 0xE5, 0xF6,
-    0xC5, 0x4E, 0x03, 0x93, 0x8B, 0x50, 0x7E, 0x64, 0x38, 0xF0, 0xD8, 0x3D, 0x77, 0x55, 0xCF, 0x6C,
-    0x7F, 0xC1, 0x49, 0xC1, 0x09, 0xB2, 0x25, 0x2F, 0xC7, 0xF4, 0x5E, 0xB8, 0xEB, 0x96, 0x9B, 0x76,
-    0x58, 0x90, 0xB4, 0xC4, 0x6B, 0x29, 0xF8, 0x0E, 0x34, 0x87, 0x8C, 0xDE, 0x44, 0xA1, 0xDE, 0xAD,
-    0x26, 0x1C, 0x64, 0x77, 0x26, 0xC3, 0x47, 0xE9, 0x6A, 0x75, 0xF1, 0x47, 0xC2, 0x8F, 0x46, 0xF7,
-    0xE5, 0x48, 0x8A, 0x0D, 0xC7, 0x90, 0x58, 0xB1, 0x0D, 0xD1, 0xD5, 0xB6, 0x5D, 0x65, 0xA5, 0x11,
-    0x2E, 0x6C, 0x19, 0x2B, 0x5D, 0x0D, 0xAE, 0x86, 0x3A, 0xB7, 0xB8, 0xD5, 0xF1, 0xA9, 0x4F, 0x7B,
-    0x95, 0xC0, 0xD0, 0x09, 0xB4, 0x95, 0x2C, 0xE3, 0x56, 0x0E, 0x4D, 0xBC, 0x4F, 0x0E, 0x02, 0x43,
-    0xA0, 0xC0, 0x80, 0x2C, 0x19, 0x94, 0xCB, 0xD2, 0xF1, 0x7C, 0xB0, 0x2A, 0x59, 0xB1, 0x81, 0x5C,
-    0x47, 0x12, 0x4D, 0x92, 0x15, 0x39, 0x5B, 0xB2, 0xE5, 0x02, 0x59, 0x56, 0x7B, 0xA0, 0x48, 0xEB,
-    0x57, 0x24, 0x87, 0x83, 0xE4, 0x56, 0x1E, 0x1F, 0x86, 0xC1, 0xA2, 0xB8, 0x6B, 0xCA, 0x9A, 0x72,
-    0xA9, 0xCE, 0xEB, 0xB6, 0x65, 0x63, 0x80, 0x59, 0xEC, 0x9A, 0xDE, 0x71, 0x4A, 0x50, 0x8B, 0xD5,
-    0x6A, 0x41, 0x07, 0x99, 0x83, 0xF0, 0xAC, 0x50, 0xB3, 0x2E, 0x0B, 0xAE, 0x8B, 0x90, 0xA3, 0x3D,
-    0xF5, 0xEF, 0xBB, 0xD6, 0xCD, 0x8F, 0x25, 0x05, 0xCD, 0x6B, 0xCB, 0x09, 0x47, 0xE7, 0x07, 0xCA,
-    0x09, 0x47, 0xB5, 0xAF, 0xD5, 0x5F, 0x44, 0x19, 0xA5, 0x65, 0xC5, 0x55, 0x6F, 0x7B, 0x6A, 0xA7,
-    0x66, 0xCD, 0x4E, 0x94, 0x53, 0xA9, 0x6A, 0x41, 0xD3, 0xC6, 0x16, 0x11, 0x2B, 0x5A, 0xFB, 0x29,
-    0xDF, 0x77, 0xC7, 0xF2, 0x55, 0x47, 0x73, 0xF7, 0x96, 0x23, 0x3D, 0xBC, 0xB7, 0xF9, 0xD6, 0xBA,
-    0x99, 0x92, 0xAD, 0x20, 0x0B, 0xAA, 0xE3, 0x4D, 0x53, 0x56, 0xBF, 0x7B, 0x89, 0xF0, 0xFD, 0x21,
-    0x6C, 0xA6, 0x1E, 0x7C, 0x3D, 0xD5, 0x81, 0xBC, 0xFE, 0x88, 0xF8, 0xEC, 0x84, 0x60, 0x30, 0x84,
-    0x08, 0x74, 0xB2, 0x70, 0x61, 0x07, 0xDA, 0xFF, 0x59, 0x13, 0x54, 0xC1, 0xC5, 0xA0, 0x1E, 0x1E,
-    0x0C, 0x10, 0x30, 0x1B, 0x53, 0x45, 0x9F, 0xC1, 0x34, 0xDA, 0x5B, 0x62, 0xDB, 0x9B, 0x06, 0x79,
-    0x47, 0xD8, 0xC1, 0xBD, 0x94, 0xD9, 0xF1, 0x8A, 0x22, 0x44, 0xD1, 0xA2, 0xC8, 0xD1, 0x2E, 0xE6,
-    0x0E, 0xD9, 0x08, 0xD1, 0x94, 0xF7, 0x56, 0x58, 0x6B, 0xE2, 0x44, 0x10, 0x3C, 0x52, 0x2F, 0x8B,
-    0xE8, 0x8E, 0x1F, 0x3F, 0x89, 0x77, 0x2F, 0xB7, 0x9E, 0x57, 0xAD, 0x0A, 0xE2, 0xEC, 0xEE, 0x07,
-    0xD4, 0xE8, 0xB5, 0x08, 0x27, 0x02, 0x78, 0x6A, 0xDF, 0xD9, 0xB3, 0x15, 0x39, 0xF5, 0x11, 0xAD,
-    0x0E, 0xDA, 0x4F, 0x37, 0xAE, 0x07, 0xF7, 0xD7, 0x13, 0xEC, 0x6B, 0x7A, 0x68, 0xA8, 0xF9, 0xEC,
-    0xB9, 0x1B, 0xF7, 0x25, 0x6F, 0xAF, 0xDC, 0xCD, 0x53, 0xE4, 0x68, 0x23, 0xD8, 0x38, 0x07, 0xFE,
-    0xEA, 0x58, 0xCD, 0x7E, 0x0E, 0xDF, 0xD2, 0xEC, 0x88, 0xD1, 0x02, 0x9A, 0x4A, 0x63, 0x30, 0x33,
-    0x75, 0xA6, 0x75, 0xA4, 0xF1, 0x33, 0x3D, 0x9D, 0x6C, 0xE6, 0xE3, 0xC7, 0x8E, 0xFF, 0xFE, 0xF9,
-    0xAD, 0x04, 0x3D, 0x35, 0x94, 0x6C, 0xE6, 0x8E, 0x30, 0xFE, 0x13, 0x55, 0x18, 0x79, 0xF3, 0x3C,
-    0xE1, 0x95, 0x91, 0x04, 0xD2, 0xA9, 0x99, 0xA6, 0x9D, 0x4F, 0x52, 0x26, 0x75, 0x98, 0x46, 0x36,
-    0x39, 0x32, 0x92, 0xCC, 0x27, 0x72, 0xB4, 0xA5, 0x70, 0xA4, 0xAF, 0x9F, 0xFB, 0x55, 0xE1, 0xA9,
-    0xC6, 0xED, 0x97, 0x28, 0xFE, 0x06, 0xD5, 0x7C, 0x4B, 0x8C, 0xDC, 0x66, 0x9E, 0xDF, 0x47, 0xD2,
-    0xDD, 0x9C, 0x11, 0x81, 0xA1, 0x03, 0x48, 0x19, 0xAF, 0xB5, 0x30, 0xF7, 0x60, 0x20, 0x33, 0x86,
-    0x47, 0xBC, 0xCC, 0x61, 0x06, 0x50, 0x91, 0x94, 0x15, 0x8C, 0x0F, 0x3E, 0xB8, 0x81, 0x51, 0x49,
-    0x07, 0x1D, 0xE4, 0xC3, 0x1C, 0xB4, 0xCA, 0xEE, 0xF6, 0x1E, 0x12, 0x20, 0x40, 0xAA, 0xBA, 0x68,
-    0x1B, 0x81, 0x0F, 0x3E, 0xB8, 0x91, 0x1D, 0x23, 0x07, 0x1F, 0xAC, 0x2C, 0x84, 0xC4, 0x2E, 0x05,
-    0xDB, 0x7B, 0x98, 0x83, 0x92, 0x65, 0x77, 0xD1, 0xD2, 0x41, 0x48, 0x0C, 0x44, 0xF4, 0x68, 0x8D,
-    0x41, 0xE0, 0x83, 0x38, 0x23, 0x75, 0x16, 0x50, 0x03, 0x2B, 0x5A, 0xA2, 0xD6, 0x6C, 0x35, 0xAB,
-    0x98, 0xDF, 0xEF, 0xFF, 0xB1, 0xFA, 0x21, 0xB5, 0x1E, 0x96, 0x2C, 0x21, 0x69, 0x89, 0x8F, 0xE2,
-    0xE3, 0x7B, 0xFE, 0x1F, 0xBF, 0xFF, 0xE3, 0xA3, 0x31, 0xA7, 0xD4, 0x82, 0x52, 0x76, 0xA6, 0x54,
-    0xA2, 0x94, 0x13, 0x2B, 0x85, 0x0B, 0x4A, 0x35, 0xCD, 0x38, 0x6C, 0x9A, 0x37, 0x3F, 0xEC, 0x1E,
-    0xC6, 0x8D, 0x52, 0xA9, 0x8E, 0x52, 0x6E, 0xA4, 0x2C, 0xFD, 0x03, 0x77, 0xDC, 0xA6, 0xB9, 0xB0,
-    0xDA, 0x8D, 0xEE, 0xBE, 0xC3, 0x1F, 0x78, 0xA7, 0x69, 0x4A, 0x14, 0xA0, 0xA2, 0xE7, 0x55, 0x15,
-    0xA8, 0xD0, 0x8D, 0xED, 0x43, 0x99, 0x92, 0x3F, 0x4B, 0xDF, 0x09, 0xBA, 0xDD, 0x9D, 0xEF, 0xE8,
-    0x1F, 0x4D, 0x53, 0xB3, 0xE8, 0x0F, 0xBB, 0xD6, 0x2E, 0x95, 0xF2, 0x9D, 0xA6, 0xB9, 0x8C, 0x02,
-    0x46, 0x78, 0x4E, 0xC9, 0xAE, 0x3B, 0xE8, 0x1E, 0x51, 0xCA, 0x67, 0xC9, 0xBB, 0xEE, 0x5E, 0x3C,
-    0x83, 0x5D, 0xD3, 0xA4, 0xCA, 0xBF, 0xB3, 0x54, 0xE0, 0x9A, 0x59, 0xF1, 0x46, 0xCD, 0x5D, 0x7F,
-    0xE7, 0x6E, 0x79, 0x7A, 0xC3, 0x2A, 0x95, 0x6F, 0x37, 0x39, 0x77, 0x91, 0xD2, 0x83, 0x71, 0x84,
-    0xB7, 0x39, 0x48, 0x81, 0x52, 0x07, 0x94, 0x9A, 0x51, 0x7A, 0x80, 0xDA, 0xB6, 0xEE, 0x36, 0x40,
-    0x8F, 0xF8, 0x43, 0xFE, 0x8C, 0xD1, 0x24, 0xB2, 0xD1, 0x2B, 0x7B, 0x7C, 0x28, 0x41, 0xE5, 0x6C,
-    0x80, 0x32, 0x2A, 0x25, 0xD3, 0xA1, 0x42, 0x6C, 0x6E, 0x2C, 0xE3, 0x36, 0x41, 0x95, 0x4D, 0x1C,
-    0x76, 0xBB, 0x73, 0x72, 0xA1, 0x50, 0x6C, 0x2F, 0xBA, 0x37, 0xFD, 0x31, 0xE2, 0xA3, 0xEB, 0xEA,
-    0xCF, 0x38, 0x32, 0xCA, 0x6C, 0xD0, 0x7A, 0x43, 0x66, 0x52, 0xED, 0x6F, 0x72, 0xA7, 0x69, 0x3E,
-    0x1B, 0xCF, 0x9C, 0x43, 0x69, 0x56, 0x2E, 0x6D, 0xE0, 0x21, 0xC4, 0x13, 0x13, 0xCC, 0x3C, 0x9E,
-    0x74, 0x64, 0xC3, 0x39, 0x4A, 0x74, 0x33, 0xE9, 0x28, 0x9F, 0xC0, 0xC1, 0xF9, 0x6A, 0x71, 0xB6,
-    0x46, 0x89, 0x52, 0xE0, 0x5E, 0xBC, 0xBB, 0xDB, 0xDF, 0x73, 0xB8, 0x1C, 0xF4, 0x7F, 0x72, 0x50,
-    0x66, 0x38, 0x7B, 0xD4, 0x7F, 0xCA, 0x8B, 0xEC, 0xCC, 0x28, 0x31, 0xFE, 0x8F, 0x7A, 0x62, 0x16,
-    0x46, 0x3D, 0x18, 0x7B, 0x63, 0xE3, 0x8C, 0xD0, 0x60, 0xAA, 0x36, 0x0F, 0x41, 0xF7, 0x38, 0x0F,
-    0x1D, 0x65, 0xDF, 0x7B, 0x38, 0xA8, 0x0F, 0xBD, 0xCD, 0xC3, 0x9D, 0x4F, 0xE5, 0xD0, 0x34, 0x19,
-    0x0F, 0xD7, 0x97, 0x2A, 0x0C, 0x35, 0xEE, 0x8D, 0xF5, 0x21, 0xD0, 0x87, 0x50, 0x9D, 0xE3, 0xC1,
-    0x57, 0x95, 0xFE, 0x55, 0xCA, 0x3D, 0xA3, 0xE0, 0x61, 0xF9, 0x75, 0x1C, 0xBE, 0x3C, 0x5E, 0xA1,
-    0x00, 0x94, 0x92, 0x37, 0x31, 0x0E, 0x13, 0x8E, 0x8E, 0x92, 0x5A, 0x39, 0x6E, 0x9C, 0xDE, 0x8A,
-    0xA3, 0x21, 0x03, 0x89, 0x29, 0xE7, 0xA4, 0x3D, 0xE0, 0x16, 0xA8, 0x7B, 0xD0, 0x8D, 0x38, 0xC5,
-    0x20, 0x05, 0x4B, 0x0E, 0xB5, 0xDC, 0xB2, 0x2A, 0x79, 0xCB, 0x2A, 0xE4, 0x2D, 0xFB, 0xB2, 0xBC,
-    0xE5, 0xBE, 0x29, 0x6F, 0xF5, 0xE5, 0x96, 0x59, 0xCA, 0x2D, 0xEF, 0x02, 0x6E, 0xDD, 0x3E, 0x3A,
-    0xE6, 0x5B, 0xE8, 0x5A, 0x87, 0x63, 0x73, 0x4D, 0x7D, 0x0B, 0x5E, 0xF9, 0xF4, 0xBE, 0xBC, 0xD2,
-    0xDB, 0xDC, 0xF5, 0xEF, 0xBF, 0x53, 0xFB, 0x94, 0xF0, 0x89, 0x51, 0x4A, 0xDF, 0x44, 0x94, 0xCC,
-    0x6C, 0x0E, 0x49, 0xD2, 0xC1, 0x8D, 0x0E, 0xBA, 0xD1, 0x51, 0x4E, 0xDA, 0xC1, 0x6C, 0x76, 0xD0,
-    0xF2, 0x0E, 0x8A, 0xEF, 0xE0, 0xF9, 0x0E, 0xBA, 0x14, 0xA2, 0x66, 0x6E, 0xC1, 0xB1, 0x5C, 0x75,
-    0xCC, 0x52, 0xDF, 0x03, 0xD3, 0x75, 0x94, 0x8F, 0x67, 0x5D, 0xBC, 0x63, 0xE7, 0x1D, 0xF4, 0x15,
-    0x65, 0xD5, 0x1D, 0x72, 0xA3, 0x94, 0x4D, 0x0E, 0xE0, 0x28, 0x72, 0x18, 0xD9, 0x44, 0xFC, 0x45,
-    0x5A, 0xD0, 0x64, 0x52, 0xA7, 0x1E, 0x15, 0xBE, 0x30, 0xC2, 0x89, 0xD7, 0x43, 0x0B, 0xFE, 0x01,
-    0x27, 0x09, 0x4E, 0xBC, 0xD7, 0x2F, 0x64, 0x56, 0x8E, 0x93, 0xC4, 0xBE, 0x90, 0xB9, 0x51, 0x0F,
-    0x8D, 0xC0, 0x49, 0x4F, 0xF5, 0x3A, 0x6E, 0x64, 0x5F, 0xB8, 0x5C, 0xE0, 0x04, 0xD4, 0x71, 0xE1,
-    0x4A, 0xAC, 0x7A, 0x21, 0xA6, 0xFB, 0x02, 0xAA, 0xEA, 0x85, 0x98, 0xE9, 0x0B, 0x05, 0x2B, 0xDA,
-    0x0B, 0xC9, 0x60, 0xE5, 0xE8, 0xB8, 0xF7, 0x11, 0x6A, 0x1A, 0x55, 0x5A, 0x4C, 0x28, 0xCD, 0xB6,
-    0xD6, 0x55, 0x34, 0xA9, 0x8F, 0x9B, 0x6E, 0x5A, 0xA1, 0xDB, 0x0E, 0xC9, 0x08, 0x53, 0x98, 0x9B,
-    0x05, 0xEE, 0xBA, 0x31, 0x66, 0x2E, 0x41, 0xAF, 0xAD, 0x1C, 0xFC, 0xE8, 0x53, 0xF0, 0x56, 0x94,
-    0xBC, 0x57, 0xD0, 0x70, 0x54, 0xA4, 0xCC, 0x09, 0xBB, 0x93, 0xB6, 0x42, 0x80, 0x02, 0xC0, 0x6B,
-    0x6B, 0x70, 0x78, 0xE7, 0x39, 0x3D, 0x9E, 0xA4, 0x00, 0xEB, 0x32, 0xC5, 0x08, 0x85, 0xCA, 0x93,
-    0x5C, 0x58, 0xED, 0x76, 0x21, 0x92, 0x45, 0xDC, 0x83, 0xC5, 0x93, 0x96, 0x1E, 0xD0, 0x66, 0x65,
-    0x52, 0xAC, 0x9C, 0x64, 0x9F, 0xD8, 0x12, 0x9B, 0xBF, 0x42, 0xCA, 0xF1, 0x0D, 0xDC, 0x73, 0x2E,
-    0x91, 0xEB, 0x40, 0xCD, 0x46, 0x91, 0xB0, 0xB9, 0x2C, 0x12, 0x62, 0xC8, 0x2C, 0xC0, 0x1E, 0xD2,
-    0x43, 0x52, 0x85, 0x49, 0x25, 0x00, 0x62, 0xAC, 0xD4, 0xC2, 0xF0, 0x6C, 0x81, 0xDB, 0x56, 0xE6,
-    0x81, 0x3A, 0x53, 0xBC, 0xE1, 0x1D, 0xA6, 0x7C, 0xF1, 0x38, 0x5E, 0x35, 0x69, 0x86, 0x7C, 0x8C,
-    0x06, 0x1C, 0x5E, 0xED, 0x1E, 0xE1, 0x54, 0x76, 0x34, 0x9B, 0x70, 0x16, 0xF9, 0x33, 0x1C, 0xCE,
-    0x81, 0x35, 0x2A, 0xEB, 0xCE, 0x12, 0x98, 0xC2, 0xAC, 0x3B, 0xC2, 0x0E, 0xE4, 0x05, 0x0F, 0x5D,
-    0x00, 0x17, 0x98, 0xF8, 0xE9, 0x5D, 0x58, 0x05, 0xF1, 0x83, 0xF2, 0x49, 0xF6, 0x7A, 0x6B, 0xD2,
-    0xA0, 0xBB, 0x04, 0x8A, 0xB3, 0x48, 0x35, 0xD5, 0xD6, 0x66, 0x92, 0x0A, 0xF3, 0xB0, 0x99, 0x44,
-    0xDC, 0x02, 0x75, 0x1C, 0xBF, 0x8D, 0x5A, 0x53, 0xA9, 0x30, 0x55, 0xBF, 0xA5, 0xD8, 0x1A, 0xF7,
-    0xD8, 0x34, 0x94, 0x39, 0xDE, 0xD2, 0x7A, 0x73, 0x8F, 0x29, 0xEE, 0xD9, 0x29, 0x0E, 0x47, 0x41,
-    0xA9, 0x31, 0x56, 0xC6, 0x7A, 0x77, 0x3E, 0xA2, 0x04, 0x42, 0x37, 0xC8, 0x35, 0x18, 0xB9, 0x3E,
-    0xC7, 0xDC, 0xE3, 0x2C, 0xE0, 0xA2, 0xCF, 0x8B, 0x0E, 0x47, 0x12, 0x14, 0x8E, 0x8B, 0x15, 0x2F,
-    0x92, 0x8D, 0xF8, 0xA3, 0xCF, 0x19, 0xF2, 0x22, 0xDC, 0x11, 0xF9, 0x88, 0xFF, 0x18, 0xC6, 0xBE,
-    0xB1, 0xD2, 0xED, 0xCE, 0x1F, 0x15, 0xE9, 0x31, 0xE2, 0xEE, 0x06, 0x2A, 0x34, 0x39, 0x5D, 0x6A,
-    0x85, 0xB3, 0xE7, 0x73, 0x76, 0x9D, 0xFF, 0x4D, 0xA5, 0x73, 0x9A, 0xDA, 0x1D, 0xEA, 0xF4, 0x3E,
-    0xBD, 0x41, 0x3F, 0xD1, 0xCE, 0xF5, 0xEE, 0xDC, 0x6E, 0xBD, 0xC1, 0x3B, 0x9A, 0x5E, 0x30, 0x74,
-    0x94, 0x8B, 0xD9, 0x32, 0x1F, 0x08, 0xD1, 0x02, 0x4C, 0x4E, 0x81, 0x76, 0x82, 0xB9, 0x62, 0xB0,
-    0x30, 0xDB, 0x64, 0x15, 0x56, 0x86, 0x96, 0x5A, 0xB9, 0x1B, 0x41, 0x81, 0x3A, 0x19, 0x89, 0x84,
-    0xE4, 0xE2, 0xEB, 0xA1, 0xA8, 0xB4, 0x08, 0x07, 0x2D, 0x58, 0xB7, 0x17, 0x4E, 0xA0, 0xA1, 0x7E,
-    0x54, 0x92, 0xF6, 0xEB, 0x96, 0x52, 0xDC, 0x28, 0x54, 0x22, 0x04, 0x42, 0x2A, 0xB9, 0x92, 0x6A,
-    0x3A, 0x42, 0x5D, 0x35, 0x78, 0xC3, 0x8D, 0x8C, 0x0A, 0x8F, 0x52, 0x26, 0x2C, 0xB3, 0x19, 0xA2,
-    0x04, 0xD5, 0x7C, 0x93, 0x61, 0x70, 0x8B, 0x1F, 0x44, 0x5E, 0xA1, 0xB9, 0x08, 0xC5, 0x50, 0x38,
-    0x51, 0x2A, 0xE1, 0xA7, 0x51, 0xA3, 0xBA, 0x58, 0x41, 0x5A, 0xAB, 0xEE, 0x28, 0x66, 0x75, 0x9A,
-    0xC5, 0x12, 0x4D, 0xED, 0x7C, 0x61, 0xE1, 0xE7, 0x6A, 0x7F, 0x81, 0xB1, 0x3B, 0xC4, 0x66, 0x19,
-    0x9A, 0x16, 0x1D, 0xC8, 0x0C, 0x21, 0x90, 0x10, 0x27, 0x0E, 0x4E, 0x8C, 0x6F, 0x70, 0x12, 0x40,
-    0x78, 0x38, 0x17, 0x2F, 0x60, 0xFC, 0x71, 0x12, 0x40, 0x78, 0x38, 0x29, 0x4E, 0x4A, 0x9C, 0x04,
-    0x10, 0x1E, 0x76, 0x8A, 0x93, 0x12, 0x27, 0x21, 0x64, 0xC6, 0xEF, 0x52, 0x9C, 0x60, 0x02, 0x2F,
-    0x34, 0x94, 0x22, 0x29, 0x4E, 0x2A, 0x9E, 0x28, 0x4E, 0xFA, 0x5E, 0x88, 0x2C, 0x3B, 0x65, 0xE1,
-    0x1C, 0x80, 0x86, 0xEA, 0xFF, 0xC8, 0xA6, 0xDC, 0x7C, 0x9A, 0x35, 0x3F, 0x15, 0xB1, 0x4C, 0x6E,
-    0x11, 0xB4, 0x02, 0x95, 0x9C, 0x63, 0xAA, 0x58, 0x9C, 0xA5, 0x4F, 0x0E, 0xE2, 0x44, 0x14, 0x6C,
-    0x6F, 0xFB, 0x89, 0xA3, 0x55, 0x6E, 0x7B, 0x72, 0x8E, 0xA4, 0x12, 0xE3, 0x84, 0xF2, 0x11, 0xE2,
-    0x21, 0x80, 0xAA, 0xB5, 0x6E, 0x8C, 0x71, 0x82, 0x69, 0xB3, 0x7E, 0x4F, 0xE1, 0x0E, 0x21, 0xAC,
-    0xBC, 0xAB, 0x35, 0x25, 0x65, 0x48, 0x18, 0x73, 0x15, 0x54, 0x6E, 0x4F, 0x3A, 0x18, 0xB7, 0x6F,
-    0xAE, 0x5E, 0x8A, 0x95, 0x17, 0x1C, 0xEC, 0x29, 0xF3, 0xEA, 0x55, 0x0C, 0x53, 0x27, 0xE8, 0xF8,
-    0xE8, 0xF0, 0xD5, 0x2F, 0x40, 0x94, 0x41, 0x07, 0x62, 0xC9, 0xBA, 0x9A, 0x25, 0x66, 0x11, 0x74,
-    0x2C, 0xD0, 0xE1, 0xD5, 0x2C, 0xB0, 0xD3, 0xA0, 0x63, 0x14, 0xE7, 0x70, 0x0A, 0x51, 0x18, 0x74,
-    0xD4, 0x72, 0x81, 0x53, 0x1B, 0x4D, 0x07, 0xBD, 0xA5, 0x38, 0x85, 0x0A, 0xC4, 0xA9, 0x0B, 0x2E,
-    0xE3, 0x4C, 0x7C, 0x00, 0xD2, 0xBF, 0x05, 0x46, 0xA8, 0x89, 0x80, 0xC9, 0x0A, 0x97, 0xEE, 0xB9,
-    0x00, 0xB2, 0xB9, 0x45, 0xCD, 0xBD, 0x0E, 0x6D, 0xBE, 0xFB, 0x13, 0x77, 0x5F, 0x48, 0xF5, 0x4C,
-    0x3B, 0x64, 0x81, 0x01, 0x46, 0xCD, 0x9C, 0x44, 0xA3, 0x14, 0xA2, 0xD6, 0xC9, 0x71, 0xCB, 0x2A,
-    0x40, 0xBD, 0x46, 0x45, 0x5E, 0xA9, 0x85, 0x4A, 0x89, 0x1E, 0xFA, 0xBB, 0xED, 0xE4, 0x2E, 0x77,
-    0x35, 0xE9, 0xBD, 0x92, 0x77, 0xA5, 0x14, 0x73, 0xAC, 0x06, 0x29, 0x00, 0xC0, 0x84, 0x75, 0x10,
-    0x72, 0xEE, 0x15, 0x86, 0x23, 0xEF, 0x37, 0x57, 0x21, 0xFA, 0x2B, 0x22, 0x6B, 0x36, 0x84, 0xBD,
-    0xBB, 0x4A, 0x5D, 0xF4, 0x04, 0x17, 0xE2, 0xB0, 0x39, 0x4D, 0x60, 0x6C, 0xAD, 0xFE, 0x2B, 0xCA,
-    0xE9, 0x4A, 0xCB, 0x69, 0x92, 0xB0, 0x0F, 0xB9, 0x91, 0xE8, 0x9F, 0xFE, 0xE1, 0xD5, 0xE3, 0x95,
-    0x4B, 0x28, 0xDB, 0x2C, 0x6E, 0x97, 0xF1, 0x77, 0x89, 0xFC, 0x8E, 0xFA, 0x56, 0xF8, 0x38, 0x6F,
-    0xB5, 0x54, 0x30, 0xBD, 0xF0, 0x50, 0x7C, 0x1C, 0x13, 0x1F, 0x8F, 0x5A, 0x49, 0xD9, 0x3D, 0xBE,
-    0xDA, 0x95, 0xAA, 0xBF, 0x83, 0xED, 0x19, 0x00, 0x80, 0xE9, 0xD0, 0x88, 0xC8, 0xA3, 0x12, 0x55,
-    0xFF, 0x7C, 0x3D, 0x22, 0x01, 0x01, 0x91, 0x86, 0x1B, 0xE8, 0x9B, 0x0B, 0xDE, 0x19, 0x99, 0xA5,
-    0x51, 0x98, 0x65, 0x88, 0x07, 0xDC, 0x8B, 0x19, 0x9E, 0x4D, 0x7A, 0x38, 0xB5, 0x7F, 0x97, 0xE2,
-    0xB4, 0xAF, 0x4F, 0xE5, 0xAA, 0x3C, 0x70, 0xBE, 0xE2, 0xB3, 0x78, 0x0D, 0x26, 0x41, 0xB8, 0xB1,
-    0x81, 0xD1, 0x91, 0xC2, 0x74, 0xB9, 0xBA, 0x0A, 0x5D, 0xDB, 0x8C, 0x1E, 0x64, 0xCF, 0xC9, 0xD0,
-    0x91, 0x1A, 0x52, 0xC3, 0x8B, 0x09, 0xCC, 0x29, 0x2A, 0xD0, 0x3B, 0xFB, 0x0B, 0xCC, 0x4E, 0x82,
-    0xA6, 0xBA, 0xD4, 0xEA, 0x63, 0x25, 0x56, 0x86, 0xF4, 0xCA, 0x83, 0xF8, 0x77, 0xDF, 0x4F, 0xF1,
-    0x42, 0x0D, 0x8D, 0xE1, 0xC5, 0x1C, 0x0C, 0xBC, 0x10, 0x52, 0xF1, 0x65, 0x78, 0xB8, 0x26, 0x28,
-    0x88, 0x45, 0xC3, 0x3C, 0x95, 0x1D, 0x00, 0xF6, 0x89, 0x5F, 0x87, 0x53, 0xA0, 0x33, 0x6E, 0xC5,
-    0xEB, 0x3D, 0xBB, 0x1F, 0x9D, 0x53, 0xEA, 0xEF, 0x20, 0x72, 0x20, 0xF2, 0x5C, 0x48, 0xCC, 0x10,
-    0x2D, 0x6B, 0xB6, 0xFD, 0x44, 0x23, 0xC7, 0x98, 0xB8, 0x5B, 0xEB, 0xC6, 0xE8, 0x62, 0x43, 0xAB,
-    0x68, 0xBD, 0xD6, 0xE4, 0xC5, 0xF9, 0x0A, 0x35, 0xC9, 0xED, 0xF8, 0xD9, 0x11, 0xD5, 0x04, 0xA4,
-    0xE2, 0x0A, 0x50, 0x51, 0x1A, 0xB6, 0x3C, 0xE5, 0x1F, 0xE8, 0xEB, 0x7A, 0xF7, 0xF8, 0x65, 0xC1,
-    0x01, 0xD2, 0x5D, 0xB1, 0x07, 0x30, 0x7F, 0x4E, 0x4C, 0xF0, 0x23, 0x62, 0xFB, 0xD9, 0x1E, 0x82,
-    0xEE, 0xD1, 0xDB, 0xDD, 0x13, 0x7F, 0xAF, 0xDB, 0x32, 0x69, 0x0F, 0x9A, 0x88, 0x83, 0x07, 0x1C,
-    0x7E, 0x3C, 0xC2, 0x43, 0x26, 0x51, 0xC2, 0xCC, 0xB1, 0xBC, 0xE5, 0x6C, 0x7D, 0xAF, 0xDA, 0x04,
-    0xFE, 0xBC, 0x14, 0x0E, 0x17, 0xC5, 0x22, 0x57, 0xD6, 0x9D, 0xB3, 0x40, 0x21, 0xA9, 0x09, 0x35,
-    0xCF, 0x8A, 0x49, 0x6A, 0x98, 0x0E, 0x37, 0x72, 0x89, 0xAD, 0x70, 0x89, 0x90, 0xC4, 0x4B, 0x69,
-    0x26, 0x89, 0x91, 0x24, 0x38, 0x91, 0xF3, 0xEE, 0x3F, 0xC2, 0x8E, 0x95, 0xF8, 0x00, 0x8C, 0xCA,
-    0x0F, 0x86, 0x4D, 0xEA, 0x13, 0x42, 0xFA, 0x14, 0x69, 0x3E, 0xFB, 0xB8, 0x63, 0x27, 0xD7, 0x70,
-    0x37, 0xE8, 0x0E, 0x52, 0xBC, 0xD1, 0xF0, 0xB5, 0x6B, 0xBA, 0x94, 0xFB, 0x0B, 0x3C, 0x16, 0x2F,
-    0x18, 0xF7, 0xEC, 0x03, 0x64, 0xE7, 0xBB, 0xAB, 0xC7, 0x6A, 0x34, 0x3C, 0x65, 0x79, 0xFC, 0x9B,
-    0x6D, 0xD6, 0x09, 0x26, 0x4B, 0xB5, 0x3E, 0x43, 0x77, 0x85, 0x60, 0xF4, 0x01, 0xF5, 0x49, 0xB6,
-    0x4D, 0x7C, 0xB8, 0x29, 0xEC, 0xBA, 0x02, 0xAF, 0xD5, 0x06, 0xF4, 0x52, 0x2B, 0x5C, 0x44, 0x26,
-    0x56, 0xDA, 0x64, 0x93, 0x57, 0x06, 0xC6, 0xA2, 0x31, 0x8A, 0xC0, 0xF5, 0x91, 0xC3, 0xA9, 0x31,
-    0xA2, 0xA9, 0x94, 0xB1, 0x68, 0xE5, 0x72, 0x98, 0x68, 0xEB, 0x5A, 0x99, 0x31, 0x39, 0x34, 0xC2,
-    0xB4, 0x82, 0xAF, 0x57, 0x00, 0xED, 0x32, 0xC1, 0x0E, 0xA0, 0x7A, 0xEF, 0x5D, 0x22, 0x36, 0x10,
-    0x3C, 0x71, 0x14, 0x9A, 0xCD, 0x8A, 0x97, 0x43, 0xF0, 0x0E, 0xA8, 0x12, 0x23, 0x40, 0x45, 0x75,
-    0x4C, 0x7E, 0xC8, 0x9D, 0xFE, 0xF4, 0x31, 0xFD, 0x0E, 0x1B, 0x82, 0x02, 0x08, 0x14, 0x0B, 0x62,
-    0x3D, 0x16, 0x0D, 0x41, 0x34, 0x48, 0xA5, 0x52, 0x40, 0xC8, 0x56, 0x79, 0xE9, 0x56, 0xCD, 0xA2,
-    0x7D, 0x10, 0xDA, 0xD6, 0xE4, 0xC3, 0x01, 0x3A, 0x1C, 0xA2, 0x37, 0x3B, 0x36, 0xB4, 0x29, 0xB4,
-    0x2A, 0x48, 0x96, 0xE6, 0xCE, 0x88, 0x16, 0xAD, 0x72, 0x56, 0x07, 0x10, 0x2D, 0xA1, 0xE2, 0xBF,
-    0x65, 0x6C, 0xB8, 0x87, 0xDE, 0xCB, 0x73, 0x7C, 0x1E, 0xD5, 0x85, 0xC6, 0x28, 0x47, 0x45, 0xD1,
-    0x3A, 0x07, 0x30, 0x90, 0x01, 0x42, 0xFB, 0xBA, 0xB5, 0xD3, 0x34, 0xDE, 0x9D, 0x13, 0x97, 0x52,
-    0x62, 0x68, 0x20, 0x68, 0xB0, 0xBF, 0x77, 0x25, 0xF6, 0x6E, 0x35, 0x93, 0x9E, 0x3F, 0x76, 0xB5,
-    0xA3, 0x0C, 0x7B, 0x73, 0x84, 0x5B, 0x4D, 0x61, 0x34, 0xBF, 0x96, 0x09, 0x20, 0x45, 0x52, 0x60,
-    0x1E, 0x40, 0x63, 0x3B, 0xFE, 0x44, 0x75, 0x30, 0x5F, 0x83, 0xCC, 0x29, 0x06, 0x20, 0x3F, 0x08,
-    0xC1, 0x0A, 0x68, 0xB4, 0xC6, 0x96, 0xF4, 0xB5, 0xBD, 0x01, 0x1B, 0x43, 0xD5, 0xC0, 0xFA, 0x15,
-    0xD0, 0x7C, 0xE1, 0xE6, 0x0E, 0xD1, 0x53, 0xAC, 0x46, 0x63, 0xE9, 0xEC, 0xA9, 0xE1, 0x22, 0xDA,
-    0x90, 0x2D, 0x1F, 0x1D, 0x39, 0xA9, 0x01, 0x2D, 0x41, 0x09, 0x5A, 0x26, 0xC6, 0x00, 0x17, 0x23,
-    0x28, 0x75, 0x27, 0x35, 0x71, 0xD1, 0xF9, 0x3C, 0x55, 0x09, 0xEE, 0x7D, 0x9E, 0xCE, 0x56, 0x18,
-    0x17, 0x4C, 0x5F, 0x74, 0x6A, 0xF8, 0xD7, 0x4D, 0xF3, 0xF9, 0xF5, 0xA1, 0x4F, 0x35, 0x89, 0xAE,
-    0x88, 0x06, 0xBA, 0xCF, 0x29, 0x2A, 0xF9, 0x04, 0xE3, 0x0B, 0x11, 0xB7, 0x32, 0x84, 0x40, 0x8F,
-    0x81, 0xCC, 0xCE, 0x01, 0x99, 0xC9, 0x09, 0x50, 0x24, 0x88, 0x73, 0x7A, 0x02, 0xCC, 0x08, 0x21,
-    0xD2, 0x53, 0x07, 0x70, 0x62, 0xD1, 0x79, 0x42, 0xF9, 0x4F, 0xF5, 0xF9, 0x15, 0x05, 0x0D, 0xF5,
-    0xDE, 0x57, 0xA0, 0xAC, 0xCE, 0xE6, 0x89, 0xA6, 0x9F, 0x79, 0xA2, 0xC8, 0xCC, 0xCD, 0x07, 0xAF,
-    0x95, 0xEC, 0x2C, 0xB4, 0x8E, 0x0A, 0xFA, 0xDD, 0x63, 0x6B, 0x54, 0xBD, 0xC3, 0xE1, 0xD9, 0x54,
-    0xF0, 0x39, 0x79, 0x99, 0x60, 0x7C, 0xAC, 0xFE, 0x18, 0x13, 0x91, 0x72, 0xBA, 0xD1, 0xFD, 0x1F,
-    0xAB, 0x3D, 0xCA, 0x7C, 0x87, 0xC0, 0xBF, 0x86, 0xD6, 0x8C, 0x7C, 0x3C, 0x59, 0x5A, 0xD0, 0x36,
-    0x6E, 0x04, 0xFC, 0x1F, 0xD3, 0x88, 0xE8, 0xB8, 0xAF, 0x67, 0xD4, 0xE6, 0x55, 0xEB, 0x0A, 0x82,
-    0x02, 0xE2, 0x18, 0xBB, 0xA8, 0x2B, 0x54, 0x30, 0x25, 0xEC, 0x8C, 0x86, 0x47, 0xAD, 0x4A, 0xB3,
-    0x08, 0x29, 0x07, 0x2E, 0x66, 0x28, 0x6C, 0x61, 0xB6, 0xE1, 0xB0, 0x1E, 0xBA, 0xB6, 0xBF, 0x90,
-    0xCA, 0x41, 0x84, 0x18, 0x8A, 0xFD, 0x99, 0xD3, 0xC4, 0x66, 0x53, 0x6B, 0xFE, 0xA8, 0x84, 0x77,
-    0xDC, 0xFF, 0xA1, 0x5C, 0x90, 0x6F, 0x3E, 0x82, 0xAC, 0xD8, 0x4B, 0x63, 0x78, 0xF6, 0xA3, 0x54,
-    0x4D, 0x12, 0x15, 0xAE, 0xA5, 0x36, 0x0E, 0xDF, 0xAC, 0xA5, 0x7E, 0x90, 0x58, 0x17, 0xD6, 0xD2,
-    0x73, 0x41, 0xE2, 0x59, 0x6B, 0xC0, 0xDF, 0x49, 0xCF, 0x5A, 0xBB, 0x14, 0x05, 0x2B, 0xB9, 0xB5,
-    0x56, 0xAB, 0x60, 0x14, 0x5B, 0x6B, 0x85, 0x0A, 0xCC, 0xF8, 0x8F, 0xD4, 0x41, 0x34, 0xFC, 0x76,
-    0x2D, 0x6E, 0x36, 0xED, 0x16, 0x79, 0xDC, 0xC2, 0x4E, 0xAA, 0x3D, 0x6F, 0xA4, 0x26, 0xCC, 0xEE,
-    0xBE, 0x93, 0xBA, 0x31, 0xF0, 0xAC, 0x93, 0xF6, 0x55, 0xE2, 0xC6, 0x0E, 0x98, 0x6D, 0xD4, 0x88,
-    0x82, 0x4D, 0x6C, 0xA0, 0x69, 0x1F, 0x93, 0x5C, 0x3B, 0xA9, 0x9D, 0x27, 0xCA, 0x47, 0xF7, 0x6A,
-    0x35, 0x1C, 0x9E, 0x01, 0x6D, 0xE5, 0xEE, 0x70, 0x29, 0x3E, 0x08, 0x2A, 0x07, 0x28, 0xB6, 0x52,
-    0x82, 0x6C, 0x37, 0xEE, 0x89, 0x67, 0xAB, 0xC2, 0xAC, 0xE6, 0x3E, 0x7E, 0x9E, 0x53, 0x01, 0xA6,
-    0x17, 0xB8, 0xD3, 0xBA, 0x01, 0x69, 0x3A, 0x4A, 0xB5, 0xC8, 0x3D, 0x05, 0xCE, 0x3B, 0x0B, 0x2E,
-    0x6C, 0x70, 0xC1, 0xDB, 0x18, 0x43, 0x29, 0xAE, 0xE4, 0x6A, 0x61, 0xE3, 0x8A, 0x72, 0x3E, 0x86,
-    0xC6, 0xBF, 0xBD, 0x71, 0x31, 0xF5, 0xBD, 0xA4, 0x63, 0x7D, 0xB1, 0x71, 0xBE, 0xE8, 0x79, 0x89,
-    0xEB, 0xBE, 0xBD, 0x91, 0x56, 0x85, 0x97, 0xD8, 0xFF, 0x68, 0x6C, 0xA4, 0x61, 0xE6, 0x25, 0x66,
-    0x8D, 0x13, 0x37, 0xF2, 0x4E, 0x2A, 0x13, 0xFD, 0x06, 0x95, 0x90, 0x48, 0xB6, 0x0E, 0x36, 0x88,
-    0x68, 0x0C, 0x62, 0xFA, 0x6A, 0x97, 0x7B, 0x72, 0x50, 0xF3, 0xD7, 0x20, 0xB4, 0x6B, 0x35, 0xF9,
-    0x45, 0x0D, 0xD6, 0x05, 0x20, 0x36, 0x6E, 0x43, 0xB5, 0xFE, 0x03, 0x34, 0xF3, 0x0D, 0xAD, 0x99,
-    0x27, 0x50, 0xD4, 0xDF, 0x40, 0x03, 0x7E, 0x10, 0x13, 0x7B, 0x59, 0x45, 0x18, 0xE1, 0x1F, 0x28,
-    0xC3, 0xA7, 0x2F, 0x94, 0x64, 0x3E, 0x7C, 0x1F, 0x32, 0x70, 0x65, 0x78, 0x16, 0xFC, 0xD2, 0x43,
-    0x85, 0x8F, 0x78, 0xF8, 0x95, 0x77, 0xCD, 0xBC, 0xD5, 0xD4, 0xCE, 0xE4, 0xF5, 0xDA, 0x4F, 0xCD,
-    0x72, 0x45, 0x59, 0x37, 0x0B, 0xE1, 0x39, 0x6F, 0x1E, 0xD4, 0x93, 0x28, 0xE3, 0x9F, 0x80, 0x7B,
-    0xD0, 0x40, 0x1F, 0xF4, 0x5B, 0x8F, 0x94, 0xFD, 0x87, 0x46, 0x0D, 0x9C, 0x1B, 0x4D, 0xE9, 0x7B,
-    0x0D, 0x60, 0x5E, 0x24, 0x82, 0x2E, 0xD5, 0x5E, 0x95, 0xD6, 0xCC, 0x74, 0x04, 0xF5, 0xFB, 0xEB,
-    0x98, 0xAE, 0xB4, 0xE9, 0x9E, 0x5E, 0x10, 0x52, 0xF3, 0x68, 0x05, 0xCA, 0xED, 0x44, 0x1E, 0x16,
-    0x5C, 0x28, 0x77, 0x80, 0x78, 0x21, 0x97, 0x0B, 0xEA, 0x41, 0x11, 0x09, 0xD2, 0x8D, 0x53, 0xA3,
-    0x61, 0xCC, 0x87, 0x7D, 0x5D, 0xE4, 0xC3, 0x0F, 0x9F, 0x28, 0xF5, 0x9F, 0xD1, 0xD0, 0xCB, 0xB9,
-    0x50, 0x43, 0x45, 0x7F, 0x6A, 0x80, 0xD2, 0x13, 0x54, 0x52, 0xDA, 0x29, 0xD9, 0xC3, 0x4E, 0x4B,
-    0x11, 0x30, 0x3E, 0xA6, 0x9B, 0xE6, 0x14, 0xE6, 0x99, 0x10, 0xCE, 0x6A, 0x65, 0x5A, 0x5F, 0x97,
-    0xE6, 0xC5, 0xEA, 0x68, 0x0D, 0x96, 0x03, 0x94, 0xAB, 0xB6, 0xA0, 0x68, 0xF2, 0xA0, 0xDD, 0x7E,
-    0x20, 0x7D, 0x83, 0x0A, 0xDF, 0x5E, 0x5F, 0x1E, 0xA4, 0x5E, 0xDA, 0x73, 0x80, 0x7C, 0x7B, 0x66,
-    0x49, 0x03, 0x10, 0xE2, 0xB0, 0x47, 0xF0, 0xD7, 0xA3, 0x08, 0x9B, 0xEE, 0xE4, 0x1A, 0x1E, 0x81,
-    0xED, 0x13, 0xF5, 0x28, 0x15, 0x7B, 0x1E, 0xC5, 0x22, 0xE6, 0x71, 0x40, 0x4E, 0x37, 0x96, 0xA3,
-    0x87, 0x54, 0xF9, 0x63, 0x65, 0x9C, 0x86, 0xB0, 0x06, 0x40, 0xAD, 0x8D, 0x0A, 0x52, 0xB2, 0xEC,
-    0x03, 0xB4, 0xE5, 0x20, 0x59, 0x8C, 0x6B, 0xA9, 0x01, 0x35, 0x21, 0x1D, 0xCC, 0xC5, 0x65, 0x0C,
-    0x04, 0x88, 0x3E, 0x14, 0xF8, 0xBA, 0x80, 0xCE, 0x2D, 0x83, 0x3E, 0x63, 0x3A, 0x8B, 0xBF, 0xE5,
-    0x96, 0x41, 0x75, 0x4E, 0x06, 0x1A, 0xD6, 0x04, 0x77, 0x6D, 0xEA, 0x47, 0xCA, 0xFC, 0x8F, 0x14,
-    0x7B, 0xA0, 0x57, 0x7D, 0x80, 0xDD, 0x04, 0x93, 0xC9, 0xBA, 0x0A, 0x7E, 0xF6, 0x56, 0x97, 0x72,
-    0x1A, 0x68, 0xA7, 0xFE, 0x2A, 0xDF, 0xEE, 0x79, 0x97, 0xC3, 0x49, 0x0A, 0xC0, 0x8F, 0x52, 0x80,
-    0xE4, 0x20, 0xA1, 0xBB, 0x67, 0xED, 0x49, 0x4E, 0xC5, 0x25, 0xB4, 0x26, 0xD0, 0x4B, 0xCA, 0x5D,
-    0x94, 0x7B, 0xD9, 0x77, 0xB4, 0xCF, 0x47, 0x5B, 0x7E, 0xA7, 0x46, 0x6D, 0xFA, 0x95, 0x77, 0xD9,
-    0xAB, 0x53, 0x9F, 0x28, 0x61, 0xCA, 0xD9, 0xB3, 0x99, 0xF6, 0xCC, 0x90, 0xB6, 0xC4, 0x53, 0x63,
-    0x03, 0xCF, 0x18, 0xC4, 0x33, 0x0B, 0xDD, 0x51, 0xC4, 0x42, 0x6D, 0x3A, 0x7B, 0x28, 0xCB, 0xFB,
-    0xA0, 0x41, 0x2F, 0xF2, 0x52, 0xBA, 0xED, 0xF1, 0x44, 0x7C, 0x52, 0x89, 0x18, 0x61, 0x07, 0x15,
-    0xFA, 0xB7, 0xFD, 0x64, 0xD4, 0x2C, 0x5A, 0x6B, 0x74, 0xFE, 0x25, 0xC6, 0x08, 0x57, 0x40, 0x67,
-    0x50, 0x8E, 0x87, 0x71, 0x8B, 0x27, 0x3E, 0x4E, 0xF6, 0x17, 0x78, 0xA6, 0xC6, 0x33, 0xEB, 0x1C,
-    0x61, 0xB6, 0xCA, 0xD9, 0xCE, 0x79, 0x4E, 0xB3, 0x0E, 0x8D, 0x52, 0x2C, 0x77, 0x47, 0xBE, 0x30,
-    0xF6, 0x9D, 0x42, 0x86, 0x71, 0x5E, 0xCD, 0x7F, 0xDE, 0x34, 0xE7, 0x41, 0x85, 0xFB, 0xD7, 0xD1,
-    0xFC, 0xD2, 0xFA, 0x70, 0x14, 0x09, 0x73, 0xF4, 0x85, 0x3F, 0x20, 0x6F, 0x1A, 0x62, 0x33, 0x29,
-    0x8C, 0x97, 0x41, 0xA8, 0xC9, 0x5E, 0x35, 0x71, 0x9B, 0x89, 0x41, 0x7B, 0x23, 0xA2, 0xC4, 0x77,
-    0x18, 0x64, 0x18, 0x34, 0x59, 0x62, 0x8C, 0xED, 0x22, 0xC1, 0x53, 0x75, 0x82, 0x1E, 0xF6, 0x13,
-    0xFA, 0x3E, 0x12, 0x82, 0x91, 0x11, 0x74, 0xBF, 0xDE, 0x41, 0xA2, 0x73, 0xC7, 0x1B, 0xB8, 0xDB,
-    0x4F, 0x40, 0x0F, 0x49, 0x62, 0x56, 0x54, 0xF8, 0xA3, 0x06, 0x32, 0xDD, 0x9B, 0xC6, 0xA7, 0x4E,
-    0x0D, 0xE3, 0x51, 0x33, 0xF6, 0xAE, 0x9F, 0xBD, 0x5C, 0xA8, 0x0E, 0xAC, 0x4C, 0x70, 0x78, 0x27,
-    0x54, 0xD6, 0x6F, 0xC7, 0x50, 0x10, 0x18, 0x2C, 0x0F, 0x95, 0x57, 0x16, 0x50, 0x57, 0x07, 0xD0,
-    0xE2, 0x8B, 0x4A, 0xEE, 0x7D, 0x45, 0x47, 0xE2, 0x91, 0x2D, 0x33, 0x85, 0x30, 0x34, 0x9D, 0x9A,
-    0x96, 0xB3, 0x13, 0xF0, 0xC9, 0x58, 0x4D, 0xEC, 0xD2, 0x8F, 0xDC, 0x0B, 0xB9, 0xEA, 0x93, 0x6A,
-    0xBF, 0xEC, 0x2E, 0x60, 0x66, 0x37, 0xEE, 0x0C, 0x87, 0x89, 0x16, 0x4D, 0xA0, 0x50, 0x93, 0x3E,
-    0xB5, 0xCC, 0x48, 0x07, 0x12, 0x62, 0x88, 0xDA, 0x00, 0x88, 0x47, 0x05, 0xDD, 0x57, 0x3F, 0x30,
-    0xD3, 0xA9, 0x6C, 0x78, 0x02, 0x00, 0xC0, 0x3F, 0x86, 0x6D, 0xB8, 0x2D, 0x5D, 0x3F, 0x43, 0x80,
-    0xAC, 0x8E, 0x7F, 0x39, 0xD7, 0x5E, 0xDB, 0xAB, 0xEC, 0x8B, 0x4D, 0x66, 0x5F, 0x69, 0x2A, 0x1B,
-    0x8C, 0x0E, 0xEC, 0xD5, 0xB7, 0x73, 0x15, 0xA0, 0x75, 0x01, 0xBD, 0x4B, 0x0F, 0xDB, 0xEE, 0xE5,
-    0xD3, 0x7F, 0x56, 0x6B, 0x3B, 0x7B, 0x90, 0xD1, 0x37, 0x10, 0x46, 0x20, 0x3C, 0x60, 0xEF, 0xDF,
-    0xE8, 0x86, 0xBC, 0x38, 0xFC, 0x64, 0xD4, 0xDC, 0xBC, 0x33, 0x7C, 0xFF, 0x01, 0x50, 0x6A, 0x7A,
-    0x8A, 0x3E, 0x6B, 0xE1, 0x7E, 0x68, 0x9B, 0x70, 0x17, 0x9C, 0x02, 0x2E, 0xA9, 0x1E, 0x20, 0xDC,
-    0xCD, 0x66, 0xD1, 0x6F, 0xEA, 0x85, 0x43, 0xBF, 0x49, 0xE4, 0xFE, 0xB2, 0x78, 0xDC, 0x69, 0xF6,
-    0x8F, 0x72, 0x65, 0x57, 0x42, 0xA0, 0x40, 0x55, 0x9D, 0xD3, 0xAA, 0x06, 0x93, 0x0C, 0x20, 0xC2,
-    0xE6, 0xD4, 0xDE, 0x24, 0xF9, 0x11, 0x48, 0x2B, 0xD9, 0xF9, 0xB7, 0xF7, 0xF9, 0x9B, 0xDF, 0x5C,
-    0xF9, 0x9F, 0x7F, 0x24, 0x38, 0x83, 0x08, 0x01, 0x60, 0x60, 0xB7, 0x03, 0xE6, 0x2C, 0xC1, 0xBF,
-    0x1F, 0xB5, 0x80, 0x24, 0x79, 0x94, 0x7F, 0x46, 0x35, 0x2A, 0x06, 0x31, 0xD0, 0xC4, 0x69, 0x09,
-    0x83, 0x92, 0x7D, 0xEF, 0x0C, 0xB9, 0x2F, 0x8C, 0xBB, 0xF6, 0x06, 0x30, 0xF1, 0x24, 0xE6, 0xBE,
-    0x29, 0xB1, 0x2F, 0x67, 0x6B, 0xEE, 0xD5, 0x82, 0xC9, 0x7D, 0x60, 0xE6, 0xDC, 0x5B, 0x74, 0x5F,
-    0x2F, 0x00, 0xDD, 0x96, 0x66, 0xDD, 0xC4, 0x7C, 0xB2, 0xA1, 0x04, 0x88, 0x55, 0xDB, 0x24, 0x33,
-    0x16, 0x9F, 0xB8, 0x70, 0x55, 0x8F, 0xEC, 0x69, 0x08, 0x9F, 0x6A, 0x55, 0xC9, 0xCB, 0xD7, 0x87,
-    0x2B, 0x9F, 0x46, 0x3E, 0x85, 0x4E, 0xBE, 0x32, 0x5C, 0xBA, 0xBE, 0x74, 0x93, 0x97, 0x9D, 0xAF,
-    0xF8, 0xB4, 0xBB, 0xC4, 0xA7, 0x03, 0x3E, 0x4D, 0x25, 0xED, 0x45, 0x3E, 0xB4, 0xF6, 0xA0, 0x19,
-    0xFB, 0x9B, 0x35, 0x6C, 0xD1, 0xD6, 0x27, 0x62, 0x3F, 0x1E, 0xFF, 0xF2, 0xC8, 0x76, 0xDA, 0xCA,
-    0x5B, 0xDA, 0x02, 0xB3, 0x82, 0x66, 0xB6, 0x68, 0x2B, 0x7C, 0xD8, 0x26, 0xD1, 0x20, 0x28, 0x13,
-    0x52, 0x35, 0xA6, 0xED, 0xA5, 0x69, 0x5C, 0x6A, 0x36, 0x56, 0x67, 0x04, 0x8E, 0xD9, 0x10, 0x9A,
-    0x95, 0x4C, 0x84, 0x0D, 0xB3, 0xA7, 0x12, 0xE0, 0x06, 0xFC, 0x06, 0x7E, 0x77, 0xD2, 0x05, 0x3D,
-    0x3B, 0x8C, 0x93, 0x60, 0x60, 0x88, 0xF4, 0xDC, 0x94, 0xB1, 0x5C, 0x2F, 0x95, 0x28, 0x34, 0x07,
-    0xC0, 0x9E, 0x72, 0x2B, 0x0A, 0xFC, 0x53, 0xDC, 0x5F, 0x4B, 0x2D, 0x20, 0xC8, 0xC1, 0x5A, 0xEA,
-    0x2E, 0x24, 0xE6, 0xAD, 0xB5, 0xF4, 0x20, 0x84, 0xC6, 0xBB, 0x6B, 0x9F, 0x15, 0x01, 0x00, 0xD9,
-    0xDA, 0x45, 0x48, 0xC2, 0xD2, 0x5A, 0xFB, 0x47, 0x48, 0xC6, 0xD4, 0x5A, 0xAB, 0x70, 0xA0, 0x2B,
-    0x6A, 0x71, 0x0F, 0x20, 0x3E, 0x5E, 0xFD, 0x28, 0x53, 0xDE, 0x78, 0x6A, 0xEF, 0xED, 0x89, 0xD5,
-    0x9E, 0x79, 0x71, 0x2A, 0x4A, 0xB5, 0x6F, 0x97, 0xAA, 0x6F, 0xE5, 0x16, 0x1B, 0x03, 0xF8, 0xDD,
-    0x53, 0x3E, 0x24, 0x56, 0x0F, 0x2C, 0x01, 0x19, 0x64, 0x52, 0x9D, 0x5E, 0x01, 0x70, 0xAE, 0xB5,
-    0x3A, 0x0D, 0xB5, 0x39, 0x49, 0xC2, 0xF6, 0xC5, 0xF6, 0x9C, 0x99, 0x07, 0x4B, 0x90, 0xA1, 0x62,
-    0x99, 0xC6, 0xF7, 0xBF, 0x15, 0xE6, 0x82, 0xAC, 0xF9, 0x9C, 0xF3, 0xE1, 0xE9, 0xEE, 0x7A, 0x53,
-    0xEF, 0x93, 0x8E, 0x7F, 0x98, 0x85, 0xC4, 0x42, 0x1C, 0x08, 0x27, 0x08, 0x49, 0xDF, 0x15, 0x66,
-    0xA6, 0x87, 0x94, 0xF1, 0x86, 0x84, 0xC2, 0xD7, 0x7D, 0xA7, 0xA4, 0x70, 0xE3, 0x7C, 0x91, 0x8D,
-    0xDD, 0x18, 0xD6, 0xA4, 0x9D, 0x86, 0x74, 0x4B, 0x11, 0x16, 0x07, 0x74, 0x0D, 0x54, 0xE8, 0x02,
-    0x3B, 0xE7, 0xBE, 0x99, 0x7A, 0x91, 0x93, 0xF6, 0x78, 0xC3, 0x7D, 0xA7, 0x08, 0xE8, 0xCA, 0x72,
-    0xA3, 0x04, 0x75, 0xF6, 0x7B, 0x46, 0x89, 0x1E, 0xDC, 0xC9, 0xE9, 0xB3, 0x35, 0x9A, 0xC8, 0x86,
-    0x70, 0xB7, 0x80, 0x88, 0x41, 0xDA, 0x20, 0x06, 0x6F, 0x53, 0xC0, 0x51, 0x9B, 0xAA, 0xFF, 0x54,
-    0xD0, 0x44, 0x16, 0xFB, 0xC2, 0xA3, 0xCB, 0x98, 0xDE, 0x5A, 0x17, 0xB3, 0xC7, 0x1A, 0x51, 0x2C,
-    0x0A, 0xEF, 0x58, 0x99, 0x05, 0x3E, 0x70, 0x63, 0x5F, 0x78, 0x6F, 0x03, 0xD6, 0x6D, 0xC7, 0xF9,
-    0xE0, 0x10, 0x6E, 0x1D, 0xF4, 0xD1, 0xC2, 0x9B, 0xF9, 0xC1, 0x1E, 0x11, 0xCA, 0xDF, 0x09, 0xAB,
-    0x8B, 0x1E, 0x31, 0xDB, 0xA8, 0x91, 0xB0, 0x94, 0x0C, 0x6D, 0x23, 0x20, 0x1F, 0x2A, 0xF0, 0xE8,
-    0x7A, 0x57, 0x5F, 0x12, 0xBD, 0x29, 0x0A, 0x14, 0x44, 0xBD, 0xA8, 0xBD, 0x01, 0xDE, 0x87, 0xF3,
-    0x10, 0x86, 0x68, 0x24, 0x25, 0x58, 0x2A, 0xB1, 0x24, 0x89, 0x2A, 0x41, 0x92, 0x93, 0xF5, 0xBC,
-    0xD8, 0xCE, 0x7F, 0x88, 0xC1, 0xA5, 0xC1, 0x34, 0x80, 0x69, 0x2F, 0x63, 0xDB, 0xD3, 0x7E, 0x3E,
-    0x63, 0xE9, 0xFA, 0x69, 0xD4, 0x50, 0xAB, 0x17, 0x57, 0x86, 0xDA, 0x8E, 0x25, 0xAD, 0xC9, 0x13,
-    0xA2, 0xA4, 0xC1, 0x38, 0x36, 0x3D, 0x09, 0x85, 0xF2, 0x81, 0x92, 0xAC, 0x02, 0x4F, 0x24, 0xA4,
-    0x78, 0x14, 0x3B, 0xA0, 0xF7, 0x20, 0xF6, 0x60, 0x7E, 0xEA, 0x61, 0x71, 0x29, 0xCF, 0xD6, 0xC5,
-    0x78, 0x6F, 0x0A, 0x34, 0x64, 0x7D, 0xA6, 0xA4, 0x5B, 0x84, 0x37, 0x68, 0x27, 0x5B, 0x99, 0xF8,
-    0x20, 0x4A, 0xF1, 0x42, 0x74, 0xA4, 0x74, 0x9A, 0x78, 0x92, 0xEC, 0xC0, 0xB9, 0xD7, 0x40, 0x22,
-    0xE8, 0x8E, 0xBB, 0xDD, 0xE9, 0x0D, 0xFA, 0x1B, 0xF0, 0x86, 0xA1, 0xDF, 0x10, 0xDF, 0x46, 0xC4,
-    0x02, 0x51, 0xC7, 0x44, 0x8A, 0xF2, 0x4A, 0xF5, 0x56, 0x87, 0x03, 0xC1, 0x30, 0xB8, 0xA3, 0x5D,
-    0x4C, 0xA0, 0xEC, 0x93, 0xCA, 0x18, 0xFD, 0x87, 0x02, 0x7D, 0xFD, 0x2A, 0xB5, 0xD7, 0x8F, 0x13,
-    0xED, 0x89, 0x03, 0x96, 0x5C, 0x86, 0x51, 0x0E, 0x65, 0x5C, 0x9B, 0x82, 0xD0, 0xE5, 0x3C, 0xA6,
-    0xA7, 0xBD, 0x44, 0x61, 0x4B, 0x74, 0x6C, 0x16, 0x26, 0x94, 0x4E, 0x0A, 0xE1, 0x3D, 0x8F, 0x92,
-    0xEB, 0xD6, 0x07, 0xDA, 0x97, 0x24, 0x10, 0x19, 0x75, 0x06, 0xD9, 0x6E, 0xC4, 0xAD, 0xD1, 0x4B,
-    0x8F, 0x8D, 0x72, 0xDF, 0x25, 0xD1, 0x1E, 0xA2, 0x93, 0x5F, 0xC4, 0x3C, 0xDF, 0x12, 0x1F, 0x3C,
-    0xF0, 0x2F, 0xC6, 0xB2, 0x47, 0x53, 0xBF, 0xC7, 0x89, 0xE9, 0x39, 0xE0, 0xF7, 0x1E, 0x43, 0x1E,
-    0x3D, 0xB3, 0xF0, 0x01, 0x78, 0xCB, 0x90, 0xD0, 0x97, 0xF8, 0xB7, 0x5F, 0x63, 0x17, 0xA8, 0x59,
-    0x48, 0x59, 0x6B, 0xDC, 0x46, 0x5D, 0x13, 0x14, 0xDB, 0xA1, 0xF7, 0x55, 0xA2, 0xAC, 0x15, 0x27,
-    0x9B, 0x4A, 0x05, 0x34, 0x57, 0xC1, 0xE8, 0xEB, 0x78, 0x2A, 0x70, 0x0F, 0xE7, 0x50, 0xC0, 0x10,
-    0x23, 0x25, 0x0C, 0xE3, 0x8E, 0x79, 0x13, 0xA6, 0x72, 0xBF, 0xA3, 0xF1, 0x09, 0xF4, 0x4F, 0x2D,
-    0xE4, 0x04, 0x95, 0xC2, 0x49, 0xB9, 0x21, 0x3F, 0xD6, 0x19, 0x95, 0x05, 0xC5, 0xC6, 0x8C, 0xD3,
-    0x90, 0x79, 0x32, 0xD2, 0xA9, 0xEA, 0xC8, 0x20, 0xC8, 0x4C, 0x94, 0x12, 0x30, 0x68, 0x62, 0x6B,
-    0xF5, 0xD8, 0xED, 0xF5, 0x84, 0x33, 0x85, 0x4A, 0x18, 0xD5, 0x43, 0x5B, 0x3B, 0x30, 0xB5, 0x0F,
-    0xC1, 0x24, 0xF7, 0x69, 0x6B, 0x77, 0xC0, 0x4B, 0x51, 0x62, 0x65, 0x34, 0xD2, 0xF3, 0x8E, 0x04,
-    0xEF, 0xAC, 0x0C, 0xD6, 0x85, 0x51, 0x76, 0x7C, 0xF1, 0xC1, 0x41, 0x0C, 0x9C, 0x66, 0x58, 0x78,
-    0x4C, 0x61, 0xBE, 0x91, 0xD2, 0x1B, 0x5E, 0x92, 0x2F, 0x0E, 0x90, 0x3E, 0xED, 0x94, 0x52, 0xA6,
-    0x32, 0x65, 0xD6, 0x39, 0x15, 0x28, 0xB4, 0xAA, 0x80, 0x7D, 0x92, 0xC0, 0x33, 0x8B, 0xC0, 0x7D,
-    0x37, 0x4F, 0xBC, 0xC3, 0x79, 0x0F, 0xDC, 0x5E, 0xB9, 0xEF, 0xC3, 0x36, 0x36, 0x6F, 0xA2, 0x73,
-    0x71, 0xC7, 0x21, 0xAD, 0x48, 0x3B, 0xD5, 0x60, 0x08, 0xCB, 0x16, 0x25, 0x83, 0xF1, 0x29, 0x32,
-    0x15, 0x65, 0x29, 0x84, 0x12, 0x99, 0xC4, 0x7B, 0x8F, 0x48, 0x73, 0x23, 0x17, 0xE7, 0x11, 0x29,
-    0x03, 0x33, 0x62, 0x97, 0x89, 0x1F, 0x5B, 0x85, 0x4F, 0x6D, 0xE4, 0xA4, 0x81, 0x16, 0xBA, 0x21,
-    0x09, 0x03, 0x8A, 0x42, 0x05, 0x9C, 0x19, 0xF7, 0x42, 0x41, 0x2F, 0x35, 0x13, 0x44, 0x3A, 0xCC,
-    0x10, 0x72, 0xD3, 0x3D, 0xC3, 0xE1, 0x10, 0x46, 0x25, 0xE6, 0x72, 0xA1, 0x7B, 0xAC, 0xD0, 0xB9,
-    0x0F, 0x3D, 0x81, 0x8E, 0x64, 0x95, 0x65, 0xDA, 0x16, 0xD0, 0xE4, 0xE6, 0x84, 0x81, 0xEF, 0x77,
-    0x73, 0x4C, 0x0A, 0x64, 0xA8, 0x95, 0x05, 0x34, 0xB3, 0x61, 0x5E, 0x57, 0x98, 0xE9, 0xD7, 0x33,
-    0x08, 0x00, 0x86, 0x03, 0x7A, 0x1D, 0x21, 0xF1, 0x58, 0xD2, 0x3D, 0x26, 0x56, 0xE6, 0x5E, 0x1F,
-    0x9E, 0x2D, 0xC5, 0x55, 0xC9, 0x30, 0x1C, 0x26, 0xA4, 0x22, 0x41, 0xC7, 0x6E, 0x2A, 0xA9, 0x32,
-    0x0C, 0xAE, 0x8A, 0xE5, 0xC6, 0x09, 0x5C, 0x56, 0x4A, 0x7B, 0x50, 0x75, 0xA6, 0x48, 0xE4, 0x7E,
-    0x78, 0xE2, 0x5A, 0x35, 0xC0, 0x5B, 0x7D, 0xC6, 0x14, 0x4A, 0x13, 0x03, 0xD3, 0x47, 0x81, 0x71,
-    0x80, 0xE9, 0x89, 0xFA, 0x90, 0x74, 0x45, 0x87, 0x2E, 0x7A, 0x18, 0x78, 0x0C, 0x3E, 0xB8, 0xEF,
-    0x62, 0x8A, 0x98, 0x97, 0xF5, 0x1A, 0x83, 0xB5, 0x3D, 0xCC, 0x14, 0xA4, 0x55, 0x79, 0x92, 0x5D,
-    0x7B, 0xAD, 0x60, 0xDF, 0x30, 0x0C, 0xE8, 0x1C, 0xBD, 0x2D, 0x1E, 0x85, 0x06, 0x54, 0x33, 0x7A,
-    0x4A, 0x19, 0xC9, 0x0E, 0xFA, 0xE2, 0x3E, 0xE7, 0x04, 0x8D, 0x51, 0xCF, 0x3B, 0x79, 0x8D, 0x19,
-    0x72, 0xE2, 0xD2, 0xB7, 0xF2, 0x03, 0xD0, 0x19, 0x5E, 0x74, 0xCE, 0x3E, 0x5F, 0x24, 0x66, 0xCE,
-    0x39, 0x72, 0xD0, 0x51, 0x4F, 0x1D, 0x50, 0x1D, 0x33, 0x83, 0xBC, 0xAC, 0xFC, 0x9C, 0xA6, 0x8F,
-    0x72, 0x31, 0x5A, 0xA3, 0x89, 0xF8, 0x5F, 0xFD, 0x45, 0xA7, 0xFC, 0x9E, 0x8E, 0xD3, 0x24, 0xED,
-    0x56, 0x6B, 0x5C, 0xB9, 0x3F, 0x37, 0x19, 0x0D, 0x93, 0x40, 0x2D, 0xF0, 0xA3, 0x76, 0x66, 0x2E,
-    0xB7, 0x7C, 0xD7, 0x69, 0x8F, 0x78, 0xD6, 0x29, 0x0D, 0xA0, 0x61, 0x60, 0x6C, 0x15, 0xFE, 0x7A,
-    0x0B, 0xCB, 0x85, 0xD7, 0x97, 0xAE, 0x89, 0xBF, 0x73, 0x38, 0xFC, 0xAF, 0x4A, 0x62, 0x26, 0x33,
-    0x66, 0xEE, 0x65, 0xBE, 0xB7, 0x68, 0x35, 0xD1, 0x6C, 0x93, 0xD1, 0xF9, 0xB3, 0xDA, 0x3A, 0x7F,
-    0x5C, 0xB1, 0xBB, 0xF7, 0xE7, 0xF4, 0xF1, 0x13, 0xA7, 0x53, 0xC4, 0xD4, 0xA2, 0xC4, 0x30, 0x13,
-    0x4E, 0x3E, 0x2F, 0xCE, 0x9F, 0x85, 0xA8, 0xB5, 0x12, 0x98, 0x18, 0xE7, 0x09, 0x78, 0x78, 0x9E,
-    0x4C, 0xDA, 0xEB, 0xA3, 0x88, 0xFE, 0xC3, 0x77, 0xBD, 0x00, 0xBB, 0x84, 0x56, 0x4C, 0xED, 0x45,
-    0x7D, 0x06, 0x5A, 0xFA, 0x4E, 0xC1, 0xC9, 0x6B, 0x63, 0x73, 0x33, 0x2B, 0x53, 0x21, 0xBE, 0xEB,
-    0x6E, 0x1A, 0xE6, 0x11, 0x31, 0x7C, 0xF7, 0xC9, 0x6C, 0xEC, 0x01, 0xFE, 0x19, 0x05, 0x14, 0xA7,
-    0xA7, 0x3A, 0x38, 0x81, 0xCD, 0x03, 0x49, 0xC0, 0x93, 0x0D, 0x9C, 0xF8, 0x38, 0x31, 0xA7, 0x27,
-    0xFA, 0x56, 0x1F, 0x0F, 0x5F, 0x86, 0xE4, 0xAE, 0xBD, 0x2F, 0x8A, 0x91, 0x56, 0x27, 0xA3, 0xA6,
-    0xC5, 0xDF, 0xBB, 0x56, 0xD1, 0x46, 0x80, 0x74, 0xA4, 0xB2, 0x94, 0x40, 0x53, 0x64, 0x4E, 0xA2,
-    0xF9, 0x0C, 0x72, 0xDC, 0x2E, 0x18, 0x57, 0xAF, 0x00, 0x76, 0xE8, 0xC6, 0x6C, 0x63, 0x91, 0x81,
-    0xCC, 0x82, 0xC8, 0x0D, 0xBD, 0x03, 0x6D, 0x8D, 0xF4, 0x35, 0xDE, 0xE5, 0x73, 0x0B, 0xD4, 0x5B,
-    0x89, 0x04, 0xFB, 0x51, 0x8A, 0x55, 0x98, 0x13, 0xE5, 0x67, 0x6C, 0x0C, 0xD9, 0xB3, 0xD2, 0x91,
-    0x4A, 0xE5, 0x97, 0x92, 0xCA, 0xE6, 0x5C, 0x3B, 0xC1, 0x90, 0x51, 0x81, 0x97, 0xCB, 0xA0, 0x75,
-    0x9F, 0xA2, 0x0D, 0x35, 0xB7, 0x6D, 0x6E, 0xD4, 0xCA, 0x8B, 0x40, 0x92, 0x99, 0x93, 0x6F, 0x77,
-    0xA1, 0x9E, 0x63, 0x20, 0x8A, 0xF1, 0xB5, 0xB1, 0x38, 0x76, 0x45, 0xB2, 0xA3, 0xEA, 0x50, 0x89,
-    0xC8, 0x73, 0x52, 0x9D, 0x6C, 0x51, 0x13, 0xAA, 0x51, 0x23, 0xA0, 0xB7, 0x46, 0x49, 0xC5, 0x54,
-    0x13, 0xBB, 0x51, 0xB5, 0x51, 0x14, 0x28, 0x66, 0x31, 0x62, 0x14, 0x38, 0x0C, 0xEE, 0x3C, 0x77,
-    0x54, 0x2D, 0x36, 0xE5, 0xB2, 0x45, 0xEA, 0x85, 0x86, 0xA0, 0x83, 0xE5, 0xCF, 0x13, 0x65, 0x4C,
-    0x98, 0x6F, 0x02, 0xD1, 0x89, 0x81, 0x16, 0xD8, 0x04, 0x89, 0x44, 0xC7, 0xA9, 0x8F, 0x0A, 0x02,
-    0xC9, 0x3C, 0x51, 0x25, 0xC1, 0x3D, 0xA3, 0xF0, 0x8C, 0x9B, 0xA2, 0x26, 0x46, 0xB1, 0x01, 0xA1,
-    0x8C, 0x68, 0x8E, 0xCE, 0x16, 0x49, 0x87, 0x21, 0x85, 0xF7, 0x58, 0xD9, 0x4B, 0x36, 0xAA, 0x35,
-    0xDA, 0xA4, 0xA6, 0x67, 0xD7, 0x97, 0x7D, 0x33, 0x20, 0xF8, 0xD7, 0x33, 0xE5, 0x9E, 0xA7, 0x7A,
-    0xC0, 0x85, 0xE2, 0x20, 0x28, 0x5E, 0xDB, 0x87, 0x4F, 0xDA, 0xCF, 0xAD, 0xBF, 0xF9, 0x26, 0x6A,
-    0x69, 0xAA, 0xD1, 0x58, 0xAA, 0x59, 0x1C, 0xC8, 0x89, 0x53, 0xB4, 0xE8, 0x2A, 0xD4, 0x44, 0x29,
-    0x00, 0x28, 0xD8, 0x13, 0xA9, 0x3D, 0x42, 0x2F, 0xA1, 0x0E, 0x76, 0x9B, 0x25, 0xF3, 0x07, 0x04,
-    0x74, 0x56, 0x3A, 0xA1, 0xC8, 0x7B, 0x8D, 0x10, 0x1A, 0x9D, 0x5B, 0xB0, 0x33, 0x36, 0x03, 0xEF,
-    0xB9, 0x68, 0x9F, 0x3C, 0x02, 0x72, 0xE7, 0x50, 0xF8, 0x11, 0x4C, 0x0E, 0x96, 0x92, 0x50, 0x64,
-    0xFB, 0x91, 0x20, 0xA2, 0x4A, 0x57, 0x44, 0xAF, 0xCC, 0x0A, 0x73, 0x44, 0xEC, 0x2B, 0x68, 0x4B,
-    0xE4, 0x43, 0x85, 0x54, 0x3A, 0xAE, 0xA4, 0x70, 0x0E, 0xAA, 0x8F, 0x75, 0xA8, 0x44, 0xB0, 0xF2,
-    0x34, 0x7F, 0xD3, 0x99, 0xC2, 0xC0, 0x36, 0x66, 0xA5, 0xD3, 0xA6, 0x54, 0x1B, 0x7A, 0x96, 0x4E,
-    0xD4, 0xED, 0x05, 0xE9, 0x2E, 0x48, 0x1A, 0x23, 0xF8, 0x89, 0xD3, 0x8C, 0x25, 0x04, 0x3C, 0x3A,
-    0x3A, 0xB6, 0x98, 0x6D, 0x9A, 0xD3, 0x57, 0x2B, 0x5E, 0x4D, 0xE8, 0x00, 0x76, 0x88, 0xD4, 0xCE,
-    0xE0, 0x30, 0xF0, 0x01, 0x09, 0x9B, 0x99, 0x88, 0x76, 0x4A, 0x62, 0x37, 0x8B, 0x50, 0xB0, 0x8B,
-    0x95, 0x95, 0x4C, 0x05, 0x4C, 0xDD, 0xF7, 0x52, 0x41, 0xC0, 0x1E, 0xFE, 0xD3, 0xDB, 0xD8, 0x81,
-    0xC2, 0x8E, 0x50, 0xF7, 0x88, 0x99, 0x1B, 0x68, 0xFF, 0x44, 0x3B, 0x5B, 0xD8, 0x79, 0x36, 0x7C,
-    0x9A, 0x72, 0xD0, 0xD9, 0xD9, 0x5A, 0x57, 0x37, 0xD6, 0xD0, 0x6D, 0x35, 0x1B, 0x3D, 0x4F, 0xAD,
-    0x8B, 0x4F, 0x1C, 0xD6, 0x42, 0x1C, 0x0C, 0x38, 0x51, 0xEB, 0xD4, 0xC0, 0x3D, 0xA3, 0x2B, 0x05,
-    0x6A, 0x3A, 0xED, 0xA5, 0x4C, 0x19, 0x5D, 0xA0, 0x84, 0x26, 0x86, 0x61, 0x24, 0x47, 0x82, 0xEF,
-    0x1C, 0x0F, 0x42, 0xF4, 0x36, 0x6F, 0x61, 0xC7, 0xA9, 0x3C, 0x20, 0x39, 0x40, 0x6F, 0xF3, 0x35,
-    0xC9, 0xF9, 0x19, 0x00, 0x40, 0xCE, 0x79, 0xA9, 0x31, 0x19, 0x7C, 0x55, 0x12, 0xD9, 0xD4, 0x74,
-    0x07, 0x6D, 0x52, 0x25, 0x21, 0x76, 0xFB, 0x47, 0x0E, 0x19, 0x49, 0xEA, 0x65, 0xEC, 0x6C, 0x6C,
-    0x54, 0x76, 0xBE, 0xD7, 0x7F, 0x8D, 0x12, 0x04, 0x25, 0xF5, 0x29, 0xD0, 0x4F, 0x44, 0xE2, 0x66,
-    0x53, 0xEB, 0xA5, 0x16, 0x44, 0xDE, 0x9B, 0x10, 0xE4, 0x9F, 0x71, 0xB0, 0xFD, 0x0F, 0x7E, 0x57,
-    0xD0, 0xB5, 0x03, 0x25, 0xAD, 0x13, 0x60, 0xD5, 0x6C, 0xB4, 0x45, 0x8E, 0xEE, 0xBA, 0x9E, 0x2E,
-    0x1D, 0x5B, 0x3B, 0x38, 0x2B, 0x41, 0xE2, 0xBD, 0xE7, 0x34, 0xD5, 0x2F, 0xEB, 0x67, 0x5E, 0xD5,
-    0x87, 0x9F, 0xE9, 0xC3, 0x76, 0x62, 0xF6, 0xC7, 0x6A, 0x40, 0xEF, 0x38, 0x13, 0x87, 0x94, 0x55,
-    0x39, 0x2A, 0xF7, 0x53, 0x81, 0xAB, 0x76, 0x2E, 0x63, 0xAB, 0xC7, 0x86, 0xA9, 0x6E, 0xF2, 0x78,
-    0xA5, 0xC9, 0x25, 0x69, 0x0F, 0x9D, 0x1D, 0x87, 0x80, 0x1E, 0x43, 0x39, 0xF4, 0x35, 0xA9, 0xF7,
-    0x35, 0xD5, 0xF7, 0x45, 0xC6, 0xE1, 0x40, 0xBA, 0x16, 0x34, 0x0F, 0xF4, 0xDB, 0x87, 0x96, 0xB2,
-    0xC6, 0x66, 0x13, 0x83, 0x77, 0x5A, 0xE7, 0x9B, 0xDF, 0xBC, 0x26, 0x22, 0x74, 0x4E, 0xCF, 0xDC,
-    0x29, 0x61, 0x21, 0xCE, 0x9C, 0xB2, 0xBE, 0x18, 0x11, 0x2F, 0x9F, 0xFF, 0xC5, 0xE9, 0x36, 0x4A,
-    0x88, 0x86, 0xE5, 0xD2, 0x2E, 0x39, 0x77, 0x22, 0xB5, 0x33, 0xC5, 0x60, 0x90, 0x89, 0x3B, 0xA8,
-    0x70, 0x9A, 0xCC, 0xFD, 0xFD, 0x69, 0xF3, 0xF5, 0x42, 0xAC, 0x0D, 0xC9, 0x46, 0x69, 0xDB, 0xDE,
-    0x91, 0x36, 0x07, 0xFD, 0x76, 0x6F, 0x65, 0xD3, 0x7D, 0x20, 0x58, 0x32, 0xE4, 0x7E, 0xD9, 0xA7,
-    0x41, 0x54, 0xBB, 0x99, 0x57, 0x59, 0xA5, 0x4D, 0x27, 0x61, 0xAE, 0x46, 0x95, 0xA7, 0xFD, 0xF2,
-    0x73, 0x3A, 0xDD, 0x9C, 0x8D, 0x5B, 0xBB, 0x43, 0xC2, 0x98, 0xB5, 0x8C, 0x58, 0xED, 0xFC, 0x2B,
-    0xA7, 0xF6, 0x1E, 0x19, 0x41, 0xF2, 0x83, 0x64, 0x58, 0x2A, 0x91, 0x97, 0xB4, 0xF7, 0xCE, 0x17,
-    0x62, 0xEF, 0x31, 0xA6, 0xA7, 0xC7, 0x68, 0xAC, 0xE8, 0xDF, 0x86, 0x21, 0x05, 0xBE, 0x67, 0x02,
-    0x02, 0xD8, 0x06, 0x90, 0xD3, 0x02, 0x0A, 0x72, 0x2E, 0x11, 0x03, 0xA5, 0x1D, 0x6A, 0x63, 0xDF,
-    0x28, 0x78, 0x03, 0x52, 0xB1, 0x42, 0xA9, 0x0C, 0x5E, 0xF6, 0x94, 0x71, 0x9B, 0xDA, 0x11, 0x8D,
-    0x89, 0x99, 0xAE, 0x03, 0xB9, 0xE8, 0xD5, 0x02, 0x5A, 0x98, 0xFB, 0x08, 0x2D, 0x37, 0xD8, 0x6A,
-    0xD5, 0x8B, 0xC3, 0x61, 0x2C, 0xCA, 0x90, 0xA4, 0xF0, 0x97, 0x3F, 0xDD, 0xDE, 0x60, 0xE3, 0x34,
-    0x7D, 0xBE, 0xEF, 0x31, 0x70, 0xE6, 0xD1, 0x45, 0x4A, 0xB4, 0xE7, 0xC6, 0x84, 0x92, 0xA1, 0x90,
-    0x7F, 0xC2, 0x3A, 0x51, 0x33, 0x01, 0x5F, 0x66, 0x03, 0x7D, 0x8E, 0xE8, 0x0B, 0xB0, 0x6E, 0xE0,
-    0xF9, 0xF2, 0x40, 0x87, 0xFE, 0xF8, 0x02, 0xC3, 0x6B, 0x7F, 0x1E, 0x7F, 0x8D, 0x8E, 0xD5, 0x34,
-    0x2F, 0xBC, 0xDC, 0x12, 0x58, 0xE2, 0x64, 0x5B, 0x79, 0x31, 0x16, 0x03, 0xC6, 0x93, 0x43, 0x89,
-    0x55, 0x69, 0xB1, 0x2D, 0x48, 0x6A, 0xF9, 0x91, 0xF2, 0x62, 0xBC, 0xE9, 0x8F, 0x01, 0x26, 0xD4,
-    0x21, 0x69, 0x30, 0xC6, 0x65, 0x36, 0x53, 0x6F, 0x2C, 0x43, 0xD2, 0x56, 0xD6, 0xCA, 0xB9, 0xCE,
-    0xB6, 0x0B, 0x3A, 0x6C, 0x31, 0xFA, 0xF0, 0x6F, 0xB5, 0x67, 0x0B, 0x85, 0x62, 0x6A, 0x28, 0x9F,
-    0x75, 0x20, 0xCD, 0x6A, 0xE1, 0x13, 0xCE, 0x4A, 0x03, 0x63, 0x03, 0xBB, 0xA9, 0x10, 0xA9, 0x12,
-    0x8A, 0xE8, 0x11, 0x6D, 0x34, 0xFD, 0xA1, 0xA6, 0x84, 0x87, 0x97, 0x7E, 0xE6, 0x60, 0x68, 0xDF,
-    0xD4, 0x39, 0x2E, 0x4C, 0x4B, 0x57, 0x68, 0x8D, 0x71, 0x13, 0x93, 0x9B, 0xFE, 0xAC, 0x83, 0x5B,
-    0xE1, 0xC7, 0x4C, 0xF2, 0x62, 0x2B, 0x23, 0xC9, 0xC8, 0xA0, 0x5D, 0x6D, 0xA5, 0x2F, 0x48, 0x96,
-    0xB1, 0xBD, 0x39, 0xEA, 0x3F, 0xDB, 0xD7, 0x05, 0x26, 0xA8, 0x7B, 0x1A, 0x3C, 0x40, 0xDA, 0x0D,
-    0xCA, 0x70, 0x92, 0x0C, 0xA2, 0x9F, 0x50, 0x7E, 0xB8, 0x17, 0xB2, 0xBF, 0x05, 0x7D, 0xBF, 0xBC,
-    0xFC, 0x93, 0x57, 0x01, 0x9A, 0x16, 0xC1, 0xE7, 0x51, 0xDF, 0x1B, 0xFF, 0x6B, 0xC9, 0x70, 0x35,
-    0xAF, 0x4D, 0x45, 0x74, 0xDE, 0xF2, 0x79, 0x5B, 0xA8, 0x11, 0xFD, 0xC9, 0xF6, 0x69, 0x95, 0x41,
-    0xA6, 0x23, 0x8E, 0x81, 0x6D, 0x03, 0x0F, 0xFF, 0xB1, 0x15, 0xE9, 0x87, 0xA3, 0xE7, 0xA9, 0xA7,
-    0x9F, 0x57, 0x0F, 0xFF, 0xFB, 0x53, 0xED, 0x65, 0x5D, 0x0C, 0x2B, 0xBD, 0x22, 0xE2, 0xBD, 0xA3,
-    0x32, 0xA3, 0xFF, 0xE6, 0xCF, 0xDF, 0xFA, 0xBE, 0xDC, 0x50, 0x8B, 0xEA, 0xD1, 0xFF, 0x44, 0x5F,
-    0x0E, 0x62, 0xC9, 0x4E, 0x81, 0x54, 0x53, 0x46, 0x0A, 0x32, 0x34, 0xE3, 0xBF, 0x9C, 0x92, 0xA1,
-    0xDA, 0x4A, 0x89, 0xC6, 0xD8, 0xB5, 0xA4, 0xF3, 0xD2, 0x52, 0xDB, 0x9B, 0xF8, 0xA7, 0x77, 0x97,
-    0xD7, 0x0A, 0x36, 0x65, 0xC7, 0x9B, 0x9C, 0xD7, 0x0A, 0x47, 0xD9, 0x7F, 0x7F, 0xEA, 0x87, 0x29,
-    0x38, 0x85, 0x2F, 0xE8, 0x2C, 0x6F, 0x51, 0xEA, 0x24, 0x11, 0xE6, 0x5C, 0x52, 0x9F, 0xC8, 0x28,
-    0xFD, 0x00, 0xDB, 0xF7, 0xB6, 0xD7, 0x7E, 0xBF, 0xBF, 0x97, 0x75, 0x5B, 0x40, 0xCC, 0x52, 0x67,
-    0xB8, 0xE8, 0xD4, 0x7A, 0x60, 0xD2, 0x59, 0x4D, 0x22, 0x7F, 0xF6, 0xA8, 0x83, 0xC1, 0xD1, 0x37,
-    0x29, 0xC5, 0xA6, 0x33, 0x55, 0xB5, 0x4A, 0x97, 0xC8, 0x67, 0x40, 0x28, 0x78, 0x80, 0x15, 0x91,
-    0x66, 0xA7, 0xBD, 0x98, 0xDD, 0xC4, 0xD6, 0x5B, 0x42, 0x70, 0x4B, 0xCC, 0x4F, 0xFF, 0x68, 0x27,
-    0x49, 0x26, 0xA3, 0xE4, 0x12, 0x90, 0x55, 0xF8, 0xF0, 0xAF, 0xA6, 0x09, 0x12, 0x29, 0x99, 0x8E,
-    0xC6, 0x3E, 0xF3, 0x97, 0xC2, 0x9C, 0x86, 0x5A, 0x05, 0x92, 0x76, 0xFF, 0x06, 0x17, 0xDD, 0xCF,
-    0x71, 0xD1, 0xB9, 0x9C, 0xD3, 0x25, 0x54, 0xD1, 0xE5, 0x11, 0xC0, 0x3E, 0x83, 0x19, 0x06, 0xCB,
-    0x99, 0x49, 0xB1, 0x35, 0x7D, 0xF3, 0xCB, 0x8C, 0xC6, 0x06, 0x68, 0xD6, 0xC1, 0x90, 0xE9, 0x8F,
-    0xE0, 0x9D, 0xCA, 0xBA, 0x42, 0x21, 0xC7, 0x18, 0x55, 0x4C, 0x73, 0x7D, 0xD5, 0x05, 0x5D, 0x36,
-    0x54, 0x9B, 0x61, 0xD1, 0x02, 0xC1, 0x56, 0x83, 0x4B, 0xD3, 0x85, 0x97, 0x6C, 0x92, 0x6E, 0xBB,
-    0xE6, 0xC3, 0xCC, 0x25, 0x50, 0x0F, 0xA3, 0xF1, 0xFF, 0x40, 0xB0, 0x52, 0xB8, 0xB6, 0x37, 0x20,
-    0x97, 0xF6, 0xC4, 0x09, 0xCC, 0x26, 0x1F, 0x92, 0xCD, 0x49, 0xAD, 0x1B, 0xAF, 0x15, 0xE6, 0xAD,
-    0x2C, 0x51, 0x25, 0x2E, 0x54, 0x1D, 0x60, 0x0D, 0x18, 0x85, 0xB0, 0xFF, 0x13, 0x18, 0xF4, 0x30,
-    0xDD, 0x3A, 0xCE, 0xA5, 0xC8, 0x7D, 0x0D, 0x62, 0x33, 0x03, 0x98, 0x28, 0x61, 0xBF, 0x85, 0x1B,
-    0x85, 0x60, 0x22, 0x2D, 0x11, 0x5A, 0xF4, 0x23, 0x42, 0x46, 0xE7, 0x16, 0x6E, 0x4A, 0x8C, 0x05,
-    0x71, 0x47, 0xD1, 0xBD, 0x54, 0xDC, 0x2B, 0x42, 0x14, 0x1D, 0x55, 0xA1, 0xD8, 0xAD, 0xC7, 0x61,
-    0x1D, 0x43, 0xA4, 0x96, 0x4C, 0x0D, 0x16, 0xE8, 0x03, 0x13, 0x36, 0x63, 0x16, 0x30, 0x00, 0x60,
-    0x60, 0xCC, 0x67, 0xAE, 0xA4, 0x93, 0xB6, 0x1E, 0x25, 0x56, 0x36, 0xDD, 0x96, 0xAE, 0x2F, 0x8A,
-    0xC4, 0xDA, 0xFF, 0x65, 0xB4, 0xE3, 0xFA, 0x8E, 0x2D, 0x13, 0x6C, 0x49, 0x73, 0x8F, 0xE0, 0x6A,
-    0x99, 0x51, 0x16, 0x87, 0x19, 0x22, 0x72, 0x34, 0x98, 0xDE, 0x51, 0x3A, 0x92, 0x89, 0x78, 0x46,
-    0xA7, 0x2D, 0x1E, 0xDF, 0x25, 0xBD, 0xBC, 0xD7, 0xB1, 0x2F, 0x14, 0xA5, 0xBB, 0xF4, 0xEE, 0xEA,
-    0x7C, 0xAD, 0xD3, 0x16, 0x47, 0x4A, 0xFC, 0xD6, 0xEA, 0xA7, 0xF7, 0x49, 0x5B, 0xDC, 0x0C, 0x18,
-    0xFF, 0x62, 0x33, 0x60, 0x5C, 0xDE, 0x27, 0x60, 0xFC, 0x9B, 0x7A, 0x64, 0x7C, 0xF3, 0x87, 0xC6,
-    0x6C, 0xDA, 0x80, 0x71, 0x9A, 0x18, 0x6F, 0x50, 0x95, 0xED, 0x1A, 0x30, 0x9E, 0xC2, 0xB5, 0x36,
-    0x4A, 0x75, 0x49, 0x92, 0x4D, 0xEB, 0x3B, 0xC3, 0x4F, 0x1F, 0x33, 0x19, 0xDD, 0x6D, 0x39, 0x13,
-    0xDC, 0xE1, 0xD1, 0xFF, 0x67, 0x7C, 0x3D, 0x5C, 0xFA, 0xBC, 0x69, 0xFC, 0xEE, 0x91, 0x87, 0xE6,
-    0x8C, 0x24, 0x02, 0x02, 0x99, 0xC6, 0x59, 0x04, 0xC3, 0x61, 0xB4, 0x7B, 0x56, 0xD3, 0xFC, 0x87,
-    0x73, 0xB6, 0x04, 0xA0, 0x9A, 0xE8, 0x01, 0x49, 0x9E, 0xED, 0xCF, 0xD9, 0xE1, 0x10, 0xC8, 0x2C,
-    0x5D, 0x19, 0x9E, 0xDE, 0x1E, 0x8E, 0x63, 0x9E, 0x26, 0xEA, 0xD8, 0xD6, 0xEB, 0xED, 0x81, 0xBA,
-    0x50, 0x32, 0xA1, 0x9A, 0x94, 0x4D, 0xE8, 0xB4, 0x34, 0x76, 0xF7, 0x16, 0x74, 0x61, 0x1F, 0xE9,
-    0xEC, 0x7D, 0x26, 0x38, 0x73, 0x35, 0x40, 0xD5, 0x26, 0x2B, 0xCB, 0xF2, 0x99, 0x8E, 0x4E, 0xC4,
-    0xDD, 0xDC, 0x5A, 0x5D, 0xB9, 0xA0, 0x07, 0x1F, 0x8A, 0x6B, 0x71, 0x7F, 0xA1, 0xE8, 0x62, 0x1B,
-    0x4D, 0xDA, 0x8C, 0x9C, 0xD3, 0x3E, 0xE6, 0xF6, 0xFA, 0x70, 0x67, 0x9B, 0x24, 0x25, 0xA9, 0xF4,
-    0x0F, 0x8D, 0x9C, 0xD4, 0xBE, 0x59, 0x30, 0x8C, 0x8D, 0xC9, 0x66, 0x38, 0x92, 0xC1, 0x43, 0xED,
-    0x7F, 0xCB, 0x45, 0x4B, 0xD6, 0xE6, 0xA1, 0x31, 0xF3, 0xCF, 0xFD, 0xB1, 0xB6, 0xEE, 0x81, 0xBE,
-    0x7C, 0x13, 0xF4, 0x44, 0x98, 0x48, 0x3F, 0x0C, 0x01, 0x42, 0x20, 0x20, 0x46, 0x32, 0xA2, 0x01,
-    0x62, 0xE8, 0x0E, 0xF1, 0xAD, 0x7C, 0x41, 0x30, 0xB5, 0xE8, 0xF0, 0x5B, 0x57, 0x29, 0x04, 0xDC,
-    0x95, 0x44, 0x2F, 0x44, 0xA3, 0xD8, 0xF4, 0x17, 0xA8, 0xB4, 0xED, 0xAB, 0x7F, 0x28, 0xF5, 0x63,
-    0xB4, 0xF2, 0x24, 0xBF, 0xD4, 0xC9, 0x02, 0x20, 0x73, 0x83, 0xA5, 0x31, 0x07, 0x9B, 0x45, 0x4B,
-    0x3D, 0xE3, 0x5F, 0xB2, 0x61, 0x76, 0xB3, 0xCC, 0x86, 0xF9, 0xC5, 0xB6, 0xF0, 0xAC, 0x79, 0xDF,
-    0x1F, 0xC6, 0x1C, 0x13, 0x72, 0xF6, 0xC4, 0xE2, 0x9E, 0x54, 0x74, 0x39, 0x64, 0xB4, 0x2A, 0x69,
-    0x91, 0x7B, 0x12, 0xE9, 0x60, 0x5E, 0xB9, 0x5A, 0xBF, 0x49, 0xDD, 0xB8, 0xC1, 0xB5, 0x07, 0xF6,
-    0x0D, 0x71, 0xD9, 0xF4, 0x48, 0x2E, 0xBF, 0xA7, 0x65, 0x1B, 0xDA, 0x69, 0x2D, 0x4E, 0x63, 0x76,
-    0xB3, 0x67, 0x54, 0x4C, 0x51, 0x35, 0x9A, 0x1B, 0x11, 0x00, 0x4F, 0xB3, 0x95, 0x47, 0xA0, 0x2B,
-    0x6D, 0xB3, 0x24, 0xB6, 0x2E, 0x6B, 0x11, 0xF6, 0x5D, 0x67, 0xF8, 0xA3, 0xDD, 0x66, 0xA6, 0x85,
-    0x38, 0x04, 0x9A, 0xC1, 0x34, 0xD4, 0x5C, 0xF0, 0xC3, 0x63, 0x25, 0x09, 0x1D, 0xD0, 0xA5, 0x1D,
-    0x94, 0xC2, 0xF6, 0xA7, 0x74, 0x69, 0x30, 0x0D, 0x0C, 0xF5, 0x8B, 0x58, 0x63, 0xBA, 0xBC, 0x95,
-    0x19, 0x95, 0xE4, 0xD0, 0x8B, 0x1D, 0xDA, 0x91, 0x65, 0x31, 0x74, 0xCC, 0x32, 0x18, 0x78, 0x23,
-    0xD3, 0xE6, 0xA2, 0xF5, 0x15, 0xD7, 0xE9, 0xF9, 0xF4, 0xDA, 0x8E, 0xB9, 0xB2, 0xA6, 0x6C, 0x1F,
-    0xE6, 0x3A, 0x88, 0xCC, 0x60, 0x0A, 0xBE, 0x7D, 0xFB, 0x30, 0xE4, 0x93, 0xAC, 0x6C, 0x4A, 0x5B,
-    0xEF, 0xBD, 0x7D, 0xCF, 0x89, 0x11, 0x9D, 0x54, 0x2F, 0xEA, 0x14, 0xA0, 0x4A, 0x5C, 0x9C, 0x6E,
-    0x2A, 0xE0, 0x33, 0x11, 0xEF, 0xEF, 0x0A, 0xA5, 0x52, 0x46, 0x20, 0x2D, 0x39, 0x43, 0x56, 0x1B,
-    0x73, 0x1A, 0x6C, 0xA4, 0xF4, 0x69, 0xDF, 0x9B, 0x47, 0xB2, 0x8F, 0xDD, 0x00, 0xDB, 0x2E, 0xA3,
-    0x2B, 0x0B, 0xAA, 0x7C, 0x6B, 0x41, 0x75, 0x0E, 0x2E, 0x28, 0xF7, 0xCD, 0x81, 0xB2, 0x2E, 0xE3,
-    0x85, 0xB2, 0xD1, 0x9D, 0x70, 0x19, 0x16, 0xA7, 0x41, 0xFF, 0x4F, 0x15, 0x2F, 0x00, 0x9B, 0xBC,
-    0xC9, 0x14, 0x58, 0xE8, 0xE1, 0xF2, 0x16, 0xAC, 0xD3, 0x57, 0x43, 0xF1, 0xFF, 0xB7, 0x62, 0x9F,
-    0xAB, 0x07, 0x60, 0x73, 0xB3, 0x99, 0x9F, 0xA1, 0x99, 0xFF, 0xB6, 0x72, 0x2E, 0xAE, 0xA8, 0x64,
-    0x90, 0x3A, 0x17, 0xDB, 0x66, 0xC6, 0x6A, 0xA5, 0xD2, 0xCD, 0x1C, 0x28, 0xE7, 0x22, 0x9A, 0xF9,
-    0xEF, 0x0A, 0xE7, 0xE2, 0x07, 0x69, 0xF2, 0x32, 0x63, 0x86, 0xD4, 0xB2, 0x5C, 0xB7, 0x60, 0x94,
-    0x3F, 0x5C, 0x85, 0x58, 0x87, 0x99, 0x92, 0x8E, 0x1A, 0xAE, 0x5C, 0x60, 0xB6, 0xB5, 0x0C, 0x18,
-    0x6D, 0x6C, 0xD8, 0x01, 0xB2, 0x86, 0xC1, 0xE2, 0xB4, 0x71, 0x21, 0x83, 0x95, 0xF9, 0x91, 0xAC,
-    0x64, 0xB0, 0xE8, 0x97, 0xEC, 0xB4, 0x6B, 0x4A, 0x94, 0x9E, 0x1C, 0x99, 0x25, 0x2E, 0x40, 0xD1,
-    0x0A, 0x75, 0x53, 0x99, 0xCC, 0x4B, 0x5C, 0xA4, 0x94, 0xF0, 0xB3, 0xBE, 0x66, 0x9C, 0xE6, 0xD0,
-    0xD2, 0xF9, 0xC1, 0xB1, 0xE5, 0x18, 0x72, 0x70, 0x29, 0xE8, 0x39, 0xBA, 0xCE, 0x8D, 0x48, 0xDA,
-    0x2D, 0xD7, 0x78, 0x2F, 0xE5, 0x38, 0xD3, 0x27, 0xCD, 0x77, 0x8C, 0x8A, 0xF2, 0xA4, 0x4F, 0x52,
-    0x5D, 0x98, 0x3D, 0x9B, 0x53, 0xDE, 0x54, 0x34, 0x2D, 0x02, 0x8D, 0xA9, 0x65, 0xA5, 0xA6, 0x84,
-    0xD4, 0x68, 0xA4, 0x06, 0xDC, 0xB9, 0x4B, 0x91, 0xD2, 0xE3, 0xAA, 0x98, 0x74, 0xAC, 0x02, 0xBA,
-    0x17, 0xDC, 0x77, 0xB8, 0x92, 0x30, 0x27, 0x91, 0x57, 0x4C, 0x8C, 0x6F, 0x5F, 0x27, 0x4D, 0xE5,
-    0x22, 0x44, 0x98, 0x91, 0x18, 0x50, 0x9C, 0x9D, 0x1A, 0xAA, 0xD9, 0xB7, 0x31, 0x00, 0x7D, 0xE3,
-    0x28, 0x93, 0xB5, 0x85, 0x6B, 0x3D, 0xA2, 0x71, 0xF2, 0xAC, 0x41, 0x96, 0xB5, 0xC9, 0xB1, 0x1E,
-    0x19, 0xB6, 0xC7, 0x65, 0x7C, 0x64, 0x57, 0x72, 0xAB, 0x18, 0x50, 0x82, 0x25, 0xC0, 0xAA, 0x5C,
-    0x0C, 0x69, 0x50, 0x7E, 0x3A, 0x92, 0xAA, 0x9D, 0x3E, 0xC2, 0x8E, 0xFE, 0x3F, 0xBD, 0x63, 0x0A,
-    0xF6, 0x23, 0xBC, 0xF1, 0xF7, 0xDC, 0x8D, 0x65, 0xA7, 0x1E, 0xE4, 0x14, 0xDD, 0x7B, 0x12, 0x68,
-    0x86, 0xEE, 0x77, 0xAE, 0x84, 0x62, 0xEE, 0x39, 0x68, 0xD7, 0x28, 0xDA, 0x0B, 0x3E, 0xE3, 0x08,
-    0xCC, 0x4D, 0x2C, 0x76, 0x7B, 0xA2, 0xCF, 0x0B, 0xD4, 0xC2, 0xE3, 0xFB, 0x59, 0x3A, 0x06, 0x89,
-    0xC0, 0x69, 0xB8, 0x5C, 0xAE, 0x99, 0xB0, 0x2D, 0xD7, 0xFF, 0x4A, 0x0C, 0x1B, 0x69, 0xA5, 0xB5,
-    0xFB, 0xA9, 0x44, 0xAD, 0xA4, 0xA7, 0xD6, 0x6A, 0xB7, 0xFB, 0xE0, 0x67, 0x77, 0x3D, 0x65, 0x9C,
-    0x6A, 0xF8, 0x49, 0xC2, 0x28, 0x13, 0x76, 0xEB, 0x47, 0xD8, 0x5A, 0xB5, 0x7D, 0x67, 0x4A, 0xF0,
-    0xAF, 0xDD, 0xDD, 0x73, 0xF7, 0xDE, 0x5D, 0xA8, 0xD3, 0x91, 0xDA, 0x03, 0xD4, 0xE4, 0xCA, 0xD6,
-    0x02, 0xD5, 0x47, 0x3B, 0x84, 0x5D, 0x91, 0x5E, 0xD4, 0xA0, 0x72, 0x68, 0x62, 0xB9, 0xE7, 0xE5,
-    0x7A, 0x55, 0x6A, 0xA9, 0x9F, 0xAC, 0xF5, 0x61, 0x59, 0x1F, 0x16, 0xF4, 0x21, 0xD8, 0xF5, 0xB0,
-    0xC3, 0x57, 0xD6, 0xDF, 0x74, 0xE8, 0x4C, 0x11, 0xBB, 0x5A, 0xF4, 0x0A, 0xAD, 0xD5, 0x44, 0xFA,
-    0xB7, 0x49, 0xE2, 0x3A, 0xED, 0x2D, 0x26, 0x1C, 0x68, 0x24, 0xE4, 0x9F, 0xEC, 0x96, 0x09, 0x30,
-    0x4D, 0x10, 0x68, 0xD6, 0x79, 0xB9, 0x69, 0x78, 0xF9, 0x50, 0x23, 0x97, 0x97, 0xE5, 0xE9, 0x9A,
-    0x4F, 0x9B, 0x92, 0x20, 0x20, 0x51, 0x66, 0xEA, 0x68, 0x2E, 0x86, 0x50, 0xD3, 0x10, 0xAB, 0x96,
-    0x9C, 0xAD, 0xCE, 0x61, 0x73, 0x5E, 0x16, 0x37, 0xA4, 0x38, 0x27, 0x8C, 0x26, 0xDB, 0x61, 0x09,
-    0x12, 0xD8, 0x8A, 0xA3, 0xDA, 0x59, 0x7F, 0x4E, 0x3C, 0x96, 0x62, 0x4F, 0xFB, 0x0C, 0xB9, 0x86,
-    0x0D, 0x1A, 0x10, 0xBE, 0xC7, 0x8C, 0xD3, 0x78, 0x59, 0x1C, 0xA3, 0xEF, 0xE6, 0x66, 0x41, 0x07,
-    0x55, 0x4D, 0xB7, 0x58, 0x48, 0x07, 0xAC, 0xAB, 0x83, 0x4B, 0x56, 0x5E, 0x33, 0xA9, 0xD5, 0x8B,
-    0xDC, 0x18, 0x02, 0xD8, 0x2A, 0x16, 0xE8, 0x06, 0x83, 0xA0, 0xA8, 0xB8, 0x24, 0x7B, 0x44, 0xDD,
-    0xCE, 0x3E, 0x53, 0x89, 0xF8, 0xE5, 0x66, 0x36, 0x8D, 0x12, 0xB7, 0xDE, 0xBF, 0xE4, 0xF8, 0xCD,
-    0xB0, 0xB4, 0x0A, 0x02, 0x63, 0xF4, 0x7A, 0xE6, 0x1D, 0xFE, 0xBA, 0x04, 0x82, 0xEF, 0x41, 0xBF,
-    0x7A, 0x51, 0x6D, 0x5F, 0xC8, 0x7C, 0x58, 0xC9, 0x76, 0x56, 0xE1, 0x47, 0x62, 0x95, 0x9E, 0x60,
-    0xA0, 0xC8, 0x24, 0x2D, 0x18, 0xD1, 0x7C, 0xB4, 0xDD, 0x89, 0x50, 0xDA, 0x93, 0xBB, 0x16, 0xD7,
-    0x7C, 0x5B, 0x27, 0x82, 0x12, 0x27, 0xC2, 0x49, 0x89, 0x66, 0xC8, 0x5A, 0x71, 0x87, 0x56, 0xEC,
-    0x6F, 0x5A, 0x2B, 0x81, 0xCA, 0x75, 0x96, 0xE3, 0x55, 0xB6, 0x4B, 0xEA, 0x5B, 0x27, 0xC2, 0xD1,
-    0xEC, 0x3E, 0x4E, 0x84, 0x7C, 0x9B, 0x13, 0x21, 0x96, 0xF4, 0x18, 0x49, 0xC5, 0xA1, 0xD9, 0xF6,
-    0x92, 0xCC, 0xD2, 0x0F, 0x73, 0x89, 0x23, 0x6D, 0xAD, 0xE0, 0x39, 0x75, 0xF6, 0xFA, 0xA7, 0x4F,
-    0xB6, 0x72, 0x67, 0x55, 0x49, 0x7E, 0x20, 0x37, 0xA1, 0x80, 0xBB, 0xB7, 0x7D, 0xA4, 0xC1, 0xF7,
-    0x9A, 0x66, 0xFC, 0xCA, 0xD2, 0x30, 0xDE, 0x96, 0x95, 0x70, 0xDF, 0x03, 0x83, 0x81, 0x25, 0xF3,
-    0x06, 0x44, 0xB4, 0xB8, 0x3B, 0x0E, 0x33, 0x04, 0x24, 0x1E, 0xC6, 0x8F, 0x9E, 0x2B, 0xAA, 0x0F,
-    0xA2, 0x3D, 0x59, 0x3C, 0x59, 0x49, 0xE4, 0x59, 0xBC, 0xD7, 0x09, 0x83, 0x50, 0x57, 0x22, 0x14,
-    0x91, 0xEA, 0xA5, 0xB7, 0x76, 0x71, 0xF7, 0x4C, 0xE4, 0xBB, 0x5C, 0xD8, 0x96, 0xE9, 0xE9, 0xEA,
-    0x4C, 0xCF, 0x54, 0x67, 0x7A, 0x96, 0x0A, 0xF4, 0x41, 0x0B, 0xD4, 0xFE, 0xAC, 0xD0, 0x99, 0x9E,
-    0x44, 0xC1, 0x28, 0x93, 0x8B, 0xA1, 0xB6, 0x65, 0x7A, 0x06, 0xBA, 0x50, 0x59, 0x9E, 0xBE, 0xF5,
-    0xF3, 0x71, 0x1B, 0xDC, 0x5D, 0x9F, 0x13, 0x1F, 0x99, 0xA4, 0x1B, 0x3C, 0x76, 0x83, 0x31, 0xFF,
-    0x6F, 0xEC, 0xD6, 0x60, 0x6D, 0x92, 0x4D, 0x76, 0x6B, 0x30, 0x35, 0x9C, 0x49, 0xB7, 0xAF, 0xCB,
-    0xEC, 0xE7, 0x05, 0xF1, 0x8E, 0x8B, 0xC7, 0x1C, 0x3D, 0xE9, 0x83, 0xCA, 0x98, 0xC2, 0x22, 0x0B,
-    0x95, 0xC4, 0x07, 0x46, 0xD2, 0xA7, 0xC1, 0x2D, 0x2B, 0x95, 0xAC, 0x3F, 0x14, 0x3A, 0x38, 0xE5,
-    0x45, 0xFD, 0xAD, 0x75, 0x5B, 0x78, 0x67, 0xE5, 0x97, 0x5C, 0x0D, 0x94, 0x68, 0x5F, 0x87, 0x90,
-    0x85, 0x79, 0xCF, 0x89, 0x31, 0xF7, 0x0A, 0x34, 0x13, 0x63, 0xFC, 0x8C, 0x21, 0x73, 0x11, 0x9F,
-    0x41, 0x6F, 0x2F, 0x17, 0x3A, 0x87, 0xA4, 0x80, 0x5C, 0x6F, 0x3C, 0xC7, 0x35, 0xDE, 0xE3, 0x33,
-    0x78, 0x36, 0xC3, 0x3B, 0x93, 0x40, 0xBB, 0xBF, 0x76, 0x49, 0x4F, 0x53, 0xFB, 0x46, 0x0C, 0xBA,
-    0xE6, 0x8C, 0xC0, 0xC6, 0xF5, 0xEC, 0x70, 0x32, 0x5C, 0x0C, 0xA7, 0xAE, 0x34, 0xED, 0x5A, 0x6B,
-    0xBD, 0x6B, 0xDA, 0xC1, 0xF6, 0x9D, 0xDC, 0x18, 0x77, 0xBB, 0x83, 0x39, 0xA5, 0x97, 0x4C, 0xB9,
-    0x12, 0x6B, 0x9E, 0xAE, 0xAE, 0xDF, 0xF4, 0x0D, 0x75, 0xA6, 0xC9, 0x1E, 0x5B, 0x37, 0xE6, 0xC0,
-    0x29, 0xD1, 0x69, 0x4C, 0x78, 0xDE, 0x33, 0xCF, 0xDE, 0x39, 0xE3, 0x29, 0xFD, 0x15, 0x85, 0x80,
-    0xAC, 0x81, 0x09, 0xEA, 0xC9, 0x8A, 0xE6, 0x47, 0xB9, 0xD8, 0x97, 0x08, 0x77, 0xA5, 0xA6, 0xCB,
-    0x85, 0xC4, 0x93, 0x2E, 0x34, 0x24, 0x44, 0xA4, 0xF5, 0x88, 0x5C, 0x34, 0x22, 0xE6, 0xC6, 0x71,
-    0x0E, 0x2A, 0x59, 0x6F, 0x4C, 0x4A, 0x8C, 0x71, 0x29, 0xB8, 0xDF, 0x25, 0xA0, 0xBB, 0xFD, 0xB9,
-    0x7B, 0x67, 0xA9, 0x89, 0xD1, 0xAF, 0x15, 0x35, 0xFB, 0xDF, 0xA3, 0x9D, 0x6B, 0x8A, 0xB6, 0x96,
-    0x19, 0xAD, 0xAA, 0x96, 0x4C, 0xC4, 0xF7, 0x22, 0x2A, 0x42, 0xBC, 0x2E, 0xBD, 0x69, 0x70, 0x54,
-    0x2E, 0xCD, 0xA8, 0x33, 0xCA, 0x5C, 0xAC, 0x24, 0x5C, 0xB6, 0x73, 0x23, 0xCE, 0x04, 0x94, 0xCD,
-    0x06, 0xDD, 0x26, 0xF3, 0x9B, 0x6F, 0xB2, 0xD9, 0xC9, 0xE1, 0xED, 0x72, 0x87, 0xFE, 0xF8, 0x89,
-    0xDE, 0x76, 0x9F, 0xF5, 0x44, 0xAF, 0xA9, 0x08, 0xEE, 0xD9, 0x8C, 0x28, 0x48, 0xAC, 0x78, 0x73,
-    0x1B, 0x58, 0xF1, 0x4A, 0xB8, 0xD6, 0x4C, 0x1C, 0xF6, 0x67, 0xE9, 0x1A, 0xC8, 0x2A, 0xDE, 0xB9,
-    0x6D, 0x2B, 0xF7, 0x8C, 0x9A, 0xFD, 0x00, 0x63, 0x8E, 0xC1, 0xBE, 0xC4, 0xC3, 0x73, 0xF6, 0xA5,
-    0x77, 0xD2, 0x5E, 0xFD, 0xAA, 0xFD, 0xF9, 0xF9, 0xCF, 0xEA, 0xC1, 0x5F, 0x34, 0xE7, 0x9B, 0x49,
-    0x32, 0x3B, 0x81, 0xB2, 0x4C, 0x7B, 0xEA, 0x55, 0x7D, 0x90, 0x5E, 0xF6, 0x3A, 0x0F, 0x72, 0x0D,
-    0xAB, 0x72, 0xF6, 0x0C, 0xD3, 0x6F, 0x0B, 0xB7, 0x59, 0x6B, 0xAC, 0x75, 0xE5, 0xE4, 0xA5, 0xC6,
-    0x06, 0x5C, 0xC2, 0xC4, 0xC4, 0x18, 0xAE, 0xD3, 0x97, 0x20, 0xC7, 0xBD, 0x17, 0xA6, 0x50, 0x3B,
-    0xB9, 0xE7, 0xF0, 0xD9, 0x28, 0x4E, 0x9A, 0xE6, 0x8D, 0xC9, 0xD1, 0x7A, 0x14, 0x39, 0xB0, 0x8B,
-    0x82, 0x65, 0x31, 0xAC, 0x31, 0x04, 0x0F, 0x3C, 0xE4, 0x53, 0x4D, 0x6D, 0x4B, 0x3C, 0x27, 0x14,
-    0x2F, 0x7D, 0x73, 0x68, 0x90, 0x92, 0xD3, 0x1D, 0xAE, 0x9B, 0x17, 0xF1, 0x01, 0x8B, 0xB1, 0x7C,
-    0x55, 0x16, 0xCD, 0x1E, 0x94, 0x75, 0xB6, 0x7A, 0x1F, 0x36, 0xC3, 0xE1, 0xB0, 0xF6, 0x24, 0x11,
-    0xC9, 0x18, 0xE1, 0xFC, 0x13, 0x15, 0x6E, 0x33, 0x84, 0x25, 0x08, 0xD2, 0x7A, 0xB0, 0xB5, 0x3F,
-    0xDE, 0xD2, 0xCB, 0x93, 0x9A, 0x68, 0x56, 0x16, 0xF2, 0xD2, 0x8D, 0x6C, 0x6B, 0xCB, 0x7C, 0x26,
-    0x6A, 0x95, 0x76, 0x88, 0x8B, 0xEE, 0xB5, 0xF9, 0xB7, 0x0F, 0x95, 0x2A, 0xA1, 0xA3, 0x8F, 0x1F,
-    0xA2, 0x08, 0x83, 0x95, 0xEE, 0xB1, 0x9B, 0xAC, 0x66, 0x76, 0x32, 0x1C, 0x9E, 0x16, 0x42, 0xEA,
-    0x4F, 0xC9, 0x50, 0x22, 0x9F, 0x63, 0xF5, 0x02, 0x79, 0x20, 0xD5, 0x58, 0x63, 0x6B, 0x55, 0xD6,
-    0xFD, 0xBA, 0xE5, 0x3C, 0xA3, 0x6E, 0xE9, 0xF7, 0xEE, 0xB7, 0xDF, 0x37, 0x45, 0x2A, 0x3E, 0x5E,
-    0x71, 0x9E, 0xB0, 0xD3, 0xE2, 0x08, 0x48, 0xD4, 0xDD, 0x27, 0x47, 0xD4, 0x68, 0x32, 0x9A, 0xD8,
-    0xD9, 0xC3, 0xFE, 0x8D, 0xC6, 0x94, 0x1D, 0x7B, 0xB5, 0x1F, 0xBA, 0xD0, 0x12, 0xE4, 0x76, 0xA2,
-    0x5D, 0xCC, 0x5A, 0x5C, 0x1D, 0xD9, 0x1C, 0x54, 0xAA, 0x87, 0x08, 0xE6, 0x41, 0x26, 0xD9, 0x50,
-    0x2E, 0xC3, 0x37, 0x5C, 0x10, 0x23, 0x26, 0xBB, 0x1F, 0x49, 0x72, 0x0E, 0x93, 0x9E, 0xC8, 0x7D,
-    0xAA, 0xA4, 0x7D, 0xB8, 0x6C, 0xC9, 0x7A, 0xB6, 0x9A, 0xB9, 0x34, 0x92, 0x94, 0x33, 0xFD, 0x58,
-    0x0F, 0x46, 0xE2, 0xD8, 0xAA, 0x24, 0xB3, 0xD0, 0xC9, 0x4B, 0xD3, 0x46, 0xBC, 0x3F, 0x8A, 0xF1,
-    0x78, 0x9A, 0x99, 0x5C, 0x81, 0xC6, 0xEC, 0xB5, 0x4C, 0x16, 0xD5, 0xBB, 0x29, 0x34, 0x6B, 0x29,
-    0x0B, 0x16, 0x68, 0x81, 0xBE, 0x21, 0xEB, 0x38, 0x19, 0xE2, 0x8E, 0x99, 0xC2, 0x7B, 0x90, 0xCC,
-    0xC5, 0xC5, 0x43, 0x4A, 0x96, 0x0F, 0x6D, 0x7E, 0x57, 0x45, 0x3D, 0xB5, 0x05, 0x52, 0xDB, 0x2C,
-    0xFD, 0x15, 0xFE, 0x16, 0x7F, 0x05, 0x1F, 0x94, 0xEE, 0x32, 0x84, 0x29, 0x96, 0xFE, 0xBC, 0x74,
-    0x96, 0xEB, 0x16, 0x9B, 0x28, 0x88, 0x4E, 0x54, 0x78, 0x65, 0x00, 0xD9, 0x66, 0x93, 0xAB, 0x97,
-    0xB7, 0x2F, 0x11, 0xDF, 0x5C, 0xEF, 0xDE, 0x6A, 0x7C, 0x41, 0xDB, 0xEC, 0xCF, 0x8A, 0xFA, 0xBE,
-    0xD1, 0xB0, 0x90, 0x16, 0x65, 0xCF, 0x29, 0xF1, 0x05, 0xA4, 0xD6, 0x96, 0xCB, 0x22, 0x16, 0x97,
-    0x05, 0x57, 0x4E, 0xF1, 0x73, 0x36, 0x95, 0xB3, 0x3A, 0x8F, 0x7B, 0x21, 0xC0, 0x40, 0xAD, 0x97,
-    0xBE, 0xF5, 0xA7, 0xEB, 0x83, 0x24, 0x1D, 0xB2, 0xA7, 0xBD, 0x40, 0x15, 0x60, 0x23, 0x10, 0x47,
-    0xCA, 0xC4, 0xE9, 0x36, 0xC5, 0x20, 0xD7, 0x71, 0x6B, 0xA8, 0xB4, 0x81, 0x92, 0x21, 0xE7, 0xCA,
-    0x7E, 0xF9, 0x9E, 0x4F, 0x2D, 0xB6, 0x92, 0xD2, 0x59, 0x63, 0xBE, 0xF0, 0x4F, 0xAC, 0xB3, 0x28,
-    0xD8, 0x59, 0x5E, 0x64, 0xA6, 0x23, 0x85, 0x3E, 0xCD, 0x78, 0xFA, 0x60, 0x88, 0x22, 0xF4, 0x37,
-    0x27, 0x7A, 0xBC, 0x48, 0xDD, 0xF9, 0x4B, 0xA8, 0x46, 0x77, 0xCC, 0x40, 0x7B, 0x33, 0x33, 0xD5,
-    0x09, 0x5A, 0x08, 0x95, 0x9B, 0x1E, 0x2C, 0x61, 0x0E, 0x08, 0x84, 0x57, 0x86, 0xA7, 0xD9, 0x98,
-    0x08, 0x26, 0x19, 0xBF, 0xFB, 0xE1, 0xF2, 0x33, 0x20, 0x25, 0xBD, 0x03, 0x91, 0x80, 0x1E, 0x4E,
-    0x25, 0xB1, 0x0F, 0xE7, 0x23, 0x32, 0x0A, 0x4D, 0x84, 0x91, 0x24, 0x75, 0xA0, 0x89, 0xD1, 0x28,
-    0x56, 0xCD, 0xA5, 0x5C, 0xFB, 0xE1, 0x45, 0xED, 0x4E, 0x13, 0x74, 0xA4, 0x3A, 0xC9, 0x17, 0x8D,
-    0x9E, 0xC6, 0x07, 0x0B, 0x82, 0xBB, 0x27, 0x30, 0x11, 0x47, 0xE9, 0xF7, 0x8D, 0x51, 0x3B, 0x81,
-    0x93, 0xE9, 0x04, 0x1A, 0x7F, 0xAD, 0xFD, 0x20, 0x3E, 0x5D, 0xC5, 0x30, 0x5B, 0x6F, 0x4E, 0x7F,
-    0xA2, 0x2A, 0x60, 0x98, 0x9B, 0xF7, 0xB9, 0xBB, 0xC3, 0xDF, 0x1D, 0x4A, 0x25, 0x34, 0xC0, 0x40,
-    0x18, 0xA6, 0x8E, 0x0D, 0x3D, 0x2B, 0xC7, 0x43, 0x3D, 0x55, 0xEF, 0x02, 0x00, 0xA4, 0xAF, 0x66,
-    0x6B, 0xE0, 0x11, 0xDE, 0x3D, 0xA1, 0xE3, 0xE1, 0xCE, 0xD4, 0xF1, 0xD0, 0x92, 0x89, 0x39, 0x8D,
-    0x9F, 0xF4, 0x54, 0x6B, 0x18, 0xEC, 0xAE, 0xEE, 0xEF, 0xDA, 0x16, 0x94, 0xB1, 0x12, 0x5E, 0x1F,
-    0x4D, 0x08, 0x5F, 0x8C, 0xBF, 0x59, 0xDC, 0x05, 0x3A, 0x18, 0x0B, 0x3A, 0x9E, 0x2A, 0xDB, 0x2E,
-    0xF1, 0x91, 0x99, 0x08, 0x90, 0xE5, 0xE3, 0x58, 0x75, 0x80, 0x52, 0xAE, 0x6C, 0x1D, 0x6A, 0xE1,
-    0xA7, 0x65, 0xC0, 0x95, 0xDF, 0x36, 0x4D, 0x5F, 0xA3, 0x95, 0x8E, 0xD6, 0xF0, 0x7D, 0x59, 0x1C,
-    0xC1, 0xD6, 0x4F, 0x01, 0xC1, 0xE6, 0xC1, 0x88, 0xE4, 0xC3, 0x1C, 0x39, 0xCD, 0x32, 0xA7, 0x6A,
-    0x11, 0xCD, 0x06, 0x58, 0xB1, 0x89, 0xE5, 0xDB, 0x1C, 0xB9, 0x8B, 0x16, 0xF5, 0x2A, 0xEB, 0x62,
-    0xAA, 0x0E, 0x04, 0x8A, 0xF9, 0xC0, 0x6F, 0xC6, 0xF2, 0x79, 0x8E, 0xDC, 0x7D, 0x3D, 0x95, 0xD8,
-    0x58, 0xC5, 0x20, 0x18, 0x64, 0x16, 0x58, 0x5E, 0xBE, 0xD0, 0xC1, 0xF0, 0x98, 0xC7, 0xF8, 0x98,
-    0xE7, 0x00, 0xBC, 0x94, 0xFC, 0x4C, 0x47, 0x2C, 0x1F, 0xE9, 0xC0, 0x0D, 0xAF, 0xE2, 0x0D, 0x0B,
-    0xAC, 0x37, 0x57, 0x42, 0x88, 0xB8, 0xB5, 0x7C, 0xA7, 0x43, 0xFB, 0x90, 0x25, 0x26, 0xD9, 0x42,
-    0xD1, 0x36, 0x5C, 0xA9, 0x3D, 0x0C, 0x0B, 0xAD, 0x6E, 0x3A, 0xC5, 0x44, 0xF7, 0x51, 0xA4, 0xFC,
-    0x0C, 0xAC, 0x14, 0x32, 0xB6, 0x35, 0xC8, 0x20, 0x27, 0x36, 0xB2, 0xE5, 0x42, 0xDD, 0xCA, 0x92,
-    0x92, 0x11, 0xB1, 0x73, 0xD6, 0xE5, 0x2C, 0x39, 0x08, 0x23, 0x3A, 0xE9, 0xB8, 0xEF, 0x66, 0x89,
-    0xE7, 0x32, 0xAB, 0xF6, 0x2F, 0xB0, 0x73, 0x20, 0x14, 0x13, 0xAB, 0xE6, 0xAE, 0x82, 0x25, 0x60,
-    0x14, 0x02, 0xDC, 0x34, 0x0A, 0xEE, 0x6D, 0x72, 0xFA, 0x26, 0xDD, 0xA8, 0xB9, 0x6F, 0xA1, 0xA5,
-    0x44, 0x49, 0x95, 0xE0, 0x31, 0xF3, 0x76, 0x32, 0x55, 0x4F, 0x9B, 0xCA, 0x49, 0x34, 0x17, 0x0D,
-    0x6D, 0x49, 0x07, 0x76, 0x25, 0x61, 0xB2, 0x68, 0xBF, 0x35, 0xE1, 0x71, 0x3A, 0x6B, 0x89, 0xEE,
-    0x48, 0x52, 0x58, 0x4F, 0x89, 0x61, 0xC6, 0x2F, 0x33, 0x30, 0x61, 0x33, 0x13, 0xCD, 0x64, 0x5F,
-    0x1F, 0x8E, 0xC8, 0x56, 0x5A, 0x13, 0x39, 0x84, 0x08, 0x81, 0x38, 0xE6, 0x19, 0x4C, 0x12, 0x47,
-    0x3A, 0xD5, 0x4D, 0xE5, 0xC4, 0xDE, 0x47, 0x29, 0xBD, 0x1D, 0x5A, 0xCB, 0xEC, 0x99, 0x44, 0x3E,
-    0xA4, 0xEE, 0xE2, 0x40, 0xA7, 0x10, 0x69, 0xCF, 0xCB, 0x71, 0x50, 0xF8, 0xD7, 0xCD, 0x87, 0x90,
-    0xCA, 0xBE, 0xF8, 0x92, 0xAD, 0x8D, 0xD4, 0x18, 0x57, 0x46, 0x13, 0x36, 0xDF, 0x9C, 0x6F, 0xF2,
-    0xC2, 0x98, 0x26, 0x91, 0x24, 0x2E, 0x99, 0x86, 0x2B, 0x07, 0xDB, 0xD5, 0xD2, 0xCF, 0xAE, 0x2F,
-    0x1C, 0xCA, 0xCA, 0x63, 0xC4, 0x61, 0xAB, 0xEE, 0xC7, 0xED, 0x0B, 0x41, 0x8F, 0x38, 0x90, 0xE9,
-    0x77, 0x53, 0x77, 0xC6, 0xFC, 0x92, 0x5A, 0x9B, 0xFD, 0x22, 0x3D, 0xF1, 0x5B, 0xB3, 0xA1, 0x12,
-    0x6C, 0x12, 0x88, 0x28, 0xE6, 0x0D, 0x93, 0x39, 0x9E, 0x99, 0xAA, 0x64, 0x99, 0x0C, 0x94, 0x16,
-    0xDE, 0x0B, 0x05, 0x22, 0x78, 0x02, 0xA5, 0xDC, 0xEB, 0x43, 0xBD, 0x64, 0x22, 0x50, 0xAD, 0xD2,
-    0x91, 0x94, 0xB0, 0xD6, 0xF0, 0x3A, 0xD2, 0x17, 0x95, 0x1D, 0xCA, 0x87, 0x92, 0x52, 0x63, 0x94,
-    0x3B, 0x15, 0x7E, 0x7F, 0x0D, 0x32, 0x59, 0x77, 0x9A, 0x2F, 0x96, 0xE5, 0x6B, 0x7D, 0x82, 0x2C,
-    0x0C, 0xC9, 0x33, 0xC7, 0x7B, 0xDD, 0x71, 0xF7, 0x44, 0x4C, 0x67, 0xC8, 0xC4, 0x5B, 0x3F, 0x71,
-    0x7D, 0x78, 0x46, 0x14, 0x93, 0x2C, 0xFD, 0xD5, 0x5A, 0x0D, 0x4D, 0xF0, 0x73, 0xE8, 0x46, 0xF3,
-    0x9B, 0xDC, 0xB8, 0xC0, 0x85, 0xE2, 0x8D, 0xD9, 0xE4, 0x36, 0x9A, 0xF6, 0x3C, 0xE5, 0xB6, 0xA1,
-    0xF6, 0x1A, 0x00, 0x0E, 0xE1, 0x89, 0x94, 0x5E, 0xE6, 0x7D, 0xD1, 0x77, 0xF5, 0xB9, 0x46, 0x33,
-    0xDE, 0xA3, 0x0E, 0x60, 0xEE, 0xD6, 0x97, 0xE5, 0x5B, 0x83, 0x2D, 0x84, 0x9D, 0xBF, 0x46, 0x6C,
-    0x48, 0x68, 0x58, 0x32, 0x02, 0xC1, 0x99, 0x0F, 0x17, 0xBA, 0xC7, 0xBE, 0x41, 0xEB, 0x07, 0xC3,
-    0xE1, 0x7F, 0x69, 0x45, 0x4E, 0xA1, 0x01, 0xE1, 0x44, 0xBD, 0x60, 0x49, 0x1C, 0xB7, 0xDA, 0x44,
-    0xC0, 0x92, 0xDC, 0xAF, 0xD3, 0xD2, 0x0D, 0x89, 0x80, 0x48, 0xB6, 0x9D, 0xA0, 0xC7, 0x70, 0xCA,
-    0x85, 0xC2, 0x80, 0xD6, 0xEF, 0xBB, 0x10, 0xFF, 0x1F, 0x37, 0x7A, 0x75, 0x66, 0xC3, 0x84, 0x44,
-    0x21, 0x33, 0xF7, 0x4D, 0x86, 0xED, 0xFD, 0x96, 0x3E, 0x89, 0xBC, 0x8C, 0x1A, 0x15, 0xCD, 0x83,
-    0xF4, 0x75, 0xBA, 0x7E, 0xA4, 0x71, 0xD6, 0x6C, 0xB3, 0x68, 0x89, 0x0E, 0x19, 0xE9, 0xEC, 0x38,
-    0xA7, 0xFD, 0x3E, 0x22, 0x8A, 0x1D, 0xE8, 0x25, 0x71, 0xA3, 0x9E, 0x80, 0x9C, 0x3E, 0xF0, 0xD3,
-    0x67, 0x95, 0x59, 0xB2, 0x65, 0x4C, 0x6D, 0x9A, 0x99, 0x32, 0x01, 0xA8, 0x10, 0x95, 0xF4, 0xC8,
-    0x04, 0xDB, 0x53, 0x3B, 0x40, 0x89, 0x1A, 0x2A, 0xBA, 0xBF, 0x9E, 0x15, 0xC1, 0xB5, 0xB2, 0x99,
-    0x67, 0x56, 0x4F, 0x15, 0x8E, 0x2C, 0xF0, 0x70, 0xFF, 0x3D, 0x7A, 0xB0, 0xC0, 0xC6, 0xAF, 0x13,
-    0x34, 0x4B, 0xE3, 0x3F, 0x88, 0x35, 0x04, 0x33, 0x99, 0x64, 0xE9, 0x7E, 0x86, 0x8E, 0x2E, 0x10,
-    0xCB, 0x14, 0x56, 0x05, 0x6D, 0xCC, 0xF8, 0x18, 0x54, 0xE6, 0xB8, 0x4D, 0xA2, 0xC5, 0xF4, 0x76,
-    0x34, 0xA2, 0x7A, 0xC1, 0x9C, 0xDA, 0x0F, 0x4F, 0xD4, 0xAB, 0x69, 0x82, 0x58, 0x25, 0x66, 0xB0,
-    0x74, 0xED, 0xEE, 0xCE, 0xFD, 0xBF, 0x08, 0xA6, 0xB5, 0x05, 0xC0, 0xF5, 0x5B, 0x68, 0x1A, 0xDB,
-    0xBC, 0x35, 0x1C, 0x4F, 0x15, 0x4C, 0xB7, 0xAB, 0x22, 0x25, 0x33, 0x75, 0xF1, 0x85, 0xAD, 0xEF,
-    0x1A, 0x35, 0x11, 0x5D, 0x62, 0x3F, 0x97, 0x1C, 0x9E, 0x50, 0x6D, 0x06, 0x31, 0x6D, 0xBD, 0x9A,
-    0xCA, 0x2E, 0x94, 0x24, 0xF8, 0x83, 0xE4, 0x8F, 0x4E, 0x5A, 0xC2, 0xA8, 0x77, 0xC2, 0xA3, 0xEA,
-    0x9A, 0x9A, 0x07, 0x1F, 0x8F, 0xC5, 0x24, 0x9B, 0xD1, 0x33, 0x8D, 0x66, 0x76, 0xDC, 0x74, 0x46,
-    0x4D, 0xF3, 0x77, 0x64, 0x21, 0x62, 0xF9, 0xD2, 0xA1, 0x91, 0x9A, 0xBA, 0x58, 0x01, 0x45, 0x96,
-    0xB9, 0xCC, 0xD1, 0xA7, 0xB3, 0xAB, 0x6E, 0xD7, 0xAE, 0xE2, 0x6C, 0x51, 0x8D, 0x43, 0x3A, 0x0F,
-    0xC6, 0x92, 0x38, 0xD5, 0x34, 0x5F, 0x60, 0x02, 0xDE, 0x19, 0x0E, 0xC7, 0xFA, 0x93, 0xA0, 0x63,
-    0x6D, 0x18, 0xD6, 0x9B, 0x07, 0x67, 0x12, 0x89, 0x75, 0xB7, 0x6F, 0xBE, 0xD0, 0x7E, 0x3E, 0x67,
-    0x2B, 0x16, 0x2B, 0x2B, 0x43, 0xFF, 0x57, 0x64, 0xF0, 0xE3, 0x33, 0xD9, 0x3C, 0x87, 0x0B, 0x12,
-    0xF8, 0x95, 0xE1, 0xF0, 0x30, 0x58, 0xEB, 0x95, 0xE1, 0x52, 0x34, 0x5D, 0x17, 0x17, 0x4E, 0x3F,
-    0xB5, 0x21, 0xCE, 0xC5, 0x6B, 0x92, 0x7E, 0xB6, 0x4F, 0xCC, 0xC6, 0x58, 0x2E, 0xB5, 0x0B, 0x4D,
-    0x2D, 0x2D, 0x0D, 0x28, 0xE5, 0xAB, 0xFF, 0x66, 0x8C, 0x98, 0xB2, 0xC1, 0x25, 0xE5, 0x5C, 0x55,
-    0xAA, 0x53, 0x44, 0xF7, 0x75, 0xA3, 0x67, 0xF1, 0xC1, 0x34, 0x2E, 0x8B, 0x1D, 0x34, 0x99, 0xD1,
-    0x3D, 0xF2, 0x24, 0xDF, 0x6F, 0x10, 0xEE, 0x11, 0x02, 0x64, 0x32, 0x8A, 0x11, 0xBF, 0xBC, 0x45,
-    0x81, 0x4F, 0xFB, 0x53, 0x73, 0x91, 0x90, 0xFF, 0x4E, 0x49, 0xF0, 0xD8, 0xDD, 0x30, 0xB4, 0xCB,
-    0xA6, 0x6C, 0x77, 0x66, 0xF4, 0xD6, 0x76, 0x66, 0xFA, 0x36, 0xEB, 0x04, 0x76, 0xDB, 0xDD, 0xBB,
-    0x4E, 0xC0, 0x78, 0xC0, 0x3A, 0x01, 0x8E, 0x29, 0x19, 0x94, 0xDB, 0x5B, 0xDF, 0xDB, 0x26, 0x63,
-    0xDB, 0xF5, 0x03, 0xB7, 0xE7, 0xDB, 0xF5, 0x03, 0xC6, 0xE6, 0xFA, 0x81, 0xED, 0x5B, 0xBB, 0x7C,
-    0x70, 0xD7, 0xF5, 0x03, 0xFF, 0x9F, 0x2E, 0x7B, 0xF8, 0x0E, 0xA7, 0xE7, 0xC9, 0xFB, 0xD3, 0x4E,
-    0x8F, 0xE4, 0x3E, 0xCF, 0xED, 0x32, 0x3D, 0x4F, 0xD2, 0x4F, 0x01, 0xF9, 0xE2, 0xAF, 0x88, 0x61,
-    0x8A, 0x6E, 0x25, 0x0E, 0x33, 0xB4, 0xC5, 0x85, 0x80, 0x2A, 0x38, 0x34, 0xC8, 0xDA, 0xC4, 0x76,
-    0x46, 0xF3, 0xCC, 0x36, 0x3D, 0xAD, 0xFD, 0x0A, 0x92, 0xD3, 0x2E, 0x1F, 0x53, 0xB4, 0x11, 0xB7,
-    0x85, 0xB6, 0x82, 0x16, 0x4D, 0xF0, 0x15, 0x2F, 0xFD, 0x95, 0x9A, 0x67, 0x1E, 0x53, 0x26, 0xDF,
-    0x8D, 0xA3, 0x30, 0x63, 0xC8, 0xEF, 0xED, 0x82, 0xD0, 0xE1, 0x4F, 0x66, 0x36, 0x2B, 0x5C, 0x64,
-    0x67, 0x7E, 0x7E, 0xBC, 0xD4, 0xF2, 0xBB, 0x5D, 0xE2, 0x6D, 0xC9, 0x97, 0x4D, 0xB5, 0x88, 0xD3,
-    0xA1, 0x2E, 0xE7, 0xB3, 0xC8, 0xCD, 0x01, 0x00, 0x3D, 0x88, 0xAF, 0xE7, 0xD4, 0x2E, 0x62, 0xEC,
-    0x19, 0x7C, 0x41, 0x8E, 0x09, 0x4B, 0xFC, 0x98, 0x4A, 0x5B, 0xE5, 0xD3, 0xFA, 0x38, 0xC8, 0xFD,
-    0x45, 0xDD, 0xB3, 0xF8, 0x4A, 0x5E, 0xA4, 0x69, 0xDF, 0x87, 0xFE, 0x78, 0x79, 0x76, 0x5A, 0xF1,
-    0x53, 0x5A, 0xE2, 0x0C, 0x42, 0x07, 0x21, 0xB8, 0x17, 0x98, 0x9A, 0xDC, 0x23, 0x52, 0x88, 0x94,
-    0xFB, 0x5A, 0xA6, 0xF3, 0x82, 0x5B, 0x8F, 0x25, 0xB9, 0xC9, 0xFE, 0x2D, 0x55, 0x2D, 0xBA, 0xE6,
-    0x45, 0x0C, 0xE7, 0x43, 0x0F, 0x06, 0xCC, 0xE9, 0x4E, 0xC5, 0xC4, 0x71, 0x52, 0x30, 0x53, 0x20,
-    0x9F, 0xD1, 0xED, 0xEB, 0xAF, 0xE5, 0xC9, 0x8A, 0x42, 0x1D, 0x91, 0xCC, 0xEF, 0x8A, 0xB9, 0x72,
-    0xF4, 0x1D, 0x52, 0xA3, 0x78, 0xB8, 0x22, 0xED, 0x59, 0x9A, 0xE3, 0x27, 0xAD, 0xD8, 0x00, 0x98,
-    0xAB, 0xAA, 0xF8, 0xC9, 0x74, 0xE5, 0xD0, 0x2B, 0x00, 0x37, 0x50, 0xFB, 0x25, 0xAA, 0x38, 0xCF,
-    0x95, 0xEC, 0x19, 0x97, 0x44, 0x73, 0x0D, 0x72, 0x00, 0x03, 0x4A, 0x56, 0x9D, 0x93, 0x85, 0x68,
-    0x3D, 0x39, 0x97, 0x62, 0xE5, 0xA2, 0x72, 0x66, 0x84, 0x0D, 0xE2, 0xAD, 0xEF, 0xD9, 0x45, 0x7A,
-    0xC6, 0x72, 0xB1, 0xDA, 0x46, 0x85, 0x1E, 0x7E, 0x1D, 0x31, 0x2F, 0xC5, 0xFC, 0xD9, 0x1A, 0x60,
-    0x98, 0xDF, 0xCE, 0xE8, 0xDE, 0x4F, 0xE7, 0xB5, 0x3F, 0x37, 0x52, 0x89, 0x10, 0x86, 0xE1, 0xE2,
-    0x7E, 0xF2, 0x77, 0xE1, 0x37, 0x1F, 0xDF, 0xE7, 0xD3, 0x79, 0x9B, 0x3F, 0x51, 0xF7, 0x01, 0x2B,
-    0x25, 0xAF, 0x7D, 0x6F, 0x53, 0x1E, 0x3F, 0xEE, 0x07, 0x55, 0x20, 0xC6, 0x3E, 0x68, 0x9A, 0x5B,
-    0x30, 0x8E, 0xBE, 0xF5, 0x47, 0x7C, 0x57, 0x25, 0x3C, 0x18, 0xEE, 0x92, 0x8A, 0xB8, 0x8F, 0x1F,
-    0xE1, 0x38, 0xDB, 0x34, 0x2B, 0xC3, 0x8F, 0xB8, 0x04, 0xCB, 0xD9, 0x7D, 0x37, 0xCA, 0x9C, 0xB1,
-    0x2C, 0x89, 0xD8, 0xDC, 0xED, 0x7D, 0x88, 0x94, 0x7E, 0x66, 0x5F, 0xA6, 0xDB, 0xC6, 0xA7, 0xF6,
-    0x5D, 0x7C, 0xFA, 0x5D, 0x7D, 0x67, 0xE5, 0xBB, 0x48, 0x17, 0x0D, 0x22, 0x89, 0xFC, 0x8A, 0xC3,
-    0xE5, 0x9C, 0xF6, 0x9B, 0x81, 0xD8, 0x66, 0x56, 0x74, 0x34, 0xF6, 0x80, 0xFA, 0xB6, 0x59, 0xA4,
-    0xA3, 0x8C, 0x1A, 0x68, 0x3A, 0xBF, 0xA9, 0xFA, 0x17, 0x92, 0xDC, 0xCC, 0xB5, 0x00, 0xCF, 0x30,
-    0x74, 0xCC, 0x66, 0xEF, 0xCF, 0xF5, 0xB7, 0xF7, 0xF1, 0xE3, 0x31, 0x43, 0xC7, 0xE9, 0xB6, 0xD0,
-    0xF1, 0x81, 0x76, 0xC3, 0x8B, 0x33, 0xB0, 0x1A, 0x28, 0xBE, 0x66, 0xF3, 0x6D, 0xDF, 0xEC, 0x74,
-    0xEF, 0xF3, 0xCD, 0x4E, 0x6F, 0x2C, 0x1E, 0x8E, 0x48, 0x12, 0x4E, 0x48, 0xE7, 0x7E, 0xFB, 0xCD,
-    0x4E, 0x57, 0x7F, 0xB3, 0x33, 0x6A, 0xBF, 0xD9, 0x19, 0xF0, 0xBB, 0xD4, 0x5B, 0xDF, 0xEC, 0x64,
-    0x8B, 0xFB, 0x32, 0x34, 0x09, 0x30, 0x40, 0xC6, 0x46, 0x99, 0xB7, 0xD8, 0x55, 0x7E, 0xB6, 0x95,
-    0xC1, 0xA6, 0x82, 0x6B, 0x39, 0xE8, 0x95, 0x59, 0x60, 0x66, 0x1A, 0x17, 0x57, 0xFB, 0x4C, 0x92,
-    0x81, 0x10, 0x5C, 0xF8, 0xBF, 0xAD, 0x57, 0x3D, 0x6C, 0x1C, 0xC7, 0x15, 0x7E, 0xBB, 0x4B, 0x71,
-    0x13, 0x2F, 0xA4, 0x51, 0x71, 0x02, 0x94, 0xD8, 0xD2, 0x36, 0x2A, 0x04, 0x86, 0xBA, 0x4B, 0xE1,
-    0x82, 0x08, 0xEE, 0x6E, 0x37, 0x16, 0x10, 0x03, 0x49, 0x21, 0x22, 0x08, 0xAB, 0x14, 0x56, 0xCD,
-    0x00, 0x49, 0x0A, 0x16, 0x34, 0x70, 0xC7, 0x5B, 0x89, 0x85, 0x0A, 0x17, 0x61, 0x95, 0x94, 0x91,
-    0x91, 0x00, 0x91, 0x2E, 0x80, 0xAC, 0x42, 0xC5, 0xC1, 0xE1, 0xF1, 0x86, 0x12, 0x02, 0x16, 0x2E,
-    0xB2, 0xB4, 0x60, 0xA4, 0x48, 0xE1, 0x89, 0x65, 0x24, 0x88, 0x05, 0x84, 0x43, 0x63, 0x15, 0xAC,
-    0xE4, 0xBD, 0x9B, 0x7C, 0x6F, 0x76, 0x45, 0x51, 0xB6, 0x64, 0x9D, 0x00, 0xCF, 0x70, 0x6E, 0x86,
-    0xF3, 0xE6, 0xCD, 0xCC, 0xFB, 0xFB, 0xDE, 0x2C, 0x91, 0x93, 0x90, 0x5A, 0x1E, 0xBC, 0x3F, 0xB8,
-    0xAA, 0xDE, 0x4D, 0xAE, 0xD2, 0x8B, 0x2B, 0x91, 0x1B, 0x07, 0x54, 0xBF, 0x5E, 0xBF, 0x11, 0xBC,
-    0xE2, 0xFE, 0x98, 0x5E, 0x79, 0x71, 0x35, 0x85, 0x29, 0x96, 0x7E, 0x56, 0xFE, 0x2E, 0xF7, 0xFB,
-    0x7F, 0x32, 0xC6, 0x7C, 0xD6, 0xEF, 0xF7, 0x63, 0xF4, 0x3D, 0x63, 0x3E, 0x5A, 0x5A, 0x5A, 0x34,
-    0x87, 0xCB, 0x83, 0x25, 0x5B, 0xE2, 0x67, 0x4E, 0x12, 0x79, 0xB2, 0xD5, 0xF4, 0xEE, 0x7E, 0x03,
-    0x3F, 0x64, 0x8B, 0x67, 0x4C, 0x31, 0xD7, 0xEF, 0x27, 0x18, 0x9E, 0x58, 0x5A, 0x3A, 0x8F, 0xFF,
-    0xD0, 0xC5, 0xFE, 0xE5, 0x54, 0x6F, 0x46, 0xE2, 0x9D, 0x74, 0x51, 0x5C, 0xF9, 0x50, 0x17, 0x2D,
-    0xE1, 0x27, 0x71, 0x20, 0x0B, 0x91, 0x64, 0xA1, 0xAB, 0x9A, 0x4E, 0xDC, 0x0D, 0xD7, 0xD5, 0x66,
-    0xE8, 0xA5, 0xAB, 0x33, 0x7E, 0xA2, 0xCF, 0xF9, 0x52, 0xB7, 0x03, 0x99, 0x45, 0x81, 0xCC, 0xA3,
-    0x20, 0x2D, 0x8E, 0x38, 0xB1, 0xB8, 0xAC, 0xBB, 0xE2, 0xB6, 0x6E, 0x8B, 0x6D, 0xDD, 0x0A, 0xA4,
-    0x6E, 0x61, 0xD5, 0x8C, 0x43, 0xC1, 0x76, 0x16, 0xF9, 0x69, 0xDE, 0x40, 0x03, 0xEF, 0x20, 0xF4,
-    0xE4, 0xE0, 0x08, 0xC5, 0x5D, 0x71, 0x29, 0x8B, 0x3C, 0xB5, 0x09, 0x2A, 0x66, 0x5B, 0x41, 0xB2,
-    0x2A, 0x28, 0xAE, 0xF1, 0xDD, 0x44, 0x42, 0x9E, 0x22, 0xCA, 0x88, 0xCE, 0x11, 0x05, 0xE4, 0xFE,
-    0xF6, 0xA3, 0xAB, 0xB8, 0xDF, 0x0F, 0x6E, 0xFC, 0x99, 0x7C, 0x58, 0x41, 0x12, 0xDD, 0x2C, 0x29,
-    0x31, 0xB9, 0x29, 0xD1, 0x2D, 0xA2, 0xD6, 0x01, 0x4F, 0x4E, 0xD4, 0x2E, 0xFF, 0xD1, 0x56, 0x4C,
-    0x21, 0xED, 0xF4, 0xC0, 0x32, 0xF8, 0xB1, 0x6F, 0xCC, 0x3E, 0xB6, 0xA2, 0x53, 0x96, 0x9B, 0x29,
-    0x85, 0x65, 0x08, 0x12, 0xDE, 0x6A, 0x71, 0xA5, 0x06, 0xC3, 0x84, 0x7B, 0xEF, 0x49, 0xA7, 0xDC,
-    0xB7, 0xFE, 0x78, 0x2B, 0x87, 0x46, 0x57, 0xCC, 0xAF, 0x26, 0xA3, 0x47, 0xE6, 0xDF, 0xC6, 0xC7,
-    0xBD, 0x8E, 0x32, 0xAF, 0x49, 0xA2, 0xB1, 0x30, 0xEB, 0x26, 0x1E, 0xD3, 0x02, 0x9F, 0x55, 0x0B,
-    0x3F, 0xD8, 0x2F, 0x66, 0xA8, 0x46, 0x67, 0xB6, 0x68, 0x3C, 0xA1, 0xC9, 0x90, 0xC6, 0x35, 0x3A,
-    0x8E, 0x7F, 0xE9, 0xA7, 0xB9, 0xA7, 0x7D, 0xA3, 0xC2, 0xB4, 0xB1, 0x17, 0x47, 0xB4, 0x86, 0x59,
-    0x5A, 0xAC, 0x6D, 0x4D, 0x86, 0xB5, 0xE5, 0x6B, 0xEF, 0x5F, 0x9B, 0xC6, 0xF9, 0xB8, 0xCE, 0x5D,
-    0x9F, 0xBB, 0x31, 0x8D, 0xDB, 0xD9, 0x4A, 0xBD, 0xF1, 0x93, 0xEA, 0x26, 0x2F, 0xAE, 0xCC, 0xF1,
-    0x6B, 0x2A, 0xEB, 0xF4, 0x1C, 0x50, 0x84, 0xAD, 0xD3, 0x72, 0x94, 0x25, 0xC8, 0xC9, 0x81, 0xEA,
-    0x29, 0x1C, 0x91, 0x07, 0x45, 0x53, 0x4B, 0xC4, 0x01, 0x13, 0x3B, 0x7E, 0x22, 0x98, 0xBE, 0xEA,
-    0xC9, 0x3A, 0xF7, 0x03, 0x4F, 0x36, 0xAB, 0x7E, 0x50, 0xF6, 0xDB, 0xBA, 0xA4, 0xDF, 0xD9, 0x1D,
-    0xD0, 0xAB, 0x1B, 0x4D, 0xFF, 0xCA, 0x8E, 0x89, 0x7B, 0x59, 0x4B, 0x5C, 0xB8, 0xF0, 0xA6, 0xCC,
-    0x3A, 0xA1, 0xA9, 0x9F, 0xF6, 0x76, 0xE1, 0x97, 0x79, 0xF3, 0x9C, 0xF3, 0x89, 0x3A, 0x0D, 0x8E,
-    0x96, 0xF3, 0x79, 0x1A, 0x12, 0x69, 0xEE, 0x05, 0xB9, 0xAA, 0xEC, 0x7D, 0xC9, 0xF4, 0x90, 0x44,
-    0x5C, 0x77, 0xFF, 0xA9, 0xEA, 0x84, 0x91, 0x07, 0x6F, 0x85, 0x1F, 0x89, 0x3D, 0xB9, 0x55, 0xC0,
-    0x5D, 0x3C, 0x43, 0x0D, 0x7B, 0xD6, 0x71, 0xD8, 0xFE, 0x50, 0x69, 0x28, 0x04, 0xA2, 0x1D, 0xB9,
-    0x46, 0x53, 0x15, 0x4B, 0xE2, 0xBC, 0x72, 0x4A, 0x77, 0x83, 0x08, 0x52, 0xC4, 0x25, 0x5D, 0x09,
-    0xEA, 0x54, 0xF2, 0x26, 0xCD, 0x8A, 0x09, 0x1E, 0xA5, 0xEB, 0xD5, 0x56, 0x90, 0xAA, 0x62, 0xC2,
-    0xD2, 0xE0, 0xF2, 0xA7, 0x34, 0x97, 0x38, 0x03, 0x5F, 0x76, 0x9A, 0x51, 0xE1, 0x19, 0xD9, 0x28,
-    0xC4, 0xFA, 0xDD, 0xBB, 0xFB, 0x59, 0xE3, 0xAD, 0x4B, 0xD9, 0x66, 0x68, 0x42, 0xE1, 0xE8, 0x4C,
-    0x70, 0x1C, 0xAA, 0xAC, 0xE3, 0xDD, 0x91, 0xAD, 0x96, 0xAB, 0xC8, 0xBF, 0xAD, 0xC4, 0x5B, 0x94,
-    0x69, 0x28, 0xAF, 0x19, 0x24, 0xAD, 0x8E, 0x77, 0x0F, 0x7A, 0x73, 0x21, 0xCF, 0x03, 0x2D, 0x2E,
-    0x40, 0x08, 0x5C, 0x80, 0x97, 0x36, 0xB1, 0x74, 0xE0, 0xE8, 0x50, 0x10, 0xB6, 0x88, 0x3D, 0x89,
-    0x10, 0xAC, 0x07, 0xB7, 0x75, 0x07, 0x21, 0xE1, 0xEF, 0xC9, 0xDE, 0xD0, 0xFB, 0x82, 0xAF, 0x1F,
-    0x8C, 0xA9, 0xA7, 0xFC, 0x09, 0xDF, 0x07, 0x12, 0x23, 0x0E, 0x21, 0x86, 0x16, 0x49, 0xC7, 0x83,
-    0xFE, 0xB4, 0x9F, 0x9C, 0x64, 0x25, 0x22, 0x5A, 0x11, 0xF3, 0xE2, 0x0D, 0x85, 0x10, 0x6E, 0x06,
-    0xF1, 0xEA, 0x31, 0xBA, 0x68, 0xE7, 0x45, 0x9C, 0x37, 0x02, 0xD9, 0x11, 0x1C, 0xC6, 0x97, 0x99,
-    0xA8, 0x85, 0x9B, 0xDE, 0xF2, 0x13, 0x40, 0x46, 0x82, 0x15, 0x1D, 0xCA, 0x1D, 0xED, 0x2A, 0x4F,
-    0xB2, 0x7D, 0xBF, 0xDD, 0xA9, 0x53, 0x5B, 0xC4, 0x61, 0x20, 0x83, 0xF5, 0x14, 0x06, 0x75, 0xD4,
-    0x2D, 0xD2, 0x4D, 0x3A, 0x73, 0xB2, 0x53, 0x17, 0xB1, 0x58, 0xDF, 0xD5, 0x8E, 0xDE, 0x6C, 0x53,
-    0x5D, 0x9C, 0x97, 0x20, 0x0E, 0x68, 0xF5, 0x9C, 0x80, 0x71, 0xB6, 0x15, 0x6D, 0x5C, 0x3C, 0x0B,
-    0x63, 0x10, 0x1C, 0x62, 0x48, 0xB4, 0x47, 0xEE, 0x4E, 0xEC, 0xAD, 0xCB, 0xC0, 0x49, 0x8F, 0x91,
-    0x9E, 0xA7, 0x95, 0x05, 0x10, 0x8E, 0x7B, 0x2A, 0x72, 0x75, 0xF8, 0xC3, 0x2C, 0x90, 0x42, 0x8A,
-    0x24, 0x8C, 0xC3, 0x18, 0x41, 0x7F, 0xDC, 0xD5, 0x9E, 0xF6, 0x94, 0xAF, 0xFC, 0x54, 0xC8, 0x22,
-    0x90, 0x5D, 0x8F, 0x1D, 0xA3, 0x2A, 0x31, 0x40, 0x66, 0xA6, 0x45, 0x61, 0xE2, 0xED, 0x66, 0x4E,
-    0x46, 0xB9, 0x9F, 0x3A, 0x80, 0x83, 0x30, 0xE6, 0xB0, 0xEF, 0x72, 0x8C, 0xF3, 0x24, 0x80, 0x23,
-    0x6D, 0xB3, 0xBB, 0x5E, 0x48, 0x60, 0xF1, 0x9E, 0xF2, 0xEE, 0x2B, 0xA7, 0xA0, 0xA8, 0x4B, 0x51,
-    0xEA, 0xED, 0xC7, 0xE2, 0xF7, 0xF1, 0x0C, 0x56, 0x76, 0xB1, 0x20, 0xC7, 0x6A, 0xB0, 0xFB, 0x29,
-    0xB3, 0x87, 0x31, 0xC3, 0x4B, 0x17, 0xEC, 0xD8, 0x19, 0x7B, 0x26, 0xFE, 0x76, 0xE2, 0xE4, 0x04,
-    0x7D, 0x1D, 0xC1, 0xD2, 0xA1, 0xF7, 0x79, 0x26, 0x3E, 0x48, 0xA3, 0x30, 0x2E, 0xBA, 0xEE, 0xBE,
-    0x0E, 0x76, 0x64, 0x23, 0xA4, 0xCD, 0xA6, 0xAB, 0xB5, 0xBF, 0x2E, 0x4F, 0x0B, 0x5A, 0x6D, 0x3A,
-    0x8A, 0x87, 0x47, 0xCB, 0x7B, 0x2E, 0xBA, 0x3F, 0x51, 0x51, 0x94, 0x8C, 0x87, 0x9E, 0x5E, 0x74,
-    0x4A, 0xEF, 0xCB, 0x80, 0xE0, 0xC9, 0xEF, 0x76, 0x33, 0xCA, 0x1A, 0x04, 0xF7, 0x82, 0x71, 0x3D,
-    0xD9, 0x21, 0xDD, 0xA6, 0x66, 0x44, 0x22, 0x22, 0x0F, 0x96, 0xC4, 0x5F, 0x64, 0x11, 0x8C, 0x61,
-    0xF2, 0xA0, 0xB0, 0x54, 0x85, 0xA5, 0x54, 0x9E, 0x1D, 0x19, 0x33, 0xE1, 0x66, 0x89, 0x68, 0xAF,
-    0x41, 0xC7, 0x5E, 0x82, 0xCB, 0x6B, 0x44, 0x67, 0x87, 0xC4, 0x67, 0x5B, 0x44, 0xAF, 0x4E, 0x4A,
-    0xAF, 0x26, 0xC7, 0x7C, 0x4A, 0xCE, 0xE4, 0xE7, 0x1A, 0x04, 0x5F, 0x1E, 0x23, 0x0E, 0x1C, 0xA2,
-    0x85, 0xEF, 0x13, 0xE7, 0x53, 0x5B, 0x2E, 0x72, 0x80, 0x9C, 0x62, 0x8C, 0xF6, 0x12, 0x9A, 0x27,
-    0x82, 0x9B, 0xC6, 0x30, 0x0E, 0x10, 0x55, 0xB0, 0x72, 0xDC, 0x82, 0x8E, 0xBD, 0x4E, 0x37, 0xB5,
-    0xB7, 0x9D, 0x9E, 0xF2, 0x12, 0x1D, 0xF8, 0xF1, 0xB1, 0xC3, 0xF1, 0xC5, 0xDA, 0xB6, 0xA5, 0x5D,
-    0xF5, 0x55, 0x34, 0x95, 0x40, 0x81, 0x6E, 0xE3, 0x66, 0xA3, 0xBC, 0xC6, 0xC4, 0xD8, 0x90, 0xFA,
-    0x9E, 0x99, 0x5C, 0x2D, 0x83, 0xAC, 0x0A, 0x26, 0xFF, 0xE3, 0x8A, 0xE1, 0x9E, 0x2A, 0x7B, 0xDD,
-    0x2D, 0x2F, 0x9E, 0x8B, 0x32, 0x06, 0xBF, 0x55, 0xDE, 0x34, 0x2F, 0x13, 0x8D, 0x8D, 0x61, 0xB6,
-    0x94, 0x3D, 0x28, 0xAB, 0x0E, 0x6A, 0xE1, 0xF2, 0x37, 0xBF, 0x4B, 0x0B, 0x81, 0xF3, 0xAE, 0xD9,
-    0x32, 0x32, 0xFC, 0x62, 0xAF, 0x40, 0x66, 0x50, 0x48, 0x1F, 0xA6, 0x3C, 0x68, 0x84, 0x83, 0xFE,
-    0xCB, 0xD7, 0xD4, 0x38, 0x08, 0x1C, 0x6D, 0x48, 0xA6, 0x37, 0x81, 0x0F, 0x41, 0x6A, 0x0F, 0x0A,
-    0x93, 0x82, 0x5E, 0x03, 0xE2, 0x39, 0xE9, 0xD9, 0x03, 0xD1, 0xCA, 0x97, 0x00, 0x59, 0x1F, 0xE6,
-    0x8C, 0xC4, 0x98, 0xC1, 0xA7, 0x31, 0xF6, 0x31, 0xEE, 0x9D, 0x63, 0xFC, 0x40, 0xD3, 0x8C, 0x08,
-    0x64, 0x71, 0x86, 0x2F, 0x15, 0x3E, 0xE1, 0xA0, 0x8A, 0xC3, 0xAF, 0x38, 0xEA, 0x15, 0x07, 0xF2,
-    0xD2, 0xFD, 0xA4, 0x4E, 0x03, 0x57, 0x05, 0x4F, 0xBA, 0x67, 0x4C, 0x36, 0x96, 0x46, 0x0F, 0xFB,
-    0x1B, 0x51, 0x11, 0x8D, 0x4F, 0x74, 0xA9, 0xF5, 0xA5, 0xDA, 0xE5, 0x54, 0xF1, 0x95, 0xD9, 0xD6,
-    0x89, 0x61, 0x34, 0x9E, 0xBB, 0x56, 0x01, 0x95, 0xC9, 0x1C, 0x93, 0x43, 0x0B, 0xEB, 0xC6, 0xC8,
-    0xCC, 0xCF, 0x1E, 0xCE, 0x96, 0xF9, 0x16, 0x26, 0x09, 0x24, 0xFC, 0x01, 0x3A, 0xB0, 0x52, 0x61,
-    0x76, 0x93, 0x7D, 0x9F, 0x69, 0x6B, 0xD6, 0xD5, 0xE0, 0x42, 0x3D, 0xFB, 0xBB, 0xF6, 0x78, 0xBE,
-    0x6E, 0x25, 0x13, 0x56, 0x7C, 0x88, 0xFA, 0x94, 0x8B, 0x92, 0x0D, 0x92, 0x59, 0x08, 0xAA, 0x39,
-    0xFB, 0xC2, 0x67, 0x9C, 0xB1, 0xDD, 0x20, 0xB2, 0x84, 0xC7, 0x88, 0x3C, 0x1A, 0xD3, 0xB0, 0x67,
-    0xF2, 0xE0, 0x6E, 0x1A, 0xA6, 0x00, 0x85, 0x76, 0x90, 0xE2, 0x02, 0xD0, 0x47, 0xC3, 0xE7, 0xAC,
-    0x8F, 0x41, 0xD7, 0x67, 0x4B, 0x74, 0x28, 0x00, 0xF6, 0xB8, 0x39, 0xB4, 0x88, 0x98, 0x96, 0x8C,
-    0x96, 0x50, 0x24, 0x87, 0x4C, 0x99, 0xB7, 0xAB, 0x10, 0x23, 0x27, 0x0E, 0x25, 0x8D, 0x71, 0x98,
-    0x50, 0x18, 0x0C, 0xED, 0x8C, 0xF5, 0xAC, 0x34, 0x34, 0xF1, 0x50, 0x18, 0x13, 0xA4, 0x10, 0x18,
-    0xB7, 0x0F, 0x76, 0x70, 0xD9, 0x0E, 0xF6, 0xF7, 0x77, 0x60, 0xA3, 0x4D, 0x0C, 0xC2, 0x75, 0x88,
-    0x0F, 0x14, 0x73, 0x0A, 0x88, 0xB2, 0x86, 0xFD, 0x45, 0xE2, 0x49, 0x68, 0xA2, 0x09, 0xA3, 0xE2,
-    0xE8, 0x43, 0xB2, 0xD5, 0x80, 0x00, 0xB8, 0x8E, 0x46, 0x70, 0xF6, 0xB0, 0x33, 0x06, 0x35, 0x9A,
-    0x21, 0xC2, 0xBB, 0xF0, 0x0F, 0x70, 0xAE, 0xBF, 0x2E, 0x2D, 0xAD, 0x95, 0x8E, 0xC1, 0x96, 0xDF,
-    0x64, 0xE4, 0xB1, 0xCA, 0x72, 0xAB, 0x99, 0xE2, 0xA9, 0x99, 0xB0, 0x9C, 0xE1, 0xD2, 0x33, 0x93,
-    0xF8, 0xED, 0x9E, 0x49, 0x57, 0x1A, 0x46, 0xA3, 0xE5, 0x68, 0xC5, 0x73, 0x1A, 0xD3, 0x32, 0x34,
-    0x85, 0x96, 0xAC, 0xCC, 0x2F, 0xD2, 0x0A, 0xA2, 0x74, 0x9A, 0x76, 0x06, 0xD8, 0x45, 0xCB, 0xFD,
-    0x6B, 0xFC, 0x74, 0x14, 0xE6, 0x61, 0x07, 0xDB, 0xCC, 0x47, 0x68, 0xBD, 0x67, 0xB4, 0xA8, 0x6A,
-    0x21, 0x5A, 0xC0, 0x2F, 0xAE, 0x91, 0x29, 0x96, 0xFB, 0x7F, 0xC4, 0x3D, 0x4D, 0x82, 0x7B, 0xAA,
-    0x15, 0x10, 0xD1, 0x72, 0xB4, 0xE2, 0x39, 0x8D, 0xE9, 0x1A, 0xEB, 0x65, 0xCF, 0x3C, 0x2C, 0x23,
-    0x38, 0x2B, 0x83, 0x81, 0x75, 0x41, 0xFE, 0x86, 0xFE, 0xE5, 0x68, 0xCF, 0xFC, 0x6B, 0x64, 0xFE,
-    0x43, 0x91, 0xA4, 0x60, 0x8B, 0x9C, 0xFD, 0x8C, 0x22, 0x21, 0x83, 0x74, 0x8D, 0x4E, 0xBA, 0x31,
-    0xF4, 0x34, 0x0A, 0x74, 0xEB, 0xB0, 0x4B, 0x39, 0x71, 0xDB, 0xD3, 0x0D, 0x42, 0x0E, 0x5C, 0xF5,
-    0x92, 0xE9, 0xC0, 0xEC, 0x9B, 0x2B, 0x2F, 0x02, 0xD6, 0x97, 0x13, 0xAE, 0x2A, 0x70, 0x00, 0xEB,
-    0x2B, 0x96, 0xEF, 0x6D, 0x31, 0x7B, 0x7F, 0x62, 0x26, 0xBF, 0x30, 0x93, 0x0D, 0x0F, 0x5E, 0xF1,
-    0x17, 0x45, 0x21, 0x72, 0x90, 0x2E, 0x68, 0xE8, 0x2B, 0x27, 0x39, 0x63, 0xCF, 0x70, 0xFF, 0xA1,
-    0x44, 0x23, 0x1E, 0xD4, 0x70, 0x7E, 0xC8, 0x88, 0x02, 0x79, 0x43, 0x46, 0x3D, 0xC4, 0x49, 0x9D,
-    0xF7, 0x40, 0xDF, 0xE2, 0xDE, 0xC6, 0x08, 0xB6, 0x16, 0x71, 0xB7, 0xE9, 0x3E, 0x52, 0xEC, 0x73,
-    0xE4, 0x8C, 0x36, 0xE0, 0x76, 0x88, 0x7C, 0xE8, 0xEC, 0x9E, 0x9A, 0x35, 0x0F, 0x7F, 0xB4, 0x9F,
-    0x42, 0x83, 0x46, 0x5F, 0x04, 0x6D, 0x19, 0x34, 0x07, 0xD8, 0xE6, 0x9B, 0x9C, 0xDC, 0x6C, 0x36,
-    0xC3, 0xEB, 0xD9, 0x4D, 0xF9, 0x95, 0xCD, 0x9A, 0x6E, 0x1E, 0xB7, 0xA9, 0x96, 0x95, 0x8A, 0xD7,
-    0xBB, 0xF7, 0x86, 0x54, 0xDE, 0x87, 0x77, 0x14, 0xFD, 0xEF, 0x6F, 0x09, 0x45, 0xC8, 0x3A, 0xE1,
-    0xD8, 0xA6, 0xA0, 0xB9, 0xF7, 0x26, 0xD7, 0x29, 0x42, 0x9C, 0x3F, 0xFA, 0x38, 0xF6, 0x3E, 0xD9,
-    0x49, 0xFD, 0xCB, 0x78, 0x1C, 0xF0, 0x6B, 0xDF, 0x95, 0x4F, 0xD4, 0x88, 0x10, 0xF7, 0x72, 0xFB,
-    0x04, 0xF8, 0xAA, 0x86, 0xCB, 0xBC, 0xB6, 0x46, 0x4F, 0xBF, 0xD8, 0x0E, 0x0A, 0xC2, 0x34, 0x4A,
-    0x78, 0x03, 0x04, 0xB6, 0xEE, 0x84, 0xBE, 0x6C, 0x8B, 0x75, 0x95, 0xFB, 0xDB, 0x18, 0x13, 0x9E,
-    0x90, 0xE7, 0xD3, 0xD0, 0xDF, 0x56, 0x78, 0x7A, 0xEA, 0x26, 0xD2, 0xEF, 0x69, 0xFF, 0x52, 0x3A,
-    0xEB, 0x26, 0x57, 0x0F, 0xD0, 0xDB, 0xCD, 0x6C, 0xAA, 0x64, 0xD5, 0xBB, 0x7A, 0x0A, 0x7B, 0xB3,
-    0xE7, 0x05, 0x3B, 0xBC, 0x72, 0xBC, 0xC6, 0xC3, 0xDD, 0xD8, 0x3E, 0x26, 0xBF, 0xAE, 0x94, 0x6F,
-    0xC8, 0xF2, 0x88, 0xAC, 0xC2, 0xC0, 0x03, 0xD1, 0x00, 0x66, 0x3D, 0xDE, 0xC7, 0x66, 0xB5, 0xEE,
-    0xD7, 0x9F, 0x6D, 0xFD, 0xA3, 0xC1, 0xBF, 0x5E, 0x5E, 0xB9, 0xC9, 0x8B, 0xFD, 0x93, 0x4D, 0xBC,
-    0xC9, 0x47, 0x88, 0xBF, 0xF3, 0x3D, 0x8A, 0x9A, 0x8D, 0x18, 0x6A, 0xF7, 0xD6, 0x6A, 0x4F, 0x2D,
-    0x9C, 0x69, 0xF7, 0xDA, 0x33, 0x25, 0x5C, 0x33, 0xF6, 0x00, 0x91, 0x69, 0xF6, 0x39, 0xFB, 0x33,
-    0x54, 0xBF, 0x09, 0xF8, 0x7E, 0x80, 0x85, 0x93, 0x76, 0xE9, 0xDF, 0xCF, 0x2A, 0x33, 0xE5, 0x87,
-    0x5A, 0xF9, 0xCD, 0x56, 0x54, 0x13, 0xA5, 0xF4, 0xAE, 0xA2, 0x2A, 0xCF, 0xE1, 0xC1, 0x8B, 0xCF,
-    0x04, 0x55, 0x07, 0x3E, 0x6F, 0xB9, 0x2A, 0xC4, 0xE7, 0x44, 0x9D, 0xBF, 0xCA, 0x9F, 0x2C, 0xB0,
-    0xC3, 0xE5, 0xFE, 0xA8, 0xDF, 0xFF, 0x0D, 0x7F, 0x39, 0x17, 0x7D, 0x1E, 0x26, 0x5F, 0x5E, 0xE0,
-    0xC4, 0x75, 0xD8, 0x7F, 0xCD, 0x55, 0x0D, 0xDE, 0x0C, 0xFA, 0xC1, 0xBE, 0xE1, 0xE1, 0x05, 0x44,
-    0xDF, 0x61, 0x4B, 0x0D, 0x27, 0x5B, 0x67, 0xAC, 0xD7, 0x4C, 0x26, 0xF6, 0x15, 0x6F, 0x3F, 0xD7,
-    0x68, 0x38, 0x99, 0x20, 0x65, 0xE0, 0xF7, 0x2C, 0xD5, 0xB0, 0x82, 0x3F, 0xF5, 0x78, 0xFA, 0xD0,
-    0x17, 0xD3, 0x4B, 0x7C, 0x6D, 0x1D, 0x2D, 0xEB, 0xB4, 0x1C, 0x51, 0xD1, 0xC8, 0x85, 0xF6, 0x53,
-    0xE4, 0x93, 0x64, 0x3A, 0x0E, 0x07, 0x8F, 0x7D, 0xBC, 0x7A, 0x75, 0x23, 0x8F, 0x8A, 0xE9, 0x38,
-    0xDC, 0x24, 0x50, 0x0B, 0xF3, 0x0B, 0xF3, 0x36, 0x61, 0x4E, 0x27, 0x47, 0xF2, 0x72, 0x92, 0xFF,
-    0x1F, 0xED, 0x53, 0xCF, 0x6B, 0x13, 0x41, 0x14, 0xFE, 0x66, 0x06, 0x76, 0xB1, 0x0B, 0x5D, 0x4F,
-    0x22, 0x98, 0xED, 0x0F, 0xE8, 0x49, 0x36, 0xE9, 0xA5, 0x87, 0x28, 0x9B, 0xB0, 0x3D, 0x79, 0x50,
-    0x50, 0x84, 0xE8, 0xA1, 0x94, 0xFC, 0x03, 0x42, 0x2D, 0x6C, 0xA5, 0xD8, 0x60, 0xA6, 0x7A, 0xC8,
-    0x55, 0xF0, 0xE8, 0xC5, 0x6B, 0x13, 0xA1, 0x97, 0x1E, 0xAA, 0xA8, 0x99, 0xB6, 0x87, 0x1C, 0x3C,
-    0xB8, 0x06, 0x24, 0x27, 0x31, 0xD2, 0x42, 0x6B, 0x4F, 0x73, 0xD8, 0xC0, 0x36, 0x36, 0x19, 0x67,
-    0x0A, 0x56, 0x51, 0x44, 0xFF, 0x00, 0x99, 0x99, 0xF7, 0x1E, 0xCC, 0xCC, 0xF7, 0xBD, 0xF7, 0xBD,
-    0x19, 0x9A, 0x42, 0xC9, 0x9C, 0xB3, 0x23, 0x82, 0x0A, 0xED, 0xF0, 0xDC, 0x32, 0xD9, 0xE7, 0x63,
-    0x15, 0xBA, 0x2B, 0x0A, 0x45, 0x7B, 0x4B, 0x25, 0xF6, 0x00, 0x00, 0x69, 0x63, 0xB1, 0x33, 0xBF,
-    0xD4, 0x99, 0x8F, 0x38, 0x46, 0xC0, 0x24, 0x9A, 0x18, 0x95, 0xEC, 0x1D, 0x36, 0xE4, 0x98, 0xCB,
-    0x84, 0x7C, 0xB3, 0xDE, 0x50, 0x0A, 0x2E, 0x20, 0xB5, 0x19, 0xA9, 0xCF, 0xAA, 0x34, 0x0B, 0x2A,
-    0xE0, 0x83, 0xA9, 0x38, 0xD7, 0xE4, 0xA8, 0x80, 0xC5, 0x28, 0x9C, 0x65, 0x3B, 0x87, 0xE9, 0xB4,
-    0x81, 0x43, 0x33, 0xAC, 0xA6, 0x6E, 0x48, 0x63, 0x04, 0xB0, 0xD7, 0x93, 0xEA, 0xD3, 0x96, 0xD0,
-    0xB4, 0xBB, 0x62, 0xAC, 0xC0, 0xE2, 0xFE, 0x31, 0x1B, 0xEA, 0x13, 0x17, 0xEB, 0x4F, 0xD4, 0x00,
-    0x4C, 0x60, 0x59, 0x43, 0x12, 0x89, 0x82, 0x89, 0x37, 0x74, 0x4C, 0xBB, 0xE6, 0x12, 0x07, 0x3D,
-    0x82, 0x4A, 0x0A, 0x4C, 0x67, 0x9D, 0xB3, 0xC5, 0x50, 0xDA, 0x43, 0xD2, 0x4B, 0x03, 0xD6, 0xE1,
-    0xD9, 0x80, 0xB5, 0xFB, 0xC7, 0x8E, 0xC1, 0xB0, 0x52, 0xA2, 0x92, 0xC0, 0x6E, 0xF1, 0xAC, 0xA9,
-    0x29, 0x57, 0x9C, 0xFB, 0xAC, 0x3E, 0x92, 0x9B, 0x86, 0xD4, 0x59, 0x6D, 0xC8, 0xF1, 0xC4, 0x14,
-    0x06, 0xC6, 0xCD, 0x50, 0xEA, 0xF6, 0x07, 0xE3, 0x69, 0x08, 0x28, 0x55, 0x2A, 0xD5, 0xEB, 0x4A,
-    0x23, 0x94, 0x4A, 0xBA, 0x2C, 0x90, 0x30, 0xEF, 0x92, 0xAE, 0xCF, 0x44, 0xC0, 0x78, 0x9E, 0xF1,
-    0x80, 0x89, 0x2C, 0xBA, 0x8E, 0x46, 0xC1, 0x0D, 0x97, 0xC4, 0x81, 0x43, 0xE2, 0xBC, 0x16, 0xA1,
-    0x9B, 0xF7, 0x1C, 0xB6, 0xFD, 0xBE, 0x0B, 0x2C, 0x0E, 0xED, 0xDE, 0x66, 0x85, 0xB6, 0xC2, 0x4C,
-    0x44, 0x7E, 0x98, 0x6D, 0x9C, 0xA7, 0xFF, 0x20, 0xF4, 0xB3, 0x66, 0xF1, 0xEB, 0x75, 0x48, 0xF7,
-    0xA7, 0x69, 0xA5, 0xAE, 0x6A, 0xF3, 0x57, 0xBA, 0x76, 0x26, 0x68, 0x4C, 0xE4, 0xE9, 0x50, 0xAA,
-    0xAA, 0x84, 0x73, 0xC4, 0x54, 0x32, 0x65, 0x0B, 0xA3, 0x8A, 0x38, 0x27, 0x9D, 0x01, 0xC8, 0xF1,
-    0x89, 0xDC, 0x60, 0x6F, 0xBF, 0xCB, 0xFD, 0xBF, 0x65, 0x7F, 0x69, 0x19, 0x59, 0x43, 0x3F, 0x35,
-    0xE9, 0xFA, 0xB4, 0xB9, 0xD5, 0xBB, 0x13, 0xD0, 0x1D, 0x1E, 0x14, 0xCA, 0xA2, 0x79, 0xCD, 0xDA,
-    0x73, 0x1A, 0xB5, 0xF0, 0x9E, 0x18, 0x55, 0xEA, 0x75, 0xA9, 0x0C, 0x12, 0xA3, 0x78, 0x6B, 0x56,
-    0x71, 0x6B, 0x8F, 0xF6, 0xE5, 0xB2, 0x56, 0xD3, 0x97, 0xE4, 0x13, 0x3C, 0x49, 0x3A, 0x61, 0x50,
-    0x2C, 0x87, 0x55, 0x3E, 0x45, 0x1E, 0x8A, 0xBC, 0xEB, 0xE2, 0xB2, 0x20, 0x09, 0xC6, 0x43, 0xF6,
-    0x1C, 0x52, 0xFA, 0xAC, 0x16, 0x7A, 0xD6, 0x01, 0x3D, 0x4C, 0x0C, 0x83, 0x07, 0xB2, 0xAB, 0x86,
-    0x01, 0xDA, 0xC2, 0x77, 0xE7, 0xF8, 0x74, 0x3C, 0x01, 0x3B, 0x44, 0x64, 0xCC, 0xD2, 0x9A, 0xFD,
-    0x32, 0xAD, 0xB0, 0x5F, 0xDE, 0x4D, 0x0B, 0x99, 0x09, 0x7D, 0xC9, 0x0E, 0x35, 0x77, 0x64, 0x79,
-    0x76, 0xED, 0xCA, 0x6A, 0x87, 0xAF, 0x88, 0xF1, 0x0D, 0xFB, 0xEA, 0x6C, 0x2C, 0x23, 0x37, 0x43,
-    0xBA, 0x93, 0x27, 0x5F, 0xD3, 0x4C, 0x31, 0xB9, 0x39, 0xF2, 0x78, 0x65, 0xFD, 0xBE, 0x86, 0x89,
-    0xFD, 0x88, 0x89, 0x4C, 0xC4, 0xF8, 0x6F, 0xEB, 0x2E, 0xE5, 0x99, 0xC9, 0x17, 0x7F, 0xE0, 0x32,
-    0x1B, 0x89, 0xD9, 0xF0, 0x22, 0xEC, 0x87, 0xA3, 0x11, 0xD9, 0x17, 0xFE, 0x83, 0xB9, 0xDA, 0x42,
-    0x1C, 0x9D, 0xE6, 0x69, 0x7D, 0x71, 0x1A, 0x8F, 0xB8, 0x79, 0x38, 0x31, 0x16, 0x42, 0xED, 0x33,
-    0x97, 0xCA, 0xBA, 0x79, 0x67, 0x30, 0x43, 0xFB, 0x17, 0x0E, 0x3C, 0x44, 0x24, 0xB6, 0x43, 0x0F,
-    0x33, 0xE8, 0x91, 0xC1, 0x37, 0x9D, 0x56, 0x3D, 0x8C, 0xDC, 0xC6, 0x15, 0x7E, 0x43, 0x5A, 0x21,
-    0x22, 0x02, 0x19, 0x15, 0x12, 0x04, 0xE8, 0x7C, 0x62, 0x2B, 0x18, 0x92, 0xD9, 0x06, 0xF0, 0x2E,
-    0x49, 0x49, 0x41, 0x5C, 0xA4, 0xB0, 0x0A, 0x6D, 0x02, 0x44, 0x85, 0x1A, 0x57, 0x91, 0x8D, 0x2D,
-    0x72, 0x85, 0x11, 0xEC, 0xDE, 0x32, 0x97, 0x22, 0x85, 0x8B, 0xA8, 0x88, 0x93, 0xD2, 0x2A, 0x5C,
-    0x24, 0x27, 0x04, 0x52, 0xA1, 0x00, 0x42, 0xC0, 0x3B, 0xCE, 0xF9, 0x0A, 0x17, 0x57, 0x98, 0xB6,
-    0x2C, 0xB8, 0x38, 0x20, 0x5A, 0xC0, 0x77, 0x51, 0xA0, 0x03, 0x74, 0x93, 0x98, 0x17, 0xEF, 0xDE,
-    0x92, 0x9C, 0x7C, 0x6F, 0xB8, 0x77, 0xB2, 0x0D, 0xC4, 0x45, 0x88, 0x9D, 0xC7, 0xDD, 0xB7, 0x33,
-    0x6F, 0xDE, 0xCF, 0xF7, 0xBE, 0x19, 0x22, 0x22, 0xDF, 0xA4, 0x64, 0x0C, 0xF9, 0xC5, 0x69, 0x1A,
-    0x12, 0x39, 0x9A, 0x48, 0x2A, 0xA2, 0x88, 0x56, 0xFF, 0x3C, 0x71, 0xCD, 0x6C, 0x2C, 0xDF, 0x7B,
-    0x43, 0x75, 0x29, 0xA4, 0x92, 0x62, 0xB7, 0xA0, 0xD1, 0xBD, 0xD5, 0x74, 0x84, 0xD9, 0x27, 0xA6,
-    0xD7, 0x09, 0x3F, 0x49, 0x26, 0x44, 0x5D, 0x18, 0x29, 0x89, 0x5C, 0x33, 0x21, 0x69, 0xC6, 0xC4,
-    0x8F, 0x28, 0xC6, 0xE4, 0x6C, 0x14, 0xE4, 0xED, 0x61, 0x89, 0xA9, 0x1C, 0xB3, 0x3D, 0xF1, 0x67,
-    0x57, 0x6F, 0x07, 0x5B, 0x5E, 0x12, 0x4B, 0x9F, 0x22, 0x29, 0x69, 0x78, 0x5E, 0xD2, 0x60, 0xF1,
-    0x07, 0x94, 0x5D, 0x5C, 0xA4, 0x41, 0xE7, 0x22, 0x46, 0x87, 0xBA, 0xEF, 0x74, 0x28, 0x5E, 0xFA,
-    0x21, 0x85, 0x7A, 0x89, 0xA4, 0xBE, 0x4F, 0xDE, 0x54, 0xBF, 0x29, 0x8C, 0x29, 0xC5, 0xBE, 0x19,
-    0xB3, 0x39, 0xF7, 0x43, 0x45, 0xCE, 0x4A, 0x6A, 0xB7, 0xA0, 0x7E, 0x93, 0xF8, 0xC6, 0x24, 0x26,
-    0x79, 0xCB, 0xC7, 0xA6, 0xF1, 0xD7, 0x5D, 0x87, 0x3F, 0x27, 0x17, 0x3E, 0x57, 0x91, 0x09, 0xC8,
-    0xFC, 0x68, 0xE0, 0x6A, 0x51, 0xCA, 0xD4, 0x2D, 0xBA, 0x24, 0xD3, 0x92, 0x42, 0xB8, 0xBD, 0x0C,
-    0xB7, 0x6B, 0xB8, 0x5D, 0x97, 0xA7, 0x61, 0x5E, 0x53, 0x8E, 0x14, 0x9C, 0xE0, 0x08, 0x8C, 0x96,
-    0xC6, 0xA8, 0xA8, 0xD7, 0xB3, 0x01, 0x7D, 0x2B, 0xBE, 0xF9, 0xCF, 0xD8, 0x34, 0xC8, 0xD7, 0xE4,
-    0x6B, 0xFF, 0x2E, 0x34, 0x7F, 0x82, 0x89, 0x31, 0x05, 0xDF, 0x9C, 0x6C, 0x1F, 0x0F, 0xFA, 0xD0,
-    0x54, 0x34, 0x4A, 0x96, 0x28, 0xC3, 0xEF, 0x49, 0xFB, 0xFF, 0xD1, 0x08, 0x11, 0x41, 0x8C, 0x21,
-    0xE6, 0xFA, 0x57, 0x9A, 0x55, 0xE2, 0xDF, 0x67, 0xA6, 0x3D, 0xFB, 0x5B, 0x20, 0x26, 0x17, 0xE1,
-    0x05, 0x8F, 0x7B, 0xD7, 0xA1, 0x6F, 0x78, 0x70, 0x7E, 0x13, 0xB6, 0x7D, 0xDE, 0xEE, 0xA0, 0xED,
-    0x36, 0x29, 0xBD, 0x19, 0xEE, 0x44, 0xCD, 0x95, 0x2F, 0xCD, 0xD4, 0x98, 0x77, 0x9B, 0x9F, 0x99,
-    0xC7, 0xA3, 0xBE, 0x72, 0x2B, 0x8A, 0xD6, 0x51, 0x59, 0x6A, 0x10, 0x37, 0x39, 0x33, 0x05, 0x17,
-    0xFC, 0x7D, 0x72, 0x35, 0x85, 0x19, 0x85, 0x8A, 0xD6, 0x35, 0x19, 0x56, 0xFB, 0x15, 0xAB, 0x23,
-    0x56, 0x8B, 0x3D, 0x56, 0x4B, 0x3B, 0xFB, 0x1D, 0x9E, 0xED, 0x7E, 0x08, 0xF5, 0x37, 0xB6, 0x52,
-    0x74, 0xF4, 0x78, 0x63, 0xD2, 0xA2, 0xA2, 0x0E, 0xA2, 0x93, 0x14, 0x68, 0x57, 0x79, 0x6B, 0x50,
-    0xEC, 0xA5, 0x1D, 0x1A, 0x6A, 0x29, 0xF2, 0xF5, 0xBB, 0xFF, 0xCC, 0x8D, 0x31, 0x3F, 0x3E, 0x38,
-    0x18, 0x26, 0x83, 0x48, 0x8A, 0xFE, 0x8D, 0xCF, 0x3F, 0x63, 0xC5, 0xCF, 0x0F, 0xF3, 0xF5, 0x74,
-    0xE0, 0x7D, 0x4C, 0x01, 0x7D, 0xA5, 0x3C, 0x15, 0x6A, 0xA1, 0xE1, 0xE9, 0x00, 0xBE, 0x04, 0xF0,
-    0xCA, 0x53, 0xF0, 0x2F, 0x9F, 0xC2, 0xBC, 0x31, 0xC8, 0x62, 0xDD, 0x47, 0x1A, 0x2A, 0xEC, 0x42,
-    0x15, 0xAD, 0xB1, 0xE8, 0x5A, 0xE1, 0xB3, 0x90, 0x10, 0x59, 0x80, 0x7F, 0x6B, 0x53, 0xD5, 0xFD,
-    0x7F, 0x9B, 0x0A, 0xC5, 0x43, 0xC9, 0xA7, 0xB0, 0x83, 0xF9, 0xFF, 0x5B, 0x24, 0x10, 0xB2, 0x81,
-    0xF0, 0x38, 0x99, 0x74, 0x6A, 0x34, 0xB5, 0x7D, 0x50, 0x43, 0xAE, 0xDD, 0x40, 0x90, 0xBE, 0x0A,
-    0x00, 0xB2, 0x8C, 0xE7, 0xFA, 0xCA, 0x57, 0xFD, 0x71, 0x86, 0x6D, 0xCC, 0x96, 0xF2, 0x37, 0x77,
-    0x96, 0x32, 0x9A, 0x0C, 0xA0, 0x0D, 0x91, 0x86, 0xDC, 0x14, 0xCB, 0x58, 0x56, 0xBA, 0x13, 0x5A,
-    0xEB, 0x93, 0x2C, 0x7D, 0x35, 0x01, 0x74, 0x33, 0x5F, 0x51, 0xFC, 0xAE, 0x02, 0x0A, 0xAB, 0x0C,
-    0x90, 0xF4, 0xB6, 0x14, 0x70, 0x31, 0x80, 0xB1, 0xDB, 0x72, 0x4B, 0x79, 0xDB, 0xA6, 0xCC, 0x28,
-    0x1A, 0xF1, 0x56, 0x74, 0x1A, 0x31, 0x67, 0x00, 0x3E, 0xD5, 0x2C, 0x1A, 0x7A, 0xD8, 0x45, 0x0A,
-    0xCA, 0x57, 0xC5, 0x3E, 0x84, 0xF3, 0x84, 0x74, 0xE0, 0x6C, 0x5F, 0xD6, 0xD2, 0xFD, 0xE8, 0xD7,
-    0x2C, 0x56, 0xC6, 0xFD, 0xBB, 0x7B, 0x7B, 0x13, 0xCE, 0x5F, 0xBD, 0xF0, 0xE4, 0x8F, 0x4F, 0x3F,
-    0xF3, 0xB6, 0xAE, 0x3C, 0x52, 0xEE, 0xC7, 0xE2, 0x0B, 0x08, 0x7A, 0x9A, 0xBA, 0x7F, 0xA7, 0xAF,
-    0x12, 0xE7, 0x39, 0xCD, 0x12, 0x51, 0x53, 0x4E, 0x48, 0x58, 0xCE, 0x89, 0x1A, 0xB1, 0x88, 0xD0,
-    0x84, 0x77, 0x68, 0x99, 0x3B, 0x69, 0xA6, 0xBC, 0xD2, 0x63, 0x08, 0x04, 0x19, 0x2A, 0xB9, 0xAC,
-    0x2F, 0xC8, 0xCB, 0x33, 0xA5, 0xBB, 0xDE, 0xBE, 0xAB, 0xCA, 0x20, 0x93, 0x6E, 0xB1, 0xAC, 0x3B,
-    0xDF, 0xA9, 0xFA, 0x20, 0xCC, 0x24, 0xD1, 0xA1, 0xEE, 0x90, 0xB7, 0xAD, 0x50, 0xA8, 0x90, 0xBB,
-    0x26, 0x93, 0x36, 0x79, 0xF6, 0xE1, 0x0E, 0x40, 0x63, 0xBC, 0x72, 0x17, 0x65, 0x30, 0x26, 0x15,
-    0xBD, 0xE5, 0x84, 0x15, 0x62, 0xFD, 0x6A, 0xE1, 0x9A, 0xAA, 0x74, 0xEB, 0x1B, 0x35, 0xD0, 0x3E,
-    0x42, 0x0D, 0xFC, 0x22, 0x22, 0x51, 0x22, 0x3B, 0x5D, 0xAF, 0x20, 0x79, 0xB9, 0x44, 0xD7, 0x80,
-    0x81, 0x4A, 0x2C, 0xEE, 0x02, 0x02, 0x41, 0x92, 0x91, 0x2C, 0x64, 0xE1, 0x97, 0xE8, 0xD1, 0x21,
-    0x6C, 0xFD, 0x24, 0x41, 0xC6, 0xDA, 0xA7, 0x87, 0x0E, 0x45, 0x26, 0x8A, 0x73, 0xAB, 0xAB, 0x77,
-    0x8E, 0xD8, 0x80, 0xA0, 0x01, 0x9E, 0x2F, 0x3F, 0xA4, 0x75, 0xB2, 0x7C, 0x80, 0x62, 0xB7, 0x84,
-    0x70, 0x76, 0xB7, 0xC7, 0xAE, 0x8C, 0x9D, 0x7C, 0xF5, 0x03, 0xDB, 0xA4, 0xD8, 0x8E, 0x15, 0xCA,
-    0x83, 0xD2, 0xCE, 0x60, 0xEA, 0xB0, 0xBC, 0xE1, 0x73, 0xDF, 0x36, 0x74, 0x01, 0x4C, 0x66, 0x0D,
-    0x62, 0xF2, 0x35, 0x6E, 0x66, 0xE6, 0xBF, 0x30, 0xE9, 0x62, 0xB5, 0x4C, 0x98, 0x4B, 0xB0, 0x08,
-    0xE5, 0x06, 0x0C, 0xE1, 0xF8, 0xEB, 0x20, 0xA6, 0x47, 0x63, 0x3A, 0x67, 0x0E, 0x57, 0x41, 0x48,
-    0x46, 0xDD, 0x9C, 0x3D, 0x4E, 0x5C, 0x8D, 0x86, 0xB6, 0xA1, 0xC1, 0xB4, 0x4C, 0x62, 0xD8, 0xC0,
-    0xA6, 0x25, 0xCA, 0x0D, 0x16, 0x52, 0xC8, 0x06, 0xF3, 0x47, 0x98, 0x80, 0x4A, 0x0D, 0x1C, 0x31,
-    0x1B, 0xBD, 0x51, 0xEF, 0x1A, 0xE8, 0xA9, 0x6D, 0x76, 0x9A, 0x5C, 0x80, 0x37, 0x23, 0xC6, 0x28,
-    0x14, 0x48, 0xAC, 0x6B, 0xA1, 0x7A, 0x82, 0xE4, 0x93, 0xDF, 0x29, 0x77, 0xD3, 0xC0, 0x61, 0x76,
-    0x0C, 0xF5, 0x15, 0x20, 0x2E, 0x67, 0x86, 0x25, 0x25, 0xB6, 0x3B, 0xC5, 0x01, 0x1C, 0xDB, 0x68,
-    0x9F, 0x05, 0xC3, 0xC4, 0xC2, 0x94, 0xC2, 0xAC, 0x79, 0x29, 0xE9, 0xDB, 0x16, 0x26, 0x67, 0xD2,
-    0x56, 0x6A, 0x8D, 0x5F, 0x03, 0x1B, 0x39, 0x5C, 0x0B, 0xC9, 0x12, 0x54, 0x30, 0x7F, 0x25, 0x96,
-    0x92, 0xF8, 0x05, 0x16, 0x62, 0xA5, 0xC3, 0x4C, 0xF0, 0x8B, 0x04, 0xE6, 0x63, 0xC7, 0x68, 0x04,
-    0x10, 0xF9, 0xFF, 0xA8, 0xD0, 0x07, 0x99, 0x4C, 0x06, 0x9E, 0x12, 0x93, 0x90, 0x06, 0xBE, 0xF2,
-    0x74, 0x44, 0x03, 0x99, 0x86, 0x38, 0x34, 0x32, 0xF9, 0x07, 0x43, 0xCB, 0x4E, 0x19, 0xC0, 0x89,
-    0x91, 0x19, 0x87, 0x4D, 0x62, 0x99, 0x96, 0xAD, 0x9F, 0xB2, 0x6E, 0x94, 0xED, 0x61, 0x31, 0xF7,
-    0x69, 0xFE, 0x6A, 0x9D, 0x9F, 0xC7, 0x70, 0xCC, 0xA3, 0x34, 0xC2, 0x37, 0x53, 0x62, 0x56, 0x05,
-    0xE5, 0xE0, 0xC5, 0x18, 0x3F, 0x84, 0xAE, 0x84, 0x11, 0x2C, 0x3F, 0xC0, 0xA2, 0x19, 0xE6, 0x8D,
-    0x52, 0x0B, 0x00, 0xA4, 0x9D, 0xD4, 0x28, 0x71, 0xB4, 0x51, 0xEE, 0x7F, 0x9E, 0x2A, 0x69, 0x36,
-    0xC7, 0x41, 0xBC, 0xA2, 0x23, 0x49, 0xE5, 0xE0, 0xFB, 0x96, 0x89, 0x33, 0x1B, 0xFE, 0x8B, 0x01,
-    0x5D, 0xAE, 0x79, 0xBD, 0x6B, 0x76, 0x5A, 0xFE, 0xE9, 0xFE, 0xB4, 0x46, 0xFD, 0x02, 0x75, 0xEB,
-    0xF0, 0xEE, 0x61, 0x1F, 0x95, 0xB2, 0xA7, 0x88, 0x44, 0x0E, 0x6E, 0x3D, 0x5B, 0x3D, 0x0C, 0x5B,
-    0x45, 0x8C, 0x19, 0xA3, 0x04, 0x7D, 0x90, 0x10, 0xA3, 0x66, 0xDE, 0x00, 0xAD, 0xEF, 0x25, 0x7D,
-    0x4B, 0x31, 0x7F, 0x3A, 0xC4, 0xE4, 0xBF, 0x03, 0xFA, 0x40, 0x72, 0xCC, 0xFB, 0x0B, 0x4A, 0x8E,
-    0xA1, 0x5A, 0x07, 0xC5, 0xBA, 0xE0, 0x51, 0x40, 0x43, 0x72, 0xE3, 0x76, 0x38, 0x0F, 0x00, 0x50,
-    0x0A, 0x55, 0x04, 0x4C, 0x02, 0x55, 0x31, 0xA2, 0xA0, 0x83, 0xBE, 0x54, 0xAE, 0xCA, 0x42, 0x92,
-    0x8E, 0x5E, 0xA6, 0x8E, 0xAF, 0x6A, 0xD2, 0xA1, 0xA8, 0xA1, 0x72, 0x9A, 0x9B, 0xDF, 0xD3, 0x82,
-    0x61, 0x88, 0x5C, 0x4F, 0xE7, 0x6C, 0x2D, 0x2D, 0xCB, 0x71, 0x72, 0xD9, 0x9D, 0x18, 0xD9, 0xF1,
-    0x80, 0x28, 0xCA, 0xF9, 0x08, 0x03, 0xCC, 0xC4, 0xBF, 0x10, 0x73, 0x0C, 0x0F, 0xDD, 0xA2, 0xE2,
-    0xB6, 0x32, 0xDB, 0x4C, 0x32, 0x54, 0xF2, 0x39, 0x81, 0xFA, 0x1F, 0x6B, 0x00, 0xF8, 0x21, 0x52,
-    0xE4, 0x8E, 0x81, 0x89, 0x10, 0xE5, 0x12, 0x25, 0x80, 0x23, 0x3F, 0x82, 0x95, 0xAC, 0x3A, 0xAA,
-    0x98, 0xC8, 0x1B, 0x9C, 0x79, 0xA6, 0x70, 0x77, 0x16, 0xF4, 0x7C, 0xBF, 0x49, 0x3B, 0x44, 0x09,
-    0x43, 0x0D, 0x0F, 0xC0, 0x16, 0x06, 0x50, 0x4B, 0x0B, 0x08, 0x63, 0x58, 0xC7, 0xF8, 0x0A, 0xE7,
-    0x83, 0xC9, 0x57, 0xEE, 0x88, 0x87, 0x1E, 0xE7, 0x06, 0x24, 0x4B, 0xE2, 0xDA, 0x3C, 0x6B, 0x3E,
-    0xB2, 0xD8, 0x37, 0xB7, 0x51, 0x99, 0x5A, 0x98, 0xBF, 0xF4, 0xA9, 0x81, 0xA2, 0x76, 0x70, 0xC7,
-    0xA0, 0x07, 0x48, 0xD9, 0x25, 0xB4, 0x96, 0x8F, 0xD2, 0x40, 0x31, 0x81, 0x22, 0x22, 0x28, 0xD2,
-    0xB9, 0xA2, 0xE2, 0x19, 0x50, 0x78, 0x63, 0x2C, 0xA9, 0xA0, 0x08, 0xD4, 0x03, 0x38, 0xF0, 0xF6,
-    0x39, 0x3E, 0x82, 0x53, 0xBB, 0x0B, 0x66, 0xA0, 0x45, 0x38, 0x06, 0x8C, 0x04, 0x62, 0x91, 0x96,
-    0xC8, 0x29, 0x30, 0xBF, 0x8B, 0x32, 0xFA, 0x87, 0xF7, 0x9E, 0xFD, 0x16, 0xCE, 0x56, 0x67, 0x77,
-    0xEF, 0xBD, 0x97, 0x74, 0x05, 0xB3, 0x15, 0xF7, 0xF7, 0x77, 0x7C, 0x21, 0xFE, 0xC2, 0x6C, 0x46,
-    0x8C, 0x59, 0xDF, 0xF0, 0x3D, 0xAA, 0xB2, 0xBC, 0x7F, 0x14, 0x0E, 0x5F, 0x97, 0x46, 0x4C, 0x9D,
-    0xB5, 0xC8, 0xF8, 0x58, 0x9E, 0x67, 0xB1, 0x15, 0xFA, 0xA8, 0x60, 0xD4, 0x70, 0x2B, 0x8E, 0x4A,
-    0xBB, 0xC2, 0x7E, 0xE5, 0xBF, 0x6C, 0x09, 0x69, 0xED, 0xDC, 0xC9, 0x95, 0x3B, 0xD1, 0x6B, 0x7F,
-    0x7B, 0x9E, 0x85, 0xBF, 0x2C, 0xCA, 0x8B, 0xAF, 0xBE, 0xA6, 0xEE, 0xBF, 0xDC, 0x0D, 0xD4, 0xFD,
-    0xC5, 0xCA, 0x6B, 0x0E, 0xFA, 0xDA, 0xD9, 0x07, 0x2A, 0x1D, 0xF5, 0xD7, 0xB7, 0xC8, 0xC1, 0x1F,
-    0x08, 0xEB, 0xD4, 0x4B, 0xD8, 0xD0, 0xD4, 0x48, 0x79, 0x7D, 0xA6, 0xD7, 0xBB, 0xCE, 0x26, 0xF8,
-    0x9D, 0xCF, 0x75, 0x96, 0x1A, 0xFF, 0x8F, 0x81, 0xB5, 0xE8, 0x8E, 0x22, 0x28, 0x18, 0xB5, 0x00,
-    0x7B, 0x68, 0x21, 0x53, 0x32, 0xB3, 0xA0, 0xA2, 0x61, 0x8A, 0x4B, 0xA6, 0xD3, 0x58, 0x8A, 0x65,
-    0x40, 0xDA, 0x33, 0xD8, 0x06, 0x18, 0xB5, 0x94, 0xDB, 0x2A, 0xF8, 0x7E, 0x21, 0xEC, 0x10, 0x18,
-    0x21, 0x89, 0x59, 0x43, 0x0E, 0xAA, 0xCD, 0x91, 0xFF, 0x4A, 0x2F, 0x90, 0x38, 0x34, 0x80, 0x0E,
-    0x78, 0x13, 0x68, 0x5A, 0x06, 0x36, 0x31, 0x37, 0x9A, 0x8F, 0x21, 0x46, 0x86, 0x75, 0x13, 0xA1,
-    0x3D, 0x5C, 0xF7, 0xFA, 0x0A, 0x2D, 0x80, 0xB9, 0x3B, 0x2F, 0x1A, 0x8E, 0x42, 0xEE, 0x3E, 0x77,
-    0x8F, 0xE5, 0x79, 0xDB, 0x15, 0x0F, 0xA4, 0xA5, 0x1B, 0xEE, 0x44, 0x77, 0x77, 0x8A, 0x13, 0x05,
-    0x78, 0xE3, 0x03, 0xEB, 0xDE, 0xB3, 0xD5, 0x5C, 0x71, 0x83, 0xFA, 0x29, 0x7B, 0x24, 0xC9, 0x55,
-    0x09, 0x5D, 0x24, 0x29, 0x5F, 0x4F, 0xEF, 0x53, 0xD7, 0xE4, 0x2B, 0x8A, 0xCC, 0xCD, 0xAD, 0xE7,
-    0xE4, 0x96, 0x2F, 0x7B, 0x9A, 0xAF, 0x51, 0xB0, 0x62, 0x78, 0x87, 0x93, 0x96, 0x40, 0x29, 0x4E,
-    0x5E, 0xE2, 0x1A, 0x19, 0x6D, 0x5B, 0xDC, 0xF2, 0x9D, 0xBD, 0xAE, 0x59, 0x5E, 0xF5, 0xD5, 0x31,
-    0xD5, 0x65, 0x34, 0xC7, 0x7B, 0xAB, 0x5C, 0x98, 0x26, 0xF0, 0xD8, 0x70, 0xC8, 0x79, 0xAE, 0x1D,
-    0x74, 0x5B, 0x0E, 0xA0, 0x6A, 0x9F, 0x2F, 0x1F, 0x54, 0xC5, 0xDC, 0x8A, 0x6F, 0xA4, 0xBE, 0x72,
-    0xBF, 0x28, 0xB0, 0x7C, 0xCA, 0x47, 0x49, 0x34, 0xE4, 0xDE, 0x7E, 0x9F, 0x99, 0xE5, 0x29, 0x87,
-    0x35, 0x65, 0x84, 0xB4, 0x4A, 0x10, 0xD8, 0x94, 0xEF, 0xB3, 0x63, 0x77, 0xF7, 0x06, 0x1F, 0x35,
-    0x35, 0xB3, 0x35, 0x46, 0x3C, 0x1F, 0xFC, 0x7D, 0xE8, 0x16, 0xA2, 0xBA, 0xD5, 0xE4, 0x1A, 0xC5,
-    0x4B, 0x6F, 0x1D, 0xFE, 0xDE, 0xF2, 0x13, 0x8F, 0xDC, 0x5E, 0x89, 0xCB, 0xE3, 0xDF, 0x47, 0x03,
-    0xD7, 0x4E, 0xEC, 0xC5, 0x17, 0x71, 0x72, 0x9F, 0xD9, 0x23, 0x14, 0x85, 0x30, 0x7B, 0x26, 0x71,
-    0x67, 0x1B, 0xFB, 0x85, 0xFF, 0xE9, 0xC6, 0x23, 0x2D, 0x57, 0x36, 0x8A, 0x49, 0x78, 0x65, 0xA3,
-    0xC8, 0x62, 0xCC, 0x1B, 0xB2, 0x88, 0xA2, 0x17, 0x82, 0xE6, 0x27, 0x73, 0x1B, 0xB6, 0x3D, 0x61,
-    0xF8, 0xF8, 0x6D, 0x01, 0x6F, 0xEF, 0xC0, 0x34, 0xBA, 0xCD, 0x28, 0x07, 0x76, 0xAC, 0x10, 0x9F,
-    0x28, 0x5A, 0xBC, 0x44, 0xE2, 0x53, 0xDC, 0x1D, 0x1A, 0x70, 0x5F, 0xED, 0xEE, 0xF6, 0x4B, 0x1C,
-    0xC3, 0x9B, 0xE8, 0xE8, 0x2E, 0xF9, 0xED, 0x4B, 0xFE, 0xA6, 0xF0, 0x74, 0x8C, 0x2B, 0x39, 0xE2,
-    0x88, 0x44, 0x7E, 0xD5, 0x2A, 0xBD, 0x47, 0x88, 0xB2, 0x4B, 0x48, 0x17, 0x0D, 0x31, 0x65, 0x73,
-    0x7C, 0x76, 0x82, 0x9B, 0x3B, 0x93, 0x34, 0x8C, 0x59, 0x9B, 0x9F, 0x20, 0x84, 0x3E, 0x16, 0x35,
-    0xF2, 0xE0, 0xED, 0x30, 0x61, 0xBF, 0x86, 0xF6, 0x14, 0xC8, 0x8E, 0x3E, 0x43, 0x8B, 0x4F, 0xE8,
-    0x83, 0xE2, 0x84, 0x87, 0xED, 0xF3, 0xBA, 0xBD, 0x78, 0x8F, 0x4C, 0x83, 0xCF, 0x99, 0xDE, 0xF5,
-    0xFF, 0x02, 0x13, 0x0D, 0x0D, 0x0D, 0xFA, 0xFF, 0xFF, 0xFF, 0x71, 0x20, 0x66, 0x00, 0x00, 0x35,
-    0x8B, 0xB1, 0x0D, 0xC2, 0x50, 0x0C, 0x44, 0x4F, 0x08, 0xC9, 0x05, 0x85, 0x47, 0xC9, 0x08, 0x64,
-    0x23, 0x46, 0x20, 0x15, 0x8C, 0x45, 0x46, 0x70, 0x97, 0x96, 0x36, 0x1D, 0x45, 0x8A, 0xDF, 0xC0,
-    0x71, 0xFF, 0xA2, 0x58, 0xB2, 0x9F, 0x9F, 0x7C, 0x06, 0x8E, 0x2A, 0xCF, 0xDC, 0x41, 0x23, 0x77,
-    0xD0, 0xC8, 0xF5, 0xD6, 0xB1, 0x39, 0x92, 0xB3, 0xC1, 0xC7, 0x7B, 0x28, 0xC5, 0x38, 0xDF, 0x4B,
-    0x31, 0x9E, 0x58, 0x92, 0x4D, 0x7F, 0x92, 0xF1, 0xC5, 0x45, 0x72, 0x21, 0x9F, 0xE4, 0x44, 0xB6,
-    0xE0, 0x2F, 0xB4, 0x05, 0xDB, 0xC0, 0x06, 0xAD, 0x12, 0xA3, 0x01, 0xF1, 0x0D, 0x09, 0xE2, 0x93,
-    0x12, 0x44, 0x5D, 0xA7, 0x8E, 0xA5, 0x0B, 0x7C, 0x11, 0x2C, 0x08, 0x0B, 0xCE, 0xEA, 0x3F,
+static const uint8_t notosans_14_regularBitmaps[27476] = {
+    0xC5, 0x9A, 0x31, 0xAC, 0x1D, 0x47, 0x96, 0x9E, 0xBF, 0xEE, 0xD2, 0x53, 0x7B, 0xA7, 0x80, 0x2D,
+    0x06, 0xE4, 0xAE, 0x20, 0x61, 0xD5, 0xC9, 0x06, 0x33, 0x83, 0x25, 0x3B, 0x36, 0xF0, 0xBA, 0xBB,
+    0x46, 0x02, 0x66, 0x02, 0x05, 0xBA, 0x30, 0x78, 0x35, 0x80, 0x19, 0xEC, 0x04, 0x0A, 0x04, 0x1B,
+    0x30, 0x1D, 0x4E, 0x70, 0xEF, 0xBB, 0x3D, 0x9A, 0x40, 0x81, 0x02, 0x71, 0x01, 0x2B, 0xDA, 0xC0,
+    0x0A, 0xC6, 0xDE, 0xD9, 0xE7, 0x40, 0x0E, 0x64, 0x80, 0x06, 0xFA, 0xBD, 0x5B, 0x22, 0x03, 0x05,
+    0x0A, 0x58, 0x9A, 0x07, 0xD9, 0x81, 0x02, 0xB5, 0x87, 0xA4, 0x07, 0x3B, 0x0A, 0x58, 0x14, 0x4B,
+    0x56, 0x53, 0xEC, 0xDB, 0x67, 0x83, 0xBE, 0x8F, 0xA4, 0x86, 0x14, 0x97, 0x23, 0x69, 0xE4, 0xEE,
+    0xDB, 0xDD, 0xD5, 0x55, 0x75, 0x4F, 0x9D, 0x3A, 0x75, 0xCE, 0xA9, 0x53, 0x7F, 0xF5, 0xC1, 0xC1,
+    0xC1, 0x72, 0xB9, 0x58, 0x2C, 0x76, 0xA7, 0x03, 0x4E, 0x1E, 0x8E, 0x07, 0x27, 0x2B, 0x7D, 0xE5,
+    0xD5, 0x5B, 0xBE, 0x8D, 0x67, 0xCA, 0xEC, 0xF5, 0x1F, 0xFD, 0xD6, 0xFD, 0xFC, 0x67, 0x7F, 0x46,
+    0xEA, 0xFE, 0x0A, 0x0C, 0xEF, 0xC0, 0xAE, 0x72, 0x24, 0x9D, 0x01, 0xDD, 0xFC, 0x1C, 0xCA, 0xA4,
+    0x63, 0xFF, 0x8B, 0xB7, 0x7F, 0xAF, 0x44, 0x64, 0xD8, 0x39, 0x3F, 0xFF, 0x6C, 0xC6, 0xC5, 0xCC,
+    0x91, 0xFA, 0x67, 0xEF, 0x55, 0x4F, 0x44, 0x44, 0x94, 0x88, 0x0C, 0x9C, 0x4E, 0x3A, 0x08, 0xDA,
+    0xA2, 0xDC, 0x2E, 0x18, 0x02, 0xFC, 0xFC, 0xB8, 0x3A, 0x00, 0xA7, 0x81, 0x77, 0xE0, 0x2F, 0xFF,
+    0x89, 0x4C, 0xC4, 0xAD, 0x46, 0x51, 0xE1, 0x9D, 0x93, 0xE6, 0x39, 0x4F, 0xA9, 0x2D, 0xC3, 0x69,
+    0xD2, 0xCD, 0x3B, 0xA4, 0xD2, 0x91, 0xC8, 0x06, 0xEA, 0x11, 0xFE, 0xC7, 0x48, 0xEA, 0x07, 0xF4,
+    0x8F, 0x02, 0xA7, 0xF5, 0x25, 0xFB, 0xCE, 0x9E, 0xB9, 0x23, 0xA1, 0x96, 0x91, 0x9D, 0x43, 0x0B,
+    0xEF, 0x40, 0xEA, 0xE1, 0xC9, 0x2D, 0x75, 0xD6, 0x0D, 0xCF, 0x92, 0xAF, 0x51, 0x5E, 0xF9, 0xC8,
+    0x45, 0x16, 0x59, 0x63, 0xC8, 0x9A, 0xDD, 0xB4, 0xE3, 0xA2, 0x72, 0xBB, 0xE8, 0x66, 0x57, 0x37,
+    0x5C, 0x54, 0xEF, 0x06, 0xB2, 0x66, 0xB7, 0x7C, 0xA6, 0xD9, 0xCD, 0x5E, 0x7B, 0x4F, 0x9E, 0xF7,
+    0x31, 0xC6, 0x45, 0x2E, 0x67, 0x9E, 0x55, 0x7E, 0xF5, 0xCB, 0x4B, 0xFE, 0x59, 0xB8, 0x58, 0x26,
+    0x01, 0xA3, 0x7C, 0x4E, 0xDA, 0x95, 0x49, 0x60, 0x91, 0xFA, 0x67, 0x31, 0xF6, 0x4C, 0xDA, 0x25,
+    0x81, 0xB0, 0x4B, 0x89, 0xB9, 0xE1, 0x74, 0x43, 0x1D, 0x00, 0x4E, 0x6C, 0x9B, 0xCF, 0x47, 0x20,
+    0x97, 0x00, 0xC6, 0x1D, 0x42, 0xE6, 0x8C, 0x23, 0x09, 0x69, 0x80, 0x05, 0x03, 0x98, 0x66, 0x09,
+    0x49, 0x3C, 0x04, 0x8A, 0x11, 0xC8, 0x36, 0x80, 0x16, 0x9B, 0xCC, 0xCC, 0xD5, 0x9E, 0x41, 0x77,
+    0x75, 0x53, 0xAA, 0xA0, 0xFA, 0x22, 0x89, 0xD4, 0x6F, 0x34, 0x0B, 0x94, 0xB8, 0xDC, 0x52, 0x7B,
+    0x15, 0x30, 0x3D, 0x6B, 0x7B, 0x5E, 0x1A, 0x23, 0x72, 0xA9, 0x67, 0x2D, 0xB6, 0x68, 0x98, 0x01,
+    0x55, 0x55, 0x96, 0xE5, 0xE9, 0xBF, 0x79, 0x8A, 0x77, 0xB4, 0x2B, 0xD3, 0x60, 0x6C, 0xAB, 0x3A,
+    0x63, 0x17, 0x69, 0xD0, 0xAE, 0x66, 0x50, 0xC1, 0xB8, 0x82, 0x36, 0x89, 0xCA, 0x1B, 0x57, 0x50,
+    0xD1, 0x12, 0x93, 0x90, 0x5C, 0x38, 0x83, 0xB1, 0xDA, 0x29, 0x9F, 0x86, 0x24, 0xD2, 0xD3, 0xB2,
+    0x60, 0x49, 0x49, 0xB5, 0x3D, 0x4B, 0x96, 0x2C, 0x68, 0xE9, 0x93, 0xA8, 0x82, 0xF2, 0xDA, 0xE5,
+    0xFC, 0x00, 0x80, 0x24, 0x42, 0x0E, 0x04, 0x30, 0x64, 0x17, 0xC2, 0x7F, 0x58, 0xDF, 0x90, 0xFF,
+    0xBB, 0x96, 0x7F, 0xA2, 0x76, 0xE8, 0x43, 0x92, 0x9B, 0x91, 0xDA, 0x38, 0xED, 0xF7, 0x78, 0x2A,
+    0xB5, 0xEC, 0xDC, 0x1B, 0xF0, 0xD4, 0x83, 0xB6, 0x70, 0x9A, 0x64, 0x7E, 0x7B, 0x5E, 0x88, 0x0C,
+    0x2B, 0x91, 0xF0, 0x60, 0x29, 0xBC, 0x03, 0x3B, 0xD9, 0x6F, 0xC2, 0x50, 0xE6, 0xD9, 0xAB, 0x4E,
+    0x06, 0x19, 0xE6, 0x67, 0x4F, 0x1E, 0x8E, 0x07, 0x27, 0x21, 0x92, 0x39, 0x2A, 0x88, 0x68, 0x47,
+    0x45, 0x12, 0xD0, 0x8E, 0x92, 0x24, 0x60, 0x1A, 0x4A, 0xD2, 0x80, 0x69, 0x58, 0x90, 0x06, 0x8C,
+    0x65, 0x81, 0xEA, 0x30, 0x96, 0x76, 0x1A, 0x99, 0x54, 0x3C, 0xB5, 0x74, 0x2A, 0x6A, 0x9F, 0x5B,
+    0xE3, 0x06, 0xCC, 0xF3, 0x1D, 0x55, 0x6E, 0x69, 0x17, 0xA4, 0x9F, 0x06, 0xB2, 0xF7, 0x1D, 0x79,
+    0x01, 0x8B, 0x96, 0xE4, 0xD3, 0x40, 0xF6, 0x9E, 0x23, 0xCF, 0x2D, 0x6D, 0x89, 0x0A, 0x03, 0xE6,
+    0x17, 0x91, 0x56, 0x45, 0xDD, 0x29, 0x11, 0x52, 0xE9, 0xA6, 0x11, 0xCF, 0x6D, 0xEE, 0x8B, 0x58,
+    0x2F, 0x6B, 0xF3, 0x82, 0xF2, 0x44, 0x4A, 0x8C, 0x7D, 0x44, 0x02, 0x20, 0x13, 0x9F, 0x88, 0x74,
+    0xA6, 0xCB, 0xBB, 0xA7, 0x30, 0x0E, 0x72, 0x0B, 0x4B, 0x48, 0x02, 0x68, 0x07, 0x15, 0xA4, 0x01,
+    0x72, 0x4B, 0xD2, 0x43, 0xDE, 0x3C, 0xEC, 0xF1, 0xE1, 0xFC, 0xEC, 0x5A, 0xE4, 0x53, 0x11, 0x71,
+    0x00, 0x5A, 0x7C, 0x2A, 0x12, 0x8C, 0x7F, 0xA6, 0x3B, 0x89, 0xFE, 0x32, 0x49, 0xE3, 0x48, 0x06,
+    0x72, 0x69, 0x58, 0x8F, 0x30, 0x5F, 0x37, 0x50, 0x58, 0xA8, 0x81, 0x76, 0x6A, 0xC9, 0x38, 0xD8,
+    0xFB, 0x01, 0x3A, 0xAC, 0x45, 0x58, 0x4B, 0x47, 0x62, 0x61, 0xCA, 0xD6, 0x01, 0xB2, 0x01, 0xD4,
+    0x0D, 0x48, 0x7F, 0xE7, 0x48, 0x6E, 0x06, 0x88, 0x0B, 0xE8, 0x73, 0x58, 0x64, 0x8E, 0x32, 0x09,
+    0x54, 0x2C, 0x28, 0xC8, 0xC9, 0xC9, 0x9C, 0xB1, 0x49, 0xC8, 0x44, 0xE4, 0xA6, 0x88, 0x0C, 0xA7,
+    0xE6, 0xE7, 0x3E, 0x9C, 0x98, 0x60, 0xC1, 0xA4, 0x34, 0x99, 0xC3, 0x88, 0xD8, 0x5A, 0x46, 0xBE,
+    0xD8, 0xFF, 0x95, 0x72, 0x60, 0xA6, 0xD2, 0x24, 0x40, 0xE6, 0xA0, 0x78, 0xFB, 0x02, 0x6B, 0xE9,
+    0xF9, 0xC7, 0x73, 0x3D, 0xA8, 0x08, 0x6A, 0x2B, 0x96, 0x62, 0x62, 0x58, 0x75, 0x50, 0x3C, 0xDF,
+    0xA4, 0x83, 0x11, 0x71, 0xB9, 0x44, 0x98, 0x6D, 0x0D, 0xAF, 0x18, 0xD1, 0xD2, 0xB3, 0xB6, 0x64,
+    0x1D, 0x54, 0x5F, 0x12, 0x28, 0x71, 0xD5, 0xA9, 0x8F, 0x25, 0xE6, 0x31, 0x8B, 0x2B, 0xD4, 0xCD,
+    0x1E, 0xFD, 0x9E, 0x23, 0x7F, 0xD1, 0x52, 0x96, 0x24, 0xA1, 0x45, 0xBF, 0x1B, 0xA9, 0xD2, 0x98,
+    0x05, 0x25, 0x62, 0x53, 0x89, 0x70, 0x12, 0xB6, 0x22, 0xFE, 0x5F, 0xFB, 0xFB, 0x6B, 0xA0, 0x9F,
+    0x18, 0xAC, 0x27, 0x0B, 0x30, 0x0E, 0x96, 0x5B, 0xF9, 0x35, 0xF7, 0x38, 0xDB, 0xD6, 0xF3, 0x7F,
+    0x58, 0x4F, 0x85, 0x63, 0x1D, 0xEC, 0x58, 0x49, 0xC8, 0x62, 0x16, 0x0A, 0x32, 0xDF, 0x63, 0x7E,
+    0xD9, 0x51, 0x69, 0x97, 0x44, 0xD3, 0x98, 0x26, 0xFF, 0x4D, 0x4F, 0x2E, 0x96, 0x7A, 0x24, 0xFB,
+    0x4C, 0xD8, 0x63, 0xA5, 0x3A, 0xEA, 0x1C, 0xDA, 0x63, 0x95, 0xF4, 0xD4, 0xC6, 0xA7, 0xD1, 0x88,
+    0x34, 0xFA, 0xBE, 0xCE, 0xA7, 0xD2, 0xB0, 0x12, 0x9F, 0xC5, 0xDC, 0xD7, 0x68, 0x17, 0x31, 0x3F,
+    0x71, 0x14, 0x5B, 0x5D, 0xBE, 0x19, 0xD0, 0x97, 0x3B, 0x56, 0xBA, 0xCB, 0x06, 0x23, 0x63, 0xD0,
+    0xF2, 0xBA, 0xBB, 0xC7, 0xEA, 0xD4, 0xA5, 0x34, 0xC2, 0xAA, 0x31, 0xD2, 0x53, 0x8F, 0xB0, 0x03,
+    0xB0, 0x1C, 0xC7, 0xC5, 0xB1, 0x4F, 0xDD, 0x5A, 0xDF, 0xC2, 0x74, 0x63, 0xE6, 0xB8, 0xEF, 0x38,
+    0x6B, 0xDC, 0x60, 0x7E, 0x11, 0x0A, 0xE5, 0xBF, 0xBF, 0x75, 0x82, 0x99, 0x23, 0x11, 0x58, 0x79,
+    0xF2, 0x48, 0xD6, 0x93, 0x8C, 0x50, 0x34, 0xB0, 0xBA, 0x00, 0x79, 0x84, 0x6C, 0x04, 0xD6, 0x1E,
+    0x8A, 0xED, 0x88, 0x27, 0x93, 0x51, 0x88, 0xAC, 0x44, 0xC2, 0x3D, 0xCA, 0xA7, 0xE6, 0xF3, 0x9F,
+    0x8A, 0xC8, 0x0F, 0xF7, 0xF7, 0xDF, 0xB2, 0x90, 0x76, 0x90, 0xF5, 0x90, 0x8E, 0xC0, 0xAA, 0x81,
+    0x7C, 0x9B, 0x91, 0x0C, 0x90, 0x07, 0xF4, 0x86, 0x6C, 0x9C, 0xC4, 0xE0, 0x49, 0xAF, 0xC1, 0x13,
+    0x5B, 0x32, 0x5A, 0xFC, 0x4A, 0xFA, 0x32, 0xD9, 0x40, 0x05, 0x05, 0x14, 0x50, 0xC1, 0x92, 0xA4,
+    0x47, 0x77, 0x14, 0x0D, 0x4B, 0xB8, 0x08, 0x01, 0xEE, 0x36, 0x3E, 0x23, 0x19, 0x48, 0x07, 0x92,
+    0x61, 0x12, 0xF0, 0xD3, 0x5F, 0x58, 0x48, 0x45, 0x7A, 0x28, 0xAE, 0x25, 0x6B, 0x38, 0x00, 0xE3,
+    0xD2, 0x00, 0x69, 0xC8, 0x1C, 0x10, 0x8D, 0xCD, 0xA5, 0x59, 0xE4, 0xAC, 0xDF, 0x76, 0xBB, 0xA7,
+    0x93, 0xA8, 0xDC, 0xE9, 0x5D, 0xE5, 0x95, 0x3B, 0xBD, 0xAB, 0x9C, 0x72, 0x67, 0x16, 0x99, 0xCB,
+    0xDC, 0xE9, 0xBB, 0x77, 0xED, 0x76, 0x77, 0x95, 0x33, 0x6E, 0xB1, 0xAB, 0xC2, 0x19, 0x1F, 0x4B,
+    0x24, 0x4A, 0x57, 0x50, 0x34, 0x67, 0xEC, 0xD6, 0x43, 0x78, 0x80, 0xB4, 0x87, 0x13, 0xB0, 0x7E,
+    0xF3, 0x5C, 0x00, 0x2D, 0xD2, 0x01, 0xFF, 0xF6, 0x3F, 0x31, 0x0D, 0x1B, 0x59, 0x00, 0x6A, 0x0F,
+    0xDC, 0x71, 0xA0, 0xAF, 0x00, 0x55, 0x05, 0x49, 0x68, 0xC1, 0xB8, 0x08, 0xA5, 0x0A, 0x13, 0x7B,
+    0xA6, 0x31, 0x0D, 0x4B, 0x0A, 0x52, 0x91, 0x0D, 0x46, 0xA4, 0x67, 0x6F, 0xFF, 0xBF, 0x05, 0x15,
+    0x50, 0x3E, 0xB7, 0x18, 0xD7, 0x42, 0xFE, 0x7C, 0x07, 0x55, 0x0E, 0xB4, 0x03, 0x24, 0xB1, 0x96,
+    0x6B, 0xD4, 0x22, 0xAE, 0x9A, 0xBF, 0x1D, 0x4A, 0x54, 0x2C, 0xA1, 0xBF, 0x77, 0xA5, 0xA1, 0x44,
+    0x77, 0xB5, 0x8C, 0xB6, 0x96, 0xD1, 0x56, 0x9C, 0x0B, 0x25, 0xC9, 0x50, 0x42, 0x5B, 0xC2, 0x72,
+    0x7B, 0xB5, 0x25, 0xC9, 0x50, 0x71, 0x2E, 0xD6, 0x22, 0xBE, 0x96, 0xCD, 0x24, 0xDA, 0x64, 0x3D,
+    0x5A, 0x25, 0x12, 0xB3, 0xF1, 0x47, 0xAD, 0x8A, 0x93, 0x85, 0x27, 0x3D, 0x70, 0xC0, 0xE4, 0x93,
+    0x4C, 0x33, 0x59, 0x12, 0x3D, 0x93, 0xE5, 0x9A, 0x66, 0x6B, 0x3D, 0x03, 0x90, 0x1F, 0xBF, 0xAC,
+    0x00, 0x7D, 0x9B, 0x57, 0x58, 0xCB, 0x48, 0x2A, 0x62, 0x49, 0x66, 0xD4, 0x72, 0x0D, 0x25, 0x32,
+    0x50, 0xCD, 0xDF, 0x8E, 0xCA, 0x93, 0xFB, 0x12, 0x56, 0xCA, 0x93, 0xF4, 0x25, 0x98, 0xCB, 0x7E,
+    0xE2, 0x30, 0x3B, 0xF2, 0x13, 0x8B, 0xD9, 0xD5, 0xE3, 0xC4, 0xD1, 0xB6, 0xC8, 0x5C, 0xDE, 0x56,
+    0x5E, 0x29, 0x4F, 0xEE, 0xAB, 0xF9, 0xF9, 0xA8, 0x44, 0x06, 0x6A, 0xE9, 0xA1, 0x16, 0x79, 0x51,
+    0xE4, 0xE8, 0xFA, 0x7C, 0x16, 0xA1, 0x04, 0x63, 0x51, 0x1E, 0xB6, 0x2F, 0x22, 0x97, 0x45, 0xC2,
+    0xED, 0xF9, 0xEC, 0x81, 0x12, 0x8B, 0xBA, 0x3E, 0x9F, 0x89, 0x6C, 0x6A, 0x11, 0xFB, 0x68, 0x22,
+    0x0D, 0x4A, 0x24, 0x88, 0x0C, 0xD5, 0x43, 0x88, 0xDC, 0x7D, 0xB9, 0xAB, 0xDA, 0xB7, 0x49, 0x45,
+    0x46, 0xEA, 0x6B, 0x4F, 0x06, 0xD5, 0x33, 0xD9, 0x19, 0x03, 0xA0, 0xFD, 0x56, 0x9C, 0xF4, 0x6C,
+    0xE5, 0x69, 0x1A, 0x64, 0xA8, 0x50, 0x12, 0x7A, 0x76, 0xCE, 0x5D, 0x0E, 0x50, 0x68, 0x07, 0x6D,
+    0xDE, 0x90, 0x86, 0xDA, 0xA2, 0xDD, 0xCA, 0x52, 0xB0, 0xBE, 0x90, 0xB4, 0xAC, 0x44, 0x02, 0x85,
+    0x8C, 0x16, 0x66, 0x50, 0x82, 0x7E, 0xC3, 0xA2, 0x6E, 0x79, 0x18, 0x22, 0xD4, 0x25, 0x98, 0x2B,
+    0x0F, 0x64, 0x88, 0xC8, 0x2D, 0x11, 0x19, 0x6E, 0xCF, 0xE7, 0xAB, 0x87, 0xD7, 0xF8, 0xC3, 0x0C,
+    0xB7, 0x1E, 0xD7, 0x63, 0xE6, 0xFF, 0xA5, 0x73, 0xBD, 0x91, 0x91, 0xDC, 0x66, 0x3E, 0x89, 0x2C,
+    0x1F, 0x3B, 0x91, 0x86, 0x64, 0x58, 0x6D, 0xF2, 0x4D, 0xF2, 0x2B, 0x4A, 0x38, 0x30, 0x96, 0x43,
+    0xE5, 0xD9, 0x23, 0xB2, 0x47, 0x49, 0x8D, 0xB1, 0x35, 0xCA, 0xD7, 0x10, 0x6B, 0x28, 0x6B, 0x30,
+    0xE7, 0x1B, 0x94, 0x44, 0x90, 0x15, 0xD4, 0x59, 0xC0, 0xD8, 0x43, 0x94, 0x37, 0x9E, 0xC8, 0x40,
+    0x49, 0xEE, 0x8C, 0x4D, 0x7B, 0xE5, 0xA9, 0x6D, 0x44, 0x85, 0x12, 0xF6, 0x28, 0x1F, 0x35, 0x4C,
+    0x8F, 0x7E, 0xB9, 0x3E, 0x9F, 0x89, 0x8C, 0xB5, 0x48, 0x53, 0x37, 0x90, 0x5F, 0x1D, 0x20, 0x1D,
+    0xEB, 0x0E, 0xEA, 0xAB, 0x37, 0x20, 0x1B, 0xCB, 0x08, 0x9F, 0x5F, 0xBD, 0xD2, 0x90, 0x57, 0xBB,
+    0x0B, 0xD2, 0xAB, 0x57, 0x2F, 0x7B, 0xCA, 0xAA, 0x2C, 0xC8, 0x2E, 0x5F, 0xFD, 0x20, 0xD0, 0x57,
+    0xA5, 0x69, 0x8C, 0xBA, 0xEA, 0xDB, 0x34, 0x54, 0xA5, 0xF2, 0xA5, 0xBA, 0xEA, 0xAB, 0xCC, 0x55,
+    0x65, 0x12, 0x2E, 0xAA, 0xAB, 0xDE, 0xBC, 0x68, 0xAB, 0x92, 0x83, 0xA0, 0xAE, 0xFA, 0x6C, 0xA4,
+    0x2A, 0xA9, 0x9D, 0xBA, 0xEA, 0xD3, 0x9E, 0xAA, 0xC4, 0x58, 0xD5, 0xD5, 0xA0, 0x8E, 0x7A, 0x28,
+    0x6B, 0x8F, 0x3A, 0x12, 0x28, 0xCB, 0x1E, 0x75, 0xF4, 0xBE, 0xA7, 0xDC, 0xAD, 0x51, 0x47, 0xEF,
+    0xF6, 0x94, 0xBB, 0xC6, 0xA9, 0x23, 0x5F, 0x53, 0x96, 0x49, 0xAF, 0x8E, 0xBC, 0x71, 0x65, 0x49,
+    0xAD, 0x8E, 0x7C, 0x1A, 0xCB, 0x12, 0x73, 0xF9, 0xC8, 0xB3, 0x2A, 0x4B, 0xD2, 0xCF, 0x8F, 0x3C,
+    0x66, 0x53, 0xC2, 0xEA, 0xC8, 0x93, 0x6E, 0x4A, 0x30, 0xFE, 0x58, 0x41, 0x23, 0xAC, 0x44, 0x6C,
+    0x3A, 0xDA, 0xF3, 0x3E, 0x0B, 0x64, 0xC1, 0x38, 0x92, 0x3E, 0x6F, 0x60, 0x28, 0x80, 0x65, 0xBD,
+    0x75, 0x5B, 0xD4, 0x0F, 0xBB, 0xD5, 0x40, 0x55, 0x00, 0x7B, 0xB9, 0x85, 0xD6, 0x38, 0x92, 0x21,
+    0x0B, 0xA8, 0x90, 0x8E, 0x14, 0x9E, 0xB5, 0x88, 0x45, 0x4B, 0x0F, 0x9C, 0x84, 0x5A, 0xDE, 0x42,
+    0x64, 0x50, 0xD7, 0xFF, 0xFD, 0x60, 0x6C, 0xDA, 0x97, 0xA8, 0x10, 0xD1, 0x97, 0x3D, 0x85, 0xD9,
+    0xC6, 0x70, 0x91, 0xE2, 0xF9, 0xEB, 0xE7, 0x7A, 0x23, 0xD2, 0xD4, 0x72, 0x81, 0x08, 0xCA, 0x83,
+    0xB1, 0x93, 0x4D, 0xFD, 0xC1, 0xEB, 0x77, 0xDD, 0x83, 0xBF, 0xE8, 0x01, 0x46, 0x80, 0xBA, 0x01,
+    0x4C, 0x07, 0x64, 0xB1, 0x96, 0x5F, 0x51, 0x8B, 0x50, 0xBD, 0xB4, 0x76, 0x25, 0xBA, 0x2B, 0x51,
+    0x61, 0x72, 0xC0, 0xC7, 0x97, 0xEA, 0x4A, 0x72, 0x57, 0x8B, 0x50, 0x4B, 0xA4, 0x7A, 0x29, 0x52,
+    0x32, 0x50, 0x52, 0x51, 0x52, 0xD8, 0x12, 0xE3, 0x4A, 0xB2, 0xED, 0xFF, 0x18, 0xCA, 0xC9, 0xD3,
+    0xF2, 0x8C, 0x74, 0x5A, 0xE4, 0xDD, 0xCD, 0xCE, 0xC5, 0x7A, 0xF2, 0x0F, 0xE5, 0xF4, 0xA8, 0x2D,
+    0xC9, 0x08, 0x99, 0x58, 0xB4, 0x58, 0xB4, 0x4C, 0xF1, 0x9F, 0xF1, 0x50, 0x4D, 0x35, 0x2A, 0xD0,
+    0x1F, 0x5D, 0x78, 0x72, 0x58, 0x8B, 0xA4, 0x22, 0x76, 0x1B, 0x27, 0xC9, 0x5A, 0x44, 0xE6, 0xE7,
+    0xAE, 0xCF, 0x51, 0x9E, 0x6F, 0xE3, 0x5A, 0x80, 0xF9, 0xCF, 0x16, 0xF5, 0x3B, 0x0F, 0xB7, 0x23,
+    0x54, 0xCB, 0x3F, 0x2A, 0xA3, 0x8F, 0x93, 0x51, 0x17, 0xBA, 0xC3, 0xB8, 0xD1, 0x16, 0xCE, 0x88,
+    0x78, 0x56, 0xD2, 0xC0, 0x49, 0xB8, 0x08, 0xD9, 0x47, 0x0E, 0xDA, 0x0A, 0xCC, 0x2F, 0x03, 0x49,
+    0xCC, 0x2D, 0x35, 0x3D, 0xAA, 0xD3, 0x8E, 0x05, 0x4B, 0x8C, 0x53, 0x1D, 0x3D, 0x05, 0x05, 0x49,
+    0x54, 0x01, 0xD3, 0x94, 0xD0, 0x6A, 0x87, 0xF2, 0x3D, 0xD4, 0xB9, 0x25, 0xFD, 0x34, 0x80, 0xD9,
+    0x03, 0xEE, 0xF8, 0x49, 0x4A, 0xD4, 0xCD, 0x14, 0x11, 0x2E, 0x60, 0x80, 0xDB, 0x91, 0x2C, 0x90,
+    0x1D, 0x75, 0x14, 0x1D, 0x85, 0x71, 0x88, 0x63, 0x28, 0x50, 0x1F, 0x4F, 0x63, 0x56, 0x92, 0xDB,
+    0x9E, 0x8B, 0x17, 0x69, 0xD3, 0xA0, 0x3E, 0x08, 0x2A, 0x64, 0x2E, 0x57, 0xDE, 0x34, 0xC6, 0xB6,
+    0xA6, 0x59, 0x52, 0xA9, 0xAE, 0x48, 0x03, 0xAD, 0xB1, 0x0B, 0xD3, 0x24, 0x61, 0x41, 0x5F, 0xA2,
+    0x8E, 0xBA, 0xF4, 0x66, 0xC0, 0xBC, 0x61, 0xB3, 0xF7, 0x1D, 0xC5, 0x02, 0xB3, 0x07, 0x7B, 0x81,
+    0x2A, 0x82, 0x34, 0xAC, 0x1C, 0x6A, 0x00, 0x01, 0x1D, 0x50, 0xD3, 0x72, 0x41, 0x7B, 0x2A, 0xC8,
+    0xB5, 0xC7, 0x34, 0x03, 0xC6, 0xE5, 0x4D, 0xE6, 0xD3, 0xA0, 0x3A, 0xEA, 0x34, 0x90, 0x7D, 0x10,
+    0xA1, 0xED, 0xC1, 0x0C, 0x90, 0x6C, 0x80, 0xDA, 0x42, 0x1D, 0x20, 0xDF, 0x03, 0xF3, 0xBA, 0x43,
+    0xBB, 0x81, 0xCC, 0xE7, 0x56, 0x75, 0x69, 0x48, 0x03, 0x55, 0x12, 0xD1, 0x7E, 0x80, 0xA1, 0x85,
+    0xBC, 0x69, 0x21, 0xCF, 0x1B, 0xCC, 0xA5, 0x80, 0x76, 0x15, 0xAA, 0xD3, 0x2E, 0x0D, 0xF4, 0xF4,
+    0x14, 0xB4, 0xA8, 0xAE, 0x82, 0xB6, 0x00, 0xF3, 0xB1, 0x25, 0x11, 0x37, 0xC5, 0x2B, 0x59, 0xF8,
+    0xC3, 0xC9, 0xBD, 0x7B, 0x48, 0xC6, 0xEA, 0xFE, 0xD0, 0x3B, 0x8D, 0xD3, 0xCC, 0x3F, 0x4C, 0x13,
+    0x5B, 0x35, 0xC5, 0x00, 0x85, 0x85, 0x7E, 0x0A, 0xB0, 0x0F, 0xB6, 0xCA, 0x3B, 0x55, 0x35, 0xDB,
+    0xAA, 0xD7, 0xE7, 0xF3, 0x5A, 0x64, 0x14, 0x91, 0x7E, 0xFD, 0x85, 0xDC, 0xF9, 0xB0, 0xA0, 0x4D,
+    0x83, 0x76, 0x8F, 0x7C, 0xCC, 0xD7, 0x9B, 0xFD, 0xB7, 0x16, 0x10, 0x51, 0x1D, 0x99, 0xC3, 0x58,
+    0x0A, 0x58, 0x40, 0x4F, 0x1A, 0x50, 0x1E, 0xD3, 0x90, 0x43, 0x09, 0x03, 0x49, 0x40, 0x75, 0x68,
+    0x47, 0x6E, 0xA9, 0xA0, 0x85, 0x58, 0x0F, 0xAB, 0xCD, 0xA9, 0x25, 0x8F, 0x79, 0x9E, 0x3A, 0x58,
+    0x6D, 0x7E, 0xF8, 0x6B, 0x0C, 0xB0, 0x07, 0x6A, 0x80, 0x67, 0x2F, 0x42, 0x0C, 0x64, 0x97, 0x3A,
+    0x4E, 0x2B, 0x47, 0xD0, 0x8D, 0xB6, 0x86, 0x5D, 0xCE, 0xA4, 0x1D, 0xBB, 0x06, 0x2E, 0x5E, 0xDC,
+    0x86, 0xA9, 0xA7, 0xE6, 0xF3, 0x99, 0x88, 0x5C, 0xDA, 0xDF, 0xDF, 0xE7, 0x6C, 0xD2, 0xA7, 0x31,
+    0x0D, 0x69, 0x97, 0x58, 0xDE, 0xBE, 0x96, 0x8A, 0x34, 0xFF, 0x33, 0x8B, 0x50, 0x83, 0x76, 0xA4,
+    0x81, 0x53, 0xAD, 0x16, 0xC9, 0x6F, 0x9F, 0xBB, 0xE2, 0xD2, 0x3B, 0x8E, 0xC3, 0x40, 0xDD, 0x92,
+    0x7F, 0xDC, 0xE4, 0xB7, 0x44, 0x16, 0xC5, 0x68, 0xB6, 0xC8, 0x45, 0xFA, 0xE5, 0x75, 0xD6, 0xDD,
+    0x57, 0x7D, 0x9B, 0x56, 0x24, 0x95, 0xBF, 0x5B, 0xEB, 0xC0, 0x41, 0xD1, 0x30, 0x1C, 0xDC, 0x5B,
+    0x2D, 0x9F, 0x87, 0x65, 0x4B, 0xF2, 0xFF, 0x02, 0xFA, 0x7D, 0x4F, 0x5D, 0xB8, 0xA4, 0x5F, 0xBB,
+    0xFC, 0xD2, 0x27, 0xB2, 0xD1, 0x3F, 0x11, 0x07, 0x33, 0x28, 0x6E, 0xB3, 0x16, 0xB7, 0x7E, 0xC9,
+    0xEF, 0x41, 0x0D, 0xA6, 0x21, 0xF3, 0x24, 0x11, 0x96, 0x90, 0x5B, 0x54, 0x07, 0x03, 0x14, 0x16,
+    0x15, 0x93, 0x66, 0x25, 0x21, 0x95, 0xB8, 0x5D, 0x80, 0xF2, 0x15, 0x0E, 0xFA, 0x99, 0x58, 0x2A,
+    0x19, 0x62, 0xFD, 0x77, 0xEB, 0x0F, 0x7A, 0x56, 0x2F, 0x3A, 0x0E, 0x2A, 0x92, 0xCF, 0x22, 0xEA,
+    0x7F, 0x7B, 0xCC, 0xDF, 0x5A, 0xCA, 0x25, 0xC4, 0x88, 0x3A, 0x0A, 0xE4, 0x2F, 0x38, 0x36, 0xC6,
+    0x9B, 0x98, 0xCB, 0xE7, 0x3E, 0x97, 0x17, 0x6C, 0x62, 0xE1, 0xFC, 0x35, 0x0A, 0xE9, 0xF4, 0xB5,
+    0xF3, 0xBF, 0x88, 0xB4, 0x35, 0xEA, 0x6A, 0x47, 0xBD, 0x37, 0xFF, 0xE9, 0xE7, 0x22, 0xB2, 0xDA,
+    0xDF, 0xFF, 0x07, 0x3F, 0x39, 0xC3, 0xAD, 0x86, 0x8D, 0x3C, 0xA5, 0x44, 0xBC, 0x96, 0x9E, 0xC4,
+    0x42, 0x62, 0x29, 0x06, 0x64, 0x48, 0x26, 0x7D, 0x08, 0xA8, 0x80, 0xFE, 0xE2, 0xC2, 0x5A, 0xBA,
+    0xBF, 0xFC, 0xCC, 0xAA, 0xE3, 0x9C, 0x47, 0xFF, 0x38, 0xEF, 0x5F, 0x36, 0x72, 0xCB, 0x8F, 0x2F,
+    0xC9, 0x4F, 0xBA, 0x64, 0x53, 0x93, 0xC6, 0x9E, 0xEC, 0x3E, 0xE6, 0x3F, 0x8B, 0xA8, 0x23, 0x8F,
+    0x79, 0xD1, 0xB1, 0x2C, 0xAC, 0x8A, 0xB5, 0x2D, 0xFC, 0x4A, 0x3E, 0xB6, 0xAB, 0x4D, 0xC9, 0xCE,
+    0xB1, 0x1C, 0x72, 0x60, 0xF8, 0xF3, 0x59, 0xEE, 0x6B, 0xD9, 0x70, 0x5E, 0x1A, 0x98, 0x06, 0xAC,
+    0x7D, 0xE0, 0xF1, 0xEE, 0xBA, 0x69, 0x45, 0x5E, 0x18, 0x5F, 0x1A, 0xD6, 0x56, 0x7F, 0xD4, 0x51,
+    0x1D, 0xA0, 0x3E, 0x71, 0x54, 0xED, 0xA3, 0x1F, 0xDD, 0xC9, 0xB6, 0xFD, 0x3E, 0xBC, 0xD2, 0x7E,
+    0xF9, 0xE0, 0x24, 0x2D, 0x2D, 0xDF, 0x07, 0xE0, 0x15, 0xDA, 0xC7, 0x39, 0x93, 0x7E, 0x1D, 0x56,
+    0xCD, 0x57, 0x32, 0xE8, 0x92, 0x5F, 0xB5, 0xD4, 0xDA, 0x19, 0xD7, 0xAA, 0xA0, 0xDD, 0x40, 0x5B,
+    0xA3, 0xAF, 0x38, 0x0E, 0x07, 0xB4, 0x74, 0xAC, 0x0B, 0xAB, 0xDD, 0x40, 0xAB, 0x82, 0x76, 0x79,
+    0xD3, 0x72, 0xA0, 0x9D, 0x0A, 0x2D, 0xC6, 0xD1, 0x3E, 0xF4, 0x78, 0xB9, 0xB8, 0x96, 0x8E, 0xCF,
+    0xDD, 0x92, 0x7E, 0x25, 0xAF, 0x8F, 0x3F, 0xBD, 0xF3, 0xE1, 0xEA, 0xBC, 0x53, 0x03, 0xD5, 0x21,
+    0xDA, 0x33, 0x46, 0x0A, 0xD2, 0x3B, 0x8E, 0x16, 0x7D, 0x83, 0x34, 0x50, 0xB4, 0x68, 0xC7, 0x61,
+    0x78, 0xCC, 0xEC, 0x97, 0xF3, 0x5E, 0x5F, 0x91, 0xB8, 0xBE, 0x76, 0xFE, 0xFD, 0xC0, 0xC1, 0x21,
+    0xEA, 0x13, 0xFF, 0x2F, 0x0A, 0xF2, 0x13, 0x47, 0x45, 0x11, 0x49, 0x45, 0xAC, 0xFE, 0xEC, 0xBC,
+    0xCF, 0x1B, 0x15, 0x6A, 0x92, 0x58, 0xC1, 0xB0, 0x84, 0xF6, 0xFE, 0xAB, 0x82, 0xA1, 0x86, 0x3E,
+    0xB7, 0x69, 0x30, 0x5E, 0x77, 0x4A, 0xA4, 0x61, 0xBD, 0x81, 0xC4, 0xF2, 0x72, 0x7E, 0x2D, 0xBD,
+    0x25, 0x83, 0x1E, 0x7F, 0x3C, 0x14, 0x2E, 0x8D, 0x87, 0xA8, 0x4F, 0x23, 0xFA, 0xCB, 0x66, 0x98,
+    0x7D, 0xE4, 0x28, 0x0A, 0xCB, 0xB0, 0x26, 0xFB, 0xAD, 0xB0, 0xD2, 0x37, 0x24, 0x16, 0xB9, 0xD0,
+    0x26, 0xF6, 0x2B, 0x0C, 0xFC, 0x9E, 0x3A, 0xFE, 0xF8, 0xB1, 0xD5, 0xB1, 0x7E, 0x50, 0x1D, 0x1F,
+    0xB0, 0xD2, 0x97, 0x9F, 0xF9, 0xE8, 0xF5, 0xCD, 0xE1, 0xED, 0x17, 0x7A, 0xD6, 0x68, 0x4F, 0x8B,
+    0x76, 0x0F, 0xBD, 0xA5, 0xF2, 0x56, 0x2E, 0x43, 0xFD, 0xA3, 0x76, 0x01, 0x0B, 0xD8, 0x83, 0xA2,
+    0x43, 0x8F, 0x96, 0x75, 0x20, 0x1B, 0xE0, 0x00, 0x2A, 0xA8, 0x5E, 0xE6, 0x60, 0x25, 0x7D, 0x21,
+    0x7E, 0x82, 0x3C, 0xFE, 0x0A, 0xE5, 0x29, 0xC9, 0x7F, 0xFF, 0xF7, 0x22, 0xCF, 0x5C, 0x9F, 0x2D,
+    0xC9, 0x3C, 0x0F, 0xDC, 0x94, 0xA7, 0x26, 0x95, 0xA0, 0x85, 0x84, 0x57, 0x48, 0xFF, 0xDE, 0x3D,
+    0xCE, 0x58, 0xED, 0x1D, 0x60, 0xAE, 0x46, 0x35, 0x16, 0x72, 0xA7, 0x5B, 0x6D, 0xCE, 0x70, 0x12,
+    0x7E, 0x0D, 0xFF, 0x75, 0x3B, 0x93, 0x1B, 0x47, 0x9F, 0x93, 0xB9, 0x8A, 0x9A, 0x96, 0x98, 0x44,
+    0xED, 0x54, 0x57, 0x4D, 0x98, 0xCB, 0x0B, 0x8E, 0xAA, 0x82, 0x65, 0x00, 0x71, 0xA4, 0x1B, 0xC8,
+    0x02, 0xAF, 0xF0, 0xBD, 0x86, 0xFF, 0x12, 0x59, 0x91, 0x1D, 0x75, 0xE9, 0x48, 0x61, 0x9C, 0x69,
+    0xE9, 0x0B, 0x76, 0x83, 0xF2, 0xCB, 0xF4, 0x96, 0xCF, 0xE9, 0xCD, 0xEB, 0xAE, 0x4D, 0xC3, 0x6E,
+    0xAE, 0xBA, 0xEC, 0xDD, 0x50, 0x1A, 0x6B, 0x5E, 0x6C, 0x2E, 0x2E, 0xA8, 0xCA, 0xE4, 0xD3, 0xC0,
+    0x41, 0x50, 0x57, 0x9A, 0xE4, 0x4E, 0x63, 0x5A, 0xD4, 0x86, 0x22, 0x60, 0x02, 0x75, 0x43, 0xD1,
+    0xB0, 0xE1, 0x87, 0x24, 0x6F, 0x2D, 0x31, 0xAE, 0xA5, 0x65, 0xC8, 0x7C, 0xD2, 0x57, 0xA4, 0xB7,
+    0x02, 0x4A, 0x2C, 0xAA, 0x9F, 0x62, 0x48, 0xF1, 0xE8, 0x2B, 0x8E, 0x3D, 0xD3, 0xA8, 0x90, 0xDB,
+    0x82, 0x22, 0x89, 0xD4, 0xA6, 0x61, 0xEF, 0xBE, 0x3E, 0x69, 0x47, 0x9F, 0xDB, 0xCC, 0x57, 0x14,
+    0xB4, 0xF4, 0xC4, 0xCC, 0xA5, 0xA1, 0x26, 0x73, 0x11, 0xF3, 0x9A, 0xA3, 0xA8, 0xA0, 0x8C, 0xB0,
+    0x76, 0x24, 0xE3, 0xE4, 0x19, 0x8D, 0x83, 0xF2, 0x2E, 0xFA, 0x95, 0x0C, 0xA4, 0xE2, 0xD0, 0x3D,
+    0xF0, 0xC3, 0xFD, 0x5F, 0xAF, 0x64, 0x73, 0x6A, 0x3E, 0x90, 0xF4, 0xA8, 0x70, 0x6F, 0x7A, 0x1C,
+    0x48, 0x22, 0xAA, 0xC3, 0x38, 0x0A, 0x58, 0x82, 0xC8, 0x28, 0x32, 0x92, 0xFC, 0x77, 0x56, 0x4E,
+    0xDD, 0x26, 0xB7, 0xB4, 0xA4, 0x01, 0xED, 0x28, 0x98, 0x92, 0xA6, 0x49, 0x06, 0xEA, 0x06, 0xB1,
+    0x14, 0x96, 0x9A, 0x07, 0x2A, 0x64, 0x1E, 0xD3, 0x63, 0x02, 0x49, 0xC3, 0xEE, 0xA3, 0x0E, 0xFE,
+    0x35, 0x88, 0x4D, 0xD6, 0x50, 0x41, 0x8F, 0xEA, 0x30, 0xCD, 0xDD, 0xA4, 0x76, 0x18, 0x8F, 0x8E,
+    0xAC, 0x7C, 0xD6, 0x51, 0x3C, 0x58, 0x21, 0xB7, 0x7A, 0xA0, 0x76, 0x5C, 0x98, 0x26, 0xA5, 0x55,
+    0xE4, 0x35, 0x19, 0xCF, 0xFF, 0x4D, 0x2A, 0x3D, 0xFC, 0x3B, 0xCB, 0x89, 0x1D, 0x2A, 0xE5, 0x6B,
+    0xD5, 0x15, 0x2A, 0xE4, 0xCF, 0x85, 0xFC, 0xB9, 0xA8, 0xDD, 0xC0, 0x60, 0x1A, 0xF3, 0x8B, 0x98,
+    0xC4, 0xC2, 0xE6, 0xCF, 0x85, 0xD4, 0x97, 0x00, 0x27, 0x52, 0x0A, 0xD5, 0xA9, 0x50, 0x51, 0x65,
+    0x3E, 0xEB, 0x96, 0x2C, 0xB5, 0x33, 0xAE, 0x37, 0x6E, 0xD0, 0x6E, 0xC8, 0x7C, 0xAB, 0xBA, 0x65,
+    0xD2, 0x9D, 0x9E, 0x5A, 0xD9, 0xE1, 0x78, 0x09, 0xBF, 0x07, 0xB0, 0x64, 0x8B, 0xA2, 0xDE, 0xDD,
+    0x68, 0xA0, 0x62, 0x82, 0xBF, 0x30, 0x11, 0xA8, 0x02, 0xA4, 0xB7, 0x1C, 0x98, 0x37, 0x1A, 0x58,
+    0x14, 0x4C, 0x11, 0xBF, 0xB1, 0x03, 0xB4, 0x49, 0x40, 0x75, 0x53, 0x4F, 0x1C, 0x6B, 0x11, 0xAB,
+    0x44, 0x46, 0xF2, 0xFD, 0xFD, 0x81, 0x01, 0x62, 0xE6, 0x51, 0xA1, 0x80, 0xCC, 0xF7, 0x60, 0x5E,
+    0x73, 0x50, 0xD4, 0x53, 0x9B, 0x89, 0xDD, 0x72, 0x91, 0x46, 0x26, 0x23, 0x27, 0xB2, 0xC5, 0xEC,
+    0xBE, 0x33, 0x26, 0x66, 0x4C, 0x48, 0x34, 0xAB, 0x00, 0xD9, 0x51, 0x80, 0x32, 0xED, 0xC0, 0xDE,
+    0x0D, 0x13, 0xBE, 0x03, 0x26, 0x9E, 0x00, 0x68, 0x8D, 0x45, 0x85, 0x25, 0xA4, 0x77, 0x51, 0x67,
+    0xD8, 0x46, 0xAD, 0xAC, 0x00, 0xB5, 0x01, 0x4C, 0x0B, 0xB4, 0x01, 0xD4, 0xD5, 0x0E, 0x72, 0xED,
+    0x60, 0x30, 0x76, 0x02, 0x1B, 0x8A, 0x29, 0x96, 0xEC, 0xC9, 0x7C, 0x1A, 0x28, 0x44, 0x3C, 0x22,
+    0xD2, 0x64, 0xBF, 0xDF, 0x5F, 0x53, 0x43, 0x99, 0x44, 0x18, 0xB4, 0x9B, 0x66, 0x07, 0xF5, 0x7F,
+    0x02, 0xE8, 0x2B, 0x5B, 0x3C, 0xFF, 0x4F, 0x8A, 0x9E, 0x29, 0x0F, 0x49, 0xB7, 0x2D, 0x4A, 0xBB,
+    0x49, 0xD7, 0xBE, 0x77, 0x30, 0xF5, 0x28, 0x99, 0xC1, 0xDE, 0xBD, 0xE9, 0xBA, 0xD9, 0xC2, 0xCE,
+    0x13, 0xA2, 0xF5, 0xE2, 0x9B, 0xF3, 0xE7, 0x1F, 0x82, 0x72, 0xD4, 0x22, 0x46, 0xE4, 0xF2, 0xF5,
+    0xB9, 0x7D, 0x18, 0xFE, 0xF1, 0xE6, 0xFC, 0x79, 0x91, 0x28, 0xB2, 0x81, 0xB3, 0xB0, 0x82, 0x1A,
+    0x0A, 0xC8, 0x8F, 0x35, 0xEB, 0x5B, 0x21, 0xBD, 0x03, 0xA6, 0xC3, 0x8C, 0xE8, 0xF7, 0xBC, 0x76,
+    0x65, 0x32, 0xE9, 0xCB, 0xB7, 0xC3, 0xF5, 0x09, 0x62, 0x41, 0xA5, 0xDD, 0x93, 0xC7, 0x4E, 0x41,
+    0x4D, 0x25, 0xD5, 0x7C, 0xFE, 0x30, 0xD8, 0x47, 0x64, 0xA8, 0x45, 0xCC, 0x9B, 0xF3, 0x87, 0x01,
+    0x42, 0xD5, 0x7C, 0x6E, 0x44, 0x8E, 0x44, 0xE2, 0x59, 0xF6, 0x28, 0xAC, 0x76, 0x69, 0xC7, 0x0C,
+    0xFE, 0x08, 0x74, 0xEC, 0x14, 0xB9, 0x33, 0x4E, 0x3B, 0xE5, 0xB0, 0x90, 0x4A, 0xBF, 0x1E, 0x1F,
+    0x0F, 0x2C, 0xD3, 0x72, 0x24, 0x3D, 0x33, 0x6A, 0xA7, 0xC7, 0xF4, 0x66, 0x6C, 0xD5, 0x87, 0xEC,
+    0x40, 0x2A, 0x7D, 0x21, 0x4D, 0x6E, 0x93, 0xC8, 0x63, 0xDD, 0x0A, 0x79, 0x5E, 0x7A, 0x12, 0xE5,
+    0xDB, 0x4A, 0xBF, 0xDB, 0xFC, 0xF5, 0xB4, 0x1D, 0x23, 0xAF, 0x4A, 0xFF, 0xB8, 0x04, 0x92, 0x98,
+    0x4A, 0xAC, 0xA5, 0x61, 0x87, 0x13, 0xA8, 0x4D, 0x66, 0xB9, 0x23, 0x81, 0x3F, 0x57, 0x1B, 0xB0,
+    0x5B, 0x5F, 0xF3, 0xA7, 0x46, 0xAC, 0x92, 0x19, 0xC7, 0xDB, 0x34, 0xFD, 0x5D, 0x87, 0x6B, 0xB8,
+    0xDF, 0xD9, 0x7D, 0xA7, 0x78, 0x16, 0x93, 0x95, 0xA9, 0x78, 0xBC, 0x21, 0x60, 0x1A, 0xB6, 0xD0,
+    0xD4, 0x89, 0xFF, 0x4F, 0x0C, 0x9D, 0x02, 0x58, 0x5B, 0xA6, 0xC5, 0xBC, 0xFA, 0x6D, 0x00, 0x63,
+    0x5B, 0x78, 0xE2, 0xBE, 0xDD, 0x96, 0xEF, 0x92, 0xA1, 0x64, 0x5A, 0xF3, 0xC4, 0xED, 0x2D, 0xB5,
+    0x3F, 0xBB, 0xDF, 0x29, 0x7F, 0xB7, 0xBC, 0x9C, 0x3A, 0x46, 0xDD, 0x87, 0xE3, 0xA1, 0x8A, 0x1C,
+    0xEF, 0x42, 0x25, 0xE1, 0x8F, 0xC6, 0xAF, 0xBE, 0x94, 0x71, 0xD5, 0x43, 0x1C, 0xA0, 0x2D, 0x1A,
+    0x6A, 0x75, 0x9B, 0x35, 0xB5, 0x88, 0x4D, 0x64, 0xDC, 0xEA, 0x08, 0x3B, 0x16, 0x74, 0x37, 0xB9,
+    0x7E, 0x15, 0xB6, 0x0E, 0x7C, 0xF6, 0x9D, 0xB4, 0x9D, 0xCC, 0x20, 0x19, 0x01, 0xF1, 0xD0, 0xB7,
+    0xD0, 0x67, 0x8E, 0x13, 0x93, 0x8A, 0xFE, 0xC9, 0xFB, 0x9D, 0x40, 0xAE, 0xBA, 0x69, 0xB2, 0x9E,
+    0xFD, 0xAB, 0xBB, 0x23, 0x9F, 0xB9, 0xAF, 0x85, 0x19, 0xDE, 0xCD, 0x78, 0xC3, 0xA2, 0x8E, 0x02,
+    0x69, 0x38, 0x84, 0xC1, 0x5C, 0x4B, 0x07, 0x44, 0x36, 0x64, 0xD2, 0x4F, 0xF1, 0xD0, 0x0C, 0x6A,
+    0xC8, 0x3A, 0x58, 0x4C, 0x6D, 0x9D, 0x00, 0x48, 0xD7, 0x17, 0xB4, 0x8C, 0xE9, 0xB5, 0xDC, 0x4F,
+    0x80, 0x06, 0x68, 0xC7, 0x4B, 0xA1, 0x90, 0x61, 0x75, 0xFD, 0x7C, 0x8D, 0xBE, 0x41, 0x7A, 0xC7,
+    0x31, 0x06, 0x56, 0x7B, 0xAC, 0xAE, 0xC8, 0x26, 0xAC, 0xFB, 0x5D, 0xEC, 0x16, 0xBB, 0x86, 0xC2,
+    0x92, 0x5B, 0x8C, 0xDD, 0x7A, 0x9B, 0xAF, 0x4B, 0x6D, 0x07, 0x74, 0x40, 0x0B, 0xD9, 0x51, 0x97,
+    0xB9, 0x6A, 0x1B, 0x23, 0x7D, 0x5D, 0x6A, 0x16, 0xFA, 0x9C, 0x3A, 0xF3, 0xF7, 0xE2, 0x9D, 0xEF,
+    0x8D, 0xB6, 0x90, 0x5E, 0x5F, 0x58, 0x59, 0x54, 0x80, 0x16, 0x0A, 0x92, 0x73, 0x6E, 0x2D, 0x37,
+    0xE5, 0xCD, 0x76, 0xA0, 0x68, 0xD1, 0x37, 0x50, 0x77, 0x5C, 0xB2, 0xE9, 0x13, 0xA9, 0xE5, 0xF3,
+    0x4B, 0xD2, 0x85, 0x84, 0xAF, 0x07, 0x03, 0x69, 0x8B, 0x72, 0x24, 0x87, 0xA0, 0x1C, 0x04, 0x9E,
+    0xEE, 0xD1, 0x3D, 0xCC, 0xB6, 0x9F, 0x2C, 0x4C, 0x1B, 0xEC, 0x99, 0x3B, 0x36, 0xB3, 0x27, 0x47,
+    0x9B, 0xCA, 0xC8, 0xE1, 0x8F, 0xFB, 0xDC, 0xEA, 0xCB, 0x81, 0xAA, 0x42, 0x7D, 0x7E, 0x7D, 0xBE,
+    0x5A, 0x89, 0x7C, 0xFE, 0xC5, 0xFE, 0xFE, 0x72, 0x5A, 0x99, 0x1E, 0x83, 0x84, 0x5D, 0xD2, 0xD4,
+    0xB2, 0x61, 0x2D, 0x0D, 0x27, 0xA7, 0x51, 0x30, 0x8E, 0xF4, 0xEE, 0xDC, 0x8C, 0xFD, 0xC6, 0x34,
+    0x77, 0x20, 0x1D, 0x60, 0x15, 0xC8, 0x5F, 0x74, 0xCA, 0x9F, 0xE1, 0xC4, 0x24, 0xC5, 0x6F, 0x42,
+    0xD3, 0x42, 0xA1, 0x7C, 0x1A, 0x4A, 0xFE, 0xEC, 0x6E, 0xF4, 0xFB, 0x4D, 0x00, 0xAD, 0x53, 0x1C,
+    0x30, 0xD0, 0x13, 0x99, 0xC1, 0x2B, 0x8F, 0x80, 0x47, 0x93, 0x59, 0xDE, 0x0C, 0xDA, 0x2D, 0x12,
+    0x0B, 0x4F, 0x3F, 0x02, 0x41, 0x85, 0x93, 0xA8, 0x9E, 0x3A, 0xAA, 0x9B, 0xF1, 0x4C, 0x12, 0x67,
+    0x58, 0xE0, 0xE9, 0x07, 0x97, 0x6E, 0x5F, 0x99, 0x24, 0x31, 0xCF, 0xFD, 0xCE, 0x0F, 0x5B, 0x73,
+    0x7E, 0x1A, 0xED, 0xD2, 0x40, 0x4B, 0xF1, 0xD5, 0x09, 0x66, 0x09, 0xB5, 0xFF, 0x8F, 0x66, 0x2D,
+    0xF8, 0x95, 0x7B, 0x62, 0x32, 0xC7, 0xAF, 0x0D, 0xD4, 0x9C, 0x05, 0x0E, 0x99, 0x60, 0x12, 0xED,
+    0xBE, 0xE4, 0x4B, 0xBF, 0x0D, 0x10, 0x67, 0x9A, 0x29, 0xF6, 0xA6, 0x89, 0x22, 0xBD, 0xFF, 0x13,
+    0x88, 0x6F, 0x89, 0x7E, 0x62, 0xA7, 0x85, 0x7F, 0x1D, 0xA1, 0x5D, 0x92, 0x76, 0xB9, 0x4D, 0x8E,
+    0x57, 0x4A, 0xDF, 0x0A, 0xFF, 0x4F, 0x40, 0x2C, 0xA6, 0xEB, 0x67, 0xF7, 0x7C, 0xEE, 0xB7, 0x41,
+    0x3B, 0x99, 0x4D, 0x6B, 0x94, 0x83, 0x2D, 0x3A, 0xD5, 0x6C, 0xE3, 0x8E, 0x27, 0x1B, 0x7E, 0xD0,
+    0x3E, 0x0E, 0x66, 0x99, 0x7D, 0xE2, 0x19, 0x6B, 0x5B, 0xFF, 0x56, 0xE4, 0x30, 0x93, 0xDF, 0x74,
+    0x89, 0x05, 0xCE, 0x82, 0x71, 0xA8, 0x69, 0x5B, 0xC6, 0xB0, 0xB5, 0xEC, 0x6F, 0x44, 0x73, 0x67,
+    0x42, 0xEB, 0xD7, 0x1D, 0x45, 0xDE, 0x64, 0xAE, 0x64, 0xC6, 0xEC, 0x9B, 0xD2, 0xB4, 0x50, 0x65,
+    0x4E, 0x75, 0x2D, 0x4F, 0xA5, 0xC7, 0x96, 0xFD, 0x4D, 0x30, 0x2B, 0x8E, 0xBF, 0x0C, 0x12, 0x11,
+    0xAF, 0x45, 0x44, 0xA2, 0xBE, 0x9D, 0x6C, 0xE6, 0x67, 0xB3, 0x40, 0xC1, 0x16, 0x9A, 0x99, 0x60,
+    0x6C, 0x5A, 0x68, 0x8F, 0xD7, 0x60, 0xA6, 0x41, 0x3B, 0x54, 0x47, 0x2A, 0x12, 0x7A, 0x58, 0xCB,
+    0x50, 0x41, 0x31, 0x3F, 0xBB, 0x2D, 0x08, 0xF7, 0xFD, 0x23, 0xB7, 0xF7, 0x48, 0xB1, 0x9A, 0x06,
+    0xAD, 0x67, 0x33, 0x3F, 0xCB, 0x5A, 0x44, 0xC4, 0x4E, 0x8D, 0x6F, 0xE1, 0xFC, 0xE2, 0x1A, 0xEB,
+    0x0B, 0x14, 0x12, 0x56, 0xE2, 0xF4, 0xB5, 0xF3, 0x57, 0x3E, 0x38, 0x4C, 0x22, 0xAB, 0x90, 0xC4,
+    0x9A, 0x74, 0xC0, 0xFC, 0xB2, 0x23, 0x77, 0xB4, 0x4B, 0xD8, 0xCC, 0xFF, 0xF6, 0x3D, 0x8F, 0x11,
+    0x19, 0x96, 0x30, 0xEE, 0xEF, 0xBF, 0xE6, 0x31, 0xCD, 0x76, 0xCF, 0x05, 0xD5, 0x91, 0x3B, 0x28,
+    0x50, 0x23, 0xB0, 0x61, 0xD3, 0xF3, 0xB2, 0x12, 0xF9, 0x89, 0x88, 0xD5, 0xD2, 0x68, 0xE9, 0x48,
+    0x20, 0xB1, 0x4C, 0xDF, 0x13, 0x7D, 0x38, 0x6D, 0x93, 0xDC, 0x3B, 0x3E, 0x9B, 0xCF, 0xE7, 0xF3,
+    0xF9, 0xDC, 0x66, 0xAF, 0xFA, 0xD0, 0xD6, 0xE6, 0x75, 0x3F, 0x33, 0xAF, 0xFD, 0x26, 0x0C, 0xA5,
+    0xC9, 0x1A, 0x9B, 0x35, 0xE1, 0x74, 0xE6, 0x42, 0xA5, 0x5D, 0xAC, 0xB5, 0xEB, 0x6B, 0xED, 0x87,
+    0x9D, 0xC4, 0x9A, 0x57, 0xC3, 0xD2, 0x5C, 0x0A, 0x95, 0x79, 0x37, 0x94, 0xDA, 0x85, 0x32, 0x6B,
+    0xC2, 0x13, 0x09, 0x27, 0xF9, 0x6B, 0xFE, 0x4D, 0xAF, 0x42, 0x26, 0x5D, 0xEE, 0x8B, 0x1B, 0xB6,
+    0x66, 0xEF, 0x24, 0x27, 0x98, 0xFD, 0x33, 0xBD, 0x98, 0xCF, 0xAB, 0x1D, 0x47, 0x76, 0xC7, 0x3F,
+    0xDD, 0x15, 0xAB, 0xC1, 0x0D, 0x53, 0x59, 0x98, 0x40, 0x50, 0xA0, 0xB7, 0xE3, 0xCD, 0xF4, 0x3A,
+    0xE0, 0xEA, 0x2A, 0x8F, 0x21, 0x5E, 0x64, 0x61, 0x2D, 0xE6, 0xCA, 0x0B, 0x2D, 0xBC, 0xC9, 0x42,
+    0x28, 0x01, 0xFD, 0x03, 0xF7, 0xBE, 0xDB, 0x89, 0x97, 0x5A, 0x58, 0x90, 0x31, 0xB3, 0xF0, 0x22,
+    0x26, 0x84, 0x60, 0xAE, 0x16, 0xDE, 0x0A, 0xD2, 0x4F, 0x5D, 0xF8, 0x2D, 0x4C, 0xD0, 0x42, 0xA5,
+    0xBC, 0x80, 0x09, 0x5A, 0xB8, 0x93, 0xA7, 0xC7, 0xC0, 0x3C, 0x88, 0x8A, 0xA8, 0x14, 0xF7, 0xF3,
+    0xEB, 0x7B, 0x4F, 0x16, 0xFD, 0x34, 0x96, 0x65, 0xD9, 0xE3, 0xC4, 0xE3, 0x34, 0x9C, 0x5F, 0x55,
+    0xD5, 0x55, 0x5D, 0xD5, 0xE7, 0x7C, 0xCF, 0xE9, 0xC6, 0xFD, 0x21, 0x63, 0x83, 0xD5, 0x6D, 0xF1,
+    0x7A, 0x00, 0x00, 0x25, 0x92, 0x44, 0xB6, 0xCD, 0x62, 0xA1, 0x1D, 0x2A, 0x40, 0x02, 0x03, 0xE7,
+    0x86, 0xC8, 0x64, 0x45, 0xF4, 0xFB, 0x8B, 0x6F, 0xF4, 0x24, 0x68, 0x16, 0x0B, 0x2D, 0x72, 0x28,
+    0x92, 0x60, 0x04, 0x8A, 0x08, 0xD8, 0x00, 0x9C, 0x79, 0x28, 0xEF, 0x01, 0x4D, 0x03, 0x59, 0xEC,
+    0x40, 0xFB, 0x04, 0x46, 0x45, 0xF2, 0x58, 0x78, 0x74, 0xAB, 0x5B, 0x56, 0xD4, 0xE4, 0x22, 0x5B,
+    0xB4, 0xC8, 0xC8, 0xDE, 0xE6, 0x56, 0x54, 0x11, 0x15, 0x2A, 0x87, 0xF6, 0x1D, 0x54, 0x6F, 0x0C,
+    0xD0, 0x54, 0x40, 0x37, 0x41, 0x96, 0xAC, 0x88, 0x17, 0x91, 0x37, 0x8E, 0x17, 0xBF, 0xD0, 0x0E,
+    0x0C, 0x90, 0x40, 0x05, 0xD0, 0x0E, 0xEC, 0xE6, 0x12, 0x22, 0xA3, 0xFA, 0xF2, 0xE3, 0x49, 0xBB,
+    0x7C, 0x32, 0xA8, 0x98, 0x28, 0x0E, 0x03, 0xD5, 0x5B, 0x8E, 0x95, 0x21, 0x8F, 0x89, 0xEA, 0xE0,
+    0xF8, 0xF2, 0x56, 0x8B, 0x04, 0x2B, 0x0F, 0x99, 0x49, 0x7C, 0xB3, 0xF8, 0x38, 0x1A, 0x54, 0x32,
+    0x30, 0x7E, 0x45, 0x79, 0x34, 0x94, 0x83, 0x95, 0x9D, 0xB3, 0xB2, 0x73, 0x0D, 0x57, 0xA2, 0x21,
+    0x9B, 0x0C, 0x74, 0x06, 0x56, 0xE7, 0xD4, 0x19, 0xB2, 0xA9, 0xE1, 0x4A, 0xB2, 0x22, 0xC1, 0xCA,
+    0x16, 0x2B, 0xA2, 0x45, 0x0E, 0x8E, 0x17, 0x97, 0x9E, 0x3F, 0xAA, 0xEF, 0x6F, 0x80, 0x16, 0x89,
+    0x14, 0x22, 0x5B, 0xB2, 0xD3, 0xC5, 0x75, 0xC7, 0x92, 0x22, 0x50, 0x91, 0x25, 0x0A, 0xCF, 0x8A,
+    0x3C, 0x52, 0x39, 0x3A, 0x8A, 0x40, 0x4D, 0x96, 0x28, 0x5B, 0x56, 0xA8, 0x81, 0xCA, 0x31, 0x52,
+    0x04, 0x0C, 0x59, 0xA2, 0x72, 0xAC, 0x28, 0x3D, 0x95, 0x53, 0x03, 0x45, 0xC8, 0x12, 0x59, 0x62,
+    0x82, 0x55, 0x76, 0x67, 0xB1, 0xB8, 0x7E, 0x59, 0x44, 0x44, 0x7A, 0x11, 0x91, 0x47, 0x40, 0x7E,
+    0xE6, 0x81, 0x3B, 0x11, 0xA8, 0x3B, 0xA0, 0xFC, 0x37, 0x20, 0xFB, 0xD0, 0x8A, 0xBC, 0x25, 0x72,
+    0xF8, 0x2D, 0xBB, 0x11, 0x39, 0x10, 0x89, 0xA7, 0x8B, 0x4B, 0x2F, 0xDA, 0xCD, 0xF1, 0xE2, 0x92,
+    0xC8, 0xD6, 0x8A, 0xB8, 0x06, 0x12, 0x45, 0xD8, 0x47, 0x05, 0x2C, 0x13, 0xDA, 0xE5, 0x91, 0x11,
+    0x43, 0xD5, 0xE6, 0x89, 0xC4, 0x84, 0x8A, 0x2A, 0x94, 0x1E, 0x35, 0x68, 0xB7, 0x07, 0x65, 0x30,
+    0x2A, 0x82, 0xF6, 0xA9, 0x9E, 0x8F, 0x62, 0x04, 0xAC, 0xC8, 0x00, 0xEA, 0xC9, 0xDE, 0x3B, 0x1E,
+    0x6A, 0x97, 0xB4, 0x87, 0xE9, 0xDC, 0x53, 0xB4, 0xB3, 0xB0, 0x87, 0xC1, 0xA2, 0x22, 0x89, 0x7D,
+    0x6A, 0xA7, 0x02, 0x53, 0x36, 0xA2, 0x5D, 0x36, 0x6A, 0x8F, 0x21, 0x4F, 0xFB, 0x90, 0x50, 0x11,
+    0xE0, 0xBA, 0x84, 0x42, 0x24, 0xFE, 0xC4, 0x55, 0x11, 0xB4, 0x87, 0xCA, 0xC1, 0x0A, 0xB2, 0x04,
+    0xDA, 0x93, 0x4D, 0x58, 0x69, 0x91, 0x1D, 0x2C, 0xFA, 0x16, 0x6A, 0x07, 0x16, 0xE8, 0x20, 0x3F,
+    0xBF, 0x61, 0xEF, 0x4F, 0xB9, 0x18, 0x45, 0xE4, 0x75, 0x91, 0x81, 0x6C, 0xF6, 0xC5, 0xF2, 0x20,
+    0xCC, 0x0E, 0x62, 0x0F, 0x02, 0xE5, 0x64, 0xC8, 0xBE, 0x38, 0x08, 0x34, 0x4B, 0x43, 0xF9, 0xE9,
+    0x41, 0xC8, 0xD2, 0xD2, 0xD0, 0x14, 0x07, 0xA1, 0xF4, 0x4B, 0x43, 0x2A, 0x0E, 0x42, 0xC3, 0xD2,
+    0x14, 0xBE, 0x38, 0x08, 0x89, 0xA5, 0xB1, 0x14, 0x07, 0x9F, 0x79, 0x96, 0x66, 0xA4, 0x38, 0x10,
+    0x58, 0x5A, 0x4F, 0x71, 0x30, 0xC2, 0xD2, 0x42, 0xE1, 0x79, 0x05, 0x47, 0xE1, 0x0D, 0xD8, 0x77,
+    0x3C, 0x48, 0x82, 0xEC, 0x17, 0x73, 0xF4, 0xFE, 0xC8, 0x2B, 0x9F, 0x3B, 0x79, 0x32, 0xA8, 0x68,
+    0x28, 0xBD, 0xA1, 0x72, 0x86, 0x06, 0xC3, 0x84, 0xC9, 0x12, 0x46, 0x0D, 0x58, 0xF1, 0x58, 0xF1,
+    0x34, 0x6F, 0x0F, 0x98, 0x3C, 0xCD, 0x7D, 0xEC, 0x61, 0xA8, 0x9D, 0x41, 0x7B, 0x43, 0x31, 0x18,
+    0xF2, 0x64, 0x60, 0x32, 0xB0, 0x87, 0x15, 0x09, 0x4A, 0x64, 0x47, 0xB3, 0xB8, 0x32, 0xA8, 0x40,
+    0x83, 0x41, 0xCD, 0xCA, 0x6B, 0xA8, 0xA1, 0xF0, 0x34, 0x2C, 0x9F, 0x55, 0x4A, 0x4F, 0x43, 0xF7,
+    0x54, 0xB9, 0x8D, 0x1A, 0x74, 0x4B, 0x43, 0x42, 0x0D, 0x15, 0x34, 0x6F, 0x46, 0xD4, 0xA3, 0x2D,
+    0x34, 0xD2, 0xA2, 0xFE, 0xDD, 0x01, 0xB6, 0x85, 0xEA, 0x68, 0x82, 0x7C, 0x67, 0x07, 0xB0, 0x47,
+    0x8F, 0xA0, 0xD8, 0x99, 0x04, 0x5F, 0x1C, 0xDD, 0x6B, 0xA9, 0x9A, 0xD7, 0x96, 0xE4, 0x47, 0x47,
+    0x07, 0x01, 0xD3, 0x98, 0x9A, 0xE2, 0xE0, 0xE8, 0x7E, 0x64, 0x6C, 0x8C, 0x6E, 0xB5, 0x3A, 0x0A,
+    0x5D, 0x1E, 0x1B, 0xA3, 0x82, 0x51, 0x47, 0xA1, 0x29, 0x7C, 0x63, 0xB2, 0x78, 0x5B, 0x1D, 0x05,
+    0xFD, 0x96, 0x6B, 0x0C, 0xFB, 0x51, 0x1D, 0x85, 0x62, 0x47, 0x63, 0xB0, 0x5E, 0x1D, 0x85, 0x7C,
+    0xA4, 0x31, 0x68, 0xA7, 0x06, 0x03, 0xE5, 0x7B, 0x0E, 0xF5, 0x38, 0xC0, 0x94, 0xC0, 0x1A, 0xD0,
+    0xF7, 0xBE, 0xD1, 0x20, 0x22, 0x8F, 0x45, 0x64, 0x3A, 0x5D, 0x2C, 0xD6, 0x2F, 0x1E, 0xF1, 0x7C,
+    0x83, 0x9F, 0xDF, 0x74, 0x29, 0x03, 0xAC, 0x65, 0x47, 0xBE, 0x73, 0xBD, 0x2F, 0x22, 0xE5, 0xA0,
+    0x3D, 0x2A, 0x56, 0x8E, 0x6C, 0xAC, 0x81, 0xC9, 0x02, 0x5D, 0x03, 0xAC, 0x5E, 0xC4, 0x2C, 0xD0,
+    0x59, 0x60, 0xAA, 0x1C, 0x8C, 0xDA, 0xA3, 0x62, 0x11, 0x29, 0x87, 0x7C, 0xCB, 0xDA, 0xD3, 0xCB,
+    0x0E, 0x4A, 0x49, 0xC0, 0x2B, 0x60, 0x45, 0xE4, 0x2D, 0x11, 0x39, 0x3A, 0x5E, 0x2C, 0xC6, 0x04,
+    0x8D, 0x01, 0xFD, 0x9E, 0x43, 0x1D, 0x05, 0xF8, 0x21, 0x0D, 0xAD, 0x95, 0x0F, 0x11, 0x99, 0xD4,
+    0xF1, 0x5F, 0x4E, 0xDA, 0xE5, 0xE3, 0x8C, 0xD3, 0xE5, 0x41, 0xA0, 0xD6, 0x8E, 0x6E, 0x36, 0xEB,
+    0x37, 0x8E, 0xAF, 0x8C, 0x5A, 0xA4, 0xB5, 0x72, 0xF3, 0x59, 0x8C, 0x7F, 0x0E, 0xF2, 0x0D, 0xE7,
+    0x57, 0xD6, 0xEF, 0x5C, 0x21, 0x92, 0x8A, 0xED, 0xEB, 0x9D, 0x4A, 0xA0, 0x12, 0x64, 0xE3, 0x1C,
+    0xB3, 0x58, 0x40, 0xB7, 0xA0, 0x06, 0xE6, 0x2C, 0xD5, 0x3C, 0x6D, 0x88, 0xC0, 0x04, 0xD4, 0x4F,
+    0x8D, 0x1E, 0xD0, 0xA7, 0xFC, 0x15, 0xBD, 0x08, 0xB9, 0x48, 0x4B, 0x76, 0x89, 0xFE, 0x1C, 0x29,
+    0x17, 0x57, 0x8E, 0x17, 0xA8, 0xC0, 0xEF, 0x83, 0x3A, 0x50, 0x47, 0x03, 0xAC, 0x6A, 0xD0, 0x7E,
+    0x24, 0x4B, 0xA5, 0xA7, 0xA6, 0x41, 0x0D, 0x79, 0xA4, 0x9B, 0xD3, 0x63, 0x97, 0x25, 0xD4, 0x60,
+    0xA1, 0x2E, 0x02, 0x8C, 0x1D, 0x94, 0x9F, 0x3B, 0xB0, 0x11, 0xF2, 0x1D, 0xB3, 0x63, 0x64, 0xE3,
+    0xF9, 0x0E, 0xAB, 0x00, 0xFD, 0x08, 0xE5, 0x0E, 0xF8, 0x03, 0x7E, 0x7B, 0x65, 0x11, 0xA0, 0x02,
+    0xF8, 0xA3, 0x53, 0x07, 0x6B, 0x91, 0x80, 0x3D, 0x13, 0x69, 0xF5, 0x50, 0xD1, 0xE7, 0x29, 0x8B,
+    0x79, 0xB2, 0x54, 0xE8, 0x4F, 0x43, 0x16, 0xE9, 0x96, 0x54, 0x14, 0x9F, 0xF9, 0x2C, 0xB2, 0x9A,
+    0xD5, 0x90, 0x45, 0x3A, 0x4B, 0x85, 0xFE, 0x64, 0xCC, 0x62, 0x9E, 0xF4, 0x50, 0x65, 0x3B, 0xEC,
+    0xD9, 0x99, 0xB4, 0xF3, 0x64, 0xF3, 0xBC, 0xF3, 0x12, 0xF3, 0x6A, 0x2F, 0xCD, 0x87, 0x5C, 0x95,
+    0x01, 0xDD, 0x4E, 0x94, 0xBE, 0x6A, 0x8B, 0x90, 0x47, 0x35, 0x60, 0xF3, 0x48, 0x71, 0x3F, 0x41,
+    0x37, 0x82, 0x9E, 0x20, 0xDB, 0x02, 0xF6, 0x7C, 0x57, 0xD5, 0x1E, 0xE8, 0x1B, 0x9E, 0xD2, 0x4F,
+    0x14, 0xA1, 0x6A, 0xD5, 0x90, 0xC7, 0x3C, 0x62, 0xB3, 0x44, 0x11, 0x26, 0x98, 0x3A, 0xA8, 0x5A,
+    0x03, 0xDA, 0xFD, 0x28, 0xAC, 0x59, 0x2C, 0xDE, 0xF9, 0xA5, 0x95, 0x39, 0x71, 0xC9, 0xF6, 0x1C,
+    0x5E, 0xBF, 0xC1, 0x7E, 0x7A, 0x1B, 0xFE, 0x29, 0xA2, 0xC4, 0xA3, 0x05, 0xEC, 0x04, 0xF2, 0x8C,
+    0xD9, 0xC1, 0x36, 0xA1, 0x1E, 0x9F, 0x66, 0xFD, 0xA7, 0x22, 0x92, 0xCB, 0xE9, 0x34, 0xBB, 0x97,
+    0xF6, 0xF3, 0xAB, 0x7A, 0xDE, 0x34, 0x90, 0x50, 0x87, 0x01, 0xED, 0x58, 0x19, 0x98, 0xCB, 0x96,
+    0x1F, 0xD9, 0x68, 0x16, 0x8B, 0xD3, 0xC5, 0x95, 0x43, 0x91, 0xA7, 0xDB, 0x15, 0x09, 0x86, 0x2C,
+    0x52, 0xB6, 0x86, 0x3C, 0xA2, 0xFD, 0xFF, 0xB7, 0x68, 0x16, 0x97, 0x9F, 0x2C, 0xDE, 0xF9, 0xD7,
+    0xF9, 0x59, 0x76, 0xE7, 0x62, 0x76, 0xE2, 0xE6, 0x3B, 0xC4, 0xAB, 0xFD, 0x0E, 0x72, 0x19, 0xE1,
+    0xA5, 0xB7, 0x87, 0xF3, 0xC8, 0x9E, 0xFB, 0x46, 0xCE, 0x83, 0x5E, 0xB7, 0x80, 0xDD, 0xDC, 0x04,
+    0x91, 0x09, 0xF5, 0xE5, 0xAD, 0x09, 0xED, 0xF3, 0x09, 0x4B, 0x1E, 0x99, 0x28, 0x82, 0x8A, 0x68,
+    0xA7, 0x3D, 0x2B, 0x2C, 0x79, 0x62, 0xA2, 0xF2, 0xEA, 0xC9, 0xE5, 0x2D, 0x5A, 0x24, 0x60, 0xE5,
+    0x21, 0x06, 0xA8, 0xBF, 0x07, 0xB3, 0x9B, 0x9B, 0xD4, 0x56, 0x76, 0xD4, 0xCD, 0x46, 0x7C, 0x6D,
+    0x28, 0x87, 0xDA, 0xA0, 0x62, 0x6D, 0xC8, 0xBF, 0xCE, 0x54, 0x9C, 0x7B, 0x9B, 0xC5, 0xDA, 0xD7,
+    0x56, 0x84, 0xDA, 0xCA, 0xC3, 0x79, 0x96, 0x6F, 0x07, 0x3C, 0xBB, 0xB9, 0x39, 0xD7, 0xB8, 0xB7,
+    0xBE, 0x03, 0x3B, 0xDF, 0x3D, 0x7E, 0x7B, 0xD2, 0x22, 0xDE, 0xCA, 0x43, 0x00, 0x2E, 0xC8, 0x29,
+    0x85, 0x48, 0xE2, 0xF4, 0x25, 0x71, 0xE7, 0x35, 0xFA, 0x1A, 0x28, 0xC3, 0x33, 0xF0, 0xA1, 0x7D,
+    0x2D, 0x12, 0xB5, 0xC8, 0x94, 0x2D, 0x16, 0xEB, 0x73, 0x70, 0x51, 0xF1, 0xFC, 0x14, 0xF7, 0xCF,
+    0x6F, 0x59, 0x67, 0x37, 0xB3, 0xDE, 0xAD, 0x45, 0x5C, 0x29, 0x3B, 0xC8, 0xDC, 0x53, 0x94, 0x51,
+    0x81, 0x42, 0x1E, 0x62, 0x28, 0x44, 0x06, 0x15, 0xB2, 0xDD, 0xEB, 0xBD, 0x37, 0x58, 0xC7, 0x1D,
+    0x15, 0xCA, 0x80, 0x8A, 0x86, 0x09, 0xAA, 0x77, 0x43, 0xE5, 0x60, 0x32, 0x79, 0x84, 0xF2, 0x20,
+    0x58, 0x60, 0xDF, 0x4A, 0x84, 0xE2, 0x50, 0x04, 0x58, 0x35, 0x6F, 0x47, 0x28, 0x0E, 0x83, 0x05,
+    0x56, 0x4F, 0x87, 0xCD, 0xF7, 0x30, 0x42, 0xF5, 0x6E, 0x28, 0x3D, 0x2A, 0x1A, 0x2C, 0xDC, 0x51,
+    0x21, 0xDB, 0xB1, 0xF6, 0x86, 0x42, 0x24, 0xAA, 0x70, 0x9E, 0xBC, 0xE6, 0xA7, 0xBA, 0x20, 0x3B,
+    0x7A, 0x11, 0xB5, 0x7B, 0x7F, 0x5D, 0x44, 0xAC, 0xF6, 0x5F, 0xA7, 0x32, 0x60, 0xD5, 0x88, 0xCD,
+    0xE4, 0xCB, 0x9E, 0x5A, 0x84, 0xF2, 0x78, 0x4D, 0xD5, 0x5A, 0x2C, 0x96, 0x7D, 0x2C, 0x23, 0x56,
+    0xC5, 0x79, 0x9C, 0xF6, 0x58, 0x0B, 0x36, 0xEB, 0x87, 0x42, 0xC4, 0x9D, 0x16, 0x11, 0x1A, 0xD0,
+    0x9E, 0x3C, 0xB2, 0x98, 0x4A, 0x91, 0xEA, 0xCB, 0x77, 0xEE, 0xF9, 0xFC, 0xCC, 0x73, 0x27, 0x62,
+    0x3B, 0xAA, 0xCF, 0xDB, 0xEA, 0xB1, 0xEC, 0x96, 0xF5, 0x56, 0x73, 0x09, 0x80, 0x4B, 0xE4, 0x7D,
+    0xC4, 0x4A, 0xCC, 0xE4, 0x97, 0x14, 0x71, 0xF6, 0xC8, 0x0A, 0xF8, 0x59, 0xE6, 0x30, 0xF5, 0x0E,
+    0x23, 0xE2, 0xD7, 0xA1, 0x8C, 0x6B, 0xF2, 0xB4, 0x07, 0xE3, 0x0A, 0xA6, 0x15, 0x74, 0xAB, 0xF9,
+    0x7B, 0x63, 0x6A, 0x60, 0xAA, 0xC9, 0xC6, 0xCA, 0xA9, 0xA8, 0x87, 0x32, 0x28, 0x91, 0x96, 0x7E,
+    0x0B, 0x99, 0xE3, 0xDA, 0xE6, 0x66, 0x29, 0x12, 0xF6, 0x2F, 0xF7, 0xA5, 0xCF, 0xC6, 0x0E, 0x7D,
+    0xC3, 0x93, 0xBA, 0x6C, 0x5D, 0x8A, 0xB8, 0x5E, 0x76, 0xA5, 0xCF, 0xC7, 0x8E, 0xF2, 0xAE, 0xA7,
+    0xEB, 0xD0, 0x77, 0xFD, 0x85, 0xB1, 0x17, 0x29, 0x65, 0xE7, 0xAE, 0x6D, 0xFE, 0x5E, 0xE4, 0xEE,
+    0x6F, 0x36, 0x35, 0x74, 0xE4, 0x91, 0xD2, 0xF3, 0xAD, 0x2A, 0xD7, 0x36, 0x1F, 0x51, 0x8A, 0x78,
+    0xEE, 0x6C, 0x26, 0xCA, 0xB6, 0xF0, 0xDC, 0x66, 0x39, 0x2B, 0x89, 0x25, 0xDA, 0x3D, 0x55, 0x28,
+    0x7C, 0x16, 0x59, 0xF2, 0x33, 0x0A, 0xAF, 0x02, 0x4B, 0x26, 0x4A, 0xDF, 0x8B, 0xC8, 0x03, 0x11,
+    0xD9, 0x76, 0xA0, 0x1E, 0x78, 0x30, 0xBF, 0x55, 0x66, 0xFF, 0xB9, 0x3E, 0x60, 0x25, 0xE8, 0x61,
+    0xFD, 0xF3, 0xC4, 0xD4, 0x50, 0x7C, 0x16, 0x68, 0x56, 0x8B, 0xB7, 0x4F, 0x44, 0xA4, 0xDF, 0x6C,
+    0x6E, 0x79, 0x58, 0xCD, 0xB1, 0x5C, 0x3B, 0xD8, 0xF2, 0x27, 0x85, 0x88, 0x2F, 0x25, 0x91, 0x39,
+    0x5E, 0xE5, 0x65, 0xF2, 0xBF, 0x89, 0x24, 0x26, 0xDD, 0x6A, 0x57, 0xB3, 0x22, 0xA9, 0x90, 0x47,
+    0xED, 0x46, 0x74, 0x9B, 0x6A, 0x30, 0xFA, 0xCD, 0x40, 0x2E, 0x32, 0x82, 0x15, 0xF1, 0x14, 0xF7,
+    0xD3, 0x1E, 0x8C, 0xFA, 0xE7, 0x09, 0x4B, 0xD2, 0xBE, 0x08, 0xDA, 0xED, 0x31, 0x91, 0xF2, 0x68,
+    0xD1, 0x4E, 0x7F, 0x1A, 0x48, 0xEC, 0x5D, 0x90, 0x9B, 0xA5, 0xC8, 0xEB, 0x0F, 0x2F, 0x46, 0x58,
+    0x41, 0xE5, 0x28, 0x3D, 0x17, 0x43, 0x29, 0x6D, 0x2E, 0xD3, 0x1C, 0x1F, 0x23, 0x58, 0xD0, 0xFF,
+    0x8C, 0x3E, 0x14, 0x19, 0x7A, 0x09, 0xBC, 0x02, 0x57, 0xB9, 0xF0, 0x81, 0x67, 0xD7, 0x61, 0x4F,
+    0x7C, 0xB1, 0xEB, 0xF8, 0xE2, 0xC4, 0xD7, 0x4D, 0xA7, 0x0E, 0x4E, 0xFC, 0xED, 0xA6, 0xAB, 0xD4,
+    0xC9, 0x41, 0x68, 0xBA, 0xA5, 0x3A, 0xB9, 0xE7, 0x9A, 0x3B, 0x83, 0x3A, 0x99, 0x68, 0xFA, 0x56,
+    0x9D, 0x44, 0x9A, 0xBC, 0xFD, 0x63, 0x5E, 0x53, 0x21, 0x7F, 0x32, 0x51, 0xCA, 0x9C, 0x43, 0xFF,
+    0xEF, 0x93, 0x5D, 0xE5, 0xE5, 0x3F, 0xF7, 0x79, 0xEC, 0x58, 0x95, 0x5E, 0xB7, 0x5D, 0x1E, 0x4B,
+    0xBF, 0xA2, 0xD3, 0x6D, 0x29, 0x91, 0x5E, 0x28, 0xFD, 0x44, 0x57, 0x0C, 0xA5, 0xAF, 0xE9, 0x98,
+    0x4A, 0x5F, 0x0C, 0x1D, 0x75, 0xE9, 0x99, 0xD8, 0x6C, 0xFE, 0x41, 0x89, 0x0C, 0x7A, 0xF3, 0x71,
+    0xFB, 0x1A, 0x0D, 0x91, 0x51, 0x79, 0x35, 0x54, 0xE8, 0x76, 0x49, 0x93, 0x45, 0xC6, 0xC2, 0xAB,
+    0xA1, 0x46, 0xB7, 0xB7, 0x69, 0x54, 0x60, 0xAC, 0x51, 0x8F, 0x26, 0x74, 0xEF, 0x67, 0xC8, 0xBD,
+    0x06, 0x17, 0x6E, 0x25, 0x90, 0xDE, 0x53, 0x9D, 0x6D, 0x51, 0x72, 0x67, 0x60, 0xEF, 0xEC, 0x73,
+    0xCA, 0xBF, 0xEB, 0x46, 0x9E, 0x9C, 0x7D, 0xEA, 0xEB, 0xAA, 0x33, 0xEA, 0xFE, 0xD9, 0x27, 0x71,
+    0x59, 0x75, 0x5A, 0xFF, 0xF5, 0x99, 0x1F, 0x63, 0xD5, 0x15, 0xFF, 0x99, 0x9D, 0x79, 0x1B, 0xAA,
+    0x2E, 0x9F, 0xB2, 0x33, 0xAF, 0x5D, 0x75, 0x95, 0xFC, 0x03, 0x8F, 0xE9, 0x50, 0x0F, 0x9E, 0x15,
+    0xC5, 0x03, 0x91, 0x6D, 0x2F, 0xF2, 0xE0, 0x05, 0x7D, 0xEA, 0x81, 0xC7, 0x70, 0xFD, 0x21, 0x5A,
+    0x26, 0x76, 0x7F, 0x36, 0x95, 0x81, 0xC9, 0x92, 0x3D, 0x49, 0xA8, 0x5F, 0x7B, 0xF4, 0xA3, 0x39,
+    0x33, 0xEF, 0x22, 0xEA, 0x8B, 0x80, 0x7E, 0xAF, 0x65, 0x55, 0xA3, 0xA2, 0x75, 0xD6, 0x59, 0x19,
+    0xA9, 0xC5, 0x91, 0xC1, 0xB5, 0xCD, 0xE6, 0x86, 0xC8, 0x74, 0x67, 0x73, 0xEB, 0xAE, 0x67, 0xD9,
+    0x51, 0x7C, 0x4F, 0xF1, 0x17, 0xD5, 0xC3, 0xFC, 0xB1, 0x4C, 0xE5, 0xEE, 0xCD, 0xA9, 0xF6, 0x79,
+    0xBA, 0x83, 0xFA, 0xAF, 0x48, 0x79, 0xD7, 0x53, 0x5D, 0x87, 0x55, 0x47, 0xF6, 0xDF, 0x91, 0xE2,
+    0x81, 0xA7, 0xAE, 0x1D, 0x53, 0x4F, 0xF1, 0x1F, 0xC2, 0xBA, 0x7C, 0x24, 0xA9, 0xAE, 0x84, 0x2E,
+    0x73, 0x79, 0x84, 0xD2, 0x43, 0xFD, 0xD5, 0x67, 0x66, 0xE9, 0x01, 0xEA, 0x53, 0x7A, 0xF1, 0xB2,
+    0xF8, 0x70, 0x0F, 0x2C, 0x54, 0x8E, 0xC2, 0x93, 0x47, 0xE8, 0xA0, 0x86, 0x22, 0x3C, 0x75, 0x42,
+    0x95, 0x70, 0x6B, 0x89, 0xB9, 0x8C, 0x33, 0x24, 0x6C, 0x6E, 0x88, 0x4C, 0xD7, 0xFA, 0x4D, 0x9B,
+    0x47, 0xA8, 0xE7, 0x29, 0x7F, 0xB7, 0xF8, 0x08, 0xFE, 0x31, 0x52, 0x1C, 0x0E, 0xD4, 0xA5, 0x67,
+    0xAC, 0x5C, 0x11, 0x1A, 0x2C, 0x1D, 0x23, 0xA9, 0xF0, 0x79, 0xB4, 0x14, 0x3E, 0xA1, 0x6F, 0x78,
+    0xEA, 0x06, 0x4C, 0x82, 0xDE, 0x93, 0x6D, 0xCF, 0xEB, 0x99, 0x16, 0x56, 0xF3, 0x6C, 0x55, 0xCB,
+    0xE5, 0x89, 0x5C, 0x3C, 0xE5, 0xF8, 0x55, 0x29, 0xDA, 0x7D, 0x17, 0xBB, 0x28, 0x37, 0xC9, 0x44,
+    0x76, 0x14, 0xA7, 0xFB, 0x6B, 0x5F, 0xF9, 0x65, 0x39, 0x58, 0x96, 0x79, 0x6A, 0x58, 0x32, 0xAE,
+    0x58, 0x32, 0x75, 0x2C, 0xE9, 0xBE, 0x62, 0x2B, 0x96, 0x4C, 0x96, 0x65, 0x36, 0xD6, 0x6E, 0xA9,
+    0xA2, 0x1E, 0x96, 0x55, 0x50, 0x22, 0xE2, 0x58, 0xCB, 0x08, 0xD9, 0xBE, 0xFB, 0x1D, 0x4B, 0xBE,
+    0x4A, 0xF6, 0x61, 0x47, 0xD5, 0x4E, 0x4C, 0xD9, 0x58, 0xFA, 0x3C, 0xAD, 0x50, 0x8F, 0x07, 0x94,
+    0x40, 0x91, 0xE6, 0x82, 0x5A, 0x3C, 0xFA, 0x5E, 0xCB, 0x7E, 0xE5, 0x8A, 0xA1, 0xC6, 0x62, 0xF3,
+    0xC8, 0x5E, 0xD5, 0xB2, 0x7F, 0x95, 0xBC, 0x5D, 0x52, 0xF8, 0xFF, 0x25, 0x85, 0xB5, 0xC8, 0x6E,
+    0x3D, 0x97, 0x35, 0xCD, 0x73, 0xC4, 0x4F, 0xC9, 0x7F, 0x15, 0x68, 0x56, 0xA8, 0x5F, 0xCF, 0xE2,
+    0x28, 0xD0, 0x18, 0xD4, 0x51, 0xA4, 0xA9, 0x8E, 0x3F, 0x1E, 0x7A, 0xD9, 0x71, 0xED, 0x6F, 0x07,
+    0x68, 0x66, 0x28, 0x7C, 0x2A, 0xAE, 0xF2, 0x32, 0xF9, 0x07, 0x3E, 0x4B, 0x34, 0x1D, 0x95, 0x53,
+    0x27, 0x3F, 0x44, 0xED, 0x45, 0x44, 0x4E, 0x44, 0x44, 0x76, 0x57, 0x79, 0x99, 0xFC, 0x66, 0x47,
+    0xE5, 0x54, 0xF8, 0x3D, 0xF1, 0xA1, 0xFF, 0xEA, 0xBF, 0x93, 0x00, 0xB3, 0xC7, 0xBF, 0x88, 0x73,
+    0xED, 0x23, 0xA8, 0xC5, 0x71, 0xE1, 0x56, 0x98, 0xFF, 0xCC, 0xB0, 0x62, 0xFE, 0x53, 0x53, 0xC8,
+    0x29, 0x99, 0x48, 0x62, 0x6F, 0xD1, 0xBB, 0xCA, 0xA9, 0xA1, 0x08, 0x4C, 0x59, 0xC2, 0xB2, 0x42,
+    0xB7, 0x95, 0xAB, 0x7C, 0x21, 0x12, 0x32, 0x91, 0xF6, 0x2A, 0xE4, 0x1F, 0x78, 0x68, 0x3A, 0x50,
+    0x27, 0x5F, 0x53, 0x7A, 0xB9, 0xA9, 0x4E, 0x44, 0x7C, 0xD3, 0x65, 0xBD, 0x3A, 0xF1, 0x79, 0x6A,
+    0x3A, 0xF4, 0x1B, 0x27, 0x9E, 0xD4, 0x74, 0xD4, 0x6F, 0x9C, 0xF8, 0x8B, 0xB1, 0xE9, 0x65, 0x52,
+    0x27, 0x72, 0x4A, 0x73, 0x15, 0x6A, 0x28, 0x9F, 0x8D, 0xBC, 0x52, 0x4E, 0x73, 0x91, 0xB8, 0xBF,
+    0xE8, 0x6B, 0x8A, 0x07, 0x9E, 0x2F, 0x23, 0x4D, 0x47, 0x75, 0x9D, 0xEB, 0x77, 0x45, 0x3E, 0x11,
+    0x71, 0x17, 0x4F, 0xA9, 0x25, 0xA9, 0xF7, 0x7B, 0x87, 0x9A, 0x33, 0x88, 0x6E, 0x51, 0xD1, 0xCA,
+    0xA4, 0x45, 0xA0, 0xF4, 0xA8, 0x08, 0x23, 0x74, 0xAF, 0xB0, 0xD3, 0xB2, 0xCB, 0x64, 0x0B, 0x0E,
+    0xAE, 0x52, 0x6E, 0xE9, 0x58, 0x4B, 0xE8, 0xB2, 0x6D, 0x11, 0x3B, 0x15, 0x99, 0xBA, 0x22, 0xB0,
+    0xEA, 0x4A, 0x4F, 0xD3, 0x69, 0x8F, 0xED, 0xA5, 0x3D, 0x67, 0x9D, 0x6E, 0xB1, 0x9D, 0xF6, 0x34,
+    0x5D, 0xE9, 0x59, 0x75, 0x6A, 0xA0, 0xEB, 0xF2, 0x31, 0x1F, 0x3B, 0x7A, 0x19, 0x3A, 0x2A, 0x71,
+    0xC0, 0x25, 0xB8, 0xB6, 0x69, 0x7B, 0xD9, 0x56, 0xBF, 0xB9, 0x75, 0x18, 0x31, 0x0D, 0xEA, 0x70,
+    0xC0, 0x58, 0xD4, 0xBF, 0x6C, 0x59, 0x95, 0x22, 0xA1, 0x92, 0x2D, 0xA3, 0x0A, 0x16, 0x53, 0x06,
+    0x75, 0x7F, 0xC4, 0x58, 0xD4, 0x83, 0x30, 0x27, 0xE7, 0x4A, 0x85, 0x3C, 0xAE, 0xF8, 0x49, 0xEE,
+    0x9F, 0xC6, 0xF1, 0x0F, 0x48, 0xD6, 0xFF, 0x03, 0xC5, 0xBC, 0x5F, 0x8C, 0x25, 0x55, 0x9E, 0xE7,
+    0xF7, 0x39, 0x71, 0x2A, 0x33, 0xBA, 0x2B, 0x06, 0x4E, 0xD9, 0xCA, 0xDA, 0xA6, 0xA1, 0x9B, 0x68,
+    0x59, 0x2D, 0x8B, 0x61, 0x8B, 0x8A, 0x96, 0x8D, 0x56, 0xAC, 0x75, 0x23, 0xE2, 0x14, 0xC8, 0x8D,
+    0x64, 0x1E, 0x48, 0xCF, 0x72, 0xBB, 0xA5, 0x41, 0x1A, 0x78, 0xE0, 0x81, 0x65, 0x67, 0x5C, 0x58,
+    0xC2, 0x5A, 0x2C, 0xDD, 0x9B, 0x37, 0x00, 0x6B, 0x5B, 0x56, 0x3F, 0x4C, 0xDA, 0x1A, 0x34, 0x0F,
+    0x2D, 0xEF, 0xD4, 0x4A, 0x6D, 0x1B, 0x92, 0xDD, 0x2D, 0x1E, 0xB0, 0x54, 0xE3, 0x8D, 0xAC, 0x7B,
+    0x20, 0x2D, 0x21, 0x37, 0xB2, 0x88, 0xEE, 0x9C, 0x36, 0xB2, 0xB1, 0x44, 0xCC, 0x74, 0x55, 0xCF,
+    0x9A, 0x92, 0xCC, 0x69, 0x08, 0x96, 0xA8, 0xAA, 0xB8, 0xF7, 0xE7, 0x87, 0x88, 0x9B, 0x55, 0x05,
+    0x45, 0xF3, 0xBF, 0x27, 0xE2, 0x46, 0x9C, 0xF8, 0x77, 0xCF, 0xFF, 0xF3, 0x3B, 0xBF, 0x3F, 0xDF,
+    0xF3, 0x9B, 0x2C, 0x97, 0x53, 0xF8, 0xEE, 0x68, 0x34, 0x1A, 0x8D, 0x26, 0x93, 0xC9, 0x64, 0xB2,
+    0xBB, 0xBB, 0xBB, 0xBB, 0x01, 0x10, 0x54, 0xF0, 0x12, 0xCC, 0xB6, 0x03, 0x91, 0x60, 0xF9, 0xE0,
+    0x53, 0x1D, 0x74, 0x90, 0x81, 0xB1, 0x84, 0x15, 0xAA, 0x81, 0x29, 0x18, 0x8B, 0xAE, 0xA1, 0x04,
+    0x53, 0x29, 0x25, 0xE2, 0x62, 0xA9, 0xC9, 0x2C, 0x91, 0x25, 0xA8, 0xE0, 0x08, 0x00, 0x84, 0x52,
+    0x91, 0x48, 0xCB, 0x16, 0x2F, 0xD1, 0x01, 0x2D, 0xD0, 0x5C, 0x7B, 0x1C, 0xBD, 0x38, 0x26, 0x17,
+    0xB1, 0xB7, 0x2F, 0x77, 0x3E, 0xF2, 0x4E, 0x79, 0xD0, 0x35, 0xC4, 0xBF, 0x1C, 0x3F, 0x90, 0x8B,
+    0x2C, 0x73, 0x91, 0xE5, 0x4D, 0xF0, 0xCC, 0xAF, 0x97, 0x59, 0x2C, 0xE2, 0x76, 0x03, 0x6F, 0x6C,
+    0x54, 0x78, 0x46, 0xB7, 0xA2, 0x5F, 0xAE, 0x19, 0x19, 0x42, 0x57, 0xD2, 0x98, 0x4B, 0xF3, 0x67,
+    0x2E, 0xCB, 0xEE, 0xB1, 0xB5, 0x13, 0x15, 0x30, 0x85, 0xC4, 0x38, 0xCC, 0x53, 0x0D, 0x91, 0xCB,
+    0xD1, 0x55, 0x58, 0x05, 0x9E, 0x8E, 0x06, 0x63, 0x4B, 0x02, 0x9F, 0x42, 0x9A, 0x40, 0xF4, 0x16,
+    0x20, 0x05, 0xB1, 0x88, 0x0B, 0x45, 0x7C, 0x9F, 0xD9, 0x0C, 0x0E, 0x9F, 0x7E, 0xBB, 0xB8, 0xE6,
+    0x01, 0xA6, 0xE8, 0xB3, 0xC5, 0xE8, 0xCA, 0xD6, 0x97, 0xF7, 0xDA, 0x27, 0x6B, 0x28, 0x91, 0x13,
+    0xCB, 0xD3, 0x55, 0xC7, 0x91, 0x14, 0x8C, 0x43, 0x2D, 0x21, 0x5E, 0x10, 0x89, 0x8F, 0xDC, 0x5C,
+    0x57, 0xDA, 0x7B, 0x26, 0x19, 0x26, 0xAA, 0x23, 0x37, 0xFF, 0x89, 0x0B, 0xA4, 0x22, 0xEA, 0x20,
+    0x2E, 0x08, 0x3C, 0x94, 0x8F, 0xB0, 0x15, 0x8B, 0x04, 0xB2, 0x00, 0x38, 0x42, 0xA2, 0xDF, 0x74,
+    0xCD, 0xF6, 0x4D, 0x43, 0x4A, 0x89, 0x14, 0x90, 0x9C, 0x3F, 0x5D, 0x60, 0x0A, 0x12, 0xAB, 0x2B,
+    0x48, 0xF1, 0xC1, 0xD2, 0xFA, 0x6F, 0x2B, 0xE9, 0xC2, 0x67, 0x5C, 0xA6, 0xEC, 0xB1, 0xBB, 0x22,
+    0x87, 0x7A, 0xC3, 0x36, 0x70, 0xE3, 0x8B, 0x06, 0xB8, 0x8C, 0x07, 0xF3, 0xA2, 0x01, 0x3E, 0xB0,
+    0x0D, 0xDC, 0x78, 0x57, 0x54, 0xA0, 0xF6, 0xDD, 0x14, 0x8E, 0xDD, 0x11, 0x48, 0xA7, 0x9D, 0x0F,
+    0xC5, 0xFA, 0xD0, 0x41, 0x4A, 0x6C, 0x89, 0x0B, 0xF2, 0x67, 0x4F, 0x56, 0x70, 0x52, 0x2A, 0x60,
+    0x0D, 0x80, 0x40, 0x8A, 0xFF, 0xB7, 0xC5, 0xA0, 0x5F, 0x91, 0x77, 0xCF, 0x8D, 0xBC, 0x19, 0x85,
+    0xAF, 0xBD, 0xE3, 0xCF, 0xDE, 0x74, 0x74, 0x3C, 0xFE, 0x03, 0x11, 0x79, 0x55, 0x44, 0x80, 0x11,
+    0xE0, 0x41, 0x3B, 0x30, 0xC3, 0xED, 0x11, 0xE9, 0xA4, 0x1B, 0x3F, 0xF0, 0x5B, 0xF3, 0x9F, 0x5C,
+    0xC4, 0x7F, 0x5B, 0x4B, 0x1B, 0x3E, 0xE3, 0xD2, 0xC8, 0x1D, 0xBB, 0x4B, 0x57, 0xA9, 0x7A, 0xC3,
+    0xA6, 0xBA, 0xBA, 0xF1, 0x45, 0x5D, 0x4D, 0xB8, 0x4C, 0x2E, 0xD6, 0xBC, 0xA8, 0xA5, 0xE2, 0x03,
+    0x9B, 0xC6, 0xDC, 0x78, 0x97, 0xAE, 0x5A, 0xB5, 0xEF, 0xD2, 0xD0, 0x1D, 0xBB, 0x43, 0x57, 0x99,
+    0x76, 0x3E, 0xA5, 0xF9, 0x84, 0xFC, 0xC3, 0xAA, 0x2F, 0x01, 0xB3, 0x3A, 0x3E, 0xBD, 0xE7, 0x8E,
+    0x3F, 0xC9, 0x07, 0x85, 0x79, 0x92, 0x5F, 0x55, 0xA9, 0x91, 0x22, 0xD9, 0x66, 0x0D, 0xB8, 0x03,
+    0x78, 0xA9, 0x1F, 0x0F, 0x91, 0x85, 0x3B, 0x50, 0xE3, 0x8B, 0xE3, 0x44, 0xA4, 0x7B, 0xEC, 0xF4,
+    0xDB, 0xA7, 0x3E, 0xFA, 0x16, 0x1E, 0x06, 0x60, 0x2E, 0xF2, 0xAE, 0x88, 0xB8, 0xF5, 0xD6, 0xC8,
+    0x2F, 0x8A, 0x12, 0x83, 0x76, 0x41, 0xA5, 0xFC, 0xC1, 0x2E, 0x32, 0x13, 0x17, 0x5D, 0xD4, 0xD2,
+    0x7C, 0x37, 0x74, 0x8C, 0x08, 0xDD, 0xDF, 0xF3, 0xD1, 0x02, 0xD5, 0xA1, 0x2B, 0x52, 0xF4, 0x6B,
+    0x6F, 0xB7, 0xC9, 0x02, 0x50, 0x9B, 0x49, 0xD1, 0x1A, 0x37, 0x51, 0x96, 0x47, 0x09, 0x7E, 0xE2,
+    0xC8, 0x4A, 0xF4, 0x85, 0xDF, 0x1E, 0x6C, 0xED, 0x62, 0x2E, 0x34, 0xC1, 0x72, 0x2E, 0x97, 0x2E,
+    0xBC, 0xB5, 0xB8, 0xB5, 0x3C, 0x44, 0xE4, 0xA0, 0xE4, 0x43, 0x01, 0x00, 0x4A, 0xA4, 0x8B, 0xE4,
+    0xE2, 0x24, 0x96, 0xE6, 0x58, 0x3E, 0x1C, 0xB3, 0x0F, 0x1D, 0xAB, 0xE7, 0x89, 0x34, 0xC7, 0x8C,
+    0x34, 0xC7, 0x02, 0x69, 0x8E, 0x71, 0xE8, 0x89, 0x63, 0xF0, 0x69, 0x8F, 0xEF, 0xDC, 0xB4, 0x71,
+    0x76, 0xB9, 0xBB, 0x11, 0x31, 0xE2, 0x2C, 0x23, 0x7E, 0x73, 0xFA, 0xB5, 0x16, 0x75, 0x6A, 0x9E,
+    0x5D, 0xBE, 0x1F, 0x6F, 0xAE, 0xFA, 0x01, 0x51, 0xCB, 0xA5, 0x32, 0xB2, 0x4F, 0x8E, 0xF0, 0x5E,
+    0xEF, 0x39, 0x63, 0x18, 0x1D, 0x0F, 0xEA, 0x7C, 0xCE, 0x2D, 0xDB, 0x50, 0xC2, 0x4B, 0xE4, 0x8E,
+    0x98, 0x64, 0x82, 0x76, 0xC1, 0x9E, 0xE3, 0x0C, 0x8C, 0x88, 0x41, 0x3B, 0x5D, 0xC1, 0x88, 0x27,
+    0x41, 0x3B, 0x03, 0x8C, 0x82, 0xEA, 0x9B, 0x68, 0x37, 0xD1, 0x35, 0x23, 0x63, 0x97, 0xE8, 0x57,
+    0xEA, 0xE3, 0x35, 0xB7, 0x8D, 0xC2, 0x7F, 0x0E, 0x91, 0x7D, 0xB7, 0x46, 0xF9, 0x63, 0xC7, 0x61,
+    0x14, 0x3E, 0x5D, 0x13, 0x15, 0x97, 0xE6, 0xDB, 0x78, 0x23, 0x0B, 0x52, 0x48, 0x08, 0x1D, 0x41,
+    0x8D, 0x87, 0xE3, 0xD0, 0x10, 0x54, 0xCC, 0x0A, 0x26, 0x24, 0x67, 0x30, 0x56, 0xFF, 0xA8, 0x08,
+    0x6A, 0x38, 0xC3, 0x08, 0xA2, 0x22, 0xB2, 0x70, 0x46, 0x79, 0x88, 0x8A, 0x11, 0x70, 0x26, 0x7A,
+    0xEA, 0x79, 0xA2, 0xE2, 0x37, 0xD2, 0x70, 0x26, 0xFD, 0x76, 0xE8, 0xA2, 0x1F, 0x39, 0x46, 0x3C,
+    0xE2, 0xD1, 0x8E, 0xE3, 0x30, 0x41, 0x3B, 0x0C, 0x34, 0xE8, 0x8A, 0x5B, 0xA1, 0x41, 0x3B, 0x52,
+    0x38, 0x83, 0xB1, 0xC4, 0x68, 0xE9, 0x74, 0x45, 0x2E, 0xAE, 0x6F, 0x9A, 0x93, 0x0D, 0x3C, 0x19,
+    0x5E, 0x6A, 0xD0, 0xEE, 0x90, 0xF2, 0xDC, 0x01, 0xDA, 0x29, 0x0F, 0xC7, 0x31, 0xF0, 0x4F, 0x6A,
+    0xCE, 0x10, 0x48, 0xA1, 0x1D, 0x44, 0x2E, 0x05, 0x8C, 0xF2, 0xDF, 0x84, 0xD4, 0xD0, 0x6E, 0x28,
+    0x7F, 0xC6, 0xD4, 0x73, 0xB9, 0xD7, 0xFD, 0x9B, 0xE2, 0x64, 0x9D, 0xEA, 0x7F, 0x0E, 0xAA, 0x1E,
+    0x3D, 0x09, 0x26, 0x78, 0xB9, 0x86, 0x33, 0xB7, 0x86, 0x05, 0xA1, 0xBB, 0x34, 0xDF, 0x26, 0xD5,
+    0x22, 0x45, 0x50, 0x13, 0x78, 0x0C, 0x84, 0x05, 0x2F, 0xC1, 0xAD, 0x10, 0x15, 0x84, 0x1E, 0xD5,
+    0x53, 0xFC, 0x61, 0x7B, 0x04, 0x8E, 0xF7, 0xE4, 0xDF, 0x11, 0xD6, 0x44, 0x35, 0x51, 0x4D, 0x58,
+    0xA3, 0x6B, 0x68, 0x60, 0xD2, 0xCF, 0x06, 0x9E, 0xED, 0xD9, 0x85, 0x2E, 0x94, 0x25, 0x37, 0x6F,
+    0xC3, 0x1A, 0x1B, 0x20, 0x45, 0x45, 0x74, 0x5A, 0xE0, 0xAE, 0xA8, 0x01, 0xAB, 0x56, 0x11, 0x9A,
+    0x02, 0x98, 0x01, 0x7A, 0x01, 0x98, 0x12, 0x28, 0x3D, 0xE8, 0x5F, 0xD5, 0x10, 0x47, 0x0E, 0x3A,
+    0x63, 0xD1, 0x55, 0x0E, 0x09, 0x13, 0x68, 0x69, 0x09, 0xAB, 0xC0, 0x93, 0x88, 0x54, 0x88, 0x48,
+    0x11, 0xBE, 0xBD, 0x33, 0x27, 0x87, 0x54, 0x35, 0xD0, 0x45, 0x0E, 0xD5, 0x64, 0xA0, 0xFF, 0xDA,
+    0x43, 0xF4, 0xBA, 0x83, 0xD8, 0xA2, 0xCE, 0x00, 0x71, 0x09, 0xF8, 0x27, 0x40, 0x17, 0x15, 0x44,
+    0xF7, 0x01, 0xA6, 0x05, 0x62, 0x07, 0x88, 0x05, 0xFD, 0x0E, 0x90, 0x8C, 0x80, 0xB6, 0x85, 0xF0,
+    0x15, 0x0F, 0xB9, 0xAE, 0xA0, 0x31, 0x8E, 0xC8, 0xC5, 0x90, 0x91, 0xA1, 0x1A, 0x4A, 0x22, 0x91,
+    0x86, 0x5C, 0xA4, 0x56, 0x97, 0x76, 0x4E, 0x3B, 0xE3, 0x30, 0x76, 0x0A, 0x79, 0xE0, 0x61, 0x6A,
+    0x0A, 0x68, 0x27, 0x10, 0xBC, 0xE7, 0x21, 0xAC, 0x20, 0x14, 0x11, 0x87, 0x16, 0x11, 0x0F, 0x97,
+    0x16, 0xE3, 0x07, 0xA0, 0xCC, 0x00, 0x52, 0x53, 0x00, 0x89, 0xAE, 0x01, 0x53, 0xB4, 0x40, 0xE4,
+    0x32, 0x40, 0xD7, 0xA6, 0x80, 0xC0, 0x6B, 0x91, 0x8A, 0x16, 0x91, 0x86, 0x92, 0x7C, 0xFC, 0x00,
+    0xB9, 0x48, 0x01, 0xB1, 0x48, 0x0D, 0xE6, 0xED, 0x9D, 0x16, 0xC2, 0x8A, 0x0C, 0xB4, 0xC7, 0x14,
+    0xA8, 0x06, 0x5D, 0x43, 0x07, 0x8B, 0xF1, 0x03, 0x53, 0xC8, 0x45, 0x72, 0x30, 0x22, 0x4E, 0xCB,
+    0xD2, 0xA2, 0x45, 0x5A, 0xF4, 0xFB, 0x7F, 0x28, 0x56, 0xD7, 0x24, 0x95, 0xAE, 0x09, 0xBD, 0xAE,
+    0x51, 0xAD, 0xAE, 0xA1, 0xD3, 0x35, 0x94, 0xBA, 0x86, 0xE9, 0x37, 0xDE, 0x7F, 0x80, 0x69, 0x2E,
+    0x1D, 0x5B, 0xB9, 0xB4, 0x4C, 0x75, 0x4D, 0x7F, 0x2A, 0x57, 0xDF, 0xA9, 0x76, 0xF5, 0xDF, 0xB8,
+    0xD2, 0xE7, 0x7F, 0x20, 0x56, 0x8B, 0x74, 0x68, 0x91, 0x02, 0x94, 0x5D, 0x03, 0xD3, 0xDE, 0x08,
+    0xF1, 0x7C, 0x01, 0xA3, 0xA8, 0x85, 0x23, 0xD8, 0xA1, 0xA9, 0x23, 0x69, 0x60, 0x26, 0x62, 0x83,
+    0xA5, 0x3D, 0x59, 0x85, 0x9E, 0xD0, 0x1B, 0x87, 0x6A, 0xE3, 0x02, 0xBA, 0x04, 0x98, 0xE6, 0x40,
+    0x96, 0x01, 0xF9, 0xF5, 0x4E, 0x39, 0x90, 0x25, 0xC0, 0x56, 0x6C, 0xA1, 0x34, 0x0E, 0xD5, 0x85,
+    0x1E, 0xED, 0x83, 0x25, 0x49, 0xC5, 0x5C, 0xC4, 0x12, 0x49, 0x0B, 0x6C, 0xC0, 0x21, 0xB8, 0xA7,
+    0x26, 0x8D, 0x0B, 0xE3, 0xB6, 0xB4, 0x57, 0x6D, 0x47, 0x28, 0x10, 0x3B, 0xF4, 0x12, 0x96, 0x2D,
+    0x79, 0x58, 0x1B, 0x17, 0x3F, 0xE3, 0x99, 0x7E, 0x0B, 0x35, 0x0C, 0x35, 0x8E, 0x10, 0xC9, 0xB9,
+    0x86, 0x99, 0x88, 0x0F, 0x96, 0x76, 0x56, 0x85, 0x1E, 0xE3, 0x8D, 0x23, 0x69, 0xE3, 0x82, 0x49,
+    0x97, 0x40, 0x33, 0xCD, 0xD1, 0x75, 0x96, 0x11, 0xB9, 0x3C, 0x23, 0xB6, 0x79, 0x46, 0x46, 0x9E,
+    0x51, 0x92, 0x67, 0xCA, 0x93, 0xE7, 0xBA, 0x26, 0x4B, 0x8C, 0x63, 0x2B, 0x7E, 0x08, 0x4A, 0xB3,
+    0x40, 0x75, 0x61, 0x8B, 0xF6, 0x7A, 0x49, 0x52, 0x85, 0x22, 0x62, 0xCD, 0x8F, 0xA5, 0x25, 0x60,
+    0x83, 0x61, 0x16, 0x32, 0x0E, 0xA2, 0x0A, 0xF4, 0x70, 0x0C, 0xF5, 0x15, 0x78, 0x98, 0x6C, 0x41,
+    0x1E, 0x39, 0x12, 0x5A, 0x4C, 0x91, 0x10, 0x39, 0x5D, 0xEB, 0x9A, 0x32, 0xF0, 0x98, 0xA2, 0x25,
+    0xF0, 0x25, 0xE4, 0x53, 0x08, 0x65, 0xE8, 0xC3, 0xB1, 0x1B, 0xD8, 0x91, 0x8F, 0xF0, 0x27, 0x57,
+    0x3D, 0x48, 0x7B, 0x8E, 0x4A, 0x57, 0xFD, 0xEB, 0x5C, 0x5A, 0x44, 0x16, 0xBA, 0x5A, 0x5F, 0x18,
+    0xAB, 0xBA, 0x14, 0xED, 0x1B, 0xA2, 0xBD, 0x8A, 0xC4, 0x58, 0xBA, 0x14, 0x5D, 0x37, 0xCC, 0xF4,
+    0x25, 0x69, 0x8C, 0x2C, 0xC9, 0xC6, 0xF6, 0xE0, 0xBF, 0x16, 0xD2, 0xA1, 0x10, 0x81, 0xB4, 0xC4,
+    0x22, 0x36, 0xB7, 0xB1, 0x9B, 0x12, 0xBA, 0x09, 0xA1, 0x2B, 0x31, 0xAE, 0x24, 0xB1, 0x25, 0x0B,
+    0x4A, 0xED, 0x29, 0xC3, 0xAA, 0x3F, 0x74, 0x43, 0xA9, 0x96, 0x94, 0xCC, 0x5C, 0x49, 0xE4, 0x4B,
+    0x54, 0x5B, 0x42, 0x59, 0xC2, 0xA4, 0x84, 0xB2, 0xDC, 0xA0, 0x2B, 0x13, 0xF1, 0x65, 0x2C, 0x0E,
+    0x8E, 0xC0, 0xA6, 0x42, 0x9E, 0xAA, 0xFE, 0x57, 0xF1, 0x77, 0x45, 0xCD, 0xA1, 0x9E, 0x9D, 0x3C,
+    0xBC, 0xB4, 0x89, 0xB4, 0xD1, 0xF6, 0xCC, 0xA2, 0x3D, 0x94, 0x90, 0xA0, 0x1E, 0x74, 0x73, 0xF9,
+    0x8D, 0x3C, 0x5B, 0x76, 0x24, 0x25, 0xD1, 0x3B, 0xE8, 0xCB, 0x4E, 0x2D, 0x5A, 0x25, 0xB9, 0x7C,
+    0xF0, 0x8A, 0xD4, 0x5E, 0x01, 0x71, 0x41, 0x52, 0x72, 0x63, 0x68, 0x75, 0x51, 0xD1, 0xBC, 0x88,
+    0x69, 0x60, 0x13, 0x80, 0xD3, 0xE7, 0x02, 0x91, 0xE2, 0x2F, 0xC3, 0x06, 0x72, 0x88, 0x1C, 0x81,
+    0xE7, 0x68, 0x19, 0x89, 0xC4, 0x17, 0x1F, 0x7C, 0xDD, 0x05, 0x97, 0x1D, 0x67, 0x3D, 0x79, 0x49,
+    0xFC, 0x56, 0x11, 0xBF, 0x27, 0x32, 0x49, 0x96, 0x86, 0x23, 0xA0, 0xE6, 0x75, 0xD4, 0x92, 0xCB,
+    0x6F, 0x64, 0xC9, 0xC5, 0x48, 0x7E, 0xBE, 0x0B, 0x61, 0x47, 0x07, 0xC6, 0xA9, 0x06, 0x72, 0x74,
+    0xCD, 0x78, 0x31, 0x7E, 0xA8, 0x98, 0x8B, 0xC8, 0x32, 0xBE, 0xF8, 0xD0, 0xDB, 0x3B, 0x3F, 0xED,
+    0x86, 0x14, 0x3A, 0x48, 0x86, 0xEC, 0x27, 0x35, 0xAA, 0x0D, 0x3E, 0xA8, 0xD5, 0x9E, 0x48, 0x24,
+    0x12, 0x48, 0x1D, 0x4A, 0xC3, 0x91, 0x55, 0xE6, 0xB8, 0x2B, 0x70, 0xCC, 0x4E, 0x3B, 0xA2, 0x25,
+    0x98, 0x0E, 0xE6, 0x33, 0x68, 0xE2, 0xA2, 0x9F, 0xC4, 0x75, 0xCD, 0x3F, 0xF9, 0x17, 0x3E, 0x90,
+    0x65, 0x63, 0xCE, 0x3F, 0xD4, 0x26, 0x36, 0xE8, 0x32, 0xE8, 0x52, 0x28, 0x27, 0xC3, 0x31, 0xED,
+    0x69, 0x4E, 0x9B, 0xA0, 0xBC, 0xA9, 0xC2, 0x3A, 0x14, 0x71, 0xCC, 0x17, 0xA0, 0x2C, 0x6C, 0x60,
+    0x95, 0xDC, 0xED, 0xF4, 0x3B, 0x52, 0x84, 0x27, 0x84, 0x03, 0xCA, 0x9C, 0x34, 0x04, 0x22, 0x36,
+    0x7A, 0xFF, 0x64, 0x15, 0x17, 0xDA, 0xE7, 0x3D, 0x61, 0xED, 0xA6, 0x43, 0x7C, 0xD3, 0x2B, 0xF1,
+    0x76, 0x39, 0xB4, 0xB1, 0x0D, 0xBC, 0xA9, 0xA2, 0x5A, 0x8B, 0x14, 0x07, 0x71, 0x1B, 0xDB, 0x13,
+    0xF7, 0xAE, 0xBF, 0x05, 0xC6, 0xE3, 0xF1, 0x7D, 0x22, 0x12, 0x8B, 0x74, 0x07, 0x93, 0x4A, 0x0B,
+    0xA1, 0xEF, 0x07, 0xC2, 0xA1, 0x55, 0xE2, 0xE7, 0x9A, 0x40, 0xC4, 0xF7, 0x89, 0x1B, 0x9F, 0x93,
+    0x34, 0x19, 0x93, 0x76, 0x4A, 0x53, 0x4E, 0x75, 0x5D, 0x4E, 0x23, 0x57, 0x4E, 0x63, 0xCA, 0x34,
+    0xA5, 0xCB, 0x5B, 0xDA, 0xD8, 0x07, 0xDE, 0xD4, 0x51, 0x6D, 0x44, 0x8A, 0x64, 0xBE, 0xE0, 0x6B,
+    0xCA, 0x02, 0x47, 0x41, 0x37, 0x10, 0x5B, 0x68, 0x21, 0x2A, 0xE8, 0x07, 0x1D, 0xB7, 0xC3, 0xEF,
+    0x97, 0xA8, 0xA6, 0x25, 0x7A, 0xC5, 0x93, 0x85, 0x95, 0x6A, 0x4C, 0x11, 0xB9, 0x84, 0x8C, 0x54,
+    0x79, 0x4A, 0xE3, 0x94, 0x4F, 0xD1, 0x7F, 0xED, 0x89, 0x5E, 0x2F, 0x30, 0x53, 0x48, 0x3C, 0xCC,
+    0x0A, 0xE8, 0x40, 0xFB, 0xBE, 0x58, 0x65, 0x3F, 0xB0, 0x66, 0x30, 0xF7, 0x04, 0x4B, 0x0E, 0x06,
+    0x6D, 0xE4, 0x20, 0x01, 0xCA, 0xAB, 0x6E, 0xC3, 0x8B, 0x94, 0x22, 0x81, 0xFC, 0x77, 0xF3, 0xC8,
+    0xB3, 0x9B, 0x14, 0x74, 0xBB, 0x04, 0xEF, 0x7A, 0xC2, 0xD7, 0x1C, 0xF1, 0x49, 0x98, 0x96, 0xA8,
+    0x7F, 0xE7, 0x89, 0x5E, 0xAB, 0xC9, 0x13, 0xA7, 0xDA, 0xB9, 0x8B, 0x5F, 0xB9, 0x2C, 0x8B, 0xE8,
+    0x55, 0x71, 0x09, 0x9B, 0xD7, 0x44, 0x75, 0x25, 0x66, 0xB0, 0x10, 0xB9, 0x86, 0x44, 0xD7, 0x7C,
+    0x77, 0x7D, 0x55, 0x9B, 0x87, 0x0B, 0x0E, 0x9F, 0x84, 0x69, 0x46, 0xE0, 0x4B, 0xCC, 0x53, 0x0D,
+    0x53, 0x5D, 0x07, 0x3E, 0x72, 0xA6, 0x30, 0x76, 0x42, 0xA2, 0x3D, 0x13, 0x63, 0x69, 0x27, 0x04,
+    0xEF, 0xD5, 0xE8, 0xB7, 0x6C, 0x2F, 0x68, 0xD4, 0x90, 0xF7, 0x2D, 0xA5, 0xAB, 0x3E, 0x99, 0x16,
+    0x62, 0x47, 0xD2, 0xC1, 0xBC, 0x00, 0x72, 0xA9, 0x40, 0xA4, 0x40, 0x1D, 0x30, 0xEE, 0xB4, 0xF4,
+    0x4D, 0x47, 0x5E, 0x01, 0x97, 0x1D, 0x44, 0xAF, 0x0F, 0x34, 0x5C, 0xF9, 0x12, 0x8C, 0x6B, 0x20,
+    0xD5, 0x9E, 0xC0, 0x87, 0x0E, 0x53, 0x98, 0x82, 0x29, 0x09, 0x81, 0xC8, 0x02, 0x23, 0xD2, 0xB2,
+    0xB5, 0xF3, 0x82, 0xD7, 0x1E, 0x5D, 0xC5, 0x16, 0xE3, 0x4A, 0x88, 0xEF, 0xA9, 0x21, 0x8B, 0x81,
+    0xB2, 0x03, 0xD5, 0x68, 0x59, 0x20, 0x52, 0x1C, 0x1D, 0xDB, 0x2F, 0x30, 0x4A, 0xF9, 0x0E, 0xDB,
+    0x50, 0x87, 0x05, 0x81, 0x74, 0x10, 0x88, 0xE3, 0x60, 0x68, 0xFD, 0x4E, 0x58, 0x90, 0x80, 0xAF,
+    0x53, 0x87, 0x45, 0x22, 0x2E, 0x10, 0x37, 0xC8, 0x1E, 0x9F, 0x97, 0x86, 0xFD, 0x0E, 0x2A, 0x9D,
+    0x5E, 0x90, 0xE1, 0x49, 0x7A, 0xB1, 0x0D, 0x03, 0x90, 0x6D, 0x32, 0x74, 0x85, 0x0D, 0x4E, 0x9F,
+    0x63, 0x2E, 0x75, 0xB4, 0x3D, 0xB3, 0xD0, 0xAD, 0x64, 0x09, 0xF5, 0xA0, 0x4B, 0xA4, 0x8B, 0x2F,
+    0x3E, 0xB8, 0xE7, 0x29, 0x4B, 0xA2, 0xD7, 0x1C, 0x5D, 0x49, 0xFC, 0x6A, 0x1D, 0x76, 0xB9, 0x7C,
+    0xE0, 0xE6, 0xED, 0x88, 0x23, 0x61, 0x81, 0xAA, 0x61, 0xD4, 0x47, 0x9C, 0x6D, 0xA2, 0x96, 0x3D,
+    0x6D, 0x50, 0x9B, 0x7D, 0xEF, 0xA3, 0xEB, 0x05, 0x75, 0x46, 0x5C, 0x21, 0x07, 0xB7, 0xC8, 0x39,
+    0x72, 0x11, 0x3B, 0x3B, 0x77, 0x8B, 0xCB, 0x2D, 0xE4, 0x16, 0xE2, 0x62, 0x98, 0x37, 0xFD, 0xC7,
+    0xCD, 0x77, 0xF9, 0x30, 0xBB, 0xAA, 0xD5, 0x4D, 0xE8, 0x81, 0xF9, 0xF6, 0x7A, 0x11, 0x89, 0xD4,
+    0x24, 0xD2, 0xC0, 0x51, 0x7A, 0x7E, 0x21, 0x87, 0xC4, 0x62, 0x2C, 0xC6, 0xAE, 0x48, 0xE0, 0xFC,
+    0x5C, 0x20, 0x12, 0x2C, 0x1E, 0x3C, 0xD1, 0xAE, 0xD4, 0x1E, 0xF1, 0x35, 0x6A, 0x8F, 0x02, 0xED,
+    0x61, 0x17, 0x4C, 0xB5, 0xAE, 0x44, 0x5C, 0x24, 0x15, 0x6B, 0x7D, 0x6C, 0xE4, 0x0E, 0x92, 0x16,
+    0x62, 0x53, 0x10, 0xD3, 0xB2, 0xB6, 0x12, 0x38, 0xBF, 0xDA, 0x92, 0xAC, 0x41, 0xE4, 0x09, 0x85,
+    0x70, 0xDF, 0xEB, 0xEA, 0x38, 0xB6, 0xA7, 0xBA, 0x5F, 0xA4, 0x24, 0xB1, 0x85, 0xB0, 0x06, 0x4E,
+    0x71, 0x65, 0x3B, 0x29, 0xDB, 0x88, 0x2C, 0x94, 0x6C, 0x9F, 0x64, 0x01, 0x2C, 0x80, 0x2D, 0x20,
+    0xB1, 0x7D, 0x3E, 0xAF, 0xCF, 0x83, 0x74, 0xAB, 0xCC, 0xAF, 0x6E, 0x62, 0x07, 0xC1, 0xD2, 0xDE,
+    0x4C, 0x22, 0x52, 0x30, 0x97, 0x0A, 0x1E, 0x80, 0xB5, 0xFE, 0xF3, 0x16, 0x6E, 0x5B, 0xA5, 0x17,
+    0xC8, 0x76, 0x24, 0x5D, 0xF4, 0xFE, 0x9F, 0x84, 0x35, 0xBA, 0x57, 0xBF, 0x4C, 0xAF, 0x2E, 0x44,
+    0x06, 0xC6, 0x11, 0x34, 0x90, 0xDB, 0x9B, 0x42, 0x11, 0x12, 0xB1, 0x6C, 0xC0, 0x06, 0x1B, 0x84,
+    0x2E, 0xEB, 0xA7, 0xA9, 0x68, 0x09, 0xC8, 0x55, 0xB2, 0xFF, 0x57, 0xDA, 0x16, 0x8A, 0x35, 0x9A,
+    0xA8, 0x88, 0xEF, 0x77, 0x4A, 0x1C, 0x89, 0x5B, 0x4D, 0x80, 0x9F, 0xB3, 0x2D, 0x2C, 0x16, 0x63,
+    0x27, 0x03, 0x07, 0x2C, 0x0E, 0xC2, 0x86, 0xA1, 0xFB, 0x82, 0x96, 0xA5, 0x25, 0x17, 0x71, 0xFA,
+    0xFC, 0x1F, 0x8A, 0x4D, 0x51, 0x0B, 0x5D, 0x11, 0xFA, 0x14, 0xE2, 0x67, 0xAA, 0x9E, 0x19, 0x88,
+    0xF6, 0x2A, 0x98, 0xA6, 0x10, 0xEE, 0x57, 0xB0, 0xB5, 0xBA, 0x98, 0xAE, 0x5E, 0x75, 0xC3, 0xC7,
+    0xA1, 0x4F, 0x51, 0x0B, 0x7D, 0xFE, 0x07, 0x62, 0x73, 0x11, 0xD7, 0x33, 0xF6, 0xC3, 0xD6, 0x94,
+    0x40, 0xD3, 0x02, 0x8D, 0x07, 0x9A, 0x1A, 0x68, 0x8A, 0x9E, 0x9D, 0x3C, 0x59, 0x35, 0x68, 0xE9,
+    0x1A, 0xCC, 0xB9, 0x93, 0x0D, 0x71, 0x11, 0x36, 0xE4, 0x04, 0x4D, 0x2F, 0x33, 0x4D, 0xE1, 0x23,
+    0xA7, 0x14, 0x1A, 0x72, 0x54, 0x43, 0x82, 0x6E, 0x30, 0x95, 0x69, 0x08, 0x65, 0xD1, 0xA0, 0xA4,
+    0x79, 0xA9, 0x6F, 0xA4, 0xDF, 0x9D, 0xE4, 0xD2, 0x6F, 0x29, 0x60, 0x2C, 0xB7, 0xBF, 0x70, 0x91,
+    0x58, 0xA4, 0x50, 0xE3, 0x2D, 0x0B, 0xC6, 0xAA, 0xB3, 0xF7, 0x54, 0x5A, 0xBA, 0x46, 0x2F, 0x1E,
+    0x5C, 0xA8, 0x96, 0x99, 0xED, 0x88, 0xAA, 0x0C, 0xD5, 0xC4, 0x96, 0x34, 0xAC, 0x30, 0x27, 0x1A,
+    0x74, 0x35, 0x85, 0xC6, 0x58, 0x52, 0xED, 0x89, 0x6D, 0x89, 0xA9, 0x4C, 0x15, 0x35, 0x4A, 0x64,
+    0x4A, 0x2C, 0xF7, 0x59, 0x36, 0x20, 0x94, 0x4E, 0x89, 0xD0, 0xCF, 0x65, 0xB9, 0xC8, 0xFD, 0x22,
+    0xFB, 0xE7, 0xC7, 0x9B, 0x0D, 0xA4, 0xBD, 0xDC, 0x5C, 0xC1, 0x70, 0x23, 0xB2, 0x27, 0xE2, 0x2F,
+    0x8E, 0x37, 0x3F, 0xF2, 0xC6, 0xA2, 0xCF, 0x8F, 0x37, 0x45, 0x16, 0xB9, 0x88, 0xD5, 0xB2, 0x20,
+    0x97, 0x7A, 0x35, 0x23, 0x9F, 0x3C, 0x47, 0x22, 0x75, 0x74, 0xEE, 0xE4, 0x53, 0x0D, 0x65, 0x8E,
+    0xFE, 0x55, 0x4D, 0xBE, 0x35, 0xFE, 0xE1, 0x07, 0x22, 0x32, 0xDB, 0xD9, 0xF9, 0x9F, 0x2B, 0x48,
+    0xFB, 0x9E, 0x9D, 0x58, 0x58, 0x72, 0x93, 0x16, 0xA9, 0x22, 0x69, 0x51, 0x96, 0x75, 0xBE, 0xA6,
+    0xAA, 0x88, 0x5C, 0x0A, 0x2D, 0x45, 0x3F, 0x42, 0xB4, 0x48, 0x23, 0xB2, 0xC8, 0xC6, 0xE3, 0x8F,
+    0xE4, 0xA0, 0x02, 0x91, 0x2E, 0x17, 0x31, 0xCF, 0x8E, 0x3F, 0xF2, 0xA6, 0x81, 0x6C, 0x3C, 0x36,
+    0x22, 0xFB, 0x22, 0x4D, 0xC0, 0x1A, 0x77, 0xA9, 0x3A, 0x90, 0x8E, 0x48, 0x0E, 0x86, 0xDE, 0x17,
+    0xC8, 0x28, 0x6B, 0x10, 0x56, 0x04, 0xCD, 0x15, 0xF2, 0xF0, 0xA5, 0x64, 0x14, 0xD5, 0x8F, 0x6F,
+    0xE3, 0x56, 0xDA, 0xBB, 0x2F, 0x98, 0xD1, 0x2F, 0xA5, 0x81, 0x31, 0x10, 0x59, 0x42, 0x87, 0xAA,
+    0x61, 0x6A, 0x31, 0x0D, 0x3C, 0xF0, 0x39, 0xB3, 0xD5, 0xA1, 0x1E, 0xEA, 0xE7, 0xDD, 0x97, 0xFA,
+    0x09, 0x7E, 0xD7, 0xA2, 0x3B, 0x58, 0xB3, 0x6B, 0xAC, 0x05, 0xDE, 0xD8, 0x24, 0xB6, 0x5A, 0x0A,
+    0xF2, 0x62, 0x20, 0x56, 0x7D, 0x26, 0xEE, 0x7F, 0x76, 0x7C, 0xCF, 0x75, 0xAA, 0x2E, 0x17, 0x31,
+    0x22, 0x7B, 0xE7, 0xC7, 0xF6, 0x7A, 0xE5, 0x7B, 0x76, 0x7C, 0x4F, 0xDF, 0x2A, 0x8A, 0x35, 0xD2,
+    0xC0, 0xAB, 0xA6, 0x97, 0xC0, 0x13, 0xB7, 0xE2, 0xBC, 0xD6, 0x97, 0x36, 0x90, 0x25, 0x67, 0xBF,
+    0xDF, 0xC6, 0x36, 0xDA, 0xF3, 0x64, 0x19, 0xFA, 0x83, 0xF3, 0xE3, 0xD9, 0x4C, 0xE4, 0x83, 0x4B,
+    0x3B, 0x3B, 0xD3, 0x9E, 0x11, 0xCD, 0x21, 0x68, 0xC0, 0xD4, 0xAA, 0xC8, 0x65, 0xC1, 0x5C, 0x0A,
+    0x36, 0x56, 0x24, 0x7C, 0x09, 0x98, 0x05, 0xBD, 0x20, 0x12, 0x15, 0x53, 0xD8, 0x58, 0x59, 0x1B,
+    0x98, 0xCB, 0x36, 0x89, 0x48, 0xAD, 0x97, 0xF6, 0x24, 0x79, 0x01, 0x41, 0x3B, 0xD0, 0x6D, 0x76,
+    0x19, 0xC8, 0xBB, 0x29, 0x06, 0xFA, 0x4E, 0x8B, 0x91, 0xBD, 0x9A, 0x5C, 0x4C, 0xC1, 0xB8, 0xCC,
+    0xE9, 0x45, 0xEB, 0xE8, 0xE5, 0x16, 0x12, 0xDD, 0x40, 0x19, 0x36, 0x04, 0x3E, 0xBA, 0xC8, 0x2D,
+    0x2E, 0x14, 0x11, 0x02, 0x91, 0x73, 0x7D, 0x26, 0xD6, 0x2C, 0xCC, 0x2C, 0x5A, 0x2C, 0x59, 0x82,
+    0xAE, 0x63, 0x0E, 0x0D, 0x5C, 0xCB, 0x2D, 0xCD, 0x37, 0xB5, 0x74, 0x4D, 0xFE, 0xEC, 0xFC, 0xE7,
+    0x2D, 0xB3, 0xFB, 0x1D, 0xBB, 0x19, 0xEA, 0xFD, 0x06, 0xFD, 0x46, 0x85, 0x79, 0xC8, 0x92, 0x4E,
+    0xA1, 0x69, 0xD0, 0xFB, 0x9E, 0xF8, 0xBE, 0x8A, 0x85, 0xA9, 0xA2, 0x26, 0x96, 0x0F, 0xAA, 0x58,
+    0xEE, 0xB7, 0xCA, 0x0E, 0x42, 0x7A, 0xE8, 0x20, 0xD7, 0x7F, 0x16, 0x36, 0x46, 0xC4, 0xDE, 0x22,
+    0x35, 0xAC, 0xF3, 0x35, 0xB8, 0x83, 0x17, 0x21, 0x97, 0x02, 0x66, 0xED, 0x55, 0x13, 0x1A, 0x89,
+    0x9C, 0x23, 0x12, 0x69, 0x91, 0xED, 0x5B, 0x9C, 0xA9, 0x81, 0xB3, 0xAB, 0xC2, 0x26, 0x76, 0x98,
+    0x74, 0x07, 0x85, 0x13, 0x90, 0xA1, 0xC5, 0x0F, 0x45, 0x3F, 0x7A, 0xD2, 0x38, 0x28, 0x13, 0x08,
+    0xFC, 0x16, 0x44, 0x6E, 0x01, 0x89, 0x5A, 0x40, 0x19, 0x2C, 0xED, 0xBA, 0x57, 0x22, 0xE2, 0x98,
+    0xCB, 0x45, 0x50, 0x16, 0x65, 0xD7, 0x89, 0x18, 0x61, 0xA4, 0x22, 0x5E, 0x1C, 0xC8, 0x76, 0xEB,
+    0x8B, 0x75, 0x2B, 0x92, 0x9A, 0xF3, 0x27, 0x9B, 0x2D, 0xE2, 0x7D, 0x4F, 0x72, 0x7F, 0xC1, 0x74,
+    0x0A, 0x57, 0x97, 0x3A, 0x85, 0xA6, 0x23, 0xFC, 0x45, 0x43, 0x7E, 0x4F, 0x13, 0x2C, 0x42, 0x59,
+    0x34, 0xA1, 0xEC, 0x57, 0x6C, 0x0E, 0xFA, 0x04, 0xE5, 0xC1, 0xB8, 0xF3, 0x6A, 0xA1, 0x45, 0xAA,
+    0x75, 0x39, 0x28, 0x5E, 0x49, 0xDF, 0x13, 0x08, 0x8A, 0xAB, 0x18, 0x91, 0xDF, 0x55, 0x89, 0x51,
+    0xF4, 0x42, 0x51, 0x07, 0x6C, 0x1F, 0xA4, 0xFE, 0x55, 0x95, 0xB8, 0x57, 0x97, 0x5D, 0x24, 0x10,
+    0x59, 0x92, 0x9F, 0x5B, 0xF7, 0xBA, 0x05, 0x92, 0x62, 0xC8, 0x40, 0x54, 0x0D, 0xAC, 0x07, 0xED,
+    0x55, 0xC5, 0x93, 0x6E, 0x28, 0xDE, 0xDA, 0x83, 0x7B, 0x1E, 0x92, 0xC8, 0x41, 0x19, 0x17, 0x04,
+    0x3E, 0xB7, 0x44, 0x6E, 0x66, 0x49, 0x98, 0x6F, 0xAB, 0x92, 0x99, 0x88, 0x27, 0x91, 0xA5, 0xBD,
+    0x5A, 0x08, 0xB2, 0xC0, 0x04, 0x08, 0xEA, 0x15, 0xBF, 0x7F, 0x64, 0x10, 0x31, 0x43, 0x0B, 0xA3,
+    0x5E, 0xE4, 0x34, 0x07, 0x32, 0xF4, 0x57, 0xD5, 0xBD, 0xD9, 0x1C, 0x06, 0xB6, 0x54, 0xFD, 0xB8,
+    0x3E, 0x13, 0x56, 0x07, 0xC3, 0xBA, 0x81, 0xE3, 0x29, 0x98, 0xD7, 0x2D, 0xFA, 0xBD, 0x0A, 0xBA,
+    0x06, 0xF2, 0x8F, 0x3C, 0xC8, 0x45, 0xE4, 0x75, 0x11, 0x79, 0xEF, 0xFC, 0x78, 0x7C, 0xFD, 0x2F,
+    0x3E, 0xF2, 0x80, 0x0D, 0xC0, 0xD4, 0xA0, 0xC5, 0xF6, 0xC9, 0x1E, 0x57, 0x0D, 0xEA, 0x8A, 0x9A,
+    0x7A, 0xD5, 0x03, 0x23, 0x77, 0xFD, 0x8B, 0x5B, 0x5A, 0xA2, 0xD7, 0xA5, 0x61, 0x7E, 0xFE, 0xA4,
+    0x8B, 0x1A, 0x76, 0x39, 0x8B, 0xAE, 0xA3, 0x8A, 0x8C, 0x12, 0x5D, 0x47, 0xEE, 0xD3, 0x5D, 0xE8,
+    0x0A, 0xCE, 0x90, 0x82, 0x71, 0xBA, 0x82, 0x6E, 0x6D, 0x6B, 0x3C, 0x7E, 0xE8, 0xAF, 0x44, 0x44,
+    0xE4, 0x1D, 0x11, 0x91, 0x85, 0xAE, 0xA0, 0xBB, 0xEA, 0x03, 0x72, 0xE9, 0x79, 0x34, 0xE9, 0xC8,
+    0xC6, 0xE3, 0x87, 0xDC, 0x47, 0x3E, 0xF8, 0xC4, 0x4B, 0x86, 0x32, 0x44, 0x0E, 0x4E, 0xBE, 0xFD,
+    0x1C, 0x73, 0xE9, 0x78, 0xF0, 0x97, 0x0F, 0x0C, 0xCF, 0x36, 0x88, 0x5E, 0x95, 0x3A, 0x7A, 0x4B,
+    0xDA, 0xA8, 0xA3, 0x8B, 0x3C, 0xD3, 0xA8, 0x22, 0x8B, 0xDC, 0xA7, 0x3B, 0x94, 0x3D, 0x14, 0x37,
+    0xC7, 0x32, 0xE9, 0xEE, 0x8C, 0x7D, 0xAF, 0x07, 0x8E, 0xA4, 0x8E, 0xA4, 0x66, 0xCA, 0x67, 0xFD,
+    0x45, 0x52, 0x19, 0xA9, 0x57, 0x11, 0xB6, 0x8F, 0xC7, 0x7E, 0xA0, 0xF4, 0x8F, 0x42, 0xF9, 0x19,
+    0x7E, 0x33, 0x79, 0x55, 0x16, 0x47, 0xC7, 0x16, 0x12, 0x79, 0x5A, 0x5A, 0xD5, 0x10, 0xDB, 0x4F,
+    0x75, 0x0A, 0xA4, 0xC9, 0xA5, 0x98, 0xC9, 0x6B, 0xD2, 0x1D, 0x1D, 0x5B, 0x50, 0xA7, 0x48, 0x08,
+    0xFC, 0x27, 0x9E, 0x1E, 0xE6, 0xCF, 0xED, 0x1D, 0xB9, 0x38, 0xA9, 0xD9, 0xE4, 0x73, 0xA6, 0xBA,
+    0xC9, 0x8F, 0x19, 0xE5, 0xF2, 0xD4, 0x10, 0xC7, 0xA7, 0x4D, 0x7A, 0xBE, 0x9C, 0x2F, 0xC3, 0xEA,
+    0x93, 0xF6, 0xF9, 0x42, 0x96, 0xBC, 0xA4, 0x6A, 0xED, 0xB4, 0xD3, 0xE7, 0x83, 0x25, 0x1B, 0xCA,
+    0x96, 0x91, 0xBB, 0x0D, 0x58, 0x2F, 0xCA, 0xC8, 0x5D, 0xEF, 0x77, 0xA2, 0x1E, 0x69, 0x97, 0xFD,
+    0xC1, 0x52, 0x59, 0x65, 0xC3, 0x2A, 0xAC, 0x7A, 0x9A, 0xFC, 0xE9, 0xD3, 0x7B, 0xB4, 0xBC, 0x76,
+    0x9B, 0x2F, 0xD5, 0xBB, 0xD2, 0x86, 0x6E, 0x4A, 0xAC, 0x1A, 0x26, 0x61, 0xA5, 0x7C, 0x6C, 0x3F,
+    0xFB, 0x6D, 0x22, 0x76, 0x22, 0x4B, 0xE5, 0x7B, 0xC2, 0x92, 0x80, 0x6A, 0x09, 0xC5, 0x11, 0x2F,
+    0xE0, 0x66, 0xCB, 0x06, 0x7F, 0xE0, 0xF5, 0x05, 0x67, 0x7E, 0x46, 0x6F, 0x39, 0x5F, 0x2F, 0x0E,
+    0x9F, 0x24, 0x2B, 0xB9, 0xE4, 0xF5, 0x05, 0x67, 0x4E, 0xFF, 0xD6, 0xCB, 0x1A, 0x53, 0x90, 0x41,
+    0x8B, 0xAE, 0x0E, 0xE5, 0xE4, 0x2D, 0x3D, 0x9B, 0x9C, 0x3B, 0xE6, 0x75, 0xF0, 0x9B, 0x36, 0x74,
+    0xE9, 0x20, 0xE3, 0xC7, 0xF6, 0x8B, 0xFE, 0x12, 0x98, 0x31, 0x5B, 0x30, 0x6B, 0xB8, 0xD9, 0xC2,
+    0x06, 0xBA, 0x25, 0x6F, 0xF4, 0x6F, 0x9A, 0xE3, 0xAA, 0xD9, 0xC4, 0x02, 0x37, 0x43, 0x49, 0xE0,
+    0x89, 0x1C, 0xC9, 0x67, 0xB8, 0xDC, 0x62, 0xEE, 0xD5, 0x12, 0x52, 0xD8, 0x35, 0x96, 0xB3, 0xBA,
+    0x62, 0x8B, 0x86, 0x2D, 0x52, 0x72, 0x8C, 0xCD, 0x7B, 0x2D, 0x57, 0x93, 0x43, 0x9A, 0x83, 0x39,
+    0x59, 0xA0, 0xA5, 0x01, 0x99, 0x41, 0x1E, 0x7A, 0x8C, 0x3D, 0x8B, 0xAE, 0x4C, 0x45, 0x43, 0x47,
+    0x4A, 0xEC, 0x8C, 0x0D, 0x5A, 0x5D, 0x91, 0xDB, 0x06, 0xED, 0xD3, 0x5E, 0x05, 0x70, 0xD5, 0x7C,
+    0x12, 0xBA, 0xDE, 0x28, 0x8E, 0x5F, 0xCD, 0x26, 0xD7, 0x37, 0x41, 0x47, 0x4E, 0xFD, 0xB4, 0x24,
+    0x8F, 0x9C, 0x71, 0xA5, 0xF6, 0x91, 0xEB, 0x28, 0x73, 0xA2, 0xD7, 0x1D, 0x67, 0x3B, 0x22, 0xA9,
+    0x99, 0x27, 0x36, 0x72, 0x1D, 0xA5, 0xF6, 0x91, 0x8B, 0x8B, 0x92, 0xDD, 0xC8, 0x69, 0x5F, 0xF6,
+    0xCC, 0x1C, 0xC3, 0x04, 0x38, 0xEA, 0x15, 0xBC, 0x1E, 0x0E, 0xC1, 0xA3, 0xDC, 0x7C, 0x9F, 0xD3,
+    0xBE, 0xA4, 0x8B, 0x5C, 0x4E, 0x19, 0x55, 0xD1, 0x2B, 0x0D, 0xE5, 0x16, 0xD1, 0x5B, 0x8E, 0xB9,
+    0x10, 0xBD, 0xDF, 0xB2, 0x1B, 0x55, 0x91, 0xCB, 0x29, 0x55, 0x1B, 0xB9, 0xA8, 0x2A, 0xC9, 0x23,
+    0x47, 0xA7, 0x36, 0xA1, 0xC7, 0xB8, 0x4C, 0x61, 0x74, 0xA0, 0x7E, 0xBA, 0x1E, 0x7F, 0xFB, 0x29,
+    0x6F, 0x9E, 0x1D, 0xDF, 0x23, 0xD2, 0x8A, 0x2C, 0xD5, 0x66, 0x5C, 0x74, 0x91, 0x9B, 0xF4, 0xAC,
+    0x52, 0x19, 0xF8, 0xC8, 0x25, 0x9F, 0x14, 0x7C, 0xEE, 0x54, 0x57, 0x22, 0xC4, 0x32, 0xBF, 0x22,
+    0xDC, 0xA6, 0x10, 0x43, 0x54, 0xA0, 0x5D, 0xAF, 0x38, 0x7E, 0xC5, 0x97, 0xC9, 0xC7, 0x9C, 0x40,
+    0xFF, 0xDC, 0x9F, 0x19, 0x1D, 0x22, 0xC5, 0xDC, 0x6F, 0xF5, 0x5E, 0xA5, 0x7C, 0xC3, 0x4B, 0x29,
+    0x77, 0x7D, 0xCE, 0x0C, 0x94, 0x59, 0x99, 0x96, 0xA3, 0xF2, 0x89, 0x72, 0xB3, 0xE4, 0x93, 0xF6,
+    0xDF, 0x16, 0xF1, 0xA6, 0xB1, 0x99, 0xAE, 0xE2, 0xA2, 0x09, 0x8A, 0x4F, 0x4C, 0xF2, 0xA3, 0xFB,
+    0x91, 0xB2, 0x2C, 0xBB, 0xF2, 0x91, 0x8F, 0xBE, 0xB9, 0xDA, 0x9A, 0xF5, 0x21, 0xE3, 0x56, 0x03,
+    0xFA, 0xE7, 0x1E, 0x33, 0x77, 0xE4, 0x0D, 0x6A, 0x09, 0x79, 0x8D, 0x12, 0x8B, 0xFA, 0xD0, 0xC7,
+    0xD9, 0x78, 0x8C, 0xC8, 0x52, 0x8B, 0xB4, 0x40, 0x49, 0x42, 0xE4, 0x02, 0x7F, 0xD5, 0x85, 0x4D,
+    0x9A, 0xA8, 0xD3, 0x6D, 0xD4, 0x69, 0xF9, 0xF0, 0x2B, 0x92, 0x41, 0x90, 0xB8, 0xA2, 0x21, 0x5B,
+    0x8D, 0x9A, 0xA1, 0x07, 0x6A, 0x0F, 0x69, 0x5E, 0xA0, 0xF7, 0x17, 0x90, 0xE6, 0x1E, 0xBD, 0xFF,
+    0x56, 0x41, 0x3A, 0xDA, 0x45, 0xEF, 0xEF, 0x79, 0xD2, 0x51, 0x5C, 0xE8, 0x7D, 0xD7, 0x91, 0xA6,
+    0xDA, 0xEB, 0xFD, 0x2A, 0x2E, 0xD2, 0x94, 0x4E, 0xEF, 0x57, 0xDA, 0xA7, 0x29, 0xC9, 0x3D, 0xFB,
+    0x15, 0x5D, 0x9A, 0x12, 0xBE, 0xB7, 0x5F, 0x91, 0x4C, 0x53, 0x90, 0xFD, 0x8A, 0x70, 0x91, 0x42,
+    0xB2, 0x5F, 0xC1, 0x02, 0x1E, 0x00, 0xE3, 0xD0, 0xBE, 0x37, 0xE1, 0xAF, 0x8C, 0x90, 0xEB, 0x27,
+    0xA4, 0x28, 0x45, 0xEE, 0x5B, 0x7E, 0xBF, 0x9B, 0x13, 0xBD, 0x59, 0x93, 0xED, 0x7E, 0x22, 0xEC,
+    0x24, 0x2B, 0xD1, 0x75, 0x0E, 0x7A, 0xBF, 0x85, 0x34, 0xAF, 0xD0, 0xFB, 0x02, 0x69, 0xDA, 0xA2,
+    0xF7, 0x5F, 0xAB, 0x48, 0x47, 0x39, 0x7A, 0xFF, 0xE5, 0x96, 0x74, 0x64, 0x9C, 0xDE, 0xAF, 0x72,
+    0xD2, 0x54, 0xB5, 0x7A, 0xBF, 0x32, 0x2E, 0x4D, 0xC9, 0xF5, 0x7E, 0x15, 0x34, 0x69, 0x8A, 0xD9,
+    0xDB, 0xAF, 0x98, 0xA5, 0x29, 0xC1, 0x07, 0xFB, 0x15, 0x66, 0x91, 0xC2, 0x6C, 0xBF, 0x22, 0x58,
+    0xA4, 0x60, 0xAA, 0x2B, 0x64, 0x26, 0x72, 0x03, 0x44, 0xCC, 0x0C, 0x70, 0x35, 0x36, 0xE0, 0x91,
+    0xB8, 0x8D, 0x5E, 0x97, 0x66, 0x7E, 0xEE, 0xE4, 0x6B, 0x9E, 0xDD, 0xB3, 0xE8, 0x0B, 0xD5, 0xA7,
+    0x01, 0xCC, 0x64, 0x57, 0x1B, 0x04, 0x1A, 0x88, 0x21, 0x70, 0x3D, 0xBF, 0xBB, 0xC9, 0x66, 0xAF,
+    0x47, 0x4C, 0x4C, 0x01, 0xF3, 0x1A, 0x74, 0x77, 0x45, 0xEE, 0xFA, 0x8A, 0x5B, 0x67, 0x8D, 0x35,
+    0x26, 0xBA, 0x0A, 0x7C, 0x4B, 0xB4, 0xEC, 0x55, 0xCB, 0x9B, 0x5F, 0xA8, 0x75, 0x62, 0x3B, 0x18,
+    0x90, 0x72, 0x06, 0x93, 0xF3, 0x04, 0x88, 0xFE, 0xD9, 0x89, 0x79, 0xD1, 0x4C, 0x44, 0xFE, 0xD3,
+    0x70, 0xF9, 0xFD, 0x8E, 0x99, 0x0D, 0xAB, 0xB0, 0x26, 0x63, 0x8A, 0xAE, 0x43, 0x47, 0xC6, 0xE4,
+    0x53, 0x5E, 0x7C, 0xAA, 0xC6, 0x8F, 0xAA, 0xAB, 0x1B, 0x3F, 0xAA, 0x86, 0xC6, 0xA7, 0x4D, 0x53,
+    0xA2, 0xFD, 0xFD, 0x8A, 0x3C, 0x4D, 0xE1, 0xF2, 0xAA, 0x26, 0xF2, 0xFD, 0x0A, 0x16, 0xE9, 0x30,
+    0x32, 0x52, 0xFA, 0xC9, 0x85, 0x0E, 0x62, 0xB1, 0x28, 0xA9, 0x60, 0x7D, 0xFB, 0xA0, 0xE1, 0xCF,
+    0x9F, 0x7C, 0xCD, 0x33, 0xFD, 0x2C, 0x0D, 0xAF, 0x6B, 0xAE, 0x0A, 0xA2, 0x8A, 0xA4, 0x43, 0x2D,
+    0xE9, 0xF1, 0x04, 0x46, 0x5A, 0x58, 0x1B, 0x6F, 0xFE, 0x5D, 0xE0, 0x18, 0x54, 0xAF, 0x6D, 0x80,
+    0xF1, 0xF8, 0xCB, 0x33, 0xCB, 0x7E, 0x9D, 0x9B, 0xC0, 0xF0, 0x24, 0x44, 0xE2, 0x21, 0x90, 0x61,
+    0xE0, 0xFC, 0x5D, 0x94, 0xAF, 0x08, 0x08, 0xAA, 0x08, 0x64, 0xD9, 0x2B, 0x33, 0x06, 0x5D, 0xC2,
+    0x97, 0x52, 0x4E, 0x36, 0x37, 0x20, 0xF0, 0xBB, 0x10, 0x56, 0x0D, 0x98, 0xBB, 0x6B, 0x38, 0x1E,
+    0x16, 0xB0, 0xA1, 0xFE, 0x4E, 0x0A, 0xCB, 0xD1, 0x35, 0xCB, 0x96, 0x29, 0xE8, 0x12, 0x94, 0x9F,
+    0xA0, 0x9D, 0x47, 0xF1, 0x65, 0x16, 0xF8, 0x01, 0x0E, 0x8C, 0xD4, 0xE1, 0x80, 0xB7, 0x3C, 0xB4,
+    0x02, 0x3A, 0xFE, 0x94, 0x5C, 0x84, 0xEC, 0x07, 0x73, 0x97, 0x12, 0xD5, 0x29, 0xDA, 0xA7, 0x04,
+    0x57, 0x1D, 0xBA, 0x4E, 0x89, 0x5D, 0x2E, 0x42, 0x2E, 0x0D, 0xD9, 0x0F, 0x1A, 0x52, 0x3A, 0x52,
+    0x32, 0x52, 0x12, 0x9B, 0x62, 0x5C, 0x4A, 0x38, 0xFC, 0x8F, 0x2E, 0x85, 0x5D, 0xD6, 0x2C, 0x1D,
+    0x39, 0x91, 0xC3, 0x73, 0x08, 0x58, 0x3F, 0xB1, 0x7B, 0x66, 0xFE, 0xE6, 0x3B, 0x7F, 0x36, 0x2F,
+    0x22, 0xCF, 0x2E, 0x91, 0xA3, 0xBC, 0xEE, 0xE9, 0xAB, 0xC9, 0xCD, 0x6A, 0xD3, 0x55, 0x5F, 0xFA,
+    0xC8, 0x1E, 0xD4, 0xC0, 0x37, 0xD7, 0x9B, 0x33, 0xF3, 0x5F, 0x5C, 0x3E, 0x1F, 0xB5, 0x24, 0x8E,
+    0xDD, 0xDF, 0xCA, 0x25, 0xAF, 0x98, 0xBE, 0xD0, 0x71, 0x07, 0x78, 0x14, 0xB0, 0xC6, 0x1A, 0xA1,
+    0xCB, 0x08, 0x7C, 0xDB, 0xD3, 0xFF, 0xDC, 0x1D, 0x90, 0xFF, 0xAF, 0xA2, 0x2C, 0x9B, 0xFC, 0xD0,
+    0xA5, 0x89, 0x29, 0xE6, 0xB5, 0xEE, 0x58, 0xFB, 0x2C, 0x35, 0x0B, 0x1B, 0x07, 0xC6, 0xB0, 0x9E,
+    0x2F, 0x1A, 0x3A, 0xD8, 0x2D, 0x52, 0x47, 0x22, 0x2F, 0x2F, 0xD6, 0xCE, 0xE4, 0x3D, 0xA1, 0x4B,
+    0xFB, 0x20, 0xB7, 0xA8, 0x25, 0x84, 0x62, 0x89, 0xC4, 0x12, 0x09, 0x84, 0x5D, 0x3F, 0xCB, 0x5E,
+    0x45, 0x11, 0xDF, 0xDC, 0x5E, 0xEF, 0xE6, 0x22, 0x81, 0xF4, 0x86, 0x35, 0xD4, 0x26, 0xDA, 0x63,
+    0x1C, 0x09, 0x8C, 0x06, 0xEE, 0x3E, 0x90, 0x53, 0xB1, 0x74, 0xF9, 0x89, 0x72, 0x02, 0x13, 0xD8,
+    0x82, 0xA4, 0x26, 0x5A, 0x5A, 0xE6, 0x9E, 0xB0, 0x83, 0x5D, 0xC8, 0x20, 0x7B, 0x84, 0xDD, 0x99,
+    0xB4, 0x89, 0x54, 0x6C, 0xF6, 0xE0, 0xA1, 0x0E, 0x66, 0x9E, 0xF8, 0x7E, 0xA7, 0xAB, 0xE3, 0x1C,
+    0xE9, 0x27, 0xB7, 0x2F, 0x37, 0xB7, 0x1B, 0x20, 0x04, 0x52, 0x44, 0xAF, 0xD6, 0x31, 0xCD, 0x06,
+    0x1B, 0x9F, 0x33, 0xB7, 0x5F, 0x6A, 0xC6, 0xEE, 0x18, 0xA0, 0x16, 0x45, 0x1F, 0x47, 0xC5, 0xCD,
+    0xFD, 0x9C, 0xF3, 0x99, 0x33, 0x36, 0x81, 0x27, 0x61, 0xD6, 0x83, 0x32, 0x5D, 0x70, 0xDA, 0xEA,
+    0x05, 0x1F, 0xAB, 0x76, 0xFF, 0x52, 0x2B, 0x76, 0x83, 0x8D, 0x98, 0x26, 0xDA, 0xAB, 0x03, 0x29,
+    0x90, 0x61, 0x0E, 0xF9, 0x1C, 0x15, 0x3B, 0x17, 0x91, 0xB9, 0x88, 0x8C, 0x1F, 0x3C, 0x3F, 0x3E,
+    0x00, 0xC2, 0x7D, 0xD1, 0x23, 0x70, 0xBD, 0xB1, 0x23, 0x6C, 0x06, 0x0E, 0x67, 0x04, 0x37, 0xB7,
+    0x90, 0x54, 0x00, 0xDF, 0xEE, 0x21, 0xD6, 0xF1, 0xDB, 0x3F, 0x11, 0xB9, 0xE5, 0xFC, 0xE6, 0x94,
+    0xB0, 0xE2, 0x23, 0x27, 0x5D, 0x91, 0x13, 0x88, 0x8F, 0x84, 0x3B, 0xD0, 0x8E, 0xA4, 0x60, 0x84,
+    0x76, 0x37, 0x77, 0xC1, 0x12, 0x65, 0x95, 0x55, 0xDE, 0x14, 0x4C, 0xB3, 0xDE, 0xD6, 0x6F, 0xFC,
+    0xC1, 0xEC, 0xF5, 0x95, 0x94, 0x07, 0x7A, 0x73, 0x85, 0x76, 0xF0, 0xA4, 0xAA, 0x22, 0x52, 0x36,
+    0x75, 0x85, 0x5A, 0x3E, 0xCF, 0x5C, 0xBC, 0x3A, 0x3B, 0x26, 0xAC, 0x60, 0xCA, 0xC7, 0x07, 0x2B,
+    0xA3, 0x90, 0xC0, 0xDC, 0xC3, 0x91, 0x83, 0x7C, 0x3E, 0xF6, 0xC2, 0xDB, 0xCF, 0x7F, 0x5C, 0xBA,
+    0xEB, 0x2F, 0x5C, 0xDA, 0x8E, 0x44, 0xEA, 0xF5, 0x17, 0xDE, 0xDE, 0xFE, 0x94, 0xF9, 0xBC, 0x7E,
+    0xDD, 0xCE, 0xE4, 0x57, 0xB2, 0xB8, 0x6E, 0xDD, 0x2A, 0x38, 0xC4, 0x11, 0x92, 0x66, 0x84, 0x99,
+    0x2F, 0x89, 0x94, 0x80, 0xED, 0xE7, 0xAD, 0xD0, 0xC1, 0xC5, 0x06, 0xB2, 0x29, 0x98, 0xBF, 0xB0,
+    0xE8, 0xBF, 0xAD, 0x3E, 0xD3, 0x83, 0x3F, 0xB5, 0xE8, 0x7D, 0x4F, 0xE0, 0xCF, 0x42, 0x67, 0xCE,
+    0x05, 0x1D, 0x22, 0x0B, 0x42, 0x19, 0x38, 0x8D, 0x4D, 0x45, 0x5E, 0x3D, 0x6E, 0xE6, 0x42, 0x35,
+    0x73, 0x03, 0xB8, 0xF0, 0x33, 0x21, 0xEC, 0x7F, 0xD5, 0xE8, 0x65, 0x22, 0x97, 0xEB, 0xD9, 0xE2,
+    0x38, 0x1B, 0xC0, 0x5C, 0x0A, 0x12, 0xF1, 0x07, 0x20, 0xA9, 0xC9, 0xE7, 0xCB, 0xF6, 0xEA, 0x41,
+    0xDB, 0xF4, 0xBA, 0x98, 0x24, 0xAA, 0x31, 0x6E, 0x69, 0x13, 0x67, 0x44, 0x2A, 0x66, 0xD2, 0x2B,
+    0xE2, 0xB5, 0x74, 0xCC, 0xA4, 0x1A, 0x12, 0xFB, 0x42, 0x19, 0xDF, 0x54, 0x05, 0xC7, 0xF0, 0xBD,
+    0xC6, 0x67, 0xD6, 0x1C, 0x00, 0xA4, 0xBE, 0xDA, 0x06, 0x58, 0xE7, 0xEB, 0x3C, 0x11, 0x54, 0x5A,
+    0x3A, 0xCC, 0x72, 0x35, 0xA3, 0x7E, 0xA1, 0x72, 0x04, 0xE7, 0x40, 0xBF, 0x63, 0x51, 0xCE, 0xC3,
+    0x8B, 0x23, 0xB8, 0xF5, 0x56, 0x08, 0xE4, 0x0A, 0x23, 0xF4, 0xD5, 0xB6, 0x08, 0x49, 0x41, 0xF4,
+    0xAF, 0xA1, 0x7E, 0x91, 0x1B, 0x42, 0xF0, 0x9E, 0x70, 0xF1, 0xA5, 0x94, 0x6B, 0xED, 0xC4, 0x26,
+    0xE1, 0xCF, 0x5B, 0x74, 0xDD, 0x12, 0xD4, 0x13, 0xA8, 0x47, 0x70, 0xA4, 0x2F, 0x93, 0xF2, 0x9F,
+    0xBF, 0x7D, 0xFE, 0xC2, 0xA2, 0x7F, 0x55, 0x41, 0xD3, 0x41, 0x99, 0x14, 0xE4, 0xFA, 0x22, 0x73,
+    0x72, 0x11, 0xAB, 0x64, 0x39, 0xF4, 0x82, 0x07, 0xD6, 0x30, 0xCF, 0xF8, 0xC0, 0x97, 0x4C, 0x8C,
+    0x35, 0xBA, 0xC2, 0x1E, 0xE9, 0xF5, 0xA7, 0xFC, 0x7E, 0xF9, 0x69, 0x44, 0xCE, 0xF0, 0x42, 0xC5,
+    0x32, 0xB7, 0xF9, 0xDF, 0x88, 0x9C, 0x0D, 0xE5, 0x17, 0xB5, 0xB2, 0x5F, 0x59, 0x2B, 0x54, 0x70,
+    0xB4, 0x1E, 0x94, 0x27, 0x4F, 0x02, 0xB7, 0x02, 0xE1, 0x5F, 0x0D, 0xF0, 0xE8, 0x35, 0xFB, 0xF9,
+    0x9B, 0xE0, 0xA3, 0xC0, 0x35, 0xB9, 0x8A, 0xE7, 0x1E, 0x66, 0x19, 0xC8, 0x3D, 0x80, 0xFE, 0x1B,
+    0x0F, 0x90, 0xA9, 0x01, 0xA6, 0xB9, 0x82, 0xC0, 0x13, 0x43, 0x0E, 0xD9, 0x14, 0xD5, 0xF5, 0x00,
+    0xD4, 0x96, 0x68, 0xCF, 0x93, 0x7B, 0xF2, 0xC8, 0xF1, 0x81, 0xA3, 0x35, 0x36, 0x7C, 0xDD, 0x86,
+    0x55, 0xC6, 0xF1, 0xE3, 0x24, 0x94, 0x34, 0x13, 0x3A, 0xE5, 0x43, 0xD7, 0xE8, 0x5A, 0x57, 0x89,
+    0xAE, 0x63, 0x6B, 0x8A, 0x36, 0x72, 0x25, 0x89, 0xAE, 0x62, 0x5D, 0x33, 0x89, 0xC9, 0x8C, 0xA5,
+    0x69, 0x29, 0x27, 0xE8, 0x5F, 0x55, 0xEA, 0x5D, 0x4F, 0xF4, 0x16, 0xFA, 0xAD, 0x82, 0xB8, 0xC4,
+    0xEC, 0x42, 0x5E, 0x13, 0x7B, 0x10, 0xC8, 0x1D, 0x41, 0x07, 0x4B, 0x08, 0xEB, 0xDE, 0x98, 0xBA,
+    0x66, 0x01, 0x66, 0x96, 0x01, 0x44, 0xDE, 0xCB, 0x32, 0xBA, 0x4A, 0xE0, 0xC0, 0x90, 0x0D, 0x37,
+    0x13, 0x9C, 0xE2, 0xF7, 0xA7, 0xC4, 0x4E, 0x35, 0x2D, 0xF3, 0x22, 0xDA, 0xF3, 0xFA, 0x1D, 0xB2,
+    0xC8, 0x99, 0x11, 0x4D, 0x6C, 0xCB, 0x26, 0x74, 0x99, 0xFE, 0x1B, 0x9F, 0x50, 0x9A, 0xD0, 0xB5,
+    0xCA, 0x4F, 0xCC, 0x3D, 0x95, 0xDE, 0xAF, 0x8F, 0xC7, 0x98, 0x3F, 0xB5, 0x93, 0x92, 0x64, 0xC2,
+    0x7B, 0x35, 0x5B, 0xB5, 0x7E, 0x07, 0xC4, 0x46, 0x1D, 0xBA, 0xC3, 0xD4, 0x44, 0x35, 0xB9, 0xED,
+    0x2B, 0x31, 0xE8, 0x40, 0x89, 0x43, 0x35, 0x2D, 0x34, 0x51, 0xB1, 0x62, 0x03, 0xBF, 0x3A, 0x14,
+    0xFC, 0xCA, 0x72, 0x1F, 0x0A, 0x64, 0x09, 0xBA, 0x4A, 0x56, 0x05, 0xFE, 0xAA, 0xE0, 0xC1, 0x47,
+    0x80, 0x44, 0x3B, 0xCC, 0xCB, 0x0D, 0x14, 0x1B, 0x57, 0xEB, 0xB0, 0xD4, 0x6F, 0xDA, 0x5E, 0xDC,
+    0x2C, 0x75, 0x4D, 0x46, 0x49, 0x82, 0x29, 0x4C, 0x11, 0xF8, 0xC8, 0x91, 0xE9, 0x9A, 0xE8, 0x15,
+    0x0F, 0x8B, 0x06, 0xE2, 0x6E, 0x80, 0xA9, 0xCE, 0x3E, 0xAE, 0x58, 0xD7, 0x3C, 0x38, 0x80, 0x40,
+    0x17, 0x1F, 0x82, 0x40, 0xC7, 0x22, 0xDD, 0x5C, 0xE4, 0xFD, 0x9D, 0x9D, 0xD3, 0x0E, 0x76, 0x7B,
+    0x4C, 0xDE, 0x0A, 0x6B, 0xD1, 0x97, 0x24, 0x1A, 0x38, 0xBF, 0x01, 0x45, 0x32, 0x40, 0x63, 0x76,
+    0x07, 0x6E, 0x11, 0x82, 0x8B, 0xE3, 0xF1, 0xFD, 0x3D, 0xFF, 0xB0, 0x44, 0x6D, 0x12, 0xAE, 0xC4,
+    0x81, 0xC9, 0x20, 0x0E, 0xDC, 0xBE, 0xF3, 0xDC, 0x4C, 0x16, 0x47, 0xC7, 0x1D, 0xAA, 0x45, 0x7B,
+    0x22, 0x47, 0x6C, 0xC9, 0xA0, 0x1B, 0x16, 0xAB, 0xF4, 0x9F, 0x4F, 0x41, 0x64, 0x29, 0xB2, 0x44,
+    0x71, 0x80, 0x41, 0x56, 0x07, 0x36, 0xF6, 0x50, 0x44, 0x12, 0x91, 0xC5, 0x63, 0x3B, 0x2F, 0xF4,
+    0x39, 0x51, 0x1F, 0xCD, 0xC9, 0x27, 0x65, 0xFA, 0xEC, 0x78, 0xFC, 0x8F, 0x06, 0x1B, 0x6A, 0xC1,
+    0x06, 0xEC, 0xC2, 0xEE, 0x15, 0xF8, 0xD0, 0x67, 0xCD, 0xA7, 0x42, 0x61, 0x6C, 0x89, 0xF9, 0xB1,
+    0x23, 0xEE, 0x20, 0xAE, 0x56, 0x38, 0xBC, 0x2F, 0xB9, 0x56, 0x37, 0xD8, 0x38, 0x4E, 0x13, 0xBD,
+    0x5A, 0x69, 0xB1, 0x2C, 0x87, 0xA6, 0xFB, 0xCC, 0xB5, 0xBA, 0x11, 0xC8, 0x2F, 0xC4, 0x77, 0x4C,
+    0x89, 0xAF, 0xA3, 0x78, 0xBE, 0xDE, 0x05, 0x47, 0xE9, 0x68, 0x55, 0x83, 0xC7, 0xAA, 0x4D, 0xE3,
+    0xBA, 0xD0, 0x8D, 0xB0, 0xB0, 0x49, 0xEE, 0xA2, 0xA5, 0xF2, 0xED, 0x44, 0x9F, 0x67, 0x4D, 0xD9,
+    0x43, 0xA6, 0xF9, 0xD6, 0x81, 0x71, 0x37, 0x97, 0x37, 0x64, 0x71, 0x74, 0x6C, 0x6F, 0xDF, 0xD9,
+    0x79, 0x46, 0xA4, 0xBB, 0x7D, 0x67, 0xA7, 0xB8, 0xC6, 0xF4, 0xB9, 0x31, 0x9D, 0xDE, 0x76, 0x48,
+    0xE9, 0x6A, 0x92, 0x45, 0x2F, 0x17, 0xDF, 0x5D, 0x1E, 0xEE, 0x82, 0x2A, 0x4D, 0x9E, 0x71, 0xB7,
+    0x11, 0xD5, 0xC7, 0xCB, 0xBB, 0x8E, 0xDD, 0xF9, 0xAD, 0xD1, 0x28, 0x6E, 0x94, 0x55, 0xF6, 0x81,
+    0xE4, 0xDE, 0xAA, 0xCD, 0xA2, 0xA7, 0xEB, 0x27, 0x0D, 0xF6, 0x08, 0x1F, 0x96, 0x84, 0x47, 0xA3,
+    0xD1, 0xE8, 0x36, 0x28, 0xB3, 0x7E, 0x7F, 0xF4, 0xF7, 0x8F, 0xAE, 0xD9, 0x24, 0xAA, 0xCC, 0x33,
+    0x5E, 0x57, 0x0D, 0x7E, 0xC4, 0x91, 0x43, 0x9C, 0x22, 0xB6, 0xAA, 0x59, 0x3F, 0xFC, 0xF5, 0x27,
+    0x82, 0x7D, 0xE9, 0xCC, 0x92, 0x35, 0xD4, 0x4F, 0x95, 0x34, 0xD9, 0x0B, 0xAF, 0xDA, 0x6F, 0x1F,
+    0xC1, 0x6A, 0x37, 0x31, 0x45, 0x93, 0x68, 0x9F, 0x2B, 0x1B, 0xB9, 0xCE, 0x3C, 0xE5, 0x13, 0x5D,
+    0x8D, 0x14, 0x99, 0xF6, 0x89, 0x6A, 0x8C, 0x3D, 0xA3, 0xDD, 0x46, 0xE4, 0x3A, 0xF3, 0x54, 0x93,
+    0x04, 0xF5, 0x48, 0xD9, 0x07, 0xA2, 0x3A, 0xA1, 0x0C, 0xEA, 0x35, 0xB5, 0x79, 0xD6, 0x3C, 0x53,
+    0x9F, 0x59, 0x03, 0x6E, 0xFD, 0x7B, 0x17, 0x96, 0x3F, 0xA8, 0x6F, 0xC5, 0x12, 0xD9, 0xBF, 0xBC,
+    0x6F, 0xF9, 0x97, 0x0F, 0xDA, 0x23, 0xC0, 0x5C, 0x1E, 0x3B, 0x8D, 0x39, 0xD8, 0x31, 0x2E, 0x57,
+    0x4D, 0xB2, 0xD7, 0x1E, 0x86, 0xB5, 0xEC, 0x89, 0x17, 0x9F, 0xC8, 0xD6, 0x82, 0x42, 0x3B, 0xED,
+    0xFE, 0xFE, 0xBF, 0xCD, 0x3B, 0xB8, 0xFD, 0xB9, 0xBC, 0xD3, 0x4E, 0x3B, 0xED, 0x00, 0xB4, 0xD3,
+    0x2E, 0xEF, 0xFE, 0xFE, 0xBF, 0xD5, 0x2E, 0x28, 0x6E, 0x7F, 0x6E, 0xB6, 0x00, 0x88, 0x95, 0x8F,
+    0x95, 0x8F, 0xBF, 0xF1, 0xDE, 0x22, 0xB7, 0x18, 0xDB, 0x18, 0xDB, 0x18, 0xBB, 0xB8, 0xB7, 0x8B,
+    0x1D, 0x69, 0x9E, 0x72, 0xA5, 0x42, 0xAF, 0xAD, 0x45, 0xB2, 0x74, 0xF2, 0xE2, 0xA6, 0x51, 0x75,
+    0x5C, 0xC5, 0xEA, 0xD2, 0x59, 0xB1, 0x0A, 0x7F, 0x87, 0x76, 0x4F, 0x86, 0x7F, 0x95, 0x57, 0x0F,
+    0xF4, 0x55, 0x78, 0xFB, 0xCE, 0x73, 0xB9, 0x74, 0x23, 0x46, 0x77, 0x71, 0xEC, 0x2E, 0x8E, 0xF5,
+    0x32, 0xF1, 0xE3, 0xA3, 0x1B, 0xFE, 0xE1, 0xD9, 0x49, 0x7C, 0xA1, 0x67, 0xFF, 0x7E, 0xE8, 0xB2,
+    0xAB, 0x2A, 0xBE, 0x6F, 0xFD, 0xE0, 0x37, 0xED, 0x44, 0xFF, 0x92, 0xB5, 0x6B, 0xDA, 0xF6, 0x9A,
+    0xCA, 0xFD, 0x90, 0xD1, 0x7F, 0xD5, 0x2F, 0x8E, 0x8E, 0xC7, 0xF7, 0x89, 0x2C, 0x1F, 0xDB, 0xD9,
+    0xD9, 0xEE, 0x21, 0x7B, 0xDD, 0xED, 0x3B, 0x3B, 0x05, 0x70, 0x74, 0x3C, 0xBE, 0x47, 0xA4, 0x3B,
+    0x3A, 0x1E, 0x5B, 0x65, 0x0F, 0x99, 0xF6, 0xDB, 0xC7, 0xE7, 0xDD, 0x5D, 0x51, 0x73, 0x84, 0xAB,
+    0xBB, 0xD2, 0xD1, 0xF1, 0xB0, 0x70, 0x44, 0x96, 0x8F, 0xED, 0xEC, 0xF4, 0x71, 0x50, 0x32, 0x2B,
+    0x92, 0x2A, 0xA9, 0x74, 0x7D, 0x30, 0x53, 0x1D, 0x87, 0x11, 0x4C, 0xA0, 0x01, 0x4F, 0x50, 0xA3,
+    0x1D, 0xA1, 0xC3, 0x58, 0xCC, 0xF5, 0x5E, 0x56, 0x84, 0x8E, 0x68, 0xF5, 0x32, 0x85, 0x09, 0x3C,
+    0x02, 0x9B, 0xE5, 0xB7, 0x6F, 0xFC, 0x76, 0xB9, 0xF9, 0x5D, 0x6E, 0xEA, 0x2B, 0x27, 0x1D, 0x4F,
+    0x72, 0xE9, 0x8E, 0x8E, 0x1F, 0x00, 0xE6, 0xB2, 0xFC, 0x5F, 0xC6, 0x7F, 0xF4, 0x22, 0x37, 0xBE,
+    0xC8, 0x8D, 0x73, 0x59, 0x3E, 0xB6, 0xF3, 0x3C, 0x10, 0x5F, 0x68, 0xFE, 0xE1, 0xD6, 0x1F, 0x3F,
+    0x3E, 0xBA, 0x01, 0x38, 0x72, 0xDF, 0x1F, 0xE5, 0xAF, 0x34, 0xB3, 0x37, 0x6F, 0x04, 0x92, 0x33,
+    0xCD, 0xE4, 0x0E, 0xF3, 0x5F, 0xB4, 0x7C, 0x6C, 0x91, 0x37, 0x54, 0xA7, 0x1A, 0xE5, 0x95, 0xC7,
+    0xB2, 0x69, 0xAA, 0xA9, 0xAE, 0x53, 0x2C, 0x1F, 0xAA, 0xC3, 0xDB, 0x4D, 0x3D, 0xB9, 0xD5, 0x00,
+    0xB7, 0xA3, 0xDA, 0x7B, 0x5F, 0x7B, 0xFD, 0x2F, 0xB6, 0xB2, 0x0D, 0xFF, 0x1D, 0x05, 0xB7, 0xE9,
+    0x2A, 0xD5, 0x5D, 0xEC, 0x7A, 0x3A, 0xB9, 0xD8, 0xDA, 0x79, 0xE1, 0x8D, 0x82, 0x3B, 0x9E, 0x24,
+    0xF8, 0x3F, 0x2D, 0xDF, 0xFC, 0xD8, 0x34, 0xAF, 0x19, 0x3D, 0xF7, 0x2D, 0x1F, 0xAB, 0x6F, 0xA4,
+    0xBE, 0x11, 0x50, 0xF7, 0x1F, 0x8A, 0x17, 0xC7, 0x32, 0xE9, 0xEE, 0x9C, 0xFB, 0x23, 0xB5, 0xA5,
+    0x17, 0x99, 0xA7, 0x30, 0x62, 0x7D, 0xFB, 0xF7, 0x92, 0xC5, 0xB1, 0x74, 0xD6, 0x3E, 0x11, 0xD6,
+    0xDC, 0xB6, 0xB2, 0x8F, 0x02, 0x04, 0xAD, 0x99, 0xC9, 0x3B, 0x61, 0xD7, 0x5F, 0x5D, 0x7A, 0x27,
+    0xEC, 0xAC, 0x82, 0x13, 0x84, 0x4F, 0x57, 0x89, 0xB4, 0xE6, 0x82, 0x0F, 0x9E, 0xEE, 0x4D, 0x90,
+    0xA7, 0x92, 0xA7, 0x5B, 0x83, 0x37, 0xCC, 0x5C, 0xEE, 0xF2, 0x37, 0x3A, 0xDD, 0xE9, 0xC5, 0xE3,
+    0x00, 0x6F, 0xC0, 0x26, 0x37, 0x3C, 0xCC, 0xCF, 0xBE, 0xC7, 0x36, 0xFF, 0x8D, 0xFA, 0x0E, 0xFC,
+    0x1E, 0x1A, 0xD6, 0x61, 0x8D, 0x87, 0x1F, 0x86, 0x53, 0x7F, 0x0E, 0x70, 0xC3, 0xE3, 0x15, 0x7C,
+    0xEF, 0x8D, 0x43, 0xA0, 0x6E, 0x78, 0xFC, 0x61, 0xD8, 0xAC, 0xD6, 0xE1, 0x30, 0x7C, 0x8D, 0x00,
+    0xF8, 0xDF, 0xD4, 0xF7, 0xF8, 0x8E, 0xFA, 0xD9, 0x9D, 0xFC, 0x08, 0x36, 0xB9, 0xA1, 0x8F, 0xF7,
+    0xB9, 0xE0, 0xB9, 0xE0, 0x5F, 0xCD, 0xDC, 0xAC, 0xCA, 0x2B, 0xD6, 0x6D, 0x6E, 0x77, 0xE3, 0x37,
+    0xEA, 0x4D, 0xA2, 0xEC, 0x89, 0x27, 0xD2, 0x18, 0xF5, 0x00, 0xD2, 0xE4, 0x2F, 0xBC, 0x6A, 0xBF,
+    0x7D, 0xC4, 0xDB, 0xD8, 0xAA, 0x06, 0x40, 0x7F, 0x6D, 0xF6, 0x8B, 0x36, 0x7F, 0xF5, 0x7F, 0xC0,
+    0xB2, 0xBD, 0xBB, 0x15, 0xD6, 0xB1, 0xFB, 0xE6, 0xC3, 0x61, 0x1D, 0x55, 0xBB, 0xB3, 0xEF, 0xF3,
+    0x30, 0x9B, 0x5B, 0x81, 0x8F, 0xF6, 0x9B, 0xE8, 0x8D, 0x49, 0x7E, 0xDF, 0xB1, 0x87, 0x6F, 0xBC,
+    0xF1, 0x89, 0xD4, 0x98, 0x5B, 0x9F, 0xE4, 0x50, 0x96, 0xDF, 0xA4, 0xDD, 0x37, 0xFE, 0x2A, 0xEF,
+    0xA2, 0xDA, 0xF8, 0xAF, 0x3F, 0xDC, 0xF7, 0x87, 0xFF, 0xFA, 0xEC, 0x9F, 0xBC, 0x38, 0xBA, 0xF1,
+    0xC5, 0xD1, 0x8D, 0xE9, 0xD9, 0x49, 0xFC, 0x46, 0x73, 0x97, 0xB6, 0xB3, 0x5F, 0xFF, 0x2B, 0xE5,
+    0x6E, 0x1A, 0x01, 0x8C, 0x62, 0x80, 0x26, 0xAA, 0x21, 0xAA, 0x95, 0xFC, 0x8F, 0x7F, 0x28, 0x96,
+    0xA4, 0x37, 0x1D, 0x3E, 0xF6, 0xFC, 0x50, 0xB5, 0x9F, 0xF0, 0xCD, 0xCE, 0xCE, 0xCE, 0xCE, 0x0B,
+    0x22, 0xB2, 0x3C, 0xB8, 0x60, 0x6C, 0xE1, 0x50, 0x24, 0x4B, 0xCB, 0x28, 0xD9, 0x99, 0xCB, 0x85,
+    0xE6, 0x2E, 0xD4, 0x49, 0xA9, 0x8E, 0x0C, 0xCA, 0xE7, 0xC7, 0x9E, 0x87, 0x3E, 0x86, 0x3E, 0xB6,
+    0x3E, 0xE6, 0x3E, 0x95, 0xD1, 0xD0, 0xD8, 0x10, 0xF4, 0x26, 0xB0, 0xFB, 0x44, 0x44, 0xE4, 0x0F,
+    0x77, 0x76, 0x76, 0x76, 0xFA, 0xDE, 0x3B, 0xB0, 0xB0, 0x6B, 0x77, 0xFF, 0x11, 0xFF, 0xE5, 0xE9,
+    0x53, 0xFF, 0x49, 0x94, 0x3F, 0xCE, 0x9A, 0xFD, 0xF5, 0x3F, 0xD3, 0xC9, 0xE2, 0x94, 0x72, 0x4A,
+    0xE0, 0x3F, 0xF8, 0xC6, 0x3F, 0xFD, 0xA7, 0x8F, 0xAF, 0xD9, 0x5F, 0xFF, 0xB7, 0xFA, 0x89, 0xC3,
+    0xD5, 0x7F, 0x58, 0xBC, 0xB2, 0x00, 0xFE, 0x7D, 0xFB, 0xBF, 0xEB, 0xEF, 0xFE, 0xDE, 0xF6, 0x7F,
+    0xF4, 0xD4, 0xDE, 0x25, 0x50, 0xFF, 0xF9, 0xAF, 0xEF, 0xD4, 0x7C, 0x4F, 0x17, 0x51, 0x0D, 0xDF,
+    0xC3, 0xFD, 0xA3, 0x5B, 0x27, 0xD5, 0x7F, 0xCC, 0xFF, 0xA1, 0x6F, 0xFB, 0x56, 0x72, 0x0A, 0xB6,
+    0x83, 0xE2, 0xF0, 0xC6, 0xF1, 0x3F, 0x3E, 0xF5, 0x0F, 0x8A, 0xFF, 0x5B, 0x3F, 0x7A, 0xC3, 0xF6,
+    0x9D, 0x6B, 0x27, 0xEE, 0xFE, 0xDB, 0xFF, 0xE9, 0x67, 0xA1, 0x7E, 0xE4, 0xF7, 0x6E, 0xD8, 0xFE,
+    0xDE, 0x3F, 0xB0, 0xEE, 0xFF, 0xD2, 0x81, 0x55, 0x0F, 0xFD, 0xB9, 0x72, 0x8F, 0x7F, 0x2B, 0xE4,
+    0xC8, 0x8D, 0xF7, 0x6E, 0x57, 0x77, 0xDE, 0xA0, 0xED, 0x14, 0x8E, 0x70, 0xDB, 0x0D, 0xDF, 0xFA,
+    0xD6, 0x0D, 0x77, 0x86, 0xDF, 0xD3, 0xA7, 0x02, 0xC7, 0x91, 0x57, 0x9E, 0xFA, 0x7F, 0x02, 0x77,
+    0x63, 0xB1, 0xFF, 0x9F, 0x69, 0xD4, 0x26, 0x6C, 0xF5, 0xAA, 0x8F, 0xB2, 0xE7, 0x7E, 0x36, 0xBF,
+    0x2C, 0x58, 0xEB, 0x5C, 0xA4, 0x63, 0x2E, 0xD2, 0x31, 0x9E, 0x8D, 0x1F, 0xE8, 0xB1, 0x81, 0xD7,
+    0x3F, 0xDD, 0xFC, 0x53, 0x48, 0x44, 0x1C, 0xC9, 0xA5, 0xD3, 0x9E, 0x84, 0xA0, 0x25, 0x81, 0xAE,
+    0x9F, 0xA4, 0xAF, 0x39, 0xED, 0xAE, 0x5E, 0xE8, 0x86, 0x24, 0x94, 0x9A, 0x24, 0x14, 0xBB, 0x12,
+    0xC1, 0x60, 0x17, 0xB6, 0x20, 0x83, 0xE3, 0x2B, 0x81, 0xF2, 0x00, 0xDA, 0x7C, 0x4F, 0xF5, 0xB9,
+    0x51, 0x0A, 0xBD, 0x00, 0x39, 0x5F, 0xDA, 0x50, 0xA4, 0x09, 0x17, 0x27, 0x4A, 0xDD, 0xF4, 0x3C,
+    0xA3, 0x6A, 0x07, 0x84, 0x5B, 0xBE, 0xE2, 0x2C, 0x45, 0x96, 0x88, 0x48, 0x91, 0x8F, 0xC7, 0x9B,
+    0xA6, 0x18, 0x50, 0x96, 0xDD, 0x00, 0x4C, 0xD4, 0x1E, 0x98, 0x03, 0xE6, 0x22, 0x7F, 0xCC, 0xBC,
+    0x37, 0x5B, 0xD9, 0x7E, 0x59, 0xCF, 0x97, 0xAC, 0x75, 0x4C, 0xAF, 0xB7, 0x1D, 0x22, 0x4D, 0xB3,
+    0xE9, 0x1D, 0xA3, 0xDE, 0x00, 0xF0, 0x69, 0x77, 0x62, 0x1B, 0x56, 0xAA, 0x61, 0xFA, 0xA9, 0x2F,
+    0x02, 0xAF, 0xBA, 0xD9, 0x22, 0x5E, 0xA8, 0x9F, 0x42, 0x2E, 0xE2, 0x38, 0x08, 0xB2, 0xF1, 0x83,
+    0x0E, 0x48, 0x7B, 0xD3, 0xE4, 0xB5, 0xC1, 0xA8, 0x0F, 0x26, 0x07, 0xC1, 0xA5, 0xE7, 0x61, 0x42,
+    0x28, 0x52, 0x31, 0x21, 0x7C, 0xFB, 0x74, 0x4B, 0x49, 0xE8, 0x58, 0xF4, 0x41, 0xD6, 0x07, 0x39,
+    0x67, 0x08, 0x7B, 0xC1, 0x27, 0x74, 0xE4, 0xBD, 0x4D, 0x22, 0x53, 0x9E, 0xD0, 0xB1, 0x7B, 0xAF,
+    0x27, 0xFC, 0xE5, 0x83, 0xAD, 0x54, 0x84, 0x22, 0xB5, 0x14, 0x84, 0xB2, 0x5C, 0x19, 0xF1, 0xD2,
+    0x9E, 0xFD, 0x6F, 0xA0, 0x05, 0x5D, 0xA1, 0x6B, 0x30, 0x16, 0x53, 0xFC, 0xD6, 0x57, 0xD9, 0x78,
+    0x3C, 0x1B, 0x5B, 0x44, 0x44, 0xA4, 0xD1, 0x22, 0x22, 0xD2, 0x19, 0x8B, 0x29, 0x74, 0x9B, 0x42,
+    0x86, 0xF6, 0x0D, 0xB4, 0x84, 0xFB, 0x15, 0xBA, 0xC6, 0xDC, 0x6F, 0x31, 0x05, 0xD3, 0x14, 0x32,
+    0x82, 0xA6, 0x81, 0x96, 0x78, 0xAF, 0x42, 0xBF, 0xFF, 0x83, 0x85, 0xB1, 0x18, 0x91, 0x2A, 0x85,
+    0x5C, 0xCE, 0xF1, 0x19, 0xC6, 0xCA, 0xF3, 0x1F, 0x3B, 0x56, 0x26, 0x07, 0xA7, 0xE9, 0xC7, 0x9F,
+    0x38, 0xDA, 0xE3, 0xBB, 0xD5, 0x80, 0xCC, 0x88, 0x8A, 0x03, 0x2B, 0x4D, 0x0A, 0x65, 0x8A, 0x6A,
+    0x7A, 0x2B, 0x4B, 0xE4, 0x52, 0x62, 0xDB, 0x5B, 0x60, 0x3A, 0x52, 0xD5, 0x90, 0xEA, 0x9A, 0x5C,
+    0x1C, 0xB9, 0x38, 0xB2, 0x1F, 0xD6, 0xA4, 0xC1, 0xCA, 0x4A, 0xB3, 0xF5, 0x21, 0x2B, 0x4D, 0xD0,
+    0x0C, 0x56, 0x9A, 0xAD, 0x3E, 0xEE, 0x2B, 0x10, 0xE3, 0x15, 0x86, 0x76, 0x90, 0xF7, 0x75, 0x05,
+    0x65, 0x4A, 0x5F, 0x2B, 0x5D, 0x0A, 0xF3, 0xBD, 0x8A, 0x78, 0x92, 0xA2, 0xFF, 0x76, 0xAF, 0xA2,
+    0x9C, 0xA4, 0xC4, 0xF7, 0xEE, 0x55, 0xBA, 0x9E, 0xA4, 0x94, 0xE1, 0x5E, 0x65, 0xEC, 0x24, 0xD5,
+    0x75, 0xB8, 0x57, 0x4D, 0x98, 0xA4, 0xC6, 0x86, 0x7B, 0xFB, 0x9E, 0x49, 0x3A, 0x21, 0xDC, 0x7B,
+    0xAB, 0x60, 0x92, 0x7B, 0xC2, 0xBD, 0x0E, 0x26, 0x79, 0x41, 0xB8, 0xE7, 0x61, 0xC2, 0x06, 0x9B,
+    0xE8, 0x3A, 0x81, 0xF8, 0x27, 0x15, 0xCC, 0xDB, 0x03, 0x5D, 0x04, 0xE5, 0xB0, 0x7C, 0x71, 0x9A,
+    0x80, 0x71, 0x2D, 0xAA, 0x89, 0x1C, 0x09, 0x19, 0xBA, 0x0E, 0x3C, 0x65, 0xBF, 0x28, 0xB0, 0x54,
+    0x4D, 0x6F, 0xAD, 0x4F, 0xC2, 0x0A, 0xDA, 0x12, 0xA2, 0xB7, 0x6C, 0xAF, 0xC1, 0x08, 0x96, 0x1F,
+    0x5E, 0xE4, 0x14, 0x0F, 0x29, 0x44, 0xCB, 0x41, 0x93, 0x96, 0x82, 0xB9, 0xDF, 0xA2, 0xF7, 0x2B,
+    0x68, 0x1A, 0x48, 0xBF, 0xC8, 0x83, 0xF3, 0xE3, 0x71, 0x23, 0x3D, 0x59, 0x16, 0x4B, 0x39, 0xF4,
+    0x87, 0xC8, 0x0D, 0x38, 0x85, 0x47, 0x59, 0x21, 0x54, 0xC8, 0x07, 0xD8, 0xCD, 0xC1, 0x5A, 0xE1,
+    0xF5, 0x25, 0x5A, 0x16, 0x2C, 0xC3, 0x26, 0xB1, 0x66, 0xAF, 0x66, 0x3A, 0x45, 0xFF, 0xED, 0x2F,
+    0xC7, 0x5B, 0x73, 0x91, 0xCB, 0x97, 0x76, 0x76, 0xCA, 0x9E, 0xFC, 0x67, 0x83, 0x10, 0x56, 0x29,
+    0x37, 0x93, 0x8E, 0xF9, 0x60, 0x17, 0xEA, 0xD5, 0x9B, 0xA1, 0x83, 0xD3, 0x6F, 0xFF, 0x14, 0x91,
+    0x96, 0x07, 0x7F, 0xB9, 0x39, 0x3C, 0xDB, 0x20, 0x7C, 0x55, 0xAA, 0xF0, 0x2D, 0x69, 0xC3, 0x8E,
+    0x2E, 0xF4, 0x4C, 0xC3, 0x9A, 0x2C, 0xAC, 0xC8, 0x42, 0xF7, 0xC9, 0xC7, 0x20, 0x80, 0x5F, 0x75,
+    0xFC, 0x7B, 0x5D, 0x5F, 0x83, 0xB3, 0x0A, 0xB5, 0x49, 0x6E, 0x55, 0x83, 0xB1, 0xBC, 0xD4, 0xEB,
+    0x90, 0x6E, 0xDE, 0x79, 0x6E, 0x2E, 0xEF, 0x5E, 0xDA, 0xF9, 0xF1, 0xA7, 0x40, 0xF1, 0xC1, 0xC9,
+    0x8B, 0xCC, 0xC5, 0xC9, 0x89, 0x53, 0x5B, 0x90, 0xAF, 0x16, 0x90, 0x05, 0x22, 0xF5, 0x5C, 0xDA,
+    0xA4, 0x2F, 0x70, 0x0B, 0x39, 0xE8, 0x06, 0x3B, 0x13, 0x1F, 0xF4, 0x2B, 0x52, 0x02, 0xD9, 0x4E,
+    0xA4, 0xDB, 0x3A, 0xF1, 0x52, 0x09, 0x2D, 0xEC, 0x42, 0x5E, 0x11, 0x2D, 0x61, 0x5E, 0x13, 0xB6,
+    0x50, 0x42, 0x0A, 0xE9, 0x29, 0x3A, 0x91, 0x66, 0x26, 0x8E, 0x4D, 0x36, 0xCA, 0xF2, 0x36, 0xF8,
+    0x30, 0x5C, 0x73, 0xE3, 0xC8, 0xBB, 0x1F, 0xBC, 0xF5, 0xB3, 0x6F, 0x02, 0x3C, 0xFA, 0x5B, 0x20,
+    0x6C, 0x6C, 0x50, 0x52, 0x0E, 0x72, 0xF6, 0xA3, 0x94, 0x9F, 0x66, 0x57, 0xED, 0xDC, 0xCF, 0x0A,
+    0x76, 0x76, 0x4E, 0x01, 0x22, 0x0D, 0x70, 0x69, 0xA7, 0x01, 0xBC, 0xFA, 0xD0, 0x59, 0x79, 0x25,
+    0xCB, 0x42, 0x79, 0x25, 0xD2, 0x28, 0xAF, 0x9A, 0xF5, 0x4E, 0x79, 0xD5, 0xB0, 0x15, 0x78, 0xD5,
+    0x90, 0x05, 0xB5, 0x6A, 0xC8, 0x74, 0xA5, 0x1A, 0xB6, 0x22, 0xA7, 0x9A, 0xA0, 0x93, 0x42, 0x89,
+    0x34, 0x82, 0x3A, 0xC0, 0xC4, 0x3D, 0x4A, 0x50, 0x10, 0x78, 0x62, 0x88, 0x1C, 0x13, 0x48, 0x50,
+    0x9E, 0x9E, 0xF4, 0x0E, 0x8F, 0xDF, 0xDE, 0x39, 0xFB, 0xBC, 0x4D, 0x44, 0x44, 0xEA, 0xB3, 0x3B,
+    0xA7, 0xDF, 0x3E, 0xFD, 0xAE, 0x27, 0x26, 0x7A, 0xD3, 0x31, 0xC1, 0x9C, 0x46, 0x79, 0xB2, 0x92,
+    0xD0, 0xA9, 0x7F, 0xE7, 0x89, 0x6D, 0xF2, 0x9A, 0x63, 0x26, 0x8B, 0xE4, 0x20, 0x85, 0x2B, 0x7D,
+    0xEB, 0x39, 0x64, 0x80, 0x55, 0x5F, 0xD5, 0xB7, 0xEA, 0xA1, 0x6F, 0x2D, 0x42, 0x4F, 0x76, 0x55,
+    0xDF, 0xCA, 0x3F, 0xE9, 0x80, 0x07, 0x20, 0x2E, 0x56, 0xAB, 0x24, 0x6F, 0x3D, 0x80, 0x6B, 0x15,
+    0xFC, 0xB4, 0x24, 0x89, 0x5C, 0x58, 0x95, 0xB4, 0x91, 0x4B, 0x28, 0xC3, 0x2A, 0x72, 0x2D, 0x73,
+    0x21, 0x12, 0x4F, 0x69, 0x5C, 0xE4, 0xB6, 0xFA, 0xD6, 0x31, 0xAE, 0x64, 0x2B, 0x72, 0x81, 0x2F,
+    0x31, 0x4E, 0x6D, 0xF6, 0x4A, 0xB3, 0xAD, 0x5E, 0x95, 0x1C, 0xAE, 0x06, 0xD7, 0x7A, 0xC1, 0x3F,
+    0x2E, 0x31, 0x17, 0x9C, 0x5E, 0x96, 0xCC, 0x2E, 0x38, 0xB3, 0x55, 0x06, 0xEF, 0x5D, 0x70, 0xA3,
+    0xAC, 0x8C, 0x9E, 0xB9, 0xF0, 0xB2, 0xCF, 0xCA, 0x54, 0x5F, 0x78, 0xD5, 0x65, 0x65, 0xA3, 0x2F,
+    0xFC, 0x7F, 0x64, 0x73, 0xA7, 0x2F, 0xB4, 0x64, 0x73, 0x74, 0x1D, 0x6C, 0x1F, 0x26, 0x2A, 0x4A,
+    0xCC, 0x4F, 0xAE, 0x5E, 0x20, 0x72, 0xDD, 0x95, 0xE9, 0xFA, 0xA3, 0x2B, 0xD3, 0xCB, 0x6B, 0x57,
+    0xA6, 0xF7, 0xAB, 0x80, 0xE8, 0xFD, 0x9D, 0x0C, 0xA8, 0xDE, 0xB5, 0x93, 0x57, 0x56, 0xA6, 0x3F,
+    0x4A, 0xF0, 0x63, 0xC7, 0xA4, 0x24, 0x7C, 0xED, 0xD3, 0x05, 0x73, 0x91, 0xD7, 0x44, 0x3A, 0xE2,
+    0xBE, 0xB8, 0x43, 0x00, 0xA4, 0xA8, 0x86, 0xC0, 0xB7, 0x84, 0x15, 0xD1, 0x5E, 0x8D, 0x29, 0x48,
+    0x8C, 0x63, 0x80, 0x5C, 0x74, 0x68, 0x5F, 0xA2, 0x3D, 0xE6, 0xE9, 0x06, 0xE3, 0xC8, 0xC2, 0x8A,
+    0xDC, 0xAA, 0xC6, 0x14, 0x6A, 0x49, 0xE8, 0x72, 0x4C, 0x47, 0x42, 0x49, 0xE6, 0xE9, 0x68, 0x83,
+    0xF7, 0x6A, 0x5D, 0x6B, 0x6F, 0xEE, 0x77, 0xB1, 0x8D, 0xDC, 0x24, 0xA1, 0xC4, 0x3C, 0xED, 0x33,
+    0x5D, 0x93, 0x1B, 0x5B, 0xC6, 0x30, 0x9D, 0xA8, 0xA6, 0x83, 0x4B, 0xB5, 0x7E, 0xAF, 0x42, 0x89,
+    0x0D, 0x05, 0x74, 0x87, 0x69, 0x20, 0xAC, 0x7B, 0xB7, 0x34, 0x43, 0x2F, 0x3D, 0x0C, 0xFF, 0xC2,
+    0x93, 0x12, 0xBE, 0x5A, 0xD1, 0x10, 0x1B, 0xAB, 0x6B, 0xCA, 0x0C, 0xE3, 0x02, 0xDF, 0x91, 0x60,
+    0x9E, 0xF6, 0x94, 0xA4, 0xBA, 0xD2, 0x8D, 0xF2, 0xA6, 0x48, 0x7C, 0xE4, 0x12, 0x2E, 0xBB, 0x94,
+    0x34, 0xFA, 0xD3, 0x13, 0x9E, 0x72, 0x94, 0x98, 0x42, 0xBD, 0x5B, 0x8F, 0x26, 0x68, 0xE1, 0xDF,
+    0xD4, 0x84, 0x2D, 0x02, 0x91, 0x1B, 0x10, 0x02, 0xFD, 0x7A, 0xEF, 0xB0, 0x82, 0x44, 0xC4, 0x33,
+    0x17, 0xA9, 0xD4, 0x0F, 0x2E, 0x8E, 0x07, 0xA8, 0x55, 0x6C, 0x87, 0xE5, 0xD8, 0x4A, 0x64, 0x9B,
+    0x50, 0xA4, 0x21, 0x7E, 0xF6, 0xA4, 0x67, 0x4A, 0x58, 0xAB, 0x06, 0xE3, 0xC2, 0x8A, 0x84, 0xD8,
+    0x52, 0x32, 0x45, 0x7B, 0xD5, 0x10, 0x17, 0x61, 0xFD, 0x8D, 0x8E, 0x58, 0xC4, 0x31, 0x93, 0x73,
+    0x7D, 0xDD, 0x4E, 0x7A, 0xDD, 0xB7, 0x3A, 0xFD, 0xF6, 0x29, 0xE6, 0xD2, 0x71, 0xF3, 0xD9, 0x1D,
+    0x88, 0x87, 0x31, 0xA2, 0xFC, 0x90, 0x46, 0x2C, 0x52, 0x84, 0x22, 0x9D, 0xF2, 0x24, 0xC5, 0x04,
+    0xED, 0x63, 0x28, 0x43, 0x47, 0xAE, 0x1A, 0x66, 0x76, 0x26, 0x52, 0xC4, 0xB2, 0xB4, 0x07, 0x00,
+    0xE3, 0x40, 0x2E, 0xEA, 0x8A, 0x48, 0xC4, 0x37, 0x98, 0x8B, 0x6B, 0x4D, 0x4A, 0x54, 0x83, 0xB1,
+    0xA1, 0x07, 0x5D, 0x69, 0x0F, 0x34, 0xB4, 0x40, 0xCA, 0x14, 0x30, 0x36, 0xE9, 0x45, 0x62, 0x91,
+    0xAE, 0x67, 0x72, 0xC8, 0xC6, 0x8B, 0xF1, 0x78, 0xF5, 0xA2, 0x8A, 0x2A, 0xA0, 0x51, 0xFD, 0x3F,
+    0x72, 0xC0, 0xD8, 0xA8, 0x06, 0x5D, 0xB1, 0x04, 0x1A, 0xE2, 0x86, 0x87, 0x53, 0x94, 0xC8, 0xC2,
+    0x58, 0x22, 0x59, 0x02, 0x28, 0xCB, 0xA3, 0xA8, 0xF9, 0x7F, 0xEF, 0x99, 0xC9, 0x9B, 0x2E, 0xBC,
+    0xF8, 0x60, 0x42, 0x0E, 0xA5, 0x6A, 0x08, 0x7C, 0xE4, 0x88, 0x5C, 0x0E, 0x89, 0x88, 0xF8, 0xB9,
+    0x88, 0xBC, 0xE2, 0x4D, 0x31, 0x3C, 0xEA, 0x57, 0x23, 0xB4, 0x04, 0x3E, 0x68, 0x79, 0xD0, 0x05,
+    0x22, 0x27, 0x51, 0xB2, 0x02, 0x15, 0x4E, 0x19, 0x96, 0x2A, 0x2B, 0x01, 0x82, 0x77, 0x0A, 0xD0,
+    0x6F, 0xBA, 0x61, 0xA5, 0xAE, 0x79, 0xC6, 0x43, 0x7C, 0xA2, 0x81, 0x9C, 0x16, 0x72, 0xE9, 0x60,
+    0x2E, 0x4B, 0xB8, 0xB8, 0x3B, 0x43, 0xF9, 0x49, 0x6C, 0xB5, 0x9F, 0x18, 0x17, 0x56, 0x93, 0xC8,
+    0x45, 0x6E, 0xA2, 0x6B, 0x53, 0x4C, 0x02, 0x9F, 0x30, 0x51, 0x4D, 0xCE, 0x84, 0x6E, 0xCA, 0x84,
+    0x69, 0xC7, 0x84, 0x8C, 0xF5, 0x53, 0x83, 0x3A, 0xF9, 0xB2, 0xEB, 0x9D, 0x1E, 0xA4, 0x19, 0xC4,
+    0xA1, 0xC3, 0x14, 0x2D, 0x61, 0xCF, 0xC3, 0x57, 0x34, 0x6D, 0x47, 0x99, 0xC6, 0x64, 0xE6, 0x9E,
+    0x3A, 0xD6, 0x55, 0x69, 0x5C, 0x63, 0xEE, 0xAD, 0xD2, 0xE0, 0x5D, 0x6F, 0xEC, 0x34, 0xED, 0xD7,
+    0x2C, 0x57, 0x04, 0x1D, 0xA4, 0x90, 0x57, 0xE8, 0x8A, 0xE8, 0x1D, 0x48, 0xE1, 0xA2, 0x47, 0x57,
+    0xC4, 0xA6, 0x20, 0xED, 0x07, 0x4F, 0x45, 0xAA, 0x2B, 0xD2, 0xDE, 0xFD, 0x9E, 0xC8, 0xE0, 0x48,
+    0x49, 0xA4, 0xD0, 0xE7, 0x7F, 0xF8, 0xFE, 0xC5, 0x92, 0x94, 0xA9, 0xB9, 0xA7, 0xD6, 0x55, 0xE4,
+    0x9A, 0x9C, 0x94, 0xD6, 0x9C, 0x68, 0x74, 0x95, 0xD0, 0x18, 0x97, 0x6A, 0x6F, 0x6C, 0xA9, 0xAB,
+    0x29, 0x8D, 0xAE, 0x53, 0xE3, 0x8C, 0xCD, 0x75, 0xD5, 0xD2, 0xA8, 0x26, 0x4D, 0x30, 0xD6, 0xB8,
+    0x47, 0x09, 0x4E, 0x91, 0x10, 0x2C, 0x88, 0x1C, 0x97, 0x5D, 0xE0, 0x29, 0x1B, 0x4A, 0xD2, 0xE3,
+    0x24, 0xC4, 0xA1, 0x8B, 0x9C, 0x29, 0xDA, 0x40, 0x44, 0x84, 0xB9, 0x88, 0x54, 0x09, 0x6D, 0x5B,
+    0x46, 0xAE, 0xCC, 0xE2, 0xC0, 0x67, 0xE6, 0x99, 0xBA, 0x8C, 0xEF, 0xA9, 0x27, 0x89, 0x71, 0xAD,
+    0xF9, 0xF1, 0x5E, 0x95, 0x05, 0xEF, 0xBE, 0xEB, 0x4D, 0x91, 0x46, 0x22, 0xD2, 0x69, 0x11, 0x11,
+    0x66, 0x3B, 0x3B, 0xA7, 0x8B, 0xC8, 0x61, 0x1C, 0x25, 0xC6, 0x61, 0x5C, 0xE4, 0xA0, 0x0D, 0x2B,
+    0x88, 0x7F, 0x54, 0x81, 0xBA, 0x5C, 0xC3, 0xBA, 0x2C, 0x2D, 0x91, 0x48, 0x47, 0xD8, 0x94, 0x49,
+    0xA1, 0x7D, 0x12, 0x78, 0xD5, 0x44, 0x2E, 0xEB, 0x89, 0x6E, 0x4E, 0xA9, 0x9A, 0xD8, 0x26, 0x64,
+    0x91, 0x8B, 0x9C, 0xD9, 0xF3, 0x81, 0x0F, 0x7C, 0x4B, 0x49, 0xBA, 0x4B, 0x82, 0x71, 0x87, 0x77,
+    0x76, 0x76, 0x6C, 0x2E, 0xB2, 0x64, 0x6B, 0xFC, 0x43, 0xDF, 0x33, 0xB5, 0x93, 0xC0, 0x43, 0x19,
+    0x03, 0xBB, 0x0D, 0xC4, 0xD2, 0x12, 0x2C, 0x65, 0x81, 0x79, 0xA6, 0xEE, 0x28, 0xCD, 0x53, 0x8D,
+    0xAE, 0x32, 0x5D, 0xC7, 0xB4, 0xA1, 0x6B, 0x75, 0x6D, 0xEE, 0xAD, 0x4C, 0x91, 0x24, 0x64, 0x4C,
+    0x52, 0x44, 0x44, 0x8A, 0x46, 0x8B, 0xC8, 0x52, 0x57, 0xE6, 0xED, 0x9D, 0x17, 0x1A, 0x63, 0x8D,
+    0x23, 0xB6, 0x29, 0xA6, 0xA0, 0xA5, 0x21, 0x2E, 0x8C, 0xD3, 0x15, 0xB1, 0xED, 0x30, 0x96, 0x24,
+    0x72, 0xA4, 0x90, 0xEF, 0x82, 0x88, 0xC8, 0xB2, 0x6F, 0x20, 0xB1, 0xE6, 0xD9, 0x87, 0xCE, 0xB5,
+    0x33, 0x9B, 0x32, 0xD5, 0x75, 0x4E, 0x13, 0x78, 0x53, 0x4C, 0x75, 0x65, 0x8A, 0x8C, 0xD6, 0xD8,
+    0x29, 0x6D, 0xE0, 0xD3, 0xC0, 0xEB, 0x3A, 0x74, 0x8D, 0x29, 0x4C, 0x61, 0x9E, 0xA9, 0xA6, 0x64,
+    0xE4, 0xE6, 0x6E, 0x4F, 0xCB, 0x24, 0x35, 0x4E, 0xD7, 0x34, 0x8F, 0x1E, 0xDE, 0xD9, 0xD9, 0xB9,
+    0xDB, 0xE7, 0x22, 0xCB, 0xC8, 0xE5, 0xE3, 0x1F, 0xFA, 0x84, 0x29, 0x31, 0x25, 0x53, 0xD5, 0x04,
+    0x9E, 0x69, 0x6C, 0x23, 0xC7, 0x6E, 0x43, 0x22, 0x22, 0x0B, 0xE6, 0x22, 0xB2, 0x08, 0xBC, 0x79,
+    0xBA, 0xEE, 0x22, 0x57, 0x46, 0x45, 0x93, 0xE8, 0xFA, 0x78, 0xE0, 0xCB, 0xD8, 0x9E, 0x09, 0x5F,
+    0xF1, 0x65, 0x50, 0x9B, 0x1F, 0xEF, 0x55, 0x51, 0x91, 0x24, 0x31, 0xC7, 0x49, 0x83, 0x2A, 0xAC,
+    0x69, 0x93, 0xBA, 0xB7, 0x10, 0x7A, 0x98, 0x2F, 0x31, 0x22, 0x55, 0xB2, 0x1D, 0x35, 0x5F, 0xEB,
+    0xD9, 0xF3, 0x72, 0x38, 0xBA, 0x9E, 0x0D, 0xBC, 0xA5, 0x0E, 0x64, 0x49, 0x20, 0x4B, 0x18, 0x9F,
+    0xAC, 0x07, 0x2E, 0x77, 0x77, 0x18, 0x77, 0xE9, 0x10, 0x76, 0x10, 0x35, 0x6A, 0x2E, 0xB5, 0x91,
+    0x25, 0xF9, 0x9F, 0x5D, 0xE1, 0xE5, 0xF2, 0xB7, 0x4F, 0x9F, 0x33, 0x22, 0x9D, 0xDA, 0xD9, 0xF9,
+    0x97, 0x00, 0x87, 0x58, 0x0B, 0xEA, 0xB8, 0x4A, 0xE2, 0x6D, 0x2D, 0x76, 0x5D, 0xAA, 0x48, 0xE4,
+    0xC4, 0xF9, 0x5B, 0xFC, 0xCA, 0x37, 0x66, 0xE8, 0xB8, 0xA5, 0xD6, 0xE2, 0x90, 0x45, 0xAF, 0xFE,
+    0xEF, 0x20, 0x01, 0xE3, 0x88, 0xEA, 0x93, 0x52, 0xCF, 0xA5, 0xDA, 0xB2, 0x24, 0x3D, 0xB7, 0x2B,
+    0xB2, 0x88, 0x45, 0x0A, 0x38, 0x32, 0x65, 0xC2, 0x64, 0xCA, 0x94, 0xE9, 0x27, 0x9F, 0x26, 0x19,
+    0x53, 0xCA, 0x9C, 0x29, 0x5D, 0x6C, 0xA7, 0x41, 0x63, 0xEA, 0x69, 0xE4, 0xF5, 0xB0, 0x7E, 0x71,
+    0x09, 0x6B, 0x67, 0x57, 0x44, 0xFC, 0xBA, 0xA7, 0xC1, 0x2E, 0xD9, 0x93, 0xE1, 0x0F, 0x5F, 0xAC,
+    0x17, 0x31, 0x8F, 0x96, 0xCA, 0x87, 0xAF, 0xB9, 0x98, 0xB4, 0x54, 0x5E, 0x5F, 0x70, 0x31, 0x59,
+    0xA9, 0xBC, 0xBE, 0xEC, 0x62, 0x92, 0x52, 0xF9, 0x60, 0x75, 0xD1, 0xBF, 0x9A, 0x2A, 0x1F, 0xEE,
+    0xFB, 0x98, 0x2E, 0xFE, 0xB9, 0x9F, 0xF7, 0xD3, 0xC9, 0x5C, 0xEA, 0xDE, 0xDC, 0x71, 0xDD, 0x24,
+    0xFA, 0x8B, 0xCF, 0x8C, 0xC6, 0xCC, 0x45, 0x44, 0xFA, 0xD3, 0xCE, 0xCE, 0xCE, 0xFC, 0x63, 0xD0,
+    0x98, 0xFC, 0x16, 0x34, 0xE6, 0x0A, 0x71, 0x79, 0xEE, 0xA1, 0x01, 0x71, 0xC9, 0x01, 0xE2, 0x72,
+    0x26, 0xD2, 0xCD, 0x44, 0xBA, 0x69, 0x2F, 0xC1, 0x75, 0xD9, 0xC7, 0x20, 0x2E, 0xCF, 0x80, 0x5A,
+    0x94, 0x10, 0x2D, 0x32, 0x30, 0x3D, 0x65, 0x8F, 0x2D, 0x79, 0xEF, 0x67, 0x2B, 0x72, 0x94, 0x84,
+    0x15, 0x1D, 0xBA, 0xA6, 0x21, 0xF0, 0xCA, 0xA3, 0x1A, 0xED, 0x57, 0x7E, 0x0B, 0x42, 0x07, 0x59,
+    0xE4, 0x20, 0x37, 0x05, 0xC4, 0x31, 0x60, 0x4E, 0x02, 0x66, 0x09, 0x84, 0x0B, 0x06, 0x98, 0x79,
+    0xD0, 0xC2, 0x73, 0xF0, 0x27, 0x25, 0x6A, 0x99, 0xA2, 0x9B, 0x1C, 0xED, 0x62, 0x22, 0x67, 0x0A,
+    0x53, 0x44, 0xCE, 0x10, 0xBA, 0x04, 0x5D, 0x67, 0xBD, 0x03, 0xD3, 0xA6, 0xEC, 0x1D, 0xD8, 0x4D,
+    0x1A, 0xC8, 0x3C, 0xE4, 0x35, 0xC4, 0x15, 0xCA, 0x6E, 0x82, 0xF6, 0x1D, 0xA8, 0x26, 0x05, 0x26,
+    0x31, 0x70, 0x6B, 0x58, 0x70, 0x05, 0x80, 0xFA, 0x3B, 0x2B, 0xCB, 0xD1, 0x35, 0x4B, 0x72, 0x6F,
+    0x85, 0x79, 0xC5, 0xA3, 0xAB, 0x16, 0xFC, 0x15, 0x28, 0xC3, 0x17, 0x2D, 0xE7, 0xD5, 0x3E, 0x4A,
+    0xEC, 0xD0, 0xA7, 0x06, 0x57, 0x8A, 0xB2, 0x3D, 0x73, 0x00, 0x91, 0x1F, 0xB8, 0xAB, 0x7C, 0x58,
+    0x23, 0xAC, 0x1A, 0xC8, 0x0E, 0x5B, 0x0E, 0x1B, 0xD7, 0x73, 0x7A, 0x65, 0x0E, 0x41, 0x33, 0x41,
+    0xD7, 0x2D, 0x84, 0x55, 0xDB, 0x3B, 0xC8, 0x89, 0xEF, 0xF6, 0x94, 0xA6, 0x80, 0xAD, 0xB0, 0xD2,
+    0x75, 0x06, 0xAA, 0x31, 0x2E, 0xEE, 0xF9, 0xD2, 0x98, 0xAE, 0x37, 0xE9, 0x65, 0xBA, 0x32, 0x0E,
+    0x4A, 0xCA, 0x98, 0xC4, 0xA2, 0xBD, 0x6A, 0xDA, 0x3E, 0x21, 0xFD, 0xAB, 0x8A, 0xB3, 0xA8, 0x8E,
+    0xF0, 0x2D, 0x10, 0x9B, 0x38, 0x4C, 0x0B, 0x22, 0x5D, 0x8F, 0xCE, 0x9B, 0x49, 0xD1, 0x5B, 0x75,
+    0x95, 0xE5, 0x8A, 0x62, 0xEE, 0x00, 0x8E, 0xBA, 0x5A, 0x9C, 0xD0, 0x3B, 0x7E, 0x5A, 0x2D, 0x06,
+    0x06, 0xF2, 0x95, 0x1F, 0x2D, 0xB1, 0x7D, 0x97, 0x7E, 0x0E, 0x9E, 0x8B, 0x64, 0xA1, 0x1A, 0x74,
+    0x3D, 0xFF, 0xC1, 0x42, 0xD7, 0x24, 0x61, 0x4D, 0x17, 0x39, 0xBA, 0x1C, 0xD5, 0x18, 0x1B, 0x56,
+    0x2D, 0xDA, 0xE7, 0x24, 0x61, 0x45, 0xE4, 0x26, 0xB4, 0xB1, 0x25, 0xA1, 0x0D, 0xDD, 0x14, 0xCA,
+    0xC0, 0xE7, 0xAA, 0x21, 0xF0, 0xBA, 0x6A, 0x74, 0x8D, 0x71, 0xE6, 0x47, 0xCE, 0x38, 0x32, 0xE2,
+    0x8C, 0xD8, 0x06, 0x9E, 0xB4, 0x21, 0xB7, 0x49, 0xC1, 0xDC, 0x91, 0x4B, 0x0B, 0x4B, 0x48, 0xA4,
+    0xF7, 0x60, 0xA4, 0x06, 0xE7, 0x2F, 0x2B, 0x4F, 0x1A, 0x57, 0xE5, 0xD6, 0xF4, 0x99, 0x55, 0xDD,
+    0xE0, 0xCD, 0xA5, 0x6F, 0xA7, 0xA8, 0x5F, 0xEA, 0xDC, 0x3B, 0x9B, 0xE8, 0x80, 0x75, 0xB9, 0xD8,
+    0xDB, 0x2C, 0x50, 0x32, 0x7F, 0xCB, 0x93, 0xDB, 0x53, 0xB1, 0x33, 0x15, 0x6C, 0xA9, 0x16, 0x02,
+    0x9F, 0x00, 0xF1, 0x33, 0x9E, 0x7E, 0x40, 0x12, 0xED, 0xD5, 0x0C, 0xDE, 0x14, 0xAF, 0xB9, 0xF4,
+    0x0C, 0xD4, 0xC2, 0x3C, 0xD5, 0x42, 0xD0, 0x18, 0x07, 0x33, 0x66, 0x76, 0x33, 0x76, 0x6A, 0x39,
+    0x7B, 0xB3, 0x21, 0x14, 0xE9, 0x20, 0x94, 0x83, 0x5E, 0xC9, 0xE1, 0x83, 0x6E, 0xD3, 0x81, 0x9A,
+    0x57, 0x84, 0x22, 0x45, 0x74, 0xF9, 0x72, 0x1B, 0xD6, 0x1B, 0xC9, 0xDD, 0x1E, 0xED, 0x5B, 0x98,
+    0x4E, 0xC1, 0x3C, 0x74, 0x35, 0x24, 0x25, 0x83, 0xF8, 0x7E, 0x47, 0xF4, 0x72, 0x83, 0xAE, 0x93,
+    0x3F, 0x7D, 0xC3, 0x07, 0x22, 0x9E, 0x58, 0x7A, 0xCD, 0x26, 0xEB, 0xF6, 0xAA, 0x05, 0x71, 0x17,
+    0x07, 0xB0, 0xF0, 0x39, 0x80, 0xD1, 0xFA, 0x02, 0x60, 0xE3, 0x4C, 0xDF, 0xEB, 0x07, 0xEC, 0xF2,
+    0xB1, 0xC1, 0xDB, 0x5B, 0x1F, 0x5C, 0xDD, 0x99, 0x93, 0x05, 0xB3, 0x06, 0x44, 0x4E, 0x88, 0xA0,
+    0xDB, 0x88, 0x3A, 0x71, 0x51, 0x05, 0x84, 0xB5, 0x29, 0x58, 0xD5, 0x0D, 0xAA, 0xC9, 0x7B, 0xBF,
+    0x5C, 0x7D, 0x77, 0x29, 0x87, 0x20, 0xBD, 0x26, 0xC8, 0xE0, 0xB6, 0x3E, 0x98, 0xF6, 0x5D, 0x7D,
+    0xDA, 0xF7, 0xFA, 0x29, 0xB4, 0xB1, 0x65, 0x8A, 0x6A, 0x8C, 0x63, 0x8A, 0xF6, 0x51, 0xCD, 0x94,
+    0xA8, 0xD6, 0x8B, 0x40, 0x8A, 0x99, 0x1B, 0x78, 0x66, 0x12, 0xB9, 0x5B, 0x5A, 0x60, 0xB3, 0x6F,
+    0xB9, 0xC7, 0x2C, 0xA0, 0xE4, 0x22, 0xA0, 0x7F, 0x3E, 0xAF, 0x41, 0xBF, 0xF2, 0xFD, 0x53, 0xAB,
+    0x45, 0xEA, 0xFD, 0x72, 0x72, 0x54, 0xC5, 0xCA, 0xA7, 0xD4, 0x81, 0xA9, 0x0E, 0x98, 0x55, 0xEB,
+    0x4B, 0xB4, 0xF8, 0x48, 0x2A, 0xF3, 0xD7, 0xA7, 0x82, 0x7B, 0x7D, 0x6C, 0xE9, 0xF3, 0x72, 0xE0,
+    0x24, 0x33, 0x85, 0x1E, 0xFA, 0x03, 0xD9, 0x14, 0x5D, 0xAD, 0xCE, 0x19, 0xBA, 0x22, 0xCD, 0xD1,
+    0x15, 0xBB, 0x89, 0xD5, 0x35, 0x9D, 0xA9, 0xE2, 0x56, 0x37, 0xA1, 0xC8, 0x5C, 0x6A, 0xE6, 0x6D,
+    0x2C, 0x16, 0xD5, 0xEB, 0xCE, 0xA5, 0x6F, 0xE8, 0x0B, 0x97, 0x3C, 0xB0, 0xAE, 0xD5, 0x35, 0x0E,
+    0x04, 0x7A, 0xA8, 0x77, 0x2F, 0xEF, 0xC5, 0x96, 0xA4, 0x5F, 0xE6, 0x59, 0xE6, 0xD0, 0xA2, 0x7D,
+    0x87, 0xF6, 0x98, 0x57, 0x3C, 0xC6, 0x91, 0x45, 0x15, 0x3D, 0xF2, 0x9E, 0x05, 0x61, 0x95, 0x11,
+    0xB6, 0xC4, 0x74, 0xE4, 0x9E, 0x32, 0xF0, 0x5C, 0x76, 0xDA, 0xEB, 0x3A, 0x7A, 0xBD, 0x30, 0x85,
+    0x71, 0x69, 0xCE, 0x94, 0x44, 0xF9, 0x32, 0xF0, 0x64, 0x91, 0x6B, 0x4D, 0x41, 0x97, 0x06, 0x7E,
+    0x82, 0x7A, 0xDF, 0x87, 0xFB, 0x1E, 0x7D, 0xA1, 0x30, 0xAF, 0x5B, 0xC2, 0x05, 0x71, 0x07, 0xC6,
+    0x93, 0x57, 0x10, 0x17, 0xCC, 0xAE, 0xE4, 0xEA, 0xE6, 0x9D, 0x9D, 0x02, 0x66, 0x22, 0x40, 0xF5,
+    0xF8, 0x9D, 0x57, 0x67, 0x58, 0x9D, 0xE2, 0x36, 0x82, 0x1F, 0x39, 0x1A, 0xE2, 0xD8, 0xEA, 0x8A,
+    0x49, 0x8A, 0x29, 0x02, 0xDF, 0x92, 0x13, 0xED, 0x79, 0x4A, 0xB2, 0xC8, 0x05, 0x9E, 0xC6, 0x58,
+    0x53, 0x85, 0x2E, 0x63, 0xEE, 0x12, 0x4A, 0xFD, 0x0E, 0x0D, 0xCD, 0xF1, 0x34, 0x74, 0x81, 0xF7,
+    0x65, 0x46, 0xF8, 0x5A, 0xF1, 0x1B, 0x8F, 0xE9, 0x82, 0x77, 0x0A, 0xE2, 0x5A, 0x77, 0x90, 0x0C,
+    0x8D, 0xD6, 0x1B, 0x04, 0xB4, 0x48, 0xAB, 0x97, 0x27, 0x4A, 0xDD, 0x0E, 0xDE, 0x33, 0xBA, 0xA1,
+    0xA7, 0xE6, 0x1F, 0x8B, 0x3D, 0x59, 0x19, 0x04, 0xE2, 0xD5, 0xCD, 0xCC, 0x42, 0x74, 0x11, 0x98,
+    0x4B, 0x45, 0x20, 0xCD, 0xC0, 0x73, 0x18, 0x3B, 0x40, 0x45, 0x9B, 0x2B, 0x5E, 0x77, 0x7A, 0x30,
+    0xF4, 0x45, 0xE6, 0xE2, 0xE6, 0xCF, 0xBE, 0xD8, 0x6B, 0xB6, 0x4C, 0x71, 0x95, 0x6B, 0xA4, 0xB8,
+    0xB7, 0x59, 0x74, 0x90, 0x58, 0x74, 0xA3, 0x98, 0x89, 0x0B, 0xA4, 0xF7, 0x50, 0x9B, 0x1F, 0xAC,
+    0x5F, 0x3B, 0xB8, 0x61, 0xD5, 0xF1, 0x74, 0xC5, 0x5D, 0x51, 0xC1, 0xEC, 0xFE, 0x5E, 0x7B, 0xA9,
+    0x06, 0xEF, 0x02, 0xEA, 0xDD, 0x0E, 0xED, 0xEE, 0x4A, 0xA3, 0x82, 0xFC, 0x2F, 0x20, 0x5C, 0x02,
+    0x73, 0x0B, 0xE2, 0x09, 0x7C, 0x87, 0x76, 0x37, 0x11, 0x15, 0x10, 0x1E, 0xD4, 0xFA, 0x5D, 0x47,
+    0xC7, 0xDD, 0x4C, 0xBA, 0x49, 0xCF, 0x3C, 0x28, 0xCB, 0xAC, 0xC9, 0x97, 0xE5, 0xCC, 0xDE, 0x01,
+    0x1C, 0x36, 0x7B, 0xD5, 0x8B, 0x91, 0xE5, 0xBB, 0xBB, 0x77, 0x1C, 0xF3, 0xAC, 0x6F, 0x93, 0x8B,
+    0x9D, 0xC6, 0x8B, 0x27, 0x78, 0x74, 0x80, 0x24, 0xF6, 0x24, 0xBA, 0x1E, 0xC6, 0xF9, 0x10, 0xA9,
+    0xB2, 0xDF, 0xB9, 0xBA, 0x59, 0x83, 0x16, 0x08, 0x5B, 0x10, 0x0F, 0x4A, 0x6A, 0xBE, 0xA5, 0x6D,
+    0xFF, 0xB1, 0x3D, 0x02, 0xEA, 0xC0, 0xB7, 0xC9, 0x6F, 0xDB, 0xFE, 0x71, 0xAF, 0x14, 0xDD, 0xCE,
+    0x07, 0x9B, 0xF3, 0x8F, 0x7E, 0x50, 0x01, 0xFC, 0x57, 0x7F, 0xF2, 0xF0, 0xD7, 0x01, 0xD6, 0xAF,
+    0x72, 0x5E, 0xF1, 0xC9, 0xDB, 0xCC, 0x01, 0xB3, 0x02, 0x23, 0x40, 0x2C, 0x28, 0x77, 0x27, 0x04,
+    0xC5, 0xE3, 0xAB, 0x6E, 0xC8, 0x15, 0x5D, 0x37, 0xCC, 0x87, 0xAE, 0x73, 0xEB, 0xE9, 0xA1, 0x34,
+    0xC5, 0x9D, 0x1F, 0x8E, 0xEF, 0xAE, 0x15, 0xA6, 0xA7, 0x38, 0x18, 0x79, 0x03, 0x71, 0x04, 0xE0,
+    0xEB, 0x2B, 0x3D, 0x8C, 0x27, 0x87, 0x9B, 0x7A, 0xF5, 0x3D, 0x71, 0x0F, 0x5C, 0x26, 0xF6, 0xFD,
+    0x7C, 0x12, 0xB4, 0xC0, 0x8D, 0xC0, 0xD7, 0xAE, 0x4E, 0xFD, 0xE3, 0xB6, 0xEF, 0xF6, 0x79, 0xB1,
+    0xBA, 0x57, 0xC9, 0xE5, 0xDB, 0x51, 0xD7, 0x57, 0x8C, 0x5B, 0xEF, 0xBB, 0xC8, 0x1F, 0x7F, 0xDA,
+    0xCA, 0x38, 0x32, 0x18, 0x47, 0xA3, 0x55, 0x4B, 0xB5, 0xC3, 0xA4, 0x1B, 0x3A, 0x98, 0x59, 0xCE,
+    0x70, 0x1C, 0x02, 0x8B, 0x29, 0x58, 0x95, 0x62, 0xFD, 0x80, 0xB7, 0xBE, 0x42, 0x04, 0xAF, 0x90,
+    0xF9, 0xD5, 0xE6, 0x69, 0x21, 0x23, 0x85, 0xE8, 0xFC, 0x0C, 0x98, 0x0B, 0xA0, 0x1E, 0x59, 0x2D,
+    0x66, 0x71, 0xB0, 0x4B, 0x03, 0x79, 0x91, 0x42, 0x5E, 0x1B, 0x4B, 0xD2, 0xEA, 0x0A, 0xF3, 0xAF,
+    0x69, 0x30, 0xAF, 0x15, 0x29, 0xD1, 0x7E, 0x6D, 0xAC, 0xAE, 0x5B, 0x5D, 0x69, 0x9F, 0xD1, 0x04,
+    0x8D, 0x29, 0x52, 0x5A, 0x5D, 0x1B, 0xDB, 0xD1, 0xEA, 0x6A, 0x97, 0x0C, 0x9F, 0x61, 0x8A, 0x51,
+    0x8E, 0xAE, 0x4D, 0x62, 0x69, 0xF5, 0x5B, 0x05, 0x19, 0xE2, 0x30, 0x45, 0x5E, 0xA1, 0xCF, 0x9B,
+    0x1A, 0x64, 0xCF, 0xAF, 0xD0, 0x8B, 0x67, 0x0E, 0x66, 0xF0, 0x98, 0x95, 0xD3, 0x9C, 0xB0, 0x86,
+    0x95, 0x31, 0x2F, 0xA8, 0x95, 0x67, 0x42, 0x87, 0xF9, 0xF5, 0x02, 0x64, 0x71, 0xF0, 0x42, 0x9D,
+    0xE2, 0x70, 0x51, 0x12, 0x35, 0x09, 0xE1, 0x22, 0x72, 0xFA, 0x9D, 0xBB, 0x7D, 0xF0, 0x5E, 0x55,
+    0xD2, 0x34, 0x09, 0x6D, 0x1A, 0xB9, 0x89, 0xB9, 0xDB, 0xA7, 0xBA, 0x2A, 0x13, 0x9A, 0x24, 0x26,
+    0x8D, 0x5E, 0xB7, 0xE6, 0xEE, 0xCB, 0x4E, 0x57, 0x73, 0x47, 0x93, 0xD4, 0xE4, 0x97, 0x7D, 0xEF,
+    0x93, 0x39, 0x1D, 0xBA, 0x44, 0xB4, 0x02, 0xF2, 0x35, 0xC0, 0xC6, 0x15, 0x8A, 0xB1, 0x05, 0xAA,
+    0x57, 0x2F, 0xF9, 0x8F, 0x92, 0x10, 0x44, 0xB6, 0xC9, 0x45, 0xAC, 0x79, 0xF6, 0xC1, 0x46, 0x57,
+    0xCC, 0x68, 0x88, 0xAA, 0x14, 0xD5, 0x18, 0xCB, 0x54, 0x57, 0x24, 0xB6, 0x21, 0x76, 0x99, 0x3A,
+    0x59, 0x19, 0x91, 0x4A, 0xAF, 0x34, 0x4A, 0x2B, 0x27, 0x18, 0x91, 0x83, 0xD3, 0x6F, 0x6F, 0x33,
+    0x97, 0x8A, 0x5B, 0x7E, 0x69, 0xAF, 0x79, 0x7E, 0xCD, 0x51, 0x41, 0x24, 0x52, 0x45, 0x22, 0x5D,
+    0xE4, 0xD8, 0x1D, 0x9C, 0x5E, 0xE4, 0x7D, 0xA8, 0xBA, 0x48, 0xA4, 0x89, 0x44, 0x8A, 0x5C, 0x7E,
+    0x8A, 0x48, 0xA7, 0xCF, 0x3F, 0xD8, 0x19, 0x1B, 0x0C, 0xFE, 0x75, 0xC3, 0xFD, 0x8A, 0xF8, 0x7E,
+    0xCB, 0x24, 0x0D, 0xF7, 0x7C, 0x63, 0x4E, 0x3F, 0x73, 0xFE, 0x64, 0x67, 0x44, 0x8A, 0x5C, 0xE6,
+    0x34, 0x64, 0xBA, 0xE2, 0xCE, 0x8F, 0x59, 0x91, 0xFC, 0x48, 0x7C, 0x2E, 0x78, 0x4F, 0xBA, 0x68,
+    0xF9, 0xFD, 0x2E, 0x71, 0x41, 0x73, 0x16, 0xFD, 0x6E, 0x43, 0x74, 0xAD, 0x1F, 0xD1, 0xF0, 0x4D,
+    0x47, 0x92, 0xD8, 0x97, 0xBA, 0xB9, 0xFA, 0xE0, 0x6F, 0x24, 0x90, 0xE8, 0x1D, 0x69, 0x92, 0x58,
+    0x5C, 0xA9, 0xEE, 0x7B, 0xC5, 0x63, 0xAE, 0xE3, 0xA1, 0xF4, 0x0A, 0xBB, 0x56, 0x42, 0x02, 0xD1,
+    0xEB, 0x22, 0xEF, 0x89, 0x74, 0x97, 0x76, 0x9E, 0xFF, 0xFC, 0x8B, 0xD0, 0xF9, 0xFF, 0x01, 0xED,
+    0xBC, 0x5D, 0xAC, 0x1D, 0x47, 0x7E, 0xE0, 0xF7, 0xAB, 0x2E, 0x92, 0xED, 0x61, 0xC3, 0x2A, 0x3E,
+    0x90, 0x19, 0x79, 0x28, 0xAA, 0x6D, 0x40, 0x40, 0xC6, 0x0A, 0x79, 0x3B, 0x0F, 0x7E, 0x90, 0x77,
+    0x6F, 0x77, 0x97, 0x46, 0x8B, 0x1D, 0x20, 0x13, 0x40, 0xC4, 0x5A, 0x67, 0x06, 0x88, 0x60, 0x68,
+    0x1E, 0xFC, 0x20, 0x68, 0xBC, 0xBE, 0xBB, 0x08, 0x1D, 0xC8, 0xEB, 0x73, 0xEF, 0x69, 0x49, 0x48,
+    0xF4, 0xE0, 0x87, 0x21, 0xE0, 0x9D, 0xF5, 0xC3, 0x3C, 0x0C, 0x37, 0x11, 0xB2, 0xA3, 0xA3, 0xC4,
+    0xD2, 0x83, 0x02, 0xD0, 0x93, 0xBE, 0xF7, 0x14, 0x75, 0x11, 0x10, 0x81, 0x80, 0xA8, 0x24, 0x79,
+    0xA0, 0x07, 0x21, 0x51, 0xCF, 0x90, 0x5A, 0xD9, 0x24, 0x60, 0x96, 0xA4, 0xA6, 0xD5, 0x97, 0xEC,
+    0x73, 0xFE, 0x79, 0xE8, 0x73, 0x2F, 0x2F, 0x29, 0x6A, 0xA4, 0xF9, 0xD8, 0x41, 0x1E, 0xD2, 0x7D,
+    0xFE, 0x55, 0xA7, 0xAB, 0xBB, 0xBE, 0xAB, 0xFF, 0xDF, 0xD5, 0x00, 0xB1, 0x23, 0x85, 0x31, 0xEA,
+    0xC3, 0xE9, 0xCB, 0xAF, 0x8B, 0x64, 0xA3, 0xC7, 0x6A, 0xA2, 0x40, 0xE2, 0xC8, 0xE0, 0xB3, 0xFE,
+    0xA2, 0x45, 0x3A, 0x23, 0x12, 0x8A, 0xE9, 0xD4, 0xB6, 0xA0, 0x3D, 0x18, 0x0B, 0x39, 0xB0, 0xBC,
+    0x5C, 0xFB, 0xDE, 0xE9, 0x58, 0xC4, 0xA7, 0x22, 0xF6, 0x2E, 0x77, 0xEF, 0xB8, 0x3C, 0x34, 0x9D,
+    0x46, 0x22, 0x6E, 0x6B, 0x7A, 0x2E, 0x83, 0xC4, 0x11, 0x05, 0xA8, 0x89, 0x44, 0x2A, 0x91, 0x30,
+    0x5C, 0xB0, 0xFF, 0x0E, 0x19, 0x94, 0x22, 0xAE, 0x14, 0x71, 0xC5, 0x74, 0x6A, 0x73, 0x86, 0xE2,
+    0xEE, 0x84, 0x62, 0x64, 0x29, 0x65, 0x4E, 0x29, 0xE2, 0x72, 0xD2, 0x90, 0xA3, 0xBB, 0x1C, 0xFA,
+    0x1C, 0xD6, 0x73, 0x28, 0x72, 0x28, 0xF7, 0x03, 0x50, 0x00, 0x1B, 0x40, 0x0D, 0xAA, 0xE7, 0xEC,
+    0xF1, 0x80, 0x88, 0x67, 0xB6, 0x00, 0x65, 0x79, 0x6A, 0x7A, 0x2E, 0x93, 0x3E, 0xB9, 0x32, 0xBD,
+    0xBD, 0x4D, 0xB2, 0x60, 0x26, 0x6D, 0xF6, 0xF0, 0x2C, 0x71, 0xF1, 0x47, 0x81, 0xBA, 0x26, 0x5D,
+    0x43, 0x5F, 0x75, 0xDC, 0x08, 0x14, 0x60, 0x2A, 0x74, 0x83, 0x6A, 0xA1, 0x8F, 0x1E, 0x9E, 0x23,
+    0x0B, 0xB2, 0x39, 0xC0, 0x3A, 0x51, 0x43, 0x16, 0xB5, 0x14, 0xC4, 0x8D, 0x71, 0xBA, 0xA1, 0xA3,
+    0xA4, 0xA0, 0x84, 0x4E, 0x37, 0x89, 0x23, 0xF6, 0x45, 0xD4, 0x42, 0xA6, 0x9B, 0x0D, 0xA0, 0x2F,
+    0x4C, 0x05, 0xFA, 0xE3, 0x4B, 0x01, 0x30, 0x5B, 0x35, 0x80, 0x48, 0x05, 0x64, 0x1B, 0xEB, 0x40,
+    0x7C, 0xE9, 0xA7, 0xED, 0xF0, 0x98, 0x83, 0x52, 0x37, 0x25, 0x24, 0xBE, 0x50, 0x1D, 0xAA, 0xD3,
+    0x4D, 0xE2, 0x29, 0x28, 0x28, 0x31, 0x4E, 0x37, 0xCC, 0xFF, 0x20, 0x50, 0x10, 0xCB, 0x26, 0xBA,
+    0x21, 0x0B, 0x00, 0x64, 0x00, 0x44, 0x9F, 0x79, 0xA1, 0x4E, 0xFF, 0x2E, 0x87, 0x39, 0x5C, 0xAD,
+    0x33, 0x66, 0x9D, 0x5A, 0x85, 0xD8, 0x53, 0xC7, 0xAE, 0x80, 0x3E, 0xD5, 0x0D, 0x74, 0xE3, 0x12,
+    0xD8, 0xF9, 0x28, 0x80, 0xBA, 0x79, 0x0D, 0x88, 0xAF, 0x6D, 0x02, 0xEB, 0xE3, 0x1A, 0xF4, 0x4F,
+    0x42, 0x0F, 0x65, 0xEC, 0x7A, 0x74, 0x48, 0xE9, 0x28, 0x19, 0xAB, 0x2E, 0x6A, 0x55, 0x50, 0x72,
+    0xCD, 0xC6, 0x2E, 0x12, 0x18, 0xC6, 0x7C, 0xB7, 0xD2, 0xC4, 0xDD, 0xAA, 0xB9, 0x1E, 0xAA, 0x07,
+    0x58, 0x13, 0x1F, 0x8B, 0x84, 0x7B, 0x6C, 0x1A, 0xC0, 0x38, 0x48, 0x2D, 0xAC, 0x83, 0x6A, 0xC1,
+    0x38, 0x54, 0x4F, 0x29, 0x15, 0xB2, 0x80, 0xD1, 0xAC, 0x82, 0xCC, 0x0E, 0x93, 0x5A, 0x0F, 0xC5,
+    0x1A, 0x07, 0x1B, 0xBF, 0xCF, 0xF1, 0x20, 0x22, 0x0F, 0x8B, 0x34, 0xA8, 0x06, 0x22, 0x0F, 0xDA,
+    0x81, 0x01, 0x55, 0x43, 0xDA, 0xC0, 0x51, 0x38, 0x24, 0x67, 0x13, 0x91, 0x87, 0x2F, 0x1F, 0x0F,
+    0xB0, 0x0E, 0xA9, 0x25, 0x71, 0x1C, 0xF7, 0x89, 0x54, 0x91, 0xF4, 0x43, 0x49, 0x1D, 0x94, 0x60,
+    0xFE, 0x4F, 0xCC, 0xDB, 0x22, 0xCD, 0x4C, 0x3C, 0x2B, 0x43, 0x69, 0xAB, 0x60, 0xE0, 0xB8, 0x23,
+    0xF3, 0x28, 0x4B, 0x0E, 0xB5, 0xF6, 0x64, 0x36, 0x27, 0x6E, 0xB4, 0x57, 0x1D, 0x39, 0x1B, 0x68,
+    0x6F, 0x1C, 0xB9, 0x0E, 0x68, 0xDF, 0x43, 0x5E, 0x82, 0xBE, 0xE6, 0xA1, 0xEC, 0x41, 0xBF, 0xDB,
+    0x40, 0x9E, 0x55, 0x68, 0x3F, 0x87, 0x5C, 0xB7, 0xCB, 0x87, 0x29, 0xD1, 0x5E, 0xF5, 0xE4, 0xC4,
+    0xD7, 0x1F, 0xF1, 0xA4, 0x7D, 0x0E, 0x33, 0x07, 0x8C, 0x87, 0xF7, 0xF8, 0x8E, 0x3F, 0xCA, 0x3E,
+    0xC9, 0x57, 0x12, 0x17, 0x37, 0x35, 0x5D, 0xE2, 0x0A, 0x6A, 0xE3, 0x92, 0xED, 0x40, 0x5D, 0x93,
+    0x5C, 0x83, 0xAD, 0x96, 0xE4, 0x75, 0x4F, 0x5D, 0x92, 0xB8, 0x9E, 0x5A, 0x87, 0xC4, 0x19, 0x57,
+    0x33, 0xB9, 0xE9, 0x94, 0x0C, 0xA3, 0x95, 0xDD, 0x16, 0x1D, 0xCB, 0xA1, 0x36, 0x96, 0x4D, 0xED,
+    0xD9, 0xA0, 0xFD, 0xF6, 0x06, 0xF9, 0xEA, 0x06, 0xE6, 0xD1, 0x09, 0xFA, 0x6D, 0x81, 0x56, 0x86,
+    0x4E, 0x98, 0x99, 0x45, 0x8B, 0x83, 0x7F, 0xEC, 0x20, 0x2F, 0x2B, 0xCC, 0xA3, 0x2D, 0xFA, 0x6D,
+    0xB1, 0xB4, 0x1F, 0x07, 0xF2, 0x93, 0x25, 0xC6, 0xC6, 0x41, 0x7B, 0x26, 0xB4, 0xC4, 0x4D, 0x0E,
+    0x5B, 0x3C, 0xC9, 0x57, 0x92, 0x0B, 0x71, 0x53, 0x3F, 0xDD, 0x25, 0x17, 0xB7, 0xA8, 0x27, 0x2E,
+    0xB9, 0xB8, 0x6C, 0x66, 0xC5, 0x56, 0x37, 0x34, 0x73, 0x42, 0x72, 0xB1, 0xA7, 0xFE, 0xF3, 0x90,
+    0x5C, 0xFC, 0xAE, 0xAB, 0x1F, 0xD8, 0x48, 0x9C, 0xEA, 0xB4, 0x27, 0x71, 0x39, 0xAA, 0xFD, 0xF2,
+    0xFB, 0x94, 0x89, 0x84, 0xC4, 0xCD, 0x44, 0xB5, 0xE4, 0x14, 0xCB, 0x01, 0x53, 0x2D, 0xDA, 0x17,
+    0x50, 0x8A, 0x43, 0x4B, 0x0F, 0xC5, 0xB7, 0x1A, 0xB4, 0xCF, 0x2C, 0x39, 0x3D, 0xDA, 0xC7, 0x0D,
+    0x39, 0x99, 0xD5, 0x9E, 0x9E, 0x61, 0x72, 0xC8, 0x6C, 0x0E, 0xBD, 0xF6, 0xC4, 0xCD, 0xEE, 0x32,
+    0x4C, 0x1C, 0xAC, 0x5D, 0x39, 0xC7, 0x4C, 0x5A, 0x1E, 0xFF, 0xF1, 0xE9, 0x65, 0x9A, 0x3A, 0x97,
+    0xB8, 0xB8, 0x49, 0x9C, 0xA9, 0x12, 0x57, 0x90, 0xB8, 0x9E, 0x64, 0x3B, 0x90, 0xBC, 0xEE, 0x48,
+    0xAE, 0x41, 0x72, 0xCD, 0x92, 0xBC, 0xEE, 0x87, 0x34, 0xD7, 0x93, 0xB8, 0x92, 0xC4, 0x19, 0x37,
+    0xE4, 0x51, 0xDD, 0x6C, 0x01, 0xEB, 0xA5, 0x54, 0x6C, 0x1C, 0x7A, 0xA9, 0x61, 0x03, 0x3A, 0x26,
+    0x0C, 0xAF, 0xBE, 0xA9, 0x4A, 0xD0, 0x4D, 0x09, 0x74, 0xA5, 0x85, 0xA2, 0xB4, 0x60, 0x5E, 0xB6,
+    0x0C, 0xE3, 0xCA, 0x4E, 0x0F, 0x14, 0x59, 0x05, 0xE6, 0xD9, 0x0E, 0x74, 0x93, 0x59, 0xE8, 0x74,
+    0xBB, 0x97, 0x5D, 0x07, 0x74, 0x43, 0x09, 0x1D, 0x71, 0xA0, 0x80, 0x0D, 0x9E, 0x9A, 0x72, 0xE8,
+    0x19, 0xE9, 0x59, 0x57, 0xDF, 0x0C, 0xBA, 0x21, 0x76, 0x05, 0xA4, 0x3A, 0xC0, 0xB8, 0x04, 0xF5,
+    0x51, 0x80, 0xF8, 0x1A, 0x90, 0x6E, 0x02, 0xE3, 0x4D, 0x50, 0xA1, 0x87, 0xD8, 0xF5, 0x90, 0xD2,
+    0xC3, 0x98, 0x1E, 0x15, 0x54, 0x47, 0xEC, 0x54, 0x97, 0x43, 0x52, 0xE5, 0x60, 0xDC, 0x17, 0x08,
+    0x4A, 0x19, 0xB0, 0xB4, 0xB8, 0x62, 0x34, 0x7A, 0xE2, 0x0B, 0xE4, 0xF8, 0xDB, 0x1C, 0xCC, 0x3C,
+    0x07, 0xB3, 0x44, 0x91, 0x9F, 0x11, 0x1C, 0x7D, 0x12, 0x75, 0x2E, 0x83, 0x71, 0xE2, 0x48, 0xA3,
+    0x40, 0xEC, 0x6A, 0x54, 0x58, 0x26, 0x64, 0x91, 0x88, 0xB8, 0x99, 0x48, 0xB8, 0xDB, 0x13, 0xEB,
+    0x89, 0x23, 0xFD, 0xC7, 0x40, 0x3C, 0x67, 0x20, 0x44, 0xDA, 0x0F, 0x94, 0x88, 0x7C, 0x99, 0xA0,
+    0x6C, 0x0E, 0x89, 0xBC, 0xED, 0x41, 0x16, 0x39, 0x98, 0x2B, 0x7F, 0xE9, 0xA1, 0x27, 0x07, 0xE3,
+    0xF4, 0xDD, 0xFF, 0x8A, 0x48, 0x4F, 0x29, 0x22, 0x4E, 0xBF, 0x3F, 0x1A, 0xFD, 0xEC, 0x67, 0xEF,
+    0xFA, 0x97, 0x27, 0x51, 0xD3, 0x1F, 0xD6, 0x28, 0xE9, 0x6B, 0xD4, 0xCE, 0x63, 0x35, 0x2A, 0xB0,
+    0x3F, 0x88, 0x02, 0x33, 0x91, 0x65, 0xF0, 0xA9, 0xBB, 0x9F, 0x0E, 0x4A, 0x91, 0x05, 0xEC, 0x46,
+    0xC5, 0x74, 0xBA, 0x35, 0x74, 0xB1, 0xF8, 0xC2, 0x51, 0x39, 0xB2, 0xE4, 0x50, 0xCA, 0x7C, 0x88,
+    0xA4, 0xCA, 0xA1, 0x20, 0x6D, 0x72, 0x28, 0xD0, 0xED, 0xF0, 0x64, 0x3F, 0x44, 0x9B, 0x43, 0xB4,
+    0x31, 0x44, 0xC5, 0x5D, 0x23, 0x80, 0xBD, 0x68, 0x7D, 0x88, 0xFA, 0x81, 0xD4, 0x74, 0x00, 0x67,
+    0xD3, 0x30, 0x50, 0x35, 0x07, 0x20, 0x8B, 0x81, 0xF0, 0x58, 0x9E, 0x9A, 0x4E, 0x2B, 0x22, 0x11,
+    0x81, 0xE4, 0xCA, 0xB4, 0x86, 0x0C, 0x15, 0xA0, 0x26, 0x76, 0x44, 0x81, 0x14, 0x12, 0xC7, 0x18,
+    0x32, 0x94, 0xEC, 0x50, 0x13, 0x8B, 0x44, 0x81, 0xF4, 0x61, 0x49, 0x1C, 0x63, 0x36, 0x33, 0x54,
+    0xA0, 0xAF, 0x89, 0x5D, 0xF4, 0x51, 0x20, 0x25, 0x7E, 0xDD, 0x31, 0x26, 0x5D, 0x43, 0x85, 0xA1,
+    0x15, 0xAA, 0x65, 0x17, 0x73, 0x2E, 0x69, 0x4E, 0x07, 0x3C, 0x90, 0x3A, 0x40, 0xE6, 0x80, 0x12,
+    0xCF, 0xBE, 0x23, 0x92, 0x00, 0x89, 0x74, 0x90, 0xEC, 0x1C, 0x80, 0x24, 0x00, 0x3A, 0x90, 0x35,
+    0xAA, 0xA5, 0x14, 0x6A, 0xCA, 0xE7, 0x43, 0x89, 0xA9, 0x36, 0x4D, 0x95, 0x38, 0xF3, 0x5C, 0x13,
+    0x05, 0x1D, 0x3A, 0x7A, 0xFA, 0x82, 0x92, 0xD2, 0x54, 0xC6, 0x99, 0xED, 0x10, 0x05, 0xDD, 0xF4,
+    0xAC, 0xD3, 0xA6, 0xD6, 0x54, 0xB5, 0x0E, 0x3A, 0x6C, 0x30, 0x61, 0x52, 0x92, 0x74, 0x89, 0x58,
+    0x66, 0x22, 0x43, 0x9F, 0x3D, 0xCA, 0x66, 0xED, 0x50, 0xF1, 0x5A, 0x03, 0xD2, 0xC1, 0xE2, 0x9F,
+    0xC1, 0x3A, 0x07, 0x29, 0x29, 0x3B, 0x53, 0x95, 0xB3, 0xAF, 0xFB, 0xF4, 0x91, 0x0F, 0xDB, 0xC4,
+    0x8D, 0xC7, 0x3A, 0xA4, 0xA9, 0xED, 0xE3, 0x6D, 0x9F, 0x45, 0xA1, 0x8F, 0x7D, 0x97, 0xDA, 0xBE,
+    0xD6, 0x6D, 0x3A, 0xA7, 0x14, 0xB1, 0x91, 0xC8, 0x02, 0x65, 0xD7, 0xEC, 0x30, 0xB0, 0xB3, 0x85,
+    0xD5, 0x22, 0x6D, 0xBC, 0x78, 0xB8, 0xD6, 0x2D, 0xE8, 0x16, 0x54, 0x07, 0x6C, 0x32, 0x90, 0x4D,
+    0x53, 0x81, 0x6E, 0x96, 0xA3, 0x51, 0xEC, 0x26, 0x84, 0xE5, 0xA4, 0xA5, 0xBB, 0x17, 0x13, 0x20,
+    0xD9, 0xE1, 0x49, 0x66, 0xB2, 0x20, 0x12, 0xB1, 0x24, 0x67, 0x81, 0x57, 0x01, 0xC3, 0x40, 0x5C,
+    0x0F, 0x05, 0x48, 0x5A, 0xE0, 0x34, 0x90, 0xED, 0x30, 0x13, 0x37, 0xFB, 0xA6, 0xDF, 0x18, 0x28,
+    0x68, 0x45, 0xEC, 0x51, 0xED, 0x2E, 0xA1, 0xD5, 0x0D, 0xF4, 0x90, 0x59, 0x74, 0xAB, 0xAA, 0x89,
+    0x84, 0x48, 0x5A, 0x8C, 0x85, 0x00, 0xF7, 0x43, 0xEC, 0xF8, 0x72, 0x83, 0x09, 0x70, 0x9A, 0x99,
+    0x88, 0xCC, 0x44, 0xE4, 0xA9, 0x97, 0xAE, 0xBC, 0x88, 0xF6, 0xFC, 0xE2, 0xF0, 0x3E, 0x68, 0x19,
+    0x80, 0xEC, 0x2E, 0x70, 0x8C, 0xA7, 0xA6, 0xD3, 0xE7, 0x45, 0xE6, 0x0F, 0xBE, 0x3C, 0xAD, 0x54,
+    0x80, 0x14, 0x7E, 0x66, 0xD4, 0x42, 0xDA, 0xA2, 0xC4, 0x42, 0x3B, 0x60, 0x95, 0x5B, 0xD1, 0x41,
+    0x6A, 0x48, 0xD3, 0x0A, 0xF3, 0x5A, 0x20, 0x71, 0x05, 0xBA, 0x49, 0x5C, 0x14, 0xE8, 0xE8, 0xC8,
+    0xA8, 0xD1, 0x4D, 0x01, 0x75, 0x06, 0xE6, 0x3D, 0x8B, 0x12, 0x07, 0xA5, 0x87, 0x38, 0xDC, 0x39,
+    0x13, 0xCD, 0x5D, 0x12, 0x7E, 0x08, 0xFF, 0x73, 0x20, 0x7E, 0xBB, 0x21, 0x33, 0x8E, 0x2E, 0xB5,
+    0xB1, 0x2B, 0x28, 0xA9, 0x69, 0x69, 0x13, 0xA7, 0x43, 0x41, 0x7C, 0x21, 0x60, 0xFE, 0xC2, 0x91,
+    0xE5, 0xB0, 0x1E, 0x40, 0x2A, 0xD4, 0x7C, 0x98, 0x4A, 0x53, 0x0D, 0x85, 0x75, 0x43, 0x59, 0xFB,
+    0x2E, 0x7F, 0xD1, 0x06, 0x8F, 0x76, 0x4E, 0x33, 0x11, 0x21, 0x15, 0x71, 0xBF, 0x78, 0x83, 0x5B,
+    0xCC, 0x37, 0xEE, 0xD6, 0x60, 0x23, 0x52, 0x95, 0xB2, 0xB8, 0x5B, 0x83, 0x0B, 0x48, 0xA3, 0x16,
+    0xDD, 0x18, 0x47, 0xCF, 0x06, 0xA9, 0x8D, 0x82, 0x6E, 0x30, 0xAE, 0x86, 0xF5, 0xD4, 0x12, 0x7D,
+    0xDC, 0x80, 0xE9, 0x81, 0x89, 0x1D, 0x96, 0x3E, 0xE2, 0x20, 0xDD, 0x00, 0xFD, 0xD3, 0x00, 0xB5,
+    0x71, 0xA4, 0x76, 0x1D, 0xDD, 0x44, 0x81, 0x1A, 0x53, 0xA5, 0x96, 0xAD, 0x3F, 0x08, 0x68, 0xA9,
+    0x21, 0x0D, 0xCB, 0x65, 0x11, 0x7D, 0xEA, 0x8F, 0x3A, 0xFD, 0x20, 0xEA, 0x5C, 0x6A, 0x75, 0x48,
+    0x5C, 0xE2, 0x74, 0x48, 0xAD, 0xEA, 0x0A, 0xA8, 0x7B, 0x28, 0x5B, 0x30, 0xCD, 0x00, 0x65, 0x0B,
+    0x75, 0x8F, 0xEA, 0x0A, 0x74, 0x48, 0x6D, 0xE2, 0x12, 0x9F, 0x5A, 0xBD, 0x28, 0x50, 0x8B, 0xE5,
+    0xF8, 0xDC, 0x09, 0xC7, 0x66, 0x22, 0xF3, 0xA8, 0xC9, 0x44, 0xA4, 0xEA, 0x0F, 0x4D, 0x17, 0xD3,
+    0xB3, 0xE5, 0xF0, 0xFA, 0x38, 0x8C, 0x43, 0x07, 0x74, 0x80, 0x1E, 0x7A, 0xF8, 0x55, 0xDD, 0x98,
+    0x8F, 0x46, 0x93, 0xD3, 0x94, 0x22, 0x32, 0xC7, 0x88, 0x88, 0x58, 0x58, 0x92, 0xCB, 0x81, 0x60,
+    0x0E, 0x24, 0x73, 0x58, 0xD7, 0x7B, 0x37, 0x4E, 0x3F, 0x35, 0x9D, 0xDA, 0x73, 0xA9, 0x48, 0x33,
+    0x8E, 0x5E, 0xBA, 0xF1, 0x42, 0x0A, 0x1D, 0xB1, 0xA3, 0x40, 0x05, 0x4C, 0xC5, 0x18, 0xDD, 0xF0,
+    0x85, 0x12, 0xD7, 0xD1, 0x22, 0xD2, 0x21, 0x03, 0x05, 0xC3, 0x54, 0x2C, 0x17, 0x3D, 0xDD, 0x1E,
+    0x1D, 0x31, 0x15, 0xA0, 0x6C, 0x0D, 0x79, 0x14, 0xA0, 0x4B, 0x1C, 0xBA, 0xC9, 0xC0, 0x54, 0x35,
+    0x14, 0x9F, 0x95, 0x14, 0x37, 0x1C, 0x6F, 0xCC, 0x8D, 0x97, 0xA5, 0x32, 0x22, 0x5B, 0x1C, 0xFA,
+    0x91, 0xED, 0x76, 0xCB, 0x36, 0xD5, 0x6E, 0xD1, 0x1D, 0x03, 0x62, 0x18, 0x96, 0x49, 0x19, 0x76,
+    0x49, 0x44, 0xCA, 0x2E, 0x87, 0xBD, 0x97, 0x74, 0x90, 0x17, 0x88, 0xCE, 0x76, 0x68, 0x7F, 0x27,
+    0xF4, 0x68, 0x5F, 0x93, 0xF8, 0xC9, 0x48, 0x7C, 0x26, 0x9F, 0xF8, 0x43, 0x8B, 0x47, 0xF6, 0xE3,
+    0x9D, 0x06, 0xF4, 0x62, 0x80, 0xBB, 0xCF, 0x7A, 0x0D, 0x79, 0x0D, 0xC5, 0xA7, 0x40, 0xD9, 0xA2,
+    0xD6, 0xD5, 0x1E, 0x4C, 0x74, 0xB5, 0x55, 0x5E, 0x95, 0x45, 0x22, 0xB2, 0xC5, 0xCB, 0x97, 0x0B,
+    0x74, 0x75, 0x3B, 0xEC, 0x2B, 0xF7, 0x05, 0x0E, 0x7D, 0xB7, 0x62, 0xDC, 0x11, 0xBF, 0x51, 0x31,
+    0xEE, 0x0E, 0xC4, 0x6F, 0x3C, 0xEB, 0xC6, 0xFD, 0xC9, 0xF8, 0xF5, 0xD7, 0x2E, 0xF4, 0x93, 0x3F,
+    0x91, 0xD7, 0x64, 0x51, 0x1F, 0x5A, 0xC4, 0x2E, 0x72, 0x63, 0x4E, 0x0E, 0x11, 0xB1, 0x83, 0x71,
+    0xFE, 0x59, 0x0C, 0xD3, 0x90, 0x70, 0xE8, 0x05, 0x8A, 0x99, 0x04, 0x23, 0x57, 0x45, 0xEF, 0x90,
+    0x34, 0xED, 0xC0, 0x1B, 0x64, 0xC6, 0x92, 0x6C, 0x7B, 0xA2, 0xD0, 0x42, 0x7D, 0xD7, 0x84, 0x5D,
+    0x56, 0xBB, 0xFE, 0x54, 0x74, 0x61, 0x56, 0xD5, 0x22, 0xDF, 0x58, 0x7C, 0xB3, 0x9F, 0xD9, 0xE4,
+    0xDD, 0x86, 0x62, 0x13, 0x7D, 0xD5, 0x51, 0xD4, 0x3F, 0x3B, 0x6A, 0x76, 0x29, 0x75, 0x2C, 0x97,
+    0x07, 0x1E, 0x08, 0x90, 0x87, 0x27, 0x0E, 0xDD, 0x92, 0x34, 0xC4, 0x1E, 0x1D, 0x30, 0x0E, 0xD5,
+    0x9E, 0x4C, 0x2D, 0x74, 0xAB, 0x19, 0xD0, 0x0F, 0x61, 0x29, 0xD3, 0xE9, 0xB4, 0x4F, 0x45, 0x44,
+    0x7A, 0x35, 0x9B, 0x4E, 0xA7, 0x3F, 0xA4, 0xDC, 0x27, 0x08, 0xA7, 0x16, 0x06, 0x09, 0x10, 0x12,
+    0x0F, 0x4B, 0xEC, 0x81, 0x12, 0x7B, 0xA8, 0x81, 0x89, 0x48, 0x03, 0xF1, 0x20, 0x99, 0x1F, 0xB4,
+    0x4B, 0xA2, 0x5D, 0x4A, 0x83, 0xB9, 0xBC, 0xF6, 0xCC, 0xC3, 0x2D, 0xF5, 0x6A, 0x89, 0xFE, 0x60,
+    0xDB, 0x53, 0x16, 0x5B, 0xA3, 0x6F, 0x7D, 0x24, 0x22, 0x72, 0x68, 0x31, 0x9D, 0x9E, 0x8B, 0xDD,
+    0x92, 0x29, 0xD2, 0x0D, 0x83, 0xE8, 0xCA, 0x9C, 0x7B, 0xD1, 0x22, 0x6E, 0xE0, 0x35, 0x94, 0xE5,
+    0x73, 0xBA, 0x95, 0xFC, 0x9A, 0xBA, 0x35, 0xE4, 0xFB, 0xAC, 0xF0, 0xD8, 0x2E, 0xA7, 0x92, 0x49,
+    0x43, 0xF2, 0x4B, 0x76, 0x3A, 0x71, 0x4B, 0x0D, 0xC0, 0xED, 0x7F, 0x1E, 0x63, 0xB6, 0x98, 0x2D,
+    0x62, 0xFF, 0x79, 0xE7, 0x6C, 0x2E, 0x0B, 0x38, 0x8A, 0x05, 0x08, 0x03, 0x06, 0xB9, 0x5E, 0x03,
+    0xE8, 0x25, 0x4B, 0xF7, 0xD8, 0xDE, 0xA0, 0xEA, 0x06, 0x63, 0x59, 0x4F, 0x3C, 0x39, 0x3A, 0x18,
+    0x47, 0x4B, 0x86, 0xA9, 0xB4, 0x57, 0x1D, 0x99, 0x35, 0xD6, 0x38, 0x4A, 0x72, 0x6A, 0x28, 0x68,
+    0xE3, 0x06, 0x36, 0xB5, 0x2F, 0x81, 0xDE, 0x7C, 0x2D, 0x00, 0x22, 0x52, 0x81, 0x5E, 0x72, 0xDD,
+    0xDF, 0x7A, 0xBF, 0x87, 0xA8, 0x35, 0xB6, 0x07, 0xE3, 0x72, 0xD5, 0x42, 0x4F, 0xAB, 0x03, 0x71,
+    0xA3, 0xBD, 0x0E, 0x94, 0x18, 0x9B, 0xF8, 0xA8, 0x25, 0xC7, 0xB8, 0xB4, 0xA2, 0x25, 0xAD, 0x7A,
+    0xB4, 0x27, 0xFB, 0x86, 0xC7, 0x58, 0x4A, 0x88, 0xAA, 0xDF, 0x02, 0x56, 0xB5, 0x87, 0xE8, 0x7A,
+    0x0F, 0x24, 0x02, 0x70, 0x70, 0xB7, 0xBD, 0xBF, 0xCB, 0x61, 0xA2, 0x67, 0x03, 0x2D, 0xBD, 0xA9,
+    0x8C, 0xCD, 0x58, 0xA7, 0xD5, 0x3E, 0x0A, 0xC6, 0x76, 0x98, 0xAA, 0xCD, 0x20, 0x37, 0x5F, 0xF7,
+    0x44, 0x22, 0xDD, 0xA0, 0x2E, 0x23, 0x7E, 0xB3, 0xDD, 0x80, 0xCE, 0x7C, 0xAD, 0xA5, 0xA4, 0x35,
+    0x2E, 0xF6, 0xC6, 0x6E, 0xD0, 0xD3, 0x46, 0xA1, 0xC4, 0x58, 0x73, 0xD1, 0xD3, 0xB2, 0xB1, 0x4F,
+    0xD2, 0xDF, 0xA2, 0x65, 0x83, 0x9C, 0x0D, 0x8C, 0xDD, 0x40, 0xFB, 0x12, 0xDA, 0x72, 0x29, 0xE9,
+    0xAF, 0x81, 0x16, 0x39, 0x8B, 0x88, 0xD8, 0xC2, 0x3E, 0xD1, 0x19, 0xCB, 0xE4, 0x11, 0x4F, 0x1C,
+    0xDA, 0x41, 0x18, 0x30, 0xDF, 0xB5, 0xE8, 0x4B, 0x1E, 0xFA, 0x76, 0x50, 0xAF, 0xED, 0x52, 0x7C,
+    0xD5, 0x2E, 0x39, 0xC8, 0x2D, 0xBE, 0xA4, 0x04, 0x2D, 0xB2, 0xE4, 0xB2, 0x4F, 0xC3, 0x93, 0x7C,
+    0x25, 0x71, 0xFA, 0x96, 0xCA, 0xA2, 0x4A, 0xB6, 0x03, 0x75, 0x4F, 0x22, 0x97, 0x99, 0x49, 0x97,
+    0xBC, 0xBF, 0xD6, 0xD4, 0x94, 0xDF, 0x70, 0xF4, 0x35, 0xC9, 0xEB, 0x8E, 0xF5, 0x1A, 0xFD, 0xAE,
+    0x23, 0x87, 0xD8, 0xC3, 0x78, 0xD0, 0x02, 0x75, 0xAA, 0x9A, 0x90, 0x8A, 0x63, 0x36, 0xE0, 0x81,
+    0x44, 0xA4, 0x41, 0x8B, 0xF4, 0x30, 0x1F, 0x4D, 0x20, 0xC7, 0x38, 0x8C, 0xD5, 0x81, 0xD8, 0xD1,
+    0xA3, 0x02, 0x25, 0xD4, 0x18, 0x47, 0x86, 0x0E, 0x98, 0x8A, 0x7E, 0x29, 0x42, 0xB7, 0x18, 0xC7,
+    0x18, 0x1D, 0x48, 0xA1, 0x27, 0x71, 0x94, 0xE8, 0x06, 0xE3, 0x68, 0xD1, 0x81, 0x31, 0xF4, 0x94,
+    0x50, 0xFE, 0x81, 0x58, 0xCC, 0x5C, 0x2C, 0x5A, 0x0E, 0xEE, 0xD2, 0x84, 0x01, 0x09, 0xB5, 0x7B,
+    0x1A, 0xAC, 0x92, 0x01, 0x21, 0x3C, 0x38, 0x3D, 0x87, 0x16, 0xB1, 0x14, 0xD3, 0x96, 0xD8, 0x19,
+    0xCB, 0x98, 0x96, 0xC4, 0x19, 0x4B, 0x4D, 0x8B, 0xA9, 0x8C, 0xA5, 0xA5, 0xC5, 0x58, 0x63, 0x55,
+    0x18, 0x16, 0xA1, 0xD5, 0x0D, 0x2D, 0x35, 0xC6, 0xCE, 0x2A, 0xE4, 0x8D, 0x06, 0xD3, 0xED, 0x92,
+    0xDD, 0xB0, 0xA4, 0x48, 0xBA, 0x59, 0x22, 0xE4, 0x41, 0x7A, 0xFD, 0xAE, 0x45, 0x7F, 0xBC, 0x7F,
+    0xF0, 0xDF, 0xF8, 0x54, 0x82, 0x88, 0x7C, 0x2C, 0x22, 0xFD, 0xCE, 0x68, 0x34, 0xB9, 0xFB, 0x13,
+    0xFB, 0x12, 0x8A, 0x3B, 0x27, 0xB0, 0x06, 0x36, 0xF8, 0x92, 0x9A, 0x2D, 0x27, 0x70, 0xB1, 0x3B,
+    0x81, 0xEA, 0x7F, 0x1C, 0xF4, 0x20, 0x59, 0x06, 0x75, 0x4D, 0xF4, 0xD1, 0xEE, 0xA5, 0x48, 0x3F,
+    0x13, 0xF9, 0xE8, 0x33, 0xEE, 0xEE, 0x69, 0xE9, 0x12, 0x07, 0x25, 0xA8, 0x96, 0x07, 0x52, 0x87,
+    0xCC, 0x89, 0xA4, 0x5A, 0xB2, 0x1A, 0xBF, 0x16, 0xC5, 0x43, 0xBF, 0x4B, 0xDE, 0xE9, 0x76, 0x45,
+    0xC3, 0x68, 0x29, 0xE0, 0x81, 0x3A, 0xFD, 0x4B, 0x2A, 0x1E, 0x6E, 0xEC, 0x2A, 0x1E, 0x96, 0xCB,
+    0x24, 0x6A, 0x96, 0x8B, 0x64, 0xCC, 0x52, 0x30, 0xB8, 0x3B, 0xB9, 0xBF, 0x03, 0x36, 0x50, 0x5B,
+    0xE5, 0x95, 0xD9, 0xC2, 0x88, 0x6C, 0xA9, 0xBF, 0x3E, 0x7B, 0x17, 0xD6, 0x41, 0x6D, 0x40, 0xB2,
+    0x58, 0x82, 0xFB, 0x34, 0x1C, 0xB4, 0x2F, 0x10, 0xFD, 0xA0, 0x22, 0xEF, 0xD0, 0xEF, 0xDD, 0x8A,
+    0x7A, 0xF4, 0xBB, 0x8E, 0xCD, 0xC9, 0x48, 0xDE, 0x12, 0x59, 0x1F, 0xB8, 0x95, 0x7C, 0xA0, 0xF0,
+    0xEB, 0x30, 0xF1, 0xC4, 0x73, 0xD8, 0x65, 0x08, 0xF6, 0x22, 0x65, 0xCB, 0x0A, 0xD2, 0xC6, 0x04,
+    0x48, 0xBA, 0x25, 0x47, 0x73, 0xD3, 0xA1, 0xA4, 0xCA, 0x5B, 0xF8, 0xA4, 0x31, 0x05, 0x8C, 0x3B,
+    0x7D, 0xD1, 0xB1, 0x52, 0x10, 0x5A, 0xCC, 0xA3, 0x55, 0x9E, 0x11, 0x6F, 0x37, 0xE6, 0xEB, 0x4E,
+    0x37, 0x9D, 0xF6, 0x1D, 0xA1, 0xA0, 0xCD, 0xA8, 0x4D, 0x95, 0x6B, 0x9F, 0xEB, 0xC6, 0xD8, 0x3E,
+    0xA5, 0xD3, 0x3E, 0x4D, 0xAA, 0x82, 0x56, 0x5F, 0xF2, 0xA6, 0xCA, 0xD9, 0x0C, 0xBA, 0x31, 0x36,
+    0xED, 0xE8, 0xB4, 0xD7, 0x3D, 0xE5, 0xE9, 0x96, 0x2D, 0x4C, 0x9F, 0x63, 0xAC, 0x1E, 0x74, 0xC8,
+    0x49, 0x75, 0x8B, 0x15, 0x55, 0x61, 0x9F, 0x86, 0x61, 0x63, 0x49, 0x9B, 0x9E, 0x82, 0xC3, 0xD5,
+    0xCC, 0x92, 0xF9, 0x59, 0x45, 0xE9, 0x67, 0x8E, 0x89, 0x9F, 0x35, 0xDC, 0xF4, 0x9B, 0x81, 0x8F,
+    0x7D, 0xDD, 0x46, 0x1F, 0xFB, 0xFA, 0xBC, 0x7E, 0xDB, 0xD7, 0xAB, 0xF1, 0xB6, 0xAF, 0x73, 0xF3,
+    0x9C, 0xAF, 0x53, 0xA3, 0x7D, 0x6D, 0xFE, 0x44, 0xFB, 0x3A, 0xD9, 0xD4, 0xBE, 0xD6, 0xBD, 0xF6,
+    0xB5, 0xEE, 0xB4, 0xD4, 0x2A, 0xE8, 0xC5, 0x1E, 0x17, 0x3C, 0xDE, 0x7B, 0xD3, 0xF7, 0xD6, 0x0D,
+    0xA7, 0x7F, 0x0E, 0x2A, 0x75, 0x14, 0x0B, 0xAD, 0xA9, 0x88, 0xAE, 0xD7, 0xBB, 0xE4, 0x69, 0x8F,
+    0x38, 0x99, 0x6A, 0x29, 0x68, 0xEB, 0x39, 0x60, 0x6A, 0xA0, 0x0E, 0xA0, 0x2F, 0x35, 0x90, 0x26,
+    0x0E, 0x7A, 0x63, 0x07, 0xFC, 0x9C, 0x31, 0x86, 0x8E, 0x8E, 0xD8, 0x47, 0x81, 0x4C, 0xC4, 0x23,
+    0x22, 0x55, 0x7C, 0x65, 0x3A, 0xA3, 0x84, 0x81, 0x12, 0x25, 0x0E, 0xD5, 0x16, 0xA0, 0x7F, 0x12,
+    0x20, 0x79, 0xC3, 0x41, 0x6A, 0xA3, 0xEA, 0xB7, 0xE8, 0x92, 0x2A, 0xFD, 0xBE, 0x53, 0xE2, 0x97,
+    0x54, 0xE6, 0xF0, 0xC2, 0x66, 0xD2, 0x25, 0x67, 0x27, 0x16, 0xBD, 0x6B, 0xF2, 0x50, 0x8F, 0xBB,
+    0x99, 0x7C, 0x28, 0xDF, 0xAB, 0x7B, 0xB2, 0x9A, 0xE4, 0x1A, 0xFA, 0xA6, 0x53, 0xF3, 0x4E, 0x49,
+    0x29, 0x9F, 0xBC, 0x26, 0x4D, 0x50, 0xC0, 0x01, 0x80, 0xDA, 0x80, 0x0E, 0xEB, 0x10, 0x71, 0x7A,
+    0xBF, 0xF6, 0xE4, 0xD7, 0xD0, 0x17, 0x2C, 0x74, 0x29, 0x65, 0xEC, 0x6E, 0xD5, 0xFD, 0x8B, 0xF6,
+    0x85, 0x58, 0x44, 0x1C, 0x5A, 0x44, 0x02, 0xDC, 0x98, 0x8F, 0x1E, 0x83, 0xBA, 0x00, 0xC8, 0x4D,
+    0x05, 0x64, 0x4B, 0xB1, 0xA1, 0x03, 0x12, 0x57, 0x00, 0xBA, 0x31, 0x15, 0x44, 0x41, 0x8B, 0x78,
+    0x3A, 0x44, 0x5A, 0x6A, 0xCA, 0xD1, 0x63, 0x94, 0x22, 0x15, 0xA4, 0x22, 0x0D, 0x98, 0x2B, 0xD3,
+    0x0E, 0x62, 0x4F, 0xC1, 0x92, 0xE8, 0xA8, 0x76, 0x57, 0xF7, 0x31, 0x1F, 0x3D, 0xB6, 0x0E, 0xA5,
+    0x48, 0x09, 0x46, 0xC4, 0xA9, 0x59, 0x93, 0x74, 0x94, 0xF2, 0xA1, 0x2C, 0xD8, 0x49, 0xE4, 0xCD,
+    0x4D, 0x88, 0x7B, 0x7A, 0x30, 0x4E, 0xB5, 0x0C, 0x34, 0x69, 0x34, 0x1F, 0x3D, 0x51, 0xCD, 0x44,
+    0x64, 0x91, 0xEE, 0x3C, 0x71, 0x65, 0xFA, 0x42, 0x4F, 0x09, 0x89, 0xA3, 0x67, 0xA0, 0x6A, 0xD4,
+    0x64, 0x0D, 0xAA, 0x8B, 0x3E, 0x69, 0xD4, 0xB6, 0x48, 0x22, 0x12, 0x49, 0x13, 0x4B, 0xCB, 0x11,
+    0x38, 0x8D, 0xE2, 0xA8, 0x0A, 0xC6, 0x96, 0x4F, 0x38, 0x2D, 0x8E, 0x63, 0x16, 0xD0, 0x22, 0xAD,
+    0xC8, 0xBC, 0x18, 0x8D, 0x8C, 0x45, 0x7B, 0x68, 0x21, 0x87, 0xE5, 0x85, 0x48, 0x5F, 0x8A, 0x98,
+    0xEF, 0x8D, 0x3E, 0x75, 0xA7, 0x85, 0x62, 0x34, 0x32, 0x22, 0x6F, 0x8B, 0xB4, 0x51, 0x75, 0x98,
+    0x95, 0x28, 0xB0, 0xB3, 0x49, 0x2C, 0x76, 0x97, 0x85, 0x5D, 0xBB, 0x4C, 0x26, 0x4D, 0x72, 0x79,
+    0xED, 0x99, 0x96, 0xBA, 0x44, 0x5F, 0x6A, 0x28, 0x37, 0x46, 0xDF, 0xFA, 0x44, 0x44, 0x26, 0xD3,
+    0xE9, 0x7F, 0x58, 0xA2, 0x9C, 0x30, 0x30, 0x84, 0x0B, 0xEE, 0xD5, 0x22, 0x3E, 0x91, 0x6E, 0x8F,
+    0x03, 0x4E, 0x64, 0x31, 0xF0, 0x5B, 0xFA, 0x7D, 0x35, 0x73, 0x40, 0x56, 0xED, 0x72, 0x8F, 0xE5,
+    0xEE, 0x5B, 0xA8, 0x5A, 0x40, 0xFF, 0x64, 0x34, 0x1A, 0x3D, 0xF1, 0x03, 0x11, 0x59, 0x4C, 0x44,
+    0xA4, 0xEB, 0x96, 0xCB, 0xCC, 0x3C, 0xEA, 0x60, 0x33, 0x5B, 0xAE, 0xCF, 0xB4, 0xEA, 0x51, 0x3D,
+    0x0B, 0xD6, 0x9C, 0x12, 0xE9, 0x61, 0x26, 0x76, 0xE0, 0xB3, 0x0E, 0xC9, 0x59, 0x2D, 0xE2, 0x8A,
+    0xD1, 0x0C, 0x54, 0x3F, 0x30, 0xC6, 0xC5, 0x50, 0xEC, 0x64, 0x26, 0x72, 0xF3, 0xC6, 0x74, 0x36,
+    0x46, 0x5F, 0xF2, 0xAC, 0x97, 0x98, 0x0B, 0x5D, 0xD4, 0x26, 0xB2, 0x20, 0x15, 0xCB, 0xC1, 0xDD,
+    0x97, 0xA0, 0x4B, 0x41, 0x87, 0x31, 0x44, 0x9C, 0xDD, 0xF7, 0x0E, 0x64, 0xD2, 0x0D, 0xAC, 0xA2,
+    0xF9, 0xB7, 0x87, 0x04, 0x60, 0x8B, 0xA5, 0xE2, 0x8D, 0x7E, 0x97, 0xE0, 0xC4, 0x1E, 0x30, 0xFF,
+    0xFD, 0x68, 0x34, 0xDA, 0x98, 0x88, 0xC8, 0x8E, 0x88, 0xC8, 0xA5, 0x06, 0xCC, 0x77, 0xAB, 0x81,
+    0x05, 0x8B, 0xDA, 0x1A, 0xCC, 0x85, 0x16, 0x36, 0x74, 0x20, 0x0E, 0xBA, 0x53, 0x33, 0x62, 0x91,
+    0x40, 0x24, 0x73, 0xE0, 0x28, 0xC0, 0x11, 0xF2, 0x81, 0xA3, 0xBA, 0x37, 0xDA, 0x95, 0x1F, 0x7E,
+    0xA9, 0x5E, 0x0D, 0xDD, 0x1A, 0x3A, 0xB6, 0xEC, 0xDA, 0x9D, 0x9D, 0xFB, 0xFF, 0x22, 0x33, 0x3D,
+    0x48, 0x00, 0x45, 0xEC, 0x40, 0x37, 0x63, 0xD8, 0x37, 0x1C, 0xFF, 0x49, 0x99, 0x69, 0x80, 0x54,
+    0x7B, 0x6A, 0x53, 0x71, 0xF6, 0xDE, 0xDD, 0xDA, 0xD4, 0x4C, 0x6C, 0x2A, 0xE2, 0x7E, 0x9F, 0xC9,
+    0xC0, 0xED, 0xEC, 0x1A, 0x31, 0x63, 0x0F, 0x25, 0xC4, 0x01, 0x59, 0xA0, 0xA5, 0x43, 0x7D, 0x73,
+    0xB1, 0x5C, 0x18, 0xFD, 0xED, 0xEC, 0x51, 0x77, 0x99, 0xB5, 0x6D, 0x91, 0x79, 0x2C, 0x52, 0x0D,
+    0x13, 0x73, 0x84, 0x36, 0x23, 0x37, 0xEE, 0x20, 0xD5, 0xB2, 0x9A, 0xB5, 0x1D, 0x66, 0xD2, 0xDE,
+    0xFF, 0xF0, 0x8C, 0x5D, 0x15, 0x6B, 0x8D, 0xDA, 0x64, 0xD6, 0x91, 0x89, 0x83, 0x7E, 0xB0, 0x4D,
+    0x07, 0xE8, 0xCF, 0x32, 0x2F, 0x65, 0x91, 0xC8, 0x1C, 0x65, 0x99, 0x88, 0xBC, 0x29, 0x22, 0xCF,
+    0x4E, 0xA7, 0x73, 0x30, 0x1E, 0xE6, 0x83, 0x60, 0xD8, 0xEF, 0x45, 0xC9, 0xC2, 0x92, 0x49, 0xC3,
+    0xB1, 0xB5, 0x30, 0xE8, 0xF9, 0x92, 0x5B, 0xB6, 0xD8, 0xA8, 0x05, 0xF3, 0x7F, 0x59, 0x35, 0x2F,
+    0x45, 0xFC, 0x9A, 0x74, 0x70, 0x1A, 0x1E, 0x9C, 0x4E, 0x1F, 0x11, 0xE9, 0x1F, 0x9C, 0xBE, 0x3C,
+    0x28, 0x78, 0xBB, 0x5D, 0x85, 0xD3, 0xD2, 0x92, 0x9E, 0x5E, 0x26, 0x92, 0x96, 0x63, 0x6B, 0xCD,
+    0xF0, 0x32, 0xD7, 0xC3, 0x50, 0x14, 0x03, 0x29, 0xCF, 0x21, 0x71, 0xA8, 0xEE, 0x6F, 0xD4, 0x2C,
+    0x11, 0xA9, 0x8E, 0xCB, 0x59, 0x28, 0xC5, 0x13, 0xCB, 0x1C, 0x8E, 0x8D, 0xEC, 0xAE, 0x2A, 0x2A,
+    0xD9, 0xF6, 0xA8, 0x3E, 0x87, 0x72, 0xDB, 0x93, 0xF4, 0x39, 0xEA, 0x93, 0x6D, 0x4F, 0x31, 0xCE,
+    0x49, 0x2E, 0x6E, 0x7B, 0xD5, 0x8E, 0x73, 0x8A, 0x78, 0xDB, 0x27, 0x6E, 0x9C, 0xD3, 0xC6, 0xDB,
+    0xBE, 0x60, 0x9C, 0xC7, 0x2E, 0xDE, 0xF6, 0x2D, 0xE3, 0xBC, 0x24, 0xDE, 0x7E, 0xC7, 0x31, 0xCE,
+    0x3B, 0xE2, 0x6D, 0x81, 0x71, 0xE9, 0x88, 0xB7, 0xBB, 0xC1, 0x48, 0x16, 0x3B, 0x2D, 0x73, 0x26,
+    0xE2, 0xD5, 0xE8, 0x31, 0x80, 0x27, 0x39, 0xF4, 0x7D, 0xC7, 0xA2, 0xA6, 0xBC, 0xEA, 0xE2, 0x45,
+    0xCD, 0x27, 0x57, 0x5D, 0x56, 0xD4, 0x7A, 0xFB, 0xAA, 0x3B, 0x5F, 0xD4, 0xA9, 0xBE, 0xBA, 0xED,
+    0x8B, 0x7A, 0xAC, 0xAF, 0xBE, 0x61, 0x8B, 0xAD, 0x46, 0x5F, 0xED, 0x29, 0x66, 0x95, 0xBE, 0x1A,
+    0x28, 0x38, 0xC0, 0x72, 0x01, 0x16, 0x89, 0x43, 0x55, 0x0F, 0xDC, 0x5A, 0x81, 0xFF, 0x89, 0xDB,
+    0x8F, 0x85, 0x22, 0xBE, 0x03, 0x13, 0xFC, 0xC2, 0xDD, 0x50, 0x83, 0xCA, 0xA6, 0x5D, 0x06, 0x91,
+    0xFD, 0xF6, 0xFE, 0x97, 0x29, 0x91, 0x16, 0x26, 0x22, 0x36, 0x5A, 0xD8, 0x35, 0x1F, 0x07, 0xE2,
+    0x60, 0x1C, 0xAA, 0x4B, 0x2B, 0xE8, 0x33, 0x60, 0xBD, 0x04, 0x8A, 0x02, 0x28, 0xEF, 0x16, 0x94,
+    0x40, 0x91, 0x01, 0x1B, 0xA9, 0x1D, 0x54, 0xB1, 0xAA, 0x8F, 0x03, 0x3A, 0x44, 0x0B, 0x32, 0xCF,
+    0x4C, 0xC4, 0x0E, 0xDA, 0x81, 0x01, 0xC5, 0x1D, 0x80, 0x36, 0x1B, 0xE0, 0xDB, 0xBF, 0xB1, 0x0F,
+    0xC7, 0xB6, 0x44, 0x22, 0x36, 0xB9, 0xBE, 0xE6, 0xD3, 0x4A, 0x87, 0x72, 0x60, 0x13, 0xFA, 0x75,
+    0xA8, 0xF7, 0x43, 0x01, 0x7D, 0x09, 0x5D, 0x6A, 0xA3, 0x60, 0x7C, 0xD2, 0x68, 0x91, 0x8A, 0xD9,
+    0x7C, 0x9F, 0xBE, 0xE5, 0xE7, 0xE9, 0x4E, 0x29, 0x22, 0x32, 0x04, 0xD3, 0xE9, 0x74, 0xF6, 0x19,
+    0xDD, 0xE1, 0x67, 0x74, 0x67, 0xB7, 0xD9, 0x97, 0x9F, 0x58, 0x36, 0x9B, 0xBD, 0x66, 0x4F, 0x44,
+    0xFA, 0x89, 0x48, 0xBF, 0x3E, 0xE8, 0xCD, 0xFA, 0xE2, 0xB3, 0x9A, 0xFD, 0xAB, 0x9B, 0x9E, 0x5F,
+    0xBE, 0x3F, 0xCB, 0xE9, 0x51, 0x6D, 0x09, 0xA7, 0xEF, 0x32, 0x3D, 0xBF, 0x4C, 0x3F, 0x01, 0x15,
+    0x72, 0xA8, 0x4D, 0xC5, 0x97, 0x54, 0xC5, 0x2D, 0xFC, 0xBA, 0xB0, 0x4A, 0x64, 0x4E, 0xF1, 0xF0,
+    0xC4, 0x0F, 0x44, 0x8E, 0xD4, 0x0D, 0xB8, 0x89, 0x8D, 0xA5, 0x9E, 0x4B, 0x87, 0x44, 0xA4, 0xD7,
+    0x22, 0xC2, 0x68, 0xF4, 0x84, 0xDB, 0x67, 0xDA, 0x2A, 0x96, 0xDC, 0x44, 0xEA, 0x20, 0x75, 0x7F,
+    0xC4, 0x9A, 0x4F, 0x45, 0x7C, 0x24, 0x52, 0xC1, 0x69, 0x38, 0x00, 0xC9, 0x33, 0x41, 0x87, 0x75,
+    0x7E, 0xFB, 0xE0, 0x5E, 0x85, 0x67, 0x23, 0x11, 0xFB, 0xFB, 0x8F, 0xB7, 0x03, 0xFE, 0xF6, 0x03,
+    0x8A, 0xD3, 0x22, 0x4E, 0x64, 0x40, 0x71, 0x83, 0xA9, 0x2B, 0xB9, 0x60, 0x4D, 0x23, 0xD2, 0xA4,
+    0xE2, 0x39, 0xC0, 0x5D, 0xD0, 0x58, 0xBD, 0x64, 0x51, 0xD6, 0x33, 0x30, 0xAE, 0x43, 0xB5, 0x89,
+    0x23, 0xA3, 0xB8, 0x65, 0x89, 0x30, 0x15, 0xB5, 0x6A, 0x07, 0x1F, 0x81, 0x2C, 0xF6, 0xD0, 0xD5,
+    0x90, 0xBC, 0x67, 0x07, 0x1D, 0x75, 0xB4, 0x58, 0x76, 0x4F, 0x75, 0x4B, 0x76, 0x28, 0xF5, 0x30,
+    0xEB, 0x06, 0x49, 0x90, 0x03, 0x40, 0x24, 0x0B, 0x8C, 0xF4, 0xBB, 0x55, 0xEE, 0xB3, 0xC0, 0x24,
+    0x83, 0x05, 0xC6, 0x0F, 0x16, 0x98, 0x8E, 0x36, 0x76, 0x51, 0x28, 0x89, 0x5D, 0x3B, 0x98, 0x8C,
+    0x0A, 0xC8, 0x5B, 0x98, 0xB9, 0xDB, 0x4C, 0x46, 0xEB, 0x03, 0x65, 0x4A, 0x2B, 0xBE, 0xD9, 0x13,
+    0x89, 0x23, 0xE9, 0x76, 0x19, 0x85, 0xBB, 0xA3, 0xBA, 0x5F, 0x43, 0x1F, 0xB1, 0xC3, 0xDA, 0xCF,
+    0xB4, 0xE7, 0x81, 0x43, 0xBB, 0x15, 0x1F, 0xAE, 0x38, 0xBC, 0x06, 0xEB, 0x05, 0x51, 0xA8, 0x31,
+    0xCF, 0xB4, 0xAC, 0xEB, 0x46, 0x87, 0xC4, 0x99, 0xCA, 0xD8, 0x31, 0x99, 0x0E, 0x8C, 0x8D, 0xA5,
+    0xAB, 0x89, 0x3E, 0x6E, 0xD0, 0xEF, 0x59, 0x92, 0x7E, 0x28, 0xBC, 0x1C, 0xE4, 0xBA, 0xD8, 0x43,
+    0x06, 0xAA, 0xE3, 0xE0, 0x9A, 0x23, 0xEB, 0x61, 0x56, 0x01, 0x1C, 0x3D, 0x08, 0x66, 0x3B, 0x10,
+    0x85, 0x31, 0xE4, 0xC6, 0x62, 0xBE, 0xE6, 0xC1, 0x1E, 0x61, 0x57, 0xB5, 0x5D, 0x14, 0x10, 0xBF,
+    0x15, 0xA0, 0x37, 0x15, 0xA9, 0xAD, 0x89, 0x82, 0x6E, 0x28, 0xC8, 0x48, 0x1C, 0x1D, 0x1D, 0x89,
+    0x4B, 0x2D, 0x85, 0x0E, 0x44, 0x61, 0x1D, 0xCC, 0x5F, 0x38, 0xD8, 0x6C, 0x77, 0x2D, 0x92, 0xCD,
+    0x1D, 0x36, 0x57, 0x35, 0x87, 0x44, 0x2A, 0x06, 0x0D, 0x97, 0x1D, 0x34, 0x4B, 0xA7, 0x29, 0x8D,
+    0x8B, 0xC2, 0x18, 0xA3, 0x3D, 0xE1, 0x14, 0x6A, 0xB8, 0xF1, 0x20, 0xFC, 0x6E, 0x8D, 0x6A, 0x3B,
+    0x92, 0xD7, 0x02, 0x45, 0xEC, 0x55, 0x6B, 0xAA, 0xC4, 0x65, 0x14, 0xE4, 0x2A, 0x50, 0x1B, 0xA7,
+    0x42, 0x8E, 0xFE, 0x49, 0x20, 0x79, 0xA3, 0xC2, 0xAC, 0x43, 0x16, 0x60, 0x52, 0x41, 0xBF, 0x9C,
+    0x62, 0x3B, 0xCC, 0x58, 0x03, 0x13, 0x98, 0x85, 0x61, 0xF8, 0x07, 0x8B, 0x79, 0x4B, 0xA6, 0x9B,
+    0x7D, 0x03, 0x9C, 0x54, 0x24, 0xB3, 0xC1, 0x8D, 0x49, 0x02, 0x5A, 0x1C, 0x46, 0x6E, 0x5D, 0xDE,
+    0x74, 0x98, 0xF7, 0x2C, 0x65, 0x79, 0xF6, 0x78, 0x3F, 0x11, 0x09, 0x99, 0xFC, 0x60, 0xC9, 0xFE,
+    0xEC, 0x56, 0xF5, 0xA9, 0x4B, 0x0B, 0x2B, 0xDA, 0xE9, 0xB0, 0xCE, 0x6F, 0xEC, 0xE1, 0xE3, 0xAF,
+    0x12, 0xFD, 0x95, 0xA7, 0x58, 0x47, 0x7F, 0x30, 0x44, 0x97, 0x3C, 0x45, 0x8E, 0xBE, 0x14, 0x28,
+    0xD2, 0xF7, 0x5F, 0x6E, 0x66, 0xB2, 0xE0, 0xA9, 0xBF, 0x6C, 0x06, 0xF6, 0x61, 0x5F, 0x54, 0x8A,
+    0x7C, 0x57, 0xE4, 0xE3, 0x2B, 0xD3, 0x17, 0xEE, 0x14, 0x58, 0x3E, 0xF7, 0xE2, 0x7D, 0x10, 0x47,
+    0x79, 0x17, 0x57, 0xC4, 0x63, 0xF0, 0xD4, 0xF4, 0x25, 0x91, 0xAD, 0xE9, 0xF7, 0x1D, 0x35, 0xC9,
+    0xDD, 0x83, 0x99, 0x4F, 0xE6, 0x68, 0x4F, 0xBE, 0x17, 0x1C, 0xFD, 0x1C, 0x2C, 0x9D, 0x03, 0xD9,
+    0x17, 0x08, 0xCA, 0xE9, 0x59, 0xB2, 0x52, 0x16, 0x64, 0xC5, 0x54, 0x5C, 0x96, 0x93, 0x34, 0x59,
+    0x8E, 0x0E, 0x59, 0x4E, 0x74, 0x7B, 0xA0, 0xC3, 0x70, 0xB7, 0x18, 0x4D, 0x5C, 0x56, 0x8A, 0x90,
+    0x95, 0x72, 0x99, 0x6C, 0xDF, 0x7B, 0x1A, 0xDF, 0xF1, 0x9E, 0x3E, 0x09, 0xD1, 0xF7, 0xDD, 0xA0,
+    0x72, 0xD2, 0x57, 0x6F, 0xFB, 0x33, 0x93, 0xB3, 0xFA, 0xAA, 0x88, 0x2B, 0x6A, 0x35, 0xD3, 0x57,
+    0x5D, 0xD4, 0x16, 0x35, 0xE6, 0x91, 0xAB, 0x8E, 0xB6, 0xA8, 0xC9, 0x1E, 0xB9, 0xEA, 0x8E, 0x87,
+    0x62, 0x26, 0xBD, 0xBE, 0x2A, 0x3B, 0x14, 0xBF, 0x0A, 0x77, 0xD1, 0xC2, 0x82, 0x54, 0x83, 0xA5,
+    0xEC, 0xFC, 0xA0, 0x37, 0x4B, 0x2A, 0x0E, 0x6E, 0x0D, 0xD6, 0xD8, 0x15, 0x7E, 0x5E, 0x2F, 0xD2,
+    0x99, 0x27, 0xBB, 0x35, 0xBF, 0x8E, 0xFF, 0x3C, 0x60, 0x3A, 0xA2, 0xCB, 0xBF, 0x56, 0xD3, 0xF1,
+    0x0A, 0x70, 0xBC, 0x81, 0xB8, 0x07, 0x56, 0xF8, 0x05, 0x4D, 0xC7, 0x6E, 0x9F, 0xE9, 0x78, 0x65,
+    0x09, 0x05, 0x1C, 0xDC, 0x84, 0xA4, 0x87, 0x43, 0x4D, 0x01, 0x69, 0xE2, 0x31, 0x55, 0x8F, 0x71,
+    0x69, 0x15, 0xFB, 0x28, 0xE8, 0x86, 0x32, 0x0A, 0xC4, 0x6F, 0xB6, 0x50, 0x77, 0x90, 0xCE, 0xD1,
+    0x22, 0x62, 0x45, 0xC4, 0x53, 0x06, 0xC8, 0x36, 0x06, 0x2C, 0x64, 0x5C, 0x4F, 0xEC, 0x53, 0xAB,
+    0x9B, 0x28, 0x44, 0x81, 0x42, 0xB5, 0x24, 0xBE, 0x87, 0xBE, 0x86, 0xB4, 0x7A, 0x10, 0x75, 0x6E,
+    0x1D, 0xE3, 0x6A, 0x6A, 0xFA, 0xD8, 0xAB, 0xAE, 0x20, 0xFA, 0x38, 0xA0, 0xC5, 0xC6, 0x22, 0x7D,
+    0x2A, 0x12, 0x10, 0x4F, 0xF2, 0x86, 0x63, 0xC3, 0x54, 0x3A, 0xA4, 0x36, 0x23, 0x53, 0x2D, 0xA5,
+    0xA9, 0xD8, 0x00, 0x55, 0xD1, 0x3C, 0x75, 0xFE, 0x47, 0xE7, 0xCF, 0x35, 0xFF, 0xBE, 0x3A, 0xC7,
+    0xE7, 0x9F, 0x10, 0xD9, 0x84, 0x95, 0x17, 0x57, 0xFE, 0x3A, 0x39, 0x1C, 0xFD, 0x57, 0x1C, 0xFE,
+    0xFC, 0x53, 0x7A, 0xE9, 0x47, 0x8F, 0x0D, 0xE1, 0x53, 0xD3, 0xE9, 0x7F, 0x10, 0x91, 0x2B, 0xD3,
+    0xE9, 0xD4, 0xCA, 0xFE, 0xE3, 0xFA, 0x68, 0x34, 0x1A, 0x8D, 0x46, 0x16, 0xB4, 0xCB, 0x57, 0xF5,
+    0xDB, 0xBF, 0x82, 0x60, 0x29, 0x04, 0x8B, 0xF4, 0x0F, 0x4E, 0xA7, 0x15, 0x70, 0x6C, 0x34, 0x7A,
+    0x44, 0xA4, 0x3F, 0x36, 0x1A, 0xD9, 0xC4, 0xF5, 0xA6, 0x6A, 0xD3, 0xA8, 0x59, 0x55, 0x76, 0x3D,
+    0x7D, 0xAE, 0xA9, 0x53, 0xED, 0x9F, 0x3E, 0x90, 0x5C, 0x68, 0xCB, 0xD8, 0x77, 0x59, 0xEC, 0xBB,
+    0x54, 0xFB, 0xF3, 0xA9, 0x76, 0xE7, 0x0F, 0x62, 0xD7, 0xCD, 0x33, 0x6D, 0xA9, 0x9B, 0x3A, 0xB9,
+    0xD0, 0xA6, 0xDA, 0xE7, 0x49, 0xF5, 0xB4, 0xC1, 0x1E, 0x5D, 0x6A, 0xD1, 0x74, 0x03, 0x2D, 0x9C,
+    0x82, 0x84, 0xE8, 0xDF, 0xFD, 0xF8, 0x9C, 0x48, 0xFF, 0x4F, 0xFE, 0xFA, 0x25, 0x62, 0x88, 0x1C,
+    0xBC, 0x32, 0xDC, 0xB1, 0x44, 0x1E, 0x5E, 0x1D, 0x56, 0x7A, 0xB5, 0x2B, 0x7C, 0x15, 0x7B, 0xA2,
+    0xDF, 0x40, 0x49, 0x75, 0x03, 0xE7, 0xE1, 0x14, 0xC4, 0x36, 0x16, 0xF9, 0x50, 0xA4, 0xE7, 0x04,
+    0x24, 0x7B, 0xEE, 0x38, 0x05, 0x24, 0x15, 0x91, 0xE7, 0xF4, 0x99, 0xA3, 0x13, 0x91, 0xF4, 0xDA,
+    0xCB, 0x4E, 0x0D, 0xE5, 0xAE, 0xEC, 0x16, 0xA5, 0x98, 0x3D, 0x2F, 0x6B, 0x8B, 0xD9, 0x0D, 0xF9,
+    0x40, 0xE2, 0x16, 0x7E, 0x13, 0xDD, 0x20, 0x55, 0x39, 0x37, 0xF2, 0x9C, 0xD8, 0x39, 0x0F, 0x01,
+    0x1C, 0x4D, 0x5F, 0xFF, 0xB0, 0x3F, 0xC0, 0x51, 0x1E, 0xD8, 0x62, 0xBE, 0x60, 0xB1, 0xC9, 0xFC,
+    0x28, 0x47, 0x8E, 0x6E, 0x2D, 0x36, 0x8F, 0x3E, 0xF5, 0xC3, 0x1F, 0xFD, 0xF0, 0x8B, 0xAC, 0x82,
+    0x73, 0x9C, 0xE3, 0xC1, 0x17, 0x1F, 0xFC, 0xEB, 0x2F, 0x32, 0xFF, 0x1C, 0xE6, 0x30, 0x4C, 0xE6,
+    0xB7, 0xCE, 0xA8, 0xFA, 0xFC, 0x13, 0x26, 0xF3, 0x7F, 0xC5, 0x70, 0x7E, 0xF1, 0x1C, 0xFC, 0xE6,
+    0x70, 0x7E, 0xD1, 0x1C, 0x4B, 0x8A, 0xD9, 0xA1, 0x1A, 0x20, 0x9D, 0x0D, 0x5A, 0xEB, 0xDC, 0xD8,
+    0xA4, 0x02, 0xC6, 0x71, 0x65, 0x00, 0x9E, 0xD6, 0x6E, 0x05, 0xE0, 0xBC, 0x76, 0xAB, 0xCB, 0xF8,
+    0xFC, 0x10, 0x5F, 0x08, 0xC3, 0xFD, 0xED, 0x37, 0xCF, 0x73, 0xFC, 0xEC, 0x6A, 0xFC, 0xFC, 0x45,
+    0xB1, 0x93, 0x36, 0x37, 0x8F, 0x3E, 0xFA, 0x75, 0xD7, 0x8E, 0x53, 0x59, 0xB9, 0x5F, 0xBF, 0x19,
+    0x4E, 0xC5, 0xDD, 0xEA, 0x29, 0xF5, 0xD3, 0xE6, 0x7E, 0x38, 0x9F, 0xAB, 0x8F, 0x7C, 0x0A, 0x21,
+    0x57, 0x1F, 0x79, 0x43, 0xD4, 0x0C, 0x71, 0xEC, 0x4E, 0xA9, 0x9F, 0x36, 0x29, 0xC6, 0xAE, 0x44,
+    0x3F, 0x69, 0x56, 0x48, 0x31, 0xDA, 0x85, 0x9C, 0x1C, 0x73, 0xCD, 0x6D, 0xF5, 0x9C, 0x47, 0xCB,
+    0xD2, 0x49, 0xFC, 0xC8, 0x40, 0xB2, 0xF6, 0x38, 0xF8, 0x06, 0xED, 0xF6, 0x1C, 0xE2, 0x96, 0x6B,
+    0xDE, 0x3C, 0xD2, 0x2C, 0xF5, 0xEE, 0x8C, 0x63, 0x37, 0x78, 0x86, 0x10, 0x35, 0x66, 0xD0, 0x8F,
+    0x43, 0x52, 0xAD, 0x2E, 0x33, 0xB1, 0x42, 0x58, 0x59, 0x16, 0x75, 0x5E, 0xBB, 0x65, 0xA6, 0xA8,
+    0x31, 0xC9, 0xB3, 0x97, 0x79, 0xB0, 0x52, 0xE7, 0x63, 0x37, 0x5E, 0x2D, 0x7B, 0x2D, 0x2E, 0xEB,
+    0xCD, 0x73, 0x6F, 0xBF, 0xFD, 0x61, 0x9B, 0x3D, 0xF1, 0x4C, 0x5B, 0xA7, 0x92, 0x1A, 0x15, 0x5A,
+    0x63, 0xAA, 0x36, 0x6D, 0xDA, 0xB1, 0xDE, 0x76, 0x79, 0x1E, 0x35, 0xC4, 0xAF, 0x35, 0xE6, 0x09,
+    0xDA, 0x90, 0x54, 0xAC, 0x26, 0x55, 0x3E, 0xD6, 0x97, 0xDC, 0x0A, 0x51, 0xB3, 0xC2, 0xF5, 0x60,
+    0x1E, 0xE5, 0x3C, 0x86, 0xB1, 0xDE, 0x76, 0xF9, 0x6A, 0xD4, 0x70, 0x5E, 0x85, 0xD4, 0x10, 0x5A,
+    0x63, 0xB5, 0xD3, 0xFE, 0xFC, 0x4A, 0xF2, 0x5A, 0x18, 0x73, 0x8A, 0xF8, 0x9A, 0x9B, 0x6C, 0xEA,
+    0x9B, 0x8D, 0x0A, 0x24, 0x73, 0x26, 0x4D, 0xBC, 0x00, 0x50, 0x70, 0x14, 0x2C, 0x04, 0x53, 0x8D,
+    0xB5, 0x4F, 0x09, 0x71, 0x75, 0x2F, 0x84, 0x5C, 0x37, 0x75, 0xEC, 0x82, 0xF9, 0x5A, 0x93, 0x6A,
+    0xB7, 0x9A, 0xD8, 0xA7, 0xEF, 0xE1, 0xDB, 0xF7, 0x42, 0xC8, 0x8D, 0xED, 0xB2, 0xC4, 0x8D, 0x8D,
+    0xF6, 0x79, 0xF2, 0x6C, 0x93, 0x6A, 0x17, 0x4C, 0xE4, 0x5F, 0x8D, 0xAB, 0x66, 0x55, 0x55, 0xDF,
+    0xBE, 0x97, 0x31, 0x9D, 0x0A, 0x51, 0xA3, 0x5D, 0x5C, 0x19, 0xBE, 0x34, 0x5E, 0xA1, 0x30, 0x36,
+    0x4D, 0x5C, 0xF2, 0x9C, 0xD7, 0x17, 0x82, 0x6A, 0x5E, 0x25, 0xAC, 0xF2, 0xC0, 0xBD, 0xE3, 0x15,
+    0x63, 0xCD, 0x73, 0x6F, 0x06, 0x15, 0xEA, 0x82, 0x15, 0xF3, 0x88, 0xD3, 0x17, 0xC2, 0x79, 0x9E,
+    0x3E, 0x65, 0x30, 0xFA, 0x42, 0xC3, 0xD9, 0x6F, 0x7F, 0x95, 0x23, 0xB0, 0x0A, 0x9B, 0x70, 0x8D,
+    0xE8, 0xA2, 0xD5, 0xCF, 0xB9, 0x44, 0xF9, 0x7B, 0x08, 0x27, 0x39, 0xF3, 0x10, 0xAB, 0x1C, 0xD1,
+    0x4D, 0x19, 0x85, 0xF4, 0xE1, 0x36, 0x71, 0xC6, 0x99, 0x2A, 0xB5, 0xA9, 0x3D, 0x05, 0x47, 0xA2,
+    0xA0, 0x83, 0x6E, 0xE2, 0x26, 0xF6, 0xC6, 0xF5, 0x89, 0x5B, 0xD7, 0xCD, 0xFD, 0x7B, 0xD3, 0x69,
+    0x69, 0x39, 0x90, 0x93, 0x56, 0xFA, 0xCD, 0x56, 0xB5, 0x74, 0xB1, 0x57, 0x14, 0xA4, 0x76, 0xE9,
+    0x8B, 0xD3, 0xA0, 0xDA, 0x81, 0x05, 0x2E, 0x80, 0xF4, 0xD1, 0x8A, 0x9C, 0x49, 0xA3, 0xAF, 0x36,
+    0xAA, 0xA7, 0x5C, 0xA7, 0xF4, 0xFA, 0x43, 0x6B, 0x7E, 0x60, 0x0F, 0xA0, 0x9B, 0x75, 0xA0, 0x53,
+    0x2D, 0x14, 0xC4, 0x1E, 0x53, 0x91, 0x5A, 0xDD, 0xC0, 0x3A, 0x1D, 0xAD, 0x6A, 0x0B, 0xD2, 0x2A,
+    0xBE, 0x50, 0xA9, 0x8E, 0x7B, 0x07, 0x2D, 0xEB, 0xA6, 0xFE, 0xA8, 0x35, 0xAF, 0xFB, 0x32, 0xB5,
+    0xFD, 0x7A, 0xF4, 0x61, 0x48, 0x2E, 0xBA, 0x2C, 0xA5, 0x5E, 0x8D, 0x42, 0x88, 0x9F, 0x73, 0xF7,
+    0x1B, 0x9E, 0x5E, 0x55, 0x4D, 0x88, 0x9F, 0x73, 0xBF, 0x39, 0xB4, 0xF3, 0x74, 0xF4, 0x8D, 0xA6,
+    0x2C, 0xAB, 0xF9, 0xA6, 0x0E, 0xA7, 0xD5, 0xB0, 0xFA, 0x5A, 0x2D, 0x52, 0xFD, 0xD5, 0x9B, 0x2D,
+    0x6D, 0xC6, 0xAA, 0x76, 0x86, 0xA0, 0xDD, 0x98, 0x50, 0xB0, 0x5A, 0x62, 0x4A, 0xF4, 0x02, 0x16,
+    0xBB, 0x12, 0x58, 0xE4, 0x6F, 0x57, 0x53, 0xAA, 0xC1, 0xFF, 0x69, 0xB9, 0xB2, 0x4B, 0x91, 0xC5,
+    0xD2, 0x65, 0x16, 0x0D, 0xDC, 0xB7, 0x0A, 0xBA, 0x6A, 0x20, 0x68, 0xCF, 0x18, 0x73, 0x65, 0x0B,
+    0x8E, 0x2F, 0x96, 0x9C, 0xA8, 0x92, 0xCB, 0xA8, 0xC5, 0xE3, 0x81, 0x31, 0xB1, 0xBB, 0x07, 0x8C,
+    0x76, 0xF0, 0xD0, 0x7F, 0x09, 0xBB, 0xA2, 0xE8, 0xB7, 0xD1, 0x8E, 0x13, 0xF0, 0x0A, 0xBA, 0xE2,
+    0x24, 0x34, 0xC4, 0x96, 0x55, 0x94, 0xC7, 0x40, 0x41, 0xD4, 0x73, 0xCF, 0xEF, 0xF1, 0x4A, 0xD0,
+    0x17, 0xFC, 0x09, 0x5D, 0x85, 0x24, 0xB6, 0xF7, 0xDC, 0xA6, 0x44, 0xED, 0xB8, 0xCD, 0x63, 0x76,
+    0xE9, 0x67, 0xB5, 0xE7, 0x69, 0xA5, 0xCF, 0xBE, 0x92, 0x0D, 0xCD, 0x58, 0x0C, 0x1E, 0xB3, 0xFF,
+    0x85, 0x2C, 0xCE, 0x0D, 0x2F, 0xD9, 0xF2, 0x65, 0x8A, 0xDF, 0x5B, 0x66, 0xB8, 0x34, 0x58, 0xC2,
+    0x75, 0x18, 0xBC, 0x6E, 0x55, 0x37, 0x38, 0x7A, 0xF0, 0x1B, 0x43, 0x4B, 0xBB, 0xA5, 0x59, 0x26,
+    0x5F, 0x1A, 0x92, 0x8D, 0xBD, 0xC5, 0x7C, 0x91, 0xA3, 0xAB, 0x57, 0xBE, 0xC2, 0x43, 0x89, 0xFA,
+    0xF7, 0xB2, 0x25, 0x2E, 0xBD, 0x79, 0xAD, 0x9F, 0x88, 0x34, 0xB1, 0x88, 0x0C, 0x15, 0xCD, 0x20,
+    0xFE, 0x07, 0xA0, 0x08, 0x83, 0xC1, 0xBF, 0x18, 0xC4, 0x2B, 0xB2, 0xC4, 0xAB, 0xCE, 0x38, 0xD2,
+    0xAA, 0xE7, 0xBE, 0xA8, 0x42, 0xF9, 0xAF, 0xEE, 0x75, 0x6D, 0x20, 0xC9, 0xC0, 0xEA, 0xC0, 0xCF,
+    0xA9, 0x30, 0xD4, 0x96, 0x54, 0x83, 0x6D, 0xF4, 0xD4, 0xD2, 0xA2, 0x16, 0x06, 0x56, 0x4F, 0xBB,
+    0xA1, 0x51, 0xE9, 0xAD, 0x1C, 0x2C, 0x73, 0xC4, 0xCB, 0x1C, 0x2B, 0xCB, 0x1C, 0xB3, 0x1B, 0x72,
+    0xB5, 0x5A, 0xE1, 0x7C, 0xD4, 0x24, 0xB7, 0xA2, 0xBB, 0x24, 0x66, 0xA3, 0xD9, 0xCE, 0xF4, 0x6C,
+    0xD9, 0x97, 0xF3, 0x63, 0xEB, 0xE4, 0x77, 0x9C, 0xEB, 0x93, 0xF9, 0x64, 0xFE, 0xA9, 0xD4, 0xFC,
+    0xD8, 0x66, 0x39, 0x7F, 0xF0, 0x87, 0xBB, 0x4E, 0xC0, 0xAD, 0x92, 0x2E, 0x16, 0x79, 0x4E, 0xC4,
+    0xB5, 0x71, 0xBB, 0x73, 0x68, 0xA0, 0xAB, 0x03, 0x8B, 0x39, 0x78, 0x26, 0xAB, 0xB0, 0xEB, 0x3D,
+    0xB9, 0x3E, 0x78, 0x47, 0x43, 0x09, 0x5B, 0x30, 0x81, 0x2D, 0xD8, 0xD8, 0x4D, 0x5F, 0x81, 0x14,
+    0x0C, 0x24, 0x15, 0xDA, 0xDD, 0xBE, 0x44, 0x07, 0x97, 0x8F, 0x43, 0x10, 0x07, 0x74, 0x20, 0xEA,
+    0x51, 0x73, 0x98, 0x40, 0x09, 0x07, 0xF7, 0xD6, 0x2D, 0xB3, 0x39, 0x9B, 0x13, 0xE9, 0x92, 0xB7,
+    0x7D, 0xEA, 0x37, 0xA1, 0x48, 0xFC, 0x20, 0x8C, 0x66, 0xB1, 0x1B, 0xB8, 0xFB, 0xF5, 0xD8, 0x91,
+    0x56, 0x63, 0x92, 0x46, 0xBB, 0xA8, 0x63, 0x95, 0x75, 0xB4, 0x4B, 0x2A, 0x56, 0x09, 0x68, 0x67,
+    0x18, 0xE8, 0xF3, 0xF2, 0x15, 0x43, 0xD9, 0xD4, 0x31, 0x8F, 0x7A, 0x4C, 0x93, 0x3A, 0x36, 0x39,
+    0xBD, 0xD4, 0xB7, 0x24, 0x3E, 0x15, 0xBB, 0x69, 0x44, 0x12, 0xBF, 0x73, 0xA8, 0x5B, 0x87, 0xE4,
+    0xA2, 0x87, 0xF1, 0x18, 0xE2, 0x8B, 0x0E, 0xEA, 0x31, 0xA4, 0xCF, 0x39, 0xE2, 0xB0, 0x8A, 0xEA,
+    0xB5, 0x63, 0x83, 0x55, 0x4C, 0xA5, 0x9D, 0x0A, 0xAC, 0x72, 0x0A, 0xED, 0xF6, 0xF7, 0xED, 0x28,
+    0xF7, 0x92, 0x34, 0x3A, 0xB0, 0x60, 0x42, 0xE2, 0x75, 0xE0, 0x28, 0x07, 0x60, 0x3A, 0x9D, 0xFE,
+    0x4F, 0x22, 0xF2, 0x7F, 0x8C, 0x46, 0x1B, 0xC3, 0xC2, 0x58, 0x4A, 0xA0, 0x4B, 0x8D, 0x70, 0xB4,
+    0x4C, 0xE9, 0x6F, 0x4B, 0x49, 0xED, 0xAE, 0xA5, 0x97, 0x89, 0x2C, 0xEC, 0x9F, 0x4D, 0xC4, 0x9F,
+    0xC9, 0x24, 0x9C, 0xC9, 0xA4, 0x3B, 0x93, 0x49, 0xFF, 0x19, 0xD0, 0x9D, 0xC9, 0xA4, 0x3D, 0x93,
+    0x49, 0x73, 0x26, 0x93, 0xEA, 0xCC, 0xC9, 0xD3, 0x9C, 0x39, 0xC9, 0x17, 0x82, 0x07, 0xEE, 0x05,
+    0x9E, 0x9A, 0xFE, 0x50, 0x8B, 0xF4, 0x46, 0x76, 0xC6, 0x99, 0xB4, 0x27, 0x4B, 0x69, 0x4F, 0x4E,
+    0xEE, 0x02, 0xE5, 0x12, 0x52, 0x69, 0x4F, 0x26, 0x22, 0x3D, 0x33, 0xE9, 0x9F, 0x9A, 0xBE, 0xC0,
+    0x44, 0xA4, 0xFA, 0xB3, 0x89, 0x34, 0x67, 0x4A, 0x69, 0xCF, 0x94, 0xD2, 0x9D, 0x29, 0xA5, 0xFF,
+    0x0C, 0x68, 0xCF, 0x94, 0x12, 0x26, 0x22, 0x6E, 0x22, 0x3B, 0xEC, 0xBA, 0xAC, 0xA7, 0xC3, 0x4B,
+    0x60, 0x88, 0xCF, 0x86, 0x3F, 0x99, 0x5D, 0x93, 0xFF, 0x38, 0x93, 0xBF, 0xA7, 0x74, 0x24, 0x5B,
+    0xA8, 0x0F, 0x5B, 0x4A, 0xE3, 0x12, 0xBF, 0xC1, 0xBD, 0x91, 0x25, 0xF6, 0xB3, 0x24, 0xE4, 0xFB,
+    0x97, 0x94, 0xB2, 0x85, 0x0E, 0x19, 0xAD, 0xB1, 0x4F, 0xEB, 0xEA, 0x8B, 0x21, 0xB3, 0x5F, 0xDD,
+    0xF1, 0x79, 0x88, 0xF5, 0xE7, 0xEB, 0xDC, 0xF2, 0x48, 0xED, 0xB0, 0x56, 0x80, 0xC0, 0x9F, 0x99,
+    0x43, 0x57, 0x17, 0xB2, 0xF8, 0x8E, 0x2C, 0xCE, 0xEA, 0x1E, 0xFE, 0xF7, 0x86, 0x34, 0xB5, 0x3A,
+    0xF4, 0x6C, 0xC6, 0xCD, 0x20, 0xE2, 0xAA, 0x36, 0x7A, 0xB7, 0x31, 0x99, 0x3D, 0x7F, 0x54, 0x7B,
+    0x52, 0x38, 0x8F, 0x76, 0xA4, 0xD0, 0x12, 0x3B, 0x56, 0x20, 0x10, 0x3B, 0x72, 0x08, 0x24, 0x15,
+    0xAB, 0xA8, 0x80, 0xB1, 0xEB, 0xAB, 0xD1, 0x8D, 0x26, 0xF6, 0x83, 0xBE, 0x0F, 0xA2, 0xE7, 0x44,
+    0x2E, 0xA3, 0x2E, 0x35, 0x87, 0x64, 0xE7, 0x9F, 0x7F, 0xE8, 0x51, 0x22, 0xE1, 0xDB, 0xA0, 0x9E,
+    0x3A, 0x0B, 0xEA, 0x31, 0x88, 0xA5, 0x23, 0x6A, 0x0F, 0xB5, 0xBC, 0x4A, 0xE4, 0x4F, 0x40, 0xA2,
+    0x2B, 0x58, 0x3D, 0x02, 0x58, 0x54, 0x05, 0x91, 0x43, 0x7F, 0xCD, 0x35, 0xFA, 0xAD, 0xED, 0x86,
+    0x7F, 0x7C, 0xA3, 0xA2, 0x5C, 0xC0, 0xE0, 0xA9, 0xBF, 0x78, 0xF0, 0xE5, 0xC5, 0x8B, 0x94, 0x73,
+    0xB8, 0xF1, 0x9E, 0xD5, 0x3F, 0xBD, 0xE8, 0xE3, 0x67, 0x2F, 0x04, 0x15, 0xB9, 0x81, 0xB3, 0xDF,
+    0x63, 0x1D, 0x3D, 0xBA, 0x5B, 0x5A, 0x0D, 0x3F, 0x6D, 0x7E, 0x53, 0x3D, 0x6C, 0x70, 0x3B, 0xC7,
+    0xB6, 0x77, 0x8C, 0xA1, 0xAC, 0x48, 0x3C, 0x9C, 0x26, 0x8C, 0xD3, 0xD8, 0x15, 0xE6, 0xB9, 0xA6,
+    0x8B, 0x2F, 0x84, 0x71, 0x4A, 0x9B, 0x9B, 0x47, 0x7C, 0x1A, 0x5F, 0x68, 0x9E, 0xD6, 0x2E, 0xAC,
+    0x1A, 0x9E, 0xBE, 0x3F, 0x7E, 0xC6, 0x1F, 0x8A, 0xAA, 0x73, 0x7B, 0xD8, 0x3B, 0x6A, 0x01, 0x4A,
+    0x7B, 0x6B, 0x8F, 0xE0, 0xCF, 0x3E, 0x72, 0x20, 0xB9, 0x18, 0x80, 0xF9, 0x06, 0x90, 0xBC, 0x69,
+    0x81, 0x23, 0x3F, 0x33, 0xCB, 0xC0, 0x43, 0x0E, 0x55, 0xB4, 0xB7, 0xB9, 0xBD, 0xE9, 0x06, 0x58,
+    0x9F, 0x00, 0xC9, 0xA5, 0xE6, 0xD6, 0x3E, 0x92, 0xCF, 0x3A, 0x2C, 0xBB, 0xA6, 0x61, 0xDD, 0xDD,
+    0xF2, 0x73, 0xFC, 0x9C, 0xF5, 0xE9, 0x81, 0x7A, 0x02, 0x98, 0x77, 0x02, 0xD0, 0x1F, 0x1D, 0xF6,
+    0xA1, 0x14, 0x93, 0x8D, 0xA3, 0xB7, 0x3D, 0x78, 0xA0, 0x98, 0x14, 0x07, 0x06, 0x74, 0xDD, 0x2F,
+    0x35, 0x91, 0x87, 0x3E, 0xA3, 0xFC, 0x83, 0xA0, 0xBE, 0x1E, 0x06, 0x4F, 0xBE, 0x45, 0xB1, 0xF4,
+    0x22, 0xBE, 0xCB, 0x71, 0x60, 0x4F, 0x3B, 0xBD, 0x2C, 0xF4, 0xC0, 0x5E, 0xEF, 0xA3, 0x86, 0x25,
+    0x9D, 0xCB, 0xA3, 0xC6, 0xD8, 0xA4, 0x59, 0x89, 0x7A, 0xB6, 0xA2, 0x26, 0xAD, 0xA2, 0x6A, 0x85,
+    0x73, 0xFB, 0x1F, 0x20, 0x6A, 0xE0, 0xA9, 0xE9, 0x6C, 0x3A, 0xFD, 0xAE, 0x88, 0x48, 0x3F, 0x9D,
+    0xCE, 0xA6, 0xD3, 0xEA, 0xCE, 0x07, 0x94, 0x5D, 0xE1, 0x34, 0x1B, 0x51, 0x93, 0xD9, 0xA4, 0x59,
+    0xD1, 0x1D, 0x79, 0xD4, 0xA4, 0xFB, 0x1F, 0x80, 0xDF, 0x02, 0x8E, 0x6C, 0x2E, 0xB6, 0x1E, 0x00,
+    0x18, 0x2F, 0x16, 0x63, 0x80, 0xA3, 0x5B, 0x8B, 0xCD, 0xA3, 0x6C, 0x2E, 0x16, 0x0F, 0xC1, 0xE6,
+    0x62, 0xF1, 0x55, 0x8E, 0x6E, 0x2E, 0xB6, 0x8E, 0xF2, 0xC0, 0xD6, 0x62, 0xF3, 0x28, 0xFB, 0x24,
+    0xA6, 0x9F, 0x43, 0xDA, 0xFA, 0xCD, 0xE1, 0xFC, 0xA2, 0x39, 0xCA, 0x3E, 0xEB, 0x4C, 0x88, 0xBD,
+    0x76, 0x5F, 0xE4, 0xF9, 0xA8, 0x02, 0x65, 0xB5, 0x8B, 0xBD, 0x09, 0x59, 0x57, 0xF6, 0x5F, 0x2C,
+    0x47, 0x54, 0x25, 0xCD, 0x43, 0x27, 0x1F, 0x3A, 0x99, 0x34, 0x5F, 0xAC, 0x16, 0x98, 0x54, 0x3F,
+    0x5F, 0xCF, 0xA3, 0x0E, 0x09, 0x2B, 0xC9, 0xB6, 0x5B, 0x1D, 0x47, 0xEF, 0x54, 0x2B, 0x4F, 0xAB,
+    0x0F, 0xAA, 0xFB, 0xC7, 0xD1, 0x25, 0x97, 0x17, 0xF1, 0x05, 0x69, 0xE3, 0x39, 0xA0, 0xDE, 0xE2,
+    0x5F, 0xBF, 0xF3, 0x87, 0x7F, 0xFA, 0xCE, 0x1F, 0x9E, 0xA9, 0x38, 0x8C, 0x0E, 0xCC, 0xB8, 0x27,
+    0xE8, 0x37, 0x78, 0x35, 0xDC, 0x6F, 0xB4, 0x0B, 0x5B, 0x2F, 0xBF, 0x24, 0x82, 0x81, 0x80, 0xE1,
+    0xF0, 0xF4, 0x61, 0xE9, 0x4E, 0x11, 0x39, 0x4E, 0xA2, 0xC5, 0xAF, 0xCC, 0x2A, 0xC6, 0x68, 0x4F,
+    0x7E, 0x44, 0x6F, 0x5F, 0xE9, 0x86, 0x4D, 0xC7, 0x33, 0x3B, 0xE9, 0x8C, 0x8D, 0x3C, 0xAB, 0xC4,
+    0x2F, 0xB7, 0x93, 0xEF, 0x5F, 0x74, 0x2B, 0x4F, 0xAB, 0x4B, 0xEE, 0xFE, 0x5C, 0xFB, 0x1B, 0xBD,
+    0x5E, 0x00, 0x0F, 0x4E, 0xFF, 0x52, 0xE6, 0x68, 0xC7, 0xD3, 0x18, 0x54, 0x20, 0x47, 0x3B, 0x5E,
+    0xC5, 0x10, 0x35, 0xAC, 0x12, 0x57, 0x44, 0x3B, 0x48, 0x9B, 0xEB, 0x6D, 0xB7, 0xBA, 0x12, 0xBB,
+    0x45, 0x88, 0x17, 0xEA, 0x7A, 0xB7, 0xAA, 0xDF, 0xA9, 0x4E, 0xAD, 0xEA, 0xB7, 0x6E, 0xF4, 0xC9,
+    0x02, 0x38, 0xD4, 0x29, 0x69, 0x57, 0xE3, 0x8B, 0xD5, 0xA9, 0xA7, 0xD5, 0x07, 0xD5, 0x4A, 0xF1,
+    0xF8, 0x4F, 0xE4, 0xFF, 0x56, 0xFF, 0xC2, 0xB3, 0x4A, 0xF2, 0xCC, 0x4B, 0x21, 0x6D, 0x01, 0x85,
+    0xAE, 0x74, 0xA5, 0x2B, 0x91, 0x6F, 0xFD, 0x58, 0x57, 0xBA, 0x8A, 0x2C, 0x88, 0x8C, 0x46, 0xD3,
+    0xA9, 0x2C, 0x60, 0x34, 0x12, 0x01, 0x65, 0x1F, 0x32, 0xAA, 0x39, 0xA9, 0xDD, 0xAA, 0xAE, 0x1E,
+    0xD2, 0xD5, 0xAA, 0x76, 0xA7, 0x68, 0x12, 0x56, 0xE1, 0xB4, 0x51, 0x7E, 0x35, 0x51, 0xFE, 0x21,
+    0xA3, 0x5D, 0xF3, 0xD0, 0x89, 0x44, 0xBF, 0xF6, 0x66, 0x03, 0xFF, 0x7A, 0x11, 0x5F, 0x3F, 0x3F,
+    0x8E, 0x2E, 0xDA, 0xFB, 0xCE, 0xA8, 0x5B, 0xC1, 0x6B, 0xDC, 0xFB, 0x45, 0x06, 0xFA, 0xDC, 0xAC,
+    0xB8, 0xF9, 0x28, 0xC1, 0xEC, 0xFB, 0x1D, 0xEA, 0x8C, 0xBC, 0x55, 0xD5, 0x18, 0xB4, 0x8B, 0xBC,
+    0x0A, 0x7B, 0xA7, 0xC8, 0x44, 0x5C, 0xB2, 0xA3, 0xA5, 0x7D, 0x20, 0x76, 0xAC, 0x12, 0xBB, 0xFF,
+    0x2C, 0x24, 0x73, 0x54, 0xBF, 0x54, 0xEF, 0xBE, 0xBE, 0x3B, 0xDC, 0xFF, 0xFF, 0x94, 0x7D, 0xCE,
+    0x94, 0xA9, 0x17, 0xB9, 0xD1, 0xA1, 0x1D, 0x27, 0xA3, 0xD9, 0x85, 0xEB, 0x7F, 0xBC, 0x1A, 0x6D,
+    0x57, 0xAB, 0xF9, 0x13, 0x6E, 0xF6, 0x5F, 0x1F, 0xBA, 0x9C, 0xBC, 0xF4, 0xBC, 0xFD, 0xEF, 0xDC,
+    0x3D, 0x22, 0x9B, 0xA3, 0x27, 0x50, 0x9E, 0xE2, 0x9B, 0x0F, 0x4B, 0x75, 0xE8, 0x72, 0x74, 0x23,
+    0x3C, 0xAD, 0xDF, 0xE0, 0x64, 0x50, 0xEF, 0x71, 0x22, 0xA8, 0x77, 0xEC, 0x6A, 0xF1, 0x84, 0x9D,
+    0x54, 0x0F, 0xA8, 0x67, 0xDD, 0x43, 0xC6, 0xF0, 0x4F, 0x9C, 0x6A, 0x49, 0xAD, 0xFE, 0x5F, 0x08,
+    0xE1, 0xA4, 0x7E, 0xDE, 0x9E, 0x38, 0xF4, 0x77, 0xD1, 0x95, 0x76, 0x90, 0xC3, 0xD4, 0x25, 0x59,
+    0xAC, 0xF2, 0x96, 0x3B, 0x69, 0x1E, 0xAF, 0x32, 0xFF, 0xDB, 0xC4, 0x96, 0x33, 0xC4, 0x96, 0x3F,
+    0x7D, 0x31, 0xFE, 0x51, 0x37, 0xD6, 0x77, 0xAC, 0x9B, 0x8B, 0xDC, 0xF7, 0xDB, 0x9C, 0x20, 0xB6,
+    0xCA, 0x73, 0xE6, 0xD0, 0x89, 0xF8, 0xF9, 0xAF, 0x3F, 0xF3, 0x4E, 0xF5, 0xE7, 0x2E, 0x7D, 0x35,
+    0xFE, 0xC6, 0xC3, 0x3E, 0x9C, 0x31, 0xF7, 0xA9, 0xE6, 0x77, 0xDE, 0xF9, 0xC3, 0x3F, 0x1D, 0x7E,
+    0xEE, 0x77, 0xCE, 0x1F, 0x3E, 0xFB, 0xE7, 0x2F, 0xFF, 0x9B, 0x6E, 0xAC, 0xFD, 0xC9, 0x33, 0xDA,
+    0xDD, 0x77, 0x46, 0x57, 0x9F, 0x82, 0x7F, 0x15, 0x55, 0xF7, 0xFD, 0xCE, 0xDF, 0x7C, 0x46, 0x5D,
+    0xBF, 0xF3, 0x37, 0xF1, 0x8F, 0xDA, 0xB1, 0xBE, 0x68, 0x4F, 0x9C, 0xE1, 0x03, 0x7B, 0xCF, 0x19,
+    0xF5, 0x81, 0x3B, 0xB9, 0xF1, 0xF8, 0xF3, 0x6B, 0xFE, 0xCC, 0x5E, 0x3B, 0x0F, 0xFD, 0x7D, 0xF2,
+    0xD2, 0x73, 0x15, 0x01, 0xE3, 0x59, 0xB3, 0x04, 0xEE, 0xFB, 0xFD, 0x27, 0x92, 0x05, 0x5F, 0xE2,
+    0xF7, 0xA2, 0x1B, 0xC7, 0xFF, 0xEE, 0x04, 0x67, 0x94, 0x8F, 0xED, 0x09, 0x7E, 0x8F, 0xEB, 0x6A,
+    0x3E, 0x18, 0x7A, 0x2B, 0x44, 0x48, 0xFC, 0xD1, 0x5D, 0x1B, 0x9D, 0x71, 0x50, 0x30, 0x7D, 0xB1,
+    0xD3, 0x72, 0xB3, 0x31, 0xDF, 0x7B, 0xD4, 0xE5, 0x64, 0xB4, 0x94, 0xDA, 0x33, 0x79, 0x79, 0x5A,
+    0x4D, 0x44, 0x38, 0xB8, 0xF3, 0xD8, 0xA7, 0x34, 0xF4, 0xD2, 0x61, 0x64, 0x10, 0x21, 0x95, 0x6F,
+    0x88, 0x2E, 0x78, 0xE2, 0xAB, 0x9E, 0x89, 0xF4, 0x91, 0xBC, 0xDB, 0x25, 0x37, 0x1F, 0x39, 0x9B,
+    0xBE, 0x1E, 0xDB, 0xD2, 0x24, 0x14, 0xC6, 0xB0, 0x7E, 0xBF, 0x61, 0x7C, 0xE2, 0x1E, 0xEA, 0x93,
+    0x27, 0x18, 0xAF, 0x9E, 0x64, 0xBC, 0xBA, 0x4A, 0xFE, 0xF4, 0x2A, 0xE5, 0x99, 0x87, 0xC8, 0xC2,
+    0x19, 0x4C, 0x78, 0x85, 0x78, 0x27, 0xFC, 0x91, 0x12, 0x69, 0xD5, 0x35, 0x69, 0xA2, 0x0B, 0x1E,
+    0xFD, 0x9A, 0x23, 0x7A, 0x76, 0xC9, 0x69, 0xAE, 0x2D, 0x6C, 0x22, 0x62, 0xC5, 0xFE, 0x71, 0xD2,
+    0x40, 0xB9, 0xBF, 0xE9, 0xD0, 0x1E, 0x3E, 0xFE, 0x8E, 0x2B, 0x24, 0x45, 0xFE, 0xD9, 0x58, 0x07,
+    0xD5, 0x9A, 0x4A, 0xFB, 0x1C, 0x53, 0x0D, 0xB6, 0xBE, 0x0D, 0x63, 0x99, 0xE7, 0x30, 0x6F, 0x8F,
+    0xAA, 0x61, 0xB7, 0x6C, 0xC5, 0x41, 0xD0, 0x22, 0xC1, 0x0C, 0xDE, 0xC0, 0x9F, 0xF1, 0x0D, 0x0A,
+    0x63, 0xA1, 0x94, 0x05, 0x22, 0xDD, 0xBE, 0xBB, 0xC7, 0x17, 0x3F, 0x64, 0x26, 0x0D, 0xE9, 0xED,
+    0x0F, 0x2F, 0x37, 0x61, 0x34, 0x64, 0xD2, 0x33, 0xB1, 0x67, 0xA8, 0x97, 0x42, 0x74, 0x7B, 0x0B,
+    0x32, 0x11, 0x5B, 0x8A, 0x58, 0xB5, 0x4C, 0x7F, 0x70, 0x31, 0xA5, 0x14, 0xB1, 0xC7, 0x76, 0x46,
+    0xD0, 0x2E, 0x25, 0xDE, 0x06, 0xD2, 0x1F, 0x8F, 0x1E, 0xDB, 0xA7, 0x75, 0x18, 0xC4, 0xAC, 0x41,
+    0x2B, 0x13, 0x00, 0xE2, 0x8A, 0x3F, 0xCA, 0x2E, 0x17, 0x8B, 0xAF, 0x7D, 0x2C, 0x3B, 0x22, 0x7F,
+    0xB1, 0xF8, 0x96, 0xFC, 0x78, 0xB2, 0xE6, 0x74, 0x4F, 0xB1, 0x45, 0xE2, 0x59, 0xB4, 0x64, 0x44,
+    0x37, 0x1D, 0x83, 0xFF, 0x62, 0x20, 0xAB, 0xC9, 0x1C, 0x5B, 0x01, 0x21, 0xBA, 0xE9, 0x92, 0x9E,
+    0xE4, 0x1A, 0x45, 0x20, 0xAB, 0xD5, 0x55, 0xC7, 0x56, 0x30, 0x19, 0xD1, 0x4D, 0xF7, 0x74, 0x4D,
+    0x72, 0x4D, 0xBF, 0x16, 0xC8, 0x6E, 0xAB, 0xEA, 0x16, 0x73, 0x19, 0x37, 0x04, 0xD5, 0xB3, 0xCA,
+    0xC4, 0x1A, 0xD2, 0xA0, 0x5D, 0xBC, 0x49, 0x50, 0x57, 0xAB, 0x55, 0xD6, 0x83, 0x51, 0xB3, 0xAD,
+    0x97, 0xFE, 0x6E, 0x26, 0x22, 0xFF, 0xFC, 0xFA, 0xF5, 0x75, 0x3B, 0x2E, 0x8C, 0x5A, 0x7B, 0xFC,
+    0x9D, 0xBF, 0x9D, 0x89, 0xC8, 0x7F, 0x73, 0x63, 0xB6, 0x55, 0x8D, 0xE3, 0x37, 0x48, 0xF9, 0xC4,
+    0xC5, 0x2E, 0x0B, 0x2A, 0xE8, 0x9E, 0x31, 0x42, 0x4A, 0xE6, 0x62, 0xA7, 0x03, 0xB3, 0x1D, 0x40,
+    0xC4, 0xC3, 0x7C, 0xAD, 0x85, 0x5E, 0xF5, 0xD0, 0xB3, 0xB9, 0xDC, 0x08, 0xDD, 0x93, 0x27, 0xF4,
+    0xE4, 0x86, 0x9E, 0x3A, 0xA5, 0x57, 0x73, 0xE9, 0xE7, 0x6B, 0x1F, 0x49, 0x2F, 0xE2, 0x52, 0x64,
+    0x67, 0xD8, 0x91, 0xFE, 0xD9, 0x81, 0xED, 0xC1, 0x2C, 0x7A, 0x18, 0xB4, 0x77, 0x47, 0x26, 0x3B,
+    0x40, 0x22, 0x73, 0x60, 0xF3, 0xF1, 0x00, 0x89, 0x4B, 0x2B, 0xA8, 0xE9, 0x21, 0x71, 0x89, 0x5B,
+    0x6B, 0x6A, 0xEA, 0x54, 0x5E, 0x77, 0xC9, 0xF6, 0xE5, 0x33, 0x35, 0xDD, 0x98, 0xC4, 0x65, 0xB1,
+    0x63, 0x26, 0x7E, 0x83, 0x44, 0x5A, 0xDD, 0xB1, 0xB9, 0x86, 0x69, 0x13, 0xD7, 0x91, 0x85, 0x3A,
+    0x71, 0x94, 0x7F, 0xE1, 0x0A, 0xE8, 0xEB, 0x28, 0x10, 0xBF, 0xEE, 0x52, 0xCB, 0xB8, 0xA6, 0x3F,
+    0x6B, 0x5E, 0x77, 0xF1, 0xBB, 0xD2, 0xD6, 0x14, 0x93, 0xF9, 0x20, 0xD9, 0x8E, 0xA9, 0x19, 0xAF,
+    0x32, 0x67, 0xBC, 0xCA, 0x82, 0xF3, 0x39, 0x42, 0xBB, 0xA2, 0xAE, 0xD1, 0xAE, 0x44, 0xEF, 0x11,
+    0xD2, 0xE8, 0xDD, 0x87, 0x83, 0xD1, 0x17, 0x9F, 0x09, 0x46, 0x5F, 0x7C, 0xB6, 0x59, 0x7B, 0xE9,
+    0xEA, 0xD5, 0x6E, 0x26, 0x22, 0xF3, 0xE3, 0xEF, 0xFD, 0xD5, 0x07, 0x7F, 0x1B, 0xBF, 0xFE, 0xB5,
+    0xB7, 0x9D, 0x7E, 0x43, 0x5D, 0x72, 0xFA, 0x0D, 0x3E, 0xA8, 0xF4, 0xFF, 0xC3, 0x27, 0x36, 0xFA,
+    0x07, 0x6E, 0x5A, 0x35, 0x67, 0x86, 0xEA, 0x99, 0x41, 0xCF, 0x04, 0x7A, 0x0A, 0x26, 0x72, 0x8E,
+    0x0D, 0x91, 0x56, 0xDD, 0x74, 0x71, 0x1B, 0x5F, 0x43, 0x87, 0xB4, 0x26, 0x76, 0x1B, 0xE1, 0xAB,
+    0xE6, 0xE1, 0x9B, 0x2E, 0xE4, 0xF1, 0x35, 0xED, 0xDA, 0xB4, 0x36, 0xDA, 0x6F, 0x84, 0xD5, 0x9F,
+    0x99, 0xF4, 0x42, 0x56, 0x1B, 0xB8, 0x11, 0x56, 0x89, 0xDF, 0x75, 0x81, 0x59, 0xA6, 0x45, 0x42,
+    0x6D, 0x64, 0xBE, 0x9F, 0x8F, 0x37, 0x96, 0x07, 0x5F, 0xDA, 0x21, 0x15, 0xA9, 0xD4, 0x68, 0xC3,
+    0x82, 0xB1, 0x6A, 0xEB, 0x11, 0xAF, 0xA5, 0x6F, 0xF5, 0xFC, 0xF1, 0xB9, 0xEA, 0x98, 0xD8, 0x9E,
+    0xC4, 0x17, 0xA8, 0x36, 0xB5, 0xE4, 0xB1, 0xC7, 0x3C, 0xDC, 0xA2, 0xFD, 0x3A, 0xB4, 0xC6, 0x92,
+    0xEB, 0x40, 0x6A, 0x6B, 0x8C, 0x37, 0x3E, 0x69, 0x95, 0xC8, 0x3A, 0xA9, 0x7C, 0xC3, 0xB2, 0xCB,
+    0x58, 0x8F, 0x46, 0x23, 0x66, 0x22, 0xFE, 0x2B, 0xD3, 0xE9, 0xB9, 0x5D, 0x6C, 0x00, 0x33, 0x09,
+    0xC8, 0xC3, 0xE7, 0xD9, 0xDA, 0xB5, 0xF7, 0x2F, 0xB9, 0xE4, 0x2F, 0xBF, 0x3F, 0x22, 0x15, 0x69,
+    0xA2, 0xD9, 0xF4, 0x05, 0x52, 0x3B, 0x68, 0x04, 0x52, 0x11, 0x17, 0x8B, 0x34, 0x18, 0xB7, 0x14,
+    0x50, 0x8A, 0xDD, 0x4D, 0x4D, 0x0B, 0xBE, 0x8A, 0x91, 0xC5, 0xD2, 0xC5, 0xF3, 0x34, 0xDA, 0x93,
+    0xD1, 0x92, 0xD9, 0x9C, 0xD4, 0x1A, 0x6B, 0x2A, 0xED, 0x8D, 0xA3, 0x4D, 0x1C, 0x79, 0xE2, 0x31,
+    0x5F, 0xF7, 0xE8, 0xB7, 0x1B, 0xBE, 0x22, 0x37, 0xA6, 0x89, 0x88, 0xB8, 0x27, 0x6E, 0xFE, 0xD8,
+    0xEA, 0xD0, 0x41, 0x9B, 0x5A, 0xF2, 0x28, 0x60, 0x6C, 0x89, 0xF6, 0xB1, 0xA7, 0xA5, 0x26, 0xC7,
+    0x38, 0x63, 0x55, 0xA7, 0x3D, 0x99, 0x9D, 0x88, 0x48, 0x2A, 0x22, 0x17, 0x46, 0x93, 0xD1, 0xE9,
+    0x7D, 0xFB, 0x75, 0xBF, 0x0A, 0xC5, 0x04, 0xCC, 0x62, 0xF0, 0x7F, 0xD6, 0x3D, 0xC4, 0x8B, 0x83,
+    0x98, 0xF7, 0xBE, 0xEB, 0xF4, 0xB6, 0x38, 0x10, 0x0B, 0x33, 0x50, 0x52, 0x11, 0xDD, 0x6C, 0xA0,
+    0xED, 0xE0, 0xC8, 0x6D, 0x7B, 0x7E, 0x87, 0xE3, 0xB8, 0x74, 0x4B, 0x85, 0x65, 0x05, 0x9C, 0xB2,
+    0x6B, 0x61, 0xDF, 0x4E, 0xFA, 0x7C, 0x90, 0x0A, 0xC7, 0x83, 0xEA, 0xB0, 0x1E, 0xF6, 0x78, 0x75,
+    0x83, 0xD0, 0xD1, 0x0D, 0x32, 0x50, 0x4B, 0x6A, 0x41, 0x05, 0xD2, 0x41, 0x8C, 0xCB, 0x78, 0xCA,
+    0xEA, 0x86, 0x32, 0x92, 0xA0, 0x3D, 0x45, 0xF2, 0x1F, 0xFB, 0xD8, 0x51, 0x1B, 0x3B, 0x8E, 0x9D,
+    0xEA, 0x32, 0xC6, 0x89, 0x8B, 0x43, 0xC1, 0xD8, 0x54, 0x99, 0xCB, 0xA9, 0xCD, 0xBF, 0x13, 0x36,
+    0xA2, 0x36, 0x95, 0x8E, 0x89, 0x34, 0xD9, 0xC2, 0x32, 0x1B, 0xB6, 0x69, 0x74, 0x47, 0xF6, 0x6D,
+    0x0F, 0x5D, 0x5A, 0x02, 0x96, 0x42, 0x62, 0xD4, 0xDC, 0x12, 0xE0, 0xF6, 0xE1, 0x51, 0x26, 0x1E,
+    0xA4, 0x25, 0x0A, 0x3D, 0xDA, 0x8F, 0x6F, 0x41, 0x73, 0x9E, 0x28, 0xB4, 0xA8, 0x10, 0xE0, 0x7A,
+    0x03, 0x37, 0xFD, 0xE0, 0x97, 0x50, 0x82, 0x2D, 0xC1, 0x4D, 0x6C, 0x14, 0xC4, 0xE9, 0x7F, 0xFC,
+    0xC0, 0x19, 0xD9, 0x6E, 0xD2, 0xF2, 0xD9, 0x50, 0x18, 0xDA, 0xF1, 0x97, 0xE8, 0x96, 0x3E, 0xC0,
+    0xE3, 0x7D, 0xD0, 0xC1, 0x2C, 0xC0, 0xA4, 0xD2, 0x72, 0x79, 0xC0, 0x3F, 0xF9, 0x37, 0xE7, 0x18,
+    0x9B, 0xBA, 0xEF, 0xDC, 0x78, 0xE9, 0xC6, 0x9A, 0x88, 0xF8, 0x1C, 0x53, 0x19, 0xAB, 0x9B, 0xEF,
+    0x5C, 0x99, 0xDE, 0xC8, 0x86, 0x84, 0x12, 0x63, 0x27, 0x56, 0x8B, 0x58, 0x64, 0x71, 0xE7, 0x86,
+    0xC7, 0x3B, 0x77, 0x40, 0x2E, 0x8F, 0x55, 0x20, 0x93, 0xCB, 0x24, 0x22, 0x1D, 0xF2, 0x83, 0xE3,
+    0xCE, 0x34, 0xAB, 0xB0, 0x45, 0x40, 0x07, 0xED, 0xC8, 0xAC, 0x81, 0x9E, 0x55, 0x74, 0x43, 0xC0,
+    0x54, 0xDA, 0x51, 0x60, 0x24, 0x74, 0x94, 0xB2, 0xDD, 0x70, 0x7D, 0xCD, 0x38, 0xED, 0xEA, 0x0C,
+    0x13, 0x85, 0x0D, 0x56, 0x13, 0x37, 0x27, 0x64, 0x6A, 0xAE, 0x5D, 0x1D, 0x2D, 0x9E, 0x38, 0x14,
+    0x94, 0x88, 0x38, 0x66, 0xB2, 0xB3, 0xC4, 0xD6, 0x86, 0xA5, 0x28, 0x1D, 0xB5, 0x40, 0x59, 0x2D,
+    0x6D, 0xC9, 0x33, 0x0F, 0x66, 0x02, 0xEA, 0xC3, 0x00, 0xA5, 0xB1, 0x68, 0xDF, 0x33, 0x13, 0x91,
+    0x77, 0x45, 0x64, 0x4E, 0xAB, 0x03, 0x19, 0xA9, 0xDD, 0x4B, 0x49, 0x1C, 0xEB, 0x74, 0xE8, 0x26,
+    0xB5, 0x64, 0x51, 0x18, 0x5C, 0xE5, 0xCC, 0x45, 0x3F, 0x98, 0x9F, 0x87, 0x19, 0x53, 0xB3, 0x05,
+    0xB1, 0x88, 0xD7, 0x97, 0x8F, 0x87, 0x65, 0x7D, 0xDD, 0x00, 0xAA, 0x9D, 0x89, 0x2C, 0x66, 0x22,
+    0x0B, 0x94, 0x58, 0xB2, 0x96, 0x68, 0x61, 0x77, 0x77, 0xE7, 0x2F, 0xD2, 0x7D, 0xFB, 0xE8, 0xD3,
+    0x0A, 0xCC, 0x65, 0x75, 0x3E, 0x16, 0xE9, 0x98, 0x89, 0x5F, 0x7E, 0xD7, 0x07, 0x48, 0x2C, 0xAC,
+    0xC9, 0x59, 0x44, 0xE6, 0x4A, 0xFE, 0xD7, 0x35, 0x16, 0x89, 0x65, 0x1E, 0x79, 0x26, 0xBC, 0x4A,
+    0x66, 0x4F, 0x61, 0x5C, 0x62, 0x75, 0x13, 0x79, 0x3A, 0x5E, 0xA5, 0xE0, 0x14, 0xA6, 0x5A, 0x26,
+    0xF4, 0xBC, 0x4A, 0xC6, 0x29, 0xE2, 0x26, 0xB1, 0xF4, 0x91, 0x27, 0x75, 0xAF, 0x12, 0x2D, 0xFE,
+    0xE5, 0x57, 0xC8, 0x44, 0x2A, 0x66, 0x32, 0xD8, 0x29, 0x39, 0x35, 0x58, 0x73, 0xB0, 0x0A, 0x4E,
+    0x70, 0x86, 0xC8, 0x27, 0x96, 0x9C, 0x96, 0xE4, 0xC6, 0xCB, 0x57, 0x9E, 0x17, 0x91, 0xFE, 0xCB,
+    0xEF, 0xBF, 0xFC, 0x3D, 0x3B, 0x7C, 0x36, 0x26, 0xB5, 0xFC, 0xAC, 0x3F, 0xB4, 0x68, 0x6F, 0x76,
+    0x3F, 0x24, 0x93, 0x88, 0xCB, 0xC9, 0xFA, 0x5D, 0x87, 0xB7, 0x81, 0xF5, 0x6A, 0x60, 0x22, 0x73,
+    0x98, 0xAB, 0x7A, 0x10, 0xE6, 0x75, 0xB3, 0x17, 0x84, 0x3D, 0xB5, 0xC6, 0xC2, 0x02, 0x93, 0x16,
+    0x48, 0xC4, 0x02, 0x93, 0xC0, 0x72, 0x0A, 0xD9, 0xFC, 0xCA, 0xE1, 0x67, 0xCF, 0x15, 0xFF, 0xF4,
+    0x47, 0xFF, 0x50, 0x67, 0xFF, 0xAD, 0x6F, 0x4F, 0xAE, 0xFC, 0x53, 0xF7, 0xCA, 0x7D, 0x79, 0xEA,
+    0x5E, 0x39, 0xD1, 0xC7, 0x8B, 0xEB, 0x6B, 0x21, 0xBA, 0x26, 0x62, 0x23, 0xF7, 0xBF, 0xFD, 0x31,
+    0x91, 0x7B, 0xE5, 0x3E, 0xB0, 0x47, 0x0E, 0x30, 0x11, 0x99, 0xCF, 0x44, 0xE6, 0xC7, 0x46, 0x83,
+    0x9B, 0xEA, 0xB1, 0xD1, 0xE8, 0xB1, 0xD9, 0x32, 0x8D, 0xD8, 0xF3, 0x8B, 0xC0, 0x4C, 0x64, 0x4D,
+    0xC4, 0xA7, 0x7E, 0x70, 0x00, 0xB6, 0x99, 0xC8, 0xBB, 0x22, 0xED, 0x52, 0xD5, 0x9D, 0x55, 0x89,
+    0x54, 0xD1, 0x02, 0x8A, 0x61, 0x41, 0xF6, 0xC3, 0x37, 0x1C, 0xC2, 0x60, 0x31, 0xF6, 0xBB, 0x09,
+    0x84, 0x01, 0x19, 0xA8, 0xA0, 0x50, 0x21, 0x43, 0xDD, 0x5C, 0x10, 0xC9, 0x59, 0x26, 0x2D, 0xFC,
+    0x9B, 0x70, 0x1C, 0x75, 0x43, 0x50, 0xE2, 0xC9, 0x3A, 0xD8, 0x08, 0x64, 0x2A, 0x50, 0x2C, 0x61,
+    0x5D, 0x05, 0x6A, 0x15, 0x54, 0xA7, 0x42, 0x1C, 0x54, 0xBB, 0xE6, 0x94, 0x08, 0x4A, 0x2E, 0xEF,
+    0x37, 0x44, 0x7A, 0x40, 0x5F, 0xF5, 0xC0, 0xFD, 0xB1, 0x03, 0x5E, 0x35, 0x40, 0xD4, 0xAC, 0x02,
+    0xFA, 0xFD, 0x9D, 0xD1, 0x88, 0x58, 0x44, 0xA4, 0x52, 0x2F, 0x5F, 0x99, 0xCE, 0x1C, 0xAB, 0x90,
+    0x54, 0x83, 0x72, 0x51, 0x3B, 0xCB, 0x49, 0x8C, 0xF9, 0x7A, 0xF5, 0x0A, 0xB9, 0xCC, 0x9E, 0x75,
+    0xC8, 0x13, 0xAF, 0xFF, 0x03, 0xBA, 0xBD, 0x2F, 0x0E, 0x64, 0x0E, 0x18, 0xBE, 0x4D, 0x75, 0x78,
+    0xD8, 0x24, 0x5B, 0xDA, 0x03, 0xC0, 0x44, 0x02, 0x90, 0x0D, 0xF8, 0xCE, 0xB2, 0xBB, 0x25, 0x3C,
+    0x71, 0x7B, 0xA8, 0xAE, 0xDE, 0xDB, 0x57, 0x9B, 0x38, 0xE0, 0xF8, 0x8E, 0x45, 0x89, 0x2C, 0x88,
+    0x64, 0x36, 0x0B, 0xD1, 0x3C, 0x71, 0x33, 0xFA, 0x28, 0x24, 0x4D, 0x4D, 0x4D, 0x5F, 0x92, 0x91,
+    0x3E, 0x5A, 0x25, 0x4E, 0x5F, 0xF2, 0x51, 0x60, 0xA7, 0xA5, 0xA6, 0x58, 0x07, 0xCC, 0x0F, 0x2C,
+    0xE8, 0x0F, 0x3C, 0xB0, 0xD3, 0xC2, 0x32, 0xB1, 0xD2, 0xB2, 0x83, 0x16, 0x69, 0xF4, 0xFB, 0x8F,
+    0x77, 0xDA, 0x33, 0xD7, 0x9E, 0x42, 0x7B, 0xCA, 0x25, 0x14, 0xDA, 0xB3, 0xAE, 0xBD, 0xEA, 0xBF,
+    0xB3, 0x98, 0x85, 0x99, 0x48, 0xF5, 0x9D, 0x1B, 0xFF, 0x76, 0x6F, 0xC3, 0xF9, 0x4C, 0x02, 0x33,
+    0x69, 0x3F, 0xF5, 0x01, 0x0C, 0x94, 0xB5, 0x10, 0x5D, 0xF0, 0xA0, 0xAF, 0x78, 0x48, 0xA5, 0x03,
+    0xB9, 0x2A, 0x56, 0xDF, 0xBC, 0x70, 0xCD, 0x27, 0x6F, 0x5D, 0x78, 0x3B, 0x98, 0x67, 0x2F, 0xF8,
+    0x2E, 0xFB, 0xDA, 0x05, 0x5F, 0x97, 0xD1, 0x05, 0xBF, 0x5E, 0x46, 0x17, 0x7C, 0x51, 0xDC, 0x0A,
+    0xF6, 0xB6, 0x38, 0x66, 0x7B, 0x5A, 0x36, 0xB3, 0xB7, 0x0D, 0x52, 0x75, 0x00, 0x93, 0xB3, 0x90,
+    0x88, 0x48, 0x9B, 0x88, 0x48, 0xAB, 0xDE, 0x74, 0x9C, 0x38, 0x85, 0x7A, 0xCB, 0x6B, 0x59, 0x50,
+    0xCA, 0x5C, 0xBF, 0xBF, 0xD6, 0xE6, 0xA4, 0xDB, 0x9E, 0x3E, 0x27, 0x19, 0x22, 0xF3, 0x9C, 0x8F,
+    0x43, 0x29, 0x9D, 0x16, 0xA9, 0x0A, 0x35, 0x7B, 0xC4, 0xD3, 0xE7, 0xC4, 0x6F, 0x2F, 0xFD, 0xBD,
+    0x3C, 0xEB, 0x39, 0x66, 0xBB, 0xF9, 0x72, 0x57, 0xCA, 0x42, 0x8B, 0x58, 0xF5, 0x96, 0xE7, 0xC4,
+    0x29, 0xD4, 0x9B, 0x1E, 0xD6, 0x3A, 0x2D, 0x0B, 0x73, 0xFD, 0x5F, 0x66, 0x96, 0x12, 0xD6, 0x61,
+    0x0C, 0xF5, 0xEE, 0x6F, 0x30, 0xBB, 0x94, 0x90, 0xFA, 0x83, 0xB1, 0x2C, 0x98, 0xCD, 0x07, 0xC6,
+    0x7B, 0x22, 0x8B, 0x89, 0x2C, 0x8E, 0x8D, 0x1E, 0x3B, 0x36, 0x1A, 0xFD, 0x0B, 0x11, 0xB9, 0x28,
+    0x83, 0x50, 0xCB, 0x51, 0x22, 0x71, 0x59, 0x8F, 0xF4, 0x46, 0x5C, 0x5A, 0xA9, 0x6E, 0x20, 0x99,
+    0x94, 0x44, 0x01, 0x1D, 0x28, 0x61, 0xF6, 0x62, 0x7C, 0xE3, 0xEC, 0x4C, 0x3E, 0x90, 0x85, 0x9A,
+    0x3C, 0xF6, 0xE5, 0xEB, 0x76, 0x48, 0x2D, 0x97, 0x1F, 0x54, 0xF8, 0xC5, 0xFF, 0xA2, 0x2C, 0x64,
+    0xFD, 0x51, 0xA4, 0xAF, 0x55, 0xC7, 0x66, 0x14, 0xF8, 0xAA, 0x0E, 0x03, 0x16, 0x49, 0x6E, 0x9C,
+    0x7D, 0x72, 0x26, 0xCD, 0xF8, 0xCB, 0xD7, 0xED, 0x58, 0x07, 0x7E, 0x6E, 0x58, 0x96, 0x3D, 0x46,
+    0xFA, 0xB1, 0xEA, 0x18, 0x47, 0xFB, 0xEE, 0x25, 0x37, 0xCE, 0x8E, 0x7F, 0xD9, 0xB2, 0x8F, 0x32,
+    0x8C, 0xDB, 0x51, 0xA4, 0x37, 0xF2, 0xFA, 0x30, 0x72, 0x9B, 0x51, 0x20, 0x23, 0xAA, 0x4A, 0xA2,
+    0xA1, 0x1B, 0x25, 0xCB, 0xD1, 0x7B, 0x72, 0x26, 0x1F, 0xC8, 0x22, 0xBE, 0x30, 0x79, 0x6C, 0x59,
+    0x69, 0x49, 0xEC, 0x4A, 0x96, 0x25, 0xFE, 0x4A, 0x2E, 0xF6, 0xB7, 0x6A, 0x8C, 0xF4, 0x46, 0x2E,
+    0x0E, 0xAD, 0x1A, 0x47, 0x81, 0x8C, 0xD8, 0x95, 0x44, 0xB7, 0x9E, 0x9E, 0xBD, 0x18, 0xDF, 0x38,
+    0x3B, 0xFE, 0x35, 0xB4, 0xEA, 0x28, 0x28, 0x99, 0xA3, 0x44, 0x3C, 0xBD, 0xEA, 0x59, 0xC7, 0xD8,
+    0x14, 0xED, 0x13, 0x47, 0x1B, 0x05, 0x25, 0xD3, 0x5A, 0x89, 0x5C, 0xE3, 0xCB, 0xEF, 0x3F, 0xEE,
+    0x68, 0xA3, 0x40, 0x4E, 0x8D, 0xB1, 0xD9, 0xDE, 0x13, 0x9F, 0x4E, 0x28, 0xA8, 0x31, 0x2E, 0x43,
+    0xC9, 0xCD, 0xC1, 0x53, 0x95, 0x23, 0xCB, 0x0F, 0xF0, 0x0C, 0xDF, 0x1F, 0xD4, 0x32, 0x07, 0x32,
+    0xDB, 0x03, 0xDD, 0x60, 0x7E, 0x8D, 0x1D, 0x24, 0x55, 0x0A, 0x33, 0x51, 0x8B, 0x17, 0x53, 0xE9,
+    0x33, 0xE9, 0xE7, 0x87, 0xC2, 0xF1, 0x1F, 0x7F, 0xCB, 0x41, 0x4A, 0x0A, 0x8C, 0x19, 0x6C, 0x72,
+    0xB3, 0x8A, 0xD8, 0x31, 0x6B, 0x49, 0x21, 0xEB, 0x19, 0x43, 0xDC, 0xAB, 0x00, 0x51, 0x3B, 0x6C,
+    0xB1, 0x49, 0x01, 0x53, 0xAD, 0xF3, 0x47, 0x6C, 0xD2, 0x2B, 0x91, 0x26, 0x92, 0x8F, 0x64, 0x4E,
+    0x24, 0xEE, 0xE8, 0xED, 0xBA, 0xFF, 0x81, 0x71, 0x32, 0x43, 0x34, 0xEC, 0xC9, 0x37, 0x43, 0x24,
+    0xE2, 0x01, 0xF3, 0xF7, 0x6B, 0x03, 0xB3, 0x65, 0xFC, 0xF0, 0x85, 0x12, 0x0F, 0xF2, 0x3F, 0x34,
+    0x99, 0xC7, 0x88, 0xB8, 0x89, 0x47, 0x44, 0x22, 0xF1, 0x46, 0xA4, 0x35, 0xE2, 0x45, 0xC4, 0xCE,
+    0xE4, 0x9D, 0x01, 0xC7, 0x3C, 0x2F, 0x52, 0x89, 0x74, 0xB1, 0x2C, 0x62, 0x91, 0x2A, 0x96, 0x2E,
+    0x93, 0x6E, 0x49, 0x09, 0x88, 0x45, 0xA4, 0x83, 0x78, 0x1E, 0x4B, 0x05, 0x71, 0x30, 0x1D, 0x10,
+    0xFB, 0xB2, 0x02, 0xE2, 0x77, 0xBA, 0x41, 0xBE, 0xAF, 0x00, 0xE2, 0xC1, 0x0A, 0x1F, 0x57, 0x7B,
+    0xEA, 0xF9, 0xFF, 0x17,
 };
 
 static const EpdGlyph notosans_14_regularGlyphs[] = {
@@ -1828,7 +1827,7 @@ static const EpdGlyph notosans_14_regularGlyphs[] = {
     { 4, 31, 16, 6, 23, 31, 6374 }, // |
     { 11, 26, 11, 0, 21, 72, 6405 }, // }
     { 15, 5, 17, 1, 13, 19, 6477 }, // ~
-    { 0, 0, 8, 0, 0, 0, 0 }, //  
+    { 0, 0, 8, 0, 0, 0, 6496 }, //  
     { 4, 22, 8, 2, 16, 22, 0 }, // ¡
     { 13, 23, 17, 2, 22, 75, 22 }, // ¢
     { 16, 22, 17, 0, 22, 88, 97 }, // £
@@ -1839,775 +1838,782 @@ static const EpdGlyph notosans_14_regularGlyphs[] = {
     { 9, 4, 17, 4, 22, 9, 433 }, // ¨
     { 22, 23, 24, 1, 22, 127, 442 }, // ©
     { 9, 11, 10, 0, 22, 25, 569 }, // ª
-    { 13, 13, 15, 1, 14, 43, 594 }, // «
-    { 15, 9, 17, 1, 12, 34, 637 }, // ¬
-    { 8, 3, 9, 1, 9, 6, 671 }, // ­
-    { 22, 23, 24, 1, 22, 127, 677 }, // ®
-    { 16, 3, 15, -1, 25, 12, 804 }, // ¯
-    { 10, 10, 12, 1, 22, 25, 816 }, // °
-    { 15, 18, 17, 1, 18, 68, 841 }, // ±
-    { 9, 13, 10, 0, 25, 30, 909 }, // ²
-    { 10, 14, 10, 0, 25, 35, 939 }, // ³
-    { 7, 6, 8, 1, 23, 11, 974 }, // ´
-    { 14, 23, 18, 2, 16, 81, 985 }, // µ
-    { 16, 27, 19, 1, 23, 108, 1066 }, // ¶
-    { 4, 5, 8, 2, 13, 5, 1174 }, // ·
-    { 7, 7, 7, 0, 0, 13, 1179 }, // ¸
-    { 6, 13, 10, 1, 25, 20, 1192 }, // ¹
-    { 11, 11, 11, 0, 22, 31, 1212 }, // º
-    { 13, 13, 15, 1, 14, 43, 1243 }, // »
-    { 22, 21, 22, 0, 21, 116, 1286 }, // ¼
-    { 22, 21, 22, 0, 21, 116, 1402 }, // ½
-    { 23, 22, 23, 0, 22, 127, 1518 }, // ¾
-    { 13, 22, 13, 0, 16, 72, 1645 }, // ¿
-    { 19, 28, 19, 0, 28, 133, 1717 }, // À
-    { 19, 28, 19, 0, 28, 133, 1850 }, // Á
-    { 19, 28, 19, 0, 28, 133, 1983 }, // Â
-    { 19, 27, 19, 0, 27, 129, 2116 }, // Ã
-    { 19, 27, 19, 0, 27, 129, 2245 }, // Ä
-    { 19, 26, 19, 0, 26, 124, 2374 }, // Å
-    { 25, 21, 26, -1, 21, 132, 2498 }, // Æ
-    { 17, 29, 18, 1, 22, 124, 2630 }, // Ç
-    { 13, 28, 16, 2, 28, 91, 2754 }, // È
-    { 13, 28, 16, 2, 28, 91, 2845 }, // É
-    { 13, 28, 16, 2, 28, 91, 2936 }, // Ê
-    { 13, 27, 16, 2, 27, 88, 3027 }, // Ë
-    { 8, 28, 10, 1, 28, 56, 3115 }, // Ì
-    { 9, 28, 10, 1, 28, 63, 3171 }, // Í
-    { 10, 28, 10, 0, 28, 70, 3234 }, // Î
-    { 10, 27, 10, 0, 27, 68, 3304 }, // Ï
-    { 20, 21, 21, 0, 21, 105, 3372 }, // Ð
-    { 18, 27, 22, 2, 27, 122, 3477 }, // Ñ
-    { 20, 29, 23, 1, 28, 145, 3599 }, // Ò
-    { 20, 29, 23, 1, 28, 145, 3744 }, // Ó
-    { 20, 29, 23, 1, 28, 145, 3889 }, // Ô
-    { 20, 28, 23, 1, 27, 140, 4034 }, // Õ
-    { 20, 28, 23, 1, 27, 140, 4174 }, // Ö
-    { 14, 14, 17, 1, 17, 49, 4314 }, // ×
-    { 20, 23, 23, 1, 22, 115, 4363 }, // Ø
-    { 17, 29, 21, 2, 28, 124, 4478 }, // Ù
-    { 17, 29, 21, 2, 28, 124, 4602 }, // Ú
-    { 17, 29, 21, 2, 28, 124, 4726 }, // Û
-    { 17, 28, 21, 2, 27, 119, 4850 }, // Ü
-    { 17, 28, 17, 0, 28, 119, 4969 }, // Ý
-    { 15, 21, 18, 2, 21, 79, 5088 }, // Þ
-    { 16, 24, 18, 2, 23, 96, 5167 }, // ß
-    { 13, 24, 16, 1, 23, 78, 5263 }, // à
-    { 13, 24, 16, 1, 23, 78, 5341 }, // á
-    { 13, 24, 16, 1, 23, 78, 5419 }, // â
-    { 13, 23, 16, 1, 22, 75, 5497 }, // ã
-    { 13, 23, 16, 1, 22, 75, 5572 }, // ä
-    { 13, 25, 16, 1, 24, 82, 5647 }, // å
-    { 23, 17, 25, 1, 16, 98, 5729 }, // æ
-    { 13, 23, 14, 1, 16, 75, 5827 }, // ç
-    { 14, 24, 16, 1, 23, 84, 5902 }, // è
-    { 14, 24, 16, 1, 23, 84, 5986 }, // é
-    { 14, 24, 16, 1, 23, 84, 6070 }, // ê
-    { 14, 23, 16, 1, 22, 81, 6154 }, // ë
-    { 7, 23, 8, -1, 23, 41, 6235 }, // ì
-    { 7, 23, 8, 2, 23, 41, 6276 }, // í
-    { 11, 23, 8, -2, 23, 64, 6317 }, // î
-    { 9, 22, 8, -1, 22, 50, 6381 }, // ï
-    { 16, 24, 18, 1, 23, 96, 6431 }, // ð
-    { 14, 22, 18, 2, 22, 77, 6527 }, // ñ
-    { 16, 24, 18, 1, 23, 96, 6604 }, // ò
-    { 16, 24, 18, 1, 23, 96, 6700 }, // ó
-    { 16, 24, 18, 1, 23, 96, 6796 }, // ô
-    { 16, 23, 18, 1, 22, 92, 6892 }, // õ
-    { 16, 23, 18, 1, 22, 92, 6984 }, // ö
-    { 15, 14, 17, 1, 17, 53, 7076 }, // ÷
-    { 16, 18, 18, 1, 17, 72, 7129 }, // ø
-    { 14, 24, 18, 2, 23, 84, 7201 }, // ù
-    { 14, 24, 18, 2, 23, 84, 7285 }, // ú
-    { 14, 24, 18, 2, 23, 84, 7369 }, // û
-    { 14, 23, 18, 2, 22, 81, 7453 }, // ü
-    { 15, 30, 15, 0, 23, 113, 7534 }, // ý
-    { 15, 30, 18, 2, 23, 113, 7647 }, // þ
-    { 15, 29, 15, 0, 22, 109, 7760 }, // ÿ
-    { 19, 25, 19, 0, 25, 119, 0 }, // Ā
-    { 13, 21, 16, 1, 20, 69, 119 }, // ā
-    { 19, 27, 19, 0, 27, 129, 188 }, // Ă
-    { 13, 23, 16, 1, 22, 75, 317 }, // ă
-    { 19, 28, 19, 0, 21, 133, 392 }, // Ą
-    { 14, 23, 16, 1, 16, 81, 525 }, // ą
-    { 17, 29, 18, 1, 28, 124, 606 }, // Ć
-    { 13, 24, 14, 1, 23, 78, 730 }, // ć
-    { 17, 29, 18, 1, 28, 124, 808 }, // Ĉ
-    { 13, 24, 14, 1, 23, 78, 932 }, // ĉ
-    { 17, 28, 18, 1, 27, 119, 1010 }, // Ċ
-    { 13, 23, 14, 1, 22, 75, 1129 }, // ċ
-    { 17, 29, 18, 1, 28, 124, 1204 }, // Č
-    { 13, 24, 14, 1, 23, 78, 1328 }, // č
-    { 18, 28, 21, 2, 28, 126, 1406 }, // Ď
-    { 20, 24, 18, 1, 23, 120, 1532 }, // ď
-    { 20, 21, 21, 0, 21, 105, 1652 }, // Đ
-    { 17, 24, 18, 1, 23, 102, 1757 }, // đ
-    { 13, 25, 16, 2, 25, 82, 1859 }, // Ē
-    { 14, 21, 16, 1, 20, 74, 1941 }, // ē
-    { 13, 27, 16, 2, 27, 88, 2015 }, // Ĕ
-    { 14, 23, 16, 1, 22, 81, 2103 }, // ĕ
-    { 13, 27, 16, 2, 27, 88, 2184 }, // Ė
-    { 14, 23, 16, 1, 22, 81, 2272 }, // ė
-    { 13, 28, 16, 2, 21, 91, 2353 }, // Ę
-    { 14, 23, 16, 1, 16, 81, 2444 }, // ę
-    { 13, 28, 16, 2, 28, 91, 2525 }, // Ě
-    { 14, 24, 16, 1, 23, 84, 2616 }, // ě
-    { 19, 29, 21, 1, 28, 138, 2700 }, // Ĝ
-    { 15, 30, 18, 1, 23, 113, 2838 }, // ĝ
-    { 19, 28, 21, 1, 27, 133, 2951 }, // Ğ
-    { 15, 29, 18, 1, 22, 109, 3084 }, // ğ
-    { 19, 28, 21, 1, 27, 133, 3193 }, // Ġ
-    { 15, 29, 18, 1, 22, 109, 3326 }, // ġ
-    { 19, 29, 21, 1, 22, 138, 3435 }, // Ģ
-    { 15, 30, 18, 1, 23, 113, 3573 }, // ģ
-    { 17, 28, 22, 2, 28, 119, 3686 }, // Ĥ
-    { 18, 30, 18, -2, 30, 135, 3805 }, // ĥ
-    { 22, 21, 22, 0, 21, 116, 3940 }, // Ħ
-    { 16, 23, 18, 0, 23, 92, 4056 }, // ħ
-    { 12, 27, 10, -1, 27, 81, 4148 }, // Ĩ
-    { 12, 22, 8, -2, 22, 66, 4229 }, // ĩ
-    { 10, 25, 10, 0, 25, 63, 4295 }, // Ī
-    { 10, 20, 8, -1, 20, 50, 4358 }, // ī
-    { 10, 27, 10, 0, 27, 68, 4408 }, // Ĭ
-    { 10, 22, 8, -1, 22, 55, 4476 }, // ĭ
-    { 8, 28, 10, 1, 21, 56, 4531 }, // Į
-    { 6, 29, 8, 0, 22, 44, 4587 }, // į
-    { 8, 27, 10, 1, 27, 54, 4631 }, // İ
-    { 4, 16, 8, 2, 16, 16, 4685 }, // ı
-    { 15, 27, 18, 1, 21, 102, 4701 }, // Ĳ
-    { 11, 29, 15, 2, 22, 80, 4803 }, // ĳ
-    { 12, 34, 8, -3, 28, 102, 4883 }, // Ĵ
-    { 11, 30, 8, -2, 23, 83, 4985 }, // ĵ
-    { 17, 28, 18, 2, 21, 119, 5068 }, // Ķ
-    { 14, 30, 16, 2, 23, 105, 5187 }, // ķ
-    { 14, 16, 16, 2, 16, 56, 5292 }, // ĸ
-    { 13, 28, 15, 2, 28, 91, 5348 }, // Ĺ
-    { 7, 30, 8, 2, 30, 53, 5439 }, // ĺ
-    { 13, 28, 15, 2, 21, 91, 5492 }, // Ļ
-    { 5, 30, 8, 1, 23, 38, 5583 }, // ļ
-    { 13, 21, 15, 2, 21, 69, 5621 }, // Ľ
-    { 8, 23, 8, 2, 23, 46, 5690 }, // ľ
-    { 13, 21, 15, 2, 21, 69, 5736 }, // Ŀ
-    { 8, 23, 8, 2, 23, 46, 5805 }, // ŀ
-    { 15, 21, 15, 0, 21, 79, 5851 }, // Ł
-    { 9, 23, 8, -1, 23, 52, 5930 }, // ł
-    { 18, 28, 22, 2, 28, 126, 5982 }, // Ń
-    { 14, 23, 18, 2, 23, 81, 6108 }, // ń
-    { 18, 28, 22, 2, 21, 126, 6189 }, // Ņ
-    { 14, 23, 18, 2, 16, 81, 6315 }, // ņ
-    { 18, 28, 22, 2, 28, 126, 6396 }, // Ň
-    { 14, 23, 18, 2, 23, 81, 6522 }, // ň
-    { 18, 21, 20, 0, 21, 95, 6603 }, // ŉ
-    { 18, 27, 22, 2, 21, 122, 6698 }, // Ŋ
-    { 14, 23, 18, 2, 16, 81, 6820 }, // ŋ
-    { 20, 26, 23, 1, 25, 130, 6901 }, // Ō
-    { 16, 21, 18, 1, 20, 84, 7031 }, // ō
-    { 20, 28, 23, 1, 27, 140, 7115 }, // Ŏ
-    { 16, 23, 18, 1, 22, 92, 7255 }, // ŏ
-    { 20, 29, 23, 1, 28, 145, 7347 }, // Ő
-    { 16, 24, 18, 1, 23, 96, 7492 }, // ő
-    { 25, 23, 27, 1, 22, 144, 7588 }, // Œ
-    { 26, 17, 28, 1, 16, 111, 7732 }, // œ
-    { 16, 28, 18, 2, 28, 112, 7843 }, // Ŕ
-    { 10, 23, 12, 2, 23, 58, 7955 }, // ŕ
-    { 16, 28, 18, 2, 21, 112, 8013 }, // Ŗ
-    { 11, 23, 12, 1, 16, 64, 8125 }, // ŗ
-    { 16, 28, 18, 2, 28, 112, 8189 }, // Ř
-    { 10, 23, 12, 2, 23, 58, 8301 }, // ř
-    { 14, 29, 16, 1, 28, 102, 8359 }, // Ś
-    { 12, 24, 14, 1, 23, 72, 8461 }, // ś
-    { 14, 29, 16, 1, 28, 102, 8533 }, // Ŝ
-    { 12, 24, 14, 1, 23, 72, 8635 }, // ŝ
-    { 14, 29, 16, 1, 22, 102, 8707 }, // Ş
-    { 12, 23, 14, 1, 16, 69, 8809 }, // ş
-    { 14, 29, 16, 1, 28, 102, 8878 }, // Š
-    { 12, 24, 14, 1, 23, 72, 8980 }, // š
-    { 16, 28, 16, 0, 21, 112, 9052 }, // Ţ
-    { 10, 27, 11, 0, 20, 68, 9164 }, // ţ
-    { 16, 28, 16, 0, 28, 112, 9232 }, // Ť
-    { 14, 24, 11, 0, 23, 84, 9344 }, // ť
-    { 16, 21, 16, 0, 21, 84, 9428 }, // Ŧ
-    { 10, 21, 11, 0, 20, 53, 9512 }, // ŧ
-    { 17, 28, 21, 2, 27, 119, 9565 }, // Ũ
-    { 14, 23, 18, 2, 22, 81, 9684 }, // ũ
-    { 17, 26, 21, 2, 25, 111, 9765 }, // Ū
-    { 14, 21, 18, 2, 20, 74, 9876 }, // ū
-    { 17, 28, 21, 2, 27, 119, 9950 }, // Ŭ
-    { 14, 23, 18, 2, 22, 81, 10069 }, // ŭ
-    { 17, 30, 21, 2, 29, 128, 10150 }, // Ů
-    { 14, 25, 18, 2, 24, 88, 10278 }, // ů
-    { 17, 29, 21, 2, 28, 124, 10366 }, // Ű
-    { 14, 24, 18, 2, 23, 84, 10490 }, // ű
-    { 17, 28, 21, 2, 21, 119, 10574 }, // Ų
-    { 14, 23, 18, 2, 16, 81, 10693 }, // ų
-    { 27, 28, 27, 0, 28, 189, 10774 }, // Ŵ
-    { 23, 23, 23, 0, 23, 133, 10963 }, // ŵ
-    { 17, 28, 17, 0, 28, 119, 11096 }, // Ŷ
-    { 15, 30, 15, 0, 23, 113, 11215 }, // ŷ
-    { 17, 27, 17, 0, 27, 115, 11328 }, // Ÿ
-    { 15, 28, 17, 1, 28, 105, 11443 }, // Ź
-    { 12, 23, 14, 1, 23, 69, 11548 }, // ź
-    { 15, 27, 17, 1, 27, 102, 11617 }, // Ż
-    { 12, 22, 14, 1, 22, 66, 11719 }, // ż
-    { 15, 28, 17, 1, 28, 105, 11785 }, // Ž
-    { 12, 23, 14, 1, 23, 69, 11890 }, // ž
-    { 9, 23, 10, 2, 23, 52, 11959 }, // ſ
-    { 7, 6, 0, -15, 23, 11, 0 }, // ̀
-    { 7, 6, 0, -10, 23, 11, 11 }, // ́
-    { 10, 6, 0, -5, 23, 15, 22 }, // ̂
-    { 12, 5, 0, -15, 22, 15, 37 }, // ̃
-    { 10, 3, 0, -5, 20, 8, 52 }, // ̄
-    { 14, 3, 0, -7, 25, 11, 60 }, // ̅
-    { 10, 5, 0, -5, 22, 13, 71 }, // ̆
-    { 4, 4, 0, -2, 22, 4, 84 }, // ̇
-    { 10, 4, 0, -5, 22, 10, 88 }, // ̈
-    { 6, 7, 0, -11, 24, 11, 98 }, // ̉
-    { 8, 7, 0, -4, 24, 14, 109 }, // ̊
-    { 11, 6, 0, -4, 23, 17, 123 }, // ̋
-    { 10, 6, 0, -5, 23, 15, 140 }, // ̌
-    { 4, 6, 0, -2, 23, 6, 155 }, // ̍
-    { 8, 6, 0, -4, 23, 12, 161 }, // ̎
-    { 12, 6, 0, -16, 23, 18, 173 }, // ̏
-    { 10, 8, 0, -5, 25, 20, 191 }, // ̐
-    { 10, 5, 0, -5, 22, 13, 211 }, // ̑
-    { 6, 8, 0, -3, 21, 12, 224 }, // ̒
-    { 6, 8, 0, -3, 21, 12, 236 }, // ̓
-    { 6, 8, 0, -3, 21, 12, 248 }, // ̔
-    { 6, 8, 0, -3, 21, 12, 260 }, // ̕
-    { 6, 6, 0, -3, -1, 9, 272 }, // ̖
-    { 6, 6, 0, -3, -1, 9, 281 }, // ̗
-    { 6, 7, 0, -3, 0, 11, 290 }, // ̘
-    { 6, 7, 0, -3, 0, 11, 301 }, // ̙
-    { 8, 8, 9, 0, 23, 16, 312 }, // ̚
-    { 7, 7, 0, -3, 23, 13, 328 }, // ̛
-    { 4, 7, 0, -2, 0, 7, 341 }, // ̜
-    { 8, 6, 0, -4, -1, 12, 348 }, // ̝
-    { 8, 6, 0, -4, -1, 12, 360 }, // ̞
-    { 8, 7, 0, -4, 0, 14, 372 }, // ̟
-    { 8, 3, 0, -4, -3, 6, 386 }, // ̠
-    { 6, 9, 0, -6, 2, 14, 392 }, // ̡
-    { 6, 9, 0, 0, 2, 14, 406 }, // ̢
-    { 4, 5, 0, -11, -1, 5, 420 }, // ̣
-    { 10, 4, 0, -5, -2, 10, 425 }, // ̤
-    { 8, 7, 0, -4, 0, 14, 435 }, // ̥
-    { 4, 6, 0, -2, -1, 6, 449 }, // ̦
-    { 6, 7, 0, -3, 0, 11, 455 }, // ̧
-    { 6, 8, 0, -3, 1, 12, 466 }, // ̨
-    { 4, 6, 0, -2, 0, 6, 478 }, // ̩
-    { 12, 6, 0, -6, -1, 18, 484 }, // ̪
-    { 12, 5, 0, -6, -1, 15, 502 }, // ̫
-    { 10, 6, 0, -5, 0, 15, 517 }, // ̬
-    { 10, 6, 0, -5, -1, 15, 532 }, // ̭
-    { 10, 5, 0, -5, -1, 13, 547 }, // ̮
-    { 10, 5, 0, -5, -1, 13, 560 }, // ̯
-    { 12, 5, 0, -6, -1, 15, 573 }, // ̰
-    { 10, 3, 0, -5, -2, 8, 588 }, // ̱
-    { 14, 3, 0, -7, -2, 11, 596 }, // ̲
-    { 14, 7, 0, -7, 0, 25, 607 }, // ̳
-    { 12, 5, 0, -6, 10, 15, 632 }, // ̴
-    { 14, 3, 0, -7, 10, 11, 647 }, // ̵
-    { 22, 3, 0, -11, 10, 17, 658 }, // ̶
-    { 10, 7, 0, -5, 12, 18, 675 }, // ̷
-    { 12, 25, 0, -6, 23, 75, 693 }, // ̸
-    { 4, 7, 0, -2, 0, 7, 768 }, // ̹
-    { 12, 6, 0, -6, -1, 18, 775 }, // ̺
-    { 12, 7, 0, -6, 0, 21, 793 }, // ̻
-    { 12, 5, 0, -6, -1, 15, 814 }, // ̼
-    { 6, 7, 0, -3, 23, 11, 829 }, // ̽
-    { 4, 10, 0, -2, 26, 10, 840 }, // ̾
-    { 14, 7, 0, -7, 29, 25, 850 }, // ̿
-    { 7, 6, 0, -5, 23, 11, 875 }, // ̀
-    { 7, 6, 0, -2, 23, 11, 886 }, // ́
-    { 12, 5, 0, -6, 22, 15, 897 }, // ͂
-    { 5, 6, 0, -3, 23, 8, 912 }, // ̓
-    { 11, 6, 0, -5, 23, 17, 920 }, // ̈́
-    { 6, 5, 0, -2, -2, 8, 937 }, // ͅ
-    { 14, 6, 0, -7, 23, 21, 945 }, // ͆
-    { 14, 7, 0, -7, 0, 25, 966 }, // ͇
-    { 8, 6, 0, -4, 0, 12, 991 }, // ͈
-    { 6, 6, 0, -3, -1, 9, 1003 }, // ͉
-    { 12, 7, 0, -6, 23, 21, 1012 }, // ͊
-    { 12, 11, 0, -6, 27, 33, 1033 }, // ͋
-    { 10, 9, 0, -5, 26, 23, 1066 }, // ͌
-    { 12, 6, 0, -6, -1, 18, 1089 }, // ͍
-    { 6, 7, 0, -3, 0, 11, 1107 }, // ͎
-    { 22, 21, 0, -11, 21, 116, 1118 }, // ͏
-    { 6, 7, 0, -3, 24, 11, 1234 }, // ͐
-    { 4, 7, 0, -2, 24, 7, 1245 }, // ͑
-    { 10, 8, 0, -5, 25, 20, 1252 }, // ͒
-    { 6, 7, 0, -3, 0, 11, 1272 }, // ͓
-    { 6, 6, 0, -3, -1, 9, 1283 }, // ͔
-    { 6, 6, 0, -3, -1, 9, 1292 }, // ͕
-    { 12, 6, 0, -6, -1, 18, 1301 }, // ͖
-    { 4, 7, 0, -2, 24, 7, 1319 }, // ͗
-    { 4, 4, 0, 3, 22, 4, 1326 }, // ͘
-    { 8, 6, 0, -4, -1, 12, 1330 }, // ͙
-    { 12, 7, 0, -6, 0, 21, 1342 }, // ͚
-    { 6, 6, 0, -3, 23, 9, 1363 }, // ͛
-    { 24, 6, 0, -12, -1, 36, 1372 }, // ͜
-    { 24, 6, 0, -12, 23, 36, 1408 }, // ͝
-    { 18, 2, 0, -9, 20, 9, 1444 }, // ͞
-    { 18, 2, 0, -9, -2, 9, 1453 }, // ͟
-    { 24, 5, 0, -12, 22, 30, 1462 }, // ͠
-    { 24, 6, 0, -12, 25, 36, 1492 }, // ͡
-    { 23, 6, 0, -11, -1, 35, 1528 }, // ͢
-    { 6, 8, 0, -3, 25, 12, 1563 }, // ͣ
-    { 7, 8, 0, -3, 25, 14, 1575 }, // ͤ
-    { 2, 9, 0, -1, 27, 5, 1589 }, // ͥ
-    { 7, 8, 0, -3, 25, 14, 1594 }, // ͦ
-    { 7, 8, 0, -3, 25, 14, 1608 }, // ͧ
-    { 6, 8, 0, -3, 25, 12, 1622 }, // ͨ
-    { 7, 10, 0, -3, 27, 18, 1634 }, // ͩ
-    { 7, 9, 0, -3, 27, 16, 1652 }, // ͪ
-    { 11, 7, 0, -5, 25, 20, 1668 }, // ͫ
-    { 5, 7, 0, -2, 25, 9, 1688 }, // ͬ
-    { 5, 9, 0, -2, 26, 12, 1697 }, // ͭ
-    { 8, 7, 0, -4, 25, 14, 1709 }, // ͮ
-    { 7, 7, 0, -3, 25, 13, 1723 }, // ͯ
-    { 13, 28, 16, 2, 28, 91, 0 }, // Ѐ
-    { 13, 27, 16, 2, 27, 88, 91 }, // Ё
-    { 20, 22, 21, 0, 21, 110, 179 }, // Ђ
-    { 13, 28, 15, 2, 28, 91, 289 }, // Ѓ
-    { 17, 23, 19, 1, 22, 98, 380 }, // Є
-    { 14, 23, 16, 1, 22, 81, 478 }, // Ѕ
-    { 4, 21, 8, 2, 21, 21, 559 }, // І
-    { 8, 27, 8, 0, 27, 54, 580 }, // Ї
-    { 9, 27, 8, -3, 21, 61, 634 }, // Ј
-    { 28, 22, 29, 0, 21, 154, 695 }, // Љ
-    { 27, 21, 30, 2, 21, 142, 849 }, // Њ
-    { 20, 21, 21, 0, 21, 105, 991 }, // Ћ
-    { 16, 28, 18, 2, 28, 112, 1096 }, // Ќ
-    { 18, 28, 22, 2, 28, 126, 1208 }, // Ѝ
-    { 18, 28, 18, 0, 27, 126, 1334 }, // Ў
-    { 17, 26, 21, 2, 21, 111, 1460 }, // Џ
-    { 19, 21, 19, 0, 21, 100, 1571 }, // А
-    { 15, 21, 18, 2, 21, 79, 1671 }, // Б
-    { 16, 21, 19, 2, 21, 84, 1750 }, // В
-    { 13, 21, 15, 2, 21, 69, 1834 }, // Г
-    { 21, 26, 21, 0, 21, 137, 1903 }, // Д
-    { 13, 21, 16, 2, 21, 69, 2040 }, // Е
-    { 27, 21, 26, 0, 21, 142, 2109 }, // Ж
-    { 15, 23, 17, 1, 22, 87, 2251 }, // З
-    { 18, 21, 22, 2, 21, 95, 2338 }, // И
-    { 18, 27, 22, 2, 27, 122, 2433 }, // Й
-    { 16, 21, 18, 2, 21, 84, 2555 }, // К
-    { 18, 22, 20, 0, 21, 99, 2639 }, // Л
-    { 22, 21, 26, 2, 21, 116, 2738 }, // М
-    { 17, 21, 22, 2, 21, 90, 2854 }, // Н
-    { 20, 23, 22, 1, 22, 115, 2944 }, // О
-    { 17, 21, 21, 2, 21, 90, 3059 }, // П
-    { 15, 21, 18, 2, 21, 79, 3149 }, // Р
-    { 17, 23, 19, 1, 22, 98, 3228 }, // С
-    { 16, 21, 16, 0, 21, 84, 3326 }, // Т
-    { 18, 22, 18, 0, 21, 99, 3410 }, // У
-    { 22, 23, 24, 1, 22, 127, 3509 }, // Ф
-    { 17, 21, 17, 0, 21, 90, 3636 }, // Х
-    { 20, 26, 22, 2, 21, 130, 3726 }, // Ц
-    { 15, 21, 20, 2, 21, 79, 3856 }, // Ч
-    { 26, 21, 30, 2, 21, 137, 3935 }, // Ш
-    { 28, 26, 30, 2, 21, 182, 4072 }, // Щ
-    { 19, 21, 20, 0, 21, 100, 4254 }, // Ъ
-    { 20, 21, 25, 2, 21, 105, 4354 }, // Ы
-    { 15, 21, 18, 2, 21, 79, 4459 }, // Ь
-    { 17, 23, 19, 1, 22, 98, 4538 }, // Э
-    { 26, 23, 29, 2, 22, 150, 4636 }, // Ю
-    { 16, 21, 19, 0, 21, 84, 4786 }, // Я
-    { 13, 17, 16, 1, 16, 56, 4870 }, // а
-    { 16, 24, 17, 1, 23, 96, 4926 }, // б
-    { 14, 16, 16, 2, 16, 56, 5022 }, // в
-    { 11, 16, 13, 2, 16, 44, 5078 }, // г
-    { 18, 21, 18, 0, 16, 95, 5122 }, // д
-    { 14, 17, 16, 1, 16, 60, 5217 }, // е
-    { 22, 16, 22, 0, 16, 88, 5277 }, // ж
-    { 13, 17, 14, 0, 16, 56, 5365 }, // з
-    { 14, 16, 18, 2, 16, 56, 5421 }, // и
-    { 14, 22, 18, 2, 22, 77, 5477 }, // й
-    { 14, 16, 15, 2, 16, 56, 5554 }, // к
-    { 15, 17, 17, 0, 16, 64, 5610 }, // л
-    { 18, 16, 22, 2, 16, 72, 5674 }, // м
-    { 14, 16, 18, 2, 16, 56, 5746 }, // н
-    { 15, 17, 17, 1, 16, 64, 5802 }, // о
-    { 14, 16, 18, 2, 16, 56, 5866 }, // п
-    { 15, 23, 18, 2, 16, 87, 5922 }, // р
-    { 13, 17, 14, 1, 16, 56, 6009 }, // с
-    { 14, 16, 14, 0, 16, 56, 6065 }, // т
-    { 15, 23, 15, 0, 16, 87, 6121 }, // у
-    { 20, 30, 22, 1, 23, 150, 6208 }, // ф
-    { 15, 16, 15, 0, 16, 60, 6358 }, // х
-    { 16, 21, 18, 2, 16, 84, 6418 }, // ц
-    { 14, 16, 17, 1, 16, 56, 6502 }, // ч
-    { 22, 16, 26, 2, 16, 88, 6558 }, // ш
-    { 24, 21, 26, 2, 16, 126, 6646 }, // щ
-    { 17, 16, 18, 0, 16, 68, 6772 }, // ъ
-    { 18, 16, 22, 2, 16, 72, 6840 }, // ы
-    { 13, 16, 16, 2, 16, 52, 6912 }, // ь
-    { 13, 17, 14, 1, 16, 56, 6964 }, // э
-    { 20, 17, 23, 2, 16, 85, 7020 }, // ю
-    { 14, 16, 17, 1, 16, 56, 7105 }, // я
-    { 14, 24, 16, 1, 23, 84, 7161 }, // ѐ
-    { 14, 23, 16, 1, 22, 81, 7245 }, // ё
-    { 16, 30, 18, 0, 23, 120, 7326 }, // ђ
-    { 11, 23, 13, 2, 23, 64, 7446 }, // ѓ
-    { 13, 17, 14, 1, 16, 56, 7510 }, // є
-    { 12, 17, 14, 1, 16, 51, 7566 }, // ѕ
-    { 4, 22, 8, 2, 22, 22, 7617 }, // і
-    { 7, 22, 8, 0, 22, 39, 7639 }, // ї
-    { 8, 29, 8, -2, 22, 58, 7678 }, // ј
-    { 24, 17, 25, 0, 16, 102, 7736 }, // љ
-    { 23, 16, 26, 2, 16, 92, 7838 }, // њ
-    { 16, 23, 18, 0, 23, 92, 7930 }, // ћ
-    { 14, 23, 15, 2, 23, 81, 8022 }, // ќ
-    { 14, 23, 18, 2, 23, 81, 8103 }, // ѝ
-    { 15, 29, 15, 0, 22, 109, 8184 }, // ў
-    { 14, 21, 18, 2, 16, 74, 8293 }, // џ
-    { 27, 22, 27, 0, 21, 149, 8367 }, // Ѡ
-    { 23, 16, 23, 0, 16, 92, 8516 }, // ѡ
-    { 19, 21, 20, 0, 21, 100, 8608 }, // Ѣ
-    { 17, 19, 19, 0, 19, 81, 8708 }, // ѣ
-    { 25, 23, 27, 2, 22, 144, 8789 }, // Ѥ
-    { 19, 17, 22, 2, 16, 81, 8933 }, // ѥ
-    { 20, 21, 20, 0, 21, 105, 9014 }, // Ѧ
-    { 17, 16, 17, 0, 16, 68, 9119 }, // ѧ
-    { 26, 21, 27, 2, 21, 137, 9187 }, // Ѩ
-    { 21, 16, 23, 2, 16, 84, 9324 }, // ѩ
-    { 21, 21, 21, 0, 21, 111, 9408 }, // Ѫ
-    { 19, 16, 19, 0, 16, 76, 9519 }, // ѫ
-    { 27, 21, 29, 2, 21, 142, 9595 }, // Ѭ
-    { 23, 16, 25, 2, 16, 92, 9737 }, // ѭ
-    { 16, 32, 17, 0, 25, 128, 9829 }, // Ѯ
-    { 13, 26, 14, 0, 20, 85, 9957 }, // ѯ
-    { 20, 21, 23, 2, 21, 105, 10042 }, // Ѱ
-    { 18, 30, 22, 2, 23, 135, 10147 }, // ѱ
-    { 20, 23, 23, 1, 22, 115, 10282 }, // Ѳ
-    { 16, 17, 18, 1, 16, 68, 10397 }, // ѳ
-    { 20, 21, 19, 0, 21, 105, 10465 }, // Ѵ
-    { 16, 16, 15, 0, 16, 64, 10570 }, // ѵ
-    { 20, 28, 19, 0, 28, 140, 10634 }, // Ѷ
-    { 16, 23, 15, 0, 23, 92, 10774 }, // ѷ
-    { 35, 29, 36, 1, 22, 254, 10866 }, // Ѹ
-    { 31, 23, 32, 1, 16, 179, 11120 }, // ѹ
-    { 22, 25, 24, 1, 23, 138, 11299 }, // Ѻ
-    { 17, 20, 19, 1, 18, 85, 11437 }, // ѻ
-    { 28, 32, 30, 1, 31, 224, 11522 }, // Ѽ
-    { 24, 27, 26, 1, 26, 162, 11746 }, // ѽ
-    { 27, 27, 27, 0, 26, 183, 11908 }, // Ѿ
-    { 23, 21, 23, 0, 21, 121, 12091 }, // ѿ
-    { 17, 29, 19, 1, 22, 124, 12212 }, // Ҁ
-    { 13, 23, 14, 1, 16, 75, 12336 }, // ҁ
-    { 16, 20, 18, 1, 19, 80, 12411 }, // ҂
-    { 12, 5, 0, -14, 21, 15, 12491 }, // ҃
-    { 12, 5, 0, -14, 22, 15, 12506 }, // ҄
-    { 5, 6, 0, -11, 23, 8, 12521 }, // ҅
-    { 4, 6, 0, -10, 23, 6, 12529 }, // ҆
-    { 12, 4, 0, -6, 26, 12, 12535 }, // ҇
-    { 34, 31, 0, -17, 23, 264, 12547 }, // ҈
-    { 34, 33, 0, -17, 24, 281, 12811 }, // ҉
-    { 21, 33, 23, 2, 27, 174, 13092 }, // Ҋ
-    { 17, 29, 19, 2, 23, 124, 13266 }, // ҋ
-    { 17, 21, 18, 0, 21, 90, 13390 }, // Ҍ
-    { 16, 23, 17, 0, 23, 92, 13480 }, // ҍ
-    { 15, 21, 18, 2, 21, 79, 13572 }, // Ҏ
-    { 15, 23, 18, 2, 16, 87, 13651 }, // ҏ
-    { 13, 26, 16, 2, 26, 85, 13738 }, // Ґ
-    { 11, 21, 13, 2, 21, 58, 13823 }, // ґ
-    { 15, 21, 15, 0, 21, 79, 13881 }, // Ғ
-    { 13, 16, 13, 0, 16, 52, 13960 }, // ғ
-    { 16, 29, 19, 2, 21, 116, 14012 }, // Ҕ
-    { 13, 24, 16, 2, 16, 78, 14128 }, // ҕ
-    { 26, 27, 26, 0, 21, 176, 14206 }, // Җ
-    { 23, 22, 23, 0, 16, 127, 14382 }, // җ
-    { 15, 29, 17, 1, 22, 109, 14509 }, // Ҙ
-    { 13, 23, 14, 0, 16, 75, 14618 }, // ҙ
-    { 18, 27, 20, 2, 21, 122, 14693 }, // Қ
-    { 14, 22, 16, 2, 16, 77, 14815 }, // қ
-    { 17, 21, 18, 2, 21, 90, 14892 }, // Ҝ
-    { 14, 16, 15, 2, 16, 56, 14982 }, // ҝ
-    { 18, 21, 18, 0, 21, 95, 15038 }, // Ҟ
-    { 16, 23, 16, 0, 23, 92, 15133 }, // ҟ
-    { 21, 21, 20, 0, 21, 111, 15225 }, // Ҡ
-    { 19, 16, 18, 0, 16, 76, 15336 }, // ҡ
-    { 20, 27, 22, 2, 21, 135, 15412 }, // Ң
-    { 17, 22, 19, 2, 16, 94, 15547 }, // ң
-    { 22, 21, 24, 2, 21, 116, 15641 }, // Ҥ
-    { 20, 16, 22, 2, 16, 80, 15757 }, // ҥ
-    { 28, 29, 31, 2, 21, 203, 15837 }, // Ҧ
-    { 23, 24, 25, 2, 16, 138, 16040 }, // ҧ
-    { 21, 24, 23, 1, 22, 126, 16178 }, // Ҩ
-    { 17, 17, 19, 1, 16, 73, 16304 }, // ҩ
-    { 17, 29, 18, 1, 22, 124, 16377 }, // Ҫ
-    { 13, 23, 14, 1, 16, 75, 16501 }, // ҫ
-    { 16, 27, 16, 0, 21, 108, 16576 }, // Ҭ
-    { 14, 22, 14, 0, 16, 77, 16684 }, // ҭ
-    { 17, 21, 17, 0, 21, 90, 16761 }, // Ү
-    { 15, 23, 15, 0, 16, 87, 16851 }, // ү
-    { 17, 21, 17, 0, 21, 90, 16938 }, // Ұ
-    { 15, 23, 15, 0, 16, 87, 17028 }, // ұ
-    { 18, 27, 18, 0, 21, 122, 17115 }, // Ҳ
-    { 16, 22, 16, 0, 16, 88, 17237 }, // ҳ
-    { 25, 27, 25, 0, 21, 169, 17325 }, // Ҵ
-    { 21, 22, 21, 0, 16, 116, 17494 }, // ҵ
-    { 19, 27, 21, 2, 21, 129, 17610 }, // Ҷ
-    { 16, 22, 18, 2, 16, 88, 17739 }, // ҷ
-    { 16, 21, 20, 2, 21, 84, 17827 }, // Ҹ
-    { 14, 16, 18, 2, 16, 56, 17911 }, // ҹ
-    { 17, 21, 20, 2, 21, 90, 17967 }, // Һ
-    { 14, 23, 18, 2, 23, 81, 18057 }, // һ
-    { 24, 23, 25, 0, 22, 138, 18138 }, // Ҽ
-    { 18, 17, 19, 0, 16, 77, 18276 }, // ҽ
-    { 24, 28, 25, 0, 22, 168, 18353 }, // Ҿ
-    { 18, 22, 19, 0, 16, 99, 18521 }, // ҿ
-    { 8, 21, 10, 1, 21, 42, 18620 }, // Ӏ
-    { 27, 27, 26, 0, 27, 183, 18662 }, // Ӂ
-    { 22, 22, 22, 0, 22, 121, 18845 }, // ӂ
-    { 17, 29, 20, 2, 21, 124, 18966 }, // Ӄ
-    { 14, 24, 16, 2, 16, 84, 19090 }, // ӄ
-    { 21, 27, 21, 0, 21, 142, 19174 }, // Ӆ
-    { 18, 22, 17, 0, 16, 99, 19316 }, // ӆ
-    { 17, 29, 21, 2, 21, 124, 19415 }, // Ӈ
-    { 15, 24, 18, 2, 16, 90, 19539 }, // ӈ
-    { 20, 27, 22, 2, 21, 135, 19629 }, // Ӊ
-    { 17, 22, 19, 2, 16, 94, 19764 }, // ӊ
-    { 16, 27, 20, 2, 21, 108, 19858 }, // Ӌ
-    { 14, 22, 18, 2, 16, 77, 19966 }, // ӌ
-    { 25, 27, 27, 2, 21, 169, 20043 }, // Ӎ
-    { 20, 22, 22, 2, 16, 110, 20212 }, // ӎ
-    { 8, 21, 10, 1, 21, 42, 20322 }, // ӏ
-    { 19, 27, 19, 0, 27, 129, 20364 }, // Ӑ
-    { 13, 23, 16, 1, 22, 75, 20493 }, // ӑ
-    { 19, 27, 19, 0, 27, 129, 20568 }, // Ӓ
-    { 13, 23, 16, 1, 22, 75, 20697 }, // ӓ
-    { 25, 21, 26, -1, 21, 132, 20772 }, // Ӕ
-    { 23, 17, 25, 1, 16, 98, 20904 }, // ӕ
-    { 13, 27, 16, 2, 27, 88, 21002 }, // Ӗ
-    { 14, 23, 16, 1, 22, 81, 21090 }, // ӗ
-    { 19, 23, 22, 1, 22, 110, 21171 }, // Ә
-    { 14, 17, 16, 1, 16, 60, 21281 }, // ә
-    { 19, 28, 22, 1, 27, 133, 21341 }, // Ӛ
-    { 14, 23, 16, 1, 22, 81, 21474 }, // ӛ
-    { 27, 27, 26, 0, 27, 183, 21555 }, // Ӝ
-    { 22, 22, 22, 0, 22, 121, 21738 }, // ӝ
-    { 15, 28, 17, 1, 27, 105, 21859 }, // Ӟ
-    { 13, 23, 14, 0, 22, 75, 21964 }, // ӟ
-    { 15, 22, 17, 1, 21, 83, 22039 }, // Ӡ
-    { 14, 23, 15, 0, 16, 81, 22122 }, // ӡ
-    { 18, 25, 22, 2, 25, 113, 22203 }, // Ӣ
-    { 14, 20, 18, 2, 20, 70, 22316 }, // ӣ
-    { 18, 27, 22, 2, 27, 122, 22386 }, // Ӥ
-    { 14, 22, 18, 2, 22, 77, 22508 }, // ӥ
-    { 20, 28, 23, 1, 27, 140, 22585 }, // Ӧ
-    { 16, 23, 18, 1, 22, 92, 22725 }, // ӧ
-    { 20, 23, 23, 1, 22, 115, 22817 }, // Ө
-    { 16, 17, 18, 1, 16, 68, 22932 }, // ө
-    { 20, 28, 23, 1, 27, 140, 23000 }, // Ӫ
-    { 16, 23, 18, 1, 22, 92, 23140 }, // ӫ
-    { 17, 28, 19, 1, 27, 119, 23232 }, // Ӭ
-    { 13, 23, 14, 1, 22, 75, 23351 }, // ӭ
-    { 18, 26, 18, 0, 25, 117, 23426 }, // Ӯ
-    { 15, 27, 15, 0, 20, 102, 23543 }, // ӯ
-    { 18, 28, 18, 0, 27, 126, 23645 }, // Ӱ
-    { 15, 29, 15, 0, 22, 109, 23771 }, // ӱ
-    { 18, 29, 18, 0, 28, 131, 23880 }, // Ӳ
-    { 15, 30, 15, 0, 23, 113, 24011 }, // ӳ
-    { 15, 27, 20, 2, 27, 102, 24124 }, // Ӵ
-    { 14, 22, 17, 1, 22, 77, 24226 }, // ӵ
-    { 13, 27, 15, 2, 21, 88, 24303 }, // Ӷ
-    { 10, 22, 13, 2, 16, 55, 24391 }, // ӷ
-    { 20, 27, 25, 2, 27, 135, 24446 }, // Ӹ
-    { 18, 22, 22, 2, 22, 99, 24581 }, // ӹ
-    { 15, 27, 15, 0, 21, 102, 24680 }, // Ӻ
-    { 13, 22, 13, 0, 16, 72, 24782 }, // ӻ
-    { 18, 27, 18, 0, 21, 122, 24854 }, // Ӽ
-    { 16, 22, 16, 0, 16, 88, 24976 }, // ӽ
-    { 17, 21, 17, 0, 21, 90, 25064 }, // Ӿ
-    { 15, 16, 15, 0, 16, 60, 25154 }, // ӿ
-    { 0, 0, 15, 0, 0, 0, 0 }, //  
-    { 0, 0, 29, 0, 0, 0, 0 }, //  
-    { 0, 0, 15, 0, 0, 0, 0 }, //  
-    { 0, 0, 29, 0, 0, 0, 0 }, //  
-    { 0, 0, 10, 0, 0, 0, 0 }, //  
-    { 0, 0, 7, 0, 0, 0, 0 }, //  
-    { 0, 0, 5, 0, 0, 0, 0 }, //  
-    { 0, 0, 17, 0, 0, 0, 0 }, //  
-    { 0, 0, 8, 0, 0, 0, 0 }, //  
-    { 0, 0, 5, 0, 0, 0, 0 }, //  
-    { 0, 0, 3, 0, 0, 0, 0 }, //  
-    { 0, 0, 0, 0, 0, 0, 0 }, // ​
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‍
-    { 8, 25, 0, -1, 21, 50, 0 }, // ‎
-    { 8, 25, 0, -7, 21, 50, 50 }, // ‏
-    { 8, 3, 9, 1, 9, 6, 100 }, // ‐
-    { 8, 3, 9, 1, 9, 6, 106 }, // ‑
-    { 15, 3, 17, 1, 12, 12, 112 }, // ‒
-    { 13, 3, 15, 1, 9, 10, 124 }, // –
-    { 27, 3, 29, 1, 9, 21, 134 }, // —
-    { 27, 3, 29, 1, 9, 21, 155 }, // ―
-    { 10, 31, 16, 3, 23, 78, 176 }, // ‖
-    { 14, 7, 12, -1, 0, 25, 254 }, // ‗
-    { 5, 8, 5, 0, 21, 10, 279 }, // ‘
-    { 5, 8, 5, 0, 21, 10, 289 }, // ’
-    { 6, 8, 7, 0, 4, 12, 299 }, // ‚
-    { 5, 8, 5, 0, 21, 10, 311 }, // ‛
-    { 11, 8, 10, 0, 21, 22, 321 }, // “
-    { 11, 8, 10, 0, 21, 22, 343 }, // ”
-    { 11, 8, 12, 0, 4, 22, 365 }, // „
-    { 11, 8, 10, 0, 21, 22, 387 }, // ‟
-    { 13, 23, 15, 1, 23, 75, 409 }, // †
-    { 13, 23, 15, 1, 23, 75, 484 }, // ‡
-    { 7, 8, 11, 2, 15, 14, 559 }, // •
-    { 9, 10, 11, 1, 16, 23, 573 }, // ‣
-    { 5, 5, 15, 5, 4, 7, 596 }, // ․
-    { 12, 5, 16, 2, 4, 15, 603 }, // ‥
-    { 19, 5, 23, 2, 4, 24, 618 }, // …
-    { 4, 5, 8, 2, 10, 5, 642 }, // ‧
-    { 0, 0, 18, 0, 0, 0, 647 }, //  
-    { 0, 0, 18, 0, 0, 0, 647 }, //  
-    { 8, 22, 0, -1, 18, 44, 647 }, // ‪
-    { 8, 22, 0, -7, 18, 44, 691 }, // ‫
-    { 8, 25, 0, -4, 21, 50, 735 }, // ‬
-    { 8, 25, 0, -4, 21, 50, 785 }, // ‭
-    { 8, 25, 0, -4, 21, 50, 835 }, // ‮
-    { 0, 0, 5, 0, 0, 0, 885 }, //  
-    { 32, 23, 34, 1, 22, 184, 885 }, // ‰
-    { 43, 23, 45, 1, 22, 248, 1069 }, // ‱
-    { 7, 8, 7, 1, 21, 14, 1317 }, // ′
-    { 12, 8, 12, 1, 21, 24, 1331 }, // ″
-    { 17, 8, 17, 1, 21, 34, 1355 }, // ‴
-    { 7, 8, 7, -1, 21, 14, 1389 }, // ‵
-    { 12, 8, 13, -1, 21, 24, 1403 }, // ‶
-    { 17, 8, 18, -1, 21, 34, 1427 }, // ‷
-    { 12, 10, 12, 0, 3, 30, 1461 }, // ‸
-    { 7, 13, 9, 1, 14, 23, 1491 }, // ‹
-    { 7, 13, 9, 1, 14, 23, 1514 }, // ›
-    { 22, 23, 24, 1, 22, 127, 1537 }, // ※
-    { 11, 22, 15, 2, 21, 61, 1664 }, // ‼
-    { 13, 23, 13, 0, 22, 75, 1725 }, // ‽
-    { 16, 3, 15, -1, 25, 12, 1800 }, // ‾
-    { 18, 7, 18, 0, 0, 32, 1812 }, // ‿
-    { 18, 8, 18, 0, 24, 36, 1844 }, // ⁀
-    { 11, 19, 11, 0, 12, 53, 1880 }, // ⁁
-    { 33, 28, 33, 0, 23, 231, 1933 }, // ⁂
-    { 8, 3, 9, 1, 9, 6, 2164 }, // ⁃
-    { 16, 21, 4, -6, 21, 84, 2170 }, // ⁄
-    { 7, 26, 9, 2, 21, 46, 2254 }, // ⁅
-    { 8, 26, 9, 0, 21, 52, 2300 }, // ⁆
-    { 25, 23, 25, 0, 22, 144, 2352 }, // ⁇
-    { 18, 23, 20, 0, 22, 104, 2496 }, // ⁈
-    { 18, 23, 20, 2, 22, 104, 2600 }, // ⁉
-    { 15, 16, 17, 1, 16, 60, 2704 }, // ⁊
-    { 16, 27, 19, 2, 23, 108, 2764 }, // ⁋
-    { 16, 15, 19, 1, 16, 60, 2872 }, // ⁌
-    { 16, 15, 19, 2, 16, 60, 2932 }, // ⁍
-    { 14, 14, 16, 1, 8, 49, 2992 }, // ⁎
-    { 6, 21, 7, 1, 17, 32, 3041 }, // ⁏
-    { 18, 31, 18, 0, 24, 140, 3073 }, // ⁐
-    { 14, 29, 16, 1, 23, 102, 3213 }, // ⁑
-    { 11, 23, 11, 0, 22, 64, 3315 }, // ⁒
-    { 25, 5, 29, 2, 11, 32, 3379 }, // ⁓
-    { 18, 7, 18, 0, 0, 32, 3411 }, // ⁔
-    { 16, 16, 17, 0, 15, 64, 3443 }, // ⁕
-    { 13, 23, 15, 1, 22, 75, 3507 }, // ⁖
-    { 22, 8, 22, 1, 21, 44, 3582 }, // ⁗
-    { 22, 23, 24, 1, 22, 127, 3626 }, // ⁘
-    { 22, 23, 24, 1, 22, 127, 3753 }, // ⁙
-    { 4, 23, 6, 1, 22, 23, 3880 }, // ⁚
-    { 17, 23, 19, 1, 22, 98, 3903 }, // ⁛
-    { 22, 23, 23, 1, 22, 127, 4001 }, // ⁜
-    { 4, 22, 8, 2, 21, 22, 4128 }, // ⁝
-    { 4, 23, 8, 2, 22, 23, 4150 }, // ⁞
-    { 0, 0, 6, 0, 0, 0, 4173 }, //  
-    { 0, 0, 18, 0, 0, 0, 4173 }, // ⁠
-    { 0, 0, 18, 0, 0, 0, 4173 }, // ⁡
-    { 0, 0, 18, 0, 0, 0, 4173 }, // ⁢
-    { 0, 0, 18, 0, 0, 0, 4173 }, // ⁣
-    { 0, 0, 18, 0, 0, 0, 4173 }, // ⁤
-    { 0, 0, 0, 0, 0, 0, 4173 }, // ⁦
-    { 0, 0, 0, 0, 0, 0, 4173 }, // ⁧
-    { 0, 0, 0, 0, 0, 0, 4173 }, // ⁨
-    { 0, 0, 0, 0, 0, 0, 4173 }, // ⁩
-    { 8, 25, 0, -4, 21, 50, 4173 }, // ⁪
-    { 8, 25, 0, -4, 21, 50, 4223 }, // ⁫
-    { 8, 25, 0, -4, 21, 50, 4273 }, // ⁬
-    { 8, 25, 0, -4, 21, 50, 4323 }, // ⁭
-    { 8, 25, 0, -4, 21, 50, 4373 }, // ⁮
-    { 8, 25, 0, -4, 21, 50, 4423 }, // ⁯
-    { 10, 14, 10, 0, 25, 35, 0 }, // ⁰
-    { 3, 14, 5, 1, 22, 11, 35 }, // ⁱ
-    { 10, 13, 10, 0, 25, 33, 46 }, // ⁴
-    { 10, 14, 10, 0, 25, 35, 79 }, // ⁵
-    { 10, 14, 10, 0, 25, 35, 114 }, // ⁶
-    { 10, 13, 10, 0, 25, 33, 149 }, // ⁷
-    { 10, 14, 10, 0, 25, 35, 182 }, // ⁸
-    { 10, 14, 10, 0, 25, 35, 217 }, // ⁹
-    { 8, 9, 10, 1, 22, 18, 252 }, // ⁺
-    { 8, 3, 10, 1, 19, 6, 270 }, // ⁻
-    { 8, 6, 10, 1, 20, 12, 276 }, // ⁼
-    { 6, 17, 7, 1, 27, 26, 288 }, // ⁽
-    { 5, 17, 7, 0, 27, 22, 314 }, // ⁾
-    { 10, 10, 12, 1, 18, 25, 336 }, // ⁿ
-    { 10, 14, 10, 0, 9, 35, 361 }, // ₀
-    { 6, 13, 10, 1, 9, 20, 396 }, // ₁
-    { 9, 13, 10, 0, 9, 30, 416 }, // ₂
-    { 10, 14, 10, 0, 9, 35, 446 }, // ₃
-    { 10, 13, 10, 0, 9, 33, 481 }, // ₄
-    { 10, 14, 10, 0, 9, 35, 514 }, // ₅
-    { 10, 14, 10, 0, 9, 35, 549 }, // ₆
-    { 10, 13, 10, 0, 9, 33, 584 }, // ₇
-    { 10, 14, 10, 0, 9, 35, 617 }, // ₈
-    { 10, 14, 10, 0, 9, 35, 652 }, // ₉
-    { 8, 9, 10, 1, 6, 18, 687 }, // ₊
-    { 8, 3, 10, 1, 3, 6, 705 }, // ₋
-    { 8, 6, 10, 1, 4, 12, 711 }, // ₌
-    { 6, 17, 7, 1, 11, 26, 723 }, // ₍
-    { 5, 17, 7, 0, 11, 22, 749 }, // ₎
-    { 10, 10, 11, 0, 7, 25, 771 }, // ₐ
-    { 9, 10, 11, 1, 7, 23, 796 }, // ₑ
-    { 10, 10, 11, 1, 7, 25, 819 }, // ₒ
-    { 10, 10, 10, 0, 7, 25, 844 }, // ₓ
-    { 10, 10, 11, 0, 7, 25, 869 }, // ₔ
-    { 10, 14, 12, 1, 11, 35, 894 }, // ₕ
-    { 9, 14, 10, 1, 11, 32, 929 }, // ₖ
-    { 3, 14, 5, 1, 11, 11, 961 }, // ₗ
-    { 16, 10, 18, 1, 7, 40, 972 }, // ₘ
-    { 10, 10, 12, 1, 7, 25, 1012 }, // ₙ
-    { 10, 14, 12, 1, 7, 35, 1037 }, // ₚ
-    { 9, 10, 9, 0, 7, 23, 1072 }, // ₛ
-    { 7, 12, 7, 0, 9, 21, 1095 }, // ₜ
-    { 15, 22, 17, 1, 22, 83, 0 }, // ₠
-    { 16, 25, 17, 1, 23, 100, 83 }, // ₡
-    { 15, 23, 17, 1, 22, 87, 183 }, // ₢
-    { 15, 21, 17, 1, 21, 79, 270 }, // ₣
-    { 16, 22, 17, 0, 22, 88, 349 }, // ₤
-    { 23, 24, 27, 2, 20, 138, 437 }, // ₥
-    { 17, 21, 17, 0, 21, 90, 575 }, // ₦
-    { 20, 22, 23, 2, 21, 110, 665 }, // ₧
-    { 22, 22, 24, 2, 21, 121, 775 }, // ₨
-    { 20, 21, 20, 0, 21, 105, 896 }, // ₩
-    { 19, 21, 23, 2, 21, 100, 1001 }, // ₪
-    { 17, 28, 18, 1, 23, 119, 1101 }, // ₫
-    { 17, 23, 17, 0, 22, 98, 1220 }, // €
-    { 17, 21, 17, 0, 21, 90, 1318 }, // ₭
-    { 17, 21, 17, 0, 21, 90, 1408 }, // ₮
-    { 28, 29, 28, 0, 22, 203, 1498 }, // ₯
-    { 16, 29, 17, 0, 22, 116, 1701 }, // ₰
-    { 17, 21, 17, 0, 21, 90, 1817 }, // ₱
-    { 19, 26, 21, 1, 23, 124, 1907 }, // ₲
-    { 18, 21, 18, 0, 21, 95, 2031 }, // ₳
-    { 16, 23, 16, 0, 22, 92, 2126 }, // ₴
-    { 17, 26, 18, 1, 23, 111, 2218 }, // ₵
-    { 18, 21, 18, 0, 20, 95, 2329 }, // ₶
-    { 20, 25, 21, 0, 22, 125, 2424 }, // ₷
-    { 16, 21, 16, 0, 21, 84, 2549 }, // ₸
-    { 13, 21, 17, 2, 21, 69, 2633 }, // ₹
-    { 16, 22, 17, 0, 21, 88, 2702 }, // ₺
-    { 23, 23, 23, 0, 22, 133, 2790 }, // ₻
-    { 21, 21, 24, 1, 21, 111, 2923 }, // ₼
-    { 16, 21, 17, 0, 21, 84, 3034 }, // ₽
-    { 20, 23, 22, 1, 23, 115, 3118 }, // ₾
-    { 14, 27, 17, 2, 24, 95, 3233 }, // ₿
-    { 12, 21, 14, 1, 16, 63, 3328 }, // ⃀
-    { 15, 3, 17, 1, 12, 12, 0 }, // −
-    { 27, 28, 29, 1, 23, 189, 0 }, // �
+    { 13, 13, 15, 1, 14, 43, 6496 }, // «
+    { 15, 9, 17, 1, 12, 34, 594 }, // ¬
+    { 8, 3, 9, 1, 9, 6, 628 }, // ­
+    { 22, 23, 24, 1, 22, 127, 634 }, // ®
+    { 16, 3, 15, -1, 25, 12, 761 }, // ¯
+    { 10, 10, 12, 1, 22, 25, 773 }, // °
+    { 15, 18, 17, 1, 18, 68, 798 }, // ±
+    { 9, 13, 10, 0, 25, 30, 866 }, // ²
+    { 10, 14, 10, 0, 25, 35, 896 }, // ³
+    { 7, 6, 8, 1, 23, 11, 931 }, // ´
+    { 14, 23, 18, 2, 16, 81, 942 }, // µ
+    { 16, 27, 19, 1, 23, 108, 1023 }, // ¶
+    { 4, 5, 8, 2, 13, 5, 1131 }, // ·
+    { 7, 7, 7, 0, 0, 13, 1136 }, // ¸
+    { 6, 13, 10, 1, 25, 20, 1149 }, // ¹
+    { 11, 11, 11, 0, 22, 31, 1169 }, // º
+    { 13, 13, 15, 1, 14, 43, 6539 }, // »
+    { 22, 21, 22, 0, 21, 116, 1200 }, // ¼
+    { 22, 21, 22, 0, 21, 116, 1316 }, // ½
+    { 23, 22, 23, 0, 22, 127, 1432 }, // ¾
+    { 13, 22, 13, 0, 16, 72, 1559 }, // ¿
+    { 19, 28, 19, 0, 28, 133, 6582 }, // À
+    { 19, 28, 19, 0, 28, 133, 6715 }, // Á
+    { 19, 28, 19, 0, 28, 133, 6848 }, // Â
+    { 19, 27, 19, 0, 27, 129, 1631 }, // Ã
+    { 19, 27, 19, 0, 27, 129, 6981 }, // Ä
+    { 19, 26, 19, 0, 26, 124, 1760 }, // Å
+    { 25, 21, 26, -1, 21, 132, 1884 }, // Æ
+    { 17, 29, 18, 1, 22, 124, 7110 }, // Ç
+    { 13, 28, 16, 2, 28, 91, 7234 }, // È
+    { 13, 28, 16, 2, 28, 91, 7325 }, // É
+    { 13, 28, 16, 2, 28, 91, 7416 }, // Ê
+    { 13, 27, 16, 2, 27, 88, 7507 }, // Ë
+    { 8, 28, 10, 1, 28, 56, 7595 }, // Ì
+    { 9, 28, 10, 1, 28, 63, 7651 }, // Í
+    { 10, 28, 10, 0, 28, 70, 7714 }, // Î
+    { 10, 27, 10, 0, 27, 68, 7784 }, // Ï
+    { 20, 21, 21, 0, 21, 105, 2016 }, // Ð
+    { 18, 27, 22, 2, 27, 122, 7852 }, // Ñ
+    { 20, 29, 23, 1, 28, 145, 7974 }, // Ò
+    { 20, 29, 23, 1, 28, 145, 8119 }, // Ó
+    { 20, 29, 23, 1, 28, 145, 8264 }, // Ô
+    { 20, 28, 23, 1, 27, 140, 2121 }, // Õ
+    { 20, 28, 23, 1, 27, 140, 8409 }, // Ö
+    { 14, 14, 17, 1, 17, 49, 2261 }, // ×
+    { 20, 23, 23, 1, 22, 115, 2310 }, // Ø
+    { 17, 29, 21, 2, 28, 124, 8549 }, // Ù
+    { 17, 29, 21, 2, 28, 124, 8673 }, // Ú
+    { 17, 29, 21, 2, 28, 124, 8797 }, // Û
+    { 17, 28, 21, 2, 27, 119, 8921 }, // Ü
+    { 17, 28, 17, 0, 28, 119, 2425 }, // Ý
+    { 15, 21, 18, 2, 21, 79, 2544 }, // Þ
+    { 16, 24, 18, 2, 23, 96, 2623 }, // ß
+    { 13, 24, 16, 1, 23, 78, 9040 }, // à
+    { 13, 24, 16, 1, 23, 78, 9118 }, // á
+    { 13, 24, 16, 1, 23, 78, 9196 }, // â
+    { 13, 23, 16, 1, 22, 75, 2719 }, // ã
+    { 13, 23, 16, 1, 22, 75, 9274 }, // ä
+    { 13, 25, 16, 1, 24, 82, 2794 }, // å
+    { 23, 17, 25, 1, 16, 98, 2876 }, // æ
+    { 13, 23, 14, 1, 16, 75, 9349 }, // ç
+    { 14, 24, 16, 1, 23, 84, 9424 }, // è
+    { 14, 24, 16, 1, 23, 84, 9508 }, // é
+    { 14, 24, 16, 1, 23, 84, 9592 }, // ê
+    { 14, 23, 16, 1, 22, 81, 9676 }, // ë
+    { 7, 23, 8, -1, 23, 41, 9757 }, // ì
+    { 7, 23, 8, 2, 23, 41, 9798 }, // í
+    { 11, 23, 8, -2, 23, 64, 9839 }, // î
+    { 9, 22, 8, -1, 22, 50, 9903 }, // ï
+    { 16, 24, 18, 1, 23, 96, 2974 }, // ð
+    { 14, 22, 18, 2, 22, 77, 9953 }, // ñ
+    { 16, 24, 18, 1, 23, 96, 10030 }, // ò
+    { 16, 24, 18, 1, 23, 96, 10126 }, // ó
+    { 16, 24, 18, 1, 23, 96, 10222 }, // ô
+    { 16, 23, 18, 1, 22, 92, 3070 }, // õ
+    { 16, 23, 18, 1, 22, 92, 10318 }, // ö
+    { 15, 14, 17, 1, 17, 53, 3162 }, // ÷
+    { 16, 18, 18, 1, 17, 72, 3215 }, // ø
+    { 14, 24, 18, 2, 23, 84, 10410 }, // ù
+    { 14, 24, 18, 2, 23, 84, 10494 }, // ú
+    { 14, 24, 18, 2, 23, 84, 10578 }, // û
+    { 14, 23, 18, 2, 22, 81, 10662 }, // ü
+    { 15, 30, 15, 0, 23, 113, 3287 }, // ý
+    { 15, 30, 18, 2, 23, 113, 3400 }, // þ
+    { 15, 29, 15, 0, 22, 109, 3513 }, // ÿ
+    { 19, 25, 19, 0, 25, 119, 3622 }, // Ā
+    { 13, 21, 16, 1, 20, 69, 3741 }, // ā
+    { 19, 27, 19, 0, 27, 129, 3810 }, // Ă
+    { 13, 23, 16, 1, 22, 75, 3939 }, // ă
+    { 19, 28, 19, 0, 21, 133, 4014 }, // Ą
+    { 14, 23, 16, 1, 16, 81, 4147 }, // ą
+    { 17, 29, 18, 1, 28, 124, 4228 }, // Ć
+    { 13, 24, 14, 1, 23, 78, 4352 }, // ć
+    { 17, 29, 18, 1, 28, 124, 4430 }, // Ĉ
+    { 13, 24, 14, 1, 23, 78, 4554 }, // ĉ
+    { 17, 28, 18, 1, 27, 119, 4632 }, // Ċ
+    { 13, 23, 14, 1, 22, 75, 4751 }, // ċ
+    { 17, 29, 18, 1, 28, 124, 4826 }, // Č
+    { 13, 24, 14, 1, 23, 78, 4950 }, // č
+    { 18, 28, 21, 2, 28, 126, 5028 }, // Ď
+    { 20, 24, 18, 1, 23, 120, 5154 }, // ď
+    { 20, 21, 21, 0, 21, 105, 5274 }, // Đ
+    { 17, 24, 18, 1, 23, 102, 5379 }, // đ
+    { 13, 25, 16, 2, 25, 82, 5481 }, // Ē
+    { 14, 21, 16, 1, 20, 74, 5563 }, // ē
+    { 13, 27, 16, 2, 27, 88, 5637 }, // Ĕ
+    { 14, 23, 16, 1, 22, 81, 5725 }, // ĕ
+    { 13, 27, 16, 2, 27, 88, 5806 }, // Ė
+    { 14, 23, 16, 1, 22, 81, 5894 }, // ė
+    { 13, 28, 16, 2, 21, 91, 5975 }, // Ę
+    { 14, 23, 16, 1, 16, 81, 6066 }, // ę
+    { 13, 28, 16, 2, 28, 91, 6147 }, // Ě
+    { 14, 24, 16, 1, 23, 84, 6238 }, // ě
+    { 19, 29, 21, 1, 28, 138, 6322 }, // Ĝ
+    { 15, 30, 18, 1, 23, 113, 6460 }, // ĝ
+    { 19, 28, 21, 1, 27, 133, 6573 }, // Ğ
+    { 15, 29, 18, 1, 22, 109, 6706 }, // ğ
+    { 19, 28, 21, 1, 27, 133, 6815 }, // Ġ
+    { 15, 29, 18, 1, 22, 109, 6948 }, // ġ
+    { 19, 29, 21, 1, 22, 138, 7057 }, // Ģ
+    { 15, 30, 18, 1, 23, 113, 7195 }, // ģ
+    { 17, 28, 22, 2, 28, 119, 7308 }, // Ĥ
+    { 18, 30, 18, -2, 30, 135, 7427 }, // ĥ
+    { 22, 21, 22, 0, 21, 116, 7562 }, // Ħ
+    { 16, 23, 18, 0, 23, 92, 7678 }, // ħ
+    { 12, 27, 10, -1, 27, 81, 7770 }, // Ĩ
+    { 12, 22, 8, -2, 22, 66, 7851 }, // ĩ
+    { 10, 25, 10, 0, 25, 63, 7917 }, // Ī
+    { 10, 20, 8, -1, 20, 50, 7980 }, // ī
+    { 10, 27, 10, 0, 27, 68, 8030 }, // Ĭ
+    { 10, 22, 8, -1, 22, 55, 8098 }, // ĭ
+    { 8, 28, 10, 1, 21, 56, 8153 }, // Į
+    { 6, 29, 8, 0, 22, 44, 8209 }, // į
+    { 8, 27, 10, 1, 27, 54, 8253 }, // İ
+    { 4, 16, 8, 2, 16, 16, 8307 }, // ı
+    { 15, 27, 18, 1, 21, 102, 8323 }, // Ĳ
+    { 11, 29, 15, 2, 22, 80, 8425 }, // ĳ
+    { 12, 34, 8, -3, 28, 102, 8505 }, // Ĵ
+    { 11, 30, 8, -2, 23, 83, 8607 }, // ĵ
+    { 17, 28, 18, 2, 21, 119, 8690 }, // Ķ
+    { 14, 30, 16, 2, 23, 105, 8809 }, // ķ
+    { 14, 16, 16, 2, 16, 56, 8914 }, // ĸ
+    { 13, 28, 15, 2, 28, 91, 8970 }, // Ĺ
+    { 7, 30, 8, 2, 30, 53, 9061 }, // ĺ
+    { 13, 28, 15, 2, 21, 91, 9114 }, // Ļ
+    { 5, 30, 8, 1, 23, 38, 9205 }, // ļ
+    { 13, 21, 15, 2, 21, 69, 9243 }, // Ľ
+    { 8, 23, 8, 2, 23, 46, 9312 }, // ľ
+    { 13, 21, 15, 2, 21, 69, 9358 }, // Ŀ
+    { 8, 23, 8, 2, 23, 46, 9427 }, // ŀ
+    { 15, 21, 15, 0, 21, 79, 9473 }, // Ł
+    { 9, 23, 8, -1, 23, 52, 9552 }, // ł
+    { 18, 28, 22, 2, 28, 126, 9604 }, // Ń
+    { 14, 23, 18, 2, 23, 81, 9730 }, // ń
+    { 18, 28, 22, 2, 21, 126, 9811 }, // Ņ
+    { 14, 23, 18, 2, 16, 81, 9937 }, // ņ
+    { 18, 28, 22, 2, 28, 126, 10018 }, // Ň
+    { 14, 23, 18, 2, 23, 81, 10144 }, // ň
+    { 18, 21, 20, 0, 21, 95, 10225 }, // ŉ
+    { 18, 27, 22, 2, 21, 122, 10320 }, // Ŋ
+    { 14, 23, 18, 2, 16, 81, 10442 }, // ŋ
+    { 20, 26, 23, 1, 25, 130, 10523 }, // Ō
+    { 16, 21, 18, 1, 20, 84, 10653 }, // ō
+    { 20, 28, 23, 1, 27, 140, 10737 }, // Ŏ
+    { 16, 23, 18, 1, 22, 92, 10877 }, // ŏ
+    { 20, 29, 23, 1, 28, 145, 10969 }, // Ő
+    { 16, 24, 18, 1, 23, 96, 11114 }, // ő
+    { 25, 23, 27, 1, 22, 144, 10743 }, // Œ
+    { 26, 17, 28, 1, 16, 111, 10887 }, // œ
+    { 16, 28, 18, 2, 28, 112, 11210 }, // Ŕ
+    { 10, 23, 12, 2, 23, 58, 11322 }, // ŕ
+    { 16, 28, 18, 2, 21, 112, 11380 }, // Ŗ
+    { 11, 23, 12, 1, 16, 64, 11492 }, // ŗ
+    { 16, 28, 18, 2, 28, 112, 11556 }, // Ř
+    { 10, 23, 12, 2, 23, 58, 11668 }, // ř
+    { 14, 29, 16, 1, 28, 102, 11726 }, // Ś
+    { 12, 24, 14, 1, 23, 72, 11828 }, // ś
+    { 14, 29, 16, 1, 28, 102, 11900 }, // Ŝ
+    { 12, 24, 14, 1, 23, 72, 12002 }, // ŝ
+    { 14, 29, 16, 1, 22, 102, 12074 }, // Ş
+    { 12, 23, 14, 1, 16, 69, 12176 }, // ş
+    { 14, 29, 16, 1, 28, 102, 12245 }, // Š
+    { 12, 24, 14, 1, 23, 72, 12347 }, // š
+    { 16, 28, 16, 0, 21, 112, 12419 }, // Ţ
+    { 10, 27, 11, 0, 20, 68, 12531 }, // ţ
+    { 16, 28, 16, 0, 28, 112, 12599 }, // Ť
+    { 14, 24, 11, 0, 23, 84, 12711 }, // ť
+    { 16, 21, 16, 0, 21, 84, 12795 }, // Ŧ
+    { 10, 21, 11, 0, 20, 53, 12879 }, // ŧ
+    { 17, 28, 21, 2, 27, 119, 12932 }, // Ũ
+    { 14, 23, 18, 2, 22, 81, 13051 }, // ũ
+    { 17, 26, 21, 2, 25, 111, 13132 }, // Ū
+    { 14, 21, 18, 2, 20, 74, 13243 }, // ū
+    { 17, 28, 21, 2, 27, 119, 13317 }, // Ŭ
+    { 14, 23, 18, 2, 22, 81, 13436 }, // ŭ
+    { 17, 30, 21, 2, 29, 128, 13517 }, // Ů
+    { 14, 25, 18, 2, 24, 88, 13645 }, // ů
+    { 17, 29, 21, 2, 28, 124, 13733 }, // Ű
+    { 14, 24, 18, 2, 23, 84, 13857 }, // ű
+    { 17, 28, 21, 2, 21, 119, 13941 }, // Ų
+    { 14, 23, 18, 2, 16, 81, 14060 }, // ų
+    { 27, 28, 27, 0, 28, 189, 14141 }, // Ŵ
+    { 23, 23, 23, 0, 23, 133, 14330 }, // ŵ
+    { 17, 28, 17, 0, 28, 119, 14463 }, // Ŷ
+    { 15, 30, 15, 0, 23, 113, 14582 }, // ŷ
+    { 17, 27, 17, 0, 27, 115, 14695 }, // Ÿ
+    { 15, 28, 17, 1, 28, 105, 14810 }, // Ź
+    { 12, 23, 14, 1, 23, 69, 14915 }, // ź
+    { 15, 27, 17, 1, 27, 102, 14984 }, // Ż
+    { 12, 22, 14, 1, 22, 66, 15086 }, // ż
+    { 15, 28, 17, 1, 28, 105, 15152 }, // Ž
+    { 12, 23, 14, 1, 23, 69, 15257 }, // ž
+    { 9, 23, 10, 2, 23, 52, 15326 }, // ſ
+    { 7, 6, 0, -15, 23, 11, 15378 }, // ̀
+    { 7, 6, 0, -10, 23, 11, 15389 }, // ́
+    { 10, 6, 0, -5, 23, 15, 15400 }, // ̂
+    { 12, 5, 0, -15, 22, 15, 15415 }, // ̃
+    { 10, 3, 0, -5, 20, 8, 15430 }, // ̄
+    { 14, 3, 0, -7, 25, 11, 15438 }, // ̅
+    { 10, 5, 0, -5, 22, 13, 15449 }, // ̆
+    { 4, 4, 0, -2, 22, 4, 15462 }, // ̇
+    { 10, 4, 0, -5, 22, 10, 15466 }, // ̈
+    { 6, 7, 0, -11, 24, 11, 15476 }, // ̉
+    { 8, 7, 0, -4, 24, 14, 15487 }, // ̊
+    { 11, 6, 0, -4, 23, 17, 15501 }, // ̋
+    { 10, 6, 0, -5, 23, 15, 15518 }, // ̌
+    { 4, 6, 0, -2, 23, 6, 15533 }, // ̍
+    { 8, 6, 0, -4, 23, 12, 15539 }, // ̎
+    { 12, 6, 0, -16, 23, 18, 15551 }, // ̏
+    { 10, 8, 0, -5, 25, 20, 15569 }, // ̐
+    { 10, 5, 0, -5, 22, 13, 15589 }, // ̑
+    { 6, 8, 0, -3, 21, 12, 15602 }, // ̒
+    { 6, 8, 0, -3, 21, 12, 15614 }, // ̓
+    { 6, 8, 0, -3, 21, 12, 15626 }, // ̔
+    { 6, 8, 0, -3, 21, 12, 15638 }, // ̕
+    { 6, 6, 0, -3, -1, 9, 15650 }, // ̖
+    { 6, 6, 0, -3, -1, 9, 15659 }, // ̗
+    { 6, 7, 0, -3, 0, 11, 15668 }, // ̘
+    { 6, 7, 0, -3, 0, 11, 15679 }, // ̙
+    { 8, 8, 9, 0, 23, 16, 15690 }, // ̚
+    { 7, 7, 0, -3, 23, 13, 15706 }, // ̛
+    { 4, 7, 0, -2, 0, 7, 15719 }, // ̜
+    { 8, 6, 0, -4, -1, 12, 15726 }, // ̝
+    { 8, 6, 0, -4, -1, 12, 15738 }, // ̞
+    { 8, 7, 0, -4, 0, 14, 15750 }, // ̟
+    { 8, 3, 0, -4, -3, 6, 15764 }, // ̠
+    { 6, 9, 0, -6, 2, 14, 15770 }, // ̡
+    { 6, 9, 0, 0, 2, 14, 15784 }, // ̢
+    { 4, 5, 0, -11, -1, 5, 15798 }, // ̣
+    { 10, 4, 0, -5, -2, 10, 15803 }, // ̤
+    { 8, 7, 0, -4, 0, 14, 15813 }, // ̥
+    { 4, 6, 0, -2, -1, 6, 15827 }, // ̦
+    { 6, 7, 0, -3, 0, 11, 15833 }, // ̧
+    { 6, 8, 0, -3, 1, 12, 15844 }, // ̨
+    { 4, 6, 0, -2, 0, 6, 15856 }, // ̩
+    { 12, 6, 0, -6, -1, 18, 15862 }, // ̪
+    { 12, 5, 0, -6, -1, 15, 15880 }, // ̫
+    { 10, 6, 0, -5, 0, 15, 15895 }, // ̬
+    { 10, 6, 0, -5, -1, 15, 15910 }, // ̭
+    { 10, 5, 0, -5, -1, 13, 15925 }, // ̮
+    { 10, 5, 0, -5, -1, 13, 15938 }, // ̯
+    { 12, 5, 0, -6, -1, 15, 15951 }, // ̰
+    { 10, 3, 0, -5, -2, 8, 15966 }, // ̱
+    { 14, 3, 0, -7, -2, 11, 15974 }, // ̲
+    { 14, 7, 0, -7, 0, 25, 15985 }, // ̳
+    { 12, 5, 0, -6, 10, 15, 16010 }, // ̴
+    { 14, 3, 0, -7, 10, 11, 16025 }, // ̵
+    { 22, 3, 0, -11, 10, 17, 16036 }, // ̶
+    { 10, 7, 0, -5, 12, 18, 16053 }, // ̷
+    { 12, 25, 0, -6, 23, 75, 16071 }, // ̸
+    { 4, 7, 0, -2, 0, 7, 16146 }, // ̹
+    { 12, 6, 0, -6, -1, 18, 16153 }, // ̺
+    { 12, 7, 0, -6, 0, 21, 16171 }, // ̻
+    { 12, 5, 0, -6, -1, 15, 16192 }, // ̼
+    { 6, 7, 0, -3, 23, 11, 16207 }, // ̽
+    { 4, 10, 0, -2, 26, 10, 16218 }, // ̾
+    { 14, 7, 0, -7, 29, 25, 16228 }, // ̿
+    { 7, 6, 0, -5, 23, 11, 16253 }, // ̀
+    { 7, 6, 0, -2, 23, 11, 16264 }, // ́
+    { 12, 5, 0, -6, 22, 15, 16275 }, // ͂
+    { 5, 6, 0, -3, 23, 8, 16290 }, // ̓
+    { 11, 6, 0, -5, 23, 17, 16298 }, // ̈́
+    { 6, 5, 0, -2, -2, 8, 16315 }, // ͅ
+    { 14, 6, 0, -7, 23, 21, 16323 }, // ͆
+    { 14, 7, 0, -7, 0, 25, 16344 }, // ͇
+    { 8, 6, 0, -4, 0, 12, 16369 }, // ͈
+    { 6, 6, 0, -3, -1, 9, 16381 }, // ͉
+    { 12, 7, 0, -6, 23, 21, 16390 }, // ͊
+    { 12, 11, 0, -6, 27, 33, 16411 }, // ͋
+    { 10, 9, 0, -5, 26, 23, 16444 }, // ͌
+    { 12, 6, 0, -6, -1, 18, 16467 }, // ͍
+    { 6, 7, 0, -3, 0, 11, 16485 }, // ͎
+    { 22, 21, 0, -11, 21, 116, 16496 }, // ͏
+    { 6, 7, 0, -3, 24, 11, 16612 }, // ͐
+    { 4, 7, 0, -2, 24, 7, 16623 }, // ͑
+    { 10, 8, 0, -5, 25, 20, 16630 }, // ͒
+    { 6, 7, 0, -3, 0, 11, 16650 }, // ͓
+    { 6, 6, 0, -3, -1, 9, 16661 }, // ͔
+    { 6, 6, 0, -3, -1, 9, 16670 }, // ͕
+    { 12, 6, 0, -6, -1, 18, 16679 }, // ͖
+    { 4, 7, 0, -2, 24, 7, 16697 }, // ͗
+    { 4, 4, 0, 3, 22, 4, 16704 }, // ͘
+    { 8, 6, 0, -4, -1, 12, 16708 }, // ͙
+    { 12, 7, 0, -6, 0, 21, 16720 }, // ͚
+    { 6, 6, 0, -3, 23, 9, 16741 }, // ͛
+    { 24, 6, 0, -12, -1, 36, 16750 }, // ͜
+    { 24, 6, 0, -12, 23, 36, 16786 }, // ͝
+    { 18, 2, 0, -9, 20, 9, 16822 }, // ͞
+    { 18, 2, 0, -9, -2, 9, 16831 }, // ͟
+    { 24, 5, 0, -12, 22, 30, 16840 }, // ͠
+    { 24, 6, 0, -12, 25, 36, 16870 }, // ͡
+    { 23, 6, 0, -11, -1, 35, 16906 }, // ͢
+    { 6, 8, 0, -3, 25, 12, 16941 }, // ͣ
+    { 7, 8, 0, -3, 25, 14, 16953 }, // ͤ
+    { 2, 9, 0, -1, 27, 5, 16967 }, // ͥ
+    { 7, 8, 0, -3, 25, 14, 16972 }, // ͦ
+    { 7, 8, 0, -3, 25, 14, 16986 }, // ͧ
+    { 6, 8, 0, -3, 25, 12, 17000 }, // ͨ
+    { 7, 10, 0, -3, 27, 18, 17012 }, // ͩ
+    { 7, 9, 0, -3, 27, 16, 17030 }, // ͪ
+    { 11, 7, 0, -5, 25, 20, 17046 }, // ͫ
+    { 5, 7, 0, -2, 25, 9, 17066 }, // ͬ
+    { 5, 9, 0, -2, 26, 12, 17075 }, // ͭ
+    { 8, 7, 0, -4, 25, 14, 17087 }, // ͮ
+    { 7, 7, 0, -3, 25, 13, 17101 }, // ͯ
+    { 13, 28, 16, 2, 28, 91, 17114 }, // Ѐ
+    { 13, 27, 16, 2, 27, 88, 0 }, // Ё
+    { 20, 22, 21, 0, 21, 110, 17205 }, // Ђ
+    { 13, 28, 15, 2, 28, 91, 17315 }, // Ѓ
+    { 17, 23, 19, 1, 22, 98, 17406 }, // Є
+    { 14, 23, 16, 1, 22, 81, 17504 }, // Ѕ
+    { 4, 21, 8, 2, 21, 21, 17585 }, // І
+    { 8, 27, 8, 0, 27, 54, 17606 }, // Ї
+    { 9, 27, 8, -3, 21, 61, 17660 }, // Ј
+    { 28, 22, 29, 0, 21, 154, 17721 }, // Љ
+    { 27, 21, 30, 2, 21, 142, 17875 }, // Њ
+    { 20, 21, 21, 0, 21, 105, 18017 }, // Ћ
+    { 16, 28, 18, 2, 28, 112, 18122 }, // Ќ
+    { 18, 28, 22, 2, 28, 126, 18234 }, // Ѝ
+    { 18, 28, 18, 0, 27, 126, 18360 }, // Ў
+    { 17, 26, 21, 2, 21, 111, 18486 }, // Џ
+    { 19, 21, 19, 0, 21, 100, 88 }, // А
+    { 15, 21, 18, 2, 21, 79, 188 }, // Б
+    { 16, 21, 19, 2, 21, 84, 267 }, // В
+    { 13, 21, 15, 2, 21, 69, 351 }, // Г
+    { 21, 26, 21, 0, 21, 137, 420 }, // Д
+    { 13, 21, 16, 2, 21, 69, 557 }, // Е
+    { 27, 21, 26, 0, 21, 142, 626 }, // Ж
+    { 15, 23, 17, 1, 22, 87, 768 }, // З
+    { 18, 21, 22, 2, 21, 95, 855 }, // И
+    { 18, 27, 22, 2, 27, 122, 950 }, // Й
+    { 16, 21, 18, 2, 21, 84, 1072 }, // К
+    { 18, 22, 20, 0, 21, 99, 1156 }, // Л
+    { 22, 21, 26, 2, 21, 116, 1255 }, // М
+    { 17, 21, 22, 2, 21, 90, 1371 }, // Н
+    { 20, 23, 22, 1, 22, 115, 1461 }, // О
+    { 17, 21, 21, 2, 21, 90, 1576 }, // П
+    { 15, 21, 18, 2, 21, 79, 1666 }, // Р
+    { 17, 23, 19, 1, 22, 98, 1745 }, // С
+    { 16, 21, 16, 0, 21, 84, 1843 }, // Т
+    { 18, 22, 18, 0, 21, 99, 1927 }, // У
+    { 22, 23, 24, 1, 22, 127, 2026 }, // Ф
+    { 17, 21, 17, 0, 21, 90, 2153 }, // Х
+    { 20, 26, 22, 2, 21, 130, 2243 }, // Ц
+    { 15, 21, 20, 2, 21, 79, 2373 }, // Ч
+    { 26, 21, 30, 2, 21, 137, 2452 }, // Ш
+    { 28, 26, 30, 2, 21, 182, 2589 }, // Щ
+    { 19, 21, 20, 0, 21, 100, 2771 }, // Ъ
+    { 20, 21, 25, 2, 21, 105, 2871 }, // Ы
+    { 15, 21, 18, 2, 21, 79, 2976 }, // Ь
+    { 17, 23, 19, 1, 22, 98, 3055 }, // Э
+    { 26, 23, 29, 2, 22, 150, 3153 }, // Ю
+    { 16, 21, 19, 0, 21, 84, 3303 }, // Я
+    { 13, 17, 16, 1, 16, 56, 3387 }, // а
+    { 16, 24, 17, 1, 23, 96, 3443 }, // б
+    { 14, 16, 16, 2, 16, 56, 3539 }, // в
+    { 11, 16, 13, 2, 16, 44, 3595 }, // г
+    { 18, 21, 18, 0, 16, 95, 3639 }, // д
+    { 14, 17, 16, 1, 16, 60, 3734 }, // е
+    { 22, 16, 22, 0, 16, 88, 3794 }, // ж
+    { 13, 17, 14, 0, 16, 56, 3882 }, // з
+    { 14, 16, 18, 2, 16, 56, 3938 }, // и
+    { 14, 22, 18, 2, 22, 77, 3994 }, // й
+    { 14, 16, 15, 2, 16, 56, 4071 }, // к
+    { 15, 17, 17, 0, 16, 64, 4127 }, // л
+    { 18, 16, 22, 2, 16, 72, 4191 }, // м
+    { 14, 16, 18, 2, 16, 56, 4263 }, // н
+    { 15, 17, 17, 1, 16, 64, 4319 }, // о
+    { 14, 16, 18, 2, 16, 56, 4383 }, // п
+    { 15, 23, 18, 2, 16, 87, 4439 }, // р
+    { 13, 17, 14, 1, 16, 56, 4526 }, // с
+    { 14, 16, 14, 0, 16, 56, 4582 }, // т
+    { 15, 23, 15, 0, 16, 87, 4638 }, // у
+    { 20, 30, 22, 1, 23, 150, 4725 }, // ф
+    { 15, 16, 15, 0, 16, 60, 4875 }, // х
+    { 16, 21, 18, 2, 16, 84, 4935 }, // ц
+    { 14, 16, 17, 1, 16, 56, 5019 }, // ч
+    { 22, 16, 26, 2, 16, 88, 5075 }, // ш
+    { 24, 21, 26, 2, 16, 126, 5163 }, // щ
+    { 17, 16, 18, 0, 16, 68, 5289 }, // ъ
+    { 18, 16, 22, 2, 16, 72, 5357 }, // ы
+    { 13, 16, 16, 2, 16, 52, 5429 }, // ь
+    { 13, 17, 14, 1, 16, 56, 5481 }, // э
+    { 20, 17, 23, 2, 16, 85, 5537 }, // ю
+    { 14, 16, 17, 1, 16, 56, 5622 }, // я
+    { 14, 24, 16, 1, 23, 84, 18597 }, // ѐ
+    { 14, 23, 16, 1, 22, 81, 5678 }, // ё
+    { 16, 30, 18, 0, 23, 120, 18681 }, // ђ
+    { 11, 23, 13, 2, 23, 64, 18801 }, // ѓ
+    { 13, 17, 14, 1, 16, 56, 18865 }, // є
+    { 12, 17, 14, 1, 16, 51, 18921 }, // ѕ
+    { 4, 22, 8, 2, 22, 22, 18972 }, // і
+    { 7, 22, 8, 0, 22, 39, 18994 }, // ї
+    { 8, 29, 8, -2, 22, 58, 19033 }, // ј
+    { 24, 17, 25, 0, 16, 102, 19091 }, // љ
+    { 23, 16, 26, 2, 16, 92, 19193 }, // њ
+    { 16, 23, 18, 0, 23, 92, 19285 }, // ћ
+    { 14, 23, 15, 2, 23, 81, 19377 }, // ќ
+    { 14, 23, 18, 2, 23, 81, 19458 }, // ѝ
+    { 15, 29, 15, 0, 22, 109, 19539 }, // ў
+    { 14, 21, 18, 2, 16, 74, 19648 }, // џ
+    { 27, 22, 27, 0, 21, 149, 19722 }, // Ѡ
+    { 23, 16, 23, 0, 16, 92, 19871 }, // ѡ
+    { 19, 21, 20, 0, 21, 100, 19963 }, // Ѣ
+    { 17, 19, 19, 0, 19, 81, 20063 }, // ѣ
+    { 25, 23, 27, 2, 22, 144, 20144 }, // Ѥ
+    { 19, 17, 22, 2, 16, 81, 20288 }, // ѥ
+    { 20, 21, 20, 0, 21, 105, 20369 }, // Ѧ
+    { 17, 16, 17, 0, 16, 68, 20474 }, // ѧ
+    { 26, 21, 27, 2, 21, 137, 20542 }, // Ѩ
+    { 21, 16, 23, 2, 16, 84, 20679 }, // ѩ
+    { 21, 21, 21, 0, 21, 111, 20763 }, // Ѫ
+    { 19, 16, 19, 0, 16, 76, 20874 }, // ѫ
+    { 27, 21, 29, 2, 21, 142, 20950 }, // Ѭ
+    { 23, 16, 25, 2, 16, 92, 21092 }, // ѭ
+    { 16, 32, 17, 0, 25, 128, 21184 }, // Ѯ
+    { 13, 26, 14, 0, 20, 85, 21312 }, // ѯ
+    { 20, 21, 23, 2, 21, 105, 21397 }, // Ѱ
+    { 18, 30, 22, 2, 23, 135, 21502 }, // ѱ
+    { 20, 23, 23, 1, 22, 115, 21637 }, // Ѳ
+    { 16, 17, 18, 1, 16, 68, 21752 }, // ѳ
+    { 20, 21, 19, 0, 21, 105, 21820 }, // Ѵ
+    { 16, 16, 15, 0, 16, 64, 21925 }, // ѵ
+    { 20, 28, 19, 0, 28, 140, 21989 }, // Ѷ
+    { 16, 23, 15, 0, 23, 92, 22129 }, // ѷ
+    { 35, 29, 36, 1, 22, 254, 22221 }, // Ѹ
+    { 31, 23, 32, 1, 16, 179, 22475 }, // ѹ
+    { 22, 25, 24, 1, 23, 138, 22654 }, // Ѻ
+    { 17, 20, 19, 1, 18, 85, 22792 }, // ѻ
+    { 28, 32, 30, 1, 31, 224, 22877 }, // Ѽ
+    { 24, 27, 26, 1, 26, 162, 23101 }, // ѽ
+    { 27, 27, 27, 0, 26, 183, 23263 }, // Ѿ
+    { 23, 21, 23, 0, 21, 121, 23446 }, // ѿ
+    { 17, 29, 19, 1, 22, 124, 23567 }, // Ҁ
+    { 13, 23, 14, 1, 16, 75, 23691 }, // ҁ
+    { 16, 20, 18, 1, 19, 80, 23766 }, // ҂
+    { 12, 5, 0, -14, 21, 15, 23846 }, // ҃
+    { 12, 5, 0, -14, 22, 15, 23861 }, // ҄
+    { 5, 6, 0, -11, 23, 8, 23876 }, // ҅
+    { 4, 6, 0, -10, 23, 6, 23884 }, // ҆
+    { 12, 4, 0, -6, 26, 12, 23890 }, // ҇
+    { 34, 31, 0, -17, 23, 264, 23902 }, // ҈
+    { 34, 33, 0, -17, 24, 281, 24166 }, // ҉
+    { 21, 33, 23, 2, 27, 174, 24447 }, // Ҋ
+    { 17, 29, 19, 2, 23, 124, 24621 }, // ҋ
+    { 17, 21, 18, 0, 21, 90, 24745 }, // Ҍ
+    { 16, 23, 17, 0, 23, 92, 24835 }, // ҍ
+    { 15, 21, 18, 2, 21, 79, 24927 }, // Ҏ
+    { 15, 23, 18, 2, 16, 87, 25006 }, // ҏ
+    { 13, 26, 16, 2, 26, 85, 25093 }, // Ґ
+    { 11, 21, 13, 2, 21, 58, 0 }, // ґ
+    { 15, 21, 15, 0, 21, 79, 58 }, // Ғ
+    { 13, 16, 13, 0, 16, 52, 137 }, // ғ
+    { 16, 29, 19, 2, 21, 116, 189 }, // Ҕ
+    { 13, 24, 16, 2, 16, 78, 305 }, // ҕ
+    { 26, 27, 26, 0, 21, 176, 383 }, // Җ
+    { 23, 22, 23, 0, 16, 127, 559 }, // җ
+    { 15, 29, 17, 1, 22, 109, 686 }, // Ҙ
+    { 13, 23, 14, 0, 16, 75, 795 }, // ҙ
+    { 18, 27, 20, 2, 21, 122, 870 }, // Қ
+    { 14, 22, 16, 2, 16, 77, 992 }, // қ
+    { 17, 21, 18, 2, 21, 90, 1069 }, // Ҝ
+    { 14, 16, 15, 2, 16, 56, 1159 }, // ҝ
+    { 18, 21, 18, 0, 21, 95, 1215 }, // Ҟ
+    { 16, 23, 16, 0, 23, 92, 1310 }, // ҟ
+    { 21, 21, 20, 0, 21, 111, 1402 }, // Ҡ
+    { 19, 16, 18, 0, 16, 76, 1513 }, // ҡ
+    { 20, 27, 22, 2, 21, 135, 1589 }, // Ң
+    { 17, 22, 19, 2, 16, 94, 1724 }, // ң
+    { 22, 21, 24, 2, 21, 116, 1818 }, // Ҥ
+    { 20, 16, 22, 2, 16, 80, 1934 }, // ҥ
+    { 28, 29, 31, 2, 21, 203, 2014 }, // Ҧ
+    { 23, 24, 25, 2, 16, 138, 2217 }, // ҧ
+    { 21, 24, 23, 1, 22, 126, 2355 }, // Ҩ
+    { 17, 17, 19, 1, 16, 73, 2481 }, // ҩ
+    { 17, 29, 18, 1, 22, 124, 2554 }, // Ҫ
+    { 13, 23, 14, 1, 16, 75, 2678 }, // ҫ
+    { 16, 27, 16, 0, 21, 108, 2753 }, // Ҭ
+    { 14, 22, 14, 0, 16, 77, 2861 }, // ҭ
+    { 17, 21, 17, 0, 21, 90, 2938 }, // Ү
+    { 15, 23, 15, 0, 16, 87, 3028 }, // ү
+    { 17, 21, 17, 0, 21, 90, 3115 }, // Ұ
+    { 15, 23, 15, 0, 16, 87, 3205 }, // ұ
+    { 18, 27, 18, 0, 21, 122, 3292 }, // Ҳ
+    { 16, 22, 16, 0, 16, 88, 3414 }, // ҳ
+    { 25, 27, 25, 0, 21, 169, 3502 }, // Ҵ
+    { 21, 22, 21, 0, 16, 116, 3671 }, // ҵ
+    { 19, 27, 21, 2, 21, 129, 3787 }, // Ҷ
+    { 16, 22, 18, 2, 16, 88, 3916 }, // ҷ
+    { 16, 21, 20, 2, 21, 84, 4004 }, // Ҹ
+    { 14, 16, 18, 2, 16, 56, 4088 }, // ҹ
+    { 17, 21, 20, 2, 21, 90, 4144 }, // Һ
+    { 14, 23, 18, 2, 23, 81, 4234 }, // һ
+    { 24, 23, 25, 0, 22, 138, 4315 }, // Ҽ
+    { 18, 17, 19, 0, 16, 77, 4453 }, // ҽ
+    { 24, 28, 25, 0, 22, 168, 4530 }, // Ҿ
+    { 18, 22, 19, 0, 16, 99, 4698 }, // ҿ
+    { 8, 21, 10, 1, 21, 42, 4797 }, // Ӏ
+    { 27, 27, 26, 0, 27, 183, 4839 }, // Ӂ
+    { 22, 22, 22, 0, 22, 121, 5022 }, // ӂ
+    { 17, 29, 20, 2, 21, 124, 5143 }, // Ӄ
+    { 14, 24, 16, 2, 16, 84, 5267 }, // ӄ
+    { 21, 27, 21, 0, 21, 142, 5351 }, // Ӆ
+    { 18, 22, 17, 0, 16, 99, 5493 }, // ӆ
+    { 17, 29, 21, 2, 21, 124, 5592 }, // Ӈ
+    { 15, 24, 18, 2, 16, 90, 5716 }, // ӈ
+    { 20, 27, 22, 2, 21, 135, 5806 }, // Ӊ
+    { 17, 22, 19, 2, 16, 94, 5941 }, // ӊ
+    { 16, 27, 20, 2, 21, 108, 6035 }, // Ӌ
+    { 14, 22, 18, 2, 16, 77, 6143 }, // ӌ
+    { 25, 27, 27, 2, 21, 169, 6220 }, // Ӎ
+    { 20, 22, 22, 2, 16, 110, 6389 }, // ӎ
+    { 8, 21, 10, 1, 21, 42, 6499 }, // ӏ
+    { 19, 27, 19, 0, 27, 129, 6541 }, // Ӑ
+    { 13, 23, 16, 1, 22, 75, 6670 }, // ӑ
+    { 19, 27, 19, 0, 27, 129, 6745 }, // Ӓ
+    { 13, 23, 16, 1, 22, 75, 6874 }, // ӓ
+    { 25, 21, 26, -1, 21, 132, 6949 }, // Ӕ
+    { 23, 17, 25, 1, 16, 98, 7081 }, // ӕ
+    { 13, 27, 16, 2, 27, 88, 7179 }, // Ӗ
+    { 14, 23, 16, 1, 22, 81, 7267 }, // ӗ
+    { 19, 23, 22, 1, 22, 110, 7348 }, // Ә
+    { 14, 17, 16, 1, 16, 60, 7458 }, // ә
+    { 19, 28, 22, 1, 27, 133, 7518 }, // Ӛ
+    { 14, 23, 16, 1, 22, 81, 7651 }, // ӛ
+    { 27, 27, 26, 0, 27, 183, 7732 }, // Ӝ
+    { 22, 22, 22, 0, 22, 121, 7915 }, // ӝ
+    { 15, 28, 17, 1, 27, 105, 8036 }, // Ӟ
+    { 13, 23, 14, 0, 22, 75, 8141 }, // ӟ
+    { 15, 22, 17, 1, 21, 83, 8216 }, // Ӡ
+    { 14, 23, 15, 0, 16, 81, 8299 }, // ӡ
+    { 18, 25, 22, 2, 25, 113, 8380 }, // Ӣ
+    { 14, 20, 18, 2, 20, 70, 8493 }, // ӣ
+    { 18, 27, 22, 2, 27, 122, 8563 }, // Ӥ
+    { 14, 22, 18, 2, 22, 77, 8685 }, // ӥ
+    { 20, 28, 23, 1, 27, 140, 8762 }, // Ӧ
+    { 16, 23, 18, 1, 22, 92, 8902 }, // ӧ
+    { 20, 23, 23, 1, 22, 115, 8994 }, // Ө
+    { 16, 17, 18, 1, 16, 68, 9109 }, // ө
+    { 20, 28, 23, 1, 27, 140, 9177 }, // Ӫ
+    { 16, 23, 18, 1, 22, 92, 9317 }, // ӫ
+    { 17, 28, 19, 1, 27, 119, 9409 }, // Ӭ
+    { 13, 23, 14, 1, 22, 75, 9528 }, // ӭ
+    { 18, 26, 18, 0, 25, 117, 9603 }, // Ӯ
+    { 15, 27, 15, 0, 20, 102, 9720 }, // ӯ
+    { 18, 28, 18, 0, 27, 126, 9822 }, // Ӱ
+    { 15, 29, 15, 0, 22, 109, 9948 }, // ӱ
+    { 18, 29, 18, 0, 28, 131, 10057 }, // Ӳ
+    { 15, 30, 15, 0, 23, 113, 10188 }, // ӳ
+    { 15, 27, 20, 2, 27, 102, 10301 }, // Ӵ
+    { 14, 22, 17, 1, 22, 77, 10403 }, // ӵ
+    { 13, 27, 15, 2, 21, 88, 10480 }, // Ӷ
+    { 10, 22, 13, 2, 16, 55, 10568 }, // ӷ
+    { 20, 27, 25, 2, 27, 135, 10623 }, // Ӹ
+    { 18, 22, 22, 2, 22, 99, 10758 }, // ӹ
+    { 15, 27, 15, 0, 21, 102, 10857 }, // Ӻ
+    { 13, 22, 13, 0, 16, 72, 10959 }, // ӻ
+    { 18, 27, 18, 0, 21, 122, 11031 }, // Ӽ
+    { 16, 22, 16, 0, 16, 88, 11153 }, // ӽ
+    { 17, 21, 17, 0, 21, 90, 11241 }, // Ӿ
+    { 15, 16, 15, 0, 16, 60, 11331 }, // ӿ
+    { 0, 0, 15, 0, 0, 0, 11391 }, //  
+    { 0, 0, 29, 0, 0, 0, 11391 }, //  
+    { 0, 0, 15, 0, 0, 0, 11391 }, //  
+    { 0, 0, 29, 0, 0, 0, 11391 }, //  
+    { 0, 0, 10, 0, 0, 0, 11391 }, //  
+    { 0, 0, 7, 0, 0, 0, 11391 }, //  
+    { 0, 0, 5, 0, 0, 0, 11391 }, //  
+    { 0, 0, 17, 0, 0, 0, 11391 }, //  
+    { 0, 0, 8, 0, 0, 0, 11391 }, //  
+    { 0, 0, 5, 0, 0, 0, 11391 }, //  
+    { 0, 0, 3, 0, 0, 0, 11391 }, //  
+    { 0, 0, 0, 0, 0, 0, 11391 }, // ​
+    { 0, 0, 0, 0, 0, 0, 11391 }, // ‌
+    { 0, 0, 0, 0, 0, 0, 11391 }, // ‍
+    { 8, 25, 0, -1, 21, 50, 11391 }, // ‎
+    { 8, 25, 0, -7, 21, 50, 11441 }, // ‏
+    { 8, 3, 9, 1, 9, 6, 11491 }, // ‐
+    { 8, 3, 9, 1, 9, 6, 11497 }, // ‑
+    { 15, 3, 17, 1, 12, 12, 11503 }, // ‒
+    { 13, 3, 15, 1, 9, 10, 10998 }, // –
+    { 27, 3, 29, 1, 9, 21, 11008 }, // —
+    { 27, 3, 29, 1, 9, 21, 11515 }, // ―
+    { 10, 31, 16, 3, 23, 78, 11536 }, // ‖
+    { 14, 7, 12, -1, 0, 25, 11614 }, // ‗
+    { 5, 8, 5, 0, 21, 10, 11029 }, // ‘
+    { 5, 8, 5, 0, 21, 10, 11039 }, // ’
+    { 6, 8, 7, 0, 4, 12, 11639 }, // ‚
+    { 5, 8, 5, 0, 21, 10, 11651 }, // ‛
+    { 11, 8, 10, 0, 21, 22, 11049 }, // “
+    { 11, 8, 10, 0, 21, 22, 11071 }, // ”
+    { 11, 8, 12, 0, 4, 22, 11661 }, // „
+    { 11, 8, 10, 0, 21, 22, 11683 }, // ‟
+    { 13, 23, 15, 1, 23, 75, 11705 }, // †
+    { 13, 23, 15, 1, 23, 75, 11780 }, // ‡
+    { 7, 8, 11, 2, 15, 14, 11855 }, // •
+    { 9, 10, 11, 1, 16, 23, 11869 }, // ‣
+    { 5, 5, 15, 5, 4, 7, 11892 }, // ․
+    { 12, 5, 16, 2, 4, 15, 11899 }, // ‥
+    { 19, 5, 23, 2, 4, 24, 11093 }, // …
+    { 4, 5, 8, 2, 10, 5, 11914 }, // ‧
+    { 0, 0, 18, 0, 0, 0, 11919 }, //  
+    { 0, 0, 18, 0, 0, 0, 11919 }, //  
+    { 8, 22, 0, -1, 18, 44, 11919 }, // ‪
+    { 8, 22, 0, -7, 18, 44, 11963 }, // ‫
+    { 8, 25, 0, -4, 21, 50, 12007 }, // ‬
+    { 8, 25, 0, -4, 21, 50, 12057 }, // ‭
+    { 8, 25, 0, -4, 21, 50, 12107 }, // ‮
+    { 0, 0, 5, 0, 0, 0, 12157 }, //  
+    { 32, 23, 34, 1, 22, 184, 12157 }, // ‰
+    { 43, 23, 45, 1, 22, 248, 12341 }, // ‱
+    { 7, 8, 7, 1, 21, 14, 12589 }, // ′
+    { 12, 8, 12, 1, 21, 24, 12603 }, // ″
+    { 17, 8, 17, 1, 21, 34, 12627 }, // ‴
+    { 7, 8, 7, -1, 21, 14, 12661 }, // ‵
+    { 12, 8, 13, -1, 21, 24, 12675 }, // ‶
+    { 17, 8, 18, -1, 21, 34, 12699 }, // ‷
+    { 12, 10, 12, 0, 3, 30, 12733 }, // ‸
+    { 7, 13, 9, 1, 14, 23, 12763 }, // ‹
+    { 7, 13, 9, 1, 14, 23, 12786 }, // ›
+    { 22, 23, 24, 1, 22, 127, 12809 }, // ※
+    { 11, 22, 15, 2, 21, 61, 12936 }, // ‼
+    { 13, 23, 13, 0, 22, 75, 12997 }, // ‽
+    { 16, 3, 15, -1, 25, 12, 13072 }, // ‾
+    { 18, 7, 18, 0, 0, 32, 13084 }, // ‿
+    { 18, 8, 18, 0, 24, 36, 13116 }, // ⁀
+    { 11, 19, 11, 0, 12, 53, 13152 }, // ⁁
+    { 33, 28, 33, 0, 23, 231, 13205 }, // ⁂
+    { 8, 3, 9, 1, 9, 6, 13436 }, // ⁃
+    { 16, 21, 4, -6, 21, 84, 13442 }, // ⁄
+    { 7, 26, 9, 2, 21, 46, 13526 }, // ⁅
+    { 8, 26, 9, 0, 21, 52, 13572 }, // ⁆
+    { 25, 23, 25, 0, 22, 144, 13624 }, // ⁇
+    { 18, 23, 20, 0, 22, 104, 13768 }, // ⁈
+    { 18, 23, 20, 2, 22, 104, 13872 }, // ⁉
+    { 15, 16, 17, 1, 16, 60, 13976 }, // ⁊
+    { 16, 27, 19, 2, 23, 108, 14036 }, // ⁋
+    { 16, 15, 19, 1, 16, 60, 14144 }, // ⁌
+    { 16, 15, 19, 2, 16, 60, 14204 }, // ⁍
+    { 14, 14, 16, 1, 8, 49, 14264 }, // ⁎
+    { 6, 21, 7, 1, 17, 32, 14313 }, // ⁏
+    { 18, 31, 18, 0, 24, 140, 14345 }, // ⁐
+    { 14, 29, 16, 1, 23, 102, 14485 }, // ⁑
+    { 11, 23, 11, 0, 22, 64, 14587 }, // ⁒
+    { 25, 5, 29, 2, 11, 32, 14651 }, // ⁓
+    { 18, 7, 18, 0, 0, 32, 14683 }, // ⁔
+    { 16, 16, 17, 0, 15, 64, 14715 }, // ⁕
+    { 13, 23, 15, 1, 22, 75, 14779 }, // ⁖
+    { 22, 8, 22, 1, 21, 44, 14854 }, // ⁗
+    { 22, 23, 24, 1, 22, 127, 14898 }, // ⁘
+    { 22, 23, 24, 1, 22, 127, 15025 }, // ⁙
+    { 4, 23, 6, 1, 22, 23, 15152 }, // ⁚
+    { 17, 23, 19, 1, 22, 98, 15175 }, // ⁛
+    { 22, 23, 23, 1, 22, 127, 15273 }, // ⁜
+    { 4, 22, 8, 2, 21, 22, 15400 }, // ⁝
+    { 4, 23, 8, 2, 22, 23, 15422 }, // ⁞
+    { 0, 0, 6, 0, 0, 0, 15445 }, //  
+    { 0, 0, 18, 0, 0, 0, 15445 }, // ⁠
+    { 0, 0, 18, 0, 0, 0, 15445 }, // ⁡
+    { 0, 0, 18, 0, 0, 0, 15445 }, // ⁢
+    { 0, 0, 18, 0, 0, 0, 15445 }, // ⁣
+    { 0, 0, 18, 0, 0, 0, 15445 }, // ⁤
+    { 0, 0, 0, 0, 0, 0, 15445 }, // ⁦
+    { 0, 0, 0, 0, 0, 0, 15445 }, // ⁧
+    { 0, 0, 0, 0, 0, 0, 15445 }, // ⁨
+    { 0, 0, 0, 0, 0, 0, 15445 }, // ⁩
+    { 8, 25, 0, -4, 21, 50, 15445 }, // ⁪
+    { 8, 25, 0, -4, 21, 50, 15495 }, // ⁫
+    { 8, 25, 0, -4, 21, 50, 15545 }, // ⁬
+    { 8, 25, 0, -4, 21, 50, 15595 }, // ⁭
+    { 8, 25, 0, -4, 21, 50, 15645 }, // ⁮
+    { 8, 25, 0, -4, 21, 50, 15695 }, // ⁯
+    { 10, 14, 10, 0, 25, 35, 15745 }, // ⁰
+    { 3, 14, 5, 1, 22, 11, 15780 }, // ⁱ
+    { 10, 13, 10, 0, 25, 33, 15791 }, // ⁴
+    { 10, 14, 10, 0, 25, 35, 15824 }, // ⁵
+    { 10, 14, 10, 0, 25, 35, 15859 }, // ⁶
+    { 10, 13, 10, 0, 25, 33, 15894 }, // ⁷
+    { 10, 14, 10, 0, 25, 35, 15927 }, // ⁸
+    { 10, 14, 10, 0, 25, 35, 15962 }, // ⁹
+    { 8, 9, 10, 1, 22, 18, 15997 }, // ⁺
+    { 8, 3, 10, 1, 19, 6, 16015 }, // ⁻
+    { 8, 6, 10, 1, 20, 12, 16021 }, // ⁼
+    { 6, 17, 7, 1, 27, 26, 16033 }, // ⁽
+    { 5, 17, 7, 0, 27, 22, 16059 }, // ⁾
+    { 10, 10, 12, 1, 18, 25, 16081 }, // ⁿ
+    { 10, 14, 10, 0, 9, 35, 16106 }, // ₀
+    { 6, 13, 10, 1, 9, 20, 16141 }, // ₁
+    { 9, 13, 10, 0, 9, 30, 16161 }, // ₂
+    { 10, 14, 10, 0, 9, 35, 16191 }, // ₃
+    { 10, 13, 10, 0, 9, 33, 16226 }, // ₄
+    { 10, 14, 10, 0, 9, 35, 16259 }, // ₅
+    { 10, 14, 10, 0, 9, 35, 16294 }, // ₆
+    { 10, 13, 10, 0, 9, 33, 16329 }, // ₇
+    { 10, 14, 10, 0, 9, 35, 16362 }, // ₈
+    { 10, 14, 10, 0, 9, 35, 16397 }, // ₉
+    { 8, 9, 10, 1, 6, 18, 16432 }, // ₊
+    { 8, 3, 10, 1, 3, 6, 16450 }, // ₋
+    { 8, 6, 10, 1, 4, 12, 16456 }, // ₌
+    { 6, 17, 7, 1, 11, 26, 16468 }, // ₍
+    { 5, 17, 7, 0, 11, 22, 16494 }, // ₎
+    { 10, 10, 11, 0, 7, 25, 16516 }, // ₐ
+    { 9, 10, 11, 1, 7, 23, 16541 }, // ₑ
+    { 10, 10, 11, 1, 7, 25, 16564 }, // ₒ
+    { 10, 10, 10, 0, 7, 25, 16589 }, // ₓ
+    { 10, 10, 11, 0, 7, 25, 16614 }, // ₔ
+    { 10, 14, 12, 1, 11, 35, 16639 }, // ₕ
+    { 9, 14, 10, 1, 11, 32, 16674 }, // ₖ
+    { 3, 14, 5, 1, 11, 11, 16706 }, // ₗ
+    { 16, 10, 18, 1, 7, 40, 16717 }, // ₘ
+    { 10, 10, 12, 1, 7, 25, 16757 }, // ₙ
+    { 10, 14, 12, 1, 7, 35, 16782 }, // ₚ
+    { 9, 10, 9, 0, 7, 23, 16817 }, // ₛ
+    { 7, 12, 7, 0, 9, 21, 16840 }, // ₜ
+    { 15, 22, 17, 1, 22, 83, 16861 }, // ₠
+    { 16, 25, 17, 1, 23, 100, 16944 }, // ₡
+    { 15, 23, 17, 1, 22, 87, 17044 }, // ₢
+    { 15, 21, 17, 1, 21, 79, 17131 }, // ₣
+    { 16, 22, 17, 0, 22, 88, 17210 }, // ₤
+    { 23, 24, 27, 2, 20, 138, 17298 }, // ₥
+    { 17, 21, 17, 0, 21, 90, 17436 }, // ₦
+    { 20, 22, 23, 2, 21, 110, 17526 }, // ₧
+    { 22, 22, 24, 2, 21, 121, 17636 }, // ₨
+    { 20, 21, 20, 0, 21, 105, 17757 }, // ₩
+    { 19, 21, 23, 2, 21, 100, 17862 }, // ₪
+    { 17, 28, 18, 1, 23, 119, 17962 }, // ₫
+    { 17, 23, 17, 0, 22, 98, 18081 }, // €
+    { 17, 21, 17, 0, 21, 90, 18179 }, // ₭
+    { 17, 21, 17, 0, 21, 90, 18269 }, // ₮
+    { 28, 29, 28, 0, 22, 203, 18359 }, // ₯
+    { 16, 29, 17, 0, 22, 116, 18562 }, // ₰
+    { 17, 21, 17, 0, 21, 90, 18678 }, // ₱
+    { 19, 26, 21, 1, 23, 124, 18768 }, // ₲
+    { 18, 21, 18, 0, 21, 95, 18892 }, // ₳
+    { 16, 23, 16, 0, 22, 92, 18987 }, // ₴
+    { 17, 26, 18, 1, 23, 111, 19079 }, // ₵
+    { 18, 21, 18, 0, 20, 95, 19190 }, // ₶
+    { 20, 25, 21, 0, 22, 125, 19285 }, // ₷
+    { 16, 21, 16, 0, 21, 84, 19410 }, // ₸
+    { 13, 21, 17, 2, 21, 69, 19494 }, // ₹
+    { 16, 22, 17, 0, 21, 88, 19563 }, // ₺
+    { 23, 23, 23, 0, 22, 133, 19651 }, // ₻
+    { 21, 21, 24, 1, 21, 111, 19784 }, // ₼
+    { 16, 21, 17, 0, 21, 84, 19895 }, // ₽
+    { 20, 23, 22, 1, 23, 115, 19979 }, // ₾
+    { 14, 27, 17, 2, 24, 95, 20094 }, // ₿
+    { 12, 21, 14, 1, 16, 63, 20189 }, // ⃀
+    { 15, 3, 17, 1, 12, 12, 20252 }, // −
+    { 22, 23, 20, 0, 23, 127, 20264 }, // ﬀ
+    { 16, 23, 18, 0, 23, 92, 20391 }, // ﬁ
+    { 16, 23, 18, 0, 23, 92, 20483 }, // ﬂ
+    { 26, 23, 28, 0, 23, 150, 20575 }, // ﬃ
+    { 26, 23, 28, 0, 23, 150, 20725 }, // ﬄ
+    { 17, 24, 20, 2, 23, 102, 20875 }, // ﬅ
+    { 23, 24, 25, 1, 23, 138, 20977 }, // ﬆ
+    { 27, 28, 29, 1, 23, 189, 21115 }, // �
 };
 
 static const EpdUnicodeInterval notosans_14_regularIntervals[] = {
@@ -2625,31 +2631,297 @@ static const EpdUnicodeInterval notosans_14_regularIntervals[] = {
     { 0x2090, 0x209C, 0x33D },
     { 0x20A0, 0x20C0, 0x34A },
     { 0x2212, 0x2212, 0x36B },
-    { 0xFFFD, 0xFFFD, 0x36C },
+    { 0xFB00, 0xFB06, 0x36C },
+    { 0xFFFD, 0xFFFD, 0x373 },
 };
 
 static const EpdFontGroup notosans_14_regularGroups[] = {
-    { 0, 3347, 6496, 97, 0 },
-    { 3347, 3348, 7869, 96, 97 },
-    { 6695, 4330, 12011, 128, 193 },
-    { 11025, 1189, 1736, 112, 321 },
-    { 12214, 10383, 25214, 256, 433 },
-    { 22597, 2156, 4473, 111, 689 },
-    { 24753, 612, 1116, 42, 800 },
-    { 25365, 2013, 3391, 33, 842 },
-    { 27378, 13, 12, 1, 875 },
-    { 27391, 112, 189, 1, 876 },
+    { 0, 4535, 11117, 151, 2 },
+    { 4535, 2705, 5759, 66, 434 },
+    { 7240, 10615, 25178, 368, 0 },
+    { 17855, 9621, 21304, 299, 578 },
+};
+
+static const uint8_t notosans_14_regularGlyphGroups[884] = {
+    2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2,
+    2, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 2, 2,
+    2, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 0, 0, 3, 3, 3, 0, 0, 3, 3, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+};
+
+static const uint8_t notosans_14_regularKernLeftClasses[884] = {
+    0, 0, 0, 0, 2, 0, 0, 0, 63, 2, 26, 0, 0, 0, 6, 35,
+    6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 0, 0, 0,
+    0, 0, 0, 12, 0, 39, 16, 32, 55, 0, 0, 0, 0, 39, 21, 0,
+    0, 16, 42, 16, 0, 0, 13, 41, 38, 38, 39, 17, 64, 26, 0, 0,
+    0, 69, 0, 0, 30, 61, 0, 30, 48, 0, 0, 0, 0, 0, 0, 0,
+    0, 30, 30, 0, 23, 0, 61, 0, 33, 33, 70, 33, 0, 26, 0, 0,
+    0, 0, 67, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 31, 0, 0, 0,
+    54, 12, 12, 12, 12, 12, 12, 32, 39, 32, 32, 32, 32, 0, 0, 0,
+    0, 16, 0, 16, 16, 16, 16, 16, 0, 16, 41, 41, 41, 41, 17, 42,
+    0, 0, 0, 0, 0, 0, 0, 30, 0, 30, 30, 30, 30, 0, 0, 68,
+    68, 30, 0, 30, 30, 30, 30, 30, 0, 30, 0, 0, 0, 0, 33, 30,
+    33, 12, 0, 12, 0, 46, 0, 39, 0, 39, 0, 39, 0, 39, 0, 16,
+    29, 16, 0, 32, 30, 32, 30, 32, 30, 32, 30, 32, 30, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 59, 0, 68, 0, 0, 73,
+    0, 0, 0, 0, 0, 0, 0, 39, 0, 70, 21, 0, 21, 0, 21, 29,
+    21, 0, 21, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 30, 16,
+    30, 16, 30, 32, 30, 0, 23, 0, 23, 0, 23, 0, 0, 0, 0, 0,
+    0, 0, 0, 13, 61, 13, 44, 13, 61, 41, 0, 41, 0, 41, 0, 41,
+    0, 41, 0, 41, 0, 38, 33, 17, 33, 17, 64, 0, 64, 0, 64, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 58, 58, 24, 15, 25, 41, 0, 0, 0, 18, 18, 24, 10, 0, 1,
+    0, 8, 0, 72, 15, 3, 58, 10, 72, 0, 0, 10, 0, 0, 0, 11,
+    0, 22, 25, 15, 1, 45, 10, 3, 0, 0, 3, 18, 0, 18, 11, 11,
+    0, 47, 56, 51, 27, 4, 5, 20, 51, 37, 37, 20, 37, 37, 37, 5,
+    37, 5, 50, 27, 14, 5, 20, 4, 37, 37, 4, 7, 37, 7, 5, 5,
+    37, 5, 5, 57, 27, 50, 65, 0, 66, 71, 7, 7, 60, 20, 37, 14,
+    37, 11, 49, 43, 7, 25, 50, 8, 40, 8, 40, 0, 0, 0, 0, 41,
+    0, 0, 5, 11, 5, 1, 49, 1, 49, 14, 14, 11, 5, 11, 5, 11,
+    49, 25, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 4, 43, 7, 22,
+    5, 9, 34, 19, 52, 0, 0, 36, 0, 41, 51, 36, 0, 10, 20, 10,
+    20, 10, 20, 3, 4, 19, 34, 0, 0, 0, 5, 25, 50, 9, 34, 28,
+    41, 28, 41, 36, 0, 3, 4, 3, 4, 0, 0, 0, 0, 37, 62, 37,
+    62, 0, 10, 20, 0, 0, 3, 4, 0, 0, 3, 4, 0, 0, 3, 4,
+    0, 8, 47, 8, 47, 58, 62, 58, 62, 11, 5, 11, 5, 10, 20, 41,
+    51, 0, 0, 0, 37, 0, 37, 11, 5, 11, 5, 11, 5, 11, 5, 1,
+    14, 1, 14, 1, 14, 0, 37, 9, 34, 0, 37, 19, 52, 36, 0, 10,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 35, 35, 35, 0, 0, 2, 2, 6, 0, 2, 2, 6,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 31, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 0, 0, 0,
+    0, 0, 0, 0,
+};
+
+static const uint8_t notosans_14_regularKernRightClasses[884] = {
+    0, 0, 0, 67, 5, 0, 0, 0, 51, 5, 0, 42, 0, 0, 2, 28,
+    2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 39, 0, 0,
+    0, 54, 0, 7, 0, 3, 0, 0, 0, 3, 0, 0, 43, 0, 0, 0,
+    0, 3, 0, 3, 0, 0, 18, 47, 30, 30, 60, 23, 0, 0, 0, 42,
+    0, 0, 0, 20, 58, 1, 1, 1, 0, 24, 58, 0, 69, 58, 58, 17,
+    17, 1, 17, 1, 17, 24, 0, 17, 22, 22, 22, 22, 51, 0, 0, 42,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 0, 0, 0,
+    0, 7, 7, 7, 7, 7, 7, 62, 3, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 3, 3, 3, 3, 3, 0, 3, 47, 47, 47, 47, 23, 0,
+    0, 1, 20, 20, 20, 20, 20, 20, 1, 1, 1, 1, 1, 0, 0, 0,
+    0, 0, 0, 1, 1, 1, 1, 1, 0, 1, 17, 17, 17, 17, 22, 58,
+    22, 7, 20, 7, 20, 7, 20, 3, 1, 3, 1, 3, 1, 3, 1, 0,
+    1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 3, 24, 3,
+    24, 3, 24, 3, 24, 0, 58, 0, 68, 0, 61, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 58, 17, 0, 58, 0, 58, 0, 58,
+    0, 58, 0, 0, 0, 17, 0, 17, 0, 0, 0, 0, 17, 3, 1, 3,
+    1, 3, 1, 3, 1, 0, 17, 0, 17, 0, 0, 0, 24, 0, 0, 0,
+    24, 0, 0, 18, 0, 18, 0, 18, 0, 47, 17, 47, 17, 47, 17, 47,
+    17, 47, 17, 47, 17, 30, 22, 23, 22, 23, 0, 51, 0, 51, 0, 51,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4, 0, 31, 64, 0, 0, 34, 26, 0, 4, 0, 0, 11,
+    0, 8, 0, 0, 0, 40, 0, 13, 66, 0, 0, 0, 26, 0, 0, 31,
+    0, 0, 31, 4, 11, 50, 13, 0, 16, 0, 0, 4, 0, 0, 66, 0,
+    53, 6, 59, 39, 39, 19, 15, 10, 32, 39, 39, 39, 29, 39, 39, 15,
+    39, 39, 15, 21, 14, 15, 10, 39, 9, 39, 39, 21, 39, 39, 32, 39,
+    56, 15, 15, 38, 39, 15, 63, 0, 65, 44, 29, 39, 38, 39, 39, 14,
+    39, 12, 48, 55, 0, 0, 25, 8, 19, 0, 25, 0, 0, 0, 25, 66,
+    0, 16, 0, 12, 6, 52, 48, 52, 48, 12, 6, 12, 6, 12, 6, 12,
+    48, 12, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 25, 55, 38, 0,
+    25, 0, 25, 55, 0, 0, 25, 13, 10, 66, 32, 0, 25, 0, 25, 0,
+    38, 36, 21, 0, 25, 0, 25, 0, 25, 12, 6, 12, 6, 4, 21, 46,
+    57, 46, 57, 13, 10, 36, 21, 16, 9, 16, 9, 0, 25, 35, 37, 35,
+    37, 0, 13, 10, 0, 25, 45, 19, 0, 25, 0, 25, 16, 9, 0, 25,
+    0, 8, 41, 8, 41, 8, 41, 0, 6, 0, 41, 0, 41, 13, 10, 66,
+    32, 0, 0, 0, 39, 0, 39, 12, 6, 12, 6, 12, 6, 66, 32, 11,
+    14, 11, 14, 11, 14, 16, 9, 0, 25, 0, 39, 55, 0, 13, 10, 13,
+    10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 28, 28, 28, 0, 0, 33, 5, 2, 0, 33, 5, 2,
+    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27, 49, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0,
+};
+
+static const int8_t notosans_14_regularKernMatrix[5180] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 1, -1, 0, -4, -1, -1, 0, 0, 0, 0, -2, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, -3, -1, -1, -1, 0, -1, -1, 0, 0, -1, 0, -1, 1, 0, -3, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0,
+    0, -2, 0, 0, 1, 0, -1, -2, -2, 0, 0, 1, 0, 1, 1, 0, 0, -1, 1, -2, -1, 1, 0, 0, -1, 0, -1, 0, 0, -1, 1, 0, 1, 0, 0, 0, 1, 0, 1, 0, -2, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, -2, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 1, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 1, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 1, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, -1, 0, 0, 0, 0, -2, 0, -1, -1, 0, 0, 0, -2, 0, -2, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 2, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, -2, 0, 0, 0, -1, -1, -1, 0, 0, -1, 0, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, -2, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 1, 0, -2, 0, -2, -1, -1, 0, -1, 0, -1, 0, 0, 0, 0, -2, 0, -1, 0, 0, 0, -1, -1, -2, -1, 0, 0, -1, -1, 0, 0, -1, 0, -2, 0, 0, -1, -2, 0, 0, 0, -1, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, -2, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 1, 0, -2, 0, -1, 0, -2, 0, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 1, 1, -1, 0, -2, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -2, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, -3, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 1, 0, -1, 0, -2, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, 1, -1, 1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -4, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -2, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -5, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, -2, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 3, 2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, -1, 0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, -1, 0, -2, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -2, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -4, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0,
+    0, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0,
+    0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const EpdLigaturePair notosans_14_regularLigatures[] = {
+    { 0x66, 0x66, 0xFB00 },
+    { 0x66, 0x69, 0xFB01 },
+    { 0x66, 0x6C, 0xFB02 },
+    { 0xFB00, 0x69, 0xFB03 },
+    { 0xFB00, 0x6C, 0xFB04 },
+};
+
+static const uint16_t notosans_14_regularGlyphLookup[368] = {
+    0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0001, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, 0x0010, 0x0011,
+    0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, 0x0020, 0x0021,
+    0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, 0x0030, 0x0031,
+    0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, 0x0040, 0x0041,
+    0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051,
+    0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, 0x0060, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070,
+    0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, 0x0080,
+    0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F, 0x0090,
+    0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F, 0x00A0,
+    0x00A1, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF, 0x00B0,
+    0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF, 0x00C0,
+    0x02B1, 0x02B2, 0x02B3, 0x02B4, 0x02B5, 0x02B6, 0x02B7, 0x02B8, 0x02B9, 0x02BA, 0x02BB, 0x02BC, 0x02BD, 0x02BE, 0x02BF, 0x02C0,
+    0x02C1, 0x02C2, 0x02C3, 0x02C4, 0x02C5, 0x02C6, 0x02C7, 0x02C8, 0x02C9, 0x02CA, 0x02CB, 0x02CC, 0x02CD, 0x02CE, 0x02CF, 0x02D0,
+    0x02D1, 0x02D2, 0x02D3, 0x02D4, 0x02D5, 0x02D6, 0x02D7, 0x02D8, 0x02D9, 0x02DA, 0x02DB, 0x02DC, 0x02DD, 0x02DE, 0x02DF, 0x02E0,
+    0x02E1, 0x02E2, 0x02E3, 0x02E4, 0x02E5, 0x02E6, 0x02E7, 0x02E8, 0x02E9, 0x02EA, 0x02EB, 0x02EC, 0x02ED, 0x02EE, 0x02EF, 0x02F0,
+    0x02F1, 0x02F2, 0x02F3, 0x02F4, 0x02F5, 0x02F6, 0x02F7, 0x02F8, 0x02F9, 0x02FA, 0x02FB, 0x02FC, 0x02FD, 0x02FE, 0x02FF, 0x0300,
+    0x0301, 0x0302, 0x0303, 0x0304, 0x0305, 0x0306, 0x0307, 0x0308, 0x0309, 0x030A, 0x030B, 0x030C, 0x030D, 0x030E, 0x030F, 0x0310,
+    0x0311, 0x0312, 0x0313, 0x0314, 0x0315, 0xFFFF, 0x0316, 0x0317, 0x0318, 0x0319, 0x031A, 0x031B, 0x031C, 0x031D, 0x031E, 0x031F,
 };
 
 static const EpdFontData notosans_14_regular = {
     notosans_14_regularBitmaps,
     notosans_14_regularGlyphs,
     notosans_14_regularIntervals,
-    15,
+    16,
     40,
     32,
     -9,
     true,
     notosans_14_regularGroups,
-    10,
+    4,
+    notosans_14_regularKernLeftClasses,
+    notosans_14_regularKernRightClasses,
+    notosans_14_regularKernMatrix,
+    70,
+    notosans_14_regularLigatures,
+    5,
+    0x4000000001ull,
+    notosans_14_regularGlyphLookup,
+    notosans_14_regularGlyphGroups,
+    false,
+    nullptr,
 };
@@ -3,2151 +3,2186 @@
  * name: notosans_16_bold
  * size: 16
  * mode: 2-bit  compressed: true
- * Command used: fontconvert.py notosans_16_bold 16 ../builtinFonts/source/NotoSans/NotoSans-Bold.ttf --2bit --compress
+ * Command used: fontconvert.py notosans_16_bold 16 ../builtinFonts/source/NotoSans/NotoSans-Bold.ttf --2bit --compress --frequency-corpus ../../../test/hyphenation_eval/resources/english_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/french_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/german_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/italian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/russian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/spanish_hyphenation_tests.txt
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t notosans_16_boldBitmaps[34209] = {
-    0xCD, 0x5A, 0xBF, 0x8F, 0xDF, 0xC6, 0x95, 0x1F, 0x7E, 0xBF, 0xD9, 0x25, 0x60, 0x16, 0x74, 0x91,
-    0xBD, 0xC0, 0x27, 0xE0, 0xD8, 0x1E, 0x10, 0x20, 0x6C, 0xAF, 0x1B, 0x4A, 0x2E, 0x54, 0xA8, 0xD0,
-    0x22, 0xD8, 0x75, 0x0A, 0x15, 0xAA, 0x0C, 0x5C, 0x14, 0x20, 0xFB, 0x1F, 0x84, 0x5F, 0xDB, 0x38,
-    0xB8, 0x50, 0x21, 0x15, 0xB9, 0x5C, 0x91, 0xC2, 0x29, 0x92, 0xC0, 0x58, 0xE3, 0x6E, 0x9B, 0x2B,
-    0x8C, 0x03, 0xEE, 0x86, 0xD6, 0x16, 0x2E, 0xB6, 0x58, 0x9E, 0x75, 0x8E, 0x0B, 0x15, 0x4B, 0x9D,
-    0x94, 0xF3, 0x41, 0x2E, 0x96, 0xB2, 0xB9, 0x11, 0x57, 0x22, 0xE7, 0xDD, 0xE7, 0xF3, 0x86, 0xDF,
-    0xD5, 0x4A, 0xB2, 0x22, 0x09, 0x71, 0x71, 0x5F, 0x2D, 0xC9, 0xE1, 0x70, 0x38, 0xF3, 0xDE, 0x9B,
-    0xF7, 0xE3, 0xF3, 0x1E, 0x65, 0x3B, 0xB9, 0x29, 0x17, 0x47, 0xCB, 0x4B, 0x3A, 0xE4, 0xAD, 0xBB,
-    0x21, 0xC9, 0x90, 0xB5, 0xE5, 0x27, 0x12, 0xF7, 0x2B, 0x85, 0x31, 0x26, 0xEE, 0xF1, 0xEC, 0x8E,
-    0x5C, 0x18, 0xA2, 0x42, 0xDE, 0xF5, 0xF2, 0x9E, 0xE0, 0xEC, 0xC2, 0xDF, 0xD9, 0xB1, 0x0C, 0x7F,
-    0x66, 0x30, 0x66, 0x8C, 0x5B, 0x63, 0xCA, 0x19, 0x5A, 0x79, 0xE5, 0x8D, 0x49, 0x5B, 0xBB, 0x30,
-    0xF3, 0x3E, 0xAD, 0x97, 0x4F, 0xCE, 0x0D, 0xC6, 0x0A, 0x7E, 0x29, 0x4F, 0xBB, 0x3C, 0xB5, 0x9B,
-    0xFE, 0xD2, 0xD1, 0xBA, 0x3E, 0x31, 0x59, 0xE5, 0x8C, 0x49, 0xF0, 0x4E, 0xCC, 0x27, 0xB7, 0x79,
-    0xEA, 0x4B, 0x9C, 0xFC, 0xCA, 0xD6, 0xE7, 0xB2, 0x59, 0x24, 0x8F, 0x67, 0xF3, 0x71, 0x67, 0x8C,
-    0x3D, 0x7B, 0xFA, 0x1D, 0x50, 0x49, 0x4A, 0x3F, 0xC6, 0xF1, 0x23, 0x1C, 0x5B, 0x0F, 0x8B, 0x19,
-    0xDE, 0x9C, 0x4F, 0xEB, 0xDC, 0x96, 0x5B, 0xBF, 0x6A, 0xDD, 0x67, 0xCD, 0xF7, 0xF2, 0xEE, 0x63,
-    0x13, 0xCB, 0xCF, 0x8D, 0x11, 0x59, 0x98, 0x4C, 0x8E, 0x4D, 0x24, 0xD2, 0x99, 0x24, 0xDC, 0x0D,
-    0x06, 0xEF, 0x14, 0xE6, 0x63, 0x69, 0xCC, 0x8F, 0xD2, 0x71, 0x91, 0xBC, 0xEF, 0xDD, 0xAF, 0x1E,
-    0xC9, 0x16, 0xDE, 0xDF, 0xC3, 0x51, 0x39, 0x8E, 0xFA, 0xD9, 0xD1, 0xA9, 0x55, 0x12, 0x2E, 0x1B,
-    0x7E, 0x52, 0x9B, 0xD9, 0x88, 0xD9, 0x46, 0x34, 0x39, 0x7B, 0x65, 0x5C, 0x61, 0xCA, 0xBD, 0xDE,
-    0x80, 0xB4, 0xBC, 0x16, 0x63, 0x2B, 0x88, 0x23, 0xAF, 0xB2, 0xC6, 0xCC, 0x87, 0xA4, 0x4B, 0x21,
-    0x0D, 0x99, 0x8D, 0x71, 0x0F, 0x36, 0x2A, 0xF7, 0xE6, 0xA0, 0xB2, 0xBA, 0x31, 0xAE, 0xFE, 0x66,
-    0x36, 0xA6, 0x2D, 0xC4, 0xB3, 0xB0, 0xB7, 0x7A, 0x77, 0x51, 0xFA, 0x44, 0x06, 0x7B, 0xD5, 0x8B,
-    0x91, 0xD1, 0xEE, 0x0E, 0x59, 0xB3, 0xFA, 0xBF, 0x59, 0x23, 0xF3, 0x30, 0x7A, 0x21, 0xDC, 0x97,
-    0xAC, 0xC1, 0xC4, 0xF3, 0x01, 0x62, 0x69, 0xB9, 0xBE, 0xE7, 0x43, 0x2E, 0x86, 0x87, 0xAE, 0x48,
-    0x3A, 0xB7, 0xC0, 0xFA, 0x11, 0xA9, 0xC1, 0xB0, 0x1C, 0x34, 0x62, 0xFD, 0x08, 0x17, 0xFE, 0xA2,
-    0x13, 0xDA, 0xCF, 0x08, 0xF9, 0xA0, 0x20, 0x0C, 0x04, 0x06, 0x0E, 0x62, 0x39, 0xC4, 0x04, 0xC9,
-    0x38, 0xE7, 0x79, 0x98, 0xE9, 0x99, 0xED, 0xD8, 0x27, 0x9E, 0x63, 0xB6, 0xB0, 0x0A, 0x66, 0x05,
-    0x13, 0xC6, 0x61, 0x6E, 0xB4, 0xBD, 0x49, 0x41, 0xAC, 0x98, 0xBC, 0xCF, 0xB0, 0x9A, 0xED, 0x6C,
-    0xEF, 0xDA, 0x12, 0xFF, 0xF2, 0x51, 0x6A, 0xD7, 0x24, 0x94, 0x5E, 0x43, 0xE1, 0xBA, 0xD6, 0x38,
-    0x6F, 0xCA, 0xC1, 0xB8, 0x31, 0xA8, 0x42, 0x91, 0xF1, 0x5C, 0x63, 0xCB, 0x47, 0xD7, 0x61, 0xB6,
-    0x3A, 0xC7, 0xFA, 0xEB, 0x24, 0xC7, 0x1D, 0x3E, 0xF4, 0x6E, 0xE7, 0x8B, 0x23, 0xA8, 0x16, 0xA8,
-    0x4F, 0xBA, 0x08, 0x7C, 0xD5, 0xF1, 0x60, 0xF0, 0x4A, 0x3B, 0xF3, 0x68, 0x83, 0xD7, 0xB2, 0x42,
-    0x87, 0xAB, 0x92, 0xDE, 0xB8, 0x45, 0x38, 0x4D, 0x7D, 0x78, 0xEA, 0x4D, 0xDE, 0x42, 0x16, 0x69,
-    0x8F, 0x1E, 0x8C, 0x87, 0x80, 0xCA, 0x85, 0xD9, 0x70, 0x45, 0x1A, 0xDE, 0xC6, 0x48, 0x4C, 0xD8,
-    0xC4, 0x7A, 0xA9, 0xD3, 0x1E, 0x5C, 0x96, 0x55, 0xD6, 0xC6, 0x43, 0xC4, 0x46, 0xDE, 0x26, 0x3D,
-    0x66, 0x90, 0x82, 0xCD, 0xB4, 0x8B, 0x87, 0xB9, 0x47, 0x3F, 0x6E, 0x17, 0x34, 0x88, 0x68, 0xC3,
-    0x90, 0x26, 0x88, 0x62, 0x98, 0x1A, 0xB3, 0xDE, 0x44, 0x75, 0xBE, 0xF8, 0xFB, 0xFC, 0xE1, 0x43,
-    0x9A, 0x07, 0xB6, 0x8D, 0x1A, 0xB3, 0x26, 0x47, 0x05, 0xF4, 0xAA, 0x80, 0xC8, 0xB8, 0x2F, 0x97,
-    0x5B, 0x90, 0x24, 0x8B, 0x99, 0xC7, 0xBE, 0xCF, 0xAA, 0xBF, 0x9B, 0xA4, 0x3F, 0x87, 0xD8, 0x23,
-    0x30, 0x6D, 0x4A, 0xCC, 0x9C, 0x61, 0x6F, 0xE2, 0xD0, 0xB1, 0xBA, 0xED, 0xB6, 0x7F, 0x4F, 0xF5,
-    0x87, 0xDE, 0xC9, 0x0E, 0x8E, 0xE6, 0xE9, 0x11, 0x8F, 0x5F, 0x89, 0x20, 0xB1, 0xAC, 0x83, 0xDD,
-    0xA6, 0xBD, 0xFD, 0x44, 0x92, 0xCE, 0x56, 0x1B, 0x10, 0xEF, 0x1D, 0xF1, 0x7A, 0xD2, 0x65, 0xCA,
-    0xF7, 0xE4, 0xA2, 0xB7, 0x9D, 0xAB, 0xBE, 0x4F, 0x92, 0x6B, 0x13, 0x93, 0x22, 0x28, 0x65, 0x67,
-    0xB8, 0xBF, 0xB6, 0x31, 0x31, 0x26, 0x74, 0x15, 0xE5, 0x15, 0xB1, 0xA3, 0x35, 0x73, 0x74, 0x94,
-    0xDA, 0x01, 0xC6, 0x29, 0x4C, 0x08, 0xC4, 0x94, 0x35, 0x74, 0x01, 0x1D, 0xB0, 0x17, 0x74, 0x88,
-    0x4E, 0xC5, 0x8E, 0x27, 0x94, 0x29, 0x87, 0x12, 0xE5, 0xD8, 0x55, 0xD8, 0xF9, 0x90, 0xC8, 0x1C,
-    0x12, 0x31, 0xF6, 0xBE, 0x60, 0x73, 0x4A, 0x28, 0xC1, 0x56, 0x67, 0xCA, 0xAF, 0x46, 0x93, 0x3D,
-    0x12, 0x6A, 0x5B, 0x65, 0xA8, 0x47, 0x16, 0xF2, 0x49, 0xBD, 0x14, 0xB1, 0x77, 0x75, 0x24, 0x1F,
-    0x60, 0xC4, 0x1D, 0x6C, 0x5F, 0x27, 0x15, 0xDC, 0x51, 0x9F, 0xA8, 0x19, 0x17, 0x70, 0x05, 0x0B,
-    0x35, 0xD4, 0x12, 0xD4, 0x18, 0xEE, 0x00, 0xF6, 0xDB, 0x48, 0x1B, 0x09, 0x34, 0x54, 0x66, 0x6A,
-    0xE8, 0xDF, 0xC8, 0xC1, 0x60, 0xDF, 0x93, 0xB8, 0xC0, 0xBC, 0x65, 0x6B, 0xB2, 0x01, 0xAA, 0x0C,
-    0x76, 0x5E, 0xEA, 0x26, 0x10, 0x5F, 0x63, 0x7A, 0x81, 0x1E, 0x4A, 0x8B, 0xAB, 0xA7, 0x09, 0x54,
-    0x1D, 0x85, 0x01, 0x6B, 0x30, 0xCA, 0x2F, 0x85, 0x66, 0xCA, 0x46, 0x25, 0x64, 0x2C, 0x0D, 0x98,
-    0xEE, 0xEE, 0xE9, 0xA3, 0x9F, 0x0E, 0xB6, 0x41, 0xFC, 0x23, 0xEE, 0x23, 0x15, 0x9D, 0x7B, 0x59,
-    0xE9, 0x52, 0x5B, 0x72, 0x1D, 0x34, 0x4B, 0x44, 0x27, 0x68, 0xE9, 0xAA, 0xEE, 0x62, 0xA9, 0x42,
-    0x67, 0x4D, 0xF1, 0x16, 0x65, 0x3D, 0x03, 0xA3, 0x3F, 0x90, 0x62, 0x4E, 0xA7, 0xC4, 0x5D, 0xB4,
-    0x10, 0xEB, 0x6B, 0x8E, 0xE6, 0xCB, 0x79, 0xE7, 0xB4, 0x5A, 0xD7, 0x84, 0x85, 0x52, 0xFF, 0x5B,
-    0x78, 0xB1, 0xAD, 0x87, 0x4E, 0x5D, 0xD5, 0x0D, 0xAE, 0x92, 0xF1, 0xB5, 0x95, 0x75, 0x55, 0x31,
-    0xAA, 0x00, 0x69, 0x9D, 0x41, 0x89, 0x4C, 0xCA, 0x17, 0x39, 0x5F, 0x22, 0xE8, 0x2A, 0x31, 0xC5,
-    0x7C, 0xE4, 0xA6, 0xDD, 0xF4, 0x26, 0xF2, 0xD8, 0xED, 0xB4, 0x05, 0x7B, 0xEE, 0xAC, 0x2C, 0xE2,
-    0x21, 0x86, 0xA5, 0x54, 0x59, 0x0F, 0xCF, 0x52, 0x36, 0x34, 0xD4, 0x91, 0xFE, 0xF8, 0x98, 0x8C,
-    0x7C, 0xC9, 0xD3, 0x02, 0x12, 0x5C, 0xD0, 0x2D, 0x60, 0xFA, 0xAC, 0x37, 0x41, 0x2E, 0xE8, 0xC2,
-    0xBE, 0xF7, 0xDC, 0x33, 0x43, 0x3A, 0xC0, 0x5C, 0x9B, 0x1D, 0x6F, 0x6E, 0x50, 0xBF, 0xA8, 0x59,
-    0x54, 0x32, 0x6A, 0x13, 0xBD, 0x6E, 0xB3, 0x1C, 0xD5, 0x52, 0x4A, 0xA6, 0x88, 0x29, 0x1C, 0x0B,
-    0xED, 0x4E, 0x94, 0x7D, 0x32, 0x08, 0x6E, 0xED, 0xFD, 0xBB, 0x90, 0x32, 0x96, 0x1E, 0x41, 0x83,
-    0x87, 0xAB, 0x80, 0x07, 0x21, 0xE9, 0x6B, 0xC5, 0x52, 0xE9, 0xB6, 0x84, 0xEE, 0xBE, 0xC6, 0x6C,
-    0x1D, 0x3D, 0x98, 0xB2, 0xC9, 0xA9, 0xB8, 0x14, 0x54, 0x1B, 0xBA, 0xBA, 0x56, 0xC4, 0x43, 0xE9,
-    0x67, 0x52, 0x4A, 0xCB, 0x3D, 0xB0, 0xF2, 0x4F, 0x72, 0x00, 0x77, 0xF5, 0x48, 0xC5, 0x0B, 0x25,
-    0x3C, 0x84, 0x12, 0x3E, 0x18, 0x21, 0x7A, 0xA9, 0x62, 0x6F, 0x41, 0xFD, 0x79, 0xF8, 0x40, 0xBA,
-    0xFC, 0x1A, 0x64, 0xD6, 0xD8, 0x44, 0xD0, 0xF2, 0x7D, 0xA3, 0x3E, 0xEB, 0x1B, 0xD1, 0x09, 0xA6,
-    0xC6, 0xDA, 0xE6, 0x26, 0x69, 0x4C, 0xD5, 0x25, 0x2E, 0x82, 0x5A, 0xA8, 0xBC, 0x97, 0xBD, 0xDC,
-    0xC5, 0xA0, 0x41, 0x7E, 0xD2, 0x1E, 0x8A, 0x4A, 0x55, 0xA9, 0xE4, 0x66, 0x8F, 0x53, 0x6F, 0xDE,
-    0x4D, 0xBD, 0xDC, 0xD3, 0x74, 0x38, 0x31, 0xA7, 0xEB, 0x5C, 0x94, 0x47, 0x9B, 0xFB, 0x1D, 0x8F,
-    0x07, 0xB2, 0xEB, 0xD5, 0x8F, 0x24, 0x83, 0x6D, 0xE7, 0x12, 0xCB, 0x9B, 0x70, 0xAB, 0xC1, 0x36,
-    0x0A, 0x28, 0x2E, 0x8F, 0x5E, 0x05, 0x2F, 0x4D, 0xD9, 0x97, 0x90, 0xF0, 0x16, 0x58, 0x3B, 0x84,
-    0x7D, 0x09, 0x0D, 0xCE, 0x35, 0xB0, 0x2F, 0xFF, 0x96, 0x7C, 0x46, 0x87, 0x02, 0xA1, 0x37, 0x91,
-    0x23, 0xD5, 0x1B, 0x27, 0xCB, 0x15, 0xAA, 0x66, 0x58, 0xAE, 0xC6, 0x31, 0x64, 0x30, 0x80, 0xAB,
-    0x50, 0x82, 0x6F, 0x04, 0x06, 0x20, 0x55, 0x24, 0x2E, 0x18, 0x6B, 0xE6, 0xB9, 0xCB, 0x25, 0xBC,
-    0xFD, 0x3E, 0x26, 0xBA, 0x2F, 0x72, 0x88, 0x26, 0x6C, 0xF6, 0xCA, 0x75, 0x72, 0x5B, 0x56, 0x81,
-    0x63, 0xB2, 0x64, 0x87, 0xF9, 0xB6, 0xC0, 0xA9, 0x62, 0xD2, 0x92, 0x2F, 0xCA, 0x5D, 0x63, 0x36,
-    0xB1, 0xD2, 0x6A, 0xE1, 0x76, 0xD5, 0x23, 0xD9, 0xC2, 0x9C, 0xFE, 0x41, 0x05, 0x47, 0xDB, 0x83,
-    0x3E, 0xB3, 0xAE, 0x43, 0xAE, 0x71, 0xC8, 0xC2, 0x3C, 0xF9, 0x8B, 0x47, 0xA0, 0x94, 0x5D, 0x0F,
-    0x4D, 0xBD, 0x81, 0x80, 0xB9, 0xA6, 0xEF, 0x61, 0x9A, 0xB8, 0x09, 0xC2, 0x2D, 0xBD, 0x86, 0xA4,
-    0x18, 0x82, 0xC8, 0xD4, 0xA2, 0x0B, 0xC6, 0x1B, 0x93, 0x6B, 0x68, 0xC3, 0x73, 0x25, 0xA2, 0xA4,
-    0x21, 0x91, 0xF9, 0x19, 0xBB, 0x82, 0x0E, 0x73, 0x9D, 0xD7, 0xAF, 0x6C, 0x6F, 0x6F, 0x33, 0xE8,
-    0x7F, 0x35, 0xE9, 0xBA, 0x3F, 0x21, 0x6D, 0x73, 0x73, 0xF3, 0xC7, 0x4F, 0x7A, 0x64, 0x13, 0x82,
-    0x55, 0x5E, 0x04, 0x07, 0x31, 0x63, 0x0C, 0x65, 0x9C, 0xD5, 0x35, 0xA3, 0x10, 0x4B, 0xBB, 0xE0,
-    0x14, 0x23, 0x0C, 0x4F, 0x70, 0xB3, 0x25, 0x70, 0x71, 0x52, 0x24, 0x00, 0x1F, 0x09, 0xBA, 0x54,
-    0x3D, 0xFE, 0x9D, 0xEB, 0x2E, 0x97, 0x99, 0xA9, 0x7E, 0x23, 0x6E, 0x06, 0xCF, 0x30, 0xE4, 0x45,
-    0x36, 0x7C, 0x4F, 0x9D, 0x2C, 0x8F, 0x74, 0x72, 0x2F, 0x8E, 0xEE, 0x17, 0xDE, 0x59, 0x26, 0x2F,
-    0x54, 0x87, 0x40, 0x84, 0x18, 0x67, 0xD6, 0x4E, 0x49, 0x8A, 0xA2, 0x53, 0x6B, 0x98, 0x0E, 0x6E,
-    0xCD, 0x0A, 0x1F, 0xAC, 0x62, 0x7D, 0x8D, 0xDF, 0xA4, 0x36, 0x61, 0xC8, 0xC2, 0x60, 0x5F, 0x9C,
-    0x11, 0xC5, 0x32, 0xB0, 0x9C, 0x19, 0xF9, 0xCE, 0x1B, 0xC4, 0xAA, 0x9D, 0xDF, 0x12, 0xB1, 0x60,
-    0xCC, 0x9B, 0x7D, 0x46, 0xAD, 0x38, 0x37, 0xE4, 0x95, 0xAB, 0xDD, 0xD9, 0xC1, 0xBE, 0x83, 0x58,
-    0x79, 0x76, 0xB4, 0xE7, 0xB0, 0xB7, 0x66, 0x2C, 0x81, 0x63, 0x1C, 0x2E, 0x08, 0x8A, 0x2E, 0x1A,
-    0x78, 0x11, 0x5C, 0xD0, 0x09, 0xC8, 0x52, 0x9E, 0x83, 0xED, 0x9D, 0xC7, 0x46, 0xC2, 0xAA, 0x0E,
-    0x5B, 0x5B, 0x95, 0xD0, 0x9B, 0x2A, 0xAF, 0x33, 0xB8, 0x76, 0x46, 0x66, 0x72, 0x3F, 0x45, 0x11,
-    0xBA, 0xB5, 0xE8, 0x3A, 0x1D, 0xD4, 0x5B, 0xB4, 0x20, 0xFA, 0x85, 0x9A, 0x32, 0x11, 0x05, 0x29,
-    0xAB, 0xDB, 0xD7, 0x95, 0xEA, 0x5E, 0x31, 0x17, 0xDF, 0x50, 0x21, 0x33, 0x92, 0xA8, 0x9F, 0xE3,
-    0x39, 0x19, 0x38, 0x94, 0x96, 0x8C, 0x73, 0xAF, 0xDE, 0xA6, 0xB3, 0xEA, 0xB0, 0xA9, 0x93, 0x65,
-    0x43, 0xAD, 0x74, 0x35, 0xF5, 0x84, 0xF1, 0x85, 0x56, 0x8B, 0xAD, 0x9B, 0xE9, 0x46, 0xD3, 0x1D,
-    0x89, 0x51, 0xFC, 0x59, 0x50, 0x26, 0x18, 0xE0, 0x37, 0xDF, 0x82, 0x2F, 0x65, 0xC8, 0xAB, 0xAD,
-    0x8A, 0x9D, 0xEE, 0x89, 0xD0, 0x86, 0x72, 0xA7, 0x44, 0x73, 0xC4, 0xFA, 0x87, 0x05, 0x2D, 0x8E,
-    0xBE, 0x47, 0x7A, 0x82, 0xDB, 0xCE, 0xB6, 0xAB, 0xD2, 0x48, 0x35, 0x43, 0x50, 0xC2, 0x74, 0x58,
-    0x25, 0xEB, 0xB1, 0xB8, 0xD4, 0xF2, 0xF9, 0x65, 0xE1, 0xA8, 0x26, 0x95, 0x60, 0x65, 0x52, 0xC8,
-    0xBD, 0x1D, 0x98, 0x30, 0xB6, 0x00, 0xA3, 0xA0, 0xFA, 0xB0, 0xAF, 0x8E, 0x0E, 0xE9, 0x26, 0x5F,
-    0xBC, 0x08, 0x38, 0xA3, 0x50, 0xA2, 0x21, 0x31, 0xCB, 0x17, 0xEF, 0x2E, 0xF5, 0xD1, 0xC1, 0x39,
-    0x30, 0xC6, 0x52, 0x5D, 0x68, 0x62, 0xF4, 0xBA, 0xDD, 0x2A, 0x76, 0xAA, 0x30, 0xAF, 0xA7, 0xBA,
-    0x7D, 0xC3, 0xE4, 0xF8, 0xD5, 0xA9, 0xAA, 0x4D, 0x3E, 0x73, 0xEA, 0x96, 0x43, 0x74, 0x70, 0x46,
-    0x69, 0xA6, 0x2A, 0x46, 0xF8, 0x86, 0x7F, 0xE5, 0x92, 0x9D, 0xF2, 0xC6, 0x9D, 0xE8, 0xA0, 0x35,
-    0xDC, 0x0D, 0x44, 0x15, 0xE5, 0x99, 0xAC, 0x16, 0xCA, 0xB4, 0x51, 0x61, 0xD9, 0xA3, 0x4B, 0xE0,
-    0x9F, 0x46, 0x4E, 0x47, 0x46, 0x01, 0x50, 0x3A, 0x54, 0xD4, 0x8B, 0x14, 0xE0, 0x4D, 0xD5, 0x55,
-    0x2A, 0xAD, 0xD7, 0xCE, 0x6B, 0xEC, 0xBC, 0xC3, 0x4E, 0x72, 0x9C, 0x72, 0xA4, 0x4A, 0x21, 0x26,
-    0x60, 0x40, 0x28, 0x90, 0xEA, 0xB2, 0x7A, 0x21, 0x65, 0x3A, 0xC4, 0x0A, 0x04, 0x7C, 0xEA, 0x2D,
-    0x5A, 0x87, 0x21, 0xA2, 0xEA, 0xE5, 0xF3, 0xCD, 0x8B, 0x13, 0x9A, 0x99, 0x2E, 0xE3, 0xE6, 0x06,
-    0x9E, 0xC1, 0x35, 0x0D, 0xBC, 0xF8, 0xED, 0x0F, 0x4F, 0x3D, 0x3B, 0x75, 0x79, 0x72, 0x96, 0x17,
-    0xCC, 0xC9, 0xCB, 0xBD, 0xED, 0x6B, 0xD3, 0x9C, 0xBC, 0xE0, 0xEE, 0xD9, 0x21, 0x4F, 0x5C, 0x4E,
-    0xBC, 0xEA, 0xB1, 0x5A, 0x5A, 0x6B, 0xD4, 0xCE, 0x54, 0xD5, 0xC4, 0x17, 0x5B, 0xC6, 0xE9, 0xFE,
-    0xA8, 0xDC, 0x07, 0x15, 0xB9, 0xAA, 0x72, 0xA1, 0xF9, 0xC4, 0xCA, 0xE6, 0x06, 0xFD, 0x3B, 0x45,
-    0x27, 0x14, 0x9D, 0x95, 0x8E, 0x88, 0x0A, 0xCE, 0x11, 0x2A, 0x7B, 0x01, 0x23, 0xCB, 0xFF, 0x24,
-    0xA0, 0xEF, 0xF0, 0x7A, 0x3C, 0xC6, 0x52, 0xCF, 0x34, 0x0C, 0x28, 0xE8, 0x12, 0x22, 0x69, 0x51,
-    0xA5, 0x3E, 0x0E, 0x68, 0x15, 0xF4, 0xC4, 0xF0, 0xDF, 0x88, 0x41, 0x2F, 0x73, 0xFA, 0x7C, 0xF3,
-    0xB2, 0xA2, 0x95, 0xD3, 0xA7, 0x7B, 0xDB, 0x3B, 0xFE, 0xA5, 0x27, 0x38, 0x39, 0x39, 0x85, 0x3E,
-    0x22, 0xB7, 0xA8, 0x9A, 0x14, 0x09, 0xAD, 0xA0, 0x7A, 0x61, 0x33, 0x87, 0x5A, 0x4C, 0x3F, 0xF6,
-    0x7D, 0x57, 0x7F, 0x79, 0xBF, 0xE6, 0xBA, 0x92, 0xD0, 0xAE, 0x86, 0x7F, 0x2E, 0x7B, 0x8A, 0x25,
-    0xA7, 0x42, 0xBA, 0x96, 0xB1, 0xAD, 0x26, 0x0D, 0x05, 0x6D, 0x9E, 0x24, 0x40, 0xEC, 0x15, 0x9C,
-    0xAC, 0x7C, 0x02, 0x29, 0xC3, 0x8C, 0xA1, 0x79, 0xFB, 0x30, 0x29, 0x39, 0x54, 0xC5, 0x19, 0x55,
-    0x7B, 0xF4, 0x84, 0x07, 0x7F, 0xA2, 0xC1, 0x56, 0xDC, 0xDE, 0xAA, 0xEC, 0x96, 0xEF, 0xEA, 0x2C,
-    0x31, 0xE7, 0x9B, 0x53, 0x95, 0x83, 0x39, 0x70, 0x21, 0x6C, 0xB8, 0x5D, 0xE2, 0xC7, 0xEF, 0xEA,
-    0x10, 0x42, 0xFD, 0xC7, 0x07, 0x3D, 0x63, 0x0C, 0x80, 0x03, 0x5B, 0x95, 0x91, 0x01, 0x2C, 0xC5,
-    0x0D, 0x32, 0x44, 0xDC, 0xD0, 0xDC, 0x70, 0xD3, 0x43, 0xCF, 0x46, 0x81, 0x73, 0x74, 0xEE, 0xE0,
-    0x01, 0x84, 0xF3, 0x60, 0x94, 0x2D, 0xF0, 0x69, 0x0F, 0x8E, 0xBC, 0xC9, 0x6E, 0x8E, 0x72, 0xB1,
-    0x9D, 0x0F, 0xF6, 0xA0, 0x93, 0xC2, 0x7E, 0x3A, 0xCA, 0xF9, 0x3E, 0xEE, 0xCA, 0x83, 0x1E, 0x69,
-    0x25, 0x94, 0xE8, 0x3D, 0x44, 0x5C, 0xDC, 0xE4, 0xB7, 0x3D, 0x6E, 0x16, 0x02, 0x5F, 0x7E, 0xD0,
-    0xA7, 0x0F, 0x06, 0xDE, 0x20, 0x9A, 0xE2, 0x26, 0x96, 0x96, 0x37, 0x16, 0xB1, 0xE1, 0x00, 0x69,
-    0x55, 0xC3, 0x1B, 0xA8, 0x37, 0x6E, 0x28, 0x90, 0x91, 0xF1, 0xB0, 0xDC, 0xA7, 0x42, 0x0E, 0xA4,
-    0x0C, 0xCD, 0x8E, 0x4D, 0x42, 0xF1, 0x7D, 0xC8, 0x15, 0x4D, 0x48, 0xBD, 0xDC, 0x7F, 0x40, 0xFC,
-    0xA9, 0x0E, 0x70, 0xBF, 0x73, 0x48, 0xCB, 0x08, 0x73, 0xD0, 0xCC, 0x07, 0x34, 0x0B, 0xEC, 0xDF,
-    0x3E, 0xD6, 0x41, 0x73, 0x61, 0x7B, 0x34, 0x8D, 0x7C, 0x3A, 0x10, 0x01, 0xB1, 0x69, 0x1F, 0xA1,
-    0x09, 0x67, 0x88, 0x66, 0x2A, 0x83, 0xE6, 0x0B, 0x68, 0xCE, 0xB4, 0x99, 0xB2, 0x19, 0xAC, 0x6E,
-    0x72, 0xA0, 0x0B, 0xA2, 0x01, 0x02, 0x00, 0xDA, 0x8E, 0x46, 0x01, 0x6E, 0xDA, 0xDD, 0x98, 0x3E,
-    0x07, 0x4E, 0xBD, 0xA5, 0x3F, 0xB4, 0x7D, 0xC0, 0xF5, 0xF4, 0x92, 0xD9, 0x40, 0x87, 0x09, 0x3F,
-    0x1D, 0xCE, 0xED, 0xA9, 0xF3, 0xE9, 0x7E, 0x42, 0xF2, 0x21, 0xBC, 0x15, 0x66, 0xA0, 0x4B, 0x75,
-    0x1D, 0xA6, 0x85, 0x74, 0x34, 0xCA, 0x54, 0xEA, 0x32, 0x0B, 0xBA, 0x55, 0x05, 0x89, 0xC2, 0xC0,
-    0xC6, 0x3C, 0x0E, 0x9E, 0x55, 0xE3, 0x50, 0x81, 0x8D, 0x1C, 0xD5, 0xFF, 0xDA, 0xA3, 0x2D, 0xC6,
-    0x11, 0x75, 0xA5, 0x6C, 0xE8, 0x8A, 0xDA, 0x50, 0x04, 0xB8, 0x2B, 0x1F, 0x61, 0xCC, 0x14, 0x1F,
-    0x08, 0xB7, 0x81, 0x83, 0xB7, 0x43, 0x26, 0xA1, 0x78, 0xF2, 0xCF, 0x34, 0xFE, 0x3F, 0xCA, 0x81,
-    0x41, 0x29, 0x2A, 0x35, 0xC0, 0x67, 0x0A, 0xBD, 0x12, 0x8D, 0xFC, 0xF3, 0x50, 0xB6, 0xA0, 0xF6,
-    0x18, 0x73, 0xE5, 0x43, 0x8D, 0x3F, 0x96, 0x9E, 0x8E, 0xFA, 0xAE, 0x91, 0x74, 0x61, 0xDB, 0x33,
-    0xE0, 0x1F, 0x09, 0x61, 0xAD, 0xB1, 0xF6, 0xF4, 0x29, 0xE2, 0x83, 0x84, 0x4A, 0x19, 0xB0, 0x74,
-    0xAF, 0x08, 0x57, 0x51, 0x35, 0x71, 0x01, 0x53, 0xBC, 0x8C, 0xBE, 0x07, 0x18, 0x9D, 0x22, 0x2D,
-    0x6C, 0x3B, 0xE3, 0x1B, 0x30, 0x5A, 0x9C, 0xCA, 0x8E, 0x51, 0x99, 0xD2, 0x4F, 0xFD, 0xE4, 0xCF,
-    0xEF, 0x92, 0xDE, 0x86, 0x13, 0x41, 0x6A, 0x03, 0x98, 0xFA, 0xC5, 0x49, 0x6E, 0xA8, 0x52, 0x10,
-    0x13, 0x60, 0xA5, 0x05, 0x42, 0x98, 0x07, 0xF6, 0x86, 0x50, 0x16, 0x9A, 0x93, 0x83, 0x4C, 0x8C,
-    0x26, 0x9F, 0x48, 0x6D, 0x10, 0x45, 0x87, 0x5F, 0x14, 0x89, 0x67, 0x7A, 0x75, 0x1E, 0xC7, 0x3B,
-    0xE4, 0xE4, 0x0C, 0x2D, 0x83, 0xCA, 0xC0, 0x7C, 0xEB, 0xE8, 0x24, 0xDF, 0xFA, 0x80, 0x9E, 0x78,
-    0xED, 0x27, 0xF2, 0x8F, 0x1B, 0x21, 0xBA, 0x68, 0x00, 0xE7, 0x34, 0xBA, 0xF8, 0x77, 0xD3, 0x65,
-    0x09, 0x49, 0x19, 0xFA, 0x1C, 0xC3, 0x35, 0x73, 0x70, 0x20, 0x5B, 0xDB, 0xFE, 0xA5, 0x9D, 0x80,
-    0x00, 0xF4, 0x99, 0xF4, 0xA3, 0xAE, 0xC5, 0xEE, 0x3A, 0xC5, 0x49, 0x1A, 0x0B, 0xC7, 0x80, 0x61,
-    0xC0, 0x2B, 0xF7, 0x76, 0x6D, 0xCA, 0x10, 0xCB, 0x5B, 0x74, 0x5B, 0x14, 0xBA, 0xAA, 0x3A, 0x00,
-    0x14, 0x70, 0x1B, 0xC8, 0x25, 0x89, 0x2D, 0x41, 0x82, 0x67, 0x86, 0x05, 0xE7, 0xEA, 0x43, 0xD4,
-    0x88, 0x98, 0x02, 0x16, 0xC8, 0x2B, 0xD3, 0x5E, 0xC1, 0x47, 0x55, 0xD6, 0x08, 0x79, 0x04, 0x95,
-    0xB6, 0x51, 0xB1, 0xA7, 0x94, 0xFB, 0xD7, 0xBA, 0x4B, 0x5B, 0xDC, 0xA2, 0x47, 0x5A, 0x40, 0x09,
-    0x42, 0x50, 0x01, 0x30, 0xEE, 0x46, 0xAA, 0x7E, 0xDC, 0x66, 0xD0, 0x90, 0xB1, 0x36, 0x92, 0x77,
-    0x1A, 0x96, 0xE5, 0x53, 0xAF, 0x78, 0xBB, 0x6C, 0xE8, 0xF0, 0x3B, 0x42, 0xCA, 0x96, 0x79, 0x46,
-    0x32, 0x60, 0x89, 0x9C, 0x3E, 0x1E, 0x04, 0xA4, 0x0C, 0x01, 0x0B, 0xDB, 0xCC, 0x3D, 0x00, 0x71,
-    0x9D, 0x0E, 0x91, 0x2F, 0x17, 0x39, 0x34, 0xC9, 0xB8, 0x8B, 0x24, 0xB9, 0xAC, 0xED, 0xEE, 0x40,
-    0x7A, 0xFB, 0xB4, 0x95, 0xB3, 0x44, 0x4E, 0xF1, 0x90, 0x37, 0xF4, 0xC1, 0x37, 0xC6, 0x98, 0x9C,
-    0x66, 0x1D, 0xF8, 0x43, 0x06, 0x3E, 0x1F, 0x6D, 0x65, 0xBF, 0xA0, 0xBC, 0x3E, 0x68, 0x92, 0x63,
-    0xCA, 0xF1, 0x11, 0xC2, 0x0A, 0x06, 0xC6, 0x32, 0xA8, 0x4A, 0x41, 0x6C, 0x9A, 0x4B, 0xE0, 0x06,
-    0xAE, 0x8E, 0x99, 0x81, 0x2A, 0x73, 0xA0, 0x5F, 0xF3, 0x7B, 0xCB, 0x62, 0x66, 0xAD, 0xE8, 0x0E,
-    0x99, 0x04, 0x3B, 0x09, 0xFF, 0x4B, 0x1A, 0x02, 0x10, 0xF6, 0x4C, 0x63, 0x14, 0x83, 0x5D, 0x4D,
-    0x78, 0xCA, 0x5A, 0x80, 0xD7, 0x64, 0x94, 0xAA, 0xAA, 0x95, 0x50, 0x4E, 0xCD, 0x42, 0x85, 0xF5,
-    0x8A, 0xB1, 0x3B, 0x45, 0x85, 0xAA, 0x22, 0x3C, 0xC7, 0x9A, 0xFB, 0xD8, 0x23, 0x0C, 0x99, 0xC9,
-    0x0D, 0x9C, 0xB3, 0x81, 0xB8, 0x9D, 0x56, 0x4D, 0x69, 0x61, 0x31, 0xC4, 0xC1, 0xD4, 0xB3, 0x2F,
-    0x57, 0xF3, 0xB7, 0x83, 0xA3, 0x5E, 0x7D, 0x40, 0xB8, 0xAD, 0xB1, 0x54, 0xED, 0x4A, 0xCD, 0x8D,
-    0x51, 0x21, 0x63, 0x6C, 0x46, 0x26, 0xCC, 0x74, 0x16, 0xA2, 0xFF, 0x6F, 0x50, 0x91, 0x12, 0xAE,
-    0x44, 0x0A, 0x37, 0x6D, 0x58, 0x52, 0x57, 0xEF, 0x97, 0x58, 0x29, 0xF8, 0xAF, 0x40, 0x63, 0xBB,
-    0x54, 0xE2, 0xE7, 0x76, 0x32, 0x8D, 0x68, 0x4F, 0xAA, 0xCE, 0xAA, 0x7A, 0x48, 0xDC, 0x43, 0xEA,
-    0x33, 0x25, 0xE2, 0x8A, 0xBB, 0x98, 0x59, 0xA9, 0x61, 0x86, 0xB4, 0xBC, 0x31, 0xA1, 0x32, 0x14,
-    0x1C, 0xE6, 0x22, 0x60, 0xE4, 0xC7, 0xCF, 0x9D, 0x3E, 0x2F, 0x42, 0x59, 0xA0, 0xE7, 0xCC, 0x0A,
-    0x5B, 0xAE, 0x85, 0x1C, 0x31, 0x97, 0x3D, 0xF9, 0x5A, 0x3E, 0x74, 0x8B, 0xBC, 0x49, 0x7A, 0x64,
-    0x53, 0x2F, 0xDD, 0xC0, 0x5B, 0x83, 0x93, 0x95, 0xCD, 0x82, 0x3B, 0x3E, 0x9A, 0x60, 0x92, 0x86,
-    0xA5, 0x3A, 0xC5, 0x71, 0x83, 0x66, 0x7B, 0xEC, 0xC9, 0x5A, 0xAD, 0xC4, 0x25, 0xA1, 0x87, 0x55,
-    0x07, 0xED, 0x29, 0x94, 0x6F, 0x64, 0x7A, 0xEC, 0x81, 0x45, 0x44, 0xEC, 0xE9, 0x55, 0xA5, 0x59,
-    0xD3, 0x23, 0xB9, 0xD7, 0x40, 0x69, 0xFF, 0xD1, 0x2B, 0xD0, 0x34, 0x35, 0xF0, 0x16, 0x11, 0xC6,
-    0x3F, 0x6C, 0x22, 0xBB, 0x55, 0x9D, 0x68, 0x43, 0x35, 0x11, 0xE4, 0x54, 0x53, 0x65, 0xC9, 0x39,
-    0xC8, 0xAA, 0xE7, 0xCA, 0x37, 0x40, 0x85, 0x9F, 0xF7, 0x26, 0x6E, 0x13, 0xF8, 0xCF, 0x2A, 0x6D,
-    0xA2, 0xD1, 0xE4, 0x15, 0x5E, 0xB1, 0x8B, 0x12, 0x19, 0xB9, 0xD6, 0xAA, 0x5F, 0xBB, 0x6E, 0xA2,
-    0x0F, 0x6D, 0x00, 0xD5, 0xF7, 0x91, 0x5F, 0x9B, 0x2B, 0xBF, 0x99, 0x6B, 0x42, 0x06, 0xBB, 0x03,
-    0x07, 0xFF, 0x61, 0x56, 0xDE, 0x36, 0x5A, 0x38, 0x70, 0x4C, 0xC6, 0x30, 0x6E, 0x76, 0xC4, 0xF4,
-    0x46, 0xAB, 0x2B, 0x48, 0xE1, 0xA2, 0x4B, 0x1E, 0xC1, 0x4B, 0xDE, 0x55, 0xD1, 0x7B, 0x77, 0x2C,
-    0x75, 0xEC, 0x59, 0xE2, 0xD8, 0x01, 0x02, 0xFE, 0x0A, 0x69, 0xF4, 0xB1, 0xFC, 0xD1, 0x11, 0x11,
-    0xC9, 0xFB, 0x22, 0x59, 0x53, 0x92, 0x9A, 0xF5, 0x50, 0x38, 0x4A, 0xC6, 0xA9, 0x46, 0xF3, 0x6D,
-    0x8D, 0xE8, 0x97, 0xF4, 0x5F, 0x6D, 0x32, 0x86, 0x34, 0x5C, 0x12, 0xB9, 0x27, 0xBD, 0xEB, 0x66,
-    0xD8, 0x51, 0xC8, 0x16, 0xDB, 0x2E, 0xF0, 0x4E, 0xC9, 0x88, 0xC1, 0xEE, 0xD6, 0xC8, 0x46, 0xE8,
-    0x49, 0x47, 0x07, 0x03, 0xDB, 0x83, 0x0B, 0x18, 0xF8, 0xD6, 0x05, 0x2A, 0x9D, 0xDB, 0x97, 0x21,
-    0xE9, 0x73, 0x3F, 0xB9, 0xB6, 0xE8, 0xA7, 0xAC, 0x56, 0x01, 0x16, 0xB1, 0x32, 0xCA, 0x64, 0x71,
-    0xBB, 0x85, 0x4E, 0xBD, 0x4E, 0x3B, 0xD5, 0xEC, 0xB4, 0x0D, 0x45, 0x34, 0x3D, 0x96, 0xE0, 0xAE,
-    0xD3, 0xD2, 0xC5, 0xDF, 0xA6, 0xC0, 0x9E, 0x89, 0x68, 0xB5, 0x93, 0x2E, 0xA7, 0x99, 0xAA, 0x36,
-    0x64, 0x46, 0xAB, 0x17, 0x7C, 0xE7, 0x99, 0xC6, 0xDB, 0x68, 0xC8, 0x50, 0x22, 0x54, 0x3D, 0xF0,
-    0xA9, 0x7E, 0x09, 0x79, 0x08, 0x81, 0x20, 0x59, 0xBC, 0x83, 0x0C, 0x97, 0x36, 0x5F, 0x7E, 0x29,
-    0xD0, 0x13, 0x8C, 0xB4, 0x5F, 0x7A, 0x36, 0xB0, 0x3B, 0xE8, 0x89, 0x3D, 0x56, 0x75, 0x77, 0x60,
-    0x99, 0x08, 0x4C, 0x87, 0x9A, 0x7E, 0xB2, 0x0A, 0x6B, 0xA1, 0x9C, 0xEF, 0xF8, 0x50, 0x40, 0x88,
-    0x7E, 0x47, 0xE5, 0xF7, 0x46, 0xC9, 0x61, 0x72, 0x43, 0x7B, 0x3F, 0x27, 0x0B, 0xF5, 0xD9, 0x25,
-    0xF3, 0x5E, 0xAD, 0x16, 0x7E, 0xB1, 0x2C, 0x1B, 0x7E, 0xF1, 0xD8, 0x90, 0x0A, 0x35, 0xA4, 0xC8,
-    0xC8, 0xF1, 0xA5, 0x2E, 0x9E, 0x3E, 0x02, 0x74, 0x5A, 0x35, 0xD6, 0xA0, 0x17, 0x41, 0xBB, 0xE0,
-    0x98, 0x13, 0x0D, 0xD5, 0x7D, 0x24, 0xFF, 0x73, 0x9D, 0xA5, 0xB3, 0x90, 0xB6, 0x13, 0xA5, 0xBC,
-    0x13, 0xAA, 0x80, 0xFD, 0x6B, 0x72, 0xEF, 0x3A, 0xCB, 0x27, 0xDC, 0xB8, 0xE9, 0xE9, 0xCB, 0xDD,
-    0x9A, 0xD5, 0x75, 0x2A, 0xEB, 0x4D, 0xB2, 0x54, 0x2A, 0x6F, 0x99, 0xFC, 0x1A, 0x12, 0x01, 0x66,
-    0x27, 0xDB, 0xCA, 0xBF, 0x0A, 0xC2, 0x2F, 0x45, 0x23, 0x93, 0x68, 0x54, 0x6A, 0x14, 0x1F, 0xE4,
-    0x28, 0x2A, 0x50, 0x95, 0x2C, 0xC2, 0x19, 0x86, 0x6D, 0xA8, 0xD0, 0xB5, 0x7C, 0x37, 0xFE, 0x4D,
-    0x11, 0x23, 0x73, 0x08, 0xF8, 0x40, 0x8B, 0xBC, 0x8B, 0x99, 0xF3, 0x8B, 0x97, 0xD5, 0xBC, 0x9E,
-    0x9A, 0xA7, 0x85, 0xCA, 0xAB, 0x72, 0xEC, 0x06, 0xD7, 0x47, 0xAA, 0x79, 0x23, 0xF3, 0x91, 0xA0,
-    0x79, 0xCD, 0x52, 0xF3, 0xEA, 0x17, 0x37, 0x56, 0xE2, 0x11, 0xC6, 0x50, 0xD6, 0xAC, 0x54, 0xA1,
-    0xF1, 0xBC, 0x3F, 0x6C, 0x2B, 0xBC, 0x8D, 0x6B, 0x20, 0x6C, 0xC4, 0xCE, 0xF5, 0x00, 0x0D, 0x5D,
-    0x0D, 0xE2, 0x5E, 0xF1, 0x94, 0x8D, 0x4C, 0x90, 0xE1, 0x28, 0x12, 0x5F, 0xAC, 0x15, 0xE6, 0x39,
-    0x45, 0xE2, 0xA7, 0xBA, 0x20, 0xD1, 0x45, 0xEA, 0xA9, 0xAD, 0x4D, 0x46, 0x94, 0x58, 0x36, 0xB4,
-    0xA5, 0xAB, 0xAA, 0x46, 0x2D, 0xBF, 0x16, 0x50, 0x27, 0x58, 0xD7, 0x63, 0x8E, 0x20, 0x5A, 0x82,
-    0x84, 0x0E, 0x41, 0xB1, 0x21, 0x9B, 0x45, 0xD9, 0x11, 0x0E, 0xB4, 0x98, 0x4B, 0xDA, 0x69, 0x2E,
-    0xA0, 0xC0, 0xB5, 0x0B, 0x23, 0x04, 0xF0, 0xC2, 0x3F, 0x63, 0xDE, 0x28, 0xCC, 0x4F, 0x4D, 0x7E,
-    0x9B, 0x2A, 0xAE, 0x92, 0xBF, 0x13, 0x4A, 0xE8, 0xC4, 0xDE, 0x4E, 0x76, 0xC4, 0x6F, 0x49, 0x4E,
-    0x2B, 0x52, 0xF3, 0x07, 0x8C, 0xB5, 0x5F, 0x23, 0x37, 0x59, 0x3A, 0x02, 0x84, 0xD3, 0x5C, 0xBF,
-    0x10, 0xC8, 0xDE, 0xA8, 0x48, 0xE4, 0x6B, 0x06, 0x76, 0x3E, 0xAC, 0x5F, 0xF5, 0x21, 0x6C, 0xE3,
-    0xAF, 0x8B, 0xA4, 0x47, 0x4C, 0x87, 0xD3, 0x10, 0xD6, 0x9F, 0x7A, 0x07, 0xBD, 0xDC, 0x63, 0xFA,
-    0xA4, 0x3B, 0xAF, 0x2A, 0xF0, 0x2A, 0x3B, 0xCF, 0x46, 0x6D, 0xA2, 0xB7, 0xF5, 0x73, 0xDD, 0x42,
-    0xBF, 0xC9, 0xCC, 0x42, 0x8D, 0xE0, 0x27, 0x4C, 0x6E, 0xE7, 0x2C, 0x3C, 0x69, 0x79, 0x2A, 0x1D,
-    0xA8, 0xDD, 0xF7, 0x19, 0x99, 0x15, 0xE8, 0x64, 0x43, 0xC0, 0x5E, 0xB6, 0xE5, 0x1B, 0xEF, 0xC2,
-    0x32, 0x90, 0x8A, 0xDC, 0x43, 0x62, 0x37, 0xD5, 0xC7, 0x5A, 0xAD, 0x52, 0x4E, 0xA5, 0xC6, 0x37,
-    0x94, 0xE8, 0x02, 0x44, 0x8F, 0x89, 0xBA, 0x3C, 0xBF, 0x83, 0x8D, 0x2B, 0x72, 0x25, 0x7A, 0xCF,
-    0x3F, 0x43, 0xF4, 0xD4, 0x43, 0x7E, 0xC0, 0x18, 0xE0, 0xDA, 0x5E, 0x90, 0x34, 0x78, 0x1E, 0xF9,
-    0xA5, 0xF0, 0x33, 0x69, 0x60, 0x08, 0xEB, 0xCF, 0xB5, 0x91, 0xA9, 0xB1, 0x34, 0xE3, 0xDD, 0xD3,
-    0x66, 0x7C, 0xE9, 0x65, 0xCC, 0xB8, 0x7C, 0x09, 0x33, 0xFE, 0x56, 0x6F, 0xFA, 0xB8, 0xF1, 0x46,
-    0x5E, 0xBB, 0x5B, 0xBD, 0xFB, 0x93, 0x38, 0xBA, 0xFA, 0x5C, 0xEA, 0x0B, 0x8A, 0xAA, 0x68, 0xFD,
-    0x44, 0x8C, 0xA3, 0xFA, 0x1A, 0x50, 0xF9, 0x2D, 0x37, 0xC6, 0xFC, 0xD5, 0x2F, 0x01, 0x3B, 0xFC,
-    0xD9, 0x80, 0x44, 0xBA, 0xB2, 0x49, 0x3E, 0xC1, 0x73, 0x02, 0x89, 0x54, 0x3F, 0x35, 0xF4, 0xEA,
-    0x0A, 0x33, 0x2D, 0xE0, 0x0C, 0x5A, 0xE9, 0x35, 0xEE, 0x0F, 0x68, 0x5F, 0xFE, 0xE3, 0x16, 0xBF,
-    0x82, 0xDC, 0x06, 0xA3, 0xFC, 0xDA, 0x61, 0x56, 0x42, 0xE5, 0x9C, 0x9F, 0xD6, 0x9D, 0x86, 0xE2,
-    0x48, 0xAB, 0xFF, 0x2C, 0x18, 0x02, 0xE6, 0x0C, 0x3F, 0x94, 0xED, 0x85, 0x9D, 0x3E, 0xD2, 0x3D,
-    0xF7, 0xC2, 0xCC, 0xE4, 0x9F, 0x23, 0xFD, 0xCC, 0xC1, 0x6F, 0x76, 0x55, 0xF0, 0xED, 0x24, 0x33,
-    0x28, 0xE9, 0xDE, 0x2B, 0x35, 0x3C, 0xFC, 0x3A, 0xB3, 0xBB, 0x4F, 0xE5, 0xD1, 0xF4, 0x09, 0x14,
-    0xC6, 0x04, 0xBB, 0xE9, 0x6C, 0xB5, 0x74, 0x28, 0xEA, 0xC3, 0x55, 0xDB, 0x34, 0xAB, 0x6A, 0x19,
-    0xE7, 0x9B, 0x74, 0x08, 0xB5, 0x58, 0xD6, 0x07, 0xC0, 0xC4, 0x1C, 0xFC, 0x81, 0xDF, 0x39, 0xCD,
-    0xFD, 0x3C, 0x61, 0xF0, 0x55, 0x8A, 0x81, 0xA9, 0xBB, 0x3D, 0x6C, 0x27, 0x3C, 0xC8, 0xC2, 0x3E,
-    0xE4, 0x55, 0x4D, 0xF9, 0xA1, 0xC2, 0xB0, 0xF0, 0x03, 0x6C, 0xA7, 0xE2, 0xED, 0x02, 0x5B, 0x8E,
-    0x0A, 0xFE, 0x01, 0x4B, 0xB2, 0x2E, 0x87, 0xEE, 0xB6, 0xC9, 0x10, 0x8F, 0x33, 0xCF, 0x6F, 0xD9,
-    0xB2, 0xF0, 0x65, 0xC1, 0x94, 0xD1, 0x5E, 0x6B, 0xCA, 0x3A, 0x1E, 0xB3, 0x9B, 0x03, 0x3F, 0x17,
-    0x5F, 0x6D, 0x1D, 0x90, 0x92, 0xBD, 0x33, 0x64, 0x37, 0xA1, 0xAE, 0x83, 0x9F, 0x1F, 0xF3, 0x2B,
-    0xA1, 0x2D, 0x3C, 0xB0, 0x93, 0x3D, 0xAC, 0xF2, 0xC3, 0x86, 0x30, 0x98, 0x35, 0xFD, 0x88, 0x45,
-    0x4F, 0x02, 0xAF, 0x51, 0x31, 0x72, 0x4A, 0xD4, 0x5B, 0x10, 0x06, 0xCD, 0xA6, 0x0F, 0x7C, 0x44,
-    0xB6, 0xB6, 0x83, 0x21, 0x21, 0x85, 0xF6, 0x0A, 0xBB, 0xDF, 0x94, 0x22, 0xA2, 0x8C, 0x4C, 0x28,
-    0xB6, 0x87, 0x44, 0xB0, 0x99, 0xB8, 0x48, 0x4F, 0x90, 0xAE, 0xD3, 0x54, 0x71, 0x9F, 0x68, 0xF8,
-    0x7D, 0xC2, 0xE9, 0x19, 0xAD, 0x2F, 0x94, 0x9F, 0xCB, 0x96, 0xDF, 0x5F, 0x42, 0xF9, 0x02, 0x9A,
-    0xA6, 0x72, 0xCC, 0x27, 0x39, 0xF6, 0x41, 0x8E, 0x4E, 0xBF, 0x6C, 0x57, 0x31, 0x96, 0x5C, 0xCC,
-    0x25, 0xC8, 0x91, 0xF9, 0xCB, 0xFB, 0xFC, 0xBC, 0xBB, 0x47, 0x5C, 0x18, 0xE4, 0xA8, 0x1F, 0x2A,
-    0x14, 0xF2, 0x37, 0x14, 0x61, 0x45, 0x11, 0x56, 0x53, 0x70, 0x56, 0x18, 0xAD, 0xAA, 0xAE, 0x00,
-    0xBA, 0x1C, 0x26, 0xCA, 0x34, 0xF5, 0xB0, 0x4B, 0x9C, 0x1C, 0xBE, 0x55, 0x84, 0xFF, 0x1C, 0xC1,
-    0xEC, 0xFD, 0xCA, 0xB6, 0x26, 0xBB, 0x0A, 0x58, 0xF8, 0xED, 0x2E, 0x5B, 0x16, 0x63, 0x95, 0xD6,
-    0xF8, 0xB4, 0xC6, 0xB1, 0x0E, 0x25, 0x0F, 0x70, 0x1C, 0x68, 0xEE, 0x1F, 0xFD, 0x0B, 0xE5, 0x87,
-    0xFC, 0x05, 0x92, 0x84, 0x71, 0x01, 0xF7, 0x3D, 0xF5, 0x27, 0xD5, 0x0F, 0x58, 0x5D, 0x32, 0xEE,
-    0x2E, 0x3F, 0xE4, 0x94, 0x94, 0x63, 0x45, 0x38, 0xFB, 0xEC, 0xC8, 0xF2, 0x98, 0xF3, 0xE4, 0x32,
-    0x7D, 0xD1, 0x75, 0x2F, 0xF8, 0x5D, 0xF9, 0x37, 0x58, 0x4C, 0xC7, 0x8A, 0x10, 0xE6, 0x45, 0xF4,
-    0x9B, 0x3F, 0xF5, 0x47, 0x5F, 0x08, 0x66, 0xFE, 0x8B, 0xFF, 0x6B, 0xE1, 0x0C, 0x88, 0x83, 0x54,
-    0xC7, 0x19, 0x15, 0xF4, 0x99, 0x91, 0xA3, 0xD9, 0x1A, 0x75, 0x9E, 0x7E, 0x72, 0x4E, 0x2C, 0xBB,
-    0x26, 0x72, 0xD7, 0x7C, 0x24, 0x72, 0xEF, 0x21, 0x9D, 0xD3, 0xC7, 0xF0, 0x9B, 0xEB, 0xE1, 0x2B,
-    0xA0, 0x31, 0xFF, 0x07, 0xD5, 0x5A, 0x3D, 0x90, 0xDD, 0xD6, 0x75, 0x3E, 0x00, 0xC4, 0x85, 0x2D,
-    0x4C, 0x06, 0x5B, 0x88, 0x29, 0xA4, 0x19, 0xA3, 0xF5, 0xB0, 0x30, 0x52, 0xA4, 0x8C, 0x74, 0x21,
-    0xB2, 0x70, 0xA1, 0x42, 0x2C, 0xB8, 0xF6, 0x78, 0x5C, 0xB8, 0x0E, 0x0B, 0x6F, 0x9B, 0x42, 0x32,
-    0x40, 0xB1, 0x60, 0xE1, 0xC2, 0xCC, 0x44, 0x4A, 0xA3, 0x42, 0x29, 0x38, 0x19, 0x69, 0x59, 0xB0,
-    0x49, 0xA1, 0x82, 0x26, 0x30, 0xE2, 0x4C, 0x58, 0xB0, 0x20, 0x34, 0x8A, 0xA2, 0x82, 0x85, 0x20,
-    0x9B, 0x1E, 0x65, 0xC4, 0x62, 0x21, 0x19, 0xB2, 0x40, 0xF2, 0x02, 0x27, 0xDF, 0x77, 0xF0, 0xDE,
-    0xDB, 0x25, 0x1D, 0xCB, 0xA2, 0x3D, 0x9B, 0xA1, 0x76, 0xF1, 0x80, 0x0B, 0xE0, 0xDE, 0x7B, 0x7E,
-    0xEE, 0xF9, 0xBF, 0x10, 0x29, 0xCF, 0xEB, 0xCB, 0xB3, 0x1B, 0xCA, 0x66, 0x5B, 0xF0, 0x57, 0x9E,
-    0xD3, 0xD8, 0x67, 0x7D, 0xF9, 0x9E, 0x26, 0x3E, 0xEF, 0xEB, 0xEB, 0x9A, 0x7A, 0x37, 0xE8, 0x07,
-    0xFA, 0xF2, 0xE4, 0x46, 0xBE, 0x97, 0xB4, 0x11, 0x71, 0x22, 0xC1, 0x5C, 0x48, 0xAD, 0x63, 0xAA,
-    0xDA, 0xA9, 0x6A, 0xA2, 0xFF, 0xED, 0xF1, 0x3E, 0xD0, 0x46, 0x92, 0x59, 0x24, 0x1F, 0x44, 0xEA,
-    0x56, 0x42, 0x2D, 0xEC, 0x36, 0xC3, 0xC8, 0xB2, 0x17, 0xD1, 0x3E, 0xF8, 0x67, 0x74, 0x3E, 0xA5,
-    0x3A, 0x85, 0xAA, 0x43, 0x50, 0x6B, 0x25, 0xAE, 0x10, 0xF1, 0x22, 0x11, 0x5E, 0x1F, 0x2B, 0x64,
-    0xF9, 0xDB, 0xD5, 0x8B, 0x92, 0xAB, 0x56, 0x89, 0x6A, 0x2F, 0x18, 0x20, 0x99, 0x0F, 0x2E, 0x72,
-    0x32, 0xC9, 0xD1, 0x2D, 0x54, 0x59, 0x1A, 0x11, 0xA7, 0xC7, 0xEB, 0xA2, 0xC6, 0x64, 0xD6, 0xF8,
-    0xB1, 0xBE, 0x71, 0xFA, 0xA0, 0x8F, 0xB3, 0x3E, 0x62, 0xA8, 0x48, 0x0E, 0x1C, 0xD8, 0x67, 0x42,
-    0x67, 0xBD, 0xBD, 0x6E, 0xB4, 0x04, 0x17, 0x35, 0xF2, 0xBD, 0x70, 0xD6, 0xFD, 0x0E, 0x4F, 0x46,
-    0xF4, 0x19, 0x03, 0xFD, 0xA1, 0x17, 0x15, 0x57, 0xB9, 0x22, 0xE9, 0xD3, 0x36, 0xF4, 0xD1, 0x28,
-    0xB3, 0xD4, 0x45, 0x5D, 0x64, 0xAA, 0x0D, 0x7E, 0x1E, 0x64, 0x6B, 0x33, 0x9E, 0x7D, 0xA9, 0x79,
-    0x4A, 0xA4, 0xC2, 0xF4, 0xD9, 0x3D, 0x50, 0xAE, 0xD7, 0x55, 0xA2, 0x39, 0x9A, 0x81, 0x41, 0x82,
-    0xF1, 0x55, 0x3A, 0xE2, 0x92, 0xF7, 0xAE, 0x13, 0xF7, 0x3E, 0xD0, 0xA8, 0x6F, 0x01, 0x05, 0xAD,
-    0x1B, 0x20, 0x37, 0x13, 0xB1, 0x5E, 0xC2, 0x2B, 0xFA, 0x99, 0x60, 0x2A, 0x2F, 0x8E, 0x94, 0x1E,
-    0xD7, 0x0F, 0x17, 0x84, 0xB7, 0xAE, 0xCC, 0x97, 0x96, 0x47, 0x04, 0x13, 0xFC, 0x58, 0x77, 0xC0,
-    0x76, 0xBF, 0xA2, 0x48, 0x00, 0x49, 0xEA, 0xC3, 0x7F, 0x0B, 0xD3, 0xCE, 0x1E, 0x7E, 0x74, 0x56,
-    0x8E, 0x83, 0x11, 0xB6, 0x3C, 0xEF, 0xE9, 0x65, 0xEF, 0x9A, 0xAD, 0x53, 0x18, 0x0F, 0x4C, 0x02,
-    0xED, 0x24, 0xC6, 0xAF, 0xD6, 0x2E, 0xBB, 0xAB, 0xE7, 0x7D, 0xEC, 0x5D, 0x95, 0x7D, 0xE0, 0x65,
-    0x76, 0x5D, 0xF6, 0xBE, 0x7E, 0xE0, 0x63, 0xB0, 0x3D, 0x05, 0xE0, 0xE7, 0xB0, 0x34, 0xC9, 0x04,
-    0xB6, 0x61, 0xC8, 0xFC, 0x4F, 0xE2, 0x3E, 0xD2, 0xDA, 0x97, 0xAA, 0x01, 0x5E, 0xCB, 0x71, 0x83,
-    0xE7, 0x64, 0xAA, 0x5F, 0x53, 0x7D, 0x4D, 0xCB, 0x62, 0x7A, 0x4A, 0xB6, 0x57, 0x4B, 0x27, 0x5B,
-    0x7A, 0x0F, 0x67, 0x4C, 0x83, 0xC1, 0xE1, 0x2C, 0xCF, 0x81, 0x66, 0xB4, 0x12, 0xF0, 0x40, 0xFE,
-    0xF6, 0x74, 0x5E, 0xC5, 0x60, 0x5F, 0xFB, 0x6B, 0x19, 0x62, 0xF5, 0x51, 0x9F, 0xE1, 0x55, 0x91,
-    0x9D, 0xEA, 0x72, 0xAC, 0xEC, 0xF8, 0x0F, 0x14, 0x81, 0xE4, 0x46, 0xF3, 0x0B, 0x0C, 0x7F, 0xE5,
-    0x95, 0x18, 0x2B, 0x13, 0xDF, 0x68, 0x5E, 0x3D, 0xB8, 0xB9, 0xDE, 0xBC, 0x80, 0x9B, 0xAB, 0xCF,
-    0xB3, 0x5B, 0xFA, 0x5A, 0x9F, 0x55, 0x22, 0x43, 0x5A, 0xE8, 0xE5, 0x26, 0x97, 0xAB, 0xA1, 0xFA,
-    0xB8, 0x8D, 0xFA, 0xF0, 0x9D, 0xC0, 0x4B, 0x46, 0xF6, 0x40, 0xDE, 0x2E, 0x4A, 0xC9, 0x16, 0xE4,
-    0x93, 0x12, 0x60, 0xE7, 0x15, 0xE6, 0xC0, 0xB1, 0x4D, 0x75, 0x48, 0x2F, 0x7B, 0x8A, 0xDE, 0xD9,
-    0x29, 0xD1, 0x29, 0xFF, 0xDD, 0xE4, 0x8A, 0xC9, 0x9D, 0x9C, 0xDC, 0xFE, 0x94, 0xE9, 0xAB, 0x5B,
-    0x77, 0xBE, 0x2F, 0xDF, 0x91, 0xEF, 0x8A, 0x5C, 0x93, 0x5F, 0x40, 0x82, 0x63, 0x85, 0xF8, 0xBA,
-    0x3E, 0x52, 0x48, 0x9C, 0x1B, 0xF2, 0x31, 0xD2, 0x93, 0xDA, 0xE4, 0x63, 0xE6, 0xED, 0xB1, 0xD4,
-    0x1D, 0x84, 0x5B, 0x5B, 0x3B, 0xD5, 0x1D, 0xD6, 0x47, 0xDB, 0x40, 0x2B, 0x2C, 0xDC, 0x20, 0x83,
-    0x04, 0x5C, 0x9A, 0xBD, 0xBD, 0xBD, 0x5D, 0x2C, 0xE5, 0x5D, 0xFC, 0xEE, 0xE3, 0x37, 0x93, 0x7D,
-    0xC0, 0x3F, 0x05, 0x52, 0x11, 0xB5, 0xEA, 0xE0, 0x81, 0xD3, 0xDF, 0xEA, 0x6C, 0x27, 0x39, 0xF8,
-    0xFB, 0xD3, 0x3C, 0x3D, 0xB6, 0x23, 0xE4, 0x29, 0x54, 0x04, 0x3C, 0x4D, 0x17, 0x9E, 0xFA, 0xA4,
-    0x03, 0x4F, 0xD3, 0xC6, 0x81, 0xA7, 0x82, 0x27, 0xE0, 0x69, 0x0A, 0xAE, 0xBE, 0xF2, 0x8A, 0x4C,
-    0xBB, 0x0D, 0x78, 0xCA, 0xE5, 0xC5, 0x0D, 0x20, 0x80, 0xA7, 0xE9, 0x7B, 0x3D, 0x78, 0x2A, 0x3E,
-    0x6D, 0xC0, 0xD3, 0xB4, 0xE1, 0x2C, 0x05, 0xC6, 0x80, 0xA7, 0x69, 0x93, 0x5D, 0x00, 0x4F, 0xCF,
-    0xC8, 0xCE, 0x9F, 0xE7, 0xE9, 0x09, 0x10, 0xF8, 0x2F, 0x20, 0x4C, 0x21, 0xB4, 0xFA, 0x05, 0x6E,
-    0xF6, 0x84, 0x3A, 0x48, 0x49, 0x72, 0xEA, 0xCB, 0x17, 0xA7, 0x6B, 0x72, 0xED, 0x9A, 0x94, 0x38,
-    0xA3, 0xED, 0xA8, 0x3E, 0x03, 0xDE, 0x9A, 0xEE, 0xC1, 0x52, 0x04, 0x13, 0xED, 0x0E, 0x64, 0x20,
-    0xE3, 0x3A, 0x2F, 0x0F, 0xB6, 0xF6, 0xEA, 0xBD, 0x7F, 0x27, 0xAB, 0xA8, 0xA5, 0x57, 0x94, 0x10,
-    0x1F, 0xE9, 0x71, 0x30, 0x24, 0x38, 0x2D, 0xCF, 0x02, 0xE4, 0x9B, 0x6B, 0xEE, 0x72, 0x48, 0x25,
-    0x3B, 0x50, 0x77, 0xB0, 0x73, 0xC8, 0xF7, 0xFD, 0xD3, 0x91, 0x17, 0x1C, 0xF1, 0x28, 0x69, 0x2F,
-    0xAE, 0x15, 0x2D, 0xA2, 0x49, 0xD2, 0x01, 0x2A, 0x36, 0x2D, 0x07, 0x31, 0x59, 0xF5, 0x1F, 0xB3,
-    0x37, 0xFD, 0x53, 0x10, 0xA3, 0xD0, 0xCB, 0x4F, 0x81, 0x64, 0x13, 0xEA, 0x20, 0x5B, 0xE8, 0x30,
-    0x6F, 0x43, 0x47, 0x2E, 0x13, 0xF9, 0x1C, 0xB8, 0x40, 0x21, 0xF7, 0x2E, 0xE6, 0xD0, 0x16, 0xA8,
-    0xB9, 0x6B, 0xE3, 0xDE, 0x96, 0x09, 0xFA, 0x92, 0x4C, 0x30, 0x06, 0xF5, 0xED, 0x3F, 0xDF, 0x50,
-    0x34, 0xD2, 0x89, 0xD2, 0x72, 0x1B, 0xE6, 0x6D, 0xAA, 0x87, 0x08, 0x8D, 0x07, 0x1B, 0xEB, 0xF4,
-    0xFB, 0xA9, 0xDE, 0xF7, 0xF9, 0xED, 0xE9, 0x99, 0xC5, 0x78, 0x51, 0x13, 0xFF, 0x44, 0x03, 0xE4,
-    0xEF, 0xEC, 0x9C, 0xA6, 0x65, 0x83, 0x7C, 0x68, 0x4F, 0xF2, 0x61, 0x3A, 0x4F, 0xFE, 0x1E, 0x26,
-    0x31, 0x77, 0xEB, 0x06, 0x34, 0xF7, 0xE4, 0x57, 0x0F, 0x3D, 0x61, 0xE3, 0x0B, 0x36, 0x60, 0x21,
-    0x4E, 0xF6, 0x25, 0x1A, 0x58, 0xCF, 0x93, 0xBD, 0x04, 0x68, 0x48, 0xF6, 0x17, 0x35, 0xEC, 0x6F,
-    0xE5, 0x4C, 0xEA, 0xE6, 0x19, 0x89, 0xDB, 0x70, 0x04, 0x8A, 0x60, 0x7C, 0x9D, 0xE9, 0x0D, 0x6D,
-    0x61, 0xD4, 0x61, 0x4F, 0x1A, 0xD7, 0x97, 0xBE, 0xD6, 0x6C, 0xFF, 0xBD, 0x0B, 0x3D, 0xD8, 0x5C,
-    0xE3, 0x49, 0xD2, 0x87, 0xEB, 0x86, 0xCD, 0x11, 0xD0, 0xF2, 0x0F, 0xD9, 0x03, 0x98, 0xAD, 0xD9,
-    0x15, 0xB5, 0x2B, 0x4A, 0x3B, 0xEA, 0xBC, 0x99, 0x21, 0xE2, 0x31, 0xC4, 0xF7, 0xE7, 0x45, 0x28,
-    0x41, 0x21, 0x25, 0xFE, 0xE3, 0x19, 0x16, 0xD3, 0x54, 0x34, 0x9D, 0xE0, 0x6B, 0x52, 0x9F, 0x4E,
-    0x70, 0x17, 0x38, 0x99, 0x7E, 0x52, 0x35, 0xD7, 0xFA, 0x3B, 0x6C, 0xF4, 0x37, 0xD0, 0x02, 0x46,
-    0xF4, 0x5D, 0xB9, 0x2A, 0x62, 0x2E, 0x27, 0x87, 0xAD, 0xA3, 0x7B, 0xAA, 0x24, 0xA3, 0x75, 0x84,
-    0x53, 0x6A, 0x60, 0x3C, 0x2B, 0x0A, 0x98, 0x2B, 0x2B, 0x78, 0x02, 0xF9, 0x1B, 0x57, 0x85, 0x93,
-    0x29, 0x69, 0x64, 0x76, 0xB8, 0x32, 0x54, 0x5D, 0x45, 0x0D, 0xA6, 0x9F, 0x68, 0xE0, 0xBB, 0x5C,
-    0x55, 0x42, 0x16, 0x70, 0x51, 0x2E, 0x8C, 0x3B, 0x37, 0x05, 0x70, 0x2F, 0xEE, 0xBC, 0x8F, 0x70,
-    0x39, 0xFE, 0xD2, 0x90, 0xEC, 0x63, 0xB5, 0xD2, 0x3E, 0xDB, 0xA5, 0x33, 0x6A, 0x5D, 0xDE, 0x72,
-    0xE0, 0x55, 0x5E, 0x34, 0x18, 0x71, 0x09, 0x40, 0x08, 0x24, 0x31, 0xF2, 0x76, 0x89, 0x87, 0x60,
-    0xAF, 0xFE, 0x1F, 0xCA, 0x2B, 0x3A, 0xF3, 0xB0, 0xCB, 0x5F, 0x8F, 0xE7, 0x59, 0xC3, 0xF3, 0x02,
-    0x84, 0x1A, 0x78, 0x66, 0xF4, 0x3C, 0xE7, 0xA6, 0xF4, 0xEE, 0x44, 0x3C, 0xC3, 0x60, 0x26, 0x9E,
-    0xA6, 0x5B, 0x80, 0xCB, 0x09, 0x00, 0x33, 0x19, 0xCC, 0x34, 0xC1, 0x0F, 0x70, 0xFE, 0xBA, 0x02,
-    0x9E, 0x70, 0x72, 0xC2, 0xD7, 0xE9, 0xBD, 0x33, 0x54, 0x46, 0x88, 0x1B, 0xFB, 0xF3, 0x42, 0x1C,
-    0x55, 0x57, 0xA2, 0x90, 0xD1, 0x7D, 0x34, 0x11, 0x2D, 0x19, 0x3A, 0x3C, 0xF0, 0xC4, 0xFD, 0x3B,
-    0xE8, 0x5F, 0xD2, 0xD0, 0x35, 0x86, 0xDF, 0x4C, 0x42, 0xE8, 0x92, 0x94, 0xE6, 0xAD, 0xA2, 0x66,
-    0x3F, 0x5D, 0x37, 0xA0, 0x0A, 0x30, 0x5F, 0x9B, 0x82, 0x33, 0x18, 0x99, 0xF6, 0x79, 0xFF, 0x6E,
-    0x3C, 0xD6, 0x02, 0x47, 0xA6, 0x1F, 0xC1, 0xA1, 0xC5, 0xD0, 0xD8, 0xA6, 0xF6, 0xC1, 0xDE, 0x8B,
-    0x73, 0xF4, 0x31, 0x7D, 0x41, 0xEF, 0x38, 0xA0, 0x3C, 0x39, 0x28, 0xB1, 0x4A, 0xCF, 0x1B, 0xDE,
-    0x13, 0x39, 0x47, 0x95, 0x20, 0xD8, 0x8C, 0xAE, 0xB4, 0xAC, 0x4E, 0x5C, 0x9E, 0x0B, 0x82, 0xC5,
-    0x2B, 0x80, 0x25, 0xF3, 0xE4, 0x34, 0xE0, 0x92, 0x5C, 0x5D, 0x7E, 0x0C, 0x56, 0xC2, 0xF1, 0xC0,
-    0xF0, 0x12, 0x03, 0x8E, 0xE0, 0x2F, 0xA1, 0x03, 0x65, 0x88, 0xD3, 0x03, 0xD5, 0x46, 0x52, 0x74,
-    0x75, 0x83, 0xF9, 0x54, 0x29, 0xB1, 0x3C, 0x65, 0x27, 0xDB, 0x6E, 0xD8, 0x1A, 0xA1, 0x58, 0x1E,
-    0xF0, 0x20, 0x73, 0x3A, 0xCA, 0x2E, 0x82, 0xA4, 0xAD, 0x3D, 0xB3, 0x73, 0xF4, 0xDA, 0xE0, 0x9F,
-    0x99, 0x4C, 0x86, 0x47, 0x00, 0xEC, 0x0D, 0xC6, 0x35, 0x79, 0xE4, 0xAF, 0x36, 0x04, 0xD4, 0x9B,
-    0x26, 0x4C, 0x36, 0x96, 0x2C, 0x8D, 0x66, 0x9E, 0x13, 0x4F, 0xBB, 0x99, 0x7A, 0x4E, 0x97, 0x8E,
-    0x08, 0x26, 0x30, 0x19, 0x51, 0x70, 0x74, 0x44, 0x40, 0x62, 0x89, 0xBC, 0x18, 0x70, 0x69, 0x83,
-    0x90, 0x81, 0xAA, 0x34, 0xC1, 0x12, 0xD3, 0xE7, 0x44, 0x34, 0xD0, 0xF4, 0x22, 0x08, 0x94, 0x68,
-    0x2F, 0xD0, 0x61, 0xDE, 0xF9, 0x11, 0xE2, 0x19, 0x40, 0xD2, 0x96, 0xD1, 0x5D, 0xDD, 0x93, 0xA2,
-    0xB2, 0x67, 0xAC, 0xE6, 0x46, 0x9A, 0xF7, 0x9C, 0x58, 0x9C, 0xFD, 0x37, 0x43, 0xA8, 0x93, 0x25,
-    0xE4, 0x5A, 0x19, 0x1F, 0xC9, 0x4C, 0x5B, 0x5D, 0xF5, 0xA4, 0xE3, 0x7F, 0xC2, 0xD0, 0xAF, 0xBD,
-    0xB9, 0x24, 0xBA, 0xD5, 0x78, 0x22, 0x15, 0x59, 0xEF, 0xDA, 0x8D, 0x86, 0x3C, 0xD1, 0xFC, 0x37,
-    0xF9, 0x99, 0x11, 0x4D, 0x40, 0x46, 0xEF, 0xD2, 0x20, 0x50, 0x9C, 0xC5, 0xFD, 0x90, 0x38, 0x3C,
-    0x2F, 0x3F, 0x97, 0x6F, 0x03, 0xFE, 0x49, 0x07, 0xE3, 0xB5, 0xE2, 0xF9, 0x72, 0x86, 0x62, 0x03,
-    0x7A, 0x60, 0x01, 0xD2, 0x13, 0x8D, 0x7F, 0x6E, 0x5E, 0x56, 0x89, 0x55, 0x70, 0x8F, 0xF8, 0x84,
-    0xFD, 0x0B, 0x9B, 0xF3, 0x82, 0xE1, 0x13, 0x84, 0xAD, 0x8D, 0xA0, 0xB1, 0xB6, 0xF1, 0x92, 0xF1,
-    0xD2, 0x2F, 0xB3, 0xE1, 0xB6, 0xFC, 0x4C, 0xDF, 0xD8, 0x39, 0x0D, 0xBC, 0xB2, 0x85, 0xC9, 0xE7,
-    0x2C, 0x0A, 0xCB, 0x7B, 0xBB, 0x8D, 0x10, 0xDE, 0xF3, 0xB6, 0x6C, 0xB3, 0x69, 0xE7, 0x0C, 0xD0,
-    0x0E, 0x2C, 0xFD, 0xD0, 0x2A, 0xB3, 0x14, 0xA5, 0xB7, 0xDB, 0x18, 0x36, 0x7B, 0xDE, 0x7B, 0x5B,
-    0x96, 0x20, 0x8B, 0xD9, 0x0B, 0x39, 0x43, 0x9C, 0x79, 0xEB, 0x96, 0xDB, 0x84, 0xA8, 0x56, 0x96,
-    0xAA, 0x70, 0xE6, 0x8C, 0x66, 0x13, 0x41, 0xCD, 0x0A, 0x1F, 0x20, 0xCC, 0x5B, 0x72, 0x2B, 0xD3,
-    0xB5, 0xBB, 0x40, 0x32, 0x78, 0x71, 0xC9, 0x85, 0x10, 0xAC, 0x18, 0x64, 0x84, 0xD9, 0xC3, 0x56,
-    0x9F, 0x40, 0x57, 0xB7, 0x69, 0x6C, 0x17, 0x59, 0xB2, 0x24, 0x94, 0x74, 0x2F, 0xB9, 0xD0, 0xA3,
-    0xA7, 0x61, 0xDD, 0xC5, 0x3A, 0xD3, 0x03, 0x99, 0x5D, 0x67, 0x68, 0x17, 0xFC, 0x07, 0x99, 0x30,
-    0x88, 0x9D, 0x72, 0x9E, 0xB6, 0x2C, 0xFF, 0xCB, 0x2E, 0x2E, 0x11, 0xC0, 0x92, 0x22, 0x9A, 0xA9,
-    0x67, 0xF0, 0x27, 0xC1, 0x3E, 0x4F, 0xCA, 0x19, 0x81, 0xD9, 0x89, 0x4B, 0x42, 0x77, 0x1E, 0xEB,
-    0x92, 0x89, 0xD1, 0x1D, 0x96, 0xEB, 0x74, 0x15, 0x33, 0xEE, 0x63, 0xC9, 0xD6, 0x97, 0x0F, 0x77,
-    0x5E, 0xF6, 0x46, 0x7A, 0xBA, 0xBA, 0x80, 0x99, 0x78, 0x77, 0x0B, 0x64, 0xF1, 0x02, 0xE6, 0x1D,
-    0x7A, 0x77, 0xE8, 0xF2, 0xD0, 0x2C, 0x12, 0xEC, 0xC1, 0xAF, 0x0F, 0x7C, 0xC3, 0x8C, 0x90, 0x2E,
-    0xBF, 0x95, 0xA3, 0x84, 0x77, 0xF6, 0x22, 0x16, 0x03, 0xB0, 0x90, 0xB8, 0xEE, 0x42, 0x3F, 0xEB,
-    0x5F, 0x76, 0x16, 0x63, 0x1F, 0x19, 0x3C, 0xF0, 0xD6, 0x47, 0x50, 0x86, 0xFA, 0xFA, 0x0C, 0x69,
-    0x6C, 0xCA, 0x62, 0x5B, 0x8E, 0x92, 0x9F, 0xF0, 0x61, 0x90, 0x0B, 0xD3, 0xAE, 0x82, 0x49, 0x4C,
-    0xD2, 0x2D, 0xB0, 0x72, 0x66, 0x5B, 0x4C, 0x5B, 0x9E, 0x83, 0xDC, 0x32, 0x87, 0x7F, 0x8C, 0x23,
-    0xD1, 0x71, 0x19, 0x8B, 0x43, 0x9E, 0x7E, 0x9B, 0x00, 0xEA, 0x0E, 0xB1, 0x25, 0x1C, 0x7B, 0xDA,
-    0xAD, 0x8D, 0x99, 0x8E, 0x86, 0xA7, 0xDF, 0xD5, 0x2E, 0x22, 0x7F, 0x1F, 0xE3, 0xC8, 0x59, 0x5A,
-    0xF1, 0xCB, 0x41, 0x2F, 0x16, 0x41, 0xAF, 0x73, 0x6D, 0x43, 0x85, 0x82, 0x76, 0xAE, 0x45, 0x88,
-    0xDB, 0xAC, 0xAD, 0x2B, 0x94, 0x8F, 0x48, 0x50, 0x73, 0xAC, 0xA8, 0xD2, 0x1B, 0x1B, 0xA2, 0x95,
-    0xB4, 0x3E, 0xCE, 0x2D, 0x5D, 0xE4, 0x6A, 0xAA, 0xC8, 0xFC, 0x8C, 0x24, 0x6D, 0x7E, 0xC1, 0xA7,
-    0x5F, 0x6A, 0x34, 0x21, 0x64, 0x3C, 0xB0, 0xD6, 0xE0, 0x1C, 0xD4, 0xF5, 0x3A, 0xFA, 0xEC, 0x32,
-    0x80, 0x6B, 0x38, 0xCF, 0x5A, 0x5A, 0xBF, 0xD1, 0x4D, 0x62, 0xE5, 0x89, 0xEB, 0x96, 0xB4, 0x10,
-    0xD6, 0x25, 0xB3, 0x26, 0x88, 0x98, 0x9C, 0xD9, 0x12, 0xB3, 0x28, 0x91, 0xEE, 0x80, 0x1E, 0xF4,
-    0x87, 0x6C, 0x62, 0x60, 0x36, 0x73, 0x86, 0xDC, 0x73, 0x2A, 0x37, 0xD8, 0x2A, 0x7F, 0x04, 0x4D,
-    0x8E, 0xF4, 0x2D, 0xA8, 0x72, 0x3A, 0xC3, 0x72, 0x14, 0xEE, 0x1E, 0x0D, 0x8B, 0x7E, 0x52, 0x7E,
-    0x79, 0x3A, 0xB2, 0x30, 0x3F, 0xB5, 0xDE, 0x75, 0x8F, 0xDE, 0x08, 0x31, 0x31, 0x49, 0x09, 0x11,
-    0x6F, 0x7E, 0xA6, 0x6D, 0x64, 0x76, 0x36, 0x35, 0x73, 0xE9, 0xCC, 0x6C, 0xA9, 0xE5, 0xD9, 0x2B,
-    0x21, 0xAC, 0x5E, 0xA5, 0x39, 0xBB, 0xD2, 0x90, 0xB9, 0x78, 0x87, 0xB4, 0x0F, 0xF8, 0x15, 0xDF,
-    0x2B, 0x0E, 0xBB, 0x2A, 0x5A, 0x87, 0xF2, 0x16, 0x80, 0xC4, 0x9E, 0x22, 0x8D, 0xE6, 0xC0, 0x26,
-    0x1E, 0xA0, 0x39, 0xB1, 0x59, 0x03, 0xDE, 0xAD, 0xAF, 0x10, 0xDA, 0x7A, 0x85, 0x14, 0x97, 0xB7,
-    0x86, 0xBA, 0x47, 0xF3, 0x94, 0x16, 0x68, 0x22, 0x7F, 0xF4, 0x40, 0xB1, 0x2D, 0x6F, 0x8D, 0xB1,
-    0xA2, 0x59, 0xB9, 0x11, 0x4D, 0xD1, 0x1B, 0x9E, 0x09, 0x10, 0x9B, 0xEE, 0x01, 0x9A, 0xB0, 0x85,
-    0x68, 0x22, 0xF3, 0x61, 0xA4, 0xCF, 0x66, 0x68, 0xCD, 0x94, 0x4D, 0x86, 0x35, 0xC1, 0x5E, 0x61,
-    0xCE, 0xC7, 0xEC, 0x83, 0x99, 0xC1, 0xA5, 0x58, 0xB4, 0x14, 0xC1, 0x0E, 0xD9, 0x29, 0xD9, 0x58,
-    0xDA, 0xCA, 0x2C, 0xEF, 0x68, 0xA9, 0xBC, 0x2E, 0xC6, 0xBB, 0x89, 0xF5, 0x4E, 0xAC, 0x5D, 0x0A,
-    0xF5, 0xD0, 0x9E, 0x86, 0xD3, 0x8D, 0xE6, 0xFC, 0x58, 0xD6, 0x43, 0x42, 0x45, 0xCB, 0x9A, 0x4E,
-    0xAB, 0x73, 0x7F, 0xE8, 0x7C, 0xF8, 0xF9, 0x48, 0xC8, 0xCB, 0xA8, 0x65, 0x06, 0xDA, 0xDE, 0x7A,
-    0xC0, 0xB4, 0x48, 0xDA, 0xCC, 0x05, 0x35, 0xB6, 0xAC, 0x05, 0xED, 0xAF, 0x37, 0xAF, 0x41, 0xE3,
-    0x8B, 0xFC, 0x9D, 0x7F, 0xCF, 0xBE, 0x6D, 0xD8, 0x5A, 0x6C, 0x6C, 0xD1, 0xB2, 0xD5, 0xEE, 0xE0,
-    0x37, 0x2D, 0xD8, 0x6C, 0xE5, 0x5B, 0x41, 0xC5, 0xB3, 0x97, 0x6C, 0x15, 0x96, 0xA0, 0x80, 0x61,
-    0x66, 0x38, 0xB3, 0x64, 0x92, 0x8C, 0x8C, 0x96, 0xB3, 0xF6, 0x70, 0x72, 0xF1, 0x24, 0xAF, 0xC5,
-    0x92, 0x86, 0x17, 0x57, 0x19, 0x4F, 0xDC, 0xF7, 0xA6, 0x98, 0x9C, 0xF6, 0x3F, 0x19, 0x59, 0x64,
-    0xF2, 0x83, 0xE2, 0xDB, 0x43, 0x45, 0x34, 0xA4, 0x2C, 0x97, 0x78, 0xF2, 0x7F, 0x39, 0xC7, 0x83,
-    0x59, 0xE7, 0x22, 0x90, 0x6F, 0x09, 0x15, 0x7F, 0x2F, 0x71, 0x84, 0xB4, 0x39, 0x1F, 0xE2, 0x39,
-    0x1F, 0x10, 0x34, 0x3E, 0x98, 0xE9, 0x1A, 0x24, 0x9F, 0x4D, 0x5B, 0x62, 0xAC, 0x4C, 0xA9, 0x7C,
-    0xD7, 0xE3, 0xDD, 0xE7, 0x78, 0xF7, 0x9B, 0x4E, 0x7E, 0x00, 0xE2, 0xB6, 0x0F, 0x48, 0x8B, 0x8C,
-    0xBA, 0x5F, 0xB5, 0x16, 0x6F, 0x35, 0x4B, 0xEC, 0xF6, 0x08, 0x75, 0x91, 0x51, 0x97, 0x2A, 0xA9,
-    0xCB, 0x95, 0xD4, 0xB9, 0xB7, 0x48, 0x9D, 0x92, 0x8A, 0xD0, 0x93, 0xAE, 0x68, 0xE4, 0x39, 0xED,
-    0xF9, 0x24, 0x6F, 0x78, 0x76, 0x15, 0xA9, 0x53, 0x52, 0x37, 0x7B, 0x52, 0x07, 0xDE, 0x91, 0xBA,
-    0xFE, 0xFF, 0xA4, 0x8E, 0x10, 0x61, 0xF9, 0xEF, 0x93, 0xBA, 0xA0, 0x3F, 0xB4, 0x46, 0x96, 0x60,
-    0x26, 0xBA, 0x49, 0x90, 0x63, 0x53, 0x1F, 0xEA, 0x8D, 0x3C, 0xAC, 0x30, 0x88, 0x9D, 0x43, 0xDA,
-    0x51, 0xA9, 0x3F, 0x50, 0xC6, 0xD2, 0xDC, 0x6E, 0x20, 0xC3, 0xFF, 0xCA, 0x87, 0x91, 0xBE, 0x0C,
-    0x88, 0x70, 0x45, 0x15, 0xFC, 0x44, 0x09, 0x2F, 0x4E, 0xC7, 0xC4, 0x48, 0x88, 0xAE, 0xC4, 0x62,
-    0x52, 0x72, 0x78, 0x53, 0x3F, 0x0E, 0x69, 0x70, 0x23, 0x0A, 0x8B, 0x15, 0x31, 0x03, 0xCB, 0x89,
-    0xED, 0xF4, 0x70, 0x2E, 0xFF, 0x64, 0x60, 0xBB, 0x57, 0xAD, 0xB3, 0x17, 0x93, 0xEF, 0xF2, 0x63,
-    0xFA, 0xAC, 0x46, 0x8B, 0x47, 0x53, 0xDF, 0x27, 0x03, 0xDB, 0x4D, 0xAE, 0x18, 0xFB, 0x74, 0x00,
-    0x6B, 0x23, 0xEA, 0x4B, 0x53, 0xFF, 0x51, 0xA2, 0xF8, 0x64, 0x60, 0x1B, 0x2C, 0xCC, 0x6D, 0xD7,
-    0x27, 0x66, 0x78, 0xAC, 0x91, 0x89, 0x6D, 0x6B, 0x1D, 0x4A, 0x69, 0x89, 0xED, 0x5B, 0x4C, 0xF0,
-    0x38, 0xB3, 0x76, 0x8C, 0x42, 0xFA, 0x64, 0x66, 0xC4, 0x68, 0x19, 0x5D, 0x0E, 0xCD, 0x02, 0x6C,
-    0x66, 0x17, 0xF5, 0x6F, 0xB0, 0x34, 0xE9, 0x04, 0x84, 0x02, 0x4B, 0x4F, 0x1C, 0x63, 0xB0, 0xD8,
-    0x02, 0x31, 0x5B, 0x44, 0xE6, 0x7F, 0x2B, 0xCF, 0x68, 0x4E, 0xD2, 0x1C, 0x7E, 0xFA, 0xB5, 0x0F,
-    0xF9, 0xC8, 0xAC, 0x92, 0x5F, 0x75, 0x62, 0x94, 0xC5, 0x88, 0x87, 0xB4, 0x5D, 0x67, 0xA6, 0xC5,
-    0x4D, 0x2D, 0xF4, 0xD0, 0x5B, 0x48, 0xF3, 0xBE, 0x42, 0x64, 0x06, 0xF0, 0x11, 0xD3, 0x34, 0x3C,
-    0x08, 0x90, 0xB6, 0xC1, 0xF8, 0x93, 0x0B, 0xAB, 0x21, 0x77, 0xAC, 0x08, 0xF4, 0x47, 0x93, 0x4A,
-    0xB0, 0xB3, 0x44, 0x85, 0x64, 0x91, 0xD9, 0x24, 0x46, 0x63, 0xFA, 0xA6, 0xD9, 0x95, 0xDC, 0x27,
-    0x4C, 0x69, 0x19, 0x7C, 0x6B, 0xC3, 0xF2, 0x77, 0x8B, 0xD4, 0x57, 0xBB, 0x64, 0x0A, 0xB4, 0x0B,
-    0x19, 0x03, 0x21, 0x0D, 0x06, 0x93, 0x72, 0xC4, 0x44, 0x80, 0x1E, 0xDB, 0xC3, 0x9A, 0x75, 0xD4,
-    0x44, 0x87, 0x9C, 0x73, 0xBD, 0xC4, 0xC8, 0xFD, 0x0B, 0x0C, 0xCF, 0x3C, 0x86, 0x47, 0xBA, 0x8B,
-    0x45, 0xD0, 0x9B, 0x53, 0xFA, 0x06, 0x1E, 0x9E, 0x02, 0x5E, 0x75, 0x0B, 0x04, 0x31, 0x7C, 0x59,
-    0x9C, 0x82, 0xE5, 0xF9, 0x85, 0x57, 0x81, 0xE5, 0xDE, 0x7E, 0xB5, 0x2E, 0xAB, 0x4A, 0xBD, 0x1C,
-    0x7F, 0x9D, 0xEC, 0xED, 0x69, 0x91, 0x6C, 0xA3, 0x2D, 0xF9, 0xAF, 0x9C, 0x7B, 0x2B, 0x24, 0xAC,
-    0xEC, 0xE4, 0xD8, 0xEE, 0x88, 0xDC, 0x70, 0x66, 0xDA, 0xFD, 0x2B, 0xBD, 0xAF, 0x9F, 0x6A, 0x91,
-    0xDD, 0x47, 0x08, 0x37, 0xD7, 0x88, 0xBD, 0xAF, 0x8C, 0x01, 0x1E, 0xFC, 0x2B, 0xC3, 0x7A, 0x9D,
-    0x33, 0xF5, 0xE5, 0x39, 0x30, 0xA5, 0x0B, 0x6C, 0xB9, 0x9F, 0x7E, 0x67, 0x31, 0x63, 0x5C, 0x47,
-    0xAB, 0x91, 0x4E, 0x4B, 0x2A, 0x79, 0x74, 0x20, 0xB7, 0xDE, 0x21, 0xB4, 0xD6, 0xF2, 0xB6, 0x68,
-    0xAE, 0x9B, 0x68, 0x8A, 0x7D, 0xE0, 0xD7, 0xD2, 0x77, 0x34, 0x54, 0x52, 0x08, 0x87, 0x14, 0x12,
-    0x73, 0x17, 0x7E, 0x43, 0xFB, 0xF8, 0x93, 0x7A, 0x08, 0xFA, 0xF0, 0x8E, 0x1C, 0x2D, 0xC8, 0x52,
-    0x26, 0x28, 0x7D, 0xDD, 0xA4, 0x63, 0xDE, 0x07, 0x53, 0x3C, 0xC8, 0x66, 0xCF, 0xF1, 0x68, 0x18,
-    0x3B, 0xAE, 0x18, 0xFB, 0x07, 0xAC, 0x1F, 0x77, 0x37, 0x9E, 0x4F, 0x90, 0x4A, 0xDC, 0xED, 0xAD,
-    0xFE, 0xBB, 0xC9, 0x1E, 0x83, 0x9F, 0x14, 0x74, 0xA9, 0x56, 0x91, 0xA3, 0xA7, 0x93, 0x5F, 0x9F,
-    0xA4, 0xCE, 0xB2, 0xAC, 0x13, 0x63, 0xFD, 0x7F, 0xA4, 0xD5, 0x2E, 0xB2, 0x0B, 0x6E, 0x2B, 0xAB,
-    0x5E, 0x99, 0xCB, 0x21, 0x00, 0x48, 0x29, 0xEF, 0x42, 0x1F, 0x80, 0x43, 0x36, 0x97, 0xF7, 0x76,
-    0x81, 0x94, 0xEA, 0x27, 0xAA, 0x37, 0xC6, 0x4C, 0xAB, 0x59, 0x9E, 0xE1, 0xAC, 0xC7, 0x2E, 0xC9,
-    0xB1, 0xD7, 0x69, 0xAE, 0x07, 0x47, 0xC5, 0x50, 0xAD, 0x59, 0x61, 0xB7, 0x0A, 0x4E, 0x17, 0xDE,
-    0xE1, 0xD6, 0x08, 0xFD, 0x23, 0x77, 0x87, 0x2B, 0x2B, 0x5A, 0x70, 0xC3, 0xFB, 0x67, 0x33, 0xA2,
-    0x9B, 0xA0, 0xB6, 0x4E, 0x4B, 0xB1, 0x07, 0x9A, 0x7D, 0x9F, 0xF7, 0x9F, 0x6B, 0xBB, 0x6C, 0x16,
-    0x75, 0xE1, 0xAA, 0xBF, 0x51, 0x30, 0x4B, 0x09, 0x0C, 0xCF, 0xE9, 0xEF, 0x6A, 0xBD, 0xF7, 0xD3,
-    0x1E, 0x7C, 0xFB, 0x58, 0xB9, 0xB7, 0xA2, 0xCD, 0xC2, 0xC6, 0x2A, 0x66, 0x26, 0x76, 0x06, 0xC8,
-    0xC0, 0x4D, 0x07, 0xFF, 0xC8, 0x3D, 0xF9, 0x11, 0x1C, 0xF6, 0x89, 0xD9, 0x80, 0xBD, 0x1E, 0x7A,
-    0xBA, 0x6D, 0xE5, 0xEF, 0x7E, 0xD9, 0xDA, 0x2F, 0xBB, 0xD5, 0xAF, 0x5F, 0x9E, 0xF1, 0x1D, 0x96,
-    0xE1, 0xFB, 0xA9, 0xEE, 0x73, 0x8C, 0xE7, 0x58, 0x8B, 0x5A, 0xC2, 0x61, 0xD9, 0xF4, 0xA3, 0x8E,
-    0xD8, 0x56, 0x00, 0x37, 0x17, 0x98, 0xB2, 0xEA, 0x52, 0x80, 0xA1, 0xDE, 0xDA, 0xBB, 0x6C, 0xB3,
-    0xE1, 0x4D, 0xC5, 0x0D, 0xD6, 0x6A, 0xF4, 0xEC, 0x69, 0xDA, 0x17, 0x26, 0xC2, 0x4C, 0xC0, 0x99,
-    0xA8, 0x76, 0xDC, 0xD2, 0xB1, 0xCD, 0xF7, 0xD8, 0xD3, 0xB0, 0x7E, 0x44, 0x63, 0x4D, 0xEB, 0xB3,
-    0x34, 0xD6, 0x1F, 0x01, 0x10, 0xA3, 0x10, 0xC6, 0x60, 0x3B, 0xD5, 0x37, 0xEA, 0x82, 0x26, 0x2A,
-    0x58, 0x05, 0x25, 0xED, 0xCA, 0x9C, 0x53, 0x7D, 0xD9, 0xC3, 0x88, 0x60, 0xDA, 0x11, 0x19, 0xDF,
-    0xE4, 0xC8, 0x21, 0x53, 0x8B, 0xAD, 0xD2, 0xE4, 0x98, 0xAF, 0xDE, 0x47, 0xF2, 0x0F, 0x35, 0x86,
-    0xC4, 0xA7, 0xED, 0x91, 0xD3, 0x4C, 0x46, 0x37, 0xAE, 0x88, 0xE6, 0xC4, 0x9B, 0x7A, 0x99, 0x6A,
-    0x05, 0x50, 0xAE, 0x23, 0x86, 0x7C, 0xE2, 0x12, 0xB9, 0x8C, 0x03, 0x73, 0xE4, 0x9D, 0x6D, 0x30,
-    0x2F, 0x5B, 0xC6, 0x10, 0xCC, 0x7C, 0x5C, 0x84, 0xF5, 0x9B, 0x34, 0x0F, 0x6F, 0xC3, 0xAE, 0xC3,
-    0x99, 0xBA, 0xC3, 0x8B, 0x6F, 0x7A, 0x5A, 0x0A, 0x5F, 0x85, 0x15, 0xBE, 0xAE, 0xF4, 0xAE, 0x2D,
-    0x6F, 0xF4, 0x32, 0x1D, 0xF2, 0xDB, 0xEC, 0xF2, 0x97, 0x5E, 0xCC, 0x6A, 0xE9, 0xF2, 0x91, 0xC4,
-    0x8B, 0x07, 0x1F, 0x49, 0x84, 0x0C, 0xBE, 0x1F, 0xFB, 0x58, 0xD6, 0xE4, 0x85, 0x80, 0x91, 0xCB,
-    0x15, 0x6E, 0xFF, 0xC1, 0xC0, 0x85, 0x56, 0xF5, 0xB5, 0xE2, 0x0D, 0x8B, 0x10, 0x9F, 0xA0, 0xD7,
-    0x77, 0xCD, 0xF0, 0x61, 0x0D, 0xB6, 0xF4, 0x53, 0x2F, 0xAB, 0x2F, 0x5A, 0xB4, 0x2F, 0xE7, 0x2B,
-    0x8C, 0x3D, 0x52, 0x65, 0x2D, 0xC5, 0x93, 0xEF, 0x9F, 0x33, 0x2C, 0xBF, 0xC1, 0x42, 0x13, 0x34,
-    0x2D, 0xB5, 0xB5, 0xEC, 0x58, 0xA3, 0x7A, 0x51, 0xBF, 0x2C, 0xA9, 0xAE, 0xDC, 0xFA, 0x66, 0xBC,
-    0x53, 0x73, 0xBE, 0xCD, 0xA7, 0x39, 0xC9, 0x18, 0x81, 0xF3, 0xF3, 0x44, 0x4B, 0xDB, 0x24, 0xEF,
-    0x43, 0x68, 0xDF, 0x0D, 0xDE, 0x5D, 0x27, 0x50, 0x97, 0xA4, 0x3E, 0x0F, 0x78, 0x1E, 0xF0, 0x68,
-    0x79, 0x7E, 0xA9, 0xF7, 0x6A, 0x5F, 0xC3, 0xC6, 0xDE, 0xE4, 0xE6, 0x6C, 0x0D, 0x7B, 0x75, 0x7B,
-    0xFE, 0xE6, 0x3B, 0xE4, 0x4B, 0x63, 0xC9, 0x0D, 0x96, 0xEF, 0x0D, 0xDA, 0xF5, 0xC9, 0x32, 0x83,
-    0x7C, 0xBD, 0xF1, 0xF4, 0x93, 0x62, 0x91, 0xD1, 0x84, 0x51, 0x47, 0x6D, 0xE5, 0xA0, 0x0F, 0x95,
-    0x06, 0x4A, 0x5B, 0x56, 0xAF, 0xAF, 0x6F, 0x48, 0x84, 0x7D, 0x02, 0xD5, 0xD5, 0x8A, 0xEA, 0xD4,
-    0xA8, 0xC6, 0x88, 0xAE, 0xEE, 0x59, 0x29, 0xBA, 0x5F, 0xAF, 0xEB, 0xDD, 0x0B, 0xD5, 0xD5, 0x9A,
-    0x6A, 0xDB, 0xC0, 0xA3, 0x3C, 0x47, 0x9B, 0x2F, 0x90, 0xB8, 0xB6, 0xE9, 0xA6, 0x22, 0x71, 0xC4,
-    0x08, 0x84, 0x06, 0x7F, 0x5E, 0xED, 0x5E, 0xE5, 0x5F, 0x4D, 0x4B, 0x58, 0x9C, 0x76, 0x9B, 0xD0,
-    0xE2, 0xA8, 0x39, 0xB0, 0xAE, 0x87, 0xD9, 0xF6, 0x53, 0xCD, 0xB2, 0x5C, 0x5F, 0xFB, 0xC3, 0xC5,
-    0xB0, 0xFF, 0x07, 0x04, 0xC2, 0x01, 0x4E, 0x37, 0xEB, 0x5D, 0xB3, 0x24, 0x2F, 0x33, 0xEB, 0xF4,
-    0x07, 0x31, 0xF6, 0x51, 0x2F, 0x41, 0xB7, 0x5A, 0x74, 0x7A, 0x07, 0xD6, 0xFE, 0xA3, 0xC5, 0xD4,
-    0x6C, 0xED, 0xED, 0x3D, 0xFA, 0x95, 0x8A, 0x3D, 0x2E, 0x96, 0xAF, 0x54, 0x6C, 0x08, 0xBD, 0x97,
-    0x55, 0xAF, 0x36, 0xD8, 0x1E, 0x7B, 0xFD, 0xEF, 0xA8, 0xBE, 0x86, 0x68, 0x6B, 0x56, 0xB5, 0x9C,
-    0x77, 0xE1, 0xB5, 0xAB, 0x72, 0x62, 0xB1, 0x72, 0x2C, 0xE1, 0x8E, 0x3F, 0xD7, 0x73, 0x93, 0xDE,
-    0x98, 0xD3, 0xDF, 0x6A, 0x36, 0x02, 0xCD, 0xF2, 0xD3, 0xDE, 0xF5, 0x60, 0x3C, 0x28, 0x41, 0x24,
-    0x9D, 0x68, 0x53, 0x0E, 0x29, 0x00, 0xDA, 0xB7, 0x68, 0x8C, 0xB4, 0x11, 0xAE, 0x63, 0xBE, 0xB0,
-    0x39, 0xB3, 0x86, 0x41, 0x37, 0x9A, 0x6C, 0xDC, 0x28, 0x3D, 0xB3, 0x65, 0xA8, 0x1B, 0x91, 0x59,
-    0x54, 0x09, 0x11, 0x34, 0x18, 0xF0, 0x78, 0x0D, 0xA8, 0xFF, 0x4D, 0x2D, 0x4A, 0x5F, 0x22, 0x2C,
-    0x61, 0xF2, 0xE0, 0x53, 0x9D, 0x5D, 0x93, 0xEB, 0x29, 0x2F, 0xC7, 0xE4, 0x21, 0x37, 0xCA, 0x5C,
-    0x3E, 0x5B, 0xBB, 0xD1, 0xC3, 0xA9, 0xF1, 0x11, 0x41, 0x5E, 0xDC, 0x28, 0x83, 0x11, 0xBA, 0xD1,
-    0x3F, 0x20, 0xE1, 0x98, 0x92, 0x11, 0x80, 0x0F, 0xD5, 0x0E, 0x8F, 0x8A, 0x66, 0x73, 0xA3, 0x25,
-    0x00, 0x22, 0x6C, 0x70, 0x2D, 0xEC, 0xB5, 0x7F, 0xC8, 0x8D, 0x1E, 0x21, 0x64, 0xB3, 0x4E, 0xB6,
-    0x3F, 0x66, 0x9B, 0x5F, 0xB4, 0x8F, 0x81, 0x6D, 0x40, 0x8E, 0x8F, 0x24, 0xA0, 0x66, 0xF5, 0xF3,
-    0xC1, 0xD1, 0xE5, 0xC2, 0x81, 0x96, 0x1D, 0x84, 0x1F, 0xF9, 0x15, 0x8B, 0xE1, 0xF1, 0x1C, 0xB0,
-    0xD4, 0x1E, 0xB2, 0xE4, 0x65, 0x09, 0xE3, 0x05, 0xAC, 0x58, 0x7D, 0x93, 0xC9, 0x2E, 0x6B, 0xCC,
-    0x6E, 0x9F, 0xC1, 0x1C, 0x19, 0x9B, 0x52, 0xC0, 0x13, 0xAE, 0x2D, 0x3F, 0x81, 0x58, 0x0C, 0xA2,
-    0xB9, 0xFB, 0x78, 0x5E, 0x27, 0x9C, 0xA5, 0x5F, 0xE5, 0xAC, 0x8E, 0x7D, 0x9D, 0x99, 0xCC, 0x71,
-    0x95, 0x93, 0x7D, 0xCD, 0x67, 0x4C, 0xC8, 0x04, 0x5F, 0x67, 0x32, 0xDE, 0x23, 0xF7, 0xD4, 0xB6,
-    0xB6, 0x4F, 0x4A, 0x3F, 0x43, 0x5A, 0x37, 0x84, 0xE6, 0x3D, 0xBC, 0x7D, 0x29, 0xF5, 0xB0, 0xF7,
-    0xE8, 0xD0, 0x98, 0x57, 0x8E, 0xE5, 0x26, 0xFC, 0xBF, 0xE7, 0xA8, 0x97, 0xE8, 0xEC, 0xEA, 0x8F,
-    0xA1, 0x25, 0x53, 0x0E, 0x0F, 0xDF, 0x1E, 0xFF, 0x7A, 0xA0, 0x1B, 0x06, 0x5D, 0x0B, 0xC7, 0xC5,
-    0xAC, 0x2E, 0x25, 0x07, 0xA5, 0xA2, 0x6C, 0x1F, 0x2E, 0xA1, 0x3D, 0x01, 0x2C, 0xFC, 0x5F, 0xD5,
-    0x5B, 0xBF, 0x8F, 0xDD, 0x46, 0x92, 0x6E, 0x92, 0x98, 0xE1, 0x41, 0x0C, 0xE8, 0xC0, 0x73, 0x80,
-    0x25, 0x60, 0x99, 0xDE, 0xD9, 0x01, 0xFF, 0x82, 0x33, 0x69, 0x1B, 0x38, 0x07, 0x0A, 0x34, 0x81,
-    0xDE, 0x1E, 0x16, 0x0E, 0x7C, 0xC1, 0x1A, 0x58, 0x2B, 0x99, 0xFF, 0xC0, 0xA4, 0x57, 0x81, 0x03,
-    0x07, 0x1E, 0xE0, 0xEC, 0x4B, 0x2E, 0xB0, 0x16, 0xD0, 0x02, 0xD2, 0x08, 0x0B, 0x25, 0x17, 0x2C,
-    0x16, 0x5E, 0xF5, 0xF3, 0x0A, 0x07, 0x05, 0x0A, 0x44, 0xEF, 0x9E, 0xCF, 0x81, 0x02, 0xD3, 0x96,
-    0x16, 0xDA, 0xB3, 0x02, 0xD1, 0x7B, 0x94, 0xCD, 0x91, 0x48, 0xD6, 0x7D, 0x5F, 0x35, 0xDF, 0x9B,
-    0x19, 0xCB, 0x92, 0x25, 0x5B, 0x63, 0xCD, 0x3E, 0xBC, 0xC7, 0xD7, 0xFC, 0xD1, 0xDD, 0xD5, 0xD5,
-    0xD5, 0x55, 0x5F, 0x55, 0x17, 0xCD, 0xCA, 0x6C, 0x96, 0x1B, 0x13, 0x8B, 0xCC, 0xF7, 0x1E, 0xF7,
-    0x7C, 0x6C, 0xC7, 0xA3, 0xF4, 0x38, 0x78, 0x32, 0xE0, 0x18, 0x88, 0xF0, 0x38, 0xF2, 0x18, 0xF5,
-    0x52, 0xA2, 0x56, 0xAF, 0x75, 0x3B, 0x8B, 0x63, 0xDA, 0x66, 0xB5, 0x31, 0x59, 0x93, 0x35, 0xC6,
-    0x14, 0x75, 0xDA, 0xA2, 0x81, 0x2A, 0x41, 0x13, 0x32, 0x8F, 0x7B, 0x34, 0x50, 0x46, 0x83, 0xF1,
-    0x45, 0x64, 0x64, 0x33, 0x68, 0x28, 0xE4, 0x31, 0x8F, 0x78, 0x9C, 0xC7, 0xE3, 0xEC, 0xA7, 0x32,
-    0x4F, 0xD0, 0x93, 0x54, 0x19, 0xAA, 0xD8, 0x26, 0x43, 0xF5, 0xA2, 0x29, 0xD0, 0x54, 0xD6, 0x09,
-    0x9A, 0x4D, 0x7B, 0x6F, 0x36, 0x3B, 0x6E, 0x2C, 0xAA, 0xA7, 0x22, 0x25, 0x2A, 0x57, 0x4A, 0xA3,
-    0xF7, 0xB3, 0xDC, 0x24, 0x68, 0x0D, 0x17, 0x1B, 0xB6, 0x6B, 0x7E, 0xFF, 0x22, 0xEF, 0xB0, 0xF7,
-    0x70, 0x34, 0xE6, 0xA7, 0x52, 0x6E, 0x88, 0xD4, 0x56, 0xA4, 0x13, 0x39, 0x3F, 0x16, 0xAD, 0x27,
-    0xE7, 0x3B, 0x53, 0xDC, 0x1C, 0x4C, 0x7A, 0x47, 0xCA, 0x64, 0x2C, 0xB6, 0x37, 0xE4, 0x1D, 0x54,
-    0xFB, 0x4C, 0xE4, 0x52, 0x97, 0x48, 0x39, 0x9A, 0xA7, 0xD9, 0xEA, 0x61, 0xE3, 0x9D, 0x32, 0x26,
-    0x29, 0x43, 0xF4, 0x1F, 0xDF, 0xB1, 0xE8, 0x3F, 0x54, 0xF6, 0x78, 0xCA, 0x00, 0x73, 0xE4, 0xBA,
-    0x39, 0xD0, 0xAC, 0xF2, 0x4F, 0x99, 0x7F, 0x34, 0xBD, 0x49, 0x4B, 0x0C, 0x72, 0x1E, 0x90, 0x55,
-    0x19, 0x7E, 0xDE, 0x85, 0xDC, 0x11, 0xBB, 0xF6, 0x2E, 0x07, 0xD2, 0xB0, 0x07, 0xDC, 0x90, 0x26,
-    0xFA, 0xEF, 0x14, 0x24, 0xFB, 0x92, 0x93, 0x18, 0xB3, 0xB2, 0xD1, 0xAD, 0xA2, 0x6B, 0xF6, 0xF6,
-    0x8E, 0xDC, 0x91, 0x1B, 0x92, 0x27, 0x60, 0x55, 0x38, 0xDA, 0xCA, 0x07, 0xEF, 0x3C, 0x5C, 0xF8,
-    0x77, 0x32, 0x53, 0xC6, 0x44, 0xFA, 0xE2, 0x4D, 0xE9, 0xE2, 0xDA, 0xCB, 0x0F, 0x1E, 0x0B, 0x48,
-    0x4B, 0xAC, 0x22, 0x92, 0x29, 0x75, 0x85, 0x8E, 0x7C, 0xD4, 0xA3, 0x1C, 0xDF, 0xA1, 0x37, 0xD3,
-    0xE3, 0xEA, 0x69, 0xB3, 0xF2, 0x1A, 0x1E, 0x02, 0xF5, 0x96, 0x1D, 0x88, 0xF4, 0xFE, 0xED, 0x88,
-    0x0C, 0xB1, 0x68, 0x03, 0x64, 0x79, 0xAF, 0x8C, 0x1E, 0xEE, 0xFC, 0x12, 0xDD, 0x5F, 0x93, 0xD1,
-    0x6E, 0x4B, 0x05, 0x86, 0xD4, 0x10, 0xA6, 0xD6, 0xD8, 0x9B, 0xA3, 0x29, 0xB6, 0xE5, 0xCF, 0x76,
-    0x04, 0x2F, 0xE5, 0x2D, 0x91, 0xA4, 0x2E, 0xC6, 0xA0, 0x33, 0xEB, 0x3E, 0x9A, 0xE6, 0xCF, 0x90,
-    0x18, 0x8B, 0x5F, 0xFA, 0x31, 0xE5, 0x08, 0x63, 0x97, 0x46, 0xBB, 0x34, 0xE6, 0xC4, 0x29, 0x92,
-    0x53, 0x91, 0x57, 0x5C, 0x8E, 0x7C, 0x30, 0xAD, 0x97, 0x34, 0x2F, 0x3E, 0xE8, 0x79, 0x93, 0xEB,
-    0xB3, 0x07, 0x81, 0xD2, 0x63, 0xEA, 0xA4, 0x0B, 0xA4, 0x5D, 0x6D, 0x48, 0xE0, 0x53, 0x31, 0xC7,
-    0xA4, 0xE3, 0xD5, 0xA1, 0x90, 0x13, 0x86, 0x3C, 0xBD, 0xE7, 0xD0, 0x2E, 0x1E, 0xD1, 0x87, 0x13,
-    0xCE, 0x50, 0xAC, 0x53, 0x23, 0xB5, 0xF7, 0x9F, 0x64, 0x72, 0x6B, 0xF4, 0x90, 0xF2, 0xB0, 0xAA,
-    0xEB, 0x6B, 0x65, 0x1D, 0xF7, 0x0F, 0x9D, 0x71, 0xF5, 0xB0, 0x0A, 0x28, 0x22, 0x21, 0x6A, 0xC7,
-    0xF5, 0x44, 0xD8, 0xEB, 0xC6, 0x6C, 0x48, 0x87, 0x79, 0xEA, 0x31, 0x33, 0x5D, 0x2C, 0x5B, 0x0D,
-    0x1A, 0x7F, 0x8A, 0x5D, 0xE9, 0xB4, 0xEA, 0xD4, 0x4E, 0xBF, 0xC6, 0x5D, 0xE3, 0x3D, 0x48, 0xDB,
-    0x3F, 0xC4, 0x72, 0x8B, 0x75, 0x7A, 0xD6, 0x45, 0x97, 0x78, 0x82, 0x93, 0xF2, 0xAC, 0xF2, 0x83,
-    0x7C, 0xA3, 0x04, 0x45, 0x03, 0xFA, 0x4B, 0xEA, 0x0C, 0xE2, 0x9B, 0x47, 0xCD, 0x41, 0x61, 0x08,
-    0xF9, 0x91, 0x0A, 0x85, 0xA5, 0xF4, 0xA4, 0xA8, 0x83, 0x3E, 0xEA, 0xA2, 0xDA, 0xEB, 0xF7, 0x87,
-    0x21, 0x2B, 0x2A, 0xA3, 0x64, 0x37, 0x9F, 0x77, 0x07, 0x3D, 0x5D, 0x3D, 0x40, 0x12, 0xB2, 0xCE,
-    0xF5, 0x8D, 0x67, 0x07, 0xF7, 0x63, 0xD9, 0xDB, 0xDC, 0x1F, 0x09, 0x79, 0xD6, 0x78, 0xA7, 0xB1,
-    0x44, 0xE2, 0x16, 0x5A, 0xA4, 0xA8, 0xA8, 0x1B, 0xC0, 0x07, 0xE1, 0x00, 0x8B, 0xEE, 0xA0, 0x30,
-    0xE4, 0xD0, 0xA6, 0x39, 0xE1, 0x8D, 0xC6, 0x96, 0x69, 0x23, 0x25, 0xA8, 0x2F, 0xA1, 0x64, 0xE7,
-    0x20, 0x75, 0x32, 0xAF, 0x2B, 0xA7, 0x95, 0x25, 0x54, 0x34, 0xFC, 0x95, 0xD9, 0x78, 0x6E, 0x4E,
-    0x9E, 0x90, 0x75, 0x81, 0x50, 0x79, 0xCE, 0x1D, 0x43, 0xA8, 0x0D, 0x43, 0x76, 0xC7, 0x0B, 0xA4,
-    0x05, 0xC4, 0x1F, 0xC2, 0x60, 0x65, 0x9E, 0x3A, 0xED, 0xDD, 0xE3, 0x0A, 0x9E, 0x59, 0xC9, 0x8D,
-    0x77, 0x86, 0xBD, 0x66, 0x55, 0xD2, 0x40, 0xDF, 0xA6, 0x64, 0x22, 0x55, 0x4C, 0x28, 0xED, 0x52,
-    0xCF, 0x2D, 0x3E, 0x99, 0xDC, 0xC9, 0xC9, 0x18, 0xC9, 0x49, 0x7F, 0x67, 0x54, 0xA1, 0x66, 0xB7,
-    0x5F, 0xC1, 0xDC, 0xF4, 0x30, 0xA4, 0x24, 0x40, 0x6A, 0x74, 0x98, 0xF6, 0x60, 0x41, 0x20, 0xC7,
-    0xA8, 0x64, 0xFF, 0x24, 0xAA, 0x57, 0xE7, 0x26, 0x1E, 0xF5, 0xE2, 0x3B, 0xBC, 0x78, 0x8D, 0x17,
-    0x5B, 0x5E, 0xE4, 0x93, 0x91, 0xA0, 0x7A, 0x28, 0x27, 0xA9, 0xA8, 0xE7, 0x32, 0x7F, 0x15, 0x8A,
-    0x19, 0x0D, 0xD7, 0xEC, 0xA8, 0x66, 0x47, 0x25, 0x3A, 0xDA, 0x76, 0xC6, 0x27, 0x27, 0xF2, 0x48,
-    0x3A, 0x4A, 0x71, 0x38, 0xC6, 0x0D, 0x07, 0xFC, 0x16, 0x49, 0x2C, 0x3E, 0x57, 0x26, 0x77, 0xE4,
-    0x32, 0x4D, 0xB7, 0x79, 0xE6, 0x05, 0xDA, 0x0C, 0x18, 0x19, 0x3C, 0x29, 0xF2, 0x29, 0x6D, 0x03,
-    0xED, 0x81, 0x29, 0xC6, 0xF3, 0xE4, 0x29, 0x66, 0xB5, 0xA6, 0xBC, 0xA5, 0x1D, 0xB9, 0x84, 0x1A,
-    0x64, 0x1C, 0x6E, 0xE0, 0x71, 0xB4, 0x0D, 0xE6, 0xC5, 0x7A, 0x23, 0xD0, 0x1B, 0x1E, 0x6B, 0xB4,
-    0xD4, 0x61, 0x98, 0x40, 0x88, 0x8A, 0x07, 0x36, 0x8E, 0xE4, 0x06, 0x49, 0x03, 0x81, 0xA4, 0x26,
-    0x1D, 0xC3, 0xCE, 0x49, 0xB3, 0xDA, 0xAE, 0xD3, 0x8A, 0x89, 0xC6, 0x7C, 0x7A, 0x88, 0x8C, 0x2A,
-    0x03, 0x99, 0x59, 0x29, 0x95, 0x53, 0x14, 0x91, 0x64, 0x34, 0xCA, 0xAA, 0x40, 0x79, 0x41, 0xF5,
-    0x2D, 0x9F, 0x40, 0x14, 0x02, 0x79, 0x1F, 0xB2, 0x10, 0x8F, 0x10, 0xBD, 0x3C, 0xDB, 0x16, 0xA8,
-    0x32, 0xF9, 0xAC, 0xB8, 0xBD, 0x0E, 0x1D, 0xAF, 0xEC, 0xE2, 0xD3, 0xB6, 0x51, 0x7E, 0x95, 0x68,
-    0xA4, 0xE8, 0x8D, 0x32, 0x2C, 0xD0, 0xD1, 0x29, 0xC7, 0xD8, 0xA5, 0x0E, 0x77, 0xC1, 0x32, 0xE3,
-    0xA4, 0x41, 0xF9, 0xB2, 0x7A, 0x4E, 0xFE, 0xA2, 0xA6, 0xD1, 0xA8, 0xAD, 0x32, 0x87, 0xCF, 0xC9,
-    0x29, 0x32, 0xB1, 0x84, 0xEC, 0x71, 0xEC, 0x82, 0x27, 0x0B, 0xF9, 0x7A, 0x74, 0x74, 0xA7, 0x72,
-    0x8E, 0xD3, 0x80, 0x31, 0x07, 0xB0, 0xA9, 0xA3, 0x63, 0x05, 0x96, 0x5A, 0x56, 0xC3, 0x7E, 0xC6,
-    0x9D, 0x32, 0xC8, 0x83, 0xE0, 0x82, 0x14, 0x88, 0x24, 0x9E, 0xCC, 0x33, 0xAC, 0x56, 0x32, 0x27,
-    0x73, 0x03, 0x1E, 0xC1, 0x9A, 0x74, 0x88, 0x3A, 0xC7, 0x98, 0xB5, 0xD9, 0xEC, 0x45, 0xD0, 0x06,
-    0x01, 0x7C, 0x53, 0x54, 0xBA, 0xD4, 0x9E, 0x8A, 0xDC, 0x02, 0xED, 0x8B, 0xBF, 0x8F, 0x67, 0x2A,
-    0x35, 0x73, 0xB5, 0x67, 0xFC, 0x1B, 0x66, 0xC7, 0x71, 0xEF, 0x0A, 0x04, 0x96, 0x7F, 0xE3, 0xD6,
-    0x99, 0x5D, 0xF7, 0x76, 0xFD, 0xED, 0x69, 0x45, 0xD1, 0x1E, 0x91, 0x9E, 0x4F, 0x56, 0x24, 0xBA,
-    0xCE, 0x15, 0x99, 0xAD, 0x53, 0xF3, 0xD6, 0xBC, 0x35, 0x27, 0x1A, 0x80, 0xB4, 0x66, 0x2D, 0x44,
-    0x40, 0x2E, 0x42, 0x06, 0x28, 0x89, 0x05, 0x66, 0x40, 0x06, 0xB0, 0x5E, 0x5C, 0xA1, 0x71, 0xAB,
-    0x4A, 0x17, 0x90, 0x8F, 0xAE, 0x9E, 0x8A, 0xE5, 0x3D, 0x9B, 0xE3, 0x7E, 0x4B, 0xAD, 0x90, 0xFB,
-    0xBA, 0x6A, 0xD7, 0xA8, 0x59, 0xFC, 0x7F, 0x6B, 0xCC, 0xEF, 0x89, 0x98, 0x74, 0x0A, 0x07, 0xB3,
-    0xBA, 0x6D, 0xF6, 0x71, 0x80, 0x8A, 0xD1, 0x32, 0x13, 0xD5, 0x40, 0x55, 0x3D, 0xA7, 0x3D, 0x57,
-    0x90, 0x66, 0x36, 0x26, 0xCD, 0xB9, 0x7F, 0x23, 0xA5, 0x51, 0x09, 0x06, 0x35, 0xE8, 0x11, 0xED,
-    0x58, 0x35, 0xC9, 0xFC, 0x7E, 0x8D, 0xD4, 0x35, 0xCF, 0x6E, 0x22, 0x2E, 0x6B, 0x45, 0xD3, 0xC3,
-    0xC2, 0xB6, 0xED, 0xEB, 0x48, 0xF7, 0x67, 0x34, 0x00, 0x67, 0x40, 0x96, 0xB4, 0xF8, 0x19, 0x74,
-    0xC7, 0xB0, 0x0E, 0xC5, 0x41, 0xA5, 0x69, 0xBC, 0xB3, 0xC6, 0xFB, 0x35, 0xB5, 0xEE, 0x68, 0x54,
-    0x39, 0x63, 0x75, 0x36, 0xF1, 0x18, 0xC8, 0x8B, 0xD4, 0x18, 0x18, 0x85, 0xE5, 0x70, 0x76, 0x8D,
-    0x42, 0x0B, 0x93, 0xAD, 0x51, 0xFC, 0x07, 0x2B, 0xE0, 0x19, 0xD9, 0x7E, 0xA5, 0x25, 0xD8, 0xCD,
-    0x13, 0x67, 0x59, 0xD0, 0xF6, 0x4A, 0x01, 0x3D, 0x18, 0xD5, 0x13, 0x92, 0x4C, 0x61, 0x0D, 0x7C,
-    0x55, 0x95, 0x6A, 0x1B, 0x50, 0xD9, 0x1F, 0xCD, 0xEB, 0xC6, 0xFF, 0x15, 0xCC, 0xC9, 0x9B, 0x72,
-    0x0C, 0x08, 0x5D, 0xE6, 0x3E, 0xBA, 0xF7, 0x27, 0x0F, 0xC9, 0xCD, 0xEA, 0x35, 0x85, 0xF3, 0x42,
-    0x8C, 0xDA, 0x81, 0x11, 0x2F, 0x89, 0x83, 0x9B, 0xEC, 0x5B, 0x8D, 0xD3, 0x6C, 0x46, 0x6B, 0x49,
-    0x6F, 0x00, 0x0F, 0x5E, 0x94, 0xAD, 0xAD, 0x3D, 0x77, 0x77, 0x3D, 0xBC, 0xB7, 0xA9, 0xD5, 0x4D,
-    0x2C, 0x1C, 0xB5, 0x3B, 0x72, 0x94, 0x0A, 0x4D, 0x48, 0x16, 0x08, 0xB4, 0xED, 0xBE, 0x4B, 0xB1,
-    0x39, 0x7C, 0x5A, 0xED, 0xB1, 0xFA, 0xB1, 0xB4, 0x8E, 0xDB, 0xA8, 0x16, 0x75, 0x20, 0x25, 0x6C,
-    0xCD, 0x85, 0x3D, 0xDE, 0xD9, 0x86, 0x5C, 0x57, 0x8D, 0x49, 0x5F, 0xC8, 0xB9, 0x89, 0xD0, 0x86,
-    0xDB, 0xDE, 0x07, 0x3E, 0xB9, 0xA7, 0x2C, 0x74, 0xC8, 0x4A, 0xCD, 0x7C, 0xEC, 0x7C, 0x97, 0x7C,
-    0x6D, 0xB6, 0x4E, 0x4F, 0x60, 0xC8, 0x58, 0x01, 0x82, 0x23, 0xB0, 0x83, 0x79, 0x26, 0x2D, 0x06,
-    0x13, 0x0E, 0x9C, 0x2A, 0x79, 0x19, 0x7D, 0x17, 0x15, 0xAA, 0x27, 0x6D, 0x02, 0xDF, 0x64, 0xF0,
-    0xD5, 0x47, 0xA1, 0xDE, 0xAC, 0x7C, 0xC5, 0x05, 0x18, 0xF0, 0xF5, 0x09, 0x23, 0xF9, 0x67, 0x27,
-    0x64, 0xCB, 0x45, 0x0E, 0x60, 0x8B, 0x49, 0x03, 0x92, 0x2E, 0xF2, 0x68, 0x82, 0xD2, 0xAF, 0xF1,
-    0xF6, 0x90, 0xD5, 0x19, 0x34, 0x77, 0xAC, 0x0E, 0xE9, 0x36, 0x1C, 0x8A, 0x9E, 0x76, 0x36, 0x8F,
-    0x46, 0x50, 0x57, 0xDC, 0xA0, 0xAA, 0xA6, 0x82, 0xBF, 0x31, 0xB2, 0x00, 0x15, 0xAE, 0x57, 0x68,
-    0xD5, 0xAE, 0xC1, 0x1B, 0x82, 0x3B, 0x76, 0x1E, 0x96, 0x1B, 0xF3, 0x02, 0x72, 0x8B, 0x3A, 0x92,
-    0xB7, 0x46, 0x20, 0x03, 0xDA, 0x4E, 0x5D, 0x75, 0xF2, 0xD1, 0x75, 0x58, 0x1A, 0xC8, 0x14, 0x15,
-    0xB7, 0x34, 0x09, 0xB5, 0xEA, 0x73, 0x30, 0x24, 0xE6, 0x50, 0x69, 0xCE, 0x18, 0xBF, 0xA5, 0x83,
-    0x54, 0x7C, 0x81, 0x01, 0x45, 0xEA, 0xE8, 0x5A, 0x9A, 0x5E, 0xFF, 0x77, 0xE6, 0x80, 0xB1, 0x11,
-    0x4A, 0xF3, 0x59, 0x93, 0xE6, 0x61, 0xE3, 0xC9, 0xB9, 0xC1, 0x91, 0xAA, 0xC8, 0xF0, 0xB9, 0x53,
-    0xE6, 0x09, 0xB3, 0xD1, 0xA8, 0x13, 0x1C, 0x8C, 0x66, 0x02, 0x70, 0x8E, 0x13, 0xB1, 0x62, 0xAF,
-    0x9F, 0x1F, 0x34, 0x36, 0x3A, 0x8D, 0x0C, 0xBF, 0xCA, 0xE1, 0x4B, 0x5D, 0x73, 0xE3, 0x6E, 0xA7,
-    0xE2, 0xC9, 0xB1, 0x51, 0x3F, 0x47, 0x08, 0x7C, 0xA8, 0x3E, 0xA9, 0x6E, 0x7A, 0x07, 0xFB, 0x80,
-    0xC4, 0x36, 0x8C, 0x55, 0xD0, 0xAE, 0xCA, 0xAF, 0x57, 0x1C, 0x6E, 0x26, 0xD5, 0x09, 0x27, 0x7A,
-    0x65, 0x76, 0x7C, 0x37, 0x73, 0x0C, 0x99, 0x53, 0x91, 0x63, 0x44, 0x7B, 0x47, 0x69, 0xE8, 0x3E,
-    0xC2, 0xD2, 0x4B, 0x5A, 0x54, 0x0F, 0x87, 0x90, 0x4C, 0xC9, 0x2D, 0x99, 0x13, 0x2B, 0x73, 0x2C,
-    0x61, 0x9A, 0xAF, 0x88, 0xCB, 0x3B, 0xBE, 0x83, 0x96, 0x75, 0x12, 0xA9, 0xCB, 0x02, 0x8D, 0x6B,
-    0x0C, 0x66, 0x72, 0xE5, 0x9D, 0x06, 0x32, 0x87, 0x79, 0xA7, 0x99, 0xAE, 0xC5, 0x4E, 0x15, 0x3B,
-    0xC6, 0xEE, 0xB0, 0xB1, 0x7F, 0x02, 0x6C, 0xF4, 0xB7, 0x94, 0x3B, 0x73, 0x6A, 0x63, 0xBA, 0x56,
-    0x9F, 0x92, 0x07, 0xB0, 0xF9, 0x41, 0x37, 0x05, 0x42, 0x26, 0xBB, 0x30, 0x07, 0x2B, 0x70, 0x88,
-    0xC6, 0x87, 0x39, 0x7C, 0x3C, 0x7B, 0x95, 0x46, 0x50, 0x76, 0x1F, 0xBE, 0xD8, 0x3A, 0x3F, 0x3E,
-    0x74, 0x03, 0xCB, 0x83, 0x39, 0xB1, 0xB9, 0x50, 0xDD, 0x81, 0x06, 0x8C, 0xE4, 0x3C, 0x7D, 0x96,
-    0xAA, 0x00, 0x3D, 0xCD, 0x14, 0xA4, 0x31, 0x8B, 0x89, 0x60, 0x04, 0x06, 0x1A, 0xF3, 0x41, 0xC5,
-    0x67, 0xA0, 0xB6, 0x86, 0x0C, 0x2A, 0xCB, 0x7E, 0x0A, 0x0B, 0x13, 0xA9, 0x63, 0x63, 0xE5, 0x3F,
-    0x68, 0x71, 0x4A, 0x08, 0x8A, 0x85, 0x1C, 0x55, 0x90, 0x15, 0xAC, 0x25, 0x80, 0x0F, 0x5B, 0x81,
-    0x00, 0xD4, 0x44, 0x0B, 0x28, 0x0E, 0x0F, 0x5F, 0xA4, 0x59, 0x4A, 0x5A, 0xCA, 0x84, 0x4F, 0x60,
-    0x8C, 0x05, 0xDA, 0x1D, 0xB2, 0x77, 0xB6, 0xCE, 0xC9, 0xFF, 0x8A, 0x7E, 0x6E, 0xE9, 0x71, 0x3C,
-    0x07, 0xE3, 0x69, 0xC7, 0xCD, 0xDD, 0x8F, 0x99, 0x8C, 0x8F, 0x95, 0x1A, 0xC9, 0xEA, 0x14, 0x58,
-    0xDF, 0x73, 0xE2, 0x1E, 0xDB, 0x53, 0xE7, 0x51, 0x4E, 0x94, 0x55, 0xEA, 0x35, 0xE9, 0xE1, 0xBC,
-    0x6C, 0xE5, 0x66, 0xE1, 0xB6, 0x94, 0xE6, 0x1C, 0x4F, 0xA7, 0xBB, 0xF0, 0x9F, 0xA1, 0x30, 0xA4,
-    0xC4, 0xC4, 0x4B, 0x43, 0xA0, 0x01, 0x1F, 0x60, 0xDB, 0xF6, 0x70, 0xDB, 0x12, 0xAC, 0x0A, 0xF0,
-    0x08, 0x87, 0x68, 0x08, 0xC7, 0x47, 0x3D, 0x68, 0xC0, 0xAD, 0x0B, 0x2B, 0x19, 0x2D, 0x3D, 0xFD,
-    0x0C, 0xD2, 0xD7, 0x7A, 0xCB, 0x38, 0xA9, 0xEF, 0x9C, 0xC1, 0x39, 0x86, 0x0B, 0xFD, 0x57, 0x9B,
-    0xFB, 0xA1, 0x8B, 0x87, 0x39, 0xA5, 0x07, 0x36, 0x35, 0x25, 0x2A, 0x3D, 0x50, 0x7B, 0x59, 0x22,
-    0x37, 0x81, 0x4B, 0xFA, 0x37, 0x8E, 0xC8, 0xCB, 0xF3, 0x68, 0x73, 0x19, 0x96, 0xAD, 0x75, 0xA1,
-    0x7C, 0xCF, 0x3F, 0x38, 0x3B, 0xE8, 0xC4, 0x7D, 0x5D, 0x7B, 0xA9, 0xA2, 0x1E, 0x7C, 0x8F, 0xD0,
-    0x75, 0x9E, 0x3F, 0xD2, 0x17, 0xBE, 0xFA, 0xB2, 0xB5, 0xD9, 0x0C, 0x7E, 0xE4, 0x88, 0x6F, 0xA1,
-    0x91, 0x52, 0x65, 0x50, 0xF9, 0x3D, 0xBE, 0xBF, 0x30, 0x87, 0xDE, 0xAA, 0xBD, 0x3E, 0xFB, 0x82,
-    0x91, 0xC9, 0x26, 0x02, 0x37, 0x0E, 0x2D, 0x9D, 0x96, 0x54, 0x95, 0x46, 0x83, 0xDE, 0x3C, 0x5A,
-    0xF3, 0x6F, 0x87, 0xB6, 0xDF, 0xF9, 0x17, 0xD1, 0x38, 0x69, 0x2B, 0xFC, 0x73, 0x4E, 0xD2, 0x85,
-    0x6F, 0x75, 0x92, 0x7E, 0x20, 0xB3, 0xAD, 0xDC, 0xD5, 0xF5, 0x73, 0x95, 0x1D, 0xB2, 0x67, 0xCC,
-    0x38, 0x4D, 0xE4, 0x77, 0x14, 0x53, 0x85, 0xA3, 0xFA, 0x21, 0x2A, 0x1F, 0xA8, 0x40, 0x00, 0xCB,
-    0xE5, 0xB8, 0xCF, 0xC0, 0x43, 0xE9, 0x9D, 0xF5, 0xF2, 0xE2, 0x8F, 0xF2, 0xF6, 0x98, 0xB4, 0xEA,
-    0x6E, 0xA4, 0x9D, 0xFD, 0x1C, 0x67, 0xF7, 0xFB, 0xAB, 0x2F, 0x44, 0x75, 0xE6, 0xF7, 0xD1, 0xED,
-    0x57, 0x25, 0xEB, 0x0F, 0x6F, 0x9A, 0xA7, 0x00, 0x28, 0x97, 0x5D, 0x2E, 0x62, 0x5A, 0x8F, 0x81,
-    0xD2, 0x68, 0xB4, 0x37, 0xEF, 0xF3, 0xAD, 0x2D, 0xC3, 0x65, 0x05, 0x83, 0x43, 0x50, 0x66, 0xF3,
-    0xF4, 0xB6, 0x65, 0x2C, 0x1C, 0xED, 0xF8, 0x1A, 0x3E, 0xB0, 0x15, 0x1A, 0x4B, 0x19, 0x6B, 0xF8,
-    0xC1, 0x17, 0x81, 0x9C, 0x76, 0x77, 0xF4, 0x35, 0x25, 0x68, 0xD8, 0x31, 0xA8, 0x30, 0x1E, 0x33,
-    0xD1, 0x50, 0x52, 0x4B, 0x5D, 0xDD, 0xF1, 0x06, 0xE1, 0x0C, 0x40, 0x04, 0x58, 0xB9, 0x5E, 0x54,
-    0xC1, 0x60, 0xEB, 0x50, 0x2C, 0xAC, 0x12, 0xCA, 0xE3, 0xCA, 0x2E, 0x9C, 0x83, 0xEB, 0xE3, 0xE3,
-    0xF8, 0x39, 0x6D, 0xC6, 0x1F, 0xE5, 0x24, 0x21, 0xE2, 0xEB, 0xA7, 0x1F, 0x50, 0x3E, 0xC8, 0xD4,
-    0xD8, 0x34, 0x45, 0x88, 0x8E, 0x41, 0x51, 0x85, 0x5D, 0xDC, 0xC6, 0x95, 0xDF, 0x2F, 0x45, 0x92,
-    0x72, 0xBC, 0xDF, 0x3F, 0xE8, 0xE0, 0x35, 0xB8, 0x3B, 0x05, 0x48, 0x2A, 0x00, 0x30, 0x0A, 0xC2,
-    0x30, 0xF2, 0x09, 0x36, 0x0E, 0x1E, 0x1A, 0xED, 0x1B, 0xAC, 0x5B, 0x56, 0xD9, 0xCB, 0xB5, 0x37,
-    0x2C, 0x19, 0x54, 0xA9, 0xC6, 0xFC, 0xE1, 0x7F, 0xE0, 0x89, 0xEE, 0x57, 0x74, 0x0C, 0x82, 0x46,
-    0x63, 0xAE, 0xF1, 0x28, 0x86, 0xEA, 0x6C, 0xC3, 0x48, 0x4F, 0x45, 0x09, 0xCC, 0xB9, 0x63, 0x42,
-    0x01, 0x64, 0xA0, 0x89, 0xB6, 0xF0, 0x43, 0xC6, 0x7B, 0x2E, 0x52, 0x27, 0x5C, 0xA1, 0xE7, 0x7A,
-    0x4B, 0x7D, 0xDC, 0x41, 0x7D, 0x3B, 0x33, 0x59, 0x8D, 0xAF, 0x54, 0x65, 0x11, 0x80, 0xCD, 0x8B,
-    0x76, 0x51, 0x57, 0x5B, 0x09, 0xD9, 0x5E, 0xC0, 0x20, 0x9F, 0x0B, 0x14, 0xB2, 0x23, 0x07, 0xC9,
-    0x16, 0x9F, 0x40, 0x23, 0x78, 0x8A, 0xCF, 0xBA, 0x09, 0x16, 0xB9, 0xAD, 0x98, 0x95, 0xDC, 0xC5,
-    0xB2, 0x18, 0xAB, 0x72, 0xE6, 0x48, 0x83, 0x5A, 0x84, 0x33, 0xF7, 0x5E, 0x02, 0x58, 0x2A, 0xE3,
-    0x11, 0x97, 0xA4, 0x4E, 0x3A, 0x06, 0xB0, 0x6A, 0x0B, 0xD4, 0xFF, 0xB6, 0xBA, 0xD0, 0xC0, 0xB8,
-    0x77, 0xC9, 0x66, 0x61, 0x6C, 0x0F, 0x94, 0x87, 0xB4, 0x03, 0xC9, 0x08, 0x22, 0x8B, 0x3A, 0xEB,
-    0x18, 0xE0, 0x6A, 0x51, 0xD1, 0x36, 0x68, 0x4B, 0x9A, 0xA9, 0x2D, 0x6F, 0xC7, 0x1D, 0x9E, 0xA8,
-    0x4B, 0x15, 0x6E, 0xE7, 0x13, 0xB6, 0x4B, 0x08, 0xDA, 0x9F, 0x5E, 0x20, 0x0F, 0x6A, 0x57, 0x60,
-    0xAD, 0xB4, 0x4B, 0xD0, 0xDC, 0xBC, 0xA8, 0x93, 0x1E, 0x97, 0x30, 0xF8, 0x11, 0x18, 0x22, 0xE9,
-    0x38, 0xCD, 0x37, 0xB5, 0xEF, 0x96, 0x7D, 0x37, 0x8C, 0x4F, 0x61, 0xF6, 0x07, 0xA9, 0xF9, 0x54,
-    0x15, 0x32, 0xCC, 0x96, 0x60, 0x15, 0xA3, 0x62, 0x00, 0x68, 0x06, 0x53, 0x8D, 0xB6, 0x28, 0xAF,
-    0x27, 0x4E, 0x19, 0xD2, 0xB1, 0x30, 0x6A, 0xDC, 0xEB, 0x29, 0x76, 0x05, 0xF2, 0xDD, 0x8E, 0xD8,
-    0x63, 0xFC, 0x39, 0x2F, 0x7D, 0xF9, 0x33, 0x5B, 0x9B, 0x29, 0x2C, 0x3D, 0x83, 0x7D, 0x95, 0x3A,
-    0x9E, 0x80, 0x0D, 0x0A, 0x71, 0xBE, 0xF7, 0x61, 0xFF, 0x49, 0x5E, 0x7C, 0x74, 0x87, 0xA1, 0x73,
-    0xE2, 0x94, 0xD4, 0x2E, 0x0C, 0x02, 0x9D, 0xB3, 0x76, 0x74, 0xB0, 0x57, 0xBF, 0xFB, 0x4B, 0xE6,
-    0x5E, 0x1B, 0xB2, 0x4B, 0xED, 0x85, 0x95, 0x1C, 0x24, 0xD3, 0x49, 0x28, 0x2E, 0x8A, 0x49, 0xB1,
-    0x40, 0xA2, 0x06, 0x6E, 0x03, 0x35, 0xE2, 0xE9, 0x60, 0x19, 0x6C, 0x6F, 0xDC, 0xFC, 0x3C, 0xCA,
-    0x05, 0xD0, 0x4A, 0x88, 0x7F, 0x92, 0xF1, 0x5B, 0xA2, 0xAA, 0xB5, 0x7C, 0x96, 0xB6, 0xD9, 0xD5,
-    0x21, 0xF9, 0xAB, 0x1C, 0x6D, 0xED, 0x1F, 0xFB, 0xB4, 0xED, 0x75, 0x4B, 0x33, 0x27, 0xD7, 0xD2,
-    0xD6, 0x7C, 0x9F, 0x93, 0x87, 0xE0, 0xB6, 0x97, 0x67, 0x4D, 0xDC, 0x66, 0x4D, 0xDA, 0xE1, 0xD7,
-    0x67, 0x0D, 0xFC, 0x1D, 0xBD, 0xF6, 0x70, 0xDC, 0x5E, 0xCB, 0x1D, 0xD4, 0xBD, 0xDF, 0x77, 0xDD,
-    0xFE, 0x09, 0xDC, 0x14, 0x7E, 0x3F, 0x19, 0x6C, 0xF5, 0xAF, 0x0F, 0x7C, 0x78, 0x8A, 0xE3, 0x2C,
-    0x03, 0x3A, 0xF7, 0x16, 0xBE, 0xCC, 0x51, 0xF8, 0x80, 0x64, 0xD4, 0x6E, 0xB7, 0x38, 0xE3, 0x86,
-    0x1F, 0x54, 0x01, 0xF5, 0x3B, 0x96, 0x37, 0x9F, 0x6B, 0x26, 0x27, 0xF5, 0x1B, 0xD5, 0xC1, 0xE5,
-    0xCC, 0xB9, 0x45, 0xAE, 0x60, 0x66, 0x5C, 0xB4, 0xF7, 0xFF, 0x9E, 0xF2, 0x18, 0x40, 0xC2, 0x2A,
-    0x06, 0xBE, 0x45, 0x85, 0x12, 0x5F, 0x74, 0x74, 0xE8, 0x3E, 0xCF, 0x63, 0x65, 0x6C, 0x95, 0x8B,
-    0x1D, 0x20, 0x75, 0xC1, 0x7D, 0x45, 0x80, 0xB6, 0x5C, 0x6E, 0x2B, 0xEF, 0x38, 0x51, 0xDC, 0x7B,
-    0xBE, 0x42, 0x57, 0xAA, 0xD7, 0xDD, 0x89, 0x2B, 0x54, 0x0A, 0x3D, 0x43, 0x13, 0x28, 0x0E, 0x2C,
-    0x42, 0xE7, 0x16, 0x57, 0xBE, 0x06, 0xE4, 0xEE, 0x55, 0xEE, 0xAE, 0xB4, 0xB6, 0x41, 0xF1, 0x25,
-    0xC9, 0x51, 0xC4, 0x7A, 0xEC, 0xA1, 0x51, 0xAB, 0xE2, 0x0A, 0x70, 0x38, 0x8A, 0x65, 0xD6, 0xA1,
-    0x68, 0xE4, 0x12, 0x8A, 0x30, 0xAC, 0x28, 0x66, 0x77, 0x7B, 0xD2, 0x24, 0x28, 0xC6, 0xC2, 0x6D,
-    0xF4, 0x82, 0x45, 0x5F, 0x8B, 0x31, 0x8B, 0xEA, 0x15, 0x1F, 0x3A, 0xEB, 0xC2, 0x65, 0x1A, 0x5E,
-    0xA5, 0x0E, 0x55, 0x2D, 0xBC, 0x0C, 0x83, 0x01, 0xF5, 0xDB, 0x93, 0xD2, 0x45, 0xA0, 0xAB, 0xA1,
-    0xD7, 0xFB, 0x36, 0x31, 0xBF, 0x85, 0x6E, 0xBB, 0x4C, 0xC8, 0x4F, 0xA3, 0x70, 0x95, 0x20, 0x9E,
-    0xF3, 0x76, 0x75, 0x78, 0xC8, 0xC2, 0xC1, 0x18, 0xF8, 0xAE, 0x4F, 0x31, 0x9F, 0xF4, 0x84, 0x53,
-    0xEB, 0xCE, 0xF2, 0xB8, 0x9D, 0x59, 0x17, 0x6B, 0x3E, 0x9C, 0x47, 0xC0, 0xE0, 0xA5, 0xBD, 0x22,
-    0xA2, 0x4E, 0x22, 0x7D, 0xC4, 0xCB, 0x74, 0x11, 0x95, 0x01, 0xCA, 0x89, 0xFA, 0x11, 0x18, 0xE0,
-    0xA4, 0x7C, 0x8F, 0xF6, 0x56, 0x53, 0xA2, 0xE1, 0xDA, 0x66, 0x4A, 0x37, 0xA0, 0xD1, 0x33, 0x67,
-    0xCC, 0xEA, 0x26, 0xAC, 0x21, 0xE7, 0x24, 0xFD, 0x52, 0xB7, 0x2C, 0xDD, 0xA6, 0x3F, 0x6D, 0x5D,
-    0x32, 0x1E, 0x38, 0x71, 0xD2, 0xA8, 0x6E, 0x31, 0x4F, 0x61, 0xCE, 0x8E, 0x75, 0x2E, 0xAA, 0x9B,
-    0xEE, 0x89, 0xEA, 0xEE, 0x87, 0x38, 0xA9, 0x4D, 0x9E, 0xD6, 0x99, 0x71, 0x9B, 0xA5, 0x2E, 0x90,
-    0x92, 0xE8, 0xD6, 0x3F, 0xF7, 0xE6, 0x0E, 0xE7, 0xFE, 0x90, 0x00, 0x20, 0x1B, 0x0E, 0x4D, 0x9A,
-    0x35, 0x4F, 0xC1, 0x34, 0x46, 0x00, 0x57, 0x9F, 0x60, 0xAB, 0xA0, 0x39, 0xE6, 0x7A, 0xF5, 0x18,
-    0x02, 0xCF, 0x19, 0xD8, 0x22, 0x46, 0xEA, 0xA8, 0x3B, 0x9D, 0x93, 0xAA, 0x86, 0x3D, 0x27, 0xBE,
-    0x78, 0xC8, 0x1B, 0x9C, 0x22, 0x30, 0xBE, 0xD2, 0x39, 0xD0, 0x62, 0xA7, 0xC5, 0x8A, 0x45, 0xD1,
-    0xE9, 0xE0, 0x1C, 0x7C, 0x25, 0x35, 0xA7, 0x43, 0x38, 0x1D, 0x05, 0xE7, 0xE0, 0x45, 0xA9, 0x51,
-    0x8C, 0xE5, 0x65, 0xCE, 0x41, 0x0F, 0xC6, 0x7B, 0x72, 0xA3, 0xA7, 0xE3, 0x6A, 0x39, 0x07, 0xB2,
-    0x9C, 0x83, 0x48, 0x19, 0x9F, 0xB1, 0xE8, 0x69, 0x31, 0xD2, 0x39, 0xC8, 0x58, 0xF4, 0xB4, 0xE8,
-    0x04, 0x7A, 0x47, 0xB6, 0xDD, 0x2A, 0xD7, 0x88, 0xB7, 0x9A, 0x47, 0x0D, 0xD5, 0x86, 0x3C, 0x98,
-    0x67, 0x26, 0xF9, 0xFE, 0xF4, 0xB1, 0xCA, 0xB7, 0x3A, 0x05, 0x2C, 0xC4, 0x83, 0xEB, 0x9D, 0x08,
-    0x9C, 0x90, 0x9B, 0xFB, 0xE0, 0xA0, 0x0C, 0x4E, 0xBE, 0x37, 0x9B, 0xAD, 0x6B, 0x8E, 0x54, 0xBD,
-    0xF7, 0xF8, 0x8D, 0x2D, 0xF9, 0x92, 0xF1, 0x28, 0x72, 0x94, 0x32, 0xA3, 0x31, 0x50, 0xE2, 0xC9,
-    0xEB, 0x21, 0x63, 0x03, 0x80, 0xAE, 0x0D, 0x77, 0xD8, 0xB3, 0x8E, 0x71, 0x4F, 0x98, 0xAE, 0x8E,
-    0x41, 0x3E, 0x2A, 0xE0, 0x78, 0x98, 0x8E, 0xCD, 0xAE, 0xE3, 0xEE, 0xEB, 0x44, 0x05, 0xBD, 0xAB,
-    0xE5, 0x5A, 0xE0, 0x26, 0xBD, 0x6D, 0xD1, 0x6C, 0xE8, 0xE2, 0xAB, 0xC4, 0xAA, 0x0C, 0x86, 0x72,
-    0x17, 0xA2, 0xD7, 0x60, 0x04, 0x5D, 0x39, 0x8F, 0x41, 0x50, 0x6E, 0x33, 0xD2, 0xB3, 0x75, 0xF9,
-    0x6F, 0x4B, 0x47, 0xDF, 0xAC, 0xBC, 0xEB, 0x76, 0x72, 0x48, 0xAA, 0xA6, 0x1D, 0xE5, 0xD9, 0xF0,
-    0xAA, 0x60, 0xF4, 0xF1, 0xC0, 0xED, 0x5F, 0xEE, 0x5C, 0x64, 0x5F, 0xB2, 0xDD, 0x4B, 0xCC, 0x50,
-    0xE2, 0x6E, 0x73, 0xCF, 0xE8, 0x1D, 0xC1, 0x30, 0xA0, 0x75, 0x1E, 0x8D, 0x91, 0x70, 0x4B, 0x58,
-    0xCE, 0x01, 0x09, 0x2A, 0x3A, 0x15, 0x65, 0x1C, 0x17, 0x3C, 0x43, 0x35, 0x1A, 0x75, 0x37, 0x51,
-    0xC5, 0xFC, 0xA0, 0x70, 0x3C, 0xDF, 0xAA, 0x49, 0xAB, 0x17, 0xB3, 0x69, 0x0E, 0xFF, 0xC5, 0xFC,
-    0x0D, 0x30, 0xCF, 0x63, 0x34, 0x3E, 0x64, 0xEE, 0x8B, 0xE6, 0xC8, 0xA5, 0x4E, 0x4F, 0xA0, 0x8B,
-    0x9D, 0x20, 0xC4, 0xCF, 0x72, 0xB7, 0xFD, 0x13, 0x4D, 0x31, 0xD6, 0x36, 0x90, 0x8F, 0x85, 0x29,
-    0x20, 0x74, 0x4D, 0x3C, 0x6E, 0x02, 0x81, 0x79, 0x3D, 0x99, 0x57, 0x93, 0x9F, 0xF0, 0x3C, 0x2E,
-    0xF1, 0x52, 0xCC, 0x4B, 0xBA, 0x5F, 0x6F, 0x1B, 0x3A, 0x30, 0x77, 0xAC, 0xE6, 0x70, 0xA0, 0x86,
-    0x13, 0xBD, 0x72, 0xD2, 0xAB, 0x66, 0xEB, 0x9F, 0xCF, 0x18, 0xC7, 0x7F, 0xF8, 0x05, 0x54, 0xC0,
-    0x71, 0x43, 0x1B, 0x9D, 0x7E, 0x48, 0x99, 0x7D, 0xDE, 0x6F, 0xFE, 0x16, 0xD8, 0x68, 0x9E, 0xFD,
-    0xD5, 0x16, 0xCE, 0xA1, 0xCB, 0xE3, 0xD6, 0xE2, 0xA9, 0x97, 0x7B, 0x13, 0xB6, 0x59, 0x69, 0x9E,
-    0xF7, 0xDA, 0x1F, 0x8B, 0x8D, 0xCB, 0x90, 0x11, 0xB7, 0xE0, 0xDC, 0x9F, 0x0B, 0x8C, 0xE3, 0xD4,
-    0x77, 0x31, 0x8B, 0xAA, 0x18, 0x4C, 0xB1, 0x3D, 0x3B, 0x1E, 0x8B, 0xCB, 0x14, 0x14, 0x87, 0x48,
-    0xD3, 0x5E, 0x4F, 0x03, 0xB4, 0xA5, 0x00, 0xB5, 0xC5, 0xE9, 0x7B, 0xBA, 0xBD, 0xC8, 0x71, 0x6A,
-    0x70, 0x92, 0xFB, 0x89, 0xBB, 0x4E, 0xBF, 0xD8, 0x3A, 0x49, 0x2E, 0x2C, 0x1E, 0xCE, 0x55, 0xA5,
-    0xF0, 0x34, 0xE9, 0xA7, 0x96, 0x1B, 0x97, 0xBE, 0x09, 0x47, 0x8A, 0xA7, 0x99, 0x23, 0xC3, 0x4C,
-    0x64, 0xF8, 0xD3, 0xE9, 0xAA, 0x3B, 0x75, 0xCB, 0xC9, 0x70, 0xE7, 0xD5, 0x7B, 0x4D, 0x13, 0x34,
-    0x4B, 0x4B, 0xD2, 0x44, 0xA0, 0x04, 0xEB, 0x89, 0xF6, 0x3A, 0x81, 0x22, 0x94, 0x17, 0xC0, 0xAC,
-    0x9A, 0x80, 0xD2, 0xA5, 0xA9, 0xE4, 0xBE, 0xB2, 0x0C, 0x8A, 0x4E, 0xB9, 0x86, 0xC7, 0xBE, 0x9C,
-    0xD2, 0x3C, 0x2E, 0x4D, 0x49, 0x87, 0xBA, 0xAA, 0xDD, 0xFE, 0x88, 0x6E, 0x04, 0xD0, 0xA8, 0xD4,
-    0xAA, 0x02, 0x13, 0x74, 0xF1, 0x77, 0x01, 0xE3, 0x40, 0xB7, 0x5F, 0xD1, 0x20, 0xAA, 0x93, 0x22,
-    0xB4, 0xA0, 0x32, 0x05, 0xCF, 0x88, 0x5B, 0x2D, 0x6B, 0x8B, 0x0C, 0xBA, 0xB3, 0x8B, 0xDD, 0x1C,
-    0xDD, 0xD7, 0x21, 0xDB, 0x15, 0x9D, 0x45, 0xF5, 0x3D, 0x99, 0x39, 0x19, 0x27, 0x58, 0xF1, 0xAC,
-    0xA6, 0x5F, 0x64, 0xCD, 0x11, 0x99, 0x03, 0xC0, 0x0B, 0xC3, 0x36, 0x7B, 0x0F, 0x1E, 0x6F, 0x44,
-    0x04, 0xB2, 0x2E, 0x8B, 0x53, 0x43, 0xC9, 0x95, 0xE6, 0x73, 0x32, 0xAB, 0x92, 0x71, 0xEA, 0x84,
-    0x91, 0xA7, 0x08, 0x4D, 0x71, 0xF2, 0xB3, 0xC6, 0x67, 0x0D, 0xEE, 0xBF, 0x02, 0x3F, 0xB4, 0xD4,
-    0x5F, 0x9C, 0x0F, 0xF8, 0xF4, 0x84, 0xBA, 0xB0, 0x9C, 0x18, 0xAA, 0x46, 0x57, 0x4B, 0x93, 0x4C,
-    0xA0, 0xC6, 0xDB, 0xB4, 0x2F, 0xCA, 0xD1, 0xCE, 0xB6, 0xF6, 0x16, 0xED, 0x09, 0x2C, 0xFD, 0x0B,
-    0x11, 0x83, 0xEC, 0x8D, 0x0B, 0xDB, 0x7D, 0x77, 0x80, 0xE2, 0x89, 0x0D, 0x69, 0xD7, 0x8A, 0x97,
-    0x05, 0xA8, 0x50, 0x96, 0x2B, 0x3E, 0x0B, 0x9B, 0xC5, 0xCA, 0x33, 0xCF, 0xA4, 0x95, 0xBD, 0xDA,
-    0xD9, 0xAF, 0x60, 0xC5, 0xB1, 0xAC, 0x52, 0xA9, 0x8E, 0x12, 0x07, 0xCC, 0x89, 0xA2, 0xBF, 0xCB,
-    0x2D, 0x5B, 0x84, 0x98, 0x3A, 0x6D, 0x59, 0xD4, 0x93, 0x4F, 0x4B, 0x5D, 0x50, 0x8A, 0x9F, 0x82,
-    0xDE, 0x67, 0x88, 0x80, 0x29, 0x07, 0x8C, 0x0D, 0x39, 0x04, 0x15, 0x49, 0x7E, 0x00, 0xA6, 0x9C,
-    0x59, 0x74, 0x80, 0x8B, 0x73, 0x79, 0xBB, 0x57, 0x24, 0x2A, 0xC4, 0x3F, 0x8B, 0x9C, 0xCE, 0x4D,
-    0xB0, 0xA4, 0xB2, 0x6F, 0x03, 0xC1, 0x58, 0xE6, 0xDF, 0x35, 0x60, 0x4A, 0x6E, 0x3B, 0x67, 0xF8,
-    0x47, 0x97, 0x59, 0x0D, 0x1E, 0x90, 0x15, 0x64, 0xC2, 0xB7, 0x9F, 0x4E, 0xA9, 0x9C, 0xD4, 0x8A,
-    0x69, 0xE7, 0xAE, 0x12, 0xC5, 0xC5, 0xF5, 0x9E, 0x6D, 0xD0, 0x4D, 0xCD, 0x7F, 0xE3, 0xFA, 0x2C,
-    0x18, 0x62, 0xEE, 0xBD, 0x6E, 0xAF, 0x4B, 0xDD, 0x1B, 0x87, 0x30, 0x44, 0xA1, 0x29, 0xC5, 0x4A,
-    0x1A, 0xE7, 0x27, 0xC6, 0x5C, 0xF8, 0x45, 0xBF, 0xC8, 0x8F, 0xFB, 0x2F, 0xFA, 0x92, 0xDB, 0xE8,
-    0x0A, 0xED, 0x0C, 0xD0, 0xEE, 0x63, 0x48, 0x76, 0x6E, 0x4C, 0xC9, 0x71, 0x2E, 0xCF, 0x96, 0xBA,
-    0x44, 0xB3, 0xD7, 0x34, 0xEC, 0xB2, 0x08, 0xC5, 0xAD, 0xFC, 0x5A, 0x35, 0x71, 0x41, 0x1D, 0x85,
-    0xAA, 0x9D, 0xDF, 0x14, 0xD5, 0x14, 0xA2, 0x69, 0x15, 0x5F, 0x81, 0x03, 0x79, 0x48, 0xB5, 0x6D,
-    0xC5, 0xAD, 0xE1, 0xF4, 0x36, 0x56, 0xC0, 0x27, 0xDB, 0xAF, 0x08, 0xAD, 0x48, 0xA1, 0xEA, 0xA6,
-    0x75, 0xC2, 0xC4, 0x60, 0x64, 0xAC, 0x08, 0xAE, 0xD5, 0xD4, 0xD5, 0xA8, 0x8B, 0x9B, 0x60, 0x4F,
-    0x2A, 0xC2, 0x8F, 0x38, 0xE4, 0x67, 0x37, 0x51, 0x4D, 0xF3, 0xBE, 0xFD, 0x91, 0x48, 0xBE, 0x80,
-    0x45, 0x4C, 0xCB, 0xC7, 0x3D, 0x64, 0xB7, 0x59, 0x7B, 0x9D, 0xEA, 0x96, 0x5E, 0x78, 0x47, 0xA8,
-    0x03, 0x03, 0xF1, 0xC6, 0xDE, 0x38, 0x89, 0x70, 0x05, 0x76, 0x4B, 0x37, 0x9F, 0x26, 0x50, 0x43,
-    0x8E, 0x73, 0xED, 0x52, 0xF3, 0x58, 0x74, 0xCF, 0x9C, 0xF1, 0x80, 0xB8, 0x7F, 0x03, 0xE0, 0x89,
-    0x5B, 0x9A, 0x2F, 0x4F, 0xDB, 0x9A, 0xE5, 0x11, 0xC2, 0x30, 0xDD, 0x65, 0x1D, 0x26, 0x15, 0xEA,
-    0xE9, 0x2E, 0x2B, 0x39, 0x5D, 0xB9, 0x08, 0x01, 0x9D, 0x5E, 0xF3, 0xF7, 0xEF, 0x92, 0xFC, 0x17,
-    0x50, 0x05, 0x96, 0xAB, 0x2D, 0xEA, 0xE8, 0x43, 0xA6, 0x2B, 0x4B, 0xAE, 0xAC, 0x4B, 0x41, 0x40,
-    0x0A, 0x86, 0x26, 0xBA, 0xCD, 0x4B, 0xEB, 0xC7, 0x6A, 0xFF, 0x83, 0xF2, 0xAB, 0x7F, 0xDE, 0xE8,
-    0x0B, 0x7D, 0x03, 0x60, 0xD4, 0xE4, 0x92, 0xA8, 0xD2, 0xB6, 0x55, 0x8C, 0x33, 0x26, 0x6B, 0x1B,
-    0xFF, 0x56, 0xAF, 0x9B, 0xA9, 0x44, 0x19, 0x00, 0x6E, 0xAF, 0x07, 0x03, 0xB4, 0x4A, 0xF6, 0x99,
-    0xB8, 0xC1, 0x64, 0xDA, 0x4B, 0xF9, 0x24, 0x66, 0xF9, 0x01, 0xEB, 0xF8, 0x31, 0xCE, 0x32, 0x73,
-    0x73, 0x6E, 0xD3, 0xC2, 0xDD, 0xE0, 0xE1, 0x7D, 0xEE, 0x71, 0xAE, 0xFD, 0x8B, 0xBC, 0x77, 0xDC,
-    0x19, 0xC7, 0xC9, 0x32, 0x4E, 0xC3, 0x7B, 0x4C, 0x97, 0x0C, 0x71, 0x72, 0x74, 0xDD, 0x38, 0xF5,
-    0xE1, 0x9C, 0xE9, 0x94, 0xF3, 0x21, 0x53, 0x16, 0x4D, 0x30, 0xE9, 0x51, 0xAA, 0x72, 0xAB, 0x9E,
-    0xBE, 0xA7, 0x43, 0x61, 0x06, 0x13, 0x06, 0xDC, 0x3F, 0x27, 0x5B, 0xE5, 0xB4, 0xDA, 0xEF, 0xFF,
-    0x47, 0x41, 0xFC, 0x0D, 0x10, 0x43, 0x15, 0x29, 0xE8, 0xC1, 0x04, 0x97, 0xC6, 0xDF, 0x9E, 0x54,
-    0xD6, 0x9C, 0x49, 0x56, 0x3F, 0x21, 0x56, 0x82, 0x69, 0xDC, 0x36, 0xFE, 0x69, 0x73, 0xB8, 0x0C,
-    0x3B, 0x9F, 0x70, 0x21, 0xAB, 0x9D, 0xEB, 0x15, 0xCB, 0x24, 0xDD, 0x3B, 0x11, 0x88, 0x27, 0xC0,
-    0x2A, 0xB7, 0x4D, 0xBE, 0x3B, 0x98, 0x5D, 0x98, 0x64, 0x0E, 0xE2, 0x2F, 0xB8, 0x00, 0x88, 0x26,
-    0xDE, 0x4D, 0xF0, 0x93, 0x42, 0xD6, 0x9B, 0x43, 0xF2, 0xC5, 0xA9, 0x47, 0xEA, 0x70, 0x50, 0x6C,
-    0xF8, 0x1B, 0x8E, 0x8F, 0xFA, 0x9D, 0x32, 0x4A, 0xA9, 0xD1, 0xA8, 0xCA, 0xA3, 0x0E, 0x39, 0x9B,
-    0xD2, 0x3A, 0x34, 0xFB, 0xC5, 0xA5, 0x68, 0xAF, 0x15, 0xB7, 0xD7, 0x1F, 0x6D, 0xC8, 0x0F, 0x31,
-    0xEF, 0x1E, 0x1A, 0xC5, 0xC5, 0x97, 0xA0, 0x0A, 0x32, 0x7A, 0x6F, 0x0F, 0x9A, 0xF7, 0x95, 0xA5,
-    0x2D, 0x0F, 0x2B, 0x90, 0x74, 0x93, 0xF9, 0xCC, 0xA0, 0x2B, 0x68, 0xB9, 0x12, 0x5B, 0xEF, 0xB7,
-    0x7B, 0x60, 0x5A, 0xED, 0xB0, 0xBA, 0xB1, 0x4C, 0x8B, 0x4E, 0x99, 0x01, 0x1D, 0x0D, 0x0A, 0x6C,
-    0x7F, 0xD0, 0xC5, 0x40, 0x8E, 0x11, 0x45, 0x5C, 0x54, 0x7C, 0x55, 0x74, 0xC6, 0x76, 0xF1, 0x22,
-    0xF7, 0x65, 0x70, 0x5C, 0x72, 0xCC, 0x9F, 0x12, 0x4F, 0x74, 0x73, 0x25, 0x00, 0xBE, 0x1D, 0x07,
-    0x72, 0x74, 0x1E, 0x7D, 0x84, 0x9B, 0xBF, 0xDD, 0x4D, 0x29, 0xD4, 0x97, 0x5C, 0x46, 0xD5, 0xFE,
-    0xD1, 0x0A, 0x68, 0xF2, 0x32, 0x54, 0x0A, 0x34, 0xA2, 0x25, 0x43, 0xA9, 0xCE, 0xC7, 0x6C, 0x9E,
-    0xCA, 0x4B, 0xBD, 0xE3, 0xD2, 0xDA, 0x6C, 0x36, 0xBD, 0x2B, 0xA6, 0x5E, 0xF3, 0x62, 0x07, 0x7E,
-    0xB1, 0xF5, 0x33, 0x3E, 0x46, 0x96, 0xEC, 0xBA, 0x98, 0xB5, 0x90, 0xB9, 0x98, 0xFE, 0x58, 0x24,
-    0x21, 0x23, 0x59, 0xA5, 0x7B, 0x11, 0x48, 0x3D, 0x00, 0xF5, 0xAD, 0x54, 0x95, 0x39, 0xAF, 0x94,
-    0xB1, 0x88, 0xD4, 0xA5, 0x0A, 0x6A, 0x6A, 0x7E, 0xBE, 0xDF, 0x3C, 0xF9, 0x85, 0x59, 0x2D, 0xDD,
-    0xCB, 0x62, 0xC1, 0x78, 0xBE, 0x73, 0xAF, 0x11, 0x81, 0xA0, 0xFE, 0x9E, 0x37, 0xC5, 0x0E, 0x82,
-    0xEC, 0xF8, 0x9B, 0x9A, 0x77, 0x1C, 0x57, 0xF7, 0xCB, 0x3B, 0xDE, 0x3F, 0x3E, 0x19, 0x7D, 0x01,
-    0x4D, 0x29, 0xB9, 0xC0, 0x34, 0xA4, 0xE7, 0x43, 0x06, 0x95, 0xDE, 0x64, 0xA2, 0xE7, 0x1D, 0x5D,
-    0xE0, 0x1A, 0x68, 0xDF, 0xF3, 0xBA, 0xC2, 0x41, 0x10, 0x28, 0x0D, 0x3D, 0x7A, 0xBA, 0x15, 0xBE,
-    0x51, 0x9A, 0xA0, 0x42, 0x1B, 0xFF, 0x14, 0x43, 0xFE, 0xEF, 0x74, 0x53, 0x0E, 0xEE, 0x46, 0xB9,
-    0xEF, 0xAC, 0x5B, 0x3D, 0x73, 0x62, 0xD3, 0x84, 0xFA, 0xFA, 0x05, 0xDF, 0xEF, 0xF0, 0xF9, 0xE2,
-    0x84, 0x37, 0x10, 0x4F, 0x7F, 0x10, 0xD6, 0x07, 0x4E, 0x3D, 0x9D, 0xF8, 0xE5, 0x59, 0x1D, 0x5D,
-    0x20, 0x49, 0x6B, 0x8A, 0x93, 0x78, 0xA2, 0xB6, 0xC6, 0x6F, 0xE3, 0x7D, 0xE7, 0xD3, 0x93, 0x1C,
-    0x3D, 0x25, 0x78, 0x4D, 0xDD, 0x8A, 0x0B, 0xCB, 0xD7, 0x0E, 0x63, 0x5A, 0xAB, 0xA0, 0x5B, 0xC4,
-    0xF5, 0xF9, 0x5E, 0xD3, 0xE4, 0x92, 0x6A, 0x58, 0xF5, 0x51, 0x47, 0xCF, 0xC2, 0x08, 0xB0, 0xC6,
-    0xB8, 0xD2, 0x25, 0xB9, 0xAB, 0x56, 0x8F, 0x99, 0x38, 0xD7, 0x7A, 0x1F, 0x56, 0x6E, 0x6E, 0xD6,
-    0x29, 0x0B, 0xBA, 0xE1, 0x91, 0x2D, 0xDC, 0xDC, 0xE2, 0x5D, 0xE3, 0x5E, 0x3D, 0xD2, 0xF8, 0xC3,
-    0x89, 0x72, 0x91, 0x37, 0xAD, 0xF9, 0xE3, 0x4E, 0x33, 0x2A, 0x8C, 0xE1, 0xFF, 0x1D, 0x47, 0x58,
-    0xDC, 0x4E, 0x11, 0xF7, 0xC6, 0x0C, 0xE6, 0xDE, 0x8F, 0x9D, 0x33, 0x0B, 0xCE, 0x17, 0x7A, 0xC1,
-    0xCC, 0x17, 0xD0, 0x68, 0xC9, 0xDC, 0x14, 0x35, 0xA3, 0x27, 0x2D, 0xDF, 0xEB, 0x84, 0xB3, 0x09,
-    0x7C, 0xD9, 0x47, 0x7C, 0x6D, 0x0B, 0x66, 0x1E, 0x16, 0x9A, 0x5D, 0xC0, 0x6F, 0xAD, 0x03, 0x98,
-    0xAB, 0xA2, 0x8A, 0x7B, 0x6F, 0x2C, 0xCA, 0x14, 0xDE, 0xA9, 0xB1, 0xC7, 0xF8, 0x22, 0x4C, 0x51,
-    0x65, 0x17, 0x7B, 0x2C, 0xF5, 0x18, 0x1E, 0x93, 0xBC, 0xC0, 0x57, 0x93, 0xC2, 0x3E, 0xAD, 0xD1,
-    0x91, 0xFD, 0xC3, 0xA0, 0x49, 0xE2, 0x49, 0x2B, 0x46, 0xD4, 0xD3, 0xCE, 0xE6, 0xD9, 0x27, 0x9C,
-    0x8B, 0xF7, 0x6B, 0xCD, 0xF7, 0x4E, 0xEF, 0xB6, 0x46, 0xEC, 0x5C, 0xB5, 0x6D, 0xE6, 0x20, 0xB5,
-    0xFA, 0x5F, 0x38, 0x29, 0x3D, 0x51, 0x9C, 0x5D, 0x29, 0x6A, 0xF4, 0x34, 0xC4, 0x5B, 0x2A, 0xF8,
-    0x9E, 0x32, 0xE3, 0xB7, 0x9C, 0x38, 0x4A, 0x37, 0x65, 0xF5, 0xB8, 0xB7, 0x58, 0x3F, 0xD5, 0xA0,
-    0x5B, 0x51, 0xEA, 0xE9, 0x37, 0xDE, 0x3B, 0x74, 0x18, 0x0F, 0x9A, 0x13, 0xA3, 0x02, 0x35, 0x7C,
-    0xFD, 0xEB, 0xA4, 0x30, 0x01, 0xA5, 0xA8, 0xEC, 0x3C, 0x91, 0x79, 0xDA, 0x24, 0x6D, 0x74, 0x17,
-    0x23, 0x0A, 0xC6, 0x60, 0x7B, 0x08, 0x98, 0x2E, 0x31, 0x66, 0x6F, 0x4A, 0x9E, 0xB4, 0xC5, 0xB1,
-    0xC6, 0xCE, 0xB1, 0x74, 0xFF, 0x40, 0xF0, 0x28, 0xEF, 0x34, 0xC5, 0x31, 0x70, 0xEA, 0xFF, 0xBA,
-    0xF8, 0x46, 0x6F, 0xC2, 0x7E, 0x08, 0xC8, 0x79, 0xB1, 0xC6, 0x5A, 0x7D, 0x57, 0x8C, 0xD1, 0xA5,
-    0xD0, 0x85, 0xAA, 0xB4, 0x0F, 0xDD, 0x0F, 0x50, 0xED, 0x18, 0x89, 0xCB, 0x79, 0x75, 0xB4, 0x2B,
-    0xE5, 0x1A, 0xC5, 0x53, 0xAA, 0xE1, 0x07, 0x40, 0x97, 0x97, 0x7B, 0x28, 0xD6, 0x97, 0x36, 0xDF,
-    0x67, 0x7A, 0xB0, 0xE6, 0x7B, 0x68, 0x20, 0x40, 0xE3, 0x03, 0x4C, 0x5F, 0x4B, 0x30, 0x41, 0x1D,
-    0xC0, 0x1D, 0xD8, 0xCD, 0xC0, 0xCF, 0xE7, 0x74, 0x95, 0x98, 0x0E, 0xEA, 0x69, 0x5C, 0x6D, 0x7A,
-    0x85, 0xAC, 0x59, 0x74, 0xA4, 0x19, 0xB7, 0x8A, 0xC6, 0x1C, 0x08, 0x73, 0xB9, 0xB1, 0x0F, 0xBE,
-    0xB8, 0x93, 0x87, 0x9A, 0xBA, 0x3C, 0xD4, 0x76, 0x99, 0x87, 0x6A, 0xF7, 0x52, 0x99, 0x30, 0x7C,
-    0xAE, 0xB2, 0xC3, 0xBD, 0x6B, 0x48, 0x13, 0x1A, 0xB1, 0x55, 0xC4, 0xB4, 0x13, 0xA6, 0x53, 0x94,
-    0x81, 0xF8, 0x8C, 0xAC, 0xE9, 0xFB, 0x69, 0x6F, 0xD1, 0x63, 0xBA, 0xCC, 0x45, 0xA7, 0x5B, 0x25,
-    0xB7, 0xDA, 0x29, 0xEC, 0x1C, 0xB3, 0x0F, 0xED, 0x2D, 0x74, 0xC8, 0x31, 0x9F, 0xC8, 0xD0, 0xC4,
-    0x12, 0x17, 0xCA, 0xEB, 0xA7, 0x81, 0xA9, 0xB0, 0x64, 0xFA, 0xD6, 0xC5, 0x8E, 0xC1, 0x89, 0x2A,
-    0xB8, 0xC8, 0x61, 0xAF, 0xA8, 0x92, 0x41, 0x9D, 0xAC, 0xA4, 0xE4, 0x7C, 0x43, 0xFC, 0x9F, 0x2C,
-    0x47, 0x5D, 0x30, 0xD1, 0x2E, 0x77, 0xC5, 0xEB, 0x29, 0xB0, 0x95, 0xCE, 0xBF, 0x11, 0xC7, 0xE5,
-    0x7B, 0x1C, 0xAA, 0x22, 0x45, 0x75, 0x15, 0x70, 0x9B, 0x54, 0x53, 0xC6, 0x74, 0xB1, 0x7C, 0xE1,
-    0xA4, 0x9B, 0x3C, 0x6F, 0x45, 0xF8, 0x6E, 0xDB, 0x66, 0xB9, 0xC3, 0x5E, 0x3A, 0x9D, 0xB1, 0x73,
-    0xDF, 0xBD, 0x06, 0x3F, 0x45, 0x64, 0xF9, 0x06, 0xB8, 0x4B, 0x68, 0x7B, 0xC7, 0xBD, 0x95, 0x77,
-    0xDF, 0x10, 0x8B, 0xCA, 0xA8, 0xFC, 0x15, 0x4F, 0x5D, 0xC6, 0xEF, 0xF0, 0x96, 0xED, 0xA6, 0x97,
-    0x6F, 0xB4, 0xC5, 0x70, 0x17, 0x28, 0xEF, 0xB4, 0x33, 0xCD, 0x3D, 0xAC, 0x34, 0x8B, 0x97, 0x5E,
-    0x2F, 0xFE, 0xBE, 0x76, 0x81, 0xDE, 0xA7, 0x17, 0x89, 0x3B, 0xFA, 0x4A, 0xA6, 0xD4, 0x93, 0x26,
-    0xF5, 0x36, 0x9F, 0xEC, 0xC8, 0x57, 0x9C, 0xE3, 0xC5, 0xFA, 0x9C, 0x50, 0xCE, 0xC8, 0x33, 0x8F,
-    0x75, 0xE4, 0x0B, 0xD7, 0x73, 0x7C, 0xA0, 0xEB, 0xF9, 0xE3, 0x8F, 0xFC, 0x41, 0x51, 0xC4, 0xC7,
-    0x34, 0xE7, 0x6B, 0xEB, 0x21, 0xE3, 0x1E, 0xB0, 0x73, 0x7D, 0xB6, 0xFD, 0x73, 0x26, 0xCC, 0xD7,
-    0xDF, 0xFF, 0xFB, 0xFF, 0x9D, 0x56, 0x4D, 0x6C, 0x15, 0x55, 0x14, 0x3E, 0x33, 0xC3, 0xEB, 0x20,
-    0x13, 0xB9, 0x24, 0xF6, 0x45, 0xA5, 0xC0, 0x65, 0xE1, 0x42, 0x1A, 0x60, 0x36, 0x2C, 0x58, 0xF4,
-    0xF5, 0x0E, 0x10, 0x25, 0x91, 0x44, 0x9A, 0xC0, 0xDB, 0xE8, 0x02, 0x13, 0x57, 0x40, 0x62, 0x5D,
-    0x98, 0xD8, 0x45, 0xFB, 0x66, 0x90, 0x85, 0x0B, 0x12, 0x79, 0x89, 0xC6, 0x8D, 0x9B, 0x26, 0x76,
-    0x81, 0x8F, 0x05, 0x68, 0x58, 0x34, 0xB1, 0xED, 0x4C, 0xA9, 0xA6, 0x31, 0x2C, 0x18, 0x40, 0x43,
-    0xA2, 0x0B, 0x06, 0x15, 0x10, 0xBB, 0xE8, 0x15, 0x07, 0x98, 0x96, 0x3B, 0x73, 0x3C, 0x77, 0xE6,
-    0x51, 0x10, 0x0C, 0x0B, 0xEF, 0xBC, 0xB9, 0xF7, 0x9E, 0x73, 0x7F, 0xCE, 0xDF, 0x77, 0xCE, 0xBC,
-    0x23, 0xE3, 0x16, 0x06, 0x2C, 0x07, 0x57, 0x82, 0x1F, 0x41, 0x01, 0xFD, 0x9A, 0x16, 0xA9, 0x89,
-    0x1E, 0x97, 0x44, 0x02, 0x1C, 0x69, 0x03, 0x47, 0xB0, 0x50, 0x01, 0x0E, 0x4B, 0x11, 0x87, 0x27,
-    0x12, 0x23, 0x27, 0x36, 0xB0, 0xCC, 0x8E, 0xB1, 0x08, 0x1D, 0xC4, 0x4C, 0xEC, 0xC3, 0x28, 0x35,
-    0xCE, 0x41, 0xB3, 0xD9, 0x0C, 0x89, 0x85, 0x85, 0x8F, 0x7A, 0x0B, 0xC3, 0x95, 0x46, 0x2B, 0x43,
-    0xFD, 0x60, 0x7E, 0x29, 0x61, 0xC6, 0x5D, 0xC6, 0x88, 0xCE, 0x58, 0x58, 0x40, 0xCF, 0x32, 0xD4,
-    0xEC, 0x3C, 0x5C, 0x28, 0xFC, 0x78, 0x88, 0xF6, 0xFB, 0x90, 0xE3, 0x47, 0x48, 0x3F, 0xDF, 0xC8,
-    0x57, 0xC1, 0xBA, 0x23, 0x01, 0x66, 0xA8, 0x76, 0xE7, 0x46, 0x6E, 0x2B, 0x9E, 0xF0, 0x00, 0xC0,
-    0xCE, 0x1C, 0x9C, 0xBB, 0xB7, 0x24, 0xC5, 0x28, 0xBB, 0xF8, 0xCB, 0xAF, 0x28, 0xFB, 0x62, 0xE8,
-    0xBC, 0x7E, 0xCA, 0x42, 0x9E, 0xD9, 0xB9, 0x48, 0x98, 0x0C, 0x03, 0x77, 0x36, 0x87, 0x41, 0x53,
-    0xC2, 0x61, 0x30, 0xC7, 0x11, 0xC2, 0x63, 0xB8, 0x5F, 0x19, 0x88, 0x91, 0x49, 0xDA, 0x9B, 0x18,
-    0xC3, 0xE1, 0x19, 0xDD, 0xE0, 0xC8, 0x9A, 0x2F, 0x64, 0x11, 0xB2, 0x85, 0x6E, 0x47, 0xA2, 0xE9,
-    0x1A, 0x47, 0x89, 0xC4, 0x4D, 0xE8, 0xD0, 0x5E, 0x65, 0x2A, 0x16, 0x3B, 0xF1, 0x20, 0xF4, 0x02,
-    0xA0, 0xFE, 0x4D, 0xE0, 0xFA, 0xA9, 0x57, 0x07, 0x5B, 0x90, 0x0B, 0x54, 0x0C, 0xA5, 0x31, 0xE3,
-    0x69, 0xAF, 0x08, 0x8C, 0xC9, 0xC2, 0xDD, 0x88, 0x4A, 0x78, 0x6C, 0x3E, 0x86, 0x31, 0x43, 0x59,
-    0x8A, 0x54, 0xCC, 0x58, 0xCA, 0xA5, 0x90, 0x22, 0xA9, 0x7B, 0x8E, 0x62, 0x8A, 0x95, 0xB4, 0x9B,
-    0x88, 0x48, 0x44, 0x75, 0x10, 0x89, 0x90, 0xAE, 0xE4, 0x92, 0xA5, 0x4E, 0x66, 0x91, 0x20, 0x38,
-    0xF8, 0xF4, 0x9E, 0xFE, 0x71, 0x08, 0x25, 0x84, 0x09, 0xF8, 0x09, 0x88, 0x18, 0xDC, 0x08, 0x3A,
-    0x6D, 0x57, 0xD9, 0x08, 0x14, 0x98, 0xD8, 0x96, 0xA4, 0x2E, 0x27, 0xA3, 0x50, 0x72, 0x43, 0xD6,
-    0x80, 0x79, 0xA9, 0xF6, 0xB3, 0x97, 0xD6, 0xA0, 0xDE, 0x74, 0xF1, 0x66, 0x27, 0x83, 0xED, 0xE0,
-    0x04, 0x66, 0x02, 0x93, 0x34, 0xE9, 0xF1, 0xA0, 0xE9, 0x09, 0xC9, 0x33, 0x27, 0x77, 0x90, 0xA1,
-    0x55, 0x40, 0xA6, 0x63, 0x67, 0xEC, 0xB9, 0xA3, 0xB2, 0x06, 0xBB, 0xA4, 0xB8, 0xE1, 0x59, 0x91,
-    0x7E, 0xC2, 0xC2, 0xCF, 0xEB, 0x07, 0xC3, 0xE2, 0xE8, 0xED, 0x8A, 0x06, 0xD0, 0xFD, 0xF0, 0x52,
-    0x58, 0xBC, 0xF8, 0xA3, 0x15, 0x99, 0xE4, 0xFC, 0x30, 0x0F, 0x73, 0xE8, 0x90, 0x37, 0xCA, 0xC7,
-    0xC0, 0xA3, 0xE8, 0xE7, 0xBE, 0xF2, 0x93, 0x15, 0x16, 0xA0, 0x87, 0xB7, 0xC3, 0x5C, 0xE4, 0x24,
-    0xAB, 0x8D, 0x73, 0xB8, 0x3F, 0xE7, 0x89, 0x16, 0xF6, 0x64, 0x5C, 0x9F, 0x8E, 0xA2, 0xF8, 0x3B,
-    0x17, 0xF3, 0x69, 0x58, 0xF3, 0x9C, 0x88, 0xC5, 0x7D, 0x8A, 0x60, 0x57, 0x84, 0x45, 0xA8, 0xC8,
-    0x03, 0x6D, 0x5B, 0xB2, 0x48, 0x78, 0x02, 0xFC, 0xCF, 0x44, 0xCE, 0x73, 0xF3, 0x54, 0x37, 0x82,
-    0x84, 0x27, 0x32, 0x7A, 0xB9, 0x73, 0x26, 0x05, 0x5E, 0xFD, 0x86, 0xA0, 0x36, 0xC2, 0x8C, 0x2B,
-    0x91, 0x1C, 0x70, 0x11, 0x83, 0x96, 0x13, 0x97, 0x10, 0xF0, 0xFC, 0x08, 0xF7, 0x95, 0x10, 0x30,
-    0xBA, 0x10, 0x78, 0x1C, 0xCF, 0x67, 0x34, 0x9E, 0x2F, 0x10, 0x9E, 0xB7, 0x40, 0xCF, 0xA7, 0x12,
-    0x94, 0x58, 0xC6, 0x59, 0xC4, 0xD4, 0x26, 0xF4, 0xF6, 0x2C, 0xC1, 0x7F, 0xC6, 0x58, 0xDB, 0x13,
-    0x06, 0x83, 0x2E, 0x2E, 0x5E, 0x21, 0xE6, 0x34, 0xC7, 0x7D, 0x41, 0x5F, 0xF0, 0x38, 0xEE, 0x1F,
-    0x22, 0xBE, 0xDE, 0x6C, 0x1E, 0xA4, 0xF7, 0x00, 0x4D, 0x2F, 0xD2, 0x0B, 0x55, 0x33, 0x3B, 0x9D,
-    0xCE, 0x49, 0x22, 0xD7, 0x77, 0x3A, 0xA7, 0x34, 0xCD, 0x53, 0x67, 0x16, 0x8B, 0x19, 0x92, 0x91,
-    0xB6, 0xFA, 0xF0, 0x98, 0x34, 0x7F, 0x87, 0xA7, 0x13, 0x47, 0x94, 0xB3, 0xB9, 0xB2, 0x57, 0x15,
-    0x71, 0xBE, 0xA3, 0x1B, 0x5D, 0x41, 0x10, 0x55, 0xE0, 0xE4, 0xE0, 0xE7, 0x16, 0x26, 0x2E, 0xA1,
-    0x37, 0x05, 0x11, 0xC0, 0x86, 0xAE, 0x38, 0x83, 0xD2, 0x6A, 0x86, 0xEE, 0x8B, 0xC1, 0x50, 0x00,
-    0xAE, 0x07, 0x96, 0xFC, 0x17, 0x23, 0x28, 0x19, 0xAD, 0x27, 0x19, 0x7E, 0xC9, 0x80, 0x67, 0x33,
-    0x1C, 0x62, 0xB4, 0x05, 0x4B, 0xA6, 0x38, 0xBF, 0x78, 0x85, 0xF2, 0xB7, 0xB6, 0x12, 0x8A, 0xA2,
-    0x13, 0x56, 0x9A, 0x93, 0x06, 0x36, 0x62, 0xDE, 0xEA, 0x9C, 0xBE, 0x1A, 0xC0, 0xB6, 0x11, 0x30,
-    0xF5, 0xE0, 0x23, 0x5E, 0x26, 0xD5, 0x9D, 0xBB, 0x85, 0xF9, 0xA0, 0xC8, 0x06, 0x98, 0x35, 0xEF,
-    0x9D, 0xDD, 0xD8, 0xDB, 0xDB, 0x18, 0x75, 0x53, 0x27, 0xE1, 0x69, 0x63, 0xAA, 0xF7, 0x95, 0x9E,
-    0xF3, 0xAA, 0x61, 0xC5, 0x2E, 0x64, 0x76, 0x34, 0x25, 0xF6, 0x04, 0xE4, 0xC6, 0x43, 0x95, 0x37,
-    0x64, 0x65, 0xD6, 0x1A, 0xB2, 0x9D, 0xA8, 0x7B, 0x34, 0xF4, 0x4F, 0xE8, 0x5C, 0xF1, 0xE5, 0xE3,
-    0xB9, 0x22, 0x32, 0xA7, 0x30, 0xD0, 0x13, 0xB1, 0xD3, 0xC5, 0x5F, 0x2C, 0x38, 0x2E, 0xFC, 0x46,
-    0xCE, 0x23, 0x1F, 0xEF, 0x8D, 0x9C, 0xB6, 0x88, 0xF1, 0x3C, 0x7A, 0xCA, 0x49, 0x36, 0xE9, 0x65,
-    0x0B, 0x3D, 0x5B, 0xFA, 0x77, 0x32, 0x3C, 0xA1, 0xC4, 0xC5, 0x0C, 0x8F, 0xE7, 0x3E, 0x93, 0x22,
-    0xF2, 0xC8, 0xD8, 0xBA, 0x51, 0xD8, 0x19, 0x97, 0x7E, 0x86, 0xD7, 0xD1, 0xD3, 0x01, 0xF5, 0x4B,
-    0x6B, 0x3A, 0xD3, 0xA3, 0x00, 0x8D, 0x87, 0x2F, 0x45, 0xA0, 0xF7, 0x59, 0x1A, 0x3E, 0x5D, 0x6C,
-    0x84, 0x12, 0x0A, 0x06, 0xBA, 0x0F, 0x78, 0x50, 0x6F, 0xBC, 0xE4, 0xE0, 0xC7, 0x84, 0x83, 0xAC,
-    0xE1, 0xA2, 0x35, 0xFF, 0x73, 0x00, 0x3B, 0xAA, 0x5B, 0x6A, 0xA4, 0x1C, 0xA9, 0x21, 0xA2, 0x72,
-    0x78, 0xC3, 0xF0, 0xC2, 0xF6, 0x28, 0x21, 0xEF, 0xF8, 0x03, 0x4C, 0x1B, 0x76, 0x61, 0x78, 0x13,
-    0x2B, 0x6B, 0x34, 0xC0, 0x10, 0xF4, 0xB4, 0x9F, 0x13, 0x79, 0xCB, 0x47, 0x35, 0x49, 0x61, 0xA0,
-    0x90, 0x25, 0x9B, 0x44, 0x31, 0x3D, 0x16, 0xAA, 0x73, 0xB6, 0x76, 0x84, 0xBD, 0x2B, 0x76, 0x31,
-    0x23, 0x88, 0xB2, 0x5D, 0xD2, 0xDC, 0x15, 0x54, 0x78, 0x0C, 0x9C, 0xC4, 0xCD, 0xAA, 0x94, 0xA7,
-    0x22, 0x10, 0xD1, 0xBC, 0xC0, 0xD8, 0xCD, 0xEC, 0xCA, 0x10, 0xF6, 0xB0, 0x3F, 0xF0, 0x3D, 0xB0,
-    0x21, 0xF8, 0xE6, 0x13, 0x52, 0x69, 0x2D, 0xC0, 0x59, 0x80, 0xE7, 0x00, 0xDE, 0x01, 0xD8, 0xAC,
-    0x27, 0x43, 0xEF, 0x03, 0xAC, 0xAD, 0x75, 0x77, 0xB6, 0x49, 0x65, 0x26, 0x09, 0x1A, 0x76, 0xF7,
-    0xEC, 0xB8, 0x5E, 0x5D, 0x03, 0xD4, 0x3F, 0xFF, 0xF0, 0x54, 0x75, 0x03, 0x7C, 0xFD, 0x26, 0x80,
-    0x84, 0x77, 0x7F, 0x78, 0x24, 0xA5, 0x84, 0xBE, 0xD6, 0x01, 0x2B, 0x1D, 0xA8, 0xB8, 0xF9, 0xC1,
-    0x8C, 0x73, 0x2B, 0x23, 0x6B, 0x7A, 0xD8, 0xD5, 0x3B, 0x72, 0x8A, 0xCF, 0xA5, 0x1B, 0xA1, 0x4E,
-    0xA8, 0x22, 0xAC, 0x67, 0xE2, 0xF3, 0x7C, 0x1A, 0x06, 0xD5, 0x8C, 0x5B, 0x55, 0x69, 0xD8, 0x02,
-    0xAB, 0x37, 0x0F, 0x2A, 0x96, 0x52, 0xF8, 0xB2, 0x8D, 0x3B, 0xE9, 0xB2, 0xA1, 0x96, 0x7F, 0x32,
-    0x0A, 0xBD, 0x19, 0x18, 0xF7, 0x18, 0x05, 0xBD, 0xC5, 0x17, 0x92, 0x71, 0xAD, 0xB3, 0x95, 0x58,
-    0x09, 0x4F, 0x42, 0x70, 0xF7, 0x4B, 0xE7, 0xEE, 0xAD, 0xE3, 0xE9, 0xD6, 0x81, 0x1D, 0xD6, 0xB1,
-    0x78, 0xC2, 0xDD, 0x2B, 0xC7, 0xF8, 0xA1, 0x0B, 0x97, 0xDB, 0x35, 0x5B, 0xE1, 0x62, 0xE1, 0x5F,
-    0x6A, 0x9B, 0xC1, 0x0B, 0xDF, 0x09, 0xE5, 0xE7, 0x4E, 0xB2, 0x7D, 0x72, 0xF5, 0xE6, 0x32, 0xF7,
-    0x0F, 0x25, 0x22, 0x5C, 0x9C, 0x0F, 0xE4, 0xD6, 0x0F, 0x98, 0x71, 0x95, 0x06, 0xA2, 0xA2, 0x90,
-    0x25, 0xDA, 0xAA, 0x0D, 0x55, 0x64, 0x77, 0x6A, 0x63, 0xFB, 0x3D, 0x9D, 0x7E, 0xA7, 0xDC, 0x58,
-    0x3B, 0x3E, 0x63, 0xFA, 0x73, 0xE8, 0x4B, 0x0B, 0x97, 0x9A, 0x47, 0x31, 0x02, 0x9D, 0x1E, 0x04,
-    0x84, 0x3E, 0x1A, 0x74, 0x60, 0x86, 0x71, 0xE9, 0x7F, 0x1C, 0x28, 0x2B, 0x40, 0x89, 0xB9, 0xCE,
-    0x4A, 0x7B, 0x44, 0x42, 0x4D, 0xDF, 0xD7, 0x6B, 0x22, 0xDE, 0xA0, 0xBC, 0xD5, 0x05, 0xA5, 0x38,
-    0x9D, 0xB9, 0x15, 0x44, 0x85, 0x57, 0xA3, 0x0B, 0xE3, 0x06, 0x6D, 0x78, 0xEB, 0x2B, 0x58, 0x69,
-    0xE5, 0xAD, 0x54, 0x1B, 0xA9, 0x16, 0x41, 0x29, 0x51, 0x57, 0xC9, 0x1B, 0xC6, 0xDB, 0x18, 0x31,
-    0xFD, 0xD1, 0x18, 0x96, 0x5D, 0xDD, 0xD6, 0x97, 0xBB, 0x27, 0xE0, 0xB1, 0xD6, 0xC5, 0x6B, 0xC6,
-    0xAB, 0x1A, 0x55, 0x1E, 0xC6, 0xB4, 0xA9, 0x9B, 0x5F, 0x2D, 0x55, 0x99, 0x68, 0x68, 0x01, 0xD9,
-    0xCB, 0x2D, 0x70, 0x5D, 0x1C, 0xE5, 0x53, 0x42, 0x2C, 0xD6, 0x08, 0xE3, 0x66, 0x61, 0xDD, 0xBC,
-    0x2E, 0x07, 0x7C, 0xE4, 0x14, 0x99, 0x75, 0x7E, 0x66, 0x1C, 0x84, 0x0F, 0xE3, 0x6D, 0xF7, 0xAF,
-    0x8D, 0xDD, 0xFF, 0x09, 0xCA, 0xD5, 0x05, 0x5A, 0x9D, 0x64, 0xC3, 0xD6, 0xDC, 0x65, 0xE9, 0x4B,
-    0xAA, 0x69, 0x23, 0xCC, 0xB5, 0x2E, 0x44, 0x77, 0xE4, 0x00, 0xD5, 0x9E, 0xFD, 0x73, 0x28, 0xEB,
-    0xAB, 0xC8, 0x59, 0x57, 0xFF, 0x7C, 0x0F, 0x52, 0x2B, 0x71, 0x2E, 0xED, 0x2B, 0x68, 0x0B, 0x03,
-    0x0E, 0x9C, 0x2F, 0x0E, 0x86, 0x53, 0x7C, 0x92, 0x4D, 0xB2, 0x31, 0x97, 0x44, 0xBD, 0x36, 0x42,
-    0x4C, 0x3B, 0x32, 0x1E, 0xA4, 0x7E, 0xC8, 0xAD, 0xF9, 0xE8, 0x2F, 0x39, 0x30, 0xCA, 0xB8, 0x35,
-    0xEB, 0xE9, 0x3F, 0x1F, 0x8D, 0xC2, 0x3F, 0xB9, 0xB0, 0x7C, 0x3F, 0xC9, 0xB6, 0xA7, 0x0D, 0x67,
-    0x9A, 0xED, 0x5E, 0xDC, 0x13, 0x7F, 0x1B, 0xA7, 0xDB, 0x87, 0x7A, 0x49, 0x67, 0xD6, 0xC0, 0x6B,
-    0x41, 0xAA, 0xBF, 0xB4, 0xB4, 0xB5, 0x06, 0x03, 0x16, 0xF6, 0xFD, 0xC1, 0x61, 0xD4, 0x90, 0x76,
-    0xC4, 0x64, 0xCD, 0x9B, 0x64, 0x87, 0xEC, 0xB9, 0xCB, 0xC9, 0x88, 0x64, 0x23, 0x66, 0x0E, 0x82,
-    0x76, 0xB8, 0x76, 0x94, 0xA5, 0xF4, 0xB1, 0xE5, 0x91, 0x95, 0xC3, 0xB4, 0xE4, 0xCE, 0xAC, 0xD7,
-    0xFB, 0x0F, 0xE5, 0x7D, 0x4F, 0xAC, 0xDD, 0xD6, 0x79, 0xE7, 0xE1, 0xA5, 0xF5, 0x88, 0x31, 0x81,
-    0xD0, 0x8B, 0x28, 0x4D, 0xED, 0x99, 0x32, 0x8B, 0x2E, 0x5A, 0x2D, 0xC2, 0xED, 0x0C, 0xD0, 0x96,
-    0x74, 0x84, 0x8C, 0x17, 0x59, 0x48, 0x0B, 0x5D, 0x1B, 0xB5, 0x16, 0xEA, 0x66, 0x80, 0xD6, 0x05,
-    0xE6, 0xCD, 0x66, 0x80, 0x2E, 0xD2, 0x90, 0xB1, 0x17, 0x5A, 0x78, 0x21, 0x15, 0xB0, 0x33, 0xC0,
-    0xCC, 0x22, 0x5A, 0x38, 0x80, 0xF4, 0x0C, 0x8C, 0xBA, 0xE8, 0x22, 0x03, 0x24, 0xE1, 0xB5, 0x85,
-    0x81, 0x16, 0x5E, 0x88, 0xB6, 0xA2, 0x78, 0xE1, 0x85, 0x68, 0x5B, 0xAE, 0x1B, 0x69, 0x06, 0xA2,
-    0x6D, 0x2A, 0xA2, 0xDE, 0x23, 0x79, 0xE6, 0xFB, 0xFD, 0xBE, 0xC3, 0x7B, 0xEF, 0x7B, 0x7A, 0x92,
-    0x65, 0xD7, 0x4A, 0xD4, 0xCE, 0x93, 0xEE, 0xB9, 0xBC, 0xFC, 0x7B, 0xF8, 0x9D, 0xEF, 0x7C, 0xFF,
-    0xBF, 0xEF, 0x6C, 0x9C, 0x33, 0x26, 0x1A, 0xE4, 0xD3, 0xEB, 0x27, 0xEC, 0xE4, 0xD3, 0x18, 0xF7,
-    0x97, 0x5A, 0xDB, 0x59, 0x6B, 0x3F, 0x93, 0xCF, 0x25, 0xF9, 0xA4, 0xB7, 0xE6, 0xC7, 0xEC, 0xC2,
-    0xF8, 0x56, 0xCF, 0x4D, 0xE5, 0x3C, 0x7B, 0x65, 0x7E, 0x58, 0x8E, 0x1C, 0xB1, 0x76, 0x90, 0x93,
-    0x5B, 0x7B, 0x7D, 0xEB, 0xA5, 0xF5, 0xA3, 0x6B, 0x27, 0x5B, 0xDB, 0xAF, 0xDD, 0x0A, 0x77, 0x8F,
-    0x16, 0xA9, 0xB1, 0x2F, 0x8D, 0xFE, 0x18, 0x75, 0x61, 0x97, 0xD4, 0x8F, 0x67, 0x7F, 0xFC, 0xF0,
-    0x9F, 0x9B, 0xCB, 0xA7, 0x35, 0xB1, 0xB4, 0x83, 0x09, 0xA4, 0xB5, 0x99, 0x87, 0xB6, 0x32, 0x07,
-    0x4F, 0x8C, 0xF3, 0xA3, 0xC6, 0xCC, 0x6C, 0x86, 0x0E, 0x94, 0x15, 0xDA, 0xA4, 0x45, 0x1B, 0x0E,
-    0x68, 0x67, 0xF6, 0xF9, 0x3B, 0x38, 0x20, 0xB7, 0x93, 0x03, 0x72, 0xC9, 0xC2, 0x84, 0x16, 0x3F,
-    0x66, 0xF6, 0xA3, 0x4D, 0xB9, 0x48, 0xAE, 0xB0, 0x35, 0xAE, 0x88, 0x7B, 0x5C, 0x21, 0x8F, 0xC7,
-    0xAD, 0xE4, 0x2C, 0x39, 0x90, 0x37, 0x38, 0x90, 0x76, 0x72, 0xE0, 0x6B, 0xF2, 0xDC, 0x99, 0x3D,
-    0x0C, 0x00, 0x94, 0x15, 0xDA, 0xA4, 0x4D, 0x47, 0xDC, 0xDF, 0x3B, 0x86, 0xF6, 0x85, 0x33, 0x72,
-    0x65, 0x66, 0xD2, 0x56, 0x4E, 0x92, 0xFE, 0xCB, 0xAB, 0xFC, 0x62, 0x82, 0x89, 0x91, 0xA7, 0xED,
-    0xC8, 0xE7, 0xA6, 0x7C, 0xA4, 0x17, 0xA3, 0x40, 0xE0, 0xB9, 0x7B, 0xBC, 0xF2, 0x17, 0xFD, 0xA9,
-    0x7F, 0x5E, 0x69, 0x4F, 0x03, 0x32, 0x83, 0x11, 0x20, 0xF5, 0x00, 0x4B, 0xE7, 0xDB, 0x76, 0xA3,
-    0x89, 0xA4, 0x43, 0x4F, 0xC4, 0x00, 0x42, 0xD2, 0x63, 0x6C, 0xDA, 0x65, 0x03, 0xF0, 0xE5, 0xCB,
-    0x86, 0x3F, 0x79, 0x3B, 0x3D, 0x2A, 0x98, 0x04, 0x60, 0xC8, 0x63, 0x30, 0xDA, 0xA1, 0x40, 0xE7,
-    0x6F, 0x7C, 0xDC, 0xD4, 0xB0, 0x49, 0xD0, 0xCC, 0x00, 0x79, 0x73, 0xE0, 0xA8, 0x76, 0x60, 0xD3,
-    0x9E, 0x96, 0x13, 0x86, 0x48, 0x3E, 0x72, 0xB4, 0x4F, 0xBB, 0x8D, 0x0E, 0xB7, 0xCB, 0x6B, 0x03,
-    0x08, 0xF2, 0x86, 0x89, 0x2D, 0xE4, 0x76, 0x1D, 0x86, 0x4E, 0x80, 0x2B, 0xB7, 0x8C, 0xE5, 0x87,
-    0x27, 0x5D, 0x36, 0xB1, 0x40, 0x31, 0x90, 0x07, 0xF9, 0xF6, 0xA8, 0x7C, 0x7E, 0x6E, 0xA2, 0x11,
-    0x43, 0x25, 0x9F, 0x4E, 0x3E, 0xF5, 0x53, 0x56, 0x0E, 0x1F, 0x10, 0xC0, 0x7E, 0x68, 0xD3, 0xCF,
-    0x3E, 0xE7, 0xBF, 0xF4, 0xE4, 0xE7, 0xF1, 0xC9, 0xDE, 0x9E, 0xF8, 0x6C, 0x48, 0xDF, 0x6A, 0xFE,
-    0xF2, 0x71, 0x22, 0x04, 0xE0, 0x25, 0xE0, 0x92, 0xFE, 0xD8, 0xC5, 0x97, 0xDC, 0xC4, 0xC6, 0x57,
-    0xF5, 0x3F, 0xE9, 0x0E, 0x96, 0x6D, 0x6E, 0x9B, 0xDC, 0x56, 0xB9, 0x80, 0x5F, 0x20, 0x13, 0x13,
-    0x25, 0x0D, 0x91, 0xBA, 0x21, 0xBE, 0x12, 0x53, 0x89, 0xB1, 0x9C, 0x6D, 0xC9, 0xAD, 0x39, 0x4F,
-    0x08, 0x7B, 0x1D, 0xF3, 0x19, 0x7B, 0x06, 0xBC, 0x42, 0x27, 0x0D, 0x31, 0xC1, 0x5E, 0x7F, 0x4D,
-    0x86, 0xAB, 0xC3, 0xC8, 0xB6, 0xC6, 0x1F, 0x05, 0xD4, 0x56, 0x00, 0x6E, 0x0B, 0x1D, 0xB7, 0xB4,
-    0x96, 0x13, 0x4A, 0xB9, 0x4C, 0x70, 0xB9, 0xF1, 0x6C, 0xED, 0x0F, 0xEC, 0x8A, 0xA0, 0x4A, 0x26,
-    0x77, 0x10, 0xE0, 0xE7, 0x0B, 0xBC, 0xA6, 0x5D, 0x24, 0x0D, 0x6E, 0x96, 0x37, 0xDA, 0xD7, 0xB4,
-    0x0B, 0x2D, 0xB0, 0x3A, 0x1F, 0x74, 0xD0, 0x64, 0x3E, 0xCB, 0x59, 0xC0, 0x96, 0x48, 0x46, 0x1F,
-    0x8F, 0xF0, 0xE5, 0xDB, 0xC7, 0x13, 0x0E, 0x2C, 0x71, 0x9D, 0xD0, 0x22, 0x92, 0xA2, 0xB3, 0xD8,
-    0x46, 0xE7, 0x65, 0x9B, 0x7D, 0x7D, 0xD0, 0xC3, 0xF8, 0xDB, 0xCE, 0x22, 0x7E, 0xDB, 0x3A, 0xD5,
-    0xEF, 0x46, 0xBF, 0x84, 0x24, 0xCC, 0xE7, 0xF9, 0xAD, 0xE3, 0xF6, 0x6A, 0xAF, 0x30, 0x28, 0x79,
-    0x75, 0x60, 0xDD, 0x48, 0x59, 0xBD, 0x79, 0x6E, 0xD7, 0x0F, 0x7B, 0xF2, 0x12, 0x0B, 0xF6, 0x19,
-    0x78, 0x82, 0x1B, 0x1E, 0xE9, 0x39, 0x33, 0x1B, 0x3E, 0xDB, 0xDE, 0x31, 0x4A, 0x60, 0xEE, 0x6E,
-    0x1D, 0x7D, 0x51, 0x62, 0xB2, 0x5F, 0xFB, 0xE4, 0x6B, 0x86, 0x14, 0xA5, 0x60, 0xDB, 0x38, 0xEA,
-    0x12, 0x0A, 0xC4, 0x07, 0x9C, 0x13, 0x8D, 0x68, 0x43, 0xB6, 0x02, 0xEA, 0xCF, 0x6F, 0x47, 0xD7,
-    0x9A, 0x27, 0xCF, 0xCA, 0xFD, 0xF3, 0x56, 0xE1, 0x42, 0xBA, 0x62, 0x02, 0x0C, 0x7C, 0x58, 0x9B,
-    0xB5, 0x3F, 0x39, 0x16, 0x77, 0x18, 0x97, 0x06, 0x43, 0x58, 0xDB, 0x85, 0x67, 0x17, 0xC4, 0x0C,
-    0xBB, 0x10, 0xFE, 0x60, 0x17, 0x32, 0x93, 0xED, 0x82, 0x78, 0x2C, 0x83, 0x65, 0x7F, 0x85, 0x93,
-    0x00, 0x21, 0x8B, 0x89, 0xA5, 0x5B, 0x37, 0x38, 0xF6, 0x32, 0x27, 0xED, 0x22, 0xC7, 0x79, 0x29,
-    0xAE, 0x90, 0x6E, 0xDB, 0x45, 0x68, 0x33, 0xDC, 0x6A, 0xE1, 0xEE, 0x6C, 0xCA, 0x16, 0x0F, 0xEA,
-    0x01, 0xC9, 0xD1, 0x1C, 0x7A, 0xCD, 0xE8, 0xCC, 0xD5, 0x59, 0x0E, 0xB4, 0x03, 0x32, 0x82, 0x00,
-    0xCF, 0xBA, 0x3D, 0x3D, 0x8C, 0x6C, 0x0A, 0xC0, 0x5C, 0xEA, 0x05, 0xD6, 0x9F, 0x81, 0xC2, 0xF6,
-    0xEC, 0x87, 0xEC, 0x2C, 0xB1, 0x33, 0xC5, 0xCE, 0xF4, 0x86, 0xEC, 0x8C, 0x3F, 0x95, 0x9D, 0x51,
-    0x57, 0x5E, 0xEA, 0x83, 0x5E, 0xA6, 0xB4, 0xB0, 0x98, 0xDE, 0xBE, 0x21, 0x78, 0x26, 0x6F, 0x57,
-    0xC8, 0x99, 0xF9, 0x02, 0x53, 0xBD, 0x96, 0x9D, 0x57, 0x1B, 0xD9, 0x09, 0x9A, 0x74, 0x49, 0x80,
-    0x2D, 0x3B, 0x05, 0xE7, 0x85, 0x5D, 0x18, 0xEC, 0x2C, 0xB0, 0x73, 0x81, 0x9D, 0xB5, 0x9B, 0x29,
-    0x00, 0x9C, 0x87, 0x71, 0xAF, 0x65, 0x2A, 0xCC, 0xEC, 0x4D, 0xF0, 0x4C, 0xE0, 0xB4, 0x4C, 0xBE,
-    0x62, 0xBD, 0xA7, 0xA0, 0x58, 0xE5, 0x65, 0x39, 0x10, 0xF5, 0x09, 0xC8, 0x53, 0x41, 0xB8, 0x82,
-    0x2B, 0x8C, 0x78, 0xC7, 0x52, 0x60, 0x91, 0xC9, 0x1D, 0xE3, 0xCE, 0x23, 0x8B, 0x90, 0xEE, 0x07,
-    0x03, 0x5E, 0x3B, 0x6D, 0xCA, 0x85, 0x9C, 0x7E, 0xA4, 0x03, 0x4F, 0xC6, 0x7D, 0x4B, 0x4C, 0x65,
-    0xDF, 0x92, 0xF6, 0x72, 0xF2, 0xDA, 0x8E, 0xA4, 0x94, 0xE0, 0xC0, 0xF0, 0xE5, 0xCB, 0x2E, 0x80,
-    0x18, 0x92, 0x34, 0xCA, 0x26, 0x31, 0xEA, 0x98, 0x83, 0x59, 0x00, 0x8C, 0x0D, 0xC7, 0x87, 0xD8,
-    0x58, 0x70, 0xA3, 0xDD, 0x8D, 0xA2, 0xD9, 0x7E, 0x8D, 0x29, 0x39, 0xA8, 0xA4, 0x4D, 0x24, 0xDC,
-    0x98, 0x36, 0x1C, 0x76, 0x72, 0x89, 0x1E, 0x90, 0x8C, 0x30, 0xAC, 0x42, 0x87, 0x04, 0x1A, 0xE0,
-    0x8F, 0x35, 0x20, 0xA3, 0x9C, 0x00, 0x1C, 0xB9, 0xAC, 0xE2, 0x0E, 0x6F, 0x26, 0x10, 0x14, 0xD0,
-    0x86, 0x03, 0x49, 0xDD, 0xA8, 0xB3, 0xDD, 0xF1, 0x74, 0xCC, 0x1D, 0xE0, 0xDE, 0xFC, 0x59, 0x22,
-    0xAE, 0xB1, 0x15, 0x98, 0x47, 0xD9, 0x80, 0x31, 0xE5, 0x8D, 0x32, 0x13, 0xC0, 0x2B, 0x81, 0x68,
-    0x00, 0x86, 0x63, 0xAB, 0xD5, 0xC6, 0x95, 0xF9, 0x31, 0x0E, 0x37, 0xFB, 0xB0, 0xDC, 0x18, 0xB7,
-    0x4E, 0x03, 0xCF, 0x6B, 0x9C, 0xB3, 0xC0, 0xED, 0xA3, 0xE1, 0x79, 0x91, 0x3B, 0x64, 0x28, 0x05,
-    0xF1, 0x62, 0xE2, 0xA1, 0xDB, 0x98, 0xC9, 0x86, 0x47, 0xF9, 0xC5, 0x4E, 0x77, 0x16, 0x1E, 0x6A,
-    0xAF, 0x09, 0x7A, 0x6E, 0x1F, 0xC5, 0x3D, 0x5A, 0x92, 0x53, 0x1C, 0x6B, 0xD3, 0x66, 0x43, 0xE8,
-    0x91, 0x5C, 0x72, 0x01, 0x5D, 0x07, 0x4E, 0xF4, 0x98, 0x63, 0xB5, 0xBD, 0x72, 0xC2, 0xFA, 0xEE,
-    0x71, 0xA3, 0x32, 0x5A, 0x7B, 0xFD, 0xBC, 0xC8, 0x0D, 0x32, 0xF8, 0x20, 0x4E, 0x83, 0x9C, 0x95,
-    0x62, 0xBA, 0xDA, 0x0F, 0x81, 0xAC, 0x42, 0x84, 0xF2, 0x1E, 0x67, 0xD5, 0x96, 0xE4, 0x54, 0x2F,
-    0xFC, 0xA7, 0x87, 0x29, 0x32, 0x84, 0xA4, 0x6A, 0x24, 0xE7, 0x19, 0x09, 0xE2, 0xEA, 0xC7, 0x30,
-    0x07, 0xB5, 0xB1, 0x05, 0x04, 0x20, 0x61, 0x26, 0xC9, 0x5D, 0x3F, 0x32, 0xFE, 0x68, 0xF1, 0xC3,
-    0xD3, 0x1F, 0x31, 0x25, 0xA4, 0x99, 0x0A, 0x4D, 0x09, 0x7F, 0x38, 0x09, 0x2A, 0xA5, 0x50, 0xC5,
-    0x51, 0xA6, 0x38, 0xA5, 0x82, 0x94, 0x4C, 0xA0, 0x92, 0x44, 0xFC, 0x06, 0xDB, 0x71, 0xF7, 0x0F,
-    0xCC, 0x94, 0xFC, 0x06, 0x86, 0x2E, 0xD8, 0xEF, 0x47, 0xFD, 0xF0, 0xC4, 0x4B, 0x74, 0xB5, 0x97,
-    0x07, 0xF9, 0x18, 0x15, 0x32, 0x3D, 0x50, 0xC2, 0x99, 0x2D, 0x84, 0x86, 0xAA, 0x10, 0x40, 0xBC,
-    0x15, 0x12, 0x1A, 0x8B, 0x70, 0x65, 0xCA, 0x1A, 0xE7, 0x90, 0x02, 0x10, 0xC5, 0x81, 0x9F, 0xA1,
-    0xD0, 0xAA, 0x98, 0xD3, 0xF8, 0x63, 0xFB, 0x63, 0x15, 0x9F, 0xEC, 0x34, 0x4F, 0x38, 0x53, 0x28,
-    0xB0, 0x62, 0xF2, 0x63, 0x6C, 0x71, 0x42, 0xD9, 0x08, 0xFA, 0x2C, 0x40, 0xE3, 0xE5, 0x0E, 0x1D,
-    0x70, 0x3B, 0xEA, 0x41, 0x23, 0x92, 0x1E, 0xE4, 0xBB, 0x31, 0x4A, 0xBF, 0x07, 0xC8, 0x61, 0x69,
-    0x33, 0xB3, 0x8B, 0x40, 0x65, 0x12, 0xE9, 0x40, 0x41, 0x86, 0x77, 0x98, 0xDD, 0x32, 0xE5, 0x27,
-    0xD2, 0x2D, 0xE9, 0x49, 0x34, 0x4E, 0xD2, 0x20, 0x26, 0x93, 0x47, 0xE6, 0x26, 0x4D, 0x58, 0x05,
-    0xE4, 0xB1, 0xAD, 0xB2, 0x2C, 0x4C, 0x66, 0x61, 0x11, 0x07, 0x9E, 0x05, 0x79, 0xC7, 0x2B, 0x42,
-    0x06, 0x96, 0x7E, 0x3E, 0x59, 0x72, 0x62, 0xF1, 0x8C, 0xC5, 0x8A, 0x3D, 0x87, 0xF6, 0xBF, 0xCA,
-    0xE7, 0xC7, 0x72, 0x9F, 0x8B, 0xF2, 0x79, 0x1B, 0xF3, 0x22, 0xC6, 0x25, 0xDE, 0xD1, 0x47, 0x83,
-    0xB0, 0xE7, 0x8B, 0x44, 0x7E, 0xB4, 0x51, 0xEB, 0xE8, 0x7A, 0x6A, 0xF9, 0x06, 0x8F, 0x10, 0x03,
-    0xFA, 0x9D, 0x31, 0x68, 0x48, 0x96, 0xB5, 0xD2, 0xD8, 0x64, 0xB5, 0x29, 0x93, 0xA6, 0xAC, 0xE5,
-    0xE9, 0x22, 0x91, 0xE0, 0xED, 0xA7, 0xCD, 0x1A, 0x9B, 0xE3, 0x7E, 0x9B, 0x01, 0xA5, 0x97, 0xBC,
-    0x5A, 0x6E, 0xCA, 0x64, 0x2C, 0x6B, 0x99, 0x2D, 0xE1, 0x48, 0xEC, 0xAB, 0x85, 0x55, 0x82, 0x99,
-    0x08, 0x1A, 0xDD, 0x84, 0xF8, 0x33, 0x62, 0x04, 0x64, 0x33, 0x93, 0x4D, 0x95, 0x0B, 0x81, 0xEC,
-    0x81, 0xBD, 0x0A, 0x95, 0xC1, 0x0E, 0x78, 0xAD, 0x48, 0x7E, 0x34, 0x32, 0x08, 0x03, 0x65, 0x35,
-    0xF9, 0x01, 0xC2, 0x30, 0x58, 0xDC, 0xB8, 0xBC, 0x7A, 0x5B, 0xC8, 0xE4, 0xED, 0xC1, 0x6E, 0x0A,
-    0x30, 0xD2, 0xAB, 0xB7, 0xE4, 0x35, 0x2E, 0x0F, 0xF6, 0x48, 0xE3, 0xF7, 0xE9, 0xD5, 0x56, 0xD4,
-    0x94, 0x8B, 0x83, 0x7D, 0xA6, 0x0B, 0xDA, 0xFC, 0x6A, 0x97, 0x2E, 0xAC, 0xB0, 0xC8, 0x97, 0x86,
-    0xA8, 0x91, 0x1F, 0xC9, 0xFB, 0xA3, 0xFC, 0x28, 0x6C, 0xBA, 0x90, 0x1F, 0xD1, 0xED, 0x1E, 0x3F,
-    0x4A, 0x5B, 0xC8, 0x8F, 0xC0, 0x36, 0xF8, 0x91, 0x8A, 0x94, 0x7B, 0xB5, 0x9B, 0xD9, 0x1A, 0x3F,
-    0x04, 0xE4, 0xF2, 0x43, 0x7A, 0x4F, 0x1E, 0x1B, 0x8C, 0x0F, 0xDC, 0x5C, 0x99, 0x1F, 0xBF, 0x8B,
-    0x6D, 0x5E, 0xDF, 0x3A, 0x3F, 0x7E, 0xB1, 0xBB, 0x2C, 0x28, 0xDE, 0x4D, 0xBA, 0x1B, 0xC5, 0x10,
-    0x50, 0xE1, 0x52, 0xF9, 0x2F, 0x44, 0xC9, 0xC0, 0x5E, 0x0B, 0x6D, 0x05, 0xFD, 0xCB, 0x36, 0xD0,
-    0xE0, 0xF2, 0x16, 0x2A, 0x5C, 0xDA, 0x61, 0x12, 0x27, 0xE0, 0x34, 0xCA, 0x6F, 0x04, 0xBB, 0xF2,
-    0xB5, 0x36, 0x5D, 0xB6, 0x72, 0x94, 0x67, 0xEA, 0x55, 0xE0, 0xA4, 0x79, 0xAB, 0x77, 0x0B, 0xAC,
-    0x90, 0x83, 0x8A, 0x24, 0xA9, 0x30, 0x4A, 0x98, 0xA8, 0xD1, 0xE1, 0xC1, 0x90, 0x85, 0xBC, 0x4C,
-    0xD9, 0xC1, 0xB0, 0xB7, 0xB9, 0x32, 0x3F, 0x41, 0x81, 0xE4, 0x21, 0x36, 0xA9, 0x88, 0xE1, 0xBE,
-    0xD3, 0x48, 0x07, 0x9F, 0x6C, 0xF6, 0xD6, 0xA6, 0x15, 0x02, 0xCE, 0x57, 0x06, 0xAB, 0x25, 0xFF,
-    0xB4, 0x97, 0x2D, 0x5F, 0xD3, 0x97, 0x3D, 0x5B, 0x72, 0x8E, 0xE3, 0x9C, 0x0B, 0xD9, 0x10, 0x6C,
-    0x16, 0x76, 0x9F, 0x36, 0xAA, 0x62, 0xDC, 0x6F, 0x63, 0xB7, 0xEA, 0xDC, 0xD3, 0x3E, 0x00, 0xD8,
-    0xB7, 0xC1, 0xA4, 0x3A, 0x53, 0x33, 0x75, 0xAA, 0x73, 0xB7, 0x54, 0x8E, 0x9B, 0x49, 0xDC, 0x65,
-    0x93, 0xAE, 0x1A, 0x1E, 0xC5, 0xC9, 0xD4, 0xB8, 0x79, 0x83, 0x50, 0x64, 0x87, 0x7F, 0xE0, 0x7B,
-    0x50, 0x7A, 0x00, 0xA0, 0xDB, 0x95, 0xEA, 0x0C, 0xF5, 0xE2, 0x16, 0x60, 0xFB, 0x31, 0x1A, 0x50,
-    0xD8, 0xF1, 0xE0, 0x73, 0xF6, 0xD5, 0x63, 0x4A, 0xDA, 0x78, 0x53, 0x10, 0x62, 0xF6, 0xF6, 0xAB,
-    0xD9, 0xF5, 0xE8, 0x88, 0xB7, 0xAB, 0x01, 0x50, 0xB3, 0x8D, 0xFB, 0xDA, 0x90, 0xD1, 0x50, 0x4D,
-    0x58, 0x40, 0x94, 0x93, 0x7D, 0x72, 0x3E, 0x88, 0xB4, 0x68, 0xB7, 0xED, 0x79, 0x08, 0x47, 0x4F,
-    0x0B, 0xC5, 0x6B, 0xA8, 0xBA, 0x62, 0x36, 0x78, 0xE8, 0x30, 0x74, 0xDA, 0x7B, 0x7E, 0xE1, 0x94,
-    0xB8, 0x77, 0x17, 0xE0, 0xF2, 0xA7, 0x31, 0x07, 0x76, 0x26, 0x7A, 0x08, 0xA4, 0xD7, 0x07, 0xC9,
-    0xC3, 0x2D, 0x1F, 0x3F, 0x53, 0x9D, 0x60, 0x77, 0xCF, 0xCC, 0xDC, 0xC1, 0xD1, 0x56, 0x25, 0x18,
-    0x89, 0x21, 0xCB, 0xF5, 0x28, 0x22, 0xCC, 0x48, 0x50, 0x7C, 0xEE, 0x0B, 0x2C, 0xA6, 0x36, 0xD1,
-    0x54, 0x48, 0x30, 0xAE, 0x4D, 0xC8, 0xEA, 0x53, 0x82, 0x29, 0x1F, 0xCD, 0xC4, 0x9C, 0x22, 0x2A,
-    0xFB, 0x54, 0xF9, 0x85, 0x62, 0x52, 0x52, 0xA6, 0x74, 0xF2, 0x1D, 0xB0, 0x0B, 0xE1, 0xFF, 0x85,
-    0x21, 0xBF, 0x87, 0xDE, 0x68, 0x31, 0x38, 0xD1, 0x08, 0xFB, 0x52, 0x8C, 0x81, 0x53, 0x02, 0x1F,
-    0x0E, 0x3E, 0xAD, 0x50, 0x18, 0xE1, 0xB2, 0x4A, 0x41, 0x4E, 0xB3, 0x87, 0xB6, 0x1B, 0xC2, 0x8E,
-    0x75, 0x42, 0xA9, 0x8A, 0xA5, 0x14, 0x4C, 0xC9, 0xA3, 0x04, 0xE3, 0xBB, 0x49, 0x79, 0x02, 0x52,
-    0x51, 0x60, 0xD3, 0xDD, 0x65, 0xA5, 0x40, 0x48, 0x77, 0x04, 0xBE, 0xF6, 0x26, 0x64, 0xC3, 0x7B,
-    0xEE, 0x2A, 0x4C, 0x7A, 0x1B, 0x68, 0x77, 0xC9, 0xFE, 0xA4, 0xB4, 0xE0, 0x57, 0x94, 0x8B, 0x1B,
-    0x5A, 0xEC, 0x36, 0xB6, 0x0E, 0x3F, 0x20, 0xCA, 0x43, 0xEA, 0x6C, 0x94, 0xDF, 0xC2, 0x7E, 0x47,
-    0x56, 0x9F, 0x79, 0x60, 0xF1, 0x54, 0xB0, 0xD3, 0x46, 0x2D, 0x7D, 0xBF, 0xD5, 0xC3, 0x83, 0x50,
-    0xCE, 0xF9, 0x71, 0xEB, 0xAC, 0x18, 0xFD, 0xD2, 0x8A, 0xA1, 0x7F, 0x97, 0xDC, 0xB7, 0xF6, 0x3C,
-    0x69, 0x55, 0x02, 0x9D, 0xD1, 0x22, 0x97, 0x3E, 0x72, 0x3B, 0x32, 0x1F, 0xAC, 0x54, 0xFF, 0x3E,
-    0x74, 0xDF, 0xE3, 0x5D, 0x3B, 0xD6, 0xD4, 0x69, 0xB3, 0x44, 0x87, 0xFB, 0xED, 0xF0, 0x8E, 0xE5,
-    0xBC, 0xEA, 0xEE, 0xF6, 0xE0, 0xF1, 0x71, 0x75, 0xC5, 0xAE, 0xD6, 0xCE, 0x33, 0xD2, 0x8A, 0x71,
-    0xA2, 0x18, 0x6A, 0x41, 0x0B, 0xEC, 0xEB, 0x16, 0x92, 0x3C, 0x28, 0xB7, 0xB4, 0x91, 0x5A, 0x54,
-    0xC6, 0xBD, 0x2D, 0xF7, 0x7B, 0x65, 0xCF, 0xAB, 0xBA, 0xE5, 0xB5, 0xA0, 0x07, 0x01, 0x74, 0x3E,
-    0xA0, 0x93, 0x07, 0xDB, 0x91, 0x74, 0xE4, 0x26, 0xC9, 0xFA, 0x0E, 0x0D, 0x30, 0xE3, 0xBD, 0x0F,
-    0x5C, 0x7F, 0x05, 0x07, 0x68, 0x39, 0xC2, 0x0C, 0x29, 0x62, 0xCC, 0x96, 0x0E, 0x07, 0x4A, 0x8B,
-    0x2B, 0x3C, 0x5B, 0xE1, 0x8A, 0xA4, 0xC3, 0x15, 0x20, 0x14, 0x10, 0x05, 0xDF, 0xC0, 0xAD, 0xCA,
-    0x06, 0x07, 0x52, 0x1C, 0xF0, 0xCA, 0x21, 0xA0, 0x60, 0xC1, 0x5B, 0x59, 0xDE, 0x6A, 0xC4, 0x33,
-    0xD0, 0xC9, 0x71, 0xAB, 0x58, 0x49, 0xE6, 0x93, 0xC5, 0x6C, 0xCF, 0x8E, 0x2B, 0xC7, 0xA0, 0xDB,
-    0x5C, 0x83, 0xF2, 0xF1, 0x12, 0x9E, 0x6F, 0xAF, 0x43, 0xCC, 0xF5, 0x20, 0x1C, 0x27, 0x94, 0x4F,
-    0x29, 0x60, 0xAA, 0x7D, 0x2C, 0xC5, 0x03, 0x06, 0xB5, 0xEC, 0xA9, 0xD2, 0x4B, 0x53, 0x18, 0xFF,
-    0x42, 0xD9, 0x00, 0x3C, 0xB2, 0x78, 0x69, 0x23, 0xFE, 0x41, 0xB6, 0x69, 0x4D, 0xA6, 0x7A, 0x46,
-    0xBC, 0x34, 0x29, 0xE7, 0xF5, 0x81, 0xF9, 0xDC, 0x2E, 0xD0, 0x5B, 0xDA, 0x2E, 0xC3, 0xE5, 0xB4,
-    0x75, 0xE6, 0xA1, 0x84, 0xC4, 0xBF, 0x72, 0xBF, 0xD2, 0xFE, 0x3F, 0xC8, 0xBD, 0xA1, 0x5C, 0x8F,
-    0x93, 0xBE, 0x3B, 0x98, 0xA7, 0x28, 0x7C, 0x1C, 0x5C, 0xF1, 0x05, 0xBC, 0x4F, 0x4E, 0x22, 0x08,
-    0xF2, 0x5C, 0x44, 0xEC, 0xBC, 0x25, 0x4D, 0x84, 0x0A, 0x2E, 0x02, 0xB0, 0x30, 0xEA, 0xCA, 0x2E,
-    0x12, 0x18, 0xFC, 0xA2, 0x5E, 0x0D, 0x8A, 0x14, 0x8F, 0x7D, 0x7B, 0xAA, 0x87, 0x9E, 0x23, 0x34,
-    0xE0, 0x8A, 0x3C, 0xD4, 0xC3, 0x04, 0xA3, 0x8F, 0x44, 0x7B, 0xB4, 0xFA, 0x79, 0x5D, 0x7F, 0xEA,
-    0xC9, 0x32, 0x69, 0x4B, 0x9E, 0xDC, 0x03, 0xBB, 0x92, 0x8E, 0xDC, 0x0F, 0xFA, 0x39, 0x94, 0x21,
-    0x68, 0xFA, 0xD0, 0xC1, 0x86, 0x88, 0x72, 0x02, 0xC4, 0xED, 0x19, 0x8D, 0x03, 0x30, 0xF3, 0x41,
-    0x05, 0x58, 0x10, 0x5A, 0x44, 0x64, 0x9A, 0xC4, 0xFF, 0xDA, 0x52, 0xFA, 0x1E, 0xD1, 0xF7, 0xD1,
-    0xD3, 0x57, 0xBD, 0x75, 0x5C, 0x9A, 0x22, 0x18, 0x05, 0x08, 0xAE, 0xF1, 0xB5, 0xC9, 0x82, 0x71,
-    0x26, 0x42, 0xD9, 0x68, 0xEC, 0x74, 0x05, 0xEE, 0x4A, 0xBB, 0x88, 0xA0, 0xE9, 0x28, 0x07, 0x62,
-    0x74, 0x2A, 0x6D, 0xA5, 0x29, 0x1B, 0x41, 0x5A, 0x01, 0x82, 0xDE, 0x2A, 0xC4, 0x0D, 0x62, 0x20,
-    0x72, 0x0A, 0xE4, 0x30, 0x07, 0x7E, 0x02, 0x1D, 0xB3, 0xF3, 0x9C, 0x30, 0xD4, 0x05, 0xD7, 0x9E,
-    0xB2, 0x0E, 0xF4, 0xD0, 0xD8, 0x8F, 0x0B, 0xBE, 0x5B, 0xFB, 0xA2, 0x1C, 0xFD, 0x40, 0x74, 0xED,
-    0x3B, 0x78, 0x66, 0x59, 0x7B, 0xF6, 0x7C, 0x6B, 0xCA, 0x1B, 0xF2, 0xE0, 0x3B, 0xF6, 0xA3, 0x92,
-    0x53, 0xF9, 0xA4, 0xA8, 0xC3, 0x75, 0x3E, 0xFA, 0x9D, 0x51, 0xFB, 0xFE, 0xF3, 0x19, 0x44, 0x75,
-    0xDE, 0x1A, 0xA3, 0x40, 0xBE, 0x59, 0xC4, 0x32, 0x47, 0xC8, 0xEB, 0x39, 0x1B, 0x93, 0xE6, 0x80,
-    0x90, 0xEE, 0x93, 0x30, 0x2D, 0x8B, 0x6C, 0x00, 0x6C, 0x6D, 0x72, 0x99, 0x87, 0x6F, 0x5B, 0x11,
-    0xD2, 0x2E, 0x82, 0x68, 0xC4, 0xB0, 0x7D, 0xC0, 0x9D, 0x72, 0x0B, 0xD4, 0xF1, 0x32, 0x08, 0xCB,
-    0x11, 0x18, 0x99, 0x61, 0x15, 0x68, 0x72, 0x39, 0xAB, 0xB0, 0xDB, 0x32, 0x19, 0x31, 0x8F, 0x3D,
-    0x72, 0xE3, 0x12, 0x08, 0x71, 0x40, 0x79, 0x2F, 0x9E, 0x7A, 0x0D, 0x68, 0xF5, 0x26, 0x06, 0xBF,
-    0xFC, 0xE8, 0x04, 0xD4, 0x75, 0xFB, 0x96, 0x68, 0xE6, 0x9F, 0xDA, 0x22, 0x69, 0xE1, 0x2B, 0x80,
-    0x68, 0xA5, 0x67, 0xBC, 0xBA, 0xD9, 0x97, 0x22, 0xDF, 0x6E, 0xE2, 0xAD, 0xE4, 0x8C, 0xDF, 0xD8,
-    0x57, 0x4B, 0x78, 0x13, 0x46, 0x39, 0x63, 0xE4, 0x68, 0xA9, 0x84, 0xD1, 0xE7, 0xD4, 0x68, 0xFB,
-    0x7C, 0x7B, 0xEB, 0xE4, 0x48, 0x42, 0x14, 0x3C, 0xF0, 0x97, 0x59, 0xF6, 0x6A, 0xA0, 0x39, 0x25,
-    0x9B, 0x91, 0xFE, 0x94, 0xD7, 0x4B, 0x91, 0xF1, 0x20, 0x4F, 0x85, 0xA2, 0x68, 0x64, 0x22, 0x39,
-    0xC1, 0xB7, 0x54, 0xE0, 0x15, 0x6B, 0x18, 0x82, 0x5B, 0xEC, 0x1C, 0x64, 0xA7, 0x67, 0x31, 0x1E,
-    0xA2, 0xBD, 0x0D, 0xA2, 0x56, 0xCD, 0x84, 0xE5, 0x4F, 0xCA, 0xC4, 0xAE, 0x3F, 0x8A, 0xE4, 0x0B,
-    0x27, 0x6C, 0x51, 0x8A, 0x08, 0xC7, 0x2D, 0xC1, 0xB0, 0x2D, 0xE3, 0xFD, 0x04, 0xAF, 0x40, 0x5D,
-    0x81, 0x08, 0x29, 0x2A, 0x02, 0x8C, 0x01, 0x59, 0x04, 0xB7, 0x4B, 0x79, 0x51, 0xA4, 0x06, 0xBC,
-    0xB1, 0x7D, 0xCB, 0xAA, 0x23, 0xC5, 0xBE, 0x35, 0x3A, 0x52, 0xAB, 0x22, 0x70, 0x6F, 0x36, 0x8C,
-    0x1D, 0x5F, 0x6F, 0x30, 0x95, 0x80, 0xA6, 0x32, 0x2A, 0xC0, 0xDE, 0xC9, 0x9B, 0x43, 0x33, 0x41,
-    0x5A, 0x53, 0x3C, 0x8C, 0x80, 0xDC, 0x71, 0xE7, 0x8F, 0x34, 0x86, 0x64, 0xA2, 0x50, 0xD5, 0xB0,
-    0x77, 0xD4, 0x10, 0x0D, 0x47, 0x3E, 0x0E, 0x83, 0x09, 0xDB, 0x50, 0xA4, 0x6E, 0x0B, 0xCF, 0xD9,
-    0x3C, 0xAC, 0xCE, 0xB6, 0x72, 0xC7, 0xC2, 0x6C, 0x98, 0x37, 0x42, 0x8B, 0xE0, 0x1D, 0x4B, 0x6B,
-    0xA1, 0x76, 0x49, 0x1F, 0x75, 0x50, 0x4F, 0x7B, 0x5F, 0x70, 0xB9, 0x82, 0x0E, 0x5C, 0xC8, 0x2E,
-    0x99, 0x5F, 0x22, 0xBD, 0x9F, 0xB4, 0x30, 0x36, 0xE5, 0xAD, 0x79, 0xFE, 0xA8, 0x20, 0x2B, 0x68,
-    0x09, 0x8C, 0x7B, 0xFD, 0x9F, 0x65, 0x39, 0x0D, 0x88, 0xB4, 0x5E, 0x24, 0x9D, 0x0F, 0x92, 0x20,
-    0x74, 0x16, 0xCA, 0xFE, 0x7C, 0xB3, 0x57, 0x09, 0x84, 0xBE, 0xB7, 0x9B, 0x5B, 0x25, 0x6C, 0x4A,
-    0x9F, 0xCA, 0xE3, 0xFF, 0x23, 0x44, 0x4F, 0x87, 0x41, 0x98, 0x44, 0x36, 0x97, 0xFB, 0xDF, 0xC6,
-    0x0C, 0xCB, 0x85, 0xE8, 0xDC, 0xC6, 0xBC, 0x84, 0x45, 0xE9, 0xF6, 0x18, 0xEC, 0xD8, 0xBC, 0xB2,
-    0xE9, 0xED, 0x21, 0xB9, 0x6C, 0xF3, 0xCB, 0xBD, 0x6C, 0x94, 0x87, 0x6D, 0x7E, 0xB5, 0x11, 0x79,
-    0x44, 0xE4, 0x20, 0xA1, 0x42, 0xB2, 0x21, 0x18, 0x2A, 0xC2, 0x9B, 0x6C, 0x88, 0x8C, 0x9C, 0x77,
-    0x30, 0xC7, 0x9C, 0x9D, 0x9D, 0x33, 0x69, 0x95, 0xCA, 0xF8, 0x7D, 0x8F, 0x4E, 0x07, 0xC8, 0x91,
-    0x02, 0xE2, 0xCD, 0x33, 0xEB, 0xE6, 0x64, 0x0F, 0x0F, 0x4C, 0xE5, 0x39, 0x01, 0x36, 0xF0, 0xC0,
-    0x58, 0x36, 0x7C, 0x6C, 0xE4, 0xE5, 0xED, 0x21, 0xFA, 0xCC, 0xE6, 0xEF, 0x0C, 0xF2, 0xC0, 0xF4,
-    0x82, 0xCD, 0xDF, 0x6B, 0x65, 0xC3, 0xE2, 0x81, 0x95, 0x3C, 0xA7, 0xC3, 0x06, 0x1E, 0x28, 0x9D,
-    0x16, 0x69, 0x5A, 0x36, 0x0A, 0xD5, 0x5B, 0x3C, 0x6C, 0x3C, 0x33, 0x82, 0x8D, 0x60, 0x70, 0xE4,
-    0x5D, 0x44, 0xB6, 0x2D, 0x4A, 0x99, 0xCC, 0x78, 0xC9, 0x2E, 0x07, 0x65, 0xA7, 0x73, 0x94, 0xAC,
-    0x4D, 0xE4, 0x91, 0x11, 0xC4, 0xBE, 0xB6, 0x0D, 0x06, 0xB4, 0x26, 0xF9, 0x80, 0x09, 0x6B, 0x01,
-    0x68, 0xFC, 0x10, 0x9A, 0xE6, 0x33, 0xA3, 0x93, 0xDC, 0xD5, 0x52, 0x55, 0x45, 0x93, 0x06, 0x06,
-    0xA7, 0x51, 0x4B, 0x84, 0x25, 0xEA, 0xA6, 0x95, 0xE0, 0x85, 0xCD, 0x92, 0x36, 0xE8, 0x61, 0xCA,
-    0x6D, 0x64, 0x57, 0x2E, 0x28, 0x3C, 0xB3, 0x2A, 0x28, 0x96, 0x55, 0x2E, 0x94, 0x21, 0xB7, 0x99,
-    0x28, 0x73, 0x42, 0xAD, 0xA5, 0xE3, 0xA6, 0xBC, 0x3A, 0x4C, 0x7E, 0x59, 0x07, 0x10, 0xA8, 0xA0,
-    0x32, 0xF3, 0x32, 0xB6, 0x22, 0x38, 0x4B, 0x2B, 0x00, 0x95, 0xB6, 0x42, 0x7B, 0xB3, 0x0E, 0x77,
-    0x7A, 0x01, 0xBC, 0xE8, 0xEF, 0x02, 0x8D, 0xF8, 0xE3, 0x5E, 0x46, 0x23, 0xB9, 0x88, 0x36, 0x95,
-    0xF6, 0x9D, 0x21, 0x7F, 0xA6, 0x97, 0x81, 0x2A, 0x03, 0xB4, 0x16, 0x6D, 0x3E, 0xA0, 0x4D, 0x7B,
-    0xB6, 0x1D, 0xDA, 0xB8, 0x45, 0x1B, 0x35, 0x74, 0x94, 0x90, 0xCF, 0xF7, 0x82, 0xB2, 0xF6, 0xE2,
-    0x3D, 0x36, 0x9C, 0x59, 0xCB, 0x6D, 0x6C, 0x9D, 0xBF, 0xEF, 0xC9, 0xB0, 0xBF, 0x18, 0xEF, 0x3F,
-    0x11, 0xC9, 0x0B, 0xCC, 0xFE, 0x8A, 0xF3, 0x3E, 0x1E, 0x9F, 0x83, 0x71, 0xC6, 0x87, 0x91, 0x37,
-    0xB0, 0x32, 0x28, 0x3C, 0x15, 0xA4, 0xC9, 0xD8, 0xF7, 0x40, 0xC6, 0x75, 0x57, 0x43, 0x06, 0xE5,
-    0x09, 0xFD, 0x2D, 0x22, 0x41, 0xAB, 0x7F, 0xB4, 0x3A, 0xFF, 0x02, 0xAB, 0x96, 0x10, 0xB3, 0x64,
-    0x7F, 0xE0, 0xB7, 0xB7, 0x27, 0xBD, 0x5B, 0xC8, 0x93, 0xBD, 0x2A, 0xF8, 0x76, 0x1B, 0x12, 0x0B,
-    0x46, 0x1E, 0xBD, 0x78, 0xF0, 0x1D, 0x02, 0x85, 0xDF, 0xCF, 0x82, 0x3E, 0x91, 0xA1, 0xBA, 0x64,
-    0x07, 0x0A, 0x39, 0xB9, 0x3D, 0x2E, 0xB3, 0x4C, 0x34, 0x16, 0x98, 0x92, 0xDE, 0x85, 0x86, 0x21,
-    0x17, 0xE4, 0x1F, 0x43, 0x28, 0x72, 0x1B, 0xB2, 0x47, 0xC8, 0xC8, 0xBB, 0xD0, 0xB6, 0x73, 0xE1,
-    0x7F, 0x17, 0x85, 0x36, 0x75, 0x00, 0x10, 0xE4, 0x92, 0x45, 0xFE, 0x01, 0x90, 0x48, 0x38, 0x43,
-    0x3E, 0xD1, 0xFE, 0xFD, 0x37, 0x04, 0x4A, 0x7F, 0x95, 0xC9, 0x80, 0x77, 0x33, 0x15, 0x09, 0xBA,
-    0xD8, 0xFE, 0xA8, 0x81, 0x7E, 0xAC, 0xA6, 0x7C, 0x03, 0x13, 0xEA, 0xAE, 0x0F, 0x8D, 0xFB, 0x72,
-    0x2C, 0x1D, 0xCC, 0x63, 0xB1, 0xDD, 0xE9, 0x70, 0xCD, 0x4C, 0x59, 0xCE, 0xB5, 0x49, 0x6B, 0x4C,
-    0x9C, 0xAD, 0x78, 0x1B, 0x04, 0xF3, 0x85, 0xF3, 0xE3, 0x56, 0x76, 0x0F, 0x21, 0xE8, 0x81, 0x76,
-    0x50, 0xCE, 0x18, 0x0D, 0x64, 0x30, 0x48, 0xEC, 0x29, 0x58, 0x51, 0x88, 0x39, 0xA4, 0xA4, 0x99,
-    0x12, 0x2F, 0xE6, 0x0B, 0xA4, 0x10, 0x51, 0x80, 0x13, 0xBA, 0x0A, 0xC7, 0x18, 0x84, 0xE8, 0x2D,
-    0xD0, 0x9C, 0xCF, 0x46, 0x7A, 0x3F, 0xA8, 0x0F, 0xC3, 0xD3, 0x80, 0xE9, 0x3F, 0xA3, 0x5A, 0x97,
-    0xD3, 0xFC, 0xAB, 0xB6, 0xDF, 0xA5, 0x52, 0x84, 0x73, 0x9E, 0xC6, 0xE1, 0x14, 0x0D, 0xC8, 0x97,
-    0x1C, 0x85, 0x00, 0x55, 0x2A, 0x47, 0x39, 0x70, 0xCC, 0x98, 0xA5, 0x71, 0x42, 0xFB, 0xA7, 0x3E,
-    0x7E, 0x35, 0x75, 0xAE, 0x1F, 0xF0, 0xF2, 0x5B, 0x8A, 0x28, 0x83, 0x59, 0xF3, 0x55, 0xCA, 0x14,
-    0x1D, 0xD2, 0x4F, 0xA0, 0x1D, 0x47, 0x7D, 0x34, 0x52, 0x28, 0x02, 0xE6, 0x8A, 0x90, 0x74, 0x4B,
-    0x68, 0x98, 0xF0, 0x25, 0x99, 0xC8, 0x3D, 0xF8, 0xBD, 0x1C, 0xC0, 0x38, 0xF3, 0x80, 0xC8, 0x39,
-    0xA2, 0xAD, 0xCA, 0x04, 0x0E, 0x6C, 0x28, 0xC4, 0x07, 0x8C, 0xF8, 0x8E, 0x7D, 0x0F, 0xF2, 0x0E,
-    0x29, 0x78, 0x49, 0x89, 0x58, 0xC6, 0x61, 0xCC, 0x3E, 0xB7, 0x57, 0xFB, 0x1D, 0x50, 0x21, 0x31,
-    0x6D, 0x61, 0xE4, 0xAC, 0x23, 0x10, 0x1F, 0xCC, 0x13, 0x21, 0x4F, 0xE0, 0x49, 0xCE, 0x60, 0x0B,
-    0x4B, 0x95, 0x5A, 0x09, 0x08, 0xC5, 0xCA, 0x41, 0xA8, 0xA4, 0x03, 0xF7, 0x12, 0x42, 0x32, 0xE8,
-    0x3E, 0x99, 0x39, 0x0B, 0xBC, 0xC8, 0x3A, 0x79, 0x43, 0x36, 0xC2, 0xDB, 0x43, 0x84, 0x59, 0xFC,
-    0xF3, 0x1B, 0x4C, 0xB8, 0x3D, 0x0D, 0x08, 0xC8, 0x3E, 0xCD, 0xC6, 0x59, 0xF7, 0xAE, 0x90, 0xD9,
-    0x29, 0xCA, 0x53, 0x90, 0x2F, 0x77, 0xED, 0x10, 0xEA, 0x78, 0xDE, 0x69, 0x44, 0x98, 0x3B, 0x22,
-    0xE1, 0x6D, 0x03, 0x09, 0x30, 0x33, 0xC0, 0xAB, 0x30, 0x4D, 0xBC, 0xF5, 0x1D, 0x8E, 0x5F, 0xCC,
-    0x60, 0xB3, 0x78, 0x98, 0x5F, 0xAA, 0x82, 0xEE, 0xFB, 0x65, 0x96, 0xBA, 0x19, 0x85, 0x13, 0x77,
-    0xC5, 0x43, 0xFC, 0xA9, 0x62, 0xCE, 0xA0, 0x8F, 0x17, 0x52, 0xB4, 0xEB, 0x67, 0xA5, 0x0C, 0x69,
-    0x70, 0x38, 0xB4, 0xEF, 0x4F, 0xE1, 0xC0, 0xAA, 0xA9, 0xE8, 0x1C, 0x6C, 0xA7, 0xCD, 0x17, 0xCA,
-    0xD6, 0x4C, 0x11, 0x41, 0xC9, 0x9D, 0x63, 0x14, 0xA4, 0x46, 0x27, 0xAF, 0x51, 0x70, 0x97, 0xBD,
-    0x7F, 0x4D, 0xCF, 0x96, 0xA0, 0x25, 0xBB, 0xC4, 0x0E, 0xC9, 0xE6, 0x0C, 0x9B, 0x37, 0xD4, 0x54,
-    0x67, 0x79, 0xEE, 0x02, 0x9B, 0xA7, 0xD7, 0xD4, 0x55, 0x12, 0xD8, 0xFD, 0xDB, 0x5B, 0xC7, 0xD0,
-    0x5A, 0x30, 0xB3, 0xDC, 0x2A, 0x07, 0xA7, 0x04, 0xF1, 0xD1, 0x26, 0xD8, 0x7A, 0xED, 0xDF, 0xD5,
-    0x62, 0xC6, 0xE5, 0xDB, 0xD0, 0x0E, 0x10, 0xB9, 0xC3, 0x16, 0x82, 0x86, 0x4C, 0x36, 0x9D, 0x3E,
-    0xFB, 0xA2, 0x8A, 0x28, 0xBE, 0x14, 0xB3, 0x10, 0xBC, 0xD3, 0xC5, 0x94, 0xD7, 0x9F, 0xB5, 0x9F,
-    0x80, 0xAB, 0x00, 0xB0, 0x27, 0x84, 0x7A, 0xBD, 0x2B, 0x42, 0xCE, 0x27, 0xF2, 0x1A, 0x18, 0xD9,
-    0x1E, 0x54, 0x82, 0x1A, 0xAD, 0xA3, 0xC7, 0x98, 0xD2, 0x60, 0xEF, 0xD5, 0xB7, 0x9F, 0xC5, 0x2C,
-    0x83, 0x5C, 0x05, 0x05, 0x0D, 0xE4, 0xC2, 0x2E, 0x3F, 0xDE, 0xFC, 0x44, 0xAF, 0x3A, 0x5E, 0xDA,
-    0x65, 0xA2, 0x75, 0x94, 0xAF, 0xDB, 0x5A, 0xAE, 0xC3, 0x34, 0x31, 0x9B, 0x00, 0xB4, 0xD2, 0xE3,
-    0x03, 0xAF, 0xA0, 0x47, 0x09, 0x39, 0x42, 0x0A, 0x95, 0x15, 0xB6, 0x81, 0x26, 0xAF, 0x93, 0x71,
-    0x73, 0x8C, 0xA9, 0xA5, 0x5D, 0x84, 0x54, 0x92, 0xDC, 0x11, 0xAE, 0x27, 0x6A, 0x4E, 0x4E, 0xDD,
-    0xF3, 0x2A, 0x06, 0x40, 0xE4, 0x19, 0x0B, 0x95, 0x40, 0x7A, 0x49, 0xF8, 0x41, 0x28, 0xFE, 0x31,
-    0x24, 0x9A, 0xF2, 0x5D, 0xA8, 0x44, 0xD2, 0xFD, 0xA2, 0x04, 0xDB, 0x81, 0x7A, 0x08, 0xAF, 0x9A,
-    0xB4, 0x72, 0xA3, 0x80, 0xF4, 0x72, 0xA9, 0x16, 0xCC, 0x38, 0xB1, 0x44, 0xCC, 0xC3, 0x0C, 0x8B,
-    0xEC, 0x5C, 0xA4, 0x1C, 0x51, 0x8D, 0xE4, 0xB1, 0x6E, 0x43, 0xEE, 0x53, 0xE7, 0xD3, 0x39, 0x81,
-    0x3A, 0x3F, 0xCA, 0x1A, 0x2A, 0x95, 0x07, 0x2C, 0x84, 0x46, 0x25, 0xF4, 0x5F, 0x38, 0x9A, 0x9C,
-    0x2C, 0x70, 0x10, 0x71, 0x0D, 0xFA, 0x35, 0xD5, 0x5B, 0x6A, 0xB6, 0xF0, 0x3A, 0xCE, 0xF0, 0x2B,
-    0x98, 0x62, 0xAD, 0x9E, 0x3C, 0x6A, 0x28, 0xE6, 0x09, 0x4E, 0xC0, 0x7B, 0x66, 0xA1, 0xD2, 0xB7,
-    0x72, 0x2E, 0x8C, 0xD4, 0x21, 0x38, 0x6A, 0xB9, 0x12, 0xBA, 0xB9, 0x31, 0xB1, 0x44, 0xB5, 0x3B,
-    0x2F, 0xCC, 0x5F, 0x44, 0x22, 0x54, 0x81, 0x5A, 0x37, 0x9E, 0xC3, 0xB0, 0xD3, 0x6A, 0x5B, 0xFC,
-    0xE9, 0x4C, 0xEE, 0x5A, 0x97, 0x82, 0x94, 0xB0, 0xC0, 0xCA, 0x86, 0xF9, 0x4B, 0xCF, 0xA1, 0xDD,
-    0x43, 0x13, 0xF7, 0x19, 0xBA, 0xC6, 0xEE, 0xB1, 0xE1, 0xAC, 0x5B, 0x35, 0xAF, 0x5B, 0x81, 0xC6,
-    0x74, 0xF4, 0x28, 0x34, 0x4D, 0x91, 0x16, 0x85, 0x32, 0x02, 0x92, 0xD0, 0xBE, 0xB7, 0x65, 0x48,
-    0xA0, 0x80, 0x07, 0x3A, 0x99, 0x65, 0x30, 0x19, 0xC0, 0xC2, 0xF8, 0x95, 0x07, 0x6D, 0xA6, 0x30,
-    0x1A, 0xF2, 0x0C, 0x36, 0xF4, 0x58, 0x40, 0x4B, 0x4B, 0x95, 0x55, 0x56, 0xCE, 0xA0, 0xFE, 0xC2,
-    0x69, 0xA3, 0x46, 0x56, 0x03, 0xD9, 0xAB, 0x36, 0x7E, 0xBB, 0x12, 0x2A, 0x55, 0x91, 0xA3, 0x04,
-    0x77, 0xF6, 0x0B, 0x29, 0x72, 0x7C, 0x3B, 0xEF, 0xDC, 0x1E, 0x39, 0xE5, 0xD5, 0xBF, 0xA7, 0x33,
-    0xD6, 0x45, 0xB0, 0x09, 0x44, 0x8B, 0xE5, 0xE7, 0xA3, 0x79, 0x96, 0xD7, 0x7A, 0x4C, 0xE0, 0x2A,
-    0x72, 0xCA, 0xF5, 0xBB, 0xE5, 0x94, 0x6F, 0xC8, 0xA4, 0xB0, 0xE3, 0xD3, 0x44, 0x49, 0xDB, 0xE6,
-    0xF5, 0x53, 0x6F, 0x5A, 0xB5, 0x8D, 0xC7, 0x32, 0xD6, 0x09, 0x69, 0xCB, 0x20, 0xDB, 0x83, 0xD9,
-    0x00, 0xCD, 0x85, 0x21, 0xA9, 0xFC, 0xDF, 0x32, 0xB6, 0xC9, 0xAF, 0xA9, 0xA7, 0xBE, 0xA3, 0xF8,
-    0x5A, 0x01, 0xC9, 0x3D, 0x7F, 0xC8, 0x77, 0x6C, 0x5A, 0x21, 0xD0, 0x46, 0x18, 0xF6, 0xBD, 0xFE,
-    0x3F, 0xE6, 0xF9, 0x6D, 0x9F, 0xFE, 0xF8, 0xC3, 0x3B, 0x63, 0x7A, 0xA4, 0x3A, 0xFD, 0x87, 0x13,
-    0x15, 0xCF, 0xEB, 0x07, 0x6D, 0xCC, 0x01, 0x70, 0xB6, 0xB2, 0x56, 0x37, 0x9F, 0x53, 0x03, 0x4B,
-    0x88, 0xFB, 0x5F, 0xB0, 0x89, 0x07, 0xD8, 0x33, 0x3B, 0x51, 0xB4, 0xC7, 0x6C, 0x4D, 0x4B, 0xEE,
-    0x5D, 0xD8, 0x81, 0x8B, 0x6E, 0x83, 0xAC, 0x20, 0xBA, 0x32, 0xBD, 0x26, 0xB5, 0x8E, 0xBC, 0xD0,
-    0xCA, 0x79, 0x06, 0x37, 0x84, 0x8B, 0x5B, 0x83, 0x77, 0x5E, 0xA8, 0x3C, 0x63, 0x36, 0x22, 0x91,
-    0x57, 0xE6, 0x42, 0x17, 0x07, 0xE7, 0x30, 0xCD, 0xE0, 0x0B, 0x2F, 0x72, 0x08, 0x03, 0x65, 0x0D,
-    0x2F, 0x90, 0xC9, 0x6F, 0xCB, 0xD9, 0xA0, 0x77, 0x02, 0xD4, 0x94, 0x9E, 0x7F, 0x28, 0x64, 0x43,
-    0x44, 0x1B, 0xCA, 0x35, 0xB3, 0xFB, 0x4F, 0xC5, 0xF8, 0x07, 0xFA, 0xDA, 0x7E, 0xDD, 0x5E, 0xFF,
-    0x89, 0x8A, 0x56, 0x08, 0xD7, 0xC3, 0x5F, 0x3B, 0xF1, 0xCC, 0x9A, 0xAE, 0x79, 0x7E, 0x51, 0x82,
-    0x5E, 0x7E, 0x45, 0xDC, 0x79, 0x5D, 0x4F, 0x01, 0xF7, 0xE7, 0x57, 0xCD, 0xAF, 0xF1, 0x91, 0x98,
-    0x72, 0x1B, 0xE7, 0x9C, 0xFB, 0x6A, 0xE9, 0x11, 0x23, 0x91, 0x8B, 0xEA, 0x3D, 0x50, 0x7A, 0xDB,
-    0x16, 0x21, 0xC8, 0x77, 0xDA, 0x30, 0xE6, 0x01, 0x41, 0x3C, 0x1E, 0x55, 0xC6, 0x51, 0x66, 0x62,
-    0x8C, 0xFE, 0x0A, 0x30, 0x8C, 0xA7, 0x11, 0xB9, 0x25, 0xFC, 0x46, 0x29, 0x48, 0x6F, 0xDA, 0x09,
-    0x1F, 0xC8, 0x1B, 0x18, 0xB4, 0x1A, 0x50, 0xEE, 0x1A, 0x6A, 0xF0, 0xDB, 0x60, 0xB7, 0x8B, 0x15,
-    0x7D, 0x4D, 0x26, 0xFA, 0xEA, 0xD1, 0x78, 0xDA, 0x3E, 0x4C, 0xA5, 0xF9, 0x85, 0xE2, 0xD0, 0x69,
-    0x13, 0x35, 0x11, 0x7C, 0x0D, 0x21, 0xED, 0x8A, 0x03, 0x08, 0x2A, 0xA8, 0xCA, 0x53, 0xBB, 0xB0,
-    0x03, 0x56, 0x34, 0x1B, 0xD0, 0xE8, 0x8D, 0x11, 0x59, 0x08, 0x5F, 0x04, 0xA7, 0x46, 0x67, 0x21,
-    0x3A, 0xCB, 0x0B, 0x06, 0x40, 0x29, 0xD8, 0x20, 0x4A, 0xB8, 0xDC, 0xA3, 0x2E, 0x87, 0x45, 0x22,
-    0x01, 0xA5, 0xB8, 0x04, 0x1E, 0xBA, 0xC3, 0xD8, 0x03, 0x42, 0x15, 0x1C, 0x3B, 0x54, 0x5B, 0xF1,
-    0xD2, 0x3D, 0x18, 0xF5, 0xD3, 0xB8, 0x03, 0xF2, 0x1E, 0xC3, 0x32, 0x38, 0x1D, 0x48, 0xE6, 0x28,
-    0xF9, 0xCE, 0x96, 0x01, 0x69, 0xF1, 0x97, 0xD7, 0xFA, 0x54, 0x73, 0x94, 0xCF, 0x55, 0xA7, 0x4A,
-    0xF6, 0x70, 0x2D, 0x20, 0xC0, 0x45, 0x43, 0xB9, 0x00, 0xF7, 0x27, 0xCF, 0x18, 0x35, 0xEC, 0x3B,
-    0xD5, 0x54, 0x1D, 0xC7, 0xD2, 0xCD, 0xB5, 0x6F, 0x46, 0xEC, 0xD0, 0x95, 0x9C, 0xF0, 0x1B, 0x8D,
-    0xF4, 0x2B, 0x41, 0xB4, 0x13, 0xEC, 0x0F, 0x3D, 0x88, 0x20, 0x95, 0x7F, 0x51, 0xDA, 0x44, 0x87,
-    0x18, 0xE0, 0xE0, 0xA2, 0x0E, 0x65, 0x11, 0xB1, 0x22, 0x90, 0x84, 0x7D, 0x59, 0x20, 0x28, 0x38,
-    0x92, 0x95, 0x15, 0xC3, 0xA7, 0x0B, 0xC8, 0xCA, 0x17, 0x06, 0x0D, 0x59, 0xB8, 0xD8, 0x03, 0x31,
-    0x4C, 0x79, 0xA3, 0x13, 0x26, 0x2C, 0x60, 0xD8, 0x69, 0xD1, 0x7F, 0x21, 0x19, 0x0D, 0xE8, 0x23,
-    0x34, 0xAA, 0x88, 0x76, 0x2F, 0xF8, 0xAC, 0xA9, 0x2E, 0x89, 0xF6, 0x40, 0x25, 0x0B, 0x31, 0x14,
-    0x66, 0x0D, 0x50, 0x8D, 0xD3, 0xD1, 0xA9, 0x63, 0xFB, 0xEA, 0x1E, 0x36, 0x90, 0xC3, 0x28, 0xD5,
-    0x79, 0x2A, 0x7E, 0x48, 0x57, 0x80, 0x5C, 0x0B, 0x35, 0x57, 0x34, 0x54, 0x90, 0x52, 0x38, 0x38,
-    0xF3, 0x2A, 0x11, 0xBC, 0x16, 0x7E, 0x1A, 0xD9, 0xA6, 0x14, 0x01, 0x50, 0x1E, 0x9A, 0x8A, 0x2A,
-    0xFC, 0x6E, 0x6F, 0x4F, 0x34, 0x18, 0xD4, 0xE4, 0x26, 0x22, 0xD6, 0x2C, 0x1D, 0x9E, 0xA9, 0xBC,
-    0x09, 0x3D, 0x0E, 0x0B, 0x46, 0x47, 0x43, 0x6E, 0x29, 0x14, 0xA2, 0xAA, 0xFE, 0x60, 0x8C, 0x67,
-    0x32, 0x8F, 0xCF, 0x18, 0xAA, 0x10, 0xB4, 0x9B, 0x33, 0x9A, 0x8C, 0xF1, 0xE1, 0x4E, 0x53, 0x4A,
-    0xB7, 0xCF, 0xD1, 0x62, 0x36, 0xD0, 0xE2, 0x52, 0xAB, 0xE5, 0x37, 0xBD, 0xB3, 0x69, 0x2B, 0x17,
-    0xDF, 0x03, 0x53, 0x39, 0x83, 0x3E, 0xA6, 0x70, 0x5C, 0xEC, 0xCC, 0xF2, 0x41, 0x3D, 0xF6, 0xB8,
-    0xA9, 0x89, 0x9C, 0x8D, 0xF8, 0x9F, 0xA6, 0x7B, 0x4E, 0x4F, 0xD7, 0x07, 0x71, 0xD4, 0xA7, 0x13,
-    0xE5, 0x84, 0xE7, 0xEC, 0xFC, 0xE8, 0xAE, 0x33, 0xA7, 0xC8, 0xA4, 0x6C, 0xD5, 0x51, 0xA1, 0x5D,
-    0xF3, 0x72, 0xCF, 0xD3, 0x21, 0x2F, 0x3D, 0xAB, 0x91, 0x6F, 0xFD, 0xF2, 0xA6, 0xD7, 0xD6, 0x22,
-    0x6B, 0xBC, 0x92, 0x7E, 0x64, 0x38, 0xD1, 0x55, 0x5F, 0xEC, 0xD5, 0x3A, 0xDE, 0x41, 0x42, 0xAA,
-    0x36, 0x5A, 0x46, 0xAA, 0x98, 0x27, 0x68, 0xAA, 0xC7, 0x05, 0xA9, 0x06, 0xB4, 0xD2, 0x7D, 0x6E,
-    0xAF, 0x94, 0xB7, 0xE6, 0x73, 0xE3, 0x9C, 0x46, 0x7B, 0xBE, 0xAE, 0xDB, 0xED, 0xAD, 0x73, 0x50,
-    0xBD, 0x9B, 0xB5, 0x0B, 0xA6, 0xCB, 0x53, 0xBD, 0x19, 0x5D, 0xF4, 0x18, 0x8A, 0xCA, 0xFB, 0xA9,
-    0xF3, 0x0D, 0x00, 0x37, 0xF8, 0x05, 0xEA, 0x84, 0xAF, 0xC0, 0x29, 0x13, 0x6A, 0xDF, 0x14, 0x29,
-    0xB8, 0xAC, 0xC0, 0x82, 0x4B, 0x1A, 0x9A, 0xCB, 0x0A, 0xB6, 0x60, 0x99, 0xDD, 0xF6, 0xE9, 0x9F,
-    0x0A, 0xFF, 0xA2, 0xBF, 0x93, 0xB1, 0x8A, 0x75, 0xAA, 0x11, 0x19, 0x2A, 0xF4, 0xAE, 0xDA, 0xED,
-    0x72, 0x7B, 0xAB, 0xA0, 0x4F, 0x74, 0x3A, 0x13, 0x57, 0x3D, 0x86, 0x3B, 0xFC, 0xE8, 0x67, 0x30,
-    0x3C, 0xE3, 0x6E, 0x1E, 0x5B, 0x81, 0x09, 0xE9, 0xDA, 0xD7, 0x0D, 0xAD, 0x1A, 0xD4, 0xD8, 0x17,
-    0x4B, 0xD7, 0xAF, 0x4F, 0xF7, 0xD6, 0x6C, 0xCC, 0xE9, 0x3F, 0x3F, 0x42, 0x4F, 0xCA, 0x9B, 0x24,
-    0x8D, 0x75, 0x0A, 0x3D, 0x18, 0xF4, 0x4A, 0xA6, 0xEC, 0xCC, 0xEA, 0x30, 0x2D, 0x28, 0xF3, 0x77,
-    0x53, 0x58, 0x78, 0xBA, 0x03, 0xB7, 0x69, 0xDC, 0xD8, 0xEF, 0x75, 0x42, 0x86, 0xD2, 0xB7, 0x45,
-    0x8A, 0x1E, 0xA2, 0x16, 0xD6, 0x48, 0x7F, 0x90, 0x79, 0x2E, 0x43, 0xF2, 0xB4, 0x4C, 0xBD, 0x2A,
-    0xAD, 0xD2, 0x3A, 0x91, 0x3B, 0x85, 0xBD, 0x60, 0xFB, 0xE0, 0xD9, 0x67, 0xC8, 0x3F, 0x11, 0xEB,
-    0x54, 0x85, 0xFD, 0x92, 0x41, 0x9B, 0xC9, 0x12, 0x91, 0x53, 0x03, 0xBF, 0x4D, 0x3B, 0x6E, 0x82,
-    0x68, 0xB0, 0x0A, 0x4F, 0xEF, 0x43, 0xBC, 0xA6, 0x70, 0x5C, 0x45, 0x59, 0x8F, 0x28, 0x4B, 0xD4,
-    0x0A, 0xFA, 0x52, 0xE8, 0x5E, 0x79, 0xB2, 0x17, 0x6E, 0xDC, 0xE6, 0x17, 0x86, 0x99, 0x0D, 0xFA,
-    0xA4, 0x49, 0xEB, 0xFC, 0x0D, 0x79, 0x52, 0xD0, 0x47, 0x02, 0xFE, 0x7C, 0x41, 0x52, 0x89, 0x79,
-    0xEB, 0x5B, 0x85, 0x00, 0xBD, 0xCA, 0x30, 0x07, 0x37, 0x0A, 0x04, 0x60, 0xCF, 0x67, 0x4E, 0xB6,
-    0x3B, 0x05, 0xC2, 0x23, 0x8F, 0x8C, 0xD5, 0xE9, 0x08, 0x50, 0x00, 0x13, 0xB3, 0x52, 0x48, 0xDC,
-    0xFC, 0x38, 0x82, 0x78, 0x35, 0x28, 0x5C, 0x11, 0xD6, 0x25, 0x25, 0x58, 0xAA, 0x4D, 0x5B, 0x30,
-    0x36, 0x43, 0x9E, 0xB0, 0x08, 0x40, 0x15, 0x32, 0x24, 0x93, 0x98, 0x31, 0x7A, 0x35, 0x72, 0x55,
-    0x84, 0x06, 0xF9, 0x23, 0xC0, 0x10, 0xC1, 0xFA, 0xDC, 0xD2, 0x88, 0x2D, 0xD2, 0x83, 0x15, 0xE1,
-    0x4C, 0xE4, 0xBA, 0x0B, 0xF0, 0x21, 0x09, 0xCE, 0x9D, 0x12, 0xAE, 0x0D, 0x61, 0x24, 0xFD, 0x54,
-    0xC0, 0x54, 0x87, 0xC3, 0x44, 0x62, 0x1A, 0xBE, 0x40, 0x00, 0x32, 0xD0, 0x93, 0x65, 0xD1, 0xDE,
-    0xBB, 0x30, 0xE9, 0xD5, 0x86, 0x21, 0x90, 0x1F, 0x0E, 0x38, 0x18, 0x35, 0xB9, 0x20, 0x9F, 0x0C,
-    0x5A, 0xD4, 0xA8, 0xD4, 0xA0, 0x31, 0x58, 0x56, 0x31, 0x53, 0x38, 0xB8, 0x27, 0x9D, 0xBC, 0x39,
-    0x22, 0xDE, 0x3E, 0xF9, 0x74, 0x4C, 0xAB, 0x58, 0x46, 0xA6, 0x7C, 0xB9, 0x0B, 0x7A, 0x81, 0xDA,
-    0xFB, 0xE8, 0xA0, 0x0D, 0x3B, 0x01, 0xDE, 0xC2, 0x7E, 0x47, 0x7A, 0x1A, 0x0B, 0x29, 0x2A, 0x0B,
-    0xFB, 0x8C, 0xBC, 0x45, 0x42, 0x31, 0xC7, 0x4E, 0x93, 0xD9, 0x4D, 0x6C, 0xEB, 0x1E, 0x22, 0xC0,
-    0xFC, 0x88, 0x81, 0x9B, 0xE5, 0x82, 0xB4, 0x88, 0x56, 0x7B, 0x7C, 0x29, 0xF7, 0x39, 0xD5, 0xAB,
-    0xD8, 0x85, 0x39, 0xA0, 0x6E, 0xB6, 0x99, 0x86, 0x21, 0x32, 0xEC, 0xD4, 0xB8, 0x2C, 0x9A, 0x68,
-    0x94, 0x57, 0x46, 0x84, 0x08, 0xA2, 0x6C, 0xA0, 0x9C, 0xD2, 0x74, 0x8A, 0x7F, 0xC0, 0xA2, 0x86,
-    0xB6, 0x30, 0x35, 0x36, 0x2F, 0x37, 0x40, 0xCE, 0x41, 0xE5, 0xA1, 0x70, 0xD1, 0x34, 0xE3, 0x3C,
-    0x2B, 0x70, 0xD3, 0xE1, 0x9D, 0xA1, 0x42, 0x0B, 0x3E, 0x22, 0x88, 0x0C, 0x48, 0x28, 0x08, 0x4A,
-    0x46, 0x79, 0x95, 0xCE, 0x82, 0x9E, 0xE6, 0x2B, 0x25, 0x1B, 0x9A, 0xAD, 0x20, 0xB8, 0x74, 0x4A,
-    0x84, 0xBC, 0xE4, 0x03, 0x19, 0x06, 0x01, 0xC3, 0x22, 0x7F, 0x71, 0x04, 0x42, 0x97, 0xF2, 0xD5,
-    0x08, 0x00, 0xDE, 0xEA, 0x42, 0x19, 0x36, 0xFA, 0xB5, 0x18, 0xB4, 0xAF, 0x80, 0xA0, 0xD6, 0x4A,
-    0xB7, 0xA5, 0x83, 0x05, 0xC4, 0xB0, 0xF9, 0x73, 0x74, 0x5A, 0x13, 0x1C, 0x9A, 0xC9, 0xA0, 0xB6,
-    0x73, 0xD2, 0xA9, 0x65, 0x34, 0xDE, 0x2D, 0x39, 0xCD, 0xA5, 0x31, 0x58, 0xC6, 0x9F, 0x69, 0xAE,
-    0x81, 0x99, 0x5C, 0xD8, 0xA9, 0x48, 0x7F, 0xA4, 0x89, 0x3D, 0x62, 0x75, 0x19, 0x92, 0xA9, 0xD0,
-    0x01, 0x59, 0x4C, 0x45, 0xC9, 0x95, 0x3E, 0x28, 0x3A, 0xF5, 0x08, 0x97, 0x00, 0x34, 0x1C, 0x68,
-    0x00, 0x79, 0x1C, 0x4C, 0x9B, 0x92, 0xF0, 0x3A, 0xD2, 0xAB, 0x94, 0xFA, 0xA1, 0x5D, 0x87, 0x94,
-    0x40, 0x9E, 0x01, 0x28, 0x17, 0xE9, 0x30, 0x1D, 0x63, 0xBE, 0x51, 0x83, 0x89, 0x34, 0x13, 0x54,
-    0x30, 0xC0, 0x8D, 0x00, 0x7C, 0xDB, 0x16, 0x98, 0x0B, 0xC2, 0x81, 0xF8, 0x82, 0x95, 0xA7, 0xDD,
-    0x54, 0x84, 0xAA, 0x63, 0x76, 0xB2, 0xCA, 0x17, 0xE9, 0xE5, 0xBE, 0x7C, 0x43, 0x1E, 0x1F, 0x35,
-    0x32, 0x05, 0x05, 0x7C, 0x6F, 0x0E, 0x71, 0x83, 0x00, 0xB9, 0x5E, 0xA6, 0xA2, 0xDF, 0x47, 0x9F,
-    0x08, 0x48, 0x05, 0x8C, 0xEF, 0xF6, 0x42, 0x10, 0x64, 0x4A, 0x8A, 0x9A, 0xF2, 0x94, 0x08, 0x38,
-    0xB0, 0x3C, 0xA6, 0x6F, 0xDA, 0x33, 0xC2, 0xE3, 0xC8, 0x5D, 0xE1, 0xBE, 0x70, 0xBE, 0xF0, 0x82,
-    0x11, 0x83, 0xC0, 0xDE, 0x36, 0xBC, 0x66, 0xF2, 0x6E, 0x36, 0xA5, 0x04, 0xA9, 0xB8, 0xAE, 0x5C,
-    0xE4, 0xE0, 0x71, 0x44, 0xC1, 0x80, 0x85, 0xD0, 0x88, 0x97, 0x02, 0xBB, 0x0E, 0x9D, 0xDF, 0x63,
-    0x01, 0x5D, 0x09, 0xBB, 0x91, 0x4B, 0x45, 0xFA, 0xC6, 0x79, 0x6A, 0x4C, 0x60, 0xF2, 0x96, 0xA2,
-    0xBE, 0x30, 0x70, 0x58, 0x69, 0x68, 0x36, 0xD6, 0xB0, 0xAA, 0xF1, 0x75, 0x8D, 0x59, 0x64, 0x40,
-    0x78, 0x06, 0xB7, 0xE5, 0x52, 0x9F, 0x38, 0x68, 0xF2, 0x2C, 0xEE, 0xBC, 0x31, 0x10, 0xE9, 0xF4,
-    0xCE, 0xA8, 0x91, 0x35, 0xA5, 0xBA, 0xA9, 0xC9, 0x3B, 0xDA, 0xE0, 0x95, 0x0D, 0xC6, 0xA2, 0x73,
-    0x12, 0x14, 0xC6, 0x83, 0xD7, 0x91, 0xE9, 0x5E, 0x94, 0x2C, 0x90, 0x4E, 0x54, 0x76, 0x8E, 0x11,
-    0x87, 0xCA, 0x45, 0xBC, 0xE7, 0x69, 0xF5, 0x10, 0x92, 0x29, 0xB0, 0x44, 0x14, 0x59, 0x30, 0xCE,
-    0x11, 0x59, 0xEA, 0xF2, 0x2D, 0xF2, 0xED, 0xF3, 0xD7, 0x48, 0x82, 0x89, 0xAC, 0x89, 0x2A, 0x30,
-    0x8F, 0x09, 0x09, 0x0D, 0x84, 0xFA, 0x1C, 0xE9, 0x80, 0xE2, 0x1F, 0x22, 0x2A, 0x52, 0xC8, 0x5D,
-    0x91, 0x34, 0xFE, 0x98, 0x22, 0x38, 0xD2, 0x9E, 0xBA, 0xD7, 0x01, 0x5E, 0x91, 0x5F, 0xC6, 0x81,
-    0xB8, 0x45, 0xCE, 0x0D, 0xC2, 0x86, 0x43, 0x11, 0xE7, 0x7D, 0x51, 0xFE, 0x9E, 0xD2, 0x9C, 0x2C,
-    0x04, 0x3C, 0x91, 0xE8, 0xE7, 0x54, 0x88, 0x04, 0x00, 0x74, 0x2F, 0x53, 0xCC, 0xA0, 0x2C, 0xE7,
-    0xFA, 0xEE, 0x42, 0xF3, 0x77, 0x1D, 0x50, 0x3E, 0xA7, 0xDB, 0x9F, 0xDF, 0x96, 0xD2, 0x81, 0xB8,
-    0x2B, 0xD9, 0x8D, 0x55, 0x1B, 0x6A, 0x3B, 0xA0, 0x0D, 0xB4, 0x1D, 0x57, 0xAD, 0x3F, 0xEE, 0xDA,
-    0x53, 0xE1, 0xCC, 0xBC, 0xC1, 0xB5, 0x69, 0x97, 0x34, 0x39, 0x9C, 0xB1, 0x1A, 0x3A, 0xEF, 0x5C,
-    0x24, 0x32, 0x78, 0x9B, 0x2A, 0x34, 0x68, 0x62, 0xDE, 0x83, 0xF6, 0x6D, 0x15, 0xA4, 0x57, 0x90,
-    0x5C, 0x4C, 0xDC, 0x6F, 0xE6, 0x68, 0xAA, 0xDC, 0xBC, 0x86, 0x70, 0x91, 0x37, 0xC0, 0xCD, 0xA4,
-    0xA3, 0x1F, 0x72, 0x2D, 0x0A, 0x12, 0x11, 0x85, 0x56, 0x23, 0xC1, 0xF7, 0xB6, 0x7A, 0x94, 0x67,
-    0xEA, 0x55, 0x31, 0xBD, 0x88, 0xB8, 0x5B, 0x2A, 0x8A, 0x56, 0xE1, 0x59, 0xA5, 0xB8, 0x0B, 0x17,
-    0x1B, 0xAF, 0x5A, 0xAC, 0x9A, 0x6B, 0xD4, 0xC9, 0x7F, 0x97, 0x23, 0x48, 0xD0, 0xE3, 0x7F, 0xAC,
-    0x1C, 0x41, 0xD0, 0x91, 0xD4, 0xDE, 0xFA, 0x89, 0x75, 0x5E, 0x26, 0x1B, 0x8F, 0xF0, 0x30, 0xA9,
-    0x23, 0x68, 0x26, 0x32, 0xA9, 0x28, 0x90, 0xBE, 0xDD, 0xD9, 0xD7, 0x11, 0x84, 0x01, 0x0D, 0xEF,
-    0xC0, 0x7C, 0x94, 0x8E, 0x94, 0x35, 0xD8, 0xDA, 0x91, 0x91, 0xF7, 0xBF, 0x8C, 0x7A, 0x97, 0xD6,
-    0xE6, 0x6B, 0x72, 0x11, 0x23, 0xF8, 0xDC, 0x4E, 0x24, 0xE7, 0x65, 0x1A, 0xBA, 0xAF, 0x21, 0xEF,
-    0x48, 0xC3, 0xC8, 0x2B, 0xDC, 0x30, 0xAD, 0xD5, 0x0F, 0x42, 0x70, 0x7E, 0xC2, 0xF0, 0xA9, 0xDF,
-    0xB0, 0xDD, 0xE1, 0x44, 0xB5, 0x2A, 0x3C, 0xF6, 0x4B, 0x71, 0x40, 0x55, 0x17, 0x8D, 0xE8, 0x83,
-    0x1C, 0xC3, 0x87, 0x5F, 0x64, 0x18, 0x29, 0x26, 0x1D, 0x9D, 0xF7, 0x3B, 0xBE, 0xB3, 0xEA, 0x42,
-    0x3F, 0x6A, 0xE5, 0x87, 0x3F, 0x2E, 0xF5, 0xA3, 0xB8, 0x15, 0xFD, 0xC8, 0x1F, 0x89, 0x66, 0xD4,
-    0x8F, 0x6E, 0xF7, 0x53, 0xD6, 0x08, 0x7C, 0x80, 0x6A, 0xF0, 0x9F, 0xF1, 0xF6, 0xE8, 0xEA, 0xC6,
-    0x59, 0xD1, 0xD3, 0x4C, 0xC0, 0x61, 0xF1, 0x6C, 0x44, 0x81, 0xE4, 0x25, 0x46, 0xD8, 0x2C, 0x48,
-    0x43, 0xEA, 0x64, 0xB7, 0x26, 0xFF, 0xA8, 0xC1, 0xE8, 0xD0, 0xDF, 0x6D, 0x61, 0x5A, 0xE2, 0x5E,
-    0x25, 0xFA, 0x1D, 0x36, 0x39, 0x54, 0x03, 0x28, 0xB7, 0x61, 0xF5, 0x67, 0x6B, 0x1D, 0x3F, 0x5A,
-    0x22, 0x58, 0x89, 0xE6, 0xAC, 0x0B, 0xC0, 0xE6, 0x06, 0x71, 0x02, 0xFF, 0x47, 0x7A, 0x05, 0xF9,
-    0x91, 0x9E, 0x85, 0x2A, 0x82, 0x58, 0x17, 0x82, 0x6A, 0x81, 0x73, 0xE5, 0x6F, 0x33, 0x09, 0x43,
-    0xFA, 0x37, 0xB3, 0xCC, 0xAA, 0xB9, 0xDA, 0x38, 0x26, 0xAA, 0x99, 0x38, 0xA9, 0x26, 0x6A, 0x16,
-    0x6B, 0x8E, 0xAD, 0xA5, 0x2F, 0x7F, 0x8A, 0xE7, 0xE1, 0xAC, 0x59, 0xA5, 0xE9, 0xAE, 0x79, 0x7C,
-    0xED, 0xE4, 0x77, 0xCC, 0x36, 0x5D, 0x5C, 0x96, 0x5D, 0x7A, 0x57, 0x10, 0xB2, 0x93, 0xB6, 0x8C,
-    0xF0, 0x4E, 0x98, 0x89, 0x03, 0xF4, 0x6D, 0x19, 0x57, 0xB3, 0x00, 0x33, 0xBA, 0x20, 0x1D, 0x03,
-    0xF3, 0x2B, 0x90, 0xFD, 0xA0, 0x56, 0x64, 0x97, 0xF3, 0x93, 0xB6, 0x70, 0x17, 0x53, 0x08, 0xB1,
-    0x95, 0x10, 0x38, 0x86, 0x14, 0xBA, 0xA3, 0x2E, 0x71, 0xB9, 0xAC, 0x04, 0xFE, 0xAD, 0x26, 0x30,
-    0xBE, 0x0C, 0x03, 0x94, 0x61, 0x40, 0x25, 0xE3, 0x2A, 0x61, 0x26, 0x08, 0xA8, 0xD9, 0x16, 0x0C,
-    0x7F, 0xDC, 0x41, 0xAC, 0x4D, 0x15, 0x72, 0xBE, 0x35, 0x53, 0xB4, 0x41, 0xEA, 0x52, 0x58, 0x44,
-    0xB6, 0x29, 0x7B, 0xA7, 0x51, 0xC9, 0x3D, 0x6A, 0x06, 0x73, 0x66, 0x4E, 0x13, 0x52, 0xBF, 0xEA,
-    0xC4, 0x75, 0xCD, 0x7A, 0x04, 0xC7, 0x5A, 0x24, 0x70, 0xDE, 0xAD, 0xD2, 0x75, 0x17, 0xCB, 0xC3,
-    0xC3, 0x32, 0x1E, 0xC9, 0x39, 0x24, 0xA6, 0x70, 0x26, 0x4E, 0x7F, 0xC7, 0xC6, 0xF1, 0xF2, 0x00,
-    0x3C, 0x08, 0x01, 0x42, 0x82, 0x68, 0x6F, 0x56, 0x77, 0x62, 0x64, 0x9F, 0x83, 0x44, 0x40, 0x2D,
-    0x86, 0x09, 0x23, 0x04, 0x43, 0x60, 0x19, 0x56, 0x47, 0xD9, 0x04, 0x52, 0x67, 0x41, 0x9A, 0x00,
-    0x39, 0x42, 0x9D, 0x8D, 0x71, 0x0B, 0xB1, 0x8A, 0xC0, 0xAA, 0x19, 0x5B, 0x0A, 0x58, 0x5D, 0xEC,
-    0x9D, 0xC2, 0x6E, 0xE1, 0xB8, 0x15, 0x8A, 0x53, 0xC0, 0xF7, 0x38, 0xA3, 0x4D, 0x0C, 0x68, 0xE9,
-    0x8B, 0xC2, 0xD4, 0xD0, 0x09, 0x19, 0xB8, 0xA8, 0xEE, 0x4C, 0x69, 0x0A, 0xA3, 0x92, 0xC9, 0xFD,
-    0x74, 0x26, 0x1F, 0xDC, 0xF5, 0xE2, 0xF1, 0x12, 0x2E, 0xCB, 0x37, 0x8C, 0xEC, 0x52, 0x33, 0x98,
-    0xEC, 0x32, 0xE5, 0x64, 0x96, 0x58, 0x65, 0x56, 0x84, 0x0E, 0x57, 0xBC, 0x6B, 0x0A, 0x05, 0x43,
-    0xF9, 0x52, 0x03, 0xF7, 0x70, 0x52, 0xBE, 0xE4, 0x5F, 0x10, 0x57, 0xCB, 0x9B, 0x32, 0xC9, 0xC6,
-    0xB0, 0xB2, 0x6D, 0xC4, 0xF8, 0xFF, 0x90, 0x59, 0x28, 0x17, 0x70, 0x5B, 0xA2, 0x13, 0x04, 0xD0,
-    0x16, 0xB7, 0xBF, 0xC4, 0xC4, 0x18, 0x26, 0xF3, 0x26, 0xCC, 0x26, 0x0B, 0xAD, 0x1E, 0x38, 0xC5,
-    0x17, 0xF8, 0x40, 0xF3, 0x65, 0x72, 0x46, 0xC1, 0x8A, 0xD2, 0x76, 0x26, 0x19, 0x3D, 0xBB, 0x0D,
-    0xAB, 0x0F, 0x99, 0x4E, 0xE6, 0xD8, 0x4D, 0xAC, 0x58, 0xBD, 0xA9, 0xC8, 0x4F, 0x15, 0x4B, 0xE6,
-    0xE0, 0x1E, 0x4B, 0xA0, 0x89, 0x16, 0x93, 0x30, 0x93, 0xDB, 0x96, 0x92, 0x30, 0x75, 0xC7, 0x5E,
-    0xE5, 0xD7, 0xF2, 0x93, 0x3E, 0x85, 0x6D, 0x9F, 0x89, 0x5B, 0x86, 0x74, 0x2F, 0xFD, 0x04, 0x69,
-    0xCC, 0xB0, 0xEC, 0x31, 0xA2, 0x89, 0x21, 0xE9, 0xA0, 0x15, 0xD5, 0x51, 0x58, 0x43, 0xF2, 0x13,
-    0x0C, 0x5A, 0xD7, 0xB4, 0x2F, 0xE7, 0x73, 0x0A, 0x09, 0xAF, 0x84, 0x49, 0x91, 0x8A, 0x76, 0x4F,
-    0x9E, 0x9E, 0xA0, 0x5C, 0x4F, 0xD3, 0x72, 0x7B, 0x9A, 0x94, 0x24, 0x25, 0x7E, 0xEB, 0xC2, 0x31,
-    0x0E, 0x25, 0x4F, 0xAB, 0x2D, 0x76, 0xA9, 0xAA, 0xE5, 0xD3, 0x2B, 0x0C, 0xEB, 0x6F, 0x40, 0xDA,
-    0xE8, 0x76, 0xFC, 0x85, 0x9B, 0xB5, 0xA7, 0x4D, 0x32, 0x72, 0x76, 0x2F, 0x12, 0x55, 0xD9, 0x7A,
-    0xDA, 0xA8, 0x53, 0xB5, 0x46, 0xC8, 0x3C, 0xCA, 0xFE, 0xDE, 0x9C, 0x89, 0xAD, 0x1B, 0x74, 0xFA,
-    0x67, 0xD9, 0x97, 0x17, 0x55, 0xD0, 0x52, 0xFE, 0x69, 0xDC, 0x1B, 0xAE, 0xEF, 0x40, 0xEC, 0x96,
-    0xC6, 0x08, 0xC9, 0x0E, 0x58, 0x12, 0xB9, 0x23, 0xAF, 0xF5, 0x0C, 0xC8, 0x79, 0xA2, 0x52, 0x65,
-    0xBA, 0x23, 0x66, 0x54, 0x1A, 0xE2, 0x4E, 0x2A, 0xEC, 0x48, 0x91, 0x82, 0xE0, 0x02, 0x9A, 0x65,
-    0x8E, 0x74, 0xC1, 0x14, 0x82, 0xED, 0x54, 0x80, 0x29, 0x19, 0xE1, 0x04, 0x67, 0x60, 0x0E, 0x19,
-    0x14, 0xBD, 0x3B, 0x60, 0x5C, 0x7A, 0xB1, 0x0B, 0x50, 0x72, 0x53, 0x31, 0x54, 0x89, 0xC2, 0x77,
-    0xF4, 0x6B, 0xA0, 0x35, 0xCD, 0x1C, 0xFA, 0xF6, 0xC6, 0x99, 0x35, 0xF1, 0x21, 0x98, 0x1C, 0x86,
-    0xD9, 0x3A, 0xB8, 0x62, 0xFD, 0xD2, 0x04, 0xF1, 0x03, 0xAF, 0xE1, 0x3F, 0x9C, 0x58, 0x31, 0xFC,
-    0x52, 0xE8, 0x96, 0xF0, 0x06, 0x22, 0x81, 0x08, 0xA8, 0xFF, 0xD3, 0x7C, 0x6D, 0x73, 0x0C, 0xD5,
-    0x89, 0x7F, 0x81, 0xB0, 0x49, 0x5B, 0xCD, 0xC6, 0x1E, 0x29, 0xA9, 0x7A, 0x48, 0xF5, 0x3A, 0x74,
-    0xC6, 0xE4, 0x1F, 0x93, 0xD7, 0xC4, 0x77, 0x68, 0x7E, 0x0A, 0xC7, 0x54, 0xD3, 0xC7, 0x4E, 0x69,
-    0xF6, 0xD8, 0x3B, 0x18, 0x06, 0x10, 0x4F, 0x55, 0x36, 0x42, 0xAB, 0x19, 0x60, 0x25, 0x7C, 0xC3,
-    0x08, 0xD3, 0x69, 0x39, 0xAD, 0xBC, 0x8C, 0xD9, 0x17, 0x66, 0xBD, 0x98, 0xC2, 0xFA, 0x77, 0x7C,
-    0xFC, 0x57, 0x7C, 0xAB, 0xAF, 0xF9, 0x45, 0x6D, 0xEE, 0xFA, 0xFB, 0x17, 0x6F, 0xCD, 0xF3, 0xB6,
-    0xB6, 0x60, 0x1E, 0xA6, 0x87, 0xCB, 0x4C, 0xF2, 0x9E, 0xF1, 0xAB, 0xF6, 0x4F, 0x88, 0xD8, 0xDF,
-    0xDC, 0xD8, 0xFB, 0xC6, 0x8C, 0x84, 0x9A, 0x02, 0x73, 0x68, 0xEA, 0x5B, 0x66, 0x89, 0x38, 0x11,
-    0x4B, 0x14, 0x85, 0xA4, 0xA5, 0x97, 0x83, 0x51, 0x94, 0x0C, 0x6E, 0x0F, 0x55, 0x83, 0xF3, 0x85,
-    0x42, 0xD7, 0xC1, 0x20, 0x80, 0x8F, 0x5B, 0x68, 0x86, 0xB0, 0x0C, 0x8B, 0xB2, 0x65, 0x2F, 0x80,
-    0xED, 0xE4, 0x97, 0x6E, 0x41, 0xCA, 0x29, 0xDF, 0x19, 0xA9, 0xA2, 0x36, 0x29, 0xCD, 0x77, 0x2D,
-    0x4A, 0x21, 0x40, 0xB3, 0x61, 0xD0, 0xFE, 0xB0, 0xF2, 0xDB, 0x83, 0xF0, 0x5D, 0x73, 0x1D, 0x9F,
-    0xE8, 0xC7, 0x88, 0x74, 0x87, 0x9C, 0x49, 0xB3, 0xD9, 0xAA, 0xA2, 0x42, 0x38, 0x4E, 0xF6, 0xB9,
-    0xBB, 0x8D, 0x76, 0x4B, 0x1A, 0x9C, 0xAE, 0x25, 0x53, 0x54, 0x53, 0x56, 0x89, 0x4C, 0x16, 0xF3,
-    0x84, 0x56, 0xB1, 0x50, 0x57, 0x4A, 0xEE, 0x6C, 0x42, 0xB8, 0xC3, 0x89, 0xB5, 0x3B, 0xEC, 0x7B,
-    0xDB, 0x69, 0x27, 0xB8, 0x56, 0x09, 0x33, 0xB9, 0xA8, 0xCE, 0xF4, 0x75, 0xFD, 0xF7, 0x56, 0xEE,
-    0xFE, 0x04, 0x7D, 0x5D, 0x53, 0xC5, 0x86, 0xF5, 0x8F, 0x8B, 0xC9, 0x49, 0x38, 0x7C, 0x37, 0x20,
-    0xA8, 0x36, 0x9E, 0x7A, 0x10, 0xDD, 0x15, 0xE9, 0x7D, 0x3E, 0xE6, 0x9B, 0xE8, 0x40, 0x2D, 0xAA,
-    0xD2, 0xCF, 0x8C, 0xD7, 0x46, 0xC2, 0xB9, 0x3F, 0xC4, 0x55, 0x83, 0x23, 0x64, 0x1C, 0xF4, 0xB4,
-    0x2C, 0x4C, 0xF8, 0xC6, 0xF0, 0x4D, 0xD3, 0x79, 0x2F, 0xB5, 0xA9, 0x3C, 0x69, 0xA7, 0x72, 0x39,
-    0x37, 0x38, 0x05, 0xF5, 0x05, 0xCC, 0xCF, 0xE4, 0x94, 0xB8, 0x10, 0x0D, 0xBD, 0xF1, 0x8C, 0xF9,
-    0x5B, 0x50, 0xA9, 0xDD, 0x22, 0x4E, 0x7F, 0x68, 0x0B, 0x5E, 0x57, 0x38, 0xCF, 0x9E, 0xA9, 0xA1,
-    0x98, 0x51, 0xC4, 0x92, 0xDB, 0xB7, 0xDF, 0xA0, 0xDC, 0x3D, 0xE4, 0x43, 0xF4, 0xE1, 0x6B, 0xE6,
-    0x07, 0x07, 0x0E, 0x0F, 0xF9, 0xC7, 0x6D, 0x3A, 0x1B, 0x84, 0x58, 0x1E, 0xF0, 0xFB, 0xFC, 0xFD,
-    0x31, 0x7C, 0xA7, 0xFF, 0x5B, 0x16, 0xF0, 0xF0, 0x84, 0x4F, 0xA4, 0x76, 0xFC, 0x6F, 0x38, 0x79,
-    0x66, 0x7F, 0x75, 0xDA, 0xFC, 0xD5, 0x6E, 0x19, 0xAA, 0x5B, 0x8A, 0x50, 0x93, 0x56, 0xF2, 0xEF,
-    0x03, 0xC7, 0x10, 0x7D, 0xF3, 0x47, 0xBB, 0xB1, 0x52, 0x9D, 0xD3, 0x73, 0x8C, 0x58, 0xE6, 0x06,
-    0x6F, 0xFB, 0x67, 0xB8, 0xC9, 0x8D, 0xDA, 0xFC, 0x5B, 0x83, 0x89, 0x5B, 0x87, 0x82, 0x13, 0x8F,
-    0x51, 0x87, 0x7C, 0xC2, 0x7C, 0xC1, 0xBF, 0xA7, 0x94, 0x23, 0x7B, 0xA3, 0xEF, 0xD8, 0x75, 0xD9,
-    0xFF, 0x43, 0xAC, 0xB4, 0xED, 0xE9, 0xFF, 0x6B, 0xFE, 0x0B, 0xB7, 0xAA, 0xD0, 0x7C, 0xE9, 0x3F,
-    0x57, 0x61, 0xA2, 0x50, 0xD9, 0x1C, 0x14, 0xC0, 0xAB, 0xFE, 0x00, 0x77, 0x37, 0x8D, 0x0C, 0x27,
-    0x58, 0xD7, 0xE9, 0xD9, 0xEE, 0x2B, 0x36, 0xAE, 0x2D, 0xA7, 0xE3, 0x04, 0x9C, 0x3F, 0x3D, 0x3E,
-    0x01, 0x27, 0xFB, 0x93, 0xBB, 0x9E, 0xB0, 0x22, 0x71, 0xCB, 0x63, 0xC1, 0x32, 0x09, 0x7F, 0x39,
-    0xA3, 0x62, 0x3D, 0xEB, 0x5B, 0x66, 0xA6, 0x37, 0x0D, 0x0B, 0x93, 0xEA, 0x91, 0xEF, 0x9B, 0xD9,
-    0x69, 0xE3, 0x09, 0x44, 0xFD, 0x66, 0x0A, 0xAD, 0x8A, 0x97, 0xF3, 0x69, 0x59, 0x1E, 0x81, 0xB7,
-    0xFC, 0x96, 0x99, 0x9A, 0x07, 0xFD, 0x0B, 0x5E, 0xD3, 0xEF, 0xFF, 0xA5, 0x68, 0xCA, 0x09, 0xEB,
-    0xC2, 0xB3, 0x64, 0xC7, 0x7F, 0x76, 0x41, 0x00, 0xD5, 0x97, 0x83, 0x2D, 0xD3, 0xEB, 0xD0, 0xFC,
-    0x29, 0x07, 0xCE, 0xB8, 0x57, 0xA0, 0x38, 0x8A, 0x57, 0x48, 0x6A, 0xB3, 0x51, 0xE0, 0x15, 0x64,
-    0xCE, 0xC8, 0x97, 0xAF, 0x8F, 0x91, 0x79, 0xF3, 0x07, 0x0A, 0xB8, 0x56, 0x6F, 0x21, 0x27, 0x4E,
-    0x77, 0x9C, 0xD5, 0x77, 0xC1, 0x52, 0xC1, 0x3B, 0x3B, 0x6B, 0x36, 0x50, 0x11, 0xA4, 0x65, 0xA8,
-    0x0C, 0x1C, 0xA6, 0xB4, 0x63, 0xD0, 0xF0, 0x51, 0x6A, 0xA2, 0x5F, 0xAE, 0xC2, 0x9D, 0x77, 0x74,
-    0x2D, 0x4F, 0x16, 0x81, 0xDE, 0x15, 0x32, 0xBE, 0x62, 0x78, 0x43, 0x98, 0xB1, 0x25, 0xEA, 0x46,
-    0x88, 0xFC, 0xB5, 0x02, 0x4E, 0x2A, 0x9F, 0x1E, 0x07, 0x1C, 0x8A, 0x77, 0x78, 0xC8, 0x5E, 0xC2,
-    0x21, 0x91, 0x05, 0x2A, 0xA6, 0x90, 0xE1, 0x90, 0x6F, 0x7D, 0x1C, 0x12, 0x5D, 0x9A, 0x74, 0x75,
-    0x81, 0x43, 0x0C, 0x1C, 0x8D, 0xBA, 0x1C, 0x4E, 0xDC, 0xF4, 0x32, 0x0B, 0x91, 0xD8, 0x4D, 0x91,
-    0x46, 0xE4, 0x10, 0xAD, 0xBB, 0x11, 0x3C, 0x21, 0x03, 0x5D, 0xFE, 0xD1, 0x9D, 0xB9, 0x26, 0x85,
-    0xEE, 0x80, 0xFC, 0xC3, 0x85, 0x05, 0xE3, 0xB1, 0x4D, 0x07, 0xA7, 0xF0, 0xD0, 0x69, 0x3C, 0xF5,
-    0x76, 0x25, 0x1B, 0xA9, 0x74, 0xE2, 0xBC, 0x67, 0x91, 0x8E, 0x5D, 0x3E, 0xE1, 0x23, 0x34, 0x40,
-    0xD8, 0x9C, 0x17, 0x7C, 0x35, 0x38, 0x38, 0xA8, 0x0C, 0x15, 0x94, 0x36, 0x70, 0x97, 0xBF, 0xFE,
-    0xF5, 0x9E, 0xA1, 0x12, 0x9E, 0x10, 0xD9, 0x0C, 0xE9, 0xAE, 0x50, 0x72, 0x32, 0xF0, 0xAB, 0xBC,
-    0x82, 0x3A, 0x10, 0xB7, 0x48, 0x98, 0x0E, 0x44, 0x50, 0xE7, 0x01, 0x7B, 0x15, 0x07, 0xCA, 0x77,
-    0x71, 0x20, 0xFF, 0x04, 0x07, 0xD2, 0x26, 0x97, 0x03, 0x49, 0x2B, 0x77, 0xC8, 0xAF, 0xF6, 0x01,
-    0x3C, 0xFD, 0x3D, 0xEF, 0x00, 0x37, 0x93, 0x87, 0x08, 0x8C, 0xF1, 0x6C, 0x4E, 0x6D, 0x3F, 0x86,
-    0x95, 0x41, 0x08, 0xD4, 0x42, 0x03, 0x87, 0x39, 0x5A, 0xE8, 0x6C, 0xBF, 0x92, 0xA7, 0x8D, 0xBE,
-    0x8F, 0x86, 0x3B, 0xC5, 0x7C, 0x9D, 0x8D, 0xB3, 0x4A, 0xD3, 0xD9, 0xFC, 0x1E, 0xBC, 0xE6, 0xA9,
-    0xD5, 0xAA, 0x2C, 0xAB, 0xA6, 0x58, 0x3B, 0x85, 0x09, 0x91, 0xFE, 0x54, 0x67, 0xA1, 0xF6, 0xB5,
-    0x8C, 0x01, 0x0D, 0x5E, 0x06, 0xE6, 0x07, 0xC1, 0x70, 0x6A, 0x24, 0x2E, 0x19, 0x81, 0x79, 0x66,
-    0x5E, 0x49, 0x73, 0x18, 0xD8, 0x84, 0x9A, 0x41, 0x0A, 0xFA, 0xD1, 0xF7, 0xF8, 0xAE, 0xD9, 0x9C,
-    0xB7, 0xAE, 0xBC, 0x82, 0x36, 0xAF, 0xE3, 0xE7, 0x9E, 0x53, 0xF6, 0x6D, 0x10, 0x50, 0x18, 0x4C,
-    0x86, 0xCC, 0x2E, 0x18, 0xE7, 0x79, 0x4F, 0x8B, 0xF3, 0xE4, 0xA7, 0x86, 0x7B, 0x7B, 0x5E, 0xF6,
-    0xCE, 0xEF, 0x6D, 0x21, 0x32, 0x08, 0x8D, 0xB6, 0xF6, 0xD7, 0x2C, 0x71, 0x33, 0x25, 0xB7, 0xB4,
-    0xF6, 0xCA, 0x26, 0xD5, 0xC5, 0x4B, 0x74, 0xF6, 0x32, 0x8F, 0xF4, 0x03, 0xD1, 0x8F, 0x06, 0xD9,
-    0x81, 0x94, 0xEE, 0xD7, 0x59, 0x2E, 0x00, 0x89, 0x64, 0x60, 0x77, 0xF2, 0x66, 0xE7, 0x4E, 0x54,
-    0x22, 0x17, 0x88, 0x7A, 0x65, 0xBE, 0x75, 0xEF, 0xD8, 0xD0, 0x7B, 0xC6, 0xCC, 0x26, 0x1A, 0x33,
-    0x8B, 0x2E, 0xCA, 0xA4, 0x2D, 0xD7, 0x62, 0x66, 0x67, 0x6F, 0x89, 0x38, 0x88, 0x18, 0xB6, 0xD0,
-    0xF6, 0x28, 0xE8, 0x70, 0x71, 0x0A, 0x15, 0x10, 0x15, 0xD6, 0x56, 0xF9, 0x3B, 0x08, 0x9E, 0xF5,
-    0x9E, 0x6B, 0xE5, 0xE4, 0x7F, 0x77, 0xDF, 0x98, 0x59, 0xC5, 0x6A, 0x20, 0x38, 0xA6, 0x1F, 0x2B,
-    0xAA, 0xD8, 0x53, 0x53, 0x1C, 0xE1, 0x94, 0x6A, 0x75, 0x6A, 0x98, 0xCF, 0x0F, 0xFF, 0x33, 0xE2,
-    0x5E, 0xF7, 0xDD, 0x31, 0x31, 0x38, 0x8A, 0xCE, 0xCB, 0xAF, 0x5C, 0xFD, 0xC7, 0xFC, 0xDA, 0x3A,
-    0xF7, 0x85, 0x63, 0x6B, 0xFC, 0xA9, 0x06, 0xC1, 0xDA, 0xC6, 0x7C, 0x7E, 0x74, 0xFF, 0xB4, 0xDC,
-    0xD4, 0x15, 0xD8, 0xA0, 0x45, 0x98, 0x1B, 0xBF, 0x07, 0x9F, 0xE5, 0x83, 0x24, 0xF3, 0x4E, 0x2F,
-    0x10, 0x6A, 0x8E, 0xC7, 0xF4, 0x19, 0xE0, 0xC0, 0x99, 0x3E, 0x88, 0x16, 0xC6, 0x4D, 0xA7, 0x4F,
-    0xB4, 0x76, 0x6C, 0xEF, 0x67, 0xE5, 0xEC, 0x5C, 0x6B, 0xAE, 0xCC, 0x8F, 0x29, 0x93, 0xD9, 0xB7,
-    0x79, 0xE3, 0x98, 0x31, 0x2B, 0x5F, 0xAE, 0x75, 0x4F, 0x41, 0x41, 0x90, 0xE3, 0xA8, 0x36, 0x22,
-    0x7C, 0x9A, 0x89, 0x9D, 0x30, 0x6C, 0x2C, 0x73, 0xCE, 0x49, 0xFD, 0x98, 0x90, 0xC5, 0x86, 0x78,
-    0x10, 0xAE, 0x5B, 0xCA, 0xFF, 0x8D, 0x27, 0x44, 0x90, 0x21, 0x5B, 0x0C, 0xB7, 0x88, 0xB5, 0x64,
-    0x47, 0xB7, 0x2B, 0x56, 0xBC, 0x9F, 0x8A, 0x3D, 0x2C, 0x72, 0x58, 0xEC, 0x77, 0x45, 0x0C, 0x7E,
-    0x74, 0x94, 0x17, 0x06, 0x2E, 0x0B, 0x89, 0xC1, 0x70, 0xB1, 0x28, 0x38, 0x17, 0x11, 0x09, 0x87,
-    0x40, 0x8E, 0x3D, 0xB1, 0xE2, 0x0C, 0x4B, 0xA0, 0x0F, 0xA9, 0xDA, 0x78, 0x9A, 0xA2, 0x5E, 0xC7,
-    0x3C, 0xB1, 0x98, 0xF6, 0xF3, 0x76, 0xA2, 0xBE, 0xCC, 0xB0, 0x64, 0xE2, 0xAB, 0x33, 0xB1, 0x25,
-    0x8D, 0xE6, 0xC3, 0xCA, 0x8E, 0x18, 0xB6, 0x35, 0x58, 0xBB, 0x59, 0x67, 0x63, 0xA6, 0x1A, 0x66,
-    0xDA, 0xC0, 0xC8, 0x8C, 0x7B, 0xBF, 0x48, 0x7B, 0x96, 0x90, 0xE3, 0xA4, 0x51, 0xA1, 0xF4, 0x53,
-    0x1B, 0xAB, 0x19, 0xED, 0x3C, 0x75, 0x7E, 0x0A, 0xB7, 0x94, 0xEF, 0xEC, 0xCD, 0x1D, 0x2D, 0x28,
-    0xF4, 0x1B, 0x1A, 0x00, 0xE4, 0xAD, 0xDC, 0x25, 0xA2, 0x5F, 0x86, 0x1A, 0xA2, 0x97, 0xB8, 0xBA,
-    0x1B, 0x70, 0x98, 0x2C, 0x68, 0x81, 0x81, 0xB6, 0x22, 0x07, 0x60, 0x79, 0xBF, 0x75, 0x4C, 0xB6,
-    0x13, 0xBC, 0xC3, 0xFB, 0x50, 0x05, 0xE4, 0xC6, 0xB0, 0x30, 0xA0, 0xC2, 0x95, 0xBD, 0xC1, 0x32,
-    0x37, 0xDE, 0x32, 0x4F, 0xD1, 0x31, 0x14, 0x57, 0xC1, 0xE8, 0x0B, 0xED, 0xE0, 0x58, 0x25, 0x1A,
-    0x6B, 0x20, 0xDF, 0x33, 0xD0, 0x74, 0x58, 0xC5, 0x61, 0x02, 0x85, 0xE7, 0xB5, 0x5F, 0xF5, 0x33,
-    0x92, 0x77, 0x66, 0x3C, 0xA0, 0x4D, 0x3E, 0x51, 0x37, 0xDC, 0xA6, 0xBE, 0xB2, 0x8B, 0x35, 0x9E,
-    0xD9, 0xF3, 0xB7, 0x19, 0x0C, 0x63, 0x93, 0x4F, 0xE9, 0x87, 0x1D, 0xE4, 0x85, 0x61, 0xEC, 0xEB,
-    0xF4, 0xFA, 0x12, 0x40, 0x84, 0xF7, 0x11, 0xAF, 0x09, 0x62, 0x96, 0x01, 0xCA, 0x36, 0x1A, 0xF9,
-    0x7C, 0x9B, 0x70, 0x18, 0x72, 0xBB, 0x9A, 0xC8, 0x5F, 0xE4, 0xDB, 0x3B, 0xF7, 0xDB, 0xAC, 0x1D,
-    0xF2, 0x73, 0xC0, 0xAD, 0x72, 0xF2, 0x9A, 0xE8, 0xE6, 0xDE, 0x26, 0x4A, 0x43, 0xB4, 0xAA, 0xFA,
-    0x3C, 0x0E, 0x19, 0xEC, 0x2B, 0x4A, 0xFF, 0x41, 0xE0, 0x26, 0x84, 0x2C, 0xC8, 0x84, 0xA2, 0xF5,
-    0x1F, 0xB0, 0xD4, 0xDF, 0x80, 0x2D, 0x22, 0x21, 0xB1, 0x2A, 0x0D, 0xA2, 0x54, 0xA7, 0x70, 0x07,
-    0x68, 0x90, 0xCC, 0xCB, 0xC2, 0x6C, 0xF0, 0xA6, 0x08, 0x88, 0xA8, 0xC7, 0x74, 0x14, 0xAC, 0x2B,
-    0x5C, 0xA1, 0x05, 0xDA, 0xA8, 0x5C, 0x76, 0xFB, 0x4D, 0xCD, 0x25, 0xAC, 0x69, 0x29, 0xC9, 0x9C,
-    0x1F, 0x81, 0x31, 0x0B, 0x91, 0x4B, 0xE2, 0x8E, 0x59, 0x6C, 0xAD, 0xBC, 0x75, 0x0C, 0x3A, 0x2A,
-    0xCE, 0x8F, 0xEC, 0x48, 0x9E, 0x7F, 0xD3, 0xF9, 0xA4, 0x1C, 0xED, 0x0F, 0x3E, 0x6F, 0x93, 0x00,
-    0xB0, 0x15, 0x6C, 0xC4, 0x45, 0x59, 0x41, 0x30, 0x45, 0xE4, 0x41, 0x59, 0x21, 0xEA, 0xB4, 0x42,
-    0xFA, 0x19, 0x32, 0xFB, 0xCB, 0xF7, 0x46, 0x17, 0x39, 0x5F, 0xDE, 0x1C, 0x5D, 0xB6, 0x7F, 0xF9,
-    0x36, 0x8E, 0x22, 0x6F, 0xBD, 0xAC, 0x52, 0x5C, 0x11, 0x21, 0xEE, 0xC1, 0xB7, 0x23, 0x02, 0x15,
-    0xA4, 0x31, 0xE5, 0x38, 0xA1, 0xF6, 0x3D, 0x9B, 0xD9, 0x39, 0xC1, 0xF8, 0x68, 0x60, 0xC6, 0xA3,
-    0x6F, 0x1F, 0x07, 0xC4, 0x2E, 0x5C, 0x80, 0x11, 0xF3, 0x36, 0x7C, 0xAC, 0x29, 0xF5, 0x6F, 0x00,
-    0xEC, 0x02, 0xE9, 0x00, 0xEB, 0x9E, 0x30, 0x17, 0x93, 0xE6, 0x75, 0x86, 0x73, 0xEE, 0x58, 0x07,
-    0x29, 0xDF, 0x22, 0xA0, 0x93, 0x95, 0x6F, 0xE4, 0x4C, 0x18, 0x37, 0x53, 0x08, 0x18, 0x51, 0x29,
-    0xA0, 0xBF, 0xF0, 0x16, 0x4C, 0x0D, 0x72, 0x3D, 0x6C, 0x29, 0x03, 0xF3, 0x8F, 0x17, 0xAC, 0x68,
-    0xA2, 0xB8, 0x9A, 0xF9, 0xF6, 0x7B, 0xC3, 0x1F, 0xCB, 0x84, 0x68, 0x7F, 0x23, 0x30, 0xB8, 0x0C,
-    0xA3, 0xD6, 0x11, 0xD8, 0x54, 0x53, 0x64, 0x6B, 0xE0, 0x25, 0xDF, 0x63, 0x94, 0x6C, 0xA3, 0x29,
-    0xF5, 0xBA, 0xEB, 0x32, 0xF0, 0x54, 0xCF, 0x42, 0xE8, 0xCF, 0x0E, 0x2E, 0xBC, 0x6C, 0xBF, 0x63,
-    0xBF, 0x1B, 0xC8, 0xBD, 0xA0, 0x66, 0x6B, 0x39, 0x2A, 0xF6, 0x66, 0x73, 0x3C, 0x13, 0x81, 0x71,
-    0x30, 0x21, 0xA0, 0x49, 0x65, 0x9A, 0x59, 0x19, 0xFB, 0xCD, 0xF1, 0xEF, 0xF6, 0xE0, 0xC2, 0xAF,
-    0xB4, 0x96, 0x5C, 0xE3, 0xAA, 0xB4, 0xB8, 0xCD, 0x1B, 0x8C, 0x6D, 0x88, 0x46, 0x17, 0xAD, 0x02,
-    0x04, 0x58, 0x68, 0xA1, 0x16, 0x20, 0x40, 0x4B, 0x23, 0x05, 0x70, 0x2C, 0xD2, 0xBA, 0x29, 0x2D,
-    0x9D, 0x11, 0x8C, 0x23, 0x1B, 0x29, 0x5A, 0x69, 0x9A, 0x08, 0xC6, 0x7A, 0x56, 0x8E, 0xE7, 0x48,
-    0x17, 0x28, 0xDD, 0x55, 0x66, 0xA3, 0xDC, 0x3E, 0xE3, 0xF2, 0x04, 0x20, 0x1B, 0x21, 0x27, 0x05,
-    0xB1, 0x9A, 0x75, 0x08, 0x7A, 0xEB, 0x72, 0x49, 0x33, 0x8F, 0x39, 0x76, 0xF9, 0x07, 0x72, 0x17,
-    0x98, 0xA1, 0xB4, 0x20, 0x9E, 0xD0, 0x55, 0x44, 0xBC, 0x7D, 0x88, 0x9D, 0xA8, 0x1E, 0x82, 0xD4,
-    0xD3, 0x0C, 0xF9, 0x62, 0xC8, 0x09, 0x8B, 0x48, 0xAE, 0x19, 0xBD, 0xCD, 0x7B, 0x7A, 0x48, 0xCB,
-    0xC5, 0x39, 0x29, 0x23, 0x93, 0x8E, 0x58, 0x00, 0xFC, 0x30, 0xDD, 0x5B, 0xC5, 0x3C, 0x6F, 0x3D,
-    0x56, 0x06, 0x40, 0xDF, 0x35, 0x40, 0x0E, 0x38, 0x85, 0x69, 0xDF, 0xE6, 0x4B, 0x6F, 0x9A, 0x48,
-    0x0C, 0x0C, 0xEC, 0xA3, 0xA4, 0x9E, 0x30, 0x31, 0x3A, 0x1C, 0x4A, 0x1E, 0x38, 0x32, 0x12, 0x83,
-    0x35, 0x19, 0x15, 0xB3, 0x04, 0xA9, 0x63, 0xBC, 0x15, 0x4B, 0x7C, 0x55, 0x50, 0x97, 0x11, 0x68,
-    0xD7, 0xB0, 0x68, 0x9E, 0xAB, 0xC2, 0x59, 0x03, 0xE7, 0xE3, 0x61, 0x32, 0xCC, 0xC3, 0xA4, 0xCE,
-    0x6A, 0x1A, 0x0B, 0x0B, 0x9B, 0x59, 0xB6, 0x75, 0x1E, 0x4E, 0x06, 0x11, 0x9C, 0x01, 0x1A, 0x04,
-    0x75, 0xA0, 0x25, 0xED, 0x54, 0x9F, 0x0D, 0xA7, 0x57, 0xC4, 0x6E, 0xB8, 0xFD, 0xEC, 0x6B, 0xD4,
-    0x32, 0xE2, 0xDD, 0x5D, 0xEB, 0x6B, 0x4D, 0x2B, 0x8C, 0x43, 0x4B, 0x57, 0x43, 0xCB, 0xFC, 0x5F,
-    0xD8, 0x0E, 0x59, 0x10, 0xA1, 0x60, 0xBC, 0x4A, 0xCD, 0x8A, 0x08, 0x9A, 0xEB, 0x3B, 0xDE, 0xE7,
-    0x00, 0xC2, 0x0A, 0x0A, 0x5A, 0x33, 0x29, 0x6B, 0xBB, 0x00, 0x15, 0x84, 0x13, 0x6C, 0xBD, 0xFE,
-    0x60, 0xB7, 0xBA, 0x73, 0x4C, 0x4B, 0x94, 0xE6, 0x38, 0xC0, 0x22, 0x87, 0xA5, 0xBD, 0x4D, 0xCB,
-    0xA8, 0xAB, 0x67, 0x7A, 0xCF, 0x42, 0xA7, 0x6B, 0x07, 0xE2, 0x76, 0x0A, 0x03, 0x46, 0x92, 0x29,
-    0xC0, 0x78, 0xDF, 0x4D, 0x27, 0x61, 0xDB, 0xE5, 0xE6, 0xD6, 0xF9, 0xFD, 0xCF, 0xB5, 0x5B, 0xD8,
-    0x44, 0x5C, 0x26, 0x7A, 0x58, 0x6B, 0x72, 0xAA, 0xE3, 0x22, 0xC9, 0xBD, 0x37, 0xBD, 0x2D, 0x45,
-    0xC8, 0xB2, 0x99, 0xEA, 0x5B, 0x96, 0x93, 0xB5, 0x97, 0x50, 0x98, 0xE7, 0x0F, 0x11, 0xA0, 0xF7,
-    0x39, 0xB0, 0x74, 0x08, 0x09, 0x17, 0xDB, 0xDB, 0x6E, 0x9F, 0xE5, 0x5B, 0x9B, 0x5D, 0xAD, 0x75,
-    0x61, 0xAF, 0xAB, 0x76, 0x7B, 0xCB, 0xEE, 0x39, 0xE7, 0xBE, 0xAD, 0x75, 0x65, 0x3E, 0x53, 0x97,
-    0x72, 0x13, 0x39, 0x07, 0x9C, 0xF3, 0x36, 0xB3, 0x82, 0xD9, 0x54, 0x5A, 0x66, 0x8A, 0x8A, 0x5F,
-    0x6A, 0x73, 0x93, 0xBC, 0x99, 0xDE, 0x75, 0xC2, 0x77, 0x8F, 0xEA, 0x09, 0xAE, 0x74, 0x41, 0x4A,
-    0x39, 0xDA, 0xF9, 0xC9, 0x78, 0x82, 0xFC, 0xC1, 0x94, 0x6F, 0x3F, 0x52, 0x71, 0x34, 0x85, 0x48,
-    0xA9, 0x77, 0xF0, 0x80, 0x63, 0x84, 0xC7, 0x8E, 0x3E, 0x82, 0xB2, 0xA9, 0x12, 0xEE, 0xC6, 0xD5,
-    0x4A, 0xD3, 0x13, 0x58, 0x5A, 0x73, 0xAD, 0x7A, 0xD1, 0x32, 0x58, 0x75, 0x72, 0x1D, 0xA9, 0x05,
-    0x88, 0x52, 0xAB, 0xCB, 0xB2, 0x76, 0x1E, 0x32, 0xA7, 0x90, 0xBB, 0xEF, 0x68, 0x72, 0x22, 0x1D,
-    0xC8, 0x56, 0xB6, 0xDC, 0x65, 0x21, 0x07, 0x57, 0x13, 0x15, 0xE6, 0x47, 0x81, 0x6D, 0x01, 0xB2,
-    0x88, 0x07, 0x32, 0xBB, 0x95, 0x44, 0x50, 0xAD, 0x93, 0x9E, 0xBD, 0xC2, 0x43, 0x96, 0x87, 0x21,
-    0xE6, 0xE2, 0x10, 0xB4, 0xAD, 0x1A, 0x37, 0x7B, 0x43, 0x73, 0xED, 0x4F, 0x8E, 0x54, 0xF8, 0x79,
-    0x15, 0xB4, 0x36, 0xB9, 0x22, 0xA6, 0xE4, 0x6B, 0xF2, 0x77, 0x47, 0x57, 0xE9, 0x66, 0xE5, 0x27,
-    0x50, 0xAF, 0x81, 0xC6, 0x96, 0x9E, 0x8E, 0xB5, 0x58, 0x8B, 0x6D, 0x96, 0x29, 0x46, 0x93, 0x43,
-    0x2C, 0x1F, 0xF7, 0x98, 0x0B, 0x66, 0x4A, 0xEF, 0xD8, 0xF2, 0xA5, 0x7D, 0x16, 0x74, 0x0A, 0x6C,
-    0xF5, 0x04, 0xDD, 0x69, 0xDE, 0x51, 0xC6, 0xA6, 0x8A, 0xC4, 0x06, 0xEC, 0xAD, 0x90, 0x67, 0x04,
-    0xF6, 0xE2, 0xDB, 0xCD, 0x2E, 0x6D, 0x82, 0x21, 0xEC, 0x11, 0xAD, 0x16, 0xEC, 0x69, 0x11, 0x16,
-    0x96, 0xB6, 0x41, 0x2F, 0xB2, 0x72, 0xEF, 0x0F, 0x51, 0x17, 0x0B, 0xBD, 0x4C, 0x44, 0xF5, 0x45,
-    0xAA, 0x59, 0x80, 0x74, 0x9C, 0x85, 0x73, 0x76, 0xA1, 0x7D, 0x5D, 0xFD, 0x5F, 0x1A, 0x1A, 0x01,
-    0xC0, 0x26, 0x2A, 0xD8, 0x1D, 0x33, 0xDE, 0x6B, 0xCE, 0xDD, 0x4E, 0xC7, 0x7B, 0x68, 0x69, 0xDD,
-    0xF9, 0x73, 0x88, 0x5A, 0xEA, 0x84, 0x44, 0x7C, 0x76, 0x8A, 0x30, 0xF5, 0xF4, 0x66, 0x9F, 0xD7,
-    0xF9, 0x4B, 0x68, 0xBE, 0x33, 0xA0, 0x11, 0x0E, 0x2E, 0x3F, 0xD3, 0x26, 0x7D, 0x4B, 0x7A, 0x90,
-    0x40, 0xEB, 0x76, 0x91, 0xE8, 0x57, 0xBC, 0xA9, 0xA8, 0x98, 0xDC, 0xEC, 0x68, 0xB8, 0x0E, 0x0D,
-    0x16, 0x54, 0x82, 0xC8, 0xB6, 0xA7, 0x16, 0x71, 0x88, 0x5A, 0xC4, 0xD1, 0xBD, 0x0A, 0x2A, 0xA5,
-    0xFB, 0xD5, 0x52, 0xEA, 0xA6, 0x93, 0x5D, 0x41, 0x25, 0xAD, 0x45, 0xEC, 0xDD, 0x55, 0x50, 0x69,
-    0x83, 0xFE, 0xDF, 0xB8, 0x9A, 0x4C, 0x7F, 0xCC, 0x0C, 0xF1, 0x71, 0xF5, 0x73, 0xDD, 0x54, 0x9A,
-    0x88, 0x83, 0xF8, 0x42, 0x86, 0xF0, 0x4F, 0xC6, 0x38, 0x4D, 0xC9, 0x1E, 0x91, 0xDD, 0x6A, 0x12,
-    0x18, 0xC0, 0x5B, 0x97, 0xF0, 0xD1, 0xEC, 0x31, 0x7E, 0xAF, 0x0C, 0xE0, 0x7F, 0x14, 0x89, 0xC4,
-    0x16, 0xAA, 0x23, 0xAD, 0x67, 0xC2, 0x22, 0xAB, 0x9C, 0xD2, 0xFD, 0xAE, 0x52, 0xEC, 0x81, 0x32,
-    0x63, 0x37, 0xF1, 0x9A, 0x22, 0xC4, 0x82, 0x3E, 0xDC, 0x79, 0x58, 0xF5, 0x9D, 0xAE, 0x1C, 0x55,
-    0x9D, 0x51, 0xAB, 0xDD, 0x32, 0x53, 0xD2, 0x3E, 0xD0, 0xE5, 0x4A, 0x69, 0x68, 0x47, 0x80, 0x51,
-    0x61, 0x3C, 0x44, 0x93, 0xCD, 0xE7, 0x24, 0xF3, 0xEE, 0xD9, 0x10, 0x61, 0x24, 0x50, 0x17, 0x44,
-    0xA3, 0x1B, 0xB4, 0x4D, 0x79, 0xFB, 0x6F, 0x3C, 0x7E, 0xA6, 0x44, 0xCD, 0xD5, 0x1F, 0xF7, 0xCE,
-    0xDF, 0x6B, 0x6B, 0xC6, 0x34, 0x83, 0x1E, 0x77, 0x5A, 0xFD, 0x4E, 0x64, 0x70, 0x88, 0x1B, 0xD4,
-    0x99, 0x3E, 0x60, 0x1D, 0x4A, 0xF5, 0x6C, 0x4C, 0x89, 0xA0, 0x81, 0xBE, 0xD9, 0xD2, 0x89, 0xF2,
-    0x20, 0x8E, 0x8E, 0xF5, 0x9D, 0x9A, 0x62, 0x4B, 0xE3, 0x0D, 0x1D, 0xBA, 0x39, 0x86, 0x5C, 0x23,
-    0x45, 0xAB, 0x68, 0x40, 0x39, 0x0D, 0x04, 0x30, 0x20, 0xE8, 0x51, 0xFA, 0x79, 0x12, 0x24, 0xEE,
-    0xAD, 0xC1, 0x49, 0xF9, 0xA8, 0x12, 0xA7, 0x9D, 0xA0, 0xC7, 0x23, 0xD6, 0x38, 0xFD, 0x85, 0x0B,
-    0xB6, 0xF0, 0x35, 0xC6, 0xC0, 0x3C, 0x48, 0xF3, 0x15, 0x03, 0xE1, 0x71, 0xA4, 0x8A, 0xD0, 0x36,
-    0xA5, 0x1E, 0x6B, 0x20, 0x9B, 0xEE, 0xFC, 0x5D, 0x00, 0x81, 0x4A, 0xFB, 0xAA, 0xD9, 0x78, 0xDD,
-    0x5E, 0x2F, 0xF6, 0x03, 0x82, 0x16, 0xD0, 0x82, 0x6B, 0xAB, 0x74, 0x16, 0x03, 0xF5, 0x3D, 0x1A,
-    0x2D, 0xA1, 0x65, 0x34, 0x32, 0x44, 0x6B, 0x68, 0xB1, 0xCC, 0xDB, 0x54, 0x44, 0x4B, 0x2B, 0x61,
-    0xB8, 0x2A, 0x5A, 0x01, 0xCD, 0xA5, 0x2E, 0x12, 0xC1, 0x3A, 0x15, 0x1A, 0xAF, 0x8B, 0x32, 0x26,
-    0xAE, 0x90, 0x16, 0xB4, 0x6E, 0x66, 0x30, 0xFA, 0x54, 0xDB, 0x4C, 0x4E, 0x73, 0x80, 0xF4, 0x2E,
-    0x20, 0x97, 0xBC, 0xC0, 0x18, 0x81, 0x4F, 0x69, 0x29, 0x7D, 0xA0, 0x3C, 0x66, 0xBB, 0x16, 0x60,
-    0x87, 0x49, 0x0E, 0x19, 0x1E, 0x2F, 0xC2, 0x5C, 0x1C, 0x5F, 0x24, 0xEF, 0xC2, 0xE4, 0x9F, 0xAA,
-    0xDC, 0x56, 0xB9, 0xA2, 0x67, 0x70, 0x27, 0x3B, 0xAB, 0x09, 0xE5, 0xD0, 0x52, 0x8B, 0x9A, 0xF5,
-    0x34, 0x69, 0x14, 0xA8, 0x69, 0x87, 0x62, 0x51, 0x42, 0x90, 0x71, 0x2F, 0xFB, 0x32, 0x72, 0xF3,
-    0x3E, 0x46, 0x00, 0x43, 0xB7, 0xB4, 0x33, 0x90, 0xBD, 0xD2, 0xD2, 0x10, 0xED, 0xD9, 0xF9, 0xE4,
-    0xE9, 0x9C, 0x76, 0x49, 0x0D, 0x07, 0x7D, 0xC7, 0xD2, 0x96, 0x0A, 0x7D, 0x86, 0x05, 0xF2, 0x45,
-    0x2A, 0x3C, 0x78, 0xDC, 0xCE, 0x11, 0x66, 0xA4, 0xF6, 0x98, 0x8C, 0xB3, 0x37, 0x1C, 0x54, 0xC7,
-    0x80, 0xD0, 0x08, 0x08, 0x3F, 0x9C, 0xC3, 0x77, 0x8E, 0x19, 0x17, 0xED, 0xEC, 0x82, 0x9F, 0x2B,
-    0x97, 0x41, 0xA5, 0x05, 0xFB, 0xA7, 0x90, 0x9A, 0xA4, 0x9D, 0xD2, 0xCC, 0xCC, 0x9A, 0xF0, 0x6A,
-    0xC2, 0xFB, 0x1F, 0x26, 0xF1, 0x7A, 0x99, 0xC1, 0xDF, 0x1D, 0x83, 0xED, 0xF1, 0xE3, 0x50, 0xB9,
-    0xFD, 0x5A, 0x09, 0x07, 0x2D, 0xAF, 0x46, 0xE4, 0xEF, 0x97, 0xFD, 0xB1, 0x75, 0xDE, 0x6E, 0xB9,
-    0xD8, 0x6A, 0x17, 0x6F, 0x9D, 0x4E, 0xF2, 0xDA, 0x64, 0x29, 0x49, 0x3E, 0xE7, 0x87, 0x77, 0x8E,
-    0x25, 0xA6, 0x15, 0xDD, 0x5B, 0x8D, 0x71, 0xCF, 0xBE, 0xDC, 0x8F, 0xC5, 0x06, 0x6D, 0x1C, 0x4B,
-    0xD0, 0xB5, 0xAE, 0x48, 0x32, 0x62, 0xBA, 0xC0, 0x94, 0xBC, 0x4C, 0x3D, 0xC9, 0xCA, 0x2F, 0xCD,
-    0xF4, 0x03, 0xA1, 0xB4, 0xCA, 0x1C, 0x1C, 0x67, 0xD8, 0xFD, 0x63, 0x0A, 0x16, 0x0D, 0x1F, 0xEC,
-    0x07, 0xA6, 0x81, 0x2A, 0x7D, 0x4C, 0x81, 0xBA, 0xDF, 0x26, 0x4A, 0x87, 0x7C, 0xB7, 0x74, 0x2A,
-    0xC4, 0xCC, 0x6A, 0x75, 0x1C, 0xD4, 0x80, 0x3B, 0x70, 0x54, 0x87, 0x95, 0x83, 0x19, 0x42, 0xB5,
-    0x35, 0x34, 0x18, 0x85, 0x6E, 0x5E, 0x70, 0x3A, 0x13, 0xB9, 0x93, 0x7B, 0x6F, 0x7A, 0xE7, 0xCA,
-    0xCF, 0xA9, 0xAA, 0xF9, 0x75, 0x34, 0xDF, 0x9F, 0x9A, 0x0A, 0x4D, 0x8D, 0xA6, 0xFD, 0xFE, 0x26,
-    0xEB, 0x0C, 0x93, 0xE9, 0x21, 0x29, 0x93, 0xD6, 0x50, 0x54, 0xFD, 0xF9, 0x19, 0x10, 0xF9, 0xFB,
-    0xFB, 0x34, 0x5F, 0xDF, 0xE3, 0xAF, 0x20, 0x01, 0x28, 0x3F, 0x04, 0x6D, 0x3C, 0xD5, 0x6B, 0x78,
-    0x07, 0x74, 0xC4, 0x4C, 0x76, 0x85, 0x2F, 0xCA, 0xAE, 0x6F, 0x63, 0xD7, 0x4F, 0xD3, 0x0E, 0xD6,
-    0xF2, 0x0F, 0xAC, 0xF3, 0x4E, 0x8C, 0x33, 0x3B, 0x6E, 0x76, 0xE6, 0xB9, 0x5A, 0x08, 0xAF, 0x9C,
-    0x55, 0x98, 0x6F, 0x43, 0x54, 0xFA, 0x29, 0xD5, 0x8E, 0x92, 0x81, 0x0F, 0x85, 0x4E, 0xEE, 0x07,
-    0x63, 0x6A, 0x9B, 0xAA, 0x06, 0x31, 0xC6, 0x88, 0xF5, 0xB3, 0xE0, 0xD8, 0x78, 0x25, 0xD6, 0xE8,
-    0xA4, 0xCB, 0xD6, 0x45, 0xA6, 0x50, 0x0F, 0x67, 0x71, 0x25, 0x8D, 0xCC, 0x49, 0xEE, 0xB3, 0xF3,
-    0x60, 0xE6, 0x26, 0x1C, 0x06, 0x66, 0xBF, 0x0D, 0xEF, 0x15, 0x9C, 0xDF, 0x85, 0x83, 0xCC, 0x01,
-    0x40, 0xF0, 0x65, 0x7B, 0xA7, 0xEC, 0x4B, 0x11, 0x9A, 0xDF, 0x42, 0x90, 0x05, 0x68, 0xF8, 0x7B,
-    0x50, 0x0F, 0xE5, 0x65, 0xCA, 0xF7, 0x10, 0x62, 0x09, 0x5B, 0xD2, 0xE7, 0x6D, 0xDC, 0x15, 0x9A,
-    0x48, 0x21, 0x4E, 0x15, 0xA2, 0x42, 0xBF, 0x18, 0x4B, 0x9E, 0xC5, 0x56, 0x45, 0xBF, 0xF2, 0xFD,
-    0x81, 0x31, 0x63, 0x7D, 0x79, 0x98, 0x8E, 0xBB, 0xFC, 0x6D, 0x86, 0x07, 0xDD, 0x1C, 0x91, 0x3B,
-    0xB4, 0xB9, 0xE3, 0xAA, 0x25, 0x69, 0x21, 0x69, 0x26, 0x41, 0x63, 0xC6, 0xBE, 0x60, 0xB7, 0xB7,
-    0xB6, 0xB6, 0xCE, 0x4E, 0x3A, 0x5E, 0x60, 0xCD, 0x1A, 0x19, 0x57, 0xD9, 0x12, 0x7B, 0xE5, 0x81,
-    0x7F, 0x43, 0x37, 0xE7, 0xC6, 0xE8, 0x54, 0xB1, 0x42, 0x6B, 0x17, 0xD5, 0x6A, 0x89, 0xAE, 0xCD,
-    0xD2, 0x47, 0x38, 0x29, 0x2B, 0xCF, 0x67, 0xEC, 0xBA, 0x86, 0x5D, 0xBA, 0xD3, 0x31, 0xE3, 0x2B,
-    0xE1, 0xA8, 0x88, 0x3D, 0xE9, 0xD2, 0x93, 0x30, 0xF8, 0xA4, 0x80, 0x0C, 0x4B, 0x18, 0xDA, 0x9E,
-    0xA2, 0xB9, 0xD6, 0x3B, 0xE8, 0xA7, 0x65, 0x03, 0xC6, 0x55, 0xB7, 0xC0, 0xA2, 0xBE, 0x85, 0x18,
-    0x84, 0xE3, 0xCD, 0x14, 0xFD, 0x92, 0x58, 0x65, 0x1E, 0x0C, 0x37, 0x3E, 0x70, 0xD4, 0xFC, 0x8B,
-    0x05, 0x9A, 0xB3, 0x5C, 0x4E, 0xE6, 0x88, 0x61, 0xBD, 0xE8, 0xE7, 0x14, 0xCE, 0xB6, 0xFB, 0xE0,
-    0x6F, 0x1F, 0xBE, 0xEA, 0x5E, 0xBD, 0x7F, 0x7B, 0xA8, 0x90, 0x2B, 0x15, 0x6C, 0xEF, 0x41, 0xA5,
-    0x79, 0xF0, 0xD5, 0x43, 0x92, 0x65, 0x59, 0x44, 0xBB, 0xAE, 0x30, 0x9A, 0xB2, 0x50, 0x10, 0xE8,
-    0xFD, 0xA3, 0xB1, 0x74, 0x01, 0x77, 0x2E, 0x8A, 0x22, 0xB4, 0xFB, 0xC4, 0x78, 0x99, 0x7F, 0x2D,
-    0x65, 0xCA, 0xB7, 0xB2, 0x17, 0x54, 0xB6, 0x21, 0x69, 0x0F, 0x07, 0x45, 0x01, 0x67, 0x2F, 0x98,
-    0xCC, 0x03, 0x9B, 0xAF, 0xED, 0xF7, 0xFE, 0x50, 0xDE, 0x7D, 0x2D, 0x16, 0x66, 0x34, 0x59, 0x0B,
-    0xE5, 0x4A, 0x5D, 0x99, 0x1E, 0x4D, 0x45, 0xEC, 0x18, 0xC4, 0x0D, 0x7A, 0x57, 0x56, 0x3A, 0x39,
-    0x1A, 0x35, 0x2D, 0xB4, 0xCB, 0xB7, 0x9C, 0xD9, 0x9B, 0x23, 0xB3, 0x9F, 0x2E, 0x8C, 0xB4, 0xE8,
-    0x56, 0x08, 0xC7, 0xC7, 0x42, 0x03, 0x35, 0xCB, 0xCB, 0x44, 0x9D, 0x88, 0x75, 0x29, 0xC2, 0xD9,
-    0x4B, 0x14, 0x2D, 0x12, 0xF8, 0x22, 0x9E, 0x1F, 0x45, 0xD1, 0x2A, 0xBA, 0xF1, 0xF0, 0x1A, 0x03,
-    0xEB, 0xF9, 0xFB, 0x2A, 0x0B, 0x22, 0xAC, 0x8C, 0x31, 0x72, 0x8C, 0x80, 0x86, 0x18, 0x9D, 0x69,
-    0x20, 0xA4, 0x0B, 0x19, 0x55, 0x1F, 0xDF, 0xAF, 0xCD, 0x2A, 0xD9, 0x52, 0xF3, 0x23, 0x0E, 0xDB,
-    0x57, 0x8F, 0x33, 0x9A, 0x3E, 0x19, 0x49, 0xA2, 0x21, 0x6F, 0xC3, 0x93, 0xAD, 0x6B, 0x34, 0x68,
-    0x9D, 0x49, 0x96, 0x99, 0x64, 0x95, 0xC9, 0x60, 0x5C, 0xCA, 0x42, 0x6A, 0x0A, 0x6A, 0xCC, 0xEF,
-    0x7B, 0x2A, 0x17, 0x30, 0x43, 0xB5, 0x77, 0x02, 0xA6, 0x26, 0x1E, 0x4E, 0xD6, 0x15, 0xC6, 0xC9,
-    0xC9, 0xA4, 0x49, 0x7B, 0x57, 0xF8, 0x0B, 0xD5, 0x70, 0x5F, 0x44, 0xD1, 0x8B, 0x58, 0x23, 0x16,
-    0x79, 0x91, 0x37, 0xB9, 0xE4, 0xE1, 0xA3, 0x91, 0xD9, 0x36, 0x9E, 0xA7, 0x0D, 0x05, 0x17, 0xAE,
-    0xAA, 0x5A, 0xA1, 0x92, 0x10, 0x2D, 0x27, 0x9C, 0xC2, 0x9C, 0x6A, 0x1A, 0xAD, 0xBF, 0x30, 0x47,
-    0x93, 0xC1, 0xD9, 0xDE, 0xD5, 0xB0, 0xD7, 0xAE, 0xD9, 0x49, 0x34, 0xCB, 0x75, 0x5A, 0xE2, 0xC6,
-    0x7D, 0xE9, 0x6A, 0x29, 0x58, 0x75, 0xA0, 0x54, 0x7F, 0x11, 0xCD, 0xB7, 0xDD, 0xFA, 0x57, 0xDC,
-    0xAE, 0x7F, 0xE9, 0xEA, 0x34, 0x2E, 0xD0, 0x71, 0xCF, 0x17, 0xEB, 0xD2, 0x91, 0xA2, 0x68, 0x66,
-    0xE6, 0x54, 0xEE, 0x7F, 0xF5, 0x05, 0x63, 0x55, 0x7A, 0xEB, 0x58, 0xA9, 0xFA, 0xF2, 0xF4, 0xA5,
-    0xD5, 0x26, 0x4A, 0xBA, 0x9F, 0xDB, 0x03, 0xAB, 0x30, 0x8B, 0xC9, 0xA5, 0xBC, 0xF2, 0xBC, 0xAC,
-    0x28, 0xA1, 0x33, 0x7B, 0xF9, 0xCB, 0x9C, 0xA4, 0xD4, 0x05, 0xA3, 0xAF, 0xB5, 0xD7, 0x61, 0x76,
-    0x4F, 0x2B, 0x96, 0xB1, 0x5C, 0xAC, 0xDA, 0x72, 0xA1, 0x4B, 0xDE, 0xB0, 0x2D, 0x96, 0x2D, 0x4B,
-    0x15, 0xBB, 0x85, 0x7D, 0x74, 0xF6, 0xB0, 0xF4, 0xE3, 0x39, 0xAB, 0xDE, 0x22, 0x04, 0xA3, 0x0C,
-    0xF0, 0xA9, 0xD8, 0xFE, 0xC0, 0xB4, 0x08, 0x8C, 0x0B, 0x4A, 0xD3, 0x98, 0x91, 0x78, 0x2D, 0x65,
-    0x46, 0x3D, 0x93, 0x87, 0x8A, 0x2F, 0xB6, 0x82, 0xC8, 0x95, 0xF9, 0x89, 0x7B, 0x15, 0x36, 0x7F,
-    0xE0, 0x05, 0x45, 0xB4, 0x88, 0xF7, 0xE4, 0xBE, 0x56, 0x03, 0x44, 0xAF, 0x08, 0x9A, 0x68, 0xD0,
-    0xA0, 0x56, 0xD3, 0x31, 0x5C, 0xFC, 0x69, 0xE9, 0xC3, 0x0E, 0xA6, 0x78, 0x8A, 0x77, 0xEF, 0xB1,
-    0xE1, 0x8A, 0x03, 0xB9, 0x8D, 0xAD, 0xF3, 0xF7, 0x3D, 0xB9, 0x5E, 0xC9, 0x30, 0x34, 0x0B, 0xF5,
-    0xE6, 0x0F, 0x03, 0x7A, 0xDE, 0x20, 0x4A, 0x33, 0x08, 0xA6, 0x58, 0xAE, 0xFA, 0xF2, 0xBB, 0x34,
-    0xF2, 0xCF, 0x55, 0x59, 0x2C, 0xD7, 0x8C, 0xFC, 0x9F, 0xD9, 0xC9, 0x86, 0xE8, 0xE4, 0x5E, 0x17,
-    0xE2, 0x54, 0xAE, 0x29, 0xA5, 0x1A, 0x73, 0xAA, 0x01, 0x4E, 0x13, 0x7F, 0xF6, 0x58, 0xCA, 0x48,
-    0x0D, 0xF5, 0x31, 0x57, 0xEA, 0x20, 0x14, 0xF6, 0xD9, 0xBD, 0x4C, 0x20, 0xCC, 0xD4, 0xD8, 0x1F,
-    0x8F, 0x5B, 0xE5, 0x3D, 0xCE, 0x1E, 0x69, 0xFD, 0x46, 0x5D, 0x21, 0xE9, 0xDF, 0xC5, 0xD1, 0xC9,
-    0xEA, 0x26, 0x24, 0xBE, 0xA5, 0x8B, 0x65, 0x88, 0x92, 0xA2, 0x21, 0x99, 0x98, 0xEE, 0xD8, 0x38,
-    0x6B, 0xCA, 0x2F, 0x54, 0x0D, 0xBF, 0x42, 0x83, 0x78, 0x11, 0xDB, 0x7A, 0x25, 0x6A, 0x04, 0xAD,
-    0x0B, 0xEA, 0x22, 0x42, 0x3F, 0x23, 0xD4, 0x66, 0x4F, 0xFC, 0x90, 0x77, 0x7C, 0x74, 0xDA, 0xC3,
-    0xDE, 0x66, 0x59, 0x51, 0xE6, 0x9E, 0x8D, 0xD3, 0x68, 0x40, 0xED, 0xAF, 0xDE, 0x73, 0xC3, 0x5E,
-    0x85, 0x26, 0x93, 0x53, 0xB7, 0x46, 0x1C, 0x09, 0xD4, 0x18, 0xA7, 0xC5, 0x08, 0x7A, 0x6D, 0x9C,
-    0x67, 0xDD, 0xB5, 0x4A, 0x8B, 0x48, 0x70, 0xA3, 0x37, 0xEB, 0x09, 0x83, 0xEB, 0x1B, 0xB3, 0xB3,
-    0x6E, 0xFD, 0x83, 0xCA, 0x77, 0x32, 0x1A, 0x23, 0xFF, 0xC9, 0x05, 0x16, 0x1A, 0x5B, 0x47, 0x5A,
-    0x54, 0x69, 0x2E, 0xB4, 0x1C, 0x46, 0xAA, 0x0B, 0xC2, 0xEB, 0xAE, 0x0A, 0x69, 0xBB, 0x8A, 0x48,
-    0x39, 0xAC, 0x84, 0x50, 0xF9, 0x43, 0x5E, 0x04, 0xAD, 0x1C, 0x6E, 0x85, 0xD3, 0x5C, 0x40, 0x1C,
-    0x9D, 0xB0, 0x5D, 0xF8, 0xAD, 0xB8, 0x1C, 0x42, 0xE5, 0x8F, 0x51, 0x93, 0xBE, 0xC1, 0xA2, 0x40,
-    0x95, 0x05, 0x56, 0xD7, 0xE5, 0x49, 0x17, 0xDA, 0x9C, 0x2E, 0x70, 0xD8, 0x1F, 0x2C, 0xC8, 0x4C,
-    0x27, 0xEF, 0xC2, 0xC3, 0xB1, 0xF0, 0x6C, 0xC1, 0x42, 0x2E, 0x8C, 0x60, 0x77, 0x84, 0xD1, 0xA1,
-    0x6E, 0xEC, 0xD5, 0x8E, 0x96, 0x20, 0x4B, 0xEE, 0x1A, 0x4F, 0x35, 0xC1, 0xD2, 0xB5, 0xD8, 0xA4,
-    0xB5, 0x74, 0x04, 0x47, 0x22, 0x27, 0x2F, 0x80, 0x8B, 0xBA, 0x5B, 0x85, 0xDD, 0x31, 0xD9, 0x3B,
-    0x01, 0x0F, 0x01, 0x01, 0xAB, 0x3D, 0x4E, 0x3F, 0xD8, 0xE8, 0x17, 0x33, 0x66, 0x46, 0xE3, 0xCD,
-    0x8B, 0x60, 0x18, 0x4D, 0x8E, 0x12, 0x6C, 0xE9, 0x22, 0xB9, 0x24, 0x07, 0xDF, 0x6A, 0xA3, 0xCF,
-    0x46, 0x64, 0x5E, 0xC9, 0xBB, 0x16, 0x41, 0x9F, 0x5E, 0xE8, 0xC1, 0x75, 0xC3, 0x6E, 0x44, 0x59,
-    0xD0, 0x85, 0x2D, 0x0F, 0xCB, 0xC1, 0x26, 0x05, 0xA7, 0x0F, 0x44, 0xE2, 0xAB, 0x71, 0x50, 0xD8,
-    0x60, 0x24, 0xE8, 0xBA, 0x80, 0x3C, 0x62, 0x63, 0x16, 0x1E, 0xB1, 0x17, 0x85, 0x84, 0x0A, 0x50,
-    0xB5, 0xE3, 0x8A, 0xB4, 0x2E, 0xB2, 0x6E, 0x0A, 0xAD, 0x73, 0x02, 0xD8, 0xF4, 0x72, 0x4E, 0x08,
-    0x05, 0xF6, 0x7E, 0x55, 0x72, 0x5E, 0x52, 0x83, 0x3A, 0xC7, 0x4D, 0xCC, 0x5A, 0xF0, 0x65, 0xBD,
-    0x54, 0xC4, 0xCB, 0xBD, 0xFE, 0x83, 0x47, 0x6C, 0x6D, 0xA5, 0xD9, 0x39, 0xB3, 0x25, 0x93, 0x58,
-    0x58, 0x56, 0x87, 0x92, 0x62, 0x2E, 0xDE, 0xDB, 0x3B, 0xEF, 0x32, 0x57, 0x0E, 0xBE, 0xC2, 0xB8,
-    0xF3, 0x99, 0xB3, 0x8F, 0x34, 0xE1, 0x2F, 0x35, 0xF2, 0x43, 0x0D, 0x41, 0x07, 0x36, 0xBB, 0x0D,
-    0x0D, 0xBF, 0xB2, 0xA7, 0xEC, 0x36, 0x4C, 0x5A, 0xF1, 0x36, 0x64, 0x36, 0x64, 0x0C, 0x9C, 0x17,
-    0xF4, 0xFA, 0xD8, 0xFE, 0x48, 0x43, 0xD9, 0x04, 0xBD, 0xF2, 0x1F, 0xDA, 0x2E, 0xAA, 0xD7, 0x92,
-    0x1E, 0xC2, 0x3A, 0x41, 0x3C, 0x6F, 0x03, 0x7A, 0xA2, 0x6D, 0x54, 0x27, 0xC8, 0x0D, 0x90, 0x7F,
-    0x8F, 0x34, 0xC8, 0x14, 0xF3, 0x0D, 0xE7, 0x9D, 0x80, 0x2D, 0x69, 0xBC, 0x21, 0x68, 0x57, 0x01,
-    0xDE, 0x0F, 0x07, 0x64, 0x81, 0x93, 0xD4, 0x1D, 0xD2, 0xC5, 0x6A, 0xAB, 0x72, 0x96, 0x2B, 0x93,
-    0x5F, 0xB7, 0xAF, 0xCE, 0x8F, 0x0A, 0x28, 0x94, 0x67, 0xA0, 0x72, 0x0F, 0x85, 0x04, 0xFE, 0x44,
-    0x16, 0x07, 0xA3, 0x0D, 0xAA, 0x78, 0x98, 0x1F, 0x63, 0xB8, 0x0B, 0xB3, 0x9F, 0x0A, 0xE6, 0x38,
-    0xA7, 0xB4, 0x2A, 0x2F, 0xE0, 0x57, 0x1B, 0xB7, 0xCE, 0xBA, 0x22, 0x90, 0x54, 0x14, 0x74, 0xA1,
-    0x90, 0xA5, 0xD2, 0x89, 0x45, 0x47, 0x01, 0x9D, 0xC2, 0xAD, 0x43, 0x47, 0x06, 0xE5, 0xB9, 0x55,
-    0xF6, 0xD0, 0x1F, 0x81, 0x91, 0xE7, 0xAC, 0x7E, 0xCC, 0xC9, 0x42, 0xB6, 0xCD, 0x2B, 0x2C, 0xD6,
-    0x87, 0x9C, 0x8A, 0x92, 0x2A, 0xA8, 0x4B, 0xFE, 0xA9, 0x67, 0xD7, 0x84, 0x1A, 0xD2, 0xD9, 0x83,
-    0x3C, 0x8A, 0x82, 0xEC, 0x13, 0x32, 0xCD, 0x09, 0x68, 0x7A, 0x5E, 0x69, 0xA7, 0x25, 0xB2, 0xE8,
-    0xCA, 0xDC, 0x2E, 0x99, 0x5A, 0x5B, 0x29, 0x4D, 0xAE, 0x67, 0xEE, 0x7C, 0x5D, 0x4F, 0x81, 0x92,
-    0xE7, 0x0F, 0xED, 0x47, 0x25, 0x74, 0xBE, 0x94, 0x75, 0x70, 0xA0, 0x1E, 0x2E, 0x14, 0xFC, 0x42,
-    0x90, 0xC6, 0x0C, 0x95, 0xBA, 0x54, 0xB1, 0x0E, 0x3B, 0x21, 0xAD, 0x8B, 0xFC, 0x82, 0x2D, 0x51,
-    0x4D, 0x8F, 0x79, 0x73, 0xCB, 0x75, 0x3B, 0x6F, 0xAA, 0x30, 0x74, 0x53, 0xD7, 0xE0, 0x3A, 0xD2,
-    0x2F, 0x97, 0x28, 0x64, 0x1C, 0xDF, 0xFC, 0x98, 0xD6, 0xEF, 0x47, 0x69, 0xF1, 0x4B, 0x02, 0xA8,
-    0xB5, 0x63, 0x6B, 0x5F, 0xBB, 0xEE, 0x32, 0x3B, 0xE7, 0x6D, 0x09, 0x61, 0x40, 0x5C, 0xDA, 0x33,
-    0xD0, 0x98, 0xE8, 0xAB, 0x6D, 0xD6, 0x74, 0x9D, 0xBD, 0x15, 0xE6, 0xE0, 0x2A, 0x40, 0xB8, 0x02,
-    0x17, 0x1A, 0x83, 0xDE, 0x91, 0xAF, 0xC9, 0x42, 0xD8, 0x58, 0xC6, 0x40, 0xB6, 0x1A, 0x7D, 0xF5,
-    0x44, 0x64, 0x5F, 0x2D, 0x91, 0x44, 0xDE, 0x7A, 0x2E, 0x21, 0xAE, 0x5A, 0xAF, 0xAC, 0xFE, 0x14,
-    0xDE, 0x9D, 0x0B, 0x9D, 0x38, 0xC5, 0x8F, 0xC0, 0xCF, 0xA2, 0x3B, 0xD9, 0x53, 0xB6, 0x8A, 0x10,
-    0xD2, 0xD4, 0x3C, 0xB6, 0x34, 0x29, 0xAA, 0x21, 0x40, 0x73, 0xC3, 0xA2, 0xFE, 0xD0, 0xD6, 0x16,
-    0xF2, 0x97, 0x57, 0x55, 0x1A, 0xB5, 0xED, 0x45, 0xEA, 0x91, 0xFD, 0xEB, 0x8B, 0xCF, 0x80, 0x98,
-    0xA6, 0xBA, 0x7A, 0x04, 0x3C, 0x7F, 0x81, 0x13, 0x93, 0x16, 0x6E, 0xC1, 0x19, 0x4D, 0x68, 0xDA,
-    0xD0, 0x38, 0x74, 0x6A, 0x29, 0xDF, 0x20, 0x4E, 0x30, 0xD6, 0x91, 0xDD, 0xAE, 0xE2, 0xD3, 0x9B,
-    0x76, 0xB2, 0x39, 0xE8, 0x7A, 0x6E, 0x07, 0xE7, 0x73, 0xBB, 0xEB, 0xD5, 0x7B, 0x11, 0xF6, 0xED,
-    0x85, 0xC1, 0x2D, 0x05, 0xF3, 0x43, 0x7B, 0x85, 0x2A, 0xD5, 0xA0, 0x05, 0x09, 0xF2, 0xDD, 0xF5,
-    0xE4, 0xC3, 0x3A, 0x66, 0xF4, 0x07, 0x23, 0x6B, 0xD9, 0x86, 0x0D, 0xE8, 0x8A, 0xC9, 0xF6, 0xD2,
-    0x95, 0x47, 0x13, 0x3E, 0x7C, 0x58, 0x91, 0xA3, 0xC8, 0x0B, 0xC2, 0xE6, 0x45, 0x28, 0xEB, 0x43,
-    0x99, 0x59, 0x2E, 0xD9, 0x85, 0xA5, 0x1D, 0x05, 0x59, 0x0A, 0xCF, 0xD5, 0xEB, 0x1F, 0xBC, 0x3B,
-    0x1B, 0xBA, 0x44, 0x4B, 0x31, 0x2D, 0x85, 0xF7, 0xC6, 0x7C, 0x7E, 0x62, 0xB7, 0x28, 0x7D, 0x91,
-    0xA0, 0xAB, 0x88, 0x59, 0x69, 0x17, 0x0F, 0x27, 0x58, 0xB7, 0xA3, 0xF2, 0xD5, 0xD0, 0xDC, 0xED,
-    0x4E, 0x0D, 0x90, 0xBF, 0x5F, 0x78, 0x2E, 0xD4, 0x7E, 0xE1, 0x72, 0x04, 0x5B, 0x35, 0x5D, 0xF8,
-    0xFD, 0x72, 0xDD, 0xE1, 0x27, 0xFE, 0x15, 0x9B, 0x2C, 0xA6, 0x70, 0xCF, 0x2A, 0xE1, 0x0A, 0x27,
-    0xA8, 0xF1, 0x82, 0x07, 0xAB, 0xD5, 0x2A, 0x2D, 0xB4, 0x36, 0xF7, 0xFE, 0xEF, 0xFF, 0xBB, 0x36,
-    0x59, 0xB8, 0xE1, 0xEB, 0x38, 0x74, 0x60, 0xAB, 0x6E, 0xC8, 0x56, 0xC3, 0xB5, 0x21, 0x58, 0x3F,
-    0xC5, 0x12, 0x2F, 0x68, 0x52, 0xA3, 0x25, 0x71, 0x5A, 0x3A, 0x80, 0x22, 0x9F, 0xC0, 0xE8, 0xE0,
-    0x71, 0xE6, 0xD9, 0xD2, 0x3C, 0x37, 0x43, 0xDF, 0x5E, 0x20, 0x8E, 0x96, 0xAD, 0xCB, 0x57, 0x9B,
-    0x82, 0x3F, 0x93, 0xE1, 0x97, 0xA2, 0x41, 0x00, 0xC9, 0x40, 0xF4, 0x9F, 0xD1, 0x62, 0xA5, 0xC3,
-    0x0A, 0x97, 0xD3, 0xEC, 0x17, 0x02, 0xB9, 0x3E, 0xE8, 0xE3, 0x26, 0xAA, 0xD3, 0x85, 0xC3, 0x62,
-    0x50, 0x81, 0x4D, 0x5D, 0x44, 0x02, 0x6B, 0xF8, 0x45, 0xA7, 0xC1, 0x0B, 0xC8, 0xA9, 0xA9, 0x43,
-    0x51, 0xD9, 0xE2, 0x7C, 0xCC, 0xD0, 0x0F, 0xA3, 0x0B, 0xED, 0xA0, 0xC6, 0xFC, 0xF5, 0xF3, 0x28,
-    0xB6, 0x8B, 0x04, 0xB0, 0xB7, 0x41, 0x44, 0x80, 0xB7, 0xD1, 0x54, 0xB2, 0x0F, 0x35, 0x3D, 0x34,
-    0x88, 0xFF, 0xC0, 0xFC, 0x04, 0xEB, 0xC4, 0x36, 0xAE, 0xB3, 0xB4, 0x3A, 0x58, 0x17, 0x1C, 0x10,
-    0xC0, 0xAC, 0x1A, 0xBB, 0xD5, 0x80, 0x0A, 0xB3, 0xE5, 0x96, 0xE5, 0x5A, 0x56, 0xA5, 0x6C, 0x9D,
-    0x11, 0xC0, 0xB7, 0x5F, 0xCB, 0xB0, 0x64, 0xE3, 0x58, 0xAE, 0x2D, 0x61, 0xC1, 0xD4, 0xDA, 0x95,
-    0x99, 0x76, 0xD7, 0x63, 0xDB, 0xC7, 0x45, 0x25, 0x5C, 0x28, 0xA9, 0xE0, 0x74, 0x4C, 0x97, 0x1B,
-    0xAD, 0xDB, 0xA0, 0xB5, 0x26, 0x9F, 0x2C, 0x38, 0xDE, 0xB3, 0x8A, 0xC1, 0xAD, 0xEB, 0xE2, 0x1E,
-    0xFF, 0x7D, 0xDE, 0x20, 0x92, 0xE3, 0xA5, 0x6B, 0x26, 0xE7, 0xAA, 0x97, 0x5C, 0x1B, 0x57, 0x4D,
-    0xA4, 0xCC, 0x41, 0x34, 0x42, 0x26, 0xDD, 0x8B, 0x04, 0xAE, 0xBC, 0xCF, 0xFA, 0x52, 0x78, 0x64,
-    0x48, 0xE0, 0xCD, 0x0C, 0x47, 0x4F, 0xB9, 0x64, 0x0D, 0x6C, 0x4E, 0x11, 0x76, 0x86, 0x28, 0xDD,
-    0x85, 0x5C, 0x1B, 0x14, 0xF8, 0xC0, 0x52, 0x98, 0x89, 0xEC, 0xB4, 0x2F, 0xCB, 0x4E, 0x61, 0x8E,
-    0x28, 0x98, 0x24, 0x67, 0x0A, 0xF6, 0x7C, 0x66, 0x23, 0x99, 0x4D, 0x22, 0x61, 0xFB, 0x36, 0x15,
-    0x51, 0xDD, 0x5E, 0x1A, 0x2C, 0x96, 0xBA, 0x83, 0x7A, 0x6B, 0x71, 0x3D, 0xA4, 0x6E, 0xE1, 0x8A,
-    0x0D, 0x76, 0xC2, 0x6C, 0xC4, 0xE0, 0xA1, 0x54, 0xEB, 0x3C, 0xCD, 0x45, 0xD6, 0x88, 0x35, 0xCD,
-    0xDA, 0x15, 0xCD, 0x7F, 0xA8, 0xB5, 0xF2, 0xB9, 0x54, 0xB9, 0x90, 0xC6, 0x0E, 0xE5, 0x87, 0x46,
-    0xD6, 0xFE, 0xCB, 0xE0, 0xA7, 0x9C, 0xE8, 0xE6, 0x23, 0xB3, 0x3E, 0x6D, 0x54, 0xA5, 0x19, 0x8A,
-    0x67, 0x89, 0xBC, 0x93, 0x2F, 0xBC, 0xC1, 0xEF, 0x76, 0xF7, 0xF1, 0x21, 0x01, 0xC7, 0xF8, 0x2D,
-    0xA2, 0xB0, 0x51, 0x6B, 0x6A, 0x6A, 0x83, 0x96, 0x65, 0x20, 0xEF, 0x62, 0x8B, 0xF7, 0xAC, 0xC1,
-    0x72, 0x2D, 0x40, 0x5A, 0x6F, 0xE6, 0xD6, 0xA9, 0x4B, 0x91, 0x4E, 0x0C, 0xD7, 0x76, 0x37, 0xAD,
-    0x41, 0x87, 0xE2, 0xE2, 0xCB, 0x05, 0xB1, 0xA6, 0x76, 0x7D, 0x3F, 0x6B, 0x0F, 0xEB, 0x55, 0x7A,
-    0x07, 0xCC, 0xC9, 0xB2, 0x0D, 0x10, 0x6A, 0xF4, 0x79, 0x35, 0x58, 0xA8, 0x7E, 0xB6, 0x61, 0x0D,
-    0x5D, 0x61, 0x01, 0xF5, 0x30, 0x33, 0x23, 0xB4, 0xBC, 0x95, 0x42, 0xF1, 0xE7, 0x99, 0x8A, 0x53,
-    0x21, 0xA8, 0x55, 0xC9, 0x0C, 0x93, 0x2B, 0xA8, 0x90, 0x0E, 0xF2, 0x89, 0xD4, 0x65, 0xAB, 0x99,
-    0xFC, 0x5A, 0xB2, 0x1F, 0xA6, 0x5A, 0xE4, 0xF9, 0x33, 0x97, 0x98, 0x19, 0xD3, 0x65, 0xAD, 0x75,
-    0x1B, 0xB6, 0xCB, 0x49, 0x40, 0xD6, 0xD8, 0xC5, 0x62, 0x3D, 0x76, 0xED, 0xFF, 0xCB, 0x02, 0x35,
-    0xFB, 0x62, 0x50, 0xF2, 0x65, 0x30, 0xE8, 0x77, 0x0A, 0x24, 0x57, 0x70, 0x61, 0xC2, 0xA0, 0x37,
-    0x3E, 0x1F, 0x83, 0x04, 0x18, 0xFF, 0x68, 0x21, 0x54, 0x28, 0x06, 0x9D, 0x24, 0x06, 0x4D, 0x65,
-    0xD4, 0x1D, 0x28, 0x85, 0xE4, 0x13, 0xBA, 0xAC, 0x9F, 0x88, 0x68, 0xBD, 0x4C, 0x14, 0x80, 0xDD,
-    0x18, 0x94, 0xAD, 0x61, 0x10, 0x89, 0x54, 0xF9, 0x43, 0x80, 0x04, 0xA2, 0x12, 0x00, 0xB8, 0x9B,
-    0x44, 0xCD, 0x84, 0x3D, 0x7B, 0x53, 0x8C, 0x2E, 0xAB, 0xE2, 0x8A, 0x80, 0xFC, 0x94, 0x5D, 0x3C,
-    0xA1, 0x0C, 0x84, 0x86, 0x40, 0x9A, 0x5F, 0xE2, 0xCE, 0x9B, 0xCF, 0x73, 0x5D, 0x7D, 0x69, 0xF7,
-    0x82, 0x4C, 0x2E, 0xAC, 0x31, 0x9C, 0x8A, 0x5B, 0x7B, 0x5A, 0x6C, 0xFF, 0x6B, 0x42, 0x76, 0xB8,
-    0x82, 0x62, 0x31, 0x25, 0xFC, 0x65, 0x1B, 0x14, 0xA5, 0xA6, 0xCE, 0xC5, 0x8B, 0x9C, 0x02, 0x27,
-    0x3E, 0xC9, 0x22, 0xCF, 0xA6, 0x8E, 0x7D, 0xE5, 0xD5, 0xC4, 0xC9, 0xB8, 0x28, 0x54, 0xA8, 0xF3,
-    0x50, 0x37, 0x1F, 0xC5, 0xB5, 0xB9, 0xB5, 0xAB, 0x91, 0xCB, 0xDB, 0x6A, 0x96, 0x7E, 0xAB, 0xA5,
-    0xB3, 0xA3, 0x50, 0xE3, 0x40, 0x82, 0x1A, 0x0A, 0xC8, 0x81, 0x2A, 0x58, 0x44, 0x77, 0x86, 0xA5,
-    0x51, 0x0C, 0x95, 0x6C, 0x7A, 0x2B, 0x64, 0xB2, 0xA0, 0x1E, 0xA1, 0x5C, 0x7E, 0x12, 0x72, 0xCE,
-    0xA7, 0x10, 0x69, 0x68, 0xB6, 0x40, 0x65, 0x47, 0x0D, 0xB5, 0xF2, 0xF9, 0xE8, 0x92, 0x41, 0x90,
-    0x76, 0x77, 0xE5, 0x80, 0x7C, 0xAA, 0x9A, 0xF4, 0x84, 0x76, 0xB7, 0x9F, 0xDE, 0x49, 0x5F, 0x6C,
-    0xC5, 0xF4, 0xBD, 0x1E, 0x49, 0x30, 0x18, 0x3E, 0xD5, 0x1E, 0x0C, 0x46, 0x11, 0xB2, 0x5F, 0xF6,
-    0x88, 0x42, 0x77, 0x65, 0x08, 0x12, 0x21, 0x1B, 0x65, 0x59, 0x50, 0xF5, 0x3F, 0x2D, 0xCA, 0xBB,
-    0xAC, 0x40, 0x8F, 0x50, 0xB9, 0xDE, 0x27, 0x5F, 0xDB, 0x42, 0x28, 0x19, 0xD7, 0x06, 0xB9, 0x00,
-    0xB9, 0xB4, 0x29, 0x45, 0x4C, 0xEB, 0x10, 0x94, 0xFA, 0x03, 0xBF, 0x7E, 0x44, 0x01, 0x3D, 0xDB,
-    0x7A, 0xF2, 0x8C, 0xD2, 0xCF, 0xA8, 0x95, 0x9B, 0xA3, 0x88, 0xA8, 0xC9, 0x0F, 0xCB, 0x59, 0x5D,
-    0xB0, 0x9E, 0xE1, 0x2E, 0x1A, 0x19, 0x17, 0x8B, 0x49, 0x5A, 0xFA, 0xDA, 0x08, 0x65, 0x16, 0x6F,
-    0x42, 0x31, 0xBB, 0x05, 0x17, 0x48, 0x21, 0x90, 0xB5, 0x54, 0x15, 0x91, 0x99, 0xEB, 0xA3, 0x10,
-    0xC6, 0xE9, 0xCD, 0xD6, 0xE1, 0x72, 0xA4, 0xE1, 0x01, 0x5C, 0x14, 0x6E, 0xB1, 0x1E, 0x3B, 0xA9,
-    0xB5, 0x01, 0x7B, 0xD7, 0x63, 0x57, 0xF6, 0xBD, 0xD6, 0xE2, 0x4E, 0x6B, 0x88, 0x3C, 0xEB, 0x82,
-    0x46, 0x75, 0x77, 0xE2, 0x72, 0x39, 0xEB, 0xF7, 0x20, 0xF1, 0x6F, 0x7F, 0xB1, 0x49, 0x2D, 0xC5,
-    0x33, 0x13, 0x74, 0x7B, 0xC3, 0x52, 0x72, 0xF3, 0x41, 0xBA, 0xD7, 0x3B, 0x75, 0xF7, 0xC2, 0x20,
-    0xBB, 0x76, 0x2C, 0x42, 0x06, 0x26, 0x21, 0xC3, 0xF7, 0x7D, 0x2D, 0x0C, 0x73, 0xE3, 0xAE, 0xD5,
-    0x1E, 0x56, 0x3B, 0xDC, 0xE2, 0x91, 0xAB, 0xCF, 0x15, 0x2E, 0x7F, 0x6E, 0xBE, 0xD4, 0xE7, 0xCA,
-    0x51, 0xA3, 0xE5, 0x4A, 0x56, 0x9F, 0xFB, 0x17, 0xF3, 0xF8, 0x12, 0x8B, 0xA6, 0xD9, 0x2D, 0x84,
-    0x08, 0x23, 0x42, 0x18, 0x91, 0xC2, 0xB0, 0xBB, 0xC7, 0x7B, 0xBF, 0xCC, 0xD6, 0x12, 0x56, 0x03,
-    0xE3, 0xA9, 0x01, 0x4A, 0x43, 0x60, 0x22, 0x88, 0x9B, 0xA2, 0xC4, 0x1E, 0x52, 0x65, 0x1E, 0xD1,
-    0xB5, 0x19, 0xBF, 0xA8, 0x4C, 0xFD, 0xDB, 0x5C, 0x4C, 0xE4, 0x61, 0x26, 0x62, 0x53, 0x91, 0xEC,
-    0x57, 0x1B, 0x93, 0xC1, 0xCE, 0x6D, 0xC4, 0x4E, 0x60, 0x0E, 0xB9, 0xC4, 0x35, 0x1D, 0x75, 0xD9,
-    0x7A, 0x38, 0xD3, 0x97, 0xCC, 0xD8, 0x1E, 0xCF, 0xD2, 0x0A, 0x31, 0x7D, 0xCC, 0xCC, 0x7D, 0x7C,
-    0xF7, 0x61, 0x48, 0x7C, 0xA7, 0xCA, 0xFD, 0x0B, 0x19, 0x09, 0xBA, 0xAD, 0x12, 0x66, 0xDC, 0xA1,
-    0xB2, 0x1C, 0x6B, 0x5C, 0x47, 0xC8, 0x16, 0x64, 0x5D, 0x6A, 0x96, 0x6B, 0x43, 0x01, 0x0B, 0x18,
-    0xF3, 0xEF, 0xA8, 0x68, 0x64, 0x75, 0x79, 0xD1, 0x65, 0xBD, 0x3F, 0x25, 0xB0, 0x1E, 0xA5, 0x12,
-    0x7F, 0xCA, 0xDD, 0xD1, 0x1C, 0x6C, 0xE4, 0xEC, 0xDF, 0xE2, 0x7A, 0x77, 0x58, 0x98, 0xC8, 0x63,
-    0x95, 0x6A, 0x11, 0x03, 0xE2, 0xE1, 0x18, 0xF2, 0x0B, 0x2D, 0xD6, 0x68, 0xF4, 0x2D, 0x16, 0x69,
-    0x14, 0x41, 0xAE, 0x6C, 0x5C, 0x3C, 0xB0, 0x8B, 0xE7, 0xF5, 0xD7, 0xD6, 0x34, 0x75, 0x45, 0xB9,
-    0xD7, 0x6B, 0x0C, 0x36, 0x4E, 0xA2, 0x58, 0xD3, 0xE1, 0x51, 0xE1, 0xDD, 0xE3, 0x6B, 0xA4, 0x48,
-    0xFE, 0xE3, 0x82, 0x4A, 0x88, 0x3E, 0x2E, 0x54, 0x26, 0x31, 0x9A, 0x0F, 0x61, 0xEB, 0xE9, 0x72,
-    0xB7, 0x20, 0xDF, 0x42, 0x4D, 0xAC, 0xD0, 0x3B, 0x05, 0x1E, 0x58, 0x28, 0x2E, 0x11, 0xD1, 0xF0,
-    0x2C, 0x4C, 0x61, 0x48, 0xCE, 0x8B, 0xED, 0x7B, 0xD6, 0xD5, 0x34, 0xD4, 0x65, 0x76, 0xB4, 0x7C,
-    0x4D, 0x35, 0x05, 0x19, 0xE8, 0x32, 0xC6, 0xE3, 0x94, 0x8A, 0xE1, 0x9D, 0x73, 0x30, 0x45, 0xAA,
-    0x2B, 0xAC, 0xD4, 0x02, 0x3D, 0xAE, 0xEE, 0x54, 0x28, 0x48, 0x7D, 0x32, 0xE5, 0x00, 0xE9, 0xC9,
-    0xAE, 0x56, 0x96, 0x42, 0x34, 0xD1, 0x5C, 0x05, 0x87, 0x62, 0x2A, 0xCC, 0xEA, 0xF2, 0xA2, 0x83,
-    0x0B, 0x7E, 0x0A, 0xB4, 0x3A, 0xF1, 0x2D, 0xDA, 0xC3, 0xDE, 0x5C, 0x2D, 0x87, 0x5C, 0x63, 0xAD,
-    0x03, 0x80, 0x13, 0x52, 0x26, 0xCA, 0x54, 0x14, 0xD3, 0x02, 0xE7, 0xFD, 0x24, 0x0E, 0xB8, 0x75,
-    0xA6, 0xC2, 0xBD, 0xEB, 0x4C, 0x59, 0xB7, 0xCE, 0x54, 0x3C, 0x15, 0xB5, 0xD5, 0xE6, 0xF1, 0xD2,
-    0x8E, 0xA7, 0xD7, 0xD7, 0x99, 0x3A, 0x39, 0xAD, 0x33, 0x35, 0xAC, 0xAD, 0x33, 0x95, 0xF6, 0xFF,
-    0x0F, 0xB5, 0x58, 0xB1, 0xAF, 0xDE, 0xD4, 0x15, 0x3F, 0xB6, 0xF3, 0x62, 0x14, 0x53, 0x6E, 0x86,
-    0xBC, 0x05, 0x04, 0x9E, 0x2A, 0x41, 0x44, 0xE3, 0x85, 0x81, 0x21, 0xCD, 0x75, 0x78, 0x03, 0x03,
-    0x43, 0xDE, 0xF0, 0x5E, 0x91, 0xCA, 0xC0, 0xD2, 0x81, 0xA2, 0xAA, 0xE9, 0x1F, 0x00, 0xB5, 0xE1,
-    0xA9, 0x62, 0x60, 0x20, 0x52, 0xD5, 0x3D, 0x52, 0x53, 0xA9, 0xA4, 0x43, 0x18, 0x19, 0xA0, 0x76,
-    0xC8, 0x80, 0xD4, 0x0C, 0x35, 0x45, 0x88, 0x81, 0x01, 0xD3, 0x52, 0x51, 0xC1, 0x80, 0x49, 0x4C,
-    0x63, 0xF2, 0x6C, 0x9F, 0xFE, 0x7E, 0xF7, 0x7E, 0xDF, 0x97, 0x3C, 0x08, 0x21, 0x0F, 0x15, 0x7F,
-    0xF2, 0xFD, 0xAE, 0xAF, 0xCF, 0x39, 0xF7, 0xDC, 0x73, 0xCF, 0xF9, 0x9D, 0x73, 0x2D, 0xB5, 0x1C,
-    0x97, 0xE8, 0x2D, 0x1D, 0x5F, 0x3B, 0xFE, 0xE0, 0xC3, 0x87, 0xEE, 0x0E, 0x4B, 0x39, 0x2B, 0x0F,
-    0xCA, 0x21, 0xB9, 0x93, 0x4E, 0x90, 0x8B, 0xD4, 0xD2, 0x4A, 0x27, 0x3A, 0xDF, 0x13, 0x95, 0xED,
-    0xD9, 0xBB, 0xEF, 0x94, 0x73, 0xD1, 0x59, 0xB3, 0xFA, 0x2F, 0x9D, 0x5D, 0x23, 0x22, 0x7B, 0x1E,
-    0x9E, 0x3D, 0x7F, 0xFE, 0xFC, 0x05, 0x55, 0xDD, 0xC5, 0x3D, 0xE3, 0x56, 0xE1, 0x55, 0xA9, 0xFE,
-    0x17, 0xFD, 0x0F, 0x70, 0x9F, 0x56, 0x9D, 0x2A, 0x75, 0xD7, 0xF8, 0x7D, 0xFF, 0x39, 0x69, 0x99,
-    0x7E, 0xD8, 0xC6, 0xD7, 0x86, 0x60, 0x9A, 0xA5, 0x28, 0x7E, 0xB8, 0x87, 0x67, 0xF3, 0x43, 0xE5,
-    0xFA, 0xF6, 0xF6, 0x26, 0xA6, 0xBD, 0x8A, 0xBB, 0x16, 0x7F, 0x61, 0x95, 0x7F, 0xC4, 0xE3, 0xDF,
-    0xCE, 0x9F, 0x7F, 0x35, 0x1C, 0xD2, 0xB6, 0xDA, 0x18, 0xD3, 0x4E, 0x77, 0xE6, 0xB4, 0x5F, 0xCF,
-    0xCD, 0x60, 0x3F, 0xD2, 0x27, 0x46, 0xDB, 0x6A, 0x34, 0xA6, 0xCD, 0xBA, 0xC4, 0x63, 0x32, 0x9A,
-    0xC1, 0xF4, 0x69, 0x97, 0xB5, 0x59, 0x6D, 0xEB, 0x75, 0x29, 0x2E, 0xEA, 0xC6, 0x9C, 0x80, 0xC3,
-    0xD6, 0x55, 0x3E, 0x07, 0x5B, 0xE1, 0x10, 0xF7, 0x29, 0xDE, 0x55, 0x39, 0x58, 0x92, 0x01, 0xE3,
-    0x8D, 0x96, 0x9E, 0xA4, 0xB7, 0xDD, 0x7A, 0xBE, 0x0D, 0x99, 0xE8, 0xB5, 0x15, 0xF8, 0x94, 0xC2,
-    0x6C, 0x6B, 0x6B, 0x0D, 0x48, 0xDC, 0xA7, 0x0D, 0x25, 0x6E, 0x49, 0xDA, 0x67, 0x5D, 0x55, 0xEB,
-    0x5B, 0x1A, 0x4D, 0x66, 0x70, 0x92, 0x2F, 0x6A, 0x38, 0x25, 0xBD, 0x41, 0xD7, 0x96, 0xDB, 0xA0,
-    0x28, 0xEA, 0xEA, 0x05, 0x7D, 0x4C, 0xA3, 0xD9, 0x29, 0xE4, 0xD4, 0xB1, 0x75, 0xC1, 0x49, 0x65,
-    0x0E, 0xC7, 0x60, 0x2B, 0xD8, 0x94, 0x75, 0x38, 0x86, 0x96, 0x12, 0x4E, 0x22, 0x49, 0x2F, 0x92,
-    0x62, 0xB5, 0x05, 0x16, 0x3B, 0x8A, 0xF9, 0xEC, 0xFA, 0x68, 0x55, 0x3B, 0x2C, 0xF9, 0xD2, 0xA7,
-    0xF3, 0x05, 0x89, 0x3A, 0x11, 0x83, 0xB7, 0xD6, 0xBD, 0x95, 0xB8, 0x5B, 0x11, 0x07, 0xA3, 0xE7,
-    0xCD, 0x1A, 0xEC, 0x7A, 0xEE, 0x44, 0x99, 0x01, 0x84, 0xAD, 0x93, 0x2C, 0x6B, 0x9B, 0x18, 0xAE,
-    0x25, 0x80, 0xAB, 0x44, 0x18, 0x36, 0x0D, 0x65, 0x84, 0x7F, 0x98, 0x7E, 0x7E, 0x0A, 0x6E, 0x81,
-    0x19, 0x7A, 0xCC, 0xD0, 0x50, 0x64, 0xC4, 0xF9, 0xC1, 0x54, 0x80, 0x69, 0x76, 0x8F, 0x3F, 0x3E,
-    0xF5, 0xCE, 0x2F, 0xF0, 0xF6, 0x5D, 0xDC, 0x24, 0x3E, 0x6C, 0xEA, 0xC3, 0x62, 0xA1, 0x30, 0x66,
-    0x88, 0x07, 0x4F, 0x0C, 0xC9, 0xB2, 0x29, 0x55, 0x97, 0xE9, 0x25, 0x9D, 0x0B, 0xBD, 0xA6, 0x5A,
-    0x70, 0xD7, 0xAC, 0xBE, 0xA3, 0x63, 0x48, 0xEF, 0x94, 0x47, 0x85, 0x3C, 0xB6, 0x13, 0x3B, 0xC3,
-    0x6F, 0x1B, 0xAB, 0x83, 0xD5, 0xD6, 0xAA, 0xD8, 0x1E, 0x1E, 0x85, 0x88, 0x92, 0xC3, 0xCE, 0x5D,
-    0x1F, 0xD7, 0x6C, 0x2C, 0x3A, 0x2D, 0x37, 0xDD, 0x66, 0x43, 0x7C, 0xB1, 0xA1, 0xB9, 0xED, 0xB4,
-    0x4D, 0x27, 0xDB, 0xC7, 0xD8, 0x5D, 0x4C, 0x75, 0x44, 0xD6, 0x72, 0xEF, 0x0C, 0x58, 0x4D, 0xD6,
-    0xC4, 0x83, 0xED, 0x13, 0x15, 0xE8, 0x57, 0x56, 0x9D, 0x99, 0xFD, 0xC3, 0x3F, 0x20, 0xB9, 0x49,
-    0x46, 0x04, 0xDC, 0xA6, 0xAC, 0x81, 0xB2, 0xD8, 0xD1, 0x53, 0x78, 0x45, 0x66, 0x98, 0x48, 0x2F,
-    0xCB, 0xBE, 0xE2, 0xD6, 0x75, 0xC8, 0x29, 0x46, 0x5B, 0x2C, 0xE5, 0xD0, 0xBE, 0xD9, 0x37, 0x75,
-    0xCF, 0x15, 0x96, 0x77, 0xF6, 0x0B, 0x72, 0xD5, 0x7F, 0x6F, 0x37, 0xC2, 0x5F, 0x2B, 0xFB, 0xE3,
-    0xDB, 0x7E, 0x4A, 0x62, 0xF7, 0x4B, 0xF6, 0xC3, 0x27, 0x37, 0x2E, 0xF8, 0x03, 0xBD, 0x08, 0x66,
-    0x56, 0xFC, 0x79, 0x3C, 0x61, 0x20, 0x56, 0x8E, 0xA8, 0xB8, 0x3C, 0x70, 0xE7, 0x68, 0xCE, 0x06,
-    0xC6, 0x76, 0xF1, 0x69, 0xBA, 0xAC, 0xA6, 0x3B, 0xC0, 0x6D, 0x46, 0x46, 0x80, 0x67, 0x09, 0x27,
-    0xBA, 0x09, 0xA1, 0xA3, 0x46, 0xB8, 0x8A, 0x27, 0xB4, 0x6F, 0x4D, 0x07, 0xCF, 0x4A, 0x70, 0x2E,
-    0x9C, 0x4C, 0xA7, 0x46, 0xCB, 0x18, 0x3E, 0xF1, 0xC1, 0x50, 0x9D, 0xD2, 0x21, 0xD6, 0x29, 0xD1,
-    0xD1, 0xBE, 0x3C, 0x23, 0x62, 0xB4, 0x86, 0x73, 0x5E, 0x1A, 0xD3, 0x8F, 0xD4, 0x74, 0x07, 0xFF,
-    0x93, 0x32, 0xB2, 0x8B, 0x93, 0x93, 0xE3, 0x2F, 0x35, 0x6B, 0xE0, 0xA3, 0x31, 0x40, 0xC0, 0x5E,
-    0x46, 0x14, 0x63, 0xCA, 0x68, 0x30, 0x57, 0x38, 0x17, 0xB4, 0x9E, 0xA3, 0xB1, 0x3A, 0x39, 0x53,
-    0x6B, 0x04, 0x2C, 0x60, 0x22, 0x87, 0xD6, 0x49, 0x5F, 0xED, 0x8C, 0x50, 0xD4, 0x96, 0x01, 0x96,
-    0x51, 0x61, 0x27, 0xF1, 0x90, 0x69, 0x63, 0xB4, 0xA3, 0x13, 0x07, 0x58, 0x6F, 0xE5, 0x55, 0x0E,
-    0x44, 0xF6, 0x58, 0xC2, 0xF9, 0xA2, 0xE6, 0x12, 0xF7, 0xCB, 0xA7, 0x02, 0x31, 0x65, 0x97, 0x98,
-    0x14, 0xA9, 0xE6, 0xDE, 0x52, 0xBC, 0xD2, 0x2B, 0x2A, 0x8B, 0xA5, 0xD3, 0xA3, 0xB1, 0xE2, 0x6A,
-    0xF9, 0x40, 0xAB, 0x44, 0xC3, 0xF2, 0x09, 0xD6, 0x6A, 0x56, 0x32, 0x68, 0x9C, 0x93, 0xF3, 0x0D,
-    0xDB, 0xD3, 0x2E, 0x37, 0xD8, 0x4C, 0x57, 0x9C, 0x7C, 0x55, 0xE4, 0x97, 0x22, 0xF7, 0x62, 0x19,
-    0xB0, 0x08, 0x22, 0x27, 0xD5, 0x32, 0xD1, 0x3A, 0xBD, 0x36, 0x67, 0x88, 0x4C, 0x6C, 0x4C, 0x5E,
-    0x69, 0x9D, 0x01, 0x29, 0xD2, 0xDD, 0x29, 0x81, 0xED, 0x54, 0x4B, 0xAB, 0x4F, 0xF4, 0xFA, 0xF8,
-    0x08, 0x53, 0xC3, 0x72, 0x72, 0xDF, 0x59, 0xBB, 0x33, 0x9A, 0x2F, 0xE6, 0x78, 0xA8, 0x1E, 0x9B,
-    0xBC, 0x50, 0xFB, 0xF6, 0x60, 0xAE, 0x8E, 0x3E, 0x88, 0x31, 0xFF, 0xD3, 0xAD, 0xFD, 0x7B, 0xC7,
-    0xFD, 0x83, 0x38, 0x18, 0xBA, 0x54, 0xC0, 0x14, 0x2C, 0xDC, 0x47, 0x64, 0x83, 0x41, 0xC9, 0x66,
-    0x6B, 0xB0, 0x61, 0x47, 0xFE, 0x09, 0x88, 0xA3, 0xA1, 0xB3, 0x8F, 0x66, 0x6C, 0xE0, 0x06, 0xED,
-    0x0A, 0x85, 0xAD, 0xF6, 0xA9, 0x8E, 0x86, 0x09, 0x09, 0x26, 0x2F, 0xA8, 0x82, 0x33, 0x2F, 0x17,
-    0x5D, 0x0C, 0x92, 0x4D, 0x62, 0x16, 0x6B, 0x3C, 0x20, 0x8C, 0x4B, 0x5A, 0xB9, 0xA8, 0xCD, 0x10,
-    0x70, 0x9F, 0xA0, 0x07, 0x56, 0x55, 0x83, 0xF6, 0x04, 0x2D, 0x5C, 0x23, 0xF0, 0xDB, 0xA2, 0x26,
-    0xA4, 0x1A, 0x68, 0x15, 0x0F, 0xA6, 0x8B, 0xC6, 0xB8, 0x0F, 0xB0, 0xCD, 0x32, 0x03, 0xED, 0x4E,
-    0xC8, 0x9B, 0x9E, 0xEC, 0x31, 0x20, 0x0A, 0x08, 0xC1, 0x4B, 0xF4, 0x2D, 0x49, 0x4C, 0x61, 0x34,
-    0x2F, 0x19, 0x4C, 0x4B, 0x96, 0xA4, 0x23, 0x13, 0xD0, 0x0C, 0x6C, 0x01, 0x71, 0xB1, 0xC1, 0x9C,
-    0x06, 0xE0, 0x53, 0x07, 0x93, 0xD3, 0x3C, 0x0F, 0x47, 0x49, 0x1A, 0xDB, 0x54, 0x65, 0x0C, 0xCB,
-    0x88, 0x62, 0x33, 0x08, 0xE1, 0xC1, 0x84, 0xE9, 0x60, 0x07, 0x00, 0xA1, 0x69, 0xB1, 0x93, 0x24,
-    0x4A, 0x4B, 0x92, 0xA9, 0x90, 0x30, 0x6B, 0x49, 0x1A, 0x8D, 0x8E, 0xB8, 0x28, 0x49, 0x8E, 0xA9,
-    0xC8, 0x30, 0x3B, 0x16, 0xA0, 0x33, 0x98, 0x20, 0xC3, 0xB1, 0x89, 0xDC, 0xEF, 0xF0, 0x1B, 0x4B,
-    0x8D, 0x54, 0x82, 0x6B, 0xAD, 0x8C, 0x6F, 0xC8, 0xF3, 0xA6, 0xCC, 0xC2, 0xCE, 0x94, 0x27, 0x92,
-    0x3A, 0xB9, 0xD4, 0xCA, 0x20, 0x77, 0x49, 0x38, 0x48, 0xD5, 0xA6, 0x23, 0x68, 0x10, 0x16, 0x7D,
-    0x82, 0x74, 0xD8, 0x85, 0x5A, 0x9A, 0x89, 0x70, 0xA9, 0x75, 0x3C, 0x4B, 0x9A, 0x4B, 0x1E, 0x12,
-    0xF3, 0x8B, 0x76, 0xF1, 0xA2, 0x0B, 0xB4, 0x06, 0x61, 0xD5, 0x66, 0x88, 0x20, 0x10, 0x01, 0x2E,
-    0x27, 0x49, 0x4A, 0x8F, 0xAB, 0xBC, 0x0E, 0x4B, 0x56, 0x4B, 0x1E, 0xD7, 0xD1, 0x2C, 0xC7, 0xB0,
-    0xF6, 0xA2, 0x4D, 0x06, 0x33, 0x46, 0x53, 0x48, 0x7C, 0x4D, 0xCB, 0xAA, 0x01, 0x8F, 0x64, 0x3D,
-    0xF5, 0x4A, 0x18, 0x61, 0x23, 0x5E, 0xC0, 0x4C, 0x1D, 0x5E, 0xC0, 0x21, 0x3E, 0xC7, 0x66, 0x43,
-    0x9D, 0x29, 0x42, 0x7A, 0x35, 0x9A, 0x17, 0x9F, 0x28, 0x62, 0x25, 0x9E, 0x6D, 0x9B, 0x61, 0xA6,
-    0xE6, 0x1C, 0x20, 0x26, 0x38, 0x27, 0xA1, 0x9E, 0x62, 0x78, 0x57, 0x0D, 0x60, 0x9E, 0xA2, 0x20,
-    0x10, 0xA2, 0x20, 0x10, 0xA2, 0x36, 0xCD, 0xC8, 0x17, 0x35, 0xE6, 0xEA, 0xA1, 0xBF, 0x96, 0x6F,
-    0x42, 0x83, 0xA8, 0x0B, 0xF3, 0x68, 0x92, 0xBB, 0x85, 0x7E, 0x8D, 0xC9, 0x80, 0xF0, 0x06, 0x0A,
-    0x5D, 0x82, 0x2F, 0x77, 0xDA, 0xA4, 0xA3, 0x1F, 0x08, 0x30, 0x00, 0x62, 0xF8, 0xFA, 0x90, 0x75,
-    0x11, 0x92, 0xB3, 0xE8, 0x8B, 0xF0, 0x97, 0xB6, 0xAA, 0x99, 0x4C, 0xA3, 0x29, 0xC6, 0xC0, 0x49,
-    0xE2, 0x7D, 0x81, 0xBD, 0x47, 0x6A, 0xD8, 0x5A, 0x45, 0x51, 0x51, 0x26, 0x1D, 0xF3, 0x81, 0x99,
-    0x17, 0x42, 0xC9, 0xE2, 0x72, 0x02, 0xAF, 0x10, 0xB0, 0x56, 0x38, 0x24, 0xD0, 0x0E, 0x19, 0x70,
-    0xC8, 0x14, 0x3A, 0x6A, 0xBC, 0xB8, 0x39, 0x4D, 0x8A, 0x35, 0x00, 0x12, 0x10, 0x4A, 0xE2, 0x5C,
-    0xBA, 0xE7, 0xE2, 0x7C, 0xB6, 0xAB, 0xEA, 0xBD, 0xF0, 0x40, 0x28, 0x04, 0x80, 0x88, 0xB6, 0xFE,
-    0x2E, 0x6A, 0xE7, 0xE0, 0x47, 0x51, 0xAF, 0xFC, 0x9E, 0x88, 0x8F, 0x09, 0xF4, 0x0A, 0x1E, 0xCE,
-    0x3B, 0xEA, 0x47, 0x70, 0xFF, 0x08, 0x49, 0x4F, 0x8E, 0xA7, 0x68, 0x5E, 0x8F, 0x1B, 0x24, 0xF6,
-    0x60, 0x3E, 0x09, 0xA6, 0x82, 0x13, 0x1D, 0xD4, 0x33, 0x18, 0xDE, 0x26, 0x98, 0x68, 0xEF, 0x8A,
-    0x38, 0xE6, 0xE1, 0xB4, 0x31, 0xA5, 0x04, 0xDD, 0x31, 0x0C, 0x3F, 0x47, 0xDE, 0x9F, 0x70, 0x6B,
-    0xEF, 0xF2, 0x41, 0xF4, 0x06, 0x76, 0x0C, 0xF5, 0x03, 0xEC, 0x8E, 0xD8, 0x89, 0x31, 0x37, 0x63,
-    0x1A, 0x41, 0x0E, 0x4D, 0x9E, 0x77, 0x1E, 0x17, 0xF4, 0xAE, 0x68, 0x60, 0x20, 0x42, 0x75, 0xF3,
-    0xBC, 0x84, 0x5F, 0x74, 0xF2, 0x53, 0x93, 0x27, 0xF5, 0x1B, 0x32, 0x44, 0x4D, 0x26, 0x19, 0x68,
-    0x1D, 0xBC, 0xAD, 0x2F, 0x97, 0x94, 0xB5, 0x4B, 0xE8, 0x5B, 0xC2, 0x5E, 0xB0, 0x02, 0x39, 0xBB,
-    0xF8, 0xFF, 0xD8, 0xD4, 0xBF, 0xF2, 0x03, 0xD7, 0x76, 0x7D, 0x86, 0x48, 0x5D, 0x21, 0xE1, 0x00,
-    0x13, 0x36, 0x75, 0x43, 0x6B, 0xD5, 0x57, 0x9B, 0x0B, 0x36, 0x5D, 0xCA, 0xFE, 0x7C, 0x21, 0x3C,
-    0xBD, 0xBA, 0x90, 0x69, 0xFA, 0xC2, 0x9B, 0x14, 0x51, 0xE5, 0xE6, 0x3B, 0x5A, 0x3E, 0x10, 0x34,
-    0x87, 0xCE, 0x8A, 0x07, 0xD3, 0x98, 0xA5, 0x89, 0x4B, 0x1E, 0x04, 0x90, 0x6A, 0x69, 0xF2, 0x8C,
-    0x3C, 0x28, 0x66, 0x7E, 0xFB, 0x78, 0x7B, 0x5A, 0x4E, 0x6C, 0xF4, 0xA7, 0x4F, 0xB3, 0x56, 0x34,
-    0x68, 0x3E, 0xC3, 0xDD, 0x01, 0x05, 0xF5, 0xBA, 0x2B, 0x5C, 0x59, 0x15, 0x8B, 0xA5, 0x00, 0x22,
-    0x50, 0xCA, 0x92, 0x28, 0x81, 0x9E, 0x66, 0x17, 0x73, 0xC5, 0xBB, 0x08, 0xDF, 0x5E, 0x39, 0x49,
-    0x51, 0x27, 0x63, 0x06, 0xBC, 0x9A, 0x81, 0x49, 0x33, 0x4B, 0xA1, 0x02, 0x6B, 0x8E, 0x91, 0xC7,
-    0x25, 0x28, 0x1F, 0xC1, 0xE6, 0xBC, 0xAF, 0x93, 0x6B, 0x16, 0xCA, 0x37, 0x0B, 0xA5, 0x8A, 0xDC,
-    0xAB, 0xE9, 0xB2, 0x00, 0x31, 0x1D, 0x18, 0xE0, 0x6A, 0x2D, 0xF7, 0xE0, 0xD2, 0x9F, 0xDE, 0x4C,
-    0x5F, 0x2D, 0xE9, 0xC7, 0xC5, 0x3A, 0xCC, 0x1E, 0xFA, 0x7E, 0x41, 0x9F, 0xAD, 0xE8, 0x15, 0x35,
-    0x8B, 0x5E, 0xD1, 0x3F, 0x57, 0x65, 0x86, 0xB8, 0x45, 0x49, 0x75, 0x73, 0xC7, 0xBD, 0x1A, 0xAB,
-    0xF7, 0x6E, 0xF1, 0xAA, 0x4D, 0xDC, 0x2B, 0x5D, 0xDB, 0xCE, 0xAD, 0xBE, 0x82, 0xA3, 0xC2, 0xF0,
-    0x97, 0xAF, 0x13, 0xB8, 0x8E, 0x7B, 0xA5, 0xF3, 0xFA, 0x2D, 0xE5, 0xBB, 0x57, 0x56, 0x7F, 0xB7,
-    0xBD, 0xCA, 0x89, 0x09, 0x76, 0xF6, 0x3E, 0x45, 0x74, 0xEA, 0x84, 0x7B, 0xCC, 0x70, 0xDB, 0xC5,
-    0x8D, 0x88, 0x1A, 0x10, 0xDB, 0xDD, 0x57, 0x00, 0x88, 0xDC, 0x85, 0x09, 0x60, 0x20, 0x54, 0x66,
-    0x49, 0xA2, 0x8A, 0xAF, 0x4A, 0xAB, 0xD6, 0x45, 0x4B, 0xA2, 0x7E, 0x3B, 0x90, 0x21, 0x02, 0xDC,
-    0x06, 0x8F, 0xE9, 0xBC, 0x88, 0x21, 0x84, 0x04, 0x0B, 0xCC, 0xC9, 0xDB, 0x66, 0x59, 0x91, 0xD2,
-    0x70, 0x8C, 0xEF, 0x2D, 0xF9, 0xC6, 0x45, 0x33, 0x82, 0x24, 0x52, 0xDE, 0xB9, 0x93, 0x6B, 0x98,
-    0xB0, 0x08, 0xF6, 0xBD, 0x0F, 0x48, 0x6A, 0xC3, 0x32, 0xEE, 0xC8, 0x92, 0x27, 0x84, 0x53, 0x18,
-    0xEC, 0x28, 0xB2, 0x14, 0xCF, 0x46, 0x9D, 0x61, 0x29, 0x3C, 0x9A, 0x29, 0xCB, 0xD3, 0xD1, 0x8C,
-    0x07, 0x04, 0xF5, 0x3A, 0xCB, 0x6A, 0xD7, 0x1A, 0xD7, 0x66, 0x03, 0x5B, 0x14, 0x9A, 0x23, 0x66,
-    0x81, 0xB3, 0x50, 0x69, 0xB4, 0x98, 0x85, 0x2D, 0x96, 0xC4, 0x6C, 0xC1, 0xD6, 0xD5, 0x26, 0x0C,
-    0xA6, 0x60, 0xF3, 0xEB, 0x6A, 0x32, 0xD1, 0xB5, 0x54, 0x0E, 0x6D, 0x3A, 0x2D, 0xFA, 0xD0, 0x0F,
-    0x12, 0xD6, 0x6E, 0xD0, 0xDB, 0x3E, 0xA8, 0xE6, 0xDC, 0xF6, 0x30, 0x6E, 0x6B, 0x7B, 0x02, 0x94,
-    0xEB, 0xA3, 0x0E, 0x36, 0x67, 0x58, 0xE6, 0x1E, 0x80, 0x97, 0x12, 0x68, 0x7D, 0x1B, 0xCF, 0x19,
-    0x8F, 0x06, 0x74, 0x5E, 0x64, 0x5A, 0xB4, 0xA1, 0xB6, 0x68, 0x13, 0xCD, 0xD3, 0x8E, 0xE2, 0xD1,
-    0xE2, 0x91, 0x6D, 0x43, 0x63, 0x22, 0x6E, 0x80, 0x94, 0x6B, 0x7B, 0x8B, 0x1C, 0x8E, 0x37, 0x34,
-    0x56, 0xD1, 0x71, 0x41, 0x45, 0xBF, 0xE8, 0x83, 0x11, 0xC7, 0x88, 0x60, 0x45, 0x9F, 0x2D, 0xC2,
-    0x8B, 0x91, 0x35, 0xAD, 0x6F, 0xFF, 0x8C, 0xAE, 0xCA, 0x64, 0x41, 0xF3, 0xD2, 0x7F, 0x79, 0xE6,
-    0x48, 0xA9, 0x4D, 0x4F, 0xDB, 0xF9, 0x4D, 0x44, 0xD6, 0xC1, 0x1E, 0x8B, 0x3F, 0x8C, 0x90, 0xB0,
-    0xE0, 0x09, 0x04, 0x44, 0x38, 0xE3, 0x39, 0xA8, 0xC8, 0xB1, 0x0B, 0x73, 0xFC, 0x29, 0x4E, 0x22,
-    0xCF, 0x21, 0x7C, 0xDF, 0xAE, 0x21, 0x9A, 0x9D, 0x4F, 0xD0, 0x99, 0x6F, 0xDD, 0x79, 0x1F, 0x9D,
-    0x91, 0x9D, 0x97, 0xD0, 0x69, 0xD1, 0xE9, 0xE3, 0x1A, 0x9B, 0xFD, 0x1C, 0x80, 0x70, 0xFF, 0x9D,
-    0x1B, 0x17, 0x72, 0x19, 0xAB, 0x27, 0x77, 0xE6, 0x52, 0xA0, 0xD9, 0x8B, 0x57, 0x99, 0x1B, 0xEC,
-    0xED, 0x3B, 0x57, 0xD8, 0x81, 0x2A, 0x9F, 0x75, 0x58, 0x06, 0x4E, 0x88, 0x60, 0xE7, 0x89, 0x7C,
-    0x51, 0x33, 0x6B, 0xE3, 0x04, 0x12, 0x96, 0xBA, 0x13, 0x68, 0x1B, 0x1C, 0x7E, 0x74, 0xA7, 0xC5,
-    0xA3, 0xD9, 0xC1, 0x1A, 0x38, 0xD4, 0x71, 0xE8, 0xD2, 0x9E, 0xA1, 0x96, 0x43, 0x1B, 0xD7, 0xE9,
-    0x90, 0x14, 0x41, 0xCF, 0xC4, 0xF1, 0xF7, 0x4F, 0xC4, 0xE1, 0xAD, 0x05, 0x52, 0x38, 0x70, 0x60,
-    0x07, 0x05, 0x43, 0xD0, 0x64, 0xE5, 0x33, 0xD9, 0xF5, 0xEB, 0xBA, 0xA3, 0x3E, 0x14, 0xB5, 0x5E,
-    0xD7, 0x2F, 0x73, 0x60, 0x5D, 0x0E, 0x57, 0x05, 0xA1, 0x3E, 0xCD, 0xAD, 0xD4, 0x32, 0x9C, 0x59,
-    0x23, 0xD7, 0x8F, 0xFA, 0xE5, 0x1E, 0xCC, 0xB3, 0xCE, 0x0E, 0xF8, 0xB1, 0xBE, 0xF9, 0x66, 0x50,
-    0x75, 0x59, 0x97, 0x76, 0xA6, 0x4F, 0x86, 0x78, 0x8C, 0x46, 0x60, 0xE1, 0xD6, 0x9D, 0xE7, 0xA5,
-    0x1F, 0xFE, 0xBA, 0x93, 0x34, 0xFA, 0xFF, 0xB4, 0x95, 0x3B, 0xA7, 0xAF, 0xE4, 0xB8, 0x4E, 0x56,
-    0xCA, 0xFD, 0xE1, 0x70, 0xF0, 0x45, 0xBD, 0x70, 0x81, 0xDB, 0x85, 0x32, 0x03, 0x02, 0x83, 0xA7,
-    0x75, 0x0B, 0xDE, 0xCE, 0x94, 0x0B, 0xF0, 0x33, 0x5F, 0xB2, 0x02, 0x02, 0xEC, 0x65, 0x2D, 0x40,
-    0xE1, 0xE1, 0xA8, 0xBC, 0x51, 0xD7, 0xCB, 0x8C, 0x7A, 0xED, 0x43, 0xD6, 0xD6, 0x6D, 0xB1, 0xC3,
-    0xB2, 0x93, 0xB0, 0x8F, 0x18, 0xA4, 0x68, 0xD0, 0x62, 0x80, 0x49, 0x61, 0x31, 0x00, 0xEC, 0x5B,
-    0x0C, 0x60, 0xF6, 0xD5, 0x40, 0x76, 0x71, 0x8E, 0x51, 0xA8, 0x57, 0xD7, 0x86, 0x44, 0xAB, 0x1C,
-    0x08, 0xC4, 0x13, 0xAF, 0x87, 0x47, 0xB8, 0xE1, 0x57, 0xAC, 0x0D, 0xE8, 0xD1, 0xF3, 0x99, 0x78,
-    0xC8, 0xFC, 0xE1, 0xB3, 0xB3, 0x79, 0xC0, 0x2F, 0x45, 0xC8, 0xFC, 0x22, 0x4F, 0xE9, 0x74, 0x93,
-    0x41, 0x09, 0x8C, 0xF7, 0xAD, 0xB6, 0x76, 0x40, 0x35, 0x9E, 0xB0, 0xAA, 0x78, 0x60, 0xB5, 0xB5,
-    0x47, 0xDC, 0xD6, 0x86, 0x67, 0xFD, 0xE7, 0x87, 0xDF, 0xD8, 0x44, 0x0A, 0x73, 0xB9, 0x33, 0xD7,
-    0x76, 0x01, 0x69, 0xC8, 0x09, 0x46, 0x87, 0x68, 0xF9, 0xFD, 0x89, 0xDF, 0x8C, 0x90, 0x7E, 0x7A,
-    0x06, 0x94, 0x24, 0xBB, 0xDA, 0xC5, 0xC3, 0xA8, 0xF2, 0xBA, 0x35, 0xF9, 0x01, 0x7E, 0xC1, 0x88,
-    0xFC, 0xF1, 0x86, 0x9A, 0xF2, 0xE3, 0x0E, 0x21, 0x3A, 0x9D, 0x7C, 0x96, 0x90, 0xA3, 0xDF, 0xDC,
-    0x6A, 0x4E, 0xEC, 0xF0, 0x65, 0xF0, 0x29, 0x83, 0x10, 0x2F, 0x47, 0xF3, 0x5B, 0xFB, 0xC5, 0x2D,
-    0x85, 0xC2, 0x3F, 0x8B, 0x8B, 0xCA, 0x63, 0x0F, 0xB3, 0xBB, 0x6D, 0xB5, 0x4C, 0x3B, 0x0C, 0xB0,
-    0xD6, 0xC3, 0x60, 0x6F, 0x1B, 0x1E, 0x25, 0x8B, 0x17, 0x66, 0x9E, 0x18, 0x49, 0x15, 0xE0, 0xEC,
-    0x90, 0x36, 0x45, 0x6E, 0x5A, 0x5B, 0xCE, 0xEE, 0x50, 0x32, 0x46, 0x9D, 0xA9, 0x65, 0x95, 0x7D,
-    0xCC, 0xB8, 0xC0, 0x69, 0x6F, 0xEB, 0xC6, 0x1F, 0x05, 0x7D, 0x5E, 0x39, 0x7B, 0x7B, 0xC7, 0x75,
-    0x09, 0x68, 0x2B, 0x71, 0xE5, 0xC8, 0xC0, 0x25, 0x01, 0x66, 0x99, 0xF5, 0x58, 0xEA, 0xD2, 0xC5,
-    0x34, 0x3C, 0xC7, 0xD0, 0x6C, 0x6F, 0x2F, 0xE5, 0xBB, 0xD5, 0xA0, 0x00, 0x07, 0xDA, 0x6B, 0xB9,
-    0x2B, 0x58, 0xE1, 0xEF, 0x25, 0x2B, 0x33, 0x77, 0x0A, 0x63, 0x7D, 0xED, 0x42, 0xDC, 0x99, 0xF1,
-    0xE8, 0xED, 0xE7, 0x5A, 0x40, 0xBF, 0xFF, 0x0E, 0xE7, 0x8C, 0xEF, 0x4D, 0x2B, 0x1E, 0xC5, 0xBF,
-    0x5B, 0x80, 0x3B, 0x50, 0xAF, 0xC9, 0x6D, 0xD4, 0x38, 0x46, 0x8A, 0x5F, 0xDF, 0xF8, 0x58, 0x53,
-    0xD4, 0x47, 0xBE, 0x45, 0x16, 0x8E, 0xB3, 0xEF, 0xEA, 0x2B, 0x53, 0xDA, 0xAD, 0xDD, 0x94, 0xBA,
-    0x16, 0x96, 0x88, 0x9D, 0x6E, 0xCE, 0x0C, 0xBE, 0x80, 0xFD, 0x16, 0x1F, 0x91, 0x7B, 0x61, 0x9F,
-    0x33, 0xAC, 0xF5, 0xA8, 0x06, 0x0D, 0x5F, 0x72, 0x13, 0x50, 0x12, 0x8E, 0x49, 0x23, 0xC1, 0x70,
-    0xBB, 0xB5, 0xB8, 0x82, 0xCE, 0xD9, 0xD8, 0xDB, 0xDB, 0x2D, 0x20, 0x19, 0x56, 0x3B, 0x1B, 0xFA,
-    0x2D, 0x61, 0x11, 0x08, 0x80, 0xC8, 0xEA, 0xB4, 0x0C, 0xB4, 0xAC, 0x60, 0xBC, 0x44, 0xC3, 0x11,
-    0xA7, 0xB3, 0x6C, 0x4C, 0xBA, 0x14, 0x67, 0xB7, 0x26, 0xC3, 0x79, 0x48, 0x1E, 0x42, 0x39, 0xFB,
-    0xD0, 0xD7, 0xB8, 0x7C, 0x65, 0xEB, 0x03, 0x76, 0xF4, 0x61, 0x7B, 0xD5, 0xFF, 0x5D, 0xF6, 0x7F,
-    0xCB, 0x22, 0x78, 0x0F, 0xD7, 0x1A, 0xB8, 0xD6, 0xF2, 0x00, 0x27, 0x1D, 0xE1, 0xC7, 0x81, 0x9B,
-    0xE7, 0x02, 0xCE, 0xD4, 0x48, 0xE5, 0x7F, 0x05, 0x17, 0x6B, 0xA8, 0xBD, 0x73, 0x2D, 0x8F, 0x4B,
-    0x97, 0xF4, 0x95, 0xD9, 0x0E, 0xC5, 0xEA, 0x68, 0x13, 0xC1, 0x37, 0x51, 0x18, 0xBE, 0x34, 0xAE,
-    0xBE, 0x86, 0x64, 0x1B, 0xDC, 0x9A, 0xA1, 0x6A, 0x9E, 0xA1, 0x4B, 0x91, 0x3E, 0xA3, 0xFB, 0x84,
-    0x1F, 0xDB, 0x1E, 0x84, 0x2F, 0x93, 0x30, 0x98, 0x51, 0x45, 0x0D, 0xFA, 0x0E, 0x13, 0xBE, 0x27,
-    0xB1, 0xFD, 0xB1, 0x5C, 0xF5, 0xC9, 0xF7, 0xFC, 0x37, 0xA6, 0xA8, 0xDE, 0xE7, 0xF7, 0xAF, 0xA7,
-    0x9A, 0x98, 0xBF, 0x76, 0x5F, 0xDF, 0xB1, 0xAA, 0xD9, 0x8E, 0xA8, 0xD5, 0xBA, 0xA4, 0x8D, 0xEA,
-    0x3B, 0xE5, 0xF2, 0xDF, 0xBF, 0x82, 0x3C, 0xAA, 0xE3, 0xC6, 0xE0, 0x9C, 0x6A, 0xC7, 0x6A, 0xBE,
-    0x73, 0xCE, 0xB0, 0x4C, 0xDA, 0x87, 0x1F, 0x7D, 0xED, 0x9E, 0xE3, 0xC7, 0x81, 0x30, 0xF5, 0x3E,
-    0x56, 0x58, 0x3E, 0x59, 0x7E, 0x1F, 0xCB, 0xFC, 0x0F, 0xED, 0x54, 0xB1, 0x6E, 0x14, 0x31, 0x10,
-    0x9D, 0xBD, 0x25, 0x59, 0xC1, 0x16, 0xA6, 0xB9, 0x02, 0x0A, 0x96, 0x12, 0x0A, 0xE4, 0x2F, 0x40,
-    0x5E, 0x68, 0x69, 0x28, 0x2E, 0x42, 0x82, 0x82, 0x36, 0xA4, 0xC9, 0x17, 0xE4, 0xBC, 0x21, 0x05,
-    0x6D, 0x2A, 0x28, 0x28, 0x68, 0xA8, 0xC2, 0x17, 0x50, 0x24, 0xDE, 0x84, 0x22, 0xED, 0x02, 0x52,
-    0x68, 0x57, 0x42, 0x4A, 0x44, 0x28, 0x62, 0xC0, 0x42, 0x1B, 0xB0, 0x3D, 0xBC, 0xBD, 0x0B, 0x24,
-    0x41, 0x34, 0x74, 0x14, 0x8C, 0x9E, 0xF6, 0x7C, 0xF6, 0xDC, 0xF8, 0xCD, 0xBC, 0xB7, 0x47, 0x43,
-    0x4A, 0xB9, 0x15, 0xDC, 0x49, 0xF6, 0xEA, 0x6D, 0x54, 0x9B, 0x51, 0xD7, 0x3C, 0x85, 0x02, 0x36,
-    0x19, 0x9B, 0x05, 0x7B, 0x24, 0x20, 0x8D, 0x86, 0x74, 0x4D, 0x6E, 0x5B, 0xBA, 0x5A, 0x6C, 0x7F,
-    0xF2, 0xFA, 0xE8, 0x61, 0x47, 0x84, 0x48, 0x03, 0x0D, 0xB8, 0x4C, 0xB8, 0x21, 0x76, 0xB4, 0x1E,
-    0x68, 0xAC, 0x4B, 0x55, 0x34, 0x32, 0x73, 0xC5, 0x4E, 0xBC, 0xC5, 0xFC, 0x95, 0x39, 0x2C, 0xBC,
-    0xF8, 0x46, 0x49, 0x20, 0xD2, 0x25, 0x4D, 0x82, 0x79, 0x85, 0xA3, 0xD8, 0x7F, 0xAE, 0x88, 0x3A,
-    0xCA, 0xD8, 0x15, 0xDC, 0x5D, 0x58, 0x74, 0x54, 0xB4, 0xA4, 0x56, 0x93, 0xF8, 0x72, 0xF1, 0x33,
-    0xF3, 0x23, 0x14, 0x43, 0xF9, 0x64, 0x44, 0xC6, 0xA7, 0x60, 0x11, 0x47, 0xFD, 0x69, 0x4D, 0xEA,
-    0x99, 0x55, 0xEC, 0xF5, 0x6E, 0x54, 0x25, 0xF7, 0xA8, 0x58, 0xEE, 0x46, 0xC1, 0x7E, 0xC0, 0x16,
-    0x1C, 0x11, 0x8A, 0x79, 0x0A, 0x22, 0x10, 0xF3, 0x94, 0x3A, 0xCA, 0x2D, 0x89, 0x96, 0x24, 0x7E,
-    0x5C, 0x91, 0xC1, 0xED, 0x34, 0x08, 0x94, 0xFA, 0x09, 0x93, 0x39, 0x5C, 0x6F, 0xD1, 0xA5, 0x7C,
-    0x13, 0x64, 0x15, 0xE4, 0x26, 0xDA, 0x75, 0xD3, 0xA9, 0xA8, 0x77, 0xD3, 0x2B, 0x8C, 0x7A, 0x1D,
-    0x31, 0xA1, 0x1C, 0xF5, 0xE7, 0xA6, 0xF9, 0x0D, 0xE8, 0xAA, 0x3D, 0xAF, 0xAA, 0xA8, 0x71, 0x5A,
-    0xB1, 0xDA, 0x61, 0xC9, 0x9C, 0xF9, 0xD8, 0xDF, 0x98, 0xFA, 0xB3, 0x8B, 0x9D, 0x60, 0x2B, 0xB8,
-    0x9A, 0x19, 0x51, 0x62, 0xA9, 0x28, 0x13, 0x74, 0x56, 0x72, 0x1F, 0x93, 0xD5, 0xE4, 0x41, 0x24,
-    0xFA, 0x0D, 0xDB, 0xCF, 0x02, 0x31, 0x9C, 0x2B, 0x8F, 0x56, 0x13, 0x56, 0x63, 0xB1, 0xE5, 0x54,
-    0xD6, 0xAE, 0xE7, 0x8D, 0x17, 0x35, 0x10, 0xF2, 0x66, 0x9C, 0x5A, 0x59, 0xFA, 0xBC, 0x19, 0x52,
-    0xD6, 0xAA, 0xA4, 0x13, 0xF5, 0x3A, 0x3E, 0x53, 0x3B, 0xC5, 0xB8, 0x4F, 0xDC, 0x72, 0xE3, 0x99,
-    0xF2, 0xCA, 0xC5, 0xD5, 0x25, 0xEE, 0xF4, 0x77, 0xAF, 0xAB, 0xA0, 0x29, 0x6A, 0xDA, 0xF8, 0x0D,
-    0x43, 0x4C, 0xF5, 0x2F, 0x85, 0x47, 0xC8, 0x5A, 0x59, 0xED, 0x0D, 0x17, 0x07, 0x5B, 0x8F, 0x6C,
-    0xE2, 0x31, 0x45, 0x59, 0xE7, 0x76, 0xF0, 0x73, 0x31, 0x19, 0x64, 0xCE, 0xAD, 0x62, 0x27, 0x0F,
-    0xFC, 0x39, 0xCC, 0x16, 0xC8, 0x3A, 0x12, 0x96, 0x14, 0x6C, 0x51, 0xC2, 0x22, 0xC2, 0x41, 0x99,
-    0x30, 0x05, 0x1D, 0xE7, 0x77, 0xC5, 0x53, 0x7F, 0x06, 0x05, 0x51, 0xEA, 0x9E, 0x1B, 0x70, 0x3D,
-    0x80, 0xEC, 0xB3, 0x48, 0x88, 0xE7, 0x29, 0xAA, 0x17, 0x48, 0xF6, 0x12, 0x1C, 0xE6, 0xE8, 0xBF,
-    0xD1, 0xFE, 0x31, 0xA3, 0x25, 0xA6, 0xC9, 0x61, 0x90, 0xC7, 0xBE, 0xE7, 0x72, 0x37, 0x08, 0x08,
-    0xDB, 0x04, 0x55, 0x06, 0x75, 0xA3, 0x57, 0x58, 0xC4, 0xEB, 0xC9, 0x6D, 0x1A, 0xC4, 0x52, 0xF3,
-    0xCA, 0xA1, 0x5E, 0xAC, 0xC6, 0x71, 0xAD, 0xBF, 0x73, 0x7F, 0x4D, 0x57, 0xD0, 0xE6, 0x3C, 0x73,
-    0x63, 0x98, 0x86, 0x25, 0x12, 0x0A, 0xB6, 0xEA, 0x49, 0x67, 0x12, 0x1F, 0x28, 0x4C, 0xB1, 0x41,
-    0x41, 0xDF, 0x84, 0xEC, 0x2E, 0x87, 0xD2, 0x23, 0x5A, 0xA0, 0x35, 0x61, 0x35, 0x0A, 0x57, 0xC5,
-    0x01, 0xEC, 0x81, 0xD9, 0x62, 0xC2, 0x1E, 0x5D, 0x55, 0xE2, 0xBD, 0xCB, 0xAD, 0xCE, 0xEC, 0xC4,
-    0x7F, 0xB3, 0x8C, 0x52, 0xEE, 0xD2, 0x1D, 0xF0, 0xC1, 0x78, 0xCC, 0x91, 0x38, 0xB4, 0x81, 0x61,
-    0xFF, 0x32, 0xB2, 0xA6, 0x13, 0x90, 0x8D, 0x86, 0xBC, 0x7B, 0x01, 0xA5, 0xFF, 0xF8, 0xA2, 0xD0,
-    0x24, 0xAD, 0xA8, 0x29, 0xB3, 0x04, 0x83, 0xE2, 0xCB, 0x5A, 0x51, 0x9B, 0xCC, 0x82, 0xAA, 0x21,
-    0x6D, 0xA8, 0xE0, 0x3A, 0xE3, 0x2E, 0x41, 0xCF, 0x1A, 0x0E, 0xEC, 0x4F, 0x44, 0xCF, 0x43, 0x9F,
-    0x0E, 0x9A, 0x97, 0x8D, 0x59, 0xFE, 0xCE, 0x07, 0xBC, 0x1D, 0xCD, 0xA1, 0xB9, 0xDF, 0x68, 0x88,
-    0x49, 0x61, 0x70, 0xE8, 0x53, 0x9B, 0xEF, 0x59, 0x51, 0xCB, 0x67, 0xB5, 0xEA, 0xEF, 0xF3, 0x27,
-    0xB6, 0xAA, 0x5E, 0x9A, 0x79, 0xD9, 0x8E, 0x8F, 0x09, 0x6E, 0xFC, 0x91, 0xE0, 0x03, 0xD9, 0x8C,
-    0xD9, 0xE9, 0x8F, 0xFE, 0x74, 0x13, 0x51, 0x3F, 0xF4, 0x1A, 0xFF, 0x02, 0xA6, 0xD5, 0x33, 0xA7,
-    0x9A, 0x9E, 0xE5, 0x65, 0x8E, 0xEA, 0xF1, 0x2B, 0x47, 0xB2, 0x23, 0x03, 0xB4, 0x64, 0x2E, 0x67,
-    0x5F, 0xB0, 0xC7, 0xD5, 0xB0, 0x7F, 0x65, 0x1C, 0x2D, 0x91, 0xFE, 0xA0, 0xF9, 0xE9, 0xB7, 0xD5,
-    0x40, 0xAA, 0x14, 0x0D, 0x4C, 0x8D, 0x45, 0x95, 0x73, 0xC5, 0xED, 0x4C, 0xF9, 0x03, 0x95, 0x58,
-    0x3D, 0x8C, 0xDD, 0xC6, 0x11, 0x5E, 0x3E, 0xFA, 0x8E, 0x80, 0x58, 0xAC, 0x0A, 0x09, 0x88, 0x23,
-    0x20, 0x4C, 0x69, 0x3B, 0x40, 0x58, 0x07, 0x90, 0x8E, 0x8C, 0x84, 0xC0, 0x40, 0x54, 0xE8, 0x0A,
-    0xBD, 0xA8, 0x50, 0xA1, 0xCA, 0x85, 0xE3, 0xE2, 0x52, 0x06, 0x41, 0x2C, 0x3E, 0x47, 0x85, 0x0B,
-    0x17, 0xBE, 0x22, 0xAE, 0x5C, 0x58, 0x41, 0x14, 0xC0, 0xB9, 0x2B, 0xE4, 0x22, 0x85, 0x0A, 0x59,
-    0xCB, 0x27, 0x15, 0x46, 0xE0, 0xC2, 0x4F, 0x56, 0x64, 0x15, 0x29, 0x4C, 0x41, 0x72, 0x1C, 0x48,
-    0xC5, 0x31, 0x16, 0x65, 0xF1, 0x4E, 0x24, 0xC7, 0xDF, 0x37, 0xFB, 0xDE, 0x9D, 0xCE, 0x31, 0xF2,
-    0xF3, 0x80, 0x5B, 0x72, 0x77, 0x76, 0x87, 0xBB, 0x33, 0xDF, 0x7C, 0x33, 0x7B, 0xC6, 0xF0, 0xE7,
-    0x06, 0x63, 0x12, 0xE9, 0x4D, 0x20, 0x52, 0x1B, 0x2B, 0x32, 0x31, 0xAE, 0x5E, 0x32, 0xA1, 0x40,
-    0x64, 0x5B, 0x34, 0xD9, 0xEC, 0xA5, 0x8D, 0x3F, 0xC8, 0x4F, 0x45, 0xEE, 0xF4, 0x91, 0xC8, 0xA9,
-    0x06, 0x73, 0xB3, 0xAA, 0x28, 0x8D, 0x4C, 0x05, 0x6B, 0x1E, 0xF6, 0xE3, 0x50, 0x44, 0x3A, 0x36,
-    0xF5, 0x08, 0x4D, 0x69, 0x8E, 0xF4, 0x63, 0x68, 0xAC, 0xB1, 0x14, 0xB3, 0xA8, 0xB6, 0x34, 0x58,
-    0x98, 0xEB, 0x47, 0x4C, 0x21, 0x8D, 0x31, 0x4B, 0x41, 0x6E, 0xCC, 0xB1, 0x04, 0xC2, 0xFA, 0xAA,
-    0x31, 0x6B, 0x52, 0x99, 0x54, 0xA4, 0xA1, 0x8A, 0x59, 0x86, 0x06, 0x2F, 0x71, 0x9B, 0xF6, 0x57,
-    0x57, 0x8C, 0xDC, 0xAA, 0x9A, 0x48, 0xEC, 0x89, 0x32, 0x6D, 0x8E, 0x26, 0x46, 0x6E, 0xD6, 0x57,
-    0x43, 0x89, 0x6F, 0x54, 0xB6, 0x5B, 0xB1, 0x79, 0x56, 0x37, 0x47, 0x8D, 0xBB, 0x35, 0xC5, 0x57,
-    0xDF, 0x8B, 0xCB, 0x48, 0x30, 0xDD, 0x4A, 0xD5, 0xE0, 0x33, 0x17, 0xA6, 0xEB, 0x54, 0x93, 0xA3,
-    0xE9, 0x55, 0xB3, 0xC9, 0xF8, 0xFD, 0xE6, 0x75, 0x63, 0xC2, 0x29, 0xF6, 0x95, 0xC4, 0x13, 0xE3,
-    0x7F, 0x6B, 0xB2, 0x4E, 0x59, 0x99, 0xCC, 0x4F, 0x90, 0x4B, 0x1B, 0x7C, 0x90, 0x60, 0x9B, 0x21,
-    0xCC, 0x60, 0x32, 0xCC, 0x8D, 0x06, 0x9A, 0x68, 0xF6, 0xE2, 0x81, 0xB7, 0xFA, 0xE8, 0x51, 0x27,
-    0x65, 0xE1, 0x3E, 0xE9, 0x22, 0xE9, 0x64, 0x56, 0x6C, 0x9F, 0xEC, 0x21, 0x74, 0x30, 0x45, 0x24,
-    0x51, 0x87, 0xC9, 0x45, 0x19, 0xCA, 0x47, 0x9D, 0x49, 0x06, 0x37, 0xCD, 0xA1, 0xAB, 0xA5, 0xC2,
-    0x09, 0x0C, 0xDA, 0x62, 0x4B, 0xD0, 0x12, 0xAC, 0x1A, 0x8E, 0x94, 0xDC, 0xD5, 0xE2, 0xA8, 0x78,
-    0x19, 0x8F, 0x73, 0x7E, 0x47, 0xED, 0xFD, 0xAD, 0x17, 0x2C, 0xCF, 0x16, 0x7A, 0xFC, 0xCB, 0x33,
-    0x73, 0x60, 0xD2, 0x0E, 0xD6, 0x94, 0x72, 0xD9, 0xED, 0xBC, 0xFF, 0x1D, 0xCB, 0xF7, 0x0E, 0x08,
-    0x0B, 0x4C, 0x62, 0x3A, 0x17, 0x7A, 0x4C, 0xDA, 0x05, 0xEB, 0x23, 0x18, 0xC3, 0xA4, 0x98, 0x33,
-    0xC2, 0xE4, 0xA5, 0x62, 0x7B, 0x6C, 0x1C, 0xC4, 0x31, 0xC5, 0x67, 0xE4, 0x9D, 0x55, 0x15, 0xBD,
-    0x26, 0x0F, 0x2E, 0xEA, 0x08, 0x45, 0x7B, 0x9A, 0xDD, 0x0C, 0x2B, 0x81, 0x0A, 0x8A, 0x7A, 0x88,
-    0xE4, 0xEF, 0x8B, 0x97, 0x99, 0xD9, 0xFB, 0x85, 0xFE, 0xFB, 0xA3, 0xD6, 0x77, 0x3B, 0x36, 0xCF,
-    0xE7, 0xEE, 0x55, 0x93, 0xDE, 0x95, 0x21, 0x93, 0x36, 0xEE, 0x85, 0xBF, 0xEB, 0xDA, 0x4A, 0xE3,
-    0xE4, 0xB2, 0x0C, 0x6B, 0x92, 0x0E, 0x46, 0xBA, 0x91, 0x7C, 0x2C, 0x06, 0x1E, 0xC8, 0xBE, 0x92,
-    0x49, 0x24, 0xC6, 0x76, 0xAE, 0x32, 0x02, 0xC3, 0xA6, 0x0D, 0x37, 0x21, 0x1F, 0xF7, 0x26, 0xE9,
-    0x28, 0xCC, 0x63, 0x15, 0xCE, 0x42, 0x2F, 0x1C, 0x89, 0x17, 0x8A, 0x17, 0x3A, 0x2F, 0xCC, 0xBC,
-    0x30, 0xF5, 0x42, 0xBB, 0x45, 0x2F, 0x99, 0xC8, 0x6F, 0x2E, 0x6C, 0xF4, 0x11, 0x74, 0x7E, 0x8F,
-    0x7F, 0xD6, 0x36, 0x06, 0x5E, 0x26, 0x69, 0x67, 0x70, 0xEC, 0x3A, 0xC4, 0x5E, 0x2A, 0x0B, 0xB3,
-    0x94, 0x59, 0x99, 0x3A, 0x0C, 0x5D, 0xFB, 0x10, 0x43, 0x7D, 0x67, 0xEB, 0xB5, 0xA7, 0x3B, 0xEE,
-    0x1F, 0xDC, 0xF9, 0x43, 0x36, 0xBF, 0xEB, 0x0A, 0xCC, 0xAA, 0xFB, 0x6C, 0xEA, 0x1E, 0x0E, 0xB2,
-    0xC9, 0xA1, 0xCB, 0xF8, 0x1B, 0xE2, 0x3A, 0x5D, 0x2B, 0xD3, 0xF2, 0xBC, 0x33, 0xCE, 0x0C, 0xDD,
-    0x08, 0xF8, 0xC2, 0x2C, 0x68, 0x4B, 0x4B, 0x0B, 0xF5, 0x26, 0xC3, 0x10, 0xBE, 0x52, 0xC8, 0x25,
-    0xA3, 0x41, 0x02, 0xD0, 0xD1, 0xA7, 0x84, 0x5B, 0xE2, 0x7B, 0xC5, 0x17, 0xAE, 0xA3, 0x28, 0xCF,
-    0xB0, 0xD5, 0xA8, 0x87, 0xED, 0x5F, 0x32, 0x49, 0x13, 0xC8, 0x04, 0x7E, 0x9F, 0x45, 0x7D, 0x5C,
-    0x43, 0x94, 0x36, 0x59, 0x19, 0xF5, 0x01, 0x4D, 0x99, 0xEC, 0xB8, 0xA1, 0x90, 0x1E, 0x90, 0x78,
-    0x24, 0xF2, 0x18, 0x3B, 0xF8, 0xB9, 0x3C, 0x78, 0x53, 0xA4, 0x82, 0x93, 0x93, 0x9D, 0xDF, 0x9B,
-    0x98, 0xAB, 0xE8, 0xF6, 0x80, 0xDE, 0x77, 0x58, 0xA5, 0xFE, 0x4F, 0xA8, 0xDB, 0x8B, 0x92, 0xFE,
-    0x15, 0x8A, 0x32, 0x04, 0x3A, 0x3D, 0x2D, 0xE7, 0x68, 0x21, 0xD7, 0xAB, 0x61, 0x96, 0x00, 0xB5,
-    0x8B, 0xCA, 0x16, 0x22, 0xF3, 0x47, 0xE9, 0x1F, 0x15, 0x1F, 0xB7, 0x85, 0x46, 0x75, 0x25, 0xCC,
-    0xFB, 0x6A, 0xEE, 0x10, 0xAD, 0x56, 0x5A, 0x57, 0x26, 0x4D, 0x26, 0x1D, 0x7A, 0xB5, 0x63, 0x2F,
-    0xAB, 0x65, 0xFA, 0x17, 0x77, 0x53, 0x2A, 0x7C, 0x84, 0xCB, 0xA1, 0x80, 0xCA, 0x10, 0x9D, 0x4E,
-    0x91, 0x8C, 0x07, 0x9C, 0x2B, 0x95, 0xBB, 0x21, 0xC0, 0x5A, 0xEB, 0xAE, 0x63, 0x5E, 0x81, 0xE5,
-    0x98, 0x67, 0x7B, 0x7D, 0x84, 0x78, 0x14, 0x55, 0xCE, 0x47, 0x56, 0x6F, 0x1F, 0xA1, 0xEA, 0x56,
-    0xF8, 0x05, 0xDB, 0x01, 0xA4, 0xAE, 0x8C, 0x07, 0x27, 0x1A, 0xD9, 0x08, 0xB5, 0x6C, 0x62, 0x1B,
-    0x33, 0xD8, 0x3A, 0x1C, 0x4C, 0x76, 0xA1, 0x0B, 0x10, 0xE2, 0x95, 0x98, 0xA2, 0x8E, 0x9A, 0xB4,
-    0x4C, 0x61, 0xF9, 0xB8, 0x89, 0xB7, 0x72, 0x09, 0xFA, 0xF0, 0xC9, 0x2C, 0x2B, 0xB3, 0x49, 0xDF,
-    0xDA, 0xCA, 0x56, 0x2B, 0x59, 0xD8, 0x86, 0x5D, 0xF2, 0xF6, 0x14, 0x38, 0x8A, 0xEF, 0x35, 0xEE,
-    0xB8, 0xC2, 0x53, 0xD1, 0x2D, 0xF2, 0xB3, 0xA1, 0x38, 0xFB, 0xA4, 0xCF, 0xB3, 0x53, 0xD3, 0x6E,
-    0x30, 0xF6, 0xCB, 0x3A, 0xCB, 0xF2, 0xD1, 0x4E, 0x6B, 0x3F, 0x9F, 0x19, 0xF7, 0x61, 0xF8, 0xB4,
-    0xC6, 0xCE, 0x73, 0xB8, 0x0B, 0x70, 0x04, 0x8C, 0x8D, 0xD4, 0x11, 0x76, 0x92, 0xB5, 0x06, 0x61,
-    0x11, 0x0F, 0x44, 0x1D, 0x62, 0xCE, 0x76, 0xE4, 0x9A, 0x75, 0x93, 0xDC, 0x13, 0x75, 0x0B, 0x39,
-    0xAA, 0x4C, 0x1F, 0x11, 0x2B, 0xE8, 0x94, 0xD8, 0x5D, 0xFA, 0xA8, 0x83, 0xBF, 0x8F, 0xA3, 0xB3,
-    0x61, 0x5B, 0x74, 0x92, 0x1A, 0x56, 0xC8, 0xA6, 0xA0, 0x17, 0xED, 0x14, 0xFF, 0x67, 0xE7, 0x1E,
-    0x3B, 0x37, 0x06, 0x74, 0x00, 0xA6, 0x5B, 0xE8, 0x20, 0x28, 0xD0, 0xD9, 0xB8, 0x2C, 0x17, 0xBA,
-    0x84, 0x7C, 0x8D, 0x0E, 0x69, 0x85, 0x1D, 0x0D, 0xD5, 0xC3, 0x39, 0xD1, 0xC7, 0x57, 0xD2, 0xDE,
-    0xF2, 0xA6, 0xFC, 0xD3, 0x90, 0xD2, 0xE7, 0xEE, 0xFE, 0xFE, 0x26, 0x21, 0x00, 0xFC, 0x99, 0xA5,
-    0xD5, 0xA2, 0xC2, 0x59, 0x30, 0xB3, 0x90, 0x27, 0x03, 0x4F, 0x25, 0x93, 0x14, 0xD0, 0xAF, 0x80,
-    0xEC, 0x02, 0x34, 0x35, 0x89, 0x07, 0x58, 0x1C, 0x33, 0x0B, 0x50, 0x47, 0x85, 0x80, 0xB5, 0x2D,
-    0x62, 0x39, 0xC4, 0xE0, 0x0C, 0x83, 0x30, 0x8B, 0xC3, 0xCC, 0xBC, 0x68, 0x47, 0x32, 0xC8, 0x7C,
-    0x79, 0x08, 0x62, 0x40, 0x1A, 0xE8, 0x63, 0x7C, 0x7D, 0xD5, 0xEC, 0xFB, 0xD1, 0x5A, 0x9C, 0xD4,
-    0x9A, 0xA5, 0xF1, 0xF8, 0x34, 0x49, 0x6D, 0x60, 0x1E, 0x19, 0x48, 0x6C, 0x33, 0x10, 0x11, 0xBC,
-    0x7B, 0x3F, 0xCA, 0xA1, 0x75, 0x8F, 0xA2, 0xCE, 0x0D, 0xE3, 0x55, 0xCB, 0x60, 0xE2, 0xDA, 0x25,
-    0xB9, 0x3D, 0xC6, 0xC9, 0x8D, 0x39, 0x20, 0x0F, 0x2E, 0x99, 0x5D, 0x52, 0x8E, 0x35, 0xC6, 0x2A,
-    0xAE, 0x22, 0x1D, 0x0E, 0xE6, 0x7B, 0x94, 0x81, 0x30, 0x80, 0x46, 0xCB, 0xF3, 0x26, 0x4C, 0x55,
-    0x80, 0x12, 0x26, 0x26, 0xA0, 0x2C, 0x78, 0x11, 0x4D, 0x51, 0xA1, 0x91, 0x32, 0xEE, 0xE1, 0xD0,
-    0xB8, 0x07, 0xBA, 0xE2, 0x1E, 0xAA, 0xE3, 0x1E, 0x71, 0x14, 0xF7, 0xF0, 0x73, 0x0C, 0x70, 0x22,
-    0x05, 0xC8, 0xED, 0x9C, 0xB0, 0xA9, 0xF6, 0x9A, 0x58, 0xF0, 0xAD, 0xB8, 0x4F, 0xEB, 0xC5, 0x0A,
-    0xE8, 0x81, 0x02, 0x31, 0x54, 0x35, 0x99, 0x2B, 0x85, 0x61, 0x16, 0x1F, 0x4A, 0x3B, 0x44, 0xB2,
-    0xC6, 0xB1, 0xDC, 0x61, 0x73, 0x8E, 0x50, 0x3C, 0x7C, 0x46, 0xC6, 0xAB, 0x7A, 0x16, 0x93, 0xFD,
-    0x0B, 0x5B, 0x97, 0x2D, 0x44, 0x05, 0xF6, 0x8B, 0x0D, 0x33, 0x5F, 0x35, 0x0C, 0xE9, 0x92, 0x21,
-    0xFC, 0x03, 0x32, 0x34, 0xF0, 0x56, 0xA0, 0xFB, 0x43, 0x59, 0x98, 0x06, 0xCC, 0x06, 0x8E, 0xA9,
-    0xE9, 0xCF, 0xD2, 0x8C, 0x9E, 0x60, 0x68, 0xE4, 0x75, 0x31, 0x7A, 0x35, 0xA0, 0xFD, 0x2F, 0x70,
-    0x72, 0x5F, 0x39, 0x72, 0xC1, 0xEB, 0xE2, 0x89, 0x89, 0xCC, 0xA4, 0x01, 0x1F, 0xAE, 0x2F, 0x88,
-    0x81, 0x88, 0x37, 0x9E, 0xA5, 0x94, 0x57, 0x5D, 0xA9, 0x76, 0x85, 0xCA, 0x40, 0x63, 0x11, 0x25,
-    0x44, 0xC6, 0x15, 0xA0, 0x1B, 0xFD, 0x14, 0xCC, 0x16, 0xAA, 0x2A, 0xC5, 0xC7, 0x52, 0xCE, 0x6F,
-    0xBB, 0x59, 0x8A, 0xE8, 0xC0, 0xC4, 0x1A, 0xB9, 0x21, 0x22, 0xC3, 0x67, 0x4F, 0x05, 0xDC, 0x64,
-    0x87, 0xA4, 0x4E, 0x67, 0xB0, 0x8B, 0xD8, 0x26, 0x6C, 0x61, 0x15, 0x39, 0xD1, 0x21, 0xA6, 0xDB,
-    0x54, 0xDE, 0x00, 0xCE, 0x5E, 0xA6, 0xB7, 0xC0, 0x04, 0xD7, 0x35, 0x3D, 0x0E, 0xAE, 0x62, 0xFE,
-    0xB6, 0x44, 0x35, 0x36, 0x1F, 0x0E, 0xBA, 0x4F, 0xEC, 0x6B, 0xC9, 0x6F, 0xD3, 0xCD, 0x53, 0x7E,
-    0x36, 0xCF, 0x53, 0x76, 0x9E, 0x22, 0xC3, 0x39, 0xFF, 0x07, 0x83, 0xF9, 0xEE, 0x89, 0x3A, 0xD6,
-    0xD2, 0xC2, 0x1D, 0xED, 0xD0, 0xC2, 0x80, 0xAE, 0x36, 0xE4, 0x5D, 0x1C, 0x01, 0x87, 0x91, 0x10,
-    0x7E, 0x44, 0x52, 0xC0, 0x10, 0xCA, 0x9D, 0xE2, 0x2B, 0x18, 0x55, 0x3E, 0x6F, 0x7C, 0xD9, 0x13,
-    0x92, 0xC7, 0x63, 0x1A, 0x1C, 0x81, 0x61, 0x7E, 0x85, 0x40, 0x08, 0x67, 0x05, 0xCA, 0x81, 0x1B,
-    0x4C, 0x48, 0x6B, 0xC4, 0xC4, 0xC0, 0x7A, 0xE0, 0x9E, 0x1C, 0xEF, 0x25, 0x1A, 0xEC, 0xF5, 0xC6,
-    0x76, 0xD7, 0x42, 0x92, 0xE8, 0x73, 0x8A, 0x62, 0x65, 0x6A, 0xF2, 0xB4, 0x7A, 0x36, 0xA3, 0xA1,
-    0xE9, 0x86, 0x50, 0x15, 0x6E, 0x43, 0xF1, 0x4E, 0xCE, 0xB8, 0x98, 0x29, 0xCA, 0xB5, 0xB6, 0xB0,
-    0xC8, 0x32, 0x6F, 0xB8, 0x9D, 0x4D, 0x79, 0xCF, 0xA7, 0xA7, 0x07, 0x6E, 0x80, 0xD5, 0x91, 0x08,
-    0x51, 0x24, 0x9D, 0x92, 0xC5, 0x2F, 0xE9, 0x7F, 0x21, 0xEB, 0x59, 0x8D, 0x2C, 0xBB, 0x58, 0x48,
-    0xC0, 0x23, 0xC6, 0x90, 0x26, 0x14, 0x06, 0xBE, 0xF8, 0xDB, 0x87, 0x0C, 0x1D, 0xC2, 0x96, 0xC8,
-    0x10, 0x01, 0x19, 0x62, 0x59, 0x86, 0x9C, 0x11, 0xA8, 0xA4, 0x26, 0x3E, 0x88, 0x33, 0x19, 0x8E,
-    0x94, 0xA9, 0x24, 0x13, 0xE8, 0x8B, 0x2A, 0x58, 0x0A, 0x33, 0x01, 0xC8, 0xF3, 0x50, 0x31, 0xC3,
-    0x60, 0xD6, 0x44, 0x5F, 0x8C, 0x2D, 0xC2, 0x55, 0x6E, 0x09, 0x0B, 0x41, 0xD6, 0x5D, 0x3D, 0x06,
-    0x51, 0x55, 0x0E, 0x41, 0x5B, 0x7C, 0x8A, 0x99, 0x49, 0x53, 0x34, 0xC9, 0x9B, 0x3D, 0x96, 0xDF,
-    0x45, 0xC9, 0xF9, 0xB8, 0x25, 0x34, 0xE6, 0xA5, 0xA1, 0x96, 0x72, 0x9A, 0x3B, 0xF0, 0x61, 0x73,
-    0x4D, 0xE1, 0x48, 0x5F, 0x2D, 0xAF, 0x2B, 0x9C, 0x2A, 0x85, 0xA7, 0x22, 0x8C, 0x79, 0x2B, 0x23,
-    0xFA, 0x22, 0xFA, 0xCC, 0x38, 0xDA, 0xD2, 0x7E, 0xCD, 0x12, 0x4C, 0x58, 0x96, 0x22, 0x11, 0xE5,
-    0xF1, 0x1E, 0xB3, 0x7F, 0x76, 0x79, 0xD8, 0x94, 0xF7, 0x0D, 0x76, 0x5F, 0x21, 0x1B, 0x8E, 0xB4,
-    0xE2, 0xF1, 0x75, 0x8D, 0xF4, 0x67, 0x87, 0xF1, 0xB9, 0x21, 0xC7, 0xF9, 0x8B, 0x99, 0x25, 0xB9,
-    0xD3, 0x23, 0x40, 0x69, 0x0D, 0x4D, 0x27, 0x84, 0x26, 0x22, 0x7F, 0xC8, 0x27, 0x9D, 0xF1, 0x6C,
-    0xA2, 0x91, 0xE3, 0xB3, 0xDB, 0x68, 0xCE, 0x25, 0x20, 0x9B, 0xBF, 0xC5, 0xBB, 0xE6, 0x4C, 0xB9,
-    0x35, 0x99, 0x6E, 0x6C, 0x6C, 0xCA, 0xBB, 0xBB, 0x85, 0x02, 0xCE, 0x45, 0xDD, 0x92, 0x2F, 0x3B,
-    0xD9, 0xD9, 0x58, 0xE3, 0x10, 0xB7, 0xD0, 0xD2, 0xF6, 0x1A, 0x44, 0xDE, 0x1D, 0x83, 0x89, 0xCA,
-    0x74, 0x6E, 0x6A, 0xAD, 0xFC, 0x00, 0x39, 0xE2, 0x2B, 0x38, 0xBD, 0xEB, 0x18, 0xD8, 0x1C, 0x3B,
-    0x80, 0x79, 0x94, 0xE0, 0x30, 0xA5, 0x0D, 0xBC, 0xF5, 0x1E, 0x7E, 0x89, 0xE0, 0x79, 0xB9, 0x3A,
-    0x68, 0x07, 0x4C, 0x49, 0x3A, 0x34, 0x69, 0x8B, 0x06, 0xB6, 0x5F, 0x34, 0xF5, 0xFE, 0x46, 0xC7,
-    0x38, 0x25, 0xED, 0x16, 0x2B, 0xE6, 0x2E, 0xBD, 0x73, 0xF7, 0x03, 0xAD, 0xF5, 0x8D, 0xF8, 0x1D,
-    0xA0, 0x59, 0x66, 0x56, 0x33, 0x71, 0x35, 0xDF, 0xC1, 0xDC, 0x23, 0xBE, 0xB8, 0x72, 0x10, 0xD4,
-    0x0C, 0xB2, 0xAC, 0x4C, 0x68, 0x36, 0x54, 0x07, 0xEA, 0x47, 0xB9, 0xA1, 0x50, 0xB4, 0x6C, 0xBA,
-    0x1F, 0xC9, 0x06, 0xCA, 0x4D, 0x82, 0x97, 0xDE, 0xA1, 0xA5, 0x84, 0x51, 0x80, 0x2E, 0x93, 0xFF,
-    0xFF, 0x34, 0x3C, 0xE0, 0x66, 0x00, 0xC3, 0xB3, 0x2B, 0x3A, 0xCB, 0x69, 0x40, 0x1F, 0x7E, 0x86,
-    0xD3, 0x08, 0x9B, 0x58, 0x33, 0x9D, 0x26, 0x13, 0x6F, 0x42, 0xA6, 0xEA, 0x6A, 0x41, 0x7E, 0xFB,
-    0xDA, 0x7A, 0x71, 0x39, 0xE2, 0x7C, 0x1E, 0xCB, 0x6A, 0x55, 0x36, 0xF2, 0x95, 0x4F, 0xA1, 0x72,
-    0x8F, 0x35, 0x94, 0x29, 0x07, 0x8E, 0x5F, 0xFA, 0x25, 0x92, 0xEB, 0xD6, 0x80, 0x1B, 0xC0, 0x6F,
-    0xFA, 0xE2, 0xAD, 0x8F, 0xBA, 0x9F, 0x34, 0x69, 0x78, 0xA7, 0x45, 0xF1, 0x19, 0x6E, 0x35, 0xB1,
-    0xB8, 0x48, 0x2A, 0xFA, 0x02, 0xEE, 0xDC, 0xD1, 0x8F, 0x37, 0xE9, 0x99, 0x19, 0xDB, 0x10, 0xED,
-    0xC5, 0xE7, 0x47, 0x13, 0x0D, 0xA0, 0x6F, 0xB3, 0xFD, 0x78, 0x3C, 0xDE, 0xCB, 0x85, 0xE4, 0xDE,
-    0x7E, 0x7F, 0x4E, 0xC8, 0xFF, 0x63, 0xB4, 0xFE, 0xB7, 0x21, 0x80, 0xAC, 0xA3, 0xF5, 0x37, 0x04,
-    0x17, 0x08, 0x16, 0xF5, 0x90, 0x8E, 0xCF, 0x0E, 0xA7, 0x65, 0x3E, 0xAE, 0x98, 0xE6, 0x0A, 0x50,
-    0x96, 0x77, 0xF8, 0xC4, 0xA8, 0xDD, 0x6A, 0x7F, 0x07, 0xB0, 0x4A, 0x6E, 0xFE, 0xAE, 0x14, 0x28,
-    0x39, 0x41, 0x50, 0x34, 0x3E, 0xCD, 0x58, 0x5E, 0x0E, 0xCD, 0x3C, 0x2E, 0x14, 0xF6, 0xEE, 0xD3,
-    0x86, 0xC6, 0x43, 0x41, 0x04, 0xC8, 0x07, 0x0C, 0xE2, 0x8C, 0xC9, 0x45, 0xE4, 0xE4, 0x6C, 0x74,
-    0x92, 0x67, 0x49, 0x95, 0x5C, 0xB7, 0x39, 0x94, 0x1F, 0xF8, 0x23, 0x8C, 0x5D, 0xFC, 0x35, 0x45,
-    0xB9, 0x0B, 0xFA, 0x8A, 0x51, 0x8A, 0xE7, 0x19, 0x52, 0xA3, 0x56, 0xBC, 0x64, 0xB4, 0x9B, 0x32,
-    0xD3, 0xCA, 0x24, 0xF6, 0x20, 0x1C, 0x98, 0xD2, 0x26, 0xCF, 0xBA, 0xDB, 0x97, 0x31, 0x66, 0xB4,
-    0xA3, 0xFC, 0x6E, 0x47, 0xEA, 0xA7, 0x2B, 0x7A, 0x31, 0x19, 0xD5, 0x96, 0x1E, 0x8C, 0x77, 0xDC,
-    0xC6, 0xC6, 0x9F, 0xD4, 0xAC, 0xFE, 0x7E, 0x35, 0xBF, 0x9C, 0xB1, 0x77, 0x44, 0x1F, 0x7A, 0x73,
-    0x09, 0x7A, 0x5C, 0x67, 0x9E, 0x83, 0xAB, 0x8C, 0x9D, 0x36, 0xBF, 0x86, 0xBB, 0xB2, 0xF4, 0x69,
-    0x6B, 0xB1, 0xC9, 0xA7, 0xD2, 0x33, 0x6C, 0xA3, 0xAF, 0x71, 0x0A, 0x5B, 0x47, 0xC1, 0x95, 0x05,
-    0x72, 0x12, 0xFF, 0xF8, 0xAD, 0xBB, 0x1F, 0xAC, 0xFB, 0xDC, 0x39, 0xD1, 0x0A, 0xDF, 0xA7, 0x3D,
-    0x5F, 0x69, 0x15, 0x3E, 0xAF, 0x6A, 0xD4, 0x9A, 0x91, 0xCF, 0x3D, 0xB1, 0x4F, 0x45, 0xA9, 0xCF,
-    0x4C, 0x4E, 0x95, 0x8C, 0xE4, 0x59, 0x11, 0x8D, 0x4B, 0x8A, 0x21, 0x1C, 0xB9, 0x53, 0xDA, 0x4B,
-    0x1F, 0xBA, 0x6D, 0x14, 0x5E, 0x33, 0x57, 0xBA, 0x3A, 0xE9, 0x48, 0x62, 0x15, 0x32, 0x31, 0x62,
-    0x01, 0xC5, 0x74, 0x0A, 0xF2, 0x47, 0x76, 0x65, 0xC9, 0x9F, 0xE9, 0x6D, 0xE0, 0x31, 0xF8, 0x0F,
-    0x0C, 0x82, 0x32, 0x7F, 0x69, 0x35, 0xF0, 0x65, 0x7E, 0xD4, 0xF3, 0x06, 0xA0, 0x22, 0x7E, 0x47,
-    0x6F, 0x00, 0xBB, 0x22, 0xC4, 0xFB, 0x25, 0x7F, 0x1D, 0x0D, 0x17, 0x09, 0x03, 0x9C, 0x32, 0x76,
-    0x8C, 0xC0, 0x84, 0x25, 0x8C, 0xF5, 0x75, 0xCC, 0xE2, 0x2D, 0xED, 0x5E, 0x43, 0x40, 0xB7, 0x24,
-    0xB1, 0x5A, 0xAF, 0x86, 0x8E, 0x87, 0xC7, 0xD8, 0xAA, 0x47, 0xA1, 0x2F, 0xD3, 0xC4, 0x43, 0x70,
-    0xDE, 0xA0, 0xB0, 0xC9, 0x9F, 0x91, 0xCE, 0xD3, 0xCD, 0x0B, 0x2F, 0xB2, 0x3D, 0xB6, 0xC2, 0xF6,
-    0xFC, 0x35, 0x7F, 0x43, 0xF2, 0x67, 0xEF, 0xD5, 0xB0, 0xDC, 0x51, 0x9F, 0xB1, 0x0A, 0x7C, 0x7D,
-    0xC5, 0x21, 0xF6, 0x8F, 0xAD, 0x64, 0x6D, 0xDA, 0x1E, 0x5B, 0x41, 0x05, 0xD1, 0x1C, 0x5B, 0x41,
-    0x40, 0xD6, 0x68, 0x7B, 0xB6, 0xB1, 0x6F, 0x87, 0xAC, 0x3E, 0x74, 0x28, 0x38, 0xED, 0x6B, 0x15,
-    0x85, 0xE5, 0x1C, 0x28, 0x1A, 0x19, 0x50, 0xEF, 0x8D, 0xAE, 0xB6, 0x2F, 0xB6, 0x35, 0xCD, 0xF1,
-    0x14, 0xF6, 0xDF, 0x5A, 0xF5, 0xCA, 0x85, 0xD2, 0xFC, 0x18, 0x50, 0xB8, 0x72, 0xD4, 0xF8, 0x1C,
-    0xD5, 0x41, 0xD6, 0x93, 0x9E, 0xE5, 0x33, 0x5C, 0xC2, 0x50, 0x07, 0xC0, 0x42, 0x45, 0x6D, 0x7B,
-    0xE0, 0xEA, 0x91, 0x9C, 0x91, 0xB7, 0x21, 0xE1, 0x7F, 0x1B, 0x84, 0x09, 0x70, 0x13, 0x69, 0x23,
-    0x44, 0x29, 0x11, 0xF9, 0x7F, 0x3F, 0x00, 0x11, 0x70, 0x9B, 0xD4, 0xE9, 0x20, 0x7A, 0x81, 0xE3,
-    0x64, 0x5C, 0x9F, 0x06, 0x33, 0xAA, 0xEA, 0xDD, 0x0F, 0x1D, 0x3C, 0x04, 0xAF, 0xBC, 0x42, 0xF4,
-    0xA0, 0x74, 0x96, 0x0E, 0xE0, 0x6F, 0x12, 0xD9, 0xAC, 0xB3, 0xCE, 0x1C, 0xE4, 0x89, 0x18, 0x98,
-    0xB8, 0x2E, 0xEF, 0xFB, 0xE3, 0x98, 0x56, 0x0F, 0xBD, 0x79, 0x21, 0x91, 0xAD, 0x96, 0x04, 0x38,
-    0x22, 0x64, 0xF8, 0x5F, 0x17, 0xA3, 0xA9, 0xC3, 0x80, 0x67, 0x4E, 0x83, 0x58, 0xBA, 0xC5, 0xDF,
-    0x37, 0xD3, 0x5A, 0xB5, 0x6A, 0x55, 0xFC, 0xFF, 0xFF, 0xFF, 0x9F, 0x03, 0xF1, 0x4F, 0x20, 0xFE,
-    0xC7, 0x00, 0x02, 0x00, 0x45, 0xCF, 0xBD, 0x09, 0x02, 0x41, 0x10, 0xC5, 0xF1, 0x07, 0x07, 0x1A,
-    0x88, 0x4C, 0x09, 0x96, 0x70, 0x89, 0xF9, 0x6C, 0x1F, 0x57, 0x8C, 0x96, 0x63, 0x17, 0xA7, 0x9D,
-    0x5C, 0x60, 0x01, 0x17, 0x6C, 0x60, 0x32, 0x3C, 0xE7, 0x63, 0xD1, 0x4D, 0x7E, 0xFC, 0xE1, 0x31,
-    0xB0, 0xC0, 0xEF, 0x9D, 0x87, 0x56, 0xC8, 0x90, 0xA5, 0x0C, 0x59, 0xCA, 0xFB, 0x90, 0x7E, 0x6A,
-    0x2F, 0x5B, 0xC9, 0xD7, 0x63, 0xB2, 0x18, 0xAF, 0xFD, 0x64, 0x31, 0xE6, 0x36, 0x9B, 0x27, 0x19,
-    0x77, 0x9C, 0xFD, 0x48, 0xCB, 0xBC, 0xD1, 0x34, 0x93, 0xDD, 0xBD, 0xAF, 0x64, 0x53, 0xDA, 0xE4,
-    0x09, 0x65, 0xBF, 0x78, 0xBA, 0x8C, 0x2C, 0x5B, 0xB8, 0x44, 0x42, 0x77, 0x89, 0x84, 0x3E, 0xE7,
-    0x48, 0x28, 0x32, 0xA1, 0x4B, 0xA6, 0xEF, 0x5A, 0x59, 0x09, 0xAD, 0xC4, 0xF5, 0xFF, 0x57, 0x7C,
-    0x01,
+static const uint8_t notosans_16_boldBitmaps[34773] = {
+    0xD5, 0x9B, 0xB1, 0xCF, 0xE7, 0xC6, 0x99, 0xDF, 0xBF, 0x24, 0xBD, 0xCB, 0x8B, 0x58, 0x50, 0xC5,
+    0x6D, 0x0E, 0xB6, 0x80, 0x63, 0x1B, 0x38, 0xC0, 0xB1, 0x4D, 0x37, 0x94, 0xB6, 0x50, 0xA1, 0x62,
+    0x17, 0xC1, 0xBE, 0x3E, 0x04, 0x2A, 0x5C, 0x19, 0xC8, 0x29, 0x40, 0xDE, 0xBF, 0x20, 0x1E, 0x5A,
+    0x42, 0xE0, 0x42, 0x85, 0xB6, 0xB0, 0x9D, 0xC2, 0x85, 0x55, 0xE8, 0x02, 0xF9, 0x35, 0x92, 0x6D,
+    0x52, 0x08, 0x41, 0xE2, 0x19, 0xE9, 0x2D, 0x5C, 0x6C, 0xF1, 0xF2, 0xBC, 0xE7, 0xB8, 0x50, 0xB1,
+    0x54, 0x56, 0x17, 0x05, 0x72, 0xB1, 0x23, 0x9B, 0x6B, 0x71, 0x57, 0xC3, 0xF9, 0x5C, 0x31, 0xFC,
+    0xBD, 0x5A, 0xC9, 0x12, 0xB4, 0xBA, 0x78, 0x11, 0x99, 0x18, 0x0E, 0x87, 0x43, 0x72, 0x66, 0xF8,
+    0xF0, 0x99, 0x67, 0x9E, 0xE7, 0xF9, 0x3E, 0x34, 0x0B, 0xB7, 0xB8, 0xB2, 0x99, 0x85, 0x5B, 0xB4,
+    0xB1, 0x0F, 0xEE, 0x2D, 0x9A, 0xD8, 0x05, 0xFB, 0x26, 0xF5, 0x7A, 0x61, 0x90, 0x54, 0xAF, 0x66,
+    0xE1, 0x0E, 0xCF, 0xC5, 0x62, 0xE0, 0xC5, 0xC4, 0x4B, 0xF0, 0x62, 0x72, 0x39, 0x3D, 0xBD, 0xD9,
+    0x9C, 0x14, 0xA5, 0xAD, 0x0E, 0x92, 0x2D, 0xA3, 0xD4, 0xFB, 0x24, 0xB5, 0xC1, 0x8C, 0xAA, 0xD6,
+    0x76, 0x3A, 0x5C, 0x79, 0x26, 0xCA, 0x00, 0xB4, 0x00, 0xA7, 0x00, 0xE1, 0x28, 0x3D, 0x7F, 0xEF,
+    0xAA, 0xEC, 0x33, 0x51, 0xEA, 0xBC, 0x93, 0x9A, 0x60, 0xC6, 0x1A, 0xE0, 0x1D, 0x80, 0xD5, 0x02,
+    0xE9, 0xC2, 0xF1, 0xAF, 0x38, 0x1A, 0x9A, 0x8F, 0x5B, 0x4B, 0xF5, 0x22, 0x99, 0xA7, 0x1F, 0x7E,
+    0x46, 0xD2, 0x20, 0xE9, 0x0D, 0x49, 0x7F, 0x25, 0xE9, 0xF8, 0xC1, 0x50, 0x42, 0xAA, 0xF6, 0x7E,
+    0xDE, 0xE1, 0xED, 0x1F, 0x05, 0xF7, 0xCB, 0xF9, 0x6B, 0xFD, 0xF2, 0x86, 0x6A, 0xFE, 0xBD, 0x04,
+    0xA3, 0x3A, 0xEE, 0xAB, 0x80, 0x45, 0x4D, 0x3E, 0x8B, 0x2A, 0x61, 0xD0, 0x1B, 0xCC, 0xFA, 0xAB,
+    0x76, 0x1B, 0x9B, 0xEF, 0x27, 0xF7, 0xA3, 0x8F, 0x38, 0x06, 0x6E, 0x02, 0xDE, 0xC1, 0xA8, 0x7F,
+    0x77, 0xEF, 0xA1, 0x5E, 0x9A, 0x51, 0x87, 0x8D, 0x49, 0xE5, 0xA6, 0x82, 0x4D, 0x42, 0x02, 0x2F,
+    0x37, 0xC8, 0xDE, 0x5C, 0x65, 0x46, 0xF5, 0x13, 0x32, 0x5E, 0x6D, 0xE8, 0x7D, 0x37, 0xAB, 0x8A,
+    0xCD, 0xD2, 0x06, 0x89, 0x72, 0xAB, 0x57, 0xC9, 0x78, 0x77, 0x39, 0x4A, 0x6D, 0x30, 0x6F, 0x6D,
+    0x17, 0x5F, 0x2D, 0xB7, 0x36, 0xD0, 0x32, 0x9A, 0xB7, 0x57, 0x77, 0x85, 0xB5, 0x21, 0x9A, 0x97,
+    0x13, 0x62, 0x33, 0xA7, 0xB1, 0x9B, 0x2F, 0xFE, 0xDF, 0x6E, 0xA6, 0xCA, 0x77, 0x8F, 0x48, 0xF5,
+    0xDA, 0xCD, 0xC6, 0xAB, 0x8A, 0xD5, 0xDA, 0x06, 0x95, 0x9B, 0x52, 0x15, 0x25, 0x64, 0x3C, 0x92,
+    0x1B, 0x9A, 0xC5, 0x8D, 0x32, 0x63, 0x01, 0x5E, 0xC6, 0xAB, 0x67, 0x52, 0x37, 0xAB, 0x60, 0x92,
+    0x24, 0x15, 0xE7, 0x63, 0x7F, 0x8A, 0x51, 0x12, 0x2C, 0x52, 0x05, 0x9B, 0x54, 0x73, 0x17, 0xA9,
+    0xD9, 0x2A, 0xA4, 0x26, 0x96, 0x48, 0x4D, 0xAC, 0x90, 0xEA, 0xD4, 0x24, 0xA9, 0xE2, 0x38, 0x4A,
+    0x05, 0x04, 0x49, 0x0E, 0x2F, 0x15, 0x24, 0xB5, 0x6B, 0x03, 0xEA, 0xD7, 0x0E, 0xBC, 0x59, 0xCC,
+    0xEA, 0x82, 0x0D, 0x36, 0xF4, 0x1B, 0x93, 0x9B, 0x1B, 0xF0, 0x6E, 0x2E, 0x61, 0x70, 0x41, 0x2E,
+    0xC9, 0x46, 0xB9, 0x2D, 0xB3, 0xC2, 0xD0, 0x01, 0x4C, 0x35, 0x6C, 0x6E, 0x91, 0x63, 0xEA, 0x37,
+    0xE9, 0xAA, 0x24, 0xDC, 0xDD, 0x07, 0xC9, 0xDD, 0xF8, 0xF5, 0xBD, 0xCD, 0x4A, 0xC6, 0x37, 0x4B,
+    0x81, 0xCC, 0x54, 0x47, 0x31, 0x74, 0xA1, 0x4C, 0x32, 0x53, 0x15, 0x65, 0x7D, 0x1D, 0xE5, 0x7C,
+    0xB3, 0xCA, 0x8D, 0x39, 0xDB, 0xEB, 0xCC, 0x54, 0x25, 0xF5, 0x41, 0xA8, 0x5D, 0x65, 0x7D, 0x99,
+    0xD4, 0x06, 0xD9, 0x51, 0xD7, 0xDC, 0xD0, 0xE6, 0xA7, 0x9B, 0x28, 0x64, 0xE6, 0x3A, 0x0A, 0x99,
+    0xA9, 0x5D, 0x4B, 0x64, 0x7D, 0x17, 0xEA, 0x58, 0x20, 0xEB, 0xFB, 0xD0, 0xAC, 0x55, 0x12, 0x83,
+    0xF5, 0x7D, 0x68, 0x97, 0x3A, 0x56, 0xA9, 0x40, 0x0C, 0x76, 0xBC, 0x30, 0x48, 0xC5, 0x35, 0x49,
+    0xC6, 0x4B, 0x55, 0xDC, 0x0B, 0xE5, 0xAA, 0x62, 0xEA, 0xC7, 0x7F, 0xDB, 0x3F, 0x78, 0xC0, 0x4B,
+    0x40, 0x34, 0x80, 0xBF, 0xC4, 0xBD, 0x41, 0x1D, 0x83, 0x2A, 0xA2, 0xC4, 0xB7, 0x83, 0xFA, 0xC0,
+    0x58, 0xA6, 0x7A, 0x55, 0xE9, 0xFF, 0xD5, 0x4E, 0xFD, 0x6A, 0x91, 0x8A, 0x4D, 0x92, 0x1D, 0xA4,
+    0x6E, 0x92, 0xEA, 0x5C, 0x71, 0xF1, 0xC4, 0x9D, 0xFC, 0x67, 0x20, 0x39, 0xE0, 0x06, 0x30, 0x7F,
+    0xFA, 0x8E, 0x8F, 0x1F, 0x29, 0xAE, 0x4A, 0xDD, 0xE2, 0xDE, 0xA2, 0x5D, 0xCD, 0x9B, 0x34, 0x8B,
+    0xF1, 0xD7, 0x64, 0xB8, 0x43, 0x32, 0xDC, 0x21, 0x49, 0x92, 0xEC, 0x4B, 0x5C, 0x49, 0x66, 0x71,
+    0xFE, 0xCF, 0x25, 0x99, 0x49, 0x75, 0x94, 0xF0, 0x6A, 0x17, 0x95, 0x48, 0x66, 0x56, 0xBD, 0x49,
+    0xCE, 0xAB, 0x5D, 0x55, 0x20, 0x99, 0xA0, 0x6A, 0x93, 0xAC, 0x57, 0xBB, 0x4A, 0x0C, 0xEA, 0x83,
+    0xAA, 0x24, 0xD9, 0x49, 0x4D, 0x94, 0x18, 0xD5, 0x05, 0x55, 0x48, 0x26, 0x57, 0x7C, 0x82, 0x99,
+    0x7A, 0x36, 0xF5, 0x30, 0xB5, 0x10, 0x1B, 0x2A, 0x5E, 0x42, 0xE6, 0x03, 0xC6, 0x26, 0xDA, 0xB9,
+    0xE4, 0x78, 0x91, 0xFD, 0xCD, 0xA6, 0xEE, 0x23, 0x54, 0x81, 0x17, 0x04, 0x19, 0xA2, 0xDA, 0xC4,
+    0x50, 0x27, 0x37, 0x15, 0xFC, 0x64, 0x91, 0xBD, 0x93, 0xD4, 0x2F, 0xF8, 0x36, 0xF6, 0x6B, 0x93,
+    0x2A, 0x60, 0xB0, 0x30, 0x36, 0x30, 0xCA, 0x32, 0x48, 0xD7, 0x24, 0xC9, 0x8D, 0x22, 0x14, 0xC4,
+    0x12, 0x4A, 0x38, 0x85, 0xDF, 0x71, 0x3B, 0x9A, 0x97, 0xA8, 0x07, 0xBC, 0x6C, 0x50, 0x17, 0x55,
+    0xA3, 0xE2, 0xD1, 0x4E, 0xF2, 0xE0, 0x27, 0x59, 0x90, 0x83, 0x60, 0x21, 0x35, 0x5B, 0x85, 0x5F,
+    0x64, 0x82, 0xD4, 0x6C, 0x52, 0x85, 0x24, 0xBC, 0x64, 0x67, 0xC9, 0x04, 0xC9, 0xAC, 0x92, 0x89,
+    0x52, 0xFF, 0xE9, 0x7D, 0xDD, 0xF7, 0x28, 0xF5, 0xC0, 0x47, 0x40, 0x02, 0x70, 0x80, 0x97, 0x24,
+    0x1D, 0x73, 0xBD, 0x04, 0x0A, 0x20, 0x18, 0x48, 0xD5, 0xBB, 0x15, 0x7E, 0x90, 0x09, 0x52, 0x1B,
+    0xA5, 0x2A, 0x49, 0x25, 0x83, 0xFE, 0x82, 0xA1, 0x82, 0x41, 0x24, 0xC9, 0xB0, 0xE9, 0x09, 0xC7,
+    0x94, 0xDB, 0xAD, 0x18, 0x25, 0x37, 0xE7, 0x8E, 0xDA, 0xF4, 0x9A, 0x1A, 0x8E, 0x1F, 0x38, 0x6E,
+    0x02, 0x6F, 0x01, 0xBE, 0x83, 0x41, 0x17, 0xAE, 0x4A, 0xB9, 0x31, 0x99, 0x55, 0x2A, 0x99, 0xA5,
+    0x96, 0x51, 0x22, 0x49, 0x0D, 0xAB, 0x64, 0xDD, 0xAC, 0x6A, 0x63, 0x54, 0x7F, 0x2B, 0xA9, 0x48,
+    0xED, 0xAA, 0x36, 0xD8, 0x59, 0xEE, 0x69, 0xC6, 0x3A, 0xD6, 0x49, 0xC6, 0x77, 0x6B, 0xB9, 0xC9,
+    0xCE, 0x1D, 0xB0, 0x59, 0xE0, 0x3E, 0xC0, 0x7B, 0x00, 0xA3, 0x0A, 0x46, 0xA9, 0x4E, 0x92, 0xBA,
+    0x55, 0x99, 0x2E, 0x05, 0x63, 0x0B, 0x6B, 0x05, 0x08, 0xF0, 0x06, 0x42, 0x77, 0xFF, 0xE8, 0x5A,
+    0xBD, 0x49, 0x05, 0x92, 0x9C, 0x97, 0xFA, 0x20, 0x35, 0x30, 0x1F, 0xEE, 0x0A, 0x3D, 0xA0, 0xA1,
+    0xC6, 0x4B, 0x66, 0x91, 0x9A, 0x24, 0x95, 0x8C, 0x92, 0x9B, 0x24, 0xF3, 0xC1, 0xBB, 0x32, 0xD1,
+    0xC2, 0xD6, 0x41, 0xAA, 0x21, 0xC9, 0xB2, 0x4A, 0x97, 0x86, 0x03, 0xD3, 0x1D, 0x33, 0x94, 0x30,
+    0x55, 0xB0, 0x54, 0xB0, 0x95, 0xCC, 0xF9, 0x3B, 0x39, 0x2F, 0x99, 0x59, 0xEA, 0xC2, 0xA5, 0xA1,
+    0x8E, 0x36, 0x95, 0x58, 0x82, 0x03, 0x0C, 0xFF, 0x89, 0xDB, 0xA8, 0xFF, 0x88, 0x21, 0x33, 0xE1,
+    0xDD, 0x20, 0xF3, 0xE1, 0xA6, 0x36, 0xE2, 0xEB, 0x64, 0xD6, 0x8A, 0x67, 0xB9, 0x8B, 0x77, 0x30,
+    0x35, 0x30, 0xA9, 0x67, 0x94, 0xFE, 0x5C, 0x32, 0xC0, 0xEF, 0x00, 0xCE, 0x0B, 0x97, 0x8E, 0x8E,
+    0xDC, 0x94, 0xBF, 0x59, 0xC1, 0x98, 0xD9, 0xA2, 0x4A, 0xCA, 0x23, 0x6F, 0x63, 0xFE, 0x8A, 0x99,
+    0x83, 0xD2, 0xCE, 0x3D, 0xDD, 0xBA, 0xB3, 0x92, 0x0D, 0x52, 0xBB, 0xED, 0xB5, 0xFD, 0xB2, 0xD7,
+    0xBA, 0x39, 0x3F, 0xB8, 0x73, 0xE4, 0x75, 0x19, 0x90, 0x81, 0xD0, 0xA7, 0x1B, 0xA9, 0x8D, 0xE2,
+    0x34, 0xA9, 0x0F, 0x8C, 0x4D, 0x34, 0xA1, 0xA2, 0xE6, 0x32, 0x83, 0xCB, 0x73, 0x63, 0x90, 0x63,
+    0x90, 0x63, 0x15, 0xE0, 0x99, 0xED, 0x6A, 0xE7, 0x8A, 0xE3, 0x20, 0x73, 0x37, 0xAA, 0x05, 0x55,
+    0xB8, 0xB9, 0xE0, 0x27, 0xE9, 0x5B, 0xFC, 0x12, 0x98, 0x7B, 0x98, 0x0B, 0xC7, 0xB8, 0x4F, 0x27,
+    0x49, 0x4F, 0x31, 0xC8, 0xB0, 0xC9, 0xC0, 0x64, 0x20, 0x76, 0x5B, 0xC5, 0xCB, 0x49, 0xE6, 0x77,
+    0xA8, 0xD9, 0xF0, 0x05, 0x2E, 0x4F, 0xD6, 0x2E, 0x31, 0xB6, 0xD8, 0xB5, 0xE3, 0x0C, 0xF8, 0x00,
+    0xEE, 0xAE, 0x1D, 0x77, 0x92, 0x5E, 0xB8, 0xCE, 0x20, 0x59, 0x9F, 0xDF, 0xB8, 0x5F, 0x24, 0x13,
+    0xAB, 0x13, 0x62, 0x01, 0x9B, 0x2C, 0x51, 0x1D, 0xEF, 0x4A, 0x47, 0x92, 0x2E, 0x0E, 0xEE, 0x94,
+    0x2B, 0xC9, 0x2C, 0x66, 0xD0, 0xC3, 0x5B, 0x91, 0xDA, 0xCD, 0xAC, 0xFC, 0x12, 0x5D, 0xBD, 0x38,
+    0xB8, 0x53, 0x5E, 0x49, 0x66, 0x31, 0xA3, 0x3E, 0xB9, 0xD5, 0x5B, 0x1F, 0xDC, 0x69, 0x6A, 0x83,
+    0x7D, 0x6B, 0x6B, 0xC3, 0x25, 0x49, 0x2A, 0x06, 0xA9, 0x9E, 0x33, 0x71, 0x6D, 0x52, 0x41, 0x52,
+    0xCD, 0xAA, 0x8E, 0x49, 0x96, 0x41, 0x6E, 0x93, 0xFA, 0x4D, 0xAA, 0x59, 0x95, 0x07, 0x61, 0x99,
+    0x24, 0xC7, 0xA8, 0x92, 0xF5, 0xC0, 0xC3, 0xA3, 0xA4, 0x27, 0x5F, 0x38, 0x39, 0x39, 0x39, 0x06,
+    0x7E, 0xB3, 0xF3, 0x7A, 0x3A, 0x1F, 0xDA, 0xD1, 0xD1, 0xD1, 0xBF, 0xFE, 0xA4, 0x44, 0x56, 0x5E,
+    0xAC, 0xFA, 0x21, 0x0B, 0x88, 0x92, 0x45, 0xEA, 0x99, 0x24, 0xCB, 0x90, 0xB5, 0x81, 0x9A, 0x25,
+    0x0B, 0xC5, 0x82, 0x59, 0x0D, 0x8B, 0x8E, 0x99, 0x0A, 0x18, 0x1A, 0xEE, 0xAB, 0x61, 0xCE, 0xEC,
+    0xF1, 0x3F, 0x25, 0x3D, 0x79, 0xE8, 0xA6, 0x24, 0xC9, 0xC2, 0xE4, 0xB2, 0x64, 0x88, 0xFD, 0xD0,
+    0xC5, 0xAF, 0xA9, 0x89, 0x52, 0x13, 0x33, 0x67, 0xF4, 0xAB, 0xE4, 0x82, 0x2A, 0xBC, 0x5A, 0x76,
+    0x29, 0x34, 0xE5, 0x85, 0xC8, 0x8E, 0xD2, 0xA5, 0x87, 0x28, 0x65, 0x46, 0x89, 0xF9, 0xE3, 0xDD,
+    0x7A, 0xE9, 0x82, 0x24, 0x5D, 0xE4, 0xBE, 0x24, 0x39, 0x98, 0xA4, 0x06, 0x88, 0x92, 0x49, 0xC3,
+    0x53, 0x48, 0x4C, 0x92, 0xF3, 0x65, 0x92, 0xD4, 0xCF, 0xF5, 0xAA, 0x1B, 0xAF, 0x35, 0x4B, 0x1B,
+    0x1A, 0xB8, 0xBC, 0x76, 0x93, 0x81, 0x67, 0x62, 0xEF, 0xDD, 0xE4, 0x9E, 0x8E, 0xE6, 0x7B, 0xC8,
+    0x3E, 0xBD, 0x99, 0x67, 0x36, 0x59, 0x6D, 0xF6, 0x72, 0x94, 0xD3, 0x66, 0xAB, 0x28, 0x57, 0x44,
+    0x5B, 0x45, 0x51, 0x44, 0x7B, 0x39, 0x8A, 0x2A, 0xDA, 0x67, 0x52, 0xC9, 0xB3, 0x8B, 0x19, 0xB9,
+    0xCB, 0xDD, 0x60, 0xBC, 0xE5, 0x0C, 0xDF, 0x4F, 0x5D, 0xAA, 0x50, 0x1B, 0x24, 0x3D, 0x79, 0x58,
+    0x45, 0x2A, 0x46, 0x15, 0xD7, 0x25, 0xD2, 0xB7, 0xDC, 0x94, 0xA5, 0xE7, 0x24, 0x95, 0xC0, 0x28,
+    0xE9, 0xE2, 0xC9, 0x75, 0x49, 0x72, 0xAB, 0x24, 0x11, 0xA5, 0x4C, 0x64, 0x55, 0x20, 0xA9, 0x4A,
+    0x48, 0x6A, 0x22, 0xA3, 0xD4, 0x46, 0xBC, 0xD4, 0xAE, 0xCE, 0x4B, 0xFD, 0x62, 0x66, 0xC9, 0x04,
+    0x13, 0x24, 0x3B, 0xF7, 0x8B, 0xE4, 0xA6, 0x6E, 0x95, 0xF0, 0x6D, 0x54, 0xC1, 0xD8, 0x6C, 0x2A,
+    0x81, 0xA4, 0x0A, 0x40, 0x35, 0xC0, 0xD0, 0x00, 0xF8, 0x36, 0x1D, 0x7D, 0x0B, 0xDF, 0x45, 0x89,
+    0xC9, 0xAC, 0x92, 0x0B, 0x66, 0x91, 0x6C, 0xB0, 0x41, 0x32, 0x2B, 0xB3, 0xD4, 0x47, 0xC3, 0x83,
+    0x41, 0x64, 0xD9, 0xC3, 0xDA, 0x02, 0x8B, 0x09, 0x17, 0x99, 0xF1, 0x25, 0xA7, 0xA8, 0xA6, 0x8D,
+    0xEA, 0x56, 0x13, 0xC4, 0xC4, 0xAF, 0xBE, 0x4D, 0x05, 0xCC, 0x2D, 0x79, 0x96, 0x31, 0xF0, 0xFE,
+    0x0D, 0x2E, 0xA3, 0x86, 0x36, 0xAA, 0xDD, 0x4C, 0x90, 0x59, 0xF0, 0xE2, 0x16, 0xAA, 0xB9, 0x12,
+    0x65, 0xA3, 0x01, 0x66, 0xE0, 0xFC, 0xC1, 0x77, 0x0F, 0xFC, 0xE8, 0xB8, 0xAE, 0x16, 0xA2, 0x2C,
+    0xC4, 0x02, 0x58, 0x2B, 0x96, 0x8B, 0xA1, 0x61, 0xD0, 0x93, 0x6D, 0x52, 0x5E, 0x27, 0x64, 0x56,
+    0x65, 0xA1, 0x2A, 0x13, 0x3E, 0x23, 0x5B, 0x0E, 0xB7, 0xF4, 0x51, 0x52, 0xB7, 0x49, 0x6A, 0x91,
+    0xD4, 0x30, 0x17, 0xFF, 0xAD, 0x02, 0x16, 0x01, 0x8B, 0x7A, 0x58, 0x74, 0x11, 0x26, 0xE9, 0xC2,
+    0x55, 0x19, 0x1E, 0x0C, 0x6A, 0x81, 0xA1, 0x82, 0x2C, 0x70, 0xF0, 0xE6, 0xDE, 0xF3, 0xAC, 0x6D,
+    0x54, 0x47, 0x85, 0xC4, 0x8C, 0x57, 0x1F, 0x4D, 0x50, 0xC5, 0x95, 0x28, 0x71, 0x0B, 0xC9, 0xAC,
+    0x78, 0xB5, 0xC9, 0x04, 0x55, 0xBC, 0x12, 0x25, 0xEE, 0xA0, 0xFC, 0xC6, 0x6D, 0x34, 0x21, 0x53,
+    0xA1, 0xE6, 0x25, 0x54, 0xE3, 0xF1, 0xDF, 0x66, 0x32, 0xFB, 0x4B, 0xE7, 0xB5, 0x62, 0x14, 0xDC,
+    0x97, 0x80, 0xBB, 0x79, 0x45, 0xBD, 0x0B, 0x89, 0x5F, 0x1D, 0x5D, 0xD9, 0xB5, 0x99, 0xFD, 0xB0,
+    0x1D, 0x5D, 0x03, 0xCE, 0x20, 0x02, 0x67, 0xE9, 0xE4, 0xF5, 0x87, 0xAE, 0x3D, 0x74, 0xF8, 0x64,
+    0x2B, 0x5F, 0xD0, 0x66, 0x94, 0x78, 0xFF, 0xE4, 0x95, 0xBD, 0x4D, 0x88, 0xBC, 0x7F, 0xF2, 0xCA,
+    0x1F, 0xDE, 0xF2, 0x89, 0xC3, 0xB9, 0x54, 0xBD, 0x2F, 0x39, 0x08, 0x02, 0xA2, 0x80, 0x24, 0xD2,
+    0x70, 0x2C, 0x17, 0x95, 0x15, 0x08, 0x75, 0x51, 0x52, 0x83, 0xA4, 0x8A, 0x41, 0x12, 0xD3, 0x85,
+    0xA3, 0x6B, 0x26, 0x54, 0x70, 0x25, 0x0A, 0x6E, 0x21, 0xC3, 0xC2, 0xD4, 0xB2, 0x99, 0x55, 0x05,
+    0xCF, 0x21, 0xD9, 0xBF, 0x63, 0x52, 0xB7, 0x98, 0xA8, 0x7A, 0xAB, 0x99, 0x4A, 0x06, 0x47, 0x56,
+    0xBA, 0x58, 0xE4, 0x60, 0x53, 0x09, 0xF7, 0xB3, 0xB6, 0x8A, 0x57, 0xBD, 0xE1, 0xD5, 0xA4, 0x47,
+    0xC9, 0x7E, 0x75, 0xF4, 0xED, 0xC4, 0x41, 0x65, 0xD9, 0xB3, 0xF7, 0x4F, 0x6E, 0xA4, 0x47, 0x6E,
+    0xE0, 0x3C, 0x73, 0x7C, 0x04, 0xC0, 0xDB, 0xAC, 0x15, 0x6A, 0xA3, 0x4C, 0x10, 0xFE, 0x0B, 0x8B,
+    0x3D, 0x77, 0xD8, 0x37, 0xB5, 0xF1, 0x8F, 0x96, 0xFA, 0xF5, 0x92, 0x5B, 0x2C, 0xC1, 0x32, 0x59,
+    0x06, 0xBB, 0x0A, 0xAF, 0x7E, 0xC5, 0xCB, 0x05, 0x7C, 0xC1, 0x84, 0xAF, 0x18, 0xF0, 0x6D, 0x12,
+    0xBE, 0x8F, 0xC2, 0xBB, 0x20, 0xDE, 0x64, 0x12, 0xA7, 0x8C, 0xE2, 0x2C, 0x49, 0xDC, 0x8D, 0x12,
+    0x6C, 0x12, 0x20, 0x65, 0x96, 0xFC, 0x3D, 0x5E, 0x78, 0x82, 0xF0, 0x76, 0x39, 0x3C, 0xDB, 0x26,
+    0xE1, 0x6B, 0x06, 0x7C, 0x85, 0xC7, 0xE7, 0xE9, 0xE0, 0x02, 0x5E, 0x26, 0x9A, 0x83, 0xFE, 0xF8,
+    0xC7, 0xDA, 0x21, 0x3D, 0xBC, 0x13, 0xA5, 0x9A, 0xDB, 0x4C, 0x12, 0x1B, 0x49, 0x6A, 0xB9, 0x4D,
+    0x50, 0xC9, 0x06, 0x92, 0xE1, 0x36, 0xAB, 0x2A, 0x36, 0x9C, 0x97, 0x73, 0xB7, 0x3F, 0x8C, 0x6A,
+    0x3F, 0xDC, 0x38, 0x9E, 0x84, 0xB9, 0x7D, 0x2F, 0xA9, 0xBB, 0xB5, 0x71, 0x25, 0x54, 0xD1, 0xDC,
+    0x5E, 0x18, 0xCC, 0x2F, 0x36, 0x9E, 0x5D, 0xEB, 0xC5, 0xDE, 0x5E, 0x8D, 0xA7, 0xDE, 0x78, 0x69,
+    0x6B, 0x83, 0xBD, 0xBD, 0xF6, 0xEF, 0xA4, 0x7A, 0x63, 0xC4, 0x78, 0x7B, 0x7B, 0x6D, 0x3F, 0x8C,
+    0xF5, 0xC6, 0xE8, 0x18, 0xED, 0xED, 0xB5, 0x26, 0xD4, 0x1B, 0xA3, 0x41, 0xF6, 0xF6, 0x5A, 0x32,
+    0xD7, 0x1B, 0x63, 0x17, 0x65, 0x6F, 0xAF, 0xC2, 0xD7, 0x1B, 0x8B, 0x64, 0xCF, 0xF0, 0xAA, 0x23,
+    0x49, 0xB2, 0x67, 0x2C, 0xAA, 0x23, 0x78, 0xD9, 0x33, 0x36, 0xD5, 0x11, 0x17, 0x64, 0xCF, 0x3E,
+    0x64, 0xAC, 0x23, 0x57, 0xA2, 0xEC, 0xD9, 0xE2, 0x42, 0x1D, 0xB9, 0xCC, 0x60, 0xCF, 0x96, 0x3E,
+    0xD6, 0x91, 0x81, 0xC9, 0x9E, 0xAD, 0x35, 0x75, 0x64, 0x34, 0xAB, 0x3D, 0x5B, 0xC5, 0x2F, 0x22,
+    0x63, 0x83, 0x3D, 0x5B, 0x65, 0x3E, 0x8A, 0x8C, 0x05, 0x9C, 0xAD, 0x6A, 0x89, 0x8C, 0xB2, 0x9C,
+    0xAD, 0x2A, 0x89, 0x8C, 0x6A, 0x39, 0x5B, 0x95, 0x67, 0xDD, 0x2E, 0x40, 0x47, 0xA9, 0x83, 0x55,
+    0x72, 0x80, 0x4A, 0x00, 0x5F, 0xF3, 0x6E, 0xCD, 0xDC, 0x32, 0x88, 0xD0, 0x6D, 0x92, 0x59, 0xB3,
+    0x5E, 0x6F, 0x56, 0xA9, 0x8B, 0x66, 0x91, 0xDA, 0x6D, 0xCF, 0xC3, 0x43, 0xF9, 0xC3, 0xF5, 0xAB,
+    0xD4, 0xC6, 0xFC, 0x54, 0x6E, 0xA1, 0x45, 0x72, 0x4B, 0xCD, 0x5C, 0x13, 0x2A, 0xC8, 0x86, 0x0F,
+    0x0C, 0xEA, 0x21, 0x4A, 0x25, 0x5C, 0x57, 0xB6, 0xE3, 0x0C, 0x0F, 0x54, 0x01, 0x83, 0x81, 0xAD,
+    0x02, 0x16, 0x73, 0xEF, 0x98, 0x53, 0xB2, 0x28, 0xE5, 0x94, 0xDC, 0x23, 0xA7, 0xA8, 0x8D, 0x26,
+    0x54, 0x9C, 0xF2, 0x33, 0x16, 0xB3, 0xAF, 0x0F, 0xDE, 0xC0, 0x54, 0x71, 0x92, 0x2D, 0x89, 0x8A,
+    0x5D, 0xCC, 0x7F, 0x4E, 0xE1, 0xAB, 0x48, 0x87, 0x20, 0xA9, 0xB0, 0xAB, 0x24, 0x75, 0x49, 0x92,
+    0x1A, 0x46, 0x49, 0x55, 0x76, 0x5B, 0xB0, 0x48, 0xD2, 0x0B, 0xAF, 0x1B, 0x1E, 0x0C, 0x32, 0xB0,
+    0xC8, 0x40, 0x92, 0x01, 0x46, 0x13, 0x9E, 0xC2, 0x9B, 0x50, 0x30, 0x99, 0xA0, 0x4F, 0x66, 0x05,
+    0xDE, 0x84, 0x86, 0xD1, 0x90, 0x75, 0xE9, 0x55, 0x06, 0x26, 0x19, 0x08, 0x32, 0xC1, 0x2C, 0x32,
+    0xA1, 0x8B, 0x32, 0xA1, 0x49, 0x32, 0xA1, 0x62, 0x30, 0xA1, 0xC4, 0x9B, 0x20, 0x66, 0x13, 0x64,
+    0x17, 0x13, 0x64, 0xA2, 0x09, 0x6A, 0xD3, 0x2E, 0xCF, 0xDF, 0x55, 0x0F, 0xB3, 0x81, 0xB5, 0x83,
+    0xD8, 0xA2, 0xEF, 0x9E, 0xDB, 0x86, 0x26, 0xE4, 0x05, 0xB4, 0x64, 0x95, 0x0C, 0xB3, 0xAA, 0xFC,
+    0x7A, 0x31, 0xBB, 0x85, 0x2A, 0x16, 0xA9, 0x43, 0x2A, 0xF0, 0x92, 0xF9, 0x60, 0x50, 0x1B, 0xBF,
+    0x3B, 0x34, 0xA9, 0x03, 0x9E, 0x05, 0xBE, 0x07, 0x8C, 0x4F, 0x91, 0x32, 0x33, 0x58, 0xE0, 0xDE,
+    0xB9, 0xBD, 0xF5, 0x13, 0x20, 0x5D, 0xFA, 0x6B, 0x7E, 0x78, 0x2D, 0xAF, 0x2E, 0x26, 0xEC, 0x7D,
+    0x56, 0x48, 0x7F, 0xA4, 0x2A, 0x33, 0xAB, 0xE4, 0x4A, 0x94, 0xDC, 0x2D, 0xA4, 0x7E, 0xC1, 0xAB,
+    0xD9, 0x4C, 0xF8, 0x7F, 0xAD, 0xAC, 0xB8, 0xB2, 0x29, 0xCB, 0x51, 0x17, 0xEC, 0x2A, 0xB7, 0xB6,
+    0x87, 0xB5, 0x70, 0xCB, 0x3A, 0x8C, 0x2C, 0x8B, 0xB2, 0xF2, 0xEA, 0xBC, 0x64, 0xDF, 0x4E, 0xCA,
+    0x3A, 0x81, 0x38, 0x45, 0xEA, 0xD6, 0x7E, 0x51, 0x85, 0xF0, 0x32, 0xA1, 0x8D, 0xAA, 0x93, 0xDC,
+    0x24, 0x7C, 0x95, 0xF2, 0xAA, 0x51, 0x30, 0x94, 0x0C, 0x7D, 0x50, 0xBB, 0x56, 0x48, 0x78, 0x3B,
+    0xA9, 0xDE, 0x9A, 0x28, 0x99, 0x19, 0xAF, 0x8A, 0x76, 0x91, 0xBA, 0xDF, 0x22, 0x89, 0xE3, 0x20,
+    0xB5, 0x1F, 0x6D, 0x92, 0x6C, 0x26, 0x42, 0x94, 0x64, 0x18, 0xA4, 0x82, 0x20, 0xA9, 0x4D, 0x92,
+    0xF3, 0xEA, 0x16, 0x95, 0xF4, 0x8B, 0x1A, 0x24, 0x7E, 0x91, 0x54, 0xE1, 0x65, 0x67, 0x46, 0xB1,
+    0xA8, 0x5F, 0x4C, 0x90, 0x4D, 0x6A, 0x62, 0x13, 0xD5, 0xE3, 0x2B, 0x0A, 0x86, 0x96, 0x20, 0x46,
+    0x33, 0x57, 0x69, 0x93, 0x9D, 0xDA, 0x58, 0x24, 0x3B, 0xF6, 0xA1, 0x44, 0xEE, 0x4A, 0x68, 0xA3,
+    0xEC, 0x64, 0x4E, 0x63, 0x95, 0xD4, 0xAE, 0x6D, 0xE0, 0x69, 0x86, 0x8A, 0x3A, 0xF6, 0xB3, 0xF3,
+    0x72, 0x6F, 0x6D, 0x75, 0x34, 0x41, 0xDD, 0x82, 0x68, 0x57, 0x55, 0x9B, 0xF1, 0xE6, 0xD7, 0x9B,
+    0xC4, 0x4F, 0xE6, 0xE6, 0x3E, 0x52, 0xFF, 0xD1, 0x22, 0x9C, 0x57, 0x4D, 0x94, 0x61, 0x96, 0x40,
+    0x0D, 0x8B, 0x64, 0x18, 0x0B, 0xA2, 0xD4, 0x30, 0xC9, 0x90, 0xC7, 0xDF, 0x32, 0x4A, 0x26, 0xAA,
+    0x64, 0x92, 0x59, 0x24, 0x26, 0x17, 0xD4, 0x22, 0x66, 0xD9, 0x50, 0xE0, 0x2B, 0xC6, 0x12, 0xDF,
+    0x47, 0x55, 0x0C, 0x4C, 0xAA, 0x69, 0x93, 0xD4, 0x24, 0x1B, 0xA4, 0x16, 0x06, 0xA9, 0xDB, 0xE9,
+    0xE1, 0x25, 0x99, 0x24, 0xA9, 0x60, 0x91, 0xD4, 0x12, 0x24, 0x41, 0x90, 0x6A, 0x98, 0x25, 0x73,
+    0x0F, 0xAF, 0x92, 0xB7, 0xF0, 0xEA, 0x62, 0xC5, 0x28, 0xE6, 0x1A, 0x35, 0xA8, 0x45, 0x76, 0x51,
+    0x9B, 0x2A, 0x46, 0xF5, 0xB1, 0x8F, 0x92, 0x89, 0x6E, 0x56, 0xC9, 0x4F, 0xA2, 0x8A, 0xBC, 0x96,
+    0xCE, 0x26, 0xC8, 0x86, 0x26, 0xC9, 0xAC, 0xC2, 0x77, 0x51, 0xFD, 0xDA, 0x6E, 0xAA, 0xA8, 0x91,
+    0xDC, 0xFF, 0x66, 0x50, 0xBB, 0xE1, 0x55, 0xC0, 0x24, 0x99, 0xDC, 0x65, 0x90, 0xC4, 0x7A, 0xD0,
+    0x95, 0xB2, 0xFC, 0xCA, 0x63, 0x0C, 0x07, 0x26, 0xFE, 0xDC, 0xCA, 0x1E, 0x08, 0xE7, 0x5E, 0xE7,
+    0x16, 0x88, 0x97, 0x8E, 0x8E, 0xB2, 0xE9, 0xB3, 0x1B, 0xE2, 0x15, 0x43, 0xB6, 0xAC, 0x0A, 0xFC,
+    0xC1, 0x2C, 0x9F, 0x95, 0x3D, 0x43, 0x59, 0x60, 0x8E, 0x59, 0x47, 0xFE, 0xF8, 0xBA, 0x9B, 0xA5,
+    0x9A, 0x21, 0xBB, 0x05, 0x56, 0x20, 0xAB, 0x2D, 0xAF, 0x64, 0x1B, 0xB1, 0xE7, 0x26, 0xBF, 0xE5,
+    0x75, 0x37, 0xF6, 0x73, 0xB3, 0x96, 0x49, 0x8F, 0x5C, 0xE0, 0xB7, 0x44, 0xC7, 0x85, 0xA3, 0xC1,
+    0x79, 0xD5, 0x9B, 0xF2, 0x94, 0x94, 0xDA, 0x25, 0xEB, 0x71, 0x51, 0x32, 0x93, 0x4A, 0xA4, 0x2E,
+    0x48, 0x8C, 0x6A, 0x72, 0x4D, 0x95, 0xF6, 0x9A, 0x41, 0x6D, 0x94, 0xAC, 0x57, 0x95, 0xA4, 0x3E,
+    0xA8, 0x60, 0x50, 0xBB, 0x4A, 0xCE, 0xAB, 0xDA, 0x24, 0xC9, 0xF0, 0x0A, 0x77, 0x58, 0x7F, 0xF6,
+    0x25, 0xC6, 0xB4, 0x17, 0xEE, 0xB0, 0x92, 0x0C, 0xFF, 0xF1, 0x68, 0x50, 0xB1, 0x48, 0xD9, 0x76,
+    0x33, 0x93, 0x54, 0xE2, 0x77, 0xCF, 0x92, 0x73, 0x52, 0xB5, 0x26, 0xA9, 0x7F, 0x2B, 0x4A, 0xA9,
+    0x5A, 0x55, 0x87, 0x26, 0xC8, 0xF8, 0x76, 0x2E, 0x36, 0xF5, 0xBE, 0x0D, 0x32, 0xA3, 0x1D, 0xE4,
+    0xAA, 0x28, 0xF1, 0xC4, 0x75, 0x15, 0xAF, 0x9B, 0xAC, 0x54, 0x7F, 0x70, 0x74, 0x74, 0xA4, 0x17,
+    0x5E, 0xAD, 0x18, 0x9B, 0x4D, 0xFD, 0x22, 0xEB, 0xF5, 0x73, 0x5D, 0xF8, 0x8E, 0x64, 0x89, 0x72,
+    0xE0, 0x5B, 0x88, 0xE5, 0xBD, 0x86, 0x21, 0x7B, 0x57, 0xBA, 0x55, 0xC5, 0xF3, 0xA9, 0x70, 0xF0,
+    0x22, 0x70, 0x87, 0xE4, 0xEE, 0x33, 0xD5, 0xC9, 0xCD, 0x05, 0x37, 0x16, 0xB9, 0xDF, 0x24, 0xD9,
+    0xFB, 0xFC, 0x83, 0x4B, 0x06, 0xF8, 0x3E, 0x74, 0xB3, 0x4D, 0xD5, 0xAA, 0xAB, 0xD9, 0x71, 0xD4,
+    0x6C, 0xBB, 0x8F, 0xE6, 0xB3, 0x0A, 0xC5, 0x0F, 0xE4, 0x6E, 0x11, 0x9A, 0x2D, 0x9B, 0xE1, 0x34,
+    0xBC, 0xCF, 0xEA, 0x96, 0x92, 0x9B, 0xA8, 0x8D, 0x6E, 0x16, 0x6F, 0x27, 0x35, 0x9B, 0x9B, 0xE4,
+    0xDE, 0xDE, 0xD4, 0x6C, 0x7B, 0x4D, 0xBB, 0xB9, 0x50, 0x70, 0x93, 0xD1, 0x44, 0x07, 0x3C, 0x07,
+    0x04, 0x77, 0x46, 0x6C, 0xD6, 0x3E, 0xED, 0xA2, 0xAD, 0xF8, 0x1B, 0xE9, 0x98, 0xB5, 0x84, 0xD8,
+    0xC0, 0xDA, 0x72, 0x12, 0xFA, 0xA8, 0x27, 0xCD, 0x92, 0x99, 0xCC, 0x86, 0xEC, 0x44, 0xB3, 0x73,
+    0x2E, 0x9B, 0x90, 0x2D, 0xB4, 0x7E, 0xD3, 0xBF, 0x68, 0xB9, 0x1B, 0x1B, 0x88, 0x25, 0x44, 0xF5,
+    0xCC, 0xBB, 0xD7, 0xE6, 0xD2, 0xB0, 0x7B, 0x2F, 0xEC, 0xFC, 0x19, 0x85, 0xEF, 0xD4, 0x49, 0x44,
+    0x3B, 0x1B, 0x3E, 0x4C, 0x2D, 0xF0, 0x0E, 0x0F, 0x5C, 0x32, 0xB1, 0xE0, 0x0E, 0x43, 0x93, 0x6C,
+    0x90, 0x7D, 0x0F, 0x55, 0xC9, 0xCE, 0x32, 0xEF, 0x25, 0x55, 0xC9, 0x06, 0x99, 0xF7, 0x50, 0x9D,
+    0xCC, 0x22, 0x77, 0x07, 0xDF, 0xA5, 0x8E, 0xBB, 0xCC, 0x64, 0x30, 0xC5, 0xCC, 0x0D, 0xDF, 0x4B,
+    0xD9, 0x81, 0x50, 0xFC, 0xAD, 0x54, 0x93, 0x54, 0x92, 0xBF, 0x4E, 0x68, 0x53, 0xC5, 0x33, 0x8C,
+    0x6D, 0x34, 0x41, 0xF6, 0x14, 0xD5, 0x9B, 0x05, 0x7E, 0x7D, 0x70, 0x1B, 0xFE, 0xFA, 0xE3, 0x89,
+    0x34, 0x48, 0x7D, 0x54, 0x21, 0xEE, 0x3F, 0xBF, 0xD4, 0x3B, 0x08, 0xB0, 0xA8, 0x67, 0xCB, 0x8B,
+    0x5E, 0x71, 0x34, 0xC8, 0xE2, 0x1B, 0x90, 0x61, 0x2D, 0xF8, 0x3F, 0xD7, 0x9B, 0x94, 0x9D, 0x49,
+    0x6E, 0x52, 0x07, 0xDF, 0xCB, 0x5E, 0xC0, 0xF5, 0x09, 0xDE, 0xBF, 0x5E, 0x32, 0xA8, 0xD9, 0xCE,
+    0xAF, 0x3E, 0xDA, 0xA9, 0x2E, 0x5E, 0x95, 0x5A, 0x6E, 0xA5, 0x0A, 0xEC, 0x0C, 0xA4, 0x8E, 0x1F,
+    0x73, 0x07, 0xDF, 0x26, 0xB3, 0xC8, 0xBD, 0x87, 0xEA, 0x4C, 0x88, 0x74, 0x20, 0x0D, 0x3B, 0x69,
+    0xEE, 0x30, 0x34, 0xC9, 0xC4, 0x82, 0x77, 0x78, 0x40, 0x6A, 0x81, 0xD9, 0xF0, 0x61, 0x92, 0x5B,
+    0xED, 0xAC, 0x6B, 0x75, 0x3A, 0xB8, 0xEF, 0xB6, 0xBF, 0x1C, 0x6A, 0xDE, 0x24, 0xEB, 0x07, 0x14,
+    0xC0, 0x58, 0xBA, 0x34, 0x3E, 0x2A, 0xE7, 0xAD, 0xCD, 0x46, 0x76, 0x54, 0xBE, 0xCC, 0x7D, 0x17,
+    0xDD, 0x5A, 0x70, 0x13, 0xB5, 0x9B, 0x0B, 0x07, 0xCE, 0x9B, 0x0F, 0x9C, 0x37, 0x7D, 0x71, 0xE1,
+    0x42, 0xBD, 0xB9, 0xDF, 0x24, 0x3B, 0x5D, 0x95, 0xE4, 0x7E, 0x93, 0x3E, 0x2F, 0xE9, 0x82, 0xEA,
+    0x4D, 0x6E, 0x6E, 0x92, 0xEC, 0xA4, 0xAB, 0x59, 0x35, 0x74, 0x53, 0xB3, 0x7D, 0xD9, 0xAC, 0xDB,
+    0xE0, 0x8C, 0x95, 0xD4, 0xA4, 0xE1, 0xD2, 0xA0, 0xCF, 0x71, 0x12, 0x7F, 0xAA, 0x8A, 0x77, 0x18,
+    0xDB, 0x54, 0x27, 0x31, 0x77, 0x6B, 0x8B, 0xEC, 0xEC, 0x42, 0xC1, 0xCB, 0xA8, 0xDE, 0x6C, 0x50,
+    0xF7, 0x11, 0x83, 0x2C, 0x49, 0x05, 0x6C, 0xAA, 0x21, 0xAA, 0x4B, 0x7D, 0x94, 0x9D, 0xCD, 0x5A,
+    0x30, 0xDA, 0xA5, 0x4E, 0x72, 0xA1, 0x5B, 0x45, 0xD8, 0xDB, 0x2A, 0x98, 0x2E, 0x3D, 0xB7, 0xB9,
+    0xB7, 0xBF, 0x38, 0x49, 0x5F, 0x1F, 0xF4, 0x37, 0xEA, 0xDF, 0x21, 0x55, 0x99, 0xF2, 0x77, 0xB2,
+    0x0B, 0x1D, 0x58, 0x1C, 0x37, 0x48, 0xC7, 0xF4, 0x49, 0xC4, 0x92, 0x9B, 0xA8, 0xDB, 0x64, 0x7E,
+    0xCB, 0x58, 0x1F, 0x04, 0x81, 0xAF, 0xE8, 0x17, 0x99, 0x20, 0x6E, 0x6E, 0x6A, 0xA3, 0xCC, 0x6F,
+    0x19, 0x2A, 0xD4, 0xC6, 0xAC, 0x9D, 0x7C, 0x99, 0x8B, 0x41, 0xFA, 0xC6, 0xD0, 0xAC, 0x86, 0xD1,
+    0x9D, 0x41, 0x03, 0xAC, 0x8E, 0x1F, 0x73, 0x93, 0xB1, 0x8B, 0x2E, 0x88, 0xB7, 0x51, 0xFB, 0xE5,
+    0xBE, 0xBC, 0x9B, 0xE4, 0x26, 0x15, 0xDF, 0x91, 0x0A, 0x18, 0xD5, 0xC3, 0x54, 0x66, 0x1F, 0xC1,
+    0x5F, 0xE3, 0x5D, 0xA8, 0xB8, 0xBC, 0xBB, 0xA7, 0xDA, 0x68, 0x83, 0xCC, 0x07, 0x8C, 0xBB, 0xA2,
+    0xD3, 0xC5, 0xAC, 0x7B, 0x99, 0xC0, 0x54, 0xF2, 0x22, 0xBE, 0xDD, 0x2A, 0xDE, 0x27, 0xD4, 0xBB,
+    0x7F, 0x2C, 0xA8, 0xE4, 0x20, 0xD2, 0xF4, 0xF5, 0xA1, 0x59, 0x0D, 0x83, 0x3B, 0x63, 0x6B, 0x80,
+    0xE0, 0xD2, 0x0D, 0x5E, 0x66, 0xE8, 0xA3, 0x0B, 0xE2, 0x66, 0xFA, 0x83, 0x41, 0xEF, 0x35, 0xBC,
+    0x8D, 0xBA, 0xE8, 0xD6, 0x8A, 0x9B, 0x99, 0xD2, 0xD0, 0x6C, 0xE0, 0xDD, 0x2F, 0x99, 0x9B, 0xAD,
+    0xB8, 0xFA, 0xB9, 0x73, 0x64, 0x2F, 0x1C, 0xA6, 0xF1, 0xE9, 0xC3, 0xD3, 0xF8, 0xF9, 0x47, 0x99,
+    0xC6, 0xF6, 0x11, 0xA6, 0xF1, 0x67, 0x4A, 0xD3, 0x8F, 0x0B, 0x5F, 0xEF, 0x27, 0xF7, 0xF6, 0xEA,
+    0x7E, 0x8F, 0x8B, 0x0E, 0x7A, 0xA6, 0xE7, 0x18, 0x4B, 0xBC, 0xDC, 0xAC, 0x7E, 0x51, 0xB3, 0xA9,
+    0x64, 0x90, 0x9B, 0x3E, 0xEB, 0x44, 0xFA, 0xE7, 0x3F, 0x50, 0x43, 0x7A, 0x3A, 0x6B, 0x22, 0x8B,
+    0x9D, 0x9B, 0x37, 0x19, 0x54, 0x33, 0xA8, 0x65, 0x52, 0xCF, 0xAA, 0x9E, 0x4D, 0x1D, 0x9B, 0x4A,
+    0xA2, 0xE4, 0x82, 0xE4, 0xFE, 0x97, 0x4A, 0xBE, 0xFD, 0x0F, 0xC7, 0xD1, 0xC2, 0x3B, 0x90, 0x4A,
+    0x98, 0x74, 0x21, 0x7B, 0xCE, 0xEB, 0x20, 0x39, 0xA9, 0xCD, 0x0B, 0xBD, 0x23, 0x1A, 0x38, 0x85,
+    0xF8, 0x2F, 0x39, 0x19, 0xCD, 0x0E, 0xD2, 0x7D, 0xEE, 0x61, 0x50, 0xCF, 0x7F, 0x29, 0x60, 0x6A,
+    0xD8, 0xD4, 0xE3, 0xB3, 0x6C, 0x57, 0xB3, 0xED, 0x4C, 0x7A, 0xF3, 0x4B, 0x15, 0x92, 0xFA, 0xE8,
+    0x96, 0x9A, 0x5F, 0xF0, 0xD1, 0x0E, 0x81, 0xC2, 0x9D, 0x58, 0xB2, 0x18, 0x7F, 0x10, 0x28, 0x72,
+    0x93, 0xBA, 0x68, 0x83, 0xCC, 0x62, 0x82, 0x4C, 0xE8, 0x17, 0xD9, 0xB9, 0x8D, 0xD9, 0x17, 0x8B,
+    0xAF, 0xB7, 0x82, 0xA1, 0x4A, 0x25, 0x2A, 0xA9, 0x92, 0x0A, 0x9E, 0xDD, 0x24, 0x5E, 0x8E, 0x92,
+    0x3B, 0x5B, 0x25, 0x73, 0x37, 0xEC, 0xFA, 0x60, 0xC7, 0x24, 0xB5, 0xF8, 0xDD, 0x3E, 0xAC, 0x39,
+    0x87, 0x11, 0xBA, 0x45, 0x2E, 0x88, 0xD3, 0x24, 0xB3, 0xC9, 0xCC, 0xF8, 0x96, 0xB1, 0x5B, 0xFA,
+    0x50, 0x13, 0x9A, 0x58, 0x6F, 0x65, 0x8A, 0x15, 0x62, 0x4C, 0x76, 0x60, 0x34, 0xC1, 0xBC, 0x32,
+    0xDB, 0xA9, 0xDE, 0xBA, 0x5B, 0xB1, 0x0F, 0xE2, 0xE5, 0xE0, 0xDA, 0x55, 0xE6, 0x4E, 0xEC, 0x6E,
+    0x6D, 0x6A, 0x62, 0xAA, 0xEE, 0xA3, 0x02, 0x33, 0x24, 0xE7, 0x65, 0xEE, 0xFA, 0xFE, 0xEE, 0xAC,
+    0x96, 0x50, 0xB3, 0xA8, 0x60, 0x15, 0x51, 0x32, 0x9B, 0x4C, 0x92, 0x5A, 0xD4, 0x32, 0xA8, 0xC4,
+    0x97, 0x3B, 0xC0, 0x27, 0xB3, 0xCA, 0x2C, 0x5D, 0x14, 0x73, 0x9B, 0x0A, 0x7C, 0xC5, 0x65, 0x86,
+    0x82, 0x9B, 0x49, 0xCA, 0xCE, 0xF6, 0x6C, 0x08, 0xCE, 0xFB, 0x5B, 0xB4, 0xE7, 0x9A, 0xAE, 0x23,
+    0x4A, 0x9C, 0x6D, 0xAA, 0xF8, 0x3E, 0x6A, 0x28, 0xF1, 0xED, 0x96, 0xDD, 0xCF, 0x36, 0xB8, 0x90,
+    0xFD, 0x85, 0x92, 0x9B, 0x33, 0x1D, 0xFB, 0x9D, 0x8E, 0x6B, 0xA6, 0xA3, 0x9B, 0x9A, 0x28, 0x7C,
+    0x9D, 0x0A, 0xC6, 0x8A, 0x4C, 0x47, 0x24, 0xBE, 0xBF, 0x49, 0xEE, 0x66, 0x94, 0x6C, 0xA6, 0xE3,
+    0x22, 0xF5, 0x04, 0xA9, 0x65, 0x96, 0x1A, 0xBC, 0x54, 0x67, 0x5B, 0x68, 0xD8, 0xD5, 0xE8, 0x3A,
+    0x1D, 0x14, 0x68, 0x1B, 0xF7, 0x91, 0x19, 0xE6, 0xDD, 0x4E, 0xEA, 0xD7, 0x03, 0x56, 0x91, 0x83,
+    0x23, 0x7A, 0x88, 0x2F, 0x9C, 0x30, 0x67, 0xC6, 0x5A, 0x54, 0x32, 0xAA, 0x3B, 0x38, 0x63, 0x25,
+    0x37, 0xAB, 0x7E, 0x98, 0xE3, 0xD8, 0x80, 0x0F, 0x81, 0xDB, 0xC0, 0xA0, 0xE2, 0xBF, 0xAA, 0x45,
+    0x06, 0x99, 0x24, 0x3B, 0xCB, 0xFA, 0x4F, 0x27, 0xFC, 0x5F, 0x30, 0x3A, 0xE4, 0xDE, 0x95, 0xDB,
+    0x64, 0x19, 0x0A, 0xBC, 0x9C, 0xFF, 0x8C, 0x3B, 0xED, 0x7D, 0x19, 0xD4, 0xB3, 0x23, 0xBA, 0xEE,
+    0x0B, 0xB6, 0x17, 0xFE, 0xFB, 0x20, 0xB7, 0xC8, 0x45, 0xB9, 0x4D, 0xF5, 0xA6, 0xEA, 0x53, 0x29,
+    0xA9, 0x42, 0x25, 0x7F, 0x2F, 0x97, 0xF4, 0x54, 0x92, 0x4D, 0x05, 0x5B, 0xC9, 0x50, 0xA5, 0x3F,
+    0xB8, 0x73, 0xD3, 0xF1, 0x26, 0x17, 0xE5, 0xD6, 0x5D, 0x38, 0x15, 0xD7, 0xA4, 0x86, 0x77, 0xF5,
+    0x33, 0x78, 0xFF, 0x01, 0x90, 0xDE, 0xA8, 0xE1, 0x6A, 0x46, 0x01, 0x25, 0xFD, 0x99, 0xFE, 0x99,
+    0xF4, 0x73, 0x7D, 0x57, 0x4D, 0xAA, 0x91, 0x0D, 0x26, 0x54, 0x54, 0x0C, 0x66, 0xE9, 0xD7, 0x8A,
+    0x67, 0xF0, 0xFD, 0xDA, 0x45, 0xD9, 0x60, 0x82, 0xDC, 0x6C, 0x83, 0x98, 0x6C, 0x10, 0x93, 0x9B,
+    0x85, 0x67, 0x2A, 0x18, 0xF1, 0xC5, 0xA2, 0x45, 0x85, 0xA4, 0x52, 0xC5, 0x20, 0x2B, 0xAB, 0x3A,
+    0x55, 0xE4, 0xF6, 0xDA, 0xAD, 0x49, 0x6A, 0x63, 0xBB, 0xA9, 0x8B, 0xED, 0xA6, 0x7E, 0xED, 0xA2,
+    0xDC, 0x6C, 0xC3, 0xA1, 0xB3, 0xE5, 0xBC, 0xB3, 0x82, 0x01, 0xAF, 0x37, 0xF4, 0x3F, 0x72, 0x00,
+    0x8D, 0x2E, 0x9E, 0x64, 0x14, 0xC6, 0xEF, 0x3C, 0xA6, 0xAC, 0x3D, 0x49, 0x75, 0x66, 0xBB, 0x9F,
+    0x7F, 0x0A, 0x8A, 0xFB, 0x8A, 0x61, 0x31, 0x92, 0x5E, 0x78, 0x55, 0xBB, 0xED, 0xB6, 0xFB, 0xD2,
+    0x9B, 0x4D, 0xCA, 0xA6, 0x51, 0xC6, 0xC3, 0xBE, 0xDA, 0xE3, 0xFF, 0xE6, 0xAB, 0xD2, 0xEE, 0xA3,
+    0xCC, 0x6B, 0x6C, 0xBD, 0x31, 0x48, 0x5D, 0x30, 0x93, 0x64, 0xC6, 0x26, 0x7C, 0xD5, 0xE9, 0x2F,
+    0x49, 0xCD, 0xDC, 0x8F, 0x87, 0x31, 0xE7, 0xBC, 0x0D, 0xBD, 0x97, 0x8A, 0x87, 0xC2, 0x8E, 0xBE,
+    0xC2, 0xE3, 0xFF, 0xFF, 0x86, 0xAC, 0x75, 0xD7, 0x25, 0xF5, 0xA3, 0x76, 0x09, 0x5B, 0x45, 0x49,
+    0x65, 0x94, 0x8A, 0xBB, 0xF1, 0xE0, 0x86, 0xE1, 0xBA, 0xBE, 0xF9, 0x9A, 0x0A, 0x26, 0xD5, 0xEC,
+    0x70, 0xF0, 0x9C, 0x23, 0x81, 0x72, 0x20, 0xDA, 0x63, 0x80, 0xC6, 0x54, 0x9C, 0x8C, 0xB2, 0x8B,
+    0xDA, 0xA8, 0x8A, 0x1C, 0xFC, 0x33, 0xE9, 0x71, 0xF6, 0xF7, 0xC2, 0x75, 0x75, 0xA8, 0x22, 0x8A,
+    0xE3, 0x60, 0x26, 0xF7, 0xF2, 0x5C, 0x6C, 0x8F, 0xB3, 0x3F, 0xA9, 0x88, 0xD5, 0x62, 0x66, 0x77,
+    0x9A, 0x9A, 0xD8, 0x79, 0x3B, 0x3C, 0xA9, 0xC7, 0x49, 0xCF, 0x17, 0x5E, 0x95, 0x59, 0x0F, 0x7A,
+    0xA1, 0xF5, 0x6A, 0xE6, 0xDC, 0x57, 0x4F, 0x32, 0x60, 0xE0, 0x29, 0x56, 0xE1, 0xBF, 0x54, 0x6A,
+    0x58, 0xF3, 0xB3, 0x06, 0xF4, 0xC4, 0xEB, 0x32, 0xAB, 0xDC, 0x5C, 0x30, 0xD4, 0x51, 0xED, 0x7C,
+    0x98, 0x6A, 0xAC, 0x10, 0x21, 0x1E, 0x33, 0x57, 0xE8, 0x4B, 0xA5, 0x9E, 0x39, 0x3F, 0x0B, 0x51,
+    0xDF, 0x7C, 0x55, 0x15, 0xB3, 0x7A, 0xA6, 0x12, 0x3B, 0x75, 0xB3, 0x99, 0x36, 0xF5, 0xFE, 0x30,
+    0xF7, 0x61, 0x34, 0x20, 0x88, 0x85, 0x63, 0x94, 0x09, 0x12, 0x5E, 0xD5, 0xCE, 0xAD, 0x5F, 0xE6,
+    0xB4, 0xCC, 0xAE, 0x7D, 0x41, 0xAC, 0x32, 0x32, 0xD0, 0x4C, 0xFD, 0xF7, 0x63, 0x7B, 0x8F, 0x6A,
+    0x33, 0x23, 0x1F, 0xCB, 0x92, 0x9E, 0xD4, 0xC2, 0x29, 0x84, 0x63, 0xE6, 0xEC, 0x23, 0x3E, 0xE7,
+    0xD6, 0x47, 0x3A, 0x69, 0x58, 0xF7, 0x06, 0xE0, 0x20, 0xC4, 0x18, 0xFF, 0x83, 0x64, 0xB8, 0xE1,
+    0xD5, 0xC0, 0x2A, 0xC5, 0x1E, 0xA9, 0x1D, 0xFE, 0xF2, 0x13, 0x01, 0x2B, 0x5F, 0x09, 0x38, 0xAB,
+    0x38, 0x19, 0xA4, 0x43, 0x64, 0xA7, 0x09, 0x3A, 0x68, 0x6E, 0x2A, 0x33, 0xCA, 0x63, 0x3F, 0x19,
+    0x63, 0xF3, 0xD5, 0x04, 0xBE, 0x24, 0x7D, 0xE3, 0x75, 0x49, 0xB2, 0xCB, 0xB9, 0x17, 0x37, 0x3B,
+    0x74, 0xDB, 0x8C, 0x06, 0x4D, 0xFA, 0x93, 0x78, 0x8B, 0x6F, 0xBC, 0x26, 0x49, 0x66, 0xCB, 0xD2,
+    0x63, 0x90, 0xCA, 0x64, 0xBD, 0xD4, 0xAC, 0x5D, 0x90, 0xBA, 0xA9, 0x5C, 0xFF, 0x34, 0xBE, 0x45,
+    0x8E, 0x4D, 0x6D, 0x27, 0xA9, 0x89, 0x5D, 0x38, 0xE4, 0xF5, 0xD2, 0xCE, 0x92, 0x86, 0xE2, 0x4F,
+    0xE2, 0x5B, 0xBC, 0xF0, 0xEA, 0x21, 0xAA, 0x22, 0xAB, 0xB2, 0xF5, 0x26, 0xE5, 0x18, 0x28, 0x7D,
+    0xF2, 0x33, 0x7C, 0x15, 0x50, 0x2F, 0xA9, 0x3C, 0x19, 0x76, 0x9C, 0xA1, 0x64, 0x94, 0x8A, 0x1C,
+    0x09, 0x32, 0xFC, 0x81, 0xD6, 0xFD, 0xD5, 0x18, 0xED, 0xC9, 0x78, 0x00, 0x64, 0x1C, 0xA3, 0x64,
+    0x6F, 0x2F, 0x92, 0xF5, 0x0C, 0x9F, 0x56, 0x52, 0xBF, 0x1A, 0xA3, 0x3D, 0xD7, 0x4A, 0xEB, 0xD8,
+    0x2E, 0x2A, 0xA8, 0x36, 0xC9, 0x78, 0xF7, 0x07, 0x2A, 0xE9, 0x57, 0x62, 0xB4, 0x27, 0xD7, 0x33,
+    0xCA, 0x95, 0xA1, 0xA6, 0x98, 0x43, 0x9D, 0x55, 0xEF, 0x54, 0xBD, 0xF4, 0x03, 0x15, 0x10, 0xCA,
+    0x1D, 0xCB, 0x0E, 0xCD, 0xDF, 0xF7, 0xDB, 0x1E, 0x67, 0x6A, 0x67, 0x5D, 0x38, 0x5E, 0x2F, 0x42,
+    0x6A, 0x80, 0x57, 0x78, 0xC0, 0x7B, 0x0C, 0xDD, 0x03, 0xC6, 0x3A, 0xB9, 0xA9, 0xE4, 0xC6, 0x5A,
+    0xF0, 0x1E, 0x3F, 0x62, 0xCD, 0xCE, 0xB2, 0x68, 0xBF, 0xC7, 0xDA, 0xCE, 0xC5, 0x20, 0x49, 0x4F,
+    0xFC, 0x34, 0x4F, 0x95, 0x9A, 0x1C, 0xC0, 0x5A, 0x6D, 0x59, 0xF5, 0x7C, 0x7C, 0x5D, 0x5E, 0xFC,
+    0xA9, 0x54, 0x33, 0xA9, 0x22, 0xAA, 0x4A, 0xCE, 0x57, 0x5B, 0x1D, 0x8B, 0xA8, 0x3D, 0x20, 0xF4,
+    0xF1, 0xBC, 0xA5, 0x24, 0xAB, 0x4D, 0x66, 0x76, 0xBE, 0x5D, 0xFB, 0x50, 0x6C, 0xF5, 0xA2, 0xAF,
+    0x1D, 0x62, 0x2F, 0x1F, 0x4B, 0x97, 0x7F, 0x4C, 0xC4, 0xA7, 0x5C, 0xF2, 0xFF, 0x02, 0x35, 0xCA,
+    0xA1, 0x9E, 0x66, 0x54, 0xCF, 0x28, 0x43, 0x36, 0x18, 0x4E, 0xAE, 0xEF, 0xD7, 0xBA, 0x73, 0x48,
+    0xDF, 0x8D, 0x52, 0x71, 0xF8, 0x8C, 0xDF, 0xB8, 0x2A, 0x59, 0x66, 0xF5, 0xE0, 0x1B, 0x40, 0xCC,
+    0x66, 0xE9, 0x57, 0x71, 0x8A, 0xEA, 0x68, 0x82, 0xEC, 0x43, 0x70, 0x0D, 0x6C, 0xF6, 0x3C, 0x62,
+    0x64, 0xC9, 0x10, 0xDF, 0x93, 0x2D, 0x3F, 0x74, 0x83, 0x85, 0xA5, 0x80, 0x1C, 0x74, 0xBD, 0xB3,
+    0xEC, 0x13, 0x3F, 0xDD, 0x41, 0x40, 0x1B, 0xF2, 0x82, 0x5D, 0x6D, 0x92, 0x9C, 0x1E, 0x7B, 0xCF,
+    0x17, 0x7F, 0xBA, 0x5B, 0x46, 0x06, 0xAF, 0xF6, 0x01, 0xAA, 0xB6, 0x3A, 0xCA, 0xAA, 0x9D, 0x1E,
+    0xFB, 0x3B, 0x4B, 0xEA, 0xBC, 0x19, 0xAA, 0xD4, 0x44, 0x99, 0xD9, 0xF9, 0x62, 0xAB, 0x17, 0x15,
+    0xFA, 0xDA, 0xE3, 0x7E, 0xE7, 0x6F, 0xBE, 0x26, 0x1B, 0x64, 0x83, 0x4C, 0x50, 0x3F, 0xAB, 0xF3,
+    0xBB, 0x2F, 0x6E, 0x6C, 0x92, 0xFA, 0x55, 0x6E, 0x7E, 0xC4, 0xA2, 0x4E, 0xAE, 0xF7, 0xB1, 0x46,
+    0x8C, 0x66, 0x3A, 0x88, 0x6C, 0x37, 0x37, 0xE9, 0x91, 0xB3, 0x6C, 0xA8, 0x0D, 0x15, 0x51, 0xDC,
+    0x08, 0x66, 0xB2, 0xBF, 0x08, 0xDA, 0xCE, 0x0D, 0xFB, 0x59, 0x4D, 0xFA, 0xA7, 0x1F, 0x24, 0xAB,
+    0x8D, 0x17, 0xE1, 0x45, 0xEC, 0xD3, 0xDB, 0xF9, 0x1C, 0x2D, 0x19, 0xFF, 0x09, 0x29, 0x8B, 0xFF,
+    0xB5, 0x9A, 0x4B, 0xD2, 0x26, 0x03, 0xBE, 0xF9, 0x3B, 0x16, 0xBD, 0x51, 0xBC, 0x71, 0xD0, 0x5F,
+    0x5E, 0x93, 0x7B, 0x89, 0xB5, 0x89, 0x5F, 0x80, 0xBB, 0x4D, 0x5F, 0x02, 0x7D, 0xC9, 0xEA, 0x07,
+    0xF3, 0x01, 0xAF, 0x70, 0xD3, 0x41, 0xF9, 0xE8, 0x0F, 0x5E, 0xA8, 0x7F, 0x33, 0x64, 0x16, 0x69,
+    0xF6, 0x98, 0xCD, 0xA5, 0xE2, 0x57, 0x84, 0x3E, 0x8A, 0x09, 0x5F, 0x70, 0xCA, 0x01, 0x8B, 0xB1,
+    0xF3, 0x01, 0x9E, 0x41, 0x55, 0x46, 0x6C, 0xCC, 0x22, 0x37, 0xBB, 0x50, 0x31, 0xF0, 0xC0, 0xC5,
+    0x02, 0xF0, 0x05, 0xC4, 0x7D, 0x39, 0xBE, 0xF0, 0xB1, 0x37, 0xCF, 0x2C, 0x07, 0xD0, 0x35, 0x48,
+    0x65, 0x92, 0xCE, 0xE7, 0xC6, 0x63, 0x1F, 0x40, 0x79, 0xB2, 0xC7, 0x90, 0x94, 0x24, 0xA9, 0xFF,
+    0x70, 0xCB, 0x2B, 0x6F, 0x3B, 0x9F, 0xAF, 0x2C, 0x8F, 0x9B, 0x02, 0x92, 0xCA, 0xA5, 0x99, 0xD5,
+    0x05, 0xE3, 0xB3, 0x7A, 0x92, 0xAA, 0x28, 0x7D, 0x6C, 0x10, 0x3D, 0xE6, 0x01, 0x9C, 0x5C, 0xDF,
+    0x35, 0xD0, 0x2E, 0xEE, 0xD0, 0x91, 0x18, 0x1E, 0x5A, 0x59, 0x33, 0x5F, 0x7C, 0x49, 0x9C, 0x65,
+    0x53, 0x1B, 0xDD, 0x5C, 0x72, 0x93, 0xC1, 0x46, 0x8B, 0xE3, 0x14, 0x88, 0x2D, 0xC9, 0xF8, 0x9E,
+    0xCB, 0x71, 0x07, 0x71, 0xCE, 0x45, 0xB2, 0xDB, 0xFF, 0x8B, 0xA8, 0xB6, 0x4F, 0xA9, 0x92, 0x8F,
+    0xA9, 0xE7, 0x2C, 0x92, 0x43, 0x0E, 0xAF, 0x6A, 0x7F, 0x9F, 0x54, 0x6D, 0xCD, 0xAA, 0x9F, 0x3F,
+    0x6C, 0xC1, 0x3D, 0xAE, 0x77, 0x96, 0xD4, 0x79, 0xAB, 0x6A, 0x6B, 0x57, 0x99, 0x89, 0xB1, 0x8C,
+    0x9F, 0x10, 0xC9, 0x8F, 0xB7, 0xE7, 0xEC, 0x89, 0x80, 0xFC, 0xFB, 0xDB, 0x21, 0x18, 0x1B, 0xB6,
+    0x32, 0xA3, 0xC9, 0x93, 0xDD, 0x64, 0xEF, 0x1F, 0x5D, 0x6B, 0xC9, 0x4A, 0x05, 0x93, 0xFA, 0x45,
+    0xEA, 0xA3, 0x4A, 0x06, 0x55, 0x8C, 0xF9, 0x8F, 0x99, 0x45, 0x25, 0x3F, 0x3C, 0xBA, 0x9C, 0xC3,
+    0x96, 0xA2, 0x09, 0x2A, 0x81, 0xD3, 0x87, 0x4F, 0xDF, 0x3F, 0x79, 0x89, 0xE1, 0xE3, 0x9B, 0x07,
+    0x95, 0x78, 0xF5, 0x8B, 0xD4, 0xC5, 0xBD, 0xE5, 0xA0, 0x7E, 0x91, 0x6A, 0xA6, 0xF3, 0xF8, 0x24,
+    0xD8, 0xB4, 0x0F, 0xA3, 0xDC, 0x4F, 0x2F, 0xE6, 0xD3, 0xC3, 0xEF, 0x3F, 0xC5, 0xDF, 0x9E, 0x43,
+    0xC5, 0x8E, 0x49, 0x3D, 0xDC, 0x86, 0x79, 0x1F, 0xFB, 0xDC, 0xF1, 0x63, 0x78, 0x9A, 0x89, 0xB9,
+    0x22, 0x28, 0x87, 0xE8, 0x0F, 0x25, 0x5D, 0x54, 0xBB, 0xA9, 0x89, 0x76, 0x96, 0x01, 0x3E, 0x60,
+    0x14, 0x90, 0x51, 0x64, 0xA0, 0x5B, 0x77, 0x0C, 0x29, 0x1C, 0x22, 0x0C, 0x4B, 0x66, 0xA9, 0xC4,
+    0x77, 0x4C, 0xFA, 0xB3, 0x8A, 0x8F, 0xE0, 0xDE, 0xF3, 0xA1, 0xCE, 0x9D, 0xF8, 0x1A, 0x3E, 0xC8,
+    0xD6, 0xE3, 0x26, 0xC7, 0xBB, 0xD2, 0x25, 0xE9, 0xC2, 0x55, 0x39, 0xF8, 0x3D, 0xF0, 0x36, 0x70,
+    0x0C, 0x9B, 0xCB, 0x77, 0xC7, 0xCF, 0x3B, 0x96, 0x6B, 0x37, 0xBB, 0xCB, 0xB1, 0x0B, 0xBC, 0x94,
+    0xBA, 0xE5, 0xD2, 0xD0, 0xAE, 0xE6, 0x1D, 0x9E, 0x8B, 0x66, 0xA6, 0x8A, 0xDD, 0x74, 0x49, 0xE5,
+    0x5A, 0x2F, 0xDD, 0xDC, 0x7B, 0x37, 0x50, 0xC5, 0x66, 0xED, 0x82, 0x99, 0x18, 0xB9, 0x9C, 0x9A,
+    0xD8, 0x2D, 0x26, 0x5C, 0x1A, 0x8E, 0x86, 0x76, 0xED, 0x16, 0x33, 0xBB, 0x37, 0xB9, 0x4C, 0x13,
+    0xDB, 0xD5, 0xCC, 0xC6, 0x53, 0x50, 0xC5, 0x66, 0xE9, 0x26, 0xE3, 0x2F, 0x9D, 0xFF, 0x2F, 0x55,
+    0x24, 0xF5, 0x53, 0xBD, 0x9A, 0xA5, 0x41, 0xDC, 0x62, 0x74, 0xA1, 0x4D, 0xF9, 0xE4, 0x97, 0xC8,
+    0x4C, 0x4D, 0x2C, 0x06, 0x5D, 0xD5, 0x05, 0xFD, 0x23, 0xCD, 0x99, 0x3F, 0x90, 0xDF, 0xC6, 0x75,
+    0xC7, 0xBF, 0x00, 0x42, 0xEE, 0x4C, 0x50, 0x6C, 0xE5, 0x22, 0x71, 0x81, 0x3A, 0x4D, 0x50, 0xA7,
+    0xC9, 0x42, 0xE6, 0x4C, 0x54, 0xA4, 0x10, 0x0B, 0x9E, 0x3C, 0x63, 0x15, 0xAA, 0x32, 0x93, 0xD8,
+    0x05, 0xAB, 0xB4, 0x59, 0xC4, 0x2A, 0x54, 0x46, 0x85, 0x9D, 0x56, 0x69, 0x3C, 0x63, 0x9F, 0x0A,
+    0x36, 0x29, 0xD2, 0xED, 0x3A, 0x2A, 0x58, 0xA8, 0x38, 0xD8, 0x1C, 0x46, 0x85, 0x8A, 0x43, 0x6C,
+    0x3A, 0xCA, 0x90, 0xC5, 0xAD, 0x44, 0x30, 0x07, 0xF2, 0x16, 0xFB, 0x49, 0x81, 0xDF, 0x1D, 0x49,
+    0x8B, 0xB2, 0xE5, 0x71, 0x94, 0x04, 0x33, 0xBF, 0xB7, 0xEF, 0xBD, 0xFD, 0x83, 0xDD, 0xC5, 0xEE,
+    0x7B, 0xDF, 0xF7, 0x7E, 0x92, 0x64, 0xA3, 0x13, 0xEF, 0x94, 0xA6, 0xD8, 0xB5, 0x5D, 0xFB, 0xF9,
+    0x0F, 0x87, 0x3F, 0xD1, 0xE1, 0x71, 0xB0, 0x02, 0x8F, 0x81, 0x13, 0xC0, 0x3D, 0x39, 0xBA, 0x45,
+    0x54, 0x83, 0x64, 0xB3, 0xE4, 0x92, 0xC4, 0xFD, 0xA3, 0x1B, 0xC0, 0x1B, 0xB0, 0x39, 0x58, 0x78,
+    0x78, 0xFC, 0xCE, 0x8B, 0xB5, 0x2F, 0x34, 0x86, 0xFC, 0xC2, 0x50, 0x52, 0x58, 0x25, 0x89, 0x2C,
+    0xA9, 0x62, 0x93, 0xD4, 0x80, 0xA4, 0xA6, 0x20, 0xA9, 0xCD, 0x8C, 0x92, 0xCD, 0x44, 0xC9, 0xAE,
+    0x21, 0x4A, 0xFD, 0xE2, 0x66, 0xC9, 0x25, 0x97, 0x24, 0x3F, 0xF7, 0x8B, 0x14, 0xA6, 0x6E, 0x95,
+    0x88, 0x36, 0xAB, 0x62, 0x6C, 0x37, 0xD5, 0x40, 0x51, 0x03, 0x20, 0x03, 0x30, 0xB4, 0x00, 0xD1,
+    0x96, 0xA3, 0x37, 0x89, 0x5D, 0x96, 0x98, 0xDC, 0x2A, 0x85, 0xE4, 0x16, 0xC9, 0x27, 0x9F, 0x24,
+    0xB7, 0x32, 0x4B, 0x7D, 0x06, 0x36, 0x0B, 0x4C, 0xCF, 0x99, 0xFB, 0x47, 0xB7, 0x6C, 0x96, 0x44,
+    0xDC, 0x57, 0xB0, 0x33, 0xE5, 0xF8, 0x3D, 0x01, 0xB3, 0x05, 0x22, 0x80, 0xDD, 0xBE, 0xC3, 0x42,
+    0x6C, 0x38, 0xC9, 0xEA, 0x32, 0x51, 0x97, 0x4C, 0xCD, 0x49, 0xAE, 0x58, 0x01, 0x2E, 0x47, 0x4E,
+    0x16, 0x1E, 0xC8, 0xF1, 0xEC, 0xA6, 0x80, 0xA5, 0x01, 0x56, 0x0B, 0x2C, 0x2E, 0x5D, 0x27, 0x11,
+    0x6B, 0x3E, 0x44, 0x06, 0x9B, 0xD5, 0x65, 0x97, 0xC4, 0xCC, 0xFD, 0xB7, 0x69, 0x0E, 0xAF, 0x2B,
+    0x72, 0xC0, 0xC0, 0xC3, 0x3B, 0xDC, 0x40, 0x2D, 0x36, 0xCB, 0x6E, 0x2E, 0xC9, 0xAD, 0x44, 0xF1,
+    0x4B, 0xD4, 0xF0, 0x46, 0x96, 0xCF, 0x0E, 0x98, 0x81, 0xAB, 0x8E, 0xFF, 0x29, 0xE0, 0x02, 0x38,
+    0x03, 0x02, 0x14, 0xEE, 0x1F, 0x7D, 0xFB, 0x4B, 0xBE, 0xD2, 0xEF, 0x2A, 0xAA, 0x05, 0x16, 0x09,
+    0x60, 0x90, 0x7D, 0x49, 0xD8, 0x8E, 0xFC, 0x22, 0x31, 0xD6, 0x0C, 0xB2, 0xAB, 0xFA, 0x2F, 0x08,
+    0x43, 0xCD, 0x20, 0xBB, 0xA8, 0x5F, 0x54, 0xED, 0x42, 0x97, 0xD4, 0x2F, 0xAA, 0x51, 0xCD, 0xA0,
+    0x3E, 0xA9, 0x5F, 0xD4, 0xEC, 0x82, 0x9B, 0xD5, 0x2F, 0x6A, 0x37, 0xD5, 0x0C, 0x22, 0xAA, 0x5F,
+    0xE4, 0x56, 0x35, 0x0C, 0x01, 0x80, 0x47, 0x00, 0x94, 0x97, 0x85, 0x28, 0xC9, 0x3F, 0xCA, 0x92,
+    0xCC, 0xAB, 0x84, 0xF9, 0xEB, 0x3B, 0xDE, 0xFD, 0xA2, 0x36, 0xCB, 0x94, 0x06, 0x35, 0xA8, 0x61,
+    0xF0, 0x49, 0xC4, 0x9A, 0xD1, 0x6E, 0x72, 0x49, 0xC4, 0xFD, 0xDC, 0x32, 0xA9, 0x5B, 0x1B, 0x14,
+    0x66, 0x35, 0x0C, 0x44, 0x97, 0xF6, 0x23, 0xEE, 0x16, 0xA9, 0x2D, 0x36, 0x77, 0xAB, 0x24, 0x3E,
+    0xE5, 0xFD, 0x2C, 0xC9, 0xC2, 0xE5, 0x3D, 0x01, 0x49, 0x15, 0xC0, 0x2C, 0x89, 0x0B, 0xC8, 0x92,
+    0x42, 0xE2, 0x43, 0xA2, 0xE4, 0x17, 0x97, 0xDC, 0x2A, 0xB9, 0xD5, 0xE6, 0x16, 0xA9, 0xCF, 0x0D,
+    0x22, 0xC9, 0x6E, 0x22, 0x76, 0x9B, 0x2C, 0x72, 0xA9, 0x26, 0x1A, 0x64, 0xB3, 0xDC, 0xDA, 0x30,
+    0x36, 0xC8, 0x70, 0x83, 0x28, 0xA2, 0xC2, 0x67, 0x4C, 0x72, 0x49, 0xB6, 0x48, 0x52, 0x15, 0x78,
+    0xCF, 0x00, 0x15, 0x90, 0x1C, 0xD0, 0x4E, 0x86, 0x28, 0xB9, 0x45, 0x6A, 0x37, 0xA9, 0x46, 0xAA,
+    0x88, 0xD7, 0xDE, 0x24, 0xB6, 0x10, 0x6B, 0x18, 0x14, 0xD8, 0xF4, 0xC7, 0x81, 0x59, 0xEA, 0x37,
+    0xA9, 0x26, 0xEE, 0xDB, 0x65, 0xB3, 0xD4, 0xF2, 0xB7, 0x6A, 0x79, 0x1F, 0xB8, 0x0B, 0xFC, 0x0C,
+    0x98, 0x3A, 0x18, 0x54, 0xDD, 0x94, 0x88, 0xB2, 0xB8, 0xA4, 0x96, 0x93, 0xAC, 0x86, 0xC7, 0xA8,
+    0x26, 0x13, 0x05, 0x2E, 0x29, 0x70, 0x92, 0xE5, 0x78, 0x8C, 0xDC, 0xA3, 0x4C, 0xEC, 0x3E, 0xC7,
+    0x25, 0xBB, 0x86, 0x93, 0x6C, 0xB2, 0x7B, 0x4C, 0x53, 0x6C, 0xE6, 0xA7, 0x34, 0xB8, 0xC4, 0xC8,
+    0x49, 0xF6, 0xD1, 0x3D, 0xC6, 0xCD, 0x36, 0x73, 0x9A, 0x1A, 0x1C, 0xAB, 0x38, 0x21, 0xCB, 0x3D,
+    0xA6, 0xC8, 0x66, 0x50, 0x83, 0x63, 0x14, 0x27, 0x44, 0xB9, 0xC7, 0xCC, 0xFB, 0x05, 0x97, 0xE4,
+    0x63, 0x3F, 0xCB, 0x2E, 0x76, 0x51, 0xCD, 0x59, 0x96, 0x1C, 0x9B, 0x54, 0xB3, 0xEA, 0x85, 0xE7,
+    0xFF, 0x76, 0x9E, 0x44, 0x75, 0x2B, 0x51, 0x2E, 0x11, 0xC5, 0x4C, 0xAC, 0x88, 0xC4, 0x06, 0x11,
+    0xF7, 0x0F, 0x9C, 0x45, 0x74, 0x49, 0x44, 0x26, 0xF1, 0x6F, 0x44, 0x01, 0x12, 0x14, 0x1D, 0xB8,
+    0x47, 0x44, 0x11, 0x99, 0x45, 0xF4, 0x49, 0x44, 0x97, 0x45, 0xB4, 0x45, 0xC4, 0x96, 0x81, 0xD8,
+    0x10, 0x0F, 0x23, 0x2B, 0x2C, 0x44, 0xB9, 0x4C, 0x94, 0x2D, 0xEA, 0x80, 0x79, 0xB7, 0xB1, 0xFD,
+    0x73, 0xD6, 0x3D, 0x39, 0x0A, 0x73, 0x83, 0xDA, 0x22, 0x97, 0x74, 0xC5, 0xCE, 0x0A, 0x73, 0x53,
+    0x5E, 0xC5, 0x9A, 0x4D, 0x6D, 0x91, 0x9F, 0xAE, 0xD8, 0x10, 0x15, 0xE6, 0x36, 0xAB, 0x2D, 0x22,
+    0x2A, 0xCC, 0xFD, 0xAA, 0xB6, 0xC0, 0xA0, 0x70, 0x46, 0x52, 0x5B, 0xD8, 0xA4, 0x70, 0xC6, 0xA0,
+    0xB6, 0x5C, 0xD3, 0xA5, 0xCF, 0x30, 0x9C, 0x32, 0x49, 0x6C, 0x14, 0xC9, 0x72, 0x4A, 0x52, 0xCD,
+    0x06, 0x92, 0xE3, 0x94, 0x55, 0x0D, 0x1B, 0x21, 0x2A, 0x84, 0xD3, 0xF3, 0x2C, 0x7B, 0xBE, 0x71,
+    0x7B, 0x12, 0xEE, 0xF4, 0x49, 0x51, 0x77, 0x6F, 0xE3, 0x8D, 0xD4, 0x64, 0x77, 0xBA, 0x30, 0xB8,
+    0xBB, 0x1B, 0xAF, 0xAF, 0x66, 0xF1, 0xA7, 0xAB, 0x8B, 0x98, 0x8D, 0x77, 0x36, 0x9B, 0xFC, 0xE9,
+    0xDA, 0xFF, 0x7B, 0x31, 0x1B, 0x23, 0x2E, 0xFA, 0xD3, 0xD5, 0x9E, 0x67, 0xB3, 0x31, 0x06, 0x46,
+    0x7F, 0xBA, 0x1A, 0x92, 0xD9, 0x18, 0x1D, 0xF2, 0xA7, 0x6B, 0xCD, 0x6C, 0x36, 0xC6, 0x2E, 0xCB,
+    0x9F, 0xAE, 0x22, 0x9A, 0x8D, 0x28, 0x53, 0xBE, 0x32, 0xB9, 0x7F, 0xF4, 0x56, 0x01, 0x78, 0x91,
+    0x3C, 0x3C, 0xBE, 0x53, 0x7E, 0xB7, 0x51, 0xA2, 0x4C, 0x39, 0x1C, 0xCD, 0x2A, 0x30, 0x48, 0x1D,
+    0x2C, 0x52, 0x80, 0xA2, 0x1A, 0x60, 0x34, 0x3C, 0x68, 0x99, 0x2C, 0x12, 0xA9, 0xDB, 0x24, 0xBF,
+    0xF4, 0x59, 0x72, 0xAB, 0x5B, 0xA4, 0x3E, 0xBB, 0xA4, 0xDD, 0xDF, 0xC8, 0x66, 0xFF, 0x02, 0x75,
+    0x57, 0xB4, 0xCB, 0x7B, 0xCB, 0xBD, 0x57, 0x97, 0x25, 0xBF, 0xEC, 0xA3, 0x19, 0x26, 0xC3, 0xD4,
+    0x00, 0x8C, 0xDA, 0x0D, 0x53, 0x0F, 0xAB, 0x54, 0xC3, 0x28, 0xA9, 0x1A, 0x76, 0x77, 0xB0, 0xFD,
+    0x3A, 0xB9, 0x7F, 0xF4, 0xF6, 0x46, 0x54, 0xFB, 0x35, 0x12, 0xC7, 0x53, 0x35, 0xC0, 0xE0, 0x60,
+    0x6B, 0x80, 0xC5, 0x3D, 0xB9, 0xCD, 0x3B, 0xEC, 0x4B, 0xE6, 0x43, 0x76, 0xFF, 0xC9, 0x3D, 0x64,
+    0xB3, 0x4B, 0x0D, 0x1F, 0x72, 0xCC, 0xE2, 0x0E, 0x9E, 0x33, 0x3A, 0x98, 0x1B, 0x8E, 0xDF, 0x93,
+    0x4B, 0x52, 0x83, 0xF4, 0x9B, 0x98, 0xAB, 0xED, 0x7F, 0x4F, 0x1D, 0x64, 0x05, 0xC8, 0x35, 0xB0,
+    0x18, 0x96, 0xEB, 0xC9, 0x32, 0x48, 0x5D, 0x91, 0xD4, 0x67, 0x49, 0x6E, 0xD5, 0x6E, 0x40, 0x77,
+    0x17, 0xEA, 0xAF, 0x88, 0x7B, 0x4E, 0x16, 0x49, 0x2E, 0x4B, 0xEA, 0x36, 0x49, 0x96, 0x41, 0x6A,
+    0x79, 0xA0, 0x7F, 0x6E, 0x80, 0x45, 0xC0, 0xA2, 0x1E, 0x16, 0xD5, 0x30, 0x49, 0xD7, 0x6E, 0xCA,
+    0x03, 0x4F, 0x00, 0x3E, 0x05, 0x78, 0x1F, 0x28, 0xDF, 0xF8, 0x36, 0x3F, 0xBC, 0xB5, 0x9B, 0x36,
+    0x97, 0x0E, 0x00, 0xA6, 0x41, 0xFA, 0x1F, 0x52, 0xF9, 0x59, 0x0A, 0xF7, 0x18, 0x64, 0x73, 0xBF,
+    0xAA, 0x62, 0x24, 0xCA, 0xA5, 0x76, 0x53, 0x53, 0xE4, 0x93, 0x42, 0x6C, 0x18, 0x6C, 0x56, 0xB7,
+    0x56, 0x0C, 0xBB, 0x4D, 0x32, 0x5B, 0x53, 0x24, 0x97, 0x42, 0x54, 0xC5, 0x1B, 0xAB, 0x64, 0x37,
+    0x06, 0x29, 0x90, 0xA4, 0x86, 0x4D, 0x52, 0x4F, 0x94, 0xC4, 0x2A, 0xA9, 0x45, 0x92, 0x98, 0x25,
+    0xF9, 0x2C, 0x59, 0x18, 0x24, 0x98, 0x25, 0xCB, 0x2A, 0x89, 0x4D, 0x92, 0x6E, 0xBD, 0x68, 0x99,
+    0x55, 0x31, 0xBC, 0x50, 0x5C, 0xE7, 0x3D, 0x49, 0x06, 0x98, 0x24, 0x0F, 0xEC, 0x18, 0x11, 0xC6,
+    0x96, 0x67, 0xDC, 0x61, 0xB6, 0xBC, 0xC6, 0x40, 0xEA, 0x73, 0xC5, 0xE0, 0x56, 0xB7, 0x54, 0x0C,
+    0x36, 0xBB, 0xF4, 0x1B, 0x8A, 0xA5, 0x62, 0xE8, 0xF2, 0xA1, 0x83, 0xE5, 0x35, 0x5E, 0x23, 0x19,
+    0x2E, 0x2E, 0xED, 0x21, 0x8C, 0x87, 0x17, 0xE9, 0x3A, 0xF0, 0x9E, 0xA4, 0x9A, 0xF1, 0x8B, 0x33,
+    0xD3, 0xD1, 0x61, 0x1F, 0x99, 0x42, 0x52, 0x8B, 0x98, 0xE4, 0x52, 0x45, 0xAC, 0x19, 0x6B, 0xC6,
+    0x2E, 0xAB, 0x41, 0x4C, 0x32, 0x98, 0xA2, 0xFD, 0x98, 0xCA, 0x16, 0x06, 0xA9, 0x27, 0x4B, 0x72,
+    0x44, 0x49, 0xBE, 0xE8, 0xD2, 0x39, 0x59, 0x92, 0x24, 0x48, 0x52, 0x5B, 0x98, 0xB5, 0xBB, 0x87,
+    0x86, 0x6F, 0x11, 0xD5, 0xE5, 0x86, 0x51, 0x44, 0x83, 0xDA, 0xA2, 0x16, 0xF9, 0x24, 0x5B, 0x1A,
+    0x06, 0x75, 0xB9, 0x5F, 0xB5, 0x1B, 0xF8, 0x76, 0x6B, 0x90, 0xFA, 0xC5, 0x66, 0x29, 0x4C, 0x2E,
+    0xA9, 0x66, 0xF8, 0xDA, 0xD4, 0x0D, 0x03, 0x1C, 0x40, 0xE9, 0x0E, 0x4B, 0x21, 0x00, 0x14, 0x49,
+    0xEA, 0x56, 0x49, 0xF2, 0xB3, 0xA4, 0x8A, 0x51, 0x3A, 0x98, 0xB7, 0x6E, 0x0D, 0xD3, 0xBE, 0x09,
+    0xEE, 0x62, 0x93, 0x38, 0x5B, 0xD4, 0xF0, 0xA5, 0xAA, 0x51, 0xEE, 0x9C, 0x41, 0x9C, 0xF0, 0xA3,
+    0x40, 0x0F, 0x64, 0x07, 0xA4, 0x1E, 0x88, 0xD7, 0x8F, 0x6F, 0x7C, 0xC5, 0x23, 0xEF, 0x66, 0xF5,
+    0x69, 0xF7, 0xB7, 0x61, 0x92, 0x7F, 0x8C, 0x6A, 0x86, 0x8A, 0x93, 0xAC, 0x76, 0x93, 0xC1, 0x25,
+    0xF5, 0xCB, 0x8E, 0xFA, 0xFF, 0xF7, 0xAA, 0xB7, 0xA3, 0xB7, 0xB7, 0xA3, 0xB7, 0x70, 0x00, 0x3B,
+    0xEA, 0xE4, 0x80, 0x3C, 0x39, 0xA0, 0x4F, 0xE0, 0x30, 0xF3, 0x7E, 0xD9, 0x11, 0x68, 0xCD, 0xE0,
+    0x92, 0xDC, 0xFF, 0x3B, 0xC5, 0xD0, 0x30, 0x1E, 0x16, 0xC2, 0x2F, 0x0F, 0x65, 0xF9, 0x82, 0xE2,
+    0x70, 0xB9, 0xFD, 0xBC, 0x97, 0xE6, 0xB7, 0x2A, 0xAA, 0x5B, 0x9E, 0x22, 0xE9, 0x8B, 0xF4, 0x1B,
+    0x6F, 0x95, 0xE7, 0x3D, 0x5E, 0xA2, 0x1C, 0x0D, 0x92, 0x81, 0x72, 0x69, 0x31, 0x0C, 0x90, 0x64,
+    0xF8, 0x80, 0x2C, 0x53, 0xD4, 0x67, 0x99, 0x22, 0xBB, 0xC9, 0x14, 0xB5, 0xE5, 0xD7, 0xA9, 0xDD,
+    0x64, 0x4A, 0x15, 0xB2, 0x0C, 0xB0, 0x5E, 0xF5, 0x85, 0x51, 0x06, 0x1E, 0x88, 0x28, 0x55, 0x84,
+    0x24, 0xC9, 0x9F, 0x65, 0x49, 0xDD, 0x05, 0xD2, 0xEE, 0xBD, 0xBF, 0xA4, 0xE2, 0xE1, 0x0F, 0x54,
+    0x11, 0x60, 0x91, 0x3F, 0x03, 0xC6, 0xEE, 0x02, 0x58, 0x4D, 0xE1, 0x61, 0xA0, 0x22, 0xA4, 0x8A,
+    0xC9, 0x9F, 0x65, 0xF5, 0x6B, 0x77, 0x81, 0x0C, 0xA6, 0x10, 0x2B, 0x7E, 0x4A, 0x48, 0x0A, 0xC9,
+    0x9F, 0x65, 0xB9, 0xB5, 0xBB, 0xA0, 0x0A, 0x9B, 0x29, 0x00, 0x15, 0x01, 0x90, 0x3F, 0x83, 0xA2,
+    0xEE, 0x02, 0x56, 0x99, 0x72, 0x3C, 0x3E, 0x47, 0xE6, 0x0D, 0x87, 0x53, 0xFF, 0xB2, 0xE2, 0xFE,
+    0x2D, 0x39, 0x78, 0x60, 0x81, 0x77, 0x80, 0x95, 0x87, 0xE0, 0x52, 0xC5, 0x59, 0x56, 0x0F, 0x6A,
+    0x20, 0x0A, 0x92, 0x3C, 0x59, 0x0E, 0xE4, 0x37, 0x00, 0x77, 0x08, 0x7A, 0x1B, 0x78, 0xBA, 0x7F,
+    0x92, 0x96, 0xA7, 0x32, 0xC0, 0xD0, 0x1D, 0x3C, 0x32, 0xC3, 0xDF, 0x0D, 0xB7, 0xD1, 0xB0, 0xC7,
+    0x19, 0x5D, 0xBE, 0x74, 0x7A, 0x7E, 0xBE, 0x76, 0x74, 0x44, 0x0C, 0x40, 0x0D, 0xE4, 0xF6, 0xEA,
+    0xDA, 0x4A, 0x06, 0x49, 0xFD, 0x2A, 0x89, 0xE9, 0x20, 0xB9, 0xFC, 0x67, 0x6A, 0x99, 0x80, 0x72,
+    0x19, 0xEF, 0x6E, 0xFA, 0x26, 0x8C, 0xD2, 0x37, 0x9E, 0xFB, 0x05, 0x9B, 0x25, 0xCF, 0x28, 0xA2,
+    0x3C, 0x8C, 0x36, 0xAB, 0x07, 0x44, 0x34, 0xC0, 0x6A, 0xB3, 0x58, 0x0C, 0x13, 0xB1, 0xCF, 0xB2,
+    0xD8, 0xDC, 0xB0, 0x1B, 0x50, 0x9F, 0xD4, 0xF0, 0x0F, 0xB9, 0xDD, 0xA4, 0x6E, 0xE5, 0x3E, 0x93,
+    0x2A, 0x4E, 0x20, 0x4B, 0x36, 0xEF, 0x33, 0x7A, 0x2E, 0x3E, 0xDC, 0xC5, 0xBD, 0x71, 0x26, 0x86,
+    0x49, 0x15, 0x27, 0xD9, 0x14, 0xA9, 0x5F, 0x89, 0x2E, 0xA9, 0xE1, 0x8D, 0x5C, 0x13, 0x45, 0x22,
+    0x5A, 0xE4, 0x36, 0x9B, 0x15, 0x80, 0x48, 0xAC, 0x81, 0x64, 0xB3, 0x5A, 0x58, 0x45, 0x54, 0x7B,
+    0xD8, 0xB6, 0xEA, 0xA6, 0x24, 0x7D, 0x8F, 0xA2, 0x0E, 0x8A, 0x3C, 0x94, 0x6A, 0x5F, 0xEA, 0x93,
+    0xB7, 0x4A, 0xC3, 0x68, 0x8A, 0x41, 0x07, 0xD2, 0xEC, 0x64, 0x30, 0xA5, 0x66, 0x32, 0x45, 0x5C,
+    0xF6, 0x50, 0x7B, 0xC8, 0x8B, 0x14, 0xD9, 0x62, 0x8A, 0xBA, 0x6C, 0x8A, 0xDC, 0x62, 0x8A, 0x42,
+    0x32, 0xA5, 0x22, 0x9A, 0x7D, 0xA8, 0x16, 0x99, 0xD2, 0x6D, 0x32, 0xC5, 0xAD, 0x32, 0x45, 0xD7,
+    0x7E, 0xA4, 0x0A, 0xD6, 0xEA, 0x00, 0x86, 0x56, 0xF3, 0xE0, 0x9B, 0x1C, 0xB6, 0xBE, 0x5F, 0x54,
+    0xBD, 0x55, 0xAA, 0x00, 0xDF, 0x07, 0x7E, 0x41, 0x09, 0x4F, 0x99, 0x4C, 0x09, 0x73, 0xC5, 0x9D,
+    0x45, 0xE1, 0x51, 0x91, 0x7F, 0xCA, 0xAF, 0x42, 0x71, 0xC0, 0xBB, 0xD0, 0xCF, 0xBE, 0x34, 0xAB,
+    0x6E, 0x4A, 0x92, 0xBE, 0x33, 0xA8, 0x66, 0x53, 0x05, 0xAB, 0xFA, 0x83, 0xDF, 0x1C, 0x3B, 0x1E,
+    0xEC, 0xBE, 0xDE, 0x14, 0x49, 0x7D, 0xBA, 0x36, 0x88, 0x77, 0x99, 0x9B, 0x2D, 0x90, 0xBA, 0x0B,
+    0x48, 0x9E, 0x0F, 0xF8, 0x19, 0xA9, 0xE1, 0x2E, 0x43, 0x43, 0x97, 0x65, 0x37, 0x9F, 0xD4, 0x3F,
+    0x21, 0x2A, 0xDC, 0x43, 0x35, 0x6F, 0x64, 0xD9, 0xDC, 0x2F, 0x72, 0xC9, 0xA7, 0x86, 0x91, 0x67,
+    0x21, 0x0B, 0x98, 0x2A, 0xD8, 0xA4, 0xC0, 0x28, 0x5D, 0xDB, 0x7D, 0xAF, 0x7A, 0x78, 0xD0, 0x02,
+    0xFF, 0x0A, 0xAC, 0xE1, 0x57, 0x6F, 0xD3, 0x2F, 0xE2, 0xA3, 0x4D, 0xEE, 0x73, 0xC6, 0x7E, 0x09,
+    0xB0, 0xF6, 0xB0, 0xEC, 0x2D, 0x7E, 0x78, 0x3B, 0x87, 0xA9, 0xE1, 0xF6, 0xA2, 0xF0, 0x68, 0x93,
+    0xFB, 0x2F, 0x7E, 0x18, 0x72, 0x80, 0xD2, 0x43, 0x69, 0xD9, 0x03, 0x43, 0x03, 0xD9, 0xC3, 0x5D,
+    0xC8, 0xFE, 0xD9, 0xF1, 0xBB, 0x45, 0xF2, 0xB3, 0xCC, 0x57, 0x2E, 0x74, 0x35, 0xAB, 0x4D, 0x2D,
+    0x30, 0xD4, 0xC0, 0xA4, 0xF0, 0x30, 0x2C, 0xEA, 0x53, 0xBB, 0xA9, 0x5D, 0x6B, 0x86, 0xA6, 0x28,
+    0x4C, 0x62, 0xEC, 0x17, 0xB9, 0xB9, 0xDD, 0x64, 0x97, 0x9A, 0xA1, 0xD9, 0x14, 0xA6, 0x0A, 0xF5,
+    0x8B, 0x88, 0xED, 0x26, 0x3F, 0xD5, 0x7C, 0xEB, 0x2A, 0x98, 0x78, 0xE9, 0x91, 0x6A, 0x88, 0x07,
+    0xB0, 0xD5, 0x93, 0xA5, 0xB6, 0x1C, 0x4B, 0xD5, 0xB1, 0xAA, 0x1F, 0x49, 0x66, 0x8F, 0x15, 0xB2,
+    0x02, 0xA4, 0x6E, 0x33, 0xDC, 0x60, 0xB0, 0xAB, 0x4B, 0x0A, 0x77, 0x51, 0x9B, 0x03, 0xF0, 0x11,
+    0xB0, 0x33, 0xE5, 0x60, 0x6A, 0x77, 0x08, 0x9C, 0x75, 0x5D, 0x94, 0x0F, 0x92, 0x01, 0xD4, 0x41,
+    0x52, 0xCF, 0x53, 0xE9, 0xDA, 0xCD, 0xCB, 0x85, 0xB5, 0x9B, 0xDC, 0x5C, 0x31, 0x12, 0xED, 0x2A,
+    0x62, 0xB7, 0x36, 0x45, 0xC4, 0x9A, 0x81, 0xD1, 0xCF, 0x72, 0xC9, 0xCD, 0x2E, 0xC9, 0x14, 0xBB,
+    0xBA, 0x24, 0x85, 0x7B, 0xF4, 0xCB, 0x9E, 0xEC, 0xC8, 0x7B, 0x8E, 0x63, 0xD3, 0x1E, 0x42, 0x44,
+    0x29, 0x5C, 0x10, 0x56, 0xC9, 0x27, 0xDE, 0x61, 0x90, 0x5B, 0xDC, 0x1C, 0x92, 0xFA, 0x6C, 0x57,
+    0x5B, 0xD4, 0xE5, 0xA6, 0x54, 0x4C, 0x76, 0x13, 0x63, 0x9F, 0x2D, 0x72, 0x73, 0xC3, 0xBB, 0xC8,
+    0xAE, 0xF2, 0x8B, 0xBE, 0x73, 0xB3, 0x0A, 0xE4, 0x76, 0x4F, 0xEE, 0xE5, 0x3F, 0x1F, 0xFC, 0x22,
+    0x85, 0x49, 0x35, 0x52, 0xBF, 0x36, 0x30, 0x5A, 0x16, 0x39, 0x36, 0x1D, 0xDD, 0xCE, 0x3B, 0x02,
+    0x71, 0x8B, 0x6A, 0xCE, 0x8E, 0x43, 0x09, 0xF0, 0x39, 0xF0, 0x17, 0x30, 0x5F, 0x9E, 0x20, 0x53,
+    0xD4, 0xE1, 0xE7, 0x86, 0xF3, 0x22, 0x8F, 0x9F, 0x2D, 0xE7, 0xA5, 0x02, 0x3F, 0x3B, 0xCE, 0x8B,
+    0xB9, 0xC0, 0x4F, 0xB8, 0xF3, 0xAD, 0xBF, 0x87, 0xBF, 0x97, 0xDD, 0xF9, 0x16, 0x6E, 0xE0, 0x4F,
+    0x93, 0x3B, 0x67, 0x6B, 0xF0, 0x8C, 0xEE, 0x9C, 0xD4, 0xE0, 0x8B, 0xDC, 0x39, 0xB1, 0xC1, 0xAF,
+    0x72, 0xA9, 0xFE, 0x71, 0xFD, 0x13, 0xB9, 0xC9, 0x4D, 0x35, 0x7F, 0x99, 0x65, 0x77, 0x1C, 0x39,
+    0x4B, 0xB7, 0xFF, 0xE9, 0xB9, 0x11, 0xF3, 0x73, 0xC5, 0x79, 0x91, 0xC3, 0xCF, 0x86, 0xF3, 0x22,
+    0xF0, 0x73, 0xC7, 0x79, 0x69, 0xC0, 0xCF, 0x3E, 0x9C, 0x6F, 0xF6, 0x31, 0xFE, 0xE7, 0x9B, 0x3B,
+    0xDF, 0xDC, 0x87, 0xF8, 0x4F, 0x16, 0x77, 0xBE, 0xD1, 0xE0, 0x99, 0xDC, 0x39, 0x6B, 0x83, 0x47,
+    0xEE, 0x9C, 0xB9, 0xC1, 0x67, 0xB9, 0x73, 0xC6, 0x3D, 0x6E, 0xA9, 0x18, 0x1B, 0x5E, 0x2F, 0xEA,
+    0xD7, 0x6E, 0x15, 0xD1, 0xCF, 0x36, 0x57, 0x8C, 0x61, 0x32, 0xC5, 0x14, 0x75, 0xAB, 0x4F, 0xF2,
+    0x30, 0x54, 0x90, 0x65, 0x60, 0x51, 0x57, 0x48, 0xF2, 0x33, 0xA9, 0x62, 0x64, 0x36, 0xA5, 0x22,
+    0x76, 0x6B, 0x43, 0xF4, 0x73, 0xC3, 0xDF, 0x33, 0x1A, 0x5E, 0x2F, 0x07, 0xE4, 0xBE, 0x67, 0xAA,
+    0x26, 0x7B, 0x19, 0x81, 0x89, 0x87, 0x61, 0x69, 0x36, 0x85, 0xC9, 0x2E, 0x35, 0x83, 0x9B, 0xDA,
+    0x4D, 0x0C, 0xFD, 0x62, 0xB2, 0xC2, 0xD4, 0xA5, 0x9A, 0xC1, 0xC7, 0x76, 0xAB, 0xD9, 0x81, 0x62,
+    0x98, 0xFC, 0x5C, 0xE3, 0x19, 0xDA, 0x8D, 0xAC, 0xFE, 0x9C, 0x59, 0xE1, 0x74, 0xCF, 0xFE, 0x3D,
+    0xDF, 0x10, 0x24, 0xB2, 0x67, 0x10, 0xD9, 0x33, 0xD6, 0x64, 0x4F, 0x6C, 0xC8, 0x9E, 0xA9, 0x21,
+    0xFB, 0xB3, 0xB9, 0xBD, 0xC8, 0xFE, 0x34, 0xD9, 0xF3, 0xEC, 0x3F, 0x59, 0xBA, 0x4F, 0xB3, 0xBF,
+    0x97, 0xFB, 0xBB, 0xD9, 0xDF, 0xCB, 0xEE, 0x6E, 0xF6, 0x3F, 0xDF, 0xFC, 0xEB, 0xD9, 0x4F, 0x04,
+    0x93, 0xFD, 0x04, 0x26, 0xFB, 0xC9, 0x6F, 0x26, 0xFB, 0xC9, 0x65, 0x93, 0xFD, 0xE4, 0x56, 0x93,
+    0xFD, 0xD4, 0x2D, 0x26, 0xFB, 0xC9, 0x26, 0x93, 0x0F, 0x9F, 0xDD, 0x66, 0x3F, 0x8B, 0xBB, 0x5F,
+    0xC2, 0x1C, 0xD2, 0x5A, 0x07, 0xE6, 0xF8, 0xCE, 0x6F, 0x6C, 0x3C, 0x8B, 0xA8, 0xEA, 0xAF, 0xA4,
+    0x0A, 0x46, 0xF5, 0x30, 0xD5, 0xC0, 0xD4, 0x95, 0x6F, 0x13, 0x99, 0x1B, 0x6E, 0x20, 0x43, 0xB7,
+    0xEE, 0x4D, 0xDD, 0xE7, 0x8C, 0xE2, 0x93, 0xA2, 0xE6, 0xA0, 0x4A, 0x72, 0x89, 0x58, 0xF1, 0x7D,
+    0x46, 0xBB, 0x35, 0xFC, 0x07, 0xFB, 0xFD, 0x33, 0xEC, 0x99, 0x10, 0x5D, 0xB9, 0xBF, 0x0E, 0x38,
+    0xBF, 0x8C, 0xBB, 0xFD, 0xB3, 0x63, 0x4E, 0x57, 0xB9, 0xF3, 0x22, 0xBB, 0x31, 0x36, 0xF8, 0x59,
+    0xBF, 0x83, 0x22, 0x4B, 0x7F, 0x34, 0x98, 0xDC, 0x33, 0xF8, 0x13, 0x36, 0x03, 0x24, 0xCF, 0x5B,
+    0xBC, 0xCB, 0xD8, 0x65, 0x9F, 0xC4, 0xC7, 0xA8, 0x2D, 0x7E, 0x96, 0xFF, 0xB4, 0xC8, 0x5C, 0x32,
+    0x6D, 0xF1, 0x49, 0xE1, 0x63, 0x64, 0x37, 0x9F, 0x6B, 0xEE, 0x52, 0x58, 0x3D, 0x60, 0x0A, 0x44,
+    0xFF, 0x0B, 0x66, 0x53, 0x74, 0x53, 0xFE, 0xD2, 0xF6, 0xBF, 0x9A, 0x91, 0xAA, 0xBF, 0x19, 0xE4,
+    0x59, 0xEB, 0x1D, 0x12, 0xAC, 0x1D, 0xFF, 0x98, 0x5C, 0xDE, 0x31, 0x83, 0x4F, 0x52, 0x98, 0x5F,
+    0xFE, 0xF9, 0xB4, 0xD7, 0xB9, 0x4D, 0x7F, 0xD0, 0x71, 0xB1, 0xB6, 0xB0, 0xD6, 0xBB, 0xCB, 0x79,
+    0x70, 0x19, 0x35, 0xF6, 0x87, 0x5C, 0xF1, 0x33, 0xA0, 0x7C, 0xF7, 0x4E, 0x39, 0x1E, 0xBE, 0x04,
+    0x04, 0x7D, 0x25, 0x85, 0x24, 0xD9, 0xA2, 0x8A, 0x9F, 0x12, 0x15, 0x26, 0xB7, 0xC8, 0xA5, 0xB6,
+    0xA8, 0x5B, 0x77, 0xD3, 0xDC, 0x2F, 0x0D, 0x32, 0xA5, 0x62, 0x14, 0x31, 0x44, 0xF5, 0xC9, 0x25,
+    0x35, 0xA5, 0x5B, 0xA4, 0xF0, 0x51, 0x96, 0xBA, 0xC7, 0x45, 0x6A, 0xCA, 0x1E, 0x0F, 0x47, 0xC9,
+    0x32, 0x4B, 0x35, 0xE9, 0x10, 0xFE, 0xCA, 0xEE, 0xB9, 0xDF, 0xAB, 0xA0, 0x88, 0x28, 0xBD, 0x46,
+    0x92, 0x1C, 0x49, 0xB2, 0x2C, 0x52, 0xC3, 0xA2, 0x7D, 0xF5, 0x92, 0xAE, 0xDD, 0x92, 0xAE, 0x92,
+    0x13, 0xFB, 0xFC, 0x5C, 0xBA, 0xC4, 0x42, 0x2F, 0x57, 0x54, 0xFE, 0xC9, 0x7E, 0x50, 0xB6, 0x3D,
+    0x4C, 0x5E, 0xE4, 0x01, 0x06, 0xB7, 0xB9, 0xCF, 0x48, 0x7D, 0xB6, 0xD9, 0x16, 0x9B, 0x1B, 0xC4,
+    0xDD, 0x22, 0x62, 0xFF, 0x84, 0xD1, 0xA5, 0x76, 0x0B, 0x93, 0xCD, 0x15, 0x77, 0x96, 0x06, 0xF9,
+    0x4F, 0x0F, 0x15, 0xD1, 0x25, 0xBB, 0xB9, 0xC5, 0x66, 0x43, 0x4B, 0x43, 0xC3, 0xC8, 0x53, 0x3E,
+    0x21, 0xDA, 0xDD, 0x82, 0x07, 0x60, 0x54, 0x0D, 0x65, 0xF8, 0xAD, 0xB3, 0x7A, 0x55, 0xC5, 0x0E,
+    0x12, 0xDD, 0xD2, 0x65, 0x31, 0xDB, 0x52, 0x11, 0x1B, 0x6E, 0x30, 0x54, 0x7C, 0x54, 0xA4, 0x43,
+    0xC2, 0x76, 0x91, 0xFA, 0x3D, 0x4B, 0x10, 0x25, 0xCB, 0x74, 0xD8, 0xA1, 0x40, 0x96, 0x38, 0xD9,
+    0xD4, 0xEC, 0x7F, 0x9F, 0xD4, 0x87, 0x0C, 0xBC, 0x5B, 0xE5, 0x53, 0x48, 0x7B, 0x66, 0x46, 0x0A,
+    0x73, 0x45, 0xFC, 0xFD, 0x09, 0xB0, 0xFD, 0x1A, 0x91, 0x64, 0x5E, 0x41, 0xAE, 0xFF, 0xF8, 0xB0,
+    0x56, 0x7F, 0x96, 0xD5, 0x5D, 0xA0, 0x1D, 0xC8, 0x87, 0x97, 0x14, 0xA9, 0xE6, 0xCE, 0x21, 0x22,
+    0x5A, 0x3D, 0x94, 0x9A, 0x67, 0x8C, 0xFB, 0xCD, 0xE8, 0xD6, 0xFD, 0x9A, 0x54, 0x2F, 0x2A, 0x0E,
+    0xFE, 0xA2, 0x66, 0xB0, 0xF9, 0xEB, 0x2C, 0xF6, 0x10, 0xF4, 0x95, 0x85, 0xAE, 0x62, 0xB3, 0x7E,
+    0x11, 0xF1, 0xD0, 0xE3, 0x6B, 0x14, 0x77, 0x98, 0xB3, 0xED, 0xAF, 0xE7, 0xE3, 0x97, 0xC5, 0x69,
+    0x77, 0x48, 0xDB, 0xE1, 0x0C, 0xBD, 0x52, 0xAC, 0x7F, 0x72, 0x88, 0x54, 0xF6, 0x3B, 0xB8, 0x5C,
+    0xB2, 0xDF, 0x0D, 0x8B, 0x74, 0xF0, 0x3C, 0xFD, 0xD3, 0x5B, 0x52, 0x0D, 0xE5, 0x80, 0xD7, 0x6A,
+    0x20, 0xA9, 0x7F, 0xFA, 0x3D, 0xC6, 0x9A, 0xA1, 0xCB, 0xFB, 0x94, 0x6A, 0x06, 0x9B, 0xD5, 0x2F,
+    0x35, 0xB1, 0xE6, 0xD1, 0x9E, 0xAA, 0x43, 0x35, 0x10, 0xD5, 0xEF, 0x69, 0x21, 0x5D, 0x61, 0xA8,
+    0x2F, 0xA5, 0x4F, 0x6E, 0xA9, 0xC1, 0xC3, 0xD4, 0xE0, 0xD9, 0x3D, 0x38, 0x5B, 0x83, 0xFF, 0xD5,
+    0x6D, 0x1A, 0xFC, 0xDC, 0x7C, 0x81, 0xB6, 0x34, 0xF8, 0x67, 0x94, 0x06, 0x0F, 0xB9, 0xC1, 0x43,
+    0x6A, 0xF0, 0x94, 0xDD, 0xAE, 0xBD, 0xFA, 0xA8, 0x18, 0x8E, 0x54, 0x01, 0x83, 0x87, 0xB5, 0x03,
+    0xDE, 0xE5, 0x4D, 0x3E, 0x63, 0xB4, 0x9B, 0x9F, 0x6B, 0xDE, 0x5E, 0xC5, 0xC7, 0x45, 0xFE, 0x33,
+    0x1E, 0x91, 0x3D, 0xE4, 0x0E, 0x36, 0x03, 0x0F, 0x2E, 0xED, 0xB1, 0xC2, 0xEE, 0xDE, 0xA7, 0x3F,
+    0x7D, 0x93, 0x24, 0xF9, 0x65, 0x0F, 0xD0, 0x6C, 0x6E, 0xE0, 0xEA, 0x57, 0x1D, 0xBD, 0x9D, 0xF7,
+    0x18, 0xCF, 0xAD, 0x83, 0x42, 0x0A, 0x1F, 0x30, 0x07, 0x88, 0x01, 0x74, 0x9B, 0xE5, 0xD2, 0x1E,
+    0x5F, 0xFB, 0x81, 0xBA, 0x55, 0x3D, 0xB3, 0x29, 0x72, 0x50, 0x31, 0x3A, 0x48, 0x7E, 0xEE, 0xCB,
+    0xED, 0xD2, 0xAD, 0x36, 0x8B, 0xBB, 0xC5, 0x14, 0xF5, 0x4F, 0xF9, 0x3E, 0x83, 0x29, 0x1E, 0xA2,
+    0x38, 0x85, 0x24, 0x77, 0x0E, 0x59, 0x76, 0xE3, 0x11, 0x6A, 0xF0, 0x73, 0x98, 0x2A, 0xDE, 0x5F,
+    0xBB, 0x55, 0xE1, 0xE3, 0xD2, 0x30, 0xF8, 0xCF, 0x18, 0x43, 0x61, 0xF5, 0xB3, 0x85, 0xDC, 0xAD,
+    0x82, 0x6C, 0x8A, 0x0C, 0x8B, 0xF4, 0x3C, 0x2C, 0xA8, 0xA1, 0xD4, 0xC0, 0xEC, 0xA1, 0x58, 0x8E,
+    0xFC, 0x4C, 0x34, 0xC5, 0x66, 0x1D, 0x18, 0x06, 0x3F, 0xFB, 0xCB, 0x36, 0x66, 0xFF, 0xF3, 0x23,
+    0xCC, 0xB6, 0x98, 0x52, 0x11, 0xFD, 0xEC, 0x16, 0x53, 0x6C, 0x91, 0xFF, 0x05, 0xD1, 0x14, 0xBF,
+    0xC8, 0xCF, 0xFA, 0x97, 0x7A, 0x56, 0x3F, 0x87, 0xB1, 0xC6, 0x66, 0x75, 0x73, 0x18, 0xF5, 0xD7,
+    0xD5, 0xE1, 0xE3, 0x7F, 0x6D, 0xA0, 0xFB, 0xBF, 0x01, 0xD5, 0xBD, 0x4F, 0xAC, 0x1D, 0x47, 0x7E,
+    0x2E, 0xF6, 0x75, 0x97, 0xEE, 0x6D, 0x9B, 0x8D, 0x37, 0x25, 0x20, 0xBA, 0xB6, 0x47, 0xB4, 0xA7,
+    0x67, 0xF1, 0x16, 0x36, 0x6D, 0x4F, 0x67, 0xE1, 0x85, 0x17, 0x92, 0xAA, 0x25, 0x21, 0x4F, 0x40,
+    0x04, 0x84, 0x17, 0x78, 0x3C, 0x1E, 0x3C, 0x6B, 0x21, 0x03, 0x79, 0x06, 0x3C, 0x34, 0x60, 0x7A,
+    0x11, 0x20, 0xB3, 0xD0, 0xA8, 0x5A, 0xD2, 0x42, 0x8B, 0x01, 0xA2, 0xFB, 0xE0, 0x19, 0x07, 0xC8,
+    0x2C, 0x86, 0x0F, 0xE1, 0x0B, 0xA8, 0x43, 0xBC, 0xD0, 0x09, 0xBC, 0x50, 0x12, 0x8A, 0x55, 0x12,
+    0xE3, 0x10, 0x81, 0x16, 0xB7, 0x25, 0x59, 0x16, 0x10, 0x2D, 0xD8, 0x1A, 0x69, 0x9E, 0x66, 0xC4,
+    0x04, 0x2C, 0x89, 0xAD, 0x61, 0x5D, 0xB2, 0xAA, 0xBE, 0x2C, 0xAA, 0xCF, 0xB9, 0x97, 0xD4, 0x7F,
+    0x59, 0xF2, 0xD0, 0xE7, 0xDE, 0x53, 0xDD, 0xA7, 0xBB, 0x4F, 0x9F, 0xAE, 0x5F, 0x57, 0x57, 0xFD,
+    0xFE, 0x7C, 0xBF, 0xAF, 0x00, 0xFD, 0x14, 0x8F, 0x26, 0x35, 0x69, 0x7B, 0x27, 0x00, 0xE8, 0x27,
+    0x58, 0x85, 0xC6, 0xE9, 0x17, 0x59, 0x87, 0xD6, 0x99, 0x0B, 0x94, 0x41, 0x4D, 0x7C, 0x95, 0x47,
+    0xA3, 0xF2, 0x00, 0x00, 0x69, 0x01, 0x05, 0x14, 0xA9, 0x83, 0xA1, 0x97, 0xE4, 0x48, 0xB2, 0xE6,
+    0x3F, 0x04, 0xE5, 0x51, 0xD0, 0xA2, 0x4E, 0x40, 0x3B, 0x01, 0x66, 0x40, 0xC9, 0x0E, 0x75, 0x02,
+    0x1A, 0x0F, 0x68, 0x07, 0xD0, 0x15, 0xFF, 0x8E, 0xE4, 0x83, 0x64, 0x2C, 0xC9, 0xA9, 0x30, 0xEC,
+    0xA1, 0x3A, 0x20, 0x00, 0xC2, 0x01, 0x1B, 0x1D, 0xF2, 0xEB, 0x04, 0x77, 0xD0, 0x92, 0x7D, 0x4D,
+    0x3A, 0x90, 0x44, 0x13, 0x8A, 0x9D, 0x92, 0x1D, 0xD0, 0x3A, 0xA0, 0x24, 0xF2, 0x8A, 0x60, 0x87,
+    0x9A, 0x64, 0x67, 0xC8, 0xA9, 0x26, 0xD9, 0x7D, 0x9B, 0x3F, 0xDC, 0xDE, 0x3F, 0x46, 0x39, 0x40,
+    0x10, 0x80, 0x19, 0x80, 0xD6, 0x03, 0x35, 0xC9, 0x68, 0x48, 0xBE, 0xB1, 0x5A, 0x19, 0x00, 0x40,
+    0x58, 0x7C, 0xA3, 0x4C, 0xBC, 0x32, 0x1A, 0xD2, 0xD7, 0xA4, 0x2F, 0xF8, 0x50, 0x00, 0xA1, 0x7A,
+    0xD5, 0xD5, 0x4E, 0x0E, 0x65, 0x10, 0x1E, 0x09, 0xA6, 0x33, 0x5D, 0x43, 0xDA, 0x86, 0x0C, 0x92,
+    0xA4, 0xF5, 0xC7, 0x1F, 0xB6, 0x77, 0x00, 0xBD, 0x19, 0xD0, 0xEC, 0xD1, 0x82, 0x17, 0x08, 0x91,
+    0x44, 0x42, 0xEB, 0xEA, 0x00, 0xF6, 0xD2, 0xD7, 0x01, 0xAD, 0x53, 0x23, 0xD4, 0xCB, 0x04, 0xCC,
+    0xAE, 0x07, 0x68, 0x2C, 0x4A, 0x26, 0x40, 0xD0, 0xA1, 0x3C, 0xCB, 0x77, 0x21, 0xC9, 0x00, 0x45,
+    0x3A, 0x6C, 0xF1, 0xB5, 0x7C, 0xC1, 0x9B, 0x67, 0xD3, 0xA9, 0xBC, 0x89, 0xA4, 0x2D, 0xBE, 0xCD,
+    0x05, 0x20, 0xC3, 0x5C, 0x23, 0xD0, 0x02, 0xE6, 0xE0, 0x2B, 0x0B, 0xED, 0xF8, 0xC1, 0x4D, 0xC7,
+    0xB1, 0xB5, 0x8D, 0x96, 0x5E, 0x92, 0x2F, 0xF2, 0x4C, 0x50, 0x76, 0xF3, 0xC1, 0x00, 0xA8, 0x11,
+    0x05, 0x47, 0x54, 0x1C, 0x61, 0x38, 0x36, 0x97, 0xF9, 0x54, 0xA8, 0x82, 0xEA, 0x9B, 0x57, 0x03,
+    0x92, 0x1A, 0x9B, 0x97, 0xF9, 0x6A, 0xA8, 0xC8, 0x5E, 0xD2, 0xE1, 0x30, 0x7B, 0xD4, 0x11, 0x68,
+    0x47, 0x14, 0xE9, 0xBB, 0x50, 0xAF, 0xD3, 0x04, 0x4D, 0x16, 0x64, 0x8F, 0x2D, 0x00, 0x80, 0x42,
+    0x34, 0x4F, 0x92, 0x4F, 0x52, 0x77, 0xF1, 0x0E, 0xDC, 0x39, 0xDF, 0x3A, 0x6C, 0x72, 0x0F, 0x40,
+    0x45, 0x46, 0xA0, 0x4C, 0x38, 0xEC, 0x81, 0x08, 0xD4, 0x23, 0x14, 0x7E, 0x6D, 0xBB, 0xED, 0x2B,
+    0xDB, 0x70, 0x78, 0x1E, 0x53, 0xC5, 0x20, 0x5C, 0x83, 0x88, 0xAE, 0x79, 0x70, 0x6C, 0x3B, 0xC0,
+    0xDF, 0x23, 0x1C, 0x50, 0x5F, 0xB4, 0x8F, 0x03, 0x78, 0xEC, 0xB1, 0x6A, 0x00, 0xAA, 0x8B, 0xF6,
+    0x7B, 0xFB, 0x1F, 0x2E, 0xD8, 0xFB, 0x00, 0x9C, 0xBB, 0x57, 0x38, 0x40, 0x3E, 0xE9, 0x9A, 0x1E,
+    0x98, 0x64, 0xC7, 0x33, 0xB6, 0xC5, 0xB9, 0x92, 0xA1, 0x1A, 0x84, 0x2B, 0x9F, 0x2D, 0x02, 0x1A,
+    0x0B, 0x18, 0x40, 0xEF, 0x40, 0x5B, 0xC0, 0x90, 0x23, 0x00, 0xC3, 0x11, 0xC0, 0x7C, 0xE5, 0xD8,
+    0xE4, 0x20, 0x39, 0xC9, 0x33, 0x01, 0x08, 0x38, 0x1E, 0x6B, 0xC6, 0xF6, 0xA7, 0x51, 0x75, 0x51,
+    0x3D, 0x10, 0xD5, 0x95, 0xD8, 0xF0, 0x7B, 0x9B, 0x6F, 0xFF, 0xF6, 0xF1, 0xE5, 0x72, 0x79, 0x82,
+    0xE4, 0x65, 0x92, 0xD7, 0x49, 0x26, 0x00, 0xAA, 0x07, 0xE4, 0x08, 0x08, 0x0F, 0x60, 0x7F, 0x83,
+    0xE2, 0x5B, 0x4C, 0x8A, 0x6F, 0x31, 0x61, 0xFF, 0xF5, 0xF1, 0x72, 0xD8, 0x58, 0xA0, 0xED, 0x2B,
+    0x4B, 0xE2, 0x79, 0x4C, 0x32, 0xCB, 0x21, 0xD4, 0x63, 0xF3, 0xE0, 0x28, 0xAD, 0x82, 0xBF, 0x07,
+    0x41, 0xB8, 0xFA, 0xA2, 0x95, 0xF6, 0x71, 0x3C, 0xF6, 0x18, 0xE2, 0x09, 0x5B, 0x5D, 0xB4, 0x92,
+    0x0E, 0x8F, 0x3D, 0x06, 0x26, 0x54, 0x17, 0xAC, 0x7C, 0xD1, 0xE1, 0xDC, 0xBD, 0x08, 0xD2, 0xCA,
+    0x27, 0x9D, 0xB4, 0xCF, 0x63, 0x92, 0x5D, 0x10, 0xAE, 0xC5, 0x39, 0x69, 0x9B, 0xA7, 0x07, 0xE1,
+    0x8E, 0x61, 0xF1, 0xE9, 0x72, 0x38, 0xB2, 0x5C, 0x2E, 0xFF, 0x8A, 0x24, 0x15, 0xC9, 0xF7, 0x97,
+    0xCB, 0xE5, 0x12, 0x40, 0xC9, 0x5E, 0xD2, 0x29, 0x06, 0x7D, 0x7F, 0x3C, 0x8F, 0xF3, 0xE7, 0xA1,
+    0xCF, 0xE3, 0xBC, 0xBE, 0x3F, 0x2A, 0x06, 0xC9, 0xA9, 0x64, 0x0F, 0x00, 0x62, 0x02, 0x8A, 0x08,
+    0x40, 0x77, 0x40, 0x33, 0x00, 0x55, 0xDE, 0xB0, 0xB9, 0x34, 0xCB, 0xFF, 0x89, 0x64, 0x32, 0x24,
+    0xCF, 0x92, 0x1C, 0x6F, 0x3D, 0x62, 0xFF, 0x2B, 0xC5, 0x36, 0xEE, 0x5E, 0x2E, 0x97, 0x3F, 0x5A,
+    0x49, 0xD7, 0x90, 0xEC, 0xB1, 0x40, 0xCD, 0x51, 0x71, 0x6A, 0xAF, 0x84, 0x43, 0x22, 0x40, 0x04,
+    0x54, 0x1E, 0xD2, 0x41, 0x0D, 0x60, 0x27, 0x22, 0xE4, 0x04, 0xC5, 0x98, 0xFF, 0x01, 0xAC, 0x8E,
+    0xF7, 0xCD, 0x8F, 0xC2, 0x1D, 0x45, 0x40, 0x19, 0xF0, 0xC8, 0x54, 0xD2, 0x96, 0x9C, 0xB0, 0x19,
+    0x81, 0x74, 0x27, 0x92, 0x3A, 0x13, 0x15, 0x43, 0xCB, 0x11, 0x0B, 0x60, 0xB9, 0xD3, 0x86, 0x8A,
+    0x60, 0xAF, 0x86, 0xCA, 0x01, 0x00, 0xEA, 0x88, 0x3A, 0x9A, 0x01, 0xE6, 0x8D, 0x4F, 0x5F, 0xE1,
+    0x1B, 0x11, 0x32, 0x9A, 0x11, 0x7C, 0x83, 0x68, 0xA2, 0x99, 0x04, 0xDF, 0xE0, 0x8D, 0x75, 0x8F,
+    0x72, 0x35, 0x9A, 0x2B, 0xA1, 0x7D, 0x23, 0xDE, 0x95, 0x3B, 0x9C, 0x3A, 0xE2, 0xE3, 0x56, 0x80,
+    0x62, 0xB1, 0xD8, 0xAE, 0x49, 0x56, 0x24, 0x1D, 0x99, 0x4C, 0x4B, 0x3E, 0x70, 0x95, 0x9C, 0x5A,
+    0xB5, 0x5A, 0xD1, 0xE4, 0x03, 0xD7, 0x6E, 0xDA, 0xA2, 0xC8, 0x07, 0xDE, 0x27, 0xA7, 0x56, 0x92,
+    0x0F, 0x38, 0xCD, 0xA9, 0x85, 0xE1, 0x03, 0x0E, 0xC5, 0xD4, 0x02, 0xCD, 0x17, 0x5A, 0x01, 0x80,
+    0xD5, 0x00, 0x60, 0xEC, 0x5D, 0xA8, 0x86, 0xD2, 0xC3, 0x0C, 0x22, 0xC0, 0x34, 0xBC, 0xC8, 0x81,
+    0x3B, 0x00, 0x5A, 0xAB, 0x9C, 0x0E, 0x86, 0xCD, 0x95, 0x17, 0x9F, 0x76, 0x45, 0x80, 0x41, 0x6B,
+    0x6B, 0x57, 0xAE, 0x56, 0x00, 0x00, 0x05, 0xFB, 0x9A, 0x53, 0x73, 0x23, 0x28, 0x9B, 0x54, 0x67,
+    0x54, 0xA7, 0x55, 0xA7, 0x55, 0x67, 0x5A, 0x9B, 0x24, 0x43, 0x45, 0x87, 0xBF, 0xE8, 0xD0, 0xF6,
+    0xA8, 0x1D, 0xC0, 0x1E, 0xCD, 0x88, 0x8A, 0x3D, 0x94, 0x45, 0xCB, 0x1E, 0xBA, 0x83, 0xD2, 0x3D,
+    0x08, 0xFC, 0x0B, 0xD5, 0x97, 0x11, 0x80, 0xEA, 0x45, 0x00, 0xA0, 0xFA, 0xDA, 0x01, 0x50, 0xBD,
+    0x1C, 0x01, 0xA8, 0x5E, 0xD9, 0x8D, 0x0E, 0xAA, 0xD7, 0xBD, 0x1A, 0xA0, 0x7A, 0xC2, 0x0C, 0x50,
+    0x4F, 0xC4, 0x82, 0x03, 0xD4, 0x53, 0x41, 0x70, 0xC0, 0xD6, 0xC3, 0x53, 0x7D, 0x65, 0x00, 0xA4,
+    0x6B, 0x4E, 0x0C, 0x40, 0x3B, 0xA8, 0x76, 0x00, 0x54, 0x7F, 0xAE, 0x1D, 0x00, 0x16, 0xBE, 0x1D,
+    0x50, 0x24, 0x41, 0x46, 0x88, 0x20, 0xC8, 0x88, 0x6A, 0x2A, 0x96, 0xE6, 0x67, 0x90, 0x0E, 0x68,
+    0x07, 0xB4, 0x43, 0x5E, 0xFC, 0xE3, 0xAF, 0xF3, 0x78, 0x07, 0xD5, 0xEB, 0xA7, 0x39, 0x41, 0xF5,
+    0x6C, 0x18, 0xA0, 0x9E, 0x88, 0xF2, 0x72, 0x84, 0x7A, 0x2A, 0x94, 0x45, 0xC2, 0xD6, 0xC3, 0x13,
+    0x8A, 0x08, 0x48, 0x07, 0x11, 0x80, 0x76, 0x40, 0x3D, 0x01, 0xAA, 0x47, 0x3B, 0x02, 0x04, 0x4C,
+    0x8F, 0x22, 0x41, 0x24, 0x40, 0x04, 0xC8, 0xBD, 0x63, 0xA8, 0x26, 0xB4, 0x24, 0xA4, 0x43, 0x4B,
+    0xA2, 0x1D, 0xD0, 0x92, 0xF3, 0xED, 0x6B, 0x22, 0xD0, 0x5A, 0xC1, 0x04, 0x10, 0xF2, 0x46, 0x40,
+    0xED, 0xF0, 0x2B, 0xD5, 0x04, 0xDD, 0x03, 0xD2, 0x8A, 0x00, 0x20, 0xA1, 0xC9, 0x5D, 0x3F, 0x81,
+    0x8A, 0x7D, 0x35, 0x01, 0x87, 0x8C, 0x55, 0x16, 0x80, 0x7A, 0x32, 0x16, 0xC7, 0x00, 0x4A, 0xD7,
+    0xBA, 0xE7, 0x2A, 0x6F, 0xC0, 0x17, 0xC9, 0xD7, 0xBD, 0x64, 0xC5, 0xA8, 0xAC, 0x09, 0xC5, 0xF2,
+    0xFE, 0x24, 0x2E, 0x39, 0x40, 0x3A, 0xA5, 0x2C, 0xA0, 0x1F, 0x98, 0x08, 0x88, 0x20, 0x9F, 0x0A,
+    0x40, 0x3B, 0x44, 0xE9, 0x00, 0x56, 0x64, 0x40, 0xED, 0x1A, 0xD2, 0x41, 0xF7, 0x47, 0xCE, 0xA4,
+    0x4E, 0x04, 0x40, 0x3A, 0x34, 0x23, 0xA0, 0x2C, 0xB0, 0x0D, 0x54, 0x11, 0x90, 0xCC, 0xEF, 0x3A,
+    0x01, 0xA5, 0xDF, 0xEF, 0x2C, 0x8B, 0x63, 0x80, 0x08, 0xF9, 0x5D, 0x07, 0x40, 0x79, 0x14, 0x74,
+    0xA8, 0x68, 0x21, 0x13, 0xA0, 0x26, 0x40, 0x8D, 0x80, 0x1E, 0x00, 0x3D, 0xE2, 0x4E, 0x35, 0x6D,
+    0x7A, 0x45, 0x86, 0x86, 0x4C, 0x15, 0xE9, 0x71, 0x22, 0xAD, 0x54, 0x07, 0x91, 0x8A, 0x09, 0x90,
+    0xBC, 0xEC, 0x80, 0x96, 0x74, 0x80, 0x7A, 0x88, 0x16, 0xB8, 0x17, 0x7F, 0x81, 0x5B, 0x5E, 0xC6,
+    0x03, 0x00, 0x03, 0x80, 0x82, 0x11, 0x80, 0x20, 0x01, 0x88, 0x44, 0x00, 0x75, 0x60, 0x0F, 0xC8,
+    0x40, 0x0B, 0x48, 0x6F, 0x2C, 0xD0, 0x4E, 0x6A, 0x04, 0x94, 0x53, 0x0E, 0xD0, 0x63, 0xD6, 0x70,
+    0x1A, 0x0F, 0xD0, 0xCA, 0x80, 0x82, 0x7D, 0x1D, 0x51, 0x92, 0x4C, 0x10, 0x24, 0x89, 0x8A, 0x24,
+    0xBB, 0x9A, 0x24, 0xAD, 0x4C, 0x8B, 0x3F, 0xA2, 0x6D, 0x02, 0xC0, 0x41, 0x79, 0xC0, 0x38, 0x35,
+    0x01, 0xDA, 0x69, 0x07, 0x28, 0xCF, 0x11, 0x68, 0x73, 0x23, 0x00, 0x40, 0x0F, 0xA0, 0xD8, 0x8B,
+    0x00, 0x4A, 0x77, 0xDF, 0xBA, 0xCC, 0x57, 0x78, 0x1B, 0x5D, 0x6D, 0x45, 0x92, 0x23, 0x40, 0x92,
+    0x04, 0x1A, 0x92, 0x74, 0xF9, 0x6C, 0x04, 0xF4, 0xBB, 0xFC, 0xE1, 0x62, 0x1B, 0x75, 0x68, 0xB2,
+    0x90, 0x9F, 0x60, 0x0F, 0xA0, 0x75, 0x8D, 0x07, 0x20, 0x58, 0xB0, 0x07, 0xA0, 0x87, 0x26, 0x2E,
+    0x8E, 0x41, 0x86, 0x82, 0xA4, 0x2D, 0xD8, 0x37, 0x64, 0x80, 0x72, 0x05, 0x49, 0x5B, 0x25, 0x34,
+    0x69, 0x79, 0x1A, 0x79, 0x60, 0x80, 0x24, 0xE9, 0x81, 0x92, 0xF9, 0xA3, 0xCA, 0x1F, 0xEB, 0xB4,
+    0xF8, 0x23, 0xF6, 0x00, 0x2D, 0x1A, 0x0F, 0x34, 0x1E, 0x05, 0xC9, 0xAB, 0xF3, 0xF5, 0x68, 0x87,
+    0x82, 0x24, 0x63, 0xFE, 0x28, 0xC8, 0x53, 0x80, 0x24, 0x53, 0x07, 0x45, 0xB2, 0x07, 0x49, 0xF6,
+    0x82, 0x0B, 0xC3, 0x5E, 0x06, 0x34, 0x84, 0x72, 0x68, 0x12, 0x68, 0xD1, 0x06, 0x41, 0x40, 0x4D,
+    0x32, 0x00, 0x7C, 0x9D, 0x9C, 0x04, 0x7F, 0x4C, 0x0E, 0x32, 0x69, 0xB2, 0x53, 0x7B, 0x64, 0x04,
+    0xDF, 0xD4, 0x1F, 0x6C, 0x0B, 0x76, 0xB4, 0x90, 0x41, 0x10, 0x30, 0x4E, 0x06, 0x54, 0xEC, 0x95,
+    0x83, 0x0E, 0xA0, 0x7D, 0x94, 0x83, 0x20, 0x99, 0x20, 0x49, 0x8E, 0x50, 0xA4, 0x07, 0xC8, 0xBD,
+    0xFD, 0x56, 0xCF, 0xEE, 0x1C, 0x50, 0xF1, 0x7A, 0x00, 0x24, 0x39, 0x01, 0xF2, 0xFF, 0xE2, 0x08,
+    0x34, 0xF8, 0x56, 0x77, 0x73, 0x53, 0x2D, 0x0C, 0x7B, 0xA0, 0x21, 0x3D, 0x60, 0x48, 0x66, 0x39,
+    0xD8, 0x8A, 0x6F, 0x57, 0x1C, 0x25, 0x3B, 0xD0, 0x35, 0x11, 0x50, 0xBE, 0x0D, 0x40, 0x1B, 0x94,
+    0x07, 0x9A, 0xA0, 0x26, 0x40, 0xC6, 0xB9, 0x74, 0x07, 0xCA, 0x83, 0xDB, 0x3D, 0x20, 0x43, 0xFE,
+    0x56, 0x3E, 0x83, 0x24, 0x60, 0xA6, 0x8A, 0x63, 0x45, 0x27, 0x48, 0xD2, 0x82, 0x24, 0x3B, 0xB4,
+    0x64, 0x00, 0x4A, 0x72, 0x07, 0x40, 0xB1, 0x9D, 0x2F, 0xEC, 0x0F, 0x50, 0x89, 0x09, 0xBA, 0x9D,
+    0xAA, 0xD4, 0x4E, 0x7A, 0x6C, 0x6F, 0x24, 0xB4, 0x1C, 0xD1, 0x26, 0x40, 0x4F, 0xA8, 0x38, 0x41,
+    0x73, 0xAA, 0x52, 0xEB, 0xF4, 0xD8, 0xBE, 0x97, 0xD0, 0xFE, 0x64, 0xC4, 0xB7, 0x0A, 0xEC, 0x6B,
+    0x8B, 0x80, 0x00, 0x0A, 0xC3, 0x67, 0x06, 0x34, 0x24, 0x6D, 0xBE, 0xDD, 0xB7, 0xD4, 0x4E, 0xD0,
+    0x35, 0x11, 0x92, 0xBE, 0x0D, 0x68, 0x19, 0x94, 0x87, 0xFA, 0x71, 0x50, 0x13, 0x28, 0xA3, 0x9A,
+    0xCA, 0x20, 0xA3, 0x72, 0xC2, 0xCB, 0xA8, 0x9C, 0x74, 0x32, 0xAA, 0xA9, 0xB5, 0x32, 0xAA, 0x49,
+    0xF5, 0x32, 0x2A, 0x4F, 0xC8, 0xD0, 0xA6, 0x80, 0x36, 0x34, 0xF4, 0x50, 0x5E, 0xD2, 0x7D, 0x64,
+    0xED, 0x4A, 0x92, 0x01, 0xE2, 0x3A, 0xB9, 0x83, 0xC2, 0xAD, 0x6A, 0x07, 0x00, 0xC5, 0xB2, 0x07,
+    0xC0, 0x61, 0x55, 0x18, 0x0B, 0xC0, 0xF4, 0x00, 0xD4, 0x4D, 0x37, 0xC9, 0x8C, 0x28, 0xF9, 0xE3,
+    0x80, 0x82, 0x17, 0xD8, 0x83, 0xA3, 0x72, 0xD0, 0xAE, 0x4E, 0x50, 0x1E, 0xB4, 0x4D, 0x40, 0xEB,
+    0x65, 0x84, 0x60, 0x45, 0xC0, 0xFC, 0x84, 0x1D, 0x64, 0xA4, 0x45, 0x41, 0x0E, 0x80, 0xA2, 0x03,
+    0x2A, 0xBA, 0xD5, 0xD3, 0xDF, 0x04, 0xCC, 0x86, 0x0B, 0x68, 0x57, 0x5A, 0xBF, 0xFC, 0xC4, 0x8D,
+    0xB4, 0x79, 0x8B, 0x0C, 0xF3, 0x41, 0x64, 0xEA, 0x14, 0xE9, 0x25, 0xC9, 0x0B, 0x24, 0x3D, 0x6D,
+    0x43, 0xE5, 0xC0, 0xDD, 0x00, 0x75, 0x8D, 0xA8, 0x23, 0xAD, 0xA0, 0x76, 0xE0, 0x6E, 0x28, 0x78,
+    0x95, 0xE4, 0x44, 0x32, 0xCC, 0x5F, 0x79, 0x5B, 0xB0, 0xFB, 0x88, 0x93, 0xA2, 0x58, 0x00, 0x68,
+    0x99, 0x00, 0x4D, 0x4E, 0xD0, 0x24, 0x3B, 0xC5, 0x1F, 0xD1, 0x35, 0x11, 0x6D, 0xA8, 0x13, 0x04,
+    0x4B, 0x76, 0xA0, 0x35, 0x03, 0x38, 0xB4, 0x13, 0x38, 0xD6, 0xB1, 0xE0, 0x58, 0xB2, 0xE3, 0x00,
+    0x33, 0x98, 0x11, 0xED, 0xD4, 0x06, 0xD4, 0xB1, 0xE2, 0x58, 0xB2, 0x33, 0x84, 0x19, 0x6A, 0x4E,
+    0xED, 0x04, 0xCD, 0x87, 0x23, 0x4A, 0xBE, 0xCF, 0x0E, 0x4D, 0x30, 0x03, 0x04, 0x4F, 0x4C, 0x00,
+    0x5F, 0x8A, 0xF2, 0x87, 0x7C, 0x9F, 0x0F, 0x92, 0xDE, 0x0C, 0x64, 0x68, 0xA7, 0x96, 0x13, 0x80,
+    0xAD, 0x59, 0xF8, 0xCD, 0x24, 0x6D, 0xC3, 0xCB, 0xA3, 0x24, 0x5D, 0xF5, 0xA6, 0x99, 0x0A, 0x57,
+    0xBE, 0x9D, 0xF7, 0x6C, 0xFD, 0x00, 0x05, 0xE9, 0x4A, 0x92, 0x50, 0xA4, 0xAB, 0xFF, 0xBE, 0x8D,
+    0x40, 0xC9, 0x0E, 0xD0, 0x23, 0x36, 0x4E, 0xF8, 0x4D, 0x32, 0xD5, 0x24, 0x9F, 0xE1, 0x75, 0xBE,
+    0xC3, 0xAE, 0xB9, 0xCE, 0xBE, 0x4A, 0x66, 0x28, 0x79, 0xD6, 0x17, 0x7C, 0x87, 0x7F, 0x4D, 0x4F,
+    0x32, 0x35, 0x0C, 0xFA, 0x09, 0x7A, 0x39, 0x16, 0x1D, 0x80, 0x4D, 0x0F, 0x54, 0x1C, 0x20, 0x7E,
+    0x11, 0x80, 0xA9, 0x05, 0xEE, 0xAD, 0x2D, 0xE4, 0x65, 0x87, 0x82, 0x0E, 0xA8, 0xC7, 0xB9, 0xCD,
+    0xFC, 0x9B, 0x0E, 0x0D, 0x89, 0x96, 0xB9, 0x95, 0xE1, 0xF9, 0x07, 0x38, 0x64, 0xAB, 0xB8, 0x4A,
+    0xC0, 0x1F, 0xB1, 0x3F, 0x41, 0x8E, 0x86, 0xF4, 0xE4, 0xD9, 0xA4, 0xA7, 0x82, 0x67, 0x3D, 0xF4,
+    0xE5, 0x88, 0xF6, 0x3A, 0xFB, 0x26, 0xE9, 0xBD, 0x13, 0x7C, 0x86, 0xE4, 0x9B, 0xE4, 0x45, 0xDF,
+    0xB0, 0x4F, 0xB8, 0x0B, 0x00, 0x36, 0x4E, 0x61, 0xE3, 0x07, 0x80, 0xE1, 0xA4, 0x38, 0xC0, 0x90,
+    0x86, 0x84, 0x24, 0x49, 0x8E, 0xE5, 0xDB, 0x35, 0xA7, 0x26, 0x02, 0xA0, 0x03, 0x7B, 0xA0, 0xF5,
+    0x68, 0x1D, 0xF0, 0x68, 0x42, 0x1D, 0x0A, 0x43, 0xE6, 0xFE, 0x8F, 0x24, 0x2F, 0xF0, 0xBA, 0x21,
+    0xF9, 0x1E, 0x87, 0xAC, 0x8F, 0x8E, 0xE5, 0x7C, 0x3C, 0x1D, 0x50, 0x27, 0xE8, 0x04, 0x3C, 0xC1,
+    0x9F, 0x1A, 0xEE, 0x3D, 0xE2, 0x14, 0x79, 0x89, 0x0C, 0x15, 0x69, 0xB3, 0x18, 0xFB, 0x8A, 0xA9,
+    0xC3, 0x31, 0x60, 0x63, 0x1B, 0xB8, 0x03, 0x00, 0xEE, 0x2B, 0x1C, 0x4A, 0x9E, 0x1D, 0x51, 0x91,
+    0x1D, 0x4A, 0x8E, 0x40, 0x4B, 0x0B, 0x41, 0x5A, 0x54, 0x6F, 0xB2, 0xC7, 0xAF, 0x96, 0xEC, 0x00,
+    0x41, 0x6C, 0xF2, 0x9D, 0x80, 0xD9, 0xC4, 0xA6, 0xD3, 0xE9, 0x2C, 0x2F, 0xB0, 0x97, 0x94, 0x01,
+    0x4D, 0xD0, 0x0E, 0xEA, 0x3D, 0x5A, 0xF0, 0x22, 0x21, 0xD8, 0x04, 0xC8, 0xA0, 0x1C, 0xF4, 0xC8,
+    0x51, 0xF0, 0x7E, 0x7E, 0xA0, 0x43, 0x49, 0xD2, 0x96, 0x64, 0x00, 0x0C, 0xBB, 0x03, 0xBE, 0x02,
+    0xB0, 0xFF, 0x5E, 0x1E, 0xEF, 0x0D, 0xD9, 0x0B, 0x67, 0x02, 0x64, 0xF7, 0x8D, 0xD5, 0xDE, 0x7F,
+    0xD3, 0x01, 0x9A, 0x23, 0x6A, 0x72, 0x82, 0x21, 0x27, 0xC1, 0xD7, 0xE8, 0xDA, 0x00, 0x0E, 0xB4,
+    0x05, 0x2F, 0xAC, 0x7F, 0x4D, 0x8F, 0x50, 0xEF, 0xB1, 0x9F, 0x2F, 0x40, 0x06, 0xC8, 0xA0, 0x26,
+    0x98, 0xD1, 0x38, 0xC1, 0x8E, 0xD7, 0xCD, 0x6A, 0x8C, 0xCA, 0x17, 0xD0, 0xCF, 0x17, 0x50, 0x8E,
+    0x40, 0x99, 0xE6, 0x47, 0xB2, 0x1D, 0xB3, 0x1B, 0x03, 0xC0, 0xE6, 0x72, 0x79, 0xAB, 0x25, 0x04,
+    0x00, 0x9B, 0x5D, 0xB6, 0x84, 0xCA, 0x34, 0xF7, 0x21, 0xCD, 0x00, 0x60, 0x5D, 0x93, 0x8D, 0x1F,
+    0xFC, 0xE7, 0xA8, 0xE6, 0x0B, 0x1D, 0x6A, 0x92, 0xD0, 0xE9, 0x04, 0x05, 0x7B, 0x1D, 0x65, 0x10,
+    0xF4, 0xDA, 0x29, 0xBE, 0xC7, 0x27, 0x22, 0x2F, 0x26, 0xF9, 0x16, 0x1B, 0x4F, 0x19, 0xF4, 0x3B,
+    0x4E, 0x39, 0xB2, 0xE7, 0x05, 0x86, 0x3A, 0xD5, 0xB4, 0x7A, 0x92, 0x3C, 0x9B, 0x7D, 0x14, 0xD0,
+    0xA4, 0x15, 0xE4, 0x84, 0xD2, 0x1E, 0xDB, 0xB7, 0x4B, 0x97, 0x00, 0x64, 0x42, 0xD6, 0xAA, 0x60,
+    0x06, 0xA0, 0x20, 0x66, 0x9B, 0xF6, 0x60, 0x6F, 0xD6, 0x04, 0xED, 0xD0, 0x4E, 0xCA, 0x41, 0xB9,
+    0xD6, 0x43, 0x8F, 0x32, 0xC0, 0x0C, 0x75, 0x00, 0x6D, 0x95, 0x0A, 0xF6, 0x82, 0x25, 0x51, 0x52,
+    0x10, 0xE0, 0xD3, 0x11, 0x30, 0x2F, 0x05, 0x40, 0xEF, 0x7A, 0x40, 0x5D, 0x99, 0x80, 0x96, 0x0E,
+    0x90, 0x1C, 0x81, 0x9A, 0x16, 0xA8, 0x68, 0xB3, 0xC3, 0x26, 0xF7, 0x24, 0x55, 0x5A, 0xF5, 0x5E,
+    0x3A, 0xCC, 0x1D, 0xA0, 0xE2, 0x08, 0x28, 0x76, 0xD9, 0x55, 0x83, 0xAD, 0xEE, 0x13, 0x4D, 0xA8,
+    0x3A, 0x16, 0x3F, 0x80, 0x79, 0x95, 0xAE, 0x8E, 0xE4, 0x60, 0x48, 0xD6, 0x7C, 0x97, 0xDE, 0x4C,
+    0x25, 0x5F, 0x22, 0x64, 0x30, 0x23, 0xF8, 0x46, 0xBA, 0xC9, 0x80, 0x1B, 0x61, 0xDE, 0x48, 0x90,
+    0xD1, 0x38, 0xF0, 0x25, 0xF6, 0x2A, 0x18, 0x92, 0x0F, 0x93, 0x74, 0xE6, 0x12, 0x43, 0x1D, 0xDB,
+    0x04, 0x33, 0x6C, 0x7D, 0xF2, 0x8F, 0xAE, 0x05, 0x74, 0xBE, 0xF4, 0x28, 0x28, 0x62, 0x2E, 0xC0,
+    0x32, 0x00, 0x77, 0x1E, 0x1C, 0xD7, 0x6E, 0x03, 0x11, 0x62, 0x63, 0xB1, 0xE8, 0x00, 0x49, 0xDA,
+    0x9B, 0xCB, 0xDB, 0x58, 0x0D, 0x2E, 0x16, 0x8B, 0x63, 0x30, 0x4C, 0x68, 0xC9, 0xBE, 0x9A, 0x1D,
+    0x74, 0x5F, 0x51, 0x87, 0x7A, 0x37, 0x8A, 0x93, 0x40, 0xD3, 0x57, 0x0E, 0x90, 0xD7, 0xCD, 0x08,
+    0x54, 0xA4, 0x05, 0x8A, 0x6C, 0x5A, 0x1D, 0x7E, 0xFB, 0xF6, 0xB6, 0x18, 0xCA, 0x93, 0xF8, 0x1D,
+    0x04, 0xB4, 0x7D, 0x7B, 0x9D, 0x56, 0x90, 0x03, 0x14, 0x07, 0x14, 0xE7, 0xBB, 0xAF, 0x70, 0xFC,
+    0xBB, 0xED, 0x8C, 0x26, 0x40, 0x0E, 0x58, 0x2B, 0x63, 0x1A, 0x98, 0x3D, 0x73, 0x00, 0x8F, 0xED,
+    0x5F, 0x6F, 0x76, 0x5D, 0x6F, 0x9E, 0xC2, 0xC6, 0x9F, 0x02, 0x9A, 0x01, 0x86, 0xB4, 0x92, 0x0C,
+    0xE5, 0x07, 0x35, 0xBB, 0xFC, 0x70, 0x37, 0x1E, 0xC5, 0x23, 0xA9, 0x30, 0xE4, 0x93, 0x24, 0xDF,
+    0x62, 0x32, 0x7B, 0x1C, 0xAA, 0x64, 0xC6, 0x82, 0x67, 0x27, 0x98, 0xCB, 0x09, 0x7A, 0x8F, 0x3F,
+    0x35, 0x49, 0x91, 0x7C, 0x9A, 0x6C, 0x46, 0x9D, 0x84, 0xC7, 0x76, 0xE9, 0x67, 0x53, 0x36, 0x00,
+    0x30, 0x00, 0xDA, 0xD7, 0xE6, 0x47, 0x95, 0x0E, 0xD8, 0x3C, 0x05, 0xE0, 0xF8, 0xC9, 0x59, 0x79,
+    0x14, 0xEC, 0xE6, 0x47, 0xB6, 0x1D, 0x3F, 0xA4, 0x40, 0x16, 0x86, 0x3B, 0xD9, 0x19, 0xAC, 0xC9,
+    0x50, 0x90, 0xF4, 0x82, 0xD3, 0xA6, 0xAB, 0xD9, 0xE1, 0x4E, 0x99, 0x30, 0xD7, 0x57, 0xF9, 0x55,
+    0xD7, 0xAD, 0xDC, 0x47, 0x14, 0xD3, 0xEA, 0x90, 0x36, 0xCC, 0xAE, 0x01, 0x48, 0x02, 0xA8, 0x39,
+    0x16, 0x7F, 0x2B, 0x48, 0x4E, 0x20, 0x39, 0xA1, 0x25, 0x27, 0x6C, 0x92, 0x43, 0x1E, 0xCA, 0x71,
+    0xE8, 0x74, 0xFE, 0x9E, 0x19, 0x51, 0xB2, 0x43, 0x15, 0xB2, 0xA7, 0x13, 0x00, 0x8A, 0xEF, 0x00,
+    0x27, 0xE8, 0x4B, 0x32, 0xD4, 0xA4, 0x97, 0x5C, 0xBA, 0x36, 0xE0, 0x4E, 0x35, 0xE5, 0xDF, 0xD4,
+    0x0E, 0xD0, 0xE3, 0xFC, 0x76, 0x79, 0x9B, 0x9A, 0x80, 0x36, 0xE2, 0xB7, 0x25, 0xAF, 0x84, 0x9A,
+    0x0C, 0x25, 0x19, 0xD0, 0x72, 0x04, 0x8E, 0x01, 0x38, 0x72, 0x72, 0xD6, 0x74, 0x4B, 0x46, 0xA0,
+    0x8E, 0xEC, 0xD0, 0x8C, 0x6A, 0x80, 0xEA, 0x66, 0x67, 0xD2, 0x6D, 0x20, 0x90, 0x43, 0xA7, 0x81,
+    0x96, 0x80, 0x66, 0x5F, 0x50, 0x8F, 0x22, 0xD4, 0xBE, 0x1E, 0x8B, 0xF0, 0xD5, 0x08, 0x64, 0x03,
+    0xC8, 0x0E, 0x0E, 0x68, 0xB7, 0x2A, 0xD4, 0x38, 0x2B, 0x0C, 0xB7, 0x4B, 0x0B, 0xD9, 0xCE, 0xAE,
+    0x19, 0x19, 0xF3, 0xBB, 0x0E, 0x40, 0xB1, 0xF3, 0xD5, 0xB4, 0x90, 0x23, 0x28, 0x4E, 0xA1, 0x1D,
+    0xE5, 0x04, 0xE9, 0xF5, 0x00, 0x41, 0x76, 0x00, 0x13, 0x00, 0xED, 0x6F, 0x17, 0x81, 0x1C, 0xDA,
+    0xC1, 0xF1, 0x22, 0xC1, 0xF4, 0xAD, 0x63, 0x5F, 0x92, 0x3D, 0x14, 0x2D, 0xC4, 0x6A, 0x78, 0xDD,
+    0x38, 0x05, 0x9C, 0xA0, 0x87, 0x21, 0x61, 0xC8, 0x5E, 0xA5, 0x33, 0xB6, 0x0D, 0xB8, 0x53, 0xC6,
+    0x3C, 0x7C, 0x17, 0xB4, 0x59, 0x20, 0x8D, 0x07, 0x2A, 0xCE, 0x2A, 0xA4, 0x9A, 0x80, 0x9A, 0xDD,
+    0x21, 0x30, 0xD1, 0xB6, 0xB9, 0xF7, 0x0E, 0xA8, 0xE9, 0x81, 0x8D, 0x0E, 0xC5, 0x69, 0x1C, 0xDA,
+    0x81, 0x1A, 0x1A, 0x07, 0x91, 0x5A, 0xB7, 0x36, 0x1C, 0xA7, 0x75, 0x3F, 0xB7, 0x7A, 0x29, 0x5E,
+    0xEF, 0x20, 0x49, 0x76, 0x82, 0xA4, 0x07, 0x49, 0x5A, 0xF5, 0xC1, 0x23, 0xF4, 0x32, 0xA0, 0xC9,
+    0x0A, 0xC7, 0x48, 0x8B, 0x36, 0x28, 0x07, 0xC1, 0xA3, 0x01, 0xE0, 0xAB, 0x04, 0x94, 0xA7, 0x85,
+    0x4C, 0xCA, 0x41, 0xF0, 0x99, 0x00, 0xF0, 0x2D, 0x02, 0x6A, 0xA2, 0xCD, 0xFA, 0x78, 0x4D, 0x19,
+    0x50, 0xF1, 0x29, 0xA2, 0xA2, 0xA5, 0x7D, 0x94, 0x83, 0x22, 0x39, 0x4A, 0x92, 0xA3, 0x98, 0x3D,
+    0x2A, 0xD9, 0xBD, 0xB1, 0xD5, 0x2D, 0x3A, 0xA0, 0xF1, 0x6A, 0x04, 0xAA, 0x24, 0x1D, 0x50, 0xF0,
+    0x69, 0x0F, 0x40, 0xFF, 0x24, 0x00, 0x68, 0x7C, 0x5C, 0x69, 0x30, 0x5F, 0xBF, 0x9F, 0x3D, 0xC0,
+    0xA0, 0x47, 0x80, 0xBC, 0xE4, 0x81, 0x1C, 0x6C, 0xD1, 0xE9, 0x2C, 0x7B, 0xA8, 0x50, 0x70, 0x84,
+    0x8C, 0x68, 0x3D, 0x2A, 0xA2, 0x4A, 0x28, 0x68, 0xC1, 0x1E, 0x7A, 0x84, 0x1A, 0xD1, 0x78, 0x48,
+    0x8F, 0x8A, 0x10, 0x09, 0x05, 0x6D, 0xC1, 0x1E, 0x6A, 0x82, 0x19, 0x21, 0x09, 0xED, 0x51, 0x30,
+    0x31, 0x61, 0x76, 0xF6, 0x08, 0x52, 0x8D, 0x40, 0x9B, 0x2A, 0x9F, 0x5B, 0x33, 0x70, 0x5B, 0x79,
+    0x84, 0xB6, 0x3A, 0xE4, 0xD6, 0x80, 0x2A, 0x01, 0x9B, 0x67, 0xF8, 0x33, 0x94, 0x24, 0x01, 0x43,
+    0x5A, 0xDC, 0x7D, 0x86, 0x27, 0x81, 0x82, 0x3D, 0x36, 0xB6, 0xF5, 0x08, 0xC5, 0xC6, 0x43, 0xF3,
+    0x5A, 0xCA, 0xD7, 0xDD, 0xF2, 0x0C, 0x47, 0x49, 0x68, 0x2F, 0xD8, 0xD7, 0x29, 0x8B, 0x42, 0x3B,
+    0xA8, 0xB1, 0x09, 0x90, 0xBE, 0x22, 0x44, 0x2A, 0x38, 0x80, 0xBD, 0xF2, 0x30, 0xA3, 0x64, 0xA7,
+    0x7C, 0xC9, 0xC4, 0xF9, 0xEB, 0x82, 0x49, 0x8D, 0x68, 0x63, 0xED, 0xB3, 0x60, 0xB6, 0x16, 0x8B,
+    0x07, 0x48, 0xDF, 0x92, 0x4F, 0x90, 0xD3, 0xCA, 0xCE, 0x22, 0xAF, 0x90, 0x69, 0xB5, 0x78, 0x6D,
+    0x71, 0x34, 0x00, 0xB4, 0x90, 0xF3, 0x22, 0x2E, 0x8E, 0x91, 0xDC, 0x25, 0x03, 0xC9, 0xDD, 0xB4,
+    0x3C, 0x7D, 0x60, 0xDF, 0x81, 0xC5, 0x4D, 0x67, 0x29, 0x16, 0x8B, 0x63, 0x68, 0xB3, 0xC7, 0xC7,
+    0xA3, 0x21, 0xE7, 0xFE, 0xEE, 0xEE, 0xED, 0x6C, 0xB6, 0xB5, 0xA4, 0xAD, 0x49, 0x82, 0xA3, 0x9A,
+    0x5A, 0x0F, 0x5E, 0x20, 0xAA, 0xA0, 0x1C, 0xF4, 0xEB, 0x24, 0xA3, 0x26, 0x99, 0x57, 0x56, 0x91,
+    0x5E, 0x35, 0x01, 0x25, 0x2D, 0xEE, 0x94, 0xFC, 0xA1, 0xE9, 0x34, 0x39, 0x15, 0xB3, 0x7B, 0x67,
+    0x00, 0xB6, 0x80, 0x23, 0x28, 0xFF, 0xCA, 0xE1, 0xF9, 0xF6, 0x3A, 0x2D, 0x39, 0x09, 0x46, 0x6C,
+    0xAE, 0xFD, 0x71, 0x5F, 0x45, 0x05, 0xCB, 0x93, 0xF8, 0x1D, 0x28, 0xD4, 0x63, 0xC9, 0xB3, 0x01,
+    0x92, 0xEC, 0xA0, 0x38, 0x00, 0x27, 0xE6, 0x9E, 0xF3, 0xAB, 0xAB, 0x29, 0x36, 0x00, 0x11, 0x01,
+    0x33, 0xA2, 0x66, 0x76, 0x9D, 0x6F, 0x7F, 0x95, 0x35, 0xCD, 0xA7, 0xD7, 0x43, 0x76, 0xEE, 0xC3,
+    0x8C, 0xD9, 0xE3, 0x9F, 0xC7, 0xB6, 0xAF, 0xB4, 0xA6, 0x5F, 0x4D, 0x6D, 0x54, 0x07, 0x39, 0xA0,
+    0x08, 0x80, 0xEA, 0x21, 0xE2, 0x36, 0xDA, 0x04, 0x70, 0x44, 0xF1, 0x2C, 0x8A, 0xFF, 0x00, 0x54,
+    0x4C, 0x28, 0x99, 0x35, 0x49, 0x27, 0x93, 0xE0, 0x03, 0xEC, 0x65, 0x50, 0x0E, 0xE6, 0x02, 0x51,
+    0x1D, 0xA8, 0x05, 0xC9, 0xD7, 0xF7, 0xC1, 0x08, 0x1D, 0xD0, 0x06, 0x14, 0xE0, 0xDE, 0x23, 0x53,
+    0x45, 0xB2, 0x6B, 0xF2, 0xC8, 0x92, 0x80, 0x0D, 0xDD, 0xCF, 0x1E, 0xA4, 0x00, 0xA0, 0xB5, 0x40,
+    0x19, 0x00, 0x34, 0xCC, 0x4E, 0x1D, 0x94, 0x09, 0xDF, 0x41, 0xF9, 0xEF, 0x09, 0xF3, 0x04, 0x8F,
+    0xFA, 0x82, 0xB4, 0x25, 0x03, 0xCA, 0xD9, 0x42, 0xCA, 0x77, 0xF5, 0x2D, 0x92, 0xCF, 0x90, 0x49,
+    0x91, 0x9E, 0xAF, 0x2D, 0x1E, 0x64, 0x56, 0x37, 0x95, 0x03, 0x68, 0x21, 0xB8, 0x58, 0xC8, 0xEC,
+    0xE4, 0x73, 0x24, 0x2F, 0x70, 0xB9, 0xBC, 0x69, 0xEF, 0x81, 0x83, 0x6F, 0x3E, 0xD5, 0xE6, 0x0E,
+    0x8E, 0xE4, 0x71, 0x87, 0x0F, 0x07, 0x54, 0xD9, 0xDF, 0x6F, 0x01, 0x33, 0x7D, 0xE5, 0xAD, 0x18,
+    0x77, 0x9F, 0x02, 0x20, 0xD9, 0x01, 0x92, 0x13, 0x50, 0xEF, 0x11, 0xA8, 0x7D, 0xE3, 0x50, 0x4D,
+    0x38, 0x7F, 0x93, 0x75, 0x76, 0x82, 0x6F, 0xA3, 0x64, 0xF6, 0x79, 0x64, 0x33, 0xD1, 0x0B, 0xEE,
+    0x15, 0xE7, 0xCA, 0xEC, 0x59, 0x5D, 0x6B, 0x56, 0x6D, 0x40, 0x56, 0x61, 0x20, 0xD8, 0x6D, 0x2D,
+    0xB6, 0x69, 0x25, 0xA3, 0x72, 0x82, 0x3C, 0x1A, 0x40, 0xBE, 0xCA, 0x4E, 0x71, 0xE2, 0x88, 0x2A,
+    0xB6, 0x01, 0x05, 0x1F, 0x62, 0x07, 0x3D, 0xD0, 0xA1, 0x99, 0x1A, 0x76, 0x75, 0x2C, 0x99, 0xBD,
+    0x9E, 0xE4, 0x50, 0x92, 0x9C, 0x50, 0x93, 0x6F, 0xCF, 0x3A, 0x52, 0xF9, 0xEC, 0xAC, 0xD9, 0x2A,
+    0x0E, 0xA8, 0x23, 0x51, 0xA6, 0x2A, 0x40, 0x77, 0x2B, 0xC7, 0xE0, 0x9F, 0x02, 0x60, 0x54, 0xA3,
+    0xE2, 0xB5, 0x24, 0x49, 0xBE, 0xC9, 0x3D, 0x93, 0x54, 0x00, 0xDF, 0x62, 0x57, 0x27, 0xED, 0xA0,
+    0xDF, 0x21, 0x44, 0xD2, 0x23, 0xD4, 0x3B, 0x09, 0x22, 0x69, 0x07, 0xF5, 0x0E, 0x21, 0x92, 0x9A,
+    0x60, 0xDE, 0xA2, 0x6D, 0x52, 0xC3, 0xB3, 0x1C, 0x49, 0x26, 0x41, 0xEA, 0xB1, 0xE6, 0xD3, 0x09,
+    0x1B, 0x9D, 0x1E, 0xE7, 0xA7, 0x8E, 0x2F, 0xBF, 0x0D, 0x1D, 0x1A, 0x92, 0x4F, 0x90, 0x74, 0x0D,
+    0xE9, 0xF1, 0xBB, 0xFC, 0x19, 0x70, 0xA8, 0xC7, 0x69, 0x94, 0x13, 0x34, 0xA0, 0xDF, 0xCD, 0xB0,
+    0x19, 0x3B, 0x3B, 0xB2, 0xCA, 0xFF, 0x1D, 0xB7, 0x99, 0x18, 0xCB, 0x93, 0x38, 0x82, 0xB6, 0xAB,
+    0x5C, 0xC1, 0x33, 0x31, 0x5F, 0x6A, 0xCB, 0x11, 0xF8, 0xDD, 0x93, 0xF8, 0x25, 0x8B, 0x11, 0x45,
+    0x07, 0x40, 0x24, 0xCC, 0x0A, 0x5C, 0x96, 0x84, 0xF4, 0x00, 0xF0, 0x6F, 0x6F, 0x37, 0x31, 0xE6,
+    0x1E, 0x59, 0x0D, 0xB3, 0x7E, 0xA9, 0xDD, 0x7C, 0xE5, 0x6B, 0xA3, 0xE2, 0x97, 0x27, 0x46, 0x00,
+    0xC0, 0x61, 0xEE, 0x01, 0x66, 0x46, 0x39, 0x85, 0xAC, 0xF6, 0x31, 0x75, 0x27, 0x60, 0x02, 0x00,
+    0x15, 0x56, 0x91, 0x90, 0x9A, 0x98, 0xBB, 0x4E, 0x70, 0xD8, 0x58, 0x1C, 0x3B, 0x28, 0x1C, 0x28,
+    0x4E, 0x1C, 0x24, 0xA3, 0xF2, 0x28, 0xF8, 0x30, 0x01, 0xFD, 0x32, 0x07, 0x34, 0x93, 0x0A, 0xA8,
+    0x62, 0xC5, 0xA1, 0x64, 0x67, 0x48, 0x0E, 0x92, 0xB3, 0x63, 0x35, 0xA2, 0x24, 0xF7, 0x72, 0xC8,
+    0x79, 0xA5, 0x2D, 0x3B, 0x00, 0x72, 0x42, 0x8E, 0x3F, 0x67, 0x9C, 0x0A, 0xCC, 0x3E, 0x5E, 0xE8,
+    0x6E, 0xCC, 0x8E, 0x5D, 0x03, 0x40, 0xBA, 0xD9, 0x7F, 0xAB, 0x86, 0x83, 0x62, 0x0C, 0xBF, 0x04,
+    0x31, 0x96, 0x4B, 0xCC, 0xAE, 0xC1, 0x86, 0x23, 0xA0, 0x2F, 0xCD, 0x2E, 0x49, 0xE1, 0x67, 0x47,
+    0xC8, 0x3C, 0x2E, 0x58, 0x54, 0x91, 0x16, 0x75, 0xFA, 0x2C, 0xC5, 0x6B, 0x8B, 0x47, 0x13, 0x99,
+    0x47, 0xC2, 0x55, 0xF1, 0xEE, 0xF2, 0x6C, 0xFA, 0xCC, 0x27, 0x58, 0x17, 0x38, 0xBE, 0xB3, 0xEA,
+    0xBA, 0x05, 0x03, 0x00, 0x9E, 0x75, 0x80, 0x1A, 0xB4, 0x45, 0xE5, 0x90, 0x0E, 0xC6, 0xFE, 0x67,
+    0x58, 0x4C, 0xF6, 0xAF, 0x7E, 0xDC, 0xEA, 0xD7, 0x3B, 0xD4, 0x51, 0xB1, 0x87, 0xB9, 0x44, 0xA2,
+    0x26, 0xE9, 0x61, 0xF8, 0x23, 0xDA, 0x9A, 0x7D, 0x13, 0x60, 0x1C, 0x38, 0xD4, 0x84, 0x8C, 0x30,
+    0x23, 0xCC, 0x50, 0x27, 0xD4, 0x11, 0x66, 0x80, 0x19, 0xEA, 0xF8, 0xD9, 0x57, 0x05, 0x81, 0x66,
+    0x82, 0x72, 0x28, 0xD9, 0x0B, 0x02, 0xAD, 0x3F, 0x64, 0xAE, 0x2F, 0xCF, 0xF0, 0xE7, 0x39, 0x7C,
+    0x72, 0x85, 0x24, 0x99, 0xCE, 0x70, 0xB9, 0x34, 0x69, 0xE7, 0xE0, 0x61, 0x50, 0xD7, 0x97, 0x67,
+    0xD8, 0x0B, 0x92, 0xF4, 0x50, 0xB3, 0x29, 0x71, 0xD3, 0x87, 0x7C, 0xD8, 0x4D, 0xDF, 0xF9, 0x3C,
+    0x1F, 0x8A, 0x63, 0x2B, 0xAB, 0xA9, 0x4A, 0x00, 0xCE, 0x72, 0xD9, 0x61, 0x65, 0xB6, 0xF4, 0x38,
+    0xC3, 0x65, 0xB7, 0xDA, 0x5B, 0x9C, 0x42, 0x15, 0x5B, 0xF6, 0x55, 0x24, 0x5D, 0x45, 0xD2, 0x57,
+    0xDC, 0x33, 0xA1, 0xA2, 0x6D, 0x62, 0x45, 0xC8, 0x58, 0x11, 0x75, 0xAC, 0xD2, 0xE7, 0x2D, 0x00,
+    0x40, 0xFA, 0x6A, 0x60, 0x32, 0x35, 0xE9, 0x55, 0x4D, 0x3B, 0x15, 0x6B, 0x3F, 0x69, 0x99, 0x8D,
+    0x41, 0xAB, 0x48, 0x9C, 0xE0, 0x88, 0x8F, 0xD3, 0x2E, 0x3E, 0xCB, 0x47, 0xC3, 0x7E, 0x75, 0x2A,
+    0x32, 0x00, 0x80, 0x1E, 0x54, 0xC3, 0xCB, 0x6F, 0x91, 0xE1, 0xF1, 0xC3, 0x7C, 0xC8, 0xD6, 0x3B,
+    0x07, 0x3C, 0xED, 0x75, 0xFA, 0xC2, 0x8B, 0xAD, 0xC5, 0x42, 0x91, 0xF9, 0x3F, 0x9F, 0xAF, 0x65,
+    0xCA, 0x1F, 0x0F, 0xD3, 0x83, 0xF6, 0x73, 0xFD, 0xD7, 0xF4, 0xEB, 0xB3, 0x2D, 0x16, 0x0B, 0xC3,
+    0x64, 0x98, 0x34, 0xE3, 0x4A, 0x40, 0xFD, 0x17, 0xF8, 0xFF, 0x33, 0x1C, 0x7A, 0x7A, 0x2C, 0x82,
+    0x7A, 0x97, 0x4F, 0x92, 0xAE, 0x66, 0xC0, 0xA1, 0xB5, 0xD1, 0xD2, 0x32, 0x09, 0xD2, 0x29, 0xB2,
+    0x30, 0xEC, 0xF1, 0xD1, 0xAA, 0xED, 0xA7, 0x2E, 0x6A, 0xFA, 0xF9, 0x2C, 0x82, 0x74, 0xD9, 0x48,
+    0x3A, 0xFF, 0x91, 0x46, 0xD2, 0x3F, 0x52, 0xD8, 0x86, 0x37, 0x48, 0x92, 0x6F, 0xD0, 0x0B, 0x42,
+    0x06, 0x28, 0x07, 0xDA, 0x4F, 0x5D, 0x6D, 0xF9, 0x16, 0xE7, 0x17, 0xE4, 0x80, 0x88, 0xCA, 0x41,
+    0xF5, 0xE0, 0xB1, 0x92, 0xA3, 0x60, 0x5F, 0x3C, 0x5B, 0x74, 0xFA, 0x15, 0x7E, 0x3F, 0x35, 0xD3,
+    0x06, 0x00, 0xB4, 0xDE, 0xFC, 0x84, 0xDF, 0x4F, 0x1F, 0xB7, 0x18, 0xCF, 0xD7, 0xA3, 0x2A, 0x43,
+    0xFD, 0xC1, 0xA3, 0x54, 0xE1, 0xEE, 0x1D, 0xDC, 0x89, 0xDA, 0xAF, 0x7F, 0x72, 0xE5, 0xD3, 0xFA,
+    0x12, 0xAE, 0xB4, 0x4E, 0xE6, 0xF2, 0xC7, 0xFC, 0x8F, 0x86, 0xBE, 0xA4, 0x26, 0x61, 0x2E, 0x91,
+    0xB6, 0xFD, 0xC0, 0xB0, 0xAF, 0xA3, 0x20, 0x4A, 0x76, 0xB4, 0x30, 0x83, 0x72, 0x68, 0x27, 0x19,
+    0xF0, 0x8F, 0xDE, 0xD8, 0x72, 0x3C, 0xF8, 0x43, 0xD7, 0x48, 0x57, 0xC7, 0xFD, 0x01, 0xD5, 0x02,
+    0x8B, 0x1C, 0x3A, 0x9A, 0x00, 0x49, 0x0F, 0x08, 0x7A, 0x00, 0x7C, 0x1B, 0x1B, 0xC0, 0xB6, 0x1E,
+    0x44, 0x34, 0x63, 0x45, 0x33, 0xD6, 0xD4, 0x83, 0x48, 0x1B, 0x07, 0xF4, 0x1C, 0x33, 0x56, 0xE9,
+    0xCB, 0x78, 0xE7, 0xDE, 0xAC, 0x4A, 0x79, 0xB8, 0x6B, 0x22, 0x6A, 0x86, 0xF9, 0xED, 0x50, 0xB1,
+    0xCB, 0xBE, 0xE9, 0x04, 0x18, 0x76, 0x25, 0xF5, 0x50, 0x79, 0x39, 0xC9, 0xA1, 0x0C, 0xEB, 0x26,
+    0x29, 0xC3, 0x57, 0xFF, 0x6E, 0x3D, 0xB6, 0xCC, 0x04, 0x4D, 0x07, 0xCD, 0x01, 0x9A, 0x5D, 0xF6,
+    0x45, 0x1E, 0xDF, 0x41, 0x43, 0x08, 0x06, 0xF0, 0xAC, 0x53, 0x83, 0x79, 0x69, 0x2C, 0xD6, 0x41,
+    0x42, 0x33, 0xA0, 0x8E, 0x5F, 0xC6, 0xA2, 0x89, 0x20, 0xAD, 0xA4, 0x07, 0x13, 0xEA, 0xD4, 0x81,
+    0x16, 0xAD, 0xA7, 0x85, 0x71, 0xB4, 0x05, 0x07, 0x5A, 0xC1, 0x8E, 0x56, 0x26, 0xD0, 0xB6, 0x01,
+    0xB4, 0xC6, 0x81, 0x2F, 0x70, 0x40, 0xC6, 0xA2, 0xEC, 0x26, 0x80, 0x57, 0x02, 0x40, 0x46, 0x80,
+    0x24, 0xE6, 0x51, 0xE3, 0x17, 0xB4, 0xA0, 0xA5, 0x03, 0xAD, 0x9E, 0x56, 0xDF, 0x95, 0x09, 0xB4,
+    0x15, 0x3B, 0x5A, 0x41, 0x4B, 0x9B, 0x1D, 0x85, 0xC6, 0xD1, 0x66, 0x95, 0x6C, 0x8D, 0xDB, 0x89,
+    0x00, 0xAA, 0x00, 0xA0, 0xF6, 0xB3, 0x5A, 0x94, 0x43, 0x31, 0x1B, 0x5D, 0xF6, 0x65, 0x15, 0xEC,
+    0xE7, 0x71, 0xAA, 0xF1, 0xC8, 0xBE, 0xCE, 0x0F, 0x6F, 0xE2, 0x9B, 0xEC, 0x65, 0xAA, 0x12, 0x38,
+    0x36, 0x5E, 0x12, 0x7A, 0x34, 0xAE, 0xE0, 0xF7, 0x89, 0x2A, 0x6A, 0x87, 0xE6, 0x06, 0x3B, 0x68,
+    0x26, 0x14, 0x64, 0x44, 0x45, 0x06, 0x34, 0xA9, 0x0D, 0xD0, 0xA3, 0xF2, 0x05, 0x7B, 0x3D, 0x55,
+    0x09, 0xC6, 0x35, 0x1E, 0x74, 0xF3, 0xB9, 0x8A, 0x7D, 0x73, 0x78, 0xBE, 0xBA, 0xD6, 0x01, 0x60,
+    0x37, 0xEB, 0x76, 0x8D, 0x05, 0x72, 0xF0, 0x2F, 0x63, 0x56, 0x4B, 0x3E, 0x9D, 0xD0, 0xFA, 0xC6,
+    0x17, 0xB4, 0x7A, 0x6C, 0x42, 0xC1, 0x9E, 0xB6, 0x4A, 0x32, 0xA2, 0xF1, 0x1C, 0xA0, 0x2F, 0x27,
+    0x14, 0xE4, 0x84, 0x8A, 0x74, 0xC8, 0xF0, 0xC6, 0xC8, 0xB1, 0x60, 0xCF, 0xA1, 0x4A, 0x05, 0x6D,
+    0xE3, 0x4B, 0x5A, 0x3D, 0x0A, 0x3E, 0xC1, 0x5E, 0xF0, 0xE9, 0x84, 0x8A, 0x1D, 0x8E, 0x9F, 0x44,
+    0xC1, 0x61, 0x3D, 0xA8, 0xB5, 0x63, 0x86, 0x3D, 0xAF, 0xD5, 0xCD, 0x71, 0x76, 0x81, 0x7F, 0x59,
+    0xEF, 0x6C, 0xA5, 0xAF, 0xDF, 0x07, 0x51, 0xCE, 0xF5, 0x98, 0x35, 0x2C, 0x33, 0xD4, 0xF1, 0x8B,
+    0x17, 0x5F, 0xFD, 0x25, 0xAF, 0x5E, 0x75, 0xC8, 0xE6, 0x94, 0x74, 0x40, 0x33, 0x66, 0x37, 0xC8,
+    0x06, 0xB0, 0xF5, 0x70, 0x34, 0x6F, 0x7C, 0xFA, 0x3F, 0x00, 0xF5, 0x56, 0x54, 0x17, 0xA7, 0xF3,
+    0x1B, 0x9D, 0x1A, 0xC1, 0xA3, 0x01, 0xFA, 0x02, 0xD1, 0x0E, 0xB4, 0xB5, 0x53, 0x4E, 0x4C, 0x32,
+    0xE0, 0x94, 0x58, 0x3B, 0xDB, 0x6F, 0xC2, 0x4B, 0x7D, 0xB6, 0x0D, 0x64, 0x92, 0x24, 0x9F, 0x62,
+    0x4E, 0x7B, 0xF1, 0x5B, 0xDD, 0xA2, 0x9D, 0xD4, 0x1B, 0xB1, 0x79, 0x9F, 0x0F, 0x4F, 0xE6, 0x95,
+    0xD0, 0x4E, 0xA1, 0x8E, 0x28, 0xD9, 0xC1, 0x0C, 0x68, 0x27, 0x7C, 0x91, 0x0F, 0x9F, 0x41, 0xDA,
+    0x45, 0xA7, 0x9C, 0x9C, 0x94, 0x6B, 0xBD, 0x72, 0x6D, 0x50, 0xAE, 0x99, 0xF2, 0xB6, 0xCF, 0x26,
+    0xED, 0xAD, 0x2E, 0xAB, 0xBA, 0x1F, 0xF7, 0xBF, 0x6D, 0x5E, 0x8D, 0xE6, 0x0D, 0x9A, 0x37, 0x68,
+    0x5E, 0x8F, 0x66, 0xF8, 0x93, 0x4F, 0x3C, 0x78, 0xF6, 0xE3, 0xAC, 0x1D, 0x3A, 0x1F, 0x5E, 0x79,
+    0xAF, 0x83, 0xE0, 0xB9, 0x8C, 0x4E, 0x10, 0x64, 0x46, 0x28, 0x34, 0xEC, 0x51, 0xD3, 0x01, 0x9A,
+    0x39, 0x17, 0x26, 0x1B, 0xA9, 0xB7, 0x7C, 0x9D, 0x1C, 0x55, 0x36, 0x8B, 0xF2, 0x0A, 0x16, 0x28,
+    0xD8, 0x7F, 0xFC, 0xFF, 0xC9, 0x82, 0x53, 0xC1, 0x50, 0x30, 0x56, 0x1C, 0x15, 0x7B, 0xC5, 0xBE,
+    0x61, 0x7F, 0xE8, 0x63, 0x8E, 0x5F, 0x81, 0xFB, 0xD4, 0xB4, 0x32, 0xC1, 0x4B, 0x62, 0x85, 0xEE,
+    0x93, 0xC3, 0x4D, 0xE6, 0x3C, 0x27, 0x40, 0xEF, 0xD2, 0xA2, 0x0A, 0x4C, 0x80, 0xDE, 0xE5, 0x84,
+    0x2A, 0x90, 0x16, 0x7A, 0x97, 0x11, 0x55, 0xA0, 0x71, 0xD0, 0xBB, 0xD7, 0xD8, 0x57, 0x81, 0x47,
+    0x03, 0xF4, 0xEE, 0x64, 0x5C, 0x15, 0xF8, 0x20, 0x3B, 0xBD, 0x3B, 0xB5, 0xA1, 0x0A, 0xEC, 0x38,
+    0xE8, 0x5D, 0x5F, 0xB1, 0x0A, 0xEC, 0x95, 0xD7, 0xBB, 0x1E, 0xBC, 0x18, 0xD8, 0xD7, 0xD4, 0xBB,
+    0x1E, 0xEA, 0x46, 0x60, 0x5F, 0x90, 0xBB, 0x1E, 0x92, 0x81, 0x3D, 0x34, 0x77, 0x3D, 0x4A, 0x06,
+    0xF6, 0x90, 0xDC, 0xF5, 0x80, 0x09, 0xC0, 0xA1, 0x67, 0xB3, 0xBB, 0x0C, 0x66, 0x8E, 0x1C, 0x89,
+    0x08, 0xEC, 0xBB, 0xC1, 0x8A, 0x53, 0x30, 0x4F, 0xD1, 0xD7, 0x81, 0x74, 0x86, 0xE4, 0xF7, 0xB9,
+    0x67, 0x82, 0xF1, 0x05, 0x5F, 0xE2, 0x8C, 0x7B, 0xB9, 0x05, 0x12, 0xF3, 0x19, 0x56, 0x6E, 0x8F,
+    0x8A, 0x1F, 0x78, 0x69, 0x3B, 0xF7, 0x13, 0xB9, 0x5B, 0xCF, 0x23, 0x4F, 0x8E, 0xCC, 0x66, 0x5F,
+    0xF3, 0xDD, 0x5D, 0xED, 0x15, 0x7B, 0xB3, 0x4B, 0xD6, 0x24, 0xBD, 0xE1, 0x8F, 0xF8, 0x12, 0xFB,
+    0x26, 0x18, 0x07, 0xBE, 0xC1, 0x9C, 0xC2, 0xF1, 0xD9, 0x05, 0x90, 0x5B, 0xF9, 0x4D, 0xBD, 0xB7,
+    0x08, 0x00, 0x74, 0x0F, 0xD4, 0x6E, 0x86, 0x1B, 0x6C, 0x74, 0x00, 0x4E, 0x63, 0x73, 0x07, 0xB5,
+    0x17, 0x11, 0x68, 0xDF, 0x63, 0x07, 0x30, 0x07, 0xFD, 0x3D, 0x80, 0x26, 0xDD, 0x76, 0xCD, 0x69,
+    0x73, 0x07, 0x47, 0xA0, 0x6D, 0x3B, 0x16, 0x3C, 0xEA, 0xB3, 0x57, 0xB7, 0xBD, 0xC9, 0xAB, 0xFB,
+    0x55, 0x34, 0xA7, 0x2A, 0x60, 0xFD, 0x9C, 0x65, 0x20, 0xEB, 0xEC, 0x48, 0x69, 0x1C, 0x00, 0x54,
+    0x1E, 0xB8, 0xBB, 0x2B, 0x63, 0x33, 0x1A, 0x82, 0x55, 0x20, 0xDD, 0x56, 0x31, 0x43, 0xCA, 0xF9,
+    0x23, 0x5A, 0x34, 0xCC, 0xC0, 0x62, 0xC8, 0x88, 0x82, 0xB6, 0x64, 0x07, 0xED, 0x60, 0x06, 0x34,
+    0x1E, 0xED, 0x84, 0x6C, 0xA4, 0x16, 0xEC, 0x4B, 0x76, 0xD0, 0xE3, 0x67, 0xDD, 0x41, 0x0F, 0xE8,
+    0x5D, 0x0E, 0xA8, 0x02, 0x09, 0xE8, 0x5D, 0x7A, 0x54, 0x81, 0x1C, 0xA0, 0x77, 0x49, 0x54, 0x81,
+    0x26, 0x40, 0xEF, 0xFE, 0x82, 0x63, 0x15, 0x78, 0x94, 0xD0, 0xBB, 0x93, 0x0E, 0x55, 0xE0, 0x03,
+    0x1C, 0xF5, 0xEE, 0x24, 0xF9, 0x50, 0x60, 0xAF, 0x82, 0xDE, 0xF5, 0x05, 0xDF, 0x09, 0xEC, 0x25,
+    0xCD, 0xAE, 0x87, 0xE2, 0xFA, 0x1E, 0xD4, 0x0C, 0xEC, 0xA1, 0xB8, 0xEB, 0x51, 0x30, 0xB0, 0x47,
+    0xCD, 0x5D, 0x0F, 0xA8, 0xC0, 0x1E, 0x05, 0x77, 0xFD, 0xAA, 0x41, 0xEF, 0xB7, 0xED, 0xFC, 0x94,
+    0x73, 0x02, 0x6A, 0x26, 0xCC, 0xAE, 0xDA, 0x8A, 0x3D, 0x80, 0xAF, 0xCF, 0xED, 0xFB, 0xD2, 0x97,
+    0xDA, 0xBE, 0xD7, 0x20, 0x37, 0x19, 0xF3, 0xAF, 0xD7, 0x2B, 0xAC, 0x65, 0xCD, 0x11, 0xD0, 0x6F,
+    0xE7, 0xA4, 0x25, 0xA0, 0x22, 0xC7, 0x9B, 0xCB, 0xDB, 0x1F, 0xA9, 0xBE, 0x58, 0x1C, 0x83, 0x20,
+    0x5D, 0xC6, 0xBF, 0xAD, 0x0D, 0x7D, 0x6C, 0xFC, 0x20, 0x47, 0x72, 0x60, 0x66, 0xD8, 0x51, 0xA7,
+    0xE2, 0xA3, 0x2C, 0x69, 0x65, 0x94, 0x01, 0x4D, 0x50, 0x6B, 0x58, 0x6A, 0x82, 0x60, 0xE3, 0x21,
+    0x83, 0x76, 0x50, 0x2E, 0x27, 0x7B, 0x76, 0x75, 0xAA, 0x09, 0x35, 0x49, 0x9E, 0x99, 0x11, 0x97,
+    0x0D, 0x69, 0x73, 0xB8, 0x1E, 0xC7, 0x30, 0x7B, 0xDD, 0x51, 0x0F, 0xA5, 0x07, 0xAA, 0x74, 0x76,
+    0x02, 0xC4, 0x2A, 0x0D, 0xAF, 0x07, 0x70, 0xF7, 0xCF, 0xF0, 0xCF, 0x40, 0x78, 0xC5, 0x49, 0x1C,
+    0x41, 0x35, 0x16, 0x21, 0x63, 0xE4, 0xDA, 0xDC, 0x4F, 0x38, 0x1C, 0x70, 0x42, 0x7C, 0xC5, 0x28,
+    0x5B, 0x2C, 0xFF, 0xD5, 0x69, 0x64, 0xF9, 0xA3, 0x8A, 0x6A, 0x04, 0xA4, 0x33, 0x3D, 0xD0, 0xBE,
+    0x10, 0x01, 0xDC, 0x57, 0xBA, 0x7F, 0x0E, 0x62, 0xC4, 0x91, 0x7F, 0xBF, 0x44, 0xC9, 0xA3, 0x01,
+    0x72, 0x32, 0x16, 0x7C, 0x28, 0xA0, 0x9A, 0x54, 0x8F, 0xFB, 0x8A, 0xE9, 0x9F, 0x4A, 0x8C, 0x87,
+    0x9E, 0x5D, 0xC5, 0x1B, 0xB4, 0x03, 0xC0, 0x7E, 0xD6, 0x1F, 0xEA, 0xF1, 0x43, 0xD8, 0x11, 0x45,
+    0x4E, 0x50, 0x5C, 0x01, 0x04, 0x94, 0x3B, 0x4C, 0xAB, 0x5C, 0xC1, 0x41, 0x39, 0xDC, 0x5C, 0x14,
+    0xB4, 0xCA, 0xD5, 0xEC, 0xD5, 0x8C, 0x33, 0xF4, 0x50, 0x19, 0x8A, 0x48, 0x07, 0xE5, 0xD4, 0x04,
+    0xE5, 0x9A, 0x00, 0xE5, 0xEA, 0x04, 0xE5, 0x04, 0x3B, 0xE5, 0x4A, 0x5A, 0xE5, 0xE6, 0x0C, 0x89,
+    0x49, 0x39, 0xA8, 0xA0, 0x1C, 0x64, 0x42, 0xB1, 0xEC, 0xA1, 0x27, 0xC8, 0x90, 0xFD, 0x7F, 0x7D,
+    0x46, 0x47, 0x03, 0x28, 0x76, 0xCC, 0x03, 0x7C, 0xD8, 0x9B, 0xC9, 0x5C, 0x61, 0x4D, 0x3A, 0xC3,
+    0xFB, 0x6B, 0xF6, 0x30, 0x2E, 0x3B, 0x96, 0x3E, 0xDD, 0x84, 0xFE, 0xA5, 0x55, 0xE9, 0x40, 0x9B,
+    0xE4, 0x6A, 0xD8, 0x13, 0x71, 0x15, 0x68, 0xA8, 0xDC, 0x3A, 0x93, 0xE6, 0xEB, 0xED, 0x60, 0xDE,
+    0xF0, 0xE6, 0x17, 0x34, 0xC1, 0x90, 0x2D, 0x87, 0x87, 0xD9, 0x97, 0xB4, 0x30, 0xE3, 0xA7, 0x1A,
+    0x0E, 0x2B, 0x27, 0x88, 0x87, 0x88, 0x00, 0x01, 0xDD, 0xA1, 0xED, 0xB1, 0xD1, 0x01, 0x9B, 0x3B,
+    0x38, 0x02, 0x11, 0xCA, 0x84, 0x82, 0x47, 0x03, 0xA0, 0xE9, 0xE6, 0x31, 0xBE, 0x66, 0x77, 0x1B,
+    0xDC, 0xF2, 0x23, 0x28, 0x4E, 0xB1, 0xD3, 0x96, 0xDF, 0x0F, 0x20, 0x07, 0x30, 0xA2, 0x58, 0x0D,
+    0x28, 0xC5, 0x4E, 0x3B, 0x98, 0xC1, 0x7C, 0x9F, 0x0F, 0xD0, 0x84, 0x9A, 0x74, 0x2D, 0x87, 0xCE,
+    0xF8, 0x3C, 0x34, 0xDD, 0x42, 0x31, 0x10, 0x3F, 0xEE, 0xE3, 0x0C, 0x36, 0x54, 0x3E, 0x23, 0xA2,
+    0xDB, 0x29, 0xEB, 0x19, 0x72, 0xBC, 0x29, 0x50, 0xB7, 0x03, 0x43, 0xF6, 0x24, 0x47, 0x4D, 0x3A,
+    0x15, 0x0A, 0x7F, 0xB3, 0xD1, 0x17, 0x90, 0xC7, 0x40, 0xB2, 0x87, 0x64, 0x04, 0x4C, 0xCE, 0x74,
+    0x03, 0x24, 0x87, 0x0C, 0xBF, 0xCE, 0x08, 0xAE, 0xBF, 0x03, 0xD4, 0x7B, 0x7B, 0x68, 0xBD, 0x26,
+    0xE3, 0x9C, 0x9C, 0x98, 0x70, 0x62, 0x86, 0x6F, 0x65, 0x24, 0x68, 0xC5, 0x0E, 0xCA, 0x41, 0x30,
+    0xE7, 0xD6, 0xCF, 0xF7, 0x6F, 0xE3, 0x3F, 0xA0, 0x24, 0x77, 0x34, 0x79, 0x81, 0x8C, 0x8D, 0x2F,
+    0x9D, 0x1E, 0x66, 0x27, 0xC2, 0x84, 0x9A, 0x09, 0x35, 0xD9, 0x55, 0x64, 0x07, 0xC3, 0x39, 0x5B,
+    0xF0, 0x83, 0x1E, 0xE6, 0xF5, 0xBD, 0x47, 0xD8, 0x90, 0x5E, 0x93, 0xBD, 0xE1, 0x94, 0x1B, 0xD3,
+    0xA1, 0xD3, 0x80, 0x64, 0x8F, 0x9A, 0x13, 0xEA, 0xC8, 0xAE, 0xF6, 0xD2, 0x89, 0x9B, 0x82, 0xE5,
+    0xFF, 0x84, 0x55, 0x3E, 0xB2, 0x03, 0x91, 0x91, 0xC9, 0x65, 0xD2, 0xB6, 0x1D, 0xF5, 0x0B, 0x11,
+    0x6D, 0xFF, 0x65, 0x57, 0x39, 0x87, 0x13, 0xDF, 0x46, 0x9B, 0xED, 0x44, 0x9F, 0x29, 0x1A, 0xF0,
+    0xF8, 0xCD, 0x96, 0x3C, 0x81, 0x32, 0x07, 0xE7, 0xC7, 0x8C, 0x29, 0x6C, 0x19, 0x00, 0xD2, 0x42,
+    0x70, 0xCA, 0x48, 0x8B, 0x82, 0x36, 0x5B, 0xAC, 0x32, 0x3C, 0xDE, 0xD5, 0xA9, 0x21, 0xF9, 0xD0,
+    0x1C, 0x78, 0xEB, 0x0F, 0x33, 0xCD, 0x71, 0xC0, 0x38, 0x77, 0xA1, 0xC5, 0xCC, 0x01, 0x50, 0x73,
+    0xC8, 0x36, 0xAC, 0x19, 0x01, 0xFC, 0xDA, 0x0F, 0x50, 0x33, 0xDD, 0x4F, 0x52, 0x92, 0x93, 0x1E,
+    0xEB, 0x17, 0xD8, 0xA1, 0x62, 0x07, 0xC9, 0x01, 0x2D, 0x3D, 0x5A, 0x46, 0x34, 0x8C, 0x28, 0x19,
+    0x00, 0xE3, 0x00, 0xF3, 0x0F, 0x28, 0xF9, 0xE8, 0x4F, 0x4F, 0x04, 0x4D, 0xBE, 0x49, 0xA6, 0x92,
+    0x1C, 0x50, 0x0F, 0x99, 0x5F, 0xC0, 0x0C, 0x39, 0x85, 0x96, 0x28, 0xAF, 0x04, 0xD4, 0x73, 0xAA,
+    0xE3, 0xA1, 0x1E, 0xDF, 0x11, 0xB1, 0x20, 0xD4, 0x9B, 0xCC, 0x95, 0x51, 0xEC, 0x66, 0x05, 0xF1,
+    0x9F, 0xFC, 0x2E, 0x7F, 0xC2, 0x73, 0xFC, 0x25, 0xDE, 0x65, 0x4D, 0xF2, 0x03, 0x92, 0x7C, 0x87,
+    0x24, 0x7F, 0x4C, 0x32, 0x6D, 0x7D, 0x9B, 0x3F, 0x3C, 0x76, 0x0B, 0x35, 0x86, 0x20, 0xF0, 0x65,
+    0x6D, 0x82, 0x07, 0x50, 0xBF, 0x8D, 0x39, 0xA1, 0xA2, 0x76, 0xC8, 0x69, 0xBA, 0x8A, 0x33, 0xCE,
+    0x43, 0xCC, 0xFD, 0x68, 0xE5, 0x00, 0x03, 0x48, 0x87, 0x82, 0x1D, 0x0C, 0x83, 0x22, 0x2F, 0x90,
+    0xE1, 0x77, 0xB9, 0xEC, 0xE7, 0xA7, 0xFD, 0xE3, 0x17, 0x1D, 0x5A, 0xFE, 0xC7, 0x82, 0x1C, 0x6A,
+    0x46, 0xB4, 0xB4, 0x68, 0x7A, 0x94, 0x7B, 0x73, 0x97, 0x65, 0x51, 0x06, 0x7C, 0x83, 0xB6, 0xE0,
+    0x04, 0xB9, 0x87, 0xF2, 0x14, 0xEE, 0xEE, 0x2B, 0x5F, 0x46, 0xD4, 0x41, 0x8D, 0xD9, 0x38, 0x90,
+    0x9C, 0x5B, 0xF7, 0xBE, 0x8D, 0xFC, 0x4B, 0x10, 0x55, 0x0E, 0xE4, 0x1E, 0x74, 0xB7, 0x6A, 0x34,
+    0xB6, 0x0C, 0x38, 0x9F, 0x4D, 0x74, 0x3D, 0x20, 0x63, 0x39, 0x48, 0x42, 0x90, 0x01, 0x87, 0xF8,
+    0xEE, 0xC9, 0xCF, 0xF5, 0x83, 0x11, 0x40, 0xCB, 0xFF, 0x08, 0x68, 0x4E, 0x80, 0xE1, 0x00, 0x18,
+    0xCE, 0x76, 0xFF, 0xE7, 0xAD, 0xF2, 0x9A, 0x5E, 0x45, 0x30, 0xA7, 0xD1, 0x05, 0x6C, 0xE9, 0x0F,
+    0xB6, 0x3F, 0x5F, 0x95, 0x3F, 0xC3, 0x7D, 0x2F, 0xF4, 0x07, 0xDB, 0x8A, 0x7C, 0x90, 0x9C, 0x14,
+    0xD9, 0x7D, 0xE2, 0x7D, 0xDF, 0x58, 0x8F, 0xE5, 0xD5, 0x90, 0x73, 0xDA, 0x6A, 0x32, 0x40, 0x4C,
+    0x3A, 0x00, 0x53, 0xF1, 0xDC, 0x4D, 0x6A, 0xDA, 0x98, 0xB5, 0x49, 0x98, 0x57, 0x09, 0xB4, 0x13,
+    0x2D, 0xEA, 0xA8, 0xDC, 0x3F, 0x76, 0xA3, 0xE0, 0xD1, 0x88, 0x1C, 0x37, 0x30, 0x4E, 0x7B, 0x18,
+    0x2F, 0x57, 0xE8, 0x8C, 0x98, 0xA5, 0x94, 0x85, 0xBF, 0xA2, 0x52, 0x01, 0x6A, 0x2F, 0xC6, 0x92,
+    0x29, 0x42, 0x91, 0xB6, 0x7E, 0x99, 0x13, 0x9E, 0x3B, 0x78, 0xA5, 0x66, 0x00, 0x5F, 0x8A, 0x90,
+    0xE1, 0xF3, 0xAD, 0x8C, 0x25, 0x5F, 0x62, 0xA7, 0x83, 0xA6, 0xE1, 0x05, 0x92, 0x41, 0x32, 0x29,
+    0xDB, 0xF2, 0xC1, 0x90, 0xA5, 0xB4, 0xB5, 0x58, 0xCC, 0xD9, 0x4C, 0x82, 0x74, 0x58, 0xC5, 0x88,
+    0xD7, 0x2C, 0x00, 0x5F, 0xA2, 0x48, 0x0E, 0x6C, 0x54, 0x13, 0x07, 0xC8, 0xA0, 0x3C, 0x6A, 0x56,
+    0xEC, 0x6B, 0xF6, 0x39, 0x55, 0x85, 0xE4, 0x00, 0x92, 0x36, 0x67, 0x41, 0x66, 0xBB, 0x69, 0xB1,
+    0xD8, 0x46, 0x9B, 0xC1, 0x6C, 0x13, 0x5A, 0x1E, 0xD0, 0xB8, 0xBE, 0x22, 0x99, 0xFC, 0x19, 0x36,
+    0xFB, 0x9C, 0xCE, 0x24, 0xD2, 0x59, 0x9F, 0x13, 0x5D, 0x50, 0x31, 0x7C, 0x28, 0x97, 0xE9, 0x76,
+    0x68, 0x3B, 0xE5, 0x0E, 0x7E, 0x07, 0x0A, 0x72, 0xF8, 0x38, 0x64, 0xEC, 0x57, 0x27, 0x27, 0x9C,
+    0xEF, 0x66, 0x17, 0x1C, 0xCE, 0x6B, 0x00, 0xF7, 0x55, 0x03, 0x20, 0x9F, 0x98, 0x80, 0xF2, 0x7A,
+    0x00, 0xA0, 0x22, 0x6E, 0xA6, 0xA7, 0xB8, 0x3D, 0x1A, 0x14, 0x2A, 0x8F, 0x9C, 0x67, 0xAC, 0x4E,
+    0xF4, 0x10, 0x43, 0x00, 0xEE, 0x95, 0x16, 0xE2, 0xBA, 0x9F, 0x51, 0xA2, 0x27, 0xFA, 0xAF, 0x5C,
+    0x74, 0x9B, 0xA7, 0x8F, 0xEF, 0xA0, 0x4A, 0x6A, 0xCE, 0x40, 0x28, 0x93, 0x74, 0x28, 0xA2, 0x1C,
+    0x81, 0x73, 0xD5, 0x78, 0xDB, 0x75, 0x4F, 0xC7, 0x9F, 0x7C, 0x16, 0x32, 0x98, 0x41, 0xB0, 0x99,
+    0xA0, 0x9F, 0x8A, 0x90, 0xA3, 0x41, 0x39, 0xC9, 0xAF, 0x5C, 0x4E, 0xBF, 0xCC, 0xDA, 0x07, 0x00,
+    0x5B, 0x11, 0xAB, 0xB8, 0x80, 0xEA, 0x66, 0xCE, 0xB6, 0x39, 0xC3, 0x97, 0x13, 0x80, 0x36, 0xAE,
+    0x4C, 0x52, 0xA0, 0xFE, 0xFC, 0xB5, 0x1F, 0xC0, 0x97, 0x12, 0xDA, 0x60, 0xA6, 0x8A, 0x17, 0x79,
+    0x83, 0x41, 0x91, 0xB4, 0xE4, 0x5B, 0xA1, 0xE4, 0xA4, 0x2C, 0xB6, 0xAB, 0x71, 0x76, 0xC9, 0xAB,
+    0x95, 0x99, 0xAB, 0x7F, 0x80, 0x9C, 0x1C, 0xD3, 0x06, 0x00, 0xC7, 0xFB, 0x15, 0xB2, 0x17, 0x40,
+    0x33, 0xF7, 0x8C, 0x92, 0xD9, 0x91, 0x23, 0xAF, 0xE7, 0x0B, 0x93, 0xD3, 0xEC, 0x13, 0x76, 0x88,
+    0xF8, 0xF0, 0xCB, 0x58, 0x34, 0x13, 0x4A, 0xB6, 0x13, 0x6A, 0x62, 0x76, 0xD1, 0x59, 0xE8, 0x91,
+    0x3D, 0x38, 0xE5, 0xB4, 0x5B, 0x9D, 0x50, 0x87, 0x3A, 0xA0, 0xA5, 0x15, 0x2C, 0xD8, 0x49, 0x3A,
+    0xB0, 0x57, 0xA3, 0x48, 0x11, 0x7A, 0x90, 0xA1, 0x48, 0xBA, 0x6F, 0x5D, 0x49, 0x98, 0xA3, 0x4E,
+    0x06, 0xE8, 0x41, 0x5D, 0x08, 0x22, 0x41, 0x7A, 0xE9, 0x78, 0x3F, 0x3B, 0xC1, 0x2A, 0xB4, 0xA3,
+    0xB1, 0x30, 0x2F, 0xC6, 0x2A, 0x28, 0x87, 0x66, 0x22, 0x28, 0x3D, 0x44, 0x54, 0x56, 0xBD, 0x1E,
+    0x01, 0xFE, 0x78, 0xAC, 0xF7, 0x08, 0xB4, 0x37, 0x26, 0xD0, 0x58, 0x54, 0x0C, 0x39, 0x0B, 0x97,
+    0x44, 0xCD, 0x09, 0x50, 0xEC, 0x0B, 0x06, 0xA0, 0xE6, 0x00, 0xC5, 0xFC, 0xFC, 0x4A, 0xF6, 0x80,
+    0x5A, 0x63, 0xB7, 0x97, 0xB9, 0x39, 0xD2, 0xCF, 0xB8, 0x93, 0x9C, 0x67, 0x79, 0x69, 0x02, 0x00,
+    0xDD, 0xB3, 0x03, 0x6E, 0xCD, 0x8C, 0xCB, 0x3A, 0xDE, 0x50, 0xD2, 0x0A, 0x4A, 0x0F, 0x4E, 0xE0,
+    0x53, 0x84, 0x4A, 0xD0, 0x83, 0xB1, 0x0D, 0x6D, 0xEB, 0x9A, 0xA9, 0xBE, 0xE1, 0x64, 0x10, 0x49,
+    0xEC, 0x45, 0x91, 0x40, 0x9B, 0xD4, 0x13, 0xEC, 0x9A, 0x49, 0x1F, 0x75, 0xC6, 0x8A, 0xD4, 0xBE,
+    0x18, 0xD4, 0x08, 0x3E, 0xE3, 0xF4, 0xD1, 0x09, 0xED, 0x55, 0x2F, 0xDF, 0x09, 0xA8, 0x42, 0x14,
+    0xD7, 0x09, 0xD0, 0xC0, 0x98, 0x1E, 0x8A, 0xB6, 0xE1, 0x80, 0x8A, 0xA3, 0xA0, 0x03, 0x38, 0x65,
+    0x5C, 0x73, 0x80, 0x8A, 0x40, 0xCD, 0x8C, 0xCA, 0xCC, 0xD7, 0x4E, 0xBF, 0x72, 0x69, 0x9A, 0x4B,
+    0x13, 0xA0, 0x2D, 0xBB, 0x15, 0x23, 0xD2, 0xED, 0xC1, 0x8E, 0x71, 0x00, 0x29, 0xD9, 0x66, 0xA4,
+    0xE4, 0xB4, 0x46, 0x4A, 0x9A, 0xDB, 0x2B, 0x65, 0x3B, 0x3F, 0x92, 0x43, 0xDB, 0xA3, 0x0A, 0xD2,
+    0xCD, 0xD9, 0xE5, 0xAA, 0x27, 0x50, 0xDC, 0xD2, 0xFC, 0x7F, 0xB9, 0x12, 0xCD, 0xCE, 0x44, 0xB3,
+    0x8E, 0xDB, 0x8E, 0xB3, 0x63, 0xAB, 0x3D, 0x98, 0x5E, 0xDE, 0x66, 0x76, 0xB3, 0xCC, 0x40, 0x42,
+    0x49, 0x32, 0x6C, 0x2D, 0x16, 0x1C, 0x66, 0x4C, 0xAF, 0x5E, 0xA7, 0x44, 0xF8, 0xD9, 0xF2, 0x96,
+    0x11, 0x40, 0x0E, 0x2C, 0xAC, 0x63, 0xC0, 0x7D, 0xEE, 0x33, 0xF6, 0xF7, 0xE7, 0x44, 0xED, 0x6E,
+    0x26, 0x01, 0xE2, 0x9C, 0xAB, 0xC0, 0x67, 0x72, 0xDE, 0xD8, 0xC7, 0xBA, 0x58, 0x00, 0x18, 0xF2,
+    0x7D, 0x92, 0x2F, 0x91, 0xBC, 0x7B, 0x69, 0xFC, 0x9C, 0x1E, 0x02, 0x98, 0x11, 0xD5, 0x01, 0xA5,
+    0x3C, 0xF3, 0x58, 0xCA, 0x00, 0x70, 0x40, 0x4D, 0x52, 0x93, 0x91, 0xE4, 0xB5, 0x4C, 0x18, 0x79,
+    0xD7, 0x0A, 0x5A, 0xA2, 0xFC, 0x7C, 0xB5, 0x05, 0xB1, 0x9F, 0x0C, 0xF9, 0xCB, 0xAA, 0xF9, 0x46,
+    0x36, 0xBC, 0x2A, 0xE6, 0x1B, 0xAA, 0x46, 0xE0, 0xEB, 0x5F, 0x6A, 0xCD, 0x57, 0xA6, 0x67, 0xFA,
+    0x44, 0xD3, 0xF3, 0x9F, 0xBE, 0xE6, 0x9F, 0xE4, 0x45, 0xFC, 0x92, 0xEE, 0xF9, 0xD6, 0x76, 0xC5,
+    0xD8, 0x30, 0x28, 0x06, 0xB5, 0xF7, 0x6F, 0xB5, 0x83, 0x1E, 0xBF, 0xF8, 0xFF, 0xF1, 0x93, 0x82,
+    0xBD, 0x8C, 0x68, 0x1D, 0xB4, 0x45, 0xC2, 0x91, 0x93, 0x82, 0xBD, 0x9A, 0x4A, 0x76, 0x4D, 0x86,
+    0x45, 0x1F, 0xC0, 0x94, 0x9D, 0x70, 0x6A, 0x30, 0xDF, 0x9F, 0x31, 0x65, 0x07, 0x81, 0xB7, 0x0F,
+    0xD3, 0x4E, 0xC5, 0xDF, 0xE2, 0x16, 0x88, 0xA9, 0xE4, 0xFA, 0xB5, 0x58, 0x2C, 0xB6, 0x8F, 0xA0,
+    0xFC, 0x1F, 0xD7, 0x40, 0x4E, 0x2F, 0x98, 0xB0, 0x79, 0x1D, 0x1B, 0x55, 0x34, 0x97, 0x93, 0x1E,
+    0xB6, 0x01, 0x68, 0x44, 0x66, 0x0E, 0xCF, 0x22, 0xDE, 0x81, 0x3B, 0x8F, 0xF7, 0xF4, 0x0C, 0x0F,
+    0xC4, 0x22, 0x56, 0xA1, 0x19, 0x9B, 0x1E, 0xA8, 0x7C, 0xCD, 0x0B, 0xBF, 0xD8, 0x73, 0xEA, 0x31,
+    0xB9, 0xFB, 0xC6, 0x4F, 0xE8, 0x0E, 0x0F, 0x58, 0xFE, 0xAB, 0xD3, 0x82, 0x8D, 0xAF, 0xA2, 0x1A,
+    0xA5, 0x33, 0x7D, 0xFB, 0x42, 0xC4, 0x7D, 0xA5, 0xC3, 0x77, 0x50, 0x9E, 0xCC, 0xB9, 0x49, 0xE1,
+    0x60, 0x6E, 0xD2, 0x77, 0xCE, 0x9F, 0x3F, 0x7F, 0xFE, 0x3C, 0x8E, 0x1F, 0xFA, 0x91, 0x4B, 0x46,
+    0x5E, 0x9E, 0x8B, 0x1C, 0xD3, 0xA9, 0x83, 0x1A, 0xDB, 0x91, 0x30, 0x0F, 0x85, 0x32, 0xC8, 0xA1,
+    0x1E, 0xEE, 0xC3, 0x5D, 0x00, 0x01, 0xE2, 0x14, 0xEF, 0x3E, 0xF7, 0xDB, 0xF7, 0x3D, 0x8E, 0x4C,
+    0x3C, 0xE9, 0x8A, 0xF3, 0x1D, 0x8E, 0xEF, 0x40, 0x71, 0x90, 0xE4, 0x03, 0x64, 0x50, 0x9D, 0xBC,
+    0x38, 0xE0, 0x7B, 0x45, 0x10, 0xA1, 0xF2, 0xB5, 0x97, 0x53, 0xE3, 0x94, 0x53, 0xE3, 0x56, 0x57,
+    0x07, 0x19, 0xA4, 0x97, 0x53, 0xE3, 0xDA, 0x51, 0x59, 0x65, 0xB7, 0xA0, 0x46, 0xE5, 0x5A, 0xD7,
+    0x38, 0x39, 0xD5, 0x5E, 0x84, 0x32, 0xE0, 0xD8, 0x87, 0x8F, 0x39, 0x72, 0x12, 0xC6, 0xC1, 0x8C,
+    0xD0, 0x23, 0xD4, 0x80, 0xD6, 0x7E, 0x88, 0x29, 0xB2, 0x29, 0x48, 0xBA, 0xA6, 0x70, 0x1B, 0x90,
+    0xDD, 0x24, 0x49, 0x76, 0xD3, 0x06, 0xB6, 0x16, 0x2D, 0xFF, 0xD3, 0xD2, 0xE3, 0x5B, 0xA8, 0xFB,
+    0x72, 0xC4, 0x73, 0xF8, 0x16, 0x36, 0x3B, 0x2C, 0x3A, 0xE5, 0x1A, 0x5F, 0xC7, 0x9A, 0x92, 0x22,
+    0xC1, 0x03, 0x40, 0xF1, 0xE0, 0xFB, 0xC1, 0xDF, 0x2B, 0x5F, 0x0E, 0x4D, 0xD1, 0x09, 0x2B, 0xAC,
+    0xB0, 0x26, 0xE9, 0xB8, 0x75, 0xCC, 0xA4, 0x3F, 0xFF, 0x79, 0xFE, 0x0C, 0x08, 0x2B, 0xEC, 0x89,
+    0x3D, 0x93, 0x7E, 0xFD, 0xEF, 0x85, 0x2D, 0x7B, 0xC0, 0x44, 0x13, 0xB1, 0x04, 0xF3, 0x5F, 0xC1,
+    0x3F, 0xA7, 0x8E, 0x3A, 0xE8, 0x71, 0xBD, 0x09, 0xEC, 0xF8, 0x73, 0x13, 0x55, 0xAC, 0x63, 0xBD,
+    0xC3, 0x0B, 0x3C, 0x1A, 0x9B, 0xDC, 0xEE, 0x6F, 0xB9, 0xAF, 0x1F, 0xBE, 0x8B, 0xEA, 0x6A, 0x54,
+    0x17, 0x27, 0xB3, 0xD1, 0xD5, 0x56, 0x0E, 0x87, 0x03, 0x12, 0x92, 0x49, 0x26, 0x98, 0x11, 0x3B,
+    0x95, 0x93, 0x56, 0x75, 0x0A, 0xFA, 0x07, 0x2A, 0x36, 0xB1, 0x3C, 0x3D, 0xDF, 0xC1, 0xC5, 0x62,
+    0x41, 0xF2, 0xFA, 0xF2, 0xEC, 0x84, 0x26, 0xFF, 0x6F, 0x63, 0xE3, 0xBB, 0xB2, 0x78, 0xD5, 0xBA,
+    0x7B, 0x5A, 0xB2, 0x7F, 0xBC, 0x1E, 0xBE, 0x83, 0xF2, 0x24, 0x3B, 0x6D, 0xF9, 0x70, 0x28, 0x48,
+    0x5B, 0xAC, 0xD2, 0xD3, 0x3E, 0x0A, 0x23, 0xF9, 0x3B, 0xD8, 0xFC, 0x2B, 0x87, 0xA0, 0xAE, 0xF3,
+    0x05, 0x72, 0xAA, 0x66, 0x8C, 0xF1, 0x47, 0xDD, 0xE3, 0x8C, 0xC8, 0xB9, 0xAF, 0xE5, 0x95, 0x57,
+    0xC9, 0xF0, 0x7C, 0xC3, 0x87, 0xFB, 0xC3, 0xFD, 0xC1, 0x76, 0xBF, 0x6A, 0xF1, 0x5B, 0x8B, 0xC5,
+    0xB1, 0xAD, 0xC5, 0xE2, 0x5F, 0xE7, 0x64, 0xBF, 0x55, 0x9F, 0x54, 0x2E, 0x97, 0xCB, 0x67, 0x48,
+    0xDE, 0xBD, 0x5C, 0x9E, 0xCE, 0x84, 0x51, 0xF5, 0x0B, 0x4C, 0xE7, 0x25, 0x39, 0x3D, 0x7E, 0x98,
+    0x4F, 0xCC, 0x74, 0x51, 0xB7, 0x3C, 0x38, 0x8A, 0xEB, 0x1E, 0x2C, 0x2B, 0xB7, 0xE4, 0x8B, 0xCB,
+    0xE5, 0x72, 0xB9, 0x3C, 0x0D, 0xDC, 0x05, 0x04, 0xD4, 0x11, 0x3A, 0x0A, 0x8E, 0x2D, 0x61, 0x26,
+    0xA8, 0x1E, 0xBF, 0xB9, 0x8A, 0xF3, 0x6C, 0x03, 0xE7, 0xB1, 0x4A, 0x1D, 0x6C, 0x3B, 0x08, 0x77,
+    0xD3, 0x86, 0x1E, 0xC2, 0x01, 0x8F, 0xDF, 0xBA, 0x41, 0x67, 0xC0, 0xD1, 0x27, 0x6F, 0xA8, 0x07,
+    0x60, 0x47, 0xC9, 0xF1, 0x5C, 0xD3, 0xEC, 0xBE, 0x3A, 0x6C, 0x63, 0x63, 0x7D, 0x2B, 0xD2, 0xD2,
+    0xE4, 0x2B, 0x9F, 0x29, 0x67, 0x1F, 0x5F, 0x9E, 0x79, 0xBD, 0xC7, 0xEF, 0x7F, 0x17, 0xE5, 0xEB,
+    0x3D, 0x7E, 0x5F, 0x93, 0xAF, 0x2C, 0x97, 0xA7, 0xEB, 0x0F, 0x52, 0x79, 0x23, 0xF9, 0x7B, 0xA4,
+    0xB8, 0xD8, 0xFD, 0xCD, 0x6F, 0xDD, 0x75, 0xD7, 0xBD, 0x8F, 0xB5, 0x53, 0x3D, 0x36, 0xD3, 0xBD,
+    0xE7, 0xEE, 0xFA, 0x97, 0x9B, 0x2F, 0x86, 0x7B, 0xC5, 0xD0, 0xC2, 0x57, 0xF6, 0x9C, 0x7A, 0xB0,
+    0xDF, 0x5A, 0x2C, 0x1E, 0xCD, 0xD2, 0x98, 0x95, 0xB8, 0x43, 0xCB, 0xE5, 0x92, 0xE4, 0x2F, 0x96,
+    0xCB, 0xE5, 0x91, 0x53, 0x30, 0x0E, 0xB9, 0x0F, 0x5C, 0x3D, 0x2B, 0xCA, 0xD7, 0xA9, 0x60, 0x37,
+    0xE3, 0x0D, 0x3F, 0x02, 0xAA, 0xAF, 0x06, 0xBE, 0xC8, 0x2E, 0xD4, 0xE3, 0x37, 0x72, 0xDE, 0x75,
+    0x57, 0x39, 0xFD, 0xBE, 0xE7, 0xF7, 0x83, 0xDA, 0xF5, 0x7C, 0x2A, 0x6A, 0xE9, 0x94, 0xED, 0x02,
+    0xB0, 0x55, 0xA4, 0xCA, 0x37, 0x4E, 0x7B, 0xBE, 0xC9, 0x6E, 0x6B, 0xB1, 0x38, 0xA6, 0xC9, 0xF8,
+    0xF8, 0x72, 0xF9, 0xFC, 0x63, 0xC0, 0xBD, 0xAB, 0xF7, 0x5D, 0xC0, 0x5D, 0x9F, 0x74, 0x85, 0x1F,
+    0xEE, 0x6C, 0x54, 0x50, 0x01, 0xF7, 0xCC, 0x7F, 0xE8, 0xB0, 0x75, 0xEF, 0x6F, 0xD4, 0x7C, 0xFA,
+    0x05, 0x26, 0x7F, 0x6F, 0x4B, 0x71, 0xF1, 0xFF, 0xE9, 0xF1, 0x07, 0x73, 0x1C, 0x26, 0x87, 0xE6,
+    0x94, 0x85, 0x08, 0xC0, 0x7F, 0x59, 0x74, 0x66, 0xE7, 0xB1, 0x96, 0x57, 0x9E, 0xBA, 0xC1, 0xE9,
+    0xDE, 0x2A, 0x15, 0xDD, 0xA9, 0xF5, 0xBE, 0xCC, 0x6A, 0xB9, 0xB9, 0xF3, 0xAB, 0x2A, 0x3E, 0xAE,
+    0x19, 0x9E, 0x6B, 0x26, 0x00, 0x72, 0xFC, 0x86, 0x4A, 0xCF, 0x7F, 0xCF, 0x84, 0xBF, 0xAD, 0x46,
+    0x00, 0xD5, 0xFD, 0x43, 0x4B, 0xAF, 0x19, 0xE5, 0xFD, 0xAE, 0xBC, 0x3F, 0xAB, 0xF9, 0x65, 0x5F,
+    0x8F, 0xAD, 0xCF, 0x8F, 0xBC, 0xB0, 0xC6, 0xB6, 0x5E, 0x24, 0x0E, 0xAD, 0xCF, 0xFA, 0x58, 0x76,
+    0x95, 0x42, 0x3A, 0xFC, 0xEB, 0xBF, 0x83, 0xDC, 0xC6, 0xFF, 0xFA, 0xDF, 0x61, 0x03, 0x5F, 0x03,
+    0xFE, 0x06, 0xF8, 0x55, 0xE0, 0x4F, 0x80, 0x6F, 0x02, 0xBF, 0x8A, 0xED, 0xBF, 0x04, 0xBE, 0xB6,
+    0x31, 0x1F, 0xB9, 0x03, 0x08, 0xE9, 0x06, 0xA0, 0x9A, 0xBF, 0x7B, 0xF2, 0x2F, 0x81, 0xAF, 0x1D,
+    0xC2, 0x5F, 0x02, 0xFF, 0x62, 0xF5, 0xAD, 0x7C, 0x06, 0xFC, 0x2F, 0xFF, 0x15, 0xE0, 0xF0, 0x5F,
+    0xFF, 0xDF, 0xFB, 0xBF, 0x02, 0x40, 0xD2, 0xB6, 0x5E, 0x30, 0x5F, 0x03, 0x64, 0xA7, 0xFB, 0xF3,
+    0xF5, 0x3B, 0x7E, 0x02, 0x36, 0xE5, 0xEB, 0xEF, 0xBB, 0x73, 0xCD, 0x85, 0xE9, 0xB7, 0xB0, 0x85,
+    0x8A, 0x63, 0x4B, 0xAF, 0xFE, 0x3A, 0x3E, 0x8F, 0xFB, 0xC2, 0xF9, 0x36, 0xF7, 0xD2, 0xF8, 0x1D,
+    0xFC, 0xCA, 0x37, 0xEF, 0x0B, 0x72, 0x92, 0x4E, 0xF9, 0xDF, 0xFA, 0x43, 0x00, 0xDB, 0x8F, 0xEB,
+    0x67, 0xAC, 0xE9, 0xCE, 0xE3, 0x64, 0x27, 0x77, 0xD4, 0xF0, 0x78, 0x73, 0x79, 0x3C, 0x89, 0x6F,
+    0x02, 0x62, 0x14, 0x63, 0x33, 0x1A, 0xB4, 0x47, 0x5D, 0xFD, 0xC1, 0x3B, 0x4F, 0x4D, 0xBF, 0x77,
+    0xCF, 0x1F, 0x88, 0x27, 0x86, 0x53, 0xED, 0x43, 0xEE, 0x7B, 0xCD, 0xA3, 0x2F, 0xBD, 0xB2, 0xB3,
+    0x51, 0x05, 0x5E, 0x49, 0xFA, 0xE5, 0x9D, 0xB2, 0xFF, 0xCF, 0xFE, 0x4F, 0x15, 0x74, 0xAC, 0xC7,
+    0x6F, 0x3D, 0xF7, 0x2B, 0xDF, 0x04, 0x00, 0xF3, 0xE8, 0xA8, 0xCC, 0x95, 0x8B, 0xBD, 0xFB, 0xBD,
+    0xFF, 0x46, 0x16, 0xAF, 0xF7, 0xEE, 0xF7, 0x94, 0xB9, 0x62, 0x8D, 0x1C, 0x81, 0xAF, 0xE1, 0x37,
+    0xF3, 0x9D, 0xFD, 0x43, 0xFC, 0x25, 0x70, 0xA4, 0x03, 0x50, 0x9C, 0x6E, 0x07, 0x00, 0x95, 0x97,
+    0x39, 0x46, 0x23, 0xB8, 0xB7, 0xF8, 0xF3, 0x99, 0x56, 0x30, 0x01, 0x87, 0x67, 0x2A, 0xAE, 0x13,
+    0xDC, 0xFB, 0x02, 0x5F, 0x58, 0x2E, 0x73, 0x1B, 0x23, 0x97, 0xEB, 0xD7, 0xFE, 0xC7, 0x1C, 0xEF,
+    0xBA, 0xAB, 0x24, 0x7F, 0x0A, 0x04, 0x49, 0x32, 0x9D, 0xF1, 0x6D, 0x6E, 0xA2, 0xAA, 0xDB, 0x30,
+    0xE4, 0x70, 0x2F, 0x80, 0x3F, 0x7E, 0xF6, 0x60, 0x84, 0x66, 0x0F, 0x99, 0x9B, 0x72, 0xCA, 0x48,
+    0x05, 0x42, 0xF0, 0xA7, 0xC5, 0x23, 0xB4, 0xD2, 0x03, 0x38, 0xE1, 0xE6, 0x6B, 0xBB, 0x1B, 0x00,
+    0x70, 0xEA, 0xA0, 0xFA, 0x3F, 0xB7, 0x57, 0xDF, 0xE4, 0x3E, 0x2A, 0x33, 0xBC, 0x4D, 0x8B, 0xC5,
+    0x62, 0xB1, 0x98, 0x73, 0xBF, 0xF2, 0x93, 0x58, 0x00, 0x68, 0xFC, 0xD7, 0x1F, 0x47, 0xDB, 0xF2,
+    0xB1, 0xE6, 0x9C, 0x52, 0x57, 0x36, 0x36, 0x80, 0x32, 0x89, 0xFF, 0xF4, 0xA6, 0xBB, 0x47, 0xB3,
+    0x81, 0x18, 0xEF, 0xD4, 0xBE, 0x38, 0x86, 0xFF, 0x76, 0xF8, 0xFD, 0x6B, 0x97, 0xBE, 0x77, 0xED,
+    0x35, 0x00, 0x65, 0x12, 0x97, 0xDF, 0x74, 0xF7, 0x3C, 0x27, 0x4F, 0x88, 0x0B, 0xAF, 0x38, 0xED,
+    0x8A, 0x6D, 0x7C, 0x57, 0xB6, 0xE2, 0x25, 0xFB, 0xBE, 0xBB, 0xE7, 0x5C, 0xD3, 0x1C, 0xBD, 0x40,
+    0xB7, 0x75, 0x07, 0xA0, 0x5F, 0x7F, 0xF7, 0x2F, 0x30, 0x89, 0xB1, 0x7E, 0xF9, 0xE1, 0x54, 0x6C,
+    0x43, 0xA2, 0x41, 0xD3, 0x5C, 0xB9, 0xCF, 0x9C, 0x6B, 0x9E, 0x93, 0xCF, 0xC9, 0xEF, 0xB5, 0xEA,
+    0xCA, 0xC6, 0x7F, 0xF1, 0x5D, 0x34, 0xA8, 0x6C, 0x71, 0x63, 0xD2, 0xA6, 0x11, 0x17, 0xED, 0x7B,
+    0xEE, 0x9E, 0xC7, 0x64, 0x23, 0x5E, 0xE8, 0xB6, 0x01, 0xDC, 0x9B, 0xF4, 0x33, 0x97, 0xAF, 0x5F,
+    0x1B, 0xFD, 0xB7, 0xA6, 0x7B, 0xEB, 0xE7, 0xE5, 0x03, 0x57, 0x1E, 0x1C, 0xFE, 0x8F, 0x61, 0xFA,
+    0xD6, 0xF6, 0x5D, 0x05, 0x20, 0xEF, 0xE5, 0xA5, 0x7E, 0x92, 0xDD, 0x24, 0xBB, 0x6D, 0x6C, 0xE0,
+    0x1E, 0xC1, 0xC3, 0x3F, 0x6B, 0xF0, 0x58, 0xE1, 0x2A, 0x2B, 0xDD, 0x46, 0xF7, 0x9C, 0x7C, 0xB4,
+    0xBA, 0xF0, 0xCA, 0xF8, 0x5D, 0x27, 0xBF, 0x5B, 0x46, 0x28, 0x6C, 0xA0, 0xAD, 0xAC, 0x9F, 0x44,
+    0x42, 0x63, 0x45, 0xC4, 0xF3, 0xAE, 0xA9, 0x5F, 0xE8, 0xEE, 0xDA, 0x7C, 0x76, 0xA6, 0x2B, 0x99,
+    0x31, 0xFC, 0xB5, 0x9F, 0x43, 0x38, 0x73, 0xD0, 0x9B, 0x9E, 0xE4, 0xD5, 0x79, 0xB8, 0x50, 0x1F,
+    0x2C, 0x8E, 0xDD, 0x9A, 0x89, 0xF4, 0xDA, 0xE2, 0x41, 0x92, 0x47, 0xC9, 0xA8, 0xC8, 0x89, 0xEF,
+    0x2E, 0x9F, 0xFA, 0x98, 0xB4, 0xA5, 0x9C, 0x5B, 0xBE, 0x3A, 0x95, 0x26, 0x39, 0xA1, 0xE1, 0x0C,
+    0x5A, 0x27, 0xBB, 0x82, 0x59, 0x8D, 0x7C, 0x34, 0x2D, 0xB6, 0x67, 0x0E, 0xA6, 0x55, 0x7C, 0xBA,
+    0x9D, 0xB0, 0xCE, 0x71, 0x2B, 0xF9, 0xC7, 0x7B, 0x59, 0x65, 0x0D, 0x59, 0x91, 0xB6, 0xA8, 0x49,
+    0x06, 0x94, 0xFC, 0xE9, 0x89, 0x1C, 0xF3, 0xE7, 0x88, 0x76, 0x42, 0x13, 0x50, 0x47, 0xE4, 0x7C,
+    0x0F, 0xD0, 0xC2, 0x0C, 0xD0, 0x0E, 0xED, 0x04, 0xE5, 0x51, 0xC7, 0xAF, 0x31, 0xA2, 0xE4, 0x83,
+    0x24, 0x60, 0x06, 0x12, 0x68, 0x27, 0x95, 0xF6, 0x53, 0xED, 0x8E, 0x9F, 0x84, 0x60, 0x07, 0x35,
+    0xA1, 0x64, 0xEE, 0x04, 0xF6, 0x43, 0xC3, 0x24, 0x6F, 0xCC, 0x49, 0x6E, 0x26, 0x27, 0xD3, 0x7F,
+    0xFB, 0xF3, 0x26, 0x6E, 0x7D, 0xCC, 0xC7, 0x03, 0x8C, 0x2D, 0x0D, 0x19, 0x6F, 0x61, 0x6C, 0x91,
+    0xEC, 0x70, 0x67, 0x13, 0xD7, 0x8C, 0x2D, 0xD3, 0xBA, 0x20, 0xD9, 0xE9, 0x75, 0xA1, 0x98, 0x63,
+    0x28, 0x07, 0x69, 0x5B, 0x9A, 0x70, 0x80, 0xB1, 0x05, 0xDF, 0x5D, 0x33, 0x9E, 0x78, 0xB4, 0xA4,
+    0x47, 0xB9, 0x4F, 0x61, 0x93, 0x83, 0xA2, 0x82, 0x8C, 0x92, 0x8C, 0x2D, 0x19, 0x94, 0xDF, 0xF4,
+    0xCA, 0x1D, 0xA0, 0xA6, 0xF1, 0x40, 0xCB, 0x1E, 0x92, 0x3E, 0x7B, 0x5E, 0xC9, 0x11, 0x0D, 0x7D,
+    0x26, 0xBB, 0x6A, 0x52, 0xB6, 0x52, 0x04, 0xB7, 0x21, 0xF8, 0x3C, 0x64, 0x32, 0xF9, 0xD9, 0xF3,
+    0x86, 0x1C, 0x0F, 0x33, 0x01, 0x1B, 0x1D, 0xD4, 0x5B, 0x54, 0x57, 0x3F, 0xE5, 0x1F, 0xC0, 0xF3,
+    0xCD, 0xD3, 0x81, 0x8F, 0x5E, 0x8D, 0xEA, 0x25, 0xF7, 0x67, 0x87, 0xB2, 0x07, 0xEC, 0xF3, 0x24,
+    0x1A, 0x7D, 0xF4, 0x2A, 0x64, 0xF8, 0xD2, 0xFE, 0x5B, 0xBF, 0x65, 0x26, 0x4D, 0xA7, 0x39, 0x68,
+    0x76, 0xDA, 0x63, 0xA6, 0x68, 0xCD, 0xDC, 0xBF, 0x2E, 0xE7, 0xFB, 0xE5, 0xB0, 0x8B, 0x99, 0xF5,
+    0xAD, 0xF6, 0x83, 0x05, 0x67, 0x08, 0xA3, 0xCA, 0x07, 0x64, 0x97, 0x41, 0xBE, 0xC8, 0x6C, 0xDE,
+    0xF1, 0xDD, 0x53, 0x80, 0xF4, 0x19, 0x6F, 0x22, 0x32, 0x17, 0x4A, 0x8F, 0x9C, 0x2A, 0xE9, 0xA1,
+    0x46, 0xF0, 0x5D, 0x43, 0xC8, 0x09, 0xCA, 0x15, 0x1C, 0x45, 0x84, 0x0C, 0x68, 0x43, 0xC1, 0x4E,
+    0x10, 0x15, 0xA1, 0xE7, 0x44, 0xBB, 0xD6, 0x41, 0x39, 0x68, 0x97, 0xAF, 0x55, 0xF9, 0x9A, 0x10,
+    0xEC, 0x74, 0xCC, 0x37, 0x8D, 0x54, 0x19, 0xE8, 0x47, 0xC9, 0x01, 0x92, 0xA4, 0xE0, 0x00, 0x41,
+    0xFA, 0x7D, 0x42, 0x8A, 0xD9, 0xDE, 0x9B, 0xC3, 0x71, 0xAB, 0x6C, 0xB8, 0x95, 0xE7, 0xE0, 0x33,
+    0xEF, 0x26, 0xC9, 0xEB, 0xDD, 0xAC, 0x40, 0x8E, 0x6A, 0x56, 0x4A, 0x66, 0x65, 0xF2, 0x2A, 0x17,
+    0x0B, 0xFD, 0xC1, 0x23, 0xBC, 0x14, 0xB2, 0x0C, 0x8C, 0x83, 0x60, 0xA6, 0x99, 0x93, 0x01, 0x92,
+    0xF9, 0xE4, 0x9A, 0x07, 0x77, 0x17, 0x3A, 0xD2, 0x42, 0xCE, 0x44, 0xC6, 0x8A, 0xCC, 0xFC, 0x3C,
+    0xA4, 0x53, 0x0E, 0x82, 0xDC, 0x43, 0xEE, 0x60, 0x3E, 0x5C, 0xCE, 0xFD, 0x4B, 0xEE, 0x4C, 0x3E,
+    0xAA, 0xBC, 0xFB, 0x54, 0x9E, 0x04, 0xA3, 0x47, 0x4D, 0xD2, 0xCD, 0xBD, 0x4B, 0xCD, 0x77, 0x4D,
+    0x44, 0x1D, 0x21, 0x13, 0xEA, 0x88, 0x9C, 0x38, 0x5B, 0xF1, 0x33, 0x94, 0x69, 0x2E, 0x71, 0xF7,
+    0x69, 0x00, 0x7A, 0x9A, 0x9D, 0x45, 0x25, 0xD7, 0xB9, 0x41, 0x37, 0x05, 0x05, 0x68, 0xD1, 0x78,
+    0xDA, 0x19, 0x40, 0x39, 0xD2, 0x16, 0xB4, 0xB4, 0x82, 0xA0, 0x95, 0x31, 0xBB, 0xAD, 0x32, 0x50,
+    0xC8, 0x72, 0x00, 0xFF, 0x61, 0x8E, 0x15, 0x83, 0x4C, 0xAB, 0xB4, 0xA5, 0xCB, 0x39, 0x63, 0x69,
+    0x04, 0xAD, 0x76, 0xA0, 0x55, 0xEB, 0x8C, 0xA5, 0xFA, 0xD6, 0x8C, 0xA5, 0x89, 0x16, 0x2A, 0x64,
+    0x06, 0xF1, 0x23, 0xA7, 0x30, 0xFB, 0x17, 0x32, 0xF4, 0x4D, 0xA4, 0x35, 0xF0, 0xF8, 0xE6, 0x38,
+    0x0F, 0x2D, 0x24, 0x95, 0x43, 0xCD, 0xDD, 0x00, 0xC1, 0xAB, 0x44, 0xC9, 0x40, 0x0B, 0x52, 0x39,
+    0x18, 0xEE, 0x06, 0x28, 0x5E, 0x25, 0xD4, 0xE5, 0x40, 0xDB, 0xBC, 0x4F, 0xE5, 0xA4, 0x37, 0xBB,
+    0xA1, 0x0A, 0xEA, 0x2A, 0x45, 0x92, 0x81, 0x2F, 0x50, 0x50, 0x39, 0xF6, 0xDC, 0x0D, 0xDA, 0xAA,
+    0xAB, 0x54, 0xA3, 0x0C, 0xBC, 0xE4, 0x04, 0x15, 0x3D, 0xB8, 0xCB, 0x00, 0x75, 0x95, 0x09, 0x32,
+    0x90, 0x10, 0x54, 0xEC, 0xC1, 0x5D, 0x5A, 0xA8, 0xAB, 0x73, 0xB6, 0x6C, 0x4E, 0x5B, 0x2A, 0x08,
+    0xA8, 0x51, 0x8D, 0x28, 0x79, 0x25, 0x73, 0x43, 0x77, 0x40, 0x73, 0x10, 0xDB, 0x91, 0x7B, 0x2C,
+    0xF3, 0x2A, 0x3B, 0xC8, 0xD0, 0x7A, 0x14, 0xEC, 0x69, 0xA1, 0x5C, 0x1D, 0x21, 0x12, 0xB4, 0x83,
+    0xB1, 0x82, 0x9D, 0x0C, 0x68, 0x7C, 0xC1, 0x2E, 0x4B, 0xB5, 0x8A, 0x22, 0x01, 0xCA, 0x19, 0x8B,
+    0x82, 0x47, 0x3D, 0x20, 0x23, 0xBB, 0x8C, 0xF9, 0x80, 0x60, 0x8E, 0xAD, 0xDB, 0x95, 0x4F, 0x30,
+    0xBB, 0x77, 0x39, 0xCE, 0xBE, 0xCA, 0x7C, 0x09, 0xE4, 0x38, 0x27, 0x09, 0x22, 0x67, 0xB4, 0x1E,
+    0xFB, 0xFC, 0xF9, 0xE5, 0x5F, 0xB0, 0xB8, 0x25, 0x23, 0x9D, 0x64, 0xCA, 0xCD, 0xEC, 0x23, 0x8A,
+    0x62, 0xD9, 0xDF, 0x44, 0x71, 0x6A, 0xE7, 0x8C, 0xFD, 0xCA, 0x7D, 0x0C, 0x5D, 0x49, 0xC1, 0x41,
+    0x4F, 0x2A, 0x7B, 0xD1, 0xEB, 0xA0, 0x1D, 0xCC, 0x4B, 0x2B, 0xA5, 0x2A, 0xAF, 0x8C, 0xB3, 0xEF,
+    0x36, 0x7B, 0xA7, 0x2C, 0xFE, 0x44, 0xF2, 0x5D, 0x03, 0x4D, 0xBA, 0x62, 0xC6, 0x97, 0xEE, 0x00,
+    0x8B, 0x79, 0x80, 0xDD, 0x4F, 0xD0, 0x5E, 0x45, 0xF1, 0xE6, 0xE2, 0x0C, 0x97, 0xFD, 0x7A, 0xEF,
+    0x36, 0xAA, 0xD4, 0xB0, 0xAF, 0xA2, 0xE1, 0x58, 0x91, 0x9C, 0x2A, 0x5E, 0x67, 0xA8, 0x68, 0xDB,
+    0x50, 0xB1, 0x93, 0xE1, 0x0B, 0x66, 0x69, 0xAF, 0x1E, 0x76, 0x19, 0x56, 0x45, 0x1B, 0x00, 0x95,
+    0x61, 0x4F, 0x2E, 0x13, 0x93, 0x64, 0x8E, 0xB3, 0xE3, 0x3B, 0x68, 0x32, 0xD4, 0x92, 0x3D, 0xDA,
+    0x11, 0x62, 0x3A, 0x80, 0x1E, 0xB9, 0x48, 0x06, 0x4D, 0x5E, 0xE4, 0xF2, 0xB4, 0x1E, 0x51, 0x25,
+    0xE0, 0xB3, 0x2F, 0x50, 0x3C, 0xDB, 0x41, 0xEF, 0xD3, 0xC1, 0x35, 0xFC, 0xE1, 0xDF, 0x28, 0x3F,
+    0x53, 0xC1, 0x8D, 0x80, 0x21, 0xFB, 0xF5, 0xFB, 0xA7, 0x8B, 0x4E, 0xAF, 0xD2, 0x9D, 0x02, 0xEE,
+    0x68, 0xF8, 0xAE, 0xAF, 0x49, 0x5F, 0xE6, 0xE1, 0xFB, 0x6D, 0xE0, 0x18, 0xF0, 0x6B, 0x3F, 0x40,
+    0xC3, 0x74, 0x7F, 0xCE, 0xBD, 0x9A, 0xF4, 0x78, 0xF8, 0x45, 0xE6, 0x06, 0xDA, 0x70, 0x07, 0x2D,
+    0xA7, 0x35, 0xA0, 0x6A, 0x73, 0x0D, 0xA8, 0xFA, 0x3B, 0x94, 0x6C, 0x7F, 0x6E, 0x82, 0x21, 0x5F,
+    0x59, 0x01, 0xAA, 0x36, 0x3A, 0x14, 0x22, 0xEA, 0x1B, 0x54, 0xC3, 0x29, 0x00, 0xFA, 0x9D, 0xF4,
+    0x71, 0xFF, 0x77, 0x14, 0x62, 0x0A, 0xEA, 0xC7, 0x6F, 0xED, 0x25, 0x75, 0x74, 0xD8, 0xF9, 0x97,
+    0xF9, 0xA9, 0x4C, 0xD0, 0xE3, 0x67, 0x2D, 0xB0, 0x81, 0x2A, 0xC2, 0x8C, 0x75, 0x82, 0x1E, 0x56,
+    0xBC, 0x4B, 0x5F, 0x24, 0xF3, 0xAE, 0x89, 0xE4, 0x2E, 0x3D, 0x53, 0xBD, 0x9E, 0xE1, 0x60, 0x86,
+    0x16, 0xA3, 0xCE, 0x63, 0x6E, 0x39, 0x8F, 0xC9, 0xE6, 0x5D, 0x93, 0x69, 0x03, 0xF3, 0x9D, 0xF7,
+    0x82, 0x8B, 0x0E, 0x22, 0xCD, 0x99, 0x9E, 0xBD, 0x22, 0x03, 0xD4, 0x20, 0x49, 0x5A, 0x39, 0x09,
+    0x2E, 0xE8, 0x44, 0x9C, 0xFB, 0xDD, 0x4E, 0xB9, 0x92, 0xBD, 0xB6, 0x32, 0xC0, 0x8C, 0xCA, 0x09,
+    0x42, 0x5F, 0x63, 0x00, 0x2F, 0x33, 0x30, 0x42, 0x91, 0x51, 0x11, 0x92, 0x8C, 0x32, 0x41, 0x90,
+    0xB7, 0xD2, 0xA2, 0xEA, 0x11, 0x33, 0x99, 0xDD, 0xA7, 0x2E, 0xAE, 0x9F, 0xE1, 0xBB, 0xFF, 0x01,
+    0x9A, 0x24, 0x39, 0xE4, 0xC5, 0x94, 0x17, 0x41, 0x8F, 0xA0, 0x6D, 0xA2, 0x1E, 0x41, 0x5B, 0xA7,
+    0x83, 0x0B, 0x19, 0xF5, 0x08, 0xBE, 0x9B, 0x0F, 0x21, 0x7D, 0x5E, 0x8C, 0x7A, 0x04, 0x99, 0x6E,
+    0x8B, 0x47, 0x6E, 0xF3, 0xD9, 0xB5, 0x67, 0x7B, 0xEE, 0x24, 0xCA, 0x84, 0x5B, 0x60, 0xA6, 0x7A,
+    0x04, 0x5F, 0x66, 0x5F, 0xA7, 0x2A, 0x41, 0xB9, 0xC6, 0x0B, 0x42, 0x8F, 0xED, 0x54, 0xF0, 0x09,
+    0xF6, 0x55, 0x6A, 0x02, 0x1A, 0x72, 0x80, 0x26, 0x57, 0xC9, 0xAE, 0x26, 0xA0, 0xF1, 0x6A, 0x3F,
+    0xD9, 0xD5, 0x55, 0x09, 0x74, 0x8D, 0x07, 0x47, 0x3D, 0x16, 0x7C, 0x99, 0x7D, 0x49, 0xBB, 0xDF,
+    0xD5, 0xB5, 0xAB, 0xAE, 0xAE, 0x20, 0x32, 0xCB, 0xF4, 0xFE, 0x2F, 0x17, 0x99, 0x28, 0x4E, 0x8F,
+    0x15, 0xAF, 0x25, 0x90, 0x7A, 0x6C, 0x78, 0x2D, 0x93, 0x8D, 0x68, 0x73, 0x2D, 0xCA, 0xAB, 0xD4,
+    0xAF, 0x44, 0x75, 0x2D, 0xAA, 0x0B, 0xD4, 0x6F, 0x4C, 0xEA, 0x5A, 0xA4, 0xA0, 0xE6, 0xA0, 0xAE,
+    0xD1, 0x0B, 0x6A, 0x42, 0x5D, 0xE3, 0x28, 0xA8, 0x03, 0xD4, 0x35, 0xF6, 0x82, 0x38, 0xDE, 0x1F,
+    0xD9, 0x81, 0x74, 0x72, 0x82, 0x60, 0x1D, 0x00, 0xCD, 0x08, 0x54, 0x8C, 0x1F, 0x06, 0x9A, 0x78,
+    0x54, 0xAC, 0x72, 0x5A, 0xFA, 0x00, 0xDA, 0xD6, 0x43, 0x8F, 0x82, 0x68, 0x27, 0x98, 0x41, 0x06,
+    0x34, 0xBE, 0xCA, 0x9C, 0xF1, 0x80, 0xB1, 0xB4, 0x99, 0xEE, 0xB1, 0x64, 0xEB, 0xE6, 0x98, 0x9A,
+    0xBC, 0x11, 0x81, 0x92, 0x04, 0xA0, 0xD8, 0xCF, 0x41, 0xB5, 0x82, 0x6B, 0xFD, 0x5F, 0x86, 0xD5,
+    0x7D, 0x17, 0x04, 0x8A, 0x4C, 0xBB, 0x9A, 0x13, 0x35, 0x87, 0x19, 0xC4, 0x58, 0xAE, 0x87, 0xCD,
+    0xC6, 0x43, 0x5D, 0x4B, 0x90, 0x91, 0xBD, 0xA0, 0x1E, 0xC1, 0x4B, 0x9F, 0x63, 0xC3, 0x6C, 0xD6,
+    0x5D, 0x9A, 0x43, 0x02, 0x01, 0xAD, 0xCB, 0x99, 0x3A, 0x25, 0x67, 0xB9, 0xDF, 0x7D, 0x12, 0xCA,
+    0x41, 0xB9, 0x55, 0x8E, 0x48, 0xA6, 0x4C, 0x54, 0xD3, 0xC1, 0xE5, 0x04, 0xE5, 0x73, 0xAE, 0x41,
+    0xEB, 0xD1, 0x04, 0xE5, 0xD1, 0x04, 0x34, 0xBE, 0x0D, 0x68, 0x02, 0x5A, 0xDF, 0x04, 0xA8, 0x90,
+    0x13, 0xF7, 0x55, 0x84, 0x9A, 0x64, 0x84, 0x4E, 0x19, 0x48, 0x4D, 0x42, 0xB9, 0x8A, 0x20, 0xA1,
+    0x47, 0xC1, 0x82, 0xEC, 0xCC, 0x50, 0xF2, 0x41, 0xB2, 0xA7, 0x2D, 0x78, 0x21, 0x66, 0xCD, 0xE7,
+    0x62, 0xE0, 0xCB, 0xEC, 0x61, 0x2E, 0x7B, 0xFD, 0x13, 0x02, 0xEA, 0xC6, 0xA4, 0xAE, 0x25, 0xA0,
+    0xA5, 0x6B, 0x18, 0x01, 0xC9, 0x51, 0xCE, 0xD1, 0xE8, 0x8A, 0x13, 0x20, 0x68, 0x05, 0x47, 0xA0,
+    0xA4, 0x2D, 0xF6, 0x89, 0xA1, 0x9B, 0xCC, 0x86, 0x70, 0x31, 0x65, 0xB3, 0x62, 0x36, 0x30, 0x94,
+    0x03, 0x07, 0x41, 0x19, 0xD0, 0x4E, 0x05, 0x9F, 0x64, 0x57, 0x25, 0xE8, 0x51, 0x8F, 0x05, 0x6D,
+    0x3B, 0xC9, 0x00, 0xE3, 0x64, 0x10, 0x84, 0x8A, 0x22, 0x41, 0x0F, 0x2D, 0x9F, 0x60, 0x27, 0xBD,
+    0xA4, 0x33, 0xB6, 0xA4, 0x64, 0x50, 0x23, 0xF4, 0xEB, 0x81, 0x8F, 0x3A, 0xC8, 0x1B, 0xB1, 0xBD,
+    0x12, 0x50, 0x90, 0x82, 0x11, 0x50, 0xEC, 0x4C, 0x02, 0x2A, 0x5A, 0x99, 0xE7, 0x6A, 0x2B, 0xD8,
+    0xCF, 0xD3, 0x2C, 0xAC, 0x63, 0x8E, 0xE5, 0x19, 0x2E, 0x4F, 0x66, 0x98, 0x83, 0x22, 0xD9, 0x65,
+    0x7C, 0xCC, 0x3E, 0x85, 0x01, 0xD4, 0xF5, 0x67, 0x01, 0x49, 0xC6, 0x9C, 0x34, 0x9A, 0xC9, 0x84,
+    0xD4, 0xDE, 0x09, 0x0E, 0x32, 0x40, 0xF9, 0x6C, 0x3A, 0xD0, 0x66, 0x45, 0x48, 0xBB, 0x79, 0x63,
+    0xA7, 0x23, 0x38, 0x83, 0xD8, 0x09, 0x39, 0xF3, 0x10, 0xFF, 0xEC, 0x23, 0x22, 0x9E, 0x1D, 0x32,
+    0x49, 0xD1, 0xEA, 0x40, 0x5A, 0x7C, 0x9B, 0x8B, 0xED, 0x9B, 0x8E, 0x9C, 0xD9, 0x90, 0xB3, 0xFD,
+    0x91, 0x2F, 0xD4, 0xCA, 0xB8, 0x30, 0xB7, 0xFC, 0xBA, 0x19, 0x65, 0xFA, 0x23, 0x4E, 0x62, 0x85,
+    0xDC, 0x08, 0x50, 0x07, 0xFA, 0x54, 0x5A, 0x14, 0x86, 0x3D, 0x2D, 0x1A, 0x32, 0x64, 0x47, 0x54,
+    0xA0, 0x2D, 0xF3, 0x14, 0x0E, 0x35, 0x87, 0xCD, 0x89, 0x56, 0x26, 0xE0, 0x4E, 0xDA, 0x36, 0x00,
+    0xA0, 0x55, 0x59, 0xED, 0xCE, 0x39, 0x1D, 0xAF, 0x99, 0x0F, 0x16, 0x8B, 0x3C, 0x29, 0x4B, 0xBA,
+    0x75, 0xF1, 0x2E, 0xAF, 0x2F, 0x9F, 0xCD, 0xEC, 0x00, 0xFB, 0x5F, 0x58, 0x7D, 0x5D, 0xE5, 0x93,
+    0x35, 0x99, 0xCD, 0x5E, 0x72, 0x28, 0x9E, 0xA3, 0xAD, 0xF2, 0xCF, 0x16, 0x79, 0x01, 0x9D, 0x17,
+    0x2B, 0x5A, 0xEE, 0x6C, 0x53, 0x17, 0xDF, 0xE9, 0xCC, 0x80, 0x96, 0xD1, 0x0C, 0x05, 0x19, 0xCD,
+    0x50, 0x91, 0xC1, 0x0C, 0x92, 0xF7, 0x3F, 0x67, 0x86, 0x26, 0x00, 0x66, 0x68, 0x27, 0xC0, 0x8C,
+    0x6A, 0xE5, 0xE4, 0xB2, 0x37, 0x95, 0xD7, 0xCD, 0xF5, 0x65, 0x6F, 0x06, 0xE5, 0xD6, 0x47, 0x0E,
+    0x4D, 0xC0, 0x1D, 0x66, 0x90, 0xFC, 0xEB, 0x73, 0x66, 0x10, 0x64, 0x30, 0x43, 0x41, 0x06, 0x33,
+    0xA0, 0xC9, 0x6C, 0x94, 0x77, 0xAD, 0x40, 0x5A, 0x99, 0x86, 0x6E, 0x46, 0x8E, 0x08, 0x26, 0x00,
+    0x65, 0xD2, 0x16, 0x00, 0x8F, 0x4E, 0x00, 0xF4, 0x8B, 0x09, 0x40, 0x3B, 0x2A, 0x8B, 0xDC, 0x5F,
+    0xA1, 0x0E, 0x25, 0xF3, 0x6D, 0xB2, 0x28, 0xB8, 0x9F, 0x22, 0x04, 0x75, 0x83, 0x66, 0x40, 0xE3,
+    0xF8, 0xB0, 0x87, 0xF4, 0xEA, 0x65, 0x42, 0x44, 0x39, 0xA9, 0xA1, 0xA4, 0x88, 0x75, 0x00, 0x7B,
+    0xDE, 0x4F, 0xE8, 0x41, 0x0D, 0x6A, 0x6C, 0x9D, 0x9C, 0xEA, 0x20, 0x83, 0x88, 0x05, 0x1F, 0x8A,
+    0x60, 0xA7, 0xAE, 0x12, 0x6A, 0xA8, 0xC3, 0x7A, 0x80, 0x06, 0x32, 0xA4, 0x1C, 0x9A, 0x16, 0x90,
+    0xD7, 0x02, 0x50, 0xB0, 0x1D, 0x81, 0x76, 0x20, 0x20, 0x42, 0x3D, 0x01, 0xA6, 0xD7, 0x36, 0x37,
+    0xD9, 0x62, 0xC5, 0x06, 0x4A, 0x54, 0xC1, 0xEC, 0x7A, 0x98, 0xA7, 0x83, 0xB6, 0x72, 0xD2, 0x17,
+    0x62, 0xC9, 0x2A, 0xB4, 0x4E, 0x8D, 0xFA, 0x05, 0x3E, 0x14, 0xAB, 0x20, 0x3D, 0xAD, 0xB6, 0xC6,
+    0xD2, 0x42, 0x70, 0x84, 0x98, 0x89, 0xF8, 0xE4, 0x9C, 0xA9, 0xA7, 0x5C, 0x16, 0x02, 0x2D, 0x9A,
+    0xAB, 0xB3, 0x6E, 0xF7, 0x4C, 0xCE, 0xA8, 0x09, 0x8D, 0x83, 0x72, 0x59, 0x14, 0xB4, 0x60, 0x67,
+    0x7A, 0xC1, 0xC5, 0x23, 0xA1, 0x58, 0x4D, 0x21, 0x91, 0x1B, 0xEC, 0x8A, 0x2C, 0x96, 0x74, 0x82,
+    0x4B, 0x73, 0x83, 0x66, 0x94, 0x01, 0x94, 0xDE, 0x58, 0xE5, 0xEA, 0xA0, 0x46, 0x76, 0xB4, 0x6A,
+    0xE4, 0x53, 0x49, 0xB0, 0xA0, 0x48, 0x75, 0x90, 0x73, 0x30, 0x4D, 0x39, 0x35, 0xAA, 0x51, 0x39,
+    0xBE, 0x48, 0xB0, 0x37, 0x17, 0x28, 0x83, 0x48, 0xE0, 0x33, 0x41, 0x8F, 0xD2, 0x0B, 0xAA, 0xF7,
+    0xD9, 0xA9, 0x71, 0x9D, 0xAE, 0xD2, 0x38, 0x08, 0x8E, 0xA8, 0x02, 0x0A, 0x06, 0x14, 0xCC, 0x18,
+    0x74, 0x6D, 0xA1, 0x2E, 0x39, 0x34, 0x0E, 0xED, 0x5B, 0x11, 0x55, 0x80, 0x74, 0xDA, 0x16, 0x44,
+    0x1D, 0xA4, 0xCB, 0x5A, 0x43, 0xCA, 0x13, 0x0D, 0xE5, 0x96, 0x49, 0x4E, 0x05, 0x97, 0xE6, 0x4A,
+    0x22, 0xB4, 0x6D, 0xDF, 0x4F, 0x6A, 0x68, 0x9C, 0x9C, 0xCC, 0xF7, 0x7D, 0x15, 0xAA, 0xD0, 0xBE,
+    0xC9, 0x82, 0x82, 0xB5, 0x57, 0xA3, 0xB6, 0x7C, 0x20, 0xD5, 0xA1, 0x71, 0xC6, 0x9A, 0x9E, 0x0F,
+    0x05, 0x35, 0xB6, 0xA3, 0x72, 0xF3, 0x54, 0x45, 0x92, 0xEB, 0x07, 0x9B, 0xF3, 0x8F, 0x00, 0xE6,
+    0xA7, 0x0B, 0x3D, 0x01, 0xC6, 0x16, 0x79, 0x76, 0x21, 0xE9, 0x01, 0xD0, 0xE6, 0xD1, 0xE7, 0x99,
+    0x9C, 0x9F, 0xC9, 0x01, 0xC0, 0x61, 0xB2, 0xCF, 0x3A, 0xD8, 0x98, 0x4D, 0xF5, 0x11, 0xB3, 0xAF,
+    0x4F, 0x26, 0xF5, 0x7E, 0x86, 0x23, 0x5D, 0x20, 0x04, 0x05, 0xAB, 0x04, 0x19, 0x64, 0xC8, 0x30,
+    0x23, 0xD7, 0x4E, 0x82, 0xA0, 0xD5, 0xA3, 0x0C, 0xEB, 0x95, 0x92, 0x0F, 0x12, 0xCA, 0x55, 0x49,
+    0x86, 0x4C, 0x90, 0x8E, 0xD9, 0xD7, 0xC2, 0x4C, 0xE0, 0xDB, 0x66, 0x96, 0x37, 0xA8, 0x11, 0x6A,
+    0x6C, 0x1D, 0x44, 0x6C, 0x5D, 0x06, 0xB3, 0x40, 0x32, 0x20, 0x67, 0x1F, 0x36, 0x64, 0xC8, 0x3E,
+    0x95, 0x2A, 0x98, 0x67, 0x9C, 0x88, 0xED, 0x4F, 0x12, 0x58, 0x7B, 0x65, 0xF5, 0x93, 0x49, 0x4E,
+    0x6A, 0x30, 0x4F, 0x26, 0xE9, 0xDA, 0x51, 0xBD, 0xE4, 0x6B, 0x2F, 0x27, 0xDA, 0x5C, 0x73, 0xE5,
+    0xB2, 0x20, 0x64, 0x10, 0xF3, 0x64, 0x21, 0xB3, 0x2C, 0x68, 0xEB, 0xB4, 0xF8, 0x36, 0x3B, 0xE5,
+    0xB2, 0x38, 0xB2, 0xBF, 0x25, 0x13, 0x53, 0xB1, 0xCF, 0xB4, 0x47, 0xD9, 0xA8, 0xFF, 0x60, 0xF1,
+    0x6D, 0xCE, 0xCE, 0x16, 0xD2, 0xCF, 0x9E, 0x91, 0xDC, 0x17, 0xE7, 0xEE, 0xF8, 0xFA, 0x99, 0x0C,
+    0x6E, 0x0C, 0xE0, 0x5B, 0x6C, 0x83, 0xE0, 0x2C, 0x1D, 0x5A, 0xE5, 0x94, 0xD3, 0xA3, 0x72, 0x59,
+    0x40, 0x32, 0xD4, 0x51, 0xB0, 0xE4, 0x83, 0x9C, 0x45, 0x43, 0x4B, 0xAB, 0x9C, 0x0C, 0xCA, 0x99,
+    0x51, 0x06, 0xC1, 0xA3, 0x21, 0x6B, 0xA9, 0x6F, 0xF1, 0xA0, 0xA4, 0x50, 0xB0, 0x24, 0xC9, 0x8B,
+    0xA1, 0x26, 0x99, 0x1A, 0x27, 0x49, 0x3A, 0x6D, 0xE5, 0x54, 0xB2, 0x20, 0x1A, 0x27, 0xA7, 0x2A,
+    0xA0, 0x75, 0xEC, 0x1B, 0x07, 0x75, 0x25, 0xE4, 0x0A, 0x0E, 0x45, 0xBE, 0xCC, 0xDC, 0xA0, 0xC6,
+    0xE6, 0xFA, 0x19, 0x92, 0x83, 0xB6, 0xEA, 0xD5, 0x60, 0x5E, 0x20, 0x28, 0x1D, 0xAB, 0x50, 0x7B,
+    0xF5, 0x62, 0x6C, 0x9C, 0xB2, 0xAC, 0x82, 0x7E, 0x81, 0x22, 0xC8, 0xF7, 0x58, 0x7B, 0xE9, 0xDA,
+    0xD7, 0x83, 0x1A, 0x94, 0xD5, 0x16, 0xC7, 0x70, 0x78, 0x00, 0x61, 0x46, 0xA8, 0x17, 0x79, 0x12,
+    0xF2, 0xC6, 0x04, 0x08, 0x8E, 0x99, 0x04, 0xBA, 0xCA, 0x1C, 0xBD, 0xE4, 0xD8, 0x90, 0x9C, 0xEA,
+    0xB7, 0xA1, 0x7D, 0xB9, 0x72, 0x5C, 0x86, 0x15, 0x83, 0xA0, 0x72, 0xD8, 0x7A, 0x24, 0xE7, 0x51,
+    0x75, 0x99, 0x8F, 0x47, 0x91, 0x3D, 0x8E, 0x9C, 0xCD, 0x64, 0x81, 0x6B, 0x9E, 0xC0, 0x7D, 0x65,
+    0x57, 0xCE, 0x0E, 0xD3, 0x5F, 0x3B, 0x4B, 0x5F, 0xCE, 0xDC, 0x70, 0xEC, 0x73, 0x46, 0xD6, 0xDE,
+    0xB1, 0x6C, 0x6D, 0xCD, 0x6C, 0xE2, 0xE9, 0x4C, 0x42, 0xBB, 0x22, 0xD7, 0xEF, 0x0A, 0x73, 0x00,
+    0x8E, 0xBC, 0x05, 0xDD, 0x35, 0xBE, 0x48, 0x15, 0xFB, 0x7A, 0x2F, 0x01, 0x2A, 0x8F, 0x3A, 0x5D,
+    0x33, 0x8F, 0x1D, 0x53, 0xF5, 0x83, 0x4D, 0xF6, 0xF3, 0x45, 0xB2, 0x47, 0xA1, 0x1D, 0x5A, 0x86,
+    0x3C, 0x8D, 0x69, 0xA6, 0x2E, 0x35, 0x7E, 0x1E, 0x88, 0xEB, 0x3C, 0x8A, 0x14, 0x7F, 0xCC, 0x20,
+    0x48, 0xDE, 0x4F, 0x72, 0x50, 0xE4, 0x58, 0xA5, 0x45, 0xCE, 0x6E, 0xAE, 0x02, 0x00, 0x7D, 0xFD,
+    0xEC, 0xDB, 0x82, 0xF3, 0x54, 0xAA, 0x68, 0xB3, 0x01, 0x73, 0x07, 0xD4, 0x50, 0x79, 0xF0, 0xA8,
+    0x2F, 0x09, 0xF5, 0x56, 0x82, 0xB1, 0xD2, 0xB3, 0x6F, 0x9D, 0x48, 0x6A, 0xAC, 0x03, 0xF8, 0xCC,
+    0xC7, 0xED, 0x38, 0xEA, 0x4B, 0x42, 0xBF, 0x9A, 0x60, 0x6C, 0x33, 0xD1, 0xB6, 0x4E, 0x86, 0xC6,
+    0xD7, 0xA1, 0xA2, 0xE0, 0x2B, 0x3C, 0x9C, 0x3D, 0xC7, 0xEC, 0xF3, 0xAC, 0x02, 0xD0, 0x24, 0x7B,
+    0x14, 0x26, 0xB3, 0x2E, 0x1B, 0x8B, 0x55, 0xD2, 0xC2, 0x9C, 0x82, 0x3D, 0xA7, 0xA6, 0x1F, 0xDC,
+    0x91, 0xC7, 0xB9, 0xBC, 0xFE, 0xE9, 0xA5, 0xB1, 0xAD, 0x6B, 0xBC, 0xB1, 0xAD, 0x93, 0x61, 0xBF,
+    0xAC, 0x73, 0x19, 0x8D, 0x6D, 0x5D, 0x95, 0xCB, 0xB4, 0x5F, 0x8A, 0x74, 0xD3, 0x96, 0xA1, 0x75,
+    0x75, 0xD4, 0xAE, 0x75, 0x32, 0x28, 0xDF, 0x3A, 0x9D, 0xC3, 0x48, 0xF9, 0x09, 0x1D, 0x32, 0xE3,
+    0x23, 0x4E, 0x64, 0xA5, 0x21, 0x87, 0x0F, 0x3E, 0xEB, 0xB5, 0x7D, 0x5A, 0x82, 0xEC, 0x50, 0x72,
+    0x94, 0x09, 0xD0, 0xAE, 0x09, 0x40, 0xEB, 0xDB, 0x09, 0x59, 0xF3, 0x9B, 0xCB, 0x3A, 0x2A, 0x32,
+    0x87, 0x43, 0x6E, 0x2D, 0xF3, 0x5E, 0x07, 0xC8, 0x90, 0xBF, 0xD5, 0x04, 0xA0, 0xF1, 0x79, 0xFA,
+    0xBE, 0x8A, 0x7D, 0xF1, 0xA9, 0x09, 0xB2, 0xC5, 0x9F, 0x02, 0x05, 0xD9, 0xA3, 0x9D, 0x6B, 0x69,
+    0x1B, 0xFE, 0x88, 0x96, 0xA3, 0xE0, 0x83, 0x44, 0x95, 0x72, 0xEA, 0x2B, 0xC9, 0xF7, 0x48, 0xF2,
+    0x22, 0x49, 0x36, 0x69, 0x79, 0x76, 0x95, 0x91, 0x5D, 0xF2, 0x49, 0xDA, 0x26, 0x0A, 0xDE, 0xC8,
+    0x8C, 0x77, 0x99, 0xB3, 0xA7, 0x64, 0xCC, 0x68, 0x60, 0x63, 0x81, 0x7A, 0xCF, 0x8C, 0x80, 0x4A,
+    0xCA, 0x01, 0x26, 0x29, 0x07, 0x30, 0xB5, 0x13, 0x0A, 0xFE, 0x7D, 0x4E, 0x3A, 0x95, 0x01, 0x22,
+    0xBB, 0x40, 0x23, 0x44, 0x9A, 0x33, 0x51, 0xA5, 0x47, 0xC9, 0xAE, 0x9D, 0x00, 0xF6, 0x39, 0xAE,
+    0x91, 0xA7, 0x22, 0x34, 0x16, 0x50, 0x63, 0x76, 0x09, 0xB3, 0x07, 0x9A, 0xF7, 0x08, 0x40, 0xFE,
+    0x82, 0x98, 0xED, 0x96, 0x19, 0x7A, 0x2F, 0xE6, 0x72, 0xC2, 0xCA, 0x74, 0xC1, 0x0A, 0x9D, 0x74,
+    0x57, 0x3B, 0xA1, 0xE0, 0x45, 0x02, 0x74, 0xB4, 0x30, 0xA1, 0x9D, 0xA0, 0x6E, 0x88, 0x84, 0x76,
+    0xCA, 0xDD, 0x5A, 0x33, 0x89, 0x04, 0x91, 0xD6, 0xF6, 0x51, 0x33, 0xE9, 0x61, 0xE6, 0x7E, 0x37,
+    0xBB, 0x7E, 0xD6, 0x2C, 0xF2, 0x0C, 0x1C, 0x3A, 0x53, 0xE4, 0x5A, 0xE4, 0x39, 0x98, 0xA0, 0x1C,
+    0xB0, 0x79, 0xFA, 0xC8, 0x0E, 0x50, 0x45, 0xE5, 0x80, 0x82, 0x72, 0x02, 0xA0, 0x9F, 0xCA, 0x34,
+    0x48, 0x09, 0x40, 0x35, 0xB6, 0x1F, 0x82, 0xD4, 0xDE, 0x56, 0x32, 0x3A, 0xF2, 0xEF, 0x96, 0xC8,
+    0x60, 0x33, 0x98, 0xA7, 0x02, 0x50, 0x3B, 0xDD, 0x03, 0xA6, 0x9A, 0x80, 0x7A, 0xB8, 0xEF, 0xC0,
+    0x85, 0x6F, 0x9B, 0x01, 0x15, 0x9B, 0x00, 0xC1, 0x0B, 0x44, 0x49, 0x67, 0x06, 0xF0, 0xFF, 0x95,
+    0x3E, 0xF3, 0x39, 0x2A, 0x07, 0x3D, 0x48, 0x0F, 0xE9, 0xEB, 0x30, 0x63, 0x37, 0xF5, 0xCB, 0xEC,
+    0xF2, 0x14, 0x25, 0x25, 0xD5, 0x08, 0xA8, 0x4B, 0x6E, 0x1E, 0x44, 0xF3, 0xAC, 0x26, 0x2A, 0x87,
+    0x93, 0xFA, 0xFD, 0x4C, 0x9F, 0x7D, 0x70, 0xE6, 0x7A, 0x06, 0xBF, 0x72, 0x1F, 0x65, 0xA2, 0xD6,
+    0xAB, 0x79, 0x22, 0x93, 0x15, 0xB0, 0xF9, 0xC4, 0x9C, 0x03, 0x4C, 0x37, 0xCF, 0x56, 0x92, 0x41,
+    0x67, 0x53, 0xEB, 0x51, 0xA7, 0xD6, 0x03, 0xC6, 0x69, 0x97, 0xB3, 0x00, 0x0A, 0x5A, 0x0E, 0x05,
+    0x2F, 0xB0, 0x83, 0x60, 0xC9, 0xBE, 0x4E, 0x39, 0x6E, 0x29, 0x38, 0xCF, 0x9F, 0xA2, 0xA6, 0x3A,
+    0xCE, 0x4A, 0x08, 0x87, 0xC6, 0xD7, 0x51, 0x10, 0x98, 0xF7, 0xCE, 0x61, 0x4E, 0x33, 0xB0, 0x9F,
+    0x67, 0x5D, 0xE0, 0xF7, 0x23, 0xCC, 0x98, 0x39, 0x32, 0x94, 0x2B, 0xB2, 0x1F, 0xBC, 0x8A, 0xEC,
+    0x05, 0x7B, 0x68, 0x97, 0x27, 0x0A, 0xE5, 0x50, 0xB3, 0x47, 0x9B, 0x89, 0x11, 0x18, 0x32, 0x12,
+    0x35, 0x1B, 0x57, 0x30, 0x61, 0xB6, 0xA8, 0x32, 0x9A, 0x6E, 0x93, 0x19, 0xC6, 0xDA, 0xAD, 0xC0,
+    0xF5, 0x32, 0xDC, 0xE4, 0x8B, 0x5E, 0xD5, 0x7E, 0x7F, 0xA3, 0xDF, 0x0F, 0x2A, 0xDA, 0xF5, 0xEE,
+    0xFD, 0x7C, 0xE5, 0x7D, 0xA6, 0xAE, 0x8C, 0x7C, 0x2D, 0xFE, 0x74, 0x9D, 0x2A, 0xCD, 0xBE, 0x4E,
+    0x00, 0x6D, 0x4B, 0x0E, 0x32, 0xA0, 0x4E, 0x25, 0xC9, 0x41, 0x4D, 0x50, 0x4E, 0xF2, 0xDB, 0xB4,
+    0x7A, 0x04, 0x6D, 0x4E, 0x76, 0xB7, 0x75, 0x14, 0x44, 0xC5, 0x92, 0x9D, 0xCA, 0xB1, 0x20, 0x91,
+    0x90, 0xB9, 0xEF, 0x9D, 0x0C, 0x75, 0x2C, 0xD8, 0x83, 0xB6, 0x99, 0x94, 0xAB, 0x12, 0x04, 0xA1,
+    0x46, 0xF6, 0x4D, 0x80, 0x0C, 0x30, 0x17, 0xC3, 0x6C, 0xB0, 0x53, 0x3B, 0x70, 0x28, 0xD9, 0x8B,
+    0xC4, 0xAE, 0xA4, 0x95, 0x11, 0x15, 0x03, 0x04, 0xDF, 0xA5, 0x83, 0xE4, 0x88, 0x8A, 0x99, 0xF4,
+    0xA0, 0xCB, 0x7D, 0x0A, 0x54, 0x40, 0x1E, 0xFD, 0xF2, 0x93, 0xBC, 0x75, 0x53, 0xC5, 0x9B, 0xB5,
+    0x5C, 0xD6, 0x35, 0x5C, 0x03, 0x24, 0xDB, 0x35, 0x9B, 0xBE, 0x59, 0xB9, 0x25, 0x4A, 0xAE, 0xE4,
+    0x54, 0xCF, 0x6D, 0x25, 0xF3, 0x69, 0x66, 0x74, 0xFE, 0xE1, 0x3C, 0xEB, 0x05, 0xE9, 0x73, 0x86,
+    0x5B, 0x1E, 0xBF, 0x02, 0x14, 0xCD, 0x15, 0x5A, 0x95, 0xEA, 0x81, 0x93, 0x4C, 0x80, 0x64, 0x4D,
+    0xCC, 0x58, 0xE0, 0xDC, 0x9C, 0x20, 0x53, 0x26, 0xD7, 0xDE, 0x0D, 0x00, 0xCC, 0x55, 0x02, 0x68,
+    0x43, 0xCE, 0xFD, 0xCE, 0x3B, 0x9E, 0x49, 0x00, 0xF8, 0x13, 0x5A, 0x40, 0x4F, 0xDA, 0x03, 0x2A,
+    0x48, 0xDE, 0x7F, 0xB2, 0x4D, 0x05, 0xAF, 0x53, 0x13, 0xED, 0x7A, 0x66, 0x44, 0x76, 0x68, 0x72,
+    0xAB, 0xCE, 0x88, 0x85, 0xCC, 0x53, 0x82, 0x7A, 0xB8, 0x15, 0x93, 0x2E, 0xED, 0x4A, 0x99, 0xD1,
+    0x9C, 0xB0, 0x62, 0x21, 0xC8, 0x76, 0x2E, 0xAD, 0x79, 0x2F, 0xA8, 0x49, 0x4D, 0x79, 0x1A, 0x09,
+    0xF0, 0x22, 0x91, 0x69, 0x0C, 0x64, 0xD0, 0x63, 0xA6, 0x36, 0x00, 0x2F, 0x10, 0x50, 0x8E, 0xC3,
+    0x76, 0xEB, 0x9B, 0xA0, 0x1F, 0x8D, 0x79, 0xBE, 0x04, 0x35, 0x0F, 0x52, 0x09, 0x33, 0xBB, 0x46,
+    0x3B, 0xCC, 0xB3, 0xAF, 0x01, 0xB8, 0x7B, 0x67, 0x25, 0xE5, 0x71, 0xF5, 0x58, 0x5E, 0x5F, 0x3D,
+    0x94, 0x2E, 0xCF, 0x57, 0x9D, 0xA3, 0x19, 0x38, 0xD2, 0xDE, 0xBF, 0x8D, 0xFD, 0xA1, 0x7E, 0x4E,
+    0x4A, 0x04, 0xE6, 0x94, 0xDE, 0x75, 0x0D, 0x00, 0xAC, 0xB3, 0x59, 0xFE, 0x64, 0x7E, 0x6A, 0x77,
+    0xD0, 0x26, 0x40, 0x90, 0xB6, 0xCD, 0x26, 0x5B, 0x28, 0xE7, 0xCC, 0xF7, 0x4E, 0x92, 0x43, 0xCD,
+    0xEE, 0x6F, 0x70, 0xB2, 0xE1, 0x7C, 0xD3, 0xD5, 0xD4, 0xCC, 0xDA, 0xC4, 0x93, 0x59, 0xD1, 0xCA,
+    0xE3, 0x27, 0xE6, 0x1A, 0x1E, 0xDC, 0x60, 0x5E, 0x5D, 0xE5, 0x61, 0x28, 0x87, 0xCD, 0x67, 0xE7,
+    0x0D, 0x7A, 0xCC, 0x47, 0x54, 0x09, 0xE0, 0x8B, 0x99, 0xB3, 0x46, 0x86, 0xC6, 0xE7, 0x29, 0x30,
+    0x7A, 0x0E, 0xD0, 0x23, 0xD4, 0x24, 0x89, 0x3A, 0xA1, 0x26, 0x74, 0x2A, 0xE9, 0x2B, 0x8E, 0x65,
+    0xD6, 0xB6, 0xC3, 0x0A, 0xD1, 0x06, 0xB4, 0xE4, 0xA3, 0xA4, 0x05, 0x34, 0xFB, 0x96, 0x43, 0x06,
+    0x39, 0xE5, 0x20, 0xE8, 0x1C, 0x14, 0x9F, 0x1F, 0xC5, 0xCC, 0x1C, 0x0D, 0x31, 0xF7, 0x5F, 0xB1,
+    0xA2, 0x05, 0x70, 0xE4, 0x5B, 0x9B, 0x27, 0x0F, 0xA8, 0x0F, 0xD5, 0x2C, 0xA8, 0x79, 0xEE, 0xA2,
+    0x59, 0x5C, 0x4D, 0x5E, 0xE4, 0x30, 0xF6, 0xC6, 0x29, 0x6C, 0x9C, 0x02, 0x5A, 0x8E, 0x0D, 0x1D,
+    0x14, 0x7D, 0x45, 0x76, 0x2D, 0x03, 0x48, 0xD7, 0xF0, 0x7F, 0xC6, 0xD7, 0x4E, 0xA4, 0x9A, 0xC8,
+    0xAD, 0xB5, 0xC3, 0x3C, 0xBF, 0x08, 0x50, 0x27, 0xED, 0x00, 0x14, 0xFC, 0x71, 0xC0, 0x91, 0x93,
+    0xD0, 0xEF, 0x10, 0x32, 0xA0, 0xD9, 0xA3, 0x15, 0x44, 0x9D, 0x94, 0x03, 0x6D, 0xC9, 0x67, 0x22,
+    0x94, 0x03, 0x5F, 0xA1, 0x6D, 0x09, 0xE3, 0xB2, 0xF3, 0xD8, 0xD7, 0xE4, 0x8D, 0x4C, 0xC6, 0xEF,
+    0x35, 0x03, 0x2A, 0x4E, 0x25, 0x3D, 0x50, 0x74, 0x99, 0xB0, 0xFB, 0x20, 0xE4, 0xE3, 0xE0, 0xB2,
+    0x79, 0xE4, 0x1F, 0x1C, 0x00, 0x7C, 0x4D, 0xF4, 0xE3, 0x87, 0x13, 0x4C, 0xFE, 0xD9, 0x7B, 0xF3,
+    0x8A, 0xE5, 0x72, 0xD9, 0x63, 0xE6, 0xD8, 0x5E, 0xE9, 0x7B, 0x10, 0xC3, 0x74, 0x0F, 0x00, 0xFC,
+    0xC9, 0x6F, 0x6C, 0xDE, 0x5A, 0xE3, 0x82, 0xBD, 0x60, 0x7E, 0x1C, 0x69, 0x05, 0x67, 0x50, 0xC1,
+    0x05, 0x42, 0xC6, 0x59, 0xC5, 0xEA, 0x1A, 0xDF, 0x4E, 0xD0, 0x63, 0x95, 0xAA, 0x84, 0x26, 0x94,
+    0xEC, 0x68, 0xEB, 0x6C, 0xC1, 0x09, 0x0E, 0x6A, 0xAC, 0x62, 0x49, 0xDF, 0x4C, 0x60, 0x4F, 0xD6,
+    0x01, 0xAD, 0x23, 0x2F, 0x24, 0x54, 0x51, 0xEF, 0x7E, 0x40, 0x80, 0xE6, 0x95, 0x44, 0x8B, 0x86,
+    0x4E, 0xE5, 0x0C, 0xF0, 0x4C, 0x2D, 0x14, 0xF2, 0xD4, 0x93, 0x31, 0xB3, 0x42, 0xEE, 0x67, 0xF3,
+    0x7F, 0x88, 0x1C, 0x3C, 0x42, 0xC3, 0x78, 0xA0, 0xDB, 0xC7, 0x7D, 0xD4, 0xE9, 0x26, 0x2E, 0xD3,
+    0x0F, 0xE7, 0x2E, 0x0C, 0x2B, 0x98, 0x48, 0x7D, 0xE0, 0x73, 0x00, 0x50, 0x71, 0xC4, 0x9D, 0x19,
+    0x6B, 0x53, 0xCF, 0x04, 0x53, 0xD9, 0x27, 0xE4, 0x00, 0x3C, 0xFA, 0x59, 0x53, 0x22, 0x8A, 0x3F,
+    0x05, 0x0C, 0xBD, 0x20, 0x83, 0x24, 0x7D, 0xC3, 0xFF, 0x61, 0x52, 0x01, 0x77, 0x7E, 0x68, 0xDA,
+    0xA3, 0x83, 0xD3, 0x1F, 0xE5, 0xA9, 0x8F, 0x20, 0x79, 0xD9, 0x55, 0x39, 0x84, 0xE8, 0x72, 0xE2,
+    0x88, 0xFE, 0x14, 0xDA, 0x44, 0xFC, 0x06, 0x00, 0x31, 0xE2, 0x0E, 0x9C, 0x43, 0x31, 0xC9, 0x1E,
+    0xED, 0x5B, 0x0E, 0xD0, 0x71, 0xEE, 0xC8, 0x32, 0x79, 0x81, 0xE9, 0x51, 0xBF, 0x10, 0x7F, 0x03,
+    0xBE, 0x78, 0x6A, 0x52, 0x40, 0x7B, 0x63, 0x58, 0x91, 0xBE, 0x0C, 0x80, 0xE0, 0x00, 0x9C, 0x33,
+    0x3D, 0x9A, 0xDE, 0x43, 0xB8, 0x02, 0xF8, 0x1E, 0x80, 0xF2, 0x66, 0x15, 0x27, 0x1C, 0x59, 0x9A,
+    0x97, 0x72, 0xFC, 0xF3, 0xA1, 0x71, 0x9E, 0xE6, 0x13, 0xDB, 0x28, 0x38, 0xFD, 0x1A, 0x79, 0x91,
+    0x8C, 0x3A, 0xCA, 0xB7, 0x4E, 0xE1, 0xF1, 0x8D, 0x07, 0xA3, 0x7E, 0x67, 0x52, 0x65, 0xAC, 0x46,
+    0x6C, 0x88, 0xA0, 0xDF, 0x4C, 0xF5, 0x2B, 0xE1, 0x7B, 0x40, 0x71, 0x0C, 0x05, 0xF7, 0xA0, 0x98,
+    0xFE, 0x7B, 0x32, 0xEA, 0x92, 0xFF, 0xB0, 0x83, 0xEF, 0xDC, 0xAC, 0x43, 0xF9, 0xB5, 0x0A, 0xB5,
+    0xB2, 0x4A, 0xFE, 0xB0, 0xEA, 0x57, 0x13, 0x02, 0xFF, 0xF6, 0xCD, 0xAD, 0x32, 0x53, 0x67, 0x2C,
+    0xE6, 0x04, 0x00, 0xA8, 0x00, 0x5C, 0x3F, 0x07, 0xA0, 0xBE, 0x3C, 0xE2, 0x37, 0x31, 0x02, 0x18,
+    0x6B, 0xA0, 0xBB, 0x03, 0xC0, 0x1D, 0x37, 0xCD, 0xC0, 0xF8, 0x99, 0x5E, 0x87, 0xF3, 0x88, 0x5C,
+    0x24, 0x31, 0x0F, 0xD7, 0x26, 0xFC, 0x6D, 0x93, 0xFB, 0xB6, 0xFB, 0xFF, 0x3F, 0xFC, 0x25, 0x00,
+    0x60, 0xA8, 0xF1, 0x85, 0x5F, 0x33, 0x0E, 0xA6, 0xCF, 0xBA, 0x39, 0x74, 0x42, 0x31, 0x7C, 0x03,
+    0x80, 0x84, 0xC3, 0x6F, 0x60, 0x07, 0xC0, 0x4E, 0x79, 0xF3, 0x37, 0x36, 0xDF, 0x5E, 0x3F, 0x8E,
+    0x2B, 0xE1, 0xDC, 0xFB, 0xC8, 0x4A, 0x38, 0xDD, 0x3D, 0x1F, 0xFA, 0x85, 0xFD, 0x2E, 0x6E, 0xBD,
+    0xAF, 0x5A, 0x43, 0x05, 0xD6, 0x4F, 0x54, 0x93, 0x8F, 0xFA, 0x26, 0x66, 0xBA, 0xA4, 0xBA, 0x87,
+    0xCA, 0x7B, 0x1E, 0x43, 0xB9, 0x83, 0xE2, 0xDC, 0xCC, 0x6D, 0x51, 0xB0, 0x9F, 0x0F, 0xA6, 0x9D,
+    0xE7, 0x22, 0xA9, 0xC7, 0xD5, 0x29, 0xBF, 0x89, 0x55, 0xF1, 0x59, 0x5F, 0xD5, 0x8C, 0x5A, 0xFC,
+    0xDF, 0x72, 0x33, 0x05, 0xEA, 0x94, 0x59, 0x32, 0x00, 0x1D, 0x57, 0x73, 0xB2, 0xDF, 0x3D, 0x7C,
+    0x31, 0xD9, 0xF6, 0x00, 0x8A, 0x1E, 0xC0, 0xBD, 0x2B, 0xC6, 0x7E, 0xE1, 0x56, 0xEA, 0x68, 0xD3,
+    0x01, 0xED, 0x88, 0xCD, 0x1E, 0x01, 0x10, 0x23, 0x10, 0x20, 0xF2, 0xCF, 0xC8, 0x1E, 0xDF, 0xC8,
+    0x82, 0x9B, 0xF2, 0x29, 0x80, 0xB5, 0x1D, 0x54, 0x8E, 0x1F, 0x92, 0x65, 0x16, 0x6F, 0x79, 0x1A,
+    0x9B, 0xA7, 0x00, 0x39, 0x41, 0x0D, 0x80, 0x72, 0x25, 0x01, 0xE8, 0xEB, 0x26, 0xA7, 0xBE, 0xE5,
+    0xE9, 0xCC, 0xB3, 0x72, 0x77, 0x70, 0xF2, 0x68, 0x76, 0x28, 0x39, 0x88, 0x04, 0x34, 0xEC, 0xA4,
+    0x07, 0x18, 0xA1, 0x46, 0xD4, 0x9C, 0xC0, 0x1E, 0x8A, 0x83, 0x48, 0x10, 0x64, 0x27, 0x3D, 0x9A,
+    0x1B, 0x11, 0x6A, 0x04, 0x77, 0x27, 0xB0, 0xAF, 0xA3, 0x1A, 0x44, 0x82, 0x76, 0xEC, 0xA4, 0x17,
+    0x14, 0x11, 0x6A, 0x6C, 0xBC, 0x9C, 0xC0, 0x9E, 0x56, 0x0D, 0x22, 0xD5, 0x11, 0xEC, 0xA4, 0xD7,
+    0x4E, 0x44, 0xA8, 0x57, 0x09, 0x39, 0x81, 0x27, 0x3C, 0xD4, 0x20, 0x12, 0x2D, 0xD8, 0x49, 0x46,
+    0x88, 0x08, 0x45, 0x07, 0xB9, 0xB7, 0xC8, 0xA4, 0x9B, 0x37, 0xF2, 0x6C, 0x53, 0x97, 0x72, 0xCE,
+    0xBC, 0x8A, 0xB3, 0xC1, 0xB3, 0x9A, 0x6B, 0x6E, 0xA6, 0x53, 0x5C, 0xE9, 0x46, 0x59, 0x3B, 0x99,
+    0xA3, 0x67, 0x32, 0xDF, 0x3B, 0xED, 0xF6, 0xD3, 0xA1, 0xEB, 0x00, 0x18, 0x2B, 0x12, 0xD0, 0x78,
+    0xC1, 0x6C, 0x0C, 0xF5, 0x58, 0xE5, 0xB9, 0xFF, 0xF9, 0xCF, 0x6F, 0xB9, 0x55, 0xCD, 0x04, 0xC9,
+    0xAE, 0x8A, 0xA8, 0x39, 0x14, 0xEC, 0x2A, 0x4E, 0xD0, 0x83, 0x60, 0x44, 0x33, 0x95, 0x64, 0x57,
+    0xC5, 0x82, 0x1C, 0x0A, 0x76, 0xBC, 0x34, 0x41, 0x0F, 0xE6, 0xF5, 0x88, 0x66, 0xD2, 0xEF, 0xB1,
+    0xAB, 0xA2, 0x72, 0x7A, 0x28, 0xD8, 0x4E, 0xCD, 0x04, 0x7D, 0x29, 0x54, 0x11, 0x0D, 0x43, 0xC1,
+    0xAE, 0x62, 0x82, 0x1E, 0x0A, 0x12, 0x4D, 0x3A, 0xAD, 0x89, 0x8A, 0x6C, 0xD8, 0x17, 0xE4, 0x45,
+    0x5A, 0xE8, 0xAC, 0x0A, 0xCA, 0x09, 0x2B, 0xAE, 0xA5, 0x55, 0xB6, 0x6B, 0xAE, 0xCF, 0x41, 0xCA,
+    0xC1, 0xCD, 0xD3, 0xB9, 0x4F, 0x17, 0x04, 0xF0, 0xEB, 0x5C, 0x74, 0x50, 0x33, 0x49, 0xDC, 0x7E,
+    0xD1, 0x1F, 0x38, 0x44, 0x70, 0xB9, 0x03, 0xB1, 0x9A, 0xB3, 0x72, 0x14, 0x24, 0x27, 0xC1, 0x3F,
+    0x66, 0x10, 0x44, 0x13, 0x05, 0x51, 0x27, 0x41, 0x54, 0x14, 0x44, 0x95, 0x04, 0x21, 0x93, 0x60,
+    0x61, 0xC2, 0x3C, 0x03, 0xC8, 0x3C, 0x17, 0x48, 0x2F, 0xC8, 0xB7, 0x6F, 0x8D, 0x5D, 0xAF, 0x48,
+    0xFD, 0x77, 0xB0, 0xF2, 0x9B, 0x8E, 0x38, 0xC3, 0xE5, 0xCE, 0xAD, 0x87, 0x7C, 0x64, 0x41, 0xA6,
+    0xAE, 0x5A, 0x39, 0x32, 0x7D, 0x95, 0x16, 0x3A, 0x54, 0x09, 0x32, 0xAC, 0xE2, 0xD4, 0x32, 0x54,
+    0x5C, 0x98, 0x30, 0xC7, 0xBD, 0xC9, 0xA1, 0x22, 0xF7, 0x40, 0xFE, 0x1C, 0x8A, 0x9C, 0x56, 0xA4,
+    0xB6, 0x13, 0x5F, 0x3B, 0x41, 0xE5, 0x8A, 0x83, 0xD3, 0x84, 0xFF, 0x84, 0xDA, 0x45, 0xEE, 0x06,
+    0xC5, 0xAB, 0x3C, 0x43, 0x3F, 0xA7, 0x44, 0x04, 0x49, 0x26, 0xC1, 0x67, 0x1F, 0x1D, 0x68, 0xCB,
+    0x49, 0x39, 0x7C, 0xF3, 0xE3, 0xA9, 0x73, 0x81, 0xAF, 0x77, 0x55, 0x68, 0xD9, 0xE9, 0x5D, 0xC6,
+    0x8A, 0xA4, 0xD3, 0x7C, 0x84, 0x4F, 0xB3, 0x6F, 0x83, 0x76, 0xE0, 0xEB, 0x09, 0x75, 0xD4, 0x23,
+    0xCC, 0x3B, 0x09, 0x55, 0xD2, 0x23, 0xF4, 0x3B, 0xA9, 0x7C, 0x29, 0x69, 0x47, 0xBE, 0xCE, 0x9A,
+    0x41, 0x07, 0xC5, 0x8B, 0x2B, 0xA8, 0x40, 0x15, 0xC9, 0x41, 0xBF, 0x42, 0x56, 0xA9, 0xF8, 0xF6,
+    0xA4, 0x47, 0xFC, 0x56, 0x95, 0xE6, 0x67, 0xFE, 0xC3, 0x2B, 0xAB, 0x56, 0xAD, 0xC6, 0x6C, 0x96,
+    0x88, 0x04, 0x80, 0xCF, 0xCC, 0xE9, 0x63, 0x9E, 0x99, 0x10, 0x97, 0xCF, 0xC4, 0xC5, 0xE2, 0xC1,
+    0x7F, 0x0C, 0x2D, 0xF0, 0x47, 0x6D, 0x58, 0x0D, 0x70, 0x40, 0xEB, 0xF6, 0x17, 0x3A, 0xC7, 0x8F,
+    0x35, 0x79, 0x8D, 0xCB, 0x67, 0x3F, 0x37, 0xB6, 0x46, 0x30, 0xD3, 0xF4, 0xF3, 0xC0, 0xCA, 0x62,
+    0xB1, 0xFD, 0xD1, 0xF4, 0xBB, 0x8A, 0x39, 0xCC, 0xD8, 0xAB, 0xB9, 0xE9, 0xF5, 0xBF, 0xCE, 0xC5,
+    0xF6, 0x27, 0x72, 0xF5, 0x1E, 0x5C, 0x99, 0x6D, 0x82, 0x74, 0xE0, 0x1D, 0xEB, 0x98, 0xF1, 0x45,
+    0x75, 0x04, 0xCE, 0xA6, 0x65, 0xC7, 0xCC, 0x2F, 0xD4, 0x93, 0xEC, 0xE5, 0x81, 0x7D, 0xB7, 0xBE,
+    0xF7, 0x83, 0x9D, 0x07, 0x8A, 0xD7, 0x16, 0xC7, 0xF2, 0x20, 0xF3, 0x91, 0xC5, 0x0B, 0xC7, 0x80,
+    0xFD, 0x58, 0x2E, 0xE7, 0x5F, 0xE1, 0xC8, 0xD7, 0x1E, 0xE1, 0x44, 0x0B, 0x13, 0x68, 0xD1, 0x04,
+    0xDA, 0x9C, 0xDA, 0x5A, 0x25, 0x5A, 0x88, 0xB4, 0x9A, 0x7A, 0x3C, 0xCF, 0x3F, 0x9E, 0x56, 0x1A,
+    0xE2, 0xCA, 0x53, 0xFE, 0xAB, 0x45, 0x9E, 0x67, 0xCE, 0x65, 0xB8, 0x45, 0x43, 0x76, 0x33, 0xA0,
+    0x6D, 0x0B, 0xF8, 0xFF, 0x01, 0xED, 0xBD, 0x4D, 0xAC, 0x1D, 0xC7, 0x95, 0x26, 0xF8, 0x65, 0x86,
+    0x1E, 0xB3, 0x5A, 0x59, 0x5D, 0xA1, 0x85, 0xD8, 0x33, 0x96, 0xD0, 0x95, 0xB5, 0x98, 0x01, 0x6C,
+    0x75, 0xB5, 0x62, 0xD3, 0x8B, 0x1A, 0x40, 0x66, 0xA4, 0x44, 0x78, 0x0C, 0x8C, 0x17, 0x7C, 0x8B,
+    0x77, 0x2D, 0xB4, 0xB9, 0xD0, 0xA6, 0x1B, 0x28, 0xAB, 0x06, 0xC3, 0xDE, 0x34, 0xD0, 0x68, 0xC8,
+    0x8A, 0x94, 0x88, 0x81, 0x16, 0x5E, 0x88, 0xD3, 0x63, 0xD7, 0x2C, 0x6A, 0x61, 0x0E, 0x5A, 0x05,
+    0x48, 0x97, 0x0B, 0x7A, 0xD1, 0x0B, 0x0F, 0x20, 0x29, 0x82, 0x7A, 0x0B, 0x61, 0x46, 0x0B, 0xA6,
+    0xCC, 0x92, 0xB5, 0xD0, 0x42, 0xE9, 0x92, 0x6C, 0x75, 0x4B, 0x0B, 0x86, 0xC8, 0x94, 0x19, 0x24,
+    0x23, 0xE2, 0x9B, 0x45, 0xE4, 0xBD, 0xEF, 0x3D, 0x8A, 0xFA, 0xF3, 0x94, 0xAB, 0x3C, 0x83, 0xB9,
+    0xEF, 0xDD, 0xC8, 0xC8, 0xCC, 0xC8, 0xBC, 0x11, 0x91, 0x27, 0x22, 0xCE, 0xF9, 0xCE, 0x4F, 0x02,
+    0x40, 0x47, 0xC6, 0x86, 0x64, 0x45, 0xD2, 0x19, 0x72, 0xEA, 0x02, 0xD0, 0x64, 0xA0, 0xE2, 0x00,
+    0x98, 0x5F, 0xED, 0xA2, 0x23, 0xC7, 0x86, 0xCC, 0x15, 0xC9, 0xC9, 0x90, 0xB9, 0x0B, 0x0D, 0x5F,
+    0xCF, 0xD0, 0x9F, 0x70, 0x68, 0xB2, 0x99, 0xC0, 0x77, 0x03, 0xF4, 0x8D, 0x0C, 0x19, 0x01, 0xC1,
+    0xE5, 0x4A, 0x8E, 0xC7, 0x1E, 0xA5, 0xAF, 0xC8, 0x00, 0xC3, 0x88, 0x8E, 0x11, 0x35, 0x67, 0x00,
+    0x80, 0x9E, 0xA0, 0x3C, 0xBA, 0x50, 0x73, 0xA8, 0x09, 0x41, 0xC8, 0x08, 0xE5, 0xC1, 0x11, 0xDA,
+    0xD7, 0x44, 0x17, 0x50, 0x73, 0x50, 0x5E, 0x10, 0x90, 0xB1, 0x26, 0x38, 0x02, 0xDA, 0x2B, 0xDF,
+    0x05, 0xA0, 0xE2, 0xB3, 0x14, 0x04, 0xD0, 0x46, 0xE5, 0xE9, 0x00, 0xE8, 0x6B, 0xEC, 0x66, 0x00,
+    0x15, 0x2F, 0x5E, 0x27, 0x00, 0xB4, 0x24, 0x1D, 0x00, 0xF0, 0xEA, 0xED, 0x0C, 0x00, 0xFA, 0x37,
+    0xD4, 0x33, 0x80, 0x26, 0x2F, 0x97, 0xF0, 0x35, 0xB6, 0x19, 0x80, 0x9E, 0x95, 0xD7, 0x33, 0xD0,
+    0xE6, 0x9A, 0x15, 0x1D, 0x40, 0xA7, 0x7C, 0x9B, 0x01, 0x3D, 0xD7, 0x84, 0xFE, 0x64, 0xAF, 0xCD,
+    0x50, 0xBE, 0x22, 0x7F, 0x49, 0x57, 0x13, 0x2D, 0xB3, 0x9E, 0xA1, 0x3C, 0x34, 0x3F, 0xCA, 0xA8,
+    0x89, 0x8A, 0x19, 0xD8, 0x34, 0x09, 0x00, 0x20, 0xBE, 0xFA, 0x01, 0x40, 0xA6, 0xD2, 0x7C, 0x41,
+    0x28, 0x5F, 0x73, 0xA8, 0xE8, 0x94, 0x6F, 0x08, 0xD8, 0x49, 0x79, 0x19, 0x0F, 0xEA, 0x29, 0xA3,
+    0xF2, 0x76, 0x02, 0x1A, 0xAA, 0x8F, 0x39, 0x00, 0x35, 0xCF, 0x94, 0x26, 0x93, 0x4C, 0x00, 0x6A,
+    0x5E, 0xBC, 0x41, 0x00, 0x0D, 0xD5, 0x35, 0x3A, 0x40, 0x26, 0xE5, 0x39, 0x01, 0x3A, 0x94, 0xEB,
+    0xAD, 0x57, 0xBE, 0x8B, 0xA8, 0xE8, 0x94, 0x6F, 0x99, 0x05, 0x7B, 0xE5, 0x05, 0x29, 0x33, 0x94,
+    0x07, 0xA9, 0x22, 0x94, 0x87, 0x61, 0xA9, 0x55, 0xFD, 0x15, 0xB7, 0xD5, 0x4B, 0x00, 0x50, 0x59,
+    0x9E, 0xDB, 0x90, 0x93, 0xD7, 0x24, 0xDB, 0xB1, 0xA1, 0x03, 0xF4, 0x0C, 0xB4, 0xA9, 0x94, 0xAE,
+    0xE8, 0x76, 0xBE, 0x4B, 0xD7, 0x92, 0xAE, 0x26, 0x7B, 0x58, 0x26, 0x3C, 0x60, 0x39, 0x01, 0x2A,
+    0x01, 0x35, 0x1D, 0xA0, 0x3D, 0x20, 0x23, 0xD0, 0xF2, 0xDF, 0xA2, 0xE5, 0x4F, 0x48, 0xBE, 0x4E,
+    0xF2, 0x4D, 0x92, 0x63, 0x47, 0xF6, 0xA8, 0x5E, 0x01, 0x20, 0x47, 0x00, 0x11, 0x80, 0xEE, 0x51,
+    0x9D, 0x19, 0x01, 0xCE, 0x80, 0x0E, 0xC0, 0xBD, 0x2F, 0x00, 0xF8, 0xDE, 0x6E, 0x65, 0x19, 0x5B,
+    0x32, 0x49, 0x32, 0x9E, 0xE8, 0xCD, 0x0C, 0xD8, 0x11, 0x35, 0x01, 0x15, 0x04, 0x39, 0x48, 0xCE,
+    0xD0, 0x4C, 0x58, 0x9D, 0x89, 0x40, 0x17, 0x00, 0x3D, 0xA3, 0xE6, 0xD5, 0xB5, 0xCD, 0x96, 0xBC,
+    0x46, 0xF2, 0xBF, 0x27, 0x27, 0x34, 0x1E, 0x10, 0x1E, 0x68, 0x27, 0xA0, 0x73, 0xD8, 0x21, 0x60,
+    0x22, 0x2A, 0x3A, 0xD4, 0x2F, 0x02, 0x74, 0x50, 0x41, 0x46, 0x34, 0x04, 0x1D, 0xE8, 0x64, 0x84,
+    0x9E, 0x41, 0xD7, 0x66, 0xC8, 0x58, 0xD1, 0x81, 0x4E, 0x7B, 0xC8, 0x28, 0x13, 0xC0, 0xD7, 0x38,
+    0x40, 0x46, 0xE3, 0x01, 0x5E, 0x8E, 0x80, 0x24, 0x7B, 0x80, 0x57, 0x23, 0x20, 0x23, 0x27, 0x80,
+    0xFB, 0xEC, 0x21, 0x63, 0x17, 0x01, 0x3A, 0xEB, 0x21, 0xA3, 0xE0, 0x00, 0xBA, 0x2E, 0x41, 0x46,
+    0xD8, 0x4F, 0xF6, 0xE8, 0x04, 0x79, 0x35, 0x42, 0x32, 0xD3, 0xC1, 0xF0, 0x6A, 0x44, 0x5D, 0x48,
+    0xD0, 0x4C, 0x28, 0xA3, 0xF6, 0x73, 0xB3, 0x80, 0x1D, 0xC1, 0xD1, 0x8E, 0x82, 0x83, 0x1D, 0xDB,
+    0x0C, 0x3B, 0x76, 0x11, 0x76, 0x34, 0x1E, 0x76, 0xE4, 0x08, 0x7B, 0x85, 0x3D, 0xEC, 0x3B, 0x19,
+    0xB0, 0x8C, 0x80, 0xBD, 0x9A, 0xB1, 0x1C, 0x7B, 0x93, 0x23, 0xEC, 0x68, 0x3D, 0xEC, 0xA8, 0x23,
+    0xEC, 0x28, 0x99, 0xEC, 0x28, 0x98, 0xED, 0x58, 0x31, 0xDB, 0x11, 0x36, 0x6F, 0x48, 0xFB, 0x33,
+    0x93, 0xFA, 0x25, 0x3D, 0x41, 0x26, 0x19, 0xD1, 0x52, 0xF0, 0xDE, 0x86, 0xE0, 0xFE, 0x3E, 0x7B,
+    0xED, 0x6F, 0x70, 0x90, 0x51, 0xD3, 0x09, 0x4A, 0x3A, 0x70, 0x9F, 0x23, 0xB4, 0xE7, 0x54, 0xBA,
+    0x4A, 0x50, 0x7B, 0x80, 0x0C, 0x80, 0xBE, 0xCD, 0xA5, 0xA7, 0x04, 0xBB, 0x04, 0x70, 0x9F, 0x0E,
+    0xDA, 0x33, 0x42, 0x46, 0xCD, 0x41, 0x50, 0xDA, 0x19, 0xDC, 0x7F, 0x83, 0xD0, 0xDE, 0x73, 0x92,
+    0x11, 0x5D, 0x12, 0x44, 0x4D, 0x47, 0x07, 0x1D, 0x0B, 0xAD, 0xF6, 0x82, 0xDF, 0x49, 0xDF, 0xD0,
+    0x41, 0xCD, 0xBF, 0xE1, 0x60, 0xAF, 0x30, 0xD6, 0x3C, 0x45, 0xD7, 0x26, 0x9D, 0xA0, 0x66, 0x8E,
+    0xB0, 0xEF, 0x64, 0xD4, 0xA4, 0x47, 0x9B, 0x39, 0x2D, 0x87, 0xAE, 0xD0, 0x6D, 0x4A, 0xD1, 0xA9,
+    0xF9, 0x36, 0x07, 0x7B, 0xE5, 0x0A, 0x1F, 0xE3, 0xB7, 0x1A, 0x7E, 0x27, 0xA1, 0x25, 0x64, 0x44,
+    0xC5, 0x81, 0x0E, 0xDA, 0x9F, 0xC9, 0xE7, 0x65, 0x6E, 0xC9, 0x8A, 0xCE, 0xD2, 0x6B, 0xDF, 0x92,
+    0x32, 0xE1, 0x4C, 0xFE, 0x5F, 0xEE, 0xA0, 0x85, 0x5F, 0xD0, 0x41, 0x92, 0x1E, 0x20, 0x33, 0x36,
+    0xD9, 0x8F, 0xE8, 0x20, 0xA3, 0xCC, 0x00, 0x9D, 0x29, 0x04, 0xE0, 0x40, 0x27, 0x33, 0x64, 0x84,
+    0x9D, 0x41, 0x27, 0xE8, 0x64, 0x84, 0xCC, 0xA0, 0x83, 0x9D, 0x65, 0x84, 0xA0, 0xA3, 0x83, 0xCC,
+    0xD5, 0x1E, 0x96, 0x99, 0x17, 0x66, 0x02, 0x6A, 0x9B, 0x5F, 0x02, 0x48, 0xF6, 0xD0, 0xE4, 0x88,
+    0x63, 0xF6, 0xD6, 0xF9, 0x42, 0xE5, 0x68, 0x32, 0x64, 0xAE, 0x38, 0xB4, 0x19, 0x66, 0x6A, 0x89,
+    0x2E, 0x34, 0x44, 0x93, 0x05, 0xFB, 0x8A, 0x67, 0xD9, 0xC3, 0xFC, 0x2D, 0x07, 0x74, 0x37, 0xE9,
+    0xD0, 0x90, 0x0E, 0x15, 0x2F, 0x46, 0xC0, 0xBC, 0xC7, 0x01, 0x5D, 0xD0, 0x33, 0x9A, 0xDC, 0xB0,
+    0xAF, 0x38, 0x58, 0x0F, 0x33, 0x49, 0xA2, 0x0B, 0xE0, 0xB4, 0xB9, 0x67, 0xC5, 0x91, 0x9C, 0xD1,
+    0x64, 0xCD, 0x04, 0xC1, 0x53, 0x64, 0x2F, 0x78, 0x92, 0x1C, 0x6B, 0x0E, 0x2B, 0x33, 0x57, 0x74,
+    0x68, 0x13, 0xE8, 0x50, 0xB3, 0xE7, 0x08, 0xD8, 0xD1, 0x4E, 0x80, 0x9A, 0x8D, 0x07, 0xDA, 0xA4,
+    0x3D, 0x50, 0xD3, 0xCC, 0x58, 0x08, 0x10, 0xEA, 0x36, 0x01, 0xB4, 0xC9, 0x7A, 0xA0, 0xE6, 0xA9,
+    0x0C, 0x14, 0x42, 0x85, 0x9A, 0xBB, 0x08, 0xB4, 0xA9, 0x2E, 0xB7, 0xD2, 0x01, 0xB0, 0x63, 0xC3,
+    0x1E, 0x6A, 0x86, 0xF5, 0x68, 0x13, 0x24, 0x51, 0xB3, 0x07, 0x27, 0xD8, 0x11, 0x5D, 0x2A, 0x73,
+    0x14, 0x39, 0x43, 0x7B, 0x72, 0x06, 0x1D, 0x39, 0xD7, 0xEC, 0xD7, 0x17, 0xE7, 0x36, 0x01, 0x72,
+    0xEE, 0x02, 0x20, 0x67, 0xED, 0x01, 0x39, 0xD3, 0x01, 0xF2, 0x37, 0x04, 0x20, 0x99, 0x01, 0xC8,
+    0xDB, 0xC4, 0xF6, 0xF8, 0x6C, 0x3C, 0x20, 0x67, 0x15, 0x00, 0xB9, 0x5C, 0x2B, 0xD8, 0x43, 0xCE,
+    0xA0, 0x83, 0x9C, 0x61, 0x3C, 0xE4, 0x0C, 0x15, 0xE8, 0xD0, 0x24, 0x68, 0x8F, 0x9A, 0x83, 0x8C,
+    0x80, 0x9D, 0x04, 0x01, 0x15, 0x40, 0x87, 0x36, 0x7F, 0xCE, 0x89, 0x4F, 0x56, 0x8F, 0x73, 0x90,
+    0x24, 0x39, 0x09, 0x92, 0x0C, 0x20, 0xC9, 0x0C, 0x7D, 0x6B, 0x7D, 0xE1, 0xCB, 0xDD, 0xEA, 0xE6,
+    0x1E, 0x1D, 0x5A, 0xD2, 0x78, 0xD4, 0xE4, 0xBB, 0x11, 0xB0, 0xBC, 0x41, 0x40, 0x31, 0x2D, 0xA3,
+    0x60, 0x99, 0x0B, 0x00, 0xA8, 0x19, 0x28, 0x53, 0xF3, 0x1D, 0x27, 0xBA, 0xB2, 0x58, 0x37, 0x19,
+    0x6D, 0x82, 0x99, 0x60, 0xC7, 0xCF, 0xCD, 0xB2, 0x70, 0x09, 0xDC, 0x66, 0xD7, 0x17, 0xEF, 0x5E,
+    0x96, 0x6B, 0x33, 0xC1, 0xF2, 0x46, 0x46, 0x4B, 0x9A, 0x09, 0x96, 0x7E, 0xBB, 0x8A, 0xA8, 0xCF,
+    0xCE, 0x56, 0xEB, 0x42, 0x90, 0xD6, 0xA3, 0x26, 0x19, 0x01, 0x4B, 0x12, 0x50, 0x24, 0x1D, 0xDA,
+    0xBC, 0x32, 0xBF, 0xC3, 0x0E, 0xFD, 0x9C, 0x13, 0xE5, 0x63, 0x26, 0x58, 0xA6, 0x3B, 0xD3, 0x5B,
+    0x2F, 0x9A, 0x09, 0x76, 0xC4, 0x91, 0x94, 0xE4, 0x1D, 0xE9, 0xAD, 0x35, 0xEF, 0x28, 0xF3, 0xB9,
+    0x29, 0x49, 0x7A, 0x00, 0xBA, 0x74, 0x03, 0x24, 0x49, 0x02, 0x10, 0x5C, 0x18, 0x1F, 0xBE, 0xB5,
+    0x32, 0x1E, 0x80, 0xF6, 0x90, 0x11, 0x80, 0x8C, 0x10, 0xA5, 0x00, 0x50, 0x0A, 0x38, 0xE8, 0x4F,
+    0x15, 0xF8, 0xD6, 0x6E, 0x29, 0x40, 0xBE, 0x0F, 0x3A, 0x68, 0x92, 0x83, 0xF6, 0x90, 0x24, 0xA3,
+    0x8C, 0xE5, 0xEE, 0xFB, 0x04, 0xF8, 0xAB, 0xD3, 0x9C, 0xCB, 0x1D, 0x3A, 0x96, 0x3B, 0x54, 0x7C,
+    0xB7, 0xFC, 0x84, 0xBA, 0x5D, 0x7E, 0xA2, 0xC9, 0xCB, 0x4F, 0x90, 0xE5, 0x27, 0x34, 0x4B, 0x01,
+    0xC9, 0x4D, 0x81, 0x0D, 0xF3, 0x30, 0x2C, 0x23, 0x73, 0x5C, 0xB6, 0x1E, 0x00, 0xFE, 0x51, 0xC5,
+    0x00, 0x00, 0x4D, 0x69, 0x21, 0xAA, 0xC2, 0xDF, 0x00, 0x66, 0xD9, 0x4A, 0x2E, 0x3D, 0xBF, 0xD3,
+    0x6F, 0xB8, 0xA8, 0x8A, 0x64, 0x06, 0x1A, 0x92, 0x01, 0xE8, 0x48, 0x4E, 0x80, 0xB9, 0xB5, 0xE6,
+    0x80, 0x8A, 0x43, 0x93, 0x81, 0x26, 0xA3, 0x0B, 0x40, 0x17, 0x60, 0x26, 0xC0, 0x4C, 0x15, 0xDF,
+    0x42, 0xC5, 0xA1, 0x21, 0x87, 0x26, 0xA3, 0x23, 0xC7, 0x2E, 0xC0, 0x90, 0xA3, 0x99, 0x2A, 0x92,
+    0x97, 0x38, 0x34, 0xB9, 0xE1, 0x73, 0x19, 0x5D, 0x10, 0xEC, 0x02, 0xCC, 0xD4, 0x26, 0x33, 0x55,
+    0x1C, 0xBA, 0x4F, 0x38, 0x34, 0x19, 0xE6, 0xED, 0x8C, 0x2E, 0x54, 0x65, 0xD0, 0x34, 0xA5, 0x62,
+    0xCA, 0x97, 0xBA, 0x38, 0x00, 0xE7, 0xBA, 0x0C, 0x94, 0xD5, 0x04, 0x68, 0xC9, 0x1E, 0x80, 0x2A,
+    0x3C, 0xB0, 0xD9, 0x70, 0x81, 0x9B, 0x4F, 0x5D, 0xE6, 0x3B, 0x46, 0x00, 0x64, 0x04, 0x04, 0x39,
+    0x03, 0x0D, 0xC7, 0xFB, 0x00, 0x49, 0x54, 0xBB, 0x90, 0x11, 0x9A, 0xBD, 0x0A, 0x20, 0x47, 0x35,
+    0xD7, 0xA4, 0xD7, 0x5E, 0xF0, 0x4C, 0xD0, 0xBE, 0x49, 0x6D, 0xD4, 0xBE, 0x8D, 0xCD, 0x1D, 0x69,
+    0x13, 0x9B, 0xA8, 0xE7, 0x26, 0xB6, 0x51, 0x45, 0x91, 0x64, 0xE8, 0x52, 0x4D, 0x35, 0x4B, 0x56,
+    0xB4, 0xBE, 0xE1, 0x64, 0xE9, 0x6A, 0x92, 0xEC, 0x41, 0x92, 0x17, 0xA0, 0x48, 0x12, 0x75, 0x21,
+    0xA7, 0x9D, 0x5E, 0x15, 0xC6, 0x6E, 0x0F, 0xD5, 0x0B, 0x00, 0x0C, 0x7B, 0x08, 0x12, 0x68, 0x99,
+    0x81, 0x8E, 0xFF, 0x12, 0xD0, 0xA1, 0x66, 0xAF, 0xBD, 0xE4, 0x64, 0x26, 0xCD, 0x60, 0x26, 0x7D,
+    0x35, 0x9A, 0xC9, 0x9C, 0x8D, 0x66, 0x32, 0x8F, 0x25, 0x33, 0x99, 0xC7, 0xA2, 0xF1, 0xE6, 0x6C,
+    0xD4, 0x5E, 0xBF, 0x11, 0x55, 0x54, 0x9C, 0x25, 0x2D, 0xA7, 0x86, 0xE4, 0x5B, 0xE5, 0x69, 0x29,
+    0x32, 0x03, 0xBB, 0xED, 0xE1, 0xDE, 0xA8, 0x2C, 0xCF, 0x41, 0x92, 0x11, 0x86, 0x8C, 0x15, 0xC9,
+    0x20, 0x38, 0x1F, 0xF3, 0x2D, 0x7B, 0xDC, 0x27, 0x33, 0x00, 0x15, 0x51, 0xF8, 0x3C, 0xE8, 0xB9,
+    0x50, 0xF1, 0xA7, 0x93, 0x79, 0x53, 0x44, 0x45, 0xA0, 0xCC, 0xFF, 0x92, 0x00, 0x5A, 0x4E, 0xD5,
+    0x7F, 0x12, 0x24, 0x67, 0x90, 0x9C, 0xA1, 0xC8, 0x19, 0xC7, 0xC8, 0x11, 0xE8, 0x46, 0x14, 0x36,
+    0x0F, 0x62, 0x06, 0x20, 0x02, 0x80, 0xC7, 0x03, 0x00, 0x86, 0x0D, 0x61, 0x3E, 0xD9, 0x03, 0xD5,
+    0xF7, 0x81, 0x33, 0x0C, 0x35, 0x19, 0x5B, 0x32, 0x48, 0xAE, 0xBD, 0x8A, 0xB8, 0x4F, 0xCF, 0xE5,
+    0xA7, 0x8D, 0xC7, 0x42, 0x5E, 0x25, 0xAF, 0x7D, 0xA9, 0x8D, 0x4A, 0xF8, 0xBA, 0xE4, 0xD5, 0xD8,
+    0x92, 0xB1, 0x26, 0x23, 0x14, 0x27, 0xD4, 0x01, 0x40, 0x02, 0xA0, 0x0B, 0x17, 0xBB, 0x63, 0x7B,
+    0x48, 0x02, 0x32, 0x03, 0xF7, 0xBE, 0x00, 0x43, 0xF2, 0x26, 0x49, 0x7E, 0x40, 0x92, 0x3F, 0x21,
+    0x99, 0x8F, 0x3F, 0xCE, 0x1F, 0xEF, 0x95, 0x51, 0xAB, 0x7D, 0x19, 0xCA, 0x65, 0x70, 0x7F, 0xE5,
+    0x43, 0x6F, 0xED, 0x42, 0xB0, 0x70, 0x21, 0x65, 0x7C, 0xA2, 0x10, 0xEA, 0x17, 0x5E, 0x5E, 0x66,
+    0x9A, 0xAC, 0x49, 0xBE, 0x47, 0x32, 0x3F, 0x74, 0x81, 0xEB, 0x73, 0x30, 0xD3, 0xC2, 0x6A, 0x7E,
+    0xA9, 0xCC, 0xAD, 0xF3, 0x68, 0x48, 0xC0, 0xD0, 0x97, 0x0C, 0x3A, 0x0F, 0x54, 0x77, 0xCF, 0xDC,
+    0x7B, 0xDE, 0x4E, 0xA8, 0xF9, 0x93, 0x88, 0x8A, 0xFB, 0x1C, 0xC0, 0x49, 0x7B, 0x18, 0xDF, 0x66,
+    0xE8, 0x00, 0xBA, 0x2E, 0x42, 0x05, 0x99, 0x20, 0xD8, 0x10, 0xB0, 0x7F, 0xCB, 0x1E, 0x32, 0xD1,
+    0xA1, 0x22, 0x47, 0x40, 0xD3, 0x03, 0x4D, 0x69, 0x59, 0x00, 0xD0, 0xC5, 0x65, 0x26, 0x5C, 0xE6,
+    0x42, 0xED, 0x37, 0xED, 0xFA, 0x9C, 0x83, 0x00, 0xEC, 0x04, 0x15, 0x8D, 0x87, 0x9E, 0xF5, 0x0C,
+    0xE3, 0x55, 0x84, 0x9D, 0x64, 0x04, 0x47, 0x99, 0x2A, 0xBA, 0x86, 0x35, 0x07, 0x41, 0x41, 0xD4,
+    0x7C, 0x8E, 0x00, 0xDF, 0x48, 0x0B, 0x97, 0x6F, 0xDE, 0x0D, 0x4B, 0x25, 0x14, 0x3D, 0xD0, 0x71,
+    0x04, 0x24, 0x1D, 0xD0, 0x72, 0x00, 0x04, 0x7B, 0x1C, 0x4C, 0xCE, 0x9F, 0x9F, 0xFC, 0x1D, 0x77,
+    0xC2, 0xBD, 0x17, 0xB8, 0x1E, 0x1A, 0x92, 0xBE, 0xE2, 0x32, 0xDA, 0x58, 0x0E, 0xFE, 0x43, 0x74,
+    0x42, 0x4B, 0xD2, 0x1D, 0x24, 0xC7, 0x2E, 0xF0, 0xC3, 0xE1, 0x6E, 0x9D, 0xA0, 0x3D, 0xC0, 0xB1,
+    0x25, 0x60, 0x17, 0xC4, 0x00, 0x5D, 0x84, 0x0A, 0xA8, 0x39, 0x74, 0x11, 0xD0, 0x5E, 0x26, 0xA0,
+    0x61, 0x93, 0x01, 0xF0, 0x0A, 0x01, 0xC8, 0xCC, 0x1E, 0xA8, 0xCB, 0xDA, 0xA8, 0xE9, 0x00, 0x34,
+    0x9C, 0x00, 0xD4, 0x65, 0x11, 0xE1, 0x22, 0x42, 0x7B, 0x00, 0xF6, 0xA3, 0x0C, 0x40, 0xFB, 0x22,
+    0xB2, 0xAA, 0x08, 0x74, 0x51, 0x70, 0x80, 0x8C, 0x30, 0x9F, 0xEC, 0xB5, 0x19, 0x2D, 0xD9, 0x10,
+    0x20, 0xF7, 0xD9, 0xA3, 0xE3, 0x35, 0x0E, 0x10, 0x65, 0x8D, 0x5A, 0x3A, 0xA9, 0x40, 0x0F, 0xDA,
+    0x63, 0x3B, 0x5C, 0x8E, 0x9C, 0x28, 0xEB, 0x03, 0x24, 0x21, 0x73, 0x69, 0x88, 0x8A, 0x0D, 0x7B,
+    0xC1, 0xB3, 0x1C, 0x60, 0xAE, 0x15, 0xBE, 0x6D, 0x04, 0xC8, 0x09, 0xE8, 0xE8, 0xB1, 0xA0, 0x26,
+    0xCC, 0x00, 0x2C, 0x47, 0xC0, 0x30, 0x02, 0xFA, 0x37, 0x1C, 0xA0, 0xA2, 0x9E, 0xD1, 0xC5, 0x96,
+    0x59, 0x66, 0x90, 0x3F, 0x24, 0x3A, 0x7E, 0xC0, 0xBE, 0x34, 0xAB, 0xE0, 0x0C, 0x1C, 0x36, 0x48,
+    0x83, 0xBC, 0xE3, 0xE0, 0x03, 0xE7, 0x0C, 0x49, 0x6F, 0xC6, 0x8A, 0x24, 0x7F, 0xCE, 0xBE, 0x21,
+    0xC9, 0xEF, 0x24, 0x74, 0x24, 0x93, 0x9A, 0x71, 0xFC, 0x34, 0x57, 0xBB, 0x76, 0x44, 0xC1, 0x63,
+    0x7A, 0xC0, 0x4C, 0x68, 0x53, 0x91, 0x31, 0xD4, 0x5C, 0x06, 0xF2, 0xEF, 0xE6, 0xF4, 0xCD, 0x3D,
+    0x34, 0x24, 0xC9, 0x19, 0x1D, 0xB9, 0xE5, 0x94, 0xC8, 0xBE, 0x22, 0xB9, 0x61, 0x05, 0x16, 0xCE,
+    0x75, 0xC3, 0xAE, 0x6E, 0x98, 0xD7, 0x85, 0x95, 0xFD, 0xCC, 0xD3, 0x10, 0x24, 0x7F, 0x98, 0xA0,
+    0xC9, 0x60, 0xC7, 0x65, 0xE7, 0x21, 0x7B, 0xEB, 0x05, 0x3B, 0x42, 0x10, 0x6D, 0x02, 0xB4, 0xC7,
+    0x6F, 0xBD, 0xB3, 0xBE, 0xC8, 0x35, 0x34, 0x49, 0x7A, 0x41, 0x92, 0x5C, 0x76, 0x0E, 0x21, 0x25,
+    0xEA, 0x0B, 0x76, 0xAA, 0x97, 0xF4, 0x84, 0x02, 0x8C, 0x41, 0xCF, 0xD0, 0x1E, 0x82, 0xFD, 0x6F,
+    0xB7, 0xE3, 0x8E, 0x71, 0x2E, 0x15, 0x28, 0x5D, 0x37, 0x97, 0x8E, 0xED, 0xD1, 0xF2, 0xA6, 0x9E,
+    0x81, 0xAA, 0x17, 0xA5, 0x5B, 0xF4, 0x5C, 0xBA, 0xA6, 0xEC, 0xDC, 0xDC, 0x2B, 0xFD, 0x54, 0x06,
+    0x4C, 0xBC, 0x73, 0x07, 0xB0, 0x0E, 0x00, 0xDA, 0x2F, 0xB7, 0x03, 0x19, 0x17, 0xA1, 0xCF, 0x8E,
+    0x5F, 0x90, 0xE5, 0x28, 0xF9, 0x2D, 0xBB, 0x88, 0x10, 0x35, 0xC9, 0x84, 0x96, 0xC1, 0x8E, 0xD8,
+    0xD9, 0x2D, 0x8F, 0xD5, 0x8E, 0x00, 0xDA, 0xFC, 0x12, 0x00, 0xCB, 0x69, 0x61, 0x46, 0x4A, 0x16,
+    0x75, 0x06, 0x00, 0xF5, 0xD9, 0xD9, 0xEA, 0x25, 0xBB, 0xB0, 0xA6, 0x9F, 0x95, 0xDC, 0xDF, 0x64,
+    0xBA, 0xA7, 0x36, 0xC9, 0xF8, 0x54, 0x93, 0x39, 0x3D, 0xD5, 0x64, 0xCE, 0x4F, 0x9D, 0xC9, 0x76,
+    0xB3, 0xE8, 0x65, 0xC9, 0x82, 0x86, 0x3E, 0x97, 0x81, 0x97, 0x9B, 0x0C, 0x3C, 0x75, 0x97, 0xE4,
+    0xFE, 0x26, 0x6F, 0xC0, 0x97, 0x85, 0xD9, 0xA5, 0x83, 0x7D, 0x8F, 0xA8, 0xF9, 0x7C, 0x44, 0x9B,
+    0xB5, 0x87, 0x0A, 0x74, 0xBD, 0x7D, 0x8F, 0xED, 0xB3, 0x7C, 0x3E, 0x3E, 0xDC, 0x66, 0xED, 0x7F,
+    0xA6, 0x03, 0x6F, 0x90, 0x7F, 0x4B, 0x92, 0x67, 0x49, 0xE6, 0x9A, 0xF9, 0x4C, 0xC0, 0xE3, 0x93,
+    0x9D, 0xD0, 0x3E, 0xCB, 0x01, 0x0F, 0xB7, 0x19, 0xF8, 0x99, 0x0A, 0x65, 0x2E, 0x46, 0xCD, 0xA1,
+    0x0C, 0xEE, 0x2F, 0xB7, 0xA8, 0x9D, 0x29, 0x62, 0x50, 0x12, 0x24, 0x39, 0x92, 0x64, 0xD4, 0xFC,
+    0x51, 0x47, 0x19, 0x97, 0xB9, 0x52, 0xCF, 0x74, 0x45, 0x0E, 0xAF, 0x79, 0x2A, 0x02, 0xF6, 0x0A,
+    0x01, 0xF5, 0x39, 0x07, 0x8F, 0xF7, 0xCB, 0x80, 0xB3, 0xE3, 0xDD, 0x33, 0xD5, 0x8F, 0x60, 0xAF,
+    0x30, 0xB4, 0x89, 0xF4, 0x96, 0xE4, 0x0F, 0x79, 0xD3, 0x46, 0x1B, 0x2A, 0xBE, 0x41, 0xC8, 0x64,
+    0x3D, 0xF8, 0x4E, 0x46, 0x9B, 0xEC, 0x04, 0xFB, 0x4E, 0x42, 0x9B, 0xEC, 0xF8, 0xC5, 0x99, 0x03,
+    0x5E, 0xB1, 0xE5, 0x4D, 0x00, 0x85, 0x89, 0x2B, 0x02, 0xD1, 0x50, 0x36, 0x33, 0xA0, 0xD9, 0x77,
+    0x2C, 0xAC, 0x9F, 0xFD, 0x65, 0x92, 0x19, 0x90, 0xD1, 0x9E, 0x24, 0x50, 0xD3, 0xBC, 0x49, 0x07,
+    0x98, 0xAB, 0xD9, 0x7E, 0xB2, 0x5A, 0x9D, 0xB9, 0xCD, 0xF2, 0xB1, 0x65, 0xF3, 0x46, 0xD9, 0xF8,
+    0x27, 0x79, 0x6B, 0xBD, 0x5E, 0xBF, 0xB8, 0x91, 0xF1, 0x9A, 0x65, 0x0D, 0x2C, 0xD3, 0x78, 0xE1,
+    0x2D, 0x81, 0x86, 0x03, 0xF0, 0xEF, 0x00, 0x26, 0x1C, 0xCB, 0x8B, 0x28, 0x36, 0x00, 0x2C, 0xD2,
+    0x47, 0x5B, 0x36, 0x50, 0x85, 0xF7, 0xDF, 0x08, 0x2B, 0xDF, 0xEB, 0x01, 0xB4, 0x4C, 0xA5, 0xCA,
+    0xA5, 0xF8, 0x84, 0x9A, 0xA3, 0xF1, 0x6A, 0x9F, 0x90, 0x41, 0x3F, 0x97, 0x21, 0xA3, 0x7E, 0x27,
+    0xA3, 0x8D, 0x9A, 0x24, 0xA3, 0x22, 0x17, 0x9C, 0x9E, 0x71, 0xE9, 0x81, 0xC2, 0x34, 0x97, 0x6A,
+    0x09, 0x0E, 0xF8, 0x13, 0x54, 0xBC, 0x79, 0xDA, 0x03, 0x96, 0x65, 0xA1, 0x2D, 0x8B, 0x07, 0xCF,
+    0x01, 0xD8, 0xD9, 0xC5, 0xFF, 0x6B, 0x3B, 0x6D, 0x41, 0x2E, 0x37, 0x70, 0x44, 0x5A, 0x84, 0xBD,
+    0xD2, 0x95, 0x66, 0xBC, 0xCB, 0xC9, 0xBF, 0xFF, 0xFE, 0xD5, 0x23, 0xBE, 0x30, 0x7D, 0x68, 0x80,
+    0x65, 0xE9, 0xB6, 0x77, 0x18, 0x8A, 0xD6, 0x43, 0x7B, 0xD0, 0x7D, 0x61, 0x56, 0xF1, 0xBD, 0xA5,
+    0xB7, 0x79, 0x58, 0x60, 0x84, 0x1D, 0x4A, 0x17, 0x94, 0xFB, 0xCB, 0x6C, 0x3D, 0x0E, 0x38, 0x19,
+    0xA0, 0xE5, 0x84, 0x4F, 0x7F, 0xD4, 0x8C, 0x36, 0xA2, 0xC9, 0x82, 0x10, 0x84, 0x60, 0x6F, 0x3C,
+    0xE8, 0x6A, 0x0E, 0x32, 0x95, 0x5F, 0x2B, 0x28, 0x36, 0x47, 0x74, 0x41, 0x10, 0x76, 0x82, 0x60,
+    0x4F, 0xA7, 0x3D, 0xA0, 0xBD, 0x5E, 0xD4, 0x25, 0x32, 0x76, 0x01, 0x00, 0x3F, 0xE0, 0x4F, 0x36,
+    0x08, 0x44, 0xDA, 0x20, 0x10, 0x8B, 0x28, 0xCE, 0x09, 0x00, 0x6F, 0x17, 0x01, 0xDE, 0x7A, 0xEE,
+    0xD3, 0x01, 0x66, 0xD6, 0x5E, 0x07, 0x40, 0x07, 0x19, 0x5B, 0x02, 0x2A, 0x0A, 0x82, 0x1E, 0x32,
+    0x2D, 0x30, 0x37, 0xA1, 0x7D, 0x4D, 0xD7, 0x94, 0xC6, 0x07, 0xC1, 0x41, 0x10, 0x0D, 0x4F, 0xD2,
+    0x81, 0x0E, 0xF6, 0xE3, 0xC2, 0xF1, 0xC9, 0x0C, 0xAC, 0xFB, 0x27, 0x0B, 0x6F, 0xA3, 0x26, 0x00,
+    0x6D, 0x2A, 0x24, 0xB0, 0xE0, 0x05, 0x1B, 0x78, 0xE0, 0xCC, 0x0B, 0x77, 0x6B, 0x3F, 0x87, 0x26,
+    0x0B, 0x42, 0x4F, 0x82, 0x30, 0x93, 0x0C, 0x82, 0x68, 0x93, 0xC8, 0x15, 0x07, 0xD0, 0x71, 0xA0,
+    0x43, 0x17, 0xF4, 0x44, 0x87, 0x9A, 0xA7, 0xA2, 0x1D, 0xCB, 0xE0, 0xF0, 0x05, 0x5A, 0x98, 0xB7,
+    0xAD, 0xAC, 0x79, 0x35, 0x73, 0x42, 0xC5, 0xFD, 0x2C, 0x13, 0xC0, 0x91, 0xCF, 0xD2, 0xC1, 0x7A,
+    0x3D, 0xE9, 0x00, 0xE3, 0x65, 0x68, 0xD8, 0xEB, 0x59, 0x64, 0x58, 0xAF, 0x23, 0x38, 0xC8, 0xDC,
+    0x45, 0xE8, 0xA9, 0xE2, 0x48, 0x87, 0x2E, 0x6A, 0x5F, 0xC0, 0x70, 0x99, 0x44, 0xE1, 0x05, 0x5D,
+    0x4B, 0x68, 0xDF, 0x10, 0x32, 0x0A, 0x42, 0x50, 0xB0, 0x07, 0x5F, 0x63, 0x0F, 0xFD, 0x31, 0x07,
+    0xC8, 0x48, 0x07, 0x41, 0xFE, 0x97, 0x45, 0xD9, 0xA3, 0x49, 0x7A, 0x49, 0x92, 0x27, 0xF9, 0xE3,
+    0xD3, 0xF4, 0x74, 0x50, 0x59, 0x7B, 0xD4, 0xBC, 0x1C, 0x01, 0x7D, 0x83, 0x40, 0x9B, 0xE9, 0x50,
+    0xD1, 0x7A, 0xC0, 0x5C, 0x8D, 0x40, 0x77, 0x9B, 0xCB, 0x5A, 0x54, 0x78, 0xA1, 0x02, 0x05, 0x79,
+    0x7C, 0xAD, 0x2A, 0x7C, 0x41, 0x44, 0x45, 0xC6, 0x85, 0xC1, 0xEC, 0x38, 0x1F, 0x42, 0x57, 0x2A,
+    0x0E, 0x82, 0xCF, 0x65, 0xE8, 0xD8, 0x05, 0x41, 0x67, 0x26, 0x15, 0x2B, 0x3E, 0x4B, 0xD7, 0xE4,
+    0x2E, 0x16, 0xA8, 0xD8, 0x94, 0xCB, 0x73, 0xDF, 0x2C, 0x3A, 0x1A, 0x8E, 0x26, 0x5F, 0xE4, 0x25,
+    0x0E, 0x0D, 0x9F, 0xCB, 0x68, 0xD8, 0x05, 0xC8, 0x68, 0x26, 0xA8, 0x4F, 0x38, 0xC0, 0xBC, 0x9D,
+    0xCB, 0x10, 0x6E, 0xD3, 0xB2, 0x5A, 0x55, 0x74, 0xD8, 0x55, 0x69, 0xC1, 0xDE, 0x0B, 0xB0, 0x37,
+    0x1F, 0xC2, 0x49, 0x44, 0xA1, 0xA8, 0xE6, 0xE0, 0x49, 0xF8, 0x32, 0x55, 0x78, 0x40, 0xA6, 0x95,
+    0x2D, 0xFA, 0x22, 0xED, 0x01, 0x19, 0x0E, 0x6F, 0xBA, 0xF9, 0xF0, 0x46, 0xF9, 0x22, 0x8F, 0xDF,
+    0x6D, 0x63, 0xA6, 0xB2, 0x19, 0xA1, 0x3D, 0x60, 0xCB, 0x66, 0x03, 0x63, 0xB9, 0x05, 0xFA, 0x83,
+    0xFE, 0x64, 0xCF, 0x16, 0x79, 0x79, 0xB3, 0x89, 0x80, 0x66, 0xB0, 0x1E, 0xD0, 0x9C, 0x77, 0xB0,
+    0x08, 0xAE, 0x5B, 0x19, 0xE0, 0x90, 0xE6, 0xE5, 0x60, 0x26, 0x5C, 0x60, 0x2F, 0xB1, 0xE1, 0x49,
+    0xA1, 0xC9, 0x78, 0x47, 0xFA, 0xE1, 0xC5, 0x08, 0xE8, 0x51, 0x46, 0xC0, 0xB8, 0x83, 0xD4, 0x3A,
+    0x19, 0x51, 0xC6, 0x28, 0x0A, 0x14, 0xC9, 0x41, 0x46, 0x54, 0xEC, 0x65, 0x44, 0x4D, 0x14, 0x65,
+    0x94, 0x8C, 0x60, 0x86, 0xCC, 0x2F, 0xB1, 0x68, 0x8B, 0x66, 0x48, 0x26, 0x4E, 0x90, 0x8C, 0x3B,
+    0x00, 0x9A, 0x08, 0x00, 0x6D, 0x00, 0x00, 0x39, 0x1F, 0xD4, 0xB9, 0x30, 0xA0, 0x45, 0x33, 0xF9,
+    0xD0, 0x40, 0x87, 0x26, 0xD1, 0x15, 0x42, 0xFA, 0xC2, 0xE4, 0xAD, 0xD5, 0x13, 0x99, 0x24, 0x0F,
+    0x27, 0x1F, 0xAE, 0x2F, 0xE6, 0x2F, 0x7D, 0x03, 0x87, 0x36, 0x15, 0xFD, 0x00, 0x20, 0xD3, 0x16,
+    0x80, 0x88, 0x85, 0x40, 0x15, 0xE9, 0xA1, 0x48, 0x07, 0x45, 0x02, 0x1D, 0x03, 0x80, 0xE3, 0x38,
+    0xC0, 0xA8, 0xCD, 0x04, 0xFB, 0xF6, 0x67, 0x64, 0x48, 0xBE, 0x4D, 0x72, 0xC9, 0xAC, 0x2F, 0x7E,
+    0x6E, 0xE1, 0xE9, 0x80, 0x87, 0xE1, 0x08, 0x74, 0x11, 0xFF, 0x4D, 0x43, 0x27, 0xC8, 0x19, 0x9A,
+    0x19, 0x82, 0x1C, 0xD0, 0x2D, 0xB8, 0xE5, 0x3F, 0x24, 0xC8, 0xBF, 0x2A, 0xC2, 0xA2, 0x3D, 0x04,
+    0xF2, 0x5F, 0xE7, 0x06, 0x43, 0x5C, 0xF8, 0x5E, 0x2C, 0x88, 0xFE, 0x21, 0xA1, 0xB4, 0x0B, 0xD8,
+    0x74, 0xF0, 0x76, 0x7D, 0xAE, 0x38, 0xD4, 0xEC, 0x0B, 0x50, 0xDF, 0x05, 0xA8, 0xB9, 0x40, 0xCD,
+    0x77, 0x39, 0x4C, 0xB2, 0x48, 0x8C, 0x7D, 0x01, 0xFB, 0xBB, 0xBC, 0xB6, 0x9F, 0x51, 0x3A, 0xBF,
+    0x68, 0x26, 0x58, 0x7E, 0xCC, 0xA1, 0x26, 0x5F, 0xCF, 0x0B, 0xAF, 0x8E, 0x76, 0x06, 0x00, 0xED,
+    0xB0, 0xA0, 0x3B, 0x0B, 0x19, 0xEA, 0x71, 0x7B, 0xE0, 0xD8, 0x8B, 0xF8, 0x22, 0x46, 0xFD, 0x68,
+    0x32, 0xA2, 0xC9, 0x9C, 0xD0, 0x64, 0xCE, 0x95, 0xCD, 0xE6, 0x28, 0xA3, 0x5E, 0x33, 0x7F, 0x3B,
+    0xA3, 0xC2, 0x51, 0x7E, 0xBC, 0x3A, 0x9D, 0x17, 0xE9, 0xE1, 0xCE, 0x24, 0xE1, 0x8B, 0x92, 0x45,
+    0xA2, 0xA1, 0x83, 0x7D, 0xF7, 0x33, 0x33, 0x7C, 0x97, 0xDF, 0xB2, 0xC9, 0x90, 0xFC, 0x39, 0xC9,
+    0xD4, 0x32, 0xD8, 0x71, 0x91, 0x62, 0xEC, 0x88, 0x63, 0x17, 0x13, 0x60, 0x38, 0xA2, 0xE1, 0x26,
+    0x13, 0x01, 0x18, 0x87, 0xBB, 0x64, 0xEA, 0x17, 0xC1, 0x08, 0x34, 0x1C, 0xC5, 0xC2, 0xA3, 0x49,
+    0x4E, 0x00, 0x13, 0x34, 0x1D, 0x5A, 0xCE, 0x28, 0x10, 0xDE, 0x28, 0x98, 0x01, 0xB2, 0x97, 0xB7,
+    0x23, 0xDA, 0xDB, 0x09, 0xFA, 0x5D, 0x0F, 0xFD, 0xEE, 0x0C, 0x9E, 0x19, 0x41, 0x3D, 0x8A, 0x64,
+    0x86, 0x66, 0x66, 0x2F, 0x67, 0x42, 0xEF, 0x27, 0xE8, 0x2B, 0x09, 0x94, 0x33, 0xF8, 0xED, 0xD0,
+    0xCC, 0x66, 0x14, 0x59, 0x7A, 0x7D, 0x89, 0xBD, 0x0C, 0x7A, 0x64, 0x93, 0xA0, 0x27, 0xFB, 0x5C,
+    0xE8, 0x66, 0x70, 0xA0, 0x76, 0x66, 0x14, 0x59, 0x24, 0x56, 0xEC, 0x65, 0x68, 0x19, 0x9A, 0x04,
+    0x3D, 0x75, 0x74, 0xDD, 0xCD, 0x15, 0x07, 0x4D, 0x18, 0xDE, 0xCE, 0xB0, 0xA1, 0x22, 0xDF, 0x0D,
+    0x15, 0x5D, 0x43, 0xEA, 0x49, 0x10, 0xDD, 0x22, 0x2F, 0x6E, 0x8D, 0x1D, 0x36, 0x32, 0xFA, 0xE6,
+    0xB0, 0x3F, 0xA2, 0x05, 0x90, 0x0B, 0x6B, 0x6F, 0xFC, 0x66, 0xB5, 0xEE, 0xE8, 0xA0, 0x38, 0x34,
+    0x9C, 0x21, 0x39, 0x55, 0xCC, 0x10, 0x0C, 0x30, 0x74, 0x35, 0x33, 0x3A, 0xCE, 0x20, 0x87, 0x26,
+    0x65, 0x18, 0x3B, 0x55, 0xD4, 0x4E, 0x5D, 0x0E, 0x30, 0x6F, 0xCC, 0xF2, 0x7A, 0x46, 0xF7, 0x31,
+    0x9B, 0x99, 0x43, 0x13, 0xF5, 0x7E, 0xD4, 0x53, 0xC5, 0x36, 0x64, 0x19, 0x60, 0x1C, 0xED, 0xC9,
+    0x8C, 0xCE, 0x6B, 0x3A, 0x0E, 0x4D, 0x6C, 0x38, 0xE9, 0xA9, 0x22, 0xE8, 0x65, 0x7E, 0xD1, 0x38,
+    0x15, 0x05, 0xD9, 0xF9, 0x26, 0x83, 0x7C, 0x3D, 0x82, 0xD0, 0x0B, 0x0F, 0x55, 0x88, 0x16, 0x22,
+    0x2E, 0xC3, 0x65, 0x81, 0x16, 0x86, 0xC3, 0x8D, 0x5B, 0x98, 0xD0, 0x63, 0x2F, 0xFE, 0xDD, 0xF1,
+    0x79, 0x6A, 0x92, 0x33, 0xD0, 0xF9, 0xCE, 0x03, 0x32, 0xDB, 0x69, 0x2B, 0x88, 0xDB, 0x3B, 0xF5,
+    0x07, 0xB0, 0x05, 0xCB, 0x8A, 0x00, 0xAA, 0x0D, 0x33, 0x06, 0x40, 0xE4, 0x62, 0x2C, 0xC3, 0x01,
+    0x85, 0x87, 0x80, 0x0C, 0xD6, 0x01, 0x6A, 0xD6, 0x53, 0xE1, 0xE8, 0x00, 0x33, 0xA9, 0x19, 0xB0,
+    0x63, 0x17, 0x96, 0x85, 0xA5, 0xE2, 0xD0, 0x26, 0xD4, 0x64, 0x99, 0xEE, 0xC8, 0x05, 0x36, 0x68,
+    0x49, 0xD2, 0xC9, 0xBC, 0xFA, 0x2E, 0x5D, 0x17, 0x01, 0x8E, 0x3A, 0x00, 0xD6, 0xEB, 0x19, 0x30,
+    0xDE, 0x78, 0x40, 0x07, 0x4E, 0x80, 0x8A, 0xF5, 0x4B, 0x58, 0xC3, 0x3A, 0xE3, 0x64, 0x30, 0x53,
+    0x5D, 0xA6, 0x6E, 0x8F, 0xEA, 0xE2, 0xB9, 0x52, 0xD9, 0xE3, 0x3F, 0x42, 0x45, 0xFA, 0x7A, 0xC1,
+    0x47, 0x7C, 0xFB, 0x37, 0xC5, 0xF2, 0xA3, 0x00, 0x41, 0x3B, 0x67, 0xC2, 0x31, 0x32, 0xB7, 0x24,
+    0x9F, 0xE7, 0x2D, 0x7E, 0xC0, 0xBE, 0xBB, 0xC5, 0xA1, 0xC9, 0x76, 0xAC, 0x79, 0x31, 0x54, 0xFC,
+    0x80, 0x7F, 0xC9, 0x40, 0x32, 0x77, 0x8C, 0xE6, 0x19, 0x06, 0x39, 0x55, 0xFD, 0x81, 0x74, 0x33,
+    0xA9, 0x01, 0xE8, 0xBC, 0x1E, 0x37, 0xA9, 0x9C, 0x94, 0x03, 0x2A, 0x54, 0xBF, 0xDF, 0x5D, 0x56,
+    0x28, 0x1F, 0x09, 0x7A, 0xB2, 0x4E, 0x06, 0xE5, 0xAB, 0xD4, 0xCC, 0xB8, 0x07, 0xF7, 0xFD, 0x2E,
+    0xBB, 0xAC, 0x59, 0x38, 0xF5, 0x85, 0xE8, 0xBA, 0x82, 0x55, 0x2D, 0xC8, 0x15, 0xCC, 0x87, 0xFC,
+    0xF1, 0x6A, 0x17, 0x6D, 0xE1, 0xF6, 0xC1, 0x67, 0x38, 0x00, 0x28, 0x86, 0x58, 0x10, 0x5C, 0xAC,
+    0x0D, 0xC6, 0x2E, 0xAD, 0xF6, 0x20, 0x63, 0x45, 0xD2, 0x55, 0x1C, 0x3A, 0x32, 0x42, 0xFB, 0x8A,
+    0xA4, 0x6B, 0x32, 0xBA, 0xBC, 0x7E, 0x11, 0xB6, 0x88, 0x78, 0xB2, 0x28, 0xE7, 0x6A, 0x1E, 0x08,
+    0x9D, 0x01, 0x68, 0xF3, 0xEA, 0xBB, 0x2C, 0xA8, 0xF3, 0xA2, 0x9F, 0xAB, 0x48, 0x5E, 0x5F, 0xEA,
+    0x63, 0x7C, 0x91, 0x27, 0x52, 0xD9, 0xC5, 0xCE, 0x0B, 0xD8, 0xF9, 0x11, 0x60, 0x39, 0x6B, 0x8E,
+    0xB0, 0xA4, 0x25, 0x8B, 0x0C, 0xC9, 0xA9, 0x7E, 0xBF, 0xE5, 0xDC, 0xA5, 0xC2, 0xD7, 0x72, 0x00,
+    0x54, 0x80, 0xF2, 0xC0, 0x13, 0x19, 0x6D, 0xAC, 0x8A, 0xAC, 0x5A, 0x1A, 0xC7, 0x7D, 0xDE, 0xB2,
+    0x24, 0x3F, 0xE6, 0x58, 0xE6, 0xE4, 0xA9, 0x5E, 0xCA, 0xD3, 0x03, 0x6D, 0x86, 0xC9, 0xC0, 0x33,
+    0xFC, 0x95, 0xE5, 0xCD, 0xD3, 0x5E, 0x93, 0xEF, 0x16, 0xF1, 0xD0, 0x95, 0xEE, 0x1F, 0x1A, 0xE6,
+    0x1E, 0x7B, 0x1B, 0xC1, 0xBA, 0x0D, 0x22, 0x19, 0x67, 0xF6, 0x69, 0x43, 0x47, 0x42, 0x6D, 0xD9,
+    0x3A, 0x92, 0x57, 0x0B, 0x33, 0x74, 0x95, 0xCC, 0x7C, 0x6B, 0x75, 0x2A, 0x02, 0x74, 0x90, 0xCB,
+    0x26, 0xAD, 0xF6, 0x48, 0x5E, 0x26, 0x23, 0xC9, 0xCB, 0x79, 0xFD, 0xE2, 0xA1, 0x73, 0x87, 0x36,
+    0x47, 0xEE, 0x52, 0xBF, 0x54, 0xAD, 0xA1, 0x26, 0xE5, 0x2B, 0x7E, 0x3B, 0x41, 0x92, 0xAE, 0x20,
+    0xEB, 0x5B, 0x59, 0xE7, 0x81, 0x5D, 0xC0, 0x70, 0x82, 0x5A, 0xC0, 0x74, 0x70, 0xD2, 0xB3, 0x0A,
+    0xE0, 0x3E, 0xD1, 0x44, 0xED, 0x61, 0x0E, 0xF1, 0x42, 0x64, 0x32, 0x7E, 0x81, 0x89, 0xF4, 0x5C,
+    0xAC, 0xAF, 0xEE, 0x93, 0xFC, 0xB1, 0xED, 0x0D, 0x39, 0x57, 0x24, 0xFB, 0x9A, 0x1C, 0xB7, 0xAC,
+    0x16, 0x80, 0x07, 0x99, 0x7B, 0xD4, 0x24, 0xE7, 0x45, 0xF0, 0x93, 0x24, 0xD9, 0xCB, 0x9B, 0xFD,
+    0x83, 0x1C, 0x65, 0x0F, 0xD0, 0xDF, 0xB3, 0x85, 0x14, 0x0B, 0x10, 0xD0, 0x15, 0xA9, 0x2C, 0x3E,
+    0xB4, 0x5E, 0xAF, 0x2F, 0x46, 0xC3, 0xCD, 0xEF, 0x2F, 0x69, 0xD4, 0xB7, 0xD6, 0xEB, 0x8B, 0xB1,
+    0x18, 0x7D, 0x69, 0x0F, 0x74, 0xB1, 0x9B, 0x01, 0x3D, 0xCB, 0x08, 0x58, 0xDF, 0xB2, 0x6F, 0x16,
+    0x36, 0xC9, 0xA1, 0x50, 0xA6, 0x26, 0x03, 0x70, 0x8C, 0x1C, 0x36, 0x52, 0xCA, 0x3F, 0xF9, 0x11,
+    0x60, 0x19, 0xD0, 0x2D, 0xD5, 0x1E, 0xBB, 0x73, 0x67, 0xB8, 0xC1, 0x1C, 0xE8, 0x00, 0x19, 0x8F,
+    0xAF, 0x56, 0x3C, 0xD2, 0xF4, 0x68, 0x46, 0x70, 0x3F, 0x41, 0x46, 0xED, 0x05, 0x9F, 0xE1, 0x5B,
+    0xF4, 0x72, 0x11, 0xAE, 0x7A, 0x18, 0x0E, 0x87, 0x5B, 0xDD, 0x4E, 0x9D, 0x03, 0xE4, 0xAC, 0xA7,
+    0x4D, 0xDA, 0x7A, 0xE5, 0x00, 0xF4, 0x77, 0xCE, 0x2B, 0xBF, 0x9F, 0xFD, 0x03, 0x00, 0x6A, 0x30,
+    0x10, 0x49, 0x06, 0xE8, 0x91, 0x43, 0x1D, 0x5B, 0x8F, 0x0A, 0xF7, 0x2C, 0x1C, 0xE0, 0xF7, 0x7B,
+    0xB4, 0xE4, 0x50, 0x91, 0xEC, 0x3B, 0x32, 0x55, 0x37, 0x8F, 0xD1, 0x17, 0xE4, 0xA3, 0x30, 0xE2,
+    0xBC, 0xB4, 0x5A, 0x3D, 0x71, 0x94, 0x95, 0x7E, 0x3D, 0x41, 0x46, 0x3D, 0x82, 0xFB, 0x84, 0x0E,
+    0x5D, 0x7A, 0x82, 0x20, 0x39, 0x8A, 0x02, 0x34, 0x07, 0xA0, 0xDA, 0x3D, 0xD2, 0x33, 0xAF, 0x56,
+    0x65, 0x96, 0xD3, 0xAE, 0x8C, 0x10, 0x39, 0x17, 0xE8, 0x42, 0xC4, 0x76, 0xB3, 0xE2, 0xDF, 0xF7,
+    0xFF, 0x61, 0xC8, 0x62, 0x63, 0xEE, 0x39, 0xAA, 0x01, 0x40, 0x13, 0xA5, 0x07, 0x50, 0xB1, 0xA0,
+    0x56, 0x7A, 0x20, 0x80, 0x4F, 0x2F, 0x52, 0xBF, 0x1F, 0x90, 0xC5, 0xF2, 0xF8, 0x02, 0xB4, 0x63,
+    0xDF, 0x79, 0x3D, 0x2E, 0x8F, 0xEC, 0xE0, 0x71, 0x1D, 0x63, 0xEE, 0x37, 0xB6, 0xC4, 0x8E, 0x64,
+    0x54, 0x7D, 0xC7, 0x45, 0x84, 0x52, 0x73, 0x61, 0xF9, 0x1A, 0xE2, 0xF8, 0x69, 0x42, 0x91, 0x68,
+    0x99, 0x50, 0x93, 0x33, 0x9E, 0x24, 0x07, 0xC0, 0xCE, 0x40, 0xCB, 0x65, 0xA4, 0x6A, 0x0F, 0xA8,
+    0xF4, 0x37, 0x50, 0xD9, 0x90, 0xEC, 0x48, 0x7E, 0x9B, 0x64, 0x6F, 0x98, 0x0E, 0x68, 0x59, 0xF7,
+    0xAF, 0x56, 0x6C, 0x62, 0x13, 0x3B, 0x2F, 0x27, 0xED, 0x16, 0x2A, 0xC6, 0x3F, 0xF9, 0x11, 0xCE,
+    0x90, 0x35, 0xC9, 0x93, 0x24, 0xE5, 0xB9, 0x2E, 0x95, 0x5F, 0xB7, 0x0E, 0x6D, 0x06, 0x39, 0x89,
+    0x32, 0x1E, 0xFB, 0xE3, 0xA7, 0x17, 0x30, 0x44, 0x26, 0xC0, 0xDE, 0xFE, 0xF0, 0x22, 0x2F, 0x92,
+    0xD1, 0x92, 0x6F, 0x5A, 0x06, 0x54, 0xBB, 0x85, 0x42, 0x46, 0x43, 0xF2, 0x51, 0x92, 0xA9, 0x21,
+    0xE9, 0x77, 0x56, 0x4F, 0xB0, 0x07, 0xAC, 0x5F, 0x2A, 0x6B, 0xFD, 0x62, 0x55, 0x50, 0xBA, 0xFA,
+    0x26, 0xD0, 0x91, 0x03, 0x0C, 0x39, 0x60, 0x6D, 0xD9, 0x03, 0xDD, 0x56, 0x6B, 0xAE, 0xE6, 0x05,
+    0x04, 0x10, 0xFC, 0xA3, 0x1E, 0x26, 0xEA, 0x6C, 0x39, 0x92, 0xCC, 0x82, 0xE4, 0x54, 0x93, 0xE1,
+    0x10, 0x4C, 0x7B, 0xE4, 0x67, 0xE7, 0x7B, 0xD7, 0x17, 0xE8, 0xCA, 0x54, 0x21, 0x38, 0x94, 0x29,
+    0xAD, 0x64, 0xE6, 0x25, 0xD3, 0x71, 0xC6, 0x06, 0x82, 0x89, 0xA8, 0xBE, 0x5B, 0x28, 0x78, 0x5E,
+    0xAA, 0x78, 0x87, 0xFE, 0xDE, 0xF8, 0x1E, 0x82, 0x67, 0xDF, 0x87, 0x49, 0x92, 0xE4, 0xA4, 0x49,
+    0x16, 0x88, 0xF4, 0x41, 0xBE, 0x0F, 0xE0, 0xF8, 0x6A, 0xB5, 0x34, 0xA4, 0x21, 0x27, 0x54, 0xDC,
+    0xD8, 0xDA, 0x6C, 0x44, 0x1F, 0xF0, 0x3A, 0x01, 0x1B, 0xE9, 0xA0, 0xA9, 0x3D, 0x14, 0x2F, 0x47,
+    0x48, 0x5E, 0x27, 0x5A, 0x46, 0x3A, 0x41, 0x6A, 0x2F, 0xB2, 0xBD, 0x1C, 0x2B, 0xAA, 0xEB, 0x04,
+    0x7F, 0x18, 0xE9, 0xCC, 0x3E, 0xB5, 0xD7, 0x13, 0x2F, 0xC7, 0xCE, 0xEB, 0xEB, 0x94, 0x41, 0x46,
+    0xBE, 0x1E, 0x05, 0xF5, 0xF5, 0x0C, 0x5E, 0x4E, 0x84, 0xBE, 0x4E, 0x0E, 0x32, 0x92, 0x4E, 0x50,
+    0x73, 0x02, 0x2F, 0xD3, 0x43, 0x5F, 0x67, 0x80, 0x8C, 0x8C, 0x10, 0xD4, 0x19, 0xA0, 0xC3, 0x6A,
+    0xB5, 0x87, 0x8E, 0x74, 0x15, 0x19, 0x21, 0xB9, 0xB1, 0x1F, 0x42, 0x31, 0xE8, 0xB9, 0x91, 0xA1,
+    0x69, 0xA6, 0x86, 0x37, 0x32, 0x48, 0x33, 0x75, 0xBC, 0x91, 0x05, 0x69, 0x26, 0x63, 0x6F, 0x24,
+    0x79, 0x9D, 0xE6, 0xE7, 0x49, 0xDF, 0x48, 0x7A, 0x9F, 0xE6, 0x9D, 0x59, 0xDF, 0x48, 0x14, 0x34,
+    0x1C, 0xF5, 0x0D, 0x06, 0x41, 0x43, 0xE8, 0x1B, 0x9C, 0x04, 0x4D, 0x84, 0xBE, 0xC1, 0x61, 0xA3,
+    0xF4, 0x96, 0x4E, 0xF7, 0x68, 0x83, 0xF2, 0x10, 0xB9, 0x8D, 0x80, 0xE9, 0x13, 0x0E, 0xE6, 0xCD,
+    0x2D, 0xBE, 0x2D, 0xA9, 0x3D, 0x5A, 0x5E, 0x8E, 0x10, 0xBC, 0x4E, 0xD4, 0x8C, 0x74, 0x20, 0xB5,
+    0x87, 0xE5, 0xE5, 0x08, 0xCD, 0xEB, 0x84, 0xFE, 0x28, 0xD2, 0x75, 0xD7, 0xA8, 0xBD, 0x0C, 0xF6,
+    0x72, 0x6C, 0xA2, 0xBE, 0x4E, 0x91, 0x65, 0xE4, 0x25, 0x0A, 0x6A, 0xCF, 0x81, 0x97, 0xA3, 0x71,
+    0xFA, 0x3A, 0xF5, 0x24, 0x23, 0xDF, 0xF5, 0x82, 0x9A, 0x01, 0xBC, 0xCC, 0x08, 0x7D, 0x9D, 0x19,
+    0x32, 0x92, 0x10, 0xD4, 0x1C, 0xC0, 0xCB, 0x74, 0xD0, 0xD7, 0x39, 0x6D, 0x6C, 0x32, 0xE4, 0xA8,
+    0xFB, 0x9A, 0x4D, 0x84, 0xF2, 0xC6, 0x55, 0x49, 0x84, 0xA3, 0x75, 0xFC, 0x1D, 0x75, 0x0E, 0xC4,
+    0x2C, 0x47, 0xA0, 0x8D, 0x9D, 0xDF, 0xA4, 0xCD, 0x2C, 0xA7, 0xBB, 0x2D, 0x8B, 0x95, 0x2D, 0x94,
+    0xCA, 0xB0, 0x98, 0xEE, 0xD5, 0x24, 0xE9, 0x1A, 0xBE, 0xDF, 0x70, 0x92, 0xEC, 0x41, 0xDF, 0x25,
+    0x40, 0x07, 0x15, 0x01, 0x15, 0x75, 0x00, 0xBA, 0xA8, 0x67, 0x40, 0xA6, 0x25, 0xF5, 0x87, 0xD2,
+    0xC3, 0xC7, 0x03, 0x20, 0x63, 0xB9, 0xAA, 0xDC, 0x41, 0x12, 0xB0, 0x73, 0xC3, 0xA9, 0x59, 0xB4,
+    0xB0, 0x65, 0x59, 0xEC, 0xA1, 0xC8, 0xB8, 0x05, 0xED, 0xB7, 0x8B, 0x53, 0x3D, 0xB7, 0x13, 0x3A,
+    0xAF, 0x1D, 0x8C, 0x63, 0x8F, 0x2C, 0x22, 0x70, 0x20, 0x50, 0xFC, 0xCB, 0xBE, 0xB0, 0x53, 0x2D,
+    0x39, 0xC3, 0x92, 0xB3, 0xE0, 0x5B, 0xF4, 0x2A, 0x82, 0x23, 0x5D, 0xC5, 0x7D, 0x42, 0xB0, 0x8B,
+    0x05, 0xDC, 0xD4, 0x1F, 0x73, 0x00, 0x5F, 0x27, 0x04, 0x65, 0x84, 0x8C, 0x7A, 0x86, 0x9D, 0xAC,
+    0x17, 0xEC, 0x79, 0xCB, 0x6E, 0x18, 0xE4, 0x62, 0xBB, 0x38, 0x1C, 0xB6, 0x5D, 0xFB, 0xEC, 0xCE,
+    0x19, 0x6B, 0x4E, 0x32, 0x03, 0xC6, 0x77, 0x11, 0x50, 0x41, 0xCD, 0x1B, 0x1E, 0xA0, 0xA4, 0x6D,
+    0xD2, 0x24, 0x79, 0xB7, 0x74, 0x6B, 0x52, 0x2B, 0x63, 0xB9, 0xAA, 0x8B, 0x40, 0x17, 0x64, 0x06,
+    0xF4, 0xDC, 0x70, 0xA8, 0xBE, 0xB0, 0x73, 0xAA, 0x7F, 0x0D, 0x54, 0xE4, 0x00, 0xB5, 0xA8, 0x63,
+    0x5D, 0xC7, 0xBF, 0xA2, 0xE3, 0x24, 0x78, 0x92, 0x68, 0x72, 0x69, 0x36, 0xC9, 0x8F, 0xB9, 0x58,
+    0xE8, 0xB3, 0xCB, 0xEB, 0x8B, 0xD1, 0x78, 0x68, 0x4F, 0x57, 0xF3, 0x59, 0xBA, 0x2E, 0x09, 0xDE,
+    0xA6, 0x6F, 0x16, 0x91, 0xC8, 0xA3, 0x66, 0xC2, 0x61, 0xC6, 0xEA, 0x28, 0x05, 0xA9, 0xDF, 0x86,
+    0x82, 0xFE, 0x41, 0x3B, 0xA9, 0xB4, 0x61, 0x4B, 0x41, 0x97, 0xBE, 0x98, 0x82, 0x7C, 0xC3, 0x5F,
+    0xD3, 0xEB, 0xB0, 0x50, 0xD0, 0x73, 0x84, 0x60, 0x47, 0xF2, 0x70, 0x57, 0xAE, 0x2F, 0x14, 0xA2,
+    0xD2, 0x1E, 0x76, 0xB2, 0xBE, 0x61, 0xCF, 0xCC, 0xA3, 0x14, 0xD4, 0x1F, 0xA2, 0x20, 0xE9, 0x74,
+    0x0F, 0xFB, 0x0C, 0x51, 0xB3, 0x8D, 0xA5, 0x03, 0x8F, 0x4E, 0x51, 0x35, 0x73, 0x5F, 0x6D, 0x6C,
+    0x74, 0x47, 0x59, 0x18, 0xE4, 0x07, 0xE9, 0xEE, 0x2B, 0x0B, 0x48, 0xC3, 0x0D, 0xFC, 0xD2, 0x85,
+    0x6A, 0xB5, 0x32, 0x5E, 0x91, 0x74, 0x96, 0x65, 0x2D, 0x8D, 0x0B, 0xD0, 0x5E, 0xD1, 0x2D, 0x7A,
+    0x31, 0x3D, 0x2F, 0x7B, 0x92, 0x7F, 0xD4, 0xD7, 0x9C, 0x35, 0xC9, 0xA1, 0x98, 0xEA, 0x91, 0xFD,
+    0x31, 0x72, 0x3A, 0xA8, 0x5C, 0xE7, 0x0C, 0xF4, 0xC8, 0x41, 0x8F, 0x1C, 0x94, 0x33, 0xFD, 0xA6,
+    0x62, 0xD5, 0xF7, 0x7B, 0x18, 0x06, 0x58, 0xB2, 0xD7, 0xE4, 0xF8, 0xF0, 0x77, 0xE9, 0x01, 0x33,
+    0x97, 0x95, 0x4E, 0x46, 0x41, 0x6E, 0xBF, 0xD5, 0xEA, 0x89, 0x58, 0xD8, 0x64, 0x1D, 0x7A, 0x58,
+    0x6F, 0x2F, 0x70, 0xB2, 0xA5, 0x86, 0x38, 0xC3, 0x19, 0xD8, 0xDB, 0x2C, 0x5C, 0x35, 0x39, 0x2F,
+    0xCA, 0xC3, 0x92, 0x3D, 0x3C, 0x07, 0x2E, 0xEE, 0x0C, 0x32, 0xAA, 0xB0, 0xB5, 0xD8, 0x6F, 0x13,
+    0x44, 0x86, 0xF1, 0xB0, 0x4E, 0xB0, 0x97, 0x71, 0x31, 0xE9, 0xA4, 0xD3, 0x1E, 0x4D, 0x12, 0x19,
+    0xD0, 0xDE, 0x3A, 0x54, 0x3C, 0x15, 0x00, 0x99, 0xD8, 0xA3, 0x98, 0x2C, 0x0B, 0x26, 0x00, 0xAA,
+    0x68, 0x51, 0x02, 0x16, 0x96, 0x00, 0x9C, 0x00, 0x98, 0x03, 0xF7, 0x0E, 0x4E, 0x1B, 0x75, 0x54,
+    0xB1, 0x5B, 0xD9, 0x2B, 0xD2, 0xFC, 0x6A, 0x85, 0x22, 0xBB, 0x89, 0xC5, 0x09, 0x20, 0x1E, 0xAA,
+    0xA8, 0xE0, 0x50, 0xC0, 0x01, 0x35, 0xCB, 0x04, 0x19, 0x6B, 0x0E, 0x4D, 0x86, 0xF6, 0x35, 0xFB,
+    0x36, 0x81, 0xAE, 0xE2, 0x60, 0x26, 0x68, 0xAF, 0x3C, 0xDA, 0x28, 0x23, 0xC0, 0xE7, 0x12, 0xA0,
+    0xAE, 0x11, 0x68, 0x22, 0x07, 0x80, 0x76, 0x5C, 0x4C, 0xAD, 0x04, 0x03, 0x00, 0x1B, 0xB1, 0xF0,
+    0x22, 0xE2, 0x40, 0xF5, 0x63, 0xA6, 0x05, 0x81, 0xBB, 0xAF, 0x54, 0x37, 0x6E, 0xDA, 0x54, 0x1A,
+    0x76, 0xB0, 0xE8, 0x57, 0xB1, 0xF1, 0x80, 0x1E, 0x39, 0x14, 0xE9, 0x01, 0xCA, 0x99, 0x1E, 0xB8,
+    0xEF, 0x10, 0x89, 0xFF, 0x7E, 0xF5, 0xEE, 0x01, 0x10, 0xD4, 0x44, 0x39, 0xA3, 0xA2, 0x48, 0x80,
+    0x1E, 0xEC, 0xA7, 0x50, 0x20, 0x1D, 0xD0, 0xB0, 0xE1, 0xE2, 0x8D, 0x40, 0xA7, 0x02, 0xCC, 0x24,
+    0x08, 0x35, 0x17, 0xAB, 0x94, 0x2E, 0x34, 0x19, 0x82, 0x35, 0x01, 0xEB, 0xE8, 0x20, 0x83, 0x19,
+    0x51, 0x53, 0x79, 0xC0, 0x5C, 0x0E, 0x80, 0xBC, 0x9D, 0x80, 0x9A, 0x04, 0xA0, 0x39, 0x00, 0x2D,
+    0x1D, 0x50, 0x71, 0x6B, 0x81, 0x2A, 0xE3, 0x06, 0x73, 0x16, 0x04, 0xAA, 0x86, 0x0E, 0x20, 0x1D,
+    0xA0, 0x8B, 0x05, 0xDC, 0x78, 0x80, 0x7D, 0x3E, 0xF0, 0xC2, 0x7A, 0x80, 0x60, 0x37, 0x03, 0x76,
+    0x3F, 0x03, 0xD2, 0xDB, 0x1E, 0x22, 0x74, 0x23, 0xF0, 0xB4, 0x98, 0x7E, 0x4F, 0x3B, 0xBA, 0x5E,
+    0x3F, 0x70, 0xBE, 0xCC, 0x9F, 0x72, 0xB6, 0x0E, 0xFA, 0x4D, 0x02, 0xE6, 0x64, 0x00, 0x42, 0x33,
+    0x1E, 0x06, 0xDA, 0x26, 0x74, 0xD1, 0x78, 0xA8, 0x59, 0x7B, 0x68, 0xAF, 0x02, 0xCC, 0x24, 0x23,
+    0xEC, 0xD8, 0x46, 0xD0, 0x35, 0xB9, 0xE2, 0x20, 0x58, 0x13, 0x35, 0x05, 0x17, 0x62, 0xB6, 0x6F,
+    0xC4, 0xA5, 0x8F, 0xF5, 0xD5, 0x79, 0xA1, 0x65, 0x59, 0xCC, 0x03, 0x1C, 0xD0, 0x14, 0x8E, 0x76,
+    0x63, 0x3B, 0xD9, 0xE4, 0x2D, 0x6F, 0x1B, 0x17, 0x3B, 0x43, 0xCD, 0x09, 0xD0, 0xEC, 0x0F, 0x13,
+    0x72, 0x1D, 0x1A, 0x5F, 0x64, 0x77, 0x3D, 0x72, 0x80, 0xAD, 0xE3, 0x1D, 0x44, 0x6C, 0xC7, 0x62,
+    0x2C, 0xA8, 0x6F, 0x27, 0x80, 0x57, 0x67, 0x08, 0x7E, 0xE6, 0xA1, 0x01, 0xFA, 0x06, 0x7B, 0xF0,
+    0x32, 0xFF, 0xDA, 0x52, 0x15, 0x53, 0x1A, 0xB2, 0xCC, 0x9B, 0xC7, 0xD6, 0x27, 0xBF, 0xBC, 0x49,
+    0x2E, 0x90, 0xEA, 0x19, 0xF6, 0x12, 0xA1, 0xBC, 0x71, 0x62, 0x96, 0xD3, 0x91, 0x4A, 0xD1, 0x55,
+    0xB4, 0x1E, 0xE6, 0x6A, 0x44, 0x77, 0x9B, 0x68, 0xF2, 0xD1, 0x03, 0xAE, 0xCD, 0x96, 0xE4, 0xF3,
+    0x24, 0x7F, 0x49, 0x32, 0xB4, 0xFC, 0x68, 0xEB, 0xBB, 0x39, 0x15, 0x65, 0xCF, 0x81, 0x33, 0xE7,
+    0xC4, 0x82, 0x34, 0x1D, 0x7C, 0xDF, 0x5A, 0xED, 0x15, 0xBF, 0xC7, 0xDF, 0xE2, 0xFB, 0xD6, 0x2E,
+    0x48, 0x7F, 0xE4, 0xBB, 0xD1, 0xA7, 0xDE, 0xF5, 0x5B, 0xCC, 0xF9, 0x0D, 0xF9, 0x3A, 0x19, 0xCD,
+    0xAD, 0xF5, 0x73, 0x19, 0x30, 0x13, 0x9A, 0xCF, 0xDB, 0x70, 0x0D, 0x43, 0xDF, 0x90, 0x30, 0xF4,
+    0xA8, 0x08, 0x74, 0x77, 0x6E, 0xB0, 0xDE, 0xF6, 0x55, 0xAA, 0x03, 0x00, 0x7B, 0x89, 0x00, 0x94,
+    0x37, 0x0E, 0x10, 0x41, 0x4E, 0xF8, 0xD4, 0x54, 0x55, 0x1A, 0x50, 0x54, 0xE3, 0x45, 0x37, 0x5E,
+    0x94, 0xE3, 0x45, 0xA1, 0xF4, 0x19, 0x27, 0x3E, 0xFC, 0x11, 0x2A, 0x5A, 0x72, 0x86, 0xB9, 0x4A,
+    0x72, 0xE8, 0x6E, 0x93, 0x0C, 0x4D, 0xE6, 0x87, 0x96, 0x15, 0xAD, 0xAF, 0x38, 0x9A, 0xAB, 0x11,
+    0x2A, 0x74, 0xB7, 0x89, 0x86, 0xE5, 0x41, 0x5D, 0xA2, 0xF5, 0xB0, 0xDE, 0x5C, 0x8D, 0xD0, 0xA1,
+    0xBB, 0xCD, 0xCA, 0xA6, 0x26, 0x93, 0x64, 0x45, 0x4B, 0x12, 0xE6, 0x2A, 0x99, 0xD1, 0xDD, 0x26,
+    0xC3, 0xD6, 0x27, 0xE2, 0xCB, 0xF3, 0xD4, 0x66, 0x02, 0x04, 0x3F, 0x33, 0xFD, 0x64, 0x0F, 0x82,
+    0x86, 0x1C, 0x05, 0x0D, 0x0B, 0x17, 0xCF, 0x24, 0x68, 0x7E, 0x75, 0x86, 0x82, 0x66, 0x12, 0x9F,
+    0x4A, 0x5B, 0x0A, 0x9A, 0x5B, 0xCC, 0x82, 0x86, 0x8C, 0x82, 0x86, 0xF4, 0x82, 0x86, 0xB9, 0x17,
+    0x14, 0x1B, 0x87, 0xCE, 0x43, 0x99, 0xD5, 0x6A, 0x57, 0x6F, 0xC1, 0xC3, 0xC3, 0x19, 0x4D, 0xCE,
+    0x82, 0xE4, 0xA0, 0x17, 0x96, 0x60, 0xF8, 0xAF, 0xB8, 0xDA, 0xC5, 0xDD, 0x0B, 0x8B, 0x02, 0x61,
+    0xC6, 0x83, 0xCC, 0x06, 0xB0, 0x5B, 0x32, 0xDD, 0xC2, 0x30, 0xB7, 0x9C, 0x8B, 0xE6, 0xA3, 0x65,
+    0x7F, 0xD8, 0x9C, 0x89, 0xF9, 0xD0, 0x37, 0xB5, 0xA9, 0xA8, 0xE9, 0xDA, 0x04, 0x5C, 0xCC, 0xEB,
+    0x7E, 0xE1, 0x4C, 0x06, 0x92, 0x83, 0x3C, 0x74, 0xAE, 0xCD, 0x2F, 0xA2, 0x65, 0xDA, 0x7E, 0x51,
+    0x2F, 0x5F, 0xB1, 0x7C, 0x19, 0xCB, 0x8C, 0x48, 0x0F, 0x3C, 0xD9, 0x43, 0xCF, 0x00, 0x47, 0x15,
+    0x21, 0xE8, 0x64, 0x46, 0x43, 0x34, 0x84, 0xCC, 0xA8, 0xE9, 0x54, 0x01, 0xF6, 0x67, 0xC0, 0x78,
+    0x4E, 0x80, 0xBA, 0x59, 0x58, 0x23, 0xF6, 0x58, 0xAC, 0xDB, 0x17, 0x1B, 0x61, 0x06, 0x00, 0x15,
+    0xE7, 0xED, 0x11, 0x59, 0x6C, 0xDF, 0xC9, 0x1E, 0xD0, 0x9F, 0xD0, 0x01, 0xD6, 0x5B, 0x8F, 0x8A,
+    0x4E, 0xCF, 0x10, 0x1C, 0xBA, 0xB4, 0xD7, 0x12, 0x92, 0xB9, 0x4B, 0x10, 0xCC, 0x3A, 0xA0, 0x66,
+    0xB6, 0x7E, 0xB1, 0x07, 0x5E, 0xEC, 0x79, 0x4B, 0x5A, 0xC8, 0x47, 0xA6, 0xED, 0xBD, 0x37, 0xA9,
+    0x5F, 0x38, 0x8A, 0x43, 0x32, 0x7C, 0x86, 0x4C, 0x15, 0x9D, 0xCC, 0xD0, 0xA1, 0x21, 0x04, 0x4F,
+    0xB2, 0x87, 0xB9, 0xC6, 0xA1, 0xF0, 0x24, 0x28, 0xFE, 0x10, 0x9C, 0x36, 0x97, 0x17, 0xB6, 0x80,
+    0xAE, 0x40, 0xAC, 0xD0, 0xD7, 0xD9, 0x43, 0x07, 0xE3, 0xA1, 0x62, 0xCB, 0x17, 0x65, 0x02, 0x79,
+    0x2A, 0xA3, 0xE3, 0x3B, 0x84, 0x28, 0xAD, 0x4B, 0x5B, 0x6D, 0x9F, 0x1E, 0x37, 0x46, 0x06, 0x8C,
+    0x00, 0x74, 0xDE, 0xB8, 0x62, 0x54, 0x2F, 0x2D, 0x7D, 0x6A, 0x3D, 0x24, 0xC1, 0x09, 0xC6, 0x57,
+    0x74, 0x82, 0x43, 0xE9, 0x52, 0xC1, 0x9E, 0x23, 0x1A, 0xCA, 0x0C, 0xB4, 0xD9, 0xF8, 0x4D, 0x8F,
+    0xAA, 0xE2, 0xAB, 0xB0, 0x90, 0x58, 0x61, 0x66, 0xD9, 0xEB, 0x02, 0xE8, 0x6D, 0x50, 0xAF, 0x69,
+    0xE9, 0xCF, 0x9A, 0xAF, 0xD1, 0x2D, 0x46, 0xDC, 0x9C, 0x1A, 0xA2, 0x25, 0x24, 0x61, 0x66, 0xC8,
+    0x2C, 0x38, 0x40, 0x45, 0x15, 0xB1, 0x78, 0x87, 0x42, 0x07, 0xE8, 0xB9, 0x8B, 0xE0, 0xD4, 0xE6,
+    0x8A, 0x4E, 0xF0, 0x24, 0xFB, 0x8A, 0x6F, 0xE4, 0x85, 0x3F, 0xD3, 0x8B, 0x41, 0xF2, 0x74, 0x90,
+    0xDC, 0x6B, 0x99, 0xCF, 0x15, 0x67, 0x45, 0x5E, 0x4E, 0x10, 0x7C, 0x8E, 0x68, 0x59, 0xD3, 0xC9,
+    0x54, 0x54, 0x3D, 0xC6, 0x5B, 0x0F, 0x1D, 0xE1, 0xF0, 0x08, 0xC4, 0x6B, 0x8C, 0x3F, 0x7D, 0xE4,
+    0xEB, 0x7F, 0x7A, 0xEF, 0x1F, 0xD6, 0x03, 0xCE, 0xE3, 0xEB, 0xB8, 0x17, 0x5F, 0x26, 0x53, 0xF5,
+    0x80, 0xC3, 0x04, 0x0F, 0xE6, 0x3F, 0x12, 0xC3, 0x74, 0xFE, 0x0F, 0xBF, 0xEC, 0x95, 0x4B, 0x66,
+    0x47, 0xF3, 0x3D, 0x66, 0xCD, 0xF7, 0x98, 0x01, 0x1C, 0xD9, 0x79, 0x72, 0xBD, 0x5E, 0x5F, 0x24,
+    0x79, 0x7B, 0x63, 0xB3, 0x51, 0xD6, 0xC1, 0xA2, 0x22, 0x89, 0x9F, 0xB5, 0x05, 0xA0, 0x87, 0xEE,
+    0xDD, 0xA9, 0xB9, 0x11, 0xAA, 0x94, 0x61, 0xCC, 0xEF, 0x6E, 0xE7, 0xC9, 0xFE, 0xDE, 0xE1, 0xF8,
+    0x6A, 0xB5, 0x4B, 0xF2, 0xFA, 0xC6, 0xAF, 0x1F, 0xC0, 0x7A, 0xBD, 0xFE, 0x8F, 0x24, 0xFF, 0xAF,
+    0xF5, 0xFA, 0xA5, 0x26, 0xB6, 0x51, 0x06, 0x39, 0x77, 0x5E, 0x4D, 0xCA, 0x69, 0x77, 0x1C, 0xE6,
+    0x12, 0x4F, 0xE6, 0x36, 0x76, 0x5E, 0x3B, 0xDB, 0xE7, 0x6A, 0xAF, 0x9B, 0x95, 0xB7, 0x8E, 0xAF,
+    0x51, 0x24, 0x19, 0x3A, 0xAF, 0x9D, 0xBD, 0xC4, 0x3A, 0xB5, 0xB3, 0xF4, 0xDA, 0xE9, 0x61, 0x85,
+    0x3D, 0x18, 0x67, 0x9F, 0xE1, 0x63, 0x14, 0xB9, 0x89, 0x6D, 0x2C, 0xB7, 0xD2, 0xCE, 0x38, 0xDB,
+    0x13, 0xB9, 0x8E, 0xD5, 0x5E, 0xB5, 0x8B, 0xE3, 0x3D, 0xC0, 0x01, 0x75, 0x2A, 0xCA, 0xE0, 0xCE,
+    0x01, 0x06, 0x40, 0x84, 0xFC, 0xE8, 0x56, 0xD4, 0xA4, 0x27, 0xB9, 0xFF, 0x61, 0xBE, 0x08, 0xE1,
+    0x01, 0xE9, 0x8A, 0x4B, 0x4F, 0x04, 0x1A, 0xBF, 0x2D, 0x5C, 0xC5, 0x72, 0xAD, 0x1A, 0x01, 0xDB,
+    0xA3, 0x4E, 0xC5, 0x2A, 0x5F, 0x4F, 0xC5, 0x24, 0x7F, 0x67, 0x17, 0xB0, 0x0E, 0x55, 0x2E, 0xBE,
+    0x47, 0x72, 0x04, 0x34, 0xEA, 0x1F, 0xA7, 0xEF, 0x9D, 0x2A, 0xE2, 0xEA, 0x4C, 0x72, 0x44, 0x2C,
+    0xEE, 0x49, 0xDD, 0x04, 0x98, 0x01, 0xC8, 0x80, 0x98, 0xF1, 0xDF, 0x9E, 0x7A, 0xF3, 0x5F, 0x91,
+    0xBC, 0x42, 0xF2, 0x14, 0x99, 0xEE, 0x93, 0xEE, 0x3E, 0xE8, 0x1E, 0x48, 0x40, 0x13, 0x4A, 0x61,
+    0xEB, 0x80, 0x5D, 0x58, 0xAF, 0xB8, 0xCF, 0x6C, 0x78, 0x83, 0x34, 0xBC, 0x4E, 0x6A, 0xBE, 0xC9,
+    0x58, 0x6C, 0x45, 0xFE, 0x0C, 0xD0, 0x3D, 0xB4, 0x87, 0xCE, 0xD0, 0x1C, 0x35, 0x83, 0xE6, 0xA4,
+    0x09, 0x3D, 0x43, 0x0F, 0x78, 0x64, 0x01, 0x7B, 0xED, 0xB7, 0xA9, 0xA2, 0xF1, 0x1C, 0x8A, 0xEC,
+    0xDB, 0x04, 0x98, 0x93, 0xEC, 0xB5, 0xE7, 0xD4, 0x25, 0x3D, 0x37, 0xFC, 0x4E, 0x84, 0x75, 0xF7,
+    0x63, 0xA7, 0x07, 0xCC, 0x59, 0x9E, 0xCA, 0x7A, 0xB6, 0xEE, 0x7E, 0x00, 0x8A, 0x6F, 0xE0, 0x2B,
+    0x91, 0x7D, 0x3D, 0xE0, 0x3C, 0xEE, 0x2F, 0xD6, 0x7C, 0x13, 0xFE, 0xEC, 0xAB, 0x91, 0xFC, 0xBD,
+    0xA8, 0x07, 0xEC, 0xF2, 0xC8, 0xA7, 0x1E, 0xBE, 0xDC, 0x5F, 0xD5, 0x93, 0xBF, 0x5A, 0x8D, 0x18,
+    0x31, 0x62, 0xC2, 0x57, 0xBB, 0x6E, 0x75, 0x1A, 0x0D, 0x1A, 0x34, 0x68, 0xBF, 0xCA, 0x75, 0x87,
+    0x19, 0x93, 0x11, 0x75, 0xC2, 0x46, 0x23, 0xBD, 0x78, 0x8E, 0xD0, 0xC1, 0x16, 0x5B, 0xD8, 0x37,
+    0x02, 0xF4, 0x00, 0x00, 0x6A, 0x64, 0xB1, 0xA1, 0x81, 0xF4, 0xCA, 0x75, 0xD3, 0xA2, 0x46, 0x99,
+    0xE5, 0x62, 0x03, 0x5A, 0xA7, 0x26, 0x2C, 0xBA, 0x16, 0x7B, 0x72, 0x41, 0x08, 0xBD, 0x7E, 0x2D,
+    0x1D, 0x3B, 0x8F, 0xEA, 0x85, 0x3A, 0x49, 0x4F, 0xC9, 0xA1, 0xE1, 0xA8, 0xDF, 0x09, 0xF6, 0x14,
+    0x43, 0xC3, 0xD4, 0x32, 0xEA, 0x1F, 0x66, 0x8A, 0x4C, 0xC7, 0xA4, 0xF7, 0x63, 0xF7, 0x4B, 0x4A,
+    0x7F, 0xEC, 0x3F, 0x77, 0x13, 0x45, 0x34, 0x8F, 0x26, 0x40, 0x7A, 0x3D, 0x50, 0x8D, 0x66, 0x40,
+    0x13, 0xBA, 0x49, 0xBF, 0x31, 0x77, 0x13, 0x44, 0x14, 0x41, 0x5E, 0x4B, 0x4D, 0x40, 0x9D, 0x90,
+    0x45, 0xB4, 0x8F, 0x66, 0x80, 0xD0, 0x8E, 0xDD, 0x64, 0x7B, 0xD8, 0xBE, 0x9D, 0xED, 0xD9, 0xA8,
+    0x1D, 0xF4, 0x50, 0x91, 0xCE, 0x72, 0x82, 0x76, 0x50, 0x1C, 0x25, 0x3D, 0xBA, 0x09, 0x15, 0x47,
+    0x2C, 0x66, 0xAB, 0x15, 0x50, 0xDD, 0xC1, 0xA5, 0xA1, 0x61, 0x8F, 0x66, 0x2B, 0xC3, 0x1B, 0x0E,
+    0x4B, 0x9B, 0x8B, 0xE2, 0xA6, 0xAF, 0xB7, 0xA6, 0xE0, 0xDD, 0x35, 0x42, 0x6E, 0xAD, 0x46, 0xEC,
+    0xC9, 0x08, 0xBB, 0x15, 0xA6, 0x63, 0x3B, 0x8B, 0xAD, 0x0C, 0x20, 0xBD, 0x1A, 0xB7, 0xF7, 0x80,
+    0x76, 0xF6, 0xD1, 0x03, 0xC5, 0x0C, 0xEB, 0x74, 0x70, 0x0F, 0x11, 0xA5, 0x37, 0x8F, 0xBE, 0x04,
+    0x7C, 0x1F, 0x78, 0xA0, 0x6F, 0x67, 0xBD, 0x1F, 0x35, 0xD1, 0x71, 0x68, 0xE9, 0xBA, 0x1B, 0x59,
+    0x5D, 0x21, 0x41, 0xF6, 0x96, 0x4E, 0xD1, 0xB3, 0xBB, 0x9D, 0xDA, 0x4C, 0x41, 0x0E, 0x9A, 0xDF,
+    0x99, 0xF9, 0xED, 0xA8, 0x5F, 0x4B, 0xDD, 0x44, 0x3C, 0x78, 0x5E, 0x9F, 0x8D, 0xF2, 0xE3, 0xDC,
+    0x04, 0xFB, 0x58, 0x2A, 0x37, 0xD5, 0xAF, 0x07, 0x79, 0x3D, 0x96, 0x61, 0xA9, 0x9D, 0x7D, 0x62,
+    0xD2, 0x97, 0x7D, 0x37, 0x01, 0x04, 0x45, 0x34, 0x03, 0xB5, 0x33, 0x03, 0x9A, 0x59, 0x44, 0xF9,
+    0x71, 0x16, 0xD1, 0x3E, 0x96, 0x00, 0xED, 0xA4, 0xD7, 0xFB, 0xB1, 0xFB, 0xDB, 0xD4, 0xCE, 0xA8,
+    0x13, 0xD4, 0x2F, 0xB3, 0xF4, 0x3C, 0x19, 0xB5, 0x83, 0xF4, 0xD0, 0x9C, 0x3B, 0x46, 0xC9, 0x0C,
+    0xD8, 0x1E, 0x86, 0x83, 0x2E, 0xDD, 0x2B, 0x02, 0x60, 0x02, 0x54, 0xDA, 0x2A, 0x9F, 0xEE, 0x01,
+    0x76, 0x4A, 0x2F, 0x1B, 0x27, 0x43, 0x45, 0x68, 0xD7, 0x04, 0x10, 0x9D, 0x13, 0x01, 0x27, 0x00,
+    0x18, 0xC7, 0x5E, 0x4F, 0xC6, 0x75, 0x5E, 0x3B, 0xE9, 0xBB, 0xA9, 0x09, 0xD2, 0x8B, 0xD8, 0xCC,
+    0x55, 0x14, 0x01, 0xB9, 0x8A, 0x38, 0x81, 0x57, 0x4A, 0xB1, 0xC7, 0x32, 0xF4, 0x64, 0x1C, 0xD1,
+    0x79, 0xED, 0xEC, 0x20, 0x7D, 0x37, 0x69, 0xD7, 0x04, 0xE9, 0xD5, 0x28, 0x62, 0x33, 0xCB, 0xA9,
+    0x8A, 0x22, 0xB4, 0x1E, 0xB9, 0x8A, 0x62, 0xC6, 0x09, 0xBC, 0x52, 0x05, 0x40, 0x8F, 0x15, 0x21,
+    0x67, 0x68, 0x57, 0x25, 0x48, 0x0F, 0xDD, 0xD7, 0x11, 0xED, 0xA8, 0x47, 0x3B, 0x34, 0x51, 0x7A,
+    0xF0, 0xD1, 0x0C, 0xE9, 0x75, 0x81, 0xAF, 0xB5, 0x33, 0x10, 0xB3, 0x9C, 0x60, 0x11, 0xD1, 0x8E,
+    0xDD, 0xA0, 0x47, 0x3B, 0x10, 0x4D, 0x94, 0x5E, 0x4D, 0xE0, 0xA3, 0x59, 0x44, 0x48, 0xAF, 0x9D,
+    0x19, 0xAA, 0x24, 0x42, 0xEB, 0xA1, 0x9D, 0x41, 0x86, 0x98, 0xE5, 0xD4, 0x39, 0x58, 0x44, 0x11,
+    0xCA, 0x65, 0xC0, 0x3F, 0x05, 0xA4, 0x43, 0x13, 0x20, 0x88, 0xEA, 0xC6, 0x84, 0xF8, 0x32, 0x7E,
+    0x20, 0x07, 0x55, 0x7B, 0x39, 0x9C, 0x68, 0x5D, 0xBB, 0x3F, 0x21, 0xE0, 0x0F, 0x50, 0x07, 0xD8,
+    0xA9, 0x8B, 0x82, 0xE0, 0xA8, 0xE7, 0x36, 0xC3, 0xF8, 0x45, 0xC7, 0x38, 0xA3, 0x58, 0x32, 0xF4,
+    0xE8, 0x6B, 0x54, 0x11, 0x66, 0xDA, 0x28, 0x1F, 0x2B, 0xBA, 0x36, 0xC3, 0x4E, 0x2A, 0x34, 0x04,
+    0x9D, 0x9E, 0x9B, 0x84, 0x76, 0x38, 0x50, 0x8B, 0xDD, 0x07, 0xE5, 0xD0, 0x37, 0x4E, 0x64, 0x3C,
+    0x5C, 0x11, 0x66, 0x6A, 0x83, 0x8C, 0x22, 0xD5, 0xEC, 0xB5, 0xEF, 0x06, 0x3B, 0x82, 0x0E, 0x6A,
+    0xDE, 0x38, 0x11, 0xC9, 0x58, 0xB3, 0x07, 0xB4, 0xB7, 0x23, 0x8A, 0xB4, 0x59, 0x47, 0xC1, 0x24,
+    0xA2, 0x9E, 0x24, 0x7B, 0xF3, 0x01, 0x61, 0x7D, 0x93, 0xF5, 0xA4, 0xE8, 0xF4, 0xF8, 0x42, 0x4B,
+    0x56, 0x2F, 0x2C, 0x3E, 0x19, 0xB0, 0xA3, 0xF6, 0x45, 0x53, 0xE8, 0xD0, 0x26, 0x08, 0xA2, 0x66,
+    0xBF, 0x2B, 0x23, 0xEC, 0xA8, 0x9D, 0xF6, 0xDD, 0xDC, 0x64, 0x70, 0x78, 0x05, 0x66, 0x12, 0xBE,
+    0xEE, 0x45, 0xC2, 0x1F, 0x02, 0x78, 0xA0, 0x2F, 0x28, 0xA7, 0x4C, 0x35, 0xF7, 0xD9, 0x5B, 0xCF,
+    0xB1, 0x8B, 0xE5, 0x40, 0xC5, 0x7D, 0xC2, 0x4C, 0x74, 0x5D, 0x50, 0x5E, 0xE4, 0x36, 0x82, 0xCF,
+    0xB2, 0x98, 0xA6, 0xCC, 0x9D, 0x17, 0xA9, 0x89, 0xE0, 0xA3, 0x84, 0x1E, 0xCD, 0x20, 0xFD, 0x4E,
+    0x7F, 0x08, 0x78, 0x31, 0x43, 0xEB, 0xF5, 0xDC, 0x52, 0xE6, 0xE5, 0xA6, 0xD6, 0xC9, 0xB9, 0xEA,
+    0xB1, 0xBB, 0xE0, 0x90, 0x09, 0xA6, 0x00, 0x77, 0x5E, 0x93, 0x41, 0x51, 0x46, 0xB0, 0x59, 0xBE,
+    0x6D, 0x04, 0xBB, 0x19, 0xB4, 0x1E, 0xE4, 0x00, 0xE6, 0xA2, 0xC5, 0xB2, 0x63, 0x59, 0xBF, 0xAC,
+    0x3B, 0x3A, 0x3D, 0xE8, 0xA1, 0xE8, 0x17, 0x39, 0x95, 0xAF, 0x71, 0xC0, 0x0E, 0xF0, 0xD0, 0x7A,
+    0xBD, 0xFE, 0x5F, 0x49, 0x52, 0x93, 0xBC, 0xB6, 0x5E, 0xAF, 0x8B, 0x84, 0xF8, 0x2F, 0x00, 0xFC,
+    0xE3, 0x47, 0x00, 0x3C, 0xD2, 0x01, 0xF8, 0x59, 0x33, 0x42, 0xF8, 0x2A, 0x3F, 0x6A, 0x1C, 0x0C,
+    0x33, 0x70, 0x8C, 0xE7, 0x00, 0xAC, 0xB0, 0x68, 0xD3, 0x2C, 0x09, 0x31, 0xA3, 0x1B, 0xE5, 0x80,
+    0xCA, 0x3F, 0x0C, 0xE0, 0xA9, 0x47, 0x00, 0xFC, 0xF3, 0xFB, 0x00, 0xFC, 0x41, 0x19, 0x44, 0x2F,
+    0x03, 0x72, 0x40, 0xED, 0x81, 0x13, 0x40, 0xE3, 0x80, 0x00, 0x74, 0x80, 0x98, 0x80, 0x1F, 0x00,
+    0xD2, 0xA1, 0x9A, 0x01, 0x5D, 0x56, 0x73, 0xEB, 0x20, 0x7F, 0x80, 0xFA, 0x63, 0x8F, 0x6F, 0xCA,
+    0xBE, 0x75, 0x2F, 0x23, 0x88, 0x51, 0x41, 0x89, 0x09, 0x33, 0x0E, 0xC3, 0xE1, 0x6A, 0x03, 0xF5,
+    0x6C, 0xA7, 0xBD, 0x6A, 0x3B, 0xC9, 0xE9, 0x65, 0xFB, 0xBE, 0x74, 0xFF, 0x63, 0x39, 0x70, 0xE3,
+    0x36, 0x17, 0x33, 0x39, 0x16, 0x1D, 0xED, 0xE2, 0xFD, 0x0E, 0x60, 0xC7, 0xDE, 0xDC, 0xDD, 0xD8,
+    0x16, 0x6F, 0xEE, 0x7D, 0x75, 0xB9, 0x79, 0x77, 0x7D, 0xB9, 0xA7, 0x9C, 0x4D, 0xE9, 0xD2, 0x26,
+    0x16, 0x33, 0xE0, 0x87, 0x86, 0x3F, 0xAE, 0xC6, 0x7B, 0xCF, 0xA3, 0x4C, 0xA6, 0x4D, 0xDC, 0x98,
+    0xBC, 0x65, 0xA0, 0xCC, 0xA8, 0x7A, 0x00, 0x94, 0x2B, 0xC1, 0x77, 0x9E, 0xFE, 0xF6, 0x74, 0x06,
+    0x27, 0x4E, 0xCE, 0x67, 0xCE, 0x90, 0x74, 0x92, 0xE4, 0x47, 0x1B, 0xBF, 0xB7, 0x5B, 0x24, 0x23,
+    0x8A, 0x45, 0x6B, 0x2C, 0x12, 0x47, 0xB1, 0x99, 0x6D, 0x39, 0x42, 0xDE, 0x9E, 0x81, 0xE6, 0x76,
+    0x84, 0x9C, 0x09, 0x34, 0xD1, 0xB8, 0x36, 0x2A, 0x0F, 0x91, 0x65, 0xA8, 0xB2, 0x98, 0x01, 0x53,
+    0x25, 0x34, 0x38, 0x0F, 0x54, 0xC3, 0xBF, 0x80, 0xE1, 0xDB, 0x4C, 0x86, 0x6F, 0x6F, 0xDC, 0xFE,
+    0xBA, 0x71, 0xA9, 0x94, 0xE9, 0x4B, 0x35, 0xEB, 0xB4, 0xD8, 0x93, 0xB6, 0x1E, 0xA8, 0xF2, 0xB2,
+    0xD3, 0x04, 0x94, 0xF5, 0x73, 0x5B, 0xDE, 0x6E, 0xCA, 0xC7, 0xA5, 0x1D, 0xF2, 0x48, 0xF9, 0x79,
+    0x29, 0xAF, 0xB6, 0xE5, 0xA9, 0xF8, 0x06, 0xAF, 0xF1, 0x45, 0x3B, 0xA8, 0xA9, 0x0D, 0x75, 0xC6,
+    0xE1, 0x0C, 0xDF, 0xE0, 0x35, 0x46, 0xFB, 0xD6, 0x5D, 0x4E, 0x4D, 0x2D, 0xAF, 0x31, 0x5A, 0xEE,
+    0xAC, 0x7A, 0xCD, 0xE7, 0xF9, 0x1E, 0xC3, 0x85, 0x3B, 0x0B, 0x84, 0x3A, 0xC3, 0x3E, 0xCF, 0xF7,
+    0x18, 0x98, 0x8F, 0xDF, 0xF5, 0xFE, 0xEF, 0x31, 0x30, 0x6B, 0xFE, 0xCF, 0xAB, 0xFE, 0x40, 0xD0,
+    0x0D, 0x78, 0x90, 0x73, 0x53, 0xD4, 0xC2, 0x51, 0x15, 0xC8, 0x29, 0xEA, 0x02, 0xAA, 0x84, 0x57,
+    0x60, 0xFC, 0x4D, 0x58, 0xDF, 0xC3, 0x16, 0x84, 0xA6, 0x66, 0x11, 0xB2, 0x65, 0x2C, 0x7C, 0xA6,
+    0x9D, 0x00, 0x8E, 0x68, 0x17, 0xFF, 0x72, 0x7A, 0x54, 0xF4, 0x90, 0x04, 0xBA, 0xBC, 0x8C, 0xA1,
+    0x11, 0x22, 0x15, 0x37, 0x1A, 0xE9, 0x0F, 0x78, 0x4C, 0xDB, 0x17, 0xBC, 0x6F, 0xEF, 0xD3, 0xA6,
+    0x09, 0x7A, 0x00, 0xCC, 0x00, 0xC1, 0x01, 0x82, 0x3D, 0xE4, 0xA2, 0x50, 0xD7, 0x25, 0x9A, 0x12,
+    0xCC, 0x32, 0x68, 0xEF, 0x47, 0xF9, 0x6E, 0x54, 0x11, 0x90, 0xC9, 0x90, 0xA3, 0x4C, 0x96, 0xF4,
+    0x32, 0x69, 0x32, 0xCA, 0xA4, 0xFA, 0x2E, 0xCA, 0x78, 0xCF, 0x02, 0x69, 0x97, 0x54, 0x46, 0x19,
+    0x51, 0x42, 0x2C, 0xC1, 0xFA, 0x12, 0xEE, 0xA6, 0x8D, 0x90, 0x44, 0x1B, 0xA1, 0x03, 0xDA, 0x08,
+    0x3D, 0xA2, 0x0D, 0xD0, 0x0E, 0x6D, 0x80, 0x19, 0xD0, 0x04, 0x1C, 0xFF, 0x94, 0xE1, 0x89, 0x1E,
+    0xD0, 0x04, 0x70, 0x82, 0x4C, 0xE0, 0x84, 0x2E, 0x2D, 0x79, 0xE3, 0xD0, 0x46, 0xEC, 0x1C, 0x94,
+    0xD7, 0x73, 0x65, 0x73, 0xAF, 0x67, 0x45, 0x4E, 0x7A, 0xD6, 0x64, 0xD0, 0xB3, 0x22, 0x93, 0x9E,
+    0xE5, 0x39, 0x99, 0xF5, 0x7C, 0x0F, 0x44, 0xD6, 0x1E, 0x4B, 0xDA, 0x64, 0x55, 0x34, 0x47, 0x1E,
+    0x30, 0x41, 0x79, 0xD4, 0x9C, 0x94, 0x47, 0xCB, 0xBE, 0xF3, 0x90, 0x09, 0x9D, 0x87, 0xF2, 0xE8,
+    0x3C, 0xD4, 0x88, 0x6E, 0x82, 0x72, 0xD8, 0xE9, 0x0F, 0x6B, 0xFD, 0x00, 0xA0, 0x9B, 0xA0, 0x46,
+    0xE8, 0x19, 0xC6, 0x43, 0x07, 0x98, 0x79, 0xC9, 0x2B, 0x0F, 0x3D, 0xA1, 0xDA, 0x96, 0x57, 0xCB,
+    0xF0, 0xBA, 0x45, 0x32, 0x1D, 0x5F, 0x7D, 0x97, 0x8B, 0x7C, 0x6D, 0x5D, 0xA1, 0x5F, 0x3D, 0x15,
+    0x34, 0x4C, 0x6E, 0x6C, 0x2D, 0x52, 0x01, 0x06, 0x2A, 0x2E, 0x1E, 0xBF, 0xD6, 0x15, 0x77, 0x29,
+    0xED, 0x8B, 0xFA, 0xA1, 0x29, 0x36, 0x15, 0xCC, 0xCD, 0x87, 0xE4, 0xFC, 0x94, 0x24, 0x5F, 0x77,
+    0x64, 0x7A, 0x4A, 0x92, 0x1F, 0x38, 0x32, 0xDF, 0x3D, 0xF3, 0xB6, 0x23, 0xE3, 0x53, 0x92, 0x7C,
+    0xCE, 0x91, 0xD3, 0x53, 0x92, 0x73, 0xE3, 0x02, 0xF0, 0x94, 0x1C, 0xF0, 0xD5, 0x33, 0x47, 0x40,
+    0x9C, 0x02, 0x2C, 0xB1, 0x58, 0x7C, 0x3C, 0x7B, 0x9D, 0x0C, 0x4A, 0x7F, 0x7E, 0xE6, 0x1A, 0x19,
+    0x94, 0x24, 0x3F, 0xF2, 0x66, 0x13, 0x71, 0x0C, 0x4F, 0x2E, 0x93, 0xFD, 0x62, 0x87, 0x54, 0x7C,
+    0x64, 0xFC, 0x09, 0x49, 0x8E, 0x41, 0x93, 0x67, 0x27, 0x92, 0xF2, 0x2C, 0x19, 0x4F, 0x48, 0xD2,
+    0x07, 0x4D, 0xEE, 0x1F, 0x39, 0x34, 0x05, 0x4D, 0x9E, 0xBC, 0x45, 0x46, 0x49, 0x72, 0xD4, 0x64,
+    0xC4, 0x7A, 0xFD, 0xD7, 0x00, 0xAA, 0xBD, 0x65, 0xA6, 0x10, 0x71, 0xC9, 0xD4, 0x01, 0xD5, 0xA8,
+    0x86, 0x3F, 0x57, 0xB7, 0x6E, 0xF1, 0xEC, 0x06, 0x01, 0x76, 0xC7, 0xF9, 0x49, 0x8F, 0x8E, 0x7D,
+    0xC1, 0x5F, 0xF8, 0x84, 0x87, 0xF2, 0x1C, 0xEA, 0xDC, 0x04, 0xD4, 0xEE, 0xCF, 0x16, 0x63, 0x99,
+    0x5E, 0x79, 0x1D, 0x74, 0xD0, 0x05, 0xD7, 0xBB, 0x73, 0x50, 0x79, 0xE5, 0x3B, 0x2F, 0xE7, 0x36,
+    0x34, 0x51, 0xC4, 0x2A, 0x61, 0xEF, 0xCB, 0xAF, 0x4B, 0xBF, 0xFB, 0xCF, 0x97, 0x59, 0x46, 0xFF,
+    0x2E, 0xFB, 0x0A, 0xC7, 0xFB, 0x43, 0xF7, 0x11, 0x11, 0x80, 0x1A, 0xF0, 0x4F, 0xEB, 0x70, 0xEC,
+    0x59, 0x5E, 0xBC, 0x18, 0x34, 0xC9, 0x7D, 0x92, 0xB1, 0x7A, 0x82, 0x7B, 0x05, 0x5B, 0xD3, 0x74,
+    0x90, 0x9F, 0x10, 0x35, 0x65, 0x80, 0x9A, 0xCC, 0x80, 0x3F, 0x15, 0xC3, 0x01, 0x5F, 0x8F, 0x6C,
+    0x27, 0xF5, 0x6E, 0x16, 0xD1, 0x4E, 0xE6, 0x6C, 0x94, 0x1E, 0x20, 0xA0, 0x46, 0x88, 0x08, 0x98,
+    0x01, 0xD2, 0xA3, 0xCA, 0xDB, 0x03, 0xB6, 0xDF, 0x1C, 0xD0, 0xEE, 0xE0, 0x80, 0xBA, 0x94, 0x1B,
+    0x6A, 0x67, 0x6F, 0x84, 0x96, 0xB6, 0xD7, 0x23, 0xB0, 0x8B, 0x9D, 0xBD, 0x4D, 0x18, 0x9A, 0x9B,
+    0x3D, 0xF0, 0x72, 0x4B, 0x32, 0x9F, 0x6B, 0x82, 0x5A, 0x3C, 0x23, 0x75, 0x5F, 0x5D, 0x24, 0xE9,
+    0x5E, 0x06, 0x70, 0x9A, 0x87, 0x7C, 0x58, 0x71, 0x3F, 0x80, 0x07, 0xB7, 0x8F, 0x36, 0xA0, 0x73,
+    0xED, 0x80, 0xDA, 0xFF, 0xF1, 0xF6, 0xD1, 0xDE, 0x0F, 0xE0, 0x0F, 0x50, 0x9F, 0x2F, 0x80, 0xC2,
+    0xBF, 0xD1, 0x2D, 0x8C, 0x7C, 0xC3, 0xCB, 0x1B, 0xB7, 0x03, 0xC8, 0x00, 0x59, 0x20, 0xD6, 0xBC,
+    0x71, 0xC7, 0x9C, 0x5A, 0xCE, 0x68, 0x49, 0xB4, 0xB7, 0xE9, 0x9B, 0x10, 0x89, 0x9F, 0x69, 0xD9,
+    0xDF, 0x23, 0x5D, 0x09, 0x64, 0xB7, 0x4C, 0xE4, 0x9B, 0xA0, 0x7C, 0x5D, 0x5A, 0xA0, 0xD8, 0x87,
+    0x3E, 0xFD, 0xA8, 0xEF, 0x5F, 0x5C, 0x47, 0x74, 0x28, 0x4B, 0x86, 0x60, 0x0F, 0x3C, 0xD4, 0xDF,
+    0x9D, 0x2E, 0xEE, 0x7A, 0xD3, 0x87, 0x01, 0x73, 0x89, 0x22, 0x4A, 0x2F, 0xB2, 0x0C, 0x7A, 0xE2,
+    0xD0, 0x79, 0x73, 0x89, 0x4D, 0x04, 0x45, 0x94, 0xB3, 0x1E, 0x9B, 0xD0, 0x4D, 0xE6, 0x99, 0x0C,
+    0xED, 0x28, 0xA2, 0xF4, 0x55, 0x6C, 0xE6, 0x6E, 0x34, 0xBD, 0x9C, 0xF4, 0x90, 0x45, 0xC0, 0x09,
+    0x44, 0xE1, 0xA5, 0x3B, 0xD0, 0x38, 0x2D, 0xD6, 0x2E, 0xC5, 0x78, 0x72, 0x31, 0x4C, 0x5B, 0xD4,
+    0x28, 0xF5, 0xF9, 0xCF, 0x27, 0xDC, 0xFB, 0x01, 0x60, 0xAF, 0x8D, 0x00, 0x64, 0xD0, 0x01, 0x1B,
+    0xB4, 0xB6, 0xE2, 0x7E, 0xD1, 0x24, 0xD5, 0x2F, 0x00, 0x38, 0x36, 0x7D, 0xFE, 0x5D, 0xBE, 0xB8,
+    0x1A, 0xD3, 0xC6, 0xE4, 0x72, 0xA7, 0xB7, 0x0E, 0x00, 0xCF, 0x16, 0x0D, 0xBB, 0xCC, 0xD8, 0x98,
+    0xB4, 0x40, 0xFB, 0x87, 0xFA, 0xBB, 0xF7, 0xF9, 0xE1, 0xCF, 0x32, 0xF5, 0x17, 0xD4, 0x6B, 0x71,
+    0x16, 0x5B, 0x42, 0x99, 0x2D, 0x9E, 0x13, 0x5F, 0x70, 0x83, 0xAA, 0x07, 0xB0, 0x83, 0xCF, 0xA9,
+    0xC6, 0xC3, 0x3D, 0x80, 0xFF, 0x09, 0x5B, 0xB0, 0xC6, 0xB8, 0xFB, 0x3F, 0xE3, 0x5E, 0xDD, 0xC4,
+    0x2B, 0x7C, 0x3E, 0x75, 0x7E, 0xE7, 0xD0, 0xD2, 0xB5, 0x51, 0x71, 0x16, 0xAD, 0xF2, 0xB8, 0x65,
+    0x60, 0x3F, 0x83, 0x46, 0xF0, 0x00, 0x50, 0x9F, 0x53, 0x1E, 0x82, 0x32, 0x2F, 0x81, 0x4C, 0x8C,
+    0xE7, 0x08, 0x19, 0xDB, 0x11, 0x55, 0xF8, 0xBC, 0xB6, 0x34, 0x61, 0xD3, 0xC7, 0xA5, 0xBF, 0xF5,
+    0xBC, 0xF5, 0x1D, 0xBA, 0x1F, 0x58, 0xD8, 0xBA, 0xC2, 0x04, 0x42, 0x0D, 0xCA, 0x75, 0x43, 0xC5,
+    0xC1, 0x82, 0xAE, 0x65, 0x1D, 0x1B, 0x42, 0xC5, 0xD6, 0x77, 0x11, 0x66, 0x54, 0x4E, 0x7B, 0x7C,
+    0x03, 0x16, 0xDF, 0xB8, 0xE3, 0xAA, 0xC2, 0xD9, 0x96, 0x01, 0x1B, 0xCB, 0xB0, 0xBD, 0x7E, 0xC4,
+    0xBD, 0x79, 0xC3, 0x04, 0x1F, 0xB9, 0x6A, 0x07, 0xCA, 0xED, 0xF4, 0x15, 0x7B, 0x0B, 0x0E, 0x47,
+    0x7F, 0xCB, 0x4E, 0xCA, 0x19, 0x8F, 0x57, 0x61, 0x61, 0xFB, 0x3B, 0x7F, 0x6B, 0x23, 0x2E, 0xED,
+    0xF3, 0xF9, 0xAC, 0x83, 0xD9, 0x8A, 0x36, 0x22, 0xE8, 0xC0, 0xF7, 0xF8, 0x5C, 0xDC, 0xA2, 0x21,
+    0xEA, 0x24, 0x4F, 0x65, 0x1D, 0xEC, 0xF8, 0xE7, 0xD8, 0xE9, 0xED, 0x3E, 0x9F, 0xCF, 0xCA, 0x3F,
+    0xD4, 0xA3, 0x7E, 0x5F, 0xCF, 0x7C, 0x8F, 0x3F, 0x8C, 0x55, 0x8F, 0x2A, 0xCB, 0xA4, 0x03, 0xDF,
+    0xCC, 0x40, 0x55, 0x8A, 0xE8, 0xF9, 0xE1, 0x9E, 0x7C, 0xFC, 0xAD, 0x82, 0x31, 0x09, 0xF7, 0x15,
+    0xF1, 0xAF, 0xD3, 0x63, 0x33, 0x36, 0x63, 0x33, 0x7D, 0x25, 0x1C, 0xCB, 0x66, 0x1D, 0x55, 0x90,
+    0xBE, 0x9D, 0x84, 0xFB, 0xB2, 0x57, 0x15, 0xFC, 0xAB, 0xEA, 0x85, 0x6B, 0x46, 0xE9, 0xBB, 0x59,
+    0x47, 0x9B, 0xBF, 0xFC, 0x95, 0xF5, 0xD0, 0x4E, 0x7F, 0xFA, 0x67, 0x3F, 0xFD, 0xA3, 0x47, 0x1E,
+    0x91, 0xFE, 0xCB, 0xFF, 0x66, 0xD5, 0x73, 0x78, 0x7C, 0xF8, 0x6D, 0x7A, 0x06, 0xC7, 0x21, 0x38,
+    0x49, 0x06, 0xC5, 0xA8, 0xAF, 0x64, 0x7D, 0x29, 0x1B, 0xC7, 0xF2, 0xAF, 0x1D, 0xF5, 0x25, 0xEA,
+    0x2B, 0xB9, 0x63, 0x94, 0x0C, 0x82, 0x13, 0x8E, 0xE3, 0x9F, 0xAB, 0xD7, 0x3D, 0xBE, 0xD1, 0xBD,
+    0xFE, 0x71, 0x34, 0x4B, 0xE2, 0xF7, 0x50, 0xF4, 0x23, 0x35, 0xFB, 0x8A, 0x23, 0x38, 0xE3, 0x95,
+    0x84, 0xA7, 0x4D, 0xAF, 0xBB, 0x51, 0x35, 0x73, 0xF7, 0x8B, 0xFC, 0x1D, 0xF2, 0x37, 0x64, 0x7A,
+    0xF2, 0xC2, 0x2D, 0x54, 0xA9, 0x88, 0x39, 0x85, 0xA3, 0x39, 0xCB, 0x2C, 0x3F, 0x7C, 0x41, 0x03,
+    0x01, 0x0D, 0xE7, 0x8E, 0xE1, 0x6B, 0x67, 0x66, 0x74, 0x13, 0xF4, 0xB9, 0x2A, 0xFF, 0x1F, 0x67,
+    0xAE, 0x91, 0xCF, 0x71, 0xC6, 0x1E, 0x50, 0xED, 0xC1, 0x46, 0xC1, 0x28, 0xF3, 0x5E, 0x37, 0x41,
+    0x3B, 0xE8, 0x9F, 0x78, 0xCD, 0x68, 0x7E, 0x9D, 0x75, 0x4F, 0xDD, 0x53, 0x0F, 0x54, 0xBF, 0xCE,
+    0x92, 0xB1, 0xA6, 0x2F, 0x92, 0xA7, 0x26, 0xCB, 0x3F, 0x90, 0x50, 0x47, 0x88, 0x19, 0xAD, 0x87,
+    0x9C, 0xA0, 0x1C, 0xF4, 0x00, 0x0B, 0x10, 0x75, 0xDA, 0xB8, 0x3F, 0xAD, 0xD0, 0xD0, 0x77, 0x8C,
+    0xEA, 0xE7, 0x49, 0x0D, 0x49, 0x5D, 0x8A, 0x92, 0x73, 0xE9, 0x15, 0xFD, 0x76, 0xF9, 0x09, 0xAB,
+    0xDF, 0xCC, 0x8A, 0xB1, 0xA5, 0xC7, 0xAA, 0x94, 0x1F, 0x3B, 0x06, 0xFD, 0x41, 0xD4, 0x43, 0x36,
+    0xBD, 0xD5, 0x03, 0xF5, 0x2F, 0xA8, 0xC8, 0x26, 0x66, 0x20, 0x41, 0xC4, 0x7F, 0x74, 0x26, 0x48,
+    0x7A, 0xC9, 0x61, 0x67, 0x0F, 0x95, 0x47, 0xD7, 0x57, 0x33, 0xBA, 0x9E, 0x24, 0x59, 0xCD, 0x9B,
+    0xDD, 0x25, 0x54, 0x80, 0x5F, 0xDC, 0x55, 0x8E, 0xAF, 0xFA, 0xAD, 0xE3, 0x0A, 0x80, 0xA7, 0xE5,
+    0x6B, 0xB3, 0x6E, 0xA6, 0x57, 0xDA, 0x31, 0x4A, 0x17, 0xA5, 0x4B, 0xED, 0xF8, 0xB4, 0xF0, 0xAA,
+    0x8F, 0xED, 0x78, 0x1C, 0xCD, 0xA4, 0xAB, 0x20, 0xDD, 0x2B, 0xCD, 0xA4, 0x85, 0x2F, 0xFF, 0x4F,
+    0xB7, 0x63, 0x94, 0xAF, 0xCD, 0x4F, 0xEF, 0xF4, 0x5F, 0x7F, 0xE0, 0xDC, 0x0F, 0x18, 0xCC, 0xED,
+    0x68, 0x86, 0x64, 0x90, 0x0D, 0x5E, 0xBD, 0xE3, 0xFF, 0x38, 0xF6, 0xBE, 0xEA, 0x83, 0x07, 0xA0,
+    0x9C, 0xF6, 0x26, 0x5A, 0x76, 0x57, 0x5F, 0x7B, 0xCE, 0x57, 0x11, 0x16, 0xCA, 0xB5, 0xBE, 0xDE,
+    0x64, 0x00, 0xAC, 0xD0, 0x72, 0xD2, 0x9C, 0xD5, 0xD5, 0x78, 0xAF, 0x88, 0x10, 0x11, 0x4D, 0x80,
+    0xF4, 0xD0, 0x23, 0xD8, 0x8B, 0x04, 0x39, 0x43, 0x33, 0x95, 0x7F, 0x1C, 0x94, 0x0F, 0xDD, 0x5F,
+    0xC5, 0x7B, 0xAA, 0x88, 0x3A, 0xE2, 0xF4, 0x5C, 0xD3, 0xD5, 0x9C, 0x71, 0x2C, 0x01, 0xF9, 0x3E,
+    0x64, 0x7D, 0x21, 0x69, 0x46, 0xC5, 0x09, 0x2B, 0xFC, 0xFF, 0x84, 0xF6, 0x7B, 0x46, 0x68, 0x95,
+    0x1D, 0x5B, 0x06, 0xF1, 0x97, 0x11, 0x48, 0xF8, 0x5E, 0x92, 0x4C, 0x7A, 0x4C, 0xBA, 0x4F, 0xFA,
+    0xD1, 0xA4, 0x99, 0x64, 0xFE, 0x66, 0xB5, 0x8B, 0x3A, 0xF7, 0x86, 0x67, 0x6F, 0x9A, 0x33, 0xC3,
+    0xD3, 0x79, 0x4D, 0x92, 0x1F, 0xAE, 0xCD, 0x00, 0xD3, 0xDF, 0x47, 0x8E, 0x96, 0x38, 0xDE, 0xD7,
+    0xB9, 0xEF, 0xE8, 0xF5, 0xFF, 0x16, 0x6C, 0x15, 0x13, 0x52, 0xF9, 0x7F, 0x15, 0xC9, 0x3C, 0x16,
+    0x15, 0xE7, 0x96, 0x23, 0xF6, 0xF0, 0x24, 0xD6, 0xD2, 0x9B, 0x3E, 0xE9, 0xA1, 0xBB, 0xEA, 0x6A,
+    0x3A, 0xE8, 0x09, 0x2A, 0x42, 0x72, 0x90, 0xEF, 0xCD, 0xAD, 0x37, 0x8D, 0x6F, 0x3D, 0x80, 0x63,
+    0xEC, 0x3B, 0xCE, 0x7F, 0xFC, 0x78, 0x04, 0x32, 0x60, 0x97, 0x87, 0x83, 0x57, 0xD5, 0x90, 0xB6,
+    0x84, 0x6C, 0x70, 0xE8, 0x5F, 0x8D, 0x86, 0xD1, 0x7C, 0x90, 0x4C, 0x7F, 0xF7, 0x81, 0x02, 0xC0,
+    0x00, 0x9D, 0x43, 0xE3, 0x51, 0x45, 0xC0, 0x60, 0xDD, 0x39, 0xDB, 0x78, 0x5B, 0x45, 0x0B, 0x63,
+    0xD1, 0xD1, 0x35, 0x0C, 0x55, 0xD2, 0xBD, 0x69, 0xE6, 0xCE, 0xD9, 0xC6, 0x4B, 0x0F, 0xC0, 0x1C,
+    0xFD, 0xE0, 0xCF, 0xD5, 0x68, 0x9F, 0xB9, 0xCD, 0xAB, 0x7C, 0x3D, 0xDB, 0x9B, 0xF6, 0x89, 0xD1,
+    0x0C, 0xD9, 0x20, 0xD5, 0x37, 0xA3, 0xF0, 0xED, 0x07, 0x5E, 0x3A, 0xF5, 0x13, 0xA7, 0xF1, 0xAA,
+    0x41, 0x3C, 0x74, 0x68, 0x00, 0x80, 0x3F, 0x57, 0xD3, 0xD3, 0x07, 0x15, 0x7C, 0xF5, 0xAE, 0x15,
+    0xFC, 0xBE, 0x1A, 0x9F, 0xE6, 0x6C, 0x3E, 0x8A, 0x47, 0x1B, 0x91, 0xCD, 0xB3, 0xD1, 0x30, 0x18,
+    0x3B, 0x99, 0x9D, 0x23, 0x8D, 0x3E, 0xC6, 0x67, 0x98, 0xF5, 0x5F, 0xEE, 0xCF, 0x50, 0x01, 0x36,
+    0xC0, 0x4E, 0xB0, 0x7F, 0xD2, 0x5C, 0x67, 0xD6, 0x1C, 0x8E, 0xF7, 0x00, 0x66, 0xFC, 0x00, 0xE6,
+    0xBF, 0x18, 0xFE, 0xD5, 0xAD, 0x73, 0x09, 0xBA, 0x97, 0xA3, 0x98, 0x91, 0xA0, 0x87, 0x96, 0x03,
+    0xA7, 0x8D, 0xB4, 0x6F, 0x33, 0xD0, 0x31, 0xA1, 0x22, 0x7D, 0x31, 0x5B, 0xB7, 0x7E, 0x67, 0xB1,
+    0x09, 0x0A, 0x00, 0xF4, 0xF8, 0xD0, 0xFA, 0x7F, 0xE7, 0xA3, 0xE4, 0xDB, 0xA9, 0x21, 0x4F, 0xCD,
+    0x1D, 0x93, 0x9E, 0x8C, 0x03, 0x2F, 0x11, 0x15, 0x3F, 0x4A, 0x2B, 0xC1, 0x62, 0x0A, 0x59, 0x5C,
+    0x00, 0x1D, 0x1E, 0x4C, 0xAB, 0xC5, 0x6B, 0xDF, 0x38, 0xA0, 0x62, 0x89, 0x8E, 0xDA, 0xA3, 0x2B,
+    0x0E, 0xC5, 0x33, 0xB0, 0x53, 0xF5, 0xC0, 0x37, 0x3B, 0xA0, 0xF2, 0x2F, 0x03, 0x67, 0x8A, 0x47,
+    0xD8, 0x2C, 0x16, 0xB1, 0x96, 0x82, 0x6C, 0x83, 0x4A, 0x2F, 0x9F, 0x00, 0xAF, 0x4C, 0x73, 0x43,
+    0x79, 0xD2, 0xA9, 0xF9, 0x91, 0x0E, 0x7C, 0xD3, 0xBF, 0x2C, 0xD8, 0xEE, 0x4F, 0x32, 0x9E, 0x90,
+    0xBD, 0xF6, 0xF3, 0x23, 0xB0, 0x57, 0x2E, 0xF9, 0x9A, 0x3F, 0x69, 0x5D, 0xC3, 0x97, 0x4F, 0x40,
+    0x72, 0x9A, 0xD1, 0xF1, 0xEC, 0xA5, 0x73, 0x7A, 0x51, 0xBC, 0xA7, 0x12, 0x4C, 0x46, 0x93, 0x3D,
+    0xE6, 0x1F, 0x00, 0xE2, 0x92, 0x07, 0xBA, 0x76, 0x23, 0x73, 0x9D, 0xE1, 0x39, 0x68, 0xD2, 0x75,
+    0x4B, 0x0B, 0x7A, 0x86, 0xEA, 0xA7, 0x45, 0x44, 0x18, 0x0A, 0x27, 0xDB, 0x94, 0xC8, 0xBE, 0xDF,
+    0xB8, 0xF7, 0x87, 0xA9, 0xB9, 0x1E, 0xE9, 0x8C, 0xBD, 0x1C, 0x1B, 0x46, 0x8E, 0xE6, 0xE6, 0x77,
+    0x52, 0x93, 0x61, 0x27, 0xE3, 0x1A, 0x36, 0x11, 0xDA, 0x1B, 0x27, 0xF8, 0x7A, 0x44, 0x97, 0xED,
+    0xA5, 0x7E, 0x63, 0x70, 0x3A, 0x48, 0x32, 0xA0, 0x63, 0x06, 0xAA, 0x5D, 0x08, 0x92, 0x4E, 0x2F,
+    0x61, 0x8E, 0xC6, 0x92, 0x59, 0xAD, 0xFA, 0xCF, 0x34, 0x3E, 0x39, 0x64, 0xA5, 0x52, 0x32, 0x87,
+    0xCA, 0x34, 0x4B, 0x64, 0x3C, 0x77, 0xCC, 0xDE, 0x7A, 0xF1, 0x2E, 0x97, 0x1F, 0x34, 0x50, 0x91,
+    0x43, 0x5B, 0xEC, 0xA0, 0x08, 0x15, 0xAB, 0x73, 0x35, 0xFB, 0x12, 0x50, 0xA1, 0x26, 0xB0, 0x63,
+    0x6E, 0xAE, 0x60, 0x49, 0xDF, 0x92, 0xC4, 0xE3, 0xFC, 0xF1, 0x2E, 0x94, 0x07, 0xFE, 0x82, 0x1F,
+    0x9E, 0x6F, 0x49, 0x96, 0x98, 0x32, 0xDB, 0x3B, 0xDB, 0xB1, 0x98, 0xAD, 0xB5, 0x24, 0x93, 0x25,
+    0xF9, 0xCE, 0x26, 0x73, 0xD8, 0xAA, 0x6E, 0x11, 0xE6, 0xEA, 0x85, 0x6B, 0x8E, 0x00, 0xF0, 0xB5,
+    0xDE, 0x7E, 0x1F, 0xEA, 0x97, 0xCC, 0xBA, 0xC4, 0x5C, 0x22, 0xF9, 0x5A, 0xE1, 0x5D, 0x67, 0xCB,
+    0x8B, 0xCC, 0x67, 0xA8, 0x32, 0x18, 0x6B, 0xBE, 0x41, 0x74, 0x09, 0xFA, 0x1A, 0x87, 0x86, 0x90,
+    0xD1, 0x4E, 0xA0, 0x13, 0x54, 0x33, 0xB4, 0x07, 0xDF, 0x48, 0xE8, 0x22, 0xF4, 0x35, 0xF6, 0x2D,
+    0x21, 0xA3, 0x1D, 0x45, 0x39, 0x59, 0xB3, 0x9C, 0x64, 0x39, 0x69, 0xCB, 0x49, 0x5D, 0x4E, 0xAA,
+    0x72, 0x52, 0x5E, 0x8D, 0xD0, 0x1E, 0x8D, 0x5F, 0x4C, 0x99, 0x16, 0x0B, 0xD2, 0x52, 0xC7, 0x97,
+    0x36, 0x11, 0xDA, 0xD4, 0xA0, 0x22, 0x08, 0xEB, 0x45, 0xAC, 0x39, 0x49, 0xDF, 0xD2, 0x69, 0xA7,
+    0x2C, 0x88, 0x57, 0x5F, 0x11, 0xB1, 0x4E, 0x51, 0xFA, 0x33, 0xB7, 0x6F, 0xD9, 0x5F, 0x73, 0x41,
+    0xBD, 0xF8, 0x6C, 0x34, 0xD2, 0xB7, 0x3E, 0xE9, 0x4B, 0xF6, 0xA3, 0xCC, 0x0B, 0x24, 0x79, 0x91,
+    0x64, 0x6E, 0xBD, 0x3A, 0xE3, 0x94, 0x7B, 0xDA, 0xC2, 0x22, 0xC7, 0x3A, 0x0A, 0xFA, 0xD6, 0xB7,
+    0x74, 0xCA, 0x49, 0xC2, 0x42, 0xC7, 0x3A, 0xC2, 0x7A, 0xC3, 0x17, 0x0E, 0xA2, 0xC8, 0x36, 0x64,
+    0x2E, 0x98, 0x79, 0x02, 0x60, 0x7E, 0x65, 0x23, 0x50, 0xB1, 0xD7, 0x33, 0xD0, 0x24, 0xD8, 0xF1,
+    0x21, 0x74, 0x73, 0xC5, 0x21, 0xC2, 0x8C, 0x4D, 0x6A, 0x7D, 0xC5, 0x5E, 0xCD, 0xDA, 0x35, 0xA9,
+    0xE2, 0x6B, 0x64, 0x77, 0xCB, 0x66, 0xC3, 0x64, 0xC8, 0xEB, 0xE4, 0x27, 0x24, 0xFF, 0x07, 0x7E,
+    0xF8, 0x1C, 0x39, 0xD5, 0x44, 0x77, 0xEB, 0x47, 0x68, 0x23, 0xCC, 0x08, 0x28, 0x5F, 0x15, 0x6C,
+    0xAE, 0x29, 0x21, 0xEF, 0xBB, 0x19, 0x68, 0xCA, 0xA9, 0x2E, 0xFD, 0x6B, 0xF6, 0x80, 0xE6, 0xDB,
+    0x09, 0x80, 0xE5, 0x13, 0x33, 0x00, 0x5B, 0x84, 0xBA, 0x1D, 0x18, 0x9E, 0x5F, 0x0C, 0x30, 0x96,
+    0x8D, 0x2B, 0x9B, 0x09, 0x80, 0x7D, 0xAB, 0x84, 0x28, 0x74, 0xDA, 0xE3, 0xFB, 0xBD, 0x75, 0x6A,
+    0x96, 0x0C, 0xD6, 0x75, 0xB3, 0x66, 0xB4, 0x4E, 0x79, 0xCB, 0x60, 0x9D, 0xF6, 0xBC, 0xF4, 0x9F,
+    0xEC, 0x9B, 0x9C, 0xD8, 0xC3, 0x92, 0x8E, 0x0E, 0x96, 0x04, 0x67, 0x58, 0x46, 0x18, 0xC2, 0x32,
+    0xA1, 0xE3, 0x64, 0xF7, 0x09, 0xC1, 0x60, 0x5F, 0x63, 0x0F, 0x13, 0x8B, 0x71, 0x6B, 0xB2, 0x8E,
+    0x0E, 0x22, 0x59, 0x67, 0xA6, 0x5E, 0x24, 0xEB, 0xB4, 0xBF, 0xF9, 0x60, 0xB4, 0x4E, 0x05, 0x32,
+    0x5A, 0x27, 0x23, 0xE9, 0xAD, 0x6B, 0xB3, 0x2D, 0xC6, 0x44, 0xD5, 0x2E, 0xF4, 0x20, 0x67, 0x64,
+    0xE9, 0x45, 0x86, 0x3E, 0x1B, 0x2B, 0xBA, 0x6E, 0x22, 0x8C, 0x6F, 0x66, 0xE5, 0x54, 0xAC, 0x63,
+    0x3B, 0xB7, 0x57, 0x7B, 0x56, 0x49, 0xDC, 0x18, 0xB5, 0xD3, 0x43, 0x0A, 0x72, 0x92, 0xD3, 0x09,
+    0x2D, 0x82, 0x88, 0xDD, 0xF3, 0x97, 0x12, 0xD8, 0xBE, 0x37, 0xDB, 0xC7, 0x4A, 0x4C, 0xBF, 0x62,
+    0x5B, 0xF2, 0xAD, 0x6C, 0x4E, 0xDF, 0x48, 0xBD, 0x3E, 0x75, 0x29, 0x66, 0xC8, 0x0F, 0xBC, 0xD6,
+    0x7D, 0x7D, 0x2B, 0xC8, 0x77, 0x47, 0xD8, 0x57, 0xC4, 0x6D, 0x8F, 0x8E, 0xBD, 0x8D, 0x10, 0x74,
+    0x2A, 0x03, 0xF4, 0x0D, 0x07, 0xE8, 0x00, 0x8E, 0xDB, 0x08, 0x19, 0xBD, 0x8C, 0xD0, 0xE4, 0x39,
+    0x74, 0xEF, 0x15, 0xBF, 0x2A, 0x4D, 0xD2, 0xA9, 0xEB, 0x25, 0x12, 0x84, 0x76, 0x30, 0x5E, 0x5D,
+    0x8F, 0xA8, 0xF8, 0x18, 0xB5, 0x5B, 0xCB, 0xA0, 0xAE, 0xC7, 0xCE, 0xDB, 0xD7, 0xA8, 0x2F, 0xB1,
+    0x89, 0xEA, 0x7A, 0xEC, 0xBC, 0xF9, 0x8A, 0x3B, 0xEF, 0xC5, 0xCE, 0x9B, 0xFD, 0xAC, 0x2F, 0x11,
+    0x30, 0x57, 0x62, 0xE7, 0x21, 0xA3, 0xBE, 0xC4, 0xF5, 0x45, 0x9E, 0x8D, 0x1D, 0x49, 0xAF, 0x2F,
+    0x91, 0x0C, 0x22, 0x76, 0x8B, 0x6A, 0xE6, 0x78, 0x8F, 0x83, 0x48, 0xEC, 0x38, 0x76, 0x81, 0xFF,
+    0x19, 0x35, 0xC9, 0xE5, 0x71, 0x3F, 0x70, 0x81, 0xE7, 0x8B, 0xBD, 0xE6, 0xCE, 0xAE, 0x99, 0xA0,
+    0xD9, 0x05, 0x98, 0xE2, 0xBA, 0x43, 0x0E, 0x8A, 0x17, 0x38, 0x49, 0xC2, 0x04, 0xC1, 0xA1, 0xCD,
+    0x55, 0xB1, 0x05, 0xF7, 0xD0, 0x53, 0x17, 0x21, 0x43, 0x43, 0x88, 0x5C, 0x71, 0xAC, 0x38, 0xE8,
+    0x00, 0x3B, 0x49, 0xF6, 0x26, 0xD4, 0xCC, 0x5C, 0x2E, 0x17, 0xCC, 0x7A, 0x82, 0x4A, 0x6D, 0x00,
+    0x76, 0xEF, 0xB0, 0x88, 0x24, 0xA7, 0xE2, 0x36, 0xBA, 0xB3, 0x5A, 0xED, 0x01, 0x38, 0x93, 0x01,
+    0x53, 0x62, 0xF4, 0x8E, 0x2D, 0x19, 0x2B, 0xBE, 0xDF, 0xF4, 0xC5, 0xF5, 0x6C, 0x99, 0xA2, 0x9E,
+    0xC8, 0xAB, 0x5D, 0x49, 0x66, 0x90, 0x9C, 0x76, 0xF8, 0xD6, 0x0A, 0x32, 0x02, 0xF7, 0xF2, 0xC3,
+    0x17, 0xB0, 0x9D, 0x94, 0xDB, 0xB4, 0xB5, 0x53, 0xEC, 0x01, 0x95, 0xF1, 0x5F, 0x83, 0xA4, 0x13,
+    0x8B, 0xF7, 0x96, 0x2B, 0xA0, 0x66, 0xB5, 0x5B, 0x82, 0x86, 0xB4, 0xA9, 0x58, 0x32, 0x9B, 0xA9,
+    0x4D, 0xA0, 0x6B, 0x53, 0xCD, 0xBE, 0x4D, 0x22, 0xA3, 0x4D, 0x32, 0x96, 0x20, 0x4F, 0x6D, 0xD2,
+    0x1E, 0x6D, 0xB2, 0x0E, 0x5D, 0xE6, 0x5B, 0xBD, 0x25, 0x39, 0x1D, 0x24, 0x2D, 0xCD, 0x84, 0x36,
+    0x29, 0xBF, 0xB9, 0xA2, 0x4D, 0x68, 0x93, 0x20, 0xDA, 0x54, 0x73, 0x58, 0x6E, 0x0A, 0x3B, 0x6D,
+    0x7E, 0x48, 0x45, 0xC3, 0x32, 0x8E, 0xF9, 0x36, 0x49, 0x3E, 0x41, 0x32, 0x1D, 0x7F, 0x9C, 0xAB,
+    0xDD, 0xC5, 0x54, 0xF7, 0xE3, 0x09, 0xE0, 0x55, 0x57, 0x00, 0x4A, 0xB9, 0x71, 0xBA, 0x2B, 0xEF,
+    0xA8, 0xE0, 0x1F, 0xA3, 0x25, 0x23, 0xB4, 0xA1, 0xC3, 0x9F, 0x70, 0xD3, 0x35, 0x2A, 0x2E, 0xB1,
+    0x56, 0x2D, 0x1D, 0xEA, 0x1B, 0x04, 0xEA, 0xA3, 0x66, 0xBF, 0x07, 0xEE, 0x2C, 0xEF, 0x6F, 0x42,
+    0x1B, 0x8D, 0xCB, 0x23, 0xC8, 0x1B, 0x6D, 0xDE, 0x04, 0x40, 0x9C, 0xDB, 0x4C, 0x0C, 0x10, 0x2C,
+    0xF1, 0x52, 0xFA, 0xB2, 0xE8, 0x58, 0x57, 0x02, 0x91, 0x68, 0x5F, 0x7C, 0xF0, 0x65, 0x28, 0x41,
+    0x28, 0x9A, 0x54, 0xAA, 0x5D, 0xB3, 0x5F, 0x42, 0x7D, 0xBA, 0x8A, 0xC3, 0x4E, 0x5F, 0xC2, 0x53,
+    0x2A, 0xF6, 0x32, 0x40, 0x7B, 0xCD, 0xD0, 0x24, 0x74, 0x51, 0xDF, 0x66, 0x4D, 0xC8, 0xDC, 0x79,
+    0x35, 0xD2, 0xB5, 0x94, 0xB3, 0x08, 0xDA, 0xB7, 0x3C, 0x19, 0x91, 0x65, 0x50, 0x7C, 0x86, 0x30,
+    0xDF, 0x26, 0xE9, 0xAC, 0xD3, 0xAF, 0x91, 0x1C, 0x74, 0xB6, 0x13, 0xC9, 0x5E, 0x92, 0x5E, 0xF3,
+    0x7D, 0x88, 0x5C, 0xC2, 0x63, 0x54, 0xDC, 0x39, 0x12, 0x10, 0x63, 0x89, 0x78, 0x86, 0xAD, 0x49,
+    0xC6, 0xC2, 0xCF, 0x17, 0x6D, 0xDB, 0xDD, 0x0A, 0x6E, 0xC2, 0x31, 0xC8, 0x62, 0xDB, 0x17, 0xD0,
+    0xD0, 0x7A, 0xA8, 0x59, 0x3B, 0xD0, 0xB1, 0x17, 0x14, 0x09, 0x6D, 0x94, 0x1E, 0x6A, 0x36, 0x0E,
+    0xE6, 0x1A, 0x01, 0xBE, 0x3B, 0x17, 0xB6, 0x47, 0x30, 0x01, 0x2D, 0x17, 0x5F, 0xCC, 0x7F, 0xD3,
+    0x45, 0x88, 0xD1, 0x04, 0x74, 0xFB, 0xF4, 0xE0, 0x19, 0x4E, 0x2D, 0x33, 0x9D, 0xE6, 0x7B, 0x7C,
+    0x2C, 0xB1, 0xC9, 0xF2, 0xB5, 0x59, 0xC6, 0x57, 0x85, 0xD3, 0x1E, 0xF7, 0xC0, 0x8E, 0x4B, 0x28,
+    0xB9, 0x26, 0x2D, 0x88, 0x92, 0xA6, 0x2B, 0xC6, 0x95, 0x82, 0x1E, 0x90, 0x37, 0xD1, 0xF2, 0xD6,
+    0xF2, 0x0A, 0x85, 0x4D, 0xAC, 0x1E, 0x27, 0xA3, 0xE0, 0x33, 0xF6, 0xD6, 0x05, 0xFE, 0xA4, 0x2C,
+    0x4F, 0x1F, 0xDA, 0x5C, 0x14, 0xED, 0xBE, 0xE6, 0xA9, 0xAD, 0xB9, 0x51, 0x97, 0xBE, 0xCB, 0x73,
+    0xDA, 0x77, 0x69, 0x7B, 0x21, 0x24, 0x39, 0x41, 0xDF, 0xFA, 0xD1, 0x17, 0x19, 0x84, 0x57, 0x3D,
+    0x50, 0xD0, 0xB0, 0x63, 0xCC, 0x8B, 0xCF, 0x91, 0xDE, 0xC4, 0x12, 0x1D, 0x34, 0xF3, 0x83, 0x4E,
+    0xB1, 0x1B, 0x20, 0xD9, 0x4C, 0x68, 0x58, 0x05, 0xD4, 0x74, 0x4F, 0x03, 0x1C, 0xBB, 0x01, 0x7A,
+    0x6E, 0x7E, 0xB5, 0x92, 0xB1, 0x22, 0xAF, 0x10, 0x86, 0x33, 0x5D, 0xC7, 0xA4, 0xE7, 0x86, 0x3C,
+    0x95, 0xAB, 0x60, 0x7E, 0x4E, 0xF7, 0x74, 0x37, 0x9B, 0xB9, 0x7B, 0x2E, 0x49, 0x36, 0xBF, 0xE4,
+    0xA3, 0xFC, 0x24, 0xD8, 0x51, 0x6D, 0xCC, 0x29, 0x13, 0x14, 0xCB, 0x3B, 0x59, 0x72, 0x0F, 0xBC,
+    0x0A, 0x00, 0xDD, 0x00, 0xE0, 0xD8, 0xB9, 0xAD, 0x57, 0x40, 0x47, 0x6C, 0xA2, 0xD2, 0xEA, 0x02,
+    0x29, 0x46, 0x00, 0xD6, 0x8E, 0x80, 0xFC, 0x4D, 0x06, 0x2A, 0x76, 0x1E, 0xD0, 0x7E, 0x09, 0x7E,
+    0x51, 0x66, 0xF6, 0x5F, 0x5C, 0xCC, 0x17, 0xF8, 0x22, 0x38, 0xE8, 0x09, 0xDD, 0x5C, 0xB3, 0xD8,
+    0x18, 0xBE, 0x43, 0x92, 0xE9, 0x74, 0x5E, 0x3D, 0x91, 0x7B, 0x3A, 0x98, 0x51, 0x46, 0x08, 0x56,
+    0xEC, 0x4B, 0x98, 0x8D, 0x8A, 0x27, 0x89, 0xE2, 0x59, 0x57, 0xE2, 0x08, 0x2F, 0xE1, 0x77, 0x2A,
+    0xBB, 0xAC, 0x6E, 0xF5, 0x32, 0x97, 0x70, 0x90, 0x7F, 0xD3, 0x1E, 0x75, 0xB5, 0xE5, 0xA5, 0xF5,
+    0xFA, 0x02, 0xFF, 0x6A, 0xCB, 0x28, 0x40, 0x15, 0x0B, 0xE3, 0xFE, 0x98, 0xE5, 0xAD, 0xF5, 0x19,
+    0x92, 0xD9, 0x92, 0x0C, 0x25, 0xF8, 0xD8, 0xB0, 0x79, 0x1C, 0x19, 0x8D, 0x53, 0x4B, 0x57, 0x47,
+    0x98, 0x12, 0xB9, 0x24, 0x2D, 0x1A, 0x8D, 0xF2, 0x60, 0x9A, 0x09, 0xA8, 0x6C, 0xEE, 0x21, 0xCB,
+    0xCB, 0x8D, 0x18, 0xAA, 0xD2, 0x7B, 0x1F, 0x7D, 0xE0, 0x5B, 0x7E, 0x7B, 0xBA, 0x4F, 0xE6, 0x66,
+    0x42, 0x17, 0x9B, 0x09, 0x2A, 0x34, 0x13, 0xF4, 0xBC, 0x4D, 0xFC, 0xD1, 0x64, 0x6E, 0x26, 0xE8,
+    0xD0, 0x4C, 0x50, 0x71, 0x73, 0xC5, 0xF2, 0x48, 0xDF, 0xFE, 0xE5, 0x4F, 0x05, 0x17, 0x6E, 0xD2,
+    0x97, 0xD8, 0x57, 0xC7, 0xC8, 0x73, 0x4B, 0x7C, 0xF2, 0x66, 0xDA, 0x3E, 0x91, 0xC2, 0x5C, 0x59,
+    0xA0, 0xF5, 0x22, 0x02, 0xDA, 0x75, 0x1E, 0x15, 0x7B, 0xEB, 0x0A, 0x8E, 0xB9, 0x4F, 0x92, 0x94,
+    0x24, 0x19, 0xFF, 0x19, 0xD7, 0xFC, 0xF0, 0xBC, 0x8C, 0x25, 0x8C, 0x72, 0x89, 0x2F, 0xA1, 0x3D,
+    0x04, 0x4B, 0x9C, 0x89, 0x2F, 0x73, 0x38, 0xBF, 0x2C, 0x08, 0x4B, 0x2F, 0x23, 0x48, 0xA7, 0xFD,
+    0x12, 0x87, 0xE6, 0xF8, 0xA1, 0x39, 0x2D, 0xF7, 0x40, 0x5B, 0xDE, 0xD7, 0x42, 0x06, 0x94, 0x2E,
+    0x04, 0x7D, 0x33, 0x6D, 0x26, 0xBF, 0x23, 0xA9, 0xC7, 0x36, 0x9A, 0x4D, 0x89, 0xB5, 0x23, 0x97,
+    0x37, 0x19, 0x15, 0x17, 0xA5, 0xE5, 0xDD, 0x10, 0x25, 0x66, 0x7E, 0xBC, 0xF7, 0xB1, 0x17, 0x9E,
+    0x94, 0x51, 0x5F, 0xCD, 0x7C, 0x3D, 0xFE, 0xFB, 0x64, 0x7E, 0xF8, 0x7A, 0xFC, 0xEF, 0x66, 0x25,
+    0xDE, 0x0E, 0x6A, 0x56, 0xE2, 0xEA, 0xDC, 0xD2, 0x36, 0x9C, 0xAA, 0x12, 0x5B, 0xE4, 0x16, 0x19,
+    0x80, 0x59, 0x3D, 0x3E, 0x02, 0xB3, 0x12, 0x23, 0x70, 0xFE, 0x6B, 0xF5, 0x00, 0x7D, 0x97, 0xD9,
+    0x7E, 0xB5, 0x5A, 0x1D, 0xAC, 0x85, 0xDD, 0x26, 0xB6, 0xC1, 0x41, 0xA9, 0xFE, 0xFF, 0x41, 0x90,
+    0x75, 0x07, 0xBB, 0xB8, 0x5A, 0xAC, 0x79, 0xEB, 0xC5, 0xC5, 0xB1, 0x0D, 0xAB, 0xD3, 0x79, 0x6F,
+    0xE3, 0x82, 0xB1, 0x18, 0xFE, 0x00, 0x26, 0x2C, 0x6E, 0x14, 0x03, 0x18, 0x4A, 0x0C, 0x24, 0x15,
+    0x8A, 0x3A, 0xBD, 0x65, 0x91, 0x95, 0xCA, 0x3B, 0xAA, 0x36, 0x4E, 0x72, 0xB1, 0xBC, 0x18, 0x80,
+    0x9B, 0xB0, 0x54, 0xC5, 0xC3, 0xFC, 0xE7, 0x33, 0x6A, 0x72, 0x44, 0xCB, 0x8C, 0x8A, 0xB9, 0x2F,
+    0xAE, 0x46, 0xE4, 0x77, 0xC6, 0xFA, 0x3B, 0xC5, 0x81, 0x31, 0x14, 0x57, 0x75, 0xB2, 0xBF, 0xF7,
+    0x3F, 0x32, 0xC1, 0xFC, 0x9F, 0x6A, 0xAE, 0x08, 0x3B, 0xB6, 0xB1, 0x66, 0xAF, 0xA7, 0x36, 0x55,
+    0xEC, 0xD5, 0x2C, 0x23, 0xEC, 0x9B, 0xC5, 0xEB, 0x13, 0x6D, 0x21, 0xC2, 0xBC, 0xF8, 0xAD, 0x1E,
+    0x3F, 0xA4, 0x14, 0x08, 0x00, 0x50, 0xDF, 0x2A, 0xF1, 0x2B, 0xEA, 0x19, 0x00, 0x7E, 0x26, 0x3C,
+    0x80, 0xBA, 0xA8, 0x6D, 0xDA, 0x5B, 0x76, 0xBD, 0xFE, 0xEB, 0x25, 0x8E, 0xF3, 0xA0, 0xC9, 0x45,
+    0x38, 0x23, 0x39, 0x3C, 0xB8, 0x60, 0x2A, 0x11, 0xA8, 0x12, 0x84, 0xBF, 0x07, 0x98, 0x21, 0x2F,
+    0xCD, 0xFF, 0x4E, 0x8C, 0xD0, 0xEA, 0x76, 0x90, 0x00, 0x6F, 0x33, 0x45, 0x08, 0x36, 0xBF, 0xE1,
+    0x08, 0xE9, 0x9B, 0xEA, 0x67, 0x1B, 0xCA, 0xE9, 0xCA, 0xE6, 0x29, 0xFB, 0x7E, 0x75, 0xAE, 0xAC,
+    0x9D, 0x03, 0x50, 0x2D, 0x2B, 0xE8, 0xC2, 0x69, 0x99, 0xB2, 0xAE, 0x16, 0x20, 0x7D, 0x09, 0x88,
+    0xB6, 0x84, 0x9E, 0x5A, 0xE2, 0x70, 0x5B, 0x77, 0x28, 0xFC, 0xF2, 0x72, 0xCA, 0xCC, 0x65, 0x8A,
+    0x29, 0x1E, 0x44, 0x65, 0x31, 0x22, 0x19, 0x4A, 0x20, 0xE5, 0x20, 0x38, 0x5A, 0x67, 0x7D, 0x17,
+    0x6B, 0xC2, 0x4E, 0xD6, 0xB5, 0x11, 0xDC, 0x2F, 0x6F, 0xEE, 0x92, 0x01, 0xD6, 0x35, 0x49, 0x4F,
+    0x35, 0xD1, 0x7D, 0xC2, 0xBE, 0x8D, 0x30, 0x6F, 0x27, 0xEC, 0xEC, 0x56, 0x85, 0xCD, 0x6F, 0x92,
+    0x19, 0x01, 0x74, 0x9F, 0xB0, 0x07, 0x60, 0xDE, 0x4E, 0x00, 0xB6, 0xA7, 0x04, 0xF9, 0x42, 0x11,
+    0x47, 0xC5, 0x66, 0xC1, 0x98, 0x05, 0x57, 0x36, 0x0A, 0x96, 0x17, 0x19, 0xC9, 0xC2, 0xC7, 0x6C,
+    0x72, 0x2A, 0xFE, 0x05, 0xD7, 0x0C, 0x96, 0x4B, 0x64, 0xDD, 0xD1, 0x92, 0x19, 0x7F, 0xC1, 0xF5,
+    0xEE, 0xA1, 0x90, 0xE9, 0x96, 0x85, 0x04, 0x97, 0xE4, 0x71, 0xAE, 0xFA, 0x3B, 0xA3, 0xAA, 0x03,
+    0x5F, 0xFF, 0x06, 0x00, 0x7C, 0xF3, 0x04, 0x00, 0x3C, 0xFD, 0x2A, 0xB6, 0xF6, 0xF3, 0x8B, 0x41,
+    0x3D, 0x39, 0x08, 0x26, 0xCD, 0xB1, 0xE5, 0x0F, 0x4E, 0x58, 0x2F, 0xE3, 0x37, 0x4F, 0xE8, 0xA0,
+    0xC2, 0x37, 0x4F, 0x74, 0x51, 0xCF, 0xDF, 0x3C, 0x21, 0xA3, 0xF6, 0xDF, 0x3C, 0x21, 0x93, 0xF6,
+    0xDF, 0x3C, 0xD1, 0x96, 0x34, 0x6B, 0x7F, 0xFF, 0xFD, 0xD5, 0x5E, 0xE1, 0x55, 0x4A, 0x1C, 0xEE,
+    0x25, 0xEA, 0x5C, 0x3C, 0x88, 0x3A, 0x57, 0x97, 0x07, 0x68, 0x6E, 0x02, 0x38, 0xC6, 0x6D, 0x38,
+    0xCB, 0x23, 0x29, 0x00, 0xB4, 0x67, 0x1D, 0x1E, 0x96, 0xC0, 0xCF, 0x1E, 0x41, 0x59, 0xA3, 0xA2,
+    0x2C, 0xF6, 0xD0, 0x91, 0xBF, 0xE0, 0x75, 0x82, 0xEF, 0x46, 0x41, 0xE3, 0x65, 0xA2, 0xD3, 0xD7,
+    0xF9, 0x38, 0x9F, 0x2F, 0xCA, 0x65, 0x47, 0xF2, 0x0A, 0x2F, 0xF0, 0x72, 0x14, 0xB4, 0xBE, 0x29,
+    0xF0, 0x03, 0x0C, 0x63, 0x4D, 0x7A, 0x95, 0x17, 0xDD, 0xCE, 0xF3, 0xE4, 0xAC, 0x99, 0x51, 0x4F,
+    0x7E, 0xFB, 0x43, 0xF7, 0xDD, 0x5F, 0x3C, 0x9F, 0xCD, 0xF6, 0x25, 0x0F, 0x73, 0xC7, 0x0B, 0x5E,
+    0x47, 0xDC, 0xB7, 0x79, 0xC1, 0x83, 0x9D, 0x8E, 0x7E, 0xCD, 0xF2, 0x92, 0x07, 0x9D, 0xF0, 0xF5,
+    0x8E, 0x57, 0x43, 0x4B, 0x86, 0x9A, 0x0C, 0x38, 0xC3, 0xE9, 0x90, 0xCB, 0xE7, 0x9E, 0x29, 0xB6,
+    0x3A, 0xD1, 0x90, 0xF1, 0xA1, 0xF5, 0x7A, 0xFD, 0xC4, 0xF2, 0x6E, 0x87, 0x9B, 0x1B, 0xD6, 0x0F,
+    0xA8, 0x56, 0x3D, 0x56, 0x3D, 0x3A, 0xFA, 0x96, 0x11, 0x96, 0x5E, 0x31, 0x82, 0x9C, 0x0C, 0xE7,
+    0x8A, 0xBF, 0x3E, 0x67, 0x6F, 0xFE, 0xB4, 0xE6, 0x50, 0x5E, 0x64, 0xD6, 0xC3, 0xBA, 0xF2, 0x92,
+    0xA3, 0x11, 0x1D, 0xF9, 0x5C, 0x79, 0x3D, 0xDF, 0x4F, 0x0E, 0x36, 0xFF, 0x8C, 0xEB, 0xEF, 0xF1,
+    0xC3, 0x73, 0x87, 0x4A, 0xFE, 0x8E, 0x36, 0xA8, 0x56, 0xFD, 0xFD, 0x68, 0x18, 0x8D, 0x6B, 0x49,
+    0x1D, 0x04, 0xF9, 0x7C, 0xAE, 0xF8, 0xEB, 0xFF, 0x40, 0xD8, 0x09, 0x5F, 0x2B, 0x34, 0xD0, 0xA6,
+    0x32, 0xBF, 0x3E, 0xCB, 0x27, 0xC8, 0xC9, 0xBE, 0x4D, 0x06, 0x35, 0x5F, 0xCC, 0x2F, 0xB5, 0xA9,
+    0x66, 0x5F, 0xB3, 0xB7, 0x23, 0xEC, 0xA8, 0x66, 0xA8, 0xB9, 0x4D, 0xF8, 0x2D, 0x0F, 0xA2, 0x5A,
+    0xF5, 0x2B, 0x34, 0x8C, 0x76, 0x6C, 0x49, 0x35, 0x0B, 0xF2, 0x87, 0xA9, 0xE2, 0xAF, 0xFF, 0x03,
+    0x7B, 0x3B, 0x1D, 0xB9, 0xE8, 0xEF, 0xA1, 0x22, 0x58, 0xF5, 0x3B, 0xA8, 0x48, 0x58, 0xBE, 0xB1,
+    0x79, 0x94, 0x1C, 0x25, 0x73, 0x43, 0x9E, 0x4A, 0xCB, 0xD3, 0xB4, 0x4E, 0x05, 0xB4, 0x09, 0xD5,
+    0xE6, 0x31, 0x01, 0x6A, 0x5E, 0x5C, 0xB1, 0xCB, 0x33, 0xE5, 0xEB, 0xE4, 0x4D, 0x32, 0xCB, 0xB8,
+    0x3C, 0x56, 0xBE, 0x66, 0x6F, 0xFD, 0xF5, 0xC5, 0xFC, 0x52, 0x31, 0x17, 0xB5, 0x0E, 0x74, 0x25,
+    0x44, 0xCE, 0xDF, 0xD7, 0x81, 0xA5, 0x71, 0xAB, 0xBE, 0x34, 0xEE, 0x72, 0x3A, 0xDC, 0x38, 0x41,
+    0x3E, 0xBF, 0x69, 0x1C, 0x47, 0x15, 0xD0, 0x66, 0xC8, 0x54, 0xB3, 0x2F, 0x2F, 0x9F, 0x53, 0x33,
+    0xDA, 0x04, 0x99, 0x36, 0x8D, 0x7B, 0x7B, 0x69, 0x5C, 0xDA, 0x34, 0xEE, 0xE7, 0xF6, 0xD6, 0x0B,
+    0x17, 0xF3, 0x4B, 0x77, 0xB9, 0xE4, 0xEF, 0xE7, 0x00, 0xAA, 0x55, 0x61, 0x40, 0x26, 0xC0, 0x90,
+    0x01, 0xA2, 0x4C, 0xFE, 0xF9, 0x34, 0x27, 0x70, 0xAC, 0x38, 0x34, 0x5C, 0x5E, 0x25, 0xD4, 0x45,
+    0x98, 0xA9, 0x22, 0x13, 0x07, 0x45, 0xDE, 0xC8, 0xB0, 0xE4, 0xBB, 0xA1, 0xBA, 0x98, 0x5F, 0x32,
+    0x13, 0xCC, 0x54, 0x71, 0x28, 0x6F, 0x1E, 0x5A, 0x4A, 0x07, 0x7C, 0xC1, 0xE1, 0x62, 0x66, 0x2C,
+    0xF8, 0xD1, 0xBB, 0x61, 0x79, 0x39, 0x96, 0x64, 0xE2, 0x50, 0x1C, 0x5F, 0x17, 0x1B, 0xB5, 0xE3,
+    0xBB, 0x8B, 0x95, 0xC9, 0xFB, 0x4B, 0xD4, 0xA2, 0xB2, 0xEC, 0x15, 0x37, 0xEF, 0x9B, 0x67, 0x32,
+    0x00, 0x3D, 0x55, 0x2C, 0xE6, 0x8D, 0x66, 0x02, 0x4E, 0x27, 0x74, 0x01, 0x4D, 0x89, 0xCA, 0xFB,
+    0x7A, 0x31, 0x1C, 0xBC, 0x4E, 0xA6, 0x96, 0x4C, 0x1C, 0xCF, 0x54, 0x17, 0xF3, 0x4B, 0x66, 0x44,
+    0xDF, 0x64, 0x74, 0x69, 0x89, 0xF4, 0x3B, 0x2F, 0x2F, 0xB4, 0x9A, 0xD0, 0x05, 0xB4, 0x64, 0xDF,
+    0x64, 0xC0, 0x70, 0xAE, 0x38, 0xA0, 0xB2, 0x5C, 0xE4, 0x79, 0xD7, 0x95, 0x57, 0xF0, 0x34, 0x19,
+    0xF7, 0xA3, 0x78, 0xF2, 0xDE, 0x3C, 0x4D, 0xE8, 0xFC, 0xCA, 0x22, 0xFD, 0x1B, 0x72, 0x00, 0xF9,
+    0x06, 0xD9, 0x43, 0x72, 0xAA, 0x76, 0x8F, 0xB0, 0x8A, 0x00, 0xFE, 0xF1, 0xC6, 0x6F, 0x13, 0x47,
+    0xC2, 0x3F, 0x6E, 0xDF, 0xF1, 0x94, 0x16, 0x64, 0x22, 0x01, 0x80, 0x7C, 0xFF, 0x58, 0x02, 0x80,
+    0x50, 0xCA, 0xCB, 0xA9, 0x6C, 0x79, 0xE9, 0x45, 0x91, 0x00, 0x49, 0x3B, 0xB7, 0x65, 0xB9, 0x9A,
+    0x54, 0x09, 0xB9, 0x05, 0x26, 0x90, 0xF4, 0x0D, 0x93, 0x24, 0x09, 0xC3, 0xA4, 0x49, 0xDF, 0x90,
+    0xB3, 0x26, 0x87, 0x12, 0x76, 0x20, 0x2D, 0x71, 0x5D, 0xE7, 0x6E, 0x79, 0x55, 0xDE, 0x12, 0x06,
+    0x9D, 0xC5, 0x25, 0x8F, 0xA7, 0x8B, 0x9C, 0xE3, 0x65, 0xF1, 0x65, 0x73, 0x65, 0x35, 0xD3, 0x4B,
+    0x20, 0x4B, 0x7D, 0x7A, 0x79, 0xA3, 0xE9, 0xE2, 0x90, 0xA8, 0xE7, 0x4D, 0x74, 0xA2, 0x03, 0x5B,
+    0xA9, 0xCD, 0xE7, 0xFF, 0x06,
 };
 
 static const EpdGlyph notosans_16_boldGlyphs[] = {
@@ -2248,7 +2283,7 @@ static const EpdGlyph notosans_16_boldGlyphs[] = {
     { 4, 34, 18, 7, 26, 34, 8922 }, // |
     { 12, 30, 13, 1, 24, 90, 8956 }, // }
     { 17, 7, 19, 1, 15, 30, 9046 }, // ~
-    { 0, 0, 9, 0, 0, 0, 0 }, //  
+    { 0, 0, 9, 0, 0, 0, 9076 }, //  
     { 7, 25, 10, 1, 19, 44, 0 }, // ¡
     { 15, 26, 19, 2, 25, 98, 44 }, // ¢
     { 18, 25, 19, 1, 25, 113, 142 }, // £
@@ -2259,775 +2294,782 @@ static const EpdGlyph notosans_16_boldGlyphs[] = {
     { 12, 6, 20, 4, 26, 18, 566 }, // ¨
     { 26, 26, 28, 1, 25, 169, 584 }, // ©
     { 12, 13, 13, 0, 25, 39, 753 }, // ª
-    { 19, 16, 20, 1, 17, 76, 792 }, // «
-    { 17, 10, 19, 1, 14, 43, 868 }, // ¬
-    { 10, 5, 11, 0, 11, 13, 911 }, // ­
-    { 26, 26, 28, 1, 25, 169, 924 }, // ®
-    { 18, 4, 17, -1, 29, 18, 1093 }, // ¯
-    { 12, 13, 14, 1, 25, 39, 1111 }, // °
-    { 17, 21, 19, 1, 21, 90, 1150 }, // ±
-    { 12, 16, 13, 0, 29, 48, 1240 }, // ²
-    { 12, 16, 13, 0, 29, 48, 1288 }, // ³
-    { 10, 6, 12, 1, 26, 15, 1336 }, // ´
-    { 18, 27, 22, 2, 19, 122, 1351 }, // µ
-    { 18, 31, 22, 1, 26, 140, 1473 }, // ¶
-    { 7, 7, 9, 1, 15, 13, 1613 }, // ·
-    { 9, 8, 9, 0, 0, 18, 1626 }, // ¸
-    { 9, 16, 13, 1, 29, 36, 1644 }, // ¹
-    { 12, 13, 13, 0, 25, 39, 1680 }, // º
-    { 19, 16, 20, 1, 17, 76, 1719 }, // »
-    { 28, 24, 28, 0, 24, 168, 1795 }, // ¼
-    { 28, 24, 29, 0, 24, 168, 1963 }, // ½
-    { 27, 25, 28, 1, 25, 169, 2131 }, // ¾
-    { 16, 25, 16, 0, 19, 100, 2300 }, // ¿
-    { 24, 32, 23, 0, 32, 192, 2400 }, // À
-    { 24, 32, 23, 0, 32, 192, 2592 }, // Á
-    { 24, 32, 23, 0, 32, 192, 2784 }, // Â
-    { 24, 32, 23, 0, 32, 192, 2976 }, // Ã
-    { 24, 32, 23, 0, 32, 192, 3168 }, // Ä
-    { 24, 29, 23, 0, 29, 174, 3360 }, // Å
-    { 30, 24, 32, 0, 24, 180, 3534 }, // Æ
-    { 20, 33, 21, 1, 25, 165, 3714 }, // Ç
-    { 14, 32, 19, 3, 32, 112, 3879 }, // È
-    { 14, 32, 19, 3, 32, 112, 3991 }, // É
-    { 14, 32, 19, 3, 32, 112, 4103 }, // Ê
-    { 14, 32, 19, 3, 32, 112, 4215 }, // Ë
-    { 12, 32, 13, 0, 32, 96, 4327 }, // Ì
-    { 12, 32, 13, 1, 32, 96, 4423 }, // Í
-    { 15, 32, 13, -1, 32, 120, 4519 }, // Î
-    { 13, 32, 13, 0, 32, 104, 4639 }, // Ï
-    { 23, 24, 24, 0, 24, 138, 4743 }, // Ð
-    { 22, 32, 27, 3, 32, 176, 4881 }, // Ñ
-    { 24, 33, 26, 1, 32, 198, 5057 }, // Ò
-    { 24, 33, 26, 1, 32, 198, 5255 }, // Ó
-    { 24, 33, 26, 1, 32, 198, 5453 }, // Ô
-    { 24, 33, 26, 1, 32, 198, 5651 }, // Õ
-    { 24, 33, 26, 1, 32, 198, 5849 }, // Ö
-    { 15, 16, 19, 2, 20, 60, 6047 }, // ×
-    { 24, 28, 26, 1, 26, 168, 6107 }, // Ø
-    { 21, 33, 25, 2, 32, 174, 6275 }, // Ù
-    { 21, 33, 25, 2, 32, 174, 6449 }, // Ú
-    { 21, 33, 25, 2, 32, 174, 6623 }, // Û
-    { 21, 33, 25, 2, 32, 174, 6797 }, // Ü
-    { 21, 32, 21, 0, 32, 168, 6971 }, // Ý
-    { 17, 24, 21, 3, 24, 102, 7139 }, // Þ
-    { 21, 27, 23, 2, 26, 142, 7241 }, // ß
-    { 17, 27, 20, 1, 26, 115, 7383 }, // à
-    { 17, 27, 20, 1, 26, 115, 7498 }, // á
-    { 17, 27, 20, 1, 26, 115, 7613 }, // â
-    { 17, 27, 20, 1, 26, 115, 7728 }, // ã
-    { 17, 27, 20, 1, 26, 115, 7843 }, // ä
-    { 17, 29, 20, 1, 28, 124, 7958 }, // å
-    { 29, 20, 31, 1, 19, 145, 8082 }, // æ
-    { 16, 27, 17, 1, 19, 108, 8227 }, // ç
-    { 18, 27, 20, 1, 26, 122, 8335 }, // è
-    { 18, 27, 20, 1, 26, 122, 8457 }, // é
-    { 18, 27, 20, 1, 26, 122, 8579 }, // ê
-    { 18, 27, 20, 1, 26, 122, 8701 }, // ë
-    { 11, 26, 10, -1, 26, 72, 8823 }, // ì
-    { 10, 26, 10, 2, 26, 65, 8895 }, // í
-    { 14, 26, 10, -2, 26, 91, 8960 }, // î
-    { 12, 26, 10, -1, 26, 78, 9051 }, // ï
-    { 19, 27, 21, 1, 26, 129, 9129 }, // ð
-    { 18, 26, 22, 2, 26, 117, 9258 }, // ñ
-    { 19, 27, 21, 1, 26, 129, 9375 }, // ò
-    { 19, 27, 21, 1, 26, 129, 9504 }, // ó
-    { 19, 27, 21, 1, 26, 129, 9633 }, // ô
-    { 19, 27, 21, 1, 26, 129, 9762 }, // õ
-    { 19, 27, 21, 1, 26, 129, 9891 }, // ö
-    { 17, 17, 19, 1, 20, 73, 10020 }, // ÷
-    { 19, 22, 21, 1, 20, 105, 10093 }, // ø
-    { 18, 27, 22, 2, 26, 122, 10198 }, // ù
-    { 18, 27, 22, 2, 26, 122, 10320 }, // ú
-    { 18, 27, 22, 2, 26, 122, 10442 }, // û
-    { 18, 27, 22, 2, 26, 122, 10564 }, // ü
-    { 20, 34, 19, 0, 26, 170, 10686 }, // ý
-    { 18, 34, 21, 2, 26, 153, 10856 }, // þ
-    { 20, 34, 19, 0, 26, 170, 11009 }, // ÿ
-    { 24, 30, 23, 0, 30, 180, 0 }, // Ā
-    { 17, 25, 20, 1, 24, 107, 180 }, // ā
-    { 24, 32, 23, 0, 32, 192, 287 }, // Ă
-    { 17, 27, 20, 1, 26, 115, 479 }, // ă
-    { 24, 32, 23, 0, 24, 192, 594 }, // Ą
-    { 17, 27, 20, 1, 19, 115, 786 }, // ą
-    { 20, 33, 21, 1, 32, 165, 901 }, // Ć
-    { 16, 27, 17, 1, 26, 108, 1066 }, // ć
-    { 20, 33, 21, 1, 32, 165, 1174 }, // Ĉ
-    { 16, 27, 17, 1, 26, 108, 1339 }, // ĉ
-    { 20, 33, 21, 1, 32, 165, 1447 }, // Ċ
-    { 16, 27, 17, 1, 26, 108, 1612 }, // ċ
-    { 20, 33, 21, 1, 32, 165, 1720 }, // Č
-    { 17, 27, 17, 1, 26, 115, 1885 }, // č
-    { 21, 32, 24, 2, 32, 168, 2000 }, // Ď
-    { 25, 27, 21, 1, 26, 169, 2168 }, // ď
-    { 23, 24, 24, 0, 24, 138, 2337 }, // Đ
-    { 21, 27, 22, 1, 26, 142, 2475 }, // đ
-    { 14, 30, 19, 3, 30, 105, 2617 }, // Ē
-    { 18, 25, 20, 1, 24, 113, 2722 }, // ē
-    { 14, 32, 19, 3, 32, 112, 2835 }, // Ĕ
-    { 18, 27, 20, 1, 26, 122, 2947 }, // ĕ
-    { 14, 32, 19, 3, 32, 112, 3069 }, // Ė
-    { 18, 27, 20, 1, 26, 122, 3181 }, // ė
-    { 14, 32, 19, 3, 24, 112, 3303 }, // Ę
-    { 18, 27, 20, 1, 19, 122, 3415 }, // ę
-    { 15, 32, 19, 3, 32, 120, 3537 }, // Ě
-    { 18, 27, 20, 1, 26, 122, 3657 }, // ě
-    { 21, 33, 24, 1, 32, 174, 3779 }, // Ĝ
-    { 18, 34, 21, 1, 26, 153, 3953 }, // ĝ
-    { 21, 33, 24, 1, 32, 174, 4106 }, // Ğ
-    { 18, 34, 21, 1, 26, 153, 4280 }, // ğ
-    { 21, 33, 24, 1, 32, 174, 4433 }, // Ġ
-    { 18, 34, 21, 1, 26, 153, 4607 }, // ġ
-    { 21, 33, 24, 1, 25, 174, 4760 }, // Ģ
-    { 18, 34, 21, 1, 26, 153, 4934 }, // ģ
-    { 20, 32, 26, 3, 32, 160, 5087 }, // Ĥ
-    { 22, 33, 22, -2, 33, 182, 5247 }, // ĥ
-    { 26, 24, 26, 0, 24, 156, 5429 }, // Ħ
-    { 20, 26, 22, 0, 26, 130, 5585 }, // ħ
-    { 15, 32, 13, -2, 32, 120, 5715 }, // Ĩ
-    { 14, 26, 10, -2, 26, 91, 5835 }, // ĩ
-    { 12, 30, 13, 0, 30, 90, 5926 }, // Ī
-    { 12, 24, 10, -1, 24, 72, 6016 }, // ī
-    { 14, 32, 13, 0, 32, 112, 6088 }, // Ĭ
-    { 14, 26, 10, -2, 26, 91, 6200 }, // ĭ
-    { 11, 32, 13, 1, 24, 88, 6291 }, // Į
-    { 7, 34, 10, 1, 26, 60, 6379 }, // į
-    { 11, 32, 13, 1, 32, 88, 6439 }, // İ
-    { 6, 19, 10, 2, 19, 29, 6527 }, // ı
-    { 21, 31, 24, 1, 24, 163, 6556 }, // Ĳ
-    { 16, 34, 20, 2, 26, 136, 6719 }, // ĳ
-    { 16, 39, 11, -3, 32, 156, 6855 }, // Ĵ
-    { 14, 34, 10, -2, 26, 119, 7011 }, // ĵ
-    { 20, 32, 22, 3, 24, 160, 7130 }, // Ķ
-    { 19, 34, 21, 2, 26, 162, 7290 }, // ķ
-    { 19, 19, 21, 2, 19, 91, 7452 }, // ĸ
-    { 16, 32, 19, 2, 32, 128, 7543 }, // Ĺ
-    { 10, 33, 10, 2, 33, 83, 7671 }, // ĺ
-    { 16, 32, 19, 2, 24, 128, 7754 }, // Ļ
-    { 6, 34, 10, 2, 26, 51, 7882 }, // ļ
-    { 17, 24, 19, 2, 24, 102, 7933 }, // Ľ
-    { 13, 26, 10, 2, 26, 85, 8035 }, // ľ
-    { 16, 24, 19, 2, 24, 96, 8120 }, // Ŀ
-    { 12, 26, 12, 2, 26, 78, 8216 }, // ŀ
-    { 18, 24, 19, 0, 24, 108, 8294 }, // Ł
-    { 12, 26, 10, -1, 26, 78, 8402 }, // ł
-    { 22, 32, 27, 3, 32, 176, 8480 }, // Ń
-    { 18, 26, 22, 2, 26, 117, 8656 }, // ń
-    { 22, 32, 27, 3, 24, 176, 8773 }, // Ņ
-    { 18, 27, 22, 2, 19, 122, 8949 }, // ņ
-    { 22, 32, 27, 3, 32, 176, 9071 }, // Ň
-    { 18, 26, 22, 2, 26, 117, 9247 }, // ň
-    { 25, 24, 26, -1, 24, 150, 9364 }, // ŉ
-    { 22, 31, 27, 3, 24, 171, 9514 }, // Ŋ
-    { 18, 27, 22, 2, 19, 122, 9685 }, // ŋ
-    { 24, 31, 26, 1, 30, 186, 9807 }, // Ō
-    { 19, 25, 21, 1, 24, 119, 9993 }, // ō
-    { 24, 33, 26, 1, 32, 198, 10112 }, // Ŏ
-    { 19, 27, 21, 1, 26, 129, 10310 }, // ŏ
-    { 24, 33, 26, 1, 32, 198, 10439 }, // Ő
-    { 19, 27, 21, 1, 26, 129, 10637 }, // ő
-    { 30, 26, 32, 1, 25, 195, 10766 }, // Œ
-    { 31, 20, 33, 1, 19, 155, 10961 }, // œ
-    { 20, 32, 22, 2, 32, 160, 11116 }, // Ŕ
-    { 14, 26, 15, 2, 26, 91, 11276 }, // ŕ
-    { 20, 32, 22, 2, 24, 160, 11367 }, // Ŗ
-    { 13, 27, 15, 2, 19, 88, 11527 }, // ŗ
-    { 20, 32, 22, 2, 32, 160, 11615 }, // Ř
-    { 15, 26, 15, 1, 26, 98, 11775 }, // ř
-    { 17, 33, 18, 1, 32, 141, 11873 }, // Ś
-    { 15, 27, 17, 1, 26, 102, 12014 }, // ś
-    { 17, 33, 18, 1, 32, 141, 12116 }, // Ŝ
-    { 15, 27, 17, 1, 26, 102, 12257 }, // ŝ
-    { 17, 33, 18, 1, 25, 141, 12359 }, // Ş
-    { 15, 27, 17, 1, 19, 102, 12500 }, // ş
-    { 17, 33, 18, 1, 32, 141, 12602 }, // Š
-    { 15, 27, 17, 1, 26, 102, 12743 }, // š
-    { 19, 32, 19, 0, 24, 152, 12845 }, // Ţ
-    { 14, 31, 14, 0, 23, 109, 12997 }, // ţ
-    { 19, 32, 19, 0, 32, 152, 13106 }, // Ť
-    { 19, 27, 14, 0, 26, 129, 13258 }, // ť
-    { 19, 24, 19, 0, 24, 114, 13387 }, // Ŧ
-    { 14, 24, 14, 0, 23, 84, 13501 }, // ŧ
-    { 21, 33, 25, 2, 32, 174, 13585 }, // Ũ
-    { 18, 27, 22, 2, 26, 122, 13759 }, // ũ
-    { 21, 31, 25, 2, 30, 163, 13881 }, // Ū
-    { 18, 25, 22, 2, 24, 113, 14044 }, // ū
-    { 21, 33, 25, 2, 32, 174, 14157 }, // Ŭ
-    { 18, 27, 22, 2, 26, 122, 14331 }, // ŭ
-    { 21, 35, 25, 2, 34, 184, 14453 }, // Ů
-    { 18, 29, 22, 2, 28, 131, 14637 }, // ů
-    { 21, 33, 25, 2, 32, 174, 14768 }, // Ű
-    { 18, 27, 22, 2, 26, 122, 14942 }, // ű
-    { 21, 32, 25, 2, 24, 168, 15064 }, // Ų
-    { 18, 27, 22, 2, 19, 122, 15232 }, // ų
-    { 33, 32, 32, 0, 32, 264, 15354 }, // Ŵ
-    { 29, 26, 29, 0, 26, 189, 15618 }, // ŵ
-    { 21, 32, 21, 0, 32, 168, 15807 }, // Ŷ
-    { 20, 34, 19, 0, 26, 170, 15975 }, // ŷ
-    { 21, 32, 21, 0, 32, 168, 16145 }, // Ÿ
-    { 19, 32, 19, 0, 32, 152, 16313 }, // Ź
-    { 15, 26, 16, 1, 26, 98, 16465 }, // ź
-    { 19, 32, 19, 0, 32, 152, 16563 }, // Ż
-    { 15, 26, 16, 1, 26, 98, 16715 }, // ż
-    { 19, 32, 19, 0, 32, 152, 16813 }, // Ž
-    { 15, 26, 16, 1, 26, 98, 16965 }, // ž
-    { 12, 26, 13, 2, 26, 78, 17063 }, // ſ
-    { 10, 6, 0, -18, 26, 15, 0 }, // ̀
-    { 11, 6, 0, -13, 26, 17, 15 }, // ́
-    { 14, 6, 0, -7, 26, 21, 32 }, // ̂
-    { 15, 6, 0, -19, 26, 23, 53 }, // ̃
-    { 12, 4, 0, -6, 24, 12, 76 }, // ̄
-    { 14, 5, 0, -7, 29, 18, 88 }, // ̅
-    { 14, 6, 0, -7, 26, 21, 106 }, // ̆
-    { 6, 6, 0, -3, 26, 9, 127 }, // ̇
-    { 12, 6, 0, -6, 26, 18, 136 }, // ̈
-    { 8, 9, 0, -14, 28, 18, 154 }, // ̉
-    { 9, 8, 0, -5, 28, 18, 172 }, // ̊
-    { 16, 6, 0, -6, 26, 24, 190 }, // ̋
-    { 15, 6, 0, -7, 26, 23, 214 }, // ̌
-    { 4, 7, 0, -2, 26, 7, 237 }, // ̍
-    { 10, 7, 0, -5, 26, 18, 244 }, // ̎
-    { 14, 6, 0, -19, 26, 21, 262 }, // ̏
-    { 12, 9, 0, -6, 29, 27, 283 }, // ̐
-    { 14, 6, 0, -7, 26, 21, 310 }, // ̑
-    { 8, 9, 0, -4, 24, 18, 331 }, // ̒
-    { 8, 9, 0, -4, 24, 18, 349 }, // ̓
-    { 8, 9, 0, -4, 24, 18, 367 }, // ̔
-    { 8, 9, 0, -4, 24, 18, 385 }, // ̕
-    { 11, 6, 0, -6, -1, 17, 403 }, // ̖
-    { 10, 6, 0, -5, -1, 15, 420 }, // ̗
-    { 6, 8, 0, -3, 0, 12, 435 }, // ̘
-    { 6, 8, 0, -3, 0, 12, 447 }, // ̙
-    { 9, 9, 10, 0, 26, 21, 459 }, // ̚
-    { 9, 9, 0, -4, 26, 21, 480 }, // ̛
-    { 5, 8, 0, -3, 0, 10, 501 }, // ̜
-    { 8, 6, 0, -4, -1, 12, 511 }, // ̝
-    { 8, 6, 0, -4, -1, 12, 523 }, // ̞
-    { 8, 8, 0, -4, 0, 16, 535 }, // ̟
-    { 8, 3, 0, -4, -3, 6, 551 }, // ̠
-    { 8, 10, 0, -8, 2, 20, 557 }, // ̡
-    { 8, 10, 0, 0, 2, 20, 577 }, // ̢
-    { 7, 6, 0, -15, -2, 11, 597 }, // ̣
-    { 12, 6, 0, -6, -1, 18, 608 }, // ̤
-    { 9, 8, 0, -5, 0, 18, 626 }, // ̥
-    { 6, 6, 0, -3, -2, 9, 644 }, // ̦
-    { 8, 8, 0, -4, 0, 16, 653 }, // ̧
-    { 8, 9, 0, -4, 1, 18, 669 }, // ̨
-    { 4, 7, 0, -2, -1, 7, 687 }, // ̩
-    { 12, 7, 0, -6, -1, 21, 694 }, // ̪
-    { 14, 4, 0, -7, -2, 14, 715 }, // ̫
-    { 15, 6, 0, -7, -1, 23, 729 }, // ̬
-    { 14, 6, 0, -7, -1, 21, 752 }, // ̭
-    { 14, 6, 0, -7, -1, 21, 773 }, // ̮
-    { 14, 6, 0, -7, -1, 21, 794 }, // ̯
-    { 14, 6, 0, -7, -1, 21, 815 }, // ̰
-    { 12, 4, 0, -6, -2, 12, 836 }, // ̱
-    { 16, 3, 0, -8, -3, 12, 848 }, // ̲
-    { 15, 8, 0, -8, 0, 30, 860 }, // ̳
-    { 15, 6, 0, -7, 13, 23, 890 }, // ̴
-    { 14, 5, 0, -7, 12, 18, 913 }, // ̵
-    { 26, 4, 0, -13, 11, 26, 931 }, // ̶
-    { 12, 10, 0, -6, 14, 30, 957 }, // ̷
-    { 14, 28, 0, -7, 26, 98, 987 }, // ̸
-    { 5, 8, 0, -2, 0, 10, 1085 }, // ̹
-    { 12, 7, 0, -6, -1, 21, 1095 }, // ̺
-    { 14, 8, 0, -7, 0, 28, 1116 }, // ̻
-    { 14, 4, 0, -7, -2, 14, 1144 }, // ̼
-    { 8, 7, 0, -4, 26, 14, 1158 }, // ̽
-    { 6, 10, 0, -3, 29, 15, 1172 }, // ̾
-    { 14, 8, 0, -8, 33, 28, 1187 }, // ̿
-    { 11, 6, 0, -8, 26, 17, 1215 }, // ̀
-    { 10, 6, 0, -2, 26, 15, 1232 }, // ́
-    { 14, 6, 0, -7, 26, 21, 1247 }, // ͂
-    { 7, 7, 0, -4, 26, 13, 1268 }, // ̓
-    { 18, 6, 0, -7, 26, 27, 1281 }, // ̈́
-    { 7, 7, 0, -2, -1, 13, 1308 }, // ͅ
-    { 16, 7, 0, -8, 26, 28, 1321 }, // ͆
-    { 14, 8, 0, -8, 0, 28, 1349 }, // ͇
-    { 10, 7, 0, -5, -1, 18, 1377 }, // ͈
-    { 8, 6, 0, -4, -2, 12, 1395 }, // ͉
-    { 14, 8, 0, -7, 26, 28, 1407 }, // ͊
-    { 14, 14, 0, -7, 32, 49, 1435 }, // ͋
-    { 12, 9, 0, -6, 29, 27, 1484 }, // ͌
-    { 12, 7, 0, -6, -1, 21, 1511 }, // ͍
-    { 8, 8, 0, -4, 0, 16, 1532 }, // ͎
-    { 24, 24, 0, -12, 24, 144, 1548 }, // ͏
-    { 6, 8, 0, -3, 27, 12, 1692 }, // ͐
-    { 5, 8, 0, -2, 27, 10, 1704 }, // ͑
-    { 12, 9, 0, -6, 29, 27, 1714 }, // ͒
-    { 8, 7, 0, -4, -1, 14, 1741 }, // ͓
-    { 6, 7, 0, -3, -1, 11, 1755 }, // ͔
-    { 6, 7, 0, -3, -1, 11, 1766 }, // ͕
-    { 14, 7, 0, -7, -1, 25, 1777 }, // ͖
-    { 5, 8, 0, -2, 27, 10, 1802 }, // ͗
-    { 6, 6, 0, 3, 26, 9, 1812 }, // ͘
-    { 8, 7, 0, -4, -1, 14, 1821 }, // ͙
-    { 14, 8, 0, -7, 0, 28, 1835 }, // ͚
-    { 8, 8, 0, -4, 27, 16, 1863 }, // ͛
-    { 28, 7, 0, -14, -1, 49, 1879 }, // ͜
-    { 28, 7, 0, -14, 26, 49, 1928 }, // ͝
-    { 20, 3, 0, -10, 23, 15, 1977 }, // ͞
-    { 20, 3, 0, -10, -2, 15, 1992 }, // ͟
-    { 28, 6, 0, -14, 26, 42, 2007 }, // ͠
-    { 28, 8, 0, -14, 30, 56, 2049 }, // ͡
-    { 27, 8, 0, -13, 0, 54, 2105 }, // ͢
-    { 8, 9, 0, -4, 29, 18, 2159 }, // ͣ
-    { 9, 9, 0, -4, 29, 21, 2177 }, // ͤ
-    { 3, 11, 0, -1, 31, 9, 2198 }, // ͥ
-    { 9, 9, 0, -4, 29, 21, 2207 }, // ͦ
-    { 9, 8, 0, -4, 28, 18, 2228 }, // ͧ
-    { 7, 9, 0, -3, 29, 16, 2246 }, // ͨ
-    { 8, 11, 0, -4, 31, 22, 2262 }, // ͩ
-    { 9, 11, 0, -4, 31, 25, 2284 }, // ͪ
-    { 13, 9, 0, -6, 29, 30, 2309 }, // ͫ
-    { 6, 9, 0, -2, 29, 14, 2339 }, // ͬ
-    { 7, 10, 0, -3, 30, 18, 2353 }, // ͭ
-    { 9, 8, 0, -4, 28, 18, 2371 }, // ͮ
-    { 10, 8, 0, -5, 28, 20, 2389 }, // ͯ
-    { 15, 32, 19, 2, 32, 120, 0 }, // Ѐ
-    { 15, 32, 19, 2, 32, 120, 120 }, // Ё
-    { 25, 25, 26, 0, 24, 157, 240 }, // Ђ
-    { 15, 32, 19, 3, 32, 120, 397 }, // Ѓ
-    { 20, 26, 22, 1, 25, 130, 517 }, // Є
-    { 16, 26, 18, 1, 25, 104, 647 }, // Ѕ
-    { 6, 24, 11, 2, 24, 36, 751 }, // І
-    { 11, 32, 11, 0, 32, 88, 787 }, // Ї
-    { 12, 31, 11, -3, 24, 93, 875 }, // Ј
-    { 33, 25, 34, 0, 24, 207, 968 }, // Љ
-    { 31, 24, 35, 3, 24, 186, 1175 }, // Њ
-    { 24, 24, 26, 0, 24, 144, 1361 }, // Ћ
-    { 20, 32, 23, 3, 32, 160, 1505 }, // Ќ
-    { 21, 32, 26, 3, 32, 168, 1665 }, // Ѝ
-    { 22, 33, 22, 0, 32, 182, 1833 }, // Ў
-    { 20, 29, 26, 3, 24, 145, 2015 }, // Џ
-    { 24, 24, 23, 0, 24, 144, 2160 }, // А
-    { 18, 24, 22, 3, 24, 108, 2304 }, // Б
-    { 19, 24, 22, 2, 24, 114, 2412 }, // В
-    { 15, 24, 19, 3, 24, 90, 2526 }, // Г
-    { 26, 29, 26, 0, 24, 189, 2616 }, // Д
-    { 15, 24, 19, 2, 24, 90, 2805 }, // Е
-    { 33, 24, 33, 0, 24, 198, 2895 }, // Ж
-    { 17, 26, 20, 1, 25, 111, 3093 }, // З
-    { 21, 24, 26, 3, 24, 126, 3204 }, // И
-    { 21, 32, 26, 3, 32, 168, 3330 }, // Й
-    { 20, 24, 23, 3, 24, 120, 3498 }, // К
-    { 22, 25, 24, 0, 24, 138, 3618 }, // Л
-    { 26, 24, 31, 3, 24, 156, 3756 }, // М
-    { 20, 24, 26, 3, 24, 120, 3912 }, // Н
-    { 24, 26, 26, 1, 25, 156, 4032 }, // О
-    { 20, 24, 25, 3, 24, 120, 4188 }, // П
-    { 18, 24, 21, 2, 24, 108, 4308 }, // Р
-    { 20, 26, 22, 1, 25, 130, 4416 }, // С
-    { 19, 24, 19, 0, 24, 114, 4546 }, // Т
-    { 22, 25, 22, 0, 24, 138, 4660 }, // У
-    { 28, 26, 30, 1, 25, 182, 4798 }, // Ф
-    { 23, 24, 22, 0, 24, 138, 4980 }, // Х
-    { 23, 29, 26, 3, 24, 167, 5118 }, // Ц
-    { 19, 24, 24, 2, 24, 114, 5285 }, // Ч
-    { 31, 24, 36, 2, 24, 186, 5399 }, // Ш
-    { 34, 30, 36, 2, 24, 255, 5585 }, // Щ
-    { 24, 24, 25, 0, 24, 144, 5840 }, // Ъ
-    { 25, 24, 31, 3, 24, 150, 5984 }, // Ы
-    { 17, 24, 22, 3, 24, 102, 6134 }, // Ь
-    { 19, 26, 22, 1, 25, 124, 6236 }, // Э
-    { 30, 26, 34, 3, 25, 195, 6360 }, // Ю
-    { 20, 24, 23, 0, 24, 120, 6555 }, // Я
-    { 17, 20, 20, 1, 19, 85, 6675 }, // а
-    { 19, 27, 21, 1, 26, 129, 6760 }, // б
-    { 17, 19, 20, 2, 19, 81, 6889 }, // в
-    { 14, 19, 16, 2, 19, 67, 6970 }, // г
-    { 21, 24, 21, 0, 19, 126, 7037 }, // д
-    { 18, 20, 19, 1, 19, 90, 7163 }, // е
-    { 29, 19, 29, 0, 19, 138, 7253 }, // ж
-    { 15, 20, 17, 1, 19, 75, 7391 }, // з
-    { 18, 19, 22, 2, 19, 86, 7466 }, // и
-    { 18, 26, 22, 2, 26, 117, 7552 }, // й
-    { 19, 19, 21, 2, 19, 91, 7669 }, // к
-    { 19, 20, 21, 0, 19, 95, 7760 }, // л
-    { 24, 19, 28, 2, 19, 114, 7855 }, // м
-    { 18, 19, 22, 2, 19, 86, 7969 }, // н
-    { 19, 20, 21, 1, 19, 95, 8055 }, // о
-    { 17, 19, 22, 2, 19, 81, 8150 }, // п
-    { 18, 27, 21, 2, 19, 122, 8231 }, // р
-    { 16, 20, 17, 1, 19, 80, 8353 }, // с
-    { 17, 19, 17, 0, 19, 81, 8433 }, // т
-    { 21, 27, 19, -1, 19, 142, 8514 }, // у
-    { 25, 34, 27, 1, 26, 213, 8656 }, // ф
-    { 20, 19, 19, 0, 19, 95, 8869 }, // х
-    { 20, 24, 22, 2, 19, 120, 8964 }, // ц
-    { 17, 19, 21, 2, 19, 81, 9084 }, // ч
-    { 28, 19, 32, 2, 19, 133, 9165 }, // ш
-    { 30, 24, 32, 2, 19, 180, 9298 }, // щ
-    { 22, 19, 22, 0, 19, 105, 9478 }, // ъ
-    { 24, 19, 28, 2, 19, 114, 9583 }, // ы
-    { 17, 19, 20, 2, 19, 81, 9697 }, // ь
-    { 16, 20, 17, 1, 19, 80, 9778 }, // э
-    { 25, 20, 28, 2, 19, 125, 9858 }, // ю
-    { 18, 19, 20, 0, 19, 86, 9983 }, // я
-    { 18, 27, 19, 1, 26, 122, 10069 }, // ѐ
-    { 18, 26, 19, 1, 25, 117, 10191 }, // ё
-    { 20, 34, 22, 0, 26, 170, 10308 }, // ђ
-    { 14, 26, 16, 2, 26, 91, 10478 }, // ѓ
-    { 16, 20, 17, 1, 19, 80, 10569 }, // є
-    { 15, 20, 17, 1, 19, 75, 10649 }, // ѕ
-    { 6, 26, 10, 2, 26, 39, 10724 }, // і
-    { 10, 26, 10, 0, 26, 65, 10763 }, // ї
-    { 10, 34, 10, -2, 26, 85, 10828 }, // ј
-    { 29, 20, 30, 0, 19, 145, 10913 }, // љ
-    { 28, 19, 31, 2, 19, 133, 11058 }, // њ
-    { 20, 26, 22, 0, 26, 130, 11191 }, // ћ
-    { 19, 26, 21, 2, 26, 124, 11321 }, // ќ
-    { 18, 26, 22, 2, 26, 117, 11445 }, // ѝ
-    { 21, 34, 19, -1, 26, 179, 11562 }, // ў
-    { 17, 24, 22, 2, 19, 102, 11741 }, // џ
-    { 32, 24, 32, 0, 24, 192, 11843 }, // Ѡ
-    { 29, 19, 30, 0, 19, 138, 12035 }, // ѡ
-    { 21, 24, 22, 0, 24, 126, 12173 }, // Ѣ
-    { 21, 22, 22, 0, 22, 116, 12299 }, // ѣ
-    { 28, 26, 32, 3, 25, 182, 12415 }, // Ѥ
-    { 24, 20, 27, 2, 19, 120, 12597 }, // ѥ
-    { 25, 24, 24, 0, 24, 150, 12717 }, // Ѧ
-    { 22, 19, 21, 0, 19, 105, 12867 }, // ѧ
-    { 31, 24, 34, 3, 24, 186, 12972 }, // Ѩ
-    { 29, 19, 30, 2, 19, 138, 13158 }, // ѩ
-    { 27, 24, 27, 0, 24, 162, 13296 }, // Ѫ
-    { 21, 19, 21, 0, 19, 100, 13458 }, // ѫ
-    { 33, 24, 36, 3, 24, 198, 13558 }, // Ѭ
-    { 27, 19, 29, 2, 19, 129, 13756 }, // ѭ
-    { 20, 37, 21, 0, 29, 185, 13885 }, // Ѯ
-    { 18, 31, 19, 0, 23, 140, 14070 }, // ѯ
-    { 25, 24, 29, 2, 24, 150, 14210 }, // Ѱ
-    { 24, 34, 28, 2, 26, 204, 14360 }, // ѱ
-    { 24, 26, 26, 1, 25, 156, 14564 }, // Ѳ
-    { 19, 20, 21, 1, 19, 95, 14720 }, // ѳ
-    { 24, 24, 24, 0, 24, 144, 14815 }, // Ѵ
-    { 21, 19, 20, 0, 19, 100, 14959 }, // ѵ
-    { 24, 32, 24, 0, 32, 192, 15059 }, // Ѷ
-    { 21, 26, 20, 0, 26, 137, 15251 }, // ѷ
-    { 43, 33, 44, 1, 25, 355, 15388 }, // Ѹ
-    { 39, 27, 39, 1, 19, 264, 15743 }, // ѹ
-    { 25, 29, 28, 1, 26, 182, 16007 }, // Ѻ
-    { 21, 23, 23, 1, 21, 121, 16189 }, // ѻ
-    { 34, 37, 36, 1, 36, 315, 16310 }, // Ѽ
-    { 29, 32, 32, 1, 31, 232, 16625 }, // ѽ
-    { 32, 31, 32, 0, 31, 248, 16857 }, // Ѿ
-    { 29, 25, 30, 0, 25, 182, 17105 }, // ѿ
-    { 21, 33, 23, 1, 25, 174, 17287 }, // Ҁ
-    { 16, 27, 17, 1, 19, 108, 17461 }, // ҁ
-    { 18, 22, 20, 1, 21, 99, 17569 }, // ҂
-    { 14, 7, 0, -16, 25, 25, 17668 }, // ҃
-    { 14, 6, 0, -16, 26, 21, 17693 }, // ҄
-    { 6, 8, 0, -12, 27, 12, 17714 }, // ҅
-    { 6, 8, 0, -12, 27, 12, 17726 }, // ҆
-    { 14, 6, 0, -7, 31, 21, 17738 }, // ҇
-    { 38, 36, 0, -19, 27, 342, 17759 }, // ҈
-    { 38, 38, 0, -19, 28, 361, 18101 }, // ҉
-    { 27, 39, 31, 3, 32, 264, 18462 }, // Ҋ
-    { 25, 34, 27, 2, 27, 213, 18726 }, // ҋ
-    { 20, 24, 21, 0, 24, 120, 18939 }, // Ҍ
-    { 20, 26, 20, 0, 26, 130, 19059 }, // ҍ
-    { 17, 24, 21, 3, 24, 102, 19189 }, // Ҏ
-    { 18, 27, 21, 2, 19, 122, 19291 }, // ҏ
-    { 17, 29, 19, 2, 29, 124, 19413 }, // Ґ
-    { 14, 24, 17, 2, 24, 84, 19537 }, // ґ
-    { 18, 24, 19, 0, 24, 108, 19621 }, // Ғ
-    { 16, 19, 16, 0, 19, 76, 19729 }, // ғ
-    { 20, 33, 24, 3, 24, 165, 19805 }, // Ҕ
-    { 17, 28, 20, 2, 19, 119, 19970 }, // ҕ
-    { 34, 31, 34, 0, 24, 264, 20089 }, // Җ
-    { 32, 26, 31, -1, 19, 208, 20353 }, // җ
-    { 17, 33, 20, 1, 25, 141, 20561 }, // Ҙ
-    { 15, 27, 17, 1, 19, 102, 20702 }, // ҙ
-    { 22, 31, 25, 3, 24, 171, 20804 }, // Қ
-    { 20, 26, 22, 2, 19, 130, 20975 }, // қ
-    { 21, 24, 22, 2, 24, 126, 21105 }, // Ҝ
-    { 19, 19, 21, 2, 19, 91, 21231 }, // ҝ
-    { 22, 24, 23, 1, 24, 132, 21322 }, // Ҟ
-    { 21, 26, 21, 0, 26, 137, 21454 }, // ҟ
-    { 25, 24, 24, 0, 24, 150, 21591 }, // Ҡ
-    { 24, 19, 23, 0, 19, 114, 21741 }, // ҡ
-    { 25, 31, 28, 3, 24, 194, 21855 }, // Ң
-    { 22, 26, 25, 2, 19, 143, 22049 }, // ң
-    { 25, 24, 28, 3, 24, 150, 22192 }, // Ҥ
-    { 24, 19, 25, 2, 19, 114, 22342 }, // ҥ
-    { 33, 33, 38, 3, 24, 273, 22456 }, // Ҧ
-    { 27, 28, 30, 2, 19, 189, 22729 }, // ҧ
-    { 24, 27, 26, 1, 25, 162, 22918 }, // Ҩ
-    { 20, 21, 22, 1, 19, 105, 23080 }, // ҩ
-    { 20, 33, 21, 1, 25, 165, 23185 }, // Ҫ
-    { 16, 27, 17, 1, 19, 108, 23350 }, // ҫ
-    { 19, 31, 19, 0, 24, 148, 23458 }, // Ҭ
-    { 18, 26, 18, 0, 19, 117, 23606 }, // ҭ
-    { 21, 24, 21, 0, 24, 126, 23723 }, // Ү
-    { 20, 27, 19, 0, 19, 135, 23849 }, // ү
-    { 21, 24, 21, 0, 24, 126, 23984 }, // Ұ
-    { 20, 27, 19, 0, 19, 135, 24110 }, // ұ
-    { 25, 31, 25, 0, 24, 194, 24245 }, // Ҳ
-    { 21, 26, 21, 0, 19, 137, 24439 }, // ҳ
-    { 31, 31, 31, 0, 24, 241, 24576 }, // Ҵ
-    { 26, 26, 26, 0, 19, 169, 24817 }, // ҵ
-    { 26, 31, 27, 1, 24, 202, 24986 }, // Ҷ
-    { 22, 26, 24, 2, 19, 143, 25188 }, // ҷ
-    { 20, 24, 25, 2, 24, 120, 25331 }, // Ҹ
-    { 19, 19, 22, 1, 19, 91, 25451 }, // ҹ
-    { 21, 24, 25, 2, 24, 126, 25542 }, // Һ
-    { 18, 26, 22, 2, 26, 117, 25668 }, // һ
-    { 29, 26, 32, 0, 25, 189, 25785 }, // Ҽ
-    { 24, 20, 24, -1, 19, 120, 25974 }, // ҽ
-    { 29, 32, 32, 0, 25, 232, 26094 }, // Ҿ
-    { 24, 26, 24, -1, 19, 156, 26326 }, // ҿ
-    { 11, 24, 13, 1, 24, 66, 26482 }, // Ӏ
-    { 33, 32, 33, 0, 32, 264, 26548 }, // Ӂ
-    { 29, 26, 29, 0, 26, 189, 26812 }, // ӂ
-    { 21, 33, 25, 3, 24, 174, 27001 }, // Ӄ
-    { 19, 28, 22, 2, 19, 133, 27175 }, // ӄ
-    { 28, 31, 28, 0, 24, 217, 27308 }, // Ӆ
-    { 24, 26, 24, 0, 19, 156, 27525 }, // ӆ
-    { 20, 33, 26, 3, 24, 165, 27681 }, // Ӈ
-    { 18, 28, 22, 2, 19, 126, 27846 }, // ӈ
-    { 25, 31, 29, 3, 24, 194, 27972 }, // Ӊ
-    { 23, 26, 25, 2, 19, 150, 28166 }, // ӊ
-    { 20, 31, 25, 2, 24, 155, 28316 }, // Ӌ
-    { 18, 26, 22, 2, 19, 117, 28471 }, // ӌ
-    { 31, 31, 35, 3, 24, 241, 28588 }, // Ӎ
-    { 29, 26, 31, 2, 19, 189, 28829 }, // ӎ
-    { 11, 24, 13, 1, 24, 66, 29018 }, // ӏ
-    { 24, 32, 23, 0, 32, 192, 29084 }, // Ӑ
-    { 17, 27, 20, 1, 26, 115, 29276 }, // ӑ
-    { 24, 32, 23, 0, 32, 192, 29391 }, // Ӓ
-    { 17, 27, 20, 1, 26, 115, 29583 }, // ӓ
-    { 30, 24, 32, 0, 24, 180, 29698 }, // Ӕ
-    { 29, 20, 31, 1, 19, 145, 29878 }, // ӕ
-    { 14, 32, 19, 3, 32, 112, 30023 }, // Ӗ
-    { 18, 27, 20, 1, 26, 122, 30135 }, // ӗ
-    { 24, 26, 27, 2, 25, 156, 30257 }, // Ә
-    { 18, 20, 20, 1, 19, 90, 30413 }, // ә
-    { 24, 33, 27, 2, 32, 198, 30503 }, // Ӛ
-    { 18, 27, 20, 1, 26, 122, 30701 }, // ӛ
-    { 33, 32, 33, 0, 32, 264, 30823 }, // Ӝ
-    { 29, 26, 29, 0, 26, 189, 31087 }, // ӝ
-    { 17, 33, 20, 1, 32, 141, 31276 }, // Ӟ
-    { 15, 27, 17, 1, 26, 102, 31417 }, // ӟ
-    { 19, 25, 20, 0, 24, 119, 31519 }, // Ӡ
-    { 19, 27, 19, 0, 19, 129, 31638 }, // ӡ
-    { 21, 30, 26, 3, 30, 158, 31767 }, // Ӣ
-    { 18, 24, 22, 2, 24, 108, 31925 }, // ӣ
-    { 21, 32, 26, 3, 32, 168, 32033 }, // Ӥ
-    { 18, 26, 22, 2, 26, 117, 32201 }, // ӥ
-    { 24, 33, 26, 1, 32, 198, 32318 }, // Ӧ
-    { 19, 27, 21, 1, 26, 129, 32516 }, // ӧ
-    { 24, 26, 26, 1, 25, 156, 32645 }, // Ө
-    { 19, 20, 21, 1, 19, 95, 32801 }, // ө
-    { 24, 33, 26, 1, 32, 198, 32896 }, // Ӫ
-    { 19, 27, 21, 1, 26, 129, 33094 }, // ӫ
-    { 19, 33, 22, 1, 32, 157, 33223 }, // Ӭ
-    { 16, 27, 17, 1, 26, 108, 33380 }, // ӭ
-    { 22, 31, 22, 0, 30, 171, 33488 }, // Ӯ
-    { 21, 32, 19, -1, 24, 168, 33659 }, // ӯ
-    { 22, 33, 22, 0, 32, 182, 33827 }, // Ӱ
-    { 21, 34, 19, -1, 26, 179, 34009 }, // ӱ
-    { 22, 33, 22, 0, 32, 182, 34188 }, // Ӳ
-    { 20, 34, 19, 0, 26, 170, 34370 }, // ӳ
-    { 19, 32, 24, 2, 32, 152, 34540 }, // Ӵ
-    { 17, 26, 21, 2, 26, 111, 34692 }, // ӵ
-    { 16, 31, 19, 3, 24, 124, 34803 }, // Ӷ
-    { 14, 26, 16, 2, 19, 91, 34927 }, // ӷ
-    { 25, 32, 31, 3, 32, 200, 35018 }, // Ӹ
-    { 24, 26, 28, 2, 26, 156, 35218 }, // ӹ
-    { 18, 33, 19, 0, 24, 149, 35374 }, // Ӻ
-    { 16, 27, 16, 0, 19, 108, 35523 }, // ӻ
-    { 24, 33, 24, 0, 24, 198, 35631 }, // Ӽ
-    { 21, 27, 22, 0, 19, 142, 35829 }, // ӽ
-    { 23, 24, 22, 0, 24, 138, 35971 }, // Ӿ
-    { 20, 19, 19, 0, 19, 95, 36109 }, // ӿ
-    { 0, 0, 17, 0, 0, 0, 0 }, //  
-    { 0, 0, 33, 0, 0, 0, 0 }, //  
-    { 0, 0, 17, 0, 0, 0, 0 }, //  
-    { 0, 0, 33, 0, 0, 0, 0 }, //  
-    { 0, 0, 11, 0, 0, 0, 0 }, //  
-    { 0, 0, 8, 0, 0, 0, 0 }, //  
-    { 0, 0, 6, 0, 0, 0, 0 }, //  
-    { 0, 0, 19, 0, 0, 0, 0 }, //  
-    { 0, 0, 9, 0, 0, 0, 0 }, //  
-    { 0, 0, 6, 0, 0, 0, 0 }, //  
-    { 0, 0, 3, 0, 0, 0, 0 }, //  
-    { 0, 0, 0, 0, 0, 0, 0 }, // ​
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‍
-    { 9, 28, 0, -1, 23, 63, 0 }, // ‎
-    { 9, 28, 0, -8, 23, 63, 63 }, // ‏
-    { 10, 5, 11, 0, 11, 13, 126 }, // ‐
-    { 10, 5, 11, 0, 11, 13, 139 }, // ‑
-    { 17, 5, 19, 1, 14, 22, 152 }, // ‒
-    { 15, 4, 17, 1, 11, 15, 174 }, // –
-    { 32, 4, 33, 1, 11, 32, 189 }, // —
-    { 32, 4, 33, 1, 11, 32, 221 }, // ―
-    { 13, 34, 18, 3, 26, 111, 253 }, // ‖
-    { 15, 8, 14, -1, 0, 30, 364 }, // ‗
-    { 7, 9, 7, 0, 24, 16, 394 }, // ‘
-    { 7, 9, 7, 0, 24, 16, 410 }, // ’
-    { 8, 9, 10, 0, 5, 18, 426 }, // ‚
-    { 7, 9, 7, 0, 24, 16, 444 }, // ‛
-    { 15, 9, 15, 0, 24, 34, 460 }, // “
-    { 15, 9, 15, 0, 24, 34, 494 }, // ”
-    { 15, 9, 17, 1, 4, 34, 528 }, // „
-    { 15, 9, 15, 0, 24, 34, 562 }, // ‟
-    { 15, 26, 17, 1, 26, 98, 596 }, // †
-    { 15, 26, 17, 1, 26, 98, 694 }, // ‡
-    { 10, 11, 13, 1, 18, 28, 792 }, // •
-    { 12, 13, 13, 1, 19, 39, 820 }, // ‣
-    { 7, 7, 17, 5, 6, 13, 859 }, // ․
-    { 17, 7, 19, 1, 6, 30, 872 }, // ‥
-    { 26, 7, 29, 1, 6, 46, 902 }, // …
-    { 7, 7, 9, 1, 12, 13, 948 }, // ‧
-    { 0, 0, 20, 0, 0, 0, 961 }, //  
-    { 0, 0, 20, 0, 0, 0, 961 }, //  
-    { 9, 26, 0, -1, 21, 59, 961 }, // ‪
-    { 9, 26, 0, -8, 21, 59, 1020 }, // ‫
-    { 8, 28, 0, -4, 23, 56, 1079 }, // ‬
-    { 8, 28, 0, -4, 23, 56, 1135 }, // ‭
-    { 8, 28, 0, -4, 23, 56, 1191 }, // ‮
-    { 0, 0, 6, 0, 0, 0, 1247 }, //  
-    { 41, 26, 43, 1, 25, 267, 1247 }, // ‰
-    { 55, 26, 56, 0, 25, 358, 1514 }, // ‱
-    { 10, 9, 10, 1, 24, 23, 1872 }, // ′
-    { 17, 9, 17, 1, 24, 39, 1895 }, // ″
-    { 25, 9, 25, 1, 24, 57, 1934 }, // ‴
-    { 10, 9, 14, 1, 24, 23, 1991 }, // ‵
-    { 17, 9, 21, 1, 24, 39, 2014 }, // ‶
-    { 25, 9, 29, 1, 24, 57, 2053 }, // ‷
-    { 13, 11, 14, 0, 3, 36, 2110 }, // ‸
-    { 10, 16, 12, 1, 17, 40, 2146 }, // ‹
-    { 10, 16, 12, 1, 17, 40, 2186 }, // ›
-    { 26, 26, 28, 1, 25, 169, 2226 }, // ※
-    { 17, 25, 19, 1, 24, 107, 2395 }, // ‼
-    { 16, 26, 16, 0, 25, 104, 2502 }, // ‽
-    { 18, 4, 17, -1, 29, 18, 2606 }, // ‾
-    { 20, 8, 20, 0, 0, 40, 2624 }, // ‿
-    { 20, 8, 20, 0, 27, 40, 2664 }, // ⁀
-    { 14, 22, 14, 0, 14, 77, 2704 }, // ⁁
-    { 37, 31, 37, 0, 26, 287, 2781 }, // ⁂
-    { 10, 5, 11, 1, 11, 13, 3068 }, // ⁃
-    { 18, 24, 4, -7, 24, 108, 3081 }, // ⁄
-    { 9, 30, 11, 2, 24, 68, 3189 }, // ⁅
-    { 9, 30, 11, 0, 24, 68, 3257 }, // ⁆
-    { 31, 26, 32, 0, 25, 202, 3325 }, // ⁇
-    { 24, 26, 25, 0, 25, 156, 3527 }, // ⁈
-    { 24, 26, 25, 1, 25, 156, 3683 }, // ⁉
-    { 17, 19, 20, 1, 19, 81, 3839 }, // ⁊
-    { 18, 31, 22, 2, 26, 140, 3920 }, // ⁋
-    { 18, 18, 22, 1, 19, 81, 4060 }, // ⁌
-    { 19, 18, 22, 2, 19, 86, 4141 }, // ⁍
-    { 18, 17, 18, 0, 9, 77, 4227 }, // ⁎
-    { 8, 24, 10, 1, 19, 48, 4304 }, // ⁏
-    { 20, 35, 20, 0, 27, 175, 4352 }, // ⁐
-    { 18, 34, 18, 0, 26, 153, 4527 }, // ⁑
-    { 14, 26, 14, 0, 25, 91, 4680 }, // ⁒
-    { 32, 7, 33, 1, 13, 56, 4771 }, // ⁓
-    { 20, 8, 20, 0, 0, 40, 4827 }, // ⁔
-    { 17, 17, 19, 1, 17, 73, 4867 }, // ⁕
-    { 17, 26, 19, 1, 25, 111, 4940 }, // ⁖
-    { 31, 9, 31, 1, 24, 70, 5051 }, // ⁗
-    { 27, 26, 29, 1, 25, 176, 5121 }, // ⁘
-    { 27, 26, 29, 1, 25, 176, 5297 }, // ⁙
-    { 7, 26, 10, 1, 25, 46, 5473 }, // ⁚
-    { 21, 28, 23, 1, 27, 147, 5519 }, // ⁛
-    { 27, 27, 28, 1, 25, 183, 5666 }, // ⁜
-    { 7, 27, 9, 1, 26, 48, 5849 }, // ⁝
-    { 7, 26, 10, 1, 25, 46, 5897 }, // ⁞
-    { 0, 0, 7, 0, 0, 0, 5943 }, //  
-    { 0, 0, 20, 0, 0, 0, 5943 }, // ⁠
-    { 0, 0, 20, 0, 0, 0, 5943 }, // ⁡
-    { 0, 0, 20, 0, 0, 0, 5943 }, // ⁢
-    { 0, 0, 20, 0, 0, 0, 5943 }, // ⁣
-    { 0, 0, 20, 0, 0, 0, 5943 }, // ⁤
-    { 0, 0, 0, 0, 0, 0, 5943 }, // ⁦
-    { 0, 0, 0, 0, 0, 0, 5943 }, // ⁧
-    { 0, 0, 0, 0, 0, 0, 5943 }, // ⁨
-    { 0, 0, 0, 0, 0, 0, 5943 }, // ⁩
-    { 8, 28, 0, -4, 23, 56, 5943 }, // ⁪
-    { 8, 28, 0, -4, 23, 56, 5999 }, // ⁫
-    { 8, 28, 0, -4, 23, 56, 6055 }, // ⁬
-    { 8, 29, 0, -4, 24, 58, 6111 }, // ⁭
-    { 8, 28, 0, -4, 23, 56, 6169 }, // ⁮
-    { 8, 28, 0, -4, 23, 56, 6225 }, // ⁯
-    { 12, 16, 13, 0, 29, 48, 0 }, // ⁰
-    { 5, 16, 6, 1, 25, 20, 48 }, // ⁱ
-    { 13, 16, 13, 0, 29, 52, 68 }, // ⁴
-    { 11, 16, 13, 1, 29, 44, 120 }, // ⁵
-    { 12, 16, 13, 0, 29, 48, 164 }, // ⁶
-    { 12, 16, 13, 0, 29, 48, 212 }, // ⁷
-    { 12, 16, 13, 0, 29, 48, 260 }, // ⁸
-    { 12, 16, 13, 0, 29, 48, 308 }, // ⁹
-    { 10, 10, 12, 1, 25, 25, 356 }, // ⁺
-    { 10, 4, 12, 1, 22, 10, 381 }, // ⁻
-    { 10, 7, 12, 1, 23, 18, 391 }, // ⁼
-    { 6, 20, 8, 2, 31, 30, 409 }, // ⁽
-    { 6, 20, 8, 0, 31, 30, 439 }, // ⁾
-    { 12, 12, 14, 1, 21, 36, 469 }, // ⁿ
-    { 12, 16, 13, 0, 11, 48, 505 }, // ₀
-    { 9, 16, 13, 1, 11, 36, 553 }, // ₁
-    { 12, 16, 13, 0, 11, 48, 589 }, // ₂
-    { 12, 16, 13, 0, 11, 48, 637 }, // ₃
-    { 13, 16, 13, 0, 11, 52, 685 }, // ₄
-    { 11, 16, 13, 1, 11, 44, 737 }, // ₅
-    { 12, 16, 13, 0, 11, 48, 781 }, // ₆
-    { 12, 16, 13, 0, 11, 48, 829 }, // ₇
-    { 12, 16, 13, 0, 11, 48, 877 }, // ₈
-    { 12, 16, 13, 0, 11, 48, 925 }, // ₉
-    { 10, 10, 12, 1, 8, 25, 973 }, // ₊
-    { 10, 4, 12, 1, 5, 10, 998 }, // ₋
-    { 10, 7, 12, 1, 6, 18, 1008 }, // ₌
-    { 6, 20, 8, 2, 13, 30, 1026 }, // ₍
-    { 6, 20, 8, 0, 13, 30, 1056 }, // ₎
-    { 12, 12, 13, 0, 8, 36, 1086 }, // ₐ
-    { 11, 12, 13, 1, 8, 33, 1122 }, // ₑ
-    { 12, 12, 14, 1, 8, 36, 1155 }, // ₒ
-    { 13, 12, 13, 0, 8, 39, 1191 }, // ₓ
-    { 12, 12, 13, 0, 8, 36, 1230 }, // ₔ
-    { 12, 16, 14, 1, 12, 48, 1266 }, // ₕ
-    { 13, 16, 13, 1, 12, 52, 1314 }, // ₖ
-    { 4, 16, 6, 1, 12, 16, 1366 }, // ₗ
-    { 19, 12, 21, 1, 8, 57, 1382 }, // ₘ
-    { 12, 12, 14, 1, 8, 36, 1439 }, // ₙ
-    { 12, 16, 14, 1, 8, 48, 1475 }, // ₚ
-    { 10, 12, 11, 0, 8, 30, 1523 }, // ₛ
-    { 9, 15, 9, 0, 11, 34, 1553 }, // ₜ
-    { 19, 25, 19, 0, 25, 119, 0 }, // ₠
-    { 19, 28, 20, 1, 26, 133, 119 }, // ₡
-    { 18, 26, 19, 1, 25, 117, 252 }, // ₢
-    { 18, 24, 19, 0, 24, 108, 369 }, // ₣
-    { 18, 25, 19, 1, 25, 113, 477 }, // ₤
-    { 29, 27, 33, 2, 23, 196, 590 }, // ₥
-    { 19, 24, 19, 0, 24, 114, 786 }, // ₦
-    { 27, 25, 30, 2, 24, 169, 900 }, // ₧
-    { 28, 25, 31, 2, 24, 175, 1069 }, // ₨
-    { 25, 24, 25, 0, 24, 150, 1244 }, // ₩
-    { 26, 24, 31, 2, 24, 156, 1394 }, // ₪
-    { 21, 32, 22, 1, 26, 168, 1550 }, // ₫
-    { 18, 25, 19, 1, 24, 113, 1718 }, // €
-    { 20, 24, 19, 0, 24, 120, 1831 }, // ₭
-    { 19, 24, 19, 0, 24, 114, 1951 }, // ₮
-    { 33, 33, 34, 0, 25, 273, 2065 }, // ₯
-    { 19, 33, 20, 0, 25, 157, 2338 }, // ₰
-    { 19, 24, 19, 0, 24, 114, 2495 }, // ₱
-    { 21, 29, 24, 1, 26, 153, 2609 }, // ₲
-    { 22, 24, 22, 0, 24, 132, 2762 }, // ₳
-    { 19, 26, 19, 0, 25, 124, 2894 }, // ₴
-    { 20, 29, 21, 1, 26, 145, 3018 }, // ₵
-    { 23, 24, 23, 0, 23, 138, 3163 }, // ₶
-    { 24, 28, 24, 0, 25, 168, 3301 }, // ₷
-    { 19, 24, 19, 0, 24, 114, 3469 }, // ₸
-    { 16, 24, 19, 2, 24, 96, 3583 }, // ₹
-    { 19, 25, 19, 0, 24, 119, 3679 }, // ₺
-    { 27, 26, 27, 0, 25, 176, 3798 }, // ₻
-    { 27, 24, 29, 1, 24, 162, 3974 }, // ₼
-    { 20, 24, 20, 0, 24, 120, 4136 }, // ₽
-    { 24, 26, 26, 1, 26, 156, 4256 }, // ₾
-    { 15, 32, 19, 3, 28, 120, 4412 }, // ₿
-    { 16, 25, 17, 1, 19, 100, 4532 }, // ⃀
-    { 17, 5, 19, 1, 14, 22, 0 }, // −
-    { 31, 32, 33, 1, 26, 248, 0 }, // �
+    { 19, 16, 20, 1, 17, 76, 9076 }, // «
+    { 17, 10, 19, 1, 14, 43, 792 }, // ¬
+    { 10, 5, 11, 0, 11, 13, 835 }, // ­
+    { 26, 26, 28, 1, 25, 169, 848 }, // ®
+    { 18, 4, 17, -1, 29, 18, 1017 }, // ¯
+    { 12, 13, 14, 1, 25, 39, 1035 }, // °
+    { 17, 21, 19, 1, 21, 90, 1074 }, // ±
+    { 12, 16, 13, 0, 29, 48, 1164 }, // ²
+    { 12, 16, 13, 0, 29, 48, 1212 }, // ³
+    { 10, 6, 12, 1, 26, 15, 1260 }, // ´
+    { 18, 27, 22, 2, 19, 122, 1275 }, // µ
+    { 18, 31, 22, 1, 26, 140, 1397 }, // ¶
+    { 7, 7, 9, 1, 15, 13, 1537 }, // ·
+    { 9, 8, 9, 0, 0, 18, 1550 }, // ¸
+    { 9, 16, 13, 1, 29, 36, 1568 }, // ¹
+    { 12, 13, 13, 0, 25, 39, 1604 }, // º
+    { 19, 16, 20, 1, 17, 76, 9152 }, // »
+    { 28, 24, 28, 0, 24, 168, 1643 }, // ¼
+    { 28, 24, 29, 0, 24, 168, 1811 }, // ½
+    { 27, 25, 28, 1, 25, 169, 1979 }, // ¾
+    { 16, 25, 16, 0, 19, 100, 2148 }, // ¿
+    { 24, 32, 23, 0, 32, 192, 9228 }, // À
+    { 24, 32, 23, 0, 32, 192, 9420 }, // Á
+    { 24, 32, 23, 0, 32, 192, 9612 }, // Â
+    { 24, 32, 23, 0, 32, 192, 2248 }, // Ã
+    { 24, 32, 23, 0, 32, 192, 9804 }, // Ä
+    { 24, 29, 23, 0, 29, 174, 2440 }, // Å
+    { 30, 24, 32, 0, 24, 180, 2614 }, // Æ
+    { 20, 33, 21, 1, 25, 165, 9996 }, // Ç
+    { 14, 32, 19, 3, 32, 112, 10161 }, // È
+    { 14, 32, 19, 3, 32, 112, 10273 }, // É
+    { 14, 32, 19, 3, 32, 112, 10385 }, // Ê
+    { 14, 32, 19, 3, 32, 112, 10497 }, // Ë
+    { 12, 32, 13, 0, 32, 96, 10609 }, // Ì
+    { 12, 32, 13, 1, 32, 96, 10705 }, // Í
+    { 15, 32, 13, -1, 32, 120, 10801 }, // Î
+    { 13, 32, 13, 0, 32, 104, 10921 }, // Ï
+    { 23, 24, 24, 0, 24, 138, 2794 }, // Ð
+    { 22, 32, 27, 3, 32, 176, 11025 }, // Ñ
+    { 24, 33, 26, 1, 32, 198, 11201 }, // Ò
+    { 24, 33, 26, 1, 32, 198, 11399 }, // Ó
+    { 24, 33, 26, 1, 32, 198, 11597 }, // Ô
+    { 24, 33, 26, 1, 32, 198, 2932 }, // Õ
+    { 24, 33, 26, 1, 32, 198, 11795 }, // Ö
+    { 15, 16, 19, 2, 20, 60, 3130 }, // ×
+    { 24, 28, 26, 1, 26, 168, 3190 }, // Ø
+    { 21, 33, 25, 2, 32, 174, 11993 }, // Ù
+    { 21, 33, 25, 2, 32, 174, 12167 }, // Ú
+    { 21, 33, 25, 2, 32, 174, 12341 }, // Û
+    { 21, 33, 25, 2, 32, 174, 12515 }, // Ü
+    { 21, 32, 21, 0, 32, 168, 3358 }, // Ý
+    { 17, 24, 21, 3, 24, 102, 3526 }, // Þ
+    { 21, 27, 23, 2, 26, 142, 3628 }, // ß
+    { 17, 27, 20, 1, 26, 115, 12689 }, // à
+    { 17, 27, 20, 1, 26, 115, 12804 }, // á
+    { 17, 27, 20, 1, 26, 115, 12919 }, // â
+    { 17, 27, 20, 1, 26, 115, 3770 }, // ã
+    { 17, 27, 20, 1, 26, 115, 13034 }, // ä
+    { 17, 29, 20, 1, 28, 124, 3885 }, // å
+    { 29, 20, 31, 1, 19, 145, 4009 }, // æ
+    { 16, 27, 17, 1, 19, 108, 13149 }, // ç
+    { 18, 27, 20, 1, 26, 122, 13257 }, // è
+    { 18, 27, 20, 1, 26, 122, 13379 }, // é
+    { 18, 27, 20, 1, 26, 122, 13501 }, // ê
+    { 18, 27, 20, 1, 26, 122, 13623 }, // ë
+    { 11, 26, 10, -1, 26, 72, 13745 }, // ì
+    { 10, 26, 10, 2, 26, 65, 13817 }, // í
+    { 14, 26, 10, -2, 26, 91, 13882 }, // î
+    { 12, 26, 10, -1, 26, 78, 13973 }, // ï
+    { 19, 27, 21, 1, 26, 129, 4154 }, // ð
+    { 18, 26, 22, 2, 26, 117, 14051 }, // ñ
+    { 19, 27, 21, 1, 26, 129, 14168 }, // ò
+    { 19, 27, 21, 1, 26, 129, 14297 }, // ó
+    { 19, 27, 21, 1, 26, 129, 14426 }, // ô
+    { 19, 27, 21, 1, 26, 129, 4283 }, // õ
+    { 19, 27, 21, 1, 26, 129, 14555 }, // ö
+    { 17, 17, 19, 1, 20, 73, 4412 }, // ÷
+    { 19, 22, 21, 1, 20, 105, 4485 }, // ø
+    { 18, 27, 22, 2, 26, 122, 14684 }, // ù
+    { 18, 27, 22, 2, 26, 122, 14806 }, // ú
+    { 18, 27, 22, 2, 26, 122, 14928 }, // û
+    { 18, 27, 22, 2, 26, 122, 15050 }, // ü
+    { 20, 34, 19, 0, 26, 170, 4590 }, // ý
+    { 18, 34, 21, 2, 26, 153, 4760 }, // þ
+    { 20, 34, 19, 0, 26, 170, 4913 }, // ÿ
+    { 24, 30, 23, 0, 30, 180, 5083 }, // Ā
+    { 17, 25, 20, 1, 24, 107, 5263 }, // ā
+    { 24, 32, 23, 0, 32, 192, 5370 }, // Ă
+    { 17, 27, 20, 1, 26, 115, 5562 }, // ă
+    { 24, 32, 23, 0, 24, 192, 5677 }, // Ą
+    { 17, 27, 20, 1, 19, 115, 5869 }, // ą
+    { 20, 33, 21, 1, 32, 165, 5984 }, // Ć
+    { 16, 27, 17, 1, 26, 108, 6149 }, // ć
+    { 20, 33, 21, 1, 32, 165, 6257 }, // Ĉ
+    { 16, 27, 17, 1, 26, 108, 6422 }, // ĉ
+    { 20, 33, 21, 1, 32, 165, 6530 }, // Ċ
+    { 16, 27, 17, 1, 26, 108, 6695 }, // ċ
+    { 20, 33, 21, 1, 32, 165, 6803 }, // Č
+    { 17, 27, 17, 1, 26, 115, 6968 }, // č
+    { 21, 32, 24, 2, 32, 168, 7083 }, // Ď
+    { 25, 27, 21, 1, 26, 169, 7251 }, // ď
+    { 23, 24, 24, 0, 24, 138, 7420 }, // Đ
+    { 21, 27, 22, 1, 26, 142, 7558 }, // đ
+    { 14, 30, 19, 3, 30, 105, 7700 }, // Ē
+    { 18, 25, 20, 1, 24, 113, 7805 }, // ē
+    { 14, 32, 19, 3, 32, 112, 7918 }, // Ĕ
+    { 18, 27, 20, 1, 26, 122, 8030 }, // ĕ
+    { 14, 32, 19, 3, 32, 112, 8152 }, // Ė
+    { 18, 27, 20, 1, 26, 122, 8264 }, // ė
+    { 14, 32, 19, 3, 24, 112, 8386 }, // Ę
+    { 18, 27, 20, 1, 19, 122, 8498 }, // ę
+    { 15, 32, 19, 3, 32, 120, 8620 }, // Ě
+    { 18, 27, 20, 1, 26, 122, 8740 }, // ě
+    { 21, 33, 24, 1, 32, 174, 8862 }, // Ĝ
+    { 18, 34, 21, 1, 26, 153, 9036 }, // ĝ
+    { 21, 33, 24, 1, 32, 174, 9189 }, // Ğ
+    { 18, 34, 21, 1, 26, 153, 9363 }, // ğ
+    { 21, 33, 24, 1, 32, 174, 9516 }, // Ġ
+    { 18, 34, 21, 1, 26, 153, 9690 }, // ġ
+    { 21, 33, 24, 1, 25, 174, 9843 }, // Ģ
+    { 18, 34, 21, 1, 26, 153, 10017 }, // ģ
+    { 20, 32, 26, 3, 32, 160, 10170 }, // Ĥ
+    { 22, 33, 22, -2, 33, 182, 10330 }, // ĥ
+    { 26, 24, 26, 0, 24, 156, 10512 }, // Ħ
+    { 20, 26, 22, 0, 26, 130, 10668 }, // ħ
+    { 15, 32, 13, -2, 32, 120, 10798 }, // Ĩ
+    { 14, 26, 10, -2, 26, 91, 10918 }, // ĩ
+    { 12, 30, 13, 0, 30, 90, 11009 }, // Ī
+    { 12, 24, 10, -1, 24, 72, 11099 }, // ī
+    { 14, 32, 13, 0, 32, 112, 11171 }, // Ĭ
+    { 14, 26, 10, -2, 26, 91, 11283 }, // ĭ
+    { 11, 32, 13, 1, 24, 88, 11374 }, // Į
+    { 7, 34, 10, 1, 26, 60, 11462 }, // į
+    { 11, 32, 13, 1, 32, 88, 11522 }, // İ
+    { 6, 19, 10, 2, 19, 29, 11610 }, // ı
+    { 21, 31, 24, 1, 24, 163, 11639 }, // Ĳ
+    { 16, 34, 20, 2, 26, 136, 11802 }, // ĳ
+    { 16, 39, 11, -3, 32, 156, 11938 }, // Ĵ
+    { 14, 34, 10, -2, 26, 119, 12094 }, // ĵ
+    { 20, 32, 22, 3, 24, 160, 12213 }, // Ķ
+    { 19, 34, 21, 2, 26, 162, 12373 }, // ķ
+    { 19, 19, 21, 2, 19, 91, 12535 }, // ĸ
+    { 16, 32, 19, 2, 32, 128, 12626 }, // Ĺ
+    { 10, 33, 10, 2, 33, 83, 12754 }, // ĺ
+    { 16, 32, 19, 2, 24, 128, 12837 }, // Ļ
+    { 6, 34, 10, 2, 26, 51, 12965 }, // ļ
+    { 17, 24, 19, 2, 24, 102, 13016 }, // Ľ
+    { 13, 26, 10, 2, 26, 85, 13118 }, // ľ
+    { 16, 24, 19, 2, 24, 96, 13203 }, // Ŀ
+    { 12, 26, 12, 2, 26, 78, 13299 }, // ŀ
+    { 18, 24, 19, 0, 24, 108, 13377 }, // Ł
+    { 12, 26, 10, -1, 26, 78, 13485 }, // ł
+    { 22, 32, 27, 3, 32, 176, 13563 }, // Ń
+    { 18, 26, 22, 2, 26, 117, 13739 }, // ń
+    { 22, 32, 27, 3, 24, 176, 13856 }, // Ņ
+    { 18, 27, 22, 2, 19, 122, 14032 }, // ņ
+    { 22, 32, 27, 3, 32, 176, 14154 }, // Ň
+    { 18, 26, 22, 2, 26, 117, 14330 }, // ň
+    { 25, 24, 26, -1, 24, 150, 14447 }, // ŉ
+    { 22, 31, 27, 3, 24, 171, 14597 }, // Ŋ
+    { 18, 27, 22, 2, 19, 122, 14768 }, // ŋ
+    { 24, 31, 26, 1, 30, 186, 14890 }, // Ō
+    { 19, 25, 21, 1, 24, 119, 15076 }, // ō
+    { 24, 33, 26, 1, 32, 198, 15195 }, // Ŏ
+    { 19, 27, 21, 1, 26, 129, 15393 }, // ŏ
+    { 24, 33, 26, 1, 32, 198, 15522 }, // Ő
+    { 19, 27, 21, 1, 26, 129, 15720 }, // ő
+    { 30, 26, 32, 1, 25, 195, 15172 }, // Œ
+    { 31, 20, 33, 1, 19, 155, 15367 }, // œ
+    { 20, 32, 22, 2, 32, 160, 15849 }, // Ŕ
+    { 14, 26, 15, 2, 26, 91, 16009 }, // ŕ
+    { 20, 32, 22, 2, 24, 160, 16100 }, // Ŗ
+    { 13, 27, 15, 2, 19, 88, 16260 }, // ŗ
+    { 20, 32, 22, 2, 32, 160, 16348 }, // Ř
+    { 15, 26, 15, 1, 26, 98, 16508 }, // ř
+    { 17, 33, 18, 1, 32, 141, 16606 }, // Ś
+    { 15, 27, 17, 1, 26, 102, 16747 }, // ś
+    { 17, 33, 18, 1, 32, 141, 16849 }, // Ŝ
+    { 15, 27, 17, 1, 26, 102, 16990 }, // ŝ
+    { 17, 33, 18, 1, 25, 141, 17092 }, // Ş
+    { 15, 27, 17, 1, 19, 102, 17233 }, // ş
+    { 17, 33, 18, 1, 32, 141, 17335 }, // Š
+    { 15, 27, 17, 1, 26, 102, 17476 }, // š
+    { 19, 32, 19, 0, 24, 152, 17578 }, // Ţ
+    { 14, 31, 14, 0, 23, 109, 17730 }, // ţ
+    { 19, 32, 19, 0, 32, 152, 17839 }, // Ť
+    { 19, 27, 14, 0, 26, 129, 17991 }, // ť
+    { 19, 24, 19, 0, 24, 114, 18120 }, // Ŧ
+    { 14, 24, 14, 0, 23, 84, 18234 }, // ŧ
+    { 21, 33, 25, 2, 32, 174, 18318 }, // Ũ
+    { 18, 27, 22, 2, 26, 122, 18492 }, // ũ
+    { 21, 31, 25, 2, 30, 163, 18614 }, // Ū
+    { 18, 25, 22, 2, 24, 113, 18777 }, // ū
+    { 21, 33, 25, 2, 32, 174, 18890 }, // Ŭ
+    { 18, 27, 22, 2, 26, 122, 19064 }, // ŭ
+    { 21, 35, 25, 2, 34, 184, 19186 }, // Ů
+    { 18, 29, 22, 2, 28, 131, 19370 }, // ů
+    { 21, 33, 25, 2, 32, 174, 19501 }, // Ű
+    { 18, 27, 22, 2, 26, 122, 19675 }, // ű
+    { 21, 32, 25, 2, 24, 168, 19797 }, // Ų
+    { 18, 27, 22, 2, 19, 122, 19965 }, // ų
+    { 33, 32, 32, 0, 32, 264, 20087 }, // Ŵ
+    { 29, 26, 29, 0, 26, 189, 20351 }, // ŵ
+    { 21, 32, 21, 0, 32, 168, 20540 }, // Ŷ
+    { 20, 34, 19, 0, 26, 170, 20708 }, // ŷ
+    { 21, 32, 21, 0, 32, 168, 20878 }, // Ÿ
+    { 19, 32, 19, 0, 32, 152, 21046 }, // Ź
+    { 15, 26, 16, 1, 26, 98, 21198 }, // ź
+    { 19, 32, 19, 0, 32, 152, 21296 }, // Ż
+    { 15, 26, 16, 1, 26, 98, 21448 }, // ż
+    { 19, 32, 19, 0, 32, 152, 21546 }, // Ž
+    { 15, 26, 16, 1, 26, 98, 21698 }, // ž
+    { 12, 26, 13, 2, 26, 78, 21796 }, // ſ
+    { 10, 6, 0, -18, 26, 15, 21874 }, // ̀
+    { 11, 6, 0, -13, 26, 17, 21889 }, // ́
+    { 14, 6, 0, -7, 26, 21, 21906 }, // ̂
+    { 15, 6, 0, -19, 26, 23, 21927 }, // ̃
+    { 12, 4, 0, -6, 24, 12, 21950 }, // ̄
+    { 14, 5, 0, -7, 29, 18, 21962 }, // ̅
+    { 14, 6, 0, -7, 26, 21, 21980 }, // ̆
+    { 6, 6, 0, -3, 26, 9, 22001 }, // ̇
+    { 12, 6, 0, -6, 26, 18, 22010 }, // ̈
+    { 8, 9, 0, -14, 28, 18, 22028 }, // ̉
+    { 9, 8, 0, -5, 28, 18, 22046 }, // ̊
+    { 16, 6, 0, -6, 26, 24, 22064 }, // ̋
+    { 15, 6, 0, -7, 26, 23, 22088 }, // ̌
+    { 4, 7, 0, -2, 26, 7, 22111 }, // ̍
+    { 10, 7, 0, -5, 26, 18, 22118 }, // ̎
+    { 14, 6, 0, -19, 26, 21, 22136 }, // ̏
+    { 12, 9, 0, -6, 29, 27, 22157 }, // ̐
+    { 14, 6, 0, -7, 26, 21, 22184 }, // ̑
+    { 8, 9, 0, -4, 24, 18, 22205 }, // ̒
+    { 8, 9, 0, -4, 24, 18, 22223 }, // ̓
+    { 8, 9, 0, -4, 24, 18, 22241 }, // ̔
+    { 8, 9, 0, -4, 24, 18, 22259 }, // ̕
+    { 11, 6, 0, -6, -1, 17, 22277 }, // ̖
+    { 10, 6, 0, -5, -1, 15, 22294 }, // ̗
+    { 6, 8, 0, -3, 0, 12, 22309 }, // ̘
+    { 6, 8, 0, -3, 0, 12, 22321 }, // ̙
+    { 9, 9, 10, 0, 26, 21, 22333 }, // ̚
+    { 9, 9, 0, -4, 26, 21, 22354 }, // ̛
+    { 5, 8, 0, -3, 0, 10, 22375 }, // ̜
+    { 8, 6, 0, -4, -1, 12, 22385 }, // ̝
+    { 8, 6, 0, -4, -1, 12, 22397 }, // ̞
+    { 8, 8, 0, -4, 0, 16, 22409 }, // ̟
+    { 8, 3, 0, -4, -3, 6, 22425 }, // ̠
+    { 8, 10, 0, -8, 2, 20, 22431 }, // ̡
+    { 8, 10, 0, 0, 2, 20, 22451 }, // ̢
+    { 7, 6, 0, -15, -2, 11, 22471 }, // ̣
+    { 12, 6, 0, -6, -1, 18, 22482 }, // ̤
+    { 9, 8, 0, -5, 0, 18, 22500 }, // ̥
+    { 6, 6, 0, -3, -2, 9, 22518 }, // ̦
+    { 8, 8, 0, -4, 0, 16, 22527 }, // ̧
+    { 8, 9, 0, -4, 1, 18, 22543 }, // ̨
+    { 4, 7, 0, -2, -1, 7, 22561 }, // ̩
+    { 12, 7, 0, -6, -1, 21, 22568 }, // ̪
+    { 14, 4, 0, -7, -2, 14, 22589 }, // ̫
+    { 15, 6, 0, -7, -1, 23, 22603 }, // ̬
+    { 14, 6, 0, -7, -1, 21, 22626 }, // ̭
+    { 14, 6, 0, -7, -1, 21, 22647 }, // ̮
+    { 14, 6, 0, -7, -1, 21, 22668 }, // ̯
+    { 14, 6, 0, -7, -1, 21, 22689 }, // ̰
+    { 12, 4, 0, -6, -2, 12, 22710 }, // ̱
+    { 16, 3, 0, -8, -3, 12, 22722 }, // ̲
+    { 15, 8, 0, -8, 0, 30, 22734 }, // ̳
+    { 15, 6, 0, -7, 13, 23, 22764 }, // ̴
+    { 14, 5, 0, -7, 12, 18, 22787 }, // ̵
+    { 26, 4, 0, -13, 11, 26, 22805 }, // ̶
+    { 12, 10, 0, -6, 14, 30, 22831 }, // ̷
+    { 14, 28, 0, -7, 26, 98, 22861 }, // ̸
+    { 5, 8, 0, -2, 0, 10, 22959 }, // ̹
+    { 12, 7, 0, -6, -1, 21, 22969 }, // ̺
+    { 14, 8, 0, -7, 0, 28, 22990 }, // ̻
+    { 14, 4, 0, -7, -2, 14, 23018 }, // ̼
+    { 8, 7, 0, -4, 26, 14, 23032 }, // ̽
+    { 6, 10, 0, -3, 29, 15, 23046 }, // ̾
+    { 14, 8, 0, -8, 33, 28, 23061 }, // ̿
+    { 11, 6, 0, -8, 26, 17, 23089 }, // ̀
+    { 10, 6, 0, -2, 26, 15, 23106 }, // ́
+    { 14, 6, 0, -7, 26, 21, 23121 }, // ͂
+    { 7, 7, 0, -4, 26, 13, 23142 }, // ̓
+    { 18, 6, 0, -7, 26, 27, 23155 }, // ̈́
+    { 7, 7, 0, -2, -1, 13, 23182 }, // ͅ
+    { 16, 7, 0, -8, 26, 28, 23195 }, // ͆
+    { 14, 8, 0, -8, 0, 28, 23223 }, // ͇
+    { 10, 7, 0, -5, -1, 18, 23251 }, // ͈
+    { 8, 6, 0, -4, -2, 12, 23269 }, // ͉
+    { 14, 8, 0, -7, 26, 28, 23281 }, // ͊
+    { 14, 14, 0, -7, 32, 49, 23309 }, // ͋
+    { 12, 9, 0, -6, 29, 27, 23358 }, // ͌
+    { 12, 7, 0, -6, -1, 21, 23385 }, // ͍
+    { 8, 8, 0, -4, 0, 16, 23406 }, // ͎
+    { 24, 24, 0, -12, 24, 144, 23422 }, // ͏
+    { 6, 8, 0, -3, 27, 12, 23566 }, // ͐
+    { 5, 8, 0, -2, 27, 10, 23578 }, // ͑
+    { 12, 9, 0, -6, 29, 27, 23588 }, // ͒
+    { 8, 7, 0, -4, -1, 14, 23615 }, // ͓
+    { 6, 7, 0, -3, -1, 11, 23629 }, // ͔
+    { 6, 7, 0, -3, -1, 11, 23640 }, // ͕
+    { 14, 7, 0, -7, -1, 25, 23651 }, // ͖
+    { 5, 8, 0, -2, 27, 10, 23676 }, // ͗
+    { 6, 6, 0, 3, 26, 9, 23686 }, // ͘
+    { 8, 7, 0, -4, -1, 14, 23695 }, // ͙
+    { 14, 8, 0, -7, 0, 28, 23709 }, // ͚
+    { 8, 8, 0, -4, 27, 16, 23737 }, // ͛
+    { 28, 7, 0, -14, -1, 49, 23753 }, // ͜
+    { 28, 7, 0, -14, 26, 49, 23802 }, // ͝
+    { 20, 3, 0, -10, 23, 15, 23851 }, // ͞
+    { 20, 3, 0, -10, -2, 15, 23866 }, // ͟
+    { 28, 6, 0, -14, 26, 42, 23881 }, // ͠
+    { 28, 8, 0, -14, 30, 56, 23923 }, // ͡
+    { 27, 8, 0, -13, 0, 54, 23979 }, // ͢
+    { 8, 9, 0, -4, 29, 18, 24033 }, // ͣ
+    { 9, 9, 0, -4, 29, 21, 24051 }, // ͤ
+    { 3, 11, 0, -1, 31, 9, 24072 }, // ͥ
+    { 9, 9, 0, -4, 29, 21, 24081 }, // ͦ
+    { 9, 8, 0, -4, 28, 18, 24102 }, // ͧ
+    { 7, 9, 0, -3, 29, 16, 24120 }, // ͨ
+    { 8, 11, 0, -4, 31, 22, 24136 }, // ͩ
+    { 9, 11, 0, -4, 31, 25, 24158 }, // ͪ
+    { 13, 9, 0, -6, 29, 30, 24183 }, // ͫ
+    { 6, 9, 0, -2, 29, 14, 24213 }, // ͬ
+    { 7, 10, 0, -3, 30, 18, 24227 }, // ͭ
+    { 9, 8, 0, -4, 28, 18, 24245 }, // ͮ
+    { 10, 8, 0, -5, 28, 20, 24263 }, // ͯ
+    { 15, 32, 19, 2, 32, 120, 24283 }, // Ѐ
+    { 15, 32, 19, 2, 32, 120, 0 }, // Ё
+    { 25, 25, 26, 0, 24, 157, 24403 }, // Ђ
+    { 15, 32, 19, 3, 32, 120, 24560 }, // Ѓ
+    { 20, 26, 22, 1, 25, 130, 24680 }, // Є
+    { 16, 26, 18, 1, 25, 104, 24810 }, // Ѕ
+    { 6, 24, 11, 2, 24, 36, 24914 }, // І
+    { 11, 32, 11, 0, 32, 88, 24950 }, // Ї
+    { 12, 31, 11, -3, 24, 93, 25038 }, // Ј
+    { 33, 25, 34, 0, 24, 207, 25131 }, // Љ
+    { 31, 24, 35, 3, 24, 186, 25338 }, // Њ
+    { 24, 24, 26, 0, 24, 144, 25524 }, // Ћ
+    { 20, 32, 23, 3, 32, 160, 25668 }, // Ќ
+    { 21, 32, 26, 3, 32, 168, 25828 }, // Ѝ
+    { 22, 33, 22, 0, 32, 182, 25996 }, // Ў
+    { 20, 29, 26, 3, 24, 145, 26178 }, // Џ
+    { 24, 24, 23, 0, 24, 144, 120 }, // А
+    { 18, 24, 22, 3, 24, 108, 264 }, // Б
+    { 19, 24, 22, 2, 24, 114, 372 }, // В
+    { 15, 24, 19, 3, 24, 90, 486 }, // Г
+    { 26, 29, 26, 0, 24, 189, 576 }, // Д
+    { 15, 24, 19, 2, 24, 90, 765 }, // Е
+    { 33, 24, 33, 0, 24, 198, 855 }, // Ж
+    { 17, 26, 20, 1, 25, 111, 1053 }, // З
+    { 21, 24, 26, 3, 24, 126, 1164 }, // И
+    { 21, 32, 26, 3, 32, 168, 1290 }, // Й
+    { 20, 24, 23, 3, 24, 120, 1458 }, // К
+    { 22, 25, 24, 0, 24, 138, 1578 }, // Л
+    { 26, 24, 31, 3, 24, 156, 1716 }, // М
+    { 20, 24, 26, 3, 24, 120, 1872 }, // Н
+    { 24, 26, 26, 1, 25, 156, 1992 }, // О
+    { 20, 24, 25, 3, 24, 120, 2148 }, // П
+    { 18, 24, 21, 2, 24, 108, 2268 }, // Р
+    { 20, 26, 22, 1, 25, 130, 2376 }, // С
+    { 19, 24, 19, 0, 24, 114, 2506 }, // Т
+    { 22, 25, 22, 0, 24, 138, 2620 }, // У
+    { 28, 26, 30, 1, 25, 182, 2758 }, // Ф
+    { 23, 24, 22, 0, 24, 138, 2940 }, // Х
+    { 23, 29, 26, 3, 24, 167, 3078 }, // Ц
+    { 19, 24, 24, 2, 24, 114, 3245 }, // Ч
+    { 31, 24, 36, 2, 24, 186, 3359 }, // Ш
+    { 34, 30, 36, 2, 24, 255, 3545 }, // Щ
+    { 24, 24, 25, 0, 24, 144, 3800 }, // Ъ
+    { 25, 24, 31, 3, 24, 150, 3944 }, // Ы
+    { 17, 24, 22, 3, 24, 102, 4094 }, // Ь
+    { 19, 26, 22, 1, 25, 124, 4196 }, // Э
+    { 30, 26, 34, 3, 25, 195, 4320 }, // Ю
+    { 20, 24, 23, 0, 24, 120, 4515 }, // Я
+    { 17, 20, 20, 1, 19, 85, 4635 }, // а
+    { 19, 27, 21, 1, 26, 129, 4720 }, // б
+    { 17, 19, 20, 2, 19, 81, 4849 }, // в
+    { 14, 19, 16, 2, 19, 67, 4930 }, // г
+    { 21, 24, 21, 0, 19, 126, 4997 }, // д
+    { 18, 20, 19, 1, 19, 90, 5123 }, // е
+    { 29, 19, 29, 0, 19, 138, 5213 }, // ж
+    { 15, 20, 17, 1, 19, 75, 5351 }, // з
+    { 18, 19, 22, 2, 19, 86, 5426 }, // и
+    { 18, 26, 22, 2, 26, 117, 5512 }, // й
+    { 19, 19, 21, 2, 19, 91, 5629 }, // к
+    { 19, 20, 21, 0, 19, 95, 5720 }, // л
+    { 24, 19, 28, 2, 19, 114, 5815 }, // м
+    { 18, 19, 22, 2, 19, 86, 5929 }, // н
+    { 19, 20, 21, 1, 19, 95, 6015 }, // о
+    { 17, 19, 22, 2, 19, 81, 6110 }, // п
+    { 18, 27, 21, 2, 19, 122, 6191 }, // р
+    { 16, 20, 17, 1, 19, 80, 6313 }, // с
+    { 17, 19, 17, 0, 19, 81, 6393 }, // т
+    { 21, 27, 19, -1, 19, 142, 6474 }, // у
+    { 25, 34, 27, 1, 26, 213, 6616 }, // ф
+    { 20, 19, 19, 0, 19, 95, 6829 }, // х
+    { 20, 24, 22, 2, 19, 120, 6924 }, // ц
+    { 17, 19, 21, 2, 19, 81, 7044 }, // ч
+    { 28, 19, 32, 2, 19, 133, 7125 }, // ш
+    { 30, 24, 32, 2, 19, 180, 7258 }, // щ
+    { 22, 19, 22, 0, 19, 105, 7438 }, // ъ
+    { 24, 19, 28, 2, 19, 114, 7543 }, // ы
+    { 17, 19, 20, 2, 19, 81, 7657 }, // ь
+    { 16, 20, 17, 1, 19, 80, 7738 }, // э
+    { 25, 20, 28, 2, 19, 125, 7818 }, // ю
+    { 18, 19, 20, 0, 19, 86, 7943 }, // я
+    { 18, 27, 19, 1, 26, 122, 26323 }, // ѐ
+    { 18, 26, 19, 1, 25, 117, 8029 }, // ё
+    { 20, 34, 22, 0, 26, 170, 26445 }, // ђ
+    { 14, 26, 16, 2, 26, 91, 26615 }, // ѓ
+    { 16, 20, 17, 1, 19, 80, 26706 }, // є
+    { 15, 20, 17, 1, 19, 75, 26786 }, // ѕ
+    { 6, 26, 10, 2, 26, 39, 26861 }, // і
+    { 10, 26, 10, 0, 26, 65, 26900 }, // ї
+    { 10, 34, 10, -2, 26, 85, 26965 }, // ј
+    { 29, 20, 30, 0, 19, 145, 27050 }, // љ
+    { 28, 19, 31, 2, 19, 133, 27195 }, // њ
+    { 20, 26, 22, 0, 26, 130, 27328 }, // ћ
+    { 19, 26, 21, 2, 26, 124, 27458 }, // ќ
+    { 18, 26, 22, 2, 26, 117, 27582 }, // ѝ
+    { 21, 34, 19, -1, 26, 179, 27699 }, // ў
+    { 17, 24, 22, 2, 19, 102, 27878 }, // џ
+    { 32, 24, 32, 0, 24, 192, 27980 }, // Ѡ
+    { 29, 19, 30, 0, 19, 138, 28172 }, // ѡ
+    { 21, 24, 22, 0, 24, 126, 28310 }, // Ѣ
+    { 21, 22, 22, 0, 22, 116, 28436 }, // ѣ
+    { 28, 26, 32, 3, 25, 182, 28552 }, // Ѥ
+    { 24, 20, 27, 2, 19, 120, 28734 }, // ѥ
+    { 25, 24, 24, 0, 24, 150, 28854 }, // Ѧ
+    { 22, 19, 21, 0, 19, 105, 29004 }, // ѧ
+    { 31, 24, 34, 3, 24, 186, 29109 }, // Ѩ
+    { 29, 19, 30, 2, 19, 138, 29295 }, // ѩ
+    { 27, 24, 27, 0, 24, 162, 29433 }, // Ѫ
+    { 21, 19, 21, 0, 19, 100, 29595 }, // ѫ
+    { 33, 24, 36, 3, 24, 198, 29695 }, // Ѭ
+    { 27, 19, 29, 2, 19, 129, 29893 }, // ѭ
+    { 20, 37, 21, 0, 29, 185, 30022 }, // Ѯ
+    { 18, 31, 19, 0, 23, 140, 30207 }, // ѯ
+    { 25, 24, 29, 2, 24, 150, 30347 }, // Ѱ
+    { 24, 34, 28, 2, 26, 204, 30497 }, // ѱ
+    { 24, 26, 26, 1, 25, 156, 30701 }, // Ѳ
+    { 19, 20, 21, 1, 19, 95, 30857 }, // ѳ
+    { 24, 24, 24, 0, 24, 144, 30952 }, // Ѵ
+    { 21, 19, 20, 0, 19, 100, 31096 }, // ѵ
+    { 24, 32, 24, 0, 32, 192, 31196 }, // Ѷ
+    { 21, 26, 20, 0, 26, 137, 31388 }, // ѷ
+    { 43, 33, 44, 1, 25, 355, 31525 }, // Ѹ
+    { 39, 27, 39, 1, 19, 264, 31880 }, // ѹ
+    { 25, 29, 28, 1, 26, 182, 32144 }, // Ѻ
+    { 21, 23, 23, 1, 21, 121, 32326 }, // ѻ
+    { 34, 37, 36, 1, 36, 315, 32447 }, // Ѽ
+    { 29, 32, 32, 1, 31, 232, 32762 }, // ѽ
+    { 32, 31, 32, 0, 31, 248, 32994 }, // Ѿ
+    { 29, 25, 30, 0, 25, 182, 33242 }, // ѿ
+    { 21, 33, 23, 1, 25, 174, 33424 }, // Ҁ
+    { 16, 27, 17, 1, 19, 108, 33598 }, // ҁ
+    { 18, 22, 20, 1, 21, 99, 33706 }, // ҂
+    { 14, 7, 0, -16, 25, 25, 33805 }, // ҃
+    { 14, 6, 0, -16, 26, 21, 33830 }, // ҄
+    { 6, 8, 0, -12, 27, 12, 33851 }, // ҅
+    { 6, 8, 0, -12, 27, 12, 33863 }, // ҆
+    { 14, 6, 0, -7, 31, 21, 33875 }, // ҇
+    { 38, 36, 0, -19, 27, 342, 33896 }, // ҈
+    { 38, 38, 0, -19, 28, 361, 34238 }, // ҉
+    { 27, 39, 31, 3, 32, 264, 34599 }, // Ҋ
+    { 25, 34, 27, 2, 27, 213, 34863 }, // ҋ
+    { 20, 24, 21, 0, 24, 120, 35076 }, // Ҍ
+    { 20, 26, 20, 0, 26, 130, 35196 }, // ҍ
+    { 17, 24, 21, 3, 24, 102, 35326 }, // Ҏ
+    { 18, 27, 21, 2, 19, 122, 35428 }, // ҏ
+    { 17, 29, 19, 2, 29, 124, 35550 }, // Ґ
+    { 14, 24, 17, 2, 24, 84, 35674 }, // ґ
+    { 18, 24, 19, 0, 24, 108, 35758 }, // Ғ
+    { 16, 19, 16, 0, 19, 76, 35866 }, // ғ
+    { 20, 33, 24, 3, 24, 165, 35942 }, // Ҕ
+    { 17, 28, 20, 2, 19, 119, 0 }, // ҕ
+    { 34, 31, 34, 0, 24, 264, 119 }, // Җ
+    { 32, 26, 31, -1, 19, 208, 383 }, // җ
+    { 17, 33, 20, 1, 25, 141, 591 }, // Ҙ
+    { 15, 27, 17, 1, 19, 102, 732 }, // ҙ
+    { 22, 31, 25, 3, 24, 171, 834 }, // Қ
+    { 20, 26, 22, 2, 19, 130, 1005 }, // қ
+    { 21, 24, 22, 2, 24, 126, 1135 }, // Ҝ
+    { 19, 19, 21, 2, 19, 91, 1261 }, // ҝ
+    { 22, 24, 23, 1, 24, 132, 1352 }, // Ҟ
+    { 21, 26, 21, 0, 26, 137, 1484 }, // ҟ
+    { 25, 24, 24, 0, 24, 150, 1621 }, // Ҡ
+    { 24, 19, 23, 0, 19, 114, 1771 }, // ҡ
+    { 25, 31, 28, 3, 24, 194, 1885 }, // Ң
+    { 22, 26, 25, 2, 19, 143, 2079 }, // ң
+    { 25, 24, 28, 3, 24, 150, 2222 }, // Ҥ
+    { 24, 19, 25, 2, 19, 114, 2372 }, // ҥ
+    { 33, 33, 38, 3, 24, 273, 2486 }, // Ҧ
+    { 27, 28, 30, 2, 19, 189, 2759 }, // ҧ
+    { 24, 27, 26, 1, 25, 162, 2948 }, // Ҩ
+    { 20, 21, 22, 1, 19, 105, 3110 }, // ҩ
+    { 20, 33, 21, 1, 25, 165, 3215 }, // Ҫ
+    { 16, 27, 17, 1, 19, 108, 3380 }, // ҫ
+    { 19, 31, 19, 0, 24, 148, 3488 }, // Ҭ
+    { 18, 26, 18, 0, 19, 117, 3636 }, // ҭ
+    { 21, 24, 21, 0, 24, 126, 3753 }, // Ү
+    { 20, 27, 19, 0, 19, 135, 3879 }, // ү
+    { 21, 24, 21, 0, 24, 126, 4014 }, // Ұ
+    { 20, 27, 19, 0, 19, 135, 4140 }, // ұ
+    { 25, 31, 25, 0, 24, 194, 4275 }, // Ҳ
+    { 21, 26, 21, 0, 19, 137, 4469 }, // ҳ
+    { 31, 31, 31, 0, 24, 241, 4606 }, // Ҵ
+    { 26, 26, 26, 0, 19, 169, 4847 }, // ҵ
+    { 26, 31, 27, 1, 24, 202, 5016 }, // Ҷ
+    { 22, 26, 24, 2, 19, 143, 5218 }, // ҷ
+    { 20, 24, 25, 2, 24, 120, 5361 }, // Ҹ
+    { 19, 19, 22, 1, 19, 91, 5481 }, // ҹ
+    { 21, 24, 25, 2, 24, 126, 5572 }, // Һ
+    { 18, 26, 22, 2, 26, 117, 5698 }, // һ
+    { 29, 26, 32, 0, 25, 189, 5815 }, // Ҽ
+    { 24, 20, 24, -1, 19, 120, 6004 }, // ҽ
+    { 29, 32, 32, 0, 25, 232, 6124 }, // Ҿ
+    { 24, 26, 24, -1, 19, 156, 6356 }, // ҿ
+    { 11, 24, 13, 1, 24, 66, 6512 }, // Ӏ
+    { 33, 32, 33, 0, 32, 264, 6578 }, // Ӂ
+    { 29, 26, 29, 0, 26, 189, 6842 }, // ӂ
+    { 21, 33, 25, 3, 24, 174, 7031 }, // Ӄ
+    { 19, 28, 22, 2, 19, 133, 7205 }, // ӄ
+    { 28, 31, 28, 0, 24, 217, 7338 }, // Ӆ
+    { 24, 26, 24, 0, 19, 156, 7555 }, // ӆ
+    { 20, 33, 26, 3, 24, 165, 7711 }, // Ӈ
+    { 18, 28, 22, 2, 19, 126, 7876 }, // ӈ
+    { 25, 31, 29, 3, 24, 194, 8002 }, // Ӊ
+    { 23, 26, 25, 2, 19, 150, 8196 }, // ӊ
+    { 20, 31, 25, 2, 24, 155, 8346 }, // Ӌ
+    { 18, 26, 22, 2, 19, 117, 8501 }, // ӌ
+    { 31, 31, 35, 3, 24, 241, 8618 }, // Ӎ
+    { 29, 26, 31, 2, 19, 189, 8859 }, // ӎ
+    { 11, 24, 13, 1, 24, 66, 9048 }, // ӏ
+    { 24, 32, 23, 0, 32, 192, 9114 }, // Ӑ
+    { 17, 27, 20, 1, 26, 115, 9306 }, // ӑ
+    { 24, 32, 23, 0, 32, 192, 9421 }, // Ӓ
+    { 17, 27, 20, 1, 26, 115, 9613 }, // ӓ
+    { 30, 24, 32, 0, 24, 180, 9728 }, // Ӕ
+    { 29, 20, 31, 1, 19, 145, 9908 }, // ӕ
+    { 14, 32, 19, 3, 32, 112, 10053 }, // Ӗ
+    { 18, 27, 20, 1, 26, 122, 10165 }, // ӗ
+    { 24, 26, 27, 2, 25, 156, 10287 }, // Ә
+    { 18, 20, 20, 1, 19, 90, 10443 }, // ә
+    { 24, 33, 27, 2, 32, 198, 10533 }, // Ӛ
+    { 18, 27, 20, 1, 26, 122, 10731 }, // ӛ
+    { 33, 32, 33, 0, 32, 264, 10853 }, // Ӝ
+    { 29, 26, 29, 0, 26, 189, 11117 }, // ӝ
+    { 17, 33, 20, 1, 32, 141, 11306 }, // Ӟ
+    { 15, 27, 17, 1, 26, 102, 11447 }, // ӟ
+    { 19, 25, 20, 0, 24, 119, 11549 }, // Ӡ
+    { 19, 27, 19, 0, 19, 129, 11668 }, // ӡ
+    { 21, 30, 26, 3, 30, 158, 11797 }, // Ӣ
+    { 18, 24, 22, 2, 24, 108, 11955 }, // ӣ
+    { 21, 32, 26, 3, 32, 168, 12063 }, // Ӥ
+    { 18, 26, 22, 2, 26, 117, 12231 }, // ӥ
+    { 24, 33, 26, 1, 32, 198, 12348 }, // Ӧ
+    { 19, 27, 21, 1, 26, 129, 12546 }, // ӧ
+    { 24, 26, 26, 1, 25, 156, 12675 }, // Ө
+    { 19, 20, 21, 1, 19, 95, 12831 }, // ө
+    { 24, 33, 26, 1, 32, 198, 12926 }, // Ӫ
+    { 19, 27, 21, 1, 26, 129, 13124 }, // ӫ
+    { 19, 33, 22, 1, 32, 157, 13253 }, // Ӭ
+    { 16, 27, 17, 1, 26, 108, 13410 }, // ӭ
+    { 22, 31, 22, 0, 30, 171, 13518 }, // Ӯ
+    { 21, 32, 19, -1, 24, 168, 13689 }, // ӯ
+    { 22, 33, 22, 0, 32, 182, 13857 }, // Ӱ
+    { 21, 34, 19, -1, 26, 179, 14039 }, // ӱ
+    { 22, 33, 22, 0, 32, 182, 14218 }, // Ӳ
+    { 20, 34, 19, 0, 26, 170, 14400 }, // ӳ
+    { 19, 32, 24, 2, 32, 152, 14570 }, // Ӵ
+    { 17, 26, 21, 2, 26, 111, 14722 }, // ӵ
+    { 16, 31, 19, 3, 24, 124, 14833 }, // Ӷ
+    { 14, 26, 16, 2, 19, 91, 14957 }, // ӷ
+    { 25, 32, 31, 3, 32, 200, 15048 }, // Ӹ
+    { 24, 26, 28, 2, 26, 156, 15248 }, // ӹ
+    { 18, 33, 19, 0, 24, 149, 15404 }, // Ӻ
+    { 16, 27, 16, 0, 19, 108, 15553 }, // ӻ
+    { 24, 33, 24, 0, 24, 198, 15661 }, // Ӽ
+    { 21, 27, 22, 0, 19, 142, 15859 }, // ӽ
+    { 23, 24, 22, 0, 24, 138, 16001 }, // Ӿ
+    { 20, 19, 19, 0, 19, 95, 16139 }, // ӿ
+    { 0, 0, 17, 0, 0, 0, 16234 }, //  
+    { 0, 0, 33, 0, 0, 0, 16234 }, //  
+    { 0, 0, 17, 0, 0, 0, 16234 }, //  
+    { 0, 0, 33, 0, 0, 0, 16234 }, //  
+    { 0, 0, 11, 0, 0, 0, 16234 }, //  
+    { 0, 0, 8, 0, 0, 0, 16234 }, //  
+    { 0, 0, 6, 0, 0, 0, 16234 }, //  
+    { 0, 0, 19, 0, 0, 0, 16234 }, //  
+    { 0, 0, 9, 0, 0, 0, 16234 }, //  
+    { 0, 0, 6, 0, 0, 0, 16234 }, //  
+    { 0, 0, 3, 0, 0, 0, 16234 }, //  
+    { 0, 0, 0, 0, 0, 0, 16234 }, // ​
+    { 0, 0, 0, 0, 0, 0, 16234 }, // ‌
+    { 0, 0, 0, 0, 0, 0, 16234 }, // ‍
+    { 9, 28, 0, -1, 23, 63, 16234 }, // ‎
+    { 9, 28, 0, -8, 23, 63, 16297 }, // ‏
+    { 10, 5, 11, 0, 11, 13, 16360 }, // ‐
+    { 10, 5, 11, 0, 11, 13, 16373 }, // ‑
+    { 17, 5, 19, 1, 14, 22, 16386 }, // ‒
+    { 15, 4, 17, 1, 11, 15, 15522 }, // –
+    { 32, 4, 33, 1, 11, 32, 15537 }, // —
+    { 32, 4, 33, 1, 11, 32, 16408 }, // ―
+    { 13, 34, 18, 3, 26, 111, 16440 }, // ‖
+    { 15, 8, 14, -1, 0, 30, 16551 }, // ‗
+    { 7, 9, 7, 0, 24, 16, 15569 }, // ‘
+    { 7, 9, 7, 0, 24, 16, 15585 }, // ’
+    { 8, 9, 10, 0, 5, 18, 16581 }, // ‚
+    { 7, 9, 7, 0, 24, 16, 16599 }, // ‛
+    { 15, 9, 15, 0, 24, 34, 15601 }, // “
+    { 15, 9, 15, 0, 24, 34, 15635 }, // ”
+    { 15, 9, 17, 1, 4, 34, 16615 }, // „
+    { 15, 9, 15, 0, 24, 34, 16649 }, // ‟
+    { 15, 26, 17, 1, 26, 98, 16683 }, // †
+    { 15, 26, 17, 1, 26, 98, 16781 }, // ‡
+    { 10, 11, 13, 1, 18, 28, 16879 }, // •
+    { 12, 13, 13, 1, 19, 39, 16907 }, // ‣
+    { 7, 7, 17, 5, 6, 13, 16946 }, // ․
+    { 17, 7, 19, 1, 6, 30, 16959 }, // ‥
+    { 26, 7, 29, 1, 6, 46, 15669 }, // …
+    { 7, 7, 9, 1, 12, 13, 16989 }, // ‧
+    { 0, 0, 20, 0, 0, 0, 17002 }, //  
+    { 0, 0, 20, 0, 0, 0, 17002 }, //  
+    { 9, 26, 0, -1, 21, 59, 17002 }, // ‪
+    { 9, 26, 0, -8, 21, 59, 17061 }, // ‫
+    { 8, 28, 0, -4, 23, 56, 17120 }, // ‬
+    { 8, 28, 0, -4, 23, 56, 17176 }, // ‭
+    { 8, 28, 0, -4, 23, 56, 17232 }, // ‮
+    { 0, 0, 6, 0, 0, 0, 17288 }, //  
+    { 41, 26, 43, 1, 25, 267, 17288 }, // ‰
+    { 55, 26, 56, 0, 25, 358, 17555 }, // ‱
+    { 10, 9, 10, 1, 24, 23, 17913 }, // ′
+    { 17, 9, 17, 1, 24, 39, 17936 }, // ″
+    { 25, 9, 25, 1, 24, 57, 17975 }, // ‴
+    { 10, 9, 14, 1, 24, 23, 18032 }, // ‵
+    { 17, 9, 21, 1, 24, 39, 18055 }, // ‶
+    { 25, 9, 29, 1, 24, 57, 18094 }, // ‷
+    { 13, 11, 14, 0, 3, 36, 18151 }, // ‸
+    { 10, 16, 12, 1, 17, 40, 18187 }, // ‹
+    { 10, 16, 12, 1, 17, 40, 18227 }, // ›
+    { 26, 26, 28, 1, 25, 169, 18267 }, // ※
+    { 17, 25, 19, 1, 24, 107, 18436 }, // ‼
+    { 16, 26, 16, 0, 25, 104, 18543 }, // ‽
+    { 18, 4, 17, -1, 29, 18, 18647 }, // ‾
+    { 20, 8, 20, 0, 0, 40, 18665 }, // ‿
+    { 20, 8, 20, 0, 27, 40, 18705 }, // ⁀
+    { 14, 22, 14, 0, 14, 77, 18745 }, // ⁁
+    { 37, 31, 37, 0, 26, 287, 18822 }, // ⁂
+    { 10, 5, 11, 1, 11, 13, 19109 }, // ⁃
+    { 18, 24, 4, -7, 24, 108, 19122 }, // ⁄
+    { 9, 30, 11, 2, 24, 68, 19230 }, // ⁅
+    { 9, 30, 11, 0, 24, 68, 19298 }, // ⁆
+    { 31, 26, 32, 0, 25, 202, 19366 }, // ⁇
+    { 24, 26, 25, 0, 25, 156, 19568 }, // ⁈
+    { 24, 26, 25, 1, 25, 156, 19724 }, // ⁉
+    { 17, 19, 20, 1, 19, 81, 19880 }, // ⁊
+    { 18, 31, 22, 2, 26, 140, 19961 }, // ⁋
+    { 18, 18, 22, 1, 19, 81, 20101 }, // ⁌
+    { 19, 18, 22, 2, 19, 86, 20182 }, // ⁍
+    { 18, 17, 18, 0, 9, 77, 20268 }, // ⁎
+    { 8, 24, 10, 1, 19, 48, 20345 }, // ⁏
+    { 20, 35, 20, 0, 27, 175, 20393 }, // ⁐
+    { 18, 34, 18, 0, 26, 153, 20568 }, // ⁑
+    { 14, 26, 14, 0, 25, 91, 20721 }, // ⁒
+    { 32, 7, 33, 1, 13, 56, 20812 }, // ⁓
+    { 20, 8, 20, 0, 0, 40, 20868 }, // ⁔
+    { 17, 17, 19, 1, 17, 73, 20908 }, // ⁕
+    { 17, 26, 19, 1, 25, 111, 20981 }, // ⁖
+    { 31, 9, 31, 1, 24, 70, 21092 }, // ⁗
+    { 27, 26, 29, 1, 25, 176, 21162 }, // ⁘
+    { 27, 26, 29, 1, 25, 176, 21338 }, // ⁙
+    { 7, 26, 10, 1, 25, 46, 21514 }, // ⁚
+    { 21, 28, 23, 1, 27, 147, 21560 }, // ⁛
+    { 27, 27, 28, 1, 25, 183, 21707 }, // ⁜
+    { 7, 27, 9, 1, 26, 48, 21890 }, // ⁝
+    { 7, 26, 10, 1, 25, 46, 21938 }, // ⁞
+    { 0, 0, 7, 0, 0, 0, 21984 }, //  
+    { 0, 0, 20, 0, 0, 0, 21984 }, // ⁠
+    { 0, 0, 20, 0, 0, 0, 21984 }, // ⁡
+    { 0, 0, 20, 0, 0, 0, 21984 }, // ⁢
+    { 0, 0, 20, 0, 0, 0, 21984 }, // ⁣
+    { 0, 0, 20, 0, 0, 0, 21984 }, // ⁤
+    { 0, 0, 0, 0, 0, 0, 21984 }, // ⁦
+    { 0, 0, 0, 0, 0, 0, 21984 }, // ⁧
+    { 0, 0, 0, 0, 0, 0, 21984 }, // ⁨
+    { 0, 0, 0, 0, 0, 0, 21984 }, // ⁩
+    { 8, 28, 0, -4, 23, 56, 21984 }, // ⁪
+    { 8, 28, 0, -4, 23, 56, 22040 }, // ⁫
+    { 8, 28, 0, -4, 23, 56, 22096 }, // ⁬
+    { 8, 29, 0, -4, 24, 58, 22152 }, // ⁭
+    { 8, 28, 0, -4, 23, 56, 22210 }, // ⁮
+    { 8, 28, 0, -4, 23, 56, 22266 }, // ⁯
+    { 12, 16, 13, 0, 29, 48, 22322 }, // ⁰
+    { 5, 16, 6, 1, 25, 20, 22370 }, // ⁱ
+    { 13, 16, 13, 0, 29, 52, 22390 }, // ⁴
+    { 11, 16, 13, 1, 29, 44, 22442 }, // ⁵
+    { 12, 16, 13, 0, 29, 48, 22486 }, // ⁶
+    { 12, 16, 13, 0, 29, 48, 22534 }, // ⁷
+    { 12, 16, 13, 0, 29, 48, 22582 }, // ⁸
+    { 12, 16, 13, 0, 29, 48, 22630 }, // ⁹
+    { 10, 10, 12, 1, 25, 25, 22678 }, // ⁺
+    { 10, 4, 12, 1, 22, 10, 22703 }, // ⁻
+    { 10, 7, 12, 1, 23, 18, 22713 }, // ⁼
+    { 6, 20, 8, 2, 31, 30, 22731 }, // ⁽
+    { 6, 20, 8, 0, 31, 30, 22761 }, // ⁾
+    { 12, 12, 14, 1, 21, 36, 22791 }, // ⁿ
+    { 12, 16, 13, 0, 11, 48, 22827 }, // ₀
+    { 9, 16, 13, 1, 11, 36, 22875 }, // ₁
+    { 12, 16, 13, 0, 11, 48, 22911 }, // ₂
+    { 12, 16, 13, 0, 11, 48, 22959 }, // ₃
+    { 13, 16, 13, 0, 11, 52, 23007 }, // ₄
+    { 11, 16, 13, 1, 11, 44, 23059 }, // ₅
+    { 12, 16, 13, 0, 11, 48, 23103 }, // ₆
+    { 12, 16, 13, 0, 11, 48, 23151 }, // ₇
+    { 12, 16, 13, 0, 11, 48, 23199 }, // ₈
+    { 12, 16, 13, 0, 11, 48, 23247 }, // ₉
+    { 10, 10, 12, 1, 8, 25, 23295 }, // ₊
+    { 10, 4, 12, 1, 5, 10, 23320 }, // ₋
+    { 10, 7, 12, 1, 6, 18, 23330 }, // ₌
+    { 6, 20, 8, 2, 13, 30, 23348 }, // ₍
+    { 6, 20, 8, 0, 13, 30, 23378 }, // ₎
+    { 12, 12, 13, 0, 8, 36, 23408 }, // ₐ
+    { 11, 12, 13, 1, 8, 33, 23444 }, // ₑ
+    { 12, 12, 14, 1, 8, 36, 23477 }, // ₒ
+    { 13, 12, 13, 0, 8, 39, 23513 }, // ₓ
+    { 12, 12, 13, 0, 8, 36, 23552 }, // ₔ
+    { 12, 16, 14, 1, 12, 48, 23588 }, // ₕ
+    { 13, 16, 13, 1, 12, 52, 23636 }, // ₖ
+    { 4, 16, 6, 1, 12, 16, 23688 }, // ₗ
+    { 19, 12, 21, 1, 8, 57, 23704 }, // ₘ
+    { 12, 12, 14, 1, 8, 36, 23761 }, // ₙ
+    { 12, 16, 14, 1, 8, 48, 23797 }, // ₚ
+    { 10, 12, 11, 0, 8, 30, 23845 }, // ₛ
+    { 9, 15, 9, 0, 11, 34, 23875 }, // ₜ
+    { 19, 25, 19, 0, 25, 119, 23909 }, // ₠
+    { 19, 28, 20, 1, 26, 133, 24028 }, // ₡
+    { 18, 26, 19, 1, 25, 117, 24161 }, // ₢
+    { 18, 24, 19, 0, 24, 108, 24278 }, // ₣
+    { 18, 25, 19, 1, 25, 113, 24386 }, // ₤
+    { 29, 27, 33, 2, 23, 196, 24499 }, // ₥
+    { 19, 24, 19, 0, 24, 114, 24695 }, // ₦
+    { 27, 25, 30, 2, 24, 169, 24809 }, // ₧
+    { 28, 25, 31, 2, 24, 175, 24978 }, // ₨
+    { 25, 24, 25, 0, 24, 150, 25153 }, // ₩
+    { 26, 24, 31, 2, 24, 156, 25303 }, // ₪
+    { 21, 32, 22, 1, 26, 168, 25459 }, // ₫
+    { 18, 25, 19, 1, 24, 113, 25627 }, // €
+    { 20, 24, 19, 0, 24, 120, 25740 }, // ₭
+    { 19, 24, 19, 0, 24, 114, 25860 }, // ₮
+    { 33, 33, 34, 0, 25, 273, 25974 }, // ₯
+    { 19, 33, 20, 0, 25, 157, 26247 }, // ₰
+    { 19, 24, 19, 0, 24, 114, 26404 }, // ₱
+    { 21, 29, 24, 1, 26, 153, 26518 }, // ₲
+    { 22, 24, 22, 0, 24, 132, 26671 }, // ₳
+    { 19, 26, 19, 0, 25, 124, 26803 }, // ₴
+    { 20, 29, 21, 1, 26, 145, 26927 }, // ₵
+    { 23, 24, 23, 0, 23, 138, 27072 }, // ₶
+    { 24, 28, 24, 0, 25, 168, 27210 }, // ₷
+    { 19, 24, 19, 0, 24, 114, 27378 }, // ₸
+    { 16, 24, 19, 2, 24, 96, 27492 }, // ₹
+    { 19, 25, 19, 0, 24, 119, 27588 }, // ₺
+    { 27, 26, 27, 0, 25, 176, 27707 }, // ₻
+    { 27, 24, 29, 1, 24, 162, 27883 }, // ₼
+    { 20, 24, 20, 0, 24, 120, 28045 }, // ₽
+    { 24, 26, 26, 1, 26, 156, 28165 }, // ₾
+    { 15, 32, 19, 3, 28, 120, 28321 }, // ₿
+    { 16, 25, 17, 1, 19, 100, 28441 }, // ⃀
+    { 17, 5, 19, 1, 14, 22, 28541 }, // −
+    { 28, 26, 26, 0, 26, 182, 28563 }, // ﬀ
+    { 21, 26, 23, 0, 26, 137, 28745 }, // ﬁ
+    { 21, 26, 23, 0, 26, 137, 28882 }, // ﬂ
+    { 34, 26, 36, 0, 26, 221, 29019 }, // ﬃ
+    { 34, 26, 36, 0, 26, 221, 29240 }, // ﬄ
+    { 23, 27, 26, 2, 26, 156, 29461 }, // ﬅ
+    { 29, 27, 31, 1, 26, 196, 29617 }, // ﬆ
+    { 31, 32, 33, 1, 26, 248, 29813 }, // �
 };
 
 static const EpdUnicodeInterval notosans_16_boldIntervals[] = {
@@ -3045,31 +3087,296 @@ static const EpdUnicodeInterval notosans_16_boldIntervals[] = {
     { 0x2090, 0x209C, 0x33D },
     { 0x20A0, 0x20C0, 0x34A },
     { 0x2212, 0x2212, 0x36B },
-    { 0xFFFD, 0xFFFD, 0x36C },
+    { 0xFB00, 0xFB06, 0x36C },
+    { 0xFFFD, 0xFFFD, 0x373 },
 };
 
 static const EpdFontGroup notosans_16_boldGroups[] = {
-    { 0, 4260, 9076, 97, 0 },
-    { 4260, 3851, 11179, 96, 97 },
-    { 8111, 5301, 17141, 128, 193 },
-    { 13412, 1518, 2409, 112, 321 },
-    { 14930, 13103, 36204, 256, 433 },
-    { 28033, 2808, 6281, 111, 689 },
-    { 30841, 725, 1587, 42, 800 },
-    { 31566, 2499, 4632, 33, 842 },
-    { 34065, 19, 22, 1, 875 },
-    { 34084, 125, 248, 1, 876 },
+    { 0, 5593, 15715, 151, 2 },
+    { 5593, 3360, 8146, 66, 434 },
+    { 8953, 13372, 36107, 372, 0 },
+    { 22325, 12448, 30061, 295, 582 },
+};
+
+static const uint8_t notosans_16_boldGlyphGroups[884] = {
+    2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2,
+    2, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 2, 2,
+    2, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 0, 0, 3, 3, 3, 0, 0, 3, 3, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+};
+
+static const uint8_t notosans_16_boldKernLeftClasses[884] = {
+    0, 0, 0, 0, 2, 0, 0, 0, 66, 2, 28, 0, 0, 0, 4, 37,
+    4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 11, 0, 41, 18, 32, 60, 0, 0, 0, 0, 41, 22, 0,
+    0, 18, 39, 18, 0, 0, 12, 43, 34, 34, 41, 15, 68, 28, 0, 0,
+    0, 70, 0, 0, 31, 64, 0, 31, 50, 0, 0, 0, 0, 0, 0, 0,
+    0, 31, 31, 0, 25, 0, 64, 0, 35, 35, 71, 35, 0, 28, 0, 0,
+    0, 0, 67, 0, 0, 0, 0, 0, 0, 0, 0, 0, 56, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 30, 0, 0, 0,
+    57, 11, 11, 11, 11, 11, 11, 32, 41, 32, 32, 32, 32, 0, 0, 0,
+    0, 18, 0, 18, 18, 18, 18, 18, 0, 18, 43, 43, 43, 43, 15, 39,
+    0, 0, 0, 0, 0, 0, 0, 31, 0, 31, 31, 31, 31, 0, 0, 58,
+    58, 31, 0, 31, 31, 31, 31, 31, 0, 31, 0, 0, 0, 0, 35, 31,
+    35, 11, 0, 11, 0, 46, 0, 41, 0, 41, 0, 41, 0, 41, 0, 18,
+    20, 18, 0, 32, 31, 32, 31, 32, 31, 32, 31, 32, 31, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 59, 0, 58, 0, 0, 32,
+    0, 0, 0, 0, 0, 0, 0, 41, 0, 71, 22, 0, 22, 0, 22, 20,
+    22, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 31, 18,
+    31, 18, 31, 32, 31, 0, 25, 0, 25, 0, 25, 0, 0, 0, 0, 0,
+    0, 0, 0, 12, 64, 12, 36, 12, 64, 43, 0, 43, 0, 43, 0, 43,
+    0, 43, 0, 43, 0, 34, 35, 15, 35, 15, 68, 0, 68, 0, 68, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 48, 48, 24, 16, 27, 43, 0, 0, 0, 19, 19, 24, 10, 0, 1,
+    0, 8, 0, 0, 16, 3, 48, 10, 0, 0, 0, 10, 0, 0, 0, 13,
+    0, 23, 27, 16, 1, 47, 10, 3, 0, 0, 3, 19, 0, 19, 13, 13,
+    0, 49, 61, 53, 40, 5, 7, 21, 53, 42, 42, 21, 42, 42, 42, 7,
+    42, 7, 52, 40, 14, 7, 21, 5, 42, 42, 5, 6, 42, 6, 7, 7,
+    42, 7, 7, 55, 45, 52, 69, 0, 63, 72, 6, 6, 62, 21, 42, 14,
+    42, 13, 51, 44, 6, 27, 52, 8, 38, 8, 38, 0, 0, 0, 0, 43,
+    0, 0, 7, 13, 7, 1, 51, 1, 51, 14, 14, 13, 7, 13, 7, 13,
+    51, 27, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 5, 44, 6, 23,
+    7, 9, 33, 17, 54, 0, 0, 29, 0, 43, 53, 29, 0, 10, 21, 10,
+    21, 10, 21, 3, 5, 17, 33, 0, 0, 0, 7, 27, 52, 9, 33, 26,
+    43, 26, 43, 29, 0, 3, 5, 3, 5, 0, 0, 0, 0, 42, 65, 42,
+    65, 0, 10, 21, 0, 0, 3, 5, 0, 0, 3, 5, 0, 0, 3, 5,
+    0, 8, 49, 8, 49, 48, 65, 48, 65, 13, 7, 13, 7, 10, 21, 43,
+    53, 0, 0, 0, 42, 0, 42, 13, 7, 13, 7, 13, 7, 13, 7, 1,
+    14, 1, 14, 1, 14, 0, 42, 9, 33, 0, 42, 17, 54, 29, 0, 10,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 37, 37, 37, 0, 0, 2, 2, 4, 0, 2, 2, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 56, 30, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 0, 0, 0,
+    0, 0, 0, 0,
+};
+
+static const uint8_t notosans_16_boldKernRightClasses[884] = {
+    0, 0, 0, 63, 5, 0, 0, 0, 51, 5, 0, 40, 0, 0, 2, 31,
+    2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 42, 42, 0, 0,
+    0, 55, 0, 7, 0, 3, 0, 0, 0, 3, 0, 0, 43, 0, 0, 0,
+    0, 3, 0, 3, 0, 0, 20, 47, 32, 32, 61, 24, 0, 0, 0, 40,
+    0, 0, 0, 16, 58, 1, 1, 1, 0, 29, 58, 0, 69, 58, 58, 11,
+    11, 1, 11, 1, 11, 11, 0, 11, 22, 22, 22, 22, 51, 0, 0, 40,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 25, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 0, 0, 0,
+    0, 7, 7, 7, 7, 7, 7, 59, 3, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 3, 3, 3, 3, 3, 0, 3, 47, 47, 47, 47, 24, 0,
+    0, 1, 16, 16, 16, 16, 16, 16, 1, 1, 1, 1, 1, 0, 0, 0,
+    0, 0, 0, 1, 1, 1, 1, 1, 0, 1, 11, 11, 11, 11, 22, 58,
+    22, 7, 16, 7, 16, 7, 16, 3, 1, 3, 1, 3, 1, 3, 1, 0,
+    1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 3, 29, 3,
+    29, 3, 29, 3, 29, 0, 58, 0, 68, 0, 62, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 58, 11, 0, 58, 0, 58, 0, 58,
+    0, 58, 0, 0, 0, 11, 0, 11, 0, 0, 0, 0, 11, 3, 1, 3,
+    1, 3, 1, 3, 1, 0, 11, 0, 11, 0, 0, 0, 11, 0, 0, 0,
+    11, 0, 0, 20, 0, 20, 0, 20, 0, 47, 11, 47, 11, 47, 11, 47,
+    11, 47, 11, 47, 11, 32, 22, 24, 22, 24, 0, 51, 0, 51, 0, 51,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4, 0, 34, 66, 0, 0, 33, 27, 0, 4, 0, 0, 13,
+    0, 9, 0, 0, 0, 39, 0, 14, 67, 0, 0, 0, 27, 0, 0, 34,
+    0, 0, 34, 4, 13, 50, 14, 0, 17, 0, 0, 4, 0, 0, 67, 0,
+    54, 6, 60, 42, 42, 18, 19, 10, 36, 42, 42, 42, 26, 42, 42, 19,
+    42, 42, 19, 21, 15, 19, 10, 42, 8, 42, 42, 21, 42, 42, 36, 42,
+    52, 19, 19, 30, 42, 19, 64, 0, 65, 45, 26, 42, 30, 42, 42, 15,
+    42, 12, 48, 56, 0, 0, 23, 9, 18, 0, 23, 0, 0, 0, 23, 67,
+    0, 17, 0, 12, 6, 53, 48, 53, 48, 12, 6, 12, 6, 12, 6, 12,
+    48, 12, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 23, 56, 30, 0,
+    23, 0, 23, 56, 0, 0, 23, 14, 10, 67, 36, 0, 23, 0, 23, 0,
+    30, 37, 21, 0, 23, 0, 23, 0, 23, 12, 6, 12, 6, 4, 21, 46,
+    57, 46, 57, 14, 10, 37, 21, 17, 8, 17, 8, 0, 23, 28, 41, 28,
+    41, 0, 14, 10, 0, 23, 44, 18, 0, 23, 0, 23, 17, 8, 0, 23,
+    0, 9, 38, 9, 38, 9, 38, 0, 6, 0, 38, 0, 38, 14, 10, 67,
+    36, 0, 0, 0, 42, 0, 42, 12, 6, 12, 6, 12, 6, 67, 36, 13,
+    15, 13, 15, 13, 15, 17, 8, 0, 23, 0, 42, 56, 0, 14, 10, 14,
+    10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 31, 31, 31, 0, 0, 35, 5, 2, 0, 35, 5, 2,
+    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 25, 49, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0,
+};
+
+static const int8_t notosans_16_boldKernMatrix[5110] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 1, -2, 0, -1, -4, -1, 0, 0, 0, 0, 0, 0, 0, -3, -2, 0, 0, 0, 0, 0, -2, -2, -3, -1, 0, 2, -1, 0, 0, -1, 0, -1, 0, 0, -4, 0, -1, 0, 0, -2, 0, 0, 0, 0, -1, -1, 0, -2, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0,
+    0, -2, 0, 0, 1, 0, -1, -2, 0, -2, 0, -1, 0, 1, 1, 1, -1, 0, -2, 0, 1, 1, 0, 0, 0, 0, -2, -1, 0, -1, 1, 0, 1, 0, 0, 0, 1, 1, -1, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 2, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, -1, 1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, -2, 0, 0, 0, -2, 0, 0, 0, -2, -1, 0, 0, 0, -3, 0, 0, -2, -1, 0, 0, -2, 0, 0, 0, -2, 0, 0, 0, -2, 2, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, 0, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, -3, 0, 0, -1, 0, -1, 0, 0, -1, 0, -2, 0, -2, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, -2, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 2, -1, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 1, 0, -2, 0, -2, -2, -1, 0, -1, 0, 0, -1, 0, 0, -2, 0, 0, -1, 0, -2, 0, -2, 0, -1, -2, 0, 0, -1, 0, 0, -1, 0, -1, 0, -3, -2, 0, -2, 0, 0, -2, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, -2, -1, 0, 0, 0, -2, 0, 0, 0, -2, 0, 0, 0, 0, -3, 0, 0, 0, 1, 0, -1, 0, 0, -2, 0, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, 0, 0, 0, 0, 0, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, -2, -1, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 1, 1, -1, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 1, 0, -1, 0, -2, -2, -1, 0, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 1, -1, 0, 0, 0, 0, -1, 1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, -3, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 1, 0, 0, 0, 0, 4, 0, 0, 0, 0, 2, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -4, 0, 0, 0, -1, 0, 0, -2, 0, 0, 0, -1, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, -2, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -5, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, -2, 0, -1, -2, 0, 0, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, -2, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -2, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -4, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 1, 0, 0, 0, -1, 0, 0, 0, 1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 1, -1, 0, 0, 0, 1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const EpdLigaturePair notosans_16_boldLigatures[] = {
+    { 0x66, 0x66, 0xFB00 },
+    { 0x66, 0x69, 0xFB01 },
+    { 0x66, 0x6C, 0xFB02 },
+    { 0xFB00, 0x69, 0xFB03 },
+    { 0xFB00, 0x6C, 0xFB04 },
+};
+
+static const uint16_t notosans_16_boldGlyphLookup[368] = {
+    0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0001, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, 0x0010, 0x0011,
+    0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, 0x0020, 0x0021,
+    0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, 0x0030, 0x0031,
+    0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, 0x0040, 0x0041,
+    0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051,
+    0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, 0x0060, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070,
+    0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, 0x0080,
+    0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F, 0x0090,
+    0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F, 0x00A0,
+    0x00A1, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF, 0x00B0,
+    0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF, 0x00C0,
+    0x02B1, 0x02B2, 0x02B3, 0x02B4, 0x02B5, 0x02B6, 0x02B7, 0x02B8, 0x02B9, 0x02BA, 0x02BB, 0x02BC, 0x02BD, 0x02BE, 0x02BF, 0x02C0,
+    0x02C1, 0x02C2, 0x02C3, 0x02C4, 0x02C5, 0x02C6, 0x02C7, 0x02C8, 0x02C9, 0x02CA, 0x02CB, 0x02CC, 0x02CD, 0x02CE, 0x02CF, 0x02D0,
+    0x02D1, 0x02D2, 0x02D3, 0x02D4, 0x02D5, 0x02D6, 0x02D7, 0x02D8, 0x02D9, 0x02DA, 0x02DB, 0x02DC, 0x02DD, 0x02DE, 0x02DF, 0x02E0,
+    0x02E1, 0x02E2, 0x02E3, 0x02E4, 0x02E5, 0x02E6, 0x02E7, 0x02E8, 0x02E9, 0x02EA, 0x02EB, 0x02EC, 0x02ED, 0x02EE, 0x02EF, 0x02F0,
+    0x02F1, 0x02F2, 0x02F3, 0x02F4, 0x02F5, 0x02F6, 0x02F7, 0x02F8, 0x02F9, 0x02FA, 0x02FB, 0x02FC, 0x02FD, 0x02FE, 0x02FF, 0x0300,
+    0x0301, 0x0302, 0x0303, 0x0304, 0x0305, 0x0306, 0x0307, 0x0308, 0x0309, 0x030A, 0x030B, 0x030C, 0x030D, 0x030E, 0x030F, 0x0310,
+    0x0311, 0x0312, 0x0313, 0x0314, 0x0315, 0xFFFF, 0x0316, 0x0317, 0x0318, 0x0319, 0x031A, 0x031B, 0x031C, 0x031D, 0x031E, 0x031F,
 };
 
 static const EpdFontData notosans_16_bold = {
     notosans_16_boldBitmaps,
     notosans_16_boldGlyphs,
     notosans_16_boldIntervals,
-    15,
+    16,
     45,
     36,
     -10,
     true,
     notosans_16_boldGroups,
-    10,
+    4,
+    notosans_16_boldKernLeftClasses,
+    notosans_16_boldKernRightClasses,
+    notosans_16_boldKernMatrix,
+    70,
+    notosans_16_boldLigatures,
+    5,
+    0x4000000001ull,
+    notosans_16_boldGlyphLookup,
+    notosans_16_boldGlyphGroups,
+    false,
+    nullptr,
 };
@@ -3,2482 +3,2523 @@
  * name: notosans_16_bolditalic
  * size: 16
  * mode: 2-bit  compressed: true
- * Command used: fontconvert.py notosans_16_bolditalic 16 ../builtinFonts/source/NotoSans/NotoSans-BoldItalic.ttf --2bit --compress
+ * Command used: fontconvert.py notosans_16_bolditalic 16 ../builtinFonts/source/NotoSans/NotoSans-BoldItalic.ttf --2bit --compress --frequency-corpus ../../../test/hyphenation_eval/resources/english_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/french_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/german_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/italian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/russian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/spanish_hyphenation_tests.txt
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t notosans_16_bolditalicBitmaps[39515] = {
-    0x95, 0x5A, 0xBF, 0xCF, 0xDD, 0xD6, 0x79, 0x3E, 0xBC, 0x8C, 0x74, 0xD1, 0x12, 0x28, 0x3D, 0x58,
-    0x83, 0x6D, 0xA0, 0xDC, 0x53, 0xB4, 0x9C, 0x0B, 0xB4, 0x3D, 0xB4, 0x3C, 0x78, 0xF0, 0x60, 0x0D,
-    0xFA, 0x80, 0x16, 0x1E, 0xBC, 0x24, 0x40, 0xEB, 0x02, 0xF9, 0x86, 0x76, 0x29, 0x50, 0x80, 0x94,
-    0x53, 0x20, 0x43, 0x06, 0x0B, 0x45, 0x3A, 0x65, 0x70, 0x87, 0x04, 0x48, 0xBF, 0x0E, 0xFE, 0x0B,
-    0x6C, 0xD2, 0xD6, 0xA0, 0xC1, 0x83, 0x68, 0x0B, 0x41, 0x06, 0x0F, 0xA6, 0x1D, 0x35, 0x81, 0xED,
-    0xE1, 0xA3, 0x1D, 0xCA, 0xA2, 0x24, 0x92, 0x6F, 0x9F, 0xE7, 0x39, 0xE4, 0xF7, 0x43, 0x92, 0x9D,
-    0xE4, 0x42, 0xDF, 0xD5, 0xBD, 0xE4, 0xE1, 0x39, 0xEF, 0x79, 0x7F, 0x3C, 0xCF, 0xFB, 0xBE, 0xE7,
-    0x3A, 0x3F, 0x44, 0xD6, 0xEE, 0xCD, 0xE5, 0xA3, 0xB3, 0x36, 0x36, 0x97, 0x4E, 0xAE, 0xEC, 0x22,
-    0x2B, 0x92, 0xC9, 0xF9, 0xDE, 0x59, 0x15, 0xCF, 0x2E, 0xEB, 0x5D, 0xD9, 0xEC, 0x16, 0x17, 0x5D,
-    0x71, 0x7A, 0xED, 0x47, 0xDC, 0xDA, 0x59, 0x93, 0x60, 0xF4, 0xE0, 0x2E, 0x38, 0x97, 0x75, 0xF6,
-    0xD2, 0xE8, 0x6F, 0xCC, 0x59, 0x6F, 0xFB, 0xD1, 0xBF, 0x3E, 0x67, 0x6D, 0xBD, 0xEF, 0xFD, 0xEB,
-    0x53, 0xDA, 0xBE, 0x1D, 0xF7, 0x78, 0x20, 0xAF, 0xDE, 0x76, 0x2E, 0x1E, 0xD3, 0xD6, 0x39, 0xFF,
-    0xFC, 0xE4, 0x5C, 0xD2, 0xE7, 0x8D, 0x73, 0x4B, 0x3C, 0x38, 0x97, 0xB6, 0xA5, 0x73, 0xD1, 0x9C,
-    0x60, 0x09, 0x33, 0x5B, 0xF6, 0x78, 0xB3, 0x8E, 0x1F, 0x67, 0x97, 0x0C, 0xFE, 0xFC, 0xA8, 0x09,
-    0xA3, 0x3C, 0x07, 0xC4, 0x7C, 0xEB, 0xF5, 0x40, 0xF4, 0xCA, 0xDD, 0xF2, 0x97, 0x85, 0xB3, 0xF3,
-    0xA3, 0x5C, 0xDE, 0x2C, 0x27, 0x2B, 0x5E, 0x9E, 0x24, 0x35, 0x85, 0xDF, 0x63, 0x42, 0xF7, 0x57,
-    0xF8, 0x7B, 0x6E, 0x29, 0x5C, 0x82, 0x39, 0x1C, 0xE6, 0x68, 0x52, 0xAE, 0x56, 0xDE, 0xFB, 0x0D,
-    0xF6, 0xF4, 0x32, 0x2E, 0x4F, 0x7F, 0x83, 0xE7, 0xEF, 0x63, 0x92, 0xD2, 0x2A, 0x87, 0x01, 0x7A,
-    0xC3, 0x44, 0xB5, 0x75, 0xB8, 0x11, 0x3E, 0x55, 0x2E, 0xFE, 0x95, 0x61, 0xC5, 0x74, 0xFA, 0x13,
-    0xF7, 0xEF, 0x65, 0xE7, 0xFF, 0xF3, 0x9E, 0x15, 0x98, 0x6A, 0xA2, 0x64, 0xD0, 0x8B, 0x8D, 0xCE,
-    0x1D, 0x7E, 0xB6, 0xAE, 0xE5, 0x20, 0x9A, 0x8B, 0x1B, 0x77, 0xF2, 0xAA, 0x5B, 0xB7, 0x1B, 0x5D,
-    0x86, 0x99, 0xB2, 0x16, 0x53, 0x37, 0xD1, 0xE2, 0xD2, 0x19, 0xBA, 0xC4, 0xEE, 0xDE, 0x9B, 0x5D,
-    0xED, 0x76, 0x4B, 0x32, 0xEC, 0x07, 0xE8, 0xD6, 0xB7, 0xBE, 0x72, 0xBE, 0xB1, 0x18, 0x3B, 0xC0,
-    0x1B, 0x94, 0x16, 0x4F, 0xD9, 0x27, 0xF3, 0x9F, 0x5E, 0x4F, 0x7B, 0x7B, 0xF9, 0x53, 0xEB, 0xFD,
-    0xF1, 0x64, 0xDE, 0xBA, 0xDA, 0xDE, 0xFF, 0x0A, 0xD3, 0xD8, 0x54, 0xBE, 0x3C, 0x58, 0xF1, 0x83,
-    0x17, 0xC6, 0xF2, 0xF5, 0xD9, 0x71, 0xAE, 0x64, 0x70, 0xBB, 0x29, 0xED, 0xA1, 0xC6, 0xAC, 0xC5,
-    0x34, 0x50, 0xA6, 0xB3, 0xFD, 0x84, 0x85, 0x30, 0x57, 0xEB, 0xEA, 0x22, 0xFD, 0xD2, 0x64, 0x4C,
-    0x1B, 0xB0, 0x0A, 0xB7, 0xCB, 0x85, 0xCA, 0x41, 0x42, 0x7E, 0xE7, 0x44, 0xDC, 0x1D, 0xF7, 0x8D,
-    0xBB, 0xB8, 0x1E, 0x53, 0x65, 0xCE, 0x2F, 0x54, 0x82, 0x55, 0xD0, 0xC2, 0x7E, 0x8A, 0xA1, 0xE8,
-    0xAC, 0xCF, 0x70, 0xB3, 0x6C, 0x0C, 0x9B, 0xB4, 0x37, 0x67, 0x8D, 0xC3, 0x88, 0x3D, 0xD4, 0xCA,
-    0x07, 0x8B, 0xBC, 0x4F, 0x6D, 0xE2, 0x03, 0x36, 0x25, 0x53, 0x6A, 0x7E, 0xF4, 0x5D, 0xD9, 0xFB,
-    0x7B, 0xB6, 0xB3, 0x02, 0xD3, 0xA6, 0xD8, 0xB3, 0x35, 0x7E, 0x70, 0x1C, 0xD3, 0xEF, 0xAD, 0xDD,
-    0xD1, 0xBC, 0x8D, 0x8C, 0xDC, 0xC0, 0x21, 0x1E, 0x5A, 0xB1, 0xB3, 0x05, 0xCE, 0xE6, 0x2E, 0x51,
-    0x9C, 0xEC, 0xD3, 0xC5, 0xDF, 0x9E, 0xFC, 0x8F, 0x86, 0x32, 0xE9, 0xDF, 0xA6, 0x36, 0x61, 0xFD,
-    0xCA, 0xD5, 0x15, 0xD6, 0x77, 0xBE, 0x75, 0xBE, 0xA3, 0xBF, 0xA6, 0x23, 0x44, 0x73, 0x90, 0x2D,
-    0xC2, 0x63, 0x75, 0xC3, 0xAB, 0x70, 0x55, 0x5C, 0xDA, 0xF1, 0x7B, 0xE5, 0xF2, 0x8E, 0x43, 0x28,
-    0xBB, 0xE9, 0x4B, 0x32, 0x6A, 0x24, 0xB4, 0x00, 0x2B, 0xEC, 0xE6, 0xED, 0x93, 0xBB, 0xBA, 0xEA,
-    0x00, 0x5F, 0x61, 0x25, 0x5D, 0xA2, 0xD9, 0x07, 0x4D, 0xB2, 0xA7, 0xB6, 0x1A, 0xFD, 0xE7, 0x69,
-    0x9A, 0x93, 0x6F, 0xF8, 0x2F, 0x99, 0x34, 0x35, 0x46, 0x72, 0xDE, 0xBC, 0x77, 0x88, 0x23, 0x5E,
-    0x4F, 0xD7, 0x85, 0x5A, 0x8E, 0x58, 0x3F, 0xE1, 0x1A, 0xA2, 0xCB, 0x5D, 0x2A, 0x36, 0x37, 0xC5,
-    0x35, 0x2D, 0x15, 0x8F, 0xEE, 0xCF, 0xDC, 0x0C, 0x13, 0x79, 0x6A, 0xB4, 0x7A, 0xBA, 0x86, 0x46,
-    0x18, 0x27, 0x15, 0xB4, 0xD2, 0x25, 0xF6, 0xC1, 0xF7, 0x92, 0x65, 0xC2, 0x3C, 0x25, 0x1E, 0x4F,
-    0xB1, 0x6D, 0x48, 0x10, 0x51, 0x1D, 0xB2, 0x1D, 0x9E, 0xA5, 0xBD, 0x31, 0x19, 0xFC, 0x17, 0x77,
-    0xB7, 0x0B, 0xBB, 0xA3, 0xFA, 0xF3, 0x5F, 0x50, 0xB5, 0x8C, 0xA4, 0x5B, 0x8C, 0xA3, 0x47, 0x47,
-    0x9C, 0x3E, 0xC2, 0x80, 0x87, 0x8D, 0xAC, 0x29, 0x5B, 0x98, 0x70, 0x80, 0xB1, 0x27, 0x68, 0xE1,
-    0x12, 0xA3, 0xE0, 0x77, 0xB6, 0x78, 0xFB, 0x95, 0x0C, 0x8C, 0x7D, 0xBD, 0x68, 0xF9, 0x54, 0x7F,
-    0x69, 0x85, 0x00, 0x82, 0xBE, 0xC0, 0xBD, 0x4B, 0x15, 0xD4, 0xBC, 0x94, 0xCE, 0x5D, 0xCA, 0x14,
-    0xD2, 0x04, 0x35, 0x82, 0xED, 0x17, 0xEB, 0xE5, 0x92, 0x97, 0x97, 0xF5, 0xB2, 0xE3, 0xE5, 0x64,
-    0x5A, 0xF5, 0x10, 0xDB, 0xB7, 0x4C, 0x39, 0xB8, 0x73, 0xAF, 0x9C, 0xBE, 0x08, 0x2F, 0x82, 0x7A,
-    0xFA, 0x08, 0x5B, 0x2B, 0xFC, 0x98, 0x8F, 0x70, 0x1C, 0xC4, 0x46, 0x93, 0x4E, 0x19, 0x10, 0xEE,
-    0x86, 0x15, 0xE9, 0x44, 0x5C, 0xBB, 0x49, 0xA4, 0xAB, 0x3B, 0x67, 0xEF, 0x03, 0xDF, 0x46, 0x6B,
-    0x76, 0xF6, 0x06, 0x00, 0x6F, 0xA0, 0xDB, 0x09, 0x01, 0xF1, 0xC0, 0x9C, 0x4E, 0x91, 0x35, 0x75,
-    0x57, 0x0E, 0x98, 0x6F, 0x21, 0xF2, 0x34, 0x8E, 0xEA, 0xDA, 0x31, 0x12, 0x02, 0x16, 0xC2, 0xD3,
-    0x62, 0x5C, 0xAD, 0x0D, 0xCB, 0x8E, 0x70, 0xDB, 0x16, 0xC6, 0xD9, 0xD9, 0x31, 0xF4, 0xE4, 0xBB,
-    0xFD, 0x35, 0xEC, 0x23, 0xA1, 0x2B, 0xD1, 0x69, 0xE0, 0x18, 0x4B, 0xD8, 0x07, 0x54, 0xC0, 0x3D,
-    0xA5, 0xF4, 0x93, 0x8E, 0xEA, 0xD5, 0x47, 0x0D, 0xAA, 0x34, 0x28, 0x1F, 0x4E, 0x02, 0x6F, 0x24,
-    0xD6, 0x20, 0x60, 0x8D, 0xA1, 0x61, 0x58, 0xD7, 0x9E, 0xB7, 0x2E, 0x02, 0x3C, 0x37, 0xD1, 0xAA,
-    0x98, 0x31, 0xE0, 0x09, 0xB6, 0x4C, 0xC5, 0x28, 0x44, 0xA1, 0x26, 0x3F, 0xAE, 0x1F, 0xCA, 0x91,
-    0xB7, 0xA0, 0xCF, 0x1A, 0xB7, 0x18, 0x42, 0xAE, 0xC6, 0x42, 0x29, 0xAF, 0x6C, 0x70, 0x3B, 0x64,
-    0x8C, 0x33, 0xB9, 0x56, 0x78, 0x1D, 0xE2, 0x41, 0xEC, 0xA3, 0xD0, 0xAA, 0xB8, 0xDE, 0xC5, 0x5D,
-    0x6A, 0xEE, 0x29, 0x89, 0xA8, 0x45, 0x21, 0xB6, 0x64, 0x4E, 0x30, 0x0D, 0x03, 0x3D, 0xB3, 0xEB,
-    0x90, 0x15, 0x77, 0x9E, 0xAD, 0x15, 0xF0, 0xBD, 0xBC, 0x26, 0xEC, 0x56, 0x1F, 0xFC, 0x70, 0x07,
-    0x83, 0xD2, 0xA5, 0xB6, 0x16, 0xCB, 0x8C, 0xC2, 0xDB, 0x1C, 0x2A, 0xDD, 0x18, 0x45, 0xBB, 0x20,
-    0xCA, 0x04, 0xC1, 0x66, 0x4E, 0xDD, 0x73, 0xEB, 0xD0, 0x1A, 0x87, 0xF9, 0x8F, 0x07, 0xB8, 0x07,
-    0xE3, 0xFB, 0x53, 0xC3, 0x8C, 0x58, 0x3B, 0xEF, 0x3D, 0xB4, 0x00, 0x07, 0x4A, 0x87, 0x84, 0xC8,
-    0xE2, 0xFB, 0x84, 0x9C, 0x41, 0x9F, 0x1E, 0xE8, 0xDC, 0x37, 0x4D, 0xFB, 0x89, 0x4F, 0x1C, 0xAF,
-    0x6C, 0x57, 0x59, 0xE8, 0x58, 0x29, 0xCD, 0x88, 0x2D, 0x36, 0x44, 0x1A, 0x7E, 0x03, 0x06, 0xFE,
-    0xDF, 0x41, 0xC1, 0x70, 0x5C, 0x1D, 0xAF, 0x5B, 0xBD, 0x33, 0xD1, 0xF2, 0xE4, 0x00, 0x8C, 0xAC,
-    0x34, 0x3C, 0x72, 0x39, 0x77, 0xE9, 0xA5, 0xF9, 0x6E, 0x9D, 0x35, 0x0D, 0x1B, 0xFF, 0x4B, 0x3C,
-    0x50, 0x41, 0x65, 0x13, 0x47, 0xB6, 0x09, 0xF7, 0x09, 0x15, 0x17, 0x2B, 0x72, 0xE9, 0x15, 0x61,
-    0x46, 0xDC, 0x85, 0xE7, 0xE1, 0xA6, 0x17, 0xFB, 0x54, 0xB8, 0xD0, 0x04, 0x17, 0xD0, 0xEA, 0x76,
-    0xED, 0x8A, 0xCB, 0xBE, 0x34, 0xD0, 0x11, 0x71, 0x11, 0x66, 0x8A, 0xED, 0x2E, 0xE8, 0x6E, 0x8C,
-    0x0D, 0x56, 0xF6, 0x7D, 0x0D, 0x9A, 0x86, 0x5F, 0x85, 0x0F, 0x7B, 0x80, 0x67, 0xEB, 0xFB, 0x0C,
-    0xCC, 0x73, 0x6C, 0x55, 0xC6, 0x8D, 0xD5, 0x46, 0x8C, 0xA1, 0x40, 0x57, 0x85, 0xC4, 0x36, 0xD2,
-    0xC2, 0x1D, 0x2D, 0xFC, 0x02, 0x39, 0xEA, 0xC2, 0xC1, 0x81, 0x9D, 0xF5, 0x98, 0x1D, 0x1D, 0x25,
-    0xD5, 0xC2, 0x8F, 0x5D, 0xCE, 0xA6, 0xD5, 0x32, 0xC9, 0xE9, 0xE5, 0xE6, 0x49, 0x97, 0xE3, 0x93,
-    0xCB, 0xE1, 0x75, 0x91, 0x41, 0x42, 0x49, 0x44, 0x86, 0xE5, 0x03, 0xEB, 0x61, 0x0B, 0x6B, 0xD3,
-    0x11, 0x6A, 0x45, 0x6C, 0xC0, 0x66, 0x0D, 0x73, 0x88, 0xCB, 0x56, 0xC4, 0x56, 0x8F, 0x41, 0x4B,
-    0xA9, 0x31, 0x1E, 0x20, 0x04, 0x09, 0x26, 0xB6, 0x6B, 0xD6, 0xE4, 0x08, 0xAA, 0x0A, 0x31, 0xB9,
-    0x28, 0x31, 0x81, 0x8C, 0xBE, 0xF3, 0x03, 0x14, 0x5E, 0xDF, 0x2F, 0x15, 0x10, 0x6D, 0x44, 0x2D,
-    0x8A, 0x8F, 0xDD, 0x85, 0xE2, 0x24, 0x6C, 0x06, 0xCE, 0x57, 0x71, 0xE5, 0xBD, 0xB2, 0x85, 0xCA,
-    0x3E, 0xB0, 0x26, 0x1B, 0xA1, 0xAF, 0x85, 0xB1, 0x7F, 0x0B, 0x01, 0xFE, 0x6B, 0x66, 0x3C, 0xB8,
-    0xB8, 0xE4, 0xF3, 0xA1, 0xBD, 0xC8, 0xA9, 0xCC, 0x8E, 0x41, 0x53, 0xB8, 0xF7, 0xDA, 0x8B, 0x73,
-    0xF0, 0x9C, 0x48, 0xD4, 0xDF, 0x90, 0x00, 0xF3, 0xB7, 0x8C, 0x1E, 0xD6, 0xCB, 0x72, 0x5A, 0x4E,
-    0xCC, 0xF0, 0x0C, 0xA4, 0x82, 0x42, 0x72, 0xBC, 0x55, 0x04, 0xCC, 0xC7, 0x5F, 0x19, 0x73, 0xAB,
-    0x1A, 0xCF, 0xD2, 0x03, 0xE1, 0xED, 0xD1, 0x75, 0xAA, 0x3A, 0x0F, 0xFF, 0x46, 0xF7, 0xE4, 0x87,
-    0x4E, 0x36, 0x42, 0x50, 0x84, 0x85, 0xE1, 0xC1, 0x40, 0x1A, 0xD0, 0x14, 0x59, 0xBA, 0xD8, 0x9C,
-    0x09, 0x42, 0xEC, 0x56, 0x97, 0xC9, 0xC9, 0x6A, 0x4B, 0xB1, 0x93, 0xBE, 0x3B, 0x7C, 0x45, 0xDA,
-    0x30, 0x07, 0xAF, 0x8C, 0xED, 0x3E, 0x41, 0x71, 0xE0, 0xA0, 0x8E, 0xAA, 0x6A, 0xB1, 0xAF, 0x89,
-    0x06, 0xA2, 0xB3, 0x33, 0x2B, 0x79, 0xEA, 0xBB, 0x47, 0x47, 0x47, 0x6F, 0x40, 0x05, 0xBF, 0xA3,
-    0x77, 0xD8, 0x29, 0x10, 0xB8, 0xE8, 0xE0, 0xE0, 0xE0, 0xEA, 0x79, 0xAE, 0xE0, 0x78, 0xC6, 0x54,
-    0xB1, 0xE2, 0x38, 0x27, 0x66, 0x26, 0x43, 0x9A, 0x77, 0x11, 0xE3, 0x5F, 0xF0, 0x98, 0xD0, 0x1D,
-    0x00, 0x35, 0x7B, 0x48, 0x84, 0x75, 0xA3, 0x9A, 0xE6, 0x98, 0x21, 0xCC, 0x9D, 0x80, 0xE3, 0x7F,
-    0x7B, 0x36, 0xC3, 0x80, 0xAF, 0xC0, 0x8E, 0x53, 0x1A, 0x3C, 0xB5, 0xFF, 0x3B, 0xF8, 0x49, 0x11,
-    0x9D, 0x82, 0x27, 0xF1, 0x0B, 0x2E, 0xC2, 0x38, 0xC1, 0xD4, 0xF4, 0x38, 0x84, 0x27, 0x63, 0x35,
-    0x19, 0xCF, 0xAB, 0xBA, 0x0B, 0x38, 0x8B, 0xE1, 0x74, 0x44, 0x92, 0xC7, 0xD3, 0xE1, 0xCE, 0x3F,
-    0x7F, 0xA6, 0xFB, 0x26, 0xE0, 0x26, 0xEE, 0x11, 0x02, 0xFE, 0xEB, 0x15, 0x0C, 0xA6, 0xEB, 0x02,
-    0xCE, 0x14, 0x01, 0x3D, 0x48, 0xF8, 0xC2, 0x95, 0xFD, 0xB8, 0x87, 0x8F, 0xDA, 0x0B, 0xC8, 0x9B,
-    0x20, 0xD0, 0xE5, 0x09, 0x99, 0xD3, 0x03, 0x8B, 0x90, 0x7B, 0xD5, 0x55, 0x1D, 0x4D, 0xBE, 0x32,
-    0xB7, 0xE0, 0xBF, 0xCB, 0xB3, 0x9B, 0x77, 0x53, 0xF9, 0xC2, 0x14, 0x01, 0xEB, 0xCB, 0x78, 0x8C,
-    0xA7, 0x78, 0xE4, 0x7F, 0x63, 0xD2, 0xE3, 0xBF, 0x74, 0xCC, 0xBA, 0xF2, 0x85, 0xE5, 0x70, 0xAE,
-    0x1B, 0xFF, 0xBA, 0x2D, 0x24, 0xA2, 0xA6, 0x1E, 0xA0, 0xF5, 0xBC, 0x7D, 0xB6, 0x7A, 0xF6, 0xBA,
-    0xB8, 0x9D, 0xDA, 0x0F, 0xEC, 0x19, 0xC3, 0x8D, 0xDF, 0x21, 0x98, 0x48, 0x30, 0x8A, 0xC9, 0xEB,
-    0x51, 0xBD, 0x5C, 0x3F, 0xBB, 0x3B, 0x02, 0x38, 0x02, 0x83, 0x2C, 0xA7, 0x50, 0xA3, 0x2D, 0xD2,
-    0x87, 0xD8, 0xE7, 0x7E, 0x26, 0xD0, 0x2D, 0xCC, 0x50, 0xEC, 0x65, 0x0C, 0xB2, 0x1B, 0xCC, 0x34,
-    0x5A, 0x68, 0xC1, 0xF7, 0x4C, 0x86, 0x06, 0xA8, 0x89, 0x5E, 0x4A, 0x47, 0xAA, 0x95, 0x55, 0xD1,
-    0x8B, 0x03, 0xA1, 0x18, 0x17, 0xB5, 0xD6, 0xDF, 0x3D, 0x38, 0x1C, 0x40, 0x3B, 0xF1, 0x4C, 0x18,
-    0xB0, 0x1F, 0x53, 0xEF, 0xBF, 0x26, 0x47, 0x2D, 0x98, 0x85, 0xA1, 0x67, 0x0F, 0x0A, 0x86, 0xD4,
-    0xEC, 0x84, 0x6B, 0x4E, 0x8F, 0xFB, 0xBB, 0xAF, 0x92, 0x4C, 0x61, 0x2C, 0x90, 0x96, 0xA2, 0x92,
-    0x5F, 0x1A, 0x7E, 0xB9, 0xFB, 0x0A, 0x09, 0x11, 0xBB, 0xD9, 0x33, 0xF8, 0xF9, 0x0C, 0x4C, 0xF7,
-    0x79, 0xCD, 0x8A, 0x22, 0xB6, 0x02, 0x68, 0x5F, 0x76, 0x09, 0x69, 0x17, 0x53, 0x63, 0x38, 0x39,
-    0xB7, 0xF0, 0x48, 0xFC, 0x1A, 0xE1, 0x14, 0x81, 0xBC, 0x8B, 0xD7, 0x75, 0x96, 0x2D, 0xA8, 0x31,
-    0xD5, 0xFD, 0xD5, 0x84, 0x7E, 0x45, 0x4E, 0xA3, 0x9F, 0x1F, 0x16, 0x19, 0x74, 0x02, 0xAE, 0x72,
-    0x2B, 0x74, 0x89, 0xF6, 0xE8, 0x07, 0x81, 0xA7, 0x02, 0x9B, 0x0A, 0x9E, 0x45, 0x06, 0xE1, 0x0E,
-    0xA1, 0x76, 0xBB, 0x58, 0xAD, 0xA4, 0x48, 0xF2, 0x79, 0xAE, 0x08, 0x0B, 0x7B, 0xAE, 0x13, 0xCB,
-    0x10, 0x39, 0xD7, 0x0D, 0x21, 0x97, 0xDA, 0x67, 0xF2, 0x1F, 0x72, 0x34, 0x35, 0x10, 0x87, 0xEC,
-    0xE9, 0x2E, 0x08, 0x13, 0x73, 0xFB, 0x49, 0x9E, 0xD4, 0x60, 0x67, 0x98, 0x99, 0x59, 0x41, 0x0B,
-    0x85, 0x24, 0x4B, 0xC4, 0x8F, 0x1D, 0x36, 0x9D, 0xCC, 0xA4, 0x0A, 0x68, 0x1B, 0xE9, 0x29, 0xE0,
-    0x1A, 0x33, 0x35, 0x78, 0xC0, 0x8F, 0x09, 0x49, 0xC2, 0x11, 0xCB, 0x3A, 0xA6, 0x1E, 0x50, 0xE2,
-    0xBB, 0x08, 0x26, 0xEA, 0x42, 0x99, 0xB0, 0x36, 0x3C, 0x72, 0xB1, 0x3B, 0x92, 0x01, 0x0B, 0x67,
-    0x7C, 0xCB, 0x45, 0x5B, 0x7A, 0xBB, 0x7B, 0x70, 0x25, 0x6C, 0x49, 0x3B, 0x66, 0x3A, 0x10, 0xB6,
-    0x69, 0xBF, 0x24, 0xA9, 0x41, 0xFB, 0x4A, 0x86, 0xC4, 0x5E, 0xB1, 0x1D, 0x1D, 0x05, 0x4D, 0x30,
-    0xD5, 0x08, 0x2E, 0x28, 0x45, 0x88, 0x00, 0xF4, 0xF6, 0xE8, 0xEC, 0x0A, 0x9B, 0xC7, 0xD7, 0x1D,
-    0xBE, 0x65, 0xDD, 0x86, 0x7A, 0xFA, 0xFC, 0x48, 0xC1, 0xE6, 0xD6, 0x75, 0xC3, 0xE2, 0xFF, 0x73,
-    0x76, 0xDD, 0xE9, 0xFC, 0xBA, 0xE3, 0x66, 0x2E, 0xCD, 0xE9, 0xFB, 0x53, 0xE7, 0x07, 0x7E, 0x5C,
-    0xD7, 0x64, 0x2D, 0x1D, 0x56, 0x32, 0x10, 0x50, 0xEE, 0x5C, 0x44, 0x9A, 0x87, 0x0C, 0x9B, 0xBA,
-    0x5F, 0xF3, 0x1C, 0xB1, 0x52, 0x98, 0x0F, 0xFA, 0xBD, 0x70, 0x70, 0x25, 0x87, 0x97, 0x81, 0xF7,
-    0x0A, 0x8F, 0x72, 0x09, 0xDE, 0x07, 0x36, 0x70, 0xAF, 0x59, 0x87, 0xC9, 0x93, 0x39, 0xA6, 0x39,
-    0x1A, 0x1F, 0xC2, 0x03, 0xB9, 0x1D, 0xA8, 0xB8, 0x00, 0x26, 0x33, 0x24, 0x8A, 0x60, 0xDB, 0x54,
-    0x60, 0x98, 0xC9, 0x0D, 0x95, 0xAB, 0xB0, 0xAE, 0xA0, 0xE7, 0x0A, 0xC4, 0x07, 0xBE, 0xFB, 0xF0,
-    0xDE, 0xF3, 0x22, 0xDE, 0x71, 0x91, 0x46, 0xED, 0xA9, 0x0D, 0x72, 0x4D, 0x23, 0xA7, 0xF8, 0xFC,
-    0xA8, 0xEE, 0x28, 0xBE, 0x08, 0x6B, 0xCD, 0x3B, 0xD6, 0x0A, 0x87, 0xAE, 0x03, 0xBF, 0x80, 0x56,
-    0x20, 0x4E, 0x32, 0x2B, 0xDC, 0xC2, 0xFB, 0x44, 0x55, 0xD1, 0x85, 0x1E, 0x59, 0xB0, 0x3F, 0x5D,
-    0x10, 0x76, 0x98, 0xF5, 0x57, 0x4A, 0x29, 0x77, 0x64, 0x59, 0x2A, 0x98, 0xFA, 0x55, 0xA6, 0xB3,
-    0xFE, 0x71, 0x2C, 0x55, 0x4B, 0xA5, 0x6E, 0x7F, 0x34, 0x1A, 0x6D, 0xA6, 0xAA, 0xAD, 0x11, 0xDB,
-    0x91, 0x3C, 0x4A, 0x65, 0x7D, 0x84, 0x07, 0xC1, 0x2B, 0x33, 0xF6, 0x90, 0x1C, 0x34, 0x61, 0x9A,
-    0x90, 0xD1, 0x9D, 0xE4, 0x82, 0xFD, 0xEA, 0x49, 0x9C, 0xE9, 0x91, 0x71, 0xD5, 0x96, 0x1A, 0xAC,
-    0xD6, 0x7C, 0xC2, 0xB8, 0x69, 0x65, 0xD9, 0x7C, 0x1B, 0x87, 0x48, 0x7C, 0xFA, 0x90, 0xFB, 0xA7,
-    0xE6, 0xAC, 0x0F, 0x35, 0xA4, 0xBF, 0xBF, 0x39, 0x02, 0xF4, 0x0F, 0xE2, 0x24, 0x82, 0x0C, 0x78,
-    0x06, 0x11, 0x23, 0x48, 0x01, 0xDB, 0xF5, 0xA9, 0x78, 0x81, 0x8E, 0x50, 0xB6, 0x0C, 0xE7, 0xFA,
-    0x03, 0x15, 0xA9, 0x37, 0x95, 0x51, 0xDE, 0x62, 0xAE, 0x69, 0x6F, 0x8D, 0x0A, 0x5F, 0xA5, 0xA7,
-    0xA6, 0x0D, 0x98, 0xF2, 0xE4, 0x63, 0xA2, 0xE8, 0xC2, 0x28, 0x48, 0xE6, 0x84, 0xDC, 0x30, 0xED,
-    0x95, 0xA0, 0xC7, 0xCA, 0xCD, 0xE9, 0x1A, 0x2C, 0x1D, 0x1A, 0x0A, 0xA9, 0x05, 0xB9, 0x69, 0xBC,
-    0x73, 0x6F, 0xCC, 0x2D, 0x1F, 0xD3, 0x6D, 0xF7, 0x44, 0xDD, 0x92, 0xD1, 0x76, 0x01, 0x4F, 0xCF,
-    0x99, 0x29, 0x3D, 0x6B, 0x26, 0x38, 0x37, 0xE3, 0x8B, 0xE1, 0xA5, 0x10, 0x63, 0x42, 0xBC, 0xA7,
-    0xD7, 0x60, 0x0D, 0x99, 0xB8, 0x22, 0xFC, 0xC7, 0xC2, 0x03, 0x38, 0x01, 0x0B, 0x5F, 0x7A, 0x10,
-    0x4B, 0x04, 0x38, 0x1E, 0x1C, 0x6B, 0x31, 0x97, 0x80, 0x15, 0xFC, 0x31, 0x7C, 0xAF, 0x6C, 0x92,
-    0xAF, 0xE1, 0x41, 0x5F, 0xC3, 0x96, 0xCC, 0x96, 0xF3, 0x26, 0xBF, 0x0D, 0x57, 0xFA, 0x8A, 0x8C,
-    0x05, 0x0F, 0x04, 0xA3, 0xBD, 0x84, 0x81, 0x9F, 0xCE, 0x69, 0xCF, 0x2E, 0x4F, 0xF6, 0xE1, 0x8C,
-    0x72, 0xAA, 0x7C, 0x77, 0xF6, 0xEF, 0xB2, 0xF9, 0x93, 0x7D, 0x34, 0xA0, 0x16, 0xB3, 0x6B, 0x0B,
-    0xEA, 0x19, 0xD4, 0x59, 0x29, 0x60, 0x0B, 0x7E, 0x5C, 0xD8, 0xA4, 0x7E, 0x10, 0xC4, 0xE2, 0x14,
-    0x28, 0xD7, 0xD9, 0x26, 0xEA, 0x84, 0x77, 0x31, 0xDF, 0xA8, 0x8F, 0x94, 0x29, 0x33, 0x44, 0xEE,
-    0x59, 0xAD, 0xE5, 0x24, 0x6F, 0x09, 0x9C, 0x12, 0x35, 0x10, 0x65, 0x15, 0x4D, 0x9A, 0x51, 0x5A,
-    0xC8, 0xE4, 0x92, 0x07, 0xC6, 0xA2, 0xCF, 0x5E, 0x1D, 0x90, 0xEA, 0xA4, 0x03, 0x32, 0x79, 0x3C,
-    0x99, 0x4C, 0x7C, 0xB2, 0x87, 0x21, 0xB1, 0x48, 0xBC, 0x28, 0xEF, 0xCB, 0x25, 0xA5, 0x28, 0xAE,
-    0x6C, 0xD2, 0xFB, 0x46, 0xF7, 0xB6, 0x8F, 0x19, 0x61, 0x7B, 0xE6, 0xF0, 0x9C, 0x9C, 0x02, 0xC6,
-    0xA6, 0x7E, 0x55, 0xC6, 0x18, 0x93, 0xCA, 0x58, 0xF9, 0xE3, 0xC9, 0x65, 0x65, 0xD0, 0xF0, 0x62,
-    0xB2, 0x42, 0x10, 0x69, 0x84, 0x4B, 0x8D, 0xD8, 0x04, 0x42, 0xA2, 0x14, 0x22, 0x9D, 0xC0, 0x95,
-    0x30, 0x57, 0x36, 0x29, 0xD5, 0xE8, 0x69, 0x66, 0x64, 0x87, 0x1C, 0xFA, 0x22, 0xDD, 0x62, 0xCE,
-    0x19, 0x77, 0xBD, 0xBC, 0xEB, 0x06, 0xED, 0xC8, 0x7A, 0x04, 0xB9, 0x9C, 0x2A, 0xB8, 0x16, 0x97,
-    0x13, 0x93, 0x47, 0xB2, 0xF0, 0x8C, 0x85, 0x29, 0xE5, 0x2C, 0xC0, 0xEA, 0xB8, 0x4C, 0x28, 0x27,
-    0xDA, 0x35, 0x25, 0x0B, 0xE5, 0x3E, 0x16, 0xBC, 0xEF, 0x4E, 0xB9, 0x92, 0x55, 0xA6, 0x50, 0xFD,
-    0x55, 0x81, 0x80, 0xF8, 0x35, 0x27, 0xBF, 0x26, 0xD4, 0xF0, 0x8E, 0x5C, 0xE9, 0x98, 0xCE, 0x46,
-    0x6C, 0x96, 0xFC, 0xAF, 0x0D, 0x3B, 0x0D, 0xDF, 0x98, 0x02, 0x82, 0x2F, 0x3F, 0x5F, 0x01, 0xF6,
-    0x51, 0xC6, 0x13, 0xC2, 0x3E, 0x7A, 0xE7, 0x8F, 0xD3, 0xC9, 0x3E, 0xE8, 0x64, 0xFC, 0xA3, 0x74,
-    0xD2, 0x48, 0x27, 0x05, 0x82, 0xF6, 0x44, 0x27, 0x75, 0xD0, 0x49, 0x1B, 0xD8, 0x3C, 0x14, 0xD7,
-    0xAA, 0xDD, 0x11, 0xA2, 0xA5, 0x80, 0xC7, 0x4B, 0x3F, 0x62, 0xE6, 0x00, 0xEA, 0xAA, 0x3C, 0xDC,
-    0xEE, 0xA8, 0x5A, 0x99, 0x38, 0xE3, 0xE3, 0xF9, 0xBA, 0x6D, 0x22, 0xE2, 0x21, 0x52, 0x8F, 0x1E,
-    0x01, 0x5C, 0x76, 0xCC, 0xB9, 0x5B, 0xA5, 0x16, 0x09, 0xDF, 0xD2, 0x99, 0x5C, 0x3B, 0x45, 0x5B,
-    0xEE, 0xD3, 0x88, 0xDA, 0x63, 0x3E, 0xB5, 0x5F, 0xA0, 0x8F, 0x64, 0xDE, 0x13, 0x75, 0x05, 0xBA,
-    0xCC, 0xE4, 0x59, 0xF7, 0x33, 0xE4, 0x5B, 0x84, 0x75, 0xDD, 0x33, 0xD4, 0xF5, 0x36, 0x6E, 0xE9,
-    0xAA, 0xCA, 0xF2, 0xB5, 0x70, 0xAC, 0x35, 0x5D, 0xF5, 0x83, 0x50, 0xFC, 0x84, 0x82, 0xB0, 0x5A,
-    0x73, 0x91, 0x34, 0xA8, 0x94, 0x38, 0xA8, 0x02, 0x8F, 0x6F, 0xFA, 0x9A, 0xA9, 0x76, 0x9F, 0xB7,
-    0x5D, 0xD6, 0xA1, 0xCF, 0xF1, 0x6F, 0xC0, 0x36, 0xCA, 0xD8, 0xB1, 0x6A, 0xE1, 0xF6, 0x3A, 0xF7,
-    0x9C, 0xB2, 0x8F, 0xAB, 0x81, 0x95, 0xAD, 0x27, 0x35, 0xDD, 0x60, 0x02, 0x4B, 0x62, 0x1A, 0x2E,
-    0xBD, 0xBA, 0x1C, 0x14, 0xC1, 0xB2, 0x9C, 0xF9, 0x7C, 0x43, 0x20, 0x94, 0xBE, 0xD3, 0x49, 0x3D,
-    0x5E, 0xAD, 0x96, 0x3F, 0x19, 0x2E, 0x34, 0xCE, 0xC7, 0xB5, 0xEC, 0x3B, 0x33, 0x7C, 0xAB, 0x69,
-    0x09, 0x5A, 0x75, 0x23, 0xD2, 0x59, 0x99, 0xB2, 0x0F, 0x39, 0x1B, 0xDB, 0x76, 0xC4, 0xC1, 0xC0,
-    0x56, 0x04, 0xEA, 0x5E, 0x64, 0xA5, 0x4C, 0xA7, 0xCD, 0x03, 0x9F, 0x9E, 0x7F, 0xA0, 0xE2, 0x03,
-    0x43, 0x42, 0x92, 0xA3, 0x74, 0x25, 0x9F, 0xC5, 0x37, 0xB2, 0x22, 0xE2, 0xB7, 0x28, 0xC7, 0x90,
-    0xD0, 0x85, 0xF4, 0x32, 0xB1, 0x50, 0x55, 0x50, 0x36, 0xB1, 0x2E, 0x99, 0x69, 0xC6, 0xE4, 0xE9,
-    0x24, 0x14, 0x66, 0x3F, 0xAF, 0xAF, 0xB9, 0x56, 0x4D, 0xD6, 0x26, 0x12, 0x01, 0x8E, 0x62, 0x96,
-    0x58, 0xAC, 0x8B, 0x99, 0x76, 0x79, 0x9A, 0xCE, 0x33, 0xD5, 0xF2, 0x5D, 0xC9, 0xA6, 0x20, 0x1D,
-    0xFA, 0x13, 0x08, 0x95, 0x33, 0xAF, 0xCD, 0x7F, 0xCB, 0xC4, 0xEE, 0x0B, 0x02, 0xEE, 0xF1, 0xB0,
-    0xE5, 0xD2, 0xD4, 0x42, 0x4A, 0xC5, 0xC8, 0x6A, 0x4A, 0x28, 0x2D, 0x34, 0x15, 0x8F, 0xC7, 0x40,
-    0xC3, 0xCC, 0xA3, 0xB0, 0xE0, 0xAD, 0x91, 0xF9, 0x46, 0x36, 0x10, 0x78, 0xD9, 0x2E, 0x82, 0x0F,
-    0xA8, 0x63, 0x54, 0x61, 0x8A, 0x64, 0x4A, 0x51, 0xB2, 0x22, 0x4E, 0xAB, 0xBA, 0xF2, 0xC7, 0x10,
-    0x22, 0x19, 0xF7, 0x0F, 0xE8, 0x58, 0x75, 0x63, 0x79, 0x0B, 0xF9, 0xA6, 0xEC, 0x2B, 0x26, 0xD9,
-    0xF5, 0x8D, 0x39, 0x6F, 0x89, 0xB3, 0x00, 0x5C, 0xC0, 0x5F, 0xFD, 0xFE, 0x98, 0xDD, 0x5E, 0x50,
-    0xD0, 0x58, 0x34, 0x63, 0xC5, 0xFA, 0xCD, 0x2E, 0xFB, 0x18, 0x99, 0xC6, 0xC3, 0x29, 0x9A, 0x19,
-    0x36, 0x2C, 0xEC, 0x49, 0x85, 0x83, 0xCA, 0xFA, 0x92, 0xBE, 0xD1, 0x04, 0x5A, 0x60, 0xF9, 0x32,
-    0xC9, 0x9D, 0x98, 0xFD, 0x6C, 0xB9, 0x4F, 0x4C, 0xD1, 0x8A, 0x9D, 0x12, 0x4F, 0x8A, 0x9C, 0x11,
-    0x45, 0x64, 0x2B, 0xD1, 0x92, 0x5A, 0x40, 0x53, 0x29, 0x06, 0x0C, 0xFE, 0x27, 0x55, 0xA7, 0x8A,
-    0xBE, 0x58, 0xEF, 0x4E, 0x9D, 0x9C, 0x80, 0x09, 0x42, 0x56, 0xBE, 0x4F, 0x6A, 0xB1, 0xA9, 0xB3,
-    0x33, 0xA9, 0x07, 0xA4, 0x72, 0x21, 0x5D, 0xE8, 0x1D, 0x2C, 0x70, 0x55, 0xAA, 0x6D, 0xCB, 0x57,
-    0x6A, 0x8C, 0xF5, 0x62, 0x4F, 0x16, 0x1E, 0x2E, 0xFF, 0x9A, 0x22, 0xDD, 0x5C, 0xC2, 0x63, 0x4C,
-    0xC1, 0x14, 0xA5, 0x1E, 0x29, 0xDC, 0x65, 0x02, 0x34, 0x84, 0x0C, 0xF6, 0x7D, 0xA8, 0x3D, 0x12,
-    0x39, 0xC4, 0x94, 0x5B, 0x35, 0x99, 0x6D, 0xCE, 0x19, 0x9D, 0xF6, 0x07, 0xCF, 0xFB, 0xF2, 0xB0,
-    0x35, 0x18, 0x05, 0x6E, 0x84, 0x17, 0xF6, 0xB0, 0xD8, 0x4A, 0x58, 0xFB, 0x81, 0x93, 0xBB, 0x74,
-    0x50, 0x6A, 0x17, 0xDC, 0x1D, 0x0B, 0x07, 0x91, 0x55, 0x30, 0x76, 0x62, 0x5B, 0x0E, 0xA9, 0x9A,
-    0x20, 0x0E, 0x21, 0xD5, 0x30, 0x18, 0x5A, 0x2E, 0xDA, 0x6D, 0x38, 0xA4, 0x2A, 0x58, 0xB8, 0x24,
-    0xA0, 0xA2, 0xE3, 0x56, 0xF9, 0xDA, 0xEF, 0xB1, 0x21, 0xD6, 0x3A, 0x98, 0xA8, 0x57, 0xA1, 0xC6,
-    0xAC, 0x77, 0xF9, 0x19, 0x29, 0x89, 0x1D, 0x63, 0x96, 0xCC, 0x2C, 0xFE, 0x54, 0xAC, 0x85, 0x02,
-    0x96, 0x65, 0x2A, 0xF7, 0x39, 0x85, 0x02, 0xF6, 0xCC, 0x20, 0x38, 0x02, 0xDB, 0xC2, 0xC9, 0x70,
-    0x32, 0x88, 0xDD, 0xCF, 0xBC, 0x93, 0x5F, 0x8A, 0x51, 0x21, 0x18, 0x2D, 0x74, 0x70, 0x95, 0x83,
-    0xD9, 0xD5, 0x07, 0x01, 0xE6, 0x6D, 0x32, 0x46, 0xCB, 0x99, 0xEF, 0x1D, 0xEB, 0x59, 0xAC, 0x88,
-    0xEF, 0xB0, 0x03, 0xBF, 0xE3, 0x32, 0xBF, 0x0F, 0x2A, 0xE0, 0xA5, 0xE1, 0x4C, 0x89, 0xB5, 0x8B,
-    0xDE, 0xFA, 0x46, 0x29, 0xD8, 0x6A, 0xE5, 0x71, 0xCC, 0x59, 0x29, 0x8A, 0x20, 0x35, 0x07, 0x55,
-    0x67, 0x07, 0x9D, 0xDF, 0xDA, 0x4E, 0xD9, 0x49, 0xAF, 0x64, 0xE5, 0x40, 0x5D, 0x13, 0x76, 0x1D,
-    0xA2, 0x79, 0x6D, 0xB3, 0x25, 0x6A, 0xB4, 0xF0, 0x41, 0x46, 0x39, 0x72, 0x15, 0xB7, 0x64, 0x88,
-    0xB9, 0x86, 0xE7, 0x3F, 0x58, 0x1F, 0x3B, 0xC1, 0x97, 0x98, 0xE7, 0x21, 0xAC, 0xBD, 0x77, 0x13,
-    0x0F, 0x33, 0xDE, 0xFB, 0x99, 0x73, 0xBF, 0x60, 0x9E, 0x04, 0x5D, 0x7F, 0x72, 0x70, 0x70, 0xE0,
-    0xBE, 0xFB, 0xDF, 0x7E, 0x48, 0xC7, 0x3D, 0xC2, 0xC5, 0xBD, 0xE3, 0xA2, 0x9F, 0xD0, 0x3E, 0x18,
-    0x98, 0xD8, 0xAC, 0x02, 0x77, 0xDC, 0xDB, 0x17, 0xC8, 0x5F, 0xC0, 0x5D, 0xCF, 0xB3, 0x0F, 0x9C,
-    0x2C, 0x01, 0xCF, 0xD9, 0x59, 0xDA, 0xCF, 0x24, 0xD7, 0x5E, 0xF9, 0x5D, 0x0D, 0xDC, 0x05, 0x52,
-    0xF9, 0x91, 0xFF, 0xB5, 0xA9, 0x41, 0x21, 0x22, 0x96, 0xD2, 0xDE, 0x44, 0x56, 0x3C, 0x40, 0x27,
-    0xEA, 0x58, 0x5C, 0xB8, 0x7A, 0xAE, 0x41, 0xF8, 0x38, 0xA6, 0x66, 0xC3, 0x33, 0x58, 0xFF, 0x7D,
-    0x75, 0xB6, 0x44, 0x12, 0xD8, 0xC3, 0x52, 0x32, 0x8F, 0xF4, 0x3A, 0xEB, 0x68, 0xD9, 0xF8, 0x2A,
-    0x50, 0xBF, 0xCC, 0x7B, 0xB2, 0x16, 0xB3, 0x9F, 0x86, 0x75, 0x33, 0xDC, 0x36, 0x1F, 0xC4, 0x3D,
-    0xE5, 0x90, 0x2E, 0x3B, 0x7B, 0x60, 0xEC, 0x40, 0x80, 0xEE, 0x6F, 0x21, 0xF0, 0x17, 0xF9, 0x68,
-    0xA4, 0x72, 0xF8, 0x9F, 0x0A, 0x31, 0x65, 0xAD, 0x36, 0x23, 0xA4, 0xFD, 0xCD, 0xC0, 0x9B, 0xEA,
-    0x79, 0xAC, 0x69, 0x68, 0xB9, 0xA5, 0xF7, 0xEB, 0x1F, 0x3F, 0x97, 0x43, 0x54, 0x79, 0xAB, 0xD9,
-    0x23, 0x64, 0x6B, 0xAC, 0x62, 0x23, 0x72, 0x6D, 0x9A, 0x45, 0x57, 0xCF, 0xD7, 0x83, 0xA7, 0x75,
-    0xD9, 0x18, 0x28, 0x25, 0xFA, 0x09, 0x82, 0x2B, 0x5B, 0x88, 0x54, 0x56, 0x8B, 0x42, 0xA1, 0xAB,
-    0x8F, 0xA0, 0x24, 0x62, 0x3E, 0xD1, 0x85, 0x34, 0x21, 0xBC, 0x67, 0x2B, 0xD6, 0x91, 0x1F, 0x22,
-    0xC2, 0xF1, 0x8E, 0x11, 0x1E, 0x13, 0xE7, 0x49, 0xCB, 0x3D, 0x80, 0xC0, 0x2F, 0xCA, 0x5B, 0xE5,
-    0x13, 0xF7, 0xD8, 0xF7, 0xFB, 0xD1, 0xB0, 0xB5, 0x69, 0xFE, 0x81, 0xF9, 0xB1, 0x7A, 0x06, 0x3D,
-    0x7B, 0x0D, 0x6C, 0x00, 0xFE, 0x10, 0xBB, 0xFF, 0x04, 0xC0, 0x3A, 0xD6, 0x6D, 0x36, 0xFB, 0x07,
-    0xB5, 0x91, 0x05, 0x79, 0x13, 0xDA, 0xB9, 0x2E, 0x9A, 0xCB, 0xD4, 0xE0, 0x76, 0x3B, 0x67, 0xF7,
-    0x0F, 0xD9, 0x3F, 0xA0, 0x70, 0x53, 0xE0, 0x8E, 0xD0, 0x26, 0xBB, 0x70, 0x65, 0x6B, 0x99, 0xA8,
-    0xFF, 0xA5, 0xB4, 0x2B, 0x5D, 0xFE, 0x7E, 0x45, 0x89, 0x28, 0x94, 0xFF, 0x0A, 0x70, 0xDC, 0x8E,
-    0xC5, 0x3C, 0x0A, 0xE0, 0xBF, 0xB0, 0xA3, 0xF3, 0xDD, 0x82, 0x69, 0xD3, 0xD1, 0x2E, 0xD4, 0x99,
-    0xA7, 0x77, 0xC6, 0x6F, 0xBA, 0x23, 0x32, 0xDE, 0xCF, 0xE7, 0xEF, 0x94, 0x1B, 0x72, 0x24, 0x5C,
-    0x66, 0xA7, 0x9E, 0x4F, 0x2D, 0xBF, 0x59, 0xAB, 0x9C, 0xEF, 0x0B, 0x8C, 0x6E, 0x50, 0x4D, 0xBF,
-    0x55, 0x03, 0x1E, 0xF1, 0xFB, 0x80, 0xC0, 0xD2, 0xF0, 0x24, 0x22, 0xA4, 0x38, 0xBE, 0x57, 0x52,
-    0xCC, 0x7E, 0x41, 0x8B, 0x55, 0x6A, 0xA5, 0x2B, 0x4D, 0x8E, 0x91, 0x0D, 0x0B, 0xDE, 0x8A, 0xC9,
-    0x6B, 0x91, 0xAE, 0xFE, 0x67, 0xD0, 0xD0, 0x3D, 0x1E, 0x85, 0xDD, 0x3C, 0x6F, 0x62, 0x3C, 0xF3,
-    0xAF, 0x2C, 0xA4, 0x4A, 0x53, 0xD9, 0xA7, 0x8A, 0x0B, 0x23, 0x9E, 0x13, 0xCA, 0xFD, 0x21, 0x6E,
-    0x5E, 0xD0, 0xCD, 0x2B, 0xBA, 0x79, 0x95, 0x86, 0xA3, 0xA9, 0xC3, 0x99, 0xCD, 0x52, 0xFA, 0x23,
-    0xDC, 0x7C, 0xD0, 0xD9, 0x11, 0xAA, 0x29, 0xCA, 0x4B, 0x07, 0x51, 0xC0, 0x05, 0x37, 0xA7, 0xB8,
-    0x25, 0x90, 0x19, 0x1E, 0x92, 0x8D, 0xDA, 0x06, 0xA3, 0x22, 0x62, 0xF2, 0x25, 0x37, 0xF7, 0x2D,
-    0x13, 0x31, 0xC6, 0xA6, 0x7B, 0xE6, 0xE4, 0xD8, 0x74, 0x3B, 0x9E, 0x0E, 0xBD, 0x26, 0xA5, 0xC1,
-    0xCA, 0x8D, 0xD5, 0x42, 0xA2, 0x1D, 0x4E, 0x6F, 0x05, 0xC3, 0x32, 0xBD, 0x26, 0x90, 0xB1, 0xAA,
-    0xE3, 0x1F, 0xA1, 0x2B, 0x3A, 0xD3, 0x56, 0x3B, 0x5B, 0xB6, 0x95, 0x4F, 0x2E, 0xDB, 0x76, 0x2A,
-    0xDB, 0xDC, 0xB7, 0x97, 0x6D, 0x67, 0x2A, 0x40, 0x9D, 0x2C, 0x10, 0x97, 0xA9, 0xCD, 0x35, 0xBF,
-    0x93, 0x2E, 0x75, 0xBE, 0x25, 0x65, 0x86, 0x4E, 0xC9, 0x23, 0x5E, 0xB5, 0xDE, 0xE1, 0xA1, 0x3A,
-    0x0F, 0x33, 0x70, 0x27, 0x61, 0x77, 0x2C, 0x21, 0x80, 0xBE, 0x64, 0xAA, 0x64, 0xF1, 0xCC, 0x3D,
-    0x53, 0x2B, 0x46, 0xD5, 0x42, 0xB5, 0x96, 0xB1, 0xA1, 0xA8, 0x50, 0x7E, 0x34, 0x7A, 0xF6, 0x27,
-    0x18, 0x0F, 0x6C, 0x28, 0x39, 0xC5, 0xE6, 0xD6, 0x73, 0x23, 0x63, 0x41, 0x10, 0xA9, 0x46, 0xC7,
-    0x07, 0x41, 0x7B, 0xA8, 0xC4, 0x7E, 0x9F, 0x62, 0xB3, 0x27, 0x28, 0xF6, 0x7B, 0xEE, 0xE2, 0x15,
-    0x97, 0xBF, 0x67, 0x1D, 0x72, 0x8F, 0xF4, 0x2B, 0x9B, 0x11, 0x5C, 0xF1, 0x62, 0xF6, 0xB1, 0x01,
-    0xBF, 0xE6, 0x1A, 0x78, 0x5B, 0xD4, 0x23, 0xB2, 0x29, 0xA4, 0x83, 0x04, 0xBE, 0x8C, 0xC0, 0x67,
-    0x1D, 0x5B, 0x2E, 0x92, 0x27, 0xD8, 0x99, 0xB7, 0xE9, 0x1B, 0x9D, 0x00, 0x11, 0x63, 0x26, 0xB5,
-    0xCF, 0xE2, 0x65, 0x1D, 0x53, 0xC8, 0x4B, 0x6A, 0xF8, 0xCC, 0xA3, 0x63, 0x82, 0x4B, 0x05, 0x9E,
-    0xFF, 0x3E, 0x48, 0x21, 0x5F, 0x28, 0x04, 0xAE, 0x1D, 0x87, 0xF5, 0x07, 0x1E, 0xC3, 0x68, 0xE9,
-    0x02, 0xB4, 0x1C, 0x56, 0x0D, 0x18, 0xDF, 0xEA, 0x2C, 0x41, 0xF3, 0xC0, 0x43, 0xBB, 0xB0, 0xCC,
-    0x94, 0x70, 0xF3, 0xDC, 0x5B, 0x71, 0x32, 0x39, 0x71, 0x56, 0xA8, 0xC0, 0xF4, 0x48, 0xC5, 0x4A,
-    0x4F, 0x1A, 0x29, 0xB0, 0xE3, 0x89, 0x88, 0x77, 0x7A, 0x92, 0xC8, 0x26, 0x4D, 0xB9, 0x9D, 0x24,
-    0x52, 0x97, 0x2F, 0x12, 0xEB, 0x80, 0x76, 0x0B, 0xCF, 0x64, 0x9A, 0xF5, 0x4C, 0x66, 0x3A, 0x3D,
-    0x93, 0x61, 0x0D, 0x51, 0x50, 0x6A, 0x7C, 0x37, 0x1F, 0x4A, 0x2D, 0xFE, 0x1E, 0xE0, 0x4D, 0x23,
-    0x1B, 0xB2, 0xEB, 0x57, 0x48, 0xF5, 0xB4, 0x12, 0xF5, 0x9E, 0xF5, 0xDA, 0x73, 0xD8, 0x71, 0x36,
-    0xAD, 0x77, 0x98, 0x3E, 0x65, 0xD8, 0x1A, 0xC0, 0xFC, 0x8B, 0xD0, 0x4B, 0x82, 0xC1, 0xDF, 0xA2,
-    0xEB, 0x7D, 0xA8, 0x2C, 0xF9, 0xC2, 0x9A, 0x24, 0x9D, 0x29, 0xF5, 0xCE, 0x34, 0x44, 0x4F, 0xEF,
-    0x04, 0xBE, 0x2C, 0xCF, 0xF3, 0x25, 0xB0, 0x9D, 0x3C, 0x18, 0x89, 0x2F, 0xE7, 0x53, 0xBE, 0x8C,
-    0xC9, 0x97, 0x3A, 0xEE, 0xAF, 0xA9, 0x4B, 0xF2, 0x65, 0xAE, 0x71, 0x67, 0xF8, 0xD2, 0x5B, 0x49,
-    0xBE, 0x84, 0x3F, 0x7F, 0xE7, 0x89, 0xB0, 0x71, 0x36, 0x4B, 0x4B, 0xC3, 0x89, 0xD1, 0x3F, 0x3A,
-    0xF6, 0x22, 0xEC, 0x10, 0x7F, 0x35, 0xBB, 0xEF, 0x40, 0x8E, 0xFB, 0x4F, 0xC5, 0xCA, 0x59, 0xAB,
-    0x27, 0x47, 0xDD, 0x13, 0xFA, 0x2E, 0xDA, 0x5D, 0xF4, 0x73, 0xFD, 0x54, 0x21, 0x0A, 0xBF, 0xC5,
-    0x80, 0x1F, 0x44, 0x7D, 0xB2, 0x01, 0x80, 0xEA, 0xD5, 0x31, 0xD8, 0xB4, 0x0C, 0x19, 0x74, 0x48,
-    0xE9, 0xEA, 0xEE, 0x0A, 0xBC, 0xE1, 0x9D, 0x9F, 0xEA, 0x18, 0xB4, 0xAA, 0xE1, 0x48, 0x87, 0xE4,
-    0x81, 0xED, 0xF0, 0x9F, 0xC5, 0x42, 0x38, 0xDF, 0x67, 0xD1, 0x61, 0x93, 0xD7, 0xF9, 0xE2, 0x08,
-    0x86, 0x28, 0x00, 0x90, 0xC4, 0x77, 0x04, 0xB4, 0x3A, 0xE7, 0xEA, 0x14, 0x31, 0x92, 0x79, 0xE0,
-    0xAF, 0x4A, 0x99, 0xED, 0x25, 0x68, 0x84, 0xB4, 0xA4, 0xEE, 0x5A, 0xB4, 0x36, 0xB4, 0xCF, 0x43,
-    0x9E, 0x54, 0x9C, 0x33, 0xB6, 0x14, 0x00, 0x8F, 0xBA, 0x6B, 0x3E, 0xAA, 0x0F, 0xE0, 0x59, 0xD7,
-    0x82, 0x60, 0x27, 0xEA, 0xBD, 0xA3, 0xC2, 0x0B, 0x6F, 0xF7, 0x98, 0xA0, 0xBC, 0x01, 0xD0, 0xE1,
-    0xAF, 0x65, 0xD6, 0xF3, 0x0E, 0x62, 0x4D, 0xB2, 0xB0, 0x61, 0x73, 0x63, 0x51, 0x15, 0x1E, 0x9B,
-    0xEA, 0xAE, 0xBC, 0x67, 0x65, 0x26, 0x8F, 0xA2, 0xB3, 0xB3, 0x53, 0xDD, 0x33, 0x47, 0x3D, 0xEC,
-    0x5D, 0x7A, 0x8F, 0xBF, 0x85, 0xA8, 0x59, 0xA9, 0xAB, 0xBA, 0x25, 0xC2, 0x74, 0x2A, 0x2E, 0xD8,
-    0x97, 0x3C, 0xD3, 0x7E, 0x63, 0x3B, 0x02, 0x46, 0x9F, 0x59, 0x07, 0xC5, 0x3C, 0xD0, 0x43, 0x6D,
-    0x07, 0xD0, 0x4F, 0xC7, 0xF4, 0x18, 0x02, 0xD6, 0xD7, 0xE6, 0x39, 0x99, 0x93, 0xD1, 0xDF, 0x42,
-    0xD5, 0x5F, 0xFF, 0x70, 0x9C, 0x79, 0xFC, 0x50, 0xA7, 0xB7, 0xB1, 0xFA, 0x1B, 0xFD, 0xEC, 0xDB,
-    0xFD, 0xFD, 0x39, 0xFD, 0x08, 0x12, 0xD7, 0x0D, 0x0A, 0x9B, 0xFD, 0x43, 0x3C, 0x44, 0xB8, 0x74,
-    0x3A, 0x27, 0xED, 0x58, 0x7D, 0xB1, 0xFD, 0x3D, 0x86, 0x1E, 0x81, 0xC0, 0xD3, 0x4E, 0x0E, 0xC8,
-    0x42, 0x8B, 0xDD, 0xB3, 0x85, 0x10, 0xF1, 0x6C, 0x10, 0x2A, 0x24, 0xB8, 0xD6, 0x1F, 0x2D, 0xEA,
-    0xE4, 0xA9, 0xC8, 0xD6, 0x8F, 0x0A, 0xA6, 0xAD, 0xF2, 0xDE, 0x29, 0x53, 0x2F, 0x43, 0xC1, 0xAD,
-    0x8D, 0x08, 0xDB, 0x6F, 0x73, 0xE6, 0xD1, 0xF3, 0x28, 0x29, 0x52, 0x49, 0x47, 0x5B, 0x8C, 0x67,
-    0x56, 0xE2, 0x41, 0x2F, 0x3B, 0x46, 0x29, 0x2B, 0x12, 0xE6, 0x4F, 0x01, 0x6A, 0x50, 0x0B, 0xEB,
-    0xC7, 0x1B, 0xF4, 0x9C, 0x49, 0xCE, 0x38, 0xC8, 0xF5, 0x3E, 0x54, 0x8B, 0xF1, 0x65, 0x2E, 0xB0,
-    0xF0, 0x98, 0x99, 0x2D, 0xAD, 0xB5, 0xB2, 0x0C, 0x8B, 0xBB, 0xB5, 0xB0, 0xEA, 0xB6, 0x52, 0x23,
-    0x94, 0xDD, 0x21, 0x26, 0xE9, 0x99, 0x6B, 0x52, 0xA0, 0xE2, 0x23, 0x94, 0xBD, 0x65, 0x68, 0xA1,
-    0x8F, 0x1B, 0x6F, 0x6C, 0x47, 0x5C, 0xA6, 0x63, 0xC8, 0x51, 0xFD, 0x8B, 0xA3, 0xB7, 0x2C, 0xF4,
-    0x19, 0xF6, 0xEA, 0x2A, 0x16, 0x0A, 0x96, 0x9D, 0xCE, 0x2B, 0x49, 0x5D, 0x4D, 0x28, 0xEC, 0x4F,
-    0x7C, 0xDC, 0x74, 0x96, 0xDC, 0x67, 0xE1, 0x54, 0x94, 0x93, 0x5E, 0x1C, 0x75, 0x8B, 0xBA, 0x2A,
-    0xE7, 0xF0, 0xA3, 0x04, 0xFD, 0x8C, 0xE7, 0xD1, 0xDA, 0x04, 0x4A, 0xB8, 0x48, 0x5C, 0x59, 0xD4,
-    0x46, 0xE0, 0x0E, 0x9E, 0x5B, 0xCB, 0x80, 0x6F, 0xA8, 0x0A, 0xE6, 0xB5, 0x09, 0x38, 0x87, 0x5F,
-    0x13, 0x51, 0x29, 0x11, 0xA3, 0xFE, 0xF7, 0xBC, 0x5E, 0x73, 0x7F, 0x7E, 0x5D, 0x4B, 0xE4, 0xB3,
-    0xB4, 0x45, 0x89, 0x30, 0xE5, 0x4E, 0xFD, 0xC4, 0xED, 0xF7, 0x35, 0x94, 0xAB, 0x0E, 0xBF, 0xA6,
-    0xF0, 0xA6, 0xEC, 0x16, 0xB2, 0x67, 0x3A, 0x43, 0xDA, 0x7E, 0x77, 0x53, 0xEB, 0x77, 0x37, 0x14,
-    0x8A, 0xBF, 0xCF, 0x58, 0x24, 0x3C, 0x4A, 0x74, 0xFE, 0x5C, 0x01, 0xB7, 0xA2, 0x35, 0xE1, 0x45,
-    0x39, 0xED, 0xFE, 0xC5, 0xEC, 0x81, 0x4E, 0x3C, 0xFF, 0xFA, 0xA2, 0xD9, 0x7F, 0x60, 0xA0, 0x3C,
-    0xFD, 0xFF, 0x01, 0xD5, 0x5A, 0xBF, 0x93, 0xDD, 0xD6, 0x75, 0xBE, 0x00, 0x48, 0x42, 0x43, 0xCC,
-    0xE4, 0x6E, 0x21, 0x25, 0x63, 0xA9, 0x40, 0xAF, 0x22, 0xF8, 0x07, 0x6C, 0x5D, 0x38, 0x2C, 0x58,
-    0xB0, 0xD0, 0x16, 0x5C, 0x37, 0x29, 0x5C, 0xB9, 0x30, 0x9B, 0xFD, 0x07, 0x14, 0x02, 0x92, 0x0B,
-    0x16, 0x2A, 0xB4, 0x99, 0xF1, 0x4C, 0x8A, 0x14, 0xD2, 0x8C, 0x55, 0x90, 0xEB, 0x42, 0x4D, 0xAA,
-    0x8C, 0x44, 0x80, 0x66, 0xC1, 0x42, 0x85, 0x41, 0x73, 0x14, 0x17, 0x2E, 0x04, 0x99, 0x54, 0x34,
-    0x11, 0x0B, 0x41, 0x63, 0x28, 0x86, 0x96, 0x00, 0x4E, 0xBE, 0xEF, 0x5C, 0xE0, 0xBD, 0xB7, 0x1C,
-    0x8F, 0x35, 0x93, 0xCC, 0x6A, 0x36, 0x8F, 0x7C, 0x6F, 0xDF, 0x8F, 0xFB, 0xE3, 0xDC, 0x73, 0xCF,
-    0xF9, 0xCE, 0x77, 0xCE, 0xBD, 0xC6, 0x18, 0x93, 0x35, 0x81, 0xD4, 0x56, 0x8C, 0x1B, 0x4C, 0x51,
-    0x9B, 0x3D, 0xE3, 0x1F, 0xB3, 0x89, 0x07, 0x93, 0xB5, 0x46, 0xF2, 0x68, 0x34, 0x69, 0x67, 0xAA,
-    0x3A, 0x9A, 0x8D, 0x45, 0x93, 0x26, 0x12, 0x63, 0x47, 0x53, 0x74, 0xA1, 0x94, 0x76, 0x36, 0xAE,
-    0x37, 0x9B, 0x47, 0x96, 0x1B, 0xE3, 0xF0, 0xB7, 0xD8, 0x37, 0xA9, 0x4C, 0xA6, 0x90, 0x31, 0x10,
-    0x19, 0x23, 0xF9, 0xE4, 0xDF, 0x30, 0x3C, 0x3B, 0x99, 0x6C, 0x40, 0x8B, 0x6E, 0x79, 0xB6, 0x68,
-    0xB9, 0x3E, 0xF9, 0xB9, 0x0F, 0x6A, 0x27, 0x52, 0xA7, 0x78, 0xC6, 0x78, 0x9A, 0x6A, 0x5E, 0x86,
-    0xC3, 0xF3, 0x2E, 0x9E, 0x2F, 0x6E, 0x67, 0x4A, 0xE5, 0x08, 0x03, 0xB2, 0x51, 0x24, 0x82, 0x31,
-    0x0B, 0xE1, 0x04, 0x73, 0xF0, 0x9E, 0xC1, 0x5A, 0x28, 0x09, 0xA5, 0x0A, 0x85, 0x4D, 0x39, 0x15,
-    0x5A, 0xE1, 0xE5, 0xE5, 0xEA, 0xE4, 0x7D, 0x7C, 0x29, 0x92, 0x1B, 0xCC, 0xD3, 0xB1, 0x2B, 0xBF,
-    0xD6, 0x0E, 0xE9, 0xA0, 0x1D, 0xF2, 0xB5, 0x03, 0x85, 0x35, 0x31, 0x3F, 0xB3, 0xC3, 0x6C, 0x32,
-    0xBC, 0x36, 0xEC, 0x30, 0xB1, 0xAF, 0x76, 0xC1, 0x4F, 0xB5, 0xF9, 0x9B, 0x70, 0x96, 0xAF, 0xBA,
-    0x0A, 0x42, 0x24, 0x78, 0x06, 0x72, 0x75, 0x32, 0x95, 0x71, 0xA5, 0x2B, 0xE3, 0xCE, 0xB6, 0xC1,
-    0x08, 0xDD, 0x55, 0xA6, 0x28, 0x0B, 0x68, 0x4A, 0x1A, 0xC8, 0x3B, 0x5A, 0x76, 0x1E, 0x6E, 0x5C,
-    0xAB, 0x5F, 0x30, 0xA6, 0x4C, 0x46, 0x13, 0xCF, 0xF1, 0x84, 0xC9, 0xA2, 0x09, 0x22, 0x43, 0xC1,
-    0x0E, 0x5A, 0x85, 0x40, 0x81, 0x04, 0x98, 0x5A, 0xAE, 0x40, 0x01, 0x72, 0x0D, 0x92, 0x54, 0xEF,
-    0xF6, 0x5C, 0x23, 0x14, 0xE5, 0x38, 0xB5, 0xC3, 0x8F, 0x97, 0x2B, 0xB9, 0x4D, 0x0D, 0x60, 0x73,
-    0xA8, 0x81, 0x8B, 0x87, 0xDF, 0xEC, 0x63, 0xD9, 0x9D, 0xAE, 0xF2, 0xC8, 0xAF, 0x0F, 0x4A, 0x69,
-    0xCD, 0x4B, 0xD5, 0xE7, 0x58, 0x44, 0x55, 0xAF, 0x0B, 0x95, 0x12, 0x2F, 0xD5, 0xEE, 0xC3, 0x6B,
-    0xF4, 0xC6, 0xEE, 0x57, 0x37, 0x8C, 0x79, 0x69, 0x1F, 0xAA, 0x94, 0x12, 0xAB, 0xEF, 0x03, 0x79,
-    0x8A, 0x65, 0xD4, 0x97, 0x8D, 0x6B, 0xBC, 0x62, 0x02, 0x4A, 0x92, 0x61, 0xA4, 0x94, 0xD3, 0x3F,
-    0x83, 0x1D, 0x74, 0xAE, 0x8B, 0x87, 0x68, 0x0C, 0x27, 0x23, 0x30, 0x22, 0x57, 0xDB, 0xC9, 0x35,
-    0xE8, 0xDA, 0xA0, 0x05, 0xFA, 0x54, 0x23, 0x77, 0x80, 0xC6, 0xC1, 0x01, 0xFA, 0x24, 0x4F, 0xC6,
-    0x90, 0x4A, 0xAD, 0xF0, 0x4C, 0xA0, 0x51, 0x73, 0x31, 0xF7, 0xBB, 0xFA, 0xE6, 0xE8, 0xEE, 0x4F,
-    0xFC, 0xFF, 0xD6, 0x78, 0x61, 0x63, 0x89, 0xE6, 0x92, 0x7C, 0xAB, 0x9B, 0xC1, 0x96, 0xE1, 0x6C,
-    0x5E, 0xC1, 0x56, 0xE1, 0x5D, 0xD2, 0xC2, 0x38, 0xFE, 0x76, 0x3F, 0x2B, 0x63, 0x58, 0x4C, 0xF3,
-    0x91, 0xE9, 0x63, 0x98, 0x5A, 0x97, 0xE2, 0xA7, 0x3C, 0xBD, 0xD2, 0xD2, 0x14, 0x87, 0x1F, 0x46,
-    0xD0, 0x47, 0xF2, 0xA0, 0xBE, 0x89, 0xEE, 0x6F, 0xBC, 0x11, 0x63, 0xF2, 0xF8, 0x41, 0xFD, 0x4F,
-    0xDB, 0x0F, 0xF7, 0xEB, 0xD7, 0xF0, 0xE1, 0xC3, 0x1F, 0xB1, 0x99, 0x7D, 0xAB, 0x4B, 0xA1, 0x9A,
-    0xDE, 0xE6, 0xF2, 0xEB, 0x3A, 0x33, 0x1F, 0x86, 0x32, 0xC6, 0x4D, 0xD4, 0x85, 0x77, 0x02, 0x2C,
-    0x11, 0x8A, 0x83, 0x9A, 0x8A, 0x23, 0x3A, 0x08, 0xA4, 0xE6, 0xF2, 0xF1, 0x87, 0xAF, 0xE6, 0xA5,
-    0x45, 0xC8, 0xE2, 0x56, 0x5D, 0x48, 0xE7, 0x9E, 0x8E, 0x59, 0x3D, 0xDB, 0xD6, 0x5D, 0xED, 0xEC,
-    0x3D, 0x88, 0x53, 0x85, 0x43, 0x56, 0x4F, 0xF1, 0x2C, 0xA6, 0x7A, 0x5A, 0x5F, 0xFA, 0x67, 0x18,
-    0xED, 0x0B, 0xF8, 0x17, 0xF4, 0x41, 0x0F, 0xB3, 0x2F, 0x5A, 0x3B, 0xA6, 0x53, 0x24, 0x57, 0x24,
-    0x97, 0x56, 0x5A, 0x37, 0x38, 0x18, 0x51, 0x82, 0xA6, 0x6D, 0xD5, 0x46, 0x02, 0x93, 0xCD, 0x7A,
-    0xF8, 0x84, 0xBC, 0x09, 0xFD, 0x8E, 0xF4, 0xB8, 0x06, 0xBE, 0xF7, 0x24, 0x7A, 0x02, 0xC5, 0xEC,
-    0x99, 0x57, 0x8F, 0x8F, 0x8F, 0xDF, 0x81, 0x2D, 0xFD, 0x09, 0xCF, 0x51, 0xBC, 0x21, 0x67, 0x10,
-    0x2E, 0xC1, 0x52, 0x42, 0xDA, 0x6E, 0xB5, 0xF9, 0x22, 0x43, 0xA3, 0xD9, 0xC9, 0xEF, 0xA9, 0x3E,
-    0xF3, 0xDD, 0x3A, 0xBD, 0x78, 0x60, 0xA8, 0x53, 0x8C, 0x08, 0x9D, 0x5A, 0xAF, 0xD3, 0x31, 0x69,
-    0xA1, 0x53, 0x5B, 0x3B, 0xE8, 0xD4, 0xE0, 0x1B, 0xE8, 0xD4, 0x42, 0xAB, 0x6F, 0xBC, 0x61, 0xA6,
-    0xC3, 0x1A, 0x3A, 0xB5, 0xB0, 0x36, 0x7C, 0xC0, 0x76, 0x42, 0xA7, 0xF6, 0x37, 0x1D, 0x74, 0x6A,
-    0x46, 0x5B, 0x43, 0xA7, 0xB6, 0xE6, 0x28, 0x39, 0xFA, 0x40, 0xA7, 0xB6, 0x4E, 0x6F, 0x41, 0xA7,
-    0xD7, 0xCD, 0xC1, 0x77, 0xEB, 0x14, 0x0B, 0xBC, 0x03, 0x2B, 0x1E, 0x61, 0xC4, 0xE3, 0x8D, 0xE3,
-    0xE3, 0xDB, 0xEA, 0x9E, 0x25, 0x26, 0x72, 0xF8, 0xEE, 0xC7, 0xD3, 0x5D, 0x73, 0xF7, 0xAE, 0x29,
-    0xF0, 0x8A, 0xF7, 0x8E, 0x6E, 0xD5, 0x87, 0x6A, 0xD9, 0x26, 0x1A, 0x14, 0xBC, 0x60, 0x6B, 0xF8,
-    0x68, 0xDB, 0xCD, 0x17, 0xE1, 0x71, 0xF5, 0xE5, 0x6D, 0x2A, 0x8A, 0xEE, 0xFB, 0x5B, 0xA1, 0x7F,
-    0x3C, 0xD7, 0x62, 0xDB, 0x25, 0xD8, 0x37, 0x97, 0xA1, 0xDF, 0x5F, 0xAD, 0xBA, 0xF5, 0x1E, 0x8F,
-    0x6F, 0x63, 0x69, 0x61, 0xB8, 0x65, 0xFA, 0xD5, 0x68, 0x8E, 0x1C, 0xB0, 0x07, 0x8A, 0x2E, 0x4A,
-    0xA2, 0x23, 0x3C, 0x39, 0xA2, 0xB3, 0xE6, 0xD8, 0x25, 0x3A, 0x24, 0x90, 0xA2, 0x75, 0x32, 0xAB,
-    0xAA, 0x61, 0xDC, 0xC5, 0x4C, 0xEF, 0xB5, 0xFF, 0x3A, 0xEA, 0x9A, 0x5D, 0x7D, 0xB1, 0xA8, 0x23,
-    0x29, 0x03, 0xC8, 0x10, 0x60, 0xE3, 0xB2, 0x7B, 0xC6, 0x76, 0xFF, 0x7E, 0x38, 0x64, 0x30, 0x39,
-    0xBA, 0x32, 0x1C, 0xF9, 0xC6, 0x51, 0x0A, 0xDC, 0x84, 0xD3, 0xA5, 0xAD, 0x4A, 0xA7, 0x8F, 0xAA,
-    0x8E, 0x67, 0x85, 0xDE, 0x06, 0xAE, 0x8C, 0x19, 0x81, 0x59, 0x52, 0x03, 0xB3, 0xF0, 0x55, 0xD6,
-    0x05, 0x52, 0xAA, 0xC5, 0x00, 0x42, 0xF0, 0x37, 0x26, 0x94, 0x98, 0xAA, 0xF1, 0x1D, 0x2A, 0x76,
-    0xB0, 0xC4, 0x99, 0x90, 0xD8, 0x52, 0x17, 0xE8, 0x20, 0x15, 0x3B, 0xC8, 0x33, 0x74, 0x90, 0xA9,
-    0x42, 0x07, 0xB9, 0x86, 0x0E, 0x0F, 0xE1, 0x36, 0x09, 0xCD, 0xC7, 0x83, 0x85, 0xA2, 0x60, 0xA0,
-    0x8A, 0x55, 0x44, 0x8D, 0xB6, 0x88, 0x8A, 0x75, 0x1D, 0x1C, 0xE4, 0x58, 0xEA, 0x0C, 0xE0, 0x93,
-    0xCF, 0x08, 0x92, 0x50, 0x53, 0xF4, 0x18, 0x8A, 0x7D, 0x0D, 0x7B, 0x16, 0x3D, 0xE5, 0x9B, 0x6A,
-    0xF7, 0xCD, 0x17, 0x7C, 0xB3, 0x69, 0x43, 0x25, 0xB5, 0x15, 0xDE, 0x04, 0x7C, 0x63, 0x82, 0x0E,
-    0xAE, 0x98, 0xFE, 0xAF, 0xDE, 0x78, 0xDD, 0x5C, 0x95, 0x6C, 0x94, 0xAF, 0xC5, 0xEC, 0x9B, 0xB0,
-    0x0F, 0xA0, 0xEE, 0x0E, 0x9B, 0x23, 0xA9, 0x3C, 0x90, 0x86, 0xA1, 0x82, 0x7A, 0x96, 0xB6, 0x9A,
-    0x0A, 0xF9, 0x58, 0xC6, 0xD7, 0xDC, 0x9B, 0x71, 0x6F, 0xAA, 0xDC, 0x76, 0x40, 0xAB, 0xB4, 0x05,
-    0x68, 0xB9, 0x3A, 0xD2, 0x45, 0x57, 0x80, 0xF8, 0xDE, 0x3E, 0x1B, 0xD3, 0x87, 0xA3, 0x2B, 0x27,
-    0x97, 0x8F, 0x2E, 0x18, 0x5D, 0x38, 0xBA, 0xAB, 0xBD, 0x93, 0xCE, 0x42, 0xD9, 0xDF, 0x32, 0x0A,
-    0xBD, 0x08, 0xC7, 0xCA, 0xEA, 0x78, 0x02, 0x72, 0xBB, 0xCE, 0xC1, 0x22, 0x80, 0xD9, 0xE9, 0xA0,
-    0xBB, 0x81, 0x7D, 0x99, 0x93, 0x29, 0x90, 0x7B, 0x52, 0x3B, 0x38, 0xAF, 0x9D, 0xEC, 0x14, 0xCA,
-    0x2F, 0xA4, 0xA4, 0x4B, 0xC7, 0x63, 0x3C, 0x1A, 0x6B, 0x52, 0xB3, 0xFB, 0xC0, 0x57, 0x86, 0x20,
-    0x48, 0xC3, 0x48, 0xA1, 0xE8, 0x22, 0x77, 0x40, 0x4C, 0x57, 0xA6, 0xB4, 0xCF, 0x3A, 0x7C, 0x3C,
-    0xD2, 0x89, 0xF7, 0x30, 0x7E, 0x43, 0x53, 0xA3, 0x71, 0x66, 0x8D, 0x25, 0x5C, 0x75, 0x09, 0x36,
-    0x24, 0x1A, 0xE3, 0x1E, 0xA1, 0x43, 0xA2, 0x01, 0xF0, 0x5A, 0xFC, 0x02, 0x26, 0x53, 0x67, 0xBF,
-    0xC3, 0x8C, 0xB0, 0xAB, 0x39, 0x64, 0x5C, 0x94, 0x60, 0x9A, 0xF8, 0x3A, 0xC2, 0xEC, 0xAA, 0x7C,
-    0x82, 0xCD, 0x16, 0xE5, 0x64, 0x39, 0x34, 0xF6, 0x28, 0x77, 0x35, 0xC2, 0x5A, 0x93, 0x35, 0x97,
-    0x8F, 0xE5, 0xBD, 0x94, 0xC1, 0xA5, 0xD6, 0xA1, 0x5B, 0x73, 0xFA, 0x01, 0x07, 0xC5, 0x77, 0x94,
-    0x51, 0xA0, 0xC7, 0xC1, 0x24, 0xB4, 0x99, 0x06, 0x23, 0x61, 0xEB, 0xE8, 0x03, 0x94, 0x12, 0x23,
-    0x07, 0xB6, 0x0B, 0x09, 0x31, 0x45, 0xC9, 0xB1, 0x34, 0x14, 0xA8, 0x9C, 0x1D, 0x1C, 0x00, 0xF3,
-    0x5D, 0x85, 0x54, 0x10, 0x14, 0x5B, 0x1E, 0x0F, 0x0E, 0xF0, 0x02, 0x49, 0xC7, 0xA0, 0x84, 0xC7,
-    0x60, 0x69, 0x91, 0x6A, 0x81, 0x8E, 0x64, 0xBD, 0x4B, 0x54, 0x39, 0x3F, 0x80, 0x81, 0x30, 0x86,
-    0x63, 0x6C, 0x70, 0x05, 0xB4, 0xC1, 0x52, 0xB1, 0x7C, 0xE5, 0x15, 0x33, 0xE3, 0x72, 0x87, 0xD6,
-    0x08, 0x81, 0xE5, 0x2A, 0xA8, 0x0F, 0x23, 0x31, 0x26, 0xC2, 0x68, 0xD8, 0x31, 0x8E, 0x76, 0x17,
-    0xA1, 0x0F, 0xA3, 0x41, 0xB1, 0x18, 0x8D, 0xD0, 0x88, 0xD1, 0x2E, 0x1E, 0x36, 0xC4, 0x48, 0x10,
-    0x1E, 0xAA, 0x55, 0x7A, 0x75, 0xFE, 0x94, 0xA3, 0x11, 0x33, 0x35, 0x20, 0x56, 0x71, 0x1F, 0x4F,
-    0x37, 0x0F, 0x61, 0x06, 0xEE, 0x6B, 0x91, 0x47, 0xD0, 0xEC, 0x03, 0x19, 0xB2, 0xC6, 0x89, 0x39,
-    0x58, 0x54, 0x6B, 0xBB, 0xF4, 0xD3, 0x66, 0xD5, 0x6D, 0xD2, 0xDB, 0xFB, 0x0A, 0x06, 0x54, 0x2E,
-    0x76, 0x05, 0x51, 0xD3, 0xA8, 0x76, 0x6B, 0xE8, 0xE1, 0xF8, 0x83, 0x13, 0xE3, 0xD5, 0xAB, 0x2A,
-    0x99, 0x77, 0x50, 0x38, 0x57, 0xD8, 0xA8, 0xB8, 0x0C, 0x5A, 0x9F, 0x09, 0x87, 0x5D, 0xC5, 0x63,
-    0x2C, 0xAE, 0x1F, 0xFE, 0x9E, 0x8D, 0x6C, 0x11, 0x4B, 0x43, 0xCC, 0x80, 0xDC, 0xC9, 0xA4, 0x1E,
-    0x0A, 0xFF, 0xDC, 0x93, 0x36, 0x7D, 0x1B, 0x38, 0x05, 0xC7, 0x7A, 0x08, 0x22, 0x10, 0xCA, 0x13,
-    0xF6, 0x3C, 0xA6, 0x4E, 0x94, 0x9A, 0x45, 0xF3, 0xB2, 0x85, 0x50, 0x8C, 0x52, 0xB5, 0x9B, 0xA7,
-    0x37, 0xB7, 0xE2, 0x97, 0x8E, 0x8D, 0x32, 0xBA, 0x3C, 0xED, 0xCE, 0xC0, 0x03, 0xD0, 0x7A, 0x12,
-    0xF6, 0xE6, 0xC6, 0xCA, 0xEB, 0x68, 0x24, 0xF7, 0x27, 0x8A, 0x42, 0xF2, 0x04, 0xA3, 0x37, 0x69,
-    0x9F, 0x0C, 0x0A, 0x28, 0x68, 0x48, 0x72, 0x48, 0x44, 0x25, 0x55, 0x82, 0xD7, 0x31, 0x1A, 0x55,
-    0xE4, 0x4B, 0xEE, 0x9B, 0x83, 0xC3, 0x1E, 0xC0, 0x11, 0x4D, 0x04, 0x12, 0x79, 0x1B, 0x03, 0xB8,
-    0xC7, 0x4A, 0xD4, 0x30, 0x8A, 0xC7, 0x92, 0x57, 0xDF, 0x53, 0x58, 0x29, 0x57, 0x0A, 0xE6, 0xF9,
-    0x89, 0x55, 0x49, 0x8B, 0xE7, 0xEC, 0xD0, 0xCB, 0x1A, 0x69, 0x8C, 0x50, 0x61, 0x03, 0x0D, 0x7B,
-    0x2A, 0xAD, 0x29, 0x3E, 0xED, 0x16, 0x71, 0x21, 0x1A, 0xB9, 0x86, 0xCA, 0x1B, 0x4F, 0x1C, 0x4A,
-    0x05, 0x06, 0xA3, 0xAA, 0x4A, 0x2F, 0x31, 0x96, 0x41, 0xC0, 0xD6, 0x20, 0x90, 0x29, 0xB6, 0xAB,
-    0xCC, 0x89, 0xA7, 0x77, 0x14, 0x9A, 0x4C, 0xD0, 0x35, 0x2A, 0x75, 0x89, 0x6D, 0x89, 0xE6, 0x48,
-    0x09, 0x6C, 0xD6, 0x2F, 0xE8, 0x77, 0xF9, 0x8E, 0xCA, 0xCA, 0x89, 0x2D, 0x8D, 0xC1, 0xC8, 0x3B,
-    0xD4, 0xDB, 0x40, 0x13, 0xAA, 0x8C, 0x6D, 0xCE, 0xAB, 0xDC, 0x4A, 0xA2, 0x31, 0xE2, 0x87, 0x94,
-    0xE7, 0x04, 0xCD, 0x12, 0x5A, 0xAA, 0xB1, 0xBF, 0xA1, 0x70, 0xA9, 0xF9, 0xFB, 0xFC, 0x2F, 0x69,
-    0xDC, 0x88, 0x27, 0xC7, 0x9E, 0x12, 0x8F, 0x1B, 0xD1, 0xD3, 0x3F, 0xF3, 0xD5, 0x3D, 0xD6, 0x65,
-    0x3C, 0xA2, 0xEB, 0xAB, 0xEC, 0x81, 0x5C, 0x99, 0x38, 0x3C, 0x2D, 0x2F, 0x9E, 0x40, 0x2E, 0x16,
-    0xE1, 0xD3, 0x5E, 0x9D, 0x59, 0xB9, 0x4A, 0xA5, 0xAF, 0x2A, 0x3D, 0x8D, 0x06, 0x49, 0x86, 0x1C,
-    0xFC, 0x44, 0x72, 0x35, 0xEB, 0xDC, 0x8B, 0x4F, 0x99, 0xA5, 0xA4, 0xD4, 0x52, 0x57, 0xCD, 0x12,
-    0x90, 0xBC, 0x5B, 0xD4, 0x1C, 0x7F, 0xCE, 0xE8, 0x52, 0xBF, 0x9B, 0xE9, 0xD4, 0x24, 0x13, 0xC1,
-    0x96, 0x30, 0xEE, 0xC8, 0x6E, 0x69, 0x4F, 0x5E, 0xF4, 0x82, 0x23, 0xA8, 0xE4, 0x81, 0xD0, 0x1F,
-    0x54, 0xF0, 0x78, 0x22, 0x27, 0x55, 0xB9, 0xD3, 0x1E, 0x6F, 0xBD, 0xD8, 0x45, 0x83, 0xC1, 0x55,
-    0x6A, 0xE8, 0x0A, 0xA4, 0xDA, 0xAD, 0x6A, 0xEE, 0xBC, 0xCC, 0x54, 0x7E, 0xEF, 0x45, 0x86, 0x68,
-    0xB6, 0x57, 0x89, 0xDF, 0x82, 0xEE, 0xED, 0xA0, 0x02, 0x7F, 0x3C, 0xAD, 0x19, 0xC4, 0x46, 0x86,
-    0xF8, 0x0B, 0xBC, 0x0D, 0x35, 0x5E, 0x7D, 0x68, 0xA1, 0x66, 0x05, 0x0F, 0x6F, 0x13, 0xE9, 0xD1,
-    0x29, 0xB9, 0x13, 0x5A, 0x81, 0xFE, 0xA2, 0x72, 0x7B, 0x63, 0x11, 0x32, 0x78, 0xB5, 0x15, 0x15,
-    0x5B, 0x4D, 0xC5, 0x8E, 0x10, 0x58, 0x2D, 0x45, 0xA5, 0xF6, 0x86, 0x02, 0x5C, 0xED, 0xBC, 0x9D,
-    0xB8, 0x55, 0xD2, 0x9A, 0x49, 0x47, 0xA7, 0x56, 0xA2, 0x32, 0xFF, 0x83, 0x1A, 0x09, 0xE1, 0x63,
-    0x50, 0x1B, 0x51, 0x91, 0xBF, 0xEA, 0x37, 0xA9, 0x92, 0x28, 0xA4, 0xEA, 0xDF, 0x56, 0xE7, 0x57,
-    0x1B, 0xD1, 0x95, 0x73, 0x93, 0xAB, 0xA7, 0x72, 0x70, 0x40, 0x7D, 0x7E, 0xED, 0x91, 0xD7, 0x75,
-    0x95, 0xDA, 0x7B, 0x36, 0x78, 0x13, 0x53, 0xB2, 0xCA, 0xBF, 0x53, 0x2C, 0x07, 0xD7, 0x69, 0x32,
-    0xA1, 0xEE, 0x76, 0xA4, 0xA8, 0x50, 0x93, 0xC6, 0x69, 0x7A, 0xC2, 0xAC, 0x73, 0x3E, 0x7E, 0x5F,
-    0x07, 0x56, 0x90, 0xAA, 0x34, 0x35, 0xD3, 0x64, 0x4E, 0x37, 0xDB, 0xA9, 0xC2, 0x31, 0xF0, 0x74,
-    0xF0, 0xD3, 0xD1, 0xB3, 0x91, 0x98, 0x0D, 0xAD, 0x82, 0xBF, 0x94, 0xB1, 0x37, 0xA1, 0x26, 0x5A,
-    0x12, 0xBA, 0x50, 0x33, 0x12, 0xDD, 0x6B, 0x1F, 0x5B, 0xC9, 0x71, 0x53, 0x85, 0xE2, 0x35, 0x6F,
-    0x63, 0xD6, 0x72, 0x98, 0xA7, 0x18, 0x25, 0x27, 0xE2, 0x1A, 0x0E, 0xB1, 0xC0, 0x8F, 0x4E, 0x59,
-    0xB4, 0x2B, 0xD5, 0xB1, 0xD3, 0x86, 0xEF, 0x78, 0x61, 0xBA, 0xED, 0x97, 0x9A, 0x42, 0xE9, 0x67,
-    0xC9, 0x5F, 0xC9, 0xA9, 0xA8, 0x86, 0xA3, 0x73, 0x1F, 0xA8, 0xA1, 0x4C, 0xB9, 0xB5, 0xCB, 0x35,
-    0xB7, 0xE6, 0x86, 0x2A, 0xF1, 0x76, 0xB5, 0x47, 0x74, 0xA3, 0xD1, 0x43, 0x73, 0x22, 0x4D, 0x87,
-    0x09, 0x82, 0x47, 0xEB, 0x04, 0x29, 0xA7, 0x56, 0x02, 0xA6, 0x24, 0x1E, 0x14, 0x7C, 0x37, 0x1C,
-    0x2C, 0xD9, 0x1E, 0xD9, 0x1B, 0xC6, 0x70, 0xFA, 0xF2, 0xCD, 0xC1, 0xBE, 0xEF, 0xAA, 0xA2, 0xEB,
-    0x4E, 0xF8, 0x3C, 0xEF, 0x93, 0x83, 0x9C, 0x5B, 0xC7, 0x20, 0x2D, 0xB9, 0xEE, 0x40, 0x24, 0xC7,
-    0xC7, 0x7E, 0x49, 0xAA, 0x46, 0x15, 0x4B, 0x57, 0x64, 0xC7, 0xF5, 0xE5, 0xF9, 0xD1, 0xFD, 0xCE,
-    0x9B, 0xCB, 0xA4, 0xDF, 0x6E, 0x58, 0x67, 0x51, 0xF3, 0x60, 0xC7, 0xB8, 0x3B, 0x17, 0xF2, 0x85,
-    0xC7, 0x39, 0x67, 0xD7, 0xCC, 0xB8, 0xF5, 0x58, 0x1C, 0x4D, 0x60, 0x56, 0x09, 0x32, 0xF0, 0x73,
-    0xA1, 0x3F, 0x8D, 0x66, 0x11, 0x01, 0xED, 0x1A, 0x49, 0xD9, 0xEB, 0x78, 0xA9, 0x98, 0xA9, 0x5D,
-    0x30, 0xF9, 0x39, 0x90, 0x2F, 0xBC, 0xE3, 0x2D, 0x9D, 0x35, 0x07, 0x03, 0x08, 0xF1, 0x79, 0xE3,
-    0x36, 0x86, 0x39, 0x75, 0x1E, 0xAD, 0xE7, 0xA0, 0xEF, 0x13, 0x6D, 0xCB, 0x19, 0x38, 0x01, 0x6D,
-    0xD5, 0x2E, 0x4F, 0x06, 0xF0, 0x35, 0xD2, 0xAC, 0x4F, 0x4A, 0xBD, 0xA2, 0x37, 0x73, 0x28, 0x98,
-    0x4E, 0x82, 0x3D, 0xE2, 0x50, 0x95, 0x72, 0x05, 0x1A, 0x55, 0x40, 0xBA, 0x42, 0xB6, 0x92, 0x4C,
-    0x8B, 0x14, 0x74, 0x96, 0x64, 0x97, 0x87, 0x72, 0xFE, 0x88, 0x7E, 0xC6, 0x9E, 0xA1, 0xCC, 0x0B,
-    0x7F, 0xE0, 0xF0, 0xBA, 0x4E, 0xC2, 0xA3, 0xAE, 0x50, 0x49, 0xCC, 0xB0, 0xD4, 0x72, 0x28, 0x81,
-    0xB6, 0xE3, 0x1B, 0x55, 0x4A, 0xD5, 0x3C, 0xD7, 0x8E, 0xD2, 0xF8, 0x6A, 0x93, 0x8C, 0x2B, 0x99,
-    0x24, 0x29, 0xB1, 0x5A, 0x5B, 0x62, 0x3C, 0x7A, 0x17, 0xF8, 0xDF, 0x90, 0x7B, 0xEF, 0x1A, 0xD3,
-    0xF7, 0x2A, 0x0F, 0x55, 0x34, 0x20, 0xC6, 0x09, 0xA0, 0xDE, 0x21, 0x54, 0xD9, 0x16, 0x94, 0x33,
-    0x0F, 0x4E, 0x4B, 0x83, 0xB6, 0xF9, 0xD2, 0xF1, 0x68, 0xD9, 0xCE, 0xD2, 0x8F, 0xCF, 0xAA, 0x90,
-    0x1D, 0xCD, 0xE9, 0x2F, 0xDD, 0x5F, 0xFB, 0x52, 0x77, 0x17, 0x82, 0xA4, 0x3E, 0xEC, 0x91, 0xDD,
-    0xB5, 0x54, 0xC9, 0x7F, 0x69, 0x38, 0x98, 0x09, 0x71, 0xB2, 0x12, 0x11, 0xF7, 0xCD, 0xA1, 0xA6,
-    0x9E, 0x6E, 0xE4, 0xEA, 0x91, 0x00, 0x4D, 0x34, 0x3A, 0xCA, 0x41, 0x1E, 0x92, 0xCC, 0x68, 0x9A,
-    0x57, 0x48, 0xF9, 0xFA, 0x04, 0x89, 0x3A, 0xB2, 0xB0, 0xDF, 0x93, 0xB7, 0x8F, 0x7F, 0x27, 0xD7,
-    0x99, 0x88, 0xB6, 0x40, 0x15, 0x74, 0x00, 0x0C, 0x93, 0xDA, 0xB6, 0x4C, 0x6E, 0x61, 0x14, 0xF7,
-    0x0A, 0x61, 0x66, 0x29, 0x2C, 0x21, 0x79, 0xF4, 0x1E, 0x38, 0xD9, 0x93, 0x65, 0xB5, 0xAC, 0x03,
-    0x26, 0x43, 0xAC, 0x01, 0xF2, 0xC4, 0x47, 0x76, 0x2E, 0x20, 0x79, 0xA8, 0xD1, 0x62, 0x08, 0x86,
-    0xE7, 0x48, 0x8C, 0x65, 0x1D, 0x51, 0x99, 0x73, 0x4C, 0x03, 0xCE, 0x95, 0xAE, 0x0E, 0x2C, 0x66,
-    0xB2, 0x9A, 0xC6, 0x38, 0x32, 0x11, 0x78, 0x91, 0xA1, 0x23, 0xF5, 0x48, 0x4E, 0x84, 0x0A, 0x93,
-    0x9F, 0xB2, 0x1C, 0x67, 0x7B, 0xC4, 0x2A, 0xF4, 0x4C, 0x98, 0xBA, 0x65, 0x5D, 0xD1, 0x54, 0xC8,
-    0xB7, 0xA3, 0x19, 0x62, 0xBA, 0x36, 0xEB, 0xB0, 0xEC, 0x49, 0xB9, 0x71, 0x51, 0xDB, 0x6F, 0x85,
-    0xAE, 0x20, 0x08, 0xD0, 0x5A, 0xBC, 0xF4, 0x83, 0x6B, 0xF5, 0x94, 0x83, 0x77, 0xD0, 0x64, 0x4D,
-    0xF6, 0x23, 0xEC, 0x49, 0x42, 0xA0, 0xB4, 0x9F, 0xD8, 0x70, 0xE9, 0xB6, 0xD9, 0x70, 0x5F, 0x1F,
-    0x3F, 0x5D, 0xB3, 0x09, 0x17, 0x5A, 0xFE, 0xDC, 0x7D, 0x68, 0x39, 0x2D, 0xD1, 0xB0, 0xA8, 0xCA,
-    0xB7, 0x9E, 0x93, 0x20, 0xD2, 0x36, 0x31, 0x77, 0xA1, 0x06, 0x48, 0x33, 0xDE, 0x32, 0x35, 0xA0,
-    0xEB, 0x23, 0x09, 0x65, 0xD3, 0x87, 0x6A, 0xCC, 0xD7, 0x94, 0x8A, 0x39, 0xF5, 0x50, 0xF5, 0xC5,
-    0xFB, 0x90, 0x28, 0xE1, 0x6A, 0xD8, 0xAE, 0x87, 0x36, 0x6B, 0x88, 0x6C, 0x67, 0x76, 0x97, 0x2E,
-    0x92, 0x26, 0x05, 0x23, 0x13, 0x2A, 0xDF, 0x2A, 0x25, 0xB0, 0x8A, 0x16, 0xB1, 0xAF, 0x23, 0x2D,
-    0xC5, 0xD8, 0x80, 0xD0, 0xEB, 0x51, 0xC6, 0x48, 0xB3, 0x06, 0x2F, 0x9F, 0x6F, 0x44, 0xC3, 0x79,
-    0x97, 0xFE, 0xC6, 0x7B, 0xCA, 0x01, 0xDA, 0x95, 0x1D, 0xC6, 0x13, 0xE1, 0xAF, 0xA8, 0x91, 0x30,
-    0x42, 0xF8, 0xBB, 0xE7, 0x5C, 0x7A, 0xC3, 0xE8, 0x91, 0xF6, 0x96, 0xC3, 0xCD, 0x93, 0xC6, 0x0F,
-    0x4C, 0x78, 0x13, 0x3D, 0x41, 0x34, 0x2F, 0xB5, 0xE7, 0x5E, 0x7A, 0x5F, 0xF1, 0xA5, 0xE1, 0x30,
-    0xD9, 0x89, 0x47, 0xAD, 0x0E, 0xB7, 0x84, 0xC7, 0x0B, 0xE6, 0xBC, 0x5B, 0x8E, 0xB9, 0x6C, 0x4C,
-    0x93, 0x95, 0x51, 0xAF, 0x45, 0x5C, 0x30, 0xDF, 0x78, 0x66, 0x69, 0x8D, 0x39, 0x9A, 0xAF, 0x2C,
-    0xB0, 0x18, 0x0A, 0xCC, 0x2A, 0xED, 0x58, 0xB4, 0xAE, 0x43, 0x8B, 0x3A, 0x1E, 0xAD, 0x09, 0x3A,
-    0xBF, 0x6B, 0xEB, 0x23, 0x22, 0xA0, 0x4E, 0xA0, 0x8A, 0x95, 0x78, 0xB8, 0xC7, 0x3A, 0x97, 0x9C,
-    0xAE, 0xCC, 0x66, 0x53, 0xF4, 0x86, 0xE7, 0x27, 0x90, 0xA6, 0x4B, 0x19, 0x30, 0x6B, 0x2C, 0xF7,
-    0x44, 0xAE, 0x00, 0x6C, 0x3F, 0x9E, 0xD2, 0x21, 0x1A, 0x33, 0x50, 0xEF, 0xAC, 0xC6, 0x7A, 0x02,
-    0x30, 0x7B, 0xC8, 0x01, 0x59, 0xB0, 0x44, 0xE0, 0xB0, 0xFC, 0xB6, 0x63, 0x05, 0xB9, 0xCA, 0x53,
-    0x96, 0x46, 0xE1, 0x99, 0x19, 0x6B, 0xA7, 0xC0, 0xE8, 0x00, 0x9F, 0xAA, 0x95, 0x31, 0x0C, 0x9A,
-    0x1E, 0xE4, 0x66, 0x2E, 0xA8, 0xDE, 0xEE, 0xE2, 0x8E, 0x60, 0x37, 0x8E, 0x36, 0xF4, 0x37, 0x53,
-    0x54, 0xA2, 0x63, 0x18, 0x5F, 0x25, 0x4B, 0x4E, 0xA5, 0xB7, 0x0C, 0x1E, 0x55, 0x8D, 0xB8, 0x6F,
-    0x29, 0x29, 0xE0, 0x0F, 0x9A, 0x87, 0x6C, 0x4C, 0xEC, 0x72, 0xE2, 0x7B, 0x97, 0x30, 0x52, 0x32,
-    0x20, 0x14, 0x9D, 0x32, 0xF8, 0x40, 0x63, 0x43, 0xE6, 0xAB, 0x07, 0xA7, 0x3B, 0x94, 0xEC, 0xD0,
-    0x27, 0xB3, 0xE6, 0x0A, 0x88, 0xAD, 0xEC, 0x8B, 0x4F, 0x15, 0x80, 0x19, 0xA8, 0x9A, 0x17, 0x83,
-    0x27, 0xF1, 0xA1, 0xEA, 0xC9, 0xA7, 0xAE, 0xA9, 0x67, 0x10, 0xFB, 0xCB, 0xAE, 0xDC, 0x36, 0xCB,
-    0x51, 0x83, 0xA7, 0x4A, 0xCA, 0xA7, 0xBD, 0xD4, 0xA7, 0xBD, 0xF9, 0x3C, 0x49, 0x1D, 0x1E, 0x6F,
-    0x8A, 0x09, 0xAC, 0xAB, 0x19, 0x06, 0x13, 0x12, 0xD8, 0x81, 0x42, 0xA7, 0xF5, 0x79, 0xD5, 0xB5,
-    0xA6, 0x58, 0x1D, 0xD3, 0x1C, 0x65, 0xB5, 0x8C, 0x95, 0x0B, 0xAD, 0x35, 0xF9, 0x85, 0xF3, 0xAA,
-    0xEB, 0x4B, 0xC7, 0x4B, 0x61, 0x4C, 0x8D, 0x84, 0xA6, 0x1D, 0x68, 0x2D, 0x66, 0x17, 0x2D, 0xC1,
-    0xDD, 0xB2, 0xFF, 0xA6, 0x87, 0x3C, 0x00, 0x03, 0x60, 0xE9, 0x4A, 0xE0, 0xC1, 0x31, 0xE7, 0x73,
-    0x5D, 0x80, 0xEC, 0x19, 0xC1, 0x1B, 0xDE, 0x68, 0x47, 0x48, 0x99, 0x3D, 0x63, 0x51, 0xCC, 0xC3,
-    0x12, 0xC7, 0x24, 0x87, 0x55, 0x26, 0x37, 0x2E, 0x64, 0x50, 0xD9, 0xAC, 0xC6, 0x44, 0x0D, 0xEE,
-    0x1A, 0x64, 0xE6, 0x35, 0xC7, 0x24, 0x49, 0xF4, 0x3E, 0x66, 0x87, 0x95, 0x04, 0xE8, 0x0F, 0x5A,
-    0xB9, 0x73, 0x4C, 0x23, 0x1D, 0x01, 0xA8, 0x20, 0xD8, 0x55, 0x5C, 0x0C, 0x28, 0x13, 0xCB, 0xCC,
-    0xE9, 0xC8, 0xE4, 0x19, 0x2F, 0xA5, 0x6A, 0x48, 0xCF, 0x0A, 0x1C, 0x14, 0x04, 0x8E, 0x13, 0x33,
-    0x6B, 0x4F, 0x96, 0xAC, 0x7F, 0x26, 0xA4, 0x00, 0xDA, 0xA6, 0xFC, 0xD4, 0xE8, 0xDD, 0xB6, 0x88,
-    0x6F, 0xCC, 0x81, 0x7A, 0x7D, 0x21, 0xBE, 0x52, 0xE1, 0x8B, 0x59, 0xFA, 0x27, 0x96, 0xFF, 0xE0,
-    0xC2, 0xDC, 0x10, 0x78, 0xF2, 0xBE, 0xD0, 0x7E, 0x3D, 0xC6, 0x85, 0x24, 0x4C, 0xB4, 0xEA, 0x4C,
-    0x57, 0x1D, 0xB1, 0x1D, 0x20, 0x4E, 0x89, 0x2F, 0x31, 0x17, 0xFA, 0xBF, 0xA6, 0x99, 0xFA, 0x98,
-    0xF9, 0xA5, 0x17, 0x4A, 0xEC, 0xCB, 0x6A, 0x52, 0x7A, 0xCC, 0x3F, 0x98, 0x9F, 0x48, 0xA9, 0x9B,
-    0xAE, 0x4A, 0xC0, 0xBB, 0x74, 0xD0, 0x77, 0xD5, 0xA3, 0x4F, 0x0A, 0xBE, 0xD3, 0xF3, 0x5D, 0x20,
-    0x1A, 0x81, 0xB7, 0xE8, 0x2A, 0x28, 0x02, 0x43, 0x10, 0xA4, 0x7C, 0x42, 0xBD, 0x2C, 0x21, 0xD2,
-    0x74, 0x28, 0xF2, 0xE8, 0x6C, 0xC5, 0x53, 0x28, 0x55, 0xAA, 0x27, 0x24, 0xAB, 0x83, 0xF9, 0x24,
-    0x48, 0xF5, 0xDC, 0xAD, 0x99, 0x79, 0xB6, 0x96, 0x8E, 0x7F, 0xA6, 0xA5, 0x39, 0xCB, 0x0A, 0x66,
-    0xC1, 0xB2, 0x2D, 0x4C, 0xF0, 0x44, 0x7A, 0x0B, 0x85, 0x36, 0x05, 0x90, 0x34, 0x5C, 0x8E, 0xE0,
-    0x5C, 0x4B, 0x0B, 0xF8, 0xB1, 0x94, 0x20, 0x84, 0x3C, 0x61, 0xC9, 0xA8, 0x9B, 0xAA, 0xB5, 0xB4,
-    0xD8, 0xAA, 0x8F, 0xE4, 0x2B, 0x5F, 0x6B, 0x81, 0xC9, 0x7D, 0x31, 0x98, 0x74, 0xCA, 0x5A, 0xB3,
-    0x92, 0xF4, 0xE3, 0x23, 0xA3, 0x15, 0x74, 0x3D, 0xE9, 0xD6, 0x9A, 0x2C, 0xCB, 0x57, 0xC1, 0xE6,
-    0x48, 0xEE, 0xAC, 0x05, 0x78, 0xF5, 0x7D, 0x6E, 0x4A, 0xC7, 0x49, 0x5A, 0xBC, 0x41, 0xA8, 0xCD,
-    0x5A, 0xC7, 0xE2, 0xB4, 0xCB, 0xBF, 0x27, 0x0D, 0x98, 0x7D, 0x92, 0x76, 0x84, 0xB7, 0xB9, 0x62,
-    0x82, 0x03, 0x47, 0xBD, 0x86, 0x9D, 0xEB, 0xC3, 0x27, 0xDF, 0xD7, 0x16, 0x68, 0xE5, 0xF0, 0x23,
-    0x98, 0xD7, 0x2D, 0x1E, 0xD6, 0xC1, 0xF5, 0x93, 0xAE, 0xC8, 0x77, 0xCA, 0x86, 0x67, 0x2D, 0x40,
-    0xBA, 0x16, 0xFC, 0xD2, 0x77, 0x1B, 0x5F, 0x04, 0x0C, 0xBB, 0x1F, 0xB1, 0x30, 0xD8, 0xAD, 0x25,
-    0xC2, 0x55, 0x15, 0x97, 0xF6, 0x75, 0xB3, 0x58, 0xAD, 0xFA, 0x33, 0x4F, 0xCA, 0xA5, 0x4D, 0xE5,
-    0x03, 0xC9, 0x41, 0x02, 0x40, 0x78, 0x74, 0x4A, 0x3D, 0x6A, 0xD2, 0xEA, 0x6E, 0xDA, 0xC3, 0x6B,
-    0x2A, 0x64, 0x52, 0x2A, 0x61, 0x3A, 0x02, 0x0C, 0xD1, 0x7C, 0x4C, 0x24, 0x77, 0xB3, 0x2F, 0xC6,
-    0x43, 0xDA, 0x99, 0x67, 0x35, 0x2C, 0x95, 0xEA, 0x5A, 0x83, 0x5F, 0xEA, 0x62, 0xB1, 0xD6, 0x4F,
-    0x95, 0x6E, 0x7C, 0x2A, 0x3C, 0x3D, 0xE5, 0x63, 0x8C, 0xE5, 0x0F, 0x02, 0xC4, 0x23, 0x17, 0xEA,
-    0xE2, 0x51, 0x61, 0x26, 0x61, 0xF5, 0x18, 0x9E, 0x0E, 0x66, 0x61, 0xE4, 0x4B, 0xE9, 0xB9, 0x7A,
-    0x80, 0x6B, 0xD1, 0xEA, 0x11, 0x3E, 0xAF, 0x83, 0x9C, 0xEC, 0xF3, 0xA4, 0x91, 0xC6, 0x0D, 0x35,
-    0x78, 0x1B, 0x07, 0xDD, 0x08, 0x28, 0x80, 0x7C, 0x7E, 0xC8, 0x62, 0x1F, 0x69, 0x94, 0x95, 0x2F,
-    0x44, 0x53, 0xD4, 0x5B, 0x8F, 0x09, 0x6C, 0x7B, 0xCB, 0xD1, 0xF9, 0xCF, 0x73, 0xBD, 0x45, 0x80,
-    0x6C, 0x17, 0xE3, 0x0D, 0xB1, 0xFC, 0x67, 0xCF, 0x21, 0xD2, 0xD1, 0x83, 0xA0, 0x96, 0x10, 0xD6,
-    0x32, 0xC2, 0xF2, 0xD4, 0xFB, 0x22, 0x7D, 0x80, 0x71, 0xAB, 0x12, 0x59, 0x62, 0x99, 0x68, 0x11,
-    0x84, 0x55, 0xDB, 0x5C, 0x4F, 0x60, 0x35, 0xF2, 0xF3, 0xBC, 0x25, 0x65, 0xA6, 0xD5, 0x68, 0x26,
-    0xAF, 0x88, 0xC1, 0x3A, 0x87, 0xCF, 0xB3, 0xFB, 0x05, 0xF6, 0x09, 0x02, 0xEB, 0x91, 0x4B, 0xF0,
-    0x33, 0x7A, 0xE8, 0xC0, 0x9C, 0x97, 0x57, 0x50, 0x7A, 0x3B, 0xC7, 0x33, 0x13, 0xD9, 0x5B, 0xD8,
-    0xE4, 0x3F, 0x22, 0xB2, 0xF4, 0x58, 0xBC, 0x9E, 0x46, 0xF3, 0xC7, 0x44, 0xBE, 0xCC, 0x35, 0xA3,
-    0xA7, 0x30, 0x10, 0xF6, 0x85, 0x48, 0x3E, 0xAF, 0x88, 0xD3, 0x75, 0xE2, 0x6F, 0x5E, 0xE0, 0xEB,
-    0xEB, 0x66, 0x3D, 0x89, 0x21, 0x1D, 0xC4, 0xBE, 0x2C, 0xA5, 0x8D, 0x66, 0xA7, 0xB4, 0x71, 0xF1,
-    0x97, 0x7E, 0xD2, 0x58, 0xB7, 0x89, 0x47, 0x72, 0x43, 0x3A, 0x70, 0x56, 0x1E, 0xFA, 0x0F, 0x59,
-    0x1F, 0x83, 0xEC, 0xFD, 0x5A, 0xBA, 0x42, 0xB7, 0x06, 0x10, 0x57, 0xCD, 0xEF, 0xFB, 0xB5, 0x70,
-    0x5E, 0xA8, 0x3C, 0x34, 0x6E, 0xFE, 0x47, 0xED, 0xE9, 0xD9, 0xB1, 0xC6, 0x3A, 0xCF, 0xE3, 0xE8,
-    0xF1, 0xDB, 0x22, 0xC6, 0x3B, 0xBE, 0x88, 0xB1, 0xAD, 0x88, 0x9D, 0xE1, 0xCC, 0x54, 0xE6, 0x88,
-    0xAC, 0x84, 0x75, 0x2E, 0xF7, 0x68, 0x32, 0xB6, 0xDB, 0x29, 0x57, 0x9C, 0x85, 0x9A, 0x81, 0xEF,
-    0xB4, 0xD1, 0x12, 0x49, 0x3A, 0xF6, 0x7C, 0x39, 0xE0, 0xD2, 0xF2, 0x03, 0xE6, 0x18, 0x30, 0x80,
-    0x9E, 0x89, 0x93, 0xA3, 0xAF, 0xDF, 0x5A, 0x38, 0x6D, 0x99, 0xF5, 0xEB, 0xB7, 0xCA, 0x77, 0xD3,
-    0x71, 0x8D, 0x43, 0xF0, 0xD9, 0x68, 0x7B, 0xAD, 0x89, 0x15, 0xFE, 0x71, 0x8D, 0x4F, 0x7A, 0xC0,
-    0xE2, 0x03, 0x16, 0xFE, 0xB0, 0xEB, 0xF6, 0x67, 0x04, 0x17, 0x52, 0x1D, 0x1E, 0x78, 0x6D, 0x7F,
-    0x36, 0x2F, 0xDF, 0xC6, 0x7A, 0x59, 0xC9, 0x30, 0xD5, 0xC7, 0x3D, 0x40, 0xF7, 0x41, 0xBF, 0xA5,
-    0xA2, 0xFF, 0xC7, 0xA1, 0xF1, 0x98, 0x92, 0x16, 0x78, 0x96, 0x7D, 0x26, 0x64, 0x62, 0x7B, 0xC1,
-    0xCE, 0xC0, 0x68, 0xE4, 0x0B, 0xE6, 0x9E, 0x42, 0xFD, 0xC5, 0xCF, 0xC3, 0xE9, 0xCF, 0xE9, 0x26,
-    0x61, 0x4F, 0xCA, 0x1F, 0x62, 0xC2, 0xC3, 0x16, 0x20, 0xC1, 0xE0, 0xCB, 0xD3, 0x11, 0x7A, 0x91,
-    0x1E, 0xDD, 0x00, 0x39, 0xA3, 0x5C, 0x0B, 0x2E, 0xA3, 0xC9, 0xA6, 0x02, 0xBB, 0xF8, 0x8C, 0x26,
-    0x02, 0x44, 0x3A, 0x91, 0xD1, 0x81, 0x8A, 0x20, 0xBD, 0xCA, 0x90, 0xF5, 0x04, 0x3C, 0x06, 0xC9,
-    0x06, 0x16, 0x3E, 0x5E, 0x1F, 0x35, 0xF5, 0x8A, 0x05, 0x16, 0x04, 0xE8, 0xF8, 0xB6, 0x1A, 0xF4,
-    0xEE, 0x95, 0x06, 0xF8, 0x8C, 0x51, 0x7A, 0x35, 0x9C, 0x0B, 0x3C, 0x7B, 0x71, 0x3E, 0x9F, 0x8D,
-    0x98, 0x12, 0xC5, 0x9F, 0x81, 0x98, 0x24, 0xF5, 0x2B, 0xE5, 0x4E, 0xA0, 0xAC, 0x90, 0x1C, 0x19,
-    0x61, 0x20, 0x93, 0x8A, 0xC6, 0x3B, 0x55, 0x80, 0xAF, 0x36, 0xC3, 0x4B, 0xCD, 0x2D, 0xCD, 0xB7,
-    0xFB, 0xAA, 0xD4, 0xD2, 0x69, 0x59, 0xA9, 0xD1, 0x7B, 0x10, 0x56, 0xD9, 0x93, 0xE2, 0x19, 0x6F,
-    0x4C, 0x10, 0xCB, 0x72, 0xBD, 0x73, 0x45, 0xFC, 0x04, 0xF0, 0xDE, 0x59, 0x68, 0x85, 0xA2, 0x43,
-    0x32, 0xAC, 0x75, 0x98, 0xB5, 0x0C, 0x7F, 0xE9, 0xC8, 0x9F, 0x90, 0x26, 0x4B, 0x6D, 0xCA, 0x14,
-    0x73, 0xD5, 0x13, 0xF9, 0xEF, 0x91, 0x8E, 0x01, 0xB0, 0xB8, 0x76, 0x66, 0x7C, 0x46, 0xB9, 0xE3,
-    0x58, 0x35, 0x01, 0x4F, 0x3D, 0x1D, 0xB2, 0xC4, 0x58, 0x62, 0x44, 0x92, 0x96, 0xA0, 0xBC, 0x3A,
-    0x4D, 0xED, 0xD3, 0xDA, 0x65, 0xED, 0x7F, 0x1D, 0x28, 0xCE, 0x70, 0xE6, 0xEF, 0x00, 0x8A, 0xB3,
-    0x5C, 0x33, 0x38, 0x41, 0xDA, 0x27, 0xB5, 0x72, 0x02, 0x25, 0xEB, 0x0E, 0x5B, 0x1B, 0x74, 0x1B,
-    0x4E, 0xF0, 0x72, 0xEE, 0xE7, 0xE6, 0x2D, 0x34, 0xE6, 0xAA, 0x1D, 0x43, 0x72, 0xA3, 0xA1, 0xB6,
-    0xD0, 0x04, 0x37, 0xF7, 0x21, 0xB9, 0xE3, 0xEC, 0xF7, 0x58, 0x08, 0xC0, 0x7E, 0xA7, 0x03, 0xC1,
-    0xA0, 0xE1, 0xF4, 0x6C, 0x37, 0x68, 0x48, 0x8E, 0x69, 0x4C, 0x3A, 0x7F, 0xAC, 0x4C, 0xF7, 0xFA,
-    0xC6, 0xBD, 0x6F, 0x46, 0x9D, 0xCF, 0x5D, 0x58, 0x85, 0xD0, 0xCA, 0xEA, 0xDE, 0x9A, 0xA1, 0x9F,
-    0xDD, 0xD2, 0x83, 0x35, 0x02, 0xB1, 0x50, 0x46, 0x3E, 0x1A, 0xF6, 0x0B, 0x53, 0x3D, 0x3E, 0x7E,
-    0xEE, 0x96, 0x92, 0x82, 0x66, 0xEE, 0xB3, 0xD8, 0x4D, 0x17, 0xCD, 0x57, 0xB6, 0x79, 0xD8, 0xCF,
-    0x2F, 0xF9, 0x2B, 0x90, 0xBC, 0x83, 0xA8, 0x87, 0x6C, 0xB1, 0xFC, 0x0B, 0x0D, 0x3B, 0x15, 0x5E,
-    0x1F, 0x83, 0x8A, 0x78, 0x6F, 0xAA, 0x15, 0xC8, 0xFD, 0xF6, 0x9F, 0x24, 0x9E, 0x0A, 0xF0, 0xF2,
-    0x67, 0x10, 0xB2, 0x92, 0xB7, 0x40, 0x64, 0x06, 0x0B, 0xF7, 0xAD, 0x05, 0xA1, 0xFB, 0x03, 0x3D,
-    0x2F, 0xD4, 0x33, 0x4E, 0xFA, 0x26, 0x38, 0x22, 0xB3, 0xA6, 0xBD, 0x2D, 0x87, 0xF6, 0x47, 0x0A,
-    0x1B, 0x0E, 0x9D, 0x6A, 0x8A, 0x5D, 0xEE, 0x94, 0x33, 0xC8, 0x47, 0xE8, 0x68, 0x0B, 0x1F, 0xC1,
-    0xF6, 0x24, 0x2C, 0x0B, 0xD3, 0xC5, 0x72, 0xEA, 0xCC, 0x33, 0x26, 0x62, 0x35, 0x6F, 0xCA, 0xD0,
-    0x4D, 0x7B, 0x42, 0x71, 0xED, 0x48, 0x1C, 0xC0, 0x9F, 0x74, 0xB3, 0x1A, 0x2B, 0x13, 0xF9, 0xD3,
-    0x63, 0xC0, 0x39, 0xEF, 0x53, 0x5C, 0x7C, 0x9E, 0x43, 0x6F, 0xCA, 0xE8, 0xA7, 0x39, 0xF4, 0x59,
-    0x0B, 0xF0, 0xB2, 0x72, 0xE8, 0x9E, 0xCC, 0xA9, 0xDB, 0x72, 0xE8, 0x60, 0xCB, 0xA1, 0xCF, 0x5C,
-    0x03, 0xD4, 0x7E, 0xB3, 0x50, 0xD8, 0x90, 0x14, 0x36, 0x3E, 0x4D, 0x61, 0xCF, 0x5C, 0x00, 0x05,
-    0x48, 0x65, 0x64, 0xBB, 0x77, 0xC1, 0xC2, 0xD9, 0x4B, 0x76, 0xBA, 0x66, 0xE7, 0x5A, 0xD2, 0x35,
-    0x3D, 0x1B, 0xE0, 0xCD, 0x34, 0x66, 0xF3, 0x1A, 0x5C, 0x3B, 0x22, 0x5C, 0xC1, 0x9C, 0x3E, 0xA0,
-    0x7C, 0xCB, 0xED, 0x10, 0xDB, 0xEB, 0x01, 0xC4, 0x23, 0x3D, 0xEC, 0xE6, 0x75, 0xD7, 0x70, 0x66,
-    0x7A, 0x1C, 0x33, 0xC1, 0x86, 0x20, 0xED, 0x26, 0xAB, 0xD3, 0x0C, 0xD5, 0x27, 0x7D, 0xC9, 0xBC,
-    0x15, 0xC1, 0x5F, 0x21, 0xF1, 0xF7, 0xD5, 0x78, 0xB7, 0x53, 0x8F, 0x94, 0xF5, 0x36, 0x0B, 0x6F,
-    0xDF, 0xAD, 0x17, 0x4B, 0xD6, 0x7C, 0xD7, 0x1F, 0xB6, 0x0E, 0xAB, 0x49, 0xEF, 0x9C, 0xF3, 0xEA,
-    0x31, 0x5B, 0xDA, 0xFF, 0x80, 0xE1, 0xAD, 0x62, 0xB8, 0xAD, 0x64, 0xA9, 0x39, 0xC2, 0xF9, 0x19,
-    0xF0, 0x08, 0x3A, 0xE0, 0xD8, 0x8D, 0xBF, 0x6D, 0x07, 0xB2, 0x34, 0xF9, 0x3B, 0xD1, 0x3C, 0x34,
-    0xA8, 0xF5, 0x62, 0xB4, 0x26, 0xE3, 0x9A, 0xA5, 0x83, 0xA7, 0x5A, 0x7F, 0x77, 0x58, 0x6B, 0x7B,
-    0x79, 0x34, 0x57, 0x92, 0x03, 0x23, 0x78, 0x06, 0xD1, 0xBC, 0xB8, 0x94, 0xD6, 0x34, 0x31, 0x55,
-    0x09, 0xFC, 0x4D, 0x3B, 0x2D, 0x5C, 0x6D, 0x2F, 0x21, 0x6F, 0x1E, 0x1F, 0x31, 0x18, 0xC4, 0x23,
-    0x03, 0x52, 0xF6, 0xB5, 0x02, 0xC1, 0x15, 0x2E, 0x60, 0x2F, 0xF8, 0x7F, 0xA0, 0xF6, 0xFF, 0x01,
-    0xD5, 0x5C, 0xBF, 0x93, 0xE5, 0x54, 0x76, 0xBE, 0x92, 0xB6, 0x5B, 0xAE, 0x56, 0xA0, 0x09, 0x60,
-    0x77, 0x81, 0x2A, 0x2B, 0xF6, 0x38, 0xD0, 0x7F, 0xB0, 0x12, 0x10, 0x38, 0x20, 0xA0, 0x83, 0x69,
-    0x57, 0xB9, 0x1C, 0xE0, 0x00, 0xAA, 0x0C, 0x5B, 0x76, 0x27, 0x4E, 0x5C, 0x5E, 0x5B, 0xF2, 0x12,
-    0x6C, 0x40, 0x40, 0x07, 0x64, 0x04, 0x4C, 0x30, 0xAE, 0x5A, 0x9A, 0x60, 0x12, 0x07, 0x6B, 0x97,
-    0x3D, 0x12, 0x9E, 0x80, 0x80, 0x00, 0x01, 0xB5, 0xB5, 0xC1, 0x06, 0x23, 0xCC, 0xAC, 0xB7, 0x18,
-    0x07, 0x23, 0x28, 0x01, 0x9A, 0x1E, 0x49, 0xD7, 0xE7, 0xFB, 0xCE, 0xD5, 0xFB, 0xD1, 0xDD, 0x43,
-    0x0D, 0xE5, 0x1A, 0xE8, 0x9D, 0xE2, 0x89, 0xD7, 0x4F, 0x4F, 0xBA, 0xE7, 0x7E, 0xF7, 0xDC, 0xF3,
-    0xE3, 0x3B, 0x47, 0xCF, 0x18, 0x73, 0x70, 0xB0, 0x6F, 0x4C, 0x6A, 0x27, 0x63, 0x02, 0x6B, 0x6B,
-    0x63, 0x32, 0x3B, 0x9A, 0xAD, 0x7F, 0x55, 0x2F, 0x87, 0xD8, 0x96, 0xC6, 0xF8, 0x3C, 0x55, 0xE0,
-    0x5B, 0xF1, 0x7D, 0x79, 0xEB, 0xD9, 0x02, 0x17, 0x7C, 0x2A, 0x6F, 0xC3, 0x29, 0x6B, 0x8C, 0xB1,
-    0x37, 0xE5, 0x36, 0x49, 0x2F, 0x6F, 0x03, 0x1B, 0xCC, 0xF2, 0xD5, 0x26, 0x6D, 0x4D, 0x3C, 0xFA,
-    0x56, 0xBE, 0x9A, 0xA7, 0x9D, 0xDC, 0xDB, 0x5A, 0x13, 0xC9, 0xA1, 0x33, 0x16, 0x6F, 0x53, 0x39,
-    0xF4, 0x81, 0x3D, 0xF8, 0x73, 0x9B, 0x57, 0x8D, 0x89, 0xFB, 0x58, 0xEE, 0x64, 0x7F, 0x6E, 0x73,
-    0x13, 0x0F, 0x59, 0x27, 0x6F, 0xDF, 0x97, 0xDB, 0xC9, 0x67, 0xDE, 0xC1, 0x41, 0x2E, 0xDF, 0x95,
-    0x1B, 0xCA, 0xD7, 0x9D, 0x98, 0xF8, 0xB7, 0xBB, 0x0F, 0x99, 0x3A, 0xDC, 0xE7, 0x6B, 0x19, 0xC4,
-    0xDA, 0x36, 0xB1, 0xD7, 0x6D, 0x6E, 0xBB, 0x64, 0x0A, 0xAD, 0xC9, 0xBA, 0x74, 0x30, 0xB6, 0xB6,
-    0x75, 0x30, 0x07, 0x56, 0xA4, 0x4A, 0x06, 0x53, 0xD5, 0x45, 0x1B, 0x58, 0xDF, 0x96, 0xC9, 0x18,
-    0xCD, 0x46, 0xBE, 0x3E, 0x46, 0x36, 0xCF, 0x66, 0x99, 0x16, 0x64, 0xF2, 0xEC, 0x5C, 0x94, 0x9E,
-    0xFD, 0x48, 0xC6, 0xB9, 0xC4, 0xFB, 0xFB, 0x47, 0xDE, 0x55, 0x99, 0x4F, 0x1D, 0x63, 0x96, 0x77,
-    0xE4, 0x63, 0x03, 0xC9, 0x71, 0xCC, 0xE5, 0x78, 0x78, 0x64, 0xCE, 0x01, 0x2A, 0xB0, 0xAD, 0x01,
-    0x9E, 0x35, 0xE0, 0xB1, 0xC6, 0x21, 0x65, 0x8A, 0x5B, 0x72, 0x61, 0x30, 0x67, 0x35, 0xF0, 0xC1,
-    0xE5, 0x84, 0x2A, 0x9C, 0x62, 0xB9, 0x26, 0xEB, 0xB2, 0x16, 0x00, 0x55, 0xA5, 0x62, 0x25, 0xB0,
-    0x45, 0x23, 0xA6, 0x29, 0x83, 0x01, 0xA1, 0x5A, 0xC1, 0x02, 0x6E, 0x93, 0xC9, 0xBE, 0x3C, 0x38,
-    0xEC, 0x7D, 0xB9, 0x43, 0xD6, 0x10, 0xAD, 0x52, 0x80, 0xE3, 0x04, 0xE5, 0xDA, 0x94, 0x37, 0x33,
-    0x7B, 0xA5, 0x7F, 0x64, 0x32, 0x93, 0xE5, 0xC6, 0xBE, 0x33, 0x0A, 0x40, 0xB6, 0x91, 0x83, 0x8C,
-    0xE6, 0xDD, 0xC8, 0x9D, 0xA4, 0x2F, 0x51, 0xC4, 0xB8, 0x93, 0x73, 0x45, 0x2D, 0x43, 0xCC, 0x9E,
-    0x3D, 0xB1, 0x7D, 0x6C, 0x3D, 0xDB, 0x14, 0x1D, 0x01, 0x8A, 0x47, 0xB9, 0x7B, 0xD6, 0x66, 0x02,
-    0xCA, 0xD3, 0xB6, 0x8C, 0xC6, 0x70, 0x26, 0x9E, 0x9E, 0xAD, 0xAB, 0x36, 0x9E, 0xF1, 0x3F, 0x59,
-    0xB7, 0xBB, 0xB6, 0x8E, 0x21, 0x59, 0x62, 0x7F, 0x3F, 0x98, 0x64, 0x92, 0xB5, 0xF6, 0x36, 0xA1,
-    0xC8, 0xE6, 0x05, 0x89, 0x04, 0xB0, 0x11, 0x88, 0x70, 0xB2, 0x0E, 0x07, 0xCF, 0x3E, 0xDF, 0x3B,
-    0x18, 0x8A, 0x06, 0xF3, 0x01, 0x0A, 0x49, 0x1F, 0x0D, 0x0A, 0x42, 0x38, 0xC9, 0x6A, 0x11, 0x03,
-    0x2C, 0xEC, 0xA8, 0x10, 0x54, 0x72, 0x68, 0x88, 0x80, 0x4C, 0x35, 0x98, 0x08, 0xC0, 0x6B, 0x13,
-    0x54, 0x10, 0xF3, 0x9F, 0xE5, 0x2E, 0x00, 0xC2, 0xF8, 0x03, 0x16, 0x82, 0x07, 0x60, 0xEF, 0x4D,
-    0x10, 0xA9, 0xC0, 0xE4, 0x13, 0xCB, 0x25, 0x82, 0xFE, 0xA4, 0xAD, 0x93, 0xD5, 0x7B, 0x03, 0x02,
-    0x8F, 0x59, 0x1D, 0xD9, 0x89, 0x43, 0x0C, 0xA1, 0xFD, 0x5F, 0x19, 0x66, 0x0C, 0x65, 0xEA, 0x75,
-    0x0C, 0x4D, 0x11, 0xD9, 0x44, 0x63, 0x4B, 0x5B, 0x87, 0x93, 0x00, 0x91, 0x76, 0x09, 0x14, 0xAB,
-    0x6A, 0x43, 0x20, 0x95, 0x0D, 0xF8, 0x5F, 0x13, 0xDB, 0xCA, 0x42, 0xBF, 0x47, 0xD9, 0x1F, 0x6F,
-    0xB5, 0xA6, 0xE8, 0x65, 0x35, 0x7F, 0x10, 0x42, 0x5B, 0x2A, 0x79, 0xF1, 0x4D, 0x56, 0x42, 0x77,
-    0x28, 0x80, 0xEC, 0x95, 0x08, 0x5A, 0x10, 0xAD, 0xF7, 0x9A, 0x7F, 0xCC, 0x33, 0xDC, 0x66, 0x25,
-    0x94, 0x07, 0xF2, 0xF2, 0x50, 0x6D, 0xAB, 0x59, 0x62, 0x6F, 0x63, 0x13, 0xCA, 0x3D, 0xB0, 0x7B,
-    0x0C, 0xD1, 0xA9, 0x66, 0xEF, 0x3F, 0x4D, 0x31, 0x08, 0xFE, 0x19, 0xEE, 0x98, 0xE0, 0x10, 0xCF,
-    0xBC, 0x21, 0x66, 0x88, 0x1B, 0x1A, 0x51, 0x14, 0x91, 0x81, 0x9B, 0x79, 0x5C, 0xCE, 0x18, 0x42,
-    0xA1, 0x1F, 0xE2, 0xEB, 0xBE, 0xFE, 0x3D, 0x99, 0xBF, 0x31, 0x58, 0xD9, 0x1C, 0x77, 0x6F, 0xF0,
-    0x56, 0xBE, 0x51, 0x61, 0x5C, 0x73, 0x65, 0x25, 0x2C, 0x64, 0x85, 0xA8, 0x94, 0x14, 0xAF, 0x45,
-    0x4E, 0xEF, 0x5F, 0x20, 0xE4, 0x08, 0xDD, 0xC5, 0xAB, 0x4C, 0xEC, 0x9B, 0x02, 0x8F, 0x80, 0x80,
-    0xA5, 0xE7, 0x97, 0x65, 0x90, 0x42, 0x10, 0x11, 0x18, 0x8D, 0xA0, 0xAB, 0x13, 0x2E, 0x64, 0x3D,
-    0x92, 0xC9, 0xFC, 0x55, 0x60, 0xEF, 0x0F, 0x32, 0xBD, 0x19, 0xFA, 0x5E, 0xCA, 0x9B, 0x72, 0x19,
-    0xF3, 0x18, 0xFB, 0x8D, 0x16, 0x88, 0xFB, 0xCF, 0xBE, 0x0E, 0x0B, 0xF1, 0xB4, 0x5C, 0x7E, 0x43,
-    0xB6, 0xE8, 0x45, 0x03, 0x08, 0xC2, 0x42, 0x56, 0x7E, 0x45, 0x24, 0x85, 0xA0, 0x2B, 0x39, 0x1F,
-    0x11, 0x40, 0x3F, 0x30, 0x8B, 0x5A, 0x73, 0x7A, 0xA1, 0xCA, 0x0F, 0x0D, 0xDA, 0xCB, 0x2F, 0x9C,
-    0x06, 0x41, 0xD8, 0x0A, 0xCA, 0x53, 0xF3, 0x45, 0x39, 0xFF, 0xC4, 0xC9, 0xF7, 0x72, 0x4E, 0x78,
-    0x2A, 0x0B, 0xA3, 0x2E, 0xDB, 0xEB, 0x7F, 0x7A, 0xA0, 0x03, 0x91, 0x32, 0xB5, 0x70, 0x04, 0x07,
-    0x78, 0x54, 0xEE, 0x85, 0xF7, 0x45, 0xEF, 0x95, 0x99, 0xAD, 0x04, 0x4D, 0x31, 0x58, 0xF2, 0xF2,
-    0xE0, 0x30, 0x76, 0x30, 0xF3, 0x97, 0xCD, 0xDE, 0x91, 0x09, 0x87, 0x50, 0xD0, 0x4C, 0x3F, 0x52,
-    0x33, 0x5E, 0x62, 0x03, 0x02, 0xAA, 0x6C, 0x38, 0x67, 0x77, 0x25, 0x10, 0x97, 0xE2, 0xAB, 0x15,
-    0x26, 0x38, 0x89, 0x5C, 0x99, 0xAB, 0xED, 0xC0, 0xF0, 0x3A, 0x5D, 0x9D, 0x3E, 0xD6, 0xC9, 0xF8,
-    0x84, 0x3A, 0xEB, 0x57, 0xC8, 0x40, 0xD0, 0xE5, 0x6D, 0xBF, 0x6C, 0x6E, 0x93, 0x72, 0xCB, 0xDB,
-    0xDE, 0xFB, 0x57, 0x07, 0x50, 0x46, 0x6C, 0xF8, 0x56, 0xA6, 0x7B, 0xB4, 0x20, 0x04, 0xA1, 0x29,
-    0x33, 0x45, 0x86, 0xC4, 0x14, 0x78, 0x25, 0xEF, 0xEE, 0x1B, 0xAA, 0x44, 0x32, 0xD5, 0x1A, 0x30,
-    0x99, 0x62, 0x3E, 0xCC, 0x81, 0x13, 0xE1, 0xC4, 0x80, 0x1C, 0x1A, 0xA2, 0x86, 0x90, 0x14, 0x30,
-    0x41, 0x97, 0x88, 0x55, 0x68, 0xF3, 0x1F, 0x1B, 0x80, 0xE5, 0xE1, 0x4A, 0x2A, 0x52, 0x82, 0xBB,
-    0x13, 0x2E, 0x73, 0x39, 0xDF, 0x15, 0xBF, 0x57, 0xE5, 0x15, 0x54, 0x11, 0x1E, 0xCA, 0xE3, 0x8E,
-    0x0B, 0x20, 0xA7, 0x5C, 0x5A, 0x6E, 0x01, 0x16, 0xDB, 0xCF, 0x18, 0x14, 0xD0, 0x1A, 0xC0, 0x59,
-    0xC5, 0x3C, 0x66, 0x5F, 0x1E, 0xCA, 0x27, 0x70, 0x10, 0x18, 0x5E, 0xF4, 0x45, 0x2C, 0xB6, 0x08,
-    0x25, 0x67, 0xAA, 0x46, 0x04, 0xA3, 0x0F, 0x86, 0x3C, 0x22, 0x4D, 0x4A, 0x7F, 0x66, 0xE1, 0xCF,
-    0x02, 0xB8, 0x6D, 0x59, 0x69, 0xE8, 0x9B, 0x6D, 0xA3, 0x09, 0x4A, 0x2C, 0x57, 0x15, 0xB0, 0xB7,
-    0xA1, 0x78, 0x72, 0xBB, 0x23, 0x8E, 0x2C, 0xA1, 0x4A, 0x55, 0xF0, 0x86, 0x58, 0x9E, 0x12, 0x23,
-    0xAA, 0x2F, 0xF6, 0xAE, 0xEC, 0x5C, 0xE1, 0x72, 0x20, 0x18, 0x31, 0xD5, 0x47, 0x6A, 0x6C, 0x63,
-    0xAE, 0xD6, 0x48, 0x07, 0x90, 0x7D, 0xDA, 0xAF, 0xD4, 0xF9, 0xA5, 0x08, 0x8E, 0x21, 0x99, 0x25,
-    0x30, 0x11, 0x79, 0x66, 0xC0, 0x06, 0x5F, 0x88, 0xD3, 0x5F, 0x61, 0xAA, 0xF4, 0x73, 0x40, 0x10,
-    0x40, 0x8A, 0x88, 0x50, 0x7A, 0x7A, 0x45, 0x2E, 0xAD, 0x88, 0x2C, 0xB7, 0x09, 0xE9, 0xD3, 0x0C,
-    0x6E, 0x21, 0x13, 0xC4, 0x6D, 0xAB, 0x36, 0xE2, 0x2D, 0xEA, 0x82, 0x4B, 0x70, 0x97, 0xD1, 0x92,
-    0xD5, 0x50, 0xC0, 0x7E, 0x3D, 0x70, 0xC4, 0x04, 0xE2, 0x79, 0xF9, 0x06, 0x80, 0x1E, 0x07, 0x4E,
-    0xB1, 0x13, 0x55, 0xE5, 0x88, 0x1F, 0xE0, 0x18, 0x01, 0x91, 0xAD, 0x45, 0xD6, 0x78, 0x52, 0xF8,
-    0x62, 0x00, 0x27, 0x5F, 0xCD, 0xAB, 0x4F, 0x45, 0x75, 0xA2, 0x49, 0x14, 0xC8, 0xD8, 0xDF, 0xC8,
-    0x45, 0xF1, 0xF8, 0x23, 0x7B, 0x05, 0x23, 0xB7, 0xA2, 0x26, 0x0A, 0x9E, 0x6D, 0x3C, 0xDB, 0xCA,
-    0x05, 0x85, 0x78, 0xD0, 0x77, 0x0B, 0x9B, 0x13, 0x3B, 0x9F, 0xDB, 0x3E, 0xC3, 0xD2, 0xCB, 0x60,
-    0xB7, 0x1D, 0x74, 0xC6, 0xE9, 0x86, 0x01, 0x2C, 0xDE, 0xB1, 0xBD, 0x87, 0x58, 0xD0, 0x22, 0x94,
-    0x83, 0x21, 0xBB, 0x7C, 0xFD, 0xA4, 0x54, 0x1D, 0xF7, 0x8E, 0x64, 0xB6, 0xBE, 0x85, 0xCB, 0xB5,
-    0x56, 0xB4, 0x2A, 0xC3, 0x42, 0x44, 0xF6, 0xB7, 0x88, 0x53, 0x24, 0xA2, 0x32, 0x8C, 0xBA, 0x44,
-    0xF2, 0x78, 0x50, 0x98, 0x64, 0xF9, 0x93, 0x4E, 0xEE, 0x2C, 0x4E, 0x5D, 0xEE, 0x2C, 0xE8, 0x15,
-    0x40, 0x28, 0x44, 0xB0, 0x61, 0x18, 0x7B, 0x05, 0x4E, 0x6D, 0x00, 0x4E, 0x36, 0x48, 0xD8, 0x62,
-    0x1E, 0x53, 0x64, 0x18, 0x9A, 0x56, 0xBA, 0x3B, 0xBA, 0x25, 0xF8, 0x5A, 0xEB, 0x9D, 0x5C, 0x9A,
-    0x58, 0x35, 0xA3, 0x83, 0xCE, 0x46, 0x42, 0x83, 0x7D, 0xDD, 0x76, 0x9C, 0x08, 0xED, 0x15, 0x37,
-    0xA8, 0xFD, 0xF5, 0x41, 0xEE, 0x59, 0x1A, 0x05, 0xC1, 0x0D, 0xF3, 0x97, 0x51, 0x8F, 0x8F, 0x75,
-    0x8B, 0x70, 0x7B, 0x50, 0x17, 0xE2, 0x69, 0xB1, 0x6D, 0x3C, 0x9C, 0xBE, 0x3B, 0x37, 0xEA, 0xCE,
-    0xC1, 0x01, 0x24, 0x6E, 0x28, 0x4E, 0x66, 0xDD, 0x76, 0xFC, 0x21, 0x25, 0xC5, 0xED, 0x47, 0x0E,
-    0x61, 0xDB, 0xA2, 0x15, 0x8D, 0x1E, 0x24, 0xDE, 0x9C, 0xD3, 0x3E, 0xB4, 0xCF, 0xCF, 0xD7, 0xED,
-    0x7B, 0x72, 0xE2, 0x5D, 0x9C, 0xAC, 0xE6, 0x6B, 0xD0, 0x16, 0x0E, 0x0C, 0x15, 0x2B, 0xB3, 0xF9,
-    0x2F, 0xBB, 0x90, 0x56, 0x58, 0x04, 0x0B, 0x57, 0x76, 0xCB, 0x5C, 0x13, 0x2B, 0x60, 0x46, 0x23,
-    0x52, 0x21, 0x92, 0x53, 0x28, 0x32, 0x04, 0x0F, 0xBB, 0xF7, 0xCC, 0x05, 0x80, 0xE2, 0xC9, 0x5C,
-    0x42, 0xCD, 0xC1, 0x93, 0xB1, 0x4F, 0xB0, 0x5F, 0x05, 0x8F, 0x10, 0xAA, 0xB2, 0xB7, 0x08, 0xB7,
-    0xF3, 0x06, 0xAC, 0xEC, 0x20, 0x9F, 0x22, 0xB8, 0x96, 0xD1, 0xB2, 0x21, 0x19, 0xA0, 0xC5, 0xFF,
-    0x2C, 0x01, 0xE6, 0x00, 0x58, 0x9E, 0xB5, 0xEF, 0xD8, 0x4E, 0x6C, 0x87, 0xC4, 0x5A, 0xA2, 0x44,
-    0xC0, 0x85, 0x83, 0xAB, 0x89, 0x32, 0xBE, 0x01, 0x30, 0x9E, 0x0B, 0x7E, 0xC5, 0x2E, 0x00, 0x6D,
-    0x45, 0x86, 0x2A, 0xE2, 0xDB, 0xC5, 0xC0, 0xD2, 0xD7, 0x05, 0x34, 0xC8, 0x2F, 0x5E, 0x04, 0x64,
-    0x18, 0x08, 0x4B, 0x28, 0x4B, 0xC1, 0xD4, 0x20, 0x37, 0xC8, 0x27, 0x5C, 0x80, 0xF4, 0x92, 0xE2,
-    0x22, 0x97, 0xD6, 0x70, 0x35, 0xF1, 0x1C, 0xCE, 0x80, 0xE5, 0x17, 0x12, 0x69, 0xFE, 0xB7, 0xCD,
-    0x8B, 0xDE, 0xDE, 0xB1, 0x23, 0x50, 0xC1, 0xC9, 0xC8, 0xDE, 0xC9, 0xE9, 0x5A, 0xE8, 0xFF, 0x47,
-    0xF3, 0x47, 0x81, 0xFD, 0x5D, 0x05, 0x7B, 0x5B, 0x13, 0x93, 0x02, 0x66, 0xFB, 0xCA, 0xF7, 0x39,
-    0xD5, 0x14, 0xB6, 0x74, 0x5E, 0x22, 0xEE, 0x10, 0x1F, 0x45, 0xEA, 0x28, 0xEA, 0x25, 0xD6, 0x5E,
-    0xBB, 0x8C, 0xBF, 0x80, 0x93, 0x9B, 0xA9, 0x11, 0x58, 0xF2, 0x40, 0x54, 0xE1, 0x55, 0xD1, 0x8B,
-    0x4F, 0xA0, 0x10, 0x55, 0x93, 0x4C, 0xD9, 0x49, 0x65, 0x61, 0xA3, 0x70, 0xD2, 0xB7, 0x27, 0x47,
-    0x94, 0x39, 0x19, 0x9C, 0x3A, 0xD8, 0x7B, 0x87, 0x00, 0x0C, 0x29, 0xC1, 0xA8, 0xDA, 0xF0, 0xA3,
-    0x41, 0xC7, 0x65, 0xC8, 0x3F, 0xB9, 0x30, 0x3F, 0xB1, 0x6E, 0x60, 0x04, 0x43, 0xDE, 0x35, 0xF1,
-    0x67, 0x12, 0x7B, 0x4B, 0xAA, 0x1A, 0x0D, 0x15, 0x22, 0x0D, 0xCD, 0x48, 0x56, 0xC2, 0x6D, 0x2B,
-    0x4B, 0x08, 0x2C, 0x7C, 0xBA, 0x15, 0x24, 0x94, 0x0A, 0x21, 0x67, 0x1F, 0xCE, 0x2B, 0x27, 0xAF,
-    0x31, 0x0E, 0xCE, 0x24, 0x56, 0xF5, 0x7B, 0xE2, 0x35, 0x72, 0xE6, 0xCE, 0x71, 0xA9, 0x88, 0x33,
-    0x26, 0x20, 0x8A, 0xC1, 0xC6, 0x35, 0xDD, 0x02, 0x63, 0x04, 0x83, 0x1F, 0x2C, 0xE3, 0x34, 0xD8,
-    0x4C, 0xFE, 0x35, 0x53, 0x94, 0x45, 0x69, 0xAA, 0xE7, 0x06, 0x75, 0xF8, 0x3E, 0x66, 0x18, 0xAC,
-    0xC0, 0x83, 0x8D, 0x81, 0xDA, 0x78, 0x6E, 0xA5, 0xC5, 0xDF, 0x88, 0x95, 0x81, 0xE2, 0x94, 0x30,
-    0x33, 0x3E, 0x34, 0x27, 0x16, 0x3B, 0x53, 0x17, 0x8B, 0x15, 0x82, 0xEE, 0xD0, 0xD2, 0x70, 0xFD,
-    0x69, 0x6A, 0xA8, 0x3D, 0xA1, 0x93, 0xA0, 0x53, 0x63, 0xE3, 0x42, 0x32, 0xF3, 0xCA, 0x55, 0x4A,
-    0x57, 0x1A, 0xDD, 0xC7, 0x9E, 0x7D, 0x01, 0x61, 0x56, 0x2D, 0x61, 0x40, 0xDC, 0xFA, 0xDB, 0xAC,
-    0xC0, 0x53, 0x70, 0x0F, 0x89, 0x5A, 0x7E, 0x0D, 0x40, 0x44, 0xB0, 0x6A, 0xCE, 0x0F, 0xE5, 0xC3,
-    0xDC, 0x5C, 0x72, 0x61, 0x52, 0x7F, 0x2A, 0x4C, 0x1A, 0xC5, 0xA4, 0x23, 0x65, 0xB2, 0x7D, 0x26,
-    0xE9, 0xA3, 0x85, 0x7B, 0xB3, 0x92, 0x5A, 0xED, 0x5E, 0x67, 0x02, 0x5B, 0x35, 0xE2, 0xEA, 0xE3,
-    0x31, 0x60, 0xDC, 0x20, 0x61, 0x92, 0xA0, 0x6E, 0x25, 0x34, 0x40, 0x30, 0xA7, 0xEE, 0x8A, 0x1E,
-    0x47, 0x84, 0xF6, 0xD4, 0x69, 0x3D, 0x4E, 0x49, 0xF6, 0xDE, 0x06, 0xAE, 0xD6, 0x45, 0x75, 0x4C,
-    0x2D, 0xE3, 0x5E, 0x5C, 0x7E, 0x5A, 0x52, 0x15, 0x97, 0x74, 0x37, 0xB2, 0x37, 0xC5, 0x75, 0xDB,
-    0xDF, 0xD3, 0xC6, 0x0E, 0xCC, 0x77, 0x03, 0xF8, 0x68, 0x12, 0x05, 0x4C, 0xF1, 0xE8, 0xDA, 0xE1,
-    0x2A, 0x1B, 0x32, 0x05, 0xCC, 0xF1, 0x98, 0xF1, 0xA6, 0x43, 0x40, 0xC6, 0x40, 0x22, 0x00, 0x24,
-    0x79, 0x74, 0xE6, 0xA1, 0xFD, 0x7A, 0x16, 0x39, 0xDE, 0x5B, 0x6F, 0x95, 0x51, 0xD7, 0xFC, 0xEF,
-    0x30, 0xEB, 0x02, 0x9A, 0x83, 0x2D, 0xCA, 0x38, 0x5D, 0xC0, 0x62, 0xAE, 0x09, 0x73, 0x69, 0x68,
-    0x2F, 0xD5, 0x60, 0xAA, 0x43, 0x23, 0xD4, 0x6B, 0x9B, 0x79, 0xD1, 0xF0, 0xF5, 0x8F, 0x64, 0x03,
-    0x05, 0x5D, 0x20, 0xF9, 0xF6, 0x7C, 0xBD, 0x53, 0x36, 0x41, 0x13, 0xB0, 0xA7, 0x6E, 0x9B, 0x8B,
-    0x85, 0xAF, 0xD9, 0xC1, 0x21, 0xD0, 0x6C, 0x1F, 0x1B, 0x8D, 0xE1, 0xAE, 0x8C, 0x07, 0x93, 0x7B,
-    0xF5, 0x82, 0xE2, 0x6B, 0xCC, 0xBE, 0x71, 0x3C, 0x40, 0xBC, 0x4E, 0xBC, 0x60, 0x3B, 0xBC, 0xA3,
-    0x8B, 0x86, 0x2F, 0x7D, 0x57, 0x25, 0xB1, 0xB6, 0xB7, 0x44, 0xE0, 0x74, 0x07, 0x98, 0xE1, 0xED,
-    0x5D, 0xF1, 0xD3, 0xFD, 0x92, 0x3D, 0x86, 0x6A, 0xF1, 0xDA, 0xE5, 0xBE, 0x22, 0xC4, 0xCE, 0xC1,
-    0x3E, 0xE4, 0x10, 0x8F, 0x9F, 0x13, 0x33, 0x85, 0xEF, 0x15, 0xDB, 0x8A, 0x49, 0x8C, 0x26, 0x98,
-    0x48, 0x5B, 0x67, 0xCA, 0xFD, 0xD4, 0x4C, 0x1B, 0x72, 0x89, 0x23, 0xAB, 0x75, 0x0A, 0xA6, 0x21,
-    0x74, 0x62, 0x67, 0xB9, 0xB3, 0xB7, 0xBF, 0x4E, 0xD7, 0xBA, 0x95, 0xE3, 0x07, 0xB7, 0xA6, 0x9E,
-    0x87, 0x8E, 0x60, 0x09, 0x14, 0x34, 0xAB, 0x9C, 0x16, 0x32, 0x28, 0x1A, 0x96, 0xAB, 0x56, 0x04,
-    0xD0, 0x85, 0xC1, 0xF7, 0xF2, 0x35, 0xB3, 0x50, 0x1C, 0x01, 0xED, 0x72, 0x3C, 0xC0, 0xAE, 0x65,
-    0x8D, 0x38, 0x85, 0x33, 0x2C, 0x07, 0x94, 0x44, 0x32, 0x8F, 0x64, 0x70, 0xC9, 0x15, 0xC4, 0xD3,
-    0x63, 0x87, 0x0F, 0xE5, 0x28, 0x1F, 0x22, 0x13, 0xE8, 0xE0, 0x43, 0x11, 0x89, 0xD7, 0xCC, 0x24,
-    0xEE, 0x1C, 0x57, 0x2D, 0xD6, 0x0F, 0x99, 0xC1, 0xA2, 0xFA, 0x96, 0x4C, 0x1B, 0xF3, 0x0D, 0x9F,
-    0x01, 0xBB, 0xAC, 0x47, 0x84, 0xEC, 0x0A, 0x11, 0x00, 0x8E, 0xA3, 0x4B, 0xE2, 0xA2, 0x53, 0x03,
-    0x76, 0xEB, 0x01, 0x95, 0xC0, 0xCA, 0xE8, 0x7A, 0x41, 0xC9, 0x09, 0x92, 0xC1, 0x24, 0xE9, 0x6B,
-    0x56, 0x86, 0x2E, 0x6C, 0xF7, 0x0E, 0x16, 0xD5, 0xC6, 0x96, 0xA4, 0x27, 0x25, 0x2A, 0x70, 0x8A,
-    0xCC, 0xC8, 0xC2, 0x69, 0x77, 0xDF, 0xA4, 0x5F, 0x08, 0x1A, 0x92, 0x36, 0xB5, 0x4C, 0x0B, 0x12,
-    0xC9, 0x2B, 0xF2, 0x6A, 0x80, 0x86, 0xD4, 0x69, 0x2F, 0xD2, 0xC8, 0x26, 0x13, 0xDD, 0xF1, 0xC0,
-    0x50, 0x32, 0x9B, 0x00, 0x43, 0x99, 0x23, 0x3D, 0x0A, 0xB0, 0x46, 0x09, 0x32, 0xCC, 0xAA, 0x0E,
-    0x95, 0xF1, 0x95, 0xBB, 0x2B, 0xE3, 0xBB, 0x80, 0xC5, 0xB4, 0xB2, 0x71, 0xC2, 0xFF, 0x54, 0xA0,
-    0xB0, 0x9F, 0x61, 0xB5, 0x64, 0x35, 0x78, 0x9C, 0xF6, 0xEC, 0xC9, 0x71, 0x75, 0x52, 0xEA, 0xD4,
-    0x09, 0x98, 0x4C, 0x70, 0x3E, 0x7E, 0x67, 0x36, 0x8A, 0x18, 0xB5, 0x9D, 0x94, 0x2A, 0x53, 0x5C,
-    0xAB, 0x19, 0x14, 0xE9, 0x19, 0x20, 0xDD, 0x9B, 0xE5, 0xCA, 0xC6, 0x41, 0x83, 0x98, 0x81, 0x39,
-    0x9B, 0x83, 0x8D, 0x89, 0x6E, 0xED, 0x4E, 0x06, 0x56, 0xA7, 0xCD, 0x9C, 0x35, 0x6B, 0x1D, 0xE7,
-    0x77, 0xDD, 0x1E, 0xAB, 0x7F, 0x4E, 0xA1, 0x24, 0x3F, 0xB5, 0xC7, 0xB9, 0xCC, 0x04, 0xC1, 0x5B,
-    0xFD, 0xA2, 0x5C, 0x91, 0xCA, 0x32, 0xDC, 0x17, 0x7C, 0xE1, 0xE2, 0x7D, 0x7B, 0xAF, 0xEA, 0x62,
-    0xCC, 0x3E, 0x1B, 0x24, 0x14, 0x06, 0x57, 0xA9, 0xB4, 0x77, 0xEF, 0xB8, 0x4A, 0x19, 0x40, 0x30,
-    0x83, 0x9E, 0x16, 0x0D, 0x58, 0xDD, 0x5C, 0xA2, 0x6F, 0xE8, 0x6F, 0x26, 0x01, 0x14, 0x11, 0xE4,
-    0xB2, 0xE4, 0xF8, 0x44, 0x76, 0xD6, 0xDD, 0x86, 0x99, 0xDE, 0x3F, 0x89, 0x01, 0x8C, 0xEA, 0xA7,
-    0x36, 0x92, 0xFC, 0x4C, 0x13, 0xED, 0x46, 0x06, 0xC5, 0x0C, 0x66, 0xC7, 0xB2, 0x22, 0xA4, 0xA0,
-    0x6A, 0x23, 0xA8, 0xE2, 0xBD, 0x18, 0x58, 0x0D, 0x6E, 0x69, 0xB1, 0xAA, 0xFC, 0x5E, 0xB6, 0x62,
-    0x20, 0x9A, 0x53, 0xDF, 0x03, 0xA1, 0x11, 0x02, 0xC9, 0x4A, 0x6E, 0x1C, 0x5B, 0x0D, 0x74, 0x2E,
-    0x45, 0x43, 0xD0, 0x56, 0x73, 0x05, 0x0C, 0xD2, 0x3F, 0xB3, 0xF5, 0xAF, 0xBC, 0x5F, 0xAD, 0x19,
-    0xF6, 0xC6, 0x28, 0xD3, 0xCD, 0xD1, 0x31, 0x0C, 0xDE, 0xB2, 0x54, 0x50, 0x73, 0x0C, 0xC4, 0x3A,
-    0xF2, 0xD6, 0xAD, 0xF8, 0xA9, 0x2F, 0x69, 0xD6, 0xEF, 0xF2, 0xB7, 0xDA, 0x68, 0xF4, 0xBC, 0xA6,
-    0x7F, 0x5C, 0x52, 0xD7, 0x73, 0x9A, 0x11, 0xD3, 0xDF, 0x85, 0x82, 0x9B, 0x5C, 0xAE, 0xC1, 0x40,
-    0x7E, 0xE3, 0xC3, 0xE0, 0x1B, 0x3F, 0x24, 0x41, 0x45, 0xD5, 0xE9, 0x38, 0xC3, 0x8C, 0xDC, 0xC2,
-    0xC1, 0xC1, 0xD3, 0xB2, 0xB0, 0x95, 0x1D, 0x58, 0x73, 0xE1, 0xBF, 0x0D, 0x7D, 0x6B, 0x9D, 0x72,
-    0x9E, 0xFB, 0x77, 0xB9, 0xF5, 0x37, 0xA7, 0xF3, 0xA4, 0x71, 0x29, 0x58, 0x7A, 0x42, 0xAE, 0x6D,
-    0x49, 0xC1, 0x3E, 0x33, 0xDF, 0xCB, 0xFA, 0xA1, 0xF4, 0x30, 0x99, 0x1B, 0xF1, 0x89, 0xEC, 0x3B,
-    0x3B, 0x20, 0xD2, 0xDF, 0x3D, 0xD9, 0x5C, 0x3D, 0x32, 0xF6, 0x35, 0x2E, 0x66, 0x09, 0xA3, 0xE3,
-    0x08, 0xF2, 0x3F, 0xDC, 0x7F, 0x7D, 0x3A, 0x1E, 0x38, 0x39, 0x70, 0xFC, 0xEB, 0xD3, 0x9C, 0x46,
-    0x46, 0xD5, 0xC7, 0xDE, 0xB8, 0xCD, 0x73, 0x38, 0x81, 0x39, 0x44, 0x4A, 0xCD, 0xF0, 0x05, 0xC9,
-    0x5C, 0x25, 0x64, 0xF5, 0xE2, 0x52, 0x34, 0x2A, 0x39, 0x19, 0x47, 0x65, 0xD3, 0x0A, 0x65, 0x19,
-    0x0D, 0xF6, 0xB1, 0x29, 0x64, 0xE2, 0xA3, 0x52, 0xF5, 0xB1, 0x7C, 0x1D, 0xAC, 0x91, 0x6C, 0x2E,
-    0xF2, 0xF4, 0x5C, 0xFC, 0x25, 0xED, 0x94, 0x4C, 0x4E, 0x5C, 0x93, 0x84, 0x05, 0xF8, 0xF4, 0x09,
-    0xF3, 0xFF, 0x5E, 0x43, 0x31, 0xEB, 0x69, 0x8D, 0xA3, 0x8C, 0x8A, 0x54, 0x06, 0x55, 0x9F, 0x71,
-    0x3D, 0xA4, 0xE7, 0x8C, 0x03, 0x22, 0x9A, 0xAA, 0x53, 0xDB, 0xF9, 0xE4, 0xF6, 0xE2, 0x3E, 0x4A,
-    0x54, 0x78, 0x27, 0x98, 0x16, 0x39, 0x9B, 0xF6, 0xE4, 0xE7, 0xE4, 0x50, 0xB4, 0xEE, 0x53, 0x99,
-    0x50, 0x22, 0xEB, 0x9C, 0xBB, 0x4F, 0x55, 0x1E, 0xBA, 0x13, 0xD0, 0x54, 0x05, 0xF2, 0x90, 0x12,
-    0x2A, 0xA7, 0x6B, 0x09, 0xE1, 0xD4, 0x25, 0x29, 0x3B, 0x05, 0xD5, 0xAB, 0x5A, 0xE7, 0x58, 0x0C,
-    0x1D, 0xFF, 0xDA, 0x50, 0x42, 0x1C, 0xF5, 0x62, 0xBC, 0x92, 0xEA, 0xA2, 0xBA, 0xA0, 0xC1, 0x16,
-    0xEE, 0x74, 0xCE, 0x95, 0x32, 0x03, 0x0F, 0x64, 0x21, 0xFC, 0xB2, 0x52, 0xC8, 0x39, 0x54, 0x93,
-    0x99, 0x97, 0xE3, 0xC4, 0x35, 0x32, 0xB9, 0x54, 0x68, 0xA8, 0x42, 0xAB, 0x50, 0x90, 0x5B, 0xD2,
-    0x58, 0xDC, 0x14, 0x1B, 0xC1, 0xB8, 0x97, 0xCB, 0x9A, 0x4B, 0x4C, 0x99, 0x35, 0x62, 0xE5, 0x41,
-    0x6D, 0x81, 0xBC, 0x4A, 0xC5, 0xE9, 0x20, 0x3E, 0x7B, 0x62, 0xAB, 0xFC, 0xD7, 0xC0, 0x21, 0x75,
-    0xEA, 0x2E, 0x45, 0x82, 0x99, 0x9C, 0x17, 0x66, 0x4E, 0xF6, 0xEE, 0x01, 0x67, 0xE8, 0x3F, 0x95,
-    0x2D, 0x7B, 0xC0, 0x99, 0x64, 0x50, 0xC3, 0xC5, 0x14, 0x3E, 0x5D, 0xB1, 0xEF, 0x4A, 0xF5, 0x92,
-    0x18, 0xC0, 0x69, 0x97, 0xD0, 0xE6, 0xEB, 0x40, 0x22, 0xD6, 0x4F, 0xC8, 0x77, 0xA3, 0x56, 0x22,
-    0xBE, 0x52, 0x52, 0xE0, 0xCE, 0x4C, 0xA7, 0xAA, 0x96, 0xF5, 0x72, 0xC7, 0xB3, 0x5C, 0xF6, 0x9A,
-    0xC0, 0x66, 0x3C, 0xCD, 0x6D, 0xA8, 0x2C, 0xC2, 0xD9, 0x0B, 0xCA, 0x73, 0xC8, 0xEF, 0x07, 0x5C,
-    0x30, 0xAE, 0x28, 0xD8, 0x74, 0x7D, 0x01, 0x74, 0xFB, 0xB1, 0xC3, 0x55, 0x19, 0xBA, 0xD0, 0xDC,
-    0x08, 0xC2, 0x66, 0x9B, 0xB9, 0xD1, 0x2E, 0xA2, 0x8C, 0x0A, 0xCA, 0x8D, 0xB5, 0xAA, 0xDE, 0x17,
-    0x9F, 0x3B, 0xC8, 0x56, 0x2D, 0xF2, 0xA8, 0xDD, 0xF8, 0x16, 0xEF, 0xAB, 0xF3, 0x5F, 0x24, 0x04,
-    0x7C, 0xE7, 0xC4, 0x1C, 0xB4, 0x80, 0x69, 0x77, 0xE6, 0xEB, 0x10, 0x9A, 0x7F, 0x9D, 0xF3, 0x75,
-    0x35, 0x8D, 0xB5, 0x8A, 0xC7, 0xDA, 0x66, 0x41, 0x9B, 0xDF, 0xB8, 0xB0, 0x4C, 0xB6, 0xAF, 0xDC,
-    0x43, 0xE2, 0xBC, 0xB4, 0xF7, 0x40, 0x21, 0x74, 0x01, 0x55, 0x19, 0x2B, 0x26, 0x8B, 0x00, 0xE7,
-    0xD5, 0x60, 0xB6, 0xD5, 0x87, 0xCC, 0xA5, 0xDE, 0x63, 0xC5, 0xE7, 0x03, 0x72, 0x81, 0xD7, 0x07,
-    0xA3, 0xFE, 0x02, 0x31, 0x06, 0x47, 0x51, 0x0A, 0xE0, 0x2E, 0x0C, 0x13, 0x38, 0x22, 0x11, 0x00,
-    0x59, 0x0D, 0x3D, 0x3D, 0x73, 0x8D, 0xDC, 0x85, 0xCC, 0x0C, 0x47, 0xC9, 0x41, 0x73, 0x7F, 0x15,
-    0xDC, 0x2B, 0x59, 0xBF, 0xBD, 0xD6, 0x21, 0xD7, 0x5E, 0x8B, 0x8E, 0x64, 0xC5, 0x4D, 0x4A, 0x99,
-    0x59, 0x99, 0x74, 0xF9, 0x08, 0xA3, 0x11, 0x46, 0xD4, 0x5A, 0x82, 0xD4, 0xA2, 0x4F, 0xB7, 0x20,
-    0x11, 0x6E, 0x9C, 0xA9, 0x23, 0x06, 0xC7, 0x50, 0xEB, 0x08, 0x34, 0x7F, 0x84, 0x50, 0xE8, 0x39,
-    0xCB, 0x39, 0xC9, 0x35, 0x5F, 0x5B, 0x72, 0x2A, 0x6E, 0x8F, 0xF9, 0x8E, 0xC3, 0x9D, 0x51, 0x1D,
-    0xA2, 0x91, 0xCF, 0x10, 0x93, 0x81, 0xD7, 0x01, 0x4D, 0x2D, 0xD2, 0x27, 0xAA, 0xF0, 0x39, 0xC2,
-    0xEB, 0x6E, 0x2B, 0xD2, 0xED, 0x17, 0xA9, 0x99, 0xDC, 0x69, 0x3D, 0x77, 0x5E, 0x8B, 0xAC, 0x4B,
-    0x2E, 0x41, 0x4D, 0x4D, 0x2C, 0x10, 0xEA, 0xD4, 0x9E, 0xFD, 0x39, 0x1C, 0xD3, 0x87, 0x00, 0xE5,
-    0x73, 0x0C, 0x77, 0x8F, 0x71, 0x01, 0xCD, 0x1C, 0xB6, 0x3F, 0x0C, 0x1C, 0x22, 0x38, 0x54, 0x0F,
-    0x04, 0xAC, 0x60, 0x8E, 0xE1, 0xA9, 0x9F, 0xC6, 0x35, 0xB5, 0xC0, 0x96, 0x75, 0xA1, 0xEE, 0xD6,
-    0x06, 0x05, 0xDF, 0xD1, 0x29, 0x5E, 0x40, 0x5F, 0x90, 0xBB, 0x92, 0xA7, 0x41, 0x50, 0xBE, 0x15,
-    0x8F, 0x13, 0x1D, 0x7F, 0xA9, 0xE0, 0x01, 0xB4, 0x73, 0x3F, 0x24, 0x9F, 0x35, 0x9D, 0xF3, 0xE1,
-    0xD9, 0x98, 0x42, 0x82, 0x20, 0x30, 0x45, 0x01, 0x39, 0x65, 0xE6, 0xDE, 0x7B, 0xBF, 0xD4, 0x7D,
-    0x26, 0xEB, 0x02, 0x31, 0x90, 0xD4, 0x2C, 0xAA, 0x8F, 0xA5, 0x3B, 0xCF, 0xD6, 0xB3, 0x3A, 0xD6,
-    0x9C, 0xB1, 0xF5, 0xBE, 0xAB, 0x97, 0x2F, 0xAF, 0xC5, 0x6D, 0x6C, 0xBA, 0x8C, 0xF3, 0x6E, 0xC5,
-    0x49, 0x9D, 0xF1, 0x27, 0xED, 0xB9, 0xFE, 0xC4, 0x73, 0x88, 0x3D, 0x68, 0x0C, 0x8E, 0x83, 0x48,
-    0x4F, 0x14, 0x1D, 0x7C, 0xA2, 0xE3, 0x14, 0x9D, 0x6F, 0x23, 0xFD, 0xC4, 0x3A, 0x21, 0xD0, 0x86,
-    0x77, 0xD6, 0xD4, 0xEF, 0x20, 0x77, 0x49, 0xC7, 0x96, 0xD7, 0x4D, 0xFA, 0x87, 0xF4, 0xC2, 0xDE,
-    0x79, 0x91, 0xD4, 0xB2, 0x41, 0xA0, 0xFA, 0xF0, 0x2F, 0x39, 0x1A, 0x28, 0x98, 0x43, 0xC6, 0xC3,
-    0xEE, 0x2F, 0x65, 0x30, 0x6C, 0xEC, 0x3E, 0xC1, 0xBE, 0xCA, 0x10, 0xC1, 0xCB, 0xD9, 0xAC, 0x7D,
-    0xF9, 0x2C, 0xB3, 0x5A, 0x3B, 0x4B, 0x41, 0x1D, 0xF1, 0xB5, 0x6E, 0xB6, 0xA2, 0xA9, 0xB7, 0xD3,
-    0xC1, 0x07, 0x30, 0xAB, 0xFD, 0x52, 0x69, 0xB8, 0xF2, 0xF8, 0x3E, 0x1B, 0x24, 0x92, 0xA1, 0x92,
-    0x34, 0xED, 0x79, 0x19, 0xFA, 0x73, 0xCC, 0x4F, 0x46, 0x26, 0x41, 0x3E, 0x9D, 0x17, 0x93, 0x3D,
-    0x6C, 0xEC, 0x46, 0x19, 0xD3, 0xFE, 0xF4, 0xF7, 0x1E, 0x5A, 0x8B, 0x77, 0x80, 0x48, 0x1F, 0x4E,
-    0x91, 0x6C, 0xB6, 0x67, 0x90, 0x6E, 0x14, 0x75, 0xD6, 0xED, 0xE6, 0x0F, 0xA9, 0xC5, 0xDF, 0x4E,
-    0x53, 0xF7, 0x7D, 0xFB, 0xAC, 0x24, 0x33, 0x91, 0xDC, 0x20, 0x96, 0x17, 0xBA, 0x51, 0xBC, 0xA3,
-    0x87, 0xD2, 0xD4, 0x60, 0x76, 0x33, 0xC5, 0x0D, 0x39, 0x93, 0x71, 0xF3, 0xC3, 0x5F, 0xC3, 0x04,
-    0xA0, 0xF4, 0xC4, 0x42, 0x18, 0xBB, 0x64, 0x42, 0x56, 0x7E, 0x91, 0x2C, 0x8C, 0xDA, 0xC1, 0xB2,
-    0xCB, 0xD6, 0x86, 0x7A, 0x7D, 0x39, 0x18, 0x62, 0x12, 0xC4, 0x6C, 0x46, 0xC1, 0x4A, 0x79, 0x57,
-    0x70, 0x02, 0xFF, 0x0D, 0x50, 0xC2, 0xB4, 0x73, 0xA1, 0x8A, 0x88, 0x20, 0x93, 0xA9, 0x6E, 0x23,
-    0xA5, 0xB7, 0x93, 0x67, 0xC5, 0x40, 0x4A, 0xE0, 0x9F, 0xA3, 0x51, 0x44, 0x8C, 0xCA, 0x04, 0x93,
-    0x76, 0xF6, 0x3A, 0x32, 0x85, 0xD7, 0x36, 0x83, 0x95, 0x7A, 0xE5, 0x4F, 0x95, 0xBD, 0x30, 0xA7,
-    0x5D, 0xB8, 0x92, 0x54, 0x99, 0x24, 0xF4, 0x12, 0x1E, 0x41, 0x8F, 0x72, 0xF6, 0xCE, 0x0C, 0x2C,
-    0xC1, 0x21, 0x36, 0x2A, 0xE1, 0xA9, 0x12, 0x64, 0x36, 0x12, 0x1B, 0x99, 0xE8, 0xC4, 0x62, 0x2C,
-    0xFB, 0x42, 0x2F, 0x48, 0xC4, 0xBD, 0xC4, 0x46, 0x72, 0xA5, 0x80, 0x2A, 0x57, 0x76, 0xE2, 0x99,
-    0x44, 0xD5, 0xC4, 0x1A, 0x82, 0xEC, 0x48, 0x3B, 0x5B, 0x06, 0x13, 0x1B, 0x75, 0x8A, 0x5A, 0x0C,
-    0x28, 0x04, 0xB6, 0xB7, 0x3A, 0xD6, 0x62, 0xB5, 0xBE, 0x87, 0x54, 0x3D, 0x47, 0xBE, 0x9F, 0xA0,
-    0x3A, 0x53, 0x23, 0x68, 0xB5, 0xAC, 0x90, 0xC6, 0x72, 0xE5, 0xEC, 0xFA, 0x80, 0x74, 0x3A, 0xB0,
-    0x5D, 0xF1, 0x92, 0x6E, 0x84, 0xE3, 0xCA, 0xEB, 0xE0, 0xDF, 0x13, 0x22, 0x70, 0x24, 0x57, 0x8C,
-    0x95, 0x64, 0xA5, 0xF7, 0xE5, 0xDE, 0x85, 0x3D, 0x9C, 0x7C, 0xDB, 0xA6, 0xBD, 0xB8, 0x14, 0xD0,
-    0x6A, 0x3E, 0xB2, 0xDC, 0xD8, 0x75, 0x21, 0x3D, 0x28, 0xBD, 0x35, 0x67, 0xD3, 0xDB, 0x8B, 0x8D,
-    0xCB, 0xE6, 0x3F, 0x5D, 0x65, 0x12, 0x53, 0xC6, 0x9F, 0xCD, 0x8A, 0xD0, 0x42, 0xC4, 0x66, 0xD6,
-    0x14, 0xBD, 0x79, 0x49, 0xCC, 0x20, 0x48, 0x80, 0x2F, 0xC4, 0x91, 0x66, 0x77, 0x11, 0x5F, 0x4F,
-    0x95, 0xA0, 0x54, 0x56, 0x4D, 0x8A, 0x50, 0xD7, 0x36, 0xA0, 0x4A, 0xC0, 0x84, 0xB0, 0x45, 0xA9,
-    0x09, 0xD6, 0x4C, 0x48, 0x93, 0xB5, 0x20, 0x4E, 0x72, 0x71, 0xD6, 0xA8, 0x29, 0x2F, 0xC4, 0x89,
-    0x82, 0xBA, 0x99, 0x2E, 0x36, 0x2E, 0xDB, 0xA5, 0xDB, 0x45, 0x3D, 0x85, 0x85, 0x1D, 0x47, 0xA7,
-    0xF9, 0x57, 0x51, 0x93, 0x14, 0xD9, 0xF0, 0x35, 0xCF, 0x52, 0xE0, 0x48, 0xC3, 0x66, 0x92, 0xF0,
-    0x72, 0x69, 0xF3, 0x07, 0xA4, 0x9C, 0xFE, 0x35, 0xF3, 0x8A, 0x6B, 0x75, 0x88, 0x3B, 0x7A, 0x76,
-    0xDA, 0x4F, 0x1C, 0x36, 0x1A, 0x1D, 0xD0, 0x22, 0x06, 0x05, 0x35, 0xD9, 0xFB, 0x10, 0xFC, 0x3E,
-    0x09, 0xBE, 0xAF, 0x50, 0x48, 0x17, 0x15, 0x95, 0x60, 0x05, 0xE1, 0x7D, 0xAF, 0x1D, 0x02, 0x0C,
-    0xE2, 0xA1, 0x81, 0xB9, 0x46, 0xF4, 0xD3, 0xD9, 0x3F, 0x34, 0x56, 0xDB, 0xFA, 0xC3, 0x95, 0xC8,
-    0x92, 0x8D, 0xF8, 0xB9, 0x59, 0x45, 0x6A, 0x22, 0xCC, 0x0F, 0xF3, 0xE4, 0x93, 0x39, 0xB1, 0xCF,
-    0x8E, 0xC9, 0x6F, 0xEC, 0xF8, 0xF8, 0x33, 0x33, 0x2B, 0x53, 0xF6, 0x2D, 0xA4, 0x42, 0xB5, 0x44,
-    0x2F, 0x05, 0x12, 0x33, 0x04, 0x63, 0x2D, 0x02, 0x96, 0xC9, 0x70, 0xB9, 0x0D, 0xB7, 0x00, 0x19,
-    0x31, 0x15, 0x80, 0x2B, 0x1E, 0x10, 0x5E, 0x92, 0x62, 0x94, 0xC0, 0x80, 0x2D, 0x33, 0xDC, 0x37,
-    0xDC, 0x9E, 0x59, 0xBD, 0x5A, 0x28, 0x73, 0x6A, 0xA1, 0x16, 0x2C, 0x8B, 0x8A, 0xB5, 0xFC, 0x13,
-    0xF6, 0x6A, 0x08, 0xFE, 0x5C, 0x28, 0x89, 0x9A, 0x64, 0xA1, 0x24, 0x9E, 0x93, 0x21, 0xBB, 0xAC,
-    0xC5, 0x42, 0xF9, 0x16, 0x57, 0xB6, 0x58, 0x44, 0x89, 0xDB, 0xEC, 0x07, 0x58, 0x28, 0xF4, 0xFF,
-    0x45, 0xA0, 0x42, 0xD0, 0x4F, 0x07, 0x7E, 0x40, 0x94, 0x2C, 0x41, 0xF4, 0x97, 0x1B, 0xBD, 0x79,
-    0xA4, 0x0B, 0x95, 0x71, 0xA1, 0x02, 0x5E, 0xA9, 0xB0, 0xC8, 0xD2, 0x98, 0xB5, 0x21, 0x4C, 0x26,
-    0xCD, 0xDD, 0xEA, 0xD3, 0xB9, 0xDB, 0x92, 0x2C, 0x3C, 0xBA, 0x7D, 0x82, 0x31, 0xE9, 0x2B, 0xE1,
-    0x6D, 0x7C, 0x46, 0x95, 0x88, 0xC8, 0x21, 0x04, 0x77, 0x40, 0xC5, 0x68, 0x0C, 0x34, 0x93, 0x6B,
-    0xA6, 0xD5, 0x80, 0x33, 0xB4, 0x76, 0xBB, 0x0B, 0xCB, 0x63, 0x72, 0x83, 0x8A, 0xBF, 0x23, 0xB7,
-    0xD9, 0xE2, 0x18, 0xDB, 0xA6, 0x98, 0xD0, 0xF0, 0x92, 0xB1, 0x90, 0x50, 0x74, 0x29, 0x39, 0x11,
-    0xF6, 0x61, 0x3C, 0x8B, 0xAF, 0x4E, 0xDA, 0x07, 0x85, 0x51, 0xEC, 0x4D, 0x46, 0x56, 0xF4, 0x80,
-    0x23, 0x64, 0xAB, 0x5A, 0x8A, 0xF3, 0xAC, 0x7C, 0x9C, 0x8E, 0xD8, 0x76, 0xA2, 0x9F, 0x60, 0x66,
-    0x24, 0xE2, 0x06, 0x3B, 0x5F, 0x2D, 0xE5, 0xC6, 0xC1, 0xF5, 0x1B, 0x09, 0x74, 0xEB, 0x4E, 0x14,
-    0x4A, 0xEC, 0xA8, 0x76, 0xBC, 0x71, 0x41, 0xE5, 0xEE, 0x91, 0xE6, 0x38, 0x91, 0x6B, 0x1C, 0x31,
-    0xC5, 0x5C, 0xF5, 0x68, 0x8D, 0x79, 0x17, 0x16, 0x19, 0x2D, 0x3D, 0x37, 0x11, 0x29, 0x83, 0x5A,
-    0x7E, 0x0F, 0x8A, 0x54, 0x89, 0x1A, 0xBC, 0x86, 0xFD, 0x50, 0xB4, 0xA1, 0x45, 0x97, 0x47, 0x8B,
-    0x26, 0x8F, 0xA5, 0x88, 0x5F, 0x73, 0xB5, 0x9D, 0x31, 0x01, 0x79, 0x85, 0x18, 0x1A, 0xCC, 0x8B,
-    0xBD, 0xDE, 0x2F, 0xA9, 0x9F, 0xAE, 0xA4, 0xFF, 0xEF, 0xF9, 0xE9, 0xCE, 0x2C, 0x76, 0x4D, 0x6A,
-    0x16, 0xE1, 0x2A, 0x02, 0xA2, 0x45, 0x92, 0x41, 0x34, 0x21, 0xA8, 0x6B, 0x94, 0x0F, 0xD0, 0x8A,
-    0x29, 0xFE, 0x7C, 0xA4, 0x26, 0xF7, 0x24, 0x06, 0x3F, 0x24, 0x24, 0xCF, 0x31, 0x69, 0xD2, 0xF6,
-    0x31, 0x06, 0x15, 0x22, 0xB4, 0x89, 0x66, 0x32, 0x83, 0xBD, 0x7C, 0x2C, 0x97, 0xC9, 0x84, 0xE3,
-    0x99, 0xD5, 0x07, 0x49, 0x42, 0x1A, 0xB0, 0xA0, 0x44, 0x2A, 0x5E, 0x5A, 0x8C, 0xFA, 0x25, 0x1F,
-    0xD5, 0xF6, 0x94, 0xBD, 0x7C, 0xB7, 0xF4, 0x46, 0x23, 0xF0, 0x9E, 0x54, 0xDA, 0xFC, 0x40, 0xDE,
-    0x7B, 0xD5, 0x99, 0xF1, 0x08, 0x71, 0x33, 0x4F, 0x5E, 0x3D, 0x46, 0x99, 0xBB, 0x27, 0x73, 0xD7,
-    0x17, 0x3C, 0xC2, 0x5B, 0x44, 0x1D, 0x7C, 0x6A, 0xD8, 0x26, 0xA7, 0xA0, 0xD3, 0x8B, 0x55, 0xD7,
-    0x14, 0x3C, 0x55, 0x36, 0x45, 0x4F, 0xB5, 0xCD, 0x10, 0x3E, 0xA3, 0xEA, 0xA6, 0xF8, 0x91, 0x46,
-    0x9D, 0x3C, 0x02, 0x98, 0x53, 0xE1, 0x6A, 0x45, 0x50, 0x35, 0x2E, 0x20, 0x84, 0xCA, 0xB7, 0xE6,
-    0x8A, 0xA1, 0xEA, 0x9C, 0x82, 0xE8, 0x94, 0x2E, 0x5A, 0xE9, 0xDB, 0x60, 0x1C, 0x8C, 0x4E, 0xED,
-    0x96, 0x36, 0x1F, 0x99, 0x0D, 0x0A, 0xB7, 0xD8, 0xE5, 0xF6, 0xD5, 0x09, 0x85, 0x19, 0x51, 0xCD,
-    0xB0, 0x4F, 0x65, 0x42, 0x43, 0xB0, 0xCA, 0xEA, 0x81, 0xA7, 0x26, 0xDB, 0x91, 0x76, 0x34, 0x43,
-    0x7E, 0x60, 0xAA, 0x7D, 0x5A, 0x9E, 0x12, 0x26, 0xBD, 0xEB, 0x3D, 0x72, 0x5D, 0x53, 0x6A, 0xDA,
-    0x00, 0x6D, 0x49, 0x1B, 0x6D, 0x00, 0x2E, 0x7B, 0x8F, 0x5A, 0xED, 0x3D, 0x22, 0xBE, 0x0A, 0xB0,
-    0x03, 0x69, 0x67, 0x0B, 0x3B, 0x04, 0x7B, 0xAE, 0x2B, 0x60, 0xA9, 0x92, 0xC8, 0x3C, 0xF8, 0x3F,
-    0x9B, 0x8B, 0x2F, 0xAB, 0xBE, 0x3C, 0xD8, 0x0F, 0xD5, 0x9D, 0x20, 0xF3, 0x76, 0x3D, 0x1A, 0x1A,
-    0x01, 0xE7, 0x4B, 0x00, 0x1C, 0x4F, 0x07, 0x57, 0x42, 0xAD, 0x21, 0xA0, 0xCF, 0x3D, 0x45, 0xAB,
-    0x96, 0x6B, 0x18, 0x40, 0x31, 0xE0, 0xE4, 0xF8, 0xAA, 0xCB, 0x53, 0x5C, 0xA2, 0xB2, 0xD0, 0x5A,
-    0x9A, 0x16, 0x43, 0x3C, 0xC7, 0x42, 0x8C, 0x6C, 0x25, 0x61, 0xF9, 0x41, 0x19, 0x57, 0xEA, 0x26,
-    0xEA, 0x10, 0x80, 0xB5, 0xD0, 0x35, 0x5D, 0x92, 0x62, 0xEF, 0x25, 0x36, 0x9A, 0xC8, 0xAC, 0x52,
-    0x78, 0x42, 0x7B, 0x4F, 0x24, 0xD7, 0x09, 0x48, 0x30, 0xFE, 0xA6, 0x04, 0xA3, 0x53, 0x2C, 0x31,
-    0x96, 0x58, 0x6F, 0x14, 0xB1, 0xDA, 0x70, 0x62, 0x89, 0x88, 0x76, 0xC4, 0xDE, 0xB1, 0x43, 0xC1,
-    0x22, 0x51, 0xAB, 0xFF, 0x13, 0xA9, 0x5D, 0x33, 0x86, 0x63, 0x8E, 0xD9, 0xBC, 0x5C, 0x74, 0x20,
-    0x9D, 0xD0, 0x3F, 0x6F, 0xBF, 0x64, 0x5F, 0x86, 0xD5, 0xA6, 0x94, 0x43, 0x8B, 0xE5, 0x18, 0xB4,
-    0x8F, 0x69, 0x11, 0x67, 0xF7, 0x78, 0xE9, 0x84, 0x60, 0x12, 0xE1, 0xDA, 0x9B, 0xCD, 0xA9, 0x1C,
-    0xDA, 0x75, 0xC3, 0x85, 0x98, 0x8F, 0xBF, 0xB4, 0x8F, 0x22, 0x2C, 0x3E, 0x9C, 0xC9, 0x73, 0x94,
-    0x60, 0xC8, 0x3A, 0x56, 0x32, 0xC0, 0xAA, 0xCD, 0x8E, 0x30, 0x18, 0x43, 0x7A, 0x7D, 0x2D, 0x66,
-    0xD5, 0x66, 0x69, 0xAB, 0x04, 0x2B, 0x92, 0x22, 0x29, 0x0C, 0x49, 0x20, 0x92, 0x25, 0x4C, 0x07,
-    0xCD, 0xED, 0x71, 0x03, 0x10, 0x76, 0xE9, 0xA8, 0xBC, 0x24, 0xBB, 0xD7, 0x50, 0xC4, 0xCA, 0xB5,
-    0x85, 0x75, 0x79, 0x21, 0xF7, 0x2C, 0x16, 0x95, 0xF0, 0xAE, 0x9A, 0xEA, 0x39, 0xD1, 0xB2, 0xDF,
-    0x5A, 0x04, 0x01, 0x12, 0xB8, 0x60, 0x6B, 0xDF, 0xBB, 0x64, 0xD8, 0x97, 0x35, 0xB8, 0xF4, 0xE0,
-    0xA1, 0x29, 0x00, 0x37, 0xD9, 0xC4, 0x15, 0x96, 0x7A, 0x6D, 0x1F, 0xE7, 0x5C, 0x59, 0x72, 0xA4,
-    0xAE, 0x56, 0x20, 0x20, 0x38, 0x55, 0xEC, 0x4A, 0x34, 0xF7, 0xD1, 0x26, 0xB0, 0x2B, 0x1E, 0xFA,
-    0x38, 0x69, 0x7F, 0x5E, 0x28, 0xCB, 0xA9, 0x13, 0x8D, 0x27, 0xEA, 0x3F, 0x7B, 0xF8, 0xE5, 0xEB,
-    0x9C, 0x27, 0x83, 0x14, 0xE6, 0x24, 0x38, 0x6C, 0x76, 0xBC, 0x46, 0xAB, 0x72, 0x33, 0x23, 0x39,
-    0x86, 0x9C, 0x9C, 0xAE, 0xDB, 0x9B, 0xBB, 0x25, 0x67, 0x1C, 0x7F, 0x05, 0x7C, 0x2A, 0xB6, 0x2C,
-    0xE5, 0x9C, 0x72, 0x36, 0xB9, 0xD6, 0x94, 0xF3, 0x53, 0xCC, 0xF8, 0x1B, 0x52, 0xCC, 0xE5, 0x1F,
-    0x12, 0x3D, 0x8E, 0x4F, 0xD2, 0xAD, 0x71, 0x71, 0xA6, 0xD3, 0xDE, 0x97, 0xE1, 0x1B, 0x42, 0x3C,
-    0x0E, 0x60, 0xB2, 0x8F, 0xBF, 0xB9, 0x67, 0x77, 0x69, 0xA0, 0x9C, 0x8C, 0xC2, 0xA8, 0xFD, 0x84,
-    0xC4, 0x51, 0x46, 0xAE, 0x5A, 0x05, 0x52, 0xF0, 0xD1, 0x46, 0xCA, 0x59, 0x79, 0x1D, 0x42, 0xC9,
-    0x5E, 0x52, 0xD7, 0xB7, 0xBA, 0xD1, 0xEC, 0x58, 0xB4, 0x32, 0x19, 0xA2, 0x29, 0x5F, 0x64, 0xB1,
-    0xCE, 0x67, 0x51, 0x3F, 0x19, 0x55, 0x6F, 0x7C, 0x38, 0x07, 0x4D, 0xF2, 0xA8, 0x3D, 0xA5, 0xB9,
-    0x2C, 0xF6, 0x29, 0x18, 0x03, 0x39, 0xFF, 0x39, 0xE2, 0x26, 0xDA, 0x44, 0xF4, 0x84, 0xAE, 0x32,
-    0xB5, 0x47, 0x03, 0xE4, 0xE5, 0xAB, 0x8E, 0x7A, 0xA5, 0x3E, 0xE1, 0xCD, 0x2A, 0x68, 0xDF, 0xA8,
-    0xD8, 0x6B, 0x67, 0x29, 0xB4, 0x65, 0xA6, 0xF1, 0x11, 0x4D, 0x7F, 0xAA, 0x64, 0x76, 0x99, 0x0E,
-    0x2E, 0x60, 0xF1, 0x94, 0xFD, 0x6C, 0x1C, 0xC4, 0x8C, 0x66, 0x62, 0x35, 0xB6, 0xAD, 0x6B, 0xE5,
-    0x62, 0x51, 0x9F, 0x19, 0x9C, 0x63, 0x57, 0xFF, 0x18, 0x20, 0x14, 0xAC, 0x96, 0x5B, 0xEE, 0xBF,
-    0x41, 0x92, 0x65, 0xD4, 0xE7, 0xD7, 0x3B, 0x3E, 0x60, 0x80, 0xB2, 0x90, 0x66, 0x1B, 0x9B, 0x1D,
-    0xDD, 0xCB, 0x05, 0x6B, 0x6D, 0x7C, 0x6A, 0x22, 0x4F, 0xC7, 0xB0, 0xD6, 0x32, 0x1B, 0xF2, 0x72,
-    0x64, 0x6E, 0xB6, 0xD5, 0x07, 0x68, 0x94, 0x5F, 0x5D, 0x40, 0xAA, 0xDA, 0xC7, 0x64, 0xF8, 0xE8,
-    0xB3, 0x0A, 0xAD, 0xE1, 0xB3, 0x00, 0x3D, 0x9B, 0xA7, 0xB0, 0xF0, 0x6A, 0xB5, 0xD9, 0x0B, 0x64,
-    0x79, 0xF5, 0xA0, 0xAC, 0x77, 0x0C, 0x72, 0xB8, 0x32, 0x71, 0xF3, 0xBD, 0xE3, 0xE1, 0x1D, 0x83,
-    0x0D, 0x63, 0xF7, 0x16, 0x3B, 0xAB, 0x3C, 0xEB, 0x4F, 0x66, 0x46, 0xE9, 0xE7, 0xD1, 0xE1, 0xC1,
-    0x3B, 0x03, 0x8A, 0x8A, 0x91, 0xA5, 0x65, 0x47, 0x85, 0xCC, 0xBB, 0xFC, 0x5B, 0x25, 0xE1, 0xAB,
-    0xD6, 0x8D, 0x10, 0x6A, 0x7B, 0x72, 0x0E, 0x60, 0x4A, 0x25, 0x45, 0xF4, 0x90, 0x6A, 0x6D, 0x61,
-    0x89, 0xB8, 0x49, 0x28, 0x3B, 0x6A, 0xFC, 0xEF, 0xC5, 0x76, 0xD2, 0x47, 0x84, 0xFA, 0x0C, 0x90,
-    0x08, 0xC8, 0xAE, 0x1A, 0xB2, 0x13, 0xE8, 0xB5, 0x57, 0x34, 0xE3, 0xC5, 0xAE, 0xFC, 0x03, 0x0B,
-    0x16, 0xFD, 0xA2, 0xBC, 0x78, 0x08, 0x42, 0x66, 0x8C, 0x66, 0xB6, 0x80, 0x6D, 0x8E, 0x5E, 0xC7,
-    0x9A, 0x15, 0x08, 0x42, 0x6E, 0x1F, 0x85, 0x8A, 0x8F, 0x9B, 0x85, 0x24, 0xCA, 0xD9, 0xEB, 0xBF,
-    0x2F, 0xC3, 0xDF, 0x78, 0x53, 0x42, 0x76, 0xB1, 0x07, 0x98, 0xED, 0x21, 0xEE, 0x88, 0x86, 0xE5,
-    0x79, 0x69, 0xB4, 0xD4, 0x57, 0xC2, 0x90, 0x49, 0xB2, 0x3A, 0x48, 0xB4, 0x7B, 0xD5, 0xBC, 0x6D,
-    0x02, 0x24, 0x91, 0x3E, 0xBB, 0xBD, 0x5D, 0x85, 0x61, 0xD5, 0x8D, 0xBF, 0xA5, 0x1A, 0x91, 0x36,
-    0xF6, 0xCA, 0x70, 0x15, 0x9D, 0x89, 0xE8, 0x86, 0x73, 0xBB, 0xEB, 0x67, 0x73, 0xC8, 0xF4, 0x11,
-    0x0B, 0xAD, 0x4C, 0xD6, 0x4E, 0x3B, 0xD8, 0xB1, 0x67, 0x58, 0x58, 0x4A, 0x56, 0x0D, 0x94, 0x0B,
-    0xE1, 0x07, 0xC0, 0xA8, 0x1F, 0x38, 0x74, 0xDA, 0x32, 0xAF, 0x88, 0x51, 0x41, 0xDE, 0x36, 0x4F,
-    0x96, 0x11, 0x0C, 0x5E, 0x76, 0x93, 0xB1, 0x42, 0xC9, 0x35, 0x47, 0x70, 0xE6, 0xC2, 0xA4, 0x7D,
-    0x55, 0x91, 0x44, 0x55, 0x17, 0x26, 0x3D, 0x71, 0x05, 0xDC, 0x56, 0x31, 0x13, 0x41, 0x4A, 0x05,
-    0x8D, 0x21, 0x34, 0x51, 0x8B, 0xB5, 0xF7, 0x7F, 0x07, 0xDF, 0x04, 0x6E, 0x91, 0x6A, 0xC1, 0x2C,
-    0x7A, 0x81, 0xE5, 0xBE, 0xA2, 0xE4, 0xA3, 0xED, 0x90, 0x1B, 0xDC, 0x94, 0xD7, 0x8C, 0xA8, 0xA2,
-    0x7F, 0xFC, 0x85, 0x59, 0x39, 0xD6, 0x6F, 0x2E, 0x8B, 0x14, 0x9D, 0x43, 0x64, 0x55, 0x16, 0xD9,
-    0xC8, 0x8E, 0x06, 0x47, 0xFA, 0x6C, 0x7C, 0x7D, 0x29, 0xC1, 0xF8, 0x80, 0x2E, 0x69, 0x5D, 0xD5,
-    0x47, 0xBD, 0x0E, 0xB5, 0x63, 0x91, 0x3A, 0x59, 0x59, 0x78, 0x18, 0xF5, 0x9A, 0x2C, 0x77, 0xC5,
-    0x3A, 0xB3, 0x2C, 0xCC, 0x7B, 0x32, 0x85, 0x3F, 0xB5, 0xC7, 0xB9, 0x24, 0x88, 0xE0, 0x40, 0xB7,
-    0xCA, 0xCA, 0x88, 0x2B, 0xD2, 0x55, 0x59, 0x39, 0xB0, 0x77, 0x91, 0x6A, 0xFA, 0x8C, 0xA1, 0x5B,
-    0x74, 0xAA, 0x42, 0x2F, 0x21, 0xB5, 0xA5, 0xA5, 0x2C, 0x2C, 0x87, 0xCB, 0xD0, 0x8D, 0x75, 0x19,
-    0x5A, 0x62, 0x99, 0x88, 0x26, 0xEC, 0x73, 0x73, 0x0F, 0x3C, 0x44, 0x9B, 0x69, 0xDB, 0x77, 0x0F,
-    0x15, 0xB4, 0x23, 0xDF, 0xF0, 0x93, 0x78, 0xA0, 0xF2, 0xE3, 0x41, 0x92, 0xDB, 0x42, 0x71, 0xC3,
-    0x89, 0x48, 0x35, 0x82, 0xCA, 0x55, 0xFA, 0xD5, 0xC9, 0x35, 0xAD, 0xDF, 0xD0, 0xBF, 0x4E, 0x8B,
-    0x1F, 0x19, 0x9D, 0x1F, 0x49, 0x7A, 0x47, 0xEF, 0xAC, 0x49, 0xE2, 0xB9, 0x23, 0xFD, 0x29, 0x9B,
-    0xBD, 0x73, 0x1A, 0xFD, 0xD8, 0xB7, 0x9F, 0xAB, 0xAF, 0xD9, 0x2B, 0xFB, 0x1C, 0xAC, 0x46, 0x8D,
-    0xDE, 0x0B, 0xF3, 0x95, 0x6F, 0x39, 0x57, 0x43, 0x53, 0x5D, 0x69, 0xB3, 0x56, 0xCA, 0xEC, 0xA9,
-    0xD6, 0x76, 0xE0, 0x61, 0xCF, 0xDE, 0x39, 0xC2, 0xBC, 0x64, 0x02, 0x3B, 0xD5, 0xEF, 0x72, 0x3E,
-    0xF5, 0x80, 0x28, 0x13, 0xAE, 0x3C, 0x27, 0x0E, 0xAE, 0x11, 0x04, 0xAB, 0x1E, 0x93, 0x4F, 0xEF,
-    0x68, 0xBF, 0xDC, 0x83, 0x16, 0x3B, 0xA0, 0xCC, 0x7D, 0x7C, 0x65, 0x9E, 0x8D, 0x86, 0x87, 0xC1,
-    0x27, 0xE2, 0x89, 0xCD, 0xCF, 0xCC, 0xBF, 0x6D, 0xE7, 0xE5, 0xE2, 0xAA, 0xEB, 0xB4, 0x77, 0xE5,
-    0x35, 0xC9, 0x79, 0x50, 0x6A, 0xD0, 0xD6, 0x28, 0x16, 0xAF, 0xB5, 0xC8, 0xC0, 0xEE, 0x20, 0xB6,
-    0xF8, 0x78, 0xEC, 0xF0, 0x49, 0xB5, 0x79, 0x6D, 0xFB, 0x82, 0x92, 0x6D, 0x41, 0x91, 0x06, 0x22,
-    0x92, 0x68, 0xE1, 0x5A, 0xF9, 0xAB, 0xD2, 0x12, 0x75, 0x5E, 0x0C, 0xDA, 0x16, 0xE8, 0x93, 0x14,
-    0x8F, 0x18, 0xC5, 0xB3, 0xAD, 0x79, 0xDD, 0xE2, 0xB6, 0x6F, 0xA2, 0x21, 0x6C, 0x64, 0x55, 0xD8,
-    0xB5, 0x3B, 0x18, 0xB4, 0xC4, 0x98, 0xC1, 0xDB, 0x88, 0x80, 0xB6, 0x5B, 0x9D, 0xFC, 0x0D, 0xE2,
-    0xE2, 0x1C, 0xD6, 0x14, 0x1C, 0xBA, 0x48, 0x14, 0xA3, 0x6F, 0x2D, 0x6B, 0x63, 0x4C, 0xA3, 0x1A,
-    0xF0, 0x94, 0x4A, 0x13, 0xE3, 0xE9, 0xC7, 0xC4, 0x7E, 0x2A, 0x21, 0xCC, 0x24, 0x36, 0x7B, 0x67,
-    0xE3, 0x11, 0x8C, 0xD8, 0xE5, 0x8D, 0xF4, 0x81, 0xF3, 0x05, 0xC5, 0x8A, 0x0F, 0x09, 0x27, 0x10,
-    0xAF, 0xD2, 0xE4, 0x61, 0xA3, 0x5B, 0x6E, 0x9B, 0xC3, 0x49, 0x37, 0x9A, 0xC4, 0xD2, 0x9E, 0x9C,
-    0xDD, 0x82, 0x1C, 0x08, 0xE4, 0xAA, 0x65, 0x52, 0x81, 0x96, 0x3E, 0x51, 0x37, 0x3C, 0x55, 0x13,
-    0xD9, 0x52, 0x92, 0x9C, 0x49, 0x10, 0xB8, 0x85, 0x87, 0x84, 0x41, 0x91, 0x35, 0x56, 0x1B, 0x37,
-    0xF1, 0x8C, 0xC6, 0x5F, 0xBB, 0x67, 0x84, 0x3D, 0xFB, 0xCE, 0xB0, 0x80, 0x45, 0x97, 0x70, 0xEA,
-    0x11, 0xE1, 0x0B, 0x04, 0x96, 0x3E, 0x22, 0x9C, 0x8B, 0x41, 0xC4, 0x83, 0x25, 0x24, 0xA8, 0x7C,
-    0x76, 0x27, 0xDD, 0x28, 0xBF, 0x23, 0xC5, 0x62, 0xC3, 0xBE, 0xFA, 0xD0, 0xEC, 0x3A, 0x6C, 0x49,
-    0xFB, 0x33, 0x79, 0xFB, 0x93, 0x10, 0x6F, 0x4F, 0xC6, 0x25, 0x1A, 0xD1, 0x87, 0x0B, 0x2E, 0xE4,
-    0xD6, 0x4C, 0x48, 0x93, 0x23, 0xDF, 0xBF, 0x25, 0xEF, 0xFE, 0x23, 0x2E, 0x8D, 0xDF, 0xFD, 0x44,
-    0x4C, 0xCC, 0x7D, 0xFA, 0x0C, 0xC4, 0x54, 0xB7, 0xCD, 0x77, 0xA3, 0x81, 0xDE, 0x31, 0x6A, 0xC2,
-    0x4A, 0xA0, 0xC4, 0x7C, 0xF4, 0x2D, 0x6D, 0x98, 0x9F, 0x3F, 0x03, 0x1C, 0x37, 0x28, 0x94, 0x0D,
-    0x0C, 0x15, 0x8D, 0xC0, 0x1D, 0xF1, 0xE1, 0x46, 0xEF, 0xA7, 0x2B, 0xA3, 0x02, 0xC1, 0xA5, 0xF7,
-    0x53, 0x49, 0x8D, 0x74, 0xBB, 0xF7, 0xD3, 0xB5, 0x99, 0x0E, 0xAE, 0xF9, 0xB1, 0x5A, 0x9A, 0x4D,
-    0x0B, 0x1E, 0xE5, 0x4F, 0x82, 0x69, 0xD0, 0x44, 0x5B, 0xBA, 0xFE, 0xE7, 0x94, 0x69, 0x9A, 0xC2,
-    0xE9, 0x69, 0xEB, 0x8D, 0xC3, 0x73, 0xEF, 0xDA, 0x2B, 0x47, 0x22, 0x01, 0x7B, 0xFB, 0xFE, 0x0B,
-    0xEE, 0xB9, 0x2B, 0x4A, 0xC9, 0x08, 0xE1, 0x0E, 0xFE, 0xD1, 0xDF, 0x2A, 0x97, 0x50, 0x2F, 0x95,
-    0x3C, 0x57, 0x4E, 0x96, 0xB4, 0x44, 0xB4, 0xF1, 0xA0, 0x1C, 0x00, 0xD5, 0x0A, 0x10, 0xB5, 0x13,
-    0x28, 0x0F, 0x4A, 0x15, 0x04, 0x33, 0x5B, 0x23, 0xA0, 0xA0, 0xC0, 0x9B, 0x2C, 0x10, 0x53, 0xE8,
-    0xA2, 0x56, 0x1D, 0x15, 0x69, 0xE1, 0x56, 0xF7, 0x2F, 0x8C, 0xBA, 0xB1, 0xA3, 0x59, 0x9F, 0xBE,
-    0x28, 0xE8, 0x1F, 0xB9, 0x9C, 0xD6, 0xAC, 0xB6, 0x08, 0x6B, 0x49, 0xEB, 0x0E, 0x35, 0xE7, 0x45,
-    0xB7, 0x0A, 0x61, 0x6C, 0x3F, 0x42, 0xD3, 0x52, 0xC9, 0x4E, 0xD9, 0xD3, 0xBC, 0x77, 0x3A, 0x30,
-    0x23, 0xCE, 0x90, 0x26, 0x8B, 0xA2, 0x8D, 0x44, 0x06, 0xBD, 0xCC, 0xE2, 0x64, 0xBF, 0x46, 0x54,
-    0xF1, 0x7A, 0xA7, 0xB0, 0x3C, 0x16, 0xAC, 0x4A, 0x42, 0x7C, 0xF2, 0xA7, 0xDE, 0x7C, 0xA0, 0x9D,
-    0xF9, 0x50, 0xB8, 0x2E, 0x4D, 0x6A, 0x11, 0x53, 0xE6, 0xD2, 0x68, 0x59, 0x48, 0x25, 0xAC, 0x3E,
-    0xE8, 0xF5, 0x31, 0x65, 0x06, 0x7D, 0x61, 0x7F, 0xB6, 0x96, 0xC9, 0x1E, 0x39, 0x49, 0xC7, 0xEF,
-    0x6A, 0x3B, 0xD7, 0x64, 0x19, 0x7E, 0xDB, 0x0F, 0x48, 0x52, 0x26, 0x3D, 0xA9, 0xDE, 0x00, 0xA5,
-    0x85, 0x0A, 0x2B, 0x2E, 0xD3, 0xB3, 0x4D, 0x34, 0xC6, 0x03, 0x8A, 0xB7, 0x92, 0x12, 0x94, 0xD9,
-    0xDD, 0x46, 0x12, 0xA2, 0x21, 0x3C, 0xC1, 0x3C, 0xAB, 0xDA, 0xA6, 0x0D, 0x7E, 0x4E, 0x21, 0xF9,
-    0x02, 0xBF, 0x16, 0x50, 0xDD, 0x9C, 0xB0, 0x35, 0xA2, 0xB1, 0x78, 0x77, 0x92, 0xE0, 0xA2, 0x7A,
-    0x7F, 0x48, 0x3E, 0x9E, 0xC5, 0xC1, 0x5A, 0x6F, 0x92, 0x11, 0xAB, 0xB7, 0xDA, 0xE4, 0xD6, 0x20,
-    0x3B, 0x78, 0xF4, 0x26, 0x99, 0x4B, 0x81, 0x07, 0xB3, 0xD1, 0x4F, 0xD9, 0x93, 0xA9, 0x2F, 0x2C,
-    0x73, 0x8A, 0x10, 0xE1, 0x46, 0xCF, 0x18, 0x3F, 0xB1, 0x3A, 0x69, 0x65, 0xCA, 0xC1, 0x1C, 0x19,
-    0xCD, 0xD5, 0x5C, 0x24, 0x25, 0x2A, 0xC9, 0x60, 0x77, 0x66, 0xE3, 0x79, 0x91, 0xC7, 0xCD, 0xE9,
-    0x79, 0x4A, 0x7A, 0x50, 0xDC, 0x1D, 0xF0, 0xEB, 0x01, 0xA3, 0xE0, 0x2E, 0xF2, 0xBF, 0x2E, 0xF1,
-    0x4C, 0x83, 0xCA, 0xD6, 0x3C, 0x05, 0x73, 0x34, 0x88, 0x69, 0xA9, 0x9A, 0xEA, 0xD5, 0x51, 0x64,
-    0x8F, 0x86, 0xEC, 0xF5, 0x0F, 0x6D, 0x5E, 0xBD, 0xD6, 0x4D, 0xA2, 0x77, 0x83, 0x8D, 0x3F, 0x96,
-    0x6B, 0xDF, 0x6A, 0x26, 0xB1, 0x22, 0xF7, 0xC7, 0xF8, 0x96, 0xC4, 0xB2, 0x55, 0x39, 0x23, 0x9C,
-    0xED, 0x62, 0x30, 0xBA, 0xB3, 0x21, 0x6B, 0x59, 0xE3, 0x77, 0x3B, 0x04, 0x36, 0xB2, 0xD3, 0x39,
-    0x73, 0x01, 0xE4, 0xA1, 0x7C, 0xC8, 0x47, 0xB3, 0xC9, 0x2F, 0xB1, 0xF9, 0x25, 0x13, 0xDD, 0x7E,
-    0xC2, 0x47, 0x62, 0xED, 0xF4, 0x2B, 0x10, 0x14, 0xA0, 0xA6, 0x81, 0x1C, 0xFA, 0xF4, 0xC9, 0x46,
-    0xC1, 0x90, 0x3D, 0x03, 0xC2, 0x33, 0x41, 0xE5, 0x1A, 0xDD, 0x35, 0xF7, 0x27, 0x57, 0x82, 0xD9,
-    0x08, 0x99, 0x6B, 0xD7, 0xE5, 0x55, 0x2C, 0x5D, 0xCD, 0xD1, 0x78, 0x36, 0xEA, 0xED, 0x5D, 0x31,
-    0x58, 0x0B, 0x5E, 0x2A, 0x18, 0x73, 0x36, 0xF7, 0xCB, 0x19, 0xC9, 0x57, 0xCC, 0xE9, 0x80, 0x5E,
-    0xD2, 0xF8, 0xDB, 0x9C, 0x4F, 0x06, 0xE3, 0xA2, 0x5B, 0x5B, 0x77, 0x37, 0xF7, 0xBC, 0x44, 0x8C,
-    0xC8, 0x1F, 0xD1, 0x8A, 0x80, 0x59, 0x81, 0x7C, 0xE0, 0x8F, 0x44, 0xC4, 0x3D, 0xEB, 0xFF, 0x1F,
-    0x33, 0x8C, 0x79, 0x0B, 0x01, 0xF0, 0xCC, 0x2A, 0xF4, 0x7D, 0x3E, 0x00, 0xAC, 0x9C, 0x92, 0x3E,
-    0xCC, 0x3E, 0xAC, 0x7E, 0x1F, 0x42, 0x1F, 0x1E, 0xA1, 0xC8, 0xDA, 0xDC, 0xE6, 0xDA, 0xD6, 0xA8,
-    0xE9, 0xF3, 0xC2, 0x45, 0x03, 0xE9, 0xAD, 0x07, 0xDC, 0x8C, 0xB9, 0x11, 0x0A, 0xD8, 0xA3, 0x98,
-    0xE1, 0x04, 0x05, 0xC5, 0xEC, 0x55, 0xB9, 0xEC, 0x92, 0x67, 0xBE, 0x5F, 0x6C, 0xCD, 0xEE, 0xDB,
-    0xAB, 0xA7, 0x24, 0xED, 0x62, 0x2E, 0xB4, 0xA0, 0xB6, 0x15, 0xCF, 0xB1, 0xC1, 0x1D, 0xFD, 0x92,
-    0xB6, 0x09, 0xAC, 0x7B, 0x6A, 0x73, 0x34, 0x8F, 0x1F, 0x30, 0xA3, 0x4D, 0xF5, 0x71, 0xE9, 0xE5,
-    0x99, 0x18, 0xB4, 0xB3, 0x81, 0x9A, 0x76, 0x3B, 0x9F, 0x74, 0x44, 0xB0, 0x7A, 0xAC, 0x8E, 0x65,
-    0x60, 0x8F, 0xD0, 0xEA, 0xA1, 0x5B, 0xB2, 0x3D, 0x26, 0xB4, 0x30, 0x76, 0x25, 0x06, 0x6B, 0x22,
-    0xFD, 0x0D, 0x18, 0xAB, 0xE5, 0x3B, 0xFC, 0x6E, 0x42, 0x3A, 0x3A, 0x51, 0x49, 0x7B, 0xB5, 0xEE,
-    0x99, 0xC2, 0x15, 0x6B, 0x68, 0x5D, 0x12, 0x0B, 0x49, 0xF7, 0x8E, 0x71, 0xDF, 0x64, 0x74, 0x32,
-    0x60, 0xCC, 0x6C, 0x50, 0xA9, 0xFC, 0xE5, 0x47, 0x14, 0xE2, 0x69, 0xF9, 0x55, 0x85, 0x96, 0xF3,
-    0xC3, 0xA3, 0x27, 0xE4, 0x69, 0x40, 0x5C, 0xCC, 0xAB, 0x3A, 0x04, 0x0B, 0xAE, 0xCC, 0x4E, 0xA2,
-    0x79, 0x65, 0x50, 0x9F, 0xB8, 0x48, 0xE0, 0x20, 0x8F, 0x41, 0xE3, 0x44, 0xB0, 0x49, 0x24, 0x7B,
-    0x47, 0xDB, 0xD0, 0xE0, 0xA9, 0x01, 0x54, 0x59, 0xFC, 0xE3, 0x6A, 0x54, 0x64, 0x40, 0x44, 0x00,
-    0x83, 0x78, 0x56, 0x89, 0xA2, 0x8D, 0x5F, 0x9A, 0xD0, 0x57, 0xE9, 0x6A, 0x11, 0x96, 0x8F, 0x0E,
-    0xB6, 0x89, 0x36, 0xFE, 0x82, 0x8F, 0x10, 0xEF, 0x03, 0xFF, 0x93, 0xE1, 0x57, 0x5A, 0xB4, 0x34,
-    0x1E, 0xD3, 0x9C, 0x17, 0xC3, 0x59, 0x60, 0x82, 0xF5, 0x63, 0x4E, 0x21, 0x59, 0x7B, 0x87, 0x4C,
-    0xA4, 0x3B, 0x7A, 0x45, 0xDC, 0xC6, 0x76, 0xF5, 0x33, 0x11, 0xEB, 0x07, 0xAC, 0xDC, 0x73, 0xA2,
-    0xDD, 0x82, 0xA4, 0x16, 0xDF, 0xF5, 0xA2, 0x71, 0x81, 0xD2, 0xDD, 0x44, 0x9F, 0x38, 0xB2, 0xAE,
-    0xA0, 0x99, 0x6B, 0x1D, 0x50, 0x84, 0xF5, 0xAE, 0x49, 0x46, 0x2C, 0x76, 0xBC, 0xF8, 0xC5, 0xA8,
-    0x14, 0x0F, 0xF9, 0x04, 0x7F, 0xEB, 0x21, 0xCF, 0x42, 0x8B, 0x04, 0xB3, 0x56, 0xA2, 0x2E, 0xBF,
-    0xB3, 0xEC, 0x26, 0x6F, 0xD5, 0x9E, 0x62, 0x5B, 0x37, 0x5A, 0xD5, 0x39, 0x35, 0xD4, 0xDF, 0x52,
-    0xC8, 0x55, 0xFC, 0x75, 0x9A, 0x5B, 0xB8, 0x34, 0x97, 0x5B, 0x7F, 0x07, 0x01, 0x83, 0xFE, 0x88,
-    0x12, 0xC9, 0x3A, 0xE0, 0x3E, 0xBF, 0xE8, 0x36, 0x22, 0xF7, 0x26, 0x1A, 0xE4, 0xCE, 0x6B, 0x16,
-    0x33, 0xDF, 0xD8, 0x2C, 0x46, 0x7F, 0x1A, 0x9D, 0x6A, 0x16, 0x1B, 0xCC, 0xD6, 0x8D, 0xB7, 0xEF,
-    0x6E, 0x1B, 0x37, 0x67, 0xAB, 0x8F, 0x18, 0x2E, 0x4F, 0x14, 0xB1, 0x2C, 0xFD, 0x7F, 0xB5, 0x56,
-    0x41, 0x6C, 0x1C, 0x49, 0x15, 0xFD, 0xDD, 0x1D, 0xBB, 0x83, 0x5B, 0xEB, 0xCA, 0xC1, 0x16, 0xE0,
-    0x55, 0x5C, 0x39, 0x70, 0x00, 0x23, 0xDC, 0x17, 0x0E, 0x7B, 0xB0, 0xA7, 0x2A, 0xF1, 0x61, 0x0F,
-    0x96, 0xF0, 0x20, 0x3C, 0x67, 0x10, 0x5C, 0x12, 0x83, 0x14, 0x0E, 0x1C, 0x82, 0x18, 0xA7, 0x3B,
-    0xF1, 0x61, 0x25, 0x2C, 0xC1, 0xA0, 0x85, 0xF3, 0xFA, 0x10, 0x89, 0xD0, 0x91, 0x70, 0x40, 0x91,
-    0xF0, 0xC1, 0x9E, 0x2E, 0x7B, 0x84, 0x2C, 0x94, 0xC3, 0x36, 0x6B, 0x24, 0x24, 0xF6, 0x40, 0xE3,
-    0x45, 0x1B, 0x44, 0x56, 0xB8, 0x96, 0x14, 0xD0, 0x6B, 0x57, 0xF7, 0xE7, 0xD7, 0x8C, 0xBD, 0xCB,
-    0x61, 0x11, 0x27, 0x5A, 0x3D, 0x35, 0xD3, 0x5D, 0xBF, 0x7E, 0xFD, 0xFF, 0xFE, 0x7F, 0xAF, 0x66,
-    0x2D, 0x4D, 0x4A, 0xA1, 0x99, 0x09, 0x2C, 0x58, 0xC8, 0x52, 0x51, 0x85, 0x0D, 0x60, 0x2A, 0x8A,
-    0x50, 0x03, 0xCC, 0x3C, 0x84, 0x10, 0x4B, 0x0F, 0x11, 0x92, 0xB7, 0x2B, 0xAE, 0xE3, 0xA3, 0x0A,
-    0xFA, 0x00, 0xD0, 0xE6, 0x86, 0xED, 0x63, 0xD3, 0x30, 0x44, 0x7D, 0x97, 0xE3, 0x75, 0x3D, 0x5E,
-    0xC2, 0x74, 0xA7, 0x83, 0x78, 0x86, 0xB8, 0x8D, 0x35, 0x59, 0xD0, 0x12, 0x3C, 0xA4, 0x4F, 0x8C,
-    0x68, 0x3B, 0x9D, 0x8E, 0xBC, 0x09, 0x73, 0x71, 0xCA, 0x9F, 0x9E, 0xE6, 0x05, 0x2D, 0xE1, 0x58,
-    0xC2, 0xCF, 0x7B, 0x30, 0x16, 0xD4, 0xF9, 0x49, 0x93, 0xEF, 0xF7, 0xC8, 0x3E, 0xBE, 0x5E, 0x25,
-    0x03, 0x9B, 0x1F, 0xDA, 0x64, 0xA9, 0xBA, 0x04, 0x72, 0x2D, 0x45, 0x83, 0x76, 0xC9, 0xFA, 0xF6,
-    0x65, 0x23, 0x0A, 0x41, 0x06, 0xD1, 0x9F, 0x19, 0x6E, 0x3E, 0x7B, 0xA1, 0x17, 0x2D, 0xBF, 0xBD,
-    0x3D, 0xC0, 0x22, 0xEE, 0xC1, 0xDA, 0xFD, 0x9F, 0x79, 0xB8, 0x6C, 0x83, 0x9A, 0x53, 0xF4, 0x42,
-    0xC5, 0xAA, 0x81, 0xBB, 0x9E, 0x81, 0x39, 0x39, 0xBE, 0x95, 0x43, 0x2E, 0x91, 0x19, 0x8A, 0x42,
-    0x06, 0x68, 0x28, 0x07, 0x09, 0xE3, 0xBD, 0x9A, 0xED, 0xDB, 0xF8, 0xA0, 0x12, 0x4B, 0x3A, 0x19,
-    0x6B, 0x4F, 0xA4, 0x0F, 0xD9, 0x81, 0xE5, 0x07, 0x55, 0xBC, 0x61, 0xC4, 0x86, 0x16, 0xAF, 0x52,
-    0xB6, 0x30, 0xF7, 0xA3, 0xCC, 0x47, 0xE7, 0x2D, 0x97, 0x62, 0xC3, 0x7A, 0x96, 0x15, 0x61, 0xD1,
-    0x82, 0x29, 0x80, 0x1C, 0x00, 0xE5, 0x4D, 0x9C, 0xD9, 0xFD, 0x6C, 0xEB, 0x2E, 0x58, 0x81, 0x15,
-    0x23, 0x54, 0xFA, 0x12, 0x66, 0x7A, 0x40, 0xD8, 0x50, 0x4A, 0x39, 0x5A, 0x21, 0xC5, 0x4A, 0x1A,
-    0x16, 0x64, 0x2B, 0x94, 0x28, 0xC8, 0x4B, 0x15, 0xDA, 0x00, 0x3D, 0x94, 0xD3, 0x12, 0x7C, 0x32,
-    0x52, 0x49, 0xE1, 0x60, 0x8E, 0xAA, 0xC0, 0x7A, 0x0D, 0x74, 0xC8, 0x63, 0x72, 0x72, 0xDA, 0xE4,
-    0x6F, 0xBC, 0x53, 0x35, 0xD3, 0x1F, 0x6F, 0xB0, 0xD6, 0x13, 0x9A, 0x6B, 0xF7, 0x0C, 0x7B, 0xF4,
-    0xC0, 0xC9, 0x1D, 0xE4, 0x8A, 0xEB, 0xA0, 0x72, 0x08, 0xEB, 0xE8, 0x8D, 0x3A, 0xD7, 0xA1, 0x9A,
-    0x85, 0x2B, 0x00, 0x0C, 0x38, 0xF0, 0x3A, 0xB6, 0x8B, 0xB0, 0x40, 0xF1, 0x8E, 0x75, 0x56, 0x11,
-    0x8F, 0xB3, 0x6D, 0x49, 0x4F, 0xA0, 0x21, 0x54, 0x30, 0x0F, 0x60, 0x20, 0x50, 0x30, 0x41, 0x5E,
-    0x53, 0x66, 0x3D, 0x2A, 0xB0, 0xE6, 0x75, 0x84, 0x69, 0x5E, 0x30, 0x87, 0x3F, 0x80, 0xB4, 0xE2,
-    0xB0, 0xD8, 0x8D, 0x94, 0xF0, 0x4A, 0x57, 0x61, 0xAF, 0xF4, 0xCB, 0xA0, 0x48, 0xEA, 0xBC, 0x9E,
-    0xEE, 0x30, 0x3C, 0xC8, 0xB7, 0x98, 0xA4, 0xE5, 0x0E, 0x24, 0xD0, 0x9E, 0xFE, 0xFC, 0xA9, 0x68,
-    0x3E, 0xF9, 0xBB, 0x50, 0x8D, 0x4B, 0x80, 0x04, 0xF3, 0x06, 0xD6, 0x64, 0x5C, 0xBA, 0x16, 0xF2,
-    0x28, 0xC2, 0xEF, 0xE7, 0x47, 0xA8, 0x51, 0xC7, 0x25, 0xC1, 0x43, 0xC5, 0x53, 0x42, 0x25, 0x2A,
-    0x57, 0x49, 0x23, 0x1A, 0xDE, 0xF8, 0x0F, 0xA3, 0x02, 0x8F, 0x70, 0xC5, 0xF2, 0x62, 0xB8, 0x2B,
-    0xBF, 0x67, 0xC5, 0xA0, 0x76, 0xF7, 0x7D, 0x7B, 0x09, 0xAE, 0xB8, 0x2A, 0x2F, 0x3F, 0x7B, 0x51,
-    0xAE, 0x57, 0x17, 0x55, 0x66, 0x55, 0x3E, 0xA8, 0x79, 0xD9, 0x78, 0x6D, 0xF0, 0x2B, 0x68, 0x20,
-    0xD1, 0x7E, 0x0D, 0xF9, 0x0A, 0x0E, 0xB0, 0xC4, 0x5E, 0x68, 0x92, 0x50, 0x0B, 0x85, 0x01, 0xBE,
-    0x4D, 0x8D, 0x00, 0xE0, 0x6F, 0x71, 0xD5, 0x0F, 0x0C, 0x53, 0x89, 0x6F, 0x59, 0x29, 0xE4, 0x2A,
-    0x21, 0xD1, 0xF9, 0x32, 0x62, 0x13, 0x67, 0x8F, 0xDE, 0x2A, 0x61, 0x61, 0x11, 0xC2, 0x81, 0x82,
-    0x9D, 0x29, 0xF0, 0xE0, 0xF1, 0x4B, 0xC1, 0x7B, 0xEC, 0xFE, 0x33, 0xD7, 0xC0, 0xCB, 0xE5, 0x2D,
-    0x98, 0x78, 0x9D, 0xAA, 0x15, 0x1F, 0xBB, 0x5A, 0xAA, 0x10, 0x35, 0x08, 0xF2, 0x36, 0xF7, 0x00,
-    0x18, 0x2A, 0x1F, 0x1B, 0xC8, 0xDF, 0x34, 0xA2, 0x14, 0x4F, 0x0D, 0xD4, 0x73, 0x30, 0xB1, 0xA2,
-    0xD8, 0x51, 0xB3, 0x4D, 0x15, 0x37, 0x11, 0xB5, 0xD6, 0x6D, 0x42, 0x6F, 0x4D, 0x7A, 0xD8, 0x50,
-    0xAF, 0x15, 0x78, 0x62, 0x13, 0x48, 0xB8, 0x8C, 0xD4, 0x7F, 0x25, 0xC9, 0xAA, 0xC0, 0x5A, 0x50,
-    0xB3, 0xB8, 0x1B, 0x91, 0xE6, 0x70, 0xDF, 0xF1, 0x83, 0xE2, 0x5C, 0xE5, 0xC4, 0x15, 0xE2, 0x4B,
-    0x05, 0xE7, 0xD7, 0x5C, 0x96, 0x6D, 0x25, 0xB4, 0x78, 0x2D, 0xCB, 0x5C, 0x89, 0x64, 0x5E, 0xB4,
-    0x62, 0xDC, 0x3E, 0x22, 0xAB, 0x3D, 0x8E, 0x51, 0xFA, 0x72, 0xEA, 0x8C, 0xC8, 0xC1, 0xEF, 0xE9,
-    0xE3, 0xD6, 0x12, 0x03, 0xDB, 0xA3, 0x95, 0x3E, 0xBA, 0x6B, 0xB8, 0x03, 0x12, 0x52, 0xEE, 0xFA,
-    0xD0, 0x2B, 0x7C, 0x06, 0x3C, 0x0B, 0x8C, 0x92, 0xB2, 0x21, 0x16, 0x82, 0xBE, 0x4B, 0x10, 0x12,
-    0x3E, 0x35, 0x9A, 0x5C, 0x75, 0x9D, 0x45, 0xB9, 0x43, 0x60, 0x68, 0x70, 0x12, 0x00, 0xCC, 0x25,
-    0x13, 0xBB, 0xCD, 0x1C, 0x0F, 0x87, 0xFC, 0xFF, 0xFF, 0x5B, 0x50, 0xBB, 0x32, 0xB5, 0x1E, 0x14,
-    0xEB, 0xE2, 0x50, 0x5F, 0x81, 0x31, 0x42, 0x53, 0xC3, 0x2C, 0x07, 0xFF, 0xB8, 0x84, 0x45, 0x91,
-    0x3D, 0x1A, 0x8C, 0xD2, 0x85, 0x11, 0x02, 0x0D, 0xCB, 0x1E, 0x15, 0x54, 0xDE, 0xAB, 0x10, 0x1C,
-    0x14, 0x70, 0x87, 0xD2, 0xBE, 0x41, 0xD0, 0x85, 0xA6, 0x1F, 0x9D, 0x9C, 0x3D, 0xBB, 0xA7, 0x5B,
-    0xEA, 0x8B, 0x93, 0x97, 0x2F, 0xC7, 0x2D, 0x56, 0x45, 0x44, 0xA7, 0x75, 0x7B, 0xED, 0x1A, 0x7C,
-    0x2B, 0xB0, 0xA1, 0x8A, 0xD2, 0x50, 0x05, 0xA5, 0xAF, 0x83, 0x32, 0x56, 0x9F, 0x73, 0x9D, 0xB2,
-    0x9A, 0x23, 0xBE, 0x20, 0xAC, 0xD2, 0x51, 0x04, 0x5E, 0x96, 0x65, 0x9B, 0xF4, 0x38, 0x93, 0x65,
-    0x0F, 0xE6, 0x1C, 0x15, 0x89, 0x9A, 0x3E, 0x51, 0xD1, 0x23, 0x91, 0x34, 0x51, 0x4D, 0xCC, 0x16,
-    0x2A, 0x2A, 0xE1, 0x63, 0x4B, 0x93, 0xBC, 0x86, 0xB7, 0x75, 0xC2, 0x8A, 0x27, 0x43, 0x2D, 0x54,
-    0x7E, 0x25, 0x4C, 0x9D, 0x1C, 0x36, 0xE2, 0x79, 0x95, 0x6F, 0xD4, 0x39, 0xA3, 0xA6, 0xBD, 0x6E,
-    0x41, 0xB2, 0x32, 0xB9, 0x51, 0xB3, 0x46, 0x90, 0x7A, 0x7D, 0xD8, 0x00, 0x59, 0x46, 0x24, 0x86,
-    0x1D, 0x22, 0xAE, 0xE9, 0x12, 0xD7, 0x88, 0xDB, 0xED, 0xFF, 0xD5, 0x1C, 0x33, 0x37, 0xB6, 0x6A,
-    0x36, 0x30, 0x09, 0x3F, 0xB0, 0x09, 0x3B, 0xAE, 0xA8, 0x9A, 0xC4, 0xCA, 0x06, 0x4B, 0x26, 0x17,
-    0x80, 0x04, 0x82, 0xBA, 0x1D, 0x56, 0x75, 0x3B, 0x37, 0x77, 0x12, 0xDC, 0x5B, 0x14, 0xCD, 0xE4,
-    0xEC, 0x2D, 0x08, 0xCF, 0x53, 0x1C, 0xA2, 0x4F, 0xFA, 0x02, 0x08, 0xA4, 0x0D, 0x7E, 0xED, 0x1F,
-    0xE1, 0xBB, 0xEF, 0xFF, 0x03, 0x8D, 0x0E, 0x0D, 0x7C, 0x9A, 0xE8, 0x59, 0x40, 0x64, 0x80, 0x92,
-    0x86, 0x4B, 0x64, 0x7D, 0xD3, 0xEB, 0x89, 0xBA, 0x1B, 0x11, 0x40, 0x8E, 0xDC, 0xAE, 0x54, 0xE9,
-    0x13, 0x86, 0xDB, 0xFE, 0xBB, 0x58, 0x2C, 0xF8, 0xEE, 0x85, 0x84, 0xC7, 0x5F, 0x18, 0xF2, 0x80,
-    0x04, 0xF2, 0x9E, 0x81, 0xDE, 0xD7, 0x46, 0xBB, 0x84, 0xD0, 0x8F, 0xEA, 0x50, 0xCD, 0x83, 0x09,
-    0x48, 0x08, 0xE2, 0x2A, 0x68, 0x88, 0xD9, 0x95, 0xA3, 0x99, 0x2B, 0xFC, 0xC5, 0xF8, 0x95, 0x5F,
-    0x03, 0x6B, 0xC3, 0x2F, 0x7F, 0x40, 0xD5, 0x9E, 0x04, 0x78, 0x0C, 0xF0, 0x09, 0x00, 0x72, 0x70,
-    0xCD, 0xFD, 0x68, 0x7F, 0x1B, 0x60, 0x72, 0xEC, 0xDC, 0x92, 0xC8, 0x10, 0x30, 0x4D, 0xFA, 0x11,
-    0x9E, 0xAF, 0xDD, 0x72, 0xB3, 0x13, 0x40, 0xE3, 0x4B, 0x17, 0xAB, 0x46, 0x1E, 0xE0, 0x17, 0x5F,
-    0x72, 0xFA, 0xF7, 0x8D, 0xDF, 0x7C, 0xB4, 0x8B, 0x1B, 0xD1, 0xC5, 0x80, 0xA3, 0x18, 0x80, 0xC9,
-    0x5C, 0xF6, 0xA3, 0xE7, 0x95, 0xEB, 0x44, 0xB9, 0x7B, 0xA1, 0x81, 0xCE, 0x70, 0xDA, 0x9D, 0x7D,
-    0x9C, 0x68, 0xF4, 0x93, 0x7A, 0x1D, 0x5A, 0xBB, 0xFD, 0x96, 0x03, 0x89, 0xEE, 0x3B, 0x70, 0xF9,
-    0x5A, 0xCB, 0x32, 0x43, 0x55, 0xAC, 0xAE, 0xBE, 0xE2, 0x98, 0x7E, 0x37, 0xF9, 0xA1, 0x22, 0x2F,
-    0xB0, 0x75, 0x0D, 0x2A, 0x92, 0xEE, 0xBD, 0xC8, 0xD4, 0x81, 0x24, 0x34, 0xA0, 0x25, 0x45, 0x50,
-    0x33, 0xC5, 0x37, 0x77, 0xF8, 0x3B, 0x6F, 0xC6, 0xF7, 0x8E, 0xFF, 0x00, 0x8F, 0x5F, 0x01, 0xAF,
-    0xE4, 0xE9, 0x6E, 0xA8, 0x76, 0x93, 0xCD, 0xB2, 0xFD, 0xD1, 0x21, 0xE8, 0xF5, 0xE0, 0x3B, 0xFE,
-    0xDF, 0xCA, 0xBC, 0x0A, 0x4D, 0xF0, 0x47, 0xF8, 0xBA, 0xAB, 0x61, 0x58, 0xE5, 0xAF, 0x3E, 0x6F,
-    0xFE, 0xA9, 0x76, 0x98, 0xBE, 0x1A, 0xBC, 0x17, 0xA5, 0xFF, 0x3A, 0x69, 0x4C, 0xB2, 0x49, 0x81,
-    0x96, 0xA1, 0x8C, 0x2D, 0xEA, 0x20, 0xBD, 0x0A, 0x70, 0xCB, 0xA5, 0x34, 0xF1, 0xBA, 0x0B, 0x3F,
-    0xB0, 0xAE, 0x2C, 0xE3, 0x24, 0x62, 0x1F, 0x74, 0xBE, 0x89, 0x2A, 0x70, 0xBC, 0x2F, 0x29, 0x09,
-    0x37, 0x82, 0x97, 0x63, 0xEF, 0xC2, 0xFA, 0xB5, 0x21, 0xED, 0x2A, 0x41, 0xAF, 0xC3, 0x73, 0xEB,
-    0x74, 0x68, 0x4D, 0xE5, 0x1E, 0x59, 0x8F, 0xE7, 0x4D, 0x6F, 0xD8, 0x64, 0xD9, 0x4F, 0xE9, 0x45,
-    0x43, 0xC4, 0x20, 0x89, 0xA5, 0x16, 0x24, 0x2E, 0x64, 0x0F, 0xDC, 0xD3, 0x11, 0x9E, 0xCB, 0x97,
-    0x75, 0xEC, 0x24, 0x0C, 0x22, 0x6C, 0x24, 0x44, 0xCA, 0x59, 0x67, 0x4E, 0xF3, 0xD0, 0xC9, 0x1E,
-    0x05, 0x83, 0x8D, 0x6B, 0x8D, 0xF1, 0xCC, 0x91, 0x6A, 0x2C, 0xFB, 0xB1, 0xDB, 0x98, 0xA6, 0xE4,
-    0xF0, 0x1F, 0x02, 0x2A, 0x10, 0xF8, 0xD7, 0x1C, 0x8B, 0x80, 0x62, 0x23, 0x9A, 0x08, 0x77, 0x28,
-    0x24, 0xF7, 0x87, 0x4D, 0x9E, 0xC0, 0x7F, 0x5E, 0xA3, 0x4E, 0xF2, 0xF4, 0xC8, 0xB1, 0x49, 0x46,
-    0xFE, 0x3B, 0xEE, 0xEA, 0x8F, 0xA6, 0x46, 0xE7, 0x89, 0x6B, 0x53, 0xFF, 0xF4, 0xAD, 0x33, 0x6D,
-    0xBA, 0xDD, 0xF9, 0x98, 0x2D, 0x3F, 0x55, 0xA8, 0xC7, 0xA6, 0xDC, 0x4C, 0x2E, 0x3F, 0xD0, 0x3B,
-    0x5D, 0x51, 0xB3, 0x76, 0x50, 0xC8, 0x5C, 0xD3, 0x79, 0x12, 0xDE, 0x20, 0xCD, 0xE0, 0xD1, 0x46,
-    0xA1, 0xBB, 0xF3, 0xDE, 0x10, 0x90, 0xB8, 0xBF, 0xC8, 0xBB, 0x7C, 0x67, 0xBE, 0xDB, 0x15, 0x66,
-    0x4C, 0xCE, 0xB2, 0xE5, 0xA5, 0xC1, 0xBE, 0xA6, 0x55, 0x8B, 0x3C, 0x0E, 0xCE, 0xD4, 0x14, 0xA9,
-    0x6B, 0x7C, 0x7C, 0xFA, 0x55, 0xD8, 0xF1, 0xCB, 0x68, 0x9F, 0xD9, 0x31, 0xE9, 0x4E, 0xD4, 0x2E,
-    0x44, 0x69, 0xDF, 0xC4, 0x79, 0xF0, 0x5B, 0xDD, 0x9D, 0x25, 0x67, 0xDD, 0x6E, 0x80, 0x8A, 0xB6,
-    0xF4, 0x0B, 0x3A, 0x71, 0x17, 0x80, 0xEF, 0x45, 0xCF, 0x07, 0x7F, 0xD2, 0x9A, 0xC2, 0x99, 0x67,
-    0x2B, 0x4B, 0xFB, 0x72, 0x28, 0xD1, 0xBF, 0xFA, 0x7B, 0xC5, 0x4E, 0xCE, 0x94, 0xD9, 0x5D, 0xE0,
-    0x6C, 0xE9, 0xA0, 0xD4, 0xB4, 0x43, 0xB4, 0x71, 0x50, 0x9A, 0xA9, 0x4B, 0x0E, 0xCC, 0xC5, 0xF7,
-    0x71, 0x53, 0xB5, 0x40, 0x07, 0x8A, 0xD3, 0xD9, 0xEE, 0xC9, 0x49, 0x1F, 0x97, 0xFF, 0xC2, 0xE1,
-    0x8E, 0x5F, 0x30, 0x92, 0x9C, 0x69, 0x78, 0x32, 0xFF, 0x64, 0x61, 0xC7, 0x7C, 0x57, 0x7F, 0x4F,
-    0x89, 0x54, 0xD0, 0x71, 0x1F, 0x0E, 0xCA, 0xC5, 0xCA, 0x6F, 0x48, 0x43, 0x89, 0xC9, 0x67, 0x45,
-    0xCC, 0x3D, 0xD9, 0xFE, 0x37, 0xE5, 0x7D, 0x4D, 0xAC, 0x1C, 0x57, 0x76, 0xDE, 0xED, 0x2E, 0x91,
-    0x15, 0x4F, 0x01, 0x2E, 0x2D, 0x44, 0xC7, 0x96, 0x12, 0x97, 0x17, 0x59, 0x04, 0x02, 0xE2, 0xDA,
-    0x78, 0x31, 0x09, 0x62, 0x57, 0x51, 0x04, 0xA2, 0x85, 0x16, 0x24, 0x02, 0x72, 0x8C, 0xF1, 0x2C,
-    0x98, 0x85, 0xB2, 0x18, 0x19, 0x08, 0xB3, 0x35, 0xE0, 0x4C, 0xB5, 0x44, 0x04, 0x5A, 0xCC, 0x42,
-    0x0C, 0x62, 0x3B, 0x0B, 0x2F, 0x46, 0x08, 0x64, 0x44, 0x7A, 0x5A, 0x70, 0xE3, 0x8D, 0x01, 0xC9,
-    0xB7, 0x28, 0x22, 0x11, 0x10, 0x2D, 0x54, 0x92, 0x32, 0xF6, 0x42, 0x0B, 0x95, 0x86, 0x92, 0x95,
-    0x90, 0x08, 0x58, 0x1A, 0x96, 0x46, 0xC5, 0xC7, 0xAA, 0xBA, 0x39, 0xDF, 0x77, 0xEE, 0xAD, 0xEE,
-    0x7E, 0x7C, 0xFA, 0xF1, 0x8C, 0xC7, 0x92, 0x63, 0xCE, 0xA8, 0xC9, 0xF7, 0xBA, 0xBB, 0xEA, 0xFE,
-    0x9C, 0x7B, 0xCE, 0x77, 0xBE, 0xF3, 0x53, 0xC6, 0x3C, 0x7A, 0xC5, 0x18, 0x53, 0x74, 0xF2, 0x92,
-    0xF6, 0xF2, 0x12, 0x8F, 0xF2, 0xB2, 0xC6, 0x8B, 0x79, 0xD5, 0xEC, 0xFC, 0xC9, 0x9C, 0x1B, 0x4D,
-    0x8E, 0x97, 0xC2, 0xB9, 0x01, 0x2F, 0xBD, 0x29, 0x3E, 0xB9, 0x70, 0xCE, 0x54, 0xAD, 0xBC, 0x6B,
-    0x1B, 0x79, 0x71, 0xF5, 0xF2, 0xF2, 0xC3, 0x0B, 0x66, 0xE5, 0x9C, 0x2B, 0xD7, 0xF2, 0x62, 0x22,
-    0x7D, 0x39, 0x78, 0xC9, 0xC4, 0xB3, 0xBC, 0x99, 0xF0, 0x65, 0xC2, 0x0D, 0xC7, 0xF0, 0x92, 0xE1,
-    0x25, 0xF7, 0x17, 0x0E, 0x57, 0x77, 0xAE, 0x0B, 0x77, 0x7F, 0x35, 0x96, 0x1B, 0xB8, 0xB4, 0x93,
-    0xAB, 0x66, 0xF2, 0x32, 0x65, 0x72, 0xD3, 0x17, 0x4E, 0x6E, 0xBE, 0xFA, 0xF1, 0xC9, 0x6D, 0xDD,
-    0x90, 0xC8, 0xCB, 0x8C, 0xAB, 0xB8, 0x12, 0x2F, 0xF5, 0xA9, 0x8B, 0xB3, 0xDC, 0x38, 0x72, 0x26,
-    0xDC, 0x8F, 0x63, 0xC8, 0x06, 0x5E, 0xF7, 0xDB, 0x25, 0x6E, 0x28, 0xF7, 0x90, 0x4F, 0xB6, 0xA6,
-    0x72, 0x6E, 0x32, 0xF9, 0xFC, 0xB2, 0xAB, 0x93, 0xD1, 0x54, 0x9D, 0x7C, 0x47, 0xEE, 0xE7, 0xEA,
-    0xC8, 0x95, 0xF2, 0x1D, 0x57, 0xE7, 0xBD, 0xFC, 0x52, 0x7E, 0x53, 0x0C, 0x91, 0x4B, 0x65, 0x6E,
-    0xEE, 0xB2, 0x7C, 0xB3, 0x6A, 0xE5, 0x25, 0xEF, 0x0B, 0x0C, 0xD1, 0x9C, 0xE3, 0xEC, 0xBF, 0xF1,
-    0x22, 0xC6, 0x37, 0x84, 0x5B, 0xB9, 0xD2, 0x98, 0x08, 0x6F, 0xC7, 0xFD, 0xEE, 0x1E, 0xA6, 0x58,
-    0x9E, 0xB0, 0x50, 0xBB, 0x6B, 0x54, 0xE0, 0x4B, 0x55, 0x73, 0xDF, 0x42, 0xAD, 0xDC, 0x06, 0x2F,
-    0x72, 0xB5, 0x35, 0x26, 0x13, 0x2D, 0x2F, 0xF1, 0x31, 0x6B, 0x94, 0x0E, 0x61, 0x92, 0x79, 0x1F,
-    0x44, 0xAA, 0xE8, 0xB6, 0x77, 0x4F, 0xDC, 0x5D, 0xAE, 0x21, 0x57, 0x8E, 0xDB, 0x34, 0xCB, 0x4B,
-    0x99, 0x9B, 0x4C, 0x2E, 0x56, 0xA6, 0xBC, 0xA2, 0xDE, 0xA0, 0x0C, 0x63, 0xB0, 0xF8, 0x34, 0x37,
-    0x35, 0x0D, 0x1B, 0xB5, 0xD1, 0x77, 0x54, 0x60, 0x47, 0x7E, 0x1C, 0x62, 0x60, 0xF9, 0xB3, 0x2B,
-    0x13, 0x83, 0x2D, 0xAD, 0x75, 0x73, 0x22, 0x7C, 0x53, 0x26, 0x2C, 0xF7, 0x35, 0xA7, 0xCA, 0x30,
-    0x8E, 0x93, 0xF8, 0x19, 0x97, 0x4B, 0xB1, 0x08, 0x72, 0x0B, 0x59, 0xED, 0xCD, 0xAF, 0xEA, 0x16,
-    0xDB, 0x16, 0x53, 0x95, 0x0B, 0xC6, 0x4E, 0xAF, 0x87, 0x11, 0xCB, 0x8F, 0x05, 0x6E, 0xCA, 0x17,
-    0xFE, 0x98, 0xE1, 0xDD, 0x0C, 0xD3, 0x2F, 0x7A, 0xBF, 0x68, 0x32, 0xEA, 0xDF, 0x33, 0xF9, 0x08,
-    0xA9, 0x6A, 0x63, 0x5C, 0x3D, 0xC3, 0xF6, 0x3E, 0xC2, 0x7B, 0x9F, 0x37, 0xBA, 0x32, 0xB6, 0x91,
-    0x4F, 0x61, 0x37, 0x3B, 0x59, 0x58, 0x59, 0x3D, 0x99, 0x04, 0x6E, 0x1E, 0xDE, 0xC2, 0x7C, 0xAA,
-    0x76, 0xBD, 0x7D, 0x2B, 0xC6, 0x36, 0x1B, 0xE7, 0xDF, 0xD2, 0x83, 0x90, 0x6D, 0xE2, 0xD1, 0x99,
-    0xFC, 0x53, 0xF9, 0xE8, 0xD9, 0xD6, 0xBC, 0xF0, 0xF0, 0x76, 0x73, 0x07, 0x6E, 0xE1, 0x5A, 0xC6,
-    0x8C, 0x0F, 0x17, 0x1D, 0x77, 0x0F, 0x7B, 0x84, 0xB5, 0x92, 0xA1, 0x63, 0xE3, 0xB0, 0x3D, 0x32,
-    0x5A, 0xFC, 0x93, 0x1F, 0x6A, 0x8F, 0x7E, 0x08, 0x1B, 0x8B, 0xED, 0xB3, 0xF5, 0xF2, 0x21, 0xC3,
-    0x9F, 0xF8, 0x4F, 0xCA, 0x03, 0xC4, 0x0C, 0x77, 0xE1, 0x57, 0x28, 0x0D, 0x90, 0x39, 0x0A, 0x83,
-    0x6B, 0xFC, 0x57, 0xB0, 0x52, 0xD9, 0xFD, 0x9F, 0xEB, 0xFC, 0xE9, 0xB2, 0xC7, 0x7F, 0xAE, 0xF7,
-    0x9F, 0x93, 0x85, 0x7B, 0xA8, 0x9A, 0x64, 0x0F, 0xE4, 0xED, 0x4A, 0xF6, 0x31, 0xC6, 0x36, 0x16,
-    0x77, 0x97, 0xA9, 0x62, 0x7D, 0x1B, 0xA3, 0xF2, 0x31, 0x7A, 0xC1, 0xA6, 0x54, 0x60, 0x5B, 0xF9,
-    0x8B, 0xEC, 0xEE, 0xB7, 0x28, 0x16, 0x22, 0xB6, 0x14, 0x46, 0x19, 0x83, 0x1E, 0x47, 0x99, 0x9F,
-    0xCA, 0x24, 0xF7, 0x42, 0x65, 0xA8, 0x72, 0x03, 0x87, 0x92, 0x40, 0x1E, 0x30, 0x1C, 0x9E, 0x4C,
-    0x19, 0x12, 0x85, 0x4E, 0x77, 0xAB, 0x1A, 0x4C, 0x84, 0xDD, 0x58, 0x63, 0x48, 0x8D, 0x5C, 0x56,
-    0xC4, 0x25, 0xEC, 0xA4, 0x6E, 0xA2, 0x2C, 0x4B, 0x31, 0xC8, 0x52, 0xC4, 0x6E, 0x75, 0xD1, 0xC9,
-    0x72, 0x9C, 0x74, 0x5D, 0x25, 0x97, 0xC1, 0x88, 0x62, 0x2F, 0xC0, 0x65, 0xE5, 0x38, 0xC4, 0x3A,
-    0x96, 0x2F, 0x65, 0xCE, 0xED, 0xE9, 0xAF, 0x41, 0xCF, 0x8E, 0x2C, 0x8D, 0x17, 0x27, 0x8E, 0x2F,
-    0x1D, 0x75, 0xA1, 0x64, 0xD0, 0x18, 0xB7, 0xDC, 0x8D, 0x7B, 0x20, 0xAB, 0xCD, 0x05, 0xF7, 0xBF,
-    0xC6, 0x3A, 0x62, 0x01, 0xA8, 0x83, 0xE6, 0x92, 0x5A, 0x09, 0x4B, 0x64, 0xF5, 0x6F, 0xFE, 0x5A,
-    0x6E, 0x9B, 0x4E, 0x17, 0x2E, 0x4E, 0x17, 0x65, 0x32, 0xA2, 0x77, 0xBA, 0x64, 0x16, 0x49, 0x93,
-    0xFF, 0x67, 0xA3, 0x5E, 0xAC, 0x6A, 0x79, 0x31, 0xF9, 0x0D, 0x2F, 0x96, 0x4E, 0xB2, 0x54, 0x32,
-    0x17, 0xD7, 0xE5, 0x3C, 0x82, 0xA2, 0xDA, 0x1A, 0x8C, 0xBD, 0x8F, 0xF4, 0x1C, 0x42, 0x8E, 0x65,
-    0x4E, 0x57, 0x7E, 0x46, 0x0D, 0xD8, 0x41, 0x03, 0xCE, 0xC7, 0x6A, 0x40, 0xB3, 0x68, 0xC0, 0x56,
-    0x7E, 0x93, 0xF7, 0xFE, 0x9D, 0xCD, 0xDE, 0x3B, 0xB8, 0xC1, 0xC1, 0x66, 0x51, 0x03, 0x5C, 0x14,
-    0x93, 0xE9, 0x96, 0x53, 0x44, 0x2A, 0xB3, 0xFF, 0x47, 0x8E, 0x89, 0x6C, 0x9D, 0x7C, 0x42, 0xA4,
-    0x0D, 0x87, 0xAB, 0xE5, 0x9C, 0x45, 0x61, 0x74, 0x38, 0xF2, 0x72, 0xAB, 0x09, 0x7B, 0x50, 0xF0,
-    0x08, 0x40, 0x1B, 0xB8, 0xD7, 0x30, 0x7E, 0xF7, 0xAE, 0xC3, 0xE2, 0x8B, 0xAE, 0x86, 0x7E, 0x19,
-    0xB8, 0xD2, 0x7C, 0xB5, 0xB2, 0x39, 0xD1, 0x8C, 0x2F, 0xC5, 0x33, 0x44, 0x3B, 0x99, 0xF4, 0xD8,
-    0x44, 0x3C, 0x86, 0xB8, 0x30, 0xE4, 0xA9, 0xC6, 0x0D, 0xE5, 0x56, 0x54, 0xE7, 0xDC, 0xB4, 0x9E,
-    0xAF, 0x58, 0x8F, 0xF5, 0x81, 0x31, 0xFE, 0x00, 0xC8, 0x3D, 0x29, 0x12, 0x05, 0x65, 0x39, 0xE5,
-    0xE4, 0xE2, 0x76, 0x7F, 0xFC, 0x62, 0xFE, 0x72, 0x59, 0x2F, 0xF9, 0x32, 0x25, 0x59, 0x46, 0x54,
-    0x88, 0xCA, 0x10, 0x49, 0x94, 0x5D, 0x96, 0xF5, 0xAB, 0x53, 0xE8, 0xB4, 0x3A, 0x13, 0xBD, 0xE9,
-    0xEA, 0xE2, 0xB6, 0xBC, 0x6E, 0xEC, 0x0F, 0xE4, 0x63, 0xA7, 0x5D, 0x2E, 0xA2, 0x1A, 0x4D, 0xF8,
-    0x70, 0x32, 0xCA, 0x87, 0xE7, 0xAC, 0xAB, 0x6A, 0xFC, 0x6C, 0xEB, 0x78, 0xB4, 0xB5, 0xAC, 0xFE,
-    0xE4, 0xE4, 0xC3, 0xC9, 0xBD, 0x79, 0x05, 0xC1, 0x17, 0x45, 0x26, 0xDB, 0xDB, 0x43, 0xD0, 0x5D,
-    0x0B, 0xC9, 0x97, 0x1D, 0xA1, 0xBA, 0x8E, 0xE5, 0x86, 0x22, 0xDE, 0x72, 0xC3, 0x71, 0x51, 0x4A,
-    0x32, 0xED, 0x3E, 0x82, 0xA6, 0x6D, 0x65, 0x74, 0xA6, 0xB8, 0x89, 0xB9, 0x54, 0x0E, 0x9B, 0x50,
-    0xCD, 0x7B, 0x83, 0xC7, 0xDA, 0xE4, 0x83, 0x7C, 0x59, 0x06, 0x27, 0x2B, 0x22, 0x0B, 0x56, 0xB4,
-    0x41, 0x0B, 0x96, 0x7A, 0xA8, 0xE4, 0xFA, 0x22, 0x68, 0xE9, 0x00, 0x45, 0x54, 0x74, 0x10, 0x6E,
-    0x7B, 0x4D, 0xB6, 0x76, 0xE5, 0xCE, 0x72, 0xA5, 0x71, 0x36, 0x12, 0x47, 0xF5, 0x4B, 0x74, 0x50,
-    0x70, 0xDB, 0x79, 0xE8, 0xD7, 0xD4, 0x09, 0x34, 0x21, 0xA6, 0xEA, 0xF9, 0xCF, 0x0D, 0x54, 0xC4,
-    0xC8, 0x3D, 0xAB, 0xF1, 0x33, 0x4D, 0x39, 0xBF, 0xB1, 0x2A, 0xC3, 0xA9, 0x4B, 0xA1, 0x7C, 0x65,
-    0xE3, 0x39, 0x02, 0x4A, 0xF5, 0xA4, 0xC7, 0x4A, 0x4F, 0xB6, 0x48, 0x94, 0xEA, 0x0C, 0x08, 0x4B,
-    0xAD, 0x82, 0xA9, 0x2A, 0x5B, 0x3E, 0xEA, 0xBF, 0x68, 0xFC, 0x17, 0xA1, 0xBE, 0xF5, 0x08, 0xA9,
-    0x7E, 0x4F, 0xF6, 0xBE, 0x28, 0xF2, 0x25, 0xFF, 0xC7, 0x51, 0xA2, 0x86, 0xF1, 0xC7, 0x92, 0x4A,
-    0x86, 0x53, 0xDB, 0x4A, 0x2E, 0x8D, 0xB0, 0x1E, 0x9E, 0xED, 0x12, 0xF3, 0x0D, 0x08, 0x4C, 0x31,
-    0x13, 0x8B, 0x40, 0x25, 0x63, 0x09, 0x92, 0x7B, 0xF8, 0xB6, 0x6C, 0x9E, 0x7C, 0x43, 0x04, 0x47,
-    0x16, 0x4A, 0xAE, 0xE1, 0xAE, 0x4F, 0xB0, 0x06, 0x32, 0x83, 0xA2, 0xCB, 0x5B, 0xB9, 0x6C, 0x32,
-    0x50, 0x1C, 0xB1, 0xBC, 0xB6, 0xC6, 0x8D, 0xBB, 0x15, 0xEF, 0x8B, 0x21, 0x50, 0x4D, 0x34, 0x02,
-    0x04, 0x2E, 0xF6, 0x32, 0x56, 0x91, 0x66, 0xEC, 0xCF, 0xF7, 0xB1, 0xFE, 0x37, 0x20, 0xCB, 0xB3,
-    0x5C, 0x25, 0x72, 0xFB, 0xE0, 0x21, 0xA0, 0xAC, 0x7D, 0x80, 0x65, 0xB7, 0x00, 0xEB, 0xE6, 0x15,
-    0x1C, 0x97, 0x59, 0xAD, 0x31, 0xEE, 0x27, 0xCB, 0xF4, 0x2D, 0xD7, 0xC9, 0x2C, 0xAB, 0x0E, 0x22,
-    0xD4, 0xD1, 0xC6, 0x51, 0x83, 0x62, 0x1D, 0xDB, 0x6C, 0x88, 0x5D, 0x03, 0x55, 0xB2, 0xC1, 0x02,
-    0x2D, 0x28, 0x6B, 0x83, 0x49, 0x1E, 0x96, 0xD0, 0xF8, 0x13, 0xAF, 0xD5, 0xA8, 0x8A, 0x2F, 0x3E,
-    0xB9, 0xC8, 0x25, 0x77, 0x0D, 0x36, 0xA7, 0xD7, 0xF5, 0xA7, 0xC1, 0x2C, 0x3E, 0xF9, 0x0E, 0x6D,
-    0x2F, 0x16, 0x5B, 0xAE, 0xB1, 0x56, 0xC8, 0x70, 0xD3, 0x8E, 0x34, 0x01, 0x65, 0x06, 0x15, 0x2D,
-    0xF7, 0xCE, 0x04, 0x50, 0x61, 0x7F, 0x28, 0x79, 0x38, 0xFB, 0x35, 0xBE, 0xD3, 0x42, 0x8F, 0x75,
-    0x1C, 0xAE, 0xA1, 0x22, 0xFD, 0xEA, 0x20, 0xD3, 0x8A, 0x72, 0x02, 0x59, 0x97, 0xB1, 0xE0, 0xBE,
-    0xB8, 0xA4, 0x8A, 0x4A, 0x3C, 0x5F, 0x00, 0xDC, 0xC9, 0x29, 0xA1, 0x2A, 0xA2, 0x10, 0x1F, 0xE8,
-    0xAC, 0x8C, 0xB2, 0xA6, 0x52, 0xEA, 0xC5, 0x54, 0xD1, 0x85, 0x1A, 0x3C, 0xFE, 0x0E, 0x77, 0xC6,
-    0x32, 0xD0, 0xE0, 0xE3, 0x12, 0xB1, 0x53, 0x04, 0x40, 0x9D, 0xB4, 0x56, 0x84, 0x95, 0xC3, 0xFC,
-    0xD2, 0x68, 0xC9, 0xFD, 0x2B, 0xFE, 0xF5, 0x0C, 0x5F, 0xA7, 0x84, 0x7F, 0x75, 0xDE, 0xEC, 0xE0,
-    0x6E, 0xF1, 0xCC, 0xB9, 0x65, 0x7D, 0xAE, 0x60, 0x48, 0x2D, 0xD1, 0x57, 0xEE, 0x39, 0x24, 0x3C,
-    0xDB, 0xAA, 0xE6, 0x8B, 0x16, 0xF6, 0xA1, 0x68, 0x65, 0x63, 0xF2, 0x11, 0x82, 0x9A, 0x88, 0x82,
-    0xC3, 0x42, 0x6D, 0x44, 0xFE, 0xA8, 0xD4, 0xE5, 0x9F, 0x58, 0xE8, 0x78, 0x8E, 0x66, 0xAA, 0x90,
-    0x74, 0xCC, 0x7A, 0x2C, 0x91, 0x4C, 0xCB, 0x5E, 0xA7, 0x72, 0x2E, 0x3E, 0x75, 0xD5, 0xE0, 0x51,
-    0x87, 0x53, 0x93, 0xE3, 0xD1, 0x46, 0xEE, 0xD4, 0x55, 0x91, 0x31, 0xCF, 0x54, 0x42, 0xD9, 0x5C,
-    0x7C, 0xAC, 0xD3, 0xE9, 0x04, 0xB1, 0x13, 0xA0, 0xC4, 0x13, 0xEE, 0x63, 0x6C, 0x9F, 0x77, 0x18,
-    0x72, 0x0C, 0x33, 0x8B, 0x35, 0xAC, 0xC4, 0x54, 0xC0, 0x34, 0x44, 0x62, 0x72, 0x07, 0x1A, 0x22,
-    0x31, 0xC5, 0x0D, 0x75, 0x8A, 0xA8, 0x6A, 0x39, 0x7D, 0x00, 0x9B, 0xB0, 0x7F, 0x41, 0x11, 0x00,
-    0x52, 0xAE, 0x88, 0x77, 0x78, 0x57, 0x98, 0x64, 0xF3, 0x7B, 0x86, 0x23, 0xE3, 0x67, 0xB2, 0x45,
-    0xA6, 0xE4, 0xF2, 0x27, 0xBE, 0x25, 0xE3, 0xC9, 0x21, 0x3B, 0xB9, 0x8A, 0x91, 0xFC, 0xFE, 0x51,
-    0xAA, 0xCF, 0x58, 0x15, 0x67, 0xBD, 0xFB, 0x22, 0xB7, 0x7F, 0x12, 0x5A, 0xB3, 0xBA, 0x29, 0x1F,
-    0xA1, 0x67, 0x52, 0x79, 0x00, 0x5E, 0x7A, 0x00, 0xFD, 0xF5, 0xB4, 0x3E, 0x26, 0x6F, 0xC4, 0x35,
-    0x14, 0xF3, 0x23, 0x03, 0x33, 0xE9, 0xA1, 0xA5, 0xAE, 0xC7, 0x98, 0x57, 0x44, 0x76, 0x5F, 0x63,
-    0xEB, 0xF9, 0xB5, 0x43, 0x23, 0x1E, 0x5A, 0x5B, 0x5E, 0x5C, 0x61, 0xB5, 0x1A, 0x0A, 0x93, 0x0B,
-    0xA4, 0xAE, 0x83, 0x4E, 0xC1, 0x42, 0x94, 0x86, 0x8A, 0xDC, 0xD0, 0xA0, 0x28, 0x90, 0x86, 0x4A,
-    0xD9, 0xE0, 0xC6, 0x72, 0x03, 0x0B, 0x5F, 0x24, 0xB8, 0x22, 0xEA, 0x59, 0xA8, 0xF7, 0xE1, 0x3D,
-    0x14, 0xB9, 0xE9, 0x8A, 0x60, 0x4E, 0x6F, 0xBF, 0x12, 0x31, 0x87, 0xFA, 0x96, 0x71, 0x59, 0x6E,
-    0x06, 0x3E, 0xE2, 0x54, 0x95, 0x6D, 0x76, 0xF7, 0x1A, 0x4E, 0x59, 0x02, 0xC5, 0xD5, 0xD3, 0xEE,
-    0xE7, 0x94, 0x6D, 0xF9, 0x90, 0x00, 0x74, 0x9E, 0xFF, 0x8D, 0x0C, 0xBE, 0x8C, 0xE5, 0x9F, 0xB2,
-    0x01, 0xC6, 0xDA, 0xCD, 0x7A, 0x76, 0xB4, 0x91, 0xC5, 0x6D, 0x19, 0x46, 0x55, 0x27, 0x9F, 0xCE,
-    0x26, 0xBD, 0x23, 0xC6, 0xA2, 0x68, 0x56, 0x62, 0x2F, 0xF3, 0xBF, 0x94, 0x4B, 0xFC, 0x78, 0x8C,
-    0x64, 0x13, 0xA3, 0x39, 0xAF, 0xAD, 0xA0, 0x8C, 0xE2, 0xED, 0x31, 0xED, 0x64, 0x64, 0x63, 0xFE,
-    0xDA, 0x94, 0xCA, 0x12, 0x5D, 0x9B, 0x8A, 0x6B, 0xD8, 0xB3, 0xEC, 0x5D, 0x39, 0xBB, 0xC6, 0x3D,
-    0x3D, 0x3B, 0xD9, 0xCB, 0xB4, 0xCF, 0xC4, 0x64, 0x8A, 0x3E, 0x59, 0x09, 0xBC, 0x17, 0x73, 0xD2,
-    0xC9, 0xB0, 0xAA, 0x1A, 0x6A, 0xA4, 0xC3, 0xEE, 0x62, 0xE3, 0xE4, 0x12, 0x13, 0x80, 0x74, 0xCF,
-    0xE3, 0x98, 0x00, 0xC2, 0xFA, 0x79, 0xD3, 0xEC, 0xE1, 0x97, 0x8A, 0x0E, 0x08, 0x1A, 0xB0, 0x5E,
-    0xBA, 0x50, 0xFA, 0x0A, 0x88, 0x7B, 0xF3, 0xC0, 0x35, 0x2B, 0xE2, 0xE9, 0xB5, 0x0B, 0x76, 0xD4,
-    0xBF, 0x6E, 0x62, 0xA2, 0x0E, 0x59, 0xEB, 0x88, 0xDA, 0x5B, 0xF5, 0xBA, 0x2C, 0xA0, 0xBC, 0xD2,
-    0xBC, 0x01, 0xC6, 0x7C, 0xD6, 0x0D, 0x17, 0x38, 0x31, 0xD3, 0xBF, 0xA5, 0x7D, 0xF7, 0x4E, 0x33,
-    0x76, 0xE4, 0x03, 0xD9, 0x0A, 0xD1, 0xFF, 0xA2, 0x7A, 0x44, 0x14, 0xC4, 0x3D, 0xA0, 0x0F, 0x04,
-    0x19, 0xA4, 0xBA, 0x8F, 0x1C, 0x74, 0x71, 0x3A, 0xE2, 0x3A, 0x45, 0x47, 0x71, 0xBC, 0xEE, 0x20,
-    0x70, 0xD8, 0xA3, 0xBC, 0x57, 0x3F, 0x52, 0x7E, 0x9D, 0x38, 0x48, 0x5D, 0xD1, 0x27, 0x8E, 0xBA,
-    0x4D, 0x96, 0x67, 0xA2, 0xA2, 0x6C, 0xD5, 0xF3, 0xC7, 0x6B, 0x03, 0xE3, 0x30, 0x2C, 0x2C, 0x46,
-    0xE6, 0xBC, 0xA5, 0x50, 0x53, 0xA1, 0xDA, 0x5C, 0x8D, 0x85, 0x48, 0xD6, 0xB2, 0x4A, 0x04, 0xFF,
-    0xF8, 0x07, 0x54, 0xA0, 0xBE, 0xD6, 0x8A, 0xD5, 0x64, 0x41, 0x54, 0xA4, 0xD6, 0xF0, 0x9E, 0xB0,
-    0x26, 0xB1, 0xAE, 0xCF, 0xEC, 0x6D, 0xDC, 0xB2, 0x3E, 0x8A, 0xD6, 0x14, 0xC4, 0xC9, 0x44, 0x32,
-    0xB5, 0x13, 0x61, 0x7D, 0xBC, 0x57, 0x95, 0xBA, 0xFF, 0xCD, 0x03, 0xD1, 0x11, 0x45, 0x94, 0xAA,
-    0x6F, 0x8B, 0x4F, 0x2A, 0x08, 0xF2, 0x9A, 0x66, 0x17, 0x87, 0x55, 0xDD, 0x15, 0xB9, 0x3E, 0xF0,
-    0xC5, 0x46, 0xDF, 0x71, 0x57, 0x81, 0x77, 0xBC, 0x7A, 0xEE, 0x74, 0xAA, 0xD9, 0xDD, 0x0B, 0xDE,
-    0x78, 0xDD, 0xE7, 0x16, 0xF5, 0xE6, 0xFE, 0x77, 0x7E, 0x06, 0xD2, 0xA4, 0x0D, 0x78, 0xC2, 0xF3,
-    0x23, 0xCB, 0x35, 0x7F, 0x2A, 0xD2, 0x04, 0xBB, 0xD2, 0xC1, 0xE4, 0x5D, 0x87, 0x8F, 0x07, 0x95,
-    0xD0, 0xC3, 0xBB, 0x2B, 0x17, 0xC7, 0x53, 0xB9, 0x92, 0xE0, 0xBC, 0xEA, 0xFD, 0x78, 0x93, 0x2A,
-    0x90, 0x29, 0xC1, 0x55, 0xF5, 0x1F, 0x9F, 0xC3, 0xF8, 0xDC, 0x31, 0x1F, 0x2F, 0xBF, 0x86, 0x5E,
-    0xC2, 0x76, 0x37, 0x54, 0x0D, 0x79, 0x6D, 0x94, 0x05, 0x34, 0xD0, 0x2B, 0x4E, 0x93, 0xB1, 0x13,
-    0x29, 0x35, 0x3C, 0xAD, 0xAE, 0x17, 0x44, 0x5B, 0x34, 0xD5, 0x28, 0x9B, 0x54, 0x35, 0x02, 0x27,
-    0x60, 0x5F, 0x92, 0x49, 0x26, 0x2E, 0x36, 0x63, 0xC6, 0x74, 0x36, 0xF1, 0x84, 0xBF, 0xCA, 0x64,
-    0x82, 0xB3, 0x21, 0x57, 0x2D, 0x68, 0x31, 0xC6, 0x1C, 0x90, 0xA0, 0xEA, 0x53, 0x77, 0x66, 0x3E,
-    0x29, 0xEA, 0xC4, 0x6D, 0x35, 0x80, 0x53, 0xF0, 0xD1, 0x53, 0x2C, 0xE7, 0x32, 0x20, 0xC8, 0xE0,
-    0x37, 0xC0, 0xBC, 0xE1, 0xCF, 0x89, 0x73, 0x7E, 0x78, 0x91, 0x3F, 0x07, 0x72, 0x5C, 0x5A, 0xE0,
-    0x9D, 0x0C, 0x88, 0xD9, 0x28, 0xE0, 0x90, 0xCD, 0xC2, 0xFE, 0x67, 0x43, 0x45, 0x7A, 0x46, 0x89,
-    0x2C, 0x9E, 0xC6, 0xCC, 0xA9, 0x88, 0x70, 0x96, 0x8E, 0x1E, 0x75, 0xC5, 0xF5, 0x82, 0x72, 0xC6,
-    0x2B, 0x21, 0xD7, 0x3D, 0x6C, 0x55, 0x36, 0x62, 0xD7, 0xD2, 0x89, 0xB6, 0x6C, 0x8E, 0xA8, 0x9A,
-    0x21, 0x80, 0x31, 0x8F, 0x85, 0x92, 0x18, 0xBC, 0x3D, 0xAD, 0x5A, 0x36, 0x7E, 0x86, 0xC7, 0x35,
-    0x7E, 0x39, 0x8F, 0x2B, 0xFB, 0x62, 0x8F, 0x6B, 0xF2, 0xF6, 0xEC, 0x88, 0xC7, 0x25, 0x38, 0x0C,
-    0x7F, 0x2E, 0xBB, 0x20, 0xC3, 0xF4, 0x4E, 0xF5, 0x54, 0xE8, 0x01, 0xF1, 0x9B, 0xD9, 0x18, 0x0F,
-    0xDC, 0xBD, 0xBB, 0x2A, 0xE6, 0x9C, 0x97, 0xE2, 0x6D, 0xA8, 0x29, 0xA8, 0x66, 0x75, 0x04, 0x1C,
-    0xEE, 0xF6, 0x1D, 0xDE, 0x7F, 0x4D, 0x29, 0xB5, 0xF3, 0x77, 0xD4, 0xA3, 0xE8, 0xD6, 0x54, 0x64,
-    0x39, 0xED, 0xE9, 0x53, 0xFF, 0xED, 0xC8, 0x59, 0xF4, 0x84, 0xC8, 0x67, 0xE8, 0x84, 0x94, 0xFA,
-    0xC8, 0xD6, 0xAA, 0xD3, 0x54, 0x53, 0x55, 0xAD, 0xFE, 0x04, 0x1D, 0xDF, 0xEB, 0xA1, 0x80, 0xB2,
-    0x9B, 0xFD, 0x1A, 0xEE, 0xBF, 0x4D, 0x4D, 0x09, 0x2B, 0x31, 0xF9, 0xB7, 0x77, 0xAE, 0xB5, 0xFF,
-    0xB6, 0x9A, 0x06, 0xBD, 0x96, 0x5B, 0xAE, 0xA5, 0x6B, 0xEF, 0xDF, 0xF6, 0x1F, 0x8E, 0xC3, 0xAD,
-    0xA8, 0x80, 0xFD, 0xB5, 0xDC, 0xAE, 0x8C, 0x7A, 0xBD, 0x8D, 0xF3, 0xE0, 0x89, 0x27, 0x3F, 0x97,
-    0x96, 0x22, 0x4F, 0xDF, 0xA3, 0xD5, 0xDB, 0x72, 0x87, 0x97, 0x1B, 0x06, 0x2E, 0x94, 0x93, 0xD0,
-    0x77, 0xF1, 0x41, 0x6F, 0x3A, 0x3F, 0xFF, 0x83, 0x81, 0x3F, 0x2D, 0x76, 0x3E, 0xD8, 0x7E, 0xEE,
-    0x07, 0xBB, 0xE5, 0x83, 0x78, 0x17, 0xB2, 0xE2, 0xA7, 0xE1, 0x12, 0xFF, 0xF7, 0x65, 0xFF, 0x77,
-    0xE3, 0xFF, 0xF6, 0x5C, 0x76, 0xC0, 0x22, 0x91, 0xE7, 0x36, 0x56, 0x81, 0xC7, 0xA3, 0xF0, 0xE8,
-    0xD6, 0x66, 0x38, 0xAA, 0x89, 0xA3, 0xB9, 0xC4, 0xF7, 0x88, 0xCF, 0x4E, 0x5D, 0x3C, 0x76, 0xA7,
-    0xEF, 0x52, 0x09, 0xB9, 0x2B, 0xF7, 0x87, 0x05, 0x44, 0x83, 0x6C, 0x64, 0xF2, 0x16, 0xA4, 0x58,
-    0xE6, 0xAD, 0x0C, 0x09, 0xE2, 0xBC, 0x5F, 0xB9, 0x26, 0x05, 0xC5, 0x18, 0x71, 0x79, 0xF9, 0x52,
-    0xE1, 0x4E, 0x39, 0x2E, 0xA4, 0x5A, 0xA1, 0x6A, 0xE8, 0x86, 0xEA, 0xB4, 0x83, 0x4F, 0xE8, 0xA7,
-    0x6E, 0x56, 0x74, 0x96, 0x49, 0xE6, 0x7A, 0xBA, 0x31, 0xF1, 0x34, 0xA3, 0xFB, 0x5F, 0xC6, 0xBB,
-    0xFB, 0x25, 0x57, 0xC6, 0x51, 0x02, 0xE8, 0xBF, 0x29, 0x65, 0xD1, 0xF2, 0x12, 0x99, 0x20, 0x9F,
-    0x9A, 0xEE, 0x3C, 0xD7, 0x37, 0x72, 0xBA, 0xA3, 0x54, 0xC6, 0x18, 0xA8, 0x67, 0xEB, 0xDA, 0x8A,
-    0xEC, 0xE9, 0x98, 0xCC, 0x5C, 0xDE, 0x8D, 0xA5, 0x72, 0xE4, 0x25, 0x38, 0x70, 0xA0, 0x99, 0x0F,
-    0x78, 0x0E, 0xFC, 0x98, 0xBD, 0x0D, 0x08, 0xA4, 0xA7, 0x59, 0x2D, 0x06, 0x24, 0xA7, 0x01, 0xE1,
-    0xE8, 0x60, 0x4E, 0xF1, 0x75, 0xEB, 0xBD, 0xF5, 0x0E, 0x10, 0xB7, 0x86, 0x93, 0x77, 0xDA, 0x6D,
-    0xD2, 0x09, 0xE3, 0xE8, 0x39, 0x0E, 0x00, 0x8F, 0x58, 0x30, 0x79, 0xAF, 0x37, 0x97, 0x49, 0x30,
-    0x86, 0x40, 0xE2, 0x32, 0x44, 0x03, 0x66, 0x02, 0xDD, 0x5E, 0x59, 0x4D, 0x5D, 0xC5, 0x5F, 0x2C,
-    0xF3, 0x99, 0x3B, 0x5B, 0x07, 0x8A, 0x3F, 0x99, 0x97, 0x9D, 0xAE, 0x5A, 0x75, 0x35, 0x33, 0xEC,
-    0x51, 0x12, 0xC4, 0xBC, 0xF6, 0xFC, 0xB6, 0x46, 0x61, 0xD4, 0x3F, 0x75, 0xDC, 0xD9, 0xF2, 0x37,
-    0x60, 0x4D, 0xD2, 0x00, 0xDD, 0xE8, 0xB7, 0x81, 0xFE, 0x9D, 0x17, 0x4D, 0xBD, 0xD0, 0x63, 0x33,
-    0x34, 0x6D, 0x09, 0xA5, 0xB3, 0xA2, 0x15, 0xD6, 0xD5, 0xAA, 0xA9, 0xE1, 0x18, 0x05, 0x19, 0x39,
-    0x15, 0x1C, 0x42, 0x30, 0x14, 0x38, 0x45, 0x72, 0x4F, 0xA8, 0xC5, 0xBA, 0xC0, 0x04, 0xB0, 0x2F,
-    0x34, 0x9B, 0xE9, 0x74, 0x91, 0x96, 0x31, 0xE6, 0x9C, 0x00, 0xFD, 0x55, 0x16, 0x15, 0x8F, 0xC0,
-    0xB9, 0x39, 0x04, 0x97, 0x24, 0x0E, 0xC6, 0xA0, 0x8C, 0x3F, 0x16, 0x69, 0xC3, 0x0F, 0xE2, 0x8A,
-    0xA2, 0xC4, 0xE5, 0x1A, 0x54, 0xE0, 0x44, 0x35, 0xB2, 0xB8, 0x60, 0x11, 0x60, 0xD1, 0xE4, 0x00,
-    0x63, 0x2A, 0x2D, 0xB1, 0x16, 0x79, 0x92, 0x5A, 0x43, 0x1D, 0x34, 0xC2, 0xE1, 0x28, 0x9C, 0xD7,
-    0x93, 0x71, 0x55, 0xA1, 0x04, 0xA7, 0x12, 0xD8, 0x98, 0xDE, 0xC0, 0x2E, 0xF2, 0x1E, 0xF2, 0xAA,
-    0x64, 0x9B, 0xEA, 0x71, 0x25, 0xD4, 0x80, 0x9C, 0x81, 0x1E, 0x4B, 0x3D, 0x3C, 0xB4, 0xEA, 0x4E,
-    0x6D, 0x34, 0x97, 0xC6, 0x91, 0xC5, 0x80, 0x57, 0x9D, 0x12, 0x89, 0xE6, 0xE0, 0xAF, 0x61, 0x2E,
-    0x31, 0xF1, 0x96, 0x83, 0xC6, 0xD0, 0x13, 0xB5, 0x18, 0x8C, 0xA0, 0x14, 0x2A, 0xF3, 0xE6, 0x49,
-    0x6C, 0xCF, 0x9C, 0xCA, 0x8C, 0x66, 0xBB, 0x91, 0x3D, 0x14, 0xEF, 0xE8, 0xAF, 0x5C, 0x97, 0xC9,
-    0x5F, 0x35, 0x88, 0x24, 0xEA, 0x0A, 0x48, 0x73, 0x63, 0xE5, 0xE8, 0x40, 0xF3, 0x8D, 0x54, 0x23,
-    0x30, 0x4C, 0x25, 0x2E, 0x2A, 0x2B, 0x61, 0xC5, 0x1E, 0xDF, 0x86, 0x54, 0x81, 0xB4, 0x76, 0x1F,
-    0x09, 0x68, 0x9C, 0xF2, 0xDA, 0x9C, 0xD8, 0xEE, 0xE1, 0x49, 0x12, 0x2A, 0x30, 0x1C, 0x4A, 0x1C,
-    0xC9, 0x77, 0xE7, 0x2B, 0x1A, 0x49, 0x52, 0x7E, 0x81, 0x72, 0x6D, 0xC5, 0x72, 0xFC, 0x00, 0x47,
-    0x50, 0xB6, 0xA5, 0x90, 0x0B, 0x96, 0x6E, 0x80, 0xF9, 0x14, 0xF8, 0x08, 0x98, 0xC0, 0x43, 0xF3,
-    0x0C, 0x94, 0x65, 0x82, 0xF1, 0x93, 0xD4, 0xA9, 0x5A, 0x6C, 0x7A, 0x8D, 0xED, 0xB8, 0x85, 0x0D,
-    0x91, 0xAB, 0x33, 0x3E, 0x12, 0xD3, 0x92, 0xE9, 0x7A, 0x3F, 0x4C, 0xDE, 0xB5, 0x21, 0x71, 0x06,
-    0xE2, 0x4A, 0xB0, 0x8E, 0x95, 0x6B, 0xD1, 0x23, 0xAC, 0x1A, 0xD9, 0xC3, 0x11, 0xC7, 0xE0, 0x31,
-    0xC8, 0x44, 0xC1, 0xA3, 0x70, 0xC1, 0x76, 0x10, 0xAD, 0x33, 0x98, 0x38, 0x62, 0x1B, 0xA5, 0x6B,
-    0x2A, 0x00, 0x8E, 0x59, 0xBD, 0x02, 0x5C, 0x8B, 0x73, 0x5B, 0x7D, 0x57, 0x51, 0x41, 0xAA, 0x32,
-    0x3C, 0x98, 0x3F, 0x23, 0x80, 0x82, 0xD0, 0x8B, 0xB4, 0xAC, 0x44, 0x94, 0x12, 0x82, 0xD3, 0x91,
-    0xB4, 0x6F, 0x21, 0x87, 0x0B, 0xE7, 0x07, 0x7E, 0x28, 0x4C, 0xA8, 0xB1, 0x9F, 0x5C, 0x82, 0x31,
-    0x84, 0x10, 0x63, 0x4D, 0x64, 0xC0, 0xA7, 0x20, 0xFB, 0xE7, 0xB1, 0x85, 0x93, 0x2A, 0xC7, 0x04,
-    0x22, 0xF4, 0x2F, 0xAE, 0xBA, 0x70, 0x80, 0x88, 0xC4, 0x26, 0x6A, 0x84, 0xB5, 0x7B, 0x7C, 0x5E,
-    0xBB, 0xB9, 0x6A, 0xAD, 0xBB, 0x37, 0x67, 0xB2, 0x58, 0x37, 0x64, 0x19, 0x88, 0x9C, 0xFE, 0x12,
-    0xB6, 0x08, 0x76, 0xE8, 0x4D, 0x60, 0x79, 0xD8, 0x1F, 0xB8, 0x6F, 0xE2, 0x93, 0x24, 0xE2, 0xFD,
-    0xCA, 0xE1, 0xAD, 0x0E, 0x6D, 0x4F, 0xA5, 0x9A, 0x62, 0x36, 0x39, 0xCE, 0xBC, 0xEE, 0xD4, 0x77,
-    0x0D, 0x63, 0x4A, 0x50, 0xD0, 0x58, 0xA7, 0x44, 0x56, 0x40, 0x06, 0x6A, 0x5F, 0x83, 0xB8, 0xBB,
-    0x3A, 0x1F, 0xAA, 0x43, 0x37, 0xC2, 0x64, 0x23, 0x42, 0x18, 0xB9, 0xC3, 0x2B, 0x1C, 0x0E, 0xF4,
-    0x80, 0xEC, 0xC7, 0x89, 0x95, 0xFB, 0xE4, 0x12, 0xD6, 0x0F, 0xCA, 0xB0, 0x57, 0x5E, 0xE5, 0x94,
-    0x5E, 0x93, 0x5B, 0x20, 0x22, 0x87, 0x40, 0x86, 0x9C, 0x54, 0x68, 0xEC, 0x1C, 0x30, 0x40, 0x4E,
-    0x59, 0x22, 0x1F, 0xBD, 0x28, 0x2A, 0xF3, 0xB4, 0xFB, 0x10, 0xFB, 0x9F, 0xD3, 0x9F, 0x5A, 0xCB,
-    0x5E, 0x78, 0xEA, 0x4C, 0x3D, 0x29, 0x3A, 0x7B, 0x9E, 0xD0, 0x72, 0xCA, 0x21, 0x7A, 0xA8, 0x52,
-    0x28, 0xFA, 0x83, 0x9B, 0x35, 0xE4, 0x9E, 0x7A, 0x3B, 0xCD, 0xF0, 0xE4, 0x90, 0xF5, 0x22, 0x33,
-    0x72, 0xD4, 0xE0, 0x7C, 0x1E, 0xCA, 0x37, 0xE5, 0x70, 0x25, 0x50, 0x8B, 0x3D, 0x29, 0x07, 0x30,
-    0x43, 0xA2, 0x55, 0x6D, 0xB7, 0x52, 0x55, 0xF3, 0x90, 0xAC, 0xC1, 0x0B, 0xB8, 0x6E, 0x13, 0x73,
-    0x72, 0x6E, 0x5A, 0x7F, 0x00, 0x5F, 0x02, 0xBA, 0x07, 0x63, 0x81, 0xFC, 0x89, 0x8A, 0xB0, 0xF4,
-    0x77, 0x1A, 0x73, 0x41, 0x31, 0xA2, 0xFE, 0x57, 0x0C, 0xDF, 0x3B, 0x70, 0x7D, 0xA5, 0x8C, 0xE0,
-    0xA6, 0x82, 0x8B, 0x70, 0xC1, 0x2C, 0x46, 0xD1, 0x36, 0x50, 0xC0, 0xE0, 0x3F, 0x46, 0x1F, 0x4E,
-    0xE2, 0xB1, 0x49, 0x46, 0xA2, 0x39, 0x5A, 0x70, 0x20, 0x5F, 0x84, 0xCA, 0x7A, 0xFA, 0x4C, 0x8C,
-    0x95, 0xB9, 0x4D, 0x31, 0xC0, 0x5A, 0xB4, 0x99, 0xB3, 0x10, 0xCB, 0x4F, 0xE5, 0x42, 0xEE, 0x39,
-    0x19, 0x40, 0x5F, 0x6C, 0x30, 0x58, 0x59, 0xD2, 0xCD, 0x37, 0x9E, 0x37, 0xB6, 0xAC, 0x36, 0xAB,
-    0x39, 0xC2, 0xE9, 0x76, 0x80, 0x97, 0x32, 0xD2, 0xD5, 0x9F, 0x97, 0x7B, 0x91, 0x05, 0xB9, 0x2A,
-    0xC8, 0x0D, 0x90, 0x67, 0x6B, 0x10, 0xBD, 0x50, 0x2A, 0x0D, 0xC4, 0x5B, 0xEE, 0xC1, 0x21, 0x61,
-    0xD9, 0x57, 0xE0, 0xDD, 0x48, 0x8B, 0x88, 0xAA, 0x1C, 0x20, 0x23, 0x6D, 0x0A, 0x51, 0x71, 0x32,
-    0x88, 0xDB, 0x62, 0x53, 0xDD, 0x04, 0xC0, 0x78, 0x43, 0x10, 0xC7, 0x94, 0xB6, 0xBB, 0xE7, 0x9A,
-    0x7A, 0x90, 0x66, 0x26, 0x16, 0x69, 0xAC, 0xB1, 0x93, 0x02, 0x6B, 0x6B, 0x9C, 0xB6, 0x0E, 0xAE,
-    0xC8, 0xC4, 0x61, 0xA9, 0xAF, 0x48, 0x83, 0x0F, 0xE2, 0x03, 0x18, 0x39, 0x05, 0xC0, 0x26, 0xFB,
-    0x87, 0xED, 0xAE, 0x79, 0x86, 0xC1, 0x7F, 0xC3, 0x8B, 0x84, 0x15, 0x9E, 0x94, 0x78, 0x31, 0x3E,
-    0x7C, 0xD9, 0x2E, 0x9C, 0x1B, 0x3C, 0xF0, 0x97, 0x1D, 0x36, 0x06, 0xB7, 0x43, 0x3E, 0x80, 0xAD,
-    0x89, 0xF9, 0x44, 0xBC, 0x52, 0x44, 0xC3, 0xE2, 0x91, 0x90, 0x8C, 0x40, 0x6D, 0x03, 0xB0, 0xD4,
-    0x24, 0xCA, 0x72, 0x83, 0x08, 0x91, 0x79, 0x42, 0x93, 0x14, 0xB0, 0xFE, 0xE9, 0x74, 0x24, 0x8E,
-    0x20, 0x07, 0xA2, 0x86, 0x3B, 0x44, 0x77, 0x5B, 0x04, 0x54, 0x0E, 0xF5, 0x08, 0x1A, 0xCC, 0x82,
-    0x7E, 0x97, 0x45, 0x90, 0xAB, 0x4F, 0xE0, 0x4D, 0x8A, 0xDB, 0x4D, 0x71, 0xBB, 0x8B, 0xA7, 0x09,
-    0xAC, 0x89, 0x7D, 0xB3, 0x75, 0x45, 0x93, 0x0E, 0x73, 0xFE, 0x8E, 0xA8, 0xE8, 0xB3, 0x37, 0xC6,
-    0xAA, 0x4E, 0xBB, 0xD9, 0x3E, 0x21, 0x92, 0x9E, 0x0A, 0xBE, 0xDE, 0xE4, 0x9D, 0x1C, 0x18, 0x11,
-    0xBA, 0xD4, 0x5D, 0x93, 0x6F, 0x36, 0xAE, 0xCF, 0xBB, 0x78, 0x4C, 0x71, 0xB0, 0xAA, 0x1A, 0xB2,
-    0x11, 0xE6, 0x58, 0x73, 0xF3, 0x61, 0xCA, 0xE8, 0x2D, 0x97, 0x8C, 0xEC, 0x31, 0x3E, 0x8B, 0x17,
-    0x71, 0xF5, 0xE3, 0xC0, 0xC4, 0x37, 0x34, 0x9A, 0xE9, 0x7C, 0x40, 0xF3, 0x83, 0x83, 0xB9, 0xC2,
-    0x44, 0xD7, 0x6A, 0x95, 0xF4, 0x3B, 0xD4, 0x8B, 0xB6, 0xA1, 0xAE, 0xF8, 0x36, 0xE9, 0x8C, 0x56,
-    0x31, 0x57, 0x41, 0x85, 0xF3, 0x17, 0xAE, 0xC9, 0x46, 0xC4, 0x34, 0x5B, 0x0F, 0x49, 0x20, 0xDF,
-    0x1D, 0xBC, 0xA1, 0xCB, 0x60, 0x4F, 0x88, 0x18, 0x15, 0x29, 0x34, 0x0C, 0x88, 0x22, 0x00, 0xF9,
-    0xB2, 0xA0, 0x2E, 0x47, 0x02, 0x89, 0xBA, 0xFC, 0x83, 0x25, 0xCB, 0xE2, 0x49, 0x13, 0x8D, 0x39,
-    0xE8, 0x23, 0x30, 0xA3, 0x57, 0xB1, 0x64, 0x77, 0x61, 0x0F, 0x44, 0xC8, 0x8B, 0x61, 0xAD, 0x26,
-    0x93, 0x3C, 0x00, 0x64, 0x7D, 0x83, 0xAD, 0xFD, 0x42, 0xA9, 0xF4, 0x0C, 0x9A, 0x98, 0x8D, 0xD2,
-    0xAC, 0x71, 0x6D, 0xE3, 0x0A, 0x65, 0x48, 0xA0, 0x28, 0xFF, 0x18, 0x03, 0x29, 0x61, 0x6B, 0x37,
-    0x01, 0xFE, 0x81, 0x72, 0xAA, 0x89, 0xDD, 0x93, 0x9D, 0x98, 0xE8, 0x96, 0x7E, 0x98, 0x49, 0x3F,
-    0xDC, 0xF3, 0x48, 0xCD, 0x80, 0x88, 0x30, 0xD5, 0xDB, 0x20, 0x81, 0xFB, 0x13, 0xDE, 0x7F, 0x3D,
-    0x0A, 0x40, 0x8F, 0x52, 0x05, 0xC6, 0xFC, 0x0E, 0xDC, 0x38, 0x28, 0x8F, 0xD9, 0xD0, 0x4C, 0x7C,
-    0xF8, 0x4A, 0x0C, 0x41, 0x9E, 0x4C, 0x88, 0x1D, 0x18, 0x25, 0x7F, 0xF6, 0xFF, 0x13, 0xBD, 0x5D,
-    0x66, 0xEE, 0x6A, 0xED, 0x8D, 0x44, 0x4D, 0x1D, 0xA2, 0x1E, 0xF4, 0x93, 0x98, 0x5F, 0xF1, 0x9A,
-    0x6B, 0x74, 0xF5, 0x44, 0xB7, 0x36, 0xF1, 0xA1, 0x73, 0xBA, 0x84, 0x0E, 0x74, 0xA6, 0x15, 0x77,
-    0x17, 0x8C, 0xB8, 0x68, 0xA4, 0x3A, 0xEF, 0x18, 0xD9, 0x49, 0x55, 0x71, 0xF8, 0x75, 0x33, 0x7A,
-    0x70, 0xA9, 0x57, 0xB6, 0xCB, 0xAA, 0x2B, 0xA8, 0xE8, 0x33, 0xEB, 0x97, 0xCF, 0x34, 0xFE, 0x33,
-    0xD9, 0xF2, 0x19, 0x3A, 0x8D, 0x8B, 0x04, 0xAE, 0x14, 0xFA, 0x4F, 0xD4, 0xD4, 0x1D, 0xD7, 0xB1,
-    0xA4, 0x93, 0x0E, 0xE8, 0x85, 0xFC, 0x88, 0x99, 0x8C, 0xE6, 0xE0, 0x39, 0x2E, 0x80, 0x8F, 0x37,
-    0x48, 0x10, 0x40, 0x8A, 0xE3, 0x49, 0x19, 0x7D, 0x52, 0xEC, 0xCA, 0x9D, 0xCF, 0x5C, 0xBC, 0x4E,
-    0xE1, 0x5E, 0x20, 0xE2, 0xD5, 0x1F, 0x88, 0xD5, 0x73, 0x66, 0x6A, 0x95, 0xC6, 0xEC, 0x88, 0x6C,
-    0xC9, 0x42, 0xB8, 0x69, 0x61, 0x6E, 0x4C, 0x48, 0x51, 0x59, 0xEF, 0x84, 0xFD, 0x78, 0x66, 0x08,
-    0xE2, 0x3D, 0xF3, 0x40, 0x59, 0x21, 0x2A, 0x3D, 0x09, 0x01, 0x55, 0x66, 0x96, 0xB4, 0xD9, 0x4A,
-    0xF6, 0xDC, 0x0E, 0xE2, 0x88, 0x0F, 0x90, 0xEE, 0xA2, 0xB1, 0xEF, 0x38, 0x70, 0x93, 0x3F, 0x18,
-    0xA0, 0x7E, 0xE5, 0xF4, 0x75, 0xD9, 0x3D, 0x10, 0xD4, 0xF6, 0xBD, 0x11, 0x52, 0x29, 0x3F, 0x0A,
-    0x50, 0xB4, 0xAD, 0xE8, 0xAF, 0xB7, 0xDC, 0xF5, 0x19, 0x87, 0xF4, 0xB6, 0x1C, 0x97, 0xD8, 0xF9,
-    0xB8, 0x99, 0x43, 0x5E, 0x88, 0x1B, 0x96, 0x68, 0x14, 0x61, 0x5D, 0x4C, 0x26, 0x20, 0xEF, 0xB6,
-    0x8E, 0xF3, 0xBC, 0x75, 0x9C, 0xAB, 0x66, 0x4B, 0x92, 0xCC, 0xD0, 0x68, 0x45, 0x97, 0x82, 0x7B,
-    0x7B, 0x8C, 0x9C, 0x33, 0x89, 0xE1, 0x37, 0xA7, 0x40, 0xCB, 0x93, 0x47, 0x88, 0x3C, 0xCF, 0xB2,
-    0x2C, 0x9D, 0xD3, 0x6C, 0x9B, 0x01, 0x76, 0xC8, 0x82, 0x76, 0x7E, 0x1D, 0x10, 0x16, 0xA7, 0x33,
-    0x15, 0xA9, 0x2E, 0xD7, 0xC0, 0x2F, 0xA0, 0xAC, 0x5C, 0xF3, 0x37, 0x64, 0x72, 0x3A, 0x98, 0x9C,
-    0x51, 0x4C, 0x0E, 0xF8, 0xAD, 0xEF, 0xCB, 0xE2, 0xF4, 0x72, 0x91, 0x87, 0x94, 0x44, 0x41, 0x0C,
-    0x81, 0xF3, 0xA3, 0x5B, 0xA2, 0xC9, 0x43, 0x30, 0x21, 0x37, 0x1C, 0x91, 0x46, 0x32, 0xE1, 0xC6,
-    0x10, 0xAF, 0x37, 0x26, 0x63, 0x7F, 0x24, 0x0A, 0xA9, 0xB7, 0x8D, 0x40, 0xC1, 0xD9, 0x3A, 0x2C,
-    0x5F, 0xED, 0x9C, 0x6D, 0x53, 0x77, 0xB1, 0x37, 0xE7, 0xB1, 0x71, 0xD1, 0x02, 0x96, 0x5A, 0x3D,
-    0x3A, 0x3B, 0xDA, 0x98, 0xEA, 0xD0, 0x36, 0x94, 0x4F, 0xD9, 0x96, 0x5E, 0x8D, 0x15, 0x94, 0x84,
-    0x8E, 0x3B, 0x60, 0x4F, 0x19, 0x91, 0xFF, 0x4C, 0xBE, 0x7C, 0xC6, 0xEA, 0x67, 0xA0, 0x4D, 0x4A,
-    0xAF, 0x56, 0x45, 0x2F, 0x38, 0xFA, 0x64, 0x11, 0x67, 0x29, 0x6F, 0x77, 0x85, 0xD8, 0xB7, 0x5B,
-    0x4E, 0xAD, 0xEB, 0x4F, 0x1C, 0x28, 0x70, 0xD7, 0x17, 0x6A, 0x62, 0x63, 0x77, 0x66, 0xC0, 0x11,
-    0x7D, 0x68, 0xC7, 0x34, 0xFC, 0x3C, 0x07, 0x34, 0xEA, 0x80, 0x9C, 0x1F, 0xD0, 0xA8, 0x03, 0x72,
-    0x1C, 0x10, 0x37, 0x20, 0xC6, 0xF1, 0xE3, 0x80, 0x3C, 0x95, 0xE5, 0x19, 0xB7, 0x70, 0x78, 0xBD,
-    0x7F, 0xE1, 0x93, 0xB9, 0x00, 0x50, 0x80, 0xB5, 0x95, 0xB1, 0x7A, 0xCA, 0xEE, 0xB9, 0x8B, 0xC5,
-    0xBD, 0x99, 0x94, 0x2D, 0x9D, 0x2E, 0x51, 0x8C, 0x82, 0x2D, 0x61, 0x26, 0x08, 0xF2, 0x55, 0x74,
-    0xA0, 0x23, 0x6C, 0x7B, 0x89, 0x39, 0x5B, 0x35, 0xB1, 0xE9, 0x4A, 0x23, 0x5D, 0x3B, 0x46, 0x9F,
-    0xD1, 0x93, 0x99, 0xCB, 0x42, 0xA6, 0x0B, 0x24, 0x8F, 0x27, 0x85, 0x54, 0xA6, 0x0C, 0xE4, 0xEF,
-    0xF6, 0x07, 0x58, 0x06, 0x9C, 0xA0, 0x99, 0x9E, 0x96, 0x28, 0xA0, 0xD9, 0x4E, 0xC9, 0xC8, 0x1B,
-    0x28, 0x76, 0xA7, 0x36, 0xAB, 0xDE, 0x42, 0xF2, 0x0D, 0xB8, 0x73, 0x9C, 0x8C, 0xEB, 0x8C, 0x73,
-    0xD3, 0x61, 0x16, 0x57, 0x04, 0xB1, 0xF2, 0x99, 0x12, 0x72, 0x7E, 0x67, 0x2F, 0x54, 0x09, 0xE0,
-    0x8C, 0x25, 0xD3, 0xAE, 0x20, 0xDD, 0x23, 0x44, 0xEF, 0x61, 0x25, 0xCF, 0xB8, 0x03, 0xD7, 0xE2,
-    0x70, 0x54, 0x5E, 0x24, 0x5F, 0x67, 0x8A, 0x60, 0x53, 0xF5, 0x85, 0x22, 0xBC, 0x61, 0x0B, 0x52,
-    0x4F, 0x9D, 0x33, 0x8F, 0xC8, 0xCF, 0x15, 0x23, 0xFF, 0xC3, 0xFA, 0x0F, 0x09, 0x55, 0x1A, 0xAE,
-    0x1A, 0xDC, 0x0B, 0x7E, 0x5C, 0x90, 0x98, 0x2B, 0x9F, 0xBA, 0xAA, 0x81, 0x1B, 0xF0, 0xB7, 0xE2,
-    0x36, 0xBC, 0x4C, 0xC8, 0xB7, 0xA2, 0x49, 0x9D, 0x4C, 0x90, 0x97, 0x87, 0x4B, 0x12, 0x73, 0xAE,
-    0x55, 0x0F, 0x13, 0x94, 0x91, 0x0C, 0xAA, 0x25, 0xCA, 0xC5, 0x29, 0x4C, 0x27, 0x9C, 0x35, 0x99,
-    0x20, 0x30, 0xCC, 0x5F, 0xE0, 0x94, 0xC6, 0x24, 0xB1, 0xB9, 0x54, 0x50, 0xD6, 0x88, 0x63, 0x88,
-    0x44, 0xBC, 0x3C, 0x53, 0x9F, 0xAB, 0xA1, 0x6C, 0x8B, 0x16, 0xAB, 0x08, 0xA3, 0xDA, 0xE1, 0xB2,
-    0xB7, 0x70, 0x89, 0x88, 0x2A, 0x6E, 0x03, 0x8F, 0x27, 0x06, 0x90, 0xEA, 0x77, 0xBC, 0x4C, 0xA8,
-    0x44, 0x0B, 0x96, 0xC2, 0xFB, 0x2D, 0xA2, 0x08, 0xEE, 0x5E, 0x44, 0x4E, 0x81, 0xC7, 0x19, 0x46,
-    0x9D, 0x57, 0xA8, 0x03, 0x12, 0xDC, 0x29, 0x5E, 0xE8, 0x6F, 0x64, 0x93, 0x45, 0x26, 0x14, 0x3C,
-    0x88, 0x86, 0x71, 0x26, 0xD8, 0x4E, 0xC0, 0x12, 0xB8, 0xC1, 0x24, 0x63, 0x99, 0x58, 0x49, 0x0D,
-    0x0C, 0xBD, 0xC7, 0x94, 0xCA, 0x02, 0xD9, 0x81, 0x9E, 0x0A, 0x5A, 0xBD, 0xA0, 0x0C, 0x73, 0xAE,
-    0x29, 0x0B, 0x9D, 0x80, 0xC6, 0x11, 0x63, 0x96, 0xBD, 0xC2, 0xEE, 0xDA, 0xF7, 0x65, 0xF4, 0xE0,
-    0xCE, 0xB1, 0x13, 0xA2, 0x0F, 0x6E, 0x96, 0xBA, 0x81, 0x0D, 0x8D, 0xE5, 0x43, 0xB1, 0xFB, 0xE1,
-    0xAB, 0xC6, 0xA7, 0x80, 0x34, 0xEA, 0x3B, 0x63, 0x46, 0x49, 0xFD, 0x8A, 0x49, 0x86, 0x6A, 0xB3,
-    0x9E, 0x73, 0x81, 0x7C, 0x4F, 0xF4, 0x62, 0x3B, 0x9F, 0xF4, 0xBE, 0xE5, 0x15, 0xF8, 0x77, 0x35,
-    0xD9, 0x6A, 0x88, 0x99, 0x60, 0xE4, 0x0E, 0x70, 0x10, 0xE2, 0x84, 0xDB, 0x3E, 0x2B, 0x16, 0xF5,
-    0x35, 0x4F, 0x58, 0x89, 0x7F, 0xFB, 0x92, 0x51, 0xF9, 0x2C, 0x19, 0x13, 0x38, 0x97, 0xB9, 0x6F,
-    0xC1, 0x1B, 0x42, 0x04, 0x12, 0xDA, 0x14, 0x08, 0xFA, 0x5C, 0xA0, 0x20, 0x02, 0xF7, 0x2E, 0x6E,
-    0xC4, 0x01, 0xD6, 0x86, 0xF4, 0x4C, 0x6B, 0x5E, 0x96, 0x9F, 0x02, 0x7B, 0x24, 0xE0, 0xC7, 0xC1,
-    0x7C, 0xDF, 0xD3, 0xB0, 0xB0, 0x82, 0x9F, 0x54, 0xC1, 0x0F, 0xCE, 0x80, 0xAC, 0x74, 0x32, 0x07,
-    0x6D, 0xE0, 0x31, 0x76, 0xDE, 0xD1, 0x02, 0xDB, 0x26, 0x9A, 0x77, 0xCE, 0x1D, 0x55, 0xF6, 0x46,
-    0x19, 0x9E, 0xD6, 0x2F, 0x2F, 0x7F, 0xB2, 0x04, 0xCE, 0x1B, 0x35, 0x0D, 0x29, 0x8F, 0x98, 0x42,
-    0xE3, 0x83, 0x2B, 0xFA, 0x4F, 0x3A, 0x4B, 0xCC, 0xC7, 0x6C, 0x76, 0x72, 0x5B, 0x7F, 0x89, 0xCB,
-    0xC2, 0x8D, 0x05, 0xB9, 0x22, 0xFE, 0xD7, 0x15, 0xBB, 0x9B, 0x72, 0x78, 0x69, 0x06, 0x79, 0x80,
-    0xB7, 0x3A, 0xFA, 0xA7, 0xA9, 0x40, 0xBA, 0x35, 0xC3, 0xE1, 0xBD, 0x77, 0x50, 0xF3, 0xE9, 0x3B,
-    0x9D, 0x32, 0x5D, 0x9A, 0xD3, 0x2B, 0xBF, 0x3F, 0x51, 0xDE, 0x8F, 0x84, 0xD6, 0x47, 0x91, 0x90,
-    0x2C, 0x64, 0xAE, 0xCE, 0x34, 0x82, 0x54, 0x5B, 0x34, 0xB4, 0x83, 0x84, 0xE2, 0x5D, 0x24, 0x74,
-    0xE2, 0x4F, 0xE0, 0x1E, 0x20, 0xC5, 0xE5, 0x69, 0xB9, 0x5C, 0x3A, 0x9F, 0x6C, 0x0B, 0x3D, 0x80,
-    0x11, 0xBD, 0x87, 0x5E, 0x6E, 0x36, 0xF0, 0xEF, 0xB5, 0xEB, 0x68, 0xE7, 0x23, 0xF7, 0x0F, 0x10,
-    0x17, 0xF8, 0x23, 0xF2, 0xD7, 0x67, 0x18, 0x53, 0x98, 0xF5, 0x24, 0xCB, 0xE5, 0x2A, 0x88, 0x2C,
-    0xC2, 0x7C, 0xDD, 0xA2, 0xB2, 0xB6, 0xE9, 0xA4, 0xEB, 0x2F, 0xCE, 0x34, 0xA5, 0xAE, 0x7C, 0xF0,
-    0x01, 0x53, 0x64, 0x75, 0xF6, 0x6E, 0x97, 0xDC, 0x19, 0x57, 0xE3, 0x6C, 0x1E, 0xFA, 0x85, 0x1D,
-    0xE5, 0xA3, 0x41, 0x43, 0x0D, 0x2F, 0x1E, 0xF7, 0xB3, 0x88, 0x4D, 0x7E, 0xF4, 0x67, 0xDD, 0x95,
-    0x73, 0x9A, 0x49, 0xCE, 0x95, 0x9A, 0x54, 0x8D, 0xAF, 0xCE, 0x99, 0x3D, 0xC5, 0xCA, 0xEC, 0x87,
-    0xD6, 0xF8, 0xE4, 0x14, 0xE3, 0x13, 0x57, 0xA8, 0x8B, 0x20, 0x8A, 0x3E, 0x5B, 0x85, 0xFF, 0xC5,
-    0xB3, 0xEA, 0x3F, 0x86, 0x19, 0xC6, 0xAD, 0x43, 0x1A, 0x60, 0x28, 0x48, 0x08, 0x04, 0x8E, 0xB9,
-    0xD4, 0x1B, 0x63, 0xC1, 0xA3, 0x7D, 0xB0, 0x6B, 0xD3, 0x3C, 0x3F, 0xA7, 0x1C, 0x6E, 0xAE, 0x3E,
-    0x76, 0x3A, 0x5F, 0x25, 0x6E, 0x9B, 0x57, 0x9A, 0x2A, 0x50, 0x32, 0x7D, 0xC9, 0xD6, 0x34, 0x1C,
-    0xA2, 0x7B, 0xE8, 0x02, 0x0C, 0x31, 0x95, 0x94, 0x6C, 0xFD, 0x4D, 0xE8, 0x3E, 0xAF, 0x50, 0x36,
-    0xB4, 0x70, 0x04, 0x8C, 0xB6, 0x56, 0x5F, 0xE4, 0x0E, 0x7C, 0xAE, 0xB6, 0x1A, 0x7C, 0xBA, 0x50,
-    0xC1, 0xD4, 0xA7, 0x11, 0x73, 0x87, 0x38, 0x61, 0xEA, 0xA7, 0x76, 0x9D, 0x55, 0xB5, 0x2C, 0xDC,
-    0x01, 0xE6, 0x23, 0x19, 0x3A, 0x35, 0x46, 0xD1, 0x3C, 0x99, 0x3B, 0x8A, 0xFA, 0x4D, 0x3B, 0xBF,
-    0x44, 0x40, 0xE6, 0x13, 0xA3, 0x1C, 0x95, 0xA6, 0xFC, 0xA1, 0xE7, 0x93, 0x4E, 0x70, 0x21, 0xCB,
-    0x7C, 0xA0, 0xFF, 0x63, 0xDF, 0x06, 0x4E, 0x86, 0x26, 0x30, 0x55, 0x5F, 0x8D, 0x34, 0x2B, 0x02,
-    0xEF, 0x36, 0xB0, 0x2E, 0xB8, 0x83, 0x27, 0xE7, 0x20, 0xD8, 0x7F, 0x83, 0x67, 0x3E, 0xFE, 0x6B,
-    0x9F, 0x79, 0xF3, 0xF0, 0x8B, 0x7B, 0x19, 0x3C, 0x34, 0xF1, 0x2C, 0x3B, 0x88, 0xF6, 0xB3, 0x35,
-    0xE0, 0xFA, 0x71, 0x23, 0x10, 0x5B, 0x41, 0xEA, 0x1A, 0x63, 0xDE, 0xD0, 0x67, 0x0E, 0x19, 0x39,
-    0xC5, 0xA7, 0x9A, 0x45, 0x5B, 0xEF, 0x11, 0xED, 0xB7, 0x91, 0xC9, 0xF4, 0x3E, 0x73, 0x1C, 0xE4,
-    0x78, 0x27, 0x13, 0xC3, 0xCF, 0x1A, 0x0E, 0xCA, 0x35, 0x3D, 0xD7, 0x67, 0x3F, 0x98, 0xF5, 0x4B,
-    0xE1, 0xE6, 0xC4, 0x78, 0x29, 0x03, 0x32, 0xCC, 0xDE, 0xD9, 0xFC, 0x2D, 0xF1, 0x0A, 0x4F, 0x99,
-    0x47, 0xC5, 0xED, 0x13, 0x4F, 0x5B, 0xE6, 0x3F, 0x64, 0x8C, 0x38, 0x33, 0xA8, 0x46, 0xF3, 0x76,
-    0xF2, 0xEE, 0x7E, 0xEC, 0x11, 0x11, 0x99, 0xBD, 0x18, 0x68, 0xC2, 0x18, 0x68, 0x06, 0x1F, 0x50,
-    0x06, 0x84, 0x1D, 0x63, 0xEA, 0x6E, 0x34, 0xEB, 0x49, 0x81, 0x6A, 0xCD, 0x7F, 0x0C, 0x1D, 0x68,
-    0xDF, 0x1C, 0x20, 0xDF, 0x15, 0xD3, 0xB2, 0x88, 0x69, 0x3F, 0x2F, 0x28, 0xCA, 0xAD, 0x57, 0xE6,
-    0x9B, 0x19, 0x4B, 0x2B, 0x47, 0x5D, 0xAA, 0x3E, 0x8F, 0x52, 0x51, 0xA5, 0x37, 0x62, 0x3F, 0x7F,
-    0xEE, 0x07, 0x65, 0x1F, 0x2B, 0x17, 0xF6, 0xA9, 0x08, 0xB5, 0x0D, 0xEB, 0x17, 0xD5, 0xF1, 0x00,
-    0x93, 0xD2, 0x5A, 0x72, 0xD0, 0x62, 0xF8, 0x36, 0xC8, 0x58, 0x06, 0xD7, 0x29, 0xEF, 0xE4, 0xD8,
-    0x7D, 0x86, 0xA8, 0x7C, 0xD4, 0x2A, 0x44, 0xD0, 0x42, 0xE8, 0x87, 0x79, 0x36, 0xA4, 0x54, 0x53,
-    0xA7, 0x8E, 0xB4, 0x55, 0xB8, 0x20, 0x00, 0x55, 0xED, 0x18, 0x89, 0x1A, 0x40, 0x79, 0xC6, 0xCC,
-    0x12, 0x37, 0x32, 0x37, 0xB4, 0xB8, 0xDD, 0x43, 0xCB, 0xFD, 0x64, 0xAA, 0xDE, 0xC1, 0xBA, 0xDF,
-    0xFE, 0xD8, 0x5D, 0xA5, 0x23, 0x76, 0x59, 0x65, 0x70, 0x4C, 0x35, 0x71, 0xA6, 0x25, 0xE4, 0xCA,
-    0x35, 0xE5, 0xDB, 0x54, 0x72, 0x69, 0x0D, 0x78, 0x6F, 0xBD, 0x3D, 0x68, 0x1C, 0xA2, 0xB5, 0x09,
-    0x2A, 0x79, 0xCE, 0x3B, 0x52, 0x21, 0xC8, 0x4C, 0xC3, 0x5C, 0xE0, 0xF8, 0xCE, 0x09, 0x19, 0xC4,
-    0x3E, 0xEF, 0xC8, 0xC7, 0x8B, 0xA6, 0x11, 0xE7, 0x0D, 0x07, 0x80, 0x46, 0x3F, 0x73, 0xD7, 0xE0,
-    0xF3, 0x3A, 0x9C, 0xF7, 0xE2, 0xDD, 0x7B, 0x93, 0x6C, 0xAF, 0xB3, 0x6F, 0xDE, 0x83, 0xD3, 0x35,
-    0xE5, 0x44, 0x38, 0x2D, 0xCC, 0x0E, 0xE2, 0x34, 0xA4, 0xEE, 0x10, 0x86, 0x65, 0xE2, 0x5B, 0xD0,
-    0xBF, 0x21, 0x75, 0x7F, 0x2D, 0xE7, 0x7F, 0x53, 0x91, 0x06, 0xA5, 0xE7, 0xE2, 0x86, 0x9D, 0x94,
-    0xFC, 0xC3, 0x17, 0x4C, 0xE4, 0x83, 0x4B, 0x2C, 0x6B, 0x28, 0xED, 0x87, 0x76, 0x84, 0xE2, 0x42,
-    0x68, 0x65, 0xC4, 0xF8, 0x5F, 0xC3, 0xA6, 0x63, 0x35, 0xAF, 0xCB, 0x9D, 0x00, 0x74, 0xD4, 0x03,
-    0xB2, 0x44, 0x3C, 0x1A, 0x66, 0xF9, 0xB7, 0x2C, 0x29, 0x62, 0x48, 0x25, 0xFD, 0x31, 0x25, 0xB0,
-    0xB8, 0xED, 0x58, 0x4E, 0x30, 0x59, 0xC6, 0xCE, 0x37, 0xD0, 0xFF, 0xF9, 0xC8, 0x5B, 0xBA, 0xC6,
-    0x23, 0x5D, 0xC0, 0x14, 0x4D, 0xC6, 0x2F, 0x2D, 0xE9, 0x0C, 0xA8, 0x93, 0xBB, 0x17, 0x27, 0x8A,
-    0x5B, 0x36, 0x20, 0x05, 0x09, 0x80, 0xBA, 0x4C, 0xE4, 0x7B, 0x4F, 0x20, 0x41, 0x2E, 0x87, 0xCE,
-    0x03, 0x31, 0x4B, 0x33, 0x80, 0xFC, 0x75, 0x19, 0xF6, 0xA2, 0xF3, 0x96, 0x73, 0xD4, 0x8A, 0xF3,
-    0x3C, 0x69, 0x26, 0xBD, 0xD3, 0xA8, 0x20, 0x41, 0x11, 0x43, 0x2C, 0x1D, 0x29, 0xDB, 0x4D, 0x06,
-    0xA0, 0x26, 0x3F, 0x3C, 0x00, 0xFD, 0xE5, 0xD4, 0x97, 0x67, 0x70, 0x07, 0x2A, 0x60, 0xC3, 0x93,
-    0x71, 0x71, 0xBE, 0x70, 0xC1, 0x68, 0xBC, 0x5F, 0x1D, 0x71, 0x60, 0xB8, 0xC4, 0x07, 0xE9, 0x8B,
-    0x43, 0x3B, 0x1F, 0xBC, 0x48, 0x92, 0x96, 0x1C, 0xC0, 0xAC, 0xDB, 0x4E, 0x26, 0x8E, 0x8A, 0x8D,
-    0xB8, 0x06, 0x3A, 0xDC, 0x67, 0x64, 0xB8, 0x7E, 0xF5, 0xA7, 0x0C, 0xED, 0x31, 0x7B, 0xA0, 0x0C,
-    0x09, 0xF6, 0x0A, 0xD7, 0x60, 0xDC, 0x7C, 0xBC, 0x2A, 0x54, 0xB1, 0x9C, 0xFC, 0x03, 0x86, 0x65,
-    0x61, 0x73, 0x6A, 0xB2, 0xD8, 0xC0, 0xDF, 0x60, 0xC7, 0xAA, 0xF9, 0x12, 0x6E, 0x33, 0x63, 0xFF,
-    0x56, 0x6A, 0x49, 0x14, 0xE5, 0x84, 0x5C, 0x7B, 0xC0, 0x23, 0x1D, 0xAC, 0x60, 0xF4, 0x0F, 0xCF,
-    0x1B, 0x1E, 0x58, 0xA8, 0x0E, 0x6C, 0x41, 0x26, 0xF8, 0xC2, 0x3C, 0x04, 0x53, 0x84, 0x00, 0x09,
-    0x56, 0x64, 0xD0, 0x50, 0x20, 0x4A, 0x06, 0x28, 0xD1, 0x61, 0x2D, 0x59, 0x7C, 0xA4, 0x38, 0x3C,
-    0xE5, 0xEF, 0x69, 0x5D, 0xE2, 0xD9, 0x31, 0x51, 0x92, 0x7B, 0x7B, 0x96, 0xE6, 0x0C, 0xB9, 0xEC,
-    0x55, 0x43, 0x7B, 0x0E, 0xF8, 0xCC, 0x4C, 0x4D, 0xE5, 0x39, 0x93, 0x25, 0xE7, 0x08, 0xE9, 0x07,
-    0x1F, 0x91, 0xC2, 0x97, 0xEF, 0xB8, 0xEB, 0x63, 0x21, 0x6E, 0x64, 0xD6, 0xC1, 0x20, 0xDA, 0xEB,
-    0xE2, 0x0A, 0x5C, 0x9E, 0xC5, 0x37, 0x18, 0x53, 0x39, 0x07, 0xB6, 0xAD, 0x6A, 0x7B, 0xDD, 0x61,
-    0x6A, 0x79, 0x2F, 0xCA, 0x65, 0xDC, 0x4B, 0x8C, 0xE6, 0x51, 0xF3, 0x45, 0x3A, 0xB8, 0xF7, 0x4F,
-    0x08, 0x3C, 0xAC, 0xB8, 0x36, 0xA8, 0x17, 0x8B, 0xDC, 0xE3, 0xA3, 0x0F, 0x1F, 0x39, 0xC5, 0x64,
-    0x08, 0x55, 0xDC, 0x92, 0x03, 0x53, 0xDC, 0x99, 0xEC, 0x46, 0x4E, 0x12, 0x78, 0xA7, 0xEA, 0x75,
-    0x59, 0x8F, 0xBC, 0x15, 0x59, 0x4B, 0x87, 0xE2, 0x6D, 0x19, 0x72, 0xCA, 0x7C, 0x05, 0xC0, 0x45,
-    0xF0, 0x1F, 0x22, 0xB5, 0x10, 0x52, 0xEB, 0xE1, 0x90, 0x42, 0xA2, 0x02, 0x98, 0x52, 0x0E, 0xCD,
-    0xA7, 0x13, 0x3E, 0x93, 0xCA, 0x1D, 0x99, 0x68, 0x9D, 0x6B, 0xFC, 0x39, 0x46, 0xB6, 0xF2, 0xB7,
-    0x04, 0xF0, 0xF9, 0xF8, 0x72, 0xAD, 0xE6, 0xBC, 0xD3, 0x60, 0xF9, 0x04, 0x1B, 0xCF, 0x80, 0x4C,
-    0x9B, 0xDD, 0x75, 0xF2, 0x22, 0x0A, 0xCA, 0xBE, 0x21, 0x5E, 0x66, 0x3C, 0xE7, 0x3F, 0x72, 0x11,
-    0xC7, 0x61, 0x6B, 0x39, 0xEA, 0x97, 0xA7, 0xAC, 0x2B, 0x5A, 0xF9, 0x47, 0x3C, 0x66, 0x3D, 0x99,
-    0x9B, 0x27, 0x44, 0xDC, 0x8B, 0xB6, 0x78, 0xC7, 0xE5, 0x03, 0x7C, 0x27, 0xF7, 0xE6, 0x18, 0x4D,
-    0x21, 0x26, 0x4D, 0x1A, 0x09, 0x90, 0x18, 0x2C, 0x66, 0x03, 0xB8, 0x5C, 0x41, 0xDE, 0xC5, 0x38,
-    0x30, 0x3A, 0x91, 0xDF, 0x91, 0xFF, 0x64, 0x78, 0x58, 0xEE, 0x0D, 0xF6, 0x48, 0x03, 0xF5, 0x25,
-    0x47, 0x38, 0x6B, 0xD9, 0x88, 0xEC, 0xFC, 0x81, 0xA8, 0xE5, 0x2E, 0x95, 0x85, 0x16, 0xDB, 0x51,
-    0xD4, 0xD5, 0x47, 0xA3, 0x43, 0x58, 0x2C, 0xBF, 0x31, 0x25, 0x83, 0x2C, 0xD7, 0x59, 0x39, 0x82,
-    0xEE, 0x3A, 0x16, 0xEB, 0x09, 0x19, 0x9B, 0x7D, 0x5D, 0x86, 0x53, 0x5D, 0x73, 0x3E, 0x88, 0x31,
-    0xA8, 0x94, 0x75, 0x21, 0x92, 0xA1, 0xF9, 0x5C, 0xC6, 0xFD, 0xF0, 0xB7, 0x19, 0xD0, 0x2B, 0x33,
-    0xA5, 0x45, 0x98, 0x0F, 0x34, 0xF9, 0x5C, 0x68, 0xDA, 0x9C, 0xEC, 0x9E, 0x1A, 0x24, 0x9A, 0xA8,
-    0x6D, 0x6E, 0x4D, 0x0F, 0x9F, 0x57, 0xD3, 0x93, 0x64, 0x81, 0x60, 0xDD, 0xAB, 0xF7, 0x01, 0x04,
-    0x5E, 0x73, 0x8F, 0x4F, 0xCC, 0x3D, 0x23, 0x33, 0x8E, 0x05, 0xA1, 0x25, 0x26, 0xB7, 0x3A, 0x47,
-    0x6A, 0x7C, 0x90, 0x57, 0xEB, 0xDD, 0x49, 0x7F, 0xCB, 0x90, 0x60, 0x4D, 0x7F, 0x51, 0x73, 0xCA,
-    0x65, 0xC0, 0x9A, 0x4D, 0x54, 0x63, 0x80, 0xD8, 0x3C, 0x81, 0x3D, 0xB4, 0x9B, 0x74, 0xD9, 0x48,
-    0xE7, 0x7B, 0xEF, 0x11, 0xC1, 0xBD, 0xE2, 0x5D, 0xB9, 0xDF, 0x3B, 0x63, 0x25, 0xD0, 0xB0, 0xB8,
-    0x2E, 0xA7, 0xF0, 0x71, 0x59, 0x44, 0x59, 0x84, 0xCB, 0xB2, 0x07, 0x69, 0x2F, 0x6B, 0x55, 0xBB,
-    0x88, 0xE9, 0x9D, 0x7A, 0xD6, 0x56, 0x0A, 0xDB, 0xC8, 0xC5, 0xFB, 0x1C, 0x3E, 0x2E, 0x72, 0x47,
-    0x35, 0x7F, 0xE1, 0xD2, 0x64, 0x3C, 0x9D, 0xAD, 0x21, 0x77, 0x50, 0x90, 0xCC, 0xD9, 0x80, 0x9A,
-    0x00, 0xAC, 0x7E, 0x9D, 0xD1, 0xB4, 0x0B, 0xBF, 0x1D, 0xA2, 0xA1, 0x5C, 0x8F, 0xCC, 0x27, 0x25,
-    0xF8, 0xAC, 0x0B, 0x11, 0xC5, 0xC3, 0xAB, 0xBC, 0x09, 0x0C, 0xF1, 0xF7, 0x27, 0xD1, 0x73, 0xB0,
-    0xC3, 0xF0, 0x43, 0x45, 0x9A, 0xA6, 0x74, 0x54, 0x6B, 0x76, 0x0D, 0xA1, 0x53, 0x68, 0xEE, 0x0C,
-    0x71, 0x24, 0x87, 0xC3, 0xF4, 0x98, 0x23, 0x45, 0x07, 0x18, 0x23, 0x9A, 0x74, 0x82, 0x8E, 0x63,
-    0x14, 0x4D, 0xBC, 0x79, 0xB1, 0x8B, 0x72, 0xD0, 0x14, 0x21, 0xFB, 0x54, 0xDB, 0xAE, 0x20, 0x29,
-    0x3F, 0x30, 0x0A, 0x2C, 0x12, 0xA7, 0xB5, 0x04, 0xE2, 0x8C, 0x30, 0xBF, 0x24, 0x41, 0x8E, 0xA4,
-    0x2C, 0x9E, 0x9C, 0x5F, 0xE6, 0x7C, 0xBC, 0xD7, 0xA9, 0xEE, 0xE9, 0xFD, 0xB8, 0x37, 0x2A, 0x5C,
-    0x9D, 0x0E, 0x16, 0x79, 0x94, 0xE9, 0xC7, 0xB3, 0xC8, 0xDF, 0x98, 0x0C, 0xF6, 0x39, 0xE4, 0xD8,
-    0x8E, 0xB2, 0xAA, 0xC6, 0x3E, 0x33, 0xA7, 0x1D, 0xC8, 0x6E, 0x91, 0xF6, 0xA2, 0x49, 0x7B, 0xF9,
-    0x39, 0xE9, 0xF1, 0x4F, 0xF7, 0xD8, 0x4C, 0x24, 0xFD, 0x48, 0x63, 0x56, 0x23, 0x33, 0x5C, 0x7F,
-    0x04, 0xCD, 0x48, 0x28, 0x43, 0x97, 0x6E, 0x85, 0x9C, 0xC6, 0x75, 0x48, 0xA4, 0x18, 0x7C, 0x0A,
-    0x6B, 0x55, 0xE6, 0x93, 0x59, 0x97, 0x84, 0x7D, 0xBE, 0x46, 0x88, 0x62, 0x80, 0xF5, 0xBD, 0x70,
-    0x89, 0xA1, 0x64, 0xAE, 0xAC, 0xE6, 0x43, 0x82, 0xE1, 0x39, 0x20, 0xFB, 0xB9, 0xF2, 0xEA, 0xDB,
-    0x84, 0xE0, 0xBE, 0xB2, 0xB9, 0x7A, 0x23, 0xF9, 0xD8, 0xEF, 0x3A, 0x70, 0xC9, 0x8E, 0xF1, 0x32,
-    0xCD, 0xF2, 0xF9, 0x40, 0xA6, 0xFB, 0x61, 0xE0, 0x4D, 0xF5, 0x8B, 0xC5, 0x7C, 0xB5, 0xF7, 0x09,
-    0x96, 0xA9, 0x66, 0xD2, 0xBA, 0xDD, 0x0C, 0x3F, 0xF1, 0xF9, 0xA3, 0x1E, 0xBA, 0x65, 0x44, 0x41,
-    0xA1, 0x05, 0x4A, 0x43, 0xD5, 0xCC, 0x23, 0x18, 0x51, 0xE1, 0x4F, 0x90, 0xE8, 0x97, 0x2B, 0xD5,
-    0x40, 0x73, 0xE4, 0x73, 0x83, 0x56, 0xB6, 0xA5, 0x2B, 0xA9, 0xBE, 0x72, 0x44, 0xDC, 0x78, 0x52,
-    0xD3, 0xFF, 0xB6, 0x35, 0x09, 0xB2, 0x48, 0x97, 0x74, 0x80, 0xA0, 0x18, 0x26, 0x4D, 0x0E, 0x29,
-    0x0E, 0x05, 0xFC, 0x57, 0x74, 0x87, 0xF8, 0x72, 0x68, 0x9B, 0xA5, 0x94, 0x35, 0x44, 0xAF, 0xC4,
-    0x2D, 0x64, 0xA5, 0x88, 0x68, 0xC5, 0x1C, 0xE4, 0x0D, 0x32, 0x9C, 0xB3, 0x7E, 0x4D, 0xAF, 0x43,
-    0x9C, 0x1E, 0x1C, 0x28, 0xD9, 0x1C, 0xFC, 0x73, 0x05, 0xE9, 0x29, 0xDA, 0x84, 0x98, 0xA0, 0xC4,
-    0xF9, 0x03, 0x68, 0xD9, 0xC0, 0x43, 0x12, 0xBC, 0x8E, 0x50, 0x3E, 0xFC, 0x81, 0x48, 0x43, 0xD7,
-    0x19, 0xEC, 0x9F, 0xB8, 0x10, 0x7F, 0x11, 0xB4, 0x5F, 0xB0, 0x4B, 0x6B, 0x9E, 0x45, 0x9C, 0xF7,
-    0x79, 0x4B, 0x76, 0x87, 0x4A, 0x08, 0x35, 0xE1, 0xCA, 0x3E, 0x7B, 0xFA, 0x59, 0x2B, 0x4D, 0x96,
-    0xFC, 0x09, 0x75, 0x2B, 0x54, 0xF7, 0x79, 0x51, 0xD5, 0x0F, 0xE8, 0xA7, 0xB7, 0x6F, 0xE3, 0x64,
-    0x3C, 0x06, 0x5D, 0x60, 0x6B, 0x30, 0x9C, 0x50, 0x0E, 0x50, 0x0F, 0x09, 0xA8, 0xBA, 0x19, 0x71,
-    0x70, 0x9E, 0x3D, 0x42, 0xAD, 0x0E, 0x6F, 0x83, 0xA9, 0x4B, 0xE9, 0x52, 0xC5, 0x13, 0x22, 0x46,
-    0x2B, 0x67, 0xC2, 0xDB, 0xF8, 0x1F, 0xD0, 0x64, 0x3A, 0x20, 0x5D, 0xEF, 0x16, 0x52, 0xAF, 0x2B,
-    0xD2, 0xF1, 0x89, 0x6A, 0xBA, 0x5C, 0x4B, 0x14, 0x95, 0x1D, 0xD7, 0xC1, 0xFB, 0xBC, 0x32, 0xDD,
-    0x7C, 0x8D, 0x87, 0xB1, 0xE4, 0x7A, 0xFF, 0x6D, 0xFF, 0xA7, 0x52, 0x36, 0xDC, 0x27, 0x41, 0xA8,
-    0x9D, 0x14, 0xB5, 0xD1, 0x26, 0xA2, 0x3B, 0x27, 0x26, 0x68, 0x34, 0xB0, 0xDD, 0x4B, 0x6E, 0x2E,
-    0xCB, 0x2E, 0xD6, 0xEE, 0x71, 0xEA, 0x99, 0x9D, 0x94, 0xB7, 0xEB, 0x7C, 0x55, 0xA7, 0x59, 0xC9,
-    0x06, 0x26, 0x0D, 0x30, 0x37, 0x17, 0x5E, 0xD5, 0x5A, 0xBD, 0x2C, 0x08, 0xC7, 0xED, 0xFB, 0x72,
-    0x73, 0xFB, 0x6D, 0x85, 0xF1, 0x77, 0xBD, 0x2A, 0xB4, 0x2A, 0x47, 0x5D, 0xEC, 0xFE, 0x0B, 0xD2,
-    0x05, 0x32, 0x62, 0xC0, 0xEB, 0xCC, 0x5E, 0x94, 0xFB, 0xBC, 0x8E, 0x25, 0xC0, 0x3A, 0xBC, 0x31,
-    0x1F, 0x5C, 0x1D, 0xC0, 0x42, 0x3C, 0x0E, 0x00, 0x53, 0x75, 0xC8, 0x6E, 0xB8, 0xC5, 0x94, 0xB8,
-    0x8E, 0xF4, 0xD5, 0x8A, 0xB1, 0x8F, 0xF3, 0xBA, 0xBB, 0xD6, 0x76, 0x9A, 0x2F, 0x21, 0x27, 0x90,
-    0xE6, 0x59, 0x76, 0xCF, 0xF6, 0x97, 0xA0, 0x1D, 0x63, 0x60, 0xF6, 0x95, 0x12, 0x16, 0x00, 0x86,
-    0x0C, 0x7C, 0x46, 0x13, 0x8C, 0x30, 0x49, 0x58, 0x81, 0xFF, 0xC8, 0x03, 0x95, 0x99, 0x45, 0x33,
-    0xCE, 0x85, 0x7D, 0x0E, 0x07, 0xEC, 0x23, 0x58, 0xFE, 0x43, 0xD8, 0xA2, 0x59, 0x6B, 0xD1, 0x18,
-    0x78, 0x69, 0x96, 0x48, 0x03, 0xDD, 0x18, 0x0F, 0x1E, 0x56, 0x48, 0xE3, 0xB3, 0xEF, 0x20, 0x49,
-    0xE0, 0xEC, 0x60, 0xEC, 0x04, 0x35, 0xFC, 0x01, 0x10, 0x1A, 0xBD, 0xFD, 0x04, 0xF0, 0x28, 0x03,
-    0x47, 0x5B, 0xBD, 0x86, 0x7B, 0x02, 0x94, 0x4D, 0x32, 0xBC, 0xF4, 0x53, 0x2C, 0xD3, 0x6D, 0x9F,
-    0xF3, 0xB2, 0x66, 0x59, 0x0E, 0xD4, 0x02, 0xE3, 0x19, 0x8C, 0xF6, 0x3C, 0xFC, 0xFC, 0x01, 0x76,
-    0x16, 0xFB, 0x6C, 0x9F, 0x85, 0x2D, 0xE8, 0xAC, 0xFC, 0x76, 0x4A, 0x60, 0x58, 0x36, 0xAF, 0xEC,
-    0xF9, 0xB9, 0x5F, 0xE9, 0x12, 0x3C, 0xFA, 0x9F, 0x64, 0x9C, 0x62, 0xBD, 0xE5, 0x77, 0x4F, 0xC8,
-    0x2F, 0x67, 0x14, 0xD9, 0x8F, 0xA9, 0xA8, 0x8E, 0x3E, 0xDD, 0xFA, 0xC1, 0xE7, 0x0A, 0x30, 0x3B,
-    0xF0, 0x83, 0xDE, 0x81, 0xCD, 0x3C, 0x2B, 0x67, 0xFC, 0x2E, 0x63, 0xD8, 0x96, 0x8E, 0x14, 0x3C,
-    0x2C, 0xB8, 0x47, 0x19, 0xB8, 0xD4, 0x02, 0xE9, 0xE0, 0x4E, 0x86, 0x1E, 0x4D, 0x48, 0x29, 0xBA,
-    0x37, 0x6A, 0x50, 0x96, 0xA0, 0x89, 0xBE, 0x88, 0xC6, 0xC1, 0xA6, 0x23, 0x85, 0x99, 0x2A, 0xF1,
-    0xC6, 0xD7, 0xD3, 0xD4, 0xC1, 0xFD, 0x5E, 0xFE, 0x59, 0x2C, 0xFF, 0x8C, 0x98, 0x03, 0xA5, 0x09,
-    0xAF, 0xB3, 0x66, 0x59, 0xA9, 0x52, 0xCE, 0x38, 0x86, 0x70, 0x28, 0x10, 0x29, 0x62, 0xD6, 0x7A,
-    0x63, 0x11, 0x1F, 0xE5, 0x49, 0x3A, 0x2D, 0xCA, 0x0A, 0x18, 0x57, 0x6E, 0xAF, 0xCA, 0x09, 0xAE,
-    0x11, 0x20, 0x0E, 0x7D, 0x69, 0x28, 0x29, 0x0D, 0x2F, 0x42, 0xD1, 0xBB, 0x67, 0x88, 0xC1, 0xC5,
-    0x48, 0xAC, 0x67, 0x4D, 0xC5, 0x84, 0x6F, 0x02, 0xF0, 0x41, 0xA4, 0x6F, 0xB2, 0x3B, 0x33, 0xF3,
-    0xA8, 0x51, 0xF5, 0xFB, 0x1E, 0xF3, 0x99, 0x22, 0x92, 0x8C, 0x1B, 0xA3, 0xC9, 0xEE, 0x91, 0xD7,
-    0xF5, 0xA0, 0xC7, 0x7D, 0x0D, 0x17, 0xD2, 0x95, 0x14, 0xA4, 0xB2, 0xC8, 0xA2, 0x37, 0xFE, 0x90,
-    0xA9, 0xBB, 0xCD, 0x93, 0x96, 0x4C, 0x7B, 0x24, 0x59, 0x58, 0x86, 0xC5, 0xFE, 0x56, 0xE3, 0x96,
-    0xD4, 0xAA, 0x97, 0xB7, 0xA7, 0xDD, 0xC0, 0x7E, 0xF8, 0xBA, 0x67, 0xC0, 0xBE, 0xBB, 0xF8, 0x9B,
-    0x4C, 0xA5, 0x84, 0xFB, 0xE4, 0x50, 0x05, 0xB8, 0x26, 0xA5, 0xA4, 0xD5, 0x78, 0xB1, 0x1C, 0xCE,
-    0x52, 0xA4, 0x0B, 0x79, 0x65, 0xD9, 0xC8, 0xBA, 0x05, 0x46, 0x9C, 0x8B, 0x36, 0x1F, 0x58, 0xB3,
-    0x1E, 0x69, 0x5C, 0x87, 0xFA, 0x1C, 0x51, 0x1E, 0x32, 0xFE, 0x9A, 0xB6, 0x25, 0x1F, 0xFD, 0xD8,
-    0x27, 0x91, 0x0A, 0x2E, 0xEA, 0x7C, 0x95, 0xFB, 0xA7, 0xCC, 0xE2, 0x05, 0x63, 0x21, 0x0B, 0x56,
-    0x75, 0xDC, 0x28, 0x60, 0x81, 0xDB, 0x80, 0xDE, 0xB3, 0x51, 0x6B, 0x93, 0xD0, 0x27, 0xC5, 0x3A,
-    0x55, 0x84, 0x5A, 0x21, 0xC4, 0x41, 0x1E, 0xBC, 0x6A, 0xCD, 0x7E, 0xC2, 0xA5, 0x26, 0x93, 0xEB,
-    0xDC, 0x43, 0x2E, 0xE6, 0x32, 0x73, 0x17, 0x96, 0x28, 0x5D, 0x98, 0x89, 0x90, 0x8F, 0x29, 0xAE,
-    0x55, 0xE0, 0x77, 0x50, 0x17, 0xE2, 0xE1, 0x01, 0xB7, 0x23, 0x72, 0x9A, 0x50, 0x6F, 0xAD, 0x4C,
-    0xA7, 0x7D, 0xB2, 0x18, 0xE0, 0x39, 0xD9, 0x8E, 0x44, 0xF4, 0x75, 0x3A, 0x2D, 0x19, 0x29, 0x47,
-    0xE4, 0xD4, 0x17, 0x77, 0xE8, 0x9E, 0xBE, 0x49, 0x7B, 0x8B, 0xBD, 0xC9, 0x46, 0x0E, 0xFF, 0x06,
-    0x49, 0xCA, 0xB3, 0x70, 0x6E, 0x14, 0xB0, 0xB5, 0x55, 0xFF, 0x90, 0x48, 0xA5, 0xFB, 0xF4, 0x50,
-    0xDC, 0x3A, 0x82, 0x1E, 0x4D, 0x02, 0xD6, 0x2A, 0x02, 0x99, 0xEF, 0x95, 0x45, 0xFF, 0x7F, 0x6F,
-    0x47, 0xFE, 0x41, 0xBC, 0xAE, 0xD4, 0x0A, 0xD6, 0x34, 0x1F, 0xF4, 0x06, 0x73, 0x3A, 0xE5, 0x1F,
-    0xDD, 0x71, 0x09, 0x70, 0x5C, 0xD1, 0x33, 0xFC, 0x68, 0xAA, 0x8F, 0x66, 0x59, 0xAE, 0x1F, 0x80,
-    0xE0, 0xC2, 0x89, 0xFB, 0x04, 0xBA, 0x40, 0x40, 0x62, 0x32, 0xA7, 0xD3, 0xAB, 0x16, 0xE1, 0x15,
-    0xF0, 0xFF, 0xA1, 0x84, 0x92, 0xA7, 0x2F, 0x61, 0x16, 0xA3, 0x5F, 0xA3, 0x07, 0xFD, 0x52, 0xCD,
-    0x21, 0x8E, 0x46, 0x51, 0x89, 0x6B, 0x25, 0x6F, 0x7F, 0xE5, 0xD7, 0x7D, 0x67, 0x0D, 0xBF, 0xB6,
-    0x2B, 0x4F, 0xB4, 0xAF, 0xBD, 0x68, 0xFD, 0x66, 0x50, 0x9C, 0x7B, 0xA5, 0xA9, 0x77, 0x59, 0x92,
-    0x90, 0xB1, 0x0C, 0x1C, 0x53, 0x05, 0xD2, 0xE5, 0x49, 0xCE, 0x1D, 0x12, 0x30, 0xFF, 0xB1, 0xF9,
-    0x8D, 0x6A, 0x4C, 0x7D, 0x30, 0xBC, 0xD2, 0x12, 0xFC, 0x1F, 0x69, 0x92, 0xBD, 0x7B, 0x6E, 0xD4,
-    0xAA, 0x7E, 0xFD, 0xB5, 0xF8, 0x41, 0xBC, 0x7D, 0x75, 0xCB, 0x9B, 0x45, 0x81, 0x4F, 0xDF, 0x78,
-    0x01, 0x19, 0x36, 0x28, 0xBD, 0xC7, 0x36, 0xC0, 0x54, 0xAE, 0xB0, 0x11, 0xC8, 0xF3, 0x9B, 0x7D,
-    0xF5, 0x52, 0x6F, 0x35, 0xF7, 0xF9, 0x1A, 0x53, 0x00, 0x72, 0x01, 0xA6, 0x8D, 0x9D, 0x62, 0x4D,
-    0x24, 0xF1, 0xDD, 0x1E, 0x9C, 0x07, 0xF0, 0xA0, 0xF3, 0x45, 0xF6, 0x9A, 0x8C, 0x3B, 0x71, 0x2E,
-    0xCC, 0x64, 0xE5, 0x8F, 0x49, 0xAB, 0xC5, 0x28, 0x5C, 0x1C, 0x2A, 0x0B, 0xB3, 0xBE, 0xDC, 0x30,
-    0x04, 0x93, 0xEB, 0x0A, 0x64, 0x3A, 0xE5, 0x6F, 0x6A, 0x33, 0x02, 0xFD, 0xDD, 0x3F, 0xD9, 0x59,
-    0x8B, 0x6F, 0x97, 0xAB, 0x27, 0x71, 0xD2, 0x9B, 0x8A, 0x12, 0xB6, 0x66, 0x74, 0x68, 0x8C, 0x9D,
-    0x40, 0x8C, 0xC3, 0xE6, 0x17, 0x2D, 0x59, 0x61, 0x24, 0x01, 0xD2, 0x6F, 0x7E, 0x87, 0x37, 0x60,
-    0xE1, 0x82, 0xEC, 0x66, 0xD5, 0xAE, 0x0F, 0x4C, 0x2E, 0xE7, 0x29, 0x55, 0x6A, 0x08, 0xAC, 0x23,
-    0xB4, 0x7F, 0x29, 0x08, 0x9D, 0xD0, 0xEA, 0x2D, 0xC1, 0xE5, 0x83, 0x0F, 0xD8, 0x6B, 0xFC, 0x8F,
-    0xC9, 0x7E, 0x53, 0x41, 0x97, 0x6B, 0x83, 0x72, 0xA8, 0xED, 0x8C, 0xB6, 0x7D, 0x3F, 0x26, 0xAF,
-    0x42, 0xB9, 0xC2, 0xD3, 0xF7, 0x2E, 0x32, 0xD5, 0xA0, 0xEE, 0xBE, 0x79, 0x54, 0x09, 0xFB, 0x12,
-    0x19, 0x41, 0x35, 0xCA, 0xAE, 0x31, 0x55, 0x66, 0xC3, 0x6C, 0x19, 0x79, 0x27, 0x99, 0xB4, 0xAA,
-    0x88, 0xDA, 0xD5, 0xD2, 0xAD, 0xD1, 0x0C, 0xF1, 0x90, 0x53, 0x0D, 0xE5, 0xD2, 0xAD, 0x34, 0x62,
-    0x87, 0x6D, 0xC0, 0xEE, 0x6B, 0x9E, 0x0E, 0xC8, 0x63, 0xD0, 0xA5, 0x4E, 0x8B, 0x7E, 0x0B, 0xC6,
-    0x53, 0x11, 0xAD, 0x62, 0x76, 0xFF, 0xD9, 0x7B, 0x13, 0x03, 0x0B, 0xF6, 0x62, 0x0F, 0xEA, 0xF6,
-    0xDE, 0x58, 0xDD, 0x22, 0x7B, 0xD3, 0xFA, 0x64, 0x2A, 0x02, 0xDC, 0x08, 0x7D, 0x06, 0x06, 0xBF,
-    0x73, 0x35, 0x6D, 0x6D, 0xE1, 0x7B, 0x70, 0xE8, 0x99, 0x5F, 0x1D, 0x1C, 0x1C, 0x94, 0x46, 0x03,
-    0x81, 0x54, 0xBD, 0x98, 0xED, 0xEF, 0xFF, 0x7A, 0x8A, 0xC9, 0x6E, 0x7E, 0xED, 0x97, 0x8F, 0xCC,
-    0xD4, 0x87, 0xB6, 0x69, 0x53, 0x8B, 0x1F, 0x39, 0x36, 0x77, 0x78, 0x02, 0x84, 0xBE, 0xA0, 0x3E,
-    0x52, 0xFA, 0xAD, 0x25, 0xAF, 0x22, 0x00, 0xD7, 0x76, 0x08, 0x6F, 0x47, 0x20, 0x81, 0xE1, 0xFF,
-    0xC0, 0x7B, 0xBB, 0xE6, 0x46, 0x5C, 0xE0, 0xAC, 0xC0, 0xAC, 0x5A, 0x10, 0x81, 0xFD, 0xCB, 0x11,
-    0xA6, 0xCE, 0x59, 0x40, 0xA8, 0xB7, 0x09, 0x94, 0xE6, 0x84, 0x5E, 0x4F, 0x97, 0x11, 0xA5, 0x6F,
-    0x60, 0x6C, 0x11, 0x22, 0xAF, 0x77, 0xDA, 0x58, 0xDC, 0x35, 0x9A, 0xC7, 0x5C, 0xF8, 0xB0, 0x1C,
-    0x0E, 0xCC, 0xE6, 0x52, 0x09, 0x10, 0x51, 0xA6, 0x2E, 0xF8, 0x1B, 0xD1, 0xB6, 0x54, 0x73, 0x27,
-    0xC3, 0x78, 0x3A, 0xAE, 0xB6, 0x67, 0xBA, 0xAF, 0xB6, 0xE7, 0x01, 0x2D, 0xA2, 0x55, 0x4D, 0xC0,
-    0xCC, 0x69, 0x65, 0x47, 0xB4, 0x70, 0x96, 0xD7, 0xD7, 0xB4, 0x66, 0x6A, 0xCB, 0x6D, 0x85, 0x10,
-    0x7D, 0x17, 0xDF, 0x95, 0xE0, 0xBB, 0x25, 0x23, 0xEC, 0xD6, 0x91, 0x65, 0x8A, 0xDD, 0x5F, 0xF5,
-    0x18, 0x1C, 0x2E, 0x50, 0x6C, 0x03, 0x30, 0x1A, 0xCB, 0xF1, 0xFF, 0xE1, 0xDF, 0x55, 0xBF, 0x62,
-    0xE0, 0x2C, 0x63, 0x9A, 0x34, 0x90, 0xCD, 0x4E, 0xF2, 0xD0, 0x6E, 0x02, 0x51, 0x08, 0x02, 0xA9,
-    0xE9, 0xC2, 0x36, 0x45, 0xAD, 0xF8, 0x3A, 0xAF, 0x28, 0x04, 0xC9, 0x6F, 0xE0, 0x23, 0x93, 0xCF,
-    0x31, 0x51, 0x4E, 0xCB, 0x6E, 0x4C, 0x72, 0x6D, 0xFA, 0x65, 0x33, 0xAC, 0x2E, 0xF7, 0x05, 0x6A,
-    0x51, 0x1A, 0x9F, 0x73, 0x53, 0x11, 0xE0, 0xC8, 0xCB, 0x2B, 0xF2, 0x91, 0x6C, 0x33, 0x98, 0xA8,
-    0x93, 0x53, 0xFD, 0x1F, 0x76, 0x94, 0x97, 0xB7, 0x98, 0xEF, 0x1F, 0xBC, 0x3C, 0xF3, 0xEC, 0xCC,
-    0x79, 0xE9, 0x0F, 0xFE, 0x43, 0xB0, 0xC8, 0xBF, 0x44, 0xC4, 0x3C, 0x15, 0x73, 0xFA, 0xCE, 0xFF,
-    0x31, 0xAF, 0x9E, 0x90, 0x9D, 0x7D, 0xF7, 0x83, 0x57, 0xA2, 0x3E, 0xA9, 0xE5, 0x48, 0x15, 0xD7,
-    0xDC, 0xE9, 0x69, 0xDD, 0xD9, 0x33, 0xAD, 0x87, 0xAE, 0x77, 0x31, 0xBF, 0x67, 0xE5, 0xE3, 0x76,
-    0xED, 0xFE, 0xE7, 0x95, 0xD5, 0x8B, 0xFB, 0xB5, 0x42, 0xC3, 0x62, 0xB5, 0x82, 0x1D, 0xFF, 0x66,
-    0xEC, 0xED, 0x57, 0x64, 0xFE, 0xE9, 0xBE, 0x2C, 0x2A, 0xA9, 0x76, 0x01, 0x1B, 0x52, 0x7A, 0x60,
-    0x76, 0x08, 0x8C, 0x98, 0xDC, 0x6A, 0xCD, 0x3F, 0x32, 0xB8, 0x5F, 0x9B, 0x88, 0x4C, 0x3C, 0x20,
-    0xFF, 0x78, 0x20, 0x68, 0xEF, 0x2F, 0xFF, 0xE7, 0x11, 0x55, 0xE0, 0xAB, 0x39, 0xF2, 0xB6, 0xD1,
-    0x8E, 0x7F, 0xAA, 0x3A, 0x2C, 0x3D, 0xFD, 0x7F, 0xCD, 0xBF, 0xE7, 0xBF, 0x9A, 0xC4, 0xFC, 0xD4,
-    0x7F, 0x8A, 0xCE, 0x1B, 0x67, 0x45, 0x1F, 0xA2, 0xF5, 0x56, 0xCD, 0xAF, 0xE2, 0xEA, 0xA6, 0x93,
-    0xED, 0x84, 0x8E, 0xBD, 0xB2, 0xDE, 0xFF, 0xC6, 0xC9, 0x0F, 0x16, 0x50, 0x12, 0x16, 0xE7, 0x37,
-    0xBF, 0x13, 0x16, 0xA7, 0xFC, 0x97, 0xF7, 0xDD, 0x61, 0xAB, 0xCF, 0x96, 0xF7, 0xE2, 0x05, 0x9D,
-    0x2E, 0x51, 0xA3, 0x4C, 0x3F, 0xF5, 0x6B, 0x66, 0xED, 0x93, 0x47, 0x04, 0x9C, 0xE9, 0x3B, 0xBF,
-    0x6F, 0xD6, 0x57, 0xCC, 0x4A, 0x56, 0x34, 0xEA, 0x82, 0xC0, 0x67, 0x4B, 0xC1, 0x1C, 0x35, 0x6F,
-    0x1B, 0x2E, 0xF9, 0x6B, 0x26, 0xBC, 0x7C, 0xD9, 0x3F, 0xF1, 0x0B, 0xFA, 0xF7, 0x9F, 0xA9, 0x98,
-    0x32, 0x03, 0xCA, 0x2A, 0x78, 0x91, 0x5F, 0xFC, 0x3B, 0x9F, 0x2B, 0xD1, 0xFC, 0x74, 0x6B, 0x4B,
-    0x0B, 0xB9, 0x09, 0x56, 0x17, 0x2E, 0x04, 0xA7, 0xA0, 0xA5, 0x23, 0x70, 0x11, 0x5B, 0x23, 0xD6,
-    0x7A, 0xE4, 0x99, 0x91, 0xBF, 0x22, 0xBD, 0x8D, 0x9C, 0x9B, 0x5F, 0x5D, 0x6C, 0xB7, 0x2E, 0x54,
-    0x1E, 0xAE, 0xB8, 0x6E, 0xEF, 0x5B, 0xCB, 0xB0, 0xBC, 0x8F, 0x6E, 0xCC, 0x01, 0x43, 0x2C, 0x89,
-    0x76, 0xA4, 0xA8, 0x58, 0x47, 0x77, 0x55, 0x63, 0x3F, 0x3E, 0xBF, 0x6D, 0xDA, 0x45, 0x10, 0xDE,
-    0x87, 0x65, 0x57, 0x1C, 0x80, 0x16, 0xB5, 0xCC, 0x34, 0xCC, 0xC0, 0xBC, 0x28, 0xC1, 0xA1, 0x9B,
-    0x82, 0xF3, 0x1F, 0x6B, 0x66, 0x31, 0x74, 0x2B, 0x30, 0xF4, 0xA6, 0x00, 0x7E, 0x16, 0x37, 0xE6,
-    0xAC, 0x60, 0x9A, 0x5E, 0xCC, 0x1B, 0x2E, 0x81, 0xC8, 0x07, 0x4A, 0xAC, 0xC9, 0xBA, 0x22, 0x15,
-    0xC4, 0x14, 0x62, 0x1F, 0x51, 0x6A, 0x40, 0x3F, 0x28, 0x11, 0x5F, 0x06, 0xC5, 0xDB, 0xCC, 0x6F,
-    0x05, 0x00, 0x8E, 0x14, 0x66, 0x67, 0x77, 0xCF, 0x67, 0x0E, 0x1C, 0x67, 0x67, 0x89, 0x3D, 0xCE,
-    0xD0, 0xCE, 0x8F, 0x29, 0x89, 0xC7, 0x66, 0xC7, 0xB9, 0xF6, 0xE5, 0x72, 0xAA, 0x69, 0x94, 0x9E,
-    0xF1, 0x30, 0xDB, 0x63, 0xCB, 0xAD, 0x5B, 0x62, 0x51, 0xBE, 0x8B, 0xF2, 0x6E, 0x59, 0xEB, 0x6C,
-    0x58, 0xC8, 0xBF, 0x8D, 0x59, 0x5D, 0x7D, 0x61, 0xBF, 0xA5, 0x09, 0x43, 0x70, 0x79, 0xC7, 0x50,
-    0x17, 0xC3, 0x81, 0xC8, 0x96, 0x6A, 0x19, 0xA6, 0x08, 0xD9, 0x27, 0xEC, 0x56, 0xA3, 0x61, 0x63,
-    0xDA, 0xC6, 0xB2, 0x68, 0x99, 0xCC, 0x99, 0x22, 0x04, 0x90, 0xCB, 0x17, 0x45, 0x19, 0xBD, 0x54,
-    0xB8, 0x7B, 0x62, 0x54, 0xDC, 0x0D, 0xA8, 0x58, 0xCC, 0xE0, 0x9C, 0xF2, 0x17, 0xC5, 0xB6, 0xB5,
-    0xC6, 0xD2, 0x55, 0x02, 0x23, 0x3F, 0xF9, 0xA2, 0xCE, 0x07, 0xD2, 0xBC, 0xBA, 0x74, 0xF7, 0x1C,
-    0x03, 0x26, 0xB1, 0x27, 0xA3, 0xCC, 0x49, 0xA4, 0xAD, 0x2B, 0xB5, 0x0F, 0x6F, 0x6B, 0x3E, 0xAF,
-    0x19, 0x7D, 0xB9, 0x67, 0x9E, 0x51, 0x00, 0x32, 0xB1, 0x10, 0x10, 0x91, 0x38, 0xC4, 0xEC, 0x3A,
-    0x94, 0x40, 0x30, 0xF1, 0x52, 0xCC, 0xDC, 0x52, 0x28, 0xD0, 0x16, 0x6C, 0xF9, 0x03, 0x80, 0x78,
-    0xEA, 0x9C, 0xDE, 0x2F, 0xD6, 0x68, 0xB5, 0x79, 0xD8, 0xDD, 0x7C, 0x3E, 0xD1, 0x8A, 0x9A, 0xD9,
-    0x5C, 0x9D, 0x0F, 0x74, 0x68, 0x1A, 0x73, 0x38, 0x26, 0x65, 0xA9, 0x50, 0x7E, 0x99, 0x51, 0xA6,
-    0xCB, 0xEE, 0x0F, 0x61, 0x37, 0xC1, 0x49, 0x32, 0x5E, 0x2D, 0x3A, 0xF7, 0x69, 0x81, 0x6B, 0x28,
-    0xE4, 0x71, 0x8C, 0xE3, 0x37, 0xEA, 0x02, 0xA4, 0xB0, 0x90, 0x4B, 0x1F, 0x8F, 0x5A, 0x29, 0x3D,
-    0xF4, 0xFE, 0x30, 0xA1, 0xF7, 0x07, 0xB3, 0x81, 0x09, 0x34, 0xFE, 0x35, 0xE8, 0xA7, 0x11, 0xAB,
-    0x5D, 0x80, 0x9D, 0xB8, 0x8A, 0xF2, 0x7B, 0xDF, 0x6A, 0xA5, 0xD7, 0x62, 0xA3, 0x6C, 0xFE, 0x13,
-    0x4B, 0x5E, 0xB5, 0x64, 0xD2, 0xC7, 0x17, 0xD5, 0xE1, 0x2D, 0x59, 0xB9, 0x13, 0xB3, 0x72, 0xEB,
-    0x50, 0xF5, 0xF3, 0x03, 0xA7, 0xF4, 0x0B, 0xE3, 0x75, 0x5A, 0xAF, 0xC8, 0x72, 0xF8, 0xAC, 0x23,
-    0x5F, 0x40, 0xB8, 0xB3, 0x82, 0xF7, 0x74, 0xFD, 0x5D, 0x79, 0xE7, 0xC7, 0x68, 0x05, 0x26, 0xE8,
-    0x6C, 0xC3, 0xBA, 0x91, 0x48, 0xE9, 0x66, 0x9F, 0x95, 0x0B, 0xC7, 0xFE, 0x44, 0x81, 0x12, 0xAF,
-    0x98, 0xC5, 0x59, 0xE5, 0xE7, 0x66, 0xE5, 0x6A, 0x20, 0x54, 0x25, 0x81, 0xDE, 0x43, 0xE8, 0xD7,
-    0x17, 0x29, 0x25, 0xED, 0x83, 0x1A, 0xAD, 0x4E, 0x36, 0x9D, 0x2E, 0x9C, 0xD7, 0xAF, 0x1E, 0x6F,
-    0xDE, 0xBF, 0x8C, 0xE1, 0x77, 0x9F, 0xFD, 0x4E, 0x7D, 0xA4, 0xB9, 0x9B, 0x72, 0x58, 0xA1, 0x4F,
-    0x18, 0x29, 0x8D, 0x8C, 0xF5, 0x59, 0xAA, 0x38, 0xD8, 0x10, 0x6D, 0x3E, 0xB8, 0xB2, 0xDF, 0x0F,
-    0x0C, 0xFF, 0x88, 0xEF, 0xEB, 0x07, 0x16, 0x64, 0x9A, 0x4B, 0xB0, 0xFF, 0xB9, 0xCF, 0x69, 0xC7,
-    0xB2, 0x28, 0xC5, 0xFD, 0x86, 0x22, 0xB9, 0x5F, 0x90, 0x46, 0x5F, 0x2A, 0x2C, 0xD2, 0x3F, 0x74,
-    0x17, 0xCA, 0xDD, 0x76, 0x2C, 0x47, 0x1A, 0x8A, 0x7C, 0x56, 0x07, 0xBB, 0xB5, 0x07, 0x69, 0x35,
-    0x8B, 0x6F, 0x2A, 0x8D, 0x1D, 0x6E, 0xE7, 0x2C, 0xC7, 0x61, 0xB3, 0xF6, 0x59, 0x14, 0x9B, 0x48,
-    0x0B, 0xCA, 0xFC, 0x4E, 0x1D, 0x59, 0x9B, 0x3A, 0xD0, 0x82, 0x3F, 0x45, 0x73, 0x99, 0xFF, 0x68,
-    0xF4, 0x1C, 0xAF, 0x43, 0xDD, 0x19, 0x23, 0xA3, 0xD0, 0x3D, 0x16, 0xA9, 0x89, 0x39, 0x83, 0xD4,
-    0x1A, 0xA9, 0x4E, 0x01, 0xA8, 0x89, 0xAA, 0xD1, 0x07, 0x60, 0x62, 0x99, 0x95, 0xD6, 0x5A, 0x79,
-    0x08, 0x49, 0x9A, 0x4A, 0x36, 0x67, 0x13, 0x6B, 0x08, 0x64, 0x63, 0x7C, 0x74, 0x6C, 0xF0, 0xE1,
-    0xBC, 0x25, 0x63, 0x27, 0xD7, 0x5C, 0x7C, 0x9F, 0x86, 0x87, 0x08, 0x51, 0xA3, 0xE4, 0xAA, 0x26,
-    0x98, 0x51, 0xB7, 0x50, 0xED, 0x20, 0x15, 0xAA, 0x4B, 0x67, 0x51, 0x2D, 0x82, 0x35, 0x9E, 0x46,
-    0x2D, 0x99, 0xDD, 0x39, 0xE5, 0xAF, 0xCF, 0x8B, 0x6A, 0x60, 0x52, 0x90, 0x33, 0xFF, 0xE6, 0x11,
-    0xB7, 0xC9, 0x7C, 0x96, 0xD4, 0x8A, 0x4C, 0xBD, 0x77, 0x49, 0x19, 0x49, 0x1B, 0x7C, 0x6D, 0x18,
-    0x8E, 0xD7, 0x86, 0x24, 0x58, 0x49, 0xC2, 0xA6, 0xF5, 0xDD, 0x5B, 0x2C, 0x63, 0x3A, 0x94, 0x16,
-    0x8D, 0xB4, 0x46, 0x2E, 0x9A, 0x7D, 0x93, 0x98, 0xAC, 0xA7, 0x34, 0xA4, 0x83, 0x7D, 0x5D, 0xD3,
-    0x1A, 0xEE, 0x38, 0xDD, 0xCA, 0xEA, 0xF6, 0x3D, 0x45, 0xB5, 0xCA, 0xD3, 0x6A, 0x97, 0x0B, 0xED,
-    0x26, 0x77, 0x6B, 0xD2, 0x26, 0x62, 0x0E, 0x3E, 0x26, 0xD1, 0xB6, 0x7B, 0x56, 0x53, 0xBB, 0x1F,
-    0xD7, 0x18, 0x55, 0x31, 0xE4, 0x48, 0x66, 0x80, 0xBD, 0xB3, 0xCC, 0x07, 0xCD, 0x7C, 0x44, 0x09,
-    0xE5, 0x98, 0x03, 0x72, 0xEA, 0x52, 0x75, 0xD9, 0x7A, 0xA3, 0xDD, 0x5B, 0x10, 0x9D, 0xD5, 0x0A,
-    0xD9, 0xA3, 0x5C, 0x46, 0x60, 0x37, 0xD6, 0x0B, 0x6F, 0x31, 0x1E, 0xA5, 0x7D, 0x02, 0xDB, 0x41,
-    0xF1, 0x09, 0xE5, 0x45, 0xC5, 0xAC, 0xED, 0x43, 0x58, 0xE3, 0x81, 0xD2, 0x8D, 0x02, 0xB7, 0x8E,
-    0xDD, 0xB0, 0xFE, 0x01, 0xD8, 0x6B, 0x77, 0x17, 0xB9, 0x4B, 0x59, 0x57, 0x90, 0xE7, 0x20, 0x63,
-    0xCF, 0x98, 0x0D, 0x88, 0x39, 0xF9, 0xC5, 0xCB, 0xEE, 0xEA, 0x52, 0x5E, 0x14, 0xFA, 0xC5, 0x51,
-    0x14, 0x0E, 0x91, 0x67, 0x89, 0x75, 0x4B, 0x87, 0x4C, 0xEB, 0xAF, 0x40, 0xE2, 0x63, 0xC6, 0x88,
-    0x48, 0x2E, 0xE5, 0x45, 0x4D, 0x81, 0xF2, 0xA2, 0x18, 0x4A, 0xBF, 0xD7, 0xBE, 0x26, 0x05, 0xCB,
-    0x8B, 0xAA, 0xD1, 0xD3, 0xC4, 0x61, 0xCC, 0x69, 0xBF, 0xAB, 0xB3, 0xB6, 0xA5, 0xE9, 0x5B, 0x96,
-    0x3B, 0x14, 0x84, 0xAC, 0x5F, 0xFC, 0x8A, 0x1B, 0xDB, 0x3C, 0xD2, 0x06, 0x50, 0xB5, 0x1E, 0x42,
-    0xEF, 0xD3, 0x68, 0xF4, 0x5C, 0x25, 0xF1, 0xE9, 0x6A, 0xDB, 0xA9, 0xEF, 0x6F, 0xB2, 0x76, 0xEA,
-    0x12, 0x34, 0x42, 0xA3, 0xD9, 0xA4, 0xF8, 0x2F, 0xED, 0x48, 0xCE, 0xE2, 0x34, 0x2E, 0x71, 0xDC,
-    0x74, 0x08, 0x65, 0xD0, 0x48, 0x63, 0xC9, 0xB5, 0x04, 0x14, 0x35, 0x47, 0x38, 0x40, 0x6C, 0x59,
-    0x14, 0xB3, 0x5F, 0x51, 0x4E, 0x4E, 0xC5, 0xBD, 0xEE, 0x42, 0x2D, 0x7F, 0x76, 0x8F, 0xB9, 0x65,
-    0xBE, 0xAF, 0x01, 0x8B, 0xF4, 0x69, 0x85, 0xEF, 0xB0, 0x88, 0xF2, 0x59, 0x67, 0xD4, 0x99, 0x47,
-    0x80, 0x94, 0x41, 0xC6, 0xAA, 0x63, 0x3C, 0xB6, 0x61, 0x6F, 0x0B, 0xB1, 0xC5, 0xD0, 0x2B, 0x8C,
-    0xFD, 0x93, 0x53, 0x75, 0xC7, 0x56, 0x22, 0xE8, 0x02, 0xAB, 0x66, 0x56, 0xEA, 0x68, 0xF1, 0x6E,
-    0x11, 0x39, 0xDC, 0xB0, 0xE5, 0x0C, 0xC2, 0x89, 0x72, 0xB6, 0x9F, 0x66, 0xCF, 0x0E, 0x6C, 0x1A,
-    0xCB, 0xA5, 0x46, 0x96, 0xE9, 0x28, 0xE9, 0x0D, 0x12, 0xFD, 0xF6, 0xE8, 0xC7, 0x26, 0x0E, 0x79,
-    0xA7, 0x3D, 0x6C, 0x56, 0x2C, 0x1E, 0xB0, 0x22, 0x72, 0xC8, 0x77, 0x71, 0xC8, 0xBB, 0x62, 0x52,
-    0x07, 0x29, 0x0E, 0x0D, 0x5E, 0x11, 0x1F, 0x11, 0xD3, 0x45, 0xD3, 0x22, 0x6C, 0x7C, 0xE7, 0x61,
-    0xAD, 0x82, 0xD6, 0x26, 0x1F, 0x6C, 0xAE, 0xF3, 0x24, 0x6B, 0x54, 0x0F, 0xD9, 0x12, 0x4D, 0xDB,
-    0x3A, 0x92, 0x77, 0x7C, 0x9F, 0xB7, 0x7F, 0xDB, 0xF7, 0x31, 0x29, 0x7D, 0x9D, 0xC2, 0x0A, 0x59,
-    0x3D, 0x18, 0x1B, 0x73, 0xE4, 0x54, 0xB5, 0xA8, 0xD9, 0xC2, 0x3C, 0xE3, 0x19, 0xBE, 0xAF, 0xE8,
-    0x55, 0x66, 0x37, 0x16, 0x6C, 0x7E, 0x53, 0x70, 0xEC, 0xBF, 0xC5, 0x72, 0x87, 0xDF, 0x67, 0xBD,
-    0xCD, 0x43, 0xB6, 0xF3, 0x9D, 0x44, 0xD0, 0xCB, 0x60, 0xD8, 0xAF, 0x23, 0xFB, 0xAF, 0x62, 0x23,
-    0xE6, 0xDF, 0xC2, 0xC2, 0x5C, 0xC4, 0x24, 0xDF, 0x05, 0xBC, 0xB8, 0xA3, 0x0B, 0xD3, 0x20, 0x8D,
-    0xA2, 0xF5, 0xBB, 0x66, 0x6F, 0x0F, 0x5C, 0x18, 0xA3, 0x4B, 0x16, 0xCF, 0x15, 0x32, 0x10, 0x2E,
-    0x41, 0x57, 0xBF, 0x89, 0xEB, 0xDF, 0x79, 0x43, 0x74, 0xCE, 0xF0, 0x3C, 0xD3, 0xA2, 0x73, 0xAD,
-    0xA2, 0xCE, 0x99, 0xBF, 0x63, 0xBB, 0xB5, 0x9D, 0x4F, 0xD3, 0x3C, 0x9C, 0x21, 0x2C, 0x4C, 0x99,
-    0xF8, 0x21, 0x12, 0x74, 0x12, 0x49, 0x7C, 0x72, 0xE5, 0xB7, 0x76, 0xE7, 0x3C, 0x87, 0x39, 0x6B,
-    0x00, 0x50, 0x6F, 0x1E, 0xB9, 0x6D, 0x6F, 0x88, 0x30, 0x67, 0xCD, 0xE8, 0x4C, 0x7C, 0x5B, 0x21,
-    0x7D, 0xDD, 0x68, 0x29, 0x9B, 0x36, 0x2B, 0x65, 0x6F, 0x80, 0xD0, 0x56, 0x88, 0x45, 0x9E, 0x3B,
-    0x30, 0xE4, 0x1B, 0xEE, 0xF0, 0x79, 0xC3, 0x24, 0x70, 0xF6, 0xF7, 0x32, 0xBF, 0xEB, 0x0E, 0x4A,
-    0x2F, 0x57, 0x02, 0x96, 0x09, 0xA0, 0x9D, 0x86, 0xB5, 0xE2, 0x99, 0xD9, 0x7E, 0x67, 0x90, 0x6D,
-    0xC1, 0x6C, 0xBF, 0x3B, 0xF0, 0x2F, 0x67, 0x06, 0xAF, 0x18, 0xE9, 0xB2, 0xA1, 0xA6, 0x84, 0xAD,
-    0xB6, 0xD2, 0x41, 0xEE, 0x16, 0x4F, 0x89, 0xF6, 0x65, 0x40, 0xDE, 0x57, 0xBE, 0xED, 0xF8, 0x66,
-    0x3B, 0x96, 0x5B, 0x27, 0x72, 0x52, 0x80, 0xC3, 0x22, 0x1E, 0xE0, 0x92, 0xF6, 0xAC, 0x3C, 0x75,
-    0x89, 0x13, 0x40, 0x8A, 0x0E, 0xAE, 0xFA, 0x0C, 0xED, 0xCA, 0x5B, 0x8A, 0x62, 0xB5, 0x9D, 0x29,
-    0x5E, 0xE3, 0x59, 0x3B, 0xC3, 0xFA, 0x42, 0x95, 0x41, 0xDB, 0x81, 0x99, 0xED, 0xDB, 0x19, 0xCF,
-    0xD9, 0x19, 0x2E, 0x26, 0x3B, 0x35, 0x69, 0x25, 0x76, 0xE6, 0x2F, 0x0E, 0x82, 0x04, 0x19, 0xB9,
-    0x38, 0xB4, 0xB5, 0x36, 0x78, 0xD2, 0xEE, 0x23, 0x6A, 0x88, 0x64, 0x20, 0xCF, 0x02, 0x93, 0x8F,
-    0x39, 0x38, 0xC2, 0xFA, 0x29, 0xDB, 0xB3, 0x4B, 0xD9, 0x5B, 0x8C, 0x59, 0x68, 0xB6, 0x31, 0xF6,
-    0xA3, 0xBA, 0x3D, 0x87, 0x41, 0x24, 0x33, 0xB5, 0x33, 0xED, 0x94, 0x7B, 0x63, 0xDE, 0xF6, 0xDF,
-    0xD1, 0xD3, 0x5C, 0xF0, 0x34, 0xCB, 0x38, 0x52, 0x6E, 0x0C, 0x4C, 0xD2, 0x86, 0xC2, 0xA1, 0xFD,
-    0x17, 0xB6, 0xCD, 0x88, 0xBA, 0x2F, 0x6A, 0x46, 0xD4, 0xA2, 0x25, 0x9B, 0x65, 0x1F, 0x80, 0xA3,
-    0xCD, 0x88, 0x0E, 0x5E, 0x66, 0x33, 0x89, 0x15, 0xA9, 0x41, 0x85, 0xE1, 0x91, 0xEF, 0xFB, 0x71,
-    0x5F, 0x33, 0x22, 0x87, 0x83, 0x93, 0x3A, 0xF4, 0x3D, 0x01, 0x59, 0xD9, 0xF9, 0x26, 0x23, 0xDE,
-    0xEA, 0xE9, 0xAB, 0x82, 0xA2, 0xD0, 0xAF, 0x75, 0xE7, 0xB5, 0x0D, 0x3A, 0x45, 0xD3, 0x6F, 0x59,
-    0x76, 0xE2, 0x8B, 0x4E, 0x34, 0x9D, 0x59, 0x7F, 0x10, 0x77, 0x8D, 0x5D, 0x77, 0x7A, 0xAD, 0x8B,
-    0xB2, 0x6C, 0x24, 0x78, 0x78, 0x10, 0x3E, 0x36, 0x6B, 0x36, 0xB4, 0xFF, 0xCE, 0x8C, 0x1F, 0xC0,
-    0xBA, 0x5A, 0xC2, 0x12, 0xB7, 0xD5, 0x24, 0xF3, 0xA2, 0xEA, 0xEC, 0x96, 0x58, 0xA3, 0x65, 0x78,
-    0x49, 0x97, 0xD0, 0xF9, 0x09, 0xD3, 0x05, 0x30, 0x9A, 0x34, 0xC6, 0xE2, 0x67, 0x4C, 0xEB, 0xEE,
-    0x05, 0x3F, 0x6B, 0xDF, 0x7B, 0x88, 0x06, 0xDE, 0xA7, 0x36, 0x63, 0x22, 0x82, 0xEF, 0x2E, 0x0D,
-    0x9A, 0xBC, 0x31, 0x69, 0xBB, 0x2D, 0xE7, 0xCB, 0x7C, 0xF1, 0x99, 0x9B, 0x07, 0xB4, 0x66, 0x1D,
-    0x63, 0xFC, 0x9A, 0x6A, 0x1D, 0xD2, 0xAB, 0x7D, 0x8A, 0xB5, 0x4F, 0xB3, 0x0E, 0x9D, 0x9C, 0xB4,
-    0x85, 0xD1, 0x67, 0x7C, 0x26, 0x30, 0x51, 0x80, 0xAD, 0x93, 0x51, 0x94, 0xC5, 0xF0, 0x0F, 0x12,
-    0x8F, 0x93, 0xF9, 0x40, 0xFD, 0x17, 0xB6, 0xE9, 0x1A, 0x7C, 0x9F, 0x5B, 0x13, 0xF9, 0x64, 0x1B,
-    0xE7, 0x3B, 0x58, 0x90, 0x7F, 0xBD, 0xF9, 0xF2, 0xAC, 0x0D, 0xBE, 0x1A, 0x36, 0xF8, 0x9A, 0x42,
-    0xA3, 0x41, 0x4D, 0x32, 0x5F, 0xBE, 0xC9, 0x51, 0xB3, 0x65, 0x87, 0x87, 0x55, 0x83, 0xEF, 0xEA,
-    0x34, 0x78, 0xCC, 0x31, 0xF8, 0x38, 0x1E, 0xD1, 0x35, 0xBB, 0x3A, 0x6D, 0x5B, 0xD8, 0x56, 0xAD,
-    0x6E, 0x34, 0x3A, 0xBC, 0x78, 0xD0, 0x1B, 0xC0, 0x6F, 0xE8, 0xAB, 0xE8, 0xFE, 0x7B, 0xE8, 0x8D,
-    0x80, 0x1A, 0x10, 0xB6, 0x08, 0xD4, 0x6E, 0x4F, 0x6C, 0x2F, 0xA9, 0x43, 0xD7, 0x55, 0xB7, 0xA3,
-    0x76, 0x91, 0x21, 0x1E, 0x86, 0xCB, 0x37, 0x69, 0xB7, 0x98, 0x24, 0xFC, 0x3D, 0x6B, 0x1F, 0x9A,
-    0x64, 0xD6, 0xEE, 0x4F, 0x68, 0xC1, 0x83, 0xF5, 0xE4, 0xDF, 0x01, 0x24, 0x07, 0x92, 0x94, 0xC0,
-    0xCF, 0x93, 0x02, 0x14, 0xC8, 0x73, 0x6B, 0x8D, 0x11, 0xEC, 0x74, 0x1D, 0xF6, 0x07, 0xD9, 0xB7,
-    0x4B, 0xF6, 0x34, 0xDB, 0x4E, 0xC6, 0xFB, 0xDA, 0xB7, 0x41, 0x51, 0xAC, 0x49, 0xAA, 0x57, 0xA6,
-    0x72, 0xF3, 0xAA, 0xEE, 0x1D, 0xEB, 0xC2, 0x3A, 0x4D, 0x7F, 0xAC, 0x7D, 0xC5, 0x58, 0xF1, 0xC9,
-    0x39, 0xED, 0x45, 0x8C, 0x3C, 0xD6, 0x58, 0x1B, 0xEF, 0xE6, 0x6C, 0x75, 0x21, 0xFB, 0x21, 0x7E,
-    0x39, 0x8B, 0x1E, 0xAF, 0x21, 0x50, 0x10, 0xD1, 0x7F, 0x6F, 0x34, 0x0B, 0xB3, 0xCC, 0x3B, 0xCD,
-    0x51, 0x7F, 0x7D, 0x5E, 0x9A, 0x1E, 0x2F, 0x6D, 0x9C, 0xB5, 0xA3, 0x2C, 0x03, 0x0E, 0xA5, 0xD5,
-    0x16, 0x15, 0xEA, 0xC9, 0x29, 0xAB, 0xA3, 0x38, 0x38, 0x54, 0xD7, 0xEC, 0xF6, 0x56, 0x67, 0x4B,
-    0xB8, 0xDE, 0xCF, 0x50, 0xB3, 0x6B, 0xC8, 0xC8, 0x0E, 0xE2, 0xA6, 0xA3, 0xF6, 0xB5, 0x83, 0xA2,
-    0x13, 0x4D, 0x25, 0x2F, 0x37, 0x50, 0x76, 0x28, 0x40, 0xDA, 0xBD, 0xE6, 0xC4, 0x76, 0x8B, 0x53,
-    0xDF, 0x67, 0x5D, 0x2E, 0x6E, 0xFF, 0x98, 0x22, 0x12, 0x12, 0x89, 0x06, 0xB7, 0xAF, 0x39, 0xE4,
-    0x1A, 0x89, 0xF2, 0x4E, 0x46, 0xB1, 0xBC, 0xD7, 0x9C, 0x6D, 0x8B, 0xBE, 0x70, 0xEC, 0xAC, 0x40,
-    0xDC, 0x37, 0x3F, 0xAF, 0x4D, 0x51, 0x55, 0x08, 0xCF, 0x33, 0x4A, 0xC8, 0x9C, 0xE9, 0x6F, 0x63,
-    0xFF, 0x67, 0x5D, 0xE0, 0x9C, 0x1D, 0x10, 0x7E, 0x88, 0xA4, 0x9E, 0x87, 0xAF, 0xE4, 0x63, 0xE6,
-    0x2E, 0xBB, 0xC7, 0xA1, 0x59, 0x9C, 0xFB, 0x14, 0xC9, 0x43, 0xD5, 0xFB, 0x73, 0x7A, 0x6F, 0xCA,
-    0xDF, 0x77, 0xF6, 0xED, 0x29, 0xFF, 0x68, 0xCE, 0x6E, 0x8C, 0x78, 0xEB, 0xB2, 0x78, 0xEF, 0xA8,
-    0x6F, 0x9A, 0x4A, 0x74, 0xB8, 0x5B, 0x71, 0x37, 0xCE, 0x27, 0x7B, 0xA1, 0xE8, 0xCF, 0x66, 0xE5,
-    0xE7, 0xCF, 0x64, 0xE5, 0xB7, 0x0E, 0xFB, 0x97, 0x64, 0xE5, 0x1F, 0x51, 0xDF, 0x4D, 0x5D, 0x3E,
-    0x66, 0x79, 0xCA, 0x3D, 0x90, 0xF0, 0x9D, 0xD5, 0x01, 0x87, 0x6A, 0xE7, 0x62, 0xFE, 0xCC, 0xD0,
-    0xA5, 0xD6, 0x8D, 0x4E, 0x5B, 0x12, 0xCB, 0xFC, 0x4C, 0xD4, 0xFC, 0xA6, 0x70, 0x16, 0xAE, 0x17,
-    0x4A, 0x9D, 0x37, 0x5C, 0xD4, 0xDC, 0xC3, 0x51, 0x50, 0xA1, 0x89, 0xC2, 0xD1, 0x98, 0x65, 0x29,
-    0x75, 0x60, 0xCA, 0xBE, 0x44, 0x2F, 0xB0, 0xE8, 0x33, 0x7A, 0x81, 0x69, 0xA1, 0xCF, 0xE7, 0xF4,
-    0x02, 0xB3, 0xEA, 0x8E, 0x6C, 0x34, 0xA4, 0x5B, 0x69, 0x52, 0xD0, 0x97, 0xB9, 0xA0, 0x96, 0x17,
-    0x9F, 0x93, 0x21, 0xDB, 0x01, 0x63, 0x75, 0xB9, 0x7B, 0xDB, 0xB1, 0x66, 0xC1, 0x55, 0xC8, 0x4C,
-    0x9B, 0x2C, 0x62, 0xDB, 0x39, 0x0A, 0x0F, 0xD9, 0xBE, 0x3B, 0x67, 0xA2, 0x12, 0xE0, 0xE9, 0xB6,
-    0xF0, 0xDC, 0x17, 0x32, 0xF2, 0x24, 0x32, 0x57, 0xC9, 0x1F, 0x28, 0xFD, 0x17, 0x6D, 0x06, 0xAB,
-    0xAE, 0x15, 0xD2, 0x52, 0xF9, 0x4D, 0x3C, 0x6C, 0x29, 0x8B, 0xF8, 0xC4, 0x5E, 0x8E, 0xBE, 0x2B,
-    0x55, 0xBD, 0x4B, 0x33, 0x9A, 0x90, 0xA5, 0xD0, 0xED, 0xB9, 0x3E, 0xDE, 0x9E, 0x45, 0x53, 0x20,
-    0x5D, 0x65, 0xEE, 0xF9, 0x4F, 0xA0, 0xCF, 0x5E, 0x9F, 0x55, 0x53, 0xC9, 0xF1, 0x46, 0x03, 0x48,
-    0xD4, 0x28, 0x02, 0x05, 0x0B, 0x54, 0x64, 0xBB, 0x71, 0x40, 0xAC, 0x7B, 0x7E, 0x75, 0x8C, 0xF6,
-    0x41, 0x61, 0x7A, 0x64, 0xED, 0x15, 0x55, 0x15, 0xAA, 0xA9, 0x42, 0x2F, 0x9F, 0xE3, 0x17, 0x79,
-    0xDB, 0x6D, 0x26, 0x99, 0x61, 0xDF, 0xAF, 0x8B, 0x9E, 0x1C, 0xB4, 0xD0, 0x5A, 0x6E, 0x89, 0x2C,
-    0xD8, 0x15, 0x2B, 0x1D, 0x98, 0x42, 0x01, 0xE5, 0x89, 0x0A, 0x68, 0x24, 0x74, 0x30, 0xE9, 0xC5,
-    0xDA, 0x9A, 0x65, 0x4A, 0x4C, 0xB7, 0x8D, 0xA9, 0xCD, 0x42, 0x95, 0xD9, 0x96, 0xCF, 0x59, 0x1A,
-    0xC2, 0xEF, 0x35, 0x8E, 0xEF, 0xD5, 0x7D, 0x40, 0x48, 0x0D, 0xE5, 0xBC, 0x08, 0x00, 0x72, 0x91,
-    0x5B, 0xCD, 0x84, 0xC6, 0x74, 0xD1, 0x45, 0x16, 0xAD, 0xD6, 0xD9, 0xC6, 0x06, 0xA1, 0x76, 0x4E,
-    0x38, 0xF6, 0x49, 0x98, 0xA1, 0xFA, 0x20, 0x51, 0x8B, 0x20, 0x2F, 0x07, 0xF6, 0xF0, 0x05, 0x3D,
-    0xA8, 0x99, 0xAF, 0xDF, 0x12, 0x4C, 0x7D, 0x80, 0xF6, 0xC3, 0x9F, 0x49, 0xA3, 0xE9, 0xC4, 0xD9,
-    0x32, 0x0B, 0x2E, 0xEC, 0xE0, 0x0B, 0x56, 0x59, 0x33, 0xC5, 0xDA, 0x70, 0xB6, 0xB6, 0xA1, 0x29,
-    0xC5, 0x1C, 0x1C, 0x36, 0x13, 0xB3, 0x37, 0x8E, 0xC7, 0xC8, 0xD6, 0x9E, 0x1D, 0xD1, 0xCC, 0xFE,
-    0x29, 0xE4, 0xD1, 0x14, 0x6A, 0x35, 0xB5, 0x29, 0x91, 0xBE, 0x1C, 0x00, 0xED, 0x1E, 0x69, 0x0D,
-    0xAC, 0xFE, 0x7E, 0x1A, 0x7A, 0xB3, 0xAD, 0x69, 0xE6, 0x3E, 0xB3, 0x37, 0x5B, 0x71, 0xB4, 0x37,
-    0x5B, 0xBA, 0xDB, 0x9B, 0xCD, 0xFA, 0xA8, 0xAE, 0x59, 0x2A, 0xCA, 0xF3, 0xD0, 0x3D, 0xC4, 0x7C,
-    0x7E, 0x6F, 0x36, 0x38, 0xF0, 0x25, 0x3D, 0x3C, 0x70, 0x86, 0xCF, 0xB0, 0x87, 0x4F, 0xB3, 0x45,
-    0x5C, 0xFB, 0x09, 0x75, 0x9B, 0x6D, 0x32, 0xC5, 0xEE, 0xDB, 0x9A, 0x97, 0x92, 0xC3, 0xC3, 0x8A,
-    0x89, 0x71, 0x90, 0xD3, 0x3D, 0x01, 0x7F, 0x56, 0x1F, 0x51, 0x36, 0x95, 0x7F, 0xEB, 0x43, 0xA1,
-    0x7B, 0xAA, 0x9D, 0x91, 0x97, 0xB2, 0xF9, 0x54, 0xD3, 0x3D, 0xE8, 0x8B, 0xDC, 0x40, 0xA5, 0x82,
-    0xE8, 0xF0, 0x9E, 0xB8, 0x1C, 0x7D, 0x7C, 0xC4, 0xE9, 0x1B, 0x43, 0xDB, 0xB9, 0x76, 0xC9, 0x91,
-    0x23, 0x22, 0xD3, 0xDB, 0x73, 0x58, 0xDA, 0xF7, 0xEE, 0x80, 0x9B, 0xDF, 0xB8, 0xEF, 0x43, 0x21,
-    0x55, 0x37, 0x60, 0x3B, 0xF2, 0x5E, 0xD3, 0xDE, 0xA0, 0x9E, 0xCE, 0x38, 0xED, 0xE4, 0xC6, 0xC6,
-    0xC6, 0x15, 0x91, 0x6D, 0xDE, 0x79, 0xE4, 0xA4, 0xC0, 0x69, 0xFB, 0x36, 0x80, 0x6F, 0xEB, 0x01,
-    0xF1, 0xF1, 0x6F, 0x2B, 0x40, 0x56, 0xF8, 0x0C, 0x90, 0xE1, 0xCE, 0x6B, 0xF2, 0xB4, 0xD1, 0x50,
-    0xBC, 0x76, 0x00, 0xCC, 0x97, 0x7E, 0x61, 0x7E, 0x29, 0xDD, 0x7D, 0x4B, 0x99, 0xDF, 0xB7, 0xD2,
-    0x4A, 0x08, 0x56, 0xEF, 0xC8, 0x57, 0xF3, 0x4F, 0xE4, 0xE5, 0xB9, 0xF1, 0x51, 0x77, 0xF3, 0x3F,
-    0x6B, 0xC9, 0xF5, 0x86, 0xE8, 0x2B, 0xFA, 0x8C, 0x1F, 0xF8, 0x88, 0x08, 0x2D, 0x6B, 0xD1, 0xF2,
-    0x5A, 0xB9, 0x92, 0x25, 0x33, 0x7F, 0x15, 0x7C, 0xC7, 0xB3, 0x80, 0x7E, 0xA5, 0x45, 0x50, 0x95,
-    0xBC, 0x0C, 0xD8, 0x8D, 0xE3, 0xD9, 0xE4, 0xF5, 0x8B, 0xEA, 0x24, 0xB0, 0x1A, 0xF9, 0x34, 0xE7,
-    0x4C, 0x57, 0x80, 0x0B, 0xC2, 0x09, 0xC7, 0xFA, 0x4E, 0x79, 0xFF, 0x3B, 0x68, 0x3F, 0xA1, 0xAB,
-    0xA0, 0x9D, 0xEF, 0x22, 0xDF, 0xF9, 0xEE, 0x8F, 0x65, 0xE7, 0x1E, 0xDC, 0xB5, 0x89, 0xDB, 0x47,
-    0x01, 0xA8, 0x0E, 0x63, 0x17, 0x6B, 0xFA, 0x37, 0x6E, 0xFF, 0xB4, 0xFA, 0x7E, 0x5B, 0xCD, 0xE2,
-    0xE9, 0x8F, 0x7B, 0xA5, 0xE0, 0xDB, 0xFA, 0x93, 0x01, 0x7A, 0xF2, 0x0C, 0x72, 0xBB, 0x00, 0x8B,
-    0x40, 0x86, 0x76, 0x48, 0x39, 0x8A, 0xDC, 0x1F, 0xBB, 0xA6, 0x20, 0x67, 0x39, 0x83, 0x89, 0x7B,
-    0x6E, 0x34, 0x27, 0x4E, 0x6F, 0x99, 0x65, 0xA7, 0x9D, 0x08, 0x22, 0x35, 0x38, 0xB5, 0x2F, 0x42,
-    0xB3, 0x9E, 0x82, 0xA6, 0xF2, 0xCE, 0x3A, 0xAF, 0xB6, 0x1F, 0xBE, 0x02, 0x8F, 0x66, 0x62, 0xD9,
-    0x15, 0x45, 0x83, 0x02, 0x80, 0xC9, 0x8F, 0xF4, 0xEE, 0xAB, 0xEE, 0xC1, 0xBC, 0xAF, 0xDA, 0x1E,
-    0x44, 0x9B, 0xAC, 0x89, 0xBB, 0xD6, 0x55, 0xAD, 0x7B, 0x5B, 0x7E, 0x70, 0x77, 0x3E, 0xD2, 0x06,
-    0x72, 0xA8, 0x88, 0x01, 0x5B, 0x47, 0x93, 0xFB, 0x57, 0x90, 0x77, 0xF6, 0xB0, 0x3A, 0x03, 0x73,
-    0xCD, 0x8E, 0x97, 0xD0, 0x9C, 0xBF, 0x7E, 0x5C, 0x77, 0x6B, 0x4E, 0x36, 0xC6, 0x6D, 0xAD, 0x2F,
-    0xB6, 0x81, 0xDB, 0x7E, 0x42, 0xB4, 0xC3, 0x8F, 0x6E, 0xB8, 0xC7, 0xE7, 0xDF, 0xAC, 0xBA, 0xEA,
-    0xCE, 0x7B, 0x2E, 0xF2, 0xD1, 0x9A, 0x59, 0x50, 0x0D, 0x00, 0xA3, 0x4C, 0xF6, 0x24, 0x9A, 0x0A,
-    0x65, 0xF2, 0xBD, 0x35, 0x72, 0xE5, 0xFF, 0x59, 0xBE, 0xCB, 0xBB, 0x73, 0x8A, 0x5F, 0x8E, 0xEB,
-    0xFF, 0x1F, 0x4A, 0xA1, 0x6B, 0x79, 0x00, 0x9B, 0x44, 0x4C, 0x6B, 0x77, 0x37, 0x11, 0x88, 0xD7,
-    0x88, 0x3E, 0xE1, 0x61, 0x80, 0x79, 0x9A, 0xD8, 0x8C, 0x56, 0xDD, 0x1D, 0x3A, 0x20, 0xFA, 0x0E,
-    0x3A, 0xD1, 0xF2, 0x18, 0x45, 0xDB, 0x77, 0x94, 0x16, 0x58, 0x8A, 0x7F, 0x8F, 0xC1, 0x04, 0x59,
-    0xFF, 0x2B, 0xE2, 0xF8, 0xBF, 0x01, 0x7C, 0x6F, 0xB5, 0x79, 0x9A, 0x6C, 0xD1, 0x25, 0xB9, 0x6F,
-    0x8B, 0x14, 0x7A, 0xF6, 0x44, 0xF6, 0x3D, 0x06, 0x96, 0x0A, 0xB3, 0x63, 0x3B, 0xAE, 0x98, 0xA3,
-    0xF5, 0x7A, 0xBB, 0x9D, 0xBA, 0x54, 0xA1, 0x6A, 0xAA, 0xAB, 0xEF, 0x54, 0xC6, 0x92, 0xC2, 0x8D,
-    0x85, 0x97, 0x0A, 0x83, 0xCB, 0xA4, 0x3E, 0x7B, 0x99, 0x3E, 0xC7, 0x5B, 0xB0, 0x0D, 0xB7, 0xC5,
-    0x11, 0x7F, 0xC4, 0xDD, 0xD1, 0x1C, 0x7C, 0xA6, 0xB2, 0x6B, 0x0E, 0x0E, 0x1E, 0xF5, 0x42, 0x00,
-    0xA7, 0x18, 0x5B, 0xE9, 0x9E, 0xD8, 0x2B, 0xD0, 0x7A, 0x69, 0x01, 0x02, 0x25, 0x78, 0x52, 0x5B,
-    0x2A, 0x77, 0xA1, 0x10, 0x55, 0x99, 0x10, 0xF9, 0x3E, 0xA9, 0x6F, 0x5F, 0xAA, 0xF4, 0x30, 0x39,
-    0x2E, 0xEF, 0x2B, 0x94, 0x1A, 0x29, 0x58, 0x8B, 0x20, 0x5D, 0xEF, 0xAB, 0x4E, 0x50, 0x33, 0xCE,
-    0xFC, 0x1B, 0x1F, 0x0B, 0x84, 0x19, 0xAD, 0x9B, 0xAF, 0x72, 0xEF, 0xB5, 0x7D, 0x3E, 0xC6, 0x81,
-    0x04, 0xEF, 0xA2, 0x5B, 0x8E, 0x8A, 0xF8, 0x2E, 0x0F, 0xC9, 0x1D, 0x3F, 0xBC, 0x54, 0x6A, 0x9F,
-    0x3B, 0xBD, 0xA2, 0x4F, 0x43, 0x3B, 0x65, 0xBE, 0xEE, 0x0B, 0xA2, 0x1F, 0x56, 0x77, 0x56, 0xB9,
-    0x81, 0x5D, 0x95, 0xEA, 0x09, 0x67, 0xEF, 0xED, 0xFE, 0x2D, 0xAD, 0x9A, 0xAA, 0x6B, 0xC6, 0x65,
-    0xA9, 0x4A, 0x95, 0x72, 0x4C, 0xB6, 0x66, 0xE9, 0x1B, 0xCF, 0x7B, 0xA7, 0xAA, 0x20, 0xD5, 0x8C,
-    0xF8, 0xCE, 0x07, 0x7B, 0x85, 0xCC, 0xC9, 0xB8, 0x5F, 0xCC, 0x7C, 0xB4, 0x9F, 0xCE, 0x6E, 0x4A,
-    0x8C, 0xAF, 0x89, 0x4E, 0xD8, 0x1A, 0x6A, 0xF4, 0xC5, 0xFF, 0xFB, 0x95, 0xB2, 0xFA, 0xF8, 0x0D,
-    0xC3, 0x16, 0xE8, 0xBA, 0x12, 0xC5, 0x4D, 0xAF, 0x26, 0x6D, 0xF0, 0xE6, 0x8E, 0x3C, 0x8A, 0x63,
-    0x27, 0x4D, 0xE5, 0xFF, 0xBB, 0x2E, 0xF9, 0xDF, 0x78, 0xFE, 0xE4, 0xF3, 0x2A, 0x1C, 0xC6, 0xFB,
-    0xBF, 0xBD, 0x5F, 0x16, 0xEB, 0x3D, 0xF4, 0xB5, 0xF7, 0xD8, 0xCD, 0xC9, 0xDD, 0x26, 0x62, 0x6C,
-    0xB0, 0x80, 0xAE, 0x0E, 0x2C, 0x26, 0xAF, 0xF9, 0x50, 0x08, 0xA6, 0x80, 0xC1, 0x80, 0xA0, 0x44,
-    0xCE, 0x95, 0x27, 0xC4, 0xD5, 0xED, 0xB3, 0xF9, 0x1C, 0x35, 0x1D, 0x41, 0x2F, 0xEA, 0x33, 0x15,
-    0x78, 0x9F, 0x71, 0xAA, 0xB3, 0x3D, 0x99, 0xB3, 0xF4, 0x6E, 0x0B, 0xCD, 0xDC, 0xA2, 0x00, 0x0A,
-    0xC4, 0x34, 0x3C, 0xA3, 0xAB, 0x97, 0xA2, 0xB9, 0x9F, 0x7C, 0xF2, 0x69, 0xB6, 0x13, 0x7B, 0x58,
-    0x5C, 0x94, 0x2E, 0x75, 0xCF, 0xAF, 0xD1, 0x99, 0x10, 0xF9, 0xD2, 0x05, 0x12, 0x05, 0x22, 0xE8,
-    0x5C, 0x34, 0x4E, 0x95, 0x15, 0x3F, 0xB5, 0xA4, 0x6B, 0x1C, 0x1B, 0x18, 0xA8, 0xFF, 0x1A, 0x81,
-    0x01, 0x6D, 0x1E, 0x4F, 0x87, 0x6B, 0xE9, 0xFD, 0xBD, 0x72, 0xCD, 0x25, 0x6D, 0x17, 0xCB, 0x48,
-    0x1D, 0x53, 0x80, 0x3D, 0x8B, 0xC0, 0x34, 0x06, 0x8C, 0xAA, 0xF1, 0xC4, 0x2F, 0x43, 0x6F, 0x7A,
-    0x94, 0x93, 0x79, 0xC1, 0x86, 0x00, 0x94, 0x0F, 0x10, 0x15, 0xB3, 0x98, 0x5C, 0xB9, 0x82, 0x48,
-    0x03, 0x10, 0x2A, 0xB4, 0xDB, 0xEE, 0x26, 0x79, 0x77, 0x5C, 0x8C, 0xE0, 0xAD, 0x23, 0x31, 0x02,
-    0xED, 0x45, 0xD4, 0x53, 0xA0, 0x6A, 0xED, 0x8C, 0x05, 0x70, 0x83, 0xDE, 0xA3, 0x48, 0x35, 0x04,
-    0xA7, 0xCA, 0x4C, 0x44, 0x76, 0xAC, 0x25, 0xDF, 0xCF, 0x32, 0xE0, 0xFD, 0x50, 0xB5, 0x5C, 0xE4,
-    0x17, 0x56, 0xEC, 0xAB, 0xA0, 0xC1, 0xCD, 0x31, 0x74, 0x1A, 0x72, 0x3B, 0x34, 0x99, 0xF3, 0x5E,
-    0x06, 0xF6, 0x28, 0x5B, 0x78, 0x39, 0x72, 0x76, 0xDF, 0xD1, 0x4C, 0x06, 0xCB, 0x1E, 0x3E, 0x9E,
-    0x70, 0xD3, 0xB3, 0xA9, 0xAD, 0x4B, 0x71, 0x2B, 0x5F, 0xC1, 0xAF, 0xCB, 0xC5, 0xFC, 0x41, 0x7C,
-    0x38, 0x9E, 0x7C, 0x81, 0xB4, 0xEF, 0xAC, 0x03, 0x4D, 0xB8, 0xED, 0xA3, 0x6F, 0xD9, 0x47, 0x3F,
-    0x9F, 0x4C, 0xFE, 0xC9, 0x79, 0x8D, 0x2C, 0xBF, 0xC9, 0xD6, 0x65, 0xBD, 0xE3, 0xE3, 0xAF, 0x52,
-    0x16, 0x5C, 0x34, 0xA7, 0xB6, 0x35, 0x31, 0xAA, 0xEE, 0x14, 0x86, 0x7B, 0xAF, 0x5C, 0x15, 0xA4,
-    0x57, 0xB0, 0xEA, 0x71, 0xFE, 0xCE, 0x39, 0x1F, 0x26, 0x66, 0x98, 0x5A, 0xD9, 0x8C, 0xC8, 0x01,
-    0x95, 0xA3, 0xE1, 0xA3, 0x3A, 0x3E, 0x28, 0x16, 0x6D, 0xD4, 0xE9, 0xD5, 0x18, 0x26, 0x1B, 0xA6,
-    0xB0, 0xBB, 0x81, 0x3A, 0xBB, 0xF0, 0x96, 0x0D, 0x1B, 0x8B, 0xA5, 0xF0, 0xD0, 0x0E, 0x48, 0xC8,
-    0xBC, 0xC7, 0x5C, 0x1E, 0xB6, 0x2B, 0x79, 0xBA, 0xF4, 0xCC, 0xC4, 0x7A, 0xAB, 0x0E, 0xD3, 0x71,
-    0x21, 0x4F, 0x35, 0x29, 0xEC, 0xA5, 0x1D, 0xD6, 0x39, 0xFD, 0xD2, 0x2D, 0xF0, 0xB5, 0xF9, 0xFD,
-    0xF1, 0xAC, 0xF3, 0x42, 0xFA, 0x95, 0xA4, 0xFA, 0x02, 0xEB, 0x7C, 0x6C, 0x0B, 0xFC, 0x1D, 0x9A,
-    0x3B, 0x1B, 0xB7, 0x61, 0x18, 0xB5, 0x3C, 0x9A, 0x6D, 0x8C, 0xFD, 0x3D, 0x17, 0x6B, 0x1E, 0xBA,
-    0xEF, 0x32, 0xBA, 0xE8, 0x09, 0x5A, 0x92, 0x5D, 0x16, 0x8F, 0x64, 0xB3, 0x2F, 0x1B, 0x4F, 0xA6,
-    0x95, 0x4A, 0x6F, 0xC9, 0x17, 0x74, 0x5E, 0x28, 0xE1, 0x4C, 0xB2, 0x49, 0x87, 0xD3, 0xBE, 0xDD,
-    0x5D, 0x3A, 0x1F, 0x58, 0x9F, 0x09, 0x34, 0xB0, 0x6A, 0xD9, 0x67, 0x02, 0xD5, 0x85, 0x66, 0xC9,
-    0xA2, 0x8B, 0x44, 0x7B, 0xE4, 0x19, 0x31, 0x38, 0xC0, 0x9B, 0x8A, 0x3C, 0x1B, 0x19, 0x37, 0xDF,
-    0x14, 0x05, 0x19, 0xD6, 0xDB, 0xA0, 0x60, 0x4C, 0x7A, 0x73, 0xED, 0x02, 0xBD, 0xEC, 0x2B, 0x51,
-    0x77, 0xFC, 0x16, 0x25, 0x42, 0x77, 0xDE, 0x6E, 0x3D, 0xF7, 0xAC, 0xD4, 0xB3, 0x32, 0xCF, 0x9E,
-    0x78, 0x56, 0xDE, 0x59, 0x69, 0x67, 0x0D, 0x0F, 0x2C, 0x8E, 0x8F, 0xFF, 0xB6, 0xF7, 0x7A, 0xEE,
-    0x9E, 0x57, 0x32, 0x9F, 0x6F, 0x53, 0x69, 0x3B, 0x85, 0x74, 0x3E, 0x69, 0xBA, 0xDB, 0xB2, 0x1F,
-    0xCA, 0xAA, 0x69, 0xC1, 0x9C, 0xD6, 0x2F, 0x78, 0xBB, 0xBF, 0xE4, 0xE7, 0xEF, 0x3C, 0xE6, 0x8E,
-    0x4B, 0xA4, 0xF8, 0x8C, 0xCB, 0xA3, 0x2D, 0xDF, 0x80, 0xF1, 0x36, 0x51, 0x68, 0x6E, 0xEC, 0x3C,
-    0x1D, 0x4D, 0x36, 0x5A, 0x8F, 0x14, 0xBF, 0xC0, 0x45, 0x25, 0x17, 0x33, 0x92, 0xD3, 0x3F, 0x03,
-    0xBE, 0xAE, 0xC3, 0xB2, 0xCE, 0x8B, 0x6D, 0x4E, 0x87, 0x7D, 0xB9, 0x8C, 0xB7, 0x35, 0x80, 0x48,
-    0x2D, 0xC7, 0x7A, 0x86, 0x74, 0x89, 0x1D, 0x68, 0x3F, 0x50, 0x38, 0xD9, 0xD4, 0x84, 0x47, 0x85,
-    0xF2, 0xC9, 0xC5, 0xD0, 0x60, 0x66, 0x1B, 0xB3, 0x5E, 0x5E, 0xB0, 0xE6, 0x11, 0x68, 0xFF, 0xE0,
-    0x76, 0x4B, 0x89, 0x15, 0xF8, 0xC4, 0x04, 0x37, 0xF9, 0x46, 0x55, 0xB9, 0x16, 0x93, 0x0E, 0xE6,
-    0x68, 0xD6, 0xCA, 0xCE, 0xF3, 0x93, 0x36, 0xBB, 0x51, 0xE7, 0x9F, 0xC2, 0xD5, 0x39, 0xBB, 0xE3,
-    0xEA, 0x78, 0x4F, 0xA7, 0xD3, 0xEE, 0x0F, 0xD8, 0xAA, 0x24, 0xF8, 0x37, 0x69, 0xEF, 0x1D, 0x41,
-    0xFA, 0x06, 0x18, 0x2A, 0x1F, 0x07, 0x8A, 0xC4, 0x39, 0x50, 0x3B, 0x15, 0xEB, 0x24, 0x44, 0x4A,
-    0x06, 0x96, 0x38, 0xA5, 0x2C, 0x65, 0xE9, 0xFC, 0x43, 0x36, 0x90, 0x2E, 0x42, 0xE7, 0x09, 0xAD,
-    0x54, 0xF3, 0xDB, 0x1D, 0xFF, 0x63, 0x6A, 0x5F, 0x55, 0x27, 0x3F, 0x41, 0x6E, 0x9F, 0x35, 0xC5,
-    0x9B, 0x22, 0x6F, 0x3F, 0x1E, 0xD7, 0x13, 0x2A, 0x90, 0xDF, 0xE8, 0xD2, 0x8F, 0x71, 0xB1, 0xBC,
-    0xB6, 0x4F, 0x20, 0xC5, 0xDC, 0x9E, 0x41, 0x93, 0x8A, 0xE2, 0xAD, 0x29, 0x6F, 0x80, 0x27, 0xE3,
-    0x1E, 0xB5, 0xD2, 0xE1, 0x39, 0x1B, 0x45, 0x5B, 0xD9, 0x1A, 0x17, 0x2B, 0xD9, 0x1B, 0x0B, 0x85,
-    0xA6, 0x5D, 0x2A, 0xE2, 0xC7, 0x07, 0x6D, 0xB8, 0x0E, 0xCD, 0x10, 0x44, 0x78, 0x2F, 0xE3, 0x19,
-    0x15, 0x88, 0x51, 0x93, 0xCA, 0xF3, 0xCA, 0x3C, 0xE4, 0x1C, 0x04, 0x16, 0xCE, 0xD7, 0x81, 0xC4,
-    0x81, 0x7E, 0xF3, 0xD9, 0xB0, 0x81, 0xAB, 0x9B, 0x76, 0x48, 0x7A, 0xE4, 0x04, 0x94, 0xA8, 0x20,
-    0x21, 0x76, 0x13, 0x55, 0xD7, 0xA1, 0xB9, 0x5F, 0x05, 0xFF, 0x79, 0x88, 0x58, 0x2E, 0xDC, 0xF2,
-    0xE1, 0x30, 0x76, 0xE3, 0xF0, 0xFC, 0x17, 0x17, 0xDF, 0x45, 0x1D, 0xD0, 0x58, 0xBC, 0x21, 0xBA,
-    0xF1, 0xCD, 0x8F, 0xE7, 0xA2, 0x5D, 0xCF, 0xC5, 0x9B, 0x1D, 0xB6, 0xC9, 0x55, 0xCF, 0xE2, 0x51,
-    0x22, 0x6E, 0x84, 0x8F, 0x2E, 0xD8, 0x0D, 0x9D, 0xBC, 0x73, 0x41, 0x0C, 0x2F, 0xE5, 0xAD, 0x1D,
-    0x52, 0x51, 0xF0, 0x4F, 0x43, 0x6C, 0xAE, 0x4F, 0xE8, 0x75, 0xA5, 0x7A, 0x3C, 0xDD, 0x2B, 0x77,
-    0xDC, 0x2D, 0x81, 0xF4, 0x35, 0x8D, 0xDE, 0x79, 0x79, 0xF4, 0xCA, 0xDF, 0x1A, 0xB6, 0x54, 0x5C,
-    0x99, 0x0C, 0x09, 0x7B, 0x2F, 0x5D, 0xED, 0x42, 0x30, 0xFC, 0x18, 0x30, 0x69, 0xB5, 0xA1, 0x3E,
-    0xE3, 0x64, 0x4E, 0x33, 0xCC, 0xE8, 0xC5, 0xB2, 0x9C, 0x3B, 0xFB, 0x94, 0x0C, 0xD9, 0x0D, 0x2A,
-    0xD5, 0x77, 0x48, 0x0C, 0x5E, 0x67, 0x94, 0xFD, 0xCC, 0xA4, 0x49, 0x3B, 0x38, 0x91, 0x6B, 0xC6,
-    0x98, 0xE0, 0x6D, 0x67, 0x6C, 0xBD, 0x55, 0x2C, 0xCF, 0x3B, 0x30, 0x66, 0xAB, 0xAC, 0xCA, 0xC8,
-    0x5D, 0xF8, 0x16, 0xB5, 0xBE, 0xD1, 0xE0, 0x13, 0x5B, 0x9F, 0x12, 0xA2, 0x1A, 0xE5, 0x24, 0x30,
-    0x29, 0x22, 0xC0, 0xA2, 0x2E, 0x44, 0x7E, 0xD6, 0xB3, 0x86, 0x4C, 0x79, 0x0A, 0x56, 0x36, 0xF4,
-    0xFD, 0xFE, 0xB7, 0x04, 0x66, 0x29, 0x92, 0x21, 0xAB, 0x3A, 0xA7, 0xDB, 0x7C, 0x88, 0x9A, 0x95,
-    0x15, 0x5A, 0x20, 0xB3, 0xCD, 0x43, 0xBA, 0xED, 0xFE, 0x7C, 0x1A, 0xBB, 0xA7, 0x8E, 0x26, 0xE2,
-    0xA9, 0x56, 0x7B, 0xBB, 0xA0, 0xB9, 0xB0, 0xF6, 0x82, 0x46, 0x6D, 0xFF, 0x47, 0x22, 0xE9, 0x28,
-    0x1B, 0x5F, 0xED, 0x55, 0x5E, 0xD4, 0x7C, 0x36, 0x17, 0xD0, 0x67, 0xF1, 0x36, 0x82, 0xB7, 0x23,
-    0x08, 0xFD, 0xD5, 0xD1, 0x14, 0x6E, 0xDB, 0x07, 0x7E, 0x6C, 0xED, 0x0D, 0x4F, 0xED, 0x97, 0x4E,
-    0xDB, 0xB6, 0x70, 0xE5, 0x62, 0x1C, 0x22, 0x5D, 0xB8, 0xAC, 0x2F, 0x1A, 0xBF, 0x6E, 0x55, 0x93,
-    0x6B, 0xFB, 0x35, 0x48, 0x09, 0x73, 0x63, 0xB7, 0x8A, 0x52, 0x43, 0x17, 0x0C, 0x1D, 0x61, 0xCD,
-    0x00, 0xDD, 0xB4, 0x4D, 0xF6, 0x33, 0xEC, 0x4B, 0xCB, 0x15, 0x7B, 0x63, 0xDA, 0xF2, 0x79, 0x69,
-    0xFD, 0xAA, 0x16, 0x2B, 0xA2, 0x1D, 0x89, 0x49, 0xBA, 0xAA, 0xDC, 0x19, 0xEA, 0xCF, 0x7D, 0xC1,
-    0xD4, 0xB4, 0xFB, 0xBF, 0x5B, 0xDF, 0x47, 0xA0, 0x57, 0x44, 0x46, 0x02, 0xD1, 0xDE, 0x72, 0xE8,
-    0xB9, 0x61, 0xAA, 0x8F, 0x03, 0x0A, 0xF2, 0x4C, 0xDA, 0x10, 0x68, 0x49, 0x1F, 0x4D, 0x9E, 0x62,
-    0x77, 0xE1, 0x3C, 0x24, 0x70, 0xED, 0xBB, 0x85, 0x2B, 0x76, 0x5C, 0xB3, 0x28, 0x8A, 0x8D, 0xB5,
-    0xC4, 0x2E, 0xBF, 0xC0, 0x0B, 0xCF, 0xC1, 0x55, 0x51, 0xCF, 0x31, 0x84, 0xC3, 0x7C, 0xA3, 0xA8,
-    0xE9, 0xC2, 0x45, 0x4F, 0xC5, 0xA8, 0x65, 0xD6, 0xE7, 0xD9, 0xE1, 0xD9, 0x3B, 0x46, 0x53, 0xEF,
-    0x4A, 0xDF, 0x66, 0x76, 0xE3, 0x1D, 0xE6, 0xD5, 0x1F, 0x70, 0xA1, 0x64, 0x9D, 0xDE, 0x63, 0x4E,
-    0xDD, 0x7B, 0x4E, 0xD3, 0x50, 0xF9, 0x10, 0xD0, 0x77, 0x1D, 0xDA, 0xC3, 0xC9, 0x79, 0xEF, 0xE2,
-    0x31, 0x03, 0x5A, 0x47, 0xE7, 0x36, 0x66, 0x2A, 0xC0, 0x0C, 0xDE, 0x74, 0x3D, 0xCD, 0x97, 0x2C,
-    0x67, 0xCB, 0x0A, 0x35, 0xF8, 0x37, 0xE2, 0x94, 0x82, 0xCB, 0xA1, 0x1B, 0x9D, 0x6A, 0x3F, 0xB3,
-    0x5C, 0x60, 0x7A, 0x89, 0x7C, 0xE1, 0x0F, 0x2F, 0x6D, 0x8A, 0x50, 0xFE, 0xF3, 0x91, 0x63, 0xEE,
-    0xEF, 0xB3, 0x37, 0xE0, 0x72, 0x3F, 0xB8, 0xEB, 0xD6, 0xDB, 0x52, 0x0E, 0x01, 0x9F, 0x8C, 0x15,
-    0xF1, 0x00, 0x5B, 0x7D, 0x7A, 0x48, 0x7B, 0xDF, 0x73, 0x81, 0xE3, 0x70, 0xC4, 0x36, 0xDA, 0x9E,
-    0x83, 0x89, 0x88, 0xC7, 0xE7, 0x7D, 0xE2, 0x9D, 0xCC, 0xB1, 0x55, 0x99, 0x7F, 0x2C, 0x1F, 0x43,
-    0xD7, 0x9B, 0xFB, 0x93, 0x69, 0xF7, 0x73, 0x45, 0x33, 0x5F, 0x1F, 0x3D, 0x87, 0x27, 0xF9, 0x52,
-    0x99, 0xC8, 0x59, 0x7D, 0x41, 0xCE, 0x6A, 0x2E, 0x98, 0xF2, 0xB4, 0x53, 0xAC, 0xBF, 0xE6, 0x7E,
-    0x5C, 0x0D, 0x67, 0xF5, 0x97, 0xCE, 0x19, 0x86, 0x1C, 0x42, 0x4F, 0xF5, 0x9E, 0x69, 0xCB, 0x7C,
-    0xC4, 0x12, 0xE2, 0x35, 0x00, 0x51, 0x7D, 0x2A, 0x0E, 0x3D, 0xEC, 0x30, 0xBB, 0x39, 0x8A, 0xE2,
-    0xBE, 0x59, 0x2A, 0x5B, 0xA0, 0xAE, 0x59, 0x6D, 0x04, 0x47, 0x7C, 0x68, 0x35, 0xF5, 0x84, 0x4D,
-    0xDE, 0xD8, 0x48, 0x6D, 0xC7, 0x19, 0x79, 0xC4, 0x3F, 0x15, 0x78, 0xB3, 0x64, 0x9F, 0x0D, 0xE6,
-    0xAE, 0x56, 0x5B, 0xD2, 0x42, 0x24, 0xF3, 0xDE, 0xD3, 0xFC, 0x40, 0x09, 0x3F, 0x25, 0xF3, 0xBE,
-    0xC4, 0xBE, 0x34, 0x3E, 0x18, 0x36, 0x15, 0xEE, 0x0F, 0x2F, 0x8E, 0x95, 0x60, 0x28, 0x14, 0x0C,
-    0x16, 0x03, 0x1F, 0x7C, 0x02, 0x6C, 0xD2, 0xA0, 0x0C, 0xAD, 0xB6, 0xFE, 0xC9, 0x86, 0xA3, 0x36,
-    0xCC, 0x57, 0xBD, 0x4F, 0xBE, 0x07, 0xFD, 0xD5, 0xD1, 0x1A, 0x75, 0xE5, 0x03, 0x19, 0xDD, 0xEA,
-    0x13, 0xA6, 0xB1, 0x65, 0xE3, 0x36, 0x86, 0x72, 0x52, 0x79, 0x55, 0xB4, 0x50, 0x74, 0xD7, 0xDC,
-    0xDD, 0x4B, 0x03, 0x62, 0x58, 0x7C, 0x00, 0x03, 0x9E, 0x36, 0x15, 0xB9, 0xC7, 0xB5, 0x9C, 0xD3,
-    0x68, 0x76, 0xE8, 0xB0, 0x14, 0x6E, 0x13, 0x03, 0x21, 0xBD, 0xCD, 0x3D, 0x81, 0x40, 0xC6, 0x59,
-    0xBC, 0x20, 0xBC, 0xF7, 0xA0, 0xD9, 0xF5, 0x7C, 0xBF, 0xD2, 0xE9, 0xAB, 0xA9, 0x7B, 0xAC, 0x47,
-    0xDB, 0x43, 0xD1, 0xD8, 0xDF, 0x1F, 0x55, 0xF7, 0x3C, 0x10, 0x46, 0x88, 0x06, 0x7F, 0x90, 0xDB,
-    0xCC, 0x3B, 0x03, 0x26, 0x3B, 0xA7, 0xF5, 0xA2, 0x3B, 0x29, 0xB5, 0x97, 0x74, 0xE7, 0x29, 0x02,
-    0x99, 0xFB, 0x23, 0x14, 0xAC, 0xA1, 0x1B, 0x41, 0x8C, 0x25, 0x42, 0x1D, 0x70, 0x35, 0xAC, 0x7D,
-    0x15, 0xE0, 0x46, 0x9F, 0xE1, 0x7C, 0xE2, 0x68, 0x89, 0xC9, 0x98, 0x7A, 0x40, 0xD0, 0x7B, 0xE0,
-    0x55, 0xBC, 0xE3, 0xA1, 0x01, 0xD7, 0x0B, 0x7F, 0xCA, 0xD5, 0xDF, 0x1B, 0x0E, 0x65, 0xEB, 0xA5,
-    0x3F, 0xA6, 0x78, 0x20, 0x1E, 0x2B, 0x5D, 0x1F, 0xD6, 0x8A, 0xF3, 0xD9, 0xE2, 0x85, 0xAE, 0xD3,
-    0x03, 0xE6, 0xEF, 0x28, 0x87, 0xA2, 0x7F, 0xFE, 0x3C, 0x06, 0xC3, 0xC0, 0x67, 0xCB, 0x03, 0x82,
-    0xA1, 0x3F, 0x9B, 0x79, 0x70, 0x6F, 0xA3, 0xBF, 0xD2, 0x47, 0x2E, 0x12, 0x98, 0x0E, 0x59, 0x2D,
-    0xA3, 0x13, 0x37, 0xE8, 0xBA, 0x00, 0xE7, 0x66, 0xF6, 0xA5, 0x60, 0x7A, 0x34, 0xD6, 0x7A, 0x2A,
-    0x66, 0x66, 0xB8, 0x27, 0xE8, 0x13, 0x42, 0x24, 0xCF, 0xB2, 0x10, 0x9F, 0x55, 0x6D, 0x69, 0xA8,
-    0x7A, 0x73, 0xE2, 0x3B, 0xE1, 0x71, 0xDD, 0xA4, 0x2D, 0xE6, 0xF8, 0xE6, 0x55, 0x59, 0x34, 0x8D,
-    0x5A, 0x6D, 0x58, 0xF1, 0xCA, 0x86, 0x1A, 0x7C, 0xBA, 0x45, 0xB6, 0xB4, 0x53, 0xE5, 0x99, 0x3D,
-    0x75, 0x41, 0xF3, 0x02, 0x6B, 0xAF, 0x0B, 0x98, 0x11, 0xA3, 0x49, 0x82, 0x0C, 0xC8, 0x5E, 0xF1,
-    0xB1, 0x49, 0x54, 0xFD, 0xE2, 0x3E, 0x21, 0x40, 0xAB, 0xEE, 0x5E, 0xE8, 0x47, 0x82, 0xDF, 0x7D,
-    0x13, 0x29, 0x05, 0xC5, 0xA1, 0x26, 0x8B, 0x4F, 0x9A, 0x02, 0xF1, 0x08, 0xE7, 0xBB, 0x55, 0x06,
-    0xE1, 0x71, 0xA1, 0xFE, 0xE5, 0xD1, 0x83, 0xA5, 0x4A, 0x5E, 0x1F, 0x36, 0x36, 0x7A, 0xFF, 0x7D,
-    0xB5, 0x8C, 0x87, 0xB5, 0xCC, 0x99, 0xF6, 0xC5, 0x91, 0x9F, 0x4F, 0x5C, 0x5A, 0x72, 0x34, 0x56,
-    0xFB, 0x2B, 0xBE, 0x52, 0x8C, 0xC1, 0x41, 0x63, 0x17, 0x67, 0x76, 0x36, 0xD4, 0xDE, 0x90, 0x64,
-    0x4B, 0x92, 0x1D, 0x00, 0xBC, 0xBA, 0x70, 0xA1, 0x64, 0xF8, 0x79, 0x43, 0x05, 0xBD, 0x09, 0x1D,
-    0xAC, 0xBF, 0xC6, 0x8F, 0x94, 0xE4, 0x90, 0x33, 0xCD, 0x92, 0xE9, 0x7D, 0x12, 0xC5, 0xB6, 0x50,
-    0xEF, 0x0B, 0xDB, 0xF2, 0x31, 0x82, 0x93, 0xB2, 0x6B, 0x23, 0x5B, 0x21, 0x94, 0x68, 0x87, 0x0B,
-    0x1D, 0x8A, 0x12, 0x58, 0x51, 0x62, 0x33, 0x32, 0xC9, 0xDC, 0x7B, 0x78, 0xAC, 0x49, 0x21, 0xC2,
-    0xD5, 0xB8, 0x5D, 0x3B, 0x83, 0x3C, 0xEA, 0x1C, 0x2B, 0x0B, 0x3D, 0x0E, 0x0F, 0x0F, 0xBB, 0x03,
-    0x55, 0xBE, 0x15, 0xD8, 0xAF, 0xF5, 0x73, 0xAC, 0xD3, 0xC6, 0x03, 0xE0, 0x35, 0x00, 0x70, 0xBC,
-    0x0F, 0x80, 0x43, 0xB1, 0xD7, 0xD2, 0xFA, 0x9A, 0xD4, 0x0F, 0x6B, 0xBD, 0x96, 0x86, 0xD7, 0xBB,
-    0xC1, 0xA8, 0x84, 0x2D, 0x13, 0x7A, 0x66, 0x60, 0xB2, 0xD2, 0x4B, 0x16, 0x7B, 0x88, 0x96, 0x6E,
-    0x90, 0x19, 0xBA, 0x41, 0x66, 0x93, 0xA8, 0x9C, 0x3D, 0x4B, 0x94, 0x3F, 0x4D, 0xCB, 0x06, 0x4D,
-    0x14, 0xB3, 0x79, 0x1A, 0x8F, 0xFB, 0x11, 0x1D, 0x1B, 0x72, 0xB2, 0x12, 0xCF, 0x0E, 0xF9, 0xBE,
-    0x54, 0x58, 0x46, 0x3C, 0xA2, 0x87, 0x0F, 0xEC, 0x29, 0x06, 0x02, 0xE0, 0x1A, 0x1A, 0x72, 0xF2,
-    0x8D, 0xD4, 0x59, 0x3E, 0x2E, 0xB3, 0x78, 0x82, 0xAE, 0x56, 0x11, 0x9E, 0xE0, 0xB8, 0xE2, 0x13,
-    0x1C, 0xF9, 0x34, 0x04, 0x7C, 0x8E, 0xF5, 0x7C, 0x70, 0xF5, 0x91, 0x8B, 0x6A, 0x10, 0xC8, 0x6D,
-    0x32, 0x40, 0xAA, 0xD0, 0x4F, 0x69, 0xE3, 0x23, 0x22, 0xB1, 0x66, 0x8D, 0x6D, 0x9B, 0x87, 0x7F,
-    0x4F, 0x60, 0x06, 0xAD, 0x27, 0x54, 0x55, 0xDA, 0xDA, 0x1D, 0x90, 0x01, 0xAB, 0x90, 0x69, 0xDF,
-    0x65, 0xF6, 0x35, 0x90, 0x73, 0x67, 0x7B, 0x38, 0x05, 0xD7, 0x58, 0x06, 0xD6, 0xFB, 0x1E, 0x32,
-    0x20, 0xFE, 0x5E, 0xD7, 0xA7, 0xBA, 0xA0, 0x87, 0x15, 0x5A, 0x05, 0x88, 0x09, 0x47, 0xAB, 0xC8,
-    0x56, 0x24, 0x6F, 0x0C, 0x3D, 0x7A, 0x7D, 0xBA, 0xC2, 0x6E, 0x5B, 0xBF, 0xBF, 0x2F, 0xFD, 0x72,
-    0xF6, 0x20, 0x5D, 0xC4, 0xF6, 0x32, 0x69, 0xC7, 0xE4, 0x9B, 0x67, 0x46, 0x73, 0x14, 0xD5, 0x7D,
-    0xB6, 0x9C, 0x08, 0x00, 0x40, 0x0E, 0xB4, 0xCC, 0x86, 0x0F, 0x8E, 0xDA, 0xCA, 0x89, 0x3E, 0xC1,
-    0xD3, 0xBE, 0xC5, 0x65, 0x78, 0x82, 0x9E, 0x4B, 0xB1, 0xBB, 0x3A, 0x21, 0xD3, 0x98, 0xF2, 0xB4,
-    0x62, 0xD9, 0x8D, 0xCA, 0x89, 0x25, 0x9B, 0x0F, 0x39, 0xB9, 0xF7, 0x45, 0x72, 0xF2, 0x6A, 0xD2,
-    0xCA, 0xF9, 0xC7, 0x5A, 0x8A, 0x16, 0xC8, 0x20, 0xDF, 0x8B, 0xBD, 0xBD, 0x5F, 0x4E, 0xEE, 0x0A,
-    0xB6, 0x9F, 0x20, 0x27, 0x9B, 0x10, 0xF9, 0xF6, 0x4B, 0xC6, 0xB5, 0xB3, 0x37, 0x0F, 0x20, 0x27,
-    0x20, 0xE8, 0x22, 0x87, 0xA6, 0x2D, 0x22, 0x27, 0xF6, 0x73, 0xE4, 0xE4, 0x7B, 0x28, 0xB4, 0x28,
-    0xE0, 0x43, 0x73, 0xD5, 0xA2, 0x01, 0x59, 0x6F, 0x47, 0x16, 0xED, 0x11, 0x52, 0x73, 0xD8, 0x52,
-    0x36, 0x4E, 0x50, 0xCB, 0xFF, 0xCF, 0xB5, 0xC7, 0xA0, 0x6F, 0x00, 0xD6, 0x04, 0xC6, 0x3D, 0x0E,
-    0xCF, 0x05, 0x3B, 0xFA, 0xE8, 0x16, 0x0D, 0x26, 0xAC, 0xB6, 0x4F, 0xE4, 0xD4, 0x6A, 0x32, 0xA6,
-    0xE7, 0x4C, 0x86, 0xD4, 0x5A, 0x11, 0xDA, 0x52, 0xF8, 0x27, 0xBF, 0x55, 0x6E, 0xD8, 0x69, 0xF1,
-    0xA8, 0xAA, 0x00, 0x06, 0x1F, 0xFF, 0x15, 0x67, 0x86, 0x45, 0x07, 0x9C, 0x3A, 0xC7, 0xA7, 0x96,
-    0xC5, 0x4A, 0x87, 0xB7, 0xDA, 0xC5, 0xBD, 0xE8, 0x97, 0x5A, 0x13, 0xAD, 0x7A, 0x1C, 0xE0, 0x49,
-    0xAD, 0x0E, 0xAC, 0x67, 0x7D, 0x2C, 0x40, 0x4E, 0xFD, 0xBD, 0xAB, 0xB4, 0xF5, 0x9E, 0x37, 0x6A,
-    0xBC, 0xB0, 0x9E, 0x82, 0xB7, 0xEC, 0xAB, 0x44, 0xFC, 0x03, 0x1A, 0xC6, 0xA3, 0x05, 0xDE, 0xE2,
-    0xE3, 0xA2, 0xED, 0x11, 0x92, 0xE7, 0x90, 0x66, 0x3D, 0x9B, 0xE5, 0x79, 0x7B, 0x50, 0xC8, 0xC8,
-    0xAB, 0xD1, 0xC0, 0x53, 0xD5, 0x32, 0xD4, 0x0F, 0x1A, 0x8A, 0xC3, 0xE9, 0x99, 0x4A, 0xCF, 0x56,
-    0x1E, 0x56, 0x6B, 0x69, 0xD4, 0x30, 0x0F, 0x4B, 0xB3, 0x9A, 0x7C, 0x5A, 0x32, 0x6B, 0x35, 0x7C,
-    0x61, 0x07, 0xFF, 0xEC, 0x3C, 0x9F, 0xCE, 0x64, 0xD5, 0x6C, 0x0F, 0xBB, 0x42, 0xC4, 0x21, 0x6B,
-    0xED, 0x88, 0xDA, 0xE5, 0xDC, 0xED, 0x37, 0x14, 0x62, 0x92, 0x97, 0x2F, 0x21, 0x63, 0xD9, 0xAD,
-    0x86, 0x5F, 0xD6, 0x9A, 0x02, 0xC5, 0x08, 0x56, 0xC6, 0x5A, 0xAE, 0x82, 0xCF, 0x2B, 0x77, 0x4F,
-    0x4C, 0x3C, 0x4E, 0xC8, 0x8C, 0xB8, 0x4B, 0x55, 0x72, 0x8B, 0x18, 0xC3, 0x12, 0xB3, 0x6C, 0x9F,
-    0xEF, 0x41, 0x92, 0xC6, 0xF7, 0x8E, 0xE2, 0xB6, 0x6A, 0xB4, 0x38, 0x1F, 0x96, 0xCD, 0xCE, 0x98,
-    0x18, 0xEB, 0x09, 0x0C, 0x13, 0x7C, 0xED, 0x74, 0x2F, 0x60, 0x3B, 0x25, 0x4D, 0x30, 0x92, 0xE8,
-    0x3C, 0x21, 0x97, 0x62, 0x33, 0xF3, 0x7D, 0xD4, 0xF9, 0xB5, 0x7D, 0x0E, 0x2A, 0x8E, 0xAF, 0x37,
-    0x4E, 0xF9, 0xC7, 0x04, 0x94, 0x67, 0x86, 0xFB, 0x47, 0x8F, 0xC1, 0xA2, 0x35, 0xEF, 0x46, 0xE3,
-    0x08, 0xF9, 0xE0, 0x7B, 0x5B, 0xE7, 0x68, 0x1B, 0xA5, 0xED, 0x02, 0x99, 0x6A, 0x27, 0xAB, 0x4E,
-    0xB6, 0xB2, 0xC7, 0x60, 0x0B, 0x76, 0x43, 0x41, 0x63, 0x1B, 0x31, 0xC1, 0x40, 0x0F, 0x31, 0xD2,
-    0xFF, 0x7C, 0xFD, 0x91, 0x26, 0xBA, 0xB9, 0xC1, 0x87, 0x19, 0xF7, 0xE2, 0x8E, 0x5A, 0xBE, 0x9D,
-    0x8D, 0xA1, 0x69, 0x9F, 0xBA, 0xF7, 0x3A, 0x6B, 0x25, 0x2B, 0x17, 0x36, 0xFD, 0xE0, 0x5F, 0xBD,
-    0x88, 0x0B, 0xB0, 0x40, 0x99, 0x5D, 0x92, 0xB3, 0xD6, 0x42, 0xE6, 0x4F, 0xE3, 0x4E, 0xAF, 0x44,
-    0xED, 0x31, 0x7B, 0x40, 0x3A, 0xB2, 0x53, 0xD1, 0xD7, 0xF8, 0x98, 0x6E, 0x02, 0x1D, 0x1C, 0xE3,
-    0x65, 0xBF, 0x68, 0x59, 0xE7, 0xC5, 0x5D, 0x50, 0x77, 0x46, 0x85, 0x3F, 0x3D, 0x54, 0xB0, 0xE9,
-    0x16, 0x52, 0x34, 0xF2, 0x73, 0xE8, 0x96, 0x7D, 0xD0, 0xC4, 0x51, 0x15, 0xFF, 0x7C, 0x5E, 0x02,
-    0x50, 0xD6, 0x77, 0xC1, 0xAC, 0x97, 0x59, 0x2C, 0x3B, 0xE1, 0x67, 0xC1, 0x58, 0xA4, 0xCE, 0x02,
-    0x0F, 0x95, 0x33, 0xC5, 0xD3, 0x98, 0xC5, 0xAB, 0xEB, 0xEE, 0xB8, 0xBD, 0xE0, 0x13, 0x31, 0xFD,
-    0x69, 0xD0, 0x30, 0xA5, 0x6E, 0x46, 0xC6, 0x2A, 0x4A, 0x3D, 0x0E, 0x29, 0xF5, 0xBF, 0xEE, 0x46,
-    0xAA, 0xE3, 0xE7, 0x79, 0x60, 0x2F, 0x31, 0xBF, 0x1D, 0xF1, 0xCE, 0xF8, 0x23, 0xD7, 0x2E, 0xFB,
-    0xB1, 0xF6, 0xCE, 0xAA, 0x59, 0xF6, 0x46, 0xF3, 0x97, 0x28, 0x5F, 0x1A, 0x22, 0xAA, 0x76, 0xE6,
-    0x52, 0xEC, 0x2E, 0x35, 0xDC, 0x7F, 0x93, 0xBF, 0xEF, 0x3C, 0x6C, 0x5C, 0x8F, 0x68, 0xC5, 0xBD,
-    0x8F, 0x7A, 0xBE, 0xE2, 0xC7, 0xB1, 0x72, 0x56, 0x6D, 0x65, 0xA2, 0x11, 0x8F, 0x0E, 0x17, 0x84,
-    0x53, 0x5C, 0x1E, 0xF7, 0xE0, 0x21, 0x70, 0xDF, 0x73, 0xA2, 0xAE, 0x6F, 0x38, 0xF6, 0x4A, 0x4B,
-    0x99, 0x13, 0x8C, 0x28, 0xAA, 0x18, 0x28, 0xF7, 0xB6, 0x8C, 0xA2, 0xB7, 0x87, 0x8E, 0x95, 0xF5,
-    0x91, 0x78, 0xEF, 0x9B, 0x62, 0xAA, 0x9A, 0xD5, 0xB9, 0x6D, 0x15, 0xAD, 0x77, 0x4D, 0x78, 0x0C,
-    0xBA, 0x9F, 0xAA, 0x38, 0x78, 0xE3, 0x43, 0x05, 0x6B, 0xB7, 0x47, 0xD6, 0xEC, 0x94, 0x3A, 0x2F,
-    0x89, 0x65, 0xE9, 0xF2, 0xA0, 0xDF, 0x9D, 0x68, 0x94, 0x7A, 0xDA, 0xFB, 0xA5, 0xCF, 0xC7, 0x45,
-    0xA7, 0xBE, 0xB8, 0x24, 0x78, 0x3E, 0x3A, 0x99, 0xE5, 0x97, 0xA5, 0xCA, 0x73, 0xC1, 0x50, 0x52,
-    0xAF, 0xD8, 0x80, 0x01, 0x1B, 0xEB, 0x9F, 0x75, 0x82, 0x90, 0x54, 0x3C, 0xFA, 0x5F, 0x3E, 0xB5,
-    0x8F, 0x66, 0xC6, 0x44, 0x09, 0xDF, 0xF7, 0x35, 0xAA, 0x38, 0x6B, 0x0E, 0x65, 0x7E, 0xCD, 0xF7,
-    0xA4, 0x38, 0x86, 0x9D, 0xF9, 0xBB, 0xF8, 0x24, 0xD4, 0x3D, 0xAC, 0xE2, 0xD1, 0x1D, 0x21, 0xB5,
-    0x51, 0x50, 0x7D, 0x0C, 0xCA, 0xF3, 0x5D, 0x16, 0xB8, 0x7E, 0xA3, 0x7F, 0x4A, 0x86, 0x36, 0x74,
-    0x4E, 0xA9, 0xD0, 0x4B, 0x2D, 0x68, 0xCB, 0xE6, 0xB9, 0x8C, 0x94, 0x15, 0xE7, 0xA3, 0x5A, 0xF8,
-    0x30, 0xA8, 0x5B, 0x68, 0x90, 0x87, 0x66, 0x7E, 0xFA, 0x88, 0x1A, 0x7D, 0x5E, 0xCD, 0xC4, 0x34,
-    0x0A, 0x44, 0x1C, 0x8B, 0x3E, 0x67, 0x01, 0xB7, 0x2F, 0x07, 0xC5, 0x53, 0xEF, 0xC1, 0x6C, 0xE0,
-    0x26, 0x1E, 0x57, 0xFD, 0x9C, 0x8B, 0xF2, 0x1D, 0xDB, 0x8A, 0x4D, 0x8B, 0xA4, 0x86, 0x97, 0xA3,
-    0x95, 0xFA, 0x44, 0x3A, 0x9A, 0xFB, 0x55, 0x7B, 0x63, 0x51, 0xEC, 0xA7, 0x49, 0xFD, 0x0C, 0x15,
-    0xFC, 0xF3, 0x05, 0xD5, 0xC6, 0xA9, 0x46, 0xA3, 0x5A, 0x1D, 0xD1, 0x7E, 0x51, 0x7F, 0x31, 0xA8,
-    0xC9, 0xCF, 0x98, 0xB2, 0x32, 0xEE, 0x86, 0x16, 0xBF, 0xBA, 0x7C, 0x6F, 0x78, 0x1E, 0x9F, 0x93,
-    0xEF, 0x9D, 0xDF, 0x97, 0xA4, 0xAC, 0x85, 0x2A, 0xAA, 0xA7, 0xD5, 0xEE, 0xC6, 0x9A, 0xC9, 0xEC,
-    0x9A, 0xFB, 0x64, 0x0E, 0xCF, 0xF9, 0xEA, 0x13, 0xA8, 0xE5, 0xA7, 0xE9, 0x40, 0xD0, 0xB1, 0x7A,
-    0x6F, 0x0A, 0x49, 0xBD, 0xB9, 0xA2, 0xA0, 0xE5, 0x59, 0xB8, 0xDA, 0x09, 0x89, 0x9E, 0x5A, 0xEA,
-    0xDB, 0xD6, 0x22, 0xA2, 0xF5, 0x91, 0xBB, 0x60, 0x44, 0xC6, 0x90, 0x38, 0x28, 0xCB, 0x7F, 0x1A,
-    0x01, 0x22, 0xB8, 0x68, 0xEE, 0x68, 0xF2, 0xB7, 0x12, 0x9E, 0x5C, 0x6D, 0x56, 0x33, 0x6A, 0x31,
-    0xE6, 0xC2, 0x4E, 0x87, 0x4A, 0x27, 0x3E, 0xAF, 0xB6, 0x5C, 0xDF, 0xFF, 0xD0, 0x73, 0x56, 0xC0,
-    0xB0, 0x8F, 0x7B, 0xBA, 0xB7, 0xD0, 0xB7, 0x55, 0x17, 0xFA, 0x72, 0xBC, 0xC9, 0xC7, 0x19, 0x8D,
-    0x5B, 0xFC, 0xC8, 0x6E, 0x79, 0xE8, 0xF9, 0xE1, 0xFD, 0x0F, 0x3D, 0x5F, 0xEB, 0x42, 0xE3, 0x21,
-    0x8F, 0xDB, 0x87, 0x9E, 0x6F, 0x76, 0x1E, 0x7A, 0x3E, 0xFD, 0x35, 0xD6, 0x4B, 0xBD, 0xB4, 0x9E,
-    0x5E, 0x41, 0xA9, 0x49, 0x91, 0x0F, 0x3B, 0x77, 0xF3, 0xC8, 0x7A, 0xF1, 0xA9, 0xB7, 0x7C, 0x84,
-    0x2E, 0x1F, 0x7C, 0x5E, 0xFB, 0xE7, 0x5E, 0x37, 0xE6, 0xFF, 0x01, 0xB5, 0x58, 0xBF, 0x93, 0xDD,
-    0xD4, 0x15, 0x3E, 0x7A, 0xF2, 0xAE, 0x3C, 0x2B, 0x40, 0x2E, 0x70, 0x66, 0xB0, 0x33, 0xA3, 0x34,
-    0x99, 0x21, 0x0C, 0x89, 0x5A, 0x0A, 0x83, 0x6E, 0x70, 0x41, 0x41, 0xB1, 0x9B, 0x99, 0x7D, 0x61,
-    0x12, 0x0A, 0x28, 0x28, 0x18, 0x8A, 0x90, 0x92, 0x82, 0x20, 0x81, 0x0B, 0x8A, 0x14, 0xF8, 0x4F,
-    0x70, 0xE1, 0xCC, 0x84, 0xA5, 0xC0, 0xA5, 0x0B, 0x63, 0x69, 0x4D, 0x41, 0xE1, 0xC2, 0x22, 0x0C,
-    0x93, 0xC2, 0x05, 0x02, 0x9C, 0xC9, 0x4C, 0x5C, 0x20, 0xB0, 0xB0, 0x05, 0xBE, 0xD2, 0xE1, 0xFB,
-    0xAE, 0xB4, 0x6F, 0xDF, 0x03, 0x63, 0xBC, 0x99, 0x41, 0xEF, 0x49, 0xBA, 0xBA, 0xBA, 0xF7, 0xFC,
-    0xBE, 0xDF, 0x39, 0x57, 0x52, 0xCA, 0x09, 0xF1, 0x2F, 0xA9, 0x3D, 0x77, 0xE2, 0xE1, 0x47, 0x37,
-    0xEE, 0x9B, 0xE5, 0x72, 0x46, 0x1E, 0x96, 0x0D, 0xB9, 0x97, 0x86, 0x67, 0x44, 0x4A, 0xA9, 0xA5,
-    0x11, 0x1D, 0x1E, 0xF0, 0xF3, 0xFA, 0xCC, 0x7D, 0xF7, 0x3A, 0x73, 0x6A, 0xAC, 0x25, 0x7A, 0x43,
-    0x87, 0x54, 0xFF, 0xAD, 0xBD, 0x88, 0xAC, 0x3C, 0x1C, 0x9D, 0xCF, 0xE7, 0x9B, 0xAA, 0xFA, 0x5F,
-    0x9C, 0x37, 0x71, 0x5A, 0x76, 0x60, 0x88, 0xDA, 0x74, 0xFF, 0xEC, 0xF0, 0xCC, 0x83, 0xED, 0x3B,
-    0xDD, 0x7F, 0xF2, 0x3D, 0x18, 0xA5, 0x79, 0xFC, 0x49, 0x1D, 0xDC, 0xEA, 0xBC, 0x7E, 0x90, 0x2C,
-    0xFB, 0xF9, 0x1E, 0x5E, 0x32, 0x1B, 0xF9, 0xDA, 0x7C, 0xBE, 0x1D, 0x81, 0x7D, 0x8C, 0x53, 0xA6,
-    0xE3, 0x91, 0x9D, 0x9D, 0x33, 0x10, 0xA7, 0xE1, 0x1D, 0xC2, 0x24, 0x55, 0xDC, 0x44, 0x5D, 0x60,
-    0x7D, 0xF5, 0xD4, 0x68, 0x79, 0x74, 0x4B, 0x44, 0x4D, 0x51, 0xA5, 0x4D, 0xDC, 0x86, 0x9D, 0x6F,
-    0x67, 0x83, 0xA8, 0x1C, 0x15, 0x99, 0xA9, 0x68, 0x99, 0xA1, 0x3B, 0x72, 0xDD, 0xDE, 0xC0, 0xCE,
-    0xEC, 0x03, 0x9B, 0xBE, 0x6F, 0xD3, 0x4B, 0x36, 0xD9, 0xB5, 0x6B, 0x46, 0x52, 0x73, 0x51, 0x92,
-    0x12, 0x42, 0x34, 0x69, 0x19, 0xB5, 0x49, 0x1D, 0xD8, 0xA8, 0xF5, 0x87, 0xD0, 0x7A, 0x7A, 0x12,
-    0x54, 0x2E, 0x81, 0xCE, 0xD6, 0x1C, 0x1E, 0xC4, 0xD3, 0x4C, 0x83, 0xC1, 0xD7, 0xD0, 0x62, 0x44,
-    0x17, 0x76, 0x10, 0xA0, 0x49, 0xAB, 0xA4, 0x4E, 0xCB, 0xB4, 0x2C, 0x40, 0x77, 0x0E, 0x6E, 0x41,
-    0xEF, 0xDE, 0xF7, 0x51, 0x17, 0x59, 0xF7, 0xBE, 0x9E, 0xDE, 0x9B, 0x2C, 0xA7, 0x40, 0xDB, 0x92,
-    0xED, 0x6A, 0xDC, 0x40, 0x82, 0xA8, 0x51, 0xDF, 0xA6, 0xA5, 0x3E, 0xDD, 0x24, 0x1F, 0xF6, 0x41,
-    0x9B, 0x9A, 0x7E, 0xCD, 0x40, 0x36, 0x6F, 0x1B, 0x0E, 0x6E, 0xA8, 0x8C, 0xF8, 0xD0, 0x3D, 0xAA,
-    0x61, 0x79, 0x30, 0xB7, 0x12, 0x5D, 0xFF, 0xD6, 0x66, 0xAA, 0x9F, 0xC1, 0x1D, 0x4F, 0x5F, 0xFF,
-    0xF6, 0x3D, 0x89, 0x4A, 0x28, 0x02, 0x05, 0xE1, 0x9B, 0xA8, 0x72, 0x83, 0x3C, 0x8C, 0x0F, 0x31,
-    0x35, 0x2D, 0x05, 0x7A, 0x4A, 0x88, 0x37, 0x29, 0xDE, 0xA8, 0x48, 0x60, 0x27, 0xA2, 0x25, 0x2D,
-    0x79, 0x14, 0xF4, 0xE2, 0x66, 0x1C, 0x30, 0x63, 0x0C, 0x15, 0x0C, 0xAA, 0x5C, 0x7E, 0xF3, 0xDC,
-    0xC7, 0x67, 0x68, 0xF5, 0x00, 0x2C, 0x66, 0x38, 0x73, 0x76, 0x3A, 0x09, 0x38, 0xD2, 0xE7, 0x48,
-    0x75, 0x81, 0x20, 0xBF, 0xDE, 0xFC, 0xF8, 0xF9, 0x95, 0x91, 0x5B, 0xA9, 0x31, 0x4E, 0x22, 0xF2,
-    0xA7, 0xDC, 0x6E, 0x64, 0x41, 0x76, 0x5B, 0xA2, 0x75, 0xAA, 0x6F, 0xAA, 0x2D, 0xF4, 0xAA, 0x0E,
-    0x85, 0x5E, 0xD7, 0x3E, 0x83, 0x51, 0xDB, 0xA0, 0x17, 0x4F, 0xE4, 0x7E, 0x91, 0xBF, 0x09, 0x9C,
-    0x15, 0x0D, 0x92, 0xC2, 0x55, 0x1A, 0x68, 0x9F, 0x68, 0xAE, 0xB5, 0xDF, 0x49, 0xCC, 0xB9, 0x94,
-    0xEC, 0x92, 0xBE, 0x35, 0xA4, 0x5D, 0x51, 0x6E, 0xBB, 0x38, 0x88, 0xAB, 0x99, 0xCD, 0x9A, 0x70,
-    0x28, 0x9A, 0xC8, 0x9D, 0x59, 0x15, 0xDA, 0x35, 0xF1, 0xB6, 0xC6, 0x28, 0x09, 0x5A, 0xA8, 0x9E,
-    0xBD, 0x49, 0xAF, 0xA7, 0x37, 0xB5, 0x2C, 0x9A, 0xB8, 0x2F, 0x9A, 0x04, 0x82, 0xC6, 0x64, 0x08,
-    0x41, 0xE5, 0x41, 0x59, 0xC3, 0xB8, 0xEC, 0x94, 0x3E, 0xD7, 0x67, 0x0D, 0x3B, 0xB8, 0xA0, 0x2E,
-    0xCB, 0x81, 0x16, 0xB4, 0x6B, 0x3C, 0x48, 0x7E, 0x91, 0xD6, 0xF2, 0xD8, 0xC1, 0x16, 0xB3, 0x6B,
-    0x6C, 0xE9, 0xCA, 0x31, 0xCB, 0xEF, 0xED, 0xE7, 0x19, 0xD5, 0xFF, 0xCC, 0x2B, 0xE1, 0xAF, 0x96,
-    0x83, 0xCD, 0x9B, 0x3F, 0x2B, 0x81, 0xFB, 0x85, 0x07, 0x99, 0x27, 0xFB, 0x47, 0x51, 0xB9, 0x68,
-    0x83, 0x0B, 0xB4, 0x82, 0x1B, 0xD8, 0x52, 0x2D, 0x19, 0x6A, 0xB0, 0x43, 0xAF, 0x12, 0x35, 0x6C,
-    0xA5, 0x97, 0x7A, 0x17, 0x50, 0xF0, 0x6A, 0xD8, 0x06, 0xAD, 0x7B, 0xD9, 0xA6, 0x15, 0xA2, 0x86,
-    0x2F, 0x4B, 0xF5, 0xC7, 0x15, 0x8D, 0x7B, 0xE2, 0xA2, 0xD1, 0xB7, 0xF1, 0xA7, 0xFD, 0xC6, 0x69,
-    0xD9, 0x38, 0x8D, 0x15, 0xB1, 0xF9, 0x99, 0x36, 0x33, 0x6D, 0xD2, 0x2F, 0xAC, 0xA6, 0x5A, 0x27,
-    0xDA, 0x14, 0x7A, 0xF9, 0x2B, 0xD5, 0x5D, 0xF0, 0x51, 0x9B, 0x6D, 0xB6, 0xBA, 0xD9, 0x16, 0xE6,
-    0x2F, 0x27, 0xBB, 0xEC, 0x8D, 0x3E, 0x03, 0x1F, 0x32, 0x0B, 0x6F, 0xF6, 0x61, 0x2B, 0x33, 0xAC,
-    0xA7, 0xF4, 0x0A, 0x16, 0x30, 0x04, 0x03, 0x13, 0xFC, 0x45, 0xB0, 0x78, 0x03, 0x8B, 0x3F, 0x04,
-    0x03, 0xB3, 0x8F, 0x6C, 0x52, 0x49, 0x61, 0xA2, 0x2F, 0x15, 0x7F, 0x09, 0x3A, 0xC4, 0x5B, 0x8B,
-    0x3F, 0x57, 0x4B, 0xA6, 0x39, 0xFE, 0x14, 0x2C, 0x6B, 0x25, 0x73, 0x2A, 0xCA, 0x21, 0xF7, 0x5F,
-    0x3D, 0x16, 0x06, 0x58, 0xB1, 0xC1, 0xB2, 0x19, 0x56, 0x2C, 0xB1, 0x6C, 0x8C, 0x15, 0x7B, 0xAC,
-    0x98, 0x64, 0xC5, 0x2A, 0xCB, 0x86, 0x59, 0xB1, 0x8D, 0xAC, 0x2F, 0x99, 0x67, 0xC5, 0x42, 0xCB,
-    0x46, 0x5A, 0xB1, 0xD3, 0x8A, 0xA9, 0x96, 0xAD, 0x75, 0x73, 0x58, 0x32, 0xD8, 0x95, 0x36, 0xA9,
-    0x16, 0x36, 0x5B, 0x31, 0x1B, 0x65, 0xDA, 0xB3, 0x1C, 0xFE, 0xF5, 0xC2, 0x78, 0xD1, 0xD7, 0x4B,
-    0xF6, 0x4B, 0x90, 0x1C, 0x16, 0x26, 0x4C, 0xB5, 0xDC, 0xB7, 0xE2, 0x8A, 0x21, 0x0F, 0x39, 0x35,
-    0xC3, 0xCE, 0x53, 0x60, 0x12, 0x26, 0x2B, 0x10, 0xD7, 0x6F, 0xE5, 0xA2, 0xEB, 0xCE, 0xF2, 0xB0,
-    0x8B, 0x5A, 0x4F, 0x81, 0x03, 0xB0, 0x4A, 0x19, 0x74, 0xB0, 0x9F, 0xC2, 0xA0, 0x09, 0x80, 0xD3,
-    0x6F, 0x83, 0x06, 0xC3, 0xFA, 0x69, 0x60, 0x61, 0x80, 0xA7, 0x55, 0x56, 0xC6, 0x0D, 0xEF, 0x51,
-    0x1B, 0xE1, 0xCE, 0xF1, 0x14, 0x34, 0xE8, 0xC2, 0x66, 0x66, 0x71, 0x6F, 0xA5, 0xF7, 0x70, 0xE7,
-    0x34, 0x62, 0x22, 0xF9, 0x92, 0x61, 0x85, 0xAE, 0x02, 0x78, 0x86, 0xBE, 0xC4, 0xEC, 0x71, 0x1D,
-    0x19, 0x81, 0xAB, 0x9B, 0x57, 0x60, 0x5C, 0x54, 0xC7, 0x95, 0x67, 0xE1, 0x68, 0x0C, 0x5A, 0xE1,
-    0x19, 0x35, 0x31, 0xEE, 0x61, 0xCB, 0x3B, 0x47, 0x8F, 0xDC, 0x80, 0x54, 0x83, 0xD7, 0xCF, 0x2C,
-    0xC0, 0x98, 0x62, 0x72, 0xD2, 0x6B, 0x5C, 0xE1, 0x61, 0x49, 0x40, 0x04, 0x00, 0xBF, 0x56, 0x4B,
-    0xDB, 0xCC, 0x9A, 0x26, 0xA8, 0xDA, 0x28, 0x3F, 0x9F, 0xC8, 0x2B, 0x8F, 0xCB, 0xAB, 0x72, 0x58,
-    0x3C, 0x18, 0xA9, 0x8E, 0x90, 0xBF, 0x0C, 0xDC, 0xD8, 0x85, 0x2A, 0x45, 0xED, 0xC3, 0x38, 0x30,
-    0x43, 0x1E, 0x81, 0x58, 0xE5, 0x5F, 0x93, 0x23, 0x02, 0x90, 0x49, 0x4A, 0x00, 0x57, 0x0A, 0x9F,
-    0x4B, 0x0C, 0x2D, 0xCA, 0x70, 0xF0, 0x00, 0x6D, 0x6D, 0xD4, 0xCF, 0x34, 0x2F, 0x6A, 0x06, 0xF7,
-    0x14, 0x2B, 0x04, 0xB2, 0xC3, 0x8C, 0xBC, 0x5F, 0xC9, 0x05, 0x50, 0x9E, 0x35, 0x4C, 0x60, 0x79,
-    0xD2, 0x80, 0x85, 0x9D, 0xA9, 0x89, 0xAC, 0x67, 0x92, 0x56, 0x40, 0x1A, 0x0F, 0xBC, 0xE1, 0x01,
-    0x37, 0x3E, 0xE0, 0xC6, 0x07, 0x60, 0xB0, 0x9A, 0x23, 0x71, 0x1D, 0x01, 0x9B, 0x5B, 0x2D, 0x23,
-    0x35, 0xE9, 0x0D, 0x58, 0xCD, 0x8A, 0x5E, 0xC6, 0x30, 0xFC, 0xD7, 0xF3, 0x44, 0xAD, 0x77, 0x1A,
-    0x04, 0x36, 0x19, 0xAD, 0x49, 0x0B, 0x2A, 0xE2, 0x48, 0xF3, 0x61, 0x85, 0x74, 0x58, 0x3B, 0xD2,
-    0x59, 0x15, 0x75, 0xBE, 0xD3, 0xA8, 0xF2, 0x0D, 0xD4, 0xB8, 0x9F, 0x08, 0x5D, 0xBB, 0x90, 0x6F,
-    0x43, 0xE0, 0x34, 0xD4, 0x90, 0xAC, 0x89, 0xE1, 0x96, 0x1A, 0x17, 0xAD, 0x12, 0x6A, 0x98, 0xB6,
-    0xBC, 0x34, 0x98, 0xC5, 0x8B, 0x81, 0x2A, 0x4A, 0x73, 0xC0, 0x40, 0xA5, 0x8F, 0xD8, 0x2C, 0x7D,
-    0xE2, 0x38, 0x14, 0x57, 0x13, 0x40, 0x43, 0x71, 0x31, 0x05, 0xF8, 0xDF, 0x5E, 0x5A, 0xA8, 0x71,
-    0xCD, 0xF8, 0x6C, 0x40, 0x9D, 0x09, 0x80, 0x17, 0x2B, 0x8C, 0x16, 0x40, 0xFF, 0x84, 0x68, 0x33,
-    0xC5, 0x34, 0xB5, 0x48, 0x62, 0x1D, 0x8A, 0x8C, 0x26, 0xED, 0xB3, 0x6A, 0xB3, 0x81, 0xC6, 0xA7,
-    0x7A, 0xAF, 0x4F, 0x9A, 0xF0, 0xA6, 0x52, 0x57, 0xAC, 0xEB, 0xDC, 0x07, 0x44, 0x44, 0x58, 0x15,
-    0x59, 0xCD, 0x5A, 0xC2, 0x65, 0xC2, 0xA5, 0x83, 0xC9, 0x11, 0x40, 0xE0, 0x8F, 0x7A, 0x4B, 0x5A,
-    0x8B, 0x4B, 0x0B, 0xA8, 0x51, 0xDE, 0x66, 0xE9, 0x85, 0x7C, 0x6D, 0x5F, 0xDA, 0xD9, 0xF9, 0x27,
-    0x87, 0xFE, 0x12, 0xE7, 0x3B, 0x60, 0xFE, 0x0A, 0xB0, 0xE1, 0xD5, 0xDF, 0x89, 0x5C, 0xF0, 0xBF,
-    0x59, 0x87, 0x54, 0xE0, 0xE2, 0x15, 0xD7, 0xF0, 0x6E, 0x8E, 0xDC, 0xAF, 0x00, 0x91, 0x02, 0x65,
-    0x5D, 0x92, 0xC3, 0x7D, 0xA5, 0x04, 0xBB, 0xA0, 0xF7, 0xE8, 0x09, 0xBC, 0xFC, 0x74, 0x5C, 0x48,
-    0x2E, 0x75, 0xE1, 0x85, 0x04, 0x40, 0x1E, 0x1F, 0x2F, 0x67, 0x20, 0xE6, 0xD1, 0x77, 0x74, 0xC8,
-    0x05, 0x9C, 0x4F, 0xD0, 0xB6, 0xB4, 0x00, 0xDD, 0x0A, 0x7C, 0x09, 0x2B, 0xE6, 0x44, 0x0C, 0x06,
-    0xE5, 0xD9, 0x2D, 0x14, 0x06, 0x2D, 0x66, 0xD8, 0xC7, 0x31, 0x38, 0xCC, 0xE5, 0x09, 0x4C, 0x4F,
-    0x11, 0x8C, 0xB1, 0x89, 0x46, 0xAB, 0xEC, 0xC3, 0x7D, 0x52, 0x2D, 0x20, 0x48, 0x16, 0x28, 0x35,
-    0xDE, 0x1F, 0xF3, 0x27, 0x10, 0x0B, 0xBA, 0x74, 0x0F, 0x18, 0xB5, 0x59, 0x73, 0x0D, 0xA4, 0x16,
-    0x1D, 0xB1, 0x0F, 0xD6, 0xD5, 0x69, 0x98, 0x6A, 0x3D, 0x75, 0xB5, 0x0F, 0x4D, 0xE3, 0xBF, 0x98,
-    0x68, 0x25, 0x5F, 0xF7, 0x7B, 0xE0, 0x38, 0x61, 0xE6, 0x0B, 0x41, 0xA9, 0xE6, 0x05, 0x87, 0x90,
-    0x12, 0xB6, 0xCE, 0xDC, 0xA0, 0x73, 0x04, 0xE0, 0x23, 0x86, 0xD6, 0x36, 0xA8, 0x30, 0x22, 0xD3,
-    0x53, 0xBB, 0x01, 0x14, 0x37, 0x41, 0x48, 0xDF, 0xAA, 0x60, 0xC7, 0xFE, 0xCF, 0x70, 0x59, 0xFF,
-    0xC7, 0xD7, 0x0B, 0xD6, 0x8C, 0xEE, 0x12, 0xB3, 0x84, 0xC1, 0xA5, 0x9C, 0xB1, 0x82, 0xF5, 0x5C,
-    0x3F, 0xD9, 0x65, 0x2A, 0x26, 0xBD, 0x0D, 0x76, 0xC9, 0x2D, 0xD0, 0xB2, 0x99, 0x91, 0xB0, 0x07,
-    0x16, 0x67, 0x27, 0xE9, 0xC1, 0x37, 0x70, 0xA9, 0xA9, 0xFD, 0xB9, 0x18, 0xDC, 0x3C, 0xE7, 0xEE,
-    0x6F, 0x96, 0x43, 0x0B, 0x15, 0x18, 0x8A, 0xEF, 0x8F, 0x16, 0x85, 0x29, 0x8B, 0xAF, 0xC9, 0x4A,
-    0xC5, 0x58, 0x9F, 0xF0, 0xD9, 0xCD, 0x73, 0x06, 0x70, 0x60, 0x3E, 0xE2, 0xFE, 0xB0, 0x30, 0x63,
-    0xC8, 0x67, 0x6F, 0xFF, 0xD9, 0x29, 0xEF, 0x6A, 0x31, 0xC9, 0xF2, 0xBD, 0xE7, 0x89, 0xA8, 0x71,
-    0x01, 0xBD, 0x78, 0xD6, 0x85, 0x7B, 0x82, 0x6E, 0xB2, 0x6F, 0x83, 0x0A, 0xA6, 0x44, 0xB0, 0xC2,
-    0xCB, 0x67, 0x5D, 0x65, 0x57, 0xE4, 0xAE, 0x5C, 0x8B, 0xA6, 0x62, 0x50, 0x57, 0x8A, 0x41, 0x46,
-    0x74, 0x8C, 0xF1, 0x05, 0xC7, 0x6F, 0xBB, 0x41, 0x59, 0xC9, 0x1A, 0xCC, 0x49, 0xB5, 0x5C, 0x31,
-    0x32, 0xB8, 0x41, 0x09, 0xC6, 0x8B, 0x10, 0xE4, 0x19, 0x82, 0x7C, 0xCE, 0x55, 0x36, 0x12, 0xA8,
-    0x48, 0xC0, 0x7B, 0xD7, 0x8E, 0xC2, 0x2D, 0x71, 0x9C, 0x88, 0x45, 0xED, 0xA8, 0x1B, 0xB8, 0xC0,
-    0x56, 0xAC, 0x93, 0x48, 0xE0, 0x59, 0x3B, 0xD6, 0x9E, 0xD0, 0x72, 0x69, 0xD0, 0xAA, 0x84, 0x33,
-    0x37, 0x1E, 0xA1, 0x09, 0xE6, 0xF3, 0xA5, 0x65, 0x7D, 0x1C, 0x3C, 0x5F, 0x1E, 0x0C, 0x3D, 0x5A,
-    0x28, 0xEA, 0x70, 0x1D, 0xB0, 0x7C, 0x5B, 0x2E, 0x5F, 0xB8, 0xBB, 0xEC, 0x7C, 0x7D, 0xAA, 0x8A,
-    0xEC, 0x21, 0x89, 0xDB, 0x23, 0x2C, 0x74, 0x67, 0x7B, 0x6B, 0xB2, 0x01, 0x79, 0xC4, 0x01, 0xA4,
-    0x2B, 0x1A, 0x04, 0x68, 0x2E, 0x69, 0x0F, 0x91, 0x6A, 0xA8, 0x60, 0x04, 0x9A, 0xF8, 0x18, 0x0B,
-    0x90, 0x43, 0x95, 0xEA, 0x16, 0x49, 0xDC, 0xEE, 0x9B, 0x63, 0x92, 0xE8, 0xCE, 0x87, 0xD3, 0x1A,
-    0x45, 0x3A, 0x44, 0x8F, 0xC7, 0x9C, 0x37, 0x03, 0xA5, 0x00, 0x8F, 0xA4, 0x86, 0x79, 0x54, 0x8A,
-    0xA8, 0xBC, 0x54, 0x43, 0xBD, 0xAC, 0xC6, 0x63, 0x92, 0x06, 0xB2, 0x34, 0x2C, 0x9B, 0x53, 0x07,
-    0x3E, 0x40, 0xE8, 0x3A, 0xEA, 0x31, 0x13, 0x2F, 0x7F, 0x0F, 0xF9, 0x50, 0x67, 0x14, 0xAC, 0xE8,
-    0x9B, 0x94, 0x86, 0x72, 0x28, 0x5B, 0x74, 0x94, 0x8D, 0x98, 0xE5, 0x64, 0x86, 0x80, 0xD0, 0x05,
-    0x15, 0x3D, 0x00, 0x27, 0xEA, 0x68, 0x50, 0x18, 0x9F, 0xE2, 0x8E, 0x4B, 0xEE, 0xA8, 0xF9, 0xBE,
-    0xA4, 0x4C, 0xE5, 0x84, 0xE7, 0x3C, 0x20, 0x81, 0x1A, 0x29, 0x04, 0x08, 0x4C, 0x21, 0x43, 0xEB,
-    0xE4, 0xDB, 0xB7, 0x32, 0xA0, 0xEC, 0x38, 0x64, 0xC8, 0x90, 0xD8, 0x01, 0xB0, 0xA8, 0xC7, 0xB9,
-    0x6A, 0x50, 0xC0, 0x2B, 0x44, 0xF4, 0xDA, 0x40, 0xDD, 0x1E, 0x02, 0xD0, 0x6A, 0x39, 0xD4, 0x73,
-    0xD2, 0xD6, 0xB4, 0x59, 0x62, 0x09, 0x8F, 0x4C, 0x1A, 0x0D, 0x8C, 0x50, 0xF9, 0x5C, 0x9C, 0x35,
-    0x39, 0x80, 0x0F, 0x82, 0x09, 0xE0, 0x4F, 0xA9, 0x31, 0x1E, 0x62, 0x32, 0x4A, 0x8E, 0xDE, 0xD1,
-    0xA2, 0x58, 0x2C, 0x30, 0x68, 0x30, 0x38, 0x5F, 0x29, 0xDD, 0xC5, 0x9D, 0x01, 0xC9, 0x60, 0x32,
-    0x8D, 0x39, 0x95, 0xF9, 0xDC, 0x97, 0x7E, 0x82, 0xF3, 0x16, 0x37, 0xA9, 0xF3, 0xF9, 0x33, 0x83,
-    0x8C, 0xE6, 0x66, 0x36, 0xE3, 0xAE, 0x83, 0x6E, 0x23, 0x18, 0x33, 0xD4, 0x60, 0x20, 0xAA, 0xE9,
-    0xE2, 0x93, 0xDE, 0xA2, 0x0D, 0xC5, 0x09, 0x5E, 0x3A, 0x58, 0xC7, 0x16, 0x7A, 0xDB, 0x01, 0x97,
-    0x41, 0x18, 0x0D, 0x6C, 0xB4, 0x17, 0xE0, 0x96, 0xCB, 0xF4, 0x13, 0x1B, 0x57, 0xD1, 0xE8, 0xD9,
-    0xB8, 0x8E, 0xC6, 0xB0, 0xD2, 0xB3, 0x18, 0xF3, 0x34, 0x1A, 0x35, 0x1A, 0x6D, 0xB8, 0x0B, 0x5B,
-    0x5C, 0x00, 0xFA, 0x1E, 0xBC, 0xB1, 0x7F, 0x50, 0x06, 0x9F, 0x48, 0xCA, 0xAD, 0x01, 0xA8, 0x3F,
-    0x79, 0x03, 0x32, 0x25, 0xE9, 0x5E, 0x03, 0x59, 0xE5, 0xC9, 0x5B, 0x2B, 0x3D, 0x6C, 0x7C, 0xC5,
-    0x06, 0x06, 0xBF, 0xC3, 0xD5, 0xE0, 0x76, 0x65, 0x8D, 0xB7, 0xB3, 0xB3, 0x33, 0xD1, 0x1B, 0x08,
-    0x89, 0xFD, 0xA8, 0x1C, 0x56, 0xCD, 0xE5, 0x92, 0x82, 0xA3, 0x71, 0xB5, 0xA4, 0x4E, 0x68, 0x5C,
-    0xFF, 0x41, 0x83, 0xAF, 0xEC, 0xC5, 0x77, 0x55, 0xFF, 0xAE, 0xE3, 0x12, 0xB3, 0xEB, 0x3B, 0x3B,
-    0x67, 0x41, 0xCE, 0x4C, 0x28, 0xC5, 0x15, 0x00, 0x34, 0xFE, 0x2D, 0x6A, 0x9F, 0xA8, 0xED, 0x89,
-    0xF3, 0xF2, 0x07, 0xFA, 0xC3, 0xC3, 0x58, 0x44, 0x02, 0x4B, 0x88, 0xD7, 0x9F, 0x8F, 0x00, 0xB4,
-    0x71, 0x37, 0x20, 0x06, 0xE0, 0xDB, 0xC7, 0x01, 0x59, 0x9E, 0x83, 0x41, 0x94, 0x36, 0x08, 0xBA,
-    0xA2, 0xCC, 0xDC, 0xE6, 0xCC, 0xD5, 0x81, 0x3F, 0x38, 0xB8, 0x87, 0xCF, 0x93, 0x3A, 0xEC, 0xD0,
-    0xC0, 0xEE, 0xBC, 0x42, 0xDE, 0x71, 0x71, 0x3A, 0x97, 0x29, 0x55, 0xBA, 0x5C, 0xE9, 0x92, 0x25,
-    0x93, 0x62, 0x50, 0x7A, 0x4C, 0x97, 0xC2, 0x7C, 0x59, 0x7B, 0x72, 0x87, 0xFA, 0xFD, 0xE7, 0x3D,
-    0xFE, 0x0A, 0x89, 0xF3, 0x90, 0x19, 0x9E, 0x22, 0xC4, 0x32, 0xAB, 0x5D, 0x0D, 0x78, 0xED, 0x38,
-    0x51, 0xD8, 0xA5, 0x8B, 0x97, 0xBF, 0xD9, 0xCF, 0xB2, 0x6E, 0x3B, 0xED, 0x10, 0x9D, 0xB9, 0xC2,
-    0xE5, 0xD4, 0xEC, 0x14, 0xB7, 0xE8, 0x5A, 0xAF, 0xD1, 0x57, 0xCA, 0x84, 0x35, 0x30, 0x59, 0x0D,
-    0x58, 0xB7, 0xED, 0x9F, 0x24, 0x1C, 0x08, 0xC9, 0x5F, 0x3A, 0x5C, 0x46, 0x7F, 0xC0, 0x52, 0xDD,
-    0x1B, 0xB3, 0xC3, 0x91, 0xC9, 0x29, 0x2E, 0xA1, 0xB8, 0x0B, 0x5C, 0xE2, 0xFC, 0x22, 0xE9, 0xBF,
-    0x3A, 0xD2, 0x40, 0x7A, 0xCE, 0x18, 0xE1, 0xCE, 0x35, 0x5C, 0x3D, 0x60, 0x64, 0x7F, 0x01, 0xC0,
-    0x83, 0x14, 0xF4, 0x0E, 0x16, 0x0A, 0x92, 0x97, 0x5F, 0xD1, 0xAD, 0xC6, 0xED, 0x4B, 0x8E, 0xEC,
-    0x65, 0xFF, 0xA1, 0xA8, 0x93, 0x4F, 0x06, 0xDF, 0x16, 0x75, 0x76, 0xCA, 0x72, 0xE5, 0xAA, 0x4B,
-    0x3F, 0xAE, 0xCE, 0xCF, 0xB9, 0x94, 0xC9, 0x70, 0xEA, 0x80, 0x34, 0x53, 0x07, 0x40, 0x7D, 0xD1,
-    0x91, 0xEC, 0x0E, 0x01, 0xB6, 0x16, 0xC5, 0x2D, 0x54, 0xB9, 0x85, 0xE1, 0xD2, 0xDC, 0x92, 0xE3,
-    0xDF, 0x52, 0xE0, 0x17, 0x19, 0xA6, 0xA7, 0x51, 0x90, 0x30, 0x30, 0xF5, 0x1F, 0xC7, 0xF9, 0xC1,
-    0x87, 0x47, 0x9B, 0x96, 0x1E, 0x02, 0x4F, 0xAB, 0xD4, 0x81, 0xA6, 0x8E, 0x7B, 0x6D, 0x7E, 0xE3,
-    0x21, 0x00, 0x84, 0x0E, 0xBC, 0xD5, 0xC4, 0xD5, 0xAC, 0xC5, 0xE2, 0x89, 0x51, 0x01, 0x7B, 0x57,
-    0xF1, 0xEA, 0x84, 0x59, 0xF8, 0xDC, 0x87, 0x9C, 0x87, 0xA2, 0xD2, 0x48, 0x97, 0x86, 0x28, 0xF3,
-    0x2D, 0xB6, 0x2E, 0xB7, 0x6F, 0x5B, 0x17, 0x94, 0xB8, 0x58, 0x67, 0x8C, 0x2F, 0xC9, 0xE9, 0x03,
-    0x5E, 0x40, 0xAD, 0x63, 0x30, 0x75, 0x5C, 0x29, 0x9D, 0x14, 0x57, 0xAE, 0xB4, 0x62, 0x53, 0x54,
-    0xEF, 0xB9, 0x3D, 0x3C, 0xD2, 0x92, 0x35, 0xB3, 0x57, 0x64, 0x13, 0xC9, 0x42, 0x1D, 0x4F, 0x02,
-    0xD5, 0xAC, 0xFB, 0x7E, 0x20, 0xAC, 0x1B, 0x97, 0x75, 0x88, 0x7C, 0xE3, 0xC9, 0x6F, 0x2D, 0xF9,
-    0x9D, 0x42, 0xC6, 0x3B, 0x3B, 0xD2, 0x58, 0xA6, 0x87, 0xBE, 0x74, 0x77, 0x08, 0x3B, 0xEC, 0x34,
-    0xBA, 0xF4, 0x43, 0x65, 0x79, 0xEB, 0x1A, 0xC0, 0x34, 0x36, 0xB0, 0x79, 0xC2, 0x2E, 0x8D, 0x3B,
-    0xA8, 0xA0, 0x4B, 0x4A, 0x6E, 0xA3, 0xD4, 0xEF, 0xB8, 0x97, 0x8A, 0xD1, 0xC0, 0x86, 0x8A, 0x8D,
-    0x8B, 0x8B, 0x0D, 0x01, 0x7C, 0x54, 0x8D, 0x08, 0x30, 0xD6, 0x5D, 0xAE, 0xC6, 0x0A, 0xC6, 0xAD,
-    0x6A, 0x92, 0xDF, 0x2D, 0x9A, 0xA9, 0x84, 0x3C, 0x44, 0xBC, 0x04, 0x78, 0x52, 0x0B, 0xD1, 0xCF,
-    0xDD, 0x5E, 0x61, 0xA0, 0x3A, 0x28, 0x7A, 0xCF, 0x33, 0xCC, 0xDA, 0xBB, 0x91, 0xA0, 0x76, 0x3F,
-    0x22, 0xC1, 0x58, 0xF5, 0x1D, 0x33, 0x93, 0x61, 0xD7, 0x98, 0x3B, 0x00, 0x11, 0x3F, 0xE4, 0x53,
-    0x54, 0xEF, 0xFD, 0x24, 0x1F, 0x99, 0xF8, 0xD4, 0x3F, 0xA6, 0xE9, 0x31, 0x73, 0xB7, 0xD9, 0x1B,
-    0xB4, 0xC3, 0x31, 0xA7, 0x69, 0x34, 0x49, 0xF0, 0x91, 0x93, 0xA0, 0x1F, 0x35, 0x2D, 0x59, 0xBE,
-    0x7B, 0x67, 0x3C, 0x53, 0xBC, 0xAF, 0x9B, 0xE8, 0xCB, 0x7E, 0x94, 0x5A, 0x98, 0xEB, 0x38, 0xE4,
-    0xD8, 0x9E, 0x79, 0x23, 0xA7, 0xA8, 0xAB, 0x7F, 0x23, 0x27, 0x4B, 0x56, 0xEE, 0xBB, 0xE6, 0x4E,
-    0x26, 0x23, 0x6C, 0x8D, 0x85, 0x11, 0x24, 0xF1, 0x10, 0x9E, 0x06, 0x99, 0xD5, 0x95, 0x30, 0xBB,
-    0xFD, 0xF8, 0x75, 0xED, 0x2E, 0xC7, 0xEC, 0xDA, 0xF4, 0x95, 0x62, 0x8F, 0x9B, 0x63, 0x1C, 0x3A,
-    0x19, 0x8E, 0x8D, 0x43, 0xDE, 0x1E, 0x97, 0x47, 0xE7, 0x60, 0x08, 0x5B, 0x61, 0x03, 0x89, 0xD2,
-    0x3C, 0x2B, 0x7D, 0xCD, 0x51, 0x51, 0xE5, 0xD1, 0xE0, 0x77, 0x98, 0x8A, 0xAD, 0x5D, 0x8D, 0x1D,
-    0x1D, 0xF6, 0xB2, 0x79, 0x62, 0xF6, 0x0A, 0xD7, 0xA9, 0xA8, 0x75, 0x7B, 0x9E, 0x8D, 0x9D, 0x9D,
-    0xE2, 0x7F, 0x6E, 0x8F, 0xC3, 0xAF, 0xC3, 0xE3, 0xA2, 0xFD, 0x7C, 0xBC, 0xE5, 0xEE, 0x0B, 0xA1,
-    0xAC, 0xCE, 0x5A, 0x3F, 0x1D, 0xD5, 0xEB, 0x39, 0x44, 0x4B, 0xF3, 0x62, 0xE2, 0x65, 0x1C, 0xAF,
-    0x7E, 0xE4, 0xD5, 0xC0, 0x47, 0x69, 0xFE, 0x88, 0x7C, 0x9F, 0xD7, 0x74, 0x64, 0xEF, 0xBB, 0x4F,
-    0x80, 0x59, 0xB9, 0xA8, 0x52, 0xBA, 0xB4, 0x03, 0xC3, 0x37, 0xED, 0xA2, 0xB8, 0x4A, 0x4E, 0xEA,
-    0x26, 0xBF, 0x12, 0x56, 0x2F, 0xCA, 0xDA, 0x53, 0x43, 0x71, 0x5B, 0xB3, 0x4F, 0xCF, 0x8A, 0x77,
-    0x3E, 0xBB, 0xAE, 0xC5, 0x8D, 0x1E, 0x9B, 0x93, 0xE4, 0xB2, 0xA2, 0x13, 0x39, 0x68, 0xCD, 0xEF,
-    0xDD, 0xDB, 0xF3, 0xAA, 0xCF, 0x7C, 0x3C, 0x7E, 0xE5, 0xF2, 0xCB, 0x03, 0x7E, 0x81, 0x7B, 0xB6,
-    0x0A, 0xF8, 0xAB, 0x0F, 0xF4, 0x25, 0xAD, 0x18, 0x52, 0x9B, 0x74, 0x51, 0x13, 0xD6, 0x7E, 0x79,
-    0xAF, 0xB3, 0xC6, 0x2F, 0x70, 0x9E, 0xF1, 0xCB, 0xA0, 0x8A, 0x9A, 0xB8, 0x4D, 0x6D, 0x31, 0xDC,
-    0xFB, 0x4C, 0xA4, 0xA3, 0xFA, 0xD1, 0xC7, 0xCE, 0x3D, 0x70, 0xE2, 0x44, 0xD4, 0xDC, 0x3B, 0x4F,
-    0x68, 0x98, 0x3F, 0x93, 0xFF, 0x3F, 0x96, 0xF9, 0x0E, 0x6D, 0x95, 0x3F, 0x8C, 0x15, 0x37, 0x10,
-    0xC6, 0x67, 0xDF, 0xEA, 0x58, 0x09, 0x17, 0x6E, 0x42, 0x43, 0xE3, 0x36, 0xA1, 0x71, 0x9D, 0x22,
-    0x78, 0x8F, 0x2B, 0x28, 0x52, 0x84, 0xE2, 0x8E, 0x86, 0x36, 0x3D, 0x6D, 0x0A, 0xC0, 0x4B, 0x28,
-    0x29, 0x38, 0xA5, 0x4D, 0x91, 0x8B, 0x44, 0x45, 0x22, 0x5D, 0x93, 0x26, 0x12, 0x3C, 0xFB, 0xB8,
-    0x92, 0x22, 0x4B, 0xA4, 0x88, 0x82, 0x82, 0x85, 0x26, 0x8A, 0x28, 0x30, 0x8A, 0x21, 0x9B, 0xC3,
-    0xF6, 0xE4, 0xF3, 0xDE, 0x11, 0x52, 0x64, 0xDF, 0xEA, 0x3D, 0xFF, 0x9F, 0xF1, 0x7C, 0xBF, 0x99,
-    0x47, 0x67, 0xA8, 0xE1, 0xD0, 0x71, 0x92, 0x9C, 0xF5, 0x8B, 0x62, 0x0E, 0x8A, 0xBD, 0x59, 0xDC,
-    0x85, 0xCC, 0x78, 0xDB, 0xC4, 0x5D, 0xE2, 0x2F, 0xA2, 0xE3, 0x60, 0xD8, 0x2B, 0xA6, 0xE6, 0x12,
-    0xD1, 0x4F, 0x22, 0xA8, 0x81, 0x56, 0x7B, 0xCA, 0xAF, 0xDB, 0x28, 0xBD, 0x5D, 0x25, 0x31, 0x99,
-    0x3E, 0x75, 0xE1, 0x4C, 0x4F, 0xF5, 0x11, 0x89, 0x56, 0xEC, 0xC9, 0xCE, 0xA4, 0xB8, 0x6F, 0x39,
-    0x50, 0x66, 0x32, 0x77, 0x26, 0xF1, 0x3C, 0xAF, 0x92, 0x1E, 0x0D, 0xF3, 0x21, 0x73, 0x3A, 0xB7,
-    0x5F, 0x7A, 0xB2, 0x3D, 0x89, 0x40, 0x27, 0x8F, 0x63, 0x6F, 0x38, 0x48, 0x9E, 0xBB, 0x89, 0x56,
-    0x91, 0x88, 0x33, 0x19, 0x1E, 0x4F, 0xED, 0x27, 0x34, 0x89, 0x8C, 0x27, 0x19, 0x7E, 0xBE, 0x1A,
-    0x35, 0xE6, 0x39, 0xD2, 0x06, 0x4C, 0x35, 0xDB, 0xE4, 0x4A, 0xCB, 0x59, 0x96, 0x1F, 0xF5, 0x48,
-    0x66, 0x20, 0x6B, 0x47, 0xC7, 0x91, 0x9F, 0xCE, 0xF0, 0xBB, 0xD4, 0x77, 0x76, 0xDF, 0xC1, 0xEF,
-    0x49, 0x72, 0x4F, 0xDB, 0xD5, 0x44, 0xC7, 0xFC, 0x2B, 0x73, 0x70, 0x0C, 0x0F, 0x33, 0x35, 0x65,
-    0x39, 0xD9, 0xC1, 0x8F, 0xA1, 0x9E, 0x8F, 0x43, 0x54, 0x80, 0x15, 0x12, 0x33, 0x75, 0xE9, 0xD8,
-    0x29, 0xD8, 0xD1, 0xF0, 0x9E, 0x83, 0x7A, 0x91, 0xBB, 0x60, 0x37, 0x8B, 0x86, 0x93, 0x63, 0xCB,
-    0x83, 0xE0, 0x28, 0xFE, 0xE6, 0x8B, 0xB3, 0x7A, 0x9E, 0xBB, 0xD9, 0xDE, 0xCA, 0x92, 0x99, 0xB8,
-    0x54, 0x9F, 0xE8, 0x0C, 0xAE, 0x0F, 0x9B, 0xB3, 0xFE, 0x3D, 0x99, 0x21, 0xDB, 0x3E, 0xDB, 0xCD,
-    0x6C, 0x9E, 0x66, 0x83, 0x08, 0x1F, 0x25, 0x6A, 0x67, 0x98, 0xB8, 0xC7, 0x23, 0x73, 0xCF, 0x33,
-    0xED, 0xC0, 0xC6, 0x57, 0xD4, 0x04, 0xEA, 0x60, 0x1F, 0x76, 0x66, 0xE6, 0x09, 0x4D, 0x45, 0x74,
-    0x8D, 0x9A, 0x3D, 0xB2, 0xFC, 0x86, 0xF9, 0xF1, 0x4E, 0x5D, 0x05, 0x03, 0x70, 0x9D, 0xFE, 0xDB,
-    0xFA, 0x84, 0xEE, 0xAF, 0x62, 0x3B, 0x49, 0xAF, 0x7A, 0x43, 0xE7, 0xE9, 0x3A, 0xDD, 0xA7, 0x74,
-    0xF2, 0xB9, 0x8F, 0xCF, 0x67, 0x18, 0x3B, 0x4B, 0xF4, 0x25, 0x4E, 0x6B, 0x47, 0x8C, 0x69, 0x12,
-    0x7E, 0x15, 0x30, 0xA1, 0x49, 0xFA, 0x76, 0x6A, 0x22, 0x9A, 0xE7, 0xD1, 0x51, 0x83, 0xF4, 0xC2,
-    0x9F, 0x82, 0xA4, 0x5F, 0xEF, 0x89, 0x5F, 0x92, 0x2C, 0x45, 0x86, 0xB5, 0xF4, 0x6B, 0xE5, 0x1F,
-    0xE8, 0x3E, 0x19, 0x4A, 0xA6, 0x49, 0x76, 0x35, 0x43, 0xEC, 0x6D, 0xC8, 0x8F, 0x88, 0x9C, 0xD0,
-    0x52, 0xF4, 0xEB, 0x62, 0x46, 0x36, 0x07, 0xBC, 0x00, 0x53, 0xDC, 0x56, 0x76, 0x5B, 0xC9, 0x7D,
-    0x3E, 0xDB, 0x4A, 0xCB, 0x88, 0xA8, 0x37, 0x4B, 0xD4, 0x49, 0x4F, 0x1D, 0xF7, 0x2E, 0xA9, 0x1A,
-    0x79, 0xFF, 0xA6, 0x34, 0x22, 0xD6, 0x70, 0x33, 0xB5, 0x89, 0xD4, 0x84, 0xF8, 0xE3, 0x57, 0x2E,
-    0x37, 0xDB, 0xB8, 0x84, 0x68, 0xF7, 0x0B, 0x05, 0x85, 0x3C, 0x54, 0x51, 0x63, 0x9D, 0x91, 0xB1,
-    0xBE, 0x2A, 0x92, 0x0E, 0x38, 0x0B, 0x51, 0xCA, 0x8A, 0xF9, 0x22, 0x83, 0xB1, 0x63, 0x85, 0xEC,
-    0xA2, 0x90, 0xF8, 0x01, 0x9A, 0x39, 0x58, 0xF3, 0x1B, 0xB6, 0x2A, 0x04, 0xA8, 0x01, 0x76, 0xED,
-    0xE3, 0x8C, 0xF5, 0xD5, 0xA4, 0x39, 0x75, 0x88, 0x38, 0x6C, 0x2C, 0x8F, 0x05, 0x32, 0x81, 0x4C,
-    0x22, 0x53, 0x60, 0x74, 0xD0, 0xCF, 0x46, 0xF5, 0x28, 0xA8, 0xC3, 0x24, 0xC7, 0x22, 0x98, 0xDF,
-    0x02, 0xD1, 0x7B, 0xFB, 0x47, 0xD5, 0xC5, 0x8A, 0xC9, 0xF1, 0x03, 0x94, 0x14, 0x64, 0xE7, 0xD4,
-    0xC2, 0x5B, 0x18, 0xB3, 0x75, 0x67, 0x58, 0x7D, 0x9B, 0x89, 0x8E, 0x7D, 0x15, 0xF1, 0xD3, 0x2B,
-    0x08, 0x4C, 0x6A, 0x4F, 0xEC, 0xE0, 0xFE, 0x8A, 0xBD, 0xE6, 0x49, 0x1F, 0xDD, 0x05, 0x5A, 0x60,
-    0xBD, 0x3D, 0x2A, 0x0D, 0x24, 0xB6, 0x4F, 0x90, 0x09, 0x16, 0x79, 0x74, 0x90, 0x44, 0x30, 0x4F,
-    0x67, 0x9C, 0x49, 0x6E, 0x5E, 0xB2, 0x8B, 0xA8, 0x65, 0x7E, 0xCE, 0x1C, 0x2D, 0xA7, 0xFF, 0x45,
-    0x74, 0x5A, 0x10, 0x8D, 0x15, 0xD1, 0xF6, 0x3D, 0xA5, 0x4B, 0xDC, 0xE0, 0x8B, 0x7C, 0x5D, 0xBA,
-    0x68, 0x06, 0x50, 0xAA, 0x2B, 0xA5, 0x1E, 0x17, 0xEE, 0x32, 0x6F, 0x25, 0x19, 0x90, 0x0F, 0xE6,
-    0x61, 0xBD, 0x19, 0x72, 0xE6, 0x03, 0xA5, 0xB0, 0xAB, 0xDE, 0x66, 0xE3, 0x0B, 0xF6, 0xD4, 0xF7,
-    0x49, 0xD1, 0x9C, 0xC5, 0xBF, 0x94, 0xBA, 0xC9, 0x41, 0xB8, 0x99, 0x6A, 0x62, 0x43, 0x86, 0xFA,
-    0xA5, 0xA8, 0xD2, 0xC7, 0xEF, 0xBB, 0xA7, 0xD1, 0x7D, 0xC5, 0x65, 0x67, 0x07, 0x2B, 0x56, 0xCC,
-    0x8F, 0x30, 0x53, 0x9F, 0x0F, 0xCD, 0xB3, 0xA4, 0x7A, 0x59, 0x01, 0x1B, 0xDB, 0x00, 0xE2, 0x12,
-    0x88, 0x53, 0x7D, 0x37, 0x9E, 0x70, 0xD8, 0x8D, 0x14, 0x31, 0x22, 0x3C, 0xED, 0x11, 0x7D, 0x4C,
-    0xB2, 0x6F, 0xEB, 0xB8, 0xC2, 0x38, 0xD6, 0x5E, 0xC7, 0x4A, 0xE1, 0x31, 0x32, 0xA3, 0x69, 0xEA,
-    0x39, 0xC0, 0x14, 0x5B, 0x77, 0xA9, 0xC9, 0xE7, 0x04, 0xAF, 0xD5, 0xBB, 0x6C, 0x6E, 0x26, 0xDB,
-    0x24, 0xD7, 0x54, 0x38, 0x4B, 0x17, 0x9C, 0x0A, 0x16, 0xC1, 0xFE, 0x6B, 0x6C, 0xE0, 0x8E, 0xDB,
-    0x55, 0xFC, 0xB8, 0xE8, 0x3B, 0xE3, 0x0D, 0xDB, 0x41, 0xCE, 0xDB, 0xBC, 0xAB, 0x7B, 0xF0, 0xD1,
-    0x33, 0x37, 0x88, 0x2C, 0x52, 0xCA, 0x0D, 0x9A, 0x0F, 0x8A, 0xBB, 0x33, 0x5A, 0xDB, 0x94, 0xB9,
-    0x7B, 0x37, 0x22, 0x86, 0xD9, 0x89, 0xC0, 0xBC, 0x09, 0x74, 0xB6, 0x69, 0x75, 0xF7, 0xF4, 0xAE,
-    0x3E, 0x44, 0x36, 0x39, 0x12, 0xB5, 0x9E, 0x41, 0x3D, 0x28, 0xED, 0xC6, 0x5A, 0x11, 0xBA, 0x3F,
-    0x63, 0x93, 0x51, 0x0B, 0x6E, 0x2E, 0x0A, 0x34, 0x6E, 0x17, 0x45, 0xA9, 0xBB, 0x8C, 0x4E, 0xA6,
-    0x8D, 0xDC, 0x01, 0xD0, 0xA3, 0x64, 0x2E, 0xCC, 0xA6, 0xAB, 0x89, 0x80, 0x2A, 0x58, 0x85, 0xC5,
-    0x5E, 0x83, 0xE4, 0xF5, 0x54, 0xEB, 0xDB, 0x9B, 0x8C, 0xC0, 0x79, 0xF3, 0x32, 0xAA, 0x31, 0x83,
-    0x80, 0x2D, 0xD4, 0x51, 0x14, 0x50, 0x64, 0x99, 0x1A, 0xB2, 0x18, 0x4D, 0x1B, 0xE4, 0x02, 0x77,
-    0x5E, 0x36, 0x54, 0xD6, 0x6A, 0xC5, 0x8D, 0xA7, 0x77, 0xCD, 0xD6, 0xDC, 0x86, 0x4C, 0xD6, 0xF4,
-    0xE2, 0xD5, 0x48, 0xC0, 0x4C, 0xB2, 0x6F, 0xF2, 0x9A, 0xF4, 0xAD, 0xD0, 0x42, 0x78, 0x64, 0xEA,
-    0x12, 0xFF, 0x35, 0x76, 0xA6, 0x26, 0xAD, 0xE6, 0x36, 0xB6, 0xA1, 0x0B, 0x62, 0x92, 0xA3, 0xF4,
-    0xA8, 0x13, 0x5E, 0x0F, 0xA6, 0x56, 0xCE, 0xEF, 0x51, 0xB2, 0xE5, 0x7E, 0xE2, 0xC9, 0xBC, 0x64,
-    0x77, 0x90, 0x65, 0x30, 0x70, 0x62, 0x33, 0xA1, 0x8A, 0x8B, 0x09, 0x7E, 0x98, 0xAD, 0xA0, 0x87,
-    0x04, 0x57, 0xDA, 0xF0, 0xA0, 0x0D, 0xEA, 0x56, 0x44, 0xA9, 0x3F, 0xD6, 0xF5, 0x9B, 0x99, 0xDE,
-    0xB1, 0xB7, 0x2F, 0x83, 0xF6, 0x49, 0x4E, 0xF0, 0xB3, 0x12, 0x3C, 0xDD, 0x58, 0x45, 0x54, 0x0A,
-    0xE9, 0x6B, 0x7F, 0xF1, 0xFB, 0xEE, 0x03, 0x92, 0x6E, 0x6E, 0xD8, 0x7A, 0xAC, 0xAB, 0x7F, 0x12,
-    0xA8, 0x22, 0x1D, 0xE6, 0x6E, 0xB4, 0xB3, 0x08, 0x0E, 0x57, 0x1F, 0xE5, 0xB3, 0xD8, 0xCC, 0x1F,
-    0x91, 0x1E, 0xA8, 0x8D, 0x4B, 0x60, 0xBA, 0x50, 0xB1, 0x19, 0xB8, 0xA8, 0xDF, 0x1E, 0xA6, 0x9A,
-    0xEC, 0x6E, 0x6A, 0x78, 0x58, 0xA5, 0x5E, 0xDF, 0xE6, 0xE8, 0xF2, 0x71, 0x01, 0xBF, 0x06, 0x58,
-    0xAE, 0xFE, 0xE1, 0xF8, 0xCA, 0x11, 0x02, 0xBF, 0x26, 0x03, 0x24, 0xBA, 0x80, 0x3B, 0xDB, 0x28,
-    0xEB, 0x8A, 0x7F, 0x00, 0x75, 0x58, 0xBF, 0x93, 0xDD, 0x56, 0x15, 0xBE, 0x7A, 0x62, 0x57, 0x13,
-    0x6B, 0x98, 0xBB, 0x45, 0x68, 0x12, 0x06, 0xD1, 0xC2, 0x0C, 0xD1, 0x3F, 0x60, 0x72, 0x45, 0xB6,
-    0x48, 0xE1, 0x02, 0xCF, 0xE0, 0x85, 0xC2, 0x85, 0x9B, 0x14, 0x99, 0x09, 0x8C, 0xF9, 0x03, 0xE2,
-    0xE8, 0x91, 0x9D, 0xC1, 0x45, 0x8A, 0xB8, 0x08, 0x55, 0x8A, 0xB8, 0x70, 0x11, 0x36, 0x85, 0x1B,
-    0x66, 0x48, 0x61, 0xE7, 0xCA, 0xD9, 0x82, 0x82, 0xC2, 0x8A, 0x33, 0xA9, 0x28, 0x2C, 0x43, 0x0C,
-    0x8C, 0x53, 0xAC, 0x70, 0xE4, 0x58, 0xBB, 0x96, 0xEE, 0xE1, 0xFB, 0xCE, 0xD5, 0x8B, 0x03, 0x03,
-    0xAF, 0xB8, 0x7A, 0xFB, 0x74, 0x7F, 0x9C, 0xF3, 0x9D, 0xEF, 0x7C, 0xE7, 0xDC, 0x35, 0x86, 0x9F,
-    0x42, 0xAE, 0x98, 0x54, 0xA4, 0x31, 0x4E, 0x66, 0x7E, 0xE9, 0x4D, 0x39, 0x27, 0x95, 0xC1, 0x0F,
-    0x26, 0x9B, 0xF1, 0xBE, 0xEC, 0x7F, 0x78, 0x70, 0x4D, 0x1A, 0x91, 0x4F, 0x43, 0x26, 0x62, 0xC7,
-    0x52, 0x26, 0xD7, 0xF9, 0xB5, 0x91, 0x43, 0x4E, 0x3F, 0x3A, 0x3E, 0x87, 0x5F, 0xA5, 0xCB, 0x31,
-    0x54, 0xF8, 0x86, 0x15, 0xF5, 0xFD, 0xB3, 0xC6, 0x08, 0x56, 0x66, 0x13, 0x97, 0xCB, 0x88, 0xBF,
-    0xA4, 0xE3, 0xD6, 0x15, 0x0E, 0xE3, 0x6F, 0xE6, 0xD9, 0x2D, 0x0C, 0x37, 0x5E, 0xC4, 0x30, 0xBC,
-    0x6E, 0xCC, 0xF3, 0x61, 0x32, 0x2B, 0x2E, 0x2D, 0x38, 0x78, 0x91, 0x09, 0x7F, 0xBD, 0x3B, 0x64,
-    0x72, 0x94, 0x77, 0x56, 0x5E, 0xB4, 0x55, 0x39, 0xFD, 0xB8, 0x30, 0x6E, 0xC0, 0x82, 0xBA, 0x1F,
-    0x4E, 0x1B, 0x7F, 0xAF, 0xBF, 0x61, 0xFC, 0xA7, 0xDD, 0x00, 0x1B, 0x3E, 0xE9, 0x8D, 0xFC, 0xF9,
-    0xB0, 0x33, 0x72, 0x7B, 0xBF, 0x35, 0x58, 0xD0, 0x18, 0x1F, 0x6C, 0x65, 0xEA, 0xB9, 0xF8, 0x2E,
-    0x1C, 0xC2, 0x69, 0x96, 0x43, 0xC6, 0x01, 0x06, 0x7C, 0x6E, 0xD2, 0x3B, 0x83, 0x31, 0x39, 0x16,
-    0x18, 0x8B, 0x05, 0x9B, 0x4F, 0x0D, 0x0C, 0xD4, 0xF8, 0x92, 0x13, 0xE1, 0xCA, 0xB8, 0x92, 0x61,
-    0xBB, 0xCF, 0x64, 0x6D, 0x76, 0x2C, 0x5D, 0x29, 0xD4, 0x15, 0x78, 0x62, 0x5C, 0xFF, 0xDC, 0x4B,
-    0x6D, 0xDD, 0xBB, 0x9F, 0xB6, 0xBE, 0x73, 0x75, 0xE3, 0xDB, 0x1A, 0xD8, 0xB4, 0xFE, 0xF3, 0x4A,
-    0x1A, 0xDF, 0x00, 0x35, 0x38, 0x29, 0x2D, 0x96, 0xF8, 0x7B, 0x18, 0xEA, 0x87, 0x01, 0x2B, 0x24,
-    0xFC, 0x32, 0x6E, 0x6C, 0x17, 0x33, 0xB0, 0x99, 0x87, 0x2D, 0x26, 0x39, 0x4B, 0x94, 0x78, 0xAE,
-    0x5D, 0x86, 0x65, 0x4E, 0x71, 0xBC, 0x77, 0xCE, 0x94, 0x83, 0x1E, 0xB7, 0x19, 0x6A, 0xD8, 0x6C,
-    0xBC, 0x0E, 0x8C, 0x16, 0x8C, 0x5C, 0xEB, 0x90, 0x10, 0xF9, 0x15, 0x8E, 0xC5, 0xCE, 0x66, 0x19,
-    0x30, 0x83, 0xA0, 0x63, 0xB8, 0x2E, 0xBF, 0x87, 0xAB, 0xB4, 0x5E, 0x87, 0x82, 0x2E, 0x14, 0x83,
-    0x79, 0xFA, 0x61, 0xF8, 0x79, 0x68, 0x43, 0xC3, 0xC6, 0x65, 0xA9, 0x0D, 0xC9, 0x55, 0x93, 0x90,
-    0x02, 0xD1, 0x0A, 0xDD, 0x74, 0xAB, 0x3E, 0xDE, 0x33, 0x3C, 0xAD, 0xA5, 0x37, 0x08, 0xF4, 0x85,
-    0xB0, 0x87, 0x53, 0x39, 0x6B, 0x75, 0x3D, 0x1C, 0x00, 0x74, 0x91, 0xC1, 0xE4, 0x7A, 0x6C, 0x4A,
-    0x7B, 0xA2, 0xDD, 0x7A, 0x6E, 0xC6, 0xBF, 0x11, 0x55, 0x09, 0x5C, 0x2B, 0x2D, 0xCE, 0xC2, 0x0E,
-    0x08, 0x90, 0x9E, 0xF1, 0xF4, 0x63, 0x63, 0x4C, 0xF2, 0x4E, 0x1F, 0x19, 0xD7, 0x9B, 0x57, 0xD2,
-    0x93, 0xB3, 0xA6, 0xFC, 0x58, 0xFE, 0x8A, 0x8D, 0xED, 0x43, 0x09, 0x20, 0x53, 0x8A, 0x01, 0x38,
-    0x25, 0x32, 0x7B, 0xF9, 0x42, 0x2A, 0x3F, 0x5A, 0xA0, 0xDF, 0x96, 0xE0, 0x4D, 0x53, 0x0C, 0x76,
-    0x36, 0xE0, 0xE3, 0x0C, 0x9B, 0x5D, 0x9F, 0x4A, 0x22, 0x6B, 0x58, 0xC0, 0xD7, 0x79, 0x30, 0xAE,
-    0xE3, 0x4F, 0x15, 0xE6, 0x4C, 0xA9, 0x34, 0x98, 0x13, 0x56, 0xA2, 0x73, 0x2A, 0xB8, 0xCE, 0x00,
-    0xD2, 0x28, 0xCC, 0xA9, 0xE3, 0x1C, 0x87, 0x39, 0x53, 0x16, 0x9C, 0xEF, 0x09, 0x40, 0x11, 0x4D,
-    0xB5, 0xCB, 0x23, 0x9A, 0xB8, 0xBA, 0xBA, 0xC0, 0x38, 0x9A, 0x8F, 0xE0, 0xBB, 0x71, 0x6B, 0x6C,
-    0x8C, 0x77, 0xD2, 0x67, 0x83, 0xA9, 0xA7, 0x15, 0x62, 0x89, 0xCD, 0x4D, 0xFE, 0xA4, 0xC5, 0x9B,
-    0x93, 0xA1, 0x68, 0x4F, 0x89, 0x5C, 0x3F, 0xA1, 0xFB, 0x72, 0x4B, 0x34, 0x71, 0xFE, 0x35, 0xE1,
-    0xCD, 0x58, 0xF3, 0x8D, 0x3F, 0x0A, 0x4F, 0xDF, 0xB4, 0xB6, 0x77, 0x7C, 0x63, 0xEF, 0xB6, 0x66,
-    0x4E, 0x9F, 0xF4, 0xA6, 0x36, 0x7E, 0x32, 0x65, 0x53, 0x06, 0x63, 0xFB, 0x5C, 0xAA, 0x74, 0x4C,
-    0xA4, 0x4D, 0x66, 0xA4, 0x04, 0xE3, 0x77, 0xCD, 0x44, 0x2A, 0x11, 0xBF, 0x44, 0xA3, 0xB3, 0xF0,
-    0x04, 0x51, 0x78, 0xE4, 0x19, 0x43, 0x3B, 0x66, 0xC1, 0x68, 0x4E, 0x4B, 0xF3, 0x3E, 0x62, 0x01,
-    0x74, 0x6A, 0x46, 0xAF, 0x18, 0xDD, 0x1A, 0x4E, 0xE7, 0x73, 0xD1, 0x1A, 0x3B, 0xE4, 0x52, 0xC0,
-    0xF4, 0x70, 0x5D, 0xAE, 0x6B, 0x16, 0xCA, 0x5D, 0x44, 0x0C, 0x8F, 0xDF, 0xCA, 0x83, 0x0A, 0x3C,
-    0xAE, 0x5C, 0x6B, 0x8A, 0x93, 0x77, 0x4C, 0xD1, 0x6B, 0x72, 0xE7, 0xCC, 0x5B, 0x60, 0x10, 0x22,
-    0x0B, 0x10, 0x63, 0x07, 0x54, 0x38, 0x07, 0x07, 0xDA, 0xF9, 0xD7, 0x78, 0x0F, 0x26, 0x4C, 0xAB,
-    0x48, 0x49, 0x03, 0xC2, 0x02, 0xA2, 0xB5, 0xE2, 0xF5, 0x9D, 0x0D, 0xF5, 0x0C, 0x89, 0x4A, 0x56,
-    0x2E, 0xFC, 0x53, 0x32, 0x2A, 0x41, 0xEB, 0xBF, 0x0B, 0x31, 0x5E, 0x21, 0x3C, 0xCD, 0xF6, 0x59,
-    0xC3, 0x90, 0x65, 0x8C, 0x4F, 0x6F, 0xA7, 0x9A, 0xB1, 0x5F, 0xD7, 0x5F, 0xC2, 0xDF, 0x0C, 0x81,
-    0x7E, 0x6F, 0x2C, 0x4C, 0xF9, 0xC8, 0x4F, 0xBE, 0x51, 0xD6, 0xDF, 0x51, 0x02, 0x4A, 0xC8, 0x19,
-    0x34, 0x02, 0x89, 0x33, 0x3D, 0xFC, 0x28, 0xA4, 0x49, 0xC5, 0x32, 0x22, 0xA0, 0x44, 0xD9, 0xE3,
-    0x20, 0xD8, 0xEB, 0xE1, 0xF5, 0x9C, 0xC8, 0x4F, 0x28, 0x4E, 0x03, 0x19, 0xB1, 0x63, 0xEA, 0x86,
-    0x67, 0xDC, 0x3C, 0x0F, 0x8B, 0x1B, 0xF7, 0x10, 0xD6, 0xA4, 0xC1, 0xF8, 0xBF, 0x20, 0xD5, 0x8A,
-    0x21, 0x91, 0xB7, 0x64, 0xC9, 0x9E, 0x73, 0x00, 0x7A, 0x42, 0xBC, 0xF3, 0x3E, 0xEB, 0x89, 0xE6,
-    0xBA, 0x68, 0xEC, 0xC4, 0x78, 0x20, 0x22, 0xB6, 0x5F, 0xC1, 0xDA, 0x35, 0x5F, 0xDA, 0xB0, 0x62,
-    0xD4, 0x3E, 0x1A, 0x6D, 0x6F, 0x7C, 0xFA, 0xB8, 0x73, 0xD5, 0x6A, 0x2A, 0xEE, 0xBE, 0x89, 0x44,
-    0xEF, 0x6F, 0xDE, 0x04, 0x51, 0xDC, 0xFE, 0x57, 0x43, 0x5D, 0x59, 0x46, 0x1C, 0xA7, 0xE9, 0xC3,
-    0x5C, 0xF8, 0xC7, 0xA3, 0xE0, 0xCF, 0x19, 0x77, 0x71, 0xFF, 0x21, 0x10, 0x9C, 0x67, 0x7B, 0x1B,
-    0xF2, 0xF9, 0xB8, 0x77, 0x88, 0x97, 0x3D, 0x5A, 0x43, 0x2D, 0xC1, 0xAC, 0x14, 0xA1, 0x4E, 0xA4,
-    0xA7, 0x3A, 0x21, 0xB9, 0xDC, 0xA8, 0x1A, 0xC5, 0xF0, 0xD7, 0x1D, 0xC9, 0x0A, 0x8B, 0xEC, 0xA8,
-    0xF2, 0x7B, 0x62, 0x92, 0xC0, 0x4C, 0xEB, 0x10, 0xA6, 0x9A, 0xCA, 0xA6, 0x12, 0x3B, 0xA7, 0x93,
-    0xF1, 0x55, 0x1A, 0xF0, 0x10, 0xEC, 0x83, 0x68, 0xCA, 0xA9, 0xAB, 0x92, 0x83, 0x53, 0xB6, 0x17,
-    0x3B, 0xAC, 0x42, 0x81, 0x47, 0x9F, 0xCE, 0xE5, 0x3D, 0x3E, 0x26, 0x77, 0x27, 0x14, 0x1D, 0x1E,
-    0x87, 0x73, 0xD9, 0x65, 0x63, 0x7D, 0x38, 0xB9, 0x36, 0x1F, 0xEB, 0xCB, 0x93, 0x6B, 0xEC, 0xE0,
-    0x2F, 0x8F, 0x75, 0x83, 0x55, 0x67, 0x46, 0xBF, 0xE6, 0xAA, 0x41, 0x2A, 0x5D, 0x25, 0xA6, 0xBC,
-    0x13, 0x48, 0x0E, 0xAC, 0x22, 0x55, 0xDC, 0x61, 0x38, 0xF0, 0xA3, 0xA9, 0x0F, 0x85, 0x45, 0xC6,
-    0x5F, 0x8E, 0x0A, 0x76, 0x66, 0x89, 0xBA, 0x31, 0x7B, 0x4A, 0x61, 0x72, 0x54, 0x45, 0x27, 0x39,
-    0x90, 0xE3, 0x0D, 0x19, 0x9C, 0x32, 0xF9, 0xC0, 0x3F, 0x50, 0x3E, 0x40, 0x4A, 0x5E, 0x21, 0xB5,
-    0xCA, 0x00, 0x81, 0x49, 0x21, 0x08, 0x6B, 0x4E, 0x98, 0xF1, 0xE6, 0x2B, 0x6C, 0x0C, 0xED, 0xC2,
-    0x64, 0x4F, 0x14, 0x52, 0x05, 0x01, 0x11, 0x07, 0x25, 0xEB, 0x2E, 0xA1, 0xA3, 0x6B, 0x2C, 0xCC,
-    0x99, 0xE4, 0xC8, 0xD8, 0x15, 0x16, 0xD6, 0x7D, 0x81, 0x5C, 0x91, 0x27, 0xC2, 0x9D, 0xA2, 0x0A,
-    0xCE, 0x81, 0xF4, 0xD9, 0x67, 0x98, 0xCF, 0xFE, 0x87, 0x38, 0xA9, 0xF8, 0x35, 0x8B, 0xC2, 0x6D,
-    0xED, 0xED, 0x7D, 0xE3, 0xAD, 0x9F, 0x55, 0xDE, 0xFA, 0x48, 0xE2, 0x15, 0x35, 0x3C, 0x91, 0xEE,
-    0x7B, 0x46, 0x23, 0x12, 0x55, 0x9B, 0x62, 0x98, 0x5C, 0x9C, 0xF7, 0x94, 0xA2, 0xAC, 0xB6, 0x98,
-    0xBD, 0x2D, 0x9F, 0x81, 0x46, 0xA0, 0xA0, 0x59, 0xF9, 0xF0, 0xFE, 0x22, 0xD9, 0x8E, 0xB8, 0x98,
-    0x98, 0xBA, 0x14, 0xC0, 0x7C, 0xD6, 0xA3, 0xDB, 0xED, 0x05, 0x87, 0x9C, 0x2B, 0x8D, 0x56, 0x91,
-    0x4C, 0x13, 0x7D, 0xAB, 0xD2, 0xF4, 0x36, 0x1E, 0x1A, 0xD1, 0x65, 0x5A, 0x0C, 0x1C, 0xDD, 0x5E,
-    0xF1, 0x98, 0x9E, 0xA5, 0x4B, 0xD6, 0xB0, 0x23, 0x0B, 0x36, 0x10, 0x5A, 0xCF, 0xD5, 0x87, 0x9A,
-    0x23, 0x6E, 0x80, 0x49, 0x41, 0x3E, 0x23, 0xCC, 0xD8, 0x8F, 0xF4, 0xEB, 0xE9, 0x24, 0x11, 0x25,
-    0xAC, 0x89, 0xEC, 0x0B, 0x0D, 0xA0, 0x86, 0xBB, 0x9E, 0xF5, 0x4F, 0x9A, 0x9A, 0x4E, 0xD2, 0xBC,
-    0x62, 0xA4, 0xCA, 0x43, 0x57, 0x15, 0x68, 0x1C, 0x43, 0xA0, 0x07, 0x8A, 0x90, 0x4C, 0xC4, 0x68,
-    0xE2, 0xA6, 0x23, 0x87, 0x61, 0xEB, 0x17, 0xF2, 0xBB, 0xB3, 0x9B, 0xFA, 0xF4, 0x23, 0x0E, 0x81,
-    0xC6, 0x0F, 0x8B, 0x1E, 0x58, 0xED, 0x33, 0xA6, 0x1D, 0x9C, 0x37, 0xFE, 0x81, 0xFE, 0x8D, 0xA6,
-    0xF0, 0xB0, 0xF8, 0x19, 0x17, 0x36, 0x20, 0x50, 0x0A, 0x72, 0xA5, 0x37, 0x81, 0xB9, 0xC4, 0xE1,
-    0xFB, 0x1C, 0x12, 0xAE, 0x57, 0x4A, 0x7C, 0x1D, 0x24, 0xAF, 0xB2, 0xB1, 0x84, 0x53, 0xE5, 0x25,
-    0xCA, 0x61, 0x21, 0x51, 0x1E, 0xD3, 0x2B, 0x89, 0x9F, 0xE2, 0xDC, 0x4C, 0x67, 0x40, 0xFE, 0x6B,
-    0xAD, 0x34, 0xBE, 0x51, 0xAC, 0x71, 0xA2, 0x6E, 0x4B, 0x4C, 0x29, 0x68, 0xD4, 0x4C, 0xAD, 0x62,
-    0x38, 0x27, 0x55, 0x7E, 0x4A, 0x83, 0x09, 0x80, 0x1D, 0xA6, 0xA1, 0xEC, 0x48, 0xC5, 0x89, 0x28,
-    0x1A, 0x23, 0x26, 0x16, 0x93, 0x3B, 0x11, 0x66, 0x1F, 0x32, 0xA8, 0x6C, 0x51, 0x40, 0x90, 0x10,
-    0xD9, 0xE8, 0xA0, 0xD8, 0xBB, 0x93, 0x09, 0x6C, 0x9F, 0x7E, 0x23, 0xA6, 0x7E, 0x99, 0xC6, 0xF9,
-    0xC6, 0x7D, 0x4C, 0xAC, 0x5D, 0xF0, 0x3D, 0x8B, 0x38, 0xA0, 0xEA, 0x1D, 0x7B, 0x94, 0x10, 0x3D,
-    0x48, 0xC2, 0xD6, 0xC2, 0xAE, 0xA8, 0x99, 0xA4, 0x71, 0xAC, 0x3D, 0x7D, 0x7C, 0xA6, 0x8B, 0x1B,
-    0x49, 0x30, 0xFF, 0x7B, 0x62, 0x2C, 0x51, 0xF4, 0x3A, 0x51, 0x52, 0x39, 0x92, 0x26, 0x17, 0xF2,
-    0x51, 0x6E, 0x05, 0x56, 0xAD, 0xA2, 0xC3, 0xFB, 0x97, 0x94, 0x17, 0x58, 0xB4, 0x92, 0x97, 0x27,
-    0xF6, 0x07, 0xC0, 0x33, 0x91, 0xF7, 0xB4, 0xB0, 0x4C, 0x8A, 0x60, 0xC5, 0x65, 0x34, 0xAA, 0x06,
-    0x07, 0x9E, 0x61, 0xDC, 0x93, 0x8E, 0x9A, 0xE3, 0x50, 0x78, 0x8D, 0x7D, 0x2C, 0xDA, 0xC0, 0xE1,
-    0x9C, 0x5A, 0xFE, 0x84, 0xF2, 0x74, 0x77, 0x80, 0x08, 0x8D, 0x6F, 0x20, 0xDE, 0x3E, 0x5D, 0x33,
-    0x7C, 0x3B, 0x1A, 0xFA, 0x18, 0xC9, 0x98, 0xE1, 0xB4, 0x29, 0xD5, 0xCD, 0x1D, 0x0D, 0x4B, 0x75,
-    0x73, 0xF7, 0xB9, 0x2A, 0xD6, 0xB5, 0xA5, 0x21, 0xC9, 0x62, 0x1A, 0xD1, 0x72, 0x7F, 0xCB, 0xF7,
-    0x49, 0xFD, 0xE8, 0xC2, 0x5C, 0x91, 0x9D, 0xBD, 0x8B, 0x2D, 0x1A, 0x37, 0x44, 0xB5, 0x9D, 0xB4,
-    0x68, 0x36, 0xFA, 0x86, 0x75, 0x7F, 0xBD, 0x92, 0x77, 0x63, 0x87, 0xD4, 0xC6, 0x8C, 0xB1, 0x74,
-    0x20, 0x0B, 0xD7, 0x54, 0x16, 0xCD, 0x26, 0xB7, 0xBA, 0x4D, 0x2B, 0xA4, 0x41, 0x8F, 0x6F, 0xF0,
-    0x79, 0x4E, 0x91, 0xA5, 0xA5, 0xCF, 0x53, 0x80, 0xB4, 0x27, 0xCD, 0x37, 0x3D, 0x0B, 0x44, 0x53,
-    0xA6, 0x8B, 0x55, 0x21, 0x17, 0xD6, 0xF0, 0xE9, 0x63, 0xAC, 0xF6, 0x7D, 0xC9, 0x7E, 0x09, 0x0B,
-    0x20, 0x3B, 0x2F, 0xB2, 0x49, 0xCC, 0xEE, 0xEF, 0xED, 0xA2, 0x27, 0x91, 0xD1, 0x0D, 0x38, 0x78,
-    0x17, 0xB9, 0x02, 0x83, 0x7B, 0xFB, 0x85, 0xA0, 0xD1, 0x18, 0xD8, 0x5D, 0x94, 0x19, 0xCA, 0xFC,
-    0x6E, 0xCF, 0x86, 0xC5, 0xA1, 0x64, 0xC8, 0x93, 0x7B, 0x70, 0x82, 0x1E, 0x69, 0x02, 0x56, 0x46,
-    0xF5, 0x11, 0x7E, 0xFF, 0x13, 0x61, 0x3B, 0x56, 0x39, 0x24, 0xBD, 0x93, 0xA5, 0xD3, 0x50, 0xA4,
-    0xF2, 0xE8, 0x82, 0xA8, 0xE1, 0xDA, 0xDD, 0x51, 0x13, 0x60, 0x1C, 0x7E, 0x4E, 0x67, 0x86, 0xAB,
-    0xFC, 0x92, 0x5E, 0xC9, 0xDB, 0xA3, 0xE6, 0xB6, 0x74, 0x5A, 0x5A, 0xD6, 0x1F, 0xC8, 0x07, 0xF2,
-    0x3E, 0xC8, 0x4C, 0xF9, 0xC4, 0xF9, 0x3D, 0xCF, 0x92, 0xD8, 0x74, 0x8C, 0x10, 0xA3, 0xF3, 0xA1,
-    0x02, 0x18, 0x00, 0x05, 0xC0, 0xBA, 0x96, 0x69, 0xA5, 0xDD, 0x13, 0xEB, 0x5F, 0xAB, 0x05, 0x98,
-    0x31, 0x44, 0x8E, 0x9B, 0x4D, 0xDB, 0x96, 0x10, 0x22, 0x15, 0x2C, 0x56, 0x18, 0xF6, 0x76, 0x10,
-    0xE0, 0x2B, 0xF5, 0x60, 0xBE, 0xB5, 0xB4, 0x9A, 0x5A, 0x83, 0x86, 0x53, 0x07, 0x07, 0xFE, 0x98,
-    0x8D, 0xDF, 0x5C, 0x2A, 0x88, 0x25, 0xF3, 0x9F, 0x0B, 0x5E, 0x13, 0x79, 0x70, 0xCD, 0x53, 0x22,
-    0x38, 0xF4, 0x71, 0x7A, 0xBF, 0x69, 0x3B, 0xCB, 0xC9, 0xFC, 0x2A, 0xB6, 0xC6, 0xB9, 0xC4, 0xCB,
-    0x09, 0xAF, 0x17, 0x04, 0x20, 0x89, 0xDA, 0xFB, 0x2C, 0x07, 0xBA, 0x7F, 0x91, 0xFA, 0xB6, 0xB4,
-    0x94, 0x33, 0x9D, 0x82, 0xF8, 0x3D, 0x7E, 0x88, 0x2B, 0xC4, 0x7E, 0xB7, 0x63, 0x43, 0x06, 0xB5,
-    0x9F, 0x72, 0x90, 0x61, 0xB0, 0x54, 0x44, 0x0C, 0x75, 0x67, 0x41, 0xAA, 0xB6, 0x60, 0xB3, 0x5E,
-    0xF2, 0xB2, 0xE3, 0xCC, 0x66, 0x78, 0x83, 0xC3, 0x4D, 0x32, 0xF4, 0x06, 0xA3, 0x4B, 0xE5, 0x9B,
-    0xA7, 0xFF, 0xD3, 0xC0, 0x6B, 0x83, 0x9A, 0x31, 0x20, 0xDB, 0xEB, 0xAF, 0xF3, 0x2D, 0x1D, 0x68,
-    0x52, 0x8E, 0x16, 0x80, 0x99, 0xCA, 0x1C, 0x2D, 0x7B, 0xAB, 0x45, 0x61, 0xD1, 0x44, 0x99, 0x0A,
-    0x05, 0xFC, 0x94, 0x3C, 0xF0, 0x27, 0x57, 0x01, 0x31, 0x5A, 0x7B, 0x68, 0x90, 0x67, 0xFE, 0x55,
-    0x5A, 0x82, 0xCC, 0x32, 0xAE, 0xC1, 0xDA, 0x84, 0xDC, 0x9D, 0x19, 0x8B, 0x5C, 0x03, 0x60, 0xBF,
-    0x31, 0x52, 0x82, 0x8F, 0x80, 0x15, 0x4C, 0xC2, 0x21, 0x38, 0x41, 0x15, 0x49, 0x13, 0x6C, 0xAB,
-    0xFA, 0xA6, 0x02, 0x1C, 0x2B, 0x67, 0xC8, 0x91, 0x7C, 0x29, 0x1C, 0x84, 0x12, 0x3D, 0x44, 0xB1,
-    0x49, 0x07, 0x13, 0x25, 0x50, 0x2F, 0x3A, 0x4B, 0xFB, 0x6E, 0x62, 0xAB, 0x53, 0xA8, 0x16, 0x46,
-    0x9A, 0x01, 0x86, 0xE6, 0xE9, 0x1F, 0x45, 0xCC, 0x19, 0x94, 0xA6, 0x2B, 0xAF, 0x3E, 0x67, 0xC7,
-    0x34, 0xD4, 0xD7, 0xFF, 0x16, 0x56, 0x77, 0x9F, 0x84, 0x49, 0xAA, 0x3F, 0x0E, 0x33, 0xAE, 0x47,
-    0x50, 0x43, 0x8B, 0x76, 0x5D, 0x8E, 0x2E, 0xE3, 0x6C, 0x52, 0xB0, 0x33, 0xF9, 0x91, 0xF0, 0xC6,
-    0xD9, 0xDF, 0xAC, 0x19, 0x3B, 0xC7, 0x76, 0xFA, 0x07, 0xA7, 0x5E, 0xBA, 0xA2, 0x36, 0xC9, 0x48,
-    0x7E, 0x74, 0x44, 0x67, 0x97, 0x38, 0xA1, 0xC8, 0xC6, 0x2A, 0x9B, 0xE0, 0xCB, 0x39, 0xBB, 0x49,
-    0x7D, 0xED, 0x8F, 0x73, 0xCD, 0x18, 0x15, 0x16, 0xA5, 0x8D, 0x6F, 0x97, 0x7B, 0x8A, 0x4A, 0x35,
-    0xBD, 0x51, 0x11, 0xD7, 0xE4, 0x8E, 0x25, 0x84, 0x37, 0xDA, 0xFF, 0x9A, 0x0E, 0x75, 0x40, 0x4F,
-    0x34, 0x65, 0x82, 0xFB, 0xCB, 0x6B, 0x84, 0x47, 0x3D, 0x47, 0xA1, 0x43, 0x84, 0x82, 0x4A, 0xDA,
-    0xD6, 0xCF, 0xE5, 0x9D, 0xB8, 0xC1, 0xC5, 0x10, 0xEF, 0xC9, 0x24, 0x60, 0xCE, 0xD6, 0x95, 0x37,
-    0x32, 0x3D, 0x51, 0x2F, 0x86, 0xDC, 0x3E, 0xDF, 0xD4, 0x2B, 0xAD, 0x48, 0x8A, 0x25, 0x85, 0x4E,
-    0x4F, 0xCD, 0xC7, 0x45, 0x74, 0x12, 0x55, 0xD3, 0x09, 0x8C, 0x29, 0x9F, 0x68, 0x1A, 0x0C, 0xA0,
-    0xEF, 0x31, 0x76, 0x62, 0x0F, 0x27, 0xCD, 0xAB, 0xE6, 0x67, 0x14, 0x68, 0x6A, 0xD6, 0x36, 0x91,
-    0x72, 0x5A, 0x87, 0xB1, 0xD5, 0x96, 0x63, 0x9F, 0x89, 0x84, 0x64, 0x99, 0xA9, 0x91, 0xBC, 0xCA,
-    0x13, 0x07, 0x0A, 0xE4, 0xAA, 0x1F, 0x13, 0xDB, 0xBB, 0x66, 0x45, 0x54, 0x2C, 0xF3, 0x2B, 0x39,
-    0xF7, 0xB4, 0x6F, 0xD1, 0x81, 0x20, 0x4C, 0xA0, 0xB7, 0xB9, 0x44, 0xD0, 0xCB, 0x5D, 0x5E, 0x82,
-    0x1F, 0x8D, 0xF1, 0x5E, 0x26, 0xB8, 0xC7, 0x82, 0x13, 0x4A, 0xCF, 0x46, 0x13, 0xD2, 0x8C, 0x06,
-    0xDD, 0xEC, 0x25, 0xCC, 0xA9, 0xCA, 0xFC, 0xDB, 0x69, 0x6B, 0x6F, 0x1F, 0xDD, 0xC2, 0x91, 0x72,
-    0x8C, 0x56, 0xF1, 0xEE, 0x11, 0x4A, 0xFD, 0x9B, 0x6F, 0xA2, 0x99, 0x23, 0x1B, 0xF4, 0x7A, 0xE1,
-    0xA4, 0x7A, 0xD6, 0x6C, 0x97, 0x91, 0x56, 0x62, 0x96, 0x42, 0x9D, 0xA9, 0x5A, 0x25, 0x0B, 0x0D,
-    0x63, 0x99, 0xB2, 0xB1, 0xDF, 0x73, 0xB1, 0xC6, 0x45, 0xA6, 0xE5, 0xB1, 0x92, 0xB9, 0x58, 0xD8,
-    0x94, 0x70, 0xDB, 0xDA, 0x18, 0xC6, 0x3B, 0xA3, 0x52, 0x47, 0x34, 0x5E, 0xCC, 0x71, 0x94, 0xD1,
-    0x1A, 0xBA, 0xD9, 0xD4, 0x2D, 0x92, 0x19, 0xCD, 0x3B, 0x82, 0x89, 0x02, 0x8B, 0x94, 0x47, 0x17,
-    0x8F, 0x9B, 0xCC, 0x84, 0x98, 0xE3, 0x0B, 0x44, 0x57, 0x2F, 0x3B, 0xB8, 0xE2, 0xF4, 0x68, 0x74,
-    0x83, 0xCA, 0xBD, 0x0A, 0xBE, 0xE7, 0x55, 0x1D, 0xBB, 0x2D, 0x74, 0x51, 0xC2, 0x38, 0x16, 0xC2,
-    0xC0, 0xC6, 0x6B, 0x39, 0xAF, 0x5B, 0xA4, 0x7F, 0x3E, 0x2F, 0xB8, 0xD3, 0x91, 0x50, 0x2C, 0x35,
-    0x6C, 0xAF, 0x71, 0x93, 0x18, 0x62, 0x27, 0xC9, 0xA2, 0x00, 0x5C, 0x99, 0xCE, 0x03, 0xF9, 0xC8,
-    0x44, 0x04, 0x72, 0x5A, 0x79, 0x32, 0xD9, 0xB8, 0x92, 0xF8, 0xFB, 0xD5, 0x72, 0xBB, 0x59, 0x14,
-    0x4C, 0xEB, 0x2B, 0x9D, 0xAC, 0xDB, 0x8D, 0xE0, 0x7D, 0xFD, 0x39, 0xCD, 0x94, 0x4C, 0xFA, 0x0F,
-    0x89, 0x8A, 0xFE, 0x8B, 0xA2, 0x26, 0x44, 0x35, 0xB7, 0xCC, 0x37, 0xE5, 0x81, 0xFF, 0x2B, 0x38,
-    0x86, 0x45, 0x68, 0x92, 0xFA, 0x2A, 0x93, 0xB7, 0x33, 0xC8, 0xDA, 0xF4, 0xFA, 0x0B, 0xD8, 0xFF,
-    0x4E, 0xC7, 0x0E, 0xCC, 0xEE, 0xB6, 0x91, 0x94, 0x4A, 0xF3, 0x25, 0x9D, 0x63, 0x6F, 0xA3, 0xC2,
-    0xBA, 0x80, 0xBF, 0xF4, 0x47, 0xB1, 0x07, 0x8A, 0x79, 0x0D, 0x4B, 0xA3, 0x44, 0x6B, 0xD1, 0x50,
-    0xC0, 0xD7, 0xC5, 0xA6, 0x83, 0xE2, 0xE7, 0xC3, 0xD3, 0xD8, 0xEF, 0x13, 0xB6, 0x06, 0x67, 0xD6,
-    0xB0, 0xE2, 0x23, 0x9A, 0x16, 0x18, 0xA6, 0x10, 0xD5, 0xD1, 0xDD, 0x27, 0x00, 0x15, 0x2E, 0x66,
-    0x50, 0xA8, 0x0A, 0xCA, 0x37, 0x69, 0xCF, 0x98, 0x06, 0x5C, 0xA7, 0x0A, 0x2A, 0x50, 0xAD, 0x9D,
-    0x3A, 0xC5, 0x34, 0xA0, 0x0D, 0x43, 0x3D, 0x1C, 0xD8, 0x7F, 0x21, 0x6A, 0x30, 0x01, 0x11, 0xC3,
-    0x75, 0x73, 0x0D, 0x4E, 0x07, 0xB4, 0x66, 0xCC, 0x41, 0xDE, 0x55, 0xC8, 0xBA, 0x10, 0x8B, 0x78,
-    0xD2, 0xC3, 0xFC, 0x6C, 0x1F, 0xB6, 0xBE, 0x40, 0x98, 0x76, 0x76, 0x8C, 0xF9, 0x37, 0xD3, 0xFF,
-    0xFF, 0xF9, 0xFF, 0x3F, 0xFB, 0xFF, 0xD7, 0xFF, 0xFF, 0x65, 0x60, 0x60, 0x00, 0x00, 0x45, 0xCF,
-    0xBD, 0x09, 0x02, 0x41, 0x10, 0xC5, 0xF1, 0x07, 0x07, 0x1A, 0x88, 0x4C, 0x09, 0x96, 0x70, 0x89,
-    0xF9, 0x6C, 0x1F, 0x57, 0x8C, 0x96, 0x63, 0x17, 0xA7, 0x9D, 0x5C, 0x60, 0x01, 0x17, 0x6C, 0x60,
-    0x32, 0x3C, 0xE7, 0x63, 0xD1, 0x4D, 0x7E, 0xFC, 0xE1, 0x31, 0xB0, 0xC0, 0xEF, 0x9D, 0x87, 0x56,
-    0xC8, 0x90, 0xA5, 0x0C, 0x59, 0xCA, 0xFB, 0x90, 0x7E, 0x6A, 0x2F, 0x5B, 0xC9, 0xD7, 0x63, 0xB2,
-    0x18, 0xAF, 0xFD, 0x64, 0x31, 0xE6, 0x36, 0x9B, 0x27, 0x19, 0x77, 0x9C, 0xFD, 0x48, 0xCB, 0xBC,
-    0xD1, 0x34, 0x93, 0xDD, 0xBD, 0xAF, 0x64, 0x53, 0xDA, 0xE4, 0x09, 0x65, 0xBF, 0x78, 0xBA, 0x8C,
-    0x2C, 0x5B, 0xB8, 0x44, 0x42, 0x77, 0x89, 0x84, 0x3E, 0xE7, 0x48, 0x28, 0x32, 0xA1, 0x4B, 0xA6,
-    0xEF, 0x5A, 0x59, 0x09, 0xAD, 0xC4, 0xF5, 0xFF, 0x57, 0x7C, 0x01,
+static const uint8_t notosans_16_bolditalicBitmaps[40161] = {
+    0xCD, 0x9C, 0xBF, 0xEF, 0x2E, 0x49, 0x95, 0xDE, 0x3F, 0xDD, 0xC5, 0xBD, 0x8D, 0xB7, 0x25, 0xD7,
+    0x04, 0x33, 0xC1, 0x82, 0xE4, 0xCE, 0x59, 0xD9, 0x1D, 0x5B, 0xB2, 0x5D, 0x0D, 0x13, 0x10, 0x10,
+    0xCC, 0x0D, 0xE6, 0x5A, 0xB6, 0x08, 0x48, 0x16, 0xC9, 0x8B, 0xA5, 0xBD, 0x81, 0x9D, 0x58, 0xB2,
+    0xB6, 0x7A, 0xC0, 0x12, 0xC1, 0x06, 0x5C, 0x59, 0xEB, 0x68, 0x03, 0x08, 0x58, 0x09, 0xEE, 0x06,
+    0xFC, 0x05, 0x50, 0x05, 0x13, 0x4C, 0x30, 0xC1, 0x34, 0xA0, 0xD5, 0x06, 0x04, 0x34, 0x30, 0xBB,
+    0x2B, 0x86, 0xE0, 0x16, 0x6C, 0x0F, 0x53, 0xF7, 0x4E, 0x75, 0x3F, 0x1B, 0x54, 0xBF, 0xDF, 0x1F,
+    0xC3, 0x05, 0xBC, 0xB2, 0x07, 0xE6, 0xD5, 0x7D, 0xDF, 0xEF, 0xFB, 0x76, 0xF7, 0xFB, 0xD6, 0xE9,
+    0x53, 0xA7, 0xCE, 0x79, 0x9E, 0x73, 0x4E, 0x5D, 0xDC, 0xD6, 0x68, 0xE9, 0xC4, 0x98, 0xD1, 0x62,
+    0x84, 0x2D, 0xF8, 0xB5, 0xD1, 0xD4, 0x17, 0x5C, 0x42, 0xB3, 0xD9, 0x19, 0x12, 0x3E, 0xB6, 0x07,
+    0xCD, 0x3D, 0x00, 0xE8, 0x32, 0x2E, 0xB5, 0x8A, 0xBD, 0xB0, 0x1B, 0x77, 0x60, 0x58, 0xF5, 0xA9,
+    0xEC, 0x5E, 0xDD, 0x87, 0xA4, 0x2E, 0xBB, 0xCF, 0xEF, 0xC3, 0x12, 0xBA, 0xE4, 0x3E, 0x5F, 0xEC,
+    0xF2, 0x4D, 0x93, 0x80, 0x71, 0xFE, 0x26, 0x98, 0x6C, 0x17, 0x70, 0x1F, 0x2F, 0xD0, 0xA7, 0x31,
+    0xC2, 0x61, 0x36, 0xB0, 0x8B, 0x87, 0x66, 0xEF, 0x13, 0x5E, 0xD2, 0xD1, 0x49, 0xD2, 0xEA, 0x25,
+    0xED, 0xF4, 0x9B, 0xBB, 0x7D, 0x55, 0xE9, 0x13, 0x4E, 0x92, 0x8C, 0x24, 0x25, 0x2F, 0xE9, 0x68,
+    0x3E, 0xFD, 0xB6, 0xFF, 0x9B, 0x09, 0xDD, 0xBE, 0x8A, 0x31, 0x1E, 0x57, 0x23, 0x7E, 0xA2, 0x00,
+    0x70, 0x0F, 0xE8, 0x22, 0xF0, 0x6F, 0x80, 0x8F, 0x1E, 0x13, 0xBD, 0x94, 0x90, 0x14, 0xAD, 0xB4,
+    0xE3, 0xDF, 0xF9, 0xFB, 0xD4, 0xEA, 0xA5, 0x89, 0xBE, 0xFC, 0x3B, 0x18, 0x9F, 0x24, 0xF0, 0x9A,
+    0x41, 0xF5, 0x65, 0x81, 0xA0, 0x15, 0xC6, 0xFA, 0x6E, 0xC6, 0xFC, 0xAD, 0xC0, 0xDA, 0xF2, 0x2F,
+    0xF8, 0x9F, 0x7E, 0x75, 0xFF, 0xFB, 0x1D, 0x4D, 0x92, 0x8A, 0x91, 0x14, 0x7B, 0x29, 0xC3, 0x83,
+    0x9F, 0x9E, 0x63, 0xB1, 0x01, 0x26, 0x72, 0xF5, 0x08, 0x0B, 0x6D, 0x66, 0xD0, 0xC2, 0xB0, 0x20,
+    0xC5, 0xE6, 0xC0, 0xEE, 0xC2, 0x26, 0xDC, 0x77, 0x76, 0x02, 0xED, 0xD1, 0x6F, 0xDD, 0x86, 0xDD,
+    0xDC, 0xE2, 0x66, 0x5C, 0x94, 0x29, 0x20, 0x53, 0xC6, 0x88, 0x29, 0xC3, 0x8F, 0xF6, 0x3F, 0x78,
+    0x68, 0x93, 0x5E, 0xFA, 0xB1, 0x92, 0x7B, 0x5C, 0xE4, 0xB4, 0x06, 0xBD, 0xFE, 0x0B, 0x29, 0xAA,
+    0xF8, 0x97, 0x36, 0x4D, 0x7F, 0xFA, 0x62, 0xF6, 0x9F, 0xDF, 0xC1, 0x7D, 0x67, 0xEF, 0x37, 0xDA,
+    0x62, 0x93, 0x8B, 0x0C, 0x8B, 0x8B, 0x82, 0x03, 0x75, 0x05, 0x9B, 0x4C, 0x19, 0x17, 0xC2, 0x64,
+    0x7F, 0x2E, 0xBA, 0x8C, 0xD3, 0x86, 0x8B, 0x78, 0xCD, 0xA6, 0x80, 0xDF, 0x00, 0xF8, 0xD0, 0x95,
+    0xB8, 0xAD, 0x56, 0xC0, 0x6B, 0x03, 0x23, 0x25, 0x70, 0x87, 0x16, 0xD0, 0xAC, 0x99, 0xAE, 0x98,
+    0x03, 0x86, 0x34, 0x6C, 0xE0, 0xA3, 0x22, 0xE8, 0xCB, 0x3B, 0x18, 0x69, 0x81, 0x4E, 0x3B, 0xE0,
+    0x35, 0x8D, 0xC9, 0xAA, 0xA0, 0x59, 0x2A, 0x7D, 0xB1, 0x72, 0xD9, 0xAD, 0x3E, 0xB9, 0x77, 0xD4,
+    0x6A, 0xF2, 0xDA, 0xEC, 0x4E, 0x50, 0x74, 0x1B, 0x2A, 0x28, 0x75, 0x5A, 0x5A, 0x49, 0x8A, 0x46,
+    0x92, 0x62, 0x27, 0xBD, 0xAB, 0xA9, 0xD5, 0xD1, 0x0B, 0x5E, 0x00, 0x18, 0x7E, 0x7C, 0xB8, 0xEF,
+    0x17, 0xF7, 0xC5, 0xCD, 0xF7, 0xE9, 0x9B, 0x40, 0x98, 0xD0, 0x4C, 0x98, 0xF1, 0x11, 0xB7, 0xE0,
+    0x56, 0x86, 0x84, 0xCD, 0x74, 0x05, 0x73, 0xD0, 0x08, 0x42, 0xC4, 0xAD, 0xD8, 0x8D, 0xAE, 0xD0,
+    0x0A, 0xC2, 0xCC, 0xB8, 0x62, 0x33, 0xE6, 0x00, 0xCD, 0x8C, 0x2B, 0x7D, 0xA6, 0x11, 0xB8, 0x88,
+    0x4D, 0xB4, 0xFB, 0xE5, 0x1D, 0x2F, 0x9F, 0x3A, 0x70, 0x91, 0xE6, 0x00, 0x9B, 0x40, 0x60, 0x37,
+    0x08, 0x33, 0x5D, 0x01, 0x1F, 0xE9, 0x0A, 0xB8, 0x88, 0xB9, 0xFE, 0xE4, 0x23, 0x7D, 0x01, 0xCD,
+    0xD8, 0x8D, 0x46, 0x30, 0x26, 0xCC, 0x0E, 0x3E, 0x62, 0xCF, 0x81, 0x16, 0xFA, 0x72, 0x79, 0x67,
+    0x33, 0xED, 0x01, 0x2F, 0x4C, 0x17, 0x33, 0x75, 0x4B, 0x1D, 0xCA, 0x64, 0xFE, 0x25, 0x3B, 0x5D,
+    0x76, 0x18, 0x69, 0x7E, 0x3E, 0x48, 0xC2, 0x4B, 0x73, 0x27, 0xAD, 0xBD, 0xBE, 0xFB, 0xC7, 0xFD,
+    0x51, 0xE8, 0x8B, 0xA7, 0x3D, 0xEC, 0xCA, 0x60, 0x0A, 0x0D, 0x61, 0xAA, 0x73, 0x67, 0x32, 0x70,
+    0x00, 0x6E, 0x06, 0xBB, 0x5E, 0x1D, 0x68, 0x1F, 0x85, 0xB7, 0xBE, 0x26, 0x49, 0x4E, 0xD2, 0x1B,
+    0x92, 0xD2, 0x7B, 0xAF, 0xB8, 0xFE, 0x4A, 0x73, 0x0F, 0x5A, 0x4D, 0x8A, 0x7E, 0x19, 0x93, 0xDD,
+    0xBA, 0x62, 0x4A, 0x73, 0xF0, 0x02, 0x8C, 0xFA, 0x47, 0x1D, 0x4E, 0x7F, 0xAB, 0x1D, 0x00, 0xFF,
+    0x49, 0x8D, 0x25, 0xFC, 0x5C, 0xD3, 0x3D, 0x80, 0x61, 0x03, 0x34, 0x43, 0x57, 0x00, 0xB7, 0x42,
+    0x2B, 0xC0, 0x66, 0x20, 0x44, 0x30, 0x3B, 0x30, 0x26, 0x68, 0x34, 0x9D, 0x87, 0x7D, 0x04, 0x73,
+    0x9C, 0x87, 0xD1, 0x04, 0x7D, 0x39, 0xF5, 0x60, 0xF4, 0x1B, 0x7E, 0x72, 0xE3, 0xD6, 0x63, 0x3C,
+    0x60, 0x50, 0xA1, 0x93, 0x52, 0x23, 0x69, 0x72, 0x79, 0xCC, 0xBD, 0x50, 0x54, 0xB4, 0x65, 0xC8,
+    0xE8, 0x55, 0x4D, 0xB6, 0xB8, 0x84, 0x5E, 0x13, 0xB6, 0x84, 0x15, 0xBD, 0xBE, 0x33, 0x64, 0xC5,
+    0x56, 0x5F, 0x2A, 0xB8, 0x4D, 0xD1, 0xC8, 0x16, 0xFC, 0xAA, 0x68, 0x77, 0x5B, 0x1A, 0xC5, 0xB0,
+    0xFA, 0xAD, 0x93, 0x0E, 0x9C, 0x14, 0x91, 0x12, 0xAD, 0x36, 0x4E, 0x5F, 0x38, 0x24, 0x8C, 0x22,
+    0x41, 0x0C, 0xCA, 0xAD, 0xB4, 0x78, 0xA9, 0xD5, 0xE3, 0x62, 0x8A, 0x5B, 0xBB, 0x57, 0x34, 0xD1,
+    0xEF, 0xE0, 0x12, 0x28, 0xD2, 0x1D, 0xF5, 0x3E, 0x42, 0xC4, 0x08, 0x6C, 0x01, 0xBF, 0xD2, 0x6A,
+    0xC2, 0x96, 0xF3, 0xA2, 0x99, 0xEE, 0x80, 0x71, 0xBB, 0x5A, 0x78, 0x19, 0x82, 0x0A, 0x56, 0x2A,
+    0x48, 0xDA, 0xD0, 0xC7, 0xB5, 0x36, 0x6B, 0xA3, 0xD8, 0x9C, 0x8A, 0xC9, 0xD5, 0x9F, 0xD0, 0x09,
+    0x70, 0x1B, 0x18, 0xCD, 0xE0, 0xF2, 0xF9, 0xC6, 0x67, 0xE8, 0x34, 0x41, 0xD8, 0xA0, 0x17, 0x10,
+    0x12, 0x58, 0x4D, 0x70, 0x71, 0xB7, 0xDB, 0x20, 0x29, 0x06, 0x49, 0xE7, 0xB0, 0x0F, 0x34, 0xE3,
+    0xA5, 0xC9, 0x4A, 0x85, 0x20, 0xAD, 0x66, 0xB5, 0xE2, 0x39, 0x5C, 0x3A, 0x67, 0xC3, 0xAF, 0x55,
+    0xFC, 0x5E, 0x13, 0xD2, 0xC2, 0xA0, 0x87, 0xB4, 0x12, 0x7C, 0x24, 0xEC, 0x80, 0x4F, 0xD0, 0x6A,
+    0xAA, 0x77, 0xDB, 0x6A, 0x02, 0xB7, 0xBD, 0xC9, 0x20, 0x7B, 0x04, 0x2D, 0x92, 0xB2, 0x95, 0x76,
+    0x46, 0x1D, 0x17, 0x2D, 0xD6, 0xBB, 0xD0, 0x7A, 0x11, 0x6C, 0x87, 0x5E, 0x09, 0x82, 0x22, 0x9D,
+    0x0E, 0x70, 0x3F, 0xDC, 0x30, 0x87, 0x8F, 0xB8, 0x1F, 0x8B, 0x56, 0xB6, 0x30, 0x26, 0xB7, 0x36,
+    0x6A, 0x34, 0xD9, 0xAD, 0x2F, 0x68, 0x76, 0xA9, 0x97, 0xB4, 0x3B, 0x49, 0x9B, 0x24, 0xBD, 0x26,
+    0x49, 0xA7, 0xB8, 0xD5, 0xC2, 0x96, 0x53, 0x96, 0xBE, 0x80, 0x95, 0x12, 0x5E, 0x8A, 0xAD, 0x24,
+    0xAC, 0x94, 0x71, 0x7F, 0x77, 0x7F, 0x6A, 0xC4, 0xC5, 0xF0, 0xD6, 0xD3, 0x3A, 0x7B, 0x1D, 0xE0,
+    0xA4, 0x19, 0x49, 0x73, 0x2B, 0x89, 0x86, 0x71, 0xA7, 0xAA, 0x98, 0xB0, 0x9E, 0xBF, 0x6A, 0xEB,
+    0x8D, 0xFF, 0x6B, 0x7A, 0xCD, 0x41, 0x2A, 0xAD, 0xA4, 0xA5, 0x97, 0x76, 0x3A, 0x69, 0x3A, 0x3D,
+    0x17, 0x00, 0x8D, 0x0E, 0x5A, 0x69, 0x45, 0xDA, 0x71, 0x52, 0xB4, 0x9A, 0x69, 0x15, 0xAB, 0x09,
+    0xF4, 0x05, 0xD0, 0x2B, 0xF7, 0x18, 0x7E, 0xAE, 0xD4, 0x2A, 0x28, 0x3A, 0xE9, 0x30, 0x7A, 0x5B,
+    0xC9, 0x67, 0xA3, 0x4E, 0xB8, 0x14, 0x16, 0xA3, 0x7E, 0x3F, 0xDF, 0x74, 0x3B, 0x61, 0x71, 0x69,
+    0x28, 0x46, 0x8F, 0x35, 0x0F, 0x52, 0x22, 0x28, 0xD3, 0x68, 0x07, 0x5E, 0x06, 0x23, 0x29, 0x0F,
+    0x92, 0xD6, 0x20, 0xE9, 0x45, 0x49, 0xE5, 0xCE, 0xFD, 0xFB, 0xBA, 0x69, 0x31, 0xAD, 0xE6, 0x3A,
+    0x9F, 0xFC, 0xEA, 0xE1, 0xA1, 0x9C, 0x33, 0xD3, 0x5F, 0x1F, 0x8E, 0xCF, 0x3A, 0x6C, 0xAE, 0x0E,
+    0xD7, 0xC7, 0x5D, 0x6D, 0x10, 0x94, 0xE9, 0xA5, 0x8C, 0x7F, 0xAA, 0x64, 0x84, 0x16, 0x9B, 0x1B,
+    0x4D, 0x6E, 0xED, 0x0A, 0x8A, 0x2E, 0xB5, 0xFA, 0x84, 0x26, 0xA3, 0x90, 0xAB, 0x96, 0xAC, 0x56,
+    0x5A, 0x69, 0xC1, 0x1D, 0x5A, 0x8C, 0x5E, 0x51, 0x1C, 0x73, 0xAB, 0x59, 0xD1, 0x1C, 0x46, 0xD8,
+    0x62, 0x0B, 0x6E, 0x75, 0x5B, 0xAB, 0x29, 0x3C, 0xF1, 0x05, 0x49, 0x4B, 0x23, 0xED, 0x35, 0x1E,
+    0x73, 0x67, 0xBA, 0x5A, 0x36, 0x1B, 0x9D, 0x34, 0xF7, 0x52, 0xEE, 0x24, 0x19, 0xCD, 0xFA, 0xAE,
+    0xE2, 0x90, 0xC3, 0x62, 0x0E, 0x97, 0xD0, 0x1B, 0x05, 0xFF, 0x13, 0x31, 0x66, 0xC5, 0xE1, 0x18,
+    0xF7, 0x07, 0xFA, 0xA4, 0xA4, 0x45, 0x7A, 0x9C, 0xAC, 0xDE, 0x28, 0x7C, 0xEE, 0x93, 0x7B, 0xB5,
+    0x9C, 0x46, 0x33, 0x28, 0xD2, 0x6A, 0x1D, 0xBF, 0xA1, 0xD4, 0x4B, 0xA9, 0x95, 0xD6, 0x3A, 0xDC,
+    0xCB, 0x00, 0x7F, 0x88, 0x2D, 0xAD, 0xE2, 0x58, 0x5A, 0xCD, 0x76, 0xE5, 0x19, 0x8F, 0x61, 0xE9,
+    0x44, 0x48, 0xBD, 0xF0, 0x0B, 0xF7, 0xA0, 0x79, 0x88, 0x2D, 0x8C, 0xF5, 0x5F, 0xE6, 0xD9, 0x5F,
+    0xBA, 0xBA, 0x11, 0xCC, 0x41, 0xB7, 0x63, 0x33, 0x43, 0x62, 0x5C, 0x71, 0x11, 0x3F, 0x5D, 0x8C,
+    0x69, 0x86, 0xF6, 0x34, 0x99, 0x51, 0x10, 0x8E, 0xA9, 0x55, 0xA6, 0xD7, 0xCA, 0xA8, 0x19, 0xB7,
+    0x57, 0xAB, 0x34, 0x7A, 0x02, 0x83, 0x36, 0x18, 0xB5, 0x42, 0xD0, 0x42, 0xA3, 0x02, 0x77, 0x05,
+    0xF4, 0x11, 0x78, 0xEE, 0x63, 0x8F, 0x1E, 0x3D, 0xFA, 0x92, 0xA4, 0x7F, 0x94, 0x54, 0x74, 0xED,
+    0x08, 0x68, 0xEE, 0xDF, 0xBF, 0xFF, 0xF2, 0xED, 0x58, 0x01, 0x3C, 0x07, 0xD8, 0xE9, 0xF4, 0xE3,
+    0xDA, 0x60, 0xD0, 0x02, 0x5E, 0x13, 0x4D, 0xD8, 0xAB, 0xFA, 0xE9, 0x15, 0x21, 0x24, 0x3A, 0x65,
+    0x46, 0xAD, 0x4D, 0xD0, 0xDC, 0x6B, 0xC7, 0xE8, 0xCD, 0xEA, 0xC7, 0xFF, 0xFD, 0x4D, 0x84, 0x71,
+    0x57, 0x5B, 0x23, 0x15, 0x5B, 0x2D, 0x35, 0xFD, 0x07, 0xB4, 0x4C, 0xCD, 0xB5, 0xF3, 0xEC, 0x34,
+    0x11, 0x32, 0x56, 0x33, 0xDA, 0xE8, 0x05, 0x6E, 0xA5, 0x11, 0xF4, 0xF9, 0xB6, 0xAA, 0xD7, 0xEA,
+    0x67, 0x35, 0x31, 0x94, 0x1A, 0x3C, 0x9E, 0xAF, 0x67, 0xFE, 0xEB, 0x4F, 0x01, 0x06, 0x69, 0x83,
+    0x46, 0xD2, 0x01, 0x56, 0xFF, 0xE7, 0xD3, 0x8A, 0xB8, 0x0D, 0xFC, 0x8A, 0x66, 0xB0, 0xA9, 0x3D,
+    0xB8, 0x73, 0xAF, 0xCB, 0x5D, 0x6E, 0xA4, 0x17, 0x8B, 0x4D, 0x56, 0xFA, 0x44, 0x19, 0x16, 0xF7,
+    0x54, 0x4D, 0x19, 0x63, 0x98, 0x43, 0x53, 0xDC, 0x2C, 0x8E, 0xA6, 0xB8, 0x4F, 0xEC, 0xEC, 0x6D,
+    0xF1, 0x2F, 0x96, 0xA6, 0x98, 0xE2, 0x4D, 0x36, 0xC5, 0x64, 0x6F, 0xB2, 0xC9, 0x7D, 0xF2, 0x26,
+    0xDB, 0x3C, 0xAC, 0xFE, 0xC5, 0xE3, 0xC1, 0x1E, 0xA2, 0xFB, 0xBC, 0x0E, 0x69, 0x72, 0x31, 0x6C,
+    0x2A, 0x8C, 0xCB, 0x47, 0xE6, 0x8F, 0x3C, 0xC4, 0x26, 0x00, 0xFA, 0x1A, 0x3D, 0x8D, 0x96, 0xE6,
+    0x5B, 0x40, 0x90, 0x8E, 0x2A, 0xE6, 0x0E, 0x34, 0xE1, 0x78, 0x78, 0xF3, 0xEE, 0xC2, 0x06, 0xB8,
+    0x03, 0x18, 0x15, 0x61, 0x50, 0x02, 0xFB, 0x6E, 0x81, 0x6E, 0x17, 0x98, 0xC3, 0x45, 0x1A, 0xBD,
+    0xB4, 0x81, 0x5E, 0xDD, 0xC1, 0x2F, 0x9A, 0x70, 0xC9, 0xAD, 0x0C, 0x5B, 0x9F, 0xB1, 0xA5, 0x15,
+    0xDD, 0x4E, 0x88, 0x46, 0xD5, 0x8A, 0x6B, 0x40, 0x11, 0x41, 0xD2, 0xE2, 0xDE, 0xBE, 0xFF, 0x60,
+    0x1B, 0x37, 0xCC, 0x6E, 0x0B, 0xE8, 0xCF, 0x77, 0x70, 0x3F, 0x11, 0xD8, 0x43, 0x13, 0x46, 0x58,
+    0x3D, 0x9D, 0xE8, 0xA4, 0x9D, 0x56, 0xD2, 0x82, 0xA4, 0x82, 0x7B, 0xFB, 0x33, 0x9A, 0x6C, 0x41,
+    0x4B, 0x77, 0xE0, 0xB6, 0xB6, 0x7E, 0x88, 0xDD, 0x81, 0x7B, 0xFB, 0xD3, 0x62, 0x90, 0x0E, 0x3A,
+    0x29, 0xD3, 0x4A, 0x9A, 0xD1, 0x5B, 0xA1, 0xE0, 0x92, 0xD1, 0x34, 0x64, 0xFC, 0xDA, 0xEF, 0x0C,
+    0xD9, 0x88, 0xEE, 0x40, 0xD1, 0x68, 0x72, 0xA9, 0x53, 0x1C, 0x24, 0xAD, 0xBD, 0xA4, 0xD5, 0x9C,
+    0xE3, 0x1C, 0x97, 0x45, 0x4D, 0x57, 0xED, 0x58, 0x1B, 0xEE, 0xF4, 0x9C, 0x62, 0xD4, 0xFC, 0x60,
+    0x1A, 0x0E, 0x98, 0xAC, 0x38, 0x5D, 0x97, 0xD1, 0x0C, 0x28, 0x9E, 0x71, 0xAA, 0x46, 0x53, 0xBB,
+    0x73, 0x06, 0x83, 0x7A, 0xC6, 0xA5, 0xEB, 0x83, 0xF3, 0x19, 0x14, 0xB1, 0x9A, 0x3E, 0x3A, 0xD5,
+    0x81, 0x9D, 0xB4, 0x61, 0xA4, 0x1D, 0x46, 0x3D, 0xE1, 0xF4, 0xDF, 0x56, 0x3F, 0x85, 0x46, 0x3A,
+    0x60, 0x94, 0x0A, 0xA6, 0xA2, 0xA7, 0xB7, 0x1F, 0x68, 0x36, 0xC2, 0x15, 0xFC, 0x8A, 0x62, 0xBF,
+    0x63, 0x77, 0x14, 0x09, 0x8B, 0x2D, 0xF4, 0x47, 0xA3, 0x48, 0x58, 0x87, 0x4C, 0xBF, 0xB7, 0x9A,
+    0xD0, 0xE2, 0x12, 0xB6, 0x18, 0xD1, 0x28, 0xFA, 0x15, 0x97, 0xFB, 0x9D, 0x4E, 0x68, 0x69, 0xB4,
+    0xDA, 0x82, 0x2F, 0xE8, 0xDB, 0x5E, 0xD3, 0x20, 0x55, 0x24, 0xBC, 0xE1, 0xA4, 0x8C, 0x91, 0xDE,
+    0x84, 0x0A, 0x05, 0x06, 0xA9, 0x30, 0x4A, 0xB9, 0x9E, 0x72, 0x6F, 0xDF, 0xBF, 0x57, 0x6F, 0xC9,
+    0xAF, 0x27, 0x1C, 0xA8, 0xB7, 0xA9, 0xBF, 0xB9, 0x3F, 0x35, 0x92, 0xE6, 0x46, 0xD2, 0xD4, 0x4A,
+    0xC2, 0xE8, 0xD1, 0xA3, 0xAA, 0x89, 0xEE, 0xB8, 0x98, 0xA0, 0xDD, 0x39, 0x03, 0x80, 0x2D, 0xD5,
+    0x00, 0x6F, 0xFD, 0xBA, 0xB4, 0x3D, 0x6B, 0xDC, 0xED, 0x37, 0x8C, 0x1B, 0xA1, 0xD1, 0x5B, 0x8F,
+    0x68, 0x24, 0x71, 0x8E, 0x5B, 0x07, 0xFF, 0xFA, 0xCD, 0x71, 0xCB, 0xED, 0x71, 0xF3, 0x65, 0xBA,
+    0x5C, 0xBA, 0xBC, 0x5C, 0x1C, 0x51, 0xD0, 0x43, 0x1A, 0x49, 0x0B, 0xE1, 0x94, 0x41, 0x73, 0xAF,
+    0x37, 0xEF, 0xA6, 0x46, 0x1B, 0x0D, 0xAE, 0x70, 0xE2, 0x1C, 0xB4, 0x5E, 0x7E, 0xAF, 0x51, 0xBC,
+    0x73, 0xFF, 0xDE, 0x98, 0x8D, 0xF4, 0xA2, 0x26, 0xA7, 0xE4, 0x92, 0x91, 0x8C, 0xF8, 0x9C, 0x56,
+    0x97, 0xE8, 0x77, 0xA3, 0x09, 0x45, 0x57, 0x97, 0x47, 0x44, 0xD1, 0x6A, 0x1A, 0x33, 0x41, 0xD2,
+    0x54, 0xE7, 0xD6, 0x4A, 0x82, 0x41, 0xC7, 0x74, 0x62, 0x15, 0x9B, 0xE9, 0x76, 0x86, 0x8C, 0x2D,
+    0x8C, 0x1B, 0xB6, 0xE0, 0xEA, 0x6B, 0x62, 0xC8, 0xB8, 0xC4, 0xB8, 0xE1, 0x57, 0x5C, 0x22, 0x2C,
+    0xB8, 0x84, 0x22, 0x7E, 0x45, 0x6F, 0x3D, 0x0A, 0x6B, 0xA3, 0x33, 0x60, 0x9D, 0xB8, 0xE3, 0x64,
+    0x38, 0xB3, 0x11, 0xAD, 0xA6, 0xEE, 0xC0, 0x68, 0xEA, 0x77, 0x8C, 0xB0, 0xF5, 0xB5, 0xD0, 0x1D,
+    0xD8, 0x42, 0xFF, 0x9E, 0x01, 0xD3, 0xF5, 0x80, 0x38, 0xED, 0x38, 0xED, 0x78, 0x15, 0x46, 0xBD,
+    0x89, 0x51, 0x9D, 0xD8, 0x7E, 0x3F, 0x91, 0xCE, 0xF9, 0x1C, 0x72, 0x55, 0xAD, 0x4B, 0xD7, 0x4F,
+    0xBF, 0xD6, 0x39, 0x53, 0x04, 0x45, 0x1A, 0xCD, 0xF4, 0x5A, 0xF1, 0x2A, 0x04, 0x15, 0xA4, 0xCC,
+    0x89, 0xD8, 0x2B, 0x38, 0x88, 0xF5, 0x67, 0x2A, 0xA2, 0xBB, 0xC2, 0x82, 0xE9, 0xB4, 0xA4, 0xB0,
+    0xFC, 0xCA, 0x75, 0xF3, 0x05, 0x1A, 0x9C, 0xB3, 0xF9, 0x8C, 0xEB, 0xCA, 0x19, 0x65, 0xC7, 0xCB,
+    0x75, 0x21, 0xF1, 0xFC, 0x83, 0x1D, 0x23, 0x45, 0xBC, 0x52, 0xE5, 0x90, 0xEE, 0xC9, 0xC5, 0x10,
+    0x6C, 0x66, 0x2C, 0x0C, 0x19, 0xBF, 0x31, 0x6E, 0x8D, 0x56, 0x5C, 0x32, 0x9A, 0x71, 0xC9, 0x0A,
+    0xDC, 0xEA, 0x0A, 0xF8, 0x25, 0x24, 0x08, 0xDF, 0xD5, 0x02, 0x7A, 0x4D, 0x13, 0xE8, 0x8D, 0x03,
+    0x1A, 0x7D, 0x23, 0x43, 0x23, 0x25, 0x68, 0xA5, 0x04, 0x46, 0xCA, 0x60, 0xF4, 0xB8, 0x40, 0x77,
+    0xD8, 0x1D, 0xFA, 0xBD, 0x3F, 0xC0, 0x96, 0x4E, 0x60, 0x8B, 0xD1, 0x74, 0x9A, 0xC6, 0x90, 0x51,
+    0x64, 0xDC, 0xD0, 0x8A, 0x4B, 0xF8, 0x84, 0x4B, 0xB8, 0xAD, 0x62, 0xCB, 0x5F, 0xD1, 0xED, 0xFA,
+    0x4C, 0xDD, 0x36, 0x9A, 0x68, 0xAB, 0x3F, 0xBD, 0x35, 0x4D, 0xF6, 0xE6, 0x34, 0x49, 0x65, 0x94,
+    0xB2, 0x93, 0x36, 0x27, 0x6D, 0x58, 0x4D, 0x74, 0x5A, 0x1A, 0x65, 0x50, 0x61, 0xD4, 0xCC, 0xA8,
+    0x68, 0x94, 0x31, 0x2A, 0x38, 0xCD, 0x04, 0xCD, 0x46, 0x05, 0xAB, 0x0D, 0xAF, 0xD8, 0x1E, 0xA2,
+    0x7F, 0xB7, 0xE0, 0x1E, 0x27, 0xE4, 0x63, 0xFF, 0xCB, 0x03, 0xFB, 0xCB, 0x82, 0xDC, 0xDA, 0x68,
+    0x8C, 0xE3, 0xF7, 0x77, 0x86, 0x5F, 0x14, 0x53, 0x7C, 0x6C, 0x35, 0xC6, 0xF0, 0xA9, 0x82, 0xFB,
+    0xF1, 0x6E, 0x93, 0x66, 0xB3, 0x0F, 0xDF, 0xDB, 0xED, 0x86, 0xFF, 0xF6, 0xEE, 0xBE, 0xAD, 0xA9,
+    0x2F, 0xC3, 0x0F, 0xB6, 0x31, 0xA1, 0x57, 0x0E, 0xB5, 0xC2, 0x6E, 0x56, 0x8B, 0x5B, 0xD1, 0xA4,
+    0x62, 0x76, 0x86, 0x64, 0x35, 0xF9, 0xD8, 0x0A, 0xA5, 0xBE, 0xE0, 0x56, 0xBB, 0xA3, 0x68, 0x76,
+    0x14, 0x6D, 0x06, 0x7B, 0x80, 0x5B, 0x1A, 0x25, 0xBA, 0xC2, 0xA8, 0x89, 0x10, 0x8D, 0x32, 0x36,
+    0xE3, 0x14, 0xD1, 0xDC, 0x69, 0x67, 0xD8, 0xF0, 0x5A, 0x1B, 0xD1, 0x3F, 0x15, 0x63, 0x42, 0x9F,
+    0xD9, 0xCC, 0x81, 0xDD, 0x34, 0xBB, 0xA5, 0x51, 0x5F, 0xBA, 0xC2, 0x98, 0xFC, 0x12, 0x62, 0x2B,
+    0x73, 0xD8, 0x82, 0x5B, 0xC7, 0xA4, 0xD9, 0xEC, 0x8D, 0x5E, 0xDA, 0xF0, 0xD1, 0x3E, 0x11, 0x7D,
+    0x41, 0x3F, 0x4C, 0x28, 0x76, 0x52, 0xFD, 0xF1, 0x15, 0x4D, 0x46, 0x3B, 0x43, 0x62, 0x50, 0x6C,
+    0x05, 0x2A, 0xB8, 0x15, 0xAB, 0xD9, 0x1C, 0x67, 0x04, 0xAD, 0x0F, 0xAF, 0x09, 0x46, 0x29, 0x62,
+    0x24, 0x45, 0x5C, 0x5D, 0x8E, 0xDB, 0xA0, 0x69, 0x38, 0xB0, 0x42, 0x2B, 0x43, 0xE9, 0x05, 0x2E,
+    0xB9, 0x0D, 0xB4, 0x28, 0x62, 0xF4, 0x49, 0x81, 0xDD, 0xC7, 0x0C, 0x2E, 0x69, 0x01, 0xBD, 0x2A,
+    0xE8, 0x64, 0x0B, 0x8C, 0xD9, 0x25, 0xD0, 0xA2, 0x85, 0x5E, 0x46, 0x33, 0x2E, 0xF7, 0xC2, 0x28,
+    0x5A, 0x4D, 0x7E, 0x67, 0x94, 0xB4, 0xE2, 0x74, 0xD2, 0x89, 0xE5, 0x84, 0x64, 0x95, 0xEE, 0x63,
+    0xF5, 0x84, 0xEB, 0x58, 0x19, 0x51, 0xF5, 0xEA, 0x9F, 0x11, 0x97, 0xF8, 0x3A, 0x6E, 0xAD, 0xA6,
+    0x7E, 0x47, 0xB1, 0xD5, 0xE4, 0x12, 0x8A, 0x43, 0x6E, 0x94, 0x3A, 0xFD, 0xB5, 0xB6, 0x56, 0x52,
+    0xE6, 0x12, 0x29, 0x56, 0x86, 0xE3, 0xAF, 0x4E, 0x07, 0xFB, 0xDE, 0x88, 0x37, 0x64, 0x7E, 0xF5,
+    0xCC, 0x3F, 0x4F, 0x27, 0x5D, 0xD5, 0x49, 0xFE, 0x67, 0xE9, 0x24, 0xD2, 0xCB, 0x68, 0xC2, 0x6F,
+    0x57, 0x3A, 0x09, 0x55, 0x27, 0x4B, 0x8D, 0xE6, 0x95, 0x5C, 0x33, 0xA8, 0x00, 0x8D, 0xCF, 0x9C,
+    0xAC, 0xE2, 0x8C, 0xCC, 0xD5, 0xA9, 0xB7, 0x8A, 0x40, 0xFB, 0x68, 0x3E, 0x23, 0xF1, 0x20, 0x2D,
+    0x8C, 0xE7, 0x6D, 0x17, 0x5C, 0x7A, 0x70, 0xE0, 0x52, 0x7F, 0xE0, 0xD7, 0x4E, 0x84, 0xA5, 0x3B,
+    0x50, 0xEC, 0x0F, 0x14, 0xED, 0xDE, 0x28, 0xFA, 0xD2, 0x5C, 0xB0, 0x4F, 0x34, 0xD2, 0x8E, 0x91,
+    0x0A, 0xDD, 0xD1, 0xEF, 0xF4, 0x7B, 0x27, 0xEC, 0x6E, 0x84, 0x2D, 0xAD, 0x66, 0x5B, 0x1A, 0xC5,
+    0x21, 0xA3, 0x65, 0xDC, 0x08, 0xC9, 0x25, 0x5C, 0x72, 0xA9, 0x32, 0x3E, 0xE0, 0x6E, 0xA5, 0xE5,
+    0x27, 0x71, 0x0C, 0x52, 0x34, 0x9A, 0xFF, 0xB4, 0x92, 0x9F, 0x4A, 0x08, 0xE7, 0x13, 0x8B, 0xD8,
+    0xAA, 0xD2, 0x19, 0x9C, 0xE2, 0xF9, 0x32, 0x6A, 0x86, 0x41, 0xC0, 0xB0, 0x5F, 0xEE, 0x32, 0xD4,
+    0x3C, 0xC7, 0xFF, 0x60, 0x2C, 0x8D, 0xA4, 0xB5, 0x93, 0xC4, 0x20, 0xAD, 0x7C, 0x54, 0x4F, 0x2A,
+    0x8F, 0x63, 0x90, 0x94, 0x82, 0xA4, 0x57, 0x25, 0x1D, 0x56, 0xD2, 0xF6, 0xC2, 0x67, 0x8E, 0xFB,
+    0x53, 0x9D, 0x59, 0x45, 0xDE, 0x93, 0x10, 0xA8, 0xD4, 0xB7, 0x5C, 0xF1, 0xF1, 0xF9, 0x9C, 0xF9,
+    0xAB, 0xCB, 0xBB, 0x03, 0x18, 0xF3, 0x49, 0xFB, 0x6E, 0x5C, 0x7E, 0xE1, 0xB4, 0x8D, 0x66, 0x42,
+    0x1C, 0xB7, 0xD3, 0x13, 0x2A, 0xBA, 0x54, 0x31, 0x5B, 0xAB, 0xC9, 0xAF, 0xB8, 0x54, 0xA3, 0x95,
+    0x22, 0x3E, 0xD9, 0x42, 0x57, 0x91, 0xCE, 0x32, 0xD6, 0x78, 0x7A, 0xFB, 0x0B, 0xB3, 0x5F, 0x71,
+    0x5B, 0x7F, 0x60, 0x44, 0x58, 0xF0, 0xA9, 0xDF, 0xE9, 0x0F, 0xC2, 0xDA, 0x28, 0x76, 0x9A, 0x7C,
+    0xAE, 0x80, 0xAE, 0xC2, 0xCB, 0x5E, 0x95, 0x55, 0x64, 0xCE, 0xA8, 0xAB, 0x99, 0x7E, 0x57, 0xC4,
+    0x16, 0x45, 0xC6, 0x2D, 0x44, 0x5C, 0x0A, 0x91, 0xB0, 0x84, 0x88, 0xA2, 0x8F, 0xAD, 0x26, 0x1F,
+    0x8D, 0xF0, 0x4B, 0xBF, 0xE3, 0x16, 0x5B, 0x70, 0xCB, 0xB8, 0xE1, 0x16, 0x97, 0x70, 0xAB, 0x5F,
+    0x70, 0xAB, 0x22, 0xEE, 0x47, 0x9A, 0x18, 0x7F, 0x22, 0x18, 0xFF, 0x61, 0x87, 0xF1, 0x67, 0x05,
+    0x86, 0xC7, 0xDB, 0x05, 0x4B, 0x6B, 0x01, 0xAB, 0x78, 0xCE, 0x9A, 0x55, 0x1D, 0xD7, 0x47, 0xDC,
+    0xE3, 0x5C, 0xC3, 0xB0, 0xE6, 0x46, 0x11, 0xBD, 0x91, 0x71, 0x85, 0x61, 0xD3, 0x6C, 0x14, 0x8D,
+    0x6C, 0x26, 0x14, 0xFC, 0xAA, 0xD9, 0x6A, 0xE9, 0x8B, 0xCD, 0xAD, 0x76, 0x34, 0x87, 0xD9, 0x3D,
+    0x5E, 0xC6, 0xAD, 0xCF, 0xDD, 0xD3, 0xDD, 0x88, 0x10, 0x35, 0x2E, 0x7E, 0xE9, 0xCB, 0xF0, 0x8B,
+    0xDD, 0x16, 0xC2, 0xAB, 0xFB, 0xB8, 0x68, 0xEA, 0x8B, 0xFF, 0xF6, 0x3E, 0x26, 0xC2, 0xEB, 0x79,
+    0xF8, 0xFE, 0x41, 0x9F, 0xD5, 0xEC, 0x3E, 0x12, 0xBE, 0xBC, 0x0E, 0x3F, 0xCC, 0x74, 0xEF, 0x96,
+    0x66, 0xD7, 0x84, 0xD7, 0x3C, 0x28, 0xD1, 0x69, 0x6B, 0xB4, 0x83, 0x17, 0x83, 0x62, 0x0D, 0x0B,
+    0x1B, 0xF8, 0xC2, 0xA0, 0x8A, 0x7E, 0x2E, 0xD8, 0xC7, 0x68, 0x36, 0x9A, 0x5A, 0xC5, 0xAA, 0x60,
+    0x86, 0x82, 0x16, 0x8C, 0xD0, 0x0A, 0x61, 0x09, 0x09, 0x6C, 0xF1, 0x09, 0x8C, 0xAA, 0xFD, 0x29,
+    0x03, 0x56, 0x05, 0x30, 0x2A, 0x00, 0x61, 0xBF, 0xF2, 0x09, 0x38, 0xAD, 0x80, 0x53, 0x01, 0xC6,
+    0x43, 0x13, 0x0C, 0xC5, 0xAF, 0x60, 0x77, 0x5B, 0xC0, 0x1E, 0x46, 0x13, 0xBD, 0xF0, 0x89, 0x4E,
+    0xD3, 0x65, 0xF8, 0xD9, 0x28, 0x12, 0x52, 0xAB, 0xC8, 0xB0, 0x13, 0x22, 0xE3, 0x2F, 0x35, 0xB5,
+    0x7A, 0xED, 0xA8, 0x5F, 0xD3, 0xEA, 0x52, 0x27, 0xC2, 0xE2, 0x52, 0xA3, 0x4F, 0x68, 0x36, 0xC7,
+    0x50, 0xCE, 0xF9, 0x7D, 0x77, 0x07, 0xAF, 0x04, 0x35, 0x83, 0x73, 0x61, 0x93, 0xC3, 0xC5, 0x38,
+    0x9B, 0xEB, 0xFC, 0xE0, 0x6D, 0x5B, 0xDE, 0x2E, 0x09, 0x46, 0x01, 0x8C, 0xAA, 0x39, 0x2C, 0x2D,
+    0x46, 0x67, 0x3E, 0xB0, 0xF0, 0xC2, 0x7D, 0x5F, 0xA0, 0x66, 0x70, 0x86, 0x83, 0x1A, 0xAC, 0xEA,
+    0x64, 0xF7, 0xBA, 0x60, 0x48, 0xA3, 0xF9, 0x4C, 0x68, 0x18, 0x45, 0x68, 0xB5, 0x40, 0xA3, 0xF5,
+    0xE2, 0x87, 0x94, 0x2E, 0x7E, 0xC9, 0x67, 0xC0, 0x49, 0x9A, 0xC7, 0x33, 0xDF, 0xA3, 0xCD, 0x48,
+    0x2A, 0xD0, 0x29, 0x31, 0x2A, 0x22, 0x61, 0x8E, 0xAF, 0x32, 0x24, 0x08, 0x33, 0x66, 0xAF, 0x89,
+    0x5D, 0x17, 0xAF, 0x08, 0xAC, 0x5B, 0x40, 0x60, 0x4A, 0x25, 0xB0, 0x37, 0x2E, 0xF2, 0x91, 0xF6,
+    0x80, 0x7E, 0xBB, 0xBA, 0xA8, 0x2B, 0x30, 0xAE, 0xA0, 0x19, 0xA3, 0x8C, 0xD5, 0x82, 0xD7, 0xC4,
+    0xFD, 0x97, 0xC1, 0x47, 0x9B, 0x4C, 0x41, 0xD3, 0xB8, 0xF4, 0xB9, 0x39, 0x6E, 0x7C, 0x5E, 0xBB,
+    0xDC, 0x08, 0x17, 0x6D, 0x32, 0x3B, 0x61, 0x1A, 0xD7, 0xAE, 0x20, 0x5C, 0xB4, 0x9B, 0xD9, 0x2B,
+    0xFD, 0xDC, 0x18, 0xB4, 0x10, 0x44, 0xF3, 0x8D, 0x5F, 0x2B, 0x85, 0xDD, 0xC0, 0xC5, 0xDB, 0x52,
+    0x4C, 0x55, 0xEA, 0x04, 0x7E, 0xBE, 0x79, 0xD1, 0xED, 0x5B, 0x6B, 0x55, 0xB0, 0x4A, 0x38, 0xCD,
+    0xDC, 0x7F, 0x99, 0x33, 0xEB, 0xD0, 0xEC, 0x67, 0x9A, 0xAD, 0x17, 0x34, 0xDA, 0xC0, 0x69, 0xA6,
+    0xFF, 0x65, 0x81, 0x63, 0x88, 0xB8, 0xB8, 0xD3, 0x6F, 0x36, 0x71, 0xE0, 0x71, 0xD1, 0x6C, 0xDD,
+    0x86, 0x9B, 0x45, 0x5B, 0x5C, 0x64, 0xF8, 0xCE, 0x57, 0xE1, 0x6B, 0xA3, 0x94, 0x25, 0xFD, 0xE8,
+    0xFE, 0xFD, 0xFB, 0x7C, 0xEC, 0x2B, 0x6E, 0xB3, 0xB9, 0x2B, 0xCD, 0xCE, 0xB7, 0x68, 0xFE, 0x02,
+    0x08, 0xC5, 0xC5, 0x5E, 0xBB, 0x08, 0x52, 0xEE, 0xF4, 0x33, 0x2D, 0xAE, 0x74, 0xFA, 0xB8, 0xA2,
+    0x2D, 0xFD, 0x51, 0xFD, 0xB9, 0x66, 0xC5, 0x6E, 0xEF, 0x0E, 0xC6, 0x34, 0x64, 0x14, 0xC3, 0xDA,
+    0xA9, 0xD5, 0xEC, 0x72, 0xA7, 0x56, 0x8B, 0x55, 0x50, 0x0D, 0x2C, 0x5E, 0x5F, 0x5E, 0xF1, 0x5B,
+    0x98, 0x6B, 0xC6, 0xE2, 0xCE, 0xCB, 0xB7, 0x12, 0x84, 0xBF, 0xEA, 0x53, 0x87, 0xED, 0x0F, 0x21,
+    0xBC, 0xAE, 0xC9, 0x28, 0x08, 0x2B, 0x1D, 0xF8, 0xC3, 0x97, 0x56, 0xD1, 0x6D, 0xB6, 0xA6, 0xEB,
+    0x5A, 0x4D, 0x9A, 0xFB, 0xBD, 0x2B, 0xB8, 0x34, 0x26, 0x14, 0x15, 0xBB, 0xC3, 0x88, 0x71, 0xB3,
+    0xA5, 0x51, 0xF4, 0x9B, 0x3D, 0x5A, 0x3D, 0x55, 0xB2, 0x92, 0x26, 0xF7, 0x86, 0xB6, 0xE6, 0xB0,
+    0x02, 0x9A, 0x09, 0xE0, 0x4F, 0x26, 0x86, 0x0A, 0xD2, 0x5B, 0x29, 0x77, 0xFA, 0xFB, 0xCD, 0xAA,
+    0xAE, 0x0F, 0x77, 0xC2, 0x50, 0x7F, 0x81, 0xF7, 0xE7, 0xD3, 0xAF, 0xE0, 0xB7, 0x66, 0x76, 0x0A,
+    0xF3, 0x50, 0x53, 0x63, 0x73, 0xA3, 0xE3, 0x92, 0x34, 0x6B, 0x5E, 0xBE, 0xCD, 0x07, 0xAF, 0x79,
+    0x59, 0xAE, 0x21, 0xA5, 0xF9, 0x8B, 0x71, 0x63, 0x38, 0xC6, 0x44, 0x50, 0x48, 0x6D, 0x8D, 0x51,
+    0x3F, 0xD0, 0x62, 0x8F, 0x46, 0x71, 0x28, 0x28, 0x8E, 0x5B, 0xF5, 0xF7, 0x9A, 0x5D, 0x42, 0x93,
+    0x5F, 0x1B, 0xE1, 0x97, 0x56, 0x84, 0xC5, 0x1C, 0x84, 0xB5, 0x3F, 0xF0, 0x69, 0xD8, 0x71, 0x87,
+    0x4A, 0x55, 0xAB, 0xD5, 0x3B, 0x99, 0x4E, 0x5F, 0xDC, 0x2E, 0x69, 0x9A, 0xFF, 0x3C, 0xD1, 0xD6,
+    0x9C, 0x41, 0xEA, 0xA4, 0xDD, 0xE8, 0x15, 0x7D, 0x41, 0x93, 0xFB, 0x91, 0x66, 0x9B, 0xC3, 0x32,
+    0xEC, 0xEE, 0x69, 0xD0, 0x20, 0xA9, 0x93, 0xF6, 0x56, 0x4F, 0x1F, 0x12, 0x96, 0x1A, 0xEF, 0x3A,
+    0xD1, 0xA2, 0x27, 0x0F, 0xE2, 0x50, 0xE3, 0x7B, 0xA9, 0xB1, 0xA3, 0xA6, 0xC9, 0xEE, 0xDC, 0xBB,
+    0xA4, 0x4C, 0x46, 0xAD, 0x27, 0xEC, 0xB2, 0xC7, 0x7F, 0x3A, 0xBD, 0x44, 0x53, 0xE9, 0xFF, 0x02,
+    0x8D, 0xB4, 0x62, 0xA4, 0x0D, 0xA4, 0x02, 0x7F, 0xA4, 0x47, 0xB7, 0xB3, 0x05, 0xE5, 0xA2, 0xA3,
+    0xB6, 0xF2, 0xCC, 0xEB, 0x33, 0xF9, 0xD7, 0x9D, 0x19, 0x32, 0xD0, 0xED, 0xB7, 0xCF, 0xF8, 0x8B,
+    0xE7, 0xE8, 0x55, 0xA0, 0xD5, 0x01, 0x84, 0x03, 0x18, 0x4E, 0x96, 0xF3, 0x59, 0xA0, 0xD7, 0xAB,
+    0x05, 0xA7, 0x7F, 0x28, 0x04, 0x29, 0x37, 0x7A, 0xAA, 0xCD, 0x28, 0xFA, 0xAD, 0x53, 0x85, 0x38,
+    0x2E, 0xD9, 0x82, 0x5B, 0x6D, 0xC1, 0x2F, 0x43, 0x26, 0xC4, 0x21, 0xA3, 0x38, 0xE6, 0x46, 0x71,
+    0xCC, 0x46, 0xF3, 0x50, 0x7A, 0x4D, 0xF6, 0xB4, 0x3F, 0xD1, 0xE9, 0x9D, 0x83, 0x46, 0xAF, 0xDD,
+    0x9E, 0xE2, 0x21, 0xF3, 0xDF, 0xF1, 0x1B, 0x5E, 0x5A, 0xF1, 0x95, 0x71, 0x1D, 0xF0, 0x51, 0xAD,
+    0xFF, 0x97, 0x66, 0x3E, 0x11, 0x5E, 0xD7, 0x6C, 0x14, 0x34, 0xDB, 0x5A, 0x9A, 0x7A, 0xB0, 0xB7,
+    0x5A, 0xC7, 0xCD, 0x8A, 0xB0, 0xB8, 0xAD, 0xD5, 0xA4, 0x68, 0x4B, 0x77, 0xE0, 0xD2, 0xB8, 0x9D,
+    0x0B, 0xAE, 0x9A, 0x79, 0x46, 0xD1, 0x2F, 0x46, 0xAD, 0x18, 0xB2, 0x2D, 0xF8, 0xC5, 0xA5, 0x56,
+    0x8D, 0x66, 0x5B, 0xA0, 0x99, 0x70, 0x4B, 0xAB, 0xD9, 0x1E, 0x8C, 0x89, 0x3F, 0xBC, 0x2A, 0x9B,
+    0x5E, 0xCA, 0xD3, 0x35, 0xD7, 0xE4, 0x52, 0x4D, 0x37, 0x8D, 0x1B, 0x8A, 0x46, 0xD8, 0x7C, 0xE3,
+    0x54, 0x9D, 0x58, 0xEE, 0xD5, 0x34, 0x65, 0x7F, 0xD4, 0x67, 0x57, 0xA0, 0xB9, 0x91, 0x56, 0xBB,
+    0x49, 0xDB, 0xFC, 0xB3, 0x69, 0x5B, 0xAB, 0x89, 0xF6, 0xA4, 0x6C, 0xBF, 0x96, 0xB6, 0xDD, 0x60,
+    0x80, 0x4A, 0x78, 0x2D, 0x78, 0x45, 0xBC, 0x4E, 0x7C, 0x77, 0xE7, 0x65, 0xCE, 0xFA, 0x56, 0xA3,
+    0xE9, 0x92, 0x29, 0x79, 0x8F, 0x55, 0x9D, 0x67, 0x62, 0x2F, 0x5C, 0xEA, 0x85, 0x2D, 0xBD, 0xE8,
+    0x8E, 0x5E, 0xB4, 0xFA, 0x94, 0x40, 0xAF, 0x09, 0xDC, 0x3B, 0x02, 0x2B, 0x41, 0x27, 0xCD, 0x27,
+    0x8D, 0xAD, 0xA4, 0x62, 0x57, 0xC4, 0x66, 0x97, 0xE9, 0xF6, 0x4E, 0xB4, 0x42, 0x0B, 0x8A, 0xC3,
+    0x75, 0xCE, 0x2D, 0x24, 0xB8, 0xF3, 0x72, 0x55, 0x4D, 0xBF, 0x5F, 0x69, 0x6F, 0xD8, 0x7E, 0xAB,
+    0x62, 0x87, 0x67, 0x28, 0xF6, 0x8F, 0xB9, 0x7B, 0x8F, 0xF1, 0x3B, 0x5A, 0x07, 0x61, 0x7F, 0xA1,
+    0x7D, 0xD4, 0x6A, 0x0E, 0xE9, 0x87, 0x2A, 0x8D, 0xF6, 0xA0, 0x9F, 0x69, 0x0A, 0xD9, 0x2A, 0x86,
+    0x65, 0x2C, 0xAD, 0xE2, 0xB0, 0xD9, 0x1D, 0xAD, 0xFD, 0x6E, 0x84, 0x4B, 0xE6, 0x9C, 0x67, 0xC5,
+    0xB0, 0x74, 0x07, 0x6E, 0x75, 0xA9, 0xD5, 0x34, 0x6C, 0xB6, 0xA0, 0xD8, 0xEF, 0xE6, 0x38, 0xAF,
+    0x99, 0x6C, 0x46, 0x31, 0xC4, 0x6E, 0x7F, 0xEF, 0x35, 0xD5, 0xA4, 0x6A, 0x9C, 0xFF, 0x2C, 0x6D,
+    0x19, 0x0F, 0xEC, 0x2F, 0x74, 0xE0, 0x1E, 0xD7, 0xF1, 0xB7, 0x5E, 0x73, 0x1D, 0x7A, 0xD2, 0x72,
+    0x8E, 0x5A, 0x7D, 0xFC, 0x62, 0x0E, 0x23, 0x86, 0xCD, 0x16, 0xC2, 0xE2, 0xD6, 0x3A, 0x4C, 0xE9,
+    0x0B, 0x7E, 0x75, 0xA9, 0xD1, 0x74, 0xF5, 0xE3, 0xC0, 0x9F, 0x40, 0x23, 0x41, 0xD0, 0xCE, 0x28,
+    0xA5, 0x4E, 0x3F, 0xD3, 0xA4, 0x75, 0x28, 0x43, 0xB9, 0x59, 0x49, 0x3C, 0xB0, 0xC5, 0x5F, 0x2A,
+    0x89, 0x61, 0x31, 0xFA, 0xE4, 0x81, 0x4F, 0x3E, 0x0D, 0x87, 0xD1, 0x63, 0xC5, 0xB3, 0x26, 0x53,
+    0xAE, 0x6B, 0x32, 0xC0, 0xDD, 0x89, 0xB6, 0x8C, 0x3B, 0xC8, 0x55, 0xAA, 0x95, 0x19, 0xF4, 0x65,
+    0xD1, 0x0B, 0x2D, 0xAD, 0xA6, 0x71, 0xAB, 0x99, 0x44, 0xB7, 0xB6, 0x9A, 0x86, 0x84, 0x62, 0x5F,
+    0x67, 0x92, 0xA1, 0x9C, 0x67, 0x52, 0x27, 0x86, 0xDD, 0x68, 0xEE, 0xF5, 0xB3, 0x9A, 0x4B, 0x5A,
+    0xD0, 0x37, 0xB4, 0xE0, 0xBF, 0xA7, 0xC8, 0xB8, 0xDD, 0x39, 0x41, 0xD2, 0x0D, 0xAA, 0x77, 0x23,
+    0x21, 0x7A, 0x7D, 0xA6, 0xC6, 0x4B, 0x7F, 0x3B, 0x5E, 0xFE, 0x40, 0x8B, 0xCB, 0x9D, 0x1A, 0x45,
+    0x5B, 0xFA, 0xFD, 0x3A, 0x5E, 0x9A, 0xBD, 0x3B, 0x6A, 0xB9, 0x3F, 0xC4, 0xB0, 0x18, 0xB5, 0x9A,
+    0xC7, 0xDC, 0xA9, 0xB9, 0x19, 0x2F, 0x9D, 0xFC, 0x8A, 0xDF, 0x34, 0xF1, 0xA1, 0x67, 0xBA, 0x8D,
+    0x9B, 0x28, 0xCD, 0xD6, 0x8A, 0xD1, 0x7F, 0x21, 0x7C, 0xAA, 0xA0, 0x07, 0x05, 0x85, 0xDC, 0x48,
+    0x5B, 0xAB, 0x27, 0xCF, 0x19, 0x2D, 0x18, 0xCD, 0xCF, 0x5E, 0x75, 0xCF, 0xC8, 0xBB, 0xF8, 0x15,
+    0x68, 0xFE, 0x0A, 0x7C, 0xAD, 0x27, 0x18, 0x69, 0xEB, 0xD5, 0xA4, 0xFE, 0xE2, 0x00, 0x14, 0x31,
+    0xCA, 0x75, 0x4E, 0x7D, 0x45, 0xD0, 0x15, 0xD2, 0x85, 0xF5, 0x1E, 0x61, 0xF9, 0xD6, 0x5F, 0x2A,
+    0x06, 0x69, 0x0E, 0x3A, 0x78, 0xA0, 0xED, 0xBA, 0xF8, 0xBF, 0xC3, 0x58, 0xEB, 0xFB, 0x21, 0x12,
+    0x54, 0x9C, 0xF4, 0x9A, 0x94, 0xFF, 0x48, 0x8F, 0x26, 0xB7, 0xD2, 0xED, 0x10, 0x16, 0x6C, 0x81,
+    0x9A, 0x29, 0x6A, 0x34, 0x31, 0x26, 0x8C, 0xC0, 0x25, 0x8C, 0x1E, 0xE3, 0x94, 0x5A, 0x89, 0x5E,
+    0xEB, 0x19, 0xC1, 0xE1, 0xB6, 0xCB, 0xEB, 0x77, 0x5C, 0x1A, 0x53, 0xA3, 0x59, 0xF1, 0x19, 0xE6,
+    0x3A, 0x66, 0x5B, 0xD0, 0xE2, 0xD6, 0x4E, 0x68, 0x76, 0xC5, 0xA8, 0xD5, 0x6A, 0x15, 0x34, 0x39,
+    0xBD, 0x53, 0xF0, 0xFA, 0x52, 0xC2, 0x6F, 0x2E, 0x5E, 0xEA, 0x1D, 0x98, 0x83, 0xFE, 0x70, 0x2B,
+    0x7A, 0xF5, 0x60, 0xCC, 0x2E, 0x19, 0x19, 0x11, 0x96, 0x31, 0xD9, 0xD2, 0xAA, 0xD5, 0x34, 0x24,
+    0x97, 0x1A, 0xF5, 0x3B, 0x36, 0x29, 0xA2, 0x07, 0x09, 0xFB, 0xCE, 0x01, 0x0A, 0x91, 0xBE, 0xB2,
+    0x5B, 0xE8, 0xB4, 0x82, 0x2F, 0x60, 0x34, 0xDD, 0x48, 0xBF, 0x69, 0xE9, 0x0E, 0xCD, 0xE3, 0x8E,
+    0xDE, 0xC8, 0x46, 0x8B, 0xCD, 0x9A, 0xFD, 0xDE, 0xCA, 0x66, 0xFB, 0x78, 0x71, 0x6B, 0x78, 0x65,
+    0xDF, 0xFB, 0xBD, 0xCF, 0xEE, 0x8D, 0x45, 0x31, 0x7C, 0x21, 0xEF, 0xC3, 0xD6, 0xE7, 0x60, 0xBF,
+    0x2F, 0xC2, 0x97, 0xD2, 0xEE, 0x96, 0xEE, 0xC9, 0x6E, 0x7F, 0x50, 0xF0, 0x21, 0xEE, 0x9A, 0xBA,
+    0x77, 0xB3, 0x7D, 0x9C, 0xF0, 0x42, 0x3B, 0x9D, 0x56, 0xAB, 0x88, 0x2F, 0x28, 0xD7, 0x1C, 0x01,
+    0xB8, 0xAD, 0x22, 0xEE, 0xB3, 0x4C, 0x82, 0x2B, 0xB8, 0xAD, 0x17, 0x8D, 0x5E, 0x51, 0xC4, 0x16,
+    0xB7, 0x41, 0xF8, 0xC1, 0x01, 0x46, 0x95, 0x64, 0x27, 0x6A, 0x71, 0xAB, 0x72, 0xB8, 0x56, 0x89,
+    0xB3, 0x8B, 0x67, 0x50, 0x01, 0xA3, 0xB0, 0x80, 0xBE, 0x2F, 0x70, 0xD9, 0x6D, 0xF4, 0x6A, 0x34,
+    0x37, 0x8A, 0xB6, 0xE0, 0xF3, 0x8D, 0x91, 0x34, 0xB7, 0x9A, 0xCD, 0x81, 0x2D, 0xD8, 0x42, 0x58,
+    0x4F, 0x57, 0x13, 0xE2, 0x98, 0x69, 0x84, 0x22, 0x5D, 0xE9, 0x77, 0xB0, 0x9B, 0x4B, 0xE0, 0xBE,
+    0xA7, 0x09, 0xF4, 0x52, 0x01, 0x73, 0xF8, 0x05, 0xFA, 0xA7, 0xE2, 0x64, 0x96, 0x75, 0x70, 0x4E,
+    0x62, 0xB5, 0x5E, 0xA8, 0x46, 0xA5, 0xDD, 0x75, 0x4D, 0xF6, 0x07, 0x17, 0x50, 0xD0, 0x69, 0xBA,
+    0xD0, 0x5E, 0x5F, 0x53, 0xE8, 0xF9, 0x12, 0x37, 0x2E, 0x25, 0x2E, 0x29, 0xF5, 0x52, 0x36, 0xD2,
+    0xCE, 0xA3, 0x6F, 0xA8, 0xE6, 0x19, 0x3A, 0x4D, 0x18, 0x4D, 0x98, 0xB3, 0x92, 0xDC, 0x2A, 0xD2,
+    0x28, 0x56, 0x62, 0x7F, 0x65, 0xE3, 0x52, 0x74, 0x52, 0x1A, 0x6A, 0x55, 0xF4, 0x00, 0xEE, 0x66,
+    0xD0, 0x8A, 0xD5, 0x84, 0xDF, 0x6B, 0x53, 0xC2, 0x06, 0xFE, 0x57, 0xB8, 0x89, 0x2D, 0xDC, 0xD5,
+    0x82, 0x3F, 0x68, 0x35, 0x63, 0x05, 0x1F, 0x3D, 0x69, 0xC0, 0xAF, 0x61, 0x05, 0xFB, 0x99, 0x04,
+    0xDC, 0x6B, 0x37, 0x91, 0x5F, 0xA0, 0x01, 0xC2, 0x6F, 0x79, 0x7C, 0x8E, 0x7F, 0xF5, 0x90, 0x56,
+    0x33, 0xE3, 0x8E, 0xD1, 0x8A, 0x11, 0x8C, 0x2B, 0xED, 0x01, 0x6E, 0xB9, 0xF4, 0xD7, 0xF4, 0x19,
+    0x42, 0xED, 0xA6, 0x70, 0x82, 0xB0, 0xE2, 0x77, 0x06, 0x45, 0xA3, 0xE9, 0xD2, 0x77, 0x13, 0x66,
+    0xEC, 0x06, 0xAA, 0xFD, 0x19, 0x07, 0x77, 0xB5, 0x10, 0x0A, 0xBD, 0x26, 0xC2, 0x4C, 0x73, 0x02,
+    0xDE, 0x4E, 0x1B, 0xFF, 0x4D, 0x7A, 0x5A, 0x24, 0xE9, 0xDF, 0xDE, 0x95, 0xFE, 0x17, 0x77, 0x4F,
+    0x4B, 0xFF, 0x30, 0x1F, 0xA6, 0xD9, 0x9A, 0x0D, 0xBF, 0xFA, 0xD5, 0x96, 0x61, 0x37, 0x7A, 0x51,
+    0x93, 0x56, 0xAD, 0x2E, 0xBB, 0xDC, 0xAB, 0x17, 0x61, 0x0D, 0xAB, 0x91, 0x11, 0xE3, 0xE6, 0xB6,
+    0x46, 0xAF, 0x68, 0xB6, 0xC5, 0x16, 0xFC, 0xE2, 0x17, 0xF3, 0xA6, 0x79, 0x93, 0xE7, 0x78, 0x0E,
+    0x9E, 0xE7, 0x79, 0xC6, 0x38, 0xC6, 0x6E, 0xEF, 0x76, 0x5C, 0x72, 0x6B, 0x5B, 0xF1, 0xCE, 0x90,
+    0x51, 0x54, 0xEC, 0x8F, 0x7E, 0x6F, 0xF4, 0x6D, 0x45, 0xB7, 0xB9, 0xCD, 0xEE, 0x76, 0x6F, 0xF5,
+    0x05, 0xCD, 0x61, 0x0D, 0x6B, 0x57, 0xBA, 0x82, 0x65, 0xB8, 0x9A, 0xF8, 0x47, 0xF3, 0x25, 0x57,
+    0x54, 0xCD, 0xC1, 0x47, 0xA0, 0xDB, 0x00, 0xFE, 0xEC, 0x76, 0xD1, 0xF8, 0xF7, 0x59, 0x27, 0x04,
+    0x3E, 0xF6, 0x95, 0xAB, 0xA2, 0xDA, 0x50, 0x8D, 0x7C, 0xBE, 0x6A, 0xD4, 0xF1, 0xEF, 0x2D, 0x70,
+    0x87, 0xED, 0x6A, 0x5D, 0x8C, 0xD5, 0xE0, 0xC5, 0x29, 0x2D, 0xFE, 0x87, 0xE9, 0x14, 0x97, 0x61,
+    0xD3, 0x74, 0xCA, 0xDB, 0xED, 0x76, 0xA3, 0x0A, 0xDC, 0x68, 0x0A, 0x73, 0x95, 0x18, 0xBF, 0xF4,
+    0x97, 0x72, 0xDC, 0x78, 0xC9, 0xA0, 0x8A, 0x5E, 0xD2, 0x8E, 0x7B, 0xFB, 0xFE, 0x83, 0xAD, 0xD5,
+    0x54, 0x13, 0x43, 0x68, 0x0E, 0x0B, 0xE6, 0xA8, 0x2D, 0x38, 0x97, 0xF0, 0xC1, 0x1F, 0x7C, 0x9D,
+    0xCB, 0x3A, 0xB5, 0xCA, 0x80, 0xBE, 0x94, 0xC0, 0x66, 0x9B, 0x20, 0x60, 0x97, 0x0F, 0xAA, 0xDC,
+    0xD5, 0x2B, 0xC7, 0x1D, 0xCC, 0x31, 0xAE, 0xE0, 0xBE, 0x77, 0x40, 0x5B, 0x86, 0x08, 0x0D, 0xCF,
+    0x3D, 0x43, 0x6A, 0xAB, 0x19, 0x5A, 0x95, 0x8B, 0x8F, 0xB1, 0xEF, 0x16, 0x68, 0xE4, 0x23, 0xB8,
+    0x9F, 0x14, 0xE8, 0x76, 0xB7, 0x9C, 0x32, 0x0F, 0x9B, 0x5B, 0x30, 0x32, 0x07, 0xF8, 0x65, 0x5C,
+    0xAB, 0xC8, 0x8D, 0xA6, 0xB1, 0x76, 0x61, 0xD2, 0xEB, 0x6C, 0xA0, 0x14, 0x63, 0xCD, 0x7C, 0xDC,
+    0xFF, 0x8F, 0x9A, 0xC2, 0x82, 0xDD, 0x6C, 0x01, 0x7D, 0x5E, 0x13, 0xB6, 0xA6, 0x80, 0x5F, 0xDF,
+    0xAF, 0x42, 0xFD, 0xEF, 0xBB, 0x92, 0xEB, 0x26, 0x60, 0x5C, 0xAE, 0xCA, 0xEF, 0x2E, 0x52, 0x13,
+    0x1D, 0xAD, 0x32, 0x10, 0xCA, 0x95, 0x7B, 0xE6, 0x63, 0x0F, 0xAF, 0x88, 0xDC, 0x76, 0xE9, 0x0C,
+    0x6A, 0x0B, 0xC0, 0x37, 0x6F, 0xEA, 0xF5, 0xF7, 0x55, 0x92, 0x85, 0x3F, 0xF8, 0xDA, 0xA5, 0x11,
+    0xC9, 0xAF, 0xE7, 0x52, 0x33, 0x3B, 0xD0, 0xA5, 0x0F, 0x84, 0x7C, 0xED, 0xA3, 0xE9, 0x4C, 0xA9,
+    0x3A, 0xAD, 0x75, 0x49, 0x99, 0xBD, 0x2B, 0xF4, 0x6B, 0x53, 0x3E, 0x10, 0xFA, 0x03, 0xF0, 0x66,
+    0x03, 0x7D, 0x2A, 0x83, 0x5E, 0xCA, 0x10, 0xFA, 0x04, 0x1F, 0x62, 0xFA, 0x00, 0xC8, 0xD7, 0x7E,
+    0xFD, 0xD2, 0x86, 0x34, 0x41, 0x98, 0x61, 0x8C, 0xD0, 0x5F, 0xBB, 0xA2, 0xF7, 0xBD, 0xF6, 0xDB,
+    0x3C, 0x3A, 0x2B, 0xB8, 0xFD, 0x7E, 0x4A, 0xE1, 0x22, 0xF4, 0x37, 0x5B, 0x96, 0x5C, 0xAD, 0xA3,
+    0x2C, 0x78, 0x15, 0x5A, 0x1D, 0xD3, 0x75, 0x87, 0x60, 0xBF, 0xFF, 0xF6, 0xEA, 0xB1, 0xFB, 0xB5,
+    0xD5, 0xE3, 0x5E, 0x2B, 0x9D, 0x14, 0x2F, 0xFD, 0x8F, 0xF3, 0x19, 0x5B, 0xAC, 0x22, 0x46, 0x3B,
+    0xE8, 0xCB, 0x09, 0xB7, 0xF8, 0xD9, 0xDE, 0x32, 0xA6, 0xDF, 0xA9, 0x3C, 0x40, 0x93, 0x87, 0x88,
+    0xEC, 0x86, 0x7B, 0x75, 0xC7, 0xAE, 0x01, 0xA6, 0xE6, 0xB6, 0x34, 0x56, 0x9A, 0xCE, 0x2F, 0x3E,
+    0xBC, 0xEE, 0x2A, 0x0B, 0x4B, 0xED, 0x75, 0xB5, 0x85, 0xDB, 0x07, 0xDD, 0x6F, 0x3A, 0xD8, 0x1D,
+    0x55, 0x90, 0xA1, 0x7A, 0xDF, 0x68, 0x74, 0x01, 0xAD, 0xCF, 0x03, 0x7D, 0xEE, 0x56, 0x68, 0xF5,
+    0xB4, 0x3A, 0x77, 0xCD, 0xD0, 0x7F, 0x57, 0x09, 0xC8, 0x4D, 0x7E, 0x4F, 0xE4, 0xFD, 0x40, 0xD7,
+    0x68, 0xEF, 0x7E, 0xED, 0xAA, 0x29, 0xF4, 0x8C, 0x72, 0x6E, 0xB9, 0x72, 0xD5, 0xB8, 0xF7, 0x76,
+    0xD8, 0x69, 0xA1, 0xF6, 0xF2, 0x73, 0xD5, 0xB3, 0x91, 0xD0, 0xDE, 0x69, 0xE9, 0x34, 0x1B, 0x45,
+    0x97, 0xE9, 0xD4, 0x2A, 0x62, 0x8B, 0xDD, 0xC1, 0x6D, 0x2E, 0x81, 0xBE, 0xAB, 0x88, 0xD1, 0xA7,
+    0x0E, 0x4E, 0x1E, 0xE1, 0x92, 0x22, 0x8D, 0x5E, 0x15, 0xF4, 0x87, 0x2D, 0xE0, 0x36, 0xB7, 0xD1,
+    0x2A, 0x6A, 0xC5, 0x1E, 0xAD, 0x22, 0x4A, 0x46, 0xCB, 0xA0, 0xA9, 0x97, 0x94, 0xB1, 0x92, 0x66,
+    0xAC, 0xB4, 0x5D, 0x1A, 0xDD, 0x2F, 0xEC, 0xAB, 0x79, 0x34, 0x5D, 0x56, 0x38, 0x5A, 0x2E, 0x81,
+    0xA3, 0x42, 0x36, 0x93, 0x3F, 0xE8, 0xD2, 0x7F, 0xEE, 0x2B, 0x9C, 0xDC, 0xAF, 0x02, 0x84, 0x6E,
+    0x0F, 0x33, 0xF8, 0x18, 0x26, 0x4C, 0xE6, 0x5B, 0x1F, 0x70, 0xE9, 0xAB, 0x54, 0xAF, 0x14, 0x40,
+    0x76, 0x83, 0xAE, 0xB8, 0x05, 0xEC, 0xAA, 0x5B, 0x3B, 0x1A, 0x3E, 0xA0, 0xD2, 0x7F, 0xEE, 0xE1,
+    0x15, 0xB6, 0x19, 0x13, 0x54, 0xA7, 0x8F, 0x29, 0x70, 0xCB, 0xEF, 0xF3, 0x41, 0x2A, 0xCD, 0x5E,
+    0x50, 0x88, 0xB9, 0x4E, 0x6C, 0x0E, 0xDB, 0x95, 0xD4, 0xB7, 0xCD, 0xE5, 0x83, 0x24, 0x75, 0xFB,
+    0xE8, 0x0A, 0xF0, 0x3B, 0x2D, 0x60, 0x9F, 0x08, 0xCC, 0xDE, 0x65, 0xF8, 0x16, 0x43, 0xFC, 0xA0,
+    0xEA, 0x1A, 0xA0, 0x4B, 0x6E, 0x3A, 0x21, 0x8B, 0xDD, 0x34, 0x9F, 0x98, 0x85, 0xE9, 0x43, 0x1F,
+    0x50, 0x5D, 0xB7, 0x8F, 0x6E, 0x97, 0x93, 0xD2, 0x05, 0x80, 0x8F, 0x67, 0x10, 0xE5, 0xB3, 0xC0,
+    0x28, 0x9B, 0x5A, 0xC9, 0xC7, 0x51, 0x3A, 0x1A, 0x3D, 0xD5, 0x66, 0xD5, 0x68, 0xF1, 0xC9, 0xA8,
+    0x3D, 0xC9, 0xB5, 0x5B, 0x5D, 0x6A, 0xF4, 0x71, 0xCD, 0x67, 0x8A, 0x76, 0xCC, 0x8D, 0x62, 0x58,
+    0xED, 0xD1, 0x28, 0x86, 0xCD, 0xE8, 0xB1, 0xA2, 0xAD, 0x9D, 0x13, 0xFF, 0x90, 0x19, 0xF6, 0x71,
+    0xE5, 0x12, 0x8B, 0x1F, 0x3D, 0x3C, 0xEB, 0xBB, 0x3E, 0x5D, 0x36, 0x9A, 0xAC, 0x67, 0x0D, 0xF2,
+    0x77, 0x22, 0xC0, 0xC7, 0xBE, 0x7A, 0x66, 0xA3, 0x46, 0xAD, 0xB4, 0x72, 0x0B, 0xE3, 0xEA, 0x62,
+    0xBB, 0x57, 0x36, 0xF2, 0xBB, 0xD0, 0x00, 0x60, 0xE3, 0x37, 0x21, 0x7C, 0xB1, 0x60, 0x8E, 0x31,
+    0xD1, 0x27, 0x3F, 0xDD, 0xE0, 0x88, 0xEF, 0xB7, 0x00, 0xFF, 0x1F, 0x6B, 0x96, 0x7E, 0xAA, 0x5B,
+    0x84, 0xC2, 0x52, 0x8B, 0xD5, 0xC3, 0x8A, 0xD5, 0x82, 0x55, 0xAC, 0x18, 0xAF, 0xFD, 0xFA, 0x05,
+    0xB7, 0x6D, 0xD0, 0xE8, 0xB4, 0xB6, 0xF6, 0x8C, 0xBC, 0xCD, 0x67, 0xA1, 0x57, 0x66, 0x90, 0xE2,
+    0x20, 0x6D, 0xF6, 0xE8, 0x0E, 0xBB, 0xA3, 0x2F, 0x1E, 0xB8, 0x1F, 0x6B, 0xF2, 0x9B, 0xDE, 0x52,
+    0xF1, 0x52, 0x19, 0xA4, 0xAD, 0xD7, 0x5B, 0x53, 0xAB, 0xA9, 0x0A, 0x33, 0x14, 0x3E, 0x6C, 0xF4,
+    0x77, 0x01, 0x5F, 0xF7, 0xF8, 0x25, 0xBC, 0xD6, 0x4B, 0x96, 0xF8, 0xD1, 0xB9, 0xEB, 0xA6, 0x3F,
+    0x2E, 0x50, 0x79, 0xB9, 0x01, 0x95, 0xEF, 0xFC, 0x45, 0x1D, 0xF4, 0xC6, 0xC6, 0xA4, 0x21, 0xDB,
+    0x1D, 0xBD, 0xA2, 0xD9, 0xE6, 0x71, 0xEB, 0xF4, 0xA2, 0xFE, 0x5A, 0xC9, 0x4B, 0xA5, 0x93, 0x76,
+    0xC2, 0xF1, 0xD5, 0x7A, 0x2F, 0x7E, 0x3D, 0xCB, 0x9B, 0xEE, 0xF8, 0x74, 0x6A, 0x4E, 0xD6, 0x9D,
+    0xEA, 0xF2, 0xAA, 0xB5, 0xDB, 0x8F, 0x7D, 0xF5, 0x26, 0x28, 0xFE, 0x52, 0x05, 0xC5, 0xD7, 0x0C,
+    0xEB, 0x7D, 0x1C, 0x19, 0x68, 0x8A, 0x8D, 0xE8, 0xA5, 0x8C, 0xFB, 0xFE, 0x8E, 0x4D, 0x37, 0xE0,
+    0xEF, 0xFB, 0xA1, 0xE6, 0xF6, 0x11, 0xE3, 0x86, 0xE6, 0xAE, 0x30, 0xAC, 0x97, 0xBC, 0x57, 0x58,
+    0x6C, 0x41, 0x71, 0xC8, 0xAD, 0x26, 0x97, 0x8C, 0x70, 0xA9, 0x3B, 0x2E, 0x47, 0x6D, 0x6E, 0x34,
+    0x8F, 0xDB, 0xE5, 0x28, 0x7C, 0xEE, 0x21, 0x43, 0xC1, 0x08, 0x14, 0x19, 0x57, 0xCC, 0x76, 0x73,
+    0x57, 0xE6, 0x75, 0x0E, 0xBF, 0xD5, 0x54, 0x93, 0xF7, 0x75, 0x07, 0xC2, 0x71, 0xF3, 0xB4, 0xCD,
+    0x34, 0x9A, 0x19, 0xB7, 0x9B, 0xA7, 0xF9, 0xC8, 0xD7, 0xE8, 0xB5, 0xB4, 0x12, 0xE1, 0xF5, 0x6D,
+    0x5C, 0xDD, 0x6B, 0xDB, 0x75, 0xF4, 0xFB, 0x7F, 0xFC, 0x69, 0x60, 0xEF, 0xD7, 0xF0, 0xC5, 0x32,
+    0xFE, 0x48, 0x5D, 0x72, 0xD3, 0x73, 0xCD, 0x8D, 0x1F, 0xAE, 0xED, 0xC0, 0xDD, 0x41, 0xF5, 0xDA,
+    0xCF, 0xFC, 0x9C, 0x6F, 0x7F, 0x1E, 0xCE, 0xA5, 0xF0, 0x21, 0xF0, 0x8B, 0xA3, 0xD1, 0x71, 0x69,
+    0x86, 0xFB, 0x91, 0x36, 0xFA, 0xF8, 0xD1, 0xF9, 0x86, 0x5F, 0x0C, 0xBD, 0x66, 0x34, 0x6A, 0x45,
+    0x41, 0xA9, 0xD1, 0x1E, 0xB6, 0x56, 0xEB, 0xB8, 0xB5, 0x8A, 0xE3, 0x66, 0x34, 0x5D, 0x6B, 0xD7,
+    0xA5, 0x7E, 0xBF, 0xD4, 0xA4, 0x6D, 0x21, 0x2C, 0x36, 0xA3, 0x38, 0x6C, 0x28, 0x8E, 0xA9, 0xD1,
+    0xEC, 0x52, 0xA3, 0xC9, 0xA5, 0x56, 0xF8, 0xD5, 0x08, 0xEE, 0x7E, 0xFD, 0xC4, 0xF7, 0x75, 0xDF,
+    0x55, 0xBE, 0x20, 0xFC, 0x4B, 0x72, 0xE5, 0xEE, 0xC3, 0x9A, 0xBE, 0xEC, 0xCF, 0x46, 0x78, 0xFC,
+    0x11, 0x36, 0x7B, 0x34, 0xFA, 0xB6, 0xA2, 0x2D, 0x6E, 0x43, 0xAF, 0xEA, 0x2C, 0xBD, 0xBD, 0x76,
+    0x60, 0x4B, 0x58, 0x1A, 0xFD, 0xF9, 0x8E, 0xDB, 0xFC, 0xDA, 0xA9, 0x53, 0xA3, 0xD5, 0x1D, 0x2A,
+    0x17, 0xD3, 0x8D, 0x15, 0xEE, 0x9D, 0xA6, 0xFB, 0x9B, 0x97, 0xEB, 0xFB, 0x38, 0xF2, 0x6F, 0x59,
+    0xAE, 0xEF, 0xE7, 0x3D, 0x03, 0x7F, 0x66, 0x52, 0xC5, 0x0C, 0xB2, 0x5B, 0xA5, 0xAB, 0xCF, 0x5D,
+    0x52, 0x1D, 0xEF, 0xDF, 0xC8, 0xED, 0xA3, 0xAB, 0xAC, 0xC7, 0x55, 0xFC, 0x1F, 0x16, 0x60, 0x98,
+    0xAF, 0x83, 0xD3, 0x55, 0x51, 0x36, 0xFA, 0xD5, 0xA8, 0xBD, 0x51, 0x94, 0x7D, 0x46, 0x13, 0x41,
+    0x7F, 0x18, 0xE1, 0x36, 0x9B, 0x1B, 0x45, 0xB7, 0x5A, 0xA1, 0x18, 0xB2, 0xD1, 0x63, 0x2D, 0x56,
+    0xBB, 0x18, 0xF4, 0x93, 0xC2, 0xB0, 0xDB, 0xC4, 0x9D, 0xF7, 0xC6, 0xFF, 0x2B, 0xA6, 0x7F, 0x3B,
+    0xFE, 0xBF, 0xDF, 0x02, 0x7C, 0xE4, 0xAB, 0xE7, 0xBE, 0xA8, 0x51, 0xE9, 0x3A, 0xFE, 0x37, 0xD7,
+    0xF1, 0xFF, 0x7D, 0xD7, 0x00, 0x60, 0x97, 0x33, 0xFE, 0xB7, 0xC7, 0x98, 0xE8, 0x6E, 0xC7, 0xFF,
+    0xDF, 0x85, 0x00, 0x40, 0x27, 0xA9, 0x6E, 0xD0, 0xBD, 0xDA, 0x00, 0x51, 0x7B, 0x97, 0x25, 0x4D,
+    0xA3, 0xA6, 0xF0, 0xF6, 0xFD, 0x7B, 0x5D, 0x4D, 0x05, 0xA0, 0xF5, 0x12, 0x0F, 0xFA, 0xBD, 0x12,
+    0x8C, 0x73, 0x97, 0xA4, 0xDD, 0xEF, 0xBF, 0xDC, 0x1D, 0x34, 0x92, 0xA6, 0xB0, 0x30, 0x4A, 0xC9,
+    0xD6, 0xAD, 0x49, 0x28, 0xE2, 0x9E, 0x3E, 0xFA, 0x8A, 0xAD, 0x3E, 0xFE, 0xDC, 0x7E, 0x71, 0x6E,
+    0xA2, 0xA0, 0xB6, 0x44, 0x40, 0xAF, 0x0A, 0x47, 0x5D, 0x69, 0x6A, 0x7F, 0x5F, 0x15, 0xCA, 0x4A,
+    0x92, 0xE6, 0xFA, 0x5F, 0x0C, 0x6C, 0xE0, 0xCF, 0xAD, 0x70, 0x2F, 0x5C, 0x45, 0xB4, 0xE6, 0xB3,
+    0x30, 0x68, 0x19, 0xB5, 0x22, 0x3D, 0xA9, 0x75, 0x38, 0x49, 0xA5, 0xD7, 0x5F, 0xEA, 0xE8, 0x77,
+    0xBB, 0xB7, 0xDA, 0xCC, 0x31, 0xE6, 0x46, 0x6B, 0xB7, 0xD7, 0x2E, 0xED, 0xE2, 0x12, 0x7A, 0x4B,
+    0xD9, 0xAF, 0x8D, 0xA4, 0xB5, 0xFE, 0x99, 0xC2, 0x72, 0x36, 0x30, 0x9D, 0xD9, 0xA9, 0x5E, 0x13,
+    0xF8, 0x34, 0x28, 0x32, 0xB9, 0x43, 0x7A, 0xFB, 0x41, 0x1C, 0xAA, 0x8A, 0x7A, 0xE9, 0x81, 0x14,
+    0x1B, 0xE5, 0x4E, 0x07, 0xDC, 0xA1, 0x6E, 0xBF, 0x56, 0x71, 0xD7, 0xCF, 0x3C, 0x56, 0x05, 0x16,
+    0xF7, 0xEC, 0xBF, 0x19, 0x37, 0x8F, 0xCB, 0x90, 0x6C, 0xEE, 0x8A, 0x51, 0xA3, 0x49, 0xF1, 0x85,
+    0x7B, 0xA0, 0x29, 0x2C, 0x2E, 0x0D, 0x5B, 0x9F, 0x4D, 0x69, 0x0F, 0xC4, 0x0B, 0x80, 0x9B, 0xBE,
+    0xC5, 0x18, 0xFD, 0x3C, 0x24, 0x17, 0xED, 0x36, 0xAE, 0x5D, 0xB1, 0x9B, 0x39, 0xFA, 0xD2, 0xE8,
+    0xC5, 0x03, 0x7D, 0x47, 0xBC, 0x70, 0xEF, 0xFE, 0x04, 0x7A, 0xF1, 0x68, 0xD5, 0x1D, 0x46, 0x7D,
+    0xE9, 0x8A, 0xCD, 0x7D, 0x1E, 0x92, 0x4D, 0x6E, 0x19, 0x57, 0x17, 0x5D, 0x0C, 0xBC, 0xC0, 0xFD,
+    0xCB, 0x84, 0x6F, 0xCD, 0x81, 0xFF, 0xA2, 0x50, 0x74, 0xBF, 0x54, 0x0C, 0x69, 0xD8, 0x43, 0x1A,
+    0x4B, 0xA7, 0x61, 0xEB, 0x76, 0x34, 0xDF, 0xE3, 0x79, 0xEE, 0xF0, 0x4F, 0xCD, 0x9A, 0x31, 0xEC,
+    0x26, 0xC7, 0x59, 0xC6, 0x9F, 0xDD, 0x91, 0x6F, 0x25, 0x56, 0x62, 0x9A, 0xB8, 0x09, 0xC5, 0xF4,
+    0x34, 0xDB, 0x50, 0xD1, 0xCC, 0xDA, 0x2E, 0x28, 0x52, 0xD8, 0x45, 0xCE, 0x12, 0xA4, 0xB8, 0xC6,
+    0x4D, 0xD2, 0xA4, 0xA6, 0x61, 0x96, 0xB8, 0xA0, 0x48, 0xC1, 0x35, 0x54, 0x14, 0xA1, 0x88, 0x84,
+    0x62, 0x17, 0x57, 0x23, 0x05, 0x66, 0x6C, 0x17, 0x29, 0x52, 0x64, 0x93, 0x40, 0x52, 0xA4, 0x60,
+    0x85, 0x1D, 0x40, 0x4E, 0x71, 0x03, 0x59, 0xE3, 0x3D, 0xDF, 0xEC, 0xFC, 0x28, 0x66, 0xBF, 0xFF,
+    0xDD, 0x39, 0x21, 0x34, 0x08, 0x58, 0xE9, 0xBF, 0x9F, 0xBE, 0x6F, 0x66, 0x67, 0x67, 0xDE, 0x79,
+    0xDF, 0xF7, 0x79, 0xDE, 0x67, 0xFE, 0x92, 0x24, 0xE9, 0x6F, 0x87, 0x55, 0xC2, 0x66, 0x75, 0xB8,
+    0xAC, 0xEE, 0x74, 0x9B, 0xF4, 0xED, 0x7B, 0x8B, 0x9E, 0x5D, 0x0E, 0x8A, 0x26, 0x28, 0xF2, 0x70,
+    0xC8, 0xC3, 0x2E, 0xFF, 0xC9, 0xFD, 0x37, 0x14, 0x36, 0x49, 0x71, 0x95, 0x44, 0xBA, 0xBB, 0xFD,
+    0xC3, 0x7D, 0x75, 0xC0, 0xDC, 0x03, 0x32, 0xED, 0xF6, 0xCE, 0x77, 0x34, 0x54, 0x49, 0x63, 0x95,
+    0x34, 0x9E, 0x92, 0x6C, 0xB9, 0xDD, 0x5C, 0x91, 0x34, 0x5D, 0x03, 0xDF, 0x46, 0x87, 0x2C, 0x49,
+    0xF1, 0x90, 0xE4, 0xAB, 0xA4, 0x89, 0x24, 0x59, 0xB2, 0x34, 0x3E, 0x2D, 0x92, 0x39, 0x91, 0x0C,
+    0x3E, 0xA9, 0xE3, 0xF5, 0x5D, 0xE2, 0x83, 0x53, 0x0A, 0x2B, 0x8B, 0x7C, 0x9E, 0x36, 0xB9, 0x7D,
+    0x3C, 0x64, 0x4B, 0x8F, 0x86, 0x53, 0x31, 0x19, 0x20, 0x77, 0x40, 0x11, 0x80, 0x22, 0xB0, 0xFA,
+    0x4F, 0xEE, 0x3F, 0xD8, 0xA7, 0x5D, 0xA6, 0xDA, 0x22, 0xF1, 0xCD, 0x2A, 0xF9, 0x0F, 0x91, 0x6C,
+    0x65, 0x91, 0x41, 0x16, 0xCA, 0xAF, 0x2C, 0xFD, 0xC5, 0x55, 0xC7, 0x67, 0xAB, 0xFE, 0xF8, 0xA1,
+    0x3A, 0xA8, 0xEA, 0x81, 0x64, 0x80, 0xCD, 0xF0, 0x26, 0xD9, 0x54, 0x85, 0x3C, 0x9C, 0xF2, 0x79,
+    0x3C, 0xE5, 0xB3, 0x2D, 0xED, 0x16, 0x37, 0x77, 0x0C, 0xAC, 0x0E, 0x58, 0x26, 0xE0, 0x6E, 0xE9,
+    0x8B, 0x64, 0xF9, 0x6C, 0xD6, 0x00, 0xA7, 0x7A, 0x60, 0x15, 0x50, 0xE4, 0x3F, 0x79, 0xC0, 0x6C,
+    0x8B, 0x58, 0x87, 0x2A, 0xBF, 0xF7, 0xED, 0x4B, 0x1A, 0xAA, 0xFC, 0x27, 0x5F, 0x41, 0x0E, 0xD0,
+    0x00, 0x87, 0x7A, 0x60, 0x11, 0x1F, 0xC7, 0x22, 0x9F, 0x0D, 0xB3, 0x3B, 0x14, 0xB6, 0xF1, 0x94,
+    0x3B, 0x0C, 0x1A, 0xAB, 0x48, 0x86, 0xD9, 0xE7, 0x81, 0xE4, 0x80, 0x6D, 0x04, 0xB2, 0x01, 0x36,
+    0x41, 0x9D, 0xF5, 0xE2, 0xAA, 0x9F, 0xDF, 0x6B, 0xBF, 0x49, 0x0A, 0xEB, 0xAF, 0x6C, 0x78, 0xC7,
+    0x22, 0x75, 0xCC, 0x52, 0x8F, 0x24, 0x73, 0x77, 0x1B, 0x7E, 0xCD, 0x5E, 0xDB, 0x43, 0x92, 0x3B,
+    0x24, 0x4D, 0xBB, 0x24, 0x9F, 0x6F, 0x37, 0xA9, 0x03, 0x0E, 0x69, 0x04, 0x36, 0xC9, 0x03, 0xB3,
+    0xDA, 0xDA, 0x35, 0xD4, 0xFB, 0x31, 0x4B, 0x53, 0xEE, 0x58, 0x24, 0xD2, 0x78, 0x4A, 0xA6, 0xCA,
+    0xEF, 0x92, 0xDB, 0x45, 0x92, 0x48, 0x06, 0xC9, 0x20, 0x77, 0x48, 0xEE, 0x50, 0x5C, 0xA5, 0xB8,
+    0x5E, 0xBF, 0xD9, 0x22, 0xB9, 0x43, 0x21, 0x4B, 0xA4, 0x8E, 0x45, 0x03, 0x1A, 0x4F, 0xC9, 0xEF,
+    0xF2, 0x59, 0x3D, 0x8B, 0x48, 0x9A, 0x4E, 0x0D, 0xC8, 0x02, 0xB0, 0x05, 0x00, 0xBE, 0x01, 0xC0,
+    0x39, 0x02, 0x90, 0x7D, 0x96, 0x44, 0x22, 0x49, 0x43, 0x1D, 0xAA, 0x24, 0xB7, 0x4F, 0xBB, 0xA4,
+    0xB8, 0x92, 0xAE, 0x25, 0xFF, 0xDF, 0x86, 0xCB, 0x78, 0xC8, 0x1E, 0xF2, 0xBB, 0xA6, 0x5D, 0x7E,
+    0x33, 0x2C, 0xF2, 0x5B, 0xC7, 0x3C, 0x15, 0x29, 0xA6, 0xB1, 0x74, 0x24, 0x89, 0xC5, 0x67, 0x7B,
+    0x4A, 0x3D, 0x62, 0x61, 0x93, 0x86, 0x6A, 0xEA, 0x88, 0x24, 0x5B, 0xDC, 0x1E, 0xB2, 0x24, 0xB7,
+    0xC7, 0x0F, 0x98, 0x25, 0xF9, 0x4F, 0x09, 0x87, 0x24, 0x45, 0x60, 0x91, 0x64, 0xDA, 0x76, 0x48,
+    0x13, 0x2D, 0x3E, 0x7B, 0xA8, 0xAC, 0x92, 0x5C, 0xF5, 0xFF, 0xD6, 0x96, 0x93, 0x79, 0x1B, 0x49,
+    0x96, 0xE1, 0xB4, 0xA7, 0xA4, 0xB8, 0x4F, 0xD9, 0x15, 0x69, 0x60, 0x21, 0xF9, 0x2C, 0x85, 0x62,
+    0x10, 0x9B, 0x0C, 0xC9, 0x1E, 0x3D, 0x49, 0xFE, 0x54, 0x58, 0x0D, 0xEA, 0xD9, 0x7A, 0x64, 0xAB,
+    0x1C, 0xB2, 0x45, 0x53, 0xB9, 0xCC, 0xF9, 0x3B, 0x3C, 0x51, 0x07, 0x24, 0x01, 0x59, 0xC0, 0xAE,
+    0x3F, 0x56, 0x38, 0xA4, 0xD6, 0xC7, 0xDD, 0xF9, 0x94, 0xCF, 0x7A, 0xE9, 0x4D, 0x56, 0x4D, 0x30,
+    0x6B, 0x6A, 0x6E, 0x74, 0x48, 0xBF, 0x0B, 0x92, 0x06, 0x96, 0x17, 0x0D, 0x9F, 0xA4, 0x9E, 0xF4,
+    0x96, 0x46, 0x96, 0xF0, 0x31, 0x28, 0xC0, 0xA9, 0x00, 0x7B, 0x7B, 0x5E, 0x2F, 0xCF, 0x92, 0x5C,
+    0xD6, 0x54, 0x35, 0x65, 0xF9, 0x2A, 0x9F, 0xC5, 0x29, 0xBF, 0xF5, 0x14, 0xF9, 0xD5, 0x50, 0x14,
+    0x92, 0xE5, 0x50, 0x4C, 0x8E, 0x5D, 0x24, 0xFF, 0x78, 0x17, 0x4B, 0xFC, 0x56, 0x16, 0xAF, 0x30,
+    0xE5, 0x0E, 0x73, 0xFA, 0xAD, 0x67, 0x2C, 0x7E, 0x35, 0xD5, 0xE5, 0x90, 0xCC, 0xE9, 0xB7, 0x98,
+    0x86, 0x12, 0x13, 0x69, 0x3C, 0x11, 0xCB, 0xF8, 0xB4, 0x76, 0xCC, 0x96, 0xD2, 0x21, 0xCB, 0xDE,
+    0x23, 0xC7, 0x66, 0xAA, 0x26, 0x92, 0xA9, 0xF2, 0xCC, 0xC3, 0x29, 0x8F, 0xC6, 0x22, 0x5F, 0xDA,
+    0xF6, 0xB7, 0x6B, 0x5A, 0x6D, 0x96, 0xDC, 0x36, 0x65, 0xC9, 0x7E, 0x16, 0x93, 0x34, 0xC2, 0x2C,
+    0x75, 0x1C, 0x7A, 0xE1, 0xFA, 0xFF, 0x36, 0x7F, 0x7B, 0xC8, 0x15, 0xB9, 0xFD, 0x72, 0x53, 0x36,
+    0xF9, 0xDC, 0x93, 0xE4, 0xF3, 0x80, 0x14, 0x36, 0x7B, 0x4A, 0x71, 0xF5, 0xBB, 0x14, 0x53, 0xDC,
+    0x24, 0xDE, 0x27, 0x49, 0xFC, 0x0C, 0xA9, 0x83, 0x53, 0xEA, 0xE1, 0x90, 0xCC, 0x75, 0x8F, 0x45,
+    0x32, 0xD5, 0x9E, 0xD2, 0x50, 0xC7, 0x2A, 0x8D, 0xA7, 0x41, 0xB2, 0xC5, 0x30, 0xCB, 0x96, 0x9E,
+    0x24, 0x77, 0x88, 0x24, 0xB7, 0x8B, 0x4D, 0xD3, 0xAE, 0x90, 0xE5, 0xF3, 0x15, 0xF9, 0xFE, 0x90,
+    0x34, 0x00, 0xAB, 0x14, 0xE1, 0x94, 0x2C, 0x90, 0xD4, 0x80, 0x42, 0xD3, 0x93, 0x37, 0x49, 0xB7,
+    0x9C, 0xE2, 0xB7, 0x9E, 0x59, 0xC3, 0x29, 0x9F, 0xA5, 0x98, 0xDA, 0x5B, 0x5A, 0x4A, 0x59, 0xC6,
+    0x2A, 0xB9, 0x5D, 0x71, 0x55, 0xDF, 0x92, 0x8D, 0xCF, 0x22, 0x69, 0xA8, 0x72, 0x87, 0x14, 0xD7,
+    0x9E, 0x59, 0xB6, 0xC8, 0xEF, 0xEA, 0x58, 0x0C, 0x57, 0xE2, 0xE9, 0x1C, 0x1A, 0xAA, 0x3C, 0x9B,
+    0xE2, 0x6A, 0x28, 0xB2, 0x45, 0x9E, 0x96, 0xCA, 0x96, 0xE7, 0xF7, 0xDA, 0x32, 0x6B, 0x24, 0x75,
+    0xEC, 0x12, 0x45, 0x13, 0xB3, 0x26, 0x92, 0xE1, 0x90, 0xE1, 0x90, 0x67, 0x51, 0x64, 0x1E, 0x38,
+    0x64, 0xD9, 0x15, 0xE3, 0xD2, 0x57, 0x34, 0x3E, 0x2D, 0xF2, 0x8F, 0xB3, 0x08, 0x69, 0xFC, 0xB4,
+    0xCA, 0xFE, 0xB2, 0x08, 0xBF, 0x76, 0xF8, 0x34, 0xFD, 0xB4, 0x68, 0xFA, 0xF7, 0x62, 0x4A, 0x4C,
+    0xA6, 0x4E, 0x29, 0xBE, 0x5E, 0xE4, 0x7F, 0x54, 0x6C, 0x66, 0x31, 0x65, 0x7A, 0xFF, 0xB4, 0xBB,
+    0xC2, 0x7B, 0xA7, 0x7F, 0x0F, 0x8D, 0xC5, 0xFD, 0x6C, 0x9F, 0xB2, 0xF8, 0xD3, 0x8A, 0xA9, 0xB2,
+    0xBB, 0x63, 0xF5, 0x5B, 0x47, 0x47, 0x19, 0x4E, 0xB9, 0x6C, 0x99, 0x43, 0xEA, 0x11, 0x79, 0x2C,
+    0xF2, 0x9B, 0x3D, 0xC5, 0x62, 0x4E, 0x91, 0xEC, 0x2E, 0xB9, 0x43, 0x63, 0xD1, 0xB4, 0x5F, 0xEB,
+    0xB6, 0x45, 0x3E, 0xCB, 0x1D, 0xF2, 0x59, 0xD3, 0xAE, 0xB0, 0xC9, 0x67, 0xC5, 0xF5, 0x32, 0x54,
+    0xBB, 0x87, 0x4D, 0x7C, 0xFC, 0x0E, 0x6B, 0x07, 0x90, 0x7A, 0x6E, 0x38, 0x7A, 0xDD, 0x97, 0x01,
+    0xF5, 0xCC, 0x63, 0x95, 0x41, 0xE3, 0x79, 0xE5, 0xF5, 0xA1, 0xCA, 0x16, 0x8D, 0xA7, 0xDC, 0x21,
+    0x7B, 0xFE, 0x97, 0x2F, 0xBC, 0x5D, 0xB1, 0xCE, 0xD2, 0x04, 0x8B, 0x0C, 0x90, 0xE4, 0x81, 0xC5,
+    0xF0, 0x91, 0x43, 0xD3, 0x29, 0x5B, 0xC5, 0x2A, 0x57, 0x46, 0x24, 0x9F, 0xFD, 0x7E, 0xA5, 0x7B,
+    0xC3, 0x50, 0x25, 0x5B, 0xA6, 0x5D, 0xF2, 0x99, 0x24, 0xF1, 0x01, 0xD2, 0x50, 0x6D, 0x91, 0xA6,
+    0xDD, 0xE7, 0xAB, 0xDF, 0x88, 0x61, 0x96, 0xDF, 0x47, 0x64, 0x48, 0x96, 0x39, 0x9C, 0x9A, 0x80,
+    0x4D, 0x1E, 0xAA, 0xE4, 0x61, 0x95, 0x5C, 0x8B, 0xD0, 0x37, 0x2E, 0xA0, 0x68, 0x48, 0xD1, 0xA0,
+    0xA2, 0x65, 0xF3, 0x06, 0x16, 0x21, 0x3F, 0xB3, 0x52, 0xD8, 0x44, 0x52, 0x5C, 0x45, 0x12, 0xED,
+    0x9E, 0x3A, 0x16, 0x91, 0x7A, 0xE6, 0xE6, 0x52, 0x3D, 0xB3, 0x41, 0x06, 0x0D, 0xCD, 0x3E, 0xF5,
+    0xC2, 0xB8, 0x3B, 0xFB, 0xD8, 0x22, 0x5B, 0xE4, 0x0E, 0xD9, 0xA2, 0x69, 0x97, 0x6B, 0x38, 0x71,
+    0xB3, 0x8F, 0xCF, 0xF2, 0x59, 0xB2, 0xFC, 0xAB, 0x34, 0x40, 0x56, 0x0F, 0xCC, 0x2D, 0xDF, 0xFA,
+    0x4F, 0x42, 0x95, 0x3B, 0x7A, 0xD2, 0x78, 0xCA, 0xE7, 0xE6, 0xE2, 0xA4, 0x01, 0xF9, 0x6C, 0x58,
+    0x5A, 0x0B, 0x8F, 0xD8, 0xCC, 0x2D, 0x3D, 0xE7, 0xB6, 0x54, 0xF7, 0xE4, 0xFE, 0x05, 0x5E, 0x0D,
+    0x1B, 0x49, 0x52, 0x83, 0x40, 0xB7, 0xEB, 0x57, 0x5B, 0xAE, 0x6B, 0xE4, 0x89, 0x34, 0x5D, 0xA0,
+    0x56, 0x9A, 0xE9, 0x3C, 0xF3, 0x24, 0x57, 0xA5, 0xD9, 0x56, 0x49, 0x63, 0xA3, 0x18, 0xF3, 0xED,
+    0xC9, 0xB8, 0xDD, 0xF8, 0x84, 0x2D, 0x2F, 0x8E, 0xE9, 0xF3, 0xB3, 0x1F, 0x17, 0x49, 0x31, 0xB7,
+    0x78, 0x1A, 0x1B, 0x4D, 0x6B, 0xB8, 0x69, 0xA0, 0x48, 0x8E, 0x27, 0x6A, 0x39, 0xDF, 0x01, 0x39,
+    0x02, 0x1F, 0x00, 0xD5, 0x02, 0xFB, 0xCB, 0x0F, 0xEA, 0xFD, 0x59, 0x17, 0x03, 0x90, 0x06, 0x6E,
+    0x88, 0x13, 0xD7, 0xEB, 0x7D, 0xB6, 0x5C, 0x8B, 0xEB, 0x59, 0xAE, 0xB5, 0x3D, 0xEB, 0x5E, 0x6F,
+    0xF3, 0xE3, 0xD7, 0x74, 0x9F, 0xDB, 0x4F, 0xD3, 0x31, 0x16, 0x89, 0xE4, 0x76, 0x8D, 0x55, 0x7E,
+    0x6B, 0x51, 0x61, 0x98, 0x7B, 0xE4, 0x8A, 0x86, 0x53, 0xAC, 0xB2, 0xC7, 0x50, 0x25, 0x9F, 0x7D,
+    0x96, 0xE2, 0x7B, 0x2C, 0xEA, 0x78, 0xBD, 0x48, 0xA6, 0xC6, 0x55, 0x1A, 0x41, 0x92, 0x23, 0x4B,
+    0xF2, 0x0D, 0xEC, 0x8A, 0xA4, 0x9E, 0xF5, 0x66, 0x33, 0x85, 0x5D, 0xD2, 0xC8, 0x22, 0x45, 0x8A,
+    0xD4, 0x43, 0x92, 0x46, 0x8A, 0x24, 0xC7, 0x22, 0xA9, 0x9B, 0x5F, 0x84, 0x8F, 0xB1, 0xA5, 0xA1,
+    0x2B, 0x1B, 0xB9, 0x1B, 0x1B, 0xD8, 0x1B, 0x4F, 0x63, 0x56, 0x00, 0x58, 0x7B, 0x00, 0xF6, 0x81,
+    0xD5, 0xAF, 0xA1, 0xD8, 0xAA, 0xB0, 0xDA, 0xE2, 0x8A, 0x42, 0x1A, 0xCF, 0x69, 0x57, 0x4C, 0x43,
+    0xF5, 0x59, 0x2C, 0xC3, 0xE9, 0xB3, 0x98, 0xC7, 0xD3, 0xE7, 0x0E, 0xD9, 0xE2, 0xF7, 0x1E, 0xB9,
+    0x32, 0x15, 0x83, 0xC2, 0x6E, 0x79, 0xAD, 0xDE, 0x23, 0x37, 0xBE, 0xD5, 0x32, 0x00, 0x8D, 0x7C,
+    0xEC, 0xD2, 0xD0, 0xE8, 0x69, 0x63, 0x90, 0x97, 0x0B, 0x49, 0xAE, 0x71, 0xC7, 0x97, 0xDE, 0xB8,
+    0xA6, 0x67, 0xAE, 0x38, 0x48, 0x8A, 0x5B, 0x47, 0x92, 0x2B, 0x62, 0x55, 0x23, 0x1C, 0x8A, 0x6B,
+    0xCC, 0x92, 0x3B, 0x42, 0x96, 0x0C, 0x7E, 0x97, 0x14, 0x39, 0x24, 0x39, 0x9A, 0x8B, 0x14, 0x49,
+    0xE2, 0x94, 0xA4, 0x80, 0x24, 0x79, 0x36, 0x49, 0x9E, 0x22, 0x69, 0x7A, 0xCA, 0x2C, 0xB9, 0x12,
+    0x36, 0xC9, 0x9E, 0xB6, 0x48, 0xB6, 0x1A, 0x66, 0x8D, 0x28, 0x6E, 0x1A, 0x90, 0x2D, 0xED, 0xF5,
+    0xB3, 0x21, 0x29, 0xE6, 0xBE, 0xBD, 0x5E, 0xEE, 0x90, 0x3D, 0x5A, 0x18, 0x1B, 0xE6, 0x46, 0xDC,
+    0x5B, 0x7A, 0xF2, 0xB9, 0x45, 0x71, 0x8B, 0xD3, 0x16, 0x89, 0xA4, 0xC6, 0x65, 0x1B, 0xEC, 0xB8,
+    0x72, 0x7B, 0x50, 0x77, 0x0F, 0x86, 0x06, 0x99, 0x4B, 0xC7, 0x32, 0x9E, 0x1A, 0xCF, 0x0B, 0xCF,
+    0x48, 0x2D, 0x28, 0x07, 0x34, 0x01, 0x64, 0x00, 0xDE, 0xE6, 0xE6, 0xC3, 0xEC, 0x77, 0x51, 0xD1,
+    0x02, 0xE4, 0xDA, 0xCC, 0x55, 0x17, 0x71, 0x57, 0x6B, 0xE9, 0x98, 0x49, 0x22, 0x85, 0x4D, 0x3E,
+    0x4F, 0xBB, 0xDC, 0x61, 0x8B, 0x86, 0xDA, 0x66, 0xC0, 0xF2, 0x42, 0xCB, 0x78, 0x6A, 0x3C, 0x7B,
+    0x92, 0x61, 0x8E, 0xF5, 0x2B, 0xAD, 0xA2, 0xC8, 0x3D, 0x70, 0x68, 0x82, 0x53, 0xFA, 0xDA, 0x5F,
+    0x7F, 0x2E, 0x16, 0xDD, 0xA1, 0xDF, 0x90, 0x13, 0xEC, 0x21, 0x9F, 0x15, 0x53, 0xCB, 0x69, 0x2D,
+    0x53, 0x85, 0xAD, 0x7D, 0x1B, 0x4F, 0xB9, 0xBD, 0x05, 0x45, 0xCF, 0x6C, 0xEA, 0x65, 0xC3, 0x17,
+    0x9B, 0xC3, 0xD6, 0x9A, 0x5B, 0xC2, 0x7B, 0x71, 0xAC, 0x17, 0x9B, 0x1B, 0x34, 0xB4, 0xB1, 0xB8,
+    0x1B, 0xAB, 0xD9, 0xFE, 0x6A, 0xBE, 0x3A, 0x0F, 0xB7, 0x57, 0xC5, 0xB5, 0x35, 0xDB, 0x22, 0xC7,
+    0xF3, 0x3E, 0x7A, 0xE5, 0x6D, 0x60, 0x36, 0xED, 0xF3, 0x5A, 0xCB, 0x26, 0x96, 0xE1, 0x94, 0x3B,
+    0x14, 0xB6, 0xF6, 0xDA, 0x69, 0xBF, 0x1B, 0xE3, 0x8A, 0xEF, 0xD6, 0xDA, 0x36, 0x73, 0xDA, 0x15,
+    0xB6, 0x9E, 0x0B, 0x3A, 0x7F, 0x73, 0xC7, 0xB8, 0x5E, 0xAD, 0xCF, 0x75, 0xDC, 0x7E, 0x63, 0xC7,
+    0x7C, 0xD7, 0x31, 0x6C, 0x1D, 0x69, 0xE0, 0xB6, 0x0C, 0xC6, 0xEB, 0xF3, 0xED, 0xEB, 0x73, 0xBD,
+    0x3E, 0xB3, 0x9E, 0x8F, 0x7E, 0x99, 0xAA, 0xAB, 0x52, 0xBB, 0xC4, 0x81, 0xB8, 0xB6, 0x4F, 0x9F,
+    0xE5, 0x40, 0x1A, 0x21, 0xC9, 0x40, 0x96, 0xE0, 0x90, 0x5E, 0x7E, 0xF0, 0x6B, 0x77, 0xFA, 0x89,
+    0xA4, 0x11, 0x1E, 0xCA, 0x40, 0x95, 0x80, 0xAD, 0x91, 0xEF, 0x69, 0x1F, 0x58, 0xC6, 0xA2, 0x98,
+    0x0D, 0x72, 0x17, 0xCA, 0x84, 0xAD, 0x67, 0x99, 0xF6, 0x8E, 0xD5, 0x9E, 0xF7, 0x5A, 0xAD, 0xBA,
+    0xB7, 0x22, 0x20, 0x40, 0xD6, 0x04, 0x0F, 0xAF, 0xAC, 0x10, 0xD6, 0x8E, 0x59, 0x6A, 0xCB, 0xBE,
+    0xD5, 0x84, 0xD7, 0xD2, 0xD5, 0x91, 0x5A, 0x1E, 0x3E, 0xAE, 0xA4, 0x3D, 0x8F, 0xA5, 0x4D, 0x9D,
+    0xBF, 0xD7, 0x55, 0xEE, 0xCF, 0x0A, 0x5B, 0x07, 0x68, 0x3C, 0x5B, 0xFD, 0xC6, 0x6A, 0x80, 0xCD,
+    0x16, 0xF9, 0xEC, 0xE8, 0x48, 0xA6, 0x2A, 0x64, 0x77, 0x28, 0x6C, 0x86, 0xB6, 0xA3, 0x3E, 0xFB,
+    0x2C, 0xD2, 0x40, 0x33, 0x2D, 0x5B, 0xC8, 0x1D, 0x4B, 0x28, 0x63, 0x95, 0x03, 0x96, 0xB8, 0xF6,
+    0xB7, 0x21, 0xA0, 0xED, 0x15, 0x1F, 0xC9, 0x1D, 0x77, 0x73, 0xBE, 0x30, 0xC0, 0x5E, 0xB3, 0x69,
+    0xD6, 0x1D, 0x4F, 0x49, 0x53, 0x96, 0xAE, 0xD9, 0xB1, 0xCA, 0xC1, 0xAE, 0x78, 0x55, 0xEB, 0xD9,
+    0x16, 0x43, 0xF2, 0x9B, 0xE1, 0x15, 0x16, 0x7B, 0x8E, 0xA7, 0xFC, 0xEE, 0xB3, 0x48, 0x24, 0xCB,
+    0x50, 0x3B, 0xF6, 0xF6, 0x72, 0x28, 0x06, 0x58, 0x2C, 0x3C, 0xBC, 0x62, 0xFC, 0x1E, 0x55, 0xB2,
+    0xB0, 0xCB, 0xDC, 0x32, 0x78, 0xD6, 0x6F, 0xCF, 0x53, 0x95, 0xD4, 0xB5, 0x48, 0xDD, 0x6F, 0xA5,
+    0x67, 0xDB, 0xE9, 0xB0, 0xB5, 0x52, 0xD3, 0xC1, 0xA9, 0xF1, 0xE6, 0xE6, 0x49, 0x52, 0xC8, 0xCD,
+    0xA2, 0xB7, 0xFA, 0x14, 0x49, 0x23, 0xF3, 0xEF, 0xC9, 0xB1, 0xD8, 0x1B, 0x75, 0x4B, 0x02, 0x16,
+    0x39, 0xEA, 0x5D, 0xA6, 0xBE, 0x5D, 0xA6, 0x4A, 0x81, 0x59, 0x1D, 0x73, 0x07, 0xA5, 0x91, 0x65,
+    0x48, 0xF2, 0xB9, 0x07, 0x8A, 0x6C, 0xE9, 0xD8, 0x1D, 0xF3, 0x50, 0xC5, 0x26, 0xB6, 0x9E, 0x39,
+    0x64, 0xB9, 0xA2, 0x98, 0xFC, 0x2E, 0x83, 0x7C, 0x76, 0x45, 0x22, 0xD9, 0xF3, 0x41, 0x95, 0x7C,
+    0x1E, 0xE0, 0xA2, 0xFE, 0xCD, 0x17, 0x1B, 0x1F, 0x11, 0xC9, 0x7F, 0x16, 0x0F, 0x29, 0x6C, 0x0D,
+    0x42, 0xA7, 0x7D, 0xA8, 0x1D, 0x8B, 0x6C, 0x69, 0x23, 0x8E, 0x88, 0xD4, 0x12, 0xB8, 0xCF, 0x86,
+    0xC5, 0x90, 0xDC, 0xA1, 0xB8, 0x0F, 0xAC, 0xC3, 0x29, 0x0B, 0x6C, 0x3D, 0x73, 0xD7, 0x74, 0x92,
+    0x24, 0x07, 0x5B, 0xAB, 0x04, 0x6E, 0xA1, 0xF0, 0xE5, 0x16, 0x19, 0x8F, 0x1A, 0x95, 0xA0, 0x48,
+    0xF1, 0xA6, 0xC6, 0xEC, 0x1A, 0x58, 0x7D, 0xD6, 0x88, 0x7C, 0x96, 0x3D, 0xE5, 0xF3, 0x95, 0xC7,
+    0x6D, 0x51, 0x5C, 0x65, 0x4F, 0x91, 0x34, 0x32, 0xB7, 0xE0, 0x61, 0x51, 0xD7, 0xEA, 0xED, 0x08,
+    0xB3, 0x3A, 0x40, 0x32, 0xBC, 0x8D, 0x64, 0x19, 0xAA, 0x34, 0x95, 0xF1, 0x94, 0xC2, 0x6E, 0x8B,
+    0xC4, 0x66, 0x8B, 0x0C, 0xC9, 0x16, 0x8D, 0x0D, 0x31, 0xAA, 0xA6, 0x5D, 0xBE, 0xF9, 0xBC, 0xDE,
+    0x92, 0x34, 0x55, 0x9B, 0x0D, 0x35, 0x2E, 0x1E, 0x4E, 0xC3, 0x3F, 0x93, 0xDD, 0x69, 0x48, 0xAC,
+    0x43, 0x35, 0xC8, 0x1D, 0xEE, 0x50, 0x58, 0xE3, 0xDA, 0x61, 0xD0, 0x58, 0x6C, 0x91, 0xDF, 0x7C,
+    0xEE, 0x98, 0x49, 0xB6, 0x18, 0x96, 0x98, 0x47, 0x1E, 0x93, 0x2C, 0x54, 0x4D, 0xFC, 0xCB, 0xAE,
+    0xE9, 0x9C, 0x92, 0x5E, 0x7A, 0xB6, 0x87, 0xF7, 0x58, 0x34, 0x80, 0xBA, 0x4B, 0x38, 0xCA, 0x1D,
+    0xF5, 0xA1, 0x2C, 0xB3, 0xD4, 0xF4, 0x05, 0x49, 0x3E, 0xC7, 0x45, 0x7C, 0x8B, 0x34, 0x54, 0x48,
+    0x9E, 0xC7, 0xCC, 0x1C, 0xB6, 0x1A, 0x16, 0x77, 0xB8, 0xA2, 0xB0, 0x85, 0xDC, 0xF1, 0x0D, 0x96,
+    0xE1, 0x1C, 0xAB, 0xA6, 0xDD, 0xED, 0x22, 0x85, 0x6D, 0xA8, 0x22, 0xF9, 0x6C, 0xF8, 0x05, 0x8B,
+    0x81, 0xA2, 0x01, 0x92, 0x06, 0xF6, 0x3B, 0x7B, 0x7F, 0x71, 0x96, 0x02, 0xAB, 0x7C, 0x73, 0xF1,
+    0xD2, 0xB3, 0xC6, 0x2D, 0x64, 0x53, 0xED, 0xA9, 0xB0, 0x92, 0x5C, 0x71, 0xC0, 0xAB, 0xC0, 0xEC,
+    0xA1, 0x18, 0xEE, 0xC7, 0xEC, 0x73, 0xCF, 0x6B, 0xC8, 0x1D, 0xD3, 0xDE, 0x33, 0xB3, 0x86, 0x3C,
+    0xB6, 0xB5, 0xB1, 0x28, 0xB0, 0x4A, 0x2F, 0x49, 0xEA, 0xBE, 0xDA, 0x58, 0x81, 0x6D, 0x3E, 0x7C,
+    0xE8, 0x6F, 0x46, 0xAE, 0x24, 0x16, 0xB2, 0xBA, 0x78, 0x68, 0xA4, 0xC8, 0x53, 0x14, 0xD8, 0xE5,
+    0x79, 0xA8, 0xA9, 0x4A, 0xF6, 0x6C, 0x10, 0xAA, 0xF8, 0xC9, 0xD7, 0x93, 0x6B, 0x58, 0x58, 0xE4,
+    0xD8, 0xA5, 0x97, 0x25, 0xBD, 0xF4, 0x65, 0xC9, 0x72, 0xB6, 0xE4, 0x38, 0xC2, 0xA6, 0xDF, 0x7F,
+    0xC4, 0x2D, 0x80, 0x48, 0x57, 0xD4, 0x87, 0xB5, 0xE7, 0x0F, 0x6A, 0x4F, 0x0D, 0x5B, 0xE4, 0x69,
+    0x75, 0x3C, 0xE6, 0x43, 0x92, 0x3F, 0x7D, 0x16, 0x3F, 0xAD, 0xB2, 0x25, 0xAE, 0xE2, 0x07, 0x45,
+    0xEE, 0x20, 0xF5, 0xBC, 0x5E, 0xE4, 0x33, 0x69, 0xAC, 0x63, 0xED, 0x48, 0xE1, 0xB3, 0xB8, 0x1B,
+    0xA8, 0xB2, 0xB0, 0x68, 0xE2, 0xA1, 0xAE, 0x9D, 0xFA, 0xAA, 0x34, 0x50, 0x34, 0x42, 0xB2, 0x50,
+    0x46, 0x5E, 0xC3, 0xA0, 0xF8, 0x3E, 0xB3, 0xCF, 0xA4, 0xE9, 0x08, 0x9F, 0x51, 0x26, 0x38, 0x2D,
+    0x1C, 0x86, 0xCF, 0x1E, 0x8A, 0xD4, 0xF2, 0xC0, 0x58, 0xF5, 0x52, 0xC7, 0x27, 0x5F, 0x9F, 0x3D,
+    0xAC, 0xA6, 0x89, 0x23, 0x5B, 0x5B, 0xCE, 0x57, 0xAF, 0x2D, 0x70, 0x55, 0x63, 0x51, 0x28, 0x1D,
+    0x45, 0xA4, 0x89, 0xE4, 0xD8, 0xEC, 0x31, 0xB2, 0xEB, 0x01, 0x1D, 0xAF, 0xF0, 0x73, 0xC9, 0xE7,
+    0x29, 0xFB, 0x5D, 0xEA, 0x79, 0x95, 0x4B, 0x3A, 0x6B, 0x95, 0x54, 0xC7, 0x25, 0x29, 0x4D, 0x8D,
+    0x4E, 0xAA, 0xBF, 0x51, 0x15, 0xDF, 0xD8, 0x9F, 0x86, 0x6A, 0x8F, 0xE9, 0x92, 0xDE, 0x5E, 0x61,
+    0x96, 0xA6, 0xC3, 0xED, 0xAE, 0xA8, 0x7B, 0x44, 0x8F, 0xF8, 0x4C, 0x13, 0xAB, 0xCF, 0x23, 0xD9,
+    0xB0, 0x9B, 0x2A, 0x8F, 0xC2, 0xA1, 0xB0, 0x2A, 0xE6, 0xAE, 0xA5, 0x9A, 0x2F, 0x48, 0x2F, 0x7D,
+    0x5B, 0x3D, 0xAC, 0x03, 0x1C, 0x06, 0xCE, 0xFE, 0x23, 0x57, 0x5B, 0xEE, 0x19, 0xAA, 0xE4, 0x8A,
+    0x02, 0x59, 0x91, 0x59, 0xB0, 0xEA, 0x7E, 0xE3, 0x88, 0xED, 0xCF, 0x1F, 0x7F, 0xF2, 0x0E, 0x7B,
+    0x68, 0x8A, 0xE0, 0x12, 0x78, 0x22, 0xDD, 0xD7, 0x1D, 0x28, 0xC6, 0xD5, 0x6F, 0x86, 0x8E, 0xD9,
+    0x96, 0xF1, 0x54, 0xB8, 0x85, 0xCD, 0x58, 0x86, 0xDA, 0x18, 0x12, 0x29, 0xA6, 0xA1, 0x1A, 0x34,
+    0xED, 0xB6, 0x34, 0x97, 0xA6, 0x63, 0xF1, 0xC7, 0x80, 0x61, 0x73, 0x44, 0x66, 0xCF, 0xA7, 0x45,
+    0x91, 0x3F, 0xCF, 0x8A, 0xBB, 0x5F, 0xF4, 0x05, 0x49, 0xFA, 0xE2, 0xF2, 0x5B, 0x7F, 0xA5, 0x38,
+    0x87, 0xA5, 0xAB, 0xA6, 0xC8, 0xC0, 0xA6, 0x81, 0x2A, 0x75, 0x7F, 0xF7, 0x1C, 0x3B, 0x6F, 0xA3,
+    0x1E, 0x22, 0x85, 0xD5, 0xD0, 0x33, 0xBB, 0xC3, 0x16, 0x85, 0xD5, 0xE7, 0x9E, 0x8E, 0xC5, 0x96,
+    0xF1, 0x94, 0xCF, 0x53, 0xEE, 0x58, 0x48, 0xE3, 0xD9, 0x52, 0xE5, 0xD1, 0x91, 0xC2, 0x66, 0x6B,
+    0x47, 0xE2, 0x18, 0x78, 0xCC, 0x6A, 0x39, 0xD1, 0xC4, 0x87, 0x45, 0xD3, 0x69, 0xB7, 0xE7, 0xE3,
+    0xDA, 0x67, 0xC3, 0x62, 0x8B, 0x21, 0x0D, 0xB5, 0x27, 0x75, 0xBC, 0x42, 0x52, 0x4C, 0xAC, 0xF2,
+    0x99, 0x55, 0xF6, 0x64, 0xBB, 0xAB, 0x15, 0xB3, 0x04, 0x45, 0xF2, 0x4F, 0x99, 0x65, 0x8F, 0x90,
+    0x35, 0x9C, 0xF6, 0x54, 0xCF, 0xAB, 0x24, 0x91, 0x7C, 0x96, 0xCF, 0x63, 0x95, 0x3B, 0x3A, 0xD2,
+    0x70, 0x36, 0xE1, 0x45, 0xD2, 0x33, 0xEC, 0xDF, 0x1B, 0x61, 0xB4, 0xF5, 0x5D, 0x64, 0xAA, 0x48,
+    0x1D, 0x73, 0xD8, 0x14, 0x93, 0xDB, 0xE5, 0xF3, 0x58, 0x64, 0x77, 0x83, 0x86, 0x22, 0x52, 0x8F,
+    0xC2, 0x26, 0x96, 0x69, 0x57, 0x58, 0xC7, 0xA6, 0x72, 0x1B, 0x0E, 0xB1, 0x50, 0x14, 0x36, 0x7F,
+    0x6A, 0xDA, 0xED, 0xF9, 0xBC, 0x80, 0xD2, 0x44, 0x94, 0x24, 0x4A, 0xD3, 0x4F, 0x92, 0x23, 0x19,
+    0x4A, 0x4F, 0x51, 0x64, 0x99, 0x58, 0x2D, 0xBB, 0xE1, 0xEC, 0x2B, 0xF2, 0x8F, 0x57, 0xFF, 0x38,
+    0x0F, 0xE7, 0x39, 0x7E, 0x5A, 0x15, 0x7F, 0xB0, 0xE1, 0x57, 0x7B, 0xD4, 0xE9, 0xC7, 0xA7, 0x78,
+    0xFD, 0xC3, 0x12, 0x92, 0xCD, 0x35, 0x7E, 0xA9, 0x74, 0x58, 0x32, 0xCB, 0x94, 0x39, 0xED, 0x6E,
+    0xAA, 0xE5, 0x3D, 0xE4, 0x57, 0xF6, 0x29, 0x0F, 0xC5, 0x62, 0x50, 0x48, 0x71, 0xF5, 0xDB, 0x6D,
+    0x8D, 0xC9, 0x16, 0x91, 0x6C, 0xE9, 0x5A, 0xB5, 0x3C, 0x4F, 0xBB, 0x69, 0xC5, 0xB3, 0x7C, 0x36,
+    0xDC, 0x0F, 0x79, 0xB8, 0x29, 0xF1, 0xAB, 0x05, 0x92, 0xAD, 0xEF, 0x90, 0xDC, 0x21, 0xD2, 0x74,
+    0x74, 0x2C, 0xD3, 0xDE, 0x37, 0x54, 0x6A, 0xCF, 0x84, 0x6D, 0xA8, 0x8A, 0xEB, 0x78, 0x4A, 0xFA,
+    0xC3, 0x59, 0x9A, 0xD8, 0x1A, 0xE7, 0xF2, 0x90, 0x7B, 0x7E, 0xC2, 0xEA, 0x4A, 0xCF, 0xC2, 0x76,
+    0x51, 0x12, 0x57, 0x14, 0x72, 0xDC, 0x3A, 0xDE, 0x66, 0x1E, 0xAB, 0x2D, 0x77, 0x4C, 0x61, 0x1D,
+    0x6B, 0xCF, 0x12, 0xB2, 0xE1, 0x5D, 0x96, 0x11, 0x8E, 0x96, 0x35, 0x06, 0x3E, 0xBA, 0xE9, 0x13,
+    0x7A, 0x4B, 0xA6, 0x4C, 0x55, 0xF6, 0x97, 0x9C, 0x0A, 0x8F, 0x28, 0x3D, 0x4F, 0x62, 0x1E, 0x99,
+    0x49, 0xFE, 0xE8, 0x1B, 0x64, 0x0E, 0x5C, 0xBE, 0xBE, 0x90, 0x86, 0xF3, 0xBF, 0xF5, 0xCA, 0x4B,
+    0x41, 0x93, 0xEE, 0xCD, 0xEA, 0xCB, 0x54, 0x25, 0x7C, 0x53, 0x48, 0x8A, 0x1C, 0x7F, 0xC9, 0x32,
+    0x32, 0xB3, 0xF5, 0x2C, 0x37, 0xFA, 0xE7, 0xB7, 0x8E, 0xE4, 0x76, 0x85, 0x6D, 0x2C, 0x9A, 0x76,
+    0xF3, 0x79, 0xF9, 0xA1, 0xF6, 0xA4, 0x91, 0xA7, 0x17, 0x53, 0x13, 0x8F, 0xD8, 0x14, 0x7E, 0xC4,
+    0xAA, 0x69, 0x7F, 0xE9, 0xAA, 0x5F, 0x3F, 0x4F, 0x40, 0x3F, 0x2F, 0x15, 0x48, 0x7F, 0x34, 0x6B,
+    0xA4, 0xCA, 0x53, 0x05, 0xC5, 0xF0, 0xF3, 0xEF, 0x0E, 0xCC, 0xB2, 0xA7, 0x6E, 0x67, 0x07, 0x6A,
+    0xE2, 0xCF, 0x8B, 0x7F, 0xD3, 0xA1, 0xD9, 0xF1, 0x28, 0x5D, 0x20, 0x91, 0x14, 0x99, 0xAF, 0x0A,
+    0xFA, 0x2D, 0xDD, 0x9B, 0xE5, 0xDF, 0x67, 0x6D, 0xD6, 0x2B, 0x13, 0xEB, 0xF0, 0x19, 0x34, 0x13,
+    0xC2, 0xCF, 0x50, 0xDC, 0x2D, 0x0B, 0xC9, 0x1F, 0x86, 0x34, 0x65, 0x5B, 0xC4, 0x6A, 0x5B, 0xE2,
+    0xB8, 0xEC, 0xA6, 0x16, 0xB8, 0x0A, 0x9B, 0xCF, 0xCF, 0xCC, 0xDA, 0x2C, 0xD8, 0xD8, 0xA7, 0xDB,
+    0xEF, 0xFA, 0xAC, 0x57, 0x1F, 0x77, 0xD7, 0x27, 0x6C, 0xCF, 0x4E, 0x24, 0x48, 0x5D, 0xA3, 0xFE,
+    0xA7, 0xC6, 0xA2, 0x90, 0x35, 0xED, 0x86, 0x59, 0x61, 0xB5, 0x45, 0x1D, 0x73, 0x5C, 0x65, 0xAA,
+    0x41, 0xB2, 0xC7, 0xA5, 0x71, 0x2D, 0x52, 0xFC, 0x7E, 0x91, 0x7A, 0xFC, 0x26, 0x0D, 0x67, 0x53,
+    0xF4, 0x0F, 0x49, 0xBE, 0x69, 0xE7, 0x55, 0x92, 0x21, 0x37, 0xBA, 0x77, 0x13, 0xE2, 0x5B, 0x3D,
+    0x30, 0xB4, 0xCA, 0x79, 0x97, 0x34, 0xB4, 0x33, 0xBB, 0x22, 0xC9, 0xB3, 0xDE, 0x6A, 0xEB, 0xA6,
+    0xDC, 0xE8, 0x52, 0x5B, 0xAE, 0xE2, 0xB3, 0x85, 0xAB, 0xDF, 0x74, 0x9D, 0x25, 0x5D, 0xCA, 0x83,
+    0xCF, 0x37, 0x56, 0x7A, 0x0F, 0x8E, 0x4B, 0x99, 0x75, 0x40, 0xE9, 0x78, 0x4A, 0x3C, 0xEC, 0x69,
+    0x8F, 0x90, 0xE3, 0xE6, 0xD7, 0xF8, 0x63, 0x3A, 0x3A, 0xBE, 0x75, 0x8C, 0x65, 0xA8, 0x71, 0xF5,
+    0xD9, 0x3D, 0x45, 0x2C, 0xF1, 0x1F, 0xCB, 0x70, 0x1A, 0x7C, 0x76, 0xD9, 0x95, 0xB8, 0xC5, 0xC4,
+    0x0F, 0xF9, 0xA0, 0x5A, 0x0C, 0x8F, 0x21, 0x0F, 0x5C, 0xE7, 0x66, 0x6C, 0xEA, 0xE0, 0xB8, 0x3B,
+    0x8D, 0x62, 0x91, 0x34, 0x9C, 0xBA, 0xB1, 0xF0, 0xAB, 0x70, 0xAE, 0xCF, 0x0A, 0xE7, 0xB0, 0x3E,
+    0x13, 0x49, 0xAA, 0xFC, 0x21, 0x9F, 0x6D, 0x95, 0xE1, 0x55, 0xD2, 0x25, 0x31, 0xF0, 0x83, 0xF3,
+    0x26, 0xCB, 0x7B, 0xB6, 0x9B, 0xBE, 0xE0, 0xB8, 0x33, 0x1D, 0xCC, 0xD2, 0xC4, 0x21, 0x0D, 0x35,
+    0x26, 0x75, 0x7C, 0xAF, 0xAA, 0x45, 0xA7, 0xAD, 0x3D, 0x73, 0x4F, 0x72, 0x45, 0x31, 0x8B, 0xF5,
+    0x7F, 0x08, 0x72, 0xB2, 0x23, 0x52, 0x3C, 0x9F, 0x92, 0x23, 0xDF, 0x64, 0x89, 0xFB, 0x78, 0xEA,
+    0x0B, 0x4D, 0x44, 0x89, 0xE9, 0x5A, 0x9F, 0x3D, 0x6E, 0x3B, 0xA3, 0xF1, 0x94, 0xFF, 0x10, 0xB9,
+    0x83, 0x34, 0x9E, 0x7E, 0x33, 0xB8, 0x43, 0x7C, 0xFF, 0x54, 0xFC, 0x27, 0x66, 0xBF, 0xC7, 0x75,
+    0x3A, 0xA7, 0x1A, 0x19, 0x80, 0x04, 0x71, 0xB3, 0x3C, 0xD8, 0xF5, 0xE5, 0xB1, 0x5C, 0x71, 0x45,
+    0x6A, 0xF1, 0x36, 0xED, 0x7A, 0x3E, 0x1B, 0x93, 0x6C, 0x51, 0x5C, 0xC3, 0xD6, 0x20, 0x69, 0x6F,
+    0x60, 0x55, 0x14, 0x1A, 0x21, 0x9D, 0x6E, 0xDC, 0x53, 0x31, 0x5D, 0x7D, 0xA6, 0xBB, 0x3E, 0xB1,
+    0xF5, 0xF1, 0xB9, 0xBF, 0xFA, 0x90, 0xC2, 0x36, 0xA2, 0x90, 0xDD, 0x61, 0x58, 0xFC, 0x31, 0x54,
+    0x43, 0xF6, 0xB5, 0xE3, 0x17, 0x34, 0x74, 0xFD, 0x0F, 0x08, 0x69, 0x64, 0xF7, 0x0D, 0x62, 0x07,
+    0x5E, 0x3B, 0xD4, 0xCD, 0x0D, 0x67, 0xFF, 0x17, 0x26, 0x54, 0xDA, 0x84, 0xB8, 0x26, 0x54, 0xDA,
+    0x84, 0x18, 0xD9, 0x7D, 0xDB, 0x80, 0x81, 0x39, 0xAE, 0xDD, 0x7C, 0xDB, 0x85, 0x3B, 0xC5, 0xED,
+    0x16, 0xBC, 0x57, 0x7D, 0xD1, 0xF6, 0x43, 0xB0, 0x6A, 0x80, 0x4B, 0xB1, 0xFA, 0x5A, 0x7C, 0xA1,
+    0x5C, 0xF4, 0x4F, 0xEB, 0xAC, 0x5B, 0xD1, 0xB5, 0xB8, 0xFA, 0x08, 0xC5, 0x75, 0x3C, 0x0D, 0x4D,
+    0xC3, 0x89, 0x2D, 0x47, 0xC4, 0xED, 0xEB, 0xA5, 0xBB, 0xB4, 0x8B, 0xA2, 0xAE, 0x9D, 0x74, 0x3D,
+    0x07, 0xFA, 0x92, 0x2D, 0xA6, 0x4A, 0x4D, 0xE8, 0x91, 0x3D, 0xC6, 0x53, 0x97, 0x28, 0xD4, 0x7C,
+    0x4A, 0x86, 0x8E, 0xC7, 0x1F, 0xC9, 0xE7, 0x09, 0xF2, 0x50, 0x7B, 0x20, 0x85, 0xD5, 0xD7, 0x78,
+    0x8E, 0xC5, 0xA0, 0xB8, 0x35, 0xEE, 0x6E, 0xCB, 0x50, 0x15, 0x7E, 0xC8, 0x12, 0x36, 0x5B, 0xA6,
+    0xDD, 0xF0, 0x2A, 0x1F, 0x20, 0xDF, 0x4E, 0x52, 0xE1, 0x34, 0x55, 0x3D, 0x55, 0x61, 0xBB, 0x91,
+    0xF9, 0x5B, 0x98, 0xF9, 0xAD, 0xC5, 0xD8, 0x78, 0x3E, 0xEF, 0x48, 0x4F, 0xAB, 0x26, 0xD8, 0x47,
+    0xE0, 0x35, 0xDE, 0x61, 0x23, 0xB9, 0x12, 0x2E, 0x97, 0xFC, 0x5E, 0x55, 0xD8, 0x58, 0xC3, 0xEE,
+    0x1B, 0xC3, 0x3B, 0x9E, 0x91, 0xD4, 0x97, 0xDF, 0xD0, 0xEF, 0x70, 0x28, 0x50, 0x04, 0x47, 0xFF,
+    0x17, 0x64, 0x89, 0x55, 0x1D, 0x8B, 0x86, 0xAA, 0xD6, 0x7D, 0x73, 0x30, 0x7F, 0xED, 0x51, 0x3B,
+    0xB8, 0xE9, 0x59, 0xE4, 0x8A, 0x7B, 0x97, 0x2D, 0x40, 0x07, 0xB9, 0xE7, 0xD4, 0xCD, 0x5F, 0xBE,
+    0x38, 0xCB, 0x20, 0xC7, 0xD6, 0x2A, 0xCC, 0xAC, 0xB0, 0x4D, 0xB0, 0x75, 0xBC, 0xC2, 0xCF, 0x49,
+    0x63, 0xB1, 0x67, 0xC7, 0xE2, 0xB3, 0xCF, 0xA6, 0x8A, 0x9F, 0x30, 0xDB, 0x32, 0x40, 0xB9, 0x4C,
+    0x25, 0x16, 0x60, 0x19, 0xAA, 0xE1, 0xDD, 0xAA, 0x69, 0xB7, 0x47, 0x03, 0xCA, 0xCD, 0x6F, 0x43,
+    0xED, 0x99, 0x49, 0x3E, 0xDB, 0xD2, 0xF3, 0x0B, 0x16, 0x9F, 0x0D, 0x94, 0x8E, 0x65, 0x80, 0x34,
+    0x9C, 0xEA, 0x9B, 0x7A, 0xF7, 0xCC, 0x50, 0x5D, 0x04, 0xDD, 0xEA, 0x96, 0x53, 0xE1, 0xC9, 0x83,
+    0xA2, 0xB8, 0x5D, 0x3C, 0x43, 0xAD, 0x78, 0xCD, 0xD3, 0x75, 0x30, 0x6C, 0x21, 0xB7, 0x7A, 0xC3,
+    0x9D, 0x71, 0x53, 0xC8, 0x71, 0x15, 0x2B, 0xC9, 0xB0, 0x90, 0x46, 0x3A, 0x16, 0x57, 0x7A, 0x66,
+    0xBF, 0xF7, 0x48, 0x63, 0xFA, 0xAE, 0xC6, 0x23, 0x2C, 0x7D, 0x9D, 0x36, 0xC5, 0x2F, 0xED, 0xBA,
+    0x37, 0xBF, 0x75, 0x15, 0x7A, 0x0F, 0xA5, 0x40, 0x52, 0x6C, 0xFF, 0x45, 0x91, 0xE2, 0xEE, 0xB3,
+    0xCF, 0x63, 0x99, 0x76, 0x83, 0x2D, 0x3D, 0x7F, 0xC6, 0x23, 0xDE, 0xBF, 0xD4, 0xA3, 0xC5, 0xF3,
+    0x1D, 0x35, 0x67, 0x99, 0xA5, 0xB8, 0xE9, 0x0D, 0xC7, 0x9B, 0xBB, 0x81, 0x53, 0x1E, 0xE6, 0x9E,
+    0x2A, 0x75, 0x6F, 0x48, 0xFF, 0x09, 0xD5, 0xBD, 0x4F, 0xAC, 0x27, 0xD7, 0x75, 0x26, 0xF6, 0x55,
+    0x5D, 0x76, 0x97, 0xDC, 0x85, 0xD1, 0xE5, 0x82, 0xB4, 0xE5, 0x56, 0xAC, 0xD2, 0x22, 0x8B, 0x19,
+    0x0E, 0xA2, 0xDA, 0xCC, 0xC2, 0x0B, 0x92, 0xB7, 0x48, 0x2E, 0xB8, 0x20, 0x10, 0xBE, 0x20, 0xFD,
+    0x3C, 0x70, 0xBC, 0xA0, 0x91, 0xC8, 0x80, 0x45, 0x27, 0xD3, 0x5E, 0xCC, 0xC2, 0xC6, 0xB4, 0x58,
+    0x25, 0x72, 0x21, 0x20, 0x04, 0xA2, 0x67, 0x8C, 0x26, 0xB3, 0xF0, 0x42, 0x04, 0x42, 0x23, 0xE4,
+    0x23, 0x90, 0x76, 0x02, 0x01, 0xD1, 0x0C, 0xC8, 0xBE, 0xB7, 0xD9, 0x08, 0x1A, 0x09, 0x17, 0x2C,
+    0xA9, 0xA3, 0x31, 0x10, 0x2E, 0x58, 0x12, 0x29, 0x33, 0x22, 0x27, 0xE9, 0x4B, 0xF3, 0x52, 0xAC,
+    0xEE, 0xBE, 0xF7, 0x7E, 0x59, 0x9C, 0x5B, 0xBF, 0xF7, 0x5E, 0x77, 0x4B, 0x96, 0xED, 0xC8, 0xE2,
+    0xFC, 0x80, 0xF7, 0xBA, 0xDF, 0xEF, 0x5F, 0x55, 0x9D, 0x3A, 0xF7, 0xDE, 0x73, 0xBE, 0xF3, 0x9D,
+    0xEF, 0x02, 0x40, 0x3F, 0x57, 0x74, 0x9A, 0x30, 0x2B, 0x46, 0x87, 0x7B, 0x21, 0x8F, 0x8C, 0x66,
+    0x45, 0xBF, 0x80, 0x83, 0x8A, 0xE8, 0x3C, 0xAC, 0x53, 0x19, 0x7A, 0xC5, 0x38, 0x2B, 0x42, 0x47,
+    0x8C, 0xBE, 0xE6, 0xA4, 0x33, 0x4C, 0xC0, 0xEE, 0xD1, 0x0F, 0x80, 0x01, 0x30, 0xEE, 0xA1, 0x63,
+    0xC2, 0xC8, 0x58, 0x91, 0x51, 0xF1, 0xFB, 0xDF, 0xD6, 0x04, 0x74, 0x04, 0xFA, 0x15, 0x30, 0xBE,
+    0xFC, 0x2C, 0xC0, 0xB8, 0xFD, 0x78, 0xC0, 0x84, 0xCA, 0x19, 0xD2, 0x75, 0xA4, 0x6B, 0x48, 0x07,
+    0x9B, 0xCB, 0xD7, 0x01, 0xB8, 0x04, 0xE0, 0xBE, 0xA3, 0x23, 0x75, 0x3C, 0x00, 0x34, 0xE9, 0xA0,
+    0xC8, 0x15, 0x18, 0x49, 0x40, 0xE7, 0xEA, 0x05, 0x54, 0x74, 0x00, 0xFA, 0x00, 0xA0, 0x26, 0x20,
+    0x87, 0x82, 0x22, 0x80, 0xB3, 0xF6, 0xE6, 0x8B, 0xA8, 0x49, 0x0E, 0x30, 0xA4, 0x87, 0x22, 0x09,
+    0x80, 0x0E, 0x40, 0xB7, 0x02, 0xA8, 0x39, 0x6C, 0x1F, 0xD0, 0x11, 0x40, 0xC3, 0x01, 0xA8, 0x49,
+    0x66, 0xF4, 0x24, 0x67, 0x45, 0x32, 0xC1, 0x90, 0x74, 0x00, 0x80, 0xDA, 0xE1, 0xB3, 0x75, 0xE6,
+    0x75, 0x6F, 0xC9, 0xB5, 0x25, 0xD7, 0x8A, 0x8F, 0x27, 0x58, 0x98, 0xC9, 0x4C, 0x8D, 0xD7, 0x4B,
+    0x15, 0x55, 0x84, 0xC5, 0x38, 0x8D, 0x93, 0xCE, 0x9C, 0x35, 0x19, 0x35, 0x49, 0xB7, 0x3E, 0xFD,
+    0x84, 0xFB, 0x0C, 0x30, 0xB5, 0x11, 0x4D, 0x6E, 0x12, 0x74, 0x54, 0x09, 0x7D, 0x50, 0x19, 0xC6,
+    0xD7, 0x04, 0x5D, 0xC5, 0x8A, 0x03, 0xF8, 0x58, 0x06, 0xF8, 0x44, 0x04, 0xEC, 0xB7, 0x02, 0x30,
+    0x72, 0x01, 0x0C, 0x1D, 0x60, 0x38, 0xE0, 0x8C, 0xE5, 0x4B, 0xD0, 0x64, 0x44, 0x47, 0xAE, 0x38,
+    0x75, 0xFE, 0xE3, 0x3D, 0xA0, 0xF7, 0xC0, 0x59, 0x7B, 0xF3, 0x40, 0xAE, 0x6F, 0x24, 0x17, 0xDC,
+    0x6F, 0x7F, 0x34, 0x00, 0xD6, 0x6D, 0x17, 0xCA, 0x09, 0x80, 0x3D, 0xFE, 0x10, 0x8B, 0x3E, 0x7D,
+    0xFC, 0xA9, 0xA7, 0x81, 0xFB, 0xF7, 0x50, 0x91, 0x53, 0x4D, 0x86, 0x8A, 0x1F, 0x44, 0x58, 0x77,
+    0x06, 0x66, 0x16, 0xC3, 0x54, 0x5C, 0x80, 0x9E, 0x13, 0x3A, 0x46, 0x74, 0xB7, 0x38, 0x69, 0x6F,
+    0x7C, 0xB3, 0xAA, 0x58, 0x27, 0x10, 0xA3, 0x33, 0x4E, 0x27, 0x33, 0xD7, 0xE4, 0x8C, 0x8E, 0x33,
+    0x60, 0x23, 0xA0, 0x38, 0x40, 0xBE, 0x20, 0xB4, 0x43, 0x1B, 0x6B, 0x32, 0xC3, 0x32, 0xA3, 0x65,
+    0x02, 0x4E, 0x0D, 0x72, 0x57, 0xBF, 0x16, 0xCD, 0x95, 0x64, 0xAE, 0x24, 0xF3, 0x6C, 0xBC, 0x67,
+    0xE7, 0x89, 0x38, 0xCD, 0x1B, 0x00, 0x1A, 0x32, 0x01, 0x75, 0xC6, 0xE7, 0x57, 0x20, 0x01, 0xED,
+    0x02, 0x83, 0x5F, 0xDD, 0xEB, 0xA7, 0xC6, 0x75, 0x9C, 0x5F, 0x43, 0x68, 0x18, 0x95, 0xEF, 0x90,
+    0x30, 0x74, 0x8F, 0x2D, 0xFD, 0x00, 0xAC, 0x0F, 0x2A, 0x0F, 0xB4, 0x57, 0xDD, 0x33, 0x00, 0x2E,
+    0x5C, 0x68, 0x66, 0xA0, 0xB9, 0xEA, 0xBE, 0x7A, 0xF4, 0xC7, 0x15, 0xF7, 0x30, 0x80, 0x57, 0x1F,
+    0x52, 0x1E, 0xD0, 0xCF, 0xFA, 0x6E, 0x02, 0x82, 0x1E, 0xF8, 0x8A, 0xEB, 0xF1, 0x6A, 0xCD, 0xD8,
+    0xCC, 0xCA, 0xD7, 0x2F, 0x57, 0x11, 0x9D, 0x03, 0x2C, 0x30, 0x1E, 0x60, 0x74, 0x80, 0x25, 0x17,
+    0x00, 0x96, 0x0B, 0x00, 0xDC, 0x5F, 0x4E, 0x72, 0xFC, 0xBA, 0x1B, 0xE9, 0xCD, 0x07, 0xB1, 0x77,
+    0x59, 0x2F, 0xE6, 0x71, 0xAF, 0x2F, 0x47, 0xE5, 0x6D, 0xBD, 0xF6, 0x2E, 0x35, 0x99, 0xB0, 0x1F,
+    0xB8, 0xD3, 0x7F, 0x72, 0x80, 0x07, 0x0E, 0x0F, 0x0F, 0xBF, 0x41, 0xF2, 0x23, 0x92, 0x91, 0xE2,
+    0x80, 0xBD, 0x03, 0x5A, 0x0F, 0xD4, 0x11, 0x80, 0xDD, 0x3D, 0xD1, 0xF3, 0x23, 0x66, 0xC3, 0xBF,
+    0x60, 0x3A, 0xF2, 0xFB, 0x9F, 0x61, 0x8B, 0x53, 0xFB, 0xE8, 0xA7, 0xC6, 0x91, 0x78, 0x0D, 0x41,
+    0x8B, 0x2D, 0x62, 0xBB, 0x74, 0x8F, 0x2D, 0xDA, 0x19, 0xAC, 0x0F, 0x22, 0x2A, 0xDF, 0x5E, 0x75,
+    0xDA, 0x3D, 0x83, 0x0B, 0x17, 0x90, 0xCE, 0xBB, 0xE6, 0xAA, 0xD3, 0xF4, 0xB8, 0x70, 0x01, 0xCC,
+    0x68, 0xAE, 0x38, 0xFD, 0xBA, 0xC7, 0xAB, 0x0F, 0x21, 0x6A, 0xA7, 0x9F, 0xF5, 0xDA, 0xBD, 0x86,
+    0xA0, 0x87, 0xA8, 0x7C, 0x8F, 0x57, 0xB5, 0xEB, 0xBE, 0x3E, 0x2B, 0x7F, 0x0E, 0xFB, 0x7F, 0xBD,
+    0x2D, 0x1E, 0x38, 0x3C, 0x7C, 0xD9, 0x90, 0x71, 0x24, 0xE3, 0xD3, 0x87, 0x87, 0x2F, 0x01, 0xA8,
+    0x39, 0x69, 0x7A, 0xC3, 0x38, 0x3E, 0x92, 0x2E, 0xE1, 0xD2, 0x25, 0x8C, 0x97, 0x70, 0x69, 0x7C,
+    0x24, 0x19, 0x46, 0xCD, 0x50, 0x73, 0x02, 0x00, 0xB5, 0x02, 0xC8, 0x00, 0xCC, 0x04, 0xE8, 0x65,
+    0xF7, 0x44, 0x7D, 0x68, 0xDF, 0x7F, 0x89, 0x24, 0x0D, 0xC9, 0x37, 0x49, 0xFA, 0xDB, 0xDF, 0x71,
+    0xF4, 0x91, 0x6A, 0x0F, 0x67, 0x0E, 0x0F, 0x0F, 0xFF, 0x87, 0xCD, 0xB6, 0x32, 0x52, 0xAB, 0x3D,
+    0x34, 0x5C, 0x6A, 0x72, 0xEA, 0xAE, 0x47, 0x1C, 0x18, 0x07, 0x15, 0x81, 0x71, 0x42, 0xE7, 0xD1,
+    0x46, 0xA8, 0x0C, 0x70, 0xC0, 0x38, 0xA3, 0x23, 0x15, 0xB9, 0x18, 0x66, 0x00, 0xC0, 0xA9, 0x01,
+    0x63, 0xC6, 0xC8, 0x45, 0xFF, 0x69, 0x04, 0x2C, 0x60, 0xDC, 0xA9, 0xD1, 0x29, 0x4E, 0x15, 0x3D,
+    0x2A, 0x02, 0xFD, 0x65, 0x68, 0xFF, 0x6F, 0xCF, 0xAF, 0x3D, 0x63, 0xC3, 0x15, 0xA7, 0xF6, 0x80,
+    0xA7, 0x0F, 0xBA, 0xA8, 0x08, 0xEB, 0xBA, 0x45, 0xAD, 0xDB, 0x3D, 0xB3, 0xAE, 0xC9, 0xD0, 0x11,
+    0xE3, 0x0C, 0xBA, 0x36, 0xA2, 0x5B, 0x41, 0x57, 0x73, 0xD0, 0x11, 0xBD, 0xAF, 0x38, 0x29, 0xA2,
+    0x0F, 0x30, 0x5E, 0x11, 0x4D, 0x86, 0xF1, 0xB0, 0xB3, 0x7C, 0xC0, 0xCE, 0xA0, 0xD3, 0x09, 0x3A,
+    0xD6, 0x74, 0x15, 0xDD, 0x18, 0xD1, 0xD3, 0x72, 0x52, 0xE4, 0xAD, 0x00, 0xC3, 0x64, 0xD1, 0x64,
+    0x3E, 0xE1, 0x61, 0xBF, 0x3B, 0x00, 0x6D, 0xC4, 0x36, 0xC8, 0x75, 0x04, 0x50, 0x71, 0xDA, 0x66,
+    0x42, 0x75, 0x34, 0x13, 0x02, 0xA7, 0xF6, 0xF7, 0x87, 0x8E, 0xCC, 0x2D, 0xC9, 0x1F, 0x90, 0xCC,
+    0x86, 0x54, 0xEF, 0x90, 0xFE, 0xE1, 0x91, 0x54, 0x1F, 0x90, 0xFE, 0x61, 0x7B, 0xFC, 0x3F, 0xEF,
+    0x91, 0xFE, 0xE1, 0xDD, 0x7B, 0x3A, 0x52, 0x2D, 0x96, 0xFE, 0xE1, 0x8A, 0x54, 0x0B, 0x2A, 0xFF,
+    0x30, 0xD0, 0xFD, 0xAD, 0xFE, 0x23, 0xB6, 0x79, 0x9C, 0x7D, 0xE4, 0x87, 0xC4, 0x1E, 0xEA, 0x50,
+    0x65, 0x8C, 0x5E, 0x45, 0xB0, 0xE3, 0x55, 0xCE, 0x3C, 0x00, 0x50, 0x11, 0x5C, 0x6C, 0x1A, 0xF9,
+    0x06, 0xE3, 0xC3, 0xE6, 0x6B, 0x4D, 0x80, 0x1D, 0xB4, 0x07, 0xD1, 0x2D, 0x75, 0x82, 0x71, 0x2A,
+    0x02, 0x80, 0x9D, 0x15, 0x83, 0xBE, 0x15, 0xBB, 0xEF, 0x46, 0x33, 0x25, 0x33, 0x44, 0x53, 0x45,
+    0x53, 0x47, 0xF3, 0x78, 0x30, 0xF4, 0x9A, 0xAE, 0xBE, 0xB1, 0xDD, 0x8B, 0x26, 0x02, 0x19, 0x2D,
+    0x01, 0x8B, 0x8E, 0x13, 0xC6, 0xC1, 0x70, 0x86, 0x99, 0x3A, 0x7A, 0x18, 0x57, 0xBF, 0x13, 0xD1,
+    0x3B, 0xDC, 0x4B, 0x74, 0x33, 0x30, 0x4E, 0x7A, 0x01, 0xFA, 0x59, 0x7B, 0x40, 0xFB, 0x36, 0x00,
+    0x2A, 0x36, 0x41, 0x25, 0x50, 0xAD, 0x8A, 0xC3, 0xF8, 0x5C, 0x54, 0x74, 0xFD, 0xF7, 0x52, 0x4D,
+    0x8F, 0x2A, 0xD7, 0x5C, 0x01, 0x56, 0x29, 0x01, 0xAC, 0xA2, 0x05, 0xEC, 0x90, 0x8C, 0xC3, 0x38,
+    0x25, 0xED, 0x61, 0xDC, 0x48, 0x0E, 0xC6, 0xF5, 0xE4, 0xDC, 0xCF, 0x67, 0x0E, 0xF9, 0x42, 0xB7,
+    0x00, 0xC6, 0x69, 0x2F, 0x9E, 0x7B, 0xE2, 0x31, 0x3A, 0xE8, 0x05, 0x2D, 0x01, 0xA2, 0xE2, 0x8A,
+    0x36, 0xC0, 0x70, 0xC6, 0x38, 0x55, 0x24, 0x54, 0x44, 0xFD, 0x4E, 0x84, 0x71, 0xA8, 0xB4, 0xAF,
+    0x13, 0x80, 0x71, 0xEA, 0x16, 0xA0, 0x4E, 0x20, 0x00, 0xED, 0x5B, 0x7F, 0x6A, 0x80, 0x71, 0xE3,
+    0xE3, 0xF4, 0xA0, 0x5A, 0x2D, 0x7D, 0xB3, 0x1A, 0x47, 0xBA, 0xFE, 0x7B, 0xB1, 0x9A, 0x38, 0xA0,
+    0x9B, 0xA1, 0x22, 0x90, 0x81, 0xCE, 0x43, 0x8B, 0x2B, 0xDB, 0x01, 0x9D, 0x47, 0xB3, 0xA2, 0x26,
+    0x60, 0x1C, 0xCC, 0x02, 0x15, 0xA1, 0x12, 0xD0, 0xCF, 0x18, 0x19, 0xAB, 0x8C, 0x9A, 0xF4, 0xDA,
+    0x43, 0x53, 0xC6, 0x6B, 0x19, 0x21, 0x00, 0x1A, 0x7A, 0x20, 0xC3, 0xD0, 0x43, 0x7B, 0x5C, 0xB2,
+    0x0E, 0x76, 0x00, 0xC6, 0xA1, 0x59, 0x81, 0x3A, 0xC2, 0x38, 0x9C, 0x3A, 0x3F, 0xD7, 0x11, 0x30,
+    0x2B, 0xBA, 0x19, 0x60, 0x40, 0x06, 0xD0, 0x79, 0xED, 0x01, 0xF4, 0xCE, 0x02, 0x80, 0x6D, 0x42,
+    0x93, 0x9E, 0x39, 0x1F, 0xCD, 0x64, 0x3E, 0x24, 0xAF, 0x45, 0xC5, 0xAB, 0x5C, 0xFB, 0xD9, 0x10,
+    0xFB, 0xC5, 0xB4, 0xDA, 0x77, 0x6F, 0xCF, 0x9B, 0x6D, 0xDB, 0xA0, 0xAF, 0x44, 0x14, 0xE3, 0xAA,
+    0xD8, 0x90, 0x01, 0xC6, 0xF5, 0xA4, 0xAB, 0x13, 0x0E, 0x2F, 0xDE, 0x84, 0x98, 0x17, 0x2C, 0x33,
+    0xC4, 0x36, 0x7B, 0x0E, 0x50, 0x19, 0xB0, 0x1E, 0x9A, 0x80, 0x9D, 0x51, 0xAF, 0xC7, 0x0D, 0xAF,
+    0x3D, 0x6A, 0x02, 0xE3, 0x8C, 0x3E, 0x42, 0x13, 0x0D, 0xE7, 0x8A, 0x1E, 0x66, 0x45, 0x9B, 0x00,
+    0x3A, 0xE8, 0x88, 0x7B, 0xB9, 0x74, 0xCF, 0x93, 0xD1, 0x90, 0xDF, 0x25, 0xD7, 0x9A, 0xEF, 0xCA,
+    0x67, 0xEF, 0x03, 0x2A, 0x0E, 0xAF, 0x02, 0x8A, 0x37, 0x23, 0xD0, 0x92, 0x01, 0xD0, 0xAF, 0x73,
+    0x01, 0x3A, 0x7C, 0x69, 0xB8, 0xED, 0x16, 0xDB, 0x00, 0x00, 0x94, 0xA0, 0x43, 0x42, 0x8D, 0x08,
+    0x40, 0xDF, 0x8A, 0x00, 0xBA, 0x4F, 0x22, 0x00, 0xF3, 0x4E, 0x04, 0x30, 0x5E, 0x4B, 0x00, 0x78,
+    0x25, 0x01, 0x15, 0x1F, 0x4B, 0x80, 0xA2, 0xCA, 0x40, 0x93, 0xEA, 0x0C, 0xE8, 0x58, 0x13, 0xE8,
+    0x42, 0x4D, 0xC0, 0x90, 0x04, 0x2C, 0x49, 0x80, 0x24, 0x51, 0x93, 0xE4, 0xA0, 0xB8, 0xFF, 0x5B,
+    0x1C, 0xDA, 0x04, 0x70, 0xD0, 0x11, 0xE0, 0xD4, 0x07, 0x80, 0x93, 0xF1, 0x00, 0x9D, 0x9D, 0xCB,
+    0x84, 0xD1, 0x04, 0x00, 0x9A, 0x13, 0xD0, 0xBC, 0x17, 0x80, 0xDA, 0x3F, 0x0C, 0xE0, 0x55, 0x3D,
+    0x00, 0xDD, 0xDB, 0x33, 0xA0, 0xB8, 0x00, 0xE8, 0x0E, 0x4E, 0x5C, 0x43, 0xCB, 0xA1, 0xBC, 0x52,
+    0x33, 0x02, 0x95, 0x04, 0x53, 0xD6, 0x01, 0xE3, 0xDB, 0xBE, 0x9C, 0x7F, 0x17, 0x38, 0x40, 0x47,
+    0x33, 0xA3, 0x49, 0x3A, 0xC8, 0xC9, 0x57, 0x1C, 0xEC, 0x04, 0xBA, 0xDE, 0x63, 0x9C, 0xDB, 0x28,
+    0x67, 0xDE, 0x93, 0x74, 0x9A, 0xA4, 0x6F, 0x49, 0x26, 0xC5, 0xFD, 0xDF, 0xE2, 0xA3, 0x1C, 0x60,
+    0x66, 0x3A, 0xE8, 0xD5, 0xCE, 0x50, 0xD9, 0x78, 0x80, 0xD7, 0xC3, 0x2E, 0xA4, 0x23, 0x39, 0x95,
+    0x7F, 0x17, 0xA0, 0x22, 0xC9, 0x00, 0xB9, 0xFA, 0x04, 0xC0, 0x7E, 0xC0, 0xFD, 0x7D, 0x00, 0xE3,
+    0x87, 0xE2, 0xB1, 0xC6, 0xDB, 0x19, 0x00, 0xFA, 0x55, 0x26, 0x42, 0x1D, 0x75, 0x04, 0x00, 0x9D,
+    0x1A, 0xEE, 0x9F, 0x03, 0x1A, 0xD6, 0x24, 0x01, 0x45, 0x58, 0xD2, 0xA1, 0xE6, 0x64, 0x48, 0x8F,
+    0x8A, 0x4E, 0xE7, 0xC3, 0x17, 0x01, 0x52, 0x56, 0x06, 0x4B, 0x72, 0x00, 0x30, 0x96, 0x40, 0xD0,
+    0x90, 0xF4, 0x00, 0xFA, 0xB4, 0xFF, 0x54, 0x94, 0xD9, 0xB7, 0xC9, 0x00, 0x74, 0x46, 0x4D, 0x72,
+    0x6A, 0xE4, 0x96, 0xCC, 0xAA, 0x04, 0x9E, 0x35, 0x27, 0x74, 0x64, 0x04, 0x34, 0x7F, 0x0C, 0x54,
+    0x64, 0x06, 0x7A, 0x32, 0x42, 0xC9, 0xFA, 0xF6, 0xF1, 0x79, 0x4E, 0x8A, 0x30, 0x11, 0xE3, 0x02,
+    0xBA, 0x36, 0x41, 0x27, 0xD0, 0xC1, 0xCE, 0x3A, 0xA2, 0xCD, 0x3D, 0x39, 0xD8, 0x77, 0xC8, 0xD0,
+    0x26, 0x43, 0x82, 0x7F, 0x41, 0x7A, 0x1D, 0x7F, 0x8D, 0xE7, 0x2A, 0xBA, 0x71, 0x81, 0x59, 0xDB,
+    0x84, 0x86, 0xE0, 0x5C, 0x71, 0xD1, 0x11, 0x63, 0x04, 0x2F, 0x8F, 0x1C, 0x3A, 0x92, 0x73, 0x4D,
+    0x32, 0xC0, 0x90, 0x2B, 0x14, 0x37, 0xDF, 0xC5, 0x00, 0x74, 0x41, 0x3B, 0x54, 0xCC, 0x09, 0xD0,
+    0xA4, 0x07, 0x9E, 0xE9, 0x38, 0xA0, 0xF6, 0xA7, 0x6F, 0x9B, 0x9D, 0x3A, 0xCE, 0x40, 0x4B, 0x7A,
+    0x80, 0xA4, 0x87, 0x26, 0xE9, 0xC1, 0xD4, 0x70, 0x6E, 0x38, 0x29, 0x3A, 0xB3, 0xA2, 0x61, 0x4D,
+    0x07, 0x1D, 0x75, 0x02, 0x4C, 0x30, 0x1E, 0xE0, 0x77, 0xE9, 0xA0, 0xF8, 0x44, 0x06, 0x74, 0x34,
+    0x01, 0x30, 0x9E, 0x0E, 0x15, 0xAF, 0x10, 0x68, 0xB3, 0x8E, 0x80, 0x09, 0x26, 0xA0, 0xA6, 0xE3,
+    0x02, 0x9D, 0x6B, 0x3A, 0xD0, 0x2B, 0xCE, 0x1D, 0x87, 0x96, 0xE4, 0x0A, 0x4D, 0x72, 0x82, 0x26,
+    0x03, 0xD0, 0x48, 0x44, 0xB4, 0xA5, 0x03, 0x67, 0x80, 0xB9, 0x9F, 0x54, 0x18, 0x17, 0x1D, 0xBB,
+    0xD5, 0xF8, 0x26, 0xD3, 0x55, 0x24, 0x30, 0xCA, 0x9C, 0x03, 0x66, 0x28, 0x72, 0xD2, 0x71, 0x5C,
+    0x8C, 0xEF, 0x56, 0xE3, 0x9A, 0xA8, 0x51, 0x79, 0xB9, 0xEE, 0xED, 0xA1, 0x80, 0x8A, 0xC9, 0x0C,
+    0xB0, 0x64, 0x84, 0x26, 0x39, 0xCB, 0x38, 0x6A, 0x39, 0xF5, 0x19, 0x63, 0x00, 0xA3, 0xE2, 0xD0,
+    0xD2, 0x77, 0x11, 0x96, 0x8E, 0x73, 0x73, 0x93, 0x8F, 0x11, 0xE6, 0x8D, 0xD4, 0xAD, 0x2A, 0xF6,
+    0xDE, 0xCE, 0xBD, 0xE3, 0x15, 0x56, 0x49, 0x51, 0xC7, 0x6E, 0xD1, 0xD1, 0x78, 0x62, 0x5C, 0xF8,
+    0xA6, 0x57, 0x54, 0xB4, 0x43, 0x17, 0x35, 0x03, 0x38, 0xF7, 0x9C, 0x34, 0x61, 0x62, 0xC5, 0x20,
+    0x9E, 0x54, 0x93, 0x5C, 0xD1, 0x93, 0x1C, 0x90, 0x47, 0xCE, 0x80, 0x3F, 0x75, 0xEC, 0xC4, 0x4E,
+    0x1F, 0x02, 0x30, 0xA1, 0x44, 0xD0, 0xBD, 0x07, 0x2A, 0xE2, 0xB6, 0x55, 0xC3, 0x3A, 0xF4, 0x3F,
+    0xE1, 0x50, 0xF3, 0x6A, 0x86, 0x4E, 0x3A, 0x82, 0x8B, 0xF1, 0x0D, 0x61, 0x67, 0xE3, 0x2B, 0x3E,
+    0xCA, 0x49, 0xE5, 0x2E, 0x42, 0x47, 0x3A, 0xF4, 0xB7, 0x12, 0x30, 0xCA, 0xED, 0x03, 0x14, 0x03,
+    0xD0, 0xD2, 0x01, 0x5D, 0x84, 0xA4, 0x62, 0x15, 0xB7, 0x58, 0xC2, 0xF8, 0x12, 0x4F, 0x34, 0x79,
+    0x0B, 0x24, 0xAC, 0xDB, 0x82, 0x09, 0xBD, 0x6E, 0x59, 0x53, 0x1F, 0xCA, 0x09, 0xC2, 0xF0, 0x06,
+    0x60, 0xC8, 0x09, 0x23, 0xE9, 0x61, 0xC9, 0x00, 0xBA, 0x71, 0x05, 0x5D, 0x17, 0x2B, 0x3A, 0x1D,
+    0x2B, 0x4E, 0x3A, 0xD6, 0x1C, 0xBA, 0xA8, 0x08, 0xB3, 0x2A, 0x56, 0xF4, 0x0D, 0xC9, 0xA5, 0x2D,
+    0xE3, 0x3F, 0x43, 0x93, 0x0B, 0x74, 0x1A, 0x4E, 0x7C, 0xBB, 0x3F, 0x0A, 0x5F, 0x80, 0xFD, 0x01,
+    0x00, 0x46, 0xCA, 0x9C, 0xC5, 0x55, 0xC6, 0xFC, 0x0A, 0x34, 0xFC, 0x77, 0xF4, 0x80, 0x59, 0x2B,
+    0x3A, 0x80, 0x4E, 0x11, 0x90, 0x48, 0x0A, 0x7D, 0x00, 0x17, 0x80, 0xAE, 0x27, 0xA0, 0xA8, 0xE8,
+    0x81, 0x6E, 0x35, 0x09, 0x80, 0xFD, 0x2E, 0x1D, 0x50, 0xF3, 0x89, 0x0C, 0x40, 0xC7, 0x5E, 0x2E,
+    0x7D, 0x4C, 0x40, 0xC5, 0xC9, 0x26, 0xA0, 0x4D, 0xB0, 0x09, 0x30, 0x1E, 0x63, 0x04, 0xE8, 0x30,
+    0x7A, 0x28, 0x02, 0x74, 0xE8, 0x56, 0x28, 0x02, 0xF6, 0xDA, 0xF7, 0xC7, 0x15, 0x8A, 0x9A, 0x74,
+    0xD0, 0xD1, 0x30, 0x01, 0xA3, 0xB7, 0x9C, 0x50, 0x71, 0x3A, 0x35, 0x00, 0xAD, 0xC4, 0xF0, 0x72,
+    0x09, 0x8A, 0x0E, 0x80, 0x12, 0x2F, 0xD6, 0xF4, 0x00, 0x60, 0x08, 0x00, 0xE0, 0xBC, 0xBB, 0xA7,
+    0x7B, 0x68, 0xD7, 0x66, 0x06, 0xB3, 0x45, 0x43, 0xAE, 0x30, 0x4F, 0xD0, 0x21, 0xD4, 0xDB, 0x90,
+    0xFD, 0x3D, 0x00, 0x3D, 0xB5, 0xAF, 0xC9, 0xD1, 0xF5, 0x64, 0xAE, 0x78, 0x93, 0x41, 0xB3, 0xE2,
+    0x3C, 0x7A, 0xC5, 0x9A, 0x93, 0x8E, 0x3A, 0xC2, 0x2C, 0xC6, 0x57, 0x7C, 0x84, 0x53, 0x1B, 0x9B,
+    0x0C, 0xE3, 0xFB, 0xB5, 0xA2, 0xB3, 0x8B, 0xCE, 0x15, 0x9D, 0x0D, 0x8A, 0xD7, 0x65, 0xD6, 0x45,
+    0xC7, 0xF7, 0x56, 0x74, 0xA9, 0x5F, 0x50, 0x95, 0x71, 0xBE, 0x4D, 0xFB, 0xDD, 0xB7, 0x66, 0x59,
+    0x0A, 0x6A, 0xFF, 0x10, 0xD0, 0xBC, 0xE7, 0xB7, 0x85, 0x62, 0x3B, 0x93, 0xD3, 0x7B, 0x40, 0x4D,
+    0x4F, 0xF4, 0xFC, 0x24, 0xD6, 0x24, 0x97, 0x8E, 0x17, 0x39, 0xD0, 0x77, 0xA9, 0x21, 0x8C, 0xEF,
+    0x57, 0xD0, 0xD1, 0xA9, 0xAC, 0x88, 0x2E, 0x74, 0x2B, 0xAC, 0x1B, 0x17, 0xC5, 0x9A, 0x53, 0x17,
+    0xDB, 0x0C, 0x2E, 0x5D, 0x6C, 0x39, 0x98, 0xCC, 0x08, 0x92, 0xBE, 0x62, 0x1E, 0xA7, 0x8A, 0xDF,
+    0xCB, 0x90, 0x0C, 0xB0, 0xFA, 0x26, 0xF0, 0x7B, 0x40, 0x4F, 0xFD, 0x36, 0x67, 0x90, 0x6F, 0x93,
+    0xA1, 0x26, 0x49, 0xC6, 0x86, 0x6F, 0x31, 0xE9, 0xA8, 0x73, 0x4D, 0xDF, 0xC4, 0x2E, 0x56, 0x74,
+    0x6D, 0xEC, 0x03, 0xE8, 0xFA, 0x68, 0x3C, 0xF8, 0x3E, 0x83, 0xF1, 0x15, 0xC9, 0x79, 0x5C, 0x6A,
+    0x32, 0x63, 0x9C, 0x15, 0x6F, 0xEE, 0xC1, 0xCE, 0x0D, 0x01, 0xD8, 0x45, 0x13, 0xC0, 0xE8, 0x7B,
+    0x4E, 0xD5, 0x60, 0x32, 0xF9, 0xA3, 0xF3, 0x93, 0x21, 0x49, 0x4E, 0x9A, 0xEF, 0x91, 0x1C, 0x1A,
+    0x7E, 0xFD, 0x1D, 0xDE, 0x00, 0xEE, 0x3D, 0x4A, 0xF4, 0xD0, 0x4E, 0x0F, 0xA2, 0xE2, 0xF9, 0x05,
+    0x3D, 0x13, 0x30, 0x26, 0xA0, 0xA3, 0x43, 0x4B, 0x02, 0xB6, 0xF7, 0x50, 0x03, 0x27, 0xA0, 0x8D,
+    0xE8, 0xD3, 0xE8, 0x3A, 0xDE, 0x8A, 0x0D, 0x49, 0xC7, 0x9B, 0x8C, 0x26, 0x2A, 0x5E, 0x21, 0xFA,
+    0x38, 0x2E, 0x15, 0xDF, 0x48, 0xE8, 0x57, 0xBA, 0x9A, 0x4F, 0x46, 0x18, 0x4F, 0xD7, 0xB0, 0x4D,
+    0xE0, 0x3C, 0xDE, 0xB0, 0xAB, 0x22, 0x29, 0xE0, 0x46, 0xCF, 0x79, 0x97, 0x1C, 0x63, 0x0F, 0x5D,
+    0x68, 0x1D, 0x98, 0xAD, 0x44, 0x17, 0xA6, 0xE5, 0x54, 0xF9, 0x9D, 0x43, 0x9C, 0x1D, 0x80, 0x8E,
+    0x1E, 0x35, 0x19, 0xD0, 0x93, 0xBE, 0xE2, 0x4D, 0xCE, 0x3A, 0x57, 0x74, 0xA3, 0x57, 0x54, 0x1C,
+    0xC4, 0x21, 0xFC, 0xB8, 0x80, 0x97, 0x39, 0x29, 0xB6, 0x09, 0xDD, 0xDA, 0x07, 0x70, 0x1E, 0x97,
+    0x86, 0x15, 0xDD, 0xB8, 0x2A, 0x5E, 0xA7, 0x6B, 0xC8, 0x88, 0x96, 0x74, 0x68, 0x18, 0x00, 0x9C,
+    0x03, 0x80, 0x2A, 0x94, 0x89, 0x67, 0x74, 0x40, 0xE7, 0x81, 0x5A, 0x80, 0x9F, 0xFA, 0xF0, 0xF0,
+    0xF0, 0xB6, 0xFC, 0x0C, 0x00, 0xAA, 0x01, 0x50, 0xF1, 0xD8, 0x47, 0xF4, 0x02, 0x60, 0x6F, 0xE7,
+    0xDD, 0x5F, 0x39, 0x2D, 0xA0, 0x4D, 0x4B, 0xAE, 0xB0, 0xA4, 0x6B, 0xF8, 0xAF, 0x39, 0x18, 0xDF,
+    0xB1, 0xE2, 0xD7, 0x18, 0x75, 0xD4, 0xF4, 0x66, 0x21, 0x2F, 0xF3, 0xF9, 0x8F, 0xD8, 0xA4, 0x51,
+    0xC7, 0xFE, 0x56, 0x18, 0x17, 0xCB, 0x67, 0xF9, 0x08, 0x57, 0x1D, 0x1B, 0x3A, 0x2E, 0x9A, 0x17,
+    0x89, 0x9E, 0xF4, 0x28, 0x16, 0x9B, 0xD1, 0x57, 0x7B, 0xD8, 0x21, 0x07, 0xA7, 0x5F, 0x06, 0x04,
+    0x5B, 0x3A, 0x9E, 0x01, 0xD5, 0x19, 0x00, 0xF4, 0x7C, 0x72, 0x5D, 0x33, 0x0B, 0xEC, 0x02, 0x4E,
+    0x8A, 0x50, 0x44, 0xBF, 0x42, 0x47, 0xD0, 0xA1, 0xF7, 0x6D, 0x06, 0x46, 0x67, 0x3C, 0x2A, 0xD6,
+    0x1C, 0xA0, 0x92, 0x8E, 0x80, 0x0E, 0x76, 0x06, 0xCC, 0x35, 0x02, 0xE0, 0xB7, 0x02, 0x50, 0x67,
+    0xEB, 0x80, 0xE6, 0x56, 0x02, 0xD0, 0x71, 0xD9, 0x8D, 0x68, 0xAE, 0xBB, 0x01, 0xDF, 0xE6, 0xA3,
+    0x53, 0xE0, 0x84, 0x32, 0xE5, 0x56, 0x9C, 0x81, 0x86, 0x19, 0x72, 0xF7, 0x80, 0x31, 0x63, 0x83,
+    0x69, 0xB6, 0xB9, 0xCE, 0xF8, 0x6D, 0xAE, 0x6D, 0xD3, 0xEE, 0x5A, 0xE8, 0xCA, 0x84, 0x8D, 0x2E,
+    0xFC, 0x3A, 0xD0, 0x46, 0x1B, 0xA0, 0x68, 0x59, 0xD6, 0xE5, 0x31, 0xDB, 0x88, 0x3E, 0x29, 0x0E,
+    0x3A, 0x83, 0xB3, 0xE4, 0x98, 0x9C, 0x74, 0x12, 0x04, 0xAF, 0xF7, 0xA0, 0xD3, 0x11, 0xA3, 0x57,
+    0x84, 0x91, 0x19, 0x1A, 0x63, 0xD0, 0x82, 0x74, 0x41, 0x93, 0x1C, 0x54, 0xB6, 0x1C, 0x2A, 0x3E,
+    0xCF, 0x01, 0x76, 0xBE, 0x4F, 0xD6, 0x1E, 0x49, 0x2D, 0x15, 0x77, 0xF9, 0xA5, 0x9D, 0x4F, 0x40,
+    0x66, 0xBB, 0xC7, 0x6B, 0xED, 0x02, 0x34, 0xD1, 0x38, 0xA0, 0xFF, 0x90, 0x00, 0xC6, 0xC7, 0x56,
+    0x00, 0xF7, 0x56, 0xFF, 0x41, 0x98, 0x1D, 0xFB, 0xFB, 0x7B, 0x90, 0x01, 0xAE, 0x28, 0x90, 0x5B,
+    0xBC, 0x4B, 0x04, 0xAF, 0x39, 0x6D, 0x01, 0xFC, 0x48, 0x57, 0xE2, 0xF7, 0x8A, 0xA3, 0x2B, 0xE1,
+    0x6F, 0x93, 0xCC, 0x5C, 0xA2, 0xF7, 0x2E, 0x98, 0xB9, 0x04, 0xEF, 0xE3, 0xDC, 0x2F, 0x12, 0xBB,
+    0x57, 0x1C, 0x7A, 0x2F, 0x01, 0x70, 0xCB, 0xE2, 0xC7, 0x12, 0x0B, 0x07, 0x09, 0xDC, 0xED, 0x0C,
+    0x1D, 0x74, 0x04, 0xF8, 0x2C, 0x07, 0xE8, 0xD5, 0x78, 0x80, 0x6F, 0x24, 0x40, 0x47, 0x54, 0xFB,
+    0xFB, 0x03, 0x7A, 0x66, 0x80, 0x0C, 0xE5, 0x34, 0xFF, 0x1E, 0xE6, 0x63, 0xD4, 0x07, 0xD5, 0x0B,
+    0x40, 0xE7, 0xB4, 0x03, 0xCC, 0xFB, 0x19, 0x80, 0x0C, 0x7A, 0x09, 0x8A, 0xCF, 0x1F, 0xDC, 0x2D,
+    0xD5, 0x91, 0x04, 0xA2, 0xA7, 0xDB, 0xF2, 0x04, 0xC9, 0x74, 0xC6, 0xB7, 0x3D, 0xA0, 0xB2, 0x71,
+    0x25, 0x53, 0x10, 0x53, 0x35, 0x49, 0x07, 0xC0, 0x78, 0xB3, 0x94, 0x5C, 0x41, 0xF2, 0x9C, 0x71,
+    0x6E, 0xB7, 0x08, 0xB9, 0x27, 0xE9, 0xB6, 0xF0, 0x8C, 0x4C, 0x30, 0x1F, 0xEF, 0x9F, 0x0F, 0x35,
+    0x07, 0x98, 0x59, 0xB2, 0x1C, 0x3B, 0x43, 0x65, 0x45, 0x40, 0xC7, 0x5E, 0x32, 0x86, 0x33, 0x53,
+    0x7D, 0x00, 0x03, 0x33, 0x80, 0xAF, 0x44, 0xD4, 0xE4, 0x8C, 0x9A, 0x09, 0xA8, 0x2E, 0x0D, 0x7F,
+    0x4F, 0x4B, 0xAA, 0x98, 0xC2, 0xE4, 0xCD, 0x12, 0x1D, 0x7D, 0x31, 0x44, 0x93, 0x58, 0xEC, 0x50,
+    0xF1, 0xC9, 0x50, 0xCC, 0x30, 0xCE, 0x1C, 0xC4, 0x0A, 0x5D, 0x68, 0x57, 0x31, 0x42, 0x93, 0x60,
+    0x9D, 0x22, 0xE9, 0x6B, 0x52, 0x6E, 0x10, 0x61, 0x49, 0xCE, 0xE6, 0xE3, 0xFD, 0xF3, 0xA1, 0x0F,
+    0x65, 0xA0, 0xF0, 0xF9, 0x04, 0x98, 0x77, 0x08, 0xE8, 0xCC, 0x41, 0xC6, 0x6B, 0xBD, 0x6E, 0x30,
+    0x9B, 0x8A, 0x00, 0xAA, 0x04, 0x00, 0xE3, 0x00, 0xA0, 0xE3, 0x6E, 0xB4, 0xF4, 0x5B, 0x58, 0x59,
+    0x7D, 0x13, 0x80, 0x8D, 0xC6, 0xB5, 0x4C, 0x84, 0x25, 0xD7, 0x86, 0x1F, 0x70, 0x36, 0xB1, 0xE1,
+    0x23, 0x74, 0x3A, 0xB6, 0x19, 0xC6, 0x1B, 0x0F, 0x4E, 0x74, 0x4D, 0x6A, 0x32, 0x7A, 0xDF, 0xAD,
+    0xA0, 0xB3, 0x4B, 0xC3, 0x9A, 0x93, 0x59, 0x1B, 0xD6, 0x9C, 0x35, 0x2D, 0x61, 0xC8, 0x88, 0x91,
+    0xDF, 0x5A, 0x30, 0x06, 0x3B, 0xE1, 0x9E, 0xC6, 0x17, 0x9C, 0xB3, 0xF1, 0x05, 0xBC, 0x83, 0x9C,
+    0xC0, 0x5C, 0x92, 0xCA, 0xF6, 0x68, 0xAC, 0xD5, 0x87, 0x00, 0x94, 0x0C, 0xB3, 0xA9, 0x04, 0xA7,
+    0xE0, 0x50, 0xBE, 0xE0, 0x44, 0x5E, 0xF2, 0x2E, 0x30, 0x96, 0xA8, 0x3D, 0x80, 0x64, 0x84, 0xCD,
+    0xD5, 0x6B, 0x18, 0x57, 0x54, 0x30, 0x71, 0x1B, 0xF8, 0x3A, 0xDF, 0x6D, 0xFE, 0x0A, 0x27, 0x66,
+    0x36, 0x99, 0x5B, 0xE5, 0xC9, 0x0C, 0xA0, 0x96, 0xBF, 0x13, 0xFE, 0x1B, 0x99, 0x18, 0x41, 0x72,
+    0x2E, 0xC9, 0x88, 0xE5, 0xBB, 0xDB, 0x12, 0x89, 0xFA, 0x50, 0xCE, 0xB5, 0xE6, 0x24, 0x67, 0xCA,
+    0xE1, 0xE8, 0x3C, 0xAB, 0x3F, 0x03, 0x3A, 0x46, 0xF4, 0x32, 0xC2, 0xA7, 0x8E, 0x7F, 0x3A, 0x6B,
+    0x02, 0x0D, 0x4B, 0x68, 0x4F, 0x27, 0x6B, 0x55, 0xB7, 0xCA, 0xA4, 0x55, 0x73, 0x92, 0x09, 0xBE,
+    0x4B, 0xF8, 0x5D, 0xC5, 0x5B, 0x2B, 0x46, 0x66, 0xB4, 0x12, 0x5E, 0x4F, 0xDB, 0x31, 0x0F, 0x0F,
+    0x00, 0x30, 0x6E, 0xE3, 0x8F, 0xDF, 0xF0, 0x00, 0x1F, 0xC9, 0xC0, 0x25, 0x74, 0xEE, 0xD3, 0x66,
+    0xA0, 0xC3, 0x03, 0x39, 0x57, 0x72, 0x00, 0xBF, 0xE1, 0xC1, 0x47, 0xF2, 0xD1, 0x79, 0xFE, 0x82,
+    0x0C, 0x74, 0x0F, 0x36, 0xB7, 0xEE, 0x04, 0x68, 0xC1, 0xE6, 0x41, 0x67, 0x86, 0x4F, 0x9D, 0x07,
+    0xDD, 0x03, 0xC0, 0x4E, 0xA8, 0xE8, 0xA4, 0x90, 0xC5, 0x01, 0xF8, 0x47, 0x5B, 0xC8, 0x34, 0xA0,
+    0x63, 0x84, 0x65, 0xAC, 0xC9, 0xB5, 0xE1, 0x5F, 0x06, 0x4D, 0x39, 0x25, 0x53, 0x30, 0x91, 0xD1,
+    0x8B, 0x3D, 0x6C, 0xF9, 0x19, 0x17, 0x60, 0x0C, 0xD5, 0x64, 0x68, 0xA7, 0x8E, 0x9C, 0x5A, 0x72,
+    0xAA, 0x98, 0x4B, 0x48, 0xF9, 0x15, 0x9C, 0x39, 0x40, 0xB3, 0x36, 0x2B, 0xD0, 0x7F, 0x4F, 0xA6,
+    0xF1, 0x09, 0x68, 0x65, 0x15, 0x5D, 0xEF, 0x32, 0xBA, 0x3A, 0x32, 0x94, 0xC8, 0x80, 0xA4, 0x17,
+    0xE3, 0x74, 0x19, 0x18, 0x64, 0xEE, 0x18, 0xFD, 0x76, 0xB9, 0x77, 0xD6, 0xD4, 0x6E, 0x43, 0xA1,
+    0xCB, 0x7F, 0xC3, 0x36, 0xB8, 0xD1, 0x0B, 0x78, 0x1D, 0xAA, 0x6F, 0x17, 0x03, 0x19, 0x32, 0x00,
+    0x24, 0x07, 0xD4, 0xE4, 0xC1, 0x66, 0xA1, 0xAF, 0xE0, 0xCC, 0x41, 0xB3, 0x36, 0xAB, 0x9C, 0x32,
+    0x39, 0xC9, 0x09, 0xEF, 0xCE, 0xF7, 0xF4, 0x37, 0xC5, 0x89, 0x5A, 0xD2, 0xD5, 0xE4, 0x8A, 0x31,
+    0x9F, 0x1F, 0x34, 0x21, 0xE6, 0x94, 0x34, 0xBA, 0x9C, 0x6A, 0x93, 0x21, 0x66, 0x6A, 0x73, 0x89,
+    0xA4, 0x1A, 0x0E, 0x9F, 0x83, 0xA1, 0x9D, 0x2A, 0x72, 0x15, 0x47, 0xEA, 0xB8, 0x6C, 0x11, 0xF8,
+    0x03, 0xC3, 0xE9, 0x17, 0x00, 0x3B, 0xD8, 0x01, 0xA0, 0x0E, 0x40, 0x45, 0x41, 0xC0, 0x02, 0x80,
+    0xE6, 0x08, 0x15, 0x15, 0x28, 0x91, 0x3F, 0x16, 0x84, 0x68, 0x42, 0x4D, 0xD2, 0x41, 0x93, 0x74,
+    0x02, 0xED, 0x80, 0x4E, 0xB3, 0x24, 0xA6, 0x7D, 0x80, 0x09, 0x82, 0xED, 0x28, 0xA2, 0xE6, 0xD4,
+    0x45, 0xB4, 0x19, 0xE3, 0x82, 0x3E, 0xD4, 0x1C, 0xC0, 0x59, 0x47, 0x28, 0xC2, 0x78, 0x74, 0xB1,
+    0xE2, 0x04, 0x2E, 0x82, 0xEE, 0x98, 0x80, 0x71, 0x05, 0x5D, 0x43, 0xA7, 0x78, 0x8A, 0x09, 0x1D,
+    0xC9, 0x19, 0x96, 0x4C, 0x50, 0x1B, 0x58, 0x22, 0x6B, 0x71, 0x75, 0xEE, 0xD4, 0x39, 0x00, 0xDD,
+    0x6A, 0x66, 0x00, 0xF6, 0x7B, 0x32, 0xD9, 0x6A, 0x89, 0xD9, 0xC6, 0x01, 0x80, 0x79, 0x27, 0xEC,
+    0xDC, 0xF9, 0xF7, 0xDA, 0x04, 0xA0, 0xCB, 0xBD, 0x07, 0x6A, 0x66, 0x3A, 0xA0, 0x27, 0x33, 0x50,
+    0xF1, 0x27, 0x0C, 0x80, 0xCE, 0x95, 0x0C, 0x44, 0x45, 0x40, 0xAA, 0x18, 0xD0, 0x11, 0x66, 0x01,
+    0x8C, 0x07, 0x07, 0x54, 0x9C, 0x9A, 0x08, 0x34, 0x09, 0xBD, 0x97, 0xC4, 0x7B, 0x02, 0xEC, 0xD2,
+    0x66, 0xA0, 0xA2, 0x1B, 0x03, 0xA0, 0x78, 0x9D, 0x0E, 0xD0, 0x52, 0xFE, 0xD2, 0xFC, 0x64, 0x05,
+    0xD0, 0xE5, 0x6E, 0x2E, 0x89, 0xC3, 0xCE, 0x80, 0xBF, 0x74, 0x68, 0xAC, 0x3A, 0x87, 0x2D, 0xCA,
+    0x6E, 0x13, 0x50, 0x1D, 0x16, 0x84, 0x63, 0x86, 0x22, 0x23, 0xF0, 0xC0, 0xC5, 0x9B, 0x93, 0xF8,
+    0x78, 0x75, 0xD0, 0x7B, 0xD4, 0x7C, 0x87, 0x00, 0x69, 0x17, 0x18, 0x32, 0xA1, 0xE5, 0x5B, 0x74,
+    0xE0, 0xD2, 0x45, 0xF4, 0xAB, 0x00, 0x12, 0x7A, 0x15, 0x33, 0x35, 0x19, 0x9D, 0xC7, 0xB8, 0xD4,
+    0x44, 0x9B, 0x60, 0x16, 0x8C, 0x4B, 0x9B, 0xD1, 0xB0, 0xE2, 0x0C, 0x93, 0xCB, 0x05, 0xBB, 0x62,
+    0x1C, 0xB3, 0x9A, 0x61, 0x07, 0x78, 0xED, 0xEF, 0xEF, 0x01, 0x56, 0x46, 0x87, 0xDF, 0x82, 0xAF,
+    0x23, 0xBF, 0x93, 0x8A, 0x70, 0x44, 0x4F, 0xAE, 0x72, 0x35, 0xE6, 0xE3, 0xFD, 0x3D, 0x19, 0x76,
+    0xE3, 0xB2, 0xCD, 0x57, 0x52, 0x0B, 0xFE, 0xFE, 0xFE, 0x50, 0x91, 0x9C, 0xAA, 0x0D, 0x87, 0x82,
+    0xE2, 0xE1, 0xA1, 0x0C, 0x91, 0x26, 0x6F, 0xF9, 0x86, 0x4E, 0xDB, 0xDC, 0xA6, 0x23, 0x70, 0xC7,
+    0xB7, 0x93, 0x01, 0x38, 0xB5, 0xBF, 0x0F, 0x25, 0x73, 0xA7, 0x87, 0x61, 0x19, 0x8E, 0xBF, 0xBA,
+    0x07, 0x58, 0x4E, 0x15, 0x19, 0x2B, 0x92, 0x03, 0x97, 0x71, 0xE1, 0xAC, 0xD7, 0x71, 0x51, 0xB9,
+    0x0F, 0x0D, 0x9F, 0xCC, 0x17, 0x79, 0x95, 0xE4, 0x65, 0x92, 0x83, 0xCD, 0x2F, 0xA2, 0x0F, 0x72,
+    0xE0, 0x8A, 0x0E, 0x93, 0xC9, 0xBF, 0xE3, 0x1B, 0x32, 0xC2, 0x92, 0x12, 0xAB, 0xCB, 0x40, 0x7C,
+    0x11, 0x5F, 0x01, 0x22, 0x12, 0xC0, 0x57, 0x62, 0x31, 0x85, 0xE1, 0x0C, 0x9C, 0xBE, 0x81, 0x4F,
+    0x81, 0x29, 0xCE, 0x0E, 0x67, 0xA6, 0x7A, 0xAD, 0x22, 0xBA, 0x9B, 0x9C, 0x40, 0x7A, 0x01, 0xF7,
+    0xCF, 0x6C, 0x27, 0x77, 0xEA, 0x9B, 0x40, 0xCB, 0x15, 0x0D, 0xE9, 0x2B, 0x92, 0x83, 0x59, 0xBB,
+    0x55, 0x27, 0xF0, 0x6B, 0x9C, 0xF4, 0xDA, 0x87, 0x86, 0x8F, 0xF1, 0x15, 0xFA, 0x91, 0x8C, 0x0D,
+    0x99, 0x60, 0xF3, 0x8B, 0x72, 0x70, 0x99, 0xA2, 0x50, 0xC3, 0xE4, 0xDF, 0xF1, 0x55, 0x09, 0x7E,
+    0x3D, 0x3A, 0xAE, 0x3B, 0x90, 0xE0, 0xBE, 0x8D, 0xF6, 0x20, 0xE7, 0x4D, 0x00, 0x2A, 0x03, 0xC0,
+    0x97, 0x3F, 0x0D, 0x96, 0x41, 0x05, 0xA0, 0x5D, 0xE5, 0xC4, 0x64, 0x42, 0x9E, 0x81, 0xBA, 0x64,
+    0x0C, 0xD5, 0xEF, 0x89, 0x5D, 0x3A, 0xE1, 0x80, 0x04, 0x9D, 0x9B, 0xAC, 0x13, 0xF8, 0xF5, 0x0C,
+    0xF3, 0x43, 0x0E, 0x63, 0xE0, 0xFB, 0x52, 0x56, 0xEE, 0xC8, 0xD0, 0xF2, 0xFD, 0xA1, 0xE6, 0x50,
+    0xD6, 0xFF, 0x88, 0xCF, 0x28, 0xFE, 0xC8, 0x62, 0x24, 0x5D, 0x2B, 0xD4, 0x87, 0x45, 0x16, 0x8C,
+    0x5F, 0xDA, 0xA5, 0xF6, 0x53, 0x29, 0x3D, 0xA9, 0x75, 0xAB, 0xAF, 0xB4, 0xB2, 0x50, 0xB8, 0x2D,
+    0xD6, 0x3E, 0x5A, 0x32, 0x7E, 0x7B, 0x40, 0xCD, 0x8C, 0x86, 0xF4, 0x0D, 0x99, 0x14, 0xBF, 0xC6,
+    0xE7, 0x38, 0x98, 0x1F, 0x70, 0xD2, 0xAB, 0x9D, 0xBB, 0x64, 0x6E, 0x5A, 0x76, 0x24, 0x1B, 0x32,
+    0xD5, 0xBC, 0x79, 0x00, 0x3B, 0xCB, 0xF2, 0xDA, 0x10, 0x35, 0x78, 0xE3, 0xBC, 0xEB, 0x24, 0x25,
+    0x88, 0xE2, 0x0D, 0xBF, 0xB6, 0xCA, 0x71, 0xEB, 0x15, 0x40, 0x2A, 0x61, 0x7E, 0xC7, 0x72, 0xE0,
+    0x7E, 0x01, 0xAA, 0x17, 0xF1, 0xC0, 0x00, 0x33, 0x8D, 0x0E, 0xED, 0x6A, 0x1D, 0x40, 0xC9, 0x48,
+    0x76, 0x27, 0x77, 0xD2, 0x59, 0x9A, 0xAD, 0xA2, 0x34, 0x81, 0xE4, 0x22, 0x26, 0x14, 0x8E, 0x4C,
+    0xDE, 0x2D, 0xF2, 0x12, 0xE3, 0x7C, 0xBC, 0xBF, 0x27, 0x94, 0x94, 0x86, 0x4C, 0x90, 0x92, 0x0A,
+    0xDF, 0x3F, 0x9C, 0xEE, 0x44, 0x31, 0x8E, 0x3E, 0xE3, 0x37, 0x33, 0xB6, 0x14, 0xB0, 0x5E, 0x8E,
+    0x33, 0x03, 0x67, 0x87, 0xFA, 0x45, 0x8C, 0xD3, 0x38, 0xC1, 0x3E, 0xB1, 0xCA, 0x82, 0x5F, 0x73,
+    0xDD, 0xA2, 0x86, 0x6D, 0x8E, 0x69, 0xB9, 0xA2, 0x2A, 0x77, 0x3A, 0x80, 0xCB, 0xB8, 0xE8, 0x04,
+    0x4E, 0xE3, 0xA2, 0x72, 0xCD, 0x61, 0x0C, 0x3A, 0x5F, 0xA4, 0x1B, 0xB7, 0x59, 0xA8, 0xE5, 0xFB,
+    0x83, 0xE0, 0xCA, 0x82, 0x77, 0x3B, 0x4C, 0x8A, 0x3F, 0xB2, 0xD8, 0x70, 0x2F, 0x5F, 0x80, 0x81,
+    0x73, 0x85, 0x19, 0xF3, 0x02, 0x80, 0x8E, 0x53, 0x29, 0xD2, 0x55, 0x7C, 0xCA, 0x03, 0xA3, 0xB3,
+    0x03, 0xF4, 0x52, 0x9F, 0x44, 0x05, 0x3E, 0xCF, 0x1B, 0x40, 0x27, 0x33, 0xBF, 0x04, 0x20, 0x5C,
+    0x61, 0xF3, 0x70, 0x1E, 0x1D, 0x07, 0xDC, 0x5B, 0xC2, 0xA4, 0x70, 0x5B, 0x98, 0x14, 0xB1, 0xBF,
+    0x5F, 0x73, 0x32, 0x0C, 0x26, 0x28, 0x52, 0x11, 0x86, 0xDE, 0xF8, 0xD3, 0x17, 0xB3, 0x22, 0x60,
+    0x67, 0x13, 0xA0, 0xA3, 0xE2, 0x04, 0xBA, 0x3E, 0x42, 0x47, 0x30, 0xD4, 0x9C, 0xDA, 0x6D, 0xB9,
+    0xDA, 0x10, 0x9F, 0x4A, 0x16, 0x2D, 0xC1, 0x29, 0xCF, 0xBC, 0xBC, 0x61, 0x21, 0xE4, 0x24, 0xA9,
+    0xA5, 0x0E, 0xDA, 0xA3, 0x9F, 0x9A, 0x70, 0x2C, 0xDD, 0x6D, 0x79, 0x25, 0xC2, 0xF0, 0xBD, 0x08,
+    0x4B, 0xAE, 0x15, 0x6F, 0x32, 0x28, 0xBA, 0x31, 0x34, 0x84, 0xF1, 0x6D, 0x86, 0xF1, 0x3A, 0xC2,
+    0x2C, 0x3A, 0x62, 0x9C, 0xBB, 0x15, 0xD6, 0x75, 0x2B, 0xE8, 0xFA, 0xB5, 0xA2, 0xEB, 0x57, 0xC5,
+    0xA9, 0x8B, 0x2D, 0x07, 0x4D, 0x2B, 0x88, 0x11, 0x1A, 0x7E, 0x92, 0x51, 0xF1, 0xEA, 0xD1, 0x50,
+    0x89, 0x72, 0xCF, 0xFF, 0x39, 0xC6, 0x20, 0x7C, 0xA4, 0x91, 0x74, 0x18, 0x99, 0x81, 0xCF, 0x0B,
+    0x69, 0xE4, 0xEC, 0x70, 0x66, 0x42, 0xBD, 0x56, 0x11, 0x32, 0x61, 0xCA, 0x82, 0x26, 0xF5, 0xD0,
+    0x33, 0x37, 0xF0, 0xE9, 0xB4, 0x6F, 0x7D, 0x50, 0xBD, 0x08, 0xE5, 0x55, 0x80, 0xCA, 0x17, 0xBD,
+    0xA0, 0x09, 0x92, 0x80, 0x7D, 0x7E, 0xC3, 0x63, 0x3F, 0x2D, 0xF6, 0xC5, 0x29, 0x00, 0x50, 0x69,
+    0x07, 0x85, 0x0A, 0x20, 0x36, 0xCE, 0x00, 0xAA, 0x17, 0x3E, 0xA5, 0xF6, 0x15, 0xA8, 0xB8, 0x3D,
+    0x9A, 0x63, 0xE3, 0x56, 0x72, 0xAA, 0x0E, 0x3E, 0x6D, 0xF6, 0x05, 0x80, 0xCA, 0xF2, 0x00, 0xD5,
+    0x16, 0x81, 0x47, 0xF4, 0x24, 0xA7, 0x96, 0xEF, 0x9E, 0xF6, 0x15, 0xC3, 0x96, 0x3D, 0x36, 0x32,
+    0xE3, 0x2D, 0x47, 0x04, 0x1D, 0x77, 0x6A, 0x7F, 0xAF, 0x5F, 0x15, 0xF9, 0x18, 0x07, 0x43, 0x6F,
+    0xBC, 0x98, 0xEF, 0x69, 0x2E, 0xC6, 0xA3, 0x4D, 0x8A, 0x03, 0xE8, 0x8C, 0x60, 0x3F, 0x0E, 0x74,
+    0x9A, 0x43, 0xBF, 0x4A, 0xD5, 0x50, 0xED, 0xAA, 0xAF, 0x40, 0xC7, 0x3C, 0x00, 0xD5, 0x11, 0xBA,
+    0xDE, 0xF9, 0xDD, 0xC2, 0x6F, 0xDC, 0xB6, 0xF2, 0x20, 0x1D, 0x71, 0x36, 0x4A, 0x56, 0x99, 0x36,
+    0x30, 0xA8, 0x5D, 0xB7, 0x4F, 0xED, 0x00, 0xA0, 0x4F, 0x8D, 0x7D, 0x1F, 0x78, 0x11, 0x1B, 0xC4,
+    0xA1, 0x98, 0x01, 0xE8, 0x95, 0x00, 0xCC, 0x3C, 0x4E, 0x77, 0xA2, 0x1C, 0xD0, 0x2B, 0x9A, 0x84,
+    0x6E, 0x2D, 0xC9, 0x95, 0x8E, 0x30, 0xF2, 0xDB, 0xA3, 0x5B, 0x61, 0x3C, 0xFA, 0x80, 0x71, 0x11,
+    0x96, 0x15, 0x8C, 0x07, 0x1D, 0xC6, 0x05, 0x7C, 0xFF, 0xD0, 0x2E, 0x15, 0x49, 0xCE, 0x15, 0x37,
+    0xD7, 0xA7, 0x13, 0x8E, 0x81, 0x22, 0x6A, 0x0E, 0x4D, 0x86, 0xE2, 0xD0, 0x26, 0x28, 0x42, 0xCB,
+    0xEF, 0x58, 0x92, 0xB8, 0xF6, 0xB6, 0x03, 0xFA, 0xA3, 0x03, 0x0A, 0x80, 0x65, 0x58, 0xEA, 0x7D,
+    0xE6, 0xBD, 0x08, 0x95, 0x9A, 0x15, 0x66, 0x6A, 0x4A, 0xD8, 0x5E, 0xED, 0x6F, 0xAE, 0x3D, 0xCE,
+    0x65, 0x25, 0xD5, 0x5B, 0xF5, 0xB5, 0xE2, 0x04, 0x34, 0xE9, 0xF4, 0x1E, 0xFA, 0xBF, 0xE2, 0x02,
+    0x5E, 0xE7, 0xA2, 0x48, 0xBA, 0x8E, 0x6F, 0x71, 0xB0, 0x6B, 0x9B, 0x14, 0x5D, 0x1F, 0x74, 0x82,
+    0x9D, 0x8D, 0x57, 0xAC, 0x38, 0xE9, 0xD8, 0xA6, 0x82, 0x50, 0x0E, 0x74, 0x6D, 0x52, 0x19, 0xC6,
+    0x77, 0x01, 0x74, 0xD6, 0x35, 0x82, 0xF8, 0xEA, 0x58, 0x10, 0xDF, 0xCD, 0x58, 0x15, 0x27, 0x70,
+    0x2E, 0x27, 0xFF, 0x07, 0x7C, 0xFF, 0x90, 0x3F, 0xD6, 0x24, 0xC9, 0x85, 0x24, 0x99, 0xCE, 0xF0,
+    0xE6, 0xA1, 0xBD, 0x39, 0xC9, 0xA5, 0x97, 0xFA, 0xA7, 0xCE, 0x87, 0xAF, 0x64, 0xE1, 0x5C, 0xCC,
+    0xE8, 0x49, 0x46, 0x21, 0x9C, 0x38, 0x18, 0x4A, 0x06, 0x85, 0x9A, 0x13, 0xC6, 0x05, 0x26, 0x60,
+    0xFB, 0xE4, 0x5C, 0x4C, 0xD3, 0x64, 0x48, 0xCE, 0x56, 0xCC, 0x56, 0x73, 0x00, 0x5D, 0x79, 0x51,
+    0x51, 0x2E, 0xFB, 0xD4, 0x39, 0x29, 0x0F, 0x08, 0x92, 0x76, 0x91, 0x87, 0xB2, 0x3E, 0xF7, 0xE4,
+    0x82, 0x3F, 0xE0, 0xE1, 0x80, 0x4E, 0x0A, 0xD2, 0x5F, 0x86, 0x62, 0x9F, 0xA1, 0x6F, 0x31, 0x61,
+    0x24, 0x63, 0xCD, 0x1B, 0xD6, 0x6B, 0x0E, 0x74, 0x66, 0xAD, 0x09, 0x3A, 0x1D, 0x05, 0xF6, 0x0E,
+    0x05, 0xAB, 0x54, 0x44, 0x1F, 0xF4, 0x0A, 0xBA, 0x71, 0x56, 0xAC, 0x39, 0x74, 0xAB, 0x8E, 0x18,
+    0x67, 0xE3, 0x6B, 0xB1, 0x60, 0xA1, 0x44, 0x8C, 0xB3, 0x41, 0xC7, 0xEB, 0xB3, 0x22, 0x23, 0x9E,
+    0xE9, 0x38, 0xB4, 0xEE, 0xF3, 0xC7, 0x92, 0x7C, 0x23, 0x89, 0xF6, 0x8C, 0x91, 0x11, 0x35, 0x73,
+    0x41, 0x59, 0xC7, 0xA5, 0xB8, 0xB6, 0x75, 0xE5, 0x46, 0xD2, 0x49, 0xD8, 0x53, 0x73, 0x90, 0xBB,
+    0xAA, 0x58, 0x6E, 0xAF, 0x20, 0x10, 0xF3, 0x6D, 0xEF, 0x6B, 0xB9, 0x40, 0xF8, 0xCF, 0x42, 0x44,
+    0x98, 0x00, 0xE0, 0xDE, 0x76, 0x55, 0x8B, 0xCD, 0xB6, 0x21, 0x63, 0xFF, 0x38, 0xDD, 0x77, 0xAA,
+    0xEF, 0x1C, 0x21, 0xEC, 0x33, 0x54, 0xE1, 0x57, 0x8F, 0x0B, 0x6A, 0x0E, 0xD0, 0x51, 0x0E, 0x40,
+    0x87, 0x26, 0x4B, 0x0D, 0x9D, 0x0E, 0xE5, 0x8E, 0xDF, 0xF6, 0x26, 0xC9, 0xFA, 0x4B, 0xFE, 0xE6,
+    0x20, 0xD1, 0xF3, 0x11, 0xFC, 0x53, 0x92, 0xBA, 0x80, 0x91, 0x11, 0x2D, 0x6F, 0xC8, 0x17, 0x77,
+    0xAB, 0x5C, 0x65, 0xBD, 0x11, 0xA8, 0x8F, 0x3F, 0xA9, 0x7E, 0xE6, 0x93, 0xE3, 0x02, 0xD8, 0x8C,
+    0x4A, 0x18, 0x02, 0x11, 0x86, 0x19, 0xA8, 0xF6, 0xF7, 0x1F, 0x21, 0x17, 0xCB, 0xB5, 0xDF, 0xD1,
+    0x5D, 0x8F, 0xF9, 0xDB, 0x52, 0x9C, 0xF3, 0xAE, 0x7F, 0x4F, 0x27, 0xFE, 0xAE, 0x38, 0x01, 0x67,
+    0x51, 0x52, 0xB0, 0xFE, 0x26, 0x87, 0x63, 0x29, 0xD8, 0x8F, 0xF1, 0x4B, 0xB9, 0x7F, 0x67, 0xA6,
+    0xFA, 0x20, 0xE1, 0x92, 0xBE, 0x69, 0xDD, 0xC8, 0xB5, 0x66, 0xC6, 0xE9, 0x9B, 0xC7, 0xEF, 0x9E,
+    0x8E, 0x1B, 0x99, 0xA0, 0xE6, 0x00, 0x23, 0xEC, 0x02, 0xE3, 0xD1, 0xE4, 0xE3, 0x2F, 0xEB, 0x15,
+    0x15, 0x27, 0xF4, 0xE1, 0xF8, 0xCB, 0x30, 0x4C, 0x30, 0x42, 0xB6, 0x47, 0xCF, 0x77, 0x51, 0x38,
+    0x0F, 0x68, 0x93, 0xAC, 0x9F, 0x05, 0x9E, 0x41, 0xB7, 0x8A, 0x1F, 0xEC, 0xD8, 0xF7, 0x1B, 0x56,
+    0x58, 0x28, 0x60, 0x74, 0xA8, 0x0A, 0x9A, 0x36, 0x0A, 0xCA, 0x08, 0x61, 0xD6, 0x0B, 0x2F, 0xB9,
+    0x29, 0x44, 0x45, 0xED, 0x01, 0xCD, 0x01, 0x2D, 0x87, 0xC2, 0xAF, 0x2F, 0x69, 0xA7, 0x99, 0xD1,
+    0xAF, 0x42, 0x79, 0x02, 0x7E, 0x1D, 0x7F, 0xE7, 0x7B, 0xD8, 0x39, 0xF4, 0x0E, 0x9D, 0x83, 0x5E,
+    0xA0, 0x56, 0x80, 0x1E, 0x7D, 0x3C, 0x3A, 0x64, 0x55, 0x26, 0x87, 0xD1, 0x03, 0xD6, 0xCB, 0xDC,
+    0x79, 0xF6, 0xE4, 0xCD, 0xFD, 0x45, 0x5A, 0x05, 0x68, 0x13, 0x0A, 0xA1, 0xA5, 0x0F, 0x8A, 0xC2,
+    0xDE, 0x1D, 0x97, 0xF2, 0x2C, 0x38, 0x75, 0x6B, 0xCD, 0xA1, 0x3C, 0x2B, 0xE7, 0x43, 0xA7, 0xC8,
+    0x59, 0x47, 0xE9, 0x8B, 0x98, 0x6A, 0xE6, 0x41, 0xEE, 0xA5, 0x22, 0xCA, 0x92, 0x24, 0xE8, 0x14,
+    0xAC, 0x83, 0x5D, 0xCA, 0xC2, 0x02, 0xBA, 0xE2, 0x1B, 0x32, 0x51, 0x56, 0x9C, 0xCA, 0x2A, 0xA6,
+    0x08, 0x25, 0xEE, 0x22, 0xBE, 0x20, 0xC1, 0x16, 0xC6, 0xBB, 0x7E, 0xB2, 0xE5, 0x52, 0x49, 0x5B,
+    0x45, 0xBF, 0x0A, 0x84, 0x3C, 0x68, 0x0A, 0x0D, 0x70, 0xC3, 0xC4, 0x25, 0x32, 0xB9, 0x77, 0x94,
+    0x50, 0x85, 0x13, 0x0A, 0x4F, 0xA8, 0xC4, 0xE2, 0x18, 0x8F, 0x05, 0xE3, 0xD5, 0x80, 0xFB, 0xA0,
+    0x12, 0xCC, 0x5C, 0x73, 0xEA, 0x57, 0x70, 0x69, 0x33, 0x7A, 0x5F, 0x11, 0xD5, 0xC1, 0xD1, 0xDD,
+    0x17, 0xF7, 0x6E, 0x93, 0x58, 0x47, 0x47, 0xD0, 0x35, 0x19, 0xE3, 0x52, 0x73, 0xE8, 0x83, 0xA0,
+    0x77, 0x3F, 0xE5, 0x15, 0x1D, 0xCB, 0x2B, 0xEB, 0x4F, 0x7B, 0xA5, 0x5B, 0x65, 0xE2, 0x1A, 0x97,
+    0x8D, 0x24, 0x24, 0x19, 0x39, 0x37, 0x5C, 0x76, 0xE4, 0xB4, 0x4B, 0x68, 0x87, 0xA3, 0x40, 0x42,
+    0xCB, 0x33, 0x19, 0xA5, 0x56, 0x62, 0x16, 0xE3, 0xD0, 0x7A, 0xA4, 0xDB, 0xAA, 0x96, 0x3B, 0x1A,
+    0xF5, 0xDD, 0xFB, 0x43, 0x04, 0xC0, 0x1E, 0xFD, 0x96, 0x01, 0x0B, 0x8A, 0x70, 0xE7, 0x07, 0xA6,
+    0xBB, 0x80, 0xDF, 0x3F, 0xE5, 0x03, 0x77, 0xE5, 0x6C, 0x5B, 0x0F, 0xDC, 0x77, 0x7E, 0x57, 0x86,
+    0x1E, 0x25, 0x37, 0x4A, 0x00, 0xCC, 0xF1, 0xDC, 0xE8, 0xF4, 0x21, 0x00, 0x9B, 0x80, 0x96, 0x11,
+    0xB0, 0x6F, 0x04, 0xB4, 0xAB, 0xF6, 0x18, 0x87, 0xF6, 0x38, 0x4D, 0xAC, 0x0F, 0xE5, 0x60, 0x8A,
+    0xDB, 0x19, 0x8E, 0xCB, 0x5D, 0x63, 0x8E, 0x36, 0xA1, 0xD4, 0xFB, 0x4F, 0xBE, 0xDD, 0xCE, 0xE5,
+    0xAF, 0xBB, 0xBC, 0x5D, 0xA6, 0x46, 0x27, 0xA7, 0xD7, 0xD1, 0x03, 0x23, 0x77, 0x94, 0x26, 0xBD,
+    0xA2, 0x8F, 0xE8, 0x56, 0x8C, 0x01, 0x7D, 0xA8, 0xB8, 0xC0, 0x78, 0xC5, 0x09, 0xC6, 0x6B, 0x02,
+    0x66, 0x31, 0x11, 0x18, 0x67, 0xEB, 0x01, 0xFB, 0x5D, 0xCE, 0x00, 0xAF, 0x72, 0x00, 0xF8, 0x66,
+    0x06, 0x2A, 0x5E, 0x5C, 0x21, 0xEB, 0x05, 0x6A, 0xD2, 0xA3, 0xF4, 0xFC, 0x28, 0x5E, 0x8F, 0x40,
+    0x93, 0x75, 0x02, 0xDA, 0xD4, 0x66, 0x40, 0xC7, 0x86, 0x80, 0x8E, 0x8A, 0x43, 0x09, 0x99, 0xBB,
+    0x15, 0x74, 0x85, 0xFC, 0x65, 0x3C, 0x46, 0x0F, 0xE3, 0x4F, 0xB4, 0x2C, 0x01, 0x40, 0x93, 0xB0,
+    0x25, 0x1B, 0xD0, 0x1E, 0x00, 0xFA, 0x19, 0x5B, 0x65, 0xB2, 0xE4, 0x23, 0xA7, 0xCE, 0x6D, 0x11,
+    0xB5, 0x94, 0x20, 0x6F, 0xA3, 0x3D, 0x34, 0xC7, 0x5E, 0x71, 0x2D, 0x61, 0x7C, 0x4B, 0xE8, 0xD8,
+    0x12, 0x4D, 0x6E, 0x89, 0x9A, 0x4F, 0x10, 0xE0, 0x55, 0x02, 0xE6, 0x13, 0x02, 0x9A, 0x2C, 0x63,
+    0xAC, 0x2E, 0x18, 0x6E, 0x06, 0x4C, 0xA2, 0x83, 0x5E, 0xCD, 0x8A, 0x26, 0x35, 0x44, 0x4D, 0x70,
+    0x16, 0x5E, 0x86, 0xF1, 0x8A, 0x43, 0xB7, 0xC2, 0xFA, 0x13, 0x91, 0x6E, 0xD8, 0xCE, 0x5A, 0xA5,
+    0x5D, 0x3D, 0x37, 0x1F, 0xEF, 0x49, 0x01, 0xD0, 0xFB, 0x9A, 0x4E, 0xC7, 0x9A, 0x4E, 0xB1, 0xA6,
+    0xAB, 0xF8, 0x2C, 0x9D, 0x30, 0xDE, 0xFA, 0x0F, 0xE9, 0xA0, 0x6F, 0x48, 0x0B, 0x95, 0x43, 0x45,
+    0x2E, 0x80, 0x65, 0x2C, 0x0C, 0x3E, 0xCD, 0xD1, 0x43, 0x65, 0x9D, 0x51, 0xF1, 0x11, 0x3A, 0x58,
+    0x67, 0x02, 0x8C, 0x6F, 0x64, 0xB4, 0xCE, 0x4D, 0x96, 0x92, 0xCD, 0xE9, 0x43, 0x19, 0x5F, 0x35,
+    0x87, 0x52, 0xF2, 0x2C, 0xCD, 0x5A, 0xC7, 0xE2, 0x71, 0x34, 0xB9, 0x38, 0xD9, 0x16, 0x14, 0xDC,
+    0xF5, 0xC9, 0x6E, 0x95, 0x5B, 0x71, 0xC7, 0x93, 0x77, 0xC6, 0x14, 0x64, 0x6C, 0xC9, 0xAC, 0x48,
+    0x0E, 0x82, 0x13, 0x9D, 0x79, 0x49, 0xC6, 0x99, 0x9D, 0x51, 0x71, 0x80, 0x8A, 0xC0, 0xE6, 0xFA,
+    0xA7, 0xCE, 0xDD, 0x7D, 0xAE, 0x1F, 0x17, 0x59, 0x36, 0x6E, 0x9B, 0xEB, 0xEB, 0x52, 0x2F, 0xDF,
+    0x7E, 0xB6, 0x65, 0xE3, 0xF8, 0x92, 0x71, 0xB7, 0xAF, 0x82, 0xBE, 0xCB, 0x0B, 0x5B, 0x8F, 0xDB,
+    0x6D, 0xC7, 0xA8, 0x8A, 0xC5, 0x7E, 0xDA, 0x31, 0x74, 0x94, 0x8B, 0xEC, 0xC9, 0xD5, 0x90, 0xA1,
+    0x60, 0x8A, 0xD8, 0x91, 0x08, 0x47, 0x07, 0xD8, 0x09, 0xA0, 0xAC, 0xCE, 0x92, 0xFA, 0xED, 0x0F,
+    0x25, 0xE9, 0x38, 0xB1, 0xEA, 0x76, 0xE1, 0xE7, 0x5C, 0x85, 0xAB, 0xBB, 0x45, 0x52, 0xDB, 0x00,
+    0x51, 0x19, 0x90, 0x3E, 0x01, 0x33, 0x48, 0x0E, 0xA9, 0xD7, 0xD3, 0x2F, 0xA1, 0x5B, 0xF5, 0x8A,
+    0x3E, 0x74, 0x1E, 0xC6, 0x1B, 0x07, 0xE3, 0xCD, 0x00, 0xB3, 0x7C, 0xE5, 0x4E, 0x64, 0xD5, 0x95,
+    0x99, 0xA2, 0x92, 0x96, 0xBA, 0xA1, 0xDC, 0xD1, 0xDB, 0x91, 0xD5, 0xF8, 0xD3, 0x91, 0xD5, 0xB0,
+    0x55, 0x1A, 0xCE, 0xDD, 0xBF, 0x07, 0x5E, 0x49, 0xE8, 0x56, 0xEB, 0x6A, 0x3E, 0xE9, 0x61, 0x3E,
+    0x4C, 0x50, 0x34, 0x83, 0x00, 0xE4, 0xE9, 0x6E, 0x31, 0xD9, 0xCF, 0x1B, 0xBB, 0x55, 0x9C, 0xE4,
+    0x06, 0x9E, 0x7C, 0xDF, 0xCF, 0xED, 0xC5, 0xA7, 0xD0, 0xAD, 0x3A, 0x34, 0xA9, 0x65, 0xCD, 0x47,
+    0x39, 0xD1, 0x8D, 0xCE, 0xF8, 0xD3, 0xC3, 0xCF, 0xE9, 0xC5, 0x7F, 0x33, 0x4F, 0xDD, 0xAB, 0xF9,
+    0x58, 0x52, 0x6C, 0xB3, 0xA2, 0xCE, 0x8A, 0x6D, 0x6C, 0x72, 0x75, 0xF0, 0x73, 0x79, 0xAA, 0xCA,
+    0xE5, 0x4A, 0xED, 0x5C, 0xAE, 0x24, 0x1E, 0x7F, 0xF2, 0xFB, 0xD2, 0x66, 0xA8, 0xA5, 0x10, 0x86,
+    0x9A, 0x09, 0x0D, 0x03, 0x34, 0x3D, 0x2A, 0x46, 0x61, 0xB0, 0x9C, 0x66, 0xE9, 0x2A, 0xDC, 0x3E,
+    0xDE, 0x90, 0xAC, 0x49, 0x4E, 0x24, 0x67, 0x43, 0x06, 0x54, 0xE7, 0xA0, 0x23, 0x74, 0x84, 0x5E,
+    0xD1, 0x05, 0xF4, 0xBE, 0x84, 0x2A, 0xE3, 0x82, 0x71, 0x86, 0x7D, 0x17, 0x8C, 0x60, 0xAA, 0x98,
+    0x5B, 0x2E, 0x96, 0x83, 0x25, 0x4C, 0x46, 0x9F, 0xD0, 0xC6, 0xBB, 0x7C, 0x0E, 0x00, 0xCE, 0xBE,
+    0x78, 0x3C, 0x58, 0x71, 0x47, 0x84, 0xDA, 0x56, 0xD2, 0x95, 0xDB, 0x96, 0x70, 0x01, 0xA9, 0xCC,
+    0x5C, 0xD1, 0xA3, 0x89, 0xE8, 0x39, 0xC0, 0x3A, 0xC5, 0x15, 0x7A, 0x85, 0xA1, 0x03, 0xA7, 0x86,
+    0x09, 0x5D, 0xC0, 0xC8, 0xA5, 0x22, 0xDA, 0x9B, 0xC2, 0x8A, 0x7B, 0x2A, 0xA8, 0x0C, 0x1D, 0x38,
+    0x99, 0xB9, 0x62, 0x1B, 0x9B, 0x88, 0xDE, 0x8F, 0xB3, 0x75, 0x35, 0x55, 0xD6, 0x11, 0x66, 0xE9,
+    0x3D, 0x27, 0x95, 0x2A, 0x3E, 0x19, 0x30, 0x3A, 0x7D, 0x83, 0x68, 0x23, 0xF8, 0xB6, 0x07, 0x5D,
+    0x43, 0xA9, 0xEF, 0x71, 0x01, 0x07, 0xC5, 0x84, 0xCE, 0xA3, 0xA3, 0xAB, 0x09, 0x30, 0xC2, 0x2C,
+    0xD0, 0x9C, 0x54, 0xDE, 0xBA, 0x3F, 0xCE, 0xBE, 0x58, 0x56, 0x47, 0xBD, 0xA5, 0x1B, 0x4D, 0xDC,
+    0xAD, 0x3A, 0x00, 0xF0, 0xEB, 0x03, 0x6C, 0xCB, 0x49, 0x45, 0xCB, 0x49, 0xDF, 0x22, 0x31, 0xF2,
+    0x7C, 0xAA, 0xB9, 0xF4, 0xA1, 0x25, 0xEC, 0x6C, 0x42, 0xCD, 0x81, 0x4E, 0x17, 0x16, 0xD2, 0x4F,
+    0x4B, 0x6F, 0x71, 0x67, 0x7A, 0xFB, 0xE9, 0xB6, 0xCB, 0xF1, 0x87, 0xDC, 0xE5, 0xCE, 0x63, 0xC7,
+    0xDB, 0x14, 0x40, 0x0B, 0xAD, 0xB8, 0xC4, 0xB9, 0x1D, 0x56, 0x55, 0xC7, 0x3E, 0x43, 0xFF, 0x15,
+    0x33, 0xCC, 0x75, 0xC6, 0x8A, 0xC9, 0x86, 0x96, 0x93, 0x9D, 0xFB, 0x58, 0x73, 0xE0, 0xDC, 0x26,
+    0x45, 0x98, 0x42, 0x51, 0x9A, 0xD5, 0x11, 0x12, 0x32, 0x9B, 0x45, 0xB1, 0xE2, 0xA0, 0x63, 0x1B,
+    0x31, 0xEE, 0x80, 0x13, 0x31, 0xEA, 0xF1, 0x74, 0x71, 0x2E, 0xD9, 0xAE, 0x0E, 0xA5, 0x9E, 0xA2,
+    0xD6, 0x23, 0x38, 0xAD, 0x7E, 0x01, 0x5F, 0x01, 0x60, 0x9C, 0x99, 0x81, 0x8A, 0x9D, 0x47, 0x09,
+    0xC5, 0x36, 0x42, 0x62, 0xCD, 0xF9, 0x3F, 0x20, 0xE7, 0xAC, 0x5F, 0xC4, 0xD3, 0x85, 0xEA, 0xA0,
+    0x3D, 0x87, 0x12, 0x51, 0x1B, 0x0E, 0x27, 0x88, 0x0E, 0xD5, 0x37, 0x01, 0xDB, 0x72, 0x82, 0x79,
+    0x83, 0x2B, 0xF4, 0x2D, 0x12, 0x0D, 0x7F, 0xC2, 0xB9, 0xE6, 0xD2, 0x07, 0x58, 0xDF, 0x26, 0x98,
+    0x20, 0x0C, 0x01, 0xBA, 0x46, 0x9A, 0x9B, 0x07, 0x89, 0xE8, 0xD3, 0x9D, 0x7F, 0x48, 0xAC, 0x76,
+    0xE2, 0x8F, 0x52, 0x22, 0xEB, 0x8E, 0xC5, 0xCF, 0xF3, 0x2E, 0x52, 0xE3, 0x80, 0x5F, 0x1D, 0xBA,
+    0x1F, 0xE4, 0x8E, 0x8F, 0xC5, 0xEE, 0x2F, 0x18, 0xEF, 0x7F, 0x34, 0x93, 0x0B, 0x0C, 0xBF, 0x95,
+    0xA1, 0xE8, 0x46, 0x8F, 0x31, 0x28, 0xA2, 0x25, 0xCC, 0x02, 0xCE, 0x4D, 0xDA, 0x3A, 0x2A, 0x27,
+    0x1D, 0xD1, 0x85, 0xD2, 0x82, 0xB9, 0xC2, 0xF8, 0x8A, 0x83, 0x30, 0x62, 0xC7, 0x45, 0x11, 0x4D,
+    0x82, 0xF1, 0xC7, 0x7B, 0x36, 0x75, 0x02, 0x8C, 0xDB, 0xDD, 0x28, 0xDC, 0x76, 0xA3, 0x36, 0x5B,
+    0x8E, 0x76, 0xA9, 0xE5, 0x46, 0x19, 0x0F, 0x3E, 0x29, 0x37, 0xCA, 0x3A, 0x33, 0x57, 0x6C, 0x52,
+    0x13, 0xD1, 0x79, 0xB3, 0x58, 0x57, 0xB3, 0xA6, 0x5E, 0x61, 0x16, 0x1D, 0x38, 0xA9, 0x04, 0xBE,
+    0x19, 0x30, 0xBA, 0x26, 0x11, 0x6D, 0x84, 0xA1, 0x07, 0xA7, 0x9A, 0x19, 0x3A, 0xA0, 0xE3, 0x0C,
+    0x0E, 0x90, 0x2F, 0x6F, 0xE5, 0x46, 0x99, 0x08, 0xB3, 0x40, 0x71, 0x52, 0xA9, 0x98, 0x45, 0x08,
+    0xD6, 0xDB, 0x44, 0xD8, 0x25, 0xC9, 0xDD, 0xDC, 0xED, 0xB9, 0xDB, 0x96, 0x2C, 0xFC, 0xE2, 0xC6,
+    0xC9, 0x89, 0x3E, 0x91, 0x9A, 0x4E, 0x72, 0x2C, 0x4D, 0x5F, 0x46, 0x80, 0x5D, 0x4A, 0xEF, 0x29,
+    0x0A, 0x99, 0x56, 0x02, 0xCE, 0x86, 0x3C, 0xC9, 0xC2, 0xAA, 0xA4, 0x77, 0x8B, 0xDC, 0xF8, 0x21,
+    0x14, 0x3E, 0xF2, 0x3C, 0x26, 0x8C, 0x2B, 0x4C, 0x54, 0x9C, 0x30, 0xFA, 0x3E, 0x02, 0x74, 0x9C,
+    0xA1, 0xF8, 0x18, 0x01, 0x9D, 0x84, 0x07, 0x65, 0x17, 0x80, 0x57, 0x38, 0x40, 0x51, 0x47, 0xA0,
+    0x8B, 0xC6, 0x03, 0x76, 0xA1, 0x83, 0xE2, 0x63, 0x1C, 0xD0, 0x47, 0x9D, 0x01, 0x2E, 0xD2, 0xDF,
+    0x67, 0xD2, 0xD6, 0x84, 0x33, 0x95, 0x0E, 0x12, 0x96, 0xD4, 0xF1, 0x88, 0x89, 0x72, 0x6A, 0x7F,
+    0x5F, 0x4A, 0x52, 0x5A, 0x4E, 0xA6, 0x04, 0x95, 0xA7, 0x0F, 0x24, 0xC7, 0x69, 0x0B, 0x71, 0x04,
+    0x63, 0xB6, 0x41, 0xE7, 0x8A, 0x97, 0xE9, 0x74, 0x34, 0x01, 0xBC, 0x42, 0xE8, 0x38, 0x2E, 0xE0,
+    0xD5, 0x0C, 0x1D, 0xED, 0x5C, 0xF1, 0xF9, 0x04, 0x13, 0xC6, 0xA5, 0x61, 0xC3, 0x8A, 0x8B, 0xC9,
+    0x52, 0x8E, 0x14, 0xA6, 0x7D, 0x77, 0xC4, 0xF4, 0x3F, 0x8B, 0x33, 0x13, 0x70, 0x09, 0x23, 0x50,
+    0xF3, 0x62, 0xD8, 0x52, 0x3F, 0xB9, 0x93, 0xF5, 0xBF, 0x1D, 0x3E, 0xD5, 0xFD, 0x58, 0x67, 0x86,
+    0xD3, 0x53, 0x15, 0x11, 0xA1, 0x6F, 0x5A, 0x21, 0x3F, 0x28, 0xA6, 0x63, 0xCC, 0x8C, 0x5F, 0xA0,
+    0xDD, 0x70, 0xF6, 0x85, 0xC3, 0x01, 0xE8, 0x82, 0x75, 0x80, 0x0E, 0xA3, 0x03, 0x74, 0x30, 0x0E,
+    0x68, 0xBD, 0x99, 0x80, 0x66, 0xE9, 0x6E, 0xEF, 0xC2, 0xEC, 0x38, 0x6F, 0xBE, 0x26, 0xC6, 0x13,
+    0x67, 0x13, 0xEB, 0x89, 0xB7, 0xC1, 0xAC, 0x68, 0x08, 0x71, 0x37, 0xB1, 0x9F, 0x22, 0xA0, 0x53,
+    0x45, 0x07, 0xC5, 0xC1, 0x2E, 0x00, 0x9D, 0x58, 0x50, 0x3C, 0x4E, 0x11, 0x68, 0xB3, 0xE0, 0xAD,
+    0x83, 0xD8, 0x50, 0x7C, 0x4E, 0x8C, 0x58, 0x9C, 0xAE, 0xDD, 0xF9, 0xDB, 0x8A, 0x62, 0xC6, 0xE2,
+    0x76, 0x1B, 0xCD, 0xE7, 0xEC, 0x0B, 0x87, 0x13, 0x54, 0xEE, 0x02, 0xC0, 0xE7, 0x12, 0xD0, 0x2F,
+    0x1C, 0xD0, 0x84, 0xDE, 0x01, 0xAB, 0xDA, 0x65, 0xF5, 0xA7, 0x0F, 0x36, 0x06, 0x7B, 0x2B, 0x8C,
+    0x66, 0x12, 0x18, 0xB3, 0x0D, 0xC2, 0xD3, 0xAA, 0x04, 0x30, 0x09, 0x85, 0x7B, 0x54, 0x58, 0x53,
+    0x5B, 0x77, 0x79, 0xC5, 0xA9, 0x4D, 0x30, 0x01, 0xE3, 0xD2, 0x10, 0x0D, 0x2B, 0x2E, 0xC2, 0x3D,
+    0xAA, 0x48, 0x42, 0x0C, 0x5C, 0x8C, 0xB4, 0x95, 0x8D, 0x4E, 0x1F, 0x6E, 0xA5, 0xFB, 0x9A, 0xC3,
+    0x8E, 0x8F, 0x8B, 0xDB, 0x92, 0xBE, 0x42, 0xDF, 0x6A, 0xC8, 0x50, 0x04, 0x37, 0x84, 0xBD, 0xE5,
+    0xCF, 0x67, 0xE8, 0x58, 0x73, 0x6A, 0x32, 0x46, 0x5F, 0x73, 0xE8, 0x56, 0xD0, 0xB5, 0xB9, 0x64,
+    0xB8, 0xB1, 0xA1, 0x6B, 0xB6, 0xEA, 0x8B, 0xC3, 0xC6, 0x03, 0x74, 0xD2, 0xA6, 0xD2, 0xA6, 0x86,
+    0x50, 0x1C, 0xE8, 0x40, 0xD7, 0xAF, 0x92, 0x8C, 0x76, 0x2B, 0x38, 0xB7, 0x09, 0x7D, 0x14, 0x20,
+    0x8D, 0x0E, 0x5C, 0x80, 0xFA, 0x70, 0x10, 0xCE, 0xE5, 0xF6, 0x63, 0xA7, 0xC2, 0x75, 0x86, 0x94,
+    0x3D, 0xED, 0x13, 0x11, 0xE6, 0x2D, 0x42, 0xDF, 0xE2, 0xD4, 0x90, 0x73, 0xCD, 0x1B, 0xF7, 0x82,
+    0x41, 0x98, 0x84, 0x3A, 0xFE, 0x4D, 0x72, 0xD6, 0x72, 0xB1, 0x5D, 0xA9, 0x84, 0x04, 0xE1, 0x3B,
+    0x1B, 0x7F, 0x3E, 0x4B, 0x8D, 0x6C, 0x5C, 0x1A, 0x4A, 0x4B, 0x3F, 0x5D, 0x9B, 0x41, 0xA7, 0x53,
+    0x45, 0x37, 0xC6, 0x6A, 0xA3, 0x71, 0x3B, 0x55, 0x48, 0x7B, 0x11, 0x4D, 0x6E, 0x93, 0x5C, 0xA8,
+    0x4E, 0x8A, 0x62, 0x2B, 0x1D, 0x2B, 0xBA, 0x6E, 0x05, 0xE7, 0x3E, 0xC0, 0x7A, 0xE3, 0x85, 0x78,
+    0x7D, 0x82, 0xA2, 0xD9, 0xEE, 0xEA, 0xA3, 0x9D, 0xDF, 0x62, 0xA4, 0x71, 0x38, 0x72, 0xA6, 0xD3,
+    0x13, 0xEC, 0x13, 0x11, 0xFA, 0x27, 0x74, 0xA0, 0x5D, 0xD1, 0x91, 0x43, 0xCD, 0x1B, 0xF7, 0xC2,
+    0xA4, 0xC2, 0xA5, 0xB8, 0x7B, 0x4E, 0xA4, 0x7F, 0x46, 0x4E, 0xB4, 0x6B, 0x57, 0x9F, 0xCB, 0xF1,
+    0xB9, 0xB5, 0x8D, 0xAD, 0x47, 0x18, 0xC4, 0x57, 0x70, 0x66, 0x42, 0x13, 0xDA, 0x15, 0x30, 0xD7,
+    0x7E, 0x36, 0xC9, 0x74, 0x63, 0xFC, 0x25, 0x88, 0x19, 0x85, 0x00, 0x67, 0xFC, 0xF9, 0x0C, 0x45,
+    0xD8, 0x45, 0x0C, 0xD9, 0xA6, 0xC2, 0xFC, 0xCB, 0x02, 0x44, 0x88, 0x2C, 0x42, 0xB7, 0xF1, 0x53,
+    0xDC, 0x71, 0x76, 0xDE, 0xB8, 0xD8, 0x59, 0xAC, 0x09, 0xCE, 0xC6, 0x8B, 0x39, 0x05, 0x52, 0xE9,
+    0x56, 0x70, 0xAE, 0x39, 0xB4, 0x94, 0xAC, 0x44, 0x11, 0x8A, 0x13, 0x1E, 0xC0, 0xE9, 0x03, 0x15,
+    0x55, 0x44, 0xF7, 0x21, 0x01, 0x4B, 0x07, 0x45, 0x0F, 0xF4, 0xBB, 0xD4, 0xE2, 0x17, 0x63, 0xC8,
+    0x07, 0x5E, 0x28, 0x58, 0x61, 0xB7, 0x16, 0x5E, 0xD0, 0x2E, 0xCA, 0x3C, 0x56, 0x62, 0x16, 0x2A,
+    0xA4, 0x53, 0x45, 0x8F, 0xC6, 0x83, 0xCB, 0xE7, 0xA7, 0x86, 0x10, 0x59, 0x1D, 0xD8, 0x42, 0x66,
+    0xD9, 0x88, 0xF4, 0x4B, 0x59, 0x7E, 0xB5, 0xCC, 0x0E, 0x4B, 0xE1, 0x1E, 0x35, 0x1C, 0x4A, 0xCA,
+    0x51, 0xE0, 0xC0, 0x2F, 0x0C, 0x2D, 0x31, 0x92, 0x6B, 0x45, 0x51, 0xDE, 0x59, 0x71, 0x9A, 0x79,
+    0xD8, 0x6E, 0xE1, 0x86, 0xF0, 0x1C, 0xA1, 0x3C, 0xC7, 0x06, 0xFB, 0xE9, 0x6F, 0x4A, 0x23, 0xE6,
+    0x48, 0xC2, 0x90, 0x43, 0x1F, 0x1B, 0x27, 0x75, 0xA1, 0x49, 0x64, 0x5F, 0x34, 0x17, 0xE9, 0xF8,
+    0x10, 0x40, 0x70, 0x33, 0x92, 0x5D, 0xEE, 0x43, 0x1F, 0xDA, 0x1F, 0xDB, 0x23, 0x21, 0x98, 0xCF,
+    0x1F, 0x09, 0xC1, 0x9C, 0x79, 0xB9, 0x14, 0x7C, 0x35, 0x57, 0x81, 0x69, 0xF5, 0xAA, 0x3D, 0xEC,
+    0x89, 0xA6, 0xAD, 0x5F, 0x92, 0x3D, 0xAA, 0xC3, 0x09, 0x95, 0xD0, 0x8D, 0x50, 0xF1, 0x29, 0x5F,
+    0xB1, 0x4E, 0xC8, 0xE8, 0xDD, 0x2F, 0xD0, 0x1E, 0x22, 0xFC, 0xB2, 0xCA, 0x52, 0xA5, 0xB7, 0x8E,
+    0x39, 0xC5, 0xE9, 0x9F, 0x09, 0x6A, 0x6C, 0x97, 0x72, 0x84, 0x46, 0xF8, 0xB4, 0x83, 0xA8, 0xF3,
+    0x6C, 0x62, 0x41, 0xAE, 0xFC, 0xD9, 0x71, 0x0B, 0x11, 0x4D, 0x38, 0xC2, 0x72, 0xFF, 0x18, 0x7D,
+    0xAC, 0x48, 0x2E, 0x8D, 0x34, 0xAD, 0x70, 0x11, 0x1A, 0x08, 0x12, 0x80, 0x66, 0xDD, 0xAC, 0xA9,
+    0xB7, 0x79, 0xE5, 0x5F, 0x10, 0xA8, 0x18, 0x36, 0xE7, 0xAD, 0xFE, 0x0C, 0x18, 0x19, 0x44, 0xE8,
+    0x89, 0xA1, 0x65, 0xE5, 0xDB, 0x24, 0x24, 0x93, 0x96, 0x0E, 0xAA, 0x98, 0x0A, 0x23, 0x1D, 0x1A,
+    0xCE, 0x52, 0x65, 0xB0, 0xCB, 0x1E, 0xEC, 0x7C, 0xE9, 0x4F, 0xE9, 0x2C, 0x39, 0x59, 0x66, 0x9C,
+    0x67, 0x00, 0x12, 0x50, 0xE5, 0x8D, 0x19, 0x28, 0x3F, 0x1D, 0x1D, 0x3A, 0x0E, 0xD0, 0x37, 0x00,
+    0x9C, 0x7E, 0x01, 0x2F, 0x43, 0xC5, 0x26, 0xA2, 0xCE, 0xBD, 0x2F, 0x9C, 0xB5, 0x91, 0x3B, 0xFA,
+    0xF8, 0x09, 0xD7, 0x68, 0x85, 0x89, 0xCA, 0x45, 0xBA, 0xF9, 0xB9, 0x7C, 0x7E, 0xAA, 0xA4, 0xD1,
+    0xF7, 0xA8, 0x99, 0xC4, 0x01, 0x60, 0x00, 0x60, 0xA5, 0x94, 0xE6, 0x8A, 0x77, 0xD4, 0x5C, 0x21,
+    0xFD, 0xE3, 0x62, 0x2F, 0x9D, 0x8E, 0x21, 0x54, 0x7F, 0x8C, 0x3E, 0x62, 0x24, 0x57, 0xE9, 0x72,
+    0x1E, 0xC9, 0xA9, 0x58, 0xEC, 0x7E, 0x00, 0x78, 0x19, 0x67, 0xA7, 0x36, 0xB4, 0x2B, 0xCC, 0x95,
+    0x8C, 0x4A, 0xA2, 0xA4, 0x05, 0x18, 0xB7, 0xC9, 0xEE, 0xEC, 0x9E, 0xB8, 0x48, 0x27, 0xAE, 0x1B,
+    0x60, 0x7D, 0x57, 0x2A, 0x8E, 0x4B, 0xE9, 0xC5, 0x36, 0x9C, 0xC4, 0x68, 0x0D, 0x23, 0xC4, 0x6A,
+    0x5A, 0xC8, 0xEA, 0xA7, 0xD0, 0x26, 0x5C, 0xFA, 0x53, 0xBA, 0xD2, 0x37, 0x99, 0x71, 0x9A, 0x1C,
+    0x24, 0x0F, 0xEE, 0x48, 0x7A, 0x4B, 0xF2, 0x0A, 0xC9, 0xAC, 0x49, 0x86, 0xFB, 0x9F, 0xCA, 0x02,
+    0x0A, 0xFE, 0x6C, 0x1C, 0x7F, 0xF4, 0xC5, 0x22, 0x3B, 0x1C, 0xFF, 0x58, 0x38, 0xBF, 0x16, 0x94,
+    0xE2, 0xD8, 0xDB, 0xB7, 0x9A, 0x41, 0x1D, 0x00, 0x74, 0x4B, 0x29, 0x53, 0xC8, 0xAA, 0x43, 0x08,
+    0x48, 0xD4, 0x70, 0xDE, 0x96, 0xC7, 0x82, 0xCD, 0xF4, 0x22, 0xBC, 0x63, 0x1D, 0x2C, 0xA3, 0x21,
+    0xAF, 0x92, 0xEB, 0x3F, 0xE6, 0xE1, 0x60, 0x16, 0x34, 0xE9, 0xB6, 0x3A, 0x68, 0xC5, 0x01, 0xFD,
+    0xAE, 0x0E, 0xAA, 0x78, 0x1D, 0x86, 0xBE, 0x26, 0xD1, 0x72, 0x41, 0x3F, 0xA1, 0x59, 0xE5, 0xAC,
+    0x09, 0xE8, 0x80, 0x91, 0x68, 0x38, 0xC3, 0xBC, 0x0B, 0xE0, 0x01, 0x9C, 0x7E, 0x01, 0x04, 0x07,
+    0xB0, 0xF3, 0xA8, 0x8F, 0x35, 0xB9, 0x0F, 0xC7, 0x03, 0xBF, 0xBF, 0x6F, 0x53, 0x01, 0xB8, 0x7F,
+    0x38, 0xB6, 0x4E, 0xF6, 0x0B, 0xF4, 0xB5, 0x15, 0x75, 0x1C, 0xC5, 0x6E, 0xAD, 0x68, 0x86, 0x38,
+    0x25, 0xBD, 0x52, 0x9C, 0x6A, 0x7B, 0xF3, 0x45, 0x29, 0x38, 0x8C, 0x73, 0x39, 0x1A, 0xDD, 0x26,
+    0xBF, 0x35, 0x49, 0xF6, 0x57, 0x13, 0xC7, 0x51, 0xCD, 0xEC, 0xA1, 0x48, 0xA0, 0xA7, 0x2F, 0x1E,
+    0x7D, 0xDF, 0xDF, 0xFC, 0x5A, 0xEB, 0xD2, 0xFE, 0x19, 0x61, 0xC8, 0xA5, 0x22, 0x39, 0x54, 0x4F,
+    0xE5, 0x73, 0x7F, 0xC3, 0x6B, 0x95, 0xFE, 0x5A, 0x2B, 0xEC, 0xA2, 0xDE, 0xA3, 0x25, 0x9D, 0xF0,
+    0x57, 0xD7, 0x33, 0x7C, 0xFF, 0x40, 0x65, 0xA0, 0x0B, 0x38, 0x65, 0x7F, 0x34, 0x18, 0x12, 0xE4,
+    0xDA, 0x90, 0x73, 0xC5, 0x01, 0xED, 0x11, 0x73, 0x41, 0xF1, 0x3A, 0x34, 0x23, 0x7A, 0x7A, 0xF4,
+    0x9C, 0xB6, 0xCE, 0x80, 0x53, 0x40, 0x93, 0x6A, 0x0F, 0x30, 0x67, 0x48, 0x78, 0xA8, 0x7E, 0x60,
+    0x57, 0xE0, 0x02, 0xFE, 0xCD, 0xC9, 0x44, 0x72, 0x82, 0x75, 0x7D, 0x28, 0xF5, 0x20, 0x3A, 0xE3,
+    0xD1, 0xAD, 0xC2, 0xE5, 0x19, 0x17, 0x18, 0x2F, 0xA8, 0x38, 0x1D, 0x46, 0xAF, 0x23, 0x9A, 0x5C,
+    0xD1, 0xC1, 0xCE, 0xBD, 0xB0, 0xAD, 0x4E, 0x7E, 0x60, 0x1A, 0x17, 0x98, 0xD0, 0x4A, 0x20, 0x32,
+    0x63, 0xF4, 0x6D, 0x42, 0x9B, 0x61, 0xA5, 0xA6, 0x3A, 0x8C, 0xAB, 0xF0, 0xD8, 0x6A, 0x92, 0x73,
+    0x91, 0x7E, 0xE9, 0xB8, 0xE2, 0x18, 0x27, 0xAB, 0x74, 0xF3, 0xDB, 0xAD, 0x9B, 0xBF, 0x7F, 0x9C,
+    0x0E, 0x6B, 0x75, 0x2C, 0x02, 0x3A, 0xC9, 0xCD, 0xA9, 0x8F, 0x65, 0xDA, 0x77, 0x81, 0xF9, 0xDA,
+    0xAC, 0x08, 0x13, 0xF4, 0x5A, 0xD1, 0x99, 0x45, 0x13, 0x74, 0x76, 0x55, 0xBC, 0xCE, 0x59, 0x33,
+    0x11, 0x1D, 0xDF, 0x89, 0xE8, 0x92, 0xF6, 0x42, 0xFE, 0x2B, 0x3D, 0x03, 0xBA, 0x24, 0x3A, 0x1E,
+    0xD0, 0xCC, 0x9F, 0x52, 0x5B, 0x55, 0xFB, 0xFB, 0x03, 0x3A, 0x66, 0xE1, 0xF5, 0xD7, 0x3C, 0x4E,
+    0x46, 0x3E, 0x09, 0x3A, 0xF4, 0xC7, 0x58, 0x4D, 0x7D, 0xD0, 0x11, 0xDC, 0x59, 0x6E, 0xD5, 0x11,
+    0x76, 0x31, 0x5E, 0x71, 0xE0, 0xD4, 0x45, 0x95, 0x41, 0xAF, 0x63, 0xCB, 0xC9, 0x64, 0x26, 0x90,
+    0x6F, 0xFB, 0x8A, 0xD9, 0xB8, 0x8A, 0x33, 0xB7, 0xA6, 0xF4, 0x17, 0xF1, 0xFB, 0xA5, 0xA9, 0xB5,
+    0xE2, 0x2B, 0xEB, 0x66, 0x2C, 0x43, 0x77, 0x47, 0x4F, 0xEB, 0xA7, 0xC8, 0x58, 0xD2, 0xD3, 0x3A,
+    0xF4, 0x13, 0xF8, 0x4A, 0x14, 0x44, 0xA5, 0x66, 0x06, 0xAA, 0x4B, 0xD3, 0xDF, 0x93, 0x63, 0x89,
+    0x80, 0x12, 0x03, 0x00, 0x73, 0xD1, 0x01, 0x6A, 0xB9, 0x00, 0xE0, 0xE1, 0xC6, 0x01, 0xEA, 0x66,
+    0xDC, 0xA2, 0x11, 0x61, 0xC3, 0x7F, 0x2A, 0x87, 0x66, 0x37, 0x03, 0x35, 0x97, 0x22, 0x74, 0xF4,
+    0xAA, 0x9E, 0x44, 0xFC, 0xA8, 0xB9, 0x15, 0x80, 0xF6, 0x84, 0xCE, 0xC5, 0x2F, 0xDA, 0x03, 0xAB,
+    0xC3, 0x33, 0x2F, 0xA1, 0x64, 0xFC, 0x7A, 0x35, 0x33, 0xD0, 0xCF, 0x1C, 0x80, 0xF1, 0xD1, 0x88,
+    0x13, 0x39, 0xFF, 0x31, 0x1B, 0x8A, 0x35, 0x54, 0xF9, 0x8D, 0xEA, 0x04, 0x59, 0xB1, 0xD4, 0xFD,
+    0x74, 0x44, 0xB3, 0x91, 0x15, 0xBB, 0x88, 0x36, 0x95, 0x36, 0xFB, 0xFE, 0x36, 0x5E, 0xE4, 0x5A,
+    0xD8, 0x7A, 0x76, 0x63, 0x47, 0x8E, 0x1E, 0x76, 0x86, 0x5D, 0xC4, 0x98, 0x18, 0x43, 0xC3, 0xA9,
+    0x10, 0x76, 0x7B, 0x32, 0x6D, 0x22, 0x57, 0x95, 0x70, 0x45, 0x8A, 0x3D, 0xCF, 0xBC, 0xF8, 0xF4,
+    0x01, 0x6A, 0xEA, 0x08, 0x8C, 0xAF, 0x13, 0xD0, 0x7E, 0x9C, 0xA0, 0x56, 0x3D, 0x03, 0x5F, 0xAD,
+    0x4F, 0xE0, 0xFB, 0x8A, 0xE8, 0x82, 0xA0, 0xBD, 0x9B, 0xEC, 0x9D, 0x22, 0xDA, 0x63, 0x9D, 0x5D,
+    0x11, 0x74, 0x52, 0xB2, 0xE8, 0x83, 0x68, 0x04, 0xF4, 0xAB, 0x40, 0x05, 0x2A, 0x63, 0xF4, 0x30,
+    0x8B, 0x26, 0x14, 0x6B, 0x81, 0x2D, 0x12, 0x14, 0x39, 0x3A, 0xF1, 0x51, 0x8C, 0xC1, 0xB8, 0x62,
+    0xD9, 0x4F, 0x85, 0xBB, 0xB5, 0x01, 0x45, 0xE1, 0x11, 0x23, 0x76, 0xFA, 0x3D, 0x22, 0xA5, 0x23,
+    0xBC, 0x81, 0x23, 0xC9, 0xD2, 0x63, 0x39, 0xF1, 0x89, 0xCA, 0x4D, 0x9B, 0x60, 0x7C, 0xEF, 0x2B,
+    0x4E, 0x74, 0x77, 0x01, 0x6A, 0xFB, 0x55, 0x47, 0x70, 0x36, 0x4B, 0x43, 0x70, 0x32, 0x51, 0xB1,
+    0xE6, 0xA2, 0x69, 0x39, 0x18, 0x7E, 0x12, 0x31, 0xF2, 0x1B, 0x5E, 0xCC, 0x72, 0x9F, 0xDA, 0xD5,
+    0x30, 0x42, 0x91, 0x9B, 0x3C, 0xEA, 0xC0, 0x6E, 0x38, 0x6C, 0x94, 0x88, 0x63, 0x55, 0x37, 0xB4,
+    0x02, 0x4E, 0xD5, 0x94, 0x33, 0xB4, 0x6F, 0x06, 0xE9, 0xAB, 0x35, 0x45, 0x3E, 0xEC, 0x8E, 0xE2,
+    0x1B, 0x38, 0x61, 0x74, 0x30, 0xD7, 0x85, 0x7F, 0x94, 0x38, 0x55, 0x74, 0xE0, 0x9B, 0x2B, 0x4C,
+    0x44, 0x17, 0x38, 0x29, 0x3A, 0x45, 0xBD, 0xC2, 0x46, 0x8C, 0x0B, 0x27, 0xCD, 0xB9, 0x8D, 0x7A,
+    0xAD, 0x99, 0xC0, 0xC9, 0x4E, 0xE6, 0xFA, 0xDC, 0x87, 0x76, 0x6D, 0x6E, 0x26, 0x45, 0x58, 0xC7,
+    0x7E, 0x1E, 0xE7, 0x36, 0x76, 0x7F, 0x95, 0x74, 0x84, 0xBD, 0x92, 0xFA, 0x99, 0x43, 0x1B, 0xC7,
+    0xCB, 0xA9, 0xF7, 0xB0, 0x6F, 0xAC, 0xDD, 0xB5, 0x8C, 0x76, 0x65, 0x95, 0x46, 0x07, 0xFB, 0xAD,
+    0xA5, 0x7B, 0x7B, 0x45, 0x73, 0x2B, 0x56, 0x89, 0x03, 0x46, 0x4E, 0x1D, 0x3D, 0x1A, 0x86, 0x8A,
+    0x09, 0x18, 0x89, 0x4E, 0x52, 0x91, 0x8A, 0x01, 0x18, 0x23, 0x3A, 0xCA, 0x45, 0x0B, 0xB4, 0x5B,
+    0x1F, 0x0E, 0x80, 0xE4, 0x6A, 0x25, 0x92, 0x42, 0x1B, 0x39, 0x00, 0x75, 0x56, 0x11, 0xC0, 0x38,
+    0xDC, 0xAE, 0x1C, 0x22, 0xA2, 0x1A, 0xD7, 0xD7, 0x9A, 0xB3, 0x8E, 0x9C, 0x4C, 0x02, 0xBF, 0xB1,
+    0x36, 0x9C, 0x7B, 0xCF, 0x29, 0x27, 0x95, 0xDB, 0xB5, 0x7B, 0x7B, 0xB6, 0xB3, 0x7D, 0x2E, 0x26,
+    0x1D, 0xDB, 0xD5, 0x7C, 0xE3, 0xBB, 0x1C, 0xEC, 0xF3, 0x3E, 0x19, 0xDF, 0xAE, 0xD4, 0xD7, 0x12,
+    0xC6, 0x6F, 0xCD, 0xC9, 0xBA, 0xE6, 0x56, 0xD4, 0x6F, 0x07, 0x8C, 0x76, 0xCA, 0x44, 0x43, 0xAF,
+    0x39, 0x63, 0xCC, 0x60, 0x44, 0x43, 0xA7, 0x39, 0xC1, 0x44, 0xD0, 0x43, 0x04, 0x3D, 0x24, 0x0F,
+    0x45, 0xB7, 0x25, 0x0A, 0xDD, 0xC7, 0x44, 0xC5, 0x3A, 0xDD, 0xD6, 0x92, 0xF2, 0x4B, 0xD0, 0x85,
+    0x92, 0x13, 0x43, 0x27, 0xE8, 0x20, 0x01, 0x74, 0x3F, 0xC9, 0x40, 0x45, 0x15, 0x81, 0x6E, 0x3E,
+    0x29, 0xB8, 0xF7, 0xA9, 0x95, 0xFF, 0x00, 0x70, 0xA9, 0xF1, 0x50, 0xD1, 0xCC, 0xE8, 0x3C, 0x07,
+    0x98, 0xE7, 0xE2, 0x6D, 0xE2, 0x25, 0xBF, 0x0C, 0xDB, 0x8A, 0xA2, 0x4D, 0xB3, 0x63, 0x4E, 0xD4,
+    0xDC, 0x55, 0x80, 0x4E, 0xC4, 0x73, 0xA2, 0x26, 0xA6, 0x37, 0xCD, 0x62, 0x5F, 0x91, 0x8C, 0xB8,
+    0x7F, 0x7F, 0x8C, 0x28, 0x60, 0x56, 0x97, 0xB7, 0x26, 0x0E, 0x4D, 0x00, 0x2D, 0xB7, 0xFE, 0x04,
+    0x25, 0x9A, 0x7A, 0x5B, 0x1F, 0x58, 0xCD, 0xB9, 0xE8, 0xFD, 0xCA, 0xF8, 0xA0, 0xDF, 0xB2, 0xBD,
+    0x71, 0x2D, 0xD2, 0x77, 0x53, 0x4F, 0x72, 0x6E, 0x45, 0xB4, 0x84, 0x52, 0x6F, 0x3A, 0x3C, 0x90,
+    0x9C, 0xBC, 0x61, 0xB1, 0x6A, 0xBF, 0x94, 0x26, 0xB8, 0x1D, 0x6A, 0xC8, 0x92, 0xC4, 0x92, 0x1C,
+    0xCE, 0x1C, 0xD2, 0x8B, 0x39, 0x1A, 0x0E, 0x92, 0x57, 0x98, 0x55, 0xCE, 0xAA, 0xDE, 0xBA, 0xFE,
+    0x75, 0xDA, 0x64, 0x00, 0x16, 0xA0, 0x27, 0xBD, 0x22, 0x89, 0x51, 0x80, 0x8B, 0xBC, 0x03, 0xCE,
+    0xCD, 0xBC, 0x65, 0x27, 0x6D, 0xDE, 0x4D, 0xA8, 0xBF, 0xFE, 0x69, 0x32, 0x4E, 0x35, 0x48, 0xA5,
+    0x5F, 0x1D, 0x07, 0x92, 0xAB, 0x83, 0x93, 0xA6, 0xE9, 0xC9, 0x45, 0x93, 0xA1, 0x3E, 0xB4, 0x51,
+    0x2C, 0xD3, 0x25, 0xB1, 0x81, 0xCE, 0x72, 0x46, 0xED, 0x31, 0x69, 0x04, 0xF9, 0x91, 0x56, 0x73,
+    0x90, 0x74, 0x23, 0xB9, 0x74, 0xC2, 0x54, 0x7D, 0x19, 0x67, 0x27, 0xB4, 0xA1, 0x0D, 0x80, 0x11,
+    0x19, 0x49, 0x0E, 0x80, 0xE6, 0x8C, 0x63, 0xA0, 0xC4, 0x31, 0xC3, 0xA8, 0xA3, 0xBE, 0x9C, 0x86,
+    0xA4, 0xDF, 0x2C, 0xD3, 0xCA, 0x88, 0xDE, 0x01, 0xB7, 0x9A, 0x3B, 0x5D, 0x83, 0xA3, 0x8E, 0xA0,
+    0xD2, 0xD8, 0xE8, 0x37, 0x4B, 0x4A, 0xB5, 0x58, 0x3E, 0x14, 0x37, 0x53, 0x96, 0x2F, 0x91, 0x16,
+    0x19, 0x6E, 0x32, 0x78, 0x52, 0xB8, 0xC2, 0xD9, 0xA9, 0x7A, 0x11, 0xC6, 0x8D, 0x0E, 0xE3, 0xD7,
+    0xA3, 0x40, 0x3C, 0x15, 0xE3, 0x76, 0xA4, 0xE3, 0x26, 0xAA, 0x8B, 0x5A, 0x5C, 0xC0, 0x03, 0xAF,
+    0x6C, 0xA3, 0xA9, 0xDA, 0xF1, 0x29, 0xB8, 0x94, 0xA3, 0x59, 0x5F, 0xDC, 0x70, 0xA7, 0xA1, 0x67,
+    0x56, 0x1C, 0x4B, 0x73, 0xC7, 0x92, 0xE6, 0x4E, 0x00, 0x70, 0x6A, 0x0F, 0x80, 0xA8, 0xFE, 0x44,
+    0x40, 0x33, 0x02, 0x5D, 0xFE, 0xF2, 0x09, 0x15, 0xBA, 0x05, 0x77, 0x65, 0x37, 0xE1, 0x67, 0xB2,
+    0x9B, 0x9A, 0x74, 0xA2, 0x9D, 0x69, 0x6B, 0x7B, 0xB9, 0x43, 0xDE, 0xEE, 0xE8, 0xDB, 0x39, 0x97,
+    0x6B, 0xA6, 0xF4, 0xC4, 0x6D, 0x2D, 0x30, 0x76, 0x01, 0xF0, 0xF4, 0x34, 0x2E, 0xC6, 0xEB, 0xA0,
+    0x22, 0x22, 0x0E, 0x27, 0xB3, 0x36, 0x19, 0x9C, 0xCC, 0xDC, 0x78, 0xE0, 0xEC, 0x4B, 0x68, 0xB8,
+    0x54, 0x24, 0xC6, 0xB7, 0xD6, 0xCE, 0xF7, 0xD7, 0x56, 0x5C, 0x02, 0xB0, 0xD7, 0x05, 0x7D, 0x99,
+    0x39, 0x6B, 0xD2, 0x3F, 0xD3, 0xF1, 0x11, 0x7F, 0x7A, 0xC1, 0xFD, 0xFB, 0xFB, 0xE4, 0x2D, 0xF2,
+    0x22, 0x13, 0x44, 0x40, 0xF3, 0x2A, 0xC9, 0x9E, 0x8C, 0xFB, 0xFB, 0xFB, 0xC3, 0xEF, 0xE3, 0x81,
+    0x7E, 0xEA, 0xDE, 0xB8, 0x69, 0x67, 0xD2, 0x77, 0x5C, 0xF0, 0x3F, 0x1D, 0xE0, 0x94, 0x4A, 0xF6,
+    0x7A, 0xB6, 0x97, 0x0F, 0x00, 0xF4, 0x8F, 0xAC, 0xE3, 0x95, 0x68, 0xAF, 0xC6, 0xF1, 0xB1, 0xF5,
+    0x1E, 0x0C, 0x4F, 0x4F, 0x0C, 0x8C, 0x8F, 0xC5, 0x3A, 0x7E, 0x3E, 0x98, 0xD9, 0x00, 0x68, 0xDF,
+    0xD5, 0x7C, 0xFE, 0xBD, 0x8F, 0xFC, 0x43, 0xB1, 0x3B, 0x7F, 0xF1, 0x0A, 0xE7, 0xFE, 0x00, 0x4F,
+    0x3F, 0xFB, 0x72, 0xC5, 0x27, 0xA2, 0x4A, 0x9D, 0xD7, 0xC1, 0xB8, 0xDE, 0x65, 0x3C, 0x53, 0x05,
+    0x3C, 0x30, 0x9C, 0x7E, 0xC1, 0xC2, 0x0E, 0xD4, 0xA1, 0x22, 0x07, 0xC5, 0x80, 0x86, 0x03, 0x4E,
+    0x1F, 0x24, 0x7D, 0x39, 0xF6, 0xAF, 0xAF, 0xE6, 0x31, 0x3F, 0x9E, 0xDA, 0x3B, 0x33, 0xBD, 0xA4,
+    0x5F, 0x8F, 0xDD, 0xEB, 0x6B, 0xFF, 0x5C, 0x30, 0xCF, 0x79, 0xF3, 0xB8, 0x07, 0xF0, 0xC0, 0x9F,
+    0x1C, 0xD6, 0xEC, 0xBC, 0x0E, 0x76, 0x30, 0xCF, 0xC5, 0x2A, 0xEA, 0xB9, 0x99, 0x1F, 0xC6, 0x7D,
+    0x80, 0x05, 0x38, 0xFC, 0x3E, 0xCF, 0xBE, 0xFA, 0x0F, 0x1F, 0x7E, 0x06, 0xD1, 0x70, 0xD5, 0x5C,
+    0xAA, 0x4B, 0x03, 0xCE, 0x1E, 0x80, 0x04, 0xE9, 0x2D, 0xA3, 0x19, 0xCC, 0x93, 0x53, 0x33, 0xC3,
+    0xC2, 0x38, 0x33, 0x77, 0x5E, 0xAF, 0x4D, 0x54, 0xAC, 0x38, 0xDC, 0x3F, 0xA0, 0x26, 0xE8, 0xC6,
+    0xD9, 0x78, 0x1D, 0xDA, 0x55, 0xC5, 0x2A, 0x63, 0x1F, 0xE0, 0x78, 0xFD, 0x66, 0xB6, 0xDF, 0x7A,
+    0x67, 0xCD, 0xF7, 0xDF, 0xFD, 0x0D, 0x4F, 0x1F, 0x18, 0xDF, 0xF9, 0x76, 0x55, 0x11, 0xAF, 0x1D,
+    0x53, 0x83, 0xF6, 0x6A, 0x05, 0x50, 0xF9, 0xF6, 0x5B, 0xC9, 0xFA, 0xC6, 0x7D, 0x01, 0xF7, 0x02,
+    0x1A, 0x1D, 0xBA, 0xD4, 0xC7, 0x87, 0xF0, 0x20, 0xEE, 0xC3, 0xA9, 0xFD, 0x73, 0xE4, 0x0F, 0x0F,
+    0x2F, 0x0E, 0x78, 0x10, 0xF0, 0x68, 0x1C, 0xBE, 0x04, 0x04, 0x28, 0x87, 0x33, 0xC0, 0xD3, 0x93,
+    0x8E, 0x15, 0x27, 0xE3, 0xBB, 0xD4, 0x72, 0xB2, 0xB3, 0x96, 0xD9, 0x62, 0x88, 0xE6, 0xEA, 0xFC,
+    0x6A, 0xEB, 0x4C, 0xB5, 0x00, 0xD8, 0xAB, 0x96, 0x7A, 0x51, 0xF3, 0x98, 0x6C, 0xBA, 0x7F, 0x5F,
+    0xF3, 0x75, 0xFB, 0x82, 0x1E, 0x94, 0x83, 0x07, 0x00, 0x5F, 0xF9, 0x7F, 0x7C, 0xD3, 0xE4, 0x5F,
+    0xFB, 0x3F, 0x1B, 0x77, 0x7A, 0x00, 0x46, 0xDA, 0x8C, 0xA7, 0x87, 0x7E, 0xD1, 0x41, 0xC5, 0x8A,
+    0xB0, 0xFF, 0xAD, 0xBD, 0x46, 0x4F, 0xDF, 0x2F, 0x38, 0x7B, 0x60, 0x66, 0xE3, 0x8C, 0x1B, 0x9D,
+    0x75, 0x63, 0x36, 0xB9, 0xCB, 0xF5, 0x4B, 0xED, 0xCC, 0x6B, 0x7C, 0x32, 0x76, 0xF3, 0xDD, 0x54,
+    0xDA, 0xDB, 0x77, 0x35, 0x9F, 0x78, 0xEF, 0xA3, 0xE5, 0xAB, 0xEB, 0x76, 0x97, 0xF5, 0x6A, 0xAF,
+    0xA4, 0x6E, 0xC9, 0xD5, 0x1E, 0xEA, 0x15, 0x19, 0xA3, 0xAF, 0x13, 0xEC, 0x93, 0xBC, 0xC2, 0x85,
+    0x07, 0x4D, 0x18, 0x1B, 0x6F, 0x1C, 0x15, 0xDF, 0xE2, 0x13, 0x11, 0xA8, 0x5F, 0xE8, 0xDC, 0x25,
+    0x15, 0xB4, 0x1B, 0xEB, 0xA8, 0x17, 0x33, 0x9C, 0xC3, 0xA9, 0xFD, 0xFD, 0xFF, 0x8C, 0xCC, 0xFD,
+    0xE1, 0x2B, 0xDF, 0x5B, 0xF0, 0xE0, 0x43, 0x68, 0xAE, 0x38, 0x7C, 0xE7, 0x3E, 0x54, 0xF8, 0xF3,
+    0x7F, 0xA0, 0xFE, 0xBD, 0x7E, 0xF6, 0x3D, 0xD2, 0x3F, 0xF3, 0xC4, 0xF2, 0x15, 0x9C, 0xF9, 0x97,
+    0x6B, 0x13, 0xFB, 0x1F, 0x12, 0xA4, 0x6B, 0xE8, 0x61, 0x22, 0xF0, 0xC0, 0x8B, 0xD0, 0x74, 0x35,
+    0x33, 0xEC, 0x9B, 0xC1, 0x2C, 0xE6, 0x8D, 0x80, 0xF4, 0x00, 0xCE, 0x3C, 0xE9, 0xF4, 0xB5, 0x7C,
+    0xD1, 0x5B, 0x86, 0x96, 0x01, 0xE7, 0x0F, 0x80, 0xA7, 0x87, 0x8A, 0xB9, 0x22, 0x67, 0x5E, 0x8F,
+    0x23, 0xC6, 0x6E, 0x68, 0xDD, 0x4F, 0x1D, 0x24, 0xE7, 0x0C, 0x93, 0x61, 0x34, 0x8C, 0x86, 0xA4,
+    0x26, 0x79, 0x79, 0x7F, 0x7F, 0x7F, 0x38, 0xB5, 0xBF, 0x7F, 0x6E, 0x23, 0x69, 0x6E, 0xF3, 0xD2,
+    0x03, 0x87, 0x87, 0x2F, 0x8C, 0xA4, 0x7F, 0xFA, 0xF0, 0xF0, 0x00, 0xC0, 0x60, 0xE7, 0x87, 0x7B,
+    0x5E, 0xBC, 0x46, 0xC6, 0xD7, 0x3A, 0xB6, 0x93, 0xF4, 0x0F, 0x91, 0xFC, 0x0B, 0x92, 0x1D, 0x19,
+    0xEF, 0xDF, 0xDF, 0x2F, 0x08, 0x51, 0x91, 0x34, 0x14, 0xF9, 0xC1, 0x2B, 0x24, 0x8F, 0x7D, 0x2B,
+    0xFE, 0x63, 0x54, 0x11, 0x3A, 0xC3, 0xC6, 0x86, 0xB3, 0xC9, 0xB0, 0x0B, 0xCC, 0x80, 0xCF, 0x61,
+    0xC7, 0x81, 0xAA, 0x22, 0x4A, 0x30, 0xDF, 0x78, 0x00, 0xDA, 0x6D, 0x39, 0xB7, 0xD9, 0x4A, 0xB3,
+    0xBF, 0xF8, 0x77, 0x00, 0x41, 0xBB, 0xAF, 0xAA, 0xF9, 0xAB, 0xE6, 0xAA, 0xBF, 0x17, 0xA7, 0x80,
+    0x3D, 0x8F, 0x2F, 0x74, 0xA8, 0x7F, 0xB8, 0xE0, 0x21, 0x73, 0xF8, 0xCA, 0x15, 0xB9, 0x5C, 0x09,
+    0x99, 0x99, 0xF5, 0xE1, 0x2B, 0xF3, 0x82, 0x07, 0x7F, 0x03, 0xEA, 0xF5, 0x19, 0x7F, 0x64, 0xC8,
+    0x47, 0x0F, 0x0F, 0x5F, 0x68, 0xC2, 0xA5, 0xF6, 0xFA, 0xAD, 0xF7, 0xBE, 0xE6, 0x1F, 0x76, 0xFF,
+    0xE4, 0xB3, 0x9F, 0xF9, 0x4C, 0xFF, 0xB0, 0x5E, 0x5B, 0xDF, 0xF9, 0xAF, 0xC6, 0x2F, 0x7E, 0x11,
+    0xFF, 0xB5, 0x8A, 0x8D, 0x6B, 0xA7, 0xC6, 0xA9, 0xA5, 0xF6, 0x6A, 0xE9, 0xDD, 0x3F, 0xC2, 0xA9,
+    0xFD, 0xFD, 0x73, 0x56, 0xB4, 0xF4, 0x4B, 0xE0, 0x56, 0x1D, 0x1E, 0x1E, 0x3E, 0x4F, 0xF2, 0xEC,
+    0xE1, 0xE1, 0x8B, 0x0F, 0x1C, 0x18, 0xDF, 0x85, 0x76, 0xAD, 0x23, 0x5E, 0xAB, 0x0E, 0x27, 0x13,
+    0xDA, 0x54, 0x71, 0x30, 0x4E, 0x78, 0xC1, 0x77, 0xDE, 0x9A, 0xF1, 0xEB, 0x3C, 0xEF, 0x47, 0x3D,
+    0x7F, 0x5B, 0x5A, 0x33, 0xEB, 0xD5, 0x84, 0x34, 0x5E, 0xCD, 0xE6, 0x83, 0xD5, 0x3E, 0x97, 0xAC,
+    0xF6, 0xC6, 0x3D, 0x12, 0x31, 0xE8, 0x65, 0x7C, 0x34, 0xE9, 0x6C, 0x82, 0x71, 0x3B, 0x07, 0x38,
+    0x3C, 0x8C, 0x0F, 0x01, 0xDF, 0x79, 0x10, 0x08, 0x17, 0x00, 0x7F, 0x2F, 0xB0, 0xF7, 0xD7, 0x39,
+    0xC7, 0xD9, 0x47, 0x5F, 0x48, 0xFA, 0x4A, 0x18, 0xBB, 0xD7, 0xE3, 0xA8, 0x7F, 0xB8, 0x9A, 0x01,
+    0xC0, 0x98, 0xB9, 0xE8, 0xE1, 0x41, 0xF8, 0xC6, 0xA1, 0x02, 0xCE, 0xF9, 0x3D, 0x1B, 0xFE, 0x68,
+    0xE4, 0x6B, 0x0F, 0x99, 0xFC, 0xD9, 0x2F, 0x7C, 0x05, 0xCD, 0xAE, 0xF3, 0xA5, 0xF1, 0x50, 0x11,
+    0x20, 0x70, 0x06, 0x75, 0xAA, 0xAF, 0xF1, 0x2F, 0x3F, 0xFC, 0x98, 0xC1, 0x37, 0x01, 0xBF, 0x0E,
+    0x74, 0x33, 0xDA, 0x80, 0x3A, 0x8A, 0x98, 0xD0, 0xEF, 0x57, 0x07, 0x26, 0x5D, 0x68, 0xC9, 0xC9,
+    0x4B, 0x67, 0xA7, 0x99, 0xBE, 0xAD, 0x79, 0xB1, 0xFE, 0x4B, 0xCE, 0x0F, 0xD6, 0x0B, 0x80, 0x01,
+    0x7F, 0xFE, 0x9F, 0x54, 0xE4, 0x4C, 0xAE, 0xFA, 0x6B, 0x01, 0x07, 0xBF, 0x5B, 0x28, 0xBF, 0xB8,
+    0xD4, 0xA6, 0xC6, 0x7D, 0x09, 0x41, 0x39, 0xEB, 0xFA, 0x55, 0x65, 0xCE, 0xFD, 0xDA, 0x88, 0xD6,
+    0x88, 0xDE, 0x7E, 0xFF, 0xE7, 0xFF, 0x1B, 0xF4, 0x1E, 0xFE, 0x97, 0xFF, 0x0E, 0xA7, 0xF0, 0x59,
+    0xE0, 0xCF, 0x81, 0x5F, 0x01, 0x7E, 0x17, 0xF8, 0x22, 0xF0, 0x2B, 0xD8, 0xFB, 0x43, 0xE0, 0xB3,
+    0xA7, 0xCA, 0x3B, 0x0F, 0x00, 0xA5, 0xFD, 0x0C, 0x34, 0xE5, 0xB3, 0x2F, 0xFC, 0x21, 0xF0, 0xD9,
+    0x33, 0xF8, 0x43, 0xE0, 0x1F, 0x6C, 0x9F, 0x92, 0x6F, 0xC0, 0xFF, 0xFC, 0x9F, 0x02, 0x1E, 0xFF,
+    0xD5, 0xFF, 0x7E, 0x74, 0x14, 0xE9, 0xDA, 0xE8, 0x57, 0x45, 0x39, 0x07, 0xE8, 0xC1, 0x0E, 0x97,
+    0xDA, 0x0F, 0xD6, 0x00, 0x60, 0x78, 0x75, 0x9B, 0x03, 0x3D, 0x80, 0xFB, 0xD1, 0x70, 0xE9, 0x18,
+    0xCD, 0xBF, 0x4A, 0x5F, 0xC5, 0xC3, 0xAF, 0x5E, 0x7A, 0x18, 0x04, 0x08, 0xFC, 0x11, 0x3E, 0xF3,
+    0xC5, 0x87, 0xA3, 0x0E, 0xDA, 0x9B, 0xF5, 0x37, 0x7E, 0x13, 0xC0, 0xDE, 0x33, 0xE3, 0x37, 0x9C,
+    0x1D, 0x2E, 0xE1, 0x85, 0x2F, 0x62, 0xAD, 0x32, 0x5E, 0x6B, 0x43, 0x52, 0x03, 0x06, 0xE0, 0xE1,
+    0xC1, 0xA8, 0xA4, 0x5D, 0xF7, 0xFC, 0x77, 0xBA, 0x77, 0xDE, 0xEC, 0xBF, 0xF6, 0xC3, 0xFF, 0x0B,
+    0x7F, 0xFE, 0x9B, 0xA8, 0x96, 0x6E, 0x7A, 0xB5, 0x71, 0xAF, 0x8E, 0xCF, 0x2F, 0x7B, 0x47, 0x8B,
+    0x60, 0x75, 0x80, 0x7F, 0x5E, 0xFF, 0xBF, 0x8B, 0x5D, 0x9B, 0xA0, 0xDE, 0xC6, 0x7F, 0x39, 0x00,
+    0x68, 0x56, 0xFB, 0xF8, 0x07, 0xF9, 0x27, 0xEE, 0x3B, 0xDA, 0xFF, 0x86, 0xFA, 0xF7, 0xED, 0xF4,
+    0xC9, 0xF5, 0x1C, 0xC6, 0xE7, 0x03, 0xB0, 0x34, 0x43, 0x1F, 0xE9, 0xD5, 0xF4, 0x1B, 0xC0, 0x57,
+    0x00, 0xE0, 0xCC, 0xBF, 0x0C, 0x00, 0x54, 0xEC, 0x17, 0xE0, 0x34, 0xC1, 0x1B, 0xFB, 0x7F, 0x50,
+    0x1A, 0x4E, 0x17, 0x34, 0x45, 0xD2, 0xDA, 0xF2, 0x60, 0x7B, 0xF7, 0xD7, 0x03, 0x80, 0x66, 0x35,
+    0xA2, 0x01, 0xC2, 0x1B, 0xFB, 0x7F, 0xC0, 0x49, 0x71, 0x83, 0x19, 0xB8, 0x00, 0xA7, 0x6D, 0x3E,
+    0x00, 0x1E, 0x38, 0x3C, 0x3C, 0xFC, 0x1F, 0x49, 0x66, 0x4B, 0xF2, 0x2D, 0x92, 0xF1, 0xEC, 0xE1,
+    0xE1, 0xE1, 0x8B, 0x96, 0xE4, 0x35, 0x96, 0xE9, 0x2B, 0x0A, 0x7A, 0xB7, 0xD7, 0x32, 0x0F, 0x68,
+    0x1D, 0xC9, 0x7C, 0x98, 0xA5, 0xE5, 0xD3, 0x3F, 0x83, 0xD3, 0x64, 0xAE, 0x17, 0xE0, 0xF4, 0xE1,
+    0x04, 0xE0, 0xD4, 0xE1, 0x37, 0x85, 0x53, 0x26, 0x34, 0x40, 0xA9, 0xB0, 0xBF, 0x6F, 0x39, 0x2B,
+    0x1E, 0xA0, 0xA2, 0x33, 0x33, 0x80, 0xF1, 0xD9, 0x75, 0x07, 0x6C, 0xEC, 0x1E, 0xE2, 0x49, 0x95,
+    0x97, 0x2F, 0x0E, 0xA3, 0x7C, 0xFF, 0xFE, 0xFE, 0xFE, 0xFE, 0xBE, 0x94, 0x8F, 0xAB, 0x79, 0xA7,
+    0x79, 0x55, 0xDF, 0xFC, 0xDE, 0x2D, 0x1F, 0x2E, 0x5C, 0xF8, 0x52, 0xAF, 0x9F, 0x78, 0xC3, 0xD1,
+    0x9F, 0xBA, 0x0F, 0x00, 0xEC, 0x70, 0xC3, 0x7F, 0xE7, 0x82, 0x49, 0x7A, 0x4F, 0xCD, 0x83, 0xF5,
+    0xD5, 0x1E, 0x9A, 0x47, 0x17, 0x3C, 0xD8, 0xB5, 0xCF, 0xCD, 0xFE, 0xC2, 0x97, 0x2A, 0x00, 0xCD,
+    0xDA, 0x5F, 0x7A, 0xA8, 0xBB, 0xD0, 0x7D, 0xE7, 0x4B, 0x17, 0x2E, 0x98, 0x70, 0x6A, 0xF8, 0x82,
+    0x7E, 0xE2, 0xB1, 0x2B, 0x97, 0xBD, 0xFF, 0xCE, 0x85, 0x87, 0xBA, 0x5E, 0xDD, 0x72, 0xF7, 0xED,
+    0x01, 0xFD, 0x0F, 0x6F, 0x3E, 0x85, 0xEF, 0xD4, 0x4B, 0x7B, 0x59, 0xC7, 0x53, 0x03, 0x94, 0xC3,
+    0x05, 0xB4, 0xD3, 0xA5, 0xD0, 0x5B, 0xF5, 0x5D, 0x7F, 0xE1, 0x0B, 0xED, 0x73, 0xF3, 0x85, 0x0B,
+    0x8A, 0xEE, 0xD4, 0x7D, 0xA8, 0x67, 0x04, 0x3C, 0x88, 0xEE, 0xB5, 0xF6, 0x83, 0x2B, 0x3F, 0xF0,
+    0xFE, 0xC2, 0x85, 0x2F, 0x7D, 0x49, 0x3F, 0xF9, 0xD8, 0xE5, 0x61, 0x0F, 0x00, 0xFE, 0xD7, 0xBF,
+    0x5A, 0xF5, 0xF5, 0x5B, 0x2E, 0xBC, 0xFA, 0x60, 0xA7, 0x1F, 0x7B, 0x7D, 0xF1, 0x17, 0x1E, 0xEA,
+    0xDA, 0xE7, 0x5E, 0x5F, 0xC2, 0x7D, 0xF7, 0x9C, 0x02, 0xF0, 0xD0, 0x87, 0x7C, 0xDE, 0x3D, 0x0C,
+    0xAF, 0x5C, 0x87, 0x7B, 0x51, 0x0D, 0x9F, 0xAD, 0xF9, 0xC4, 0xFF, 0xDD, 0xE1, 0x8F, 0xEA, 0x59,
+    0x0F, 0xC6, 0xDD, 0x8F, 0x6F, 0x7F, 0xE9, 0xDB, 0x0F, 0x7E, 0x27, 0xFC, 0xB1, 0xFF, 0x17, 0xCE,
+    0x4C, 0x06, 0xF7, 0xA1, 0xB9, 0xB2, 0x3C, 0xB4, 0xD6, 0x19, 0xDA, 0xA9, 0x88, 0x5B, 0x73, 0xDF,
+    0x55, 0xC3, 0x1E, 0xF0, 0xC0, 0xC1, 0xAE, 0xAB, 0x24, 0x94, 0xCD, 0x0A, 0x0A, 0x66, 0xF4, 0xDA,
+    0x49, 0xDE, 0x92, 0xF0, 0xE2, 0xE3, 0x31, 0xC5, 0x11, 0xF3, 0xF1, 0xFE, 0xDE, 0xDD, 0xE3, 0xD2,
+    0xEF, 0xEF, 0xE3, 0xB8, 0x9E, 0x89, 0x88, 0x9A, 0xBC, 0x5C, 0x58, 0xF7, 0x77, 0xA1, 0xDE, 0x77,
+    0x51, 0x52, 0x81, 0xE3, 0x7A, 0x26, 0x46, 0x84, 0x66, 0x64, 0x9B, 0x1B, 0xA1, 0xAC, 0x73, 0x20,
+    0x49, 0x77, 0xFF, 0x53, 0x79, 0x7F, 0xEF, 0x4E, 0x49, 0x52, 0x91, 0xF9, 0xF8, 0xED, 0x01, 0x8A,
+    0xA2, 0x50, 0x29, 0xAD, 0xDD, 0x09, 0x7D, 0x7E, 0x85, 0xAE, 0x2D, 0xC2, 0xA3, 0x3A, 0x0A, 0x7A,
+    0x39, 0x2E, 0xA0, 0xEB, 0x83, 0xE0, 0x6F, 0x66, 0x55, 0xD4, 0x8C, 0xE0, 0x73, 0xCC, 0x18, 0x17,
+    0x66, 0xF4, 0xC1, 0x24, 0xEC, 0xE4, 0x63, 0xCF, 0xBC, 0xB4, 0x65, 0x78, 0x12, 0x28, 0x0F, 0xA5,
+    0x01, 0xE6, 0x44, 0x7A, 0x79, 0x17, 0xE1, 0x97, 0x62, 0x23, 0x09, 0xB1, 0xE7, 0x9F, 0xD9, 0x9E,
+    0x80, 0xBF, 0xB6, 0x3D, 0x61, 0xC5, 0x4F, 0xD7, 0xA7, 0x06, 0xA4, 0x51, 0xF6, 0x18, 0x19, 0x88,
+    0xCC, 0x30, 0x1C, 0x7A, 0x91, 0x4B, 0xD3, 0x79, 0x4B, 0x85, 0x8E, 0x89, 0xA0, 0xD8, 0xA2, 0xDB,
+    0x2B, 0xE2, 0xE3, 0x9B, 0x08, 0x8A, 0x3B, 0xD1, 0x66, 0x24, 0xAA, 0x27, 0xD6, 0x0B, 0x68, 0xD8,
+    0x1E, 0x31, 0x5E, 0x7C, 0x61, 0xBC, 0x74, 0x52, 0x87, 0x1E, 0x4E, 0x6C, 0x17, 0xC3, 0xDB, 0x58,
+    0x03, 0x5F, 0xF8, 0xBB, 0xB3, 0x06, 0x86, 0x9F, 0xCA, 0x1A, 0x38, 0x07, 0xB1, 0x8C, 0x9D, 0x15,
+    0x07, 0x1D, 0x61, 0x7C, 0x61, 0x99, 0x79, 0x81, 0xA8, 0xCB, 0x4B, 0xC2, 0x45, 0xAB, 0x8F, 0x5E,
+    0x6A, 0x32, 0xFA, 0x20, 0x42, 0xB5, 0x9B, 0x90, 0xEC, 0x6B, 0xDD, 0xD4, 0x44, 0xA2, 0xFF, 0x24,
+    0x62, 0x7C, 0x72, 0xC1, 0x8B, 0x67, 0x4F, 0x34, 0x15, 0x8D, 0xF3, 0xED, 0x5D, 0xCC, 0x6D, 0x3A,
+    0x56, 0x3B, 0x94, 0xDB, 0x73, 0xAC, 0x35, 0xDA, 0x2C, 0xB7, 0xBF, 0x69, 0x6B, 0x8D, 0xB6, 0x6E,
+    0xF7, 0xA6, 0x63, 0x7D, 0xBF, 0xC2, 0xD6, 0xB9, 0xA3, 0x77, 0x64, 0xD7, 0x1F, 0xCC, 0x9F, 0xDD,
+    0x63, 0x32, 0xFA, 0x32, 0xBA, 0x7E, 0x4A, 0x2F, 0xCA, 0x46, 0x03, 0xE2, 0x82, 0xFB, 0xC6, 0x24,
+    0xA4, 0xDD, 0x71, 0x6B, 0x54, 0x3E, 0xD6, 0xDB, 0xD7, 0x48, 0x7F, 0x13, 0x44, 0x57, 0x42, 0x1C,
+    0x5B, 0x52, 0xE1, 0x0D, 0x6B, 0xE9, 0x6E, 0xFC, 0x16, 0x27, 0x81, 0x3A, 0xFA, 0x20, 0x60, 0x97,
+    0x0C, 0xC7, 0x1D, 0x85, 0xDD, 0xCE, 0xE2, 0x67, 0x3A, 0x96, 0xD6, 0xEE, 0x02, 0xBD, 0xA0, 0x5B,
+    0x65, 0x64, 0x4A, 0x37, 0x28, 0xA5, 0xBE, 0x31, 0x8D, 0x2B, 0x54, 0x46, 0x1F, 0x6A, 0x3A, 0x8C,
+    0x73, 0x4D, 0x74, 0x11, 0xDB, 0x9D, 0x94, 0x9B, 0xD8, 0xAF, 0x30, 0x2B, 0xC6, 0xA5, 0x61, 0xF5,
+    0x14, 0xD1, 0xA6, 0xD3, 0xF4, 0x23, 0x17, 0x88, 0x26, 0xB7, 0x38, 0xF0, 0x30, 0x0A, 0x77, 0xD7,
+    0x35, 0xB2, 0xDB, 0xC1, 0xF1, 0x02, 0x50, 0xB7, 0xEE, 0xCA, 0xCD, 0xC5, 0x9D, 0x54, 0x69, 0x41,
+    0xDC, 0xDA, 0x0A, 0x4B, 0x67, 0xE1, 0xD6, 0x5C, 0xB8, 0x15, 0xDB, 0x37, 0x74, 0x4C, 0x10, 0x18,
+    0x92, 0x79, 0x40, 0x47, 0x6E, 0xBA, 0x1B, 0x1B, 0xA4, 0x43, 0xD2, 0xE9, 0xB4, 0xFF, 0x54, 0x7A,
+    0x8A, 0xD3, 0xB8, 0x60, 0xF4, 0x6D, 0xAE, 0x39, 0x89, 0xC0, 0x6D, 0x12, 0x06, 0x99, 0xF1, 0x30,
+    0xBE, 0xE6, 0x24, 0xB2, 0x1A, 0xA9, 0x11, 0xE9, 0x35, 0xDF, 0x07, 0x01, 0x41, 0x8A, 0x08, 0xA4,
+    0x92, 0x71, 0x38, 0xE8, 0x28, 0x6A, 0x7A, 0x7F, 0xB7, 0x19, 0xD0, 0x63, 0x24, 0xF3, 0x5D, 0x67,
+    0x40, 0xEC, 0x66, 0xC0, 0x45, 0x47, 0xF4, 0xA1, 0xBC, 0x32, 0x9D, 0x78, 0x05, 0x00, 0x0E, 0xA7,
+    0xDD, 0x34, 0x20, 0x9A, 0xF2, 0xC2, 0x02, 0x37, 0xF3, 0x9D, 0xEB, 0x2F, 0xA0, 0x57, 0x74, 0x11,
+    0x5D, 0x80, 0x09, 0xBB, 0x1E, 0xC8, 0x9A, 0x4E, 0x98, 0x93, 0x18, 0x17, 0x9D, 0x8A, 0x3C, 0x0B,
+    0xAC, 0xB3, 0x0B, 0xC0, 0xD7, 0xE9, 0x00, 0xBE, 0xC5, 0x8D, 0x87, 0x57, 0x97, 0x46, 0x4B, 0xF9,
+    0x6D, 0x23, 0xA0, 0xB2, 0x4E, 0x40, 0x93, 0xDB, 0x0C, 0xB4, 0x49, 0xDD, 0xB5, 0xDD, 0xB2, 0x0B,
+    0xE0, 0x82, 0x3E, 0x1C, 0xB5, 0x5B, 0x6E, 0x74, 0xC5, 0xFA, 0x10, 0xBB, 0x36, 0x5A, 0xD8, 0xE9,
+    0xA8, 0x9D, 0x43, 0xAA, 0x21, 0xCD, 0xED, 0x7B, 0x4D, 0x78, 0xF4, 0x19, 0xBD, 0x87, 0xC9, 0x30,
+    0x1E, 0x4C, 0x30, 0x4B, 0xCD, 0x08, 0x33, 0x2B, 0x46, 0x8C, 0x4E, 0x73, 0x85, 0x75, 0x1D, 0x03,
+    0xE8, 0xCC, 0xF5, 0x00, 0x4E, 0xF6, 0x5B, 0x1E, 0x7C, 0x84, 0xBD, 0xAF, 0xA8, 0x92, 0x59, 0x6A,
+    0xB6, 0xD1, 0xCC, 0x2A, 0x77, 0x7E, 0x74, 0x2A, 0x99, 0xC5, 0xBA, 0x26, 0x5A, 0x47, 0xD7, 0x26,
+    0x82, 0x53, 0x7B, 0x2B, 0x57, 0x1C, 0x34, 0x63, 0x45, 0x68, 0x86, 0x9A, 0xE8, 0xB8, 0xA8, 0x8C,
+    0x9E, 0x4E, 0x65, 0x18, 0x0E, 0x4D, 0x82, 0x11, 0x62, 0x7E, 0x3C, 0xA6, 0x6E, 0xDD, 0x06, 0x15,
+    0x81, 0x6E, 0xE9, 0x3C, 0x60, 0xDE, 0x17, 0xBE, 0x78, 0xD8, 0x41, 0xC8, 0xC7, 0xCB, 0x5B, 0xE8,
+    0xD7, 0x36, 0x02, 0x74, 0x5D, 0x40, 0x9B, 0x61, 0x96, 0x6D, 0x16, 0x1C, 0x64, 0x50, 0x35, 0x09,
+    0x9C, 0xA1, 0xD7, 0x26, 0x43, 0x38, 0x9D, 0xB0, 0x97, 0x39, 0xA1, 0xE2, 0x93, 0x11, 0x50, 0xD9,
+    0x0A, 0xB3, 0x7B, 0x87, 0x51, 0x1B, 0x01, 0xD3, 0xE2, 0xAE, 0x9D, 0xA4, 0x95, 0x26, 0xE4, 0x80,
+    0x52, 0xAA, 0xB4, 0x02, 0x94, 0xD1, 0x6D, 0xCD, 0x27, 0x9D, 0x54, 0xE6, 0x86, 0x6D, 0xD4, 0xE9,
+    0x55, 0x3A, 0xC4, 0x15, 0x07, 0xE9, 0xCB, 0xD0, 0x49, 0x86, 0x95, 0x8C, 0xEC, 0x36, 0x95, 0x39,
+    0xA3, 0x0F, 0x32, 0xCA, 0x04, 0x96, 0x97, 0x0E, 0xF2, 0xF2, 0xC1, 0x22, 0xF9, 0x28, 0x54, 0x62,
+    0xE3, 0x6B, 0x4E, 0x32, 0xBF, 0xB7, 0x27, 0x3E, 0xD8, 0x10, 0x8D, 0x08, 0x59, 0xAF, 0x38, 0x1A,
+    0x96, 0x83, 0x04, 0x9F, 0x45, 0x99, 0x46, 0x3C, 0xD7, 0xCE, 0xBB, 0xE6, 0x8E, 0xE3, 0x02, 0xE2,
+    0x67, 0x5E, 0x2A, 0x8B, 0x71, 0xEF, 0xCB, 0xF2, 0x6E, 0xA6, 0x92, 0x76, 0x02, 0xA8, 0x5E, 0x14,
+    0x9B, 0xF4, 0x42, 0xB3, 0xF3, 0x7D, 0xD2, 0x51, 0xC7, 0x9A, 0x6D, 0x02, 0xAF, 0x10, 0xF6, 0x07,
+    0xFC, 0x80, 0xDE, 0x4A, 0xE3, 0xE4, 0xA2, 0xF9, 0xFE, 0xA0, 0xB6, 0x4E, 0xE4, 0x7E, 0xC5, 0x7D,
+    0x0D, 0xBF, 0xFF, 0x1A, 0xCA, 0xE9, 0xCC, 0xB0, 0x9B, 0x54, 0xEC, 0xA9, 0xBD, 0x63, 0x24, 0x96,
+    0xEA, 0x22, 0x0F, 0xD1, 0x6E, 0x34, 0x18, 0xBC, 0xC2, 0xC3, 0x1D, 0x3F, 0xF0, 0x67, 0x09, 0x8E,
+    0x28, 0x56, 0x3B, 0x71, 0xE4, 0x3E, 0x1C, 0x15, 0xEA, 0xFA, 0x93, 0x1D, 0x15, 0xEB, 0xB1, 0x8E,
+    0x0A, 0x11, 0x1C, 0xD9, 0x09, 0x9D, 0xE8, 0x58, 0x56, 0x78, 0x72, 0xDA, 0x50, 0x48, 0x57, 0xE2,
+    0x9D, 0x82, 0xAB, 0x17, 0x22, 0x32, 0x38, 0xC9, 0xC0, 0xDF, 0x05, 0x3E, 0xBF, 0x7A, 0x20, 0x65,
+    0x06, 0x2D, 0xEC, 0xE9, 0x8C, 0xF6, 0xC0, 0x1E, 0x5F, 0x8F, 0xCE, 0x67, 0xE1, 0xB4, 0xCA, 0x54,
+    0x14, 0xA0, 0xF9, 0xAE, 0xD4, 0xBE, 0xCB, 0x6A, 0x54, 0xA1, 0x4F, 0x27, 0x95, 0x05, 0xC3, 0x46,
+    0x41, 0xFC, 0x2F, 0x06, 0xB4, 0xCC, 0x30, 0xCC, 0x20, 0x63, 0xCD, 0x1F, 0xBD, 0xDA, 0x70, 0x10,
+    0x3C, 0x5A, 0x7A, 0x55, 0x87, 0x9E, 0x1C, 0x0C, 0x09, 0xF3, 0xF1, 0xFE, 0x51, 0xFB, 0xEB, 0x8A,
+    0xA1, 0xE3, 0x45, 0xA7, 0x77, 0x5B, 0x3A, 0x72, 0x40, 0x35, 0x00, 0xA7, 0xFE, 0x0C, 0xB5, 0x80,
+    0xE3, 0x5F, 0x23, 0xA3, 0xCE, 0xA7, 0x17, 0xE3, 0x01, 0xCE, 0x50, 0x5C, 0xD0, 0x30, 0x14, 0x81,
+    0xC4, 0x80, 0x5A, 0x36, 0xE0, 0x81, 0xE2, 0x67, 0xA0, 0xA3, 0xF9, 0xEF, 0xE9, 0x49, 0x3E, 0x46,
+    0x86, 0x86, 0x59, 0x08, 0x77, 0xD5, 0x80, 0xD1, 0x29, 0x4E, 0x3A, 0xA1, 0xF7, 0xBB, 0xD6, 0xE7,
+    0xA3, 0x58, 0xA3, 0xFE, 0xEB, 0xC3, 0x90, 0x8A, 0x13, 0x70, 0xEF, 0x3D, 0x30, 0x9D, 0xEB, 0xDE,
+    0xF2, 0xED, 0x47, 0xB1, 0x8A, 0x19, 0xF7, 0xFD, 0xCA, 0xB1, 0x26, 0xB4, 0xDB, 0xFB, 0x6A, 0xEF,
+    0xD2, 0x67, 0xDB, 0xAF, 0x77, 0xF4, 0xD9, 0x96, 0x98, 0xB5, 0x89, 0x05, 0xB9, 0x2F, 0xE2, 0x13,
+    0xC7, 0x84, 0x9A, 0xEE, 0x10, 0x9D, 0xF8, 0x3B, 0x36, 0x23, 0x8F, 0x1E, 0x15, 0x17, 0x58, 0x3A,
+    0x58, 0x4E, 0xB0, 0x19, 0x18, 0x8F, 0xF3, 0x17, 0xB8, 0xF5, 0x06, 0x09, 0x44, 0x2F, 0x11, 0x84,
+    0xCE, 0x17, 0x33, 0x00, 0x95, 0xAB, 0x42, 0xE9, 0xB7, 0x0E, 0x80, 0x75, 0xE6, 0x56, 0x1E, 0x60,
+    0xBC, 0x26, 0x57, 0xE8, 0xB5, 0x21, 0x39, 0x35, 0xB1, 0xE6, 0xFB, 0xF4, 0x45, 0x57, 0x07, 0x9C,
+    0x8C, 0xAF, 0x39, 0x8C, 0xB3, 0x8E, 0xB0, 0xCE, 0x78, 0x45, 0x98, 0x8F, 0xB8, 0x82, 0xCB, 0xB8,
+    0x96, 0xF0, 0xDB, 0x64, 0xD4, 0x64, 0xD4, 0x09, 0xE8, 0x18, 0xB0, 0x77, 0xA2, 0x3D, 0x5D, 0x84,
+    0x6D, 0xA1, 0x63, 0x25, 0x52, 0xCE, 0x42, 0x95, 0x1D, 0x4A, 0x4F, 0xA9, 0xD4, 0x46, 0xC4, 0xD5,
+    0xDF, 0xB7, 0xF9, 0x65, 0x34, 0xB2, 0x37, 0x47, 0x2F, 0xFF, 0xC8, 0x42, 0xAF, 0x88, 0x71, 0xD1,
+    0xA9, 0x5B, 0x2B, 0x0E, 0xFD, 0x6A, 0xE7, 0x36, 0xC1, 0x7E, 0x8F, 0x43, 0xB7, 0x2A, 0xEA, 0x88,
+    0x31, 0x8C, 0xD1, 0x78, 0x90, 0xFC, 0x2E, 0x27, 0x90, 0xA9, 0x4D, 0x90, 0x11, 0x2F, 0x8E, 0xFD,
+    0xFF, 0xE3, 0x98, 0x6F, 0xFE, 0xC6, 0x63, 0x1E, 0x67, 0x5F, 0x3A, 0x91, 0x54, 0xB4, 0x71, 0xCB,
+    0xF9, 0xD4, 0x7A, 0x5B, 0x17, 0xA4, 0xCE, 0xA2, 0x94, 0xD0, 0xAD, 0x2D, 0x37, 0x79, 0x00, 0xC5,
+    0x41, 0x7A, 0x9D, 0xCC, 0x27, 0x12, 0x62, 0x39, 0xE9, 0xD8, 0x50, 0xD2, 0xC9, 0x72, 0x3D, 0x01,
+    0xE6, 0x07, 0x74, 0xE8, 0x82, 0x09, 0x68, 0x53, 0xBB, 0xEB, 0x8F, 0x70, 0xBD, 0xC4, 0x6E, 0x65,
+    0xA1, 0x46, 0xFD, 0xF2, 0x89, 0x0E, 0x02, 0xED, 0x0B, 0x2D, 0x06, 0xDD, 0x49, 0x16, 0xD1, 0xCF,
+    0x56, 0x4D, 0xBA, 0x2B, 0x39, 0xA1, 0xA2, 0x1B, 0x45, 0x19, 0x9F, 0x6B, 0xB3, 0x63, 0x11, 0xF5,
+    0x7C, 0x27, 0xA2, 0x4F, 0x7A, 0xD9, 0x58, 0x44, 0x4F, 0xE3, 0x81, 0x01, 0x75, 0xAA, 0x33, 0xD0,
+    0xAC, 0x9D, 0x07, 0x34, 0x39, 0x88, 0xC3, 0xDC, 0xAE, 0xEA, 0x8A, 0xA2, 0xE3, 0x70, 0x6C, 0x19,
+    0x6D, 0x13, 0x38, 0xA3, 0x0B, 0x8A, 0xC0, 0x38, 0xCB, 0xFE, 0x66, 0x74, 0x50, 0x59, 0x46, 0x8A,
+    0x59, 0x80, 0xFE, 0xAF, 0x08, 0xC0, 0xBE, 0xB9, 0x6E, 0xDB, 0x33, 0x14, 0x25, 0xB1, 0x9F, 0xB5,
+    0xAE, 0xF6, 0xA2, 0x89, 0xEC, 0x36, 0xFE, 0x6F, 0x55, 0xA4, 0x27, 0x00, 0x68, 0x21, 0x3C, 0x49,
+    0xF2, 0x36, 0x1F, 0x67, 0x6B, 0x1C, 0xEF, 0x93, 0x4B, 0x77, 0xF4, 0xC9, 0xDD, 0x95, 0x30, 0xD4,
+    0xB0, 0x12, 0xBD, 0x7C, 0xC5, 0xA5, 0xDB, 0xB1, 0x35, 0x2C, 0xBF, 0xE1, 0x61, 0x83, 0x99, 0xA4,
+    0xAC, 0xD9, 0xCC, 0xA5, 0xD0, 0xDB, 0x6E, 0xAB, 0x05, 0x38, 0x00, 0xF5, 0x4B, 0xB2, 0xB0, 0x1B,
+    0x0F, 0xB3, 0xD8, 0x05, 0x74, 0xE0, 0xEB, 0x9C, 0x9A, 0x2C, 0xBA, 0x18, 0xDD, 0x8A, 0x3E, 0x98,
+    0x20, 0x1B, 0x49, 0xD2, 0xD5, 0x1C, 0x9A, 0x2C, 0x93, 0x5E, 0x1F, 0x84, 0xFB, 0x43, 0x67, 0x7C,
+    0x4D, 0xD7, 0x64, 0x11, 0xA5, 0xEE, 0x83, 0x22, 0x6C, 0x04, 0x9D, 0x8E, 0x8A, 0xA2, 0xF0, 0xD6,
+    0xD3, 0x19, 0x0F, 0x3A, 0xB2, 0xE2, 0xA4, 0xD8, 0x32, 0xEA, 0x08, 0x9D, 0xCC, 0xF5, 0x30, 0x2E,
+    0xE8, 0x7F, 0x92, 0xC6, 0x6B, 0x04, 0xC6, 0xEB, 0x1F, 0xF2, 0xE2, 0x8A, 0x8A, 0x7C, 0x4E, 0x7C,
+    0x30, 0x6A, 0x26, 0x40, 0x73, 0xE9, 0xA5, 0x5E, 0x3B, 0x8C, 0x14, 0x4A, 0xB5, 0xEC, 0xD1, 0x36,
+    0xAB, 0x23, 0x3E, 0x6E, 0x25, 0x7D, 0x40, 0x57, 0x13, 0xEC, 0xAC, 0x72, 0xEF, 0x6B, 0x0E, 0x7D,
+    0xB0, 0xAE, 0x8D, 0xE0, 0xEB, 0x84, 0xF1, 0x2A, 0xB7, 0x11, 0x74, 0x7D, 0xE8, 0x7D, 0x4B, 0xD0,
+    0x59, 0x67, 0x62, 0x93, 0x6A, 0x2A, 0x7A, 0xE3, 0xDB, 0xD8, 0xF1, 0x32, 0x87, 0x2E, 0x90, 0x3A,
+    0xC2, 0xBC, 0x75, 0x2B, 0x8D, 0x0E, 0xB4, 0x6F, 0xDE, 0xCA, 0x50, 0x4C, 0x3D, 0x3D, 0xA4, 0xBD,
+    0x1C, 0x1D, 0x2B, 0xAE, 0x80, 0x59, 0x15, 0x1D, 0x60, 0x9D, 0x74, 0x91, 0x1E, 0xCF, 0xEB, 0xEA,
+    0x8B, 0x3C, 0x9C, 0x46, 0xE9, 0xCA, 0xA7, 0x23, 0xB9, 0x1E, 0xCB, 0xD7, 0x6E, 0xBE, 0x08, 0x25,
+    0x32, 0x58, 0x92, 0xF3, 0x0E, 0xF6, 0x47, 0x36, 0xEA, 0x58, 0xD1, 0xD1, 0xE9, 0xD8, 0xAD, 0xE0,
+    0xEB, 0x1C, 0x74, 0x34, 0xBE, 0xE6, 0x15, 0x56, 0x0C, 0x46, 0xE8, 0xAE, 0x74, 0x56, 0x2A, 0xB9,
+    0x07, 0x9B, 0xA4, 0x5E, 0x1D, 0xFB, 0x0C, 0x48, 0x0B, 0x26, 0x60, 0xAE, 0x4B, 0x2F, 0x64, 0xB2,
+    0xC2, 0x37, 0xB3, 0x33, 0xD0, 0x47, 0xE9, 0x31, 0x9A, 0x8B, 0x64, 0x80, 0xA1, 0x18, 0x88, 0x1C,
+    0xEC, 0xAC, 0x64, 0xCE, 0xEB, 0x6E, 0x3C, 0x95, 0x74, 0x84, 0x9D, 0xBB, 0xD5, 0x2C, 0x35, 0x31,
+    0x7E, 0x97, 0x43, 0x1B, 0x6B, 0x3E, 0x11, 0xD1, 0xC7, 0x3E, 0x1A, 0x0F, 0x43, 0xCE, 0x74, 0xB0,
+    0x4C, 0x4D, 0x2E, 0x6A, 0x38, 0xC7, 0xFB, 0x09, 0x00, 0xB3, 0xE0, 0x34, 0x93, 0xA4, 0x59, 0xE4,
+    0xD4, 0x26, 0x61, 0x75, 0x19, 0x5F, 0x4B, 0x0B, 0xA1, 0xEB, 0x39, 0x75, 0x83, 0x22, 0xE8, 0x71,
+    0x0F, 0xBA, 0x55, 0x8B, 0x20, 0xCD, 0x5C, 0xF6, 0xD3, 0x11, 0x36, 0x85, 0x4E, 0x4F, 0xE5, 0xFD,
+    0x7D, 0xD9, 0x0B, 0x4F, 0xA8, 0xFE, 0x3B, 0x48, 0x92, 0x04, 0xCC, 0x4D, 0x9B, 0x0F, 0x5F, 0x2A,
+    0xAD, 0x9A, 0x40, 0x93, 0xE5, 0xB6, 0xF7, 0x41, 0x27, 0x99, 0xD8, 0x7A, 0x61, 0x6A, 0x14, 0xED,
+    0xF8, 0x28, 0x0A, 0xF0, 0xE3, 0x52, 0x8B, 0x20, 0xF7, 0xB0, 0x65, 0x5F, 0x4A, 0xCE, 0x0C, 0xD5,
+    0xA6, 0x69, 0xBE, 0x41, 0x1C, 0xA7, 0xBF, 0x89, 0x36, 0xA1, 0xE3, 0x2A, 0x39, 0xAD, 0xD3, 0xB1,
+    0x26, 0xD7, 0x8A, 0xD3, 0x98, 0xCF, 0xA3, 0x0F, 0x3A, 0x03, 0x35, 0xA5, 0xA1, 0xC0, 0x4B, 0x94,
+    0xB3, 0x25, 0x62, 0xB2, 0x55, 0x00, 0x39, 0x83, 0x3F, 0xE2, 0x8F, 0xCE, 0x41, 0x47, 0x49, 0xEB,
+    0x27, 0x3B, 0x03, 0x5D, 0x68, 0x88, 0xFB, 0x6A, 0x0E, 0x26, 0xDB, 0xC9, 0xF8, 0x9A, 0x5C, 0x15,
+    0xA1, 0xC9, 0x69, 0x5C, 0xD0, 0x0B, 0x53, 0x48, 0x6C, 0x69, 0x12, 0x80, 0xBA, 0xEC, 0x45, 0x26,
+    0x7B, 0xE1, 0x4E, 0x40, 0x93, 0x09, 0xC0, 0x7C, 0x12, 0x81, 0x8A, 0x4F, 0x7A, 0x40, 0x47, 0xE3,
+    0xCA, 0x96, 0x1E, 0x8A, 0x2A, 0x15, 0x80, 0x4D, 0xB2, 0xEF, 0x76, 0xA7, 0x9B, 0x07, 0x45, 0xF3,
+    0x5E, 0x44, 0xB7, 0xF2, 0x49, 0x0F, 0x5E, 0x89, 0x66, 0x6E, 0x72, 0xE7, 0x39, 0x18, 0x6F, 0xAF,
+    0xE4, 0x9A, 0xCF, 0x65, 0xBD, 0xEA, 0xA8, 0x43, 0xEF, 0xED, 0x32, 0x3A, 0x7B, 0x85, 0x35, 0x2B,
+    0xF6, 0xA1, 0x8D, 0xCD, 0x2E, 0x72, 0xB6, 0x2B, 0x4A, 0x4B, 0x44, 0x41, 0x70, 0x3C, 0xA0, 0x7F,
+    0x92, 0x80, 0x36, 0xDA, 0x09, 0x4D, 0xEA, 0x16, 0x28, 0x3E, 0xBE, 0x75, 0xF8, 0x51, 0x62, 0x32,
+    0x06, 0x98, 0x0F, 0x6E, 0x65, 0x98, 0x8F, 0x92, 0x9D, 0xBA, 0xC0, 0xDE, 0xEB, 0x38, 0x5E, 0x8D,
+    0x6D, 0xEA, 0x17, 0x2A, 0xEA, 0xD5, 0x7C, 0x8F, 0x2A, 0xE9, 0x15, 0x7A, 0x45, 0x4D, 0x61, 0xEB,
+    0x53, 0x54, 0xFB, 0x6C, 0x09, 0x87, 0x24, 0x24, 0x32, 0x0C, 0xD0, 0x2B, 0xBA, 0x4F, 0x12, 0x9A,
+    0x04, 0x1D, 0xED, 0x54, 0x13, 0x4D, 0xEA, 0x17, 0xD0, 0x29, 0x36, 0x11, 0xE6, 0xE3, 0xDF, 0xE2,
+    0xD7, 0x58, 0x52, 0x76, 0x27, 0xCB, 0xB9, 0x97, 0xCA, 0x57, 0x02, 0xDF, 0xB7, 0x24, 0x07, 0xB3,
+    0x74, 0x37, 0x68, 0x96, 0x2E, 0xE8, 0x68, 0xDF, 0x58, 0xDB, 0xD4, 0xE4, 0xFE, 0x87, 0x54, 0x54,
+    0xD4, 0xAB, 0x75, 0xBC, 0xCC, 0xE7, 0x52, 0xE7, 0xCD, 0xC2, 0xCB, 0x6C, 0x62, 0x17, 0xEC, 0x62,
+    0x1D, 0x9F, 0x88, 0xC6, 0x9B, 0xC5, 0x5C, 0x63, 0xBF, 0xEA, 0x55, 0xAF, 0x7C, 0x33, 0xAA, 0xA4,
+    0xB6, 0x64, 0xAC, 0x26, 0x40, 0x0F, 0xBD, 0x42, 0x73, 0x86, 0x99, 0x31, 0x72, 0xAA, 0x08, 0x95,
+    0x33, 0xDA, 0x88, 0xFE, 0xA3, 0x88, 0x7E, 0x01, 0x9F, 0xF4, 0xE0, 0xA4, 0xA3, 0x11, 0x00, 0x5E,
+    0x04, 0xE1, 0x99, 0x05, 0x53, 0x58, 0x15, 0x0F, 0x69, 0xE9, 0x75, 0x68, 0x23, 0x47, 0x67, 0xDC,
+    0xF8, 0x5E, 0x64, 0x45, 0xC5, 0xFE, 0x9D, 0xD4, 0xAE, 0x5D, 0xE0, 0x93, 0xAB, 0x59, 0x78, 0x25,
+    0xF5, 0x0B, 0x9F, 0x48, 0x9D, 0xB7, 0x57, 0xA3, 0xF1, 0xE3, 0x65, 0x96, 0x1D, 0x29, 0x57, 0xF1,
+    0x32, 0xD9, 0xB3, 0x46, 0xFA, 0x19, 0xB9, 0x02, 0xFC, 0xFE, 0x3F, 0x15, 0x1D, 0x98, 0x2E, 0xA2,
+    0xAC, 0xCB, 0x68, 0x52, 0xC1, 0x16, 0x45, 0x0F, 0xEA, 0x96, 0x2C, 0x48, 0x42, 0x2A, 0xA1, 0x90,
+    0x86, 0xC8, 0x00, 0x8C, 0xB7, 0x04, 0xF0, 0xD3, 0xD1, 0x3A, 0x74, 0x61, 0xFC, 0x01, 0x07, 0xF0,
+    0x75, 0x3E, 0x9E, 0xD0, 0x64, 0x1D, 0xBB, 0x00, 0xE3, 0x8D, 0x37, 0x4B, 0xC5, 0x89, 0x8E, 0x93,
+    0x8E, 0x4D, 0x56, 0xB2, 0xF8, 0xE8, 0xB5, 0xE6, 0x40, 0x67, 0xBC, 0x8E, 0xE5, 0x90, 0x28, 0x75,
+    0xFF, 0xB2, 0xC1, 0xB9, 0xF4, 0xA3, 0xB6, 0x92, 0x90, 0x3A, 0x4E, 0xA8, 0x52, 0xBF, 0x00, 0xFA,
+    0xD6, 0xBA, 0xDB, 0xDF, 0xB3, 0x08, 0x04, 0x15, 0xE9, 0xD1, 0x8A, 0xE6, 0xAD, 0x00, 0x73, 0x2D,
+    0x8E, 0x53, 0x13, 0xCD, 0x95, 0x15, 0x7C, 0x3C, 0x1A, 0xD7, 0x79, 0xFB, 0x5C, 0x54, 0x49, 0x07,
+    0xE3, 0x46, 0x47, 0x15, 0x01, 0xBD, 0xB6, 0x45, 0x5C, 0x73, 0x92, 0x9B, 0xDD, 0x07, 0x5D, 0x14,
+    0x36, 0x61, 0x4B, 0x6F, 0xA8, 0xCA, 0xFB, 0xE7, 0x13, 0x8A, 0x96, 0xDA, 0x80, 0x71, 0xA9, 0x38,
+    0xD8, 0x19, 0x6D, 0x82, 0x8E, 0xFD, 0x2A, 0x61, 0xF5, 0xD5, 0x0C, 0xE8, 0xB4, 0xFF, 0x4F, 0x29,
+    0xC4, 0x37, 0x16, 0x82, 0xA5, 0x58, 0xB8, 0x2E, 0xD0, 0x0F, 0xCC, 0xCD, 0x8B, 0x94, 0x96, 0xCA,
+    0x8A, 0xCF, 0x27, 0xB3, 0x60, 0x5C, 0x8C, 0xE7, 0x15, 0xA2, 0x4D, 0x4D, 0xD2, 0x51, 0x56, 0xB3,
+    0xCB, 0x7C, 0x8E, 0xD0, 0xB1, 0x5B, 0xBB, 0xB5, 0xF7, 0xE0, 0x15, 0xD6, 0x7C, 0x94, 0xE8, 0xD6,
+    0xD1, 0x1B, 0xDF, 0xFB, 0x9A, 0x4F, 0x24, 0xC5, 0x9A, 0x30, 0x9E, 0x6E, 0x5C, 0xFA, 0xA0, 0xD8,
+    0x87, 0x56, 0x22, 0xE4, 0x4D, 0x59, 0xC9, 0x90, 0x74, 0x7A, 0xD5, 0x24, 0x17, 0x95, 0x0A, 0x97,
+    0x48, 0x58, 0x6B, 0xD6, 0xB5, 0xA1, 0xF7, 0xE8, 0x17, 0xE4, 0xCE, 0x43, 0xAF, 0x30, 0x6F, 0xCB,
+    0x7E, 0xF3, 0x0C, 0xE5, 0xBC, 0x27, 0x71, 0x2E, 0x2F, 0x27, 0x9B, 0xA1, 0x83, 0xFE, 0x30, 0x1B,
+    0xA7, 0x62, 0xBB, 0xDA, 0x6F, 0xF8, 0x8A, 0x2A, 0x9A, 0x6B, 0x11, 0xF6, 0xD9, 0xAC, 0x3D, 0x61,
+    0x16, 0x36, 0xD1, 0xCC, 0x3A, 0xD8, 0x67, 0x73, 0x1B, 0x9A, 0x68, 0x66, 0x3E, 0x9A, 0x01, 0xDC,
+    0x8F, 0xCF, 0xCF, 0xA8, 0x62, 0x9B, 0x81, 0xF6, 0x87, 0x3C, 0x28, 0xA1, 0x4C, 0x2D, 0xB5, 0xA3,
+    0x3C, 0xA0, 0xDE, 0xA0, 0xA7, 0xB5, 0xC0, 0x86, 0xE3, 0xD0, 0x27, 0xD4, 0x85, 0xEB, 0xD8, 0xA6,
+    0x1D, 0x64, 0xD5, 0xAF, 0xC0, 0xFE, 0x79, 0xE9, 0xB9, 0x9F, 0x50, 0x31, 0x0F, 0x65, 0xF7, 0xAB,
+    0xEA, 0x50, 0xC8, 0xD2, 0x65, 0xFA, 0x3E, 0x12, 0x3D, 0xE3, 0xA6, 0x18, 0x57, 0xD9, 0x04, 0xFC,
+    0x01, 0xE9, 0x2A, 0x96, 0x4D, 0x1F, 0x57, 0xF4, 0xE4, 0xBB, 0x50, 0xFC, 0xD1, 0x49, 0xC5, 0x33,
+    0x93, 0x2F, 0x86, 0xDD, 0xB6, 0x06, 0x8C, 0xD2, 0xBD, 0x77, 0x2C, 0xB0, 0x3B, 0x07, 0x15, 0x9A,
+    0x04, 0xC4, 0x2E, 0x01, 0x76, 0x74, 0x02, 0xA9, 0x7C, 0x9E, 0xC2, 0x3A, 0xF6, 0x82, 0xA7, 0xEB,
+    0x83, 0x71, 0xC5, 0x3D, 0x02, 0xAF, 0x75, 0x01, 0xA8, 0xEC, 0x82, 0x7A, 0x97, 0x2B, 0x2B, 0x72,
+    0x00, 0x4E, 0x0B, 0xA0, 0x7E, 0x84, 0xF1, 0xCF, 0xA8, 0xCE, 0xCB, 0x09, 0x0E, 0x9A, 0x4C, 0xE8,
+    0xC9, 0x03, 0x98, 0x9B, 0x7B, 0x22, 0xA4, 0x54, 0x7E, 0xDD, 0xB4, 0xF3, 0xAE, 0xCE, 0xE1, 0xB7,
+    0x81, 0x87, 0x7B, 0xD1, 0x24, 0xD8, 0xA9, 0x0B, 0xBD, 0x57, 0x19, 0xD6, 0xD1, 0x75, 0xA1, 0xA6,
+    0x22, 0xC6, 0x59, 0x47, 0xBD, 0xD6, 0x84, 0x59, 0xC6, 0x59, 0xC7, 0x8A, 0x8F, 0x12, 0x66, 0x69,
+    0xA3, 0x8E, 0x15, 0x07, 0xE3, 0xCD, 0xD2, 0x46, 0x70, 0xE2, 0x64, 0x7C, 0x93, 0x9A, 0x04, 0xBA,
+    0xDE, 0x77, 0xAB, 0xCA, 0xA0, 0x33, 0xBE, 0x0B, 0x3A, 0x81, 0x37, 0xEC, 0xBF, 0xDB, 0x66, 0xBF,
+    0x6D, 0x5D, 0xAA, 0xCB, 0x1E, 0xB3, 0x96, 0x79, 0xD8, 0x29, 0x5D, 0x6C, 0x95, 0x05, 0x59, 0xC2,
+    0x0B, 0x35, 0xB7, 0xF7, 0x47, 0x3A, 0x75, 0x1B, 0x78, 0x51, 0x10, 0x14, 0x99, 0xFB, 0x8A, 0xAB,
+    0xCA, 0x1B, 0x7A, 0x7F, 0xF2, 0x65, 0xC5, 0x8A, 0x8F, 0x72, 0xA0, 0xB3, 0xCE, 0xCE, 0xE3, 0x62,
+    0x7C, 0x1F, 0xFA, 0xA0, 0xD7, 0x36, 0xB5, 0x51, 0xE5, 0x9A, 0x8F, 0xB1, 0xE2, 0x60, 0x67, 0x3A,
+    0xEB, 0x8C, 0x1F, 0x17, 0xE3, 0x75, 0xEC, 0x83, 0x5E, 0x15, 0x75, 0x6C, 0x52, 0xC5, 0xE7, 0x58,
+    0x11, 0xDB, 0xCB, 0xC6, 0x1B, 0xDF, 0x07, 0x1D, 0xF5, 0xDA, 0x47, 0xC5, 0x0F, 0x68, 0x23, 0x46,
+    0x16, 0x25, 0x75, 0xAE, 0x40, 0x2F, 0xF8, 0xB5, 0xB4, 0x82, 0xC9, 0xC9, 0xD7, 0x27, 0x24, 0x7C,
+    0x96, 0x9D, 0x98, 0xD9, 0xC9, 0x97, 0x77, 0x54, 0xAF, 0xA1, 0x78, 0x8A, 0xDA, 0xAD, 0x93, 0x4E,
+    0x71, 0x69, 0x39, 0x74, 0x09, 0x2D, 0xC1, 0x59, 0x94, 0xD6, 0xCA, 0x0A, 0x6F, 0x67, 0x3A, 0xD4,
+    0x7C, 0x9C, 0x24, 0x53, 0x4F, 0x92, 0xFE, 0x18, 0xA7, 0x42, 0x92, 0x66, 0x01, 0x1B, 0xE8, 0xD0,
+    0x50, 0x71, 0x80, 0x59, 0x5B, 0x96, 0x3E, 0x7D, 0x93, 0xD0, 0xF3, 0x3A, 0x17, 0x29, 0xD9, 0x48,
+    0x33, 0x71, 0xC9, 0x43, 0x4A, 0xF9, 0xE9, 0x2B, 0x65, 0x2A, 0xB4, 0xE2, 0x47, 0xBE, 0xE1, 0xBF,
+    0xE6, 0xC0, 0xB9, 0x8B, 0xDD, 0x5A, 0xC4, 0x0B, 0x4C, 0x21, 0x52, 0xC5, 0x91, 0xE4, 0x1B, 0xF9,
+    0xF0, 0xE2, 0x6A, 0xE7, 0x9A, 0x8F, 0x27, 0x18, 0x3F, 0x7A, 0x9D, 0x15, 0x3F, 0xA0, 0xEB, 0x36,
+    0xF9, 0x53, 0xD1, 0xBB, 0x38, 0x27, 0x77, 0xD7, 0x5A, 0x2F, 0x3A, 0xF6, 0x15, 0xB3, 0x6C, 0x24,
+    0xE2, 0x60, 0xC3, 0x79, 0x0F, 0xE3, 0x9B, 0x88, 0x3E, 0x54, 0x02, 0x58, 0xCC, 0x6D, 0x82, 0x0E,
+    0x8A, 0x50, 0xA9, 0xE6, 0x00, 0x0E, 0x74, 0x30, 0x8B, 0x9D, 0x65, 0x83, 0x38, 0xE9, 0x20, 0xB0,
+    0xDF, 0x88, 0x40, 0xFF, 0x5E, 0x02, 0xDA, 0x9B, 0x04, 0xAA, 0x2C, 0x40, 0xA5, 0x2B, 0xD4, 0x3F,
+    0x25, 0x5B, 0xB6, 0x85, 0x8D, 0x98, 0x07, 0xA0, 0x1A, 0x38, 0xC1, 0x5E, 0xCB, 0xD0, 0x7C, 0x72,
+    0x85, 0x4D, 0xC6, 0x2B, 0xBE, 0x4B, 0xD7, 0x8B, 0x8A, 0x6E, 0x1B, 0xDB, 0x84, 0xCE, 0x1B, 0x8F,
+    0xF1, 0x75, 0x0E, 0xA0, 0x8E, 0x50, 0xC9, 0x3A, 0xE8, 0x4F, 0x32, 0x60, 0xAE, 0x7B, 0x09, 0x7C,
+    0x6A, 0x69, 0xFD, 0x5B, 0x4A, 0xD9, 0xC8, 0x04, 0x11, 0x32, 0x00, 0x9A, 0x64, 0x16, 0xC0, 0x7E,
+    0x3D, 0x02, 0xDA, 0x5B, 0x00, 0xA9, 0x5D, 0x00, 0x3D, 0xBD, 0x7A, 0x1B, 0x63, 0xFC, 0x97, 0x68,
+    0x82, 0x07, 0xFE, 0xE4, 0x10, 0xB0, 0x57, 0x23, 0xC0, 0x27, 0x02, 0x90, 0xB5, 0x47, 0x15, 0xF5,
+    0x8C, 0x2A, 0xE8, 0xA3, 0x3C, 0x78, 0xCF, 0x2C, 0xE8, 0x03, 0x27, 0xC5, 0x6B, 0x19, 0x3D, 0x9F,
+    0x8C, 0xE0, 0x0D, 0xE3, 0xDB, 0x0C, 0xEB, 0x8C, 0xAF, 0x59, 0x73, 0x68, 0xA2, 0x8E, 0xE8, 0xBC,
+    0x9D, 0x61, 0xAE, 0x10, 0xE0, 0x79, 0x0F, 0x95, 0x38, 0xC9, 0x46, 0x6F, 0xBD, 0x88, 0xEC, 0x01,
+    0x95, 0xEC, 0x57, 0xEB, 0x4A, 0x6E, 0x89, 0x3B, 0x3C, 0x7E, 0x23, 0x64, 0xBA, 0x9D, 0x0C, 0xEF,
+    0xF6, 0x5F, 0xB3, 0xFB, 0xAF, 0x62, 0xE8, 0xCA, 0x7B, 0xBB, 0x2C, 0x84, 0x4C, 0x99, 0x94, 0xBB,
+    0xA8, 0x23, 0xBA, 0x6D, 0x50, 0x78, 0x70, 0x36, 0x01, 0xE0, 0x6C, 0x5D, 0x43, 0x29, 0x8F, 0x3D,
+    0x42, 0x98, 0xD0, 0x10, 0xD0, 0x65, 0x72, 0x5A, 0x01, 0xE3, 0x75, 0x90, 0x5C, 0x1A, 0x74, 0x66,
+    0x91, 0x32, 0x52, 0x43, 0xF0, 0x59, 0xD9, 0xE5, 0xA7, 0x5F, 0xEB, 0x2C, 0xDB, 0xD7, 0x80, 0x73,
+    0x1B, 0xAD, 0x03, 0x67, 0xB4, 0x44, 0xF7, 0x51, 0x86, 0xE2, 0x04, 0xB3, 0x62, 0x7C, 0xDB, 0xA3,
+    0x25, 0x14, 0x1D, 0xA4, 0xF3, 0x75, 0x18, 0x93, 0xCC, 0xCC, 0x3D, 0xC9, 0x45, 0x42, 0x64, 0x53,
+    0x76, 0xF5, 0xC1, 0x36, 0xBE, 0x6C, 0x40, 0x19, 0x64, 0x92, 0x6E, 0x8B, 0xF8, 0x7B, 0x3A, 0x01,
+    0x92, 0x6D, 0x66, 0xD8, 0xAD, 0xBF, 0x63, 0x3C, 0x02, 0xB5, 0xDC, 0xEE, 0xE5, 0x74, 0x54, 0xFF,
+    0xDD, 0x2D, 0x2D, 0xE6, 0xDD, 0x4D, 0x8B, 0x60, 0x17, 0xF0, 0x14, 0x91, 0x31, 0xCB, 0x04, 0xEB,
+    0x6A, 0x4E, 0x3D, 0xE9, 0x9B, 0x04, 0xE3, 0x1B, 0x7E, 0xC0, 0x61, 0x9C, 0xCB, 0x3E, 0x88, 0x2A,
+    0x89, 0x5A, 0x00, 0x9D, 0x59, 0xFA, 0x55, 0x71, 0xD0, 0x51, 0x65, 0x01, 0xAD, 0xE8, 0x7A, 0x6F,
+    0xE7, 0x46, 0xF4, 0x2C, 0x36, 0x61, 0x8D, 0xEE, 0x43, 0x0E, 0x6D, 0x42, 0xB7, 0x56, 0x2C, 0xFD,
+    0x2C, 0x83, 0xFE, 0x24, 0xA1, 0xC9, 0x18, 0x3D, 0x68, 0x1D, 0x46, 0xDF, 0x65, 0x68, 0xFA, 0xB2,
+    0x05, 0x92, 0xCD, 0x90, 0xD5, 0xA6, 0xA5, 0x2B, 0xF0, 0xFD, 0xB8, 0x16, 0x0D, 0x1C, 0xC1, 0xC4,
+    0xCF, 0x6D, 0xF5, 0xA4, 0x13, 0x00, 0x79, 0xBD, 0x2B, 0xA7, 0x6D, 0x9B, 0xFF, 0xE8, 0xDD, 0x95,
+    0xEF, 0x04, 0x75, 0xF4, 0x0E, 0x99, 0xB0, 0xE5, 0x3F, 0xD5, 0xB7, 0x77, 0x8C, 0x9A, 0x86, 0x42,
+    0x82, 0xCD, 0xE5, 0x76, 0x28, 0x4A, 0x89, 0xDA, 0xDA, 0x58, 0x73, 0xF9, 0xB2, 0x59, 0x75, 0x06,
+    0xAC, 0xB7, 0x7E, 0xA7, 0xA7, 0xD3, 0x45, 0x40, 0x47, 0xBB, 0x00, 0xE6, 0x23, 0xD1, 0xE6, 0x8C,
+    0x80, 0xA2, 0xF1, 0x40, 0x17, 0xE9, 0x00, 0xFB, 0x0E, 0x01, 0xC5, 0x27, 0x13, 0xD0, 0x4B, 0xC0,
+    0xB6, 0x8C, 0xE1, 0x3E, 0x4D, 0xF0, 0x93, 0x9B, 0x0C, 0x15, 0x49, 0x4E, 0xB2, 0xA3, 0x80, 0x48,
+    0x82, 0xC0, 0xF2, 0x60, 0x37, 0xFF, 0x3F, 0x73, 0xCC, 0xFF, 0x7F, 0x05, 0xD2, 0x07, 0x0E, 0x4B,
+    0x87, 0xBE, 0x08, 0xC5, 0xCC, 0x3D, 0x49, 0xC7, 0xF7, 0x3E, 0x62, 0x4B, 0xB4, 0xC9, 0x04, 0x74,
+    0x2B, 0x1D, 0xC6, 0xF7, 0x32, 0x2A, 0x7E, 0x2B, 0xA0, 0x4D, 0x76, 0x86, 0xF9, 0x98, 0x03, 0x78,
+    0x35, 0xA3, 0xCD, 0x3A, 0xBD, 0x66, 0x7D, 0x4F, 0x72, 0xDA, 0x58, 0x0C, 0x93, 0x8C, 0xBE, 0x36,
+    0x00, 0x68, 0x8B, 0x8D, 0xEE, 0xDD, 0xB4, 0xB8, 0x86, 0x62, 0xBB, 0x77, 0x01, 0xA0, 0x71, 0x02,
+    0xDE, 0xFE, 0xFA, 0x97, 0x4E, 0x4F, 0xC7, 0x95, 0xE5, 0xAA, 0x02, 0xB4, 0xD7, 0xC5, 0xB5, 0x1E,
+    0xDA, 0x89, 0xE1, 0x1E, 0xEF, 0x0B, 0xB8, 0x81, 0x2E, 0x03, 0x1D, 0xB3, 0x88, 0xE7, 0x31, 0x68,
+    0xD9, 0xD0, 0xCE, 0xF5, 0xCC, 0x15, 0xC3, 0x6F, 0xE0, 0x9F, 0x8C, 0x51, 0x97, 0xFD, 0xCF, 0x46,
+    0xA9, 0xCF, 0xFE, 0x50, 0xEA, 0x34, 0xFC, 0x46, 0x94, 0x92, 0xAF, 0x3C, 0xDD, 0xDD, 0x90, 0xDB,
+    0x3C, 0x7E, 0x50, 0x96, 0xC5, 0x8B, 0x01, 0x67, 0x5E, 0x84, 0x4E, 0x74, 0x18, 0x67, 0x98, 0x8F,
+    0x88, 0x9A, 0xA8, 0xF8, 0x66, 0x84, 0x8E, 0x68, 0x73, 0x29, 0xB4, 0x05, 0xBB, 0x54, 0x9C, 0x14,
+    0x2F, 0xD3, 0xB5, 0x09, 0x7D, 0x52, 0x9C, 0x6D, 0x6A, 0x64, 0x8B, 0xED, 0x6D, 0x6F, 0xD7, 0x12,
+    0xC0, 0x1B, 0x66, 0xA0, 0xE5, 0xDC, 0xF1, 0x00, 0xC0, 0xDE, 0x76, 0x25, 0x55, 0x19, 0x26, 0x8B,
+    0x90, 0x4D, 0xF2, 0x00, 0x20, 0x34, 0x04, 0x50, 0x3F, 0x37, 0x7F, 0x19, 0x5B, 0xCB, 0x10, 0xD0,
+    0xC9, 0x25, 0xFF, 0xA6, 0x54, 0xAA, 0x5D, 0xE1, 0x2A, 0x1E, 0x3D, 0x7E, 0x7B, 0xA8, 0xBE, 0x0C,
+    0xF4, 0x9C, 0xC7, 0x0C, 0x45, 0xD6, 0x24, 0x0C, 0x63, 0xC3, 0x5C, 0xF3, 0xE6, 0xFC, 0x59, 0x1B,
+    0xB5, 0xD4, 0x75, 0xED, 0x02, 0xC0, 0x5E, 0x13, 0x42, 0xF9, 0x93, 0x11, 0x40, 0x9B, 0xC6, 0xA5,
+    0x3E, 0x44, 0xFF, 0xA1, 0x68, 0x84, 0x5D, 0x95, 0x5D, 0x6B, 0xFB, 0x50, 0x71, 0xE8, 0xD6, 0x71,
+    0x69, 0x23, 0xF8, 0x5D, 0xBA, 0x71, 0xD5, 0x54, 0xBC, 0x4E, 0x32, 0xB4, 0xDB, 0xB6, 0xCD, 0xC9,
+    0x70, 0x45, 0xCB, 0xA9, 0xE7, 0x70, 0xEC, 0x8A, 0x8E, 0x48, 0x21, 0xA9, 0x4C, 0xA1, 0x1E, 0x00,
+    0xD2, 0x33, 0x4F, 0x0D, 0x00, 0x6A, 0xE7, 0x7F, 0xF3, 0x8E, 0xF6, 0x25, 0x11, 0xC9, 0xD1, 0x6B,
+    0x2F, 0xE8, 0x9A, 0xB7, 0x4B, 0xC5, 0xA9, 0xE2, 0x73, 0x1C, 0x9A, 0x8C, 0x36, 0xE9, 0x84, 0x5E,
+    0x32, 0x2D, 0x11, 0xD2, 0xA1, 0x53, 0x94, 0x8A, 0xA8, 0x8E, 0xA2, 0x05, 0x64, 0x7D, 0xC5, 0xC9,
+    0x78, 0x45, 0xD7, 0x26, 0xD9, 0x78, 0xDC, 0x78, 0x45, 0x50, 0x34, 0x5D, 0x5A, 0x7A, 0x1D, 0x61,
+    0xBC, 0xA1, 0x1B, 0x17, 0xF0, 0x75, 0x52, 0x11, 0x8A, 0x4F, 0xDE, 0x4A, 0xDD, 0x8A, 0x36, 0xD9,
+    0xA7, 0x02, 0x1D, 0xBA, 0x5B, 0x71, 0xFC, 0x20, 0x03, 0x23, 0x97, 0x22, 0x4F, 0xA4, 0xC8, 0x01,
+    0x8A, 0x6B, 0xCB, 0xB5, 0xDC, 0x39, 0x07, 0x74, 0x14, 0x18, 0xC2, 0x84, 0x82, 0x46, 0x56, 0x87,
+    0x87, 0x87, 0x03, 0x64, 0x37, 0x1D, 0x69, 0x96, 0x00, 0x70, 0xE1, 0x4B, 0x7A, 0x00, 0x30, 0x7D,
+    0xF1, 0x73, 0xB7, 0xCB, 0x20, 0x85, 0x8A, 0x93, 0x8E, 0xE3, 0xDC, 0x26, 0x98, 0x1F, 0x12, 0x7D,
+    0xA8, 0xF9, 0x44, 0x84, 0x75, 0x3A, 0xF6, 0x5E, 0x11, 0x66, 0xB1, 0x4E, 0xC7, 0x9A, 0x8F, 0x12,
+    0xD6, 0xEB, 0xD8, 0x46, 0x45, 0x37, 0xCE, 0xBD, 0x37, 0x54, 0x84, 0xBD, 0xCC, 0xD8, 0x85, 0x8A,
+    0x4F, 0xD2, 0xD3, 0xA9, 0x64, 0xED, 0x5F, 0x44, 0xE8, 0x5B, 0x51, 0xB6, 0x40, 0xFB, 0x1E, 0x09,
+    0xD8, 0xDC, 0x32, 0xA0, 0xA2, 0xEF, 0x38, 0x41, 0x71, 0x32, 0x11, 0x68, 0xE3, 0x2E, 0x72, 0x05,
+    0xD0, 0x94, 0x6D, 0x47, 0x82, 0xEC, 0x9A, 0x66, 0x64, 0x13, 0xDC, 0xE9, 0xFC, 0xD0, 0x11, 0x18,
+    0xF4, 0xD1, 0x56, 0x56, 0x02, 0xD4, 0xEE, 0xF6, 0x1A, 0x14, 0x61, 0x8A, 0xDB, 0xB6, 0x44, 0x16,
+    0xB6, 0x4C, 0xBA, 0x83, 0x2D, 0x73, 0x8F, 0x70, 0x9F, 0x64, 0x26, 0x50, 0xE4, 0xBC, 0xB5, 0x77,
+    0x1D, 0x6D, 0x0B, 0x79, 0xD7, 0x1D, 0x8D, 0x8F, 0x6D, 0x70, 0xF4, 0xB7, 0xDF, 0x82, 0x11, 0x86,
+    0x19, 0x1D, 0x13, 0x5A, 0x46, 0xE9, 0x67, 0xD8, 0xAA, 0x36, 0xB7, 0x8B, 0x73, 0x6E, 0x05, 0x20,
+    0xE0, 0x73, 0x00, 0xD4, 0x82, 0x7B, 0xF0, 0xAA, 0x84, 0x20, 0xFD, 0x3B, 0x45, 0x31, 0x04, 0xE3,
+    0xBC, 0x89, 0x64, 0xD8, 0x09, 0xED, 0xE5, 0xF4, 0x39, 0xAC, 0xD5, 0x73, 0xC1, 0x00, 0xFD, 0xAD,
+    0xB9, 0x68, 0x61, 0x8C, 0x73, 0x69, 0xE7, 0x7B, 0xD5, 0x4E, 0xE8, 0xA6, 0x15, 0xCA, 0x57, 0xC0,
+    0x57, 0x8F, 0x4D, 0x5E, 0x65, 0xC5, 0xFC, 0xC1, 0xE1, 0x2B, 0x99, 0x24, 0x99, 0xFB, 0xA1, 0x0C,
+    0xFC, 0xFB, 0x00, 0x1B, 0x7E, 0x95, 0xBC, 0x42, 0x26, 0x93, 0xF5, 0xB5, 0x1F, 0xE3, 0xB5, 0x53,
+    0x2A, 0xD9, 0xB7, 0xDE, 0x7D, 0x55, 0x85, 0xD6, 0xA1, 0x1A, 0xCC, 0x65, 0x3E, 0x92, 0x6A, 0x6F,
+    0x1F, 0x5B, 0x4A, 0xE8, 0x7A, 0x03, 0x86, 0xF9, 0xEB, 0x64, 0xB2, 0x35, 0xFF, 0x8F, 0x83, 0xEA,
+    0xA5, 0x13, 0xEE, 0xD5, 0xAE, 0xBB, 0x55, 0x6B, 0x5B, 0xC7, 0x7F, 0xB3, 0x29, 0xEB, 0x97, 0xC2,
+    0x3F, 0x3C, 0xE9, 0x8B, 0x02, 0xAA, 0xED, 0x6F, 0x9B, 0xA5, 0x98, 0x08, 0xDC, 0x7C, 0x15, 0x40,
+    0xFB, 0xC1, 0x82, 0xFF, 0x08, 0x0B, 0x80, 0xA5, 0x05, 0x86, 0x7B, 0x00, 0xDC, 0xB3, 0xDB, 0xE7,
+    0xFB, 0xE7, 0x7E, 0x7C, 0x5E, 0x26, 0xF0, 0x2A, 0xAB, 0xB2, 0x36, 0xDA, 0xF8, 0x6D, 0x99, 0xC3,
+    0xF4, 0x23, 0xFF, 0x0F, 0xFE, 0x10, 0x00, 0x30, 0xB7, 0xF8, 0x5B, 0x3F, 0x76, 0x6D, 0x66, 0x12,
+    0x7D, 0x8C, 0x19, 0xD5, 0xFC, 0x05, 0x00, 0x1A, 0x1E, 0x9F, 0xC3, 0x01, 0x80, 0x83, 0xFA, 0xE4,
+    0x27, 0x4E, 0xBF, 0xBB, 0x0B, 0x4A, 0x36, 0xE3, 0x3C, 0xF4, 0x3B, 0x9B, 0x71, 0x86, 0x07, 0xEF,
+    0x38, 0xC2, 0xD1, 0x7C, 0xB6, 0x7B, 0xAD, 0xD9, 0x45, 0xA7, 0xBB, 0xAA, 0x51, 0x51, 0x3A, 0xFB,
+    0x22, 0x6A, 0xF9, 0xD2, 0x76, 0xDA, 0x28, 0xDA, 0x17, 0x50, 0x1F, 0xA0, 0x7A, 0x15, 0x50, 0x7E,
+    0x73, 0xF8, 0x6E, 0x47, 0x41, 0x8B, 0x28, 0xAA, 0xC9, 0xCD, 0x04, 0xE0, 0x8B, 0xD8, 0x7E, 0xFD,
+    0xBC, 0x8F, 0x46, 0x5A, 0x45, 0xF1, 0x6F, 0xC4, 0x4D, 0x21, 0x9D, 0xB1, 0x12, 0xAD, 0x25, 0xFC,
+    0xB3, 0xD2, 0x4F, 0x3A, 0xFF, 0xED, 0x6C, 0x3B, 0x01, 0xA8, 0xA6, 0x6D, 0xD5, 0xB5, 0x28, 0x97,
+    0x20, 0x64, 0x9B, 0x01, 0xE8, 0x17, 0x9C, 0x9E, 0x10, 0x01, 0xB5, 0x00, 0x11, 0x4A, 0x0E, 0xA3,
+    0x27, 0x7C, 0x61, 0xB7, 0x76, 0x8B, 0xA1, 0xFA, 0xED, 0x1B, 0xEB, 0xE5, 0x0E, 0x5B, 0x6E, 0xE6,
+    0x7D, 0x60, 0xC2, 0x21, 0x00, 0x0E, 0xAD, 0xD0, 0x15, 0xC6, 0x19, 0x68, 0x79, 0x51, 0x6A, 0x3F,
+    0xD2, 0x14, 0x5A, 0x02, 0xAE, 0x7B, 0x4F, 0x08, 0x72, 0xD7, 0x74, 0x18, 0x1D, 0xFA, 0xB2, 0x32,
+    0x8B, 0x8C, 0x2D, 0x17, 0x98, 0x45, 0xF6, 0xBC, 0x1D, 0x5A, 0x46, 0x34, 0x11, 0x23, 0x3D, 0x7A,
+    0xAF, 0x68, 0x1D, 0x38, 0x99, 0x8F, 0x32, 0x54, 0xAA, 0xF9, 0x64, 0x40, 0x17, 0xBA, 0x75, 0x74,
+    0x18, 0x1D, 0x5F, 0x27, 0x6A, 0xB6, 0x51, 0xAF, 0xD0, 0xEB, 0xB8, 0x98, 0x05, 0xE6, 0x1A, 0xC1,
+    0xA1, 0xA2, 0xF1, 0x4D, 0x44, 0x9B, 0xCB, 0xCE, 0xE1, 0x2B, 0x38, 0x81, 0x74, 0x4A, 0xC2, 0xEC,
+    0xEE, 0xC6, 0xB9, 0x8E, 0x33, 0x46, 0x7A, 0x4B, 0xD4, 0xE4, 0x63, 0xF4, 0xD0, 0x8C, 0x9A, 0x83,
+    0xEC, 0x90, 0xB8, 0x4B, 0xAE, 0xF5, 0x7A, 0x2C, 0x05, 0x2F, 0x32, 0x54, 0x12, 0x66, 0x97, 0xD8,
+    0xF2, 0x28, 0x2D, 0xB1, 0x93, 0x4A, 0xB0, 0xAE, 0x89, 0x18, 0x97, 0x6E, 0xDD, 0x81, 0x7F, 0x13,
+    0xAA, 0x8B, 0x2F, 0xDE, 0xDE, 0xCE, 0xAD, 0x88, 0xDE, 0x37, 0x59, 0x7A, 0xAA, 0x8D, 0x6F, 0xA3,
+    0x10, 0x9A, 0xEC, 0xAC, 0x23, 0x58, 0x36, 0x07, 0x0A, 0xA5, 0x6C, 0x3C, 0x19, 0xAF, 0x38, 0x98,
+    0xA5, 0xA1, 0x34, 0x72, 0x8F, 0xBE, 0xCF, 0x30, 0x99, 0x7C, 0xD9, 0xF0, 0x16, 0x63, 0xC7, 0x77,
+    0xB8, 0x36, 0x7C, 0x8C, 0x1E, 0x7B, 0x82, 0x5F, 0xC8, 0xF6, 0xA5, 0x6E, 0x2B, 0x7D, 0xED, 0x36,
+    0x37, 0x3C, 0xFD, 0xD2, 0x91, 0xBE, 0x56, 0x75, 0xFE, 0xC6, 0x1E, 0x0C, 0x39, 0x34, 0x05, 0x8C,
+    0xC2, 0x69, 0xDE, 0x3C, 0x38, 0xA6, 0x9F, 0x92, 0xCF, 0xA1, 0x2A, 0x10, 0x95, 0x88, 0xAF, 0x99,
+    0x9B, 0x36, 0x29, 0x82, 0xCB, 0xB8, 0x34, 0x6C, 0x13, 0x46, 0xCF, 0xB9, 0xC9, 0x3A, 0x82, 0x33,
+    0xDD, 0x18, 0x3B, 0x92, 0x8F, 0x92, 0x5C, 0x8C, 0xB4, 0xF0, 0xBD, 0x0B, 0xDC, 0xBF, 0x57, 0xD4,
+    0xE0, 0x8A, 0x58, 0xF9, 0x59, 0xBE, 0xFF, 0x42, 0x2B, 0xFA, 0x47, 0x19, 0x17, 0xF3, 0xE1, 0x5F,
+    0xB7, 0x2B, 0x8A, 0xE0, 0xCB, 0xB1, 0x25, 0xF9, 0x1C, 0xFF, 0x15, 0x3D, 0x9D, 0x8E, 0xC6, 0x2B,
+    0xEA, 0x08, 0x5E, 0xE1, 0xD7, 0x38, 0x5B, 0xD2, 0x6B, 0x51, 0x2E, 0x9A, 0x81, 0x73, 0xC0, 0xFF,
+    0x07, 0xE5, 0xBD, 0x41, 0xAC, 0x25, 0x47, 0x76, 0x25, 0x76, 0x32, 0x83, 0xBF, 0x52, 0xAA, 0x1C,
+    0x4D, 0xD4, 0xA2, 0x4B, 0x86, 0xC8, 0x81, 0x73, 0x36, 0x06, 0x24, 0x42, 0x52, 0x6C, 0xBC, 0xD0,
+    0x00, 0x6C, 0x46, 0x90, 0x05, 0x98, 0x0B, 0x2E, 0xF8, 0x6D, 0xD7, 0x97, 0x66, 0x86, 0x0B, 0x6A,
+    0xD1, 0x03, 0x48, 0xAD, 0xF1, 0xD4, 0x2C, 0x35, 0x40, 0x37, 0x33, 0xC9, 0x82, 0xCD, 0x45, 0x2F,
+    0x58, 0xB0, 0xA5, 0xF1, 0xA2, 0x17, 0x5D, 0x36, 0x6A, 0xE0, 0xEE, 0xDF, 0x06, 0x4A, 0x8B, 0x01,
+    0xDC, 0x06, 0x8A, 0x15, 0x51, 0x2C, 0xD8, 0x5C, 0x70, 0xC1, 0x24, 0x7B, 0x1A, 0x5A, 0x70, 0xC1,
+    0x64, 0x93, 0x2D, 0x7A, 0x8A, 0x8B, 0x0A, 0x36, 0x93, 0x64, 0x56, 0x55, 0x64, 0x1C, 0x2F, 0x6E,
+    0xE4, 0xFB, 0xFF, 0x57, 0x15, 0x5B, 0xCD, 0xF1, 0x68, 0x34, 0x03, 0x3F, 0xB2, 0xDE, 0xFB, 0xEF,
+    0xBD, 0x7C, 0x99, 0x11, 0x37, 0x22, 0x6E, 0xDC, 0x7B, 0xEE, 0xB9, 0x37, 0xA1, 0x79, 0x07, 0x68,
+    0xC8, 0x05, 0x35, 0xC9, 0x00, 0x92, 0x0B, 0xEC, 0x67, 0x2F, 0x10, 0x3A, 0x81, 0x63, 0x93, 0x61,
+    0xE6, 0x9A, 0xAE, 0x5D, 0xC1, 0xF0, 0xDF, 0xD0, 0xD9, 0x98, 0x18, 0xBA, 0xC5, 0x32, 0x36, 0xBC,
+    0xCA, 0xB9, 0x26, 0xB9, 0x80, 0xE4, 0x0C, 0x4B, 0xCE, 0xE8, 0xF2, 0xBF, 0xF2, 0x68, 0x57, 0x68,
+    0xA7, 0x88, 0x0A, 0x60, 0x00, 0x60, 0x23, 0x80, 0x6E, 0x01, 0xD0, 0xAE, 0x00, 0x14, 0x81, 0xF2,
+    0x0D, 0x80, 0x53, 0x0E, 0x75, 0x32, 0x2B, 0x40, 0xCB, 0x00, 0x4B, 0x2E, 0xE8, 0xF8, 0x3D, 0xA2,
+    0x25, 0x38, 0xD6, 0x74, 0x66, 0x06, 0x43, 0xBB, 0xC2, 0x4E, 0x35, 0x5D, 0x17, 0xC1, 0xD0, 0x26,
+    0xD8, 0xA8, 0x58, 0x75, 0x09, 0xBC, 0xF9, 0xEE, 0x0A, 0xFB, 0x73, 0x12, 0xDD, 0x6A, 0x39, 0xB4,
+    0xBC, 0xCD, 0xA0, 0x48, 0x8E, 0xE0, 0x55, 0x4E, 0xE8, 0xDF, 0x61, 0x82, 0x99, 0xF7, 0xEC, 0xD0,
+    0x26, 0x34, 0x41, 0x11, 0x70, 0x72, 0xE1, 0x7E, 0x02, 0x60, 0x66, 0x00, 0x3A, 0xED, 0x9A, 0x04,
+    0xA0, 0x22, 0x00, 0xF8, 0x00, 0xC0, 0x4E, 0x00, 0xF4, 0x0C, 0xA0, 0x49, 0x50, 0x24, 0x51, 0x91,
+    0x0C, 0xF0, 0xE4, 0x24, 0x9D, 0xD5, 0xEB, 0xC1, 0x79, 0xF9, 0x69, 0xC5, 0x01, 0x80, 0x1F, 0xB7,
+    0xCE, 0xEA, 0x04, 0xA0, 0xF9, 0xF2, 0x6F, 0x32, 0x80, 0x9A, 0x0E, 0x00, 0xBF, 0xFC, 0x9B, 0x9D,
+    0xE8, 0xB6, 0x47, 0xB3, 0x96, 0xB6, 0xE9, 0x04, 0x80, 0x03, 0xD0, 0xCD, 0xF0, 0x24, 0x34, 0x19,
+    0x41, 0x12, 0x5D, 0x3E, 0xBC, 0x54, 0xD3, 0xC9, 0xEF, 0x14, 0xCB, 0x09, 0x9A, 0x5C, 0x9A, 0x20,
+    0xBF, 0x0B, 0x80, 0x5E, 0x4A, 0xCB, 0xCC, 0x7C, 0xFF, 0x71, 0xD0, 0x64, 0x42, 0x47, 0x26, 0x18,
+    0x72, 0x91, 0x9E, 0xDA, 0xCF, 0x0E, 0xF6, 0xA5, 0x2D, 0xFD, 0xB4, 0x75, 0x87, 0xA1, 0x3C, 0x99,
+    0x22, 0x90, 0x51, 0x9E, 0x7A, 0x32, 0xE0, 0x3F, 0xE3, 0x81, 0x93, 0xF3, 0xB5, 0x2B, 0x00, 0xBD,
+    0x6E, 0x1D, 0xD4, 0x69, 0x9B, 0x0B, 0x66, 0xDE, 0xFA, 0x77, 0xD4, 0xC9, 0x9A, 0x5C, 0x61, 0xC9,
+    0xA0, 0xC8, 0x84, 0x9E, 0x1C, 0xDA, 0xE3, 0x7D, 0x7E, 0x94, 0xB7, 0x86, 0x9A, 0x4C, 0xB0, 0xE4,
+    0xA0, 0xC8, 0xB9, 0xB4, 0x7D, 0x7A, 0x40, 0x36, 0xA1, 0x5C, 0xE4, 0x17, 0xF4, 0x66, 0x02, 0xD0,
+    0x8F, 0x0F, 0xF4, 0xA6, 0xE2, 0x7F, 0x0F, 0x54, 0xDB, 0x7A, 0x70, 0x8A, 0xE4, 0xA8, 0x48, 0xC6,
+    0x26, 0xC3, 0x2F, 0xED, 0x0A, 0x93, 0x74, 0x82, 0x4E, 0x3A, 0x41, 0xAF, 0x7A, 0x41, 0xBB, 0x76,
+    0x0B, 0xDA, 0xD5, 0xCC, 0xD0, 0xAB, 0x8D, 0xD0, 0xC9, 0x46, 0x69, 0x83, 0x59, 0x00, 0xD8, 0x19,
+    0x00, 0x23, 0x86, 0x86, 0x23, 0x48, 0x0E, 0x20, 0x09, 0x90, 0x0B, 0xE0, 0x39, 0x00, 0xD5, 0x7E,
+    0xE9, 0xBA, 0x21, 0x47, 0x4D, 0x46, 0x45, 0xA6, 0x8A, 0xCC, 0xF0, 0x23, 0x60, 0xA2, 0x74, 0x48,
+    0xF1, 0x3C, 0x2A, 0x32, 0xC2, 0x93, 0xCE, 0x92, 0x51, 0x67, 0xBF, 0xAA, 0xAC, 0xF8, 0x12, 0x5D,
+    0x1F, 0x7D, 0xD0, 0xC9, 0x46, 0x45, 0x9D, 0xC0, 0x37, 0x32, 0x6C, 0x94, 0xCE, 0xEB, 0x15, 0x68,
+    0x89, 0x3F, 0x7C, 0x8C, 0x43, 0x47, 0x86, 0x86, 0x0C, 0x15, 0x19, 0xD0, 0x67, 0xB7, 0x9B, 0x4F,
+    0x7A, 0x81, 0xB4, 0xD7, 0x4E, 0x35, 0x07, 0x98, 0xB9, 0xA2, 0x33, 0x0B, 0x60, 0xA7, 0x36, 0x55,
+    0x0C, 0x80, 0x0F, 0x36, 0xEA, 0x04, 0x54, 0x1C, 0x18, 0x38, 0x02, 0x8A, 0x2A, 0xB7, 0x32, 0xB0,
+    0xDD, 0xDC, 0x4F, 0x00, 0xF4, 0xE2, 0xDF, 0x20, 0x00, 0x98, 0x4F, 0x29, 0x43, 0xD9, 0xDF, 0xBE,
+    0x47, 0x07, 0x40, 0x94, 0x89, 0x8C, 0x02, 0x47, 0x00, 0xF0, 0x1F, 0xAF, 0x1C, 0x00, 0xB4, 0xB4,
+    0x9F, 0x12, 0x00, 0xFA, 0xC8, 0x57, 0x32, 0x00, 0xC5, 0x67, 0x56, 0x9D, 0x00, 0xD8, 0xC5, 0x44,
+    0x33, 0x03, 0x35, 0x83, 0x0F, 0xFD, 0x04, 0x74, 0x49, 0x11, 0x0C, 0xA8, 0x38, 0xEA, 0xA5, 0x66,
+    0x86, 0x5E, 0xD1, 0x8F, 0x8A, 0x33, 0x38, 0xD5, 0x84, 0x66, 0x68, 0x09, 0x9D, 0xD0, 0x6D, 0x6B,
+    0x58, 0xA7, 0xF2, 0x47, 0x3F, 0x6D, 0xB3, 0xCA, 0xDD, 0xF7, 0xCD, 0x6E, 0xC6, 0x71, 0x38, 0xB6,
+    0xB4, 0xFE, 0x18, 0x00, 0xF0, 0xA8, 0xB3, 0x19, 0x6D, 0x82, 0x4D, 0x8A, 0x0B, 0x18, 0x3A, 0x06,
+    0xCB, 0x51, 0x2F, 0x0D, 0x97, 0xFA, 0x7B, 0xAC, 0xE8, 0x78, 0xC7, 0xC1, 0xC6, 0x2E, 0xDA, 0x05,
+    0xA8, 0x59, 0x53, 0x11, 0x80, 0x89, 0x36, 0xFA, 0x11, 0xA8, 0xF9, 0x43, 0x5E, 0x4D, 0x32, 0x9E,
+    0x64, 0x00, 0x14, 0x8B, 0x10, 0xEC, 0x5D, 0x7E, 0xCC, 0x01, 0x68, 0x57, 0xBD, 0x74, 0x0B, 0x00,
+    0x06, 0x0E, 0x1C, 0x00, 0xBB, 0x74, 0xB3, 0x4E, 0xA8, 0xAE, 0xB2, 0x26, 0x78, 0x77, 0xB4, 0x1C,
+    0x6D, 0x6C, 0x98, 0x14, 0x67, 0x95, 0x61, 0x18, 0xEC, 0x82, 0x7E, 0x44, 0x9F, 0xB0, 0x7F, 0xA2,
+    0xCD, 0x7A, 0x3E, 0xAE, 0xB3, 0x00, 0x74, 0x71, 0xEB, 0xEF, 0xD6, 0xCD, 0x4D, 0x00, 0xDF, 0x2F,
+    0x1F, 0x3C, 0xC6, 0x3B, 0x45, 0x8B, 0xB1, 0xA8, 0x8C, 0x19, 0xFF, 0x02, 0xFD, 0x02, 0xC0, 0xEC,
+    0x16, 0x66, 0xB7, 0x88, 0x84, 0xF6, 0x7E, 0x9F, 0x23, 0x0C, 0xE9, 0x60, 0x38, 0x01, 0x96, 0x0B,
+    0xF0, 0x38, 0x09, 0xA0, 0xE1, 0x70, 0x7C, 0xC9, 0x80, 0x01, 0xA8, 0x19, 0xBE, 0x81, 0x96, 0x43,
+    0x7F, 0x8B, 0x44, 0x4F, 0xAE, 0xE8, 0xC9, 0x59, 0x7E, 0x8F, 0xC7, 0x26, 0x00, 0x2A, 0x02, 0xA8,
+    0x17, 0x00, 0x75, 0x02, 0xA0, 0x12, 0x50, 0x71, 0x01, 0x2A, 0xC6, 0x4D, 0x4F, 0x02, 0x00, 0xF6,
+    0xAE, 0xA0, 0x26, 0xC7, 0x86, 0x5C, 0x14, 0xB9, 0xD6, 0x1F, 0x76, 0x19, 0x50, 0x59, 0xF4, 0x53,
+    0x97, 0xD0, 0x33, 0xC2, 0xD3, 0x81, 0x1C, 0x71, 0xE0, 0xCB, 0x64, 0xEF, 0x16, 0xC0, 0x2E, 0x2F,
+    0x1E, 0x72, 0xEE, 0xC9, 0xA9, 0x27, 0x87, 0x9E, 0x77, 0x80, 0x0B, 0x01, 0xD0, 0x23, 0xD0, 0x44,
+    0xF9, 0xA7, 0x23, 0x14, 0x23, 0x1A, 0x8E, 0x50, 0x79, 0x9B, 0x2F, 0x0B, 0xCC, 0x8C, 0x7E, 0xAA,
+    0x19, 0x6A, 0x3A, 0x93, 0xA0, 0x53, 0xC5, 0x11, 0x36, 0xEA, 0x15, 0xE0, 0xC0, 0x09, 0x4D, 0x6E,
+    0x09, 0x98, 0xB9, 0x8F, 0x00, 0xDF, 0x20, 0xA0, 0x68, 0x67, 0xA0, 0xBB, 0xC7, 0x01, 0xE8, 0x99,
+    0x80, 0x9A, 0x9C, 0x00, 0xBD, 0x32, 0x00, 0xF6, 0x53, 0x3A, 0x54, 0x7C, 0x85, 0x40, 0xBB, 0xEA,
+    0x15, 0xB0, 0xD1, 0x2C, 0x00, 0x43, 0x1F, 0xA1, 0x08, 0x8E, 0xE8, 0x96, 0x9A, 0x1C, 0xFD, 0xA8,
+    0x48, 0x45, 0x68, 0x26, 0x9D, 0xD0, 0x71, 0x02, 0x50, 0xD1, 0x01, 0x68, 0xD3, 0xD1, 0x24, 0x65,
+    0xD8, 0xB6, 0x05, 0xD1, 0x98, 0xB2, 0x39, 0xC9, 0x5B, 0xC5, 0x41, 0xA7, 0x9A, 0x41, 0xB1, 0x66,
+    0xA8, 0xF8, 0x12, 0x03, 0xFC, 0xC8, 0x11, 0x26, 0x72, 0x84, 0x4E, 0x9C, 0xA0, 0xE8, 0xA3, 0x68,
+    0x0E, 0xF8, 0xDB, 0xA9, 0xB4, 0x4D, 0xA7, 0x3E, 0x42, 0x65, 0xBD, 0xA2, 0xE2, 0xD3, 0x0C, 0xF0,
+    0xA3, 0x65, 0xB4, 0xB1, 0xE5, 0xA2, 0x13, 0xB8, 0x36, 0x19, 0x86, 0x0E, 0x40, 0x1F, 0x20, 0x2A,
+    0x08, 0x7A, 0x01, 0xA0, 0xD6, 0xDD, 0x64, 0xEB, 0x03, 0x80, 0x47, 0x2F, 0x01, 0x7A, 0x81, 0x4E,
+    0xE8, 0x16, 0xD8, 0x19, 0x66, 0xFE, 0x06, 0x27, 0xD8, 0x78, 0x97, 0x03, 0x6C, 0x24, 0x01, 0x1B,
+    0x99, 0x80, 0xFE, 0x7D, 0x46, 0xC0, 0xBF, 0xC3, 0x00, 0xF0, 0x26, 0x1D, 0xC0, 0xB7, 0x56, 0xA0,
+    0xE2, 0xD5, 0x05, 0xA8, 0xC8, 0x09, 0xA8, 0x29, 0xAA, 0x45, 0xB6, 0x2D, 0x33, 0x03, 0x4D, 0xEE,
+    0x12, 0xD0, 0xAE, 0x66, 0x05, 0xF4, 0x6A, 0x09, 0xE8, 0x64, 0xE9, 0xA0, 0xD3, 0x93, 0x0C, 0xE8,
+    0x96, 0x6F, 0x71, 0x84, 0x99, 0xBF, 0xE6, 0x23, 0xEC, 0xF6, 0xBF, 0x59, 0x76, 0xAB, 0x5B, 0x71,
+    0xD0, 0xE9, 0x7F, 0xE5, 0xA0, 0xF2, 0x93, 0x0C, 0x15, 0x5F, 0x60, 0x80, 0x7F, 0x97, 0x01, 0xF6,
+    0x53, 0x11, 0xCC, 0x88, 0x26, 0x73, 0x2A, 0xA3, 0xE6, 0x6F, 0x2F, 0x80, 0xFD, 0x94, 0x10, 0x91,
+    0x35, 0xB9, 0x4F, 0xA8, 0x79, 0x81, 0x03, 0xF8, 0x96, 0x8F, 0xB0, 0x9F, 0xBE, 0x99, 0xA1, 0x97,
+    0xCB, 0x0C, 0xCD, 0x0A, 0xB3, 0xC8, 0x7C, 0x59, 0xD0, 0x2D, 0xF0, 0xB1, 0xF6, 0xF9, 0x29, 0x8E,
+    0x8A, 0x3C, 0x47, 0xD7, 0x90, 0x3A, 0xA3, 0x25, 0x4D, 0xC2, 0x29, 0xDE, 0xF1, 0x11, 0xF0, 0x6F,
+    0x1F, 0xEF, 0x73, 0xDE, 0xFA, 0x5C, 0x93, 0x71, 0x9B, 0x32, 0x8A, 0x7D, 0xDC, 0xE6, 0xD3, 0xD6,
+    0x67, 0xBD, 0x02, 0x7A, 0x6D, 0x09, 0xE8, 0xA4, 0xCA, 0xF3, 0x80, 0x6E, 0xA9, 0x18, 0x60, 0x66,
+    0x70, 0x84, 0x8D, 0x28, 0x3D, 0x9F, 0x81, 0xBD, 0xF3, 0x9B, 0x05, 0x53, 0x71, 0x00, 0x4E, 0xF3,
+    0xEE, 0x65, 0x34, 0x64, 0x42, 0x4D, 0x12, 0xF8, 0x13, 0x1E, 0xBA, 0x32, 0xAF, 0xFC, 0xA8, 0x33,
+    0x6C, 0x6C, 0x09, 0x9D, 0x5A, 0xA2, 0xC9, 0x0D, 0x51, 0xF3, 0x1C, 0x1D, 0xFC, 0x4D, 0x3A, 0xD8,
+    0x4F, 0x39, 0x40, 0x67, 0x06, 0x34, 0x64, 0x40, 0x4D, 0x1F, 0xCB, 0x58, 0xD9, 0x4F, 0x18, 0xA0,
+    0x17, 0x3B, 0xA3, 0x59, 0x5B, 0xA2, 0xA6, 0xE3, 0x08, 0x06, 0x23, 0x96, 0x98, 0xEB, 0x16, 0xF8,
+    0x88, 0x8E, 0x19, 0x6D, 0x6E, 0xC9, 0xA1, 0xA5, 0x22, 0xC7, 0x86, 0x8E, 0x8C, 0x8A, 0xEE, 0xEC,
+    0x85, 0xA4, 0x38, 0xA0, 0xC9, 0x8A, 0x01, 0x35, 0x5F, 0x66, 0xD8, 0x44, 0x63, 0x23, 0x47, 0xC8,
+    0x80, 0xA0, 0xC9, 0x7E, 0xDA, 0x64, 0x83, 0xA2, 0x32, 0xBF, 0x20, 0x8E, 0xBE, 0xEE, 0x12, 0x4A,
+    0x6B, 0xC1, 0xE0, 0x27, 0xC0, 0xC6, 0x2E, 0xC9, 0xFE, 0x30, 0xA0, 0xC9, 0xE8, 0x23, 0x6A, 0x3A,
+    0xBD, 0x02, 0x0C, 0x35, 0x03, 0x6C, 0x44, 0x3F, 0x6F, 0x7A, 0x9E, 0x51, 0xF1, 0x15, 0x32, 0xD8,
+    0x64, 0x98, 0x6B, 0x86, 0x6F, 0xFA, 0xD9, 0xA4, 0xD2, 0x0C, 0x45, 0xBD, 0x96, 0xC1, 0x47, 0x7F,
+    0x3B, 0x6F, 0x8D, 0x68, 0x33, 0x87, 0x32, 0x31, 0xC0, 0x37, 0x33, 0xD0, 0x64, 0x9D, 0x00, 0x33,
+    0xCB, 0x6A, 0xB6, 0x11, 0x8A, 0xF0, 0x13, 0xF4, 0x52, 0x31, 0xA0, 0x1F, 0x15, 0x07, 0x40, 0x2F,
+    0x68, 0x56, 0x74, 0x0B, 0xDA, 0x04, 0x33, 0x43, 0xA7, 0x6D, 0x7F, 0x8D, 0xE8, 0x16, 0xD8, 0x28,
+    0xAA, 0x06, 0x36, 0xC2, 0x8F, 0xB0, 0x11, 0x0C, 0xB0, 0x13, 0xF8, 0x93, 0x03, 0x3F, 0x55, 0x24,
+    0x39, 0x56, 0x24, 0x19, 0x6A, 0x92, 0x0C, 0x8A, 0x87, 0x3F, 0xE4, 0xA0, 0x88, 0x8A, 0xAE, 0xC9,
+    0x10, 0x33, 0x5C, 0x11, 0x3A, 0x95, 0xE7, 0x26, 0x43, 0x27, 0xB4, 0x2B, 0xBA, 0x05, 0x9A, 0x34,
+    0x33, 0x34, 0xB3, 0x8D, 0xD0, 0x5C, 0x6D, 0x44, 0xC7, 0x74, 0xB4, 0xEB, 0xC9, 0xB3, 0x18, 0x45,
+    0xA2, 0x48, 0x44, 0xBF, 0x94, 0xE7, 0x69, 0xD3, 0x29, 0x60, 0xD0, 0x09, 0xFD, 0xA4, 0x08, 0x33,
+    0x57, 0x1C, 0x74, 0x82, 0x1F, 0x77, 0x6F, 0x56, 0xF8, 0x49, 0x91, 0x9C, 0x2B, 0x92, 0x09, 0x9E,
+    0x24, 0xEC, 0xDD, 0xC3, 0xED, 0xB0, 0x0C, 0x1B, 0x8F, 0x7E, 0x93, 0x6D, 0xAC, 0xC8, 0xE7, 0x12,
+    0x3C, 0xDF, 0xC8, 0xB0, 0x3C, 0xD2, 0x24, 0x79, 0xA7, 0xEA, 0xFC, 0xCE, 0xCA, 0xD5, 0x0B, 0x80,
+    0xFA, 0x07, 0x22, 0x42, 0x96, 0x0E, 0x73, 0xAC, 0xE9, 0x40, 0x8A, 0xA0, 0x28, 0x72, 0xBC, 0x73,
+    0x50, 0x7A, 0x8D, 0x26, 0x43, 0x51, 0x36, 0x78, 0x06, 0x14, 0x61, 0xC2, 0x7E, 0x76, 0x70, 0x61,
+    0x01, 0x3A, 0x92, 0x2B, 0xD0, 0x90, 0x24, 0x50, 0x97, 0xFD, 0x98, 0xB7, 0x0E, 0x39, 0x01, 0x36,
+    0xA2, 0x9B, 0x81, 0x6E, 0x41, 0xBB, 0x02, 0x22, 0x56, 0x28, 0x62, 0x3B, 0x4F, 0x2F, 0xC7, 0x18,
+    0x39, 0x46, 0xA7, 0x2F, 0x3B, 0xA6, 0x3C, 0xDA, 0x15, 0x96, 0x2B, 0xC4, 0xCA, 0xD2, 0x09, 0x9E,
+    0xA9, 0xE2, 0xD0, 0xE6, 0x43, 0xF1, 0x5F, 0x50, 0x13, 0x7A, 0x81, 0x48, 0x07, 0x8A, 0xE4, 0x0C,
+    0xF4, 0x24, 0x81, 0x96, 0x64, 0x04, 0x78, 0xEB, 0x87, 0x19, 0xD0, 0x09, 0xFD, 0x08, 0x88, 0xD9,
+    0xDB, 0x95, 0x5F, 0x3A, 0x9D, 0x8E, 0x7E, 0x89, 0x6E, 0x06, 0xFA, 0x49, 0xB6, 0x78, 0x5D, 0x4C,
+    0x8B, 0xAE, 0xBC, 0x9A, 0xCD, 0xD4, 0x90, 0x0B, 0xC0, 0x7E, 0x76, 0xD0, 0x17, 0x03, 0x7B, 0x33,
+    0xDE, 0x6D, 0xB1, 0xDF, 0xFB, 0x62, 0xF4, 0x6E, 0xC6, 0xAF, 0x98, 0xBE, 0x03, 0xF8, 0x7F, 0x39,
+    0x54, 0x74, 0x15, 0xB9, 0xA2, 0xA6, 0xAB, 0x49, 0x0E, 0x8A, 0xA8, 0x49, 0x4E, 0x8A, 0xD2, 0x74,
+    0x91, 0xBA, 0x4F, 0xED, 0x8A, 0x26, 0x8B, 0x3D, 0xDC, 0xAE, 0xD0, 0xAB, 0x4E, 0x32, 0x2E, 0xE5,
+    0x35, 0x77, 0x0B, 0xF4, 0x82, 0x36, 0x9B, 0x59, 0xE4, 0x2C, 0xF2, 0x6C, 0x57, 0x69, 0xCE, 0x66,
+    0x8C, 0x75, 0xE5, 0xD5, 0x16, 0xF5, 0xED, 0x23, 0x00, 0xEC, 0xD7, 0x9C, 0x8A, 0x05, 0x19, 0xCA,
+    0x6B, 0x59, 0xC8, 0x72, 0xB8, 0x17, 0x7B, 0xF2, 0xC8, 0x7E, 0x96, 0x11, 0x9E, 0x77, 0xB6, 0xA6,
+    0x25, 0x09, 0x54, 0xBC, 0x75, 0x55, 0xC6, 0xAE, 0x9F, 0x00, 0x13, 0x6B, 0xD1, 0x1E, 0x6D, 0x02,
+    0x14, 0x61, 0x3F, 0xDB, 0x47, 0xB7, 0x80, 0x9C, 0xE1, 0xC7, 0x86, 0x9C, 0x15, 0x61, 0xC8, 0xA8,
+    0x13, 0x78, 0x8B, 0x93, 0x9D, 0x14, 0x6B, 0xDE, 0xA0, 0xD3, 0x8B, 0x62, 0xBB, 0xA2, 0x1F, 0x75,
+    0xB2, 0xB1, 0xA6, 0x33, 0x91, 0x61, 0x67, 0x6C, 0x17, 0xDF, 0xB1, 0x74, 0xC7, 0x4F, 0xD8, 0x5C,
+    0xBF, 0xDA, 0xF9, 0x24, 0x83, 0x14, 0x00, 0x58, 0xAE, 0xD2, 0xFE, 0x11, 0x40, 0xCD, 0x19, 0x27,
+    0x1F, 0x1D, 0x47, 0xC0, 0x73, 0x2E, 0x3D, 0x24, 0x33, 0xC0, 0x15, 0x40, 0xBF, 0xE0, 0x3C, 0xEC,
+    0x52, 0x33, 0x76, 0x49, 0x91, 0x7A, 0x55, 0xE4, 0x07, 0xAC, 0xF8, 0xBD, 0x95, 0x03, 0x5F, 0xA7,
+    0x1F, 0xED, 0xE8, 0x39, 0x77, 0xD1, 0x30, 0xB5, 0x49, 0x93, 0x35, 0x55, 0x66, 0xF0, 0xAF, 0xD3,
+    0x46, 0x13, 0xF9, 0xD6, 0xDA, 0x26, 0xFF, 0x0E, 0x6F, 0xD0, 0x4F, 0x76, 0xB6, 0x8C, 0x2D, 0x6F,
+    0x8B, 0xDD, 0x97, 0x2F, 0x6B, 0x16, 0x1F, 0x8B, 0xC0, 0xF9, 0x96, 0x01, 0xC0, 0x1E, 0x80, 0x7F,
+    0xE4, 0x50, 0x31, 0x8B, 0x80, 0x0D, 0x13, 0x1A, 0xFE, 0xC4, 0x81, 0xD3, 0xA3, 0x97, 0x4C, 0xEA,
+    0x78, 0x91, 0xCF, 0x70, 0xB5, 0x91, 0xFC, 0x22, 0xEB, 0xC8, 0xFE, 0xFD, 0xAC, 0xEF, 0xAD, 0xE6,
+    0x7D, 0xFA, 0x77, 0x56, 0xF3, 0x51, 0xEE, 0x3E, 0x48, 0x36, 0x92, 0x17, 0xF9, 0x3D, 0x4E, 0x1D,
+    0xB9, 0x3A, 0x4F, 0xAE, 0x15, 0xC9, 0x11, 0xE7, 0xDB, 0xF5, 0x78, 0x67, 0x1B, 0xDE, 0x01, 0xBA,
+    0x02, 0x1A, 0xAC, 0x32, 0x54, 0x86, 0xC3, 0x05, 0xD7, 0x65, 0xC0, 0x69, 0x6E, 0x12, 0x54, 0x47,
+    0x76, 0xE6, 0x31, 0x87, 0xFD, 0x3E, 0x0C, 0x41, 0x94, 0xC7, 0xBA, 0x3B, 0xDC, 0x47, 0x00, 0x9A,
+    0xEE, 0x31, 0xF1, 0xDD, 0xC4, 0xE5, 0x53, 0xE4, 0x0A, 0x18, 0xDE, 0x01, 0xD0, 0x85, 0xCD, 0x0E,
+    0x45, 0x8F, 0xED, 0xBD, 0x8E, 0x00, 0x98, 0x00, 0xD8, 0x75, 0x53, 0x46, 0xE5, 0xF1, 0xC7, 0x0E,
+    0x1D, 0x13, 0x3C, 0x53, 0x4D, 0x2E, 0x0D, 0xFF, 0x6A, 0xD6, 0x94, 0x69, 0x6B, 0x67, 0xB9, 0x7C,
+    0x1F, 0xA5, 0x81, 0xBE, 0xFC, 0xEB, 0x27, 0xA0, 0x9F, 0xAB, 0xC1, 0xD2, 0x0F, 0x1D, 0x39, 0xB4,
+    0xE4, 0x50, 0x31, 0x03, 0xA6, 0x98, 0xA3, 0xED, 0x04, 0xB4, 0x62, 0x8E, 0x36, 0x9C, 0xD0, 0x30,
+    0x14, 0x13, 0x4F, 0xD6, 0x72, 0xF4, 0x24, 0x6F, 0x92, 0xCC, 0x9A, 0xE4, 0x7C, 0xF6, 0x85, 0x7C,
+    0xE0, 0xA4, 0x9F, 0xE2, 0x51, 0x6C, 0x8A, 0xDC, 0x8F, 0xE5, 0x9D, 0x78, 0x4E, 0x53, 0xB1, 0x00,
+    0xDA, 0x75, 0x13, 0x0B, 0x43, 0xB1, 0x1D, 0xCD, 0x5C, 0x74, 0xAD, 0x22, 0x07, 0x68, 0xAE, 0x40,
+    0xCF, 0x88, 0x9A, 0xBF, 0xD4, 0x09, 0x01, 0x7C, 0x03, 0xA7, 0xF6, 0xD1, 0x46, 0xBF, 0x34, 0x0C,
+    0xA0, 0xE1, 0x3B, 0xCC, 0xD0, 0xF7, 0xC8, 0x9E, 0xB1, 0xE2, 0xEA, 0xF9, 0x31, 0x9D, 0xC9, 0x8A,
+    0xD1, 0xCC, 0x35, 0x83, 0x49, 0x15, 0x9D, 0x9D, 0x15, 0x07, 0x33, 0x2B, 0xCA, 0x1A, 0xE9, 0x27,
+    0x45, 0xD8, 0xD8, 0xAE, 0xE8, 0x27, 0x95, 0x05, 0xD3, 0xE9, 0x47, 0x9D, 0xE4, 0x2F, 0x0E, 0x3A,
+    0x81, 0xA1, 0x9B, 0x21, 0x26, 0x2D, 0xBA, 0x19, 0x5C, 0x6D, 0xAC, 0xE9, 0x34, 0x6F, 0x12, 0x36,
+    0xC2, 0xA7, 0x7E, 0x52, 0x44, 0x5D, 0x80, 0xA3, 0x6D, 0x84, 0x8A, 0x6F, 0x57, 0x7C, 0x9F, 0xCD,
+    0xF5, 0x29, 0xFB, 0x99, 0x2A, 0xD3, 0xEE, 0xF1, 0xC1, 0x07, 0x98, 0xCF, 0xE9, 0x6A, 0xBE, 0x91,
+    0x45, 0x53, 0x71, 0xB2, 0xB1, 0x21, 0xFC, 0x68, 0x63, 0xC5, 0xA7, 0x39, 0xA8, 0xDC, 0x25, 0xE8,
+    0xC4, 0x00, 0x73, 0xAF, 0x48, 0x07, 0x24, 0xA0, 0x38, 0x03, 0x2D, 0x43, 0x51, 0x54, 0xFD, 0x54,
+    0x76, 0xAE, 0x36, 0xFD, 0x22, 0x21, 0x97, 0xA9, 0xA3, 0x32, 0xDA, 0x6C, 0x27, 0xF0, 0x66, 0x86,
+    0x59, 0x6C, 0x54, 0xAC, 0x09, 0x3F, 0x9A, 0xA8, 0x53, 0xC5, 0x9A, 0xAE, 0x8B, 0x36, 0x82, 0xED,
+    0x0A, 0x1D, 0x39, 0x80, 0x17, 0x22, 0xF4, 0x17, 0x19, 0xF0, 0x3E, 0xA0, 0xE5, 0x02, 0xF4, 0x04,
+    0x1A, 0x8E, 0x80, 0x4D, 0x80, 0xDA, 0x80, 0x1D, 0xC1, 0x73, 0xA6, 0x32, 0xD0, 0x2C, 0xA0, 0xC7,
+    0x0E, 0xCF, 0x41, 0x9B, 0x50, 0xF3, 0x69, 0xBA, 0x9A, 0xA1, 0x9F, 0xC0, 0x51, 0x27, 0x70, 0x52,
+    0x44, 0x1F, 0xE1, 0x47, 0x1B, 0xD1, 0xCD, 0x66, 0x81, 0xCA, 0x5D, 0x02, 0xF8, 0x56, 0x82, 0x74,
+    0xB8, 0x21, 0x21, 0x3D, 0x86, 0xA5, 0x2B, 0x5D, 0xAE, 0x18, 0x80, 0x43, 0x7F, 0xF7, 0x8A, 0x2C,
+    0xD4, 0x8E, 0x24, 0x5A, 0x92, 0xA1, 0x3A, 0xE4, 0xAD, 0x4B, 0x5F, 0x0E, 0xA3, 0x49, 0xC7, 0x55,
+    0x86, 0x4E, 0x2A, 0xC3, 0x2C, 0x8A, 0xB0, 0xB1, 0x26, 0xFC, 0x58, 0x13, 0x0C, 0x15, 0x6B, 0xBA,
+    0x8A, 0x8A, 0x00, 0xDB, 0x15, 0xA0, 0x5E, 0x00, 0x5E, 0x88, 0x00, 0xFB, 0x49, 0xBA, 0x2F, 0xE8,
+    0x48, 0x4F, 0x00, 0xFD, 0x0A, 0x11, 0x00, 0xAC, 0xEC, 0x9A, 0x33, 0x7C, 0xC1, 0x42, 0x22, 0x0E,
+    0x79, 0xF7, 0xF2, 0x09, 0xF4, 0x66, 0xD8, 0xFC, 0x7D, 0xBD, 0x40, 0xD1, 0x95, 0x19, 0xE3, 0xC7,
+    0x8A, 0x01, 0x5D, 0x02, 0x47, 0x28, 0x82, 0x13, 0xE0, 0x47, 0xF1, 0x1D, 0xED, 0xCE, 0xFE, 0x86,
+    0xE7, 0x02, 0x40, 0x53, 0xFA, 0x92, 0x00, 0xC0, 0xAF, 0x00, 0x60, 0x29, 0xCF, 0x23, 0x00, 0xC3,
+    0xE2, 0xDE, 0x03, 0xE8, 0x52, 0x3F, 0x41, 0xE6, 0x13, 0x74, 0x56, 0x74, 0x68, 0x09, 0x3F, 0xA1,
+    0x21, 0x34, 0x93, 0xA2, 0x53, 0xA4, 0x62, 0x80, 0xE7, 0xCB, 0x0C, 0xA2, 0xE3, 0x37, 0x8B, 0x4B,
+    0xF6, 0x0B, 0x71, 0x42, 0xCB, 0x22, 0xF3, 0x0F, 0x7C, 0x0D, 0x40, 0xD1, 0x99, 0x84, 0x6E, 0x69,
+    0xE8, 0xC0, 0xC0, 0x09, 0xED, 0x6A, 0x16, 0xA0, 0xFF, 0x88, 0x80, 0xA2, 0xE0, 0x6F, 0x33, 0xCA,
+    0x66, 0xA1, 0x39, 0x14, 0xA7, 0x1A, 0x96, 0x01, 0xB2, 0xD0, 0x15, 0x7D, 0x04, 0xFC, 0x07, 0x74,
+    0xE8, 0x52, 0xC7, 0xB9, 0xA1, 0x23, 0xC1, 0x49, 0x33, 0xDA, 0x24, 0x22, 0x96, 0xF5, 0xD2, 0xAC,
+    0x3B, 0xFF, 0x52, 0x2E, 0xCF, 0x01, 0x40, 0x37, 0x03, 0xC0, 0x21, 0x3A, 0x92, 0x23, 0xBF, 0x43,
+    0x72, 0xEE, 0x3F, 0x20, 0x99, 0xCC, 0x4C, 0x92, 0x3A, 0x9D, 0x7D, 0x21, 0x1F, 0x9C, 0x23, 0x14,
+    0xC5, 0x80, 0x08, 0xE8, 0x47, 0xD8, 0x08, 0x13, 0x8B, 0xE5, 0x24, 0x86, 0xD3, 0xD1, 0xD7, 0x7E,
+    0x84, 0x9D, 0x8A, 0x41, 0xFC, 0xF0, 0xAF, 0xC5, 0x40, 0x16, 0xF3, 0xB9, 0x5D, 0xD1, 0xF0, 0xBC,
+    0x22, 0x49, 0x82, 0x24, 0x39, 0xF4, 0x24, 0x39, 0x1A, 0x8A, 0xE5, 0xB4, 0x13, 0x25, 0x1F, 0x10,
+    0xA5, 0x79, 0x40, 0xD2, 0x02, 0x08, 0xF6, 0x3F, 0x26, 0x69, 0x3E, 0x23, 0xF9, 0x6A, 0x7A, 0x9C,
+    0xB7, 0xFE, 0x27, 0xC2, 0x14, 0xB3, 0xB5, 0x1F, 0xD5, 0x97, 0xBC, 0xE1, 0xA8, 0x28, 0x06, 0xBB,
+    0x4D, 0xB0, 0xD1, 0x10, 0x9A, 0x9E, 0x49, 0x91, 0x57, 0x89, 0x9E, 0xAF, 0x30, 0x34, 0x74, 0x7E,
+    0xC2, 0x23, 0x82, 0xCB, 0xA8, 0xF4, 0x65, 0x68, 0x72, 0xFD, 0x7D, 0x71, 0x12, 0x54, 0x46, 0xCD,
+    0xA7, 0x38, 0x80, 0xC1, 0x8F, 0xB0, 0xD1, 0x46, 0x74, 0x8B, 0x4E, 0x68, 0xD7, 0x46, 0xBE, 0x71,
+    0x0F, 0x7E, 0xA3, 0x38, 0x74, 0x22, 0x85, 0xD0, 0x51, 0xC0, 0x42, 0x2E, 0x30, 0xFC, 0xEE, 0x0A,
+    0x9C, 0x39, 0xBE, 0x27, 0x4E, 0x3B, 0xC4, 0x5D, 0x74, 0x18, 0x07, 0x80, 0x9C, 0x80, 0x9E, 0x27,
+    0x57, 0xAB, 0xC8, 0xAB, 0x1F, 0x77, 0x9E, 0xFE, 0xF1, 0x75, 0xCC, 0x41, 0xA7, 0x6E, 0x01, 0x5F,
+    0xA7, 0xD3, 0x8B, 0x8D, 0x15, 0xCF, 0x11, 0x76, 0xB6, 0x93, 0x62, 0x93, 0xE1, 0x63, 0x1F, 0xBB,
+    0xAC, 0xF8, 0x5D, 0x8E, 0x96, 0x4C, 0x15, 0x33, 0x43, 0xCB, 0x57, 0x13, 0xF6, 0x9E, 0x3A, 0x42,
+    0x96, 0x09, 0x58, 0x4E, 0x50, 0xB2, 0xE1, 0x04, 0xA0, 0x49, 0x1B, 0x4E, 0xBB, 0x14, 0xE5, 0xDD,
+    0xC5, 0xA2, 0xB6, 0x1F, 0xBD, 0xA4, 0x13, 0x9A, 0xB5, 0x4B, 0x82, 0xA9, 0xEA, 0x64, 0x66, 0x81,
+    0x53, 0xBB, 0x64, 0x23, 0xCC, 0xD2, 0xC7, 0x33, 0x66, 0xEE, 0xA7, 0xD9, 0x46, 0x3F, 0x46, 0x1B,
+    0x79, 0x23, 0xF6, 0x13, 0xDF, 0x89, 0x7E, 0xE4, 0xA7, 0x1F, 0x71, 0x24, 0xC9, 0xE0, 0x49, 0x06,
+    0x4B, 0x72, 0x68, 0xF9, 0x57, 0x74, 0xE8, 0x2E, 0x12, 0xD0, 0xE7, 0x08, 0x74, 0x8A, 0x80, 0x69,
+    0x32, 0xF0, 0xBB, 0xED, 0x7D, 0x60, 0x74, 0xDA, 0x3A, 0xDB, 0xAC, 0xDD, 0x02, 0xFF, 0x3A, 0x9D,
+    0x4E, 0x36, 0x82, 0x37, 0xB9, 0xD7, 0x2D, 0xF6, 0xA7, 0x1F, 0xF0, 0x99, 0xFC, 0xF5, 0x3E, 0xF6,
+    0x9F, 0xBE, 0x47, 0x45, 0x72, 0xB2, 0x64, 0xAE, 0x48, 0x3F, 0x36, 0x7C, 0x35, 0xE1, 0x54, 0x64,
+    0x40, 0xD7, 0x2D, 0xA8, 0xDF, 0xA7, 0xC3, 0xEF, 0x98, 0xE3, 0xB8, 0xBB, 0x5E, 0x7E, 0x69, 0xAC,
+    0xFF, 0xFF, 0x16, 0x08, 0x9D, 0xAE, 0x23, 0x19, 0x1B, 0x92, 0x6B, 0xCD, 0x3B, 0x2D, 0x07, 0x8E,
+    0xF0, 0x93, 0x8D, 0x30, 0x73, 0x97, 0xA0, 0xD7, 0x36, 0x43, 0x51, 0xDC, 0x1D, 0x06, 0xF4, 0xE5,
+    0x9B, 0x05, 0x7A, 0x6D, 0x57, 0x28, 0xAA, 0xA3, 0x6F, 0x04, 0x16, 0xB0, 0xBB, 0xED, 0xEA, 0x41,
+    0x9B, 0xA0, 0x9B, 0x7F, 0xC3, 0xC1, 0xBF, 0xC9, 0x41, 0xD1, 0x73, 0xD0, 0x24, 0xD1, 0xF3, 0xC2,
+    0x5A, 0x73, 0x32, 0xB3, 0x26, 0xFC, 0x68, 0xE7, 0x9A, 0x8E, 0x41, 0xA7, 0x26, 0xC3, 0x46, 0x33,
+    0x83, 0x03, 0x43, 0xB3, 0x2A, 0xC2, 0xCC, 0x7A, 0x01, 0x43, 0x3F, 0x2A, 0xD6, 0x94, 0xC9, 0xD9,
+    0x8F, 0x36, 0xD6, 0x94, 0xB5, 0xB2, 0x7B, 0x9C, 0x2A, 0x0A, 0x95, 0x23, 0x04, 0x84, 0x47, 0x47,
+    0x72, 0x40, 0xC7, 0xC1, 0x47, 0x68, 0x42, 0x27, 0xB6, 0x84, 0xA2, 0xBF, 0x48, 0x57, 0x91, 0x6F,
+    0x33, 0x54, 0xBC, 0x9D, 0x38, 0x3D, 0xC6, 0x4F, 0x49, 0x92, 0xB3, 0x27, 0xC9, 0xB9, 0x25, 0xC9,
+    0x09, 0x8F, 0x91, 0x77, 0x76, 0x36, 0xB6, 0xC0, 0x3D, 0x4D, 0x51, 0xA0, 0x01, 0x1B, 0xDA, 0x0E,
+    0xCD, 0xE1, 0x54, 0x40, 0x25, 0xDA, 0xC1, 0xB0, 0xC0, 0x73, 0x04, 0xF0, 0x18, 0xB3, 0x03, 0xB0,
+    0xE7, 0x0A, 0xD0, 0x0B, 0xA0, 0x2F, 0xBE, 0x82, 0x93, 0x48, 0x41, 0xCD, 0x91, 0x37, 0xE7, 0x3E,
+    0xB6, 0xC9, 0xEB, 0x04, 0xBE, 0xF9, 0x09, 0x07, 0x93, 0x3C, 0xF3, 0x55, 0x2A, 0x92, 0x1C, 0xBB,
+    0xD2, 0x8E, 0xBB, 0xFB, 0x45, 0x9A, 0xB2, 0x54, 0xEC, 0x82, 0xAF, 0xA1, 0xE2, 0xCF, 0x2E, 0x38,
+    0x68, 0x72, 0x2E, 0x67, 0x84, 0xE7, 0x25, 0x00, 0x67, 0xF1, 0x1F, 0xBB, 0x40, 0xE4, 0x60, 0x71,
+    0x67, 0x05, 0x1B, 0x38, 0xAE, 0x52, 0x0B, 0xE0, 0x5C, 0xBC, 0xDD, 0xFF, 0x40, 0x52, 0x13, 0x75,
+    0x6D, 0xC7, 0x4D, 0x95, 0x0A, 0xE4, 0xD8, 0x1E, 0x6D, 0x4B, 0xA7, 0x2F, 0x17, 0xA7, 0xCA, 0x72,
+    0x45, 0xCF, 0x04, 0xC3, 0x0F, 0xA1, 0x28, 0x02, 0x68, 0x57, 0x39, 0x56, 0x97, 0x7F, 0xDD, 0x22,
+    0x1D, 0xB3, 0xF1, 0xE8, 0x5F, 0x3F, 0xC9, 0x36, 0x51, 0x9C, 0xF9, 0x8A, 0x03, 0x5A, 0x4E, 0xE8,
+    0xC5, 0xD4, 0x2F, 0x08, 0xD4, 0xD1, 0xA3, 0x9D, 0xA5, 0x1D, 0xE8, 0x26, 0x23, 0x92, 0xB0, 0xB7,
+    0x8A, 0x9A, 0xF4, 0x9B, 0x37, 0xD7, 0x67, 0x3C, 0xEC, 0xD1, 0x2E, 0xD0, 0x05, 0x21, 0x85, 0x9D,
+    0x14, 0x07, 0xD8, 0xA9, 0xA2, 0x33, 0x09, 0xF0, 0xA1, 0xC4, 0x59, 0x38, 0x08, 0xDE, 0x5C, 0x53,
+    0x20, 0x67, 0x34, 0x59, 0xE5, 0x56, 0x4C, 0xF1, 0x6E, 0xEE, 0x23, 0x80, 0x6E, 0xF6, 0x37, 0xE9,
+    0x04, 0x16, 0xEB, 0x17, 0xB9, 0x30, 0x39, 0x40, 0x62, 0x0C, 0xA9, 0x04, 0x91, 0x18, 0xC5, 0x15,
+    0xCE, 0x1C, 0x01, 0x74, 0xD9, 0x7E, 0x22, 0xC6, 0x51, 0xE4, 0x45, 0x02, 0xD0, 0x6C, 0x56, 0xBD,
+    0x02, 0xF0, 0xB3, 0x89, 0x5D, 0x02, 0x1A, 0x0E, 0x0C, 0x36, 0x02, 0x7D, 0x12, 0xC3, 0x48, 0x31,
+    0xE8, 0xA5, 0x66, 0x80, 0x95, 0x38, 0x0B, 0x6A, 0x89, 0xB3, 0x64, 0x74, 0x84, 0x4E, 0x12, 0x28,
+    0xC0, 0xE9, 0xCB, 0xA7, 0x2E, 0xCB, 0xE4, 0x40, 0xF1, 0x7F, 0xE7, 0x22, 0x16, 0x5F, 0x3C, 0xF4,
+    0xBA, 0x78, 0xEC, 0x38, 0x75, 0xDD, 0x1D, 0x5F, 0x01, 0x97, 0x00, 0xA0, 0xBA, 0x52, 0x71, 0x82,
+    0x0F, 0x0D, 0x43, 0xC7, 0xA0, 0x53, 0xCD, 0x54, 0x31, 0x83, 0x83, 0xA7, 0xDB, 0x63, 0xEC, 0xE6,
+    0x2E, 0xEF, 0x43, 0xB1, 0xA6, 0xA2, 0x03, 0xCC, 0x6C, 0xA2, 0x18, 0xDE, 0xE7, 0x28, 0x3A, 0xBB,
+    0x80, 0x39, 0x35, 0x0B, 0xD2, 0x61, 0x48, 0xD2, 0x95, 0x68, 0x8B, 0x40, 0x1D, 0x7C, 0x59, 0xA4,
+    0xA7, 0xE7, 0x6E, 0x06, 0x6A, 0xBE, 0xC4, 0xA7, 0x18, 0xF0, 0x28, 0xA3, 0x89, 0x9A, 0x97, 0x6B,
+    0xAE, 0x8A, 0xF0, 0x84, 0xA5, 0xB3, 0x93, 0x62, 0x6C, 0x38, 0x34, 0x2B, 0x5A, 0x96, 0xE5, 0x5A,
+    0xB9, 0x2F, 0x09, 0x0C, 0x84, 0xAF, 0x10, 0x18, 0x58, 0xA5, 0x85, 0x03, 0x34, 0x29, 0xC1, 0x6D,
+    0x0E, 0x15, 0xC7, 0x0B, 0x74, 0xED, 0x0A, 0x9D, 0x61, 0x23, 0xBA, 0x04, 0x86, 0x82, 0x22, 0x30,
+    0x74, 0x0B, 0x14, 0xE1, 0xC7, 0x02, 0xFC, 0xDA, 0xA8, 0x53, 0x59, 0xCA, 0x6D, 0xDE, 0xD9, 0x86,
+    0x8A, 0x01, 0x8F, 0xA0, 0x5F, 0x01, 0x4B, 0x4E, 0x05, 0x2B, 0x50, 0x12, 0x80, 0x90, 0x49, 0x7B,
+    0x7E, 0x27, 0x6D, 0x13, 0x1F, 0x16, 0x23, 0x78, 0xFB, 0xBE, 0x18, 0x01, 0x27, 0x54, 0xE4, 0x0C,
+    0xF8, 0xD2, 0xCC, 0x04, 0x4D, 0xCF, 0xA0, 0x32, 0x7C, 0xAC, 0xE8, 0xF4, 0x0A, 0x3F, 0x56, 0x1C,
+    0x6C, 0x44, 0x3F, 0xE9, 0x84, 0x6E, 0x69, 0xF2, 0x03, 0xA1, 0x6A, 0x4E, 0xF8, 0xD5, 0x8A, 0x33,
+    0xEA, 0x12, 0xDC, 0x4C, 0x80, 0xE1, 0x02, 0x34, 0x3C, 0x06, 0x93, 0xB1, 0x78, 0x19, 0x8C, 0x32,
+    0x88, 0x22, 0xA0, 0x09, 0xB0, 0x9F, 0x3D, 0xBF, 0x02, 0x8A, 0xF0, 0x01, 0x72, 0x11, 0xB4, 0x6B,
+    0x59, 0x9B, 0xDD, 0x02, 0xE8, 0xA5, 0xA6, 0x43, 0x4D, 0x27, 0xCB, 0xB7, 0x20, 0x71, 0x76, 0x02,
+    0xFA, 0xA9, 0x59, 0x01, 0x9D, 0xCA, 0x62, 0xD6, 0x09, 0x30, 0x0B, 0x18, 0xA0, 0x88, 0x6E, 0x01,
+    0xFC, 0x54, 0xD3, 0xC1, 0xAC, 0x30, 0x9F, 0x9D, 0x97, 0xC8, 0xF2, 0x5B, 0x8C, 0xB0, 0x9C, 0xB9,
+    0xA2, 0x21, 0x35, 0x01, 0xCF, 0xF1, 0xEC, 0x4E, 0xBB, 0x14, 0x75, 0x27, 0x66, 0x78, 0xF1, 0xCA,
+    0x45, 0x41, 0x16, 0x05, 0x2B, 0x1E, 0xE7, 0x3F, 0xDE, 0x2F, 0x61, 0x62, 0xF4, 0xA2, 0xC0, 0x39,
+    0x43, 0xF1, 0x23, 0x02, 0x3E, 0xDA, 0x28, 0x8E, 0x4F, 0xC5, 0xA1, 0x1F, 0xC5, 0xE9, 0x95, 0x18,
+    0xA6, 0x9F, 0x04, 0x1B, 0xE3, 0x20, 0xCE, 0xAE, 0x99, 0x6B, 0xA2, 0x21, 0x6C, 0xD4, 0x9C, 0x14,
+    0x0F, 0x99, 0xD0, 0xF3, 0x3D, 0xBA, 0x96, 0x89, 0x23, 0x3C, 0x5F, 0x72, 0x05, 0x99, 0xA8, 0x8F,
+    0xD4, 0xA1, 0x4E, 0x3B, 0xF0, 0xD4, 0xC6, 0x63, 0x90, 0xE9, 0x5A, 0xEC, 0xE9, 0x82, 0x3A, 0xCF,
+    0x7F, 0x0D, 0xEA, 0xDC, 0x4F, 0xE0, 0xAD, 0xC3, 0x87, 0xA3, 0xCE, 0x3B, 0xD0, 0xCF, 0x35, 0x19,
+    0x6A, 0x87, 0x3A, 0xAF, 0x0F, 0x43, 0x9D, 0x8F, 0xC1, 0xDC, 0x5D, 0x3A, 0x0A, 0xC3, 0xC8, 0xCE,
+    0xD3, 0x4B, 0x08, 0x6B, 0x02, 0xF6, 0x1B, 0x06, 0xC0, 0x93, 0x03, 0xE0, 0xC9, 0x9D, 0x9E, 0xE8,
+    0x39, 0x9E, 0x44, 0xF1, 0xFC, 0xA8, 0x08, 0x86, 0x46, 0x20, 0x82, 0x4A, 0x66, 0xAF, 0xD3, 0xA9,
+    0xA6, 0xEB, 0x16, 0x45, 0x67, 0x16, 0xC1, 0x20, 0x49, 0xC6, 0x96, 0x64, 0xD4, 0xF9, 0xD0, 0x4F,
+    0x3A, 0xC1, 0x8F, 0x7A, 0x81, 0x1F, 0xBB, 0x05, 0x0C, 0x66, 0x06, 0x83, 0x8D, 0x15, 0x07, 0x1B,
+    0x6B, 0xBA, 0x7E, 0x52, 0xDC, 0x76, 0x9D, 0x26, 0x17, 0xB8, 0x68, 0xE8, 0x13, 0x40, 0x41, 0xDC,
+    0x22, 0x20, 0x2D, 0xBB, 0x83, 0xA3, 0xA0, 0x60, 0xB3, 0xA2, 0xC9, 0xA8, 0xB9, 0xC1, 0xCB, 0x12,
+    0x52, 0x38, 0xEE, 0xB7, 0x08, 0x10, 0x7A, 0xEC, 0xEB, 0xA9, 0x60, 0xCF, 0x02, 0x3D, 0x0B, 0xF2,
+    0x5C, 0x80, 0x67, 0xC1, 0x9D, 0x05, 0x76, 0x96, 0xF0, 0xC0, 0xCE, 0xF1, 0x29, 0xBF, 0x2E, 0x5E,
+    0xCF, 0x9D, 0xF3, 0x02, 0xE6, 0xB7, 0x2B, 0x14, 0x79, 0x91, 0x00, 0xC5, 0xA4, 0x93, 0x75, 0x24,
+    0x40, 0x87, 0xA0, 0x1F, 0x82, 0xAA, 0x35, 0x2C, 0x7E, 0xE2, 0xD1, 0xBE, 0x5F, 0xC0, 0x51, 0xC1,
+    0xA5, 0xA3, 0x88, 0x53, 0x27, 0x59, 0xC4, 0x32, 0x62, 0x0C, 0x35, 0x5D, 0xB7, 0xC0, 0xCE, 0x35,
+    0x07, 0x01, 0xA4, 0xFB, 0xCD, 0xBB, 0x8F, 0x82, 0x46, 0xCB, 0x92, 0xE2, 0x20, 0x01, 0x3E, 0x86,
+    0x9A, 0x4E, 0x33, 0xD9, 0x58, 0x91, 0xE7, 0x08, 0xC3, 0xD8, 0x4F, 0x8A, 0x79, 0xB7, 0x37, 0xEB,
+    0xE5, 0xE4, 0xBC, 0x14, 0x6F, 0x92, 0x01, 0xC0, 0xE9, 0x2B, 0x22, 0xCF, 0x8D, 0x2E, 0x71, 0xCC,
+    0xB4, 0x5F, 0x6C, 0x84, 0x99, 0xFB, 0x09, 0x66, 0xEE, 0x47, 0xD8, 0xE8, 0x47, 0xD8, 0xC8, 0x80,
+    0x7E, 0x92, 0x60, 0xE6, 0xD4, 0x30, 0x90, 0x64, 0xE8, 0xEF, 0x33, 0xED, 0xCF, 0x1C, 0x0D, 0xA9,
+    0xCA, 0x65, 0x5C, 0x35, 0x57, 0x48, 0xD4, 0xC3, 0x30, 0x95, 0x88, 0xF5, 0x7D, 0xAC, 0x15, 0x7F,
+    0x14, 0xB4, 0x1E, 0x8E, 0x47, 0x9D, 0xFF, 0x1D, 0x5C, 0x9D, 0xE7, 0x8E, 0xB9, 0x3A, 0xC5, 0xD3,
+    0x89, 0x50, 0xCC, 0x40, 0xCF, 0x09, 0xED, 0xE6, 0xDF, 0xE8, 0xB9, 0x38, 0x82, 0x26, 0x96, 0xA6,
+    0x3E, 0x7E, 0x49, 0x10, 0x4A, 0x34, 0x1C, 0xD1, 0x67, 0xC0, 0x12, 0x35, 0x17, 0xD4, 0x4C, 0xD0,
+    0x9C, 0xA0, 0x19, 0x61, 0x39, 0xC0, 0x73, 0x00, 0x09, 0xC5, 0x15, 0x0D, 0x13, 0xCC, 0xED, 0x08,
+    0x73, 0x3B, 0x82, 0x3E, 0x80, 0x7D, 0x68, 0x3F, 0xCF, 0x50, 0xAB, 0x87, 0x7D, 0x6B, 0x41, 0xF7,
+    0xF3, 0x54, 0xAF, 0x76, 0x44, 0xFF, 0x66, 0xD4, 0x9F, 0x10, 0x35, 0x4D, 0xF0, 0xCF, 0x26, 0xE8,
+    0xC5, 0x9F, 0x4B, 0x76, 0x82, 0x7D, 0x7B, 0x35, 0x23, 0x5D, 0xC5, 0x66, 0x66, 0x93, 0xD0, 0xA6,
+    0xEE, 0xDD, 0xD9, 0x44, 0xD8, 0xA9, 0xF7, 0xC1, 0x07, 0xD0, 0x71, 0x55, 0x19, 0x6A, 0x55, 0x8C,
+    0xFA, 0xCE, 0xF9, 0x2E, 0x6A, 0xBA, 0x9E, 0xD1, 0x07, 0x9B, 0x6A, 0xF2, 0x62, 0x06, 0x47, 0xCD,
+    0xA4, 0x67, 0x45, 0xD8, 0xA2, 0xCC, 0x37, 0xCE, 0xC1, 0x86, 0xC2, 0x89, 0xBF, 0x5D, 0xA6, 0xE2,
+    0xB6, 0xFA, 0xB7, 0xD9, 0x28, 0xE8, 0xEC, 0x06, 0xD2, 0xCF, 0x30, 0x74, 0x9A, 0x23, 0xB8, 0xC2,
+    0xD2, 0xB5, 0x8C, 0x60, 0x46, 0xCF, 0xD0, 0x70, 0x51, 0xCC, 0x30, 0x9C, 0x3A, 0xCE, 0xA0, 0x1F,
+    0xD8, 0x07, 0xB5, 0xB2, 0xB9, 0x43, 0x74, 0x9F, 0x26, 0xFB, 0x66, 0x42, 0xFF, 0xD6, 0x27, 0xD9,
+    0x4E, 0x75, 0xB6, 0x6F, 0x45, 0x3A, 0xBD, 0xB0, 0x7F, 0x25, 0xC1, 0xBE, 0xC3, 0x64, 0x62, 0xC5,
+    0x96, 0x13, 0x87, 0x36, 0x19, 0x2A, 0xFE, 0xC0, 0x4C, 0x7E, 0xD1, 0x9C, 0xF9, 0x12, 0x43, 0xCF,
+    0x9B, 0x6B, 0x93, 0x6B, 0x99, 0xA7, 0xA2, 0x4B, 0x37, 0x0D, 0xDF, 0xA4, 0x63, 0x5C, 0x10, 0x99,
+    0xB8, 0x1B, 0xEC, 0xF2, 0xF8, 0xA5, 0xFF, 0x60, 0xB6, 0xA5, 0xD8, 0x95, 0xED, 0xD2, 0x2E, 0x40,
+    0x93, 0xAF, 0xC6, 0x2D, 0x18, 0xFE, 0x10, 0x63, 0xD2, 0xCF, 0x00, 0xC0, 0x05, 0x40, 0x4D, 0x61,
+    0x98, 0x25, 0x00, 0xFA, 0x5E, 0x02, 0xD0, 0x7D, 0x91, 0x00, 0xD8, 0x0F, 0x12, 0x80, 0xFE, 0xC7,
+    0x2B, 0x00, 0xDE, 0x5C, 0x81, 0x8A, 0xE7, 0x56, 0x21, 0xED, 0x00, 0xCD, 0x5A, 0x67, 0x40, 0xA7,
+    0x9A, 0x40, 0x37, 0xD7, 0xDC, 0x82, 0x24, 0xBE, 0x70, 0x92, 0x36, 0x65, 0xE5, 0x14, 0x0F, 0x7E,
+    0x9F, 0xAE, 0x5D, 0x01, 0x09, 0x3E, 0x71, 0x30, 0xB3, 0x98, 0xA8, 0x10, 0x4C, 0x02, 0x0C, 0x62,
+    0x01, 0xDA, 0x60, 0x03, 0x58, 0x67, 0x09, 0x99, 0x2A, 0x12, 0xA8, 0xFC, 0xA5, 0xD2, 0xDE, 0x7F,
+    0x02, 0xC0, 0x50, 0xC7, 0x9A, 0xEC, 0x83, 0x21, 0x73, 0xC5, 0xBB, 0x9C, 0x35, 0x2B, 0x8E, 0x7D,
+    0x54, 0xAC, 0x39, 0xE8, 0xA4, 0x13, 0xEC, 0x64, 0x63, 0xC5, 0xA7, 0x38, 0xB4, 0xC5, 0xD1, 0x5C,
+    0x2A, 0x06, 0x3F, 0xE9, 0x5C, 0x31, 0xF8, 0x59, 0xF1, 0x36, 0x83, 0x26, 0x89, 0x8E, 0x1F, 0x2D,
+    0xE8, 0x56, 0x33, 0xA1, 0x3A, 0x2E, 0x15, 0x1D, 0x56, 0x40, 0x65, 0x33, 0x01, 0xF6, 0x9D, 0x0C,
+    0xD4, 0xA9, 0x0B, 0x40, 0x85, 0x33, 0x0F, 0x11, 0x9E, 0x16, 0x78, 0x50, 0x36, 0x9E, 0x50, 0x44,
+    0x57, 0xB1, 0x0F, 0x45, 0x72, 0xCD, 0x6A, 0xC7, 0x22, 0xB8, 0x6E, 0xB6, 0x63, 0x91, 0x5B, 0x3F,
+    0x9A, 0x49, 0xC4, 0x56, 0xD1, 0x99, 0x28, 0x52, 0x6B, 0x37, 0x06, 0x0D, 0x61, 0x48, 0xCE, 0x22,
+    0x33, 0x3F, 0x42, 0xCF, 0x3A, 0x01, 0x7C, 0x99, 0x0E, 0x7A, 0xB1, 0x11, 0xE0, 0x9B, 0xEB, 0x11,
+    0x9E, 0xA7, 0xC3, 0x6B, 0x80, 0x7F, 0x25, 0x41, 0x65, 0x13, 0xD1, 0xC6, 0xDE, 0x1D, 0x6B, 0xEA,
+    0xDF, 0xB8, 0xC0, 0x64, 0x6B, 0x2F, 0xAF, 0x13, 0x50, 0x6D, 0xF6, 0x33, 0x25, 0x56, 0x0A, 0xFF,
+    0x31, 0x0F, 0x0E, 0x00, 0xF4, 0x9F, 0x6C, 0x56, 0x50, 0x41, 0xD2, 0x96, 0x0D, 0x96, 0x2C, 0xD1,
+    0xE4, 0xB5, 0xE1, 0xC1, 0x79, 0xA0, 0xA1, 0x78, 0x92, 0x8A, 0x62, 0x3B, 0xD6, 0x1C, 0x2C, 0x19,
+    0x51, 0x31, 0xE8, 0x7C, 0x78, 0x05, 0x20, 0x65, 0xE9, 0x79, 0xB1, 0xCF, 0xD1, 0x73, 0x0B, 0x87,
+    0x89, 0x9D, 0x6E, 0xD6, 0x83, 0x17, 0x0A, 0x14, 0x23, 0x3B, 0x73, 0x16, 0x93, 0xB9, 0x91, 0x19,
+    0x39, 0x2A, 0x3A, 0x58, 0x32, 0xD6, 0x62, 0x63, 0x25, 0xA0, 0xFA, 0x33, 0xE0, 0x9F, 0x00, 0x86,
+    0xFA, 0x3D, 0x8E, 0x20, 0xDF, 0xA3, 0xD0, 0x50, 0xC9, 0xD4, 0xF0, 0x5D, 0xAE, 0x3A, 0xE9, 0x5C,
+    0x33, 0x36, 0xA9, 0x4B, 0x15, 0x43, 0x9B, 0xCC, 0x0C, 0x06, 0x93, 0x6C, 0x04, 0x6F, 0x71, 0xB6,
+    0xB1, 0x22, 0x39, 0xF6, 0x53, 0x4D, 0x66, 0xF4, 0xA3, 0xE2, 0xDD, 0x7D, 0xF8, 0xB1, 0x21, 0x00,
+    0x3F, 0x69, 0x02, 0xE8, 0xA3, 0xE1, 0x50, 0x39, 0x9B, 0xC9, 0x9F, 0x5D, 0x18, 0xAC, 0x60, 0x8E,
+    0x9A, 0x1F, 0x91, 0x74, 0x0D, 0x5F, 0xF9, 0x80, 0x77, 0x80, 0x33, 0xC7, 0xDD, 0x7A, 0xEF, 0x6C,
+    0x40, 0x37, 0x99, 0x08, 0x95, 0xAF, 0xC6, 0xE2, 0x0F, 0x1E, 0x37, 0x7B, 0x37, 0x1E, 0x62, 0xB3,
+    0x2D, 0xB1, 0x01, 0x24, 0x27, 0x21, 0x22, 0x3E, 0x9C, 0xF7, 0xF9, 0xD9, 0xC1, 0x3E, 0x3A, 0x72,
+    0x41, 0x23, 0x91, 0x58, 0x12, 0xE0, 0xAD, 0xC3, 0xE1, 0x41, 0x32, 0xED, 0x49, 0xAE, 0x68, 0x47,
+    0x26, 0xB4, 0x64, 0x86, 0xDA, 0xAE, 0x33, 0x02, 0xA7, 0x2F, 0x9F, 0xBA, 0x02, 0x1B, 0xCC, 0x08,
+    0xFF, 0x14, 0xC5, 0xD6, 0xAF, 0x49, 0x07, 0x5C, 0xDD, 0xD6, 0xEA, 0xAF, 0xEF, 0x03, 0x2D, 0x17,
+    0x54, 0x85, 0x2F, 0x39, 0x83, 0x53, 0x3F, 0xE9, 0x15, 0x1C, 0xFA, 0x49, 0xE5, 0x9A, 0xAE, 0x9F,
+    0x75, 0xBE, 0xCA, 0xD0, 0x0B, 0x3F, 0x91, 0xAE, 0xE5, 0x2D, 0x27, 0x68, 0x81, 0xB8, 0x66, 0x01,
+    0x83, 0xE2, 0xCF, 0xBC, 0x50, 0x4F, 0x5A, 0x32, 0xA2, 0x61, 0x3E, 0xE1, 0x8C, 0x3C, 0xC6, 0x3B,
+    0xD8, 0x91, 0x20, 0xA3, 0x90, 0x03, 0xEF, 0xA0, 0x4F, 0xDB, 0x0E, 0xD1, 0xE6, 0xDD, 0x8E, 0x5E,
+    0x9E, 0xAA, 0x6F, 0x92, 0xB8, 0x40, 0x52, 0x6D, 0xC1, 0xB0, 0xD5, 0xF2, 0xCF, 0x5F, 0x48, 0xFD,
+    0x8C, 0x2E, 0xF9, 0x09, 0x76, 0x61, 0x80, 0x8F, 0x0C, 0x35, 0x47, 0x4E, 0xAD, 0x00, 0x80, 0xE2,
+    0xC0, 0x74, 0xE4, 0x04, 0xD1, 0xFB, 0x7B, 0x0E, 0x40, 0xF5, 0xC7, 0x40, 0xCB, 0x12, 0xD9, 0xEE,
+    0xC8, 0x58, 0x7D, 0xD6, 0x70, 0x28, 0xF0, 0x5F, 0x89, 0xA1, 0x9C, 0x12, 0x5C, 0x35, 0x35, 0x24,
+    0x6F, 0xF0, 0xCE, 0x85, 0xC5, 0xCE, 0x8A, 0x2A, 0xA3, 0x8F, 0x76, 0xD2, 0xAB, 0xE2, 0x33, 0x1C,
+    0x8C, 0xB4, 0x7C, 0x41, 0xCD, 0x05, 0xC0, 0x91, 0xDD, 0xDA, 0xAB, 0x08, 0xF0, 0xD9, 0x05, 0xE0,
+    0x73, 0x0B, 0xC0, 0x36, 0x02, 0x67, 0x70, 0xDC, 0xF3, 0xFD, 0x5B, 0xED, 0xBE, 0x6C, 0x75, 0x4F,
+    0xCF, 0x68, 0x97, 0x3E, 0x80, 0xDF, 0x49, 0xA2, 0x7B, 0x1E, 0xD9, 0x5A, 0xF8, 0xEB, 0x97, 0x64,
+    0xDE, 0x76, 0xC5, 0x19, 0x40, 0xB7, 0xDF, 0x2F, 0x65, 0x07, 0xDF, 0x28, 0xB5, 0x17, 0x64, 0xE4,
+    0x43, 0x4F, 0xA6, 0x8E, 0xFF, 0x92, 0x17, 0xE9, 0x6C, 0xB4, 0x53, 0x43, 0x95, 0xC1, 0xD1, 0xCE,
+    0xFD, 0x52, 0x53, 0xD8, 0xC8, 0x03, 0x0C, 0x07, 0x89, 0x27, 0x1F, 0x7F, 0x54, 0x49, 0x17, 0x83,
+    0x60, 0x2E, 0x86, 0x97, 0xFD, 0x71, 0x31, 0x0D, 0xD8, 0x16, 0xF2, 0xA2, 0xAB, 0xFE, 0x7F, 0x83,
+    0xA1, 0x1C, 0x79, 0xE9, 0x4F, 0x8B, 0x3D, 0xD0, 0xA4, 0x5E, 0xE4, 0xE3, 0xDF, 0x90, 0x03, 0x9A,
+    0xD9, 0x8A, 0x9C, 0x1E, 0xC1, 0x7F, 0xA2, 0x18, 0x8A, 0x3C, 0xAE, 0x37, 0x13, 0x2A, 0xEA, 0x28,
+    0x4F, 0x58, 0xF5, 0x04, 0x9C, 0x39, 0x31, 0xD0, 0x7F, 0x5B, 0xCC, 0xD4, 0xB3, 0x5B, 0x1B, 0xEB,
+    0xA5, 0x0B, 0x15, 0xF5, 0x8C, 0xFE, 0x66, 0x82, 0x1E, 0x33, 0xE0, 0x1E, 0xD9, 0x2D, 0x8D, 0x5A,
+    0x56, 0x45, 0x86, 0x25, 0xC7, 0xF6, 0x52, 0xBF, 0x88, 0x25, 0x5F, 0x71, 0x40, 0x55, 0x58, 0xD5,
+    0x9E, 0x0E, 0x96, 0x33, 0xF6, 0x9E, 0x67, 0x51, 0x89, 0xDD, 0x02, 0xE8, 0xDC, 0xDC, 0xBA, 0xCA,
+    0xA7, 0x4A, 0xD4, 0x6A, 0xE8, 0x98, 0x1D, 0xF6, 0xF6, 0x65, 0x3F, 0xC8, 0xE8, 0xC8, 0x0C, 0x53,
+    0x28, 0x10, 0x09, 0x67, 0x0F, 0x84, 0x17, 0x18, 0x8A, 0x2E, 0xB0, 0x4B, 0x71, 0x9E, 0x95, 0x04,
+    0x64, 0x2F, 0x95, 0xD8, 0xA4, 0x26, 0x81, 0xBD, 0xE7, 0x77, 0x01, 0x5A, 0x71, 0xF7, 0x84, 0xC9,
+    0x33, 0x02, 0x15, 0xC3, 0xEF, 0xA1, 0x61, 0xB0, 0x77, 0x85, 0x2C, 0xBE, 0x0A, 0x05, 0xE2, 0x31,
+    0xD2, 0x1D, 0x57, 0x06, 0xA6, 0x10, 0xE9, 0xCB, 0xD3, 0xE3, 0x87, 0x9C, 0xCB, 0xF9, 0x1A, 0x6E,
+    0x61, 0x91, 0x3E, 0x96, 0x8F, 0x5A, 0xD9, 0x9B, 0x1D, 0xD0, 0x71, 0x06, 0x3A, 0x66, 0x60, 0xEF,
+    0xC2, 0x8E, 0xA3, 0x51, 0x9D, 0x94, 0x78, 0x25, 0x36, 0x86, 0x03, 0x5A, 0xE2, 0x5F, 0xA0, 0xCF,
+    0xE8, 0x0B, 0xD7, 0x24, 0x0A, 0x5A, 0xD2, 0x1E, 0x33, 0x80, 0xAB, 0x83, 0x03, 0x07, 0x34, 0xE4,
+    0x00, 0xB4, 0xDB, 0xB3, 0x3B, 0x49, 0x8E, 0x89, 0x30, 0x19, 0x26, 0xC2, 0x66, 0xD8, 0x08, 0x4A,
+    0x36, 0x48, 0x82, 0x1D, 0x15, 0x13, 0xFA, 0xA0, 0xB9, 0xC0, 0x87, 0x8E, 0x33, 0x18, 0xEC, 0xED,
+    0x19, 0x1C, 0xFC, 0xF7, 0x22, 0xF8, 0x14, 0x4D, 0xAC, 0xA8, 0x56, 0x3B, 0xD5, 0x6C, 0x93, 0x1D,
+    0x55, 0xEE, 0x62, 0x1F, 0xD4, 0x6A, 0x27, 0x1F, 0x9A, 0xE4, 0x03, 0x43, 0xBB, 0x12, 0x1C, 0xDA,
+    0x7B, 0xB9, 0xA2, 0xD3, 0x4C, 0x15, 0xA1, 0x39, 0xD7, 0x44, 0xC7, 0x49, 0xA8, 0xD7, 0x2A, 0xC3,
+    0xD2, 0x35, 0x2B, 0x2C, 0x85, 0x13, 0x2E, 0xA1, 0xF6, 0x83, 0x03, 0x27, 0x32, 0xF0, 0xB2, 0x93,
+    0x86, 0xA3, 0xB6, 0xDA, 0x58, 0xD1, 0x31, 0xB4, 0x47, 0x41, 0x93, 0xE0, 0x43, 0x93, 0x25, 0x68,
+    0x92, 0xC0, 0xD0, 0x4F, 0x8A, 0x35, 0x9D, 0x5E, 0x74, 0x82, 0x9F, 0x6C, 0x54, 0x74, 0x1C, 0xBA,
+    0xA4, 0x32, 0x18, 0x75, 0x6A, 0x39, 0xD8, 0xCC, 0x15, 0xE4, 0x7B, 0xB1, 0x62, 0xB6, 0xA1, 0xE2,
+    0xC8, 0xE3, 0xFB, 0x0C, 0xA0, 0xA2, 0x71, 0x10, 0x3D, 0x0E, 0xBD, 0xF8, 0x00, 0x51, 0xE5, 0x47,
+    0x13, 0xF6, 0x3F, 0x56, 0xB1, 0x89, 0xEA, 0x1F, 0x8B, 0x01, 0x5C, 0x67, 0x13, 0xD1, 0x9C, 0x34,
+    0x80, 0x65, 0xDB, 0xEB, 0x66, 0x9D, 0xE0, 0x77, 0x82, 0x4A, 0x6D, 0x42, 0x3F, 0xD9, 0xF8, 0x90,
+    0x60, 0x54, 0x9B, 0x15, 0x61, 0x67, 0xBD, 0x54, 0x0C, 0x76, 0xD2, 0x04, 0x83, 0x5F, 0x14, 0x6F,
+    0x73, 0xD4, 0x5C, 0x89, 0x8E, 0x1F, 0x24, 0x74, 0xAB, 0x8E, 0x27, 0x77, 0x22, 0xF3, 0xD2, 0x82,
+    0xA2, 0x89, 0x9A, 0x64, 0x03, 0x64, 0xB9, 0xDF, 0xA7, 0x63, 0x37, 0x4E, 0x56, 0x5B, 0xD0, 0x21,
+    0x46, 0x68, 0x51, 0x4D, 0x6B, 0xC3, 0xB1, 0xE1, 0xA0, 0x18, 0xEC, 0x82, 0x86, 0x35, 0x03, 0x74,
+    0xD2, 0x2B, 0x60, 0x67, 0x1B, 0x01, 0x0A, 0xA5, 0xF4, 0xD9, 0x0C, 0xE8, 0x24, 0x0C, 0x21, 0x06,
+    0x54, 0xBC, 0x49, 0xA0, 0xCD, 0x3A, 0x01, 0x76, 0xB6, 0x33, 0x6A, 0x06, 0x4E, 0xD0, 0xB9, 0x66,
+    0x00, 0xA3, 0xE2, 0xD8, 0xD1, 0xB5, 0x24, 0x17, 0xE8, 0x0D, 0x32, 0x9E, 0x81, 0x46, 0x58, 0x63,
+    0x5F, 0xDB, 0xB5, 0xE9, 0x45, 0x15, 0x65, 0xF7, 0xA4, 0x9E, 0xA1, 0x27, 0x7F, 0xCC, 0xC8, 0x38,
+    0x75, 0x09, 0xE8, 0x18, 0xD1, 0x92, 0x63, 0x4D, 0x12, 0x7D, 0xF6, 0xB3, 0xCE, 0x15, 0x6F, 0x30,
+    0xE8, 0x64, 0x67, 0xF0, 0x26, 0xA1, 0x53, 0x3F, 0x81, 0x6F, 0x64, 0xE8, 0xE4, 0xC7, 0x8A, 0xDF,
+    0x59, 0x61, 0xE7, 0x7E, 0x6A, 0xD8, 0xB0, 0xE2, 0x64, 0xB3, 0xEC, 0xF0, 0x68, 0xB9, 0xD1, 0x15,
+    0xF6, 0x8E, 0xC9, 0xA4, 0xA7, 0x03, 0x0C, 0x19, 0xA0, 0x76, 0x78, 0x76, 0x50, 0x9C, 0x5A, 0xBA,
+    0x6E, 0x95, 0x84, 0x2D, 0x21, 0x16, 0xC3, 0x46, 0x3B, 0x03, 0x7E, 0x64, 0x40, 0xCD, 0x67, 0x48,
+    0x72, 0x95, 0x70, 0x3D, 0x59, 0x98, 0x4D, 0xA4, 0xF8, 0xCE, 0x36, 0x02, 0x1C, 0x19, 0xD0, 0x50,
+    0xD1, 0xC1, 0x2E, 0x2D, 0x51, 0x33, 0xE8, 0x0C, 0xBB, 0xC2, 0xF0, 0xB6, 0xC4, 0x45, 0x33, 0x24,
+    0xB7, 0x48, 0xB4, 0xCF, 0xB6, 0x1C, 0xFE, 0x18, 0xA8, 0xC4, 0x7F, 0x5D, 0x61, 0xC8, 0xD8, 0xF0,
+    0x7F, 0xA6, 0xE3, 0xD8, 0xA5, 0x6E, 0x29, 0x7D, 0xB5, 0x24, 0xDF, 0x20, 0x99, 0x7A, 0x92, 0x6F,
+    0xE6, 0xC3, 0xAB, 0x8B, 0x1F, 0x6B, 0x3E, 0xB3, 0xC2, 0xC6, 0x3E, 0xEA, 0xAC, 0xF8, 0x31, 0x43,
+    0x27, 0x5C, 0x92, 0x84, 0x8A, 0xEB, 0x09, 0x73, 0x55, 0x4C, 0x3A, 0xB5, 0xDA, 0x09, 0xD0, 0x91,
+    0x0E, 0xB0, 0x2F, 0x27, 0xDC, 0x6F, 0xD5, 0x7D, 0xF9, 0x3C, 0x59, 0x6A, 0x8E, 0x0D, 0x5D, 0xCD,
+    0x60, 0x67, 0xA8, 0x63, 0xF3, 0xC4, 0xCC, 0x56, 0xC8, 0xE1, 0x24, 0xF9, 0x2C, 0x49, 0x26, 0x7B,
+    0x5C, 0x3A, 0x1B, 0xD3, 0xD8, 0xCE, 0x36, 0xA2, 0x62, 0xE0, 0x58, 0xE6, 0x89, 0x8F, 0x8A, 0x83,
+    0xA6, 0x6B, 0x79, 0xEF, 0xAF, 0x9B, 0x27, 0xAF, 0xB5, 0x13, 0xBA, 0x48, 0xD4, 0xEC, 0x22, 0xBA,
+    0x31, 0x1F, 0xDB, 0x6F, 0x1F, 0x9C, 0x27, 0x77, 0xFA, 0x59, 0xAF, 0x15, 0x6F, 0x70, 0xD8, 0x22,
+    0xDF, 0x45, 0x64, 0x6F, 0x90, 0x4C, 0xFE, 0xD6, 0x21, 0xBF, 0xB3, 0xC2, 0xCC, 0xFD, 0xA8, 0xD8,
+    0x10, 0x9C, 0x6C, 0xF6, 0xBF, 0x60, 0x9E, 0xBC, 0xD8, 0x44, 0xC0, 0xDE, 0x5C, 0x8B, 0xD4, 0xD4,
+    0x62, 0xC2, 0x03, 0x42, 0x7B, 0x8C, 0x4B, 0x19, 0x52, 0x4D, 0xAE, 0x65, 0xE7, 0xFF, 0x07, 0xF0,
+    0xCB, 0x0E, 0x44, 0x12, 0xAE, 0xCD, 0x2E, 0x82, 0x5E, 0x6D, 0x3E, 0xD3, 0xB6, 0x77, 0xAF, 0xD0,
+    0x12, 0x4C, 0x90, 0xBD, 0xC7, 0x4F, 0xBB, 0x6C, 0xB2, 0x04, 0xC0, 0xAC, 0x18, 0xD1, 0x67, 0x71,
+    0xD5, 0x35, 0x49, 0x28, 0x0A, 0x32, 0xB7, 0xE0, 0xD8, 0xA6, 0x0F, 0xF3, 0xD2, 0x82, 0xFE, 0x66,
+    0x42, 0x7F, 0x33, 0xC1, 0x9E, 0x5B, 0x76, 0x3A, 0xE0, 0xEC, 0x3E, 0x4E, 0x31, 0xA3, 0x11, 0x38,
+    0x7C, 0xAA, 0xFF, 0x9C, 0x51, 0x50, 0xAD, 0x92, 0x6B, 0x22, 0x59, 0x8F, 0x4B, 0x45, 0xCE, 0xD5,
+    0xA1, 0x2F, 0xA8, 0x8F, 0x9F, 0x50, 0x31, 0xBC, 0x78, 0x95, 0x43, 0x4F, 0x16, 0xDC, 0x68, 0x2C,
+    0x93, 0xF5, 0xEC, 0xC1, 0xF9, 0x5D, 0x96, 0x08, 0xE9, 0x00, 0xCB, 0x93, 0x36, 0xA0, 0x8D, 0xA8,
+    0x39, 0xF8, 0x00, 0x9D, 0x2A, 0x3A, 0xF8, 0x49, 0xE5, 0x02, 0xB7, 0xDB, 0x19, 0x26, 0x0A, 0xC5,
+    0x5C, 0x02, 0x4F, 0xFD, 0x04, 0x45, 0x45, 0xA0, 0x4D, 0xDD, 0x02, 0x74, 0x33, 0x03, 0x60, 0x3F,
+    0x5E, 0x01, 0x78, 0xC9, 0xA5, 0x91, 0x8D, 0x59, 0x42, 0xCD, 0x41, 0xC4, 0xB1, 0x31, 0x23, 0x25,
+    0x7C, 0xE1, 0x17, 0xC8, 0xE0, 0x15, 0x3A, 0x93, 0x97, 0x6D, 0x7B, 0x39, 0x3E, 0x89, 0xCE, 0x1E,
+    0x9C, 0x47, 0xC9, 0x1D, 0x91, 0x7D, 0xD9, 0xF0, 0x04, 0x8B, 0x53, 0x48, 0x5E, 0x25, 0x85, 0xCC,
+    0xC6, 0x9A, 0x83, 0x84, 0x5F, 0x6A, 0xA1, 0x40, 0x25, 0x45, 0xA0, 0x8B, 0x66, 0x06, 0xEC, 0xC8,
+    0x00, 0xF0, 0xD9, 0x15, 0x50, 0xAB, 0x8D, 0x80, 0xBE, 0x43, 0x07, 0x98, 0x8F, 0x13, 0x80, 0xDE,
+    0x8F, 0x10, 0xCA, 0x29, 0x94, 0x50, 0xC4, 0x39, 0x6C, 0xC3, 0x28, 0xC3, 0x2A, 0xD1, 0x62, 0xB3,
+    0xEC, 0x06, 0xBB, 0x5B, 0x21, 0x20, 0x6B, 0xE9, 0xAA, 0xF8, 0xDA, 0xFA, 0x44, 0xC0, 0x76, 0x6D,
+    0xC7, 0x6D, 0x93, 0xB4, 0x3F, 0x25, 0x00, 0xDF, 0xCC, 0xB8, 0xDF, 0xEA, 0x84, 0x22, 0x60, 0x96,
+    0x36, 0x41, 0xE2, 0x31, 0x6D, 0x2E, 0xD4, 0x24, 0x06, 0x45, 0x57, 0x13, 0x5D, 0x42, 0xB3, 0x82,
+    0x23, 0xF4, 0xD2, 0x64, 0x08, 0x17, 0x07, 0xFE, 0x06, 0x07, 0x54, 0x7C, 0x2E, 0x01, 0x2A, 0xFB,
+    0xB1, 0x90, 0x6C, 0xD0, 0x31, 0x02, 0xB0, 0x62, 0x81, 0x26, 0x00, 0x35, 0x47, 0x00, 0xAD, 0x64,
+    0xCC, 0xCC, 0x00, 0x5A, 0x89, 0x7E, 0x48, 0xFC, 0x3D, 0x00, 0x2D, 0xC5, 0x10, 0x1F, 0x4E, 0x18,
+    0xCB, 0xDB, 0xF2, 0x2D, 0x9B, 0x93, 0xF9, 0x84, 0x00, 0xFA, 0x73, 0xCB, 0x83, 0xAD, 0x87, 0x9D,
+    0xE0, 0x27, 0x70, 0x90, 0x38, 0x82, 0x59, 0xA0, 0x13, 0x18, 0x60, 0x62, 0x9B, 0x81, 0x3E, 0xD8,
+    0x88, 0x8A, 0x35, 0x1D, 0x94, 0x30, 0xD4, 0x66, 0x3F, 0x02, 0xF6, 0xC7, 0x04, 0xC0, 0xEF, 0xCD,
+    0x40, 0x9D, 0x7D, 0x00, 0x9A, 0x7B, 0x2B, 0x50, 0xF2, 0x8F, 0x84, 0xE8, 0xC6, 0xA5, 0x84, 0x19,
+    0x4F, 0xC4, 0x1D, 0x6B, 0xA1, 0x83, 0x49, 0xF8, 0x69, 0x44, 0x71, 0xEF, 0xA5, 0xD7, 0x02, 0x56,
+    0xEE, 0xD0, 0xF4, 0xC3, 0xFF, 0xEA, 0xFB, 0x80, 0x62, 0xB7, 0x00, 0x6D, 0xB2, 0x13, 0xD0, 0x4D,
+    0xDE, 0x01, 0xF6, 0xA9, 0x15, 0xC0, 0x35, 0x35, 0x3D, 0x64, 0x0C, 0x6A, 0x16, 0xDB, 0x49, 0x7A,
+    0x24, 0x31, 0x11, 0x45, 0x07, 0x1F, 0x1A, 0xA2, 0xCC, 0x7D, 0x3B, 0x75, 0xCB, 0x36, 0x0A, 0xE2,
+    0xCE, 0xC8, 0xE4, 0xD7, 0x77, 0xC5, 0xD8, 0xE4, 0x0E, 0x14, 0x55, 0xA5, 0x0F, 0x71, 0x37, 0x0E,
+    0x42, 0x1C, 0x95, 0xE9, 0x6F, 0xF2, 0x2E, 0x00, 0xE5, 0x19, 0xB7, 0xF9, 0x5F, 0x7A, 0xB1, 0x1B,
+    0x89, 0xD2, 0x0B, 0x9D, 0x76, 0xBD, 0x88, 0x7E, 0x00, 0xEC, 0x4B, 0x2B, 0x80, 0xD7, 0xEA, 0xF8,
+    0xB0, 0xB1, 0xB0, 0x93, 0xC4, 0x89, 0x6A, 0x0E, 0x25, 0x4C, 0x29, 0x83, 0xD1, 0x45, 0x9D, 0xB6,
+    0xE5, 0xA0, 0x67, 0x1B, 0xB7, 0xD1, 0xD0, 0xD2, 0xFE, 0x3B, 0x74, 0x40, 0x7B, 0x97, 0xD8, 0x86,
+    0xA3, 0x39, 0xD6, 0x7E, 0xC5, 0x69, 0x37, 0x1E, 0x75, 0x71, 0x56, 0xB1, 0x1B, 0x1B, 0xE1, 0x2F,
+    0xF5, 0xF3, 0xB6, 0x24, 0x04, 0xD9, 0x2C, 0x7D, 0xB1, 0xC7, 0x45, 0x6D, 0x9F, 0x9E, 0x01, 0xF3,
+    0x3E, 0x8B, 0xD9, 0x58, 0xA7, 0x6E, 0xBC, 0xDF, 0xEA, 0x91, 0x5C, 0x13, 0x06, 0x30, 0xF4, 0x93,
+    0xD8, 0x59, 0xDD, 0xA2, 0x13, 0x9A, 0x2C, 0x81, 0x2E, 0x0E, 0x27, 0xBE, 0x69, 0x57, 0xB4, 0x6B,
+    0xCD, 0xA0, 0xE8, 0x7C, 0x7E, 0xBE, 0x90, 0xD2, 0xEA, 0x42, 0x4A, 0xE3, 0x0A, 0x7C, 0xF3, 0x7F,
+    0xBB, 0x8F, 0xA8, 0xFD, 0xD0, 0x34, 0xF0, 0x7E, 0xDA, 0xF1, 0x0C, 0x81, 0x76, 0xEA, 0xA1, 0x92,
+    0x1D, 0x2B, 0xEA, 0x19, 0xF6, 0x62, 0x3A, 0x61, 0x1E, 0x9A, 0x19, 0x7C, 0x35, 0xA1, 0xFF, 0x80,
+    0x30, 0x33, 0x07, 0x9D, 0xFA, 0x49, 0xD1, 0xCC, 0x35, 0xBF, 0xB3, 0x82, 0xEF, 0xD0, 0xF9, 0xD9,
+    0xDF, 0x65, 0xEA, 0x48, 0x2A, 0x66, 0x0E, 0x76, 0xED, 0xC7, 0x6A, 0xFF, 0x28, 0x8B, 0xB6, 0xB8,
+    0x26, 0x7E, 0x2C, 0x04, 0xAD, 0xAF, 0x9E, 0x1C, 0x3C, 0x94, 0x50, 0x41, 0xCD, 0x13, 0x60, 0xCD,
+    0xB1, 0x54, 0xE7, 0x1D, 0xB1, 0x4C, 0x4B, 0x6A, 0xC6, 0xC9, 0x68, 0x94, 0x78, 0xDA, 0x27, 0x53,
+    0x9F, 0x1F, 0x16, 0x9D, 0xFA, 0xEB, 0x53, 0x82, 0xF3, 0xFD, 0x9D, 0xD9, 0x7D, 0xE8, 0x64, 0x3E,
+    0x5B, 0x4E, 0xD0, 0x9C, 0xC5, 0x36, 0xA8, 0x58, 0x4E, 0x6F, 0x27, 0x09, 0x49, 0x35, 0xA9, 0x7C,
+    0xF8, 0xCD, 0x93, 0xD6, 0x4C, 0x6A, 0x05, 0xF0, 0x7D, 0x5F, 0xA2, 0x8A, 0x59, 0x38, 0x94, 0xE6,
+    0x86, 0xA8, 0xFE, 0x33, 0x0F, 0x41, 0x67, 0xF4, 0x02, 0xA0, 0x1F, 0x37, 0x9A, 0x99, 0x99, 0x01,
+    0x30, 0x6C, 0x34, 0x72, 0x2B, 0x2E, 0xA4, 0x10, 0xA4, 0x97, 0xC2, 0x30, 0x77, 0x1B, 0x7B, 0x9A,
+    0xFF, 0x06, 0x50, 0x94, 0x2D, 0xB1, 0x9F, 0xC4, 0xA6, 0x58, 0xC5, 0x35, 0x95, 0xB4, 0xEB, 0x49,
+    0x27, 0xD8, 0xD8, 0xB1, 0x62, 0x50, 0x19, 0x7D, 0xEC, 0x16, 0x14, 0xBF, 0xA0, 0x5D, 0x45, 0x11,
+    0x30, 0x34, 0x94, 0x8D, 0x92, 0x53, 0x1F, 0x2B, 0x0E, 0x7D, 0x6A, 0xB3, 0xD0, 0xAA, 0xFC, 0x58,
+    0x6F, 0xA7, 0x20, 0x67, 0x30, 0x28, 0xF2, 0xC3, 0x92, 0x03, 0x75, 0xCC, 0x56, 0x29, 0xD6, 0x1D,
+    0xA8, 0x67, 0x40, 0x8C, 0xEA, 0x87, 0x58, 0x79, 0x8A, 0x00, 0x18, 0xEC, 0x04, 0xE8, 0xD4, 0x64,
+    0x00, 0x1C, 0xFC, 0x08, 0xF1, 0x56, 0x50, 0xD3, 0x49, 0x42, 0x5B, 0x97, 0xB3, 0x53, 0x82, 0x8A,
+    0xF7, 0x93, 0x21, 0x53, 0xB3, 0x2A, 0x7E, 0xCC, 0xD1, 0x07, 0x1B, 0xDB, 0xAC, 0x53, 0x93, 0xD1,
+    0x4F, 0x0C, 0xFD, 0xD4, 0xAC, 0xDD, 0xD2, 0x64, 0xF0, 0x75, 0x3A, 0x3B, 0x9B, 0x64, 0xA3, 0x62,
+    0x49, 0x07, 0xE5, 0x68, 0x27, 0x18, 0x4E, 0x4D, 0xDE, 0xD9, 0x55, 0x7F, 0xC3, 0x49, 0xF9, 0xCC,
+    0x40, 0x27, 0x19, 0x12, 0xA9, 0x98, 0x26, 0x62, 0x9F, 0xDC, 0x97, 0xA9, 0xEF, 0x63, 0x61, 0x41,
+    0x5B, 0x86, 0xB2, 0x59, 0xD8, 0x93, 0x34, 0xA9, 0xFF, 0x0F, 0x19, 0xFC, 0xF9, 0x40, 0xB4, 0xB1,
+    0x96, 0x68, 0xD4, 0x24, 0x2D, 0x3A, 0x99, 0xD4, 0x6F, 0x17, 0xD9, 0xF2, 0x3B, 0x4E, 0xA8, 0x98,
+    0x8E, 0x87, 0x16, 0xFF, 0xF6, 0xF8, 0xDE, 0x8C, 0xBF, 0x90, 0xEF, 0x6D, 0x1E, 0x20, 0x29, 0x4B,
+    0xA2, 0x8A, 0xE8, 0x69, 0xD9, 0x77, 0x1B, 0x61, 0x32, 0xEF, 0xE2, 0xF6, 0x47, 0x73, 0xCE, 0x2E,
+    0xB0, 0x73, 0x4B, 0x08, 0x75, 0x47, 0x3C, 0x4A, 0xFF, 0xDE, 0xBA, 0x91, 0x7A, 0x8D, 0x58, 0x41,
+    0x32, 0x8A, 0x00, 0x6A, 0xD9, 0x8E, 0xE9, 0x4A, 0xBF, 0x14, 0x39, 0x02, 0xFC, 0x88, 0x07, 0x30,
+    0xC9, 0x72, 0x6E, 0x59, 0x93, 0x4F, 0x31, 0x68, 0x46, 0x3B, 0x0B, 0xDD, 0xFF, 0x38, 0xF9, 0x5B,
+    0x00, 0xCF, 0x84, 0xC2, 0x87, 0xD0, 0x92, 0x8C, 0xB9, 0x43, 0xA7, 0xB7, 0x4C, 0x27, 0xC5, 0x41,
+    0xD1, 0xD5, 0x0C, 0xF0, 0xD3, 0x09, 0x41, 0xFB, 0x09, 0xF0, 0x63, 0x1F, 0x51, 0x62, 0x5F, 0x9B,
+    0xA0, 0x6F, 0x8B, 0x2E, 0x2C, 0xE9, 0x78, 0x6B, 0x89, 0x33, 0x0A, 0x93, 0x79, 0x8B, 0x05, 0xC9,
+    0x8C, 0x33, 0x77, 0xE9, 0xEE, 0x17, 0x74, 0x2D, 0x82, 0xEE, 0x23, 0x9A, 0x92, 0xFC, 0xE8, 0x14,
+    0x07, 0xC5, 0x00, 0x1F, 0x6B, 0x06, 0xB1, 0x07, 0x7F, 0x59, 0x79, 0x89, 0x97, 0x36, 0x43, 0x53,
+    0xA2, 0x01, 0x8C, 0x78, 0x94, 0xBC, 0x75, 0x9F, 0xBC, 0x32, 0x60, 0x92, 0x8D, 0x68, 0x59, 0x73,
+    0xA8, 0x18, 0xC4, 0x0E, 0xE7, 0x08, 0x04, 0x3C, 0x01, 0xF5, 0x3A, 0xD3, 0x5F, 0x3C, 0xF1, 0x9B,
+    0xBF, 0x7D, 0xFA, 0xEF, 0xD4, 0x03, 0x2E, 0xE3, 0x37, 0x71, 0x1A, 0xBF, 0xCC, 0x1F, 0x95, 0x03,
+    0x02, 0x26, 0x44, 0x30, 0xFF, 0x5D, 0x35, 0x4C, 0x97, 0xFF, 0xCE, 0x2F, 0xFB, 0xCB, 0xF2, 0xC7,
+    0x9E, 0xE1, 0xA7, 0xCC, 0x96, 0x7F, 0xC9, 0x15, 0xC0, 0x89, 0x37, 0x67, 0x0F, 0x0E, 0x0E, 0x9E,
+    0x23, 0xF9, 0x11, 0xC9, 0xCF, 0x49, 0xA6, 0xB3, 0x07, 0x07, 0x07, 0x82, 0xE9, 0x6E, 0xFE, 0xE5,
+    0x83, 0xAF, 0x0B, 0x00, 0x3B, 0x74, 0xEF, 0x4D, 0xCD, 0x17, 0x4B, 0xB5, 0x66, 0xF4, 0xFD, 0xDF,
+    0xDC, 0x9B, 0x6F, 0xBA, 0xD3, 0xC3, 0xDE, 0xC1, 0xC1, 0x79, 0x4D, 0xA6, 0x8E, 0x47, 0xDE, 0xCF,
+    0xE3, 0x87, 0x87, 0x97, 0x2D, 0x19, 0x1F, 0x3F, 0x3C, 0xBC, 0x5C, 0x13, 0x0C, 0xFD, 0x68, 0xA3,
+    0x9E, 0xDB, 0x45, 0xA5, 0x2A, 0xE3, 0x2C, 0xD0, 0xBF, 0x91, 0xEC, 0xCD, 0x64, 0x5F, 0x4F, 0xE6,
+    0x46, 0xDA, 0x73, 0x35, 0x9B, 0x55, 0xB1, 0x4D, 0xCD, 0xAA, 0x17, 0x9D, 0xBA, 0xA8, 0xA3, 0x9D,
+    0xCC, 0x64, 0x83, 0x0D, 0xDE, 0xF5, 0x03, 0x71, 0x16, 0xE7, 0xD1, 0xDF, 0x60, 0x17, 0xFB, 0x37,
+    0x92, 0x8E, 0x54, 0xC9, 0x06, 0x3E, 0x1B, 0xCD, 0xDB, 0x6B, 0x33, 0x5B, 0xB7, 0xEE, 0xB9, 0xB3,
+    0x40, 0x75, 0x5E, 0x16, 0x25, 0x1D, 0x54, 0x02, 0xF4, 0x04, 0x58, 0x07, 0x24, 0xE8, 0x8F, 0xEF,
+    0xA6, 0x9E, 0xFC, 0x29, 0xC9, 0x67, 0x3F, 0xBE, 0xFB, 0x1A, 0x74, 0x00, 0x7A, 0xC9, 0x15, 0xD3,
+    0x23, 0x60, 0x1D, 0xAA, 0x24, 0x89, 0x5B, 0x36, 0xA0, 0xCA, 0x40, 0xBB, 0x08, 0x29, 0x8B, 0xB2,
+    0x9F, 0x9A, 0xB8, 0xED, 0xDE, 0x67, 0x0B, 0xB1, 0xBD, 0x5D, 0x80, 0x7A, 0x05, 0xE0, 0x01, 0x98,
+    0x01, 0xBF, 0xF5, 0xC2, 0x4F, 0x2E, 0xEB, 0x12, 0x61, 0x92, 0x40, 0xA0, 0x19, 0xA4, 0x05, 0xED,
+    0x52, 0xD2, 0x95, 0x08, 0xC0, 0x0E, 0xF8, 0x2F, 0x9E, 0xFB, 0xC9, 0x1F, 0x9E, 0x38, 0x72, 0xDF,
+    0x3A, 0x07, 0x1D, 0xE4, 0xFA, 0x2A, 0x95, 0x23, 0x7D, 0x00, 0xB0, 0x0F, 0x4E, 0x96, 0xAF, 0x30,
+    0x79, 0xBE, 0xCB, 0xEC, 0xF9, 0x31, 0xD7, 0x9E, 0xAF, 0x73, 0x6E, 0x56, 0x54, 0xC0, 0xAF, 0x01,
+    0xDF, 0x46, 0x9D, 0xA1, 0x33, 0x2C, 0x41, 0x36, 0x5C, 0x0D, 0x07, 0x4E, 0x6A, 0x41, 0x57, 0xBC,
+    0x53, 0xF3, 0x3A, 0x5F, 0xCD, 0x76, 0xF1, 0x41, 0xD0, 0x8F, 0x6E, 0xAC, 0x53, 0x1F, 0xDB, 0xEC,
+    0xA3, 0xCE, 0x3E, 0xEA, 0xDC, 0x8F, 0x6D, 0xDA, 0x43, 0xB5, 0x0F, 0xF4, 0x17, 0xF9, 0xC2, 0xDA,
+    0x47, 0x0E, 0xFB, 0x00, 0x0C, 0xDF, 0xC4, 0x57, 0x9A, 0xFF, 0xF5, 0x80, 0xCB, 0xE2, 0x5E, 0x6A,
+    0x4E, 0xF8, 0xBD, 0xAF, 0x36, 0xF7, 0x4F, 0xA3, 0x1E, 0xB0, 0xCF, 0x13, 0x8F, 0x7A, 0xF8, 0xE5,
+    0xFE, 0xAB, 0x1C, 0xF9, 0xB3, 0x83, 0x11, 0x23, 0x46, 0x4C, 0xF8, 0x6A, 0xBF, 0x3B, 0x78, 0x1E,
+    0x0D, 0x1A, 0x34, 0x68, 0xBF, 0xCA, 0xEF, 0x8E, 0x33, 0x0F, 0xC6, 0x92, 0x6D, 0xD8, 0x71, 0x44,
+    0x37, 0x4A, 0x16, 0x68, 0xA8, 0xA4, 0xD8, 0xCE, 0xCA, 0x42, 0x4A, 0xB1, 0xAF, 0xAF, 0xF0, 0x00,
+    0x50, 0xE7, 0x76, 0x6E, 0x84, 0x84, 0x3D, 0xDB, 0x51, 0xE2, 0x3F, 0x36, 0xB0, 0xB0, 0x8F, 0xA9,
+    0x92, 0x09, 0x00, 0xA0, 0x52, 0xF7, 0xFE, 0x7A, 0xFA, 0x12, 0x4E, 0x5F, 0xD2, 0x91, 0xCF, 0xFD,
+    0x94, 0xB1, 0x66, 0xB4, 0xB7, 0x13, 0x2D, 0x27, 0xC3, 0xE8, 0xF9, 0xE6, 0xCF, 0xC9, 0x1B, 0x64,
+    0x60, 0xEA, 0x9F, 0x9B, 0xF9, 0xDC, 0xEC, 0xDD, 0x3F, 0x3B, 0xB7, 0xF4, 0x2F, 0xAF, 0xFD, 0xEB,
+    0x2B, 0x60, 0x5F, 0x5F, 0xDB, 0xCF, 0xD7, 0x76, 0x46, 0x9D, 0x74, 0xB4, 0x6F, 0x45, 0x1B, 0xD0,
+    0x8D, 0x36, 0xD0, 0x06, 0x02, 0x19, 0x6C, 0x12, 0x9B, 0x04, 0x1D, 0x55, 0x32, 0x3F, 0x4E, 0x66,
+    0x84, 0x77, 0xFA, 0x13, 0xEA, 0x4F, 0x88, 0x66, 0x81, 0xE5, 0x6C, 0x39, 0xC3, 0x06, 0xF4, 0x1C,
+    0x7A, 0x0E, 0x2A, 0x01, 0xFD, 0x2C, 0xA1, 0x1A, 0xE0, 0x11, 0xE0, 0x91, 0x07, 0x78, 0x2B, 0x9B,
+    0x00, 0x4E, 0xC8, 0xE0, 0xB8, 0x18, 0x4E, 0x48, 0xE2, 0xB8, 0x30, 0x4E, 0xC8, 0xE3, 0x84, 0x48,
+    0x4E, 0x48, 0xE5, 0xB8, 0x60, 0x4E, 0xC8, 0x06, 0xA7, 0x8E, 0x89, 0xE7, 0x84, 0x84, 0x8E, 0x0B,
+    0xE9, 0x84, 0x9C, 0x4E, 0x88, 0xEA, 0xB8, 0xB4, 0x3E, 0xCF, 0xC7, 0x04, 0xF6, 0xD6, 0x6C, 0xC6,
+    0x9D, 0xCC, 0x4E, 0x88, 0x8D, 0xEA, 0x48, 0x72, 0x3F, 0x4E, 0x66, 0xDA, 0x09, 0x4F, 0x7F, 0x76,
+    0x4C, 0x7E, 0x86, 0xCB, 0x91, 0x08, 0x2D, 0xC3, 0x91, 0x14, 0x4F, 0x08, 0xF2, 0x11, 0x00, 0x36,
+    0xB4, 0x4B, 0x45, 0xD8, 0xB1, 0x59, 0x40, 0x98, 0xA0, 0x66, 0x5C, 0x07, 0x60, 0x43, 0x3F, 0xB4,
+    0x8B, 0x9E, 0x2B, 0xD6, 0x19, 0x76, 0xB4, 0xA1, 0x59, 0x74, 0x04, 0xAB, 0x0C, 0x13, 0x6C, 0x50,
+    0x73, 0x13, 0x71, 0x1D, 0x6B, 0x39, 0xD0, 0x3B, 0x33, 0xD9, 0xB1, 0x0F, 0x5D, 0x34, 0x93, 0x1D,
+    0xF5, 0xAC, 0xA3, 0x99, 0x9A, 0x45, 0x47, 0x1D, 0x55, 0x6A, 0x96, 0x36, 0xD6, 0x49, 0xA5, 0x66,
+    0xC6, 0x5A, 0x25, 0x95, 0x70, 0x1D, 0x6B, 0x95, 0xE4, 0xBA, 0x20, 0xCC, 0xA8, 0x12, 0x3C, 0xF4,
+    0x54, 0x25, 0x18, 0xB7, 0x5D, 0x55, 0x2E, 0x34, 0xDA, 0xA0, 0x52, 0x33, 0xC3, 0x83, 0xD0, 0x53,
+    0x37, 0x56, 0xA9, 0x5E, 0x60, 0x9C, 0x3D, 0x71, 0x4D, 0x1D, 0xBB, 0xC9, 0x8E, 0xED, 0xAC, 0x63,
+    0x37, 0xA9, 0xD4, 0xCC, 0x72, 0x35, 0xB5, 0x20, 0x57, 0x6B, 0x9D, 0xD0, 0xE3, 0x3A, 0x56, 0x18,
+    0x67, 0xF1, 0x22, 0xEA, 0x01, 0x6D, 0x80, 0x0E, 0xB0, 0x23, 0x5E, 0x9C, 0x30, 0xC7, 0x3A, 0xC6,
+    0x66, 0x9C, 0xF5, 0xF0, 0x23, 0x83, 0x3F, 0xFD, 0x3A, 0xBE, 0x85, 0x5F, 0x41, 0x35, 0xA3, 0x9F,
+    0x74, 0x52, 0x74, 0x9C, 0xCC, 0xD2, 0x12, 0x7E, 0x52, 0x84, 0x9D, 0x77, 0x29, 0x5B, 0x1F, 0xE2,
+    0x0C, 0xF0, 0x35, 0x98, 0xD0, 0xAC, 0x92, 0x74, 0xD8, 0x2D, 0x60, 0x68, 0x73, 0xC5, 0x60, 0x67,
+    0xBD, 0xD6, 0x1C, 0xFC, 0xD4, 0x24, 0xE8, 0x32, 0x57, 0xF6, 0x01, 0xFC, 0x0A, 0x74, 0xC4, 0xDF,
+    0xC7, 0x35, 0xF4, 0x53, 0x1D, 0xDB, 0x54, 0x71, 0x30, 0x51, 0x27, 0x25, 0xC4, 0xD3, 0xCA, 0x09,
+    0xC1, 0xB5, 0xA6, 0x2B, 0x6C, 0x57, 0xE8, 0x54, 0xD3, 0x41, 0x68, 0x8C, 0x80, 0xCE, 0x74, 0x67,
+    0xBA, 0x49, 0x73, 0x6E, 0x66, 0x06, 0x4D, 0x67, 0x3F, 0x25, 0x4C, 0x02, 0xDF, 0x4C, 0x35, 0x53,
+    0xCD, 0x53, 0x83, 0x61, 0xAA, 0x2E, 0xA1, 0xE6, 0x73, 0x09, 0x90, 0x30, 0xD0, 0x96, 0xD6, 0x7F,
+    0xDF, 0xA9, 0xDB, 0x49, 0xA7, 0x9A, 0xAE, 0x1F, 0xF5, 0xA2, 0xE6, 0x8A, 0x83, 0x1E, 0x95, 0x6B,
+    0x56, 0xFC, 0x1A, 0x80, 0x66, 0x12, 0x62, 0x5D, 0x9B, 0xD1, 0xCF, 0x7A, 0x45, 0x1F, 0xBB, 0x04,
+    0x3F, 0x75, 0x09, 0x1C, 0xCD, 0x02, 0x06, 0x7B, 0x8C, 0xF3, 0x5A, 0xD1, 0xF5, 0x53, 0x4D, 0x89,
+    0x3D, 0xFB, 0xA0, 0x32, 0x18, 0xD4, 0x0A, 0x0E, 0x4D, 0x02, 0x5D, 0x93, 0x2A, 0xA2, 0x5D, 0x2A,
+    0xA2, 0xDA, 0x3F, 0x8E, 0x77, 0xA3, 0x9B, 0x9A, 0x45, 0xE8, 0xED, 0x3E, 0x76, 0x2B, 0x7C, 0xEC,
+    0x12, 0xEC, 0xA8, 0x67, 0xEC, 0x6D, 0xA0, 0x48, 0xCD, 0xA5, 0x22, 0x93, 0x26, 0x97, 0x8E, 0x8C,
+    0x76, 0xED, 0xC7, 0xE7, 0x22, 0x9D, 0xBD, 0xB8, 0x56, 0xAB, 0x89, 0xED, 0xE7, 0x1C, 0x0C, 0x13,
+    0xC8, 0x41, 0x71, 0x86, 0x26, 0xD0, 0x4F, 0xA8, 0x29, 0xBB, 0xDB, 0x71, 0x97, 0x71, 0x82, 0x18,
+    0x8C, 0x0E, 0x3A, 0x89, 0x01, 0xFA, 0x35, 0x31, 0x05, 0x7E, 0x60, 0x05, 0x7A, 0x4E, 0xDF, 0x3C,
+    0x3C, 0xFC, 0x3E, 0x00, 0xFC, 0x3D, 0x00, 0x3F, 0x74, 0xC0, 0x9F, 0x46, 0xE0, 0x5B, 0xBF, 0x0B,
+    0x5C, 0x53, 0x77, 0x4E, 0x25, 0x58, 0x26, 0x54, 0xFE, 0x43, 0x00, 0x07, 0xD8, 0xF2, 0xD5, 0x57,
+    0x98, 0xA1, 0x8E, 0x6D, 0x40, 0x73, 0x63, 0x02, 0x7E, 0xFB, 0x09, 0x00, 0xEF, 0xCB, 0x42, 0xC2,
+    0x1E, 0x80, 0x36, 0x00, 0xCD, 0x08, 0xA8, 0x09, 0xA8, 0x23, 0x50, 0xCD, 0x00, 0x12, 0x80, 0x6B,
+    0x00, 0x9E, 0x04, 0x60, 0x01, 0x74, 0x0E, 0xD0, 0x03, 0xD0, 0x8E, 0x40, 0x33, 0x8B, 0x43, 0x5D,
+    0x7F, 0x11, 0x50, 0xCD, 0x11, 0x48, 0x5F, 0x07, 0xAE, 0xB5, 0x03, 0x9E, 0xAC, 0x23, 0x2C, 0xBE,
+    0x85, 0xCE, 0x69, 0x77, 0x5F, 0xA0, 0xDB, 0x8C, 0x3B, 0x15, 0xB4, 0x43, 0x5D, 0x8A, 0x56, 0xFA,
+    0x3D, 0x55, 0x94, 0x58, 0xB3, 0xD8, 0x4D, 0x31, 0x32, 0xEE, 0xED, 0x78, 0xF1, 0xB1, 0x50, 0x26,
+    0xB7, 0xB4, 0x89, 0x86, 0x3B, 0xAE, 0xE5, 0xFC, 0x1B, 0xE5, 0xF8, 0xDB, 0xE5, 0x5C, 0xE6, 0xB3,
+    0x75, 0x53, 0x8E, 0x45, 0x67, 0x7E, 0xA3, 0x09, 0x74, 0xDF, 0x90, 0x1C, 0xC3, 0x76, 0x16, 0xF2,
+    0x29, 0x70, 0x06, 0xDE, 0xC1, 0xE9, 0x09, 0x70, 0x6D, 0x84, 0x76, 0x2B, 0xA0, 0x87, 0x8C, 0x8A,
+    0xCF, 0x05, 0x80, 0xAF, 0x8E, 0xB0, 0x5C, 0xFF, 0xF1, 0x60, 0xB8, 0xFE, 0xFE, 0x4B, 0xBE, 0xD4,
+    0xF3, 0x48, 0xE8, 0x0A, 0x9F, 0x3D, 0xD4, 0xDC, 0x08, 0x41, 0x5E, 0x00, 0x57, 0x38, 0x7B, 0x2F,
+    0x02, 0xE6, 0x8B, 0x08, 0x9D, 0x7A, 0x87, 0x76, 0xB5, 0x03, 0xFA, 0x73, 0xA9, 0x44, 0x46, 0x26,
+    0x33, 0x02, 0x7F, 0xD1, 0x4D, 0x40, 0xB5, 0x00, 0xC0, 0x9D, 0x13, 0x31, 0x92, 0x9F, 0x32, 0x5B,
+    0xFE, 0x98, 0x47, 0x71, 0xC0, 0x9D, 0x94, 0xBC, 0xD8, 0x1C, 0x00, 0xD4, 0x82, 0x62, 0xD7, 0xC0,
+    0x04, 0xC8, 0x10, 0x00, 0x79, 0x27, 0xC6, 0x76, 0x06, 0x50, 0x1D, 0xBD, 0x17, 0x6E, 0xFC, 0x0A,
+    0x00, 0xFD, 0xB0, 0xBD, 0x2F, 0x27, 0x75, 0x00, 0xBA, 0x69, 0xF7, 0x9E, 0xBB, 0xE1, 0x69, 0x0A,
+    0xD9, 0x82, 0x11, 0x86, 0x01, 0x24, 0x54, 0xBE, 0x82, 0x2E, 0x02, 0x7E, 0x80, 0x5A, 0xE5, 0x2C,
+    0x36, 0xA0, 0xE2, 0x09, 0x03, 0x4F, 0x71, 0x46, 0xC7, 0x00, 0x4F, 0xA8, 0x7C, 0x1E, 0x3A, 0x02,
+    0x7D, 0x40, 0x9D, 0xA5, 0x55, 0xC7, 0xAD, 0xC0, 0x09, 0xE0, 0x00, 0xC5, 0x05, 0x9A, 0x23, 0x7A,
+    0x3A, 0x1C, 0x48, 0x89, 0x9E, 0x19, 0x1D, 0x47, 0x78, 0xA2, 0xBA, 0x9A, 0xA4, 0x71, 0xC7, 0xAE,
+    0x58, 0x4E, 0xA6, 0x67, 0xE9, 0x1B, 0xA1, 0x0A, 0x1D, 0xB8, 0xA7, 0xC3, 0xF3, 0x49, 0xEC, 0xC9,
+    0x7E, 0x38, 0x7E, 0xD0, 0xC9, 0x16, 0x0A, 0x7D, 0x58, 0xA8, 0xC3, 0x07, 0xE7, 0x8F, 0xC7, 0x5A,
+    0x46, 0x5C, 0xC8, 0xAE, 0x23, 0x83, 0x67, 0x56, 0xC2, 0x24, 0x9A, 0x3B, 0x29, 0x33, 0x10, 0x16,
+    0xC5, 0x67, 0x46, 0x9D, 0x1E, 0x41, 0x37, 0x9F, 0x29, 0xF5, 0x46, 0x64, 0x4D, 0x46, 0x54, 0x1C,
+    0xD0, 0xAD, 0x80, 0x8F, 0x68, 0x39, 0xC0, 0xAE, 0x50, 0x9C, 0xD0, 0xD1, 0x81, 0x33, 0x14, 0x03,
+    0x4C, 0x02, 0x38, 0x41, 0x65, 0x41, 0xEF, 0x36, 0x71, 0x94, 0x16, 0x3D, 0xFC, 0xD1, 0x4D, 0x80,
+    0x77, 0x50, 0xA5, 0x84, 0x42, 0x3F, 0xA3, 0x66, 0x40, 0x43, 0xE1, 0x79, 0xD8, 0x51, 0x40, 0xA9,
+    0xFD, 0x13, 0x80, 0xF8, 0x05, 0xBA, 0x8A, 0x37, 0xC8, 0x04, 0x46, 0x92, 0x83, 0x5D, 0x3A, 0x32,
+    0xEA, 0xA4, 0x26, 0xBD, 0x36, 0x84, 0xAB, 0xF8, 0x94, 0x20, 0x61, 0x82, 0x85, 0xD9, 0x08, 0xF4,
+    0xB3, 0x4E, 0x80, 0x5F, 0x54, 0x06, 0xB8, 0x54, 0xD2, 0xE6, 0x3E, 0xC0, 0x47, 0x98, 0x08, 0x3B,
+    0x41, 0x2F, 0xE8, 0x22, 0xD4, 0x8A, 0x76, 0x29, 0x93, 0xE3, 0x58, 0x58, 0x68, 0x6B, 0xA9, 0x4A,
+    0xA2, 0x9E, 0x87, 0x86, 0x0E, 0x9C, 0x2A, 0x06, 0xD8, 0x19, 0x76, 0x44, 0x9B, 0x50, 0xB9, 0xE3,
+    0xC1, 0x42, 0x45, 0xF7, 0x18, 0x07, 0xF4, 0xB3, 0x21, 0x5D, 0xC3, 0x86, 0x4C, 0xF0, 0x93, 0x25,
+    0x27, 0xBD, 0x56, 0x73, 0x43, 0x41, 0x2F, 0xA2, 0xC0, 0x90, 0x82, 0xDB, 0x4D, 0xDD, 0x0C, 0x98,
+    0x54, 0x13, 0xD0, 0x74, 0x36, 0xA2, 0xE1, 0xA8, 0x32, 0x2A, 0x4E, 0xB0, 0x23, 0xEC, 0x8C, 0x26,
+    0xA1, 0x59, 0x81, 0x3E, 0x80, 0x03, 0xDA, 0x05, 0x3A, 0x9E, 0x4C, 0x26, 0x3C, 0x6A, 0xA7, 0x09,
+    0x50, 0x44, 0x93, 0x01, 0x1F, 0xC1, 0x88, 0x96, 0xD0, 0x19, 0xB0, 0x23, 0xFA, 0x00, 0xEC, 0xEF,
+    0xF8, 0x03, 0x96, 0xE4, 0x7B, 0x24, 0xBF, 0x20, 0x99, 0x0E, 0x0E, 0xFE, 0x20, 0x17, 0x0C, 0x90,
+    0xAE, 0x80, 0x83, 0xA3, 0x28, 0xE3, 0xAE, 0x64, 0xAF, 0xB6, 0x49, 0x9C, 0x12, 0x41, 0x4E, 0x9D,
+    0x20, 0xFC, 0x92, 0xA1, 0x23, 0xF1, 0xA1, 0x96, 0xA4, 0xF3, 0x64, 0x6E, 0x49, 0xCE, 0xD7, 0x3A,
+    0xF2, 0xCD, 0x1B, 0x64, 0xBA, 0xD6, 0x91, 0xEF, 0xDE, 0x20, 0xD7, 0x6B, 0x1D, 0xF9, 0xF1, 0x0D,
+    0x32, 0x9F, 0xF8, 0x64, 0x77, 0xCC, 0xB3, 0x37, 0xC8, 0xE9, 0x5A, 0xC7, 0xB9, 0xBD, 0x31, 0x03,
+    0xD7, 0x3A, 0x87, 0xAF, 0xFE, 0x07, 0x4E, 0x64, 0x17, 0xA9, 0x2D, 0x8E, 0xDA, 0x91, 0x4F, 0x7F,
+    0x4A, 0xCE, 0xC6, 0x6E, 0x7F, 0xF4, 0xE4, 0xD3, 0x5F, 0x9C, 0xF8, 0xC4, 0x92, 0x4F, 0xFF, 0x9C,
+    0x9C, 0x4D, 0x47, 0xFE, 0x30, 0xFA, 0xE2, 0x69, 0xC5, 0xEA, 0xF0, 0xF0, 0xB0, 0x9C, 0x2F, 0xC3,
+    0x93, 0xAB, 0x74, 0x4E, 0x93, 0x6F, 0x06, 0x32, 0x5D, 0xD3, 0xE4, 0xBB, 0x81, 0xCC, 0xD7, 0x34,
+    0xF9, 0xF1, 0x03, 0x7F, 0xBC, 0x1B, 0xC8, 0x74, 0xFD, 0x2A, 0xF9, 0x9D, 0x52, 0xC9, 0x23, 0x9D,
+    0x3A, 0x3C, 0xBC, 0x02, 0xC0, 0x15, 0x2D, 0xD5, 0x49, 0xF1, 0x8F, 0xDF, 0xA9, 0x13, 0xF4, 0xBC,
+    0xA2, 0x21, 0xF1, 0x5F, 0x93, 0x4C, 0x55, 0x29, 0xE5, 0x19, 0x34, 0x5F, 0xFA, 0x43, 0x7D, 0x2F,
+    0xA2, 0x5B, 0x32, 0x9A, 0x64, 0x02, 0xBE, 0xDE, 0x2C, 0xA8, 0x90, 0x01, 0x9C, 0x01, 0x70, 0x1E,
+    0x3E, 0xF4, 0xD1, 0xA4, 0x86, 0xB8, 0xFE, 0xB0, 0x15, 0x56, 0x67, 0x70, 0x30, 0x53, 0xBB, 0xD4,
+    0x19, 0xFD, 0xD0, 0x8D, 0x6A, 0x96, 0x79, 0x7A, 0x80, 0x2D, 0xCE, 0xE6, 0xB9, 0x02, 0x66, 0xA8,
+    0x23, 0xDA, 0x80, 0x26, 0x54, 0x13, 0xF0, 0xDB, 0x78, 0x02, 0xC0, 0x54, 0xE1, 0x21, 0xF6, 0xFB,
+    0xDF, 0xEC, 0xE3, 0x9F, 0x03, 0xF5, 0xD0, 0x3A, 0xE0, 0x4F, 0xF1, 0x04, 0xD0, 0xA1, 0x9E, 0xD0,
+    0x06, 0xE8, 0x0F, 0x1F, 0xDB, 0x41, 0x42, 0x17, 0xEE, 0x1C, 0xED, 0xB2, 0x6A, 0xDD, 0x34, 0xBA,
+    0x5A, 0xCA, 0x9E, 0xDA, 0x5F, 0x8C, 0x00, 0x39, 0xED, 0x09, 0x91, 0xBD, 0x2A, 0x81, 0xDE, 0x8C,
+    0x9A, 0xF3, 0x3F, 0x42, 0x9B, 0x13, 0x60, 0x3E, 0x49, 0x80, 0x99, 0x32, 0xD0, 0x04, 0x02, 0x95,
+    0xEC, 0x0E, 0x67, 0xCA, 0xA0, 0x54, 0x79, 0x7B, 0xAA, 0x13, 0xF0, 0x3B, 0x75, 0x02, 0xEC, 0x3B,
+    0x0B, 0xD0, 0x33, 0xEE, 0xA1, 0x27, 0xE9, 0x2A, 0x2F, 0xF9, 0x1D, 0x04, 0x98, 0x7E, 0x1D, 0x2A,
+    0xAF, 0x40, 0xB7, 0x64, 0xA0, 0x8B, 0x1E, 0x50, 0x63, 0x3F, 0x00, 0xCE, 0x0E, 0xE5, 0x9C, 0x80,
+    0x4A, 0xC8, 0x7E, 0x32, 0xEF, 0x65, 0x95, 0xFC, 0xD4, 0x5F, 0x4C, 0x3A, 0x02, 0x04, 0xCC, 0x08,
+    0x95, 0x80, 0x7E, 0x80, 0x8E, 0xA8, 0xF2, 0xEE, 0x03, 0xEF, 0xB6, 0x0F, 0x6C, 0x38, 0xFA, 0xC0,
+    0xDC, 0xC8, 0x0D, 0x6D, 0xF0, 0x5F, 0x2C, 0x2D, 0xBD, 0xB3, 0x23, 0xB0, 0x8F, 0xC7, 0xEE, 0x3A,
+    0x00, 0x7F, 0x54, 0x93, 0xBC, 0x04, 0xA4, 0x96, 0x24, 0xFF, 0xD5, 0x63, 0xA9, 0x13, 0x77, 0x78,
+    0xB6, 0xA1, 0xBA, 0x4A, 0x72, 0xB4, 0x00, 0x2E, 0x90, 0xE2, 0x6B, 0x9F, 0xDD, 0x17, 0x85, 0xDA,
+    0x72, 0x42, 0x47, 0xBA, 0x6E, 0xAC, 0xE7, 0xCE, 0xA1, 0xD3, 0x40, 0xF5, 0x2E, 0x80, 0x27, 0xDC,
+    0x6E, 0xCC, 0x55, 0x04, 0x1E, 0xD1, 0xC1, 0x61, 0xB1, 0xED, 0xD0, 0x2E, 0xC9, 0x3B, 0x7D, 0xEF,
+    0x5E, 0x92, 0x12, 0x46, 0xBA, 0x54, 0x0B, 0xFA, 0x84, 0x85, 0x18, 0x40, 0x74, 0x92, 0xE9, 0xB7,
+    0xA0, 0x25, 0x17, 0xF8, 0xB7, 0xDE, 0x9A, 0x91, 0xAC, 0x0E, 0x18, 0xD2, 0xAF, 0x94, 0x72, 0x8F,
+    0x05, 0xBE, 0xDE, 0x17, 0x7C, 0xB1, 0xA5, 0xFC, 0x6B, 0x32, 0x8E, 0x3C, 0xC2, 0x23, 0x56, 0x63,
+    0x29, 0x6F, 0x62, 0xE7, 0xA3, 0xCA, 0x3A, 0xED, 0xF0, 0xB0, 0x29, 0x53, 0x5D, 0x29, 0xA9, 0x18,
+    0xC7, 0xCE, 0x57, 0x5D, 0x81, 0xBD, 0x91, 0xDB, 0xC5, 0x8E, 0xED, 0x62, 0xDF, 0x66, 0xBB, 0x54,
+    0x6C, 0x17, 0xFB, 0x36, 0x61, 0x47, 0xB6, 0x8B, 0x1D, 0x9B, 0xC5, 0x06, 0x36, 0x0B, 0xD8, 0x2C,
+    0x26, 0x10, 0x26, 0x50, 0x2D, 0x26, 0xA8, 0xB9, 0x0B, 0x54, 0x33, 0xAE, 0xAB, 0xB9, 0x0B, 0xD7,
+    0x71, 0xC4, 0x2D, 0xE9, 0x47, 0xEC, 0x62, 0xB7, 0xA5, 0x24, 0x55, 0xC9, 0x05, 0x34, 0xC3, 0x2F,
+    0x9A, 0xCD, 0xA7, 0x1C, 0x80, 0xDF, 0x50, 0x04, 0xD0, 0x26, 0xA9, 0xFE, 0xFA, 0x01, 0x1D, 0xA0,
+    0xB3, 0x24, 0xDF, 0x8F, 0x3F, 0x02, 0x50, 0xCF, 0xBF, 0xE8, 0x14, 0xD5, 0x95, 0x2F, 0x6D, 0xC1,
+    0xBA, 0x4B, 0xC1, 0xDE, 0x73, 0x00, 0xF6, 0x6A, 0x02, 0x68, 0x1E, 0x72, 0x1D, 0x3F, 0xBE, 0xF6,
+    0xD7, 0x5E, 0x07, 0x57, 0x8E, 0x55, 0x49, 0x7D, 0x58, 0x4F, 0x1F, 0x75, 0xBF, 0xE8, 0xD7, 0xA7,
+    0x07, 0x00, 0x8F, 0x96, 0x30, 0x8F, 0xB4, 0xE0, 0xC7, 0x74, 0x90, 0x32, 0xB8, 0x00, 0xC3, 0xF7,
+    0x01, 0x54, 0x97, 0x2B, 0xE7, 0x6F, 0xF2, 0xB9, 0xD5, 0x0A, 0x45, 0xED, 0xE1, 0xDC, 0xDE, 0x81,
+    0x72, 0xC8, 0xA3, 0x9B, 0x78, 0x05, 0xD5, 0x97, 0xA8, 0xFE, 0x51, 0x86, 0xD9, 0x09, 0x16, 0xDC,
+    0x49, 0x91, 0x01, 0x78, 0x44, 0x0C, 0x23, 0x3B, 0xA3, 0xE2, 0x1B, 0x74, 0x02, 0xDF, 0x56, 0xBC,
+    0xB1, 0x0A, 0x62, 0xF6, 0x0B, 0x1E, 0xF5, 0x87, 0xBB, 0x14, 0x26, 0xB9, 0x1A, 0xA7, 0x5D, 0x72,
+    0xDD, 0xA3, 0x72, 0xC8, 0x0F, 0x64, 0x79, 0x2C, 0x00, 0x2A, 0xA7, 0xA7, 0xCA, 0xA1, 0x0F, 0x76,
+    0xE8, 0x83, 0xE2, 0x90, 0x15, 0x07, 0x9D, 0xD5, 0xA2, 0x33, 0xCC, 0xAC, 0x27, 0x33, 0xC3, 0x38,
+    0x3B, 0x18, 0xB7, 0x19, 0xAE, 0xC5, 0xA8, 0x85, 0x9E, 0x80, 0xD3, 0x87, 0x87, 0xFE, 0xD6, 0xE1,
+    0x0F, 0x04, 0x7D, 0x5D, 0x64, 0xD1, 0x7E, 0x20, 0x2F, 0x03, 0x50, 0x80, 0x8D, 0x63, 0xBF, 0x3A,
+    0x75, 0x49, 0x4F, 0xA7, 0x06, 0xF8, 0xD1, 0x0E, 0xBE, 0x5C, 0xCB, 0xE9, 0xAC, 0x16, 0xBD, 0xCA,
+    0xB5, 0x22, 0x1E, 0x75, 0x76, 0x78, 0x1C, 0xF7, 0x5F, 0x6B, 0x23, 0x30, 0xDD, 0xE4, 0xAB, 0xD9,
+    0x2E, 0xFD, 0x8E, 0x9E, 0xA8, 0x16, 0xBB, 0xF0, 0x03, 0xBE, 0x92, 0x76, 0xC6, 0x95, 0x39, 0xC7,
+    0xE7, 0xB2, 0x5D, 0xFC, 0xF8, 0x47, 0xD8, 0x7B, 0x26, 0xFB, 0x7B, 0xEC, 0xDF, 0xBF, 0x82, 0xEA,
+    0x47, 0xFD, 0xC7, 0xF4, 0x9F, 0xAE, 0x7B, 0x80, 0x79, 0x93, 0xFE, 0x1E, 0x4D, 0xC0, 0x9E, 0x5A,
+    0xFD, 0x3D, 0xF6, 0xEF, 0xFF, 0x88, 0xFC, 0x83, 0x9F, 0x08, 0xCA, 0xA5, 0xC2, 0x57, 0x44, 0xE0,
+    0x9E, 0x1F, 0x9B, 0xB1, 0x19, 0x9B, 0xE9, 0x2B, 0x21, 0x69, 0x3E, 0xDB, 0x64, 0x16, 0x1D, 0xDB,
+    0x49, 0x85, 0x5F, 0xF6, 0x57, 0x82, 0xC0, 0x55, 0x4E, 0x85, 0x66, 0xD4, 0xB1, 0x9B, 0x6D, 0xF2,
+    0xF9, 0x97, 0xFF, 0x65, 0x3D, 0xB4, 0xD3, 0x6F, 0xFF, 0xDE, 0x5F, 0xFC, 0xDD, 0x27, 0x9E, 0xD0,
+    0xF1, 0x97, 0xBF, 0x66, 0xE5, 0x38, 0xFC, 0xC1, 0xF0, 0xEF, 0x22, 0x19, 0x9C, 0x45, 0xC5, 0xD8,
+    0x30, 0x69, 0xAE, 0xE6, 0xA7, 0xD9, 0xDE, 0xC8, 0xFD, 0x4B, 0xD9, 0x3F, 0xBD, 0xF2, 0xE9, 0x95,
+    0x2A, 0xB1, 0x49, 0x7C, 0x6E, 0xF6, 0x8C, 0x96, 0xA1, 0x23, 0xAA, 0x7D, 0xE0, 0x5F, 0xB7, 0xB1,
+    0x1B, 0x50, 0x5F, 0xEE, 0xC2, 0x75, 0x35, 0xEB, 0xD0, 0xD7, 0xA9, 0x9D, 0xAC, 0x4B, 0x4D, 0x2C,
+    0x16, 0x6C, 0x9B, 0x50, 0x33, 0xA0, 0x5F, 0xD0, 0xD1, 0x29, 0x46, 0xAC, 0x84, 0x7D, 0x75, 0x6A,
+    0xDF, 0x5F, 0xEB, 0x64, 0x46, 0x4B, 0xDE, 0x24, 0xD3, 0xE3, 0x57, 0xB3, 0x43, 0xEF, 0x8E, 0x2D,
+    0x0E, 0xCF, 0x60, 0x19, 0x35, 0x97, 0x66, 0x42, 0x3D, 0x43, 0x12, 0xF4, 0xC6, 0x53, 0x57, 0x13,
+    0x40, 0xC0, 0x06, 0xE8, 0xF8, 0x7F, 0x5E, 0x98, 0x0D, 0x97, 0x86, 0x33, 0xF6, 0x1C, 0x50, 0x9D,
+    0x87, 0xCF, 0x8A, 0xAB, 0xCE, 0xFF, 0xBB, 0x19, 0x61, 0x07, 0xF4, 0xFD, 0xE8, 0x39, 0xF3, 0xDD,
+    0x85, 0x2A, 0x65, 0x95, 0xB2, 0x5A, 0xFC, 0xF7, 0xA2, 0xE5, 0xA4, 0xE9, 0xC4, 0x06, 0x69, 0xC8,
+    0x77, 0xC8, 0xE8, 0x99, 0x50, 0xAF, 0xA8, 0x32, 0x40, 0xC0, 0x3B, 0xF4, 0x03, 0x6C, 0x80, 0x19,
+    0xD1, 0x45, 0xE8, 0x88, 0x76, 0xD9, 0xB2, 0xF3, 0xB0, 0xE7, 0x60, 0x08, 0xCB, 0xD8, 0xFD, 0x74,
+    0x6D, 0x62, 0xFF, 0x54, 0x36, 0xC1, 0x72, 0x54, 0x1C, 0x5A, 0xCE, 0xED, 0x1D, 0x3E, 0xB3, 0x74,
+    0xEF, 0xAF, 0xCD, 0xD2, 0x5F, 0x5C, 0x35, 0x09, 0x66, 0x54, 0xE7, 0x81, 0xB3, 0xA8, 0x39, 0x69,
+    0x2E, 0xE6, 0xA3, 0x64, 0x87, 0xB5, 0x77, 0x6B, 0xFF, 0xD4, 0x6A, 0xDF, 0x5D, 0x2D, 0x93, 0xBE,
+    0x9B, 0xA0, 0x16, 0xE8, 0x78, 0xC8, 0x91, 0x74, 0x5C, 0x70, 0x00, 0xE0, 0x4F, 0x51, 0x45, 0x34,
+    0x01, 0x06, 0x96, 0x0B, 0x39, 0x35, 0x01, 0x1D, 0xF0, 0x2D, 0x54, 0x97, 0xD1, 0xF3, 0x33, 0xF2,
+    0xED, 0x83, 0x83, 0x52, 0x6D, 0xB1, 0x14, 0x1C, 0xDA, 0xFE, 0xFA, 0x2D, 0x5C, 0xAB, 0x67, 0x35,
+    0xE9, 0xD0, 0x39, 0x8B, 0x27, 0xF1, 0x6D, 0x5C, 0x43, 0x2A, 0xFF, 0x5D, 0xC3, 0x35, 0x7C, 0x1D,
+    0x4F, 0xE2, 0x51, 0xE0, 0x1B, 0xE8, 0xA0, 0x46, 0x24, 0x18, 0xB4, 0xA1, 0x8E, 0xB8, 0x06, 0x03,
+    0x1D, 0xD4, 0x54, 0xCD, 0xB8, 0x86, 0x27, 0x61, 0xD0, 0x0D, 0x3A, 0xB4, 0xE1, 0xD4, 0x80, 0xFA,
+    0xE5, 0xCB, 0xED, 0x5B, 0x49, 0xE7, 0xAC, 0xE3, 0x75, 0x1D, 0xAE, 0x77, 0xE1, 0x35, 0xE3, 0x92,
+    0x45, 0xB2, 0x55, 0xEA, 0xEB, 0xE5, 0xBA, 0x9A, 0xCF, 0x57, 0xFB, 0xD8, 0x73, 0x28, 0xB3, 0x25,
+    0x9B, 0x4F, 0xB2, 0x1D, 0x69, 0x6F, 0xB0, 0x7F, 0x29, 0xFB, 0xA7, 0xB3, 0x3F, 0xB7, 0xFA, 0x73,
+    0xC9, 0x3F, 0xBB, 0xF4, 0x8C, 0x96, 0xA3, 0xA6, 0xAB, 0xC4, 0x43, 0x31, 0x53, 0x43, 0xE7, 0x53,
+    0xC7, 0xE8, 0x19, 0x3E, 0xCB, 0x55, 0x3B, 0xC3, 0x06, 0x10, 0x2A, 0xA1, 0x9B, 0xE0, 0x9D, 0x4A,
+    0x05, 0x7B, 0xDD, 0xDB, 0x87, 0xA1, 0xB3, 0x8C, 0x9A, 0x19, 0xA1, 0x1F, 0xD0, 0x8D, 0xD0, 0x11,
+    0x7A, 0x86, 0x9E, 0xD1, 0xCD, 0x30, 0x11, 0x66, 0x82, 0xE5, 0xDA, 0x91, 0xCF, 0x14, 0xDE, 0xF3,
+    0x9E, 0x43, 0x4F, 0x58, 0xC6, 0xF6, 0x87, 0x09, 0xF0, 0x80, 0x09, 0x7B, 0xFD, 0xA8, 0x38, 0x54,
+    0x8C, 0xA8, 0x08, 0x98, 0x00, 0x1D, 0xAF, 0x5F, 0x48, 0x86, 0xA9, 0xE1, 0x22, 0xFC, 0x77, 0xD9,
+    0xE0, 0x6C, 0x84, 0x4D, 0xB0, 0x19, 0x86, 0x83, 0x79, 0x6F, 0xEC, 0xDE, 0x8C, 0xDD, 0xCD, 0xA4,
+    0xC7, 0xDC, 0x92, 0x9F, 0x93, 0xE9, 0xF0, 0xEA, 0x5D, 0xA8, 0x84, 0x1D, 0x46, 0x0C, 0xCB, 0xA9,
+    0xE3, 0xDC, 0x32, 0xA9, 0x08, 0x24, 0xA0, 0xCF, 0x30, 0x8C, 0xF5, 0x77, 0x57, 0x40, 0xDA, 0xDA,
+    0xCE, 0xFF, 0xE0, 0xF9, 0xA4, 0x99, 0x54, 0xB9, 0x4E, 0x75, 0x1E, 0x1D, 0x83, 0xE1, 0x64, 0xEE,
+    0x5E, 0xE9, 0x22, 0xDA, 0x08, 0x75, 0x37, 0x57, 0xE4, 0xD4, 0xFF, 0x65, 0x32, 0x63, 0xDF, 0xC6,
+    0xEE, 0x46, 0x6A, 0xA3, 0x7D, 0x77, 0x69, 0x99, 0xE0, 0x97, 0x92, 0x88, 0xAE, 0xC8, 0xF7, 0xC9,
+    0xB9, 0x67, 0x7A, 0xE8, 0x14, 0x9D, 0xA0, 0x23, 0xDA, 0x19, 0x4D, 0xDA, 0xC1, 0x3C, 0x22, 0x37,
+    0xC3, 0xA8, 0x3F, 0xC9, 0xCD, 0x6C, 0x87, 0x6C, 0x82, 0xE1, 0xA8, 0x18, 0x1A, 0x2E, 0xCD, 0xCA,
+    0x73, 0x49, 0xC7, 0xAC, 0x92, 0x7D, 0x3D, 0xB7, 0x24, 0xFC, 0xB1, 0x59, 0xDA, 0x32, 0x75, 0x9F,
+    0xAF, 0x36, 0x64, 0x3B, 0x64, 0x3B, 0x64, 0xFB, 0x97, 0xD9, 0x70, 0x6D, 0x77, 0xB3, 0xD4, 0x4F,
+    0x9E, 0xCE, 0x2F, 0x38, 0xEB, 0x80, 0x08, 0x0D, 0x44, 0x74, 0x52, 0x05, 0x6B, 0x7B, 0x7B, 0x1A,
+    0xE4, 0x6D, 0xE6, 0x83, 0x03, 0x07, 0xD4, 0xE4, 0x9B, 0x05, 0x3E, 0x3A, 0xFA, 0xF3, 0x51, 0x74,
+    0x4E, 0x0F, 0x3A, 0xB4, 0xA3, 0x8A, 0xD5, 0x8C, 0x84, 0x27, 0xD1, 0xB9, 0x66, 0x2C, 0xF3, 0xB0,
+    0x19, 0x31, 0xE3, 0x49, 0xB4, 0x01, 0x97, 0x81, 0xDF, 0x84, 0x76, 0x2A, 0xE2, 0x1A, 0x3A, 0x34,
+    0x63, 0x35, 0xE3, 0xDB, 0xE8, 0x5C, 0x1B, 0x54, 0xC4, 0x82, 0x6F, 0xC3, 0xA2, 0x73, 0x3A, 0xB4,
+    0xA1, 0x19, 0xEB, 0x4B, 0xA8, 0xD6, 0xC7, 0x5B, 0x5E, 0xEF, 0xEE, 0xAD, 0xF6, 0xA5, 0xD4, 0x57,
+    0xC9, 0x57, 0xCB, 0x75, 0x35, 0xE7, 0x26, 0xFA, 0x2E, 0xF6, 0x9C, 0xCC, 0x17, 0x63, 0xE5, 0x00,
+    0x7F, 0xA9, 0xE3, 0xDB, 0xD9, 0xBC, 0x3A, 0xBE, 0xD8, 0x37, 0x9F, 0x93, 0xDF, 0xE1, 0x25, 0xE3,
+    0xE0, 0xE1, 0xC8, 0x8A, 0x09, 0x07, 0x80, 0x1F, 0x0C, 0x6F, 0x64, 0xFF, 0xEA, 0xD8, 0xF7, 0x55,
+    0x5E, 0x9A, 0x7B, 0xA3, 0xA1, 0x5B, 0x7D, 0x1B, 0xC9, 0xA7, 0x18, 0x71, 0x1E, 0xF5, 0x95, 0xD3,
+    0x97, 0xCC, 0xCD, 0x84, 0xE4, 0xD1, 0x32, 0xA0, 0x8F, 0x50, 0x2B, 0xE0, 0x47, 0x18, 0xA2, 0xF9,
+    0x74, 0xAE, 0x56, 0x13, 0xEC, 0x4B, 0x09, 0x00, 0x2A, 0x7F, 0xA9, 0xE1, 0xDC, 0xFC, 0x7E, 0x02,
+    0x56, 0xEC, 0xAD, 0x0D, 0xD7, 0xEE, 0x6E, 0xB2, 0x4F, 0x2F, 0xB6, 0x89, 0x96, 0x63, 0x47, 0x57,
+    0xED, 0x03, 0x2B, 0x60, 0x01, 0x1D, 0xD0, 0x4C, 0xA8, 0x3F, 0x5B, 0x41, 0x06, 0xFB, 0xF1, 0xDC,
+    0x8D, 0x6B, 0x1B, 0xED, 0xB9, 0x59, 0x87, 0xD4, 0xC4, 0xBE, 0x5E, 0xBA, 0x61, 0x6D, 0x47, 0xAB,
+    0xA2, 0xA4, 0x2A, 0xAD, 0x80, 0x0E, 0x40, 0x02, 0xBA, 0x01, 0xF5, 0x7C, 0xFA, 0x92, 0x3D, 0xB7,
+    0xA8, 0xB8, 0xA2, 0xB7, 0xAE, 0xBD, 0x3D, 0x82, 0x0B, 0x34, 0x43, 0xB5, 0x5E, 0x87, 0xB9, 0x18,
+    0xD5, 0x6C, 0x07, 0x5B, 0xC9, 0x8C, 0xB8, 0x8E, 0x15, 0xA9, 0x4A, 0xF5, 0xA2, 0x66, 0x15, 0x9B,
+    0xD8, 0x4E, 0x7A, 0xD4, 0x41, 0x87, 0x2E, 0x98, 0xC1, 0x3A, 0xA0, 0xFA, 0x5F, 0x52, 0x3B, 0xE9,
+    0xAB, 0x89, 0x93, 0xFD, 0x98, 0xFE, 0xC6, 0xAA, 0xA3, 0x6D, 0xA3, 0x7D, 0x2A, 0x59, 0x97, 0xDA,
+    0x29, 0x35, 0xD1, 0x9E, 0x8B, 0x66, 0x48, 0xDD, 0xB0, 0xAA, 0xF8, 0x9A, 0x8A, 0xDD, 0xC5, 0x9D,
+    0x75, 0x5A, 0xFF, 0x8F, 0x0B, 0xEE, 0x31, 0xF4, 0x1F, 0x47, 0x13, 0x92, 0x9E, 0xAC, 0x8A, 0xDD,
+    0x8D, 0xD4, 0x4E, 0x2F, 0xD6, 0xB3, 0x71, 0x49, 0x07, 0xAB, 0x62, 0x17, 0x00, 0xE0, 0xCA, 0x6B,
+    0xD0, 0x7E, 0xA9, 0xD8, 0x07, 0x13, 0x92, 0x9A, 0x75, 0xB0, 0x48, 0x4D, 0xEC, 0xC2, 0x8B, 0x6A,
+    0x69, 0xA3, 0x07, 0x39, 0xEA, 0xF7, 0xE6, 0x6A, 0xF9, 0x1A, 0xCC, 0x00, 0x35, 0x03, 0x56, 0xEA,
+    0xA3, 0xD7, 0x1C, 0x98, 0xBB, 0x9F, 0xBC, 0x9E, 0xD0, 0xCD, 0xF0, 0x53, 0xC5, 0xA1, 0x4E, 0xCE,
+    0x7C, 0x87, 0xB3, 0x5F, 0x45, 0x81, 0x7F, 0x0B, 0x4F, 0xE2, 0xC2, 0xBF, 0xF5, 0x7C, 0xFE, 0xEE,
+    0x4B, 0x09, 0xD7, 0x61, 0x9D, 0x0E, 0x4D, 0xAC, 0x92, 0x60, 0xD2, 0xE7, 0x77, 0x60, 0xDF, 0x25,
+    0xA9, 0x4D, 0x67, 0xB9, 0x42, 0x91, 0x11, 0x66, 0xAD, 0xA4, 0x44, 0x6F, 0xB3, 0x02, 0x30, 0xF1,
+    0xF1, 0xC3, 0x2B, 0x0C, 0xE4, 0x8F, 0x73, 0x43, 0xEA, 0xC5, 0x30, 0xD9, 0xC9, 0x0F, 0xE0, 0xCD,
+    0x15, 0x8A, 0xB7, 0xEF, 0x9C, 0x6F, 0x48, 0x4E, 0xAD, 0x24, 0x5C, 0x72, 0x05, 0xFA, 0x9F, 0xED,
+    0x0B, 0x48, 0xD3, 0x08, 0x17, 0x63, 0x11, 0x82, 0x88, 0x22, 0xDD, 0x56, 0xE5, 0xF8, 0x6B, 0x7B,
+    0x00, 0xAE, 0x3D, 0x09, 0x60, 0xFE, 0x16, 0xF0, 0x58, 0x4E, 0x42, 0x45, 0xE9, 0xC8, 0x15, 0x9E,
+    0x4C, 0x35, 0xF9, 0xDD, 0xB9, 0xE1, 0xED, 0x76, 0xD2, 0x7C, 0x52, 0x3B, 0x93, 0xBE, 0xDE, 0xC1,
+    0xCE, 0xD7, 0x9E, 0x44, 0x1F, 0xE7, 0x27, 0xE0, 0xDF, 0x8F, 0xD7, 0xE0, 0x7F, 0x3C, 0xCD, 0xE0,
+    0xCD, 0xB7, 0x23, 0xF8, 0xE6, 0xCD, 0x09, 0x7C, 0xEB, 0xE2, 0x08, 0xDE, 0x6E, 0x03, 0x7C, 0xD6,
+    0x0E, 0xFD, 0xDA, 0xFD, 0xBD, 0xAD, 0x36, 0x8A, 0xE4, 0x72, 0x26, 0x28, 0xF2, 0x43, 0xA8, 0x77,
+    0x66, 0xA0, 0xBD, 0x39, 0x01, 0xFA, 0xE2, 0x78, 0x8C, 0x2C, 0x7F, 0x49, 0x72, 0x37, 0x85, 0xCC,
+    0x44, 0x2E, 0x35, 0xE7, 0x53, 0xB1, 0xE1, 0x80, 0x33, 0x7A, 0x97, 0x60, 0x23, 0x37, 0x89, 0x88,
+    0x8F, 0x3E, 0x3D, 0xF6, 0xD1, 0x3E, 0x37, 0xFA, 0xC9, 0xF6, 0xC1, 0x8F, 0x3D, 0x03, 0x47, 0xFF,
+    0xA1, 0x63, 0xF0, 0x01, 0x0C, 0x74, 0xE0, 0x48, 0xC0, 0xBF, 0x4F, 0xA0, 0xFF, 0x79, 0x06, 0x2C,
+    0xF3, 0x3F, 0x95, 0x13, 0xEB, 0xD2, 0x8C, 0x04, 0x78, 0x7E, 0x58, 0x2A, 0x69, 0x34, 0x85, 0x1E,
+    0xBD, 0xCA, 0xD7, 0x42, 0x1E, 0xBA, 0x73, 0x70, 0xFE, 0xE1, 0xC4, 0xB3, 0x09, 0xA5, 0xF0, 0xCB,
+    0x96, 0x9B, 0x38, 0x54, 0x24, 0x5D, 0x2D, 0xB9, 0x60, 0x1B, 0x69, 0xC5, 0x97, 0x1C, 0x71, 0xE0,
+    0x2A, 0x7F, 0xF0, 0xC0, 0xCD, 0x3C, 0xBA, 0xF9, 0x04, 0xD6, 0x7B, 0xA9, 0x94, 0xBD, 0x55, 0xA5,
+    0x16, 0x0C, 0x01, 0x9D, 0xAB, 0xCB, 0x85, 0xBE, 0x6B, 0xE6, 0xED, 0xA4, 0x7B, 0xFD, 0x9D, 0x03,
+    0x48, 0x89, 0x58, 0xE1, 0x0B, 0xBE, 0x90, 0x0F, 0x5C, 0xC9, 0xDA, 0xBA, 0x9A, 0x0F, 0x9D, 0xB0,
+    0xBD, 0xDB, 0x92, 0x62, 0xEC, 0xEE, 0xBB, 0xBD, 0x8A, 0x68, 0x3C, 0x49, 0xA1, 0x12, 0xB6, 0x98,
+    0xD4, 0x92, 0x0D, 0x27, 0x63, 0x0D, 0x63, 0xA1, 0x15, 0x0A, 0xEA, 0x1B, 0x01, 0xE0, 0x1B, 0xEA,
+    0xEE, 0x3E, 0xCC, 0xEB, 0xFC, 0x29, 0x09, 0xFD, 0x73, 0x66, 0x72, 0x52, 0x99, 0x24, 0xD3, 0x56,
+    0xCC, 0xD4, 0x2F, 0x9A, 0xC1, 0x8F, 0x26, 0xD5, 0x0C, 0xDD, 0xAC, 0x57, 0x70, 0x6A, 0xD7, 0x52,
+    0xCB, 0xB4, 0x14, 0x04, 0x0C, 0x7E, 0x6C, 0x33, 0xAC, 0xA4, 0xF0, 0x74, 0xB3, 0x4E, 0x8A, 0xA1,
+    0x5D, 0x55, 0xAE, 0x19, 0x15, 0x2B, 0x3A, 0x2E, 0x60, 0xF0, 0x81, 0x2B, 0xEC, 0x64, 0x63, 0x2F,
+    0xC7, 0x58, 0x49, 0x0D, 0xB2, 0x3E, 0x2A, 0x96, 0xD2, 0xB3, 0xA2, 0x61, 0x8A, 0x87, 0x00, 0xA0,
+    0xBE, 0x5C, 0xC4, 0xB8, 0xE0, 0x3A, 0x5A, 0xC2, 0x0E, 0x8A, 0x41, 0x4F, 0x60, 0x6C, 0x66, 0xF4,
+    0xA9, 0x4E, 0xE8, 0xE8, 0x88, 0xF6, 0xDE, 0x68, 0x07, 0x75, 0x77, 0xEE, 0xC6, 0xD3, 0xE4, 0xD5,
+    0xBB, 0x8A, 0x24, 0x6F, 0x90, 0xE4, 0xD4, 0x7E, 0x92, 0xEC, 0xA0, 0x96, 0xBE, 0x1B, 0x4F, 0xD3,
+    0xDF, 0xCE, 0x47, 0xDF, 0x8C, 0x3A, 0x5A, 0x3B, 0xA8, 0x45, 0xBF, 0x37, 0x62, 0x55, 0xF7, 0x22,
+    0x7A, 0xF8, 0x04, 0x13, 0x4C, 0x86, 0x8E, 0x2D, 0x9D, 0x5A, 0x2A, 0x8E, 0xD5, 0x8A, 0x3E, 0x02,
+    0x9A, 0x57, 0x8A, 0xC1, 0x36, 0x4A, 0x58, 0x62, 0xC5, 0x36, 0x4F, 0x00, 0xFB, 0x99, 0xA4, 0xD3,
+    0x2F, 0x4D, 0x16, 0xB7, 0x94, 0xE1, 0xFB, 0xA8, 0x09, 0x1B, 0x7B, 0x29, 0xD8, 0x63, 0x07, 0xD8,
+    0xA9, 0x5D, 0xBB, 0x11, 0x7A, 0x6E, 0xD9, 0x31, 0x36, 0xF9, 0x2A, 0xAF, 0x32, 0xD5, 0x24, 0xDF,
+    0x63, 0x06, 0xC9, 0xFF, 0x81, 0xB7, 0x9C, 0x65, 0x76, 0x76, 0x44, 0x77, 0xF7, 0xCF, 0xD0, 0x45,
+    0x34, 0xA9, 0x98, 0xAE, 0x52, 0xEF, 0x86, 0x01, 0xA0, 0x93, 0x8A, 0xDE, 0x23, 0xBA, 0x19, 0xD0,
+    0xEB, 0x3F, 0x97, 0xCA, 0xCD, 0xA9, 0x96, 0x29, 0x09, 0x49, 0x17, 0x13, 0xBF, 0xE9, 0xEC, 0x36,
+    0xF5, 0x76, 0xF5, 0xE3, 0xCB, 0xFC, 0x43, 0x49, 0x92, 0x00, 0xFA, 0xBF, 0xE2, 0x04, 0xA0, 0x66,
+    0xC5, 0x70, 0x6A, 0x1F, 0x3A, 0x29, 0x36, 0x5C, 0x61, 0xA3, 0x4E, 0x3D, 0x53, 0xC5, 0xA1, 0xFF,
+    0x94, 0x1C, 0x9B, 0x55, 0xF1, 0x7B, 0x4B, 0x07, 0xF3, 0x99, 0x4F, 0x3E, 0x00, 0x24, 0xDF, 0x91,
+    0x2A, 0x8A, 0xB9, 0x25, 0xD0, 0x91, 0xA3, 0xE6, 0x00, 0xCF, 0x8C, 0x8E, 0x41, 0x51, 0x27, 0x74,
+    0x1C, 0x74, 0x32, 0x11, 0x9A, 0xB0, 0x93, 0x1F, 0xA1, 0xD7, 0x8A, 0x4F, 0xD1, 0xA1, 0x9B, 0xDB,
+    0x55, 0xE5, 0x33, 0xE8, 0x83, 0x8D, 0x3A, 0xBD, 0xF6, 0x3C, 0xC1, 0x60, 0x7F, 0x4E, 0xCE, 0x2A,
+    0xC3, 0xBF, 0x4B, 0x0E, 0xDD, 0x5C, 0xF1, 0x3B, 0x5B, 0xFD, 0xB0, 0xF3, 0x40, 0x95, 0x60, 0x87,
+    0x36, 0x36, 0xB1, 0x26, 0xEC, 0xD0, 0x05, 0x9D, 0xAA, 0x15, 0x3D, 0xFA, 0xA8, 0x63, 0x9D, 0x14,
+    0x07, 0x3B, 0xB4, 0x51, 0xE7, 0x3A, 0xC1, 0x84, 0xEB, 0x8B, 0x8E, 0xF0, 0xEA, 0x8B, 0xC9, 0xBA,
+    0x3A, 0x75, 0xEF, 0xBD, 0x9C, 0xA0, 0xE3, 0x6B, 0xAF, 0xE9, 0x09, 0xF6, 0xE2, 0xE7, 0x73, 0xEF,
+    0x34, 0xB9, 0x95, 0x4C, 0x21, 0xF1, 0xC2, 0x47, 0x9F, 0x65, 0x7F, 0x1E, 0xF6, 0xC2, 0xC5, 0x9F,
+    0x27, 0x60, 0x5D, 0xF5, 0x5B, 0x13, 0xD4, 0x17, 0xD1, 0xF6, 0x80, 0xBE, 0x3D, 0xE4, 0x24, 0xB9,
+    0xAB, 0x23, 0x2A, 0x46, 0x4D, 0xA0, 0xA1, 0xB3, 0x0B, 0x0A, 0xAF, 0x4B, 0x6A, 0xF7, 0x6E, 0x35,
+    0xCC, 0x61, 0x78, 0x17, 0x55, 0x86, 0x25, 0xA7, 0x3A, 0xA3, 0x27, 0x97, 0x7A, 0x85, 0x27, 0x57,
+    0x95, 0xE0, 0x9D, 0xCA, 0x2A, 0x81, 0xA8, 0xD8, 0x24, 0xF0, 0xF4, 0x65, 0xB6, 0x4B, 0x45, 0x1D,
+    0xA9, 0xE7, 0x3A, 0x77, 0x91, 0x3A, 0xAA, 0xD5, 0xBC, 0x4F, 0x1D, 0x55, 0xB2, 0xEF, 0xE4, 0x6E,
+    0x52, 0xC9, 0xDE, 0x5C, 0xCD, 0xD4, 0x2C, 0xFD, 0xCD, 0x64, 0xC7, 0x76, 0xE9, 0x5F, 0x49, 0x36,
+    0xE8, 0xD9, 0xBF, 0xB2, 0xF4, 0x41, 0x47, 0x3E, 0xBB, 0xF8, 0xA1, 0x8B, 0xD4, 0x33, 0x9D, 0x79,
+    0x9F, 0x3A, 0x12, 0xE6, 0x9D, 0x8C, 0x3A, 0xC3, 0xDE, 0x5C, 0xD1, 0x26, 0xD8, 0x9B, 0xF9, 0xD0,
+    0x2F, 0xE8, 0x6F, 0x92, 0x8C, 0xF0, 0xAF, 0x88, 0x06, 0x7B, 0x76, 0x57, 0x5F, 0xE3, 0x00, 0x27,
+    0x6E, 0x9E, 0x51, 0x1D, 0xF2, 0x0E, 0x8E, 0x6A, 0xCD, 0x05, 0xE0, 0xD0, 0xDF, 0xDA, 0x12, 0xEF,
+    0xBF, 0xD1, 0x26, 0xC0, 0x64, 0x1B, 0xA1, 0x98, 0x39, 0x48, 0xC5, 0xDB, 0x9A, 0x9F, 0x33, 0x42,
+    0xE7, 0x8A, 0x41, 0x02, 0xCD, 0x8A, 0xE5, 0x9E, 0x17, 0x76, 0x44, 0x3F, 0x55, 0x44, 0xC5, 0x41,
+    0x6A, 0xF9, 0xD8, 0x09, 0xDD, 0x52, 0x73, 0x40, 0x1F, 0xBB, 0x15, 0xE0, 0x3D, 0x29, 0x88, 0xC1,
+    0x00, 0xC5, 0x35, 0x03, 0x8A, 0x17, 0xE7, 0x07, 0x31, 0x0C, 0xC9, 0x7C, 0x11, 0x0D, 0xB7, 0x77,
+    0x70, 0x70, 0xEC, 0x5B, 0xBF, 0x62, 0x57, 0x55, 0x63, 0x41, 0x4D, 0x26, 0x54, 0x9C, 0xFE, 0xF3,
+    0x2D, 0xDB, 0x73, 0xCB, 0x77, 0xA9, 0x2E, 0xAC, 0x07, 0xA5, 0x4C, 0xBA, 0x25, 0x23, 0x4E, 0xF1,
+    0x27, 0xE7, 0x05, 0xCC, 0xA8, 0x7D, 0xFE, 0x7E, 0x51, 0xD9, 0x56, 0x0A, 0x80, 0xEE, 0x58, 0xD8,
+    0xAD, 0xDC, 0xCA, 0x63, 0x3C, 0x55, 0xE4, 0xB0, 0x25, 0x2F, 0xA5, 0x2D, 0x93, 0x68, 0xAF, 0x54,
+    0xD0, 0xF5, 0x11, 0xFD, 0xD4, 0xD0, 0xD5, 0x74, 0x76, 0x81, 0x4E, 0x72, 0x5F, 0x85, 0x2E, 0x01,
+    0x1C, 0x38, 0xA2, 0xC9, 0x3A, 0x03, 0x66, 0xF6, 0x11, 0xE0, 0xCD, 0xAD, 0xFE, 0x59, 0x75, 0x21,
+    0xF3, 0x27, 0x90, 0xFA, 0xE2, 0x96, 0x64, 0xAC, 0x04, 0xE0, 0xB0, 0x99, 0x03, 0x2A, 0x5E, 0x94,
+    0x1B, 0xA3, 0xA4, 0x07, 0x6E, 0x8C, 0x12, 0xD0, 0x2D, 0x8A, 0x0E, 0x7E, 0x6C, 0x09, 0x45, 0x74,
+    0xA9, 0xA4, 0xBF, 0x34, 0x24, 0x53, 0x4B, 0x09, 0x3C, 0x73, 0xD1, 0x24, 0xE7, 0xBD, 0x3F, 0xE0,
+    0x9F, 0xEF, 0x6F, 0xFB, 0xD3, 0xEF, 0x40, 0x0A, 0xEF, 0x34, 0x52, 0xAC, 0x79, 0x28, 0x08, 0x92,
+    0x49, 0x67, 0x50, 0x71, 0xF9, 0xD7, 0x82, 0x4F, 0x76, 0x9E, 0x23, 0x7E, 0xD5, 0xE6, 0x5D, 0x21,
+    0xCC, 0x09, 0x68, 0x39, 0x16, 0x22, 0xE6, 0xB7, 0x19, 0x80, 0xBF, 0x7F, 0x5F, 0x0D, 0xE1, 0x6D,
+    0x90, 0xBC, 0x84, 0x62, 0xD5, 0xB1, 0x6A, 0xF4, 0xEB, 0x56, 0xAC, 0x7B, 0x04, 0xA0, 0x2E, 0x55,
+    0x3E, 0x6D, 0x61, 0xDB, 0x20, 0xE5, 0x64, 0xA4, 0xF6, 0x95, 0x0F, 0x82, 0x23, 0x49, 0xFD, 0x7E,
+    0x40, 0x2F, 0x3B, 0xBA, 0xA5, 0x96, 0x1C, 0x11, 0x27, 0xA5, 0x0E, 0x19, 0x2A, 0x0E, 0x7B, 0x4E,
+    0x6A, 0x74, 0x19, 0x3A, 0xBD, 0xC0, 0xC6, 0x9E, 0x4B, 0xB3, 0xA2, 0x4B, 0xF6, 0x2E, 0x6B, 0x42,
+    0xE7, 0x2E, 0x9A, 0x91, 0xA1, 0xA5, 0x9E, 0x9B, 0xC5, 0xC6, 0x96, 0xE7, 0x12, 0xB2, 0x5E, 0x0C,
+    0x5F, 0x22, 0xFA, 0x67, 0x48, 0x06, 0x1F, 0xEC, 0xEB, 0x24, 0x07, 0x9B, 0x7D, 0x24, 0xE9, 0x34,
+    0x19, 0x2D, 0x3F, 0x84, 0xCA, 0xD2, 0x83, 0x2A, 0x97, 0x4C, 0x48, 0x5F, 0x50, 0xCC, 0x2D, 0x50,
+    0xB7, 0x51, 0x6F, 0x36, 0x87, 0x66, 0xE7, 0x73, 0xDD, 0x7F, 0x60, 0xF1, 0x2E, 0x46, 0xA0, 0x12,
+    0xD0, 0x8A, 0x09, 0x68, 0xE9, 0x27, 0x80, 0x37, 0x32, 0xD0, 0x2D, 0xDD, 0x84, 0x9A, 0x4F, 0x67,
+    0xC0, 0xCC, 0x76, 0x44, 0xCD, 0x67, 0x12, 0xD0, 0xCD, 0x74, 0xA8, 0xF8, 0xBD, 0xB8, 0xD1, 0x6D,
+    0x29, 0x09, 0x1B, 0x93, 0x54, 0xB8, 0xC7, 0xAF, 0x2A, 0x3A, 0x54, 0x93, 0x5D, 0x00, 0xAB, 0x19,
+    0xA0, 0xBF, 0x28, 0xF7, 0x2F, 0x19, 0xD1, 0xF3, 0x8D, 0x0C, 0xFD, 0xDE, 0xDC, 0x4F, 0x6A, 0x79,
+    0x51, 0x11, 0x5E, 0x0D, 0x36, 0xEE, 0xCA, 0xDD, 0x4A, 0xA9, 0xA9, 0xBC, 0x71, 0x57, 0x85, 0xC5,
+    0x6B, 0x25, 0xFF, 0x78, 0x02, 0x60, 0x3F, 0x04, 0x60, 0x78, 0xA5, 0x18, 0x24, 0x8D, 0x2C, 0x23,
+    0x72, 0x80, 0xBF, 0xE1, 0x63, 0xD5, 0x7F, 0xF6, 0xC2, 0xEA, 0x48, 0x32, 0x5A, 0x31, 0xD1, 0x24,
+    0xF9, 0x47, 0x27, 0x45, 0x52, 0x2A, 0x4F, 0xC5, 0x76, 0x55, 0x1C, 0x6A, 0x7E, 0x57, 0x2C, 0xA4,
+    0x51, 0x56, 0x8C, 0x26, 0x1D, 0x9A, 0x7C, 0x65, 0x2B, 0x39, 0x7E, 0xAC, 0xEC, 0xEE, 0xBC, 0x2D,
+    0xB0, 0xDD, 0x7D, 0x98, 0x1E, 0xDD, 0xB0, 0x75, 0xA9, 0x01, 0xD1, 0x91, 0x2B, 0xDA, 0xCD, 0x66,
+    0x49, 0xF0, 0x4C, 0x17, 0x5C, 0xC7, 0x17, 0x86, 0x33, 0x8A, 0xAF, 0xCF, 0x80, 0x8F, 0x06, 0xD0,
+    0x59, 0x45, 0x54, 0x0C, 0x4F, 0x02, 0x66, 0x69, 0x7E, 0x76, 0x70, 0x8E, 0xCE, 0x73, 0xB1, 0xB3,
+    0x26, 0xCF, 0x11, 0x64, 0xB4, 0x51, 0x7F, 0x4C, 0xC5, 0x6A, 0xB6, 0x93, 0x8D, 0xA6, 0xC9, 0x8A,
+    0xE7, 0xA2, 0x1F, 0x4D, 0xB2, 0x3A, 0x55, 0xBC, 0xF7, 0xBE, 0xD4, 0x80, 0x59, 0xA4, 0xAA, 0xAC,
+    0xE4, 0x25, 0x56, 0xE4, 0xFF, 0x03, 0x54, 0x77, 0x00, 0xC0, 0x38, 0x00, 0x55, 0xB1, 0x34, 0x04,
+    0xEF, 0x2C, 0x75, 0x59, 0x76, 0xD5, 0x85, 0xF4, 0x51, 0x66, 0x8C, 0x5A, 0xE9, 0x00, 0xF3, 0xE9,
+    0x0A, 0x80, 0xAF, 0x4A, 0xEA, 0x21, 0x27, 0x4B, 0x92, 0xC3, 0x0F, 0xF9, 0x43, 0x7E, 0x1F, 0x3A,
+    0xB5, 0x09, 0xF0, 0xA3, 0x91, 0x9A, 0x38, 0x62, 0x74, 0x2C, 0xA7, 0xF8, 0x93, 0xE7, 0xB3, 0x6B,
+    0x57, 0x74, 0x33, 0x6C, 0x84, 0x95, 0xBB, 0x79, 0x0C, 0x3A, 0x41, 0xE5, 0xE3, 0x65, 0x0E, 0xED,
+    0x7C, 0x94, 0xF6, 0x50, 0xF1, 0x4E, 0x51, 0x58, 0x96, 0x9C, 0x60, 0xC8, 0x08, 0x7D, 0xA9, 0x9F,
+    0xF1, 0xC8, 0xB1, 0x22, 0x00, 0x66, 0x3E, 0x7D, 0x78, 0xE8, 0xEF, 0x98, 0x2D, 0xB3, 0x34, 0xC1,
+    0x30, 0x8B, 0x53, 0xF0, 0x27, 0xE4, 0xAD, 0x2B, 0x7E, 0x2B, 0x95, 0x1A, 0xE5, 0xF0, 0xB8, 0x99,
+    0x9D, 0x26, 0xE1, 0xBF, 0x13, 0xD3, 0xB8, 0xA5, 0x38, 0x27, 0xEB, 0x96, 0x4A, 0x26, 0xBA, 0xF7,
+    0x6B, 0x28, 0xB4, 0x90, 0x0B, 0x1C, 0xC5, 0x90, 0xB6, 0xE4, 0x0A, 0x92, 0xA9, 0xE6, 0x17, 0x3F,
+    0x9F, 0x1B, 0x5E, 0x9C, 0xCE, 0xE8, 0xDC, 0x4C, 0xE8, 0x52, 0x3B, 0xC2, 0xCE, 0x3A, 0xC0, 0x46,
+    0x1D, 0xD0, 0x4F, 0x7A, 0x80, 0x1F, 0x3B, 0x07, 0x8E, 0xC6, 0x81, 0xC1, 0x62, 0x7B, 0x7A, 0x11,
+    0x60, 0x78, 0x0D, 0xE0, 0x78, 0x0D, 0xF0, 0x31, 0x01, 0x76, 0x4D, 0x5F, 0x62, 0xC0, 0x37, 0x71,
+    0x23, 0xFB, 0x9C, 0x3A, 0x0A, 0x34, 0xA8, 0x19, 0x09, 0x68, 0x63, 0x9D, 0x00, 0x1D, 0x55, 0x02,
+    0x4C, 0xD4, 0x72, 0x87, 0x3A, 0xD1, 0x89, 0x92, 0xF3, 0xC2, 0xE5, 0x34, 0x6F, 0xF9, 0xBB, 0x97,
+    0x25, 0x47, 0xB0, 0xA2, 0xF3, 0x63, 0x49, 0x4C, 0x10, 0xF5, 0xAA, 0x08, 0x0E, 0x68, 0x72, 0x45,
+    0x87, 0x66, 0xAD, 0xE9, 0xD0, 0xEE, 0x6E, 0x30, 0xB4, 0x3D, 0x77, 0x8B, 0xE2, 0x6D, 0x98, 0x59,
+    0x91, 0x30, 0xB1, 0xA6, 0xD4, 0xDE, 0xCF, 0xC0, 0xC9, 0x5C, 0xE0, 0x9A, 0x77, 0xB0, 0x25, 0xBD,
+    0xB6, 0x65, 0xE3, 0x90, 0x62, 0xE3, 0x63, 0x77, 0x54, 0x51, 0x36, 0x1E, 0x25, 0x28, 0xA9, 0x72,
+    0x47, 0xB8, 0x19, 0xBB, 0x94, 0xB7, 0x7A, 0x2B, 0xB8, 0x11, 0x8E, 0xDE, 0x94, 0xBB, 0xB8, 0x71,
+    0x3C, 0x75, 0xE9, 0x8F, 0x1E, 0xD5, 0x8B, 0xCA, 0xFD, 0xD5, 0x0F, 0x72, 0xFD, 0xDE, 0xBD, 0x9C,
+    0xE8, 0xFE, 0x8F, 0x79, 0xB5, 0x7D, 0xE8, 0x92, 0xD5, 0x9C, 0x14, 0x6F, 0xBF, 0x42, 0x29, 0xC5,
+    0x34, 0xA1, 0xBD, 0x4D, 0x5E, 0x82, 0x8A, 0xAF, 0xF5, 0x80, 0x44, 0xA0, 0xF0, 0x5B, 0xA7, 0x9F,
+    0xBE, 0x24, 0x64, 0xF3, 0xC5, 0x90, 0x9C, 0x48, 0xF2, 0x1C, 0xC9, 0xB4, 0x77, 0x50, 0x76, 0xD9,
+    0xEA, 0x40, 0xC8, 0xC8, 0xB2, 0xF4, 0x6F, 0x90, 0xA4, 0xE4, 0x5F, 0x7F, 0xD9, 0xED, 0x10, 0xA4,
+    0x18, 0xC2, 0x83, 0xF7, 0x57, 0xB8, 0xEF, 0xF0, 0x52, 0x20, 0xA5, 0x61, 0x3E, 0x74, 0x7F, 0xC2,
+    0x58, 0x7A, 0x6E, 0x16, 0x74, 0x64, 0xAE, 0x49, 0x8E, 0x7B, 0xBF, 0xCF, 0x3F, 0x93, 0x13, 0x5C,
+    0xC8, 0xE2, 0x27, 0xF7, 0x9C, 0xA4, 0xBE, 0x43, 0x3F, 0x95, 0x2B, 0x9A, 0xA5, 0x9C, 0xBE, 0xDD,
+    0xF6, 0xAB, 0x5A, 0x78, 0xF1, 0x45, 0xD1, 0x35, 0x44, 0x61, 0x55, 0x1D, 0x95, 0x78, 0x4E, 0xA7,
+    0x06, 0x98, 0x7B, 0x59, 0xAA, 0x1A, 0x5E, 0xE0, 0x1D, 0x49, 0x82, 0xEB, 0x18, 0xFE, 0x08, 0xFF,
+    0x2D, 0xFD, 0x04, 0x4D, 0xBA, 0x53, 0xE4, 0x25, 0x58, 0x0E, 0x92, 0x33, 0xB0, 0x67, 0x63, 0x4D,
+    0x70, 0xD0, 0x4B, 0xB3, 0xA2, 0x1F, 0x4D, 0x54, 0x04, 0x83, 0x5D, 0x14, 0x5B, 0x06, 0x5D, 0x32,
+    0x38, 0x84, 0x07, 0xA4, 0x99, 0x85, 0x39, 0x8D, 0xA3, 0x02, 0x70, 0x15, 0x23, 0x80, 0xF4, 0x22,
+    0x80, 0x6F, 0xEB, 0x00, 0x98, 0x73, 0x13, 0xA0, 0x3F, 0x5B, 0x4A, 0x51, 0x91, 0xB1, 0x27, 0xB9,
+    0xEA, 0x5D, 0x65, 0xEE, 0x19, 0x0B, 0xAA, 0x15, 0xDF, 0x06, 0xB4, 0x33, 0xED, 0xAF, 0xA9, 0x51,
+    0xBF, 0x75, 0xFB, 0x46, 0x54, 0xE4, 0x9D, 0x04, 0xBE, 0x77, 0x3B, 0xC1, 0xBE, 0xFC, 0xF2, 0x22,
+    0xA1, 0x1E, 0x3F, 0xCB, 0x7D, 0x08, 0xBE, 0x86, 0x53, 0x46, 0xA6, 0x15, 0xB7, 0x8C, 0x09, 0x49,
+    0xF6, 0xAC, 0x76, 0xB1, 0xEE, 0x63, 0x65, 0xE8, 0x24, 0xDB, 0xAD, 0x94, 0x72, 0x6B, 0x8F, 0x97,
+    0x77, 0x93, 0xD4, 0xC4, 0x53, 0xE4, 0xB2, 0xF9, 0x8C, 0xB0, 0x2C, 0x69, 0xC1, 0xE4, 0x0A, 0x9B,
+    0xF5, 0xD2, 0xA7, 0xAA, 0x90, 0xCF, 0xD7, 0x4A, 0x6E, 0x0C, 0xD1, 0xA6, 0x9A, 0x4F, 0xD1, 0xD9,
+    0xA9, 0x4D, 0xED, 0x0A, 0x3A, 0x1B, 0x6D, 0x6C, 0x56, 0x30, 0x30, 0x74, 0x51, 0x65, 0x25, 0x55,
+    0xB4, 0x3B, 0xB9, 0xED, 0x83, 0xDC, 0xF8, 0xA1, 0x4C, 0x97, 0xED, 0xFE, 0x19, 0x35, 0xF3, 0x50,
+    0x2A, 0xB4, 0x5A, 0x49, 0x69, 0xE1, 0x8A, 0x76, 0x7D, 0x9E, 0x83, 0xDC, 0x8F, 0x61, 0xBB, 0xD9,
+    0x52, 0x46, 0x37, 0x8B, 0x25, 0xC9, 0x51, 0xB1, 0x62, 0xEC, 0xB6, 0x2A, 0xCF, 0xB3, 0x14, 0x67,
+    0x24, 0x39, 0x6E, 0x99, 0xD1, 0x03, 0x50, 0xF9, 0x9F, 0xB9, 0xE2, 0xDD, 0x14, 0x0D, 0x46, 0xF7,
+    0x40, 0x2D, 0xF7, 0xDD, 0xE3, 0x89, 0x0E, 0x40, 0x15, 0x7F, 0x04, 0xA0, 0xBD, 0x38, 0x6E, 0xF9,
+    0x21, 0x3D, 0x39, 0x0A, 0x81, 0x43, 0xEC, 0x19, 0xCD, 0x3B, 0x7D, 0x84, 0xE7, 0x18, 0x5D, 0xC3,
+    0x57, 0x9B, 0x00, 0x9B, 0xBE, 0xF5, 0xBB, 0x00, 0xDF, 0x99, 0x66, 0x34, 0xD4, 0xE7, 0xC6, 0x52,
+    0xDA, 0xD3, 0x8F, 0xBB, 0xE5, 0x2C, 0xB6, 0x4D, 0xB9, 0x9D, 0xD4, 0x74, 0x54, 0x29, 0xB5, 0xD8,
+    0x40, 0xB2, 0xAE, 0x7F, 0xE6, 0x20, 0x2A, 0x9A, 0x72, 0x13, 0x21, 0x92, 0x43, 0xB7, 0x59, 0x50,
+    0x00, 0xF0, 0xA3, 0x27, 0x00, 0xF5, 0x76, 0x04, 0xF4, 0xB3, 0x03, 0x34, 0xAF, 0x6F, 0xD1, 0x7B,
+    0x66, 0xD1, 0x8E, 0xF6, 0x67, 0x9C, 0x41, 0xC7, 0xB1, 0x49, 0x8A, 0xCE, 0x44, 0x29, 0xA3, 0x11,
+    0x55, 0x7E, 0x9E, 0xE8, 0xA4, 0xA6, 0xC8, 0x2A, 0x06, 0xB2, 0xCE, 0x3E, 0xC1, 0x4E, 0x76, 0xAE,
+    0xE8, 0x7A, 0xB9, 0x85, 0xA5, 0x8D, 0x4D, 0x06, 0x07, 0xBB, 0xA8, 0xDC, 0x30, 0x74, 0x85, 0xD2,
+    0x11, 0x55, 0x39, 0xBB, 0x43, 0x15, 0x67, 0xA0, 0xB9, 0x18, 0x80, 0xDF, 0xED, 0x00, 0x9C, 0x39,
+    0x73, 0x5F, 0x62, 0x85, 0xA0, 0xBB, 0x67, 0xF7, 0x01, 0x78, 0x56, 0x92, 0xBC, 0x9B, 0x9B, 0x62,
+    0x2A, 0x6B, 0x2E, 0x80, 0xE6, 0x3F, 0x35, 0xF9, 0x0F, 0x77, 0xD9, 0x6E, 0xE8, 0x66, 0x11, 0x86,
+    0x14, 0x5D, 0x95, 0x22, 0x6B, 0x62, 0x32, 0xEC, 0x8A, 0x01, 0x93, 0x0E, 0xA7, 0x79, 0xEB, 0x90,
+    0xB7, 0x8A, 0xE9, 0x27, 0x55, 0xBC, 0x8A, 0x2D, 0x31, 0x94, 0xD2, 0xFC, 0x4E, 0xC9, 0x6E, 0xEC,
+    0x9A, 0x52, 0x1A, 0x6A, 0x4B, 0x9C, 0x6C, 0x4B, 0xCD, 0x30, 0x01, 0x42, 0x56, 0x99, 0xFF, 0x6D,
+    0x12, 0x35, 0x54, 0x48, 0xAA, 0x47, 0xCD, 0x59, 0xE4, 0xD5, 0x94, 0x66, 0xD9, 0x28, 0x73, 0x44,
+    0xAA, 0xC1, 0x02, 0xFD, 0x54, 0x72, 0x1B, 0xE5, 0x0E, 0x66, 0x9E, 0xA1, 0x94, 0xE1, 0x76, 0x42,
+    0x16, 0xC9, 0x92, 0xCD, 0xDC, 0x4F, 0xBB, 0xF4, 0xA4, 0xBD, 0x7D, 0x88, 0x38, 0x5A, 0x91, 0x86,
+    0x16, 0x61, 0x74, 0x09, 0xD0, 0xF9, 0x1F, 0xEA, 0x05, 0xD0, 0x09, 0xD5, 0xA5, 0xED, 0x76, 0x63,
+    0x65, 0x82, 0x54, 0xE4, 0xD4, 0x47, 0x68, 0x72, 0xEC, 0x27, 0x68, 0x32, 0xF8, 0x11, 0xA7, 0x79,
+    0x6B, 0x28, 0x55, 0x12, 0xE5, 0xA5, 0x12, 0x4F, 0xA5, 0x96, 0xF9, 0xAC, 0xA4, 0xE8, 0x6F, 0x29,
+    0xF7, 0x5B, 0x5E, 0x1A, 0xB9, 0x1F, 0x64, 0xB9, 0x01, 0x58, 0x29, 0x15, 0x5C, 0xCA, 0x31, 0x96,
+    0x97, 0x92, 0xA6, 0x6F, 0x66, 0x14, 0xD3, 0xA3, 0xB4, 0x61, 0x53, 0x07, 0x7D, 0x29, 0xFA, 0x38,
+    0x61, 0x97, 0xFC, 0x2B, 0x77, 0x1C, 0x41, 0xD9, 0xEB, 0xD0, 0x7F, 0xB8, 0x4D, 0xCF, 0xBD, 0xFD,
+    0xEA, 0x3C, 0x00, 0x4F, 0x7D, 0xA2, 0xB7, 0x92, 0x9A, 0xF4, 0x0F, 0xBB, 0x65, 0x27, 0xF1, 0x22,
+    0x68, 0x33, 0x0B, 0x79, 0x8E, 0x93, 0x74, 0xF3, 0xAB, 0xF4, 0x16, 0x5F, 0xAD, 0xB7, 0xE5, 0xE2,
+    0xFF, 0x7E, 0x7B, 0x8B, 0xB3, 0xFB, 0x95, 0x6C, 0xC8, 0x0D, 0xA3, 0x97, 0x1C, 0xB3, 0x9E, 0x37,
+    0x09, 0x54, 0xE4, 0x39, 0xE6, 0x2E, 0x6D, 0x53, 0xDE, 0x4A, 0xEA, 0x29, 0x03, 0x7E, 0x43, 0xA6,
+    0x6B, 0xDE, 0x8A, 0xCE, 0xCA, 0xC0, 0xCB, 0xCC, 0xBF, 0x21, 0xA6, 0x1C, 0x99, 0x9B, 0x55, 0x2A,
+    0x0D, 0x72, 0x36, 0x11, 0xB5, 0xBF, 0x7B, 0xE8, 0xEF, 0x0E, 0x9B, 0x1C, 0xB6, 0x5E, 0x97, 0x59,
+    0x2C, 0x55, 0x05, 0xFC, 0x08, 0xF4, 0x63, 0x59, 0x18, 0xB2, 0x0E, 0x4A, 0xCF, 0xCB, 0x64, 0xB6,
+    0x11, 0x3E, 0x48, 0x19, 0xA6, 0xA1, 0xAC, 0x8F, 0xDD, 0x5D, 0x6D, 0x61, 0xE2, 0x36, 0xB7, 0x19,
+    0x8A, 0x9F, 0x25, 0x89, 0xA2, 0xDD, 0x6E, 0xB0, 0x7C, 0x80, 0x14, 0xB9, 0xDD, 0x84, 0xBD, 0x6E,
+    0x29, 0x6E, 0x45, 0x82, 0xE5, 0x04, 0x40, 0x43, 0x27, 0xE4, 0x80, 0x96, 0x49, 0x8B, 0x15, 0x63,
+    0x38, 0xDA, 0x9D, 0x14, 0xC5, 0x7C, 0x29, 0x53, 0xF6, 0xB8, 0x2C, 0xF7, 0xF6, 0x37, 0x59, 0x4A,
+    0x5E, 0xE6, 0x09, 0x59, 0xEA, 0x9D, 0xFA, 0xE8, 0x37, 0x59, 0xCA, 0x5C, 0x70, 0x6A, 0x37, 0xD6,
+    0xD2, 0xD2, 0x7F, 0x7F, 0xB2, 0x54, 0xFF, 0x49, 0xCA, 0xB2, 0x3A, 0x70, 0x72, 0x03, 0x85, 0x82,
+    0xE0, 0xC9, 0xAB, 0x94, 0x2E, 0x85, 0xE6, 0xBF, 0x2C, 0xA5, 0xB3, 0x9A, 0x72, 0xF3, 0x8D, 0x62,
+    0x48, 0xB5, 0x19, 0x72, 0xBB, 0x3C, 0x4E, 0x68, 0x57, 0xA1, 0x86, 0x31, 0x18, 0x72, 0x84, 0x4E,
+    0xD5, 0xD5, 0xBB, 0xDF, 0x07, 0x38, 0x88, 0x65, 0xB5, 0x6C, 0x56, 0x96, 0x3A, 0x79, 0x8A, 0x66,
+    0x95, 0xA6, 0xFB, 0x70, 0xE4, 0xB5, 0xFB, 0xB0, 0x95, 0x0C, 0x2C, 0x77, 0xF2, 0xAD, 0x38, 0x00,
+    0xDD, 0x82, 0x2E, 0xFF, 0x08, 0x35, 0x5D, 0x45, 0x0E, 0x30, 0x11, 0xBA, 0x98, 0x93, 0xB6, 0xE0,
+    0x98, 0x67, 0x77, 0xDC, 0x9A, 0x4D, 0x97, 0x96, 0x4A, 0x70, 0x52, 0x83, 0xAE, 0xB8, 0x5C, 0xA5,
+    0x7C, 0xC4, 0xF1, 0x9C, 0xCB, 0xAD, 0xFB, 0x25, 0x65, 0x15, 0x46, 0xCA, 0x6A, 0x56, 0x65, 0x1B,
+    0x2D, 0xFD, 0x2F, 0xD5, 0x07, 0x84, 0x3C, 0x0C, 0xE0, 0x4F, 0xA4, 0x7D, 0x3D, 0x97, 0x5A, 0xEE,
+    0x2A, 0x12, 0x7B, 0x72, 0xB0, 0xE4, 0xD3, 0xE4, 0x5A, 0xF3, 0xED, 0x6B, 0xA7, 0xFC, 0xDD, 0xCB,
+    0xED, 0x2A, 0x26, 0x93, 0x29, 0x7C, 0x4F, 0x5F, 0x8A, 0x26, 0x8B, 0xA8, 0x50, 0x51, 0x54, 0x50,
+    0x45, 0x96, 0x6A, 0x8F, 0x6B, 0xB9, 0xA3, 0xCD, 0x2C, 0x1E, 0xB8, 0x1F, 0x75, 0x42, 0x85, 0x9A,
+    0xAE, 0x8F, 0x68, 0x7F, 0x76, 0x21, 0x55, 0xBC, 0x17, 0x8C, 0xEC, 0xF4, 0xF0, 0xCC, 0xD0, 0x4C,
+    0x95, 0xE7, 0x25, 0xB4, 0x1C, 0x85, 0x35, 0x70, 0x12, 0x02, 0xFB, 0xB5, 0xAD, 0x60, 0x07, 0x4E,
+    0xD4, 0x0A, 0x2E, 0x7B, 0xAF, 0x2E, 0xAF, 0xC5, 0x5C, 0xD0, 0x1F, 0x9E, 0x5A, 0x01, 0x60, 0x91,
+    0xE3, 0xF5, 0x24, 0xAF, 0xBC, 0xF1, 0x7D, 0xB5, 0x02, 0x9A, 0x7E, 0x6E, 0x65, 0x5D, 0x4C, 0xA6,
+    0x14, 0x88, 0x11, 0xDF, 0x2D, 0x36, 0x62, 0x88, 0xA2, 0xE7, 0x6A, 0x45, 0x16, 0xB3, 0x25, 0x07,
+    0xB9, 0x9F, 0xF6, 0xAA, 0xE4, 0x5E, 0x74, 0x73, 0x47, 0x29, 0x37, 0xBA, 0x21, 0x84, 0xA5, 0x52,
+    0xCB, 0xF3, 0x72, 0x37, 0xC5, 0xA8, 0x25, 0x04, 0x11, 0x8A, 0xC1, 0x53, 0xEE, 0x3D, 0x66, 0x9F,
+    0x2F, 0xCA, 0xB6, 0x4C, 0xD6, 0x52, 0xFC, 0x18, 0xB6, 0xCC, 0xDD, 0xFF, 0xF2, 0x58, 0x67, 0xFF,
+    0x5F,
 };
 
 static const EpdGlyph notosans_16_bolditalicGlyphs[] = {
@@ -2579,7 +2620,7 @@ static const EpdGlyph notosans_16_bolditalicGlyphs[] = {
     { 4, 34, 18, 7, 26, 34, 9835 }, // |
     { 14, 30, 12, -2, 24, 105, 9869 }, // }
     { 17, 7, 19, 1, 15, 30, 9974 }, // ~
-    { 0, 0, 9, 0, 0, 0, 0 }, //  
+    { 0, 0, 9, 0, 0, 0, 10004 }, //  
     { 11, 26, 10, -2, 19, 72, 0 }, // ¡
     { 16, 26, 18, 2, 25, 104, 72 }, // ¢
     { 22, 25, 18, -1, 25, 138, 176 }, // £
@@ -2590,774 +2631,781 @@ static const EpdGlyph notosans_16_bolditalicGlyphs[] = {
     { 12, 6, 18, 6, 26, 18, 651 }, // ¨
     { 26, 26, 28, 1, 25, 169, 669 }, // ©
     { 13, 13, 13, 2, 25, 43, 838 }, // ª
-    { 18, 16, 19, 1, 17, 72, 881 }, // «
-    { 17, 10, 19, 1, 14, 43, 953 }, // ¬
-    { 10, 5, 11, 0, 11, 13, 996 }, // ­
-    { 26, 26, 28, 1, 25, 169, 1009 }, // ®
-    { 16, 4, 14, 3, 29, 16, 1178 }, // ¯
-    { 12, 13, 14, 1, 25, 39, 1194 }, // °
-    { 17, 21, 19, 1, 21, 90, 1233 }, // ±
-    { 14, 16, 13, 1, 29, 56, 1323 }, // ²
-    { 13, 16, 13, 2, 29, 52, 1379 }, // ³
-    { 10, 6, 11, 3, 26, 15, 1431 }, // ´
-    { 22, 27, 20, -2, 19, 149, 1446 }, // µ
-    { 18, 31, 22, 2, 26, 140, 1595 }, // ¶
-    { 7, 7, 10, 2, 15, 13, 1735 }, // ·
-    { 9, 8, 7, -4, 0, 18, 1748 }, // ¸
-    { 10, 16, 13, 3, 29, 40, 1766 }, // ¹
-    { 12, 12, 12, 2, 24, 36, 1806 }, // º
-    { 18, 16, 19, 0, 17, 72, 1842 }, // »
-    { 25, 26, 28, 2, 25, 163, 1914 }, // ¼
-    { 27, 26, 30, 2, 25, 176, 2077 }, // ½
-    { 27, 26, 29, 1, 25, 176, 2253 }, // ¾
-    { 14, 25, 16, -1, 19, 88, 2429 }, // ¿
-    { 21, 32, 21, -2, 32, 168, 2517 }, // À
-    { 23, 32, 21, -2, 32, 184, 2685 }, // Á
-    { 23, 32, 21, -2, 32, 184, 2869 }, // Â
-    { 24, 32, 21, -2, 32, 192, 3053 }, // Ã
-    { 22, 32, 21, -2, 32, 176, 3245 }, // Ä
-    { 21, 34, 21, -2, 34, 179, 3421 }, // Å
-    { 33, 24, 30, -2, 24, 198, 3600 }, // Æ
-    { 21, 33, 20, 1, 25, 174, 3798 }, // Ç
-    { 20, 32, 18, 0, 32, 160, 3972 }, // È
-    { 20, 32, 18, 0, 32, 160, 4132 }, // É
-    { 20, 32, 18, 0, 32, 160, 4292 }, // Ê
-    { 20, 32, 18, 0, 32, 160, 4452 }, // Ë
-    { 16, 32, 13, -1, 32, 128, 4612 }, // Ì
-    { 18, 32, 13, -1, 32, 144, 4740 }, // Í
-    { 18, 32, 13, -1, 32, 144, 4884 }, // Î
-    { 17, 32, 13, -1, 32, 136, 5028 }, // Ï
-    { 22, 24, 23, 0, 24, 132, 5164 }, // Ð
-    { 26, 32, 25, 0, 32, 208, 5296 }, // Ñ
-    { 23, 33, 24, 1, 32, 190, 5504 }, // Ò
-    { 23, 33, 24, 1, 32, 190, 5694 }, // Ó
-    { 23, 33, 24, 1, 32, 190, 5884 }, // Ô
-    { 23, 33, 24, 1, 32, 190, 6074 }, // Õ
-    { 23, 33, 24, 1, 32, 190, 6264 }, // Ö
-    { 16, 16, 19, 2, 20, 64, 6454 }, // ×
-    { 23, 28, 24, 1, 26, 161, 6518 }, // Ø
-    { 22, 33, 23, 2, 32, 182, 6679 }, // Ù
-    { 22, 33, 23, 2, 32, 182, 6861 }, // Ú
-    { 22, 33, 23, 2, 32, 182, 7043 }, // Û
-    { 22, 33, 23, 2, 32, 182, 7225 }, // Ü
-    { 19, 32, 19, 3, 32, 152, 7407 }, // Ý
-    { 20, 24, 20, 0, 24, 120, 7559 }, // Þ
-    { 27, 34, 22, -5, 26, 230, 7679 }, // ß
-    { 19, 27, 20, 1, 26, 129, 7909 }, // à
-    { 19, 27, 20, 1, 26, 129, 8038 }, // á
-    { 19, 27, 20, 1, 26, 129, 8167 }, // â
-    { 19, 27, 20, 1, 26, 129, 8296 }, // ã
-    { 19, 27, 20, 1, 26, 129, 8425 }, // ä
-    { 19, 29, 20, 1, 28, 138, 8554 }, // å
-    { 28, 20, 29, 1, 19, 140, 8692 }, // æ
-    { 16, 27, 16, 1, 19, 108, 8832 }, // ç
-    { 17, 27, 19, 1, 26, 115, 8940 }, // è
-    { 18, 27, 19, 1, 26, 122, 9055 }, // é
-    { 18, 27, 19, 1, 26, 122, 9177 }, // ê
-    { 17, 27, 19, 1, 26, 115, 9299 }, // ë
-    { 10, 26, 10, 0, 26, 65, 9414 }, // ì
-    { 14, 26, 10, 0, 26, 91, 9479 }, // í
-    { 14, 26, 10, 0, 26, 91, 9570 }, // î
-    { 13, 26, 10, 0, 26, 85, 9661 }, // ï
-    { 18, 27, 19, 1, 26, 122, 9746 }, // ð
-    { 20, 26, 20, 0, 26, 130, 9868 }, // ñ
-    { 18, 27, 20, 1, 26, 122, 9998 }, // ò
-    { 18, 27, 20, 1, 26, 122, 10120 }, // ó
-    { 18, 27, 20, 1, 26, 122, 10242 }, // ô
-    { 19, 27, 20, 1, 26, 129, 10364 }, // õ
-    { 18, 27, 20, 1, 26, 122, 10493 }, // ö
-    { 17, 17, 19, 1, 20, 73, 10615 }, // ÷
-    { 19, 22, 20, 0, 20, 105, 10688 }, // ø
-    { 19, 27, 20, 1, 26, 129, 10793 }, // ù
-    { 19, 27, 20, 1, 26, 129, 10922 }, // ú
-    { 19, 27, 20, 1, 26, 129, 11051 }, // û
-    { 19, 27, 20, 1, 26, 129, 11180 }, // ü
-    { 23, 34, 17, -3, 26, 196, 11309 }, // ý
-    { 21, 34, 20, -2, 26, 179, 11505 }, // þ
-    { 23, 34, 17, -3, 26, 196, 11684 }, // ÿ
-    { 22, 30, 21, -2, 30, 165, 0 }, // Ā
-    { 19, 25, 20, 1, 24, 119, 165 }, // ā
-    { 23, 32, 21, -2, 32, 184, 284 }, // Ă
-    { 19, 27, 20, 1, 26, 129, 468 }, // ă
-    { 21, 33, 21, -2, 24, 174, 597 }, // Ą
-    { 19, 28, 20, 1, 19, 133, 771 }, // ą
-    { 21, 33, 20, 1, 32, 174, 904 }, // Ć
-    { 17, 27, 16, 1, 26, 115, 1078 }, // ć
-    { 21, 33, 20, 1, 32, 174, 1193 }, // Ĉ
-    { 17, 27, 16, 1, 26, 115, 1367 }, // ĉ
-    { 21, 33, 20, 1, 32, 174, 1482 }, // Ċ
-    { 16, 27, 16, 1, 26, 108, 1656 }, // ċ
-    { 22, 33, 20, 1, 32, 182, 1764 }, // Č
-    { 18, 27, 16, 1, 26, 122, 1946 }, // č
-    { 23, 32, 23, 0, 32, 184, 2068 }, // Ď
-    { 27, 27, 23, 1, 26, 183, 2252 }, // ď
-    { 22, 24, 23, 0, 24, 132, 2435 }, // Đ
-    { 22, 27, 20, 1, 26, 149, 2567 }, // đ
-    { 20, 30, 18, 0, 30, 150, 2716 }, // Ē
-    { 17, 25, 19, 1, 24, 107, 2866 }, // ē
-    { 20, 32, 18, 0, 32, 160, 2973 }, // Ĕ
-    { 18, 27, 19, 1, 26, 122, 3133 }, // ĕ
-    { 20, 32, 18, 0, 32, 160, 3255 }, // Ė
-    { 17, 27, 19, 1, 26, 115, 3415 }, // ė
-    { 20, 33, 18, 0, 24, 165, 3530 }, // Ę
-    { 17, 27, 19, 1, 19, 115, 3695 }, // ę
-    { 21, 32, 18, 0, 32, 168, 3810 }, // Ě
-    { 19, 27, 19, 1, 26, 129, 3978 }, // ě
-    { 22, 33, 23, 1, 32, 182, 4107 }, // Ĝ
-    { 20, 34, 20, 0, 26, 170, 4289 }, // ĝ
-    { 22, 33, 23, 1, 32, 182, 4459 }, // Ğ
-    { 20, 34, 20, 0, 26, 170, 4641 }, // ğ
-    { 22, 33, 23, 1, 32, 182, 4811 }, // Ġ
-    { 20, 34, 20, 0, 26, 170, 4993 }, // ġ
-    { 22, 33, 23, 1, 25, 182, 5163 }, // Ģ
-    { 20, 34, 20, 0, 26, 170, 5345 }, // ģ
-    { 24, 32, 23, 0, 32, 192, 5515 }, // Ĥ
-    { 19, 33, 20, 0, 33, 157, 5707 }, // ĥ
-    { 26, 24, 23, 0, 24, 156, 5864 }, // Ħ
-    { 19, 26, 20, 0, 26, 124, 6020 }, // ħ
-    { 18, 32, 13, -1, 32, 144, 6144 }, // Ĩ
-    { 15, 26, 10, 0, 26, 98, 6288 }, // ĩ
-    { 17, 30, 13, -1, 30, 128, 6386 }, // Ī
-    { 13, 24, 10, 0, 24, 78, 6514 }, // ī
-    { 18, 32, 13, -1, 32, 144, 6592 }, // Ĭ
-    { 14, 26, 10, 0, 26, 91, 6736 }, // ĭ
-    { 16, 33, 13, -1, 24, 132, 6827 }, // Į
-    { 13, 35, 10, -2, 26, 114, 6959 }, // į
-    { 16, 32, 13, -1, 32, 128, 7073 }, // İ
-    { 10, 19, 10, 0, 19, 48, 7201 }, // ı
-    { 26, 32, 24, -1, 24, 208, 7249 }, // Ĳ
-    { 21, 34, 20, 0, 26, 179, 7457 }, // ĳ
-    { 22, 40, 11, -6, 32, 220, 7636 }, // Ĵ
-    { 19, 34, 10, -5, 26, 162, 7856 }, // ĵ
-    { 24, 32, 20, 0, 24, 192, 8018 }, // Ķ
-    { 21, 34, 19, 0, 26, 179, 8210 }, // ķ
-    { 21, 19, 19, 0, 19, 100, 8389 }, // ĸ
-    { 17, 32, 17, 0, 32, 136, 8489 }, // Ĺ
-    { 16, 33, 10, 0, 33, 132, 8625 }, // ĺ
-    { 16, 32, 17, 0, 24, 128, 8757 }, // Ļ
-    { 13, 34, 10, -2, 26, 111, 8885 }, // ļ
-    { 20, 24, 17, 0, 24, 120, 8996 }, // Ľ
-    { 18, 26, 13, 0, 26, 117, 9116 }, // ľ
-    { 17, 24, 17, 0, 24, 102, 9233 }, // Ŀ
-    { 16, 26, 15, 0, 26, 104, 9335 }, // ŀ
-    { 17, 24, 17, -1, 24, 102, 9439 }, // Ł
-    { 12, 26, 11, 0, 26, 78, 9541 }, // ł
-    { 26, 32, 25, 0, 32, 208, 9619 }, // Ń
-    { 19, 26, 20, 0, 26, 124, 9827 }, // ń
-    { 26, 32, 25, 0, 24, 208, 9951 }, // Ņ
-    { 19, 27, 20, 0, 19, 129, 10159 }, // ņ
-    { 26, 32, 25, 0, 32, 208, 10288 }, // Ň
-    { 21, 26, 20, 0, 26, 137, 10496 }, // ň
-    { 22, 24, 24, 0, 24, 132, 10633 }, // ŉ
-    { 26, 31, 25, 0, 24, 202, 10765 }, // Ŋ
-    { 19, 27, 20, 0, 19, 129, 10967 }, // ŋ
-    { 23, 31, 24, 1, 30, 179, 11096 }, // Ō
-    { 18, 25, 20, 1, 24, 113, 11275 }, // ō
-    { 23, 33, 24, 1, 32, 190, 11388 }, // Ŏ
-    { 18, 27, 20, 1, 26, 122, 11578 }, // ŏ
-    { 25, 33, 24, 1, 32, 207, 11700 }, // Ő
-    { 22, 27, 20, 1, 26, 149, 11907 }, // ő
-    { 30, 26, 30, 2, 25, 195, 12056 }, // Œ
-    { 28, 20, 29, 1, 19, 140, 12251 }, // œ
-    { 21, 32, 21, 0, 32, 168, 12391 }, // Ŕ
-    { 17, 26, 14, 0, 26, 111, 12559 }, // ŕ
-    { 20, 32, 21, 0, 24, 160, 12670 }, // Ŗ
-    { 18, 27, 14, -2, 19, 122, 12830 }, // ŗ
-    { 22, 32, 21, 0, 32, 176, 12952 }, // Ř
-    { 18, 26, 14, 0, 26, 117, 13128 }, // ř
-    { 19, 33, 18, 0, 32, 157, 13245 }, // Ś
-    { 17, 27, 16, 0, 26, 115, 13402 }, // ś
-    { 19, 33, 18, 0, 32, 157, 13517 }, // Ŝ
-    { 17, 27, 16, 0, 26, 115, 13674 }, // ŝ
-    { 19, 33, 18, 0, 25, 157, 13789 }, // Ş
-    { 16, 27, 16, 0, 19, 108, 13946 }, // ş
-    { 20, 33, 18, 0, 32, 165, 14054 }, // Š
-    { 18, 27, 16, 0, 26, 122, 14219 }, // š
-    { 19, 32, 18, 2, 24, 152, 14341 }, // Ţ
-    { 14, 31, 14, 1, 23, 109, 14493 }, // ţ
-    { 19, 32, 18, 2, 32, 152, 14602 }, // Ť
-    { 18, 27, 14, 1, 26, 122, 14754 }, // ť
-    { 19, 24, 18, 2, 24, 114, 14876 }, // Ŧ
-    { 15, 24, 14, 0, 23, 90, 14990 }, // ŧ
-    { 22, 33, 23, 2, 32, 182, 15080 }, // Ũ
-    { 19, 27, 20, 1, 26, 129, 15262 }, // ũ
-    { 22, 31, 23, 2, 30, 171, 15391 }, // Ū
-    { 19, 25, 20, 1, 24, 119, 15562 }, // ū
-    { 22, 33, 23, 2, 32, 182, 15681 }, // Ŭ
-    { 19, 27, 20, 1, 26, 129, 15863 }, // ŭ
-    { 22, 35, 23, 2, 34, 193, 15992 }, // Ů
-    { 19, 29, 20, 1, 28, 138, 16185 }, // ů
-    { 24, 33, 23, 2, 32, 198, 16323 }, // Ű
-    { 22, 27, 20, 1, 26, 149, 16521 }, // ű
-    { 22, 33, 23, 2, 24, 182, 16670 }, // Ų
-    { 19, 28, 20, 1, 19, 133, 16852 }, // ų
-    { 30, 32, 30, 3, 32, 240, 16985 }, // Ŵ
-    { 26, 26, 26, 2, 26, 169, 17225 }, // ŵ
-    { 19, 32, 19, 3, 32, 152, 17394 }, // Ŷ
-    { 23, 34, 17, -3, 26, 196, 17546 }, // ŷ
-    { 19, 32, 19, 3, 32, 152, 17742 }, // Ÿ
-    { 21, 32, 18, -1, 32, 168, 17894 }, // Ź
-    { 18, 26, 16, -1, 26, 117, 18062 }, // ź
-    { 21, 32, 18, -1, 32, 168, 18179 }, // Ż
-    { 17, 26, 16, -1, 26, 111, 18347 }, // ż
-    { 22, 32, 18, -1, 32, 176, 18458 }, // Ž
-    { 19, 26, 16, -1, 26, 124, 18634 }, // ž
-    { 20, 34, 12, -4, 26, 170, 18758 }, // ſ
-    { 8, 6, 0, -14, 26, 12, 0 }, // ̀
-    { 10, 6, 0, -8, 26, 15, 12 }, // ́
-    { 14, 6, 0, -5, 26, 21, 27 }, // ̂
-    { 15, 6, 0, -15, 26, 23, 48 }, // ̃
-    { 11, 4, 0, -3, 24, 11, 71 }, // ̄
-    { 15, 5, 0, -4, 29, 19, 82 }, // ̅
-    { 13, 6, 0, -3, 26, 20, 101 }, // ̆
-    { 6, 6, 0, 0, 26, 9, 121 }, // ̇
-    { 12, 6, 0, -3, 26, 18, 130 }, // ̈
-    { 8, 9, 0, -10, 28, 18, 148 }, // ̉
-    { 9, 8, 0, -1, 28, 18, 166 }, // ̊
-    { 16, 6, 0, -4, 26, 24, 184 }, // ̋
-    { 15, 6, 0, -4, 26, 23, 208 }, // ̌
-    { 6, 10, 0, 0, 26, 15, 231 }, // ̍
-    { 12, 7, 0, -3, 26, 21, 246 }, // ̎
-    { 14, 6, 0, -16, 26, 21, 267 }, // ̏
-    { 12, 9, 0, -3, 29, 27, 288 }, // ̐
-    { 13, 6, 0, -4, 26, 20, 315 }, // ̑
-    { 9, 9, 0, -2, 24, 21, 335 }, // ̒
-    { 9, 9, 0, -2, 24, 21, 356 }, // ̓
-    { 5, 9, 0, 0, 24, 12, 377 }, // ̔
-    { 9, 9, 0, -2, 24, 21, 389 }, // ̕
-    { 8, 6, 0, -7, -1, 12, 410 }, // ̖
-    { 10, 6, 0, -8, -1, 15, 422 }, // ̗
-    { 7, 8, 0, -6, 0, 14, 437 }, // ̘
-    { 8, 8, 0, -7, 0, 16, 451 }, // ̙
-    { 11, 10, 10, 2, 26, 28, 467 }, // ̚
-    { 10, 9, 0, -2, 26, 23, 495 }, // ̛
-    { 6, 9, 0, -2, 0, 14, 518 }, // ̜
-    { 8, 6, 0, -7, -1, 12, 532 }, // ̝
-    { 9, 6, 0, -7, -1, 14, 544 }, // ̞
-    { 8, 8, 0, -7, 0, 16, 558 }, // ̟
-    { 8, 3, 0, -7, -2, 6, 574 }, // ̠
-    { 9, 10, 0, -7, 2, 23, 580 }, // ̡
-    { 8, 10, 0, -4, 2, 20, 603 }, // ̢
-    { 7, 6, 0, -16, -2, 11, 623 }, // ̣
-    { 12, 6, 0, -9, -1, 18, 634 }, // ̤
-    { 9, 8, 0, -7, 0, 18, 652 }, // ̥
-    { 7, 6, 0, 2, -2, 11, 670 }, // ̦
-    { 9, 8, 0, -7, 0, 18, 681 }, // ̧
-    { 7, 9, 0, -6, 0, 16, 699 }, // ̨
-    { 7, 10, 0, -6, -1, 18, 715 }, // ̩
-    { 14, 7, 0, -10, -1, 25, 733 }, // ̪
-    { 13, 4, 0, -9, -2, 13, 758 }, // ̫
-    { 14, 6, 0, -9, -1, 21, 771 }, // ̬
-    { 14, 6, 0, -10, -1, 21, 792 }, // ̭
-    { 13, 6, 0, -9, -1, 20, 813 }, // ̮
-    { 13, 6, 0, -9, -1, 20, 833 }, // ̯
-    { 15, 6, 0, -10, -1, 23, 853 }, // ̰
-    { 12, 4, 0, -9, -2, 12, 876 }, // ̱
-    { 17, 3, 0, -11, -3, 13, 888 }, // ̲
-    { 16, 8, 0, -11, 0, 32, 901 }, // ̳
-    { 14, 6, 0, -7, 13, 21, 933 }, // ̴
-    { 15, 5, 0, -8, 11, 19, 954 }, // ̵
-    { 26, 5, 0, -13, 12, 33, 973 }, // ̶
-    { 12, 9, 0, -6, 14, 27, 1006 }, // ̷
-    { 20, 28, 0, -10, 26, 140, 1033 }, // ̸
-    { 6, 9, 0, -3, 0, 14, 1173 }, // ̹
-    { 14, 7, 0, -10, -1, 25, 1187 }, // ̺
-    { 14, 8, 0, -10, 0, 28, 1212 }, // ̻
-    { 13, 4, 0, -9, -2, 13, 1240 }, // ̼
-    { 8, 7, 0, -1, 26, 14, 1253 }, // ̽
-    { 8, 10, 0, -1, 29, 20, 1267 }, // ̾
-    { 15, 8, 0, -4, 33, 30, 1287 }, // ̿
-    { 8, 6, 0, -3, 26, 12, 1317 }, // ̀
-    { 10, 6, 0, 0, 26, 15, 1329 }, // ́
-    { 14, 6, 0, 5, 26, 21, 1344 }, // ͂
-    { 6, 7, 0, 0, 26, 11, 1365 }, // ̓
-    { 18, 6, 0, -5, 26, 27, 1376 }, // ̈́
-    { 7, 6, 0, -5, -2, 11, 1403 }, // ͅ
-    { 16, 7, 0, -5, 26, 28, 1414 }, // ͆
-    { 16, 8, 0, -11, 0, 32, 1442 }, // ͇
-    { 11, 7, 0, -8, -1, 20, 1474 }, // ͈
-    { 7, 6, 0, -6, -2, 11, 1494 }, // ͉
-    { 13, 8, 0, -4, 26, 26, 1505 }, // ͊
-    { 13, 14, 0, -3, 32, 46, 1531 }, // ͋
-    { 14, 9, 0, -4, 29, 32, 1577 }, // ͌
-    { 13, 7, 0, -9, -1, 23, 1609 }, // ͍
-    { 7, 8, 0, -6, 0, 14, 1632 }, // ͎
-    { 24, 24, 0, -12, 24, 144, 1646 }, // ͏
-    { 6, 8, 0, 0, 27, 12, 1790 }, // ͐
-    { 6, 9, 0, 4, 29, 14, 1802 }, // ͑
-    { 12, 9, 0, -3, 29, 27, 1816 }, // ͒
-    { 8, 7, 0, -6, -1, 14, 1843 }, // ͓
-    { 6, 7, 0, -5, -1, 11, 1857 }, // ͔
-    { 7, 7, 0, -5, -1, 13, 1868 }, // ͕
-    { 13, 7, 0, -8, -1, 23, 1881 }, // ͖
-    { 6, 9, 0, 3, 28, 14, 1904 }, // ͗
-    { 6, 6, 0, 0, 26, 9, 1918 }, // ͘
-    { 9, 7, 0, -7, -1, 16, 1927 }, // ͙
-    { 13, 8, 0, -9, 0, 26, 1943 }, // ͚
-    { 7, 8, 0, 0, 27, 14, 1969 }, // ͛
-    { 26, 7, 0, -15, -1, 46, 1983 }, // ͜
-    { 26, 7, 0, -10, 26, 46, 2029 }, // ͝
-    { 18, 4, 0, -6, 24, 18, 2075 }, // ͞
-    { 19, 4, 0, -12, -1, 19, 2093 }, // ͟
-    { 27, 6, 0, -10, 26, 41, 2112 }, // ͠
-    { 27, 7, 0, -10, 29, 48, 2153 }, // ͡
-    { 27, 8, 0, -17, 0, 54, 2201 }, // ͢
-    { 9, 9, 0, -1, 29, 21, 2255 }, // ͣ
-    { 9, 9, 0, -1, 29, 21, 2276 }, // ͤ
-    { 5, 11, 0, 1, 31, 14, 2297 }, // ͥ
-    { 8, 9, 0, -1, 29, 18, 2311 }, // ͦ
-    { 9, 8, 0, -1, 28, 18, 2329 }, // ͧ
-    { 7, 9, 0, 0, 29, 16, 2347 }, // ͨ
-    { 10, 11, 0, -1, 31, 28, 2363 }, // ͩ
-    { 9, 11, 0, -2, 31, 25, 2391 }, // ͪ
-    { 14, 9, 0, -4, 29, 32, 2416 }, // ͫ
-    { 7, 9, 0, 0, 29, 16, 2448 }, // ͬ
-    { 7, 10, 0, 0, 30, 18, 2464 }, // ͭ
-    { 8, 8, 0, 0, 28, 16, 2482 }, // ͮ
-    { 10, 8, 0, -2, 28, 20, 2498 }, // ͯ
-    { 20, 32, 18, 0, 32, 160, 0 }, // Ѐ
-    { 20, 32, 18, 0, 32, 160, 160 }, // Ё
-    { 21, 25, 24, 2, 24, 132, 320 }, // Ђ
-    { 20, 32, 17, 0, 32, 160, 452 }, // Ѓ
-    { 21, 26, 20, 1, 25, 137, 612 }, // Є
-    { 19, 26, 18, 0, 25, 124, 749 }, // Ѕ
-    { 11, 24, 10, 0, 24, 66, 873 }, // І
-    { 15, 32, 10, 0, 32, 120, 939 }, // Ї
-    { 18, 32, 11, -6, 24, 144, 1059 }, // Ј
-    { 34, 25, 32, -2, 24, 213, 1203 }, // Љ
-    { 31, 24, 31, 0, 24, 186, 1416 }, // Њ
-    { 21, 24, 24, 2, 24, 126, 1602 }, // Ћ
-    { 24, 32, 21, 0, 32, 192, 1728 }, // Ќ
-    { 24, 32, 23, 0, 32, 192, 1920 }, // Ѝ
-    { 23, 33, 20, 0, 32, 190, 2112 }, // Ў
-    { 23, 30, 22, 0, 24, 173, 2302 }, // Џ
-    { 21, 24, 21, -2, 24, 126, 2475 }, // А
-    { 20, 24, 20, 0, 24, 120, 2601 }, // Б
-    { 21, 24, 21, 0, 24, 126, 2721 }, // В
-    { 20, 24, 17, 0, 24, 120, 2847 }, // Г
-    { 27, 30, 24, -3, 24, 203, 2967 }, // Д
-    { 20, 24, 18, 0, 24, 120, 3170 }, // Е
-    { 35, 24, 30, -2, 24, 210, 3290 }, // Ж
-    { 20, 26, 19, 0, 25, 130, 3500 }, // З
-    { 24, 24, 23, 0, 24, 144, 3630 }, // И
-    { 24, 32, 23, 0, 32, 192, 3774 }, // Й
-    { 24, 24, 21, 0, 24, 144, 3966 }, // К
-    { 26, 25, 23, -2, 24, 163, 4110 }, // Л
-    { 30, 24, 29, 0, 24, 180, 4273 }, // М
-    { 24, 24, 23, 0, 24, 144, 4453 }, // Н
-    { 23, 26, 24, 1, 25, 150, 4597 }, // О
-    { 24, 24, 23, 0, 24, 144, 4747 }, // П
-    { 21, 24, 20, 0, 24, 126, 4891 }, // Р
-    { 21, 26, 20, 1, 25, 137, 5017 }, // С
-    { 19, 24, 17, 2, 24, 114, 5154 }, // Т
-    { 23, 25, 20, 0, 24, 144, 5268 }, // У
-    { 28, 26, 29, 1, 25, 182, 5412 }, // Ф
-    { 25, 24, 20, -2, 24, 150, 5594 }, // Х
-    { 23, 30, 23, 0, 24, 173, 5744 }, // Ц
-    { 21, 24, 22, 2, 24, 126, 5917 }, // Ч
-    { 34, 24, 33, 0, 24, 204, 6043 }, // Ш
-    { 33, 29, 33, 0, 24, 240, 6247 }, // Щ
-    { 21, 24, 23, 2, 24, 126, 6487 }, // Ъ
-    { 30, 24, 29, 0, 24, 180, 6613 }, // Ы
-    { 19, 24, 20, 0, 24, 114, 6793 }, // Ь
-    { 21, 26, 20, 0, 25, 137, 6907 }, // Э
-    { 33, 26, 33, 0, 25, 215, 7044 }, // Ю
-    { 24, 24, 21, -2, 24, 144, 7259 }, // Я
-    { 19, 20, 19, 0, 19, 95, 7403 }, // а
-    { 19, 27, 19, 1, 26, 129, 7498 }, // б
-    { 18, 20, 18, 0, 19, 90, 7627 }, // в
-    { 17, 20, 15, -1, 19, 85, 7717 }, // г
-    { 18, 27, 19, 1, 26, 122, 7802 }, // д
-    { 17, 20, 17, 1, 19, 85, 7924 }, // е
-    { 34, 20, 32, -1, 19, 170, 8009 }, // ж
-    { 16, 20, 17, 0, 19, 80, 8179 }, // з
-    { 19, 20, 20, 1, 19, 95, 8259 }, // и
-    { 19, 27, 20, 1, 26, 129, 8354 }, // й
-    { 21, 19, 19, 0, 19, 100, 8483 }, // к
-    { 21, 20, 20, -1, 19, 105, 8583 }, // л
-    { 26, 19, 26, 0, 19, 124, 8688 }, // м
-    { 20, 19, 20, 0, 19, 95, 8812 }, // н
-    { 19, 20, 19, 0, 19, 95, 8907 }, // о
-    { 19, 19, 20, 0, 19, 91, 9002 }, // п
-    { 21, 27, 20, -2, 19, 142, 9093 }, // р
-    { 16, 20, 16, 0, 19, 80, 9235 }, // с
-    { 29, 19, 30, 0, 19, 138, 9315 }, // т
-    { 23, 27, 18, -3, 19, 156, 9453 }, // у
-    { 23, 34, 25, 1, 26, 196, 9609 }, // ф
-    { 22, 19, 17, -2, 19, 105, 9805 }, // х
-    { 19, 24, 20, 1, 19, 114, 9910 }, // ц
-    { 17, 19, 19, 2, 19, 81, 10024 }, // ч
-    { 29, 20, 30, 1, 19, 145, 10105 }, // ш
-    { 29, 24, 30, 1, 19, 174, 10250 }, // щ
-    { 19, 20, 21, 1, 19, 95, 10424 }, // ъ
-    { 26, 20, 27, 1, 19, 130, 10519 }, // ы
-    { 17, 20, 18, 1, 19, 85, 10649 }, // ь
-    { 15, 20, 16, 0, 19, 75, 10734 }, // э
-    { 27, 20, 27, 0, 19, 135, 10809 }, // ю
-    { 20, 19, 18, -2, 19, 95, 10944 }, // я
-    { 17, 27, 17, 1, 26, 115, 11039 }, // ѐ
-    { 17, 26, 17, 1, 25, 111, 11154 }, // ё
-    { 19, 34, 20, 0, 26, 162, 11265 }, // ђ
-    { 18, 27, 15, -1, 26, 122, 11427 }, // ѓ
-    { 16, 20, 16, 0, 19, 80, 11549 }, // є
-    { 15, 20, 15, 0, 19, 75, 11629 }, // ѕ
-    { 11, 26, 10, 0, 26, 72, 11704 }, // і
-    { 13, 26, 10, 0, 26, 85, 11776 }, // ї
-    { 16, 34, 10, -5, 26, 136, 11861 }, // ј
-    { 29, 20, 29, -1, 19, 145, 11997 }, // љ
-    { 27, 20, 28, 0, 19, 135, 12142 }, // њ
-    { 19, 26, 20, 0, 26, 124, 12277 }, // ћ
-    { 21, 26, 19, 0, 26, 137, 12401 }, // ќ
-    { 19, 27, 20, 1, 26, 129, 12538 }, // ѝ
-    { 23, 34, 18, -3, 26, 196, 12667 }, // ў
-    { 19, 26, 20, 1, 19, 124, 12863 }, // џ
-    { 31, 24, 30, 2, 24, 186, 12987 }, // Ѡ
-    { 27, 19, 27, 2, 19, 129, 13173 }, // ѡ
-    { 18, 24, 21, 2, 24, 108, 13302 }, // Ѣ
-    { 27, 20, 28, 0, 19, 135, 13410 }, // ѣ
-    { 31, 26, 30, 0, 25, 202, 13545 }, // Ѥ
-    { 26, 20, 25, 0, 19, 130, 13747 }, // ѥ
-    { 23, 24, 22, -2, 24, 138, 13877 }, // Ѧ
-    { 21, 19, 19, -3, 19, 100, 14015 }, // ѧ
-    { 29, 24, 31, 0, 24, 174, 14115 }, // Ѩ
-    { 27, 19, 28, 0, 19, 129, 14289 }, // ѩ
-    { 27, 24, 24, -2, 24, 162, 14418 }, // Ѫ
-    { 22, 19, 19, -2, 19, 105, 14580 }, // ѫ
-    { 34, 24, 33, 0, 24, 204, 14685 }, // Ѭ
-    { 29, 19, 28, 0, 19, 138, 14889 }, // ѭ
-    { 22, 37, 20, -2, 29, 204, 15027 }, // Ѯ
-    { 20, 31, 17, -2, 23, 155, 15231 }, // ѯ
-    { 27, 24, 28, 3, 24, 162, 15386 }, // Ѱ
-    { 25, 34, 27, 1, 26, 213, 15548 }, // ѱ
-    { 23, 26, 24, 1, 25, 150, 15761 }, // Ѳ
-    { 18, 20, 20, 1, 19, 90, 15911 }, // ѳ
-    { 21, 24, 22, 3, 24, 126, 16001 }, // Ѵ
-    { 19, 19, 18, 1, 19, 91, 16127 }, // ѵ
-    { 21, 32, 22, 3, 32, 168, 16218 }, // Ѷ
-    { 19, 26, 18, 1, 26, 124, 16386 }, // ѷ
-    { 43, 33, 42, 1, 25, 355, 16510 }, // Ѹ
-    { 38, 27, 37, 1, 19, 257, 16865 }, // ѹ
-    { 23, 29, 25, 2, 26, 167, 17122 }, // Ѻ
-    { 19, 22, 21, 1, 20, 105, 17289 }, // ѻ
-    { 31, 36, 34, 2, 35, 279, 17394 }, // Ѽ
-    { 27, 31, 29, 1, 30, 210, 17673 }, // ѽ
-    { 31, 31, 30, 2, 31, 241, 17883 }, // Ѿ
-    { 27, 25, 27, 2, 25, 169, 18124 }, // ѿ
-    { 21, 33, 20, 1, 25, 174, 18293 }, // Ҁ
-    { 16, 27, 16, 1, 19, 108, 18467 }, // ҁ
-    { 18, 22, 20, 1, 21, 99, 18575 }, // ҂
-    { 13, 7, 0, -13, 25, 23, 18674 }, // ҃
-    { 14, 6, 0, -14, 26, 21, 18697 }, // ҄
-    { 6, 8, 0, -9, 27, 12, 18718 }, // ҅
-    { 7, 8, 0, -10, 27, 14, 18730 }, // ҆
-    { 14, 6, 0, -3, 31, 21, 18744 }, // ҇
-    { 38, 36, 0, -19, 27, 342, 18765 }, // ҈
-    { 38, 38, 0, -19, 28, 361, 19107 }, // ҉
-    { 27, 39, 27, 0, 32, 264, 19468 }, // Ҋ
-    { 20, 34, 21, 1, 27, 170, 19732 }, // ҋ
-    { 18, 24, 20, 0, 24, 108, 19902 }, // Ҍ
-    { 17, 27, 19, 1, 26, 115, 20010 }, // ҍ
-    { 21, 24, 20, 0, 24, 126, 20125 }, // Ҏ
-    { 21, 27, 20, -2, 19, 142, 20251 }, // ҏ
-    { 21, 29, 17, 0, 29, 153, 20393 }, // Ґ
-    { 18, 24, 15, 0, 24, 108, 20546 }, // ґ
-    { 20, 24, 17, 0, 24, 120, 20654 }, // Ғ
-    { 18, 19, 15, -1, 19, 86, 20774 }, // ғ
-    { 20, 33, 22, 0, 24, 165, 20860 }, // Ҕ
-    { 17, 28, 19, 0, 19, 119, 21025 }, // ҕ
-    { 35, 31, 31, -3, 24, 272, 21144 }, // Җ
-    { 34, 26, 32, -1, 19, 221, 21416 }, // җ
-    { 20, 34, 19, 0, 25, 170, 21637 }, // Ҙ
-    { 16, 28, 17, 0, 19, 112, 21807 }, // ҙ
-    { 23, 31, 23, 0, 24, 179, 21919 }, // Қ
-    { 21, 26, 20, 0, 19, 137, 22098 }, // қ
-    { 24, 24, 21, 0, 24, 144, 22235 }, // Ҝ
-    { 21, 19, 20, 1, 19, 100, 22379 }, // ҝ
-    { 24, 24, 20, 0, 24, 144, 22479 }, // Ҟ
-    { 21, 26, 19, 0, 26, 137, 22623 }, // ҟ
-    { 25, 24, 23, 2, 24, 150, 22760 }, // Ҡ
-    { 23, 19, 22, 1, 19, 110, 22910 }, // ҡ
-    { 24, 31, 26, 0, 24, 186, 23020 }, // Ң
-    { 21, 26, 22, 0, 19, 137, 23206 }, // ң
-    { 29, 24, 26, 0, 24, 174, 23343 }, // Ҥ
-    { 26, 19, 24, 0, 19, 124, 23517 }, // ҥ
-    { 32, 33, 34, 0, 24, 264, 23641 }, // Ҧ
-    { 27, 28, 29, 0, 19, 189, 23905 }, // ҧ
-    { 21, 27, 24, 2, 25, 142, 24094 }, // Ҩ
-    { 18, 21, 20, 1, 19, 95, 24236 }, // ҩ
-    { 21, 34, 20, 1, 25, 179, 24331 }, // Ҫ
-    { 16, 28, 16, 1, 19, 112, 24510 }, // ҫ
-    { 19, 31, 18, 2, 24, 148, 24622 }, // Ҭ
-    { 30, 26, 31, 0, 19, 195, 24770 }, // ҭ
-    { 19, 24, 19, 3, 24, 114, 24965 }, // Ү
-    { 18, 27, 17, 1, 19, 122, 25079 }, // ү
-    { 21, 24, 19, 1, 24, 126, 25201 }, // Ұ
-    { 20, 27, 17, -1, 19, 135, 25327 }, // ұ
-    { 25, 31, 23, -2, 24, 194, 25462 }, // Ҳ
-    { 22, 26, 20, -2, 19, 143, 25656 }, // ҳ
-    { 25, 31, 28, 2, 24, 194, 25799 }, // Ҵ
-    { 21, 26, 23, 1, 19, 137, 25993 }, // ҵ
-    { 21, 31, 25, 3, 24, 163, 26130 }, // Ҷ
-    { 18, 26, 21, 2, 19, 117, 26293 }, // ҷ
-    { 20, 24, 23, 3, 24, 120, 26410 }, // Ҹ
-    { 18, 19, 20, 2, 19, 86, 26530 }, // ҹ
-    { 21, 24, 23, 0, 24, 126, 26616 }, // Һ
-    { 19, 26, 20, 0, 26, 124, 26742 }, // һ
-    { 25, 26, 26, 1, 25, 163, 26866 }, // Ҽ
-    { 22, 20, 22, 0, 19, 110, 27029 }, // ҽ
-    { 25, 32, 26, 1, 25, 200, 27139 }, // Ҿ
-    { 22, 26, 22, 0, 19, 143, 27339 }, // ҿ
-    { 16, 24, 13, -1, 24, 96, 27482 }, // Ӏ
-    { 35, 32, 30, -2, 32, 280, 27578 }, // Ӂ
-    { 34, 27, 32, -1, 26, 230, 27858 }, // ӂ
-    { 23, 33, 23, 0, 24, 190, 28088 }, // Ӄ
-    { 21, 28, 21, 0, 19, 147, 28278 }, // ӄ
-    { 26, 31, 25, -1, 24, 202, 28425 }, // Ӆ
-    { 22, 26, 22, -1, 19, 143, 28627 }, // ӆ
-    { 24, 33, 23, 0, 24, 198, 28770 }, // Ӈ
-    { 20, 28, 21, 0, 19, 140, 28968 }, // ӈ
-    { 25, 31, 26, 0, 24, 194, 29108 }, // Ӊ
-    { 22, 26, 23, 0, 19, 143, 29302 }, // ӊ
-    { 20, 31, 22, 3, 24, 155, 29445 }, // Ӌ
-    { 18, 26, 20, 2, 19, 117, 29600 }, // ӌ
-    { 31, 31, 32, 0, 24, 241, 29717 }, // Ӎ
-    { 27, 26, 28, 0, 19, 176, 29958 }, // ӎ
-    { 16, 24, 13, -1, 24, 96, 30134 }, // ӏ
-    { 24, 32, 21, -2, 32, 192, 30230 }, // Ӑ
-    { 19, 27, 20, 1, 26, 129, 30422 }, // ӑ
-    { 22, 32, 21, -2, 32, 176, 30551 }, // Ӓ
-    { 19, 27, 20, 1, 26, 129, 30727 }, // ӓ
-    { 33, 24, 30, -2, 24, 198, 30856 }, // Ӕ
-    { 28, 20, 29, 1, 19, 140, 31054 }, // ӕ
-    { 21, 32, 18, 0, 32, 168, 31194 }, // Ӗ
-    { 19, 27, 19, 1, 26, 129, 31362 }, // ӗ
-    { 20, 26, 22, 1, 25, 130, 31491 }, // Ә
-    { 18, 20, 19, 0, 19, 90, 31621 }, // ә
-    { 20, 33, 22, 1, 32, 165, 31711 }, // Ӛ
-    { 18, 27, 19, 0, 26, 122, 31876 }, // ӛ
-    { 35, 32, 30, -2, 32, 280, 31998 }, // Ӝ
-    { 34, 27, 32, -1, 26, 230, 32278 }, // ӝ
-    { 20, 33, 19, 0, 32, 165, 32508 }, // Ӟ
-    { 17, 27, 17, 0, 26, 115, 32673 }, // ӟ
-    { 20, 25, 19, -1, 24, 125, 32788 }, // Ӡ
-    { 20, 28, 18, -2, 19, 140, 32913 }, // ӡ
-    { 24, 30, 23, 0, 30, 180, 33053 }, // Ӣ
-    { 19, 25, 20, 1, 24, 119, 33233 }, // ӣ
-    { 24, 32, 23, 0, 32, 192, 33352 }, // Ӥ
-    { 19, 27, 20, 1, 26, 129, 33544 }, // ӥ
-    { 23, 33, 24, 1, 32, 190, 33673 }, // Ӧ
-    { 18, 27, 20, 1, 26, 122, 33863 }, // ӧ
-    { 23, 26, 24, 1, 25, 150, 33985 }, // Ө
-    { 18, 20, 20, 1, 19, 90, 34135 }, // ө
-    { 23, 33, 24, 1, 32, 190, 34225 }, // Ӫ
-    { 18, 27, 20, 1, 26, 122, 34415 }, // ӫ
-    { 21, 33, 20, 0, 32, 174, 34537 }, // Ӭ
-    { 16, 27, 16, 0, 26, 108, 34711 }, // ӭ
-    { 23, 31, 20, 0, 30, 179, 34819 }, // Ӯ
-    { 23, 32, 17, -3, 24, 184, 34998 }, // ӯ
-    { 23, 33, 20, 0, 32, 190, 35182 }, // Ӱ
-    { 23, 34, 17, -3, 26, 196, 35372 }, // ӱ
-    { 24, 33, 20, 0, 32, 198, 35568 }, // Ӳ
-    { 24, 34, 17, -3, 26, 204, 35766 }, // ӳ
-    { 21, 32, 22, 2, 32, 168, 35970 }, // Ӵ
-    { 17, 26, 19, 2, 26, 111, 36138 }, // ӵ
-    { 20, 31, 17, 0, 24, 155, 36249 }, // Ӷ
-    { 17, 26, 15, 0, 19, 111, 36404 }, // ӷ
-    { 30, 32, 29, 0, 32, 240, 36515 }, // Ӹ
-    { 26, 27, 27, 1, 26, 176, 36755 }, // ӹ
-    { 20, 33, 17, 0, 24, 165, 36931 }, // Ӻ
-    { 18, 28, 15, -1, 19, 126, 37096 }, // ӻ
-    { 25, 33, 23, -2, 24, 207, 37222 }, // Ӽ
-    { 22, 28, 20, -2, 19, 154, 37429 }, // ӽ
-    { 25, 24, 20, -2, 24, 150, 37583 }, // Ӿ
-    { 22, 19, 18, -2, 19, 105, 37733 }, // ӿ
-    { 0, 0, 17, 0, 0, 0, 0 }, //  
-    { 0, 0, 33, 0, 0, 0, 0 }, //  
-    { 0, 0, 17, 0, 0, 0, 0 }, //  
-    { 0, 0, 33, 0, 0, 0, 0 }, //  
-    { 0, 0, 11, 0, 0, 0, 0 }, //  
-    { 0, 0, 8, 0, 0, 0, 0 }, //  
-    { 0, 0, 6, 0, 0, 0, 0 }, //  
-    { 0, 0, 18, 0, 0, 0, 0 }, //  
-    { 0, 0, 10, 0, 0, 0, 0 }, //  
-    { 0, 0, 6, 0, 0, 0, 0 }, //  
-    { 0, 0, 3, 0, 0, 0, 0 }, //  
-    { 0, 0, 0, 0, 0, 0, 0 }, // ​
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‍
-    { 9, 28, 0, -1, 23, 63, 0 }, // ‎
-    { 9, 28, 0, -8, 23, 63, 63 }, // ‏
-    { 10, 5, 11, 0, 11, 13, 126 }, // ‐
-    { 10, 5, 11, 0, 11, 13, 139 }, // ‑
-    { 17, 5, 18, 1, 14, 22, 152 }, // ‒
-    { 16, 4, 16, 0, 11, 16, 174 }, // –
-    { 32, 4, 32, 0, 11, 32, 190 }, // —
-    { 32, 4, 32, 0, 11, 32, 222 }, // ―
-    { 13, 34, 18, 3, 26, 111, 254 }, // ‖
-    { 16, 8, 13, -4, 0, 32, 365 }, // ‗
-    { 9, 9, 7, 1, 24, 21, 397 }, // ‘
-    { 9, 9, 7, 1, 24, 21, 418 }, // ’
-    { 9, 9, 9, -2, 4, 21, 439 }, // ‚
-    { 6, 9, 7, 3, 24, 14, 460 }, // ‛
-    { 17, 9, 14, 1, 24, 39, 474 }, // “
-    { 16, 9, 14, 1, 24, 36, 513 }, // ”
-    { 16, 9, 17, -2, 4, 36, 549 }, // „
-    { 13, 9, 14, 3, 24, 30, 585 }, // ‟
-    { 15, 26, 17, 3, 26, 98, 615 }, // †
-    { 17, 26, 17, 1, 26, 111, 713 }, // ‡
-    { 10, 11, 13, 2, 18, 28, 824 }, // •
-    { 11, 13, 12, 1, 19, 36, 852 }, // ‣
-    { 7, 7, 17, 3, 6, 13, 888 }, // ․
-    { 16, 7, 19, 0, 6, 28, 901 }, // ‥
-    { 25, 7, 28, 0, 6, 44, 929 }, // …
-    { 7, 7, 11, 2, 13, 13, 973 }, // ‧
-    { 0, 0, 20, 0, 0, 0, 986 }, //  
-    { 0, 0, 20, 0, 0, 0, 986 }, //  
-    { 9, 26, 0, -1, 21, 59, 986 }, // ‪
-    { 9, 26, 0, -8, 21, 59, 1045 }, // ‫
-    { 8, 28, 0, -4, 23, 56, 1104 }, // ‬
-    { 8, 28, 0, -4, 23, 56, 1160 }, // ‭
-    { 8, 28, 0, -4, 23, 56, 1216 }, // ‮
-    { 0, 0, 6, 0, 0, 0, 1272 }, //  
-    { 39, 26, 41, 1, 25, 254, 1272 }, // ‰
-    { 51, 26, 53, 1, 25, 332, 1526 }, // ‱
-    { 10, 9, 9, 2, 24, 23, 1858 }, // ′
-    { 18, 9, 17, 2, 24, 41, 1881 }, // ″
-    { 25, 9, 25, 2, 24, 57, 1922 }, // ‴
-    { 9, 9, 9, 2, 24, 21, 1979 }, // ‵
-    { 17, 9, 17, 2, 24, 39, 2000 }, // ‶
-    { 24, 9, 25, 2, 24, 54, 2039 }, // ‷
-    { 12, 11, 12, -3, 3, 33, 2093 }, // ‸
-    { 10, 16, 11, 1, 17, 40, 2126 }, // ‹
-    { 10, 16, 11, 0, 17, 40, 2166 }, // ›
-    { 27, 26, 28, 1, 25, 176, 2206 }, // ※
-    { 20, 25, 19, 0, 24, 125, 2382 }, // ‼
-    { 15, 26, 15, 2, 25, 98, 2507 }, // ‽
-    { 16, 4, 14, 3, 29, 16, 2605 }, // ‾
-    { 17, 8, 18, -2, 0, 34, 2621 }, // ‿
-    { 18, 8, 18, 2, 27, 36, 2655 }, // ⁀
-    { 17, 22, 13, -3, 14, 94, 2691 }, // ⁁
-    { 38, 31, 38, -1, 26, 295, 2785 }, // ⁂
-    { 10, 5, 11, 0, 11, 13, 3080 }, // ⁃
-    { 22, 24, 4, -9, 24, 132, 3093 }, // ⁄
-    { 15, 30, 11, -1, 24, 113, 3225 }, // ⁅
-    { 15, 30, 11, -3, 24, 113, 3338 }, // ⁆
-    { 30, 26, 30, 2, 25, 195, 3451 }, // ⁇
-    { 25, 26, 25, 2, 25, 163, 3646 }, // ⁈
-    { 26, 26, 25, 0, 25, 169, 3809 }, // ⁉
-    { 17, 19, 18, 2, 19, 81, 3978 }, // ⁊
-    { 18, 31, 21, 3, 26, 140, 4059 }, // ⁋
-    { 18, 18, 21, 1, 19, 81, 4199 }, // ⁌
-    { 18, 18, 21, 2, 19, 81, 4280 }, // ⁍
-    { 17, 17, 18, -1, 9, 73, 4361 }, // ⁎
-    { 9, 24, 10, 1, 19, 54, 4434 }, // ⁏
-    { 22, 35, 18, -2, 27, 193, 4488 }, // ⁐
-    { 20, 34, 18, -1, 26, 170, 4681 }, // ⁑
-    { 14, 26, 14, 0, 25, 91, 4851 }, // ⁒
-    { 32, 7, 33, 1, 13, 56, 4942 }, // ⁓
-    { 17, 8, 18, -3, 0, 34, 4998 }, // ⁔
-    { 19, 19, 19, 0, 18, 91, 5032 }, // ⁕
-    { 16, 26, 19, 1, 25, 104, 5123 }, // ⁖
-    { 30, 9, 29, 2, 24, 68, 5227 }, // ⁗
-    { 26, 26, 28, 1, 25, 169, 5295 }, // ⁘
-    { 26, 26, 28, 1, 25, 169, 5464 }, // ⁙
-    { 7, 26, 9, 1, 25, 46, 5633 }, // ⁚
-    { 22, 27, 24, 1, 26, 149, 5679 }, // ⁛
-    { 27, 27, 28, 0, 25, 183, 5828 }, // ⁜
-    { 7, 27, 9, 1, 26, 48, 6011 }, // ⁝
-    { 6, 26, 10, 2, 25, 39, 6059 }, // ⁞
-    { 0, 0, 7, 0, 0, 0, 6098 }, //  
-    { 0, 0, 20, 0, 0, 0, 6098 }, // ⁠
-    { 0, 0, 20, 0, 0, 0, 6098 }, // ⁡
-    { 0, 0, 20, 0, 0, 0, 6098 }, // ⁢
-    { 0, 0, 20, 0, 0, 0, 6098 }, // ⁣
-    { 0, 0, 20, 0, 0, 0, 6098 }, // ⁤
-    { 0, 0, 20, 0, 0, 0, 6098 }, // ⁦
-    { 0, 0, 20, 0, 0, 0, 6098 }, // ⁧
-    { 0, 0, 20, 0, 0, 0, 6098 }, // ⁨
-    { 0, 0, 20, 0, 0, 0, 6098 }, // ⁩
-    { 8, 28, 0, -4, 23, 56, 6098 }, // ⁪
-    { 8, 28, 0, -4, 23, 56, 6154 }, // ⁫
-    { 8, 28, 0, -4, 23, 56, 6210 }, // ⁬
-    { 8, 29, 0, -4, 24, 58, 6266 }, // ⁭
-    { 8, 28, 0, -4, 23, 56, 6324 }, // ⁮
-    { 8, 28, 0, -4, 23, 56, 6380 }, // ⁯
-    { 12, 16, 13, 3, 29, 48, 0 }, // ⁰
-    { 7, 16, 8, 2, 25, 28, 48 }, // ⁱ
-    { 14, 16, 13, 1, 29, 56, 76 }, // ⁴
-    { 13, 16, 13, 2, 29, 52, 132 }, // ⁵
-    { 12, 16, 13, 3, 29, 48, 184 }, // ⁶
-    { 13, 16, 13, 3, 29, 52, 232 }, // ⁷
-    { 13, 16, 13, 2, 29, 52, 284 }, // ⁸
-    { 12, 16, 13, 3, 29, 48, 336 }, // ⁹
-    { 11, 10, 13, 3, 25, 28, 384 }, // ⁺
-    { 11, 3, 13, 3, 21, 9, 412 }, // ⁻
-    { 10, 8, 13, 4, 24, 20, 421 }, // ⁼
-    { 8, 19, 7, 4, 30, 38, 441 }, // ⁽
-    { 9, 19, 7, 0, 30, 43, 479 }, // ⁾
-    { 12, 12, 13, 2, 21, 36, 522 }, // ⁿ
-    { 12, 16, 13, -1, 11, 48, 558 }, // ₀
-    { 11, 16, 13, -1, 11, 44, 606 }, // ₁
-    { 13, 16, 13, -2, 11, 52, 650 }, // ₂
-    { 13, 16, 13, -2, 11, 52, 702 }, // ₃
-    { 13, 16, 13, -2, 11, 52, 754 }, // ₄
-    { 13, 16, 13, -2, 11, 52, 806 }, // ₅
-    { 13, 16, 13, -1, 11, 52, 858 }, // ₆
-    { 13, 16, 13, -1, 11, 52, 910 }, // ₇
-    { 13, 16, 13, -2, 11, 52, 962 }, // ₈
-    { 12, 16, 13, -1, 11, 48, 1014 }, // ₉
-    { 10, 10, 13, 0, 8, 25, 1062 }, // ₊
-    { 10, 3, 13, 0, 4, 8, 1087 }, // ₋
-    { 11, 8, 13, 0, 6, 22, 1095 }, // ₌
-    { 9, 19, 7, 0, 13, 43, 1117 }, // ₍
-    { 9, 19, 7, -4, 13, 43, 1160 }, // ₎
-    { 12, 12, 13, -1, 8, 36, 1203 }, // ₐ
-    { 11, 12, 12, -1, 8, 33, 1239 }, // ₑ
-    { 11, 12, 13, -1, 8, 33, 1272 }, // ₒ
-    { 14, 12, 12, -3, 8, 42, 1305 }, // ₓ
-    { 12, 12, 12, -2, 8, 36, 1347 }, // ₔ
-    { 13, 16, 15, -1, 12, 52, 1383 }, // ₕ
-    { 14, 16, 13, -1, 12, 56, 1435 }, // ₖ
-    { 8, 16, 8, -1, 12, 32, 1491 }, // ₗ
-    { 19, 12, 21, -1, 8, 57, 1523 }, // ₘ
-    { 13, 12, 13, -2, 8, 39, 1580 }, // ₙ
-    { 14, 16, 13, -3, 8, 56, 1619 }, // ₚ
-    { 10, 12, 11, -1, 8, 30, 1675 }, // ₛ
-    { 9, 15, 9, -1, 11, 34, 1705 }, // ₜ
-    { 19, 25, 19, 1, 25, 119, 0 }, // ₠
-    { 20, 28, 18, 1, 26, 140, 119 }, // ₡
-    { 20, 26, 19, 1, 25, 130, 259 }, // ₢
-    { 20, 24, 18, 0, 24, 120, 389 }, // ₣
-    { 22, 25, 18, -1, 25, 138, 509 }, // ₤
-    { 29, 27, 30, 0, 23, 196, 647 }, // ₥
-    { 21, 24, 19, 0, 24, 126, 843 }, // ₦
-    { 29, 25, 29, 0, 24, 182, 969 }, // ₧
-    { 31, 25, 30, 0, 24, 194, 1151 }, // ₨
-    { 27, 24, 24, 0, 24, 162, 1345 }, // ₩
-    { 28, 24, 29, 1, 24, 168, 1507 }, // ₪
-    { 23, 32, 20, 0, 26, 184, 1675 }, // ₫
-    { 21, 26, 18, 0, 25, 137, 1859 }, // €
-    { 23, 24, 19, 0, 24, 138, 1996 }, // ₭
-    { 20, 24, 18, 1, 24, 120, 2134 }, // ₮
-    { 33, 33, 34, 0, 25, 273, 2254 }, // ₯
-    { 22, 33, 20, -2, 25, 182, 2527 }, // ₰
-    { 21, 24, 19, 0, 24, 126, 2709 }, // ₱
-    { 22, 29, 23, 1, 26, 160, 2835 }, // ₲
-    { 23, 24, 20, -2, 24, 138, 2995 }, // ₳
-    { 20, 26, 19, 0, 25, 130, 3133 }, // ₴
-    { 20, 29, 20, 2, 26, 145, 3263 }, // ₵
-    { 24, 24, 23, 0, 23, 144, 3408 }, // ₶
-    { 25, 28, 23, -1, 25, 175, 3552 }, // ₷
-    { 19, 24, 18, 1, 24, 114, 3727 }, // ₸
-    { 18, 24, 18, 2, 24, 108, 3841 }, // ₹
-    { 19, 25, 18, 0, 24, 119, 3949 }, // ₺
-    { 21, 26, 21, 2, 25, 137, 4068 }, // ₻
-    { 27, 24, 27, -1, 24, 162, 4205 }, // ₼
-    { 21, 24, 19, -1, 24, 126, 4367 }, // ₽
-    { 23, 28, 20, -1, 28, 161, 4493 }, // ₾
-    { 19, 32, 18, 0, 28, 152, 4654 }, // ₿
-    { 10, 5, 11, 0, 11, 13, 0 }, // −
-    { 31, 32, 33, 1, 26, 248, 0 }, // �
+    { 18, 16, 19, 1, 17, 72, 10004 }, // «
+    { 17, 10, 19, 1, 14, 43, 881 }, // ¬
+    { 10, 5, 11, 0, 11, 13, 924 }, // ­
+    { 26, 26, 28, 1, 25, 169, 937 }, // ®
+    { 16, 4, 14, 3, 29, 16, 1106 }, // ¯
+    { 12, 13, 14, 1, 25, 39, 1122 }, // °
+    { 17, 21, 19, 1, 21, 90, 1161 }, // ±
+    { 14, 16, 13, 1, 29, 56, 1251 }, // ²
+    { 13, 16, 13, 2, 29, 52, 1307 }, // ³
+    { 10, 6, 11, 3, 26, 15, 1359 }, // ´
+    { 22, 27, 20, -2, 19, 149, 1374 }, // µ
+    { 18, 31, 22, 2, 26, 140, 1523 }, // ¶
+    { 7, 7, 10, 2, 15, 13, 1663 }, // ·
+    { 9, 8, 7, -4, 0, 18, 1676 }, // ¸
+    { 10, 16, 13, 3, 29, 40, 1694 }, // ¹
+    { 12, 12, 12, 2, 24, 36, 1734 }, // º
+    { 18, 16, 19, 0, 17, 72, 10076 }, // »
+    { 25, 26, 28, 2, 25, 163, 1770 }, // ¼
+    { 27, 26, 30, 2, 25, 176, 1933 }, // ½
+    { 27, 26, 29, 1, 25, 176, 2109 }, // ¾
+    { 14, 25, 16, -1, 19, 88, 2285 }, // ¿
+    { 21, 32, 21, -2, 32, 168, 10148 }, // À
+    { 23, 32, 21, -2, 32, 184, 10316 }, // Á
+    { 23, 32, 21, -2, 32, 184, 10500 }, // Â
+    { 24, 32, 21, -2, 32, 192, 2373 }, // Ã
+    { 22, 32, 21, -2, 32, 176, 10684 }, // Ä
+    { 21, 34, 21, -2, 34, 179, 2565 }, // Å
+    { 33, 24, 30, -2, 24, 198, 2744 }, // Æ
+    { 21, 33, 20, 1, 25, 174, 10860 }, // Ç
+    { 20, 32, 18, 0, 32, 160, 11034 }, // È
+    { 20, 32, 18, 0, 32, 160, 11194 }, // É
+    { 20, 32, 18, 0, 32, 160, 11354 }, // Ê
+    { 20, 32, 18, 0, 32, 160, 11514 }, // Ë
+    { 16, 32, 13, -1, 32, 128, 11674 }, // Ì
+    { 18, 32, 13, -1, 32, 144, 11802 }, // Í
+    { 18, 32, 13, -1, 32, 144, 11946 }, // Î
+    { 17, 32, 13, -1, 32, 136, 12090 }, // Ï
+    { 22, 24, 23, 0, 24, 132, 2942 }, // Ð
+    { 26, 32, 25, 0, 32, 208, 12226 }, // Ñ
+    { 23, 33, 24, 1, 32, 190, 12434 }, // Ò
+    { 23, 33, 24, 1, 32, 190, 12624 }, // Ó
+    { 23, 33, 24, 1, 32, 190, 12814 }, // Ô
+    { 23, 33, 24, 1, 32, 190, 3074 }, // Õ
+    { 23, 33, 24, 1, 32, 190, 13004 }, // Ö
+    { 16, 16, 19, 2, 20, 64, 3264 }, // ×
+    { 23, 28, 24, 1, 26, 161, 3328 }, // Ø
+    { 22, 33, 23, 2, 32, 182, 13194 }, // Ù
+    { 22, 33, 23, 2, 32, 182, 13376 }, // Ú
+    { 22, 33, 23, 2, 32, 182, 13558 }, // Û
+    { 22, 33, 23, 2, 32, 182, 13740 }, // Ü
+    { 19, 32, 19, 3, 32, 152, 3489 }, // Ý
+    { 20, 24, 20, 0, 24, 120, 3641 }, // Þ
+    { 27, 34, 22, -5, 26, 230, 3761 }, // ß
+    { 19, 27, 20, 1, 26, 129, 13922 }, // à
+    { 19, 27, 20, 1, 26, 129, 14051 }, // á
+    { 19, 27, 20, 1, 26, 129, 14180 }, // â
+    { 19, 27, 20, 1, 26, 129, 3991 }, // ã
+    { 19, 27, 20, 1, 26, 129, 14309 }, // ä
+    { 19, 29, 20, 1, 28, 138, 4120 }, // å
+    { 28, 20, 29, 1, 19, 140, 4258 }, // æ
+    { 16, 27, 16, 1, 19, 108, 14438 }, // ç
+    { 17, 27, 19, 1, 26, 115, 14546 }, // è
+    { 18, 27, 19, 1, 26, 122, 14661 }, // é
+    { 18, 27, 19, 1, 26, 122, 14783 }, // ê
+    { 17, 27, 19, 1, 26, 115, 14905 }, // ë
+    { 10, 26, 10, 0, 26, 65, 15020 }, // ì
+    { 14, 26, 10, 0, 26, 91, 15085 }, // í
+    { 14, 26, 10, 0, 26, 91, 15176 }, // î
+    { 13, 26, 10, 0, 26, 85, 15267 }, // ï
+    { 18, 27, 19, 1, 26, 122, 4398 }, // ð
+    { 20, 26, 20, 0, 26, 130, 15352 }, // ñ
+    { 18, 27, 20, 1, 26, 122, 15482 }, // ò
+    { 18, 27, 20, 1, 26, 122, 15604 }, // ó
+    { 18, 27, 20, 1, 26, 122, 15726 }, // ô
+    { 19, 27, 20, 1, 26, 129, 4520 }, // õ
+    { 18, 27, 20, 1, 26, 122, 15848 }, // ö
+    { 17, 17, 19, 1, 20, 73, 4649 }, // ÷
+    { 19, 22, 20, 0, 20, 105, 4722 }, // ø
+    { 19, 27, 20, 1, 26, 129, 15970 }, // ù
+    { 19, 27, 20, 1, 26, 129, 16099 }, // ú
+    { 19, 27, 20, 1, 26, 129, 16228 }, // û
+    { 19, 27, 20, 1, 26, 129, 16357 }, // ü
+    { 23, 34, 17, -3, 26, 196, 4827 }, // ý
+    { 21, 34, 20, -2, 26, 179, 5023 }, // þ
+    { 23, 34, 17, -3, 26, 196, 5202 }, // ÿ
+    { 22, 30, 21, -2, 30, 165, 5398 }, // Ā
+    { 19, 25, 20, 1, 24, 119, 5563 }, // ā
+    { 23, 32, 21, -2, 32, 184, 5682 }, // Ă
+    { 19, 27, 20, 1, 26, 129, 5866 }, // ă
+    { 21, 33, 21, -2, 24, 174, 5995 }, // Ą
+    { 19, 28, 20, 1, 19, 133, 6169 }, // ą
+    { 21, 33, 20, 1, 32, 174, 6302 }, // Ć
+    { 17, 27, 16, 1, 26, 115, 6476 }, // ć
+    { 21, 33, 20, 1, 32, 174, 6591 }, // Ĉ
+    { 17, 27, 16, 1, 26, 115, 6765 }, // ĉ
+    { 21, 33, 20, 1, 32, 174, 6880 }, // Ċ
+    { 16, 27, 16, 1, 26, 108, 7054 }, // ċ
+    { 22, 33, 20, 1, 32, 182, 7162 }, // Č
+    { 18, 27, 16, 1, 26, 122, 7344 }, // č
+    { 23, 32, 23, 0, 32, 184, 7466 }, // Ď
+    { 27, 27, 23, 1, 26, 183, 7650 }, // ď
+    { 22, 24, 23, 0, 24, 132, 7833 }, // Đ
+    { 22, 27, 20, 1, 26, 149, 7965 }, // đ
+    { 20, 30, 18, 0, 30, 150, 8114 }, // Ē
+    { 17, 25, 19, 1, 24, 107, 8264 }, // ē
+    { 20, 32, 18, 0, 32, 160, 8371 }, // Ĕ
+    { 18, 27, 19, 1, 26, 122, 8531 }, // ĕ
+    { 20, 32, 18, 0, 32, 160, 8653 }, // Ė
+    { 17, 27, 19, 1, 26, 115, 8813 }, // ė
+    { 20, 33, 18, 0, 24, 165, 8928 }, // Ę
+    { 17, 27, 19, 1, 19, 115, 9093 }, // ę
+    { 21, 32, 18, 0, 32, 168, 9208 }, // Ě
+    { 19, 27, 19, 1, 26, 129, 9376 }, // ě
+    { 22, 33, 23, 1, 32, 182, 9505 }, // Ĝ
+    { 20, 34, 20, 0, 26, 170, 9687 }, // ĝ
+    { 22, 33, 23, 1, 32, 182, 9857 }, // Ğ
+    { 20, 34, 20, 0, 26, 170, 10039 }, // ğ
+    { 22, 33, 23, 1, 32, 182, 10209 }, // Ġ
+    { 20, 34, 20, 0, 26, 170, 10391 }, // ġ
+    { 22, 33, 23, 1, 25, 182, 10561 }, // Ģ
+    { 20, 34, 20, 0, 26, 170, 10743 }, // ģ
+    { 24, 32, 23, 0, 32, 192, 10913 }, // Ĥ
+    { 19, 33, 20, 0, 33, 157, 11105 }, // ĥ
+    { 26, 24, 23, 0, 24, 156, 11262 }, // Ħ
+    { 19, 26, 20, 0, 26, 124, 11418 }, // ħ
+    { 18, 32, 13, -1, 32, 144, 11542 }, // Ĩ
+    { 15, 26, 10, 0, 26, 98, 11686 }, // ĩ
+    { 17, 30, 13, -1, 30, 128, 11784 }, // Ī
+    { 13, 24, 10, 0, 24, 78, 11912 }, // ī
+    { 18, 32, 13, -1, 32, 144, 11990 }, // Ĭ
+    { 14, 26, 10, 0, 26, 91, 12134 }, // ĭ
+    { 16, 33, 13, -1, 24, 132, 12225 }, // Į
+    { 13, 35, 10, -2, 26, 114, 12357 }, // į
+    { 16, 32, 13, -1, 32, 128, 12471 }, // İ
+    { 10, 19, 10, 0, 19, 48, 12599 }, // ı
+    { 26, 32, 24, -1, 24, 208, 12647 }, // Ĳ
+    { 21, 34, 20, 0, 26, 179, 12855 }, // ĳ
+    { 22, 40, 11, -6, 32, 220, 13034 }, // Ĵ
+    { 19, 34, 10, -5, 26, 162, 13254 }, // ĵ
+    { 24, 32, 20, 0, 24, 192, 13416 }, // Ķ
+    { 21, 34, 19, 0, 26, 179, 13608 }, // ķ
+    { 21, 19, 19, 0, 19, 100, 13787 }, // ĸ
+    { 17, 32, 17, 0, 32, 136, 13887 }, // Ĺ
+    { 16, 33, 10, 0, 33, 132, 14023 }, // ĺ
+    { 16, 32, 17, 0, 24, 128, 14155 }, // Ļ
+    { 13, 34, 10, -2, 26, 111, 14283 }, // ļ
+    { 20, 24, 17, 0, 24, 120, 14394 }, // Ľ
+    { 18, 26, 13, 0, 26, 117, 14514 }, // ľ
+    { 17, 24, 17, 0, 24, 102, 14631 }, // Ŀ
+    { 16, 26, 15, 0, 26, 104, 14733 }, // ŀ
+    { 17, 24, 17, -1, 24, 102, 14837 }, // Ł
+    { 12, 26, 11, 0, 26, 78, 14939 }, // ł
+    { 26, 32, 25, 0, 32, 208, 15017 }, // Ń
+    { 19, 26, 20, 0, 26, 124, 15225 }, // ń
+    { 26, 32, 25, 0, 24, 208, 15349 }, // Ņ
+    { 19, 27, 20, 0, 19, 129, 15557 }, // ņ
+    { 26, 32, 25, 0, 32, 208, 15686 }, // Ň
+    { 21, 26, 20, 0, 26, 137, 15894 }, // ň
+    { 22, 24, 24, 0, 24, 132, 16031 }, // ŉ
+    { 26, 31, 25, 0, 24, 202, 16163 }, // Ŋ
+    { 19, 27, 20, 0, 19, 129, 16365 }, // ŋ
+    { 23, 31, 24, 1, 30, 179, 16494 }, // Ō
+    { 18, 25, 20, 1, 24, 113, 16673 }, // ō
+    { 23, 33, 24, 1, 32, 190, 16786 }, // Ŏ
+    { 18, 27, 20, 1, 26, 122, 16976 }, // ŏ
+    { 25, 33, 24, 1, 32, 207, 17098 }, // Ő
+    { 22, 27, 20, 1, 26, 149, 17305 }, // ő
+    { 30, 26, 30, 2, 25, 195, 16486 }, // Œ
+    { 28, 20, 29, 1, 19, 140, 16681 }, // œ
+    { 21, 32, 21, 0, 32, 168, 17454 }, // Ŕ
+    { 17, 26, 14, 0, 26, 111, 17622 }, // ŕ
+    { 20, 32, 21, 0, 24, 160, 17733 }, // Ŗ
+    { 18, 27, 14, -2, 19, 122, 17893 }, // ŗ
+    { 22, 32, 21, 0, 32, 176, 18015 }, // Ř
+    { 18, 26, 14, 0, 26, 117, 18191 }, // ř
+    { 19, 33, 18, 0, 32, 157, 18308 }, // Ś
+    { 17, 27, 16, 0, 26, 115, 18465 }, // ś
+    { 19, 33, 18, 0, 32, 157, 18580 }, // Ŝ
+    { 17, 27, 16, 0, 26, 115, 18737 }, // ŝ
+    { 19, 33, 18, 0, 25, 157, 18852 }, // Ş
+    { 16, 27, 16, 0, 19, 108, 19009 }, // ş
+    { 20, 33, 18, 0, 32, 165, 19117 }, // Š
+    { 18, 27, 16, 0, 26, 122, 19282 }, // š
+    { 19, 32, 18, 2, 24, 152, 19404 }, // Ţ
+    { 14, 31, 14, 1, 23, 109, 19556 }, // ţ
+    { 19, 32, 18, 2, 32, 152, 19665 }, // Ť
+    { 18, 27, 14, 1, 26, 122, 19817 }, // ť
+    { 19, 24, 18, 2, 24, 114, 19939 }, // Ŧ
+    { 15, 24, 14, 0, 23, 90, 20053 }, // ŧ
+    { 22, 33, 23, 2, 32, 182, 20143 }, // Ũ
+    { 19, 27, 20, 1, 26, 129, 20325 }, // ũ
+    { 22, 31, 23, 2, 30, 171, 20454 }, // Ū
+    { 19, 25, 20, 1, 24, 119, 20625 }, // ū
+    { 22, 33, 23, 2, 32, 182, 20744 }, // Ŭ
+    { 19, 27, 20, 1, 26, 129, 20926 }, // ŭ
+    { 22, 35, 23, 2, 34, 193, 21055 }, // Ů
+    { 19, 29, 20, 1, 28, 138, 21248 }, // ů
+    { 24, 33, 23, 2, 32, 198, 21386 }, // Ű
+    { 22, 27, 20, 1, 26, 149, 21584 }, // ű
+    { 22, 33, 23, 2, 24, 182, 21733 }, // Ų
+    { 19, 28, 20, 1, 19, 133, 21915 }, // ų
+    { 30, 32, 30, 3, 32, 240, 22048 }, // Ŵ
+    { 26, 26, 26, 2, 26, 169, 22288 }, // ŵ
+    { 19, 32, 19, 3, 32, 152, 22457 }, // Ŷ
+    { 23, 34, 17, -3, 26, 196, 22609 }, // ŷ
+    { 19, 32, 19, 3, 32, 152, 22805 }, // Ÿ
+    { 21, 32, 18, -1, 32, 168, 22957 }, // Ź
+    { 18, 26, 16, -1, 26, 117, 23125 }, // ź
+    { 21, 32, 18, -1, 32, 168, 23242 }, // Ż
+    { 17, 26, 16, -1, 26, 111, 23410 }, // ż
+    { 22, 32, 18, -1, 32, 176, 23521 }, // Ž
+    { 19, 26, 16, -1, 26, 124, 23697 }, // ž
+    { 20, 34, 12, -4, 26, 170, 23821 }, // ſ
+    { 8, 6, 0, -14, 26, 12, 23991 }, // ̀
+    { 10, 6, 0, -8, 26, 15, 24003 }, // ́
+    { 14, 6, 0, -5, 26, 21, 24018 }, // ̂
+    { 15, 6, 0, -15, 26, 23, 24039 }, // ̃
+    { 11, 4, 0, -3, 24, 11, 24062 }, // ̄
+    { 15, 5, 0, -4, 29, 19, 24073 }, // ̅
+    { 13, 6, 0, -3, 26, 20, 24092 }, // ̆
+    { 6, 6, 0, 0, 26, 9, 24112 }, // ̇
+    { 12, 6, 0, -3, 26, 18, 24121 }, // ̈
+    { 8, 9, 0, -10, 28, 18, 24139 }, // ̉
+    { 9, 8, 0, -1, 28, 18, 24157 }, // ̊
+    { 16, 6, 0, -4, 26, 24, 24175 }, // ̋
+    { 15, 6, 0, -4, 26, 23, 24199 }, // ̌
+    { 6, 10, 0, 0, 26, 15, 24222 }, // ̍
+    { 12, 7, 0, -3, 26, 21, 24237 }, // ̎
+    { 14, 6, 0, -16, 26, 21, 24258 }, // ̏
+    { 12, 9, 0, -3, 29, 27, 24279 }, // ̐
+    { 13, 6, 0, -4, 26, 20, 24306 }, // ̑
+    { 9, 9, 0, -2, 24, 21, 24326 }, // ̒
+    { 9, 9, 0, -2, 24, 21, 24347 }, // ̓
+    { 5, 9, 0, 0, 24, 12, 24368 }, // ̔
+    { 9, 9, 0, -2, 24, 21, 24380 }, // ̕
+    { 8, 6, 0, -7, -1, 12, 24401 }, // ̖
+    { 10, 6, 0, -8, -1, 15, 24413 }, // ̗
+    { 7, 8, 0, -6, 0, 14, 24428 }, // ̘
+    { 8, 8, 0, -7, 0, 16, 24442 }, // ̙
+    { 11, 10, 10, 2, 26, 28, 24458 }, // ̚
+    { 10, 9, 0, -2, 26, 23, 24486 }, // ̛
+    { 6, 9, 0, -2, 0, 14, 24509 }, // ̜
+    { 8, 6, 0, -7, -1, 12, 24523 }, // ̝
+    { 9, 6, 0, -7, -1, 14, 24535 }, // ̞
+    { 8, 8, 0, -7, 0, 16, 24549 }, // ̟
+    { 8, 3, 0, -7, -2, 6, 24565 }, // ̠
+    { 9, 10, 0, -7, 2, 23, 24571 }, // ̡
+    { 8, 10, 0, -4, 2, 20, 24594 }, // ̢
+    { 7, 6, 0, -16, -2, 11, 24614 }, // ̣
+    { 12, 6, 0, -9, -1, 18, 24625 }, // ̤
+    { 9, 8, 0, -7, 0, 18, 24643 }, // ̥
+    { 7, 6, 0, 2, -2, 11, 24661 }, // ̦
+    { 9, 8, 0, -7, 0, 18, 24672 }, // ̧
+    { 7, 9, 0, -6, 0, 16, 24690 }, // ̨
+    { 7, 10, 0, -6, -1, 18, 24706 }, // ̩
+    { 14, 7, 0, -10, -1, 25, 24724 }, // ̪
+    { 13, 4, 0, -9, -2, 13, 24749 }, // ̫
+    { 14, 6, 0, -9, -1, 21, 24762 }, // ̬
+    { 14, 6, 0, -10, -1, 21, 24783 }, // ̭
+    { 13, 6, 0, -9, -1, 20, 24804 }, // ̮
+    { 13, 6, 0, -9, -1, 20, 24824 }, // ̯
+    { 15, 6, 0, -10, -1, 23, 24844 }, // ̰
+    { 12, 4, 0, -9, -2, 12, 24867 }, // ̱
+    { 17, 3, 0, -11, -3, 13, 24879 }, // ̲
+    { 16, 8, 0, -11, 0, 32, 24892 }, // ̳
+    { 14, 6, 0, -7, 13, 21, 24924 }, // ̴
+    { 15, 5, 0, -8, 11, 19, 24945 }, // ̵
+    { 26, 5, 0, -13, 12, 33, 24964 }, // ̶
+    { 12, 9, 0, -6, 14, 27, 24997 }, // ̷
+    { 20, 28, 0, -10, 26, 140, 25024 }, // ̸
+    { 6, 9, 0, -3, 0, 14, 25164 }, // ̹
+    { 14, 7, 0, -10, -1, 25, 25178 }, // ̺
+    { 14, 8, 0, -10, 0, 28, 25203 }, // ̻
+    { 13, 4, 0, -9, -2, 13, 25231 }, // ̼
+    { 8, 7, 0, -1, 26, 14, 25244 }, // ̽
+    { 8, 10, 0, -1, 29, 20, 25258 }, // ̾
+    { 15, 8, 0, -4, 33, 30, 25278 }, // ̿
+    { 8, 6, 0, -3, 26, 12, 25308 }, // ̀
+    { 10, 6, 0, 0, 26, 15, 25320 }, // ́
+    { 14, 6, 0, 5, 26, 21, 25335 }, // ͂
+    { 6, 7, 0, 0, 26, 11, 25356 }, // ̓
+    { 18, 6, 0, -5, 26, 27, 25367 }, // ̈́
+    { 7, 6, 0, -5, -2, 11, 25394 }, // ͅ
+    { 16, 7, 0, -5, 26, 28, 25405 }, // ͆
+    { 16, 8, 0, -11, 0, 32, 25433 }, // ͇
+    { 11, 7, 0, -8, -1, 20, 25465 }, // ͈
+    { 7, 6, 0, -6, -2, 11, 25485 }, // ͉
+    { 13, 8, 0, -4, 26, 26, 25496 }, // ͊
+    { 13, 14, 0, -3, 32, 46, 25522 }, // ͋
+    { 14, 9, 0, -4, 29, 32, 25568 }, // ͌
+    { 13, 7, 0, -9, -1, 23, 25600 }, // ͍
+    { 7, 8, 0, -6, 0, 14, 25623 }, // ͎
+    { 24, 24, 0, -12, 24, 144, 25637 }, // ͏
+    { 6, 8, 0, 0, 27, 12, 25781 }, // ͐
+    { 6, 9, 0, 4, 29, 14, 25793 }, // ͑
+    { 12, 9, 0, -3, 29, 27, 25807 }, // ͒
+    { 8, 7, 0, -6, -1, 14, 25834 }, // ͓
+    { 6, 7, 0, -5, -1, 11, 25848 }, // ͔
+    { 7, 7, 0, -5, -1, 13, 25859 }, // ͕
+    { 13, 7, 0, -8, -1, 23, 25872 }, // ͖
+    { 6, 9, 0, 3, 28, 14, 25895 }, // ͗
+    { 6, 6, 0, 0, 26, 9, 25909 }, // ͘
+    { 9, 7, 0, -7, -1, 16, 25918 }, // ͙
+    { 13, 8, 0, -9, 0, 26, 25934 }, // ͚
+    { 7, 8, 0, 0, 27, 14, 25960 }, // ͛
+    { 26, 7, 0, -15, -1, 46, 25974 }, // ͜
+    { 26, 7, 0, -10, 26, 46, 26020 }, // ͝
+    { 18, 4, 0, -6, 24, 18, 26066 }, // ͞
+    { 19, 4, 0, -12, -1, 19, 26084 }, // ͟
+    { 27, 6, 0, -10, 26, 41, 26103 }, // ͠
+    { 27, 7, 0, -10, 29, 48, 26144 }, // ͡
+    { 27, 8, 0, -17, 0, 54, 26192 }, // ͢
+    { 9, 9, 0, -1, 29, 21, 26246 }, // ͣ
+    { 9, 9, 0, -1, 29, 21, 26267 }, // ͤ
+    { 5, 11, 0, 1, 31, 14, 26288 }, // ͥ
+    { 8, 9, 0, -1, 29, 18, 26302 }, // ͦ
+    { 9, 8, 0, -1, 28, 18, 26320 }, // ͧ
+    { 7, 9, 0, 0, 29, 16, 26338 }, // ͨ
+    { 10, 11, 0, -1, 31, 28, 26354 }, // ͩ
+    { 9, 11, 0, -2, 31, 25, 26382 }, // ͪ
+    { 14, 9, 0, -4, 29, 32, 26407 }, // ͫ
+    { 7, 9, 0, 0, 29, 16, 26439 }, // ͬ
+    { 7, 10, 0, 0, 30, 18, 26455 }, // ͭ
+    { 8, 8, 0, 0, 28, 16, 26473 }, // ͮ
+    { 10, 8, 0, -2, 28, 20, 26489 }, // ͯ
+    { 20, 32, 18, 0, 32, 160, 26509 }, // Ѐ
+    { 20, 32, 18, 0, 32, 160, 0 }, // Ё
+    { 21, 25, 24, 2, 24, 132, 26669 }, // Ђ
+    { 20, 32, 17, 0, 32, 160, 26801 }, // Ѓ
+    { 21, 26, 20, 1, 25, 137, 26961 }, // Є
+    { 19, 26, 18, 0, 25, 124, 27098 }, // Ѕ
+    { 11, 24, 10, 0, 24, 66, 27222 }, // І
+    { 15, 32, 10, 0, 32, 120, 27288 }, // Ї
+    { 18, 32, 11, -6, 24, 144, 27408 }, // Ј
+    { 34, 25, 32, -2, 24, 213, 27552 }, // Љ
+    { 31, 24, 31, 0, 24, 186, 27765 }, // Њ
+    { 21, 24, 24, 2, 24, 126, 27951 }, // Ћ
+    { 24, 32, 21, 0, 32, 192, 28077 }, // Ќ
+    { 24, 32, 23, 0, 32, 192, 28269 }, // Ѝ
+    { 23, 33, 20, 0, 32, 190, 28461 }, // Ў
+    { 23, 30, 22, 0, 24, 173, 28651 }, // Џ
+    { 21, 24, 21, -2, 24, 126, 160 }, // А
+    { 20, 24, 20, 0, 24, 120, 286 }, // Б
+    { 21, 24, 21, 0, 24, 126, 406 }, // В
+    { 20, 24, 17, 0, 24, 120, 532 }, // Г
+    { 27, 30, 24, -3, 24, 203, 652 }, // Д
+    { 20, 24, 18, 0, 24, 120, 855 }, // Е
+    { 35, 24, 30, -2, 24, 210, 975 }, // Ж
+    { 20, 26, 19, 0, 25, 130, 1185 }, // З
+    { 24, 24, 23, 0, 24, 144, 1315 }, // И
+    { 24, 32, 23, 0, 32, 192, 1459 }, // Й
+    { 24, 24, 21, 0, 24, 144, 1651 }, // К
+    { 26, 25, 23, -2, 24, 163, 1795 }, // Л
+    { 30, 24, 29, 0, 24, 180, 1958 }, // М
+    { 24, 24, 23, 0, 24, 144, 2138 }, // Н
+    { 23, 26, 24, 1, 25, 150, 2282 }, // О
+    { 24, 24, 23, 0, 24, 144, 2432 }, // П
+    { 21, 24, 20, 0, 24, 126, 2576 }, // Р
+    { 21, 26, 20, 1, 25, 137, 2702 }, // С
+    { 19, 24, 17, 2, 24, 114, 2839 }, // Т
+    { 23, 25, 20, 0, 24, 144, 2953 }, // У
+    { 28, 26, 29, 1, 25, 182, 3097 }, // Ф
+    { 25, 24, 20, -2, 24, 150, 3279 }, // Х
+    { 23, 30, 23, 0, 24, 173, 3429 }, // Ц
+    { 21, 24, 22, 2, 24, 126, 3602 }, // Ч
+    { 34, 24, 33, 0, 24, 204, 3728 }, // Ш
+    { 33, 29, 33, 0, 24, 240, 3932 }, // Щ
+    { 21, 24, 23, 2, 24, 126, 4172 }, // Ъ
+    { 30, 24, 29, 0, 24, 180, 4298 }, // Ы
+    { 19, 24, 20, 0, 24, 114, 4478 }, // Ь
+    { 21, 26, 20, 0, 25, 137, 4592 }, // Э
+    { 33, 26, 33, 0, 25, 215, 4729 }, // Ю
+    { 24, 24, 21, -2, 24, 144, 4944 }, // Я
+    { 19, 20, 19, 0, 19, 95, 5088 }, // а
+    { 19, 27, 19, 1, 26, 129, 5183 }, // б
+    { 18, 20, 18, 0, 19, 90, 5312 }, // в
+    { 17, 20, 15, -1, 19, 85, 5402 }, // г
+    { 18, 27, 19, 1, 26, 122, 5487 }, // д
+    { 17, 20, 17, 1, 19, 85, 5609 }, // е
+    { 34, 20, 32, -1, 19, 170, 5694 }, // ж
+    { 16, 20, 17, 0, 19, 80, 5864 }, // з
+    { 19, 20, 20, 1, 19, 95, 5944 }, // и
+    { 19, 27, 20, 1, 26, 129, 6039 }, // й
+    { 21, 19, 19, 0, 19, 100, 6168 }, // к
+    { 21, 20, 20, -1, 19, 105, 6268 }, // л
+    { 26, 19, 26, 0, 19, 124, 6373 }, // м
+    { 20, 19, 20, 0, 19, 95, 6497 }, // н
+    { 19, 20, 19, 0, 19, 95, 6592 }, // о
+    { 19, 19, 20, 0, 19, 91, 6687 }, // п
+    { 21, 27, 20, -2, 19, 142, 6778 }, // р
+    { 16, 20, 16, 0, 19, 80, 6920 }, // с
+    { 29, 19, 30, 0, 19, 138, 7000 }, // т
+    { 23, 27, 18, -3, 19, 156, 7138 }, // у
+    { 23, 34, 25, 1, 26, 196, 7294 }, // ф
+    { 22, 19, 17, -2, 19, 105, 7490 }, // х
+    { 19, 24, 20, 1, 19, 114, 7595 }, // ц
+    { 17, 19, 19, 2, 19, 81, 7709 }, // ч
+    { 29, 20, 30, 1, 19, 145, 7790 }, // ш
+    { 29, 24, 30, 1, 19, 174, 7935 }, // щ
+    { 19, 20, 21, 1, 19, 95, 8109 }, // ъ
+    { 26, 20, 27, 1, 19, 130, 8204 }, // ы
+    { 17, 20, 18, 1, 19, 85, 8334 }, // ь
+    { 15, 20, 16, 0, 19, 75, 8419 }, // э
+    { 27, 20, 27, 0, 19, 135, 8494 }, // ю
+    { 20, 19, 18, -2, 19, 95, 8629 }, // я
+    { 17, 27, 17, 1, 26, 115, 28824 }, // ѐ
+    { 17, 26, 17, 1, 25, 111, 8724 }, // ё
+    { 19, 34, 20, 0, 26, 162, 28939 }, // ђ
+    { 18, 27, 15, -1, 26, 122, 29101 }, // ѓ
+    { 16, 20, 16, 0, 19, 80, 29223 }, // є
+    { 15, 20, 15, 0, 19, 75, 29303 }, // ѕ
+    { 11, 26, 10, 0, 26, 72, 29378 }, // і
+    { 13, 26, 10, 0, 26, 85, 29450 }, // ї
+    { 16, 34, 10, -5, 26, 136, 29535 }, // ј
+    { 29, 20, 29, -1, 19, 145, 29671 }, // љ
+    { 27, 20, 28, 0, 19, 135, 29816 }, // њ
+    { 19, 26, 20, 0, 26, 124, 29951 }, // ћ
+    { 21, 26, 19, 0, 26, 137, 30075 }, // ќ
+    { 19, 27, 20, 1, 26, 129, 30212 }, // ѝ
+    { 23, 34, 18, -3, 26, 196, 30341 }, // ў
+    { 19, 26, 20, 1, 19, 124, 30537 }, // џ
+    { 31, 24, 30, 2, 24, 186, 30661 }, // Ѡ
+    { 27, 19, 27, 2, 19, 129, 30847 }, // ѡ
+    { 18, 24, 21, 2, 24, 108, 30976 }, // Ѣ
+    { 27, 20, 28, 0, 19, 135, 31084 }, // ѣ
+    { 31, 26, 30, 0, 25, 202, 31219 }, // Ѥ
+    { 26, 20, 25, 0, 19, 130, 31421 }, // ѥ
+    { 23, 24, 22, -2, 24, 138, 31551 }, // Ѧ
+    { 21, 19, 19, -3, 19, 100, 31689 }, // ѧ
+    { 29, 24, 31, 0, 24, 174, 31789 }, // Ѩ
+    { 27, 19, 28, 0, 19, 129, 31963 }, // ѩ
+    { 27, 24, 24, -2, 24, 162, 32092 }, // Ѫ
+    { 22, 19, 19, -2, 19, 105, 32254 }, // ѫ
+    { 34, 24, 33, 0, 24, 204, 32359 }, // Ѭ
+    { 29, 19, 28, 0, 19, 138, 32563 }, // ѭ
+    { 22, 37, 20, -2, 29, 204, 32701 }, // Ѯ
+    { 20, 31, 17, -2, 23, 155, 32905 }, // ѯ
+    { 27, 24, 28, 3, 24, 162, 33060 }, // Ѱ
+    { 25, 34, 27, 1, 26, 213, 33222 }, // ѱ
+    { 23, 26, 24, 1, 25, 150, 33435 }, // Ѳ
+    { 18, 20, 20, 1, 19, 90, 33585 }, // ѳ
+    { 21, 24, 22, 3, 24, 126, 33675 }, // Ѵ
+    { 19, 19, 18, 1, 19, 91, 33801 }, // ѵ
+    { 21, 32, 22, 3, 32, 168, 33892 }, // Ѷ
+    { 19, 26, 18, 1, 26, 124, 34060 }, // ѷ
+    { 43, 33, 42, 1, 25, 355, 34184 }, // Ѹ
+    { 38, 27, 37, 1, 19, 257, 34539 }, // ѹ
+    { 23, 29, 25, 2, 26, 167, 34796 }, // Ѻ
+    { 19, 22, 21, 1, 20, 105, 34963 }, // ѻ
+    { 31, 36, 34, 2, 35, 279, 35068 }, // Ѽ
+    { 27, 31, 29, 1, 30, 210, 35347 }, // ѽ
+    { 31, 31, 30, 2, 31, 241, 35557 }, // Ѿ
+    { 27, 25, 27, 2, 25, 169, 35798 }, // ѿ
+    { 21, 33, 20, 1, 25, 174, 35967 }, // Ҁ
+    { 16, 27, 16, 1, 19, 108, 36141 }, // ҁ
+    { 18, 22, 20, 1, 21, 99, 36249 }, // ҂
+    { 13, 7, 0, -13, 25, 23, 36348 }, // ҃
+    { 14, 6, 0, -14, 26, 21, 36371 }, // ҄
+    { 6, 8, 0, -9, 27, 12, 36392 }, // ҅
+    { 7, 8, 0, -10, 27, 14, 36404 }, // ҆
+    { 14, 6, 0, -3, 31, 21, 36418 }, // ҇
+    { 38, 36, 0, -19, 27, 342, 36439 }, // ҈
+    { 38, 38, 0, -19, 28, 361, 36781 }, // ҉
+    { 27, 39, 27, 0, 32, 264, 37142 }, // Ҋ
+    { 20, 34, 21, 1, 27, 170, 37406 }, // ҋ
+    { 18, 24, 20, 0, 24, 108, 37576 }, // Ҍ
+    { 17, 27, 19, 1, 26, 115, 37684 }, // ҍ
+    { 21, 24, 20, 0, 24, 126, 0 }, // Ҏ
+    { 21, 27, 20, -2, 19, 142, 126 }, // ҏ
+    { 21, 29, 17, 0, 29, 153, 268 }, // Ґ
+    { 18, 24, 15, 0, 24, 108, 421 }, // ґ
+    { 20, 24, 17, 0, 24, 120, 529 }, // Ғ
+    { 18, 19, 15, -1, 19, 86, 649 }, // ғ
+    { 20, 33, 22, 0, 24, 165, 735 }, // Ҕ
+    { 17, 28, 19, 0, 19, 119, 900 }, // ҕ
+    { 35, 31, 31, -3, 24, 272, 1019 }, // Җ
+    { 34, 26, 32, -1, 19, 221, 1291 }, // җ
+    { 20, 34, 19, 0, 25, 170, 1512 }, // Ҙ
+    { 16, 28, 17, 0, 19, 112, 1682 }, // ҙ
+    { 23, 31, 23, 0, 24, 179, 1794 }, // Қ
+    { 21, 26, 20, 0, 19, 137, 1973 }, // қ
+    { 24, 24, 21, 0, 24, 144, 2110 }, // Ҝ
+    { 21, 19, 20, 1, 19, 100, 2254 }, // ҝ
+    { 24, 24, 20, 0, 24, 144, 2354 }, // Ҟ
+    { 21, 26, 19, 0, 26, 137, 2498 }, // ҟ
+    { 25, 24, 23, 2, 24, 150, 2635 }, // Ҡ
+    { 23, 19, 22, 1, 19, 110, 2785 }, // ҡ
+    { 24, 31, 26, 0, 24, 186, 2895 }, // Ң
+    { 21, 26, 22, 0, 19, 137, 3081 }, // ң
+    { 29, 24, 26, 0, 24, 174, 3218 }, // Ҥ
+    { 26, 19, 24, 0, 19, 124, 3392 }, // ҥ
+    { 32, 33, 34, 0, 24, 264, 3516 }, // Ҧ
+    { 27, 28, 29, 0, 19, 189, 3780 }, // ҧ
+    { 21, 27, 24, 2, 25, 142, 3969 }, // Ҩ
+    { 18, 21, 20, 1, 19, 95, 4111 }, // ҩ
+    { 21, 34, 20, 1, 25, 179, 4206 }, // Ҫ
+    { 16, 28, 16, 1, 19, 112, 4385 }, // ҫ
+    { 19, 31, 18, 2, 24, 148, 4497 }, // Ҭ
+    { 30, 26, 31, 0, 19, 195, 4645 }, // ҭ
+    { 19, 24, 19, 3, 24, 114, 4840 }, // Ү
+    { 18, 27, 17, 1, 19, 122, 4954 }, // ү
+    { 21, 24, 19, 1, 24, 126, 5076 }, // Ұ
+    { 20, 27, 17, -1, 19, 135, 5202 }, // ұ
+    { 25, 31, 23, -2, 24, 194, 5337 }, // Ҳ
+    { 22, 26, 20, -2, 19, 143, 5531 }, // ҳ
+    { 25, 31, 28, 2, 24, 194, 5674 }, // Ҵ
+    { 21, 26, 23, 1, 19, 137, 5868 }, // ҵ
+    { 21, 31, 25, 3, 24, 163, 6005 }, // Ҷ
+    { 18, 26, 21, 2, 19, 117, 6168 }, // ҷ
+    { 20, 24, 23, 3, 24, 120, 6285 }, // Ҹ
+    { 18, 19, 20, 2, 19, 86, 6405 }, // ҹ
+    { 21, 24, 23, 0, 24, 126, 6491 }, // Һ
+    { 19, 26, 20, 0, 26, 124, 6617 }, // һ
+    { 25, 26, 26, 1, 25, 163, 6741 }, // Ҽ
+    { 22, 20, 22, 0, 19, 110, 6904 }, // ҽ
+    { 25, 32, 26, 1, 25, 200, 7014 }, // Ҿ
+    { 22, 26, 22, 0, 19, 143, 7214 }, // ҿ
+    { 16, 24, 13, -1, 24, 96, 7357 }, // Ӏ
+    { 35, 32, 30, -2, 32, 280, 7453 }, // Ӂ
+    { 34, 27, 32, -1, 26, 230, 7733 }, // ӂ
+    { 23, 33, 23, 0, 24, 190, 7963 }, // Ӄ
+    { 21, 28, 21, 0, 19, 147, 8153 }, // ӄ
+    { 26, 31, 25, -1, 24, 202, 8300 }, // Ӆ
+    { 22, 26, 22, -1, 19, 143, 8502 }, // ӆ
+    { 24, 33, 23, 0, 24, 198, 8645 }, // Ӈ
+    { 20, 28, 21, 0, 19, 140, 8843 }, // ӈ
+    { 25, 31, 26, 0, 24, 194, 8983 }, // Ӊ
+    { 22, 26, 23, 0, 19, 143, 9177 }, // ӊ
+    { 20, 31, 22, 3, 24, 155, 9320 }, // Ӌ
+    { 18, 26, 20, 2, 19, 117, 9475 }, // ӌ
+    { 31, 31, 32, 0, 24, 241, 9592 }, // Ӎ
+    { 27, 26, 28, 0, 19, 176, 9833 }, // ӎ
+    { 16, 24, 13, -1, 24, 96, 10009 }, // ӏ
+    { 24, 32, 21, -2, 32, 192, 10105 }, // Ӑ
+    { 19, 27, 20, 1, 26, 129, 10297 }, // ӑ
+    { 22, 32, 21, -2, 32, 176, 10426 }, // Ӓ
+    { 19, 27, 20, 1, 26, 129, 10602 }, // ӓ
+    { 33, 24, 30, -2, 24, 198, 10731 }, // Ӕ
+    { 28, 20, 29, 1, 19, 140, 10929 }, // ӕ
+    { 21, 32, 18, 0, 32, 168, 11069 }, // Ӗ
+    { 19, 27, 19, 1, 26, 129, 11237 }, // ӗ
+    { 20, 26, 22, 1, 25, 130, 11366 }, // Ә
+    { 18, 20, 19, 0, 19, 90, 11496 }, // ә
+    { 20, 33, 22, 1, 32, 165, 11586 }, // Ӛ
+    { 18, 27, 19, 0, 26, 122, 11751 }, // ӛ
+    { 35, 32, 30, -2, 32, 280, 11873 }, // Ӝ
+    { 34, 27, 32, -1, 26, 230, 12153 }, // ӝ
+    { 20, 33, 19, 0, 32, 165, 12383 }, // Ӟ
+    { 17, 27, 17, 0, 26, 115, 12548 }, // ӟ
+    { 20, 25, 19, -1, 24, 125, 12663 }, // Ӡ
+    { 20, 28, 18, -2, 19, 140, 12788 }, // ӡ
+    { 24, 30, 23, 0, 30, 180, 12928 }, // Ӣ
+    { 19, 25, 20, 1, 24, 119, 13108 }, // ӣ
+    { 24, 32, 23, 0, 32, 192, 13227 }, // Ӥ
+    { 19, 27, 20, 1, 26, 129, 13419 }, // ӥ
+    { 23, 33, 24, 1, 32, 190, 13548 }, // Ӧ
+    { 18, 27, 20, 1, 26, 122, 13738 }, // ӧ
+    { 23, 26, 24, 1, 25, 150, 13860 }, // Ө
+    { 18, 20, 20, 1, 19, 90, 14010 }, // ө
+    { 23, 33, 24, 1, 32, 190, 14100 }, // Ӫ
+    { 18, 27, 20, 1, 26, 122, 14290 }, // ӫ
+    { 21, 33, 20, 0, 32, 174, 14412 }, // Ӭ
+    { 16, 27, 16, 0, 26, 108, 14586 }, // ӭ
+    { 23, 31, 20, 0, 30, 179, 14694 }, // Ӯ
+    { 23, 32, 17, -3, 24, 184, 14873 }, // ӯ
+    { 23, 33, 20, 0, 32, 190, 15057 }, // Ӱ
+    { 23, 34, 17, -3, 26, 196, 15247 }, // ӱ
+    { 24, 33, 20, 0, 32, 198, 15443 }, // Ӳ
+    { 24, 34, 17, -3, 26, 204, 15641 }, // ӳ
+    { 21, 32, 22, 2, 32, 168, 15845 }, // Ӵ
+    { 17, 26, 19, 2, 26, 111, 16013 }, // ӵ
+    { 20, 31, 17, 0, 24, 155, 16124 }, // Ӷ
+    { 17, 26, 15, 0, 19, 111, 16279 }, // ӷ
+    { 30, 32, 29, 0, 32, 240, 16390 }, // Ӹ
+    { 26, 27, 27, 1, 26, 176, 16630 }, // ӹ
+    { 20, 33, 17, 0, 24, 165, 16806 }, // Ӻ
+    { 18, 28, 15, -1, 19, 126, 16971 }, // ӻ
+    { 25, 33, 23, -2, 24, 207, 17097 }, // Ӽ
+    { 22, 28, 20, -2, 19, 154, 17304 }, // ӽ
+    { 25, 24, 20, -2, 24, 150, 17458 }, // Ӿ
+    { 22, 19, 18, -2, 19, 105, 17608 }, // ӿ
+    { 0, 0, 17, 0, 0, 0, 17713 }, //  
+    { 0, 0, 33, 0, 0, 0, 17713 }, //  
+    { 0, 0, 17, 0, 0, 0, 17713 }, //  
+    { 0, 0, 33, 0, 0, 0, 17713 }, //  
+    { 0, 0, 11, 0, 0, 0, 17713 }, //  
+    { 0, 0, 8, 0, 0, 0, 17713 }, //  
+    { 0, 0, 6, 0, 0, 0, 17713 }, //  
+    { 0, 0, 18, 0, 0, 0, 17713 }, //  
+    { 0, 0, 10, 0, 0, 0, 17713 }, //  
+    { 0, 0, 6, 0, 0, 0, 17713 }, //  
+    { 0, 0, 3, 0, 0, 0, 17713 }, //  
+    { 0, 0, 0, 0, 0, 0, 17713 }, // ​
+    { 0, 0, 0, 0, 0, 0, 17713 }, // ‌
+    { 0, 0, 0, 0, 0, 0, 17713 }, // ‍
+    { 9, 28, 0, -1, 23, 63, 17713 }, // ‎
+    { 9, 28, 0, -8, 23, 63, 17776 }, // ‏
+    { 10, 5, 11, 0, 11, 13, 17839 }, // ‐
+    { 10, 5, 11, 0, 11, 13, 17852 }, // ‑
+    { 17, 5, 18, 1, 14, 22, 17865 }, // ‒
+    { 16, 4, 16, 0, 11, 16, 16821 }, // –
+    { 32, 4, 32, 0, 11, 32, 16837 }, // —
+    { 32, 4, 32, 0, 11, 32, 17887 }, // ―
+    { 13, 34, 18, 3, 26, 111, 17919 }, // ‖
+    { 16, 8, 13, -4, 0, 32, 18030 }, // ‗
+    { 9, 9, 7, 1, 24, 21, 16869 }, // ‘
+    { 9, 9, 7, 1, 24, 21, 16890 }, // ’
+    { 9, 9, 9, -2, 4, 21, 18062 }, // ‚
+    { 6, 9, 7, 3, 24, 14, 18083 }, // ‛
+    { 17, 9, 14, 1, 24, 39, 16911 }, // “
+    { 16, 9, 14, 1, 24, 36, 16950 }, // ”
+    { 16, 9, 17, -2, 4, 36, 18097 }, // „
+    { 13, 9, 14, 3, 24, 30, 18133 }, // ‟
+    { 15, 26, 17, 3, 26, 98, 18163 }, // †
+    { 17, 26, 17, 1, 26, 111, 18261 }, // ‡
+    { 10, 11, 13, 2, 18, 28, 18372 }, // •
+    { 11, 13, 12, 1, 19, 36, 18400 }, // ‣
+    { 7, 7, 17, 3, 6, 13, 18436 }, // ․
+    { 16, 7, 19, 0, 6, 28, 18449 }, // ‥
+    { 25, 7, 28, 0, 6, 44, 16986 }, // …
+    { 7, 7, 11, 2, 13, 13, 18477 }, // ‧
+    { 0, 0, 20, 0, 0, 0, 18490 }, //  
+    { 0, 0, 20, 0, 0, 0, 18490 }, //  
+    { 9, 26, 0, -1, 21, 59, 18490 }, // ‪
+    { 9, 26, 0, -8, 21, 59, 18549 }, // ‫
+    { 8, 28, 0, -4, 23, 56, 18608 }, // ‬
+    { 8, 28, 0, -4, 23, 56, 18664 }, // ‭
+    { 8, 28, 0, -4, 23, 56, 18720 }, // ‮
+    { 0, 0, 6, 0, 0, 0, 18776 }, //  
+    { 39, 26, 41, 1, 25, 254, 18776 }, // ‰
+    { 51, 26, 53, 1, 25, 332, 19030 }, // ‱
+    { 10, 9, 9, 2, 24, 23, 19362 }, // ′
+    { 18, 9, 17, 2, 24, 41, 19385 }, // ″
+    { 25, 9, 25, 2, 24, 57, 19426 }, // ‴
+    { 9, 9, 9, 2, 24, 21, 19483 }, // ‵
+    { 17, 9, 17, 2, 24, 39, 19504 }, // ‶
+    { 24, 9, 25, 2, 24, 54, 19543 }, // ‷
+    { 12, 11, 12, -3, 3, 33, 19597 }, // ‸
+    { 10, 16, 11, 1, 17, 40, 19630 }, // ‹
+    { 10, 16, 11, 0, 17, 40, 19670 }, // ›
+    { 27, 26, 28, 1, 25, 176, 19710 }, // ※
+    { 20, 25, 19, 0, 24, 125, 19886 }, // ‼
+    { 15, 26, 15, 2, 25, 98, 20011 }, // ‽
+    { 16, 4, 14, 3, 29, 16, 20109 }, // ‾
+    { 17, 8, 18, -2, 0, 34, 20125 }, // ‿
+    { 18, 8, 18, 2, 27, 36, 20159 }, // ⁀
+    { 17, 22, 13, -3, 14, 94, 20195 }, // ⁁
+    { 38, 31, 38, -1, 26, 295, 20289 }, // ⁂
+    { 10, 5, 11, 0, 11, 13, 20584 }, // ⁃
+    { 22, 24, 4, -9, 24, 132, 20597 }, // ⁄
+    { 15, 30, 11, -1, 24, 113, 20729 }, // ⁅
+    { 15, 30, 11, -3, 24, 113, 20842 }, // ⁆
+    { 30, 26, 30, 2, 25, 195, 20955 }, // ⁇
+    { 25, 26, 25, 2, 25, 163, 21150 }, // ⁈
+    { 26, 26, 25, 0, 25, 169, 21313 }, // ⁉
+    { 17, 19, 18, 2, 19, 81, 21482 }, // ⁊
+    { 18, 31, 21, 3, 26, 140, 21563 }, // ⁋
+    { 18, 18, 21, 1, 19, 81, 21703 }, // ⁌
+    { 18, 18, 21, 2, 19, 81, 21784 }, // ⁍
+    { 17, 17, 18, -1, 9, 73, 21865 }, // ⁎
+    { 9, 24, 10, 1, 19, 54, 21938 }, // ⁏
+    { 22, 35, 18, -2, 27, 193, 21992 }, // ⁐
+    { 20, 34, 18, -1, 26, 170, 22185 }, // ⁑
+    { 14, 26, 14, 0, 25, 91, 22355 }, // ⁒
+    { 32, 7, 33, 1, 13, 56, 22446 }, // ⁓
+    { 17, 8, 18, -3, 0, 34, 22502 }, // ⁔
+    { 19, 19, 19, 0, 18, 91, 22536 }, // ⁕
+    { 16, 26, 19, 1, 25, 104, 22627 }, // ⁖
+    { 30, 9, 29, 2, 24, 68, 22731 }, // ⁗
+    { 26, 26, 28, 1, 25, 169, 22799 }, // ⁘
+    { 26, 26, 28, 1, 25, 169, 22968 }, // ⁙
+    { 7, 26, 9, 1, 25, 46, 23137 }, // ⁚
+    { 22, 27, 24, 1, 26, 149, 23183 }, // ⁛
+    { 27, 27, 28, 0, 25, 183, 23332 }, // ⁜
+    { 7, 27, 9, 1, 26, 48, 23515 }, // ⁝
+    { 6, 26, 10, 2, 25, 39, 23563 }, // ⁞
+    { 0, 0, 7, 0, 0, 0, 23602 }, //  
+    { 0, 0, 20, 0, 0, 0, 23602 }, // ⁠
+    { 0, 0, 20, 0, 0, 0, 23602 }, // ⁡
+    { 0, 0, 20, 0, 0, 0, 23602 }, // ⁢
+    { 0, 0, 20, 0, 0, 0, 23602 }, // ⁣
+    { 0, 0, 20, 0, 0, 0, 23602 }, // ⁤
+    { 0, 0, 20, 0, 0, 0, 23602 }, // ⁦
+    { 0, 0, 20, 0, 0, 0, 23602 }, // ⁧
+    { 0, 0, 20, 0, 0, 0, 23602 }, // ⁨
+    { 0, 0, 20, 0, 0, 0, 23602 }, // ⁩
+    { 8, 28, 0, -4, 23, 56, 23602 }, // ⁪
+    { 8, 28, 0, -4, 23, 56, 23658 }, // ⁫
+    { 8, 28, 0, -4, 23, 56, 23714 }, // ⁬
+    { 8, 29, 0, -4, 24, 58, 23770 }, // ⁭
+    { 8, 28, 0, -4, 23, 56, 23828 }, // ⁮
+    { 8, 28, 0, -4, 23, 56, 23884 }, // ⁯
+    { 12, 16, 13, 3, 29, 48, 23940 }, // ⁰
+    { 7, 16, 8, 2, 25, 28, 23988 }, // ⁱ
+    { 14, 16, 13, 1, 29, 56, 24016 }, // ⁴
+    { 13, 16, 13, 2, 29, 52, 24072 }, // ⁵
+    { 12, 16, 13, 3, 29, 48, 24124 }, // ⁶
+    { 13, 16, 13, 3, 29, 52, 24172 }, // ⁷
+    { 13, 16, 13, 2, 29, 52, 24224 }, // ⁸
+    { 12, 16, 13, 3, 29, 48, 24276 }, // ⁹
+    { 11, 10, 13, 3, 25, 28, 24324 }, // ⁺
+    { 11, 3, 13, 3, 21, 9, 24352 }, // ⁻
+    { 10, 8, 13, 4, 24, 20, 24361 }, // ⁼
+    { 8, 19, 7, 4, 30, 38, 24381 }, // ⁽
+    { 9, 19, 7, 0, 30, 43, 24419 }, // ⁾
+    { 12, 12, 13, 2, 21, 36, 24462 }, // ⁿ
+    { 12, 16, 13, -1, 11, 48, 24498 }, // ₀
+    { 11, 16, 13, -1, 11, 44, 24546 }, // ₁
+    { 13, 16, 13, -2, 11, 52, 24590 }, // ₂
+    { 13, 16, 13, -2, 11, 52, 24642 }, // ₃
+    { 13, 16, 13, -2, 11, 52, 24694 }, // ₄
+    { 13, 16, 13, -2, 11, 52, 24746 }, // ₅
+    { 13, 16, 13, -1, 11, 52, 24798 }, // ₆
+    { 13, 16, 13, -1, 11, 52, 24850 }, // ₇
+    { 13, 16, 13, -2, 11, 52, 24902 }, // ₈
+    { 12, 16, 13, -1, 11, 48, 24954 }, // ₉
+    { 10, 10, 13, 0, 8, 25, 25002 }, // ₊
+    { 10, 3, 13, 0, 4, 8, 25027 }, // ₋
+    { 11, 8, 13, 0, 6, 22, 25035 }, // ₌
+    { 9, 19, 7, 0, 13, 43, 25057 }, // ₍
+    { 9, 19, 7, -4, 13, 43, 25100 }, // ₎
+    { 12, 12, 13, -1, 8, 36, 25143 }, // ₐ
+    { 11, 12, 12, -1, 8, 33, 25179 }, // ₑ
+    { 11, 12, 13, -1, 8, 33, 25212 }, // ₒ
+    { 14, 12, 12, -3, 8, 42, 25245 }, // ₓ
+    { 12, 12, 12, -2, 8, 36, 25287 }, // ₔ
+    { 13, 16, 15, -1, 12, 52, 25323 }, // ₕ
+    { 14, 16, 13, -1, 12, 56, 25375 }, // ₖ
+    { 8, 16, 8, -1, 12, 32, 25431 }, // ₗ
+    { 19, 12, 21, -1, 8, 57, 25463 }, // ₘ
+    { 13, 12, 13, -2, 8, 39, 25520 }, // ₙ
+    { 14, 16, 13, -3, 8, 56, 25559 }, // ₚ
+    { 10, 12, 11, -1, 8, 30, 25615 }, // ₛ
+    { 9, 15, 9, -1, 11, 34, 25645 }, // ₜ
+    { 19, 25, 19, 1, 25, 119, 25679 }, // ₠
+    { 20, 28, 18, 1, 26, 140, 25798 }, // ₡
+    { 20, 26, 19, 1, 25, 130, 25938 }, // ₢
+    { 20, 24, 18, 0, 24, 120, 26068 }, // ₣
+    { 22, 25, 18, -1, 25, 138, 26188 }, // ₤
+    { 29, 27, 30, 0, 23, 196, 26326 }, // ₥
+    { 21, 24, 19, 0, 24, 126, 26522 }, // ₦
+    { 29, 25, 29, 0, 24, 182, 26648 }, // ₧
+    { 31, 25, 30, 0, 24, 194, 26830 }, // ₨
+    { 27, 24, 24, 0, 24, 162, 27024 }, // ₩
+    { 28, 24, 29, 1, 24, 168, 27186 }, // ₪
+    { 23, 32, 20, 0, 26, 184, 27354 }, // ₫
+    { 21, 26, 18, 0, 25, 137, 27538 }, // €
+    { 23, 24, 19, 0, 24, 138, 27675 }, // ₭
+    { 20, 24, 18, 1, 24, 120, 27813 }, // ₮
+    { 33, 33, 34, 0, 25, 273, 27933 }, // ₯
+    { 22, 33, 20, -2, 25, 182, 28206 }, // ₰
+    { 21, 24, 19, 0, 24, 126, 28388 }, // ₱
+    { 22, 29, 23, 1, 26, 160, 28514 }, // ₲
+    { 23, 24, 20, -2, 24, 138, 28674 }, // ₳
+    { 20, 26, 19, 0, 25, 130, 28812 }, // ₴
+    { 20, 29, 20, 2, 26, 145, 28942 }, // ₵
+    { 24, 24, 23, 0, 23, 144, 29087 }, // ₶
+    { 25, 28, 23, -1, 25, 175, 29231 }, // ₷
+    { 19, 24, 18, 1, 24, 114, 29406 }, // ₸
+    { 18, 24, 18, 2, 24, 108, 29520 }, // ₹
+    { 19, 25, 18, 0, 24, 119, 29628 }, // ₺
+    { 21, 26, 21, 2, 25, 137, 29747 }, // ₻
+    { 27, 24, 27, -1, 24, 162, 29884 }, // ₼
+    { 21, 24, 19, -1, 24, 126, 30046 }, // ₽
+    { 23, 28, 20, -1, 28, 161, 30172 }, // ₾
+    { 19, 32, 18, 0, 28, 152, 30333 }, // ₿
+    { 10, 5, 11, 0, 11, 13, 30485 }, // −
+    { 32, 34, 24, -4, 26, 272, 30498 }, // ﬀ
+    { 28, 34, 22, -4, 26, 238, 30770 }, // ﬁ
+    { 28, 34, 22, -4, 26, 238, 31008 }, // ﬂ
+    { 39, 34, 33, -4, 26, 332, 31246 }, // ﬃ
+    { 39, 34, 33, -4, 26, 332, 31578 }, // ﬄ
+    { 30, 34, 25, -4, 26, 255, 31910 }, // ﬅ
+    { 31, 27, 29, 0, 26, 210, 32165 }, // ﬆ
+    { 31, 32, 33, 1, 26, 248, 32375 }, // �
 };
 
 static const EpdUnicodeInterval notosans_16_bolditalicIntervals[] = {
@@ -3375,31 +3423,301 @@ static const EpdUnicodeInterval notosans_16_bolditalicIntervals[] = {
     { 0x2090, 0x209C, 0x33D },
     { 0x20A0, 0x20BF, 0x34A },
     { 0x2212, 0x2212, 0x36A },
-    { 0xFFFD, 0xFFFD, 0x36B },
+    { 0xFB00, 0xFB06, 0x36B },
+    { 0xFFFD, 0xFFFD, 0x372 },
 };
 
 static const EpdFontGroup notosans_16_bolditalicGroups[] = {
-    { 0, 4803, 10004, 97, 0 },
-    { 4803, 4509, 11880, 96, 97 },
-    { 9312, 6862, 18928, 128, 193 },
-    { 16174, 1671, 2518, 112, 321 },
-    { 17845, 14886, 37838, 256, 433 },
-    { 32731, 2878, 6436, 111, 689 },
-    { 35609, 1131, 1739, 42, 800 },
-    { 36740, 2634, 4806, 32, 842 },
-    { 39374, 16, 13, 1, 874 },
-    { 39390, 125, 248, 1, 875 },
+    { 0, 6428, 17030, 151, 2 },
+    { 6428, 4026, 8835, 66, 434 },
+    { 10454, 15483, 37799, 365, 0 },
+    { 25937, 14224, 32623, 301, 575 },
+};
+
+static const uint8_t notosans_16_bolditalicGlyphGroups[883] = {
+    2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2,
+    2, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 2, 2,
+    2, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 0, 0, 3, 3, 3, 0, 0, 3, 3, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+};
+
+static const uint8_t notosans_16_bolditalicKernLeftClasses[883] = {
+    0, 0, 72, 0, 2, 0, 0, 0, 62, 2, 18, 0, 0, 0, 7, 26,
+    7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 13, 47, 42, 17, 33, 65, 0, 0, 0, 0, 42, 22, 0,
+    0, 17, 43, 17, 0, 0, 11, 47, 38, 38, 42, 16, 68, 18, 0, 0,
+    0, 67, 0, 0, 32, 75, 0, 32, 60, 0, 0, 0, 0, 64, 0, 0,
+    0, 32, 32, 0, 29, 0, 59, 0, 39, 39, 64, 39, 0, 18, 0, 0,
+    0, 0, 70, 0, 0, 0, 0, 0, 0, 0, 0, 0, 51, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 0, 0, 0,
+    61, 13, 13, 13, 13, 13, 13, 33, 42, 33, 33, 33, 33, 0, 0, 0,
+    0, 17, 0, 17, 17, 17, 17, 17, 0, 17, 47, 47, 47, 47, 16, 43,
+    0, 0, 0, 0, 0, 0, 0, 32, 0, 32, 32, 32, 32, 0, 0, 0,
+    73, 32, 0, 32, 32, 32, 32, 32, 0, 32, 0, 0, 0, 0, 39, 32,
+    39, 13, 0, 13, 0, 13, 0, 42, 0, 42, 0, 42, 0, 42, 0, 17,
+    30, 17, 0, 33, 32, 33, 32, 33, 32, 33, 32, 33, 32, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 63, 0, 73, 0, 0, 33,
+    0, 0, 0, 0, 0, 0, 0, 42, 64, 64, 22, 0, 22, 0, 22, 30,
+    22, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 32, 17,
+    32, 17, 32, 33, 32, 0, 29, 0, 29, 0, 29, 0, 0, 0, 0, 0,
+    0, 0, 0, 11, 59, 11, 58, 11, 59, 47, 0, 47, 0, 47, 0, 47,
+    0, 47, 0, 47, 0, 38, 39, 16, 39, 16, 68, 0, 68, 0, 68, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 12, 10, 28, 74, 0, 0, 71, 12, 12, 48, 8, 0, 1,
+    0, 6, 56, 46, 10, 4, 0, 8, 46, 0, 0, 8, 0, 0, 0, 14,
+    0, 24, 28, 10, 1, 44, 8, 4, 0, 0, 4, 12, 0, 12, 14, 14,
+    0, 45, 53, 34, 31, 40, 31, 20, 34, 45, 45, 52, 45, 45, 45, 3,
+    35, 3, 20, 35, 19, 3, 52, 23, 45, 45, 23, 5, 45, 5, 3, 3,
+    45, 31, 31, 50, 31, 20, 69, 0, 57, 66, 5, 5, 35, 52, 45, 19,
+    45, 1, 55, 41, 5, 28, 0, 6, 36, 6, 36, 0, 0, 0, 0, 46,
+    34, 0, 0, 14, 3, 1, 55, 1, 55, 19, 19, 14, 3, 14, 3, 1,
+    55, 28, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 40, 41, 5, 24,
+    3, 9, 49, 15, 54, 0, 27, 21, 0, 46, 34, 21, 0, 8, 20, 8,
+    20, 8, 20, 4, 40, 15, 49, 0, 27, 0, 3, 28, 0, 9, 40, 25,
+    47, 25, 47, 21, 0, 4, 40, 4, 40, 0, 0, 0, 27, 45, 31, 45,
+    31, 0, 8, 20, 0, 20, 4, 40, 0, 0, 4, 40, 0, 0, 4, 40,
+    0, 6, 0, 6, 0, 0, 31, 0, 31, 14, 3, 14, 3, 8, 20, 46,
+    34, 0, 0, 0, 0, 0, 0, 14, 3, 14, 3, 14, 3, 14, 3, 1,
+    19, 1, 19, 1, 19, 0, 45, 9, 49, 0, 45, 15, 54, 21, 0, 8,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 26, 26, 26, 0, 0, 2, 2, 7, 0, 2, 2, 7,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 51, 37, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 76, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 77, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 60, 0, 0, 0, 0,
+    0, 0, 0,
+};
+
+static const uint8_t notosans_16_bolditalicKernRightClasses[883] = {
+    0, 0, 0, 69, 9, 0, 0, 0, 64, 9, 0, 29, 0, 0, 2, 24,
+    2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28, 28, 0, 0,
+    0, 57, 0, 10, 0, 4, 0, 0, 0, 4, 0, 0, 41, 0, 0, 0,
+    0, 4, 0, 4, 0, 0, 18, 49, 38, 38, 61, 30, 0, 0, 0, 29,
+    0, 0, 0, 14, 0, 1, 1, 1, 63, 7, 0, 0, 63, 0, 0, 7,
+    7, 1, 7, 1, 7, 7, 0, 7, 21, 21, 0, 21, 52, 0, 0, 29,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 31, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0,
+    0, 10, 10, 10, 10, 10, 10, 70, 4, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4, 4, 4, 4, 4, 0, 4, 49, 49, 49, 49, 30, 0,
+    63, 1, 14, 14, 14, 14, 14, 14, 1, 1, 1, 1, 1, 0, 0, 0,
+    0, 0, 7, 1, 1, 1, 1, 1, 0, 1, 7, 7, 7, 7, 21, 0,
+    21, 10, 14, 10, 14, 10, 14, 4, 1, 4, 1, 4, 1, 4, 1, 0,
+    1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 4, 7, 4,
+    7, 4, 7, 4, 7, 0, 0, 0, 71, 0, 62, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 63, 0, 0, 7, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 7, 0, 7, 0, 7, 0, 0, 7, 4, 1, 4,
+    1, 4, 1, 4, 1, 0, 7, 0, 7, 0, 0, 0, 7, 0, 7, 0,
+    7, 0, 7, 18, 0, 18, 0, 18, 0, 49, 7, 49, 7, 49, 7, 49,
+    7, 49, 7, 49, 7, 38, 21, 30, 21, 30, 0, 52, 0, 52, 0, 52,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 3, 0, 35, 68, 0, 0, 33, 26, 0, 3, 0, 0, 17,
+    0, 13, 0, 0, 0, 44, 0, 19, 42, 0, 0, 0, 26, 0, 0, 35,
+    0, 0, 35, 3, 17, 45, 19, 0, 5, 0, 0, 3, 0, 0, 42, 0,
+    66, 15, 67, 15, 36, 53, 15, 22, 36, 55, 55, 28, 32, 28, 28, 15,
+    28, 28, 15, 28, 11, 15, 60, 55, 6, 55, 55, 16, 55, 55, 22, 28,
+    65, 15, 15, 23, 36, 15, 59, 0, 58, 48, 32, 28, 23, 28, 55, 11,
+    55, 43, 39, 51, 0, 0, 20, 13, 34, 0, 20, 0, 0, 0, 20, 42,
+    36, 5, 20, 12, 8, 43, 39, 43, 39, 12, 8, 12, 8, 12, 8, 43,
+    39, 12, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 51, 23, 0,
+    20, 0, 20, 51, 0, 0, 20, 19, 36, 42, 36, 0, 20, 0, 20, 51,
+    23, 40, 16, 0, 20, 0, 20, 0, 20, 12, 8, 12, 8, 3, 20, 50,
+    56, 50, 56, 19, 22, 40, 16, 5, 6, 5, 6, 0, 20, 27, 37, 27,
+    37, 0, 19, 22, 0, 20, 47, 34, 0, 20, 0, 20, 5, 6, 0, 20,
+    0, 13, 54, 13, 54, 13, 54, 0, 8, 51, 36, 51, 36, 19, 22, 42,
+    36, 0, 0, 0, 20, 0, 20, 12, 8, 12, 8, 12, 8, 42, 22, 17,
+    11, 17, 11, 17, 11, 5, 6, 0, 20, 0, 55, 51, 0, 19, 22, 19,
+    22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 24, 24, 24, 0, 0, 25, 9, 2, 0, 25, 9, 2,
+    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 31, 46, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 72, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 73, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 63, 0, 0, 0, 0,
+    0, 0, 0,
+};
+
+static const int8_t notosans_16_bolditalicKernMatrix[5772] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -3, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 2, -1, 0, -2, -1, -1, 0, 0, -1, -2, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, -2, -1, -1, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 1, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, 1, 0, 1, 0, -1, -2, 0, -2, 1, 0, -2, -1, 0, 0, 1, 1, 1, 0, 0, 0, 1, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 1, 0, 0, 0, 1, 0, -2, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 1, 0, 0, 0, 2, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, -1, -2, 0, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 1, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -3, 0, -4, -2, 0, 0, -2, 0, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -3, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, -3, -2, 0, 0, -2, 0, -1, 0, 0, 0, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, -2, 1, -2, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, -2, 0, 0, -1, 0, -1, 0, 0, 0, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, -2, -3, -2, 0, 0, 0, 0, 0, -2, 0, 0, 0, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -2, 0, -2, 0, 0, -2, 0, -1, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, 1, 0, -1, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, -2, 0, -2, 0, 0, -1, -1, -2, 0, 0, -1, 0, 0, 0, -2, 0, -1, 0, -1, 0, 0, -2, 0, 0, 0, -2, 0, 0, -2, 0, -1, -2, 0, -1, 0, 0, 0, 0, 0, -1, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -2, 0, -2, 0, 0, 0, 0, 0, 0, -1, 2, -1, 0, -2, 0, -1, 1, 0, 0, -2, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -2, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 1, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, -2, 0, -1, 0, 0, -2, 0, 0, -2, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -2, 0, -3, -1, 0, 0, -3, 0, -1, 0, 0, 0, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 1, 0, 0, -2, 0, -1, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, -1, 0, -1, 1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -2, 0, -1, -1, 0, 0, 1, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, -2, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 3, 1, 0, 1, -1, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, 0, 0, 0, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 7, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, -1, -1, 0, 0, -1, 0, 0, 0, 1, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, -1, 1, 0, 0, 1, 0, 0, 1, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -4, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, -1, 0, -2, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -3, 0, 0, -2, 0, -1, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -4, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, 0, 0,
+    0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -2, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, -1, -1, 0, 0, -1, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, -1, -2, 0, -1, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -4, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, -3, -1, 0, 0, -3, 0, 0, 0, 0, 0, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -3, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -1, 0, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+};
+
+static const EpdLigaturePair notosans_16_bolditalicLigatures[] = {
+    { 0x66, 0x66, 0xFB00 },
+    { 0x66, 0x69, 0xFB01 },
+    { 0x66, 0x6C, 0xFB02 },
+    { 0xFB00, 0x69, 0xFB03 },
+    { 0xFB00, 0x6C, 0xFB04 },
+};
+
+static const uint16_t notosans_16_bolditalicGlyphLookup[368] = {
+    0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0001, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, 0x0010, 0x0011,
+    0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, 0x0020, 0x0021,
+    0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, 0x0030, 0x0031,
+    0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, 0x0040, 0x0041,
+    0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051,
+    0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, 0x0060, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070,
+    0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, 0x0080,
+    0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F, 0x0090,
+    0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F, 0x00A0,
+    0x00A1, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF, 0x00B0,
+    0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF, 0x00C0,
+    0x02B1, 0x02B2, 0x02B3, 0x02B4, 0x02B5, 0x02B6, 0x02B7, 0x02B8, 0x02B9, 0x02BA, 0x02BB, 0x02BC, 0x02BD, 0x02BE, 0x02BF, 0x02C0,
+    0x02C1, 0x02C2, 0x02C3, 0x02C4, 0x02C5, 0x02C6, 0x02C7, 0x02C8, 0x02C9, 0x02CA, 0x02CB, 0x02CC, 0x02CD, 0x02CE, 0x02CF, 0x02D0,
+    0x02D1, 0x02D2, 0x02D3, 0x02D4, 0x02D5, 0x02D6, 0x02D7, 0x02D8, 0x02D9, 0x02DA, 0x02DB, 0x02DC, 0x02DD, 0x02DE, 0x02DF, 0x02E0,
+    0x02E1, 0x02E2, 0x02E3, 0x02E4, 0x02E5, 0x02E6, 0x02E7, 0x02E8, 0x02E9, 0x02EA, 0x02EB, 0x02EC, 0x02ED, 0x02EE, 0x02EF, 0x02F0,
+    0x02F1, 0x02F2, 0x02F3, 0x02F4, 0x02F5, 0x02F6, 0x02F7, 0x02F8, 0x02F9, 0x02FA, 0x02FB, 0x02FC, 0x02FD, 0x02FE, 0x02FF, 0x0300,
+    0x0301, 0x0302, 0x0303, 0x0304, 0x0305, 0x0306, 0x0307, 0x0308, 0x0309, 0x030A, 0x030B, 0x030C, 0x030D, 0x030E, 0x030F, 0x0310,
+    0x0311, 0x0312, 0x0313, 0x0314, 0x0315, 0xFFFF, 0x0316, 0x0317, 0x0318, 0x0319, 0x031A, 0x031B, 0x031C, 0x031D, 0x031E, 0x031F,
 };
 
 static const EpdFontData notosans_16_bolditalic = {
     notosans_16_bolditalicBitmaps,
     notosans_16_bolditalicGlyphs,
     notosans_16_bolditalicIntervals,
-    15,
+    16,
     45,
     36,
     -10,
     true,
     notosans_16_bolditalicGroups,
-    10,
+    4,
+    notosans_16_bolditalicKernLeftClasses,
+    notosans_16_bolditalicKernRightClasses,
+    notosans_16_bolditalicKernMatrix,
+    74,
+    notosans_16_bolditalicLigatures,
+    5,
+    0x4000000001ull,
+    notosans_16_bolditalicGlyphLookup,
+    notosans_16_bolditalicGlyphGroups,
+    false,
+    nullptr,
 };
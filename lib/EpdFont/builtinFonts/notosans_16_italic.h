@@ -3,2303 +3,2328 @@
  * name: notosans_16_italic
  * size: 16
  * mode: 2-bit  compressed: true
- * Command used: fontconvert.py notosans_16_italic 16 ../builtinFonts/source/NotoSans/NotoSans-Italic.ttf --2bit --compress
+ * Command used: fontconvert.py notosans_16_italic 16 ../builtinFonts/source/NotoSans/NotoSans-Italic.ttf --2bit --compress --frequency-corpus ../../../test/hyphenation_eval/resources/english_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/french_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/german_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/italian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/russian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/spanish_hyphenation_tests.txt
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t notosans_16_italicBitmaps[36651] = {
-    0xAD, 0x5A, 0xBD, 0xAF, 0xDD, 0xE6, 0x79, 0x7F, 0x48, 0x46, 0x62, 0x00, 0x0E, 0xF4, 0xE0, 0x34,
-    0x45, 0x84, 0x82, 0x4B, 0x5B, 0x34, 0x01, 0x2A, 0xFE, 0x03, 0xB9, 0xE7, 0xA5, 0x65, 0xA0, 0x1A,
-    0x3C, 0x44, 0x05, 0x74, 0x13, 0x14, 0x1A, 0xB2, 0x74, 0x68, 0x3D, 0xF4, 0x2E, 0x19, 0x3A, 0xDC,
-    0x7B, 0x48, 0xC3, 0x40, 0x3D, 0x78, 0xA8, 0x97, 0x3A, 0x63, 0x32, 0xB8, 0xA8, 0x7B, 0x34, 0x68,
-    0xE9, 0x60, 0xA0, 0x87, 0x97, 0x34, 0x3C, 0x68, 0xF0, 0x60, 0x3A, 0x6E, 0x9A, 0xA1, 0x83, 0x88,
-    0xD8, 0x2E, 0x10, 0x75, 0x30, 0x1D, 0xD3, 0x15, 0x25, 0xF1, 0x23, 0xBF, 0xDF, 0xF3, 0x92, 0xE7,
-    0xDC, 0x2B, 0x5D, 0x39, 0x69, 0xD0, 0xA3, 0x7B, 0x78, 0xCE, 0x21, 0xDF, 0x8F, 0xE7, 0xF3, 0xF7,
-    0x7C, 0xBC, 0x92, 0xA8, 0x74, 0x7B, 0x31, 0x99, 0xD7, 0x8A, 0x11, 0xBF, 0x91, 0x53, 0x09, 0x2A,
-    0xE9, 0x25, 0x2C, 0xA5, 0x93, 0x28, 0x71, 0x1B, 0xDC, 0xF5, 0x6A, 0x39, 0x10, 0xBF, 0x94, 0xE7,
-    0x45, 0x5F, 0x51, 0xE2, 0xF5, 0x92, 0x96, 0x98, 0xF0, 0x35, 0x91, 0xF0, 0x95, 0x76, 0x1D, 0xFC,
-    0xAC, 0x35, 0x41, 0xD9, 0x1B, 0xAF, 0x6A, 0x43, 0xAF, 0x3C, 0x0E, 0x9D, 0xFA, 0x47, 0x7E, 0x22,
-    0x98, 0xF3, 0x6F, 0x18, 0x2C, 0xDF, 0x15, 0x09, 0xCA, 0x48, 0xC4, 0xAB, 0x82, 0x4C, 0xA4, 0xF1,
-    0x2A, 0x91, 0x63, 0xA7, 0x11, 0x59, 0xC9, 0x56, 0xBE, 0x73, 0xE7, 0x7E, 0xB1, 0x09, 0x27, 0xBC,
-    0x5E, 0xF9, 0xC1, 0x97, 0x3F, 0xFC, 0xF9, 0x0D, 0x69, 0xB1, 0x17, 0x66, 0xB4, 0x9C, 0x78, 0x8C,
-    0xD5, 0xB3, 0xAB, 0x9C, 0x18, 0x66, 0x1E, 0xC7, 0x34, 0xBC, 0xF4, 0x58, 0xB7, 0xC3, 0x13, 0x7C,
-    0x80, 0x26, 0xAE, 0x5B, 0x73, 0xDD, 0x76, 0xB7, 0xEE, 0x55, 0xAC, 0x8B, 0x97, 0x23, 0x9C, 0x89,
-    0x0B, 0x6E, 0x39, 0x39, 0x68, 0x98, 0x46, 0x89, 0xA6, 0xA9, 0x0C, 0x3F, 0xFA, 0xB0, 0x0E, 0xAA,
-    0x46, 0xBC, 0x06, 0xEB, 0x77, 0x58, 0xDE, 0x04, 0x89, 0x04, 0x1F, 0x97, 0x22, 0x13, 0x46, 0x86,
-    0x13, 0x08, 0x4F, 0xB9, 0xFE, 0x94, 0x89, 0xF7, 0x1E, 0xEE, 0x34, 0x27, 0x22, 0x7F, 0x1F, 0x25,
-    0x72, 0x35, 0xA8, 0x92, 0xF0, 0x7A, 0xB3, 0x7A, 0xF1, 0xBF, 0x5A, 0x10, 0xDC, 0x3A, 0xC5, 0x04,
-    0x4A, 0xD7, 0x42, 0x4A, 0xB0, 0x11, 0xA6, 0x73, 0xEF, 0xF9, 0x95, 0x56, 0xE2, 0xD6, 0x2E, 0xD6,
-    0x0B, 0x4A, 0xBF, 0xA6, 0x18, 0xC3, 0x6C, 0x0B, 0x7E, 0x23, 0x50, 0xB6, 0x25, 0x7D, 0x18, 0x7A,
-    0x20, 0xEF, 0x80, 0x3A, 0xB0, 0x12, 0x66, 0x60, 0xB4, 0x8D, 0x95, 0xF8, 0xE3, 0x6F, 0x25, 0xC7,
-    0x5E, 0xDD, 0x4E, 0xCD, 0x81, 0xFF, 0xDE, 0xC7, 0x8F, 0x3A, 0x73, 0xF4, 0xFA, 0xDD, 0x6A, 0x1B,
-    0x8D, 0x51, 0x98, 0x1D, 0x5F, 0xFE, 0xE4, 0x40, 0x25, 0xD2, 0xC5, 0xB8, 0xBA, 0x0D, 0x85, 0xE7,
-    0x97, 0x58, 0x44, 0xC2, 0xE4, 0x00, 0xE2, 0x5A, 0xC9, 0x01, 0x16, 0xDD, 0xCA, 0x81, 0x57, 0xE3,
-    0x13, 0xDA, 0xC0, 0xE2, 0xD1, 0x84, 0x7D, 0x25, 0x18, 0x94, 0xA4, 0x1B, 0x0B, 0x6D, 0x31, 0x7F,
-    0xA7, 0x13, 0x24, 0x93, 0xFE, 0x43, 0x0F, 0xEE, 0x93, 0x38, 0x81, 0xB2, 0xFD, 0x0A, 0x72, 0x74,
-    0x20, 0xF6, 0x4E, 0x78, 0x13, 0x56, 0x20, 0xC1, 0xBB, 0x23, 0x98, 0x9A, 0x38, 0xDC, 0x74, 0x9C,
-    0x88, 0xA7, 0x52, 0x4C, 0xE2, 0x24, 0xC5, 0x4B, 0xB5, 0xD7, 0x9C, 0x4A, 0xEF, 0x74, 0xA9, 0x44,
-    0x65, 0x1F, 0x27, 0x6E, 0x97, 0xC3, 0x5E, 0xCC, 0xA9, 0x07, 0xB1, 0x4E, 0x5C, 0x60, 0x92, 0x38,
-    0x93, 0xA9, 0xF6, 0x1E, 0x5E, 0x1E, 0x07, 0xCC, 0x19, 0xA2, 0xD2, 0x9F, 0x3A, 0x98, 0xD9, 0xA5,
-    0x84, 0x02, 0x7B, 0xED, 0x97, 0xED, 0xD6, 0x84, 0x2F, 0x96, 0xCD, 0x8F, 0xF0, 0xEB, 0x1D, 0x70,
-    0x43, 0x93, 0x8B, 0x32, 0x6C, 0x2B, 0xB9, 0x38, 0x1D, 0x54, 0x23, 0x7E, 0x4D, 0x0B, 0xC4, 0x1F,
-    0x24, 0x6F, 0x48, 0x10, 0x38, 0x94, 0x13, 0x3E, 0xA7, 0x76, 0xCF, 0xFE, 0x9D, 0xE8, 0xDF, 0x4A,
-    0xC7, 0x40, 0x8A, 0x21, 0x94, 0x99, 0x81, 0x46, 0xD5, 0x09, 0x8C, 0x09, 0x8B, 0x8B, 0xB2, 0x45,
-    0xB2, 0x76, 0x93, 0xF2, 0xE5, 0x6F, 0xAB, 0xF7, 0xF5, 0x0F, 0x1B, 0xBB, 0xED, 0x99, 0xBD, 0x33,
-    0x2E, 0xB7, 0xE6, 0x13, 0xDC, 0xE6, 0x3D, 0x25, 0x50, 0x7D, 0x80, 0x5C, 0x60, 0x0E, 0x57, 0x85,
-    0xB4, 0xFF, 0x98, 0x12, 0x7F, 0xA1, 0x96, 0xF4, 0x7F, 0x4B, 0xB9, 0x3C, 0xFD, 0xCF, 0x08, 0xDB,
-    0x19, 0x25, 0xAE, 0xFF, 0x4A, 0x7A, 0x5A, 0x59, 0x2B, 0x61, 0xB5, 0xC5, 0xE4, 0x13, 0x71, 0x39,
-    0x5F, 0xBE, 0x6D, 0xCD, 0xF2, 0x19, 0xEF, 0x02, 0x16, 0xCE, 0xF7, 0xE1, 0x0F, 0x3E, 0x3D, 0x7C,
-    0xE6, 0x38, 0x70, 0xE7, 0xF4, 0x6E, 0xE7, 0x35, 0x7E, 0x1D, 0x96, 0x61, 0x16, 0xC3, 0x8C, 0x9E,
-    0x97, 0x4B, 0x87, 0xD7, 0xA6, 0xDE, 0x4C, 0xEF, 0x1E, 0xDE, 0x14, 0xFF, 0xA3, 0x61, 0x32, 0x2F,
-    0x58, 0x57, 0x15, 0xF2, 0x42, 0xF9, 0x92, 0x33, 0x72, 0x62, 0x29, 0xE7, 0x9B, 0xC6, 0x4B, 0x8A,
-    0x20, 0xF9, 0xDF, 0x6F, 0x90, 0xD3, 0xEF, 0x2D, 0xBE, 0xA3, 0x6D, 0x94, 0x32, 0xFD, 0xB8, 0x93,
-    0x02, 0x13, 0x52, 0x0C, 0x34, 0x89, 0xD3, 0x45, 0x30, 0x0B, 0x4C, 0x09, 0xE1, 0x49, 0xDE, 0xE7,
-    0x94, 0x31, 0xD6, 0x5B, 0xC3, 0xE2, 0xA2, 0x7F, 0x2C, 0x25, 0xF8, 0x88, 0xF2, 0xA1, 0xEC, 0xB1,
-    0xC1, 0x1A, 0x8B, 0xC7, 0x2F, 0x36, 0xD8, 0xA3, 0x97, 0xA0, 0x36, 0x09, 0x99, 0xF3, 0x3A, 0x19,
-    0xAF, 0xF7, 0xB0, 0xE3, 0x0E, 0x76, 0xD8, 0x2A, 0xDF, 0x42, 0x35, 0xC5, 0xB5, 0x3F, 0x25, 0x53,
-    0x1F, 0x3F, 0x68, 0xC6, 0xE8, 0x95, 0xEA, 0x84, 0x3A, 0xA6, 0xF9, 0xF1, 0x11, 0xF6, 0x32, 0x24,
-    0x1C, 0x9A, 0x07, 0xC5, 0x39, 0x49, 0xC5, 0xA3, 0x35, 0xC9, 0x0D, 0x4A, 0xFB, 0xC8, 0xBE, 0xAE,
-    0xC0, 0xBF, 0x01, 0x07, 0xE2, 0x8F, 0xB7, 0x7A, 0xF9, 0x73, 0x89, 0x88, 0x14, 0x30, 0x7A, 0x2A,
-    0xDA, 0x7E, 0x21, 0xA3, 0x3A, 0x1A, 0xD4, 0x12, 0x17, 0x2D, 0xB7, 0x29, 0x6F, 0x50, 0x0C, 0x14,
-    0x01, 0x6F, 0x4C, 0x94, 0x0F, 0x65, 0x83, 0x79, 0x1E, 0x69, 0x54, 0xF7, 0xBA, 0xBF, 0x79, 0x3B,
-    0x80, 0x16, 0x4B, 0xC5, 0xAB, 0x19, 0x35, 0xB1, 0x61, 0xBC, 0xDF, 0x30, 0xE4, 0xF2, 0xF9, 0xB2,
-    0x0F, 0xBF, 0x50, 0xBA, 0x6E, 0x67, 0x77, 0x7F, 0x19, 0x83, 0x09, 0x45, 0xD6, 0xFD, 0x02, 0x2A,
-    0x04, 0x92, 0xB4, 0xE3, 0x94, 0x42, 0xAA, 0x25, 0xE0, 0x97, 0xDE, 0x21, 0x41, 0xEB, 0x1B, 0x47,
-    0x8D, 0xCF, 0xBD, 0xAE, 0x70, 0x82, 0x63, 0x9D, 0x9D, 0x5B, 0x78, 0x4A, 0x23, 0xA6, 0xC6, 0xF8,
-    0x12, 0xDC, 0x83, 0x67, 0x74, 0x58, 0x2C, 0xA5, 0xA3, 0x50, 0x25, 0x0D, 0x24, 0x32, 0x60, 0xC1,
-    0x38, 0xC9, 0xB1, 0x5C, 0x50, 0x3A, 0x74, 0x7F, 0x03, 0x6B, 0x0D, 0xF1, 0x15, 0xB2, 0x8B, 0x93,
-    0x14, 0x2C, 0x3C, 0xC6, 0x7B, 0x7C, 0x79, 0x73, 0xFB, 0x51, 0xA6, 0xBE, 0x46, 0x49, 0x5A, 0xD1,
-    0x90, 0x64, 0x47, 0xC1, 0x72, 0xCA, 0xB0, 0x7D, 0x0D, 0x94, 0x6E, 0xE9, 0x14, 0x3A, 0x2A, 0x9E,
-    0x07, 0x10, 0xD1, 0x15, 0x1B, 0x87, 0xBF, 0x85, 0xA8, 0xA0, 0x4B, 0x8C, 0x2E, 0x67, 0xA6, 0x8A,
-    0x65, 0x4C, 0x33, 0xAF, 0x68, 0x66, 0x4E, 0xC3, 0x0A, 0x7E, 0xDC, 0xAC, 0x92, 0xA3, 0x06, 0xA3,
-    0x1B, 0x98, 0x16, 0x78, 0xB9, 0xB9, 0xB3, 0xB6, 0x2B, 0x58, 0xC0, 0xE0, 0x76, 0xFA, 0xE9, 0x5F,
-    0x4B, 0x9A, 0x11, 0xC4, 0xEC, 0x7B, 0x31, 0x52, 0x8A, 0xC8, 0x6D, 0x8F, 0x6A, 0xE9, 0x21, 0x70,
-    0x33, 0x1C, 0x35, 0x51, 0x2B, 0x03, 0x54, 0x16, 0xBF, 0xDA, 0xE1, 0x19, 0xF6, 0xE9, 0xCE, 0x59,
-    0x5C, 0x8E, 0x9B, 0x51, 0xE9, 0x35, 0xDE, 0x10, 0x74, 0x4A, 0xA1, 0x4B, 0x6B, 0x23, 0x56, 0x31,
-    0x34, 0xBD, 0x8A, 0xF7, 0x87, 0xD3, 0xA4, 0x06, 0xD8, 0x3D, 0xE1, 0x15, 0xF1, 0xEC, 0x5F, 0x14,
-    0x35, 0x37, 0x55, 0xCF, 0x58, 0x06, 0xE5, 0xB3, 0xBD, 0x5C, 0xE4, 0x3E, 0xDE, 0xD9, 0xD5, 0x16,
-    0x03, 0x49, 0x14, 0x39, 0xBC, 0xE1, 0x56, 0x2B, 0x04, 0x56, 0x8C, 0xEF, 0x35, 0x12, 0xCF, 0x5F,
-    0xA2, 0x2C, 0xA8, 0x61, 0x88, 0xE6, 0x1A, 0x01, 0x76, 0x64, 0x44, 0xE3, 0x1B, 0x1C, 0x75, 0x61,
-    0x23, 0x03, 0xAC, 0x10, 0x22, 0xE8, 0xD5, 0xE0, 0x41, 0x5E, 0xAE, 0x28, 0x46, 0xF8, 0x62, 0x60,
-    0xCF, 0xE2, 0x3A, 0x6A, 0x84, 0x06, 0xE2, 0x72, 0xE6, 0x4E, 0x94, 0x4E, 0xD1, 0xE2, 0xCE, 0x94,
-    0x79, 0xE3, 0xAD, 0x16, 0xE6, 0x9C, 0xEA, 0x76, 0x39, 0x64, 0x47, 0x28, 0x9E, 0xE5, 0x13, 0x54,
-    0x70, 0x27, 0xDC, 0x70, 0xFA, 0xA0, 0x76, 0x26, 0x67, 0xFC, 0x8B, 0xA9, 0x8C, 0xA7, 0x07, 0xF8,
-    0xFA, 0xB3, 0xF6, 0x49, 0x8C, 0x28, 0x2D, 0x93, 0x51, 0x7D, 0xF9, 0x2F, 0x53, 0x0C, 0x80, 0xD2,
-    0x52, 0x18, 0xB2, 0xDD, 0xED, 0x39, 0x19, 0x5C, 0xFC, 0x53, 0xA6, 0x9F, 0x7A, 0x45, 0x89, 0x29,
-    0xD3, 0xD2, 0x24, 0x5F, 0xD3, 0xB8, 0x3D, 0x48, 0x5C, 0xB9, 0x83, 0xCA, 0xEC, 0x19, 0x2F, 0x68,
-    0x0B, 0x9A, 0xB2, 0x99, 0x0A, 0xD2, 0x91, 0x1A, 0x31, 0xD1, 0xD9, 0x3D, 0x74, 0x67, 0xFF, 0x8C,
-    0x89, 0x49, 0x88, 0x00, 0x90, 0x2B, 0x83, 0x20, 0xE3, 0x17, 0x02, 0x33, 0xD6, 0x86, 0xAE, 0x18,
-    0xE6, 0x83, 0x71, 0x17, 0x0E, 0x09, 0xE4, 0x45, 0x3D, 0xBB, 0xB4, 0xBF, 0x47, 0x35, 0xA8, 0x9D,
-    0xEF, 0x27, 0xB7, 0x7F, 0x79, 0xB3, 0xF9, 0xD7, 0xF9, 0x19, 0xD7, 0x90, 0x3F, 0x9B, 0xBD, 0xD1,
-    0x21, 0xB7, 0x3E, 0x6F, 0x45, 0x64, 0xF3, 0x88, 0x0E, 0x5A, 0xE0, 0x96, 0x3B, 0x5A, 0xD8, 0x70,
-    0x8A, 0x4A, 0xB7, 0x8E, 0x09, 0x68, 0xB5, 0x7E, 0x75, 0x1F, 0xE2, 0xD1, 0x4F, 0xCF, 0xF1, 0x36,
-    0x25, 0xC0, 0x09, 0x67, 0xBC, 0xD5, 0x7D, 0x5D, 0x25, 0xDA, 0x5B, 0xA1, 0xF6, 0x6A, 0x44, 0xB4,
-    0x1D, 0x2C, 0x06, 0xA3, 0x8F, 0x6B, 0xBA, 0x90, 0xA3, 0xD1, 0x9A, 0xC9, 0x19, 0x43, 0xD9, 0x5E,
-    0x06, 0x0C, 0xE5, 0x80, 0x25, 0xBF, 0x53, 0x13, 0x54, 0xE0, 0x04, 0xD9, 0xBF, 0xE2, 0xF5, 0x68,
-    0x22, 0x95, 0xE1, 0xF8, 0x26, 0x88, 0x71, 0xB0, 0x16, 0xA0, 0x2F, 0x56, 0xEB, 0x54, 0xC3, 0x8D,
-    0x12, 0xEC, 0xF2, 0x1C, 0xD6, 0xEC, 0xC0, 0x7D, 0x72, 0x1C, 0x94, 0xC0, 0x31, 0x69, 0x57, 0x00,
-    0xA5, 0xD6, 0xFB, 0xB0, 0x09, 0x2A, 0xBF, 0x0C, 0x5F, 0x2A, 0x57, 0x70, 0xEE, 0x83, 0x15, 0x9C,
-    0xBA, 0x93, 0xA6, 0x0D, 0x91, 0x6B, 0xF8, 0xEF, 0x55, 0x4C, 0x6F, 0xE2, 0x30, 0x21, 0x80, 0xB4,
-    0xC8, 0x42, 0xFC, 0x26, 0x28, 0xF1, 0x28, 0x2D, 0x4F, 0xBC, 0x3A, 0xFA, 0xEC, 0x83, 0xCF, 0x10,
-    0xA9, 0xE2, 0x3E, 0x82, 0x52, 0x93, 0x4B, 0xF4, 0x2C, 0x63, 0xC9, 0x5C, 0xDB, 0x8F, 0xC2, 0x92,
-    0x5E, 0xFC, 0xC7, 0x1F, 0xF4, 0x56, 0xEA, 0x8D, 0x3A, 0xF9, 0x27, 0x67, 0xC5, 0xA2, 0x33, 0x0A,
-    0x32, 0x42, 0xDD, 0x79, 0x2A, 0xE9, 0x7B, 0xA4, 0xFB, 0x03, 0x5A, 0x1C, 0xC2, 0x09, 0xB3, 0x1E,
-    0xAC, 0xC8, 0x4B, 0x0F, 0xC3, 0x70, 0x5B, 0xE6, 0x34, 0x88, 0x22, 0xB0, 0x12, 0x8F, 0xBE, 0x40,
-    0x38, 0xE3, 0xCA, 0xBA, 0xFC, 0xB8, 0xB9, 0xDD, 0x38, 0x8C, 0xEC, 0xB8, 0x8B, 0x91, 0x35, 0x9C,
-    0x11, 0x42, 0x76, 0x3A, 0x4A, 0x82, 0xE1, 0x48, 0xFA, 0x53, 0x35, 0xEE, 0x98, 0x44, 0x50, 0xCB,
-    0x1E, 0x2F, 0x51, 0x06, 0x03, 0x41, 0x50, 0xE9, 0x18, 0x4E, 0x6A, 0xFA, 0x47, 0x46, 0x47, 0x81,
-    0x4D, 0x83, 0x5D, 0x18, 0x7B, 0x62, 0xEE, 0x17, 0x74, 0xB3, 0x87, 0x1C, 0xDE, 0x2D, 0xC3, 0x19,
-    0xA9, 0x41, 0x89, 0xE6, 0x33, 0x60, 0xD8, 0x38, 0x54, 0x1B, 0x83, 0x62, 0x6D, 0x18, 0x3F, 0xC6,
-    0x4D, 0x41, 0xEC, 0x9E, 0x48, 0xDD, 0xCE, 0xE2, 0x63, 0xF8, 0x8E, 0x4B, 0x7F, 0x8D, 0xC6, 0xDB,
-    0x2D, 0xCD, 0xF6, 0x39, 0xAA, 0x1D, 0x3B, 0x8B, 0x0D, 0x46, 0x36, 0x7E, 0x68, 0x4C, 0x20, 0xC9,
-    0x56, 0x3A, 0x7A, 0x21, 0xE2, 0x68, 0x00, 0x7B, 0xF2, 0x92, 0xEE, 0x86, 0x18, 0x4E, 0x8B, 0x68,
-    0x9C, 0xC1, 0x78, 0xF8, 0x0E, 0xF7, 0xA1, 0x99, 0xA8, 0xB8, 0x6F, 0xEA, 0xDE, 0x6F, 0x29, 0xF2,
-    0x55, 0x96, 0x69, 0x70, 0x97, 0xD6, 0x64, 0xA3, 0x27, 0xDC, 0x19, 0x84, 0x06, 0x50, 0x40, 0x3B,
-    0xEC, 0xE9, 0xCB, 0x86, 0x30, 0x17, 0x96, 0x46, 0x2C, 0x87, 0x0A, 0x40, 0x60, 0xB1, 0x23, 0x71,
-    0xCC, 0xBA, 0xEB, 0xE5, 0x89, 0xDB, 0x53, 0xCA, 0x03, 0x0D, 0x73, 0x64, 0x9A, 0x07, 0x60, 0x46,
-    0xB6, 0x24, 0xE1, 0xFD, 0x3B, 0x23, 0x1C, 0x01, 0x61, 0x0B, 0x64, 0xBC, 0xA1, 0xBB, 0x4F, 0x95,
-    0x47, 0xCE, 0x0D, 0xC2, 0x84, 0xC6, 0xBA, 0xFC, 0xA2, 0x90, 0xA3, 0xD0, 0xEB, 0x8D, 0x9B, 0xB7,
-    0x38, 0x2E, 0xD1, 0xC0, 0xB3, 0x3E, 0x1B, 0xB5, 0x77, 0xE3, 0x98, 0x02, 0x69, 0x46, 0x43, 0xD6,
-    0xBD, 0x47, 0x9B, 0xB7, 0x69, 0x00, 0xB4, 0xEA, 0xEE, 0xFF, 0xB8, 0x17, 0xA5, 0x6E, 0x36, 0x1B,
-    0xBB, 0x17, 0xD6, 0xB8, 0x68, 0xAF, 0xEC, 0xEC, 0x5E, 0xCD, 0x12, 0xA7, 0xAB, 0xBD, 0x15, 0x07,
-    0xB0, 0x8D, 0xD9, 0x0C, 0x1F, 0xDD, 0xEE, 0xA8, 0xD8, 0x3F, 0xB4, 0xEA, 0xB0, 0x3A, 0x29, 0x17,
-    0xCD, 0xAA, 0x8E, 0x75, 0x29, 0x1B, 0x21, 0x00, 0xBF, 0x9B, 0xB7, 0xF0, 0x78, 0x1A, 0x81, 0x33,
-    0x66, 0xBA, 0xC6, 0xA0, 0x5B, 0x9E, 0x72, 0x13, 0xB5, 0x58, 0x0E, 0x5F, 0x73, 0x64, 0x0C, 0x20,
-    0x65, 0x3A, 0xAF, 0x49, 0x74, 0xF1, 0xE9, 0x2D, 0x64, 0x44, 0x94, 0x2D, 0xB6, 0x24, 0xCE, 0x7C,
-    0x43, 0x2C, 0x33, 0x5E, 0xED, 0xE9, 0x04, 0x43, 0xE2, 0xC8, 0x77, 0xCF, 0x88, 0x1D, 0x96, 0xA0,
-    0x54, 0x33, 0x00, 0x56, 0x2C, 0xD0, 0x58, 0x6B, 0x15, 0xCC, 0x09, 0x8D, 0x3B, 0x6E, 0x36, 0x23,
-    0xE5, 0xA4, 0x12, 0x83, 0xC8, 0xD6, 0xF3, 0x04, 0x0D, 0x4D, 0xE0, 0x5C, 0x27, 0x88, 0x4E, 0x50,
-    0x9C, 0x22, 0xF1, 0x2B, 0xC5, 0x26, 0xDD, 0x2C, 0xB7, 0x13, 0x7C, 0x9D, 0x40, 0xF3, 0xF6, 0xA8,
-    0xF2, 0x87, 0x96, 0x9C, 0xC6, 0x82, 0x58, 0xAD, 0x89, 0x43, 0xB0, 0xC3, 0x3C, 0x6E, 0xBF, 0x7F,
-    0x6C, 0x49, 0x16, 0xBB, 0xA5, 0xCA, 0xBC, 0x53, 0xE3, 0x47, 0x88, 0x09, 0x6C, 0x96, 0x95, 0xEF,
-    0xF3, 0x56, 0x4E, 0xA5, 0xA9, 0x91, 0x0A, 0x8D, 0xB7, 0x8D, 0x5D, 0x9F, 0xB3, 0xC3, 0x72, 0xFF,
-    0xA6, 0xC6, 0xA8, 0x5D, 0x33, 0x2B, 0x6D, 0x35, 0xEB, 0xEC, 0x89, 0xA5, 0x74, 0x99, 0x79, 0x29,
-    0x64, 0x7A, 0x7F, 0x92, 0x32, 0xFF, 0x48, 0xB4, 0x2E, 0xBA, 0x24, 0x36, 0xD7, 0x31, 0x9A, 0x83,
-    0x22, 0x6F, 0x15, 0xE6, 0xBD, 0x4C, 0x47, 0x72, 0x5E, 0x62, 0x5E, 0xE0, 0x1F, 0x64, 0x03, 0x17,
-    0xA7, 0x63, 0xB2, 0x98, 0xF3, 0x62, 0x98, 0xB9, 0x84, 0xAC, 0x22, 0x3D, 0x92, 0xEF, 0x8C, 0xA4,
-    0x25, 0xB7, 0xCC, 0xAA, 0x4F, 0x41, 0xDD, 0x90, 0x5D, 0x4B, 0x3E, 0x18, 0xD0, 0x6D, 0x8E, 0x0B,
-    0x90, 0xC6, 0x67, 0xAA, 0x05, 0x49, 0xE5, 0xDA, 0x00, 0x10, 0x2B, 0x2F, 0x98, 0x49, 0x52, 0xF3,
-    0xA7, 0x7F, 0x1B, 0xFB, 0xBB, 0x3E, 0xFF, 0x9B, 0xEE, 0xD8, 0xEE, 0x7E, 0xDF, 0xDF, 0xFC, 0x0B,
-    0x9C, 0x9D, 0xFE, 0xCE, 0xF8, 0x18, 0xC0, 0x25, 0x40, 0x58, 0x88, 0x0F, 0x1B, 0x48, 0x53, 0x92,
-    0xD5, 0xCA, 0x29, 0xC3, 0x0F, 0x92, 0x0D, 0x2C, 0xFD, 0x00, 0xE8, 0x8F, 0x72, 0xE9, 0x0B, 0xFD,
-    0xF0, 0x7F, 0x81, 0xE2, 0x11, 0x94, 0xDD, 0xAD, 0xDC, 0x06, 0xB8, 0x87, 0xF2, 0x13, 0x79, 0xFD,
-    0x8A, 0x98, 0x8B, 0x8A, 0x17, 0x1F, 0xF5, 0x56, 0xBA, 0x28, 0xF3, 0xAB, 0x63, 0xB7, 0x89, 0x93,
-    0x00, 0x31, 0xA1, 0xA2, 0xB8, 0x0E, 0x88, 0x1B, 0x61, 0x76, 0x80, 0xE8, 0x0F, 0x45, 0xAC, 0x0C,
-    0xD8, 0x8C, 0x93, 0xD5, 0x09, 0x48, 0x8A, 0xB9, 0x27, 0x33, 0xD1, 0xB8, 0xC1, 0x07, 0x42, 0x4B,
-    0x0D, 0xD2, 0x4F, 0xE0, 0x1F, 0xF8, 0x60, 0x31, 0x45, 0x7D, 0xD0, 0xF0, 0x3B, 0xE6, 0xDF, 0x7E,
-    0xE5, 0xD1, 0xC2, 0x93, 0x48, 0xCB, 0xB8, 0x82, 0x58, 0xEB, 0x3D, 0x60, 0xBD, 0x16, 0x22, 0x2A,
-    0x9C, 0xC8, 0x2A, 0x46, 0x81, 0xE0, 0xB4, 0x6B, 0x9A, 0x6B, 0xC9, 0x35, 0x8D, 0x1A, 0x76, 0xEF,
-    0xD5, 0x0C, 0x0C, 0x08, 0x4B, 0x8C, 0x79, 0x49, 0x8F, 0x75, 0x8D, 0xFA, 0xC5, 0x16, 0xB6, 0x9C,
-    0x39, 0x1D, 0x0D, 0xD6, 0xFB, 0x35, 0xCD, 0x38, 0xB8, 0x87, 0x89, 0x12, 0x9E, 0x6A, 0x21, 0xAA,
-    0x26, 0x9E, 0xAA, 0x1D, 0x4F, 0x14, 0xB4, 0xDB, 0xEF, 0xE3, 0xF6, 0x1B, 0x44, 0x51, 0xC0, 0x74,
-    0xF1, 0x2B, 0x10, 0x51, 0x64, 0x08, 0xAE, 0x29, 0x2A, 0x1D, 0xD5, 0x7D, 0x4B, 0x6A, 0x4F, 0xD5,
-    0xE2, 0xDE, 0xA7, 0xC6, 0xBF, 0xD0, 0xDC, 0x49, 0x33, 0x5E, 0xE2, 0x72, 0xC4, 0x48, 0xE6, 0x3F,
-    0x66, 0x06, 0xF2, 0x88, 0x40, 0x32, 0x10, 0xB1, 0x53, 0xCE, 0x89, 0xEF, 0xD2, 0xE4, 0x2A, 0x5A,
-    0x7C, 0x03, 0xD7, 0x0E, 0x1A, 0xB8, 0x76, 0xD8, 0xC2, 0xB5, 0x8F, 0xD4, 0xB5, 0x5B, 0x1B, 0x2A,
-    0x16, 0xD7, 0x9E, 0x7E, 0x4A, 0xCC, 0x26, 0x42, 0x20, 0x21, 0xAF, 0x91, 0x43, 0x69, 0x5A, 0xCF,
-    0x9A, 0xA8, 0xB7, 0x28, 0x4C, 0x64, 0xF6, 0x6B, 0x58, 0xFC, 0xC0, 0x70, 0x08, 0xF1, 0x47, 0xAD,
-    0x47, 0x80, 0x20, 0xDD, 0xC1, 0xA3, 0x7F, 0xFE, 0x4A, 0xEC, 0xBC, 0x08, 0xCF, 0xFE, 0xDF, 0x99,
-    0x36, 0xCA, 0xF4, 0x6B, 0x4F, 0x33, 0x1D, 0x28, 0xD3, 0xED, 0x39, 0xA6, 0xBF, 0xD9, 0xEE, 0x02,
-    0x5B, 0xA8, 0xDD, 0x17, 0xCD, 0xC6, 0xB4, 0x96, 0x73, 0xDF, 0xE6, 0xA0, 0x37, 0x76, 0xE2, 0x00,
-    0xBC, 0x3B, 0x2A, 0x8E, 0xE6, 0x99, 0xE2, 0x40, 0x02, 0x7D, 0x58, 0x34, 0x1A, 0xB9, 0x53, 0xEC,
-    0x11, 0x54, 0xB8, 0xBF, 0x24, 0xE0, 0x18, 0x77, 0xCA, 0x4C, 0x93, 0xF6, 0x60, 0x12, 0x63, 0x63,
-    0xBA, 0x86, 0xF3, 0x01, 0xEB, 0xF9, 0xCD, 0x52, 0x97, 0x54, 0x5A, 0xDD, 0x78, 0xD3, 0x6D, 0x96,
-    0xC1, 0x4E, 0xA2, 0x92, 0xEC, 0xE7, 0xC8, 0x60, 0xBF, 0x94, 0x4B, 0x06, 0x43, 0x5A, 0x43, 0x66,
-    0x9F, 0xCC, 0x53, 0x19, 0x62, 0x6D, 0x7A, 0xA3, 0x21, 0x3E, 0x2A, 0xCF, 0x0C, 0xF7, 0x3A, 0x87,
-    0x29, 0xD2, 0xFA, 0xB0, 0xA8, 0x7C, 0x32, 0x1F, 0x33, 0x74, 0x5D, 0xBA, 0x61, 0xD3, 0x53, 0x64,
-    0x73, 0xD3, 0x3D, 0xF6, 0xC6, 0x76, 0xB5, 0xC8, 0xAE, 0x96, 0x5A, 0x9F, 0x29, 0x50, 0x78, 0xD3,
-    0x99, 0x8B, 0xCB, 0xA7, 0x6F, 0xE6, 0xB3, 0x8A, 0x2F, 0xBC, 0xA9, 0x68, 0x9B, 0x29, 0x3E, 0x83,
-    0x0B, 0xB7, 0xA5, 0xFA, 0xB7, 0x16, 0xA6, 0x14, 0x87, 0xD7, 0xE7, 0x9E, 0xF4, 0xFB, 0x27, 0x99,
-    0x3E, 0xC1, 0x66, 0x78, 0x52, 0x9E, 0x7D, 0x12, 0x65, 0x8A, 0xE3, 0x1A, 0x26, 0x88, 0x42, 0x1A,
-    0x41, 0x58, 0xC0, 0xC0, 0xA5, 0xFC, 0xE1, 0xFB, 0x13, 0x5B, 0x09, 0xF4, 0x6B, 0x2D, 0x7E, 0x35,
-    0x77, 0xDD, 0x8A, 0x22, 0x8D, 0xC4, 0xEF, 0x73, 0x21, 0x2C, 0x19, 0xD4, 0x27, 0x36, 0xCD, 0x70,
-    0x3B, 0x2D, 0x74, 0xC2, 0x4C, 0xE8, 0x9F, 0x1E, 0xE1, 0x22, 0xCE, 0xF4, 0x23, 0x60, 0x74, 0x8A,
-    0xB5, 0xA9, 0x44, 0x9C, 0x6C, 0x15, 0xF2, 0x08, 0xAC, 0xAF, 0xB2, 0xF9, 0x48, 0x19, 0xF4, 0x60,
-    0xD3, 0x7B, 0xCC, 0x48, 0xA0, 0xF9, 0x79, 0x33, 0x67, 0xEB, 0x2A, 0xF8, 0x13, 0xDB, 0x50, 0x02,
-    0x8D, 0xC8, 0xDB, 0xA3, 0xBB, 0x35, 0x0D, 0x2C, 0xF8, 0xB0, 0x23, 0x32, 0x7A, 0x0D, 0x90, 0xE1,
-    0x33, 0x70, 0x05, 0x1C, 0x7A, 0x50, 0x11, 0x48, 0x08, 0x81, 0x6B, 0x00, 0xC3, 0xF1, 0x01, 0xE1,
-    0x45, 0x4C, 0x98, 0x30, 0x1E, 0x46, 0x2F, 0x56, 0x44, 0xC0, 0xB0, 0x64, 0x92, 0xD9, 0xFB, 0xD5,
-    0x8A, 0xB6, 0x83, 0xDF, 0x19, 0x4D, 0xAA, 0xF5, 0xC0, 0x01, 0xE1, 0x91, 0xA5, 0x68, 0xBF, 0x92,
-    0x15, 0x1B, 0x5D, 0xB1, 0x84, 0x60, 0x30, 0xF8, 0x20, 0x73, 0xBF, 0x40, 0xDD, 0xF2, 0xA0, 0x94,
-    0xBC, 0xD1, 0x12, 0x86, 0x16, 0x02, 0xF2, 0x82, 0x5E, 0x91, 0xD9, 0x85, 0x6C, 0xE0, 0xDA, 0xF4,
-    0x33, 0xDA, 0xBE, 0x4D, 0x1A, 0x32, 0xE2, 0xBB, 0xD1, 0x32, 0x58, 0xBB, 0x1D, 0x2A, 0x07, 0x86,
-    0xF0, 0x9E, 0x4A, 0xB0, 0xE1, 0x4E, 0x8D, 0xED, 0x25, 0x7A, 0xC7, 0x4A, 0x13, 0x6F, 0x4D, 0xB3,
-    0x1D, 0xAD, 0x6E, 0x3C, 0xF5, 0x24, 0x62, 0x3E, 0x96, 0xD7, 0x54, 0xE4, 0x27, 0xDA, 0xE4, 0x5A,
-    0xA9, 0x55, 0x68, 0x35, 0xCB, 0x60, 0x61, 0x63, 0x79, 0x3A, 0x87, 0x17, 0xB6, 0xEC, 0x12, 0x1B,
-    0x93, 0xA0, 0xBE, 0x48, 0x03, 0x36, 0x34, 0x15, 0xBD, 0x5E, 0xA9, 0x8C, 0xD4, 0xA9, 0x80, 0x04,
-    0x36, 0x19, 0x60, 0x3D, 0x87, 0x09, 0xB6, 0x40, 0x05, 0x25, 0x80, 0x59, 0xF1, 0x3F, 0xA2, 0x2A,
-    0x72, 0xEE, 0x09, 0xB9, 0x47, 0xDA, 0x24, 0xB8, 0x38, 0xEF, 0x12, 0xDB, 0x47, 0x38, 0x9F, 0xE3,
-    0x69, 0x79, 0x4E, 0x0F, 0x9F, 0x4A, 0x14, 0x9B, 0x93, 0x26, 0xB4, 0xCD, 0x92, 0x3C, 0x29, 0x47,
-    0xEA, 0x4C, 0x5A, 0xD7, 0xA8, 0x52, 0x6D, 0xC3, 0x6A, 0xD8, 0x21, 0x45, 0xF1, 0x44, 0x5E, 0x9C,
-    0xCC, 0xCD, 0x1C, 0x6D, 0xF1, 0x9C, 0xC9, 0xC6, 0xF4, 0x12, 0x3C, 0xDA, 0x6C, 0xB4, 0x0F, 0xCD,
-    0x0C, 0x9F, 0x2E, 0xE8, 0x41, 0x50, 0x29, 0xEC, 0xEC, 0x7E, 0x66, 0xCD, 0x5D, 0x13, 0x12, 0xA8,
-    0xD1, 0x9D, 0xF3, 0x95, 0x7D, 0x3A, 0xB3, 0xDD, 0xE5, 0x2B, 0x67, 0x1E, 0x6B, 0x0B, 0x5C, 0x18,
-    0x48, 0xCE, 0x3C, 0xCE, 0x34, 0x26, 0xC7, 0x5C, 0x1C, 0xEA, 0x1C, 0xC4, 0x39, 0x4C, 0xB0, 0x48,
-    0xCB, 0x38, 0x65, 0xD8, 0x37, 0xF6, 0xAB, 0x30, 0x59, 0x49, 0xEF, 0x36, 0x6C, 0xA9, 0x9F, 0x48,
-    0x67, 0x03, 0xD8, 0xD6, 0x69, 0xD9, 0x24, 0x5F, 0xC1, 0x65, 0x4A, 0x29, 0x7A, 0xB9, 0x7C, 0x27,
-    0x53, 0x01, 0x5E, 0x48, 0x4C, 0x7F, 0x11, 0x31, 0xB6, 0x97, 0xFD, 0x04, 0x31, 0xF6, 0x71, 0xBC,
-    0xA4, 0x5E, 0x1E, 0xEB, 0xF9, 0x5E, 0x49, 0xB2, 0x0D, 0xEF, 0x7E, 0x86, 0xB2, 0x35, 0x59, 0x39,
-    0xC0, 0x3C, 0x2C, 0x1F, 0x64, 0x48, 0x0A, 0x2A, 0x86, 0x5C, 0xAF, 0x92, 0x56, 0x1B, 0xDE, 0xEC,
-    0x50, 0x23, 0xEE, 0x8B, 0x1C, 0xB0, 0x1D, 0x7D, 0xB7, 0xD4, 0x86, 0xAC, 0x66, 0xC1, 0x1D, 0x5B,
-    0x2B, 0x87, 0x87, 0x87, 0xF2, 0x1D, 0x28, 0xA5, 0x77, 0x5A, 0xB7, 0x61, 0xED, 0xAE, 0x9A, 0xA9,
-    0xBF, 0x0B, 0xD4, 0xBE, 0x5B, 0x86, 0x5F, 0xAE, 0x7B, 0x28, 0x71, 0xCA, 0x0A, 0xF1, 0xDB, 0x19,
-    0xB0, 0x35, 0x91, 0x32, 0xDA, 0xA8, 0x35, 0xFB, 0x46, 0x87, 0xC3, 0xFA, 0xC2, 0x00, 0x59, 0x02,
-    0xB8, 0x1B, 0x6A, 0x7E, 0xF3, 0xEE, 0xD8, 0x38, 0xD3, 0x18, 0x43, 0x26, 0xD7, 0x6A, 0x5B, 0x19,
-    0x3B, 0xC9, 0x45, 0x89, 0xBD, 0xDB, 0x9C, 0x0B, 0x70, 0xC1, 0x20, 0xC1, 0x2F, 0x80, 0xB2, 0xC3,
-    0xC3, 0xB4, 0x44, 0xFE, 0x33, 0x10, 0x93, 0x6A, 0x84, 0x94, 0x35, 0x22, 0x3D, 0x36, 0x84, 0x7B,
-    0x79, 0xEC, 0x89, 0xD0, 0xBC, 0x21, 0x2E, 0x76, 0x4B, 0x9C, 0x1E, 0xF6, 0x61, 0x92, 0x01, 0x76,
-    0x17, 0x35, 0xCE, 0xE0, 0x3E, 0xAE, 0x8A, 0xEC, 0xAA, 0x99, 0x6A, 0xAF, 0x2A, 0xDA, 0x33, 0x9D,
-    0xF7, 0x68, 0xA2, 0xF5, 0x88, 0xF9, 0xF4, 0x6F, 0x68, 0x95, 0xB1, 0xD5, 0x04, 0xBB, 0x06, 0xC6,
-    0x52, 0x45, 0xAB, 0x65, 0x98, 0x58, 0x5B, 0xDA, 0x34, 0xD5, 0xAC, 0x58, 0xA7, 0x5D, 0x81, 0xA8,
-    0xD8, 0x05, 0xAD, 0x96, 0xC6, 0xDE, 0xCD, 0xC5, 0x1B, 0xB4, 0x43, 0x92, 0x2F, 0xA4, 0x93, 0x2B,
-    0x4D, 0x60, 0x61, 0x42, 0xC1, 0x08, 0x5D, 0x4C, 0x13, 0xD2, 0x2B, 0x08, 0x10, 0xC6, 0x6E, 0x6A,
-    0x78, 0x06, 0xEA, 0x53, 0x5B, 0xB5, 0x01, 0x84, 0x2A, 0x5B, 0xB4, 0xAD, 0xB5, 0xBD, 0xAD, 0x22,
-    0xC4, 0x62, 0x29, 0xB5, 0xDC, 0xB1, 0xC3, 0x5A, 0xA9, 0x0C, 0xC3, 0x66, 0xBD, 0xC5, 0xC6, 0xBF,
-    0x84, 0x1B, 0x0F, 0xD0, 0xDD, 0xBE, 0xBD, 0x10, 0x6B, 0x41, 0x2C, 0xE6, 0xE7, 0x03, 0x87, 0xC7,
-    0x19, 0x9B, 0x6A, 0xF1, 0xF5, 0xDA, 0xE9, 0xCD, 0x0B, 0x45, 0x85, 0xEA, 0xC0, 0x9B, 0xC6, 0x24,
-    0x7A, 0xE3, 0x22, 0x5E, 0x92, 0x18, 0xA8, 0xAE, 0xBC, 0x68, 0x4F, 0x82, 0x61, 0x8C, 0xA6, 0xAE,
-    0xE9, 0xB4, 0xB3, 0xE8, 0x46, 0x45, 0x42, 0x47, 0x50, 0x83, 0x75, 0x8A, 0xD1, 0x36, 0x0E, 0xE5,
-    0xD6, 0x97, 0x89, 0xD5, 0x99, 0x1E, 0xF1, 0xEC, 0x99, 0x5E, 0x2F, 0xC5, 0xD2, 0x6E, 0xB2, 0xAA,
-    0x59, 0x2B, 0xBA, 0x78, 0x51, 0xBA, 0x0E, 0x57, 0x89, 0x9D, 0x3C, 0x35, 0x5C, 0x8D, 0x81, 0xBF,
-    0xBE, 0x4D, 0x5C, 0x28, 0x9A, 0xB9, 0x65, 0xB3, 0x14, 0x6D, 0xA3, 0x47, 0x80, 0x89, 0x20, 0xCC,
-    0xBF, 0x7B, 0x86, 0x30, 0xA3, 0xDF, 0x41, 0x98, 0xAD, 0x0A, 0xF3, 0xE3, 0x9D, 0x30, 0x95, 0x8C,
-    0x1D, 0x0F, 0xA7, 0xF2, 0x75, 0x9A, 0x80, 0x79, 0x13, 0x82, 0xD0, 0x14, 0xE7, 0xCE, 0xC3, 0xDF,
-    0xC5, 0x66, 0x15, 0x14, 0x83, 0x91, 0x36, 0xDB, 0xC1, 0x66, 0x8F, 0x68, 0xB3, 0xB9, 0xB0, 0x38,
-    0x85, 0xCD, 0xE6, 0x6E, 0x6F, 0x6B, 0x8F, 0xA5, 0x2D, 0xE8, 0x74, 0xB0, 0xD9, 0x38, 0xD9, 0xCE,
-    0xD9, 0x8F, 0xF4, 0x36, 0x74, 0x9F, 0xB8, 0x9A, 0xEE, 0xC8, 0x3C, 0x4E, 0x2E, 0xE3, 0xB9, 0xC3,
-    0x83, 0xB6, 0x5D, 0x33, 0x29, 0xD7, 0xFA, 0xC6, 0x63, 0x1A, 0x6E, 0xBF, 0xFA, 0xF5, 0xEE, 0x2E,
-    0x12, 0x4D, 0x3A, 0xBA, 0x8A, 0xDD, 0xC9, 0x6C, 0x29, 0xD7, 0xC8, 0x6E, 0xF6, 0xAE, 0x1F, 0x75,
-    0xA6, 0x94, 0x9B, 0xD1, 0xA8, 0x7A, 0x06, 0x1A, 0xED, 0x2B, 0xBD, 0x73, 0xD0, 0x48, 0x9D, 0xD9,
-    0x3A, 0xF1, 0x4F, 0x07, 0xED, 0x00, 0x19, 0xE2, 0xF2, 0xA5, 0xE4, 0xD9, 0xE5, 0xFA, 0x3E, 0x6D,
-    0x8D, 0x90, 0x0D, 0x80, 0xAA, 0xDE, 0xA1, 0x44, 0x00, 0xF9, 0x3C, 0x99, 0x88, 0xAE, 0x37, 0xE2,
-    0x7E, 0xCE, 0x0E, 0x1A, 0x37, 0x65, 0x34, 0x64, 0xBB, 0x32, 0xE8, 0x70, 0x27, 0x0F, 0x6A, 0xEB,
-    0x20, 0x3D, 0x36, 0x65, 0x30, 0xD7, 0x08, 0x66, 0x6C, 0xE7, 0x83, 0x75, 0x5C, 0xA2, 0x89, 0x21,
-    0xB5, 0x3B, 0x9F, 0x91, 0x36, 0xD8, 0xE4, 0xDC, 0xC9, 0x69, 0x7B, 0xE6, 0xEE, 0x56, 0xB4, 0x87,
-    0x1B, 0x65, 0xCB, 0xDD, 0xE5, 0x75, 0x8C, 0x78, 0x8E, 0x00, 0xBF, 0x4D, 0x27, 0x4F, 0xF5, 0x97,
-    0x7E, 0xEF, 0xCD, 0x5E, 0xA6, 0x32, 0xCC, 0x15, 0x78, 0x90, 0xE8, 0xE7, 0xC8, 0x5A, 0x51, 0x71,
-    0x6E, 0xA1, 0x49, 0x50, 0xCC, 0x66, 0xEE, 0x1C, 0x44, 0x63, 0x54, 0x99, 0x44, 0x3C, 0xDB, 0xE8,
-    0xC2, 0x07, 0x42, 0x02, 0x2D, 0x8E, 0x8A, 0xCD, 0xED, 0xC7, 0xAC, 0xDD, 0x7E, 0x49, 0x65, 0x19,
-    0x2A, 0x9C, 0x4E, 0xF9, 0x02, 0x1D, 0x0C, 0x58, 0x00, 0x27, 0xBF, 0x9C, 0x74, 0xFF, 0x32, 0xBC,
-    0xF7, 0x9F, 0xD8, 0xB3, 0x0A, 0x2B, 0xC4, 0xE1, 0x53, 0xE4, 0x17, 0x41, 0x85, 0xD4, 0x7B, 0xC0,
-    0x86, 0x1C, 0xEF, 0xB0, 0xC5, 0x10, 0x67, 0xA7, 0xCC, 0x7A, 0xCE, 0xE4, 0xCF, 0x29, 0x8F, 0x5C,
-    0x6C, 0xFE, 0xDC, 0xCE, 0xF2, 0x9A, 0xF5, 0xAD, 0xED, 0x4D, 0xA6, 0x73, 0x3F, 0x6C, 0x00, 0x77,
-    0xA7, 0x5A, 0xB6, 0x72, 0x52, 0x6E, 0xFB, 0x6B, 0x86, 0xDD, 0x30, 0x64, 0x55, 0xDE, 0xE7, 0x9D,
-    0x3D, 0x14, 0xCA, 0x99, 0x4C, 0x90, 0xAD, 0x8C, 0x99, 0x44, 0xF4, 0xC9, 0x51, 0xE5, 0xB2, 0x03,
-    0xC5, 0x53, 0x13, 0x1E, 0x33, 0x2F, 0xD2, 0x1A, 0xA0, 0x30, 0x00, 0x48, 0x78, 0xEF, 0xC7, 0x2C,
-    0x4D, 0xB1, 0x29, 0xD1, 0xD9, 0xA7, 0x50, 0x62, 0x72, 0x8F, 0x80, 0xD9, 0x29, 0x3C, 0xF3, 0xB0,
-    0x2E, 0x39, 0xB1, 0xEA, 0xF3, 0x1B, 0xC5, 0x67, 0x94, 0xE5, 0x3D, 0x92, 0x9D, 0xA8, 0x0A, 0x3E,
-    0xBB, 0x86, 0x2A, 0x17, 0x00, 0x8D, 0x4C, 0x12, 0x76, 0xD4, 0x5C, 0xFA, 0x2A, 0x20, 0x3D, 0x5F,
-    0xEE, 0x3C, 0x3B, 0x2C, 0xF5, 0x36, 0x2C, 0xA5, 0xBF, 0x3D, 0x2C, 0x3D, 0x62, 0x58, 0x82, 0x25,
-    0x4D, 0xD7, 0xEB, 0x19, 0x04, 0xBE, 0xAA, 0xE1, 0x34, 0x8B, 0xB3, 0x49, 0xCB, 0xE0, 0x2E, 0x00,
-    0x77, 0xFD, 0x96, 0xB0, 0x2F, 0xD7, 0xDB, 0x2A, 0xA7, 0xB0, 0x69, 0x0E, 0xA7, 0xAD, 0x2D, 0xB5,
-    0x5C, 0x6A, 0x89, 0x27, 0xB5, 0x5D, 0x67, 0x2B, 0x7B, 0x83, 0x73, 0xA7, 0x16, 0x40, 0x56, 0x9B,
-    0x7F, 0xDA, 0x32, 0xF0, 0x6C, 0x2D, 0x73, 0xA9, 0x2D, 0x46, 0x58, 0x8B, 0x68, 0xA2, 0x39, 0x2F,
-    0x3C, 0x37, 0x65, 0x9A, 0xD6, 0x1D, 0x78, 0xBE, 0xC3, 0x23, 0x63, 0xBA, 0xDA, 0x1F, 0xF1, 0x7C,
-    0xDE, 0x9E, 0x9B, 0x5E, 0x99, 0xFA, 0x74, 0xEA, 0xBF, 0xF9, 0xE5, 0x4D, 0xED, 0x6F, 0x8A, 0xB6,
-    0x5A, 0x97, 0x63, 0xDB, 0x8C, 0xFE, 0x1C, 0x2F, 0x87, 0xB7, 0xFC, 0x7B, 0x01, 0x61, 0x4C, 0xCF,
-    0x2C, 0x6E, 0x68, 0x80, 0x52, 0x63, 0x51, 0xB8, 0xE1, 0xC1, 0x1D, 0xE6, 0x46, 0x49, 0x0E, 0x23,
-    0x9E, 0x61, 0xC9, 0x6B, 0xB0, 0xC2, 0xDA, 0x59, 0xAA, 0xB0, 0x25, 0x91, 0xA4, 0x72, 0x0B, 0x00,
-    0x6F, 0xDC, 0x7A, 0x5D, 0x74, 0xC7, 0x86, 0xA6, 0xA2, 0x5D, 0xD9, 0x20, 0xCB, 0x94, 0x9D, 0xF9,
-    0xFA, 0x7C, 0x8A, 0x18, 0x56, 0x74, 0x57, 0x80, 0x16, 0xD2, 0x0A, 0x85, 0x2D, 0x1E, 0x15, 0xAC,
-    0x91, 0xE3, 0x18, 0x9E, 0xA2, 0x67, 0x6C, 0x4F, 0x48, 0xF8, 0x5A, 0x65, 0x0B, 0x8B, 0xBC, 0x9D,
-    0x8F, 0xC8, 0x86, 0x39, 0x23, 0x5E, 0x29, 0x18, 0x87, 0xFC, 0xBF, 0x11, 0x11, 0x0A, 0x86, 0x49,
-    0xCB, 0xD1, 0x7F, 0xAF, 0x78, 0x62, 0x76, 0xD0, 0xC2, 0x09, 0xCA, 0xF8, 0x80, 0x64, 0x85, 0xDF,
-    0x03, 0xD5, 0x7D, 0xF0, 0x1E, 0x16, 0x35, 0x5E, 0xDD, 0x45, 0x49, 0xF0, 0x6E, 0x83, 0x85, 0xDD,
-    0xA6, 0x0B, 0x5F, 0x83, 0x5B, 0x1D, 0x7B, 0x20, 0x30, 0x5E, 0xC9, 0x3B, 0x70, 0x93, 0x0F, 0xE4,
-    0xEA, 0x56, 0xDC, 0xC7, 0x59, 0x70, 0xCA, 0x73, 0x08, 0x9E, 0x4A, 0xC0, 0xD1, 0x0A, 0x14, 0x25,
-    0xAD, 0xAD, 0x58, 0x57, 0x4C, 0x54, 0x7B, 0xED, 0x71, 0x38, 0xB3, 0x7B, 0xF9, 0x15, 0xC8, 0x09,
-    0xDF, 0xE7, 0xA1, 0x85, 0xD6, 0xC6, 0xCD, 0x9C, 0xB3, 0xEA, 0xA9, 0x9E, 0x61, 0x3F, 0xEA, 0x01,
-    0x95, 0xFC, 0x3A, 0x33, 0x6F, 0x4A, 0xDC, 0x3A, 0xE0, 0x9A, 0xB1, 0x96, 0x71, 0x8A, 0x78, 0x89,
-    0xDB, 0x0A, 0x48, 0x74, 0xF8, 0xF9, 0x00, 0x54, 0x63, 0xBF, 0xA3, 0xC7, 0xE1, 0x54, 0xB0, 0x36,
-    0x00, 0xB5, 0x79, 0xE8, 0x11, 0x2D, 0xD4, 0x0B, 0x6D, 0xFE, 0x2E, 0xB1, 0x9E, 0x49, 0x7E, 0xAE,
-    0xC7, 0x8F, 0x1A, 0x26, 0x1F, 0x68, 0x36, 0xAC, 0x3E, 0x3E, 0xE9, 0x51, 0x7E, 0xBD, 0xEB, 0x50,
-    0xAA, 0x0B, 0x59, 0x43, 0x3B, 0x95, 0x39, 0x7B, 0x76, 0x6F, 0xA9, 0x0D, 0x33, 0xE1, 0xF6, 0xC6,
-    0xF9, 0x44, 0x65, 0xD0, 0xF7, 0x37, 0xBE, 0xDF, 0x5B, 0xDB, 0xA5, 0x1D, 0xB2, 0xE4, 0x4F, 0xED,
-    0x3A, 0x6A, 0xCE, 0xD5, 0xEE, 0x16, 0xA9, 0x5C, 0x92, 0x07, 0xDE, 0x32, 0x6A, 0x88, 0xDC, 0xFA,
-    0x5B, 0x25, 0x4B, 0x21, 0x1E, 0xB8, 0x3C, 0xDD, 0x39, 0xDC, 0x27, 0xD1, 0x0D, 0xB3, 0x7D, 0x46,
-    0x8A, 0x14, 0xC5, 0xC6, 0x60, 0x6F, 0xC0, 0x2E, 0xF9, 0xF8, 0xA9, 0xDC, 0x78, 0x4E, 0x7E, 0x79,
-    0x2E, 0x89, 0x3A, 0xC8, 0xB1, 0xF4, 0x3E, 0x7F, 0xFC, 0xDB, 0x5E, 0x98, 0x81, 0x44, 0x67, 0xB2,
-    0xFF, 0xD1, 0x82, 0x6B, 0x1C, 0x5C, 0x90, 0x47, 0xF3, 0xFC, 0x33, 0xB2, 0x1E, 0x1A, 0x7E, 0xA2,
-    0x2E, 0xC6, 0x3A, 0xF2, 0xA1, 0x62, 0xCE, 0x79, 0x72, 0xE7, 0x92, 0x20, 0xB7, 0x2D, 0xBA, 0x8E,
-    0xFF, 0x9F, 0x82, 0x25, 0x09, 0x53, 0xAF, 0xE0, 0xA1, 0x38, 0xD1, 0xD4, 0xB9, 0xEF, 0xFF, 0xF7,
-    0x34, 0xFD, 0x3A, 0xB9, 0xCC, 0x78, 0x05, 0x87, 0xFC, 0x0D, 0xCD, 0x5A, 0x3D, 0x8C, 0x1D, 0xD7,
-    0x75, 0x3E, 0x33, 0xC3, 0xDD, 0x31, 0x3C, 0x86, 0x47, 0x05, 0xD9, 0x50, 0x31, 0x27, 0x85, 0x13,
-    0x38, 0x42, 0xC8, 0x69, 0x5D, 0xEC, 0xBE, 0x19, 0x52, 0x40, 0x52, 0xA4, 0x10, 0x0B, 0xAD, 0x5D,
-    0x10, 0x88, 0xDA, 0x24, 0x40, 0xC0, 0x46, 0x05, 0x11, 0xEF, 0x7B, 0x33, 0x92, 0x0A, 0x17, 0x2E,
-    0xC4, 0xC0, 0x48, 0x9A, 0x14, 0x66, 0x00, 0x39, 0xA0, 0x56, 0xC5, 0xBA, 0x60, 0x41, 0x20, 0xEF,
-    0xED, 0x8C, 0x44, 0x20, 0x2A, 0x52, 0x78, 0x12, 0xC5, 0x48, 0xE1, 0x42, 0x13, 0x9B, 0x4A, 0x21,
-    0x17, 0x1C, 0x3B, 0xC3, 0x70, 0xB8, 0x9A, 0xF7, 0x6E, 0xBE, 0xEF, 0xDC, 0x79, 0x7F, 0xA4, 0x00,
-    0x1B, 0x86, 0x19, 0xF1, 0x71, 0x77, 0xB8, 0x6F, 0x7E, 0xEE, 0x39, 0xF7, 0xDC, 0x73, 0xBE, 0xF3,
-    0x9D, 0x73, 0x47, 0x44, 0x9C, 0x5E, 0x92, 0xD2, 0xC3, 0x21, 0x95, 0x54, 0xF4, 0xB3, 0x27, 0x7E,
-    0x29, 0x77, 0x25, 0x4C, 0xA5, 0x95, 0x48, 0xDC, 0x46, 0x12, 0xF1, 0x6A, 0x19, 0x4B, 0x50, 0x49,
-    0x2F, 0x61, 0x89, 0x07, 0xE2, 0xDC, 0x6B, 0xF9, 0xC0, 0xF2, 0xD3, 0x8A, 0x78, 0xA5, 0x48, 0x94,
-    0x4A, 0x60, 0x1A, 0xC7, 0x98, 0x32, 0xAA, 0x77, 0x65, 0x2E, 0x12, 0xD6, 0x22, 0x99, 0x88, 0x8B,
-    0xEB, 0x21, 0xAE, 0x27, 0x90, 0xD6, 0x89, 0xF8, 0x38, 0x1B, 0xE5, 0x22, 0x13, 0x3C, 0xD9, 0xE3,
-    0x49, 0x9E, 0x9A, 0x5F, 0x2B, 0x7D, 0x63, 0xC4, 0x35, 0xB5, 0x1D, 0x09, 0x97, 0xEE, 0xE2, 0x77,
-    0x2D, 0x42, 0x32, 0x8C, 0x27, 0xC6, 0x34, 0x38, 0xFC, 0x3D, 0x9E, 0x38, 0x91, 0x33, 0x3A, 0xA0,
-    0x1D, 0x4A, 0xFC, 0x0A, 0x07, 0xA8, 0x6A, 0x87, 0xDC, 0xB8, 0xE2, 0x1E, 0x9F, 0xDE, 0xE6, 0x73,
-    0x46, 0xE4, 0xDC, 0xFC, 0x00, 0xE3, 0x8D, 0xF4, 0x0A, 0x07, 0x0E, 0xF8, 0x8C, 0xA7, 0xCF, 0x74,
-    0xAB, 0x07, 0x67, 0x1C, 0xC7, 0x1C, 0x1D, 0xBD, 0xC3, 0x67, 0x16, 0x92, 0xE1, 0x98, 0xCA, 0x97,
-    0x44, 0x7E, 0xBF, 0xCB, 0xBE, 0xFF, 0x33, 0x7C, 0x71, 0x17, 0xD7, 0x9A, 0xA0, 0xF4, 0xAB, 0x7D,
-    0x09, 0xDE, 0x68, 0x24, 0x82, 0xA5, 0xF6, 0x42, 0x71, 0x9A, 0x91, 0x84, 0xF9, 0x44, 0x7A, 0xCF,
-    0x98, 0x2E, 0xC9, 0x4E, 0xBB, 0x1F, 0xED, 0xB8, 0x1C, 0x1C, 0x27, 0xA1, 0x14, 0x74, 0x89, 0xF3,
-    0x29, 0xC6, 0x77, 0x5A, 0x09, 0x2B, 0x98, 0x72, 0x02, 0x6B, 0x40, 0x6E, 0x4C, 0x2D, 0xC7, 0xB4,
-    0x48, 0x07, 0xEB, 0xB8, 0x0D, 0xE4, 0xFB, 0x1F, 0xE2, 0xB1, 0x10, 0x26, 0xDB, 0xC9, 0x1E, 0xA6,
-    0x52, 0x40, 0x36, 0x46, 0x9C, 0x0F, 0xD3, 0x8B, 0x61, 0xBE, 0xA3, 0xC5, 0xBB, 0xB0, 0xB1, 0x69,
-    0xE5, 0xA5, 0xE2, 0x53, 0xCC, 0x6E, 0xBC, 0x9C, 0x35, 0xCD, 0xAB, 0x53, 0x3B, 0x7B, 0xB8, 0xF1,
-    0x39, 0x3B, 0xD8, 0xEE, 0x1B, 0x9B, 0x27, 0xF1, 0xFD, 0xDC, 0x55, 0x9A, 0x24, 0x77, 0x68, 0xCE,
-    0xB9, 0x9C, 0xD5, 0x07, 0x69, 0x2C, 0xAC, 0x2A, 0x0C, 0x8D, 0x3F, 0xC2, 0x05, 0x7E, 0x21, 0x25,
-    0xCC, 0x0B, 0x0C, 0x1D, 0xD4, 0x1E, 0x97, 0xBE, 0xC5, 0x7D, 0x09, 0x4C, 0x17, 0x34, 0x90, 0x66,
-    0x7E, 0x50, 0x42, 0x11, 0xDC, 0x1A, 0x53, 0xFC, 0x62, 0x50, 0x81, 0xD6, 0xC4, 0x84, 0xEE, 0xBB,
-    0xF0, 0x27, 0xE8, 0xBD, 0x6B, 0x3A, 0xAB, 0xC0, 0x19, 0xF9, 0xD3, 0x6A, 0x3C, 0x0B, 0xFE, 0x33,
-    0xBF, 0xB1, 0x5C, 0xCE, 0x5D, 0xF3, 0x98, 0x4B, 0xB0, 0x38, 0x9E, 0xAB, 0x07, 0xEC, 0x76, 0xBA,
-    0x08, 0x70, 0x8D, 0x91, 0xEC, 0xA4, 0x61, 0x1E, 0xE4, 0x81, 0x29, 0xF7, 0xA5, 0xF1, 0x4D, 0xEF,
-    0x34, 0x17, 0xA1, 0x64, 0x1A, 0xBE, 0x5C, 0xC6, 0x58, 0xB5, 0x1B, 0x7B, 0x94, 0xE1, 0x7D, 0x98,
-    0x53, 0xE7, 0xBD, 0x1B, 0x50, 0x8C, 0x5F, 0xF6, 0xD7, 0x5F, 0xEE, 0x95, 0x7A, 0x65, 0x8F, 0x66,
-    0xF1, 0xDF, 0xAC, 0xB0, 0x02, 0x72, 0x27, 0x94, 0xE2, 0xBD, 0x32, 0x94, 0xBB, 0x8E, 0xE9, 0xBD,
-    0xCA, 0xAB, 0x9C, 0x1F, 0xCA, 0x54, 0xE7, 0x0B, 0xFB, 0x67, 0xA9, 0xC4, 0x50, 0xBC, 0xF8, 0x61,
-    0x01, 0xAF, 0x84, 0xC5, 0x79, 0x94, 0x73, 0x56, 0x47, 0xAF, 0xBB, 0x95, 0xFD, 0xF3, 0x5B, 0xD5,
-    0xF8, 0x82, 0x34, 0x0D, 0xC6, 0xFD, 0xEA, 0x57, 0xE5, 0x0E, 0x64, 0x34, 0xB1, 0xF7, 0x59, 0xEF,
-    0x75, 0xB5, 0x9D, 0x97, 0xC8, 0xA1, 0x57, 0xF9, 0x75, 0x22, 0x13, 0xB7, 0x09, 0xEA, 0x38, 0x2D,
-    0xDC, 0xCE, 0x6F, 0xA2, 0x32, 0xCA, 0x61, 0x01, 0xF8, 0xFD, 0x04, 0xDA, 0xF6, 0x41, 0xE9, 0xB4,
-    0x61, 0xEE, 0x35, 0x91, 0x78, 0xF9, 0x9E, 0x8E, 0x8C, 0x95, 0x35, 0xFC, 0x3D, 0x38, 0x38, 0xB8,
-    0x2E, 0xD6, 0xDD, 0x9F, 0xFC, 0x3D, 0xBF, 0x73, 0x70, 0xC5, 0xF4, 0x89, 0x79, 0xFF, 0xE0, 0xD5,
-    0xDF, 0xC0, 0x66, 0x74, 0xB5, 0x20, 0x2F, 0x16, 0x02, 0x9B, 0x05, 0xD6, 0x66, 0x53, 0xBF, 0x86,
-    0xCD, 0x82, 0x32, 0x81, 0xCD, 0x64, 0xEA, 0x35, 0x30, 0x53, 0x00, 0xDB, 0xEC, 0xDD, 0x90, 0xD9,
-    0xF5, 0x92, 0x5F, 0xB0, 0xF8, 0xF8, 0x72, 0x72, 0x42, 0x9B, 0x05, 0x1F, 0xE0, 0x0B, 0x6E, 0x0B,
-    0x4B, 0xD8, 0x2C, 0x28, 0xC7, 0xB4, 0x19, 0x9E, 0x81, 0xCD, 0x82, 0x32, 0x7A, 0x0B, 0x36, 0x7B,
-    0x55, 0x5E, 0xFD, 0xF5, 0x36, 0x7B, 0xE9, 0xE8, 0xE8, 0x1F, 0x31, 0xAB, 0x7F, 0x39, 0x3A, 0x7A,
-    0x57, 0x34, 0x8E, 0xF2, 0xD0, 0x34, 0xB1, 0x4C, 0xF7, 0x39, 0xF6, 0x3E, 0x7E, 0xF0, 0x07, 0xBE,
-    0xE2, 0xA4, 0x4B, 0xD7, 0xC1, 0x2C, 0x2A, 0x8B, 0x1E, 0xC2, 0x05, 0x04, 0xE0, 0x6C, 0x9E, 0x70,
-    0x31, 0x52, 0x4F, 0x23, 0xED, 0x1C, 0x3C, 0x46, 0xE0, 0x7E, 0xCE, 0x1D, 0xF6, 0x04, 0x3E, 0x3B,
-    0xB0, 0xE3, 0x9F, 0xE1, 0xCE, 0x5F, 0xF1, 0x11, 0xF8, 0x8F, 0x63, 0x5A, 0xEF, 0xB4, 0x77, 0xD2,
-    0x43, 0x82, 0x99, 0x1C, 0xD2, 0x4C, 0x70, 0x87, 0xA0, 0x64, 0x08, 0x75, 0x04, 0x33, 0xC4, 0x7F,
-    0x62, 0x9A, 0xC2, 0x68, 0xF0, 0x9F, 0x4B, 0x5D, 0xD3, 0x78, 0xFF, 0xDD, 0xEB, 0x9D, 0x7A, 0xFF,
-    0x6E, 0x23, 0x88, 0xFA, 0xE3, 0x4A, 0x63, 0x8B, 0x3F, 0x2F, 0xB8, 0xCD, 0xE4, 0xB8, 0x4A, 0x4C,
-    0xEA, 0x20, 0x72, 0xFE, 0x52, 0xE6, 0x5E, 0x1B, 0x54, 0x51, 0xBA, 0xA7, 0x40, 0x32, 0x16, 0xF8,
-    0xE5, 0x94, 0x76, 0xE9, 0x97, 0x07, 0x84, 0xC0, 0x84, 0xA8, 0x37, 0xE3, 0x00, 0x3D, 0xA3, 0x42,
-    0x0F, 0x1D, 0xD6, 0x4A, 0x31, 0x00, 0x97, 0x14, 0x01, 0x12, 0x1E, 0x8A, 0xDC, 0x07, 0x66, 0xA6,
-    0x41, 0x1F, 0x7D, 0x9C, 0x22, 0xB4, 0x63, 0x09, 0x3F, 0xEE, 0x70, 0x78, 0x23, 0x1D, 0x60, 0x8A,
-    0x5E, 0x6F, 0xF1, 0x4C, 0x0F, 0x8A, 0x5F, 0x8C, 0x7B, 0xC8, 0x1C, 0xE6, 0x4E, 0x94, 0xAA, 0x31,
-    0xF5, 0xAE, 0x30, 0x0F, 0xFF, 0x1C, 0x71, 0xE7, 0xFF, 0xC0, 0x98, 0xCB, 0xBF, 0x30, 0xA6, 0xFA,
-    0x0E, 0x90, 0xE2, 0x02, 0x00, 0xC4, 0x87, 0x19, 0x2F, 0x3F, 0xC0, 0x89, 0xBF, 0xE1, 0x89, 0x0C,
-    0x27, 0xDE, 0xC6, 0x09, 0xC0, 0x59, 0x75, 0x23, 0xC1, 0x09, 0x07, 0x27, 0x72, 0x09, 0x2E, 0xD7,
-    0xE2, 0x56, 0x08, 0xD0, 0x3B, 0x17, 0x44, 0x2E, 0xFE, 0xC6, 0x27, 0xF8, 0xF1, 0x3F, 0x9A, 0x9B,
-    0xE4, 0x32, 0x90, 0xFB, 0x02, 0x90, 0x60, 0x2C, 0xAD, 0xFF, 0xD3, 0x45, 0xC2, 0x65, 0x9A, 0xB8,
-    0xF3, 0x68, 0xBA, 0x7F, 0x08, 0x4D, 0x3B, 0x69, 0x9D, 0xC6, 0x69, 0xDC, 0x9A, 0xF1, 0xE7, 0xC3,
-    0x2B, 0xF5, 0x39, 0x17, 0x00, 0x7B, 0xE2, 0x55, 0x7B, 0x17, 0xE4, 0x4E, 0xE3, 0x7E, 0x54, 0x06,
-    0xAF, 0xD0, 0x4F, 0x9A, 0x26, 0xBC, 0x7C, 0xDA, 0x59, 0x07, 0x71, 0xD2, 0x2F, 0x21, 0x18, 0x00,
-    0x3C, 0xB0, 0xE3, 0x14, 0x20, 0x08, 0xA0, 0x74, 0x9B, 0x28, 0x65, 0xBC, 0xC5, 0xE5, 0xCC, 0xE9,
-    0x7D, 0x40, 0x51, 0x26, 0xF8, 0x8F, 0x6E, 0x3E, 0x86, 0x31, 0x6F, 0x06, 0xB2, 0xF1, 0x21, 0xB6,
-    0xDE, 0x95, 0x22, 0xC5, 0x18, 0x93, 0x06, 0x9E, 0x13, 0xBE, 0xA6, 0xAE, 0x50, 0xD3, 0x0F, 0x46,
-    0xCC, 0x72, 0x70, 0xA6, 0x96, 0x0B, 0x0E, 0xA3, 0x06, 0xAA, 0xD4, 0x5D, 0x87, 0xB9, 0x2A, 0x1D,
-    0x61, 0xC1, 0x30, 0x74, 0x5C, 0x46, 0x6E, 0xE3, 0x77, 0x6E, 0x33, 0xC6, 0x02, 0x21, 0xC2, 0xF6,
-    0x30, 0x48, 0x13, 0x22, 0x3A, 0xA7, 0xDE, 0xBF, 0xD3, 0x89, 0xEE, 0x5E, 0x84, 0x33, 0x45, 0x04,
-    0x47, 0xC0, 0x74, 0x19, 0x63, 0x1D, 0x7A, 0x22, 0xF5, 0x5D, 0x86, 0x65, 0x98, 0x72, 0xB9, 0x9A,
-    0x4D, 0x75, 0x18, 0x3F, 0x41, 0xAE, 0xFA, 0xA4, 0xFE, 0x03, 0xAA, 0x40, 0x85, 0xE0, 0x77, 0x97,
-    0xD4, 0xD1, 0x46, 0x0A, 0xF3, 0xFB, 0x4C, 0x1A, 0x50, 0x29, 0xD1, 0x15, 0xE6, 0x1A, 0x43, 0xA7,
-    0x1D, 0xE4, 0x62, 0xAF, 0x2E, 0x5A, 0x28, 0x75, 0x0F, 0x8E, 0x8D, 0x98, 0x4A, 0xF7, 0xA1, 0x95,
-    0x06, 0x41, 0x47, 0xA7, 0xE5, 0xF3, 0x53, 0xCE, 0x08, 0x7F, 0x20, 0x28, 0x30, 0x95, 0x91, 0x26,
-    0x0C, 0xA6, 0x1D, 0xA4, 0x27, 0xFA, 0x3C, 0xD4, 0xC4, 0xC8, 0xF8, 0x49, 0x18, 0x93, 0xD0, 0x75,
-    0xA9, 0xDB, 0x4E, 0xBA, 0xCC, 0xAF, 0x7E, 0x3E, 0x3A, 0x2E, 0x55, 0x8B, 0x96, 0x4F, 0x60, 0x74,
-    0x82, 0xAD, 0x72, 0x00, 0xB9, 0x9E, 0xC2, 0x34, 0xDE, 0x42, 0xE5, 0x21, 0x32, 0xA8, 0xD8, 0x21,
-    0x03, 0x06, 0xE2, 0xF6, 0x35, 0x92, 0x61, 0x33, 0x84, 0x49, 0x2C, 0x45, 0xF8, 0x5E, 0x1B, 0x49,
-    0xF6, 0x96, 0x69, 0xC3, 0x34, 0xAB, 0x08, 0xE6, 0x30, 0x1B, 0x34, 0x82, 0x1F, 0x40, 0xC1, 0xFD,
-    0x0B, 0xBC, 0xF7, 0x12, 0xCC, 0x60, 0x2D, 0xE7, 0x36, 0x21, 0x72, 0xB3, 0x03, 0xA0, 0x37, 0x25,
-    0xD7, 0xE2, 0x92, 0x58, 0xE3, 0x51, 0x80, 0x86, 0xFA, 0xEA, 0x03, 0x9C, 0x03, 0x4D, 0x71, 0x16,
-    0x96, 0x47, 0xAC, 0x4E, 0x1F, 0xEA, 0x3C, 0x39, 0xB3, 0x52, 0xA2, 0x4A, 0xE2, 0x0A, 0x51, 0xC5,
-    0x9F, 0x58, 0xCF, 0x60, 0x2E, 0x64, 0x1F, 0x33, 0xA6, 0x60, 0xF1, 0x3B, 0xBF, 0x2E, 0x4C, 0x1F,
-    0x20, 0x2B, 0x9D, 0xE3, 0x9C, 0x9D, 0x77, 0xB6, 0xD2, 0xBE, 0x8D, 0x2F, 0x85, 0x14, 0x2F, 0xDF,
-    0x5A, 0x37, 0xBD, 0x50, 0xF0, 0x82, 0x21, 0x02, 0xD1, 0x35, 0xFD, 0x8F, 0x99, 0x26, 0x7F, 0x4C,
-    0xAE, 0xF2, 0x36, 0xA9, 0x0D, 0x9D, 0x67, 0xC2, 0x43, 0x1F, 0x50, 0x24, 0xE4, 0x7A, 0x0D, 0x34,
-    0x0E, 0x98, 0xEF, 0x6D, 0xB6, 0x67, 0xB2, 0xCD, 0x78, 0x58, 0x1C, 0xBD, 0xD7, 0x80, 0x44, 0xB9,
-    0x2D, 0xCE, 0xE2, 0xCE, 0x1A, 0x6E, 0x0A, 0x4D, 0x9D, 0x0E, 0x1A, 0x4A, 0x4F, 0x51, 0xFD, 0xC9,
-    0x52, 0xAD, 0x97, 0x78, 0xE0, 0x79, 0x89, 0xCA, 0x65, 0x96, 0xA7, 0x7B, 0x48, 0x90, 0xCA, 0xD3,
-    0x1A, 0xC6, 0xB4, 0x57, 0x48, 0x6C, 0x64, 0xFE, 0xB6, 0x2A, 0x7A, 0xFF, 0xA3, 0x29, 0x99, 0xA3,
-    0xF5, 0xB1, 0x0C, 0x3A, 0x32, 0x33, 0x01, 0x57, 0xC6, 0x1C, 0x91, 0x3E, 0x49, 0x25, 0x15, 0xA4,
-    0x88, 0xB9, 0x02, 0x5A, 0x80, 0xB5, 0xA0, 0x96, 0x24, 0x6F, 0x33, 0x8E, 0x1D, 0xA7, 0xB8, 0x0D,
-    0xF9, 0x84, 0x6A, 0x06, 0x70, 0x8C, 0x84, 0x7E, 0x11, 0x7E, 0xD0, 0x0D, 0xFC, 0x69, 0x97, 0x2A,
-    0xC5, 0xC4, 0x82, 0x4C, 0xA5, 0x31, 0x2B, 0x81, 0x21, 0xC9, 0x05, 0xFC, 0x7B, 0x1E, 0xEC, 0x78,
-    0x55, 0x98, 0xB8, 0xEA, 0x3D, 0x92, 0x9A, 0x07, 0x39, 0xBC, 0x8D, 0x6A, 0xFE, 0x9E, 0x32, 0xCC,
-    0x8D, 0x8F, 0xA5, 0x82, 0xAA, 0x9E, 0x1A, 0x51, 0xF5, 0x93, 0x31, 0x29, 0x8C, 0x2A, 0x68, 0xAD,
-    0xA8, 0x1A, 0xFA, 0x35, 0xFD, 0x9F, 0x2A, 0x5A, 0x33, 0xAA, 0x8E, 0x30, 0xD5, 0x48, 0xAC, 0x92,
-    0x6A, 0x47, 0xAB, 0x65, 0xF8, 0xE9, 0x51, 0x21, 0xAA, 0xA6, 0x35, 0xA4, 0xEA, 0x49, 0xAD, 0xA2,
-    0x5C, 0x15, 0x55, 0x4B, 0x96, 0xAB, 0x15, 0x4F, 0xCF, 0x70, 0xB4, 0x64, 0x38, 0xB8, 0xD5, 0x45,
-    0x79, 0xEA, 0xF3, 0x85, 0x79, 0xA3, 0x0A, 0xA7, 0x8F, 0x9D, 0xC2, 0x3C, 0x0E, 0xCD, 0xE9, 0x54,
-    0xE4, 0x33, 0x0D, 0x59, 0x5D, 0x41, 0xEB, 0xBD, 0xF8, 0x7C, 0xC4, 0x0D, 0xCD, 0xCF, 0x65, 0xC3,
-    0xB3, 0x4A, 0x4E, 0x8C, 0xB2, 0x78, 0x09, 0x3F, 0xB2, 0x90, 0x37, 0xD1, 0x38, 0x82, 0xA0, 0x89,
-    0x7E, 0x8D, 0xAF, 0xB4, 0x9A, 0x2C, 0x7A, 0x7B, 0x3A, 0x2C, 0x55, 0x6D, 0x39, 0x71, 0x94, 0xBC,
-    0x22, 0xB7, 0x9C, 0x1E, 0xDD, 0x82, 0xA6, 0x69, 0xCC, 0xB0, 0x70, 0x3B, 0x61, 0x5D, 0x60, 0x75,
-    0xB3, 0x43, 0x6B, 0xFD, 0xA1, 0x34, 0x1D, 0x77, 0x1D, 0xBD, 0xA7, 0xAE, 0xD3, 0xD9, 0x58, 0x45,
-    0xD4, 0xEA, 0x60, 0x73, 0x4D, 0x45, 0x12, 0xD4, 0xB6, 0xE8, 0xC8, 0x78, 0xE3, 0x11, 0x8B, 0x28,
-    0xAD, 0x4C, 0x40, 0xA6, 0x3C, 0x12, 0x97, 0xE1, 0x13, 0x9B, 0x8A, 0x33, 0xE8, 0x25, 0x5A, 0x60,
-    0xB0, 0xAC, 0x92, 0x17, 0x94, 0x5F, 0xB3, 0x4E, 0x82, 0x36, 0xD4, 0xB0, 0x5A, 0x02, 0x82, 0x42,
-    0xC3, 0x9A, 0x1B, 0x64, 0xAA, 0xF7, 0xE7, 0x1C, 0xB2, 0xD5, 0x2D, 0x89, 0xAA, 0x55, 0x2B, 0x8F,
-    0x3C, 0xB8, 0x4B, 0x39, 0x1D, 0x1D, 0xF5, 0x3E, 0xC6, 0xFF, 0x8F, 0x25, 0xF0, 0xB1, 0x6C, 0x13,
-    0xA7, 0x5D, 0x15, 0x46, 0xED, 0x72, 0x79, 0x75, 0x29, 0xC1, 0x7F, 0x06, 0x3D, 0xE2, 0xE5, 0x1D,
-    0x2C, 0xD9, 0xB6, 0x42, 0x1D, 0xA6, 0xAA, 0x74, 0x4A, 0x09, 0x6C, 0xC6, 0xD0, 0x50, 0x80, 0xD5,
-    0xAC, 0xDF, 0x0F, 0x38, 0xA6, 0x06, 0x21, 0xB7, 0xF1, 0x16, 0x28, 0xB6, 0x12, 0x5B, 0xEA, 0xB4,
-    0x5A, 0x14, 0xAA, 0x8D, 0xB6, 0xEE, 0x23, 0x11, 0x22, 0x66, 0xE9, 0x1C, 0xBC, 0xD3, 0xA3, 0xDB,
-    0xF4, 0x88, 0x32, 0xB0, 0xAB, 0x2C, 0x5F, 0xCE, 0x07, 0xEB, 0x9C, 0x2C, 0xEB, 0x18, 0x4A, 0xBC,
-    0xF3, 0x45, 0xE9, 0xE3, 0xDE, 0x1A, 0x4C, 0x15, 0xE3, 0x99, 0xE0, 0x23, 0xE6, 0x38, 0x50, 0x86,
-    0x1B, 0xF2, 0xFA, 0x17, 0xA4, 0xCF, 0x0B, 0x0E, 0x93, 0x46, 0x87, 0x3B, 0x61, 0x9B, 0xF0, 0x09,
-    0x4A, 0x42, 0x0F, 0x98, 0xAB, 0x1A, 0xAA, 0xCF, 0x6A, 0xF8, 0xE9, 0x32, 0xDD, 0xF4, 0xCB, 0x42,
-    0x5A, 0x87, 0xFF, 0xF4, 0xC8, 0xAA, 0x41, 0x7D, 0x56, 0x7A, 0x6F, 0xDD, 0xA7, 0x7E, 0xA3, 0x7A,
-    0x37, 0x62, 0xDD, 0xDC, 0xE7, 0xC0, 0x85, 0xC6, 0xC9, 0xEE, 0x4D, 0x9B, 0xBD, 0x87, 0x86, 0x00,
-    0x89, 0x43, 0xBD, 0xE1, 0xF6, 0x1E, 0x54, 0x71, 0x1F, 0xEB, 0xE3, 0x7C, 0x3A, 0xB1, 0xBD, 0x82,
-    0xB1, 0xB5, 0x4C, 0xAF, 0xCF, 0x70, 0xBA, 0xEB, 0xCB, 0xFC, 0x6F, 0x62, 0x35, 0xB6, 0x97, 0xE9,
-    0x8E, 0x08, 0x8A, 0xCC, 0xA0, 0xBC, 0xD1, 0x80, 0x42, 0xF1, 0xEF, 0xF6, 0xD6, 0x5F, 0x79, 0x99,
-    0xEC, 0xF9, 0xC6, 0xE6, 0x3A, 0x80, 0x2E, 0x30, 0xDC, 0x1E, 0xDB, 0x09, 0x6A, 0x6D, 0xD9, 0x58,
-    0xB1, 0xA4, 0x41, 0x94, 0x1B, 0x0E, 0xBF, 0x9C, 0x1C, 0xE7, 0x95, 0xC8, 0xFA, 0x77, 0x32, 0x58,
-    0xA0, 0x1F, 0x7E, 0x21, 0xDD, 0xD5, 0x78, 0x02, 0xCB, 0x33, 0xB4, 0xCA, 0x79, 0x25, 0xB9, 0x12,
-    0xF5, 0x9A, 0x15, 0xA3, 0xB4, 0x75, 0x6A, 0x67, 0x73, 0xC6, 0x42, 0x60, 0x8A, 0x6F, 0xEA, 0x28,
-    0xDE, 0xA0, 0xE3, 0xC4, 0x1A, 0x28, 0xB0, 0x1D, 0x13, 0x8E, 0x4B, 0x75, 0x28, 0xBA, 0xDF, 0xBA,
-    0x69, 0xA3, 0xAD, 0x42, 0xC1, 0x00, 0x17, 0x1F, 0xEB, 0x1D, 0x93, 0xD7, 0x39, 0xC0, 0x0C, 0xE6,
-    0x68, 0x40, 0xDA, 0x13, 0x29, 0x24, 0xD0, 0xC5, 0xAB, 0x24, 0xB8, 0xBF, 0x35, 0x64, 0x64, 0x9B,
-    0x09, 0x6E, 0xB3, 0xD5, 0xA9, 0xA1, 0x5D, 0x07, 0x15, 0x96, 0x37, 0x6D, 0xE8, 0x39, 0xD2, 0xC9,
-    0x3A, 0x40, 0x43, 0x6B, 0xEB, 0xD8, 0xBC, 0xC3, 0x04, 0x8B, 0xC1, 0x3D, 0x42, 0x24, 0x06, 0xC8,
-    0x6A, 0x96, 0x40, 0x3D, 0x05, 0x25, 0x39, 0xD9, 0x58, 0xC3, 0x67, 0x7B, 0x0E, 0x9D, 0x70, 0x24,
-    0x85, 0x5A, 0xEF, 0x97, 0x04, 0x77, 0x54, 0x7A, 0x88, 0x86, 0xF3, 0xA7, 0xEF, 0x02, 0xD8, 0x66,
-    0x9C, 0x8C, 0xAE, 0x2E, 0xFB, 0x22, 0x3D, 0x91, 0x7E, 0x4E, 0x8B, 0x2C, 0xF0, 0x8C, 0x63, 0xF0,
-    0xE8, 0xAE, 0x41, 0x5A, 0x3D, 0x5E, 0x58, 0xD4, 0x85, 0x03, 0xDF, 0xD4, 0xA9, 0x5D, 0x75, 0x58,
-    0x32, 0xB5, 0x21, 0x51, 0x79, 0x41, 0x03, 0x5E, 0xA1, 0xCB, 0x7D, 0xC3, 0xB2, 0xBC, 0xB5, 0x01,
-    0x6A, 0x6A, 0x0E, 0x18, 0xC4, 0x88, 0xB0, 0x7D, 0x50, 0xF9, 0x86, 0xDA, 0x30, 0x56, 0x7B, 0x99,
-    0xB3, 0x3A, 0xF4, 0x7E, 0xDE, 0x60, 0xA5, 0xC2, 0xEF, 0x95, 0x08, 0x82, 0x71, 0x84, 0xBA, 0x9D,
-    0x2D, 0x9C, 0xB0, 0x0C, 0xA1, 0xD7, 0x04, 0x77, 0x76, 0xB0, 0x7B, 0xE7, 0x69, 0x13, 0xC8, 0xAF,
-    0xF0, 0x20, 0x2E, 0x31, 0x9F, 0xC7, 0x7E, 0xCD, 0xD6, 0x8E, 0x32, 0xA5, 0x7E, 0xCA, 0x79, 0x3F,
-    0xC2, 0x83, 0xE2, 0x3D, 0xE0, 0xC4, 0xC3, 0x39, 0xAD, 0x15, 0x35, 0x9C, 0x45, 0xA2, 0x85, 0x46,
-    0x21, 0x4B, 0xDE, 0x64, 0xD3, 0x8C, 0x82, 0xB3, 0xE2, 0x96, 0x92, 0x6A, 0xF1, 0xB7, 0x09, 0x5E,
-    0xB6, 0x48, 0xC9, 0xCB, 0x50, 0xBC, 0x98, 0x7F, 0x32, 0x25, 0x5C, 0xCA, 0xEF, 0x9C, 0x39, 0x71,
-    0x9D, 0x5D, 0xB6, 0xEA, 0x84, 0x2B, 0xC1, 0x11, 0xB2, 0x58, 0xB3, 0x6B, 0x35, 0xF0, 0x3E, 0x99,
-    0x73, 0x5D, 0x32, 0x7A, 0x69, 0x04, 0xDE, 0x23, 0xC1, 0x2F, 0x20, 0xC0, 0xFB, 0xDF, 0x8E, 0xC9,
-    0x8E, 0x58, 0x59, 0x30, 0x89, 0x24, 0x2F, 0x33, 0x96, 0x4A, 0x58, 0x01, 0xE5, 0x4E, 0x8D, 0x04,
-    0xEF, 0x9A, 0xBF, 0x43, 0x61, 0x4F, 0x88, 0x62, 0x71, 0x4F, 0x3D, 0x86, 0x0E, 0x84, 0x73, 0xDB,
-    0xE6, 0xB2, 0xE5, 0x61, 0xB6, 0x2A, 0x45, 0xF7, 0xE4, 0xF9, 0xD3, 0xF6, 0x8F, 0x56, 0xE9, 0x2E,
-    0x56, 0x28, 0x7D, 0x8D, 0xB1, 0x4B, 0x07, 0xBF, 0x24, 0x17, 0x9F, 0x3B, 0x6D, 0x9D, 0x74, 0x17,
-    0x6B, 0xBE, 0xF0, 0xC8, 0x04, 0x3E, 0x03, 0x1E, 0xD5, 0xCC, 0xB7, 0xB7, 0x34, 0x93, 0xAC, 0xAB,
-    0x59, 0xB6, 0x7F, 0x7C, 0x32, 0x9A, 0x60, 0xF1, 0x0F, 0x46, 0x02, 0xE0, 0x49, 0xED, 0xB7, 0x10,
-    0x47, 0x1E, 0x91, 0x5C, 0x51, 0x08, 0xE8, 0x97, 0xE2, 0x13, 0xB6, 0x67, 0x95, 0x67, 0x79, 0x8F,
-    0x08, 0x08, 0x73, 0xDA, 0x20, 0xE3, 0x95, 0xF8, 0x98, 0xF3, 0xF8, 0x29, 0x11, 0xEE, 0x57, 0xC4,
-    0xAB, 0x9E, 0xE4, 0x60, 0xCE, 0x80, 0x36, 0xA8, 0xAF, 0xE0, 0x98, 0x59, 0x8E, 0xC0, 0x08, 0x16,
-    0xDF, 0x52, 0x10, 0x83, 0x8E, 0xAE, 0x52, 0x1B, 0x76, 0x3E, 0x2C, 0xB0, 0xC0, 0x4D, 0x47, 0x62,
-    0xB3, 0x89, 0xEC, 0x79, 0xE5, 0x53, 0xFC, 0xF4, 0x79, 0xD0, 0x53, 0xE4, 0x2B, 0x22, 0x5F, 0xC7,
-    0xB2, 0xCD, 0xA2, 0x92, 0x1D, 0xB9, 0xA0, 0x76, 0x7A, 0xE6, 0x05, 0x62, 0x31, 0xEB, 0xCB, 0xC6,
-    0x66, 0xE7, 0x93, 0x0C, 0x8B, 0x1B, 0x95, 0x41, 0xED, 0x37, 0x71, 0xEE, 0xF4, 0x28, 0x3E, 0x0F,
-    0xC1, 0xBF, 0x5F, 0xD8, 0xC8, 0x8E, 0xA8, 0x16, 0x0C, 0x67, 0x9A, 0x99, 0x45, 0x8F, 0xF9, 0x5C,
-    0x03, 0xAA, 0x17, 0x39, 0x8A, 0x50, 0x4C, 0x28, 0xD0, 0xA6, 0x79, 0xD6, 0x02, 0x04, 0xBD, 0xCF,
-    0x58, 0x1B, 0x25, 0x11, 0x78, 0xBC, 0xD7, 0x26, 0x98, 0x67, 0x9C, 0x03, 0x7A, 0x1D, 0xC0, 0x44,
-    0xC6, 0x12, 0xEB, 0x7D, 0x02, 0x44, 0x16, 0xD4, 0x61, 0xE5, 0x82, 0xAD, 0x9E, 0xD0, 0xAB, 0x00,
-    0x6A, 0x09, 0xFD, 0x0A, 0xF0, 0x06, 0x6F, 0x0A, 0xAB, 0x10, 0x13, 0x00, 0xB4, 0x61, 0x54, 0xB0,
-    0xDD, 0x92, 0xF4, 0xC1, 0x7C, 0x72, 0xBD, 0x23, 0x9C, 0xE2, 0xC2, 0x9C, 0x99, 0xC2, 0xA9, 0x96,
-    0x53, 0xE3, 0xE7, 0x7C, 0xBA, 0xAA, 0x58, 0x66, 0xB2, 0xCC, 0xC1, 0xCA, 0xD4, 0x9E, 0xA8, 0xB9,
-    0x98, 0x17, 0x73, 0xCD, 0xA4, 0x98, 0x85, 0xDB, 0x12, 0xD2, 0xA7, 0x36, 0x7B, 0x6A, 0xC6, 0x9C,
-    0x6C, 0x5D, 0xE9, 0xD7, 0x57, 0x72, 0xBD, 0x02, 0xE4, 0xC6, 0x95, 0x72, 0xF3, 0x4A, 0x94, 0x6B,
-    0xC6, 0xC5, 0x33, 0xCA, 0xD4, 0xC1, 0xC8, 0x7B, 0xE2, 0x41, 0x82, 0xD5, 0x10, 0x7F, 0xFE, 0x2D,
-    0xA3, 0xDD, 0x4D, 0x3A, 0x80, 0xAE, 0xC6, 0x00, 0x63, 0xEA, 0xC9, 0xCA, 0xD1, 0x98, 0x1F, 0x07,
-    0xCC, 0xD3, 0xC3, 0x9D, 0xE7, 0x50, 0xDB, 0xDB, 0xAB, 0xBA, 0x45, 0x69, 0xEF, 0x8C, 0xAC, 0x61,
-    0x46, 0x3E, 0x70, 0x63, 0x93, 0x3C, 0x3C, 0x27, 0xDA, 0x9E, 0xE1, 0x2E, 0x49, 0x58, 0xF6, 0x43,
-    0xC9, 0x28, 0x77, 0x9E, 0xEC, 0x0D, 0x58, 0x3F, 0x19, 0x6D, 0x8C, 0x4F, 0xC9, 0xCC, 0xAD, 0x83,
-    0x64, 0xAE, 0xC6, 0xFA, 0x8A, 0xB7, 0xBE, 0x32, 0xB2, 0x57, 0x66, 0x7A, 0x45, 0x36, 0xAF, 0x4C,
-    0x2C, 0x0F, 0x9B, 0x0C, 0x1D, 0x04, 0x4D, 0xEC, 0x70, 0xFB, 0x05, 0x5B, 0x34, 0xD1, 0xC3, 0x6B,
-    0xBD, 0x2D, 0x60, 0x24, 0x32, 0xF4, 0xC8, 0x9D, 0xB5, 0x0B, 0x14, 0x43, 0xE5, 0xA2, 0x9E, 0xDB,
-    0x3F, 0xE1, 0xAC, 0xE0, 0x9C, 0xD1, 0xF7, 0x2A, 0x5B, 0x97, 0xCD, 0x71, 0x47, 0x04, 0x7A, 0x80,
-    0xEC, 0xDB, 0xC2, 0x02, 0x51, 0xCE, 0xB4, 0x8A, 0x73, 0x61, 0x89, 0xA9, 0x4F, 0x29, 0x92, 0xC5,
-    0xDC, 0x68, 0xA6, 0x5D, 0x66, 0xA6, 0xD6, 0x21, 0x29, 0x6D, 0x53, 0xE7, 0x66, 0x49, 0x89, 0xEB,
-    0x81, 0xAC, 0xAD, 0xA8, 0xB3, 0x16, 0x2F, 0xAB, 0xEB, 0x4A, 0x65, 0x8B, 0x23, 0xEE, 0x5F, 0x61,
-    0x34, 0xD6, 0x64, 0x61, 0x19, 0xB4, 0x18, 0x27, 0xE6, 0xA6, 0x83, 0x95, 0xCB, 0xDE, 0x2E, 0x5B,
-    0xC7, 0x58, 0x56, 0xB7, 0xC3, 0x38, 0x19, 0x93, 0x7E, 0x1D, 0x7E, 0x6A, 0x3A, 0x87, 0x34, 0x24,
-    0x02, 0xFB, 0x59, 0x53, 0xF0, 0x66, 0x53, 0x1E, 0xD7, 0xEA, 0xC0, 0x12, 0x3E, 0x5B, 0x8D, 0x12,
-    0xCE, 0xE6, 0x8E, 0x65, 0x55, 0x6A, 0x5C, 0x4B, 0x86, 0xAC, 0xD7, 0xB8, 0x6A, 0xF3, 0x50, 0x29,
-    0x1F, 0xF7, 0x62, 0x12, 0x26, 0x23, 0xDB, 0x71, 0x91, 0x91, 0x6E, 0x04, 0x8D, 0xF5, 0x38, 0xD3,
-    0xDD, 0x9A, 0xDE, 0x9D, 0xEB, 0x8C, 0x8A, 0x9C, 0xD3, 0x8E, 0x2A, 0xD2, 0x1A, 0x90, 0x5D, 0x32,
-    0x0F, 0xFB, 0xD3, 0x0E, 0x7F, 0x60, 0x8A, 0x38, 0x8F, 0x72, 0x24, 0xAE, 0x24, 0xBC, 0xC7, 0x69,
-    0x86, 0xEF, 0xD3, 0x8D, 0xC2, 0x92, 0xFD, 0x3F, 0xDD, 0x44, 0xB3, 0xAD, 0x66, 0x4B, 0x45, 0x54,
-    0x7B, 0xF9, 0x43, 0xBB, 0x99, 0xD6, 0xAE, 0x2A, 0xFF, 0xA1, 0x69, 0xA6, 0xC5, 0xE7, 0x74, 0x69,
-    0x58, 0x6D, 0x99, 0x6D, 0x06, 0x46, 0x80, 0x44, 0xE6, 0x99, 0xFE, 0x50, 0xCC, 0xB7, 0x1F, 0x94,
-    0x60, 0x7E, 0x1D, 0x41, 0x2D, 0x65, 0x0F, 0x1C, 0x72, 0x12, 0x55, 0x09, 0x42, 0xB8, 0x37, 0x12,
-    0x54, 0x90, 0x43, 0x86, 0x47, 0xB3, 0x7A, 0x1D, 0xFE, 0x28, 0x52, 0x70, 0xAA, 0xD6, 0xEB, 0xA3,
-    0x07, 0x30, 0xE9, 0xCF, 0xF0, 0x5C, 0x7B, 0x69, 0x85, 0xC8, 0x2F, 0x0D, 0xC5, 0xA9, 0x62, 0xC8,
-    0x64, 0xE8, 0x85, 0xB9, 0xD5, 0xB3, 0x97, 0xCC, 0x0A, 0x53, 0x0D, 0x4D, 0x3C, 0x88, 0x5F, 0xC9,
-    0x41, 0xCE, 0x0F, 0x65, 0x93, 0xCA, 0x3F, 0x33, 0xC9, 0x57, 0x1D, 0xE4, 0x9E, 0x7A, 0x4F, 0x1B,
-    0x57, 0x0E, 0x59, 0xC1, 0x1F, 0x6F, 0xB5, 0xAD, 0x0A, 0x5C, 0x4A, 0xCC, 0x87, 0x65, 0xF8, 0x70,
-    0xD2, 0x03, 0x5E, 0x4D, 0x5E, 0x20, 0x33, 0x31, 0x15, 0xC1, 0x19, 0x20, 0x30, 0x55, 0xBF, 0x61,
-    0xBB, 0x1C, 0xF8, 0x55, 0x2B, 0x24, 0x39, 0x94, 0x9C, 0x20, 0xDA, 0x83, 0x16, 0xB1, 0x65, 0xD2,
-    0xE4, 0xFD, 0x45, 0x03, 0x0E, 0x1F, 0x03, 0x54, 0xAE, 0xD4, 0x43, 0x5F, 0x95, 0x4D, 0xA8, 0x11,
-    0x96, 0xD6, 0xAF, 0x27, 0x9F, 0x97, 0xE2, 0x9F, 0x8D, 0x50, 0x65, 0xBD, 0xB4, 0xF1, 0x29, 0x6C,
-    0xFC, 0x35, 0x1F, 0xB0, 0x59, 0x7E, 0x13, 0xF8, 0x40, 0x34, 0x63, 0x49, 0xE3, 0x76, 0xFF, 0x0F,
-    0x0E, 0x66, 0xA7, 0x57, 0xFD, 0x08, 0x1C, 0x2D, 0x33, 0xAF, 0x64, 0x86, 0x53, 0x34, 0x3F, 0x99,
-    0x7B, 0x08, 0xF1, 0xDA, 0xAF, 0x0B, 0x09, 0x3B, 0x6D, 0x1E, 0x81, 0xD4, 0xFC, 0x1B, 0x72, 0x73,
-    0xE5, 0xF4, 0x98, 0x6C, 0xBF, 0x6B, 0x88, 0x0F, 0xA8, 0xA0, 0x13, 0xD2, 0xC8, 0x9B, 0x10, 0xC1,
-    0x82, 0x6E, 0xA2, 0xBB, 0xA9, 0x94, 0xA7, 0x5B, 0xDD, 0x91, 0x46, 0xBB, 0x4F, 0xDE, 0x97, 0xBC,
-    0xF9, 0xC8, 0xE4, 0x7F, 0xED, 0x98, 0x7E, 0x02, 0x1A, 0xE8, 0x2F, 0xFC, 0xEF, 0x02, 0x24, 0x77,
-    0xD6, 0xC9, 0x27, 0x32, 0x39, 0xEA, 0x27, 0x49, 0x3E, 0xF9, 0x0B, 0xE6, 0xCB, 0xD8, 0x56, 0xBE,
-    0xDA, 0x74, 0x1D, 0x8A, 0xC1, 0x66, 0xB5, 0x7D, 0xEE, 0x0C, 0x0D, 0x58, 0x36, 0x84, 0xA2, 0xFA,
-    0x45, 0xE0, 0x0B, 0xD0, 0x17, 0x22, 0xC2, 0xAB, 0x1A, 0x8F, 0x54, 0x40, 0xAB, 0xDA, 0x4A, 0x3B,
-    0x04, 0xA4, 0xC1, 0x4A, 0x39, 0x59, 0x85, 0x13, 0x27, 0x97, 0xD5, 0xEC, 0xFE, 0x56, 0xF8, 0x06,
-    0x8A, 0x80, 0x98, 0x79, 0x96, 0x2E, 0x64, 0x02, 0xE2, 0x04, 0x96, 0xC2, 0xE9, 0x66, 0x61, 0x75,
-    0xBD, 0x45, 0xDD, 0x2F, 0x9C, 0xE3, 0xFD, 0xED, 0x2D, 0x7C, 0xCE, 0xB4, 0xDB, 0xAD, 0x02, 0x76,
-    0x05, 0x08, 0xF9, 0x57, 0x97, 0x69, 0xD4, 0xB3, 0x85, 0xA9, 0xDE, 0x3C, 0xDA, 0xCE, 0xF6, 0x94,
-    0x93, 0x60, 0x65, 0xCD, 0xB7, 0x5B, 0xD8, 0xB7, 0xA3, 0x20, 0x80, 0x5F, 0x1B, 0xE5, 0x7E, 0x93,
-    0x5C, 0x2E, 0x2A, 0x4A, 0x4A, 0xCC, 0x7D, 0x99, 0xA4, 0x56, 0xCC, 0x64, 0x59, 0x76, 0xA7, 0x3A,
-    0x57, 0x6E, 0x95, 0xA5, 0x0E, 0x01, 0x6C, 0x67, 0x40, 0x06, 0xC6, 0x67, 0xCC, 0xF6, 0x20, 0x50,
-    0xFB, 0xF2, 0x56, 0x9D, 0xFD, 0xBB, 0x9A, 0xD1, 0x46, 0x55, 0xED, 0xB1, 0xBD, 0xBD, 0xD9, 0x44,
-    0xA9, 0x39, 0x17, 0x6F, 0xFE, 0x5A, 0x95, 0xE4, 0xD1, 0x9B, 0xEA, 0x25, 0x6E, 0x8B, 0x55, 0xBF,
-    0xD7, 0xBE, 0x38, 0x57, 0xD7, 0x30, 0xF7, 0x9D, 0xC7, 0xEB, 0x57, 0x1F, 0x12, 0x9B, 0xAD, 0x9C,
-    0x85, 0x73, 0x07, 0x89, 0xB2, 0xD2, 0x79, 0x9C, 0xC5, 0xF7, 0x5B, 0xFA, 0x6E, 0x00, 0x88, 0x51,
-    0x04, 0xBA, 0x27, 0xB6, 0xBC, 0x8A, 0x53, 0xED, 0x35, 0x72, 0x4B, 0xD1, 0xFE, 0x89, 0x55, 0x1F,
-    0xAF, 0xFF, 0x9C, 0x69, 0x05, 0x8A, 0x3B, 0xFF, 0x8A, 0x43, 0x42, 0x6F, 0x64, 0x13, 0x2C, 0xF6,
-    0xAA, 0x22, 0x1B, 0x2B, 0x41, 0xD4, 0xEA, 0x56, 0xD8, 0x03, 0xA2, 0x47, 0xAC, 0x33, 0x42, 0xC5,
-    0xDB, 0x59, 0xA0, 0x96, 0xD4, 0x0B, 0x0E, 0x11, 0x5B, 0xE5, 0xBE, 0x9C, 0xB2, 0x74, 0x2A, 0x6A,
-    0xF7, 0x21, 0x02, 0x7B, 0xBA, 0xAE, 0x98, 0x7E, 0xBB, 0xD1, 0xD2, 0x33, 0x5E, 0xBD, 0x0F, 0x30,
-    0xF1, 0xCA, 0x8D, 0x42, 0xF1, 0xB7, 0x1B, 0xCA, 0x2E, 0x68, 0x8E, 0x1A, 0x79, 0xA1, 0x6D, 0xD3,
-    0xDA, 0xBE, 0x81, 0x10, 0xB1, 0x94, 0x6F, 0x31, 0xD2, 0xEB, 0x9A, 0x1B, 0x13, 0xFB, 0x5E, 0xC4,
-    0xEE, 0xED, 0x08, 0x08, 0xF3, 0xB8, 0x75, 0xCD, 0xF1, 0x83, 0xB4, 0x48, 0x23, 0x82, 0x54, 0x71,
-    0x85, 0x09, 0x12, 0x37, 0x24, 0xDC, 0x50, 0x22, 0xD5, 0x98, 0x04, 0x14, 0x36, 0xB3, 0x30, 0x11,
-    0x83, 0xCF, 0xF9, 0x8D, 0x3B, 0xDF, 0xED, 0x19, 0xD2, 0x10, 0x4B, 0x76, 0x61, 0x09, 0xCC, 0x59,
-    0xF9, 0xBA, 0x78, 0x0B, 0xA4, 0x9B, 0xD8, 0x80, 0xC6, 0x70, 0x0F, 0xC1, 0x4F, 0xCF, 0x2F, 0x55,
-    0xC2, 0x2D, 0x11, 0x1B, 0xDC, 0x53, 0x80, 0x86, 0xF7, 0xE8, 0x61, 0x91, 0xA2, 0xE4, 0x9F, 0x83,
-    0xC9, 0xBB, 0x1D, 0xFC, 0x32, 0xA8, 0x50, 0x70, 0x24, 0x29, 0xC1, 0x02, 0xFF, 0xFC, 0x06, 0x21,
-    0x1C, 0xB3, 0xFB, 0x3F, 0xE3, 0x8A, 0x35, 0xCA, 0x2E, 0xA0, 0x59, 0xC6, 0x4D, 0x63, 0x76, 0x17,
-    0x50, 0x0D, 0x54, 0x98, 0x82, 0x6E, 0x26, 0x8B, 0x7B, 0x73, 0xB3, 0x09, 0xD7, 0x0C, 0x3B, 0xC0,
-    0xEE, 0x06, 0x26, 0xFB, 0x10, 0x1B, 0x31, 0xF2, 0x1F, 0x66, 0x65, 0x58, 0xBB, 0xDC, 0xA0, 0xA1,
-    0x97, 0x86, 0x1F, 0xD0, 0x9E, 0xBD, 0xED, 0x8D, 0x27, 0x6C, 0xFD, 0x7D, 0x08, 0xBB, 0xFE, 0x17,
-    0xED, 0x4C, 0x48, 0x84, 0xC0, 0x13, 0x78, 0x4B, 0x26, 0xD9, 0xDF, 0x16, 0x1A, 0x4C, 0x5A, 0x1C,
-    0x0D, 0x40, 0xF8, 0xEE, 0x40, 0xD5, 0x36, 0x7B, 0x5D, 0x9B, 0x4C, 0xED, 0x77, 0x2F, 0xF2, 0xFC,
-    0xD0, 0x96, 0x8E, 0xE6, 0x76, 0x67, 0x20, 0xCA, 0x01, 0xB0, 0x69, 0xF8, 0x0C, 0x45, 0x3A, 0x57,
-    0xDD, 0xD4, 0x33, 0x2E, 0x4A, 0x72, 0x24, 0x9C, 0x26, 0x6B, 0xE5, 0xF5, 0xCD, 0x4E, 0x51, 0xB4,
-    0xB0, 0x5B, 0xA4, 0xD9, 0x4F, 0x00, 0x43, 0x79, 0x50, 0x63, 0xB5, 0x38, 0x58, 0x42, 0xAF, 0xBC,
-    0xD7, 0x0C, 0x22, 0x27, 0x56, 0x64, 0xF4, 0xDD, 0x5A, 0xF1, 0x84, 0x49, 0xC7, 0xED, 0x98, 0x16,
-    0x9C, 0xC5, 0x9F, 0xCC, 0xE1, 0x26, 0x73, 0x16, 0x8F, 0xC3, 0x6B, 0x4C, 0x04, 0x0F, 0x6E, 0x8F,
-    0xEA, 0x30, 0x97, 0xB6, 0x48, 0xCB, 0x33, 0x11, 0x97, 0xEA, 0xAB, 0x5D, 0x76, 0x19, 0x99, 0x44,
-    0x9C, 0x7C, 0xB3, 0xE5, 0x6B, 0xDF, 0xAC, 0x38, 0x77, 0x70, 0x70, 0x90, 0x6E, 0x6E, 0xB0, 0x6A,
-    0xAF, 0x54, 0x1F, 0x09, 0xD7, 0xE7, 0xBF, 0x82, 0x61, 0x7F, 0x5E, 0x0B, 0x09, 0x3D, 0xD4, 0x4B,
-    0xC3, 0xCA, 0x87, 0x93, 0x3A, 0x4C, 0x77, 0xA3, 0x1E, 0x9E, 0xFD, 0xAF, 0x65, 0xEF, 0x36, 0xD3,
-    0xB0, 0x1C, 0x87, 0x25, 0x0A, 0xE5, 0x3E, 0x7A, 0xB9, 0x0E, 0xDF, 0x68, 0x7B, 0xA7, 0x8D, 0x8E,
-    0xE1, 0x36, 0xA6, 0xC2, 0x1D, 0x1D, 0x14, 0xC9, 0xF8, 0x26, 0x11, 0x80, 0xD0, 0x7D, 0x84, 0x90,
-    0xFD, 0xDA, 0xEA, 0xC5, 0x2E, 0x35, 0xB9, 0xC2, 0xD7, 0x78, 0x49, 0x9B, 0x55, 0xF2, 0x37, 0x37,
-    0xDA, 0x09, 0x80, 0x34, 0x4B, 0xBE, 0x2D, 0x0B, 0x77, 0x98, 0xC4, 0xA3, 0x74, 0x66, 0x4B, 0x98,
-    0x44, 0x86, 0xAC, 0x3F, 0xE1, 0x7D, 0xD5, 0xC0, 0xD6, 0xB5, 0x72, 0xE8, 0xF8, 0x72, 0x85, 0x4D,
-    0xF6, 0x1D, 0x94, 0xD1, 0x64, 0x5F, 0xB4, 0xA3, 0x65, 0x76, 0x52, 0x36, 0x19, 0x34, 0x83, 0x99,
-    0x92, 0x81, 0x4D, 0x6E, 0x52, 0xBA, 0x67, 0x25, 0x99, 0x6D, 0x3F, 0x76, 0x85, 0x75, 0xB7, 0x34,
-    0x7A, 0x3B, 0xD7, 0xCD, 0xD2, 0x2D, 0x36, 0xF9, 0xAC, 0x24, 0x93, 0xD8, 0x25, 0x0A, 0xB2, 0x18,
-    0xFC, 0xE2, 0x53, 0x4E, 0x98, 0x6A, 0xF9, 0x1A, 0x2E, 0x25, 0xB3, 0x26, 0x74, 0x58, 0xBB, 0xC6,
-    0x2A, 0x70, 0x60, 0x78, 0x28, 0x69, 0x53, 0x99, 0xE9, 0x2B, 0x2C, 0x09, 0x9B, 0x3A, 0x40, 0x36,
-    0x60, 0xE6, 0x92, 0xD8, 0xBD, 0x71, 0x6A, 0x89, 0x5D, 0x60, 0x5E, 0xAE, 0x07, 0xDC, 0x1C, 0xF6,
-    0xD9, 0xF5, 0x7D, 0x41, 0xDD, 0xBA, 0xD2, 0x32, 0xC9, 0x36, 0x0E, 0x43, 0x79, 0xF2, 0x05, 0x09,
-    0x4D, 0x7F, 0x3A, 0xBA, 0x05, 0xC0, 0xB0, 0xB2, 0xEF, 0x1C, 0xDA, 0x57, 0x6C, 0xFC, 0x8A, 0x5E,
-    0x3A, 0xD1, 0x14, 0x5D, 0x6B, 0x26, 0xB5, 0x2D, 0x7B, 0xA6, 0xED, 0x98, 0x7E, 0xE4, 0xFE, 0x92,
-    0x83, 0x47, 0x5C, 0x4E, 0xE7, 0x91, 0xEE, 0x87, 0x6B, 0x09, 0xA3, 0xBC, 0x47, 0xF7, 0xB5, 0x6C,
-    0xF5, 0xA7, 0xF5, 0x8E, 0x6D, 0x9F, 0xE8, 0x06, 0x19, 0x0B, 0x1A, 0xF7, 0x9A, 0x96, 0x83, 0xA4,
-    0xA0, 0x7C, 0xCF, 0x41, 0xD9, 0xF7, 0xD2, 0x3B, 0x93, 0x65, 0xD3, 0x22, 0xA8, 0x96, 0x1B, 0x5F,
-    0xFD, 0x72, 0x84, 0xE8, 0x4D, 0x8C, 0x3E, 0xCB, 0x4C, 0xEA, 0x3D, 0xFA, 0xC4, 0x50, 0x1E, 0x0A,
-    0xF6, 0xD2, 0x61, 0x0F, 0xD1, 0xAF, 0x03, 0x5A, 0x11, 0x33, 0xA7, 0xC6, 0xBA, 0x67, 0x19, 0x56,
-    0x7C, 0xF7, 0x88, 0x8D, 0x6C, 0xB6, 0xC3, 0x14, 0xE9, 0x01, 0x4E, 0xA5, 0xDF, 0xBA, 0x9F, 0x55,
-    0x45, 0x1E, 0xFC, 0x18, 0x01, 0x9C, 0x04, 0x18, 0xAF, 0x47, 0x00, 0x6B, 0x55, 0xAA, 0x35, 0xD9,
-    0x4A, 0x96, 0x6E, 0xFE, 0x8F, 0x57, 0x36, 0x1C, 0x1A, 0x72, 0x08, 0xB6, 0x74, 0xD8, 0xC7, 0x74,
-    0xEA, 0x0B, 0x4F, 0xEF, 0x18, 0x53, 0xF3, 0x9E, 0xCF, 0xD2, 0x55, 0x44, 0x97, 0x98, 0xF4, 0xA3,
-    0xE7, 0xB4, 0x03, 0xDD, 0xC8, 0x1C, 0x8B, 0xB6, 0x24, 0xB4, 0xAD, 0x6F, 0x59, 0xA5, 0xC2, 0xBE,
-    0x42, 0x42, 0xA3, 0xCD, 0x7D, 0x4A, 0x70, 0xB4, 0xF1, 0x19, 0xE9, 0xCA, 0xE9, 0xF6, 0x86, 0xEE,
-    0x93, 0xEB, 0xEE, 0xA4, 0x35, 0xD3, 0x46, 0x2F, 0x3B, 0xD0, 0x4D, 0x44, 0x3E, 0xFA, 0x07, 0x85,
-    0x6E, 0xA6, 0x6B, 0x5E, 0xD6, 0x15, 0xF8, 0x3F, 0xCD, 0x5C, 0x3D, 0xB0, 0xE4, 0x54, 0x76, 0xBE,
-    0x92, 0x98, 0x91, 0x79, 0xAA, 0x5A, 0x11, 0x0C, 0x36, 0xCB, 0x14, 0x28, 0x30, 0x76, 0xAD, 0xBD,
-    0x06, 0xA5, 0x04, 0xCC, 0x93, 0x80, 0x2A, 0x13, 0x42, 0xC0, 0xB0, 0x55, 0x9E, 0x00, 0x32, 0xB3,
-    0xE5, 0xAA, 0x9D, 0x64, 0x03, 0x82, 0x79, 0xDD, 0x62, 0x37, 0x20, 0x70, 0xC0, 0x4B, 0xB0, 0x83,
-    0x4D, 0x08, 0x28, 0x1B, 0x9A, 0x60, 0x1C, 0x10, 0x50, 0x76, 0xF7, 0x6B, 0xB1, 0x04, 0x13, 0x10,
-    0xA0, 0x65, 0x0B, 0x3B, 0x70, 0x80, 0xD6, 0x86, 0xC0, 0x43, 0xB9, 0xD0, 0x80, 0x28, 0x7A, 0x1E,
-    0x6A, 0xC9, 0xE7, 0xFB, 0xCE, 0x95, 0x5A, 0xFD, 0xE6, 0x0D, 0x83, 0xF9, 0x9B, 0xE9, 0xE1, 0x69,
-    0xDE, 0xB4, 0x7E, 0xEE, 0xB9, 0xDF, 0x3D, 0xF7, 0x9C, 0xEF, 0xFC, 0x08, 0x63, 0xDC, 0xD9, 0x6B,
-    0xC6, 0xF8, 0x5D, 0x8B, 0xC3, 0xDA, 0x8C, 0x3F, 0x09, 0x0E, 0xCB, 0x54, 0x0E, 0x9D, 0x1C, 0xBC,
-    0x2E, 0x93, 0x4B, 0x3E, 0x90, 0x43, 0xF8, 0x6E, 0x6E, 0x4C, 0xF4, 0xA2, 0x1C, 0x92, 0x40, 0x0E,
-    0x13, 0x1C, 0x9A, 0xA0, 0x30, 0x6E, 0xED, 0x17, 0xC6, 0xAB, 0xFC, 0xD2, 0x04, 0x85, 0x57, 0x9A,
-    0x30, 0xF7, 0x2A, 0x13, 0x77, 0x5D, 0x65, 0xA6, 0x38, 0xB4, 0xB3, 0xD7, 0x2B, 0xA7, 0x91, 0x8B,
-    0xE4, 0x5B, 0xB9, 0xB2, 0x34, 0xCE, 0x2A, 0xCC, 0xE5, 0x10, 0xCB, 0x13, 0x1B, 0x0C, 0xD5, 0x1C,
-    0xE0, 0xA0, 0xF2, 0x4C, 0xBB, 0xC2, 0x04, 0x5D, 0x33, 0x12, 0x66, 0x59, 0x3E, 0x64, 0x92, 0xEE,
-    0x52, 0x1E, 0x7E, 0x3E, 0x69, 0xBC, 0x95, 0xE9, 0xB2, 0xA5, 0xF1, 0x6B, 0x79, 0x40, 0xE2, 0xAC,
-    0x64, 0xCC, 0x24, 0x35, 0x89, 0x3C, 0xD7, 0x2F, 0xE5, 0x41, 0x0B, 0x1F, 0x63, 0x4F, 0x8C, 0xD3,
-    0xC8, 0x2F, 0x49, 0x36, 0x31, 0x81, 0x0C, 0xE9, 0x76, 0x69, 0xF2, 0x56, 0x5B, 0x39, 0x5D, 0x1B,
-    0xCB, 0x3C, 0x1F, 0x91, 0xD1, 0xF9, 0x54, 0x37, 0x3D, 0x29, 0xC7, 0xCA, 0xC3, 0x5C, 0x2E, 0x96,
-    0x80, 0x40, 0x0E, 0x26, 0xDE, 0xDF, 0xC2, 0xC1, 0x34, 0x03, 0x10, 0x49, 0x81, 0xC3, 0x4A, 0x0E,
-    0xD1, 0xC4, 0x58, 0x24, 0xFC, 0xFF, 0xAE, 0x04, 0x9D, 0x6A, 0x6E, 0x30, 0x19, 0xA3, 0x50, 0x98,
-    0x85, 0x53, 0x03, 0x40, 0xB9, 0x28, 0x4E, 0xC3, 0x4C, 0xB1, 0x08, 0x3A, 0x99, 0x91, 0xDF, 0x75,
-    0x9D, 0xF1, 0x0E, 0x67, 0x17, 0x73, 0x82, 0x81, 0x67, 0x2F, 0x70, 0x59, 0x94, 0x89, 0xE8, 0x7E,
-    0x49, 0x34, 0x42, 0x42, 0x2B, 0x92, 0xC8, 0x2F, 0x6E, 0xBA, 0x63, 0xCC, 0x73, 0x4E, 0x25, 0xF7,
-    0xC8, 0xEA, 0xC4, 0x58, 0x84, 0xF3, 0xD9, 0xF7, 0x8E, 0xCB, 0x4D, 0x5A, 0x7B, 0x59, 0x10, 0xE0,
-    0x1F, 0x62, 0x82, 0x0F, 0x40, 0x82, 0x87, 0x86, 0x43, 0x82, 0x35, 0x89, 0xCA, 0xEF, 0x75, 0xE6,
-    0x6F, 0xCA, 0x53, 0x77, 0xE5, 0x27, 0xC0, 0xF8, 0x15, 0x04, 0xC1, 0x38, 0xAD, 0x00, 0xE0, 0xAF,
-    0x86, 0x61, 0x9D, 0x57, 0xE4, 0xE0, 0xF3, 0x6C, 0xDE, 0x03, 0x35, 0xC7, 0xF7, 0xE5, 0x96, 0xCE,
-    0xC4, 0xA2, 0xC1, 0x2E, 0x16, 0x3C, 0x6A, 0x5F, 0xAF, 0xCD, 0xB4, 0x30, 0x77, 0x18, 0xD9, 0x62,
-    0xC6, 0x5B, 0x0D, 0x77, 0x43, 0x95, 0x22, 0x3C, 0x02, 0x28, 0xE8, 0x73, 0x78, 0x98, 0xE2, 0x70,
-    0x70, 0xCC, 0x61, 0x3A, 0x5C, 0x92, 0xE4, 0x3D, 0x18, 0x41, 0x7B, 0xF6, 0x4D, 0x8C, 0xB3, 0xC2,
-    0x9E, 0xF9, 0x50, 0xBE, 0x78, 0x92, 0x32, 0xBE, 0xAA, 0xCF, 0x17, 0x8D, 0x81, 0x32, 0xEE, 0xC9,
-    0xB8, 0xF9, 0x20, 0x19, 0x74, 0xBC, 0xEB, 0xF2, 0xF0, 0xEA, 0xDF, 0x40, 0xA2, 0xA0, 0xE2, 0x33,
-    0xDD, 0x95, 0xCE, 0x47, 0x7E, 0x95, 0x85, 0x12, 0xD8, 0xA0, 0x91, 0x06, 0x8A, 0x89, 0x65, 0xF1,
-    0x6A, 0x40, 0x70, 0x32, 0x17, 0x0D, 0x96, 0xDB, 0x6B, 0x3B, 0x8A, 0x79, 0x16, 0x43, 0x75, 0x98,
-    0x15, 0x94, 0x24, 0x7C, 0x07, 0x0A, 0x21, 0x8B, 0x6F, 0x6A, 0x82, 0x77, 0x6B, 0x40, 0xF1, 0x17,
-    0x32, 0x90, 0xCC, 0x20, 0x5E, 0x19, 0xF7, 0xF3, 0xDA, 0x24, 0x6E, 0xE5, 0x96, 0x6E, 0xF1, 0xDD,
-    0x43, 0x71, 0x0A, 0x87, 0xF5, 0x70, 0x68, 0xCC, 0x35, 0x9F, 0x9B, 0x8A, 0xC2, 0x29, 0x18, 0x27,
-    0x9D, 0x61, 0x94, 0x8E, 0xA5, 0x72, 0xE4, 0xC2, 0xA4, 0xAB, 0xBC, 0xF6, 0xA9, 0x2C, 0xC9, 0x8C,
-    0xDB, 0xE8, 0xD4, 0x0F, 0x60, 0xD0, 0xF4, 0xD7, 0xA9, 0xDE, 0xD9, 0xA3, 0x90, 0xE8, 0x0C, 0x9D,
-    0xD6, 0xF9, 0x17, 0x19, 0x24, 0x77, 0xE0, 0x32, 0xEE, 0xC4, 0x83, 0x7E, 0x62, 0xEE, 0x12, 0xC1,
-    0x0D, 0xB0, 0x7B, 0x81, 0x86, 0x54, 0x2E, 0xF6, 0x30, 0x41, 0x67, 0x75, 0xCB, 0xC0, 0xF0, 0x63,
-    0xF9, 0x13, 0xA6, 0x73, 0x13, 0xBC, 0x2D, 0xE6, 0xB4, 0xCB, 0x55, 0x77, 0x47, 0x4B, 0x05, 0x75,
-    0x10, 0x30, 0x4C, 0xF7, 0xD2, 0xCB, 0x9E, 0x45, 0x0B, 0x10, 0xC4, 0x76, 0xDE, 0x89, 0x1D, 0x6B,
-    0x32, 0xFA, 0xE1, 0xF7, 0x29, 0x06, 0x3D, 0x0D, 0xFB, 0x6E, 0x08, 0xC8, 0x89, 0xD4, 0x0E, 0x66,
-    0xBC, 0x02, 0x1E, 0xE1, 0x02, 0xAE, 0x0A, 0xBB, 0x7E, 0xB7, 0x88, 0x4B, 0xD8, 0x46, 0xE4, 0x15,
-    0x9C, 0x15, 0x5C, 0xBC, 0x4E, 0xDC, 0xB0, 0xE0, 0x35, 0x2D, 0xC5, 0x27, 0xC8, 0x5A, 0xC8, 0x75,
-    0x49, 0x26, 0x12, 0xF8, 0x15, 0x56, 0xA3, 0x01, 0x92, 0x89, 0x9C, 0x11, 0xA1, 0x12, 0x2C, 0x10,
-    0x64, 0x6B, 0x70, 0x06, 0x16, 0x4F, 0x20, 0x93, 0x33, 0x41, 0xD9, 0x9F, 0x71, 0x61, 0xEB, 0x9C,
-    0x35, 0xDC, 0x50, 0x2B, 0xF7, 0xC8, 0xC0, 0x89, 0x39, 0xD9, 0x99, 0xF0, 0xF2, 0xC5, 0x16, 0x3E,
-    0x68, 0x0D, 0x70, 0xAC, 0x9B, 0x7B, 0xF2, 0x04, 0x8E, 0xBB, 0x01, 0xC1, 0xFB, 0x35, 0xD1, 0x7B,
-    0x0F, 0x2B, 0xE1, 0x55, 0xDC, 0xC6, 0xCD, 0x1B, 0xC6, 0xDA, 0x45, 0x55, 0x9E, 0xA0, 0xC5, 0x95,
-    0x61, 0xF7, 0x19, 0xE0, 0x11, 0xDB, 0x2B, 0xC7, 0xD2, 0xD3, 0xED, 0x33, 0x4D, 0xA1, 0x37, 0x34,
-    0xED, 0x54, 0xA0, 0x35, 0xE1, 0x4D, 0x08, 0x95, 0x7C, 0x2B, 0xF3, 0xA1, 0x25, 0xC6, 0x69, 0xAC,
-    0xF5, 0x84, 0xCB, 0x1E, 0x65, 0xEE, 0x1A, 0x83, 0xB9, 0x30, 0x22, 0x9D, 0xFF, 0x31, 0x1C, 0x4C,
-    0xF7, 0x5F, 0x15, 0xC0, 0x2A, 0xA0, 0x15, 0xCE, 0xB7, 0x83, 0xE9, 0x0A, 0x1C, 0x50, 0xB3, 0x14,
-    0x8D, 0x4B, 0xEE, 0x3E, 0x7C, 0xED, 0xDB, 0xC0, 0x34, 0xC0, 0x80, 0x8D, 0x70, 0xE7, 0x39, 0xD1,
-    0xAA, 0xA4, 0x13, 0x35, 0xA7, 0x4C, 0xAA, 0x0D, 0xC0, 0x87, 0xF0, 0x44, 0x40, 0x27, 0xFA, 0xFC,
-    0x17, 0x8D, 0x60, 0xE3, 0xB6, 0x0A, 0x0D, 0x91, 0x51, 0x60, 0x88, 0x0B, 0x61, 0x21, 0x2A, 0x04,
-    0x45, 0x31, 0x21, 0x24, 0x44, 0x44, 0x01, 0x21, 0x1E, 0x84, 0x43, 0xD1, 0xB0, 0x60, 0xCC, 0x66,
-    0xA9, 0x00, 0x52, 0x43, 0xBA, 0x8D, 0x22, 0xB9, 0x90, 0x57, 0x44, 0xCA, 0x3D, 0xEC, 0x2F, 0xC8,
-    0x03, 0xE3, 0x4F, 0xE7, 0x44, 0x57, 0xD5, 0x58, 0xD1, 0x85, 0x75, 0x88, 0xE8, 0x97, 0x67, 0xA9,
-    0x5C, 0x57, 0xE3, 0x06, 0x08, 0x00, 0x1A, 0x72, 0xE4, 0x3A, 0x80, 0x42, 0x5D, 0x05, 0xAC, 0x26,
-    0x99, 0xCD, 0x32, 0x1F, 0x0F, 0x5E, 0x62, 0xD2, 0x66, 0x67, 0xF6, 0x8A, 0xEC, 0xAC, 0xD2, 0xE9,
-    0xBA, 0x41, 0x99, 0xE3, 0x16, 0x4B, 0x63, 0x92, 0xF7, 0xD7, 0xDE, 0x0A, 0xBE, 0xDD, 0x2F, 0x65,
-    0x6D, 0x1E, 0x2B, 0x9D, 0x26, 0x79, 0x78, 0x59, 0xC8, 0x9D, 0x5E, 0xD7, 0xA6, 0xD1, 0x3E, 0x91,
-    0xC2, 0x1A, 0xD1, 0xC2, 0x14, 0xDC, 0x3A, 0x69, 0x2C, 0x92, 0x47, 0x02, 0xA3, 0x23, 0x0F, 0x73,
-    0xF6, 0xDD, 0xCC, 0xDC, 0x6B, 0x2E, 0xC8, 0x8A, 0x08, 0x01, 0x09, 0xC0, 0xC8, 0x4E, 0x97, 0x37,
-    0x69, 0x96, 0xB7, 0x8B, 0x55, 0x8B, 0x44, 0x94, 0xF0, 0xE3, 0x5A, 0xB9, 0xE1, 0xC1, 0x66, 0xEB,
-    0x06, 0x72, 0x01, 0xAD, 0xC5, 0xCF, 0x6A, 0xCC, 0x37, 0x28, 0x41, 0x6A, 0xDC, 0x3A, 0xCA, 0xFC,
-    0x0A, 0x13, 0x4E, 0x00, 0x85, 0x98, 0x9E, 0x49, 0x7A, 0xAC, 0xB5, 0x48, 0xC5, 0x5A, 0xA4, 0x6A,
-    0x2D, 0x68, 0x87, 0x33, 0x6B, 0x5C, 0x60, 0x74, 0xE0, 0xB0, 0xB7, 0x3E, 0x3F, 0xE8, 0x9C, 0x65,
-    0xD2, 0xBC, 0x12, 0x3B, 0x34, 0xCC, 0xB6, 0xC5, 0xA0, 0x7D, 0xF4, 0xD6, 0x4F, 0x17, 0x49, 0x16,
-    0xFD, 0x6A, 0x65, 0x26, 0x98, 0xF0, 0xC4, 0x44, 0x6F, 0xD7, 0xA7, 0xD7, 0xB2, 0x0D, 0x72, 0x99,
-    0xAF, 0x73, 0xF5, 0x38, 0x67, 0xF1, 0x86, 0xCC, 0xA0, 0xE0, 0x6C, 0x4F, 0x71, 0x2B, 0x77, 0x05,
-    0x67, 0x82, 0x29, 0x0D, 0x12, 0x06, 0xBD, 0x84, 0x10, 0x95, 0x5E, 0x83, 0x12, 0xB6, 0xA2, 0x68,
-    0x98, 0x09, 0xA7, 0x34, 0x4C, 0x7D, 0xEB, 0x3A, 0x58, 0x25, 0x9D, 0x3A, 0xAC, 0xD6, 0xE1, 0xEC,
-    0x55, 0xB0, 0x4E, 0x78, 0x68, 0x9C, 0xBC, 0x60, 0xB9, 0xA4, 0x8F, 0xC7, 0xE3, 0x8B, 0x10, 0x4B,
-    0xD8, 0x82, 0xD0, 0x8E, 0xBD, 0xF4, 0xB7, 0x56, 0x5E, 0x31, 0x23, 0xE0, 0x59, 0xF2, 0xDD, 0x19,
-    0xB9, 0xA4, 0xD2, 0x01, 0x23, 0x31, 0x12, 0x71, 0x4F, 0x37, 0xF6, 0xE5, 0x0F, 0xDC, 0x0F, 0xFD,
-    0x01, 0xFC, 0x8F, 0x89, 0x2A, 0x3B, 0xF7, 0x8D, 0x2F, 0xF8, 0xE1, 0x90, 0xB9, 0xDD, 0xEC, 0x88,
-    0x38, 0x7B, 0xC6, 0x7F, 0x0F, 0x76, 0xA4, 0x50, 0xA6, 0x3F, 0x12, 0xE6, 0x3B, 0xD5, 0x6F, 0xF3,
-    0x97, 0x9C, 0x1E, 0x04, 0x8C, 0x21, 0x61, 0xFC, 0xB8, 0x2C, 0x40, 0xFC, 0xB0, 0x88, 0x76, 0xAF,
-    0xFC, 0xD9, 0x76, 0x87, 0x82, 0xD9, 0x92, 0xDC, 0xE2, 0xF2, 0x45, 0xB1, 0x2F, 0xA9, 0x79, 0xC6,
-    0xD0, 0xC8, 0x75, 0x1B, 0x5F, 0x9F, 0xF6, 0x14, 0x81, 0x33, 0xF6, 0xD4, 0x4D, 0x99, 0x93, 0xB3,
-    0xFD, 0xA9, 0xE0, 0x8A, 0xA8, 0xA2, 0x5B, 0x23, 0x7C, 0x4A, 0x94, 0xCA, 0x91, 0xCD, 0x44, 0xF0,
-    0x3A, 0xB8, 0x72, 0x81, 0x07, 0x25, 0x60, 0x09, 0x32, 0x9B, 0xEE, 0xA5, 0xF3, 0x25, 0x40, 0xAF,
-    0x31, 0xE4, 0xC0, 0x96, 0x8C, 0xBB, 0x6F, 0xC9, 0x84, 0x8B, 0x55, 0x8A, 0x9F, 0x4E, 0x8D, 0x5B,
-    0xC5, 0x50, 0xA3, 0xFB, 0xB7, 0x76, 0x43, 0x86, 0xF0, 0xE6, 0x52, 0xEE, 0xAD, 0xCF, 0x2D, 0xE1,
-    0x81, 0x56, 0xE2, 0x8B, 0xA2, 0x02, 0x11, 0x08, 0xC0, 0x68, 0x84, 0x29, 0xFA, 0x70, 0x31, 0x8C,
-    0xEC, 0x16, 0x34, 0xFC, 0xB2, 0xA2, 0x51, 0x2E, 0x3B, 0xA3, 0x35, 0x88, 0x41, 0x44, 0xE4, 0x65,
-    0xE1, 0xAD, 0xA3, 0x8B, 0x62, 0x5A, 0x56, 0x88, 0x0C, 0x1F, 0x15, 0x99, 0x53, 0xF2, 0xB3, 0x79,
-    0x3F, 0xAD, 0x38, 0x73, 0xC1, 0x42, 0xC3, 0x8F, 0x96, 0x85, 0xA0, 0x2D, 0x68, 0xFE, 0xB4, 0xA5,
-    0x05, 0x82, 0x61, 0x12, 0x0D, 0x8B, 0x8C, 0x5A, 0x49, 0xD1, 0x3F, 0xEC, 0xD4, 0x83, 0x2D, 0x62,
-    0x21, 0x53, 0xDA, 0x87, 0xE9, 0x00, 0x51, 0x9D, 0x2D, 0x33, 0x7F, 0x2D, 0x56, 0x06, 0x5C, 0x98,
-    0x84, 0x98, 0xDC, 0xD6, 0xB2, 0xD5, 0xE9, 0x40, 0x4A, 0x68, 0x25, 0x64, 0xE0, 0xBB, 0x67, 0x0F,
-    0xCB, 0xA0, 0x5D, 0x79, 0x20, 0x78, 0xD6, 0x8C, 0xD2, 0x46, 0x78, 0x4E, 0xB1, 0xC3, 0xE1, 0x3B,
-    0x6B, 0x3C, 0xA8, 0x31, 0x53, 0xD1, 0x13, 0x10, 0xAE, 0x65, 0x86, 0x75, 0x2B, 0xAC, 0xCB, 0x74,
-    0x9E, 0xA0, 0x59, 0x13, 0x5B, 0xEE, 0x67, 0xB2, 0xC2, 0xD1, 0xC7, 0x15, 0xD6, 0x56, 0x06, 0x39,
-    0xFD, 0xB2, 0x39, 0x12, 0xC5, 0x45, 0xDD, 0x15, 0x51, 0xB3, 0xA7, 0x3E, 0xC9, 0x49, 0x24, 0x10,
-    0xC6, 0xD1, 0x57, 0x46, 0x78, 0xAE, 0x08, 0xDD, 0x30, 0x8E, 0xA3, 0xA7, 0x9C, 0xA8, 0x7F, 0xF7,
-    0x2B, 0x06, 0x72, 0xF4, 0x93, 0x89, 0x89, 0x6B, 0xD3, 0x3D, 0xF6, 0xB1, 0xE8, 0x4B, 0x9B, 0x58,
-    0x2F, 0x79, 0x87, 0x4F, 0x45, 0xEB, 0x99, 0xB8, 0xC8, 0x9E, 0xC9, 0x24, 0xBD, 0xAB, 0xE7, 0x6B,
-    0x78, 0xEB, 0xD4, 0xEC, 0x58, 0x9F, 0x0E, 0x4B, 0xA7, 0x73, 0x26, 0xF5, 0x34, 0xAB, 0x6B, 0x69,
-    0xFB, 0x2D, 0x00, 0xA2, 0x3A, 0x07, 0xEA, 0xFB, 0xD2, 0x58, 0xE3, 0x7D, 0x44, 0xC6, 0x9B, 0x09,
-    0xA2, 0xDA, 0x8A, 0xAB, 0xC6, 0xC6, 0xFB, 0x87, 0xAF, 0xAF, 0x40, 0xEB, 0xEF, 0x52, 0x32, 0xAE,
-    0x8C, 0x3C, 0xEF, 0x79, 0x3D, 0x61, 0xA6, 0x41, 0x52, 0xDE, 0x2D, 0x63, 0xCD, 0x5E, 0x91, 0xD3,
-    0x5D, 0x1B, 0xC0, 0xB5, 0x3C, 0xB2, 0xD9, 0xAF, 0xC4, 0x4B, 0x49, 0x22, 0xC2, 0xB7, 0x54, 0x1E,
-    0x14, 0xE6, 0x3E, 0xD9, 0xD3, 0xF2, 0xA3, 0x73, 0x2B, 0x90, 0x6D, 0xE6, 0x43, 0x64, 0x5C, 0x0D,
-    0x40, 0x94, 0xC1, 0x0F, 0xF6, 0x40, 0x51, 0xE2, 0x82, 0xC2, 0x03, 0x98, 0xDB, 0xEC, 0x15, 0x77,
-    0x19, 0xB5, 0xCE, 0xEA, 0x06, 0x9A, 0xFE, 0x9E, 0xD8, 0xDC, 0x2A, 0x3B, 0x5B, 0x2D, 0x65, 0x50,
-    0x1B, 0x6B, 0x7D, 0xCC, 0x02, 0x9C, 0x33, 0x7E, 0x18, 0x1E, 0x25, 0xF3, 0xB7, 0xFC, 0xB1, 0x68,
-    0x9B, 0x57, 0x7A, 0xC4, 0x28, 0x81, 0x2D, 0x84, 0xC3, 0x68, 0x40, 0x1E, 0xC2, 0x5C, 0x0C, 0xA3,
-    0xC8, 0xD5, 0xC0, 0x03, 0x50, 0xC9, 0x94, 0x14, 0xE3, 0x86, 0xCA, 0x6D, 0x67, 0xB3, 0x16, 0x8E,
-    0x83, 0xAE, 0x46, 0xF9, 0x04, 0x6F, 0x90, 0xCB, 0x71, 0x43, 0xC6, 0x1B, 0x0C, 0x6F, 0x90, 0x19,
-    0xC9, 0x0D, 0x35, 0x78, 0x2F, 0xD3, 0x53, 0x6A, 0x40, 0x79, 0x83, 0xCF, 0x1B, 0x8C, 0x83, 0xDD,
-    0x2C, 0xCA, 0x6B, 0xA2, 0xB5, 0xA6, 0xC2, 0xC4, 0x4B, 0x64, 0xE2, 0x02, 0x1F, 0xB2, 0x32, 0x9E,
-    0x3A, 0x96, 0xA3, 0xC4, 0x3D, 0x0A, 0x98, 0x9B, 0x5F, 0x2E, 0x85, 0xC9, 0x4F, 0xBB, 0x2C, 0xFC,
-    0xE0, 0x1F, 0x1A, 0x23, 0xEE, 0xA9, 0x08, 0x2B, 0x81, 0x75, 0x2D, 0x33, 0x8A, 0x73, 0xA2, 0x4D,
-    0x26, 0x0F, 0xA6, 0x1E, 0x65, 0x7B, 0xF2, 0x80, 0x00, 0x0B, 0xD1, 0x28, 0x81, 0x9F, 0x40, 0x93,
-    0x0B, 0x99, 0xD8, 0xC2, 0xAD, 0xEC, 0x75, 0x7C, 0xBC, 0x57, 0x8E, 0xE2, 0x90, 0x85, 0xD1, 0xF9,
-    0x47, 0x1D, 0x3E, 0x21, 0x8F, 0xBF, 0xBD, 0x78, 0x79, 0xF6, 0x7A, 0xBB, 0x3F, 0x3E, 0xAD, 0x41,
-    0x03, 0x08, 0xD4, 0xC5, 0x12, 0x3A, 0x2E, 0x6E, 0x41, 0x11, 0xDA, 0x3E, 0x6D, 0x6C, 0x14, 0x23,
-    0x33, 0x51, 0xC4, 0x35, 0xD7, 0x87, 0xD3, 0xDC, 0x6D, 0x47, 0x4F, 0xBB, 0x7A, 0x9A, 0xE4, 0x76,
-    0x70, 0xCF, 0x7F, 0xBC, 0x3E, 0x8B, 0x87, 0x57, 0xB2, 0x10, 0xAD, 0x75, 0xCF, 0x70, 0xF7, 0x7B,
-    0xFE, 0x55, 0x09, 0x4F, 0x65, 0xE0, 0xA6, 0x5D, 0xE6, 0xE1, 0x5A, 0x76, 0x6E, 0x97, 0x06, 0x45,
-    0x54, 0xC8, 0xF4, 0x1A, 0x4C, 0x2F, 0x65, 0xC4, 0xC7, 0x64, 0xD6, 0x4A, 0x56, 0x20, 0x16, 0x3A,
-    0x41, 0x18, 0x88, 0x47, 0x29, 0xC3, 0xEF, 0xC9, 0x68, 0x01, 0xA2, 0xCE, 0xC6, 0x46, 0x62, 0xA9,
-    0x2B, 0x4C, 0xC1, 0x15, 0xE6, 0xF8, 0x65, 0x65, 0xAA, 0x69, 0x65, 0x7E, 0xE9, 0xBE, 0x3C, 0x36,
-    0x6E, 0x12, 0x3B, 0xC1, 0xF7, 0xC3, 0x73, 0xC0, 0x78, 0x41, 0x34, 0x40, 0x42, 0xF6, 0xB0, 0x67,
-    0x57, 0x6A, 0xEB, 0xCB, 0x85, 0xF5, 0xF3, 0xD7, 0xFF, 0xB2, 0xD4, 0x1C, 0x0A, 0x28, 0x91, 0xE6,
-    0x70, 0x9F, 0x70, 0xB2, 0x69, 0xF9, 0x50, 0xD8, 0x7D, 0xF2, 0x48, 0xB9, 0xAC, 0x7E, 0x62, 0x5E,
-    0x1D, 0xEF, 0x56, 0xC5, 0x14, 0xB0, 0x88, 0xDA, 0xE0, 0x59, 0xD4, 0x51, 0x63, 0x61, 0x84, 0x08,
-    0xAA, 0x99, 0x76, 0x35, 0x71, 0xDA, 0xAD, 0x6C, 0xB8, 0x7F, 0x4C, 0x0C, 0xB2, 0x04, 0x1D, 0x5A,
-    0x73, 0x3E, 0x80, 0xBD, 0xCF, 0xE3, 0xAC, 0x74, 0xB0, 0xD8, 0xE6, 0x70, 0x2A, 0x55, 0xC5, 0xC5,
-    0x26, 0xCD, 0x61, 0x2F, 0xC2, 0x58, 0x89, 0xBD, 0xA8, 0x64, 0xE4, 0x8F, 0x59, 0x2C, 0x65, 0x1F,
-    0x9E, 0x9C, 0xBD, 0x16, 0x08, 0xAB, 0x18, 0x72, 0xD2, 0x7B, 0xBC, 0x9D, 0xA6, 0x5B, 0xB6, 0x8A,
-    0xDC, 0x2B, 0xC3, 0xC9, 0xC3, 0x68, 0x65, 0x31, 0x96, 0x3C, 0x29, 0x84, 0xC9, 0xC2, 0x40, 0x22,
-    0x73, 0xAC, 0xCF, 0x85, 0xDB, 0x0E, 0x65, 0x6F, 0x84, 0x1F, 0xAF, 0xAE, 0x89, 0x27, 0x90, 0x19,
-    0xC1, 0x5A, 0xB8, 0x57, 0x75, 0x93, 0x78, 0x95, 0xFE, 0x00, 0x06, 0x08, 0xCF, 0xA8, 0xDB, 0xFE,
-    0x40, 0x7A, 0x2C, 0x57, 0x9F, 0x96, 0x48, 0x2C, 0x01, 0x5B, 0x58, 0x0D, 0x6B, 0xD4, 0xF6, 0xB9,
-    0x4C, 0x7F, 0x64, 0x3A, 0x01, 0xB3, 0xE3, 0x96, 0x7E, 0x36, 0xBD, 0x28, 0xF4, 0xAF, 0x30, 0xBF,
-    0xE8, 0x0D, 0x09, 0x74, 0x77, 0xC1, 0x07, 0xC8, 0x73, 0xBD, 0x92, 0x28, 0x0C, 0xFF, 0x46, 0x6C,
-    0x5C, 0x6F, 0xFF, 0x1B, 0x92, 0xCD, 0x2D, 0xFE, 0x31, 0x2C, 0xC8, 0x9A, 0x02, 0x5F, 0xBB, 0x6A,
-    0xF9, 0x91, 0x55, 0xB3, 0xA7, 0xD5, 0x5C, 0x8D, 0x16, 0x15, 0x72, 0x0A, 0xCE, 0x22, 0x26, 0xC1,
-    0x7D, 0x83, 0xFC, 0x59, 0x8C, 0x33, 0x8C, 0x74, 0x8C, 0xE0, 0x21, 0x55, 0x63, 0x88, 0xCF, 0x33,
-    0xB8, 0x5D, 0xDC, 0xC5, 0x99, 0x4D, 0xFE, 0x0A, 0xDA, 0x6E, 0xB8, 0xEB, 0x3D, 0x98, 0x07, 0x91,
-    0x55, 0xF5, 0x7E, 0x32, 0x3E, 0x25, 0x32, 0x89, 0x04, 0x73, 0xAE, 0x4E, 0x66, 0xDE, 0x84, 0x70,
-    0x67, 0x90, 0xA6, 0xF4, 0x0E, 0x87, 0xCC, 0xEE, 0xED, 0x2A, 0xDA, 0xD4, 0xEE, 0xC3, 0x8D, 0x2B,
-    0x58, 0x73, 0x51, 0xE2, 0xFD, 0x7E, 0x1B, 0xDB, 0x09, 0x60, 0x45, 0xE6, 0x83, 0xEE, 0xCA, 0xC0,
-    0xA3, 0xD3, 0x16, 0x85, 0x2D, 0xD5, 0x76, 0xB1, 0xE0, 0x2B, 0xAE, 0x84, 0xC0, 0xB3, 0xA0, 0xAD,
-    0x15, 0x56, 0x8D, 0x94, 0x38, 0xBC, 0x87, 0x5F, 0x88, 0xD5, 0xCB, 0xE1, 0xAE, 0xE3, 0x34, 0xC6,
-    0x03, 0x04, 0xDB, 0x20, 0x07, 0xBA, 0x0D, 0xF0, 0xA5, 0x12, 0xA9, 0x31, 0x43, 0xB6, 0xC3, 0xAA,
-    0x59, 0x82, 0x47, 0x21, 0xE5, 0x9E, 0xAB, 0x2E, 0x06, 0x54, 0x38, 0x9A, 0x2B, 0x3A, 0xFA, 0xED,
-    0x1B, 0xE4, 0x3F, 0xA6, 0x1C, 0x50, 0x89, 0x28, 0xE8, 0xC7, 0xAC, 0x92, 0x52, 0x83, 0x71, 0x43,
-    0x86, 0xA4, 0x4A, 0x27, 0x12, 0xC8, 0x4A, 0xA8, 0x93, 0xE6, 0x32, 0x2B, 0x37, 0x02, 0xC9, 0xB9,
-    0x73, 0x89, 0x7A, 0x47, 0x87, 0x7F, 0x4F, 0x89, 0x1B, 0xE9, 0xC9, 0x49, 0x58, 0xB6, 0x46, 0x44,
-    0x88, 0x72, 0x71, 0xF2, 0x35, 0x5D, 0xDC, 0xE8, 0xE3, 0x17, 0xB2, 0x61, 0x17, 0xF2, 0xA8, 0x30,
-    0x17, 0x68, 0xE1, 0x6E, 0xC2, 0x2C, 0x28, 0xE8, 0x9D, 0xE2, 0x94, 0x85, 0x82, 0x15, 0x4C, 0xB3,
-    0x84, 0xAA, 0x72, 0xDD, 0x1E, 0x58, 0x50, 0x21, 0xDF, 0xF1, 0xBA, 0x9C, 0xD7, 0xCD, 0x79, 0x9D,
-    0x5B, 0x31, 0x67, 0xB2, 0x09, 0x73, 0x7B, 0x17, 0x32, 0xB1, 0xE4, 0xE2, 0x6F, 0x1B, 0xF0, 0x10,
-    0xEB, 0x8D, 0xE4, 0x73, 0xB7, 0xB1, 0xBF, 0x3B, 0x30, 0x70, 0xAC, 0xD2, 0x44, 0xD9, 0xCA, 0x8C,
-    0x7C, 0x93, 0x7E, 0x16, 0x03, 0x1B, 0x69, 0xFA, 0x74, 0x25, 0xC9, 0x03, 0x47, 0xF1, 0xAA, 0xFE,
-    0xC0, 0x68, 0x8C, 0xF1, 0x06, 0xDD, 0xD9, 0xE6, 0x00, 0x89, 0x94, 0xF8, 0x6D, 0x72, 0x95, 0x4C,
-    0x13, 0x4D, 0xAE, 0xF3, 0x74, 0x7D, 0xF0, 0xF0, 0xF4, 0x50, 0x1E, 0xFC, 0x67, 0x53, 0xD8, 0x20,
-    0x98, 0x31, 0x16, 0x97, 0x4E, 0x98, 0x21, 0x0C, 0x01, 0x3B, 0x04, 0x0F, 0x40, 0xF6, 0x1A, 0x41,
-    0xC8, 0x38, 0x7D, 0x6D, 0xF3, 0x71, 0x85, 0x7D, 0x50, 0x63, 0x07, 0xBE, 0xFE, 0x97, 0xF9, 0xE8,
-    0xCB, 0x89, 0x95, 0x7A, 0xF8, 0x72, 0x35, 0xFA, 0x12, 0x13, 0xC3, 0x84, 0x7F, 0x53, 0xAB, 0x44,
-    0x21, 0xB5, 0x81, 0x46, 0x0C, 0xCE, 0x06, 0xB9, 0xAC, 0x04, 0xEA, 0x25, 0xFE, 0x68, 0x81, 0x43,
-    0x8C, 0x03, 0xDD, 0x13, 0x2B, 0x2F, 0xCE, 0x2A, 0x81, 0x79, 0xC5, 0x21, 0xC1, 0x0A, 0x84, 0x30,
-    0x75, 0x1E, 0xB6, 0xB7, 0xD3, 0xD2, 0xF0, 0xEA, 0x2E, 0xE1, 0x06, 0x89, 0x60, 0x56, 0x04, 0x0D,
-    0x87, 0x31, 0xEC, 0x42, 0x3D, 0xAC, 0x4B, 0x85, 0x9C, 0xD2, 0x93, 0x16, 0x82, 0x97, 0xB3, 0x9D,
-    0x50, 0x5F, 0x0D, 0xC8, 0xEE, 0x9A, 0x9E, 0xBC, 0xB1, 0x56, 0xA3, 0xE9, 0xB1, 0x13, 0xE9, 0xB1,
-    0xF1, 0x72, 0xB5, 0xAD, 0x35, 0x91, 0x68, 0x97, 0xA8, 0x76, 0x03, 0x12, 0x06, 0x3A, 0xBE, 0x12,
-    0x49, 0xA2, 0xC7, 0x2A, 0xE3, 0x5E, 0x41, 0xCE, 0x92, 0x21, 0x7A, 0xA5, 0xE6, 0x33, 0x58, 0xA1,
-    0x4A, 0x17, 0x94, 0x96, 0x5F, 0x88, 0x3C, 0x20, 0x49, 0xF2, 0x17, 0x88, 0x33, 0xB3, 0x8E, 0xC9,
-    0x28, 0xF0, 0xE2, 0xA0, 0x75, 0xCF, 0x6D, 0x72, 0x5B, 0x4A, 0xBA, 0x4D, 0x9D, 0xC6, 0x91, 0x41,
-    0x9D, 0x61, 0xD0, 0xEA, 0x9B, 0x0D, 0xBA, 0x93, 0x31, 0x87, 0x7A, 0x40, 0x35, 0x84, 0xE5, 0x7A,
-    0x63, 0xE3, 0x4F, 0x8E, 0x1A, 0xA3, 0xEB, 0x9A, 0xE4, 0xF2, 0x88, 0x49, 0x66, 0x3A, 0x39, 0x1D,
-    0x2C, 0xDA, 0xE1, 0xEC, 0xD5, 0x69, 0xD7, 0xBD, 0xC3, 0xA4, 0xC1, 0x8E, 0x16, 0x09, 0xA6, 0xEA,
-    0x2E, 0xE4, 0xFE, 0xE7, 0x06, 0x9A, 0xB7, 0x6D, 0x0A, 0xE3, 0xEB, 0x9B, 0x42, 0x80, 0xB3, 0xED,
-    0x2F, 0xBE, 0x42, 0x38, 0x3E, 0x49, 0xC7, 0xB2, 0xAE, 0xE9, 0xE8, 0xBF, 0xBF, 0x8E, 0xEB, 0xBA,
-    0x3C, 0xFB, 0xE7, 0xAE, 0x6B, 0x91, 0x37, 0xD6, 0x0F, 0xEE, 0xAE, 0xA9, 0x47, 0x17, 0x58, 0x5F,
-    0xBC, 0xCD, 0xCE, 0x81, 0xFE, 0x5C, 0x9D, 0xB9, 0x5B, 0x6D, 0xFC, 0xF9, 0xE0, 0xCC, 0x45, 0x7A,
-    0x01, 0x86, 0x16, 0xD5, 0xA6, 0xB5, 0x17, 0x74, 0x03, 0xA3, 0xFB, 0xF4, 0xA6, 0x61, 0x18, 0xF1,
-    0x13, 0xB8, 0x89, 0xA3, 0xDC, 0xC1, 0xD9, 0xDC, 0x6D, 0x60, 0xE8, 0xC5, 0xE8, 0xE7, 0xCE, 0x4A,
-    0xA4, 0x5E, 0x38, 0xE2, 0x9C, 0xCC, 0xCB, 0x5F, 0xCD, 0xA7, 0xAE, 0xF9, 0x12, 0xA8, 0x51, 0xC9,
-    0x86, 0x2F, 0x2F, 0xCF, 0x5E, 0x46, 0x12, 0xCF, 0xE5, 0x24, 0x9D, 0xF4, 0x09, 0x93, 0x88, 0xD4,
-    0x8D, 0xA8, 0xCA, 0x1F, 0xC4, 0x05, 0x3C, 0x2E, 0xDE, 0xEF, 0xB9, 0x81, 0xEC, 0x4C, 0xCC, 0x98,
-    0x1C, 0x99, 0x9E, 0x1C, 0xA5, 0x47, 0xC9, 0x91, 0x7B, 0x5D, 0x72, 0xF4, 0xF5, 0xB4, 0xCB, 0x49,
-    0x13, 0x73, 0xE0, 0x95, 0x61, 0x39, 0x31, 0xF3, 0xAF, 0xA3, 0x5D, 0x4E, 0x7A, 0x0C, 0x67, 0x1A,
-    0x60, 0x06, 0xC6, 0xA7, 0xCC, 0xEA, 0xC0, 0xA9, 0x5B, 0xB7, 0xBE, 0x30, 0x5E, 0x1B, 0xF5, 0x7B,
-    0xC3, 0x7D, 0x7A, 0xD3, 0x0D, 0x19, 0xC8, 0xEF, 0x72, 0xB3, 0x6E, 0xC5, 0x34, 0x65, 0x46, 0xFE,
-    0x93, 0x88, 0x35, 0x41, 0x8A, 0xD7, 0x98, 0x3F, 0xB5, 0xFE, 0x7D, 0xA3, 0xB5, 0x12, 0x2F, 0x49,
-    0xE0, 0xF0, 0x29, 0xAB, 0x0E, 0x70, 0x74, 0xCC, 0xD5, 0xC7, 0xA9, 0x5B, 0xA9, 0x5F, 0x9D, 0x40,
-    0x04, 0xF9, 0xF6, 0x7F, 0x4D, 0x57, 0xC4, 0x55, 0x50, 0xCB, 0x43, 0x96, 0x95, 0x33, 0x01, 0xA6,
-    0x73, 0x75, 0xAF, 0x12, 0x62, 0xD7, 0x7A, 0x2D, 0x3E, 0x3F, 0x37, 0xBD, 0xF9, 0x57, 0xB3, 0xA1,
-    0x9E, 0x56, 0xCB, 0x72, 0xD5, 0x91, 0x9A, 0x61, 0x86, 0xD5, 0xE9, 0xB0, 0x3E, 0x1E, 0xA2, 0xDD,
-    0x34, 0xA2, 0xA2, 0x2D, 0x31, 0x77, 0xEF, 0x0B, 0x31, 0x0D, 0x59, 0xF8, 0x62, 0x2E, 0x56, 0x65,
-    0x57, 0xFC, 0x42, 0xE5, 0xD4, 0xF4, 0x98, 0x39, 0xBC, 0x64, 0xC2, 0x88, 0xAF, 0xF1, 0x4A, 0x54,
-    0xE3, 0xC3, 0x3C, 0x96, 0xC7, 0x47, 0x69, 0x23, 0xF2, 0x24, 0x0C, 0x18, 0xE7, 0x62, 0x4A, 0xC4,
-    0xD9, 0x23, 0x92, 0xF3, 0x3E, 0x45, 0x7C, 0x17, 0x7C, 0x90, 0x03, 0xC4, 0x03, 0x62, 0xC7, 0xD8,
-    0x6F, 0xCA, 0x00, 0xAF, 0xC3, 0x22, 0xB8, 0x5C, 0xF0, 0x9D, 0xCC, 0xFE, 0x36, 0x1D, 0xE9, 0x65,
-    0xBF, 0xFD, 0xE9, 0xB2, 0x2E, 0x84, 0xAD, 0x09, 0x2E, 0x89, 0x95, 0x5F, 0xAF, 0xCF, 0x17, 0x88,
-    0x5D, 0x9C, 0xCE, 0x04, 0x65, 0x2C, 0xB1, 0x8B, 0x38, 0xB1, 0xB0, 0xB0, 0xB1, 0x4B, 0x24, 0x66,
-    0xCF, 0x5D, 0x05, 0x60, 0x64, 0xEB, 0x4D, 0xEC, 0xE2, 0x57, 0xB2, 0x76, 0x07, 0x22, 0xC9, 0x70,
-    0x1D, 0x09, 0xC9, 0xAD, 0x33, 0xFD, 0x6D, 0x9F, 0x6B, 0x37, 0x01, 0xAD, 0xBB, 0xFA, 0x20, 0x2D,
-    0xFF, 0xDB, 0xF2, 0x8C, 0xF0, 0x22, 0x3F, 0x17, 0x9F, 0x37, 0x9F, 0x76, 0x79, 0xF8, 0xC1, 0xBF,
-    0x4B, 0x10, 0x57, 0x84, 0x45, 0x54, 0xC9, 0x04, 0x11, 0xD4, 0x26, 0xA2, 0x78, 0x36, 0xA8, 0x75,
-    0x90, 0xE2, 0x88, 0xB3, 0x03, 0x51, 0x82, 0xB0, 0xD8, 0x04, 0xB5, 0x53, 0x91, 0x5E, 0x90, 0x4B,
-    0x87, 0xEB, 0xB6, 0x0A, 0xCA, 0x7D, 0x3A, 0x9F, 0x69, 0x0C, 0x50, 0x61, 0x66, 0x05, 0x48, 0xC5,
-    0x84, 0x8B, 0x9D, 0x44, 0x36, 0x90, 0x1C, 0x2C, 0xD6, 0x06, 0x05, 0xED, 0x5E, 0xC9, 0x8F, 0x29,
-    0x4B, 0xDF, 0x42, 0xF8, 0xEE, 0x8B, 0x05, 0x94, 0xF8, 0x55, 0x36, 0xE9, 0x7B, 0x35, 0x68, 0x5C,
-    0x6A, 0x39, 0x47, 0x34, 0x24, 0x3C, 0x4E, 0xA9, 0x82, 0xB9, 0x57, 0xBA, 0xCE, 0x10, 0xD3, 0xA4,
-    0xF6, 0x6A, 0x6A, 0x98, 0x84, 0x07, 0xCC, 0x0F, 0x21, 0x5A, 0x06, 0x9B, 0x46, 0x26, 0x26, 0x17,
-    0x97, 0x08, 0x54, 0x89, 0x1F, 0x75, 0x0C, 0x60, 0x13, 0x56, 0x04, 0x05, 0x29, 0x94, 0x8C, 0x68,
-    0xAB, 0x69, 0x65, 0xF9, 0x99, 0xFB, 0x33, 0x28, 0x07, 0x5E, 0x97, 0x8A, 0x5B, 0x48, 0xC2, 0xB7,
-    0xBA, 0xE2, 0x42, 0xF8, 0x62, 0x57, 0x9F, 0x8A, 0x96, 0xFF, 0xD8, 0x20, 0x79, 0x2D, 0x07, 0x52,
-    0x51, 0xEC, 0x6C, 0x21, 0x41, 0x8D, 0x81, 0x3E, 0x73, 0x30, 0x8E, 0xAF, 0x4F, 0x85, 0x46, 0x73,
-    0x34, 0x30, 0x99, 0x82, 0x52, 0x50, 0xA7, 0x65, 0xB9, 0xA3, 0x0C, 0xCA, 0x9F, 0xDD, 0x10, 0xFD,
-    0x68, 0x40, 0x3F, 0x05, 0xFA, 0xBB, 0x1B, 0xF4, 0x1D, 0x45, 0xBF, 0x02, 0xFA, 0x41, 0x0E, 0xEE,
-    0x1C, 0x65, 0x1B, 0xF4, 0x17, 0x40, 0xDF, 0x10, 0x7D, 0x97, 0xE8, 0xFB, 0x8A, 0x7E, 0xCB, 0xB0,
-    0x42, 0x13, 0x3B, 0x1B, 0xF4, 0x95, 0x59, 0x91, 0xDC, 0x2A, 0x89, 0xE5, 0x17, 0x77, 0x9E, 0x07,
-    0xC9, 0x64, 0x3F, 0x98, 0xC7, 0xEA, 0xA6, 0x55, 0x2F, 0xEA, 0xFC, 0x92, 0x8A, 0xFD, 0xCD, 0xB3,
-    0x35, 0xE5, 0x91, 0x6C, 0xCD, 0x31, 0x9C, 0x5E, 0xF8, 0x8C, 0x7B, 0x1E, 0xDD, 0x07, 0x88, 0x83,
-    0x99, 0x5E, 0xBD, 0x5B, 0x62, 0x7D, 0xD1, 0x8B, 0xB5, 0xD9, 0xAE, 0x79, 0xE2, 0x6E, 0xE4, 0x21,
-    0xA7, 0xF0, 0x7A, 0xCB, 0xFF, 0x11, 0xF0, 0x96, 0x99, 0xD3, 0xA2, 0x10, 0x1D, 0x91, 0x8D, 0x32,
-    0xEF, 0x7A, 0xC0, 0x90, 0xF9, 0x1D, 0x70, 0xD0, 0xCF, 0x30, 0x4C, 0x83, 0x41, 0x13, 0xD8, 0xB1,
-    0x08, 0x3D, 0x4D, 0xFE, 0x97, 0xC8, 0x58, 0x1C, 0x42, 0x05, 0xD6, 0x68, 0x28, 0x98, 0xE2, 0x9E,
-    0xF8, 0x12, 0x2B, 0x3C, 0x70, 0x20, 0x95, 0x2C, 0x75, 0x50, 0x49, 0xA0, 0x28, 0x1A, 0xB9, 0xFC,
-    0xE8, 0x3C, 0x73, 0x8F, 0xB5, 0xC6, 0xEB, 0x36, 0xF7, 0xB8, 0x33, 0x7B, 0x95, 0xD5, 0x23, 0x47,
-    0x0B, 0x68, 0x7D, 0x6B, 0x45, 0x89, 0x12, 0xB2, 0xF1, 0xD7, 0x4F, 0x57, 0xA2, 0x5F, 0x07, 0xE4,
-    0xB4, 0xC0, 0x61, 0xA1, 0x4D, 0x4F, 0x09, 0x7C, 0xD6, 0xA5, 0xD2, 0x78, 0x57, 0x90, 0x3F, 0x80,
-    0x8F, 0x43, 0xF6, 0x08, 0x01, 0x5B, 0xB6, 0x86, 0x0A, 0x7F, 0x78, 0xBE, 0x40, 0xD5, 0x4C, 0x53,
-    0xFB, 0xB7, 0x69, 0xEE, 0xF2, 0x27, 0x68, 0x4E, 0xBA, 0x17, 0x34, 0x7A, 0x69, 0x6C, 0x3A, 0xDD,
-    0xF9, 0x57, 0xB3, 0xDD, 0xD0, 0x81, 0x02, 0x5C, 0x87, 0xDC, 0x4B, 0xFB, 0x1B, 0xD9, 0x1D, 0x2B,
-    0x13, 0x95, 0x3E, 0x08, 0x34, 0x3C, 0x4E, 0x82, 0x04, 0x6B, 0x50, 0x82, 0x87, 0xB3, 0xE3, 0x2A,
-    0x81, 0x03, 0x62, 0x4B, 0x97, 0xF7, 0x05, 0xA8, 0xC7, 0x1A, 0x18, 0x4C, 0x71, 0x26, 0xBE, 0x08,
-    0xDA, 0xFE, 0x9F, 0x48, 0x3D, 0x7C, 0x8A, 0x44, 0x42, 0x03, 0xB4, 0xD6, 0xC0, 0xB1, 0x43, 0x44,
-    0xB2, 0x44, 0x60, 0xD5, 0xA5, 0x41, 0xFB, 0x14, 0xB3, 0x0B, 0x22, 0x87, 0x4B, 0x65, 0x61, 0xBE,
-    0x7A, 0xC7, 0xFC, 0xD8, 0x78, 0xB9, 0xF0, 0xF1, 0xF6, 0x22, 0xAA, 0xE3, 0xF9, 0x76, 0x5D, 0x22,
-    0x6A, 0xB1, 0x5A, 0x95, 0x99, 0xBE, 0xDF, 0x99, 0x44, 0xB6, 0x82, 0x80, 0x8D, 0x86, 0x37, 0xB0,
-    0x95, 0x10, 0x7D, 0x19, 0x20, 0xC2, 0x8D, 0xA0, 0x91, 0x08, 0x1A, 0xD1, 0x0B, 0x32, 0x8D, 0xDF,
-    0xB1, 0x9D, 0x4B, 0xF6, 0x58, 0x58, 0xC8, 0x0E, 0x6E, 0xFF, 0x7A, 0x6D, 0x50, 0x70, 0x73, 0x58,
-    0xDC, 0xD3, 0xE7, 0xDE, 0x8D, 0x94, 0x96, 0xD3, 0x30, 0x70, 0x79, 0x0B, 0x5F, 0xCF, 0x51, 0xB7,
-    0x0C, 0x72, 0xAC, 0xF5, 0x83, 0xFE, 0x76, 0x4D, 0xC4, 0x4C, 0x5B, 0x96, 0x4B, 0x44, 0x6E, 0xB7,
-    0xFB, 0x27, 0x11, 0x2E, 0x2E, 0x65, 0x2E, 0xA2, 0xBE, 0xB2, 0x8D, 0xB5, 0x65, 0x0A, 0xBA, 0xC7,
-    0x4A, 0x91, 0xCF, 0x24, 0x74, 0x98, 0x63, 0x62, 0x89, 0xC6, 0x4D, 0xC8, 0x64, 0xFB, 0x15, 0xA2,
-    0xA4, 0xE8, 0xB7, 0x18, 0xE8, 0x00, 0xE6, 0x42, 0x95, 0x2C, 0x42, 0xDE, 0xDA, 0x2C, 0x1D, 0xF6,
-    0x08, 0x91, 0x6A, 0xE4, 0xB2, 0x31, 0x90, 0x38, 0x2E, 0xD1, 0x36, 0x18, 0x5F, 0x3D, 0xD7, 0x6A,
-    0x7D, 0x0F, 0x6A, 0x5C, 0x0F, 0x0D, 0x05, 0x66, 0xE7, 0x79, 0x51, 0xEC, 0x05, 0x18, 0x2B, 0x94,
-    0xED, 0x8C, 0xEC, 0x16, 0xAF, 0x10, 0x52, 0x7A, 0xBF, 0x37, 0x4E, 0xF5, 0xA2, 0x9D, 0x46, 0x94,
-    0x4B, 0x18, 0xCE, 0xE7, 0x12, 0x29, 0xB6, 0xA2, 0x22, 0xC8, 0x97, 0x1B, 0x1B, 0x18, 0x70, 0x6B,
-    0x71, 0x37, 0xB1, 0x13, 0x04, 0x5B, 0xCF, 0x2F, 0xC9, 0x85, 0x26, 0x9A, 0xD4, 0x0D, 0x10, 0x60,
-    0x49, 0x34, 0x75, 0xF5, 0x74, 0x0D, 0xE5, 0x4D, 0x6D, 0x9F, 0xE3, 0x1D, 0x5B, 0xB8, 0x74, 0x20,
-    0x38, 0x68, 0x4F, 0x94, 0xBF, 0xE2, 0xC3, 0xBF, 0x43, 0x7E, 0x7D, 0x99, 0x91, 0x91, 0xAE, 0x35,
-    0x17, 0xA5, 0xF9, 0xCC, 0xA0, 0xE4, 0x5F, 0x32, 0x22, 0x28, 0x5D, 0x9C, 0x29, 0x43, 0x4C, 0x7B,
-    0xA2, 0x18, 0x5D, 0x9E, 0x65, 0x53, 0x4E, 0x34, 0x9F, 0x68, 0x83, 0xC4, 0x81, 0xEE, 0xEB, 0xCD,
-    0x5F, 0x13, 0xFD, 0x6B, 0xA1, 0x5C, 0xA2, 0xD1, 0x7D, 0xDF, 0x68, 0xB1, 0x80, 0xE6, 0xA0, 0xA4,
-    0x4D, 0x0E, 0xDA, 0x9F, 0xB5, 0xB3, 0xD7, 0x58, 0x7B, 0xD1, 0x54, 0x7F, 0xA7, 0xC9, 0xC4, 0xAD,
-    0xBD, 0xDF, 0xE2, 0x3F, 0xD9, 0x7A, 0x2E, 0x6B, 0xB7, 0x5D, 0xFC, 0x7E, 0x2B, 0x5B, 0x6D, 0x29,
-    0xD6, 0x11, 0x45, 0xC0, 0x1C, 0xCA, 0x24, 0xEA, 0x1A, 0xFD, 0xBD, 0xE8, 0x16, 0x4A, 0xB9, 0x32,
-    0xC4, 0xC3, 0x4B, 0xA8, 0xBF, 0x3C, 0x51, 0x26, 0xC1, 0x9A, 0x6E, 0xC6, 0x65, 0x9F, 0xB0, 0xB6,
-    0x82, 0x84, 0x89, 0x52, 0xE0, 0x98, 0xBB, 0x1F, 0x5B, 0xD8, 0xC8, 0x46, 0x7C, 0xF7, 0xC3, 0xD3,
-    0x59, 0xDC, 0x35, 0x91, 0x20, 0x13, 0x75, 0x69, 0xD4, 0xA9, 0xAF, 0xA7, 0x24, 0x3B, 0xFB, 0xD6,
-    0x83, 0x8D, 0x73, 0xA2, 0x1B, 0x5A, 0xC4, 0x5D, 0xBA, 0x0F, 0x09, 0x4B, 0x5B, 0xD3, 0x15, 0x34,
-    0x17, 0x62, 0x4E, 0x82, 0x91, 0xBB, 0x4F, 0x7A, 0xAB, 0xB8, 0x46, 0x54, 0x97, 0x25, 0x67, 0x97,
-    0x95, 0x07, 0x3E, 0x3C, 0xED, 0x98, 0xCB, 0x55, 0x57, 0x05, 0x37, 0xE6, 0xC0, 0xCF, 0x44, 0x29,
-    0x53, 0xF2, 0xE2, 0xC3, 0x54, 0x4F, 0x91, 0x0C, 0x36, 0x6B, 0x79, 0x1E, 0xF3, 0x34, 0xAF, 0xAA,
-    0x38, 0xBE, 0xA5, 0xEE, 0xBB, 0xDB, 0xC2, 0x5C, 0x10, 0x12, 0x32, 0x9F, 0x56, 0x66, 0x7D, 0xB8,
-    0x6F, 0x58, 0xF2, 0xE5, 0xEA, 0xF2, 0x0E, 0xAF, 0xBE, 0x71, 0xBA, 0x31, 0x36, 0x43, 0xE6, 0xEF,
-    0x87, 0x9C, 0xD3, 0x8D, 0x03, 0x6B, 0xAE, 0x47, 0x25, 0x5B, 0x03, 0x93, 0x4B, 0x26, 0xAF, 0x98,
-    0x70, 0xAD, 0xA9, 0x13, 0xCC, 0x8E, 0x55, 0xB3, 0x24, 0x3D, 0x12, 0x38, 0xCD, 0x8F, 0x44, 0x53,
-    0xEE, 0xF8, 0xCB, 0xAD, 0xD6, 0xDF, 0x3D, 0xFB, 0x65, 0x64, 0xAB, 0x46, 0x4E, 0x6A, 0xCB, 0xF9,
-    0xCF, 0x18, 0x17, 0xDB, 0xCC, 0xFB, 0xC3, 0xCA, 0x36, 0xBC, 0x85, 0xAB, 0x2D, 0xCA, 0x62, 0x81,
-    0x32, 0x98, 0x37, 0xAB, 0xFA, 0x51, 0x26, 0xA6, 0x18, 0x48, 0xB9, 0x23, 0x5A, 0xA2, 0xC5, 0x38,
-    0x4B, 0x4B, 0xC0, 0x44, 0xD6, 0x4F, 0xB1, 0xD1, 0x43, 0x2C, 0x37, 0xF4, 0x7E, 0xC1, 0x0D, 0x4E,
-    0x4C, 0x98, 0xD6, 0x8C, 0x33, 0xA7, 0x66, 0x92, 0x8C, 0x89, 0x00, 0x77, 0x45, 0xC0, 0x99, 0x27,
-    0x89, 0xE1, 0xF4, 0x58, 0xD6, 0x27, 0x93, 0x3A, 0x13, 0xA7, 0x4A, 0xA4, 0xF0, 0x13, 0x67, 0xDB,
-    0x4A, 0x10, 0x0B, 0xD9, 0x08, 0x3F, 0x78, 0x4D, 0x3B, 0x37, 0x99, 0x34, 0xC3, 0x45, 0xB9, 0x66,
-    0xD2, 0x6E, 0x5C, 0x00, 0xE8, 0xBF, 0xEC, 0x03, 0x03, 0x86, 0x33, 0x07, 0x76, 0xF2, 0x2C, 0xA8,
-    0xBD, 0x31, 0xF6, 0x49, 0xCB, 0x35, 0x40, 0x10, 0xEE, 0x72, 0xB8, 0xCC, 0x82, 0x4A, 0xA8, 0x5C,
-    0x63, 0xAB, 0x82, 0xDA, 0xA4, 0x90, 0x5B, 0xD6, 0x41, 0xC6, 0x97, 0x60, 0x73, 0x41, 0x37, 0x5D,
-    0x36, 0x1D, 0xB7, 0x7D, 0x31, 0x0C, 0xC9, 0x24, 0xA7, 0x19, 0x5F, 0x9E, 0x64, 0x77, 0xC0, 0x2F,
-    0x7F, 0x74, 0x6E, 0x0D, 0xE3, 0x95, 0xBA, 0x74, 0xBE, 0x67, 0x35, 0x73, 0xF6, 0x8A, 0xCE, 0xA6,
-    0x19, 0xF2, 0x0E, 0xA3, 0xCA, 0x99, 0xB8, 0x4D, 0x31, 0x73, 0x59, 0xF2, 0xD2, 0x1C, 0xF9, 0x71,
-    0xE8, 0x39, 0x74, 0x1B, 0x0E, 0x0E, 0x0F, 0xC0, 0xD0, 0xCB, 0x52, 0x7B, 0x15, 0xE2, 0x7C, 0x88,
-    0x78, 0xFD, 0xEA, 0x8C, 0x59, 0xA6, 0xB2, 0x2A, 0xAC, 0x36, 0x30, 0xC3, 0xA4, 0x6D, 0x02, 0x44,
-    0x17, 0xA9, 0xC7, 0xFF, 0x28, 0x84, 0x25, 0x47, 0xD8, 0x6E, 0x6F, 0xDC, 0xCC, 0xA9, 0x3F, 0xAB,
-    0xDD, 0xCA, 0xC2, 0x9C, 0x90, 0xF2, 0x9C, 0x08, 0x25, 0x2C, 0x36, 0xCD, 0xBF, 0xDF, 0xD9, 0xD4,
-    0xF1, 0x39, 0x2D, 0xD7, 0x87, 0x6C, 0x4A, 0x7A, 0x5D, 0x6C, 0xAE, 0x6C, 0x8B, 0xB0, 0x17, 0x2F,
-    0x1A, 0x0B, 0xAC, 0x1D, 0xE4, 0x98, 0x0C, 0x36, 0x25, 0x3A, 0x71, 0x0D, 0x5A, 0xF7, 0xB4, 0xBD,
-    0xDC, 0xDB, 0x42, 0x01, 0xBF, 0x78, 0x2B, 0x07, 0x3B, 0x76, 0x72, 0x76, 0x59, 0xF8, 0xE0, 0x59,
-    0x31, 0x1C, 0xFD, 0xC9, 0xD2, 0xF6, 0x81, 0x6F, 0x1A, 0xAF, 0x2F, 0xD8, 0x5F, 0xA6, 0xF5, 0xA8,
-    0x3D, 0xDB, 0xED, 0x24, 0x24, 0xE8, 0x4A, 0x99, 0x1F, 0x1C, 0xF3, 0x5C, 0x73, 0x16, 0x53, 0x1D,
-    0x1E, 0xA3, 0x63, 0x70, 0xCC, 0x6E, 0xB9, 0xC9, 0x5E, 0x54, 0xB5, 0x8B, 0xDE, 0xA5, 0x8C, 0xAF,
-    0x1C, 0xA4, 0xB4, 0x29, 0xB1, 0xB6, 0xFB, 0xA2, 0x17, 0x7D, 0x57, 0xDC, 0x2E, 0x39, 0x02, 0xFA,
-    0xD2, 0x1C, 0xDB, 0xBF, 0x33, 0xDF, 0xEA, 0xDF, 0x59, 0xDF, 0x4C, 0x4D, 0xBF, 0x4F, 0x48, 0xE1,
-    0x03, 0xC8, 0xF7, 0xBF, 0x50, 0xD2, 0x04, 0x61, 0xA2, 0xE3, 0x8E, 0xDB, 0x18, 0x4D, 0x38, 0x5D,
-    0xE9, 0x5D, 0x3D, 0x97, 0x03, 0x11, 0xAC, 0x38, 0x20, 0x01, 0x8C, 0x5C, 0x12, 0x0C, 0x0F, 0x50,
-    0xDC, 0xC1, 0x4E, 0x0E, 0x8D, 0xAE, 0x82, 0x8B, 0x51, 0x8B, 0x5D, 0x90, 0xAB, 0xA0, 0x78, 0xFA,
-    0x1E, 0x7C, 0x31, 0x4A, 0xC7, 0xF9, 0xB1, 0x29, 0xD5, 0xE3, 0x5A, 0x90, 0xE2, 0x63, 0x13, 0xF6,
-    0x5B, 0xD7, 0x5D, 0x1B, 0x04, 0x38, 0xD7, 0xAE, 0x77, 0xDF, 0xEC, 0x36, 0xAD, 0xFA, 0xF5, 0xBE,
-    0x87, 0x97, 0x30, 0xFB, 0x76, 0xBA, 0x6B, 0xA6, 0x5D, 0xF3, 0x27, 0x9F, 0x3F, 0x79, 0x6D, 0xCA,
-    0x2E, 0xDA, 0x4E, 0xD9, 0x91, 0x03, 0x08, 0x2C, 0x28, 0x15, 0x78, 0x5C, 0xF1, 0xB0, 0x60, 0xA2,
-    0x8B, 0x19, 0x3F, 0xF1, 0x68, 0xA0, 0x87, 0xF7, 0x09, 0xD1, 0x0E, 0x25, 0x78, 0x71, 0x6A, 0xE4,
-    0x1B, 0xD7, 0x36, 0x06, 0x59, 0x6C, 0x93, 0xA5, 0xF3, 0xF2, 0xF3, 0x41, 0x87, 0x12, 0xEE, 0xB8,
-    0x70, 0xBA, 0x95, 0x5B, 0xDF, 0xB2, 0x9B, 0x07, 0xC7, 0x7D, 0xF9, 0x95, 0xD5, 0x54, 0x75, 0x35,
-    0x7B, 0x9A, 0xC3, 0xAA, 0xCD, 0x3D, 0xBB, 0xC6, 0xBB, 0x94, 0xD9, 0xAA, 0x93, 0xCC, 0x58, 0xB6,
-    0x47, 0x2E, 0x53, 0x3E, 0xB6, 0xAA, 0x76, 0x24, 0xC9, 0x66, 0x33, 0x5F, 0xF5, 0x1D, 0x98, 0x39,
-    0x42, 0x4C, 0xD0, 0xA8, 0xAF, 0x5A, 0x50, 0xFF, 0xE8, 0x42, 0x9D, 0x78, 0xFA, 0x7D, 0x34, 0x9A,
-    0x69, 0x1B, 0xA2, 0xDA, 0xFB, 0xFF, 0xCF, 0x82, 0x1A, 0xA1, 0xE1, 0x62, 0x86, 0x00, 0x74, 0x63,
-    0x4E, 0x76, 0x1D, 0x64, 0x7F, 0xFA, 0xFD, 0x27, 0x70, 0xFB, 0x0A, 0x0F, 0x70, 0x97, 0x33, 0x74,
-    0xE2, 0xFF, 0xF4, 0xF0, 0x65, 0x48, 0xBE, 0x47, 0xA4, 0x6C, 0x86, 0xB9, 0xE1, 0x8A, 0x05, 0x32,
-    0xAA, 0xC8, 0x4D, 0xDF, 0x7B, 0xC2, 0xFC, 0x11, 0x7C, 0x6D, 0x88, 0xC2, 0xC2, 0x27, 0x99, 0xF1,
-    0x7F, 0x85, 0x5E, 0xEE, 0x3C, 0x18, 0xFB, 0x5D, 0xDC, 0xB8, 0xAB, 0xE9, 0x68, 0xE2, 0xC2, 0xB2,
-    0xF1, 0x91, 0x86, 0xE9, 0xE1, 0xCC, 0xA8, 0x95, 0x7A, 0x57, 0xCF, 0x2C, 0x8C, 0x16, 0xD1, 0x47,
-    0x67, 0x26, 0x9A, 0x45, 0x64, 0xEF, 0x83, 0x4C, 0x8D, 0x19, 0x78, 0x81, 0xA1, 0x25, 0xC1, 0xFC,
-    0xFC, 0x5C, 0xA3, 0x5D, 0xED, 0x02, 0x6A, 0x3D, 0x14, 0x70, 0x9E, 0x30, 0x12, 0xD0, 0x95, 0x7F,
-    0x05, 0x29, 0x73, 0xD6, 0xDE, 0xEF, 0xD9, 0xD4, 0xBE, 0xB9, 0x3C, 0x73, 0xAF, 0x8F, 0x82, 0x91,
-    0xB5, 0xC8, 0x50, 0xB3, 0x14, 0x1C, 0xE3, 0x6D, 0x0E, 0x15, 0xA5, 0xE4, 0x00, 0x9A, 0x2E, 0x52,
-    0x32, 0x35, 0xBC, 0xC0, 0xF2, 0xFC, 0xA1, 0xBE, 0xC0, 0x12, 0xA0, 0xC3, 0xC4, 0x36, 0xDA, 0xCD,
-    0xF6, 0x21, 0xC5, 0xEA, 0x9A, 0xF7, 0xB9, 0x98, 0xE9, 0xA7, 0x6A, 0x30, 0xB7, 0xA9, 0x49, 0xFA,
-    0x66, 0xE8, 0x26, 0x8F, 0xB2, 0xF1, 0x99, 0x64, 0x73, 0xA6, 0xE4, 0x19, 0xBE, 0xD4, 0xA4, 0x95,
-    0xF7, 0xFE, 0x0C, 0x63, 0x0C, 0xBE, 0xCE, 0xA3, 0x4D, 0xD7, 0x53, 0x6E, 0xAE, 0x34, 0x14, 0x56,
-    0x98, 0x3B, 0xDD, 0xD9, 0x65, 0xCE, 0x28, 0xC0, 0xD8, 0xF2, 0x3C, 0xD9, 0xB2, 0x7D, 0xB9, 0xAB,
-    0xDC, 0x96, 0xED, 0x7B, 0x42, 0xE2, 0x3E, 0x21, 0x68, 0xEC, 0xDE, 0xD5, 0x77, 0xA7, 0x24, 0xF2,
-    0x83, 0x04, 0x57, 0xCD, 0x2D, 0xA6, 0x26, 0x7C, 0x07, 0xED, 0x21, 0x83, 0x37, 0xBC, 0x5A, 0xDB,
-    0xC8, 0x37, 0x7E, 0x01, 0xED, 0x7B, 0x02, 0x47, 0x3F, 0x5C, 0x99, 0x43, 0x88, 0xF2, 0xCB, 0x1F,
-    0xC1, 0xA2, 0x82, 0x29, 0xF8, 0xCF, 0xD3, 0x2F, 0x61, 0x63, 0x9F, 0xDC, 0x7A, 0xA7, 0x89, 0xC5,
-    0xFA, 0xD1, 0x1C, 0x99, 0xF4, 0xDF, 0xBC, 0x89, 0x00, 0x3D, 0xD8, 0x9C, 0x19, 0xBD, 0xA3, 0x40,
-    0xAD, 0x9A, 0x50, 0xDF, 0xD2, 0xF9, 0xF8, 0x8C, 0xD5, 0x37, 0xED, 0xAE, 0xC1, 0x3B, 0x70, 0x60,
-    0xB8, 0x61, 0x21, 0x9C, 0x20, 0x44, 0x7E, 0xE0, 0x3C, 0x5F, 0x99, 0xAB, 0xF4, 0x6D, 0x40, 0xFB,
-    0x8A, 0x8D, 0xAE, 0xDA, 0xDA, 0x4A, 0x7D, 0xAF, 0xC8, 0xEB, 0x14, 0xE2, 0x04, 0x42, 0xD0, 0x3B,
-    0x98, 0x35, 0xE7, 0x4D, 0xB3, 0xD5, 0x1B, 0xD0, 0xA3, 0x46, 0x58, 0x30, 0x5C, 0x24, 0xC2, 0xB9,
-    0x43, 0xC7, 0x0C, 0xB4, 0x7E, 0xE2, 0xF4, 0x11, 0x09, 0x53, 0x87, 0xA0, 0xE0, 0x68, 0x32, 0x4B,
-    0xD1, 0x13, 0xE7, 0xAD, 0xA2, 0x8B, 0xDA, 0x7E, 0xBF, 0xAC, 0x77, 0x87, 0xD8, 0xF3, 0xE7, 0x27,
-    0x33, 0x9B, 0x69, 0x70, 0x2B, 0x18, 0xB7, 0x0B, 0x8C, 0x91, 0x40, 0x17, 0xBC, 0xEC, 0xB9, 0xA3,
-    0x6F, 0x0E, 0x86, 0x19, 0x67, 0xAA, 0xC0, 0x50, 0xBF, 0xD4, 0x1A, 0x13, 0x04, 0x22, 0xA3, 0x96,
-    0x7B, 0x68, 0xC0, 0x22, 0xCF, 0x37, 0x2B, 0xD5, 0x30, 0xDC, 0x50, 0xBB, 0x9B, 0x1B, 0xD4, 0xD0,
-    0x4F, 0x36, 0xDD, 0x5E, 0x84, 0x4D, 0x75, 0x4C, 0x78, 0x03, 0x52, 0x50, 0xD8, 0x78, 0x8A, 0x9B,
-    0x2A, 0x99, 0x0D, 0x57, 0xDC, 0xFD, 0x67, 0x21, 0x34, 0xBA, 0xA3, 0x1E, 0x95, 0x73, 0x7B, 0xA0,
-    0x02, 0x35, 0xD2, 0xAF, 0xD9, 0x83, 0xE6, 0x08, 0x66, 0xC4, 0xAB, 0x3F, 0x48, 0xCC, 0x02, 0xD4,
-    0xA8, 0x70, 0x84, 0x8D, 0x07, 0xE0, 0x06, 0xD5, 0x5C, 0x18, 0x86, 0x72, 0xD0, 0x39, 0xC3, 0xE0,
-    0x05, 0x4A, 0xA7, 0xED, 0x84, 0xD0, 0x3A, 0xC5, 0x8E, 0x6A, 0xA7, 0xE0, 0x11, 0x90, 0x8D, 0xED,
-    0xC0, 0xA4, 0xE7, 0xDE, 0xC6, 0xAA, 0x4C, 0xB6, 0xCE, 0x34, 0x9B, 0x33, 0x19, 0xCF, 0x10, 0x8D,
-    0x20, 0x1F, 0x9F, 0xB1, 0xDB, 0x93, 0x8D, 0x6A, 0xA8, 0xF9, 0x11, 0xC2, 0xB5, 0x62, 0xE1, 0x4B,
-    0x24, 0xC5, 0x5E, 0xE2, 0xDE, 0x16, 0x32, 0xCD, 0x89, 0x16, 0x6D, 0x7D, 0xCF, 0x50, 0xCB, 0x2D,
-    0x6C, 0x0F, 0x0C, 0xD1, 0xFC, 0xEB, 0xB6, 0xDF, 0xA3, 0xEA, 0xC0, 0x3D, 0xB1, 0x64, 0xF2, 0x66,
-    0x5F, 0xAC, 0xAE, 0xFA, 0x71, 0xA7, 0x83, 0xE7, 0xDA, 0xD1, 0xDF, 0x6C, 0xC3, 0x4B, 0xA0, 0x89,
-    0xCE, 0xE0, 0xF7, 0x14, 0x36, 0x28, 0x28, 0xE9, 0xD1, 0x26, 0x40, 0xDB, 0x8C, 0x84, 0xDC, 0x2E,
-    0x52, 0x3E, 0x42, 0x78, 0x2E, 0x95, 0xD8, 0x3F, 0xC8, 0x9B, 0x05, 0x90, 0x73, 0x62, 0xBC, 0x4F,
-    0x50, 0x5F, 0xC8, 0xDC, 0x2F, 0x0A, 0xE4, 0xEC, 0xCD, 0x0A, 0x95, 0xF6, 0x95, 0xB9, 0x70, 0x86,
-    0x4A, 0x95, 0x84, 0x29, 0x0A, 0xCB, 0xD1, 0xA3, 0x05, 0x96, 0x3B, 0xCC, 0x91, 0xBB, 0x6A, 0xFC,
-    0x62, 0x17, 0xE1, 0xB8, 0xFC, 0x3B, 0x43, 0x94, 0x5E, 0x7B, 0xE5, 0x1E, 0x5F, 0x71, 0x5D, 0x01,
-    0x93, 0x5D, 0xB3, 0x2B, 0x2B, 0x9F, 0xC4, 0x7C, 0xE3, 0x2F, 0x78, 0x37, 0x73, 0x3F, 0x2B, 0x8D,
-    0xFB, 0x45, 0x6E, 0x16, 0x15, 0xC3, 0x07, 0x72, 0xEC, 0x0A, 0x63, 0xE3, 0xC7, 0xED, 0x94, 0x5C,
-    0x4E, 0x35, 0xCE, 0x88, 0xF2, 0xE1, 0xCD, 0xC1, 0x7E, 0xDE, 0x53, 0xAE, 0xC2, 0x84, 0x2C, 0x61,
-    0x8F, 0x8B, 0xF3, 0xA0, 0x79, 0x70, 0x7B, 0x7E, 0xBB, 0xE0, 0x23, 0x49, 0x98, 0x23, 0x9B, 0xF6,
-    0x6B, 0x61, 0x69, 0x4C, 0xCC, 0xFE, 0x5B, 0x81, 0xB4, 0xE0, 0x99, 0x5A, 0xA6, 0x96, 0xC7, 0x67,
-    0xB0, 0x04, 0xE1, 0xE3, 0xB2, 0x42, 0x4D, 0xF0, 0x76, 0x91, 0x20, 0x15, 0xBE, 0x12, 0xA5, 0x7D,
-    0xAB, 0xDA, 0x45, 0xE7, 0xC8, 0x0A, 0xF4, 0x78, 0x7E, 0xC1, 0x93, 0xC5, 0x88, 0x77, 0xCD, 0x9B,
-    0x02, 0xCC, 0xBB, 0xE6, 0x81, 0xB9, 0x71, 0xBF, 0xCC, 0x02, 0x61, 0x65, 0xD3, 0x02, 0x6F, 0xDA,
-    0x08, 0x97, 0x97, 0x8D, 0x23, 0xF1, 0x79, 0x54, 0xF4, 0x12, 0x46, 0x7C, 0x91, 0x0D, 0xA4, 0xAC,
-    0x51, 0xD1, 0x42, 0xF3, 0xA3, 0x8D, 0x50, 0x62, 0xCA, 0x90, 0x58, 0x02, 0xC0, 0x4C, 0x72, 0x70,
-    0xFD, 0x2B, 0x56, 0x01, 0xA2, 0x4C, 0x96, 0x42, 0x75, 0x47, 0xA6, 0x3E, 0x87, 0x1F, 0xF8, 0x3D,
-    0xBC, 0xC6, 0xC2, 0x72, 0xFD, 0x21, 0x6E, 0xB8, 0x4E, 0x83, 0x42, 0x79, 0x94, 0x54, 0xE9, 0x8B,
-    0x8C, 0xC8, 0x45, 0x1B, 0xFB, 0x36, 0xAE, 0x69, 0xA0, 0x0D, 0x09, 0x4C, 0x43, 0x90, 0x06, 0x5B,
-    0x39, 0xCE, 0x88, 0x39, 0x39, 0x16, 0xA3, 0xB5, 0x5D, 0x11, 0xD5, 0x37, 0x54, 0x2D, 0x1B, 0x08,
-    0x8D, 0xCD, 0x57, 0xA8, 0xDD, 0x69, 0xAC, 0x77, 0xD7, 0xEC, 0x26, 0x27, 0xA2, 0x45, 0x23, 0xF7,
-    0x0A, 0x6B, 0x2F, 0x64, 0xE2, 0x5F, 0xB0, 0xE5, 0xA5, 0x19, 0xBC, 0x45, 0x58, 0x0E, 0x95, 0x24,
-    0x66, 0x3A, 0xB4, 0xAA, 0xC9, 0x17, 0xF1, 0xB0, 0xB8, 0xEE, 0x39, 0xCE, 0x82, 0x95, 0x03, 0xDD,
-    0x4E, 0xB7, 0x19, 0xDB, 0x3E, 0x8F, 0x51, 0xDC, 0xE2, 0xFE, 0xED, 0xA5, 0x0D, 0x60, 0x1C, 0x51,
-    0xA5, 0x67, 0x0A, 0xA3, 0xF7, 0x5D, 0xE8, 0xF8, 0x29, 0x68, 0x34, 0xD5, 0xEF, 0x89, 0xFC, 0x01,
-    0xEC, 0xED, 0x1E, 0x8C, 0xE0, 0xC7, 0x36, 0x66, 0xE1, 0xCB, 0x74, 0x61, 0x61, 0xAE, 0x57, 0x44,
-    0xD8, 0xED, 0x77, 0xFC, 0x62, 0x94, 0xAD, 0xE0, 0xEB, 0xBB, 0xA3, 0x37, 0x35, 0x17, 0xA6, 0x7F,
-    0xDF, 0x66, 0x5B, 0xE7, 0x42, 0xBE, 0xA7, 0xDD, 0xF1, 0x3D, 0x84, 0x8E, 0x09, 0x3F, 0xBE, 0x99,
-    0x43, 0x5E, 0xAC, 0xBD, 0x3B, 0x6C, 0xE5, 0x59, 0xF5, 0x15, 0x93, 0x51, 0x27, 0x38, 0xA7, 0xBD,
-    0x3C, 0xF2, 0x66, 0x62, 0x6A, 0x03, 0x3B, 0x06, 0xD6, 0xA3, 0x8E, 0x68, 0x1E, 0x82, 0xC3, 0xD9,
-    0x2C, 0xF3, 0x18, 0x4B, 0x74, 0xFA, 0xD6, 0x0A, 0xBB, 0x80, 0x71, 0x3D, 0x53, 0xCB, 0x99, 0xBE,
-    0x89, 0x33, 0x5E, 0xE6, 0x29, 0x5F, 0x3A, 0x91, 0xE8, 0xEE, 0xEC, 0x79, 0x9B, 0xB5, 0x09, 0x34,
-    0x39, 0xAB, 0xB1, 0x5D, 0x65, 0x13, 0x7A, 0xB5, 0xCA, 0xE8, 0x34, 0x56, 0xC2, 0xC6, 0x0A, 0xC9,
-    0xEC, 0xBF, 0x84, 0x91, 0x91, 0xBE, 0xBC, 0xA6, 0xCE, 0x95, 0x49, 0x22, 0xAE, 0xAF, 0x5B, 0x5D,
-    0xDB, 0x08, 0x9F, 0x80, 0xB8, 0x84, 0xDA, 0x09, 0xAF, 0x75, 0x8E, 0xA3, 0x53, 0x29, 0xFB, 0xFA,
-    0x99, 0x7F, 0x1C, 0x54, 0x1B, 0x94, 0xAE, 0x0F, 0x55, 0xDA, 0x1F, 0xE2, 0xCB, 0xB3, 0x19, 0x07,
-    0x43, 0x26, 0x8C, 0xF0, 0x9F, 0xB4, 0x63, 0x61, 0xD0, 0xED, 0x77, 0x58, 0x89, 0x05, 0x7E, 0xEE,
-    0x7C, 0xCA, 0xE6, 0x31, 0x03, 0xED, 0xDD, 0xE4, 0x43, 0xED, 0x57, 0x61, 0x31, 0x7C, 0xE5, 0x34,
-    0x9B, 0xF7, 0x77, 0xF8, 0x6E, 0x27, 0xA3, 0x7F, 0x28, 0xF7, 0x5D, 0x78, 0x67, 0xD3, 0x87, 0xC6,
-    0x99, 0xF9, 0xB4, 0x7F, 0x67, 0xD3, 0xED, 0xCC, 0xD1, 0xAC, 0xE0, 0x4D, 0xD6, 0x0E, 0x37, 0x75,
-    0x53, 0x03, 0x3F, 0x18, 0x21, 0x44, 0x42, 0x22, 0x62, 0x6A, 0xE3, 0xFA, 0xEF, 0x49, 0x3B, 0x4E,
-    0xC0, 0x77, 0x4F, 0x71, 0x55, 0x67, 0xE1, 0xB4, 0xED, 0x70, 0x37, 0xEE, 0x84, 0x9B, 0xDC, 0xB0,
-    0x13, 0xEE, 0x1B, 0xF6, 0xD9, 0x41, 0xC6, 0x3F, 0x67, 0x72, 0xA4, 0xEE, 0xFF, 0xC7, 0x0C, 0xFF,
-    0x07, 0xAD, 0x55, 0x4D, 0x68, 0x1C, 0xC9, 0x15, 0xFE, 0xAA, 0xCB, 0xA3, 0xB6, 0xD5, 0x1A, 0x95,
-    0x0F, 0x12, 0x2C, 0x8E, 0xA4, 0xD6, 0x61, 0x0F, 0x92, 0xB1, 0xD4, 0x3A, 0x0C, 0x59, 0x85, 0x8C,
-    0xA6, 0x5B, 0x12, 0xC4, 0x90, 0x40, 0x18, 0x88, 0x45, 0x2E, 0x39, 0x88, 0xCD, 0x1E, 0x76, 0x9D,
-    0x10, 0xCF, 0x41, 0x07, 0x1D, 0x46, 0x9A, 0xF6, 0xEA, 0xE0, 0x83, 0x21, 0xD1, 0x39, 0x09, 0x64,
-    0x42, 0xBC, 0xB0, 0x8C, 0x20, 0x52, 0x82, 0x0F, 0x22, 0x8C, 0x66, 0xCA, 0x1A, 0xC2, 0x92, 0xD3,
-    0xB6, 0x9C, 0x83, 0x21, 0x97, 0xB4, 0xAD, 0x98, 0xF5, 0xAE, 0xC3, 0xBA, 0x50, 0x7A, 0x37, 0xBD,
-    0x76, 0xCF, 0x54, 0x5E, 0xCD, 0xD8, 0xEC, 0xC2, 0x92, 0x9C, 0xD2, 0xD0, 0x45, 0xFD, 0xBC, 0xF7,
-    0xEA, 0x7B, 0xEF, 0x7D, 0xEF, 0xD5, 0xDB, 0x76, 0xEC, 0x23, 0xB5, 0xE5, 0x24, 0xDE, 0x61, 0x19,
-    0x57, 0x42, 0x7A, 0xD8, 0x04, 0x66, 0xC1, 0x33, 0xF8, 0xA9, 0xF5, 0x59, 0xE2, 0x5B, 0x67, 0xB1,
-    0x15, 0xB1, 0x60, 0xC8, 0xEE, 0xF1, 0x8E, 0x7E, 0xF1, 0x30, 0x6E, 0xAB, 0x03, 0x2B, 0xC6, 0xA5,
-    0x46, 0x5D, 0xEB, 0x8E, 0xEE, 0x81, 0x3E, 0x5B, 0xEB, 0xAC, 0xAD, 0xF5, 0xBD, 0xB5, 0xB5, 0x6B,
-    0xEB, 0xD8, 0x0B, 0xE7, 0x6B, 0xFB, 0xC7, 0x3A, 0x19, 0x7A, 0x82, 0xB1, 0xED, 0x56, 0x15, 0xE7,
-    0x70, 0x35, 0xDA, 0x3A, 0x72, 0x1E, 0xC8, 0xCD, 0x71, 0xA6, 0xBF, 0x73, 0x03, 0x4B, 0x96, 0x6A,
-    0xAF, 0x46, 0x53, 0xB8, 0x48, 0x8A, 0x22, 0x29, 0x1D, 0x6D, 0x8A, 0x0D, 0x51, 0x9C, 0xF2, 0xB2,
-    0xA1, 0x18, 0x77, 0x2E, 0x21, 0x73, 0xE5, 0x91, 0x90, 0x5B, 0x42, 0x56, 0x9D, 0x70, 0x86, 0x87,
-    0x78, 0x0B, 0x6F, 0x25, 0xCE, 0xB1, 0xCA, 0xB8, 0x96, 0x76, 0x06, 0x11, 0x81, 0x05, 0x4D, 0x47,
-    0xA6, 0x62, 0x39, 0xF1, 0xB8, 0x2A, 0xB1, 0x20, 0xC7, 0x96, 0xD5, 0x96, 0xE7, 0x74, 0x54, 0xB3,
-    0x24, 0x6E, 0x45, 0x09, 0xD9, 0x9C, 0x1D, 0xDA, 0xF5, 0x6D, 0xE5, 0xBE, 0xAB, 0x48, 0x8C, 0xC7,
-    0x4B, 0x50, 0x53, 0xB4, 0x69, 0x29, 0x08, 0x09, 0x1F, 0xEB, 0xEB, 0xBF, 0x8D, 0xED, 0xCE, 0xF3,
-    0xAE, 0xA3, 0x23, 0xC2, 0x87, 0x77, 0xE0, 0xEA, 0x65, 0xAD, 0x45, 0x50, 0x5C, 0x44, 0x05, 0x77,
-    0x6D, 0x59, 0xB2, 0x28, 0x00, 0x47, 0xB6, 0xF2, 0xC2, 0x6B, 0xB0, 0x12, 0x21, 0xB7, 0xB9, 0x72,
-    0xC3, 0x26, 0x8F, 0x3C, 0x94, 0x51, 0x12, 0x1D, 0x95, 0xF9, 0xCE, 0x3D, 0x55, 0xCD, 0x7D, 0xED,
-    0xEC, 0x32, 0x8E, 0x90, 0xB1, 0xC4, 0x52, 0x56, 0x84, 0xF7, 0x79, 0xEA, 0xC4, 0x6E, 0x58, 0xC2,
-    0x5D, 0x13, 0x9B, 0x2A, 0x36, 0x6B, 0x69, 0x3B, 0x81, 0x62, 0x0A, 0x01, 0x79, 0x1C, 0x08, 0xB8,
-    0x5D, 0xAF, 0x3B, 0x87, 0x22, 0xC6, 0x30, 0xBE, 0xF6, 0x43, 0xAD, 0xAF, 0xEF, 0xC5, 0x58, 0x02,
-    0x97, 0x24, 0xEA, 0x84, 0x48, 0x20, 0x80, 0x3A, 0xC6, 0xD1, 0x42, 0x97, 0xF2, 0x91, 0x78, 0x51,
-    0xC9, 0x84, 0xCA, 0x3A, 0x4B, 0xD4, 0xC6, 0x14, 0x8F, 0x5F, 0x47, 0x99, 0x29, 0x46, 0x09, 0xA9,
-    0xF5, 0x6A, 0xDD, 0xF1, 0x6B, 0xED, 0xEE, 0xFE, 0x13, 0x27, 0x30, 0x46, 0xE9, 0x2B, 0xC2, 0xC5,
-    0xFE, 0x13, 0x5F, 0xE7, 0x3E, 0xA3, 0xE9, 0x30, 0x6D, 0xD4, 0x74, 0xBB, 0x47, 0x96, 0x4A, 0xD8,
-    0x42, 0x13, 0x19, 0x01, 0x4C, 0x7F, 0xA2, 0x6A, 0x71, 0x2D, 0xC8, 0x05, 0x25, 0x96, 0x38, 0xD2,
-    0x47, 0xC6, 0x63, 0xF1, 0xB1, 0x97, 0x78, 0xB2, 0xD8, 0xED, 0x6E, 0x9E, 0xC3, 0xAA, 0xF2, 0x7D,
-    0x7E, 0x16, 0xCD, 0x01, 0x4E, 0x5A, 0x6A, 0x2D, 0x8A, 0x4D, 0x51, 0x74, 0xBD, 0xEE, 0x50, 0x6C,
-    0xC7, 0x4D, 0xB1, 0x12, 0x57, 0x19, 0xAC, 0x48, 0x10, 0xAE, 0x6D, 0x34, 0xF9, 0x47, 0xDA, 0x8D,
-    0xF9, 0x3D, 0x55, 0x74, 0xC2, 0x43, 0x27, 0xF3, 0x25, 0x72, 0xAB, 0x71, 0x52, 0xF5, 0x44, 0xE7,
-    0x61, 0x52, 0x1D, 0x47, 0x6E, 0x6D, 0xAD, 0xAC, 0x75, 0xCF, 0x6D, 0xEC, 0x3D, 0x22, 0xD7, 0xC8,
-    0xB7, 0x0E, 0x39, 0x37, 0x06, 0x86, 0x8D, 0x51, 0xEB, 0x83, 0x15, 0x55, 0xF5, 0xB5, 0x66, 0x5D,
-    0x2F, 0xAC, 0xE3, 0x4D, 0x25, 0x76, 0x1E, 0xA6, 0xB6, 0x0E, 0x45, 0x0A, 0x37, 0x34, 0xF9, 0xE8,
-    0xB3, 0x8E, 0x9F, 0xA9, 0x12, 0xE1, 0xB0, 0x64, 0x1D, 0xBF, 0x09, 0x96, 0x5A, 0xFB, 0x1D, 0xAD,
-    0x86, 0xFE, 0x61, 0x4E, 0x3D, 0xCD, 0xFA, 0xD9, 0x2A, 0xE0, 0x80, 0x05, 0x16, 0xFF, 0x0A, 0x21,
-    0xEB, 0xB8, 0xDC, 0xF8, 0x9D, 0xD6, 0x35, 0x1D, 0xD5, 0xB4, 0x3E, 0xD3, 0x5A, 0x4B, 0xBC, 0xFC,
-    0x88, 0x98, 0xA7, 0xB4, 0x0E, 0x06, 0x2B, 0xD6, 0x68, 0x34, 0x6E, 0x6B, 0xDD, 0x1D, 0x27, 0x88,
-    0x14, 0xCA, 0xA0, 0x1D, 0x2D, 0x0A, 0xFD, 0x6C, 0x25, 0x6A, 0xC7, 0x8B, 0xEC, 0x8E, 0x11, 0xE0,
-    0x04, 0x9C, 0x4C, 0x9C, 0x10, 0x97, 0x2F, 0x93, 0x6C, 0xE3, 0x7D, 0x02, 0x4B, 0xF4, 0x1E, 0xCC,
-    0x8D, 0xC0, 0x15, 0xB8, 0xB1, 0x93, 0x3A, 0x99, 0xDD, 0xA5, 0x40, 0x58, 0x03, 0xAB, 0x63, 0x66,
-    0x48, 0x8D, 0x79, 0x65, 0x4C, 0xC4, 0x34, 0x38, 0x06, 0x80, 0x30, 0xB7, 0xFA, 0xE6, 0x70, 0xEB,
-    0xFF, 0x20, 0x51, 0xFD, 0x5F, 0x12, 0x5E, 0x1F, 0x88, 0xB3, 0xAC, 0xE6, 0x9C, 0xAB, 0x1F, 0xDE,
-    0x0F, 0x72, 0x40, 0x59, 0x61, 0xCA, 0x85, 0x65, 0x52, 0xE0, 0x37, 0xF6, 0x3A, 0xE4, 0x04, 0x39,
-    0xDD, 0x97, 0x22, 0x17, 0x45, 0x63, 0x2F, 0x8A, 0x51, 0x9C, 0x04, 0x3F, 0x8E, 0xB0, 0x49, 0x3E,
-    0xAE, 0x34, 0x1A, 0x75, 0x3B, 0x69, 0x39, 0xCF, 0x5E, 0x7C, 0x74, 0x53, 0x95, 0x64, 0x61, 0xF4,
-    0xFC, 0x79, 0xAF, 0x24, 0x52, 0x47, 0xB9, 0x6A, 0x2B, 0x9B, 0x9E, 0xC6, 0x4F, 0xAD, 0xCC, 0x96,
-    0x4E, 0x68, 0x4B, 0x1E, 0x5B, 0x8A, 0xC7, 0x9E, 0x9C, 0xFD, 0xEF, 0xD1, 0xED, 0x99, 0xE8, 0xCE,
-    0x1A, 0xBE, 0x19, 0x51, 0x62, 0xF6, 0x57, 0x4A, 0x82, 0x95, 0xAD, 0x55, 0xBD, 0x72, 0x5F, 0xF7,
-    0x94, 0xAA, 0x25, 0x05, 0x8A, 0x79, 0xCB, 0x8F, 0xD3, 0x79, 0x77, 0x88, 0xDC, 0x88, 0x98, 0xF3,
-    0xD0, 0xFE, 0xEB, 0xBF, 0xCE, 0x3E, 0x4F, 0xB2, 0xCD, 0x64, 0xC9, 0x74, 0xA1, 0x31, 0x1E, 0x6F,
-    0x39, 0x51, 0xFB, 0x38, 0x25, 0x46, 0x5D, 0x73, 0xC9, 0x03, 0xAF, 0xD1, 0x68, 0x2E, 0x51, 0x24,
-    0x8A, 0xC0, 0x21, 0xFD, 0x09, 0x55, 0x46, 0xD9, 0x5C, 0xDC, 0x3F, 0xD3, 0x3A, 0x7D, 0x95, 0x74,
-    0x4A, 0x57, 0x9D, 0xB2, 0xA8, 0x0C, 0x90, 0x1C, 0x2B, 0xA7, 0x25, 0x77, 0xF5, 0x64, 0xD0, 0x27,
-    0x32, 0x13, 0xCD, 0xCC, 0xCF, 0x28, 0x9A, 0x87, 0x54, 0x6C, 0x8A, 0x1A, 0x0A, 0x72, 0xC5, 0x31,
-    0x5B, 0xEF, 0x84, 0xBA, 0x97, 0xCC, 0x79, 0x3D, 0x7E, 0xEB, 0x97, 0x01, 0x16, 0x06, 0x66, 0x9C,
-    0x00, 0x76, 0x0C, 0x96, 0x9A, 0x0C, 0x3B, 0x89, 0xE3, 0xE8, 0x5F, 0x75, 0x1E, 0xE8, 0xFB, 0x91,
-    0x1B, 0xE1, 0xF5, 0x7E, 0x4E, 0xA8, 0xA7, 0x30, 0xA2, 0x6D, 0x99, 0xAD, 0xE8, 0x77, 0x4F, 0x5E,
-    0x68, 0x45, 0xC1, 0x32, 0x51, 0xB8, 0xC3, 0x77, 0xF4, 0x83, 0x93, 0xC7, 0x3A, 0x3E, 0x18, 0x8A,
-    0x68, 0x1D, 0xE0, 0x60, 0x8E, 0x78, 0x1B, 0x11, 0x3E, 0x71, 0x33, 0xC1, 0xEE, 0xFA, 0xC0, 0xB8,
-    0x8D, 0x96, 0xD3, 0xB5, 0xE5, 0x3C, 0x12, 0x2E, 0xDB, 0xD2, 0x4B, 0x79, 0x4F, 0x47, 0x1E, 0x15,
-    0x83, 0x31, 0x01, 0xF1, 0x6A, 0xFC, 0xC1, 0x9F, 0x21, 0xCA, 0xF8, 0xE3, 0xCF, 0x91, 0xC3, 0x28,
-    0x70, 0x00, 0x5C, 0x00, 0xC8, 0xC0, 0xB4, 0x99, 0x94, 0x2B, 0xC0, 0x68, 0xEE, 0xA5, 0xE4, 0x2E,
-    0x51, 0x42, 0x28, 0xBA, 0xCF, 0x7E, 0xA9, 0x5B, 0x37, 0xA7, 0xC3, 0xD4, 0xD7, 0x90, 0x7F, 0xA5,
-    0x35, 0xB0, 0x80, 0x3F, 0x7C, 0x1F, 0xE4, 0xF8, 0x8F, 0xFF, 0xF2, 0xE5, 0x2D, 0x66, 0xD4, 0x06,
-    0x83, 0x1E, 0x60, 0x20, 0x4E, 0xB5, 0x83, 0x96, 0xF3, 0x34, 0x35, 0x1D, 0x95, 0x9F, 0x3E, 0x8A,
-    0x0E, 0xE6, 0x78, 0x64, 0x70, 0xDF, 0x50, 0xAE, 0xEE, 0x3C, 0xDE, 0x3E, 0xC4, 0x63, 0x27, 0x67,
-    0xA5, 0xF0, 0x42, 0x16, 0xE3, 0xFC, 0x74, 0x29, 0x13, 0x89, 0x50, 0x7E, 0x3A, 0xB9, 0x48, 0x22,
-    0xE5, 0xED, 0xDA, 0x2F, 0x24, 0x69, 0xA3, 0x3E, 0x8D, 0x94, 0xF5, 0x70, 0xE4, 0x24, 0x5D, 0x1E,
-    0x98, 0xE6, 0x57, 0x0A, 0x7C, 0xDE, 0x15, 0xD2, 0xBD, 0x7D, 0xE8, 0x9E, 0x7E, 0xE8, 0xDD, 0x7C,
-    0xF4, 0x37, 0x1C, 0x2C, 0x9E, 0xE3, 0xF2, 0x50, 0xF0, 0xE3, 0x53, 0xB5, 0x3B, 0xD6, 0xEA, 0x55,
-    0xC1, 0x76, 0xB1, 0x61, 0x7D, 0x1A, 0xB7, 0x53, 0x3B, 0xE1, 0x7F, 0xC7, 0x9B, 0x86, 0x57, 0x76,
-    0xDA, 0xBE, 0xFA, 0xB4, 0xF7, 0x39, 0x89, 0xA9, 0x49, 0xFE, 0x4F, 0x27, 0xFC, 0xF7, 0xB3, 0x5E,
-    0x52, 0xBB, 0x4D, 0xC0, 0x62, 0x3B, 0xF0, 0x32, 0xAD, 0x78, 0x38, 0x09, 0x7A, 0x27, 0x4C, 0xEB,
-    0xEF, 0xD7, 0x50, 0xD3, 0x27, 0x2D, 0x5B, 0x09, 0x92, 0xA8, 0x49, 0xAE, 0x9F, 0x53, 0x0F, 0xA4,
-    0x4E, 0xA8, 0xA9, 0x5C, 0xD8, 0x75, 0x2A, 0xF1, 0x7E, 0x95, 0xCF, 0x36, 0xCD, 0x98, 0x99, 0xB2,
-    0xA2, 0xB7, 0x82, 0x7A, 0x4B, 0x5B, 0xDA, 0xFA, 0xB9, 0xFE, 0x52, 0xB2, 0x71, 0xA7, 0x4F, 0xA2,
-    0xC6, 0x2D, 0x53, 0xFC, 0xB4, 0xA7, 0xC3, 0xEB, 0xB4, 0xBA, 0x41, 0x93, 0xA7, 0xF4, 0x27, 0x18,
-    0x27, 0xDA, 0xB1, 0xD0, 0xD3, 0x5F, 0x50, 0xDB, 0x15, 0xCF, 0xB5, 0x7E, 0x6F, 0x7F, 0x45, 0xE1,
-    0x1B, 0x14, 0xBD, 0x19, 0xA3, 0x4C, 0xB9, 0x40, 0xEE, 0xBD, 0xC1, 0xCB, 0xF8, 0x45, 0xDF, 0xA6,
-    0x0E, 0x79, 0x2F, 0x80, 0xAB, 0x84, 0x31, 0x9E, 0x0D, 0x0A, 0xFE, 0x6D, 0x33, 0x5E, 0xEA, 0x73,
-    0x61, 0x50, 0x3F, 0x93, 0xB6, 0xE9, 0x35, 0xFD, 0x82, 0xA2, 0x16, 0xD5, 0xDF, 0xEA, 0xE3, 0xC4,
-    0x6B, 0x2F, 0x69, 0x6D, 0x9D, 0xF1, 0x9D, 0xE3, 0x30, 0x8E, 0x0A, 0x0B, 0x13, 0x23, 0x82, 0x7F,
-    0x1A, 0x8E, 0x11, 0x3D, 0x0F, 0x4E, 0xF9, 0xCF, 0x92, 0xBA, 0x25, 0x79, 0x83, 0x95, 0x19, 0x22,
-    0xBC, 0x96, 0xE7, 0x4C, 0x1E, 0x2C, 0xE6, 0xA9, 0x5B, 0x27, 0xA3, 0xF9, 0xC5, 0xE1, 0xC2, 0xF0,
-    0x42, 0xBE, 0x30, 0x31, 0x7F, 0x97, 0x05, 0x23, 0xDC, 0x66, 0xC7, 0xB2, 0x1E, 0x17, 0x0A, 0x46,
-    0xFB, 0xF7, 0xA4, 0x6D, 0x25, 0x1B, 0x3C, 0x1C, 0x41, 0x85, 0x49, 0xFE, 0x09, 0x2B, 0x1B, 0x2E,
-    0xD7, 0x51, 0x70, 0x7E, 0x9D, 0x17, 0xA3, 0x7C, 0x07, 0x27, 0xB2, 0x52, 0x29, 0x8A, 0x3F, 0x51,
-    0x81, 0xD9, 0x70, 0x88, 0x3A, 0xF9, 0xA6, 0xFB, 0xDD, 0x89, 0xE1, 0x99, 0x7C, 0x61, 0x64, 0x61,
-    0xA2, 0x72, 0x05, 0x17, 0xCF, 0xA7, 0x5B, 0x53, 0xA3, 0xDF, 0xBB, 0x32, 0x6A, 0x17, 0x26, 0x86,
-    0x17, 0xAE, 0xE4, 0x2B, 0x8B, 0x23, 0xF5, 0xC2, 0x44, 0x70, 0xF1, 0xDC, 0x85, 0xC3, 0x25, 0x44,
-    0x36, 0x66, 0x10, 0x71, 0x7A, 0xFC, 0x81, 0xA8, 0x76, 0x4F, 0xCE, 0xF0, 0x60, 0xC1, 0xC6, 0xB7,
-    0x58, 0x79, 0x7D, 0xA4, 0x32, 0xB3, 0x50, 0x59, 0x88, 0xBE, 0x29, 0xDF, 0x08, 0xE6, 0xE9, 0xF8,
-    0xC2, 0x90, 0xF5, 0x01, 0xBE, 0x4D, 0xF6, 0xED, 0x88, 0xFF, 0x88, 0xAF, 0x2E, 0x07, 0xF8, 0x0F,
-    0xDD, 0x7D, 0x3D, 0xB0, 0x24, 0xD7, 0x75, 0xDE, 0xED, 0x1E, 0xEC, 0x6B, 0x09, 0x5D, 0xC5, 0x46,
-    0x80, 0x35, 0x25, 0xC0, 0xC5, 0x56, 0xA2, 0x2A, 0x89, 0x32, 0xD9, 0x89, 0x03, 0xA9, 0x8C, 0x9D,
-    0xEE, 0x05, 0xAA, 0xCC, 0x80, 0x01, 0x5E, 0x80, 0x47, 0xB8, 0xBC, 0xC1, 0x32, 0x50, 0x40, 0x51,
-    0x25, 0x3F, 0x07, 0x0E, 0x68, 0xD7, 0xCE, 0x74, 0x03, 0x0C, 0x18, 0x20, 0xD0, 0x06, 0x04, 0x5D,
-    0x65, 0x05, 0xDC, 0x00, 0x72, 0x91, 0x0F, 0x55, 0x5E, 0x05, 0x0C, 0x68, 0xD7, 0xFC, 0x34, 0xB8,
-    0xA5, 0x42, 0x80, 0x00, 0x2D, 0xC0, 0x24, 0x03, 0x06, 0x68, 0x11, 0xBB, 0xA2, 0xB5, 0x28, 0x17,
-    0x1A, 0x42, 0x2F, 0xB7, 0xDF, 0xA2, 0x67, 0xDA, 0xE7, 0xFB, 0xCE, 0xED, 0x9E, 0x99, 0xF7, 0xDE,
-    0x02, 0xA0, 0x0C, 0x10, 0x90, 0x16, 0x78, 0xF3, 0x7E, 0xFA, 0xEF, 0xDE, 0x73, 0xCF, 0x3D, 0xE7,
-    0x3B, 0xBF, 0x6D, 0xCC, 0x9F, 0x18, 0x63, 0x46, 0x95, 0x7C, 0x84, 0x99, 0x7C, 0xCC, 0xF0, 0x5B,
-    0x21, 0x1F, 0x9F, 0x31, 0x9B, 0x7F, 0x51, 0xD7, 0xE5, 0xA3, 0xAE, 0x6B, 0x4D, 0xDA, 0x75, 0x99,
-    0x5F, 0xD8, 0xD3, 0x82, 0x5C, 0x3E, 0x5A, 0x7B, 0xA1, 0x5B, 0xCB, 0x0F, 0x31, 0x2E, 0xBE, 0x77,
-    0xF4, 0x82, 0x89, 0xBB, 0xCE, 0x78, 0x5D, 0x57, 0x99, 0xF9, 0xC9, 0xF3, 0x1C, 0x9C, 0x17, 0xF5,
-    0x8F, 0xC4, 0x05, 0x1E, 0x2E, 0x58, 0xCA, 0x8D, 0x83, 0xAE, 0xAB, 0xED, 0x03, 0xFD, 0x4C, 0x8E,
-    0xB6, 0x51, 0x62, 0x82, 0x67, 0xE5, 0x87, 0x6B, 0xBF, 0xBD, 0x19, 0x8A, 0x8B, 0x61, 0xC8, 0xED,
-    0x73, 0xB9, 0x7D, 0xC3, 0xDB, 0xFB, 0xFD, 0xED, 0xF1, 0x1C, 0xA7, 0xC1, 0xED, 0x93, 0xFE, 0xF6,
-    0x47, 0x47, 0xC9, 0x08, 0xC3, 0x90, 0x71, 0x1B, 0x8E, 0x7B, 0xE7, 0xBC, 0x50, 0xCE, 0x73, 0xFB,
-    0x61, 0xF0, 0x82, 0x54, 0x2E, 0xF0, 0x71, 0xE3, 0xAE, 0xEB, 0x12, 0x3C, 0x66, 0x2D, 0x8F, 0xE9,
-    0x4A, 0x19, 0xDD, 0x6A, 0x6B, 0x86, 0x38, 0x73, 0x8C, 0x91, 0x97, 0xF2, 0xC1, 0x19, 0xFE, 0xF5,
-    0x53, 0xC6, 0xE0, 0xB2, 0x50, 0x4E, 0x76, 0x56, 0xCE, 0x32, 0x89, 0x12, 0xB7, 0x95, 0xF3, 0x82,
-    0x5C, 0x2E, 0x58, 0xC9, 0x79, 0x41, 0x21, 0xE7, 0xB5, 0xF2, 0xE4, 0x20, 0x6F, 0x8D, 0xDB, 0xC8,
-    0x0F, 0xE9, 0xC5, 0xE6, 0xFC, 0x61, 0x19, 0x5D, 0xEC, 0xE4, 0xBC, 0x70, 0x25, 0x37, 0x79, 0x98,
-    0xF3, 0x7B, 0x50, 0x68, 0x34, 0xAA, 0xED, 0x7D, 0x31, 0x40, 0x2E, 0xC6, 0x0F, 0x76, 0x17, 0x23,
-    0x1B, 0xE1, 0x61, 0x32, 0xA9, 0xE4, 0x83, 0x16, 0xE3, 0xF4, 0x50, 0x4F, 0x2F, 0x46, 0xB2, 0xBD,
-    0x18, 0x3B, 0xE7, 0xD9, 0x7F, 0x8F, 0xCA, 0xBA, 0x38, 0x42, 0x0B, 0xE3, 0xAF, 0xBF, 0xD3, 0x9A,
-    0xA8, 0x34, 0x0F, 0x98, 0xA5, 0x5C, 0x64, 0x30, 0xEA, 0x11, 0x08, 0xE9, 0xE1, 0x72, 0xBF, 0xEC,
-    0x2F, 0x0B, 0x6E, 0x1F, 0x7D, 0x0F, 0xA4, 0x68, 0x31, 0xD6, 0x96, 0x0F, 0x30, 0xF1, 0xF0, 0xC1,
-    0x5F, 0x23, 0xF0, 0x5A, 0xC8, 0x93, 0x71, 0x99, 0xD7, 0x70, 0x69, 0x9F, 0xFF, 0x33, 0x23, 0x9C,
-    0x20, 0xB7, 0x0D, 0x3B, 0xFC, 0xE1, 0x7C, 0x3F, 0x80, 0xB0, 0x13, 0x0A, 0x82, 0x07, 0xD7, 0xFF,
-    0x5E, 0x96, 0xC6, 0x38, 0xBA, 0x84, 0xAD, 0xBD, 0x8F, 0xAE, 0x25, 0xEE, 0xD5, 0x61, 0x2A, 0x6B,
-    0xDC, 0x14, 0x43, 0x8B, 0xF0, 0xF7, 0x14, 0xB7, 0x5F, 0xF6, 0x03, 0x0D, 0x87, 0xD9, 0xE7, 0xF8,
-    0x8B, 0x83, 0x43, 0xD3, 0x83, 0x65, 0xE9, 0x81, 0xF5, 0x22, 0x3C, 0xF4, 0xDC, 0x3E, 0xF9, 0x33,
-    0xC8, 0xBD, 0x52, 0xA8, 0x38, 0x17, 0xA2, 0xD8, 0x1F, 0xDB, 0xDD, 0x1F, 0x43, 0xD9, 0x07, 0x5B,
-    0x3F, 0x92, 0x80, 0xC6, 0x5C, 0xB9, 0x62, 0xDA, 0x16, 0xFF, 0xFF, 0xF1, 0x1F, 0xF7, 0xAB, 0x45,
-    0xBA, 0x4E, 0x49, 0xD4, 0x39, 0x9F, 0xDD, 0x62, 0xC0, 0x72, 0xA9, 0x5C, 0xA2, 0xFF, 0x0B, 0xCD,
-    0x65, 0x19, 0xC9, 0x1B, 0x58, 0x15, 0xA1, 0x8F, 0xFC, 0x1F, 0x6F, 0x5D, 0xD7, 0xF2, 0x4E, 0x73,
-    0x3B, 0xF4, 0x56, 0x67, 0x8C, 0xB5, 0xC3, 0x3A, 0xE3, 0xC9, 0xF8, 0xC2, 0xCA, 0x81, 0x1B, 0x40,
-    0x9A, 0xFE, 0x0B, 0x6B, 0x0C, 0x72, 0xC7, 0x76, 0x75, 0xC1, 0x09, 0xD3, 0xD3, 0xB7, 0xE2, 0x6D,
-    0xEC, 0xAD, 0x64, 0x39, 0x7E, 0x77, 0x99, 0x0B, 0xEB, 0xCB, 0x10, 0x40, 0x8E, 0x7E, 0xD3, 0x81,
-    0xAA, 0x66, 0x64, 0xBF, 0x7B, 0xD8, 0x0F, 0xBA, 0xF5, 0x38, 0xB6, 0xA0, 0xFF, 0x9E, 0x71, 0x2D,
-    0xE4, 0x99, 0xFA, 0x3D, 0x56, 0x4E, 0x94, 0xEF, 0x4A, 0x9F, 0xA9, 0x48, 0x87, 0x7D, 0x32, 0xAC,
-    0x87, 0xFD, 0x25, 0x17, 0xC9, 0x66, 0x93, 0x71, 0x37, 0x32, 0xF2, 0x47, 0x6B, 0x4C, 0x29, 0xC8,
-    0xDD, 0x16, 0x7B, 0x92, 0x77, 0x94, 0x8B, 0x64, 0x06, 0x2D, 0xA6, 0x26, 0xB3, 0x68, 0x31, 0xBD,
-    0x18, 0x17, 0xC9, 0xC1, 0x18, 0x03, 0x97, 0x83, 0x31, 0x06, 0x4E, 0x42, 0x85, 0xD5, 0xE7, 0x65,
-    0x6C, 0x8B, 0xA3, 0x2E, 0x8F, 0x5B, 0x6C, 0xC6, 0xB5, 0x89, 0x4B, 0x7C, 0x2F, 0xB7, 0x76, 0x8E,
-    0xEE, 0x28, 0xB9, 0x1C, 0x84, 0x92, 0xBB, 0x62, 0x54, 0x18, 0x61, 0xAB, 0x9B, 0x68, 0xAA, 0x64,
-    0xBA, 0xFF, 0x39, 0x2B, 0x7B, 0x8E, 0xC8, 0x04, 0xE1, 0x95, 0x00, 0xDF, 0x44, 0x10, 0xDD, 0x3A,
-    0x78, 0xFA, 0xCE, 0x61, 0xAB, 0xE7, 0xA4, 0x59, 0x8B, 0x73, 0xBC, 0x2A, 0x26, 0xE5, 0x5B, 0x19,
-    0x22, 0x46, 0xEB, 0x15, 0x9C, 0xCC, 0xB3, 0x3C, 0xC7, 0x2F, 0xB6, 0xCF, 0xF1, 0x1A, 0x9C, 0x73,
-    0xFB, 0x7A, 0x23, 0xCF, 0xC3, 0xB6, 0x96, 0xF3, 0x64, 0xAF, 0x5D, 0xFD, 0x15, 0x84, 0xCF, 0x4B,
-    0x14, 0x3E, 0x2D, 0x76, 0x5C, 0xE5, 0xAC, 0x92, 0x34, 0xC7, 0x83, 0x21, 0x7C, 0x0A, 0xB9, 0x60,
-    0x0E, 0xE1, 0x93, 0xF7, 0xC2, 0x27, 0x03, 0xF3, 0xC9, 0x0F, 0xD1, 0xC5, 0x46, 0xEE, 0x04, 0x36,
-    0x53, 0xFE, 0x13, 0x3E, 0x78, 0xC1, 0x58, 0xA6, 0xD0, 0x8F, 0x19, 0xD9, 0x19, 0x1F, 0x8F, 0x99,
-    0xED, 0x7F, 0xE4, 0x67, 0x4C, 0x29, 0x91, 0xCB, 0xE2, 0x44, 0xC6, 0x15, 0x67, 0x72, 0x72, 0x84,
-    0xA5, 0x88, 0xC0, 0xC2, 0xB2, 0xB3, 0xBC, 0x52, 0x3E, 0xDC, 0x3A, 0x28, 0xF0, 0xD4, 0x02, 0xF4,
-    0x02, 0x5F, 0x62, 0x25, 0x3C, 0x19, 0xA6, 0x1C, 0x81, 0x1C, 0x68, 0xF1, 0xD8, 0x18, 0x0F, 0x0B,
-    0x33, 0xB9, 0x9A, 0x5B, 0xC8, 0xAD, 0x94, 0xDD, 0xC3, 0x5C, 0x59, 0x46, 0x28, 0x33, 0xD5, 0xBD,
-    0x81, 0x83, 0x20, 0x81, 0x7B, 0x8D, 0x7C, 0x57, 0x98, 0x41, 0x44, 0x05, 0x09, 0x25, 0x04, 0x07,
-    0xF7, 0xAF, 0xCC, 0xC9, 0xB1, 0xFA, 0x15, 0x9E, 0x90, 0xE6, 0x58, 0xC8, 0x35, 0xF7, 0x15, 0x36,
-    0xB5, 0xDB, 0xE1, 0x86, 0xE1, 0x92, 0x6C, 0xD6, 0xC8, 0x33, 0x82, 0x97, 0xB9, 0xDB, 0xA3, 0x04,
-    0x3B, 0x1C, 0x7B, 0x7A, 0x2C, 0xC7, 0x21, 0x98, 0x33, 0xAF, 0x8C, 0xE4, 0x82, 0xE8, 0x62, 0x2D,
-    0x63, 0x6B, 0x83, 0x0C, 0x23, 0xE1, 0x9E, 0x7F, 0x2E, 0x17, 0x06, 0x9C, 0x4F, 0x64, 0x28, 0xEE,
-    0xDD, 0x12, 0x24, 0xE9, 0x30, 0xF0, 0x18, 0xD4, 0x74, 0x84, 0xB5, 0x45, 0x26, 0x34, 0x58, 0x9E,
-    0x38, 0xD7, 0x15, 0x7B, 0x41, 0xFE, 0x93, 0xA7, 0x41, 0xF1, 0x2D, 0x2E, 0x95, 0xD8, 0x49, 0xD8,
-    0x20, 0x7B, 0xC7, 0x3B, 0xE3, 0x05, 0xE3, 0xB5, 0xD8, 0x39, 0x91, 0x3C, 0x07, 0x42, 0xB5, 0x05,
-    0xCB, 0xC9, 0x64, 0x85, 0x1E, 0x53, 0x2B, 0x2C, 0x16, 0x2A, 0x9D, 0x64, 0xAF, 0x80, 0x1E, 0x41,
-    0x06, 0x9E, 0x20, 0x91, 0xFD, 0x97, 0x70, 0xC7, 0x09, 0x79, 0xE4, 0x17, 0xA0, 0x0F, 0xB6, 0x81,
-    0xCC, 0x14, 0xE4, 0x09, 0xB9, 0xC2, 0x5C, 0xD7, 0x18, 0x82, 0xD7, 0xC7, 0x90, 0x5C, 0xFC, 0xFE,
-    0x15, 0x1C, 0x0F, 0xB0, 0x3E, 0x86, 0x3B, 0xC5, 0x49, 0x06, 0xCA, 0x81, 0x44, 0x32, 0x82, 0xA9,
-    0xA1, 0x80, 0xC3, 0x7E, 0x9B, 0x83, 0x5F, 0x03, 0xCE, 0xA8, 0x35, 0x14, 0x7C, 0x86, 0xF2, 0x90,
-    0x62, 0x72, 0xB8, 0x20, 0x36, 0x94, 0x93, 0xF7, 0xB9, 0x60, 0x54, 0x41, 0x70, 0x4D, 0xB1, 0x14,
-    0x2A, 0x35, 0xFB, 0x0B, 0xEE, 0x1D, 0x1D, 0x35, 0x80, 0x01, 0x5D, 0x82, 0x7D, 0x25, 0xE7, 0x78,
-    0x5C, 0xE4, 0x89, 0xE9, 0x55, 0x7C, 0x2F, 0x62, 0xF0, 0xB9, 0xAF, 0x04, 0xC3, 0x64, 0x55, 0x15,
-    0x51, 0xF2, 0x77, 0x72, 0xCC, 0x7B, 0x43, 0x3E, 0x82, 0x57, 0x21, 0xFC, 0xFE, 0x5C, 0x3E, 0x62,
-    0x5C, 0x3A, 0xC5, 0x47, 0x2B, 0x73, 0x70, 0x6B, 0x6E, 0x44, 0x0A, 0xDC, 0x51, 0xA9, 0x6C, 0x15,
-    0x59, 0x7C, 0x50, 0x99, 0xF5, 0xD1, 0x8B, 0x95, 0x10, 0xC9, 0xAD, 0xC9, 0x6C, 0x9C, 0x01, 0x08,
-    0xDD, 0x40, 0xC7, 0xB4, 0xA4, 0xF3, 0x82, 0xA3, 0x90, 0x2B, 0xCA, 0x11, 0x36, 0xA5, 0x5C, 0x95,
-    0xBF, 0x9F, 0x02, 0x3E, 0xA0, 0xC4, 0xCC, 0x14, 0x0D, 0x95, 0x97, 0x5A, 0xA1, 0x47, 0x58, 0xC8,
-    0x79, 0x0B, 0xCA, 0x34, 0x30, 0xB7, 0xD0, 0xC2, 0x2F, 0x84, 0xD8, 0xD8, 0xAE, 0x91, 0x60, 0x05,
-    0xBF, 0xF6, 0xEE, 0x5D, 0x5F, 0x83, 0x0C, 0x42, 0x85, 0xB5, 0xCC, 0x29, 0x5A, 0x5F, 0x55, 0x64,
-    0xE1, 0xA9, 0x26, 0x15, 0xAE, 0x12, 0xE1, 0x59, 0x11, 0x5A, 0x50, 0x0C, 0x4E, 0x65, 0x80, 0xF2,
-    0xB4, 0x00, 0xF7, 0x15, 0x91, 0x77, 0xB4, 0x2C, 0x0D, 0xA8, 0xE7, 0x41, 0xF0, 0x89, 0x70, 0x01,
-    0xE1, 0xF5, 0xF4, 0x82, 0xAA, 0x45, 0xC8, 0xB9, 0x72, 0xC1, 0x48, 0x10, 0x02, 0xF2, 0x40, 0x77,
-    0xE5, 0xAC, 0xE5, 0x1A, 0x1F, 0xD3, 0x89, 0xF5, 0x89, 0x8A, 0xC4, 0xA8, 0x12, 0x39, 0x8D, 0x99,
-    0x25, 0x34, 0x26, 0x88, 0x3D, 0xCB, 0x3F, 0xB6, 0xFD, 0x1F, 0xB3, 0x33, 0xFE, 0x08, 0x0A, 0x60,
-    0xF5, 0x4E, 0xFD, 0x11, 0xC4, 0xB2, 0x9A, 0x12, 0xC4, 0x83, 0xC6, 0x52, 0x4D, 0x22, 0x2B, 0x5E,
-    0xF0, 0x66, 0x14, 0x0F, 0x7C, 0x14, 0x25, 0x3C, 0xCE, 0x86, 0x02, 0x23, 0xF7, 0x5B, 0xF9, 0xAF,
-    0x8A, 0x01, 0x27, 0x4F, 0xA9, 0x05, 0x71, 0xD3, 0x88, 0xCF, 0x21, 0x55, 0x28, 0xA2, 0x1B, 0x63,
-    0x95, 0xA9, 0xAA, 0x5A, 0xAB, 0x4D, 0x7D, 0x4A, 0x73, 0x87, 0xD2, 0x17, 0x58, 0x44, 0xAE, 0xBC,
-    0x2E, 0x6C, 0xD7, 0x5D, 0x0B, 0x29, 0xC9, 0x5D, 0x7E, 0x56, 0x64, 0xAA, 0x31, 0x87, 0xE9, 0x15,
-    0x63, 0x6A, 0x5E, 0xB2, 0x62, 0x90, 0x53, 0x26, 0xB6, 0xDC, 0x22, 0xE7, 0x7E, 0xBD, 0xA0, 0x58,
-    0x40, 0x60, 0x04, 0x59, 0x20, 0xC7, 0x63, 0x20, 0x19, 0x07, 0x4A, 0x0F, 0x80, 0x0B, 0xFB, 0x53,
-    0xC4, 0xAE, 0x3C, 0x7A, 0x6E, 0x52, 0x6A, 0x86, 0x56, 0x71, 0x91, 0xB0, 0x54, 0xCD, 0xBB, 0x37,
-    0x01, 0x07, 0xFF, 0x52, 0xC3, 0x9D, 0xEF, 0xBD, 0x56, 0x2F, 0xAC, 0x26, 0x6F, 0xED, 0x77, 0xAE,
-    0x47, 0x60, 0xBF, 0xC7, 0xDF, 0x7A, 0x8D, 0x1A, 0x7B, 0xE9, 0xE7, 0x14, 0x1F, 0x6D, 0xC0, 0xEF,
-    0x9E, 0xF0, 0x0B, 0x34, 0x1F, 0xB8, 0x88, 0x60, 0x42, 0x00, 0x2E, 0xD6, 0x65, 0xAD, 0xC2, 0xC8,
-    0x55, 0x70, 0x04, 0xB9, 0x32, 0x06, 0x3B, 0xF4, 0xF2, 0x2A, 0x4D, 0x20, 0x6C, 0x7B, 0x50, 0x7F,
-    0xD8, 0x15, 0xFA, 0xBC, 0xE0, 0xD6, 0x92, 0xF6, 0x46, 0xD1, 0x03, 0x41, 0xDC, 0x9A, 0x88, 0x81,
-    0x64, 0x8C, 0x15, 0x51, 0xBA, 0x47, 0x1D, 0x90, 0xDF, 0x55, 0x40, 0x42, 0x9C, 0x84, 0x69, 0xAA,
-    0x8D, 0x12, 0xF7, 0xD2, 0x40, 0xCD, 0x16, 0xFC, 0x7D, 0x4D, 0xA9, 0xE6, 0xDD, 0x12, 0x79, 0x16,
-    0x2A, 0x96, 0xC3, 0x5F, 0x9E, 0xFA, 0x94, 0x69, 0x81, 0x47, 0xCC, 0xE7, 0xC9, 0x26, 0x80, 0x6F,
-    0xC7, 0x97, 0x73, 0x88, 0x67, 0x4C, 0xC3, 0x59, 0x24, 0x3B, 0x7A, 0xC0, 0xB7, 0x14, 0x15, 0x4C,
-    0x03, 0xAA, 0x90, 0xBB, 0x04, 0xD1, 0xCA, 0xB8, 0x97, 0xDC, 0xCF, 0x6F, 0x63, 0xDC, 0xF1, 0x58,
-    0x6E, 0x3F, 0x7A, 0x07, 0x42, 0x36, 0xFA, 0xB2, 0x48, 0x52, 0xA7, 0xC1, 0x12, 0x40, 0xC3, 0xC7,
-    0xD0, 0xAD, 0x4E, 0xE3, 0x0B, 0x0E, 0xF0, 0x8B, 0x89, 0x3C, 0x2E, 0x1E, 0x95, 0x98, 0x08, 0xF1,
-    0xEB, 0xCF, 0x2B, 0x70, 0xCC, 0x65, 0x28, 0xEE, 0x79, 0x03, 0x09, 0xD8, 0x41, 0x8A, 0x04, 0x04,
-    0xA5, 0x69, 0x01, 0x79, 0xBE, 0xA6, 0xD0, 0xAE, 0x94, 0xC2, 0x9F, 0xB4, 0xBA, 0xA7, 0x1D, 0x66,
-    0xC5, 0x03, 0x85, 0xB4, 0xDD, 0xEA, 0x01, 0x38, 0xCC, 0x8C, 0x08, 0x0C, 0xAD, 0xC0, 0x50, 0xB1,
-    0x40, 0x80, 0xA8, 0x77, 0x02, 0x1D, 0xE5, 0xB0, 0x95, 0x0A, 0x0D, 0x0F, 0x4F, 0xC8, 0x67, 0x11,
-    0xF5, 0x4A, 0xC0, 0xC3, 0xC4, 0x47, 0x16, 0x8F, 0x2B, 0x36, 0xB7, 0xA8, 0x9B, 0x32, 0xE3, 0xC1,
-    0x65, 0x66, 0x89, 0x24, 0x87, 0xBB, 0x4C, 0xB9, 0xD4, 0xA2, 0x0B, 0x28, 0xDD, 0x06, 0x7F, 0x14,
-    0x23, 0xC3, 0x5B, 0x53, 0xFF, 0x44, 0x78, 0xF6, 0xCA, 0x2C, 0xE4, 0x56, 0xEB, 0x6A, 0xF4, 0x96,
-    0xEC, 0x88, 0x57, 0xF3, 0xE0, 0xBB, 0xB2, 0x2D, 0xC7, 0x66, 0x72, 0xC5, 0xB8, 0xEF, 0x08, 0xFF,
-    0xC8, 0x60, 0x9F, 0x2B, 0x82, 0x1B, 0x85, 0x99, 0xC5, 0x26, 0x0E, 0xB2, 0x91, 0x80, 0xC1, 0x66,
-    0x2C, 0x08, 0xB1, 0xF4, 0x8A, 0x99, 0x53, 0x87, 0x49, 0xE4, 0x56, 0x90, 0x34, 0xAD, 0x97, 0x4F,
-    0x46, 0xD5, 0xA8, 0x0C, 0x47, 0xA5, 0x10, 0x39, 0xBB, 0x10, 0xCA, 0xA8, 0x26, 0xA6, 0x16, 0x59,
-    0xEF, 0xE2, 0xC6, 0x90, 0xFE, 0xC1, 0x1A, 0x2C, 0x6A, 0x22, 0x59, 0x5A, 0x91, 0x07, 0x4B, 0x59,
-    0x21, 0xBF, 0x70, 0xA0, 0x24, 0x62, 0x48, 0xDF, 0x96, 0xD3, 0xF4, 0xA8, 0x63, 0xE7, 0x98, 0x52,
-    0x40, 0x5D, 0xD5, 0x42, 0x4A, 0x85, 0x19, 0x15, 0x1B, 0xCF, 0x49, 0xA8, 0x94, 0x55, 0x48, 0xC6,
-    0x10, 0xE6, 0x22, 0xAB, 0x8E, 0x56, 0xC4, 0xB8, 0xB0, 0xB1, 0x3B, 0x68, 0x2D, 0x55, 0x36, 0x3B,
-    0x17, 0x38, 0xBC, 0x80, 0xE4, 0xC5, 0x13, 0xA6, 0x94, 0xAF, 0x85, 0x47, 0x91, 0xB4, 0x75, 0xC1,
-    0x60, 0xB3, 0x66, 0xD6, 0xB2, 0xEB, 0x6E, 0x2D, 0x0B, 0xD1, 0xD6, 0xA3, 0x16, 0x46, 0x59, 0x9C,
-    0xA4, 0xD8, 0xEA, 0xE4, 0x8F, 0x90, 0xDA, 0x5A, 0xAE, 0x0F, 0x5E, 0x87, 0x45, 0x53, 0x13, 0x6F,
-    0x13, 0x6D, 0x47, 0xD4, 0xE8, 0x40, 0xE3, 0xEF, 0xC2, 0xE6, 0x69, 0xA0, 0x30, 0x5A, 0x5C, 0x93,
-    0xE2, 0xF4, 0xF8, 0x22, 0x68, 0x9E, 0xCB, 0xEF, 0x61, 0xE1, 0xD7, 0x80, 0x3A, 0xDD, 0xF3, 0x4B,
-    0x9A, 0x8B, 0x64, 0x99, 0x6C, 0x10, 0x03, 0x9D, 0xCA, 0x6B, 0x15, 0xD8, 0x54, 0xDC, 0x0E, 0x94,
-    0xE9, 0x19, 0x08, 0xC5, 0xAD, 0x87, 0x09, 0x29, 0x53, 0x8C, 0x2D, 0xA4, 0x31, 0x84, 0x34, 0xA4,
-    0x1E, 0x6D, 0xBF, 0xFB, 0x40, 0x9A, 0xF9, 0x80, 0x81, 0x94, 0x18, 0xFD, 0x05, 0xD4, 0xE6, 0x32,
-    0x84, 0xDC, 0xFA, 0x23, 0x3C, 0x2C, 0x06, 0x35, 0xF7, 0x9C, 0x66, 0x81, 0xDC, 0x6B, 0x4E, 0x66,
-    0x16, 0xDD, 0x07, 0x44, 0x10, 0x27, 0xB2, 0xC7, 0x2B, 0x6A, 0xFE, 0xA5, 0xC8, 0xB3, 0xE0, 0xF6,
-    0xF7, 0xDF, 0x57, 0x65, 0x9C, 0x61, 0xBA, 0x3B, 0x4B, 0xD9, 0x3E, 0xD4, 0x4F, 0xB0, 0xDC, 0x85,
-    0x97, 0x1F, 0xF2, 0x6B, 0x6B, 0x87, 0x6F, 0xEC, 0xE1, 0x45, 0x7F, 0x17, 0x5E, 0x08, 0x92, 0xBB,
-    0x1B, 0x59, 0xDC, 0xDB, 0xF9, 0xDC, 0x8E, 0x34, 0xF1, 0x79, 0x0D, 0x95, 0x49, 0x8A, 0x8F, 0xE5,
-    0xAD, 0x4B, 0x89, 0x2E, 0x6D, 0x8A, 0x2D, 0xEF, 0xEC, 0xAB, 0x7D, 0xF4, 0x5D, 0xF9, 0x7A, 0x8B,
-    0x40, 0x6E, 0x50, 0xFC, 0xF7, 0x45, 0x03, 0xF7, 0xFD, 0xE3, 0xD4, 0x2A, 0x88, 0xD3, 0x7F, 0x4C,
-    0x94, 0x02, 0xD8, 0x1A, 0x18, 0x2D, 0xA4, 0x3B, 0x2D, 0xE8, 0x42, 0x28, 0xE0, 0xD0, 0x62, 0xE4,
-    0xF6, 0x95, 0x01, 0xBB, 0x5C, 0xD9, 0x90, 0xEA, 0xAA, 0x21, 0x70, 0xC8, 0x31, 0x9F, 0x19, 0x41,
-    0xCA, 0xEB, 0xB4, 0xA6, 0x26, 0x54, 0x84, 0x98, 0x56, 0x84, 0x31, 0x3A, 0xB4, 0x71, 0x39, 0x4D,
-    0x12, 0x89, 0xEE, 0x03, 0xAA, 0x9F, 0x73, 0x87, 0x38, 0x4E, 0xC4, 0x12, 0xF0, 0xA4, 0x87, 0x77,
-    0x0D, 0x0E, 0xC5, 0x36, 0x96, 0xED, 0xE7, 0xAA, 0xF3, 0xD6, 0x2A, 0xC5, 0x80, 0xE0, 0xFE, 0xE2,
-    0x97, 0x5D, 0xE6, 0xC9, 0x0E, 0xF6, 0xEA, 0x11, 0x18, 0x29, 0x95, 0x81, 0xC7, 0x74, 0x08, 0x89,
-    0xD5, 0x5B, 0x4F, 0x31, 0x68, 0xD1, 0x3D, 0x42, 0x68, 0x91, 0xE7, 0xB0, 0x72, 0x7F, 0x44, 0x65,
-    0x5F, 0x09, 0x68, 0xCC, 0x5C, 0x01, 0xA1, 0x72, 0xB8, 0x25, 0x6F, 0x0A, 0x3E, 0x94, 0x1D, 0xDF,
-    0x89, 0x4A, 0x48, 0x2F, 0x75, 0x14, 0x8E, 0x32, 0xA0, 0xBD, 0xAE, 0xBB, 0x69, 0x2C, 0x91, 0x7B,
-    0x8F, 0x01, 0xF5, 0xA4, 0x35, 0xE1, 0x05, 0x2E, 0x8D, 0x94, 0x28, 0x89, 0x50, 0x50, 0x8D, 0x55,
-    0x21, 0xAD, 0x5B, 0x03, 0x2E, 0x78, 0xA5, 0x7A, 0x0C, 0xE8, 0x35, 0xF9, 0x32, 0xD6, 0x7D, 0x0C,
-    0x2A, 0x1B, 0x62, 0x02, 0x79, 0xD2, 0x70, 0x63, 0x98, 0xD4, 0xD0, 0x9B, 0xA0, 0xCF, 0x77, 0xC1,
-    0x1A, 0xED, 0x98, 0x7C, 0x83, 0xE7, 0xCD, 0xB1, 0x20, 0x1E, 0x34, 0x8D, 0xAE, 0x85, 0x0A, 0xF4,
-    0x18, 0xAE, 0x0C, 0xF0, 0xD3, 0x0A, 0x14, 0xB5, 0xC2, 0x77, 0xCB, 0xB6, 0x08, 0x3E, 0x9C, 0x6D,
-    0x51, 0x7C, 0x38, 0xDB, 0xC2, 0xBD, 0xAF, 0x6D, 0xB1, 0xBE, 0x06, 0xDB, 0x62, 0x4D, 0x9B, 0xBD,
-    0x1C, 0x96, 0x27, 0x38, 0x61, 0x58, 0x70, 0x57, 0x09, 0xC5, 0x60, 0x26, 0x94, 0xC0, 0x89, 0xF4,
-    0x03, 0x34, 0x46, 0x0D, 0xF9, 0x1F, 0xD5, 0x6A, 0x08, 0x84, 0xDF, 0x84, 0x7A, 0x92, 0x99, 0xC7,
-    0x1E, 0xA0, 0x74, 0x0C, 0xB8, 0xD8, 0x08, 0xAF, 0x85, 0xF7, 0xAE, 0xAF, 0x00, 0xDA, 0x72, 0xB3,
-    0xBC, 0x77, 0xB6, 0x2B, 0x2E, 0x3E, 0xCB, 0x15, 0xA7, 0xDA, 0x08, 0x4C, 0xEC, 0x02, 0x38, 0xA8,
-    0x42, 0x22, 0xBE, 0x8A, 0x55, 0x5E, 0x3B, 0x8D, 0x4A, 0x59, 0xA8, 0xC6, 0x8C, 0xA8, 0x5F, 0x26,
-    0x39, 0xC5, 0x31, 0x17, 0x10, 0x9D, 0x96, 0x8C, 0xC2, 0x5D, 0x8A, 0xF0, 0x39, 0x2E, 0xA0, 0xBA,
-    0xA3, 0x40, 0xEE, 0x6F, 0xC6, 0x0B, 0x5A, 0x4C, 0xB1, 0xBF, 0x59, 0x98, 0xF1, 0x12, 0xB9, 0x60,
-    0xA2, 0xEA, 0x93, 0xCF, 0xD7, 0x9B, 0xF1, 0xE9, 0xB1, 0x6A, 0x44, 0x31, 0x11, 0x5E, 0xBC, 0x77,
-    0x74, 0xBD, 0xF0, 0x09, 0x90, 0x3B, 0xF5, 0x7F, 0x74, 0xBB, 0x23, 0xAF, 0xCF, 0x18, 0xF9, 0x7C,
-    0x67, 0xE4, 0xF9, 0x19, 0x23, 0xAF, 0xCE, 0x18, 0x79, 0xAB, 0x3E, 0xB1, 0x33, 0x46, 0xDE, 0xDC,
-    0x6F, 0xE4, 0x6E, 0xC5, 0xE7, 0xEF, 0x8E, 0x7C, 0xB6, 0x19, 0xF9, 0xBD, 0x2F, 0xEB, 0xC8, 0x57,
-    0x3A, 0xF2, 0xCE, 0x9A, 0x20, 0xBD, 0xA0, 0x8C, 0xAD, 0xB0, 0xB4, 0xEA, 0x4A, 0xBD, 0x0B, 0x2A,
-    0x5D, 0x75, 0x93, 0xC7, 0xB2, 0xA4, 0xA1, 0x5C, 0xE5, 0xD3, 0x6A, 0x9F, 0x6F, 0x19, 0x44, 0x58,
-    0x55, 0x67, 0xF8, 0xE3, 0x5F, 0x26, 0xA2, 0x77, 0xD6, 0x04, 0xF9, 0x4E, 0xB3, 0xB7, 0x86, 0xBD,
-    0x97, 0xC3, 0x43, 0x05, 0x09, 0x0F, 0x27, 0xD6, 0xE3, 0x35, 0xAD, 0x08, 0xB0, 0xCC, 0xA8, 0x81,
-    0xAB, 0x4B, 0xAC, 0xBD, 0x15, 0x3D, 0xDA, 0xDC, 0xBD, 0x91, 0xE9, 0x15, 0xB6, 0x6A, 0x6C, 0xAB,
-    0xB2, 0x55, 0x67, 0xAB, 0x16, 0xB1, 0x7A, 0x47, 0x4E, 0x05, 0x73, 0x29, 0xC3, 0x63, 0xBA, 0x7F,
-    0x09, 0x20, 0x43, 0x63, 0x73, 0x4E, 0x3B, 0x03, 0xBB, 0xE4, 0xD1, 0x86, 0x6B, 0x10, 0x12, 0x2C,
-    0x98, 0x15, 0x49, 0x2B, 0xD6, 0x26, 0xF4, 0xF7, 0x8A, 0x3A, 0x0B, 0x8A, 0x26, 0x4A, 0x9C, 0x96,
-    0x9B, 0x36, 0x16, 0xDB, 0x50, 0xA4, 0x51, 0x25, 0x3C, 0x73, 0xEF, 0x3A, 0xC8, 0xBD, 0xE4, 0x6D,
-    0x30, 0x1F, 0xBB, 0x6B, 0x39, 0xE9, 0xDE, 0x7D, 0x38, 0x3B, 0xC3, 0x85, 0x78, 0xEF, 0x29, 0xDA,
-    0xBB, 0xC0, 0xF8, 0x82, 0x45, 0x1A, 0xA0, 0x11, 0x3C, 0x18, 0x16, 0x2F, 0x54, 0x5B, 0x98, 0x98,
-    0x15, 0x5C, 0x53, 0x90, 0x07, 0x22, 0x9A, 0xAB, 0xF4, 0xA8, 0x2B, 0xF0, 0x10, 0x95, 0x5C, 0x2A,
-    0x2D, 0x6F, 0xAA, 0xEB, 0xCE, 0xAC, 0xBF, 0x43, 0xCD, 0x4D, 0x13, 0x81, 0xDE, 0x65, 0xCA, 0x1F,
-    0xCE, 0x96, 0xE4, 0xEE, 0x3F, 0x1E, 0x3C, 0x7A, 0x91, 0x5E, 0x77, 0x20, 0x7E, 0x46, 0x0F, 0xD4,
-    0x6E, 0xDB, 0xF5, 0x47, 0xD3, 0x72, 0xA0, 0x26, 0x83, 0xD0, 0x16, 0xAD, 0xFB, 0x5F, 0x0E, 0x96,
-    0xB4, 0xF9, 0x61, 0x9A, 0xE3, 0x46, 0x07, 0x5B, 0x32, 0xDC, 0x85, 0xFF, 0xAD, 0xA1, 0xFD, 0x49,
-    0x43, 0xBA, 0x14, 0x0D, 0xB7, 0x84, 0x5A, 0x11, 0x64, 0xB1, 0x84, 0xE4, 0xAA, 0xA1, 0x15, 0x5A,
-    0xDC, 0x0A, 0x94, 0x85, 0x9A, 0x68, 0x9D, 0x06, 0xC3, 0x03, 0x6D, 0x41, 0xA2, 0xF9, 0xA8, 0xF2,
-    0xE9, 0x8C, 0x8D, 0x8F, 0x56, 0xFC, 0x15, 0x12, 0x41, 0x54, 0x53, 0x4A, 0xB0, 0xDF, 0x8A, 0x9E,
-    0x87, 0x77, 0x22, 0xA7, 0xA1, 0x86, 0x50, 0x00, 0x91, 0xCF, 0xC5, 0xC6, 0xA1, 0x05, 0x1B, 0x42,
-    0xA6, 0x99, 0x85, 0xCC, 0x74, 0x45, 0x58, 0x03, 0xDB, 0x65, 0x04, 0x8F, 0x44, 0x9C, 0x89, 0x5E,
-    0x12, 0x6B, 0xBF, 0x3B, 0x20, 0x76, 0xA1, 0x81, 0xDF, 0xC2, 0x80, 0x56, 0x07, 0xA7, 0x3A, 0x6E,
-    0x9C, 0xEB, 0xF2, 0x28, 0x32, 0x14, 0xD4, 0x82, 0xEC, 0xB7, 0x42, 0x68, 0xE4, 0xD1, 0x86, 0x9E,
-    0x5B, 0xB7, 0x6A, 0x6C, 0x91, 0xB2, 0x22, 0x68, 0xBA, 0x97, 0x3C, 0xF2, 0x54, 0x74, 0x07, 0x16,
-    0xC9, 0x12, 0x73, 0x27, 0x23, 0x99, 0x35, 0x21, 0x0B, 0x22, 0x18, 0xF4, 0x20, 0xC8, 0xB9, 0x30,
-    0x9B, 0x33, 0x91, 0x8D, 0x01, 0x80, 0xBB, 0x4B, 0x47, 0x6C, 0x0A, 0xC7, 0x6C, 0x50, 0xC2, 0x16,
-    0x69, 0x36, 0xA6, 0xDE, 0xB2, 0xBC, 0x22, 0xF4, 0x7D, 0x2E, 0x0F, 0xEF, 0x4C, 0x40, 0x9A, 0x2E,
-    0x59, 0xC8, 0x3C, 0x70, 0xB6, 0x68, 0x02, 0xAF, 0x84, 0x14, 0xE0, 0x3E, 0x9E, 0xAA, 0x5B, 0x06,
-    0xFE, 0x49, 0x17, 0xFE, 0xCF, 0x58, 0xCE, 0x0B, 0x6A, 0xAF, 0x72, 0x45, 0xC6, 0x3C, 0x73, 0xAF,
-    0x72, 0xBA, 0xF5, 0x58, 0x26, 0xF8, 0x44, 0x61, 0x75, 0x98, 0x31, 0x32, 0xC9, 0x3F, 0x5D, 0x2B,
-    0xD2, 0x88, 0x05, 0x4B, 0x85, 0xD6, 0x71, 0x4D, 0x84, 0xA2, 0x1B, 0x02, 0x2C, 0x2A, 0x08, 0x3C,
-    0x78, 0x45, 0xE6, 0xB1, 0xBE, 0x93, 0x16, 0x72, 0xCA, 0xD2, 0x85, 0xE1, 0x2C, 0x36, 0x58, 0x8C,
-    0xB5, 0x83, 0xB8, 0x8E, 0xE9, 0x4B, 0x1B, 0x63, 0x18, 0x70, 0x05, 0x8D, 0xAD, 0x03, 0x26, 0x83,
-    0xC3, 0xC4, 0x59, 0xC9, 0xE9, 0x3E, 0xCC, 0x8E, 0x10, 0x44, 0x38, 0x37, 0x18, 0x65, 0xF2, 0x5B,
-    0x2A, 0xFB, 0x7A, 0xFD, 0x34, 0x2C, 0x6B, 0x18, 0x3A, 0xD0, 0x09, 0xAD, 0x28, 0x6C, 0x61, 0xE6,
-    0xB0, 0x4C, 0xBB, 0x75, 0x22, 0x5F, 0x66, 0x71, 0x70, 0x58, 0xCC, 0x85, 0x60, 0x73, 0x79, 0xC0,
-    0x94, 0x4F, 0xF3, 0xAA, 0xA8, 0x88, 0x0A, 0x51, 0x3C, 0x89, 0xCB, 0x00, 0x43, 0x62, 0x91, 0xD9,
-    0xB1, 0xB0, 0xEC, 0xCA, 0x8C, 0xBF, 0xD2, 0xEA, 0x1C, 0xB0, 0xD3, 0x63, 0x46, 0x42, 0x1C, 0x79,
-    0xD2, 0x52, 0x18, 0xFA, 0x98, 0xB1, 0x0C, 0x7A, 0x9F, 0xAC, 0x6F, 0x1E, 0x8C, 0x52, 0x84, 0x26,
-    0x65, 0x08, 0xEC, 0x2A, 0x6F, 0xB5, 0xF7, 0x7D, 0x18, 0xC9, 0xB5, 0x2E, 0x59, 0xE2, 0x81, 0x18,
-    0xA9, 0xE5, 0x7B, 0xAE, 0x86, 0x8A, 0x91, 0xBD, 0xEE, 0x9B, 0x95, 0xDF, 0xB5, 0xAD, 0xDF, 0x84,
-    0x6B, 0x61, 0x28, 0xF9, 0xCD, 0x84, 0x3F, 0x6F, 0x14, 0x65, 0x43, 0xA3, 0xC5, 0x32, 0x95, 0xF0,
-    0xB9, 0xC2, 0xF8, 0xAF, 0xD5, 0x44, 0x1C, 0x2E, 0x9C, 0xD2, 0xA0, 0x89, 0x60, 0x8D, 0x8B, 0x6B,
-    0x0A, 0x35, 0xB3, 0x5C, 0x6D, 0x1C, 0x6F, 0x26, 0x5A, 0x09, 0x07, 0xAE, 0x4D, 0xFA, 0x93, 0xD5,
-    0x48, 0x04, 0xB9, 0x80, 0x13, 0x31, 0x63, 0x04, 0x39, 0xB8, 0x6D, 0xEC, 0x2C, 0x73, 0xE1, 0x3F,
-    0x1C, 0x8C, 0xAE, 0x52, 0x54, 0x28, 0x2C, 0xD0, 0x21, 0x45, 0xC5, 0xA3, 0x49, 0x2C, 0xB3, 0x8E,
-    0x64, 0xF4, 0xCE, 0xC6, 0xE8, 0x95, 0x79, 0xCA, 0x42, 0xA4, 0x85, 0x80, 0x2A, 0x51, 0x70, 0x5D,
-    0x72, 0x7E, 0x25, 0x72, 0xBD, 0xFB, 0x77, 0x82, 0xE4, 0x5C, 0x6E, 0x25, 0xB8, 0xAB, 0x62, 0x1A,
-    0xC6, 0x31, 0xE3, 0x75, 0x91, 0x69, 0xB8, 0xB1, 0xE7, 0x1E, 0x58, 0x08, 0x73, 0xE7, 0xDE, 0x0F,
-    0xC8, 0xF3, 0xA2, 0x8D, 0x9F, 0xBE, 0x93, 0x52, 0x5A, 0x84, 0x99, 0xC6, 0xFB, 0x26, 0xCA, 0x17,
-    0xB0, 0xAC, 0xF4, 0x66, 0xB2, 0x1F, 0x1E, 0x4A, 0x05, 0x5D, 0x0B, 0xF7, 0x76, 0x35, 0x8C, 0xA7,
-    0xDA, 0xEB, 0x12, 0x31, 0x17, 0x97, 0x85, 0x8E, 0xEA, 0x61, 0x1B, 0xF7, 0x2A, 0x64, 0x9B, 0x65,
-    0xE3, 0xAF, 0xAC, 0x54, 0x9A, 0x4C, 0xD5, 0xAD, 0xD5, 0x9A, 0xF3, 0xCB, 0x04, 0xEC, 0x80, 0x6D,
-    0x06, 0x57, 0xAA, 0xDC, 0x0D, 0xF2, 0x28, 0x84, 0x31, 0x74, 0xD3, 0x01, 0xC6, 0xC8, 0x53, 0xB1,
-    0x3E, 0x64, 0x79, 0x64, 0xB4, 0x3E, 0x46, 0x4E, 0x77, 0x7C, 0x26, 0xBB, 0xB7, 0x96, 0x65, 0x8E,
-    0x92, 0x99, 0x3A, 0xE0, 0xE2, 0xDE, 0x0F, 0x38, 0x91, 0xA5, 0x1A, 0xCE, 0x0B, 0xF3, 0xB1, 0x48,
-    0x18, 0xC8, 0x1D, 0x91, 0x26, 0x51, 0x35, 0x6A, 0xC2, 0xEB, 0x42, 0xAF, 0x37, 0xE5, 0x77, 0x40,
-    0x8E, 0x7D, 0x0D, 0x8F, 0x06, 0xB2, 0xED, 0x70, 0xF3, 0x62, 0x01, 0xB8, 0x2D, 0x2C, 0x72, 0x78,
-    0x75, 0xC7, 0xEF, 0x3D, 0xEB, 0x83, 0x8F, 0xB8, 0x51, 0x98, 0xC0, 0x0B, 0xE3, 0xEB, 0x03, 0xF9,
-    0xE4, 0x29, 0xC4, 0x82, 0x88, 0xAB, 0xE1, 0x3C, 0xB1, 0x37, 0x64, 0x4B, 0xC9, 0x08, 0x7D, 0x91,
-    0x35, 0x76, 0xFB, 0xB9, 0x76, 0xFB, 0x95, 0xBA, 0x09, 0x26, 0x42, 0x03, 0x3F, 0x27, 0xD8, 0x4E,
-    0x69, 0xF8, 0x3B, 0x0D, 0xBD, 0x73, 0xB8, 0x25, 0x50, 0xDE, 0xE5, 0x42, 0xBD, 0xDA, 0xB0, 0xB9,
-    0x18, 0xE2, 0xD0, 0xAD, 0x1D, 0xAB, 0x83, 0x12, 0x72, 0x8D, 0x42, 0x2D, 0x56, 0x69, 0x42, 0xFB,
-    0x4D, 0x84, 0x3F, 0xDD, 0x68, 0x88, 0x7F, 0x94, 0xC2, 0x02, 0x2E, 0x63, 0x40, 0xAD, 0x05, 0x6E,
-    0x31, 0x30, 0x19, 0x7C, 0x2F, 0x86, 0xA1, 0x36, 0x05, 0x7A, 0x80, 0xCC, 0x32, 0x14, 0x38, 0x33,
-    0x15, 0x55, 0x90, 0x0A, 0x72, 0xE4, 0x32, 0xD0, 0x72, 0x0A, 0xCC, 0x19, 0x56, 0x83, 0x0A, 0xC7,
-    0x02, 0xCB, 0x6C, 0x22, 0x44, 0x82, 0xB2, 0x00, 0x52, 0xB1, 0x1C, 0xBD, 0x2D, 0x0B, 0x59, 0x3B,
-    0x77, 0x45, 0xDA, 0xCC, 0xCC, 0x4C, 0xB6, 0x59, 0x0C, 0x57, 0x4A, 0xF0, 0xE7, 0x59, 0xF0, 0x5C,
-    0x1E, 0xBC, 0x5C, 0x8C, 0xFE, 0xA6, 0xF2, 0x5E, 0x13, 0x96, 0x78, 0x6C, 0x54, 0xC9, 0xE1, 0xE0,
-    0x71, 0xD9, 0xC0, 0xF1, 0xA8, 0x6C, 0x84, 0x2D, 0xB3, 0x1F, 0xB6, 0x5E, 0xE1, 0x15, 0xE1, 0xC4,
-    0xAD, 0x1C, 0x31, 0xCA, 0xA8, 0x95, 0x3B, 0x42, 0x8D, 0x38, 0xC3, 0x61, 0x51, 0xB9, 0x05, 0x86,
-    0xE6, 0x56, 0xEE, 0xE0, 0x9D, 0xC5, 0xE4, 0x1D, 0x44, 0xB7, 0xE8, 0xBA, 0xA4, 0xE8, 0x5D, 0x1D,
-    0x5C, 0x82, 0xA2, 0xEE, 0xB2, 0x10, 0xB8, 0x7D, 0xAE, 0x90, 0x86, 0xA7, 0x4F, 0x09, 0xCC, 0xE1,
-    0xD1, 0xCC, 0x37, 0xA7, 0xB7, 0x8A, 0x17, 0x09, 0xBB, 0x4B, 0x48, 0x7D, 0xE3, 0x1D, 0x5F, 0xAE,
-    0x44, 0x60, 0x2C, 0xE4, 0x2B, 0x78, 0xA9, 0xE5, 0x76, 0xD5, 0x3D, 0x0C, 0xFB, 0xE7, 0x65, 0x21,
-    0xE3, 0x3B, 0x42, 0xC5, 0x46, 0x70, 0xD1, 0x1C, 0x18, 0x89, 0x72, 0x0D, 0xD8, 0x3B, 0x2C, 0xA2,
-    0xDC, 0x85, 0x51, 0x4C, 0xB1, 0xD6, 0x1B, 0x2E, 0xDE, 0x4B, 0xF2, 0x97, 0xD9, 0x52, 0x34, 0xFD,
-    0xF5, 0xBF, 0x68, 0x4C, 0x27, 0xAB, 0x2A, 0xD4, 0x6B, 0x29, 0xDA, 0x63, 0x95, 0x00, 0x70, 0xF8,
-    0xD1, 0x1B, 0x1E, 0x73, 0xB0, 0xDB, 0x6C, 0x3B, 0x27, 0x86, 0xB0, 0xEE, 0x6B, 0x3D, 0xCF, 0xDE,
-    0xF6, 0x8A, 0xBF, 0x32, 0xEE, 0x3B, 0x32, 0xBF, 0xE0, 0xBB, 0xFF, 0x15, 0xFE, 0xB0, 0x51, 0x2D,
-    0x56, 0x84, 0xB0, 0x0F, 0xAC, 0xC1, 0x18, 0xBE, 0x99, 0x95, 0x21, 0xF7, 0x50, 0x17, 0x46, 0x22,
-    0xF5, 0xE5, 0x16, 0x50, 0x54, 0x01, 0x74, 0x40, 0x9A, 0x39, 0x30, 0x6F, 0xC4, 0x9C, 0x7F, 0xFB,
-    0xF1, 0xB5, 0x89, 0x63, 0x28, 0x3A, 0xC8, 0x9B, 0xF2, 0x9C, 0x0D, 0x1E, 0xCF, 0x06, 0x83, 0xB5,
-    0x77, 0x1E, 0xF2, 0xC1, 0x5B, 0x76, 0x6F, 0x24, 0x86, 0x96, 0x90, 0x2A, 0xFD, 0xF1, 0x0F, 0x21,
-    0x5A, 0x85, 0xD7, 0xA0, 0x5C, 0xAD, 0x84, 0x35, 0xAD, 0xCA, 0x23, 0xDC, 0x6A, 0xAE, 0x97, 0x6E,
-    0xC4, 0xD3, 0x23, 0x44, 0x04, 0x27, 0xC4, 0xD3, 0x95, 0xB0, 0x11, 0xC9, 0x60, 0x66, 0x69, 0xE7,
-    0x89, 0x9C, 0x39, 0xBE, 0x93, 0x5E, 0x96, 0x49, 0xC9, 0x02, 0xCE, 0x68, 0x86, 0x59, 0x82, 0x09,
-    0x54, 0xC1, 0x1C, 0x64, 0x3E, 0xD4, 0x25, 0x09, 0xE7, 0x27, 0xEB, 0xAF, 0xA4, 0x73, 0xB1, 0xF1,
-    0xA7, 0x4A, 0x3F, 0x4B, 0xC6, 0x99, 0x12, 0x91, 0x86, 0x3F, 0x95, 0xA8, 0x50, 0xD2, 0x69, 0xB8,
-    0x63, 0xAC, 0x13, 0xC0, 0x5A, 0x50, 0xD6, 0x05, 0x27, 0x56, 0x20, 0xB5, 0xF6, 0x9C, 0x1E, 0xD6,
-    0x84, 0x20, 0x19, 0x86, 0x55, 0xA3, 0xF6, 0x0F, 0x9D, 0x2E, 0x31, 0xF0, 0x0B, 0x26, 0x36, 0x63,
-    0xF8, 0x17, 0xA6, 0x9C, 0xF7, 0x3A, 0xF8, 0xE7, 0x97, 0x20, 0xD7, 0x05, 0x60, 0x9D, 0x80, 0x7E,
-    0xDD, 0xF5, 0xC6, 0xAE, 0x4D, 0x7A, 0xD2, 0xF9, 0x03, 0xD8, 0xC2, 0x87, 0x7B, 0x9D, 0xB6, 0x2E,
-    0xF3, 0x29, 0xFA, 0x18, 0xEA, 0x53, 0x03, 0x5A, 0x26, 0xE5, 0xC9, 0x99, 0xBA, 0xE6, 0xED, 0x70,
-    0x84, 0x46, 0x4F, 0x77, 0x4C, 0xD7, 0xBE, 0x8C, 0xF7, 0x78, 0x2D, 0xBC, 0x55, 0xC6, 0x41, 0x15,
-    0xC8, 0x64, 0x57, 0x9E, 0xC0, 0x4B, 0xB1, 0x9E, 0xDC, 0x0A, 0xFE, 0x53, 0xF9, 0x6F, 0x6A, 0xC6,
-    0x26, 0x16, 0x44, 0x9A, 0x04, 0xCF, 0xC9, 0x16, 0xF1, 0x7E, 0x5E, 0x63, 0x37, 0x4C, 0xE1, 0xC3,
-    0x0E, 0x44, 0x0A, 0xAE, 0xDC, 0x36, 0x4C, 0x84, 0x03, 0xDE, 0xFA, 0xC9, 0xDA, 0x30, 0xE0, 0x42,
-    0x4D, 0xA7, 0x2B, 0xAE, 0xE3, 0x66, 0x60, 0x48, 0xAD, 0xEE, 0xD6, 0xEC, 0x1C, 0x51, 0x66, 0x80,
-    0xA0, 0x15, 0x9A, 0xC6, 0x42, 0xAD, 0x11, 0x25, 0x5E, 0xC6, 0x3D, 0x63, 0xC2, 0x27, 0x73, 0x1B,
-    0x20, 0x5B, 0x16, 0x16, 0x3E, 0xD0, 0x31, 0x92, 0x22, 0x90, 0xFE, 0x1E, 0x8E, 0xC1, 0x5E, 0xAE,
-    0x69, 0x2E, 0x4F, 0xD5, 0xC1, 0x20, 0xF2, 0x0E, 0xB6, 0xB2, 0xBA, 0x2D, 0x3F, 0xAC, 0x50, 0x0F,
-    0xFA, 0xF3, 0x00, 0xA3, 0x36, 0x42, 0xBD, 0x86, 0x50, 0xCF, 0xA2, 0xEE, 0x6F, 0xBB, 0x6C, 0x59,
-    0x07, 0xB5, 0x08, 0xF5, 0x9D, 0x24, 0x8C, 0x11, 0xE8, 0xFA, 0x27, 0x8C, 0x70, 0x60, 0x97, 0x41,
-    0x4C, 0xC7, 0xDC, 0xE3, 0x0E, 0xB1, 0xF3, 0x54, 0x00, 0xDB, 0x54, 0x30, 0x58, 0x2A, 0xC3, 0x8D,
-    0xDF, 0xBA, 0x5B, 0x86, 0xDD, 0x4F, 0x4B, 0xF7, 0x78, 0x3B, 0xF6, 0xDF, 0xC7, 0xFD, 0x35, 0xF6,
-    0x0F, 0xB6, 0xB1, 0x7B, 0x39, 0x19, 0x98, 0x73, 0xC3, 0x95, 0xE0, 0x33, 0x3F, 0xDF, 0x62, 0xCE,
-    0x92, 0xC1, 0xF7, 0x81, 0x39, 0x23, 0x65, 0x4E, 0x5A, 0xF1, 0xE4, 0x4A, 0x91, 0x99, 0x19, 0xA4,
-    0x38, 0xFD, 0x53, 0x02, 0x05, 0x3B, 0x99, 0x52, 0x5C, 0x53, 0x69, 0xDC, 0x69, 0xC3, 0x54, 0x76,
-    0x4F, 0xA1, 0x9A, 0x23, 0x49, 0xEB, 0x0B, 0xD0, 0x58, 0xE7, 0x14, 0x56, 0xFF, 0x1A, 0x07, 0x71,
-    0x98, 0x70, 0x10, 0x51, 0xC3, 0x41, 0x90, 0xC2, 0xE7, 0xFA, 0xC8, 0x53, 0xFF, 0x4D, 0x99, 0xDA,
-    0x4A, 0xD7, 0x3D, 0x59, 0x8D, 0x5C, 0x98, 0x4C, 0x58, 0xE2, 0xF3, 0xCB, 0xD3, 0xEE, 0x35, 0x87,
-    0x39, 0x0F, 0x19, 0x6D, 0x22, 0xFF, 0x7F, 0x7B, 0x0D, 0x07, 0xC3, 0x11, 0x6E, 0xFD, 0x10, 0x65,
-    0x7E, 0x2D, 0x70, 0x00, 0xF8, 0xC6, 0x2C, 0xD7, 0x8A, 0x22, 0x70, 0x1F, 0x07, 0xAA, 0x17, 0xE6,
-    0x80, 0xB1, 0x1E, 0x70, 0x75, 0x86, 0x8F, 0x4A, 0x2C, 0x4F, 0x98, 0xB4, 0x0F, 0xAB, 0x8D, 0x90,
-    0xC9, 0xD4, 0x45, 0x17, 0x06, 0xF9, 0x54, 0x24, 0xE0, 0x14, 0x9E, 0x76, 0x5E, 0xD8, 0xFA, 0x94,
-    0x04, 0x31, 0x5C, 0x85, 0x79, 0x2B, 0xD3, 0x5F, 0x88, 0xB9, 0x26, 0xCF, 0x89, 0x90, 0xA8, 0x94,
-    0x20, 0x93, 0x82, 0x2E, 0x97, 0x7D, 0x6B, 0xBB, 0xD8, 0xD8, 0x19, 0x01, 0x89, 0xA7, 0x91, 0x31,
-    0xD3, 0x3E, 0x40, 0x78, 0x28, 0x0A, 0x27, 0x5F, 0x24, 0xE9, 0x8D, 0x8A, 0xAA, 0x62, 0x0E, 0xCA,
-    0xB7, 0x74, 0x6A, 0xA4, 0x5E, 0x2D, 0x23, 0x47, 0x36, 0x11, 0x8C, 0x09, 0x0B, 0xF1, 0xF6, 0xE4,
-    0xE7, 0x14, 0xE2, 0xEE, 0x50, 0xB3, 0x42, 0xFA, 0x1B, 0xCB, 0x04, 0x0E, 0x9E, 0x86, 0x53, 0x32,
-    0x8F, 0xA0, 0xBE, 0xB7, 0xA5, 0x29, 0xFC, 0xF2, 0xC5, 0x1F, 0x89, 0xDD, 0x2B, 0xB6, 0x89, 0x0B,
-    0x2A, 0x3C, 0xBC, 0x1D, 0xDA, 0x5E, 0xDE, 0x84, 0x1E, 0x97, 0xA7, 0x08, 0xC0, 0x58, 0x5F, 0xAA,
-    0x19, 0xA8, 0x4A, 0x11, 0xB0, 0xA2, 0x17, 0x6F, 0x4A, 0x3E, 0x80, 0x9D, 0x32, 0x42, 0x64, 0x24,
-    0x4A, 0x60, 0xDF, 0xF8, 0x62, 0x33, 0x35, 0x34, 0x8A, 0xA0, 0xE3, 0x10, 0xD0, 0x80, 0xE1, 0xE0,
-    0x41, 0x49, 0x20, 0x4E, 0x1E, 0xE6, 0xF0, 0xD2, 0x06, 0x72, 0x95, 0x5F, 0x87, 0x82, 0x4D, 0xF0,
-    0x5C, 0x28, 0x15, 0x86, 0xB3, 0x15, 0xB4, 0x1C, 0x8A, 0x0C, 0xC2, 0xBC, 0xDD, 0xEE, 0x48, 0x4C,
-    0x8B, 0x42, 0x96, 0x03, 0x11, 0x06, 0x17, 0x92, 0x99, 0xC9, 0x2B, 0x62, 0xB6, 0x08, 0x0F, 0xDE,
-    0x3A, 0x44, 0xB2, 0x17, 0xC4, 0xA8, 0x9C, 0xCE, 0xEC, 0x2C, 0xDC, 0xDA, 0x69, 0x19, 0x58, 0x95,
-    0xF3, 0x80, 0x5A, 0x02, 0x98, 0x5B, 0x4B, 0x0D, 0x76, 0x5E, 0xB5, 0x5B, 0x2D, 0xD3, 0xC4, 0x83,
-    0x2F, 0xEE, 0xA4, 0x1E, 0x08, 0xCB, 0x39, 0xA0, 0xF6, 0x9D, 0x65, 0x22, 0xFA, 0xDD, 0x2F, 0x1D,
-    0x11, 0x23, 0xC0, 0xD5, 0xCB, 0x20, 0x3F, 0xAC, 0xC4, 0x36, 0xC7, 0x41, 0xFF, 0xA6, 0x52, 0x6C,
-    0x62, 0xFA, 0x28, 0xA7, 0xC8, 0x9F, 0x3D, 0x1A, 0x09, 0x3E, 0x6C, 0xE0, 0xFD, 0x21, 0x12, 0xD4,
-    0xA8, 0x83, 0x30, 0x6B, 0x76, 0x23, 0x44, 0x74, 0xEB, 0x96, 0x4E, 0x77, 0xA9, 0x06, 0xFE, 0xC6,
-    0x43, 0x00, 0xAF, 0x84, 0x10, 0x15, 0x00, 0x38, 0x3C, 0x00, 0xB0, 0x91, 0x16, 0xAA, 0xE2, 0x18,
-    0x44, 0xB7, 0xC9, 0x2D, 0x84, 0xE0, 0x6A, 0x8C, 0x1C, 0x2B, 0x8D, 0xA8, 0xE8, 0xFA, 0xBC, 0xB8,
-    0x7F, 0xB1, 0x3A, 0xD0, 0x18, 0x5D, 0x0C, 0xC8, 0x3F, 0xF8, 0xAD, 0xA6, 0xCE, 0xB7, 0x65, 0x0E,
-    0xF2, 0xE7, 0x96, 0x21, 0xC9, 0xC7, 0xA1, 0xFE, 0x64, 0xD5, 0xCA, 0x1E, 0x2A, 0xD8, 0x84, 0x13,
-    0x10, 0xAD, 0xF1, 0xCE, 0x12, 0x86, 0xE0, 0xE7, 0x21, 0xD2, 0x7D, 0x46, 0xA2, 0x9E, 0xB5, 0xD7,
-    0x5F, 0x6C, 0x75, 0x6E, 0x08, 0x45, 0xC9, 0x39, 0xDF, 0x53, 0xD3, 0x08, 0x41, 0x25, 0x9C, 0x8A,
-    0x74, 0x94, 0x6A, 0x43, 0x84, 0xC3, 0x75, 0x42, 0x40, 0x73, 0x7C, 0xA9, 0xD2, 0xF3, 0xFA, 0x74,
-    0x28, 0x19, 0x17, 0x6C, 0x28, 0xC1, 0x0C, 0xAE, 0x28, 0xF2, 0xA0, 0x51, 0x23, 0xAA, 0x4F, 0x82,
-    0xE2, 0x97, 0x58, 0x51, 0xC2, 0x16, 0x32, 0xD5, 0xE3, 0x4D, 0x9A, 0xD9, 0xFD, 0x41, 0xC3, 0xC1,
-    0x53, 0x08, 0xAA, 0x93, 0xE7, 0xDF, 0x0F, 0x34, 0x14, 0x3D, 0x68, 0x70, 0xBB, 0x9B, 0xB2, 0xCA,
-    0x65, 0xFC, 0xFC, 0x4C, 0x26, 0x25, 0xB4, 0xE0, 0x5D, 0x52, 0xCD, 0x4D, 0x43, 0x6A, 0x1A, 0x32,
-    0xD3, 0xE2, 0x82, 0x0A, 0xD8, 0xC6, 0xAC, 0xBC, 0xAA, 0x76, 0x57, 0xB2, 0x2C, 0x99, 0x35, 0x1C,
-    0xCC, 0x9E, 0x0D, 0x8C, 0xF5, 0x88, 0x0A, 0x9B, 0x79, 0xAE, 0x69, 0x51, 0xCC, 0xB2, 0x8A, 0x12,
-    0xC2, 0x0B, 0x19, 0xC4, 0x44, 0xF1, 0x6F, 0x90, 0xF3, 0xAF, 0x64, 0x6D, 0x63, 0xBE, 0xFA, 0xD5,
-    0xD1, 0x9B, 0x65, 0xF8, 0xDD, 0xE4, 0xB1, 0x2B, 0xDB, 0x5B, 0x70, 0x36, 0x18, 0xFE, 0x1A, 0x33,
-    0x83, 0x7D, 0x30, 0x64, 0x57, 0x29, 0xDA, 0x98, 0x6C, 0xDC, 0x04, 0xB2, 0x00, 0x19, 0x87, 0xED,
-    0x57, 0x36, 0x0F, 0x63, 0x08, 0x2B, 0xD4, 0x14, 0x2C, 0xFD, 0xD8, 0x4B, 0xA3, 0xE8, 0x43, 0x25,
-    0x40, 0xA6, 0x87, 0x93, 0xED, 0xC3, 0x13, 0x55, 0xD5, 0x1A, 0xB8, 0xA3, 0x3B, 0x69, 0x38, 0x2C,
-    0x14, 0xFA, 0xBA, 0x30, 0x09, 0xF2, 0xCD, 0x0A, 0xCD, 0x0B, 0x50, 0x6C, 0xA2, 0x19, 0x66, 0x6B,
-    0xBA, 0x50, 0x14, 0xE3, 0x58, 0xDB, 0x40, 0x55, 0xBA, 0x3A, 0xBF, 0x1E, 0xC2, 0xED, 0xDD, 0x8E,
-    0x16, 0xC7, 0x08, 0x46, 0x60, 0x90, 0x8F, 0x6A, 0x0F, 0x24, 0x92, 0xA7, 0x0A, 0xEA, 0x4D, 0x48,
-    0x35, 0x5A, 0x0A, 0xF0, 0x23, 0x93, 0x50, 0xB0, 0xCE, 0x9D, 0xF6, 0xB3, 0x2D, 0xF4, 0x71, 0x9D,
-    0x32, 0xDB, 0xAA, 0x4C, 0x73, 0x3C, 0x58, 0x5D, 0x28, 0xFB, 0x18, 0x2E, 0x44, 0xA7, 0x9F, 0xDB,
-    0x44, 0x39, 0xAB, 0x56, 0xD5, 0xD5, 0xA5, 0xBA, 0xD5, 0x51, 0x56, 0x8B, 0x6C, 0x36, 0xD8, 0x3D,
-    0xDA, 0xA0, 0x30, 0x88, 0x8F, 0x5E, 0xBC, 0x77, 0xBD, 0xE6, 0xE3, 0xA2, 0x9C, 0x19, 0x6B, 0x2D,
-    0xA1, 0x5E, 0xF0, 0x52, 0xC3, 0x5F, 0x64, 0x11, 0x16, 0x26, 0x7A, 0x16, 0x3E, 0x24, 0x9F, 0xF9,
-    0x5F, 0xDD, 0x8A, 0x0E, 0x73, 0xCE, 0x99, 0x9C, 0xF8, 0x41, 0xDB, 0x11, 0xFA, 0x6A, 0xE2, 0x1D,
-    0x1B, 0xFF, 0x86, 0x4C, 0xB7, 0x5D, 0x2F, 0x73, 0x61, 0x28, 0xD9, 0x8E, 0x40, 0x91, 0xF2, 0xD4,
-    0x0F, 0xDE, 0x8E, 0xA3, 0xC1, 0xE0, 0xDC, 0xDE, 0x8E, 0xCC, 0x3B, 0x65, 0xD8, 0x67, 0xDA, 0xBB,
-    0x52, 0xF0, 0xA0, 0xFF, 0xB4, 0xB5, 0xE8, 0x1F, 0xB9, 0xFD, 0xC7, 0x94, 0x33, 0x3E, 0x1C, 0x41,
-    0x04, 0x87, 0x3E, 0xBB, 0x6C, 0x37, 0xE1, 0xEC, 0x63, 0xB2, 0x9F, 0x45, 0x92, 0xFC, 0x10, 0x1B,
-    0x62, 0x8C, 0x45, 0x4C, 0xC9, 0x6D, 0xA7, 0xB3, 0xB1, 0x7A, 0x33, 0x74, 0x6A, 0x68, 0x39, 0xBB,
-    0xB5, 0x6E, 0x0F, 0x22, 0x71, 0x64, 0x92, 0x50, 0xED, 0xB6, 0x1A, 0x38, 0x85, 0xA0, 0x40, 0x92,
-    0x9D, 0xCB, 0xEC, 0x91, 0x09, 0x15, 0xFB, 0x93, 0x20, 0xE2, 0xCF, 0x30, 0xBD, 0xBB, 0x20, 0x65,
-    0xCC, 0xF9, 0x35, 0x7D, 0xE2, 0x95, 0xC6, 0x1F, 0xE2, 0x01, 0xAF, 0x32, 0xDC, 0x84, 0x8F, 0x07,
-    0x81, 0x48, 0x47, 0xF4, 0xEA, 0x2D, 0xB3, 0x8F, 0x91, 0x06, 0xFF, 0x71, 0x1B, 0x6C, 0x4E, 0x7B,
-    0xF8, 0xFF, 0xBD, 0x21, 0x05, 0x72, 0xF4, 0xA6, 0xC6, 0xE0, 0xA7, 0xA9, 0xE6, 0xCA, 0xFC, 0x54,
-    0x53, 0x21, 0x91, 0x03, 0x85, 0x13, 0x5E, 0xE1, 0xAF, 0x6E, 0xAD, 0xBF, 0x22, 0x70, 0x2B, 0x58,
-    0xCC, 0xAB, 0xE4, 0x57, 0x21, 0xA5, 0x68, 0x3D, 0x84, 0xA5, 0x83, 0x7C, 0x21, 0x33, 0x91, 0xF5,
-    0x97, 0x5F, 0x97, 0x15, 0x93, 0x95, 0xC2, 0x34, 0xF1, 0x2A, 0x61, 0x80, 0x77, 0x35, 0xB7, 0x76,
-    0x82, 0x10, 0x8E, 0xCC, 0xE3, 0x19, 0xB0, 0x48, 0xEC, 0x56, 0x50, 0xBB, 0x23, 0x19, 0x22, 0x36,
-    0x4D, 0x24, 0xF6, 0xB8, 0xEC, 0x1A, 0xA7, 0xA9, 0x81, 0x55, 0x4C, 0xF0, 0x36, 0x12, 0x1F, 0xE4,
-    0xF6, 0x05, 0x13, 0x53, 0xFD, 0x16, 0xB7, 0xD6, 0xB1, 0x6C, 0xA5, 0x2A, 0x33, 0xED, 0x44, 0xCC,
-    0x78, 0x8A, 0x36, 0x5A, 0x4A, 0x88, 0x67, 0x4D, 0x69, 0x25, 0xCB, 0x4E, 0x18, 0xCB, 0x52, 0x42,
-    0x5E, 0xCE, 0xB8, 0x19, 0xE5, 0x6B, 0x45, 0xE7, 0x48, 0x24, 0x6B, 0x29, 0xE6, 0xC7, 0x5A, 0x8E,
-    0x4D, 0xCD, 0x7B, 0x02, 0x3D, 0x47, 0x65, 0x1C, 0x23, 0xC7, 0xC6, 0xFB, 0x51, 0x25, 0x84, 0xAC,
-    0xEA, 0x08, 0xE3, 0x99, 0x3A, 0xBF, 0x44, 0x1E, 0x34, 0xE2, 0xEE, 0x46, 0x20, 0xE5, 0x12, 0x7E,
-    0x5A, 0xB5, 0x97, 0xC2, 0x4D, 0x8E, 0xED, 0xF9, 0xE5, 0xC1, 0x3E, 0x12, 0x15, 0x96, 0xC0, 0x2F,
-    0x2B, 0xBB, 0x95, 0x1B, 0xEB, 0x24, 0x5F, 0x7F, 0x1F, 0xBB, 0x19, 0xE6, 0xBF, 0xAC, 0x8D, 0x8B,
-    0xE7, 0xAF, 0x01, 0x7A, 0x03, 0xFB, 0x05, 0xC7, 0x3C, 0xFC, 0xF1, 0xC8, 0x03, 0x8B, 0x8F, 0x44,
-    0x7F, 0x88, 0x9A, 0x4E, 0xD5, 0x39, 0x8E, 0x25, 0xF3, 0x72, 0x72, 0xC5, 0x8C, 0x41, 0xED, 0xE0,
-    0x8D, 0x9F, 0xE0, 0xCE, 0x5D, 0x01, 0xE5, 0x18, 0x32, 0x91, 0xC2, 0x5D, 0xA9, 0xB6, 0xA2, 0xA4,
-    0x82, 0x77, 0xE0, 0xAF, 0xF7, 0xD5, 0x8B, 0x5D, 0x79, 0x4C, 0x73, 0x93, 0xD5, 0x40, 0xF4, 0x10,
-    0x36, 0xB6, 0x41, 0x7E, 0x8B, 0x50, 0x6A, 0x4C, 0x0E, 0xF2, 0xFE, 0x96, 0xD1, 0x22, 0x38, 0xE7,
-    0xA3, 0x22, 0xBD, 0x51, 0xC3, 0x79, 0x0C, 0x46, 0xA6, 0xBF, 0x72, 0xCB, 0xE9, 0xA7, 0x00, 0x13,
-    0xC9, 0xD8, 0xB1, 0x4D, 0x7F, 0x12, 0x5A, 0xAF, 0x8F, 0x90, 0x3A, 0x33, 0x12, 0x83, 0x1E, 0x4F,
-    0xEF, 0xD4, 0xEA, 0xA2, 0xC7, 0x9D, 0x69, 0x1C, 0xA4, 0xC0, 0xC2, 0x0C, 0xF1, 0x0B, 0x04, 0x7E,
-    0x34, 0x37, 0xF8, 0xF6, 0xF2, 0xF6, 0xD1, 0x0B, 0x2A, 0x37, 0x3B, 0x9B, 0x53, 0xCB, 0xB8, 0x4F,
-    0xA5, 0xBB, 0x23, 0xD5, 0x08, 0x8D, 0xE2, 0xF3, 0x56, 0x7F, 0x15, 0xB4, 0x56, 0xA9, 0x1E, 0xB0,
-    0x99, 0xE4, 0xAE, 0xCD, 0x02, 0x0A, 0x2C, 0x88, 0x58, 0xDE, 0xBA, 0x84, 0x2B, 0x5C, 0x9B, 0xB6,
-    0xB0, 0xD7, 0xA9, 0x4C, 0x57, 0xC3, 0xD5, 0x4A, 0x31, 0x97, 0x75, 0x03, 0x41, 0x07, 0xC8, 0x9E,
-    0xFE, 0xF8, 0x6B, 0xEA, 0xCA, 0x37, 0x8D, 0xCB, 0x45, 0xD2, 0x6C, 0x5F, 0xFA, 0x1C, 0x8F, 0x2F,
-    0xDF, 0x3A, 0xD0, 0xE1, 0x25, 0x1E, 0xC7, 0xE8, 0x15, 0x0C, 0x50, 0x23, 0xE4, 0xAC, 0x81, 0x67,
-    0x4D, 0x7F, 0xC1, 0xC4, 0x08, 0x50, 0xFC, 0x66, 0x4F, 0x4C, 0x78, 0x79, 0x36, 0x76, 0xA1, 0x6A,
-    0x13, 0x67, 0x7F, 0x30, 0x96, 0x99, 0x73, 0xE9, 0x71, 0xBC, 0x20, 0x92, 0xF3, 0x1E, 0x23, 0x3B,
-    0x0C, 0x1D, 0x31, 0x2D, 0x9B, 0xF0, 0x9A, 0xF4, 0xCD, 0x04, 0x30, 0x04, 0xF7, 0x96, 0x89, 0x26,
-    0x47, 0x33, 0xD5, 0x7F, 0x54, 0xCF, 0x20, 0x47, 0x81, 0xDB, 0x5B, 0x94, 0x44, 0x2C, 0xBC, 0x62,
-    0xC2, 0xFD, 0x92, 0x89, 0x20, 0x10, 0x89, 0x2E, 0x4F, 0x6C, 0x91, 0xFC, 0xC3, 0x34, 0x12, 0xFF,
-    0x86, 0x18, 0xD8, 0xEE, 0x2F, 0x6B, 0x0D, 0xB0, 0x32, 0xB5, 0x1E, 0x6E, 0xD1, 0x10, 0x5C, 0xF1,
-    0x0B, 0xE4, 0x8A, 0x21, 0xF7, 0xE5, 0x9B, 0xA5, 0xF5, 0x80, 0x3F, 0x5D, 0xC1, 0x6F, 0x8A, 0x61,
-    0xCB, 0x0E, 0x8D, 0xC2, 0xC4, 0xBF, 0xF1, 0x4E, 0xE3, 0x34, 0x63, 0xDC, 0xAB, 0x68, 0xBD, 0x62,
-    0x26, 0xF0, 0xD3, 0xCF, 0x67, 0x51, 0xD2, 0x78, 0xAF, 0x57, 0x10, 0x3F, 0x11, 0x45, 0x06, 0xE8,
-    0xB4, 0xD4, 0xDD, 0xC7, 0x98, 0x21, 0xE6, 0x24, 0x04, 0x5F, 0x40, 0x06, 0x99, 0xE0, 0xD5, 0x8C,
-    0x11, 0xBE, 0x86, 0x01, 0x02, 0x02, 0x13, 0x84, 0xBD, 0x60, 0xF1, 0xF9, 0xF9, 0x68, 0x7D, 0xB4,
-    0xBC, 0xAD, 0xF9, 0x25, 0xDC, 0x09, 0xD0, 0x9A, 0x72, 0xD7, 0x2F, 0xDF, 0xC0, 0x0E, 0x2C, 0x5B,
-    0xC8, 0x33, 0x4C, 0x51, 0x48, 0xFB, 0x4C, 0x1D, 0x5E, 0x94, 0x05, 0x09, 0x9D, 0x46, 0xF6, 0xA8,
-    0x5B, 0x05, 0xCF, 0xD6, 0x9C, 0x67, 0x8C, 0xB4, 0x98, 0xE0, 0x46, 0x85, 0x7C, 0x98, 0x99, 0x90,
-    0xCD, 0xCF, 0xFD, 0x9F, 0xBD, 0xD6, 0x70, 0xB2, 0x13, 0xC8, 0x56, 0x08, 0x6A, 0xA2, 0x1B, 0xF2,
-    0x29, 0xF2, 0x41, 0x1B, 0x99, 0x18, 0x70, 0x42, 0x85, 0x31, 0x04, 0xCF, 0xC8, 0x1E, 0x38, 0x58,
-    0x5D, 0x2A, 0xF8, 0xEC, 0x8C, 0xA9, 0x7F, 0x10, 0x9E, 0x4D, 0x2B, 0x8F, 0x78, 0xF9, 0x35, 0x79,
-    0x70, 0x1B, 0x8A, 0xAD, 0xE6, 0x95, 0x33, 0x79, 0xBA, 0x3C, 0x6B, 0x2C, 0xD8, 0x3D, 0xC8, 0xDA,
-    0x88, 0x5E, 0xE4, 0x76, 0x4E, 0x1F, 0xB2, 0xC3, 0x4B, 0x99, 0x52, 0xD2, 0x30, 0xBA, 0x2F, 0x8B,
-    0x0D, 0xEF, 0x1B, 0x81, 0x90, 0xAB, 0x80, 0x7E, 0x41, 0x06, 0x65, 0x7A, 0x5B, 0xCB, 0x50, 0x94,
-    0xFF, 0x9A, 0xF2, 0x3D, 0x39, 0xF9, 0xB3, 0xDC, 0xD6, 0x21, 0x43, 0x91, 0xDE, 0x7A, 0x0D, 0x49,
-    0xBF, 0x62, 0x18, 0x5D, 0x2C, 0x1B, 0x44, 0x64, 0x2A, 0x58, 0x44, 0x66, 0x45, 0xC7, 0x1B, 0x66,
-    0x3D, 0x65, 0x5A, 0x2A, 0x23, 0xF8, 0x31, 0x81, 0x0C, 0x63, 0x76, 0x2D, 0x85, 0xA8, 0xCA, 0x50,
-    0xFE, 0x1A, 0xF7, 0x4E, 0x70, 0xC6, 0x67, 0xFD, 0xDB, 0x47, 0xC2, 0x45, 0x63, 0xE0, 0x67, 0xA7,
-    0xD6, 0x00, 0x02, 0xF8, 0xEF, 0x02, 0xA3, 0xD0, 0x30, 0x92, 0x7C, 0xC0, 0xE7, 0x91, 0x3C, 0x5E,
-    0x56, 0x0E, 0xB2, 0x16, 0xD9, 0x82, 0x10, 0xC7, 0xA2, 0xD3, 0xA7, 0x8E, 0xD8, 0xE3, 0x70, 0x49,
-    0xCD, 0xB1, 0x29, 0xBC, 0x02, 0x99, 0x46, 0x53, 0x5F, 0xB8, 0x0B, 0x39, 0x57, 0x5C, 0x3D, 0x3C,
-    0x8F, 0x09, 0xF0, 0xA3, 0x4A, 0xF7, 0x07, 0x37, 0xB8, 0x0F, 0x51, 0x24, 0x7B, 0x23, 0x35, 0x44,
-    0xA2, 0x9E, 0xC5, 0x9B, 0x29, 0x79, 0x05, 0x58, 0x47, 0x98, 0x01, 0x12, 0x0E, 0xC2, 0xC2, 0xBD,
-    0x0B, 0x08, 0x78, 0xFB, 0xE8, 0x7A, 0xC7, 0x24, 0x57, 0x7A, 0xF1, 0xB1, 0x2A, 0xCB, 0xB7, 0x2B,
-    0xEA, 0xD8, 0xB9, 0x10, 0x74, 0x0E, 0x8B, 0x0F, 0xFB, 0x5E, 0x63, 0x00, 0xD8, 0x77, 0x31, 0xD7,
-    0x1A, 0x41, 0xB7, 0x0A, 0xDE, 0x35, 0xBF, 0x40, 0x98, 0x54, 0xE9, 0x12, 0x33, 0xC8, 0x39, 0x43,
-    0x78, 0x06, 0xD9, 0x03, 0x5E, 0x99, 0x8A, 0x6C, 0x16, 0xA0, 0xF3, 0x04, 0xD4, 0x8D, 0x88, 0xB7,
-    0x09, 0x6E, 0x2F, 0xB8, 0x91, 0x44, 0x92, 0xFB, 0x31, 0xD3, 0x09, 0x14, 0xCA, 0x0D, 0x72, 0x81,
-    0xE8, 0x6C, 0xA5, 0xEE, 0x11, 0x80, 0x27, 0xA4, 0x5A, 0x1F, 0x3C, 0xAD, 0x39, 0x8B, 0xCC, 0x63,
-    0xE9, 0xBA, 0xB7, 0xDF, 0xAA, 0xC0, 0x2A, 0xA2, 0xED, 0xB0, 0xF5, 0x1A, 0x58, 0xFE, 0x2D, 0x48,
-    0x13, 0x23, 0x3F, 0x70, 0x86, 0x0C, 0xBC, 0x99, 0x5B, 0xC9, 0x3A, 0x83, 0x60, 0x11, 0xF6, 0x63,
-    0x98, 0xB5, 0x08, 0x51, 0x63, 0x83, 0x3F, 0x00, 0x6B, 0x38, 0x84, 0x4A, 0xF0, 0x6F, 0x08, 0xD0,
-    0x18, 0x41, 0x97, 0x31, 0xB5, 0xE2, 0x50, 0x38, 0xC9, 0x53, 0x5F, 0xD9, 0x25, 0x19, 0x40, 0xE2,
-    0xAC, 0x06, 0x78, 0xB0, 0xF9, 0x68, 0x87, 0xAC, 0x9C, 0x12, 0x89, 0x91, 0x89, 0x81, 0x27, 0x52,
-    0xD6, 0x8F, 0xB8, 0x31, 0xA5, 0xB4, 0xDD, 0x84, 0x4A, 0xAB, 0x9D, 0x38, 0x28, 0x0B, 0x6C, 0x44,
-    0x29, 0x98, 0x47, 0xE5, 0xB2, 0xC3, 0x8E, 0xC1, 0xAD, 0xAB, 0x26, 0x42, 0x21, 0x86, 0x16, 0xE5,
-    0x90, 0x2B, 0x93, 0x83, 0x04, 0xFC, 0xCC, 0xAA, 0x06, 0x79, 0xCE, 0xC1, 0xC1, 0xD7, 0xAC, 0xC0,
-    0xAC, 0xE5, 0x26, 0xA1, 0xC8, 0x2D, 0xF7, 0x6E, 0xC1, 0xFC, 0x0F, 0x67, 0xB9, 0x02, 0x45, 0x44,
-    0xA9, 0x3E, 0xDD, 0xE7, 0xED, 0xF8, 0x36, 0x10, 0x2E, 0x03, 0x74, 0x5F, 0x6C, 0x34, 0x93, 0x9C,
-    0x88, 0x96, 0x7C, 0xDF, 0x6E, 0x85, 0xCB, 0xF1, 0x87, 0xC3, 0x4A, 0x46, 0x52, 0x32, 0xA9, 0x13,
-    0xEB, 0x3E, 0xB1, 0x8E, 0x16, 0x66, 0xBC, 0x76, 0x9A, 0x22, 0x9B, 0xF7, 0x8E, 0x9A, 0x19, 0xF1,
-    0x65, 0x4C, 0x28, 0x0B, 0xCE, 0x8C, 0x12, 0xAF, 0x74, 0x64, 0x71, 0x65, 0x8F, 0x4F, 0xC9, 0xF0,
-    0x9B, 0xC3, 0x61, 0x7F, 0xB8, 0xE1, 0xE1, 0xB9, 0xDD, 0x0F, 0x2B, 0xA6, 0x86, 0xC4, 0x09, 0x98,
-    0xD3, 0x17, 0x11, 0x23, 0x64, 0xEA, 0x9E, 0xA8, 0xC5, 0x42, 0x0C, 0x99, 0x54, 0xE8, 0x70, 0x23,
-    0x9B, 0xBD, 0xE5, 0xDF, 0x6F, 0x22, 0xFF, 0xD6, 0x41, 0xB4, 0x9D, 0x43, 0xC3, 0xB4, 0xD3, 0x21,
-    0xAA, 0xF0, 0xF0, 0xC6, 0x71, 0x34, 0x3F, 0x2B, 0x3D, 0x5D, 0xB3, 0x48, 0x10, 0x15, 0xAA, 0x95,
-    0x6B, 0x63, 0x80, 0x32, 0xB8, 0xB4, 0x04, 0xF1, 0xC0, 0xF9, 0x83, 0x9D, 0x35, 0xA7, 0xA0, 0x63,
-    0x6C, 0x1E, 0xBE, 0x8C, 0x06, 0xA2, 0x5C, 0x44, 0x1E, 0x52, 0x19, 0x10, 0x46, 0xA6, 0x94, 0x43,
-    0xA8, 0x74, 0x0A, 0x8C, 0x29, 0x2C, 0x9C, 0x89, 0x3D, 0x81, 0xD0, 0xDD, 0x93, 0x3F, 0x83, 0xB5,
-    0x84, 0x85, 0xD7, 0xD5, 0xEF, 0x2B, 0x6C, 0x86, 0x81, 0x8F, 0xAD, 0xB5, 0xD8, 0x17, 0x71, 0xA8,
-    0x27, 0x74, 0xCB, 0x7F, 0xC0, 0x9C, 0x5A, 0x9A, 0x59, 0xCB, 0xBF, 0x17, 0x58, 0xB6, 0x44, 0x60,
-    0x39, 0x4D, 0x34, 0x87, 0x6E, 0x54, 0x43, 0x62, 0x2D, 0xE8, 0x44, 0x7C, 0x05, 0x5A, 0xF0, 0x5D,
-    0x66, 0x6D, 0xAD, 0x0F, 0x0E, 0x0E, 0x96, 0x48, 0x9B, 0xEB, 0xDE, 0xC0, 0xC7, 0x7B, 0x70, 0x82,
-    0xDC, 0xC3, 0x2D, 0x57, 0x10, 0x73, 0x29, 0xAE, 0x89, 0x5E, 0x86, 0x80, 0x01, 0xEE, 0x0F, 0x10,
-    0x6B, 0xF5, 0x2B, 0x51, 0x3C, 0x40, 0x49, 0xB7, 0x0E, 0x1B, 0x70, 0x1C, 0x4C, 0x42, 0xFA, 0x65,
-    0x86, 0xA2, 0x2E, 0x47, 0xE3, 0x19, 0x89, 0xB7, 0xBA, 0x0C, 0xE7, 0xEC, 0xC2, 0x55, 0x57, 0xC7,
-    0x08, 0x18, 0x72, 0x1E, 0x3F, 0x7F, 0x90, 0x62, 0x93, 0xBE, 0x2C, 0x5F, 0xEF, 0x00, 0x04, 0x4E,
-    0x4F, 0xC5, 0x33, 0xCA, 0xC3, 0xDC, 0x19, 0xE2, 0x19, 0x0F, 0x70, 0xB2, 0xEE, 0x0A, 0x8F, 0x5F,
-    0x23, 0xA9, 0xEF, 0xC7, 0xCC, 0xE0, 0x9C, 0x68, 0xD4, 0xDA, 0x81, 0xC0, 0x10, 0x44, 0x34, 0xD6,
-    0x04, 0x6A, 0xFA, 0x1B, 0x89, 0x7C, 0x80, 0x78, 0x08, 0x66, 0x34, 0x9D, 0x08, 0x9E, 0xE1, 0xC7,
-    0x6B, 0x4D, 0xF0, 0x31, 0xC1, 0xB7, 0xE0, 0x51, 0x45, 0x11, 0x41, 0xC0, 0x9A, 0x82, 0xB7, 0xFB,
-    0xAC, 0x2F, 0xBF, 0xED, 0x91, 0x3C, 0xF7, 0x97, 0x3C, 0x23, 0xBA, 0x2C, 0x02, 0xEF, 0x75, 0x18,
-    0x35, 0x2D, 0xDD, 0x92, 0x58, 0x54, 0xAF, 0x80, 0x97, 0x1B, 0xE2, 0x13, 0x3E, 0x3E, 0xC3, 0x48,
-    0x65, 0x83, 0x54, 0x21, 0x61, 0x91, 0xE0, 0x95, 0x5C, 0x28, 0x2B, 0x44, 0x44, 0xA2, 0x68, 0xA4,
-    0x68, 0x56, 0x85, 0xC1, 0x23, 0x17, 0xAF, 0xC9, 0x53, 0x7E, 0x84, 0x3F, 0x15, 0x8C, 0xFA, 0x62,
-    0x35, 0x6B, 0x38, 0x99, 0xBE, 0xE1, 0x6F, 0x27, 0x09, 0x7F, 0x52, 0x93, 0xFD, 0x93, 0xBD, 0x8C,
-    0xC3, 0x73, 0xE9, 0x1B, 0x07, 0x10, 0x28, 0xAE, 0xEC, 0x8E, 0xED, 0x23, 0x25, 0xC7, 0xF6, 0xBF,
-    0x74, 0x6D, 0x1F, 0xE2, 0x0D, 0x45, 0x5D, 0xD1, 0xBD, 0xC3, 0xD6, 0x26, 0x1C, 0x64, 0x9A, 0xB5,
-    0x67, 0x20, 0x3D, 0x53, 0xD3, 0x67, 0xAC, 0x51, 0xC0, 0x51, 0xEA, 0x44, 0xCF, 0x34, 0x5A, 0x03,
-    0x25, 0xAC, 0x83, 0xE1, 0x33, 0xA9, 0x34, 0xB7, 0xB6, 0x2B, 0x7F, 0x52, 0x07, 0x2D, 0x80, 0x4A,
-    0x98, 0xA7, 0x34, 0xC6, 0xE6, 0xF4, 0xFE, 0xE3, 0x27, 0xD8, 0x05, 0x54, 0xE8, 0xA2, 0x95, 0x15,
-    0xCE, 0xC6, 0xC9, 0x58, 0xA6, 0x42, 0xEE, 0x27, 0x53, 0x2E, 0x18, 0x4F, 0x11, 0x45, 0xC0, 0xA7,
-    0xAF, 0x4C, 0xA4, 0x3E, 0x94, 0x91, 0x50, 0x40, 0xAC, 0x03, 0x6E, 0x08, 0x13, 0xC6, 0xF4, 0x4D,
-    0xC5, 0x62, 0x16, 0xC3, 0x21, 0xB2, 0xFE, 0x8A, 0x70, 0x2E, 0xC2, 0x31, 0x2E, 0x63, 0x1B, 0x01,
-    0x5D, 0xCE, 0xCC, 0x9D, 0xAE, 0x7A, 0xCC, 0xBA, 0x09, 0x69, 0xA9, 0x04, 0xDA, 0xCA, 0x56, 0xB2,
-    0x89, 0x9B, 0x3A, 0xE9, 0xB6, 0xC7, 0xE7, 0x97, 0x7A, 0x7F, 0xD1, 0xA8, 0x2B, 0x36, 0xC1, 0xF5,
-    0xDD, 0x2A, 0xA3, 0x35, 0xA4, 0x83, 0x87, 0x02, 0x0F, 0x18, 0x2E, 0xB1, 0x80, 0xE0, 0x8E, 0x65,
-    0x24, 0xD8, 0x84, 0x06, 0x9B, 0x30, 0x52, 0x47, 0xFD, 0xC2, 0x46, 0x8B, 0x61, 0x1B, 0x31, 0x3A,
-    0xC5, 0xF4, 0x96, 0x98, 0xC9, 0xAA, 0x30, 0x8E, 0x61, 0x88, 0xB2, 0x40, 0x4E, 0xAC, 0x25, 0x8C,
-    0x4F, 0x44, 0xEC, 0xB3, 0xB5, 0x26, 0x4F, 0x8F, 0x09, 0xFA, 0x20, 0x82, 0xE9, 0x72, 0x8A, 0x32,
-    0xF7, 0x5D, 0xD4, 0xC0, 0xCA, 0x38, 0x7D, 0xE1, 0xAC, 0xF0, 0xE6, 0xA1, 0x6C, 0xDB, 0x86, 0xDE,
-    0x0F, 0x55, 0x4D, 0xDC, 0xC3, 0x2B, 0x9B, 0xE1, 0xD1, 0x57, 0x88, 0xA8, 0x61, 0xBC, 0x11, 0xC5,
-    0x56, 0xC7, 0x6D, 0xCD, 0xDC, 0xBD, 0x5C, 0xF5, 0x22, 0xAD, 0x67, 0x92, 0x3E, 0x54, 0xF5, 0x43,
-    0x92, 0xAA, 0xA0, 0x7E, 0xD5, 0x50, 0x33, 0xF5, 0x9B, 0x68, 0xBF, 0x26, 0x7E, 0xB2, 0x02, 0x97,
-    0xC4, 0x19, 0x5D, 0x7C, 0x4C, 0x39, 0xC6, 0x5E, 0x33, 0x0B, 0xA6, 0x9A, 0xBE, 0x09, 0x0A, 0x2E,
-    0xA8, 0xD6, 0x7E, 0x81, 0xBB, 0x2F, 0x98, 0x41, 0xF1, 0xB3, 0xB2, 0x17, 0x76, 0x01, 0xC4, 0xA2,
-    0xDB, 0xD2, 0x9D, 0xFA, 0xA5, 0xAA, 0x4F, 0x5F, 0x5E, 0xC1, 0x12, 0x89, 0xF3, 0xA0, 0x6C, 0x43,
-    0x66, 0x16, 0xB5, 0x5A, 0x30, 0x2B, 0x4B, 0x0B, 0xAE, 0x25, 0xEC, 0xDF, 0x4C, 0x47, 0xFE, 0xFD,
-    0x9E, 0xD5, 0xC9, 0xE9, 0x31, 0xFD, 0x4F, 0x3C, 0x79, 0xFD, 0x08, 0x0C, 0x66, 0xA4, 0x93, 0x98,
-    0x29, 0x4A, 0x9F, 0x5F, 0xC5, 0xAE, 0x10, 0xC0, 0x74, 0x8C, 0x94, 0xF4, 0xA9, 0x6E, 0x2B, 0x04,
-    0x78, 0x69, 0xBB, 0xD5, 0xF1, 0xC5, 0x27, 0x1A, 0xEF, 0x3D, 0xA6, 0x06, 0x37, 0x62, 0xE8, 0xD4,
-    0x9A, 0x2C, 0xE5, 0xDA, 0xF9, 0xEF, 0x5B, 0x3F, 0x64, 0x61, 0xCB, 0x37, 0xBF, 0x4D, 0x55, 0xEE,
-    0x93, 0x15, 0xBE, 0xF6, 0x8D, 0x47, 0xCC, 0x50, 0x0A, 0xB6, 0xB9, 0xE4, 0x07, 0x3B, 0xDF, 0xBE,
-    0xBA, 0xC5, 0x31, 0x7B, 0x70, 0x8C, 0x66, 0x22, 0xC5, 0x5B, 0xF9, 0x5F, 0xC4, 0xC2, 0xC2, 0xB9,
-    0xB7, 0xCC, 0xFD, 0xDA, 0x31, 0xBF, 0xE3, 0xD5, 0x6A, 0xAE, 0x2D, 0x34, 0x3D, 0x34, 0xFC, 0x91,
-    0x16, 0x95, 0x54, 0x2B, 0x5D, 0x36, 0xDD, 0x88, 0x4C, 0xE0, 0x96, 0x83, 0xAF, 0x72, 0x30, 0xDE,
-    0x9B, 0xBC, 0xC2, 0x3D, 0xD6, 0x45, 0x45, 0x8A, 0xF7, 0x58, 0xCF, 0x01, 0x0B, 0xBD, 0xC2, 0x5A,
-    0x58, 0xFF, 0xE7, 0x8D, 0x96, 0xBB, 0x2D, 0x98, 0xDD, 0xD7, 0x88, 0x95, 0x95, 0x6A, 0x4A, 0xB4,
-    0x9C, 0xB6, 0x36, 0x8C, 0xB9, 0xCA, 0xC7, 0x9D, 0xC3, 0xEE, 0x3B, 0xB4, 0x5C, 0xDE, 0xE8, 0x58,
-    0x2A, 0x92, 0x31, 0x45, 0xE5, 0x7C, 0x3F, 0xFB, 0x07, 0x94, 0x23, 0x14, 0x75, 0xC3, 0xD1, 0x6B,
-    0x22, 0x07, 0x46, 0xFB, 0x83, 0x3E, 0x84, 0x6C, 0xCF, 0x66, 0xEA, 0xD8, 0x0C, 0xCC, 0xA6, 0x8A,
-    0xF0, 0x37, 0x4F, 0x08, 0x1E, 0x78, 0xA4, 0x97, 0x00, 0x0C, 0x45, 0x8A, 0x87, 0x5E, 0xFB, 0xCC,
-    0x21, 0x8D, 0x6E, 0x65, 0x1D, 0x6E, 0x7E, 0x2B, 0xB2, 0x0D, 0xA2, 0x9A, 0xC6, 0x16, 0x8B, 0x99,
-    0x18, 0x1E, 0x32, 0x13, 0xBE, 0x0C, 0x0C, 0xEB, 0x8B, 0x85, 0x1D, 0xC9, 0xA2, 0x01, 0xC5, 0x20,
-    0xB6, 0x09, 0x6B, 0x7B, 0x54, 0xCB, 0xE1, 0xA5, 0x59, 0x7E, 0xA5, 0x7B, 0xBE, 0xD3, 0x5A, 0xD2,
-    0xC4, 0x2C, 0x1B, 0xE0, 0x26, 0xB1, 0x1A, 0x39, 0x83, 0x07, 0x8F, 0x8E, 0xBE, 0x67, 0x8C, 0x4D,
-    0xE5, 0x92, 0x61, 0xB8, 0x39, 0xFD, 0x71, 0xFB, 0x0F, 0x38, 0x27, 0x47, 0xF8, 0x4F, 0xDA, 0x67,
-    0x63, 0x9C, 0xA3, 0xA3, 0xA3, 0x8C, 0xD6, 0x10, 0x88, 0x58, 0xFC, 0x21, 0x16, 0xE3, 0x37, 0x1C,
-    0xB3, 0x5B, 0x14, 0xF3, 0x09, 0xB9, 0x76, 0xFA, 0xD0, 0x40, 0xA1, 0x4E, 0x85, 0x70, 0xFD, 0x62,
-    0x8D, 0xE0, 0xC4, 0x43, 0x74, 0x1A, 0x6C, 0x8A, 0xDF, 0x29, 0x99, 0x38, 0xA9, 0x68, 0xA8, 0x50,
-    0xE2, 0x47, 0x3A, 0x88, 0xAB, 0x13, 0x1F, 0xE9, 0x70, 0x4A, 0x9C, 0xF7, 0x25, 0x9A, 0xA2, 0x12,
-    0x28, 0x32, 0x70, 0x78, 0xB5, 0x53, 0x8F, 0xBB, 0x49, 0x7A, 0x74, 0xEB, 0x5D, 0x88, 0x5F, 0x0E,
-    0xA8, 0x0E, 0x89, 0x97, 0x26, 0xBE, 0xF5, 0x35, 0x8C, 0x2A, 0x52, 0x6F, 0x3B, 0x0B, 0x24, 0xCC,
-    0x90, 0x40, 0x06, 0x25, 0x32, 0xDD, 0x84, 0x9C, 0xE8, 0xB6, 0xB8, 0xF9, 0xC7, 0x9C, 0x1D, 0x24,
-    0x28, 0x33, 0x10, 0x4B, 0x3D, 0x6D, 0xBE, 0x49, 0x39, 0x9B, 0xF6, 0x88, 0xD6, 0xFC, 0x96, 0x3E,
-    0xF5, 0x01, 0x6C, 0x1A, 0x24, 0xB5, 0x86, 0xFF, 0x00, 0x03, 0x6E, 0x6D, 0xE5, 0xAE, 0x03, 0x69,
-    0x13, 0x8B, 0x29, 0xEB, 0x15, 0xAB, 0xDF, 0x30, 0x8D, 0x73, 0xA3, 0x46, 0xC1, 0x35, 0x9C, 0x9F,
-    0x51, 0x6B, 0x73, 0xC7, 0xA9, 0x95, 0xE6, 0x4B, 0x54, 0x22, 0xCF, 0xC4, 0x40, 0x74, 0x12, 0x75,
-    0xFD, 0x6E, 0x98, 0x61, 0x94, 0x9D, 0x3F, 0x40, 0x96, 0xEE, 0x8D, 0x3B, 0x07, 0xFB, 0x5F, 0xE0,
-    0x5F, 0x1E, 0x12, 0x8B, 0xA3, 0x7A, 0x44, 0xFE, 0xD2, 0x65, 0x8F, 0xFD, 0xBE, 0x71, 0xB3, 0x2F,
-    0xAC, 0x9B, 0xBF, 0xFA, 0xE2, 0xDE, 0x17, 0xC2, 0x97, 0xEA, 0xC7, 0xAE, 0x3C, 0xCC, 0xAD, 0xBE,
-    0x44, 0x06, 0xE8, 0xFA, 0x89, 0x22, 0x6C, 0x7F, 0xCF, 0xEC, 0x65, 0xBB, 0x3B, 0xB7, 0x19, 0xDA,
-    0x46, 0xF4, 0x8B, 0xF9, 0x87, 0x9E, 0x3D, 0x65, 0x44, 0x21, 0xBC, 0xF5, 0x4F, 0x33, 0xF3, 0x0E,
-    0x0C, 0x83, 0x11, 0x9A, 0x1E, 0x70, 0x0F, 0x08, 0xDA, 0x7F, 0xAB, 0x34, 0xFF, 0xD2, 0x80, 0xCE,
-    0xA5, 0x2F, 0x0A, 0xEA, 0x01, 0x8A, 0x96, 0x87, 0xCC, 0xAF, 0xF8, 0xEF, 0x51, 0x25, 0xA1, 0xB3,
-    0xEE, 0x35, 0xF3, 0xB2, 0xFD, 0x81, 0xCA, 0x9B, 0xE0, 0xE2, 0xFF, 0xA5, 0x37, 0x56, 0x58, 0xDF,
-    0x37, 0xFF, 0xE8, 0x7F, 0xF4, 0x2F, 0xBB, 0x40, 0x14, 0x14, 0x16, 0x22, 0x47, 0x9C, 0xE2, 0x73,
-    0x94, 0x6C, 0x95, 0xAC, 0x1B, 0xB2, 0xC3, 0xAE, 0xBA, 0xBB, 0x57, 0xEC, 0xDD, 0x1C, 0x90, 0x78,
-    0x4F, 0x9C, 0x0B, 0x97, 0x7A, 0xE2, 0x24, 0x8F, 0x9D, 0x7A, 0xC2, 0x26, 0x23, 0x66, 0x38, 0xE6,
-    0x0D, 0xE4, 0x6E, 0xB6, 0x8B, 0x98, 0xE5, 0xDF, 0xEF, 0x68, 0x67, 0x0D, 0xBA, 0xF4, 0x2D, 0x62,
-    0xB9, 0x82, 0xC0, 0xA9, 0x33, 0xB3, 0x8C, 0x8B, 0x08, 0x9D, 0x9E, 0xDC, 0xF5, 0xA5, 0x90, 0x94,
-    0xA7, 0xBC, 0xE5, 0xEF, 0x98, 0xFE, 0xE3, 0xC3, 0xFE, 0xF3, 0x5E, 0xD0, 0xEF, 0xFF, 0xD3, 0xEE,
-    0x1C, 0xD9, 0x4B, 0x66, 0xA9, 0x7B, 0x43, 0xFE, 0xF0, 0x1F, 0xF4, 0xE0, 0x23, 0xC5, 0x3F, 0x8E,
-    0xB6, 0x99, 0x8D, 0x85, 0x99, 0x0B, 0x7D, 0xDA, 0x8C, 0x76, 0x0B, 0x29, 0xED, 0x7C, 0xA3, 0x12,
-    0x8C, 0x67, 0x77, 0x4F, 0xAB, 0x2D, 0x3B, 0x68, 0x0B, 0x7E, 0x6E, 0x08, 0x97, 0x65, 0x3B, 0x29,
-    0xE5, 0x83, 0xD2, 0xDD, 0xA2, 0x65, 0x4F, 0xDE, 0x2B, 0x36, 0x84, 0x36, 0xC1, 0x53, 0x20, 0x5C,
-    0x7C, 0xC6, 0xD9, 0x6D, 0xA2, 0x6F, 0xB2, 0x55, 0x24, 0x48, 0xE3, 0x16, 0xF2, 0x4A, 0x88, 0xBF,
-    0x84, 0xDF, 0xD3, 0xEB, 0x00, 0x32, 0x52, 0xE6, 0xD0, 0xDF, 0x45, 0x22, 0x79, 0x1C, 0xC9, 0xCD,
-    0x10, 0xE6, 0x9F, 0x18, 0xA6, 0xDD, 0x68, 0xF1, 0x62, 0x90, 0x23, 0xD5, 0x7B, 0x2E, 0xBF, 0x36,
-    0xA8, 0xFC, 0x50, 0xE7, 0x4E, 0xC4, 0xB0, 0x5A, 0x8B, 0x9A, 0xC1, 0xD1, 0xCF, 0xA1, 0xAD, 0xC2,
-    0xCB, 0x70, 0x24, 0xCF, 0x11, 0x31, 0x42, 0xC5, 0x47, 0x98, 0x20, 0x72, 0x39, 0xC3, 0x36, 0x1E,
-    0xDD, 0x7B, 0xA6, 0x83, 0x79, 0x00, 0x97, 0x66, 0x5C, 0x6D, 0xAA, 0xB2, 0x67, 0x9B, 0xBC, 0x8A,
-    0x78, 0x93, 0x50, 0xAF, 0xA0, 0xED, 0x3C, 0x23, 0xF2, 0x4E, 0xE2, 0x54, 0x18, 0x0B, 0x92, 0x9C,
-    0x91, 0x03, 0xE0, 0x01, 0x00, 0x3E, 0x78, 0xBC, 0x13, 0x59, 0xDC, 0x04, 0x3B, 0x18, 0x3B, 0xEA,
-    0xF3, 0x17, 0x87, 0xF8, 0x55, 0xB5, 0x29, 0x9C, 0x4E, 0x6C, 0xB0, 0x03, 0xB9, 0x35, 0xF2, 0xC3,
-    0x26, 0xB7, 0xE6, 0xDB, 0x61, 0xF7, 0x73, 0x51, 0xDA, 0xB5, 0x8C, 0x6E, 0x5F, 0xBB, 0x25, 0xE4,
-    0x96, 0x47, 0xC3, 0x1E, 0x60, 0x4E, 0x36, 0xC9, 0x92, 0xBD, 0xEF, 0xDE, 0xD7, 0xE2, 0xF3, 0xE4,
-    0xC1, 0xEE, 0xE8, 0x74, 0x72, 0xBB, 0xFA, 0xEE, 0x19, 0x65, 0x14, 0xEC, 0x4C, 0x05, 0x83, 0xC4,
-    0x76, 0xEB, 0xB7, 0xB7, 0xC9, 0xED, 0x6E, 0xEF, 0xBB, 0x2F, 0x00, 0x38, 0x97, 0xDD, 0x35, 0xC2,
-    0x78, 0x1B, 0xF3, 0x94, 0x53, 0x3E, 0x7B, 0xBC, 0xEF, 0xD1, 0xA9, 0x5F, 0xB1, 0x3E, 0xB1, 0xE8,
-    0x43, 0xA2, 0x18, 0x1A, 0x2A, 0x99, 0xB4, 0x54, 0x79, 0xF4, 0xCE, 0x01, 0x02, 0x7E, 0xE8, 0x70,
-    0x33, 0x17, 0xD8, 0x94, 0x63, 0x11, 0xFC, 0x37, 0x72, 0x33, 0x13, 0x95, 0xF6, 0x72, 0x2D, 0xF7,
-    0x17, 0xAA, 0x21, 0xC1, 0xE4, 0x61, 0x6A, 0xA6, 0x6B, 0x8C, 0x29, 0x68, 0x4F, 0x9C, 0xD2, 0x59,
-    0x69, 0x9C, 0xAE, 0xD8, 0xE4, 0x7A, 0xC2, 0x27, 0xE6, 0x95, 0xD1, 0xC5, 0x6A, 0x25, 0x34, 0x3C,
-    0x14, 0x5A, 0x75, 0x75, 0x5F, 0xBD, 0x6E, 0xFC, 0x7B, 0xFF, 0xBD, 0xEE, 0x53, 0x58, 0xBE, 0xAA,
-    0xF4, 0x39, 0x55, 0xB3, 0x32, 0x1D, 0xDC, 0x09, 0x27, 0x52, 0xFB, 0xDE, 0xB0, 0xA9, 0x7D, 0x06,
-    0xD5, 0xED, 0x1E, 0xC2, 0x63, 0x51, 0xBE, 0x9D, 0xDA, 0x17, 0x64, 0x2C, 0x2A, 0x60, 0x8C, 0x0C,
-    0xA9, 0x7D, 0xFF, 0x3A, 0x4E, 0xE2, 0x27, 0xDE, 0x69, 0x9D, 0x6E, 0xF4, 0x76, 0xE1, 0xBF, 0xFD,
-    0xE4, 0xDA, 0x44, 0x9A, 0xDA, 0xD7, 0xC9, 0x73, 0xCE, 0xA1, 0x9A, 0x55, 0x58, 0x5F, 0xD4, 0x4E,
-    0xB9, 0xA9, 0x45, 0x1B, 0xF7, 0xCE, 0x94, 0x21, 0x9F, 0xD3, 0xB9, 0xD6, 0xFB, 0x5B, 0xE2, 0x5E,
-    0xEA, 0xC8, 0xD8, 0x50, 0x2F, 0xCF, 0x8A, 0x66, 0x96, 0x31, 0x0F, 0x09, 0x81, 0x9B, 0xF3, 0xDA,
-    0x5E, 0x53, 0x46, 0xC9, 0x76, 0xE9, 0xF0, 0xA6, 0xE0, 0x6D, 0xC8, 0x1F, 0x8C, 0x7B, 0xBE, 0xE5,
-    0x94, 0x77, 0x4F, 0xA7, 0x0D, 0x36, 0xDF, 0xB5, 0xC2, 0x4F, 0xF0, 0x09, 0x56, 0x76, 0x29, 0x5F,
-    0xAB, 0x83, 0xFD, 0x9D, 0xC8, 0xCF, 0x89, 0x46, 0x2D, 0x36, 0xBC, 0x7C, 0x3A, 0x61, 0x6B, 0x88,
-    0x09, 0xF6, 0xC5, 0xE5, 0xBA, 0xAC, 0xF6, 0xB9, 0xF7, 0x6F, 0x75, 0x44, 0xA7, 0xD9, 0x52, 0xCE,
-    0xDF, 0x5B, 0x1C, 0x25, 0xF7, 0x6B, 0x75, 0x74, 0x6A, 0x59, 0x7D, 0x1B, 0x71, 0xAF, 0x10, 0xB4,
-    0x08, 0x6E, 0x1F, 0xF1, 0x68, 0xB3, 0x93, 0xD0, 0x63, 0x0F, 0x02, 0xB3, 0x9C, 0xC8, 0x2E, 0xF2,
-    0xFB, 0xEC, 0x22, 0x3B, 0xDE, 0x62, 0x77, 0xBC, 0x93, 0xFE, 0xFE, 0xA7, 0xC6, 0xAB, 0x2D, 0x97,
-    0x34, 0xB4, 0x21, 0xE6, 0xF2, 0x7F, 0x43, 0x7D, 0xB3, 0x8B, 0x20, 0x76, 0xA0, 0x7B, 0x1C, 0xE1,
-    0x0E, 0xE4, 0xF7, 0x3E, 0x5E, 0xAB, 0x31, 0x14, 0xB1, 0xDC, 0x0A, 0xB5, 0x07, 0x5F, 0x2A, 0xAC,
-    0xE0, 0xB5, 0x6E, 0x4D, 0xDA, 0xBD, 0x30, 0x63, 0xC2, 0xCA, 0xB9, 0x75, 0x88, 0x0E, 0x28, 0xA2,
-    0xF5, 0x68, 0x71, 0x3D, 0xA5, 0x13, 0xAB, 0xEF, 0x33, 0xB1, 0xD5, 0xBE, 0x3C, 0x5C, 0x76, 0x93,
-    0x7C, 0x4D, 0xF7, 0x5A, 0xB7, 0x72, 0xE9, 0xF7, 0x8E, 0x19, 0xA6, 0x8F, 0xB1, 0xB5, 0x23, 0x62,
-    0x79, 0x3B, 0x5B, 0x38, 0x5E, 0x03, 0x4D, 0xD7, 0xF0, 0xEB, 0xD1, 0x77, 0x90, 0x01, 0xD3, 0xC0,
-    0x8C, 0x36, 0xBD, 0x98, 0x1F, 0x33, 0x2D, 0xAD, 0xC0, 0xD6, 0x03, 0xA0, 0x66, 0xD1, 0x8D, 0x56,
-    0xEA, 0xA4, 0x24, 0x40, 0x4B, 0x9F, 0xEE, 0xDC, 0xB0, 0x4C, 0x04, 0x79, 0x5D, 0x94, 0x89, 0xD1,
-    0xE3, 0x15, 0x4D, 0xB0, 0xE0, 0x46, 0xC5, 0x7B, 0xF9, 0xAF, 0xBF, 0x4B, 0x81, 0x39, 0xBA, 0xFB,
-    0x56, 0x65, 0x6B, 0xF3, 0x73, 0x35, 0x3F, 0xDE, 0xD6, 0x1E, 0x27, 0xAF, 0xBE, 0xCA, 0xDF, 0xD3,
-    0x27, 0x9F, 0xE3, 0xBA, 0xAD, 0xE8, 0xB9, 0x11, 0xD1, 0x17, 0x3D, 0xCE, 0xC4, 0xCE, 0x52, 0x93,
-    0xCB, 0xC4, 0xAE, 0xB5, 0xDE, 0x88, 0x31, 0x07, 0x0F, 0xE1, 0x2F, 0xA0, 0x94, 0xC3, 0x0A, 0x6E,
-    0x33, 0x4F, 0x15, 0xCA, 0x91, 0x85, 0x1B, 0x83, 0x6F, 0x60, 0x7E, 0xC2, 0xD2, 0x6E, 0x77, 0xD5,
-    0xBA, 0xC5, 0x7F, 0xBD, 0x4E, 0xDF, 0x0E, 0x09, 0xFA, 0x70, 0x27, 0x38, 0xC8, 0x06, 0x63, 0x5C,
-    0xC0, 0x1C, 0xAC, 0x45, 0x28, 0xAF, 0x9E, 0x62, 0x46, 0x79, 0xAC, 0xE9, 0xF6, 0x17, 0xA9, 0xDC,
-    0x8B, 0xC9, 0x30, 0x6B, 0x3E, 0x51, 0x4D, 0x26, 0x57, 0x6B, 0xBB, 0x69, 0x00, 0x51, 0x71, 0x78,
-    0x85, 0xE2, 0xDD, 0x48, 0x77, 0x68, 0x41, 0x9F, 0x8D, 0x49, 0xE5, 0x66, 0x30, 0xA4, 0xAB, 0x30,
-    0xE1, 0xDC, 0x92, 0x2B, 0x00, 0xE0, 0x1D, 0xDC, 0xA5, 0x22, 0x8F, 0x51, 0x36, 0x20, 0x43, 0x50,
-    0x00, 0x17, 0xEF, 0x0E, 0xDD, 0x3B, 0x51, 0xCD, 0xD5, 0x6E, 0x97, 0x6A, 0x6E, 0xFD, 0xFB, 0xF5,
-    0x77, 0x27, 0x98, 0xF4, 0xE6, 0x36, 0xC1, 0x80, 0xDF, 0x0B, 0xBC, 0x7F, 0x53, 0xDB, 0x7E, 0x26,
-    0x5B, 0xFD, 0xB7, 0xFE, 0xBF, 0xEA, 0x10, 0xA0, 0xFB, 0x2E, 0xE8, 0x53, 0x34, 0x78, 0xF7, 0x99,
-    0x76, 0xF3, 0x00, 0x54, 0xCB, 0x41, 0x1B, 0xC7, 0x99, 0xD6, 0x18, 0x35, 0x86, 0xF9, 0xD9, 0x31,
-    0x9A, 0x85, 0xC4, 0x99, 0xA6, 0x81, 0x8F, 0xC0, 0xA7, 0x0E, 0x1B, 0x48, 0xCC, 0xF1, 0x11, 0xA1,
-    0xF0, 0x37, 0xC0, 0xB4, 0x89, 0x65, 0x1D, 0x9A, 0xF2, 0x73, 0xE6, 0x58, 0xA9, 0xCD, 0xC0, 0xBC,
-    0x26, 0x44, 0x9D, 0x58, 0xD4, 0x34, 0xD7, 0x76, 0x01, 0x23, 0x06, 0xE5, 0xD2, 0x17, 0x50, 0xA7,
-    0xB7, 0x62, 0x5F, 0x83, 0xC1, 0x3B, 0x4D, 0xCC, 0xA0, 0x3C, 0xB6, 0x49, 0x8B, 0x18, 0x7C, 0x5F,
-    0x82, 0x17, 0x72, 0x31, 0xE1, 0x2A, 0x66, 0x0C, 0x6A, 0x51, 0x03, 0x6C, 0x8F, 0x27, 0x90, 0x89,
-    0x0B, 0xAF, 0x4B, 0x6C, 0xAB, 0x77, 0xA7, 0x48, 0x45, 0x14, 0x93, 0xD7, 0xCC, 0xE0, 0x3D, 0x41,
-    0xA8, 0x0B, 0x79, 0x96, 0x70, 0xFE, 0x23, 0xF1, 0x64, 0x3F, 0x92, 0x8D, 0x84, 0x39, 0x0E, 0xC2,
-    0x69, 0x5B, 0x98, 0x0E, 0xD8, 0x60, 0x87, 0x26, 0xCC, 0xB1, 0x4A, 0x94, 0x26, 0x93, 0x07, 0x41,
-    0x93, 0x2F, 0x01, 0x60, 0xBF, 0xD4, 0x81, 0x26, 0xCB, 0x13, 0x34, 0xC9, 0x6D, 0xD3, 0x83, 0x11,
-    0x7C, 0x31, 0xCE, 0x31, 0x77, 0x3C, 0x8E, 0xA0, 0x48, 0xD4, 0x04, 0x3F, 0x42, 0x83, 0x80, 0x12,
-    0x11, 0x87, 0x66, 0x0C, 0x9A, 0x9C, 0xDB, 0xA2, 0x09, 0xB3, 0x0A, 0x83, 0x52, 0x08, 0x00, 0x72,
-    0xB1, 0x9B, 0x44, 0x7D, 0x75, 0x21, 0xB6, 0xEE, 0xAB, 0xA2, 0xD6, 0xBF, 0x28, 0x37, 0x6A, 0xB0,
-    0x8A, 0xAF, 0x23, 0x71, 0xEC, 0x49, 0xAC, 0x7B, 0x6B, 0x13, 0x44, 0x42, 0xB4, 0xBE, 0x99, 0x08,
-    0x37, 0xB8, 0xEF, 0xC0, 0x7F, 0xF8, 0x32, 0x88, 0x11, 0xC1, 0xFA, 0xBE, 0x2B, 0xE8, 0xE8, 0x75,
-    0xE4, 0x79, 0xFE, 0xA6, 0x8F, 0xAC, 0xC5, 0x40, 0x25, 0xF5, 0xF6, 0x9C, 0xA2, 0x4E, 0xF6, 0x53,
-    0xD0, 0xD5, 0x42, 0x9B, 0xE5, 0xFF, 0xB9, 0xDF, 0x3A, 0xC7, 0xF1, 0x66, 0x9D, 0xF3, 0x61, 0x9D,
-    0xB1, 0x0F, 0xED, 0x3A, 0x2F, 0x58, 0x3A, 0x8C, 0xE8, 0xE2, 0xF6, 0x3A, 0x57, 0x9B, 0x39, 0x21,
-    0x12, 0x83, 0x43, 0x27, 0x92, 0x9A, 0x9E, 0xEA, 0xFB, 0xE2, 0xD4, 0x3B, 0x39, 0x28, 0x21, 0x72,
-    0xC0, 0x21, 0x35, 0x57, 0x9A, 0xC4, 0x84, 0xD6, 0x25, 0xE1, 0x13, 0xA2, 0x05, 0xE0, 0x4F, 0x8A,
-    0x11, 0x9D, 0x00, 0xBB, 0x4D, 0x57, 0x58, 0xE6, 0x0A, 0xCB, 0x9C, 0x69, 0xCD, 0x72, 0xEB, 0xB1,
-    0xFC, 0x20, 0xA3, 0xC4, 0x95, 0x65, 0x66, 0x7E, 0x51, 0x86, 0x34, 0x89, 0xE8, 0x39, 0x91, 0xD4,
-    0x7E, 0x85, 0x74, 0x47, 0xE6, 0x3B, 0x30, 0x64, 0x1D, 0xA1, 0x65, 0x05, 0x73, 0xDA, 0x5C, 0x26,
-    0xF8, 0x51, 0x46, 0x63, 0x9F, 0x06, 0x08, 0x61, 0xE8, 0x2C, 0x23, 0x30, 0xA7, 0xFB, 0x1E, 0x1D,
-    0x3C, 0xAC, 0x96, 0x7F, 0x87, 0xA5, 0xE7, 0xB6, 0xAE, 0x8F, 0x6D, 0x60, 0x88, 0xDC, 0x40, 0xDA,
-    0x06, 0x52, 0x1E, 0x35, 0xDA, 0xCC, 0xAA, 0xA3, 0x7F, 0x22, 0xA5, 0xFB, 0x0A, 0x2D, 0xFA, 0x72,
-    0xB7, 0x91, 0x0F, 0xBF, 0xFA, 0xFA, 0x75, 0xE4, 0x0A, 0x84, 0x19, 0x4E, 0x85, 0x3C, 0x8C, 0xC0,
-    0x15, 0x31, 0x4B, 0xFF, 0xF0, 0xFC, 0x94, 0x0E, 0x48, 0x62, 0x89, 0x79, 0xEF, 0x41, 0x6A, 0x58,
-    0x30, 0xCD, 0xB6, 0x45, 0x74, 0x86, 0x69, 0xF6, 0xF9, 0xCA, 0xD6, 0x71, 0x23, 0x83, 0xAE, 0x3C,
-    0xD5, 0x7A, 0x61, 0x62, 0x8B, 0x46, 0xB5, 0x57, 0x03, 0x71, 0xB6, 0x0B, 0x3F, 0x53, 0xDF, 0xAB,
-    0xC1, 0x5D, 0x1F, 0x1D, 0xAD, 0x19, 0xBE, 0x2D, 0xB4, 0x17, 0xC2, 0x56, 0x63, 0x88, 0x76, 0xD3,
-    0xA9, 0xA0, 0xD9, 0xA9, 0xA8, 0x1E, 0xDB, 0xC6, 0x10, 0x88, 0xF9, 0x5F, 0xC3, 0x05, 0x1D, 0xC4,
-    0x8F, 0xDA, 0x23, 0xA7, 0xFA, 0x33, 0x6D, 0xA2, 0x4D, 0xBA, 0x9D, 0x98, 0x4E, 0xA7, 0x7D, 0x10,
-    0x1A, 0x2D, 0xE2, 0x6D, 0xF5, 0x09, 0xB4, 0x37, 0x46, 0x5A, 0xB9, 0x3B, 0x3A, 0x3E, 0xD0, 0x80,
-    0x3C, 0x04, 0x5D, 0x87, 0x42, 0x1A, 0xC4, 0xF5, 0x75, 0x38, 0xAC, 0xF2, 0x8E, 0xB5, 0x12, 0x02,
-    0x3B, 0x53, 0x36, 0x32, 0x12, 0xDF, 0x8D, 0x59, 0x0E, 0xFE, 0x0F, 0xBF, 0x18, 0x5A, 0x0F, 0xE6,
-    0xBD, 0x35, 0xD2, 0x3B, 0xCC, 0x21, 0xF2, 0x3A, 0x46, 0xC6, 0x3D, 0xFD, 0x86, 0x22, 0xDE, 0xA9,
-    0x9E, 0x69, 0xB3, 0x16, 0x67, 0x7A, 0x76, 0x3B, 0x80, 0x9E, 0x48, 0x05, 0x7E, 0x6C, 0x06, 0x44,
-    0x4E, 0xB2, 0x31, 0x12, 0xBC, 0xD2, 0x6F, 0x36, 0xED, 0xB9, 0xDD, 0x46, 0xF1, 0x8E, 0xB6, 0x1D,
-    0xC2, 0x35, 0xA4, 0x9D, 0x15, 0xC5, 0xC6, 0xB6, 0x19, 0xE1, 0x18, 0xB4, 0x06, 0x05, 0xD7, 0xEC,
-    0x8E, 0x01, 0x44, 0x92, 0x3D, 0x81, 0x09, 0x76, 0xE8, 0x08, 0x11, 0xDE, 0xBE, 0xA6, 0xA5, 0xCE,
-    0xB6, 0x71, 0xC9, 0xB4, 0x1F, 0x1F, 0x2E, 0xBB, 0x75, 0x70, 0x98, 0x70, 0x14, 0x1A, 0xC0, 0xAC,
-    0x2C, 0x89, 0x31, 0xEE, 0x69, 0xDF, 0xD7, 0x44, 0xB7, 0xA1, 0x7A, 0xE1, 0x6D, 0x13, 0xC1, 0xED,
-    0xC3, 0xDA, 0x10, 0xA3, 0x18, 0x26, 0xA3, 0x0D, 0x3F, 0x38, 0x29, 0xEA, 0xBA, 0xC9, 0xD0, 0x79,
-    0xA1, 0xEF, 0xE2, 0x64, 0x63, 0xB8, 0x7D, 0xC5, 0xB3, 0x6D, 0xC3, 0x80, 0x11, 0xBA, 0xD5, 0x10,
-    0xE5, 0x0D, 0x3A, 0x7D, 0x60, 0xA7, 0x44, 0x0E, 0xFF, 0x6E, 0x59, 0xEA, 0x2D, 0x96, 0x09, 0x6F,
-    0x31, 0x6A, 0xF5, 0x16, 0x41, 0xDE, 0x10, 0xC6, 0xAD, 0x58, 0xE7, 0xCF, 0xFC, 0x68, 0xE6, 0x8F,
-    0xC4, 0xDA, 0x7A, 0xEF, 0x4D, 0xBD, 0xE3, 0x9C, 0xCD, 0xC7, 0x4C, 0xF0, 0xD3, 0x62, 0x68, 0xC1,
-    0x67, 0x06, 0xDF, 0xE1, 0xC8, 0x2A, 0xF8, 0xD4, 0xFE, 0xD5, 0xE6, 0xF3, 0xF3, 0xA4, 0xFF, 0x7C,
-    0xA9, 0xB3, 0x91, 0xA2, 0x4C, 0x81, 0xE0, 0xD5, 0x21, 0xBF, 0x12, 0x76, 0x0F, 0x43, 0xE7, 0xC4,
-    0x1B, 0xE8, 0xF9, 0xC5, 0x47, 0x8E, 0xC9, 0xB5, 0x58, 0x9E, 0x30, 0xB1, 0x19, 0xBE, 0x16, 0xFD,
-    0xB5, 0xFB, 0x4C, 0x8D, 0xA5, 0x61, 0x81, 0x7C, 0x63, 0x24, 0x54, 0x5E, 0xEC, 0x98, 0x4B, 0x8B,
-    0x22, 0x6E, 0xB0, 0x66, 0xAE, 0x89, 0x03, 0xB0, 0x03, 0x99, 0x50, 0x8F, 0x34, 0x1D, 0xF6, 0xA9,
-    0x11, 0x68, 0x67, 0xBB, 0x5A, 0x0D, 0x1C, 0x69, 0x6B, 0xA4, 0x14, 0xA5, 0xD0, 0xE3, 0xA1, 0x09,
-    0x81, 0x82, 0x2B, 0xE9, 0x75, 0x22, 0x1A, 0x72, 0xB7, 0xDB, 0x16, 0x5A, 0x0C, 0x90, 0x11, 0x8C,
-    0x23, 0x68, 0x3B, 0xB3, 0xA9, 0x81, 0x02, 0xE1, 0x1E, 0x42, 0x53, 0x1E, 0x61, 0x9B, 0x4C, 0x78,
-    0x3C, 0xC8, 0xDD, 0x55, 0xFA, 0xE5, 0xD2, 0x69, 0x11, 0xC3, 0x58, 0x39, 0x2D, 0xB8, 0x3D, 0x4D,
-    0x65, 0x19, 0xC3, 0x37, 0xB2, 0xA0, 0xF0, 0xDE, 0x92, 0x0D, 0x8C, 0xA0, 0x6D, 0x8B, 0x38, 0x46,
-    0x0C, 0x8F, 0x7B, 0x90, 0x47, 0xDF, 0x42, 0x5E, 0x45, 0x21, 0xE0, 0x1B, 0x41, 0xDB, 0xE8, 0xB9,
-    0xCA, 0x6B, 0xBC, 0xF7, 0x10, 0xB4, 0x15, 0x12, 0x09, 0x85, 0x8E, 0xBF, 0x2A, 0xB0, 0x08, 0xDC,
-    0x71, 0xDE, 0xEF, 0xCC, 0x56, 0xEC, 0x76, 0x59, 0x6B, 0x82, 0x53, 0x74, 0x6B, 0xDF, 0x78, 0x5A,
-    0x7F, 0x9B, 0x96, 0x61, 0x16, 0x76, 0xCF, 0xD6, 0xA3, 0x63, 0x91, 0x5D, 0x2B, 0xFF, 0x75, 0x81,
-    0xF2, 0x93, 0xA9, 0x48, 0xAF, 0x9F, 0x96, 0x51, 0xD6, 0x4E, 0xDD, 0x3A, 0x78, 0xB9, 0x8C, 0x9E,
-    0xAD, 0xC5, 0x16, 0x4D, 0x85, 0x68, 0x6F, 0xE7, 0x61, 0x29, 0xF7, 0x58, 0x76, 0xEB, 0xAF, 0x3A,
-    0xF4, 0x7B, 0xEF, 0x87, 0xD5, 0xAF, 0xDB, 0xD3, 0x7A, 0xF0, 0x43, 0x3C, 0x87, 0xF9, 0xAA, 0x37,
-    0xFB, 0x55, 0xE1, 0x20, 0xEA, 0xFE, 0x83, 0x80, 0x04, 0xD5, 0x0F, 0xF4, 0x07, 0x6F, 0xC7, 0xCF,
-    0xDF, 0xDF, 0xD3, 0xEA, 0x9D, 0xED, 0x69, 0x0D, 0xCB, 0x47, 0x65, 0x76, 0x30, 0x52, 0x0A, 0xE3,
-    0x5F, 0xD5, 0x60, 0xC3, 0x63, 0xFA, 0x50, 0x11, 0x75, 0x7B, 0xEB, 0x4D, 0x9D, 0x15, 0x02, 0xED,
-    0x87, 0x36, 0xD6, 0xAE, 0xFD, 0xCF, 0xFA, 0x56, 0x03, 0x3B, 0x0D, 0x50, 0x76, 0xFA, 0x0F, 0x2C,
-    0xCE, 0xFA, 0xE3, 0xA9, 0x4E, 0x05, 0xEB, 0x4C, 0xC5, 0x26, 0x4B, 0x9F, 0xC6, 0x56, 0x46, 0xFB,
-    0xDB, 0x37, 0x1F, 0x9B, 0xAD, 0x9A, 0x67, 0x9A, 0xFB, 0x2D, 0xFC, 0x68, 0xB3, 0xB4, 0x43, 0x72,
-    0xEF, 0xEA, 0x38, 0x7D, 0xF2, 0x3B, 0xAD, 0x11, 0x9B, 0x6A, 0xCE, 0xA4, 0xE3, 0xA0, 0x36, 0x73,
-    0xB1, 0x6D, 0xC4, 0x16, 0x9B, 0xB9, 0xAD, 0xD6, 0xBE, 0x31, 0x4D, 0xF6, 0x44, 0x81, 0x0F, 0x2A,
-    0x36, 0x44, 0x4A, 0xEC, 0x14, 0xF8, 0x54, 0x67, 0x14, 0xF8, 0xF8, 0x25, 0x4B, 0xE0, 0xBC, 0x8E,
-    0xE9, 0xB6, 0xEE, 0x7A, 0xC7, 0x36, 0x99, 0xED, 0xE0, 0xF7, 0x66, 0xBB, 0x65, 0xC3, 0x50, 0x77,
-    0x08, 0x49, 0xFE, 0x5C, 0xC1, 0xD2, 0x6B, 0x26, 0x1B, 0xD1, 0x35, 0x54, 0x31, 0xEF, 0x98, 0x2D,
-    0x23, 0xD4, 0xAD, 0xB4, 0xD2, 0xF6, 0x2F, 0xEC, 0xFE, 0x32, 0x9E, 0xAB, 0xD7, 0xD4, 0x90, 0x03,
-    0x57, 0x67, 0xB7, 0x11, 0x3E, 0x95, 0x26, 0x6B, 0x97, 0x01, 0x55, 0x62, 0xD1, 0x13, 0x15, 0x05,
-    0x00, 0x80, 0x29, 0x32, 0x3B, 0xF0, 0x38, 0x81, 0x02, 0x13, 0x16, 0x97, 0xA0, 0x90, 0x29, 0xD6,
-    0x6E, 0x45, 0x28, 0xB1, 0x46, 0x48, 0x0F, 0x8D, 0xC2, 0x58, 0x67, 0xC6, 0xE2, 0x75, 0xDB, 0x55,
-    0x74, 0xA7, 0xFD, 0x8D, 0x7B, 0x56, 0x4F, 0x1C, 0xAC, 0x12, 0xC1, 0x00, 0xDB, 0x17, 0x06, 0x05,
-    0x27, 0xC7, 0x00, 0x3F, 0x67, 0xC7, 0x32, 0x53, 0x4E, 0x4F, 0x7B, 0x70, 0xB1, 0xBD, 0x0D, 0x9B,
-    0x41, 0x62, 0x82, 0xDA, 0x0A, 0x37, 0xEC, 0xB7, 0xCF, 0xB9, 0xCB, 0x3F, 0x66, 0x73, 0xE3, 0x5C,
-    0x3F, 0xCE, 0xA7, 0x07, 0x36, 0x7F, 0x55, 0xEB, 0xE7, 0xA6, 0x3B, 0x59, 0x47, 0x8C, 0xF0, 0x06,
-    0x34, 0x07, 0x00, 0xE5, 0x5A, 0x4D, 0xEB, 0x9C, 0x6A, 0x0F, 0x17, 0x26, 0xB8, 0x4D, 0xA8, 0xD6,
-    0x31, 0x34, 0xCC, 0x15, 0x22, 0x8F, 0x93, 0x25, 0x4E, 0xE5, 0x6C, 0x29, 0x3C, 0xC2, 0xBA, 0xDF,
-    0x80, 0x2B, 0xDB, 0x76, 0x2E, 0xA4, 0xC2, 0x59, 0xF4, 0x66, 0xE5, 0xAE, 0xFB, 0xC5, 0xB6, 0xF8,
-    0xFC, 0x04, 0xBB, 0xD6, 0xBC, 0x00, 0xB3, 0xBF, 0x43, 0x81, 0xAA, 0x4D, 0x45, 0x68, 0x37, 0xEE,
-    0x4D, 0x15, 0xE5, 0xF3, 0x8D, 0x49, 0xAC, 0xB0, 0xE7, 0x61, 0x52, 0x4F, 0x61, 0x68, 0x66, 0xCB,
-    0x05, 0xD9, 0x41, 0x06, 0xF8, 0xE0, 0xCF, 0x81, 0xC2, 0xE7, 0xFD, 0x70, 0xBA, 0xBE, 0xEB, 0x31,
-    0x1C, 0xA8, 0x23, 0x06, 0x49, 0x9E, 0xCC, 0x11, 0xEA, 0x64, 0x22, 0x0E, 0x28, 0xBD, 0xD8, 0x47,
-    0x0E, 0xA3, 0xCC, 0x8E, 0xFB, 0xC0, 0x79, 0x3F, 0x87, 0x96, 0x8A, 0x8C, 0xA4, 0x65, 0xFB, 0xCC,
-    0x16, 0xA1, 0x44, 0x16, 0x1D, 0x5B, 0x25, 0xA6, 0x48, 0x40, 0x3F, 0x69, 0x10, 0xD9, 0x92, 0x0F,
-    0x6D, 0xA7, 0xA8, 0x79, 0x0A, 0xDA, 0x0D, 0x82, 0x0A, 0x4C, 0x9B, 0x45, 0x80, 0x04, 0x6D, 0xDF,
-    0x4E, 0x2D, 0xB6, 0x1A, 0x5F, 0xFB, 0xF1, 0x68, 0x67, 0x9D, 0xED, 0x4F, 0xEF, 0xDE, 0xD1, 0x8B,
-    0xEB, 0x8C, 0xED, 0x61, 0x72, 0x46, 0x32, 0xF3, 0x8D, 0x53, 0x58, 0x51, 0x60, 0xB4, 0x65, 0x9A,
-    0xC7, 0x66, 0xE0, 0x32, 0xC5, 0x1D, 0xE5, 0x18, 0xCD, 0x20, 0xA7, 0x5F, 0x5F, 0xDE, 0xBE, 0x3A,
-    0xD7, 0x27, 0xDA, 0x0F, 0x07, 0x20, 0xC2, 0xA9, 0xB5, 0x77, 0x45, 0xAB, 0x15, 0xE0, 0x84, 0x8D,
-    0x28, 0x78, 0x52, 0xEB, 0x22, 0x42, 0x01, 0x78, 0x9A, 0x0B, 0x47, 0x74, 0xB9, 0xB3, 0x82, 0x97,
-    0xB4, 0xEB, 0x02, 0xB9, 0xB6, 0x11, 0x20, 0xE0, 0x24, 0x9B, 0xD8, 0xD9, 0xD9, 0x61, 0x33, 0xE4,
-    0x23, 0xD6, 0x5C, 0x21, 0xEC, 0x66, 0xF2, 0x17, 0x89, 0x04, 0x7C, 0x0D, 0x94, 0x3E, 0x23, 0xF7,
-    0xF7, 0xE6, 0xE4, 0x94, 0xD1, 0x53, 0x36, 0x6A, 0x8E, 0xB3, 0xBD, 0x0E, 0x6E, 0x47, 0x84, 0xDF,
-    0xDF, 0x2A, 0xCD, 0xD7, 0x5F, 0xB8, 0x8F, 0xA7, 0x50, 0x1D, 0x8B, 0xB7, 0x31, 0xCF, 0xC6, 0x46,
-    0xC8, 0xD4, 0x13, 0xD1, 0xF6, 0xBC, 0x44, 0xFA, 0xCC, 0xB7, 0x3C, 0x12, 0x42, 0xB6, 0x89, 0x2D,
-    0xFB, 0x6C, 0x6D, 0xD9, 0x67, 0x23, 0x62, 0xF3, 0x8C, 0xB2, 0xCF, 0x97, 0x0B, 0xF7, 0xF8, 0x94,
-    0x17, 0xF1, 0xDB, 0xFA, 0xA8, 0x78, 0xCB, 0xE3, 0x78, 0xB2, 0x3D, 0xF4, 0x07, 0xCC, 0xBB, 0xE1,
-    0xBC, 0x7F, 0x0B, 0xF3, 0x46, 0x36, 0xAC, 0x97, 0xCB, 0xBC, 0x23, 0xCC, 0xFB, 0x87, 0x32, 0xEF,
-    0x6F, 0xFE, 0x64, 0x7B, 0xDE, 0x7F, 0x50, 0x83, 0x36, 0x80, 0x76, 0x17, 0xF0, 0x10, 0xB8, 0xE6,
-    0x3D, 0xD4, 0x41, 0xFC, 0xF6, 0x29, 0x87, 0xEA, 0x99, 0xB3, 0xF2, 0xBF, 0xD9, 0x4C, 0x83, 0x2F,
-    0xD5, 0xD3, 0x40, 0x66, 0x15, 0xC4, 0x55, 0xDC, 0xD9, 0x59, 0x21, 0x2B, 0xFE, 0x31, 0xB9, 0xFA,
-    0x8A, 0x7C, 0x7D, 0x43, 0xAE, 0xFA, 0xC1, 0x56, 0x13, 0xEB, 0x13, 0x84, 0xBE, 0x9F, 0x07, 0xF7,
-    0xDC, 0xB7, 0x8D, 0xFF, 0x0B, 0x76, 0x9A, 0x90, 0x8F, 0xEE, 0xA6, 0xD7, 0xD2, 0x84, 0x62, 0x3B,
-    0xE6, 0xB9, 0xDA, 0xAF, 0xEC, 0xEE, 0x4A, 0x63, 0x8E, 0x53, 0x6E, 0x29, 0x5B, 0x11, 0x9A, 0x46,
-    0xD3, 0x88, 0x39, 0x17, 0x5E, 0xBB, 0x37, 0xEF, 0x18, 0xAF, 0x27, 0xBC, 0x98, 0x83, 0x66, 0xF0,
-    0xD7, 0xC6, 0xFF, 0x29, 0x35, 0xE4, 0x61, 0x1E, 0xC0, 0xDA, 0xF9, 0xF0, 0x15, 0x39, 0xDE, 0xD9,
-    0x15, 0x39, 0x5B, 0x59, 0x4F, 0x9A, 0xF1, 0x14, 0xDD, 0xBB, 0xCE, 0x6E, 0x90, 0xC8, 0x71, 0x66,
-    0x67, 0x60, 0x8F, 0x4D, 0x59, 0xD8, 0x77, 0xF1, 0x8A, 0x48, 0x45, 0x41, 0x7C, 0x6C, 0x20, 0x82,
-    0xB4, 0x8B, 0xC3, 0x6A, 0xB5, 0x38, 0xB8, 0xDE, 0xE5, 0x4B, 0x5A, 0x2C, 0x42, 0x84, 0x75, 0xD2,
-    0xAB, 0xCE, 0xFB, 0x7D, 0xAE, 0xB7, 0xD0, 0xB4, 0xC8, 0x69, 0x01, 0x01, 0xE1, 0xF1, 0x57, 0xD6,
-    0x43, 0xB3, 0xEF, 0x25, 0x33, 0x96, 0x9D, 0x8D, 0xE3, 0x0F, 0x71, 0x36, 0x9F, 0x2D, 0xFD, 0x9E,
-    0x6E, 0x69, 0x73, 0xEF, 0xC7, 0x26, 0x78, 0x45, 0xD0, 0x6F, 0x1C, 0xA1, 0x0A, 0x6B, 0xB5, 0x38,
-    0xD7, 0x3D, 0x83, 0xC4, 0x59, 0x41, 0x59, 0xC7, 0x36, 0x13, 0x6B, 0xE3, 0x78, 0x2F, 0x86, 0xB6,
-    0x3C, 0x98, 0x73, 0xAA, 0xB5, 0x97, 0xD9, 0xD0, 0x1D, 0xE5, 0xD3, 0x38, 0x75, 0xC5, 0xEA, 0xB6,
-    0xE9, 0xF4, 0xB6, 0x80, 0xCB, 0x4E, 0x26, 0xF7, 0x7C, 0x7C, 0xE4, 0xB9, 0x9F, 0x94, 0xA9, 0xB6,
-    0x12, 0x15, 0xE0, 0xD8, 0x76, 0x8F, 0x7F, 0x85, 0x0A, 0x3C, 0x6B, 0x5E, 0xEE, 0x46, 0xA3, 0x22,
-    0x74, 0xBB, 0xC9, 0x7C, 0xED, 0x12, 0xEB, 0x5E, 0x75, 0x33, 0x55, 0x7E, 0x6A, 0xE9, 0x8F, 0xEE,
-    0x1C, 0xEA, 0x74, 0x3B, 0x0B, 0xD1, 0xFE, 0xE0, 0xDA, 0x19, 0x51, 0xD3, 0x7F, 0xFA, 0x4D, 0x6B,
-    0x43, 0x96, 0xF6, 0x22, 0x24, 0xAB, 0x38, 0xB3, 0x55, 0xD3, 0x53, 0xBB, 0xB6, 0x9E, 0xEE, 0xDB,
-    0x6A, 0x2C, 0xD8, 0x90, 0xDB, 0xAD, 0xE0, 0x1E, 0x69, 0xD0, 0x5C, 0xE6, 0xB2, 0x18, 0x8C, 0xC1,
-    0x9D, 0x4C, 0x6E, 0x1F, 0x69, 0xE2, 0xA0, 0xA2, 0x34, 0x74, 0x5E, 0x89, 0xB8, 0x74, 0x41, 0x66,
-    0xDD, 0xE3, 0xD4, 0x49, 0xB1, 0x76, 0x3C, 0x35, 0xD6, 0x2A, 0x1F, 0xDD, 0x4A, 0x9F, 0x66, 0xC7,
-    0x9B, 0x8B, 0xDA, 0xF1, 0x86, 0xE9, 0xE6, 0x58, 0xD1, 0xC8, 0x22, 0x44, 0x04, 0xD7, 0x1C, 0xAF,
-    0x1E, 0x21, 0x00, 0x17, 0x74, 0x49, 0x98, 0xB0, 0xE2, 0x5D, 0x48, 0xEB, 0xAF, 0x34, 0x4F, 0xD9,
-    0x49, 0xCE, 0x74, 0x68, 0x26, 0xC2, 0x11, 0x31, 0xDE, 0x34, 0x10, 0x27, 0x2A, 0x9F, 0x98, 0x08,
-    0xE9, 0x34, 0x60, 0xC4, 0x6D, 0x27, 0xEF, 0x4D, 0xA3, 0x61, 0x1A, 0x87, 0xF6, 0xF2, 0x02, 0x20,
-    0x32, 0x06, 0x09, 0x59, 0x23, 0xCD, 0x42, 0x10, 0x87, 0xCD, 0xFD, 0x88, 0x1B, 0xE8, 0xD9, 0x00,
-    0xD6, 0x40, 0xD9, 0x82, 0x98, 0xA0, 0x75, 0xDF, 0x13, 0x62, 0xF3, 0xA2, 0x87, 0xAA, 0xC7, 0x3D,
-    0x48, 0x29, 0x7F, 0x1E, 0xE9, 0x9B, 0xEC, 0x38, 0x15, 0x72, 0x8B, 0x9D, 0xFF, 0xF0, 0xFE, 0xDE,
-    0x63, 0x6C, 0x0B, 0x31, 0x15, 0x6E, 0x1E, 0x22, 0x4B, 0x1C, 0xB3, 0xB3, 0xE0, 0x14, 0x28, 0xDF,
-    0xDD, 0xEA, 0x4B, 0xB2, 0xF3, 0xAA, 0x08, 0x52, 0x7E, 0xA9, 0x9B, 0xEB, 0x8F, 0x0E, 0x6B, 0x06,
-    0x81, 0x4C, 0xB4, 0x95, 0x20, 0xC9, 0xA4, 0xBD, 0x3E, 0x75, 0x8F, 0xBE, 0x9E, 0xCA, 0xC6, 0xF5,
-    0x01, 0x38, 0x0B, 0xF5, 0xF0, 0xB0, 0xF3, 0x7A, 0xAE, 0x09, 0x35, 0xEA, 0xDE, 0xD1, 0x9D, 0xA4,
-    0x3E, 0x1E, 0xF5, 0xED, 0x68, 0x35, 0xEC, 0xF0, 0xA9, 0x85, 0xA3, 0xE8, 0x5A, 0x90, 0xE8, 0x7E,
-    0xC0, 0x46, 0x18, 0x70, 0x57, 0x04, 0xDC, 0x75, 0xBE, 0x83, 0x7B, 0x2D, 0x86, 0xC4, 0x28, 0xA1,
-    0xBD, 0xBB, 0xE2, 0xDC, 0xE0, 0x5A, 0x0B, 0xB7, 0xE0, 0xD3, 0x7C, 0x0B, 0x8C, 0x36, 0x27, 0x32,
-    0x34, 0x96, 0x18, 0x1F, 0xA5, 0xC5, 0xDF, 0xC1, 0xB2, 0xC5, 0x02, 0xA0, 0x4D, 0x10, 0x03, 0xB2,
-    0xCC, 0xBF, 0xA5, 0xF5, 0xE0, 0x15, 0x7D, 0x3F, 0xBE, 0xC0, 0x3A, 0xD8, 0x32, 0x75, 0xB0, 0x4D,
-    0xB5, 0x12, 0x38, 0x36, 0x9F, 0x15, 0x0E, 0x79, 0x4A, 0x8C, 0x94, 0xB4, 0x12, 0x2E, 0xA0, 0x9F,
-    0x6D, 0x54, 0xF4, 0x83, 0x61, 0xC3, 0xFD, 0x68, 0xC8, 0x34, 0x9F, 0x6D, 0x92, 0x35, 0x3F, 0x01,
-    0x7F, 0xA4, 0xED, 0x6C, 0xAB, 0xE1, 0x90, 0x5E, 0x24, 0x2A, 0xEA, 0x4F, 0x87, 0xE4, 0x03, 0xF0,
-    0xDB, 0xFF, 0x82, 0x47, 0xC8, 0xEF, 0xD4, 0x8B, 0x72, 0x75, 0x8B, 0xD7, 0x3E, 0x4A, 0xD7, 0xA4,
-    0x7A, 0xD8, 0xE2, 0x2D, 0xEB, 0x69, 0x53, 0xB8, 0x31, 0xEA, 0x6B, 0x31, 0x6E, 0xC1, 0x9B, 0x40,
-    0xE7, 0xD3, 0x72, 0xD3, 0x1F, 0xF7, 0x13, 0x77, 0xE6, 0x6E, 0xD5, 0x0B, 0x24, 0x03, 0x18, 0x9D,
-    0x0E, 0xBA, 0x4E, 0x6B, 0xF6, 0xCE, 0x9B, 0x8F, 0xCF, 0x99, 0x5B, 0xBE, 0x1F, 0x93, 0x6D, 0x82,
-    0x76, 0xEF, 0x0B, 0x5B, 0xDB, 0x8F, 0x02, 0xAE, 0x3B, 0xD7, 0x19, 0xC9, 0xE9, 0x21, 0xFB, 0x26,
-    0x17, 0xE0, 0x34, 0x6C, 0xEF, 0xCB, 0xEA, 0x15, 0xD0, 0xF6, 0x50, 0xDD, 0xAD, 0x61, 0x23, 0x89,
-    0x04, 0xAE, 0x56, 0x22, 0x2E, 0x17, 0x32, 0xB5, 0xF4, 0xAD, 0xF7, 0x8A, 0xA8, 0x7B, 0x35, 0xDF,
-    0x3B, 0xEE, 0x61, 0xBA, 0x0D, 0xF8, 0x3B, 0xA9, 0x5A, 0xC7, 0xCC, 0x3B, 0xBC, 0xCF, 0x4B, 0x5B,
-    0x86, 0x5E, 0xD3, 0x2D, 0x2D, 0xC7, 0x80, 0xFD, 0xC5, 0x61, 0xD1, 0xC3, 0x89, 0x20, 0x82, 0x42,
-    0x9B, 0x4D, 0x9B, 0x95, 0xD0, 0xE6, 0xAE, 0x08, 0xAB, 0x9A, 0x49, 0xC3, 0x4D, 0x8D, 0x50, 0x98,
-    0x83, 0x12, 0xBC, 0x57, 0x0A, 0xB7, 0x12, 0xE9, 0xE3, 0xB3, 0x67, 0xF9, 0x18, 0x72, 0x0B, 0x8D,
-    0xAD, 0x44, 0x76, 0xCF, 0x50, 0x74, 0xE2, 0x15, 0x57, 0xD0, 0x31, 0xC8, 0xCF, 0x27, 0xA3, 0x02,
-    0xEA, 0xF0, 0x02, 0xAB, 0xAC, 0xB2, 0x0B, 0x28, 0x8E, 0x0E, 0xB3, 0x71, 0x4C, 0x99, 0x30, 0x9E,
-    0xB0, 0x8A, 0x3E, 0x6A, 0x28, 0x1C, 0xD0, 0x70, 0x5A, 0x96, 0x25, 0x2C, 0x9D, 0xF5, 0x55, 0xC8,
-    0x6A, 0xB1, 0xBC, 0x66, 0x48, 0x33, 0x52, 0x5F, 0x6B, 0x4F, 0x99, 0x78, 0xC7, 0x79, 0xD3, 0x9A,
-    0x8D, 0x39, 0xBE, 0x9D, 0x58, 0x29, 0xCA, 0x36, 0xA8, 0x61, 0xE0, 0xA6, 0x40, 0xCD, 0xA3, 0xCE,
-    0x8C, 0x2B, 0x3C, 0xE6, 0x6E, 0x6E, 0xEE, 0x16, 0xDE, 0xAB, 0xC6, 0x7F, 0x23, 0x89, 0x2E, 0x98,
-    0x0B, 0x32, 0xD2, 0x7A, 0xF4, 0x66, 0x35, 0x7A, 0xAD, 0x0C, 0x45, 0x62, 0x7D, 0x39, 0x6F, 0x2E,
-    0x98, 0x2B, 0xA1, 0xF7, 0x52, 0xE5, 0x56, 0x57, 0xC6, 0x7E, 0x1E, 0x64, 0xFF, 0x20, 0x1C, 0x74,
-    0x61, 0xF4, 0x46, 0xD2, 0x38, 0x55, 0x20, 0x1A, 0xD2, 0xCF, 0xA3, 0x22, 0xFC, 0x36, 0xD4, 0xED,
-    0xB2, 0x90, 0x3F, 0x8D, 0xBA, 0x8D, 0xC7, 0x88, 0x79, 0x40, 0xCA, 0x53, 0xCE, 0x96, 0xE1, 0x3E,
-    0xFF, 0x58, 0xF1, 0xD3, 0x83, 0xD9, 0x83, 0x68, 0x05, 0x07, 0x2E, 0x9A, 0xA2, 0x57, 0x45, 0x40,
-    0xD8, 0xB2, 0xDD, 0xB1, 0x6D, 0x20, 0x11, 0x5F, 0x66, 0xC1, 0xB4, 0xF5, 0x98, 0x2E, 0x1B, 0xE2,
-    0x17, 0x84, 0xFD, 0x99, 0x36, 0x8D, 0xA5, 0x43, 0x68, 0x5C, 0xDB, 0x48, 0x5A, 0xE7, 0x45, 0x4C,
-    0x0D, 0x02, 0x19, 0x4E, 0x9D, 0xE4, 0x83, 0xCB, 0xB1, 0xF1, 0xF0, 0xD2, 0x81, 0xEB, 0x39, 0x5F,
-    0x68, 0x41, 0x5F, 0xBA, 0x1A, 0xF8, 0x9C, 0x0E, 0x7B, 0x0A, 0x06, 0x43, 0xC3, 0x6D, 0xD9, 0x42,
-    0xB9, 0x9F, 0x11, 0xE5, 0xB0, 0x1C, 0x1E, 0xAD, 0x70, 0x76, 0x87, 0xB7, 0x2C, 0x1F, 0x13, 0x39,
-    0xF3, 0x72, 0x1E, 0xDC, 0x99, 0xA2, 0xC9, 0x55, 0x97, 0x2D, 0xC5, 0x18, 0xB5, 0xB9, 0x45, 0x5A,
-    0xFD, 0xCF, 0x76, 0x54, 0xC3, 0xFB, 0x66, 0x50, 0x85, 0xE2, 0x6D, 0x37, 0x94, 0x4B, 0xE2, 0x97,
-    0xD6, 0xE8, 0xE7, 0x18, 0xC9, 0xD0, 0x1E, 0x17, 0x34, 0x61, 0xDB, 0x39, 0x3E, 0x60, 0xD4, 0xE6,
-    0xE2, 0x87, 0x5B, 0x7C, 0xC1, 0x9C, 0x95, 0xD8, 0xFC, 0x09, 0xBC, 0xE2, 0x83, 0x23, 0x1B, 0x8F,
-    0x90, 0x6B, 0x2F, 0x54, 0x7B, 0x6C, 0x94, 0x9F, 0x18, 0xD5, 0xC7, 0x44, 0x0F, 0x6D, 0x14, 0xAD,
-    0xA1, 0x99, 0x52, 0x41, 0x20, 0xDF, 0xCF, 0xF2, 0xBA, 0x6E, 0x98, 0x69, 0x6F, 0xBC, 0xAB, 0xEF,
-    0x04, 0x09, 0x32, 0x2C, 0xFE, 0xE8, 0x6D, 0x12, 0xDD, 0x72, 0x0B, 0x75, 0x8A, 0x7A, 0x95, 0x7F,
-    0xEF, 0xE8, 0x1A, 0x51, 0x2F, 0xFC, 0x31, 0x6E, 0xA3, 0xD8, 0xA6, 0x2F, 0xCA, 0xD6, 0xBA, 0xB7,
-    0xE1, 0x4D, 0x4E, 0xF1, 0xD1, 0x8B, 0xB5, 0x02, 0x8A, 0xC0, 0x36, 0x22, 0xE0, 0xCD, 0x56, 0xD6,
-    0x19, 0x57, 0xAA, 0x3F, 0x2E, 0xE5, 0x2B, 0xD5, 0xB2, 0x11, 0x2B, 0xC4, 0x3B, 0x80, 0xA8, 0x1E,
-    0x92, 0x2B, 0x55, 0x8A, 0xBF, 0x5A, 0xA2, 0x69, 0xD0, 0x93, 0x69, 0x07, 0xCA, 0x74, 0x3F, 0x5E,
-    0x8D, 0x1A, 0xA7, 0x2B, 0xBD, 0x72, 0x89, 0x26, 0x2C, 0x18, 0xBD, 0x18, 0xC5, 0x7F, 0xD3, 0xB0,
-    0x10, 0x04, 0x16, 0xF1, 0x1E, 0xE2, 0xF1, 0x01, 0xEB, 0xA5, 0xF1, 0xCA, 0x23, 0x78, 0xA5, 0xAE,
-    0x1A, 0x2D, 0x5E, 0x62, 0xDF, 0x55, 0xFA, 0xD0, 0x59, 0xB6, 0x5C, 0xB1, 0x5C, 0x35, 0x7E, 0xF6,
-    0x6E, 0x97, 0xFD, 0x99, 0xD3, 0xB5, 0x53, 0xE8, 0x96, 0xB5, 0xF7, 0xAD, 0xAE, 0x86, 0xAD, 0x06,
-    0x84, 0xEB, 0x5C, 0x73, 0xAF, 0x09, 0x5C, 0x1F, 0x1B, 0x67, 0x75, 0x59, 0xF4, 0x03, 0x36, 0xD8,
-    0xA3, 0x37, 0xB7, 0xFA, 0x48, 0xE8, 0xFB, 0x4D, 0x6C, 0x4E, 0xD5, 0xE0, 0xC6, 0xBD, 0xCF, 0x0B,
-    0x3B, 0x6E, 0xF3, 0xAD, 0x71, 0x35, 0x2E, 0x48, 0x3E, 0xD4, 0x8B, 0xD3, 0x84, 0x26, 0xB6, 0x4B,
-    0x3B, 0x4B, 0xF3, 0xB3, 0x30, 0xA1, 0xA5, 0x34, 0x07, 0xCC, 0xC2, 0x42, 0xFE, 0x8F, 0xAD, 0xAC,
-    0x64, 0xA0, 0x4D, 0xB4, 0x19, 0x8A, 0x7F, 0x2C, 0x23, 0xCA, 0xF0, 0x32, 0x04, 0xF8, 0x31, 0xC1,
-    0x8C, 0x8E, 0x58, 0x3F, 0x8F, 0xAE, 0x8C, 0x66, 0x51, 0xDD, 0x34, 0xE1, 0x55, 0x95, 0x3C, 0x5C,
-    0x81, 0xD8, 0x62, 0x19, 0x67, 0xED, 0xFC, 0x80, 0x65, 0x33, 0x0E, 0xD6, 0x6D, 0x93, 0x91, 0xEB,
-    0x03, 0x10, 0xF3, 0xF1, 0xDD, 0x5F, 0x0A, 0x5E, 0xBB, 0xB6, 0xDD, 0x69, 0x62, 0x75, 0x56, 0x24,
-    0x44, 0x7F, 0x75, 0xAE, 0xA3, 0x67, 0x89, 0x30, 0xC6, 0xA8, 0x5B, 0x1F, 0xAD, 0x82, 0x63, 0xEC,
-    0x02, 0xF0, 0x0A, 0x7A, 0xD5, 0xC0, 0xE6, 0xF2, 0x51, 0x1C, 0x10, 0x22, 0xCE, 0x9F, 0x66, 0x29,
-    0x1C, 0x91, 0x31, 0xCA, 0xF9, 0xC2, 0x8E, 0x41, 0x9A, 0x95, 0xD9, 0xD8, 0xEB, 0x68, 0x99, 0x8B,
-    0x0E, 0x4A, 0xC7, 0x4F, 0xB7, 0x4E, 0xBF, 0x7E, 0x43, 0xB2, 0x58, 0x6B, 0x0E, 0xBB, 0x52, 0x2E,
-    0x7A, 0xB6, 0x7B, 0x7E, 0x15, 0x16, 0x50, 0x43, 0xE1, 0x37, 0x59, 0x67, 0x1B, 0x14, 0xF1, 0x33,
-    0x6B, 0x76, 0x2A, 0x82, 0xB5, 0x7C, 0x4E, 0x8B, 0x36, 0x12, 0xDD, 0x79, 0x66, 0x8A, 0x5B, 0x9C,
-    0xDE, 0x7A, 0x9F, 0xEC, 0x54, 0x1D, 0xF3, 0x90, 0xE8, 0x01, 0xB6, 0xE2, 0x32, 0x5E, 0xF6, 0x8D,
-    0x13, 0x05, 0x6A, 0x4C, 0xD9, 0x1A, 0xDD, 0xBA, 0x5C, 0x29, 0x0D, 0xB8, 0x72, 0x7D, 0x7E, 0x60,
-    0x6B, 0x1E, 0xED, 0x64, 0x37, 0x74, 0x8D, 0xBF, 0x7E, 0xBA, 0x06, 0x15, 0x60, 0x2F, 0x8C, 0xB9,
-    0x6B, 0xE3, 0x04, 0x64, 0x08, 0xD9, 0x23, 0xBE, 0x18, 0xBA, 0x66, 0x25, 0x0F, 0xD8, 0x94, 0xAB,
-    0xC8, 0x62, 0x1F, 0xDD, 0xDE, 0x67, 0x4A, 0xC9, 0x7F, 0x46, 0x36, 0xB7, 0x63, 0x53, 0xEB, 0xC7,
-    0xEA, 0x69, 0x77, 0x1A, 0xF5, 0xAF, 0x8C, 0xF2, 0xC7, 0xDE, 0x27, 0xF7, 0xFD, 0x53, 0x68, 0x73,
-    0x2B, 0x27, 0xD7, 0x02, 0x64, 0xFD, 0x72, 0xA1, 0x69, 0xF8, 0x27, 0xD2, 0xEF, 0x59, 0xFC, 0x06,
-    0x43, 0x60, 0xCD, 0x68, 0x35, 0x73, 0x04, 0x89, 0xB3, 0x39, 0xA8, 0x01, 0x93, 0xF6, 0x19, 0x8F,
-    0x9F, 0xBF, 0x8E, 0x5E, 0x45, 0xC7, 0xC6, 0x76, 0x21, 0x77, 0x07, 0xD7, 0xF6, 0x68, 0x37, 0x7A,
-    0xD2, 0xF6, 0xB6, 0x36, 0x5E, 0x6D, 0x78, 0x58, 0x33, 0xC0, 0xEA, 0x52, 0x9F, 0x0C, 0xCE, 0xB5,
-    0x2B, 0x1E, 0x9B, 0x85, 0x9D, 0x60, 0xE0, 0x43, 0x36, 0xBA, 0xC8, 0x82, 0xE7, 0xA1, 0x6E, 0x17,
-    0x9B, 0x16, 0x72, 0x22, 0x9D, 0x2F, 0xD5, 0x94, 0x5B, 0x7C, 0x9D, 0x4B, 0xBB, 0x69, 0x7F, 0xC5,
-    0x17, 0x96, 0x7D, 0x26, 0x09, 0x4B, 0x6D, 0x38, 0x56, 0xA8, 0x7B, 0x30, 0x06, 0x8B, 0xD8, 0xD7,
-    0x87, 0xAC, 0xFB, 0xC1, 0x0C, 0x3F, 0xAC, 0x7A, 0xAB, 0x6C, 0xF8, 0x81, 0x4D, 0xB9, 0xE9, 0xE5,
-    0x23, 0x6B, 0x85, 0x1B, 0x0F, 0x58, 0x66, 0x77, 0x33, 0xA9, 0x12, 0xA8, 0x06, 0x4A, 0x44, 0xD3,
-    0x8E, 0xEE, 0x38, 0x7C, 0x33, 0x52, 0x63, 0x6B, 0xA0, 0xCF, 0xF7, 0x9C, 0x49, 0xCB, 0xFD, 0x91,
-    0xA3, 0xEB, 0xC5, 0xD6, 0x4B, 0x34, 0xC1, 0x7E, 0x7E, 0xFF, 0x36, 0xAA, 0x45, 0xFF, 0x46, 0x09,
-    0x26, 0xD9, 0xC9, 0xC7, 0x83, 0x54, 0xB4, 0x69, 0xD2, 0x13, 0xAE, 0xE8, 0x53, 0x6D, 0x8B, 0x93,
-    0x72, 0x3F, 0x4E, 0x1E, 0x32, 0x41, 0x35, 0x3A, 0xFE, 0xD3, 0x56, 0xBB, 0x31, 0xB1, 0xC5, 0x9F,
-    0xD9, 0x63, 0x89, 0x56, 0xCC, 0x91, 0xDB, 0x6C, 0x83, 0xED, 0xF4, 0xE0, 0x28, 0xE7, 0xFB, 0xFC,
-    0x98, 0xC5, 0xC0, 0x77, 0x16, 0x74, 0x08, 0x5A, 0xF8, 0x1D, 0x0D, 0x7F, 0x6C, 0x86, 0xD1, 0xBB,
-    0x25, 0xDC, 0x31, 0xFA, 0x3A, 0x49, 0x44, 0x3F, 0x90, 0xD4, 0xD9, 0x1A, 0xED, 0xC3, 0x80, 0xB2,
-    0xF6, 0x6C, 0x86, 0x6A, 0x76, 0x80, 0x5A, 0x14, 0x03, 0xC7, 0x8C, 0xAF, 0xC9, 0x66, 0x66, 0x43,
-    0x8B, 0x3B, 0xF0, 0x27, 0xF8, 0x6F, 0x20, 0x82, 0x1A, 0x33, 0x3C, 0x82, 0x3C, 0xFD, 0xCC, 0xE3,
-    0x6B, 0x0A, 0xA3, 0x12, 0x33, 0xEE, 0x6C, 0x2B, 0xE8, 0xA3, 0xEF, 0x6B, 0xD7, 0x6C, 0x4F, 0xD5,
-    0xFD, 0xC6, 0x74, 0xE9, 0xFB, 0x04, 0x6B, 0x0B, 0xD7, 0xBE, 0xBB, 0xD0, 0x6E, 0xEE, 0x38, 0x32,
-    0x22, 0x76, 0xDE, 0x4B, 0x92, 0xC5, 0x03, 0x8C, 0xD1, 0x36, 0xDD, 0xD1, 0x56, 0x9F, 0x60, 0xBB,
-    0x83, 0x23, 0x0D, 0x63, 0xD2, 0xFD, 0x52, 0x7E, 0xEE, 0x8C, 0x4D, 0xFB, 0x29, 0x7A, 0xCB, 0x11,
-    0x65, 0xAD, 0x36, 0x05, 0x97, 0xF1, 0x7C, 0xC1, 0x3D, 0x51, 0x26, 0xF2, 0x71, 0xD2, 0x69, 0x54,
-    0x5E, 0xE8, 0x85, 0xDC, 0x19, 0xBA, 0x4E, 0x37, 0x3C, 0x7D, 0xE0, 0xFE, 0xFA, 0x2F, 0x3A, 0xA8,
-    0xBA, 0x10, 0x52, 0xC7, 0xA1, 0xD0, 0x8E, 0x91, 0xF7, 0xEB, 0x97, 0xD4, 0x2E, 0x8B, 0x3E, 0x53,
-    0x8D, 0xC0, 0x78, 0x84, 0xCE, 0x1A, 0xCE, 0x8A, 0x2F, 0x40, 0x25, 0xCB, 0x5F, 0xCF, 0x6C, 0x11,
-    0xAB, 0xF7, 0x0F, 0x48, 0x47, 0x67, 0x65, 0x26, 0xEA, 0x17, 0x4C, 0x87, 0x10, 0xF4, 0x12, 0xAF,
-    0x72, 0xE9, 0x12, 0xAD, 0x48, 0x46, 0x32, 0xBD, 0x55, 0x79, 0xDC, 0xCE, 0x18, 0x26, 0x95, 0x10,
-    0xD6, 0xF2, 0x8B, 0xA7, 0x68, 0xB3, 0xD6, 0xB4, 0x14, 0x14, 0x11, 0xC7, 0x99, 0x0F, 0xD3, 0x02,
-    0xE7, 0x21, 0x89, 0x1A, 0x9C, 0xCA, 0x8A, 0x48, 0x14, 0xCB, 0xB2, 0xC3, 0xF8, 0xB7, 0x4A, 0xE2,
-    0x3F, 0x50, 0xD9, 0x6D, 0x80, 0x02, 0x9D, 0xF5, 0xBF, 0x5D, 0x59, 0x38, 0xD3, 0x6C, 0x17, 0xB7,
-    0xFC, 0x73, 0xED, 0x51, 0x60, 0xB5, 0x02, 0xDB, 0x39, 0xD2, 0xB4, 0x30, 0x55, 0x60, 0x3E, 0x92,
-    0x45, 0xBF, 0x75, 0x70, 0x70, 0xE9, 0x2E, 0xDF, 0x71, 0xC1, 0x46, 0x2A, 0x1F, 0xC5, 0xA2, 0x73,
-    0x33, 0x60, 0x31, 0xBF, 0x70, 0xF6, 0xA2, 0xD7, 0xA7, 0x17, 0x5D, 0x46, 0xFC, 0xFA, 0xF1, 0xC1,
-    0xD3, 0x15, 0x34, 0x29, 0x96, 0xE2, 0x3E, 0x8B, 0xBE, 0xD7, 0x32, 0xF5, 0x7E, 0x6B, 0xD1, 0xB1,
-    0x01, 0xC9, 0x64, 0x7C, 0xE8, 0x59, 0x02, 0xE3, 0x13, 0x7D, 0x37, 0x04, 0x56, 0xAD, 0x41, 0x53,
-    0xC1, 0xE9, 0x49, 0x45, 0x7E, 0xC8, 0xD7, 0x7D, 0x24, 0xC1, 0x77, 0x3A, 0x7B, 0x8B, 0xA1, 0x57,
-    0xFF, 0xB9, 0x83, 0x14, 0x91, 0x1B, 0x36, 0x56, 0xEA, 0xEB, 0x28, 0xD5, 0x73, 0x8C, 0xDC, 0x94,
-    0xAB, 0x87, 0x25, 0xBA, 0xEA, 0x6F, 0x9A, 0x46, 0x7E, 0xFE, 0x08, 0x78, 0x5F, 0x6B, 0x3F, 0xBB,
-    0xE2, 0x84, 0xF8, 0xF9, 0x94, 0xBC, 0x16, 0x54, 0x54, 0xEB, 0x35, 0x42, 0xC1, 0x41, 0xE5, 0x6D,
-    0x78, 0xB6, 0xA1, 0xA7, 0x3B, 0x1B, 0x7A, 0x49, 0xE2, 0xCD, 0x1F, 0xB6, 0x87, 0xA5, 0xBE, 0xEE,
-    0x67, 0xC2, 0xBC, 0x75, 0xE6, 0x6C, 0x8C, 0x35, 0x2F, 0x8A, 0x00, 0x91, 0x0D, 0x55, 0x59, 0x37,
-    0x8D, 0x46, 0x09, 0xC6, 0x79, 0x97, 0x18, 0x80, 0x69, 0xA5, 0x4C, 0x23, 0x60, 0x5B, 0x04, 0x8D,
-    0xD0, 0x71, 0xC1, 0xFA, 0x37, 0x0B, 0xF7, 0xAB, 0xC8, 0xF1, 0xFF, 0xEE, 0x72, 0x68, 0x79, 0x10,
-    0xDB, 0x24, 0xAA, 0x07, 0xB4, 0x95, 0x40, 0xDC, 0x97, 0x68, 0x9F, 0x89, 0x9B, 0x3F, 0x45, 0xA4,
-    0xA5, 0x36, 0xC0, 0x0B, 0xE0, 0xAC, 0x61, 0x7F, 0xA6, 0xD2, 0xFC, 0xD4, 0x51, 0xD9, 0xFC, 0x3E,
-    0x2A, 0x6E, 0xD9, 0x53, 0x9B, 0x2D, 0x41, 0xCC, 0x84, 0x6E, 0x4C, 0xD4, 0x1A, 0xB8, 0xD9, 0x1F,
-    0x9E, 0xEC, 0x19, 0xFA, 0xA9, 0x79, 0x5D, 0xD7, 0x23, 0x2E, 0x8D, 0x6B, 0xF6, 0xE7, 0x0B, 0x69,
-    0x70, 0x62, 0x3D, 0x33, 0x90, 0xBD, 0xD8, 0x7D, 0x89, 0xB0, 0xA6, 0x00, 0x34, 0x9B, 0x86, 0xA9,
-    0x4C, 0xA7, 0x67, 0xB4, 0x09, 0x98, 0x03, 0x08, 0xD9, 0x63, 0x49, 0x06, 0xA3, 0x44, 0x61, 0x5F,
-    0x03, 0xA1, 0x3E, 0x9A, 0x88, 0xD8, 0xEB, 0x1D, 0xDA, 0x57, 0xC4, 0xE6, 0x77, 0x8B, 0xBE, 0x03,
-    0xBB, 0x16, 0x60, 0x04, 0xE5, 0xE0, 0xF9, 0xD3, 0xC8, 0x45, 0x35, 0x18, 0xB0, 0x98, 0x90, 0x7B,
-    0x89, 0xEE, 0x85, 0xD5, 0x56, 0x17, 0x0F, 0x08, 0xCA, 0xC8, 0xB5, 0x48, 0xE5, 0x73, 0xCE, 0x89,
-    0x34, 0xD1, 0x89, 0x61, 0x4B, 0x3F, 0x74, 0x88, 0x30, 0x73, 0x78, 0x04, 0xC1, 0xA2, 0x2D, 0x1C,
-    0xE2, 0x37, 0x10, 0x05, 0x82, 0x9F, 0xFC, 0x89, 0x52, 0x9D, 0x7C, 0x84, 0x3B, 0xA5, 0x30, 0xE7,
-    0xC2, 0xE9, 0x8E, 0xBA, 0x82, 0x6E, 0x43, 0xBF, 0xBB, 0x7E, 0x76, 0xF2, 0x5B, 0x75, 0x32, 0xF9,
-    0x0D, 0x13, 0xC3, 0x0E, 0xC3, 0x5D, 0xF0, 0x75, 0x42, 0x45, 0x7C, 0x54, 0xAD, 0xCB, 0xFF, 0x11,
-    0x75, 0x65, 0xF7, 0x1D, 0xEE, 0x19, 0xE5, 0x8D, 0xF7, 0xD0, 0x19, 0x04, 0xB6, 0x4C, 0x67, 0xCE,
-    0x7A, 0x41, 0xD7, 0x50, 0x21, 0x72, 0xCE, 0x7C, 0x60, 0x9D, 0x5C, 0x5F, 0x5E, 0x3F, 0xD9, 0x08,
-    0xF9, 0xBE, 0x4E, 0xEE, 0x96, 0xE6, 0xDF, 0x75, 0xC5, 0xA9, 0x5A, 0xFC, 0xF9, 0x4E, 0x1D, 0xD2,
-    0x43, 0x8E, 0x19, 0xD2, 0xD2, 0x14, 0x38, 0x9B, 0x20, 0xA9, 0xCF, 0x34, 0x78, 0x5D, 0xAD, 0x60,
-    0x65, 0x97, 0x12, 0xF2, 0x9F, 0xC6, 0x64, 0x34, 0xD0, 0x62, 0xE3, 0x45, 0x1A, 0x6B, 0x41, 0x95,
-    0xBD, 0x3A, 0x90, 0x74, 0x45, 0xF1, 0x92, 0x26, 0x44, 0x99, 0x60, 0x3B, 0x15, 0x23, 0xED, 0xE2,
-    0x36, 0x75, 0x96, 0xE8, 0x8E, 0x55, 0x30, 0x82, 0xDA, 0xD2, 0x76, 0x47, 0x8E, 0x26, 0x63, 0x4D,
-    0x78, 0x89, 0xB8, 0x76, 0x6C, 0x47, 0x5F, 0x3D, 0x36, 0xDC, 0x1E, 0xD5, 0x7C, 0x49, 0x55, 0x07,
-    0x4F, 0xC2, 0x11, 0xDA, 0xA8, 0xF9, 0x7D, 0x33, 0xB8, 0x72, 0xAB, 0x4D, 0x0D, 0x8C, 0x4C, 0xD0,
-    0x02, 0x8F, 0x3D, 0xE9, 0x29, 0x19, 0x98, 0xD5, 0x4C, 0x5C, 0x36, 0x5C, 0xD4, 0xD5, 0xA7, 0xA4,
-    0xE2, 0x68, 0x1B, 0xBE, 0x7C, 0xBD, 0x88, 0xF9, 0xC6, 0x07, 0xBE, 0xE9, 0x08, 0x43, 0x1D, 0x55,
-    0xE1, 0xD5, 0xB0, 0x44, 0x56, 0x65, 0x90, 0xE3, 0xC2, 0x98, 0x45, 0xC1, 0x2D, 0x42, 0xBD, 0xD8,
-    0x0E, 0x0B, 0x36, 0xF9, 0x59, 0xA1, 0xAF, 0x26, 0xF2, 0xB4, 0x23, 0xE2, 0x8B, 0xB6, 0xDF, 0xF5,
-    0xBE, 0xB6, 0xD1, 0xD5, 0xDE, 0x78, 0x5B, 0xB9, 0x73, 0xB3, 0xFB, 0x17, 0x83, 0xB2, 0xA8, 0x92,
-    0x5D, 0xCE, 0xFF, 0xF4, 0xF6, 0x0B, 0x67, 0x26, 0x5F, 0x4C, 0x76, 0x33, 0x8F, 0xAE, 0x01, 0xBB,
-    0xE5, 0x36, 0xE1, 0x91, 0xFC, 0xB6, 0x89, 0x15, 0xF1, 0x65, 0x03, 0x10, 0x8B, 0xB4, 0xF5, 0xAF,
-    0x5A, 0x94, 0xDB, 0x32, 0x25, 0x38, 0x16, 0x23, 0x32, 0xB6, 0x71, 0x89, 0xFE, 0x05, 0x5B, 0xED,
-    0xE6, 0x30, 0xCC, 0x5F, 0xF7, 0x64, 0x2E, 0xD7, 0x2D, 0x96, 0xDE, 0xB1, 0x9D, 0x34, 0x87, 0x31,
-    0xD3, 0x2F, 0x86, 0x07, 0x2B, 0x8D, 0x21, 0xFC, 0xF6, 0x27, 0x9D, 0x42, 0x79, 0x8D, 0x29, 0x94,
-    0xF9, 0x26, 0x85, 0xB2, 0x31, 0x7D, 0x94, 0xCF, 0x86, 0x89, 0x34, 0xE8, 0xA1, 0x37, 0x37, 0x3D,
-    0x61, 0xC6, 0xC3, 0x1B, 0x17, 0x9A, 0x3E, 0x85, 0xD2, 0x2B, 0x50, 0xE1, 0xF4, 0x0A, 0x52, 0x28,
-    0x17, 0x7D, 0xB3, 0x03, 0x6A, 0x23, 0x5A, 0xE6, 0x75, 0x9F, 0x42, 0xF9, 0x5C, 0xAE, 0xB6, 0x54,
-    0x48, 0x53, 0xCD, 0x4C, 0xF7, 0xD1, 0xEE, 0x2D, 0x5F, 0xDB, 0x54, 0xE2, 0xFA, 0x54, 0x28, 0x8F,
-    0x05, 0x10, 0x38, 0x76, 0x6E, 0xFF, 0x57, 0xA2, 0x54, 0xB9, 0x43, 0x29, 0xBE, 0xCE, 0xC5, 0xF0,
-    0x7D, 0x2E, 0xE6, 0xEB, 0xDD, 0xBD, 0x6B, 0xEF, 0x4F, 0x29, 0xFF, 0x83, 0x5F, 0x91, 0xF8, 0x81,
-    0x04, 0x38, 0x9F, 0xDE, 0x49, 0xE8, 0xC2, 0x57, 0xFF, 0xFD, 0xFD, 0x09, 0x00, 0x65, 0x85, 0x06,
-    0xA7, 0x32, 0x9B, 0xFF, 0x07, 0xBD, 0x58, 0x3D, 0x8C, 0x1D, 0x57, 0x15, 0x3E, 0x33, 0xD7, 0xEB,
-    0x31, 0x9E, 0xC4, 0x77, 0x0B, 0x1B, 0x21, 0x07, 0x76, 0x28, 0x28, 0x02, 0xD8, 0x1E, 0x4A, 0x17,
-    0xEF, 0xBD, 0x3B, 0xB6, 0x8B, 0x94, 0xD9, 0xC2, 0x4F, 0x2E, 0x5C, 0xA4, 0xA1, 0x48, 0xE7, 0x26,
-    0x85, 0x8B, 0xDD, 0x7D, 0x93, 0xAC, 0x10, 0x05, 0x45, 0x16, 0x01, 0x42, 0xA2, 0x48, 0x82, 0xE4,
-    0x82, 0x2C, 0x42, 0x76, 0xB1, 0xC5, 0x22, 0xDE, 0xEE, 0xCC, 0xDA, 0x02, 0x17, 0x2E, 0x98, 0xB0,
-    0x32, 0x48, 0xB8, 0x99, 0x64, 0x49, 0x83, 0x85, 0x72, 0x1D, 0x0F, 0x61, 0xE2, 0xCC, 0xBC, 0xCB,
-    0x77, 0xEE, 0x9D, 0xB7, 0xBB, 0x76, 0x1C, 0xB2, 0x46, 0x88, 0x79, 0x9A, 0x79, 0x77, 0xEE, 0xCF,
-    0x39, 0xE7, 0x9E, 0x9F, 0xEF, 0x9C, 0x3B, 0x94, 0x53, 0x8F, 0xC4, 0x4D, 0xD3, 0xDC, 0xE8, 0xBD,
-    0x78, 0xEA, 0xE8, 0x73, 0x7E, 0x4A, 0xEF, 0xD0, 0x8B, 0x74, 0x94, 0x0E, 0xD2, 0xF0, 0x12, 0xA2,
-    0x9C, 0x4A, 0xD2, 0x64, 0x26, 0xC7, 0x44, 0x5A, 0xBE, 0xF3, 0xDC, 0x41, 0x57, 0x76, 0x8D, 0x99,
-    0x99, 0xE1, 0x79, 0xD3, 0x28, 0xB3, 0x35, 0xBC, 0xB8, 0xD7, 0x22, 0x5C, 0xA1, 0x31, 0x66, 0x1B,
-    0xB7, 0x1E, 0x0E, 0x79, 0x68, 0x78, 0x31, 0x33, 0x66, 0x07, 0xEF, 0x3F, 0x70, 0xAF, 0x7C, 0x71,
-    0x17, 0x5F, 0x3B, 0xEE, 0x8F, 0x87, 0x86, 0xC3, 0x2F, 0x1F, 0x9E, 0xA7, 0x97, 0x93, 0x33, 0x95,
-    0xFF, 0xD1, 0xFF, 0xF4, 0x41, 0xEE, 0x92, 0xC6, 0x34, 0x11, 0xEE, 0xEE, 0x95, 0xBE, 0xB3, 0xBA,
-    0xFA, 0x8E, 0xC2, 0x26, 0x4E, 0x0C, 0x87, 0xF3, 0xB4, 0x16, 0xE4, 0x03, 0x5F, 0xCB, 0xBC, 0x0D,
-    0xB4, 0x4A, 0x2F, 0x92, 0x5F, 0xC9, 0x7C, 0x53, 0xE8, 0x28, 0x6D, 0x44, 0x11, 0xD3, 0x3C, 0x79,
-    0x8D, 0x2C, 0x15, 0x77, 0x2E, 0x8A, 0x32, 0xA2, 0x59, 0x1A, 0xC8, 0x5B, 0xBA, 0x51, 0xE1, 0x96,
-    0xEE, 0xCD, 0x10, 0xAD, 0x85, 0xC9, 0x02, 0x96, 0x0B, 0x1D, 0xF3, 0x8C, 0x46, 0x16, 0x9B, 0x20,
-    0x22, 0xEA, 0x38, 0xBD, 0x38, 0x93, 0x80, 0x52, 0x9C, 0x4E, 0xBB, 0xAA, 0x28, 0xAD, 0x65, 0x3E,
-    0x16, 0x05, 0x58, 0x45, 0x34, 0x8F, 0xA5, 0x5E, 0x13, 0xE5, 0xEA, 0x8D, 0x5A, 0x68, 0x45, 0x1B,
-    0x61, 0x89, 0xC5, 0x5E, 0x15, 0x25, 0xA0, 0x14, 0xE4, 0x3D, 0x9A, 0xF5, 0x88, 0x96, 0x82, 0xBF,
-    0x94, 0x1B, 0x2A, 0xD8, 0xD1, 0x4B, 0x4A, 0x7C, 0xA0, 0x07, 0x91, 0x5F, 0xEA, 0x68, 0x86, 0xE5,
-    0x99, 0x27, 0xBF, 0x26, 0xDA, 0x20, 0x52, 0xD8, 0x58, 0x4A, 0xA2, 0x20, 0xD8, 0x79, 0xB2, 0x99,
-    0x61, 0x43, 0x6F, 0xBD, 0xBD, 0x5A, 0x88, 0x9C, 0xDF, 0xE9, 0x2A, 0x11, 0x76, 0x2F, 0x13, 0xC2,
-    0xBB, 0x87, 0xF7, 0x31, 0xD1, 0xC0, 0xCE, 0x0F, 0x0A, 0x08, 0x46, 0x04, 0x5D, 0x8C, 0x88, 0xE2,
-    0x9C, 0x64, 0xC9, 0x1A, 0x39, 0x41, 0xF6, 0x9D, 0xC9, 0xF2, 0x54, 0x5A, 0xC7, 0x5D, 0x91, 0xFF,
-    0xD3, 0x7F, 0xBE, 0x2A, 0xA0, 0xB7, 0xC0, 0x98, 0x9A, 0x7C, 0x30, 0x62, 0x66, 0x20, 0x40, 0x21,
-    0x6E, 0x99, 0x77, 0x37, 0x9C, 0x4D, 0x82, 0xC2, 0xDC, 0x4C, 0x02, 0xD3, 0xA6, 0xB8, 0x93, 0xA4,
-    0x87, 0x0D, 0xF4, 0x3A, 0x52, 0x0D, 0xEF, 0x95, 0xAC, 0xD0, 0x5E, 0x12, 0x57, 0xA3, 0x26, 0x6B,
-    0xCD, 0x24, 0x9B, 0x64, 0xAD, 0x6A, 0x42, 0xE6, 0xFD, 0x3C, 0xF6, 0x4A, 0xBE, 0x81, 0x91, 0x12,
-    0x65, 0x52, 0x63, 0x5E, 0x32, 0x45, 0x5C, 0x82, 0xB9, 0xBD, 0x82, 0xED, 0xD6, 0xA8, 0x73, 0xDC,
-    0xF2, 0x2A, 0xAA, 0x55, 0x1E, 0xDF, 0x6E, 0x44, 0xA3, 0x12, 0x95, 0x26, 0x50, 0x45, 0xD7, 0x3D,
-    0xA6, 0x25, 0x0C, 0x14, 0xF2, 0x5F, 0x8D, 0xDF, 0x92, 0x51, 0x49, 0x9C, 0xCB, 0x82, 0x87, 0x8F,
-    0x53, 0x78, 0xFB, 0x93, 0x36, 0x83, 0xAE, 0x29, 0x36, 0x77, 0xE8, 0x99, 0x22, 0xC8, 0x36, 0x8E,
-    0x3B, 0xDF, 0x29, 0xE9, 0xEC, 0xB3, 0x45, 0x8F, 0x6D, 0xCC, 0x9B, 0xC7, 0x2E, 0x3F, 0x3D, 0xD8,
-    0xCF, 0x4B, 0x8C, 0xF9, 0x70, 0x58, 0x10, 0xFF, 0x4A, 0x7A, 0xB6, 0x75, 0xC3, 0xCB, 0x14, 0xD8,
-    0x5F, 0xF8, 0x2C, 0xEB, 0xA6, 0x41, 0x41, 0x9E, 0x49, 0x28, 0x4C, 0xAD, 0xB6, 0x9C, 0xE5, 0xBC,
-    0x7A, 0x60, 0xAD, 0x0D, 0xB7, 0x19, 0xB3, 0xF7, 0x10, 0x2D, 0xF8, 0xDA, 0x87, 0x33, 0x91, 0x5F,
-    0x86, 0x79, 0x64, 0xB5, 0x83, 0x18, 0xB3, 0xA6, 0xEA, 0x53, 0x2D, 0x79, 0xAD, 0xA7, 0x45, 0x31,
-    0xB6, 0x96, 0xCB, 0xA3, 0x60, 0xEB, 0x1A, 0x1D, 0x5E, 0x89, 0xA8, 0xEE, 0xAB, 0x86, 0x8C, 0xEE,
-    0x07, 0xB7, 0x76, 0x1E, 0xD5, 0xF2, 0x7E, 0xD9, 0x6E, 0xC6, 0xD1, 0x79, 0x3D, 0x0E, 0xB7, 0xCC,
-    0xFB, 0xBA, 0x0E, 0x6E, 0x95, 0x91, 0xF7, 0x5B, 0xF9, 0x52, 0x1E, 0x45, 0xB4, 0x40, 0x54, 0xC7,
-    0xB4, 0x30, 0x86, 0xC3, 0x86, 0x79, 0xED, 0x3F, 0x04, 0x17, 0x5A, 0x10, 0x45, 0xF8, 0x66, 0x32,
-    0x80, 0xEB, 0xC9, 0xA4, 0xDF, 0x07, 0xB3, 0x01, 0xF5, 0x3D, 0x8D, 0x30, 0x81, 0x20, 0x95, 0x5C,
-    0x2E, 0x06, 0x14, 0x91, 0xD0, 0x63, 0xF9, 0x06, 0x5E, 0x29, 0x80, 0xEF, 0x98, 0x04, 0x82, 0x84,
-    0x2D, 0xC5, 0x56, 0x2E, 0xEC, 0xEF, 0x10, 0x3D, 0x76, 0x45, 0x95, 0x73, 0xEF, 0x7D, 0x1B, 0xE5,
-    0xDE, 0xE5, 0x92, 0x16, 0x3B, 0xB4, 0x98, 0xEE, 0x96, 0x37, 0x11, 0x53, 0xEC, 0x9A, 0xBB, 0x5B,
-    0xE6, 0xC8, 0xF0, 0x4B, 0xD9, 0xE9, 0x6D, 0xBA, 0x6F, 0x26, 0x41, 0x7D, 0xC8, 0x4B, 0x8F, 0x6D,
-    0x9E, 0x4E, 0x9E, 0xD3, 0x72, 0x79, 0xDB, 0xE4, 0xD2, 0x90, 0x6A, 0x76, 0x35, 0xA0, 0xAE, 0xBF,
-    0x7C, 0xEF, 0x83, 0x07, 0x55, 0x1C, 0xE6, 0xE3, 0x58, 0x3C, 0x70, 0x6A, 0x28, 0x22, 0x99, 0x8C,
-    0x5F, 0x58, 0xA9, 0x16, 0xBC, 0x07, 0x3A, 0xB8, 0xC3, 0xBC, 0x9C, 0x2E, 0xAC, 0x16, 0xC6, 0x32,
-    0x8D, 0x07, 0x34, 0x06, 0xE3, 0xA9, 0x42, 0x58, 0x15, 0xB8, 0xC5, 0x76, 0x21, 0x5F, 0x41, 0xAC,
-    0x75, 0x5A, 0xB9, 0x6D, 0x05, 0x96, 0x49, 0xDD, 0x17, 0xEF, 0x6B, 0x99, 0x4C, 0x55, 0x33, 0x08,
-    0x73, 0x08, 0x3C, 0x6A, 0x7D, 0x53, 0x85, 0xA6, 0xD8, 0xD5, 0x8F, 0x61, 0xE3, 0xB2, 0x9B, 0x27,
-    0xE4, 0xD9, 0xE0, 0x6F, 0x7C, 0x2D, 0x4A, 0x9E, 0x7B, 0x06, 0x24, 0x5F, 0x43, 0x8F, 0xCC, 0xE5,
-    0xCD, 0xCA, 0x07, 0x46, 0x81, 0x02, 0x4C, 0x42, 0x55, 0x44, 0x67, 0x44, 0x2E, 0xF2, 0xAB, 0xF4,
-    0xDA, 0x51, 0x5E, 0x21, 0xB7, 0x80, 0x60, 0x98, 0x15, 0x0B, 0xBD, 0x08, 0x79, 0x85, 0xC6, 0x24,
-    0xE8, 0x21, 0x80, 0xF5, 0xCA, 0x5E, 0x90, 0x4B, 0xAF, 0xEC, 0xF1, 0x4C, 0xE8, 0x56, 0x2E, 0x97,
-    0xE3, 0x48, 0x14, 0x6B, 0x73, 0x22, 0x5D, 0x8C, 0x92, 0x7A, 0x20, 0xCA, 0x06, 0x20, 0x1A, 0x89,
-    0xBC, 0x2F, 0x93, 0xB5, 0x33, 0x5E, 0xB9, 0x20, 0x52, 0xBD, 0x18, 0x5D, 0x28, 0x07, 0x72, 0x59,
-    0x0F, 0xE4, 0x4D, 0x1D, 0x07, 0x76, 0xB4, 0x92, 0x17, 0x8A, 0xF5, 0xF0, 0x7C, 0x79, 0x35, 0x78,
-    0x5D, 0xF7, 0x30, 0xE5, 0x14, 0x79, 0x29, 0x43, 0x13, 0x4D, 0x88, 0x7E, 0x07, 0xEF, 0xB8, 0x41,
-    0xBD, 0x6F, 0xD0, 0x69, 0x91, 0xCF, 0x91, 0x96, 0x74, 0x5A, 0x26, 0xE2, 0x47, 0x29, 0xE0, 0xEF,
-    0x10, 0x2C, 0x10, 0x94, 0xF8, 0x69, 0xFE, 0x79, 0x35, 0xB0, 0x12, 0x8E, 0xDC, 0x50, 0x94, 0x08,
-    0x8D, 0x68, 0x66, 0xB7, 0x80, 0x8F, 0x0D, 0xE0, 0x65, 0x54, 0x43, 0x5F, 0xA2, 0xC4, 0xD8, 0x84,
-    0x5A, 0x68, 0x60, 0x03, 0x5E, 0xF0, 0xFC, 0x3E, 0x6F, 0x49, 0x28, 0x4E, 0x68, 0x16, 0x53, 0x6A,
-    0x92, 0xE7, 0x1A, 0x52, 0xA9, 0x60, 0x82, 0x3C, 0x3F, 0xCA, 0x2D, 0x04, 0x8F, 0x2C, 0x0A, 0x02,
-    0xE1, 0x40, 0x99, 0x02, 0xCD, 0x70, 0x87, 0x21, 0xC5, 0x6B, 0x47, 0x3C, 0xB0, 0xE2, 0x19, 0x4D,
-    0xD7, 0xC0, 0x1F, 0x2B, 0x6E, 0x57, 0xA4, 0x72, 0xAF, 0x51, 0x00, 0x15, 0x5E, 0x24, 0x1E, 0xD8,
-    0x8C, 0xD4, 0x04, 0x1C, 0x52, 0xCA, 0x12, 0x44, 0xEF, 0x12, 0x31, 0x29, 0xC8, 0xCC, 0xA4, 0x82,
-    0x12, 0x03, 0x33, 0x14, 0xA5, 0x32, 0x17, 0x15, 0x2D, 0xC1, 0xE7, 0x55, 0xEA, 0x55, 0x47, 0x08,
-    0x2F, 0x87, 0xB1, 0x68, 0xC6, 0xFA, 0x5D, 0x1E, 0xA7, 0xA1, 0x96, 0xA5, 0xA8, 0xD1, 0xDB, 0x62,
-    0x95, 0x82, 0x50, 0xB6, 0xB3, 0x94, 0x85, 0x5F, 0x09, 0x96, 0x89, 0x3B, 0x97, 0xE0, 0xD9, 0x51,
-    0x12, 0x14, 0x21, 0x42, 0xC7, 0x76, 0xD6, 0xEC, 0x35, 0xC4, 0x5E, 0x12, 0xC0, 0xB8, 0x40, 0xCC,
-    0x3D, 0x2C, 0x88, 0x12, 0x78, 0x91, 0x8E, 0xCA, 0xA0, 0x09, 0x6B, 0x6A, 0xB1, 0xBB, 0x43, 0x0E,
-    0x0D, 0x31, 0x62, 0x92, 0xD8, 0x18, 0xCF, 0x7C, 0x56, 0x1F, 0x59, 0x8A, 0xF2, 0xB0, 0x00, 0x6D,
-    0x38, 0x49, 0x0E, 0x6A, 0x51, 0x1A, 0x5D, 0xA8, 0x3C, 0x3D, 0xA1, 0x78, 0x94, 0x0A, 0xB8, 0x96,
-    0xAA, 0x48, 0xB8, 0x34, 0x13, 0xE4, 0x36, 0xCE, 0xBC, 0x3D, 0xA8, 0x81, 0x01, 0x15, 0x72, 0x51,
-    0x6D, 0x87, 0x19, 0x83, 0x90, 0x92, 0x7F, 0x09, 0x98, 0xFC, 0xC3, 0xEA, 0xEA, 0xBB, 0xF4, 0x3D,
-    0x74, 0xFD, 0x10, 0x7D, 0x67, 0x91, 0x42, 0x24, 0x3C, 0x1E, 0x7E, 0x94, 0x22, 0x67, 0x29, 0x24,
-    0x21, 0xBA, 0x52, 0xF3, 0xFA, 0x21, 0xEE, 0x0C, 0x1E, 0x90, 0x0D, 0xE1, 0xC7, 0xC0, 0x1C, 0xC0,
-    0x96, 0x78, 0x1D, 0xCE, 0x7C, 0x8A, 0x6D, 0xFB, 0x1E, 0xEE, 0x43, 0x9D, 0x72, 0x4E, 0x93, 0x4D,
-    0x85, 0x9C, 0x11, 0x3D, 0xCE, 0x5F, 0x10, 0x24, 0x04, 0xE5, 0x39, 0x72, 0xF9, 0x69, 0xCD, 0x0D,
-    0xF9, 0xB9, 0x93, 0x91, 0xD3, 0x19, 0x52, 0x22, 0xF5, 0x39, 0xA7, 0x96, 0xE4, 0x95, 0x1A, 0x2B,
-    0x80, 0x45, 0xC9, 0x0D, 0x3A, 0x86, 0xB9, 0x3D, 0x4B, 0x6A, 0xDF, 0x3E, 0xD8, 0xE4, 0xAE, 0x51,
-    0x4E, 0x1B, 0x85, 0xFB, 0x5F, 0x11, 0x1D, 0x12, 0xB4, 0x41, 0x87, 0x0E, 0xE6, 0x7E, 0xA7, 0xDD,
-    0xD0, 0x5C, 0xEF, 0x0A, 0x11, 0x35, 0xAD, 0x48, 0xB2, 0xD7, 0x5F, 0x75, 0x18, 0xF3, 0xB0, 0x5B,
-    0x25, 0x6F, 0x76, 0x04, 0xD5, 0xB9, 0x8E, 0xC5, 0x80, 0x6A, 0xD7, 0x38, 0x62, 0x3D, 0xCC, 0x6A,
-    0xF0, 0x1A, 0x74, 0x63, 0x1B, 0xC4, 0xA0, 0xEC, 0x80, 0x59, 0xD3, 0x2C, 0xF7, 0xCE, 0x42, 0x90,
-    0x45, 0xCE, 0xD8, 0x1B, 0x10, 0x24, 0xDB, 0x06, 0x59, 0x83, 0xC7, 0x0B, 0xE6, 0xEE, 0xBB, 0x78,
-    0xFC, 0xEC, 0x57, 0x74, 0xC5, 0xB4, 0xD0, 0x25, 0xF8, 0xC7, 0x7F, 0xE6, 0x4A, 0xE2, 0xAF, 0x0D,
-    0x6D, 0x32, 0xC7, 0x47, 0x05, 0xF6, 0x04, 0x3A, 0xE2, 0x81, 0x26, 0x59, 0xD4, 0xAC, 0x91, 0x8A,
-    0x62, 0xE0, 0x21, 0xA2, 0xA0, 0xA1, 0x90, 0x11, 0xF2, 0x98, 0x45, 0xCC, 0x3E, 0xCB, 0xB0, 0xB8,
-    0x1F, 0x56, 0x43, 0x54, 0x74, 0x95, 0x2B, 0x12, 0xE7, 0x9C, 0x07, 0x59, 0x28, 0x25, 0xA7, 0x55,
-    0xB2, 0xC8, 0x68, 0x93, 0x89, 0xD5, 0x95, 0x15, 0xD6, 0xB3, 0x7B, 0xB3, 0x30, 0x6D, 0x37, 0x67,
-    0xA1, 0x78, 0x81, 0xA6, 0xE4, 0x2D, 0x06, 0xC7, 0x0E, 0x59, 0xC9, 0xD5, 0x19, 0x8E, 0xA0, 0xA3,
-    0x95, 0x4F, 0xD5, 0xBD, 0x47, 0x10, 0x6D, 0x93, 0xD3, 0x08, 0x92, 0xFE, 0x3D, 0x65, 0x35, 0xF1,
-    0xEC, 0xDA, 0x8A, 0xC2, 0xC3, 0xCA, 0x4D, 0x5D, 0x74, 0x04, 0xC0, 0x4C, 0xDE, 0x85, 0x5A, 0x2A,
-    0x78, 0xF4, 0xEE, 0xB0, 0xB6, 0x5C, 0x59, 0xCC, 0xB1, 0x93, 0x9B, 0x57, 0xA7, 0x56, 0xC7, 0x31,
-    0x13, 0x47, 0x34, 0xB6, 0xE4, 0x0D, 0x21, 0x49, 0x00, 0x46, 0x59, 0x43, 0x87, 0xAF, 0xA7, 0x36,
-    0x54, 0x9F, 0xCA, 0xA2, 0x99, 0xD2, 0x98, 0xB9, 0x92, 0x30, 0x0A, 0x80, 0x91, 0x1D, 0x5E, 0xFA,
-    0x1C, 0x0B, 0xB7, 0x3A, 0x76, 0x12, 0x2C, 0x11, 0x47, 0x0F, 0x76, 0x61, 0x19, 0x4D, 0x73, 0x73,
-    0x05, 0xC3, 0xA5, 0x88, 0x3C, 0xD4, 0x04, 0x55, 0xF4, 0x61, 0x96, 0x4E, 0x2E, 0x37, 0x47, 0x10,
-    0xE5, 0xF3, 0x88, 0x78, 0x4B, 0x66, 0xE3, 0xC9, 0x3F, 0xC8, 0xCD, 0x12, 0x28, 0x57, 0x7A, 0x21,
-    0x58, 0x42, 0x6D, 0x03, 0x4E, 0xE5, 0x84, 0xFA, 0xCA, 0x83, 0x2C, 0x59, 0xC2, 0x1D, 0x5C, 0x9C,
-    0xC9, 0xC2, 0x72, 0x8E, 0x9D, 0x5A, 0x07, 0x4E, 0xFC, 0x05, 0xE7, 0xE9, 0xC7, 0xE9, 0x89, 0x8B,
-    0x2D, 0x5B, 0xDB, 0xF8, 0xB5, 0xE1, 0x9D, 0x4E, 0xA3, 0x1C, 0x10, 0x69, 0x27, 0xCF, 0xEF, 0x4E,
-    0x44, 0x41, 0xD1, 0xB2, 0xC8, 0xD1, 0xD6, 0xE4, 0x72, 0xED, 0x59, 0x79, 0x63, 0x96, 0x0A, 0x38,
-    0x05, 0x29, 0x19, 0x23, 0x1B, 0x66, 0x1B, 0xA5, 0x16, 0xF3, 0xB8, 0xA8, 0x9C, 0xB0, 0x56, 0x46,
-    0x40, 0x3B, 0x96, 0xB1, 0xA6, 0x10, 0xD6, 0x49, 0x20, 0x20, 0x3C, 0x45, 0xB1, 0x78, 0x90, 0x0E,
-    0x0A, 0x1C, 0xB3, 0x83, 0x78, 0x0E, 0x37, 0x1E, 0x83, 0x94, 0x9A, 0x85, 0x52, 0x39, 0x36, 0x05,
-    0x91, 0x46, 0x2C, 0x22, 0x4F, 0xD9, 0x93, 0x27, 0x47, 0xF2, 0x43, 0x80, 0x73, 0x35, 0xAB, 0xD2,
-    0xEC, 0xE7, 0x2D, 0xA9, 0xE4, 0x9B, 0xB4, 0xC9, 0xA4, 0x31, 0x7B, 0x64, 0x41, 0x78, 0x93, 0xD8,
-    0x00, 0x1B, 0x2E, 0x1B, 0xDA, 0xCA, 0xB5, 0xB1, 0xB0, 0x8E, 0xBD, 0xC5, 0x05, 0xF3, 0xC8, 0x12,
-    0x98, 0x4A, 0x58, 0xB8, 0x47, 0xF9, 0x0A, 0x69, 0x5C, 0x0D, 0xEE, 0x54, 0x37, 0xB0, 0x42, 0x1D,
-    0xFF, 0x9C, 0xBE, 0xC6, 0xAC, 0x76, 0x0F, 0x96, 0x1A, 0xE5, 0xA8, 0x51, 0xC1, 0xD6, 0x6F, 0x2C,
-    0x46, 0x41, 0x34, 0x3E, 0x0E, 0xA1, 0x74, 0x37, 0xBF, 0x1F, 0x0E, 0x2F, 0x75, 0x51, 0xCC, 0x0E,
-    0x65, 0xA3, 0x7C, 0xC3, 0x8A, 0xE4, 0x82, 0x80, 0xCD, 0xC9, 0x96, 0x65, 0x2D, 0x71, 0xC2, 0x10,
-    0x4F, 0x4E, 0x64, 0xF9, 0x4F, 0x20, 0x00, 0xA1, 0xF0, 0x9A, 0x8F, 0x69, 0x37, 0x3F, 0x1C, 0x99,
-    0x7A, 0x0D, 0x47, 0x9F, 0xD3, 0x28, 0xE1, 0xEF, 0xA3, 0x3C, 0x9C, 0x14, 0xE0, 0xC3, 0x1D, 0xFF,
-    0x40, 0xC7, 0x67, 0xFB, 0x3B, 0x7E, 0x83, 0x8E, 0x7B, 0xE8, 0xF8, 0x18, 0x1D, 0x1A, 0x1D, 0x25,
-    0x12, 0x2A, 0x50, 0x4F, 0xA3, 0xE6, 0x07, 0x4A, 0xAE, 0xA1, 0xBA, 0x3F, 0x58, 0x87, 0xBB, 0xBE,
-    0x6B, 0xB8, 0x0A, 0x33, 0x2D, 0x84, 0xB8, 0xF4, 0x1E, 0x4E, 0x59, 0xA7, 0xF1, 0xE2, 0x6F, 0x73,
-    0x43, 0x7D, 0x71, 0x83, 0xE7, 0x14, 0xDC, 0xC0, 0xAA, 0x5F, 0xDB, 0xE5, 0x74, 0x72, 0x75, 0x75,
-    0x05, 0xE3, 0x2B, 0x10, 0xCE, 0xE4, 0xFD, 0x57, 0x8C, 0x11, 0x79, 0x66, 0xEA, 0x1E, 0x26, 0xDC,
-    0x42, 0xA3, 0xE1, 0xC6, 0x36, 0x1A, 0x2D, 0x37, 0x76, 0xA6, 0x8D, 0xED, 0xE9, 0x10, 0xCF, 0xA9,
-    0x07, 0xD7, 0xB1, 0x8A, 0x97, 0x23, 0xBD, 0x74, 0x38, 0x6C, 0x95, 0xC9, 0x8A, 0x84, 0xE9, 0xBE,
-    0x06, 0xF0, 0x91, 0xA8, 0x50, 0x84, 0x79, 0x8B, 0xE8, 0xB0, 0xF9, 0xA8, 0xE1, 0xCA, 0x19, 0x99,
-    0xFA, 0xAB, 0x69, 0x70, 0x0F, 0xB5, 0xF0, 0xFB, 0x30, 0xB1, 0xEE, 0x13, 0x1F, 0x0E, 0xE9, 0x5B,
-    0x7C, 0x68, 0xE2, 0x92, 0x28, 0x91, 0x45, 0x76, 0xBE, 0x0D, 0xCA, 0x27, 0xA3, 0x02, 0x86, 0x82,
-    0x33, 0xA3, 0x12, 0x22, 0x94, 0xAF, 0x22, 0x9F, 0x99, 0xA6, 0x29, 0x9B, 0xA7, 0x6C, 0xA2, 0xB2,
-    0x99, 0x8A, 0x2B, 0x6C, 0x91, 0x72, 0x2E, 0x3A, 0x65, 0x0B, 0x91, 0xC2, 0xEB, 0xB2, 0xD5, 0xFF,
-    0xF1, 0xE2, 0xFC, 0x9A, 0x06, 0x9C, 0x60, 0x39, 0x09, 0x4A, 0xB2, 0x29, 0x96, 0x6C, 0x8E, 0x75,
-    0x49, 0xB6, 0xCB, 0xB2, 0x2E, 0xD1, 0x59, 0xF8, 0x1E, 0x74, 0x70, 0xBD, 0xC2, 0x11, 0x58, 0x01,
-    0xE0, 0xA3, 0xF6, 0x06, 0xAB, 0xEC, 0xFE, 0xC4, 0x2D, 0xF1, 0x27, 0x33, 0x2B, 0xA4, 0x7A, 0xEC,
-    0x96, 0x4C, 0xE4, 0x3C, 0xA6, 0xD6, 0x8C, 0x71, 0xA9, 0x5D, 0xFD, 0xED, 0xFD, 0xDC, 0xE3, 0xA4,
-    0x83, 0x7A, 0x76, 0xF5, 0x14, 0xA8, 0x1E, 0xC2, 0x02, 0x14, 0xD7, 0xDA, 0x9A, 0x80, 0x63, 0x04,
-    0x58, 0xC7, 0x36, 0xA0, 0x45, 0x94, 0xE9, 0x01, 0x8C, 0x40, 0x23, 0xD8, 0x0A, 0x49, 0x1E, 0xD5,
-    0x54, 0x62, 0xD3, 0xCA, 0x59, 0x17, 0x57, 0x69, 0x70, 0x47, 0x8B, 0x0F, 0x70, 0x70, 0xEE, 0x3B,
-    0x48, 0xE0, 0x3C, 0xD1, 0x9D, 0x70, 0xB5, 0x85, 0xA8, 0x05, 0x77, 0xE8, 0x4D, 0x18, 0xCE, 0x2C,
-    0x09, 0x1B, 0x2D, 0x7D, 0xEB, 0x03, 0x3C, 0x31, 0x3F, 0x7A, 0x41, 0x87, 0xBA, 0xF2, 0x9B, 0xB1,
-    0x2D, 0x43, 0x10, 0x3F, 0x89, 0xDD, 0x75, 0x66, 0xFE, 0x06, 0xF1, 0xE0, 0x8E, 0xF8, 0xF7, 0x74,
-    0x0D, 0xE4, 0x7D, 0x74, 0xA9, 0xBA, 0xCA, 0xA0, 0x6F, 0xAA, 0xAF, 0x73, 0x65, 0x91, 0xAD, 0xE0,
-    0x39, 0xCB, 0xB0, 0x0C, 0x79, 0xCD, 0x2F, 0xB8, 0x90, 0x12, 0x7C, 0x24, 0x90, 0x1C, 0x04, 0x67,
-    0xE1, 0x25, 0xFE, 0x96, 0x9B, 0xF0, 0x1A, 0xA7, 0x2B, 0xA4, 0x88, 0x74, 0xFD, 0x79, 0x94, 0xD0,
-    0xCB, 0xC0, 0x91, 0x75, 0x40, 0xC7, 0xFD, 0x8C, 0xCF, 0x95, 0xB9, 0x37, 0xCC, 0x3E, 0x1D, 0x72,
-    0xEC, 0x7F, 0xBC, 0x6A, 0x1E, 0xAD, 0x72, 0x0F, 0x89, 0xCF, 0x30, 0xD4, 0x60, 0x8E, 0xC2, 0x64,
-    0x3F, 0x5F, 0x3F, 0x46, 0xEE, 0x48, 0xB6, 0xBE, 0x5F, 0x83, 0xAC, 0xD3, 0x11, 0x24, 0x05, 0x6F,
-    0x6F, 0xE5, 0xE9, 0x26, 0xE6, 0xAA, 0x03, 0x58, 0xC8, 0xB0, 0xBF, 0x5B, 0xA4, 0x3C, 0xED, 0x62,
-    0x7C, 0x54, 0xA8, 0xFE, 0x41, 0x8A, 0x41, 0xF9, 0x70, 0xC2, 0x25, 0x7D, 0x15, 0x83, 0x7D, 0xD1,
-    0x44, 0x29, 0x57, 0xF5, 0x28, 0xEE, 0x70, 0x7E, 0xE0, 0xAA, 0xB1, 0x8E, 0x44, 0x29, 0x8A, 0x05,
-    0x79, 0x4E, 0xDB, 0xDA, 0xBE, 0x22, 0x3D, 0x27, 0xF2, 0x05, 0x94, 0xF7, 0x5E, 0x71, 0x6A, 0x1F,
-    0x49, 0x57, 0xD3, 0x8C, 0x2C, 0x36, 0x47, 0xB6, 0x1C, 0xFA, 0x22, 0x21, 0x3F, 0x7F, 0xD9, 0xFA,
-    0xEA, 0xAA, 0xE2, 0xB5, 0xEA, 0x4D, 0x0E, 0x31, 0xB9, 0xC3, 0xD2, 0x8B, 0xEA, 0xA0, 0x04, 0x66,
-    0xBB, 0x50, 0xDC, 0x63, 0xDE, 0x6D, 0xFF, 0xFB, 0x7B, 0xDA, 0xE3, 0xEE, 0x70, 0x87, 0x3D, 0x5C,
-    0x34, 0x2D, 0xF7, 0x4C, 0x4E, 0xF2, 0xF3, 0xE8, 0x41, 0x79, 0x58, 0x97, 0xA6, 0xC0, 0x1D, 0x2F,
-    0x2D, 0x01, 0x3A, 0x73, 0xD0, 0xB5, 0x36, 0x65, 0x79, 0x17, 0x2A, 0xBB, 0x29, 0x06, 0x06, 0x6F,
-    0xE2, 0x76, 0x7B, 0x9E, 0x9F, 0x3E, 0x3C, 0xE8, 0x56, 0x3D, 0x89, 0x9F, 0xB6, 0xF2, 0xF0, 0x72,
-    0x35, 0xB1, 0x5F, 0x42, 0x6C, 0x95, 0x34, 0xD9, 0x7D, 0x6C, 0x7C, 0x19, 0x4B, 0x06, 0x97, 0x59,
-    0xB6, 0x71, 0x6D, 0x33, 0x36, 0x5A, 0x7E, 0x33, 0xD7, 0xD5, 0xBE, 0xFF, 0xF1, 0x7A, 0xF5, 0x71,
-    0x46, 0xED, 0xAE, 0x7E, 0x3D, 0x97, 0x51, 0x6B, 0x9A, 0x56, 0x69, 0x3E, 0x8E, 0xDC, 0x5F, 0x41,
-    0xFE, 0x47, 0x0C, 0x14, 0x98, 0x5C, 0xA3, 0x12, 0x50, 0x38, 0xB2, 0xA3, 0x54, 0xC2, 0xC0, 0xCC,
-    0x5E, 0x7D, 0xBC, 0xB7, 0xC2, 0xD5, 0x66, 0xEE, 0x53, 0xE0, 0x15, 0xFB, 0xBC, 0x3B, 0x1C, 0x2E,
-    0xF1, 0xE7, 0x38, 0x57, 0xE2, 0xED, 0x5F, 0x71, 0x08, 0x2B, 0x66, 0x61, 0x36, 0x99, 0x2A, 0xCB,
-    0x23, 0xB2, 0x3C, 0x90, 0x03, 0xE7, 0x30, 0xB0, 0x4E, 0x4F, 0xAC, 0xB8, 0x66, 0x89, 0xDF, 0xF9,
-    0xA4, 0x55, 0x9D, 0xC6, 0x7F, 0xDC, 0x66, 0x6F, 0xFF, 0x69, 0x5A, 0x4E, 0xC7, 0xF7, 0x3E, 0x6D,
-    0xA0, 0x90, 0xE8, 0xCD, 0x87, 0x0D, 0x7F, 0x18, 0x9A, 0xCF, 0xD4, 0x1F, 0x1F, 0x80, 0x87, 0xFF,
-    0x93, 0xC6, 0xA8, 0x9B, 0x2B, 0xBB, 0x03, 0xC8, 0x5C, 0x77, 0xDD, 0xF7, 0x11, 0x91, 0x3F, 0xE3,
-    0xB7, 0x9B, 0xCB, 0x45, 0xC0, 0xBF, 0xF2, 0x99, 0xBE, 0xC1, 0x64, 0x13, 0xD5, 0xC4, 0xB5, 0xD4,
-    0x61, 0x29, 0xF2, 0x83, 0xAE, 0x72, 0xDF, 0x6E, 0xBC, 0x44, 0xE4, 0x41, 0x81, 0xA3, 0x5A, 0xA5,
-    0x9A, 0x6C, 0x72, 0xF0, 0x95, 0x3E, 0x4E, 0x87, 0xA7, 0xCE, 0xDE, 0x38, 0xD6, 0xEB, 0x49, 0x7D,
-    0x70, 0x9E, 0xD8, 0x61, 0x7A, 0x29, 0xFD, 0x6F, 0x34, 0xF3, 0x6F, 0x65, 0x94, 0x31, 0x8C, 0x1C,
-    0x35, 0x14, 0x86, 0x7F, 0xDB, 0x49, 0x8C, 0xB0, 0x14, 0x53, 0x5C, 0x0A, 0x90, 0xD8, 0x69, 0xA8,
-    0xA2, 0xCC, 0x4E, 0x7B, 0xC5, 0xCC, 0xED, 0x90, 0x94, 0x29, 0x72, 0x05, 0x3D, 0x29, 0x68, 0x48,
-    0x93, 0xE6, 0x8A, 0x95, 0x58, 0x65, 0x47, 0x20, 0xD1, 0x50, 0xE4, 0x7A, 0x0A, 0x52, 0xE6, 0x2E,
-    0x48, 0x47, 0xB1, 0x82, 0x11, 0xCA, 0xDD, 0x3A, 0xBA, 0xE2, 0x0A, 0x1A, 0x93, 0x14, 0x29, 0x52,
-    0x60, 0x72, 0x88, 0x48, 0x27, 0x21, 0x9C, 0x60, 0xD0, 0x42, 0x66, 0xCF, 0x3C, 0xCF, 0xA2, 0x80,
-    0x84, 0x67, 0x64, 0xD9, 0x33, 0x6F, 0xFE, 0xF1, 0xFB, 0xDF, 0x67, 0xE3, 0x4D, 0xC8, 0x58, 0xDF,
-    0x9A, 0x0B, 0x57, 0x15, 0x08, 0x41, 0x1C, 0x1B, 0xFD, 0x3E, 0xAA, 0xFB, 0x78, 0xE1, 0xE4, 0x77,
-    0xCD, 0x90, 0x1E, 0x4D, 0x94, 0x39, 0xED, 0x58, 0x34, 0x78, 0x0F, 0x80, 0x86, 0x03, 0xAB, 0x4B,
-    0xD1, 0x6C, 0x29, 0xF8, 0xF3, 0xCC, 0xE5, 0xC2, 0x94, 0xAC, 0x46, 0x6A, 0x1D, 0xF8, 0x02, 0x2A,
-    0x60, 0x10, 0x30, 0xF1, 0x78, 0xEE, 0xC5, 0x43, 0xA7, 0xAE, 0xD8, 0xA1, 0x30, 0xA3, 0xD8, 0x4D,
-    0x63, 0x07, 0xD5, 0x40, 0xD7, 0x24, 0xB0, 0x6A, 0x2A, 0xDA, 0x51, 0xAC, 0x7D, 0x7A, 0x5A, 0x01,
-    0x2F, 0xB7, 0x65, 0x74, 0x67, 0x94, 0x49, 0x11, 0x34, 0x0D, 0xB5, 0x3A, 0x3C, 0x59, 0x52, 0x08,
-    0xDB, 0x04, 0xD8, 0x26, 0x8B, 0x2E, 0x3B, 0x79, 0x37, 0xA4, 0x97, 0x63, 0x88, 0x27, 0x41, 0xC7,
-    0x70, 0x4B, 0xFC, 0xE8, 0xE5, 0x91, 0x19, 0x64, 0x68, 0x27, 0xD2, 0x9C, 0x1E, 0x20, 0xBA, 0x7E,
-    0x7D, 0xA4, 0xDB, 0xD1, 0x4D, 0x12, 0xE0, 0x1E, 0x92, 0x04, 0x1B, 0x14, 0x48, 0x9A, 0x1D, 0x98,
-    0x87, 0x70, 0xA0, 0x9F, 0x64, 0x35, 0x46, 0xAB, 0x55, 0x9C, 0xAD, 0x31, 0x0F, 0xFC, 0xCF, 0xFB,
-    0xC2, 0x56, 0xC2, 0x54, 0xC2, 0x4E, 0xD8, 0x1F, 0x01, 0xB1, 0x91, 0xD1, 0x66, 0x97, 0x7D, 0x85,
-    0x50, 0x22, 0x54, 0xCC, 0x17, 0x9F, 0x3B, 0x15, 0xEB, 0xA4, 0xBF, 0x46, 0xFA, 0x38, 0x98, 0x4B,
-    0x5B, 0x0E, 0x93, 0x57, 0x8F, 0xAC, 0xBE, 0xD6, 0x74, 0x59, 0xF4, 0xD9, 0x93, 0x94, 0x06, 0xFD,
-    0xB1, 0xE0, 0xF7, 0x82, 0x3E, 0x4D, 0xBA, 0xB8, 0x93, 0x72, 0xF5, 0xD4, 0x4D, 0xE3, 0xCF, 0x7B,
-    0x3B, 0xFD, 0x88, 0xBA, 0xB3, 0xF4, 0x57, 0x19, 0x4F, 0x6F, 0xEC, 0x6E, 0x4F, 0xE3, 0xE3, 0xB8,
-    0xEC, 0x57, 0x31, 0x8D, 0x4F, 0x77, 0x77, 0x30, 0x40, 0x46, 0x19, 0xAA, 0x46, 0x1A, 0x5A, 0xA5,
-    0xC7, 0x04, 0x43, 0x9A, 0x0A, 0x4B, 0xC3, 0x72, 0x35, 0x68, 0x49, 0x81, 0x9B, 0x24, 0x32, 0xA3,
-    0xB7, 0x25, 0x5D, 0x55, 0x7F, 0x95, 0x34, 0xBB, 0x8F, 0xC0, 0x3C, 0x77, 0xD2, 0xE8, 0x7A, 0x48,
-    0x81, 0x8C, 0x6D, 0xCB, 0x9B, 0x0B, 0x15, 0x26, 0xDA, 0x94, 0xBA, 0x2E, 0x33, 0x4C, 0x72, 0xB4,
-    0x25, 0x66, 0x25, 0xFC, 0x04, 0x7E, 0xCC, 0xDC, 0x26, 0x15, 0xAD, 0x2F, 0xFC, 0x34, 0x15, 0x9E,
-    0x5C, 0x5C, 0xF0, 0x63, 0xAB, 0x6E, 0x63, 0x63, 0x82, 0xDF, 0xBD, 0x38, 0x32, 0x45, 0x86, 0x45,
-    0x45, 0x85, 0x5F, 0x22, 0xDA, 0xDE, 0x58, 0xE1, 0xE7, 0x5F, 0x2C, 0x5B, 0x2F, 0x4D, 0x81, 0x85,
-    0xB0, 0x24, 0xC8, 0x9D, 0xAE, 0xC9, 0x9B, 0x95, 0x89, 0x31, 0x88, 0xBF, 0x3A, 0x56, 0x57, 0xBD,
-    0xD3, 0x13, 0x60, 0x91, 0xBC, 0x20, 0xA7, 0x8B, 0xE4, 0x3B, 0xA5, 0x93, 0x1C, 0x8F, 0x7E, 0x1A,
-    0xFD, 0xCA, 0x74, 0x46, 0xF1, 0x27, 0x5D, 0x1F, 0xDC, 0xC7, 0x9F, 0x4B, 0xA6, 0x63, 0xCF, 0xA6,
-    0x12, 0x51, 0xE5, 0x10, 0xDE, 0xE0, 0x7E, 0x63, 0x2F, 0x01, 0x92, 0x00, 0x48, 0x6D, 0x1F, 0x8C,
-    0x84, 0x3A, 0xE8, 0x16, 0x55, 0xC0, 0x8C, 0x52, 0xF5, 0xF2, 0x81, 0xD7, 0xDC, 0x8D, 0xE2, 0x92,
-    0xF8, 0x4A, 0x95, 0x26, 0x92, 0xE8, 0xFE, 0x17, 0x2E, 0xD6, 0xC3, 0x55, 0xFE, 0x0F, 0x2E, 0x9F,
-    0xE0, 0x22, 0x48, 0xCC, 0x0A, 0x2E, 0xCC, 0x7D, 0x76, 0x52, 0x87, 0x04, 0xCA, 0x04, 0xFC, 0x59,
-    0x82, 0x6B, 0xC4, 0x7D, 0x20, 0xB8, 0x32, 0xB2, 0x85, 0x98, 0x38, 0xE8, 0xE1, 0x5A, 0x5B, 0xE9,
-    0x2E, 0x7B, 0xB8, 0xFA, 0xF4, 0xA8, 0x22, 0xF4, 0x4D, 0x06, 0x6C, 0x80, 0xEC, 0x67, 0x21, 0xE5,
-    0xF9, 0x0A, 0xB8, 0xD4, 0x2E, 0x90, 0xBF, 0xCD, 0xAD, 0x9B, 0x57, 0xDC, 0x50, 0xD7, 0xED, 0x50,
-    0xD8, 0x8D, 0x7D, 0xCC, 0x8D, 0xFE, 0xB5, 0x59, 0x64, 0x57, 0x9B, 0x8D, 0x0A, 0x6D, 0x2B, 0xBE,
-    0x5F, 0xCE, 0xD9, 0x0A, 0xDC, 0x35, 0x8A, 0x25, 0xB0, 0x88, 0xC3, 0x02, 0xB3, 0x96, 0x3F, 0x72,
-    0xFA, 0xAA, 0xD9, 0xD7, 0x04, 0xD6, 0x33, 0x43, 0x6B, 0xA6, 0x54, 0xB2, 0xCB, 0xF7, 0x82, 0x5A,
-    0x81, 0x75, 0x1D, 0x0A, 0xF8, 0x8A, 0xBA, 0x51, 0x7C, 0xBA, 0xB7, 0xDB, 0x8F, 0xA8, 0x63, 0xA9,
-    0x48, 0x31, 0x5E, 0xDC, 0xBD, 0x33, 0x8A, 0xC7, 0xF1, 0xB4, 0x5F, 0xC1, 0xA8, 0x07, 0x8B, 0x20,
-    0x16, 0x4E, 0x11, 0x19, 0x05, 0x49, 0x25, 0x54, 0x5A, 0xF2, 0x78, 0x75, 0xB5, 0x3D, 0x48, 0x79,
-    0xFA, 0x7E, 0xFC, 0x8A, 0xA8, 0xFC, 0x15, 0x55, 0x14, 0xC8, 0xBD, 0x30, 0xBA, 0x29, 0x52, 0x51,
-    0x3F, 0x7C, 0x4D, 0xC4, 0x2F, 0x75, 0xBD, 0xC8, 0xFB, 0x7D, 0x31, 0x86, 0x9F, 0xD1, 0xCD, 0xDD,
-    0x4C, 0xDA, 0x49, 0x61, 0x8A, 0x17, 0x26, 0xAD, 0xED, 0x06, 0x46, 0x9D, 0xE6, 0x0F, 0x6D, 0x5E,
-    0xAA, 0xA3, 0xE8, 0xBE, 0xDD, 0x54, 0x35, 0xC1, 0x2A, 0xEC, 0xF5, 0x2C, 0x92, 0x1D, 0xF4, 0x36,
-    0x8B, 0x75, 0xD0, 0xBA, 0xCE, 0x4B, 0x7C, 0x6D, 0xF9, 0x93, 0x5A, 0xE7, 0x28, 0x67, 0xDC, 0x86,
-    0xE1, 0xCA, 0x06, 0xD6, 0xBC, 0x8E, 0x99, 0xAE, 0xB5, 0xAA, 0xF9, 0xE3, 0x06, 0xA3, 0x26, 0x21,
-    0x24, 0xC9, 0xE9, 0x5F, 0x20, 0x0E, 0x8D, 0x30, 0x33, 0x61, 0xFB, 0xE3, 0x83, 0xED, 0x20, 0x76,
-    0x67, 0xB8, 0xEB, 0x77, 0xD4, 0x5B, 0x51, 0x9F, 0x1C, 0xDB, 0x7C, 0x5D, 0x1E, 0x3E, 0xF0, 0x45,
-    0x47, 0x46, 0x32, 0x9B, 0x0C, 0x29, 0xD3, 0x3E, 0x91, 0x9F, 0x6E, 0xE7, 0xD1, 0x9D, 0x8A, 0x43,
-    0xA7, 0x33, 0xAC, 0x6F, 0xB1, 0xA7, 0x46, 0x5D, 0x43, 0xB9, 0x8E, 0xE7, 0x56, 0x7E, 0x56, 0xE7,
-    0x49, 0xE9, 0x3F, 0xB1, 0xCD, 0x07, 0xB9, 0x34, 0x7E, 0x2C, 0x8E, 0x9A, 0x41, 0x8B, 0xA9, 0xE1,
-    0x2F, 0x1B, 0xAD, 0xB1, 0x3E, 0x60, 0xB6, 0x54, 0xF5, 0x38, 0xC5, 0xF6, 0x87, 0x9D, 0x6C, 0x66,
-    0x3A, 0x9D, 0x7C, 0xF6, 0xD2, 0x6A, 0x02, 0xF0, 0x73, 0xCD, 0x45, 0x7C, 0x13, 0xB3, 0x4E, 0xDB,
-    0x8F, 0x2E, 0xDB, 0x20, 0x4D, 0xAE, 0x31, 0xE6, 0x0F, 0x9C, 0x42, 0x79, 0x09, 0x5E, 0x7C, 0x62,
-    0xCE, 0x63, 0xAB, 0x64, 0x4E, 0xC9, 0x26, 0x27, 0xBF, 0xC8, 0xCD, 0xBE, 0x34, 0xEC, 0xE3, 0x9F,
-    0xC4, 0x0F, 0x4B, 0x11, 0x86, 0xD2, 0x0E, 0x54, 0x43, 0x9F, 0x54, 0x1A, 0xE5, 0xE0, 0x9F, 0x7D,
-    0x4A, 0xFE, 0xF6, 0x3B, 0x65, 0xF3, 0x2E, 0xAA, 0x68, 0xB4, 0x6D, 0xA5, 0x39, 0xCF, 0x9D, 0x68,
-    0x3C, 0x73, 0xB4, 0x89, 0x33, 0x94, 0xD2, 0x0C, 0xF9, 0xA2, 0xC0, 0x6F, 0x11, 0xEB, 0x6B, 0x78,
-    0x1B, 0x29, 0x09, 0xD1, 0x9F, 0x0C, 0xE4, 0x8D, 0x88, 0xCF, 0x1D, 0xB6, 0x08, 0x76, 0xDA, 0x31,
-    0xCA, 0x52, 0xE1, 0xF4, 0x3B, 0xEA, 0x76, 0x6C, 0x2E, 0x80, 0x37, 0xA2, 0xCE, 0xEE, 0xCE, 0x3B,
-    0x4D, 0x47, 0x4D, 0xDE, 0x57, 0x7B, 0x4C, 0x71, 0x63, 0x8C, 0xCC, 0x59, 0xFC, 0x0D, 0x75, 0x58,
-    0x3D, 0x8C, 0xE5, 0x56, 0x15, 0x3E, 0xF6, 0xCD, 0xAE, 0xC5, 0xBA, 0xF0, 0x16, 0x89, 0x22, 0x88,
-    0x12, 0x53, 0x13, 0xED, 0xB8, 0xA1, 0x9C, 0x1D, 0x7B, 0xD3, 0xA4, 0xA0, 0x99, 0x62, 0x27, 0x48,
-    0x50, 0x2C, 0x65, 0x04, 0x42, 0x8B, 0x50, 0x84, 0xA6, 0x98, 0x19, 0x9B, 0x44, 0xA2, 0x49, 0x91,
-    0x69, 0x02, 0x05, 0xCD, 0x16, 0x01, 0x85, 0xB7, 0xC5, 0xA4, 0x48, 0x31, 0x12, 0xF3, 0xC6, 0xDE,
-    0xAC, 0xA8, 0x28, 0xE2, 0x80, 0x86, 0x94, 0xB1, 0x20, 0x91, 0xA2, 0x0D, 0x62, 0x6F, 0x88, 0x57,
-    0xF1, 0xCE, 0xFA, 0xF9, 0xF2, 0x7D, 0xE7, 0xBE, 0x37, 0x3B, 0x0B, 0xE2, 0x49, 0xEF, 0xDA, 0xCF,
-    0xD7, 0xF7, 0xDC, 0xF3, 0xF3, 0x9D, 0xEF, 0x9C, 0xFB, 0x44, 0xF0, 0x89, 0xDC, 0xBE, 0x24, 0x6E,
-    0x90, 0xA4, 0xFF, 0xA6, 0xC4, 0x9D, 0x88, 0xB1, 0x22, 0x61, 0x8F, 0x89, 0x11, 0xDF, 0x3D, 0xF9,
-    0xF1, 0xEC, 0x46, 0x95, 0xBB, 0x2F, 0xDA, 0xE4, 0xDE, 0xEF, 0xFB, 0xA8, 0x95, 0x79, 0x68, 0x25,
-    0xAD, 0x46, 0x31, 0x7D, 0x2E, 0x52, 0xBB, 0x7B, 0xB7, 0x22, 0xE7, 0x46, 0x79, 0xF6, 0xE1, 0x96,
-    0x7F, 0x7F, 0x03, 0xDF, 0xA4, 0x80, 0xD0, 0x76, 0x29, 0xC4, 0xB9, 0x4A, 0x72, 0xD7, 0x72, 0xA3,
-    0xCD, 0xCB, 0x22, 0xF1, 0x1B, 0x8D, 0xC8, 0x7A, 0x2A, 0x12, 0x9C, 0xF6, 0x5C, 0xDF, 0x4B, 0xEA,
-    0x5C, 0x1B, 0xBA, 0xEE, 0x91, 0x64, 0x9F, 0x44, 0x4D, 0x30, 0xEE, 0x5C, 0x91, 0xE4, 0x83, 0xD6,
-    0xCA, 0x71, 0x12, 0x55, 0xC6, 0x1E, 0x5E, 0x95, 0xF4, 0x8D, 0x3B, 0x56, 0xE6, 0x69, 0x5C, 0x18,
-    0xFB, 0xFE, 0xBA, 0x24, 0x77, 0xEF, 0x74, 0x92, 0xAF, 0x25, 0xD8, 0xCD, 0xEE, 0x88, 0xF9, 0xFA,
-    0x83, 0x56, 0x92, 0x05, 0x7E, 0xA5, 0x76, 0x5B, 0x24, 0xBF, 0x0B, 0xE1, 0xE5, 0xFD, 0x83, 0x22,
-    0x70, 0x6E, 0x21, 0xF1, 0x0D, 0x18, 0xB6, 0xBE, 0x06, 0x3D, 0x3A, 0x58, 0x94, 0x44, 0x8D, 0x2C,
-    0x3F, 0xB1, 0xEB, 0xF0, 0x75, 0x8D, 0x71, 0xB3, 0x51, 0x5C, 0x11, 0x48, 0x8E, 0xA9, 0x08, 0xEF,
-    0xC8, 0x02, 0xDF, 0xB4, 0x82, 0x0B, 0xA8, 0x79, 0x2E, 0xB7, 0x7E, 0x1A, 0x75, 0x49, 0xDE, 0xCD,
-    0x03, 0xF7, 0xCF, 0xA4, 0xC9, 0x3A, 0x19, 0x0D, 0xBC, 0xD4, 0xC0, 0xEE, 0x31, 0xEA, 0x70, 0xB3,
-    0x8B, 0x05, 0x71, 0x03, 0x9F, 0xC1, 0xF0, 0x32, 0xA9, 0xC4, 0x2C, 0xB0, 0x2C, 0x75, 0xBF, 0x6D,
-    0xA4, 0x84, 0x4B, 0x60, 0x1C, 0x24, 0x5D, 0x87, 0x20, 0xD5, 0x26, 0xA4, 0x9B, 0x8C, 0x0E, 0xDC,
-    0x09, 0x02, 0xA0, 0x08, 0xDD, 0x12, 0x53, 0xAF, 0x44, 0x87, 0x8A, 0xDB, 0xC3, 0x79, 0x92, 0x71,
-    0xC8, 0x67, 0xB3, 0x02, 0xAE, 0x73, 0xE2, 0x87, 0x5D, 0xAA, 0x7E, 0x24, 0xCB, 0xB8, 0x3C, 0xB3,
-    0xB8, 0xCE, 0xE7, 0xB8, 0x7D, 0x71, 0x7A, 0x17, 0x26, 0x52, 0xA6, 0x0A, 0x36, 0xDD, 0x4A, 0xFA,
-    0xEA, 0x53, 0x2F, 0x34, 0x0C, 0x98, 0x74, 0xAF, 0x0C, 0x22, 0xC7, 0xF2, 0x14, 0x6D, 0x5B, 0x5A,
-    0xEA, 0x75, 0xD0, 0xE5, 0x2A, 0xF7, 0x42, 0xBD, 0xB5, 0x49, 0xE7, 0xF4, 0x5E, 0x61, 0x2F, 0x53,
-    0x67, 0x2E, 0xD5, 0xB3, 0x7D, 0x3F, 0x13, 0x1C, 0xDC, 0x7B, 0x77, 0x39, 0x13, 0x0C, 0xAB, 0x69,
-    0x99, 0x53, 0x8E, 0x9B, 0xCD, 0xDE, 0xC1, 0x5E, 0x6E, 0x82, 0x0B, 0x9C, 0x2B, 0xE4, 0xFC, 0xE7,
-    0x50, 0xC7, 0x40, 0x05, 0x8A, 0x69, 0x7D, 0x28, 0x60, 0xF7, 0x4E, 0x3C, 0x26, 0x88, 0xC8, 0x51,
-    0xE9, 0x72, 0xA0, 0x70, 0xF1, 0xB0, 0x74, 0xBF, 0x46, 0x58, 0x9A, 0x64, 0x81, 0x70, 0x38, 0xA0,
-    0x52, 0xE6, 0xC1, 0x42, 0x12, 0xBC, 0x10, 0x8E, 0x92, 0x36, 0x08, 0x42, 0x2F, 0x59, 0x85, 0x8B,
-    0x95, 0xB2, 0x08, 0x06, 0x98, 0xEA, 0x80, 0xB4, 0x08, 0x18, 0x82, 0x19, 0x71, 0x63, 0x26, 0x68,
-    0x96, 0x70, 0x35, 0x2F, 0xD9, 0x08, 0x5F, 0xA4, 0xD5, 0xFA, 0x08, 0x3B, 0xB3, 0x62, 0x18, 0xE1,
-    0xE8, 0x2C, 0xF8, 0x52, 0xA3, 0x68, 0xFE, 0xD2, 0xD3, 0xE3, 0x71, 0xA5, 0x8A, 0xA4, 0x5E, 0xC7,
-    0xAB, 0xFE, 0xF2, 0xAA, 0xBF, 0x24, 0xAD, 0xF4, 0xDC, 0x19, 0x20, 0xB5, 0xD0, 0x3B, 0xB3, 0xF0,
-    0x53, 0x6E, 0xB1, 0xF1, 0x86, 0x85, 0x9B, 0xAF, 0x32, 0x1D, 0x76, 0x86, 0xA8, 0xB9, 0x34, 0x4D,
-    0x07, 0x9F, 0x27, 0xB0, 0x77, 0xD4, 0xBB, 0xA0, 0xDF, 0x49, 0x8B, 0xC0, 0xEE, 0x64, 0xF2, 0xE2,
-    0xA9, 0xAB, 0x6F, 0xD1, 0x11, 0xF6, 0xB9, 0xCF, 0xCA, 0xE3, 0xCD, 0xA8, 0x5D, 0xDB, 0x81, 0xC5,
-    0xD9, 0x11, 0x86, 0xF4, 0x08, 0x9B, 0xA7, 0x50, 0xA4, 0x80, 0x81, 0xA9, 0x24, 0x90, 0xCE, 0x21,
-    0xE7, 0x76, 0x92, 0x4C, 0xF4, 0x5C, 0xEA, 0x88, 0xC2, 0xCC, 0x31, 0x7C, 0x19, 0x8C, 0x64, 0xD4,
-    0xF2, 0x82, 0x29, 0x46, 0x78, 0xEC, 0xE9, 0x38, 0x97, 0xEC, 0xA5, 0x16, 0xFE, 0xCF, 0x81, 0xEE,
-    0x11, 0x20, 0x6C, 0x64, 0x90, 0xA9, 0x9C, 0x82, 0x1E, 0x59, 0x39, 0x21, 0x82, 0x5F, 0x96, 0x6F,
-    0x03, 0x73, 0x45, 0x2E, 0xE6, 0x74, 0x1F, 0xCB, 0x89, 0x8B, 0x0D, 0x0D, 0xF9, 0xAE, 0xBA, 0xFE,
-    0x48, 0x81, 0x37, 0x2A, 0xF2, 0x06, 0xC5, 0xC3, 0xA0, 0x62, 0xC7, 0xCB, 0x04, 0x88, 0xB3, 0x1C,
-    0x4B, 0x0D, 0xD8, 0x05, 0x6A, 0xA5, 0xAE, 0x2A, 0x5D, 0xA7, 0x91, 0xD6, 0x9C, 0x86, 0x3B, 0x1B,
-    0xAF, 0x18, 0xA7, 0x06, 0x4D, 0x20, 0x84, 0xA2, 0xCF, 0x26, 0xC8, 0x49, 0xEE, 0x42, 0x77, 0xE8,
-    0x96, 0x9D, 0xBC, 0x67, 0x6C, 0x08, 0xE7, 0x63, 0x87, 0xF4, 0x2E, 0xC4, 0xED, 0x7D, 0x7F, 0x81,
-    0x7D, 0x29, 0x02, 0xF6, 0x90, 0x7A, 0x4A, 0x00, 0x1D, 0xBA, 0xD5, 0x55, 0x30, 0x60, 0xA2, 0xAE,
-    0xE2, 0x16, 0xF2, 0x4A, 0xA8, 0x0D, 0x50, 0x95, 0x32, 0x06, 0x70, 0xC4, 0x68, 0x3A, 0xBC, 0x61,
-    0x6C, 0x5A, 0xE1, 0x8D, 0xB4, 0x99, 0x4B, 0x7E, 0x25, 0x58, 0x20, 0x14, 0x8B, 0xDA, 0x75, 0x49,
-    0x13, 0xF6, 0x8A, 0x72, 0xD5, 0x13, 0x91, 0x1A, 0xE5, 0x6A, 0x60, 0x83, 0x11, 0x90, 0xB1, 0x00,
-    0xCD, 0x10, 0x5A, 0x03, 0x19, 0xA1, 0x8D, 0xF8, 0xDB, 0x26, 0x3B, 0xA6, 0x0B, 0x6D, 0xBA, 0x1D,
-    0x35, 0xC6, 0xAE, 0x6D, 0x03, 0x31, 0xDD, 0xFA, 0x76, 0x52, 0x98, 0x6E, 0xE7, 0x30, 0x45, 0xF6,
-    0x0C, 0x87, 0x39, 0xF3, 0x8D, 0xBA, 0x71, 0x6C, 0xCC, 0x5F, 0xDB, 0x7E, 0x10, 0xF3, 0x71, 0xD3,
-    0xF7, 0x62, 0xFE, 0x5C, 0x3D, 0xB0, 0x62, 0x3E, 0x2C, 0xFE, 0xDD, 0x49, 0xF4, 0x89, 0x7C, 0xD5,
-    0x48, 0xF4, 0x2F, 0xF9, 0x1A, 0xE3, 0x28, 0x8F, 0x0A, 0x8E, 0x08, 0x52, 0xD4, 0xCB, 0x04, 0x5C,
-    0x5B, 0xBA, 0x02, 0x6C, 0xCA, 0xD4, 0x48, 0xDC, 0x43, 0xBA, 0x9A, 0x44, 0x87, 0xDF, 0xE9, 0xEC,
-    0x76, 0x4F, 0x37, 0x4B, 0x40, 0xBB, 0x60, 0x27, 0x94, 0x22, 0x6D, 0xEE, 0xE2, 0xB2, 0x1B, 0xEE,
-    0xEF, 0xC2, 0xA6, 0xA3, 0xA8, 0x81, 0x8E, 0x32, 0xC6, 0xCD, 0x11, 0x20, 0x06, 0x97, 0xE0, 0x0E,
-    0x97, 0x0A, 0x77, 0x41, 0x9F, 0x5E, 0xEB, 0x93, 0x2A, 0xB4, 0x59, 0x60, 0xA1, 0xB4, 0xCD, 0x61,
-    0x09, 0x74, 0xDF, 0x30, 0x36, 0x83, 0xE3, 0x37, 0x4C, 0x87, 0x20, 0x37, 0xBB, 0xB8, 0x43, 0x7C,
-    0x8F, 0x62, 0x50, 0x14, 0x16, 0x6B, 0x9C, 0xAB, 0x81, 0xC9, 0x8A, 0xC5, 0x64, 0xBA, 0x2C, 0x78,
-    0xB0, 0x55, 0xB6, 0x92, 0x85, 0x9A, 0xA4, 0x1B, 0x80, 0xC8, 0xA7, 0x1E, 0xF1, 0xCF, 0xC8, 0x8A,
-    0x42, 0x00, 0x30, 0xFC, 0xFC, 0xE1, 0xA7, 0x54, 0x9F, 0x11, 0x77, 0x8A, 0x43, 0x9F, 0xEF, 0xE0,
-    0xA8, 0xD0, 0xBD, 0x6E, 0x49, 0x6C, 0x8C, 0xD3, 0xC9, 0x1F, 0x2D, 0x60, 0x1B, 0x4E, 0xC2, 0x04,
-    0x6D, 0x69, 0x12, 0xB3, 0x8E, 0xD0, 0x5A, 0x28, 0xB8, 0x1A, 0x22, 0x6B, 0x64, 0x39, 0xC0, 0x35,
-    0xA7, 0x8C, 0x88, 0x35, 0x04, 0x7E, 0xC2, 0x6D, 0x06, 0x02, 0x6F, 0x62, 0xBC, 0xE8, 0xA2, 0x2F,
-    0xE0, 0x49, 0x37, 0x80, 0xE2, 0xD2, 0x05, 0x01, 0xF9, 0xD4, 0x13, 0xEC, 0x81, 0x29, 0xB2, 0x60,
-    0x4D, 0x65, 0x82, 0xAD, 0xAD, 0xEB, 0x67, 0xCF, 0x2F, 0x12, 0x88, 0x19, 0xB9, 0xCA, 0xCD, 0x10,
-    0xA8, 0x41, 0xBE, 0xAD, 0x39, 0x44, 0xAA, 0x58, 0xF2, 0x1C, 0x2D, 0x51, 0x64, 0x66, 0x5C, 0x9C,
-    0x73, 0xD0, 0xD2, 0xA4, 0x0C, 0xF6, 0xEC, 0x83, 0x2D, 0x4A, 0x9D, 0x96, 0x16, 0x2A, 0x73, 0x9A,
-    0xC7, 0x6C, 0xCA, 0xF7, 0x02, 0xE5, 0x37, 0xF7, 0xF6, 0x21, 0x19, 0x77, 0x60, 0xFD, 0xE0, 0xD3,
-    0xA7, 0x35, 0x2D, 0x99, 0xB1, 0x0D, 0xD2, 0x12, 0x6F, 0xE7, 0x60, 0x23, 0x26, 0xE8, 0x9C, 0x43,
-    0xC6, 0x01, 0x2C, 0x53, 0x40, 0x0E, 0x86, 0x60, 0xC8, 0x61, 0xD1, 0x1C, 0x43, 0x50, 0x96, 0x27,
-    0x9B, 0xF4, 0xFB, 0x82, 0x3C, 0xE9, 0x24, 0x98, 0x98, 0x76, 0x73, 0xEE, 0xA6, 0x70, 0x4F, 0x1A,
-    0x28, 0x1E, 0x75, 0xD8, 0x18, 0xE8, 0xD8, 0x63, 0x86, 0x53, 0xBE, 0x84, 0xE4, 0x2C, 0xE4, 0x02,
-    0xFD, 0x8A, 0xFC, 0xA2, 0x4E, 0x74, 0x48, 0x9F, 0x11, 0xA9, 0x2A, 0xC8, 0x17, 0x8D, 0x71, 0xA5,
-    0x79, 0xC2, 0x5A, 0xB8, 0x57, 0x33, 0x53, 0xC9, 0x28, 0x8C, 0x1B, 0xB2, 0x4C, 0x6F, 0x42, 0xF7,
-    0x11, 0xDC, 0x70, 0xB3, 0xAC, 0xA4, 0xA3, 0x25, 0x60, 0x4C, 0x2C, 0x66, 0x09, 0xD4, 0x42, 0x81,
-    0xC5, 0xE9, 0x27, 0xF8, 0xF5, 0xDD, 0x7C, 0x15, 0x6F, 0x2D, 0x11, 0xF9, 0xB9, 0x50, 0x5C, 0x74,
-    0x4A, 0x50, 0x74, 0xA5, 0x92, 0x43, 0xF6, 0xBB, 0x9B, 0x9A, 0x7D, 0x88, 0x58, 0x5D, 0xF8, 0x2C,
-    0x54, 0x5A, 0x80, 0x4A, 0xB1, 0x62, 0x29, 0x5F, 0xD6, 0x91, 0xDC, 0x3B, 0x14, 0x70, 0xD7, 0x00,
-    0x80, 0x85, 0x3C, 0xA0, 0xE6, 0x67, 0x85, 0x64, 0x75, 0xF5, 0xF3, 0x88, 0x67, 0x1F, 0xBA, 0x0A,
-    0x9E, 0x40, 0xE2, 0x3B, 0xD2, 0x6F, 0xD4, 0xE5, 0xBF, 0x19, 0x20, 0x2C, 0x69, 0xE7, 0x5A, 0x02,
-    0x32, 0xC0, 0x9B, 0xD5, 0xB8, 0xBC, 0x36, 0x20, 0x5F, 0xDA, 0x60, 0xC2, 0x42, 0x64, 0x4B, 0x3A,
-    0x90, 0x71, 0x92, 0x7B, 0xAE, 0x35, 0x43, 0x6C, 0x13, 0x84, 0x17, 0x18, 0x6F, 0x53, 0x34, 0x04,
-    0xD1, 0xFD, 0x69, 0x59, 0x79, 0x36, 0x3D, 0xC7, 0x2F, 0xDB, 0x82, 0xB3, 0xAB, 0xAF, 0x07, 0xBE,
-    0x0E, 0xFB, 0x10, 0x8B, 0x9C, 0xB3, 0x7F, 0xE3, 0x9C, 0x1F, 0xD4, 0x73, 0x86, 0xFE, 0x35, 0x3D,
-    0x60, 0x8B, 0xDC, 0xC4, 0xA2, 0x23, 0x96, 0xB6, 0x9C, 0x65, 0x2E, 0xA9, 0x8E, 0x98, 0x4C, 0x5C,
-    0x31, 0x50, 0xCC, 0x06, 0x65, 0x27, 0x6F, 0x62, 0xA3, 0xF0, 0x6B, 0xBA, 0xB4, 0x56, 0x98, 0x9E,
-    0x61, 0x8D, 0xA6, 0x1B, 0x52, 0x88, 0x69, 0x5D, 0x83, 0x00, 0xCF, 0x59, 0xB1, 0x77, 0x51, 0x91,
-    0x4E, 0x27, 0x2C, 0x3C, 0x2A, 0x91, 0x96, 0xBB, 0x09, 0x5C, 0xB3, 0x11, 0x16, 0xD9, 0xAA, 0x76,
-    0x9E, 0xAB, 0xDC, 0x5E, 0x33, 0x82, 0xE0, 0x1B, 0x37, 0x1B, 0xAA, 0xA5, 0x5B, 0xD0, 0x9A, 0x6C,
-    0xDA, 0x5F, 0xF6, 0x0A, 0xE5, 0xED, 0x89, 0x4E, 0x2F, 0xE9, 0xF1, 0xB4, 0x22, 0x76, 0xC6, 0x17,
-    0xA7, 0x59, 0xFD, 0x39, 0x99, 0xA1, 0x82, 0xE7, 0xB2, 0x02, 0xE9, 0x50, 0x6E, 0xD6, 0x2C, 0x59,
-    0x3F, 0x39, 0x9D, 0x4D, 0xFB, 0x51, 0x87, 0x9C, 0x8E, 0x3F, 0xBA, 0x69, 0xC9, 0x02, 0x8D, 0x67,
-    0xB2, 0xFF, 0x6E, 0x53, 0xE4, 0x89, 0x3C, 0x7B, 0xDC, 0xA6, 0xE0, 0x73, 0x99, 0xC3, 0x9A, 0x96,
-    0x0B, 0x20, 0x26, 0x66, 0x47, 0x91, 0xBA, 0xD3, 0x49, 0xD2, 0x7E, 0xFB, 0x22, 0xCA, 0xDD, 0x15,
-    0x08, 0xB3, 0x09, 0x7B, 0x2F, 0xD3, 0xC0, 0x85, 0xF0, 0x19, 0x60, 0x7D, 0xC8, 0x16, 0xE5, 0xAA,
-    0x26, 0x16, 0xA3, 0x62, 0xEE, 0xFD, 0x21, 0xB2, 0x20, 0x9A, 0xD7, 0x07, 0x64, 0x69, 0x8B, 0x19,
-    0x30, 0x5D, 0x05, 0x37, 0xC4, 0x5D, 0xD4, 0xE4, 0xA0, 0x50, 0x54, 0xF7, 0x5C, 0xDE, 0x8F, 0xDB,
-    0xC4, 0x62, 0x26, 0x98, 0xE8, 0xA0, 0xEC, 0xD1, 0xDF, 0x26, 0xF1, 0xD4, 0x16, 0x2B, 0x52, 0xAF,
-    0x52, 0xCF, 0x84, 0xBA, 0x84, 0xD5, 0xB9, 0x68, 0xC6, 0x8A, 0x31, 0xED, 0x52, 0x72, 0xC2, 0x2E,
-    0xBA, 0xCF, 0xD9, 0x91, 0xCE, 0x4C, 0xDF, 0xA2, 0x0B, 0x2D, 0xED, 0xD8, 0x83, 0x9F, 0x53, 0xE7,
-    0xCB, 0x29, 0xA9, 0xA3, 0x2C, 0xF6, 0x98, 0x12, 0x24, 0x49, 0xD4, 0x36, 0x1A, 0x05, 0xCF, 0x70,
-    0x60, 0xF5, 0x23, 0xC7, 0x35, 0xF0, 0x8B, 0x4F, 0xDF, 0x92, 0x15, 0x8F, 0xC0, 0x1A, 0x90, 0xBE,
-    0xBE, 0x73, 0xA4, 0xE2, 0x8F, 0xC1, 0x16, 0xB0, 0x6A, 0x25, 0x6C, 0x91, 0xA3, 0x53, 0xA0, 0x21,
-    0xF4, 0x5D, 0xA8, 0xE6, 0x48, 0x78, 0x36, 0x18, 0x7B, 0x71, 0x36, 0x3B, 0x18, 0x7C, 0x83, 0x31,
-    0x3B, 0x70, 0xEF, 0x82, 0x77, 0x07, 0xB6, 0x07, 0x95, 0x7C, 0xC7, 0x4D, 0xB3, 0x5B, 0xAC, 0x53,
-    0x36, 0x7D, 0xB0, 0xB5, 0xB5, 0xA9, 0x62, 0x95, 0xF7, 0xB4, 0xB5, 0xD3, 0xBB, 0x44, 0x7B, 0xCC,
-    0x87, 0xE8, 0xFC, 0x0C, 0x55, 0xF4, 0xE5, 0x3B, 0xD8, 0x7C, 0x1C, 0x9E, 0x43, 0x25, 0xC6, 0x7D,
-    0xDF, 0xEF, 0xA5, 0xEE, 0x11, 0xD4, 0xFE, 0xA8, 0xBB, 0x2C, 0x53, 0xD8, 0x82, 0x4C, 0x81, 0x65,
-    0x0D, 0x4E, 0xD2, 0x46, 0xAC, 0xBA, 0x68, 0x96, 0xB2, 0x2A, 0x2E, 0x7C, 0x6C, 0x74, 0x28, 0xD9,
-    0x39, 0x1D, 0x33, 0xC6, 0x1A, 0xB4, 0x63, 0x59, 0x5F, 0x0E, 0xA5, 0xB0, 0x21, 0xA7, 0xF4, 0xBC,
-    0x61, 0x5B, 0xCC, 0x1E, 0x3C, 0x9E, 0x1E, 0x1C, 0x72, 0x1F, 0x55, 0xE3, 0xD3, 0x65, 0x13, 0x68,
-    0x9A, 0x55, 0x5C, 0xA2, 0x02, 0xA2, 0x4D, 0x83, 0x07, 0x2C, 0xD3, 0x74, 0xEF, 0x00, 0xAA, 0xC1,
-    0x87, 0x4C, 0xE7, 0xAA, 0x1B, 0x27, 0x37, 0x4E, 0xC0, 0xB3, 0xCC, 0x95, 0x91, 0xB9, 0xB2, 0x47,
-    0xBA, 0xCC, 0x98, 0x0B, 0x68, 0xF7, 0x80, 0x1F, 0xCE, 0x04, 0x03, 0x67, 0x76, 0xFD, 0x4C, 0xFE,
-    0xE4, 0x0C, 0xB3, 0x04, 0xDC, 0x7C, 0x8D, 0x9D, 0x96, 0xE3, 0xF3, 0x5A, 0xB3, 0xEE, 0x5C, 0x93,
-    0xFA, 0x9C, 0xB6, 0x36, 0xB5, 0xF6, 0xBD, 0xEE, 0xF6, 0xA8, 0x08, 0x79, 0x7A, 0xE9, 0x42, 0xEF,
-    0xCD, 0x27, 0x46, 0xFF, 0x3C, 0xE9, 0xCF, 0xA8, 0x00, 0x60, 0xD2, 0x47, 0x99, 0x92, 0x98, 0x71,
-    0xBE, 0xFD, 0xD6, 0x0D, 0xB2, 0xE6, 0xD2, 0x4B, 0xD5, 0x3B, 0x69, 0x93, 0x7F, 0xF8, 0xD5, 0x98,
-    0x34, 0x3F, 0xB7, 0xF3, 0xE7, 0xD3, 0xE6, 0x17, 0xED, 0xF6, 0xF3, 0x59, 0x95, 0x37, 0xEF, 0x3D,
-    0x0F, 0x2F, 0xB6, 0x76, 0x0D, 0x47, 0x16, 0x77, 0x5A, 0xA3, 0x40, 0x1F, 0x68, 0xB6, 0x04, 0x27,
-    0xAF, 0x41, 0x7A, 0xD8, 0xFC, 0x0C, 0x19, 0x1D, 0x56, 0x3F, 0x12, 0x45, 0xE1, 0x9B, 0xF8, 0xFE,
-    0x9D, 0xC4, 0xBF, 0xD2, 0xF9, 0x5B, 0xB3, 0xD9, 0xEC, 0x7B, 0x78, 0xF0, 0x0F, 0x7D, 0x98, 0x34,
-    0x9E, 0x4C, 0x94, 0x46, 0xE7, 0x4B, 0xA0, 0xFF, 0xDF, 0x87, 0x2C, 0x76, 0xFF, 0xFB, 0x10, 0x82,
-    0x08, 0xF5, 0xE6, 0x15, 0xC7, 0xA3, 0x40, 0xB7, 0xA4, 0x97, 0xBC, 0x08, 0x97, 0x40, 0xEF, 0xFC,
-    0x83, 0x63, 0xDA, 0x26, 0xC1, 0x0F, 0x60, 0x25, 0xAB, 0x67, 0xBE, 0xBF, 0x2C, 0x9E, 0xE3, 0xEA,
-    0x0C, 0x65, 0x97, 0x2F, 0x51, 0xA8, 0x02, 0xB9, 0x5C, 0xFA, 0x4C, 0xEB, 0x29, 0x0F, 0x88, 0xE7,
-    0x4B, 0xD6, 0x45, 0xE0, 0xEB, 0x57, 0x13, 0xBD, 0xBF, 0xAF, 0x27, 0x52, 0xE5, 0xAF, 0xB4, 0x06,
-    0x95, 0x5C, 0x7B, 0x58, 0x77, 0x5A, 0x73, 0x83, 0x1A, 0x98, 0x29, 0xF1, 0x7A, 0xF8, 0x85, 0x95,
-    0x4B, 0x95, 0x36, 0x13, 0xAC, 0x1C, 0x2C, 0x07, 0x8D, 0x56, 0xC7, 0x3D, 0xD6, 0x0B, 0x34, 0x55,
-    0x68, 0x20, 0x63, 0x24, 0xE7, 0x6D, 0xA4, 0x08, 0xBD, 0x12, 0x91, 0xB6, 0x64, 0xF3, 0x2C, 0xCE,
-    0x99, 0xB6, 0xAE, 0x4C, 0xFC, 0xB0, 0xA3, 0xF9, 0xEB, 0x3C, 0x1B, 0x9A, 0x66, 0x87, 0x07, 0x00,
-    0x9E, 0x07, 0xCC, 0x34, 0xCD, 0x66, 0xCC, 0x4B, 0x18, 0x96, 0xA9, 0x5F, 0x33, 0xD2, 0x6D, 0x08,
-    0xF3, 0xD6, 0x89, 0xF2, 0xB0, 0x35, 0x77, 0x9A, 0xEA, 0x8A, 0xEC, 0xEC, 0x6E, 0x84, 0x4D, 0x7C,
-    0xDF, 0xF5, 0xEB, 0x52, 0xBF, 0xF5, 0xF1, 0xFD, 0x22, 0x6E, 0x5F, 0x4B, 0x3B, 0xA6, 0xFA, 0x65,
-    0xA9, 0x89, 0x90, 0x35, 0xE5, 0xC1, 0x97, 0x7D, 0x09, 0x3C, 0x79, 0x55, 0x8F, 0x61, 0x74, 0x86,
-    0x8F, 0x9E, 0xD7, 0xC7, 0x37, 0x5B, 0xD1, 0xB9, 0x31, 0x6E, 0x1F, 0xD7, 0x23, 0x3F, 0x6A, 0x36,
-    0x5F, 0xA0, 0xF5, 0x81, 0xF3, 0x34, 0x4C, 0x9D, 0xF2, 0x2E, 0xD7, 0x96, 0x73, 0x4F, 0x16, 0xF0,
-    0xE8, 0x5C, 0xF6, 0xC0, 0x1B, 0x30, 0xDA, 0x58, 0x3D, 0x0F, 0xB0, 0xF5, 0xCC, 0x51, 0x10, 0x07,
-    0xD9, 0xD3, 0x86, 0x61, 0x8E, 0xDE, 0x71, 0x53, 0x16, 0x8A, 0xDC, 0x51, 0x05, 0x8E, 0xF4, 0x3E,
-    0x1A, 0x13, 0xE5, 0x99, 0xDC, 0x57, 0x21, 0xF0, 0xF4, 0x3E, 0xB5, 0xE4, 0xA1, 0xF3, 0xB6, 0x63,
-    0x97, 0x86, 0xB6, 0x0E, 0x0A, 0x65, 0xE8, 0xB0, 0x45, 0x25, 0x2B, 0xE9, 0x31, 0xED, 0x95, 0x0A,
-    0xD8, 0xBC, 0xE1, 0x71, 0x8A, 0xDD, 0x2E, 0xD4, 0x1D, 0xF5, 0x6A, 0x23, 0x25, 0xDE, 0x1B, 0x9F,
-    0x6D, 0x3E, 0x71, 0x78, 0x74, 0xB3, 0x8A, 0xC8, 0x42, 0x1E, 0xDE, 0xF8, 0xEC, 0xFA, 0xF9, 0x19,
-    0x5F, 0x35, 0xB2, 0xF3, 0x47, 0xC5, 0xB0, 0xE5, 0xEC, 0x3A, 0x09, 0xDB, 0xDC, 0xA1, 0x4B, 0x4A,
-    0x92, 0x78, 0x4D, 0xA5, 0x4A, 0xC2, 0x2F, 0x75, 0xE6, 0x4F, 0x12, 0x0D, 0x3C, 0xF1, 0x2F, 0x5E,
-    0x20, 0x1B, 0xFD, 0x12, 0xE4, 0x12, 0xD9, 0x2B, 0x58, 0x70, 0x6C, 0x1A, 0x82, 0x61, 0xFD, 0x85,
-    0xA5, 0x70, 0x35, 0xD4, 0xF7, 0x14, 0xBA, 0x45, 0xD0, 0x9F, 0x3D, 0xF5, 0x2F, 0xF8, 0x1C, 0x2E,
-    0x75, 0xDB, 0x61, 0x55, 0x14, 0x82, 0x59, 0x3D, 0xCD, 0xF4, 0x14, 0x60, 0x8D, 0xEF, 0xAD, 0x7C,
-    0xA8, 0xD8, 0x52, 0x6D, 0x83, 0xDB, 0xE2, 0x97, 0x61, 0xBC, 0x53, 0x46, 0xD5, 0x7E, 0xB2, 0x40,
-    0xBF, 0x36, 0x6A, 0xA7, 0x06, 0x87, 0x2C, 0xB4, 0xE5, 0x45, 0xE0, 0x48, 0x52, 0x59, 0x85, 0x16,
-    0xC8, 0x9A, 0xE9, 0x60, 0xD4, 0xD6, 0x51, 0x17, 0xE0, 0xE4, 0xB6, 0x7A, 0x2F, 0xEE, 0x08, 0x5B,
-    0x36, 0xC4, 0x1D, 0x0A, 0xEA, 0x71, 0xD8, 0x6B, 0x91, 0x88, 0x06, 0x73, 0x7A, 0xDB, 0xD1, 0xD6,
-    0x2A, 0x66, 0x6D, 0x30, 0x1F, 0x40, 0xC9, 0x75, 0xEC, 0x1B, 0xF1, 0xCF, 0x93, 0xCB, 0x60, 0xED,
-    0xFF, 0x00, 0x63, 0x0D, 0x75, 0xFA, 0xFF, 0xC7, 0xFE, 0xFF, 0xC1, 0xD0, 0x10, 0x00, 0x45, 0xCF,
-    0xBD, 0x09, 0x02, 0x41, 0x10, 0xC5, 0xF1, 0x07, 0x07, 0x1A, 0x88, 0x4C, 0x09, 0x96, 0x70, 0x89,
-    0xF9, 0x6C, 0x1F, 0x57, 0x8C, 0x96, 0x63, 0x17, 0xA7, 0x9D, 0x5C, 0x60, 0x01, 0x17, 0x6C, 0x60,
-    0x32, 0x3C, 0xE7, 0x63, 0xD1, 0x4D, 0x7E, 0xFC, 0xE1, 0x31, 0xB0, 0xC0, 0xEF, 0x9D, 0x87, 0x56,
-    0xC8, 0x90, 0xA5, 0x0C, 0x59, 0xCA, 0xFB, 0x90, 0x7E, 0x6A, 0x2F, 0x5B, 0xC9, 0xD7, 0x63, 0xB2,
-    0x18, 0xAF, 0xFD, 0x64, 0x31, 0xE6, 0x36, 0x9B, 0x27, 0x19, 0x77, 0x9C, 0xFD, 0x48, 0xCB, 0xBC,
-    0xD1, 0x34, 0x93, 0xDD, 0xBD, 0xAF, 0x64, 0x53, 0xDA, 0xE4, 0x09, 0x65, 0xBF, 0x78, 0xBA, 0x8C,
-    0x2C, 0x5B, 0xB8, 0x44, 0x42, 0x77, 0x89, 0x84, 0x3E, 0xE7, 0x48, 0x28, 0x32, 0xA1, 0x4B, 0xA6,
-    0xEF, 0x5A, 0x59, 0x09, 0xAD, 0xC4, 0xF5, 0xFF, 0x57, 0x7C, 0x01,
+static const uint8_t notosans_16_italicBitmaps[37043] = {
+    0xCD, 0x9B, 0x3D, 0xAC, 0x25, 0xC7, 0x95, 0xDF, 0x7F, 0xD5, 0xC5, 0x99, 0x16, 0xD4, 0x41, 0x31,
+    0xE0, 0x7A, 0x0D, 0x12, 0xDE, 0x4A, 0xD6, 0xC6, 0x4A, 0x80, 0xD8, 0xA9, 0x03, 0xBE, 0x5B, 0x4D,
+    0x12, 0x58, 0x06, 0x0A, 0x34, 0x06, 0xF8, 0x24, 0x18, 0x0C, 0x94, 0x38, 0xF0, 0xCA, 0x80, 0x27,
+    0x51, 0xA0, 0xE0, 0xBD, 0xDB, 0x2D, 0x0B, 0x36, 0x03, 0x06, 0x1A, 0x07, 0xAB, 0x0D, 0x1C, 0x58,
+    0x01, 0x6D, 0x53, 0xC3, 0x80, 0x09, 0x03, 0x02, 0xBE, 0xF7, 0xDD, 0xD2, 0x32, 0x60, 0xA0, 0x80,
+    0xCD, 0xD5, 0xCA, 0x0A, 0x36, 0x60, 0x59, 0x1A, 0x1A, 0x58, 0x6E, 0xC0, 0x92, 0xD4, 0xB3, 0x53,
+    0x43, 0x55, 0xDF, 0xE3, 0xA0, 0xFA, 0xBE, 0x8F, 0xE1, 0x8C, 0x76, 0x2D, 0x88, 0x16, 0x2F, 0xDE,
+    0xCC, 0xBD, 0xB7, 0xAB, 0x6E, 0x7D, 0x9C, 0x53, 0x75, 0xFE, 0xFF, 0x73, 0x4E, 0x15, 0xD6, 0x57,
+    0x19, 0x37, 0xE8, 0x09, 0x47, 0x1D, 0x39, 0xA3, 0x19, 0xC9, 0x18, 0x4F, 0xC2, 0x76, 0x55, 0xC4,
+    0xA1, 0x03, 0x47, 0xD4, 0x9E, 0x27, 0x00, 0xC0, 0x76, 0x3A, 0xD3, 0x7B, 0x3D, 0xF1, 0x18, 0x98,
+    0x6F, 0x4F, 0xEB, 0xE6, 0xAF, 0x26, 0xD7, 0xF8, 0xEC, 0xF4, 0x38, 0x19, 0xED, 0x4F, 0x8C, 0x0A,
+    0xDF, 0xAC, 0x3B, 0x38, 0xE2, 0x4D, 0xB0, 0x3C, 0x03, 0x8D, 0xB7, 0xA0, 0xC7, 0x66, 0x80, 0xA8,
+    0x47, 0x38, 0x51, 0x11, 0x56, 0x6C, 0xF8, 0xE2, 0x1B, 0x1F, 0xEE, 0x6E, 0x1B, 0x11, 0x91, 0x6F,
+    0x7F, 0xED, 0xEE, 0xD7, 0x7F, 0x72, 0x83, 0x49, 0x07, 0x78, 0x86, 0x09, 0x2C, 0x27, 0x60, 0x86,
+    0xA7, 0x41, 0x8F, 0x66, 0xD0, 0x22, 0x22, 0x51, 0x44, 0x24, 0x73, 0x44, 0x02, 0xC3, 0x11, 0xD4,
+    0xDE, 0x82, 0x0E, 0xCD, 0x00, 0xD3, 0x79, 0xBB, 0x4F, 0xB3, 0x01, 0x50, 0x80, 0x1E, 0x81, 0x08,
+    0x6A, 0x0B, 0x8D, 0xEC, 0xB1, 0x22, 0xDE, 0xFC, 0xF8, 0xBD, 0xD0, 0x8C, 0x11, 0x1D, 0x4F, 0x20,
+    0x3D, 0x0D, 0xAE, 0xE9, 0x68, 0x7E, 0xEE, 0x41, 0x22, 0x18, 0xE9, 0xA0, 0x4F, 0x60, 0x64, 0x40,
+    0xBF, 0x1D, 0x21, 0x9E, 0xC2, 0xB7, 0x6C, 0xC7, 0xD3, 0xCD, 0xD8, 0x99, 0x17, 0xE2, 0xEA, 0xF9,
+    0xBF, 0x99, 0x8C, 0xC8, 0xA4, 0x76, 0x12, 0x60, 0x0D, 0x18, 0x40, 0x7B, 0x50, 0x91, 0xC3, 0xAB,
+    0x1F, 0xA9, 0x42, 0x25, 0x91, 0xC6, 0xD7, 0x21, 0x61, 0x3B, 0x33, 0x6C, 0x58, 0x61, 0xD9, 0xB0,
+    0xE1, 0x69, 0x36, 0x2A, 0x72, 0xC4, 0x5B, 0x7A, 0xE4, 0x88, 0x64, 0x06, 0x4E, 0x98, 0x5A, 0x38,
+    0x51, 0xF1, 0xE4, 0xC9, 0xEE, 0x44, 0x87, 0x49, 0xE2, 0x51, 0xFD, 0xF6, 0xCF, 0x3F, 0x4E, 0xEE,
+    0xE6, 0x2B, 0xEF, 0x8C, 0x1B, 0xBB, 0xB7, 0x66, 0x38, 0xB9, 0x7E, 0xE7, 0xC8, 0x72, 0x02, 0xA9,
+    0xE5, 0x84, 0x2A, 0xAE, 0xD8, 0x50, 0xFB, 0x23, 0xDE, 0xC2, 0x74, 0x47, 0x4C, 0xAC, 0x38, 0x52,
+    0x91, 0x0D, 0x47, 0x3A, 0xA8, 0x88, 0x6B, 0xBC, 0x1E, 0xB1, 0xD2, 0x99, 0x81, 0x66, 0x06, 0xE0,
+    0xC6, 0x61, 0x6C, 0xED, 0x0C, 0xF4, 0x32, 0x42, 0xFF, 0x9F, 0x32, 0xB8, 0xAE, 0xED, 0x30, 0xBE,
+    0x1E, 0xD1, 0x41, 0x4D, 0x90, 0xC8, 0xE0, 0x38, 0x83, 0xE6, 0x87, 0x7B, 0x50, 0x32, 0x03, 0x2E,
+    0x01, 0xED, 0x04, 0xEC, 0x04, 0xD5, 0xED, 0xBE, 0x1C, 0x74, 0x3C, 0x23, 0xAB, 0xD4, 0x63, 0x7D,
+    0x6E, 0xBB, 0x2A, 0x6D, 0x8D, 0xC7, 0x9D, 0xE9, 0x88, 0x16, 0x32, 0x08, 0xED, 0x80, 0x04, 0x7D,
+    0xFF, 0xFA, 0x7E, 0x66, 0x27, 0xB3, 0xF5, 0xB5, 0xA4, 0x2A, 0x73, 0xAD, 0x03, 0xCC, 0xCB, 0x3F,
+    0x9B, 0x36, 0xCE, 0x3C, 0xEF, 0xE3, 0x37, 0x81, 0xB7, 0xA8, 0x22, 0xCD, 0x88, 0x1D, 0x70, 0xB0,
+    0x45, 0x25, 0x74, 0xA4, 0x0E, 0x18, 0x8F, 0xF1, 0xD8, 0x0E, 0x07, 0x0E, 0x56, 0x70, 0x0A, 0x5B,
+    0xD8, 0x5C, 0xFD, 0x3B, 0x85, 0x53, 0x58, 0x81, 0x83, 0x16, 0x4C, 0x47, 0x33, 0xA0, 0x3A, 0xD0,
+    0x1E, 0x1D, 0xA8, 0x22, 0x4C, 0x90, 0x20, 0x5F, 0xFA, 0xD1, 0xF6, 0xF0, 0xB7, 0x81, 0xBC, 0xFC,
+    0xA9, 0x44, 0x35, 0x5D, 0xEA, 0x7B, 0xA0, 0x85, 0x35, 0x64, 0xAA, 0x89, 0x3A, 0x60, 0x06, 0x1C,
+    0x65, 0x0F, 0x74, 0x40, 0x06, 0x12, 0xA8, 0xC8, 0x1F, 0xAB, 0x88, 0x7B, 0x36, 0xD0, 0xFF, 0xBD,
+    0xE7, 0xBA, 0xFC, 0xDD, 0x1E, 0x23, 0x7B, 0xDA, 0xF0, 0xAF, 0xC9, 0x11, 0x1D, 0x27, 0xCC, 0xB8,
+    0xC1, 0x0C, 0xA7, 0x54, 0x38, 0xE0, 0x0B, 0x65, 0x59, 0x3E, 0xE2, 0xDF, 0x4E, 0x44, 0x76, 0x22,
+    0x72, 0xFC, 0xB5, 0x0F, 0x8E, 0x1F, 0x59, 0x4F, 0x75, 0xA8, 0x5C, 0x25, 0x1D, 0xEB, 0x60, 0xBC,
+    0x19, 0x5A, 0x8E, 0x78, 0x82, 0x6B, 0xC7, 0xCF, 0x49, 0x76, 0xF2, 0xC3, 0xE3, 0x17, 0xA9, 0x7F,
+    0x3C, 0x8B, 0x7B, 0xB6, 0x6C, 0x55, 0x30, 0x1E, 0x9A, 0x11, 0x74, 0x84, 0x6A, 0x5A, 0x46, 0x9E,
+    0x29, 0x8B, 0xD7, 0x01, 0x76, 0xF8, 0x2D, 0x2B, 0xA9, 0x7C, 0xB1, 0xE2, 0x13, 0xEC, 0xC4, 0x23,
+    0x7F, 0x91, 0xD8, 0xE1, 0xE8, 0x69, 0x46, 0xD7, 0xA9, 0x64, 0x3D, 0xAE, 0x19, 0x31, 0x6F, 0x47,
+    0xF4, 0x2F, 0x32, 0x2A, 0xAD, 0x61, 0xDD, 0x76, 0xD8, 0xEF, 0x7A, 0x9A, 0x1F, 0x47, 0x74, 0xCC,
+    0x90, 0x1D, 0xAC, 0x8D, 0xA7, 0x7D, 0x3E, 0x62, 0x7C, 0xA6, 0x09, 0xAE, 0xD3, 0xB1, 0x0E, 0x3A,
+    0xB1, 0x7F, 0x21, 0x63, 0x25, 0xA1, 0x64, 0x02, 0xD5, 0x01, 0x2A, 0xD1, 0x86, 0x5A, 0x3A, 0xC9,
+    0xED, 0xBD, 0xB8, 0xB7, 0xDF, 0x1E, 0x4F, 0xA9, 0x22, 0xC6, 0xE3, 0x50, 0x89, 0x66, 0xC4, 0x41,
+    0x46, 0x07, 0xEC, 0xC0, 0x16, 0x1D, 0x31, 0x9E, 0x35, 0xD5, 0x44, 0xE3, 0x4B, 0x51, 0x79, 0x3D,
+    0x25, 0x03, 0x56, 0x84, 0x7A, 0xFF, 0x52, 0xE6, 0x4B, 0xD8, 0x11, 0x38, 0x03, 0xEA, 0xB0, 0x7C,
+    0x68, 0xC6, 0x45, 0x02, 0x6D, 0x07, 0x75, 0x5C, 0x66, 0xDB, 0x03, 0xAD, 0x87, 0x26, 0x42, 0x95,
+    0x01, 0x01, 0xDC, 0x00, 0x26, 0x80, 0x9E, 0x40, 0xCD, 0x40, 0xFF, 0xE1, 0xED, 0xD7, 0x1A, 0x11,
+    0xF1, 0x22, 0x72, 0xE8, 0xD0, 0xCA, 0x40, 0x7B, 0xD1, 0xA1, 0x19, 0x81, 0xED, 0xA1, 0x9F, 0x2D,
+    0x45, 0xBA, 0x55, 0x2A, 0xBD, 0x7F, 0x43, 0x06, 0x8C, 0x74, 0xCB, 0xF6, 0x6B, 0x26, 0xC0, 0xFA,
+    0xA5, 0x5E, 0x1D, 0x16, 0xB5, 0x34, 0x01, 0xC8, 0x0A, 0x5A, 0xBF, 0xBE, 0x71, 0x33, 0xD6, 0x22,
+    0x99, 0xA7, 0x64, 0x06, 0x55, 0x36, 0xBB, 0x19, 0x41, 0x67, 0x40, 0x3C, 0xB4, 0x19, 0x9A, 0xF7,
+    0x07, 0x54, 0x9A, 0xA0, 0x6F, 0x29, 0x2A, 0x89, 0x0E, 0xE6, 0x3A, 0xD0, 0x76, 0x5B, 0x9A, 0xD0,
+    0x78, 0x95, 0xC8, 0x38, 0xCC, 0x60, 0xBC, 0x4A, 0x3A, 0xD2, 0x76, 0xBD, 0x88, 0xFC, 0x5A, 0x44,
+    0xF6, 0xDF, 0xB8, 0xFD, 0xFA, 0xC7, 0x03, 0x9C, 0x02, 0x8D, 0x5F, 0x44, 0x63, 0x3C, 0xA8, 0x04,
+    0x46, 0x64, 0xA8, 0x45, 0x82, 0x16, 0x99, 0x48, 0x94, 0x5A, 0xED, 0x52, 0x41, 0x87, 0xC5, 0x36,
+    0xCE, 0x7F, 0x06, 0x4E, 0x12, 0x46, 0xC4, 0x2F, 0x93, 0xDA, 0x1D, 0xEA, 0xC4, 0xA5, 0x45, 0xB7,
+    0xCC, 0xD4, 0x8C, 0x1D, 0x4D, 0x5C, 0x75, 0x37, 0xA3, 0x11, 0x89, 0xEC, 0x64, 0x84, 0x17, 0xCF,
+    0x57, 0xDB, 0x53, 0xE2, 0x71, 0x12, 0xE9, 0x3F, 0xF8, 0x37, 0xF4, 0x03, 0xB8, 0xAE, 0xFC, 0x3B,
+    0x2C, 0xD2, 0x3A, 0x40, 0x35, 0xDD, 0x0C, 0x64, 0x11, 0xDC, 0x7C, 0x33, 0xDA, 0x89, 0xB9, 0x89,
+    0xB4, 0xDF, 0x49, 0xD4, 0x21, 0x43, 0xBA, 0xB2, 0xE2, 0xB6, 0xD4, 0xC1, 0x7A, 0x1D, 0xF5, 0xDC,
+    0x24, 0x9C, 0x24, 0x2A, 0x99, 0xE0, 0x5A, 0x07, 0x46, 0x44, 0xBE, 0x23, 0x22, 0xEF, 0x89, 0xC8,
+    0x54, 0xE6, 0x7A, 0x65, 0x57, 0xB4, 0xCB, 0xFE, 0x32, 0x63, 0xE9, 0x54, 0xC7, 0x45, 0x87, 0x79,
+    0x51, 0x56, 0xFF, 0x88, 0xED, 0xA3, 0x2F, 0xB7, 0x76, 0x58, 0x20, 0x1D, 0x46, 0xF6, 0xE8, 0xF9,
+    0xA5, 0x89, 0x1E, 0xEB, 0x8D, 0x27, 0x93, 0x31, 0x87, 0x0F, 0x76, 0x68, 0x42, 0x1D, 0x71, 0xCF,
+    0x65, 0x90, 0x3D, 0x34, 0x02, 0x8D, 0x24, 0xEA, 0x64, 0x22, 0x33, 0x6E, 0x70, 0x1D, 0x59, 0x47,
+    0x8C, 0x5F, 0xC3, 0xB6, 0x0E, 0xE5, 0x43, 0xD6, 0x13, 0x6E, 0x68, 0x83, 0x8D, 0x88, 0x64, 0x2A,
+    0xD9, 0x73, 0x21, 0x4A, 0xB5, 0x9B, 0xA8, 0x44, 0x06, 0xBD, 0x7F, 0x69, 0xAA, 0x32, 0x3D, 0x19,
+    0xE3, 0xB7, 0x54, 0x93, 0x83, 0xED, 0x22, 0x9F, 0x66, 0xCC, 0xE8, 0xC9, 0xA1, 0x72, 0x13, 0x94,
+    0xA8, 0xFD, 0x9F, 0x8A, 0x6F, 0xE5, 0x5E, 0x50, 0xF2, 0x57, 0xD3, 0x83, 0x36, 0xC2, 0x97, 0x49,
+    0xDA, 0x70, 0xFD, 0x5F, 0xF5, 0x41, 0x89, 0x8C, 0xF4, 0x32, 0x2C, 0xBD, 0x3D, 0xCE, 0x5C, 0xCD,
+    0xD5, 0xAC, 0x12, 0x0F, 0x79, 0xD9, 0xCE, 0xF9, 0xDE, 0xBB, 0xEE, 0x31, 0x50, 0x30, 0xD3, 0x8E,
+    0xD5, 0x8C, 0x1D, 0x78, 0xD4, 0xCB, 0x7A, 0x9D, 0x70, 0x85, 0xA9, 0xD8, 0x4E, 0x07, 0x4E, 0x50,
+    0xE7, 0x85, 0xD5, 0xB2, 0x3F, 0xDB, 0x04, 0xBB, 0x40, 0x25, 0x1D, 0xCD, 0x5C, 0xF0, 0xAB, 0x1F,
+    0xA1, 0x1D, 0xA1, 0x96, 0x0E, 0x9A, 0xFD, 0x39, 0x1C, 0x26, 0x50, 0xBB, 0xB0, 0x6C, 0xE9, 0xFA,
+    0xC2, 0xAA, 0x89, 0x48, 0x2F, 0x22, 0x0F, 0x76, 0xFF, 0x8D, 0xDB, 0xB7, 0x7F, 0xB0, 0x94, 0xED,
+    0x01, 0xFE, 0x64, 0xD9, 0x8D, 0x4A, 0x06, 0xA8, 0xF7, 0x80, 0x4D, 0xC0, 0xCD, 0x00, 0xEC, 0x06,
+    0xA8, 0xF6, 0xC5, 0x6C, 0xA8, 0xDD, 0x48, 0x2D, 0x1D, 0x6D, 0x42, 0x49, 0xA0, 0x96, 0x8E, 0xEA,
+    0x3E, 0xF0, 0xFD, 0x2B, 0x73, 0x93, 0xAE, 0x15, 0x51, 0xFB, 0x97, 0xD2, 0xE7, 0xB0, 0x1E, 0x72,
+    0x11, 0x6A, 0x06, 0x3B, 0xA0, 0x23, 0xEC, 0xA1, 0x1F, 0x68, 0x03, 0xCD, 0x84, 0xCA, 0xE0, 0xA0,
+    0xF6, 0xB0, 0xE1, 0x92, 0x0C, 0xD4, 0x04, 0x6E, 0xA0, 0x4E, 0xD0, 0x2F, 0x86, 0x13, 0xBE, 0xF1,
+    0xB7, 0x00, 0x37, 0x45, 0x06, 0x30, 0xFB, 0xEF, 0xED, 0x46, 0xD4, 0x1E, 0xEC, 0x48, 0x3B, 0x80,
+    0xF1, 0x55, 0x02, 0x6C, 0x67, 0x07, 0x1E, 0xC7, 0x91, 0xE8, 0xA5, 0x3B, 0x69, 0x7C, 0x23, 0xC2,
+    0xB4, 0xE2, 0x8C, 0x49, 0xBF, 0x17, 0x9B, 0xB1, 0xF6, 0xE6, 0xCB, 0x7E, 0x45, 0xCB, 0xD1, 0x4A,
+    0x45, 0x12, 0x71, 0x32, 0x5E, 0x8F, 0xF5, 0xDB, 0xE3, 0x0A, 0x4B, 0x6B, 0xBA, 0x44, 0x66, 0x3A,
+    0xD2, 0xA1, 0x8E, 0x8D, 0x9F, 0x8C, 0xEF, 0xFD, 0xA9, 0x0E, 0xF6, 0xA3, 0x77, 0x3F, 0x0A, 0xC6,
+    0xB7, 0xD9, 0xCE, 0xD8, 0xEE, 0x1A, 0xD7, 0x3A, 0x5C, 0x19, 0xE6, 0xBA, 0xBC, 0xED, 0xCA, 0xD0,
+    0x77, 0x7F, 0xFD, 0x4F, 0x72, 0x91, 0x7A, 0x04, 0x9E, 0x92, 0x3B, 0x97, 0xC5, 0xE2, 0x00, 0x76,
+    0x1D, 0x20, 0x1D, 0x68, 0x19, 0xA0, 0x7E, 0x7F, 0x00, 0xF3, 0xAE, 0x07, 0xFB, 0x5D, 0x0F, 0xAE,
+    0xF1, 0xB0, 0x6E, 0x3C, 0xE4, 0x66, 0xA4, 0x9A, 0xEA, 0x11, 0x1D, 0xEB, 0x40, 0x33, 0xEA, 0x80,
+    0xF1, 0x3A, 0xD2, 0x8A, 0xC4, 0xD2, 0xFC, 0xFE, 0xF6, 0xEB, 0x51, 0x65, 0xAA, 0x49, 0x47, 0xAA,
+    0xA9, 0x0E, 0xA8, 0x64, 0x3C, 0x2A, 0xB5, 0x43, 0x81, 0x23, 0xF2, 0x19, 0x90, 0x69, 0xE5, 0x0E,
+    0x88, 0xEC, 0xD1, 0x22, 0x7B, 0xEC, 0x50, 0x65, 0xB6, 0xE8, 0x54, 0x4D, 0x34, 0xC1, 0x78, 0xDA,
+    0xC1, 0xC1, 0x56, 0x25, 0xEA, 0xD8, 0x8C, 0xF4, 0x9D, 0xFB, 0x70, 0x17, 0x11, 0xB9, 0x8F, 0x16,
+    0x49, 0x87, 0xEA, 0x55, 0xD2, 0x11, 0x1D, 0x8D, 0x2F, 0x1B, 0xD2, 0xA9, 0x09, 0x95, 0x9B, 0x11,
+    0x13, 0x1C, 0x08, 0xFB, 0xDB, 0xBB, 0x58, 0x8B, 0x08, 0xAD, 0xC8, 0xF9, 0x8A, 0x6F, 0x65, 0xA4,
+    0x12, 0xC9, 0xD8, 0xFD, 0xEB, 0x13, 0xFD, 0xC8, 0xE3, 0xEC, 0x01, 0x9D, 0x28, 0x60, 0x54, 0xF0,
+    0xC3, 0x7A, 0xA0, 0x1D, 0x0E, 0xD2, 0x71, 0x2C, 0x16, 0x87, 0xB3, 0x87, 0xFC, 0xD7, 0x9F, 0x57,
+    0x71, 0x1E, 0xB0, 0x01, 0x68, 0xF6, 0xC7, 0x6F, 0x51, 0x89, 0x24, 0xE8, 0xE5, 0xCE, 0x62, 0x18,
+    0x5A, 0x79, 0x15, 0x8C, 0xC8, 0x58, 0x26, 0xAD, 0x12, 0x7D, 0x60, 0x4B, 0x95, 0x69, 0x3B, 0xDC,
+    0x60, 0x3C, 0x75, 0xD4, 0x11, 0xB2, 0x4A, 0xE0, 0xD8, 0x82, 0xF1, 0x8E, 0x32, 0x43, 0xB2, 0x8E,
+    0xE0, 0x54, 0x02, 0xEB, 0xB7, 0xD0, 0x84, 0x43, 0x49, 0x95, 0xEB, 0x80, 0x9A, 0xD5, 0x04, 0x7B,
+    0xB6, 0x28, 0xC1, 0x71, 0x5D, 0x30, 0x1F, 0xBE, 0xB1, 0xA7, 0x16, 0x99, 0xA9, 0x44, 0x6E, 0x01,
+    0xAD, 0xC8, 0xA8, 0x45, 0x32, 0x4E, 0xC4, 0xD7, 0xE1, 0x80, 0x92, 0x0F, 0x42, 0x0E, 0x6D, 0x07,
+    0x7A, 0x7F, 0xFB, 0x55, 0x9C, 0x48, 0xA7, 0x45, 0xA6, 0x82, 0x89, 0xE3, 0x83, 0xF5, 0x6C, 0xB7,
+    0x30, 0x1A, 0x07, 0xE8, 0x8F, 0x6F, 0xBF, 0x46, 0x2F, 0xE2, 0x1B, 0x91, 0xF4, 0xFF, 0xD8, 0x57,
+    0x04, 0xDC, 0xED, 0xDB, 0xA5, 0xAF, 0x5E, 0xE4, 0x61, 0x7D, 0x0D, 0x97, 0xFB, 0x8A, 0x07, 0x9C,
+    0x1E, 0x2F, 0x56, 0x71, 0x23, 0xF7, 0x59, 0x96, 0xE1, 0xC7, 0xAF, 0x27, 0xFA, 0x91, 0x7F, 0x5A,
+    0xD4, 0x51, 0x74, 0xE2, 0x0F, 0x9A, 0xAD, 0x23, 0x4B, 0x53, 0x05, 0x21, 0x1C, 0xEA, 0xF6, 0xAB,
+    0xD6, 0x23, 0xFB, 0x26, 0xE0, 0xE4, 0xB9, 0x04, 0xC6, 0x9F, 0x81, 0x8E, 0xED, 0x00, 0xB9, 0x8E,
+    0xB0, 0x26, 0x43, 0xDB, 0x39, 0x8F, 0xF1, 0x75, 0x42, 0x47, 0x76, 0x1F, 0xBC, 0x94, 0x68, 0x44,
+    0x66, 0x68, 0xE5, 0x3E, 0xF0, 0x07, 0x94, 0xC9, 0xE8, 0xA0, 0x23, 0xAC, 0x71, 0xD0, 0x8C, 0x75,
+    0x80, 0xCC, 0x29, 0x18, 0xDF, 0x8C, 0xA8, 0x44, 0x06, 0xDB, 0x19, 0x4F, 0x35, 0x15, 0x05, 0xB7,
+    0x1D, 0x3A, 0x56, 0xFB, 0xDB, 0xB7, 0xF7, 0x38, 0x29, 0x12, 0x93, 0xCC, 0x7A, 0xF9, 0x01, 0xB9,
+    0x98, 0x26, 0xE3, 0xA9, 0x26, 0x12, 0xB8, 0x62, 0xA7, 0xAA, 0x09, 0x56, 0x38, 0xA8, 0x83, 0x8E,
+    0xB0, 0x2D, 0x3F, 0xA8, 0x47, 0xC8, 0xD0, 0xCA, 0xA8, 0x65, 0xA6, 0xBA, 0x5F, 0x86, 0x13, 0x8B,
+    0x11, 0x0B, 0x70, 0x5A, 0xC4, 0x5F, 0x6C, 0x9E, 0x4A, 0x97, 0x8B, 0xCB, 0x90, 0x29, 0x5D, 0x62,
+    0x3C, 0x24, 0x68, 0x07, 0x7A, 0x19, 0x9A, 0xC2, 0xB2, 0xB6, 0x17, 0xBC, 0x55, 0xA5, 0x62, 0x03,
+    0xAB, 0x69, 0xC1, 0xDB, 0x58, 0xDA, 0x6F, 0xC6, 0x05, 0xB0, 0x0F, 0x50, 0x35, 0x14, 0xED, 0xBA,
+    0x45, 0x69, 0xAB, 0x45, 0x67, 0x0F, 0x34, 0x55, 0x4D, 0x05, 0xB2, 0x75, 0x04, 0x13, 0xF8, 0xE7,
+    0xBD, 0xC7, 0x49, 0x87, 0x4B, 0x70, 0x8D, 0xC2, 0x75, 0x1C, 0xC6, 0xE3, 0x3A, 0x1D, 0x71, 0x9D,
+    0x4A, 0xB8, 0x8E, 0x2D, 0xAE, 0xA3, 0xC5, 0x75, 0x18, 0xEF, 0x3A, 0x74, 0x74, 0x1D, 0x2A, 0xB9,
+    0x01, 0xB6, 0x6E, 0x00, 0xD7, 0x0F, 0x60, 0x24, 0x80, 0x96, 0x0C, 0x6A, 0x6F, 0x07, 0xD8, 0x96,
+    0xC9, 0x6E, 0xC1, 0x78, 0xEB, 0xA9, 0x83, 0x9E, 0x50, 0x13, 0x6B, 0xD8, 0x16, 0x8E, 0x5B, 0x25,
+    0x8C, 0xA7, 0xA7, 0x0E, 0x98, 0xB1, 0x2A, 0x00, 0xD0, 0x82, 0xF1, 0xE8, 0x88, 0x4A, 0xB0, 0xFD,
+    0xE4, 0x77, 0x57, 0xBE, 0x87, 0xAB, 0xDF, 0xEB, 0x80, 0x9A, 0xCE, 0xBF, 0x7F, 0x78, 0xFB, 0x7F,
+    0x88, 0xEC, 0x45, 0xF6, 0xB4, 0x23, 0x34, 0x19, 0x17, 0xC0, 0x64, 0x5C, 0x01, 0xD2, 0x3E, 0x82,
+    0x9B, 0x38, 0x8B, 0xB0, 0x8F, 0xCC, 0x11, 0x75, 0x2F, 0x92, 0x26, 0xF4, 0xAF, 0x22, 0x69, 0xA2,
+    0xFE, 0x69, 0x50, 0x53, 0xC2, 0xBC, 0x33, 0x56, 0x31, 0x61, 0x1B, 0xAF, 0x63, 0x66, 0x65, 0xBC,
+    0x8E, 0x1B, 0x36, 0xC6, 0xEB, 0xB0, 0x21, 0xD9, 0xA1, 0x1E, 0x4F, 0xAA, 0xD8, 0x76, 0x8D, 0x3F,
+    0xD5, 0xA3, 0xC3, 0xF8, 0x23, 0xE3, 0x1D, 0x66, 0x38, 0xB2, 0x9D, 0xC3, 0x0E, 0x2B, 0xC7, 0x9A,
+    0xB6, 0x5B, 0x9D, 0xB2, 0xA5, 0xA5, 0x2D, 0x4C, 0xB4, 0x8D, 0x64, 0x56, 0xD8, 0xA0, 0x12, 0xA7,
+    0x58, 0xAF, 0x12, 0x1B, 0xCC, 0x50, 0x4D, 0xC5, 0xEE, 0x25, 0x04, 0xEA, 0x51, 0xCF, 0xD0, 0x76,
+    0x36, 0x43, 0x66, 0x17, 0xD1, 0x51, 0xDF, 0x0B, 0x98, 0xC1, 0x7C, 0xD7, 0x73, 0xCA, 0xAA, 0xA5,
+    0x8A, 0x6A, 0x5A, 0x63, 0x7C, 0xE3, 0x33, 0x0E, 0x57, 0x4D, 0x2A, 0x91, 0x75, 0x68, 0x46, 0x1D,
+    0x8C, 0x6F, 0xB1, 0x9D, 0xED, 0x32, 0x1B, 0x9C, 0x0E, 0x3A, 0xB2, 0xB1, 0x83, 0x19, 0x54, 0xDA,
+    0xB2, 0x46, 0xFF, 0x32, 0x56, 0x13, 0xCD, 0xFB, 0xBE, 0xF1, 0x98, 0x33, 0x1C, 0xB8, 0x89, 0x04,
+    0xBD, 0xAF, 0x47, 0x10, 0xDA, 0x85, 0x31, 0x2C, 0xB8, 0x7D, 0x0B, 0x7A, 0xD9, 0xC3, 0xEE, 0x6F,
+    0x77, 0x91, 0xDD, 0xA0, 0xF6, 0xF4, 0x1D, 0xD6, 0xBB, 0x0E, 0x3D, 0xB5, 0x03, 0x9C, 0x19, 0x0F,
+    0xF6, 0x47, 0x01, 0xF4, 0xAF, 0x26, 0x20, 0x67, 0xC0, 0xF5, 0x80, 0x7D, 0x7F, 0x80, 0xFA, 0xD7,
+    0x01, 0xAA, 0x8F, 0x13, 0x30, 0x9F, 0x01, 0x7D, 0x3B, 0x40, 0xFB, 0x4E, 0x04, 0x33, 0x66, 0x30,
+    0xD1, 0x79, 0x9A, 0x58, 0x27, 0xCC, 0xC4, 0xEE, 0x83, 0x9B, 0x89, 0x46, 0x64, 0x2A, 0x50, 0x71,
+    0xD8, 0xDA, 0xF2, 0x7D, 0xB4, 0x48, 0xC0, 0x89, 0x0C, 0x75, 0xA8, 0x66, 0xB6, 0x34, 0xA1, 0x19,
+    0x71, 0xE4, 0x62, 0x85, 0x9D, 0x4A, 0xD4, 0xA1, 0xED, 0x98, 0x75, 0xA4, 0xF5, 0x0E, 0x3B, 0x69,
+    0x91, 0x99, 0x5E, 0xF6, 0x34, 0x1F, 0xFF, 0xB7, 0xDF, 0x68, 0x3B, 0x1F, 0x66, 0xCF, 0x7E, 0xE7,
+    0x93, 0x76, 0xED, 0x00, 0xED, 0xCB, 0x9F, 0x9C, 0x74, 0x33, 0xB1, 0xFB, 0xE0, 0xE6, 0x74, 0x65,
+    0xD2, 0x7F, 0x38, 0x9D, 0x03, 0x9B, 0x89, 0x00, 0x7B, 0xA0, 0xF8, 0x72, 0xD5, 0x6B, 0xD0, 0xCA,
+    0xAD, 0x73, 0x71, 0xF8, 0x3A, 0xA8, 0x99, 0x2D, 0x4D, 0x7C, 0xA4, 0x38, 0xDC, 0xE0, 0x8E, 0x77,
+    0x51, 0x8B, 0x24, 0x7A, 0x99, 0x68, 0xC6, 0xB6, 0x3B, 0x27, 0xE0, 0x2A, 0x71, 0x86, 0xED, 0x74,
+    0xAC, 0x26, 0x5C, 0xE7, 0x0A, 0xA6, 0x1B, 0xBF, 0x86, 0xB9, 0x19, 0x8B, 0xB5, 0x06, 0x9E, 0x92,
+    0x11, 0x23, 0xE2, 0xB5, 0xBC, 0x9E, 0xD8, 0xA1, 0x3A, 0xE3, 0x17, 0xBF, 0xD1, 0x0E, 0x87, 0x0F,
+    0xFE, 0xC0, 0x60, 0xF6, 0x80, 0x99, 0x29, 0x3C, 0x95, 0x3E, 0x2C, 0xF4, 0x46, 0xA7, 0xA5, 0xD6,
+    0x79, 0x75, 0x9D, 0x14, 0xEC, 0x58, 0x1F, 0xEF, 0xC6, 0x5A, 0x64, 0xA2, 0x95, 0x04, 0xD7, 0x6E,
+    0x14, 0x7A, 0x7A, 0x53, 0x44, 0xDE, 0x17, 0x91, 0x78, 0xEE, 0x8B, 0x9C, 0xFB, 0x52, 0xEB, 0x4B,
+    0x0E, 0x8A, 0x8E, 0x8B, 0x4A, 0xCF, 0x1E, 0xF6, 0x70, 0xBB, 0xA8, 0xF8, 0xA1, 0x0F, 0xC9, 0x60,
+    0x06, 0x07, 0x75, 0xB0, 0x03, 0xD5, 0xD4, 0x8C, 0xB0, 0x29, 0x66, 0x2A, 0x53, 0x64, 0x70, 0xA9,
+    0x24, 0x5F, 0x94, 0x0C, 0x6B, 0x8A, 0x70, 0xAB, 0xA9, 0xF1, 0x97, 0x4B, 0xEC, 0xB0, 0x86, 0x66,
+    0xB4, 0x43, 0xE1, 0x67, 0x2A, 0x93, 0x61, 0xC6, 0x0D, 0x08, 0xF5, 0xFC, 0x55, 0x81, 0x9D, 0x08,
+    0xD4, 0x32, 0xB3, 0x70, 0xD7, 0x0D, 0xE8, 0x5F, 0x45, 0x68, 0x7F, 0xE4, 0x21, 0xB7, 0x1D, 0x4D,
+    0x38, 0x2D, 0x34, 0xA3, 0x4A, 0x75, 0xC0, 0x78, 0x33, 0x70, 0x86, 0x43, 0x47, 0x32, 0xED, 0xA0,
+    0x23, 0x99, 0xC6, 0x37, 0x23, 0x2D, 0x0E, 0xB6, 0xD5, 0x84, 0x9A, 0x8C, 0xA7, 0x0E, 0x5B, 0x30,
+    0xDF, 0x89, 0xB0, 0x6A, 0x3B, 0xC8, 0x09, 0xF4, 0xAF, 0x3D, 0x98, 0x3D, 0xD0, 0xC6, 0x85, 0xAD,
+    0xAB, 0x5C, 0x3C, 0x58, 0x07, 0xAD, 0x1D, 0x68, 0x3D, 0xF6, 0x9D, 0x80, 0x89, 0x34, 0xEF, 0x25,
+    0x9A, 0x8C, 0x8E, 0x6B, 0xF4, 0x47, 0x54, 0x93, 0x19, 0xAA, 0x7B, 0x23, 0x59, 0x07, 0xD2, 0xC4,
+    0x9A, 0xC4, 0xC9, 0x11, 0x0E, 0x87, 0x33, 0x9D, 0x1D, 0x8C, 0xB7, 0xCF, 0x8F, 0xC6, 0xEB, 0x68,
+    0xFC, 0xA4, 0x23, 0xB9, 0x1E, 0x57, 0xD5, 0x84, 0xD3, 0xD1, 0x0C, 0x19, 0xE3, 0x27, 0x1D, 0x4E,
+    0xD1, 0x71, 0x43, 0x72, 0x90, 0x57, 0xAC, 0x6C, 0x87, 0x6B, 0x31, 0x3F, 0xF2, 0x34, 0xEF, 0x0E,
+    0xD5, 0xAF, 0x02, 0xD5, 0x3D, 0xCF, 0x36, 0xC2, 0x2E, 0xD0, 0x26, 0x68, 0x23, 0x4D, 0x86, 0x26,
+    0x53, 0x09, 0x54, 0x33, 0xF4, 0x1D, 0xF4, 0x07, 0xD2, 0x30, 0xA0, 0x03, 0x0E, 0x5C, 0x57, 0xA2,
+    0x1D, 0x64, 0xDA, 0x81, 0x6A, 0x52, 0x19, 0xEA, 0x50, 0xE0, 0x6E, 0x06, 0xDA, 0x2F, 0x8F, 0xC0,
+    0x6A, 0x0D, 0x25, 0xE0, 0x89, 0x12, 0x28, 0xE0, 0x06, 0x2E, 0x00, 0x95, 0x78, 0xC0, 0xFE, 0xD7,
+    0x0E, 0xC8, 0x2B, 0xC0, 0xF8, 0x0C, 0x6C, 0xD5, 0x74, 0xC0, 0xF2, 0x7E, 0x81, 0x17, 0x3B, 0xE0,
+    0xBA, 0x82, 0x49, 0xCC, 0x58, 0x8F, 0x4A, 0x6C, 0xC0, 0xBE, 0x32, 0xA2, 0xE3, 0x1A, 0x66, 0x1D,
+    0xB1, 0xDE, 0x15, 0x32, 0x30, 0x63, 0x07, 0x3B, 0x2C, 0x0E, 0xEA, 0x0C, 0x1B, 0x3B, 0x50, 0xFF,
+    0x38, 0xC2, 0x6A, 0x0B, 0x95, 0x0C, 0x60, 0x23, 0x30, 0x3F, 0x9C, 0x77, 0x51, 0xE2, 0x08, 0x57,
+    0x39, 0x1E, 0x46, 0x44, 0xD0, 0x22, 0xE2, 0x95, 0x88, 0x04, 0x8A, 0xDF, 0x57, 0xB6, 0xA3, 0x9E,
+    0x0E, 0x7C, 0xB9, 0x4A, 0x2C, 0x4A, 0x2D, 0x01, 0xAB, 0xF9, 0xDC, 0x52, 0xEC, 0x1E, 0xE0, 0xC5,
+    0xDD, 0x12, 0xCC, 0xA1, 0xBD, 0xCA, 0xC6, 0xCC, 0x08, 0x34, 0x1F, 0xDF, 0xBE, 0x3D, 0x68, 0x11,
+    0x89, 0x88, 0x48, 0x02, 0x2D, 0x9E, 0x3E, 0xD3, 0x7C, 0x38, 0x94, 0xE5, 0x0E, 0x09, 0x6C, 0x47,
+    0xB5, 0xF0, 0x95, 0x0B, 0x3A, 0xB3, 0x39, 0xE7, 0x2B, 0x97, 0x8A, 0x23, 0xAC, 0xA0, 0x1E, 0xAF,
+    0x14, 0x0F, 0xA8, 0x09, 0x5A, 0xD0, 0x12, 0x70, 0x33, 0xEA, 0xB8, 0xE3, 0x94, 0x49, 0x07, 0xE3,
+    0x1D, 0x1B, 0x15, 0xEB, 0xD1, 0x74, 0x2B, 0x72, 0x15, 0x1B, 0x6F, 0x39, 0x25, 0x15, 0x00, 0xDB,
+    0xA8, 0x49, 0x8F, 0x66, 0x58, 0x51, 0x8B, 0x67, 0x97, 0xB9, 0xFE, 0xC6, 0x80, 0x7A, 0xD4, 0x60,
+    0xF2, 0xC3, 0x06, 0x53, 0x62, 0xD9, 0x0F, 0x0C, 0xA6, 0x14, 0xB7, 0x07, 0xEA, 0xA5, 0x65, 0xA4,
+    0xCF, 0xA8, 0xE3, 0x6E, 0x09, 0x78, 0xE7, 0xC5, 0x94, 0xAD, 0x23, 0xAC, 0x8E, 0xC0, 0x34, 0x9E,
+    0x66, 0x98, 0xD0, 0x63, 0x4B, 0x15, 0xF5, 0xC8, 0xC4, 0x86, 0x0D, 0xA6, 0x3B, 0xA2, 0x8A, 0x2D,
+    0x1C, 0x99, 0x81, 0xE6, 0x1D, 0x0F, 0x53, 0x01, 0x2B, 0x49, 0x22, 0xF2, 0xDE, 0xF1, 0xF1, 0x31,
+    0x5F, 0x64, 0x26, 0xAB, 0xA9, 0x8A, 0x95, 0x5F, 0x3C, 0xC2, 0xF0, 0x0C, 0x4E, 0xDE, 0xF1, 0xE6,
+    0xEE, 0x3A, 0xEB, 0x84, 0x0C, 0x3B, 0xEA, 0x69, 0x31, 0xD8, 0x3A, 0xBA, 0x0E, 0xA7, 0x23, 0x75,
+    0x70, 0x17, 0x81, 0x0E, 0x95, 0xEB, 0x80, 0x1B, 0xD6, 0x34, 0x93, 0x8E, 0x95, 0x74, 0xEE, 0x87,
+    0xFB, 0xA8, 0x64, 0xDF, 0x52, 0xCB, 0x73, 0xA1, 0x78, 0xC6, 0xAA, 0x7B, 0x18, 0xB1, 0xAF, 0xE2,
+    0x15, 0x80, 0x6B, 0x66, 0x9A, 0x9F, 0xCA, 0xC4, 0x7C, 0xBF, 0xF7, 0x26, 0x33, 0x23, 0xD4, 0xC1,
+    0x8E, 0xAC, 0xAB, 0x4C, 0x1D, 0x5C, 0xC7, 0x5A, 0x47, 0x9A, 0x71, 0x0D, 0x73, 0x3D, 0x62, 0xFC,
+    0x16, 0x95, 0xCD, 0x88, 0xEB, 0x66, 0xEA, 0x68, 0xA3, 0x9A, 0xAB, 0x5F, 0x8F, 0xBB, 0xE1, 0x69,
+    0x27, 0x41, 0x8F, 0xBB, 0xE9, 0x52, 0xE4, 0xDD, 0xCA, 0xA0, 0x45, 0x70, 0x1F, 0xFC, 0x5B, 0x9D,
+    0xCA, 0x0A, 0xCB, 0x25, 0x6A, 0xE0, 0xCA, 0xA8, 0xEA, 0x58, 0x60, 0x62, 0x5D, 0xC6, 0xA6, 0x63,
+    0x59, 0x77, 0x36, 0x3C, 0x45, 0x2B, 0x19, 0x2B, 0xE3, 0x21, 0xB0, 0xF7, 0xE2, 0x61, 0x37, 0xD8,
+    0x61, 0xB1, 0xD3, 0x3A, 0x2E, 0xB3, 0x62, 0x55, 0x9C, 0xFF, 0x66, 0xDF, 0x78, 0x44, 0x1C, 0xE6,
+    0xEE, 0x3A, 0xB3, 0xC7, 0x85, 0x26, 0xD2, 0x77, 0xAE, 0x78, 0x6D, 0x3A, 0x9A, 0xB1, 0x38, 0x6D,
+    0x6B, 0x72, 0xF1, 0x7F, 0x8D, 0xB7, 0x03, 0x3D, 0x6B, 0x74, 0x52, 0x89, 0x76, 0xD4, 0xB1, 0x92,
+    0xCE, 0xC4, 0xF5, 0x06, 0x2B, 0x3F, 0x8B, 0xD8, 0xD9, 0x0C, 0x97, 0xC2, 0x0B, 0xED, 0x1E, 0x2D,
+    0x82, 0xFB, 0xC9, 0xAC, 0x93, 0x4A, 0xED, 0x50, 0x87, 0x4C, 0xFB, 0x42, 0x50, 0xD9, 0x3D, 0xBB,
+    0x1B, 0x45, 0xB2, 0x96, 0x7D, 0x67, 0x6F, 0x3D, 0x6C, 0x2E, 0x5D, 0x2B, 0x73, 0x99, 0x4B, 0x07,
+    0x05, 0xC6, 0xB4, 0x04, 0x70, 0xD2, 0x95, 0x05, 0x65, 0xFC, 0xA2, 0x0E, 0x35, 0x2D, 0xBE, 0x98,
+    0xDA, 0xED, 0x4B, 0xE0, 0x90, 0x97, 0xEE, 0x76, 0x45, 0x67, 0x6C, 0xAE, 0x4C, 0x7A, 0x7D, 0x70,
+    0x96, 0xCE, 0x7F, 0x4C, 0x3E, 0x44, 0x4A, 0xDB, 0x83, 0xD2, 0x75, 0x3C, 0x48, 0xEC, 0xF4, 0x13,
+    0xD5, 0x55, 0x5A, 0xBE, 0x7D, 0x61, 0x0F, 0xEC, 0xE2, 0x12, 0xB2, 0x39, 0x38, 0x6D, 0x7B, 0xED,
+    0x95, 0x88, 0xC5, 0xDC, 0xFD, 0xF7, 0x8F, 0x10, 0xA6, 0xFD, 0x47, 0x08, 0x73, 0x5A, 0x6F, 0xB0,
+    0xF2, 0xF3, 0x73, 0x61, 0x9E, 0xB2, 0x2C, 0x3E, 0xE3, 0x81, 0x33, 0x3E, 0x47, 0x1D, 0x71, 0xDF,
+    0x93, 0x0E, 0x91, 0x09, 0xDE, 0xB8, 0xFF, 0x8F, 0x59, 0xB3, 0x01, 0x58, 0x37, 0x7B, 0x9A, 0x9F,
+    0x4A, 0x62, 0xBE, 0x7F, 0xD3, 0x9B, 0xCC, 0x16, 0xA1, 0x19, 0xED, 0xC8, 0xB6, 0xCA, 0xC5, 0xF7,
+    0x38, 0x84, 0x05, 0x55, 0xAA, 0x47, 0xDA, 0x6E, 0xB3, 0xB0, 0x1F, 0x72, 0x81, 0xEE, 0xD3, 0x6A,
+    0xA2, 0x19, 0x5B, 0x96, 0x7A, 0x5C, 0x47, 0x47, 0x95, 0x39, 0xBA, 0x08, 0x26, 0x6D, 0x71, 0x18,
+    0xAF, 0x83, 0x4A, 0xCB, 0xC7, 0x3A, 0x9C, 0x3F, 0xAD, 0x43, 0x35, 0xB1, 0x29, 0x62, 0x57, 0x43,
+    0x71, 0xE5, 0x22, 0xE7, 0xBF, 0x3E, 0x8F, 0x47, 0x5D, 0x72, 0xE5, 0x16, 0x6B, 0x34, 0x3E, 0xC2,
+    0x1A, 0x5D, 0x78, 0x7A, 0x57, 0x4C, 0x63, 0x35, 0x1D, 0xFC, 0xC4, 0x7F, 0x31, 0xA3, 0x65, 0xC0,
+    0x8D, 0x94, 0x38, 0xED, 0xA3, 0xDC, 0xF5, 0x0B, 0xDA, 0x6A, 0x7D, 0x33, 0xD6, 0x91, 0xAC, 0x32,
+    0xC6, 0xF7, 0x90, 0xAC, 0xC7, 0xBE, 0x10, 0xA9, 0x7E, 0x91, 0xC1, 0x39, 0xD0, 0x12, 0xA1, 0x97,
+    0x81, 0x26, 0x65, 0xD8, 0x36, 0xA1, 0x6C, 0x90, 0x5C, 0x4D, 0xD8, 0xC1, 0xF8, 0x6A, 0x62, 0xC6,
+    0x95, 0xC8, 0x87, 0xEB, 0x50, 0x1D, 0x19, 0xE3, 0x55, 0xA2, 0x5D, 0x72, 0xA4, 0x91, 0xF5, 0xD5,
+    0xCC, 0xE9, 0x74, 0xE9, 0xE9, 0x06, 0xE3, 0xC9, 0xD8, 0xE1, 0xF0, 0xF4, 0xF0, 0x3A, 0x69, 0x32,
+    0xBB, 0xC0, 0xA6, 0x17, 0x2D, 0x89, 0xF9, 0x7E, 0xFF, 0x95, 0xEF, 0x65, 0xC4, 0x9B, 0x2D, 0x33,
+    0x82, 0x99, 0xD8, 0xAA, 0x19, 0x13, 0xD8, 0x54, 0x19, 0xEB, 0xC9, 0x7A, 0x62, 0x01, 0xD1, 0xB6,
+    0x53, 0xA9, 0x0E, 0xB8, 0x12, 0xE8, 0x72, 0x54, 0xB1, 0xF1, 0xAC, 0x8B, 0x62, 0xB7, 0xE5, 0x6D,
+    0xD1, 0x6E, 0x3E, 0x50, 0x59, 0xE3, 0x5B, 0x54, 0xC2, 0x78, 0x47, 0x35, 0x61, 0x06, 0xE0, 0x06,
+    0xB5, 0x97, 0xC0, 0xA6, 0x17, 0x6F, 0xDE, 0xFF, 0x5F, 0x33, 0x32, 0x9A, 0xD1, 0x46, 0xCE, 0xAA,
+    0x99, 0x66, 0x74, 0x9E, 0x59, 0x4F, 0x18, 0xEF, 0x50, 0xB9, 0x8E, 0xB4, 0xC3, 0x19, 0xD5, 0x64,
+    0x2E, 0xF1, 0xE7, 0x5E, 0x25, 0x9A, 0xC2, 0x9F, 0xA7, 0x45, 0x5E, 0x8B, 0xBE, 0x25, 0x50, 0x8B,
+    0x50, 0xCF, 0x5F, 0x8F, 0x3A, 0x71, 0x56, 0x25, 0x8C, 0xCF, 0xE8, 0xB8, 0x2D, 0xF1, 0x35, 0x67,
+    0x3C, 0xE6, 0x9D, 0x80, 0xFE, 0x45, 0x2A, 0x49, 0xA1, 0xAD, 0x1D, 0x70, 0x3A, 0xD2, 0x0E, 0x33,
+    0xD6, 0xDB, 0x3B, 0x37, 0xC7, 0x4A, 0x64, 0xC4, 0xCA, 0x00, 0x8F, 0x5D, 0x48, 0x6B, 0xA6, 0xFA,
+    0x85, 0xCC, 0x98, 0xF7, 0xFF, 0x22, 0xE3, 0xA2, 0x9E, 0x10, 0xEA, 0x50, 0x4F, 0xD8, 0xA1, 0xF5,
+    0xAC, 0x99, 0x51, 0x49, 0x47, 0x9A, 0xD1, 0x0C, 0xB8, 0xEE, 0xB4, 0xA8, 0xAF, 0x8E, 0x66, 0xC4,
+    0x75, 0xAE, 0x53, 0x59, 0x09, 0x76, 0x6C, 0x3E, 0x7A, 0x6E, 0x4F, 0xEB, 0x24, 0x90, 0xDB, 0x19,
+    0x1D, 0xAF, 0xFD, 0x26, 0x43, 0x7A, 0xD5, 0xDD, 0x79, 0x34, 0x2C, 0xE5, 0x02, 0x4B, 0xFD, 0x3F,
+    0x0C, 0x4B, 0x1F, 0x47, 0x25, 0x7B, 0x47, 0x2D, 0x2F, 0x84, 0xC5, 0x08, 0xFC, 0xA6, 0x80, 0xD3,
+    0x22, 0xCE, 0xD8, 0xFB, 0xE6, 0x1D, 0xC1, 0xAD, 0x5F, 0x45, 0x46, 0x74, 0x2E, 0x5E, 0xCE, 0xAE,
+    0xD0, 0x1C, 0xE3, 0x8B, 0xA5, 0x9D, 0x4A, 0x53, 0x07, 0x3C, 0x09, 0xA5, 0x9D, 0x0D, 0x17, 0x0B,
+    0xAE, 0x92, 0x49, 0x89, 0x04, 0xF7, 0xE7, 0x9B, 0x26, 0xC0, 0xA6, 0x4C, 0xAE, 0x2F, 0xCE, 0x88,
+    0x99, 0x8B, 0x2B, 0xD2, 0x2E, 0x0D, 0x2F, 0x41, 0x99, 0x38, 0x55, 0xB3, 0x11, 0x19, 0x7A, 0x19,
+    0xB9, 0xD6, 0xC1, 0x3F, 0x83, 0x67, 0x96, 0xBC, 0xE9, 0x53, 0x92, 0x7B, 0xC9, 0x7F, 0x78, 0xF7,
+    0x45, 0x1D, 0x97, 0xBC, 0x69, 0x33, 0x1E, 0xD2, 0xB6, 0x03, 0xB6, 0xA3, 0x3D, 0x24, 0x6F, 0x1D,
+    0xB8, 0x67, 0x69, 0x85, 0x46, 0xE0, 0x06, 0x6A, 0xA2, 0xF1, 0xEE, 0x60, 0x6E, 0x1C, 0x2A, 0xD5,
+    0x01, 0xDB, 0x6D, 0xA9, 0x0E, 0x66, 0x49, 0x47, 0x3B, 0xB0, 0x56, 0x07, 0x2F, 0xEC, 0x40, 0x24,
+    0x93, 0x8E, 0xEC, 0x3A, 0x47, 0x3B, 0xE9, 0x64, 0xDF, 0x28, 0xD0, 0xB4, 0x9B, 0x56, 0x05, 0x64,
+    0x4F, 0xC1, 0xD9, 0xE1, 0x3C, 0x8B, 0x68, 0x46, 0x47, 0x1D, 0x8D, 0xD7, 0x53, 0x15, 0x55, 0x62,
+    0x4B, 0xC6, 0x76, 0x6B, 0xEA, 0xD1, 0x41, 0x6A, 0x07, 0x56, 0xC6, 0x63, 0x5E, 0x1E, 0x8B, 0x63,
+    0xB1, 0x9D, 0x96, 0x14, 0xD9, 0xBC, 0x30, 0xE2, 0x15, 0x75, 0xC4, 0x19, 0x5F, 0x65, 0xEC, 0x77,
+    0x22, 0x82, 0x19, 0x33, 0xFF, 0x73, 0xD4, 0xD1, 0x71, 0x34, 0x55, 0x93, 0xF1, 0xED, 0x11, 0x59,
+    0x47, 0xF3, 0x95, 0x6E, 0x4B, 0x6E, 0xDE, 0x1E, 0x1D, 0x4E, 0x87, 0x64, 0xBB, 0xE6, 0x87, 0x71,
+    0x65, 0x7C, 0x15, 0x93, 0x79, 0x39, 0xB0, 0x39, 0xD1, 0x3F, 0x8B, 0xB4, 0x2B, 0xDE, 0x4A, 0x34,
+    0xEF, 0xF2, 0xF4, 0x86, 0xEA, 0xD7, 0x43, 0x73, 0x06, 0xFD, 0x58, 0x49, 0x87, 0x8D, 0xEC, 0x3C,
+    0xF5, 0x54, 0x3C, 0xD6, 0x15, 0x55, 0x22, 0x63, 0xBD, 0x4A, 0x6A, 0xD9, 0x5E, 0xF5, 0x38, 0x83,
+    0xF9, 0xD1, 0x08, 0xED, 0x19, 0xE0, 0xE2, 0xC2, 0x59, 0x75, 0x06, 0xDC, 0x04, 0xFA, 0x5E, 0x80,
+    0xF6, 0x15, 0x8F, 0x4A, 0x76, 0x28, 0x20, 0x94, 0x59, 0x63, 0x46, 0x32, 0x7B, 0xAA, 0x09, 0xEC,
+    0x50, 0x0C, 0x52, 0x35, 0x95, 0xF8, 0x11, 0x19, 0x33, 0x62, 0xBC, 0xCA, 0x14, 0x9B, 0x5D, 0x8F,
+    0x75, 0x58, 0x82, 0x87, 0x3A, 0xD8, 0x01, 0x5C, 0x89, 0x97, 0xAD, 0x81, 0xD6, 0x78, 0xA8, 0x7E,
+    0x31, 0x01, 0xD6, 0x01, 0xEA, 0xDE, 0x08, 0x98, 0xCC, 0x42, 0xFC, 0x30, 0xE1, 0x3C, 0x42, 0x69,
+    0x87, 0xC3, 0xF6, 0x29, 0xE1, 0x66, 0xEB, 0xA1, 0x7A, 0x29, 0x02, 0x6E, 0x66, 0x71, 0x77, 0xA1,
+    0x97, 0x99, 0x5E, 0x66, 0xFE, 0xE0, 0xAB, 0xB9, 0xAC, 0xDD, 0x26, 0x94, 0x48, 0x4E, 0x5F, 0xDA,
+    0xD1, 0x53, 0x61, 0x0A, 0xCB, 0x23, 0x95, 0x2F, 0xC8, 0x43, 0x3B, 0x80, 0x13, 0x19, 0x7A, 0x91,
+    0x0E, 0x9E, 0xF4, 0x34, 0x19, 0x25, 0xC3, 0x43, 0x22, 0x87, 0x17, 0x24, 0x3A, 0x42, 0x41, 0x8A,
+    0x7E, 0xA0, 0x9E, 0xCB, 0x03, 0xDB, 0xA1, 0xA6, 0x87, 0x70, 0xE3, 0x85, 0xFC, 0x36, 0x13, 0xB8,
+    0x80, 0x2A, 0xE3, 0x7D, 0xE2, 0xE4, 0x1F, 0x7A, 0x41, 0x73, 0x0B, 0xA4, 0x1C, 0xB4, 0xA8, 0x47,
+    0x38, 0x7A, 0x08, 0x8F, 0x56, 0x11, 0x6C, 0xD9, 0xA1, 0xE6, 0x0E, 0xB4, 0x23, 0x4D, 0x46, 0xDF,
+    0x87, 0xED, 0x83, 0xC3, 0x5D, 0x5C, 0x82, 0x6D, 0x09, 0xD1, 0x25, 0xB4, 0x80, 0x2B, 0xD4, 0xAB,
+    0xB9, 0x8F, 0xB2, 0x92, 0xAA, 0x1F, 0xFD, 0x1F, 0x91, 0x5F, 0x76, 0xD7, 0x25, 0x16, 0xEC, 0x7B,
+    0x0C, 0x38, 0xD1, 0x63, 0x1D, 0x1C, 0xEB, 0x2A, 0x36, 0xA1, 0xED, 0x76, 0x55, 0xAA, 0xA3, 0xF5,
+    0x76, 0xC8, 0xB8, 0x6A, 0x62, 0xAD, 0x23, 0xB9, 0xF1, 0x6A, 0x32, 0x83, 0x8E, 0x16, 0x3D, 0x3C,
+    0x53, 0x6C, 0x4A, 0xF7, 0x39, 0x2C, 0x13, 0xAB, 0x2A, 0xB2, 0xA9, 0x47, 0x92, 0xF1, 0x55, 0xB4,
+    0x5D, 0x1D, 0x1C, 0xAD, 0xDF, 0xAA, 0x5C, 0x47, 0xE3, 0x7B, 0x72, 0x1D, 0x1B, 0xEF, 0x38, 0xD5,
+    0x91, 0x5B, 0xCD, 0x39, 0x9A, 0xBF, 0x7A, 0xAE, 0xF6, 0xED, 0xB9, 0xF7, 0x64, 0x3A, 0x40, 0x5F,
+    0xCD, 0xD9, 0xFD, 0x7E, 0x92, 0x36, 0xC0, 0x17, 0x39, 0x64, 0x46, 0x8A, 0x17, 0xB7, 0xF8, 0xC8,
+    0xD0, 0x74, 0x7C, 0x72, 0x84, 0xED, 0x08, 0x98, 0x89, 0x25, 0x12, 0x50, 0xBF, 0x3F, 0x2C, 0xF1,
+    0x06, 0x95, 0x32, 0x90, 0x5B, 0x96, 0x31, 0xBA, 0x6A, 0x82, 0xB6, 0x3B, 0xA5, 0x50, 0xBC, 0x66,
+    0xD4, 0xA1, 0xC4, 0x1C, 0x2A, 0x11, 0x41, 0x89, 0x88, 0x67, 0x7F, 0xFB, 0xF5, 0x48, 0x0F, 0x5B,
+    0x1C, 0xB4, 0x9D, 0x1D, 0x8A, 0xFF, 0xAD, 0x52, 0x13, 0x96, 0xCD, 0x65, 0xFE, 0x72, 0xE1, 0xC4,
+    0x5C, 0x1F, 0x80, 0x36, 0x00, 0x7D, 0x04, 0x95, 0x12, 0xD4, 0xE3, 0x11, 0xFC, 0x11, 0x7F, 0xF4,
+    0x99, 0x90, 0x63, 0xF7, 0x18, 0xE5, 0x90, 0x80, 0x8E, 0x0E, 0xAA, 0xF1, 0x4B, 0x9F, 0x4C, 0xC5,
+    0xFE, 0xDE, 0x54, 0xFC, 0xFB, 0xCB, 0x92, 0xE9, 0xBF, 0x3E, 0xAC, 0x74, 0x13, 0x0E, 0x2C, 0x81,
+    0x04, 0xC5, 0xB1, 0xDD, 0xC5, 0x83, 0x40, 0xF8, 0xB3, 0xC3, 0x38, 0xDA, 0x43, 0x0D, 0xED, 0xE1,
+    0x8A, 0x6E, 0xFF, 0x7F, 0xA6, 0xBB, 0xE0, 0xF3, 0xC3, 0x22, 0x9D, 0xB3, 0xC5, 0x62, 0xEB, 0x00,
+    0xBC, 0xF9, 0xFB, 0x1A, 0x4F, 0xF5, 0xFD, 0x45, 0x54, 0x6D, 0x86, 0xE6, 0xC7, 0x23, 0x55, 0xB4,
+    0xF0, 0x2D, 0xBE, 0xF9, 0x7B, 0x1A, 0xCF, 0xE3, 0x0A, 0xCC, 0x90, 0x0A, 0x9A, 0x1A, 0xE2, 0xD5,
+    0x95, 0x5E, 0x89, 0xCC, 0x38, 0x11, 0xAF, 0x97, 0xFC, 0x57, 0x69, 0x7E, 0x73, 0xB0, 0x2F, 0xF9,
+    0x4A, 0x06, 0xF0, 0xC3, 0x25, 0x53, 0xE8, 0x44, 0xBA, 0xF3, 0x71, 0x5F, 0xA9, 0xA7, 0xA6, 0x07,
+    0x52, 0x8B, 0x43, 0x2D, 0x92, 0xD9, 0x89, 0x0C, 0x70, 0xFD, 0x16, 0xB8, 0x05, 0x31, 0x7C, 0x71,
+    0xA6, 0xC2, 0xA5, 0xE4, 0xF0, 0xA7, 0x90, 0x3D, 0x7B, 0xAD, 0x24, 0x33, 0xEA, 0x58, 0x8A, 0x57,
+    0xC0, 0xB7, 0x2E, 0xEB, 0x61, 0xC4, 0xC9, 0x48, 0x75, 0xFF, 0x93, 0x49, 0xB5, 0x7A, 0x2C, 0xFD,
+    0x3E, 0x2A, 0xA9, 0xE6, 0x3E, 0x99, 0x54, 0x23, 0x95, 0xB8, 0x5C, 0x2F, 0x03, 0x3B, 0xF1, 0xC0,
+    0x93, 0xC5, 0xE7, 0xB6, 0x19, 0x95, 0x12, 0xB6, 0x9B, 0x54, 0x50, 0x97, 0x67, 0x8C, 0x48, 0x47,
+    0x7B, 0x0B, 0xB6, 0x0B, 0x25, 0xF8, 0x8D, 0xA4, 0x37, 0x5F, 0xA9, 0x54, 0x2D, 0x52, 0x74, 0xA5,
+    0xE3, 0x26, 0x50, 0x4B, 0xA2, 0x95, 0x08, 0x8A, 0xC7, 0x71, 0x3A, 0x92, 0x8D, 0x7F, 0xC0, 0xBC,
+    0x35, 0x32, 0xE1, 0x64, 0xA4, 0xB9, 0x73, 0xA5, 0x49, 0x5B, 0x0E, 0x41, 0x55, 0xF1, 0xBC, 0x49,
+    0x95, 0x8A, 0x5C, 0x97, 0x21, 0x1C, 0x2A, 0x5D, 0x1A, 0xE7, 0x0A, 0xAA, 0x84, 0x92, 0x3D, 0x8B,
+    0xAC, 0xB9, 0xA1, 0x3A, 0xB0, 0x93, 0x01, 0x64, 0x3F, 0x41, 0xF3, 0x9C, 0x0C, 0xF0, 0x27, 0x05,
+    0x58, 0x2F, 0x86, 0x10, 0x60, 0x85, 0xF3, 0xA8, 0x09, 0xE9, 0x68, 0xC6, 0x5A, 0xC0, 0xD1, 0x66,
+    0xC8, 0xCC, 0x09, 0x1D, 0xF4, 0xCF, 0x23, 0xB6, 0x33, 0xAF, 0x78, 0x36, 0x9C, 0xDA, 0x41, 0xC7,
+    0x2A, 0x3A, 0x8C, 0x37, 0x7E, 0xCB, 0x1A, 0x47, 0xAA, 0x26, 0x92, 0x8E, 0x8D, 0xAF, 0xC7, 0x7A,
+    0x74, 0xB4, 0x18, 0x9F, 0xC8, 0xB4, 0x75, 0xD0, 0x81, 0x75, 0xDB, 0xD9, 0x81, 0xBC, 0x61, 0x4B,
+    0x75, 0x2F, 0x56, 0x11, 0xFD, 0xD1, 0x60, 0x3C, 0x66, 0x66, 0x05, 0x36, 0xAA, 0x09, 0x9C, 0x6F,
+    0xFC, 0x12, 0x26, 0xBD, 0x3E, 0x1C, 0xE2, 0x24, 0xC5, 0x3C, 0xEA, 0x00, 0x70, 0x02, 0x50, 0x5F,
+    0xC5, 0xD4, 0x7E, 0xDF, 0xA1, 0x44, 0x12, 0x95, 0xFC, 0x77, 0xF1, 0xD5, 0x9E, 0x3A, 0xA9, 0x19,
+    0x7A, 0x66, 0x30, 0xE3, 0x19, 0x54, 0xC9, 0x1D, 0xD2, 0x5B, 0xE6, 0xDD, 0x71, 0x81, 0x5A, 0xE6,
+    0x0C, 0xF4, 0x6B, 0xC0, 0x7E, 0x34, 0x40, 0xF3, 0x77, 0x01, 0xF4, 0xDF, 0x27, 0x50, 0xF9, 0x0C,
+    0xD8, 0x59, 0x0F, 0xEE, 0xF9, 0x08, 0xCE, 0x0B, 0xB4, 0xDE, 0x06, 0xDC, 0x58, 0xC9, 0x9F, 0xEF,
+    0x02, 0xAD, 0xC8, 0x08, 0x3B, 0xE9, 0x2E, 0x8E, 0x36, 0xA9, 0xD7, 0xCE, 0x43, 0xBD, 0xF3, 0x39,
+    0x4F, 0x39, 0x05, 0x78, 0x86, 0xCF, 0xDE, 0x68, 0xBF, 0x70, 0x0E, 0x38, 0x6D, 0x02, 0xDA, 0xAF,
+    0x77, 0xE0, 0xAA, 0x08, 0x4F, 0xF3, 0xA5, 0xCF, 0xDC, 0x68, 0x15, 0x8F, 0x83, 0x0E, 0x2B, 0x8A,
+    0x9D, 0xE4, 0x19, 0xED, 0x3F, 0xC1, 0x0A, 0x94, 0xDC, 0x87, 0x5A, 0x24, 0xD0, 0xEC, 0xFF, 0x8B,
+    0xD0, 0x24, 0x6C, 0xA8, 0x27, 0x54, 0xD6, 0x13, 0xB8, 0xE7, 0x12, 0x34, 0x21, 0x1F, 0xBA, 0x77,
+    0xAE, 0x5B, 0xF8, 0x82, 0xBE, 0x17, 0x41, 0xCD, 0x09, 0xE8, 0xCF, 0x80, 0xF6, 0x8D, 0x01, 0xCC,
+    0xDF, 0x04, 0xA8, 0x7F, 0x99, 0xA0, 0xCA, 0x3D, 0x30, 0x1B, 0x0F, 0xA2, 0x33, 0xEC, 0xE8, 0x07,
+    0xA4, 0x6B, 0xF6, 0x5F, 0x95, 0x81, 0x9D, 0x48, 0x47, 0x55, 0x72, 0x46, 0x37, 0x00, 0x9E, 0xEC,
+    0xCE, 0x3D, 0x92, 0x2D, 0x07, 0xE3, 0x5B, 0x62, 0xCF, 0x57, 0xD9, 0xD5, 0x67, 0x20, 0xC1, 0x75,
+    0x00, 0xC3, 0x4B, 0x09, 0x8B, 0x74, 0xCE, 0x2A, 0xDE, 0xFC, 0x0C, 0x8E, 0xF6, 0xB5, 0x73, 0xDA,
+    0xB7, 0x8B, 0xC0, 0x76, 0x05, 0x6C, 0xEB, 0x11, 0xBE, 0x75, 0x19, 0x35, 0x3E, 0x23, 0xA3, 0x7D,
+    0x8C, 0x6E, 0x49, 0x63, 0xE9, 0xE8, 0x80, 0x37, 0x1F, 0xF4, 0x02, 0x0E, 0xBE, 0xD7, 0x45, 0xFB,
+    0x6D, 0x57, 0x82, 0x11, 0x97, 0x0F, 0x34, 0x9D, 0x97, 0x5C, 0x3A, 0xEA, 0xB4, 0x2A, 0x25, 0x5B,
+    0x4A, 0x00, 0xF5, 0x52, 0xC9, 0xBA, 0x00, 0xF0, 0x7A, 0xF1, 0x15, 0xEA, 0xA8, 0x23, 0x7A, 0x62,
+    0x8F, 0xCE, 0xD8, 0xBB, 0x2F, 0xE5, 0xC2, 0x5C, 0xB1, 0x32, 0xB1, 0x9C, 0x22, 0x51, 0xAF, 0x1E,
+    0xD8, 0xEA, 0xE6, 0x60, 0x60, 0x4D, 0x77, 0x15, 0x86, 0x69, 0xF6, 0xDA, 0x6B, 0xC9, 0x27, 0xC8,
+    0xD7, 0x3E, 0xF2, 0x6E, 0x30, 0xA9, 0x89, 0xF4, 0xDD, 0x12, 0x30, 0x71, 0x7A, 0x2A, 0x33, 0x3C,
+    0xCF, 0x51, 0xE4, 0x3A, 0x60, 0xFD, 0x1A, 0x9D, 0xEA, 0x70, 0x88, 0x9C, 0x64, 0xFB, 0x51, 0x89,
+    0x9C, 0xF4, 0xD3, 0xD3, 0xF0, 0x78, 0x69, 0xF7, 0x8B, 0x0B, 0x9B, 0xAD, 0xD2, 0x02, 0xD6, 0x66,
+    0x80, 0x6A, 0xFC, 0xF4, 0x7B, 0xFE, 0xFC, 0x50, 0xB2, 0x99, 0xEC, 0x22, 0xB4, 0x5F, 0x19, 0x68,
+    0xFC, 0x09, 0x97, 0xB1, 0xFF, 0x53, 0xEB, 0xB9, 0x7B, 0x0C, 0x56, 0x3A, 0x50, 0x87, 0xF5, 0xC3,
+    0x8C, 0xD8, 0xA7, 0x92, 0x82, 0xFA, 0x1D, 0x25, 0x82, 0xCC, 0x0D, 0xF8, 0x56, 0x89, 0x96, 0x54,
+    0x53, 0xB9, 0x14, 0x60, 0x3B, 0xDA, 0xB4, 0x84, 0x65, 0xAE, 0xDF, 0x2A, 0xD6, 0xEE, 0x40, 0xC2,
+    0x8E, 0xAE, 0x2C, 0xA2, 0x46, 0x06, 0x44, 0xBC, 0xB9, 0xDB, 0x77, 0x7B, 0xD6, 0x4D, 0x50, 0xC9,
+    0xD1, 0xBC, 0x97, 0xE8, 0xCD, 0x78, 0x73, 0x72, 0x22, 0x88, 0xDC, 0xAA, 0xEF, 0x9C, 0x8F, 0xE1,
+    0x10, 0x96, 0xA9, 0xD3, 0xF5, 0xB1, 0x11, 0xE9, 0x6A, 0x99, 0x0E, 0x49, 0xAD, 0xD7, 0x8A, 0xC1,
+    0x6A, 0x42, 0xA9, 0xBC, 0xBA, 0x6A, 0xAB, 0x1A, 0x19, 0x70, 0x12, 0x91, 0xAF, 0x4D, 0x3A, 0xA9,
+    0xD4, 0x04, 0x95, 0x8C, 0xAF, 0x26, 0x3B, 0xD4, 0xD1, 0x3D, 0xBB, 0x1B, 0x9D, 0x08, 0x4E, 0xEE,
+    0xB0, 0xEE, 0x4A, 0x37, 0x87, 0x53, 0xC4, 0xAE, 0x2B, 0x89, 0xA2, 0x46, 0xA4, 0x53, 0x32, 0x2F,
+    0x7B, 0xE3, 0x8B, 0x65, 0x95, 0xB4, 0x99, 0x6A, 0x4A, 0xB4, 0xCF, 0x5E, 0xA1, 0x87, 0xBF, 0xAB,
+    0x19, 0x5D, 0x22, 0x83, 0x7A, 0x3C, 0xBA, 0xCA, 0xFD, 0x03, 0x4E, 0xA2, 0x9E, 0xBF, 0x3E, 0xBA,
+    0xC1, 0xFE, 0x87, 0xC4, 0xDA, 0xF8, 0x6A, 0x5A, 0x63, 0xDF, 0x9E, 0x9E, 0x9A, 0x8D, 0x88, 0x77,
+    0x72, 0x47, 0xDD, 0x2F, 0xFC, 0xD3, 0x96, 0x1C, 0x08, 0x33, 0xA8, 0xBD, 0x7A, 0xB3, 0x12, 0x19,
+    0x95, 0xCC, 0xF0, 0x04, 0xA8, 0xEF, 0xB3, 0x5E, 0x12, 0x04, 0xA8, 0xB2, 0xB9, 0x4E, 0x69, 0x3B,
+    0xE3, 0x75, 0x24, 0xB1, 0x5E, 0x3E, 0xAA, 0x74, 0xFE, 0x54, 0x25, 0xB6, 0xB4, 0x05, 0xBA, 0xBE,
+    0x01, 0x33, 0x7A, 0xA2, 0x19, 0xB1, 0xDD, 0x05, 0x8D, 0x29, 0xB7, 0x62, 0xCA, 0x2D, 0x96, 0x74,
+    0x71, 0x8B, 0xA5, 0x04, 0x64, 0xEB, 0xF1, 0x4A, 0x4C, 0xB6, 0xED, 0xCA, 0x51, 0x35, 0xF8, 0x7C,
+    0x87, 0xF3, 0xEC, 0x42, 0x75, 0x77, 0x32, 0x7E, 0x73, 0x41, 0x33, 0x7E, 0xBB, 0xD6, 0xBA, 0xC7,
+    0x74, 0x38, 0xAA, 0xC3, 0x5A, 0xFB, 0x4B, 0xEC, 0xEA, 0xB7, 0x6B, 0x8A, 0x27, 0xF8, 0x63, 0xF4,
+    0xBE, 0x1A, 0x69, 0x65, 0x07, 0xB1, 0x8F, 0xD4, 0xDD, 0x93, 0x87, 0x36, 0xAF, 0x81, 0xD5, 0x32,
+    0xB0, 0xE9, 0xC5, 0xEB, 0x7B, 0x77, 0x77, 0x9D, 0x99, 0x99, 0xE9, 0x7D, 0x95, 0xAA, 0x99, 0x66,
+    0x34, 0x11, 0xD7, 0xB9, 0x72, 0x6C, 0xA7, 0x8E, 0x75, 0xA4, 0x1D, 0xDA, 0x81, 0x2D, 0x33, 0x3A,
+    0xEA, 0x58, 0x8E, 0xD2, 0xF7, 0xAC, 0xA9, 0x52, 0x35, 0x61, 0x46, 0x33, 0xE2, 0x96, 0x4B, 0x21,
+    0xD5, 0xAD, 0xCB, 0x1E, 0x5C, 0x5C, 0x12, 0x00, 0xD5, 0x25, 0xA3, 0x50, 0xCB, 0x80, 0x95, 0x8C,
+    0xBD, 0xDB, 0x7B, 0x13, 0xAA, 0xD4, 0x04, 0x9C, 0x8E, 0x98, 0xBF, 0x9C, 0x2E, 0x6E, 0xB1, 0x38,
+    0x3B, 0x60, 0xDE, 0x09, 0xD4, 0xFF, 0x3B, 0x51, 0x4D, 0x6B, 0xC8, 0xC6, 0x73, 0xA6, 0x27, 0x7A,
+    0xFA, 0xFF, 0xBC, 0xEB, 0x1A, 0x91, 0x8E, 0x7E, 0xCF, 0xC1, 0x02, 0xFD, 0x60, 0x89, 0xE7, 0x5E,
+    0x76, 0x94, 0x2E, 0x53, 0x93, 0xDF, 0x7D, 0x97, 0x4F, 0x2E, 0x31, 0x0D, 0x3B, 0x97, 0xE0, 0x8C,
+    0x1D, 0x12, 0xA6, 0x33, 0x9F, 0x62, 0x97, 0x8A, 0xC7, 0x4B, 0xF6, 0x3F, 0x1B, 0xCF, 0xD3, 0x57,
+    0x10, 0x05, 0xB0, 0x7B, 0xE8, 0x25, 0xD2, 0xFF, 0x44, 0x70, 0x43, 0x13, 0xDA, 0x81, 0x6C, 0x2E,
+    0xDD, 0x19, 0x8A, 0x19, 0xF2, 0xBA, 0x74, 0x69, 0x5F, 0x0E, 0x34, 0xEF, 0x25, 0x74, 0x74, 0x54,
+    0xC9, 0x8C, 0x2A, 0xAB, 0xFD, 0x9F, 0xCE, 0xB4, 0x32, 0xA3, 0x24, 0x2D, 0xD7, 0xB2, 0xD4, 0xAB,
+    0x07, 0xA6, 0x77, 0x7A, 0x9E, 0xCE, 0xE9, 0x80, 0x7F, 0x79, 0x25, 0x17, 0xF9, 0x29, 0x64, 0x1F,
+    0x16, 0x0C, 0x6D, 0x0E, 0x37, 0x85, 0xDC, 0x82, 0xA1, 0x97, 0x81, 0xEC, 0xD3, 0xEA, 0xF9, 0xFA,
+    0xE1, 0x8E, 0x41, 0x1F, 0xC1, 0x7E, 0x77, 0xA0, 0x1E, 0x8F, 0xAE, 0x62, 0xE8, 0xA7, 0xD5, 0x73,
+    0xF7, 0x58, 0x89, 0x69, 0xEA, 0xE8, 0xE0, 0x4B, 0x9F, 0xD0, 0x6E, 0xC7, 0x66, 0xE9, 0xB0, 0xB4,
+    0x38, 0xAC, 0x51, 0x53, 0x33, 0xD2, 0x5E, 0x3D, 0x80, 0x67, 0x3B, 0xB6, 0xD5, 0x21, 0xD1, 0x58,
+    0x4E, 0xE2, 0x9D, 0x63, 0xE8, 0xB7, 0x3F, 0x2E, 0x18, 0xDA, 0xC8, 0xF3, 0xA1, 0x40, 0xC1, 0xE5,
+    0xDB, 0x19, 0x7B, 0x6A, 0x11, 0x91, 0x3D, 0xED, 0xC7, 0xFF, 0x4E, 0x64, 0x66, 0x37, 0xE8, 0x08,
+    0x6A, 0x3E, 0x5C, 0xB2, 0xA9, 0x43, 0x71, 0xF7, 0x03, 0x18, 0x4F, 0x53, 0xD2, 0x08, 0xC6, 0x53,
+    0x4E, 0xE5, 0x82, 0x03, 0xFB, 0xE1, 0xED, 0xA1, 0x87, 0x56, 0xC4, 0xAF, 0x4B, 0x86, 0xE1, 0xAC,
+    0x68, 0xEF, 0xE2, 0x6D, 0x5D, 0xDE, 0x96, 0x0B, 0x3D, 0x8B, 0x76, 0x73, 0x71, 0xD9, 0x32, 0x94,
+    0xE3, 0xA9, 0xD0, 0xEC, 0xBF, 0xB6, 0xBF, 0xFD, 0x03, 0x2A, 0x91, 0xE5, 0xCC, 0x75, 0xB9, 0xFD,
+    0x75, 0xE3, 0x81, 0x05, 0x6F, 0xF7, 0x68, 0x91, 0x4A, 0x04, 0xF7, 0x13, 0x69, 0x7F, 0xB2, 0xD7,
+    0x89, 0x5D, 0x22, 0xB7, 0x03, 0xE2, 0x75, 0xCC, 0xE8, 0x8C, 0x7D, 0x65, 0xC4, 0x04, 0x95, 0x1D,
+    0xB8, 0x67, 0x77, 0x21, 0x83, 0xC8, 0x5C, 0x07, 0xB4, 0xEC, 0x3B, 0x3B, 0x60, 0x46, 0x58, 0x97,
+    0x6B, 0x13, 0x09, 0x5D, 0x62, 0x0E, 0x6D, 0x04, 0x33, 0x2A, 0x09, 0x60, 0xEF, 0xDC, 0x7C, 0xF7,
+    0xCE, 0x53, 0x43, 0x2B, 0xD9, 0xCA, 0x1E, 0x2B, 0x9D, 0x95, 0x40, 0x71, 0x8B, 0xAE, 0x1D, 0x1F,
+    0xBF, 0xB8, 0x13, 0xF9, 0xB9, 0x88, 0xFC, 0xC7, 0xE3, 0xE3, 0x17, 0xAF, 0x1D, 0x1F, 0x1F, 0x1F,
+    0x97, 0x47, 0x22, 0xE5, 0xB1, 0x94, 0xA2, 0xE3, 0xE3, 0xE3, 0xE3, 0x17, 0x79, 0xB3, 0xF6, 0xAB,
+    0x2A, 0x1A, 0x3F, 0xD7, 0xD1, 0x0D, 0x2F, 0x52, 0x4D, 0xC6, 0x9F, 0xE9, 0x68, 0x87, 0xAC, 0xC7,
+    0x96, 0x1B, 0xF0, 0x66, 0xD3, 0x9D, 0xD4, 0x7E, 0xA5, 0x63, 0x5B, 0x4D, 0xC6, 0x67, 0x33, 0x9E,
+    0xD5, 0xD1, 0xE9, 0xD4, 0x0E, 0x2F, 0x5E, 0xEB, 0xA8, 0xA6, 0x76, 0x38, 0x3C, 0x9A, 0xEC, 0x90,
+    0x8C, 0xDF, 0xE8, 0x71, 0x55, 0x45, 0xCB, 0x8D, 0x6B, 0x17, 0xCB, 0x72, 0xC3, 0xDA, 0xF9, 0x76,
+    0x34, 0xF7, 0x72, 0x35, 0x23, 0xAE, 0x6B, 0xBD, 0x19, 0x3B, 0x6E, 0xF0, 0xC4, 0xFF, 0x05, 0xBD,
+    0x99, 0x31, 0xB0, 0x2C, 0x39, 0x75, 0x86, 0xBF, 0x96, 0xFC, 0x56, 0x55, 0x28, 0x10, 0x01, 0x04,
+    0x86, 0x40, 0x39, 0x49, 0xC7, 0xAE, 0x32, 0x23, 0x2D, 0x0E, 0x37, 0xF0, 0x06, 0x2C, 0xB8, 0x6A,
+    0x83, 0x17, 0xBB, 0x1C, 0xBC, 0xDC, 0xB5, 0xB7, 0xA7, 0xF1, 0x06, 0x0E, 0x36, 0xE0, 0x25, 0x86,
+    0x80, 0x00, 0x02, 0x08, 0xB8, 0x04, 0x2F, 0x25, 0x98, 0xB9, 0xA3, 0x85, 0x80, 0xC0, 0x01, 0xF2,
+    0x62, 0xE3, 0xD0, 0x6D, 0xBC, 0x9B, 0xB0, 0x01, 0xDA, 0xB2, 0x16, 0xFA, 0x3D, 0x6B, 0xE6, 0x38,
+    0x50, 0xCF, 0x7D, 0xEF, 0xED, 0x2E, 0x94, 0x23, 0x77, 0xD5, 0xDC, 0xB9, 0xD5, 0x23, 0xA9, 0x8F,
+    0x8E, 0xCE, 0xF9, 0xFF, 0x73, 0xFE, 0x06, 0x00, 0x3B, 0x17, 0x68, 0x63, 0xC4, 0xFD, 0x43, 0x81,
+    0x1F, 0xFC, 0x39, 0xF7, 0x97, 0x12, 0x69, 0x04, 0x91, 0x64, 0x44, 0x56, 0x8E, 0x80, 0x4D, 0x40,
+    0x03, 0x5C, 0x82, 0x61, 0x05, 0xC6, 0x08, 0xBA, 0x00, 0xE1, 0xF6, 0x36, 0x6A, 0x91, 0xC2, 0x5E,
+    0x04, 0x9B, 0x3F, 0x39, 0xCE, 0x47, 0x50, 0x05, 0x08, 0x6C, 0x13, 0xF6, 0xB7, 0xB7, 0xD1, 0x8A,
+    0xAC, 0x88, 0x48, 0x64, 0xFB, 0x85, 0x53, 0x04, 0x24, 0x82, 0x96, 0x19, 0xCC, 0x7F, 0xCC, 0xE0,
+    0x7E, 0x99, 0xC0, 0x7F, 0x3B, 0x41, 0xB0, 0x09, 0x26, 0x9B, 0xA0, 0xD9, 0x8C, 0xAA, 0x26, 0xA3,
+    0x8B, 0x59, 0xB0, 0x59, 0x2F, 0xB8, 0xA4, 0x0B, 0xE3, 0x66, 0x41, 0xE1, 0x72, 0xFB, 0x93, 0x32,
+    0x34, 0x54, 0xD5, 0x05, 0x55, 0xCD, 0xC2, 0xB0, 0xBA, 0xC4, 0xB0, 0x8E, 0x33, 0xB4, 0x00, 0xB4,
+    0x3B, 0xA0, 0x31, 0x8A, 0x2C, 0x5A, 0xE4, 0xCC, 0x5E, 0x24, 0xD9, 0x0C, 0x1C, 0x36, 0xBB, 0x69,
+    0x80, 0x9F, 0x41, 0x55, 0x20, 0xBC, 0x01, 0x5A, 0x64, 0x26, 0x88, 0x60, 0x96, 0x37, 0x1B, 0x47,
+    0x7C, 0x76, 0x89, 0x3B, 0x1A, 0x66, 0xF1, 0x33, 0xD3, 0x50, 0xB1, 0x79, 0x84, 0xA6, 0x0B, 0x63,
+    0x0A, 0xD8, 0x6A, 0x9E, 0x3D, 0xB9, 0x70, 0x12, 0x89, 0x4E, 0x2E, 0x11, 0xC6, 0xCB, 0x63, 0x10,
+    0x59, 0x31, 0x22, 0x8D, 0x31, 0xDA, 0x95, 0x03, 0xA6, 0xE8, 0x82, 0x4B, 0x2E, 0x11, 0x98, 0x18,
+    0x56, 0x55, 0x71, 0xD9, 0x25, 0x2E, 0x84, 0xDB, 0xD3, 0x82, 0x48, 0xC5, 0x88, 0x2C, 0x8C, 0xD1,
+    0x14, 0xDA, 0x36, 0x3C, 0xFB, 0x99, 0x31, 0xDE, 0xC0, 0x59, 0x15, 0x74, 0x71, 0x89, 0x31, 0x05,
+    0xD4, 0x79, 0xB8, 0xDC, 0x9E, 0x16, 0x2B, 0x72, 0x26, 0xF4, 0x27, 0x8A, 0xCC, 0x4E, 0x64, 0x31,
+    0x22, 0x55, 0xD5, 0x6D, 0x73, 0x61, 0xDB, 0xA0, 0x59, 0xB6, 0xBD, 0xB5, 0xEB, 0xCD, 0xF9, 0x33,
+    0x6E, 0xFA, 0x19, 0x4C, 0xFE, 0x8C, 0x9B, 0x36, 0x6F, 0x27, 0x09, 0xEC, 0x45, 0x16, 0xB0, 0x22,
+    0x67, 0x40, 0x44, 0x32, 0xB8, 0x99, 0x06, 0xAA, 0xE2, 0x12, 0x04, 0x86, 0x15, 0x74, 0x61, 0x8C,
+    0x30, 0xA1, 0x0B, 0xD8, 0x4C, 0x00, 0x1A, 0xBA, 0x80, 0x9B, 0x99, 0x60, 0xA8, 0xD8, 0x0C, 0x23,
+    0x34, 0xD0, 0x05, 0x97, 0x60, 0x82, 0x15, 0x5C, 0xC2, 0xCF, 0x0C, 0x2B, 0xAA, 0x42, 0x80, 0x00,
+    0x76, 0x41, 0x17, 0x86, 0x06, 0x13, 0x84, 0x88, 0xCD, 0x3C, 0x79, 0x76, 0x7B, 0x2B, 0x3F, 0xF0,
+    0x22, 0x22, 0xA2, 0x44, 0x44, 0xA4, 0x04, 0x80, 0x9D, 0x2E, 0x80, 0xC9, 0x3B, 0x80, 0xA3, 0xC9,
+    0x80, 0x4B, 0x07, 0x80, 0x36, 0x44, 0xE0, 0x01, 0x8C, 0x22, 0x49, 0x8B, 0x34, 0xF6, 0x22, 0xF3,
+    0x9F, 0x0A, 0x03, 0x40, 0x3F, 0xBB, 0xFD, 0x61, 0x0F, 0x03, 0x91, 0xC2, 0xF1, 0x93, 0xE3, 0x86,
+    0x0A, 0x8C, 0xD7, 0x30, 0x0F, 0x80, 0x79, 0x76, 0xFB, 0x43, 0x4E, 0xFD, 0x28, 0x2A, 0xE8, 0xCC,
+    0x08, 0x67, 0x74, 0x21, 0xA0, 0x57, 0x86, 0x4A, 0xC0, 0x2E, 0xD0, 0x98, 0x18, 0x13, 0x1C, 0x38,
+    0xB2, 0x07, 0x76, 0xB4, 0xA1, 0x01, 0x23, 0x4D, 0x57, 0xC0, 0xCF, 0xAB, 0xCB, 0x80, 0x7B, 0x77,
+    0x0D, 0x33, 0x60, 0xDE, 0xAB, 0x77, 0x00, 0x5A, 0xA4, 0x6D, 0xDF, 0x05, 0xC0, 0x6D, 0xDF, 0xE1,
+    0x1F, 0xDF, 0xAB, 0x00, 0x27, 0x9B, 0x1A, 0xA0, 0x9A, 0x4B, 0x0D, 0x30, 0xC5, 0xA5, 0x09, 0x70,
+    0xD9, 0xCF, 0x01, 0x08, 0x71, 0x8C, 0x63, 0x84, 0x0B, 0x23, 0x2E, 0xA1, 0x1A, 0x01, 0x97, 0xB0,
+    0x85, 0x1D, 0x66, 0xC1, 0xA7, 0x7E, 0x62, 0xFB, 0xC8, 0xB1, 0x3B, 0x01, 0xE0, 0x91, 0xE4, 0xFE,
+    0x3C, 0xF7, 0xC1, 0xA9, 0x00, 0x3E, 0x03, 0xE3, 0x0C, 0x4C, 0x6C, 0x39, 0x6F, 0xF3, 0x75, 0xFF,
+    0x05, 0x75, 0x2B, 0xE0, 0xE5, 0x31, 0x9C, 0x64, 0x06, 0xC6, 0xB4, 0x79, 0xAB, 0xA7, 0x7D, 0xBB,
+    0xBA, 0xCB, 0x27, 0xE0, 0x02, 0xD8, 0x62, 0x3E, 0xF8, 0x86, 0x44, 0x2F, 0x52, 0x19, 0xE5, 0x02,
+    0x7C, 0x9D, 0xEE, 0x57, 0x5B, 0x68, 0xB0, 0x4F, 0x66, 0x41, 0x5F, 0x18, 0x23, 0xA1, 0x72, 0x44,
+    0x49, 0xD2, 0x05, 0x7F, 0xC2, 0x25, 0xDA, 0xCA, 0x84, 0xFB, 0xC5, 0xA2, 0x2A, 0xC7, 0x31, 0xBA,
+    0x64, 0x96, 0x46, 0x60, 0xA7, 0x0B, 0x4D, 0x17, 0x3F, 0x9B, 0x65, 0xE4, 0xC8, 0xF8, 0x6A, 0x55,
+    0x85, 0xE6, 0x66, 0x97, 0x74, 0x69, 0x04, 0xFC, 0x3B, 0x69, 0x58, 0x39, 0xDE, 0x60, 0xB3, 0xFA,
+    0xC3, 0x42, 0xC0, 0x09, 0x34, 0x42, 0xC1, 0x2C, 0x83, 0x44, 0xFC, 0x6C, 0x57, 0x38, 0x12, 0x52,
+    0x37, 0xF5, 0x4B, 0x7C, 0x05, 0x38, 0xB0, 0xC2, 0xF0, 0xF4, 0x61, 0x02, 0x25, 0x0D, 0x18, 0xEE,
+    0x22, 0x2F, 0x5E, 0x76, 0xF3, 0x28, 0xBE, 0x0C, 0x2B, 0xC8, 0x6C, 0x33, 0xEE, 0xCC, 0x18, 0x39,
+    0x15, 0x1A, 0xE6, 0x77, 0x49, 0x17, 0xC2, 0x0E, 0x3F, 0xEB, 0x8F, 0x56, 0x8E, 0x8C, 0xAF, 0x65,
+    0x5D, 0x86, 0x35, 0xE0, 0x92, 0x9B, 0x1B, 0x81, 0x66, 0x96, 0x61, 0xB5, 0x69, 0x8C, 0x36, 0xDF,
+    0x70, 0x20, 0xE8, 0x45, 0x17, 0x5A, 0xC0, 0x25, 0xF3, 0x9B, 0xC2, 0xC4, 0xF8, 0x30, 0xAA, 0xCA,
+    0x71, 0xC5, 0x25, 0x2D, 0x89, 0x80, 0x6B, 0x0C, 0x2B, 0xFB, 0x8C, 0x59, 0xD4, 0x05, 0xC6, 0xE8,
+    0x4A, 0xF7, 0xF0, 0x48, 0x3F, 0xD9, 0x10, 0xCD, 0x42, 0x88, 0xAA, 0x12, 0x66, 0x0E, 0x8C, 0x33,
+    0x81, 0x31, 0xE1, 0x92, 0x4F, 0x98, 0xC5, 0x27, 0x54, 0x75, 0x19, 0x9A, 0xCB, 0x10, 0x24, 0x83,
+    0x93, 0x05, 0x8C, 0x34, 0x50, 0x35, 0x44, 0x68, 0x66, 0x81, 0x40, 0x03, 0x3F, 0x8F, 0x33, 0x36,
+    0xEB, 0x82, 0x2A, 0x1C, 0xA1, 0xE1, 0x13, 0x01, 0x5D, 0xF0, 0x33, 0x13, 0x36, 0x77, 0x5C, 0x56,
+    0xB5, 0xF3, 0x89, 0xC4, 0x2B, 0x3C, 0xEC, 0x45, 0xCA, 0x35, 0xD5, 0x5D, 0x62, 0x02, 0xBD, 0x30,
+    0xC6, 0x2B, 0x60, 0x74, 0x58, 0x08, 0xF4, 0x67, 0x30, 0x81, 0x4D, 0x8C, 0xF1, 0x8A, 0x0A, 0x2B,
+    0xBA, 0xC0, 0x0D, 0xC3, 0x0A, 0x23, 0xDC, 0x80, 0x4B, 0x8C, 0x11, 0xB3, 0xE0, 0x12, 0xAA, 0xA2,
+    0x0B, 0x34, 0x86, 0x15, 0x26, 0x38, 0x6E, 0x98, 0xF1, 0xB9, 0xD3, 0xBC, 0x39, 0x49, 0x17, 0x64,
+    0xEE, 0x51, 0xDA, 0xAF, 0x31, 0x83, 0x5D, 0x91, 0x19, 0xF6, 0x8B, 0xB9, 0x80, 0x96, 0x79, 0x6C,
+    0xE0, 0xCF, 0xDC, 0x15, 0xB8, 0x14, 0xFD, 0x61, 0xC2, 0xFE, 0x32, 0xB9, 0xEF, 0xC3, 0x6E, 0xC7,
+    0xCD, 0x5B, 0xA8, 0x8F, 0xAA, 0x2A, 0x15, 0xF7, 0x4E, 0x76, 0x3F, 0xCF, 0x1C, 0x02, 0xC1, 0xCD,
+    0x3A, 0x37, 0xD6, 0x1D, 0xC1, 0x2C, 0x26, 0x1F, 0x86, 0xEA, 0xE3, 0xA8, 0x8A, 0x4B, 0x07, 0x9A,
+    0x49, 0x37, 0xBA, 0xE8, 0xC5, 0xEB, 0xC5, 0x25, 0x3F, 0x7F, 0xD5, 0x33, 0x71, 0x43, 0x5D, 0x55,
+    0x55, 0x45, 0x7F, 0x98, 0x5C, 0x72, 0xC9, 0x5D, 0x08, 0xEC, 0x18, 0x0B, 0x6D, 0xA8, 0x9C, 0xA2,
+    0x59, 0x6C, 0x1E, 0x1A, 0x63, 0x0C, 0x98, 0x4C, 0x83, 0x11, 0x4C, 0xD6, 0x05, 0x8E, 0x4C, 0xE0,
+    0x92, 0xCD, 0xD0, 0x38, 0x80, 0x9F, 0x5D, 0x62, 0x58, 0x69, 0x30, 0x46, 0x3F, 0xA3, 0x4B, 0x07,
+    0xC9, 0x00, 0x66, 0xD1, 0xCF, 0x6E, 0x6F, 0xCF, 0x04, 0xE9, 0x2C, 0x2E, 0x8D, 0x23, 0x9D, 0x6C,
+    0x5E, 0x9A, 0x30, 0x54, 0x08, 0xDD, 0xBD, 0xBA, 0xC0, 0x44, 0x00, 0x9B, 0xCD, 0x02, 0x2F, 0x4D,
+    0xB8, 0xFA, 0x4A, 0x66, 0x38, 0xC9, 0x19, 0xE4, 0x83, 0x53, 0x46, 0xA2, 0x6E, 0x9C, 0x20, 0xC4,
+    0x3D, 0x98, 0x12, 0x22, 0x34, 0x9F, 0x20, 0xD8, 0x05, 0xDC, 0xAF, 0x0A, 0xE8, 0xDA, 0x80, 0xF3,
+    0x04, 0x84, 0x71, 0x06, 0xF7, 0xCB, 0x0C, 0xE6, 0xBF, 0x2B, 0xA8, 0xF5, 0x0C, 0xB4, 0x10, 0x61,
+    0x6F, 0x17, 0x08, 0xAF, 0x36, 0xF0, 0x29, 0x44, 0x7C, 0xB6, 0x15, 0xBF, 0x20, 0xFF, 0x74, 0x5A,
+    0x70, 0x5B, 0xC8, 0xCC, 0xF7, 0x30, 0x20, 0x1D, 0xAF, 0x3B, 0x60, 0x4B, 0xB2, 0x99, 0x61, 0xE5,
+    0x00, 0x63, 0x74, 0x09, 0x5D, 0x68, 0x10, 0xB8, 0x77, 0xC6, 0xB6, 0xA1, 0x1E, 0x14, 0x3B, 0x70,
+    0xC9, 0x2C, 0xB0, 0x72, 0xDC, 0xBC, 0xA7, 0xEA, 0x0B, 0x13, 0x86, 0x0A, 0x13, 0x63, 0xDC, 0x26,
+    0x1C, 0x09, 0xD7, 0x09, 0xED, 0xC5, 0x09, 0x8C, 0x97, 0xC7, 0x68, 0x91, 0xB4, 0x55, 0x3C, 0xA6,
+    0x71, 0xE8, 0xCC, 0x7D, 0xA4, 0x61, 0xB3, 0x9F, 0x39, 0xAA, 0x8A, 0x4B, 0x81, 0xA1, 0xE9, 0x42,
+    0x88, 0x3B, 0x7C, 0x31, 0x22, 0x8D, 0x93, 0x5C, 0x70, 0xBF, 0xFD, 0xF1, 0x9F, 0xA4, 0x8C, 0x05,
+    0x9E, 0x53, 0x4B, 0xBF, 0x86, 0x93, 0xC4, 0xCE, 0x4F, 0x97, 0xEF, 0x34, 0x4E, 0x33, 0x9F, 0xB7,
+    0x15, 0x08, 0x11, 0xF4, 0x7A, 0xC5, 0xCE, 0xBB, 0xEB, 0x2A, 0x2E, 0x6D, 0x58, 0xAC, 0x9E, 0x63,
+    0x71, 0x04, 0xCE, 0x6C, 0x54, 0x66, 0x97, 0xEB, 0x9C, 0x30, 0x03, 0xFB, 0x19, 0x38, 0x7D, 0xF0,
+    0x66, 0xEC, 0x47, 0xBB, 0x97, 0x05, 0x86, 0xD7, 0x21, 0x88, 0xC8, 0xF7, 0x45, 0xE4, 0x43, 0x11,
+    0xA9, 0xCF, 0x89, 0xFF, 0x8F, 0x56, 0x03, 0x7F, 0xF4, 0xE6, 0xB4, 0x11, 0xC4, 0xA7, 0x6F, 0xC6,
+    0xEE, 0x01, 0x97, 0xFC, 0x8C, 0x5A, 0x69, 0xB0, 0xC7, 0x25, 0x5C, 0xE6, 0xC8, 0xD0, 0x30, 0x4B,
+    0x4F, 0x5F, 0xBB, 0xA0, 0x0A, 0x0D, 0x7C, 0x1C, 0x23, 0xAC, 0xBA, 0x80, 0x4B, 0x67, 0xE0, 0xE0,
+    0x67, 0x30, 0xBF, 0x2A, 0xC0, 0xEE, 0x06, 0xD0, 0x92, 0x80, 0xB1, 0x02, 0xC3, 0x85, 0xEB, 0x36,
+    0xF5, 0x0A, 0x70, 0x62, 0xA3, 0x9F, 0x07, 0x8F, 0x2A, 0x20, 0x67, 0xC0, 0x5D, 0x00, 0xBE, 0xF0,
+    0x12, 0x6E, 0x6F, 0xB5, 0xCD, 0x16, 0xF6, 0xC7, 0xCE, 0x79, 0x97, 0x8E, 0x62, 0x2B, 0x46, 0xBE,
+    0xF7, 0x7B, 0x99, 0xCD, 0xAA, 0xAA, 0xA9, 0x7A, 0xE5, 0xC8, 0x5E, 0xAD, 0x04, 0x5C, 0x6A, 0xB8,
+    0xA4, 0xEA, 0x84, 0x59, 0x38, 0x8E, 0x51, 0x55, 0xC6, 0xD7, 0x32, 0x0D, 0xF7, 0xB3, 0x42, 0x40,
+    0x97, 0x23, 0x7E, 0x56, 0xEB, 0x38, 0x9B, 0x85, 0xA6, 0x8B, 0xAA, 0x5C, 0x38, 0xD1, 0x06, 0xC1,
+    0x9D, 0xF7, 0x6F, 0x0A, 0x88, 0xC8, 0x19, 0x5E, 0x11, 0x79, 0x9F, 0xCD, 0xC9, 0xDD, 0x4F, 0x1B,
+    0x4F, 0xF2, 0x00, 0x7A, 0xA1, 0xA6, 0xBB, 0x53, 0x22, 0x13, 0xAA, 0x42, 0x63, 0x9C, 0x51, 0x75,
+    0x68, 0x60, 0x16, 0x97, 0xAE, 0x8E, 0x19, 0x5F, 0xCB, 0xC0, 0x6E, 0x02, 0x90, 0x02, 0x0C, 0xC2,
+    0xFD, 0xC2, 0x61, 0x01, 0x94, 0x24, 0xC0, 0x7F, 0x3F, 0x02, 0x6D, 0x07, 0xF4, 0x1A, 0xE1, 0x38,
+    0x54, 0x30, 0x8B, 0x2E, 0xDB, 0x59, 0x74, 0x40, 0x0F, 0x91, 0x80, 0x5A, 0xE1, 0x8C, 0x4F, 0x57,
+    0xF0, 0xB5, 0xA9, 0xE7, 0xD5, 0x04, 0x6E, 0xEE, 0x89, 0x78, 0xFC, 0x74, 0x22, 0x9A, 0x45, 0xD5,
+    0x2D, 0x99, 0xAE, 0x89, 0x78, 0xCD, 0xAB, 0xCF, 0x9E, 0x70, 0xCD, 0xDC, 0xFB, 0x44, 0xBC, 0x4E,
+    0x78, 0x76, 0x7B, 0x7B, 0xF9, 0xC1, 0x49, 0x44, 0x2E, 0x4E, 0x44, 0x64, 0xB9, 0x3F, 0x9E, 0x9E,
+    0x2A, 0x6D, 0x73, 0xD0, 0x96, 0x55, 0x3C, 0xC0, 0x64, 0xF4, 0xD2, 0x60, 0x72, 0x09, 0x9B, 0x57,
+    0x68, 0x7E, 0xC6, 0xFD, 0xAC, 0xF6, 0x46, 0xC0, 0xBF, 0x5D, 0x50, 0x75, 0x07, 0xC1, 0x14, 0x74,
+    0x09, 0xB0, 0xD3, 0x2B, 0x76, 0xF1, 0xCF, 0x9E, 0x9C, 0x39, 0x89, 0x24, 0x4E, 0xCF, 0x3E, 0x5D,
+    0x02, 0x7E, 0x76, 0x9E, 0xB6, 0x2B, 0x1B, 0xAD, 0x34, 0x54, 0xC1, 0x2C, 0x9D, 0x90, 0xC6, 0x38,
+    0xC6, 0x4E, 0x66, 0x07, 0x86, 0xB5, 0xA3, 0xAC, 0xCD, 0xB8, 0xD9, 0x25, 0x02, 0x4C, 0x4C, 0xD0,
+    0x50, 0x55, 0x55, 0xF4, 0xD2, 0xE1, 0xD6, 0xCF, 0x1D, 0xC2, 0x8F, 0x0C, 0x6B, 0xA7, 0x3B, 0x9B,
+    0x5F, 0x58, 0x6C, 0x82, 0x46, 0x63, 0xA8, 0xF7, 0x8B, 0xF9, 0xD9, 0xCF, 0x7D, 0xC2, 0x4D, 0xA7,
+    0x4F, 0x55, 0x3A, 0x1D, 0x76, 0x66, 0x0C, 0xFD, 0xF9, 0xC3, 0x3A, 0x5C, 0x6E, 0x7F, 0xF2, 0xEC,
+    0xF6, 0x49, 0xB6, 0x22, 0x22, 0x22, 0x04, 0x11, 0x11, 0x79, 0xD9, 0xF2, 0xFA, 0x19, 0x96, 0x1F,
+    0x5F, 0xB2, 0x3C, 0x7D, 0x86, 0xE5, 0xE5, 0x33, 0x2C, 0x6F, 0xE8, 0x4F, 0xB8, 0xE1, 0x6A, 0xF9,
+    0xFA, 0xC7, 0x2C, 0x57, 0x45, 0xD5, 0x4F, 0x59, 0x7E, 0x78, 0x6E, 0xF9, 0xB3, 0xD7, 0xBA, 0xE5,
+    0xE7, 0x6E, 0xB9, 0x6C, 0x2D, 0xC8, 0x15, 0x28, 0xC3, 0x06, 0x96, 0x1B, 0x5D, 0xD9, 0xBC, 0x91,
+    0xD6, 0x96, 0xD5, 0x5F, 0x20, 0x48, 0xC2, 0x4B, 0xC1, 0xCA, 0xBA, 0x9D, 0xDD, 0xB5, 0x21, 0xD2,
+    0x65, 0x9B, 0x77, 0x04, 0xC2, 0x8F, 0x22, 0x4E, 0x2E, 0x18, 0x91, 0x32, 0xAC, 0xAF, 0x5C, 0x38,
+    0xE2, 0x53, 0x40, 0x57, 0x97, 0x38, 0x9A, 0x85, 0xF1, 0x6B, 0x15, 0x97, 0x0E, 0xE8, 0x12, 0xD0,
+    0xAB, 0x4B, 0xAA, 0x99, 0x67, 0x4F, 0xCE, 0x4A, 0xA4, 0x21, 0xF2, 0x7E, 0x7F, 0x60, 0x27, 0xEC,
+    0xCE, 0xD8, 0x1B, 0x65, 0x77, 0xCE, 0xEE, 0x2C, 0xB2, 0xF1, 0x0E, 0x23, 0x7E, 0x66, 0x0B, 0x78,
+    0x02, 0xE1, 0x47, 0x11, 0xB3, 0x68, 0x91, 0x99, 0x23, 0x41, 0x04, 0x97, 0xCC, 0xF2, 0xE5, 0x95,
+    0xC6, 0x11, 0x9F, 0x5C, 0x72, 0x89, 0xF3, 0xB0, 0xD2, 0xB0, 0x79, 0x8C, 0x7E, 0xE6, 0xAC, 0xCB,
+    0xD0, 0x89, 0x66, 0x8C, 0x43, 0x33, 0x8B, 0x2E, 0x84, 0x78, 0x43, 0xC0, 0x15, 0x9B, 0xCD, 0xB3,
+    0x27, 0x8D, 0xC6, 0x49, 0x04, 0x97, 0x9C, 0x5C, 0xAE, 0x59, 0x4B, 0xD8, 0xD0, 0xF7, 0xB8, 0xF5,
+    0x3A, 0xAD, 0x7F, 0x86, 0xB5, 0x87, 0xB9, 0x7E, 0xF6, 0x75, 0xB4, 0xC8, 0xAC, 0x45, 0x8A, 0x59,
+    0xEC, 0x6A, 0xF3, 0xD0, 0x5C, 0xE2, 0xEC, 0x12, 0x77, 0x7E, 0xE6, 0xE8, 0x23, 0xE7, 0x31, 0xD2,
+    0x02, 0x6A, 0x0D, 0xD8, 0xB2, 0xBF, 0x95, 0x7C, 0x12, 0xE9, 0x7B, 0xDF, 0x3A, 0x84, 0xF7, 0x41,
+    0xE4, 0x02, 0x97, 0xEF, 0xC8, 0x7C, 0x6D, 0x11, 0x4C, 0xB9, 0xE2, 0x8F, 0xAA, 0xD7, 0x63, 0xBA,
+    0xFE, 0xF9, 0xDC, 0xED, 0x4F, 0x56, 0xB6, 0x8A, 0x5F, 0xEA, 0x35, 0xCD, 0x4C, 0xB9, 0x92, 0x95,
+    0x4B, 0xD7, 0xCE, 0x21, 0xC4, 0xAD, 0x4D, 0x30, 0x8D, 0xBF, 0x7F, 0xE3, 0x54, 0xD8, 0xF7, 0xD6,
+    0x7C, 0x05, 0xDE, 0x78, 0x01, 0xC3, 0x55, 0x61, 0x90, 0x15, 0x02, 0x83, 0x48, 0xC5, 0x2C, 0x9C,
+    0x3E, 0x38, 0x65, 0x8E, 0xF8, 0x85, 0x13, 0x36, 0xE9, 0x8A, 0x5E, 0x69, 0x5C, 0xC0, 0x27, 0x97,
+    0x7C, 0x82, 0x36, 0xAC, 0xBA, 0x82, 0xCD, 0x63, 0x0C, 0xC0, 0x51, 0x17, 0xBB, 0x80, 0xCD, 0xE1,
+    0xF6, 0x0C, 0x1C, 0xB5, 0x48, 0x02, 0x97, 0xF7, 0xD2, 0x80, 0x66, 0xB3, 0x4F, 0xE0, 0x53, 0x1B,
+    0x1A, 0xA8, 0xB5, 0x2F, 0x11, 0x5E, 0x5D, 0x87, 0x06, 0xBA, 0xF8, 0xE8, 0x12, 0xDC, 0xA9, 0xCA,
+    0x19, 0x7C, 0x0A, 0xD8, 0x82, 0xAE, 0xBA, 0x10, 0xE6, 0xE1, 0xC2, 0xC4, 0x20, 0x6F, 0x48, 0xB2,
+    0xB9, 0x37, 0xF8, 0x0D, 0x6C, 0x47, 0x33, 0x86, 0x08, 0x30, 0x3C, 0x91, 0xD4, 0x45, 0x18, 0x44,
+    0x24, 0x11, 0xF2, 0xB0, 0x62, 0x0A, 0x63, 0xE4, 0x88, 0x2A, 0xF4, 0x14, 0x6C, 0x5B, 0x4D, 0x3C,
+    0xC1, 0x19, 0x9B, 0x31, 0x95, 0x06, 0xE3, 0xC7, 0x0F, 0x13, 0x9C, 0x64, 0xDD, 0x54, 0x0B, 0x2E,
+    0xAA, 0xC2, 0x98, 0x02, 0x5D, 0x41, 0xE0, 0xCC, 0x04, 0x61, 0x36, 0x19, 0x57, 0x38, 0xA2, 0x1A,
+    0x2E, 0xB1, 0x8F, 0x34, 0xDC, 0x82, 0x9F, 0xF5, 0xFA, 0xBC, 0xD5, 0x3B, 0x2D, 0x6F, 0xB1, 0x97,
+    0x77, 0x92, 0xFF, 0xF8, 0x66, 0xD5, 0x15, 0x89, 0x77, 0xD8, 0xE2, 0x12, 0x7B, 0xB5, 0x62, 0x96,
+    0x00, 0x93, 0x2E, 0xD8, 0x3C, 0x75, 0x59, 0xC6, 0xA5, 0x23, 0x6A, 0xB5, 0x99, 0x10, 0xEF, 0x70,
+    0xD5, 0x14, 0x25, 0x84, 0x6F, 0x3D, 0x2B, 0x83, 0x5C, 0x76, 0x58, 0xF9, 0xAB, 0xBC, 0x71, 0x18,
+    0x44, 0xF8, 0xBB, 0x4B, 0xAF, 0x34, 0xC2, 0xE5, 0x31, 0xBE, 0x6E, 0x81, 0x71, 0xDE, 0xD0, 0x56,
+    0x17, 0x60, 0xF2, 0x67, 0xDC, 0x3F, 0xCB, 0xCA, 0xE5, 0xE3, 0x7D, 0xF6, 0x95, 0x93, 0x3A, 0xA3,
+    0x4B, 0x48, 0x04, 0x5D, 0x3B, 0x5C, 0x07, 0x5D, 0xD0, 0x65, 0x07, 0x93, 0x5E, 0xB0, 0x79, 0xB7,
+    0x09, 0x30, 0xF3, 0x18, 0x4D, 0x19, 0xCE, 0xEA, 0x8C, 0x15, 0x89, 0x78, 0x99, 0xB9, 0x7F, 0x32,
+    0x56, 0x66, 0xF6, 0x52, 0x86, 0xCB, 0x37, 0x9B, 0xAE, 0x34, 0x97, 0x69, 0x7E, 0xA6, 0x8D, 0x51,
+    0xAD, 0x01, 0xBF, 0xEC, 0xE5, 0x12, 0xF7, 0x72, 0xE1, 0xEE, 0x8D, 0x47, 0xF9, 0x88, 0x29, 0x47,
+    0x74, 0x99, 0xD0, 0x25, 0x60, 0xCA, 0x98, 0xC7, 0xEC, 0x44, 0xA2, 0x92, 0x15, 0x1E, 0xC4, 0xAD,
+    0x32, 0x7B, 0xCA, 0x28, 0x67, 0x76, 0xDF, 0x68, 0x7D, 0x0F, 0x36, 0x43, 0x00, 0xB3, 0x32, 0xC8,
+    0xCC, 0xA9, 0x32, 0x3E, 0x45, 0x5F, 0x7A, 0xFD, 0xD3, 0xB5, 0x8D, 0x2E, 0x8B, 0x64, 0xCF, 0x5E,
+    0x1A, 0x41, 0x1E, 0xF3, 0x20, 0xC2, 0x2B, 0x3F, 0x06, 0x2F, 0xB5, 0x1F, 0x59, 0x34, 0x15, 0xD8,
+    0x6F, 0x71, 0xAF, 0xEA, 0x96, 0xAF, 0x2E, 0xBD, 0x22, 0x6F, 0x17, 0x2B, 0xAD, 0xD9, 0xD5, 0x5F,
+    0x6C, 0x41, 0xDE, 0x2E, 0xF8, 0xDF, 0xAC, 0xBD, 0xCA, 0x6E, 0x01, 0x82, 0x9F, 0xF1, 0xEF, 0x64,
+    0xEC, 0x7B, 0x15, 0x5D, 0x8E, 0xA8, 0xD5, 0xCF, 0x34, 0x5D, 0xB8, 0x70, 0x7A, 0xF5, 0x82, 0x93,
+    0x0B, 0x9C, 0xCE, 0xC0, 0xEB, 0xD7, 0x82, 0xFE, 0x8C, 0x91, 0x0B, 0xFB, 0x5F, 0x9F, 0x75, 0x55,
+    0x75, 0x9C, 0x4D, 0x6E, 0x8C, 0xAF, 0x65, 0xD5, 0xC2, 0x70, 0x4A, 0x22, 0xCD, 0xC8, 0x85, 0xF1,
+    0x31, 0x1C, 0x3B, 0xA7, 0x9A, 0xA5, 0x9B, 0x34, 0xE6, 0x2F, 0xC7, 0x20, 0x67, 0x46, 0x79, 0xBC,
+    0x45, 0x6C, 0xAF, 0x9B, 0x2E, 0xE8, 0x85, 0x7D, 0x76, 0x17, 0xDC, 0xEC, 0x24, 0x7E, 0xF1, 0xCC,
+    0x0D, 0xF2, 0x37, 0x0C, 0x4D, 0x15, 0xBB, 0x80, 0x2E, 0x2E, 0x05, 0xC0, 0xA6, 0xA0, 0x0A, 0x30,
+    0xB2, 0xBA, 0xD4, 0x85, 0x99, 0xA9, 0x8B, 0x18, 0x52, 0xBB, 0x88, 0x21, 0x09, 0xD8, 0x7D, 0xF3,
+    0xE3, 0x3D, 0xA0, 0xAA, 0x9F, 0xBB, 0xA2, 0x78, 0xD3, 0xE3, 0x42, 0x95, 0x0E, 0xD9, 0x2E, 0x8D,
+    0x91, 0xCF, 0xEF, 0xE3, 0x8E, 0x7D, 0x44, 0xEA, 0x50, 0x39, 0x55, 0x23, 0xD1, 0x26, 0x4E, 0xB9,
+    0x5B, 0xD5, 0xEB, 0xBA, 0x2F, 0x4B, 0x36, 0x22, 0xF3, 0xEE, 0x1B, 0xE7, 0x8E, 0x26, 0x53, 0x97,
+    0xB5, 0x1A, 0x5F, 0x3C, 0x45, 0x2B, 0x33, 0xD2, 0xC0, 0x16, 0x18, 0x23, 0xC3, 0x0A, 0x3E, 0xA2,
+    0xCB, 0xFB, 0xC3, 0xC5, 0x89, 0xA4, 0xBD, 0x64, 0x1E, 0x44, 0x54, 0xC1, 0xA6, 0xD0, 0xC3, 0xCB,
+    0xCD, 0x13, 0x43, 0xB5, 0x99, 0x31, 0x1E, 0xBA, 0x00, 0x17, 0xAE, 0x3A, 0xE0, 0x8D, 0xAA, 0xCF,
+    0xC7, 0xF9, 0xB4, 0x43, 0xAF, 0x66, 0xE1, 0x14, 0x03, 0x63, 0xD1, 0xAB, 0x7F, 0xC2, 0x28, 0xFF,
+    0xB5, 0x70, 0xAA, 0xBB, 0xED, 0x00, 0xEC, 0xEC, 0x22, 0x4D, 0x15, 0x6C, 0xBE, 0x83, 0x20, 0x33,
+    0x3C, 0x7A, 0xFC, 0x1C, 0xC2, 0x46, 0x38, 0xE8, 0x82, 0x4B, 0x01, 0x56, 0xB3, 0xE0, 0xE3, 0x11,
+    0x55, 0x6D, 0x7F, 0xA0, 0x2E, 0x2E, 0x31, 0x0D, 0x2B, 0x26, 0x8F, 0xF1, 0x7E, 0xDC, 0xD0, 0xF4,
+    0x42, 0x98, 0x27, 0x6C, 0xD5, 0xD7, 0xF4, 0x53, 0x5B, 0xFA, 0x2D, 0x3D, 0x09, 0x6E, 0xB0, 0x8B,
+    0x4D, 0x6A, 0xA5, 0xB1, 0xC7, 0x25, 0x9F, 0x86, 0x55, 0x17, 0xC6, 0xD8, 0xD0, 0x25, 0x44, 0xC2,
+    0xC3, 0x8C, 0x96, 0xB5, 0xF7, 0x5C, 0x36, 0xB7, 0x6B, 0x6A, 0x87, 0x2E, 0x50, 0xFA, 0xE8, 0x92,
+    0xAA, 0x9C, 0x09, 0x1D, 0x4D, 0x42, 0x84, 0xBD, 0x48, 0x97, 0xD1, 0x70, 0xBF, 0x7D, 0xB2, 0xA0,
+    0x17, 0x55, 0x19, 0x2A, 0x6D, 0x2B, 0xDC, 0x02, 0x6E, 0xC6, 0xCF, 0x66, 0xC1, 0xE6, 0x5E, 0x2C,
+    0x34, 0x58, 0x09, 0x70, 0x83, 0x9F, 0x19, 0x7B, 0x55, 0xA1, 0x0A, 0x36, 0xD3, 0x78, 0x58, 0x08,
+    0xEC, 0x0B, 0x7E, 0xF6, 0xE5, 0x9E, 0xC2, 0xD9, 0x47, 0x94, 0x30, 0x2E, 0x20, 0xB3, 0x6B, 0x20,
+    0x8B, 0xFE, 0x1D, 0x4C, 0x75, 0xF8, 0x43, 0x26, 0x1C, 0x38, 0x54, 0xC6, 0x40, 0xD8, 0xE1, 0xBE,
+    0x3D, 0xBB, 0x77, 0x92, 0xFB, 0x45, 0xD6, 0xFF, 0x52, 0xCC, 0x7B, 0x75, 0xA8, 0x7F, 0xA9, 0xCB,
+    0x81, 0x83, 0xFB, 0x5A, 0x09, 0x04, 0xBD, 0xAC, 0x6E, 0x76, 0xF3, 0x4F, 0x9B, 0xC9, 0x26, 0xFB,
+    0x1B, 0x55, 0x86, 0x62, 0x84, 0xC6, 0x01, 0x21, 0x10, 0x08, 0xB3, 0x9B, 0xDD, 0xEC, 0x92, 0xC9,
+    0x70, 0x83, 0x2A, 0xEA, 0x5E, 0x9D, 0x0D, 0x0C, 0xEB, 0xB0, 0x62, 0xB3, 0xCD, 0xD7, 0x72, 0xEA,
+    0xFC, 0xC6, 0x9B, 0x8B, 0x16, 0x91, 0xD9, 0x8B, 0x9C, 0x39, 0xF6, 0x92, 0xC6, 0x25, 0x97, 0x98,
+    0x98, 0x50, 0x75, 0xA8, 0xD8, 0xF4, 0x7C, 0x78, 0xEB, 0xF5, 0x22, 0xA0, 0x64, 0xC1, 0x88, 0x60,
+    0x9E, 0x3E, 0x2C, 0xBA, 0x72, 0xA7, 0x2B, 0xEE, 0xDD, 0x86, 0x2E, 0xC7, 0x2D, 0x87, 0x5D, 0xC2,
+    0xFD, 0x62, 0x41, 0x7F, 0x54, 0x19, 0xD6, 0x1B, 0x38, 0xFA, 0x99, 0xA0, 0x0B, 0xE3, 0x7C, 0xC6,
+    0x27, 0x9F, 0xC7, 0xA4, 0x44, 0x72, 0x87, 0xB5, 0x6B, 0xE3, 0x62, 0xDE, 0x95, 0xCC, 0xE1, 0x24,
+    0xB8, 0x27, 0xDF, 0x5B, 0x91, 0xE4, 0x93, 0x2F, 0x34, 0xD5, 0x70, 0x29, 0x74, 0x04, 0xF0, 0x73,
+    0xE8, 0x6A, 0x78, 0xE0, 0xF8, 0x89, 0xB0, 0x3D, 0x0E, 0x15, 0x97, 0x36, 0xF9, 0xBA, 0x8F, 0xDB,
+    0x96, 0x7D, 0xCB, 0x9E, 0x51, 0x1F, 0xC9, 0x19, 0xF7, 0xFD, 0xEF, 0x36, 0x42, 0xD1, 0x75, 0x10,
+    0xEC, 0x62, 0x2B, 0x7E, 0x0E, 0x33, 0x13, 0x67, 0x86, 0x55, 0x17, 0x6C, 0xF6, 0x89, 0x31, 0xDE,
+    0x41, 0xD3, 0x2B, 0xA6, 0xB8, 0x4C, 0x88, 0xFB, 0x79, 0x68, 0x83, 0xE0, 0xB3, 0xFD, 0xDD, 0xD7,
+    0x2E, 0x84, 0x20, 0x0B, 0x6D, 0x3C, 0x63, 0x96, 0x07, 0xBD, 0xF1, 0xE3, 0x70, 0xDF, 0xB0, 0x5E,
+    0xC5, 0x43, 0x55, 0x5F, 0xEE, 0x7B, 0x47, 0x99, 0x8D, 0x08, 0xFB, 0x7F, 0xFB, 0xA9, 0xAE, 0x10,
+    0x22, 0x43, 0xBB, 0x47, 0x58, 0x5A, 0xC7, 0xA3, 0x31, 0xC2, 0xB1, 0x4F, 0x7D, 0x0E, 0x4F, 0x5F,
+    0x22, 0xC8, 0xFA, 0x49, 0x78, 0x7A, 0xCB, 0xAF, 0x9C, 0x32, 0x87, 0xBD, 0x18, 0xA9, 0x3C, 0xFD,
+    0x78, 0xFF, 0xF0, 0xBB, 0x0D, 0x99, 0xFD, 0x81, 0x36, 0x08, 0x9B, 0xC3, 0x7C, 0xA6, 0xE9, 0x15,
+    0x9F, 0x3A, 0x97, 0xC4, 0x61, 0xD5, 0x85, 0xC0, 0xD0, 0x5D, 0xA7, 0xAA, 0xCD, 0x4C, 0xDD, 0x7F,
+    0x9B, 0x1B, 0x0F, 0xDD, 0x89, 0x0D, 0x9B, 0x7D, 0xA4, 0xE1, 0xD2, 0xC8, 0xB0, 0xE2, 0x52, 0x60,
+    0x13, 0x01, 0xB6, 0x0E, 0x6A, 0x93, 0xE0, 0xFC, 0xDC, 0x09, 0xFC, 0x88, 0x59, 0xF0, 0x51, 0x17,
+    0xCC, 0xA2, 0xD6, 0x5E, 0x7E, 0x13, 0xBA, 0xE8, 0x12, 0x40, 0x95, 0x31, 0xC2, 0xC1, 0x25, 0xF0,
+    0xAF, 0x65, 0x30, 0xBF, 0x5A, 0x80, 0xDF, 0x17, 0xE0, 0xAB, 0x2B, 0xE0, 0x1A, 0xA0, 0x2E, 0xCF,
+    0xFB, 0xDA, 0x78, 0x75, 0x9D, 0xBD, 0x2F, 0xB6, 0x4C, 0x01, 0xF5, 0xA4, 0x02, 0xB2, 0x02, 0xE3,
+    0x16, 0x81, 0x5D, 0x48, 0x09, 0xF7, 0xDD, 0x92, 0x59, 0xAE, 0xAE, 0xEF, 0x2D, 0x54, 0xE0, 0xDA,
+    0xF4, 0xC8, 0x53, 0xB0, 0x22, 0x05, 0xF7, 0xF4, 0x22, 0xB8, 0x25, 0xB8, 0xE2, 0x16, 0x3F, 0x9F,
+    0x4D, 0xB1, 0xD9, 0xBF, 0x5D, 0x54, 0xD1, 0xA5, 0xD1, 0x68, 0x13, 0x3B, 0xC2, 0x18, 0x7D, 0x74,
+    0xEF, 0x64, 0x9B, 0xCD, 0x6F, 0xAA, 0x2E, 0xBA, 0x4C, 0xB4, 0xA1, 0xB9, 0xB4, 0xE3, 0xAC, 0x9A,
+    0x8F, 0x17, 0xC2, 0x87, 0xBF, 0xBE, 0xA0, 0x45, 0xCE, 0x9D, 0xE9, 0xFA, 0x89, 0x77, 0xBB, 0x6D,
+    0xBA, 0xEF, 0xBA, 0x1B, 0x2F, 0xFD, 0xD2, 0x83, 0xE1, 0x80, 0x2E, 0xC3, 0x4A, 0x88, 0xBA, 0xE8,
+    0x15, 0x93, 0xC7, 0x19, 0xF7, 0x6E, 0x03, 0xFF, 0xD7, 0x09, 0x42, 0x03, 0x4E, 0x79, 0x2B, 0x1F,
+    0x6C, 0x05, 0xF6, 0x05, 0xCC, 0xFF, 0x24, 0x08, 0x6E, 0x46, 0xD7, 0x00, 0x21, 0x4E, 0x5D, 0x60,
+    0xF0, 0x69, 0xA8, 0x43, 0xA3, 0xCB, 0x96, 0xFF, 0x57, 0x50, 0x77, 0xD7, 0x71, 0x63, 0x0A, 0x2F,
+    0x80, 0x7A, 0xD5, 0xAB, 0x7F, 0x32, 0x8F, 0xF2, 0x9F, 0x32, 0x9F, 0xAA, 0xAB, 0xBC, 0xFE, 0xC2,
+    0x4B, 0x31, 0x40, 0x2F, 0xC0, 0xDF, 0xE2, 0x66, 0x26, 0x3F, 0x73, 0x1C, 0x23, 0x87, 0x00, 0x2D,
+    0x30, 0xB4, 0x80, 0x5A, 0x27, 0x4C, 0x9D, 0x70, 0x65, 0xCF, 0xBE, 0x84, 0x0F, 0xFF, 0xB0, 0x78,
+    0xF9, 0xF7, 0x45, 0x3D, 0xB5, 0xB9, 0x6F, 0xDA, 0xA5, 0x7E, 0x06, 0x63, 0xEC, 0x9F, 0x80, 0x2A,
+    0xB8, 0x2D, 0x97, 0xE3, 0x7D, 0x70, 0x3E, 0x8F, 0xCA, 0x80, 0x2E, 0x36, 0xBD, 0x10, 0x9C, 0x8B,
+    0x4B, 0xD7, 0x3D, 0xF4, 0x86, 0x81, 0xD6, 0xA3, 0xB2, 0x07, 0xA7, 0xAE, 0x8C, 0x73, 0xC0, 0x74,
+    0x7D, 0xCA, 0x15, 0x24, 0x06, 0x42, 0x55, 0x42, 0xF8, 0xD6, 0xC7, 0xCD, 0xEF, 0x19, 0x25, 0x77,
+    0xE6, 0x88, 0xFB, 0xFA, 0x55, 0x78, 0x9D, 0x07, 0xBD, 0xAC, 0xFE, 0x7F, 0x34, 0xE2, 0x51, 0x1C,
+    0x25, 0xCB, 0x65, 0x5C, 0xAD, 0xC4, 0x7D, 0xF7, 0xF0, 0x83, 0xEB, 0x9B, 0xA7, 0xEB, 0x57, 0x0F,
+    0xEA, 0x0D, 0x5D, 0x5F, 0x99, 0x47, 0x49, 0x68, 0x69, 0xF0, 0x95, 0xD3, 0xA7, 0xE5, 0xB5, 0x01,
+    0x8C, 0xC8, 0xCC, 0x49, 0x04, 0xFB, 0xAF, 0x66, 0xA5, 0x75, 0xC8, 0x6E, 0x2F, 0xFE, 0x33, 0xCE,
+    0xB6, 0xDA, 0x42, 0x90, 0x33, 0x9C, 0x2E, 0xBD, 0x8A, 0x18, 0x2A, 0x0C, 0xD5, 0x26, 0xB0, 0x39,
+    0xB0, 0x29, 0xE0, 0x5D, 0x0C, 0xD7, 0xCB, 0x18, 0xC1, 0xC7, 0xF6, 0x85, 0xDE, 0x23, 0xCC, 0xBA,
+    0x38, 0x91, 0xE4, 0xD2, 0x14, 0xF7, 0xF3, 0xA4, 0x2A, 0x61, 0xA8, 0x36, 0xD1, 0x6C, 0x0A, 0xE8,
+    0x12, 0x38, 0xE0, 0x52, 0x53, 0x2B, 0x77, 0x66, 0xD1, 0xD5, 0x96, 0x31, 0x5A, 0x91, 0x78, 0xC0,
+    0xC8, 0xA2, 0xCB, 0x56, 0x17, 0xA8, 0x6B, 0x91, 0xD8, 0x1B, 0x24, 0xD3, 0xDF, 0x8C, 0xD1, 0xFE,
+    0x0C, 0xDD, 0x09, 0x27, 0xDD, 0xC5, 0xFD, 0xCF, 0x0B, 0xC1, 0x25, 0x8E, 0x01, 0x55, 0x1B, 0xEE,
+    0x67, 0x95, 0xBD, 0xA9, 0xB6, 0x5A, 0x91, 0x68, 0x65, 0xB9, 0x2F, 0xF1, 0x5E, 0x91, 0x85, 0xBD,
+    0x54, 0x9E, 0x3E, 0x2A, 0xE0, 0x96, 0xFB, 0x85, 0x69, 0xBC, 0xF1, 0xCD, 0x62, 0x44, 0xD2, 0x28,
+    0xF2, 0x32, 0x9A, 0x36, 0x70, 0xF9, 0x2F, 0x5E, 0xB9, 0x20, 0xB2, 0x28, 0x39, 0xBF, 0x28, 0x8F,
+    0xF9, 0xC8, 0xE9, 0x7D, 0x6C, 0x56, 0x22, 0x51, 0x17, 0x75, 0x79, 0xB3, 0xD2, 0x86, 0xC6, 0x9E,
+    0x1D, 0x0D, 0x97, 0xFC, 0x3C, 0xA1, 0xAA, 0xCD, 0x63, 0xE4, 0xA8, 0x9F, 0x3E, 0x4C, 0x8C, 0x51,
+    0x64, 0xC1, 0xE6, 0xBD, 0xAC, 0xE8, 0xE2, 0xE3, 0x11, 0x9A, 0x4D, 0x63, 0x64, 0xD2, 0xC5, 0x64,
+    0x42, 0x6C, 0xC3, 0x8A, 0x4F, 0x13, 0x01, 0x97, 0xC7, 0x68, 0xAB, 0x5F, 0x6C, 0x42, 0x64, 0xD1,
+    0x05, 0x2B, 0xF9, 0x5E, 0xF7, 0x7A, 0x24, 0x05, 0x2F, 0x92, 0x94, 0xDC, 0xDE, 0xE1, 0xF2, 0x50,
+    0x99, 0xB0, 0x59, 0x15, 0x02, 0x36, 0xD1, 0xF0, 0xB3, 0x5E, 0x08, 0x1F, 0x3C, 0x8A, 0x04, 0x69,
+    0x10, 0xA4, 0xA0, 0x56, 0x97, 0xF0, 0x69, 0x62, 0x68, 0xAA, 0xE2, 0xB2, 0x4D, 0x9C, 0x09, 0xB8,
+    0x85, 0xC6, 0xE9, 0x9E, 0x8D, 0x6D, 0x5A, 0xBB, 0x74, 0x37, 0xAF, 0x2F, 0xBF, 0xBB, 0x91, 0xC8,
+    0x5E, 0x96, 0x41, 0xDE, 0xAC, 0xBA, 0xAA, 0x6A, 0x97, 0xA1, 0xBA, 0xA4, 0xEA, 0x18, 0x6D, 0x09,
+    0xC3, 0x29, 0x05, 0x11, 0xF6, 0xB2, 0x70, 0xD7, 0xC9, 0x87, 0x9B, 0x0D, 0xB4, 0x02, 0xBD, 0x38,
+    0xEE, 0x6D, 0xC2, 0x53, 0x78, 0x00, 0xFF, 0x0B, 0xD5, 0xBD, 0x5F, 0x8C, 0x24, 0xC7, 0x9D, 0xE7,
+    0xF7, 0x89, 0x0C, 0xCE, 0xA4, 0x34, 0x29, 0x31, 0xF8, 0xC0, 0xF1, 0x4A, 0xA4, 0x38, 0x29, 0xC0,
+    0x5A, 0x83, 0xD2, 0x89, 0x4C, 0x3D, 0x10, 0x36, 0x0D, 0xF7, 0x74, 0xE4, 0x90, 0xC0, 0x09, 0xF0,
+    0x02, 0x56, 0x03, 0x66, 0x4B, 0xC0, 0xD1, 0x38, 0x12, 0x67, 0x01, 0x96, 0xD6, 0xBE, 0x1D, 0x3E,
+    0xE8, 0x61, 0x60, 0x77, 0x57, 0x26, 0xC9, 0x07, 0x3D, 0x08, 0xB0, 0x06, 0xF0, 0x6A, 0x0D, 0x78,
+    0x0D, 0xEC, 0x1C, 0xCC, 0xB5, 0xA9, 0x26, 0xE0, 0xE1, 0x19, 0x7C, 0x18, 0xDF, 0x55, 0x75, 0x05,
+    0x39, 0x58, 0x13, 0x07, 0x3D, 0x28, 0x45, 0x41, 0xBB, 0x80, 0xF7, 0x81, 0x21, 0x91, 0xF4, 0xEE,
+    0x92, 0xBE, 0x63, 0x88, 0x4A, 0x2E, 0x73, 0x86, 0x51, 0xF5, 0xF3, 0x43, 0x64, 0x55, 0x57, 0xCF,
+    0x0C, 0x25, 0xAD, 0x56, 0x5A, 0xCA, 0x85, 0xE9, 0x9A, 0xEE, 0xCC, 0xAC, 0xCA, 0xC8, 0x5F, 0x46,
+    0xFC, 0xFE, 0x7C, 0x7F, 0xDF, 0xDF, 0x2F, 0x01, 0x15, 0xB1, 0x4E, 0x47, 0x6C, 0x4D, 0x0D, 0x00,
+    0x5B, 0xE4, 0x8E, 0x2B, 0x98, 0x9A, 0x9E, 0x92, 0x2C, 0x60, 0xD1, 0x9E, 0x7D, 0x8A, 0x8E, 0x88,
+    0x71, 0x2A, 0x52, 0xB5, 0xBA, 0xC7, 0x8E, 0x87, 0x03, 0x3D, 0x68, 0x07, 0x65, 0x4D, 0x21, 0x41,
+    0x89, 0xB8, 0xD2, 0x9F, 0x64, 0x01, 0xC6, 0x43, 0x03, 0x59, 0x0F, 0xC6, 0x81, 0x05, 0x35, 0x40,
+    0xEE, 0xA1, 0x6C, 0x61, 0x02, 0x44, 0xD0, 0x03, 0xE4, 0x8B, 0x47, 0x5D, 0x2E, 0x42, 0x26, 0x3E,
+    0x7D, 0x13, 0x70, 0x05, 0x38, 0x3A, 0x05, 0xCD, 0x02, 0x10, 0x09, 0x20, 0x7F, 0x34, 0xC0, 0x21,
+    0xB7, 0x81, 0x85, 0xF4, 0x55, 0xE4, 0x1D, 0x90, 0x05, 0xD2, 0x57, 0x6E, 0xEC, 0xC9, 0x2E, 0x5F,
+    0x7F, 0x16, 0x44, 0x04, 0x4E, 0x2F, 0x76, 0x6B, 0xD8, 0x06, 0x28, 0x6B, 0xA0, 0xE8, 0x00, 0x1D,
+    0x00, 0x86, 0xF5, 0x07, 0x67, 0x40, 0x26, 0x07, 0x07, 0xCF, 0x20, 0x22, 0x4B, 0x1A, 0x11, 0xA9,
+    0xF9, 0x08, 0x7C, 0x7A, 0x68, 0xFE, 0x87, 0x9F, 0x88, 0x48, 0xB6, 0x7C, 0x34, 0x14, 0x2E, 0xEF,
+    0xCE, 0x52, 0x3C, 0x19, 0x28, 0x73, 0xC7, 0x96, 0x41, 0x85, 0x6D, 0x4C, 0x3B, 0x21, 0x6A, 0x91,
+    0xC1, 0x36, 0xD7, 0x87, 0xE7, 0x4F, 0x64, 0x1D, 0x80, 0x69, 0xC9, 0x82, 0x85, 0xAA, 0x9D, 0x42,
+    0x54, 0x3D, 0xA6, 0xD3, 0x9E, 0x09, 0xC6, 0xE9, 0x40, 0x85, 0x85, 0x7D, 0x35, 0xC0, 0x60, 0x1C,
+    0x59, 0x88, 0x90, 0xBF, 0xDC, 0x81, 0x69, 0xE0, 0x44, 0xF3, 0x6E, 0xCD, 0x5C, 0xA4, 0xD6, 0x22,
+    0x8B, 0xF1, 0xF2, 0x2A, 0x50, 0x07, 0xCB, 0xEF, 0x52, 0x88, 0xF4, 0x7C, 0x6E, 0xFE, 0x66, 0x0B,
+    0xFB, 0xAB, 0xAB, 0x36, 0x8E, 0x74, 0x69, 0x77, 0xEE, 0x6D, 0xBC, 0xEE, 0x1C, 0x65, 0x77, 0xEF,
+    0xE6, 0x46, 0xE0, 0xF4, 0x0E, 0x88, 0xB4, 0x4A, 0x24, 0xB0, 0xE0, 0x4E, 0xB6, 0x47, 0x61, 0xE9,
+    0x1E, 0x68, 0x5A, 0x30, 0x4B, 0x30, 0xD2, 0x63, 0xDA, 0x39, 0xC6, 0x15, 0x5E, 0x77, 0x44, 0x7A,
+    0xB6, 0xB1, 0x94, 0x75, 0x11, 0x8C, 0x43, 0xFE, 0xC4, 0x51, 0x48, 0x0B, 0x55, 0x00, 0x96, 0xE3,
+    0x10, 0x74, 0x00, 0x35, 0xF0, 0x7A, 0x16, 0xB1, 0xB2, 0xE0, 0xA4, 0x0C, 0x69, 0x00, 0xB7, 0xF1,
+    0xC5, 0x6E, 0x7F, 0x56, 0xFC, 0x45, 0x7B, 0x61, 0x75, 0x3B, 0x4F, 0xCA, 0x35, 0xA0, 0x58, 0x5E,
+    0x5E, 0x80, 0x1E, 0x38, 0x39, 0x40, 0x9A, 0x1A, 0xDB, 0x9C, 0xA8, 0x4D, 0x5B, 0xB4, 0x85, 0xB8,
+    0xB3, 0x84, 0x5C, 0xA2, 0x0A, 0xF7, 0xB1, 0xA0, 0x36, 0x0F, 0xBB, 0xAA, 0x86, 0x0B, 0x5B, 0x3A,
+    0x80, 0x7E, 0xB9, 0xDD, 0x06, 0xB6, 0x2E, 0xE8, 0x0E, 0xF4, 0xCB, 0xED, 0xD9, 0xA3, 0x3F, 0xAE,
+    0xBA, 0x6D, 0x60, 0x6B, 0x2B, 0x0B, 0x90, 0x3F, 0xD5, 0x99, 0x16, 0x5E, 0x30, 0xCC, 0x9F, 0x73,
+    0x86, 0x2B, 0x4A, 0xA2, 0xEE, 0x74, 0xA7, 0xFE, 0x94, 0x29, 0x65, 0x0B, 0x16, 0x9A, 0x9A, 0xCA,
+    0xC1, 0xFC, 0x4F, 0xE7, 0x1E, 0x98, 0x8B, 0x07, 0x38, 0x9D, 0xC6, 0xA8, 0x87, 0x4B, 0xCD, 0xBF,
+    0x7E, 0xBA, 0xDB, 0x3F, 0x43, 0x08, 0xFA, 0xAA, 0xBB, 0xFD, 0x76, 0x5E, 0xB8, 0xA0, 0xBB, 0x50,
+    0xE9, 0xF7, 0xA3, 0x1E, 0xD2, 0xE1, 0x22, 0x73, 0x11, 0xD9, 0xDD, 0xDD, 0x3D, 0x4F, 0x9A, 0xB5,
+    0x37, 0xFE, 0xDC, 0x75, 0x62, 0xF7, 0x21, 0x89, 0x56, 0x5E, 0xDC, 0x7D, 0xE4, 0x97, 0xB8, 0x74,
+    0x30, 0x6D, 0xD1, 0xCE, 0x97, 0x9C, 0x25, 0x14, 0xE9, 0xD2, 0xA7, 0xB9, 0x37, 0x0F, 0xBB, 0xC2,
+    0x59, 0x2E, 0x6C, 0x31, 0xD5, 0x41, 0xBF, 0xDC, 0x16, 0x6E, 0x9B, 0xAD, 0x0B, 0xCC, 0xCE, 0x3B,
+    0xFD, 0x72, 0x5B, 0x48, 0x60, 0xEB, 0x02, 0x87, 0x87, 0xE8, 0xAB, 0xAE, 0x78, 0x29, 0xB0, 0xB5,
+    0xC5, 0xD4, 0xB8, 0xFC, 0xA9, 0xAE, 0x70, 0xFB, 0xBC, 0x60, 0x98, 0xEA, 0x60, 0xB8, 0x52, 0xB8,
+    0xF2, 0xE9, 0x4E, 0x77, 0x8F, 0xF0, 0xC8, 0x2F, 0xBE, 0xF4, 0xCF, 0x1D, 0x1C, 0xFC, 0x0B, 0x11,
+    0xF9, 0xBF, 0x0E, 0x0E, 0xBE, 0x0B, 0x90, 0x49, 0x6B, 0x24, 0x54, 0x4C, 0xCF, 0xB2, 0xB5, 0xC5,
+    0xD9, 0x2D, 0xCE, 0x9E, 0x65, 0xAB, 0x62, 0x6A, 0x24, 0x64, 0xD2, 0x02, 0xE8, 0x2E, 0x29, 0x01,
+    0xCE, 0x02, 0xA6, 0x3E, 0xB6, 0x21, 0x13, 0x91, 0x38, 0x17, 0x91, 0x13, 0xBB, 0xD7, 0x76, 0xEB,
+    0x5B, 0x1D, 0x91, 0x36, 0x00, 0x27, 0x76, 0x77, 0x77, 0x7F, 0x4F, 0x44, 0xDE, 0x11, 0x91, 0xC8,
+    0x89, 0x5A, 0x49, 0xAF, 0xAF, 0x47, 0x55, 0xEF, 0xC1, 0x16, 0xEC, 0xC1, 0x40, 0x16, 0x28, 0x1C,
+    0x15, 0x0C, 0x68, 0x4F, 0x59, 0x63, 0x25, 0xCC, 0x25, 0x00, 0x9C, 0xAE, 0x33, 0x09, 0xFA, 0xFF,
+    0x89, 0xB0, 0x3A, 0xFE, 0x64, 0x40, 0x6A, 0x2E, 0x77, 0x64, 0x01, 0x02, 0x84, 0x3B, 0xB2, 0x30,
+    0xB9, 0xDC, 0x59, 0xA9, 0xD5, 0x0E, 0x7C, 0x9D, 0x85, 0xEE, 0x8B, 0xAE, 0xAC, 0xB7, 0xA0, 0xAC,
+    0xD9, 0xA7, 0xAA, 0x99, 0x62, 0x21, 0xAE, 0xDE, 0xD4, 0xC0, 0x84, 0xAC, 0x67, 0x46, 0x16, 0x88,
+    0xE8, 0xF1, 0x6D, 0x20, 0xF7, 0xAA, 0xC7, 0x74, 0x59, 0x9F, 0x16, 0xB2, 0x75, 0x3A, 0x30, 0x6F,
+    0xF3, 0xA0, 0xA4, 0x2E, 0x62, 0xF9, 0x6A, 0x5D, 0x88, 0x54, 0x98, 0x57, 0x87, 0x0A, 0xF3, 0x64,
+    0x3D, 0x6A, 0x9B, 0xAA, 0x5E, 0xA9, 0x25, 0xCB, 0xB8, 0x56, 0xD9, 0x07, 0x98, 0xAE, 0xAE, 0x9D,
+    0x46, 0xC4, 0x8B, 0xC8, 0x30, 0x97, 0x77, 0xFF, 0xA9, 0x95, 0x45, 0xFE, 0x27, 0x22, 0xE7, 0xDE,
+    0x12, 0xE9, 0xFE, 0x3B, 0x91, 0xFE, 0x8C, 0xC8, 0x22, 0x9F, 0x8B, 0x9C, 0x7B, 0x5B, 0xA4, 0xFB,
+    0x6F, 0x45, 0xFA, 0x33, 0x8D, 0x2C, 0xF2, 0x6F, 0x8B, 0x9C, 0xFB, 0x89, 0x48, 0x77, 0xC1, 0x4A,
+    0x7F, 0x46, 0xC9, 0x22, 0x6F, 0x29, 0xCE, 0x79, 0xB2, 0xEE, 0x02, 0xBC, 0x70, 0x06, 0xEE, 0xFB,
+    0xA5, 0x37, 0x00, 0xE4, 0x3F, 0x5C, 0x88, 0x3D, 0x87, 0x76, 0x67, 0x58, 0xB2, 0x4F, 0x9F, 0xFF,
+    0xE5, 0xD2, 0x76, 0xC0, 0x24, 0x5B, 0x94, 0xD3, 0xB3, 0x7B, 0x4C, 0x19, 0xE8, 0x55, 0x50, 0x21,
+    0xF3, 0xBA, 0xD3, 0x5D, 0xEE, 0x0A, 0x07, 0x40, 0xB6, 0xA4, 0x39, 0xD4, 0xDD, 0xD6, 0x19, 0x5E,
+    0x08, 0xD9, 0x0F, 0x5D, 0xF1, 0x25, 0xB6, 0xB6, 0x08, 0xC1, 0x9C, 0xBB, 0x3E, 0x8C, 0x13, 0x04,
+    0x48, 0xBA, 0xFF, 0x0A, 0xF3, 0x9A, 0x92, 0x49, 0x40, 0x77, 0xE6, 0x31, 0x18, 0xC8, 0x3C, 0x15,
+    0x6C, 0x93, 0x3B, 0x74, 0x47, 0x0F, 0x7B, 0x6C, 0x43, 0xE1, 0x0A, 0x07, 0x57, 0x54, 0x0F, 0xA6,
+    0xDE, 0x26, 0x12, 0x8C, 0xAB, 0x5C, 0x99, 0x85, 0x7C, 0xC8, 0xC2, 0xBE, 0x92, 0x1A, 0xD3, 0x6E,
+    0x05, 0x74, 0x30, 0x25, 0x4C, 0xF5, 0x2B, 0x9E, 0xB2, 0xBE, 0x72, 0x1F, 0xDA, 0x97, 0xBA, 0x23,
+    0x6A, 0x11, 0x57, 0xD1, 0x48, 0xCC, 0x3B, 0xB8, 0xC2, 0x00, 0xA6, 0xB6, 0x40, 0x60, 0xF3, 0x55,
+    0xB6, 0x14, 0x2D, 0xF3, 0x9A, 0xB2, 0xCE, 0xDF, 0x86, 0x6D, 0xCC, 0x63, 0x10, 0xE1, 0x7E, 0xB2,
+    0x00, 0xDB, 0xE4, 0x1D, 0x9C, 0xC5, 0xB4, 0xB0, 0x87, 0x05, 0xA6, 0x4C, 0x81, 0x2B, 0xAA, 0x3F,
+    0x51, 0xD3, 0x6B, 0x3F, 0xEF, 0x09, 0xE6, 0xEA, 0xF5, 0xA8, 0x42, 0x45, 0x7D, 0x36, 0x0B, 0xFB,
+    0x70, 0x16, 0x06, 0xD8, 0x22, 0x0B, 0x30, 0x25, 0x77, 0x64, 0x01, 0x53, 0x53, 0x38, 0xB6, 0xA1,
+    0x82, 0x29, 0x44, 0x54, 0x40, 0x7B, 0x74, 0x87, 0x69, 0x31, 0x2D, 0x56, 0x42, 0x05, 0x8D, 0xAC,
+    0xC6, 0x76, 0xA2, 0x5E, 0x59, 0xBB, 0xBC, 0xDD, 0xBE, 0xEC, 0xC8, 0x3B, 0xE8, 0xD1, 0x1E, 0xCE,
+    0xA2, 0x03, 0xC9, 0x22, 0x73, 0xBE, 0x56, 0x3D, 0x7A, 0x09, 0x03, 0x5C, 0xEE, 0x98, 0x02, 0x7B,
+    0xEC, 0x01, 0xA6, 0x3E, 0x0B, 0xE8, 0x6E, 0x9B, 0x78, 0x47, 0x16, 0x2A, 0xE6, 0xE6, 0xB9, 0xBE,
+    0xA4, 0x79, 0x5A, 0x7A, 0x53, 0x37, 0xDD, 0x89, 0xDA, 0xB4, 0x5B, 0x01, 0x0A, 0x77, 0x76, 0x0F,
+    0x72, 0x77, 0xF6, 0x0C, 0xE8, 0xEE, 0xFE, 0xA2, 0x1D, 0x25, 0x97, 0x05, 0x23, 0x82, 0x0A, 0xB9,
+    0x88, 0xA3, 0x87, 0xFB, 0x49, 0xC2, 0x63, 0x3A, 0xAE, 0xD8, 0xF5, 0x2B, 0xF7, 0xE8, 0x88, 0x5A,
+    0x26, 0xAB, 0xBE, 0xDE, 0xBC, 0x07, 0x15, 0x98, 0x16, 0xE3, 0x28, 0x3B, 0xAA, 0x0E, 0xEB, 0xB0,
+    0x8E, 0xAA, 0xC5, 0x38, 0xF2, 0x8E, 0xAC, 0x87, 0x19, 0x54, 0x2D, 0xF9, 0x90, 0xFB, 0xB9, 0xC4,
+    0x42, 0x06, 0x4E, 0xD7, 0x00, 0x3B, 0xB4, 0x60, 0xFD, 0x16, 0x18, 0x79, 0xBB, 0x45, 0x85, 0x26,
+    0xC0, 0xA7, 0xB8, 0x72, 0xEC, 0xA6, 0x8D, 0x06, 0x7B, 0x5E, 0x03, 0xA6, 0x07, 0xB4, 0xB4, 0xC0,
+    0xFE, 0x00, 0x98, 0xEF, 0x3B, 0x50, 0x43, 0x04, 0x6C, 0xE1, 0x20, 0xF7, 0x53, 0x20, 0x16, 0x1D,
+    0x54, 0xF5, 0x3E, 0xE8, 0x90, 0x7B, 0x98, 0xB1, 0x4D, 0x5A, 0xB7, 0x99, 0x88, 0x40, 0x23, 0x12,
+    0x30, 0x6F, 0x1E, 0xCC, 0x51, 0x91, 0xAC, 0xC7, 0x42, 0x55, 0xE7, 0x1E, 0x35, 0x10, 0xA1, 0x6C,
+    0xAB, 0x16, 0xA2, 0x0E, 0x60, 0xDC, 0xE1, 0xCA, 0x4B, 0x00, 0xC0, 0x76, 0xC0, 0xF5, 0x1E, 0x94,
+    0xDF, 0x02, 0xD5, 0x6D, 0x01, 0xE1, 0x02, 0x30, 0x0F, 0xC0, 0xDD, 0xED, 0xB1, 0x61, 0xDB, 0xF5,
+    0xA8, 0xA5, 0x1E, 0x07, 0x9D, 0xBF, 0xDA, 0x8E, 0x63, 0x2E, 0xBF, 0xED, 0xC6, 0x21, 0x4F, 0x0A,
+    0x97, 0x46, 0x9C, 0xF5, 0x79, 0x97, 0x06, 0x5C, 0x74, 0xDA, 0x8F, 0x0E, 0x83, 0x48, 0x48, 0xC3,
+    0x5D, 0x1E, 0x3C, 0x17, 0x54, 0x24, 0xEB, 0x75, 0x20, 0xEB, 0x73, 0x8F, 0x1A, 0x8C, 0x43, 0x0D,
+    0x55, 0x0B, 0xD1, 0x02, 0x71, 0x35, 0xD4, 0x4C, 0x44, 0x06, 0xA0, 0x12, 0x11, 0x0F, 0x88, 0x88,
+    0xD4, 0x60, 0x7E, 0x98, 0xE6, 0xDB, 0xC4, 0xB8, 0x24, 0xD4, 0x09, 0x00, 0xD5, 0x43, 0x3D, 0x80,
+    0x8A, 0x69, 0xB3, 0x71, 0x16, 0x80, 0x43, 0x35, 0x00, 0xE4, 0xA1, 0xB8, 0x7E, 0x70, 0x09, 0x6C,
+    0x5D, 0x89, 0x38, 0xB2, 0x01, 0x91, 0xE5, 0x28, 0xCB, 0xF4, 0xD5, 0x2D, 0x90, 0x8B, 0x2C, 0x00,
+    0xEC, 0xC1, 0x73, 0x3D, 0xA0, 0x87, 0xE4, 0x9C, 0x94, 0x2E, 0xC9, 0x60, 0x81, 0x1A, 0x80, 0xC2,
+    0x27, 0xFF, 0xAB, 0x01, 0x7B, 0x70, 0xD0, 0xEA, 0x3E, 0x39, 0x69, 0x95, 0x43, 0x8B, 0x44, 0xA8,
+    0xE4, 0x19, 0x30, 0x22, 0x1D, 0x5A, 0x64, 0x89, 0x1A, 0x68, 0x3C, 0x33, 0xB2, 0x48, 0x55, 0x63,
+    0x5B, 0xE3, 0xC8, 0x83, 0x0E, 0x10, 0xD5, 0x00, 0x96, 0xD9, 0x38, 0x58, 0xFD, 0x53, 0x91, 0x40,
+    0x9C, 0x4B, 0xC4, 0xDE, 0x75, 0xFD, 0xBB, 0x94, 0x6E, 0x06, 0x85, 0xB7, 0xA0, 0x83, 0x71, 0x64,
+    0x31, 0xF7, 0xA8, 0x85, 0xEA, 0x61, 0xC9, 0x0C, 0x25, 0x58, 0x4E, 0x0A, 0xE6, 0xCD, 0xCB, 0xCB,
+    0x34, 0xEE, 0x4C, 0xE4, 0x22, 0x80, 0xAA, 0x4F, 0x42, 0xBE, 0xD4, 0x0E, 0x2D, 0xEF, 0x77, 0x64,
+    0x7E, 0x1E, 0xE0, 0x52, 0x76, 0x69, 0xF3, 0x96, 0x2A, 0xB9, 0x06, 0xB9, 0x88, 0xA7, 0x58, 0xFE,
+    0xB1, 0x50, 0x0C, 0x94, 0x3E, 0xEF, 0x51, 0x51, 0xF7, 0x60, 0x1F, 0x1A, 0xA0, 0xF0, 0x11, 0x54,
+    0x3C, 0x04, 0xAC, 0xAD, 0xC7, 0x9B, 0xAD, 0xDF, 0x0B, 0xA0, 0x16, 0x03, 0xD0, 0x1C, 0x02, 0xD5,
+    0xE5, 0x16, 0xCC, 0x5F, 0x7A, 0xC8, 0xDF, 0x19, 0x20, 0x8B, 0x0D, 0xB0, 0x30, 0x0E, 0x44, 0x47,
+    0x98, 0xD3, 0xB4, 0x48, 0x5D, 0x2C, 0xBF, 0x2C, 0x2D, 0x73, 0x91, 0x9A, 0x4C, 0x16, 0x80, 0xDA,
+    0x49, 0xA3, 0xF8, 0x18, 0x7C, 0xC6, 0xC2, 0xAC, 0x74, 0xD9, 0x90, 0x87, 0xC2, 0xAB, 0x58, 0xB5,
+    0x34, 0x4B, 0x28, 0x07, 0x30, 0x01, 0xAA, 0x08, 0x87, 0x0D, 0xD9, 0x50, 0xBA, 0xC2, 0xE7, 0xA1,
+    0x6A, 0x55, 0xBC, 0x1F, 0xF6, 0x6E, 0x83, 0x3B, 0x8E, 0xAE, 0x25, 0x6B, 0x51, 0x32, 0x94, 0x2D,
+    0x8D, 0x2C, 0x23, 0xC5, 0xF2, 0x51, 0x71, 0xCC, 0x5B, 0xB5, 0x24, 0xEF, 0x29, 0x22, 0xB6, 0xA6,
+    0xE9, 0xB3, 0x01, 0xFD, 0xBE, 0x37, 0x0E, 0x5B, 0xBA, 0x43, 0x74, 0x6F, 0x75, 0x4F, 0xD5, 0x46,
+    0xE3, 0xD4, 0xA0, 0x43, 0x83, 0x71, 0xE5, 0x8B, 0x03, 0x91, 0xA6, 0xF0, 0xA6, 0xCB, 0x86, 0xAA,
+    0x3D, 0xC4, 0x74, 0x87, 0xB9, 0xC7, 0x66, 0x83, 0x25, 0x8B, 0xF9, 0xCF, 0x02, 0xA6, 0x33, 0x52,
+    0x23, 0xD8, 0x9E, 0x22, 0xD0, 0x38, 0xE6, 0x35, 0xF2, 0xC6, 0xF9, 0x01, 0x23, 0x22, 0x35, 0x8B,
+    0x4A, 0x3A, 0x54, 0xB7, 0xBA, 0x34, 0x80, 0xEC, 0x12, 0x30, 0x4F, 0xF3, 0x27, 0xAD, 0xFD, 0x08,
+    0x9C, 0xD9, 0xB8, 0x0D, 0x53, 0x28, 0xBF, 0xD5, 0xA5, 0x29, 0xBC, 0xD0, 0x81, 0xD2, 0x59, 0x74,
+    0xC8, 0x7A, 0x16, 0x94, 0x6D, 0xD9, 0x12, 0x75, 0xC0, 0xB8, 0x05, 0x4C, 0xCB, 0x96, 0xFC, 0x87,
+    0x01, 0xB6, 0x67, 0x90, 0x49, 0x0B, 0x65, 0x00, 0x16, 0xA3, 0xEF, 0xAA, 0x86, 0xD1, 0x4A, 0xEB,
+    0x30, 0xAE, 0x57, 0xED, 0x49, 0x51, 0x4A, 0xD1, 0xAD, 0x16, 0x7E, 0xC5, 0xC6, 0xFE, 0xDC, 0x03,
+    0xF3, 0x83, 0x9A, 0x42, 0xA4, 0x45, 0x44, 0x30, 0xAE, 0xE8, 0xD5, 0x40, 0xE5, 0xAA, 0x7A, 0x3C,
+    0xAF, 0x85, 0xA8, 0x3D, 0xA5, 0x9B, 0x90, 0x0D, 0x45, 0x47, 0x43, 0xA4, 0xF2, 0xE6, 0x4D, 0x19,
+    0x94, 0xC8, 0x82, 0x52, 0x9E, 0x21, 0xEB, 0x57, 0xE7, 0x0B, 0x9B, 0xE7, 0x03, 0xD4, 0x2E, 0x40,
+    0x35, 0x2E, 0xDC, 0x01, 0xB2, 0x85, 0x8A, 0xA0, 0x03, 0x33, 0x28, 0xBA, 0x34, 0xEB, 0x89, 0x60,
+    0x5C, 0x36, 0x40, 0xD9, 0x1A, 0x0F, 0x55, 0xDD, 0xB4, 0x60, 0xD5, 0x02, 0xB0, 0x3A, 0x00, 0xDB,
+    0x79, 0x07, 0xEC, 0xE7, 0x1D, 0x30, 0xD3, 0x3D, 0x10, 0xB3, 0x05, 0x10, 0x99, 0xB7, 0xA8, 0x81,
+    0xB2, 0x43, 0xF5, 0xE4, 0x81, 0x2C, 0xA0, 0xD3, 0xBF, 0x7E, 0xFC, 0x25, 0xF7, 0xE4, 0x81, 0xE2,
+    0x87, 0x5D, 0xD5, 0x61, 0xAE, 0x8A, 0xB4, 0x98, 0x17, 0x65, 0x01, 0xC6, 0x9D, 0xA8, 0xC7, 0xD0,
+    0x2B, 0x79, 0x36, 0x69, 0x71, 0x33, 0x01, 0xF8, 0x0F, 0x52, 0x08, 0xD6, 0xAF, 0x95, 0x24, 0xB0,
+    0xA3, 0x5A, 0x1A, 0xBF, 0x85, 0x91, 0xB7, 0x5B, 0xE5, 0xE7, 0x81, 0xCF, 0x1F, 0x53, 0xEC, 0x73,
+    0xBF, 0x85, 0x95, 0x97, 0x9D, 0x79, 0x77, 0x12, 0xF5, 0x80, 0xB4, 0x73, 0xF2, 0xDE, 0x38, 0xAC,
+    0x1A, 0xD0, 0xC1, 0xD6, 0x58, 0x1D, 0xC8, 0xBD, 0x85, 0x59, 0xEE, 0x31, 0x6E, 0x82, 0x8A, 0xB9,
+    0xC7, 0xB6, 0x13, 0x8A, 0x5E, 0x87, 0x4C, 0x6A, 0xFB, 0xE2, 0x32, 0x28, 0x59, 0x56, 0xE4, 0xF2,
+    0x90, 0xDF, 0xB0, 0x48, 0xF9, 0x02, 0xB8, 0x1E, 0xE0, 0x9E, 0xBC, 0x25, 0x73, 0x0F, 0xC2, 0x99,
+    0xA2, 0x06, 0x09, 0x90, 0x0D, 0x1B, 0x23, 0x28, 0x96, 0xDA, 0x69, 0x89, 0x7B, 0xC8, 0x57, 0xDE,
+    0x76, 0xB6, 0x35, 0x43, 0x11, 0x68, 0xEA, 0x88, 0x0E, 0x65, 0x8B, 0xD5, 0x3D, 0x3A, 0x58, 0x98,
+    0xE8, 0x40, 0xD1, 0x4D, 0x20, 0xE6, 0xE9, 0xA6, 0xEA, 0x21, 0xF7, 0xCC, 0x6B, 0x4B, 0xD5, 0xEB,
+    0x58, 0xBE, 0x4D, 0x29, 0x3F, 0x09, 0x34, 0xFD, 0xFD, 0xC7, 0x56, 0x17, 0xF3, 0xEE, 0xF9, 0xB9,
+    0xA7, 0x91, 0x2F, 0x35, 0xE2, 0xCC, 0xBB, 0x13, 0xF9, 0xD1, 0x42, 0x0F, 0x4A, 0x7C, 0xEE, 0xE7,
+    0x98, 0x81, 0x89, 0x71, 0x08, 0xC5, 0x0F, 0x06, 0x4C, 0xA7, 0xA2, 0xAD, 0x89, 0x27, 0x45, 0x07,
+    0x8C, 0x88, 0xB3, 0x28, 0x91, 0x8B, 0xB9, 0xA7, 0xBA, 0x08, 0x13, 0x74, 0x0F, 0xB9, 0x67, 0xDE,
+    0xC2, 0x84, 0x32, 0x82, 0x0E, 0xB9, 0x74, 0x60, 0x9F, 0x7A, 0x4F, 0xDA, 0x7F, 0xAE, 0x24, 0x4E,
+    0x44, 0xBA, 0x7C, 0x99, 0x7F, 0x53, 0x7A, 0x4E, 0x80, 0x5A, 0xC5, 0xCF, 0x45, 0xBB, 0x07, 0xCB,
+    0xCA, 0xA1, 0xC5, 0xA7, 0x90, 0xAD, 0x94, 0x9A, 0xA2, 0x8F, 0xF0, 0x8D, 0xBC, 0x1B, 0xEF, 0x5E,
+    0x16, 0x38, 0xF9, 0x6C, 0x49, 0x2E, 0xD7, 0xFA, 0x4C, 0x2E, 0xBF, 0x5D, 0xCF, 0xEB, 0xB2, 0x37,
+    0x8E, 0xF9, 0x43, 0x3D, 0x79, 0xB0, 0x60, 0x73, 0x9F, 0x56, 0xD9, 0xA4, 0xE8, 0x28, 0xBA, 0x59,
+    0x12, 0x42, 0xD5, 0x5A, 0xF2, 0x90, 0x2D, 0x4E, 0x46, 0x8C, 0x48, 0x4D, 0x25, 0x2D, 0x9C, 0x00,
+    0x50, 0x3B, 0x59, 0xAD, 0x25, 0xEB, 0x32, 0xB9, 0x1E, 0x08, 0x4D, 0xCF, 0x37, 0xD4, 0x33, 0x1B,
+    0xDE, 0xD7, 0x32, 0x79, 0x3D, 0xCD, 0x8F, 0x04, 0xDB, 0x16, 0xBE, 0x6A, 0x89, 0xC6, 0x61, 0x8B,
+    0x0E, 0x73, 0x35, 0xA0, 0x43, 0x84, 0x38, 0x01, 0x5B, 0xB6, 0x94, 0xDF, 0xF4, 0x14, 0x3F, 0x18,
+    0xD0, 0xC1, 0x92, 0x0D, 0xA6, 0x53, 0x51, 0x2D, 0xFF, 0xF1, 0x82, 0x4A, 0x16, 0x28, 0x19, 0x46,
+    0x9C, 0x40, 0xD5, 0xA0, 0xE2, 0xA8, 0x2D, 0x2A, 0x07, 0xEA, 0xC8, 0x02, 0xAF, 0x83, 0x90, 0xD3,
+    0xBB, 0xBB, 0xBB, 0xF5, 0xA6, 0x13, 0x43, 0xB6, 0xFA, 0x88, 0x39, 0xDA, 0xFE, 0x31, 0x94, 0xBC,
+    0xE6, 0x11, 0x89, 0x34, 0x3F, 0x92, 0xDA, 0x74, 0xF9, 0x90, 0xF5, 0x4A, 0x9C, 0x65, 0x3B, 0x16,
+    0x9D, 0xF9, 0x9E, 0x8B, 0x59, 0x98, 0x1A, 0xB7, 0x6F, 0xDC, 0x50, 0xB6, 0xB1, 0x7C, 0xD8, 0x9B,
+    0x27, 0xFB, 0xA8, 0xFA, 0xF2, 0x32, 0x16, 0xE9, 0x8A, 0xCE, 0x0C, 0x2A, 0xD2, 0xB4, 0x73, 0x8C,
+    0x88, 0xCB, 0xDE, 0x13, 0xCF, 0x3D, 0x1B, 0x50, 0x46, 0x92, 0x82, 0xAD, 0x01, 0xD3, 0x91, 0xE0,
+    0x91, 0x31, 0x16, 0x30, 0xDC, 0xE8, 0xA1, 0x1A, 0xC7, 0x40, 0xD6, 0x63, 0x5C, 0x8A, 0x4A, 0x4C,
+    0x97, 0x20, 0x98, 0x14, 0xAA, 0xE4, 0x5D, 0xEE, 0x61, 0x42, 0x04, 0xED, 0xCB, 0x76, 0x5C, 0xF0,
+    0xC9, 0x9A, 0x57, 0xC6, 0x41, 0xF6, 0xD3, 0x1E, 0x28, 0x2D, 0xA0, 0xDE, 0xEB, 0x00, 0x13, 0x19,
+    0x7D, 0x10, 0x8C, 0x5F, 0xA3, 0x1E, 0x65, 0xBB, 0xF6, 0xAC, 0x0E, 0x19, 0x95, 0x6D, 0xF6, 0x68,
+    0x00, 0xEC, 0x02, 0xD0, 0xCB, 0x71, 0x11, 0xAF, 0x90, 0x06, 0x3B, 0xBA, 0xF3, 0x49, 0x53, 0x55,
+    0xAB, 0xEF, 0xD1, 0x01, 0x28, 0x9F, 0x92, 0x9A, 0x59, 0x23, 0xB5, 0x7E, 0xEF, 0x0D, 0xC1, 0x44,
+    0x16, 0x58, 0xA7, 0x06, 0xB5, 0x20, 0xF7, 0x45, 0xA0, 0x6C, 0x6D, 0xCD, 0x84, 0x98, 0xFC, 0x16,
+    0xD3, 0x95, 0x35, 0x96, 0x59, 0xB2, 0x9A, 0xA6, 0x33, 0x1D, 0x0D, 0x8D, 0xCB, 0xFB, 0xEC, 0xFD,
+    0x6E, 0xDE, 0x16, 0xDF, 0x97, 0x01, 0x5B, 0x48, 0x4D, 0x54, 0x75, 0x52, 0xB7, 0x55, 0xBD, 0x79,
+    0x2E, 0xD3, 0x8E, 0x92, 0x4B, 0x32, 0x04, 0xC5, 0x1D, 0xA0, 0xFA, 0xB2, 0x1E, 0x7D, 0x19, 0xE5,
+    0xCF, 0x70, 0xD3, 0x4B, 0x0D, 0x10, 0x31, 0x2D, 0x55, 0x9D, 0x22, 0x3A, 0xE3, 0x58, 0x40, 0xA4,
+    0x74, 0x14, 0x4E, 0x07, 0xD8, 0x67, 0x02, 0xB9, 0x37, 0x0E, 0xB6, 0xD5, 0x40, 0x5A, 0xFB, 0xD8,
+    0xDC, 0x93, 0x70, 0x1A, 0xAA, 0xB2, 0x06, 0xF5, 0xB3, 0x00, 0x94, 0xFB, 0x00, 0xE2, 0x56, 0x0E,
+    0x29, 0x4B, 0x56, 0x62, 0x4A, 0x6E, 0x93, 0x25, 0xF9, 0x3B, 0xE3, 0xF4, 0xFC, 0xDD, 0x39, 0xA0,
+    0xA5, 0x03, 0xAC, 0x1F, 0xA7, 0xE7, 0xC1, 0x77, 0x21, 0x97, 0x25, 0xE4, 0xC9, 0x77, 0xFA, 0x90,
+    0xDD, 0xC6, 0xEC, 0xE0, 0xBB, 0xD0, 0x48, 0x47, 0x21, 0xF1, 0x37, 0xAE, 0xA4, 0xB3, 0xFA, 0x24,
+    0x10, 0xB4, 0x03, 0x7B, 0xD9, 0x43, 0x2E, 0x1E, 0xA8, 0x2E, 0x1E, 0xBF, 0x67, 0x71, 0x2D, 0x08,
+    0xDB, 0x01, 0x76, 0x00, 0xCA, 0xC9, 0xCA, 0xE9, 0xCF, 0x5F, 0x0B, 0xA0, 0xC3, 0x14, 0xD4, 0x50,
+    0xAD, 0x7C, 0xFE, 0x99, 0xEA, 0xC1, 0x32, 0x81, 0xAA, 0x36, 0x6D, 0x92, 0x45, 0x21, 0x12, 0xC9,
+    0x45, 0x04, 0x7D, 0xFD, 0xE0, 0xB2, 0x4B, 0x1E, 0x7F, 0x84, 0x19, 0x13, 0x28, 0x5B, 0x0B, 0xB9,
+    0xAF, 0x5A, 0x88, 0xC6, 0x81, 0x2D, 0x3C, 0x18, 0x47, 0x56, 0x9F, 0x82, 0x0B, 0x2A, 0xA0, 0xAF,
+    0x2F, 0x48, 0x0A, 0xEE, 0x7C, 0xFB, 0x9B, 0x37, 0x5E, 0x1F, 0x5A, 0xC8, 0xE0, 0x57, 0x2B, 0xEB,
+    0xFE, 0x04, 0x07, 0xAF, 0xDE, 0xEC, 0x45, 0xA0, 0xF4, 0xBF, 0xD1, 0x2B, 0xBF, 0x32, 0x62, 0x23,
+    0x45, 0x3B, 0xC6, 0xEB, 0x06, 0x60, 0x59, 0x43, 0x3E, 0x1C, 0xD7, 0xA0, 0x79, 0xD8, 0xD4, 0x46,
+    0x4C, 0x01, 0xE5, 0x8F, 0xCD, 0x99, 0x4A, 0x3A, 0x32, 0x91, 0x48, 0xB9, 0x7C, 0xAE, 0xA7, 0xE9,
+    0xB8, 0x83, 0x65, 0x8A, 0x48, 0x56, 0x9F, 0xEE, 0x46, 0x5D, 0x47, 0xD5, 0x1E, 0x43, 0x67, 0x9A,
+    0xB5, 0x26, 0xBC, 0xE1, 0xAD, 0x59, 0x1F, 0x62, 0xDD, 0x4A, 0x18, 0xC5, 0x72, 0xF7, 0x0A, 0x99,
+    0xC8, 0x00, 0x8D, 0xBC, 0x0E, 0x3C, 0x02, 0xA0, 0x9E, 0x4D, 0xDF, 0xBF, 0x48, 0x4A, 0x72, 0x3F,
+    0x41, 0xE4, 0x2B, 0xC3, 0x23, 0x1E, 0x11, 0x67, 0xAE, 0xFD, 0x13, 0x96, 0x50, 0x04, 0xB0, 0xC9,
+    0x1D, 0x59, 0xC1, 0xE4, 0xF1, 0x66, 0x98, 0xBC, 0x87, 0x7C, 0x38, 0xE9, 0x0A, 0x11, 0x72, 0xE9,
+    0xC7, 0xB3, 0xF0, 0x35, 0x40, 0x09, 0xA0, 0xA5, 0x06, 0xF3, 0x3D, 0x07, 0x13, 0xED, 0xA1, 0x3F,
+    0x0E, 0x76, 0x7C, 0xA8, 0xA2, 0xF8, 0x2C, 0xE8, 0x08, 0xD5, 0x40, 0xF6, 0x6E, 0x8F, 0xCD, 0x42,
+    0xE6, 0xB3, 0xEE, 0xD7, 0x2F, 0x8A, 0x3B, 0x19, 0xBD, 0xF9, 0xF4, 0x16, 0x6F, 0x56, 0xFC, 0x1F,
+    0xAA, 0x14, 0xEE, 0x4C, 0xF6, 0xA0, 0x08, 0x23, 0x20, 0xB8, 0x11, 0x47, 0x0E, 0x58, 0x09, 0x7A,
+    0xF9, 0xE5, 0xD6, 0xB6, 0x64, 0x31, 0x5D, 0xFA, 0x61, 0x32, 0x71, 0xC6, 0x41, 0x73, 0x3C, 0x6F,
+    0x62, 0xD3, 0x15, 0xAA, 0xA5, 0x7A, 0x3E, 0x13, 0x71, 0x4A, 0x16, 0x23, 0x62, 0x7D, 0x2F, 0x9F,
+    0x80, 0x8A, 0x01, 0xCC, 0x37, 0x3D, 0xE4, 0xD2, 0x8E, 0xA6, 0x5B, 0x0D, 0xBF, 0x35, 0x62, 0xF8,
+    0x24, 0x9F, 0xC4, 0xD4, 0x53, 0x8A, 0xAB, 0x01, 0x2D, 0x2E, 0xCD, 0xDD, 0x8D, 0x5B, 0x95, 0x8B,
+    0xC7, 0x4A, 0x40, 0xBE, 0x73, 0x49, 0x8F, 0xD2, 0x32, 0x2E, 0x8D, 0xC3, 0x8E, 0xA7, 0x68, 0xC6,
+    0x38, 0x63, 0xF5, 0x63, 0x47, 0x6F, 0xAA, 0xF4, 0x77, 0x53, 0x88, 0xA0, 0x64, 0x31, 0xC2, 0x68,
+    0x9F, 0xE4, 0x93, 0xA0, 0xBB, 0x0A, 0xD8, 0xB3, 0x80, 0x91, 0xD5, 0x6A, 0x19, 0x83, 0x96, 0x23,
+    0x89, 0xFC, 0x6A, 0x68, 0x43, 0x30, 0x6E, 0x04, 0x87, 0xAC, 0x1A, 0xF8, 0x95, 0xD1, 0x06, 0x78,
+    0xE4, 0x04, 0xC0, 0x76, 0xE1, 0x80, 0xF2, 0x69, 0x0F, 0x14, 0xAF, 0x04, 0x40, 0x87, 0x94, 0xD3,
+    0x7A, 0x61, 0x8D, 0x19, 0x53, 0xD6, 0x50, 0x2C, 0x0B, 0x07, 0x46, 0x7E, 0x16, 0xC0, 0xBC, 0x3B,
+    0x89, 0x60, 0xBC, 0x4E, 0xCB, 0xA7, 0xA9, 0x47, 0x8F, 0x46, 0x0D, 0xE8, 0x40, 0x72, 0x6C, 0xB0,
+    0x30, 0x01, 0xE3, 0xA8, 0x6A, 0x72, 0x3F, 0xEE, 0xCE, 0x03, 0x4C, 0xD0, 0x03, 0x94, 0x6D, 0xB6,
+    0x00, 0x1D, 0x32, 0xA9, 0x41, 0xF2, 0xB7, 0x1C, 0x29, 0x90, 0x41, 0x49, 0x37, 0xB0, 0x06, 0xF8,
+    0x3E, 0x64, 0x50, 0x66, 0x5C, 0x48, 0xDB, 0x2B, 0x8F, 0xF5, 0xF4, 0xA3, 0xAF, 0x83, 0x15, 0x69,
+    0xD3, 0x98, 0xC6, 0xE8, 0xB3, 0xAC, 0x93, 0x78, 0x4A, 0xF9, 0x59, 0xA0, 0x7C, 0xF7, 0x0F, 0x22,
+    0xC6, 0x67, 0xCB, 0x24, 0x1A, 0x1D, 0x30, 0x2E, 0x09, 0x66, 0x31, 0x02, 0xFD, 0x93, 0x24, 0x95,
+    0xDC, 0xA7, 0x3D, 0x79, 0x48, 0x22, 0x29, 0xDB, 0x6C, 0x31, 0x0A, 0x44, 0xF2, 0xB7, 0x5C, 0x12,
+    0x47, 0x92, 0xC6, 0x28, 0x8C, 0x83, 0x83, 0x9A, 0x4A, 0x7A, 0x32, 0x11, 0x36, 0x03, 0x8D, 0x05,
+    0x56, 0xC4, 0x69, 0x91, 0x78, 0x14, 0xCB, 0x4F, 0x57, 0xA6, 0x2A, 0xAE, 0xD2, 0x92, 0x3D, 0x60,
+    0xDF, 0x3C, 0xA8, 0xB5, 0x48, 0x8F, 0x15, 0xA9, 0x73, 0x3F, 0x66, 0x1F, 0x8F, 0x1D, 0xA7, 0xFA,
+    0x63, 0xA0, 0xC4, 0xC1, 0x41, 0x9B, 0x8B, 0x44, 0xE6, 0x22, 0x2D, 0x9C, 0x3A, 0x78, 0x86, 0x46,
+    0xBC, 0x12, 0x59, 0x4F, 0xE6, 0x6A, 0x89, 0x16, 0xC1, 0xFE, 0x68, 0xA1, 0x07, 0x35, 0x54, 0x6D,
+    0xEE, 0x23, 0xD5, 0x17, 0xBD, 0x8A, 0xF6, 0xDC, 0xBC, 0x13, 0x89, 0x5A, 0x96, 0x75, 0x79, 0x11,
+    0x26, 0x49, 0x29, 0xE8, 0x90, 0x16, 0x7B, 0xE9, 0xEF, 0xAE, 0x2B, 0x59, 0x50, 0x4A, 0x97, 0xE2,
+    0xA8, 0x8B, 0x59, 0xCB, 0x19, 0xF6, 0x60, 0x39, 0xAF, 0x29, 0xC4, 0xC3, 0xDD, 0xFE, 0x43, 0xBA,
+    0xCA, 0x8F, 0xF2, 0x09, 0x4A, 0xF6, 0x30, 0x6F, 0xF5, 0xC9, 0x37, 0x3C, 0x3C, 0x5A, 0xBA, 0x85,
+    0xB4, 0x49, 0x5B, 0x7C, 0xA5, 0xD7, 0x83, 0x1A, 0x0A, 0xAF, 0x06, 0xE3, 0xB2, 0xBE, 0x6C, 0xF3,
+    0x60, 0xCF, 0xCD, 0x3B, 0x2B, 0x82, 0x95, 0xD7, 0x99, 0xD4, 0xB7, 0xD4, 0x16, 0x75, 0x21, 0x52,
+    0x27, 0x6D, 0x01, 0x63, 0xBC, 0xD8, 0x90, 0x94, 0x4E, 0x8A, 0xC7, 0xF8, 0x90, 0xAE, 0x99, 0x8F,
+    0xA6, 0x23, 0xF3, 0x30, 0x7A, 0x62, 0x1B, 0xC3, 0xF0, 0x58, 0x09, 0x7A, 0xF1, 0x58, 0x67, 0xDB,
+    0xF2, 0xA9, 0x81, 0x89, 0x71, 0x59, 0x3F, 0xA1, 0xBC, 0xDA, 0xDF, 0xBD, 0x30, 0x22, 0xCE, 0xCA,
+    0xEB, 0xEA, 0xDA, 0xAD, 0x8C, 0xC5, 0x0B, 0x99, 0x48, 0xA7, 0x64, 0x91, 0x0C, 0x65, 0x25, 0xD2,
+    0x69, 0x91, 0x88, 0x15, 0x71, 0xEB, 0x11, 0x16, 0xAB, 0x11, 0x1E, 0x07, 0xC4, 0x96, 0x07, 0xCF,
+    0x60, 0x53, 0x32, 0xBA, 0x3F, 0x0E, 0x88, 0xAD, 0x8F, 0x2B, 0x6B, 0x36, 0x80, 0xAC, 0xEB, 0x07,
+    0xCF, 0xD2, 0x88, 0xB8, 0x22, 0x81, 0xCF, 0x7B, 0xA3, 0x2F, 0x99, 0xBB, 0x31, 0xD7, 0x6E, 0x6A,
+    0x60, 0xD9, 0x42, 0xBE, 0x69, 0xA5, 0xFF, 0xDE, 0x93, 0xD7, 0xA3, 0xF6, 0x53, 0xA2, 0xE2, 0x2C,
+    0xA8, 0x90, 0x4E, 0x58, 0xBE, 0x0E, 0xD5, 0xCA, 0xDD, 0xB8, 0xC8, 0x45, 0x4C, 0x3D, 0x4D, 0xF6,
+    0x40, 0x8B, 0x1B, 0x31, 0xC0, 0xD9, 0x31, 0x5B, 0xF0, 0x0F, 0x27, 0x99, 0x8F, 0x72, 0x0A, 0x53,
+    0xEF, 0x93, 0xBF, 0xD2, 0x93, 0x49, 0x97, 0x3C, 0xFD, 0x8D, 0xC1, 0xFC, 0x5A, 0xE7, 0x37, 0x9F,
+    0x83, 0x51, 0x14, 0x55, 0x04, 0xAA, 0x2F, 0xB5, 0x50, 0x9D, 0xEB, 0xE1, 0x0C, 0x67, 0x6E, 0x70,
+    0x10, 0x5E, 0x87, 0xB9, 0x88, 0x53, 0xF2, 0xE6, 0x65, 0xAF, 0xA4, 0xE6, 0x71, 0x04, 0x48, 0x6F,
+    0xCD, 0x1A, 0xBE, 0x28, 0xDD, 0x71, 0x1A, 0x45, 0xE4, 0xE4, 0xC1, 0xC5, 0x06, 0x2D, 0x43, 0xD5,
+    0x22, 0x8B, 0xC2, 0x83, 0x4D, 0xAE, 0xDC, 0x21, 0xE8, 0x50, 0x3A, 0xD4, 0xA0, 0x03, 0xCC, 0x10,
+    0xB0, 0x94, 0x1E, 0xE3, 0x32, 0xF9, 0xCE, 0x79, 0x4F, 0x25, 0xD2, 0xC3, 0xFC, 0xC8, 0x5B, 0x22,
+    0xBB, 0x38, 0x3A, 0x13, 0x99, 0x38, 0xA8, 0x1E, 0xAB, 0xC9, 0x42, 0x05, 0xF7, 0x73, 0xDF, 0xB1,
+    0xD5, 0xD0, 0x06, 0x1A, 0x79, 0xD9, 0xE9, 0xC5, 0xA3, 0x73, 0x6C, 0x6B, 0x86, 0x2C, 0x52, 0x76,
+    0xC6, 0xA5, 0xB8, 0x2F, 0xEA, 0x9E, 0x3C, 0x18, 0x97, 0x22, 0xBB, 0x99, 0x1A, 0x52, 0x78, 0x54,
+    0xBA, 0xB2, 0x65, 0xC9, 0x84, 0xA2, 0x27, 0x32, 0xEF, 0xF4, 0xA2, 0xBC, 0x4C, 0x2E, 0x43, 0x24,
+    0x97, 0x87, 0x3D, 0xD4, 0x65, 0x3D, 0xAE, 0x6C, 0x1D, 0x80, 0xAA, 0xCD, 0x50, 0x11, 0xF3, 0xC6,
+    0xBC, 0xC3, 0xCA, 0x02, 0xFE, 0xD1, 0xB2, 0x86, 0xA4, 0x98, 0xC8, 0x5D, 0x49, 0xD2, 0x92, 0x94,
+    0xD2, 0x72, 0x4C, 0x3B, 0x01, 0xCC, 0xE5, 0x62, 0xCA, 0x33, 0xE5, 0x72, 0x30, 0x6F, 0xF3, 0x05,
+    0xAA, 0xD5, 0x91, 0xE4, 0x10, 0x27, 0x3C, 0x20, 0x79, 0xAB, 0xCD, 0xDA, 0x29, 0x31, 0x2E, 0x9D,
+    0xF8, 0xAE, 0x83, 0x73, 0x11, 0x23, 0xFE, 0x10, 0x2D, 0x7D, 0xD5, 0x42, 0xDC, 0x90, 0x67, 0x33,
+    0xC2, 0x13, 0x59, 0xAF, 0x23, 0x44, 0x9A, 0x16, 0x4B, 0xB1, 0xDC, 0x9D, 0xB7, 0xCC, 0x25, 0xB9,
+    0x77, 0x17, 0xC7, 0x1C, 0x81, 0x6A, 0xB3, 0x96, 0xBC, 0x3D, 0x03, 0xE5, 0x5B, 0x01, 0x2A, 0xA9,
+    0xE1, 0xEE, 0x63, 0x89, 0x8C, 0xB9, 0xDF, 0xA2, 0x94, 0x9F, 0x06, 0xE4, 0xCB, 0x6F, 0x3B, 0xE3,
+    0xF5, 0x92, 0x39, 0x79, 0xAF, 0x03, 0xC6, 0x95, 0x2D, 0x96, 0x05, 0x2A, 0xEA, 0x90, 0x4E, 0x58,
+    0xD5, 0x93, 0x64, 0xDF, 0xF3, 0x90, 0x7B, 0x6C, 0x5B, 0xB6, 0xD9, 0x02, 0x4B, 0xD5, 0x23, 0x5F,
+    0x7C, 0xCB, 0x29, 0x59, 0xDA, 0xD1, 0x4A, 0xDE, 0x91, 0x1F, 0x83, 0x86, 0x0A, 0x4F, 0x4B, 0x83,
+    0xBE, 0x76, 0xBE, 0x4F, 0x38, 0xE1, 0xA9, 0xD1, 0xA6, 0x7F, 0x74, 0x8D, 0x96, 0xE4, 0x47, 0x54,
+    0x9C, 0x1B, 0x5E, 0x1F, 0xBE, 0x10, 0x93, 0x71, 0x28, 0xDD, 0x88, 0x15, 0xAA, 0xFE, 0xE6, 0x31,
+    0x7E, 0x98, 0x42, 0x4C, 0xBA, 0xE2, 0x1A, 0x63, 0xBC, 0x7F, 0xFD, 0xB9, 0x81, 0xA6, 0xE3, 0x13,
+    0xC9, 0x19, 0xB7, 0x6E, 0x35, 0x74, 0xD3, 0xAD, 0xC4, 0x9C, 0xF0, 0xB2, 0x91, 0x2A, 0xA5, 0x0E,
+    0x9E, 0x29, 0x1D, 0xB2, 0x2C, 0x3C, 0x56, 0x1E, 0x3A, 0x5A, 0xAF, 0x55, 0x0B, 0x31, 0x39, 0x89,
+    0x11, 0xAA, 0xDA, 0x3A, 0x8C, 0xCB, 0x07, 0x74, 0x60, 0xFE, 0xC6, 0xA3, 0x03, 0x85, 0xC8, 0x02,
+    0x2A, 0xB9, 0x76, 0x44, 0x99, 0x59, 0x51, 0xB1, 0x74, 0x58, 0x4B, 0x69, 0x18, 0xF3, 0xC2, 0x70,
+    0xDB, 0x78, 0xC4, 0x27, 0x48, 0xDA, 0x39, 0x99, 0x81, 0xC8, 0x11, 0xBF, 0xE9, 0xB7, 0x64, 0x65,
+    0x27, 0x4D, 0x59, 0xF4, 0x8C, 0xDA, 0x87, 0xD9, 0x36, 0x50, 0x9D, 0x0B, 0x90, 0xB7, 0xF9, 0x31,
+    0x7B, 0x5C, 0xD5, 0x68, 0xAF, 0x03, 0x4C, 0xB0, 0x50, 0x74, 0xB9, 0x87, 0xC8, 0x3E, 0x18, 0x57,
+    0x74, 0xAB, 0x1C, 0x72, 0x6D, 0x1C, 0x59, 0x9F, 0x9C, 0xE2, 0xAA, 0x46, 0x87, 0x6C, 0x79, 0x70,
+    0xB0, 0xC4, 0x4A, 0x32, 0x35, 0xC9, 0x9F, 0x30, 0xAE, 0xE8, 0x20, 0xA6, 0xA4, 0xB3, 0x71, 0x64,
+    0x3D, 0x03, 0x58, 0xCA, 0x36, 0xA5, 0xB3, 0xD8, 0xC6, 0x42, 0xEE, 0x93, 0x02, 0x9D, 0x80, 0x71,
+    0x79, 0x07, 0x11, 0xD4, 0xA5, 0x91, 0xB6, 0x55, 0x2E, 0x12, 0x14, 0xA6, 0x06, 0xD3, 0x72, 0x36,
+    0x81, 0x36, 0x63, 0x60, 0x7C, 0xB3, 0x8F, 0xB2, 0x4E, 0x65, 0x6D, 0x03, 0xB9, 0x9F, 0x7B, 0x66,
+    0x8D, 0xB4, 0xE6, 0xD5, 0x3F, 0x8A, 0x88, 0x2B, 0x3A, 0x13, 0x98, 0xA9, 0x05, 0x45, 0x57, 0x39,
+    0xA2, 0xEE, 0xC7, 0x54, 0x56, 0xEE, 0x29, 0xDB, 0x7D, 0xB2, 0xBE, 0x70, 0x58, 0x62, 0x72, 0xE0,
+    0x27, 0x6A, 0x20, 0xEF, 0xAA, 0x9A, 0x59, 0xB6, 0x4A, 0x79, 0x41, 0x05, 0xDA, 0x6F, 0xC4, 0x21,
+    0x33, 0xD2, 0xF5, 0x97, 0x22, 0x22, 0x62, 0x44, 0x44, 0xE4, 0xA5, 0xCB, 0x6F, 0x1E, 0x3C, 0xB7,
+    0xBC, 0xB8, 0xB9, 0x7B, 0xCC, 0x69, 0xD9, 0x37, 0x0F, 0x2E, 0x7B, 0x8C, 0x88, 0xF4, 0x24, 0x09,
+    0x1D, 0xDF, 0xCD, 0x18, 0xC5, 0x64, 0x3D, 0x49, 0xE2, 0x09, 0xEB, 0x63, 0x06, 0x65, 0x7B, 0x8B,
+    0xDD, 0x59, 0x3F, 0x82, 0xD6, 0xF5, 0x86, 0x79, 0xFE, 0xF7, 0x16, 0xBB, 0x68, 0x91, 0x80, 0x95,
+    0xE5, 0x46, 0xC6, 0x6F, 0x3F, 0xBF, 0x46, 0x71, 0x55, 0x7A, 0xE2, 0x72, 0xEE, 0xCC, 0x82, 0x05,
+    0x52, 0x17, 0x5D, 0xD9, 0x31, 0xCB, 0x22, 0xC6, 0xD9, 0x55, 0x6A, 0x6F, 0x82, 0x1A, 0xF2, 0x8E,
+    0xAA, 0x9E, 0x26, 0x31, 0x58, 0x62, 0x42, 0xE1, 0xF7, 0xB3, 0x9E, 0xA2, 0xAB, 0x18, 0x8F, 0x43,
+    0xD5, 0x19, 0x7A, 0x99, 0x39, 0x2D, 0xEF, 0x07, 0x42, 0x13, 0xF8, 0xC6, 0x66, 0x22, 0x79, 0x2E,
+    0x35, 0x56, 0xBA, 0x64, 0x39, 0xAA, 0xFA, 0x18, 0x91, 0x2E, 0xB9, 0xA1, 0x15, 0x37, 0x6C, 0x9C,
+    0x8D, 0x76, 0xFE, 0x83, 0x37, 0xFA, 0x84, 0xA1, 0x94, 0xE2, 0x47, 0x0C, 0x77, 0x47, 0xB5, 0x8D,
+    0xDF, 0x32, 0xF2, 0xF6, 0x43, 0x7E, 0x1E, 0xEE, 0xE5, 0xD9, 0xCD, 0xD5, 0x9A, 0x64, 0x4A, 0x04,
+    0xD3, 0xA2, 0x86, 0x34, 0xA9, 0x13, 0x10, 0x93, 0x7B, 0xD8, 0x4F, 0x36, 0x3E, 0xE1, 0x12, 0xE3,
+    0xEE, 0x2C, 0x8C, 0xE1, 0xFE, 0x2D, 0x62, 0x90, 0xB9, 0xD4, 0x5A, 0x16, 0x70, 0x58, 0xDF, 0xC4,
+    0xFC, 0xEC, 0xD2, 0xC5, 0xA4, 0x1C, 0x26, 0x65, 0x0B, 0xB3, 0x23, 0x98, 0x63, 0x3C, 0xA8, 0xE8,
+    0xD2, 0x57, 0xC7, 0x74, 0x19, 0x55, 0x4B, 0x29, 0x9E, 0xB9, 0x38, 0x4E, 0x1E, 0x7C, 0xB7, 0x90,
+    0xC5, 0x11, 0x26, 0xBD, 0x0F, 0x33, 0x88, 0x10, 0x61, 0x40, 0x0D, 0x64, 0x9B, 0x69, 0xCB, 0x8E,
+    0xA2, 0xC3, 0x38, 0x8C, 0xA3, 0x6C, 0xA9, 0x6A, 0xAA, 0xF4, 0xBD, 0x1F, 0xE5, 0x13, 0x18, 0xB6,
+    0x30, 0x6F, 0x0D, 0x37, 0xC5, 0x13, 0x95, 0x74, 0x58, 0xE9, 0xC8, 0xAE, 0xA5, 0x45, 0x92, 0xB2,
+    0x29, 0x49, 0x0C, 0x79, 0x97, 0xBC, 0x40, 0x33, 0xFE, 0x94, 0x6D, 0xBA, 0x5D, 0x2B, 0x58, 0xC2,
+    0x8E, 0x0E, 0xD8, 0x6C, 0x9C, 0x61, 0x31, 0xE9, 0xBE, 0x6C, 0x80, 0x46, 0xDA, 0x74, 0x01, 0x9C,
+    0xCA, 0x7C, 0xDE, 0x36, 0x97, 0x5D, 0x21, 0x1D, 0x7F, 0xB0, 0x52, 0x24, 0x2A, 0x71, 0x62, 0x2C,
+    0x18, 0x87, 0xF6, 0xA8, 0x61, 0xE3, 0xEF, 0xDC, 0x1F, 0xDF, 0x9F, 0x7B, 0xB2, 0x1E, 0xA6, 0xA3,
+    0xFC, 0x2B, 0xE9, 0xB4, 0x2C, 0xC8, 0xAE, 0xDD, 0xEA, 0xAE, 0xB9, 0x1B, 0xEE, 0xDA, 0xB8, 0x3B,
+    0xA9, 0xAB, 0x8D, 0x9B, 0xCA, 0x00, 0x55, 0x4B, 0x23, 0x6D, 0x21, 0x11, 0x5E, 0x80, 0xB3, 0x60,
+    0x6A, 0x54, 0x48, 0xAC, 0xD3, 0x65, 0x9D, 0x94, 0x21, 0xC0, 0xE3, 0xE8, 0x40, 0xE9, 0x38, 0x7B,
+    0x84, 0x5F, 0xF5, 0x14, 0x5D, 0xCA, 0x4E, 0x69, 0x4F, 0xD9, 0x32, 0x1B, 0x11, 0x88, 0xC9, 0xE6,
+    0xAE, 0xDC, 0x27, 0x82, 0x9D, 0x0E, 0xE4, 0x2D, 0x57, 0x28, 0x1C, 0x67, 0xA1, 0x47, 0x5F, 0x5F,
+    0x23, 0xBB, 0x1F, 0x4D, 0x43, 0x6B, 0xC6, 0x75, 0x78, 0x64, 0x0A, 0x16, 0x58, 0xE9, 0xA8, 0x2E,
+    0xAE, 0x96, 0xF1, 0x78, 0x01, 0x79, 0x07, 0xD3, 0xF5, 0xDC, 0x2D, 0xDB, 0xCD, 0xDD, 0xA3, 0x14,
+    0x8E, 0x4D, 0xED, 0x6C, 0x20, 0x97, 0x81, 0xB9, 0x38, 0xD8, 0x67, 0x46, 0x24, 0x32, 0xA8, 0x21,
+    0xEB, 0x75, 0xD0, 0x21, 0xF7, 0x79, 0x57, 0x74, 0xC6, 0x19, 0x57, 0xB6, 0x55, 0x5D, 0x61, 0xA1,
+    0x92, 0xAE, 0x70, 0x5A, 0x16, 0x44, 0xB2, 0x6B, 0x69, 0x12, 0x25, 0x65, 0x56, 0xD5, 0xD8, 0x71,
+    0x9A, 0x59, 0xD8, 0x27, 0xF7, 0x14, 0x2E, 0xCD, 0xC5, 0xC2, 0xA5, 0x94, 0xBC, 0x1A, 0x12, 0xAE,
+    0x70, 0xFC, 0x03, 0x3A, 0x24, 0xC8, 0x41, 0x07, 0x8A, 0x8E, 0x09, 0xC4, 0x71, 0x92, 0x46, 0x48,
+    0x1F, 0x68, 0xD5, 0x40, 0x23, 0x6D, 0x55, 0x17, 0x12, 0x93, 0x91, 0xB6, 0xAC, 0x7D, 0xA3, 0x05,
+    0x70, 0x7A, 0xEE, 0x20, 0x97, 0x00, 0x34, 0xC3, 0x2A, 0x29, 0xC7, 0x49, 0x54, 0x4D, 0x64, 0x46,
+    0xE9, 0x4C, 0x47, 0x3F, 0x92, 0x0A, 0x37, 0x6C, 0x72, 0x16, 0x98, 0x61, 0x31, 0x4E, 0x7B, 0x22,
+    0x13, 0x4C, 0x5B, 0x74, 0x6A, 0x20, 0x52, 0xD5, 0xC6, 0xE9, 0xC0, 0x80, 0xA5, 0xAC, 0x73, 0x9F,
+    0x05, 0xF6, 0xB1, 0x14, 0x9D, 0x0E, 0xE9, 0x38, 0x57, 0x74, 0x6A, 0x60, 0x4A, 0x55, 0x1B, 0x97,
+    0x05, 0x62, 0xB2, 0x48, 0xB7, 0x20, 0x2D, 0x98, 0x0E, 0xFE, 0xAB, 0x08, 0x85, 0x8C, 0xD6, 0x08,
+    0xB8, 0x8B, 0xF1, 0x77, 0x25, 0xDD, 0x98, 0xA5, 0x29, 0xDB, 0x81, 0x0D, 0xDB, 0x94, 0x5E, 0xB3,
+    0xB5, 0x37, 0x12, 0x57, 0x70, 0xA5, 0xEA, 0x57, 0x6E, 0x8A, 0x0E, 0xAB, 0xB7, 0xDC, 0xAF, 0xE2,
+    0x0D, 0xE3, 0x8E, 0xBD, 0x95, 0xED, 0x07, 0x30, 0x2C, 0x27, 0x1F, 0xF0, 0xED, 0xE9, 0x8B, 0xD7,
+    0xDF, 0x6E, 0x3C, 0xFC, 0x6E, 0xE3, 0xC0, 0x4A, 0x3D, 0x26, 0x97, 0x4E, 0xB0, 0x0E, 0x43, 0x74,
+    0x4C, 0x7E, 0x40, 0xF6, 0x6E, 0x4F, 0x16, 0x2A, 0x36, 0xE1, 0xEB, 0x11, 0x8F, 0xEB, 0x36, 0xC8,
+    0x29, 0xDB, 0x3F, 0x77, 0xE3, 0x26, 0x8D, 0x65, 0x32, 0x8E, 0x7A, 0xBD, 0x71, 0xD8, 0xD8, 0x68,
+    0x5C, 0xBA, 0xE0, 0x3F, 0xEE, 0xD3, 0x88, 0x52, 0x72, 0xB1, 0x02, 0x8B, 0x71, 0xD8, 0x5A, 0x07,
+    0x6C, 0xAD, 0x06, 0x6C, 0xCD, 0x0C, 0x5B, 0x53, 0x61, 0xEB, 0x64, 0x9E, 0x74, 0xB0, 0x35, 0x6A,
+    0xB0, 0x2D, 0xCC, 0x6C, 0x0B, 0xB6, 0x69, 0xC1, 0x88, 0x07, 0x2D, 0x11, 0xD4, 0xB2, 0x6C, 0x61,
+    0x96, 0x56, 0xC9, 0x0C, 0x8C, 0x2B, 0x1D, 0xB9, 0xD7, 0x3D, 0xAA, 0x67, 0x02, 0xB3, 0x64, 0x61,
+    0xB3, 0x01, 0xE3, 0x68, 0xC8, 0x7D, 0xA2, 0xBA, 0xAA, 0xE3, 0x80, 0xFA, 0xB0, 0x96, 0xEC, 0xF6,
+    0x8A, 0x18, 0x93, 0x72, 0x35, 0xEA, 0x88, 0xC6, 0x18, 0x3F, 0x98, 0x5A, 0x93, 0x66, 0x4D, 0xE9,
+    0x8A, 0x2E, 0x0F, 0x44, 0x15, 0x93, 0x3B, 0x3E, 0x94, 0x8E, 0xF2, 0x8B, 0x81, 0xEC, 0xA7, 0x11,
+    0xAC, 0x05, 0x2D, 0x21, 0xA9, 0xCF, 0x62, 0x88, 0x30, 0x2B, 0xFC, 0xE8, 0x5F, 0x64, 0x3D, 0x65,
+    0x6B, 0x5C, 0xD6, 0xB3, 0xC0, 0x26, 0xD4, 0x71, 0xA3, 0x1E, 0x21, 0x9D, 0xB4, 0x5F, 0xF9, 0x36,
+    0x6E, 0x4C, 0x25, 0xDD, 0x96, 0x8C, 0xC6, 0x0D, 0x27, 0x55, 0xEB, 0x93, 0x86, 0x5F, 0xED, 0xA4,
+    0xA7, 0x5A, 0xF4, 0x00, 0x87, 0x50, 0xB6, 0x68, 0x0F, 0x2F, 0x1C, 0xD9, 0x93, 0x1B, 0x95, 0xD1,
+    0x07, 0xAA, 0x64, 0x7F, 0x83, 0x4A, 0x56, 0x03, 0x94, 0xF5, 0x5A, 0xA3, 0x5D, 0x3F, 0x78, 0xB6,
+    0x11, 0xF9, 0x9E, 0xC8, 0x00, 0xA7, 0x52, 0x92, 0xA0, 0x49, 0xE6, 0x22, 0xC0, 0x85, 0xB5, 0x9B,
+    0x77, 0x5C, 0x15, 0x56, 0x1F, 0xAC, 0x0A, 0x55, 0x7F, 0xA3, 0xBD, 0xF8, 0x39, 0x83, 0x4B, 0x9C,
+    0x4E, 0x87, 0x0E, 0x2B, 0xD3, 0x74, 0xE3, 0xDF, 0xBF, 0x8C, 0xE9, 0x7A, 0xF3, 0xE0, 0x7F, 0x13,
+    0x59, 0x8A, 0x2C, 0x8F, 0x88, 0x9C, 0xAA, 0x87, 0x61, 0xC5, 0xD7, 0xBE, 0x6D, 0xBC, 0x86, 0x48,
+    0x52, 0x9F, 0x59, 0x7F, 0xC4, 0x47, 0xCA, 0xFD, 0x91, 0x31, 0x37, 0x2D, 0x65, 0x9D, 0x34, 0xEA,
+    0x08, 0x6B, 0xCF, 0x46, 0x66, 0xED, 0xFA, 0x73, 0xE9, 0x43, 0xEB, 0xD3, 0xE4, 0x1D, 0xA6, 0xA5,
+    0x84, 0xAD, 0xC4, 0xCA, 0xA9, 0xB8, 0x0B, 0xE3, 0x8C, 0xD3, 0x21, 0x77, 0x6A, 0xD0, 0x9E, 0x99,
+    0xF2, 0x54, 0x5C, 0xFA, 0xF9, 0xFE, 0xD4, 0x4D, 0x1B, 0x73, 0x3F, 0x4E, 0xB2, 0xF5, 0xC6, 0x37,
+    0x0F, 0x2E, 0xE5, 0x22, 0x31, 0x13, 0x59, 0x82, 0xAA, 0x77, 0xB0, 0x45, 0x47, 0xB4, 0xE4, 0x3F,
+    0x0E, 0x54, 0x5F, 0xAA, 0x99, 0x5E, 0x58, 0x3B, 0x3B, 0x93, 0x63, 0x65, 0x31, 0xAC, 0x9C, 0xA3,
+    0xFA, 0x46, 0xE7, 0x28, 0xFB, 0x40, 0xE7, 0xE8, 0x97, 0x9B, 0x5D, 0xAA, 0xB6, 0x1C, 0x6A, 0x6F,
+    0xFC, 0x84, 0xE9, 0x2F, 0x33, 0xBB, 0x54, 0x7D, 0x0B, 0x9F, 0x69, 0x2D, 0xE6, 0x08, 0xF1, 0x4E,
+    0x86, 0x43, 0xD5, 0x2F, 0xB3, 0x7E, 0x6F, 0xF3, 0xDE, 0x24, 0xBB, 0xB7, 0xFE, 0x5C, 0xFA, 0xD0,
+    0x2F, 0xF4, 0x40, 0x7E, 0xE0, 0x58, 0x2C, 0x31, 0xD2, 0x22, 0x2D, 0x4D, 0x87, 0xED, 0xC9, 0x05,
+    0xFE, 0xFD, 0xD1, 0xBE, 0x1F, 0xCD, 0xDA, 0xE5, 0xC1, 0x41, 0x29, 0xF2, 0x8E, 0xC8, 0x32, 0x19,
+    0x3A, 0xE3, 0xD4, 0x40, 0x55, 0xA7, 0xE2, 0xA4, 0xC0, 0x64, 0x2C, 0x4E, 0xFA, 0xB7, 0x48, 0x57,
+    0x85, 0xA2, 0xCF, 0x85, 0x79, 0x50, 0x13, 0xF2, 0x8E, 0x69, 0x32, 0xAF, 0x65, 0x9B, 0xF5, 0xE9,
+    0x58, 0x80, 0xAF, 0xB3, 0x52, 0xFF, 0x49, 0x6D, 0x24, 0x4B, 0x9B, 0xD2, 0x72, 0xE1, 0x86, 0x9C,
+    0x61, 0x0B, 0x03, 0x02, 0x79, 0xA7, 0x17, 0x50, 0xD5, 0x65, 0x84, 0xC8, 0x3C, 0xA0, 0x83, 0x7E,
+    0xCF, 0x63, 0x5A, 0xF3, 0x6D, 0xC7, 0x3E, 0xDB, 0x15, 0x59, 0x50, 0xFD, 0x04, 0xE3, 0x0A, 0x17,
+    0xB1, 0xD8, 0xAC, 0x57, 0x03, 0x51, 0xFB, 0xA2, 0xD3, 0xDE, 0xB8, 0x8A, 0xB2, 0x2E, 0xEB, 0xC8,
+    0x14, 0xAB, 0xBD, 0x0E, 0x4C, 0xCB, 0xD6, 0xB4, 0x6A, 0x98, 0x31, 0x41, 0xBF, 0x13, 0xB2, 0x9E,
+    0xE2, 0x55, 0x57, 0x38, 0xCC, 0x21, 0x16, 0x6C, 0xCF, 0x00, 0x8D, 0xCB, 0x3B, 0x10, 0xAA, 0x91,
+    0xA5, 0xC4, 0xA9, 0x76, 0xFC, 0xAD, 0xD9, 0x98, 0x97, 0xAC, 0x6B, 0x6A, 0x4E, 0xC0, 0x9E, 0x59,
+    0x52, 0xBC, 0x2C, 0x91, 0xC5, 0xE2, 0x7C, 0x67, 0x16, 0x2C, 0x94, 0x50, 0xF8, 0xAA, 0x63, 0xA6,
+    0x23, 0xA6, 0x1B, 0x63, 0x97, 0xD2, 0x35, 0x64, 0x43, 0xE1, 0xA9, 0xEA, 0xC5, 0x51, 0xEC, 0x92,
+    0x87, 0xB2, 0xE5, 0x30, 0xEB, 0x8F, 0x8E, 0x33, 0xEE, 0xB7, 0xEA, 0xF2, 0x8F, 0xDB, 0xDC, 0x71,
+    0x11, 0xE4, 0x6E, 0x6D, 0x83, 0x52, 0xFA, 0x7F, 0x45, 0xFD, 0xDB, 0x21, 0x77, 0xE2, 0x99, 0x36,
+    0xE2, 0xCC, 0xAB, 0x7F, 0xBE, 0x40, 0x3A, 0xD3, 0x95, 0x81, 0xC3, 0x6C, 0x41, 0xD1, 0x59, 0xC7,
+    0x62, 0x0C, 0x6A, 0x55, 0xCC, 0x03, 0x55, 0x7B, 0x48, 0xD6, 0x9B, 0xEE, 0x28, 0xA8, 0x6D, 0xD4,
+    0x40, 0xE1, 0xAB, 0x7A, 0x7D, 0xDC, 0xB1, 0x84, 0xF2, 0x0A, 0xCE, 0x57, 0x61, 0x2C, 0x61, 0xC9,
+    0xDB, 0x95, 0x2B, 0xC6, 0x49, 0x4E, 0xD6, 0x50, 0x32, 0x5D, 0x91, 0xB0, 0xB0, 0x89, 0xBD, 0xE2,
+    0x6E, 0x91, 0x96, 0xFE, 0x2D, 0x92, 0xEF, 0x45, 0x2E, 0xA1, 0x7D, 0x59, 0xA3, 0x5F, 0xE9, 0xA1,
+    0x90, 0x7A, 0xF4, 0x39, 0xCA, 0x35, 0xE0, 0x71, 0x67, 0x9A, 0x60, 0xD9, 0x4F, 0x45, 0x30, 0xAF,
+    0xFE, 0xF9, 0x02, 0xDB, 0xEB, 0x5E, 0x09, 0x85, 0x2F, 0xFA, 0x84, 0x0F, 0x2D, 0x58, 0xA0, 0x83,
+    0x0E, 0x94, 0xAE, 0x74, 0x1C, 0x72, 0x48, 0xD6, 0xEB, 0x1E, 0xE3, 0x8C, 0xC3, 0x62, 0x51, 0x51,
+    0x0D, 0x14, 0xBE, 0xE8, 0xB0, 0xB5, 0xAD, 0x89, 0x89, 0x7F, 0xA5, 0x86, 0x55, 0xFA, 0x59, 0x87,
+    0x15, 0x57, 0x2A, 0xF9, 0x75, 0x35, 0xB7, 0x61, 0xCD, 0x8B, 0xD2, 0xED, 0x99, 0x6F, 0x4B, 0x7F,
+    0x67, 0x39, 0xFF, 0x1F, 0x23, 0x55, 0x24, 0x52, 0x05, 0x22, 0xD6, 0x11, 0xB1, 0xB5, 0x8A, 0x34,
+    0x64, 0x03, 0x87, 0x64, 0x3D, 0x8B, 0x75, 0x9D, 0x4E, 0x24, 0x0F, 0x6A, 0xA0, 0xF0, 0xD9, 0x80,
+    0xE9, 0xF4, 0x58, 0xAC, 0x63, 0x5C, 0x1E, 0x28, 0xDB, 0xC2, 0x53, 0xB5, 0xBF, 0x50, 0xFA, 0xE5,
+    0x5A, 0xFA, 0x75, 0x16, 0x54, 0xBF, 0x7D, 0x24, 0x7D, 0x95, 0xA4, 0x1F, 0x8A, 0x4E, 0xFB, 0xC2,
+    0x59, 0xCA, 0xBA, 0x6C, 0x8F, 0xA4, 0x3F, 0x2B, 0x5B, 0xD3, 0x32, 0xCC, 0x98, 0x90, 0xBD, 0x13,
+    0xB2, 0x9E, 0x3C, 0x49, 0x7F, 0x89, 0x85, 0x2A, 0x01, 0x3B, 0x47, 0xD2, 0x4F, 0x9E, 0x55, 0xEE,
+    0xD7, 0xE8, 0xA5, 0x8A, 0xC0, 0xE9, 0xF3, 0x1D, 0x20, 0x8B, 0x35, 0x5B, 0x8C, 0x35, 0x2D, 0x3A,
+    0x77, 0x73, 0xCF, 0xF4, 0xEF, 0x83, 0xD6, 0xF8, 0x1B, 0xD0, 0x9A, 0x5B, 0xF8, 0xF4, 0x87, 0x90,
+    0x9D, 0x77, 0xD0, 0xF4, 0xA0, 0x17, 0x00, 0x77, 0x1D, 0x3C, 0x03, 0x85, 0x2C, 0x38, 0x9E, 0xF3,
+    0x04, 0x4A, 0xB9, 0x08, 0x8D, 0x2C, 0x61, 0xFE, 0x37, 0xF3, 0x90, 0x98, 0xE3, 0x4D, 0x4D, 0xE9,
+    0x6C, 0x8D, 0xEE, 0xAB, 0x16, 0x0E, 0x8D, 0x83, 0xF2, 0x7B, 0x1E, 0xF4, 0xCF, 0x7A, 0x20, 0x46,
+    0xC0, 0x36, 0x40, 0xF9, 0x6A, 0x0B, 0xF9, 0xFB, 0x1E, 0xB2, 0xEB, 0x03, 0xB0, 0x38, 0x04, 0x9A,
+    0xAA, 0x85, 0xEA, 0xE5, 0x00, 0xA6, 0x8B, 0x60, 0x82, 0x75, 0x14, 0x21, 0x1F, 0x30, 0x3D, 0xF3,
+    0x37, 0xCE, 0x0F, 0xA9, 0x08, 0x92, 0x4A, 0xBA, 0x15, 0xF6, 0x78, 0xEA, 0xE0, 0x59, 0xB4, 0x08,
+    0x4A, 0x36, 0x4B, 0x8E, 0xC4, 0x93, 0x8B, 0x90, 0x2F, 0x1E, 0x0B, 0x7A, 0xE0, 0x30, 0x1B, 0x30,
+    0x2E, 0xA2, 0xC3, 0x2C, 0x91, 0x9E, 0xAC, 0x71, 0x98, 0x97, 0x3D, 0xFA, 0xA7, 0x03, 0x6A, 0x98,
+    0xC0, 0xAC, 0x6C, 0xB1, 0x3A, 0x50, 0xB5, 0x0B, 0x4A, 0x57, 0xBE, 0x7E, 0xBE, 0xCB, 0x44, 0xBA,
+    0x04, 0xED, 0xDF, 0x96, 0xB0, 0xCB, 0x7B, 0xA1, 0x68, 0xCF, 0x80, 0x5A, 0xCE, 0x19, 0xE1, 0x74,
+    0xF5, 0xAF, 0xF8, 0x2D, 0x2B, 0x0C, 0x38, 0xC5, 0x27, 0xD1, 0xCE, 0xC0, 0xF2, 0x72, 0x8B, 0x11,
+    0x77, 0x3C, 0x2F, 0xF1, 0x6B, 0xE7, 0xDE, 0xC2, 0x5D, 0xD9, 0x25, 0x50, 0xB1, 0xAA, 0xC1, 0xBC,
+    0x38, 0x00, 0x53, 0xD3, 0x42, 0xE1, 0x7A, 0xE0, 0xC1, 0xFC, 0x78, 0x4E, 0x84, 0x66, 0x59, 0x43,
+    0x29, 0xD2, 0x92, 0xC9, 0xFF, 0x2A, 0x8E, 0xCA, 0xD3, 0xB4, 0x6A, 0x01, 0xCD, 0x48, 0x99, 0x3A,
+    0x84, 0x6C, 0xD0, 0x01, 0xF2, 0x50, 0xB5, 0x24, 0xFA, 0xFE, 0x48, 0x66, 0x8F, 0xA5, 0x83, 0x3C,
+    0x4C, 0x80, 0xF2, 0xA5, 0x01, 0x38, 0x2C, 0x3C, 0xE3, 0x24, 0x2B, 0xDD, 0x21, 0x30, 0x57, 0x11,
+    0x74, 0xAF, 0x03, 0x58, 0x67, 0x02, 0x59, 0xA4, 0xF4, 0xD8, 0x8E, 0xEA, 0xDA, 0xA3, 0xCB, 0x94,
+    0xDF, 0x83, 0x42, 0xFA, 0x35, 0xA1, 0x80, 0x53, 0x4F, 0x3E, 0x03, 0x33, 0xE3, 0xC8, 0xBB, 0x08,
+    0x67, 0x0B, 0x87, 0xEE, 0xF6, 0xE0, 0x3E, 0xBD, 0x09, 0xF5, 0xE6, 0xD2, 0xA2, 0x44, 0x1C, 0xE5,
+    0xBB, 0x8D, 0x63, 0x49, 0xD5, 0x16, 0x1E, 0xCB, 0x18, 0x18, 0xE8, 0x60, 0x5C, 0x5A, 0x4D, 0x56,
+    0x0D, 0x69, 0xE9, 0xE5, 0xBE, 0x6C, 0x47, 0xA8, 0x9F, 0x48, 0xE1, 0x75, 0x4F, 0x43, 0x7E, 0xED,
+    0xEE, 0x9E, 0x42, 0xA4, 0x1E, 0x79, 0x8E, 0x23, 0x4B, 0xFC, 0xD4, 0xC5, 0x51, 0x09, 0x6F, 0xC2,
+    0x7A, 0x47, 0x96, 0x1D, 0xA8, 0xE4, 0x22, 0x5A, 0xC4, 0x8F, 0x69, 0x49, 0xB5, 0x60, 0x46, 0x11,
+    0x8A, 0x0D, 0x8B, 0x65, 0x57, 0x0B, 0x7B, 0xA1, 0x03, 0xB6, 0xB5, 0xBB, 0xF3, 0xA0, 0x45, 0x06,
+    0x1A, 0xE9, 0x29, 0xBA, 0x2A, 0x69, 0x5B, 0xE3, 0x8C, 0x53, 0x03, 0x87, 0x94, 0xB5, 0x0E, 0x59,
+    0x8F, 0xAD, 0x6D, 0x12, 0xB5, 0x71, 0x13, 0x58, 0x14, 0x5D, 0x82, 0x1A, 0x9E, 0x4D, 0xC3, 0xC9,
+    0x47, 0xEF, 0x73, 0xFB, 0xF8, 0x60, 0xF6, 0xCA, 0xC0, 0xB4, 0x09, 0x2C, 0xAE, 0x5F, 0x44, 0x3A,
+    0x10, 0x50, 0x8B, 0xF4, 0x09, 0xDD, 0xFF, 0x62, 0xC4, 0xAC, 0x62, 0x0D, 0x5E, 0xFD, 0x43, 0x5E,
+    0xD3, 0x2F, 0x8E, 0x0D, 0x01, 0x54, 0x68, 0x1C, 0xD3, 0x26, 0x60, 0x27, 0xCF, 0x60, 0x16, 0x29,
+    0xFA, 0x57, 0x8B, 0x31, 0xF1, 0x63, 0xEB, 0x1B, 0x7C, 0xFF, 0xE9, 0x0D, 0x01, 0x41, 0xB6, 0xB9,
+    0xF1, 0x18, 0x7B, 0x75, 0x7F, 0xDC, 0x58, 0x8E, 0x89, 0x8F, 0x91, 0x9C, 0x7F, 0x91, 0xC7, 0xC9,
+    0x7C, 0xD9, 0xA2, 0x7F, 0x3C, 0x8C, 0x9C, 0x2D, 0x33, 0x1C, 0xB3, 0xBA, 0xA3, 0xA0, 0x10, 0x19,
+    0x52, 0x71, 0x54, 0xD9, 0xE6, 0x3D, 0x33, 0x8A, 0x90, 0x6D, 0x58, 0xD6, 0x94, 0x4F, 0x1A, 0x2D,
+    0x2B, 0x7A, 0x60, 0xF1, 0x65, 0x71, 0x5A, 0x64, 0xA0, 0x94, 0x05, 0xCC, 0xB2, 0x3E, 0x19, 0x66,
+    0xE3, 0x8C, 0x63, 0x42, 0xD5, 0xAA, 0x1E, 0x4B, 0xD1, 0xB1, 0x48, 0xB1, 0x7E, 0x4C, 0x19, 0x14,
+    0xD3, 0x55, 0x35, 0xA5, 0xE3, 0xA3, 0x9C, 0x4A, 0xCE, 0xC0, 0xD9, 0xAA, 0x4E, 0xBE, 0x80, 0xD4,
+    0x23, 0x1D, 0x6C, 0x63, 0x12, 0x54, 0x65, 0xC4, 0xBC, 0xFA, 0xDD, 0x44, 0x3E, 0x14, 0xA0, 0xA9,
+    0x13, 0xF7, 0xDE, 0x74, 0xBF, 0x0C, 0x86, 0xBD, 0xDA, 0xB8, 0xF2, 0x6D, 0x75, 0x3F, 0xF2, 0xC9,
+    0xCA, 0x76, 0xCC, 0x09, 0xBD, 0xB0, 0xA9, 0x56, 0xE7, 0x0B, 0x10, 0x89, 0xD8, 0xEB, 0xF3, 0xB6,
+    0x08, 0xDC, 0x99, 0x0C, 0xD7, 0x3A, 0xCF, 0xEE, 0x46, 0xC3, 0x69, 0xFA, 0x15, 0xB5, 0x5A, 0xBA,
+    0xB1, 0xD0, 0x27, 0x5F, 0xAE, 0xF2, 0x39, 0xB6, 0x1D, 0x8F, 0x5A, 0x1F, 0x6E, 0xDB, 0x3B, 0x28,
+    0x42, 0xFE, 0xC6, 0xA3, 0x0B, 0x1A, 0x91, 0x3A, 0x13, 0x69, 0x61, 0x37, 0x81, 0x3F, 0xCF, 0xA4,
+    0xAB, 0x89, 0xEB, 0xD0, 0x79, 0x23, 0xF9, 0x53, 0x49, 0x9D, 0x8B, 0xB4, 0xF6, 0x3B, 0xD3, 0x6C,
+    0x48, 0xF3, 0xBC, 0xAA, 0x93, 0x67, 0x2E, 0x6D, 0x3A, 0xF5, 0xDC, 0xA7, 0x74, 0x7B, 0xE5, 0xD6,
+    0x41, 0x5B, 0x1E, 0xCE, 0x32, 0xAF, 0x45, 0x06, 0x25, 0x52, 0x8F, 0xB5, 0x9E, 0xD9, 0xC5, 0x91,
+    0xE2, 0x5B, 0x45, 0x28, 0xFE, 0xA2, 0x23, 0x0B, 0x25, 0x5C, 0xD8, 0xBC, 0xF6, 0x7F, 0xF8, 0x4B,
+    0xFF, 0x5A, 0x22, 0xDC, 0x36, 0x3D, 0xF9, 0x6B, 0x81, 0x89, 0xF6, 0xBA, 0x3B, 0xE2, 0xAF, 0xFE,
+    0xDA, 0x2E, 0x1D, 0xE0, 0x6E, 0xE9, 0x30, 0x22, 0x4E, 0xCB, 0x73, 0x03, 0x73, 0x54, 0x6D, 0x56,
+    0xC3, 0x2B, 0x37, 0x07, 0x9C, 0x48, 0xD0, 0x4B, 0xC0, 0x2C, 0x80, 0x6A, 0x00, 0x1A, 0x3F, 0x32,
+    0xA4, 0xF5, 0x31, 0x29, 0x94, 0x0E, 0xF4, 0xA0, 0x60, 0xCE, 0x64, 0x77, 0xDE, 0xE5, 0x22, 0x3D,
+    0x95, 0x0C, 0x70, 0xD2, 0x8F, 0x54, 0xE6, 0x23, 0xEE, 0xF0, 0xDE, 0xF8, 0x4B, 0xD3, 0x6F, 0x30,
+    0x8C, 0x33, 0xE9, 0x95, 0x88, 0xB7, 0xDF, 0x99, 0x16, 0x1E, 0xA6, 0x29, 0xEC, 0x6E, 0xD2, 0xE9,
+    0xCD, 0x22, 0x9D, 0xBC, 0xEA, 0x60, 0x7E, 0x14, 0x80, 0x87, 0x3E, 0x5B, 0x18, 0x91, 0xB6, 0x91,
+    0x8E, 0xA2, 0x86, 0x90, 0x16, 0xCB, 0x24, 0xD1, 0xA9, 0xB7, 0x51, 0xC9, 0xCC, 0x81, 0xBA, 0xA8,
+    0x46, 0x0A, 0xCA, 0xF4, 0x18, 0x05, 0x65, 0xF1, 0x61, 0xCE, 0xF4, 0xCF, 0xF0, 0x09, 0xEE, 0x57,
+    0x03, 0xE6, 0x9B, 0x9E, 0x5C, 0x5A, 0xF4, 0xF2, 0x38, 0x69, 0xB4, 0x92, 0x5A, 0x89, 0x78, 0x7D,
+    0xED, 0x51, 0x57, 0xF8, 0x74, 0xC7, 0x8B, 0x2E, 0x89, 0x51, 0x2F, 0xC7, 0xD3, 0x57, 0x03, 0x64,
+    0x6B, 0x3D, 0xB9, 0xE6, 0x6A, 0xF6, 0xD9, 0x82, 0xA4, 0xB1, 0x3B, 0x78, 0x04, 0x4A, 0x11, 0x79,
+    0x45, 0x44, 0x16, 0x56, 0x44, 0xDC, 0x2D, 0x51, 0xC1, 0x5B, 0xB1, 0x68, 0xAA, 0x5B, 0x62, 0xCE,
+    0xC7, 0x8E, 0xBB, 0xD9, 0x8F, 0x55, 0x37, 0xDF, 0xEF, 0x15, 0x5F, 0xAB, 0x09, 0xAB, 0xFB, 0x7D,
+    0x0F, 0x6C, 0x8D, 0x00, 0xD2, 0xDD, 0x12, 0x1B, 0x89, 0xBF, 0xF3, 0xEE, 0x23, 0x37, 0xA3, 0x4E,
+    0xE5, 0x71, 0xD4, 0xC9, 0x82, 0x3D, 0x47, 0x25, 0x14, 0x82, 0xEE, 0x28, 0x6A, 0x4C, 0x6A, 0x33,
+    0xD0, 0x93, 0x05, 0xC4, 0xB3, 0xAC, 0xE1, 0x33, 0xDC, 0x8B, 0x69, 0xF7, 0x51, 0xFD, 0x0C, 0xAA,
+    0xC5, 0xE8, 0x46, 0x6F, 0xD0, 0x7B, 0x1A, 0x11, 0x39, 0x2F, 0x22, 0xAF, 0x8A, 0x48, 0x38, 0x96,
+    0xFB, 0x3B, 0x06, 0x0F, 0x1F, 0xD3, 0x9B, 0x87, 0xB7, 0xDA, 0xF8, 0x73, 0x13, 0x82, 0xC9, 0xD4,
+    0xEC, 0x27, 0x18, 0xA6, 0xE7, 0x9E, 0x6D, 0xF4, 0xCB, 0xED, 0x98, 0x38, 0xB9, 0x5B, 0x62, 0x2E,
+    0xE2, 0x7E, 0xE7, 0xDD, 0x47, 0x6E, 0x99, 0x18, 0xBA, 0x01, 0x27, 0x1A, 0xC1, 0x9B, 0xFE, 0x0E,
+    0x2A, 0x49, 0x65, 0xCE, 0x3B, 0x3F, 0xFF, 0x86, 0xE6, 0x37, 0xDE, 0xA8, 0x13, 0x8F, 0xFD, 0x28,
+    0xB5, 0x34, 0xB1, 0x22, 0x2E, 0xE9, 0xFB, 0xBF, 0xCB, 0x0D, 0x25, 0xAF, 0xD1, 0x8E, 0x2C, 0x40,
+    0xE4, 0xA4, 0x48, 0x2E, 0xE2, 0x1E, 0xFB, 0xD1, 0x8E, 0x0E, 0x30, 0xC0, 0x84, 0x6C, 0x7E, 0x80,
+    0x88, 0xFB, 0x47, 0xD7, 0x2F, 0xA9, 0x01, 0xF6, 0xA1, 0xAA, 0x57, 0x20, 0x69, 0x04, 0x7B, 0x8E,
+    0x42, 0x1C, 0xF3, 0x90, 0x6C, 0xEF, 0x09, 0x3E, 0x02, 0x66, 0x30, 0x63, 0xBD, 0x79, 0xFE, 0x94,
+    0x38, 0x94, 0x2B, 0xDA, 0x1B, 0x8A, 0xCD, 0xB7, 0x13, 0xA2, 0x3A, 0x21, 0x39, 0x1C, 0xD9, 0x8D,
+    0x9C, 0xDF, 0xF5, 0x9E, 0x0D, 0x36, 0xF0, 0x76, 0xDA, 0x33, 0x23, 0xE5, 0x81, 0x37, 0xF6, 0x4C,
+    0x12, 0x10, 0x36, 0x21, 0xF1, 0x42, 0xF2, 0x90, 0xAA, 0x2D, 0x97, 0xE8, 0x48, 0xF9, 0xEE, 0xA3,
+    0x31, 0x11, 0xB3, 0x29, 0xA5, 0x5F, 0xE7, 0x20, 0x76, 0x68, 0xB1, 0xFE, 0xF3, 0x18, 0x79, 0xDB,
+    0x11, 0x9A, 0xC0, 0x3D, 0x47, 0xE9, 0x5B, 0x28, 0x6B, 0xA6, 0x47, 0x95, 0xA6, 0x81, 0xB2, 0x9D,
+    0xA0, 0xFA, 0xA2, 0xA3, 0x3A, 0xEE, 0x43, 0x95, 0x35, 0xB3, 0x6C, 0x85, 0x78, 0x24, 0x67, 0x6A,
+    0x5D, 0x83, 0xF1, 0xE4, 0xF5, 0x54, 0x83, 0x51, 0xC8, 0xC3, 0x7E, 0xC5, 0x15, 0x3B, 0xB8, 0x08,
+    0xA5, 0x0C, 0x37, 0x95, 0x24, 0x59, 0xD0, 0xDE, 0x38, 0xD4, 0x90, 0xFB, 0xE4, 0x56, 0x50, 0xA5,
+    0xD9, 0x62, 0x49, 0xC5, 0x92, 0x1B, 0x7B, 0xEC, 0xD1, 0x1E, 0x5F, 0xB6, 0xA8, 0xA1, 0xE8, 0x60,
+    0x96, 0x92, 0xC7, 0xAB, 0x3D, 0xB9, 0x2F, 0xDB, 0x54, 0x91, 0x92, 0x78, 0xC3, 0x0D, 0x16, 0x6C,
+    0x6D, 0x3C, 0xD6, 0x29, 0xD9, 0x9D, 0x3B, 0x2A, 0x11, 0xC7, 0x98, 0x61, 0xDE, 0x59, 0xD7, 0x4B,
+    0x35, 0xE2, 0x8F, 0x8F, 0xED, 0x37, 0x24, 0x89, 0xCF, 0xF0, 0x38, 0x94, 0xEC, 0x91, 0xCA, 0x7F,
+    0x68, 0x96, 0x40, 0x76, 0x8D, 0xDF, 0xB2, 0x69, 0x92, 0xD5, 0x27, 0x61, 0x8B, 0x80, 0xBE, 0xBE,
+    0x1C, 0xB9, 0x68, 0x9B, 0x35, 0x54, 0xBF, 0x21, 0xE1, 0xA4, 0x97, 0xD4, 0x63, 0x27, 0x04, 0xBE,
+    0x71, 0x3B, 0x70, 0x8F, 0x76, 0x90, 0x3F, 0xE9, 0x49, 0x65, 0xB6, 0xC9, 0xEC, 0x1E, 0xF3, 0xBF,
+    0x87, 0x8D, 0x6B, 0x9C, 0x41, 0xB1, 0x41, 0xA6, 0xCF, 0xFD, 0xE6, 0x9E, 0x0D, 0x9A, 0xFD, 0x90,
+    0x7B, 0x98, 0x64, 0x3D, 0x54, 0xF5, 0x74, 0x73, 0xCF, 0x38, 0xDF, 0x12, 0x41, 0x64, 0x02, 0xA5,
+    0x33, 0x0E, 0xD3, 0xE9, 0x01, 0x13, 0x68, 0x7E, 0x74, 0x3E, 0x50, 0x48, 0xCA, 0xE8, 0x74, 0xAB,
+    0x2A, 0x91, 0x74, 0xD7, 0x16, 0xE3, 0xA8, 0xCF, 0x68, 0x97, 0xDA, 0x37, 0x98, 0xBC, 0x4D, 0x6A,
+    0x4D, 0x6D, 0xD4, 0x26, 0xAB, 0x3E, 0x8D, 0x6F, 0x55, 0xCF, 0xAD, 0x86, 0xDC, 0x53, 0xD6, 0xB3,
+    0x74, 0x8B, 0x53, 0xA4, 0x52, 0xB6, 0x4C, 0xD4, 0x2A, 0x22, 0x59, 0xD5, 0xA0, 0x0F, 0x3A, 0xAC,
+    0x2A, 0x83, 0x87, 0xF2, 0x72, 0x62, 0x90, 0xCF, 0xFB, 0xED, 0x35, 0x8E, 0xF3, 0xF5, 0x93, 0xED,
+    0x18, 0x2C, 0x67, 0xC1, 0x02, 0x7B, 0xC6, 0x41, 0x99, 0x79, 0xD0, 0xED, 0x85, 0x1B, 0x8B, 0xDF,
+    0x4C, 0x6B, 0x1C, 0x6A, 0x48, 0x82, 0xA9, 0x6A, 0xB2, 0x90, 0xB4, 0xB1, 0x5D, 0xB5, 0xB5, 0x98,
+    0x24, 0xCD, 0xBD, 0xE6, 0x10, 0x19, 0x67, 0x1C, 0x0C, 0x69, 0x86, 0x55, 0x35, 0x59, 0x9F, 0x1D,
+    0x7D, 0x20, 0x29, 0xFA, 0xC9, 0x11, 0x61, 0x69, 0x02, 0xA5, 0x4B, 0x73, 0xCC, 0xB6, 0x08, 0x69,
+    0xE1, 0x25, 0xB9, 0xA5, 0x49, 0x36, 0x86, 0x2B, 0xD9, 0xC5, 0xAF, 0x81, 0x79, 0x31, 0x42, 0xF5,
+    0x70, 0x80, 0xFD, 0xC2, 0x41, 0x5F, 0x41, 0xD6, 0x3E, 0xC8, 0x0D, 0x32, 0xD3, 0x61, 0x85, 0xB8,
+    0xE9, 0x40, 0xD9, 0xE6, 0x9E, 0xB2, 0x2E, 0x3A, 0xAA, 0x94, 0x5E, 0x34, 0x2E, 0x65, 0x92, 0x27,
+    0x94, 0x35, 0xB3, 0x54, 0x8A, 0x69, 0x51, 0x11, 0x8B, 0x1E, 0xB0, 0x14, 0x7D, 0x62, 0xC4, 0xD9,
+    0x27, 0xAF, 0x87, 0x24, 0xBB, 0x42, 0x1E, 0xF6, 0xA3, 0xF0, 0x22, 0x98, 0xF6, 0x48, 0x77, 0x14,
+    0x1D, 0x4C, 0xF5, 0x91, 0x56, 0x99, 0x1C, 0xDB, 0x13, 0x8F, 0xF6, 0xB4, 0x13, 0x52, 0x38, 0x99,
+    0xF5, 0x85, 0xDB, 0xDC, 0x33, 0x2E, 0xCF, 0xB2, 0x4D, 0xD2, 0x54, 0x91, 0x08, 0x8B, 0x24, 0x8B,
+    0x7C, 0xF1, 0x65, 0x81, 0xB9, 0xC8, 0x4A, 0x17, 0xE6, 0x7E, 0xD5, 0xF3, 0x28, 0xF3, 0xEB, 0x8C,
+    0xC1, 0x1E, 0x80, 0x79, 0x3D, 0xB5, 0xC3, 0xF9, 0xCD, 0x4D, 0x9D, 0xA2, 0x1D, 0x51, 0xFF, 0x2B,
+    0xAB, 0x7C, 0x6B, 0x58, 0x9D, 0xB7, 0x59, 0x5B, 0xAE, 0x53, 0xE9, 0xB7, 0x91, 0xB3, 0x51, 0x24,
+    0xAC, 0xAE, 0xF8, 0xA1, 0x07, 0x28, 0xBA, 0x3D, 0xB8, 0x99, 0xC7, 0x36, 0xF2, 0x69, 0x2C, 0x54,
+    0x65, 0x4B, 0xE5, 0x28, 0x5F, 0xF6, 0x98, 0x40, 0xF1, 0x83, 0x81, 0x22, 0xA2, 0xC3, 0x04, 0xFD,
+    0x36, 0x59, 0x6F, 0xDA, 0xEC, 0xBD, 0x8E, 0xA8, 0x3D, 0x43, 0xCF, 0x84, 0x81, 0xBD, 0xB3, 0x58,
+    0x2C, 0xD6, 0xD4, 0x65, 0x6B, 0x5C, 0xF9, 0x70, 0x67, 0x9C, 0x0E, 0xC6, 0xF5, 0x3A, 0x10, 0xF3,
+    0x6E, 0x3B, 0xEB, 0xB1, 0x3A, 0x98, 0x36, 0x62, 0x5C, 0xAF, 0xFD, 0x3E, 0x3A, 0x4C, 0x19, 0x2C,
+    0xC4, 0x6D, 0xB6, 0xCB, 0x1A, 0x5B, 0x61, 0xBE, 0xE7, 0x28, 0xBE, 0xDF, 0x66, 0x3F, 0xF3, 0x64,
+    0xEF, 0x39, 0x66, 0x01, 0xE6, 0x3E, 0xF9, 0xD8, 0x81, 0x22, 0x42, 0x11, 0xC9, 0x24, 0x39, 0x97,
+    0x4D, 0x8A, 0x33, 0x4A, 0xB7, 0x2E, 0x7E, 0x5B, 0x5D, 0x77, 0x13, 0x00, 0x26, 0x16, 0x60, 0x5F,
+    0x77, 0xC0, 0x83, 0x3C, 0x78, 0xFC, 0xFA, 0xB6, 0xC9, 0x03, 0xD6, 0xB8, 0x2C, 0x52, 0x3E, 0x1D,
+    0x10, 0x4C, 0x17, 0xF9, 0xD7, 0x9D, 0x0E, 0x96, 0xB3, 0x7D, 0xD6, 0x1B, 0x57, 0x9D, 0x25, 0xEA,
+    0x60, 0xBE, 0x54, 0xCF, 0x88, 0xC5, 0xD5, 0xCE, 0x62, 0xB5, 0x1F, 0xCA, 0xBA, 0x78, 0x31, 0x6C,
+    0x1B, 0x97, 0x85, 0xC1, 0x7C, 0xD3, 0x33, 0xDD, 0xD3, 0x3F, 0x09, 0x54, 0xDB, 0x5C, 0x19, 0x28,
+    0xBE, 0xCF, 0xFD, 0x53, 0xB2, 0xF7, 0xDB, 0xE2, 0x10, 0x9A, 0x2E, 0x93, 0x9A, 0x32, 0x30, 0x77,
+    0xE4, 0x3D, 0x65, 0xB7, 0x1A, 0x61, 0xE9, 0x21, 0x97, 0xB1, 0x33, 0xCD, 0xBE, 0xEE, 0x30, 0xDC,
+    0xFE, 0x21, 0xB5, 0xAF, 0x80, 0xCF, 0x42, 0x6A, 0x0B, 0x32, 0x36, 0xCE, 0x89, 0x7B, 0x80, 0xCD,
+    0x02, 0x14, 0x75, 0x51, 0xFF, 0x16, 0x17, 0x9F, 0xDF, 0xC6, 0xC8, 0x00, 0xB7, 0x3A, 0x90, 0x75,
+    0xF7, 0x1D, 0xBF, 0xB5, 0x85, 0x43, 0x0D, 0xB3, 0x54, 0xA2, 0x6D, 0xBA, 0x95, 0xED, 0xA2, 0xAA,
+    0x4D, 0xA7, 0x06, 0x35, 0x8C, 0x76, 0xCF, 0x74, 0x14, 0x2F, 0x0E, 0xB0, 0x6F, 0x41, 0xBF, 0x35,
+    0xC6, 0x2C, 0x4A, 0x56, 0xCC, 0xD8, 0x5B, 0xE3, 0xE0, 0xDB, 0xAB, 0x15, 0x3F, 0xDB, 0x40, 0x2B,
+    0x52, 0x0D, 0xFF, 0x51, 0xB1, 0xE1, 0x6C, 0x5D, 0xC2, 0x7F, 0x7C, 0xCE, 0x19, 0x11, 0x41, 0x8B,
+    0x88, 0x53, 0x63, 0x03, 0x9E, 0x22, 0xAC, 0xFC, 0x62, 0xDD, 0xAF, 0xB2, 0x1E, 0xD9, 0xB0, 0x02,
+    0xFD, 0x37, 0xC8, 0xCC, 0x4B, 0xC6, 0x58, 0x6A, 0xB3, 0xB8, 0xAE, 0x1E, 0x03, 0x3B, 0xAA, 0xE3,
+    0xA4, 0x5E, 0xD3, 0x01, 0xC5, 0xF5, 0x83, 0x83, 0x56, 0x8B, 0x48, 0x60, 0xEC, 0xFA, 0xC3, 0xE7,
+    0xC6, 0xE3, 0xAB, 0x36, 0x5D, 0x9A, 0x69, 0x61, 0xF3, 0x36, 0x37, 0xB2, 0xA0, 0x14, 0xA9, 0xD5,
+    0xEE, 0xF9, 0x11, 0xB5, 0x29, 0x7C, 0xFA, 0xC9, 0x47, 0xEA, 0x9B, 0xEE, 0xD3, 0x4F, 0x36, 0xA4,
+    0xD1, 0xA9, 0x15, 0xB7, 0x6D, 0x31, 0xDE, 0x2F, 0x2B, 0xD2, 0x96, 0xA9, 0xFE, 0x2A, 0x19, 0xD7,
+    0xAA, 0x5D, 0xDD, 0xDF, 0x2C, 0xDC, 0xCC, 0xE5, 0xB6, 0x22, 0x31, 0x89, 0x25, 0x1F, 0x1B, 0x06,
+    0xDD, 0x78, 0x29, 0x7E, 0x95, 0x02, 0xCA, 0x6F, 0x25, 0xAA, 0x23, 0x29, 0x7D, 0xB0, 0xA8, 0xEA,
+    0xD5, 0x5B, 0xF5, 0xE6, 0xC1, 0x01, 0x46, 0x52, 0xD5, 0x8E, 0x78, 0xE0, 0xE4, 0x78, 0xAE, 0xCA,
+    0xDD, 0x58, 0x86, 0x49, 0x23, 0x0B, 0x1A, 0x59, 0x70, 0xFA, 0xCB, 0x23, 0x8E, 0x59, 0x24, 0xFA,
+    0x21, 0xCD, 0x51, 0xD9, 0xA9, 0xE9, 0xD6, 0x9B, 0xC6, 0x4E, 0x2C, 0xEB, 0x4D, 0x56, 0xA4, 0x6D,
+    0x44, 0x6A, 0xF8, 0x04, 0x9F, 0x84, 0xDC, 0x59, 0x60, 0xDA, 0xAC, 0xCA, 0x0E, 0x33, 0xE1, 0x46,
+    0x54, 0xF0, 0x43, 0x9E, 0x1D, 0x59, 0x9D, 0xD5, 0xF4, 0x85, 0xA3, 0x34, 0x2E, 0x01, 0x11, 0x8D,
+    0x3B, 0xEA, 0x3D, 0xF3, 0x1B, 0x98, 0x1D, 0x27, 0x76, 0x80, 0x26, 0x82, 0x92, 0x51, 0x9C, 0x23,
+    0xA3, 0xEB, 0x17, 0x93, 0xB9, 0x26, 0xBF, 0x90, 0xCC, 0xF5, 0x2B, 0x52, 0xC5, 0x0E, 0x57, 0xFD,
+    0x6A, 0x6C, 0xBF, 0xEA, 0x2D, 0xF0, 0xB5, 0xDC, 0x5B, 0x86, 0xDC, 0xDD, 0xC3, 0xD7, 0x55, 0xD4,
+    0xC1, 0xB8, 0x8A, 0x0B, 0xF0, 0x59, 0x74, 0xC4, 0x0E, 0xD9, 0xBB, 0xBD, 0xCD, 0xDE, 0xF1, 0x59,
+    0xA7, 0xEA, 0x93, 0xF9, 0x52, 0x5F, 0x95, 0xF7, 0x7F, 0xEC, 0xE7, 0xE1, 0xF9, 0xCC, 0x73, 0xD7,
+    0xC1, 0x25, 0x91, 0xAB, 0x89, 0xDE, 0x92, 0xA7, 0x76, 0x23, 0x2F, 0xEE, 0xEE, 0x3E, 0xF2, 0x38,
+    0xCF, 0xB5, 0xF7, 0x37, 0x97, 0x5F, 0x92, 0xFE, 0xE4, 0x5F, 0x73, 0xE7, 0xE4, 0x70, 0x6F, 0xDD,
+    0x0C, 0xD3, 0x5D, 0x38, 0xAD, 0xE4, 0x1F, 0x9F, 0xE7, 0x6C, 0x16, 0xE6, 0x0F, 0x77, 0x67, 0xB8,
+    0x03, 0x30, 0xFD, 0xF6, 0xEC, 0x82, 0xF9, 0x86, 0xD9, 0x3A, 0x53, 0xC5, 0x93, 0x9E, 0x67, 0xEE,
+    0x22, 0x96, 0x6E, 0x66, 0xDC, 0xBE, 0x71, 0x7B, 0x45, 0x7B, 0xAF, 0x6E, 0xF9, 0x2A, 0x5F, 0xED,
+    0x8B, 0x97, 0x42, 0xD4, 0xE2, 0xF2, 0x88, 0xE9, 0x50, 0xF5, 0xB4, 0x70, 0x83, 0x39, 0xD7, 0x57,
+    0x3A, 0x6C, 0xAB, 0xFA, 0x84, 0x3A, 0x17, 0xF6, 0xAB, 0xE2, 0x6A, 0x98, 0x6E, 0x9B, 0x6F, 0x76,
+    0x3D, 0xF0, 0xD9, 0x93, 0x17, 0x6D, 0x1E, 0xCA, 0xA7, 0x42, 0xE1, 0x06, 0xED, 0xCF, 0x12, 0xCE,
+    0xA4, 0xA5, 0x69, 0x1C, 0x96, 0xC7, 0x1F, 0xFF, 0x17, 0x3E, 0xBF, 0x7A, 0x7D, 0x51, 0x48, 0x77,
+    0xF2, 0xAF, 0xE1, 0xEB, 0x94, 0x72, 0x4E, 0xC4, 0xD4, 0x5B, 0x0F, 0xF2, 0x04, 0x2F, 0xE4, 0x6E,
+    0x3B, 0x0B, 0xC6, 0xCD, 0xF2, 0x50, 0xB5, 0x8F, 0x90, 0xF5, 0xC6, 0x4D, 0x74, 0x28, 0xDB, 0xA9,
+    0xEE, 0x2A, 0x76, 0xD8, 0x36, 0x57, 0x43, 0xB4, 0xC5, 0x8B, 0x61, 0xEF, 0xC4, 0x4D, 0xFB, 0x3E,
+    0xC7, 0x8C, 0xA8, 0xFA, 0x2C, 0x64, 0x1D, 0xCF, 0xEA, 0xA1, 0xF0, 0x65, 0xBB, 0x9D, 0x10, 0xCD,
+    0x3D, 0x2E, 0x34, 0xC3, 0xBC, 0x27, 0xA8, 0x40, 0x0D, 0xA6, 0x36, 0x94, 0x8B, 0x6A, 0x71, 0x1F,
+    0x5B, 0xDC, 0xC9, 0xE9, 0xDD, 0xAF, 0x88, 0xFC, 0xFE, 0x73, 0x9E, 0xB3, 0x68, 0xC7, 0x1E, 0x45,
+    0x4B, 0x8F, 0x81, 0x4B, 0x9C, 0xE6, 0x90, 0x85, 0x8A, 0xBA, 0xAF, 0xBA, 0x6D, 0xEE, 0x80, 0xEC,
+    0x9D, 0x3E, 0x7C, 0xE3, 0x8C, 0xF6, 0x9F, 0x61, 0x47, 0x05, 0xE5, 0xB3, 0xAE, 0x59, 0x36, 0x8B,
+    0xD3, 0x8F, 0xCC, 0x17, 0x97, 0xFF, 0xBA, 0xA8, 0x4D, 0x6D, 0x52, 0xD7, 0x82, 0x92, 0xCB, 0x7F,
+    0x6D, 0xE5, 0xC4, 0xBB, 0x6C, 0x71, 0x0A, 0x68, 0x64, 0xBE, 0xE4, 0x34, 0xDB, 0xEC, 0x33, 0x25,
+    0x12, 0xD5, 0xF0, 0x5F, 0x87, 0xC6, 0x37, 0xF5, 0x89, 0x7A, 0x5B, 0xF5, 0x85, 0xB3, 0x44, 0xED,
+    0xCD, 0xDF, 0x54, 0x7D, 0xE5, 0xB6, 0x16, 0x8B, 0x0B, 0xB7, 0xF1, 0x70, 0xB0, 0x56, 0xBF, 0xD3,
+    0xDD, 0x07, 0xC5, 0xB0, 0x7D, 0xF8, 0xA0, 0xB9, 0x60, 0xB6, 0xCA, 0x6A, 0x71, 0xD2, 0xE7, 0x7E,
+    0x6A, 0x1E, 0xF2, 0x7B, 0x8A, 0xAC, 0x33, 0x1C, 0x32, 0x61, 0xAA, 0xFF, 0x4A, 0x4A, 0xAF, 0x5F,
+    0x0C, 0x5B, 0x45, 0x7B, 0xA5, 0x88, 0xD6, 0x71, 0xE2, 0x61, 0xDF, 0xEF, 0x55, 0xE6, 0xEA, 0x8F,
+    0xFB, 0xBD, 0xD3, 0x9C, 0xD8, 0xDD, 0xDD, 0x11, 0x59, 0x96, 0x07, 0xCF, 0xFD, 0xC4, 0x73, 0xF6,
+    0x2C, 0xFA, 0xAA, 0x63, 0xEF, 0x4E, 0x14, 0xDF, 0xB8, 0x3D, 0x7B, 0xF9, 0xA1, 0xB0, 0x67, 0x45,
+    0xD4, 0xA2, 0x6A, 0x2F, 0xF1, 0xCF, 0x82, 0x79, 0xFA, 0xC7, 0x43, 0x2E, 0xAD, 0x19, 0x28, 0x5B,
+    0xF8, 0x7A, 0x9A, 0x75, 0xFA, 0x9D, 0xB0, 0xAD, 0xDF, 0xE9, 0x32, 0x77, 0x89, 0x3F, 0xA9, 0xCF,
+    0x1E, 0x5E, 0xBE, 0x2A, 0xE1, 0xE4, 0xEB, 0xF0, 0x75, 0x2A, 0x51, 0x22, 0xA6, 0xDE, 0x7A, 0x80,
+    0xE7, 0x55, 0x9D, 0xE9, 0x8D, 0x09, 0x79, 0x89, 0xCF, 0x1D, 0xFC, 0x2F, 0x22, 0x8D, 0x74, 0x4D,
+    0xEA, 0xA8, 0xE9, 0x8E, 0xF8, 0xD9, 0xF2, 0x9A, 0xAC, 0xF9, 0xDA, 0xEA, 0xE0, 0xE0, 0xE0, 0x5B,
+    0x22, 0x8B, 0xD3, 0xBB, 0xBB, 0x3B, 0xEC, 0xA8, 0x7A, 0xDE, 0x3D, 0x68, 0xE4, 0xED, 0x87, 0xBA,
+    0xB9, 0x7F, 0x30, 0x19, 0x39, 0x2D, 0xB2, 0x6C, 0x44, 0x7E, 0xB0, 0xBB, 0xFB, 0xC8, 0xE7, 0x0E,
+    0x0E, 0x0E, 0x0E, 0x9E, 0xB5, 0x22, 0x22, 0x31, 0xFD, 0x0E, 0xF0, 0x79, 0x4A, 0x5F, 0x0C, 0x45,
+    0xCC, 0x17, 0x4C, 0xC8, 0x8E, 0x4A, 0x0E, 0x18, 0x56, 0x75, 0x1E, 0xFA, 0x68, 0x95, 0xAF, 0x17,
+    0xDE, 0xFE, 0xAF, 0xE1, 0x88, 0xBD, 0x9F, 0x77, 0x44, 0x2A, 0x27, 0x29, 0xCE, 0x85, 0xFB, 0x8A,
+    0x2F, 0x7E, 0xFF, 0x95, 0xFA, 0x04, 0xEC, 0x04, 0xCE, 0x94, 0x64, 0x3F, 0xF1, 0x9C, 0xB5, 0x07,
+    0xCF, 0x5D, 0x15, 0x89, 0xA7, 0x77, 0x13, 0xDA, 0x2D, 0xB2, 0x34, 0x07, 0xCF, 0x75, 0x9E, 0xAD,
+    0x7B, 0xD0, 0x2F, 0x75, 0x5C, 0xB0, 0x22, 0x0F, 0x1D, 0x1C, 0x5C, 0xCA, 0xFB, 0xC3, 0xE2, 0xED,
+    0xF7, 0xFF, 0xEA, 0xC9, 0xB0, 0xED, 0x1E, 0xB8, 0xFD, 0x23, 0x1F, 0xA9, 0xB6, 0xCD, 0x50, 0x84,
+    0x32, 0xEC, 0xC7, 0x4F, 0x7F, 0x9A, 0xFF, 0x26, 0x8B, 0xB9, 0x2B, 0xDA, 0xDC, 0x69, 0x9F, 0x05,
+    0xED, 0x2B, 0xF7, 0xD9, 0x0F, 0x96, 0xEE, 0xF2, 0xF4, 0xEE, 0xEE, 0xCE, 0x67, 0x89, 0x6A, 0xC8,
+    0x82, 0xF6, 0xDA, 0x6D, 0x2E, 0x09, 0xB5, 0x93, 0x3D, 0x2C, 0x0F, 0xBD, 0x22, 0xCB, 0x10, 0x9A,
+    0xFE, 0x01, 0xF5, 0x0C, 0x87, 0xD6, 0x0F, 0xF7, 0x97, 0x27, 0xC1, 0x74, 0xAA, 0xF8, 0x71, 0xFE,
+    0xC3, 0x9F, 0xBD, 0xF3, 0xB7, 0x7D, 0xBC, 0xD0, 0x9F, 0xE5, 0x02, 0xDC, 0xA9, 0xFD, 0x7E, 0xD1,
+    0xCD, 0x5F, 0x1A, 0x4E, 0xEC, 0xEE, 0x3E, 0x52, 0x8A, 0xC4, 0xEA, 0xE0, 0x60, 0x7A, 0x16, 0xF6,
+    0xB6, 0xE0, 0xCA, 0x16, 0xF4, 0x77, 0x8C, 0x11, 0x52, 0x29, 0x12, 0x2B, 0x91, 0x35, 0x86, 0xFB,
+    0xB9, 0x83, 0x83, 0x4B, 0x8D, 0x48, 0x38, 0xBD, 0xBB, 0xBB, 0x73, 0x42, 0xED, 0x0C, 0xDB, 0xE5,
+    0xC3, 0x3F, 0x48, 0x7A, 0x22, 0x02, 0x36, 0xDA, 0xC8, 0x1E, 0x57, 0xE8, 0x09, 0xA8, 0x9A, 0x13,
+    0x5B, 0x77, 0xE6, 0xF2, 0x74, 0x2B, 0xCB, 0xFE, 0xBE, 0x6A, 0xA9, 0xBF, 0xF9, 0x3F, 0xD5, 0x7C,
+    0x61, 0xF4, 0xB3, 0x6A, 0x52, 0x6B, 0x44, 0xEE, 0xA4, 0xE8, 0x8B, 0x42, 0xFE, 0xF8, 0xEA, 0x5F,
+    0xC8, 0x2B, 0x5D, 0xD9, 0xF1, 0x99, 0x15, 0xEB, 0x4F, 0xB5, 0xB0, 0xA3, 0x1E, 0x92, 0xA7, 0x7E,
+    0xF0, 0xBE, 0x84, 0x50, 0x06, 0x40, 0x3D, 0xA3, 0x9F, 0x96, 0xBF, 0xF8, 0xC1, 0x1B, 0xE2, 0x9F,
+    0x3F, 0xD9, 0x01, 0x35, 0xCF, 0xDF, 0xA7, 0x44, 0x3A, 0x91, 0xC1, 0x3C, 0xD9, 0x73, 0xF1, 0xF1,
+    0x31, 0xC3, 0xCA, 0x61, 0xB1, 0xC8, 0xDD, 0xFD, 0xF4, 0xDA, 0xCD, 0x5D, 0x35, 0xE8, 0xA5, 0x74,
+    0xD5, 0x90, 0xB8, 0xCE, 0xC9, 0x67, 0xC5, 0x04, 0xFE, 0xF3, 0x3F, 0xC3, 0xEC, 0xF0, 0x7F, 0xFC,
+    0xF7, 0x9C, 0xE0, 0x76, 0x78, 0x1E, 0x3E, 0x0A, 0x8F, 0xC3, 0xA7, 0xE1, 0xA3, 0xEC, 0x3C, 0x01,
+    0xB7, 0x9F, 0x18, 0x8F, 0xBC, 0x08, 0xDA, 0x84, 0x0E, 0xF2, 0xF1, 0xB3, 0x97, 0x9E, 0x80, 0xDB,
+    0x4F, 0xF1, 0x04, 0x7C, 0x7C, 0xF5, 0xA9, 0xF4, 0x0D, 0xFC, 0xCB, 0xFF, 0x0C, 0x02, 0xFF, 0xE5,
+    0xBF, 0x39, 0x3A, 0x0B, 0x60, 0xC4, 0x55, 0x83, 0x96, 0x34, 0x06, 0x4C, 0x3D, 0xAF, 0x0F, 0x8B,
+    0xB7, 0x86, 0x1E, 0xD0, 0xAF, 0xFD, 0xA4, 0x7B, 0xFE, 0x3E, 0xDD, 0x3D, 0x0E, 0x9C, 0x0F, 0xA5,
+    0x5C, 0x7D, 0x63, 0x72, 0x85, 0x37, 0x8A, 0x13, 0xD9, 0x40, 0xD5, 0x2A, 0xCF, 0x47, 0x3E, 0xBD,
+    0x1D, 0x4D, 0x6F, 0x82, 0x1D, 0xEE, 0x79, 0x10, 0xD8, 0x99, 0x34, 0xDF, 0x76, 0xF3, 0xFA, 0x90,
+    0x4B, 0x9F, 0x66, 0x50, 0x4B, 0x66, 0x45, 0xBF, 0xD0, 0x35, 0x35, 0x6C, 0xD7, 0x56, 0x2F, 0x8C,
+    0x2B, 0xBF, 0x75, 0xA5, 0x7C, 0xED, 0xFB, 0xD5, 0x93, 0x3F, 0xF9, 0xBF, 0x79, 0xFE, 0xC1, 0xDB,
+    0xB4, 0xBB, 0x62, 0xF4, 0x4B, 0xAF, 0x85, 0x8B, 0x77, 0x1E, 0x2E, 0xF7, 0x50, 0x17, 0xF9, 0x46,
+    0xF6, 0xEF, 0xFC, 0x7C, 0xC8, 0x7B, 0xFD, 0x2A, 0xFF, 0xAC, 0x06, 0xF2, 0x61, 0xFE, 0xC5, 0xB7,
+    0x96, 0x7F, 0xEB, 0xAE, 0x98, 0x70, 0x8F, 0xFE, 0x7F, 0x8B, 0xF6, 0xBD, 0xB7, 0x97, 0x7D, 0xF3,
+    0xAD, 0x1E, 0x7C, 0x5E, 0x57, 0x51, 0x82, 0x6E, 0xEF, 0x81, 0xAF, 0x02, 0x7C, 0x36, 0x75, 0x98,
+    0xB5, 0x35, 0xE4, 0xC1, 0xF4, 0xD0, 0x38, 0x2D, 0xD7, 0xE7, 0x4B, 0x68, 0x44, 0x3C, 0xA8, 0xDF,
+    0x7F, 0x06, 0x9E, 0x01, 0xF8, 0xEC, 0x14, 0xC6, 0x46, 0x30, 0x79, 0x28, 0x5F, 0x87, 0xB9, 0xCB,
+    0xE5, 0xBA, 0x1C, 0x1D, 0x79, 0xF0, 0x0C, 0x7C, 0xEE, 0xE0, 0xE0, 0xE0, 0x9B, 0x22, 0x12, 0x1B,
+    0x11, 0x69, 0x7F, 0xFF, 0xE0, 0xE0, 0xE0, 0xBC, 0x88, 0xBC, 0x25, 0x22, 0x3D, 0xA7, 0x77, 0x40,
+    0xB5, 0x95, 0x5C, 0x83, 0x2D, 0x73, 0x5D, 0xE4, 0x4F, 0x2F, 0x3F, 0x14, 0xB8, 0x5B, 0xA4, 0xBB,
+    0x17, 0xD4, 0xC1, 0x45, 0xE0, 0xC4, 0x9F, 0x26, 0xCB, 0x78, 0x2D, 0x01, 0xDF, 0xAD, 0x5E, 0xD6,
+    0x94, 0xC1, 0x78, 0x50, 0x31, 0x2D, 0xF8, 0xAF, 0xAD, 0x39, 0xE3, 0x23, 0xAB, 0xE0, 0x9E, 0x5C,
+    0x44, 0xD2, 0x82, 0x1A, 0xBB, 0x4A, 0x8E, 0xCC, 0xF6, 0x4F, 0xAC, 0x32, 0x35, 0xEF, 0xE8, 0xA7,
+    0x5F, 0x6A, 0x7D, 0xF7, 0xC0, 0x17, 0x3E, 0xF5, 0x31, 0xA3, 0xFF, 0x5D, 0x7B, 0x27, 0xB9, 0x7F,
+    0xFE, 0x35, 0xFD, 0x07, 0xFD, 0xA5, 0xCC, 0xE9, 0x03, 0xB5, 0xA3, 0xE8, 0xF8, 0xC4, 0xC7, 0xB5,
+    0x72, 0xCF, 0x3F, 0xF8, 0x71, 0x45, 0xD6, 0xDF, 0xFE, 0xF1, 0x07, 0x4F, 0x3D, 0x70, 0xEA, 0x0B,
+    0x1F, 0x7F, 0xE0, 0x53, 0xF7, 0xBF, 0xA0, 0xEA, 0x8F, 0xE9, 0x5C, 0xBD, 0xE4, 0x2E, 0xF9, 0x07,
+    0x1E, 0xF8, 0xD4, 0xC7, 0x8C, 0xFE, 0xDF, 0xDB, 0x3B, 0xC9, 0xFA, 0x6F, 0xE8, 0xF6, 0x63, 0x3C,
+    0xA1, 0x9C, 0x7E, 0x53, 0xED, 0xA0, 0x5A, 0x2E, 0xF1, 0x40, 0xF1, 0x3F, 0x7F, 0xDC, 0xDC, 0xAE,
+    0x9F, 0xE6, 0x07, 0xEE, 0x89, 0x27, 0xB6, 0xCC, 0xBF, 0x62, 0x87, 0x9C, 0x82, 0xDB, 0xF9, 0xF8,
+    0xB4, 0xFC, 0x4F, 0x3F, 0x75, 0xEA, 0xDE, 0x8F, 0x3F, 0xF0, 0xB1, 0x2F, 0x7C, 0xEA, 0x89, 0xCF,
+    0x73, 0xC7, 0x47, 0x86, 0xFD, 0x33, 0xB7, 0xFF, 0xDE, 0xE7, 0x6F, 0xCF, 0x1F, 0xF8, 0xD4, 0xA9,
+    0x2F, 0x7C, 0xFE, 0xE3, 0x4F, 0x3C, 0xF8, 0xB1, 0x4B, 0x0F, 0x7C, 0xAA, 0xBE, 0xE3, 0xB6, 0x8F,
+    0x5E, 0x39, 0x4B, 0x97, 0x73, 0x2F, 0x9D, 0xE6, 0x36, 0xA0, 0x6B, 0x5E, 0x74, 0xF7, 0xEA, 0xFA,
+    0x0B, 0x39, 0xFF, 0xB1, 0xDA, 0x79, 0xFC, 0x63, 0x4F, 0xDC, 0xFB, 0x85, 0x27, 0xBE, 0xD0, 0xFD,
+    0x87, 0xEE, 0x3F, 0xAA, 0xEF, 0xE7, 0x36, 0x3E, 0x7A, 0x32, 0x7B, 0x99, 0xFF, 0x84, 0x82, 0xBC,
+    0xD3, 0xFF, 0x85, 0x7E, 0xF8, 0x5C, 0x3D, 0xD2, 0x15, 0x53, 0x6F, 0xAD, 0x76, 0x55, 0xBE, 0xD6,
+    0xC1, 0x66, 0x14, 0x49, 0xB5, 0xAA, 0x4C, 0x6F, 0x44, 0xDA, 0x9F, 0x57, 0x99, 0x9E, 0x8A, 0x90,
+    0x9F, 0xC1, 0x26, 0x0F, 0x3C, 0x7C, 0x50, 0x65, 0xFA, 0xB1, 0x46, 0x87, 0xD7, 0x0F, 0x9E, 0x61,
+    0x2E, 0xD2, 0x9A, 0xB1, 0xA6, 0x7D, 0x99, 0x8B, 0x88, 0x9F, 0x8B, 0x2C, 0x7E, 0x6E, 0xB0, 0xF4,
+    0x67, 0x8F, 0xA4, 0xAC, 0x75, 0x29, 0xE2, 0xD5, 0x42, 0xCD, 0xEB, 0xAA, 0xCE, 0xD6, 0x6D, 0x11,
+    0x17, 0xB9, 0xC7, 0x74, 0xB3, 0xD4, 0x6B, 0xC9, 0xB8, 0x48, 0x36, 0x18, 0x47, 0x73, 0x6E, 0x38,
+    0x7D, 0xDE, 0x57, 0xE7, 0x24, 0xEA, 0x50, 0x2E, 0xD6, 0x78, 0xDD, 0x3A, 0x3B, 0x3C, 0x1B, 0xD9,
+    0x7F, 0xFA, 0xC6, 0xEC, 0x70, 0x25, 0xD2, 0x8E, 0xD4, 0x00, 0xA9, 0x7F, 0x91, 0x00, 0x6E, 0x1D,
+    0xD7, 0x7D, 0x40, 0x69, 0xFE, 0xAD, 0xE2, 0xBF, 0x94, 0xB8, 0xEC, 0x51, 0x22, 0x4B, 0x8A, 0xE5,
+    0x1F, 0x45, 0x2A, 0xCF, 0x6D, 0xA9, 0x5B, 0xD3, 0xE2, 0x58, 0x2F, 0x95, 0x23, 0x32, 0x9B, 0x79,
+    0xF3, 0xE0, 0x59, 0x4A, 0x91, 0x48, 0x25, 0x12, 0x47, 0x1F, 0xF4, 0x28, 0x54, 0xA9, 0x57, 0xA1,
+    0x53, 0xF2, 0xDB, 0x3D, 0x63, 0x82, 0x2A, 0x93, 0xEF, 0xFC, 0x73, 0x98, 0xCB, 0x62, 0xC4, 0xE3,
+    0x8F, 0x4A, 0x2D, 0x4B, 0xF1, 0x29, 0x73, 0xBA, 0xFC, 0x27, 0x03, 0x82, 0x62, 0x9D, 0x39, 0xAD,
+    0xDA, 0x8D, 0x54, 0xE1, 0x07, 0x67, 0x4E, 0xD9, 0xC8, 0x9C, 0x72, 0x73, 0xE6, 0xD4, 0x1F, 0x65,
+    0x4E, 0x4F, 0xEC, 0x00, 0x15, 0xC6, 0xE5, 0x3E, 0xEB, 0xC7, 0x4A, 0x92, 0xDC, 0x67, 0x3D, 0xF1,
+    0xF8, 0xAF, 0x65, 0x5B, 0x74, 0x1B, 0xBF, 0x8E, 0x74, 0xDB, 0xBD, 0x3D, 0x62, 0x24, 0x46, 0xBE,
+    0xFA, 0xD5, 0x23, 0x62, 0xFC, 0x9A, 0x54, 0x3C, 0xBB, 0x05, 0x77, 0xFB, 0xE6, 0xEC, 0x5B, 0x75,
+    0x13, 0xE7, 0x3B, 0xAE, 0x99, 0x98, 0x63, 0xD0, 0xA1, 0x86, 0x74, 0xEF, 0x6E, 0xAC, 0xDC, 0x2A,
+    0xBA, 0x23, 0x0E, 0xCA, 0xAD, 0x2A, 0xB7, 0xB6, 0x6F, 0xAE, 0xDC, 0x52, 0xC3, 0xF8, 0x35, 0xE3,
+    0x57, 0x19, 0xCF, 0xEF, 0xCE, 0x1D, 0x56, 0x6A, 0xEC, 0xB0, 0x4A, 0xCC, 0x64, 0x23, 0x99, 0x5D,
+    0xCB, 0xDA, 0xEB, 0x5F, 0x8C, 0x60, 0x44, 0x1C, 0x91, 0xEE, 0xF4, 0x7F, 0x9B, 0x72, 0xA9, 0x55,
+    0xBD, 0x6A, 0x08, 0xB7, 0xAA, 0xEC, 0x49, 0xF2, 0x99, 0xA0, 0xAF, 0xEF, 0x00, 0x53, 0x72, 0x91,
+    0x1A, 0x22, 0x85, 0x88, 0x87, 0x81, 0xA2, 0xBB, 0xBB, 0x47, 0xF5, 0x18, 0x97, 0xC5, 0xD1, 0x65,
+    0x8F, 0xE8, 0x40, 0xD9, 0xAE, 0x2B, 0xAA, 0xE2, 0xBA, 0xC2, 0xCA, 0xB8, 0xD4, 0xB3, 0xBC, 0x6C,
+    0xB1, 0xE8, 0x3E, 0x09, 0xAA, 0x0C, 0x9F, 0x5B, 0xC2, 0xE1, 0x81, 0x38, 0x1B, 0x41, 0x64, 0x89,
+    0xF5, 0x90, 0x82, 0xCD, 0xA3, 0x7B, 0x51, 0xA6, 0x84, 0x62, 0xD1, 0xA5, 0xC6, 0xCE, 0x21, 0x5D,
+    0x7C, 0x4C, 0x8B, 0x68, 0xEC, 0x2A, 0xF0, 0xC1, 0xC7, 0x2C, 0xC6, 0x63, 0x44, 0x44, 0x52, 0x2B,
+    0x57, 0x11, 0x97, 0xBF, 0xB1, 0xFB, 0x95, 0x77, 0xCF, 0xC7, 0x74, 0x4C, 0xD3, 0x46, 0x98, 0xA4,
+    0x36, 0x92, 0x55, 0x4D, 0x4C, 0xD8, 0x92, 0xCD, 0x3B, 0x74, 0xA0, 0x7C, 0xAA, 0x4F, 0x85, 0x50,
+    0x9B, 0xC7, 0xE4, 0x43, 0xD9, 0x62, 0xDE, 0xBC, 0x3C, 0x14, 0x1D, 0x5A, 0x64, 0xD0, 0x01, 0x25,
+    0x72, 0xF1, 0xEF, 0xA0, 0x7C, 0x5E, 0x7C, 0x24, 0xE5, 0xD0, 0x4B, 0x91, 0xA0, 0x16, 0x75, 0xB3,
+    0xEE, 0xC9, 0xDA, 0xAD, 0xDB, 0x91, 0xAD, 0x94, 0x4F, 0x1B, 0x53, 0x37, 0xB4, 0xEA, 0xDC, 0x80,
+    0x0E, 0xD5, 0xAA, 0x6D, 0xD9, 0x1A, 0xE7, 0x39, 0x82, 0x1B, 0xA6, 0x6B, 0xB7, 0xF3, 0x78, 0x01,
+    0xD3, 0x51, 0x59, 0x4E, 0xEE, 0xB1, 0x75, 0xD6, 0x63, 0x5B, 0xA6, 0x54, 0x2D, 0x96, 0xCA, 0xAD,
+    0x4A, 0x6C, 0x4A, 0x97, 0x48, 0xC6, 0x44, 0xD3, 0x91, 0x8A, 0x3E, 0x8D, 0x78, 0xC8, 0x25, 0x42,
+    0xD6, 0xDB, 0x7A, 0xCC, 0x7F, 0xD8, 0x75, 0xE7, 0xE9, 0xA2, 0xD3, 0x81, 0x2C, 0xA4, 0xE9, 0x5E,
+    0xBA, 0x34, 0x65, 0xCA, 0x36, 0x11, 0xDE, 0x53, 0x13, 0xEB, 0x7E, 0xD5, 0x25, 0x77, 0x0C, 0xDD,
+    0xC7, 0xD6, 0xCD, 0x35, 0x23, 0xD7, 0x08, 0x3E, 0xCF, 0x8D, 0x63, 0x2D, 0x02, 0x11, 0x1A, 0x97,
+    0x7B, 0xF4, 0x92, 0xAA, 0xC6, 0xF6, 0xCC, 0xC8, 0xC4, 0xE9, 0x40, 0x39, 0xC7, 0x38, 0xE2, 0xC0,
+    0x04, 0xF3, 0xB2, 0xCF, 0x7A, 0x66, 0x55, 0x6D, 0x5C, 0xEE, 0x23, 0x96, 0x6D, 0x1D, 0x88, 0x3A,
+    0x94, 0x6D, 0xEE, 0x2B, 0x66, 0x54, 0xE7, 0xFA, 0x2C, 0x10, 0x4D, 0x6B, 0x9C, 0x0E, 0x11, 0x4B,
+    0xF9, 0x2D, 0xA7, 0x06, 0x66, 0xFB, 0x14, 0x5D, 0xF6, 0x9E, 0xC7, 0x62, 0x04, 0x22, 0x36, 0x90,
+    0x7B, 0x25, 0x35, 0x65, 0x5B, 0x0C, 0x30, 0xC3, 0xA6, 0x9C, 0x2C, 0xCF, 0xF0, 0x0C, 0x18, 0x57,
+    0x01, 0x87, 0x8F, 0x7A, 0xD0, 0x32, 0x00, 0x27, 0xAF, 0xDD, 0x44, 0xF6, 0x8E, 0x6A, 0x80, 0x2A,
+    0x75, 0x18, 0x4A, 0xD0, 0x7C, 0xD1, 0x51, 0xBA, 0x54, 0x4A, 0xA7, 0x03, 0x87, 0x49, 0x3B, 0xA1,
+    0xFA, 0xAC, 0x1F, 0x73, 0x03, 0x49, 0xC8, 0xC5, 0x8B, 0x03, 0x09, 0xF0, 0x43, 0xFF, 0x55, 0xB7,
+    0xE2, 0x62, 0x67, 0x52, 0xAF, 0xBA, 0x54, 0x25, 0x4C, 0xC5, 0xB6, 0x2B, 0xF0, 0x25, 0x8B, 0xC0,
+    0x97, 0xA5, 0x06, 0x23, 0x1D, 0x20, 0xFE, 0x28, 0xF9, 0x51, 0x31, 0xF6, 0x87, 0x4C, 0x09, 0x93,
+    0x36, 0x55, 0x78, 0xCF, 0xA0, 0xAA, 0x53, 0x96, 0x39, 0x8E, 0x05, 0xDB, 0xB9, 0x4F, 0x7D, 0xCE,
+    0xED, 0xD1, 0x07, 0x2C, 0x18, 0x97, 0x7C, 0xE7, 0x5B, 0x7C, 0x40, 0x07, 0xD5, 0xC3, 0x84, 0xAA,
+    0x4E, 0xB7, 0x7C, 0xFD, 0x81, 0xEB, 0x07, 0x07, 0x03, 0x73, 0x11, 0xA9, 0x53, 0x31, 0x74, 0xA2,
+    0x45, 0xA5, 0xD8, 0xA8, 0x38, 0x22, 0x94, 0xA7, 0x26, 0x31, 0x3B, 0x2B, 0x3A, 0x91, 0x71, 0x69,
+    0x53, 0x39, 0x36, 0x5E, 0xF9, 0xFC, 0x46, 0x97, 0x80, 0x5A, 0x89, 0xB4, 0xE5, 0xBB, 0xF3, 0x7A,
+    0xC1, 0xAC, 0xF0, 0xAA, 0xB7, 0x14, 0xAF, 0xF4, 0xCC, 0x8D, 0x3B, 0x1F, 0xAC, 0x88, 0x12, 0x69,
+    0x8B, 0xD7, 0x93, 0x7E, 0xDC, 0x3F, 0xEA, 0xB3, 0x52, 0xF4, 0x27, 0x3B, 0x23, 0x52, 0x17, 0xF2,
+    0x7A, 0x3A, 0xCD, 0x2F, 0x2A, 0xA4, 0x0E, 0xC0, 0x44, 0xFD, 0x21, 0xC5, 0x2B, 0x12, 0x88, 0x22,
+    0xAD, 0x91, 0x87, 0x22, 0xD2, 0x1A, 0x57, 0x7A, 0xE2, 0x2F, 0x2E, 0xA4, 0xCE, 0x7D, 0xD9, 0x32,
+    0xB9, 0xA1, 0x90, 0xFA, 0x16, 0x20, 0x77, 0xE1, 0xE1, 0xB9, 0x38, 0xD2, 0xD5, 0x9B, 0x6E, 0x6C,
+    0xBC, 0xB7, 0x86, 0xEA, 0xEA, 0xB4, 0x5A, 0x37, 0x70, 0xC8, 0xF3, 0xCB, 0x3A, 0x13, 0xE9, 0xB8,
+    0xF6, 0xE8, 0x08, 0x5F, 0xAD, 0xAC, 0x45, 0xE9, 0x51, 0xD2, 0x52, 0x2D, 0xC8, 0xE4, 0x22, 0x66,
+    0x38, 0xDE, 0x74, 0xCC, 0x02, 0xB6, 0x2B, 0x29, 0x45, 0xD0, 0x72, 0xED, 0xC8, 0x0A, 0x57, 0xD2,
+    0xE6, 0x22, 0x34, 0x3F, 0xBA, 0xA2, 0x7B, 0xB0, 0x35, 0x2A, 0x8E, 0x65, 0x3A, 0xBB, 0x8F, 0x20,
+    0xD2, 0xE7, 0x22, 0xAE, 0x4A, 0x5D, 0x5D, 0xB2, 0xD4, 0xBD, 0x37, 0x35, 0x34, 0xEB, 0xEE, 0xC2,
+    0xCA, 0x40, 0x35, 0x76, 0x5C, 0x02, 0x32, 0x79, 0xFD, 0x88, 0x75, 0x54, 0xDF, 0x9A, 0x75, 0x64,
+    0x3F, 0x98, 0x75, 0x74, 0xA2, 0x86, 0x93, 0xA3, 0x9A, 0xE8, 0x37, 0xCA, 0xBB, 0x67, 0xC9, 0x6A,
+    0x98, 0x56, 0x0D, 0x54, 0xB5, 0x0E, 0x58, 0xF2, 0xCD, 0xC7, 0xF9, 0xAC, 0xEB, 0x68, 0xE0, 0xF1,
+    0xC7, 0xF5, 0x6B, 0xBE, 0xFC, 0x93, 0x7A, 0x6B, 0xEF, 0x58, 0xDE, 0x78, 0x5D, 0xCE, 0xBB, 0x4E,
+    0x05, 0x0C, 0x6B, 0xE3, 0x93, 0xD4, 0xD1, 0xFE, 0x1A, 0x4F, 0x1A, 0x5B, 0x65, 0x34, 0x69, 0x35,
+    0x1D, 0x6B, 0xA2, 0xA4, 0xFE, 0xAE, 0x25, 0x69, 0x3F, 0xA7, 0x84, 0xB9, 0xF0, 0xFC, 0x7E, 0x24,
+    0x97, 0x7A, 0x6C, 0x30, 0xDD, 0x24, 0x0B, 0x3C, 0x4F, 0x06, 0x78, 0x79, 0xB0, 0x48, 0xC8, 0x40,
+    0x4C, 0xA7, 0x4D, 0xFD, 0x62, 0x53, 0x95, 0x41, 0xC8, 0xFA, 0x3B, 0x20, 0xF7, 0x99, 0x48, 0x4B,
+    0xD1, 0x69, 0x91, 0x1E, 0xE3, 0x74, 0x9F, 0x47, 0x4C, 0x9B, 0x7B, 0x16, 0x94, 0x75, 0xDE, 0x31,
+    0xA3, 0x4A, 0x1D, 0xB6, 0x6D, 0x12, 0xD4, 0x8C, 0x3C, 0xA8, 0xF8, 0x3B, 0x11, 0x3D, 0xE4, 0x7D,
+    0x13, 0x50, 0x22, 0xBE, 0x71, 0xD0, 0xA4, 0x48, 0x5F, 0xED, 0xC0, 0xFE, 0x8A, 0xF0, 0x9A, 0xFC,
+    0x88, 0xD1, 0xDB, 0x48, 0xCE, 0x44, 0x72, 0x39, 0x54, 0x9A, 0x6A, 0xD5, 0x68, 0x2C, 0xAF, 0xA3,
+    0x25, 0x3D, 0x65, 0xE8, 0xE0, 0xB9, 0xEB, 0x97, 0xFB, 0xA2, 0x63, 0x46, 0xE5, 0x22, 0x45, 0x47,
+    0x34, 0x8E, 0x29, 0xE6, 0xC5, 0x81, 0xA2, 0x23, 0x96, 0x35, 0x87, 0x54, 0x4F, 0xF5, 0xE8, 0xA1,
+    0x08, 0x16, 0x2A, 0x59, 0xE8, 0x30, 0x32, 0x11, 0xD2, 0x4C, 0xFC, 0x55, 0xFA, 0x1A, 0x44, 0x84,
+    0xBF, 0x57, 0x5F, 0x83, 0xB1, 0x20, 0x69, 0x55, 0xB4, 0x5A, 0xAE, 0x52, 0x93, 0xDF, 0x38, 0x96,
+    0x53, 0x2C, 0x7C, 0xE1, 0xB2, 0x81, 0x48, 0x83, 0x71, 0xA5, 0x53, 0x83, 0x0E, 0x54, 0x75, 0x1C,
+    0xFB, 0x83, 0x3E, 0xD6, 0x25, 0xA5, 0xDF, 0x48, 0x9B, 0x3C, 0x80, 0x58, 0x74, 0x63, 0xAE, 0x34,
+    0xEB, 0x29, 0xEB, 0x9B, 0xCA, 0x2D, 0xD5, 0x33, 0x6C, 0x3C, 0xEE, 0x48, 0x85, 0x55, 0xAF, 0xD0,
+    0x0D, 0x7B, 0x9C, 0x85, 0x8D, 0xB4, 0xEB, 0x9A, 0xE7, 0x70, 0x93, 0x76, 0xD9, 0xCF, 0x36, 0xD2,
+    0xB3, 0xA5, 0xDB, 0xDE, 0xE8, 0xE5, 0x1D, 0xF4, 0x50, 0x5E, 0xA6, 0x92, 0xD7, 0xFC, 0x66, 0xC6,
+    0x7E, 0x8F, 0x2B, 0x50, 0xD6, 0xDB, 0xA0, 0x43, 0x03, 0xCC, 0xE5, 0x66, 0x63, 0x15, 0xD7, 0x6D,
+    0xE5, 0x0A, 0x97, 0x1C, 0xBD, 0xB2, 0x65, 0x3F, 0xF9, 0xB0, 0x85, 0x1F, 0x7B, 0x85, 0xC4, 0x35,
+    0x37, 0xA6, 0x70, 0xB3, 0x55, 0xFA, 0x7F, 0xBF, 0xAA, 0xA1, 0xFC, 0x52, 0x0B, 0xFA, 0x2F, 0x1D,
+    0xF0, 0x9E, 0x07, 0x6C, 0x00, 0x8A, 0x75, 0xE2, 0x23, 0xA1, 0xDF, 0x76, 0x5D, 0x28, 0x52, 0xAE,
+    0x70, 0xFE, 0x53, 0xF3, 0x8E, 0xD4, 0xDC, 0x9B, 0x79, 0xFB, 0x1B, 0x94, 0xC1, 0x13, 0xB7, 0xCC,
+    0x2D, 0x3E, 0xBB, 0xF6, 0x10, 0xF5, 0x6B, 0xC9, 0x23, 0x99, 0x34, 0x60, 0x6B, 0x8A, 0xBF, 0x48,
+    0x9E, 0x62, 0x3C, 0x4C, 0x07, 0x7C, 0xCF, 0xA3, 0x03, 0x59, 0x9F, 0xFE, 0xB4, 0x85, 0x27, 0x0F,
+    0xE4, 0xE1, 0x10, 0x24, 0x15, 0xDA, 0x56, 0x01, 0xE3, 0x0E, 0xD1, 0x82, 0x1A, 0x0A, 0xCF, 0x3C,
+    0x60, 0x99, 0x50, 0x36, 0x75, 0x1E, 0xF2, 0xA0, 0x7F, 0x96, 0x42, 0x8F, 0xFD, 0x54, 0xB3, 0x6E,
+    0x9E, 0x1C, 0xB2, 0x1E, 0x9B, 0x85, 0xD2, 0x4D, 0xD0, 0xFD, 0x36, 0xD1, 0x38, 0xAA, 0x6F, 0x39,
+    0xF3, 0xE2, 0x80, 0x1A, 0x7A, 0x66, 0x16, 0xCC, 0xDB, 0xE4, 0x6F, 0x3B, 0x90, 0x0E, 0x3B, 0x40,
+    0x11, 0xD1, 0x32, 0x0E, 0x76, 0x23, 0x92, 0x9B, 0xA0, 0x03, 0xE6, 0xE5, 0x0E, 0x0B, 0xC3, 0x8C,
+    0xDC, 0x53, 0xFD, 0x5E, 0xC7, 0x04, 0x1D, 0x66, 0xE4, 0x1D, 0xDB, 0x85, 0x63, 0x9F, 0xA2, 0x9B,
+    0x52, 0x74, 0xC4, 0xA2, 0x63, 0x41, 0x59, 0xCF, 0xA8, 0xBC, 0x0E, 0x45, 0x97, 0x2F, 0xD9, 0x67,
+    0xC2, 0xFB, 0xDE, 0x38, 0xED, 0xAD, 0x55, 0x3D, 0x36, 0x7F, 0x29, 0x6C, 0xA3, 0x43, 0x5F, 0x19,
+    0x47, 0x35, 0x51, 0x7F, 0xDB, 0xA3, 0xC4, 0x99, 0x25, 0x98, 0x9E, 0xB9, 0x83, 0xC3, 0x14, 0x19,
+    0x96, 0x47, 0x21, 0xC8, 0xE9, 0xF9, 0xEE, 0x4E, 0x23, 0x12, 0xE6, 0x22, 0x9E, 0xC5, 0x51, 0xF3,
+    0x08, 0x35, 0x40, 0xB6, 0xFC, 0x2E, 0x5A, 0xC4, 0x6B, 0x91, 0x21, 0xF7, 0x59, 0x2C, 0x3A, 0x96,
+    0x85, 0x63, 0x62, 0xC6, 0x9F, 0xB2, 0x65, 0x51, 0xD5, 0x2A, 0x5A, 0x8A, 0xDE, 0x1E, 0x88, 0xB7,
+    0x22, 0x75, 0xEA, 0xB7, 0xC9, 0x0E, 0xA4, 0x22, 0x38, 0x98, 0x36, 0xD2, 0x82, 0x79, 0xF5, 0xCF,
+    0x23, 0x20, 0x9D, 0xE9, 0xA0, 0x0C, 0xCC, 0x20, 0x5B, 0x24, 0x6B, 0xE5, 0xC6, 0x14, 0x97, 0xF9,
+    0xB3, 0x1D, 0x2C, 0x4A, 0x24, 0xE4, 0x81, 0x4A, 0xC4, 0x1D, 0x92, 0xF5, 0x2C, 0x4D, 0x87, 0x25,
+    0xF7, 0x11, 0x1D, 0xD8, 0x36, 0x0E, 0x4B, 0xFE, 0xE3, 0xD4, 0x47, 0xB1, 0xAA, 0xA9, 0xBA, 0xE6,
+    0x6A, 0x0F, 0x22, 0xC1, 0x42, 0x36, 0x82, 0x8E, 0x3B, 0x9B, 0xEB, 0x91, 0x52, 0x7C, 0x6A, 0xA9,
+    0x20, 0x4E, 0x07, 0xCC, 0xF2, 0x60, 0x60, 0x82, 0x5E, 0xA0, 0x28, 0xBA, 0xD4, 0x56, 0x6C, 0x9A,
+    0xB2, 0x56, 0xAB, 0xA7, 0x89, 0xC4, 0x31, 0x19, 0xDC, 0x1A, 0x07, 0x64, 0x7D, 0x6A, 0xD6, 0x6F,
+    0xDF, 0x9C, 0xBF, 0x79, 0xF0, 0x4C, 0xD2, 0x9B, 0x32, 0x86, 0x1C, 0x81, 0xDC, 0x27, 0x82, 0xFF,
+    0x2C, 0x25, 0xC3, 0x4C, 0x6A, 0xDB, 0x46, 0x4C, 0x7F, 0x96, 0xED, 0xAA, 0x1B, 0xD1, 0x18, 0x68,
+    0x67, 0x63, 0xFF, 0x70, 0x33, 0x3A, 0x11, 0xF3, 0x37, 0x1E, 0x75, 0xB9, 0x4F, 0x94, 0xAA, 0x19,
+    0x9C, 0x5C, 0xA1, 0xB7, 0x8F, 0x6C, 0x68, 0xB1, 0x4C, 0x06, 0x66, 0x18, 0x89, 0x44, 0x9A, 0x1F,
+    0x7D, 0x8D, 0xC8, 0x12, 0x18, 0xB2, 0x81, 0xB1, 0xA7, 0x59, 0xD6, 0x17, 0x1E, 0xF4, 0xB5, 0xC7,
+    0xDE, 0xD8, 0x4D, 0xC3, 0xAB, 0x73, 0x11, 0x11, 0xF2, 0xAE, 0x6C, 0xA1, 0x70, 0x65, 0x3B, 0x72,
+    0xB9, 0x52, 0x30, 0x40, 0xD9, 0x26, 0x07, 0xA5, 0x18, 0x4E, 0xBA, 0x8A, 0x4C, 0xC4, 0xD9, 0x95,
+    0x35, 0x49, 0x1D, 0xA7, 0xCC, 0xDA, 0x25, 0xCD, 0x23, 0xA4, 0x79, 0xAB, 0xDE, 0xEF, 0x80, 0x38,
+    0xAC, 0x5A, 0x12, 0x4D, 0x8C, 0x1B, 0xB3, 0xF7, 0x65, 0x3B, 0x05, 0x73, 0x7D, 0x5E, 0xA7, 0xD8,
+    0x51, 0x8B, 0x0C, 0xE8, 0x7E, 0x6A, 0x51, 0x83, 0x35, 0x8E, 0x68, 0x9E, 0x0A, 0x1C, 0xE6, 0xDD,
+    0x3E, 0x36, 0x0B, 0x65, 0x5B, 0xD5, 0x53, 0xED, 0x4B, 0x67, 0x89, 0xC6, 0x99, 0xD6, 0xE6, 0x3E,
+    0xEF, 0x8A, 0xAB, 0x21, 0x0B, 0xD9, 0xDF, 0xF6, 0xC9, 0xB7, 0xCD, 0x87, 0xB1, 0xA7, 0x79, 0x19,
+    0x41, 0xFF, 0x95, 0x83, 0xE9, 0x3E, 0x98, 0xA7, 0x3D, 0x3A, 0x6C, 0xC3, 0xE4, 0x2B, 0x01, 0x23,
+    0x42, 0x26, 0x12, 0xB0, 0x55, 0x59, 0x17, 0x57, 0x7F, 0x3A, 0xA8, 0x61, 0xDB, 0xB4, 0x36, 0xEF,
+    0x62, 0xDE, 0x4D, 0x8D, 0x8B, 0x85, 0x9B, 0x56, 0xF5, 0x90, 0xFF, 0x30, 0x98, 0x76, 0x32, 0x76,
+    0x03, 0xD2, 0x01, 0xE6, 0x69, 0xF5, 0x05, 0x72, 0x8F, 0x16, 0x98, 0xC1, 0x61, 0x4F, 0xE1, 0x30,
+    0xDF, 0x6F, 0x89, 0x64, 0x7D, 0x6A, 0x3B, 0x60, 0x9C, 0x1A, 0x30, 0x6E, 0x4A, 0x55, 0xAB, 0xA1,
+    0x70, 0x7A, 0x79, 0x30, 0x7F, 0x73, 0x91, 0xEE, 0xB7, 0x1F, 0xAD, 0xE6, 0x84, 0xEA, 0xF7, 0xAE,
+    0x86, 0xA2, 0xCB, 0x7D, 0xB4, 0x44, 0xA2, 0x79, 0x2A, 0x18, 0x57, 0x3E, 0xD9, 0x97, 0xE7, 0x06,
+    0x1D, 0x4A, 0x35, 0x94, 0xF5, 0x2C, 0x0B, 0xE6, 0xA9, 0xBE, 0x74, 0x96, 0x68, 0x75, 0xD0, 0xDE,
+    0x5C, 0x0D, 0x13, 0xF6, 0x99, 0x4E, 0x8C, 0x2B, 0x5C, 0xF1, 0x97, 0xAF, 0x0C, 0x44, 0x26, 0xEC,
+    0x93, 0x45, 0xB2, 0x9E, 0xB2, 0xC7, 0x38, 0xC4, 0x63, 0xC9, 0x5F, 0x6D, 0x19, 0xB0, 0x15, 0xB9,
+    0xCF, 0xC2, 0x94, 0xAA, 0x36, 0x4F, 0xF6, 0x2C, 0x77, 0x17, 0x8F, 0x76, 0x5A, 0x24, 0x65, 0x34,
+    0x45, 0xD8, 0xCF, 0xFA, 0x21, 0x66, 0xC1, 0xBC, 0xFC, 0x4A, 0x30, 0x2E, 0x96, 0x45, 0x67, 0x73,
+    0x3F, 0x2D, 0xCF, 0x0D, 0x56, 0x87, 0xED, 0xE2, 0x95, 0xDE, 0xB4, 0xB1, 0x32, 0x6E, 0x5F, 0x87,
+    0x38, 0xCB, 0x82, 0x71, 0x28, 0x11, 0x91, 0x96, 0x4A, 0x44, 0x06, 0xB2, 0xF4, 0x20, 0x1E, 0xE3,
+    0x30, 0x1E, 0x66, 0x64, 0xC9, 0xD1, 0x4E, 0xEC, 0xDE, 0xAA, 0x65, 0xEC, 0x54, 0x46, 0xF1, 0x4A,
+    0x9A, 0xF7, 0x0D, 0xC0, 0xEF, 0xC8, 0xEB, 0x09, 0xDA, 0x0F, 0x90, 0x2F, 0x97, 0xF3, 0x16, 0x16,
+    0xC6, 0x45, 0xB0, 0x75, 0x2C, 0x3A, 0xF2, 0x50, 0xB6, 0x13, 0x58, 0x64, 0x7D, 0xEE, 0x29, 0x9D,
+    0x65, 0x42, 0xD6, 0xEB, 0xA0, 0x53, 0x99, 0x92, 0xA5, 0xE8, 0x72, 0xAF, 0x03, 0x91, 0x59, 0xA2,
+    0x46, 0x38, 0x1D, 0x74, 0x18, 0x23, 0x0D, 0x11, 0x71, 0x88, 0x48, 0xA4, 0x78, 0xF3, 0x60, 0x5E,
+    0xB3, 0x8D, 0xE9, 0x50, 0x7D, 0x2A, 0x57, 0x8F, 0xC0, 0x59, 0x0B, 0xE4, 0xA9, 0x74, 0x4A, 0x3A,
+    0xF4, 0x72, 0x39, 0x87, 0x43, 0xF3, 0xE2, 0x40, 0xD9, 0x0E, 0xC6, 0xE9, 0x60, 0xEA, 0xC8, 0x44,
+    0x85, 0xC2, 0x19, 0x57, 0x31, 0x53, 0x83, 0x0E, 0x79, 0x67, 0xD9, 0x66, 0x52, 0xF8, 0xBC, 0xD3,
+    0x9E, 0x0A, 0x2B, 0x22, 0x81, 0x88, 0x88, 0x88, 0xD3, 0x21, 0xAD, 0x8F, 0xB2, 0x35, 0x8E, 0x22,
+    0x30, 0xA3, 0x6C, 0x69, 0xD2, 0xE3, 0x26, 0xF3, 0xD1, 0xDF, 0x6C, 0xC0, 0x26, 0x56, 0x8C, 0x1A,
+    0x12, 0x48, 0x5C, 0x74, 0x64, 0xEF, 0x05, 0xB0, 0x6F, 0x1E, 0x5C, 0x4E, 0x35, 0x31, 0xEB, 0x16,
+    0x51, 0xF3, 0xB7, 0x53, 0x5D, 0xE7, 0xCC, 0x78, 0x66, 0x4C, 0x74, 0x28, 0x5B, 0x1D, 0x74, 0x30,
+    0xCE, 0x62, 0x5C, 0xD9, 0x5A, 0x22, 0x13, 0xA2, 0x1A, 0x74, 0x50, 0x7D, 0xEE, 0x8B, 0xCE, 0xB8,
+    0xA2, 0x4B, 0x72, 0xB1, 0x6A, 0x20, 0x32, 0x25, 0x9A, 0x2E, 0xF7, 0x59, 0x9F, 0xFB, 0x86, 0xB2,
+    0x2E, 0xBA, 0xEA, 0xE1, 0x3E, 0x11, 0xD3, 0xF6, 0xB5, 0x88, 0x84, 0xAC, 0x37, 0x22, 0xE2, 0x8C,
+    0xB3, 0x07, 0x07, 0x0B, 0x2C, 0xDB, 0x89, 0x1E, 0x33, 0x4D, 0x48, 0x4C, 0x4C, 0xDD, 0x5E, 0xFA,
+    0x08, 0xCB, 0xDD, 0xAF, 0xA4, 0x0E, 0xB9, 0x22, 0x3D, 0xA5, 0xC8, 0xDB, 0x6F, 0x05, 0xF6, 0xB3,
+    0xDE, 0x16, 0x3E, 0x0B, 0x65, 0x3B, 0x18, 0x67, 0x5C, 0xCC, 0x3B, 0x8B, 0xCD, 0x7D, 0xC5, 0x54,
+    0x0D, 0x96, 0x69, 0x16, 0x8A, 0x57, 0x06, 0x1D, 0xF2, 0xAE, 0x32, 0xCE, 0xB4, 0x65, 0x1B, 0x67,
+    0xEC, 0xB3, 0x0D, 0xDC, 0xC6, 0x9D, 0x50, 0xB2, 0x80, 0xE2, 0xEA, 0x35, 0xD0, 0x6F, 0xBB, 0x91,
+    0xB0, 0x72, 0x5E, 0xDA, 0x04, 0xDF, 0x9A, 0x6B, 0x8F, 0x46, 0xF2, 0x5A, 0x1D, 0xD1, 0x50, 0x66,
+    0xC7, 0xD2, 0xE4, 0xD9, 0xF8, 0xB4, 0xA5, 0xEC, 0x40, 0xEA, 0xD4, 0x2D, 0xBB, 0x48, 0xBE, 0x72,
+    0x73, 0xBC, 0x23, 0xDC, 0x46, 0xEA, 0x7C, 0xD5, 0x11, 0x05, 0xEB, 0xE0, 0x6E, 0xA9, 0x39, 0x2F,
+    0x0B, 0x0A, 0x91, 0x8B, 0x54, 0xD7, 0x77, 0x56, 0x98, 0x65, 0x22, 0x1C, 0xEC, 0xD6, 0x54, 0x23,
+    0xE8, 0x33, 0xC0, 0xEE, 0xEE, 0xD7, 0x46, 0x85, 0xD9, 0xE7, 0x81, 0x32, 0x8F, 0x64, 0xEF, 0x75,
+    0x60, 0x3D, 0x6A, 0xBE, 0x40, 0x8B, 0x74, 0x4C, 0xBE, 0xB2, 0xAA, 0x72, 0x5B, 0x35, 0x3D, 0xC9,
+    0x06, 0xB2, 0xE7, 0x86, 0x14, 0x68, 0x37, 0xCB, 0x15, 0x62, 0xBA, 0x59, 0x0B, 0x57, 0x78, 0x38,
+    0x1F, 0xB8, 0x5B, 0x3C, 0x73, 0x69, 0x91, 0x8B, 0x47, 0x25, 0x45, 0xF9, 0xF5, 0xF4, 0xA4, 0x4E,
+    0xF2, 0x55, 0x82, 0x53, 0x07, 0xA6, 0x54, 0x75, 0xC2, 0x25, 0xD3, 0x93, 0x36, 0xAB, 0x3A, 0xF7,
+    0x2A, 0x9A, 0x2E, 0xEB, 0x99, 0xE8, 0x40, 0xDC, 0xD8, 0x5D, 0xAE, 0x76, 0x0F, 0xA6, 0xCB, 0x7A,
+    0x66, 0xE3, 0x7A, 0x58, 0x60, 0x29, 0x5B, 0x5B, 0x97, 0xAD, 0x71, 0x45, 0x28, 0x3A, 0xD3, 0x21,
+    0x0F, 0xF7, 0xA5, 0xA7, 0x14, 0x91, 0x0E, 0x95, 0x98, 0x2B, 0x27, 0xE7, 0x7F, 0x73, 0x04, 0xBB,
+    0x8C, 0x50, 0x67, 0x3C, 0x6A, 0xDD, 0x3F, 0x96, 0x70, 0xAD, 0x08, 0x15, 0x77, 0x1E, 0x15, 0xF9,
+    0xCE, 0x6E, 0x15, 0xBD, 0xA7, 0x6E, 0x79, 0x55, 0x8D, 0xEA, 0xD3, 0xAC, 0xB5, 0x44, 0x1D, 0xB4,
+    0x37, 0xCE, 0xB2, 0x4F, 0xCC, 0x7D, 0xE1, 0x8C, 0x9B, 0x11, 0x89, 0xC6, 0x19, 0x67, 0x5C, 0x54,
+    0x03, 0x43, 0xD9, 0x56, 0x75, 0xF9, 0x64, 0x9F, 0x85, 0xAC, 0xAF, 0x6A, 0x8B, 0xD5, 0x41, 0xFB,
+    0xDC, 0x5B, 0x26, 0xC4, 0xAC, 0x2F, 0xBA, 0xAA, 0xAD, 0x5C, 0x2C, 0x02, 0xF2, 0xA5, 0xBF, 0x8C,
+    0xE4, 0x22, 0xCB, 0xD5, 0xDD, 0xDF, 0x68, 0x2D, 0x94, 0x06, 0xBE, 0xBD, 0x6E, 0xDD, 0x97, 0x30,
+    0xAE, 0x84, 0x22, 0x0D, 0x7F, 0xAF, 0x12, 0xDF, 0xE5, 0xEE, 0xEE, 0xEE, 0xBC, 0x91, 0xB1, 0xC0,
+    0x41, 0xFE, 0xDE, 0x25, 0xBE, 0x1B, 0x15, 0xBD, 0xF5, 0x4D, 0x15, 0xBD, 0x87, 0x30, 0xB3, 0xDF,
+    0xD9, 0x6D, 0x8C, 0x88, 0xBC, 0x2C, 0x22, 0x1F, 0x50, 0xD1, 0xEB, 0xCF, 0x3B, 0xB5, 0x59, 0xD1,
+    0x3B, 0x85, 0x6C, 0x11, 0xC1, 0x2C, 0xA7, 0x50, 0xFD, 0x68, 0x06, 0x96, 0x7D, 0x58, 0x30, 0x41,
+    0xC5, 0xF4, 0xC4, 0x9D, 0xED, 0xD4, 0xB6, 0xA9, 0xE8, 0x56, 0xAC, 0xD5, 0xAA, 0x4E, 0xCF, 0x6E,
+    0xAD, 0x12, 0x92, 0x13, 0xA1, 0x7C, 0xA8, 0x87, 0xF2, 0xE9, 0x00, 0xE6, 0x9B, 0x1D, 0x98, 0x6F,
+    0x3B, 0x30, 0xAF, 0xB6, 0x60, 0xDE, 0x26, 0x3D, 0x4D, 0x95, 0x22, 0xAE, 0x3C, 0xF9, 0x7C, 0x6C,
+    0x2F, 0x5C, 0x3D, 0xD6, 0xD2, 0xFC, 0x30, 0x60, 0xEB, 0x48, 0xD5, 0x5A, 0x8C, 0x33, 0x2E, 0xEF,
+    0xB2, 0xA0, 0x03, 0x33, 0x35, 0x50, 0xD6, 0x91, 0xBC, 0x9B, 0xC0, 0x60, 0x61, 0xDB, 0xB4, 0x98,
+    0xEF, 0x39, 0xF4, 0xCF, 0x3C, 0x1C, 0x86, 0x04, 0x06, 0x14, 0x71, 0x54, 0x06, 0x77, 0x9D, 0xBB,
+    0x04, 0xE6, 0xA5, 0x81, 0x14, 0x42, 0xE9, 0xB0, 0x0D, 0xF4, 0x25, 0x70, 0xE1, 0x18, 0xA7, 0xEF,
+    0xC3, 0xBA, 0xD8, 0xAF, 0x9F, 0x6C, 0x31, 0x2F, 0x0D, 0x64, 0xBD, 0x05, 0xAB, 0x7D, 0x2A, 0xAF,
+    0xDD, 0x1C, 0xDB, 0xAF, 0x55, 0x1C, 0x37, 0x95, 0x1A, 0x8F, 0xE0, 0xFC, 0x88, 0x79, 0x57, 0xD7,
+    0xCF, 0x8F, 0x64, 0xC8, 0x79, 0xAB, 0x52, 0x08, 0x9D, 0x6A, 0x8F, 0x57, 0x4D, 0x41, 0x52, 0x27,
+    0xA1, 0xC2, 0x43, 0xF5, 0xE4, 0x30, 0x3E, 0x0B, 0xA4, 0x74, 0x03, 0x59, 0x9F, 0x8A, 0x91, 0xC7,
+    0xD8, 0x15, 0xE3, 0x22, 0x45, 0x97, 0xB4, 0xD4, 0x94, 0xD2, 0x35, 0xA4, 0x16, 0xF0, 0xB6, 0x9E,
+    0x00, 0xA5, 0xDB, 0x67, 0x92, 0x0C, 0x7A, 0x3B, 0x19, 0xDD, 0x59, 0x5B, 0x6F, 0xAB, 0x81, 0x43,
+    0xA0, 0xC1, 0x8E, 0xE6, 0x7E, 0x8E, 0xCD, 0x3D, 0x0D, 0xB0, 0xA0, 0x4A, 0x18, 0x8A, 0x8E, 0x54,
+    0x65, 0x8D, 0x75, 0x14, 0x81, 0xD2, 0x32, 0xD6, 0x2F, 0x9B, 0x7D, 0x48, 0xE5, 0xDE, 0x26, 0x8E,
+    0x0D, 0xA9, 0x53, 0x09, 0x58, 0x25, 0xDD, 0x2A, 0x69, 0xFD, 0xC8, 0xB1, 0x24, 0xD5, 0x51, 0x11,
+    0xE9, 0x11, 0xF1, 0xEC, 0x70, 0xBD, 0x94, 0x56, 0xAD, 0x28, 0xB2, 0x47, 0x57, 0x78, 0xD1, 0xD8,
+    0x68, 0xE0, 0x88, 0x75, 0xB9, 0x59, 0x32, 0x9E, 0x77, 0xE4, 0x3E, 0x17, 0xA1, 0xAC, 0xB1, 0x34,
+    0x3F, 0x12, 0x26, 0xA8, 0x41, 0x0F, 0x1C, 0x32, 0x60, 0x5C, 0x95, 0xB8, 0xAA, 0x87, 0x63, 0x3D,
+    0x81, 0x0E, 0x45, 0x87, 0x71, 0x15, 0x55, 0x6D, 0x53, 0xA3, 0xA9, 0x48, 0x84, 0xA8, 0xFA, 0xA2,
+    0xCB, 0x3D, 0x3A, 0x68, 0x6F, 0x29, 0x5B, 0xCA, 0xD6, 0x3C, 0x35, 0xB6, 0x9D, 0xDA, 0x5E, 0xF5,
+    0x66, 0x8F, 0x53, 0x74, 0xA0, 0x6A, 0xB3, 0x9F, 0x79, 0x4C, 0xA7, 0x22, 0xC5, 0xDB, 0x50, 0xBE,
+    0x7E, 0xBE, 0xA3, 0x1C, 0xA0, 0x92, 0x45, 0x32, 0x4D, 0xA5, 0xB4, 0x23, 0x1B, 0xAE, 0xE6, 0xA8,
+    0xE1, 0xCF, 0xBA, 0xB3, 0xFF, 0xEA, 0xF2, 0x4C, 0x77, 0xFC, 0xCA, 0xB3, 0xC7, 0xC2, 0x4A, 0xA5,
+    0xAD, 0x26, 0xC9, 0x2A, 0x1B, 0x72, 0x85, 0x15, 0x09, 0xEC, 0xBC, 0xD4, 0xD0, 0xA4, 0x07, 0x5A,
+    0xC9, 0x82, 0x62, 0xB0, 0x5F, 0x0A, 0x6A, 0x01, 0xB6, 0xB5, 0x35, 0x2A, 0x16, 0x7E, 0x54, 0x5B,
+    0x1C, 0x56, 0x2D, 0x14, 0xAF, 0xF5, 0xC0, 0xA1, 0x05, 0x8A, 0xBF, 0x0A, 0xC0, 0xE1, 0x84, 0xB1,
+    0x76, 0x3F, 0x29, 0x3B, 0xF3, 0x3D, 0x0F, 0x59, 0x9C, 0x00, 0xF6, 0x8B, 0x01, 0xF2, 0x60, 0x6B,
+    0x58, 0x64, 0x11, 0xAC, 0x33, 0x3E, 0x96, 0x81, 0x46, 0x24, 0xA6, 0x7C, 0x22, 0x99, 0x2C, 0xEB,
+    0x55, 0x6F, 0xEC, 0xCD, 0x07, 0x15, 0xDC, 0x3B, 0xDA, 0xE4, 0xE6, 0x1A, 0x4A, 0xC4, 0x2B, 0x91,
+    0x25, 0xCB, 0xBB, 0x8C, 0x3B, 0x24, 0x1B, 0x2C, 0x4C, 0xAA, 0x1A, 0xF3, 0x7D, 0x87, 0xFE, 0x59,
+    0x40, 0x5D, 0x1B, 0x60, 0x32, 0x49, 0xCB, 0xCA, 0xBC, 0xEC, 0x53, 0xEC, 0xD6, 0xDB, 0x73, 0x0F,
+    0x0F, 0xF9, 0xFB, 0x12, 0x99, 0xCB, 0xC0, 0x49, 0xE9, 0xA1, 0xEC, 0x56, 0x34, 0xF6, 0x55, 0xC8,
+    0x96, 0xA5, 0x49, 0x90, 0x89, 0xFC, 0x21, 0x40, 0x5F, 0x2C, 0x01, 0xBE, 0x76, 0x21, 0x25, 0xE6,
+    0x6D, 0x9A, 0x52, 0xAB, 0x8F, 0xBC, 0x70, 0xEC, 0xBF, 0xC7, 0x37, 0x66, 0xCC, 0x49, 0x69, 0x73,
+    0x69, 0x29, 0x24, 0x16, 0x12, 0x31, 0xCB, 0x43, 0x75, 0x7D, 0xEE, 0x8A, 0x5E, 0xF1, 0xE9, 0xBC,
+    0x4F, 0xE1, 0xDA, 0x61, 0xEA, 0xC0, 0x53, 0xBE, 0x14, 0x93, 0x1D, 0x4A, 0x09, 0xFE, 0x98, 0x16,
+    0xA2, 0x4D, 0xB5, 0xC6, 0xE5, 0xF7, 0x3B, 0x18, 0x5B, 0xC7, 0x41, 0x76, 0x2D, 0xDD, 0xD4, 0xC5,
+    0x04, 0xB6, 0xD3, 0x31, 0x65, 0x4B, 0xF9, 0xBD, 0xD4, 0x82, 0xE8, 0x27, 0x43, 0xCA, 0x06, 0x1C,
+    0x42, 0x24, 0x1B, 0x4A, 0x47, 0x93, 0x88, 0xC0, 0x55, 0xCB, 0x12, 0xA1, 0x0C, 0x08, 0xE5, 0xBB,
+    0xE7, 0xE5, 0x8F, 0x84, 0x4C, 0xE4, 0x55, 0x11, 0x28, 0xA5, 0x9D, 0x2F, 0x92, 0x81, 0xD9, 0xE1,
+    0xA8, 0x49, 0x6D, 0x6A, 0xAD, 0x67, 0xE5, 0x1A, 0x50, 0xA9, 0xB9, 0x83, 0x53, 0xC5, 0xB9, 0x4B,
+    0x47, 0x66, 0x3E, 0x01, 0x9B, 0xE9, 0x71, 0x5D, 0xE5, 0x51, 0x1F, 0xE3, 0x63, 0x94, 0x64, 0xA9,
+    0xE7, 0x9E, 0x52, 0xBA, 0x46, 0x28, 0xDF, 0xBD, 0x74, 0xFB, 0xF9, 0xCE, 0x74, 0x8C, 0x53, 0x67,
+    0xEC, 0x65, 0x60, 0x5E, 0x4A, 0x90, 0x64, 0x5C, 0x73, 0x2F, 0xB0, 0xA5, 0x53, 0x03, 0xE5, 0xCB,
+    0x9E, 0x19, 0xC5, 0x8F, 0x07, 0x2A, 0x74, 0x3F, 0xC1, 0x38, 0x15, 0x8D, 0xD3, 0x81, 0x85, 0xEE,
+    0xD5, 0xC0, 0x9C, 0xF9, 0x97, 0xE5, 0x3B, 0x92, 0x52, 0x6D, 0x35, 0xF3, 0xA1, 0x59, 0x82, 0xDA,
+    0x49, 0x57, 0x70, 0x6A, 0xA4, 0x65, 0x8D, 0x94, 0xAF, 0x22, 0x73, 0xDF, 0x00, 0xD8, 0xB9, 0x4D,
+    0xDD, 0xCC, 0xC5, 0xFD, 0xFF, 0x31, 0x66, 0x83, 0x3A, 0x38, 0x38, 0x68, 0xA1, 0x4C, 0x24, 0xA7,
+    0xEE, 0x41, 0x03, 0x7C, 0x44, 0x71, 0x43, 0xAB, 0x89, 0x0F, 0x07, 0xDA, 0x39, 0xEA, 0x26, 0xFA,
+    0x0F, 0xF2, 0x9C, 0x95, 0x2F, 0x43, 0x26, 0x4B, 0xD2, 0x63, 0x83, 0x6F, 0x6A, 0xA4, 0x38, 0x7C,
+    0x00, 0x3B, 0x36, 0xA9, 0xC0, 0x56, 0x8B, 0x60, 0xDF, 0xF8, 0x9A, 0x1E, 0xD6, 0xB5, 0xEE, 0x85,
+    0x3F, 0xEA, 0xC0, 0x1A, 0xD6, 0x4F, 0xDE, 0xD9, 0x6C, 0xB9, 0x5F, 0xBD, 0xFE, 0x55, 0x2A, 0xE9,
+    0x28, 0x65, 0xE4, 0x41, 0xFB, 0x9B, 0xBA, 0xB9, 0x4E, 0xD6, 0x5D, 0xB2, 0x3F, 0x91, 0xCE, 0x7A,
+    0x1B, 0xFB, 0xD0, 0x1B, 0x47, 0xF9, 0x4E, 0x00, 0xBB, 0x1C, 0xF5, 0xAE, 0x92, 0x0E, 0xEC, 0xBC,
+    0x25, 0xEF, 0x16, 0x1F, 0x61, 0x50, 0x57, 0xFB, 0x0A, 0xCA, 0xF7, 0xFC, 0xD8, 0xA4, 0xDE, 0xFA,
+    0xD1, 0x2A, 0xCD, 0xE6, 0x0E, 0xD3, 0x4E, 0xC9, 0x82, 0xAA, 0x13, 0xF4, 0x7B, 0x34, 0x19, 0x74,
+    0x7B, 0x7A, 0x77, 0x61, 0x45, 0xAE, 0xBE, 0xBB, 0xBB, 0x93, 0x0A, 0x03, 0xEE, 0x40, 0xCD, 0xC3,
+    0x5D, 0x22, 0x57, 0xA5, 0xDD, 0xFA, 0x2C, 0x59, 0x7B, 0xDF, 0x72, 0x78, 0xFE, 0xFE, 0x93, 0xF7,
+    0x95, 0x2F, 0xF6, 0x5B, 0x7B, 0x77, 0xC2, 0x0E, 0xCC, 0x07, 0x4A, 0x59, 0x3E, 0xDC, 0x95, 0xF1,
+    0x5E, 0x4E, 0x1E, 0x2F, 0x85, 0x29, 0x8E, 0xEA, 0xC0, 0x57, 0x37, 0xF3, 0xC1, 0x55, 0xB5, 0x8C,
+    0xE6, 0xDE, 0xE3, 0x13, 0x2C, 0x15, 0xB2, 0xEF, 0x42, 0x2E, 0xF5, 0x98, 0x5E, 0xBC, 0x3E, 0x05,
+    0x8A, 0xB7, 0x3C, 0x9F, 0xC2, 0x03, 0xBE, 0x80, 0xFA, 0x36, 0xE0, 0xB6, 0x63, 0xCF, 0x84, 0xFC,
+    0xA5, 0x5E, 0x77, 0x27, 0x11, 0xAA, 0xE5, 0xCA, 0x32, 0xCF, 0xE3, 0x0B, 0x49, 0xDF, 0x98, 0x73,
+    0xFF, 0x96, 0x27, 0x00, 0xE8, 0x0A, 0x7E, 0xE5, 0x97, 0x0D, 0xA9, 0xD7, 0x76, 0xEA, 0x11, 0x43,
+    0xB3, 0x44, 0x75, 0x67, 0x00, 0x43, 0xE0, 0x13, 0x5C, 0x04, 0x2E, 0x66, 0xC7, 0x3F, 0x71, 0xF2,
+    0xF5, 0xB5, 0x27, 0xBE, 0x12, 0xCE, 0xD9, 0x47, 0x57, 0xC2, 0xA9, 0xB7, 0x6E, 0x3A, 0x83, 0x5A,
+    0x2F, 0xC8, 0xF5, 0xBE, 0xA3, 0xCA, 0xA3, 0xE1, 0x78, 0x43, 0x2F, 0x3E, 0xBD, 0x2A, 0x19, 0x28,
+    0xDA, 0x95, 0xC7, 0xB2, 0x47, 0x76, 0x11, 0x35, 0x5D, 0xB5, 0x14, 0x97, 0x76, 0x3C, 0x58, 0xDC,
+    0x51, 0x53, 0xF4, 0xF1, 0x2B, 0x3F, 0xCD, 0xEA, 0xED, 0x97, 0x7D, 0xE5, 0xE3, 0x03, 0x29, 0xFF,
+    0xCF, 0x71, 0xE5, 0x50, 0x2C, 0x99, 0xA7, 0xB5, 0xD1, 0x2C, 0xF8, 0x83, 0xB4, 0xF3, 0xAE, 0xEE,
+    0x57, 0x93, 0x6D, 0xBB, 0x6A, 0x1B, 0x7F, 0x76, 0xC5, 0xD5, 0xD7, 0x61, 0xE5, 0x6C, 0x94, 0x35,
+    0x54, 0x9E, 0x93, 0xED, 0xAA, 0xCD, 0x71, 0x5C, 0x3D, 0x5F, 0xDB, 0xB4, 0xE3, 0xC3, 0x18, 0x54,
+    0x9F, 0xBE, 0x62, 0xA3, 0x31, 0x7A, 0xE6, 0x6F, 0x92, 0xE5, 0x4A, 0xBC, 0x7B, 0x63, 0x0A, 0x2D,
+    0x3D, 0xE6, 0x3A, 0x40, 0x21, 0x02, 0xE9, 0xD1, 0x2D, 0x1C, 0x29, 0xC5, 0xC2, 0xC1, 0x02, 0x0B,
+    0xA6, 0x67, 0x80, 0xB9, 0xCB, 0x3D, 0xB9, 0x50, 0xD5, 0x34, 0x03, 0x11, 0xFD, 0x5E, 0xA7, 0x03,
+    0xB6, 0xC2, 0xB4, 0x59, 0x1F, 0xD9, 0xA7, 0x7C, 0x3A, 0xAC, 0x32, 0xFC, 0xC6, 0xED, 0x63, 0x99,
+    0x65, 0x81, 0x21, 0xF7, 0xC6, 0x25, 0x70, 0xA7, 0xD2, 0x41, 0x0D, 0xC4, 0xAA, 0x2E, 0x3A, 0xFD,
+    0x93, 0x81, 0x8A, 0xF2, 0x31, 0x47, 0x64, 0x16, 0xD1, 0x3E, 0x13, 0x47, 0x59, 0x9B, 0x05, 0x4C,
+    0xB1, 0x1E, 0x7D, 0xFD, 0x49, 0x01, 0xB3, 0x2C, 0xC2, 0x38, 0xED, 0xC6, 0xA4, 0xF5, 0x94, 0x55,
+    0x3E, 0x61, 0x4C, 0x1F, 0x0E, 0x47, 0x4E, 0xDB, 0x69, 0xE0, 0x04, 0xAA, 0x56, 0x81, 0xFD, 0xD4,
+    0x46, 0x7D, 0xF9, 0x68, 0x9F, 0xAA, 0xF0, 0x4E, 0x5D, 0xFB, 0xB5, 0x97, 0x68, 0xFE, 0x61, 0x29,
+    0x3F, 0x91, 0x7A, 0xDE, 0xDB, 0xC0, 0xCE, 0x51, 0x77, 0x98, 0xD5, 0x33, 0x3C, 0x74, 0xE0, 0x28,
+    0xA1, 0x59, 0x1D, 0xA5, 0x85, 0x8B, 0x94, 0x9B, 0xAF, 0x4F, 0xC9, 0xC1, 0xCD, 0xF4, 0xA1, 0x84,
+    0xDD, 0x77, 0x5A, 0xA4, 0xCF, 0x7D, 0x1E, 0x8B, 0x8E, 0x85, 0x71, 0x1C, 0x8E, 0xB8, 0xFD, 0xAC,
+    0xAC, 0x59, 0x54, 0x75, 0xB6, 0xC2, 0xEE, 0xBB, 0x46, 0xA4, 0x9E, 0xCB, 0x25, 0xFE, 0x3F, 0xDD,
+    0xBD, 0x4F, 0x8C, 0x25, 0xC7, 0x9D, 0xE7, 0xF7, 0x89, 0x0C, 0x56, 0xA7, 0x86, 0xB9, 0xAB, 0xE8,
+    0x03, 0x39, 0xB3, 0x23, 0x7A, 0x98, 0x7B, 0x58, 0x1B, 0x3B, 0x1A, 0x75, 0xE7, 0x1E, 0xE6, 0x40,
+    0xC3, 0x55, 0x15, 0x49, 0x12, 0xB0, 0x0E, 0x3A, 0xA8, 0x0E, 0x2C, 0x11, 0x30, 0x0F, 0xD4, 0x61,
+    0x0F, 0x63, 0x0D, 0x16, 0x6D, 0x18, 0x84, 0xD1, 0xB6, 0xAB, 0xDE, 0x4B, 0x89, 0xF0, 0xCE, 0x41,
+    0x07, 0x95, 0xE1, 0xD1, 0x0C, 0xB0, 0x03, 0xEC, 0xB4, 0x01, 0xED, 0x5A, 0x2A, 0xDA, 0x6E, 0x1E,
+    0x1A, 0x76, 0x7B, 0xF7, 0xBD, 0x7A, 0xD1, 0x6C, 0xAC, 0x79, 0xD0, 0x81, 0x29, 0x11, 0x1C, 0x02,
+    0xD6, 0x81, 0x39, 0x22, 0x39, 0x33, 0x4B, 0x7A, 0xCD, 0xA0, 0x18, 0x1C, 0x66, 0x37, 0x23, 0xDF,
+    0xCF, 0x87, 0xC8, 0x7C, 0x55, 0xC5, 0x6E, 0x6A, 0x28, 0x5B, 0xE3, 0x19, 0xF8, 0x35, 0x3A, 0xDF,
+    0xAB, 0x97, 0x99, 0x91, 0x11, 0xBF, 0x88, 0xF8, 0xFD, 0xFD, 0xFE, 0x7E, 0x8F, 0xA7, 0xC0, 0x38,
+    0x54, 0x0F, 0x65, 0xCD, 0xAF, 0xDD, 0xD9, 0xCB, 0x45, 0xEA, 0xB9, 0x78, 0x66, 0x50, 0xB4, 0x10,
+    0xC1, 0x38, 0xE8, 0xA1, 0x6C, 0xC8, 0x02, 0x58, 0xD0, 0xEF, 0xEF, 0x63, 0x65, 0x9D, 0x8B, 0xF4,
+    0x4B, 0xCA, 0x57, 0x1C, 0xCB, 0x48, 0xF1, 0x86, 0x63, 0x31, 0x50, 0xBE, 0x1C, 0x8A, 0x60, 0x65,
+    0x60, 0xB5, 0x86, 0x87, 0x80, 0x4A, 0xAE, 0xA1, 0x45, 0x3A, 0xAC, 0x88, 0xCB, 0x3B, 0x35, 0x70,
+    0x48, 0xD1, 0x15, 0x2D, 0x96, 0x88, 0xF6, 0xC6, 0x61, 0x55, 0x4F, 0xDE, 0x55, 0x8F, 0xFB, 0x21,
+    0xF3, 0xE6, 0x8A, 0xB3, 0x48, 0xD0, 0x22, 0x03, 0x73, 0x11, 0x8A, 0xBB, 0xFF, 0x32, 0x10, 0x31,
+    0xCE, 0x38, 0xBE, 0x4E, 0x0F, 0x94, 0x0D, 0x64, 0x01, 0xB0, 0x80, 0xF6, 0xC0, 0x0C, 0xC8, 0x5B,
+    0xA6, 0xD7, 0x41, 0x31, 0x90, 0xBD, 0x2F, 0x03, 0xE6, 0x8D, 0x3F, 0x8C, 0x58, 0xAF, 0x03, 0x42,
+    0xDE, 0xE5, 0x81, 0xB2, 0xA9, 0x1C, 0x33, 0x06, 0x54, 0xAF, 0x3D, 0x45, 0x6B, 0x1A, 0x6C, 0x7D,
+    0x08, 0x31, 0x0B, 0xE4, 0xDE, 0xB4, 0xBF, 0x6D, 0x6B, 0xFB, 0xE4, 0xFB, 0x51, 0x89, 0x7E, 0xAF,
+    0x2D, 0xDE, 0xFB, 0xEA, 0x9A, 0xCA, 0x4A, 0x47, 0xAC, 0x04, 0xED, 0xB7, 0x76, 0x29, 0x1B, 0x0E,
+    0x58, 0x42, 0xA7, 0x3D, 0x89, 0x28, 0xEC, 0x02, 0x2A, 0x90, 0x28, 0x05, 0x80, 0xBA, 0x06, 0x14,
+    0x6E, 0xEC, 0x1F, 0x7D, 0xEA, 0xDB, 0x4A, 0xA4, 0xD6, 0x22, 0x11, 0x23, 0x89, 0xB2, 0x69, 0x08,
+    0xA7, 0xD7, 0x45, 0x20, 0xEF, 0x80, 0xAA, 0x1E, 0xFF, 0x3A, 0x7D, 0xC8, 0xE6, 0x72, 0x33, 0x5D,
+    0xAE, 0xFA, 0x69, 0xC8, 0xE7, 0x2F, 0x2F, 0x1B, 0x60, 0xC9, 0xE9, 0x6B, 0x31, 0x9E, 0x8D, 0xE9,
+    0x9E, 0x2C, 0x30, 0x17, 0xCF, 0x4A, 0x3C, 0xC3, 0xFE, 0x1E, 0x31, 0x75, 0x70, 0x3C, 0x83, 0xF6,
+    0xE9, 0x7F, 0xDE, 0xA5, 0xC6, 0x0B, 0x97, 0x1E, 0x69, 0x5C, 0x6A, 0xB9, 0xAA, 0xA1, 0x9A, 0x3A,
+    0x5C, 0x89, 0x38, 0x2D, 0x12, 0xC7, 0x69, 0x1D, 0x9F, 0x5B, 0xB8, 0xF1, 0x81, 0xC6, 0x8D, 0xBD,
+    0xAC, 0xEA, 0xB1, 0x51, 0x11, 0xC7, 0x4A, 0x22, 0x17, 0x4E, 0x8E, 0xEB, 0x44, 0xAE, 0x73, 0xD7,
+    0x95, 0xF5, 0xFD, 0xA6, 0x35, 0x91, 0x75, 0x2E, 0x3E, 0x13, 0x71, 0xE6, 0x9D, 0x63, 0x6C, 0xEA,
+    0x72, 0xDE, 0xA5, 0x96, 0xE3, 0xE6, 0x24, 0x27, 0x90, 0xF9, 0xD4, 0xA0, 0x4D, 0x6D, 0x16, 0x6D,
+    0xEA, 0x6F, 0x1C, 0xFB, 0xDB, 0x9E, 0xEF, 0xEF, 0xE1, 0xD4, 0xFE, 0x3D, 0xFD, 0xCD, 0x3C, 0x60,
+    0xA5, 0x4B, 0xEB, 0x76, 0xFE, 0xCF, 0xA4, 0x29, 0xDA, 0x6C, 0x20, 0x62, 0xBC, 0x71, 0x58, 0x7A,
+    0x74, 0x28, 0x1B, 0xAA, 0x27, 0x02, 0x59, 0x6F, 0xA1, 0x7A, 0xDE, 0x93, 0x85, 0x19, 0xD8, 0x2F,
+    0xB7, 0xA9, 0xEF, 0x73, 0xC0, 0x74, 0xA0, 0x22, 0x60, 0x1B, 0x28, 0xBD, 0x7A, 0xFB, 0x4A, 0xA4,
+    0x94, 0x35, 0x4A, 0xD6, 0x35, 0x3C, 0x95, 0x06, 0x16, 0x3E, 0x65, 0x60, 0xC3, 0x1E, 0x5A, 0x06,
+    0x4A, 0x19, 0x98, 0x5D, 0x88, 0x99, 0xCF, 0x7A, 0xE3, 0xB4, 0xB7, 0x98, 0x5B, 0x3D, 0xB6, 0x68,
+    0x19, 0x2A, 0xB4, 0x8F, 0xD3, 0x68, 0xB3, 0x1E, 0x4C, 0x0B, 0x2B, 0x28, 0x82, 0xFE, 0x03, 0x69,
+    0x8C, 0xF4, 0x94, 0xEB, 0x71, 0x11, 0x98, 0x86, 0x5D, 0xB2, 0x1E, 0xD3, 0x72, 0x48, 0xE1, 0xC9,
+    0x3D, 0x4B, 0x4A, 0x47, 0x16, 0x88, 0xCC, 0x81, 0x48, 0x54, 0x03, 0xB0, 0xA4, 0xD7, 0x01, 0xB0,
+    0x2A, 0x98, 0x16, 0xA8, 0x9E, 0xF0, 0xB6, 0x01, 0xCC, 0x6D, 0xBF, 0x06, 0x28, 0x5E, 0xFD, 0xA0,
+    0x07, 0xD0, 0x1F, 0xBD, 0xEB, 0x01, 0xB4, 0x88, 0x03, 0x28, 0xE4, 0xBD, 0x1A, 0xA0, 0x7C, 0xE5,
+    0x15, 0x07, 0x30, 0xFF, 0xEA, 0xB7, 0x5B, 0x80, 0xA1, 0x7C, 0xDE, 0x03, 0xBA, 0xAF, 0x9E, 0xE8,
+    0x01, 0xD3, 0x59, 0x12, 0x3D, 0x2C, 0x27, 0xC0, 0x8A, 0x5D, 0x2C, 0x64, 0x91, 0x43, 0xAA, 0x26,
+    0x75, 0xCB, 0xBC, 0x43, 0xD9, 0x12, 0x29, 0xD6, 0xCC, 0x6B, 0x22, 0x7A, 0x1A, 0xC4, 0xB4, 0xAA,
+    0xE3, 0x27, 0xDE, 0xFB, 0x71, 0xDB, 0x85, 0xF4, 0x9E, 0xF9, 0xF1, 0xFB, 0xBD, 0xCD, 0x1E, 0x28,
+    0xD6, 0xE4, 0xAD, 0x12, 0x57, 0x09, 0x15, 0x56, 0xD8, 0x5F, 0x13, 0xF5, 0xF0, 0x14, 0x2A, 0xEA,
+    0xCE, 0x3A, 0xD0, 0xDE, 0x3C, 0x1E, 0x81, 0xA2, 0x3D, 0xDC, 0x8C, 0x1A, 0x60, 0x69, 0x5E, 0xEA,
+    0x81, 0x4C, 0x44, 0x5A, 0xC0, 0x88, 0x08, 0x80, 0xCD, 0xDB, 0x08, 0xA8, 0xBE, 0x4A, 0x3B, 0xB4,
+    0x8D, 0xC6, 0x01, 0x73, 0xDD, 0xD9, 0x1A, 0x72, 0x5F, 0xD6, 0x27, 0xC0, 0xAA, 0x3E, 0x60, 0x0D,
+    0x12, 0x32, 0x9F, 0x49, 0xC8, 0xD7, 0x98, 0x46, 0x89, 0xDB, 0xAA, 0x99, 0xF6, 0xCF, 0x69, 0xD7,
+    0x27, 0xD6, 0x55, 0x9D, 0x1F, 0x99, 0xF6, 0x9C, 0x7F, 0x5D, 0x91, 0x16, 0x2D, 0xE2, 0x31, 0x6F,
+    0xAF, 0x3C, 0x50, 0xB6, 0x40, 0xD5, 0x8C, 0x3B, 0x45, 0xF5, 0xD3, 0x72, 0xB6, 0x40, 0xEE, 0xC9,
+    0x8E, 0x05, 0x4A, 0x39, 0x82, 0x95, 0x34, 0x40, 0xE5, 0x26, 0x06, 0xB1, 0x61, 0x38, 0x89, 0x67,
+    0x38, 0x60, 0x0D, 0x14, 0x3E, 0x7F, 0xFB, 0x6B, 0x52, 0x97, 0x22, 0x81, 0x4A, 0xD6, 0xE3, 0x0E,
+    0xE1, 0x06, 0x90, 0x75, 0xD3, 0xDE, 0xDE, 0x05, 0xFE, 0xA3, 0x00, 0x48, 0x7D, 0xA6, 0x6B, 0x8F,
+    0x48, 0x9B, 0x8B, 0x34, 0xBB, 0x5F, 0x1B, 0xA0, 0xE8, 0x60, 0x96, 0x46, 0x15, 0x79, 0x78, 0x55,
+    0x17, 0xD2, 0x20, 0x11, 0x0A, 0x0F, 0x55, 0x3D, 0xC9, 0x19, 0xED, 0xDF, 0x52, 0x6B, 0x23, 0xE2,
+    0xE6, 0xD2, 0x92, 0x3B, 0xD8, 0x49, 0x4F, 0xA9, 0x40, 0x77, 0x7C, 0x3E, 0x9E, 0x3E, 0xA0, 0xAA,
+    0xB1, 0xB5, 0x71, 0xD8, 0x46, 0x7B, 0x6C, 0xA3, 0x7A, 0x6C, 0xC3, 0x0C, 0xDB, 0x50, 0xD5, 0xB6,
+    0xC1, 0x38, 0xDB, 0xA0, 0xBD, 0x6D, 0x50, 0xBD, 0x6D, 0x60, 0x69, 0x1B, 0xA8, 0xE6, 0x0D, 0x18,
+    0x69, 0x40, 0x4B, 0x0B, 0xEA, 0x4E, 0x04, 0x96, 0x55, 0x03, 0x56, 0x7B, 0x30, 0x6E, 0x05, 0xDA,
+    0x9B, 0x16, 0xD5, 0xAB, 0x08, 0x4B, 0xAA, 0x06, 0x8B, 0x0E, 0x18, 0xC7, 0xFC, 0x7B, 0x79, 0x87,
+    0x19, 0x54, 0x0F, 0xC2, 0xC4, 0x74, 0x75, 0xB7, 0x59, 0x63, 0xCB, 0xCD, 0x14, 0x1A, 0x37, 0x0E,
+    0xFF, 0x90, 0xD2, 0x15, 0x6D, 0xEE, 0x89, 0x2A, 0x62, 0x9C, 0x85, 0xDE, 0x38, 0xCA, 0x27, 0x3D,
+    0x99, 0x8F, 0x60, 0x2D, 0x68, 0x71, 0x30, 0x8B, 0x90, 0xBF, 0xDE, 0xC1, 0xA2, 0xAA, 0x31, 0x2E,
+    0x42, 0xCC, 0x3B, 0xCA, 0xC6, 0xD6, 0x59, 0x60, 0xD8, 0xAB, 0x28, 0x44, 0x7B, 0xEC, 0x86, 0x39,
+    0x9D, 0x65, 0xA6, 0x4C, 0x4C, 0xF2, 0x1C, 0x4D, 0x6A, 0xED, 0xB1, 0x75, 0xA2, 0xC9, 0xE1, 0x83,
+    0xB6, 0xA1, 0xFA, 0xB2, 0x34, 0x98, 0x5B, 0xD2, 0xA0, 0xFD, 0xEA, 0x13, 0x34, 0x71, 0x60, 0xA4,
+    0x03, 0x2D, 0x01, 0xD4, 0x9D, 0x81, 0xF1, 0x8C, 0xCD, 0x3D, 0x98, 0x97, 0xD6, 0xA0, 0x3B, 0x69,
+    0x51, 0xFD, 0x6E, 0x84, 0xE5, 0xD6, 0x19, 0x9A, 0xAC, 0xC8, 0x3B, 0x4C, 0xA7, 0x02, 0x2A, 0xC2,
+    0x21, 0x45, 0x9B, 0x85, 0xA3, 0x13, 0xCC, 0xCB, 0xAF, 0x74, 0xD8, 0xCB, 0x03, 0xF4, 0xD2, 0x92,
+    0xBF, 0x3A, 0x40, 0xF5, 0xD5, 0x16, 0x62, 0x04, 0x2D, 0x1D, 0x94, 0xAB, 0x1A, 0x0E, 0x67, 0x90,
+    0xBD, 0x3F, 0x80, 0x79, 0x39, 0x82, 0xAD, 0x7A, 0x54, 0xFF, 0x51, 0xA0, 0x78, 0xF5, 0xB6, 0xC7,
+    0xFE, 0x4A, 0xD1, 0x11, 0x31, 0x89, 0x53, 0x9F, 0x1D, 0x53, 0x25, 0x9D, 0xAD, 0x8D, 0x04, 0x5B,
+    0x67, 0xAB, 0xBF, 0xF8, 0xB4, 0x79, 0xB6, 0xF6, 0x74, 0x9E, 0xDD, 0x66, 0x9E, 0x6D, 0xBD, 0x99,
+    0xE7, 0x13, 0xC8, 0x3B, 0xD3, 0xA2, 0xC2, 0xD9, 0x79, 0xF6, 0xA7, 0x63, 0x6A, 0xB3, 0x34, 0x26,
+    0x55, 0x9F, 0xA1, 0xF5, 0xAF, 0x0E, 0x4F, 0xA1, 0x45, 0x1A, 0xAC, 0x84, 0x51, 0x20, 0x75, 0xC0,
+    0x8C, 0xB2, 0x2D, 0xDA, 0x3C, 0x10, 0x19, 0x30, 0xCE, 0xD6, 0xF4, 0xA6, 0xA5, 0x7C, 0x32, 0x90,
+    0xF9, 0x01, 0xAC, 0xAD, 0xD3, 0x72, 0x9B, 0x0D, 0x90, 0xBF, 0xEE, 0x61, 0x51, 0x35, 0x18, 0x37,
+    0x40, 0xCC, 0x3D, 0x65, 0x63, 0x9B, 0x2C, 0x10, 0xA9, 0x28, 0xBC, 0xF6, 0xD8, 0x66, 0x2E, 0x0D,
+    0xD5, 0xB7, 0xA5, 0xA7, 0xF0, 0x22, 0x75, 0x16, 0xD1, 0x9E, 0x15, 0x58, 0x2A, 0x47, 0xDE, 0x15,
+    0x1E, 0x0E, 0xB3, 0x08, 0x45, 0x3B, 0x07, 0x62, 0xE9, 0xC0, 0xBC, 0xEC, 0xA7, 0x51, 0x56, 0x02,
+    0x64, 0x1F, 0x77, 0xA4, 0x07, 0xA3, 0xDF, 0x8F, 0xC0, 0xAC, 0xE8, 0xA0, 0x68, 0x2D, 0x10, 0x55,
+    0x04, 0xE3, 0x4C, 0x0B, 0x3D, 0x73, 0x28, 0x9B, 0xAC, 0x27, 0x0B, 0x98, 0x16, 0x0B, 0x73, 0xB4,
+    0x47, 0xF7, 0xCC, 0xC5, 0x65, 0xFD, 0x5C, 0x5C, 0xE1, 0xBF, 0x71, 0xDD, 0x95, 0x8E, 0xB2, 0x99,
+    0x43, 0xF9, 0x78, 0x84, 0x2A, 0xF7, 0x60, 0x4B, 0x07, 0x76, 0x0E, 0xCC, 0x23, 0x70, 0x12, 0x81,
+    0xB8, 0x04, 0xA2, 0x05, 0xFA, 0xD2, 0xA1, 0xFA, 0xA2, 0x25, 0x0B, 0xDA, 0xA3, 0xBD, 0x8A, 0x68,
+    0xCF, 0x80, 0xEE, 0xB0, 0x50, 0xD5, 0xE8, 0x4E, 0x7B, 0x98, 0x61, 0xA1, 0x68, 0xF3, 0x0E, 0x22,
+    0x87, 0x60, 0x5C, 0xD1, 0xA2, 0x7A, 0x22, 0x94, 0xB5, 0x71, 0x64, 0x41, 0xF5, 0x60, 0xA9, 0x6A,
+    0xB4, 0xCF, 0xD6, 0xC7, 0xC7, 0x6B, 0xAC, 0x24, 0x71, 0x2D, 0x91, 0xD9, 0x78, 0x03, 0x91, 0x08,
+    0x65, 0x63, 0x1C, 0x59, 0xA0, 0x07, 0x4B, 0xD9, 0xA0, 0x7D, 0x16, 0x48, 0x72, 0x24, 0xEF, 0xB4,
+    0x87, 0xD5, 0xB5, 0x19, 0x18, 0xC9, 0x5B, 0x90, 0x8E, 0x89, 0x89, 0x15, 0x6E, 0xC3, 0x59, 0xD3,
+    0xAE, 0xED, 0xD9, 0x6C, 0xA7, 0x3D, 0x38, 0x84, 0xC8, 0x12, 0x7A, 0x62, 0xEA, 0x58, 0x16, 0xE8,
+    0xD1, 0x5E, 0xF5, 0xE9, 0x01, 0x79, 0xA7, 0xEF, 0xEC, 0x3F, 0xD3, 0x6A, 0x11, 0x69, 0x73, 0x11,
+    0x71, 0x79, 0x8B, 0x71, 0x85, 0x4B, 0xDD, 0xA9, 0x6A, 0xE3, 0x52, 0x6F, 0x2C, 0x55, 0x8D, 0xDD,
+    0xAB, 0x60, 0xEE, 0x2D, 0xAC, 0xFC, 0xA4, 0xD5, 0x15, 0xED, 0xF4, 0xE4, 0x74, 0x68, 0x26, 0x5E,
+    0x9C, 0xF8, 0xBE, 0x96, 0x88, 0x85, 0x3C, 0xBD, 0x15, 0xD2, 0xA7, 0x51, 0xC3, 0x32, 0xBD, 0x2D,
+    0xD2, 0xD5, 0x71, 0xA3, 0xF4, 0x54, 0x89, 0xE1, 0x5B, 0x36, 0x1A, 0xF9, 0xFA, 0xF8, 0x78, 0x0D,
+    0x5A, 0x44, 0x86, 0xF4, 0x16, 0xD3, 0xA3, 0xE3, 0x59, 0x2D, 0x5E, 0xF5, 0x90, 0xE8, 0x97, 0x68,
+    0x37, 0xB2, 0x62, 0xA8, 0x6A, 0xF2, 0x0E, 0x6C, 0xE2, 0xDB, 0x36, 0xDD, 0x73, 0xBE, 0x0F, 0x1C,
+    0x82, 0x48, 0x53, 0xD5, 0x58, 0x69, 0x8D, 0xA3, 0x7C, 0xE7, 0x9A, 0xF6, 0x14, 0x2D, 0xF4, 0xA4,
+    0x59, 0x1E, 0xFB, 0x37, 0x03, 0xF3, 0xF6, 0xFE, 0x95, 0x1A, 0x2D, 0x22, 0x2D, 0x4A, 0x44, 0xFC,
+    0x48, 0x62, 0xAA, 0xA9, 0xD5, 0xAA, 0x1E, 0xB7, 0xA1, 0x4A, 0x77, 0x2F, 0xEF, 0x39, 0x0D, 0x55,
+    0x92, 0xBC, 0xE3, 0x60, 0xB0, 0x22, 0xE2, 0x20, 0xEF, 0x92, 0xAC, 0x3B, 0x4C, 0xC2, 0xAF, 0x68,
+    0x93, 0xDA, 0x18, 0xD3, 0x46, 0x35, 0x0E, 0xED, 0x13, 0x71, 0x66, 0x89, 0x51, 0x16, 0x6D, 0xD2,
+    0x0A, 0x62, 0x62, 0xDB, 0x46, 0xD2, 0x03, 0x25, 0x11, 0xB9, 0xFC, 0xB3, 0x55, 0x97, 0x9A, 0x58,
+    0xD5, 0x11, 0x2C, 0x3A, 0xA6, 0x26, 0x8C, 0xEB, 0x61, 0x0E, 0x43, 0xD9, 0x90, 0x77, 0x14, 0x3F,
+    0x0E, 0xB0, 0x84, 0x13, 0x0B, 0xC6, 0x51, 0xBC, 0x99, 0x5A, 0x5C, 0xCE, 0xA0, 0x6C, 0x30, 0xAF,
+    0xA7, 0x5E, 0x8C, 0xA2, 0xBB, 0x4C, 0x82, 0x41, 0x8F, 0x02, 0x7E, 0x3E, 0x7E, 0xDB, 0x25, 0x71,
+    0x1F, 0x01, 0xFE, 0xCB, 0x67, 0x04, 0x20, 0x17, 0x69, 0x92, 0x22, 0x78, 0x04, 0xC0, 0xC3, 0xE9,
+    0x0F, 0x09, 0x50, 0x24, 0x7D, 0x63, 0x7D, 0xFC, 0x42, 0xD2, 0x6A, 0x77, 0x81, 0x9E, 0xBC, 0x85,
+    0xB2, 0x66, 0x09, 0x59, 0x98, 0xB4, 0xBF, 0xB8, 0x87, 0xF6, 0x94, 0xE2, 0x99, 0x91, 0x89, 0xB4,
+    0x79, 0x4B, 0xF5, 0xB8, 0xB0, 0x40, 0x7B, 0xDD, 0xA7, 0xA5, 0xE9, 0x22, 0x79, 0x47, 0x2C, 0x1B,
+    0x96, 0x98, 0x97, 0x02, 0xC6, 0x11, 0x2B, 0x88, 0x98, 0xDB, 0x1E, 0xD3, 0x8C, 0x1D, 0x4F, 0x2B,
+    0x32, 0x4B, 0xAA, 0x54, 0xD2, 0x52, 0x8A, 0x0E, 0x20, 0x8B, 0x80, 0xFE, 0x03, 0xA9, 0x01, 0x2B,
+    0x2D, 0x90, 0xA5, 0xCD, 0x75, 0x4E, 0x07, 0x68, 0x60, 0x2E, 0x1E, 0x56, 0xFF, 0x76, 0x01, 0xAB,
+    0x06, 0x98, 0xD7, 0x5C, 0xC4, 0xD6, 0x99, 0x34, 0x55, 0xA3, 0x25, 0x1A, 0x97, 0x0D, 0xF3, 0xAF,
+    0x74, 0x2A, 0x16, 0x6F, 0x06, 0x06, 0x15, 0x23, 0x96, 0xF9, 0x9C, 0xAA, 0x29, 0xDF, 0x68, 0x4C,
+    0x9B, 0xBF, 0xDB, 0x69, 0x9F, 0xDD, 0xED, 0x89, 0x0C, 0x27, 0x58, 0x6C, 0xD5, 0x18, 0x57, 0xFD,
+    0x9E, 0xD7, 0xDE, 0xB4, 0x03, 0xD1, 0x78, 0xEB, 0xAA, 0x6F, 0xFB, 0xBC, 0xCF, 0x3F, 0x0E, 0xAC,
+    0xDE, 0x96, 0x40, 0x21, 0x72, 0xE7, 0xEB, 0x5C, 0x11, 0x89, 0xF0, 0x70, 0x21, 0x1B, 0xFA, 0x01,
+    0xAB, 0x00, 0x73, 0xA9, 0xA9, 0xDE, 0xDE, 0x23, 0x0F, 0xC0, 0xC0, 0xBC, 0x2B, 0x9B, 0x52, 0xBE,
+    0x15, 0xF4, 0x9D, 0x68, 0x19, 0x8A, 0x57, 0xBD, 0x71, 0x87, 0x33, 0xD5, 0x17, 0xAF, 0x77, 0x55,
+    0x13, 0x67, 0x59, 0x30, 0x2F, 0x77, 0xD5, 0xB7, 0x82, 0x55, 0xFD, 0x5C, 0xF7, 0xE6, 0x3D, 0x57,
+    0x76, 0xAB, 0xC0, 0x4A, 0xD6, 0x5F, 0x57, 0x22, 0x52, 0xB3, 0x57, 0x4E, 0xEA, 0x58, 0x25, 0x2D,
+    0x99, 0x48, 0xA4, 0x5C, 0xBF, 0x10, 0x98, 0xB7, 0x5C, 0x64, 0x3D, 0x4D, 0x76, 0x9E, 0x34, 0xC2,
+    0x69, 0x09, 0x54, 0x1B, 0x6D, 0xCB, 0x6E, 0xD6, 0xC1, 0xC9, 0x7D, 0x0E, 0xF3, 0xCD, 0x25, 0xD6,
+    0x4D, 0x0B, 0xA5, 0x58, 0xEF, 0xDF, 0x24, 0x13, 0xE9, 0x61, 0x2E, 0x6F, 0x4D, 0xB3, 0xE2, 0x01,
+    0xC2, 0x74, 0x50, 0x01, 0xB8, 0xE2, 0x81, 0x95, 0x3B, 0x3B, 0x15, 0xA5, 0x34, 0x5A, 0x04, 0xFB,
+    0xF6, 0xEF, 0xE8, 0x3E, 0x29, 0x7E, 0x31, 0xCD, 0xA4, 0x4D, 0x1B, 0x25, 0xF7, 0x69, 0xAE, 0x67,
+    0x69, 0xA3, 0x68, 0x9F, 0x3A, 0x5D, 0x76, 0x8F, 0x50, 0x49, 0xA4, 0x94, 0x96, 0xE2, 0x08, 0x4A,
+    0x60, 0x3B, 0x3D, 0xB4, 0x70, 0x5C, 0x58, 0x43, 0x35, 0x4E, 0xFA, 0x5C, 0x44, 0xAE, 0x88, 0xC8,
+    0x1B, 0x22, 0xE2, 0xA9, 0xEA, 0xC4, 0x21, 0xB4, 0x1F, 0x79, 0xEC, 0xB8, 0xF3, 0x36, 0x5F, 0xAA,
+    0x7E, 0x1C, 0xE9, 0x3D, 0x5F, 0x2E, 0xD9, 0x6C, 0xDB, 0xF4, 0xE5, 0xBA, 0x49, 0x6C, 0xD3, 0xC6,
+    0x51, 0xD9, 0x2C, 0xEB, 0xC4, 0xBD, 0x37, 0x8D, 0xEF, 0x02, 0x5B, 0x67, 0x06, 0x7B, 0x50, 0x44,
+    0x56, 0x1D, 0x8B, 0xB9, 0x68, 0xE9, 0x19, 0xEE, 0xCC, 0xBF, 0xFA, 0x07, 0x11, 0x71, 0x66, 0x49,
+    0x44, 0x30, 0x81, 0xA5, 0x1A, 0x30, 0x1D, 0x8B, 0x2C, 0x52, 0x3A, 0xA2, 0x0E, 0x94, 0x0D, 0x51,
+    0x7B, 0xAA, 0x5A, 0xF5, 0x79, 0x87, 0x25, 0x0B, 0x79, 0x8B, 0x25, 0xF3, 0x85, 0x63, 0x96, 0x7C,
+    0x12, 0xCB, 0xF4, 0x16, 0xC9, 0xBB, 0xB2, 0x21, 0x52, 0xB4, 0x55, 0x4D, 0xA4, 0xE8, 0x2A, 0x54,
+    0x4F, 0x2E, 0x96, 0x2C, 0x90, 0xAD, 0xCF, 0xD9, 0x26, 0x8B, 0x73, 0xFA, 0x7B, 0xDA, 0xFC, 0x2A,
+    0xBD, 0x8D, 0x7B, 0x2A, 0x71, 0xF2, 0x6F, 0xB7, 0x68, 0x3F, 0x83, 0x41, 0x7B, 0x4A, 0x67, 0x93,
+    0x88, 0x19, 0x28, 0x9B, 0xB1, 0x5F, 0xC6, 0x0D, 0xB0, 0x28, 0x1B, 0xF2, 0x57, 0x3D, 0xEC, 0x2E,
+    0x21, 0x93, 0x06, 0x4A, 0x0F, 0x0C, 0xF7, 0xB3, 0xAD, 0xCF, 0xAA, 0x28, 0x67, 0x6C, 0xDA, 0x19,
+    0x58, 0xD3, 0x50, 0x3D, 0xE9, 0x29, 0x5D, 0x52, 0x4C, 0xF3, 0xAE, 0x70, 0xDA, 0x67, 0x21, 0xEB,
+    0x39, 0x24, 0x52, 0x36, 0x4B, 0x74, 0x67, 0x21, 0xDA, 0x1A, 0x5B, 0x36, 0x98, 0x57, 0x1C, 0xD9,
+    0x47, 0x1D, 0xCC, 0x3D, 0x94, 0x01, 0x74, 0x1C, 0x1F, 0x6A, 0x47, 0xFE, 0x30, 0xB1, 0xD3, 0x89,
+    0x9F, 0x6E, 0xBE, 0xA4, 0x18, 0x95, 0x01, 0xED, 0xF3, 0x0E, 0xD3, 0x6A, 0x4F, 0xE9, 0xB4, 0xC7,
+    0x92, 0x05, 0x06, 0x54, 0xAF, 0x7A, 0x88, 0xDA, 0x43, 0x34, 0x6D, 0x1A, 0x1F, 0x87, 0x96, 0x34,
+    0x40, 0xAA, 0x9E, 0x71, 0x84, 0xA6, 0x85, 0xAD, 0x67, 0x5F, 0xAB, 0xB1, 0x22, 0x2E, 0x1D, 0x1E,
+    0x9E, 0xEF, 0xD7, 0xE3, 0x06, 0x99, 0x6D, 0x0E, 0xCB, 0x33, 0x6E, 0x13, 0xED, 0x4D, 0x43, 0x55,
+    0x5B, 0x54, 0x24, 0x62, 0x9C, 0xF6, 0xCC, 0x28, 0x9C, 0xF6, 0x54, 0x75, 0xD5, 0x70, 0x48, 0x1C,
+    0xBB, 0xD6, 0x59, 0x30, 0xB7, 0x3D, 0xD8, 0xB2, 0x49, 0x7A, 0x6A, 0xF6, 0x51, 0x07, 0x85, 0x90,
+    0x86, 0x9B, 0x36, 0x60, 0x92, 0xA0, 0x9E, 0x52, 0xC4, 0xA5, 0x85, 0x9B, 0xF9, 0x7B, 0xDC, 0x2F,
+    0xC9, 0x35, 0x61, 0x9A, 0x51, 0xDB, 0xB1, 0x35, 0xB3, 0x51, 0x06, 0x54, 0x0D, 0x59, 0x50, 0x11,
+    0xF2, 0x2E, 0xB9, 0x4F, 0x06, 0xA0, 0xFA, 0x4A, 0x0B, 0xEC, 0xCE, 0x00, 0xC4, 0x03, 0x4A, 0x00,
+    0x74, 0x00, 0x92, 0xCA, 0x9F, 0x89, 0x03, 0xCA, 0x3F, 0xAE, 0x81, 0xB8, 0x0B, 0xC9, 0x42, 0x60,
+    0xA9, 0xC2, 0xA4, 0xDB, 0xCC, 0x47, 0xF1, 0x56, 0x36, 0xD8, 0x1A, 0xFB, 0xBD, 0xAC, 0x07, 0x69,
+    0x4B, 0x37, 0xB6, 0x95, 0x56, 0x9E, 0xEE, 0x4E, 0x59, 0xF9, 0xF2, 0xD4, 0x24, 0x4E, 0x6A, 0xCF,
+    0x43, 0x90, 0xBA, 0x19, 0xA9, 0x1A, 0x15, 0xD4, 0xE8, 0x81, 0x2B, 0xDA, 0x08, 0xE6, 0x3B, 0x2D,
+    0x54, 0xCB, 0xA9, 0x3B, 0x02, 0xE4, 0x3D, 0x60, 0x3D, 0xE8, 0x8F, 0x3A, 0xA8, 0xBE, 0xEA, 0xC8,
+    0xFA, 0xB2, 0xA6, 0x74, 0x16, 0x15, 0x39, 0xD9, 0x33, 0x0E, 0x71, 0x43, 0xDA, 0x07, 0xEA, 0xE7,
+    0x39, 0xB4, 0x12, 0xCB, 0xA8, 0xE3, 0x4A, 0x44, 0xEA, 0x28, 0x22, 0xA2, 0xFA, 0x51, 0x74, 0x4F,
+    0xE2, 0x76, 0x3C, 0xE6, 0x1D, 0x49, 0xE2, 0x26, 0xD1, 0x9D, 0xC4, 0x6D, 0x3A, 0x26, 0x59, 0xBB,
+    0x84, 0xAA, 0x66, 0x09, 0xB6, 0x1E, 0x85, 0x7E, 0x04, 0x3B, 0x4A, 0xFC, 0x2C, 0xC0, 0x12, 0xED,
+    0x21, 0x9E, 0x3B, 0xE6, 0x77, 0x8F, 0x5F, 0x58, 0x37, 0x85, 0x88, 0x88, 0x33, 0x22, 0xA3, 0xDF,
+    0xC2, 0x34, 0xA7, 0x5A, 0x60, 0x75, 0xC6, 0x34, 0x4F, 0xC7, 0xD9, 0xB8, 0x65, 0xAD, 0x48, 0xB7,
+    0x3B, 0x17, 0xE9, 0x66, 0xDF, 0x58, 0xBD, 0x73, 0xB4, 0x4C, 0x4F, 0x1C, 0x0F, 0xAA, 0x67, 0x86,
+    0x0A, 0x2C, 0xC9, 0x7C, 0x7A, 0x58, 0x4C, 0x6A, 0x63, 0xD1, 0xA9, 0x90, 0xAC, 0x8B, 0xCA, 0x65,
+    0x9E, 0xB9, 0xCB, 0x82, 0x12, 0xA7, 0x86, 0xE2, 0x0D, 0x87, 0x88, 0x89, 0xD8, 0x3E, 0x8F, 0xA8,
+    0x9A, 0x38, 0xAD, 0xA7, 0x2C, 0x4C, 0x16, 0xB9, 0xDE, 0xA8, 0x8D, 0xA0, 0x3D, 0x2A, 0x18, 0x47,
+    0xD1, 0xCE, 0xC0, 0x66, 0x01, 0xA2, 0x71, 0xE4, 0x9D, 0x85, 0xEA, 0xF1, 0x08, 0x8B, 0xBC, 0x43,
+    0xFB, 0xC9, 0x9C, 0x9C, 0x69, 0x4F, 0x16, 0x8C, 0xC3, 0x38, 0xDB, 0x5C, 0x10, 0x56, 0x22, 0x91,
+    0x95, 0xBC, 0xDB, 0xF1, 0x8D, 0xEF, 0x7D, 0x8A, 0xA7, 0x30, 0x39, 0x16, 0xDF, 0x01, 0x6C, 0x0F,
+    0x4A, 0xDA, 0xC9, 0x13, 0x11, 0xA7, 0xB5, 0x54, 0xD6, 0xE3, 0xA5, 0x93, 0x47, 0xC2, 0x34, 0x1C,
+    0x96, 0x0D, 0xCB, 0xAA, 0x26, 0x5A, 0x88, 0x16, 0xD5, 0xCF, 0xD0, 0xFD, 0x8C, 0x3C, 0xCC, 0x30,
+    0x7E, 0xCE, 0xDC, 0xDB, 0x77, 0x3F, 0xEA, 0x4A, 0x79, 0xB9, 0xCD, 0xEE, 0xDC, 0xE3, 0x45, 0xFC,
+    0xFD, 0xF4, 0x28, 0x7B, 0xC6, 0xE3, 0x38, 0x79, 0x1D, 0x8B, 0x76, 0x5A, 0xA8, 0x3F, 0x77, 0xDC,
+    0x3D, 0x2C, 0xF2, 0xEE, 0xEF, 0x69, 0x5F, 0xD5, 0xDE, 0xB8, 0x98, 0xBB, 0x99, 0xF6, 0x55, 0x16,
+    0x8C, 0xBB, 0x69, 0x9C, 0x7D, 0xFE, 0x4F, 0xCE, 0x8E, 0xFB, 0xB7, 0x42, 0x55, 0x63, 0xEA, 0x08,
+    0x3B, 0xDA, 0x83, 0x2F, 0x1B, 0x72, 0xB7, 0x84, 0x5F, 0xBF, 0xC7, 0xA1, 0x7A, 0xDF, 0x51, 0x15,
+    0xCF, 0xF7, 0x33, 0xF3, 0xE5, 0x30, 0x33, 0xC6, 0xCF, 0x8D, 0xF5, 0x56, 0xC6, 0x51, 0xAD, 0x0B,
+    0xC7, 0xB6, 0x71, 0x1C, 0x18, 0xC7, 0xD5, 0xB2, 0xE1, 0x46, 0x35, 0x32, 0x28, 0x7B, 0x8F, 0x4B,
+    0xF6, 0xD3, 0x3C, 0xB8, 0x5B, 0xBF, 0x4F, 0xF1, 0xE7, 0x32, 0x50, 0x89, 0x0C, 0xC8, 0x5B, 0x79,
+    0xD4, 0x1E, 0xED, 0xCB, 0x06, 0xE3, 0x96, 0xC9, 0x7E, 0x55, 0xBD, 0x71, 0xC9, 0x98, 0xAB, 0x1E,
+    0xEF, 0x21, 0x16, 0x2D, 0xDA, 0x5B, 0x28, 0x9B, 0x08, 0xCB, 0xBC, 0x9B, 0x2E, 0x3F, 0x6F, 0xBC,
+    0x7E, 0xC2, 0x8B, 0xB9, 0x91, 0x0C, 0xC5, 0x9A, 0xE2, 0x75, 0xE9, 0x19, 0xEE, 0x5C, 0x71, 0x26,
+    0xB2, 0x44, 0x28, 0xDA, 0xB2, 0x65, 0x99, 0xC5, 0x64, 0xCC, 0x26, 0xD1, 0x33, 0x43, 0xF5, 0x79,
+    0x4B, 0x55, 0x2F, 0x46, 0xE7, 0xFC, 0x24, 0x03, 0x0F, 0xB3, 0x40, 0xD1, 0x56, 0x8C, 0xD7, 0x6D,
+    0xE4, 0xEF, 0x7C, 0x5D, 0x43, 0x2E, 0xD2, 0x41, 0x75, 0xF7, 0x7A, 0x0F, 0xD2, 0x64, 0x91, 0x2C,
+    0xC2, 0x40, 0xEE, 0x61, 0xC0, 0xB4, 0x10, 0x0F, 0xAA, 0x06, 0x15, 0xA3, 0x85, 0xBC, 0x8F, 0x73,
+    0xB8, 0xE2, 0x87, 0x93, 0xFD, 0xEB, 0xE2, 0x56, 0x22, 0x89, 0x08, 0xEB, 0x7A, 0x12, 0x9D, 0x9F,
+    0x76, 0x5C, 0x9F, 0xD1, 0xA6, 0xAD, 0x63, 0x0B, 0xCA, 0x3B, 0x5F, 0x5B, 0x43, 0x2E, 0x32, 0x00,
+    0x2B, 0x79, 0x0B, 0x50, 0xA7, 0x8E, 0xBF, 0xF9, 0x00, 0x85, 0x0C, 0x20, 0x4F, 0x47, 0x0A, 0xAF,
+    0xFD, 0x9E, 0xC5, 0xFC, 0xF0, 0xA5, 0x80, 0xAD, 0x8C, 0xD3, 0x61, 0x38, 0xD9, 0x92, 0x6F, 0x8A,
+    0x48, 0xC8, 0x44, 0xEE, 0x80, 0x3D, 0xEF, 0x78, 0x6F, 0x27, 0x97, 0x99, 0x6D, 0x2B, 0x98, 0x4B,
+    0x04, 0x2B, 0x0D, 0x6C, 0x9D, 0xF1, 0x7B, 0xFD, 0x2D, 0x1B, 0x7A, 0xD2, 0xD5, 0xD3, 0xD4, 0x98,
+    0xB3, 0x0C, 0xAE, 0x39, 0x65, 0x70, 0x67, 0x5E, 0x7F, 0x2D, 0xE4, 0xF9, 0x34, 0x2E, 0xB3, 0x71,
+    0x66, 0x56, 0xD2, 0x6A, 0x19, 0xC8, 0xEE, 0x30, 0xDA, 0x80, 0xC9, 0x74, 0x87, 0xC3, 0x24, 0x3D,
+    0x4E, 0x0D, 0xD5, 0xD3, 0xD3, 0xA3, 0x79, 0x79, 0x3E, 0x1A, 0x55, 0x35, 0xCC, 0xA5, 0x29, 0x24,
+    0x02, 0x64, 0x47, 0x59, 0x93, 0x84, 0x5F, 0xB2, 0xF4, 0xF5, 0x87, 0x57, 0xD2, 0x70, 0x65, 0x54,
+    0xD1, 0x7E, 0xEB, 0x1A, 0xF7, 0xBE, 0x74, 0x4B, 0x05, 0x03, 0xDA, 0x63, 0xD1, 0x3D, 0x2A, 0x60,
+    0x29, 0x3A, 0x88, 0xCC, 0xA8, 0x1C, 0x2C, 0x58, 0x32, 0x07, 0x76, 0x93, 0x37, 0x85, 0x8A, 0xA8,
+    0x03, 0x50, 0x36, 0xBD, 0x69, 0x01, 0x73, 0xAB, 0xB7, 0x0D, 0x90, 0xFF, 0x38, 0x9C, 0x8C, 0x0E,
+    0xF1, 0x38, 0xBE, 0x27, 0xA1, 0x3B, 0xBE, 0xDB, 0xDF, 0xFB, 0x71, 0x00, 0x58, 0x15, 0x2E, 0x02,
+    0x59, 0x4C, 0xA2, 0x3D, 0xF7, 0xC6, 0xCD, 0x00, 0xD3, 0x96, 0x8D, 0x05, 0x6C, 0x5D, 0xD5, 0x55,
+    0x0D, 0x6B, 0x2A, 0x8C, 0x23, 0x8B, 0x58, 0x8C, 0xA3, 0xF0, 0xEC, 0x92, 0x77, 0x94, 0x49, 0x3B,
+    0x65, 0x5E, 0xB3, 0x1C, 0x35, 0xCA, 0x92, 0xCB, 0x49, 0x09, 0x1E, 0xD5, 0xCD, 0x98, 0x4C, 0xCF,
+    0x2C, 0x75, 0x03, 0x75, 0x52, 0xDF, 0x3B, 0x6A, 0xDB, 0xB1, 0x4B, 0x3E, 0x20, 0x1D, 0x3D, 0x12,
+    0xD4, 0xB3, 0x6D, 0xDE, 0x9A, 0x0F, 0x1B, 0x4A, 0x57, 0x71, 0x02, 0xD8, 0xA4, 0xA5, 0xB1, 0xD0,
+    0xBE, 0x02, 0x32, 0x6F, 0x9A, 0xD1, 0x3D, 0x9E, 0x77, 0xA3, 0x19, 0x5E, 0x03, 0xA3, 0x55, 0xAE,
+    0xDF, 0x9E, 0x3F, 0xED, 0x81, 0xEA, 0xF1, 0xDE, 0x38, 0x20, 0xE6, 0xAD, 0x05, 0xF2, 0xAE, 0x1A,
+    0x35, 0xC4, 0x98, 0x05, 0x54, 0x1E, 0x74, 0x97, 0x07, 0x8C, 0xD4, 0x65, 0x5D, 0x48, 0x3D, 0x0F,
+    0x2C, 0x28, 0x06, 0x1E, 0x82, 0xE4, 0x7A, 0xBB, 0x8F, 0x43, 0xB3, 0xE6, 0x10, 0x5B, 0x53, 0xD5,
+    0xB6, 0x4E, 0xFC, 0x49, 0x7B, 0x5B, 0xA3, 0x7A, 0x5B, 0x9F, 0x77, 0xF2, 0xBE, 0x45, 0x0A, 0xD3,
+    0x28, 0x11, 0x81, 0x13, 0x4A, 0x8F, 0x85, 0x35, 0xC6, 0x51, 0x3A, 0xDD, 0x25, 0x71, 0xCC, 0x90,
+    0xF4, 0x06, 0x0B, 0x45, 0x6B, 0x1C, 0x3A, 0xE4, 0x1D, 0x0C, 0x6A, 0x74, 0xEF, 0x25, 0x2E, 0x6D,
+    0xBA, 0xC9, 0x84, 0xCB, 0xFB, 0x64, 0xA8, 0x67, 0xDF, 0xBD, 0x12, 0x61, 0x25, 0x3D, 0x94, 0xF2,
+    0xD6, 0xC6, 0xBE, 0xFC, 0x4C, 0xFE, 0xDE, 0x3B, 0x30, 0x97, 0x9E, 0xFC, 0xAD, 0x2B, 0x9E, 0x05,
+    0xB6, 0x36, 0x6E, 0x54, 0x4E, 0xCB, 0x86, 0x98, 0x05, 0x8C, 0x3B, 0xC3, 0x4B, 0xD3, 0xEA, 0x6A,
+    0xC6, 0x6D, 0xB3, 0x4A, 0x9B, 0xEB, 0x3F, 0xBC, 0x12, 0xD0, 0x32, 0x40, 0xB5, 0x3E, 0x9D, 0x3D,
+    0x91, 0x35, 0x28, 0x91, 0x35, 0x64, 0xC9, 0xD7, 0xE3, 0x89, 0xA0, 0x3B, 0x22, 0xE4, 0x6D, 0xF2,
+    0xF0, 0x64, 0x81, 0xA4, 0x05, 0x53, 0x36, 0xC9, 0xBD, 0x93, 0x76, 0x52, 0xF2, 0xF1, 0x24, 0xDF,
+    0x8E, 0x71, 0x10, 0x4F, 0x8F, 0xAA, 0xA7, 0x6C, 0xD0, 0x61, 0xDC, 0x76, 0x16, 0x8A, 0xEE, 0x54,
+    0xEF, 0xAA, 0x1A, 0x96, 0x3C, 0x2C, 0xB0, 0xBA, 0x66, 0x07, 0x90, 0xCE, 0x06, 0x90, 0x76, 0x6B,
+    0xE3, 0x5A, 0x2B, 0xCF, 0xA8, 0x4F, 0xCB, 0x33, 0xCA, 0x68, 0x7F, 0x7E, 0xED, 0xA9, 0x55, 0x0F,
+    0x46, 0x22, 0xD8, 0x3F, 0xEB, 0x61, 0xAE, 0x02, 0xC4, 0xCC, 0xA7, 0x80, 0x6C, 0xE6, 0xB5, 0x4F,
+    0xD6, 0x43, 0xDE, 0x16, 0x6D, 0x8A, 0xF9, 0x9A, 0xD1, 0xC1, 0xD6, 0x24, 0x07, 0xDB, 0x8C, 0xAA,
+    0x26, 0x62, 0xF9, 0xB5, 0x1E, 0xFB, 0xD4, 0xDC, 0x33, 0xF7, 0xF3, 0x26, 0xF9, 0xD9, 0x74, 0x3B,
+    0x75, 0xC6, 0xD4, 0x93, 0x0E, 0xB3, 0x7B, 0xC6, 0x2C, 0xFB, 0x1B, 0xF2, 0x47, 0x2E, 0xD3, 0x0D,
+    0x29, 0x1C, 0x32, 0xB1, 0xC4, 0xA4, 0xF5, 0xCF, 0x99, 0x38, 0x69, 0xDE, 0xC3, 0xBF, 0x7A, 0x46,
+    0xA0, 0x90, 0xE4, 0x45, 0x39, 0x3A, 0xB3, 0xD6, 0x7E, 0x99, 0xAE, 0xC9, 0xE4, 0x61, 0xB3, 0x67,
+    0xAC, 0x27, 0x22, 0x29, 0x7E, 0x38, 0x32, 0xF6, 0x0E, 0xDE, 0x5E, 0x39, 0x10, 0x01, 0x56, 0x9B,
+    0xE9, 0xFB, 0x9B, 0x77, 0xE6, 0xB6, 0x9B, 0xB9, 0x34, 0xF5, 0x46, 0x19, 0x9D, 0x6D, 0x64, 0x5D,
+    0xD6, 0x4F, 0xFE, 0x9F, 0xBF, 0x2E, 0x67, 0x6E, 0xF7, 0xF3, 0x16, 0xD9, 0x69, 0xD0, 0xEE, 0xE7,
+    0xAA, 0xAD, 0xF1, 0x97, 0xA1, 0xAE, 0xAB, 0xEB, 0x0E, 0x8C, 0x4C, 0x2A, 0xFB, 0x29, 0x16, 0xE0,
+    0x5E, 0xB5, 0x7D, 0xDC, 0x9A, 0x8B, 0xA4, 0xD0, 0x4E, 0xAA, 0x7A, 0x16, 0x96, 0x68, 0xBF, 0xA0,
+    0xF0, 0x03, 0xA5, 0x3F, 0x61, 0xD5, 0xCD, 0xDF, 0xFD, 0xB8, 0xAD, 0xE4, 0x15, 0x77, 0xE1, 0xCE,
+    0xA4, 0xA6, 0x8F, 0x01, 0x7F, 0x35, 0x4F, 0xD6, 0xB1, 0x59, 0xDF, 0x8B, 0x05, 0xB0, 0x67, 0x62,
+    0x99, 0x55, 0x0B, 0x45, 0xC4, 0x76, 0x60, 0x22, 0xD6, 0x43, 0xD5, 0x33, 0xF7, 0x60, 0x03, 0x27,
+    0x1E, 0xD6, 0x9E, 0xC1, 0xA3, 0x3E, 0xF2, 0xC4, 0x80, 0xFE, 0xC0, 0xD3, 0x07, 0xF2, 0xD7, 0x3B,
+    0x15, 0x7A, 0xCC, 0x0F, 0xDB, 0xCC, 0xF7, 0x94, 0x85, 0xD3, 0x3E, 0xB2, 0x6B, 0x9C, 0xF6, 0x0B,
+    0x16, 0xC6, 0xE9, 0x6E, 0x41, 0x5F, 0x36, 0x79, 0x7B, 0x90, 0xF9, 0xAA, 0x2E, 0xDC, 0xA1, 0x6E,
+    0x2D, 0xC6, 0xED, 0x18, 0x67, 0x31, 0xCD, 0x4E, 0x59, 0xEF, 0x52, 0x36, 0xBB, 0x96, 0x19, 0x55,
+    0xBD, 0x7B, 0xC8, 0x92, 0x8A, 0xAA, 0x27, 0x62, 0xA9, 0x3C, 0x91, 0x5D, 0xCA, 0x4E, 0xAD, 0x8F,
+    0x0E, 0x29, 0x9D, 0x12, 0xB7, 0xC0, 0x34, 0x59, 0xF2, 0xB5, 0x4E, 0x94, 0xB1, 0xE7, 0x9C, 0x37,
+    0x69, 0x02, 0xD3, 0xC6, 0x4C, 0x42, 0x60, 0xD4, 0x92, 0x6A, 0x4C, 0xC8, 0xD6, 0x30, 0x77, 0x26,
+    0xA2, 0x85, 0x5D, 0x4F, 0xD5, 0xF3, 0x91, 0xE3, 0xA3, 0x36, 0x7F, 0x85, 0xE2, 0x8D, 0xBA, 0xDA,
+    0x61, 0x67, 0x41, 0x1F, 0xF4, 0x9B, 0x5E, 0xFF, 0xB8, 0x2B, 0x4D, 0x63, 0xBE, 0xE2, 0xFA, 0x1D,
+    0x0E, 0xCA, 0xFC, 0x96, 0xCF, 0xFC, 0xC1, 0x6E, 0xE1, 0x4C, 0xF3, 0x33, 0x6F, 0xD9, 0xD1, 0x6F,
+    0xD4, 0xBD, 0xF2, 0x26, 0xE6, 0x6D, 0xE1, 0xAA, 0xB6, 0xFC, 0xFD, 0x8A, 0x13, 0x56, 0x6D, 0xAF,
+    0xBC, 0x96, 0x53, 0x8F, 0x51, 0xEE, 0x36, 0x6B, 0x4A, 0x9D, 0x31, 0xDC, 0x97, 0x7F, 0xAD, 0xFA,
+    0xD3, 0x83, 0xCD, 0x83, 0x35, 0x99, 0xCF, 0x5B, 0x98, 0x3D, 0xE3, 0xC1, 0x88, 0x07, 0xAE, 0x1C,
+    0x9D, 0x67, 0xDE, 0x11, 0x60, 0x55, 0x03, 0xB6, 0x1D, 0x17, 0x1F, 0xE5, 0x0C, 0x30, 0xAF, 0x38,
+    0xC8, 0xDF, 0xF4, 0xA0, 0xFD, 0x02, 0x54, 0x5F, 0x91, 0xCC, 0x95, 0xE4, 0xBC, 0xB0, 0xCC, 0x48,
+    0x3C, 0xDC, 0x38, 0xED, 0x29, 0x44, 0x22, 0xB9, 0x88, 0xA0, 0xEF, 0x1E, 0x5F, 0x77, 0x2A, 0x26,
+    0x7F, 0x44, 0xE2, 0x94, 0x65, 0x63, 0x21, 0xEF, 0xAA, 0x26, 0xED, 0x1C, 0x6C, 0xD1, 0x81, 0x71,
+    0xE4, 0xAE, 0x68, 0x38, 0xA0, 0x47, 0xFB, 0x39, 0x54, 0xE2, 0x3E, 0xD1, 0xBD, 0x55, 0xB7, 0x8D,
+    0x95, 0x97, 0x9D, 0xF9, 0x70, 0x16, 0x75, 0x8F, 0x34, 0x2B, 0xF2, 0x30, 0x62, 0x8B, 0xB4, 0xB7,
+    0x35, 0x56, 0xFB, 0xB4, 0x0F, 0x97, 0x79, 0x97, 0xCC, 0x9C, 0x98, 0x77, 0xD8, 0x66, 0x46, 0x11,
+    0xB4, 0xCF, 0xA4, 0xB6, 0xB7, 0xD6, 0x5E, 0xC9, 0xBA, 0x22, 0x97, 0x27, 0x3A, 0x54, 0x6A, 0xB6,
+    0x7E, 0x80, 0x64, 0x73, 0x69, 0x6F, 0x21, 0x6B, 0x2F, 0xDD, 0x47, 0x9D, 0xDA, 0x50, 0x45, 0x6A,
+    0xD0, 0xD2, 0x40, 0xFE, 0x46, 0x33, 0x12, 0xA5, 0xFC, 0x8E, 0x03, 0x5B, 0x38, 0x98, 0x15, 0x2E,
+    0xD1, 0x24, 0x0B, 0xF9, 0xE8, 0x23, 0x2B, 0x5A, 0xDD, 0x25, 0x92, 0x54, 0x22, 0x9E, 0xB9, 0x88,
+    0x67, 0x7D, 0xFC, 0x82, 0x57, 0x31, 0x05, 0xD4, 0xB2, 0x90, 0x77, 0xC9, 0x08, 0x54, 0x7D, 0xD5,
+    0x8C, 0x31, 0xB7, 0x78, 0x92, 0x66, 0xA2, 0x7E, 0x00, 0x76, 0x75, 0x47, 0xDE, 0xCD, 0x60, 0x5B,
+    0xBB, 0x4F, 0xF4, 0xEA, 0xAF, 0x89, 0x1E, 0x99, 0x88, 0xF4, 0x63, 0x68, 0xA6, 0x4B, 0x4A, 0xA0,
+    0xD4, 0x60, 0x5E, 0x4D, 0x1B, 0x66, 0x36, 0x19, 0xEF, 0xC9, 0x77, 0x52, 0x3D, 0x11, 0x00, 0x54,
+    0x9C, 0x6C, 0x92, 0xB4, 0xE5, 0x4E, 0x92, 0x53, 0x34, 0xF7, 0xC5, 0xDD, 0xE3, 0x6B, 0x60, 0xEB,
+    0x4A, 0xC4, 0x91, 0xF5, 0x49, 0xB7, 0x49, 0x7A, 0x0B, 0x48, 0x0A, 0x8D, 0x8C, 0x16, 0x0E, 0xF6,
+    0xF8, 0x85, 0x90, 0x14, 0x0A, 0xE3, 0x92, 0xC2, 0x66, 0x01, 0x86, 0xD1, 0x19, 0xD7, 0x25, 0x7F,
+    0xDC, 0x1C, 0xEC, 0xF1, 0x71, 0xA3, 0x03, 0x88, 0x08, 0x95, 0xDB, 0xA8, 0xE4, 0x89, 0x2A, 0xED,
+    0x8B, 0xAB, 0x8E, 0xB9, 0x7C, 0x75, 0x2E, 0xCE, 0x7C, 0x38, 0x93, 0xD7, 0x06, 0xDD, 0x2B, 0xE9,
+    0xF2, 0x6E, 0x85, 0xE9, 0x99, 0x19, 0x87, 0x50, 0xFC, 0xA8, 0xC7, 0xB4, 0x2A, 0xDA, 0x9A, 0x78,
+    0x41, 0xB4, 0xC7, 0x88, 0x38, 0x8B, 0x12, 0x39, 0xCA, 0x3B, 0xAA, 0x23, 0x98, 0xA1, 0x03, 0xE4,
+    0x1D, 0xAB, 0x06, 0x66, 0x94, 0x11, 0xB4, 0xCF, 0xA5, 0x05, 0xFB, 0xAD, 0x8F, 0xA4, 0xF9, 0x27,
+    0x4A, 0xE2, 0x4C, 0xA4, 0xCD, 0xD7, 0xF9, 0xEF, 0x49, 0x60, 0x2B, 0x69, 0xB8, 0xEA, 0x5A, 0x76,
+    0x8D, 0x92, 0x5D, 0xD4, 0xF0, 0xAC, 0xA3, 0x10, 0x0F, 0x8F, 0xBC, 0x75, 0x3A, 0x5F, 0x99, 0xC8,
+    0x80, 0x9D, 0x30, 0x55, 0x1B, 0x37, 0xEE, 0x62, 0x62, 0x00, 0xF1, 0x1C, 0xF2, 0xED, 0x9D, 0xE3,
+    0x5A, 0x8B, 0x04, 0xAC, 0x48, 0xBD, 0xC1, 0x5E, 0x9D, 0xBB, 0x4E, 0x85, 0x73, 0xFE, 0xE1, 0xE3,
+    0xE3, 0x26, 0x4F, 0xC2, 0x45, 0x1A, 0x30, 0x4D, 0x59, 0xEB, 0xAE, 0x70, 0x2C, 0x8B, 0x36, 0x41,
+    0x02, 0xFE, 0xE7, 0xE6, 0xB4, 0x2B, 0xD5, 0x1A, 0xAC, 0x78, 0xEC, 0x6B, 0x03, 0xB6, 0x29, 0x9B,
+    0xAA, 0xC9, 0x3B, 0xE3, 0xB2, 0x90, 0x77, 0x2A, 0xEA, 0xF0, 0xC8, 0x40, 0x42, 0x51, 0xBD, 0x45,
+    0x79, 0x94, 0x38, 0x8F, 0xEA, 0x27, 0x2F, 0x7E, 0x0B, 0x6A, 0xAD, 0x6E, 0x50, 0xC9, 0x80, 0x92,
+    0x61, 0x0C, 0xAB, 0xA7, 0x40, 0x92, 0xDC, 0x21, 0x3D, 0x5E, 0xFE, 0xC5, 0xCA, 0x73, 0x8D, 0xA2,
+    0x9F, 0x02, 0x4B, 0x0C, 0xF7, 0x8B, 0x84, 0xA4, 0x3F, 0xD5, 0x75, 0x59, 0x33, 0x17, 0x59, 0x6B,
+    0x59, 0x1F, 0x0F, 0xE6, 0x0E, 0x44, 0xEB, 0xC8, 0xFA, 0x39, 0xE8, 0x70, 0x02, 0x85, 0x3F, 0x81,
+    0xD2, 0x9D, 0xC0, 0xBC, 0x99, 0x93, 0xAD, 0xB1, 0x6F, 0x5F, 0xE9, 0x29, 0x45, 0x5A, 0x32, 0x19,
+    0x38, 0xB5, 0xD7, 0x95, 0xF4, 0x58, 0x89, 0xDC, 0x79, 0x3A, 0xAA, 0x69, 0xFE, 0x36, 0x60, 0xB1,
+    0xC8, 0x15, 0xE9, 0x4A, 0x91, 0x6F, 0xC9, 0x77, 0x87, 0xB2, 0xD5, 0x3E, 0x52, 0x3E, 0xDF, 0x11,
+    0x8D, 0x33, 0xAD, 0xFD, 0xE6, 0x9A, 0xB9, 0x74, 0xCC, 0x87, 0x31, 0xEC, 0xF0, 0x00, 0x75, 0xDA,
+    0x79, 0xCC, 0xF2, 0xEE, 0x7E, 0x5B, 0xEF, 0x6F, 0x76, 0xA8, 0x8A, 0x8B, 0x14, 0x6E, 0x81, 0x71,
+    0x91, 0xBC, 0xB9, 0x7A, 0xDE, 0xE2, 0x5F, 0xA3, 0x45, 0x9C, 0x7E, 0xFB, 0x59, 0x9F, 0x68, 0xA0,
+    0xFA, 0x33, 0xF8, 0xC0, 0xC8, 0x23, 0xD2, 0x2B, 0x91, 0xBE, 0x58, 0x3F, 0x1D, 0xCA, 0x56, 0x7B,
+    0x4B, 0xDE, 0xED, 0x62, 0x9C, 0xC5, 0xD6, 0xF6, 0x9B, 0x6B, 0x4A, 0xE9, 0xC9, 0xA5, 0x4D, 0x5E,
+    0xE4, 0x91, 0x39, 0x02, 0x99, 0xAF, 0x46, 0xDD, 0x27, 0x6D, 0xEF, 0xFB, 0x72, 0xC9, 0xFF, 0x1F,
+    0xD9, 0xDC, 0x8A, 0x8B, 0xC0, 0xB8, 0x06, 0x40, 0xF5, 0xC9, 0xBF, 0xA2, 0xDD, 0xF6, 0xA7, 0x8F,
+    0xFA, 0x6F, 0xA3, 0xCD, 0x9D, 0x56, 0x72, 0x30, 0x35, 0x45, 0x77, 0x02, 0x86, 0x4F, 0x02, 0xCE,
+    0x2E, 0xC8, 0x00, 0x56, 0x04, 0xD6, 0xCF, 0x08, 0xA0, 0x86, 0x49, 0xCF, 0xCE, 0xBB, 0xB3, 0x3A,
+    0xE9, 0x84, 0x78, 0xFC, 0xE2, 0x75, 0x8F, 0x92, 0x3B, 0x09, 0xC0, 0x30, 0x2E, 0x78, 0xD5, 0x9F,
+    0x83, 0xB2, 0x5A, 0x46, 0x5B, 0xD7, 0x74, 0xC0, 0x8A, 0xD9, 0xFE, 0x95, 0xA0, 0x44, 0xA4, 0xCE,
+    0x44, 0xBA, 0x33, 0xCE, 0xB5, 0x83, 0xDC, 0x65, 0xA1, 0xAA, 0x3F, 0xB1, 0x80, 0xAF, 0x48, 0x9D,
+    0x8B, 0x34, 0xE6, 0xBB, 0xAB, 0x1A, 0x4E, 0x52, 0xE3, 0x09, 0xAF, 0xA0, 0x9E, 0x09, 0x54, 0x6B,
+    0x90, 0x98, 0x9E, 0x9B, 0x8D, 0x1B, 0xBC, 0xAC, 0x21, 0x7E, 0xBE, 0x2E, 0x3B, 0x2B, 0xC2, 0x5C,
+    0xDA, 0xE4, 0x1E, 0xB4, 0x22, 0x1E, 0x11, 0x71, 0xB9, 0xC8, 0x7A, 0xEA, 0xCC, 0xE6, 0xC3, 0x30,
+    0x59, 0x65, 0x9B, 0x0F, 0x6B, 0x20, 0x97, 0x0E, 0x2A, 0xF1, 0x67, 0xC3, 0x54, 0x29, 0xC0, 0x7B,
+    0x32, 0x51, 0xC5, 0x24, 0x09, 0x54, 0x93, 0x07, 0xFD, 0xA1, 0x92, 0xC6, 0x88, 0xF4, 0x14, 0xB2,
+    0x9E, 0x6C, 0x39, 0x23, 0xE2, 0x95, 0xC8, 0x9A, 0x2F, 0x1C, 0x5F, 0x6F, 0x47, 0x5D, 0x73, 0x39,
+    0xB2, 0xE9, 0xA2, 0x1D, 0x79, 0xFB, 0xC9, 0xD8, 0x6C, 0x11, 0x00, 0x09, 0xF0, 0xA0, 0x74, 0x49,
+    0x0D, 0x1D, 0x09, 0xD7, 0x4E, 0x50, 0xDB, 0xF6, 0x93, 0x7C, 0xDF, 0xD6, 0x17, 0x31, 0x5E, 0xDF,
+    0xF9, 0xDD, 0x88, 0x95, 0x35, 0xAC, 0xD6, 0x00, 0x17, 0x8E, 0xBF, 0x4F, 0x62, 0xE8, 0x30, 0xA2,
+    0x0D, 0xCE, 0xC2, 0x83, 0x2B, 0xA7, 0x3D, 0x4A, 0x28, 0x1B, 0x4C, 0xCF, 0x12, 0xA4, 0xCD, 0x02,
+    0x85, 0x60, 0x1C, 0xB3, 0x88, 0x45, 0x7F, 0xD0, 0xA9, 0x1E, 0x5B, 0x36, 0x45, 0x9B, 0x85, 0x25,
+    0x96, 0xF2, 0x79, 0x4F, 0xA4, 0x37, 0x4E, 0x7B, 0xE3, 0x66, 0x94, 0xCD, 0x22, 0x0B, 0x2C, 0xF3,
+    0xB6, 0x70, 0xDA, 0xEF, 0x62, 0x31, 0xB7, 0x3D, 0x91, 0x59, 0x45, 0xDE, 0x65, 0x1F, 0x06, 0xAA,
+    0xBA, 0x78, 0xA3, 0x21, 0x62, 0x23, 0xDA, 0x23, 0x8E, 0xB2, 0xC9, 0x07, 0x98, 0x51, 0x75, 0x64,
+    0x01, 0x49, 0x03, 0xC8, 0x8E, 0x7F, 0x00, 0x73, 0xE9, 0xC8, 0x93, 0xB8, 0x3F, 0x35, 0x5D, 0xB4,
+    0x4F, 0x8A, 0x43, 0xD4, 0x9E, 0xB2, 0x99, 0xA1, 0x42, 0xD1, 0x52, 0x9D, 0xC7, 0x8E, 0x97, 0x35,
+    0xCB, 0x2C, 0x60, 0x9C, 0x45, 0x45, 0xED, 0xB1, 0x8D, 0xDD, 0xA8, 0x31, 0xDF, 0xBC, 0x9B, 0xD4,
+    0x98, 0x42, 0x9E, 0xEC, 0xC6, 0xC0, 0x71, 0xDA, 0xC1, 0x55, 0x0A, 0x63, 0x1A, 0x07, 0xAA, 0x7B,
+    0xF4, 0x3E, 0x9B, 0xB6, 0x18, 0xD9, 0x01, 0xA5, 0x57, 0x3D, 0x48, 0x53, 0xB4, 0x98, 0x81, 0xAA,
+    0x66, 0xE5, 0x89, 0xE4, 0xEF, 0x39, 0xED, 0xB1, 0xBB, 0x94, 0x8D, 0x7E, 0xBF, 0x67, 0x49, 0xF5,
+    0x95, 0x56, 0x7B, 0xD5, 0x5B, 0x8C, 0x33, 0x4D, 0xC4, 0x12, 0xF3, 0x4E, 0xF5, 0x85, 0xAB, 0xEA,
+    0xA2, 0x3D, 0x64, 0x81, 0xD5, 0x9D, 0xF6, 0x44, 0x8B, 0x71, 0xF9, 0x4F, 0x3D, 0x33, 0xAA, 0x67,
+    0xEB, 0x2C, 0xB0, 0xEC, 0x31, 0x4E, 0x8B, 0xC3, 0x62, 0x22, 0xAA, 0x67, 0xDE, 0x92, 0x77, 0xD9,
+    0x1A, 0xAA, 0xDA, 0x8C, 0xC0, 0x15, 0xEA, 0x07, 0x52, 0x4C, 0x40, 0x7B, 0x0B, 0x97, 0xB2, 0xF6,
+    0x7C, 0x4F, 0xFF, 0x3A, 0xE9, 0xA4, 0xBB, 0x9D, 0x89, 0xC9, 0xDD, 0x47, 0xD6, 0xA5, 0x0D, 0x9F,
+    0x8B, 0x74, 0x14, 0xEB, 0x3F, 0x12, 0x8A, 0x9E, 0xB2, 0xCB, 0x03, 0x2A, 0xEA, 0x00, 0xF6, 0x89,
+    0x1E, 0x8A, 0x2E, 0x82, 0x8A, 0x27, 0x13, 0x52, 0xCD, 0xBC, 0xE2, 0x40, 0x7F, 0xE4, 0x41, 0x0D,
+    0x3D, 0x30, 0x3F, 0x01, 0xAA, 0xEB, 0x0D, 0x98, 0x9F, 0x74, 0x90, 0xFF, 0xAC, 0x87, 0x2C, 0xCE,
+    0x81, 0xC1, 0x38, 0x10, 0x1D, 0x61, 0xC5, 0xBC, 0x41, 0xEA, 0x62, 0xFD, 0x35, 0x69, 0x58, 0x89,
+    0xD4, 0xA3, 0xC8, 0x53, 0x7B, 0x63, 0x37, 0x33, 0x5F, 0xA5, 0xB9, 0xBC, 0x7C, 0x0F, 0x6D, 0xD6,
+    0x09, 0x96, 0x32, 0x7F, 0x4D, 0xB0, 0x4D, 0xD1, 0x55, 0x0D, 0xD1, 0x38, 0x6C, 0xD1, 0x62, 0x6E,
+    0x7B, 0xB4, 0x8F, 0x10, 0x67, 0x29, 0x22, 0x5C, 0xFE, 0x5E, 0x47, 0xF1, 0xA3, 0x1E, 0xED, 0x2D,
+    0x59, 0x6F, 0x5A, 0x15, 0xD5, 0xFA, 0x3F, 0x1E, 0x46, 0x75, 0xA6, 0x07, 0xEA, 0x33, 0x18, 0x8B,
+    0x23, 0x98, 0xCB, 0x1A, 0x56, 0xFF, 0x76, 0xE5, 0x59, 0x35, 0x6A, 0xCD, 0xBC, 0xA6, 0x74, 0xB6,
+    0x46, 0x87, 0xAA, 0x81, 0x13, 0xE3, 0xA0, 0xFC, 0x61, 0x07, 0xFA, 0x83, 0x00, 0xC4, 0xF5, 0xFE,
+    0xFE, 0xFE, 0x6A, 0x2E, 0x23, 0x6E, 0x42, 0x3E, 0xEE, 0x20, 0xBB, 0xDB, 0x03, 0xC3, 0x09, 0x30,
+    0xAF, 0x1A, 0xA8, 0x5E, 0xF6, 0x60, 0xDA, 0x08, 0xC6, 0x5B, 0x47, 0xE1, 0xF3, 0x1E, 0x13, 0x58,
+    0xBD, 0x7D, 0xA5, 0xA7, 0x10, 0x09, 0x09, 0x7E, 0x72, 0x8A, 0x73, 0x41, 0x49, 0x47, 0x2E, 0x52,
+    0xE7, 0xC3, 0xB3, 0x5E, 0xF7, 0x9C, 0x64, 0x3D, 0xC6, 0x45, 0xB4, 0x3F, 0x81, 0xA5, 0xFD, 0xEE,
+    0xFE, 0xDC, 0x88, 0xC8, 0xCB, 0x22, 0xF2, 0x7E, 0x8F, 0xEA, 0x67, 0xB0, 0x2C, 0x1B, 0xAC, 0xF6,
+    0x54, 0xCD, 0x40, 0xE9, 0xCA, 0xEE, 0x8A, 0x53, 0x22, 0x2D, 0xA5, 0x34, 0xF0, 0xC0, 0x46, 0xBF,
+    0x31, 0x4D, 0x4F, 0x32, 0x2D, 0xF0, 0x86, 0x5F, 0xCA, 0xA4, 0xBF, 0xBD, 0xBF, 0xFF, 0xCC, 0x47,
+    0x22, 0x22, 0x83, 0x88, 0x88, 0xFC, 0x32, 0x26, 0x5D, 0x7B, 0x9B, 0x26, 0xFD, 0xD2, 0xFD, 0x27,
+    0x3D, 0xDC, 0x3B, 0xE9, 0x1D, 0xC5, 0xAB, 0x77, 0xF6, 0x9F, 0xF6, 0x22, 0x12, 0xE7, 0x22, 0xF2,
+    0x29, 0x93, 0x7E, 0x21, 0x52, 0x9E, 0x9F, 0xF4, 0xFA, 0x81, 0x51, 0xD3, 0xD1, 0xDE, 0xDE, 0x9F,
+    0x61, 0x5C, 0x91, 0xB7, 0x46, 0xF7, 0xEC, 0xFA, 0x0F, 0xA4, 0x99, 0x00, 0xDA, 0xB9, 0x9F, 0xDC,
+    0x0A, 0x59, 0x98, 0xE4, 0xE1, 0x74, 0x78, 0xF0, 0xF8, 0x85, 0x9E, 0x11, 0x6F, 0x2D, 0x9B, 0xF0,
+    0x6F, 0xEE, 0xA7, 0x58, 0x8E, 0x71, 0x9B, 0x28, 0x4B, 0x3D, 0x89, 0xA1, 0xC8, 0x7F, 0xB5, 0xBF,
+    0xF2, 0xCC, 0x13, 0x3C, 0xB5, 0x07, 0xF6, 0xA7, 0x59, 0xEB, 0x4D, 0x93, 0x77, 0xB3, 0x4F, 0x0A,
+    0xF2, 0x2B, 0x6B, 0x72, 0x91, 0xDA, 0xFC, 0x81, 0x8C, 0x4D, 0xC4, 0x11, 0xF1, 0xE3, 0xB6, 0xF6,
+    0xE7, 0xCC, 0x25, 0x66, 0x22, 0x63, 0xDE, 0xC4, 0x2C, 0x75, 0xD2, 0x38, 0x18, 0xF4, 0xD1, 0x95,
+    0xCE, 0xC8, 0x9A, 0x4A, 0xDA, 0x51, 0x8B, 0xFF, 0xE2, 0xF1, 0x11, 0xE4, 0xB2, 0x06, 0xE6, 0xD2,
+    0x7E, 0x82, 0xFD, 0x10, 0x55, 0x0F, 0x55, 0x63, 0x1C, 0xB9, 0x27, 0xC2, 0x40, 0xD1, 0x6E, 0xB4,
+    0x27, 0xED, 0x39, 0x21, 0x29, 0x58, 0x2A, 0x64, 0x01, 0x4C, 0x63, 0x19, 0x81, 0x20, 0xC5, 0xAD,
+    0x9E, 0x11, 0x09, 0xA2, 0xFF, 0xBC, 0x65, 0x84, 0xFE, 0x64, 0x52, 0x4F, 0x48, 0x28, 0x15, 0x19,
+    0x93, 0x28, 0x28, 0xFC, 0xA4, 0x57, 0x7C, 0x4D, 0x6A, 0x30, 0xD2, 0x32, 0xC2, 0x3C, 0x27, 0x43,
+    0xE3, 0x0B, 0xC7, 0xD7, 0x40, 0x8B, 0x6C, 0x44, 0xDE, 0xE9, 0x9A, 0xED, 0x21, 0x62, 0x9A, 0xE4,
+    0x41, 0x4E, 0x7E, 0xF7, 0x01, 0x22, 0xA5, 0x4B, 0x50, 0x11, 0x0E, 0x99, 0x4D, 0x98, 0x8D, 0xDD,
+    0x84, 0x8B, 0xB2, 0x80, 0xCD, 0x3B, 0x92, 0x5F, 0x9F, 0xAA, 0xAC, 0x41, 0x7D, 0xE0, 0x81, 0xF2,
+    0x10, 0x40, 0x1C, 0x60, 0xC2, 0x26, 0x42, 0x67, 0xDC, 0x06, 0xF2, 0x63, 0x37, 0xE8, 0x39, 0x15,
+    0x81, 0x7F, 0x7F, 0xC5, 0x08, 0x46, 0x4F, 0xE8, 0x8A, 0x69, 0xA3, 0x8D, 0xCF, 0xD0, 0xFE, 0x53,
+    0xF4, 0xE6, 0xBF, 0x45, 0xA4, 0x55, 0x5C, 0x04, 0x15, 0xCA, 0x7A, 0x34, 0xEC, 0xEF, 0x2B, 0x34,
+    0xFF, 0xD6, 0x51, 0x99, 0xDF, 0xBC, 0xD0, 0x80, 0xB9, 0x15, 0x21, 0x0B, 0x16, 0x38, 0x34, 0x0E,
+    0x4C, 0xD6, 0x41, 0xD6, 0x3C, 0x76, 0xAE, 0xEB, 0x81, 0x14, 0x9D, 0xC9, 0x7A, 0xE2, 0x08, 0xB6,
+    0x31, 0x2D, 0x4B, 0x54, 0x24, 0x4F, 0x18, 0x1F, 0x8A, 0x2E, 0x01, 0x3D, 0x28, 0xEB, 0xAA, 0x86,
+    0x3E, 0x6D, 0xA4, 0x81, 0x11, 0xCF, 0x94, 0xBF, 0xEA, 0x81, 0xDD, 0x43, 0x46, 0x40, 0x3A, 0x55,
+    0x00, 0xD4, 0x7A, 0x13, 0x62, 0x4A, 0xF1, 0x90, 0x15, 0xE3, 0xBE, 0xDE, 0xBA, 0x12, 0x00, 0x19,
+    0x48, 0x0E, 0xD6, 0x8D, 0x65, 0x05, 0x5F, 0xC8, 0x8E, 0x20, 0xEF, 0x06, 0x20, 0x96, 0x35, 0xEC,
+    0xEA, 0x16, 0x8A, 0x26, 0x80, 0x6A, 0xBF, 0x74, 0x7E, 0x85, 0x34, 0x18, 0x47, 0x3F, 0x42, 0x69,
+    0x2C, 0x09, 0x4E, 0x6F, 0x9C, 0x8A, 0xB0, 0x48, 0x88, 0xDE, 0xBC, 0x83, 0x59, 0x8A, 0x12, 0x95,
+    0x53, 0x0E, 0x44, 0xF2, 0xD1, 0x54, 0xC6, 0x41, 0xF6, 0x7E, 0x00, 0x4A, 0x0B, 0xA8, 0x8F, 0x5A,
+    0xC0, 0x44, 0xA6, 0x0C, 0x0F, 0xD3, 0x6D, 0x3C, 0x7F, 0x29, 0x72, 0xE1, 0x37, 0x06, 0x6C, 0xE9,
+    0x20, 0x7B, 0xC6, 0x03, 0x76, 0x80, 0x4D, 0xA6, 0x4E, 0xFD, 0x40, 0x52, 0xAD, 0xB4, 0xB7, 0xF0,
+    0xA8, 0xFA, 0x04, 0x4C, 0xF4, 0x10, 0x76, 0x8D, 0x23, 0xEF, 0x22, 0x2C, 0x4D, 0x83, 0xB9, 0xD5,
+    0x43, 0xAC, 0x6A, 0xCC, 0x6D, 0x8F, 0xEA, 0x2D, 0x54, 0x4F, 0x76, 0xC9, 0xC9, 0x67, 0xB5, 0x47,
+    0x77, 0xB6, 0xE1, 0x44, 0xC9, 0xB1, 0xB4, 0x85, 0x48, 0xA4, 0x90, 0xEB, 0xF7, 0x07, 0xBF, 0xF9,
+    0x4F, 0x82, 0xDF, 0x8C, 0x4B, 0x3B, 0xCC, 0x6A, 0x8F, 0xD5, 0xFE, 0x93, 0x22, 0xC2, 0x34, 0xCC,
+    0x46, 0xB4, 0xC7, 0xE8, 0x1C, 0x57, 0xD1, 0x92, 0xDD, 0x07, 0xC3, 0xF2, 0x7A, 0x97, 0xDD, 0x99,
+    0x70, 0x29, 0xE7, 0x32, 0xE1, 0x92, 0x07, 0xFC, 0x17, 0xCF, 0x2B, 0xFB, 0xD4, 0xEE, 0xDE, 0x27,
+    0xBD, 0xF1, 0x6E, 0x0D, 0xF3, 0x00, 0xB9, 0x70, 0x66, 0xB4, 0xF7, 0xA6, 0xDB, 0x6D, 0xF1, 0x57,
+    0xE6, 0xC9, 0xE9, 0x11, 0xF4, 0x79, 0x78, 0xCA, 0xE4, 0xA7, 0x3C, 0xB9, 0xB7, 0x13, 0xFE, 0x4E,
+    0xDA, 0x0D, 0x42, 0x74, 0xBA, 0x78, 0x79, 0x2E, 0x0F, 0xE9, 0xA2, 0x62, 0x03, 0x4B, 0x4B, 0x8A,
+    0x33, 0xA6, 0x0E, 0xF7, 0x35, 0x78, 0x33, 0x0F, 0x1C, 0x62, 0x99, 0x82, 0x45, 0x29, 0x26, 0x93,
+    0x02, 0x2D, 0x63, 0xBC, 0x28, 0xC5, 0x5A, 0xC8, 0xFC, 0xE8, 0x40, 0x4A, 0x33, 0xAA, 0xEF, 0x3E,
+    0x05, 0x33, 0xAC, 0xF4, 0x14, 0xAD, 0x16, 0xF1, 0x44, 0x66, 0x6A, 0xD5, 0x18, 0x57, 0xB4, 0x2A,
+    0x12, 0x89, 0x98, 0xB6, 0x6C, 0x8C, 0x63, 0x99, 0x05, 0xD5, 0x63, 0x5A, 0x4B, 0x59, 0x13, 0xB5,
+    0xCF, 0x02, 0xA5, 0x9B, 0x61, 0xD1, 0x21, 0x6F, 0xB5, 0x47, 0x58, 0x32, 0x3F, 0x16, 0x67, 0x5C,
+    0x91, 0x9A, 0x11, 0xE9, 0x36, 0xA8, 0xFB, 0x64, 0x64, 0x42, 0x16, 0xAA, 0x9A, 0x7B, 0x3C, 0x25,
+    0x9B, 0xC5, 0xCA, 0x61, 0xE6, 0x49, 0x41, 0x9A, 0xD1, 0x7F, 0x69, 0x55, 0x0F, 0xF4, 0x45, 0x0B,
+    0x79, 0x6B, 0xB7, 0xA0, 0xAA, 0x45, 0x3A, 0xA2, 0x16, 0xF1, 0xDA, 0x97, 0x47, 0x65, 0x57, 0x36,
+    0x4B, 0x8C, 0x3B, 0xCC, 0x3C, 0x36, 0xF3, 0xC6, 0x11, 0x8D, 0xAB, 0xD0, 0xDE, 0x72, 0x42, 0xF5,
+    0xCD, 0x9E, 0x21, 0x8B, 0x45, 0x9B, 0x89, 0xB4, 0x15, 0x4A, 0x7A, 0xE2, 0xB4, 0xEB, 0x0B, 0x11,
+    0x9F, 0xF0, 0x8E, 0x22, 0x72, 0x06, 0x3B, 0xB7, 0xF8, 0xF4, 0x64, 0xD0, 0x5C, 0xC4, 0x51, 0x89,
+    0xC0, 0xEF, 0xBE, 0xF3, 0xBD, 0xFB, 0x82, 0x2F, 0x0E, 0xCF, 0x23, 0x8F, 0xAE, 0x81, 0x12, 0x37,
+    0x02, 0x1E, 0xE9, 0xCF, 0xC5, 0x8A, 0x22, 0x29, 0xC8, 0x95, 0x09, 0xA0, 0x8E, 0x46, 0x2D, 0x37,
+    0x52, 0x49, 0xC4, 0x1E, 0x7F, 0x1F, 0x3B, 0xC6, 0x25, 0x66, 0xE3, 0xE2, 0x8B, 0xA7, 0xA7, 0xB3,
+    0x3E, 0xCD, 0xF8, 0x39, 0x2C, 0xD7, 0xDB, 0x50, 0xAC, 0xC1, 0x0C, 0x63, 0x37, 0x16, 0xE9, 0xBF,
+    0xEA, 0x13, 0xA4, 0xD0, 0xB6, 0xF0, 0xEB, 0x7F, 0xD3, 0x10, 0xCA, 0x6B, 0x59, 0x0F, 0xE2, 0x4E,
+    0x21, 0x94, 0x3D, 0x53, 0x94, 0x6F, 0x0C, 0x13, 0xA5, 0xA0, 0x47, 0x6A, 0x9C, 0x89, 0x30, 0xBB,
+    0x49, 0x46, 0x94, 0x4E, 0xF5, 0x13, 0x84, 0x32, 0x6F, 0x07, 0x30, 0x3F, 0x6C, 0xA1, 0x3A, 0x19,
+    0x41, 0x93, 0xAC, 0x18, 0x01, 0xB4, 0x36, 0x4C, 0x10, 0xCA, 0x6F, 0xBB, 0x64, 0x4B, 0x95, 0xCE,
+    0x42, 0x64, 0xB6, 0x67, 0x5A, 0xC4, 0xAD, 0x47, 0x28, 0x71, 0xB8, 0x27, 0x94, 0x27, 0xED, 0xC8,
+    0x59, 0xB7, 0xF6, 0x7E, 0x21, 0x4A, 0x75, 0xE7, 0x28, 0xA5, 0x45, 0xA4, 0xA1, 0x14, 0x19, 0xE0,
+    0x1B, 0x72, 0xF7, 0xDA, 0xCF, 0xA7, 0x54, 0x71, 0x3F, 0x4A, 0x91, 0xF5, 0x30, 0x50, 0xA6, 0xD8,
+    0xD2, 0x5F, 0x49, 0x80, 0x87, 0xE7, 0x1F, 0xD6, 0x88, 0x48, 0x93, 0xFC, 0xF7, 0x9F, 0x4E, 0x00,
+    0x4C, 0x4B, 0x64, 0x4D, 0x16, 0xC0, 0xB1, 0x8D, 0x7E, 0x49, 0xE2, 0x8B, 0xDB, 0xFF, 0xF0, 0x4B,
+    0x0F, 0xFE, 0x9D, 0xAC, 0xE1, 0x1A, 0xFF, 0x90, 0x07, 0xF9, 0x2C, 0x1F, 0x54, 0x0D, 0x8E, 0x0E,
+    0x8F, 0xAC, 0x3F, 0xAF, 0x9B, 0xEE, 0xDA, 0xDF, 0xF9, 0xAC, 0x77, 0x8E, 0x1F, 0xB6, 0xB6, 0xF6,
+    0x9F, 0x90, 0x68, 0xE5, 0xD6, 0xFE, 0x53, 0xA7, 0x9F, 0xC6, 0x6D, 0x29, 0xAF, 0x8A, 0x88, 0xDF,
+    0xDF, 0xDF, 0x7F, 0x6A, 0x6B, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0xFF, 0xA9, 0x95, 0x88, 0x88, 0xC8,
+    0x9B, 0xE9, 0x4D, 0xFE, 0x9B, 0xF1, 0xEB, 0x3D, 0xBE, 0x5A, 0x5F, 0x0E, 0xD9, 0x7B, 0xBF, 0xD4,
+    0xC3, 0x24, 0xB1, 0x44, 0x62, 0x79, 0x26, 0x98, 0xF1, 0xC5, 0xE3, 0xE3, 0x6B, 0x56, 0xC4, 0x3F,
+    0xBC, 0xBF, 0xBF, 0xA7, 0xA2, 0xE9, 0x6C, 0x16, 0x8C, 0x3B, 0xD4, 0x5D, 0xC9, 0x45, 0x76, 0xCD,
+    0x6D, 0x1F, 0x6D, 0x71, 0xCB, 0x6F, 0x6F, 0xA1, 0x62, 0xE9, 0xEC, 0xB7, 0x7A, 0xED, 0x2D, 0xCB,
+    0xA2, 0x33, 0x2E, 0xAA, 0x50, 0xD6, 0xBB, 0xDA, 0xE7, 0x6E, 0x9B, 0x8B, 0x0A, 0x66, 0xF9, 0xEB,
+    0xDD, 0xD2, 0xE6, 0x6F, 0xFA, 0x99, 0xD5, 0x3F, 0xF5, 0xBB, 0x65, 0xD6, 0xF9, 0x72, 0x8B, 0x3D,
+    0xD4, 0x1E, 0x59, 0x0F, 0xCB, 0x94, 0x35, 0xD3, 0xA0, 0x5B, 0xF0, 0xAC, 0x4F, 0x56, 0x56, 0xE4,
+    0x9F, 0xFF, 0xF1, 0x71, 0xAB, 0x1D, 0x78, 0xB8, 0x0A, 0x97, 0xC1, 0xD4, 0x68, 0x87, 0xF2, 0xB0,
+    0x80, 0x5D, 0x30, 0x0D, 0xF9, 0x26, 0x25, 0x66, 0x0E, 0x95, 0x1B, 0x35, 0x89, 0x87, 0x47, 0xCF,
+    0xF7, 0x72, 0x64, 0x08, 0x37, 0x81, 0x40, 0xF6, 0xFB, 0x1F, 0xFE, 0x8E, 0x16, 0x89, 0xB9, 0x48,
+    0x4F, 0xD6, 0xA6, 0x1D, 0x98, 0xB7, 0xA7, 0x80, 0x50, 0xE3, 0x52, 0xC4, 0xDD, 0xC0, 0xC3, 0x8F,
+    0x6E, 0xD5, 0x2B, 0x91, 0x66, 0x25, 0x52, 0xD7, 0xDB, 0x2A, 0xA5, 0x28, 0x2C, 0x36, 0x3E, 0x6C,
+    0xB2, 0x1E, 0x54, 0x5D, 0x85, 0x79, 0x5C, 0x0D, 0xB2, 0x5E, 0xAD, 0x57, 0x83, 0x8D, 0x45, 0x07,
+    0xFC, 0x5D, 0x98, 0x91, 0x09, 0x46, 0x6A, 0x2B, 0x8D, 0xC8, 0x97, 0xA5, 0xAD, 0x3A, 0x46, 0xF1,
+    0x95, 0xBF, 0x3A, 0x88, 0x7D, 0x7C, 0x54, 0x03, 0x7B, 0xEB, 0xAA, 0x97, 0xA3, 0x8E, 0xB6, 0xB6,
+    0x4D, 0xCD, 0x1E, 0xC5, 0xCB, 0x7F, 0x39, 0xAC, 0xB6, 0x80, 0x4A, 0x7E, 0xC8, 0x2F, 0xB4, 0x2C,
+    0xB3, 0x86, 0x6B, 0x89, 0xBD, 0x1B, 0xE9, 0x78, 0xEC, 0x17, 0x5B, 0x92, 0x0F, 0x92, 0x35, 0xEC,
+    0xC9, 0xB9, 0x57, 0xD6, 0x7C, 0xB6, 0x7F, 0xAA, 0x16, 0x79, 0x7B, 0xBF, 0xA5, 0xA5, 0xA5, 0xE3,
+    0x17, 0xBB, 0x6F, 0xFF, 0x19, 0x72, 0x72, 0x72, 0x8A, 0x5F, 0xE4, 0xBE, 0x33, 0xCE, 0x81, 0x9A,
+    0xA2, 0x19, 0x53, 0x14, 0x17, 0x80, 0xEA, 0x77, 0x13, 0x57, 0x33, 0xCD, 0x22, 0x45, 0xB6, 0x0F,
+    0x32, 0x9F, 0x79, 0x20, 0xEB, 0x0A, 0x57, 0x26, 0x48, 0xC7, 0xE5, 0x34, 0x13, 0x3B, 0xF4, 0xA6,
+    0x01, 0x94, 0xD7, 0xED, 0x22, 0xC5, 0xC3, 0xCB, 0xFC, 0xD6, 0xF7, 0xB8, 0x70, 0x54, 0xD2, 0xEF,
+    0xD8, 0x88, 0xF8, 0x9D, 0xFC, 0xF6, 0x9B, 0x77, 0x7B, 0xF3, 0x6E, 0x37, 0x9C, 0x54, 0xE5, 0x13,
+    0x7E, 0x51, 0xDC, 0x92, 0x3F, 0xF5, 0x7D, 0x7E, 0xBB, 0x2B, 0xD5, 0xFF, 0x66, 0xBE, 0xEC, 0xCA,
+    0x92, 0x03, 0xE8, 0x2B, 0x0E, 0x16, 0xCA, 0x53, 0xB8, 0x3E, 0xFB, 0xA0, 0x2B, 0x1C, 0x07, 0xBA,
+    0x2D, 0xBE, 0x53, 0xEF, 0xA2, 0x5B, 0x53, 0xEF, 0xEC, 0x10, 0xD8, 0x65, 0x47, 0x79, 0x9F, 0xBB,
+    0xCC, 0x13, 0xCC, 0xF3, 0xED, 0x2E, 0x25, 0xDA, 0x2F, 0xCC, 0xB7, 0x3C, 0x81, 0x5C, 0xDA, 0x4A,
+    0x6A, 0xD3, 0x50, 0x0C, 0x49, 0x85, 0x47, 0xD5, 0xC9, 0x3B, 0x72, 0x46, 0xEF, 0x0E, 0x69, 0xF5,
+    0x9E, 0x19, 0x28, 0x50, 0x3E, 0xDF, 0xA5, 0x8C, 0xC3, 0x33, 0xA3, 0x85, 0xDC, 0x55, 0x53, 0x7A,
+    0xF7, 0x66, 0xC8, 0x40, 0xC8, 0x3A, 0x33, 0xD2, 0x6D, 0x1A, 0x37, 0x50, 0xB2, 0x53, 0xB8, 0xE9,
+    0xBE, 0x71, 0xF0, 0x7C, 0xE1, 0x71, 0x6F, 0x9E, 0x7F, 0x55, 0x9C, 0x11, 0x6C, 0xDC, 0x50, 0xC0,
+    0x5E, 0xFF, 0xEA, 0x4F, 0x7E, 0xFA, 0x7E, 0xA8, 0x0A, 0xB7, 0xA8, 0xF4, 0xFB, 0x89, 0x0C, 0x6D,
+    0x69, 0xEA, 0xC5, 0x23, 0x47, 0xE1, 0x40, 0xBD, 0xEF, 0xF3, 0x1F, 0xBA, 0x72, 0xA2, 0xC5, 0x07,
+    0x5D, 0xE1, 0x58, 0x98, 0xA6, 0xDA, 0x65, 0x11, 0xB2, 0x6E, 0x22, 0xC8, 0x0E, 0x81, 0x1D, 0x82,
+    0x7E, 0xB5, 0x35, 0xCF, 0xB2, 0x3D, 0x51, 0xE5, 0x65, 0x57, 0x51, 0x61, 0xEA, 0x7E, 0x47, 0xFF,
+    0xA9, 0x37, 0xF5, 0x44, 0x9A, 0xDD, 0xC2, 0x99, 0x9A, 0xF9, 0x90, 0x49, 0x28, 0xA4, 0xDD, 0xD0,
+    0x27, 0x79, 0x03, 0x1E, 0x82, 0x1A, 0x05, 0x2C, 0x89, 0x99, 0xD7, 0x5D, 0xE1, 0x4C, 0x7D, 0x99,
+    0x6D, 0x9E, 0x83, 0xA5, 0x71, 0xE6, 0xA5, 0x90, 0x79, 0xCB, 0x6E, 0xE1, 0x0A, 0xD7, 0x13, 0x4A,
+    0x2E, 0x6B, 0xA7, 0xDD, 0x55, 0x9E, 0x7B, 0x10, 0x58, 0x9A, 0x5B, 0xBD, 0xF6, 0x4B, 0xE3, 0x2A,
+    0xED, 0x0F, 0xE9, 0x2B, 0xED, 0x0B, 0xD7, 0x97, 0xEC, 0xE4, 0xAE, 0xCF, 0xBA, 0xED, 0xDC, 0x19,
+    0xD5, 0x6D, 0xF3, 0xDC, 0x83, 0x74, 0x1C, 0x9A, 0xE7, 0xBB, 0x45, 0xA9, 0xDB, 0x1B, 0x8F, 0xEA,
+    0xE6, 0xB0, 0xAC, 0xFB, 0x5D, 0xDD, 0xC5, 0xE2, 0x96, 0x2F, 0xB5, 0xDB, 0x31, 0xF5, 0x8D, 0xCB,
+    0xAA, 0x3B, 0xD0, 0x8D, 0x3F, 0x2C, 0x9F, 0xEC, 0x76, 0xCD, 0xF3, 0x7E, 0xD7, 0xBC, 0xE4, 0xAB,
+    0xFC, 0x96, 0x2F, 0xB5, 0x0B, 0xE6, 0xC9, 0xF6, 0x66, 0xF1, 0x44, 0x77, 0x35, 0xFF, 0xA6, 0xDF,
+    0xD6, 0x8D, 0xFF, 0x12, 0xAA, 0x81, 0x00, 0x6B, 0xF8, 0xD7, 0x8E, 0x83, 0x17, 0xD9, 0xFE, 0x0D,
+    0x2E, 0x69, 0xF7, 0x28, 0xDE, 0x70, 0xC9, 0xD4, 0xFA, 0xDB, 0x0D, 0x9E, 0x07, 0xC8, 0x5D, 0xDE,
+    0xE5, 0x5D, 0xEE, 0x73, 0x9F, 0x7B, 0xD5, 0x63, 0xC9, 0x5B, 0x22, 0x65, 0xAD, 0x3D, 0x8F, 0x01,
+    0xAA, 0x56, 0x9E, 0x5D, 0x0A, 0x47, 0x4F, 0x95, 0x40, 0x78, 0x6B, 0x06, 0x96, 0x2C, 0x39, 0xE4,
+    0xEF, 0x9E, 0x59, 0x2D, 0x35, 0x55, 0xCD, 0xC5, 0x0A, 0xDD, 0x63, 0x1E, 0x8F, 0xD8, 0x46, 0xFB,
+    0xDC, 0xAB, 0x2E, 0x19, 0xC6, 0x29, 0x21, 0x17, 0xE3, 0x48, 0x19, 0xB4, 0xA3, 0x9D, 0x9F, 0x64,
+    0x24, 0xCC, 0x8D, 0x43, 0x1D, 0x29, 0xF1, 0x7C, 0xCF, 0x92, 0x47, 0xCA, 0x97, 0x03, 0xD6, 0xA9,
+    0x68, 0x31, 0x82, 0x71, 0x63, 0xEA, 0x2F, 0x31, 0x4F, 0xF6, 0x41, 0xE9, 0x26, 0xD4, 0x9E, 0xF6,
+    0xA3, 0x3D, 0x9E, 0xEC, 0xD7, 0x2D, 0xCA, 0xC6, 0x38, 0x1D, 0x98, 0x65, 0x1E, 0xDB, 0xA8, 0xF0,
+    0x39, 0x74, 0xE0, 0xC2, 0x64, 0x3E, 0x94, 0xAE, 0x6A, 0x0A, 0x6F, 0x3A, 0xDD, 0xEB, 0xC0, 0x40,
+    0xC4, 0x32, 0x4F, 0x5F, 0x76, 0xA6, 0xCD, 0x82, 0xF6, 0x44, 0x22, 0x96, 0x19, 0xA6, 0x29, 0xEB,
+    0xBC, 0x2D, 0x5C, 0xE6, 0xB5, 0x27, 0xD2, 0xB3, 0xCB, 0x0E, 0xA6, 0x2E, 0xC9, 0x5D, 0xE1, 0xD8,
+    0x3B, 0xEB, 0x25, 0xAD, 0x2B, 0x8C, 0x2F, 0xBB, 0x3C, 0x16, 0x3D, 0x83, 0x8A, 0x3C, 0x30, 0x99,
+    0xB8, 0xA5, 0xD4, 0x95, 0x88, 0x92, 0x8F, 0xFB, 0xCF, 0xCD, 0x4A, 0x57, 0xB4, 0x91, 0x68, 0x9C,
+    0x71, 0x91, 0xBE, 0x6C, 0xCA, 0x27, 0x83, 0xF2, 0x6B, 0xAA, 0x79, 0xA3, 0xA5, 0xC5, 0x06, 0x74,
+    0x92, 0x22, 0x79, 0x4A, 0x85, 0x55, 0xE7, 0x4C, 0x76, 0xDB, 0x90, 0xA7, 0x54, 0x4D, 0x55, 0xC3,
+    0x17, 0x8F, 0x8F, 0xFF, 0x7B, 0x11, 0xF9, 0xDF, 0x8F, 0x8F, 0x7F, 0xC0, 0x3F, 0x02, 0xF5, 0x7B,
+    0x35, 0x3C, 0xB6, 0x9D, 0x0C, 0xFE, 0xDC, 0x99, 0x26, 0x0B, 0xC9, 0x6B, 0x76, 0xA5, 0x67, 0x74,
+    0x9D, 0xAD, 0xD6, 0xB0, 0xDA, 0x1F, 0xA8, 0x50, 0xBE, 0x68, 0xD0, 0xDF, 0x6C, 0xE1, 0x4B, 0x8F,
+    0x01, 0x3F, 0x22, 0x79, 0x44, 0xB7, 0x80, 0x4B, 0xC0, 0xD5, 0x94, 0x0A, 0xA7, 0x5A, 0xD0, 0x0E,
+    0x8A, 0x1A, 0x1E, 0x1D, 0x33, 0xE4, 0x6E, 0xA4, 0x53, 0x99, 0x4B, 0x7D, 0x34, 0x2E, 0x99, 0xF7,
+    0x3B, 0x2D, 0xF8, 0x0E, 0xD5, 0x79, 0xB4, 0xF3, 0x14, 0xF5, 0x8B, 0x7C, 0x9E, 0x1B, 0x6C, 0x73,
+    0x75, 0x74, 0xA8, 0xF0, 0x89, 0x52, 0x0F, 0xBA, 0x3B, 0x8D, 0x92, 0x02, 0x70, 0x34, 0x79, 0xDC,
+    0x87, 0x7C, 0xE4, 0x0E, 0xF2, 0x6E, 0x3D, 0x45, 0x99, 0xAF, 0xC7, 0x29, 0x41, 0x65, 0xFC, 0xB0,
+    0xFA, 0xE6, 0xEF, 0x24, 0x1E, 0xF3, 0xC1, 0x78, 0x97, 0x79, 0x69, 0x6C, 0xD0, 0x3E, 0x3E, 0x3E,
+    0x62, 0x77, 0xAA, 0x3A, 0xF1, 0xB9, 0xA4, 0xD9, 0xAA, 0x00, 0xDF, 0xCB, 0xBA, 0x11, 0x30, 0x90,
+    0xF9, 0xD1, 0x72, 0xCB, 0x3C, 0x17, 0xB3, 0x0E, 0x2E, 0xEA, 0x96, 0xC3, 0xAC, 0x85, 0xA5, 0x76,
+    0xAC, 0x5E, 0x75, 0x20, 0xAF, 0x3A, 0x1E, 0x91, 0xD7, 0x7E, 0xC0, 0x23, 0xF2, 0xDD, 0xEF, 0x73,
+    0x45, 0x06, 0xB8, 0x22, 0x91, 0xEA, 0x4F, 0x96, 0x60, 0xFF, 0x8F, 0xC8, 0x49, 0x07, 0xDC, 0x6D,
+    0xD1, 0xDE, 0x83, 0x7E, 0xDF, 0x63, 0xDA, 0x1E, 0x8C, 0x0B, 0x54, 0xCD, 0x02, 0xAA, 0x3A, 0x52,
+    0x70, 0x08, 0x9F, 0x67, 0x01, 0xEC, 0x6C, 0x32, 0xB4, 0x4F, 0x83, 0xE7, 0x6F, 0x4A, 0x48, 0x9A,
+    0xD7, 0xA3, 0x1B, 0x2D, 0xDC, 0x34, 0x93, 0x05, 0x53, 0xB8, 0x49, 0x45, 0xD6, 0xDD, 0x64, 0x66,
+    0xAA, 0xD3, 0xAC, 0xC8, 0x7E, 0x03, 0x12, 0x3C, 0x60, 0x6A, 0x7E, 0x77, 0x53, 0x5C, 0xA3, 0xDC,
+    0xA0, 0x07, 0x4D, 0xB3, 0x69, 0xCB, 0x4D, 0xE4, 0x3E, 0x6D, 0x30, 0x79, 0x6F, 0xE6, 0x91, 0xE2,
+    0x9D, 0x86, 0x98, 0xAE, 0x4E, 0x65, 0x2B, 0xB2, 0x11, 0x50, 0x75, 0x8A, 0xB7, 0x5A, 0x80, 0x79,
+    0x0D, 0x24, 0x50, 0xCA, 0xE6, 0xB4, 0x87, 0xDD, 0xD4, 0xCD, 0xC5, 0xD9, 0xEA, 0x49, 0x2A, 0x8C,
+    0xD9, 0xDE, 0x1D, 0x76, 0x40, 0xED, 0xD7, 0x90, 0x8B, 0x63, 0x15, 0xB9, 0x70, 0xBD, 0x99, 0x2A,
+    0x63, 0xDC, 0xFB, 0x88, 0x0D, 0x66, 0x6B, 0xEB, 0x4A, 0xAD, 0xC4, 0x53, 0x4A, 0x3A, 0x3D, 0xBB,
+    0xE7, 0x11, 0xE9, 0xEE, 0x6A, 0x42, 0x7C, 0x69, 0x69, 0x99, 0xC7, 0xF4, 0xA0, 0x49, 0x36, 0x07,
+    0x1E, 0x91, 0xA6, 0x12, 0x41, 0x24, 0x94, 0x6F, 0xAF, 0x9A, 0xF5, 0x33, 0xF1, 0x73, 0x94, 0x6E,
+    0x8F, 0xE1, 0x5C, 0xB6, 0xF7, 0xE9, 0xDB, 0x98, 0x78, 0x3E, 0x56, 0x99, 0x59, 0x43, 0xE1, 0xC9,
+    0x7B, 0xB0, 0x8E, 0xAA, 0x43, 0x09, 0xAC, 0x6A, 0xF2, 0x1E, 0x15, 0xC1, 0xA4, 0xF2, 0x37, 0x55,
+    0x22, 0xEB, 0x6E, 0xEA, 0xFE, 0x41, 0x5A, 0xE9, 0x0F, 0xDD, 0xCF, 0xB5, 0xD9, 0x83, 0x6D, 0xD2,
+    0xF6, 0x6E, 0xA6, 0x5D, 0xAE, 0xFB, 0x74, 0xF1, 0xDE, 0x69, 0xA8, 0xA5, 0x66, 0xA8, 0x44, 0x28,
+    0x6F, 0xAD, 0x9F, 0xE9, 0x55, 0xFC, 0x1C, 0xA5, 0xAB, 0x1A, 0x12, 0x2E, 0x20, 0x19, 0xE5, 0x31,
+    0x39, 0x2C, 0x66, 0xA0, 0x7D, 0xD1, 0xC2, 0x9A, 0x05, 0xCC, 0x1B, 0xE3, 0xA8, 0x3A, 0x7A, 0x8A,
+    0x40, 0x59, 0xAB, 0x88, 0xF2, 0x58, 0xA8, 0xC8, 0x1D, 0xBA, 0x63, 0x01, 0x3B, 0xA8, 0xB3, 0x20,
+    0x95, 0x71, 0x43, 0xF4, 0xD8, 0x06, 0xEB, 0xF2, 0x1E, 0x1D, 0x99, 0x83, 0x6D, 0x54, 0x7D, 0xB6,
+    0x3F, 0xAE, 0x90, 0x96, 0xCA, 0x89, 0xF4, 0xD8, 0x66, 0xF5, 0x87, 0x03, 0xB6, 0xFE, 0xFB, 0x9C,
+    0x60, 0x81, 0x39, 0x73, 0x20, 0xD5, 0xB7, 0x99, 0xB1, 0x4C, 0xD2, 0x90, 0x94, 0x97, 0x48, 0xEE,
+    0xE9, 0xA1, 0x6A, 0x55, 0x80, 0x55, 0x9D, 0x79, 0x74, 0x44, 0x7B, 0x8A, 0x0E, 0xDD, 0x8D, 0x2A,
+    0x76, 0x22, 0xDD, 0x2E, 0xA8, 0xFA, 0x93, 0x14, 0x2B, 0x6B, 0x16, 0x60, 0x9D, 0x1A, 0x60, 0xEE,
+    0xB2, 0x01, 0x6C, 0x9D, 0x45, 0x78, 0x00, 0xF6, 0x60, 0x25, 0x22, 0x56, 0x44, 0xFE, 0xCD, 0xFE,
+    0xFE, 0xD3, 0xE3, 0x2E, 0xDE, 0xA0, 0x3B, 0xA6, 0x2C, 0xDB, 0x6A, 0xF4, 0x0A, 0x18, 0x97, 0x34,
+    0xEB, 0xDC, 0x9F, 0x49, 0xC5, 0x9D, 0x2E, 0x9C, 0x03, 0x0F, 0xEF, 0x3F, 0x45, 0x25, 0xD2, 0x17,
+    0x22, 0xF2, 0xD2, 0xDB, 0x73, 0xE9, 0x6F, 0x18, 0x91, 0x4B, 0x5A, 0xE4, 0xDD, 0x5A, 0x64, 0xDD,
+    0x5A, 0x91, 0x1B, 0x46, 0xE4, 0xDF, 0x69, 0x91, 0x8F, 0xCF, 0x7E, 0xF1, 0x3F, 0x69, 0x91, 0x9F,
+    0xD4, 0x22, 0x3F, 0x6B, 0xAD, 0xF8, 0x1B, 0x46, 0xBA, 0x4B, 0xDA, 0x51, 0xD4, 0x9E, 0xAC, 0xDD,
+    0x86, 0x1B, 0x06, 0x3E, 0xDB, 0x17, 0x63, 0xCA, 0x86, 0x48, 0x5B, 0x89, 0x0C, 0x85, 0xC8, 0xD3,
+    0x3F, 0x12, 0xF1, 0x97, 0x2A, 0x91, 0xEC, 0x55, 0x11, 0x7F, 0xC9, 0x7E, 0xFA, 0x87, 0x4A, 0x24,
+    0x6B, 0x45, 0xFC, 0xA5, 0x42, 0xE4, 0x85, 0xB6, 0x12, 0x19, 0xF8, 0xC2, 0xF1, 0xF1, 0x91, 0x15,
+    0x39, 0xD2, 0x22, 0xE2, 0x76, 0x9E, 0x15, 0xD1, 0x6E, 0x25, 0xFD, 0x76, 0x21, 0x72, 0xDB, 0xAD,
+    0x24, 0x6E, 0x17, 0x22, 0xAF, 0xBA, 0x95, 0x0C, 0xDB, 0x85, 0xC8, 0x9B, 0xD3, 0x87, 0x57, 0xA7,
+    0x53, 0xB7, 0xDD, 0x4A, 0xFA, 0xDD, 0xEB, 0x22, 0x5A, 0x44, 0xDC, 0x17, 0x8F, 0x8F, 0x27, 0xFF,
+    0x51, 0x35, 0xA5, 0x2D, 0x77, 0xFC, 0x3D, 0x02, 0xA6, 0xDB, 0x46, 0xCB, 0x3F, 0x87, 0x0B, 0xF2,
+    0x5E, 0xA4, 0x10, 0x21, 0x8F, 0xBF, 0xDA, 0xE4, 0x3F, 0xA9, 0x29, 0xFE, 0xD4, 0x53, 0xF8, 0x1D,
+    0x32, 0x6F, 0x1C, 0xFF, 0x20, 0x0B, 0xC0, 0x73, 0x50, 0x9B, 0x76, 0xF5, 0xC4, 0x90, 0x77, 0xF7,
+    0xC1, 0x13, 0x46, 0xED, 0x8D, 0xAB, 0x58, 0x28, 0xAF, 0xDD, 0xD6, 0x24, 0xA6, 0x52, 0x34, 0x7F,
+    0xB5, 0x3F, 0x40, 0x85, 0xF2, 0x14, 0x0D, 0xBA, 0x51, 0x2D, 0x7C, 0x89, 0xC7, 0x80, 0x56, 0x8D,
+    0xD2, 0xEA, 0xFF, 0xC3, 0xD7, 0x3F, 0x02, 0xD5, 0xE4, 0x35, 0x3C, 0xC6, 0x36, 0x18, 0xB2, 0x8E,
+    0xDC, 0x61, 0x9A, 0x2C, 0x30, 0x86, 0xA6, 0xAE, 0xF4, 0xA7, 0x82, 0xEE, 0xB4, 0x5E, 0x9A, 0x87,
+    0xA3, 0xDC, 0xA1, 0xC3, 0xA3, 0x50, 0x0E, 0x2F, 0xC2, 0x05, 0x79, 0x77, 0x9D, 0x6E, 0xC9, 0xD6,
+    0x5B, 0x47, 0xD8, 0x6D, 0xD0, 0x3E, 0x80, 0x7D, 0xC2, 0x43, 0x9F, 0xB7, 0xD0, 0x18, 0x07, 0xFC,
+    0xE6, 0xD9, 0xA7, 0x6F, 0x7C, 0x63, 0x99, 0x87, 0xC6, 0xD4, 0x14, 0xDD, 0x36, 0x54, 0xBD, 0x87,
+    0x0B, 0xF2, 0xDE, 0x90, 0xE2, 0x7F, 0x79, 0xFC, 0xD5, 0x86, 0xC3, 0x9B, 0x90, 0xFF, 0xA9, 0x87,
+    0xB9, 0xEE, 0x50, 0xBE, 0x70, 0xA8, 0xBA, 0xAC, 0x81, 0xC7, 0x46, 0x07, 0x7A, 0xFE, 0x43, 0xAF,
+    0x7F, 0x1A, 0x55, 0xD8, 0x49, 0x2C, 0x81, 0x72, 0x63, 0xC0, 0x7A, 0xE8, 0xE1, 0x20, 0xD9, 0xB4,
+    0x35, 0x85, 0x43, 0x77, 0xA8, 0x14, 0x94, 0xDF, 0x81, 0x2A, 0x5D, 0xE8, 0x1E, 0x7C, 0xD2, 0x17,
+    0x3E, 0x64, 0x71, 0xC1, 0x1C, 0x14, 0x3C, 0x9C, 0x90, 0x58, 0x2B, 0x79, 0x0B, 0xB2, 0x56, 0x44,
+    0xDE, 0x42, 0xF9, 0x9E, 0x47, 0xE4, 0xEE, 0xD3, 0xE1, 0x2A, 0xE4, 0x22, 0xE1, 0xDF, 0x03, 0xB6,
+    0x56, 0x47, 0xC0, 0x45, 0x12, 0x56, 0x4E, 0xFE, 0x59, 0xCF, 0x2E, 0xBA, 0x33, 0x35, 0x46, 0x3B,
+    0x78, 0xEC, 0x39, 0xC8, 0x6E, 0xA5, 0x0B, 0x9E, 0x03, 0x8A, 0x06, 0xD5, 0xDC, 0xFC, 0xBB, 0xEC,
+    0x16, 0xCF, 0x7B, 0xFA, 0x9B, 0x11, 0xFD, 0xEE, 0x0A, 0x8C, 0x38, 0xB5, 0xBF, 0xBA, 0xB3, 0x6F,
+    0x45, 0xE4, 0x67, 0xC7, 0x72, 0xF7, 0x18, 0x23, 0x0E, 0xFD, 0xF1, 0x0A, 0xE2, 0xCD, 0x88, 0x2D,
+    0x9E, 0xF7, 0x99, 0xBB, 0xF9, 0x79, 0x92, 0x49, 0x76, 0xF3, 0x9C, 0x0F, 0xDC, 0x25, 0x5C, 0xC9,
+    0xB0, 0x71, 0xF7, 0xDD, 0xF3, 0xCA, 0x9B, 0x14, 0x1E, 0x5A, 0xDF, 0xA7, 0x1E, 0xD5, 0xB9, 0xD8,
+    0x49, 0x0D, 0xB6, 0x46, 0x0D, 0xC9, 0x1D, 0x77, 0xA1, 0x66, 0x69, 0x6E, 0x85, 0x0A, 0x5B, 0xB4,
+    0xB1, 0x6C, 0x2A, 0xED, 0x0F, 0x8D, 0x33, 0xDF, 0xF2, 0xBB, 0x79, 0x5B, 0xB8, 0xBE, 0xD4, 0x9D,
+    0x6E, 0x0F, 0xCC, 0xE3, 0x3E, 0xEB, 0xB6, 0x73, 0x17, 0xF0, 0x8F, 0x6A, 0x77, 0xC0, 0x73, 0x0F,
+    0x9E, 0x8F, 0x6C, 0xC4, 0x09, 0x7E, 0x3D, 0x45, 0x52, 0x3F, 0xB5, 0x93, 0xF7, 0xBE, 0xAE, 0x02,
+    0x5C, 0xB5, 0x35, 0x60, 0xBF, 0xD3, 0x01, 0xE6, 0x4D, 0x7F, 0x8A, 0xEE, 0xFE, 0x0C, 0xAF, 0x8B,
+    0x67, 0x10, 0xE2, 0xE9, 0xE1, 0xE3, 0xF0, 0xFF, 0xF1, 0x29, 0xF5, 0x5A, 0xA0, 0x78, 0xB3, 0x07,
+    0x74, 0x1C, 0x00, 0xD6, 0x5F, 0x00, 0x78, 0xF0, 0xB3, 0x3E, 0x23, 0x81, 0x62, 0xF3, 0x64, 0x5E,
+    0x26, 0xD0, 0xCB, 0xE5, 0xCF, 0x7A, 0xAF, 0xAA, 0x01, 0xF5, 0x64, 0x00, 0x74, 0x58, 0x03, 0x6A,
+    0x9D, 0x46, 0xFB, 0x44, 0x0D, 0x64, 0x35, 0xE6, 0x76, 0xBF, 0xAE, 0xEE, 0x77, 0xE7, 0x85, 0xE7,
+    0xC3, 0xDA, 0x3E, 0x3E, 0x69, 0x49, 0xEB, 0xCD, 0x61, 0xF9, 0x57, 0x3D, 0xF2, 0x01, 0xE0, 0x62,
+    0xCA, 0xC0, 0x6A, 0xD0, 0xD1, 0xD6, 0x64, 0xF1, 0xD1, 0x51, 0xF7, 0xFD, 0xB9, 0xAF, 0xDF, 0x39,
+    0xFF, 0xA0, 0x61, 0x43, 0xDF, 0x31, 0x55, 0xB3, 0x67, 0xD2, 0xD2, 0xB2, 0xDA, 0x34, 0xBF, 0x82,
+    0xEE, 0x75, 0x67, 0x5A, 0xD6, 0xF4, 0xBA, 0xC7, 0xD6, 0xBB, 0x0C, 0xA8, 0xDA, 0x34, 0x5B, 0xA7,
+    0xFA, 0xF1, 0xE9, 0x1D, 0x49, 0x37, 0x4B, 0xDE, 0xB8, 0x2B, 0x22, 0x22, 0xF2, 0xDA, 0xFE, 0xFE,
+    0x6C, 0x7F, 0x7F, 0x6F, 0xCA, 0x7D, 0x3C, 0x73, 0xC7, 0x03, 0xEC, 0x72, 0x11, 0xD3, 0x9A, 0xC6,
+    0xA2, 0x7B, 0xDD, 0x95, 0x2D, 0x6B, 0xFA, 0xDC, 0xF3, 0x28, 0xBB, 0xDC, 0xE4, 0x13, 0x77, 0x7C,
+    0x0F, 0xC0, 0xFC, 0xF0, 0x2F, 0x87, 0x31, 0x4D, 0x40, 0xFD, 0xB7, 0xC3, 0xEA, 0x8F, 0x7F, 0x3C,
+    0xA9, 0xD3, 0xD5, 0x4F, 0xEE, 0xC4, 0x07, 0xA0, 0xFC, 0xCE, 0x07, 0x71, 0xB5, 0x05, 0x7B, 0x2B,
+    0xFB, 0xCA, 0xFB, 0x3D, 0x64, 0xFF, 0x5D, 0x14, 0xFB, 0xD2, 0xD1, 0xE6, 0x84, 0xC8, 0xD3, 0xAF,
+    0x25, 0xFF, 0x88, 0x76, 0xBF, 0xA0, 0xEF, 0xE6, 0x99, 0x36, 0x6F, 0xF3, 0x36, 0xEF, 0x7E, 0x21,
+    0x1F, 0xCC, 0x6A, 0x6D, 0x63, 0xD5, 0x1B, 0x5F, 0x74, 0xDA, 0x7D, 0xD6, 0xBB, 0x92, 0xEF, 0x46,
+    0xD5, 0xDA, 0xE5, 0xAD, 0xF1, 0x65, 0xB0, 0x71, 0xB5, 0xFE, 0xEC, 0x77, 0x66, 0x4D, 0xD1, 0x7D,
+    0xE9, 0xB1, 0x17, 0x3F, 0xBF, 0xBD, 0x6D, 0xFC, 0x67, 0x7F, 0xA6, 0xAA, 0xA5, 0x79, 0xBA, 0xF9,
+    0x7F, 0x42, 0x19, 0x7E, 0x9D, 0x5C, 0xEA, 0xD9, 0x4A, 0x77, 0x3B, 0x15, 0x21, 0xE8, 0x37, 0x9D,
+    0x79, 0x96, 0x9D, 0x05, 0x3F, 0xEB, 0xF2, 0x1F, 0x36, 0x97, 0x2B, 0xC2, 0x41, 0xE1, 0xD6, 0x51,
+    0x89, 0xE3, 0x29, 0xC0, 0xD0, 0xA1, 0xEA, 0x6D, 0xDD, 0x3C, 0x57, 0xE0, 0x3F, 0xAF, 0xBA, 0x4B,
+    0xDA, 0x6D, 0x8F, 0xDA, 0x5E, 0x24, 0xEB, 0x29, 0x02, 0x8F, 0x06, 0x0E, 0x3C, 0xEF, 0x7B, 0xFD,
+    0xE3, 0xAE, 0x78, 0xB2, 0xBD, 0xAC, 0x9D, 0x95, 0x38, 0x97, 0x48, 0xD1, 0x60, 0x6A, 0xCC, 0xC6,
+    0x2A, 0x69, 0xAD, 0xD4, 0x9E, 0xA2, 0x61, 0x07, 0x3E, 0x3E, 0xCA, 0xA5, 0x7B, 0xA0, 0x70, 0x98,
+    0x9A, 0x1D, 0x08, 0x75, 0x71, 0xFB, 0x9D, 0xA1, 0x90, 0x56, 0xED, 0x81, 0xDA, 0x53, 0xD2, 0x95,
+    0xEF, 0x3C, 0x1E, 0x30, 0x35, 0x57, 0xD1, 0x3F, 0x09, 0x46, 0xC2, 0x4C, 0xFF, 0xA9, 0xCF, 0x5F,
+    0x76, 0x8F, 0x96, 0xDC, 0x3C, 0xC8, 0xDD, 0xFA, 0x04, 0xE9, 0x18, 0x9D, 0xCB, 0xB1, 0x90, 0x08,
+    0x81, 0xCC, 0x27, 0xE1, 0x49, 0x05, 0x3B, 0x10, 0x51, 0x1E, 0xDD, 0x51, 0x38, 0xCA, 0x7A, 0x4A,
+    0x55, 0xD9, 0xAA, 0x59, 0x85, 0xEC, 0xCE, 0x42, 0xB7, 0x3B, 0xDA, 0xED, 0xE8, 0xF6, 0x40, 0xFD,
+    0x65, 0x40, 0x9A, 0x5C, 0xDA, 0xF2, 0x09, 0xBF, 0x43, 0xD8, 0x26, 0xEC, 0x28, 0x5F, 0xFD, 0x51,
+    0x57, 0x48, 0xCD, 0x53, 0xF0, 0x10, 0x85, 0x70, 0xB2, 0xCA, 0xDB, 0xED, 0xCB, 0x84, 0xA0, 0x5F,
+    0x6D, 0xCD, 0x57, 0x9B, 0x58, 0x8A, 0x2F, 0x7F, 0xD2, 0xB0, 0x43, 0xE6, 0xA9, 0xB2, 0x17, 0x82,
+    0x59, 0xB3, 0x55, 0xC3, 0x35, 0x0C, 0x78, 0x0C, 0x73, 0xF9, 0xB3, 0xEB, 0x3F, 0xC0, 0xA7, 0x3F,
+    0xB7, 0x80, 0x5C, 0xD6, 0xDF, 0x38, 0x3E, 0x9A, 0xCB, 0xEB, 0x23, 0x32, 0x6F, 0x2E, 0x3F, 0x3D,
+    0xFE, 0x01, 0x8F, 0x52, 0x62, 0xEA, 0xA2, 0xC9, 0x9D, 0xEE, 0xF0, 0x1C, 0x70, 0x19, 0x53, 0xEB,
+    0x16, 0xCF, 0x76, 0xFA, 0x70, 0x13, 0x43, 0xE6, 0xC0, 0x73, 0x83, 0x03, 0xB6, 0xD9, 0x66, 0x87,
+    0x1D, 0x76, 0xD8, 0xE6, 0x80, 0x05, 0x41, 0xF9, 0xAC, 0xCB, 0x9D, 0xA9, 0x2F, 0x73, 0x13, 0xA5,
+    0x8E, 0xF2, 0x2B, 0x7D, 0x11, 0x0E, 0x8C, 0xDB, 0x36, 0xF5, 0x76, 0xC9, 0xC1, 0x25, 0x6E, 0x6E,
+    0x73, 0x63, 0x1B, 0x7F, 0x80, 0xBF, 0xAA, 0xBA, 0xBD, 0x69, 0xE2, 0xE7, 0x2B, 0xDD, 0xED, 0x94,
+    0xDC, 0xEC, 0xB3, 0x37, 0xDB, 0xE2, 0x3B, 0xEC, 0x1E, 0xF0, 0xA1, 0xD7, 0x2F, 0xBB, 0xAA, 0xA4,
+    0xDF, 0x29, 0xDC, 0x7A, 0x40, 0x5A, 0x9E, 0x02, 0xB4, 0x5F, 0xFD, 0xF1, 0x70, 0xD3, 0xE7, 0xAE,
+    0xA2, 0xD7, 0x6D, 0xC9, 0x41, 0xD6, 0x99, 0x7A, 0x47, 0xF9, 0x44, 0x44, 0x09, 0xFA, 0x6E, 0x54,
+    0xF5, 0x0E, 0xEC, 0xC0, 0x01, 0xF4, 0x64, 0x9E, 0xC2, 0x51, 0x41, 0x44, 0x77, 0x94, 0x35, 0x56,
+    0xFC, 0x3C, 0xE1, 0x47, 0xB6, 0x6A, 0x25, 0x41, 0xBF, 0x93, 0x04, 0xFE, 0x0E, 0x1C, 0x70, 0x21,
+    0x20, 0x0D, 0xD7, 0x5B, 0x94, 0x87, 0x00, 0xE1, 0x62, 0xE6, 0x77, 0xAF, 0xB7, 0x56, 0xEA, 0x29,
+    0xF9, 0x7C, 0x89, 0x8A, 0xE8, 0x88, 0xB9, 0xC9, 0x4E, 0xE0, 0x86, 0xCF, 0x3A, 0x9F, 0xDF, 0xF2,
+    0x26, 0xEB, 0xAC, 0x0C, 0x56, 0x22, 0xB9, 0xA3, 0x68, 0x92, 0x44, 0x9E, 0x16, 0x57, 0x52, 0xE9,
+    0xB6, 0xEF, 0x59, 0x5C, 0xBE, 0x2E, 0x6E, 0xBF, 0x13, 0x0B, 0x71, 0x69, 0x71, 0xB1, 0xF2, 0xE5,
+    0x3B, 0x75, 0xC0, 0x34, 0x1C, 0x90, 0xFD, 0x79, 0x30, 0x12, 0x6C, 0xE6, 0x43, 0xFE, 0xB2, 0x2B,
+    0x4B, 0x6E, 0xEE, 0xE8, 0xF6, 0xE4, 0x04, 0xE9, 0x92, 0xE9, 0x50, 0xC8, 0x50, 0x48, 0x1C, 0x87,
+    0xA7, 0x5B, 0x4C, 0x43, 0x09, 0xBB, 0xB0, 0x40, 0x05, 0x74, 0x77, 0xBA, 0xE0, 0x92, 0x67, 0x3E,
+    0x97, 0x66, 0x76, 0xE5, 0xC9, 0xEE, 0xB2, 0xA9, 0x6F, 0x5E, 0xD6, 0xED, 0xEE, 0x92, 0x95, 0x33,
+    0xEF, 0x35, 0x7D, 0xF9, 0x95, 0x66, 0x77, 0x87, 0x9B, 0x37, 0xF5, 0x8F, 0x86, 0x95, 0x4A, 0x0B,
+    0xF7, 0x21, 0x72, 0xE1, 0x64, 0xA5, 0xDB, 0x9D, 0x8A, 0x1B, 0x37, 0xB3, 0x57, 0x3B, 0xF3, 0x15,
+    0xB7, 0x34, 0xE2, 0xCB, 0x3F, 0x77, 0xEC, 0xA0, 0x3C, 0xE5, 0x13, 0x2F, 0x84, 0x22, 0x2D, 0xAC,
+    0xAF, 0x53, 0xC0, 0x8B, 0x14, 0x58, 0xF9, 0xE9, 0xF5, 0x63, 0x5E, 0x4C, 0x7F, 0xAA, 0x84, 0xD8,
+    0xFE, 0xE2, 0xF1, 0x35, 0x2B, 0x6F, 0x8E, 0x49, 0xDA, 0x56, 0x7E, 0x7A, 0xFC, 0x03, 0xB6, 0x09,
+    0xC9, 0x77, 0x58, 0xB1, 0xC3, 0x01, 0x0B, 0x6E, 0x12, 0xC6, 0x7F, 0x37, 0x39, 0x60, 0x9B, 0x4B,
+    0xF0, 0x22, 0x57, 0x37, 0x2B, 0xEA, 0xD2, 0x66, 0x55, 0xDD, 0x24, 0x64, 0x5E, 0x3B, 0xD3, 0x54,
+    0x1C, 0xC0, 0x7F, 0xFA, 0x39, 0x2D, 0xFF, 0xA3, 0xA9, 0xFB, 0x4B, 0x84, 0x6D, 0xC2, 0x55, 0xFC,
+    0x0D, 0xFC, 0x8D, 0xAC, 0xBB, 0x91, 0xB7, 0x07, 0x95, 0xAB, 0x7E, 0xE6, 0xB6, 0x6A, 0xF8, 0x06,
+    0x36, 0x9A, 0xEC, 0xC7, 0xED, 0xA5, 0xED, 0xE2, 0x65, 0xE9, 0xFE, 0xD5, 0x5E, 0x51, 0x73, 0x03,
+    0xDD, 0x7E, 0xBD, 0x14, 0x1E, 0x86, 0x6F, 0x50, 0x4A, 0x1D, 0x8C, 0xA9, 0x2F, 0x6D, 0xF3, 0xBF,
+    0xB4, 0xD9, 0x4F, 0x6A, 0x73, 0x89, 0xED, 0x1B, 0x59, 0x1B, 0x2E, 0x27, 0x32, 0xA8, 0xE6, 0x41,
+    0x6E, 0x98, 0xDA, 0x14, 0x75, 0xF6, 0x7A, 0x83, 0x6D, 0x28, 0x1C, 0xB9, 0x47, 0xFF, 0x3B, 0xF4,
+    0x6D, 0xA7, 0xDD, 0x0D, 0xDD, 0x1A, 0x00, 0xF5, 0x03, 0x24, 0x3E, 0x90, 0x75, 0x18, 0xF0, 0x5F,
+    0x10, 0xF3, 0xCE, 0x9B, 0xED, 0xA5, 0xC7, 0xF2, 0xDB, 0xB7, 0x7C, 0x15, 0x79, 0x08, 0xD5, 0x52,
+    0xC0, 0x36, 0x78, 0xF2, 0x7F, 0x7A, 0x74, 0x49, 0xBA, 0xB5, 0xBE, 0xDD, 0x99, 0x92, 0xC7, 0x9E,
+    0x53, 0x3F, 0x75, 0xC5, 0x57, 0xD9, 0x7E, 0x8C, 0xF7, 0xDB, 0xFC, 0xDB, 0xF5, 0x25, 0x38, 0x77,
+    0x6D, 0xF3, 0x8F, 0x2F, 0xE5, 0xCE, 0x5F, 0xD5, 0x2F, 0x37, 0x8F, 0xDE, 0x64, 0xEE, 0xB2, 0x8F,
+    0x1B, 0x63, 0x78, 0xEC, 0x51, 0xD5, 0x6E, 0x17, 0xF5, 0x55, 0x20, 0x31, 0xBB, 0xBC, 0xB9, 0x61,
+    0xF0, 0x9F, 0x57, 0xED, 0x97, 0xD2, 0x1F, 0x90, 0x5D, 0x68, 0xBE, 0xC8, 0xFF, 0x2A, 0x65, 0x34,
+    0xED, 0x7F, 0xFD, 0x44, 0x1B, 0x72, 0x77, 0xC9, 0x70, 0x35, 0xBB, 0xD5, 0x15, 0x6C, 0x7F, 0x09,
+    0xAF, 0x9F, 0x77, 0x9F, 0xE7, 0xB9, 0x6D, 0xD5, 0x15, 0x79, 0x73, 0x09, 0x7F, 0x43, 0xBB, 0xC4,
+    0x01, 0xD5, 0xB7, 0xDE, 0xD2, 0x6F, 0x0C, 0x3A, 0x5C, 0xCE, 0xDB, 0x47, 0x8B, 0xE6, 0x92, 0x61,
+    0xC7, 0xB0, 0xFD, 0xE8, 0xB8, 0x4F, 0xC3, 0x76, 0x42, 0x9C, 0xED, 0x7D, 0x9F, 0x1D, 0x71, 0xA6,
+    0xBD, 0x99, 0xBB, 0xCF, 0x67, 0x9D, 0x6E, 0xBC, 0xEA, 0xB6, 0xB9, 0x51, 0xB2, 0x9D, 0xBB, 0xCB,
+    0x59, 0x5F, 0xF1, 0x81, 0xF0, 0xD8, 0x43, 0xFC, 0x06, 0x14, 0xC9, 0x83, 0xE6, 0x41, 0xFD, 0x40,
+    0xCB, 0xFB, 0x1D, 0xCF, 0x61, 0x6A, 0x15, 0x29, 0x5A, 0x0E, 0x30, 0xFF, 0xA0, 0xF8, 0x8E, 0x34,
+    0x0F, 0x93, 0x35, 0xBA, 0x2E, 0xBF, 0xBF, 0x8A, 0x86, 0x47, 0xB9, 0xC4, 0x36, 0xDB, 0x5C, 0xE5,
+    0x39, 0xAE, 0x62, 0xDD, 0x58, 0xFD, 0x29, 0x97, 0x23, 0x8C, 0xF4, 0x98, 0xF0, 0xEB, 0x14, 0x5D,
+    0xD2, 0xD0, 0xA6, 0x52, 0x70, 0xCC, 0xF8, 0xC6, 0xF1, 0xB3, 0x8D, 0x95, 0x77, 0x5B, 0xF3, 0xCE,
+    0xBF, 0x0C, 0x79, 0xCB, 0x32, 0xF3, 0x94, 0x4D, 0x44, 0x07, 0x0B, 0x2B, 0x79, 0xE7, 0x5A, 0x2E,
+    0x12, 0xF9, 0xB5, 0x3B, 0xFB, 0xA7, 0x55, 0xA5, 0x4C, 0x9D, 0x1C, 0x2A, 0x59, 0x18, 0xA1, 0xD2,
+    0xA9, 0xD4, 0x19, 0x7B, 0x17, 0xA1, 0x78, 0xDE, 0xC1, 0x76, 0x09, 0xEA, 0x6E, 0x80, 0x95, 0x04,
+    0x4A, 0x91, 0x36, 0x93, 0xEE, 0x63, 0xAA, 0x37, 0x72, 0xA7, 0xE2, 0xC1, 0x25, 0xCC, 0x4B, 0xAD,
+    0xE7, 0xC4, 0xE4, 0x8D, 0xF6, 0x37, 0x77, 0x28, 0x9F, 0xBF, 0xE5, 0x59, 0x96, 0x45, 0xAD, 0xFD,
+    0x8D, 0x6D, 0xCC, 0xED, 0x5B, 0x1D, 0xF6, 0xB2, 0x81, 0xE8, 0x0F, 0xD0, 0x1F, 0xBD, 0xD4, 0x62,
+    0x06, 0x03, 0xA5, 0xBF, 0x0A, 0xF6, 0xB6, 0x83, 0xF9, 0x7B, 0xD7, 0x6B, 0x25, 0x32, 0x50, 0x3C,
+    0x2B, 0x47, 0x6C, 0x5F, 0x86, 0xAC, 0xF3, 0x60, 0x72, 0x77, 0xEA, 0x1A, 0xEB, 0x28, 0x44, 0x9C,
+    0x96, 0xE3, 0x88, 0xD4, 0x0A, 0xEB, 0x46, 0xB4, 0xE0, 0x30, 0x1A, 0xF6, 0xA9, 0x7A, 0x2F, 0xD7,
+    0xFE, 0x49, 0xDE, 0x19, 0xDB, 0x2D, 0x95, 0xFC, 0x9F, 0xC6, 0x55, 0x1D, 0x51, 0xF7, 0x23, 0x36,
+    0x38, 0xEF, 0x30, 0xEE, 0x10, 0x86, 0xC2, 0x25, 0x88, 0xE6, 0xDC, 0x34, 0xE8, 0x21, 0x40, 0x29,
+    0x7F, 0xE4, 0x52, 0x1D, 0x87, 0x95, 0x34, 0xA9, 0x3C, 0xB1, 0x12, 0x19, 0x52, 0xA9, 0x33, 0x2D,
+    0x12, 0xCF, 0x94, 0xA5, 0x29, 0x4E, 0xB3, 0x60, 0x4F, 0xAB, 0x19, 0xD6, 0x93, 0x4D, 0x66, 0x8F,
+    0x8F, 0xEB, 0x94, 0x36, 0x60, 0x45, 0x46, 0xEF, 0xDE, 0x62, 0xD2, 0xE8, 0x1F, 0x1E, 0x9E, 0x1A,
+    0x1D, 0x96, 0xBF, 0xB5, 0xFE, 0xFE, 0xE8, 0x6E, 0x4B, 0x45, 0x6F, 0xBA, 0xD3, 0xA2, 0x37, 0xA3,
+    0x37, 0x73, 0x00, 0x44, 0x3C, 0xC8, 0xD7, 0x7A, 0x38, 0xE1, 0x81, 0x29, 0x59, 0xBF, 0x99, 0xFA,
+    0x90, 0xBC, 0x75, 0x11, 0xD8, 0x5A, 0xED, 0xEF, 0x25, 0x84, 0x6C, 0x26, 0x12, 0x27, 0x75, 0x3D,
+    0x02, 0x0F, 0xAE, 0x8E, 0x8F, 0xD2, 0x19, 0x75, 0xFD, 0x9D, 0xEF, 0x8F, 0x67, 0x12, 0x7A, 0x2C,
+    0x4E, 0x8A, 0x6F, 0x26, 0xC7, 0xC7, 0xDF, 0x43, 0x24, 0x25, 0xE0, 0xC8, 0xF9, 0xA2, 0x09, 0xC9,
+    0x66, 0x52, 0xFE, 0xAC, 0x63, 0xB6, 0x70, 0x70, 0x50, 0x44, 0x23, 0x1D, 0x8B, 0xB9, 0xD8, 0x54,
+    0x78, 0x4C, 0x52, 0xE1, 0xB1, 0x81, 0xE1, 0xD3, 0x0A, 0x8F, 0x55, 0xA9, 0xC0, 0xD7, 0x3C, 0x15,
+    0x1E, 0x13, 0xB2, 0x90, 0xB7, 0x99, 0x90, 0xF9, 0xC2, 0xE9, 0x35, 0xDA, 0x1B, 0x67, 0x06, 0xB4,
+    0x37, 0xAE, 0x4A, 0x45, 0x57, 0xB6, 0x53, 0xE1, 0xB1, 0x3E, 0x62, 0x5C, 0xA5, 0xDE, 0xEF, 0x31,
+    0xCE, 0xEA, 0x1F, 0x07, 0xCC, 0x46, 0x78, 0x94, 0x53, 0xF8, 0xE8, 0x54, 0xD5, 0x06, 0xD3, 0x12,
+    0x30, 0x1D, 0x81, 0xD2, 0x2B, 0x4F, 0xE5, 0x33, 0x8F, 0xF5, 0xDA, 0xB3, 0xEB, 0x75, 0xC7, 0x4E,
+    0xC8, 0x5B, 0x0E, 0xFA, 0xDC, 0x3D, 0xB8, 0x5E, 0x5F, 0xFF, 0x0B, 0x23, 0x22, 0xF1, 0xC1, 0xF5,
+    0xFA, 0xFA, 0x5F, 0xA8, 0x70, 0x50, 0xD6, 0xCA, 0x1F, 0x54, 0xFC, 0xD6, 0x5D, 0x59, 0x5D, 0x9B,
+    0x8B, 0x88, 0x7F, 0xE4, 0xED, 0xF9, 0xC9, 0x5E, 0xDE, 0x5E, 0x3E, 0xA0, 0x70, 0xD5, 0x82, 0xC2,
+    0x95, 0x0B, 0x4C, 0x53, 0xF6, 0x98, 0xDA, 0x04, 0x4A, 0x8C, 0xA7, 0xC2, 0x78, 0x2C, 0xA6, 0x03,
+    0xB3, 0xAE, 0x81, 0x52, 0x02, 0x50, 0xC9, 0x00, 0x54, 0x08, 0x60, 0xB1, 0x35, 0xEC, 0x52, 0xD5,
+    0xA4, 0x0C, 0x7E, 0x96, 0x54, 0x4F, 0xB4, 0x44, 0x6C, 0xEE, 0x88, 0xCC, 0x8D, 0xA3, 0x67, 0x3D,
+    0x5F, 0xAB, 0x90, 0x8B, 0xAC, 0x33, 0x91, 0xF7, 0xE7, 0xDF, 0xD5, 0x22, 0xB5, 0x45, 0xDF, 0x3D,
+    0x1A, 0xEB, 0x16, 0xEC, 0x52, 0xB4, 0x70, 0x38, 0x3A, 0x5D, 0xC7, 0xBA, 0x05, 0x0D, 0xF4, 0x94,
+    0x0D, 0xF4, 0x09, 0xE6, 0x74, 0xD1, 0x02, 0xE2, 0x2D, 0xA9, 0x82, 0x19, 0x6C, 0x81, 0x59, 0x8F,
+    0x25, 0x16, 0x13, 0x88, 0x23, 0x15, 0x73, 0x76, 0x09, 0x56, 0x3B, 0x15, 0x69, 0x1F, 0x80, 0xBC,
+    0xCD, 0x42, 0xB5, 0xA6, 0xAA, 0xCD, 0x6D, 0x19, 0x88, 0xD8, 0xEA, 0xB5, 0x17, 0xB5, 0xCF, 0xFA,
+    0x08, 0x65, 0x53, 0xDE, 0xF6, 0x30, 0x7B, 0x7A, 0x30, 0x8E, 0x4C, 0xA4, 0xB5, 0x35, 0x46, 0x7A,
+    0xE6, 0x35, 0x36, 0xEF, 0x58, 0x35, 0xAA, 0x37, 0x8E, 0x55, 0x53, 0xB4, 0x16, 0xE6, 0xB5, 0x65,
+    0x09, 0x73, 0xA2, 0x0A, 0x10, 0x75, 0x37, 0x56, 0xEA, 0x31, 0x8E, 0xD2, 0x2D, 0xB1, 0x97, 0xD4,
+    0xA0, 0x3D, 0xC3, 0x4A, 0x3A, 0xE3, 0xB2, 0xB0, 0x4A, 0x4A, 0xD5, 0x16, 0x28, 0x4F, 0x64, 0x47,
+    0x79, 0x15, 0x59, 0x64, 0x3E, 0x8B, 0xF4, 0x99, 0xD7, 0x51, 0x85, 0xCC, 0xE7, 0x8B, 0xCC, 0x67,
+    0xDE, 0x1C, 0xE8, 0x2E, 0xF3, 0xE5, 0xD5, 0xDC, 0x69, 0x7F, 0xF9, 0x6A, 0xE1, 0x74, 0xB7, 0x7D,
+    0xD5, 0xD4, 0xBA, 0x3B, 0xB8, 0x59, 0xA2, 0xBB, 0xFE, 0xA6, 0xC5, 0x8A, 0x88, 0xB4, 0x56, 0x44,
+    0xC4, 0xE9, 0x57, 0xDB, 0xD0, 0xA3, 0x5F, 0x77, 0x21, 0xA0, 0x7F, 0xD8, 0x7C, 0xE8, 0xD1, 0xAF,
+    0xD4, 0x3F, 0xEB, 0xC8, 0xDF, 0xE0, 0x03, 0x47, 0xFE, 0x7F, 0xF1, 0x91, 0x23, 0x8F, 0x7C, 0x5C,
+    0x93, 0x47, 0x04, 0xF2, 0x30, 0xFA, 0x76, 0x53, 0x09, 0xE7, 0x08, 0x18, 0xB9, 0x03, 0x8B, 0x94,
+    0x61, 0x16, 0x29, 0x8F, 0x5F, 0x08, 0xF4, 0x54, 0xA8, 0xA8, 0x02, 0x16, 0x16, 0x99, 0x67, 0x37,
+    0x01, 0xA4, 0x0E, 0xB3, 0xA3, 0x43, 0xED, 0x59, 0xE4, 0xEE, 0x40, 0x77, 0xC4, 0xC2, 0x2D, 0xF2,
+    0x96, 0xDE, 0xB8, 0x58, 0x38, 0x7A, 0xD3, 0xF4, 0xC6, 0xA9, 0x50, 0x3E, 0x1E, 0x4C, 0x93, 0xF9,
+    0x4A, 0x79, 0x53, 0x6B, 0x6F, 0x33, 0x5F, 0xD6, 0xBA, 0xDB, 0xD5, 0xBE, 0x22, 0x6F, 0x77, 0x75,
+    0x67, 0xC9, 0xDD, 0x61, 0xDE, 0xEE, 0x52, 0xB8, 0x45, 0xE1, 0x0E, 0x13, 0x1E, 0x65, 0x81, 0x69,
+    0x7A, 0x54, 0x4F, 0xF9, 0x78, 0x20, 0xF7, 0x54, 0xEA, 0xC3, 0xFD, 0x79, 0x4B, 0x95, 0x89, 0x48,
+    0xCD, 0xAE, 0x16, 0x79, 0x8B, 0xD3, 0xBA, 0x99, 0xC9, 0x72, 0x9B, 0x01, 0x0F, 0x3F, 0xF3, 0x16,
+    0x18, 0x91, 0x0E, 0x52, 0xFA, 0xA8, 0x9A, 0xEA, 0xBD, 0x66, 0xF2, 0x2D, 0x8F, 0x12, 0xB1, 0x30,
+    0x7F, 0xED, 0x5F, 0x7B, 0x4C, 0x97, 0xAD, 0xC9, 0x22, 0x65, 0x9B, 0xA0, 0x93, 0x79, 0xB7, 0x41,
+    0xAC, 0x1A, 0x47, 0xD9, 0xA4, 0xF2, 0x01, 0x65, 0x93, 0x6A, 0x7D, 0xE5, 0x9E, 0xB2, 0x61, 0x8D,
+    0xEA, 0xA9, 0x5A, 0x8C, 0x2B, 0x06, 0x90, 0xFC, 0x5D, 0x47, 0x2E, 0xFD, 0x02, 0xCA, 0xC1, 0x34,
+    0xF7, 0x78, 0xE1, 0x72, 0x11, 0x81, 0x95, 0x48, 0x87, 0xDA, 0x4F, 0x81, 0x8D, 0x31, 0xBB, 0xAA,
+    0x85, 0x4A, 0x22, 0xC8, 0x71, 0x8F, 0xEE, 0xF9, 0xFB, 0x09, 0x22, 0x51, 0x6E, 0x4A, 0xA8, 0xCD,
+    0x26, 0x73, 0xB9, 0x1A, 0x7F, 0x3E, 0xA1, 0x3B, 0x53, 0x24, 0xEC, 0xD7, 0x3E, 0xDC, 0x87, 0x95,
+    0xAC, 0xC7, 0x11, 0xE6, 0xDD, 0xB9, 0xEA, 0x61, 0x3A, 0x6C, 0xD0, 0xBD, 0xF2, 0xDD, 0x9B, 0xA3,
+    0x3B, 0xAE, 0x90, 0x30, 0xFA, 0xE1, 0x2B, 0x52, 0x96, 0xDB, 0xB9, 0x72, 0x2B, 0x4B, 0x6C, 0x4D,
+    0xC5, 0x27, 0xCB, 0xAD, 0x34, 0xA9, 0xDC, 0x8A, 0x9A, 0xCF, 0x5F, 0xDB, 0xCB, 0x44, 0x64, 0x40,
+    0x44, 0x04, 0xB5, 0x2E, 0x1B, 0x58, 0xA6, 0x0C, 0xF3, 0x25, 0x18, 0x57, 0x3A, 0xF2, 0x4E, 0x07,
+    0x54, 0x60, 0x06, 0xCB, 0x84, 0x46, 0xCD, 0x7A, 0x8C, 0x63, 0x7E, 0xB6, 0xD6, 0x72, 0x2E, 0x22,
+    0xA1, 0x12, 0x91, 0x56, 0x44, 0xE4, 0x9E, 0x5F, 0x3C, 0xB8, 0xED, 0x60, 0xB6, 0x1A, 0x2B, 0x8C,
+    0x9A, 0x7E, 0xF4, 0x01, 0x99, 0x1E, 0x32, 0xF9, 0x51, 0x87, 0xBD, 0x32, 0x6F, 0xE8, 0x24, 0x8C,
+    0xB0, 0xA8, 0xCA, 0x41, 0x3E, 0x8C, 0x30, 0xA7, 0xF2, 0x0D, 0x07, 0xBF, 0x7D, 0xBE, 0x42, 0x9F,
+    0x3D, 0x97, 0xD0, 0xB6, 0xAE, 0x99, 0xF2, 0xBF, 0x80, 0xEA, 0x5F, 0x5C, 0x19, 0x46, 0xD7, 0xC6,
+    0xAA, 0x4E, 0xBB, 0xB0, 0x72, 0xC9, 0xB7, 0x98, 0x6A, 0x29, 0xD9, 0x51, 0x8E, 0xD8, 0xD1, 0x75,
+    0xB4, 0x3B, 0xA6, 0x00, 0x1E, 0x8E, 0x0B, 0x6A, 0xB9, 0x11, 0x24, 0xD3, 0x7B, 0x36, 0x86, 0xA1,
+    0x74, 0xC8, 0xA4, 0x51, 0x01, 0xED, 0x4B, 0xF1, 0x99, 0x27, 0xEF, 0xEC, 0x1F, 0xF6, 0xDA, 0x63,
+    0xDA, 0x65, 0xAA, 0x3D, 0xE9, 0x22, 0x31, 0xEF, 0x98, 0x3F, 0xDE, 0x13, 0x8B, 0x56, 0xAD, 0xB3,
+    0x40, 0x2C, 0x5C, 0xD9, 0x6B, 0x9F, 0xF5, 0xE6, 0x1D, 0x69, 0x75, 0x5F, 0x78, 0x23, 0x6B, 0xB4,
+    0x48, 0x5B, 0xCA, 0x11, 0xF9, 0x7B, 0xEB, 0x51, 0xF2, 0xEC, 0x9D, 0xF1, 0x1E, 0x9D, 0x79, 0x6F,
+    0x38, 0x5B, 0xDC, 0x60, 0x53, 0x4D, 0x7E, 0x1A, 0xFF, 0xEE, 0xD9, 0x1C, 0xCC, 0x35, 0x63, 0x81,
+    0x6E, 0x1D, 0x16, 0x13, 0xA6, 0x7B, 0xA1, 0x5B, 0xB0, 0xCA, 0x27, 0xE0, 0x02, 0xBA, 0xDB, 0x05,
+    0xFA, 0x0A, 0xD8, 0x35, 0x0D, 0x98, 0x6F, 0x3B, 0xC8, 0x3E, 0x6A, 0x27, 0x34, 0x5C, 0xB9, 0x59,
+    0x6B, 0xAA, 0x07, 0x8D, 0x80, 0x6E, 0xC5, 0xA1, 0xE2, 0xD2, 0x83, 0x1C, 0xEE, 0xC0, 0xDD, 0xB5,
+    0x69, 0x58, 0xCC, 0x75, 0xC7, 0xA1, 0x21, 0xB2, 0x9B, 0xD5, 0xD5, 0x24, 0x3B, 0xCF, 0x48, 0xEE,
+    0x31, 0x3E, 0x57, 0xC3, 0xAF, 0x5C, 0x71, 0x13, 0x7A, 0x7B, 0xD5, 0x00, 0xD5, 0xFA, 0x68, 0xD4,
+    0x15, 0xE6, 0x2F, 0xAC, 0xE1, 0x90, 0x39, 0x2C, 0x29, 0x9B, 0x4A, 0x44, 0xE2, 0x6F, 0xAD, 0x8F,
+    0x57, 0x7F, 0xA1, 0x7A, 0xCA, 0x26, 0x0B, 0x54, 0xF5, 0xAF, 0x7D, 0xB8, 0x3F, 0xDF, 0x5B, 0x89,
+    0x88, 0xFF, 0xDD, 0xBB, 0xC7, 0xEB, 0xA3, 0xBC, 0xCB, 0x22, 0xC5, 0x8F, 0xAE, 0xA4, 0xEC, 0xED,
+    0xC4, 0xC9, 0x3E, 0xA9, 0xA6, 0x70, 0x6E, 0x9F, 0x1D, 0x9E, 0x2D, 0x15, 0x73, 0x71, 0x72, 0xC6,
+    0x65, 0xB2, 0xAE, 0x53, 0xC1, 0x82, 0x52, 0xEE, 0xAE, 0x29, 0xC3, 0xD5, 0x0B, 0x18, 0x7F, 0x09,
+    0x8C, 0x37, 0x90, 0x7B, 0xED, 0xD0, 0x41, 0x79, 0x54, 0xE4, 0x26, 0x9C, 0xB0, 0x03, 0x16, 0x03,
+    0xC6, 0xE9, 0x77, 0x7E, 0x90, 0x7B, 0x25, 0xF2, 0xAD, 0x9E, 0x95, 0xB4, 0x27, 0xEC, 0x68, 0x5F,
+    0x35, 0x86, 0x58, 0x74, 0xB9, 0xB3, 0x2A, 0xAA, 0xAE, 0x6C, 0x2C, 0x37, 0x8A, 0xD6, 0xF8, 0x1D,
+    0xED, 0xD5, 0xDA, 0x10, 0xA9, 0x3E, 0xFE, 0x93, 0x35, 0x89, 0xB5, 0x15, 0xB2, 0xAE, 0x61, 0xA7,
+    0x86, 0xE4, 0x82, 0xC8, 0x9A, 0x33, 0xB3, 0x59, 0x84, 0x0D, 0x3C, 0xDB, 0xF6, 0x40, 0xFE, 0x5E,
+    0x43, 0x2A, 0x66, 0x99, 0xEA, 0x0D, 0x68, 0xBF, 0x20, 0x15, 0x1C, 0x28, 0x25, 0x89, 0x53, 0x91,
+    0x8E, 0x79, 0x3D, 0x23, 0x95, 0x1C, 0x20, 0x62, 0x49, 0xB5, 0x10, 0x45, 0x44, 0x7A, 0x06, 0xB2,
+    0x40, 0xE9, 0xA8, 0xEA, 0xB4, 0x7D, 0xE7, 0x63, 0x69, 0x16, 0xFA, 0xAC, 0xDF, 0x44, 0xD8, 0xC6,
+    0x42, 0x0C, 0x63, 0x19, 0x9F, 0x01, 0x8C, 0x48, 0x43, 0x7E, 0x77, 0xD5, 0x91, 0x7D, 0x32, 0xCB,
+    0x65, 0x64, 0x53, 0x17, 0x8E, 0x8F, 0xAF, 0xF7, 0x49, 0xC1, 0x38, 0xBE, 0x2E, 0xDF, 0x4F, 0xE9,
+    0x34, 0xA5, 0x34, 0x7C, 0x51, 0xD6, 0xC7, 0xD7, 0xAC, 0x88, 0xF8, 0xF2, 0xC3, 0xFD, 0xFD, 0xBD,
+    0x29, 0xA3, 0x7F, 0x54, 0xED, 0x52, 0x31, 0xA6, 0x16, 0x28, 0xEE, 0x7C, 0xAD, 0x47, 0x8F, 0x45,
+    0x70, 0xBB, 0x8D, 0xC7, 0xF0, 0xE2, 0xA4, 0x96, 0x55, 0x72, 0x34, 0xD6, 0xE2, 0x95, 0x8F, 0x03,
+    0xF3, 0x1F, 0x75, 0x17, 0x59, 0x67, 0x2D, 0xBA, 0xD7, 0x6D, 0x9A, 0x1C, 0xD3, 0xE6, 0x8E, 0xD2,
+    0x15, 0x0D, 0x55, 0x53, 0xD4, 0x69, 0x6E, 0x2C, 0x06, 0xE6, 0x94, 0x70, 0xC2, 0xE5, 0x71, 0xD2,
+    0x4E, 0xD8, 0x1E, 0x0F, 0x73, 0xAE, 0x82, 0xE5, 0x26, 0x58, 0x17, 0xA0, 0xEC, 0x3C, 0x14, 0xEB,
+    0x0F, 0xCF, 0xD5, 0xE2, 0x4D, 0xE1, 0x62, 0x37, 0xCD, 0x4B, 0x5E, 0x17, 0x35, 0xDA, 0x69, 0x47,
+    0x82, 0x35, 0x45, 0x7A, 0x2E, 0x88, 0x88, 0xE4, 0x22, 0x22, 0xCD, 0xB3, 0xAF, 0x3D, 0xFB, 0x5A,
+    0xAD, 0xBD, 0xF6, 0x63, 0x26, 0xC7, 0x2C, 0x95, 0xA2, 0xAA, 0x48, 0x15, 0x8E, 0xB4, 0xD7, 0x7E,
+    0xAC, 0x8E, 0x7A, 0xB8, 0x29, 0x52, 0x75, 0xF6, 0x4C, 0xAA, 0x8D, 0x61, 0x1F, 0xA7, 0xC2, 0x88,
+    0x33, 0x2E, 0x95, 0x3B, 0x3A, 0x1B, 0xB4, 0x7C, 0x44, 0x3A, 0x60, 0x25, 0x11, 0xB4, 0xBC, 0x10,
+    0xA1, 0x08, 0x3C, 0x34, 0x92, 0x70, 0x2C, 0x46, 0x7D, 0xF6, 0x98, 0xBE, 0x4F, 0x09, 0x15, 0x23,
+    0x6A, 0x3F, 0x19, 0x3A, 0x55, 0x42, 0xBF, 0x26, 0x24, 0x6C, 0xE2, 0x88, 0x95, 0x7B, 0xF0, 0x89,
+    0xE6, 0x7B, 0xA5, 0xB3, 0xAF, 0x7C, 0x10, 0x8D, 0xFB, 0xCF, 0xFD, 0xF2, 0x37, 0x4A, 0xF7, 0x5F,
+    0xB4, 0x57, 0x7F, 0xA3, 0x6A, 0xAC, 0x7B, 0xF1, 0x37, 0xE6, 0x94, 0xAD, 0xBF, 0x3C, 0x50, 0xC8,
+    0xDD, 0x55, 0x20, 0xBF, 0x2E, 0xEB, 0x9A, 0x42, 0xBD, 0xF6, 0x1C, 0x98, 0xCC, 0xFD, 0x67, 0xF0,
+    0x2B, 0x59, 0xF3, 0x75, 0x28, 0x45, 0xE4, 0xDB, 0x22, 0xF2, 0x53, 0x49, 0x59, 0x4E, 0x63, 0xA2,
+    0xCE, 0xF1, 0xF1, 0x57, 0x46, 0x08, 0x65, 0xF8, 0x2B, 0x8A, 0x02, 0x7F, 0xF2, 0xCB, 0x4D, 0xD1,
+    0x81, 0x73, 0x5F, 0x8A, 0x48, 0x26, 0x22, 0xEE, 0x6B, 0xB2, 0xBF, 0x97, 0x72, 0x42, 0x52, 0x52,
+    0x6C, 0x36, 0x2E, 0xF4, 0x2E, 0x7D, 0x91, 0x7E, 0x79, 0x44, 0xFD, 0x27, 0x92, 0x8A, 0xC3, 0xD9,
+    0xB1, 0x88, 0xC1, 0xA6, 0x72, 0x82, 0xF6, 0xE3, 0x45, 0xC6, 0x8D, 0x0B, 0x79, 0x3E, 0x95, 0x36,
+    0x88, 0xDC, 0xFB, 0xAB, 0x3B, 0x17, 0x1C, 0xE5, 0x3F, 0x5D, 0xC3, 0x4A, 0x8E, 0xC8, 0xE5, 0x28,
+    0xF1, 0xAF, 0x72, 0xC5, 0x82, 0xC7, 0xEF, 0xAC, 0x3A, 0x0A, 0x09, 0xA8, 0xD5, 0x5B, 0xA9, 0x7E,
+    0x7E, 0xF6, 0xAE, 0xE7, 0xC1, 0xA6, 0x6C, 0xB0, 0x2C, 0x53, 0xC9, 0x2B, 0xE3, 0x8C, 0x63, 0xCE,
+    0x0C, 0x1D, 0xB2, 0x80, 0x6D, 0x8A, 0xB6, 0x88, 0xD8, 0x17, 0xA4, 0x41, 0x24, 0x90, 0xCB, 0x9D,
+    0xB3, 0x71, 0x70, 0xAA, 0x16, 0x30, 0x52, 0x43, 0xD6, 0xF5, 0xC0, 0x76, 0xEE, 0x40, 0xBB, 0x03,
+    0x60, 0xA7, 0x68, 0x40, 0xAF, 0xD7, 0xC7, 0xC7, 0x18, 0x11, 0x59, 0x53, 0x89, 0x48, 0xA0, 0x82,
+    0xC2, 0x65, 0x1D, 0x6C, 0xB3, 0x03, 0x59, 0xAB, 0x6F, 0xB9, 0xE6, 0x12, 0x07, 0x87, 0xBB, 0x99,
+    0x2B, 0xDE, 0x93, 0xB0, 0xCD, 0xEA, 0x3B, 0xAF, 0xBF, 0x57, 0x17, 0xED, 0x73, 0x65, 0x97, 0xF5,
+    0x70, 0x31, 0x15, 0x92, 0xBE, 0xBC, 0x00, 0xF8, 0x72, 0x12, 0x81, 0xAF, 0xFD, 0x0E, 0x20, 0xE2,
+    0x20, 0x4B, 0xB3, 0xB7, 0x77, 0x06, 0xAA, 0x92, 0x9F, 0x39, 0x8E, 0x05, 0x71, 0xCF, 0x94, 0x1F,
+    0x2C, 0x1B, 0x60, 0x6B, 0xF5, 0x16, 0x28, 0x49, 0x6C, 0x58, 0x24, 0x60, 0x3B, 0x9B, 0x47, 0x84,
+    0x19, 0x83, 0x8A, 0x2C, 0x99, 0xE9, 0x40, 0xC4, 0x6A, 0x4F, 0xC4, 0xE6, 0x1D, 0x11, 0x5B, 0xB4,
+    0xAA, 0x67, 0x66, 0xDA, 0x2C, 0xB0, 0x34, 0x4E, 0xED, 0x31, 0x94, 0x0E, 0x88, 0x65, 0x43, 0xCA,
+    0x16, 0x49, 0xA9, 0x22, 0x63, 0x46, 0x8F, 0xF6, 0x64, 0xB2, 0x3E, 0x4A, 0x25, 0x3F, 0xB0, 0x2F,
+    0x88, 0xA7, 0x6C, 0xB2, 0x35, 0x45, 0x4B, 0xE5, 0xB2, 0x30, 0x56, 0x48, 0x8B, 0x09, 0x65, 0x55,
+    0x36, 0x54, 0x4D, 0xD1, 0xA6, 0x32, 0x23, 0x65, 0x47, 0xDC, 0x5A, 0x75, 0x66, 0x2A, 0x05, 0x55,
+    0xF3, 0xEC, 0xDB, 0x7B, 0xE7, 0x8C, 0x47, 0x39, 0x6E, 0xC8, 0x45, 0x3C, 0xEA, 0xD9, 0xB7, 0x9F,
+    0x3A, 0x7B, 0x26, 0x49, 0x8D, 0x73, 0x45, 0x15, 0xB3, 0xD6, 0x03, 0xDB, 0x06, 0xD0, 0xB7, 0xBA,
+    0xA9, 0x3E, 0xE4, 0x4A, 0x04, 0xE6, 0x22, 0x1D, 0xA5, 0xE8, 0x7F, 0x43, 0xDE, 0xFB, 0xAB, 0x30,
+    0x3C, 0x5A, 0xD4, 0xD8, 0x6F, 0x76, 0x9E, 0xDC, 0x5F, 0x32, 0x70, 0xA2, 0x9D, 0xC7, 0xB8, 0xED,
+    0x47, 0xCF, 0xE6, 0xDA, 0x24, 0x9D, 0xA2, 0xAA, 0x99, 0x7E, 0x7A, 0x24, 0xE5, 0x2E, 0xC4, 0xD3,
+    0x3D, 0x3C, 0x67, 0x53, 0xF9, 0xAA, 0x08, 0xA0, 0x8E, 0x57, 0xEB, 0x63, 0xAC, 0x88, 0x78, 0x2D,
+    0xE3, 0xCF, 0xD5, 0x00, 0xFA, 0xB6, 0x83, 0xAB, 0xDB, 0x50, 0x7C, 0xB9, 0xA1, 0x92, 0x7E, 0xF3,
+    0x73, 0x5C, 0x75, 0xDE, 0xE9, 0xC8, 0x32, 0x95, 0xE4, 0x1A, 0xA6, 0x9F, 0xD9, 0x8A, 0xAA, 0xA7,
+    0x6A, 0xAA, 0xBA, 0xF0, 0x7A, 0x7D, 0x3D, 0x62, 0xA7, 0x1B, 0x66, 0x54, 0xD3, 0x75, 0x45, 0x67,
+    0x1C, 0xF3, 0x29, 0xA5, 0xF8, 0x64, 0x4C, 0x29, 0xCE, 0x7B, 0x7D, 0xF7, 0x05, 0x61, 0x2E, 0xD2,
+    0x14, 0x22, 0x0D, 0xFA, 0xA5, 0x16, 0xB6, 0xB7, 0x21, 0x7F, 0xDE, 0xC1, 0xC5, 0x8B, 0x70, 0x0E,
+    0x59, 0xBD, 0xB5, 0xC7, 0x3E, 0x60, 0xA4, 0x99, 0x0F, 0xA0, 0x25, 0x94, 0xE2, 0x60, 0x9E, 0x72,
+    0xA4, 0x8C, 0x9B, 0xCA, 0x08, 0x17, 0x6D, 0x12, 0xDB, 0x31, 0x69, 0x0D, 0xC6, 0x81, 0x5A, 0x25,
+    0x4E, 0x22, 0xA9, 0xFC, 0xCC, 0xD6, 0x6A, 0xFF, 0xE9, 0x3B, 0x7B, 0x8C, 0xE5, 0x82, 0x61, 0xB1,
+    0x49, 0x97, 0x98, 0x9D, 0x6D, 0xA2, 0x49, 0xD1, 0xE2, 0xB0, 0xA9, 0x44, 0x30, 0xEA, 0x9C, 0xE3,
+    0x6F, 0xE2, 0x64, 0x81, 0x11, 0x27, 0xC7, 0x54, 0x43, 0x78, 0x2A, 0xBB, 0x9F, 0xEC, 0x82, 0xA9,
+    0xFA, 0x30, 0x6A, 0x6C, 0xA2, 0xAA, 0xA7, 0x26, 0x4C, 0x6A, 0x42, 0x9D, 0x6D, 0x22, 0x92, 0x7B,
+    0x78, 0x70, 0xDE, 0xFC, 0x07, 0x03, 0xB0, 0xF2, 0x5A, 0x1A, 0x28, 0xFA, 0x54, 0x3B, 0x69, 0x04,
+    0xF4, 0x83, 0xF4, 0x0F, 0x81, 0x96, 0x70, 0x02, 0xB9, 0x27, 0x15, 0xD9, 0x5A, 0x6C, 0xF6, 0x4F,
+    0xBD, 0xD1, 0xE4, 0xD4, 0x6A, 0x9D, 0x79, 0x8C, 0xAC, 0xB5, 0x67, 0x6B, 0xF5, 0x54, 0xAA, 0x2C,
+    0x97, 0x77, 0xB0, 0x18, 0xCB, 0x3A, 0x9D, 0x2D, 0xE4, 0x67, 0x1A, 0xB2, 0x30, 0xFE, 0xB4, 0xC3,
+    0xA6, 0x9C, 0x5F, 0x3A, 0xE6, 0xDD, 0x58, 0x09, 0x6A, 0x79, 0xE6, 0x51, 0x91, 0x64, 0xE9, 0x50,
+    0xD6, 0x63, 0xE1, 0x28, 0xEE, 0x57, 0x0A, 0x39, 0x02, 0xFC, 0x0F, 0x29, 0x83, 0xCD, 0x33, 0x69,
+    0x69, 0x69, 0x2C, 0x0F, 0x03, 0xD2, 0xCF, 0x40, 0x4B, 0x58, 0x42, 0xEE, 0x4F, 0x9B, 0x1E, 0x1F,
+    0x90, 0x9A, 0x26, 0x0B, 0xA8, 0xD5, 0x5A, 0x9F, 0x1D, 0x4B, 0xF7, 0xF3, 0xC6, 0x52, 0x9E, 0x1D,
+    0x0B, 0x3F, 0x6F, 0x2C, 0xF1, 0xCC, 0x58, 0xFA, 0xFF, 0x37, 0x63, 0x49, 0x78, 0x0B, 0x2D, 0x5D,
+    0x29, 0x8F, 0xD7, 0x60, 0xE5, 0x71, 0x89, 0xA9, 0x4A, 0x8C, 0xE9, 0xC6, 0xA7, 0x58, 0x74, 0xB7,
+    0x59, 0x34, 0x9B, 0x05, 0x41, 0x31, 0xAE, 0xDA, 0xB4, 0x40, 0x8D, 0x1B, 0x2D, 0xF2, 0x19, 0x3C,
+    0xF3, 0xE1, 0xFE, 0xFC, 0xBB, 0x2A, 0x8C, 0x8B, 0x26, 0xF9, 0x30, 0x36, 0x63, 0x49, 0xC4, 0x37,
+    0x6E, 0x24, 0xC3, 0x8C, 0xCC, 0x53, 0xD5, 0xE3, 0x52, 0xDD, 0x3C, 0xD0, 0x8F, 0x65, 0xAE, 0x4D,
+    0x33, 0xAE, 0xE9, 0xD9, 0xB8, 0xD8, 0xB2, 0xA9, 0xD9, 0x44, 0xB7, 0x94, 0x22, 0xA2, 0x3D, 0x65,
+    0xA3, 0xFA, 0x71, 0xD1, 0xE6, 0x2D, 0x1C, 0x8E, 0x24, 0x9C, 0x76, 0xC0, 0x66, 0x75, 0x4F, 0x2B,
+    0x17, 0xD5, 0x9F, 0x9E, 0x99, 0x03, 0xFC, 0xE6, 0x9A, 0x3F, 0x4A, 0x45, 0x54, 0xD2, 0xF2, 0x25,
+    0x5B, 0x8F, 0x7A, 0xC3, 0x86, 0x52, 0x7B, 0x23, 0xA5, 0xBE, 0xD2, 0x7E, 0x1A, 0xA5, 0xF2, 0x89,
+    0x52, 0x65, 0x3D, 0x52, 0x6A, 0x39, 0x52, 0x4A, 0xFB, 0x4F, 0xA3, 0x54, 0xF6, 0xCB, 0xA5, 0xD4,
+    0xE1, 0xDF, 0x30, 0xA5, 0x54, 0x32, 0xFB, 0x53, 0x00, 0xAD, 0x4C, 0xE1, 0x8E, 0xB5, 0x5A, 0x27,
+    0x6E, 0x91, 0x32, 0xE1, 0x46, 0x1D, 0xA4, 0x4C, 0x59, 0x8D, 0x0B, 0xA0, 0x6C, 0x2A, 0x09, 0xB0,
+    0xD4, 0x22, 0x2D, 0xDA, 0x6F, 0x9D, 0xEC, 0x4F, 0xA5, 0x3D, 0xC7, 0xEA, 0x9D, 0xAA, 0x1F, 0xF3,
+    0xEB, 0xC6, 0xAA, 0x2F, 0x63, 0x13, 0x55, 0x7D, 0xA6, 0x59, 0xED, 0x49, 0x46, 0x13, 0x68, 0xCF,
+    0x21, 0x67, 0x9A, 0x18, 0x4B, 0x8E, 0x54, 0xB7, 0x12, 0xD9, 0x86, 0x04, 0x43, 0x4E, 0x29, 0x1B,
+    0x0F, 0x6C, 0x7C, 0xB1, 0x55, 0x7D, 0x06, 0x8D, 0x91, 0xAC, 0xE2, 0x5F, 0x59, 0x25, 0x5A, 0xA4,
+    0xE1, 0x9D, 0x7A, 0x4B, 0xFF, 0xEA, 0x51, 0xA6, 0x46, 0x17, 0x54, 0xF5, 0xE8, 0xEE, 0xA2, 0x92,
+    0xB6, 0x92, 0x90, 0x8B, 0x3C, 0x2F, 0xE2, 0xEC, 0x77, 0x17, 0x5B, 0x27, 0xFB, 0x59, 0xFA, 0x39,
+    0xC2, 0xB1, 0x6E, 0xF8, 0x98, 0x66, 0x39, 0x4F, 0x41, 0x7C, 0x69, 0xC8, 0x3B, 0x90, 0x96, 0xAA,
+    0x86, 0xD5, 0xD8, 0x6C, 0xAB, 0x3D, 0x50, 0xB9, 0x91, 0x93, 0x1F, 0x42, 0xFA, 0x4D, 0x47, 0xC8,
+    0x7D, 0xD1, 0xB2, 0xC3, 0xAA, 0xAE, 0x6E, 0x21, 0xD2, 0x33, 0x1F, 0x94, 0x48, 0xCD, 0x3C, 0xB0,
+    0x55, 0x7F, 0xD2, 0x53, 0x33, 0xC1, 0xB5, 0xC7, 0xFA, 0x23, 0x66, 0x7C, 0x1F, 0xA3, 0x9E, 0x66,
+    0x7C, 0x1F, 0xCB, 0x91, 0x99, 0xB7, 0x2E, 0x0C, 0x23, 0xB0, 0x60, 0x18, 0xD3, 0x64, 0x07, 0x40,
+    0x6E, 0x7D, 0x5F, 0x0F, 0x60, 0x64, 0x15, 0x8A, 0x01, 0x44, 0xA4, 0xAB, 0x86, 0xF4, 0xD3, 0x71,
+    0xC9, 0x71, 0xE2, 0x73, 0x19, 0x8C, 0x88, 0x30, 0x97, 0xC1, 0x8A, 0xF8, 0x5C, 0x24, 0xD8, 0x31,
+    0x9B, 0xC5, 0xCA, 0x30, 0x56, 0xF5, 0x0A, 0xA5, 0x48, 0x9D, 0xB6, 0x44, 0x48, 0xD5, 0x7F, 0xA4,
+    0x06, 0x2B, 0xCF, 0x48, 0x00, 0xAC, 0x37, 0xC9, 0xF8, 0x73, 0x29, 0x37, 0xC1, 0x8E, 0x73, 0x60,
+    0x9F, 0x19, 0x7F, 0xB9, 0x65, 0x9C, 0x92, 0x71, 0x82, 0x52, 0xF1, 0x00, 0xE0, 0xB7, 0xCF, 0x0C,
+    0xF6, 0xFF, 0x06,
 };
 
 static const EpdGlyph notosans_16_italicGlyphs[] = {
@@ -2400,7 +2425,7 @@ static const EpdGlyph notosans_16_italicGlyphs[] = {
     { 4, 35, 18, 8, 26, 35, 8990 }, // |
     { 14, 30, 12, -2, 24, 105, 9025 }, // }
     { 17, 5, 19, 2, 14, 22, 9130 }, // ~
-    { 0, 0, 9, 0, 0, 0, 0 }, //  
+    { 0, 0, 9, 0, 0, 0, 9152 }, //  
     { 10, 26, 9, -1, 19, 65, 0 }, // ¡
     { 15, 26, 18, 3, 25, 98, 65 }, // ¢
     { 21, 25, 18, -1, 25, 132, 163 }, // £
@@ -2411,774 +2436,781 @@ static const EpdGlyph notosans_16_italicGlyphs[] = {
     { 10, 4, 18, 7, 25, 10, 616 }, // ¨
     { 26, 26, 28, 1, 25, 169, 626 }, // ©
     { 11, 13, 11, 2, 25, 36, 795 }, // ª
-    { 15, 15, 16, 1, 16, 57, 831 }, // «
-    { 16, 9, 19, 2, 13, 36, 888 }, // ¬
-    { 10, 4, 10, 0, 11, 10, 924 }, // ­
-    { 26, 26, 28, 1, 25, 169, 934 }, // ®
-    { 15, 3, 13, 3, 28, 12, 1103 }, // ¯
-    { 12, 12, 14, 1, 25, 36, 1115 }, // °
-    { 17, 20, 19, 2, 20, 85, 1151 }, // ±
-    { 12, 16, 12, 2, 29, 48, 1236 }, // ²
-    { 12, 16, 12, 2, 29, 48, 1284 }, // ³
-    { 8, 6, 9, 3, 26, 12, 1332 }, // ´
-    { 20, 26, 20, -1, 18, 130, 1344 }, // µ
-    { 17, 31, 22, 3, 26, 132, 1474 }, // ¶
-    { 5, 6, 9, 2, 15, 8, 1606 }, // ·
-    { 7, 8, 7, -3, 0, 14, 1614 }, // ¸
-    { 8, 16, 12, 4, 29, 32, 1628 }, // ¹
-    { 11, 13, 11, 2, 25, 36, 1660 }, // º
-    { 15, 15, 16, 0, 16, 57, 1696 }, // »
-    { 22, 26, 24, 2, 25, 143, 1753 }, // ¼
-    { 24, 26, 27, 2, 25, 156, 1896 }, // ½
-    { 25, 26, 26, 1, 25, 163, 2052 }, // ¾
-    { 13, 26, 14, -1, 19, 85, 2215 }, // ¿
-    { 20, 32, 19, -2, 32, 160, 2300 }, // À
-    { 21, 32, 19, -2, 32, 168, 2460 }, // Á
-    { 20, 32, 19, -2, 32, 160, 2628 }, // Â
-    { 22, 31, 19, -2, 31, 171, 2788 }, // Ã
-    { 20, 31, 19, -2, 31, 155, 2959 }, // Ä
-    { 20, 34, 19, -2, 34, 170, 3114 }, // Å
-    { 31, 24, 27, -2, 24, 186, 3284 }, // Æ
-    { 20, 33, 20, 2, 25, 165, 3470 }, // Ç
-    { 18, 32, 17, 1, 32, 144, 3635 }, // È
-    { 18, 32, 17, 1, 32, 144, 3779 }, // É
-    { 18, 32, 17, 1, 32, 144, 3923 }, // Ê
-    { 18, 31, 17, 1, 31, 140, 4067 }, // Ë
-    { 14, 32, 11, -1, 32, 112, 4207 }, // Ì
-    { 16, 32, 11, -1, 32, 128, 4319 }, // Í
-    { 15, 32, 11, -1, 32, 120, 4447 }, // Î
-    { 15, 31, 11, -1, 31, 117, 4567 }, // Ï
-    { 21, 24, 22, 1, 24, 126, 4684 }, // Ð
-    { 23, 31, 24, 1, 31, 179, 4810 }, // Ñ
-    { 21, 33, 24, 2, 32, 174, 4989 }, // Ò
-    { 21, 33, 24, 2, 32, 174, 5163 }, // Ó
-    { 21, 33, 24, 2, 32, 174, 5337 }, // Ô
-    { 21, 32, 24, 2, 31, 168, 5511 }, // Õ
-    { 21, 32, 24, 2, 31, 168, 5679 }, // Ö
-    { 16, 16, 19, 2, 20, 64, 5847 }, // ×
-    { 23, 28, 24, 1, 26, 161, 5911 }, // Ø
-    { 21, 33, 23, 2, 32, 174, 6072 }, // Ù
-    { 21, 33, 23, 2, 32, 174, 6246 }, // Ú
-    { 21, 33, 23, 2, 32, 174, 6420 }, // Û
-    { 21, 32, 23, 2, 31, 168, 6594 }, // Ü
-    { 18, 32, 17, 3, 32, 144, 6762 }, // Ý
-    { 18, 24, 19, 1, 24, 108, 6906 }, // Þ
-    { 24, 34, 19, -5, 26, 204, 7014 }, // ß
-    { 18, 27, 19, 1, 26, 122, 7218 }, // à
-    { 18, 27, 19, 1, 26, 122, 7340 }, // á
-    { 18, 27, 19, 1, 26, 122, 7462 }, // â
-    { 18, 26, 19, 1, 25, 117, 7584 }, // ã
-    { 18, 26, 19, 1, 25, 117, 7701 }, // ä
-    { 18, 29, 19, 1, 28, 131, 7818 }, // å
-    { 26, 20, 27, 1, 19, 130, 7949 }, // æ
-    { 15, 27, 15, 1, 19, 102, 8079 }, // ç
-    { 15, 27, 17, 1, 26, 102, 8181 }, // è
-    { 16, 27, 17, 1, 26, 108, 8283 }, // é
-    { 15, 27, 17, 1, 26, 102, 8391 }, // ê
-    { 15, 26, 17, 1, 25, 98, 8493 }, // ë
-    { 9, 26, 9, 0, 26, 59, 8591 }, // ì
-    { 12, 26, 9, 0, 26, 78, 8650 }, // í
-    { 12, 26, 9, 0, 26, 78, 8728 }, // î
-    { 12, 25, 9, 0, 25, 75, 8806 }, // ï
-    { 18, 27, 19, 1, 26, 122, 8881 }, // ð
-    { 19, 25, 19, 0, 25, 119, 9003 }, // ñ
-    { 17, 27, 19, 1, 26, 115, 9122 }, // ò
-    { 17, 27, 19, 1, 26, 115, 9237 }, // ó
-    { 17, 27, 19, 1, 26, 115, 9352 }, // ô
-    { 17, 26, 19, 1, 25, 111, 9467 }, // õ
-    { 17, 26, 19, 1, 25, 111, 9578 }, // ö
-    { 17, 16, 19, 2, 20, 68, 9689 }, // ÷
-    { 18, 22, 19, 0, 20, 99, 9757 }, // ø
-    { 18, 27, 19, 1, 26, 122, 9856 }, // ù
-    { 18, 27, 19, 1, 26, 122, 9978 }, // ú
-    { 18, 27, 19, 1, 26, 122, 10100 }, // û
-    { 18, 26, 19, 1, 25, 117, 10222 }, // ü
-    { 22, 34, 16, -4, 26, 187, 10339 }, // ý
-    { 19, 34, 19, -1, 26, 162, 10526 }, // þ
-    { 22, 33, 16, -4, 25, 182, 10688 }, // ÿ
-    { 20, 29, 19, -2, 29, 145, 0 }, // Ā
-    { 18, 24, 19, 1, 23, 108, 145 }, // ā
-    { 21, 31, 19, -2, 31, 163, 253 }, // Ă
-    { 18, 26, 19, 1, 25, 117, 416 }, // ă
-    { 20, 32, 19, -2, 24, 160, 533 }, // Ą
-    { 18, 27, 19, 1, 19, 122, 693 }, // ą
-    { 20, 33, 20, 2, 32, 165, 815 }, // Ć
-    { 15, 27, 15, 1, 26, 102, 980 }, // ć
-    { 20, 33, 20, 2, 32, 165, 1082 }, // Ĉ
-    { 15, 27, 15, 1, 26, 102, 1247 }, // ĉ
-    { 20, 32, 20, 2, 31, 160, 1349 }, // Ċ
-    { 15, 26, 15, 1, 25, 98, 1509 }, // ċ
-    { 20, 33, 20, 2, 32, 165, 1607 }, // Č
-    { 16, 27, 15, 1, 26, 108, 1772 }, // č
-    { 21, 32, 22, 1, 32, 168, 1880 }, // Ď
-    { 25, 27, 20, 1, 26, 169, 2048 }, // ď
-    { 21, 24, 22, 1, 24, 126, 2217 }, // Đ
-    { 21, 27, 19, 1, 26, 142, 2343 }, // đ
-    { 18, 29, 17, 1, 29, 131, 2485 }, // Ē
-    { 15, 24, 17, 1, 23, 90, 2616 }, // ē
-    { 18, 31, 17, 1, 31, 140, 2706 }, // Ĕ
-    { 16, 26, 17, 1, 25, 104, 2846 }, // ĕ
-    { 18, 31, 17, 1, 31, 140, 2950 }, // Ė
-    { 15, 26, 17, 1, 25, 98, 3090 }, // ė
-    { 18, 32, 17, 1, 24, 144, 3188 }, // Ę
-    { 15, 27, 17, 1, 19, 102, 3332 }, // ę
-    { 18, 32, 17, 1, 32, 144, 3434 }, // Ě
-    { 16, 27, 17, 1, 26, 108, 3578 }, // ě
-    { 21, 33, 23, 2, 32, 174, 3686 }, // Ĝ
-    { 19, 34, 19, 0, 26, 162, 3860 }, // ĝ
-    { 21, 32, 23, 2, 31, 168, 4022 }, // Ğ
-    { 19, 33, 19, 0, 25, 157, 4190 }, // ğ
-    { 21, 32, 23, 2, 31, 168, 4347 }, // Ġ
-    { 19, 33, 19, 0, 25, 157, 4515 }, // ġ
-    { 21, 33, 23, 2, 25, 174, 4672 }, // Ģ
-    { 19, 34, 19, 0, 26, 162, 4846 }, // ģ
-    { 22, 32, 23, 1, 32, 176, 5008 }, // Ĥ
-    { 18, 33, 19, 0, 33, 149, 5184 }, // ĥ
-    { 25, 24, 23, 1, 24, 150, 5333 }, // Ħ
-    { 18, 26, 19, 0, 26, 117, 5483 }, // ħ
-    { 17, 31, 11, -1, 31, 132, 5600 }, // Ĩ
-    { 14, 25, 9, 0, 25, 88, 5732 }, // ĩ
-    { 15, 29, 11, -1, 29, 109, 5820 }, // Ī
-    { 12, 23, 9, 0, 23, 69, 5929 }, // ī
-    { 16, 31, 11, -1, 31, 124, 5998 }, // Ĭ
-    { 13, 25, 9, 0, 25, 82, 6122 }, // ĭ
-    { 14, 32, 11, -1, 24, 112, 6204 }, // Į
-    { 11, 33, 9, -2, 25, 91, 6316 }, // į
-    { 14, 31, 11, -1, 31, 109, 6407 }, // İ
-    { 8, 18, 9, 0, 18, 36, 6516 }, // ı
-    { 22, 31, 20, -1, 24, 171, 6552 }, // Ĳ
-    { 18, 33, 17, 0, 25, 149, 6723 }, // ĳ
-    { 20, 39, 9, -6, 32, 195, 6872 }, // Ĵ
-    { 17, 34, 9, -5, 26, 145, 7067 }, // ĵ
-    { 21, 32, 19, 1, 24, 168, 7212 }, // Ķ
-    { 18, 34, 17, 0, 26, 153, 7380 }, // ķ
-    { 18, 18, 17, 0, 18, 81, 7533 }, // ĸ
-    { 14, 32, 16, 1, 32, 112, 7614 }, // Ĺ
-    { 14, 33, 9, 0, 33, 116, 7726 }, // ĺ
-    { 13, 32, 16, 1, 24, 104, 7842 }, // Ļ
-    { 12, 34, 9, -2, 26, 102, 7946 }, // ļ
-    { 17, 24, 16, 1, 24, 102, 8048 }, // Ľ
-    { 15, 26, 10, 0, 26, 98, 8150 }, // ľ
-    { 14, 24, 16, 1, 24, 84, 8248 }, // Ŀ
-    { 12, 26, 10, 0, 26, 78, 8332 }, // ŀ
-    { 14, 24, 16, 0, 24, 84, 8410 }, // Ł
-    { 10, 26, 9, 0, 26, 65, 8494 }, // ł
-    { 23, 32, 24, 1, 32, 184, 8559 }, // Ń
-    { 18, 26, 19, 0, 26, 117, 8743 }, // ń
-    { 23, 32, 24, 1, 24, 184, 8860 }, // Ņ
-    { 18, 27, 19, 0, 19, 122, 9044 }, // ņ
-    { 23, 32, 24, 1, 32, 184, 9166 }, // Ň
-    { 19, 26, 19, 0, 26, 124, 9350 }, // ň
-    { 20, 24, 22, 1, 24, 120, 9474 }, // ŉ
-    { 23, 31, 24, 1, 24, 179, 9594 }, // Ŋ
-    { 18, 27, 19, 0, 19, 122, 9773 }, // ŋ
-    { 21, 30, 24, 2, 29, 158, 9895 }, // Ō
-    { 17, 24, 19, 1, 23, 102, 10053 }, // ō
-    { 21, 32, 24, 2, 31, 168, 10155 }, // Ŏ
-    { 17, 26, 19, 1, 25, 111, 10323 }, // ŏ
-    { 23, 33, 24, 2, 32, 190, 10434 }, // Ő
-    { 19, 27, 19, 1, 26, 129, 10624 }, // ő
-    { 28, 26, 29, 2, 25, 182, 10753 }, // Œ
-    { 27, 20, 29, 1, 19, 135, 10935 }, // œ
-    { 18, 32, 19, 1, 32, 144, 11070 }, // Ŕ
-    { 16, 26, 13, 0, 26, 104, 11214 }, // ŕ
-    { 18, 32, 19, 1, 24, 144, 11318 }, // Ŗ
-    { 17, 27, 13, -2, 19, 115, 11462 }, // ŗ
-    { 19, 32, 19, 1, 32, 152, 11577 }, // Ř
-    { 17, 26, 13, 0, 26, 111, 11729 }, // ř
-    { 18, 33, 17, 0, 32, 149, 11840 }, // Ś
-    { 15, 27, 14, 0, 26, 102, 11989 }, // ś
-    { 18, 33, 17, 0, 32, 149, 12091 }, // Ŝ
-    { 15, 27, 14, 0, 26, 102, 12240 }, // ŝ
-    { 18, 33, 17, 0, 25, 149, 12342 }, // Ş
-    { 14, 27, 14, 0, 19, 95, 12491 }, // ş
-    { 18, 33, 17, 0, 32, 149, 12586 }, // Š
-    { 16, 27, 14, 0, 26, 108, 12735 }, // š
-    { 18, 32, 17, 2, 24, 144, 12843 }, // Ţ
-    { 12, 30, 11, 1, 22, 90, 12987 }, // ţ
-    { 17, 32, 17, 3, 32, 136, 13077 }, // Ť
-    { 14, 27, 11, 1, 26, 95, 13213 }, // ť
-    { 18, 24, 17, 2, 24, 108, 13308 }, // Ŧ
-    { 13, 23, 11, 0, 22, 75, 13416 }, // ŧ
-    { 21, 32, 23, 2, 31, 168, 13491 }, // Ũ
-    { 18, 26, 19, 1, 25, 117, 13659 }, // ũ
-    { 21, 30, 23, 2, 29, 158, 13776 }, // Ū
-    { 18, 24, 19, 1, 23, 108, 13934 }, // ū
-    { 21, 32, 23, 2, 31, 168, 14042 }, // Ŭ
-    { 18, 26, 19, 1, 25, 117, 14210 }, // ŭ
-    { 21, 35, 23, 2, 34, 184, 14327 }, // Ů
-    { 18, 29, 19, 1, 28, 131, 14511 }, // ů
-    { 22, 33, 23, 2, 32, 182, 14642 }, // Ű
-    { 20, 27, 19, 1, 26, 135, 14824 }, // ű
-    { 21, 32, 23, 2, 24, 168, 14959 }, // Ų
-    { 18, 26, 19, 1, 18, 117, 15127 }, // ų
-    { 29, 32, 29, 3, 32, 232, 15244 }, // Ŵ
-    { 25, 26, 24, 1, 26, 163, 15476 }, // ŵ
-    { 18, 32, 17, 3, 32, 144, 15639 }, // Ŷ
-    { 22, 34, 16, -4, 26, 187, 15783 }, // ŷ
-    { 18, 31, 17, 3, 31, 140, 15970 }, // Ÿ
-    { 21, 32, 18, -1, 32, 168, 16110 }, // Ź
-    { 17, 26, 15, -1, 26, 111, 16278 }, // ź
-    { 21, 31, 18, -1, 31, 163, 16389 }, // Ż
-    { 16, 25, 15, -1, 25, 100, 16552 }, // ż
-    { 21, 32, 18, -1, 32, 168, 16652 }, // Ž
-    { 17, 26, 15, -1, 26, 111, 16820 }, // ž
-    { 20, 34, 9, -5, 26, 170, 16931 }, // ſ
-    { 6, 6, 0, -13, 26, 9, 0 }, // ̀
-    { 8, 6, 0, -8, 26, 12, 9 }, // ́
-    { 11, 6, 0, -3, 26, 17, 21 }, // ̂
-    { 13, 5, 0, -14, 25, 17, 38 }, // ̃
-    { 11, 3, 0, -3, 23, 9, 55 }, // ̄
-    { 14, 4, 0, -3, 29, 14, 64 }, // ̅
-    { 10, 5, 0, -2, 25, 13, 78 }, // ̆
-    { 4, 5, 0, 1, 25, 5, 91 }, // ̇
-    { 10, 4, 0, -2, 25, 10, 96 }, // ̈
-    { 7, 9, 0, -10, 28, 16, 106 }, // ̉
-    { 8, 8, 0, -1, 28, 16, 122 }, // ̊
-    { 13, 6, 0, -2, 26, 20, 138 }, // ̋
-    { 11, 6, 0, -2, 26, 17, 158 }, // ̌
-    { 6, 10, 0, 0, 26, 15, 175 }, // ̍
-    { 10, 7, 0, -2, 26, 18, 190 }, // ̎
-    { 12, 6, 0, -17, 26, 18, 208 }, // ̏
-    { 11, 9, 0, -2, 29, 25, 226 }, // ̐
-    { 11, 5, 0, -3, 25, 14, 251 }, // ̑
-    { 7, 9, 0, -1, 24, 16, 265 }, // ̒
-    { 7, 9, 0, -1, 24, 16, 281 }, // ̓
-    { 5, 9, 0, 0, 24, 12, 297 }, // ̔
-    { 7, 9, 0, -1, 24, 16, 309 }, // ̕
-    { 7, 6, 0, -7, -1, 11, 325 }, // ̖
-    { 8, 6, 0, -5, -1, 12, 336 }, // ̗
-    { 8, 8, 0, -6, 0, 16, 348 }, // ̘
-    { 8, 8, 0, -7, 0, 16, 364 }, // ̙
-    { 10, 10, 11, 3, 26, 25, 380 }, // ̚
-    { 8, 8, 0, -2, 26, 16, 405 }, // ̛
-    { 5, 8, 0, -2, 0, 10, 421 }, // ̜
-    { 8, 6, 0, -7, -1, 12, 431 }, // ̝
-    { 8, 6, 0, -6, -1, 12, 443 }, // ̞
-    { 9, 8, 0, -7, 0, 18, 455 }, // ̟
-    { 8, 3, 0, -7, -2, 6, 473 }, // ̠
-    { 8, 10, 0, -7, 2, 20, 479 }, // ̡
-    { 7, 10, 0, -4, 2, 18, 499 }, // ̢
-    { 4, 4, 0, -14, -2, 4, 517 }, // ̣
-    { 10, 4, 0, -8, -2, 10, 521 }, // ̤
-    { 8, 8, 0, -7, 0, 16, 531 }, // ̥
-    { 6, 6, 0, 2, -2, 9, 547 }, // ̦
-    { 7, 8, 0, -6, 0, 14, 556 }, // ̧
-    { 6, 8, 0, -5, 0, 12, 570 }, // ̨
-    { 5, 10, 0, -5, -1, 13, 582 }, // ̩
-    { 14, 7, 0, -10, -1, 25, 595 }, // ̪
-    { 14, 4, 0, -9, -2, 14, 620 }, // ̫
-    { 11, 6, 0, -7, -1, 17, 634 }, // ̬
-    { 11, 6, 0, -8, -1, 17, 651 }, // ̭
-    { 10, 5, 0, -7, -1, 13, 668 }, // ̮
-    { 11, 5, 0, -8, -1, 14, 681 }, // ̯
-    { 13, 5, 0, -9, -1, 17, 695 }, // ̰
-    { 10, 3, 0, -8, -2, 8, 712 }, // ̱
-    { 15, 3, 0, -10, -3, 12, 720 }, // ̲
-    { 15, 8, 0, -10, 0, 30, 732 }, // ̳
-    { 14, 5, 0, -7, 12, 18, 762 }, // ̴
-    { 14, 4, 0, -7, 12, 14, 780 }, // ̵
-    { 24, 3, 0, -12, 11, 18, 794 }, // ̶
-    { 10, 8, 0, -5, 14, 20, 812 }, // ̷
-    { 20, 28, 0, -10, 26, 140, 832 }, // ̸
-    { 5, 8, 0, -2, 0, 10, 972 }, // ̹
-    { 14, 7, 0, -10, -1, 25, 982 }, // ̺
-    { 14, 8, 0, -10, 0, 28, 1007 }, // ̻
-    { 13, 4, 0, -9, -2, 13, 1035 }, // ̼
-    { 8, 7, 0, -1, 26, 14, 1048 }, // ̽
-    { 8, 10, 0, -1, 29, 20, 1062 }, // ̾
-    { 15, 8, 0, -3, 33, 30, 1082 }, // ̿
-    { 7, 6, 0, -2, 26, 11, 1112 }, // ̀
-    { 8, 6, 0, 1, 26, 12, 1123 }, // ́
-    { 13, 5, 0, 5, 25, 17, 1135 }, // ͂
-    { 5, 6, 0, 1, 26, 8, 1152 }, // ̓
-    { 13, 6, 0, -3, 26, 20, 1160 }, // ̈́
-    { 6, 6, 0, -4, -2, 9, 1180 }, // ͅ
-    { 16, 7, 0, -5, 26, 28, 1189 }, // ͆
-    { 16, 8, 0, -10, 0, 32, 1217 }, // ͇
-    { 10, 7, 0, -8, -1, 18, 1249 }, // ͈
-    { 8, 6, 0, -6, -2, 12, 1267 }, // ͉
-    { 14, 8, 0, -4, 26, 28, 1279 }, // ͊
-    { 13, 12, 0, -3, 31, 39, 1307 }, // ͋
-    { 13, 9, 0, -3, 29, 30, 1346 }, // ͌
-    { 13, 7, 0, -9, -1, 23, 1376 }, // ͍
-    { 7, 8, 0, -6, 0, 14, 1399 }, // ͎
-    { 24, 24, 0, -12, 24, 144, 1413 }, // ͏
-    { 6, 8, 0, 0, 27, 12, 1557 }, // ͐
-    { 5, 8, 0, 4, 28, 10, 1569 }, // ͑
-    { 10, 9, 0, -2, 29, 23, 1579 }, // ͒
-    { 8, 7, 0, -6, -1, 14, 1602 }, // ͓
-    { 6, 7, 0, -5, -1, 11, 1616 }, // ͔
-    { 7, 7, 0, -5, -1, 13, 1627 }, // ͕
-    { 13, 7, 0, -8, -1, 23, 1640 }, // ͖
-    { 5, 8, 0, 3, 28, 10, 1663 }, // ͗
-    { 4, 5, 0, 1, 25, 5, 1673 }, // ͘
-    { 9, 7, 0, -7, -1, 16, 1678 }, // ͙
-    { 13, 8, 0, -9, 0, 26, 1694 }, // ͚
-    { 7, 8, 0, 0, 27, 14, 1720 }, // ͛
-    { 24, 7, 0, -14, -1, 42, 1734 }, // ͜
-    { 24, 7, 0, -9, 26, 42, 1776 }, // ͝
-    { 18, 3, 0, -6, 23, 14, 1818 }, // ͞
-    { 17, 3, 0, -11, -2, 13, 1832 }, // ͟
-    { 26, 5, 0, -10, 25, 33, 1845 }, // ͠
-    { 24, 7, 0, -9, 29, 42, 1878 }, // ͡
-    { 25, 7, 0, -16, -1, 44, 1920 }, // ͢
-    { 9, 8, 0, -1, 28, 18, 1964 }, // ͣ
-    { 7, 8, 0, 0, 28, 14, 1982 }, // ͤ
-    { 5, 11, 0, 1, 31, 14, 1996 }, // ͥ
-    { 8, 8, 0, -1, 28, 16, 2010 }, // ͦ
-    { 9, 8, 0, -1, 28, 18, 2026 }, // ͧ
-    { 7, 8, 0, 0, 28, 14, 2044 }, // ͨ
-    { 9, 11, 0, -1, 31, 25, 2058 }, // ͩ
-    { 8, 11, 0, -1, 31, 22, 2083 }, // ͪ
-    { 12, 8, 0, -3, 28, 24, 2105 }, // ͫ
-    { 7, 8, 0, 0, 28, 14, 2129 }, // ͬ
-    { 6, 10, 0, 1, 30, 15, 2143 }, // ͭ
-    { 8, 8, 0, 0, 28, 16, 2158 }, // ͮ
-    { 9, 8, 0, -1, 28, 18, 2174 }, // ͯ
-    { 18, 32, 17, 1, 32, 144, 0 }, // Ѐ
-    { 18, 31, 17, 1, 31, 140, 144 }, // Ё
-    { 18, 25, 22, 3, 24, 113, 284 }, // Ђ
-    { 18, 32, 16, 1, 32, 144, 397 }, // Ѓ
-    { 20, 26, 19, 1, 25, 130, 541 }, // Є
-    { 18, 26, 17, 0, 25, 117, 671 }, // Ѕ
-    { 9, 24, 9, 1, 24, 54, 788 }, // І
-    { 12, 31, 9, 1, 31, 93, 842 }, // Ї
-    { 16, 31, 9, -6, 24, 124, 935 }, // Ј
-    { 32, 25, 31, -2, 24, 200, 1059 }, // Љ
-    { 29, 24, 31, 1, 24, 174, 1259 }, // Њ
-    { 18, 24, 23, 3, 24, 108, 1433 }, // Ћ
-    { 21, 32, 19, 1, 32, 168, 1541 }, // Ќ
-    { 23, 32, 23, 1, 32, 184, 1709 }, // Ѝ
-    { 22, 32, 19, 0, 31, 176, 1893 }, // Ў
-    { 22, 30, 22, 1, 24, 165, 2069 }, // Џ
-    { 20, 24, 19, -2, 24, 120, 2234 }, // А
-    { 18, 24, 18, 1, 24, 108, 2354 }, // Б
-    { 19, 24, 20, 1, 24, 114, 2462 }, // В
-    { 17, 24, 16, 1, 24, 102, 2576 }, // Г
-    { 26, 30, 23, -3, 24, 195, 2678 }, // Д
-    { 18, 24, 17, 1, 24, 108, 2873 }, // Е
-    { 32, 24, 27, -2, 24, 192, 2981 }, // Ж
-    { 19, 26, 17, -1, 25, 124, 3173 }, // З
-    { 23, 24, 23, 1, 24, 138, 3297 }, // И
-    { 23, 31, 23, 1, 31, 179, 3435 }, // Й
-    { 21, 24, 19, 1, 24, 126, 3614 }, // К
-    { 25, 25, 22, -2, 24, 157, 3740 }, // Л
-    { 27, 24, 28, 1, 24, 162, 3897 }, // М
-    { 22, 24, 23, 1, 24, 132, 4059 }, // Н
-    { 21, 26, 23, 2, 25, 137, 4191 }, // О
-    { 22, 24, 22, 1, 24, 132, 4328 }, // П
-    { 18, 24, 18, 1, 24, 108, 4460 }, // Р
-    { 19, 26, 19, 2, 25, 124, 4568 }, // С
-    { 17, 24, 17, 3, 24, 102, 4692 }, // Т
-    { 22, 25, 19, 0, 24, 138, 4794 }, // У
-    { 25, 26, 26, 1, 25, 163, 4932 }, // Ф
-    { 23, 24, 18, -2, 24, 138, 5095 }, // Х
-    { 22, 30, 23, 1, 24, 165, 5233 }, // Ц
-    { 18, 24, 21, 3, 24, 108, 5398 }, // Ч
-    { 31, 24, 32, 1, 24, 186, 5506 }, // Ш
-    { 31, 30, 32, 1, 24, 233, 5692 }, // Щ
-    { 17, 24, 21, 3, 24, 102, 5925 }, // Ъ
-    { 26, 24, 26, 1, 24, 156, 6027 }, // Ы
-    { 16, 24, 18, 1, 24, 96, 6183 }, // Ь
-    { 20, 26, 20, 0, 25, 130, 6279 }, // Э
-    { 30, 26, 31, 1, 25, 195, 6409 }, // Ю
-    { 22, 24, 19, -2, 24, 132, 6604 }, // Я
-    { 18, 20, 19, 1, 19, 90, 6736 }, // а
-    { 18, 27, 18, 1, 26, 122, 6826 }, // б
-    { 16, 20, 17, 1, 19, 80, 6948 }, // в
-    { 15, 20, 15, 0, 19, 75, 7028 }, // г
-    { 17, 27, 19, 1, 26, 115, 7103 }, // д
-    { 15, 20, 16, 1, 19, 75, 7218 }, // е
-    { 31, 20, 29, -1, 19, 155, 7293 }, // ж
-    { 14, 20, 15, 0, 19, 70, 7448 }, // з
-    { 18, 19, 19, 1, 18, 86, 7518 }, // и
-    { 18, 26, 19, 1, 25, 117, 7604 }, // й
-    { 18, 18, 17, 0, 18, 81, 7721 }, // к
-    { 21, 19, 19, -2, 18, 100, 7802 }, // л
-    { 25, 18, 25, 0, 18, 113, 7902 }, // м
-    { 19, 18, 19, 0, 18, 86, 8015 }, // н
-    { 17, 20, 19, 1, 19, 85, 8101 }, // о
-    { 18, 19, 19, 0, 19, 86, 8186 }, // п
-    { 19, 27, 19, -1, 19, 129, 8272 }, // р
-    { 15, 20, 15, 1, 19, 75, 8401 }, // с
-    { 28, 19, 29, 0, 19, 133, 8476 }, // т
-    { 21, 26, 16, -3, 18, 137, 8609 }, // у
-    { 21, 34, 22, 1, 26, 179, 8746 }, // ф
-    { 19, 18, 15, -2, 18, 86, 8925 }, // х
-    { 18, 23, 20, 1, 18, 104, 9011 }, // ц
-    { 16, 18, 19, 2, 18, 72, 9115 }, // ч
-    { 28, 19, 29, 1, 18, 133, 9187 }, // ш
-    { 28, 23, 30, 1, 18, 161, 9320 }, // щ
-    { 18, 19, 20, 1, 18, 86, 9481 }, // ъ
-    { 23, 19, 24, 1, 18, 110, 9567 }, // ы
-    { 15, 19, 17, 1, 18, 72, 9677 }, // ь
-    { 15, 20, 16, 0, 19, 75, 9749 }, // э
-    { 25, 20, 26, 0, 19, 125, 9824 }, // ю
-    { 19, 18, 17, -2, 18, 86, 9949 }, // я
-    { 15, 27, 16, 1, 26, 102, 10035 }, // ѐ
-    { 16, 26, 16, 1, 25, 104, 10137 }, // ё
-    { 18, 34, 19, 0, 26, 153, 10241 }, // ђ
-    { 16, 27, 15, 0, 26, 108, 10394 }, // ѓ
-    { 15, 20, 15, 1, 19, 75, 10502 }, // є
-    { 14, 20, 14, 0, 19, 70, 10577 }, // ѕ
-    { 10, 25, 9, 0, 25, 63, 10647 }, // і
-    { 11, 25, 8, 0, 25, 69, 10710 }, // ї
-    { 14, 33, 8, -5, 25, 116, 10779 }, // ј
-    { 28, 19, 27, -2, 18, 133, 10895 }, // љ
-    { 26, 19, 27, 0, 18, 124, 11028 }, // њ
-    { 18, 26, 19, 0, 26, 117, 11152 }, // ћ
-    { 18, 26, 17, 0, 26, 117, 11269 }, // ќ
-    { 18, 27, 19, 1, 26, 122, 11386 }, // ѝ
-    { 21, 33, 16, -3, 25, 174, 11508 }, // ў
-    { 18, 25, 19, 1, 18, 113, 11682 }, // џ
-    { 30, 25, 31, 3, 24, 188, 11795 }, // Ѡ
-    { 26, 18, 26, 2, 18, 117, 11983 }, // ѡ
-    { 16, 24, 20, 2, 24, 96, 12100 }, // Ѣ
-    { 26, 20, 28, 0, 19, 130, 12196 }, // ѣ
-    { 30, 26, 29, 1, 25, 195, 12326 }, // Ѥ
-    { 24, 20, 23, 0, 19, 120, 12521 }, // ѥ
-    { 21, 24, 20, -2, 24, 126, 12641 }, // Ѧ
-    { 18, 18, 18, -2, 18, 81, 12767 }, // ѧ
-    { 26, 24, 28, 1, 24, 156, 12848 }, // Ѩ
-    { 23, 18, 24, 0, 18, 104, 13004 }, // ѩ
-    { 26, 24, 22, -2, 24, 156, 13108 }, // Ѫ
-    { 22, 18, 20, -2, 18, 99, 13264 }, // ѫ
-    { 31, 24, 31, 1, 24, 186, 13363 }, // Ѭ
-    { 27, 18, 27, 0, 18, 122, 13549 }, // ѭ
-    { 20, 36, 18, -2, 29, 180, 13671 }, // Ѯ
-    { 17, 30, 15, -2, 23, 128, 13851 }, // ѯ
-    { 25, 24, 25, 3, 24, 150, 13979 }, // Ѱ
-    { 22, 34, 24, 1, 26, 187, 14129 }, // ѱ
-    { 21, 26, 24, 2, 25, 137, 14316 }, // Ѳ
-    { 17, 20, 19, 1, 19, 85, 14453 }, // ѳ
-    { 20, 24, 19, 3, 24, 120, 14538 }, // Ѵ
-    { 17, 18, 15, 1, 18, 77, 14658 }, // ѵ
-    { 20, 32, 19, 3, 32, 160, 14735 }, // Ѷ
-    { 17, 26, 15, 1, 26, 111, 14895 }, // ѷ
-    { 40, 33, 40, 2, 25, 330, 15006 }, // Ѹ
-    { 35, 27, 34, 1, 19, 237, 15336 }, // ѹ
-    { 22, 29, 25, 2, 26, 160, 15573 }, // Ѻ
-    { 17, 22, 19, 1, 20, 94, 15733 }, // ѻ
-    { 29, 36, 32, 2, 35, 261, 15827 }, // Ѽ
-    { 25, 31, 27, 1, 30, 194, 16088 }, // ѽ
-    { 30, 31, 31, 3, 30, 233, 16282 }, // Ѿ
-    { 26, 24, 26, 2, 24, 156, 16515 }, // ѿ
-    { 20, 33, 20, 2, 25, 165, 16671 }, // Ҁ
-    { 15, 27, 15, 1, 19, 102, 16836 }, // ҁ
-    { 18, 22, 20, 1, 21, 99, 16938 }, // ҂
-    { 14, 5, 0, -14, 24, 18, 17037 }, // ҃
-    { 14, 5, 0, -14, 25, 18, 17055 }, // ҄
-    { 4, 6, 0, -9, 26, 6, 17073 }, // ҅
-    { 5, 6, 0, -9, 26, 8, 17079 }, // ҆
-    { 14, 5, 0, -3, 30, 18, 17087 }, // ҇
-    { 38, 36, 0, -19, 27, 342, 17105 }, // ҈
-    { 38, 38, 0, -19, 28, 361, 17447 }, // ҉
-    { 23, 38, 24, 1, 31, 219, 17808 }, // Ҋ
-    { 18, 33, 19, 1, 26, 149, 18027 }, // ҋ
-    { 16, 24, 18, 1, 24, 96, 18176 }, // Ҍ
-    { 14, 27, 17, 2, 26, 95, 18272 }, // ҍ
-    { 18, 24, 19, 1, 24, 108, 18367 }, // Ҏ
-    { 19, 27, 19, -1, 19, 129, 18475 }, // ҏ
-    { 19, 29, 16, 1, 29, 138, 18604 }, // Ґ
-    { 16, 24, 13, 0, 24, 96, 18742 }, // ґ
-    { 18, 24, 16, 1, 24, 108, 18838 }, // Ғ
-    { 15, 18, 13, 0, 18, 68, 18946 }, // ғ
-    { 18, 33, 20, 1, 24, 149, 19014 }, // Ҕ
-    { 15, 27, 17, 0, 18, 102, 19163 }, // ҕ
-    { 32, 31, 28, -2, 24, 248, 19265 }, // Җ
-    { 31, 26, 28, -1, 19, 202, 19513 }, // җ
-    { 19, 33, 17, -1, 25, 157, 19715 }, // Ҙ
-    { 14, 27, 15, 0, 19, 95, 19872 }, // ҙ
-    { 21, 31, 20, 1, 24, 163, 19967 }, // Қ
-    { 18, 25, 18, 0, 18, 113, 20130 }, // қ
-    { 21, 24, 19, 1, 24, 126, 20243 }, // Ҝ
-    { 19, 18, 16, 0, 18, 86, 20369 }, // ҝ
-    { 21, 24, 19, 1, 24, 126, 20455 }, // Ҟ
-    { 18, 26, 16, 0, 26, 117, 20581 }, // ҟ
-    { 22, 24, 21, 3, 24, 132, 20698 }, // Ҡ
-    { 20, 18, 19, 1, 18, 90, 20830 }, // ҡ
-    { 22, 31, 23, 1, 24, 171, 20920 }, // Ң
-    { 20, 25, 20, 0, 18, 125, 21091 }, // ң
-    { 28, 24, 25, 1, 24, 168, 21216 }, // Ҥ
-    { 25, 18, 23, 0, 18, 113, 21384 }, // ҥ
-    { 30, 33, 33, 1, 24, 248, 21497 }, // Ҧ
-    { 26, 27, 27, 0, 18, 176, 21745 }, // ҧ
-    { 21, 27, 24, 2, 25, 142, 21921 }, // Ҩ
-    { 18, 20, 20, 1, 19, 90, 22063 }, // ҩ
-    { 20, 33, 20, 2, 25, 165, 22153 }, // Ҫ
-    { 15, 27, 15, 1, 19, 102, 22318 }, // ҫ
-    { 17, 31, 17, 3, 24, 132, 22420 }, // Ҭ
-    { 28, 26, 30, 0, 19, 182, 22552 }, // ҭ
-    { 18, 24, 17, 3, 24, 108, 22734 }, // Ү
-    { 17, 26, 16, 1, 18, 111, 22842 }, // ү
-    { 20, 24, 17, 1, 24, 120, 22953 }, // Ұ
-    { 19, 26, 16, -1, 18, 124, 23073 }, // ұ
-    { 23, 31, 19, -2, 24, 179, 23197 }, // Ҳ
-    { 19, 25, 18, -1, 18, 119, 23376 }, // ҳ
-    { 24, 31, 26, 3, 24, 186, 23495 }, // Ҵ
-    { 20, 25, 22, 1, 18, 125, 23681 }, // ҵ
-    { 19, 31, 22, 3, 24, 148, 23806 }, // Ҷ
-    { 16, 25, 18, 2, 18, 100, 23954 }, // ҷ
-    { 19, 24, 21, 3, 24, 114, 24054 }, // Ҹ
-    { 16, 18, 19, 2, 18, 72, 24168 }, // ҹ
-    { 19, 24, 21, 1, 24, 114, 24240 }, // Һ
-    { 18, 26, 19, 0, 26, 117, 24354 }, // һ
-    { 24, 26, 26, 2, 25, 156, 24471 }, // Ҽ
-    { 19, 20, 20, 1, 19, 95, 24627 }, // ҽ
-    { 24, 32, 26, 2, 25, 192, 24722 }, // Ҿ
-    { 19, 26, 20, 1, 19, 124, 24914 }, // ҿ
-    { 14, 24, 11, -1, 24, 84, 25038 }, // Ӏ
-    { 32, 31, 27, -2, 31, 248, 25122 }, // Ӂ
-    { 31, 26, 29, -1, 25, 202, 25370 }, // ӂ
-    { 21, 33, 21, 1, 24, 174, 25572 }, // Ӄ
-    { 18, 27, 17, 0, 18, 122, 25746 }, // ӄ
-    { 24, 31, 22, -2, 24, 186, 25868 }, // Ӆ
-    { 20, 26, 18, -2, 19, 130, 26054 }, // ӆ
-    { 22, 33, 23, 1, 24, 182, 26184 }, // Ӈ
-    { 20, 27, 20, 0, 18, 135, 26366 }, // ӈ
-    { 22, 31, 23, 1, 24, 171, 26501 }, // Ӊ
-    { 20, 25, 20, 0, 18, 125, 26672 }, // ӊ
-    { 19, 31, 21, 3, 24, 148, 26797 }, // Ӌ
-    { 16, 25, 19, 3, 18, 100, 26945 }, // ӌ
-    { 28, 31, 28, 1, 24, 217, 27045 }, // Ӎ
-    { 23, 25, 23, 0, 18, 144, 27262 }, // ӎ
-    { 14, 24, 11, -1, 24, 84, 27406 }, // ӏ
-    { 21, 31, 19, -2, 31, 163, 27490 }, // Ӑ
-    { 18, 26, 19, 1, 25, 117, 27653 }, // ӑ
-    { 20, 31, 19, -2, 31, 155, 27770 }, // Ӓ
-    { 18, 26, 19, 1, 25, 117, 27925 }, // ӓ
-    { 31, 24, 27, -2, 24, 186, 28042 }, // Ӕ
-    { 26, 20, 27, 1, 19, 130, 28228 }, // ӕ
-    { 18, 31, 17, 1, 31, 140, 28358 }, // Ӗ
-    { 17, 26, 17, 1, 25, 111, 28498 }, // ӗ
-    { 20, 26, 22, 1, 25, 130, 28609 }, // Ә
-    { 15, 20, 16, 0, 19, 75, 28739 }, // ә
-    { 20, 32, 22, 1, 31, 160, 28814 }, // Ӛ
-    { 16, 26, 16, 0, 25, 104, 28974 }, // ӛ
-    { 32, 31, 27, -2, 31, 248, 29078 }, // Ӝ
-    { 31, 26, 29, -1, 25, 202, 29326 }, // ӝ
-    { 19, 32, 17, -1, 31, 152, 29528 }, // Ӟ
-    { 15, 26, 15, 0, 25, 98, 29680 }, // ӟ
-    { 19, 25, 18, 0, 24, 119, 29778 }, // Ӡ
-    { 18, 26, 15, -3, 18, 117, 29897 }, // ӡ
-    { 23, 29, 23, 1, 29, 167, 30014 }, // Ӣ
-    { 18, 24, 19, 1, 23, 108, 30181 }, // ӣ
-    { 23, 31, 23, 1, 31, 179, 30289 }, // Ӥ
-    { 18, 26, 19, 1, 25, 117, 30468 }, // ӥ
-    { 21, 32, 24, 2, 31, 168, 30585 }, // Ӧ
-    { 17, 26, 19, 1, 25, 111, 30753 }, // ӧ
-    { 21, 26, 24, 2, 25, 137, 30864 }, // Ө
-    { 17, 20, 19, 1, 19, 85, 31001 }, // ө
-    { 21, 32, 24, 2, 31, 168, 31086 }, // Ӫ
-    { 17, 26, 19, 1, 25, 111, 31254 }, // ӫ
-    { 20, 32, 20, 0, 31, 160, 31365 }, // Ӭ
-    { 15, 26, 16, 0, 25, 98, 31525 }, // ӭ
-    { 22, 30, 19, 0, 29, 165, 31623 }, // Ӯ
-    { 22, 31, 16, -4, 23, 171, 31788 }, // ӯ
-    { 22, 32, 19, 0, 31, 176, 31959 }, // Ӱ
-    { 22, 33, 16, -4, 25, 182, 32135 }, // ӱ
-    { 22, 33, 19, 0, 32, 182, 32317 }, // Ӳ
-    { 22, 34, 16, -4, 26, 187, 32499 }, // ӳ
-    { 18, 31, 21, 3, 31, 140, 32686 }, // Ӵ
-    { 16, 25, 19, 2, 25, 100, 32826 }, // ӵ
-    { 18, 31, 16, 1, 24, 140, 32926 }, // Ӷ
-    { 15, 25, 13, 0, 18, 94, 33066 }, // ӷ
-    { 26, 31, 26, 1, 31, 202, 33160 }, // Ӹ
-    { 23, 26, 24, 1, 25, 150, 33362 }, // ӹ
-    { 19, 31, 16, 0, 24, 148, 33512 }, // Ӻ
-    { 16, 25, 13, -1, 18, 100, 33660 }, // ӻ
-    { 23, 31, 18, -2, 24, 179, 33760 }, // Ӽ
-    { 19, 25, 16, -2, 18, 119, 33939 }, // ӽ
-    { 23, 24, 18, -2, 24, 138, 34058 }, // Ӿ
-    { 19, 18, 16, -2, 18, 86, 34196 }, // ӿ
-    { 0, 0, 17, 0, 0, 0, 0 }, //  
-    { 0, 0, 33, 0, 0, 0, 0 }, //  
-    { 0, 0, 17, 0, 0, 0, 0 }, //  
-    { 0, 0, 33, 0, 0, 0, 0 }, //  
-    { 0, 0, 11, 0, 0, 0, 0 }, //  
-    { 0, 0, 8, 0, 0, 0, 0 }, //  
-    { 0, 0, 6, 0, 0, 0, 0 }, //  
-    { 0, 0, 18, 0, 0, 0, 0 }, //  
-    { 0, 0, 9, 0, 0, 0, 0 }, //  
-    { 0, 0, 6, 0, 0, 0, 0 }, //  
-    { 0, 0, 3, 0, 0, 0, 0 }, //  
-    { 0, 0, 0, 0, 0, 0, 0 }, // ​
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‍
-    { 9, 28, 0, -1, 23, 63, 0 }, // ‎
-    { 9, 28, 0, -8, 23, 63, 63 }, // ‏
-    { 10, 4, 10, 0, 11, 10, 126 }, // ‐
-    { 10, 4, 10, 0, 11, 10, 136 }, // ‑
-    { 17, 4, 18, 1, 14, 17, 146 }, // ‒
-    { 15, 4, 16, 0, 11, 15, 163 }, // –
-    { 31, 4, 32, 0, 11, 31, 178 }, // —
-    { 31, 4, 32, 0, 11, 31, 209 }, // ―
-    { 10, 35, 18, 5, 26, 88, 240 }, // ‖
-    { 16, 8, 13, -4, 0, 32, 328 }, // ‗
-    { 7, 9, 6, 2, 24, 16, 360 }, // ‘
-    { 7, 9, 6, 2, 24, 16, 376 }, // ’
-    { 7, 9, 8, -2, 4, 16, 392 }, // ‚
-    { 5, 9, 6, 3, 24, 12, 408 }, // ‛
-    { 13, 9, 12, 2, 24, 30, 420 }, // “
-    { 13, 9, 12, 2, 24, 30, 450 }, // ”
-    { 14, 9, 14, -2, 4, 32, 480 }, // „
-    { 10, 9, 12, 3, 24, 23, 512 }, // ‟
-    { 13, 26, 16, 3, 26, 85, 535 }, // †
-    { 16, 26, 16, 1, 26, 104, 620 }, // ‡
-    { 8, 9, 13, 3, 17, 18, 724 }, // •
-    { 11, 11, 12, 1, 18, 31, 742 }, // ‣
-    { 5, 6, 17, 4, 5, 8, 773 }, // ․
-    { 14, 6, 17, 0, 5, 21, 781 }, // ‥
-    { 22, 6, 26, 0, 5, 33, 802 }, // …
-    { 5, 6, 9, 2, 12, 8, 835 }, // ‧
-    { 0, 0, 20, 0, 0, 0, 843 }, //  
-    { 0, 0, 20, 0, 0, 0, 843 }, //  
-    { 9, 26, 0, -1, 21, 59, 843 }, // ‪
-    { 9, 26, 0, -8, 21, 59, 902 }, // ‫
-    { 8, 28, 0, -4, 23, 56, 961 }, // ‬
-    { 8, 28, 0, -4, 23, 56, 1017 }, // ‭
-    { 8, 28, 0, -4, 23, 56, 1073 }, // ‮
-    { 0, 0, 6, 0, 0, 0, 1129 }, //  
-    { 35, 26, 38, 2, 25, 228, 1129 }, // ‰
-    { 45, 26, 48, 2, 25, 293, 1357 }, // ‱
-    { 8, 9, 7, 2, 24, 18, 1650 }, // ′
-    { 14, 9, 13, 2, 24, 32, 1668 }, // ″
-    { 19, 9, 19, 2, 24, 43, 1700 }, // ‴
-    { 5, 9, 9, 4, 24, 12, 1743 }, // ‵
-    { 11, 9, 14, 4, 24, 25, 1755 }, // ‶
-    { 16, 9, 19, 4, 24, 36, 1780 }, // ‷
-    { 13, 11, 13, -3, 3, 36, 1816 }, // ‸
-    { 9, 15, 10, 1, 16, 34, 1852 }, // ‹
-    { 9, 15, 10, 0, 16, 34, 1886 }, // ›
-    { 26, 26, 28, 1, 25, 169, 1920 }, // ※
-    { 17, 25, 16, 0, 24, 107, 2089 }, // ‼
-    { 14, 26, 14, 2, 25, 91, 2196 }, // ‽
-    { 15, 3, 13, 3, 28, 12, 2287 }, // ‾
-    { 18, 7, 18, -2, -1, 32, 2299 }, // ‿
-    { 18, 8, 18, 2, 27, 36, 2331 }, // ⁀
-    { 16, 22, 11, -4, 14, 88, 2367 }, // ⁁
-    { 36, 31, 37, 0, 26, 279, 2455 }, // ⁂
-    { 9, 4, 10, 0, 11, 9, 2734 }, // ⁃
-    { 21, 24, 4, -8, 24, 126, 2743 }, // ⁄
-    { 14, 30, 10, -1, 24, 105, 2869 }, // ⁅
-    { 14, 30, 10, -3, 24, 105, 2974 }, // ⁆
-    { 28, 26, 29, 2, 25, 182, 3079 }, // ⁇
-    { 22, 26, 23, 2, 25, 143, 3261 }, // ⁈
-    { 24, 26, 23, 0, 25, 156, 3404 }, // ⁉
-    { 17, 18, 17, 2, 18, 77, 3560 }, // ⁊
-    { 17, 31, 20, 3, 26, 132, 3637 }, // ⁋
-    { 18, 17, 21, 1, 18, 77, 3769 }, // ⁌
-    { 18, 17, 21, 2, 18, 77, 3846 }, // ⁍
-    { 17, 16, 18, -1, 9, 68, 3923 }, // ⁎
-    { 7, 24, 9, 1, 19, 42, 3991 }, // ⁏
-    { 22, 35, 18, -2, 27, 193, 4033 }, // ⁐
-    { 19, 33, 18, 0, 26, 157, 4226 }, // ⁑
-    { 13, 26, 12, 0, 25, 85, 4383 }, // ⁒
-    { 29, 6, 33, 3, 13, 44, 4468 }, // ⁓
-    { 18, 8, 18, -3, 0, 36, 4512 }, // ⁔
-    { 18, 18, 19, 0, 17, 81, 4548 }, // ⁕
-    { 15, 26, 17, 1, 25, 98, 4629 }, // ⁖
-    { 25, 9, 24, 2, 24, 57, 4727 }, // ⁗
-    { 25, 26, 27, 1, 25, 163, 4784 }, // ⁘
-    { 25, 26, 28, 1, 25, 163, 4947 }, // ⁙
-    { 5, 26, 7, 1, 25, 33, 5110 }, // ⁚
-    { 20, 26, 22, 1, 25, 130, 5143 }, // ⁛
-    { 25, 26, 27, 1, 25, 163, 5273 }, // ⁜
-    { 5, 25, 9, 2, 24, 32, 5436 }, // ⁝
-    { 5, 26, 9, 3, 25, 33, 5468 }, // ⁞
-    { 0, 0, 7, 0, 0, 0, 5501 }, //  
-    { 0, 0, 20, 0, 0, 0, 5501 }, // ⁠
-    { 0, 0, 20, 0, 0, 0, 5501 }, // ⁡
-    { 0, 0, 20, 0, 0, 0, 5501 }, // ⁢
-    { 0, 0, 20, 0, 0, 0, 5501 }, // ⁣
-    { 0, 0, 20, 0, 0, 0, 5501 }, // ⁤
-    { 0, 0, 20, 0, 0, 0, 5501 }, // ⁦
-    { 0, 0, 20, 0, 0, 0, 5501 }, // ⁧
-    { 0, 0, 20, 0, 0, 0, 5501 }, // ⁨
-    { 0, 0, 20, 0, 0, 0, 5501 }, // ⁩
-    { 8, 28, 0, -4, 23, 56, 5501 }, // ⁪
-    { 8, 28, 0, -4, 23, 56, 5557 }, // ⁫
-    { 8, 28, 0, -4, 23, 56, 5613 }, // ⁬
-    { 8, 29, 0, -4, 24, 58, 5669 }, // ⁭
-    { 8, 28, 0, -4, 23, 56, 5727 }, // ⁮
-    { 8, 28, 0, -4, 23, 56, 5783 }, // ⁯
-    { 11, 16, 12, 3, 29, 44, 0 }, // ⁰
-    { 6, 16, 7, 2, 25, 24, 44 }, // ⁱ
-    { 12, 16, 12, 2, 29, 48, 68 }, // ⁴
-    { 11, 16, 12, 3, 29, 44, 116 }, // ⁵
-    { 11, 16, 12, 3, 29, 44, 160 }, // ⁶
-    { 12, 16, 12, 3, 29, 48, 204 }, // ⁷
-    { 12, 16, 12, 2, 29, 48, 252 }, // ⁸
-    { 11, 16, 12, 3, 29, 44, 300 }, // ⁹
-    { 10, 10, 11, 3, 25, 25, 344 }, // ⁺
-    { 10, 3, 11, 3, 22, 8, 369 }, // ⁻
-    { 10, 6, 11, 3, 23, 15, 377 }, // ⁼
-    { 9, 18, 6, 3, 30, 41, 392 }, // ⁽
-    { 8, 18, 6, 0, 30, 36, 433 }, // ⁾
-    { 12, 12, 13, 2, 21, 36, 469 }, // ⁿ
-    { 11, 16, 12, -1, 11, 44, 505 }, // ₀
-    { 7, 16, 12, 1, 11, 28, 549 }, // ₁
-    { 12, 16, 12, -2, 11, 48, 577 }, // ₂
-    { 12, 16, 12, -2, 11, 48, 625 }, // ₃
-    { 12, 16, 12, -2, 11, 48, 673 }, // ₄
-    { 11, 16, 12, -1, 11, 44, 721 }, // ₅
-    { 11, 16, 12, -1, 11, 44, 765 }, // ₆
-    { 12, 16, 12, -1, 11, 48, 809 }, // ₇
-    { 11, 16, 12, -1, 11, 44, 857 }, // ₈
-    { 11, 16, 12, -1, 11, 44, 901 }, // ₉
-    { 10, 10, 11, -1, 7, 25, 945 }, // ₊
-    { 10, 3, 11, -1, 4, 8, 970 }, // ₋
-    { 10, 6, 11, -1, 5, 15, 978 }, // ₌
-    { 8, 18, 6, 0, 12, 36, 993 }, // ₍
-    { 8, 18, 6, -4, 12, 36, 1029 }, // ₎
-    { 12, 12, 12, -1, 8, 36, 1065 }, // ₐ
-    { 10, 12, 11, -1, 8, 30, 1101 }, // ₑ
-    { 11, 12, 12, -1, 8, 33, 1131 }, // ₒ
-    { 13, 12, 10, -3, 8, 39, 1164 }, // ₓ
-    { 10, 12, 11, -2, 8, 30, 1203 }, // ₔ
-    { 11, 16, 15, 0, 12, 44, 1233 }, // ₕ
-    { 11, 16, 12, 0, 12, 44, 1277 }, // ₖ
-    { 6, 16, 8, 0, 12, 24, 1321 }, // ₗ
-    { 18, 12, 21, 0, 8, 54, 1345 }, // ₘ
-    { 12, 12, 13, -2, 8, 36, 1399 }, // ₙ
-    { 13, 16, 13, -3, 8, 52, 1435 }, // ₚ
-    { 9, 12, 10, -1, 8, 27, 1487 }, // ₛ
-    { 8, 14, 7, -1, 10, 28, 1514 }, // ₜ
-    { 17, 25, 18, 2, 25, 107, 0 }, // ₠
-    { 19, 28, 18, 1, 26, 133, 107 }, // ₡
-    { 18, 26, 18, 2, 25, 117, 240 }, // ₢
-    { 20, 24, 18, 0, 24, 120, 357 }, // ₣
-    { 21, 25, 18, -1, 25, 132, 477 }, // ₤
-    { 28, 27, 29, 0, 23, 189, 609 }, // ₥
-    { 20, 24, 18, 0, 24, 120, 798 }, // ₦
-    { 24, 25, 25, 0, 24, 150, 918 }, // ₧
-    { 27, 25, 27, 0, 24, 169, 1068 }, // ₨
-    { 24, 24, 21, 0, 24, 144, 1237 }, // ₩
-    { 28, 24, 27, 0, 24, 168, 1381 }, // ₪
-    { 22, 32, 19, 0, 26, 176, 1549 }, // ₫
-    { 20, 26, 18, 1, 25, 130, 1725 }, // €
-    { 21, 24, 19, 1, 24, 126, 1855 }, // ₭
-    { 19, 24, 17, 1, 24, 114, 1981 }, // ₮
-    { 32, 33, 32, 0, 25, 264, 2095 }, // ₯
-    { 21, 33, 18, -2, 25, 174, 2359 }, // ₰
-    { 20, 24, 18, 1, 24, 120, 2533 }, // ₱
-    { 21, 29, 23, 2, 26, 153, 2653 }, // ₲
-    { 22, 24, 19, -2, 24, 132, 2806 }, // ₳
-    { 20, 26, 17, -1, 25, 130, 2938 }, // ₴
-    { 20, 29, 20, 2, 26, 145, 3068 }, // ₵
-    { 21, 23, 19, 0, 22, 121, 3213 }, // ₶
-    { 24, 28, 22, -1, 25, 168, 3334 }, // ₷
-    { 17, 24, 16, 2, 24, 102, 3502 }, // ₸
-    { 17, 24, 18, 3, 24, 102, 3604 }, // ₹
-    { 19, 25, 18, 0, 24, 119, 3706 }, // ₺
-    { 22, 26, 22, 1, 25, 143, 3825 }, // ₻
-    { 24, 24, 25, -1, 24, 144, 3968 }, // ₼
-    { 21, 24, 19, -1, 24, 126, 4112 }, // ₽
-    { 22, 28, 20, -1, 28, 154, 4238 }, // ₾
-    { 18, 32, 18, 1, 28, 144, 4392 }, // ₿
-    { 10, 4, 10, 0, 11, 10, 0 }, // −
-    { 31, 32, 33, 1, 26, 248, 0 }, // �
+    { 15, 15, 16, 1, 16, 57, 9152 }, // «
+    { 16, 9, 19, 2, 13, 36, 831 }, // ¬
+    { 10, 4, 10, 0, 11, 10, 867 }, // ­
+    { 26, 26, 28, 1, 25, 169, 877 }, // ®
+    { 15, 3, 13, 3, 28, 12, 1046 }, // ¯
+    { 12, 12, 14, 1, 25, 36, 1058 }, // °
+    { 17, 20, 19, 2, 20, 85, 1094 }, // ±
+    { 12, 16, 12, 2, 29, 48, 1179 }, // ²
+    { 12, 16, 12, 2, 29, 48, 1227 }, // ³
+    { 8, 6, 9, 3, 26, 12, 1275 }, // ´
+    { 20, 26, 20, -1, 18, 130, 1287 }, // µ
+    { 17, 31, 22, 3, 26, 132, 1417 }, // ¶
+    { 5, 6, 9, 2, 15, 8, 1549 }, // ·
+    { 7, 8, 7, -3, 0, 14, 1557 }, // ¸
+    { 8, 16, 12, 4, 29, 32, 1571 }, // ¹
+    { 11, 13, 11, 2, 25, 36, 1603 }, // º
+    { 15, 15, 16, 0, 16, 57, 9209 }, // »
+    { 22, 26, 24, 2, 25, 143, 1639 }, // ¼
+    { 24, 26, 27, 2, 25, 156, 1782 }, // ½
+    { 25, 26, 26, 1, 25, 163, 1938 }, // ¾
+    { 13, 26, 14, -1, 19, 85, 2101 }, // ¿
+    { 20, 32, 19, -2, 32, 160, 9266 }, // À
+    { 21, 32, 19, -2, 32, 168, 9426 }, // Á
+    { 20, 32, 19, -2, 32, 160, 9594 }, // Â
+    { 22, 31, 19, -2, 31, 171, 2186 }, // Ã
+    { 20, 31, 19, -2, 31, 155, 9754 }, // Ä
+    { 20, 34, 19, -2, 34, 170, 2357 }, // Å
+    { 31, 24, 27, -2, 24, 186, 2527 }, // Æ
+    { 20, 33, 20, 2, 25, 165, 9909 }, // Ç
+    { 18, 32, 17, 1, 32, 144, 10074 }, // È
+    { 18, 32, 17, 1, 32, 144, 10218 }, // É
+    { 18, 32, 17, 1, 32, 144, 10362 }, // Ê
+    { 18, 31, 17, 1, 31, 140, 10506 }, // Ë
+    { 14, 32, 11, -1, 32, 112, 10646 }, // Ì
+    { 16, 32, 11, -1, 32, 128, 10758 }, // Í
+    { 15, 32, 11, -1, 32, 120, 10886 }, // Î
+    { 15, 31, 11, -1, 31, 117, 11006 }, // Ï
+    { 21, 24, 22, 1, 24, 126, 2713 }, // Ð
+    { 23, 31, 24, 1, 31, 179, 11123 }, // Ñ
+    { 21, 33, 24, 2, 32, 174, 11302 }, // Ò
+    { 21, 33, 24, 2, 32, 174, 11476 }, // Ó
+    { 21, 33, 24, 2, 32, 174, 11650 }, // Ô
+    { 21, 32, 24, 2, 31, 168, 2839 }, // Õ
+    { 21, 32, 24, 2, 31, 168, 11824 }, // Ö
+    { 16, 16, 19, 2, 20, 64, 3007 }, // ×
+    { 23, 28, 24, 1, 26, 161, 3071 }, // Ø
+    { 21, 33, 23, 2, 32, 174, 11992 }, // Ù
+    { 21, 33, 23, 2, 32, 174, 12166 }, // Ú
+    { 21, 33, 23, 2, 32, 174, 12340 }, // Û
+    { 21, 32, 23, 2, 31, 168, 12514 }, // Ü
+    { 18, 32, 17, 3, 32, 144, 3232 }, // Ý
+    { 18, 24, 19, 1, 24, 108, 3376 }, // Þ
+    { 24, 34, 19, -5, 26, 204, 3484 }, // ß
+    { 18, 27, 19, 1, 26, 122, 12682 }, // à
+    { 18, 27, 19, 1, 26, 122, 12804 }, // á
+    { 18, 27, 19, 1, 26, 122, 12926 }, // â
+    { 18, 26, 19, 1, 25, 117, 3688 }, // ã
+    { 18, 26, 19, 1, 25, 117, 13048 }, // ä
+    { 18, 29, 19, 1, 28, 131, 3805 }, // å
+    { 26, 20, 27, 1, 19, 130, 3936 }, // æ
+    { 15, 27, 15, 1, 19, 102, 13165 }, // ç
+    { 15, 27, 17, 1, 26, 102, 13267 }, // è
+    { 16, 27, 17, 1, 26, 108, 13369 }, // é
+    { 15, 27, 17, 1, 26, 102, 13477 }, // ê
+    { 15, 26, 17, 1, 25, 98, 13579 }, // ë
+    { 9, 26, 9, 0, 26, 59, 13677 }, // ì
+    { 12, 26, 9, 0, 26, 78, 13736 }, // í
+    { 12, 26, 9, 0, 26, 78, 13814 }, // î
+    { 12, 25, 9, 0, 25, 75, 13892 }, // ï
+    { 18, 27, 19, 1, 26, 122, 4066 }, // ð
+    { 19, 25, 19, 0, 25, 119, 13967 }, // ñ
+    { 17, 27, 19, 1, 26, 115, 14086 }, // ò
+    { 17, 27, 19, 1, 26, 115, 14201 }, // ó
+    { 17, 27, 19, 1, 26, 115, 14316 }, // ô
+    { 17, 26, 19, 1, 25, 111, 4188 }, // õ
+    { 17, 26, 19, 1, 25, 111, 14431 }, // ö
+    { 17, 16, 19, 2, 20, 68, 4299 }, // ÷
+    { 18, 22, 19, 0, 20, 99, 4367 }, // ø
+    { 18, 27, 19, 1, 26, 122, 14542 }, // ù
+    { 18, 27, 19, 1, 26, 122, 14664 }, // ú
+    { 18, 27, 19, 1, 26, 122, 14786 }, // û
+    { 18, 26, 19, 1, 25, 117, 14908 }, // ü
+    { 22, 34, 16, -4, 26, 187, 4466 }, // ý
+    { 19, 34, 19, -1, 26, 162, 4653 }, // þ
+    { 22, 33, 16, -4, 25, 182, 4815 }, // ÿ
+    { 20, 29, 19, -2, 29, 145, 4997 }, // Ā
+    { 18, 24, 19, 1, 23, 108, 5142 }, // ā
+    { 21, 31, 19, -2, 31, 163, 5250 }, // Ă
+    { 18, 26, 19, 1, 25, 117, 5413 }, // ă
+    { 20, 32, 19, -2, 24, 160, 5530 }, // Ą
+    { 18, 27, 19, 1, 19, 122, 5690 }, // ą
+    { 20, 33, 20, 2, 32, 165, 5812 }, // Ć
+    { 15, 27, 15, 1, 26, 102, 5977 }, // ć
+    { 20, 33, 20, 2, 32, 165, 6079 }, // Ĉ
+    { 15, 27, 15, 1, 26, 102, 6244 }, // ĉ
+    { 20, 32, 20, 2, 31, 160, 6346 }, // Ċ
+    { 15, 26, 15, 1, 25, 98, 6506 }, // ċ
+    { 20, 33, 20, 2, 32, 165, 6604 }, // Č
+    { 16, 27, 15, 1, 26, 108, 6769 }, // č
+    { 21, 32, 22, 1, 32, 168, 6877 }, // Ď
+    { 25, 27, 20, 1, 26, 169, 7045 }, // ď
+    { 21, 24, 22, 1, 24, 126, 7214 }, // Đ
+    { 21, 27, 19, 1, 26, 142, 7340 }, // đ
+    { 18, 29, 17, 1, 29, 131, 7482 }, // Ē
+    { 15, 24, 17, 1, 23, 90, 7613 }, // ē
+    { 18, 31, 17, 1, 31, 140, 7703 }, // Ĕ
+    { 16, 26, 17, 1, 25, 104, 7843 }, // ĕ
+    { 18, 31, 17, 1, 31, 140, 7947 }, // Ė
+    { 15, 26, 17, 1, 25, 98, 8087 }, // ė
+    { 18, 32, 17, 1, 24, 144, 8185 }, // Ę
+    { 15, 27, 17, 1, 19, 102, 8329 }, // ę
+    { 18, 32, 17, 1, 32, 144, 8431 }, // Ě
+    { 16, 27, 17, 1, 26, 108, 8575 }, // ě
+    { 21, 33, 23, 2, 32, 174, 8683 }, // Ĝ
+    { 19, 34, 19, 0, 26, 162, 8857 }, // ĝ
+    { 21, 32, 23, 2, 31, 168, 9019 }, // Ğ
+    { 19, 33, 19, 0, 25, 157, 9187 }, // ğ
+    { 21, 32, 23, 2, 31, 168, 9344 }, // Ġ
+    { 19, 33, 19, 0, 25, 157, 9512 }, // ġ
+    { 21, 33, 23, 2, 25, 174, 9669 }, // Ģ
+    { 19, 34, 19, 0, 26, 162, 9843 }, // ģ
+    { 22, 32, 23, 1, 32, 176, 10005 }, // Ĥ
+    { 18, 33, 19, 0, 33, 149, 10181 }, // ĥ
+    { 25, 24, 23, 1, 24, 150, 10330 }, // Ħ
+    { 18, 26, 19, 0, 26, 117, 10480 }, // ħ
+    { 17, 31, 11, -1, 31, 132, 10597 }, // Ĩ
+    { 14, 25, 9, 0, 25, 88, 10729 }, // ĩ
+    { 15, 29, 11, -1, 29, 109, 10817 }, // Ī
+    { 12, 23, 9, 0, 23, 69, 10926 }, // ī
+    { 16, 31, 11, -1, 31, 124, 10995 }, // Ĭ
+    { 13, 25, 9, 0, 25, 82, 11119 }, // ĭ
+    { 14, 32, 11, -1, 24, 112, 11201 }, // Į
+    { 11, 33, 9, -2, 25, 91, 11313 }, // į
+    { 14, 31, 11, -1, 31, 109, 11404 }, // İ
+    { 8, 18, 9, 0, 18, 36, 11513 }, // ı
+    { 22, 31, 20, -1, 24, 171, 11549 }, // Ĳ
+    { 18, 33, 17, 0, 25, 149, 11720 }, // ĳ
+    { 20, 39, 9, -6, 32, 195, 11869 }, // Ĵ
+    { 17, 34, 9, -5, 26, 145, 12064 }, // ĵ
+    { 21, 32, 19, 1, 24, 168, 12209 }, // Ķ
+    { 18, 34, 17, 0, 26, 153, 12377 }, // ķ
+    { 18, 18, 17, 0, 18, 81, 12530 }, // ĸ
+    { 14, 32, 16, 1, 32, 112, 12611 }, // Ĺ
+    { 14, 33, 9, 0, 33, 116, 12723 }, // ĺ
+    { 13, 32, 16, 1, 24, 104, 12839 }, // Ļ
+    { 12, 34, 9, -2, 26, 102, 12943 }, // ļ
+    { 17, 24, 16, 1, 24, 102, 13045 }, // Ľ
+    { 15, 26, 10, 0, 26, 98, 13147 }, // ľ
+    { 14, 24, 16, 1, 24, 84, 13245 }, // Ŀ
+    { 12, 26, 10, 0, 26, 78, 13329 }, // ŀ
+    { 14, 24, 16, 0, 24, 84, 13407 }, // Ł
+    { 10, 26, 9, 0, 26, 65, 13491 }, // ł
+    { 23, 32, 24, 1, 32, 184, 13556 }, // Ń
+    { 18, 26, 19, 0, 26, 117, 13740 }, // ń
+    { 23, 32, 24, 1, 24, 184, 13857 }, // Ņ
+    { 18, 27, 19, 0, 19, 122, 14041 }, // ņ
+    { 23, 32, 24, 1, 32, 184, 14163 }, // Ň
+    { 19, 26, 19, 0, 26, 124, 14347 }, // ň
+    { 20, 24, 22, 1, 24, 120, 14471 }, // ŉ
+    { 23, 31, 24, 1, 24, 179, 14591 }, // Ŋ
+    { 18, 27, 19, 0, 19, 122, 14770 }, // ŋ
+    { 21, 30, 24, 2, 29, 158, 14892 }, // Ō
+    { 17, 24, 19, 1, 23, 102, 15050 }, // ō
+    { 21, 32, 24, 2, 31, 168, 15152 }, // Ŏ
+    { 17, 26, 19, 1, 25, 111, 15320 }, // ŏ
+    { 23, 33, 24, 2, 32, 190, 15431 }, // Ő
+    { 19, 27, 19, 1, 26, 129, 15621 }, // ő
+    { 28, 26, 29, 2, 25, 182, 15025 }, // Œ
+    { 27, 20, 29, 1, 19, 135, 15207 }, // œ
+    { 18, 32, 19, 1, 32, 144, 15750 }, // Ŕ
+    { 16, 26, 13, 0, 26, 104, 15894 }, // ŕ
+    { 18, 32, 19, 1, 24, 144, 15998 }, // Ŗ
+    { 17, 27, 13, -2, 19, 115, 16142 }, // ŗ
+    { 19, 32, 19, 1, 32, 152, 16257 }, // Ř
+    { 17, 26, 13, 0, 26, 111, 16409 }, // ř
+    { 18, 33, 17, 0, 32, 149, 16520 }, // Ś
+    { 15, 27, 14, 0, 26, 102, 16669 }, // ś
+    { 18, 33, 17, 0, 32, 149, 16771 }, // Ŝ
+    { 15, 27, 14, 0, 26, 102, 16920 }, // ŝ
+    { 18, 33, 17, 0, 25, 149, 17022 }, // Ş
+    { 14, 27, 14, 0, 19, 95, 17171 }, // ş
+    { 18, 33, 17, 0, 32, 149, 17266 }, // Š
+    { 16, 27, 14, 0, 26, 108, 17415 }, // š
+    { 18, 32, 17, 2, 24, 144, 17523 }, // Ţ
+    { 12, 30, 11, 1, 22, 90, 17667 }, // ţ
+    { 17, 32, 17, 3, 32, 136, 17757 }, // Ť
+    { 14, 27, 11, 1, 26, 95, 17893 }, // ť
+    { 18, 24, 17, 2, 24, 108, 17988 }, // Ŧ
+    { 13, 23, 11, 0, 22, 75, 18096 }, // ŧ
+    { 21, 32, 23, 2, 31, 168, 18171 }, // Ũ
+    { 18, 26, 19, 1, 25, 117, 18339 }, // ũ
+    { 21, 30, 23, 2, 29, 158, 18456 }, // Ū
+    { 18, 24, 19, 1, 23, 108, 18614 }, // ū
+    { 21, 32, 23, 2, 31, 168, 18722 }, // Ŭ
+    { 18, 26, 19, 1, 25, 117, 18890 }, // ŭ
+    { 21, 35, 23, 2, 34, 184, 19007 }, // Ů
+    { 18, 29, 19, 1, 28, 131, 19191 }, // ů
+    { 22, 33, 23, 2, 32, 182, 19322 }, // Ű
+    { 20, 27, 19, 1, 26, 135, 19504 }, // ű
+    { 21, 32, 23, 2, 24, 168, 19639 }, // Ų
+    { 18, 26, 19, 1, 18, 117, 19807 }, // ų
+    { 29, 32, 29, 3, 32, 232, 19924 }, // Ŵ
+    { 25, 26, 24, 1, 26, 163, 20156 }, // ŵ
+    { 18, 32, 17, 3, 32, 144, 20319 }, // Ŷ
+    { 22, 34, 16, -4, 26, 187, 20463 }, // ŷ
+    { 18, 31, 17, 3, 31, 140, 20650 }, // Ÿ
+    { 21, 32, 18, -1, 32, 168, 20790 }, // Ź
+    { 17, 26, 15, -1, 26, 111, 20958 }, // ź
+    { 21, 31, 18, -1, 31, 163, 21069 }, // Ż
+    { 16, 25, 15, -1, 25, 100, 21232 }, // ż
+    { 21, 32, 18, -1, 32, 168, 21332 }, // Ž
+    { 17, 26, 15, -1, 26, 111, 21500 }, // ž
+    { 20, 34, 9, -5, 26, 170, 21611 }, // ſ
+    { 6, 6, 0, -13, 26, 9, 21781 }, // ̀
+    { 8, 6, 0, -8, 26, 12, 21790 }, // ́
+    { 11, 6, 0, -3, 26, 17, 21802 }, // ̂
+    { 13, 5, 0, -14, 25, 17, 21819 }, // ̃
+    { 11, 3, 0, -3, 23, 9, 21836 }, // ̄
+    { 14, 4, 0, -3, 29, 14, 21845 }, // ̅
+    { 10, 5, 0, -2, 25, 13, 21859 }, // ̆
+    { 4, 5, 0, 1, 25, 5, 21872 }, // ̇
+    { 10, 4, 0, -2, 25, 10, 21877 }, // ̈
+    { 7, 9, 0, -10, 28, 16, 21887 }, // ̉
+    { 8, 8, 0, -1, 28, 16, 21903 }, // ̊
+    { 13, 6, 0, -2, 26, 20, 21919 }, // ̋
+    { 11, 6, 0, -2, 26, 17, 21939 }, // ̌
+    { 6, 10, 0, 0, 26, 15, 21956 }, // ̍
+    { 10, 7, 0, -2, 26, 18, 21971 }, // ̎
+    { 12, 6, 0, -17, 26, 18, 21989 }, // ̏
+    { 11, 9, 0, -2, 29, 25, 22007 }, // ̐
+    { 11, 5, 0, -3, 25, 14, 22032 }, // ̑
+    { 7, 9, 0, -1, 24, 16, 22046 }, // ̒
+    { 7, 9, 0, -1, 24, 16, 22062 }, // ̓
+    { 5, 9, 0, 0, 24, 12, 22078 }, // ̔
+    { 7, 9, 0, -1, 24, 16, 22090 }, // ̕
+    { 7, 6, 0, -7, -1, 11, 22106 }, // ̖
+    { 8, 6, 0, -5, -1, 12, 22117 }, // ̗
+    { 8, 8, 0, -6, 0, 16, 22129 }, // ̘
+    { 8, 8, 0, -7, 0, 16, 22145 }, // ̙
+    { 10, 10, 11, 3, 26, 25, 22161 }, // ̚
+    { 8, 8, 0, -2, 26, 16, 22186 }, // ̛
+    { 5, 8, 0, -2, 0, 10, 22202 }, // ̜
+    { 8, 6, 0, -7, -1, 12, 22212 }, // ̝
+    { 8, 6, 0, -6, -1, 12, 22224 }, // ̞
+    { 9, 8, 0, -7, 0, 18, 22236 }, // ̟
+    { 8, 3, 0, -7, -2, 6, 22254 }, // ̠
+    { 8, 10, 0, -7, 2, 20, 22260 }, // ̡
+    { 7, 10, 0, -4, 2, 18, 22280 }, // ̢
+    { 4, 4, 0, -14, -2, 4, 22298 }, // ̣
+    { 10, 4, 0, -8, -2, 10, 22302 }, // ̤
+    { 8, 8, 0, -7, 0, 16, 22312 }, // ̥
+    { 6, 6, 0, 2, -2, 9, 22328 }, // ̦
+    { 7, 8, 0, -6, 0, 14, 22337 }, // ̧
+    { 6, 8, 0, -5, 0, 12, 22351 }, // ̨
+    { 5, 10, 0, -5, -1, 13, 22363 }, // ̩
+    { 14, 7, 0, -10, -1, 25, 22376 }, // ̪
+    { 14, 4, 0, -9, -2, 14, 22401 }, // ̫
+    { 11, 6, 0, -7, -1, 17, 22415 }, // ̬
+    { 11, 6, 0, -8, -1, 17, 22432 }, // ̭
+    { 10, 5, 0, -7, -1, 13, 22449 }, // ̮
+    { 11, 5, 0, -8, -1, 14, 22462 }, // ̯
+    { 13, 5, 0, -9, -1, 17, 22476 }, // ̰
+    { 10, 3, 0, -8, -2, 8, 22493 }, // ̱
+    { 15, 3, 0, -10, -3, 12, 22501 }, // ̲
+    { 15, 8, 0, -10, 0, 30, 22513 }, // ̳
+    { 14, 5, 0, -7, 12, 18, 22543 }, // ̴
+    { 14, 4, 0, -7, 12, 14, 22561 }, // ̵
+    { 24, 3, 0, -12, 11, 18, 22575 }, // ̶
+    { 10, 8, 0, -5, 14, 20, 22593 }, // ̷
+    { 20, 28, 0, -10, 26, 140, 22613 }, // ̸
+    { 5, 8, 0, -2, 0, 10, 22753 }, // ̹
+    { 14, 7, 0, -10, -1, 25, 22763 }, // ̺
+    { 14, 8, 0, -10, 0, 28, 22788 }, // ̻
+    { 13, 4, 0, -9, -2, 13, 22816 }, // ̼
+    { 8, 7, 0, -1, 26, 14, 22829 }, // ̽
+    { 8, 10, 0, -1, 29, 20, 22843 }, // ̾
+    { 15, 8, 0, -3, 33, 30, 22863 }, // ̿
+    { 7, 6, 0, -2, 26, 11, 22893 }, // ̀
+    { 8, 6, 0, 1, 26, 12, 22904 }, // ́
+    { 13, 5, 0, 5, 25, 17, 22916 }, // ͂
+    { 5, 6, 0, 1, 26, 8, 22933 }, // ̓
+    { 13, 6, 0, -3, 26, 20, 22941 }, // ̈́
+    { 6, 6, 0, -4, -2, 9, 22961 }, // ͅ
+    { 16, 7, 0, -5, 26, 28, 22970 }, // ͆
+    { 16, 8, 0, -10, 0, 32, 22998 }, // ͇
+    { 10, 7, 0, -8, -1, 18, 23030 }, // ͈
+    { 8, 6, 0, -6, -2, 12, 23048 }, // ͉
+    { 14, 8, 0, -4, 26, 28, 23060 }, // ͊
+    { 13, 12, 0, -3, 31, 39, 23088 }, // ͋
+    { 13, 9, 0, -3, 29, 30, 23127 }, // ͌
+    { 13, 7, 0, -9, -1, 23, 23157 }, // ͍
+    { 7, 8, 0, -6, 0, 14, 23180 }, // ͎
+    { 24, 24, 0, -12, 24, 144, 23194 }, // ͏
+    { 6, 8, 0, 0, 27, 12, 23338 }, // ͐
+    { 5, 8, 0, 4, 28, 10, 23350 }, // ͑
+    { 10, 9, 0, -2, 29, 23, 23360 }, // ͒
+    { 8, 7, 0, -6, -1, 14, 23383 }, // ͓
+    { 6, 7, 0, -5, -1, 11, 23397 }, // ͔
+    { 7, 7, 0, -5, -1, 13, 23408 }, // ͕
+    { 13, 7, 0, -8, -1, 23, 23421 }, // ͖
+    { 5, 8, 0, 3, 28, 10, 23444 }, // ͗
+    { 4, 5, 0, 1, 25, 5, 23454 }, // ͘
+    { 9, 7, 0, -7, -1, 16, 23459 }, // ͙
+    { 13, 8, 0, -9, 0, 26, 23475 }, // ͚
+    { 7, 8, 0, 0, 27, 14, 23501 }, // ͛
+    { 24, 7, 0, -14, -1, 42, 23515 }, // ͜
+    { 24, 7, 0, -9, 26, 42, 23557 }, // ͝
+    { 18, 3, 0, -6, 23, 14, 23599 }, // ͞
+    { 17, 3, 0, -11, -2, 13, 23613 }, // ͟
+    { 26, 5, 0, -10, 25, 33, 23626 }, // ͠
+    { 24, 7, 0, -9, 29, 42, 23659 }, // ͡
+    { 25, 7, 0, -16, -1, 44, 23701 }, // ͢
+    { 9, 8, 0, -1, 28, 18, 23745 }, // ͣ
+    { 7, 8, 0, 0, 28, 14, 23763 }, // ͤ
+    { 5, 11, 0, 1, 31, 14, 23777 }, // ͥ
+    { 8, 8, 0, -1, 28, 16, 23791 }, // ͦ
+    { 9, 8, 0, -1, 28, 18, 23807 }, // ͧ
+    { 7, 8, 0, 0, 28, 14, 23825 }, // ͨ
+    { 9, 11, 0, -1, 31, 25, 23839 }, // ͩ
+    { 8, 11, 0, -1, 31, 22, 23864 }, // ͪ
+    { 12, 8, 0, -3, 28, 24, 23886 }, // ͫ
+    { 7, 8, 0, 0, 28, 14, 23910 }, // ͬ
+    { 6, 10, 0, 1, 30, 15, 23924 }, // ͭ
+    { 8, 8, 0, 0, 28, 16, 23939 }, // ͮ
+    { 9, 8, 0, -1, 28, 18, 23955 }, // ͯ
+    { 18, 32, 17, 1, 32, 144, 23973 }, // Ѐ
+    { 18, 31, 17, 1, 31, 140, 0 }, // Ё
+    { 18, 25, 22, 3, 24, 113, 24117 }, // Ђ
+    { 18, 32, 16, 1, 32, 144, 24230 }, // Ѓ
+    { 20, 26, 19, 1, 25, 130, 24374 }, // Є
+    { 18, 26, 17, 0, 25, 117, 24504 }, // Ѕ
+    { 9, 24, 9, 1, 24, 54, 24621 }, // І
+    { 12, 31, 9, 1, 31, 93, 24675 }, // Ї
+    { 16, 31, 9, -6, 24, 124, 24768 }, // Ј
+    { 32, 25, 31, -2, 24, 200, 24892 }, // Љ
+    { 29, 24, 31, 1, 24, 174, 25092 }, // Њ
+    { 18, 24, 23, 3, 24, 108, 25266 }, // Ћ
+    { 21, 32, 19, 1, 32, 168, 25374 }, // Ќ
+    { 23, 32, 23, 1, 32, 184, 25542 }, // Ѝ
+    { 22, 32, 19, 0, 31, 176, 25726 }, // Ў
+    { 22, 30, 22, 1, 24, 165, 25902 }, // Џ
+    { 20, 24, 19, -2, 24, 120, 140 }, // А
+    { 18, 24, 18, 1, 24, 108, 260 }, // Б
+    { 19, 24, 20, 1, 24, 114, 368 }, // В
+    { 17, 24, 16, 1, 24, 102, 482 }, // Г
+    { 26, 30, 23, -3, 24, 195, 584 }, // Д
+    { 18, 24, 17, 1, 24, 108, 779 }, // Е
+    { 32, 24, 27, -2, 24, 192, 887 }, // Ж
+    { 19, 26, 17, -1, 25, 124, 1079 }, // З
+    { 23, 24, 23, 1, 24, 138, 1203 }, // И
+    { 23, 31, 23, 1, 31, 179, 1341 }, // Й
+    { 21, 24, 19, 1, 24, 126, 1520 }, // К
+    { 25, 25, 22, -2, 24, 157, 1646 }, // Л
+    { 27, 24, 28, 1, 24, 162, 1803 }, // М
+    { 22, 24, 23, 1, 24, 132, 1965 }, // Н
+    { 21, 26, 23, 2, 25, 137, 2097 }, // О
+    { 22, 24, 22, 1, 24, 132, 2234 }, // П
+    { 18, 24, 18, 1, 24, 108, 2366 }, // Р
+    { 19, 26, 19, 2, 25, 124, 2474 }, // С
+    { 17, 24, 17, 3, 24, 102, 2598 }, // Т
+    { 22, 25, 19, 0, 24, 138, 2700 }, // У
+    { 25, 26, 26, 1, 25, 163, 2838 }, // Ф
+    { 23, 24, 18, -2, 24, 138, 3001 }, // Х
+    { 22, 30, 23, 1, 24, 165, 3139 }, // Ц
+    { 18, 24, 21, 3, 24, 108, 3304 }, // Ч
+    { 31, 24, 32, 1, 24, 186, 3412 }, // Ш
+    { 31, 30, 32, 1, 24, 233, 3598 }, // Щ
+    { 17, 24, 21, 3, 24, 102, 3831 }, // Ъ
+    { 26, 24, 26, 1, 24, 156, 3933 }, // Ы
+    { 16, 24, 18, 1, 24, 96, 4089 }, // Ь
+    { 20, 26, 20, 0, 25, 130, 4185 }, // Э
+    { 30, 26, 31, 1, 25, 195, 4315 }, // Ю
+    { 22, 24, 19, -2, 24, 132, 4510 }, // Я
+    { 18, 20, 19, 1, 19, 90, 4642 }, // а
+    { 18, 27, 18, 1, 26, 122, 4732 }, // б
+    { 16, 20, 17, 1, 19, 80, 4854 }, // в
+    { 15, 20, 15, 0, 19, 75, 4934 }, // г
+    { 17, 27, 19, 1, 26, 115, 5009 }, // д
+    { 15, 20, 16, 1, 19, 75, 5124 }, // е
+    { 31, 20, 29, -1, 19, 155, 5199 }, // ж
+    { 14, 20, 15, 0, 19, 70, 5354 }, // з
+    { 18, 19, 19, 1, 18, 86, 5424 }, // и
+    { 18, 26, 19, 1, 25, 117, 5510 }, // й
+    { 18, 18, 17, 0, 18, 81, 5627 }, // к
+    { 21, 19, 19, -2, 18, 100, 5708 }, // л
+    { 25, 18, 25, 0, 18, 113, 5808 }, // м
+    { 19, 18, 19, 0, 18, 86, 5921 }, // н
+    { 17, 20, 19, 1, 19, 85, 6007 }, // о
+    { 18, 19, 19, 0, 19, 86, 6092 }, // п
+    { 19, 27, 19, -1, 19, 129, 6178 }, // р
+    { 15, 20, 15, 1, 19, 75, 6307 }, // с
+    { 28, 19, 29, 0, 19, 133, 6382 }, // т
+    { 21, 26, 16, -3, 18, 137, 6515 }, // у
+    { 21, 34, 22, 1, 26, 179, 6652 }, // ф
+    { 19, 18, 15, -2, 18, 86, 6831 }, // х
+    { 18, 23, 20, 1, 18, 104, 6917 }, // ц
+    { 16, 18, 19, 2, 18, 72, 7021 }, // ч
+    { 28, 19, 29, 1, 18, 133, 7093 }, // ш
+    { 28, 23, 30, 1, 18, 161, 7226 }, // щ
+    { 18, 19, 20, 1, 18, 86, 7387 }, // ъ
+    { 23, 19, 24, 1, 18, 110, 7473 }, // ы
+    { 15, 19, 17, 1, 18, 72, 7583 }, // ь
+    { 15, 20, 16, 0, 19, 75, 7655 }, // э
+    { 25, 20, 26, 0, 19, 125, 7730 }, // ю
+    { 19, 18, 17, -2, 18, 86, 7855 }, // я
+    { 15, 27, 16, 1, 26, 102, 26067 }, // ѐ
+    { 16, 26, 16, 1, 25, 104, 7941 }, // ё
+    { 18, 34, 19, 0, 26, 153, 26169 }, // ђ
+    { 16, 27, 15, 0, 26, 108, 26322 }, // ѓ
+    { 15, 20, 15, 1, 19, 75, 26430 }, // є
+    { 14, 20, 14, 0, 19, 70, 26505 }, // ѕ
+    { 10, 25, 9, 0, 25, 63, 26575 }, // і
+    { 11, 25, 8, 0, 25, 69, 26638 }, // ї
+    { 14, 33, 8, -5, 25, 116, 26707 }, // ј
+    { 28, 19, 27, -2, 18, 133, 26823 }, // љ
+    { 26, 19, 27, 0, 18, 124, 26956 }, // њ
+    { 18, 26, 19, 0, 26, 117, 27080 }, // ћ
+    { 18, 26, 17, 0, 26, 117, 27197 }, // ќ
+    { 18, 27, 19, 1, 26, 122, 27314 }, // ѝ
+    { 21, 33, 16, -3, 25, 174, 27436 }, // ў
+    { 18, 25, 19, 1, 18, 113, 27610 }, // џ
+    { 30, 25, 31, 3, 24, 188, 27723 }, // Ѡ
+    { 26, 18, 26, 2, 18, 117, 27911 }, // ѡ
+    { 16, 24, 20, 2, 24, 96, 28028 }, // Ѣ
+    { 26, 20, 28, 0, 19, 130, 28124 }, // ѣ
+    { 30, 26, 29, 1, 25, 195, 28254 }, // Ѥ
+    { 24, 20, 23, 0, 19, 120, 28449 }, // ѥ
+    { 21, 24, 20, -2, 24, 126, 28569 }, // Ѧ
+    { 18, 18, 18, -2, 18, 81, 28695 }, // ѧ
+    { 26, 24, 28, 1, 24, 156, 28776 }, // Ѩ
+    { 23, 18, 24, 0, 18, 104, 28932 }, // ѩ
+    { 26, 24, 22, -2, 24, 156, 29036 }, // Ѫ
+    { 22, 18, 20, -2, 18, 99, 29192 }, // ѫ
+    { 31, 24, 31, 1, 24, 186, 29291 }, // Ѭ
+    { 27, 18, 27, 0, 18, 122, 29477 }, // ѭ
+    { 20, 36, 18, -2, 29, 180, 29599 }, // Ѯ
+    { 17, 30, 15, -2, 23, 128, 29779 }, // ѯ
+    { 25, 24, 25, 3, 24, 150, 29907 }, // Ѱ
+    { 22, 34, 24, 1, 26, 187, 30057 }, // ѱ
+    { 21, 26, 24, 2, 25, 137, 30244 }, // Ѳ
+    { 17, 20, 19, 1, 19, 85, 30381 }, // ѳ
+    { 20, 24, 19, 3, 24, 120, 30466 }, // Ѵ
+    { 17, 18, 15, 1, 18, 77, 30586 }, // ѵ
+    { 20, 32, 19, 3, 32, 160, 30663 }, // Ѷ
+    { 17, 26, 15, 1, 26, 111, 30823 }, // ѷ
+    { 40, 33, 40, 2, 25, 330, 30934 }, // Ѹ
+    { 35, 27, 34, 1, 19, 237, 31264 }, // ѹ
+    { 22, 29, 25, 2, 26, 160, 31501 }, // Ѻ
+    { 17, 22, 19, 1, 20, 94, 31661 }, // ѻ
+    { 29, 36, 32, 2, 35, 261, 31755 }, // Ѽ
+    { 25, 31, 27, 1, 30, 194, 32016 }, // ѽ
+    { 30, 31, 31, 3, 30, 233, 32210 }, // Ѿ
+    { 26, 24, 26, 2, 24, 156, 32443 }, // ѿ
+    { 20, 33, 20, 2, 25, 165, 32599 }, // Ҁ
+    { 15, 27, 15, 1, 19, 102, 32764 }, // ҁ
+    { 18, 22, 20, 1, 21, 99, 32866 }, // ҂
+    { 14, 5, 0, -14, 24, 18, 32965 }, // ҃
+    { 14, 5, 0, -14, 25, 18, 32983 }, // ҄
+    { 4, 6, 0, -9, 26, 6, 33001 }, // ҅
+    { 5, 6, 0, -9, 26, 8, 33007 }, // ҆
+    { 14, 5, 0, -3, 30, 18, 33015 }, // ҇
+    { 38, 36, 0, -19, 27, 342, 33033 }, // ҈
+    { 38, 38, 0, -19, 28, 361, 33375 }, // ҉
+    { 23, 38, 24, 1, 31, 219, 33736 }, // Ҋ
+    { 18, 33, 19, 1, 26, 149, 33955 }, // ҋ
+    { 16, 24, 18, 1, 24, 96, 34104 }, // Ҍ
+    { 14, 27, 17, 2, 26, 95, 0 }, // ҍ
+    { 18, 24, 19, 1, 24, 108, 95 }, // Ҏ
+    { 19, 27, 19, -1, 19, 129, 203 }, // ҏ
+    { 19, 29, 16, 1, 29, 138, 332 }, // Ґ
+    { 16, 24, 13, 0, 24, 96, 470 }, // ґ
+    { 18, 24, 16, 1, 24, 108, 566 }, // Ғ
+    { 15, 18, 13, 0, 18, 68, 674 }, // ғ
+    { 18, 33, 20, 1, 24, 149, 742 }, // Ҕ
+    { 15, 27, 17, 0, 18, 102, 891 }, // ҕ
+    { 32, 31, 28, -2, 24, 248, 993 }, // Җ
+    { 31, 26, 28, -1, 19, 202, 1241 }, // җ
+    { 19, 33, 17, -1, 25, 157, 1443 }, // Ҙ
+    { 14, 27, 15, 0, 19, 95, 1600 }, // ҙ
+    { 21, 31, 20, 1, 24, 163, 1695 }, // Қ
+    { 18, 25, 18, 0, 18, 113, 1858 }, // қ
+    { 21, 24, 19, 1, 24, 126, 1971 }, // Ҝ
+    { 19, 18, 16, 0, 18, 86, 2097 }, // ҝ
+    { 21, 24, 19, 1, 24, 126, 2183 }, // Ҟ
+    { 18, 26, 16, 0, 26, 117, 2309 }, // ҟ
+    { 22, 24, 21, 3, 24, 132, 2426 }, // Ҡ
+    { 20, 18, 19, 1, 18, 90, 2558 }, // ҡ
+    { 22, 31, 23, 1, 24, 171, 2648 }, // Ң
+    { 20, 25, 20, 0, 18, 125, 2819 }, // ң
+    { 28, 24, 25, 1, 24, 168, 2944 }, // Ҥ
+    { 25, 18, 23, 0, 18, 113, 3112 }, // ҥ
+    { 30, 33, 33, 1, 24, 248, 3225 }, // Ҧ
+    { 26, 27, 27, 0, 18, 176, 3473 }, // ҧ
+    { 21, 27, 24, 2, 25, 142, 3649 }, // Ҩ
+    { 18, 20, 20, 1, 19, 90, 3791 }, // ҩ
+    { 20, 33, 20, 2, 25, 165, 3881 }, // Ҫ
+    { 15, 27, 15, 1, 19, 102, 4046 }, // ҫ
+    { 17, 31, 17, 3, 24, 132, 4148 }, // Ҭ
+    { 28, 26, 30, 0, 19, 182, 4280 }, // ҭ
+    { 18, 24, 17, 3, 24, 108, 4462 }, // Ү
+    { 17, 26, 16, 1, 18, 111, 4570 }, // ү
+    { 20, 24, 17, 1, 24, 120, 4681 }, // Ұ
+    { 19, 26, 16, -1, 18, 124, 4801 }, // ұ
+    { 23, 31, 19, -2, 24, 179, 4925 }, // Ҳ
+    { 19, 25, 18, -1, 18, 119, 5104 }, // ҳ
+    { 24, 31, 26, 3, 24, 186, 5223 }, // Ҵ
+    { 20, 25, 22, 1, 18, 125, 5409 }, // ҵ
+    { 19, 31, 22, 3, 24, 148, 5534 }, // Ҷ
+    { 16, 25, 18, 2, 18, 100, 5682 }, // ҷ
+    { 19, 24, 21, 3, 24, 114, 5782 }, // Ҹ
+    { 16, 18, 19, 2, 18, 72, 5896 }, // ҹ
+    { 19, 24, 21, 1, 24, 114, 5968 }, // Һ
+    { 18, 26, 19, 0, 26, 117, 6082 }, // һ
+    { 24, 26, 26, 2, 25, 156, 6199 }, // Ҽ
+    { 19, 20, 20, 1, 19, 95, 6355 }, // ҽ
+    { 24, 32, 26, 2, 25, 192, 6450 }, // Ҿ
+    { 19, 26, 20, 1, 19, 124, 6642 }, // ҿ
+    { 14, 24, 11, -1, 24, 84, 6766 }, // Ӏ
+    { 32, 31, 27, -2, 31, 248, 6850 }, // Ӂ
+    { 31, 26, 29, -1, 25, 202, 7098 }, // ӂ
+    { 21, 33, 21, 1, 24, 174, 7300 }, // Ӄ
+    { 18, 27, 17, 0, 18, 122, 7474 }, // ӄ
+    { 24, 31, 22, -2, 24, 186, 7596 }, // Ӆ
+    { 20, 26, 18, -2, 19, 130, 7782 }, // ӆ
+    { 22, 33, 23, 1, 24, 182, 7912 }, // Ӈ
+    { 20, 27, 20, 0, 18, 135, 8094 }, // ӈ
+    { 22, 31, 23, 1, 24, 171, 8229 }, // Ӊ
+    { 20, 25, 20, 0, 18, 125, 8400 }, // ӊ
+    { 19, 31, 21, 3, 24, 148, 8525 }, // Ӌ
+    { 16, 25, 19, 3, 18, 100, 8673 }, // ӌ
+    { 28, 31, 28, 1, 24, 217, 8773 }, // Ӎ
+    { 23, 25, 23, 0, 18, 144, 8990 }, // ӎ
+    { 14, 24, 11, -1, 24, 84, 9134 }, // ӏ
+    { 21, 31, 19, -2, 31, 163, 9218 }, // Ӑ
+    { 18, 26, 19, 1, 25, 117, 9381 }, // ӑ
+    { 20, 31, 19, -2, 31, 155, 9498 }, // Ӓ
+    { 18, 26, 19, 1, 25, 117, 9653 }, // ӓ
+    { 31, 24, 27, -2, 24, 186, 9770 }, // Ӕ
+    { 26, 20, 27, 1, 19, 130, 9956 }, // ӕ
+    { 18, 31, 17, 1, 31, 140, 10086 }, // Ӗ
+    { 17, 26, 17, 1, 25, 111, 10226 }, // ӗ
+    { 20, 26, 22, 1, 25, 130, 10337 }, // Ә
+    { 15, 20, 16, 0, 19, 75, 10467 }, // ә
+    { 20, 32, 22, 1, 31, 160, 10542 }, // Ӛ
+    { 16, 26, 16, 0, 25, 104, 10702 }, // ӛ
+    { 32, 31, 27, -2, 31, 248, 10806 }, // Ӝ
+    { 31, 26, 29, -1, 25, 202, 11054 }, // ӝ
+    { 19, 32, 17, -1, 31, 152, 11256 }, // Ӟ
+    { 15, 26, 15, 0, 25, 98, 11408 }, // ӟ
+    { 19, 25, 18, 0, 24, 119, 11506 }, // Ӡ
+    { 18, 26, 15, -3, 18, 117, 11625 }, // ӡ
+    { 23, 29, 23, 1, 29, 167, 11742 }, // Ӣ
+    { 18, 24, 19, 1, 23, 108, 11909 }, // ӣ
+    { 23, 31, 23, 1, 31, 179, 12017 }, // Ӥ
+    { 18, 26, 19, 1, 25, 117, 12196 }, // ӥ
+    { 21, 32, 24, 2, 31, 168, 12313 }, // Ӧ
+    { 17, 26, 19, 1, 25, 111, 12481 }, // ӧ
+    { 21, 26, 24, 2, 25, 137, 12592 }, // Ө
+    { 17, 20, 19, 1, 19, 85, 12729 }, // ө
+    { 21, 32, 24, 2, 31, 168, 12814 }, // Ӫ
+    { 17, 26, 19, 1, 25, 111, 12982 }, // ӫ
+    { 20, 32, 20, 0, 31, 160, 13093 }, // Ӭ
+    { 15, 26, 16, 0, 25, 98, 13253 }, // ӭ
+    { 22, 30, 19, 0, 29, 165, 13351 }, // Ӯ
+    { 22, 31, 16, -4, 23, 171, 13516 }, // ӯ
+    { 22, 32, 19, 0, 31, 176, 13687 }, // Ӱ
+    { 22, 33, 16, -4, 25, 182, 13863 }, // ӱ
+    { 22, 33, 19, 0, 32, 182, 14045 }, // Ӳ
+    { 22, 34, 16, -4, 26, 187, 14227 }, // ӳ
+    { 18, 31, 21, 3, 31, 140, 14414 }, // Ӵ
+    { 16, 25, 19, 2, 25, 100, 14554 }, // ӵ
+    { 18, 31, 16, 1, 24, 140, 14654 }, // Ӷ
+    { 15, 25, 13, 0, 18, 94, 14794 }, // ӷ
+    { 26, 31, 26, 1, 31, 202, 14888 }, // Ӹ
+    { 23, 26, 24, 1, 25, 150, 15090 }, // ӹ
+    { 19, 31, 16, 0, 24, 148, 15240 }, // Ӻ
+    { 16, 25, 13, -1, 18, 100, 15388 }, // ӻ
+    { 23, 31, 18, -2, 24, 179, 15488 }, // Ӽ
+    { 19, 25, 16, -2, 18, 119, 15667 }, // ӽ
+    { 23, 24, 18, -2, 24, 138, 15786 }, // Ӿ
+    { 19, 18, 16, -2, 18, 86, 15924 }, // ӿ
+    { 0, 0, 17, 0, 0, 0, 16010 }, //  
+    { 0, 0, 33, 0, 0, 0, 16010 }, //  
+    { 0, 0, 17, 0, 0, 0, 16010 }, //  
+    { 0, 0, 33, 0, 0, 0, 16010 }, //  
+    { 0, 0, 11, 0, 0, 0, 16010 }, //  
+    { 0, 0, 8, 0, 0, 0, 16010 }, //  
+    { 0, 0, 6, 0, 0, 0, 16010 }, //  
+    { 0, 0, 18, 0, 0, 0, 16010 }, //  
+    { 0, 0, 9, 0, 0, 0, 16010 }, //  
+    { 0, 0, 6, 0, 0, 0, 16010 }, //  
+    { 0, 0, 3, 0, 0, 0, 16010 }, //  
+    { 0, 0, 0, 0, 0, 0, 16010 }, // ​
+    { 0, 0, 0, 0, 0, 0, 16010 }, // ‌
+    { 0, 0, 0, 0, 0, 0, 16010 }, // ‍
+    { 9, 28, 0, -1, 23, 63, 16010 }, // ‎
+    { 9, 28, 0, -8, 23, 63, 16073 }, // ‏
+    { 10, 4, 10, 0, 11, 10, 16136 }, // ‐
+    { 10, 4, 10, 0, 11, 10, 16146 }, // ‑
+    { 17, 4, 18, 1, 14, 17, 16156 }, // ‒
+    { 15, 4, 16, 0, 11, 15, 15342 }, // –
+    { 31, 4, 32, 0, 11, 31, 15357 }, // —
+    { 31, 4, 32, 0, 11, 31, 16173 }, // ―
+    { 10, 35, 18, 5, 26, 88, 16204 }, // ‖
+    { 16, 8, 13, -4, 0, 32, 16292 }, // ‗
+    { 7, 9, 6, 2, 24, 16, 15388 }, // ‘
+    { 7, 9, 6, 2, 24, 16, 15404 }, // ’
+    { 7, 9, 8, -2, 4, 16, 16324 }, // ‚
+    { 5, 9, 6, 3, 24, 12, 16340 }, // ‛
+    { 13, 9, 12, 2, 24, 30, 15420 }, // “
+    { 13, 9, 12, 2, 24, 30, 15450 }, // ”
+    { 14, 9, 14, -2, 4, 32, 16352 }, // „
+    { 10, 9, 12, 3, 24, 23, 16384 }, // ‟
+    { 13, 26, 16, 3, 26, 85, 16407 }, // †
+    { 16, 26, 16, 1, 26, 104, 16492 }, // ‡
+    { 8, 9, 13, 3, 17, 18, 16596 }, // •
+    { 11, 11, 12, 1, 18, 31, 16614 }, // ‣
+    { 5, 6, 17, 4, 5, 8, 16645 }, // ․
+    { 14, 6, 17, 0, 5, 21, 16653 }, // ‥
+    { 22, 6, 26, 0, 5, 33, 15480 }, // …
+    { 5, 6, 9, 2, 12, 8, 16674 }, // ‧
+    { 0, 0, 20, 0, 0, 0, 16682 }, //  
+    { 0, 0, 20, 0, 0, 0, 16682 }, //  
+    { 9, 26, 0, -1, 21, 59, 16682 }, // ‪
+    { 9, 26, 0, -8, 21, 59, 16741 }, // ‫
+    { 8, 28, 0, -4, 23, 56, 16800 }, // ‬
+    { 8, 28, 0, -4, 23, 56, 16856 }, // ‭
+    { 8, 28, 0, -4, 23, 56, 16912 }, // ‮
+    { 0, 0, 6, 0, 0, 0, 16968 }, //  
+    { 35, 26, 38, 2, 25, 228, 16968 }, // ‰
+    { 45, 26, 48, 2, 25, 293, 17196 }, // ‱
+    { 8, 9, 7, 2, 24, 18, 17489 }, // ′
+    { 14, 9, 13, 2, 24, 32, 17507 }, // ″
+    { 19, 9, 19, 2, 24, 43, 17539 }, // ‴
+    { 5, 9, 9, 4, 24, 12, 17582 }, // ‵
+    { 11, 9, 14, 4, 24, 25, 17594 }, // ‶
+    { 16, 9, 19, 4, 24, 36, 17619 }, // ‷
+    { 13, 11, 13, -3, 3, 36, 17655 }, // ‸
+    { 9, 15, 10, 1, 16, 34, 17691 }, // ‹
+    { 9, 15, 10, 0, 16, 34, 17725 }, // ›
+    { 26, 26, 28, 1, 25, 169, 17759 }, // ※
+    { 17, 25, 16, 0, 24, 107, 17928 }, // ‼
+    { 14, 26, 14, 2, 25, 91, 18035 }, // ‽
+    { 15, 3, 13, 3, 28, 12, 18126 }, // ‾
+    { 18, 7, 18, -2, -1, 32, 18138 }, // ‿
+    { 18, 8, 18, 2, 27, 36, 18170 }, // ⁀
+    { 16, 22, 11, -4, 14, 88, 18206 }, // ⁁
+    { 36, 31, 37, 0, 26, 279, 18294 }, // ⁂
+    { 9, 4, 10, 0, 11, 9, 18573 }, // ⁃
+    { 21, 24, 4, -8, 24, 126, 18582 }, // ⁄
+    { 14, 30, 10, -1, 24, 105, 18708 }, // ⁅
+    { 14, 30, 10, -3, 24, 105, 18813 }, // ⁆
+    { 28, 26, 29, 2, 25, 182, 18918 }, // ⁇
+    { 22, 26, 23, 2, 25, 143, 19100 }, // ⁈
+    { 24, 26, 23, 0, 25, 156, 19243 }, // ⁉
+    { 17, 18, 17, 2, 18, 77, 19399 }, // ⁊
+    { 17, 31, 20, 3, 26, 132, 19476 }, // ⁋
+    { 18, 17, 21, 1, 18, 77, 19608 }, // ⁌
+    { 18, 17, 21, 2, 18, 77, 19685 }, // ⁍
+    { 17, 16, 18, -1, 9, 68, 19762 }, // ⁎
+    { 7, 24, 9, 1, 19, 42, 19830 }, // ⁏
+    { 22, 35, 18, -2, 27, 193, 19872 }, // ⁐
+    { 19, 33, 18, 0, 26, 157, 20065 }, // ⁑
+    { 13, 26, 12, 0, 25, 85, 20222 }, // ⁒
+    { 29, 6, 33, 3, 13, 44, 20307 }, // ⁓
+    { 18, 8, 18, -3, 0, 36, 20351 }, // ⁔
+    { 18, 18, 19, 0, 17, 81, 20387 }, // ⁕
+    { 15, 26, 17, 1, 25, 98, 20468 }, // ⁖
+    { 25, 9, 24, 2, 24, 57, 20566 }, // ⁗
+    { 25, 26, 27, 1, 25, 163, 20623 }, // ⁘
+    { 25, 26, 28, 1, 25, 163, 20786 }, // ⁙
+    { 5, 26, 7, 1, 25, 33, 20949 }, // ⁚
+    { 20, 26, 22, 1, 25, 130, 20982 }, // ⁛
+    { 25, 26, 27, 1, 25, 163, 21112 }, // ⁜
+    { 5, 25, 9, 2, 24, 32, 21275 }, // ⁝
+    { 5, 26, 9, 3, 25, 33, 21307 }, // ⁞
+    { 0, 0, 7, 0, 0, 0, 21340 }, //  
+    { 0, 0, 20, 0, 0, 0, 21340 }, // ⁠
+    { 0, 0, 20, 0, 0, 0, 21340 }, // ⁡
+    { 0, 0, 20, 0, 0, 0, 21340 }, // ⁢
+    { 0, 0, 20, 0, 0, 0, 21340 }, // ⁣
+    { 0, 0, 20, 0, 0, 0, 21340 }, // ⁤
+    { 0, 0, 20, 0, 0, 0, 21340 }, // ⁦
+    { 0, 0, 20, 0, 0, 0, 21340 }, // ⁧
+    { 0, 0, 20, 0, 0, 0, 21340 }, // ⁨
+    { 0, 0, 20, 0, 0, 0, 21340 }, // ⁩
+    { 8, 28, 0, -4, 23, 56, 21340 }, // ⁪
+    { 8, 28, 0, -4, 23, 56, 21396 }, // ⁫
+    { 8, 28, 0, -4, 23, 56, 21452 }, // ⁬
+    { 8, 29, 0, -4, 24, 58, 21508 }, // ⁭
+    { 8, 28, 0, -4, 23, 56, 21566 }, // ⁮
+    { 8, 28, 0, -4, 23, 56, 21622 }, // ⁯
+    { 11, 16, 12, 3, 29, 44, 21678 }, // ⁰
+    { 6, 16, 7, 2, 25, 24, 21722 }, // ⁱ
+    { 12, 16, 12, 2, 29, 48, 21746 }, // ⁴
+    { 11, 16, 12, 3, 29, 44, 21794 }, // ⁵
+    { 11, 16, 12, 3, 29, 44, 21838 }, // ⁶
+    { 12, 16, 12, 3, 29, 48, 21882 }, // ⁷
+    { 12, 16, 12, 2, 29, 48, 21930 }, // ⁸
+    { 11, 16, 12, 3, 29, 44, 21978 }, // ⁹
+    { 10, 10, 11, 3, 25, 25, 22022 }, // ⁺
+    { 10, 3, 11, 3, 22, 8, 22047 }, // ⁻
+    { 10, 6, 11, 3, 23, 15, 22055 }, // ⁼
+    { 9, 18, 6, 3, 30, 41, 22070 }, // ⁽
+    { 8, 18, 6, 0, 30, 36, 22111 }, // ⁾
+    { 12, 12, 13, 2, 21, 36, 22147 }, // ⁿ
+    { 11, 16, 12, -1, 11, 44, 22183 }, // ₀
+    { 7, 16, 12, 1, 11, 28, 22227 }, // ₁
+    { 12, 16, 12, -2, 11, 48, 22255 }, // ₂
+    { 12, 16, 12, -2, 11, 48, 22303 }, // ₃
+    { 12, 16, 12, -2, 11, 48, 22351 }, // ₄
+    { 11, 16, 12, -1, 11, 44, 22399 }, // ₅
+    { 11, 16, 12, -1, 11, 44, 22443 }, // ₆
+    { 12, 16, 12, -1, 11, 48, 22487 }, // ₇
+    { 11, 16, 12, -1, 11, 44, 22535 }, // ₈
+    { 11, 16, 12, -1, 11, 44, 22579 }, // ₉
+    { 10, 10, 11, -1, 7, 25, 22623 }, // ₊
+    { 10, 3, 11, -1, 4, 8, 22648 }, // ₋
+    { 10, 6, 11, -1, 5, 15, 22656 }, // ₌
+    { 8, 18, 6, 0, 12, 36, 22671 }, // ₍
+    { 8, 18, 6, -4, 12, 36, 22707 }, // ₎
+    { 12, 12, 12, -1, 8, 36, 22743 }, // ₐ
+    { 10, 12, 11, -1, 8, 30, 22779 }, // ₑ
+    { 11, 12, 12, -1, 8, 33, 22809 }, // ₒ
+    { 13, 12, 10, -3, 8, 39, 22842 }, // ₓ
+    { 10, 12, 11, -2, 8, 30, 22881 }, // ₔ
+    { 11, 16, 15, 0, 12, 44, 22911 }, // ₕ
+    { 11, 16, 12, 0, 12, 44, 22955 }, // ₖ
+    { 6, 16, 8, 0, 12, 24, 22999 }, // ₗ
+    { 18, 12, 21, 0, 8, 54, 23023 }, // ₘ
+    { 12, 12, 13, -2, 8, 36, 23077 }, // ₙ
+    { 13, 16, 13, -3, 8, 52, 23113 }, // ₚ
+    { 9, 12, 10, -1, 8, 27, 23165 }, // ₛ
+    { 8, 14, 7, -1, 10, 28, 23192 }, // ₜ
+    { 17, 25, 18, 2, 25, 107, 23220 }, // ₠
+    { 19, 28, 18, 1, 26, 133, 23327 }, // ₡
+    { 18, 26, 18, 2, 25, 117, 23460 }, // ₢
+    { 20, 24, 18, 0, 24, 120, 23577 }, // ₣
+    { 21, 25, 18, -1, 25, 132, 23697 }, // ₤
+    { 28, 27, 29, 0, 23, 189, 23829 }, // ₥
+    { 20, 24, 18, 0, 24, 120, 24018 }, // ₦
+    { 24, 25, 25, 0, 24, 150, 24138 }, // ₧
+    { 27, 25, 27, 0, 24, 169, 24288 }, // ₨
+    { 24, 24, 21, 0, 24, 144, 24457 }, // ₩
+    { 28, 24, 27, 0, 24, 168, 24601 }, // ₪
+    { 22, 32, 19, 0, 26, 176, 24769 }, // ₫
+    { 20, 26, 18, 1, 25, 130, 24945 }, // €
+    { 21, 24, 19, 1, 24, 126, 25075 }, // ₭
+    { 19, 24, 17, 1, 24, 114, 25201 }, // ₮
+    { 32, 33, 32, 0, 25, 264, 25315 }, // ₯
+    { 21, 33, 18, -2, 25, 174, 25579 }, // ₰
+    { 20, 24, 18, 1, 24, 120, 25753 }, // ₱
+    { 21, 29, 23, 2, 26, 153, 25873 }, // ₲
+    { 22, 24, 19, -2, 24, 132, 26026 }, // ₳
+    { 20, 26, 17, -1, 25, 130, 26158 }, // ₴
+    { 20, 29, 20, 2, 26, 145, 26288 }, // ₵
+    { 21, 23, 19, 0, 22, 121, 26433 }, // ₶
+    { 24, 28, 22, -1, 25, 168, 26554 }, // ₷
+    { 17, 24, 16, 2, 24, 102, 26722 }, // ₸
+    { 17, 24, 18, 3, 24, 102, 26824 }, // ₹
+    { 19, 25, 18, 0, 24, 119, 26926 }, // ₺
+    { 22, 26, 22, 1, 25, 143, 27045 }, // ₻
+    { 24, 24, 25, -1, 24, 144, 27188 }, // ₼
+    { 21, 24, 19, -1, 24, 126, 27332 }, // ₽
+    { 22, 28, 20, -1, 28, 154, 27458 }, // ₾
+    { 18, 32, 18, 1, 28, 144, 27612 }, // ₿
+    { 10, 4, 10, 0, 11, 10, 27756 }, // −
+    { 30, 34, 21, -4, 26, 255, 27766 }, // ﬀ
+    { 24, 34, 19, -4, 26, 204, 28021 }, // ﬁ
+    { 24, 34, 19, -4, 26, 204, 28225 }, // ﬂ
+    { 35, 34, 30, -4, 26, 298, 28429 }, // ﬃ
+    { 35, 34, 30, -4, 26, 298, 28727 }, // ﬄ
+    { 27, 34, 21, -5, 26, 230, 29025 }, // ﬅ
+    { 27, 27, 25, 0, 26, 183, 29255 }, // ﬆ
+    { 31, 32, 33, 1, 26, 248, 29438 }, // �
 };
 
 static const EpdUnicodeInterval notosans_16_italicIntervals[] = {
@@ -3196,31 +3228,301 @@ static const EpdUnicodeInterval notosans_16_italicIntervals[] = {
     { 0x2090, 0x209C, 0x33D },
     { 0x20A0, 0x20BF, 0x34A },
     { 0x2212, 0x2212, 0x36A },
-    { 0xFFFD, 0xFFFD, 0x36B },
+    { 0xFB00, 0xFB06, 0x36B },
+    { 0xFFFD, 0xFFFD, 0x372 },
 };
 
 static const EpdFontGroup notosans_16_italicGroups[] = {
-    { 0, 4394, 9152, 97, 0 },
-    { 4394, 4446, 10870, 96, 97 },
-    { 8840, 6249, 17101, 128, 193 },
-    { 15089, 1551, 2192, 112, 321 },
-    { 16640, 13557, 34282, 256, 433 },
-    { 30197, 2742, 5839, 111, 689 },
-    { 32939, 1043, 1542, 42, 800 },
-    { 33982, 2532, 4536, 32, 842 },
-    { 36514, 12, 10, 1, 874 },
-    { 36526, 125, 248, 1, 875 },
+    { 0, 6159, 15513, 151, 2 },
+    { 6159, 3897, 8045, 66, 434 },
+    { 10056, 13959, 34200, 364, 0 },
+    { 24015, 13028, 29686, 302, 574 },
+};
+
+static const uint8_t notosans_16_italicGlyphGroups[883] = {
+    2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2,
+    2, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 2, 2,
+    2, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 0, 0, 3, 3, 3, 0, 0, 3, 3, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+};
+
+static const uint8_t notosans_16_italicKernLeftClasses[883] = {
+    0, 0, 72, 0, 2, 0, 0, 0, 61, 2, 19, 0, 0, 0, 7, 26,
+    7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 13, 47, 42, 18, 32, 64, 0, 0, 0, 0, 42, 22, 0,
+    0, 18, 43, 18, 0, 0, 11, 47, 38, 38, 42, 17, 66, 19, 0, 0,
+    0, 71, 0, 0, 31, 77, 0, 31, 59, 0, 0, 0, 0, 63, 0, 0,
+    0, 31, 31, 0, 29, 0, 58, 0, 39, 39, 63, 39, 0, 19, 0, 0,
+    0, 0, 69, 0, 0, 0, 0, 0, 0, 0, 0, 0, 51, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 36, 0, 0, 0,
+    60, 13, 13, 13, 13, 13, 13, 32, 42, 32, 32, 32, 32, 0, 0, 0,
+    0, 18, 0, 18, 18, 18, 18, 18, 0, 18, 47, 47, 47, 47, 17, 43,
+    0, 0, 0, 0, 0, 0, 0, 31, 0, 31, 31, 31, 31, 0, 0, 0,
+    73, 31, 0, 31, 31, 31, 31, 31, 0, 31, 0, 0, 0, 0, 39, 31,
+    39, 13, 0, 13, 0, 13, 0, 42, 0, 42, 0, 42, 0, 42, 0, 18,
+    37, 18, 0, 32, 31, 32, 31, 32, 31, 32, 31, 32, 31, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 62, 0, 73, 0, 0, 32,
+    0, 0, 0, 0, 0, 0, 0, 42, 63, 63, 22, 0, 22, 0, 22, 37,
+    22, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 31, 18,
+    31, 18, 31, 32, 31, 0, 29, 0, 29, 0, 29, 0, 0, 0, 0, 0,
+    0, 0, 0, 11, 58, 11, 68, 11, 58, 47, 0, 47, 0, 47, 0, 47,
+    0, 47, 0, 47, 0, 38, 39, 17, 39, 17, 66, 0, 66, 0, 66, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 12, 10, 28, 76, 0, 0, 70, 12, 12, 48, 8, 0, 1,
+    0, 5, 56, 46, 10, 4, 0, 8, 46, 0, 0, 8, 0, 0, 0, 14,
+    0, 24, 28, 10, 1, 44, 8, 4, 0, 0, 4, 12, 0, 12, 14, 14,
+    0, 45, 53, 33, 30, 40, 30, 20, 33, 45, 45, 52, 45, 45, 45, 3,
+    34, 3, 20, 34, 16, 3, 52, 23, 45, 45, 23, 6, 45, 6, 3, 3,
+    45, 30, 30, 50, 30, 20, 67, 0, 57, 65, 6, 6, 34, 52, 45, 16,
+    45, 1, 55, 41, 6, 28, 0, 5, 35, 5, 35, 0, 0, 0, 0, 46,
+    33, 0, 0, 14, 3, 1, 55, 1, 55, 16, 16, 14, 3, 14, 3, 1,
+    55, 28, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 40, 41, 6, 24,
+    3, 9, 49, 15, 54, 0, 27, 21, 0, 46, 33, 21, 0, 8, 20, 8,
+    20, 8, 20, 4, 40, 15, 49, 0, 27, 0, 3, 28, 0, 9, 40, 25,
+    47, 25, 47, 21, 0, 4, 40, 4, 40, 0, 0, 0, 27, 45, 30, 45,
+    30, 0, 8, 20, 0, 20, 4, 40, 0, 0, 4, 40, 0, 0, 4, 40,
+    0, 5, 0, 5, 0, 0, 30, 0, 30, 14, 3, 14, 3, 8, 20, 46,
+    33, 0, 0, 0, 0, 0, 0, 14, 3, 14, 3, 14, 3, 14, 3, 1,
+    16, 1, 16, 1, 16, 0, 45, 9, 49, 0, 45, 15, 54, 21, 0, 8,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 26, 26, 26, 0, 0, 2, 2, 7, 0, 2, 2, 7,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 51, 36, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 74, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 75, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 59, 0, 0, 0, 0,
+    0, 0, 0,
+};
+
+static const uint8_t notosans_16_italicKernRightClasses[883] = {
+    0, 0, 0, 68, 9, 0, 0, 0, 64, 9, 0, 30, 0, 0, 2, 24,
+    2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28, 28, 0, 0,
+    0, 57, 0, 11, 0, 4, 0, 0, 0, 4, 0, 0, 41, 0, 0, 0,
+    0, 4, 0, 4, 0, 0, 18, 49, 38, 38, 61, 31, 0, 0, 0, 30,
+    0, 0, 0, 14, 0, 1, 1, 1, 63, 7, 0, 0, 63, 0, 0, 7,
+    7, 1, 7, 1, 7, 7, 0, 7, 21, 21, 0, 21, 52, 0, 0, 30,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0,
+    0, 11, 11, 11, 11, 11, 11, 70, 4, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4, 4, 4, 4, 4, 0, 4, 49, 49, 49, 49, 31, 0,
+    63, 1, 14, 14, 14, 14, 14, 14, 1, 1, 1, 1, 1, 0, 0, 0,
+    0, 0, 7, 1, 1, 1, 1, 1, 0, 1, 7, 7, 7, 7, 21, 0,
+    21, 11, 14, 11, 14, 11, 14, 4, 1, 4, 1, 4, 1, 4, 1, 0,
+    1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 4, 7, 4,
+    7, 4, 7, 4, 7, 0, 0, 0, 68, 0, 62, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 63, 0, 0, 7, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 7, 0, 7, 0, 7, 0, 0, 7, 4, 1, 4,
+    1, 4, 1, 4, 1, 0, 7, 0, 7, 0, 0, 0, 7, 0, 7, 0,
+    7, 0, 7, 18, 0, 18, 0, 18, 0, 49, 7, 49, 7, 49, 7, 49,
+    7, 49, 7, 49, 7, 38, 21, 31, 21, 31, 0, 52, 0, 52, 0, 52,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 3, 0, 35, 69, 0, 0, 33, 25, 0, 3, 0, 0, 17,
+    0, 12, 0, 0, 0, 44, 0, 19, 42, 0, 0, 0, 25, 0, 0, 35,
+    0, 0, 35, 3, 17, 45, 19, 0, 5, 0, 0, 3, 0, 0, 42, 0,
+    66, 16, 67, 16, 36, 53, 16, 22, 36, 55, 55, 28, 29, 28, 28, 16,
+    28, 28, 16, 28, 10, 16, 60, 55, 6, 55, 55, 15, 55, 55, 22, 28,
+    65, 16, 16, 23, 36, 16, 59, 0, 58, 48, 29, 28, 23, 28, 55, 10,
+    55, 43, 39, 51, 0, 0, 20, 12, 34, 0, 20, 0, 0, 0, 20, 42,
+    36, 5, 20, 13, 8, 43, 39, 43, 39, 13, 8, 13, 8, 13, 8, 43,
+    39, 13, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 51, 23, 0,
+    20, 0, 20, 51, 0, 0, 20, 19, 36, 42, 36, 0, 20, 0, 20, 51,
+    23, 40, 15, 0, 20, 0, 20, 0, 20, 13, 8, 13, 8, 3, 20, 50,
+    56, 50, 56, 19, 22, 40, 15, 5, 6, 5, 6, 0, 20, 27, 37, 27,
+    37, 0, 19, 22, 0, 20, 47, 34, 0, 20, 0, 20, 5, 6, 0, 20,
+    0, 12, 54, 12, 54, 12, 54, 0, 8, 51, 36, 51, 36, 19, 22, 42,
+    36, 0, 0, 0, 20, 0, 20, 13, 8, 13, 8, 13, 8, 42, 22, 17,
+    10, 17, 10, 17, 10, 5, 6, 0, 20, 0, 55, 51, 0, 19, 22, 19,
+    22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 24, 24, 24, 0, 0, 26, 9, 2, 0, 26, 9, 2,
+    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32, 46, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 71, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 72, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 63, 0, 0, 0, 0,
+    0, 0, 0,
+};
+
+static const int8_t notosans_16_italicKernMatrix[5694] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -3, 0, 0, 0, -1, 0, -1, 0, 0, 0, -3, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 2, -1, -3, 0, -1, -1, -2, 0, 0, -1, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, -2, -1, -1, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 1, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0,
+    0, -2, 0, 1, 0, 1, 0, -1, -2, 0, 1, -2, -2, 0, -1, 0, 0, 1, 1, 1, 0, 0, 0, 1, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, -2, 0, 0, 0, 1, 0, 0, 0, 1, 0, -2, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 1, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, -1, -2, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, -3, -2, 0, 0, -2, -1, 0, 0, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1, -2, -2, 0, 1, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, -2, 0, 0, -1, 0, -1, 0, 0, 0, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -3, 0, -4, -2, 0, 0, -2, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, -2, -3, -2, 0, 0, 0, 0, 0, 0, -2, 0, -2, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -2, 0, -2, 0, 0, -2, 0, -1, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, 0, 1, 0, -1, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, -2, 0, -2, 0, -1, 0, -2, -1, 0, -1, 0, 0, 0, 0, -2, 0, -1, 0, -1, 0, 0, -2, 0, 0, 0, 0, -2, 0, -2, 0, -1, -2, 0, -1, 0, 0, 0, 0, 0, -1, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, -2, 0, 0, 0, -1, 0, -2, 0, 0, -1, -2, 0, 0, 0, 0, 0, -1, 2, -1, -2, 0, 0, -1, -2, 1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -2, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 1, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, -2, 0, -1, 0, 0, -2, 0, 0, 0, -2, 0, 0, -3, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -2, 0, -3, -1, 0, 0, -3, -1, 0, 0, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 1, 0, 0, -2, 0, -1, 0, 0, 0, -2, -1, 0, 0, 0, 0, 0, 0, -1, 0, -1, 1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, -2, 0, -1, -1, 0, 0, 1, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 1, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, -2, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 3, 1, 0, 1, -1, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 7, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, -1, -1, 0, 0, -1, 0, 0, 1, 0, 0, -1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, -1, 0, 0, 1, 1, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -4, -1, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, -1, 0, -2, 0, 0, 0, -2, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -3, 0, 0, -2, -1, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -4, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -2, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, -1, -1, 0, 0, -1, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, -1, -2, -1, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0,
+    0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -4, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -2, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, -3, -1, 0, 0, -3, 0, 0, 0, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -3, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -1, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const EpdLigaturePair notosans_16_italicLigatures[] = {
+    { 0x66, 0x66, 0xFB00 },
+    { 0x66, 0x69, 0xFB01 },
+    { 0x66, 0x6C, 0xFB02 },
+    { 0xFB00, 0x69, 0xFB03 },
+    { 0xFB00, 0x6C, 0xFB04 },
+};
+
+static const uint16_t notosans_16_italicGlyphLookup[368] = {
+    0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0001, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, 0x0010, 0x0011,
+    0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, 0x0020, 0x0021,
+    0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, 0x0030, 0x0031,
+    0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, 0x0040, 0x0041,
+    0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051,
+    0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, 0x0060, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070,
+    0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, 0x0080,
+    0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F, 0x0090,
+    0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F, 0x00A0,
+    0x00A1, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF, 0x00B0,
+    0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF, 0x00C0,
+    0x02B1, 0x02B2, 0x02B3, 0x02B4, 0x02B5, 0x02B6, 0x02B7, 0x02B8, 0x02B9, 0x02BA, 0x02BB, 0x02BC, 0x02BD, 0x02BE, 0x02BF, 0x02C0,
+    0x02C1, 0x02C2, 0x02C3, 0x02C4, 0x02C5, 0x02C6, 0x02C7, 0x02C8, 0x02C9, 0x02CA, 0x02CB, 0x02CC, 0x02CD, 0x02CE, 0x02CF, 0x02D0,
+    0x02D1, 0x02D2, 0x02D3, 0x02D4, 0x02D5, 0x02D6, 0x02D7, 0x02D8, 0x02D9, 0x02DA, 0x02DB, 0x02DC, 0x02DD, 0x02DE, 0x02DF, 0x02E0,
+    0x02E1, 0x02E2, 0x02E3, 0x02E4, 0x02E5, 0x02E6, 0x02E7, 0x02E8, 0x02E9, 0x02EA, 0x02EB, 0x02EC, 0x02ED, 0x02EE, 0x02EF, 0x02F0,
+    0x02F1, 0x02F2, 0x02F3, 0x02F4, 0x02F5, 0x02F6, 0x02F7, 0x02F8, 0x02F9, 0x02FA, 0x02FB, 0x02FC, 0x02FD, 0x02FE, 0x02FF, 0x0300,
+    0x0301, 0x0302, 0x0303, 0x0304, 0x0305, 0x0306, 0x0307, 0x0308, 0x0309, 0x030A, 0x030B, 0x030C, 0x030D, 0x030E, 0x030F, 0x0310,
+    0x0311, 0x0312, 0x0313, 0x0314, 0x0315, 0xFFFF, 0x0316, 0x0317, 0x0318, 0x0319, 0x031A, 0x031B, 0x031C, 0x031D, 0x031E, 0x031F,
 };
 
 static const EpdFontData notosans_16_italic = {
     notosans_16_italicBitmaps,
     notosans_16_italicGlyphs,
     notosans_16_italicIntervals,
-    15,
+    16,
     45,
     36,
     -10,
     true,
     notosans_16_italicGroups,
-    10,
+    4,
+    notosans_16_italicKernLeftClasses,
+    notosans_16_italicKernRightClasses,
+    notosans_16_italicKernMatrix,
+    73,
+    notosans_16_italicLigatures,
+    5,
+    0x4000000001ull,
+    notosans_16_italicGlyphLookup,
+    notosans_16_italicGlyphGroups,
+    false,
+    nullptr,
 };
@@ -3,2004 +3,2008 @@
  * name: notosans_16_regular
  * size: 16
  * mode: 2-bit  compressed: true
- * Command used: fontconvert.py notosans_16_regular 16 ../builtinFonts/source/NotoSans/NotoSans-Regular.ttf --2bit --compress
+ * Command used: fontconvert.py notosans_16_regular 16 ../builtinFonts/source/NotoSans/NotoSans-Regular.ttf --2bit --compress --frequency-corpus ../../../test/hyphenation_eval/resources/english_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/french_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/german_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/italian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/russian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/spanish_hyphenation_tests.txt
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t notosans_16_regularBitmaps[31865] = {
-    0xBD, 0x59, 0x3D, 0x8C, 0xDD, 0xD6, 0x95, 0x3E, 0x24, 0x2D, 0xB1, 0x20, 0x16, 0x54, 0x61, 0x61,
-    0x83, 0x08, 0x0B, 0x36, 0xAE, 0x36, 0x58, 0xB1, 0x4D, 0xE1, 0x79, 0x97, 0x4E, 0xE0, 0x6D, 0x52,
-    0x48, 0x85, 0xC6, 0x29, 0xA6, 0x50, 0xBD, 0x01, 0x16, 0xD3, 0x6C, 0xB1, 0x85, 0x66, 0x48, 0xDB,
-    0x58, 0x04, 0x58, 0x17, 0xD6, 0x62, 0xA1, 0x45, 0x80, 0x14, 0x49, 0x80, 0x04, 0xB0, 0x9F, 0x10,
-    0xA8, 0x49, 0xE1, 0xE2, 0xBD, 0x21, 0xE3, 0x01, 0x56, 0x85, 0x0B, 0xBD, 0xB5, 0x11, 0xA8, 0x50,
-    0x11, 0x3A, 0xD6, 0xAC, 0x61, 0x6F, 0x21, 0xC2, 0xE6, 0xC4, 0x7C, 0xCA, 0xE5, 0xBB, 0xFB, 0x7D,
-    0x87, 0x7C, 0x4F, 0x23, 0xC9, 0xB2, 0x24, 0x63, 0xB1, 0x6F, 0x86, 0x97, 0x7C, 0x97, 0xF7, 0xE7,
-    0xDC, 0x73, 0xCF, 0xF9, 0xCE, 0x77, 0xEE, 0x33, 0xF1, 0x61, 0x63, 0xCD, 0xBA, 0xE8, 0xCE, 0x47,
-    0x6F, 0xD4, 0xEF, 0xFD, 0x9D, 0x27, 0x22, 0x26, 0xBD, 0xB3, 0xB4, 0x2F, 0xC8, 0x2C, 0xBA, 0x53,
-    0xCD, 0x59, 0x5C, 0x99, 0x85, 0x37, 0xAB, 0x2B, 0x57, 0x82, 0x9B, 0xD5, 0xCB, 0xDF, 0x0F, 0x0A,
-    0x91, 0xDF, 0x79, 0xB5, 0xC8, 0x96, 0x74, 0x22, 0x31, 0x6E, 0x12, 0x56, 0xB1, 0x88, 0xDF, 0x84,
-    0x95, 0xC8, 0x7B, 0x7E, 0xC3, 0x37, 0xEF, 0xC9, 0xDF, 0xDE, 0xF8, 0xBC, 0x7C, 0x37, 0x76, 0xF8,
-    0xBC, 0xFE, 0xDA, 0xF1, 0xCE, 0x1F, 0x2E, 0xAE, 0xDF, 0xB0, 0x4F, 0xF6, 0x50, 0x1F, 0xB6, 0xE9,
-    0x0C, 0x8A, 0xD5, 0xF0, 0x26, 0xE0, 0x1B, 0x4F, 0x47, 0x9B, 0xB1, 0xCF, 0x04, 0xA3, 0x6D, 0xDE,
-    0x64, 0x78, 0x05, 0x01, 0xA3, 0x62, 0xB8, 0xCE, 0x5D, 0x95, 0xD0, 0xB9, 0x45, 0xE2, 0x5C, 0x93,
-    0xFF, 0xFC, 0x3F, 0x9A, 0x39, 0xEA, 0xEC, 0x78, 0xF5, 0xB8, 0xF2, 0xB7, 0x0A, 0x49, 0x5D, 0x81,
-    0x36, 0x98, 0x36, 0xC7, 0x43, 0xE4, 0x1A, 0x89, 0x7E, 0xDA, 0xA1, 0xAF, 0xC5, 0x35, 0xE3, 0x3D,
-    0x8B, 0x5E, 0xB7, 0xAB, 0x9D, 0x1B, 0x2D, 0x04, 0x58, 0xE4, 0x90, 0x41, 0xCE, 0x15, 0x0F, 0xC6,
-    0xE7, 0x35, 0x7C, 0x52, 0xAC, 0xB8, 0x95, 0xD8, 0x55, 0x92, 0x8A, 0xDF, 0x4E, 0x24, 0x58, 0xC8,
-    0xC4, 0x6B, 0x64, 0x86, 0x87, 0x18, 0xD2, 0xC9, 0x15, 0x69, 0x83, 0x86, 0xAB, 0xCA, 0xAE, 0x08,
-    0xBF, 0xC4, 0x05, 0xBF, 0xBC, 0x02, 0xF9, 0x5F, 0x96, 0x76, 0x72, 0xFA, 0x6A, 0xB0, 0x48, 0xA2,
-    0x43, 0x57, 0x9D, 0xF7, 0x9B, 0xF6, 0xA0, 0xF4, 0x96, 0xF3, 0x34, 0xCE, 0xDA, 0xC8, 0xBD, 0xF9,
-    0x5F, 0x4D, 0x5C, 0x9C, 0xBB, 0x6A, 0x53, 0x0C, 0x24, 0x89, 0x5F, 0x63, 0xD1, 0x41, 0x3D, 0x11,
-    0x0E, 0x11, 0xF0, 0x4B, 0x5C, 0x9C, 0xC7, 0x17, 0xBF, 0xF1, 0x9B, 0xA8, 0x82, 0xF2, 0x12, 0xA8,
-    0x0F, 0x0F, 0x5D, 0x92, 0x41, 0x96, 0xD0, 0xD5, 0x62, 0xD0, 0xAB, 0x53, 0xF9, 0x5E, 0x5C, 0x0B,
-    0x9A, 0x38, 0xE8, 0x48, 0x4A, 0xBC, 0x14, 0x6F, 0xB5, 0xD3, 0x42, 0x6B, 0xAD, 0x87, 0x26, 0x10,
-    0xCE, 0x3E, 0x28, 0x59, 0xE3, 0x75, 0x01, 0xDE, 0x4A, 0x9F, 0xD4, 0xDC, 0xF1, 0x92, 0x2B, 0x4D,
-    0x7A, 0x8E, 0x90, 0xB3, 0xDA, 0x77, 0x3D, 0x44, 0x89, 0xDA, 0xBC, 0x08, 0x17, 0x49, 0x95, 0xD4,
-    0x71, 0x65, 0xB2, 0xB0, 0x43, 0x89, 0x51, 0x4D, 0x66, 0xA8, 0x4E, 0x9D, 0xDD, 0xB2, 0x8C, 0xAC,
-    0xA4, 0x95, 0x18, 0x6C, 0xE0, 0xF2, 0xC7, 0x0E, 0x3D, 0xB0, 0xA1, 0x71, 0x0D, 0x19, 0x8A, 0xC0,
-    0x8A, 0x77, 0x11, 0xA3, 0xCD, 0xF8, 0xB9, 0x72, 0xE5, 0xCA, 0xF7, 0xB1, 0x9B, 0x33, 0x4C, 0xDC,
-    0x84, 0x8B, 0xB8, 0x4A, 0x8A, 0x14, 0x03, 0x19, 0xD9, 0xC7, 0xDF, 0xFC, 0xC4, 0x1F, 0xBF, 0xB3,
-    0x3E, 0x2D, 0xE2, 0x2A, 0x5E, 0x84, 0xB5, 0x4F, 0xA1, 0xF7, 0xE4, 0x85, 0x19, 0xEA, 0x92, 0x2C,
-    0xAE, 0xC2, 0x3A, 0x68, 0x7C, 0x2E, 0xCA, 0xE2, 0x6F, 0xDD, 0x61, 0xFD, 0x37, 0x97, 0x9E, 0xF5,
-    0x3E, 0xE7, 0x68, 0xA2, 0x45, 0x5C, 0x18, 0x74, 0x3D, 0x83, 0xD5, 0x42, 0x2B, 0x61, 0x3D, 0x5C,
-    0xD8, 0x3B, 0x5E, 0x2F, 0x05, 0xD5, 0xA9, 0xFC, 0xDF, 0xFF, 0x73, 0x55, 0x62, 0xEB, 0xBF, 0x5B,
-    0xAE, 0x7E, 0x23, 0x31, 0x16, 0x6E, 0xB0, 0x11, 0x73, 0x2C, 0xD2, 0xA6, 0x45, 0xD0, 0xC6, 0x0B,
-    0x55, 0xFC, 0x19, 0x98, 0x9C, 0x4F, 0x2D, 0xC1, 0x10, 0xE5, 0xFC, 0x68, 0x7E, 0x27, 0x2A, 0x3C,
-    0x0C, 0xD0, 0xE7, 0x28, 0x5E, 0xDD, 0xEE, 0xB7, 0xB3, 0xAF, 0x6B, 0x31, 0x5A, 0x12, 0x64, 0x88,
-    0x17, 0x36, 0x79, 0xBF, 0x35, 0x41, 0xBD, 0x15, 0x56, 0x67, 0x68, 0x57, 0xEE, 0x8E, 0x3B, 0xDE,
-    0xBE, 0x24, 0xF1, 0x07, 0x7F, 0x5E, 0xE5, 0xDE, 0xD0, 0x38, 0x29, 0xB8, 0xCB, 0xD8, 0x2B, 0x0F,
-    0x02, 0x59, 0x7A, 0x80, 0xA4, 0x99, 0xC4, 0x15, 0x85, 0xA7, 0x47, 0xA0, 0x6A, 0x4F, 0xA8, 0x77,
-    0x18, 0x59, 0xB4, 0xD0, 0x86, 0xD8, 0xCF, 0xB9, 0x56, 0x3D, 0xD4, 0x57, 0x3F, 0x11, 0xEC, 0x3E,
-    0x71, 0x56, 0xE2, 0xE3, 0xBC, 0x8A, 0x6B, 0x2A, 0x46, 0x8C, 0x0F, 0xF3, 0xA9, 0x31, 0x8C, 0x45,
-    0x0F, 0x83, 0x81, 0xA3, 0x9B, 0x18, 0xF9, 0x98, 0x83, 0xEC, 0x63, 0xAE, 0xCB, 0x18, 0xE3, 0xF6,
-    0xBA, 0x82, 0x93, 0x5F, 0x80, 0x25, 0x1E, 0x36, 0x18, 0x75, 0x8E, 0x99, 0x30, 0xE9, 0x1C, 0x96,
-    0x93, 0x8B, 0xF9, 0xB7, 0x32, 0xC3, 0x56, 0x67, 0x58, 0x03, 0x16, 0x76, 0x89, 0x46, 0x53, 0x7B,
-    0x4E, 0xCA, 0xC6, 0xB8, 0xF8, 0x93, 0x2F, 0x3B, 0xF3, 0x57, 0x9C, 0x49, 0x9E, 0xB5, 0x18, 0x6C,
-    0xB7, 0x80, 0xD5, 0xF4, 0xE2, 0x8E, 0xCA, 0x45, 0x92, 0xF9, 0xD6, 0xD3, 0x25, 0x71, 0x8D, 0xF0,
-    0x39, 0xD1, 0x25, 0x6A, 0x05, 0x16, 0x49, 0x75, 0x48, 0x04, 0x0D, 0x47, 0x50, 0x48, 0xF8, 0xB4,
-    0x6B, 0x35, 0x9D, 0xFE, 0x6A, 0xBD, 0x49, 0x99, 0x4E, 0xB5, 0xEB, 0x0A, 0x8F, 0x90, 0xE3, 0xAE,
-    0x95, 0x8B, 0xF3, 0xE2, 0x5B, 0x8E, 0x9C, 0x9D, 0x98, 0x8A, 0x15, 0x39, 0x1D, 0x49, 0xBC, 0xA9,
-    0x13, 0x81, 0x50, 0x62, 0x88, 0x22, 0x5E, 0x89, 0x79, 0x83, 0x6E, 0x7C, 0x4B, 0x21, 0x20, 0xFD,
-    0xD8, 0x1C, 0x3E, 0x98, 0xFF, 0xE8, 0xAE, 0x57, 0xBE, 0x8F, 0x59, 0x8A, 0xC4, 0xAD, 0x32, 0x39,
-    0x45, 0xE3, 0x87, 0x31, 0xB1, 0x29, 0x9B, 0x39, 0x0A, 0x8D, 0xE1, 0x64, 0x8B, 0x6E, 0xF8, 0x25,
-    0xAA, 0x52, 0x0C, 0xE1, 0x75, 0xDC, 0xCB, 0x0A, 0x55, 0x33, 0x62, 0x08, 0x5C, 0x03, 0x5B, 0x6E,
-    0x06, 0x67, 0x4D, 0x32, 0xDC, 0x3A, 0xBC, 0x45, 0xA5, 0x11, 0xCA, 0x7F, 0x4C, 0xC0, 0xFC, 0x70,
-    0x3A, 0xBD, 0xF1, 0xF9, 0xA8, 0x0D, 0x9D, 0x5C, 0xA5, 0xA0, 0x38, 0x74, 0x12, 0x40, 0x59, 0xEA,
-    0x5C, 0x9D, 0xF2, 0x3E, 0x36, 0x5A, 0x5F, 0x93, 0xF5, 0xF5, 0x93, 0xAB, 0x42, 0xB8, 0x03, 0xF0,
-    0x2E, 0x5E, 0x90, 0xA4, 0x19, 0x16, 0xA5, 0x92, 0x3E, 0x72, 0xF9, 0x5D, 0x06, 0x25, 0x2E, 0x5F,
-    0xC9, 0x17, 0x54, 0x5E, 0x4A, 0x25, 0x9C, 0x5D, 0x83, 0x4D, 0xBE, 0xA2, 0xF1, 0x17, 0xBE, 0xBB,
-    0x76, 0xD1, 0xEF, 0xC7, 0x2E, 0x9B, 0x4D, 0xA2, 0x3A, 0x55, 0x3F, 0xBB, 0x77, 0xC5, 0x96, 0xAE,
-    0x32, 0x07, 0x3B, 0x36, 0xEE, 0xC4, 0xBC, 0xD9, 0xA1, 0xCE, 0xAA, 0x9B, 0x49, 0x02, 0xD3, 0x0A,
-    0x3F, 0xA2, 0xB5, 0xA2, 0xDB, 0x9C, 0x6B, 0xF4, 0x3B, 0x38, 0xBE, 0x59, 0xE4, 0x55, 0xE0, 0x08,
-    0xB6, 0xB0, 0x08, 0x62, 0x1B, 0x17, 0xBE, 0x8B, 0xEB, 0x36, 0xAE, 0xF5, 0xF6, 0xEC, 0x3F, 0x62,
-    0x0D, 0xEA, 0xDA, 0xED, 0x23, 0x52, 0xA4, 0xD9, 0x03, 0x53, 0xA1, 0x8E, 0xE8, 0x29, 0x9B, 0xCD,
-    0xE5, 0x8E, 0x27, 0x15, 0x9D, 0x72, 0x54, 0x20, 0x3F, 0xE7, 0xDC, 0x55, 0x4C, 0xBB, 0x92, 0xF4,
-    0x68, 0x17, 0xA8, 0x27, 0x7D, 0xB8, 0x90, 0xE4, 0x0D, 0xFA, 0x0B, 0x8D, 0x3F, 0xA1, 0xF1, 0x77,
-    0x04, 0xA8, 0x45, 0x29, 0x01, 0xC3, 0x85, 0xE1, 0x85, 0xB0, 0x92, 0xBF, 0xEE, 0xB2, 0x5C, 0xC2,
-    0x96, 0xD0, 0x48, 0xBF, 0xDC, 0x78, 0x94, 0xBA, 0x18, 0xC6, 0xF8, 0xFD, 0x4A, 0x76, 0x19, 0xA9,
-    0x16, 0x04, 0xC6, 0xC1, 0x5F, 0x86, 0xE9, 0xE8, 0x40, 0x00, 0xD0, 0xA3, 0xB2, 0x4A, 0x2A, 0xBF,
-    0x43, 0x53, 0x03, 0x59, 0x82, 0x1A, 0x7D, 0x2D, 0xBD, 0x91, 0x1E, 0x7D, 0x58, 0x63, 0x65, 0xC0,
-    0xD2, 0x3E, 0x85, 0xD5, 0xFE, 0xB0, 0x3F, 0x0D, 0x65, 0xBA, 0x2F, 0x1A, 0xDF, 0xD5, 0x76, 0x5C,
-    0x66, 0x5C, 0x0C, 0xB6, 0xCB, 0x55, 0xD0, 0x7E, 0x61, 0xD0, 0xD9, 0x39, 0x0C, 0x8A, 0xDD, 0x8A,
-    0xDC, 0xDD, 0x61, 0xC7, 0x5E, 0x00, 0xC6, 0xF4, 0x46, 0x4E, 0x7E, 0x6C, 0xB9, 0xFB, 0x69, 0x73,
-    0xC6, 0x03, 0xDA, 0x7D, 0xD8, 0xAB, 0xF1, 0x9C, 0xF8, 0x78, 0x00, 0xAA, 0x0E, 0xA2, 0xEC, 0x45,
-    0x55, 0x77, 0x6A, 0x53, 0x89, 0x39, 0xC2, 0x56, 0x71, 0x5F, 0xF2, 0x1A, 0x9B, 0x8F, 0x30, 0xB7,
-    0x1A, 0x82, 0x90, 0xC1, 0xAB, 0x84, 0xEE, 0xC3, 0xD5, 0x85, 0x74, 0xB3, 0x64, 0xC5, 0x0D, 0x58,
-    0xD2, 0x8B, 0xA8, 0x79, 0x1A, 0x48, 0x98, 0xAD, 0x47, 0x22, 0x37, 0x38, 0xC4, 0xD5, 0xC8, 0xA3,
-    0x9F, 0xE9, 0x74, 0xFA, 0x0E, 0xF9, 0x00, 0x5B, 0xA8, 0x4C, 0x7F, 0x23, 0xC3, 0xA4, 0x52, 0xEA,
-    0xF0, 0xB4, 0x2B, 0x8E, 0x95, 0xAE, 0xAB, 0x3C, 0x7A, 0x14, 0xA7, 0x2E, 0x6B, 0x39, 0x8D, 0xD7,
-    0x0C, 0x63, 0xE5, 0x5D, 0x6C, 0x4F, 0x31, 0x4C, 0xFA, 0x4F, 0x27, 0x47, 0xDF, 0xC5, 0x36, 0x39,
-    0x17, 0xDC, 0xDF, 0xE9, 0x5E, 0x52, 0xC3, 0x00, 0x92, 0x06, 0xB5, 0x1A, 0x13, 0xF5, 0x67, 0xD5,
-    0x28, 0x30, 0x56, 0x38, 0x40, 0xAF, 0x19, 0xA2, 0xC5, 0x15, 0x12, 0x96, 0x13, 0x41, 0x16, 0x4E,
-    0x0A, 0x67, 0x1E, 0x9C, 0x7A, 0x35, 0x04, 0x17, 0xF1, 0x6E, 0xFC, 0x5A, 0x5D, 0xC2, 0x71, 0xFD,
-    0x81, 0xBB, 0xB6, 0x0B, 0x9D, 0x20, 0xB6, 0x7A, 0xAB, 0xC1, 0xD6, 0xB0, 0x73, 0x9D, 0x62, 0x19,
-    0xB6, 0xE8, 0x14, 0xF6, 0x29, 0xAC, 0x18, 0x62, 0xC1, 0x13, 0x62, 0x58, 0x51, 0x97, 0x60, 0x5A,
-    0x84, 0x46, 0xF2, 0x00, 0x84, 0xFF, 0x09, 0x3C, 0x1E, 0xB7, 0x2D, 0x60, 0xB8, 0xDE, 0x1A, 0xC4,
-    0xFE, 0xF1, 0x36, 0x63, 0xE5, 0x9E, 0x74, 0x64, 0x52, 0xBD, 0x34, 0x13, 0x99, 0xFB, 0x2E, 0xA8,
-    0x53, 0x31, 0xF7, 0x6E, 0xDD, 0xAB, 0x12, 0x89, 0x57, 0x81, 0xA3, 0x31, 0x5C, 0xC4, 0x1F, 0x65,
-    0x94, 0xD1, 0x25, 0x64, 0x23, 0x67, 0xBA, 0x7C, 0xF5, 0x86, 0x6E, 0xD0, 0x80, 0x84, 0xDF, 0x73,
-    0x2A, 0xB5, 0x9A, 0x85, 0xC2, 0x9A, 0x10, 0xE0, 0x24, 0xA6, 0xDE, 0xBC, 0xAF, 0x94, 0x1A, 0x10,
-    0x42, 0x82, 0x8F, 0x15, 0x7F, 0xA9, 0xB0, 0xB8, 0x9A, 0xD3, 0x8D, 0xE8, 0x6D, 0xA9, 0xEA, 0xA7,
-    0xA1, 0xC1, 0xCD, 0xA9, 0x4C, 0xFC, 0x5B, 0x8D, 0x86, 0x35, 0x2C, 0xCF, 0x39, 0x09, 0xEE, 0x4F,
-    0xAF, 0xB7, 0x54, 0x6D, 0x52, 0xB0, 0xA7, 0x25, 0xBC, 0x44, 0x35, 0x5D, 0x92, 0x26, 0x0E, 0xC9,
-    0xE8, 0xC2, 0xC9, 0xDB, 0x95, 0x5A, 0xA2, 0xFB, 0x8C, 0x60, 0xD4, 0xA9, 0x5D, 0x80, 0xA5, 0x75,
-    0x68, 0x5B, 0x12, 0x17, 0x6F, 0x55, 0x03, 0x52, 0x5A, 0x54, 0x1C, 0xA8, 0x77, 0xDD, 0xBF, 0x8E,
-    0x55, 0x32, 0x4C, 0x00, 0x0B, 0x58, 0x81, 0x01, 0x82, 0xAF, 0xD0, 0xE2, 0xC0, 0x32, 0x84, 0x70,
-    0x6D, 0x15, 0xCC, 0x84, 0x5B, 0x83, 0x0A, 0x67, 0xA6, 0xD7, 0xDD, 0x05, 0x34, 0xFD, 0xA1, 0x73,
-    0xCB, 0x4D, 0x48, 0x5C, 0xA2, 0x01, 0x04, 0xCC, 0xEF, 0x5F, 0x6F, 0x83, 0x5E, 0xBC, 0xC2, 0x54,
-    0x32, 0x04, 0x01, 0x42, 0x81, 0xEE, 0x97, 0xDF, 0xAD, 0xBF, 0x11, 0x25, 0x4E, 0x60, 0xEC, 0xA6,
-    0xEA, 0x60, 0x0D, 0xED, 0xAA, 0x61, 0xC5, 0x77, 0xE5, 0x52, 0xA9, 0x16, 0xCB, 0xED, 0x19, 0x95,
-    0x80, 0x95, 0xA8, 0x41, 0x6C, 0x93, 0x93, 0x7D, 0x26, 0xA2, 0xCA, 0x61, 0x28, 0xC2, 0x88, 0x30,
-    0x65, 0x74, 0x4F, 0x17, 0xD4, 0x0A, 0x01, 0x91, 0x2E, 0x8E, 0x79, 0x2D, 0x87, 0x55, 0xF0, 0xDD,
-    0x14, 0xFD, 0xA6, 0xD8, 0xD4, 0x69, 0x13, 0x6D, 0xAC, 0xDD, 0x62, 0x0E, 0x90, 0x56, 0x54, 0x7F,
-    0xB6, 0x9A, 0x96, 0xFD, 0x7A, 0xA2, 0x25, 0xE7, 0x75, 0x7F, 0x44, 0xA8, 0x43, 0xC5, 0x1F, 0x2B,
-    0x5D, 0x48, 0xFC, 0xD8, 0xCD, 0x4D, 0xA7, 0x6F, 0x3B, 0x67, 0xD1, 0xE4, 0xD6, 0x93, 0x9A, 0xF0,
-    0xF6, 0xF9, 0xF4, 0x5D, 0x34, 0xB9, 0x87, 0xC1, 0x9E, 0x61, 0x4C, 0xDE, 0xEE, 0x4F, 0xDF, 0xE1,
-    0x98, 0x18, 0xFA, 0x89, 0x4D, 0x1E, 0xDC, 0x46, 0x84, 0x29, 0x81, 0xBF, 0x89, 0x6E, 0xEF, 0xFD,
-    0xEB, 0x36, 0x80, 0xD5, 0xBE, 0x44, 0x5E, 0xA6, 0x38, 0x2D, 0xA6, 0x18, 0x77, 0x47, 0x95, 0x2F,
-    0xFD, 0xA6, 0xC0, 0x10, 0xD3, 0x77, 0xD5, 0xF6, 0xB4, 0x60, 0x5D, 0xCE, 0x26, 0x46, 0x61, 0x9E,
-    0xDB, 0x65, 0xC0, 0x50, 0x01, 0xC4, 0xD8, 0x1B, 0x13, 0xD2, 0xB1, 0x7D, 0x77, 0xF4, 0x9A, 0xD3,
-    0xB8, 0x42, 0x5F, 0x00, 0x44, 0x22, 0x56, 0xCF, 0x68, 0xF3, 0xD8, 0xC7, 0x88, 0x8B, 0x4A, 0xD9,
-    0x75, 0x4E, 0x25, 0x3F, 0xB1, 0xEA, 0xFE, 0x74, 0x5A, 0x72, 0x84, 0x9E, 0x21, 0xF9, 0x79, 0x3A,
-    0x6E, 0xAA, 0x4A, 0x77, 0x03, 0xA9, 0xCB, 0xD5, 0xB8, 0xD2, 0x60, 0x6F, 0xE4, 0x69, 0x0F, 0x7D,
-    0x44, 0xA5, 0x33, 0xAE, 0xDA, 0xC1, 0xDB, 0xBE, 0x65, 0x91, 0xFE, 0xCB, 0x4E, 0x53, 0xAE, 0x22,
-    0x97, 0x01, 0xD9, 0x67, 0x83, 0x0F, 0x86, 0xB0, 0x20, 0xCF, 0x32, 0x04, 0xC3, 0x2A, 0x63, 0x90,
-    0x10, 0x98, 0xB5, 0x05, 0x6A, 0xC4, 0x55, 0xCA, 0x8C, 0xAA, 0x96, 0xF8, 0x7D, 0x32, 0x46, 0x88,
-    0x1D, 0xDF, 0xEB, 0x68, 0xC8, 0x0B, 0x89, 0xBB, 0x12, 0x4E, 0x16, 0x28, 0x3D, 0x59, 0xA0, 0x71,
-    0x8E, 0x07, 0x9F, 0xAC, 0x3C, 0x66, 0xE4, 0xCC, 0x31, 0x8E, 0xCF, 0x01, 0xD5, 0x36, 0x0D, 0xA6,
-    0xF0, 0xFA, 0xD9, 0xD3, 0xCD, 0xE0, 0x19, 0x6F, 0xF7, 0x1F, 0xD8, 0x62, 0xC1, 0x10, 0xC0, 0x50,
-    0x11, 0xD0, 0xE6, 0xB9, 0x9D, 0x54, 0xB2, 0x5B, 0xC1, 0x6C, 0xE2, 0xD2, 0x12, 0x86, 0x0D, 0xED,
-    0xCF, 0x18, 0x0B, 0xB0, 0xDF, 0x32, 0x24, 0xBD, 0x33, 0x83, 0x9C, 0x4B, 0x3A, 0x63, 0x93, 0xC2,
-    0x6B, 0x0D, 0x84, 0xF4, 0x1B, 0x63, 0x81, 0xCD, 0xB5, 0xB1, 0xC8, 0x7A, 0x2A, 0x94, 0x0D, 0x72,
-    0x1D, 0xEB, 0xB5, 0x49, 0x66, 0xB0, 0x20, 0x00, 0x9D, 0x95, 0xD9, 0x84, 0xE5, 0xFE, 0x1E, 0xCB,
-    0xE1, 0x3F, 0xED, 0x58, 0xC2, 0xF3, 0x37, 0x25, 0x30, 0xD7, 0xD0, 0xEE, 0x66, 0xF4, 0xF9, 0x19,
-    0x65, 0x9A, 0x51, 0x98, 0x19, 0x49, 0xCB, 0x8C, 0x0E, 0x3C, 0xB3, 0x25, 0x0B, 0x58, 0xE4, 0xCC,
-    0xC2, 0xA4, 0x67, 0x54, 0xEC, 0xCC, 0x42, 0xD5, 0x33, 0xA2, 0xE3, 0x8C, 0x0A, 0x47, 0x61, 0xB2,
-    0x19, 0x53, 0xAA, 0x19, 0x35, 0x89, 0x22, 0x68, 0x66, 0x54, 0x25, 0x0A, 0xE9, 0x59, 0xE4, 0x2C,
-    0x52, 0xF5, 0x29, 0x16, 0xA1, 0x42, 0x81, 0xDD, 0x04, 0xB8, 0xAB, 0x1A, 0x85, 0x16, 0x92, 0xAE,
-    0x76, 0x5C, 0x11, 0x76, 0x02, 0x6A, 0xB6, 0x22, 0x11, 0xA6, 0x07, 0xA4, 0x6F, 0x2A, 0x5D, 0x55,
-    0xF2, 0x7A, 0x87, 0x40, 0x75, 0xA0, 0x61, 0xD9, 0x29, 0xAA, 0x29, 0x98, 0x69, 0xCC, 0x35, 0xBD,
-    0x3E, 0x2E, 0xD6, 0x7E, 0x14, 0x7D, 0xCA, 0x6E, 0xCA, 0x1E, 0xE2, 0xC3, 0x8E, 0xC0, 0xC3, 0x78,
-    0x9B, 0x0B, 0x74, 0x9F, 0xD4, 0xBE, 0x06, 0xBB, 0x88, 0x74, 0x9A, 0x6A, 0xA7, 0x10, 0x17, 0x09,
-    0x3B, 0xBF, 0x26, 0x08, 0x15, 0x8C, 0xF1, 0x56, 0xF1, 0xDC, 0xA7, 0x9C, 0x54, 0xC2, 0x7C, 0xBC,
-    0xF8, 0x6C, 0x87, 0xFA, 0xA4, 0x61, 0x02, 0xAE, 0x8C, 0x7C, 0x7A, 0x55, 0xBE, 0x86, 0x86, 0x3E,
-    0x76, 0xFD, 0xBF, 0x2E, 0xD7, 0x7E, 0xF3, 0x72, 0x2F, 0x2B, 0x8B, 0x51, 0x74, 0xF2, 0xB4, 0x22,
-    0xEC, 0xD6, 0x87, 0x06, 0x00, 0xA6, 0x8C, 0xAA, 0x40, 0x5C, 0xEB, 0xA8, 0x0F, 0xD8, 0x15, 0x86,
-    0x19, 0x5D, 0x2D, 0x26, 0xF6, 0x33, 0xAA, 0x46, 0x7C, 0xE8, 0x35, 0x84, 0x62, 0xBB, 0xBB, 0xF8,
-    0xE8, 0xB5, 0x15, 0x1B, 0x67, 0x31, 0xED, 0xBA, 0xC7, 0x1F, 0xD2, 0x5E, 0xC2, 0x00, 0x73, 0x62,
-    0xCD, 0x70, 0xC3, 0x66, 0xF4, 0x54, 0x1D, 0x27, 0x22, 0x11, 0x34, 0xE0, 0xD2, 0xA3, 0x15, 0x40,
-    0x29, 0xF0, 0x05, 0x1B, 0xAF, 0xAE, 0x77, 0x30, 0xB2, 0x17, 0x15, 0xFF, 0xD6, 0x49, 0x00, 0x39,
-    0x00, 0xC3, 0x78, 0x4B, 0x3D, 0x40, 0x62, 0x86, 0x08, 0x26, 0x5E, 0x4A, 0xD2, 0x42, 0x3B, 0x22,
-    0xEA, 0xC1, 0x48, 0xB0, 0x79, 0xCD, 0xCF, 0x60, 0x96, 0xFC, 0xDA, 0xE5, 0x36, 0xD7, 0xC4, 0x02,
-    0x0B, 0x3C, 0x9B, 0x31, 0xAA, 0xB8, 0x2F, 0x88, 0x7B, 0x1F, 0xB0, 0x78, 0x42, 0x26, 0xF2, 0x7F,
-    0x5A, 0xF5, 0x6C, 0x88, 0xFA, 0x7C, 0x55, 0xF1, 0x07, 0x0C, 0x08, 0xD0, 0x91, 0xDF, 0x81, 0x02,
-    0xA4, 0x95, 0x39, 0xDA, 0xE9, 0x35, 0x27, 0x82, 0x4A, 0xB8, 0x85, 0x97, 0x14, 0x1E, 0x65, 0x9F,
-    0xEA, 0x20, 0xF9, 0x10, 0x7A, 0x2E, 0x98, 0x71, 0x01, 0x96, 0x1D, 0x33, 0xCF, 0x06, 0xEE, 0x85,
-    0x0D, 0xB8, 0x90, 0xF2, 0x3A, 0xC0, 0x48, 0x0B, 0xAE, 0xE3, 0xD1, 0x81, 0x15, 0xB3, 0xF5, 0x70,
-    0x02, 0x76, 0xC3, 0xEC, 0x91, 0xF2, 0xA7, 0x6F, 0xF0, 0xFC, 0xEB, 0xB0, 0x19, 0x8B, 0xF0, 0x36,
-    0x29, 0xFB, 0xFF, 0x54, 0xA3, 0x19, 0x7A, 0xCA, 0xC8, 0xDC, 0x18, 0xDE, 0xF6, 0x75, 0xE5, 0xFE,
-    0x31, 0x79, 0x50, 0x36, 0xE4, 0xDF, 0x4C, 0x35, 0xC0, 0x52, 0x63, 0x3B, 0x64, 0x22, 0xFB, 0x20,
-    0x17, 0x0B, 0x83, 0x85, 0xD4, 0x3A, 0x3A, 0x99, 0x92, 0x85, 0x00, 0xFB, 0x29, 0x92, 0x15, 0x1E,
-    0x9B, 0xEC, 0x21, 0xFB, 0x61, 0xE2, 0xD8, 0xA9, 0x2C, 0x93, 0xA0, 0x81, 0x88, 0x73, 0xAF, 0x8D,
-    0x16, 0x10, 0xB1, 0xC3, 0x8B, 0x62, 0x8E, 0x05, 0x18, 0xE5, 0x62, 0xF1, 0xEF, 0x81, 0x40, 0x98,
-    0x2E, 0xFD, 0x51, 0xE5, 0x75, 0x40, 0xC9, 0x7D, 0xA4, 0x9F, 0x5F, 0x90, 0x74, 0xC1, 0xD0, 0x49,
-    0xC0, 0xBE, 0x82, 0x42, 0x20, 0x50, 0x78, 0x0F, 0x99, 0x23, 0x61, 0xD5, 0x0E, 0xB9, 0x2C, 0x38,
-    0xBF, 0xEF, 0x34, 0x4B, 0xDE, 0xA4, 0x8F, 0xCC, 0x5F, 0xF0, 0xD4, 0xA6, 0xA3, 0x76, 0x62, 0x2A,
-    0x26, 0x29, 0x40, 0xA7, 0x0C, 0x2D, 0x0B, 0xDC, 0x31, 0x27, 0x11, 0x56, 0xC7, 0x8C, 0x3F, 0x58,
-    0x0C, 0x6C, 0x6D, 0x18, 0x85, 0x6E, 0x3B, 0x3C, 0x91, 0xBA, 0x63, 0x3D, 0xCC, 0x28, 0xD8, 0x8E,
-    0x49, 0xA1, 0x9E, 0xEC, 0xA0, 0x67, 0x4E, 0xA3, 0x48, 0x0B, 0xAA, 0x01, 0xF9, 0x12, 0x88, 0x13,
-    0x29, 0x68, 0x7B, 0xC0, 0xC9, 0xC9, 0x4B, 0x97, 0x14, 0xE1, 0x10, 0x22, 0x1E, 0x30, 0x89, 0x6A,
-    0x80, 0xAE, 0xEA, 0x32, 0x76, 0xE8, 0xC2, 0x63, 0x25, 0xBC, 0x21, 0xB7, 0x4F, 0x98, 0x77, 0x63,
-    0x5F, 0x82, 0xBF, 0x68, 0xC8, 0xA0, 0x9D, 0x75, 0x1B, 0x9A, 0xF1, 0xAC, 0x26, 0xC9, 0xE0, 0x7F,
-    0xF9, 0x41, 0x5A, 0xEA, 0xAF, 0x53, 0xE8, 0x7E, 0xD0, 0xC9, 0x26, 0xC9, 0xA4, 0xC3, 0xAD, 0x13,
-    0xCD, 0xF5, 0x81, 0x45, 0x30, 0xA4, 0x69, 0x4F, 0xE8, 0xF0, 0xF9, 0x14, 0xB4, 0x75, 0x60, 0x58,
-    0x2E, 0x77, 0x89, 0xBB, 0x79, 0xFF, 0x57, 0x4C, 0x3B, 0x93, 0x22, 0xAC, 0xBD, 0xE7, 0x7A, 0x70,
-    0x36, 0x77, 0xA7, 0xB6, 0xB3, 0x3D, 0xCD, 0x11, 0x29, 0xFC, 0xDE, 0x60, 0x57, 0xCD, 0xC6, 0xC2,
-    0x5A, 0x3D, 0x11, 0xE0, 0x39, 0x44, 0xAB, 0x8B, 0x8A, 0x2A, 0xCD, 0x92, 0xCD, 0x90, 0x11, 0x0D,
-    0x4F, 0xE1, 0x90, 0x1B, 0xA5, 0x43, 0x96, 0x6D, 0x0D, 0x92, 0xB3, 0x0F, 0x41, 0xED, 0xE7, 0xB0,
-    0xB0, 0x68, 0xE1, 0x3F, 0xDF, 0x83, 0xEB, 0x8D, 0x7B, 0x75, 0x3B, 0x93, 0xA0, 0x1A, 0x17, 0x4F,
-    0xB3, 0xDF, 0xE7, 0x49, 0xEF, 0x16, 0xC4, 0xC0, 0xEC, 0x51, 0xD1, 0x22, 0xEB, 0x4A, 0x21, 0x23,
-    0x72, 0x2F, 0xD8, 0x25, 0xFE, 0x78, 0xFE, 0xEB, 0x37, 0x98, 0x7E, 0x4B, 0x73, 0xEB, 0x8A, 0x87,
-    0xB1, 0x54, 0x15, 0xB4, 0x63, 0x14, 0x7E, 0x44, 0x7E, 0x02, 0xC5, 0x25, 0x15, 0x56, 0xDC, 0xCA,
-    0x3F, 0x2B, 0x91, 0x04, 0x0B, 0xE4, 0x09, 0xC7, 0xF2, 0xEF, 0x7B, 0x4F, 0x77, 0x86, 0x8B, 0xE7,
-    0xC6, 0x19, 0x39, 0x7D, 0xDD, 0x02, 0xBE, 0x1B, 0xF7, 0x9B, 0xCB, 0xB7, 0x6A, 0xA5, 0x88, 0x7D,
-    0x07, 0x13, 0xAF, 0x25, 0x01, 0x40, 0x38, 0x53, 0xA4, 0x50, 0xD9, 0x71, 0x93, 0xAF, 0xC2, 0xEA,
-    0x54, 0xA6, 0x99, 0xF3, 0x43, 0xC7, 0x3C, 0xE6, 0xD1, 0x8A, 0x09, 0x68, 0x54, 0xFC, 0x0B, 0x67,
-    0x91, 0xF3, 0x95, 0x95, 0xCB, 0x82, 0x0E, 0x71, 0x20, 0x27, 0x94, 0x7F, 0xD4, 0x40, 0xB9, 0x56,
-    0x9D, 0x69, 0x60, 0x58, 0x9F, 0xF0, 0xA4, 0x6E, 0x3C, 0xF9, 0x30, 0x17, 0xC0, 0xA8, 0x0E, 0x19,
-    0xE0, 0x5D, 0x9D, 0x34, 0x5B, 0x25, 0x02, 0x03, 0x4F, 0x74, 0x65, 0x4C, 0xB5, 0x3D, 0xB7, 0x04,
-    0xA7, 0xA9, 0xCD, 0xD1, 0x6F, 0x41, 0x59, 0xA9, 0x25, 0x64, 0x4D, 0x9C, 0xD1, 0xC8, 0xA3, 0xB7,
-    0x76, 0x30, 0x2D, 0x86, 0xBC, 0xFE, 0x54, 0x9D, 0xF0, 0xE4, 0x02, 0xF0, 0xA5, 0xC3, 0xB0, 0xE0,
-    0x7E, 0x69, 0xE6, 0xB9, 0x3F, 0x1E, 0x95, 0x9C, 0xA8, 0x48, 0xFB, 0xB8, 0x28, 0xDD, 0x97, 0x75,
-    0x7E, 0x2D, 0x87, 0xD0, 0xFE, 0x0A, 0xE3, 0x98, 0xB7, 0x17, 0x12, 0xAD, 0xE5, 0x5C, 0x0B, 0x1E,
-    0x3C, 0xA8, 0xC8, 0x24, 0x7D, 0x0B, 0x82, 0xD7, 0x3D, 0x22, 0x7A, 0x5A, 0x9F, 0x5B, 0x21, 0x8D,
-    0xBA, 0x55, 0x24, 0xEE, 0xCD, 0x7A, 0x93, 0x1C, 0x47, 0x08, 0xC8, 0xCC, 0x69, 0xE3, 0xBB, 0xBB,
-    0x35, 0x59, 0x21, 0xE6, 0x4B, 0xDF, 0x68, 0x87, 0x23, 0x1F, 0x6B, 0xC0, 0x98, 0x35, 0xC3, 0x03,
-    0x75, 0xFE, 0xE5, 0x46, 0x9B, 0x8B, 0xD1, 0x10, 0x18, 0x40, 0xC3, 0xFE, 0x95, 0x7F, 0xA4, 0x5F,
-    0x65, 0x3E, 0x13, 0x54, 0x9E, 0x1E, 0x7B, 0xDB, 0x3C, 0xEB, 0x0E, 0x5C, 0x4B, 0x88, 0xB1, 0x32,
-    0xE4, 0x93, 0x5C, 0xC6, 0x39, 0x67, 0x91, 0x61, 0x79, 0xBB, 0xD7, 0x32, 0x7C, 0xE1, 0x92, 0x36,
-    0x6F, 0x9E, 0xFA, 0x65, 0x94, 0xF4, 0x07, 0xD0, 0x97, 0xED, 0x92, 0xE3, 0xDD, 0x15, 0xB4, 0xEC,
-    0x7E, 0x0A, 0x1C, 0xFC, 0x53, 0x3B, 0x24, 0x55, 0x27, 0x97, 0x2E, 0xAC, 0x98, 0x68, 0x05, 0xD0,
-    0xFE, 0x4F, 0xB0, 0x95, 0xCE, 0x64, 0xDE, 0x2A, 0xEA, 0x4E, 0x3B, 0xA8, 0xEF, 0xAB, 0x1A, 0xD2,
-    0x75, 0xD0, 0xF5, 0x64, 0x54, 0xF0, 0x70, 0x0E, 0xF3, 0xA2, 0x04, 0x36, 0xFE, 0x6C, 0xC7, 0xFA,
-    0x4C, 0x49, 0xCE, 0x21, 0xC1, 0x38, 0xFB, 0xC8, 0x49, 0xDC, 0x63, 0x57, 0xE4, 0x8A, 0x49, 0x8E,
-    0x8C, 0x76, 0xF9, 0x63, 0x0B, 0x5C, 0xED, 0xA1, 0x0C, 0x0A, 0x61, 0x9E, 0xF7, 0xFA, 0x4E, 0x72,
-    0xB3, 0x51, 0xF6, 0xD1, 0x99, 0x87, 0x7E, 0xDF, 0x19, 0x0B, 0x91, 0xEF, 0xC0, 0x5E, 0x42, 0x1E,
-    0x2A, 0x8E, 0x9F, 0xEE, 0x19, 0xF2, 0x8E, 0x13, 0x0F, 0x13, 0x49, 0xFF, 0x75, 0xF7, 0xD0, 0xD5,
-    0xE5, 0x42, 0xB7, 0x7C, 0xF2, 0x8D, 0x97, 0xDF, 0x4D, 0x40, 0x4E, 0xD0, 0xA5, 0x98, 0x00, 0xDF,
-    0x26, 0xC0, 0xBB, 0x09, 0xF0, 0x6F, 0x02, 0x43, 0x9B, 0xC0, 0xED, 0x26, 0xD8, 0x61, 0x03, 0xF8,
-    0x37, 0x6F, 0x81, 0x3C, 0x07, 0x3C, 0xF3, 0xE8, 0x71, 0xE5, 0x9C, 0xA2, 0x9A, 0xC0, 0xC8, 0x26,
-    0xB0, 0xEE, 0x09, 0x4C, 0xE3, 0xAC, 0x79, 0xD2, 0x67, 0x5C, 0x42, 0x93, 0xF6, 0x52, 0x76, 0xC1,
-    0x6D, 0xB7, 0x4A, 0xC8, 0x7A, 0x5E, 0x5B, 0x2D, 0x77, 0x10, 0xCF, 0x91, 0x5F, 0x07, 0xCD, 0x0A,
-    0xFB, 0x20, 0x11, 0x5C, 0x11, 0x56, 0xC6, 0x83, 0x6C, 0x74, 0xD9, 0x53, 0x32, 0xE1, 0xB5, 0x24,
-    0xD6, 0x7A, 0xFA, 0x08, 0x67, 0x4D, 0xBE, 0xDD, 0x2B, 0x3D, 0xCE, 0x7A, 0x19, 0x3B, 0xB7, 0xF5,
-    0x60, 0xE7, 0x56, 0xDF, 0x76, 0xE7, 0x74, 0x29, 0x3E, 0x78, 0x87, 0xC7, 0x68, 0x62, 0xFE, 0x90,
-    0x2F, 0x60, 0x95, 0x39, 0x3C, 0xC3, 0xEF, 0xD2, 0x81, 0x01, 0xE8, 0x81, 0x3D, 0x71, 0x45, 0x21,
-    0x84, 0xAB, 0x52, 0x92, 0x1A, 0xBF, 0x3F, 0x46, 0xB4, 0xB4, 0x58, 0x21, 0xB6, 0x04, 0xCB, 0xD3,
-    0x3D, 0x53, 0xE8, 0x6C, 0x38, 0x3E, 0x1D, 0x11, 0x25, 0xFE, 0x01, 0x9C, 0x08, 0x81, 0x4A, 0xDC,
-    0xD1, 0x6E, 0x43, 0x31, 0x31, 0x78, 0x42, 0x56, 0xD1, 0xAE, 0xCF, 0x62, 0x4F, 0x42, 0x14, 0x17,
-    0xA0, 0xE7, 0xFE, 0x1F, 0x75, 0x18, 0xD1, 0xD1, 0xE4, 0xBB, 0xD0, 0xC6, 0x37, 0x00, 0x73, 0x1F,
-    0x43, 0x42, 0xEB, 0x65, 0x8F, 0x03, 0xE1, 0x43, 0x15, 0x0F, 0x7B, 0xD8, 0xD1, 0x65, 0x4E, 0x57,
-    0xD2, 0xC3, 0x3E, 0x79, 0xC4, 0xC3, 0xC2, 0xB5, 0x87, 0xED, 0x8F, 0x1E, 0x16, 0x8D, 0x1E, 0xE6,
-    0x9F, 0xF4, 0xB0, 0x8F, 0xE9, 0x61, 0x5F, 0x03, 0x61, 0x8F, 0x54, 0xBC, 0x1C, 0x59, 0x24, 0x78,
-    0x5B, 0x07, 0x3F, 0x33, 0xB0, 0x28, 0x12, 0x64, 0x19, 0x14, 0xFB, 0xCD, 0xFF, 0xC3, 0x6F, 0x0F,
-    0x35, 0x80, 0xE9, 0xB0, 0x3F, 0xC5, 0x23, 0x25, 0x8E, 0x47, 0x6C, 0xED, 0x87, 0x93, 0xB0, 0x74,
-    0x35, 0x5C, 0x3C, 0xE6, 0x24, 0xD6, 0xCE, 0x87, 0x80, 0x38, 0xDF, 0x93, 0xDD, 0x9B, 0x88, 0x23,
-    0x3C, 0x65, 0x25, 0x50, 0x35, 0xFC, 0xF7, 0x48, 0x3B, 0xF8, 0x83, 0x4B, 0xEE, 0xEC, 0x5F, 0x1F,
-    0x5F, 0x52, 0x16, 0xF2, 0x8D, 0xFF, 0x2D, 0x13, 0x16, 0xFE, 0xC0, 0x00, 0x1B, 0xF6, 0x32, 0xAC,
-    0x68, 0x82, 0xCB, 0x3C, 0xE3, 0x95, 0xEF, 0x0F, 0xA7, 0x64, 0x0E, 0xEA, 0x72, 0xC0, 0x63, 0x1E,
-    0x9A, 0x1A, 0x98, 0x50, 0xCA, 0x5D, 0x87, 0x98, 0xC9, 0x2F, 0x0A, 0x35, 0x93, 0xE1, 0xA7, 0x1B,
-    0xA8, 0xAA, 0xD7, 0x1F, 0x5B, 0xE6, 0x7A, 0x22, 0x47, 0x87, 0xC6, 0xD7, 0x7D, 0xC4, 0x66, 0xA6,
-    0x1D, 0x7E, 0x83, 0xC1, 0x40, 0x1E, 0x95, 0x48, 0xFA, 0x60, 0x7C, 0x62, 0x9A, 0x81, 0x15, 0xF1,
-    0x14, 0x75, 0x8F, 0x64, 0x25, 0xFC, 0x54, 0xD5, 0x0A, 0x6B, 0x81, 0x6A, 0x68, 0x75, 0xC8, 0x19,
-    0x40, 0x86, 0xE3, 0x1B, 0x18, 0xCF, 0xCA, 0x71, 0x4B, 0x52, 0x9C, 0xF0, 0x37, 0xB7, 0x39, 0xE0,
-    0x3E, 0x00, 0x2F, 0x9E, 0x84, 0x0B, 0xE4, 0xCB, 0xE1, 0x62, 0x12, 0x61, 0xAE, 0x19, 0x63, 0x40,
-    0x7A, 0xA1, 0x48, 0x11, 0xC3, 0x97, 0x2D, 0x9A, 0x4B, 0x7C, 0x4F, 0xD0, 0x57, 0x0E, 0x6A, 0x0E,
-    0x14, 0xF6, 0x7A, 0x96, 0xCC, 0x6D, 0x5B, 0x90, 0x4E, 0x62, 0x3E, 0x98, 0x7D, 0x8A, 0x1C, 0x27,
-    0xAA, 0xC7, 0xE4, 0x87, 0xB4, 0x1A, 0x94, 0x2E, 0xD4, 0xC3, 0x2E, 0xF2, 0x25, 0x46, 0xCC, 0x40,
-    0x8F, 0xF3, 0xC9, 0xAE, 0xD0, 0x3B, 0xF8, 0x33, 0xB9, 0x9F, 0x26, 0x52, 0x60, 0x8A, 0x2D, 0xE2,
-    0xFE, 0x01, 0x3C, 0x1F, 0x9B, 0x96, 0x53, 0xD1, 0xDD, 0x63, 0x2A, 0x41, 0xCB, 0xB9, 0xAA, 0x64,
-    0x7F, 0x54, 0x89, 0xCF, 0xDF, 0x71, 0x27, 0xA3, 0x4A, 0x3C, 0xC0, 0x8F, 0x18, 0x48, 0x41, 0x12,
-    0x2C, 0x64, 0x8A, 0xE6, 0x64, 0x92, 0x64, 0x1E, 0x42, 0x7C, 0x8D, 0xC5, 0xDE, 0x0E, 0xF4, 0x55,
-    0xDA, 0xF1, 0x74, 0xDA, 0xE8, 0x19, 0xB7, 0x3D, 0xBB, 0xBD, 0x5B, 0x69, 0xA0, 0x3E, 0x50, 0xFB,
-    0x61, 0xD3, 0xF9, 0xE6, 0xA9, 0xD7, 0x31, 0xC6, 0xA7, 0x14, 0x41, 0xEA, 0x78, 0xFB, 0x12, 0x92,
-    0xAB, 0x3B, 0x7A, 0x8A, 0xF5, 0x0F, 0x24, 0xFD, 0xF1, 0x92, 0xF5, 0x4F, 0x32, 0xDE, 0xB9, 0x7C,
-    0xAF, 0x63, 0xE4, 0x34, 0xAD, 0xEE, 0xD3, 0xFE, 0x93, 0xCC, 0x3C, 0x93, 0xE4, 0xAE, 0x44, 0xAB,
-    0x21, 0x41, 0x7D, 0x71, 0xEB, 0x69, 0x1F, 0x79, 0x87, 0x53, 0xF3, 0xC7, 0x2A, 0xA5, 0xDD, 0x41,
-    0x4D, 0xFE, 0x38, 0x61, 0xB4, 0x18, 0x1E, 0x95, 0xCD, 0x0B, 0x62, 0x7D, 0x5E, 0x60, 0xD7, 0x4A,
-    0xFE, 0x4C, 0xF5, 0x70, 0x83, 0x09, 0xBB, 0x45, 0x0B, 0xCF, 0x51, 0xB2, 0xD5, 0x70, 0x6A, 0x8E,
-    0x54, 0xF3, 0x82, 0x5B, 0xFA, 0xB7, 0xFF, 0xDB, 0xB9, 0xE3, 0xC2, 0x27, 0x65, 0x86, 0xDF, 0xFC,
-    0x2F, 0xCD, 0x5A, 0x3D, 0x8C, 0xDC, 0x66, 0x7A, 0x7E, 0x49, 0x6A, 0xC5, 0xC0, 0x04, 0x8E, 0x2A,
-    0x64, 0xDF, 0xC1, 0x06, 0xC4, 0x6B, 0xCF, 0x80, 0xCC, 0x36, 0xC5, 0xEE, 0x90, 0xB6, 0x90, 0x5C,
-    0x71, 0x85, 0x1D, 0x40, 0x7B, 0x2A, 0x8C, 0xC0, 0x75, 0xD4, 0x6C, 0x8A, 0x2B, 0x5C, 0xCC, 0x2E,
-    0xE9, 0x73, 0xE1, 0x22, 0x85, 0xF7, 0x90, 0xB8, 0xB6, 0x8B, 0x73, 0x60, 0x8F, 0x90, 0xAC, 0x0B,
-    0x01, 0x51, 0x80, 0x99, 0x25, 0xED, 0x2D, 0x5C, 0xA8, 0x30, 0x1D, 0x27, 0x38, 0x20, 0x2E, 0xC4,
-    0xE0, 0xFC, 0x83, 0x73, 0x23, 0xDE, 0x89, 0xB2, 0xB9, 0x6B, 0xCE, 0x7C, 0x79, 0x9E, 0xF7, 0xE3,
-    0xEC, 0x8F, 0xCE, 0xB2, 0xAD, 0x44, 0x82, 0xC5, 0xDD, 0xE1, 0x70, 0x38, 0xDF, 0xF7, 0xBD, 0x3F,
-    0xDF, 0xFB, 0xF3, 0xBC, 0x2F, 0x47, 0xC2, 0xEB, 0x5F, 0xCE, 0x13, 0x47, 0x44, 0xCE, 0x07, 0xCF,
-    0xD4, 0xD7, 0x46, 0xE1, 0xCB, 0x75, 0x9F, 0x84, 0x7B, 0x0D, 0x4F, 0x7F, 0xEC, 0x33, 0xB1, 0xC7,
-    0x54, 0x24, 0x28, 0x45, 0x66, 0xA9, 0x63, 0x4C, 0x99, 0x99, 0x3E, 0x6A, 0x4F, 0x5F, 0xE8, 0x44,
-    0xF0, 0x75, 0x50, 0x89, 0xF4, 0x22, 0x61, 0x79, 0xE2, 0x0D, 0x37, 0x77, 0x45, 0xFC, 0x46, 0x24,
-    0x29, 0x25, 0x35, 0xFF, 0x3C, 0xF5, 0x31, 0xCF, 0x37, 0xB5, 0xAE, 0x72, 0x0D, 0xB3, 0x72, 0x91,
-    0x33, 0x76, 0x69, 0xA7, 0xD8, 0x17, 0xD7, 0x98, 0xC6, 0x5D, 0xFC, 0xB2, 0xC5, 0xDC, 0x53, 0xB2,
-    0x85, 0x9B, 0x71, 0x6A, 0x57, 0x76, 0x5B, 0x7C, 0x98, 0x1D, 0xBB, 0x51, 0x60, 0x9D, 0x04, 0xA3,
-    0x57, 0xB2, 0xD7, 0x2E, 0xFE, 0xF9, 0x08, 0x92, 0xF7, 0x1A, 0xFB, 0x0A, 0x16, 0x93, 0xC9, 0x15,
-    0x33, 0x1C, 0x25, 0x29, 0xF9, 0xE9, 0x19, 0xFF, 0x99, 0x2F, 0xCD, 0xE7, 0x35, 0x17, 0xF0, 0x5A,
-    0xBF, 0x71, 0x1A, 0x59, 0x03, 0x37, 0x41, 0xB9, 0x26, 0xD2, 0x84, 0xA9, 0xAC, 0x7A, 0x95, 0x44,
-    0x90, 0x35, 0xCC, 0xC3, 0x3C, 0x28, 0xFD, 0xC5, 0x46, 0x0B, 0xB6, 0xCD, 0x33, 0xCD, 0xE5, 0x0B,
-    0x35, 0x98, 0x3D, 0xB3, 0x45, 0x6A, 0x94, 0xEE, 0x5D, 0x88, 0x3E, 0xF3, 0x5A, 0x90, 0x81, 0x84,
-    0x31, 0xD8, 0x70, 0x3A, 0x90, 0x06, 0xF1, 0x38, 0xC5, 0x98, 0x84, 0xD4, 0x67, 0x11, 0x24, 0xEC,
-    0x31, 0xD8, 0xFD, 0xBA, 0x12, 0xE7, 0x92, 0x59, 0x97, 0xD0, 0x98, 0x5E, 0x48, 0x19, 0x23, 0xC8,
-    0x0D, 0xBE, 0x5B, 0xB9, 0x74, 0xFB, 0xA2, 0xBD, 0x35, 0x29, 0x26, 0xB9, 0xDE, 0x52, 0xD6, 0x55,
-    0x0E, 0x8E, 0x3A, 0xBB, 0x76, 0xEC, 0x38, 0x3B, 0xEC, 0xC5, 0xCF, 0x8E, 0xDF, 0x14, 0x79, 0xF4,
-    0xA2, 0xC4, 0x66, 0x8E, 0xD5, 0x3F, 0xEC, 0xE4, 0x27, 0xB1, 0x55, 0x48, 0x44, 0x4D, 0x55, 0x50,
-    0x6B, 0x2D, 0x99, 0xA9, 0xC3, 0x3C, 0x7B, 0xAF, 0x91, 0xDD, 0x58, 0xBC, 0x3F, 0x81, 0xDD, 0x28,
-    0xF7, 0x1A, 0x93, 0x6E, 0x7A, 0x66, 0x27, 0xF7, 0x41, 0xD9, 0x35, 0xB9, 0x38, 0xF3, 0x61, 0xAF,
-    0xF0, 0xF6, 0xFB, 0x4F, 0x9C, 0x39, 0x58, 0x7A, 0xBA, 0xC0, 0x7D, 0x1C, 0xA7, 0x24, 0xED, 0x83,
-    0xBD, 0x26, 0xFE, 0x45, 0x3E, 0x1E, 0xC8, 0xCB, 0x69, 0xB3, 0x2F, 0x54, 0xEF, 0x0E, 0x66, 0x79,
-    0x9D, 0x9C, 0x86, 0x32, 0xF0, 0xEF, 0xD7, 0x32, 0x92, 0x95, 0x14, 0x8A, 0xCB, 0x03, 0x03, 0x85,
-    0x36, 0xBE, 0xE9, 0x9D, 0xE6, 0xBC, 0xCC, 0x25, 0x0D, 0x2F, 0x94, 0xDC, 0x9C, 0x17, 0x57, 0x75,
-    0x6B, 0xDE, 0xCF, 0x47, 0x98, 0xBE, 0xFA, 0x22, 0x74, 0xCD, 0x0F, 0x6B, 0x47, 0x1F, 0xF6, 0x4A,
-    0xFD, 0x66, 0xD5, 0xC5, 0x30, 0xFF, 0xD7, 0x55, 0x08, 0x06, 0xAE, 0x86, 0x52, 0x5C, 0x29, 0x43,
-    0xB9, 0xE6, 0x98, 0xDE, 0xAB, 0xBC, 0xCA, 0x79, 0x13, 0xDB, 0x43, 0xD5, 0x82, 0xD5, 0x2C, 0x95,
-    0x18, 0x7A, 0x2A, 0xDE, 0x2C, 0x6A, 0xA1, 0x61, 0xF0, 0x2C, 0x8F, 0x0E, 0x36, 0x55, 0x27, 0xC5,
-    0x4B, 0xB2, 0x2A, 0x5E, 0xF5, 0xF8, 0x2C, 0x36, 0x1F, 0x97, 0x6B, 0xAD, 0x77, 0x23, 0xDD, 0xDC,
-    0xDD, 0xF8, 0x0F, 0xF3, 0xB7, 0x83, 0x54, 0xD2, 0xF9, 0x55, 0x58, 0x66, 0xD8, 0xC7, 0x26, 0xA8,
-    0x13, 0xD9, 0xA2, 0x3D, 0xC4, 0x79, 0x9C, 0xCF, 0x25, 0x49, 0xB1, 0x4F, 0x4F, 0xE3, 0x85, 0x5D,
-    0xCD, 0xDC, 0x8E, 0x5F, 0xC9, 0x3B, 0x9E, 0x6A, 0x23, 0x83, 0x39, 0xBC, 0x80, 0xD7, 0x87, 0xEB,
-    0xEB, 0xEB, 0xB4, 0x3B, 0x32, 0x0F, 0xBB, 0x11, 0xB2, 0x2F, 0xCB, 0x1B, 0x8F, 0xD0, 0x18, 0xCD,
-    0xC7, 0xE6, 0xF6, 0xFA, 0xC5, 0xEF, 0xA1, 0x32, 0x2C, 0x00, 0x95, 0x15, 0x0B, 0x4C, 0x6D, 0x02,
-    0xAB, 0xB2, 0xA9, 0x5F, 0x43, 0x65, 0x41, 0x99, 0x40, 0x65, 0x32, 0xF5, 0x1A, 0x68, 0x29, 0x80,
-    0x6A, 0x56, 0x5F, 0x94, 0xD9, 0x46, 0xC9, 0x0F, 0xD8, 0x36, 0x7C, 0xD8, 0xDD, 0xA5, 0xCA, 0x02,
-    0x6C, 0xED, 0x2A, 0x86, 0x85, 0x25, 0x54, 0x16, 0x94, 0x9B, 0x54, 0x19, 0xE6, 0x40, 0x65, 0x41,
-    0x19, 0xBD, 0x0C, 0x95, 0x5D, 0x94, 0x8B, 0xDF, 0xAD, 0xB2, 0x27, 0x27, 0x93, 0xC9, 0x3F, 0xD2,
-    0x51, 0x78, 0xF1, 0x06, 0x6E, 0xC0, 0x2C, 0x42, 0xD3, 0xC4, 0x32, 0x5D, 0xE3, 0xEA, 0x6B, 0xF8,
-    0xC7, 0x05, 0x3E, 0xE2, 0xA6, 0x6B, 0x2D, 0xC3, 0xE5, 0x64, 0xB8, 0xB2, 0x3C, 0x25, 0xD6, 0x9F,
-    0x8F, 0xDD, 0x40, 0x94, 0x30, 0x73, 0x2A, 0xEB, 0xAF, 0xD6, 0xE7, 0xEB, 0xE9, 0x37, 0x8D, 0xB0,
-    0x37, 0x70, 0xAC, 0x40, 0x95, 0x3F, 0xC7, 0xC8, 0xDB, 0x9C, 0x22, 0xB0, 0xE5, 0x85, 0x77, 0xB0,
-    0xEB, 0x0A, 0xAC, 0xAD, 0x11, 0x1F, 0x1E, 0x25, 0x70, 0xD2, 0x28, 0x75, 0xDA, 0xE5, 0x49, 0x8C,
-    0xD9, 0x33, 0x86, 0x33, 0x2F, 0x62, 0x3B, 0xBC, 0xFD, 0x62, 0xE5, 0x70, 0xEC, 0xCC, 0x31, 0x95,
-    0xBB, 0x53, 0x8B, 0x5F, 0x41, 0xA7, 0x50, 0xAD, 0x73, 0xFB, 0x60, 0xE7, 0x7D, 0xD3, 0xC9, 0xBA,
-    0x38, 0x6F, 0x79, 0x5D, 0x50, 0x47, 0xB0, 0xBC, 0x17, 0xA9, 0xF2, 0x24, 0xB9, 0xB7, 0x57, 0x86,
-    0x57, 0x91, 0xE4, 0x8E, 0x49, 0xEA, 0x27, 0x0C, 0x9C, 0x23, 0x1E, 0x65, 0x5D, 0x3C, 0x72, 0x52,
-    0x75, 0xE4, 0xBB, 0xBD, 0xC4, 0x59, 0x5F, 0x4F, 0x03, 0x08, 0xE5, 0x19, 0x73, 0xA5, 0x82, 0x93,
-    0x9F, 0x8F, 0x8C, 0x71, 0x3F, 0xE2, 0x45, 0xF2, 0xED, 0x17, 0x1F, 0xF2, 0x02, 0x0E, 0xED, 0x56,
-    0x09, 0x2E, 0xB0, 0x4D, 0x2E, 0xCC, 0x0B, 0x17, 0x12, 0xFE, 0x9F, 0x2E, 0x78, 0x20, 0xC8, 0x2F,
-    0x32, 0x47, 0xBC, 0x32, 0x48, 0xC3, 0xC6, 0xE9, 0xA1, 0xB2, 0x69, 0xD1, 0x66, 0xDB, 0x74, 0xFB,
-    0xE2, 0xC6, 0xCD, 0xF1, 0xF8, 0xE9, 0xC6, 0x2F, 0x23, 0x19, 0x3B, 0x47, 0x6F, 0x9C, 0x15, 0x75,
-    0xEE, 0xA2, 0x47, 0x40, 0xBC, 0x2A, 0xB7, 0x2A, 0xF7, 0x86, 0x04, 0x63, 0x39, 0x7F, 0x55, 0x6E,
-    0x37, 0xFE, 0x7B, 0x07, 0x33, 0x57, 0x43, 0x2A, 0xFC, 0xC8, 0x69, 0xC3, 0xD2, 0x6B, 0x22, 0xBE,
-    0x72, 0x7A, 0x90, 0x5F, 0x27, 0x29, 0x1D, 0x2A, 0x2A, 0x67, 0xD2, 0xC3, 0x90, 0xAB, 0x23, 0x17,
-    0x43, 0x64, 0x7A, 0xC7, 0xB7, 0xBB, 0x4E, 0x2B, 0x38, 0x27, 0x7E, 0x4F, 0x8F, 0x89, 0x7B, 0xE6,
-    0x97, 0xD9, 0x98, 0x3B, 0xFD, 0xD3, 0xB1, 0x78, 0x30, 0x92, 0xB1, 0xE6, 0x89, 0xB1, 0xFA, 0xD6,
-    0x18, 0x36, 0xC0, 0xF3, 0x58, 0xCF, 0x1D, 0xB4, 0x3E, 0x76, 0xB1, 0x9E, 0x8C, 0xBD, 0x2A, 0xC4,
-    0x39, 0xCC, 0x13, 0x9C, 0x23, 0xF9, 0xB7, 0x5A, 0xCE, 0x8E, 0x9C, 0x5B, 0x98, 0x3C, 0xF5, 0xF6,
-    0x70, 0x6E, 0x83, 0x0B, 0x35, 0xD6, 0x3A, 0x87, 0xE5, 0xFC, 0x72, 0x0D, 0xE7, 0x30, 0x2D, 0xCC,
-    0x02, 0x6B, 0x65, 0x30, 0x33, 0xAC, 0x85, 0x3B, 0x1D, 0xCF, 0x4E, 0xA3, 0xD7, 0x9B, 0xE4, 0x47,
-    0x8A, 0x1C, 0xC3, 0x1C, 0x9B, 0xA6, 0xBA, 0x8E, 0x36, 0x75, 0x76, 0xA4, 0x0C, 0x85, 0xB9, 0x6B,
-    0xC7, 0xD1, 0xC9, 0x3B, 0xA6, 0x43, 0xD8, 0xD1, 0x58, 0x9D, 0x77, 0xE4, 0xFC, 0x16, 0x5F, 0xC4,
-    0x21, 0x14, 0xD2, 0x85, 0xCF, 0x7E, 0xD6, 0xCB, 0x28, 0xCC, 0xF3, 0x48, 0xC2, 0x57, 0x4A, 0x84,
-    0x05, 0x07, 0x4C, 0x80, 0x02, 0x27, 0x5F, 0xD3, 0x08, 0x31, 0x56, 0xCF, 0xDF, 0xD4, 0x8B, 0x4D,
-    0x8D, 0x17, 0x38, 0xC7, 0x7A, 0x8E, 0xF4, 0x0C, 0xCB, 0xC5, 0xAE, 0x83, 0x72, 0x68, 0xFA, 0x21,
-    0x7A, 0x14, 0x2D, 0xA3, 0x4C, 0x02, 0xB6, 0xDC, 0xC6, 0xCD, 0x63, 0x1B, 0x65, 0x1A, 0x8E, 0xC4,
-    0x9C, 0x81, 0x7F, 0xDC, 0xCA, 0x3A, 0xB2, 0xED, 0x9B, 0xDC, 0x21, 0x93, 0x1B, 0x1A, 0x5B, 0x10,
-    0xE5, 0xCA, 0x47, 0xB9, 0x68, 0xEB, 0x53, 0x27, 0xB1, 0x2C, 0x82, 0xED, 0xCC, 0x2F, 0xE3, 0x3A,
-    0x33, 0x55, 0xE7, 0xFF, 0xAB, 0x5C, 0xDE, 0x8E, 0x85, 0x3A, 0xF3, 0xAA, 0x35, 0x0E, 0xBF, 0x16,
-    0xBC, 0x5C, 0x73, 0xD1, 0x66, 0xC4, 0x45, 0xD7, 0x18, 0xAF, 0x99, 0xB9, 0x6B, 0x25, 0xBF, 0x50,
-    0x4D, 0x8C, 0x64, 0xD0, 0x1E, 0xF7, 0x66, 0x64, 0x19, 0x84, 0xB9, 0x07, 0xA0, 0x59, 0xA4, 0x9A,
-    0xBD, 0x4E, 0x2D, 0xA3, 0x9E, 0xFA, 0xFB, 0x53, 0x3A, 0x98, 0x19, 0x3A, 0x2A, 0x25, 0x80, 0x2A,
-    0x20, 0x55, 0xA1, 0x1F, 0x38, 0x76, 0x24, 0xCB, 0x45, 0xF1, 0xE9, 0x54, 0xFC, 0xC9, 0x13, 0x15,
-    0x12, 0x3C, 0xD0, 0x40, 0x0A, 0xA7, 0x95, 0xD3, 0xDB, 0xBA, 0x78, 0x4A, 0x5F, 0x52, 0x5D, 0xF8,
-    0x1A, 0xAF, 0x22, 0xDE, 0x80, 0x23, 0x9F, 0x3C, 0xD4, 0xE5, 0x10, 0x5B, 0xA9, 0x2F, 0x9A, 0x66,
-    0x38, 0xE7, 0xB4, 0xAF, 0x38, 0x23, 0xA1, 0x01, 0x79, 0xFF, 0xA3, 0x40, 0x81, 0x99, 0x35, 0x84,
-    0x69, 0x8A, 0xD3, 0x71, 0xB5, 0x98, 0xF3, 0xBC, 0x86, 0x39, 0x73, 0xC6, 0xAC, 0x8B, 0xFF, 0x5E,
-    0xA3, 0x57, 0x8D, 0x10, 0x8E, 0x30, 0xE3, 0x1D, 0x4C, 0xAE, 0xB4, 0x44, 0x24, 0x51, 0xAE, 0xD0,
-    0x86, 0x7C, 0x04, 0x35, 0xB3, 0x99, 0x66, 0x79, 0xAF, 0x25, 0x58, 0x89, 0x5E, 0x2D, 0x6D, 0x3E,
-    0x97, 0xB7, 0x49, 0x9E, 0x11, 0xD6, 0xA6, 0x71, 0x99, 0xCB, 0x00, 0x4C, 0xE0, 0x79, 0x0F, 0x21,
-    0xBF, 0x4F, 0x92, 0x7A, 0x40, 0x1E, 0x1C, 0x4D, 0x05, 0x5B, 0x8A, 0xA1, 0x72, 0x50, 0x73, 0x2B,
-    0xA7, 0x79, 0xE8, 0xF8, 0x75, 0x52, 0x38, 0xBF, 0x98, 0x1C, 0x5B, 0x9F, 0x98, 0x1D, 0x7C, 0xFB,
-    0x2E, 0xB9, 0xFE, 0x15, 0xFC, 0xEF, 0xC4, 0x61, 0x55, 0x9F, 0x30, 0xD0, 0x04, 0x6A, 0x36, 0x86,
-    0xD9, 0x39, 0xE2, 0x4A, 0x04, 0x40, 0xB0, 0xB6, 0x48, 0xC1, 0x24, 0xBF, 0xEB, 0x09, 0x21, 0xA3,
-    0x9C, 0xC8, 0xAE, 0xF1, 0x14, 0x01, 0x81, 0x36, 0xEE, 0xF5, 0xA4, 0x07, 0x8E, 0x10, 0xB2, 0x17,
-    0x44, 0xA7, 0xC8, 0xB8, 0xC9, 0x64, 0x52, 0xA4, 0x90, 0x09, 0xA8, 0x40, 0x81, 0x2E, 0x2C, 0x58,
-    0x76, 0x29, 0x98, 0xD7, 0x68, 0xC8, 0xFF, 0x79, 0x4D, 0xA1, 0x7B, 0x8B, 0xDE, 0x1C, 0x45, 0xB7,
-    0x7D, 0xA0, 0xDA, 0xA0, 0xA6, 0xAE, 0x2D, 0x03, 0xDF, 0x43, 0xC7, 0xAA, 0x3D, 0x94, 0xBC, 0xFB,
-    0x19, 0x69, 0xAE, 0x06, 0x24, 0x9F, 0x5F, 0xE5, 0x65, 0x78, 0x68, 0x1B, 0xFE, 0x0F, 0xEC, 0x5A,
-    0x88, 0x0B, 0x88, 0x0A, 0x8A, 0xC0, 0x2A, 0xEE, 0xBF, 0x31, 0xC4, 0xB9, 0x2F, 0xAB, 0x02, 0xC3,
-    0xCA, 0x86, 0x07, 0x95, 0x0E, 0x00, 0xD8, 0x4A, 0xD5, 0x5B, 0xED, 0xCE, 0x74, 0x3A, 0x98, 0x49,
-    0xAC, 0x33, 0x86, 0x5F, 0x00, 0xE0, 0x20, 0x67, 0x19, 0x20, 0x03, 0xA8, 0x8F, 0x5A, 0xC3, 0xC0,
-    0x44, 0x31, 0x8F, 0x2D, 0x14, 0x54, 0x87, 0x20, 0x35, 0x99, 0xF4, 0xD6, 0xF0, 0xF9, 0x25, 0x10,
-    0x94, 0x15, 0x50, 0x37, 0x8D, 0x68, 0xB9, 0x27, 0x93, 0x42, 0x65, 0xBF, 0x44, 0x2D, 0x83, 0x21,
-    0xA2, 0x3B, 0xA2, 0x18, 0xAB, 0x51, 0xA3, 0x75, 0x8D, 0x91, 0xEC, 0xE0, 0x4A, 0xEB, 0xCD, 0xC5,
-    0xC9, 0x51, 0x0A, 0x69, 0xF8, 0xD3, 0xF2, 0x88, 0xB5, 0x93, 0xB8, 0xDD, 0xF2, 0x93, 0x46, 0xB9,
-    0x23, 0xFC, 0x7F, 0x78, 0x6B, 0x77, 0x19, 0xFC, 0x48, 0x4A, 0x42, 0x7E, 0x19, 0x51, 0xF1, 0xB1,
-    0x9E, 0xF6, 0xD7, 0xA7, 0x54, 0x66, 0x03, 0x62, 0x04, 0x65, 0xFF, 0xBE, 0x0C, 0x34, 0x3A, 0x44,
-    0xA3, 0xA5, 0xA2, 0x2C, 0x86, 0x69, 0x8A, 0xE4, 0x2D, 0x40, 0xF2, 0xB7, 0x36, 0x42, 0xCD, 0x2D,
-    0x29, 0xCA, 0x74, 0x7E, 0x69, 0x8E, 0xD0, 0xF1, 0x0D, 0xE8, 0x03, 0x4C, 0xDF, 0x28, 0xBF, 0xA9,
-    0xAA, 0xC3, 0x9B, 0x99, 0x4C, 0x5E, 0x45, 0x21, 0x83, 0x21, 0x1F, 0xDC, 0x6D, 0x08, 0xDF, 0xBE,
-    0x98, 0xBC, 0x8D, 0x21, 0x37, 0xA9, 0x5C, 0xB9, 0x8C, 0xCF, 0xB5, 0x8A, 0x9A, 0x59, 0xDF, 0xA8,
-    0x1F, 0x28, 0xBD, 0xC7, 0x91, 0x85, 0xE6, 0x2A, 0x6F, 0xFC, 0x6C, 0x19, 0x54, 0x09, 0xC8, 0x5D,
-    0x7B, 0xA0, 0xF2, 0x9D, 0x92, 0x4D, 0xAF, 0x06, 0xEC, 0x91, 0x55, 0x22, 0xAE, 0xE5, 0x41, 0xE4,
-    0x67, 0x87, 0xCC, 0xEF, 0xBA, 0xCA, 0xC1, 0xE4, 0x2D, 0x12, 0x02, 0xBD, 0xBB, 0x0E, 0xC1, 0x1B,
-    0xEA, 0xD8, 0xD7, 0x2D, 0xD7, 0xF5, 0x65, 0x58, 0x06, 0xAC, 0x21, 0x62, 0x8A, 0x3F, 0x37, 0x88,
-    0xB4, 0x63, 0x9A, 0x6C, 0x9B, 0x18, 0x0C, 0xE3, 0x13, 0xF9, 0xAE, 0x8B, 0x79, 0xC0, 0x95, 0xE4,
-    0x91, 0x6D, 0x18, 0x62, 0x92, 0x62, 0xB5, 0x56, 0xD1, 0x84, 0xAE, 0xF4, 0x0F, 0xA6, 0xF7, 0xF7,
-    0x31, 0x50, 0xDD, 0xE1, 0x7B, 0x9E, 0x00, 0xAA, 0xAE, 0x03, 0xA8, 0xBC, 0x05, 0x53, 0x27, 0xF4,
-    0x08, 0xAF, 0x57, 0x23, 0xB7, 0xBD, 0x2A, 0x43, 0xB1, 0x18, 0x9B, 0x3A, 0x36, 0x8D, 0xB3, 0x48,
-    0x6D, 0x94, 0xBA, 0xE7, 0xFF, 0x39, 0x56, 0x68, 0xF0, 0x7F, 0xC6, 0x09, 0xCB, 0x69, 0x1F, 0x7C,
-    0x7C, 0x58, 0x84, 0x06, 0xA6, 0x2B, 0x4C, 0x99, 0x6D, 0xDF, 0x0B, 0xAB, 0x70, 0x21, 0x14, 0x58,
-    0x05, 0xFB, 0x10, 0x8B, 0x6D, 0x35, 0x86, 0x9A, 0xBB, 0x84, 0x70, 0x32, 0x03, 0xF7, 0x29, 0x62,
-    0x01, 0x74, 0x32, 0xA3, 0x93, 0x31, 0xD2, 0x26, 0x29, 0xD3, 0x60, 0xA7, 0x41, 0x97, 0x41, 0x0D,
-    0xF1, 0x97, 0x38, 0xF0, 0x03, 0x8E, 0x9F, 0xD3, 0xC9, 0xC3, 0xFF, 0x36, 0xA8, 0xD9, 0x35, 0x2A,
-    0xDB, 0xA8, 0xA7, 0x97, 0x31, 0xB3, 0x27, 0x08, 0xE1, 0xD2, 0x70, 0xB1, 0x18, 0x26, 0x28, 0x51,
-    0x2B, 0xC5, 0xA4, 0x98, 0x93, 0xDA, 0x82, 0x84, 0x59, 0x0C, 0xAE, 0xE0, 0x4F, 0x92, 0xE6, 0x47,
-    0x18, 0xB7, 0xC0, 0xB8, 0x06, 0xE8, 0xCD, 0xA9, 0x2C, 0xE2, 0x19, 0x0E, 0xBA, 0xFE, 0x94, 0x6E,
-    0x3D, 0x65, 0x54, 0x9A, 0xD2, 0x81, 0xA7, 0x0C, 0x7A, 0x53, 0x1A, 0xD4, 0xB4, 0x2F, 0x78, 0x42,
-    0x8C, 0x98, 0xF6, 0x08, 0xEF, 0x53, 0x72, 0x37, 0xED, 0x11, 0x24, 0xA6, 0x0C, 0xA4, 0xD3, 0x5E,
-    0x16, 0x3C, 0x25, 0x29, 0x4E, 0x31, 0x54, 0x07, 0x0F, 0xC4, 0xC9, 0x6B, 0x70, 0x72, 0xFB, 0x29,
-    0x35, 0xCB, 0x53, 0xC6, 0x53, 0xAC, 0xC6, 0xC7, 0x93, 0xAF, 0xFD, 0x0A, 0x8C, 0x78, 0x43, 0x03,
-    0x66, 0x79, 0x88, 0x60, 0x6C, 0x20, 0x0D, 0x35, 0x83, 0x9D, 0x3F, 0x99, 0xC1, 0xB4, 0xB2, 0xF5,
-    0xA9, 0x0F, 0xD7, 0x7C, 0x5A, 0xA0, 0x60, 0xCE, 0x25, 0x26, 0x2E, 0x47, 0xE5, 0xCC, 0xC5, 0x3A,
-    0x86, 0xCE, 0xF0, 0x7D, 0xCE, 0x9F, 0x53, 0x9E, 0xE0, 0xA6, 0x86, 0x3E, 0xAE, 0xEA, 0x69, 0xAC,
-    0x4D, 0x34, 0xB6, 0x69, 0xDA, 0x4B, 0x78, 0xD7, 0xFF, 0x9A, 0xD1, 0x61, 0x97, 0xC1, 0x31, 0xFC,
-    0x88, 0xD3, 0x7A, 0x66, 0xC7, 0xF8, 0x25, 0xED, 0x50, 0x00, 0xAA, 0x38, 0x80, 0xF0, 0xFB, 0xBF,
-    0x84, 0x56, 0x74, 0xFB, 0x86, 0x12, 0x76, 0xC5, 0xF2, 0x72, 0x59, 0x96, 0xA1, 0x53, 0xE3, 0xAA,
-    0x36, 0x92, 0x2C, 0xD7, 0x6E, 0xFD, 0xD0, 0x72, 0xFD, 0xB8, 0xA2, 0x43, 0x9B, 0xFC, 0x39, 0x33,
-    0x79, 0xA1, 0x64, 0xAF, 0x0D, 0x21, 0x1B, 0x81, 0xEB, 0xEA, 0x43, 0xCA, 0xB5, 0xF3, 0x9C, 0x93,
-    0xB3, 0xC3, 0xB4, 0x0A, 0xE7, 0x30, 0x37, 0x73, 0x24, 0x9D, 0x02, 0xF3, 0xFF, 0xF2, 0x30, 0xD0,
-    0x0E, 0xC7, 0x86, 0xD9, 0xD6, 0x8C, 0x5D, 0xA1, 0xAA, 0x7F, 0xDE, 0xE4, 0x80, 0x10, 0xEE, 0x1C,
-    0x86, 0x89, 0xD5, 0x99, 0x81, 0x62, 0x4D, 0xDE, 0xDA, 0x62, 0x0C, 0x3F, 0x56, 0x4E, 0x94, 0x29,
-    0xCB, 0x5F, 0x7F, 0xC4, 0xF5, 0xFC, 0x90, 0xEB, 0x4C, 0xC5, 0xFA, 0x5C, 0x25, 0x54, 0x61, 0xF7,
-    0x3A, 0xCA, 0xCD, 0x6E, 0x57, 0xC6, 0xDA, 0x2D, 0xAA, 0x5D, 0xF3, 0xDA, 0x46, 0x37, 0xF8, 0x59,
-    0xC0, 0x93, 0xC8, 0x73, 0x62, 0x3B, 0x3E, 0xC2, 0x30, 0x4D, 0x30, 0x45, 0xB3, 0x58, 0xF5, 0xAA,
-    0x6F, 0x80, 0x63, 0x0F, 0x11, 0xBF, 0xB2, 0x2D, 0xCE, 0x75, 0x44, 0x8E, 0x57, 0x11, 0xEF, 0xC3,
-    0x2A, 0x2A, 0xC3, 0x0F, 0xE1, 0xC3, 0x37, 0x81, 0xA2, 0x7A, 0xCD, 0xFD, 0x0E, 0xD6, 0x8F, 0x3E,
-    0x38, 0xFE, 0xDD, 0xEF, 0x4A, 0xAD, 0xC8, 0xB4, 0xF8, 0xFA, 0x0B, 0x8A, 0xF2, 0x9B, 0x56, 0xC1,
-    0x92, 0x8A, 0x52, 0x42, 0x14, 0x4F, 0x45, 0x49, 0x28, 0x4A, 0x68, 0x20, 0x8A, 0xDB, 0x52, 0x94,
-    0x2D, 0x8A, 0x12, 0x96, 0x10, 0xC5, 0x6D, 0x28, 0xCA, 0x26, 0x45, 0x21, 0x3A, 0x62, 0xB2, 0x80,
-    0x28, 0x33, 0x8A, 0x02, 0xEC, 0x93, 0xED, 0xE2, 0x33, 0x44, 0x99, 0x51, 0x14, 0x62, 0xA1, 0x3D,
-    0xF6, 0x0E, 0xBB, 0xA8, 0x3F, 0x14, 0xC5, 0x57, 0x51, 0x0C, 0x45, 0x89, 0x7F, 0x41, 0x51, 0xDE,
-    0x58, 0x8A, 0xC2, 0xFE, 0x12, 0xAD, 0xBC, 0xE0, 0xD5, 0x62, 0xE8, 0x7D, 0x0E, 0xA7, 0xE3, 0x16,
-    0x4E, 0x23, 0xFE, 0x8A, 0x9D, 0x5B, 0x66, 0xE7, 0x98, 0x7A, 0x9E, 0xFD, 0xBF, 0x6F, 0x85, 0xD7,
-    0xB1, 0x53, 0x09, 0x22, 0x24, 0xDC, 0xA3, 0x44, 0x28, 0x4C, 0x3E, 0x7D, 0x7E, 0x4E, 0xF4, 0x08,
-    0xF5, 0x99, 0x4E, 0x9B, 0x48, 0x74, 0xAC, 0x37, 0x06, 0x14, 0x6E, 0xF1, 0xD8, 0x12, 0x72, 0x9E,
-    0x80, 0xEC, 0x3F, 0x14, 0x73, 0x5A, 0xDD, 0x84, 0xED, 0x10, 0x1E, 0x02, 0xFA, 0xE9, 0x0C, 0x5B,
-    0xE1, 0xE7, 0xC7, 0x63, 0xDA, 0x0F, 0xC5, 0x1C, 0xFB, 0xA8, 0x4E, 0x8B, 0x10, 0x4B, 0xF8, 0x23,
-    0xE1, 0x1D, 0xF1, 0xCA, 0x02, 0xE7, 0xD9, 0x7D, 0x66, 0xCE, 0xFB, 0x53, 0x37, 0x84, 0xB9, 0x5D,
-    0xC0, 0xE1, 0xA0, 0x09, 0x11, 0xA2, 0x52, 0xA2, 0x6F, 0xB8, 0xE2, 0x62, 0xD9, 0x01, 0xD6, 0x14,
-    0x46, 0xA7, 0x75, 0x0E, 0xAB, 0x9C, 0xA9, 0x56, 0x35, 0xC7, 0x98, 0x63, 0xCE, 0xDE, 0x67, 0xEE,
-    0xDB, 0x83, 0x76, 0x69, 0xDE, 0x6C, 0x53, 0x21, 0x81, 0x6B, 0xA1, 0x12, 0xE7, 0xC8, 0xDB, 0x5A,
-    0x33, 0xEC, 0x12, 0x79, 0x33, 0xC7, 0x3A, 0x1D, 0x31, 0x33, 0x63, 0xA6, 0xCF, 0xFE, 0x63, 0x48,
-    0x25, 0x44, 0xA5, 0x1C, 0xB5, 0xF3, 0x4F, 0xF6, 0xEE, 0xBF, 0xE1, 0xD6, 0x74, 0xB8, 0xB9, 0x7C,
-    0x2D, 0x26, 0xDB, 0x74, 0x98, 0x94, 0xD0, 0x0E, 0xA8, 0xAE, 0x65, 0x72, 0x66, 0x6E, 0xEE, 0xAD,
-    0xA4, 0xCB, 0x57, 0x6F, 0xEF, 0x07, 0xAD, 0xB9, 0x62, 0x2A, 0x3B, 0x7E, 0xFB, 0xC4, 0x3A, 0xCB,
-    0x97, 0xAC, 0x5C, 0x14, 0xDD, 0x1D, 0x04, 0x94, 0x16, 0xA1, 0x6B, 0xA3, 0x04, 0x3E, 0x98, 0xD3,
-    0x71, 0xAB, 0xC4, 0x9A, 0x4D, 0x54, 0x26, 0x88, 0x66, 0xA8, 0xCA, 0x08, 0x08, 0x0B, 0x70, 0x07,
-    0xD6, 0x12, 0x21, 0x32, 0x08, 0x29, 0x6E, 0x96, 0xE3, 0x2B, 0x83, 0x0B, 0x5F, 0x67, 0xB5, 0x98,
-    0x15, 0xEF, 0xD1, 0xE2, 0xF4, 0xC9, 0x00, 0x2E, 0x36, 0x13, 0xB5, 0xC1, 0x6B, 0x6E, 0x9F, 0x80,
-    0xC6, 0x05, 0x60, 0x33, 0xC4, 0xB2, 0x95, 0x54, 0x3B, 0x1F, 0x4E, 0x6F, 0x1D, 0x88, 0x15, 0x1F,
-    0x1B, 0x5E, 0xC7, 0x0C, 0x34, 0x33, 0x29, 0xCA, 0xD3, 0x7C, 0xF4, 0x37, 0x45, 0x9A, 0x2A, 0xAE,
-    0xE9, 0x97, 0xD5, 0x87, 0x33, 0x61, 0xBB, 0xA7, 0x4F, 0xFE, 0x70, 0xE9, 0x56, 0x27, 0x21, 0x36,
-    0x3A, 0x41, 0x78, 0x9E, 0x77, 0xE2, 0x63, 0xE3, 0x93, 0x0F, 0xEA, 0xC0, 0x44, 0x66, 0x3E, 0x8E,
-    0xCC, 0x4B, 0x8D, 0xA3, 0xC1, 0xE4, 0x91, 0x9C, 0xB8, 0x6A, 0xF9, 0xB0, 0x82, 0x54, 0xCE, 0xC9,
-    0x7D, 0xA7, 0x42, 0xE3, 0x49, 0x50, 0xB1, 0x30, 0x0F, 0xBC, 0x5A, 0xB2, 0xC1, 0x19, 0xA6, 0x41,
-    0x7E, 0xBF, 0xA9, 0x9C, 0x95, 0x9F, 0xFA, 0x0B, 0xB6, 0x78, 0x77, 0x9C, 0x3A, 0x6B, 0x03, 0x0B,
-    0x04, 0xF4, 0x88, 0x4C, 0xC5, 0xA6, 0x5B, 0xF8, 0x4F, 0x1B, 0xD5, 0x19, 0x18, 0xA2, 0xB5, 0x26,
-    0x4B, 0xE5, 0x72, 0x51, 0x22, 0x19, 0x87, 0x07, 0xEB, 0x3D, 0xAA, 0x56, 0x2C, 0x1B, 0xDE, 0xC8,
-    0x49, 0xC5, 0x81, 0xC9, 0x84, 0xB7, 0x3A, 0xD7, 0xBC, 0x6F, 0xCC, 0x0B, 0xBE, 0xA9, 0xC7, 0xEA,
-    0x9D, 0x67, 0x1C, 0xF1, 0xB4, 0x13, 0xDB, 0xCB, 0xF9, 0x93, 0x08, 0xE8, 0x7E, 0x51, 0x50, 0x1F,
-    0xAF, 0xC5, 0xFB, 0xBC, 0x96, 0x1F, 0xA1, 0xF0, 0xFC, 0x55, 0x08, 0x20, 0x3B, 0x56, 0xC5, 0x39,
-    0x47, 0x50, 0xC0, 0x37, 0x2D, 0xCA, 0xFE, 0xCE, 0xFB, 0xF4, 0x89, 0xF6, 0x94, 0x28, 0x88, 0x2E,
-    0x97, 0x04, 0x1F, 0xDF, 0x81, 0x05, 0x99, 0xBD, 0xC5, 0x6B, 0x19, 0xA2, 0x2F, 0x28, 0x78, 0x5F,
-    0xD5, 0x4A, 0x30, 0xCB, 0x00, 0x89, 0x16, 0x52, 0xFC, 0xD1, 0x98, 0xDF, 0xBD, 0x6B, 0xBA, 0x68,
-    0x78, 0xAC, 0x63, 0x41, 0x50, 0xCB, 0xF5, 0xA1, 0xE7, 0xCC, 0xD4, 0xEE, 0xFE, 0x8F, 0xBF, 0x6E,
-    0xA3, 0x1A, 0x72, 0x1A, 0x5D, 0x35, 0x68, 0xF5, 0x49, 0x47, 0x54, 0xEA, 0xFA, 0x19, 0x49, 0x3C,
-    0x76, 0x65, 0x31, 0xB9, 0xD2, 0x04, 0xF6, 0x29, 0xA0, 0x79, 0x73, 0xE3, 0x8B, 0xC9, 0x04, 0x90,
-    0x69, 0x4B, 0xBF, 0xA6, 0xC5, 0x3A, 0x1D, 0xBB, 0x92, 0x2C, 0x96, 0x13, 0xB6, 0x3E, 0x4B, 0x57,
-    0xDB, 0x0B, 0x79, 0xF6, 0xC2, 0x27, 0x8F, 0x55, 0x99, 0x69, 0xB1, 0xD5, 0x69, 0xB6, 0x80, 0xC2,
-    0x5A, 0x9A, 0xB9, 0x35, 0x42, 0x64, 0xDF, 0x7D, 0x48, 0x54, 0x27, 0x9F, 0xFE, 0x0B, 0x96, 0xE2,
-    0x22, 0xB1, 0xED, 0x7C, 0x26, 0x72, 0xE7, 0x5B, 0x6B, 0x43, 0x04, 0x31, 0xC4, 0x7C, 0xA5, 0x8E,
-    0x98, 0x1B, 0xB1, 0xFE, 0x53, 0xB6, 0x4C, 0x07, 0x7E, 0x63, 0xC7, 0xD7, 0xD5, 0x06, 0x28, 0xC1,
-    0x03, 0x39, 0xF8, 0xBB, 0x21, 0xAA, 0x68, 0xA3, 0x80, 0xDD, 0x10, 0x1A, 0xF9, 0x71, 0x2B, 0x47,
-    0x42, 0x4F, 0x11, 0x87, 0x3B, 0x49, 0x7E, 0x53, 0xE4, 0x49, 0xCA, 0xBE, 0xBB, 0xEC, 0x22, 0x58,
-    0x85, 0x7B, 0x8C, 0x60, 0x28, 0x16, 0x7B, 0x36, 0x47, 0x50, 0xA1, 0x4E, 0x2C, 0x5E, 0x19, 0x3A,
-    0x09, 0x74, 0x19, 0x4D, 0xBE, 0xD1, 0xED, 0x95, 0xAB, 0x0E, 0x41, 0x64, 0xC0, 0x4E, 0x05, 0x7D,
-    0x57, 0xBD, 0x2A, 0x18, 0xBA, 0x1A, 0xE4, 0x5C, 0x49, 0x36, 0x0F, 0x92, 0x24, 0x5D, 0xCC, 0x65,
-    0x37, 0x82, 0xA6, 0x82, 0xB8, 0xEA, 0xB0, 0xD0, 0x6A, 0x65, 0xFC, 0x00, 0x49, 0xC2, 0x1B, 0x24,
-    0x81, 0x64, 0x21, 0xDC, 0xC1, 0xAD, 0xCE, 0xDD, 0x91, 0xA9, 0x8A, 0x7D, 0xF6, 0x7D, 0x6A, 0x59,
-    0xFC, 0xF5, 0x02, 0x35, 0x4F, 0x58, 0x6E, 0x21, 0x94, 0x41, 0xFB, 0x09, 0x1B, 0x57, 0x7B, 0x07,
-    0xB0, 0x20, 0x43, 0xCF, 0x9E, 0xC0, 0x78, 0x86, 0x47, 0xCC, 0x5A, 0x19, 0x71, 0xA3, 0xB4, 0x27,
-    0x9A, 0xFD, 0xE7, 0x63, 0xF4, 0xA8, 0x16, 0xDB, 0xDB, 0x6A, 0x0A, 0x7A, 0x32, 0x45, 0xE5, 0x57,
-    0x23, 0x14, 0x4E, 0x87, 0x8A, 0x89, 0xAD, 0xB8, 0xEF, 0xFA, 0x7B, 0xCB, 0xEB, 0x7C, 0x44, 0xE4,
-    0x64, 0x68, 0x6E, 0x8F, 0x34, 0x01, 0x7D, 0xFB, 0x9F, 0xFC, 0x0C, 0x7C, 0xA7, 0x50, 0x63, 0xF0,
-    0xFB, 0x26, 0x4A, 0xFB, 0x55, 0x7D, 0xB4, 0x66, 0x27, 0x0F, 0x9D, 0xAB, 0x7B, 0xF9, 0x3F, 0x25,
-    0x17, 0xEA, 0x64, 0xCB, 0xBB, 0x55, 0x2D, 0x57, 0x61, 0xF9, 0xD4, 0xDB, 0xD6, 0xDD, 0xF7, 0x38,
-    0x29, 0xFA, 0x74, 0x5A, 0x3E, 0xB6, 0xFB, 0x8C, 0xC0, 0x50, 0x37, 0x38, 0x87, 0xBB, 0x40, 0x57,
-    0xD9, 0x2B, 0xD8, 0xB8, 0x5C, 0xF3, 0xE5, 0xCC, 0xE6, 0xC5, 0x47, 0xFE, 0x10, 0x23, 0x6F, 0xCF,
-    0x3B, 0xCF, 0xEC, 0x98, 0x72, 0x21, 0x01, 0x73, 0x6C, 0xCC, 0x5C, 0x3C, 0x4F, 0x96, 0x40, 0x67,
-    0x79, 0xD1, 0x13, 0x5D, 0xBC, 0x87, 0x8A, 0xA4, 0x1B, 0xD2, 0x14, 0x7C, 0x9E, 0xFD, 0x3B, 0x57,
-    0x4B, 0xE9, 0x21, 0x9A, 0x3A, 0x26, 0x7F, 0xC7, 0x33, 0x07, 0x4D, 0xF0, 0x34, 0xB4, 0x61, 0x11,
-    0xA7, 0x1E, 0xAB, 0x81, 0xC9, 0xD7, 0xE0, 0xCA, 0xC9, 0xFE, 0xA5, 0x3E, 0xA9, 0x64, 0x81, 0x50,
-    0xB3, 0x95, 0xDC, 0xFB, 0x43, 0xC0, 0x44, 0xDB, 0xE5, 0x47, 0xFD, 0xBB, 0xC3, 0x14, 0x7F, 0xBC,
-    0xEB, 0x83, 0xFD, 0xCF, 0xD9, 0x89, 0x4D, 0xBD, 0xF9, 0x25, 0xE2, 0x6D, 0xBF, 0xA1, 0x50, 0xBF,
-    0x6E, 0x07, 0x11, 0x98, 0x4B, 0x4F, 0x48, 0xA7, 0x75, 0x57, 0x0F, 0x43, 0x0B, 0xDF, 0x85, 0x55,
-    0x76, 0x08, 0x27, 0x99, 0x24, 0xDB, 0x1B, 0x95, 0x43, 0x5B, 0x72, 0x15, 0x67, 0x3D, 0x77, 0x88,
-    0x50, 0x69, 0xD7, 0x0C, 0xD6, 0xDA, 0xD8, 0xEB, 0xEE, 0x88, 0x0A, 0x0F, 0x88, 0xB2, 0xC2, 0xCF,
-    0x84, 0x3D, 0x0E, 0xA4, 0x5D, 0xF7, 0x76, 0x6F, 0x61, 0xC4, 0x39, 0x09, 0xD2, 0x07, 0x4D, 0xF9,
-    0x51, 0xF9, 0x89, 0x04, 0x73, 0xAF, 0x74, 0xCC, 0xA2, 0x93, 0xF3, 0x81, 0x11, 0x37, 0x0F, 0x8E,
-    0xC1, 0x37, 0x0E, 0xD4, 0x19, 0xC9, 0x7F, 0x65, 0x2C, 0x82, 0x33, 0xA7, 0xB7, 0x2E, 0xAB, 0x04,
-    0xFB, 0x25, 0x9D, 0x43, 0x13, 0x9A, 0xAB, 0x09, 0x0D, 0x50, 0x2E, 0xCE, 0xC9, 0xA6, 0xB7, 0x7F,
-    0x7A, 0xAE, 0x8C, 0xAB, 0x04, 0x43, 0x3D, 0x9E, 0x8A, 0x5F, 0xC1, 0x77, 0x76, 0x11, 0x49, 0xBC,
-    0x72, 0xED, 0x8E, 0x28, 0xF1, 0x80, 0x88, 0x2E, 0x7B, 0xBF, 0xD9, 0xF0, 0x13, 0x16, 0xE7, 0xA8,
-    0x0D, 0x74, 0xEC, 0x49, 0xFA, 0xFA, 0x7A, 0x7A, 0xE2, 0xC1, 0x01, 0x7F, 0xB5, 0xA1, 0x53, 0xAC,
-    0x5A, 0x56, 0xC0, 0x5D, 0xAB, 0x05, 0xD8, 0xC0, 0x9D, 0x63, 0xC0, 0x5D, 0xD2, 0xC6, 0x69, 0x70,
-    0x63, 0xAF, 0x71, 0x5A, 0x70, 0x37, 0x02, 0x77, 0x61, 0x39, 0x4B, 0xDC, 0x16, 0xDC, 0x6D, 0x81,
-    0x3B, 0x20, 0x9B, 0xF7, 0xBE, 0x6C, 0xC0, 0xDD, 0x1C, 0xDC, 0xA1, 0xE0, 0x6D, 0xFC, 0x39, 0xB8,
-    0x43, 0xFE, 0x4F, 0xA3, 0x1D, 0x70, 0xF7, 0xF7, 0x2B, 0x4B, 0x7A, 0x6F, 0x0F, 0xE5, 0x1B, 0xCD,
-    0x4F, 0x7F, 0x75, 0xD3, 0x9C, 0xA8, 0xDD, 0x90, 0x4E, 0x47, 0xFC, 0xE5, 0xCB, 0xF7, 0x7C, 0x65,
-    0x5B, 0x7C, 0x9E, 0x8E, 0xC0, 0x95, 0x20, 0x72, 0xC5, 0xF5, 0x13, 0x06, 0xF0, 0x3D, 0x81, 0x6E,
-    0x63, 0xAB, 0x0E, 0xA6, 0x23, 0x56, 0x63, 0xD9, 0x11, 0xB8, 0x3A, 0x56, 0x8A, 0xDD, 0x57, 0x5A,
-    0xEE, 0xB6, 0x2D, 0xAE, 0x62, 0xE8, 0x72, 0x37, 0x11, 0x7D, 0x98, 0x5D, 0x1E, 0x61, 0xA5, 0xFB,
-    0x4A, 0x8B, 0x09, 0xA8, 0x03, 0x4A, 0xC4, 0x4B, 0xDA, 0xE0, 0xC4, 0xE3, 0xA0, 0xFB, 0xAF, 0xBF,
-    0x6F, 0x4B, 0xE7, 0x7C, 0x16, 0xFB, 0x7A, 0xAE, 0x16, 0xEA, 0xA1, 0xA0, 0x57, 0x86, 0x66, 0xDA,
-    0x21, 0xDD, 0xD2, 0x87, 0x31, 0x61, 0xE9, 0xB6, 0xF8, 0x38, 0x42, 0xF6, 0x62, 0xB2, 0x74, 0x5A,
-    0xE6, 0x12, 0x3E, 0x6C, 0x62, 0x4B, 0x9C, 0xF5, 0x4F, 0xC2, 0xC5, 0xFB, 0x21, 0x07, 0x0E, 0x0F,
-    0x47, 0xD4, 0x2C, 0xEC, 0x83, 0x1B, 0x71, 0x9E, 0x87, 0x13, 0x17, 0xC4, 0x45, 0xED, 0x50, 0x90,
-    0x1D, 0x66, 0xCD, 0xE1, 0x89, 0xCA, 0x1D, 0x37, 0x10, 0xA1, 0xC3, 0xD7, 0x4D, 0xEF, 0x99, 0xD7,
-    0x8A, 0x12, 0x71, 0xA4, 0xC3, 0xEE, 0x6B, 0xE6, 0xFD, 0xA8, 0xB1, 0xBF, 0xB8, 0x62, 0xBC, 0xE6,
-    0xA3, 0x20, 0xD6, 0x20, 0xFA, 0xE0, 0x8A, 0x1E, 0x96, 0x3C, 0x0B, 0xB0, 0xB8, 0xC7, 0xD6, 0xA6,
-    0xA9, 0xA3, 0x66, 0x54, 0x98, 0x26, 0x7C, 0xC5, 0xD4, 0x5E, 0xB3, 0x72, 0x37, 0x2A, 0x87, 0xCF,
-    0xBB, 0xBE, 0x0D, 0x0A, 0xB0, 0x7A, 0xD9, 0x82, 0x7E, 0xE3, 0x67, 0x4B, 0x75, 0x5D, 0x56, 0xB6,
-    0xFA, 0x44, 0xA9, 0x07, 0x52, 0xDC, 0xD2, 0x9C, 0x1B, 0x54, 0xF8, 0x48, 0xC0, 0xC2, 0x07, 0x55,
-    0x7E, 0x05, 0x59, 0x7B, 0x76, 0x7A, 0x89, 0xF7, 0x6E, 0xB2, 0x3E, 0x01, 0x8D, 0xA8, 0x19, 0x9E,
-    0xD8, 0xF4, 0x43, 0x1F, 0x72, 0xF9, 0xEB, 0x34, 0xA4, 0x8E, 0x95, 0x0D, 0xD6, 0x16, 0x8D, 0xFE,
-    0x42, 0x4B, 0xE4, 0x7F, 0x01, 0xCD, 0x5B, 0x4D, 0x8C, 0x1D, 0x55, 0x76, 0x3E, 0x55, 0x95, 0xEE,
-    0x0A, 0xAE, 0x45, 0x21, 0x05, 0x4F, 0x98, 0xB1, 0x42, 0x65, 0x81, 0xA2, 0x19, 0x48, 0xA8, 0xED,
-    0x2C, 0xF0, 0xAB, 0x22, 0x48, 0x33, 0x0B, 0x16, 0xF4, 0x82, 0x36, 0x52, 0x2C, 0xC5, 0xB3, 0x40,
-    0x91, 0xC2, 0x28, 0xE9, 0xCD, 0x2C, 0xBC, 0xC0, 0xFD, 0x6A, 0x60, 0x31, 0x0B, 0x16, 0x74, 0x94,
-    0x20, 0x65, 0x37, 0x56, 0x64, 0x22, 0xF3, 0xAC, 0x04, 0x16, 0x5E, 0xA0, 0xA8, 0x5F, 0x57, 0x41,
-    0x2F, 0x58, 0xB0, 0xA0, 0x32, 0x0C, 0x42, 0x0A, 0x0B, 0x0A, 0x19, 0x8B, 0x8C, 0x67, 0xE1, 0x1A,
-    0x53, 0x0E, 0xD5, 0x4D, 0xBD, 0x77, 0xF3, 0x7D, 0xA7, 0xAA, 0xBA, 0xDF, 0x6B, 0x6C, 0xD3, 0x8D,
-    0xDB, 0x36, 0xCF, 0xAE, 0xDB, 0xF5, 0xEA, 0xE7, 0xDE, 0x7B, 0xCE, 0x3D, 0xF7, 0x9C, 0xEF, 0xFC,
-    0x3C, 0x39, 0x32, 0x7A, 0x5D, 0xC4, 0x32, 0xA6, 0x10, 0x09, 0xCC, 0x44, 0xE6, 0x3E, 0x4E, 0xC9,
-    0x36, 0x4A, 0xD0, 0x78, 0x0D, 0x4F, 0x4D, 0x8E, 0x26, 0x58, 0xE5, 0xAD, 0x6B, 0xBC, 0x37, 0x08,
-    0x62, 0xDC, 0xCA, 0x79, 0xAF, 0xF1, 0x70, 0x2F, 0x48, 0x70, 0xCF, 0x2E, 0xF9, 0x5E, 0x24, 0x61,
-    0x8C, 0x5B, 0x82, 0x7B, 0x8D, 0xF8, 0x19, 0x3A, 0x37, 0x53, 0xB1, 0x8D, 0x31, 0xA5, 0x44, 0xA3,
-    0x51, 0x1A, 0xBB, 0x85, 0x58, 0x35, 0xEF, 0xFA, 0x59, 0x90, 0x89, 0x6C, 0xD8, 0x15, 0xC7, 0x8B,
-    0x38, 0xDE, 0x4F, 0x31, 0x17, 0xAB, 0x66, 0xA7, 0x7E, 0x66, 0x8D, 0x46, 0x89, 0x67, 0x4C, 0x1C,
-    0x98, 0xA6, 0x9F, 0x95, 0x85, 0x69, 0x0E, 0xD1, 0xD9, 0xD6, 0x4F, 0x26, 0x96, 0xD8, 0x75, 0x3B,
-    0x4D, 0x8C, 0x80, 0x21, 0x17, 0x2F, 0x34, 0x78, 0xB8, 0x34, 0xAF, 0x9D, 0x7A, 0xBF, 0x90, 0x68,
-    0x28, 0x32, 0xA9, 0xC5, 0xF9, 0xB2, 0x90, 0xE0, 0x93, 0x4C, 0x4C, 0x94, 0x84, 0xCD, 0xD0, 0x5C,
-    0x2F, 0x87, 0x53, 0x37, 0x5B, 0xC0, 0xBC, 0x1F, 0x94, 0xFB, 0xD0, 0x59, 0x61, 0x63, 0x34, 0xFF,
-    0x0A, 0x7B, 0x1F, 0x1A, 0x5C, 0x95, 0xFF, 0x4C, 0xBE, 0x73, 0x4C, 0xB0, 0x13, 0x59, 0xF3, 0x62,
-    0x3F, 0x0E, 0x30, 0xCD, 0xD0, 0x64, 0xE2, 0x7D, 0xB6, 0x33, 0xBB, 0xC0, 0xE4, 0x2E, 0x16, 0xCF,
-    0xFF, 0x97, 0x95, 0xFC, 0x7E, 0x09, 0x13, 0x0E, 0xC9, 0xB1, 0x38, 0xEB, 0xE7, 0xD3, 0x2C, 0x35,
-    0xC6, 0xDF, 0x5E, 0x6E, 0xA6, 0x60, 0x42, 0x29, 0xFE, 0x27, 0x89, 0x44, 0xAB, 0x62, 0x4D, 0x30,
-    0x95, 0x2F, 0x6A, 0xDB, 0xBC, 0x6B, 0xCC, 0x29, 0xD7, 0x14, 0x2F, 0xC8, 0x33, 0x4A, 0xA0, 0xD2,
-    0x5A, 0xB3, 0x4D, 0x33, 0x8E, 0x4A, 0x59, 0xB0, 0xC0, 0x3B, 0xDC, 0x0A, 0x79, 0xEB, 0x53, 0xCC,
-    0x4D, 0xC6, 0xE4, 0xB3, 0x9F, 0x8D, 0x39, 0x37, 0x4C, 0x5E, 0x42, 0xBE, 0xE7, 0x94, 0x9C, 0xF7,
-    0x98, 0x04, 0xE2, 0x7F, 0x43, 0x69, 0x82, 0x38, 0x85, 0x68, 0xC5, 0xD9, 0x1E, 0x5D, 0xA8, 0x64,
-    0x95, 0x4C, 0xE1, 0x9B, 0x8D, 0x85, 0xA9, 0x79, 0x05, 0x98, 0x22, 0x11, 0xF9, 0xE3, 0x54, 0x64,
-    0x63, 0xF0, 0x4A, 0xD6, 0x4E, 0x1A, 0xA7, 0x3A, 0x0B, 0x7E, 0x15, 0x0E, 0x27, 0xBE, 0xEC, 0x9E,
-    0xFE, 0x2F, 0xDB, 0x21, 0x99, 0x2F, 0x4B, 0x7A, 0x19, 0xEB, 0x45, 0xDA, 0x9D, 0xCB, 0xC7, 0xAA,
-    0x56, 0x10, 0xB4, 0x8F, 0xF6, 0x80, 0x24, 0x80, 0xCF, 0x0D, 0xA9, 0xC7, 0xD2, 0x35, 0x10, 0x85,
-    0x66, 0x55, 0x0F, 0x0B, 0xE7, 0x4E, 0x43, 0x59, 0x80, 0xB8, 0xBF, 0xA0, 0xF4, 0x1F, 0x95, 0xB7,
-    0xB0, 0x60, 0xA0, 0xC6, 0xC5, 0xC0, 0x5E, 0x77, 0xB8, 0xDB, 0xB8, 0x66, 0xD0, 0xD7, 0x03, 0x38,
-    0x5E, 0xE7, 0xE2, 0x73, 0xAD, 0xA3, 0x98, 0x93, 0xE6, 0x44, 0xE3, 0x7E, 0x5E, 0xFD, 0xC7, 0x36,
-    0xD3, 0x58, 0xC0, 0xF0, 0x2C, 0x98, 0x8E, 0x26, 0x02, 0x51, 0xFA, 0x99, 0xCF, 0x37, 0x52, 0xE9,
-    0xDF, 0x20, 0x55, 0x1B, 0xFD, 0x37, 0x3F, 0xEF, 0x79, 0xDE, 0xCC, 0x5D, 0xE2, 0x12, 0xCA, 0x90,
-    0xD7, 0xC9, 0x7F, 0x87, 0x37, 0x5D, 0x52, 0xE6, 0x69, 0x33, 0x5D, 0x5E, 0x11, 0x08, 0x78, 0x43,
-    0x19, 0xC2, 0x7C, 0x8F, 0x72, 0x12, 0x47, 0x12, 0xB1, 0x1B, 0x7D, 0x07, 0x1C, 0xB6, 0x31, 0xE4,
-    0x8F, 0x67, 0x84, 0x63, 0x2D, 0x30, 0x53, 0x67, 0xFA, 0x37, 0xF9, 0x54, 0xC7, 0xE7, 0x32, 0x45,
-    0xAD, 0x44, 0xEF, 0xF9, 0x13, 0x0B, 0x57, 0xC6, 0x2F, 0xC8, 0xE0, 0xBF, 0xA5, 0x36, 0xB0, 0xA9,
-    0x0B, 0xC8, 0xE6, 0x47, 0xA4, 0xE3, 0x43, 0x30, 0xE5, 0x64, 0xB1, 0xF2, 0x7E, 0x82, 0xE6, 0xA2,
-    0xBC, 0x70, 0xEF, 0x69, 0xB7, 0xCF, 0xA2, 0x9F, 0x02, 0x17, 0x72, 0xC8, 0x50, 0x6E, 0xD5, 0x5E,
-    0xE6, 0xC7, 0x6E, 0x32, 0x43, 0x3D, 0xC4, 0x23, 0x89, 0x2E, 0xFF, 0x07, 0xC5, 0x9A, 0x53, 0x18,
-    0xCF, 0xEA, 0x8A, 0x7E, 0x9B, 0xB4, 0x5F, 0xE3, 0x76, 0xE4, 0x29, 0xD5, 0xCB, 0x13, 0xA7, 0x55,
-    0x1F, 0xA6, 0xA0, 0x63, 0x81, 0x1D, 0xDD, 0x37, 0x37, 0x55, 0x2F, 0x93, 0xBD, 0x9F, 0xD4, 0xAC,
-    0x51, 0xDC, 0x4B, 0xD7, 0x60, 0x4F, 0x47, 0xB9, 0x3C, 0xA8, 0x73, 0x0F, 0xB3, 0x8E, 0x12, 0xB7,
-    0xEC, 0x89, 0x9B, 0xEC, 0xD0, 0x9B, 0xF5, 0x2C, 0xD8, 0xB9, 0xE4, 0x15, 0x3D, 0xA3, 0x38, 0x19,
-    0x21, 0xCB, 0x2D, 0xB2, 0xDC, 0xD6, 0xC6, 0xBC, 0x7A, 0x32, 0xA3, 0xE2, 0xE0, 0x60, 0xA0, 0x66,
-    0x01, 0x4B, 0x63, 0x25, 0xB3, 0xCB, 0xB8, 0xFB, 0xB1, 0xCC, 0x16, 0xE7, 0x0F, 0xBA, 0xB1, 0x9E,
-    0x5C, 0x56, 0x6C, 0xB7, 0x1B, 0x2C, 0x79, 0x3B, 0x2C, 0x07, 0xC4, 0x00, 0xEE, 0x64, 0xA1, 0x80,
-    0xA8, 0x80, 0x8A, 0x9C, 0x34, 0xFF, 0x50, 0x8E, 0x88, 0x9C, 0x11, 0x0C, 0xB4, 0x1A, 0x60, 0x94,
-    0x8D, 0xA6, 0xD7, 0x0A, 0x93, 0x7B, 0x2F, 0xF1, 0x50, 0x86, 0x67, 0xBD, 0x3C, 0x48, 0xBC, 0xDF,
-    0xD4, 0xE2, 0x5F, 0x4D, 0xC4, 0x6F, 0xBA, 0x91, 0x0E, 0x75, 0xD5, 0xAD, 0x35, 0x79, 0x4E, 0xA4,
-    0xE6, 0x7E, 0x8A, 0xF8, 0x68, 0xC0, 0xF5, 0x70, 0x39, 0x43, 0x55, 0x34, 0x33, 0x4B, 0xFF, 0x3B,
-    0xAC, 0x15, 0x5F, 0x44, 0x33, 0x11, 0xCE, 0x33, 0x26, 0xCB, 0x69, 0x0E, 0xBC, 0x92, 0x63, 0x55,
-    0x0D, 0xDF, 0x41, 0x63, 0x35, 0xAA, 0x9A, 0x76, 0x9A, 0xC9, 0x4E, 0xB3, 0x73, 0x4D, 0x1F, 0xD1,
-    0x87, 0xF5, 0x35, 0x9F, 0x1D, 0x84, 0x19, 0x35, 0x6A, 0x3C, 0x1D, 0xA5, 0x93, 0x7E, 0xA0, 0x2D,
-    0x1D, 0x7A, 0xC1, 0xA2, 0x10, 0xD4, 0xA4, 0x29, 0xF8, 0x55, 0xCE, 0x53, 0x6E, 0xC9, 0xE0, 0xE5,
-    0x98, 0xA7, 0x5C, 0x08, 0x2E, 0x1D, 0xED, 0x8B, 0x84, 0x13, 0x3F, 0xC1, 0xD2, 0x36, 0xB5, 0xB8,
-    0x5B, 0xCF, 0x9A, 0x04, 0xF4, 0x82, 0xB9, 0x60, 0x4D, 0x94, 0x60, 0x19, 0x40, 0x4F, 0xC4, 0x67,
-    0xC1, 0x14, 0x6B, 0xF7, 0x54, 0xE6, 0xAF, 0xC6, 0x58, 0x26, 0x3C, 0x08, 0x96, 0x62, 0xCD, 0xD2,
-    0x04, 0xFF, 0x57, 0x6A, 0x2E, 0xC9, 0xFB, 0x89, 0x40, 0x85, 0x62, 0x08, 0x8B, 0x32, 0xEB, 0x9A,
-    0xE9, 0x1A, 0x59, 0x82, 0x49, 0x62, 0xCD, 0x20, 0x4A, 0x63, 0xB2, 0x03, 0xF6, 0x0F, 0x0A, 0x8A,
-    0x8A, 0xA3, 0xA4, 0x79, 0x8C, 0xE2, 0x31, 0x69, 0x54, 0x4B, 0x49, 0x43, 0x02, 0xA3, 0x49, 0x0B,
-    0xFC, 0x3E, 0x9F, 0x9F, 0x90, 0x87, 0xFE, 0xFF, 0x98, 0x51, 0xD2, 0x9A, 0xD2, 0xD6, 0xD2, 0xE8,
-    0x69, 0x48, 0xAD, 0xE3, 0x54, 0x3C, 0x35, 0xEC, 0x2C, 0xCC, 0x70, 0x1A, 0x54, 0x92, 0x92, 0x2F,
-    0x1E, 0xED, 0x2A, 0x06, 0xEE, 0x18, 0x23, 0x3D, 0xF1, 0x68, 0xAC, 0xE5, 0x95, 0xDF, 0x62, 0x62,
-    0x90, 0x20, 0x6D, 0x76, 0x6F, 0x84, 0x93, 0x20, 0xC1, 0x8A, 0xBF, 0x92, 0xB8, 0x93, 0x93, 0x26,
-    0xC1, 0x56, 0x31, 0x89, 0xB2, 0x44, 0x69, 0x55, 0xDA, 0xE7, 0x1A, 0x7F, 0xF6, 0x2B, 0x1F, 0x81,
-    0xDC, 0x46, 0x89, 0x72, 0xC3, 0xAB, 0x17, 0x4D, 0xD2, 0x32, 0x63, 0x38, 0x05, 0xA7, 0xC9, 0x8B,
-    0xC5, 0xD1, 0x08, 0x0B, 0x55, 0x7A, 0xDC, 0xB1, 0xFA, 0xC1, 0x19, 0xA8, 0x33, 0x57, 0xF1, 0xA7,
-    0x69, 0xA5, 0xEF, 0xEB, 0x7F, 0xB6, 0x47, 0xE7, 0xF1, 0x08, 0x38, 0xD1, 0xDC, 0xF4, 0x11, 0x6E,
-    0xD7, 0xD1, 0xE8, 0xD7, 0xA0, 0x97, 0xB2, 0x40, 0x74, 0x04, 0x33, 0x58, 0xCD, 0x43, 0x37, 0x0F,
-    0xEA, 0xC8, 0x07, 0x43, 0xFC, 0xCF, 0x56, 0x0A, 0x4C, 0xB0, 0x81, 0xA1, 0x0E, 0x5F, 0xAC, 0x20,
-    0xF5, 0x84, 0x21, 0xC4, 0x1D, 0x3E, 0xDE, 0xDD, 0xDC, 0x1E, 0x8D, 0xCE, 0x36, 0xDD, 0x96, 0xE4,
-    0x46, 0xB4, 0x9A, 0x0E, 0xE6, 0xB8, 0x93, 0x27, 0xFE, 0x01, 0x9D, 0x9A, 0x18, 0x24, 0xC1, 0x2E,
-    0x2C, 0x41, 0x17, 0x2C, 0x4A, 0x29, 0xA5, 0x7B, 0x65, 0x43, 0xD1, 0xC7, 0xCA, 0xDA, 0x1D, 0x25,
-    0x09, 0x58, 0x07, 0xF6, 0xF8, 0xA2, 0x62, 0x32, 0x8B, 0x2B, 0x76, 0xE4, 0xB3, 0xD9, 0xFD, 0xB6,
-    0xC5, 0xED, 0x56, 0xC8, 0xF4, 0x27, 0x53, 0xE8, 0x0B, 0x3F, 0x5B, 0x85, 0x28, 0x41, 0xBF, 0x71,
-    0x8F, 0xFA, 0x20, 0xE9, 0x42, 0x89, 0x3E, 0x48, 0xE3, 0x88, 0xDD, 0x2A, 0x74, 0x9B, 0x74, 0x9A,
-    0x48, 0xB1, 0xCD, 0xF0, 0xB7, 0xDF, 0x23, 0x5E, 0xAA, 0x40, 0x08, 0x14, 0xD0, 0x51, 0x5C, 0x59,
-    0xEC, 0xB6, 0x48, 0x36, 0x6F, 0xCE, 0xEF, 0x08, 0x6D, 0x22, 0x49, 0xA7, 0xFE, 0xA2, 0xDE, 0x06,
-    0xC8, 0x1D, 0xA4, 0x0D, 0x1B, 0xF1, 0x93, 0x76, 0xE4, 0x4F, 0x6E, 0x36, 0x39, 0x33, 0x1A, 0xBD,
-    0x82, 0x4E, 0x49, 0xC6, 0xCD, 0x1E, 0xE1, 0x9F, 0x2B, 0xA3, 0xD7, 0x5B, 0x66, 0x4C, 0x15, 0xA2,
-    0x11, 0xA0, 0x01, 0x32, 0xF9, 0xB1, 0xF2, 0xCC, 0xFF, 0x5D, 0x0B, 0xCB, 0x96, 0x0E, 0x5B, 0xF8,
-    0x32, 0xB1, 0x4E, 0x26, 0x2D, 0x2A, 0x73, 0xF8, 0x0C, 0x29, 0x7E, 0xA1, 0x43, 0x82, 0x0A, 0x49,
-    0x16, 0x60, 0x9A, 0x17, 0xE3, 0xC6, 0xAE, 0x9C, 0x12, 0xE8, 0x13, 0xC2, 0x3A, 0x54, 0x3C, 0xBD,
-    0xA3, 0x9A, 0x0F, 0x9F, 0x7C, 0x1A, 0x1F, 0x19, 0x63, 0x0C, 0xEF, 0xBF, 0x31, 0xCE, 0x06, 0x0E,
-    0xBF, 0xC7, 0x9C, 0xFD, 0x27, 0x84, 0x51, 0x8C, 0x60, 0xA3, 0xA3, 0x7F, 0x4A, 0xA1, 0x28, 0x9C,
-    0x12, 0xAA, 0x66, 0x03, 0xAA, 0xCA, 0xDF, 0x2C, 0xC1, 0x04, 0x08, 0x43, 0x13, 0xA1, 0x2F, 0x74,
-    0x39, 0x7A, 0xA9, 0xEC, 0x85, 0x21, 0xEE, 0x30, 0x02, 0x2D, 0x7D, 0x70, 0x7D, 0xE1, 0xA2, 0x45,
-    0x35, 0xE8, 0x71, 0x4B, 0x2F, 0x74, 0x08, 0x0F, 0xDD, 0x12, 0x1E, 0xA4, 0x15, 0xA5, 0x15, 0xD7,
-    0x5D, 0x62, 0x68, 0x80, 0x9D, 0x59, 0x11, 0xB2, 0x08, 0x43, 0x02, 0xBE, 0x6A, 0xB6, 0x2F, 0x34,
-    0x0E, 0x3A, 0x7B, 0xD8, 0xDF, 0x31, 0xC3, 0xD1, 0x8E, 0x95, 0xDD, 0xE8, 0x4D, 0x6D, 0xDB, 0x60,
-    0x02, 0xA3, 0xD7, 0x15, 0xB3, 0x6B, 0xC3, 0x6B, 0x43, 0x3E, 0x42, 0xEF, 0x49, 0x22, 0x4E, 0x2D,
-    0xE2, 0xDE, 0x88, 0x88, 0x0D, 0x23, 0x17, 0x4F, 0x47, 0xB6, 0xB9, 0x7C, 0xC2, 0x70, 0x8D, 0x0C,
-    0x55, 0xEA, 0x67, 0x1D, 0x18, 0x39, 0x47, 0x1B, 0x4A, 0xDC, 0x52, 0x76, 0x50, 0x1B, 0x0B, 0x7F,
-    0x5A, 0xFE, 0x6A, 0x86, 0x2F, 0x13, 0x2F, 0x19, 0x9A, 0x2F, 0x8A, 0xE1, 0x87, 0x69, 0x0D, 0xC3,
-    0x33, 0xA5, 0xB2, 0x7D, 0x39, 0x17, 0xEF, 0x52, 0xD9, 0xFA, 0x39, 0xAB, 0x54, 0xB2, 0xF0, 0x04,
-    0x9C, 0x4B, 0xB4, 0x3E, 0x7A, 0x21, 0x86, 0x35, 0x2B, 0x80, 0x4A, 0x27, 0x40, 0x04, 0x61, 0x71,
-    0x6C, 0x0A, 0x99, 0xF8, 0x24, 0x09, 0xCC, 0x4B, 0x05, 0x40, 0x39, 0x97, 0x99, 0xCE, 0x03, 0x7D,
-    0x09, 0x3F, 0x5B, 0x82, 0x71, 0x89, 0x5E, 0x5B, 0xA1, 0xBE, 0x2D, 0x65, 0x05, 0x7C, 0xC0, 0xBE,
-    0xB6, 0xE1, 0x7A, 0x25, 0x1E, 0xB0, 0xCF, 0x76, 0x2A, 0xAD, 0x26, 0x91, 0x47, 0xD7, 0xE4, 0xBB,
-    0xC2, 0xB0, 0x35, 0x08, 0xD2, 0xE3, 0x10, 0x67, 0xEF, 0x0A, 0x7A, 0xE0, 0xBE, 0x5A, 0x9C, 0xC5,
-    0x15, 0x69, 0xF5, 0x18, 0xFA, 0x7E, 0xFF, 0x97, 0xE6, 0x84, 0x29, 0xB0, 0x97, 0x6A, 0xF4, 0x3D,
-    0x05, 0xA5, 0x21, 0xF8, 0xE3, 0xF6, 0x0C, 0x1B, 0xCC, 0x30, 0x4C, 0x85, 0x62, 0x95, 0x26, 0xE9,
-    0x25, 0x18, 0x83, 0x82, 0xE6, 0x19, 0xAC, 0x58, 0x6D, 0xED, 0xD1, 0x92, 0x53, 0xB4, 0x4A, 0x8E,
-    0x76, 0x53, 0x22, 0x98, 0xA7, 0x28, 0x9B, 0xBE, 0x9A, 0x66, 0x80, 0xAC, 0x99, 0x95, 0x4E, 0x29,
-    0x62, 0xB6, 0xF4, 0x0A, 0x69, 0xB7, 0x99, 0xFF, 0xDC, 0x53, 0x66, 0xA9, 0x6E, 0x19, 0xF7, 0x2A,
-    0x22, 0xDF, 0xAB, 0x37, 0xEF, 0x32, 0xB3, 0xEE, 0x3D, 0x3B, 0xF4, 0xA3, 0x7C, 0x50, 0x6F, 0xC4,
-    0x4F, 0x7A, 0x57, 0x59, 0xF7, 0x1B, 0x3D, 0x56, 0x79, 0xB0, 0xF3, 0xA6, 0xA9, 0xA4, 0xDD, 0xDE,
-    0x5E, 0xCC, 0x8A, 0xD8, 0x5D, 0xDE, 0x8F, 0x72, 0x9E, 0x93, 0xA9, 0x3B, 0x25, 0xC6, 0x51, 0xE4,
-    0x0C, 0xE6, 0xE4, 0xE4, 0x74, 0xBC, 0xFB, 0xCF, 0x3A, 0x43, 0x0E, 0xB8, 0xE3, 0x51, 0x63, 0x87,
-    0x64, 0xCA, 0x98, 0x80, 0xF8, 0xA6, 0x97, 0x60, 0x46, 0x52, 0xF2, 0x86, 0xA6, 0xDA, 0x1C, 0xE4,
-    0xC5, 0x9D, 0x4B, 0xF2, 0x23, 0x0D, 0xE9, 0xD0, 0x99, 0x64, 0x5C, 0x47, 0xE7, 0x15, 0x10, 0xC1,
-    0x3F, 0x2E, 0x8F, 0xF5, 0xB3, 0x3A, 0xBA, 0x13, 0x1F, 0xF9, 0x86, 0xC6, 0x03, 0xB6, 0x1E, 0x10,
-    0x8E, 0x45, 0x5B, 0xCF, 0x36, 0x02, 0x47, 0x70, 0x42, 0x51, 0x58, 0xE5, 0xDD, 0xE8, 0x76, 0x1A,
-    0x7A, 0x21, 0xAE, 0x46, 0x91, 0xE0, 0xC1, 0x47, 0xD2, 0xC5, 0x5A, 0xC0, 0x6A, 0xA3, 0x9F, 0x54,
-    0xDB, 0x2B, 0x29, 0x90, 0x81, 0x39, 0xD7, 0xDE, 0xE0, 0x6A, 0x7B, 0x3B, 0x6F, 0xC0, 0xD8, 0x00,
-    0x4F, 0xF0, 0xA1, 0xD8, 0x31, 0x0A, 0xCC, 0xBF, 0xDE, 0xD5, 0xFC, 0x1B, 0xFB, 0xB9, 0x41, 0xF7,
-    0x43, 0x2F, 0xF0, 0x09, 0x6B, 0xB8, 0xFC, 0x8C, 0xFA, 0x82, 0x58, 0xF1, 0xBA, 0x15, 0xB6, 0xF6,
-    0xD6, 0xF7, 0x96, 0x64, 0x10, 0x98, 0xC2, 0xF9, 0x3D, 0x9D, 0xB2, 0xCA, 0x6E, 0xE0, 0xE0, 0x79,
-    0x05, 0x24, 0x89, 0xF1, 0x1F, 0x0D, 0x75, 0x1D, 0xEC, 0xC4, 0x8A, 0xAD, 0x27, 0x8D, 0x5C, 0x32,
-    0xDB, 0x55, 0x39, 0xAC, 0x7F, 0x41, 0xAB, 0xD3, 0x0A, 0xB3, 0x29, 0x3C, 0xEC, 0xA9, 0xE0, 0x33,
-    0x1D, 0xBA, 0xD1, 0xC1, 0x31, 0xCB, 0x03, 0x7E, 0x21, 0xE8, 0x00, 0x11, 0x99, 0x15, 0xDB, 0xEE,
-    0xD4, 0xDE, 0x34, 0xDB, 0xD7, 0xF2, 0x61, 0xF5, 0xA6, 0xDD, 0x0F, 0x42, 0x19, 0xFF, 0x56, 0xFD,
-    0x8A, 0x3C, 0x32, 0x7A, 0xCD, 0x98, 0xCF, 0x8D, 0x89, 0x3B, 0x64, 0xF2, 0x22, 0x06, 0x1A, 0xAE,
-    0xE1, 0x26, 0x1E, 0xC1, 0x83, 0x91, 0xEC, 0xF7, 0x34, 0x07, 0x99, 0xA1, 0x29, 0x9F, 0x1F, 0xFD,
-    0x9B, 0x31, 0xEF, 0xF5, 0xCE, 0x05, 0x54, 0xD6, 0x81, 0x3A, 0xC9, 0xE4, 0x67, 0xF2, 0xA3, 0xC2,
-    0xBA, 0xB4, 0x9D, 0x3A, 0xA6, 0xB2, 0xFF, 0xAB, 0x47, 0xBC, 0x35, 0x3A, 0x76, 0xB7, 0x0E, 0xDA,
-    0x55, 0x44, 0xDD, 0x96, 0x9A, 0x77, 0x30, 0x99, 0xB3, 0xF2, 0x77, 0xB9, 0xF3, 0xEE, 0x95, 0xD4,
-    0x33, 0xE5, 0xE2, 0x56, 0xC7, 0xB3, 0x81, 0x1C, 0x90, 0xCA, 0xD4, 0xBC, 0x61, 0xCA, 0xE1, 0x9A,
-    0x9F, 0xE1, 0x1A, 0x36, 0x91, 0x7C, 0xD3, 0xC9, 0xC4, 0x23, 0xC6, 0xC3, 0x6E, 0x7D, 0x0C, 0x2A,
-    0xD0, 0xCB, 0xB0, 0x57, 0x86, 0x67, 0xBD, 0x46, 0x1E, 0xB0, 0xE0, 0xCE, 0x0D, 0x7B, 0x8D, 0x57,
-    0x3B, 0xA5, 0x9F, 0x45, 0xD2, 0xDC, 0xE4, 0x4F, 0x20, 0xA5, 0x97, 0x1C, 0x97, 0xCA, 0xD9, 0xFE,
-    0xE9, 0x04, 0x1A, 0x7F, 0x8D, 0x1B, 0x37, 0xEE, 0x03, 0x3D, 0xB6, 0x99, 0xA6, 0xE6, 0xED, 0x69,
-    0xFC, 0xCD, 0x53, 0xE9, 0x4E, 0xAA, 0xD0, 0x7C, 0x65, 0x9A, 0x41, 0xB4, 0xF7, 0x93, 0x9A, 0x24,
-    0x5C, 0x81, 0x4F, 0x98, 0x0F, 0xD7, 0xEC, 0x0A, 0xE4, 0x8E, 0xF1, 0x4A, 0x08, 0x5D, 0xE3, 0xE5,
-    0x91, 0xDC, 0xDE, 0x05, 0xA0, 0xC5, 0x8F, 0x4D, 0x63, 0xFF, 0x9F, 0x51, 0xD7, 0xB8, 0xD3, 0xC1,
-    0x0A, 0x2A, 0xAD, 0x93, 0x75, 0x8B, 0x7D, 0x86, 0xAD, 0x93, 0xFE, 0xA0, 0x2C, 0x04, 0x99, 0xF7,
-    0x51, 0xE9, 0xD4, 0xB5, 0x9C, 0xD9, 0x55, 0xBC, 0xF8, 0x12, 0x49, 0xF8, 0x74, 0xE6, 0x7D, 0x50,
-    0xDA, 0x15, 0x9C, 0xF5, 0xFD, 0x7F, 0xD1, 0xF8, 0x76, 0x1B, 0xFF, 0xE5, 0x17, 0x3F, 0xB3, 0x57,
-    0x4A, 0x82, 0xC0, 0xA8, 0x68, 0x43, 0x93, 0xB0, 0x8C, 0x43, 0x58, 0xD9, 0x97, 0x73, 0x07, 0x90,
-    0x75, 0x26, 0x6A, 0xE8, 0xDD, 0x0A, 0x70, 0xDF, 0xDE, 0x9F, 0x30, 0x59, 0x38, 0x59, 0x4A, 0x3A,
-    0x85, 0x48, 0x77, 0x11, 0xBC, 0x1F, 0x51, 0xC5, 0x43, 0xC1, 0x43, 0xBD, 0x43, 0xB9, 0xEF, 0xAA,
-    0xF6, 0x81, 0xB4, 0x4A, 0xF6, 0x5B, 0xFE, 0x1F, 0xD0, 0xC0, 0xFF, 0x7B, 0x23, 0xD0, 0x78, 0x69,
-    0x4E, 0xE3, 0xC5, 0x48, 0xB6, 0x0B, 0x4F, 0xC7, 0x6A, 0x28, 0xCD, 0x58, 0x27, 0x3F, 0xA7, 0x3C,
-    0x60, 0x52, 0xC0, 0x25, 0x59, 0x98, 0x68, 0xAC, 0xC3, 0x7F, 0x87, 0xAE, 0x10, 0xE3, 0xB5, 0x57,
-    0x6B, 0x3A, 0x7C, 0xF0, 0x0D, 0x6A, 0x20, 0xD4, 0x29, 0x83, 0x2B, 0x19, 0x5D, 0x26, 0x40, 0x07,
-    0xB0, 0xB1, 0x61, 0xCA, 0xA0, 0x40, 0x3F, 0x43, 0xF4, 0x63, 0xB3, 0x43, 0x0D, 0x07, 0x45, 0x18,
-    0xC2, 0x9A, 0xEC, 0x49, 0x4F, 0x0C, 0x7A, 0x38, 0xF0, 0x56, 0x0F, 0x04, 0xE2, 0x16, 0x06, 0x0C,
-    0x6E, 0x79, 0xD8, 0xF5, 0x00, 0xCA, 0x78, 0x00, 0x86, 0x0D, 0x24, 0x95, 0x01, 0x86, 0x1C, 0x78,
-    0x25, 0xD4, 0x75, 0x06, 0x2B, 0x86, 0xFB, 0x86, 0x8E, 0x0C, 0x51, 0x01, 0x56, 0x13, 0x93, 0x1B,
-    0x60, 0x57, 0x0C, 0x30, 0x37, 0x3C, 0x9F, 0x0D, 0x30, 0xB5, 0x81, 0x38, 0xD5, 0xA0, 0xF5, 0xDC,
-    0xDA, 0x8F, 0xE6, 0x06, 0x92, 0x16, 0x76, 0x90, 0xC3, 0x8F, 0xE3, 0xB8, 0x9F, 0x8C, 0xB2, 0xEB,
-    0x48, 0x3C, 0xA8, 0xEF, 0x10, 0xBB, 0x6D, 0x08, 0x1D, 0x8E, 0xDD, 0x05, 0xA6, 0x10, 0xE5, 0x44,
-    0xB0, 0x8F, 0x51, 0x8A, 0x03, 0x5C, 0x88, 0x3E, 0xC2, 0x38, 0x7F, 0xCD, 0xB8, 0x13, 0xEE, 0xF3,
-    0x39, 0x7D, 0xDE, 0x2F, 0x22, 0x8C, 0x13, 0x71, 0x9C, 0xD7, 0xDB, 0x20, 0x3C, 0x8C, 0x87, 0x46,
-    0x2E, 0xE3, 0x39, 0x8F, 0x3D, 0xDC, 0x13, 0xDA, 0xBB, 0xCD, 0xAF, 0xF0, 0x0C, 0xFF, 0x19, 0x96,
-    0xF2, 0x15, 0xBA, 0xBC, 0xE7, 0x9D, 0xDA, 0x55, 0x4D, 0x71, 0x5A, 0xC1, 0x40, 0x74, 0xE0, 0x7F,
-    0xEB, 0x87, 0x26, 0xE0, 0xDB, 0x33, 0x8E, 0xF8, 0x2E, 0xD3, 0x6B, 0xE5, 0x06, 0x81, 0x14, 0x58,
-    0x6E, 0x61, 0x8E, 0x70, 0x36, 0x9B, 0xE8, 0xE6, 0x0D, 0xCD, 0xF7, 0x53, 0x9B, 0x9F, 0x96, 0x17,
-    0x1F, 0xC0, 0xD4, 0x5C, 0x80, 0xA1, 0x33, 0xD0, 0x28, 0xF0, 0x80, 0xB1, 0xA5, 0x7D, 0xDC, 0x4C,
-    0x6E, 0x73, 0x6A, 0x47, 0xAD, 0x27, 0x39, 0xCA, 0x4B, 0x65, 0x19, 0x3D, 0xE4, 0x5C, 0x03, 0xDF,
-    0xC0, 0xD8, 0x03, 0x35, 0xFB, 0xE2, 0xD7, 0xC3, 0xDC, 0x2C, 0x8D, 0x4C, 0xFC, 0xCC, 0xCB, 0xF6,
-    0x33, 0xA9, 0x9B, 0x2A, 0xED, 0x87, 0xA3, 0xE8, 0xE9, 0xF7, 0x3F, 0xB8, 0x56, 0xDE, 0x4C, 0x9F,
-    0x6B, 0x52, 0x65, 0x2E, 0x6A, 0xE3, 0xDC, 0xF8, 0x02, 0x7C, 0xCD, 0xE8, 0x14, 0x0C, 0x99, 0x29,
-    0xC4, 0x01, 0x12, 0xB4, 0xB1, 0x7F, 0x1C, 0x75, 0x89, 0xF1, 0xC4, 0x9F, 0xDC, 0xF0, 0x15, 0x48,
-    0xD9, 0x5A, 0x04, 0xC0, 0xE4, 0x73, 0x41, 0x97, 0x24, 0x48, 0xE0, 0x78, 0xDC, 0xA0, 0x89, 0x83,
-    0xB1, 0x65, 0x8A, 0xA0, 0xF2, 0x6A, 0xF4, 0x1B, 0xD6, 0x37, 0x79, 0x0E, 0x96, 0xEA, 0x5C, 0x9F,
-    0xA7, 0x6A, 0x83, 0xED, 0x44, 0x1B, 0x67, 0x64, 0x6F, 0xA2, 0x8A, 0x0E, 0xC7, 0x3A, 0xE6, 0x87,
-    0x26, 0x63, 0x53, 0xB2, 0xC1, 0x13, 0xEB, 0x8C, 0x74, 0xAD, 0x37, 0x29, 0x1B, 0xBC, 0xBA, 0xDE,
-    0x40, 0x0F, 0xAC, 0x53, 0x61, 0xAD, 0x37, 0xD8, 0x6F, 0xEB, 0xCC, 0xDD, 0xAD, 0x53, 0x91, 0xA1,
-    0x89, 0x62, 0x34, 0x61, 0xB6, 0x4E, 0x0D, 0xB5, 0x4E, 0xEB, 0xBD, 0x4E, 0x15, 0x85, 0x46, 0x26,
-    0x6C, 0x86, 0x6C, 0x42, 0x8D, 0x8A, 0xB1, 0x71, 0x35, 0xAA, 0xDD, 0xB4, 0x81, 0x0C, 0xFA, 0x46,
-    0xC3, 0xDD, 0xFD, 0xB6, 0x9B, 0xAE, 0x91, 0xC7, 0x01, 0x9F, 0x8F, 0x03, 0x3D, 0x13, 0x3C, 0x03,
-    0x3B, 0x4F, 0x09, 0x9D, 0xA9, 0x67, 0x0F, 0x7A, 0xDC, 0x3B, 0xFA, 0x76, 0x3F, 0xD4, 0xAF, 0x2D,
-    0xEB, 0xD7, 0x7B, 0xFE, 0x6B, 0xF8, 0x4A, 0xE2, 0xC3, 0xA5, 0x75, 0x37, 0x17, 0x53, 0x89, 0xCA,
-    0xA9, 0xD3, 0xA7, 0x31, 0xE3, 0x36, 0x0E, 0x7E, 0x56, 0x7E, 0xD8, 0x65, 0x72, 0x82, 0x5F, 0xE1,
-    0x96, 0x77, 0x35, 0xEB, 0x62, 0x67, 0xF3, 0xA9, 0x9C, 0x7B, 0xC5, 0x33, 0x3B, 0xB6, 0xD6, 0x6C,
-    0xA6, 0x05, 0x1A, 0x06, 0x3A, 0x27, 0xAD, 0x87, 0xE8, 0x16, 0x87, 0x2E, 0x13, 0xEA, 0x96, 0xEB,
-    0xCE, 0xB0, 0xAB, 0x3E, 0x05, 0xD5, 0x72, 0x4F, 0x13, 0xB9, 0xDE, 0x3B, 0xC5, 0x70, 0x62, 0x17,
-    0x8D, 0x31, 0xC5, 0x52, 0x34, 0x39, 0x31, 0xE1, 0x34, 0xC2, 0xCC, 0x51, 0x5C, 0x3A, 0xE5, 0xD3,
-    0x8C, 0xF8, 0x73, 0xDB, 0x7A, 0x54, 0x0B, 0x36, 0x35, 0x03, 0x16, 0x36, 0x92, 0x7D, 0x5E, 0xBC,
-    0x21, 0x77, 0xEB, 0x3D, 0xDC, 0x4D, 0x76, 0xB8, 0x5B, 0x92, 0xBB, 0x35, 0x79, 0xAA, 0xDC, 0x4D,
-    0x95, 0xBB, 0x09, 0x19, 0x4B, 0xEE, 0xBA, 0x64, 0xAC, 0x53, 0x93, 0x9D, 0xCD, 0x0E, 0x63, 0xA3,
-    0xBD, 0x8C, 0xDD, 0x89, 0x4A, 0xAE, 0xF7, 0xE4, 0x32, 0xA6, 0xB1, 0x70, 0x92, 0xBE, 0x37, 0x03,
-    0xD1, 0x9E, 0xBA, 0x22, 0x4B, 0x3D, 0x93, 0xD7, 0xF6, 0x30, 0x79, 0xF8, 0x2D, 0x85, 0x71, 0xEF,
-    0xB1, 0x2A, 0xF2, 0x17, 0x13, 0x4E, 0x4F, 0x13, 0xB5, 0x47, 0x46, 0x23, 0x2A, 0x3D, 0xD2, 0xBF,
-    0x9B, 0x18, 0xE9, 0x3E, 0x1A, 0x24, 0x18, 0x12, 0x0D, 0x85, 0xD3, 0x93, 0x26, 0x71, 0x6B, 0xB1,
-    0x27, 0x9A, 0x99, 0x2C, 0x19, 0x11, 0x09, 0xDB, 0x60, 0x29, 0x15, 0x87, 0xFF, 0x31, 0xC5, 0x63,
-    0x43, 0x13, 0xAB, 0x5A, 0x8A, 0x11, 0x69, 0x3E, 0xD1, 0x68, 0xE0, 0x45, 0x53, 0x88, 0x7A, 0x55,
-    0xE3, 0x2A, 0xDE, 0xE7, 0x1A, 0x25, 0x57, 0x9D, 0xBB, 0x59, 0x33, 0xED, 0x14, 0xE4, 0x54, 0x3F,
-    0x40, 0x1C, 0x41, 0x61, 0x9B, 0x57, 0x57, 0xEA, 0x2E, 0x75, 0xE4, 0xB5, 0x06, 0x95, 0xFC, 0x78,
-    0x7E, 0x74, 0x96, 0xBE, 0x32, 0xBD, 0xB4, 0x72, 0x36, 0xD7, 0x49, 0x1C, 0x4D, 0xD7, 0xFE, 0xC3,
-    0x61, 0x0E, 0xE0, 0x32, 0x84, 0xE4, 0x6B, 0x74, 0x9E, 0x71, 0x5D, 0x69, 0xE8, 0xEF, 0x7D, 0x80,
-    0x13, 0x20, 0x62, 0xF1, 0x78, 0xC2, 0x31, 0xFD, 0x77, 0xC0, 0x6D, 0xAE, 0x69, 0x98, 0x4C, 0x41,
-    0x87, 0xB3, 0xB5, 0x38, 0x61, 0xC8, 0x08, 0xA2, 0x44, 0x59, 0x58, 0xD0, 0xCC, 0xF2, 0x22, 0xDA,
-    0x52, 0xC8, 0x90, 0x2B, 0x1A, 0x08, 0xE2, 0x9D, 0xDD, 0x0C, 0xCB, 0x77, 0x8D, 0x37, 0x67, 0xE1,
-    0x38, 0xFA, 0x04, 0x98, 0x1B, 0x17, 0x0A, 0x65, 0x89, 0xEC, 0xF8, 0x79, 0x77, 0x8E, 0x49, 0x72,
-    0x9E, 0x76, 0x23, 0x7C, 0x51, 0x2B, 0x7D, 0x48, 0xE5, 0xBA, 0x26, 0x64, 0xA9, 0x4F, 0xED, 0xEC,
-    0xC7, 0xF3, 0x9C, 0x5A, 0x64, 0x0A, 0xD0, 0x65, 0x64, 0xCD, 0x36, 0x97, 0xD3, 0x5A, 0x86, 0x89,
-    0x84, 0xB9, 0x96, 0x35, 0xD8, 0x9A, 0x59, 0x55, 0x6A, 0xDF, 0x55, 0xC2, 0x95, 0x07, 0x57, 0x95,
-    0x1D, 0x93, 0x5D, 0x26, 0x35, 0x3B, 0x4C, 0x52, 0x7E, 0xB9, 0x5F, 0x29, 0x43, 0x95, 0xB7, 0x1F,
-    0x28, 0x9B, 0x69, 0xBF, 0xC2, 0x5F, 0x32, 0x04, 0x5F, 0x7A, 0x35, 0x33, 0xF4, 0xE1, 0xD6, 0x09,
-    0xCC, 0x54, 0x93, 0x9E, 0x68, 0x8B, 0x3E, 0xFF, 0x78, 0x24, 0x39, 0x4F, 0xDA, 0x13, 0x8D, 0x5D,
-    0x10, 0xA1, 0x58, 0xF0, 0x32, 0xE5, 0x2F, 0x9D, 0xD9, 0xEA, 0x22, 0x92, 0x48, 0x5A, 0x9D, 0xC9,
-    0xB3, 0x5C, 0x4F, 0xB7, 0x24, 0x1B, 0x5E, 0xAC, 0x3A, 0x56, 0x6D, 0x76, 0x1C, 0xF2, 0x7A, 0x9E,
-    0xE9, 0x0C, 0xA8, 0x28, 0xFD, 0xB7, 0xC9, 0x57, 0x32, 0x58, 0xA2, 0xB5, 0x95, 0x5C, 0x59, 0xAE,
-    0xAB, 0x21, 0x4B, 0x32, 0x93, 0x08, 0x67, 0xCA, 0xC9, 0xD5, 0xD8, 0x50, 0x96, 0x6E, 0xFD, 0x1C,
-    0x7F, 0x30, 0x61, 0xCD, 0xC0, 0x26, 0xF4, 0xD4, 0xC8, 0x90, 0x71, 0x5B, 0x34, 0x52, 0xA9, 0x49,
-    0xA6, 0x1F, 0x57, 0xB7, 0x4E, 0x5C, 0xAE, 0xB7, 0x22, 0x16, 0x1F, 0x8C, 0xCE, 0x37, 0xBA, 0x5B,
-    0x19, 0x37, 0x0B, 0xDB, 0x54, 0xCA, 0x58, 0xA1, 0x05, 0xDF, 0xDA, 0xD0, 0xB7, 0x66, 0x6A, 0x0C,
-    0xC6, 0x5A, 0x44, 0xC2, 0x5B, 0x10, 0x26, 0x4D, 0xDB, 0x16, 0xEA, 0x8D, 0x92, 0x49, 0xA3, 0x51,
-    0x12, 0xEA, 0x6C, 0x34, 0x39, 0x4C, 0x9F, 0x74, 0x59, 0xE6, 0x32, 0x6E, 0xB9, 0x0D, 0xF6, 0xB1,
-    0x60, 0x05, 0x2C, 0xF1, 0x2F, 0xAF, 0x5C, 0xDA, 0x3A, 0x56, 0x32, 0xBF, 0x5A, 0xC9, 0x10, 0x16,
-    0x01, 0x1A, 0xD9, 0xFF, 0x4D, 0x45, 0xC1, 0xD7, 0xE8, 0xE4, 0xB0, 0x0B, 0x50, 0x5E, 0x19, 0xA5,
-    0x00, 0xAE, 0x8C, 0x6A, 0x7D, 0x51, 0x6A, 0xAE, 0xED, 0x7C, 0xB3, 0xA3, 0x7D, 0xA8, 0xF4, 0xD1,
-    0x81, 0xA7, 0x49, 0x93, 0x16, 0x8A, 0x31, 0xC4, 0x83, 0x25, 0x82, 0x94, 0x35, 0x26, 0x5E, 0xC1,
-    0x9E, 0x6A, 0xB0, 0xD5, 0x33, 0xF2, 0x6E, 0x88, 0x3D, 0xC6, 0xC4, 0xED, 0x33, 0x5D, 0xCD, 0x0B,
-    0x4B, 0x19, 0xAC, 0x1E, 0xB0, 0xD1, 0x59, 0xB5, 0x8A, 0xB9, 0xB4, 0xFF, 0x39, 0x2A, 0x89, 0x9A,
-    0x19, 0x79, 0xB8, 0x06, 0xD8, 0x34, 0x9D, 0xD3, 0x47, 0x48, 0xAA, 0x55, 0x52, 0x5A, 0x10, 0x36,
-    0xD1, 0x92, 0x28, 0xAA, 0x6B, 0xFF, 0xF2, 0x89, 0x29, 0x1F, 0x8E, 0x39, 0x1E, 0x6C, 0x2F, 0xF3,
-    0x7B, 0x2E, 0xAD, 0x43, 0xC8, 0xC2, 0x28, 0x16, 0x0E, 0xD0, 0xC5, 0x50, 0x9F, 0x51, 0xFB, 0xF1,
-    0x0A, 0xD2, 0xF1, 0x74, 0xC6, 0x65, 0xB2, 0xCE, 0xD1, 0xE1, 0x01, 0x5F, 0x81, 0xF1, 0x06, 0xAD,
-    0x8F, 0xD7, 0xAA, 0xED, 0xE6, 0x78, 0xD4, 0x1C, 0xDF, 0xF8, 0xD7, 0x08, 0xB0, 0x99, 0xAF, 0xEE,
-    0xCB, 0x67, 0xBD, 0xAB, 0x33, 0xBF, 0x81, 0x97, 0x9A, 0xED, 0xF1, 0x52, 0xBF, 0x35, 0x21, 0xDD,
-    0x16, 0xD2, 0x87, 0x8F, 0x6B, 0x62, 0xF0, 0xA2, 0xCA, 0xFF, 0x11, 0x56, 0x88, 0xAC, 0x5B, 0x10,
-    0x95, 0x8A, 0xD2, 0x78, 0x35, 0x51, 0xD3, 0x33, 0xEB, 0xA7, 0xDE, 0x5D, 0x26, 0x3C, 0x27, 0xDF,
-    0x1F, 0x40, 0x65, 0x6D, 0x96, 0xAE, 0xC9, 0x2C, 0xE8, 0xB5, 0x8D, 0xDB, 0x5A, 0xBE, 0x16, 0x44,
-    0x53, 0xED, 0x77, 0x20, 0x5A, 0x41, 0x5F, 0x36, 0x67, 0x2B, 0x1C, 0x16, 0xBE, 0x4D, 0x2F, 0xD4,
-    0x90, 0xFF, 0x07, 0x34, 0xA7, 0xD0, 0x1B, 0xE4, 0xB8, 0x7D, 0x93, 0x89, 0x0A, 0x97, 0xDA, 0x95,
-    0xCA, 0x32, 0xE0, 0x49, 0x4A, 0x24, 0xDE, 0x74, 0xA0, 0x70, 0xA3, 0x8B, 0xE4, 0xF3, 0x18, 0xDF,
-    0xCF, 0x82, 0xB9, 0x57, 0x4F, 0x55, 0xB4, 0x3E, 0x21, 0x0D, 0x81, 0xD6, 0x9C, 0xFD, 0xBD, 0x6E,
-    0x2C, 0x66, 0x9D, 0x57, 0xD5, 0xE5, 0xDF, 0x8D, 0xE1, 0x5B, 0x86, 0x7C, 0x02, 0x8C, 0x38, 0xF5,
-    0x64, 0xA9, 0x77, 0xB5, 0xD6, 0x28, 0xD7, 0xAA, 0x49, 0x6E, 0x3D, 0x1E, 0x16, 0x86, 0xD4, 0x42,
-    0xC0, 0x5C, 0x31, 0xB2, 0xF7, 0x51, 0xBE, 0xD8, 0xA0, 0x7F, 0xDB, 0xE0, 0x3A, 0x63, 0xED, 0x2C,
-    0xEB, 0xF2, 0xB4, 0x6C, 0x45, 0x93, 0x0E, 0x56, 0xED, 0xE5, 0x4E, 0x6E, 0x95, 0x77, 0x95, 0xC4,
-    0x1F, 0xC4, 0x5A, 0x8A, 0xC4, 0x40, 0xD6, 0x29, 0x38, 0x98, 0xAB, 0xD8, 0xFD, 0x17, 0x0F, 0x91,
-    0xC4, 0xBB, 0x41, 0xC6, 0xB1, 0xA4, 0xDD, 0x65, 0x41, 0x9F, 0xD0, 0x5A, 0x6F, 0x43, 0xD8, 0xCC,
-    0xBF, 0xA4, 0x49, 0x67, 0x23, 0x0A, 0x08, 0xF4, 0xE6, 0x64, 0xA1, 0x8A, 0x5A, 0xD8, 0xCD, 0xAA,
-    0xB0, 0x49, 0x5B, 0xFC, 0x19, 0x4E, 0xDB, 0x23, 0xD8, 0x2D, 0xA3, 0x62, 0x88, 0x69, 0x7C, 0x46,
-    0x56, 0xDE, 0xC5, 0xAE, 0x09, 0x69, 0xEB, 0x31, 0x99, 0x87, 0xDA, 0x37, 0x28, 0x86, 0x7E, 0xCC,
-    0x2B, 0xC1, 0x94, 0xE5, 0x4A, 0x5A, 0xA6, 0x65, 0x57, 0xE8, 0x73, 0xCC, 0x5A, 0x9B, 0x8D, 0x36,
-    0x51, 0xEE, 0x94, 0x77, 0x55, 0x50, 0xBF, 0x2F, 0x8B, 0x71, 0xCD, 0x4A, 0xDC, 0x46, 0xEB, 0xB7,
-    0x86, 0xF9, 0x4C, 0xF1, 0xD6, 0x21, 0xAC, 0x22, 0xF3, 0x2E, 0xD7, 0x68, 0xCA, 0xDE, 0x53, 0xAB,
-    0x36, 0x53, 0xDC, 0x56, 0xCE, 0x95, 0xF8, 0x1D, 0xE6, 0xA5, 0x8B, 0x7D, 0x7D, 0xAC, 0xD6, 0x03,
-    0x70, 0x62, 0x6D, 0xF6, 0x6F, 0xD0, 0xA5, 0xDE, 0x99, 0x89, 0x24, 0x9C, 0x2C, 0xB9, 0x14, 0x78,
-    0x37, 0x30, 0x98, 0x71, 0xF3, 0xA7, 0xD7, 0x9F, 0xD1, 0x0C, 0xCA, 0x2D, 0xFF, 0xAB, 0x71, 0x15,
-    0x40, 0x27, 0xEC, 0x3B, 0xB8, 0x8F, 0x3E, 0xAB, 0xD8, 0xD4, 0x94, 0xEB, 0x7F, 0x74, 0x6E, 0x58,
-    0x9A, 0xF3, 0x1C, 0x9E, 0xC5, 0xB0, 0xAC, 0xB8, 0x68, 0x81, 0x92, 0x8E, 0xE8, 0xCE, 0x1B, 0xC7,
-    0xBB, 0xCF, 0x17, 0x8D, 0x76, 0xAE, 0xEE, 0x08, 0x39, 0x21, 0x75, 0x69, 0x15, 0x14, 0x50, 0x3E,
-    0xC8, 0xEA, 0x71, 0xB0, 0x41, 0xC0, 0x07, 0xFD, 0xBE, 0xEF, 0x83, 0x5E, 0x35, 0x45, 0x8D, 0xA9,
-    0x5A, 0xAA, 0x23, 0x2B, 0xFE, 0x1A, 0x75, 0xAB, 0x9D, 0x6F, 0xD5, 0xF2, 0x40, 0xAB, 0xCB, 0xE6,
-    0x2E, 0x1D, 0x3D, 0xF5, 0x61, 0x4C, 0xD3, 0x91, 0x38, 0x8A, 0xA6, 0xDD, 0xF2, 0x86, 0x4F, 0xDD,
-    0xF2, 0xD2, 0x2D, 0xD7, 0xF3, 0xD1, 0xED, 0x73, 0x91, 0x69, 0x1E, 0xDD, 0x3E, 0x7F, 0xAB, 0xF5,
-    0xB4, 0x18, 0x08, 0xFF, 0x63, 0x08, 0x75, 0xF2, 0x26, 0xBA, 0xF8, 0x7D, 0x26, 0x17, 0x71, 0xD1,
-    0x4E, 0xBC, 0x19, 0x34, 0x1A, 0xED, 0x3F, 0x69, 0xBA, 0xEF, 0x4B, 0xCE, 0xB5, 0xBA, 0xC3, 0xDB,
-    0x1B, 0xC0, 0x53, 0x5E, 0xE9, 0x03, 0x06, 0xD2, 0x84, 0x56, 0x2C, 0x15, 0xEC, 0x32, 0xAB, 0x0F,
-    0xC8, 0x9F, 0x63, 0x9F, 0xBD, 0xE9, 0x98, 0xED, 0xD2, 0x7B, 0xC2, 0xE4, 0x9E, 0x3C, 0xD2, 0xE7,
-    0xD8, 0x49, 0xFB, 0x00, 0x47, 0xB4, 0xCF, 0x63, 0x88, 0x23, 0x05, 0x19, 0x86, 0x28, 0x2F, 0x2C,
-    0x8E, 0x19, 0x8C, 0x14, 0x01, 0xDB, 0x85, 0x8A, 0xC8, 0xE9, 0xD7, 0x39, 0xB4, 0xDE, 0x73, 0xAE,
-    0xA7, 0x73, 0x78, 0xC4, 0xEE, 0x5E, 0x8A, 0x58, 0xD3, 0x4A, 0x87, 0xCC, 0x2B, 0xE8, 0x47, 0x0A,
-    0x9C, 0xA9, 0x4A, 0xD1, 0x03, 0x84, 0x90, 0xCA, 0x98, 0xF5, 0x32, 0x40, 0xC3, 0xB6, 0x42, 0x4F,
-    0x93, 0xDD, 0x11, 0x72, 0xE9, 0xAA, 0x39, 0x19, 0x54, 0x05, 0xCB, 0xF6, 0x40, 0x73, 0xB9, 0xC7,
-    0x57, 0xBB, 0x47, 0xCB, 0x6D, 0x27, 0xD6, 0x9A, 0x9D, 0x3B, 0x99, 0xB5, 0xFD, 0x06, 0x60, 0x17,
-    0xB8, 0x73, 0x6C, 0xB7, 0xBA, 0xEF, 0x50, 0xE9, 0x6F, 0xED, 0x1B, 0xF7, 0xD2, 0x16, 0xAD, 0x48,
-    0x8C, 0x49, 0xFD, 0x19, 0x15, 0xE7, 0xE9, 0x87, 0x3A, 0x4D, 0x29, 0xFF, 0x38, 0xC3, 0x0D, 0xFF,
-    0x90, 0x25, 0x40, 0x2F, 0x35, 0x60, 0xBC, 0xF3, 0x07, 0x3A, 0x47, 0x2F, 0x31, 0x14, 0xE6, 0x4C,
-    0x97, 0xD3, 0xDC, 0xA1, 0x6F, 0x6A, 0x19, 0xF5, 0x6D, 0x7B, 0x39, 0x67, 0xCC, 0x8B, 0x84, 0x9F,
-    0x86, 0xCA, 0xFD, 0x05, 0x8E, 0xC7, 0x83, 0x56, 0xD9, 0x2C, 0x16, 0x77, 0x86, 0x35, 0x74, 0x4D,
-    0x65, 0xE8, 0x15, 0x6D, 0x4A, 0x3D, 0xA4, 0xE9, 0xAE, 0x02, 0x86, 0x0C, 0xDF, 0x9C, 0xE1, 0xC8,
-    0x21, 0x8B, 0x86, 0x5E, 0xF2, 0xDF, 0x2B, 0xDA, 0x58, 0x1C, 0x1C, 0xF1, 0x8C, 0xD9, 0x9D, 0xCB,
-    0x27, 0x27, 0x12, 0x31, 0xAE, 0x11, 0xA8, 0xF7, 0x4A, 0xDF, 0xEB, 0x07, 0x40, 0x7F, 0x43, 0x42,
-    0x6B, 0x3F, 0xB3, 0xAA, 0x50, 0x9C, 0xFC, 0xF8, 0xDC, 0xC4, 0x0E, 0x93, 0x11, 0x77, 0x9B, 0x44,
-    0x1A, 0x92, 0x13, 0x45, 0xEF, 0xFB, 0xBC, 0xD5, 0x26, 0xEE, 0x3B, 0xFB, 0x1D, 0x72, 0x1B, 0x44,
-    0x6D, 0xF4, 0x80, 0x34, 0x42, 0xF7, 0xFB, 0xEF, 0x62, 0x85, 0xFE, 0x50, 0xB7, 0xE5, 0x74, 0xD1,
-    0xAD, 0x2E, 0x58, 0xBC, 0x90, 0xD2, 0xFF, 0xD8, 0xAC, 0x24, 0x2C, 0xD3, 0x64, 0x85, 0x6E, 0x6D,
-    0x24, 0xE9, 0x14, 0xD7, 0x96, 0xBC, 0xBE, 0x86, 0x32, 0xBB, 0x71, 0x0D, 0x65, 0x5F, 0x61, 0x28,
-    0x3B, 0xB0, 0xD0, 0xEB, 0xEA, 0x14, 0x56, 0x35, 0x83, 0xD0, 0x16, 0x1B, 0x0A, 0xBD, 0xAC, 0xE0,
-    0x6B, 0x65, 0x61, 0xEA, 0x00, 0x80, 0xDA, 0xEB, 0x60, 0x40, 0xDA, 0x06, 0x7A, 0x08, 0x08, 0x22,
-    0x56, 0x3C, 0xC2, 0x17, 0xAA, 0x31, 0xCB, 0xD5, 0xB2, 0x4D, 0x57, 0x7F, 0x59, 0x40, 0xE9, 0x34,
-    0xE2, 0xC3, 0x5F, 0x6F, 0x00, 0x2B, 0x56, 0x43, 0x74, 0xEC, 0x16, 0x76, 0x79, 0x06, 0x4E, 0x9C,
-    0x9F, 0xF9, 0x59, 0xAD, 0xF9, 0x96, 0x81, 0xC3, 0x5F, 0x4E, 0x8D, 0xAD, 0x8A, 0x35, 0xFE, 0x56,
-    0x8D, 0x1B, 0xC9, 0x58, 0x05, 0x95, 0x71, 0x14, 0xFF, 0xED, 0x4A, 0xA3, 0x3F, 0xE1, 0x53, 0x99,
-    0x55, 0x9F, 0xD1, 0x10, 0x80, 0xFE, 0x06, 0xAB, 0xA9, 0x35, 0x7F, 0xE5, 0x7C, 0x99, 0xEB, 0x0F,
-    0xB3, 0xDC, 0xAB, 0xE0, 0x60, 0xD5, 0x42, 0x4E, 0xAA, 0xD7, 0x28, 0x6F, 0x69, 0x4D, 0xDB, 0x4A,
-    0x59, 0xFD, 0xA9, 0x0B, 0x91, 0x53, 0x57, 0x3E, 0x12, 0xA9, 0x06, 0xF6, 0xD5, 0x2A, 0x38, 0xD7,
-    0xD5, 0x4F, 0x1C, 0x2B, 0xBC, 0x78, 0x48, 0xC3, 0xE8, 0xB3, 0x9F, 0x33, 0xF4, 0x6A, 0xDD, 0xCF,
-    0xD5, 0x63, 0x1B, 0x47, 0x44, 0xBE, 0x8C, 0x5F, 0x01, 0x95, 0x36, 0x41, 0xE2, 0xBF, 0x01, 0x8B,
-    0xDD, 0xC8, 0xF5, 0x8A, 0x89, 0xF9, 0x80, 0xF5, 0xE2, 0xE8, 0xA5, 0x71, 0x4A, 0xB7, 0x18, 0xB8,
-    0xF9, 0x19, 0x89, 0xDC, 0x7C, 0xC0, 0xA0, 0xF0, 0x3A, 0xE1, 0x68, 0xF8, 0x74, 0x12, 0x62, 0xDD,
-    0xA1, 0x9A, 0xAE, 0xC3, 0xB3, 0xBF, 0x2A, 0x78, 0x57, 0x36, 0x0A, 0x76, 0xE4, 0x4E, 0xC4, 0x9D,
-    0xEA, 0x9C, 0x22, 0xF5, 0xB0, 0xD4, 0x8B, 0x9E, 0xAB, 0x9D, 0x72, 0x2F, 0xA1, 0x59, 0xB5, 0x59,
-    0x3B, 0x35, 0x1B, 0x93, 0x60, 0xA5, 0xFC, 0x16, 0x29, 0xDB, 0x64, 0x60, 0x46, 0x31, 0x00, 0xB6,
-    0xB8, 0xFA, 0xA7, 0x74, 0x53, 0xB1, 0x20, 0x5A, 0x4C, 0xB4, 0xE1, 0x74, 0xF1, 0x36, 0xAD, 0x82,
-    0x73, 0x18, 0xDF, 0x72, 0x4D, 0xDF, 0x7D, 0x70, 0x30, 0xD4, 0x45, 0x47, 0x8D, 0x09, 0x7E, 0x96,
-    0x4E, 0xB1, 0x3B, 0x7A, 0x6A, 0x80, 0x8A, 0x2F, 0xCC, 0xCE, 0x29, 0xF8, 0x75, 0xA2, 0x11, 0x2C,
-    0x02, 0x46, 0x2E, 0xA7, 0xB2, 0x36, 0x82, 0xD8, 0xF0, 0x17, 0x61, 0x7E, 0xC6, 0xDA, 0x5D, 0x19,
-    0x40, 0x1C, 0xE8, 0x67, 0x5B, 0x15, 0x13, 0xF2, 0x2C, 0x29, 0x60, 0x39, 0x2E, 0xA7, 0x16, 0xCD,
-    0xE2, 0xFD, 0xA8, 0xC3, 0x44, 0x44, 0xBD, 0x1D, 0x3A, 0x63, 0x79, 0x83, 0xA4, 0x54, 0xB1, 0x1A,
-    0xD6, 0xFF, 0x23, 0x46, 0x14, 0x6A, 0xAD, 0xBC, 0x61, 0xE0, 0x2C, 0x3E, 0xBD, 0x47, 0x58, 0x29,
-    0xC7, 0xAB, 0x43, 0xBE, 0x4D, 0x3C, 0xC7, 0x3C, 0x67, 0x03, 0x8F, 0xC0, 0x2B, 0x74, 0x4A, 0x5E,
-    0xA1, 0xD3, 0xA0, 0x78, 0x25, 0x8C, 0x59, 0x13, 0xA9, 0xE9, 0x0E, 0x98, 0x52, 0x66, 0x28, 0x47,
-    0x2D, 0xD4, 0x3D, 0x20, 0x3C, 0x95, 0x23, 0x6B, 0x6D, 0xEA, 0x81, 0x8C, 0xE7, 0x61, 0x55, 0xF3,
-    0x19, 0x39, 0x16, 0xB0, 0x9D, 0xC2, 0xF1, 0x91, 0xA1, 0xA5, 0x54, 0x17, 0xC5, 0xEA, 0x49, 0x4E,
-    0xBB, 0x42, 0xC2, 0xDE, 0x23, 0xEA, 0x42, 0x5A, 0xDA, 0x9F, 0xDB, 0x03, 0xD4, 0xE6, 0x66, 0x2F,
-    0x5C, 0x19, 0x8D, 0x2E, 0x98, 0xB6, 0x04, 0xDA, 0xA8, 0xD3, 0x1E, 0xE4, 0xFA, 0xC6, 0xB8, 0xCD,
-    0x17, 0xEF, 0xD4, 0x51, 0x42, 0x3F, 0x6D, 0xC2, 0x17, 0x3A, 0xBA, 0xBC, 0x92, 0xE9, 0xFD, 0x0D,
-    0x1D, 0xA8, 0x8B, 0xE7, 0x75, 0x67, 0x13, 0xE5, 0x7D, 0x77, 0x06, 0x7C, 0xE3, 0x5E, 0x5F, 0x7E,
-    0x06, 0x50, 0xF8, 0x63, 0xAD, 0x62, 0x5C, 0x9B, 0xA9, 0x64, 0xDE, 0xF3, 0xFB, 0x28, 0xFE, 0x18,
-    0x70, 0xD2, 0x93, 0x98, 0xB7, 0x3F, 0x73, 0xFA, 0xE6, 0x99, 0xEF, 0x8B, 0xD4, 0xD1, 0x68, 0xF4,
-    0x06, 0x3A, 0xFD, 0x4A, 0x83, 0x89, 0xF7, 0xB5, 0xA9, 0x9D, 0x28, 0x91, 0x99, 0x48, 0x01, 0x5D,
-    0x14, 0xC3, 0x82, 0xEB, 0xB7, 0x97, 0x4F, 0x68, 0x81, 0x17, 0x87, 0xB7, 0xDA, 0x08, 0x61, 0x17,
-    0xB8, 0x8C, 0x74, 0x14, 0xAB, 0xEE, 0xCF, 0xC8, 0xFE, 0xE1, 0xF2, 0xF2, 0x53, 0x98, 0x35, 0xC8,
-    0xCB, 0xB5, 0xE0, 0x9B, 0xF9, 0x33, 0xF7, 0xD3, 0xBA, 0xFD, 0x21, 0x94, 0xD7, 0xCC, 0x27, 0xCF,
-    0xEE, 0xCE, 0xF2, 0xC1, 0x95, 0xB5, 0x6A, 0xEA, 0x92, 0xD6, 0x95, 0x4D, 0xB3, 0x2E, 0x91, 0x75,
-    0x18, 0xCB, 0x77, 0x14, 0x18, 0x2D, 0x33, 0x53, 0xAF, 0x3C, 0x68, 0xDD, 0xD7, 0xDC, 0xA9, 0xFC,
-    0x3F, 0x95, 0x55, 0x4D, 0x6C, 0x1B, 0x45, 0x14, 0x7E, 0xB3, 0x1B, 0x77, 0xDB, 0x0C, 0xF1, 0x14,
-    0xE1, 0x40, 0x29, 0x6E, 0xDC, 0x43, 0x0E, 0x55, 0x95, 0x78, 0x83, 0x64, 0xA1, 0x1C, 0xD6, 0xD9,
-    0x29, 0x39, 0x70, 0xA8, 0x04, 0x96, 0x48, 0xCE, 0x20, 0x51, 0xA9, 0xA2, 0x1C, 0xE2, 0x4A, 0x95,
-    0xF0, 0x21, 0xB1, 0x37, 0xF4, 0xC0, 0xAD, 0x44, 0x42, 0xE2, 0x1C, 0x89, 0x1E, 0x8A, 0x7B, 0x48,
-    0x8A, 0x7A, 0xC8, 0x21, 0xF5, 0x4E, 0x5A, 0x50, 0x04, 0xBD, 0x2C, 0x3F, 0x52, 0x2F, 0x1C, 0x16,
-    0x84, 0x54, 0xD1, 0x1E, 0x3A, 0xAD, 0x36, 0xD2, 0x26, 0x5D, 0x7B, 0x78, 0xB3, 0x1B, 0x37, 0x4A,
-    0x4A, 0x2B, 0x31, 0x33, 0x3B, 0xBB, 0xF3, 0xFC, 0x66, 0xE6, 0xBD, 0xEF, 0x7D, 0xEF, 0xF9, 0x34,
-    0xB8, 0x1E, 0x13, 0xA6, 0x84, 0x18, 0x1C, 0x72, 0x95, 0x05, 0x5D, 0x1A, 0x4E, 0x19, 0x01, 0xC0,
-    0xA7, 0x00, 0x0A, 0x4C, 0x25, 0xD8, 0x3D, 0x69, 0x43, 0xD2, 0x80, 0x71, 0xC2, 0xC9, 0xB4, 0x82,
-    0xBF, 0x54, 0x2F, 0x92, 0xAD, 0xA4, 0x42, 0xAE, 0x41, 0xBB, 0xBD, 0xA2, 0x94, 0xAF, 0x24, 0x00,
-    0x30, 0x95, 0xB6, 0xAD, 0xD9, 0xD9, 0xD9, 0x51, 0x38, 0xE6, 0x80, 0x63, 0xB7, 0x63, 0xA6, 0x42,
-    0xD2, 0xE1, 0x85, 0x4E, 0x67, 0x01, 0x8E, 0xC2, 0x59, 0xB1, 0x70, 0xCB, 0xBA, 0x2F, 0x9C, 0x61,
-    0xA2, 0x16, 0xE7, 0x78, 0x19, 0x22, 0x5B, 0x44, 0xA6, 0xC8, 0xE1, 0xD6, 0x52, 0x34, 0xB5, 0x70,
-    0x73, 0x64, 0x35, 0xDF, 0x28, 0xBB, 0x09, 0x0D, 0xE1, 0xEA, 0x71, 0xDE, 0x65, 0x41, 0x93, 0x86,
-    0xAE, 0x19, 0xDA, 0x46, 0x98, 0x87, 0x10, 0xCE, 0xC1, 0x9B, 0x53, 0xB0, 0xCE, 0xEE, 0x48, 0x4B,
-    0x09, 0xA2, 0x38, 0x74, 0xA0, 0xB0, 0xA0, 0x1B, 0xD4, 0x72, 0xB1, 0xDD, 0xEF, 0x00, 0xA7, 0x8D,
-    0x65, 0xB4, 0x1E, 0x12, 0x26, 0xD8, 0x62, 0x44, 0x64, 0x09, 0xF2, 0x24, 0xC4, 0xF3, 0x61, 0x01,
-    0x70, 0x07, 0x8E, 0xD1, 0x53, 0xFB, 0x0C, 0x83, 0x0B, 0x40, 0x55, 0x58, 0x7A, 0x18, 0x57, 0xC1,
-    0x99, 0x84, 0x31, 0x43, 0xCC, 0x53, 0x11, 0xDB, 0xD3, 0xD2, 0xB5, 0xE4, 0x30, 0xB0, 0x20, 0x29,
-    0x6D, 0xC4, 0xB6, 0x29, 0xAB, 0x96, 0x28, 0x40, 0xD3, 0x92, 0xAE, 0x11, 0x95, 0xBC, 0x84, 0x0A,
-    0x87, 0x70, 0x1A, 0x74, 0xD9, 0x86, 0xD6, 0x9C, 0x32, 0xF1, 0xB7, 0xD3, 0x1A, 0xBE, 0x20, 0x85,
-    0x6F, 0x0C, 0xAE, 0x19, 0x89, 0x25, 0x99, 0xB0, 0x61, 0x52, 0x3B, 0x46, 0x10, 0x11, 0x59, 0x22,
-    0x32, 0x07, 0x8C, 0x47, 0x1A, 0x21, 0x1E, 0xE5, 0x60, 0x78, 0xF6, 0xAC, 0x4A, 0x2E, 0x5C, 0x17,
-    0xE0, 0x80, 0xF9, 0x6C, 0x32, 0x3C, 0x28, 0x00, 0x9A, 0x4E, 0x12, 0x2B, 0x6A, 0x05, 0x2D, 0xC4,
-    0x2B, 0xE7, 0x36, 0x56, 0x57, 0x1B, 0x76, 0x8E, 0x70, 0x53, 0xE8, 0xEE, 0xF7, 0x5A, 0xDD, 0xE1,
-    0x19, 0xBF, 0xF7, 0xD9, 0x3F, 0xD9, 0x1A, 0x40, 0xCF, 0x73, 0xDB, 0x7E, 0xEF, 0x8D, 0xDF, 0x4D,
-    0x81, 0xFB, 0x41, 0xE3, 0x4F, 0x6A, 0xB6, 0x21, 0xF5, 0x30, 0x77, 0x7A, 0xEA, 0xEE, 0xDF, 0x33,
-    0xCC, 0x8B, 0xD3, 0x91, 0xD0, 0x9D, 0xD6, 0xE3, 0x8E, 0xD3, 0xE9, 0x38, 0x7B, 0x91, 0x38, 0x88,
-    0x3C, 0x13, 0x71, 0xE9, 0xDD, 0xD0, 0x21, 0x78, 0xB0, 0xE5, 0xB1, 0x08, 0xD6, 0xA1, 0x0A, 0xF3,
-    0xAD, 0xD8, 0x0D, 0x08, 0x44, 0x65, 0x4B, 0xAC, 0x51, 0xE1, 0x7F, 0xAB, 0x08, 0xDF, 0x85, 0x1E,
-    0x03, 0x8D, 0xF7, 0xED, 0xB4, 0x57, 0x22, 0x3C, 0x26, 0x1D, 0x35, 0xC8, 0x35, 0x18, 0xF9, 0x4D,
-    0x48, 0xC7, 0x56, 0xCA, 0x6B, 0xD2, 0xE0, 0xF9, 0xB0, 0xED, 0xE3, 0x14, 0x89, 0x91, 0x53, 0x7D,
-    0xB2, 0x44, 0xFF, 0x19, 0x13, 0x52, 0x23, 0x9E, 0x1F, 0xE0, 0x79, 0x8F, 0x2E, 0x0B, 0x5F, 0x4E,
-    0xC2, 0xDA, 0x33, 0xCA, 0xB5, 0x94, 0xEA, 0xEA, 0x07, 0xB2, 0xB6, 0x4B, 0x3F, 0x99, 0xAD, 0x06,
-    0xDB, 0xED, 0xF6, 0x2E, 0x19, 0x09, 0x37, 0x68, 0xD7, 0xD8, 0x54, 0x3B, 0x4F, 0x02, 0x5F, 0x2E,
-    0x1B, 0xCB, 0xB0, 0x9F, 0xAB, 0xED, 0xB4, 0x65, 0xEB, 0xEC, 0x5B, 0x2B, 0x8C, 0x41, 0x29, 0xA4,
-    0x31, 0x4D, 0xAC, 0x2E, 0x34, 0xC1, 0xD0, 0x12, 0xC2, 0x01, 0xD1, 0x00, 0x8A, 0xB0, 0xC7, 0x88,
-    0x1B, 0x82, 0x1F, 0x1E, 0x14, 0xC8, 0x03, 0x02, 0xE3, 0x05, 0x02, 0x2B, 0x13, 0x30, 0x9E, 0x0A,
-    0xA6, 0x32, 0x41, 0x2D, 0x29, 0x33, 0x56, 0x4E, 0x6A, 0x88, 0xE1, 0x33, 0x3C, 0x7B, 0x6D, 0x1F,
-    0xAD, 0x42, 0x23, 0xF1, 0x7E, 0x0B, 0x5D, 0x6D, 0xB6, 0xAF, 0xDF, 0xF3, 0x60, 0xBC, 0x01, 0x86,
-    0x7E, 0xA1, 0xF3, 0xBF, 0xB6, 0xDB, 0xD7, 0xE8, 0x56, 0xCF, 0x78, 0xDA, 0x8B, 0x1D, 0x66, 0x6E,
-    0xF2, 0xD5, 0x13, 0x85, 0x42, 0x75, 0xDE, 0x8E, 0x68, 0x58, 0x8A, 0xAA, 0xEB, 0x85, 0xD1, 0x43,
-    0xB7, 0x93, 0xAA, 0x19, 0xD8, 0x10, 0x5B, 0x62, 0xDD, 0x9D, 0xF6, 0x5E, 0x06, 0xD3, 0x8B, 0x48,
-    0xFC, 0x7C, 0x00, 0x5A, 0x56, 0x62, 0x89, 0x79, 0xC6, 0x97, 0x30, 0x45, 0x88, 0x25, 0xCD, 0x27,
-    0x5B, 0x51, 0x92, 0x34, 0xCB, 0x55, 0x06, 0x79, 0x80, 0x82, 0x19, 0x54, 0xCD, 0xD0, 0x0D, 0xBB,
-    0xC3, 0xB3, 0xB3, 0x33, 0xAD, 0xD4, 0xE6, 0xF6, 0xAD, 0x79, 0x74, 0xBB, 0xFF, 0x14, 0x50, 0xE7,
-    0x65, 0x76, 0xEC, 0x4F, 0x68, 0x37, 0x71, 0x13, 0x4C, 0x8E, 0xAC, 0x63, 0x08, 0x86, 0x9D, 0x63,
-    0x54, 0x5D, 0xBE, 0xAD, 0xD0, 0x5F, 0x5B, 0x99, 0x5F, 0xFE, 0xEC, 0xC1, 0xC4, 0xEE, 0x09, 0x18,
-    0x21, 0x0D, 0x32, 0x46, 0xA9, 0x06, 0x56, 0x6C, 0x6E, 0xA8, 0xED, 0xB5, 0x6A, 0x49, 0x4D, 0x0B,
-    0x3B, 0x00, 0x2C, 0x31, 0x24, 0x02, 0xB0, 0xD1, 0xFF, 0x65, 0x38, 0xE4, 0x1D, 0xB1, 0xE3, 0xF1,
-    0x29, 0x3F, 0xB9, 0x44, 0x23, 0x6D, 0x47, 0x38, 0xE2, 0xF6, 0x16, 0x1A, 0xAD, 0xA4, 0x7E, 0x48,
-    0x57, 0x0A, 0xEB, 0x4C, 0x60, 0xAB, 0xB8, 0xA5, 0xBA, 0xEC, 0x8C, 0x34, 0xCE, 0x78, 0xE9, 0xD1,
-    0x86, 0x47, 0x43, 0x3B, 0xCE, 0x72, 0x0E, 0xB3, 0x50, 0xE0, 0x77, 0x4F, 0x05, 0x76, 0x6C, 0x65,
-    0xD6, 0xB3, 0xFE, 0xFC, 0xE1, 0x8F, 0xC0, 0x6A, 0xF0, 0xFD, 0x15, 0xBC, 0x0F, 0x81, 0x58, 0x05,
-    0x38, 0x02, 0xF0, 0x31, 0xC0, 0x49, 0xFD, 0x51, 0xAB, 0x03, 0xE4, 0x73, 0xBB, 0x9A, 0x4B, 0xC8,
-    0x15, 0x26, 0xB1, 0xBE, 0x5A, 0xBB, 0x7B, 0x97, 0xF5, 0xAF, 0x83, 0x80, 0xF3, 0x50, 0x7F, 0x57,
-    0x76, 0x02, 0xDC, 0x78, 0x1F, 0x40, 0xC2, 0x27, 0x3F, 0xED, 0xDD, 0x92, 0x62, 0xA7, 0x6D, 0x50,
-    0x99, 0x0D, 0x48, 0xA3, 0x96, 0xD7, 0xA1, 0xF7, 0x63, 0xED, 0x8D, 0x75, 0xE7, 0xCF, 0xE0, 0xE6,
-    0x88, 0x29, 0xC7, 0x0C, 0xE5, 0x31, 0x25, 0xED, 0x6F, 0x62, 0xC4, 0xAD, 0xE0, 0x14, 0xB2, 0xEA,
-    0x07, 0xA7, 0xE0, 0xF0, 0xC9, 0xA9, 0x84, 0x45, 0x4C, 0xBA, 0xF1, 0x09, 0x5D, 0x9F, 0x6A, 0xCD,
-    0xD6, 0x57, 0xC2, 0xE7, 0x1D, 0x58, 0xE6, 0x6C, 0xC9, 0x0D, 0x9A, 0xA5, 0x87, 0xE1, 0xB2, 0x36,
-    0xD8, 0x0C, 0xCD, 0xB0, 0x14, 0xFA, 0x60, 0x7F, 0x20, 0xE9, 0xD6, 0xFD, 0xCB, 0xD1, 0x98, 0x53,
-    0x31, 0x17, 0x03, 0x28, 0x5B, 0xA1, 0x43, 0xCD, 0xCD, 0x5F, 0x96, 0x0A, 0x4D, 0x7F, 0x01, 0x71,
-    0x79, 0xED, 0x07, 0x37, 0x69, 0xE1, 0x9F, 0x45, 0x79, 0xED, 0xF0, 0x49, 0x6D, 0x98, 0xFF, 0x51,
-    0xE8, 0xFA, 0x8F, 0x36, 0x3D, 0x39, 0x76, 0x89, 0x91, 0x7B, 0xF8, 0xC2, 0x95, 0xF0, 0x59, 0xA8,
-    0xDD, 0x29, 0x66, 0xB1, 0x9C, 0xD4, 0x5E, 0x9E, 0x4B, 0x13, 0xEA, 0xEB, 0x40, 0xBF, 0xE6, 0x75,
-    0x58, 0xC0, 0xE6, 0x3E, 0xA2, 0x32, 0x17, 0x60, 0xBD, 0x5C, 0x51, 0x11, 0x10, 0xE4, 0xFD, 0xDF,
-    0x28, 0x3E, 0xDE, 0xE6, 0xFF, 0x57, 0x7B, 0x2F, 0x9D, 0xD3, 0xE0, 0x1D, 0x58, 0xC2, 0x2C, 0xD7,
-    0x6E, 0xFB, 0x6A, 0x1B, 0x60, 0xC4, 0x7D, 0xAA, 0xD4, 0x83, 0x95, 0x4D, 0x0F, 0xDE, 0x52, 0x2A,
-    0xC2, 0xBA, 0x40, 0x2E, 0x5C, 0x85, 0x7E, 0x9B, 0x53, 0x0A, 0xAF, 0x40, 0x02, 0xAB, 0x00, 0xDC,
-    0x6D, 0xFE, 0x3A, 0x16, 0x2C, 0xCD, 0x0F, 0xDF, 0x4C, 0x23, 0x90, 0xAC, 0xEB, 0xD9, 0x0C, 0x61,
-    0xAF, 0x0D, 0x64, 0xAF, 0x71, 0x33, 0xBD, 0xAC, 0x97, 0xF1, 0x3B, 0x49, 0x65, 0x34, 0xE3, 0xD1,
-    0x68, 0x5F, 0x95, 0x46, 0x03, 0x45, 0x18, 0xA2, 0xDD, 0xC9, 0xA1, 0x89, 0xA1, 0xEA, 0xAD, 0x1C,
-    0xB7, 0xA2, 0xE2, 0x89, 0xCA, 0xA0, 0xAB, 0x2A, 0x18, 0x20, 0xF6, 0x1D, 0x99, 0x79, 0x55, 0x14,
-    0x2F, 0x6E, 0x16, 0x2F, 0x6E, 0xA0, 0x22, 0xB5, 0xA6, 0xE1, 0x86, 0x28, 0xD6, 0xAD, 0x21, 0x63,
-    0xF1, 0xA1, 0xC8, 0xF1, 0x89, 0xC1, 0x7E, 0xAF, 0xE4, 0xCB, 0x9D, 0x1C, 0xA7, 0x52, 0xBE, 0x87,
-    0xD0, 0xD6, 0x21, 0x20, 0x0F, 0xF8, 0x0C, 0x66, 0x01, 0x76, 0xFA, 0x60, 0x72, 0xA4, 0x9E, 0xAF,
-    0x0F, 0xD6, 0x53, 0x1D, 0xC2, 0x27, 0xA0, 0x82, 0xFD, 0x9D, 0xD8, 0xC9, 0x57, 0x68, 0xBF, 0x1F,
-    0x25, 0xE7, 0x1F, 0x77, 0x47, 0xE8, 0x17, 0x9B, 0x44, 0xBC, 0x2D, 0xEA, 0xAF, 0xD4, 0x8B, 0x66,
-    0xD1, 0x02, 0x5C, 0x4C, 0xF0, 0xA3, 0x03, 0xE7, 0xEF, 0x06, 0xAB, 0x14, 0xF4, 0x20, 0x68, 0x6C,
-    0x60, 0x87, 0xC1, 0x10, 0xE8, 0x41, 0x97, 0x86, 0x27, 0xAC, 0x21, 0x73, 0x51, 0x88, 0xCA, 0xEA,
-    0x60, 0x05, 0xFE, 0xC0, 0x52, 0x46, 0x60, 0xF4, 0x88, 0x79, 0x16, 0x3E, 0x07, 0xCA, 0x91, 0x32,
-    0x57, 0x0C, 0x11, 0xF0, 0x81, 0x7F, 0x01, 0xE5, 0x7D, 0x4D, 0xAC, 0x1C, 0xD7, 0x95, 0xDE, 0xAD,
-    0x2A, 0x93, 0x85, 0x51, 0x05, 0x29, 0x2F, 0x28, 0x47, 0x11, 0x33, 0xAE, 0xD9, 0x04, 0xF0, 0x08,
-    0x63, 0x75, 0x96, 0x19, 0xC0, 0xEC, 0x2A, 0x59, 0xC0, 0x78, 0x31, 0x0B, 0x11, 0x08, 0xDB, 0x42,
-    0xCC, 0x05, 0x03, 0x64, 0x33, 0xB6, 0x06, 0xF3, 0xB2, 0xF4, 0x00, 0x7E, 0x5D, 0xE5, 0x11, 0x02,
-    0x03, 0xF1, 0x42, 0x04, 0x62, 0x39, 0x01, 0xB2, 0x30, 0x17, 0x32, 0x62, 0x35, 0x11, 0x70, 0xE3,
-    0x85, 0x0D, 0xBC, 0xEE, 0x6A, 0x89, 0x0B, 0x2D, 0xBC, 0x50, 0xD9, 0x32, 0xC7, 0x0B, 0x2F, 0x54,
-    0xB6, 0x44, 0x68, 0x44, 0x23, 0x50, 0xC9, 0x6C, 0xD9, 0xF5, 0xC8, 0xFA, 0xC9, 0xF9, 0xBE, 0x73,
-    0xAB, 0x5F, 0xF7, 0xE3, 0x7B, 0xFC, 0x91, 0x28, 0xCB, 0x49, 0x1E, 0xD9, 0xB7, 0xAA, 0x6F, 0x55,
-    0xDF, 0xBA, 0x3F, 0xE7, 0x9E, 0xFF, 0x73, 0xCA, 0x7D, 0xC9, 0x98, 0xD1, 0xD2, 0x98, 0x85, 0x31,
-    0xEE, 0xCA, 0x98, 0x40, 0x4E, 0x3F, 0x6F, 0xEC, 0x5F, 0xDE, 0xF7, 0x6F, 0xF6, 0x7D, 0xD7, 0xCB,
-    0x41, 0xAA, 0x1B, 0x63, 0xC2, 0x3B, 0x0E, 0xFD, 0x6C, 0xF6, 0x42, 0xDF, 0x37, 0x72, 0xCB, 0xEB,
-    0xC7, 0xDD, 0x82, 0xC3, 0x8D, 0xD9, 0xCB, 0x72, 0xCB, 0x7B, 0xD2, 0x98, 0x93, 0x9D, 0x32, 0xB1,
-    0x5F, 0x78, 0xD5, 0xC2, 0x8C, 0xFD, 0xC2, 0xAC, 0xFF, 0x82, 0xBE, 0x6F, 0xF5, 0x96, 0xF6, 0xD8,
-    0x56, 0x6E, 0xCD, 0x7E, 0x80, 0x07, 0xC9, 0xF3, 0x8E, 0xBD, 0x45, 0x0E, 0xDD, 0x6C, 0xF6, 0x3D,
-    0xED, 0x75, 0x29, 0x03, 0xE8, 0x97, 0xAE, 0x14, 0x7D, 0x22, 0xED, 0xF7, 0x72, 0x83, 0x57, 0xE1,
-    0x61, 0xB8, 0xCD, 0x98, 0x98, 0x0F, 0x6E, 0x50, 0x6C, 0x55, 0x9F, 0x98, 0x48, 0x29, 0xB7, 0x67,
-    0xC6, 0xC3, 0xEF, 0x4D, 0xF8, 0x81, 0xC9, 0x97, 0xB8, 0x3B, 0xCE, 0x70, 0x77, 0xCA, 0xBB, 0x1B,
-    0xDC, 0x2D, 0x27, 0x31, 0x7F, 0xD6, 0xA0, 0x35, 0xF9, 0xE6, 0xB0, 0x3A, 0x2C, 0x4C, 0xEC, 0x4C,
-    0x7A, 0xB9, 0x29, 0xEC, 0x2B, 0xA9, 0x8E, 0x3B, 0xB4, 0xFB, 0x68, 0x22, 0xC5, 0x57, 0x8D, 0x89,
-    0xE4, 0x77, 0x32, 0xD3, 0x73, 0x39, 0x4B, 0x8C, 0x5B, 0x6C, 0x4C, 0xF6, 0xEB, 0xF7, 0x31, 0x93,
-    0x0F, 0x74, 0xD0, 0xBF, 0x9D, 0xFE, 0x6D, 0x13, 0xF7, 0x7D, 0x15, 0x75, 0xB3, 0xD6, 0x6F, 0x8D,
-    0x93, 0x49, 0xCF, 0xB8, 0xE6, 0xE8, 0x86, 0x0C, 0x47, 0x26, 0xBF, 0x94, 0xA2, 0x35, 0x5C, 0xA8,
-    0x59, 0x82, 0x99, 0x0A, 0x31, 0x72, 0xD6, 0xA0, 0x83, 0x0B, 0xDC, 0x53, 0xD9, 0x29, 0xF3, 0x30,
-    0x63, 0x11, 0x7E, 0x91, 0x67, 0xF2, 0xAD, 0x7F, 0xF1, 0x7C, 0x81, 0xC5, 0xC3, 0x0A, 0xCA, 0xF7,
-    0x73, 0xC3, 0x33, 0x2F, 0x7A, 0x68, 0xA6, 0xBB, 0x5C, 0xCB, 0x78, 0x4F, 0xC5, 0x89, 0xFE, 0x96,
-    0x9F, 0x44, 0x9F, 0x1E, 0xCA, 0xD3, 0x7D, 0xFC, 0xA4, 0xDF, 0x97, 0xF6, 0x70, 0x92, 0xCB, 0x23,
-    0xFC, 0xC6, 0x76, 0x05, 0xCF, 0x9C, 0xDA, 0xCF, 0xFC, 0xD3, 0x32, 0xB3, 0xE9, 0x8B, 0x17, 0x56,
-    0x69, 0xDF, 0x17, 0x51, 0xDF, 0x71, 0x32, 0xF7, 0x9A, 0xA3, 0xFF, 0xA4, 0xAB, 0xDF, 0xBA, 0xFA,
-    0xDB, 0x55, 0x33, 0xFF, 0x97, 0x8F, 0x28, 0x64, 0x2D, 0x65, 0x61, 0x1A, 0x79, 0x74, 0xF8, 0x20,
-    0x27, 0xD8, 0x09, 0x8D, 0x2E, 0xED, 0x87, 0x2C, 0x46, 0xFF, 0xF9, 0x7C, 0x95, 0x77, 0x41, 0x9F,
-    0x9C, 0xC0, 0x34, 0xF6, 0x3D, 0x81, 0x20, 0x3A, 0x7C, 0x4C, 0x38, 0xC0, 0x63, 0x8F, 0xA3, 0xE1,
-    0x68, 0xD6, 0xC7, 0x74, 0x76, 0x56, 0x8F, 0x02, 0xD5, 0xE8, 0xA8, 0x1C, 0x09, 0x86, 0x53, 0x73,
-    0xBA, 0xD1, 0xA3, 0xCC, 0x9F, 0x1E, 0x17, 0xF6, 0x98, 0x9A, 0x31, 0x8F, 0xF1, 0xFA, 0xB8, 0x6B,
-    0xEB, 0xF7, 0xEC, 0xFD, 0x0D, 0x8E, 0x5E, 0x73, 0xB9, 0x46, 0xFB, 0xF9, 0x4A, 0x5A, 0x44, 0xBB,
-    0xCB, 0xBE, 0xC0, 0x71, 0xDF, 0x9C, 0xB2, 0xA0, 0xB4, 0xA7, 0x18, 0xC2, 0x82, 0xD8, 0x00, 0x66,
-    0x0F, 0xF6, 0xB5, 0xD0, 0xF5, 0xED, 0xF9, 0x77, 0x31, 0xD4, 0xE3, 0xB2, 0x9B, 0x4C, 0x2E, 0x5C,
-    0xFF, 0x4A, 0xAF, 0x37, 0x7B, 0x76, 0x83, 0x87, 0x76, 0x2B, 0xCC, 0xF5, 0x6B, 0xF0, 0xDE, 0xD6,
-    0xD7, 0x50, 0xB1, 0x92, 0x63, 0x6F, 0x4E, 0x5F, 0xE0, 0xE6, 0xCF, 0xAB, 0x86, 0xD3, 0x5D, 0x13,
-    0x3D, 0x09, 0xE8, 0x13, 0x09, 0x60, 0xFB, 0xB7, 0x7A, 0x6A, 0xB7, 0xBC, 0xEE, 0x8F, 0x63, 0x4E,
-    0x1F, 0x3D, 0xC7, 0x36, 0x1A, 0x76, 0x73, 0x05, 0x0C, 0x90, 0x72, 0x93, 0xB7, 0xB8, 0xC1, 0xAF,
-    0x74, 0xBF, 0x2B, 0x02, 0xB8, 0xBF, 0x53, 0xF3, 0xB8, 0x40, 0xBD, 0xBF, 0xB2, 0xB0, 0x2D, 0xAB,
-    0x6A, 0x3C, 0x6C, 0xAC, 0x1F, 0x1E, 0x20, 0x40, 0xCC, 0xED, 0xE8, 0x19, 0xB4, 0x8E, 0xE7, 0xC8,
-    0x4F, 0x47, 0x59, 0x23, 0x5F, 0x08, 0x4A, 0x02, 0x4C, 0x59, 0xB8, 0xE4, 0x73, 0x01, 0x5C, 0xB2,
-    0x83, 0xB0, 0xE6, 0xA1, 0x8C, 0x48, 0x4F, 0x96, 0xC4, 0x4C, 0xE8, 0x5C, 0x40, 0xE8, 0x95, 0x9B,
-    0x1D, 0xDC, 0x1A, 0xE0, 0xE7, 0x71, 0x86, 0x39, 0xC2, 0xF4, 0xA1, 0xE5, 0x58, 0x66, 0x49, 0xAE,
-    0x3D, 0x9E, 0x19, 0xE2, 0x33, 0xDD, 0x8E, 0x8A, 0x0A, 0xC7, 0x28, 0xBE, 0xB0, 0xDD, 0x23, 0x07,
-    0x90, 0x10, 0x62, 0xD2, 0xF2, 0x1E, 0xDB, 0x15, 0x2D, 0x48, 0x95, 0xFB, 0x7B, 0xA9, 0x8A, 0x5E,
-    0x00, 0x8A, 0x8B, 0xE5, 0x31, 0x85, 0x54, 0x8D, 0xBD, 0x5E, 0xF6, 0x4E, 0xD8, 0x0B, 0xE8, 0xC6,
-    0x78, 0x76, 0x2F, 0xCF, 0x96, 0xAA, 0xA9, 0xFC, 0x1A, 0x68, 0xB2, 0x11, 0x88, 0xED, 0xDF, 0xAF,
-    0x05, 0x5F, 0xC8, 0x9A, 0x86, 0xFD, 0x1C, 0xED, 0x94, 0xE8, 0x3E, 0x50, 0xC8, 0xCA, 0x3E, 0x43,
-    0x31, 0xB2, 0xF1, 0x0B, 0x82, 0x81, 0x5F, 0x62, 0x9F, 0x54, 0xE8, 0x44, 0xB9, 0xD1, 0x2B, 0xB7,
-    0x06, 0x46, 0x20, 0x26, 0x01, 0xDE, 0xC2, 0x34, 0xC9, 0xC0, 0x47, 0x99, 0x60, 0x31, 0x0F, 0xD8,
-    0x56, 0xA0, 0xDE, 0xA9, 0x31, 0xF7, 0x2D, 0x6E, 0x4D, 0xD1, 0xAA, 0xCC, 0x77, 0x50, 0xB2, 0xCD,
-    0x40, 0x66, 0x7D, 0xF4, 0xBC, 0xB4, 0xE9, 0xBD, 0x8F, 0x66, 0x16, 0x58, 0xF4, 0x10, 0x3B, 0xD1,
-    0xED, 0x39, 0x0F, 0xCB, 0x01, 0xE5, 0x11, 0xDD, 0x61, 0xC1, 0xDC, 0x2B, 0x35, 0x7A, 0x80, 0xBB,
-    0x53, 0xAC, 0x9F, 0x93, 0xE8, 0xCC, 0xB8, 0x37, 0x31, 0x33, 0x00, 0xD0, 0x18, 0x7D, 0x01, 0x10,
-    0x7A, 0x0F, 0xB5, 0xEA, 0xD6, 0x6C, 0x76, 0xE5, 0x75, 0xEC, 0x8D, 0x98, 0xA4, 0xCB, 0x41, 0x0F,
-    0x30, 0x25, 0x26, 0xCA, 0x2C, 0x5A, 0x64, 0x15, 0xFB, 0xA3, 0x33, 0xE7, 0xD5, 0x24, 0x24, 0x1C,
-    0x03, 0xC0, 0xCC, 0xF9, 0x3D, 0x6E, 0x8F, 0x47, 0xB8, 0xF4, 0x2B, 0xF4, 0x7D, 0xAE, 0xFB, 0x71,
-    0x8E, 0x9F, 0xA2, 0xA9, 0x11, 0x7E, 0xE7, 0x55, 0x2E, 0xC9, 0x11, 0x76, 0x14, 0x80, 0xCD, 0x01,
-    0xE5, 0x34, 0x23, 0x29, 0x8D, 0x77, 0x6B, 0x76, 0x79, 0x85, 0x47, 0x45, 0x19, 0x67, 0xCF, 0x01,
-    0x72, 0x2D, 0x01, 0xBD, 0x31, 0x68, 0xA0, 0xB7, 0x42, 0x2F, 0x22, 0xEC, 0x3B, 0xD3, 0xC8, 0xDE,
-    0x5A, 0xF5, 0xF6, 0x63, 0xB7, 0xFB, 0x1D, 0x9F, 0x6E, 0x02, 0xC8, 0xED, 0x40, 0x61, 0xCA, 0xD6,
-    0x5C, 0xA8, 0x65, 0x85, 0x1A, 0xE9, 0x68, 0x27, 0x9F, 0xA9, 0x7C, 0x52, 0x7C, 0xA4, 0x73, 0x0B,
-    0xF9, 0xB4, 0x73, 0x21, 0x05, 0x0B, 0xD9, 0xCD, 0xD2, 0xEE, 0x32, 0x97, 0xE9, 0xCF, 0xFB, 0x77,
-    0x41, 0xC5, 0x6A, 0x20, 0x8C, 0xAB, 0x95, 0x09, 0x6A, 0x69, 0x30, 0x8F, 0x75, 0xDA, 0x38, 0x7F,
-    0x98, 0xB5, 0x05, 0xF0, 0x61, 0x78, 0xEB, 0x72, 0xE7, 0x61, 0xBB, 0xA3, 0x2B, 0xA8, 0x90, 0x0E,
-    0x7A, 0xBF, 0xAF, 0x74, 0xB5, 0x23, 0x82, 0xF1, 0x52, 0xD6, 0x5B, 0x2A, 0x3A, 0x6C, 0xF0, 0x78,
-    0x76, 0xB9, 0x7F, 0x46, 0x6E, 0x7D, 0xBA, 0x17, 0x44, 0xF7, 0xB1, 0x50, 0x61, 0x9F, 0xCC, 0x84,
-    0x4F, 0xE4, 0x13, 0x68, 0xC9, 0xB9, 0x3E, 0xAE, 0x3C, 0xF6, 0x7F, 0x76, 0x50, 0x0A, 0x81, 0x00,
-    0x8E, 0x60, 0xA9, 0x3C, 0x88, 0x96, 0xF3, 0x81, 0x1F, 0x91, 0xDD, 0x57, 0xA3, 0x7C, 0x0E, 0x70,
-    0x74, 0x23, 0x27, 0x96, 0xD5, 0x72, 0x8F, 0x00, 0x73, 0x5C, 0x49, 0x54, 0x7F, 0xE2, 0xE3, 0x60,
-    0xFD, 0x62, 0xA3, 0xBD, 0x9E, 0x5A, 0xDA, 0xD4, 0x02, 0x80, 0x89, 0xD4, 0x04, 0x16, 0x63, 0x7C,
-    0x89, 0x32, 0xD9, 0xB1, 0x1E, 0x20, 0x0E, 0x4C, 0x52, 0x25, 0x35, 0x0D, 0x60, 0xDE, 0x2F, 0xB1,
-    0xD1, 0xC3, 0x22, 0xCA, 0x52, 0xA2, 0xE8, 0x29, 0xD9, 0xB5, 0x88, 0xB3, 0x0A, 0x3C, 0x02, 0xAC,
-    0x64, 0xC0, 0xE6, 0xD5, 0xF6, 0x32, 0xF1, 0xAC, 0x80, 0x78, 0x85, 0x7D, 0xEC, 0x97, 0x61, 0x89,
-    0x0D, 0x42, 0x18, 0x96, 0x39, 0x99, 0x82, 0xFB, 0x88, 0x96, 0xD2, 0xB8, 0xE0, 0xBF, 0x56, 0x9F,
-    0x2D, 0xED, 0xCB, 0xAE, 0xCA, 0x81, 0x2D, 0x40, 0x0E, 0xA5, 0x01, 0xB9, 0xEC, 0x34, 0x72, 0xA3,
-    0x5C, 0x26, 0xC2, 0x41, 0xFB, 0x99, 0x0F, 0xAA, 0xDD, 0x7D, 0x37, 0x2F, 0x4F, 0x29, 0x17, 0x04,
-    0xDC, 0x89, 0xAE, 0xB9, 0x03, 0x62, 0x4F, 0xF9, 0x39, 0x79, 0xB9, 0x97, 0xDB, 0x5B, 0xE0, 0x4C,
-    0xA2, 0x8D, 0xA5, 0xDD, 0x9A, 0xB1, 0x45, 0x2E, 0xEC, 0x1F, 0x7E, 0x9F, 0x7E, 0x5A, 0x3E, 0xDF,
-    0xBE, 0xFE, 0xE5, 0xFE, 0x55, 0x8C, 0x65, 0x47, 0x76, 0x86, 0x39, 0x91, 0x7C, 0x62, 0x78, 0xD7,
-    0x59, 0x11, 0x7F, 0x02, 0x59, 0xE2, 0x79, 0xE4, 0xCD, 0x86, 0x3F, 0xE0, 0x90, 0x14, 0x68, 0x09,
-    0xFD, 0x1A, 0xC9, 0x6F, 0x1C, 0xB4, 0x10, 0xE2, 0xBE, 0xB9, 0x54, 0xF9, 0x6F, 0x49, 0x55, 0x2C,
-    0x9D, 0x70, 0x57, 0xD2, 0x89, 0x30, 0x93, 0xAA, 0x46, 0x3A, 0x21, 0x88, 0xBC, 0x97, 0xC6, 0xE3,
-    0x46, 0x1A, 0x16, 0xFE, 0x33, 0x93, 0x2A, 0xB9, 0xDA, 0x0B, 0x94, 0xC7, 0x8D, 0xCC, 0x73, 0x2F,
-    0xDB, 0xD6, 0xEB, 0xDF, 0x13, 0x98, 0xC0, 0x3C, 0xC5, 0xE8, 0x09, 0x66, 0x8D, 0xCF, 0x08, 0x97,
-    0x7F, 0x50, 0x7A, 0x08, 0xAC, 0xA2, 0x3B, 0x14, 0xE8, 0xAF, 0x02, 0x7F, 0xD4, 0x00, 0x5A, 0x63,
-    0x21, 0x46, 0xD2, 0x8C, 0xB3, 0x02, 0x61, 0x99, 0xA3, 0x72, 0x84, 0xE9, 0xE2, 0x3E, 0x75, 0x2B,
-    0x4B, 0xDE, 0xC9, 0x76, 0xC5, 0xBA, 0x49, 0xBD, 0x83, 0xCA, 0x31, 0x2B, 0xB1, 0x5B, 0xA5, 0x0D,
-    0xC1, 0xB2, 0x94, 0x1A, 0xF0, 0xC8, 0x27, 0x3A, 0xA0, 0x2D, 0xAC, 0xC0, 0x4D, 0x50, 0x9D, 0x46,
-    0xB9, 0x2B, 0x70, 0xD3, 0x0E, 0xF9, 0x13, 0x0F, 0x08, 0x18, 0xBD, 0x01, 0xFC, 0xF6, 0x1D, 0x56,
-    0x29, 0x6F, 0x64, 0x86, 0xA2, 0x18, 0x38, 0x2E, 0x8E, 0x1B, 0xE9, 0xDD, 0x99, 0xB8, 0x91, 0x87,
-    0xEE, 0x71, 0x7D, 0xEB, 0xB8, 0x89, 0x32, 0x47, 0x66, 0x1E, 0x7D, 0x8A, 0x85, 0xC6, 0x79, 0xA5,
-    0x4C, 0x79, 0x19, 0x2C, 0x31, 0xF1, 0x32, 0x19, 0x8D, 0xB3, 0x52, 0xE0, 0x10, 0x7C, 0xDF, 0x98,
-    0xBD, 0x31, 0xCA, 0xE9, 0x2E, 0x4A, 0xFD, 0x3F, 0xAA, 0x51, 0x86, 0xD5, 0x41, 0x29, 0x1D, 0x06,
-    0x3A, 0x70, 0x80, 0x35, 0x7D, 0x70, 0x5D, 0x51, 0x0E, 0x9A, 0x23, 0x4F, 0x77, 0x6E, 0x1F, 0x57,
-    0x25, 0x78, 0x26, 0x07, 0x82, 0x01, 0xD2, 0xE8, 0x6F, 0x3F, 0xC0, 0x0F, 0xD7, 0x55, 0x16, 0xD6,
-    0x52, 0x00, 0x5E, 0x8A, 0xCD, 0x3D, 0xBA, 0x75, 0x5E, 0x56, 0xA5, 0x86, 0x50, 0x20, 0x4B, 0x1B,
-    0x96, 0x23, 0x5C, 0x20, 0xE5, 0xA9, 0xB1, 0xD3, 0xA2, 0x9F, 0x80, 0xBE, 0x35, 0x14, 0x53, 0x80,
-    0x83, 0x4C, 0x4B, 0x72, 0xFE, 0xE6, 0xC6, 0x29, 0x48, 0x79, 0x03, 0x51, 0x22, 0x7C, 0x0D, 0x8C,
-    0x04, 0xE6, 0x4C, 0xE8, 0x7F, 0x0D, 0xAA, 0x87, 0x9D, 0xD8, 0x99, 0x5C, 0xD6, 0x58, 0x44, 0xC4,
-    0x17, 0x77, 0x2A, 0xA0, 0x66, 0xD0, 0x37, 0x88, 0x23, 0xC6, 0x39, 0x4B, 0x89, 0xAC, 0xBF, 0xD9,
-    0xAB, 0xC4, 0x29, 0x54, 0xF8, 0x63, 0x21, 0xF2, 0xDB, 0x55, 0x79, 0xFF, 0x12, 0x05, 0x4F, 0x80,
-    0x60, 0x43, 0x12, 0xE7, 0xE2, 0xB6, 0xD6, 0xF2, 0xBC, 0x73, 0x7B, 0xDE, 0x68, 0x7D, 0x54, 0xC9,
-    0x7D, 0x05, 0x50, 0x52, 0x3F, 0xBB, 0x68, 0x8E, 0xA3, 0xB9, 0x9B, 0x1F, 0xBB, 0x97, 0x1F, 0x40,
-    0x1E, 0x2C, 0xEC, 0x2F, 0x49, 0xC7, 0x9A, 0x0F, 0x25, 0x0F, 0x62, 0x1A, 0x7F, 0x8B, 0x19, 0xFC,
-    0x09, 0x0A, 0x8B, 0x6C, 0x9A, 0x41, 0xE8, 0x66, 0xC3, 0x0F, 0xB9, 0x0A, 0xDD, 0x03, 0xEA, 0x30,
-    0xE1, 0xAB, 0x35, 0x06, 0x43, 0x26, 0x27, 0x20, 0x22, 0xE7, 0xC6, 0x14, 0x30, 0x9A, 0x52, 0x76,
-    0x4F, 0xE4, 0xD6, 0x08, 0xBB, 0x56, 0xD8, 0x42, 0xB7, 0x46, 0x1B, 0x31, 0x95, 0x20, 0x25, 0x27,
-    0x0C, 0xF0, 0x38, 0x02, 0x60, 0x7A, 0xC4, 0x84, 0x39, 0x46, 0x1E, 0xE2, 0x39, 0x9C, 0x27, 0x17,
-    0xF7, 0x38, 0x98, 0xA4, 0xCB, 0xE0, 0x1F, 0x53, 0x14, 0x11, 0xBE, 0x9A, 0xB3, 0x66, 0xF3, 0x4F,
-    0xE7, 0x5D, 0x31, 0x2C, 0x3B, 0x78, 0x92, 0x74, 0x2A, 0x52, 0x2E, 0x6B, 0x3F, 0x15, 0x08, 0x1F,
-    0x09, 0xBF, 0x1B, 0x55, 0x11, 0x70, 0x47, 0x27, 0xDD, 0x94, 0x95, 0xBD, 0x5A, 0x51, 0x9F, 0x40,
-    0x49, 0x72, 0x4E, 0x85, 0xC3, 0xE8, 0x02, 0x10, 0x5F, 0xF0, 0x06, 0x2E, 0xB8, 0x2B, 0x15, 0x31,
-    0x47, 0x99, 0x5C, 0x48, 0x85, 0x49, 0x05, 0x8A, 0xCB, 0x93, 0x58, 0x28, 0x4D, 0xD0, 0x5D, 0xF8,
-    0x47, 0x41, 0x21, 0x29, 0x69, 0xA3, 0x93, 0xAB, 0x90, 0xB9, 0xF1, 0x70, 0xAB, 0xE9, 0xA0, 0x98,
-    0x1E, 0x03, 0xE5, 0x93, 0xD0, 0xCA, 0xA2, 0x0A, 0xD2, 0xA8, 0x94, 0xFE, 0xC6, 0x58, 0x7A, 0x41,
-    0x75, 0x29, 0xB8, 0x3D, 0xF2, 0xCA, 0xE1, 0x4F, 0x0A, 0x65, 0x9A, 0x84, 0xAA, 0xE1, 0xC7, 0xCA,
-    0x2F, 0x0F, 0x13, 0xC3, 0xAB, 0xD1, 0xF3, 0x9C, 0xBC, 0x1A, 0x8C, 0x24, 0xE9, 0xBA, 0x76, 0x3A,
-    0x93, 0xE1, 0x84, 0x4B, 0xCA, 0x4C, 0x32, 0xD9, 0xDE, 0x6A, 0x81, 0x3D, 0x08, 0xE6, 0x19, 0x88,
-    0x58, 0x9E, 0x44, 0x8D, 0xCC, 0x1F, 0xE2, 0xF4, 0x86, 0x20, 0xA7, 0x1F, 0x90, 0xFB, 0x79, 0xB3,
-    0xA7, 0x28, 0x08, 0x08, 0xA6, 0xEE, 0x65, 0x7E, 0xE4, 0xE9, 0x29, 0x41, 0xB1, 0x01, 0x06, 0xD6,
-    0xCC, 0xED, 0x08, 0x8F, 0x38, 0x99, 0x02, 0xAD, 0x94, 0xA0, 0xC5, 0x72, 0x72, 0x15, 0x54, 0x25,
-    0xEA, 0x2E, 0xF7, 0xCB, 0x14, 0x78, 0x24, 0xEF, 0x9E, 0x59, 0xDE, 0xB1, 0x77, 0x8E, 0x39, 0xD9,
-    0xA3, 0xEC, 0x35, 0x8A, 0xC9, 0xDA, 0x03, 0x7D, 0x09, 0xD3, 0x01, 0x86, 0x15, 0xFC, 0x7D, 0xDB,
-    0xA8, 0xC4, 0x9E, 0x7E, 0x12, 0x17, 0x6F, 0xCC, 0xF2, 0x1B, 0xB3, 0x2B, 0x6F, 0xAA, 0x88, 0xFE,
-    0x7B, 0x3D, 0xB4, 0xD2, 0x5B, 0x68, 0x0F, 0x64, 0x79, 0x5D, 0xB0, 0x49, 0x20, 0xA4, 0x85, 0xFC,
-    0x3A, 0xA6, 0x58, 0x1B, 0x41, 0x1A, 0x9B, 0x7F, 0xD2, 0x97, 0x45, 0x6C, 0xE9, 0xE4, 0xFF, 0x95,
-    0x7E, 0xFB, 0x6F, 0x6B, 0x47, 0x0E, 0x3B, 0x61, 0xAD, 0x28, 0x8B, 0xB7, 0x2F, 0x3B, 0x49, 0x0E,
-    0xE8, 0x26, 0x2B, 0x24, 0x38, 0xEC, 0x6E, 0xDA, 0x82, 0x83, 0xD3, 0xEE, 0xE5, 0x84, 0x8A, 0x03,
-    0x72, 0x58, 0x50, 0x1D, 0x2E, 0x4F, 0xF6, 0x54, 0x68, 0x50, 0x20, 0x8D, 0x96, 0x8A, 0x7F, 0x06,
-    0x49, 0x6B, 0xE3, 0xD4, 0xE5, 0x0D, 0x39, 0x14, 0x18, 0x7D, 0x81, 0x16, 0x56, 0xAA, 0xBC, 0x00,
-    0x4F, 0x4E, 0x49, 0xD3, 0x52, 0xB8, 0x58, 0x31, 0x1E, 0x51, 0xDE, 0x71, 0xD5, 0xB7, 0xA4, 0x13,
-    0xC2, 0x5E, 0x48, 0x27, 0xE2, 0x18, 0x0D, 0x09, 0x81, 0x8C, 0x56, 0xB8, 0x5B, 0xD8, 0x1F, 0x30,
-    0x81, 0xCB, 0x98, 0xF3, 0x85, 0xBB, 0xE7, 0xA8, 0x76, 0x57, 0xAC, 0x2E, 0x50, 0x9D, 0xA2, 0x11,
-    0xBF, 0x86, 0xF4, 0xD9, 0x2F, 0xD1, 0x48, 0x8D, 0x46, 0xF6, 0x15, 0x48, 0xB9, 0x41, 0xEE, 0xF6,
-    0x59, 0xCC, 0xCE, 0xCA, 0x54, 0x75, 0x32, 0x73, 0x7D, 0x39, 0x97, 0x87, 0xCE, 0x05, 0x4B, 0xAA,
-    0x2C, 0x67, 0xE6, 0x56, 0xAE, 0x9B, 0xEB, 0x77, 0x47, 0xEA, 0xFD, 0xDA, 0xCA, 0x77, 0x59, 0x2E,
-    0x23, 0xE5, 0xDF, 0x69, 0x79, 0x1E, 0x99, 0xEC, 0x70, 0xFF, 0xB9, 0xDE, 0x9C, 0x52, 0x2C, 0xE3,
-    0x74, 0x03, 0xA6, 0x25, 0x27, 0xEE, 0x57, 0x03, 0x19, 0x8A, 0x93, 0x27, 0x66, 0xB3, 0x0E, 0x0C,
-    0x5B, 0xED, 0x13, 0x9D, 0xAA, 0x66, 0x85, 0x5D, 0x39, 0x20, 0x08, 0x8B, 0xE1, 0x1B, 0xD4, 0x1D,
-    0x7E, 0xE3, 0x0B, 0xBB, 0xBD, 0x8C, 0x30, 0xB0, 0x11, 0xF8, 0x6D, 0x33, 0xD9, 0x62, 0x72, 0x4F,
-    0xCA, 0x58, 0xB1, 0x26, 0xD2, 0x1A, 0xF0, 0x61, 0x27, 0xBD, 0x20, 0x4F, 0x14, 0x55, 0xC2, 0xCA,
-    0xC9, 0x03, 0x3A, 0xB2, 0x9D, 0x40, 0xD0, 0x20, 0x14, 0xDE, 0xAA, 0x51, 0x3E, 0x3E, 0x26, 0xD9,
-    0x94, 0x69, 0x84, 0x6C, 0xEE, 0xDD, 0xEC, 0xAE, 0x90, 0x31, 0x51, 0x81, 0x24, 0x4E, 0x89, 0x85,
-    0x65, 0x8F, 0x8D, 0x78, 0xB1, 0xA2, 0x10, 0xDF, 0x50, 0x98, 0xC6, 0xC2, 0x61, 0xE9, 0xA2, 0xD7,
-    0x97, 0x18, 0x51, 0xF8, 0x56, 0x85, 0x5A, 0xB0, 0xBC, 0xD2, 0x59, 0xAF, 0x8E, 0xC1, 0xFC, 0x78,
-    0xE0, 0x55, 0xD3, 0xEB, 0xE7, 0xC1, 0x44, 0xFB, 0x40, 0x2D, 0x40, 0xCB, 0x80, 0x0F, 0xC8, 0x69,
-    0x28, 0x4E, 0xE6, 0xD4, 0x6F, 0x35, 0xD4, 0x56, 0x0B, 0x43, 0xD9, 0x80, 0xA4, 0x81, 0xF2, 0x35,
-    0x10, 0x0F, 0x5F, 0x5D, 0xE1, 0x44, 0xF6, 0xF8, 0x2B, 0x00, 0xB8, 0x90, 0xDC, 0xF1, 0xF5, 0x49,
-    0x63, 0x2C, 0xAF, 0x2B, 0xA3, 0xBB, 0x7E, 0x61, 0xE9, 0x36, 0x56, 0xFB, 0x29, 0x63, 0x6C, 0x1C,
-    0xCB, 0x53, 0x37, 0x40, 0xDE, 0xFC, 0x95, 0x7C, 0x09, 0xC1, 0x6B, 0x11, 0xD2, 0x7D, 0x19, 0x95,
-    0xA0, 0x01, 0x77, 0xFF, 0xD9, 0x46, 0x57, 0x04, 0xE3, 0x51, 0x5C, 0xFB, 0x78, 0xDE, 0x48, 0x47,
-    0xAA, 0xFE, 0xFA, 0x85, 0xD7, 0x4B, 0xE2, 0x96, 0x56, 0x96, 0xF3, 0xF7, 0x42, 0xE6, 0xDE, 0x94,
-    0x47, 0xC5, 0xD9, 0xA8, 0x49, 0xFB, 0xDF, 0x56, 0x69, 0xE7, 0x2F, 0xD9, 0x6F, 0xF3, 0x15, 0x6C,
-    0xAF, 0x0A, 0xA4, 0x50, 0x8E, 0xDF, 0xD7, 0x75, 0x8E, 0x8D, 0xAA, 0x18, 0x0D, 0xA6, 0x2E, 0x92,
-    0xD5, 0x71, 0xDF, 0x97, 0xE9, 0x8B, 0x73, 0x0C, 0x2F, 0x91, 0x55, 0x10, 0xFE, 0xFD, 0xE9, 0x5A,
-    0x19, 0xB9, 0xF0, 0x6A, 0x65, 0x71, 0xAF, 0x50, 0x45, 0xD3, 0xAE, 0x6B, 0x80, 0x0A, 0x44, 0xCE,
-    0xF0, 0x56, 0xD2, 0xFF, 0xD4, 0xC4, 0xC5, 0x4E, 0x61, 0xB0, 0x0D, 0x5C, 0xAE, 0xC6, 0x59, 0x08,
-    0x1A, 0xFB, 0xE0, 0x7F, 0x8A, 0x78, 0x76, 0x45, 0x56, 0x15, 0xB3, 0xEC, 0xD8, 0x8F, 0xB7, 0x92,
-    0xBA, 0x22, 0xC6, 0x03, 0x05, 0x00, 0x30, 0xFB, 0xB1, 0x3E, 0xA1, 0xD5, 0xA3, 0x3C, 0x76, 0xB2,
-    0x53, 0xF3, 0x9A, 0xDE, 0x83, 0xFF, 0xB3, 0x19, 0xB9, 0xFF, 0xFB, 0xFD, 0x8F, 0x9F, 0x2D, 0x6D,
-    0x31, 0xBB, 0xB2, 0x14, 0xCC, 0x1F, 0x6C, 0x16, 0x67, 0xD6, 0xC5, 0x2E, 0x8A, 0x6F, 0xA0, 0xD8,
-    0x53, 0x65, 0xB4, 0x14, 0xB5, 0x14, 0x02, 0x78, 0x54, 0x69, 0x07, 0xCB, 0x0B, 0xD7, 0x27, 0x17,
-    0xAE, 0xE7, 0x6B, 0xC1, 0x7E, 0x6F, 0x10, 0xE2, 0x37, 0x8A, 0xBF, 0x91, 0xE2, 0x09, 0x05, 0xEE,
-    0x0E, 0xD2, 0x45, 0xE1, 0xEF, 0x9F, 0x5E, 0x85, 0x85, 0x03, 0x88, 0xC0, 0xA0, 0xA6, 0xD8, 0xF3,
-    0xE9, 0x6C, 0xD6, 0x83, 0x63, 0x90, 0xE3, 0x6C, 0x6A, 0x0E, 0x34, 0xF5, 0x80, 0x57, 0x00, 0xBD,
-    0xDF, 0x3A, 0x7B, 0x04, 0x15, 0x70, 0x8E, 0xC2, 0x3A, 0x08, 0x07, 0x22, 0xB4, 0xFD, 0x29, 0xB0,
-    0x0A, 0x22, 0x9A, 0x17, 0x56, 0x63, 0x0E, 0x35, 0x9B, 0x23, 0x4C, 0x94, 0x80, 0x43, 0x50, 0x90,
-    0xEE, 0xC6, 0x14, 0x26, 0x1D, 0xE1, 0x71, 0x4A, 0x63, 0xB9, 0x6B, 0x80, 0x9D, 0xAA, 0xE0, 0x52,
-    0xC0, 0x39, 0x39, 0x86, 0x86, 0x0C, 0xC8, 0x28, 0x43, 0x13, 0x7E, 0x25, 0x82, 0x52, 0xAD, 0xC0,
-    0x58, 0x58, 0xFE, 0x86, 0x2C, 0x0F, 0x55, 0x5D, 0x79, 0x9F, 0x48, 0x3F, 0xBD, 0xEB, 0xA7, 0x6B,
-    0x9A, 0x51, 0xAC, 0x9A, 0xC1, 0xAD, 0xDD, 0x59, 0x27, 0x2C, 0x4F, 0xE2, 0x61, 0xA3, 0x81, 0x2F,
-    0x03, 0x0D, 0x9F, 0x2A, 0x60, 0xB6, 0xFB, 0x26, 0x15, 0x34, 0xB6, 0x4A, 0x65, 0xF5, 0x4F, 0x9C,
-    0x05, 0x9D, 0xED, 0xC6, 0x02, 0x0A, 0x63, 0xE1, 0x5D, 0x64, 0xBE, 0xE5, 0x13, 0xA5, 0x22, 0x0F,
-    0xC5, 0x63, 0xF3, 0x0D, 0xF9, 0xD4, 0xF1, 0x58, 0x04, 0xA8, 0xB1, 0x5F, 0xC4, 0x63, 0xD9, 0x01,
-    0x63, 0x11, 0x9A, 0xC6, 0x72, 0x71, 0xBC, 0x27, 0x37, 0x00, 0x0F, 0x4A, 0x47, 0x62, 0x11, 0x8C,
-    0x00, 0x83, 0xCE, 0x25, 0xF7, 0xA2, 0x5B, 0x89, 0x98, 0xD4, 0x46, 0xE0, 0xB6, 0x8C, 0x79, 0xE4,
-    0xED, 0x35, 0x1A, 0x79, 0x58, 0xCF, 0x18, 0x2B, 0x4C, 0x0A, 0x8C, 0x62, 0x3E, 0x23, 0xCE, 0x4F,
-    0x0C, 0xDD, 0x3E, 0x54, 0x17, 0xCF, 0xCA, 0x8D, 0x32, 0x93, 0x10, 0xE6, 0x63, 0xE1, 0x47, 0x63,
-    0x07, 0x53, 0x06, 0x7D, 0x7F, 0x2C, 0x7C, 0x60, 0xB4, 0x8C, 0xC9, 0xF6, 0x0A, 0x3C, 0x43, 0xB8,
-    0x85, 0x2C, 0x25, 0x9B, 0xAC, 0xF4, 0x6F, 0xCC, 0x6A, 0x59, 0xB9, 0xB1, 0x00, 0x54, 0x98, 0x8D,
-    0x0C, 0x24, 0x44, 0x03, 0xAE, 0x77, 0x0C, 0x1C, 0x27, 0xCD, 0x7B, 0xA5, 0x48, 0xAB, 0xB5, 0x57,
-    0x4A, 0xC5, 0x4A, 0x2A, 0x76, 0xA5, 0x42, 0xC0, 0xE0, 0xD6, 0x8E, 0x80, 0x26, 0x88, 0x92, 0x30,
-    0xC0, 0x1E, 0x15, 0xB1, 0xD0, 0x92, 0xA6, 0x2F, 0x08, 0x5E, 0x19, 0xDD, 0x84, 0x12, 0xA0, 0xA1,
-    0x5A, 0x6B, 0x2C, 0x98, 0xEA, 0xBD, 0xD7, 0xAF, 0x88, 0xCC, 0x78, 0xF3, 0x9D, 0x42, 0xD0, 0x9B,
-    0x08, 0x2F, 0xBB, 0x18, 0xDE, 0x28, 0x7C, 0xFD, 0xF9, 0x32, 0x7C, 0xFE, 0x66, 0xB9, 0x17, 0x2C,
-    0x9B, 0x3A, 0x7C, 0xBE, 0x8C, 0xC7, 0xDE, 0xFB, 0x42, 0x71, 0xB2, 0xDD, 0xC6, 0xBB, 0x59, 0x86,
-    0xAD, 0x69, 0x6A, 0xC1, 0xF2, 0x32, 0x58, 0x91, 0xD2, 0x5F, 0xCF, 0x00, 0xD9, 0x63, 0x05, 0xCB,
-    0xA3, 0x3F, 0x93, 0xC9, 0x22, 0x86, 0x2E, 0x49, 0xF5, 0x49, 0xD3, 0xBB, 0x7D, 0x54, 0x5B, 0x2C,
-    0x3B, 0xDF, 0x81, 0x24, 0x9D, 0xBE, 0x98, 0x02, 0xC7, 0xE6, 0xD4, 0x30, 0xC5, 0x96, 0x63, 0x6D,
-    0xD2, 0x81, 0x85, 0x9B, 0x5A, 0x11, 0x71, 0x40, 0x2C, 0xDC, 0x21, 0x71, 0xD2, 0x42, 0x81, 0xB4,
-    0x7F, 0xB2, 0x05, 0x92, 0x4A, 0x04, 0xFE, 0x33, 0xE2, 0x5C, 0x79, 0x7A, 0xCB, 0xCF, 0x6C, 0x86,
-    0x4D, 0x34, 0xFF, 0xB0, 0x1F, 0x32, 0x0E, 0x5F, 0x14, 0x52, 0xF3, 0x0B, 0x41, 0x81, 0xFD, 0xF5,
-    0x9D, 0x4A, 0x96, 0xBE, 0x93, 0x1D, 0x07, 0xFE, 0x1F, 0xB4, 0x85, 0x77, 0x41, 0xBF, 0xEA, 0xBF,
-    0x05, 0xCE, 0xAC, 0xD1, 0x81, 0x41, 0xB4, 0x09, 0xDF, 0x80, 0xEA, 0xAC, 0x07, 0xF6, 0xAA, 0xFD,
-    0x26, 0xBC, 0x22, 0xE8, 0xF1, 0x57, 0x02, 0xE1, 0x8D, 0x93, 0xA8, 0x96, 0x69, 0x69, 0x69, 0x5E,
-    0x33, 0xA8, 0x9D, 0x96, 0x07, 0x0C, 0x8F, 0xB0, 0x33, 0x5D, 0x22, 0xE3, 0x71, 0xFA, 0xC9, 0x0F,
-    0xB1, 0xBD, 0x73, 0xBD, 0x84, 0x5B, 0xA6, 0xAA, 0x54, 0xA6, 0xE6, 0x3D, 0xD3, 0x5F, 0x5A, 0x24,
-    0x0F, 0x99, 0x27, 0xD8, 0x77, 0x2E, 0x41, 0xAA, 0x3B, 0x09, 0xFE, 0xF9, 0x14, 0xC0, 0x0A, 0xB2,
-    0xFE, 0xEF, 0x66, 0xDD, 0x2C, 0x83, 0x72, 0x03, 0x68, 0x7B, 0x64, 0x95, 0xE3, 0xF7, 0xFB, 0x15,
-    0x56, 0xD0, 0xEF, 0x65, 0x94, 0x6B, 0xBC, 0x4A, 0xD8, 0x02, 0x58, 0x0B, 0x5B, 0x9A, 0x55, 0xA7,
-    0x54, 0xD8, 0x85, 0x82, 0xEE, 0x00, 0xA1, 0x82, 0xF4, 0x42, 0xC1, 0xE9, 0x0E, 0x34, 0xCE, 0x31,
-    0x34, 0x54, 0x60, 0x7B, 0x6E, 0x43, 0xAF, 0xB7, 0x69, 0x33, 0x8C, 0xAD, 0x76, 0x1C, 0x43, 0x01,
-    0x99, 0x16, 0xD1, 0xC8, 0x81, 0xFA, 0x3E, 0x87, 0xE2, 0x77, 0x83, 0x62, 0x92, 0xB8, 0x40, 0x35,
-    0x73, 0xDC, 0x29, 0x69, 0x73, 0x00, 0xFE, 0x00, 0xFA, 0x5A, 0x41, 0x2C, 0x17, 0x7E, 0xD9, 0x9A,
-    0x3C, 0xA9, 0x03, 0x91, 0x97, 0x64, 0xEB, 0x5C, 0x5D, 0xC9, 0xBD, 0x2D, 0x94, 0x3B, 0xC1, 0x3B,
-    0x95, 0x9C, 0xA6, 0x53, 0x39, 0xF5, 0x84, 0xD0, 0xD5, 0xA0, 0x7A, 0x72, 0x7A, 0x13, 0xB5, 0xD3,
-    0x38, 0x09, 0xB3, 0xF0, 0x67, 0x8D, 0xA9, 0x9D, 0x26, 0x94, 0xAD, 0x95, 0x66, 0x71, 0x51, 0xEF,
-    0x94, 0x86, 0x8A, 0x4A, 0xA7, 0xA7, 0x9E, 0x61, 0xE7, 0xE7, 0xF7, 0xD3, 0x1D, 0x9C, 0x82, 0x7A,
-    0x00, 0x15, 0x26, 0x0B, 0x2A, 0xBF, 0xA0, 0xD1, 0x02, 0xD6, 0xFC, 0xB6, 0xB0, 0xED, 0x50, 0xA3,
-    0x60, 0x1E, 0x02, 0xB9, 0xCD, 0xED, 0xA0, 0x45, 0x2A, 0x94, 0x89, 0x07, 0x72, 0x5A, 0x50, 0xA4,
-    0x13, 0xAC, 0x90, 0xF8, 0x95, 0x80, 0xF4, 0x02, 0xCC, 0x41, 0x31, 0x06, 0x0F, 0x2F, 0x5C, 0x27,
-    0xE6, 0x36, 0x28, 0xA8, 0x48, 0x26, 0x3C, 0x3E, 0x68, 0xD5, 0xB5, 0x49, 0xFA, 0x1D, 0x98, 0x27,
-    0xAA, 0x5E, 0x2D, 0x6B, 0x5C, 0x61, 0x65, 0x5A, 0xAB, 0x81, 0x90, 0x3F, 0x0E, 0x10, 0xBA, 0x0D,
-    0x4D, 0x1F, 0xF8, 0x2A, 0x03, 0xF5, 0x92, 0xE9, 0x37, 0xBE, 0xE6, 0x32, 0xDB, 0xFD, 0x2C, 0x7F,
-    0x1F, 0x2D, 0xEC, 0xEC, 0x5B, 0x90, 0x1B, 0x00, 0x72, 0xFD, 0x55, 0x90, 0xE1, 0x8A, 0x5B, 0x55,
-    0x16, 0x5F, 0x36, 0xAB, 0xFB, 0xF0, 0xBF, 0x7C, 0x30, 0x49, 0x5F, 0x9C, 0x34, 0x29, 0x25, 0x85,
-    0xD7, 0x58, 0x36, 0x63, 0x5E, 0xC9, 0x62, 0x1E, 0x96, 0x1F, 0xE7, 0x61, 0xF2, 0xEC, 0xFE, 0x64,
-    0xE7, 0xE7, 0x31, 0x1F, 0xDB, 0xD9, 0xC3, 0x9A, 0x9A, 0x1C, 0x7B, 0xF8, 0xF3, 0x14, 0xFA, 0xC3,
-    0x1C, 0xC5, 0xD7, 0xF2, 0x64, 0x60, 0x7F, 0x37, 0x8A, 0x17, 0x61, 0x6B, 0x57, 0xCC, 0x25, 0x53,
-    0x3E, 0x4A, 0x84, 0x70, 0x0A, 0x91, 0x6E, 0x38, 0x6C, 0x14, 0xED, 0x70, 0x26, 0x54, 0x73, 0xF4,
-    0xE2, 0xCE, 0x0A, 0xF7, 0x09, 0x50, 0xC9, 0xFE, 0xC6, 0x13, 0x22, 0x88, 0xB0, 0x3E, 0x98, 0x2B,
-    0x87, 0x26, 0x9D, 0xDD, 0xF8, 0xA0, 0xF2, 0x83, 0x73, 0x52, 0x09, 0x40, 0xDE, 0x05, 0x2B, 0x25,
-    0x95, 0xC2, 0x59, 0x43, 0x39, 0xF1, 0x94, 0xDC, 0x19, 0x94, 0xBB, 0xE0, 0xA7, 0x70, 0xE7, 0x1C,
-    0x95, 0xA9, 0xB3, 0x6A, 0xBF, 0xDC, 0x67, 0xB8, 0x33, 0x8B, 0x9E, 0x91, 0x81, 0xF9, 0x00, 0xC0,
-    0xA3, 0x96, 0xF9, 0x83, 0xB3, 0x60, 0xBD, 0x33, 0x34, 0x29, 0x64, 0x0B, 0x5A, 0x10, 0x69, 0x63,
-    0x1A, 0x13, 0xF7, 0x05, 0x82, 0x03, 0xE3, 0xF0, 0xDA, 0x73, 0xE0, 0xBF, 0xB2, 0x5E, 0x25, 0x06,
-    0x68, 0xD9, 0x85, 0xB2, 0x7B, 0x50, 0xDF, 0x91, 0xBF, 0x1F, 0x88, 0xFF, 0x89, 0xC9, 0x79, 0xC0,
-    0x64, 0x48, 0x1D, 0x6A, 0xAC, 0x18, 0x4D, 0x4D, 0x23, 0x5E, 0xFD, 0xFD, 0x93, 0xBD, 0xEC, 0x6A,
-    0x11, 0xD3, 0x0B, 0x6A, 0xDB, 0xED, 0x84, 0xC2, 0xC4, 0x17, 0xE3, 0xE9, 0xD8, 0x2D, 0xD7, 0xD2,
-    0x25, 0xA8, 0x29, 0x68, 0x68, 0x03, 0x0A, 0x0C, 0x6B, 0x40, 0x4D, 0xDD, 0x50, 0x13, 0x3F, 0xCB,
-    0xB2, 0xAF, 0x0E, 0x4A, 0x8F, 0x35, 0x7A, 0x55, 0xEF, 0xC4, 0xAF, 0x56, 0x68, 0x41, 0x58, 0x1C,
-    0x70, 0xA0, 0x4B, 0xB6, 0x2C, 0xBB, 0x47, 0x99, 0x50, 0x62, 0xA1, 0x9D, 0xBE, 0x15, 0x76, 0xBE,
-    0x0D, 0x6F, 0xCD, 0xDA, 0xD1, 0x72, 0x9B, 0x2E, 0xC8, 0x3E, 0x9D, 0x87, 0xFB, 0x93, 0xB9, 0xAF,
-    0x46, 0x6B, 0x19, 0x23, 0xD5, 0x2A, 0x73, 0xD9, 0xCA, 0x73, 0xC1, 0x01, 0x30, 0xE3, 0xCD, 0x65,
-    0xB4, 0xF3, 0x14, 0x83, 0xFA, 0xAA, 0x35, 0x44, 0x10, 0xE9, 0x95, 0x58, 0x2B, 0xA9, 0xF8, 0xFA,
-    0x86, 0x54, 0xF3, 0xF0, 0x18, 0x3F, 0x95, 0x8F, 0xC1, 0x8C, 0x42, 0x68, 0x0D, 0x96, 0x5B, 0x8A,
-    0xAE, 0x87, 0xF8, 0x1C, 0x68, 0x5F, 0x55, 0xB7, 0x58, 0x41, 0xBC, 0x99, 0x5D, 0x02, 0xCE, 0x04,
-    0x2A, 0xAE, 0xAC, 0x24, 0xC7, 0x4B, 0x9F, 0x39, 0x6B, 0xE2, 0xA8, 0x2F, 0xBC, 0xDB, 0x80, 0x98,
-    0x95, 0xDB, 0x78, 0x80, 0x3C, 0x99, 0x96, 0x98, 0x3A, 0xF8, 0xD8, 0x3C, 0xE0, 0xC9, 0x5A, 0x4C,
-    0xDC, 0x3C, 0x11, 0x11, 0xC2, 0xB9, 0xDC, 0x58, 0xFF, 0x94, 0xFE, 0xA2, 0x31, 0x3F, 0x00, 0x83,
-    0xE9, 0x57, 0x34, 0xBE, 0x1D, 0x58, 0xCB, 0x3F, 0xA4, 0x28, 0xA0, 0x7E, 0x3F, 0x9B, 0xB4, 0x78,
-    0x71, 0xB0, 0x27, 0xD2, 0xC9, 0x44, 0xE6, 0x04, 0x30, 0xB2, 0xBA, 0x37, 0x2D, 0x56, 0xBD, 0x6E,
-    0x21, 0x2D, 0x3D, 0xBF, 0xFF, 0x65, 0x21, 0xA4, 0x44, 0xBD, 0x0B, 0xB5, 0x3B, 0x45, 0xFB, 0x6A,
-    0x5A, 0xDD, 0x91, 0xCF, 0x68, 0xA5, 0xAA, 0xDE, 0x46, 0xEF, 0x68, 0x7E, 0x6C, 0xD2, 0x6F, 0xCB,
-    0xB4, 0x42, 0x9E, 0x14, 0xEE, 0xF8, 0xB1, 0xE8, 0xB5, 0x8A, 0xF0, 0x59, 0xC7, 0xC2, 0x03, 0x35,
-    0x87, 0x0B, 0xF3, 0xD8, 0x63, 0xE3, 0x71, 0x1C, 0x9F, 0x39, 0x63, 0x15, 0x28, 0xE5, 0xBD, 0xFF,
-    0x99, 0xC7, 0x84, 0x19, 0xF5, 0x2B, 0xA5, 0x65, 0x4A, 0xC9, 0x1E, 0xC8, 0x11, 0x67, 0x6C, 0x46,
-    0xFF, 0x65, 0xE7, 0x6A, 0x5F, 0xE6, 0x85, 0x75, 0x78, 0x59, 0x1F, 0xA6, 0xB3, 0x5C, 0x2D, 0xF1,
-    0xA3, 0x23, 0x0F, 0xC0, 0x7C, 0x8D, 0xE2, 0x3E, 0x1E, 0x4A, 0xA2, 0x39, 0xC1, 0x7F, 0x16, 0x03,
-    0xD6, 0x8A, 0xF9, 0x56, 0x3C, 0x38, 0x7A, 0x80, 0xC6, 0x32, 0x71, 0xEB, 0xFF, 0x51, 0x01, 0x17,
-    0x56, 0x44, 0x84, 0x7D, 0x41, 0xE4, 0xB9, 0xBF, 0xC1, 0xDB, 0xEF, 0x72, 0x21, 0x28, 0xFE, 0x57,
-    0x44, 0x36, 0x6A, 0x87, 0x35, 0x96, 0xA1, 0xDB, 0xBE, 0x04, 0x44, 0x4E, 0x69, 0x13, 0x6C, 0x44,
-    0x37, 0xBB, 0x7C, 0x6B, 0xD6, 0x3F, 0xCD, 0x4B, 0xB9, 0xFE, 0xAA, 0xE1, 0xAF, 0xA0, 0xE9, 0x05,
-    0x1D, 0xB8, 0x7A, 0x70, 0x49, 0x90, 0x71, 0x4C, 0x13, 0x44, 0xD2, 0xC0, 0xF4, 0x58, 0xDC, 0xB1,
-    0x27, 0xD4, 0x52, 0x10, 0x00, 0x05, 0xDF, 0xB1, 0x27, 0xCA, 0x61, 0x4F, 0xB4, 0x1F, 0x79, 0x4F,
-    0xC0, 0x51, 0x04, 0xD8, 0xA5, 0x55, 0xC4, 0x02, 0xAF, 0x95, 0x20, 0xD9, 0x10, 0x75, 0x1E, 0x92,
-    0x88, 0xF2, 0xB2, 0xB5, 0x3C, 0x40, 0xAA, 0x83, 0x5B, 0x20, 0xD9, 0x87, 0x1F, 0x3E, 0x74, 0x91,
-    0x0A, 0x62, 0x9B, 0x48, 0xD7, 0xB5, 0x09, 0x7F, 0xDA, 0xA8, 0xB1, 0xF1, 0xE4, 0x3F, 0x1D, 0x38,
-    0x96, 0xC8, 0xF8, 0xA6, 0x53, 0xCB, 0x5F, 0xBF, 0xBA, 0x12, 0x64, 0x9A, 0x4A, 0xF7, 0x80, 0xE9,
-    0x1C, 0x58, 0x8D, 0x31, 0x32, 0x72, 0x41, 0xB5, 0xAC, 0x11, 0xA6, 0xC8, 0xFF, 0x69, 0xAD, 0xDA,
-    0x60, 0x68, 0x6E, 0xBD, 0xF7, 0x80, 0x20, 0x60, 0xCA, 0xAA, 0x36, 0x0C, 0xBC, 0x03, 0xB2, 0xC3,
-    0xB0, 0xA2, 0x42, 0x96, 0xAD, 0x54, 0xC7, 0x83, 0xB4, 0xB0, 0xB0, 0xF4, 0xA1, 0xA5, 0x87, 0xC9,
-    0xA4, 0x1D, 0xA4, 0x10, 0x62, 0xFD, 0xCD, 0x8F, 0x8C, 0x51, 0x35, 0xA2, 0x10, 0x1B, 0x80, 0x30,
-    0xD2, 0x98, 0xB8, 0x56, 0xA5, 0x08, 0xE0, 0x64, 0x68, 0x48, 0x4C, 0xF0, 0xEB, 0x5A, 0xDD, 0xA9,
-    0x22, 0x7A, 0x14, 0x04, 0x3F, 0xA5, 0x83, 0x13, 0x71, 0x7B, 0x04, 0xB5, 0x7D, 0x2B, 0x93, 0x6D,
-    0xA8, 0x05, 0x8A, 0x61, 0x1A, 0x48, 0x65, 0xDE, 0x13, 0x32, 0x7E, 0x6D, 0x4D, 0x61, 0x5F, 0x04,
-    0x13, 0xAF, 0x72, 0x1A, 0xB7, 0x6A, 0x65, 0x9C, 0x32, 0xF1, 0xD0, 0x05, 0x08, 0x7D, 0xA2, 0xEC,
-    0xEF, 0x57, 0x7B, 0x2E, 0xD0, 0x56, 0x2C, 0x9C, 0xEA, 0xAB, 0xF2, 0xD4, 0xFD, 0x15, 0xFB, 0x1D,
-    0xBE, 0x67, 0xFC, 0xDB, 0xD8, 0xCA, 0x25, 0xD9, 0x40, 0xAF, 0x15, 0x92, 0x91, 0x70, 0x7A, 0x82,
-    0xB5, 0x70, 0x22, 0x1B, 0x0C, 0x93, 0xFB, 0x8B, 0x92, 0x3B, 0x8A, 0x2C, 0x18, 0xC4, 0x03, 0x19,
-    0xCE, 0x1E, 0x9D, 0x04, 0xD0, 0x9E, 0xB4, 0xDC, 0x44, 0xD8, 0xBF, 0x51, 0x56, 0xCB, 0xAF, 0x5D,
-    0x59, 0x25, 0x0F, 0x4E, 0x6F, 0x73, 0x69, 0xD9, 0x2B, 0xFD, 0x52, 0x18, 0xCB, 0xB9, 0xAC, 0xF6,
-    0x07, 0x2B, 0x98, 0x6E, 0x47, 0xE1, 0x2B, 0xF2, 0xAB, 0xAB, 0xC5, 0x1E, 0xDA, 0xDB, 0xF3, 0xDE,
-    0x11, 0x8E, 0xB9, 0x4F, 0x46, 0x0D, 0x97, 0xAA, 0x27, 0x68, 0xC3, 0xDE, 0x15, 0x25, 0x83, 0xF2,
-    0x1F, 0x70, 0xE0, 0x4C, 0xBA, 0x09, 0x74, 0x99, 0xA4, 0x49, 0xD0, 0x1C, 0xAB, 0x13, 0xC0, 0xDC,
-    0x0C, 0xAC, 0x95, 0xDE, 0xD9, 0xCD, 0x2E, 0x72, 0x93, 0x66, 0xB8, 0xAB, 0xE1, 0xE6, 0x85, 0x7E,
-    0x46, 0xD6, 0x1F, 0xEA, 0x4E, 0x55, 0x4A, 0x53, 0x43, 0x2D, 0x95, 0x20, 0xDE, 0x46, 0x39, 0x2E,
-    0xA1, 0x65, 0x37, 0x2E, 0xCB, 0x64, 0x02, 0x29, 0xC8, 0xCF, 0xF7, 0x2D, 0x6D, 0x6D, 0xB6, 0x0A,
-    0x36, 0xCB, 0xE2, 0x6B, 0xDD, 0x2C, 0x39, 0x7C, 0x55, 0x8B, 0x6E, 0x76, 0xCE, 0xAA, 0x54, 0xE8,
-    0xA7, 0x06, 0xBB, 0xA0, 0xBA, 0xA9, 0x35, 0xCA, 0xA7, 0xB3, 0x90, 0xED, 0xD5, 0x4E, 0x2E, 0x40,
-    0x69, 0xD7, 0x43, 0xF8, 0xE8, 0x06, 0x70, 0x07, 0x1E, 0xE9, 0x61, 0x59, 0x87, 0x06, 0x35, 0x07,
-    0x01, 0xBF, 0x0C, 0xCB, 0xA2, 0x5C, 0xFF, 0x8F, 0x15, 0x0D, 0x7A, 0x72, 0x49, 0x55, 0x72, 0xBE,
-    0x8A, 0x92, 0xD4, 0x5F, 0x56, 0x6A, 0x18, 0x5C, 0x2A, 0xD2, 0xB9, 0x91, 0xDF, 0x98, 0xCD, 0xD4,
-    0x97, 0x8F, 0xFA, 0xC7, 0x1E, 0xEE, 0x07, 0xBE, 0xE2, 0x23, 0x6B, 0xE5, 0xB0, 0x38, 0x4B, 0x7F,
-    0xE5, 0xAA, 0x40, 0x6A, 0x37, 0x48, 0xA0, 0x98, 0x12, 0x9E, 0xA0, 0x50, 0xBA, 0x76, 0x93, 0x9D,
-    0x58, 0xFD, 0xEE, 0x1A, 0x9A, 0xC9, 0x8A, 0xB5, 0xDB, 0x2C, 0xA9, 0x8D, 0x54, 0xD5, 0xE0, 0xA0,
-    0x7A, 0x81, 0x86, 0xFC, 0xC5, 0xBD, 0x58, 0x9D, 0x44, 0xD0, 0x54, 0xAC, 0x7E, 0x4C, 0x80, 0xFD,
-    0x58, 0x16, 0x6E, 0xC2, 0x9E, 0x54, 0xC4, 0xBA, 0x5E, 0x85, 0x95, 0x8A, 0x95, 0xB0, 0xFA, 0xD5,
-    0xFA, 0x5E, 0x57, 0x3D, 0xF4, 0xF6, 0x4F, 0x82, 0x69, 0xED, 0xDB, 0xD8, 0x9A, 0x9D, 0xCD, 0xA3,
-    0x6B, 0x5D, 0x3E, 0xC9, 0x8B, 0x47, 0xA3, 0x41, 0xA4, 0x33, 0x4E, 0xED, 0xF3, 0x5B, 0x18, 0xDC,
-    0xE8, 0xAF, 0x69, 0x18, 0xC5, 0x8D, 0x41, 0xA1, 0xC8, 0x1F, 0xA2, 0x73, 0x37, 0xB3, 0xBE, 0x87,
-    0xE4, 0x08, 0xA0, 0x59, 0x1F, 0x07, 0x70, 0x1F, 0x80, 0x54, 0x3B, 0x85, 0x32, 0xC5, 0xAB, 0xC2,
-    0x0C, 0xCE, 0x2D, 0xD0, 0xB8, 0xCC, 0x4D, 0x8D, 0xDD, 0x24, 0xE0, 0x2A, 0x72, 0x99, 0x08, 0x8A,
-    0x05, 0xA8, 0x5D, 0xF4, 0x2D, 0x0A, 0x91, 0x71, 0x22, 0xC3, 0x5D, 0xA8, 0xD2, 0x3B, 0x24, 0x22,
-    0x81, 0x27, 0xDA, 0x4D, 0xAC, 0xC9, 0xB7, 0xE5, 0x99, 0x7B, 0x22, 0x15, 0x12, 0x41, 0x47, 0xD9,
-    0x1C, 0xEB, 0xDF, 0x40, 0x31, 0x2C, 0x34, 0xEC, 0x19, 0x91, 0x68, 0x84, 0x56, 0x2F, 0x83, 0xA2,
-    0x11, 0x5C, 0x4C, 0xBE, 0x35, 0x5C, 0xCE, 0x21, 0x65, 0x08, 0x9D, 0x69, 0xDC, 0xDF, 0xAD, 0x30,
-    0x47, 0x7B, 0xC6, 0x3A, 0x30, 0x43, 0xB9, 0x4C, 0x15, 0x1A, 0x2D, 0x11, 0x34, 0x5E, 0x36, 0x8A,
-    0xCC, 0x1A, 0x15, 0xB2, 0xE5, 0xB0, 0x1B, 0xD1, 0xE7, 0xB9, 0x51, 0xCF, 0xB0, 0x9A, 0xD6, 0x49,
-    0xE2, 0x80, 0x5E, 0x68, 0xD9, 0xE5, 0x95, 0x5D, 0xF9, 0xE1, 0xD0, 0x40, 0xAB, 0xB2, 0xC0, 0x9A,
-    0x3F, 0x5D, 0x01, 0x0B, 0xA4, 0x50, 0x00, 0xCA, 0x48, 0xBD, 0x0A, 0x0A, 0x59, 0xEA, 0xF9, 0x1A,
-    0xD8, 0x59, 0x83, 0x52, 0xCE, 0xF1, 0xAF, 0x51, 0x7D, 0x9F, 0x48, 0xB2, 0xC0, 0x24, 0x0D, 0xA1,
-    0xAA, 0x55, 0xBB, 0x66, 0x2E, 0xE8, 0x31, 0x4D, 0x80, 0x24, 0x7B, 0xA8, 0x46, 0x9D, 0xDB, 0x28,
-    0xBD, 0x9B, 0x50, 0x4E, 0x79, 0xBF, 0x86, 0xCE, 0x2A, 0x90, 0x5D, 0x3D, 0x16, 0xE9, 0x4C, 0x9E,
-    0x36, 0xD9, 0x79, 0x71, 0xAE, 0x44, 0xD6, 0x96, 0x32, 0xBF, 0xE3, 0x28, 0x13, 0xCA, 0x20, 0x04,
-    0x61, 0x2C, 0xAB, 0x20, 0x02, 0x87, 0x88, 0x90, 0xF2, 0x5F, 0x4E, 0xE4, 0xAB, 0x54, 0xCA, 0x25,
-    0xDC, 0xD0, 0x8C, 0xE1, 0x13, 0x3B, 0x85, 0xF9, 0xA0, 0x2F, 0x37, 0x4B, 0x57, 0x55, 0x8C, 0x73,
-    0x92, 0xA5, 0x38, 0xB1, 0x1E, 0x55, 0x84, 0x57, 0x00, 0x14, 0xF9, 0x5B, 0xD9, 0xE2, 0x74, 0xC3,
-    0xCB, 0x61, 0x47, 0xA0, 0x49, 0x41, 0xF6, 0xEB, 0x6D, 0xD9, 0x32, 0xAD, 0x5F, 0xC6, 0xC2, 0x48,
-    0xF8, 0x25, 0x6C, 0xBA, 0x82, 0x8D, 0x0A, 0xBF, 0xA2, 0x17, 0x53, 0xE1, 0x97, 0x30, 0x4B, 0x4A,
-    0xB9, 0x12, 0xAE, 0x48, 0x9E, 0x31, 0xCA, 0x7C, 0xAC, 0x58, 0xC2, 0x12, 0xB8, 0x7B, 0x3E, 0x45,
-    0x39, 0x55, 0x6F, 0x75, 0xBA, 0xAB, 0xAA, 0x0F, 0x9E, 0x7A, 0x76, 0xD1, 0x93, 0x51, 0x5D, 0xF7,
-    0xFC, 0x5F, 0xD5, 0x34, 0x4F, 0x27, 0x04, 0xB5, 0xC4, 0x84, 0xB7, 0x6F, 0x0B, 0xBE, 0x5E, 0x8D,
-    0x64, 0xE6, 0xA6, 0x6E, 0x05, 0xAC, 0x33, 0x82, 0xB7, 0x89, 0x2B, 0xBD, 0x8D, 0x92, 0x91, 0x19,
-    0xC3, 0xFF, 0x04, 0x52, 0xF4, 0xC8, 0x44, 0x7F, 0x5D, 0xC8, 0xD6, 0x6F, 0xF6, 0xD8, 0xBC, 0x6C,
-    0x7F, 0x3C, 0x0B, 0xE2, 0x96, 0xFD, 0x8A, 0x31, 0xC2, 0xD5, 0x06, 0x14, 0xA1, 0xA4, 0x5B, 0x19,
-    0x5D, 0x67, 0x1C, 0x65, 0xCA, 0xB4, 0x8E, 0x86, 0x61, 0x76, 0x8A, 0xB6, 0x9D, 0x7E, 0x36, 0xBB,
-    0xD2, 0xFF, 0x5C, 0x99, 0x9D, 0xDE, 0xC2, 0x44, 0x2F, 0x94, 0xD2, 0x69, 0x83, 0x22, 0x05, 0x34,
-    0x24, 0x73, 0x00, 0xA2, 0x5F, 0x81, 0x7C, 0x02, 0xF0, 0xE7, 0x10, 0x61, 0x00, 0xA6, 0x7E, 0xD9,
-    0x70, 0x27, 0xC4, 0x70, 0xE0, 0x0C, 0x0A, 0x77, 0xD5, 0xD0, 0xCD, 0x46, 0x28, 0x0B, 0x68, 0xAD,
-    0x69, 0xE0, 0x03, 0x3A, 0x87, 0x5D, 0xA5, 0xC5, 0xD7, 0xDD, 0x31, 0x7D, 0xF9, 0x85, 0x00, 0x13,
-    0xDD, 0x94, 0xE1, 0x8D, 0xD9, 0x95, 0x22, 0xCC, 0x38, 0x37, 0x63, 0xB5, 0xE2, 0xC3, 0x8C, 0xB6,
-    0x00, 0xAE, 0xC0, 0x46, 0x0A, 0xAF, 0x4D, 0x76, 0x7A, 0xA3, 0x20, 0x41, 0x0C, 0x99, 0xE7, 0x85,
-    0x27, 0xAB, 0xB0, 0x27, 0x0F, 0xCF, 0x62, 0xCC, 0x92, 0x00, 0x43, 0x20, 0x8F, 0x92, 0xCE, 0x8D,
-    0x04, 0x4A, 0xCB, 0xA9, 0x70, 0x8E, 0x4D, 0xF8, 0xBC, 0x4E, 0x55, 0x98, 0x05, 0xB2, 0x46, 0xF5,
-    0x5C, 0xA6, 0x4C, 0x86, 0x92, 0x98, 0xB3, 0xA6, 0x76, 0x3A, 0x13, 0xBE, 0xD2, 0x25, 0x4E, 0x0B,
-    0xE0, 0xA8, 0xE9, 0xE5, 0x0E, 0xDC, 0xE9, 0xC0, 0x7D, 0xE4, 0x8C, 0xDA, 0xC5, 0xEF, 0xD0, 0xBC,
-    0x41, 0x2A, 0x4D, 0xB3, 0x47, 0x66, 0xD0, 0x22, 0xD1, 0x3F, 0xA9, 0xB6, 0x3E, 0x9A, 0xEE, 0xE0,
-    0x41, 0x46, 0xA1, 0xAD, 0xB6, 0x96, 0x2A, 0x7A, 0xCA, 0x2F, 0xCD, 0xA3, 0x79, 0x71, 0x1A, 0x26,
-    0x8A, 0xBE, 0x4B, 0x46, 0xD7, 0xAD, 0xD7, 0x18, 0x5A, 0xED, 0x92, 0x13, 0x67, 0xE1, 0x3A, 0xF0,
-    0x0A, 0x10, 0x9C, 0x33, 0x99, 0xFC, 0xED, 0x86, 0xF1, 0x2A, 0x5A, 0x8E, 0xA0, 0x49, 0xDD, 0x11,
-    0xAA, 0xBB, 0x32, 0xA7, 0xFB, 0x15, 0x24, 0x2A, 0xD5, 0x95, 0x7B, 0x07, 0x0A, 0x37, 0x79, 0xD0,
-    0xD7, 0xF2, 0x0C, 0x5A, 0xD1, 0x00, 0x3D, 0x41, 0x27, 0x9C, 0xFA, 0x40, 0xE8, 0x90, 0x2E, 0x5C,
-    0xA8, 0xE4, 0xC9, 0x5F, 0x94, 0x2D, 0x10, 0x5D, 0x5F, 0x6B, 0xEB, 0xFC, 0x5B, 0xB3, 0x97, 0x65,
-    0xD2, 0x3B, 0xF5, 0x5D, 0x50, 0x37, 0xA8, 0xE0, 0x4D, 0xEC, 0xD6, 0x39, 0xE0, 0xE2, 0x9E, 0xA7,
-    0x21, 0x4F, 0x1B, 0x90, 0xE8, 0xF0, 0x27, 0xB0, 0xAC, 0x35, 0xB4, 0x17, 0x3C, 0x0F, 0x73, 0x41,
-    0x15, 0xAE, 0x62, 0xB7, 0xB3, 0x2E, 0x0B, 0x39, 0xB1, 0xFE, 0x73, 0xDD, 0xDA, 0x29, 0x59, 0x95,
-    0x96, 0x47, 0x9F, 0x3E, 0xBA, 0x36, 0xBC, 0xEA, 0xF7, 0x66, 0x7D, 0x7D, 0xBB, 0x72, 0x17, 0x8E,
-    0xEF, 0xD4, 0x26, 0xBE, 0x26, 0xCF, 0x86, 0xE7, 0x6F, 0x83, 0x8D, 0x26, 0x04, 0xE4, 0x02, 0xDC,
-    0xC8, 0xDE, 0x91, 0x4A, 0x67, 0x1F, 0x95, 0x63, 0x54, 0x86, 0xDF, 0x93, 0x4A, 0x8F, 0x95, 0x35,
-    0xEF, 0x24, 0x53, 0x1B, 0xC2, 0x47, 0xE3, 0x15, 0x01, 0xCF, 0xA8, 0x18, 0xBD, 0xDD, 0xA6, 0xA5,
-    0x4B, 0x98, 0x3A, 0x4D, 0x1F, 0x17, 0xFF, 0xAE, 0x4F, 0xDF, 0xAC, 0x5C, 0x07, 0x47, 0x50, 0x8C,
-    0x11, 0x01, 0xA3, 0x3B, 0xDF, 0x67, 0x82, 0x86, 0xDD, 0x16, 0xC0, 0x13, 0x54, 0x10, 0xCD, 0xE8,
-    0x72, 0x41, 0xCD, 0xB4, 0x09, 0x7F, 0x09, 0x7D, 0xFB, 0xA2, 0xA5, 0xD5, 0xED, 0xFA, 0x64, 0x32,
-    0xC9, 0x37, 0xAC, 0xD9, 0x5A, 0x0B, 0x3A, 0x94, 0xD2, 0x1F, 0xE7, 0x1D, 0xFC, 0xAC, 0xA5, 0xB2,
-    0xF7, 0x2A, 0x56, 0xB6, 0x8E, 0xC0, 0x68, 0xC1, 0x29, 0x27, 0x2A, 0xE1, 0xE0, 0x54, 0x43, 0x80,
-    0xEE, 0xA8, 0xD6, 0xDC, 0xF4, 0x52, 0xA1, 0x46, 0x02, 0xDB, 0x36, 0xBE, 0xB6, 0x53, 0x88, 0x08,
-    0x9A, 0x0A, 0x38, 0x08, 0x62, 0x4A, 0x06, 0xF3, 0xDA, 0x64, 0x72, 0xE1, 0x8D, 0x5E, 0x39, 0xCD,
-    0x7E, 0x6D, 0x67, 0xA3, 0x51, 0x51, 0x48, 0xC3, 0x28, 0x6B, 0x61, 0xB2, 0xD9, 0x77, 0x0F, 0x29,
-    0xC8, 0xA1, 0x01, 0x8C, 0x7E, 0x4B, 0xC7, 0x69, 0xB4, 0x12, 0xFE, 0x2E, 0x64, 0x5F, 0xE4, 0x17,
-    0x10, 0x04, 0x06, 0x47, 0xD5, 0x29, 0x40, 0x4F, 0x1D, 0xE6, 0xD4, 0x92, 0x0F, 0x4F, 0x63, 0xF0,
-    0x4F, 0x96, 0x79, 0x58, 0x90, 0x7F, 0x6E, 0x54, 0x9E, 0x52, 0xF5, 0x06, 0x2A, 0xF8, 0x74, 0x6A,
-    0x86, 0xA4, 0x09, 0x6A, 0xC2, 0x5A, 0x3A, 0xE4, 0xF4, 0xEA, 0x6B, 0xCB, 0xC9, 0xA6, 0xB2, 0x77,
-    0x64, 0xA7, 0x1C, 0xA0, 0x9F, 0x2F, 0x60, 0xAE, 0x90, 0x67, 0x7D, 0x20, 0x3B, 0x6C, 0x8F, 0x0E,
-    0xE2, 0x74, 0xEB, 0xC3, 0xF6, 0x06, 0x56, 0x26, 0x05, 0x07, 0x36, 0xA0, 0x9E, 0x59, 0xB0, 0x80,
-    0xB0, 0xCB, 0x3F, 0x5B, 0xA9, 0x65, 0x9D, 0x84, 0x37, 0x02, 0xEF, 0x87, 0x47, 0x50, 0xCB, 0x7A,
-    0xE9, 0x09, 0x2A, 0x07, 0xE8, 0x59, 0xB6, 0x54, 0x4F, 0x0E, 0x3A, 0x9F, 0x26, 0x78, 0x70, 0x60,
-    0xCA, 0x2D, 0xCD, 0xC8, 0x1F, 0xCF, 0x6C, 0x3C, 0xFE, 0xD4, 0x25, 0x78, 0xA9, 0xA0, 0x79, 0xC8,
-    0x2D, 0x80, 0xD1, 0x1F, 0xC9, 0x48, 0xDD, 0xE5, 0x5F, 0x6C, 0xF5, 0x36, 0xB8, 0x0D, 0x39, 0x05,
-    0x02, 0xE0, 0xBF, 0x83, 0xB1, 0x91, 0x3C, 0x00, 0xDC, 0x21, 0x03, 0x50, 0x8E, 0x29, 0x5D, 0x93,
-    0x7C, 0xE8, 0x4E, 0xF7, 0x94, 0x33, 0xE0, 0xD8, 0x77, 0x05, 0x64, 0xE8, 0x92, 0x30, 0x1A, 0xC3,
-    0xB3, 0xAF, 0xB0, 0x8C, 0x4B, 0x9E, 0x6D, 0xE9, 0x88, 0x00, 0xF9, 0x36, 0xDC, 0xCB, 0x32, 0xFC,
-    0xFD, 0xBB, 0xB9, 0x9E, 0x09, 0x33, 0x18, 0xEA, 0x99, 0x90, 0xFD, 0xB0, 0x1C, 0x1C, 0xDA, 0x75,
-    0xDF, 0x50, 0x49, 0xF8, 0x34, 0x94, 0x78, 0x74, 0xB1, 0x85, 0x1E, 0x0F, 0x13, 0x4A, 0x20, 0x8C,
-    0x5E, 0x20, 0x76, 0xB4, 0xA6, 0x5A, 0xFA, 0xB7, 0x43, 0xA0, 0x96, 0x1F, 0x3C, 0x25, 0x9D, 0x7E,
-    0x9A, 0xDB, 0x02, 0x28, 0x47, 0x51, 0xB3, 0x2C, 0x76, 0xA9, 0xEA, 0x32, 0x41, 0xFA, 0xC9, 0xDC,
-    0x28, 0x55, 0x85, 0x88, 0x07, 0x1A, 0x37, 0xF6, 0x4A, 0x22, 0xCB, 0x12, 0xCE, 0x92, 0x21, 0x39,
-    0x47, 0xE8, 0x3E, 0x23, 0x7A, 0x0E, 0x7B, 0x6F, 0x89, 0xE0, 0x57, 0x60, 0x22, 0x83, 0xF7, 0xE4,
-    0xCA, 0xF5, 0xF3, 0x70, 0x4A, 0x54, 0x5E, 0x0F, 0x77, 0xC2, 0x0D, 0xAA, 0x1F, 0x5C, 0xE8, 0xB8,
-    0xBF, 0x9C, 0xB5, 0xDA, 0xE3, 0x60, 0xF7, 0xC7, 0x9B, 0xE2, 0xA6, 0xFE, 0x45, 0xC3, 0xC5, 0xEF,
-    0xB6, 0xF6, 0xC4, 0xEB, 0x87, 0xB8, 0xB0, 0xB0, 0xDE, 0x56, 0xB2, 0xF5, 0x19, 0x55, 0x99, 0x82,
-    0xDB, 0x57, 0xE4, 0xE2, 0xBC, 0xF6, 0xD9, 0xD6, 0xC5, 0x8E, 0xC5, 0xD6, 0xA5, 0xB2, 0x32, 0x82,
-    0xAB, 0xEC, 0x5C, 0x1D, 0x79, 0xE1, 0x6C, 0x0D, 0xC9, 0x9C, 0x9A, 0x66, 0x7C, 0x60, 0x55, 0x4D,
-    0x20, 0xA7, 0x53, 0x94, 0xA5, 0x3E, 0x3F, 0x28, 0x40, 0x02, 0x79, 0x09, 0x10, 0x15, 0x2B, 0x73,
-    0xBF, 0xA7, 0xBE, 0xE5, 0xAE, 0x0E, 0x5E, 0x98, 0x1D, 0x91, 0xE0, 0xF8, 0x08, 0xB3, 0x10, 0x10,
-    0x85, 0x45, 0x0C, 0x42, 0x9C, 0x43, 0x47, 0x15, 0x8C, 0x9C, 0x3B, 0x9F, 0x03, 0x39, 0x3B, 0x84,
-    0x28, 0x6C, 0x8D, 0x76, 0x7D, 0x32, 0xB7, 0x47, 0xC7, 0xFA, 0xD9, 0xB8, 0x17, 0xAA, 0x43, 0x63,
-    0xF6, 0x54, 0x42, 0x39, 0xC9, 0x36, 0x20, 0x4E, 0x0B, 0x2C, 0x76, 0xAA, 0xC8, 0xA6, 0x2D, 0x4F,
-    0x30, 0x9F, 0xD7, 0x86, 0x45, 0x9E, 0x00, 0x5C, 0x84, 0xE8, 0x61, 0x4F, 0xC2, 0xBD, 0x4C, 0x76,
-    0x53, 0x4A, 0x27, 0x91, 0x05, 0x9B, 0xE7, 0x5C, 0x6A, 0x49, 0x67, 0xD0, 0xED, 0x52, 0xAF, 0x2E,
-    0xCC, 0x80, 0x6A, 0xDD, 0x5A, 0x5B, 0xD0, 0xD6, 0x00, 0x7E, 0x51, 0xE1, 0x37, 0x41, 0x91, 0x67,
-    0xF2, 0x44, 0xF0, 0x74, 0x29, 0x87, 0x7A, 0x52, 0x95, 0x4F, 0xA3, 0xEA, 0xC0, 0x55, 0xEC, 0x73,
-    0x84, 0x62, 0x3A, 0xAF, 0xC0, 0x98, 0x26, 0xD8, 0xD5, 0xEB, 0xFA, 0x7C, 0x19, 0x94, 0x5F, 0x0D,
-    0x4B, 0x4A, 0x28, 0xE4, 0xD9, 0xA8, 0xBE, 0x3B, 0xB6, 0xE0, 0x2D, 0x0C, 0x0C, 0x0C, 0xCA, 0x53,
-    0x41, 0xE5, 0xB5, 0x7D, 0xBA, 0xA4, 0xCE, 0xD3, 0x42, 0x14, 0xB7, 0xF1, 0x57, 0xCD, 0x06, 0xDE,
-    0x1E, 0xE9, 0x24, 0x49, 0xE7, 0xA8, 0xC0, 0x08, 0xB2, 0x1D, 0x82, 0xD3, 0xE7, 0x3E, 0x7B, 0x42,
-    0xA7, 0xBE, 0x5B, 0xEB, 0xDB, 0xF4, 0x3E, 0x3B, 0xB7, 0x4F, 0xDA, 0xAF, 0x17, 0x37, 0x81, 0xCA,
-    0xEF, 0x85, 0x21, 0xA0, 0xCB, 0xD2, 0x32, 0x46, 0xB4, 0xD3, 0xFE, 0x8E, 0xF9, 0xB1, 0x34, 0x87,
-    0x26, 0x92, 0xA0, 0x52, 0xEA, 0x16, 0x70, 0xD3, 0x18, 0x75, 0x08, 0xA1, 0x04, 0xA4, 0x38, 0x6E,
-    0x3A, 0x52, 0xF9, 0xAC, 0xD1, 0x6A, 0x75, 0x4A, 0x1A, 0xDC, 0x92, 0x06, 0xC7, 0x24, 0xBD, 0x0C,
-    0x7C, 0x77, 0x73, 0x45, 0xA5, 0x08, 0xFC, 0xE7, 0xB0, 0x39, 0x62, 0xA9, 0x13, 0x78, 0xE6, 0xF4,
-    0x40, 0x0B, 0x51, 0xB4, 0x1A, 0x97, 0xE6, 0x30, 0xDE, 0xC5, 0xAB, 0x45, 0xA8, 0x87, 0x43, 0xF2,
-    0xD2, 0xEB, 0xBF, 0xDC, 0xEF, 0x9F, 0x87, 0x42, 0xA2, 0xFF, 0x0D, 0x36, 0x9B, 0xDB, 0xB7, 0x27,
-    0xC9, 0x89, 0x3C, 0x6A, 0x95, 0x9F, 0x1A, 0x05, 0x33, 0xCC, 0x4A, 0xAA, 0x0A, 0xBB, 0x1F, 0xF9,
-    0x5C, 0xAC, 0x4B, 0x5F, 0x7F, 0x7C, 0x73, 0x4A, 0xAC, 0x9B, 0xF1, 0x9F, 0xEA, 0xE1, 0x47, 0x47,
-    0xCC, 0x87, 0x75, 0x43, 0x6E, 0xF1, 0xDF, 0xE9, 0xC1, 0x9A, 0x64, 0xFE, 0xFE, 0xDF, 0x9A, 0xBF,
-    0x14, 0xFA, 0x58, 0xD0, 0x01, 0x89, 0x70, 0xEE, 0xAE, 0x38, 0x74, 0xF5, 0x29, 0xB6, 0x0B, 0xB9,
-    0x75, 0x98, 0xDE, 0x71, 0x60, 0x34, 0x1F, 0xF1, 0xEF, 0x54, 0x06, 0x27, 0x40, 0xD6, 0x4B, 0x63,
-    0x7E, 0xEB, 0xF7, 0xE5, 0x4E, 0x21, 0x2B, 0xF9, 0x0B, 0x70, 0x13, 0x69, 0x9F, 0xE4, 0x2D, 0x1D,
-    0x90, 0x69, 0x9C, 0x78, 0x74, 0x32, 0x39, 0xCB, 0xCD, 0xA1, 0xEE, 0x6B, 0x9F, 0x0F, 0xBE, 0xC9,
-    0x79, 0xCF, 0xFE, 0xCD, 0x3F, 0xBB, 0xA3, 0xC3, 0xFF, 0x37, 0xEB, 0x7C, 0xCC, 0xC9, 0xD9, 0xEC,
-    0x65, 0x55, 0x7A, 0x00, 0x99, 0x67, 0x15, 0x34, 0xEB, 0x7F, 0x76, 0xC2, 0x49, 0xB6, 0x87, 0xF8,
-    0xC9, 0xA8, 0x86, 0xEC, 0x26, 0xD9, 0x67, 0x8C, 0x49, 0x12, 0x77, 0x97, 0x1B, 0xA0, 0xA8, 0x8B,
-    0x70, 0x83, 0x70, 0xD6, 0x3E, 0xD1, 0xE9, 0xE0, 0x9F, 0x66, 0x5D, 0xD3, 0xB6, 0x1C, 0x93, 0xD7,
-    0x55, 0x8B, 0x01, 0xF3, 0x69, 0x7D, 0x35, 0xB8, 0x4E, 0x8F, 0x58, 0x74, 0x5F, 0x06, 0x0B, 0x45,
-    0x1E, 0x0D, 0x2D, 0x9D, 0xBE, 0x33, 0xDA, 0xEB, 0x88, 0x00, 0x30, 0xF5, 0x98, 0x87, 0xE1, 0xAA,
-    0x7F, 0xF1, 0x47, 0x40, 0x5C, 0xA9, 0xD2, 0x96, 0x2D, 0xF3, 0xE9, 0xC1, 0xD7, 0xF6, 0xC0, 0x86,
-    0xE0, 0xB7, 0x27, 0x13, 0x5F, 0xB0, 0x29, 0xA4, 0x01, 0x73, 0xBA, 0x50, 0x1D, 0xD8, 0xAE, 0x2A,
-    0x7A, 0xFD, 0xED, 0xAF, 0xC6, 0x3C, 0xA6, 0x3A, 0x98, 0x4F, 0x09, 0x7F, 0xE0, 0x54, 0xC2, 0x33,
-    0x8C, 0x7E, 0x0D, 0x65, 0x0A, 0x83, 0x5E, 0x20, 0x0F, 0x03, 0xFD, 0x8F, 0x85, 0xD8, 0x07, 0xAF,
-    0xB4, 0xA7, 0x44, 0x50, 0x7A, 0x7E, 0x25, 0xB2, 0xC6, 0xE8, 0x1D, 0x10, 0x86, 0xC6, 0xDE, 0x02,
-    0x83, 0xAF, 0xD9, 0x93, 0x5B, 0xC2, 0x04, 0x7C, 0x8E, 0xA3, 0x9A, 0x74, 0xF7, 0x80, 0x3F, 0x08,
-    0x9E, 0x9A, 0x9C, 0x7F, 0xAB, 0xEF, 0xF7, 0xDB, 0xC9, 0xB9, 0x33, 0xD6, 0x49, 0x39, 0xE8, 0x5F,
-    0xCD, 0xFB, 0xBA, 0xBF, 0x18, 0xFD, 0x6B, 0xB9, 0xF1, 0xC9, 0xE8, 0xB5, 0xA2, 0x8A, 0xCC, 0xC5,
-    0x27, 0xC3, 0x62, 0xF5, 0x17, 0x9F, 0x7F, 0x0C, 0x5B, 0x44, 0x68, 0x86, 0xEC, 0x8C, 0xB7, 0x57,
-    0x41, 0xFF, 0x39, 0x4B, 0x2F, 0x0E, 0x5A, 0xAB, 0xD7, 0x0C, 0xEE, 0x00, 0x66, 0xFF, 0xD6, 0xB7,
-    0xB7, 0x78, 0x8A, 0xB4, 0x0F, 0xFE, 0xD4, 0x0E, 0x38, 0xC1, 0x2A, 0x53, 0xF2, 0x90, 0x3E, 0xDF,
-    0x02, 0xD7, 0x16, 0xFC, 0xA6, 0x34, 0xFF, 0x8A, 0xDC, 0x5C, 0x19, 0x08, 0x32, 0xFC, 0x94, 0x9C,
-    0x7C, 0xCA, 0x7C, 0xDA, 0x3C, 0xE0, 0xDF, 0x69, 0xA5, 0xF4, 0x4E, 0x37, 0x90, 0xB8, 0xBC, 0xF9,
-    0x61, 0xA4, 0x68, 0xF2, 0xA9, 0xFF, 0x6D, 0xFE, 0x13, 0xCF, 0x8A, 0xC0, 0x7C, 0xE8, 0xBF, 0x58,
-    0x69, 0x64, 0xA6, 0xC1, 0x3C, 0x70, 0x45, 0x77, 0x8A, 0xCF, 0xA2, 0x75, 0x53, 0xC9, 0xB2, 0x01,
-    0xB5, 0x5D, 0x74, 0xB7, 0x7F, 0x71, 0x72, 0xF0, 0x56, 0x72, 0xD6, 0x93, 0x73, 0xE6, 0xFC, 0x30,
-    0x39, 0xC9, 0x17, 0xEE, 0x78, 0xC2, 0xC1, 0x3E, 0x5C, 0x5F, 0xF3, 0x33, 0xB3, 0x4D, 0x62, 0xAC,
-    0x0A, 0x55, 0xB6, 0xAD, 0x6A, 0xEF, 0x41, 0x94, 0x06, 0xB2, 0xFF, 0x0D, 0xE8, 0xA4, 0x1D, 0xAB,
-    0x79, 0x52, 0x60, 0xE1, 0xCD, 0xFD, 0xE0, 0x08, 0xCD, 0x6D, 0xC6, 0x26, 0xFF, 0xCC, 0x0C, 0xC5,
-    0xFD, 0xFE, 0xF9, 0x2F, 0xE9, 0xF1, 0xC7, 0xB4, 0x72, 0xA1, 0xB1, 0xCE, 0xE4, 0xE5, 0x80, 0xC3,
-    0xFF, 0x4E, 0x2F, 0x3E, 0x5E, 0x7C, 0xB8, 0xB9, 0xA5, 0x37, 0x08, 0x0A, 0x82, 0x64, 0x3E, 0xEC,
-    0xDC, 0xB4, 0xB4, 0xE3, 0x95, 0x8D, 0x7B, 0x92, 0x2A, 0x32, 0x8F, 0xFE, 0x91, 0x9E, 0x3E, 0x46,
-    0xF6, 0xC7, 0x67, 0x6D, 0x4C, 0x95, 0x36, 0x61, 0x3D, 0x23, 0x08, 0x8F, 0xE5, 0x1D, 0x73, 0x69,
-    0xA7, 0x77, 0x85, 0x9B, 0xBC, 0x92, 0xBA, 0xA6, 0x82, 0x3A, 0x69, 0x22, 0xFD, 0x48, 0xC3, 0x5F,
-    0xCF, 0x6E, 0xC6, 0x62, 0xC5, 0x09, 0x51, 0x29, 0xFA, 0x12, 0xAD, 0x18, 0x8D, 0x47, 0x2E, 0xEF,
-    0x3D, 0x54, 0xA7, 0xBB, 0x90, 0x22, 0xDE, 0x47, 0x75, 0xFC, 0xAD, 0x02, 0xFA, 0x9B, 0x28, 0x81,
-    0x3E, 0x07, 0xD5, 0x9D, 0xB3, 0x82, 0x22, 0x06, 0x08, 0x5B, 0xC4, 0xDF, 0xA4, 0x11, 0xAE, 0x76,
-    0x17, 0x2C, 0x23, 0xAA, 0x11, 0xF6, 0x13, 0xC3, 0xFB, 0x28, 0x01, 0x47, 0xB4, 0x0B, 0x52, 0x2E,
-    0xD5, 0x88, 0x5C, 0x2C, 0xB0, 0x21, 0xA2, 0x04, 0xAB, 0x95, 0xFE, 0x4F, 0x3A, 0x98, 0xBC, 0x59,
-    0x0D, 0xC2, 0x85, 0x75, 0x0A, 0x2D, 0x0E, 0xC6, 0xD8, 0x98, 0x61, 0x41, 0x15, 0xE7, 0xC1, 0xA0,
-    0x9B, 0x08, 0x99, 0x96, 0x91, 0xED, 0x69, 0x70, 0x94, 0xD3, 0xC2, 0x88, 0x9E, 0x63, 0x5C, 0x8F,
-    0xDC, 0xDA, 0x9C, 0x6D, 0xEA, 0xFC, 0xA0, 0xF2, 0xCB, 0x60, 0xED, 0x91, 0xC2, 0x7B, 0x4F, 0x8A,
-    0xF0, 0x75, 0x29, 0xA2, 0x67, 0xA4, 0x88, 0x43, 0x29, 0xF6, 0xA4, 0x90, 0x8E, 0x65, 0x63, 0x68,
-    0x53, 0xC7, 0xC1, 0x52, 0x0A, 0x11, 0xEE, 0xB3, 0x31, 0xFC, 0x71, 0xC6, 0x73, 0x14, 0x35, 0x9C,
-    0x36, 0x44, 0x8C, 0xBA, 0x26, 0x9C, 0x69, 0xD8, 0x0A, 0x9E, 0xA6, 0x28, 0x42, 0x39, 0x8C, 0xD0,
-    0x4A, 0x8C, 0x46, 0x20, 0xE5, 0x62, 0xAA, 0x57, 0x9B, 0x56, 0xAC, 0xC3, 0x4A, 0xE0, 0x87, 0x60,
-    0xE0, 0xE6, 0xA9, 0x2A, 0x9B, 0xA3, 0x22, 0x4D, 0x6E, 0xBC, 0xAC, 0x79, 0x22, 0xE8, 0x78, 0x0B,
-    0xF7, 0x6D, 0x30, 0xD8, 0x5C, 0x99, 0x05, 0x73, 0x41, 0x68, 0xDC, 0x83, 0x0D, 0x51, 0xC6, 0x5A,
-    0x85, 0x55, 0x08, 0xBD, 0x7F, 0xAC, 0x5A, 0xB2, 0x7D, 0xB5, 0xE9, 0x6D, 0x07, 0xB2, 0x3C, 0xFB,
-    0xC1, 0x39, 0x90, 0x99, 0xD2, 0x86, 0xCF, 0xDC, 0x5F, 0x04, 0x4C, 0x37, 0xFB, 0x0E, 0x38, 0x84,
-    0x4E, 0xC3, 0xD8, 0x62, 0x78, 0xD2, 0x36, 0xF4, 0xAB, 0x54, 0x49, 0x91, 0x8C, 0xFF, 0xC2, 0xB4,
-    0x93, 0x9D, 0x0A, 0x5D, 0x4D, 0xE4, 0xAE, 0x8B, 0xE6, 0x50, 0xAC, 0x51, 0x63, 0x03, 0xE9, 0x11,
-    0x23, 0x3B, 0xD5, 0x4F, 0xB2, 0x68, 0xBC, 0xA2, 0x6D, 0xBC, 0xDF, 0x4A, 0x3D, 0xE3, 0x7A, 0x4B,
-    0xFC, 0xB8, 0x9F, 0x7D, 0x0F, 0xCE, 0xB5, 0xA5, 0xDC, 0x5F, 0xDC, 0x2B, 0xD6, 0xE8, 0x28, 0xDF,
-    0xB6, 0xF0, 0x5E, 0xBE, 0x6D, 0x8F, 0x84, 0x6F, 0xD4, 0xFE, 0x1B, 0x55, 0x6F, 0xF2, 0x3A, 0xAE,
-    0xC3, 0xC1, 0xB7, 0xAD, 0x37, 0x8D, 0x03, 0xA5, 0xB2, 0x39, 0x23, 0x03, 0xFA, 0xD4, 0x71, 0xBE,
-    0x6D, 0xEE, 0x25, 0xA3, 0xEA, 0x7D, 0x3D, 0xDC, 0x3E, 0xD0, 0x96, 0x3C, 0x9C, 0x50, 0xDE, 0x66,
-    0x83, 0xD7, 0x3A, 0xF8, 0x6F, 0xAD, 0xFF, 0x93, 0xC9, 0x03, 0x59, 0xFF, 0xDD, 0x61, 0xF6, 0x11,
-    0xC0, 0x7A, 0xBC, 0xC3, 0xDE, 0xA0, 0x25, 0xB4, 0xCA, 0xED, 0xE5, 0x23, 0xDD, 0xEC, 0xD2, 0x3D,
-    0x7C, 0xFC, 0xB6, 0x2A, 0xE8, 0xAC, 0xDC, 0x7B, 0xB7, 0x66, 0x17, 0xC7, 0x0A, 0xE9, 0x07, 0x87,
-    0xBC, 0x6F, 0x03, 0x78, 0x6C, 0x54, 0x9B, 0x95, 0x87, 0x6F, 0xE9, 0x2B, 0x02, 0x95, 0x5A, 0x76,
-    0xEE, 0x23, 0xA2, 0x05, 0xB0, 0x45, 0xF5, 0xEF, 0xAD, 0x2B, 0xB0, 0x5D, 0xFB, 0x30, 0x30, 0x85,
-    0x07, 0x91, 0x96, 0x8D, 0x95, 0x0D, 0x20, 0x86, 0x05, 0x88, 0xD4, 0x9B, 0x0F, 0x27, 0x5B, 0xF1,
-    0x66, 0xEB, 0x70, 0xB4, 0xDE, 0xFC, 0xF3, 0x49, 0xBE, 0x64, 0x58, 0x27, 0x99, 0x22, 0x87, 0x0E,
-    0xDC, 0xE8, 0x4F, 0x23, 0x63, 0xBA, 0x74, 0x98, 0xC9, 0xB9, 0x96, 0xC8, 0xD5, 0x9A, 0x57, 0x57,
-    0xA7, 0x61, 0x4F, 0xA8, 0x35, 0x8E, 0x0A, 0x6C, 0x22, 0x80, 0x0D, 0xBE, 0x44, 0x0D, 0x1D, 0x38,
-    0xC8, 0x45, 0x4D, 0x0F, 0x58, 0xA5, 0x85, 0xF9, 0xFB, 0x9D, 0x4A, 0x98, 0xF0, 0xC4, 0xB5, 0xD9,
-    0x06, 0xA6, 0x9C, 0x80, 0x29, 0xFC, 0x45, 0x05, 0x27, 0xC2, 0x33, 0x7E, 0x4C, 0x7D, 0x0D, 0x4C,
-    0x33, 0xAD, 0xC6, 0x77, 0x82, 0xBF, 0xA6, 0x01, 0x07, 0x7B, 0x7C, 0xCC, 0x8E, 0xB7, 0xAA, 0x5D,
-    0xF0, 0x56, 0x63, 0x8E, 0x25, 0xBC, 0xFA, 0x6B, 0x92, 0xC7, 0x74, 0x9C, 0xDA, 0x20, 0x62, 0xCD,
-    0x31, 0xB3, 0xD0, 0x08, 0xA4, 0xB7, 0x68, 0x4D, 0x72, 0x9B, 0x31, 0x25, 0x8A, 0xD4, 0x2B, 0x73,
-    0x4E, 0xC2, 0xD8, 0x23, 0x87, 0xE6, 0x95, 0x68, 0x63, 0x21, 0x0F, 0x42, 0x98, 0xCE, 0xD2, 0x2B,
-    0xD5, 0xF5, 0x64, 0x0C, 0xE4, 0xDA, 0xA2, 0x57, 0xF1, 0xCB, 0x71, 0x46, 0x0B, 0xC9, 0x6F, 0x2A,
-    0x7C, 0xF5, 0xAD, 0x84, 0xE3, 0x97, 0x5B, 0x92, 0xCE, 0xDD, 0xBF, 0x3A, 0x09, 0x1C, 0x7F, 0xE9,
-    0x03, 0x0C, 0x15, 0x01, 0x0C, 0x32, 0x32, 0x4A, 0xA8, 0x08, 0xE6, 0xC4, 0x63, 0x23, 0x68, 0xA9,
-    0x62, 0xFA, 0xF8, 0x5F, 0x7D, 0x5F, 0x43, 0x16, 0x62, 0x33, 0x44, 0xAA, 0x9A, 0x11, 0xF4, 0x6A,
-    0xB2, 0x85, 0x21, 0xD7, 0x39, 0x30, 0x3D, 0xD1, 0x7B, 0x40, 0x15, 0x0E, 0x0E, 0x9C, 0xA0, 0x68,
-    0x74, 0x03, 0xFF, 0x3D, 0x7A, 0x51, 0xCD, 0x3A, 0xB7, 0x19, 0xDA, 0xD6, 0x6F, 0x86, 0xE0, 0xC4,
-    0xF7, 0xF8, 0x32, 0xF0, 0x71, 0x7F, 0x90, 0x00, 0xEC, 0x93, 0x95, 0x15, 0x93, 0x49, 0xCA, 0x7F,
-    0xA4, 0x44, 0xC9, 0x81, 0x9D, 0x25, 0xCF, 0x06, 0xF7, 0xD1, 0x8F, 0xEC, 0x89, 0xCE, 0xE9, 0x4C,
-    0xC0, 0x17, 0xF1, 0x31, 0xC2, 0x5B, 0x5C, 0x59, 0x52, 0x4D, 0x77, 0x4A, 0xF3, 0x80, 0x3C, 0x6F,
-    0xC9, 0x07, 0xBC, 0x24, 0x68, 0x7E, 0x81, 0x81, 0x8C, 0x01, 0xCD, 0x21, 0x64, 0x9F, 0x0E, 0x12,
-    0x9B, 0xC8, 0x2A, 0x55, 0x0E, 0x51, 0x1A, 0xC8, 0x0E, 0xF3, 0x89, 0x34, 0x0A, 0xDE, 0xFB, 0xAD,
-    0x95, 0xD1, 0x63, 0x3C, 0xBE, 0x71, 0xA1, 0x11, 0xF2, 0x1A, 0xCD, 0x06, 0x80, 0x60, 0x07, 0x06,
-    0x23, 0x41, 0x88, 0xBA, 0x25, 0x4F, 0xF4, 0xFB, 0x7E, 0x20, 0xE3, 0x77, 0x23, 0x34, 0x27, 0x00,
-    0xF9, 0x08, 0x2B, 0x5F, 0xA9, 0x73, 0x3E, 0x3C, 0x4A, 0x21, 0x6D, 0xBD, 0xD2, 0xA8, 0xA2, 0x8D,
-    0x51, 0xC9, 0x98, 0x81, 0xF7, 0x20, 0xE1, 0xD7, 0x1A, 0x30, 0x02, 0x97, 0x0F, 0x84, 0x91, 0x10,
-    0x00, 0x1A, 0x93, 0x9E, 0x8B, 0x65, 0x03, 0x93, 0x48, 0x5A, 0x4A, 0xBB, 0x67, 0x19, 0x86, 0x60,
-    0xB3, 0x42, 0x87, 0xFF, 0x82, 0x86, 0x7D, 0x73, 0x0A, 0x52, 0xD3, 0x7C, 0x3E, 0x2C, 0xC2, 0x57,
-    0xDF, 0x58, 0xC9, 0x89, 0x50, 0xB8, 0x57, 0x85, 0x2C, 0x36, 0xA3, 0x92, 0x01, 0x77, 0xA6, 0xC1,
-    0x04, 0x80, 0xA9, 0xEE, 0x10, 0x52, 0xFD, 0x1A, 0x3D, 0xF0, 0xE0, 0xBC, 0x01, 0x19, 0x56, 0x04,
-    0x8F, 0xF0, 0x55, 0xE1, 0x53, 0x9A, 0xCF, 0x23, 0xFE, 0x3B, 0xE9, 0x38, 0x72, 0xCC, 0x29, 0xC8,
-    0x56, 0xFA, 0x0C, 0x90, 0x11, 0x86, 0x15, 0xFF, 0x49, 0x58, 0xC4, 0xD1, 0x28, 0x8B, 0xA3, 0x85,
-    0x89, 0x23, 0x19, 0x99, 0x88, 0x7E, 0xB1, 0x2C, 0x29, 0xA0, 0x3C, 0x56, 0xFF, 0x54, 0x39, 0x17,
-    0x56, 0x20, 0x2A, 0xE4, 0x23, 0xFB, 0x3F, 0x12, 0x68, 0x8E, 0x52, 0xF9, 0xC8, 0xE2, 0xFC, 0x49,
-    0x20, 0xB0, 0xEE, 0x36, 0xE8, 0xFE, 0x5C, 0x73, 0x43, 0xE1, 0x57, 0x5F, 0x14, 0x2C, 0x32, 0xCA,
-    0xF2, 0xBE, 0x88, 0x96, 0x8F, 0xF7, 0x97, 0x68, 0x43, 0x63, 0x1C, 0xA4, 0x0F, 0x7A, 0xAC, 0x5A,
-    0x3B, 0x68, 0xCD, 0x48, 0x93, 0x34, 0xE0, 0x9D, 0x59, 0x69, 0x3C, 0xB2, 0x19, 0x88, 0xB5, 0x41,
-    0xD8, 0x3A, 0x98, 0x35, 0x06, 0xA1, 0xE3, 0xE7, 0x2E, 0xED, 0x71, 0x31, 0x36, 0x90, 0x66, 0x9F,
-    0xC9, 0xA9, 0xA7, 0x83, 0x2D, 0xCE, 0x69, 0xB6, 0x3C, 0x83, 0x9C, 0x54, 0xFD, 0x16, 0xC0, 0x3F,
-    0x94, 0x5B, 0x0E, 0x6D, 0x31, 0x63, 0x2A, 0xB8, 0x82, 0x30, 0x87, 0x0B, 0xD7, 0x97, 0xD1, 0xA3,
-    0x98, 0x4B, 0x88, 0xD1, 0x52, 0x40, 0x8B, 0x61, 0x28, 0xC7, 0x1A, 0xC6, 0x21, 0x82, 0xD6, 0xB1,
-    0x90, 0xC0, 0x35, 0x15, 0xA3, 0x30, 0x18, 0xA2, 0x9A, 0xB3, 0x3F, 0x08, 0x8E, 0xF3, 0x2A, 0xF0,
-    0x28, 0x61, 0x81, 0x73, 0x99, 0x21, 0x69, 0xAF, 0x33, 0x1A, 0x43, 0x0A, 0xB7, 0x07, 0xA2, 0x58,
-    0xE0, 0x71, 0x4D, 0xDB, 0x10, 0x7D, 0x93, 0x71, 0xC2, 0xDF, 0x5A, 0x31, 0x65, 0x48, 0x61, 0xAC,
-    0x4F, 0x9D, 0x89, 0x98, 0xAF, 0x24, 0x7A, 0x81, 0xA2, 0xF0, 0xF3, 0x8C, 0xFA, 0xC9, 0x18, 0x4B,
-    0x9B, 0xA5, 0xD0, 0x12, 0x64, 0xB0, 0x62, 0x44, 0x99, 0x22, 0x6C, 0x57, 0xB5, 0x48, 0x39, 0x4B,
-    0x64, 0x71, 0xC8, 0xA0, 0x93, 0x84, 0x5E, 0xA9, 0x4E, 0xA5, 0xF3, 0x53, 0x64, 0x8B, 0x49, 0xDD,
-    0x59, 0x03, 0x34, 0x30, 0xD2, 0x24, 0x4E, 0x20, 0xB4, 0x54, 0x0E, 0xEE, 0x31, 0xEF, 0x14, 0x54,
-    0x36, 0x01, 0x5C, 0x75, 0xDC, 0xDB, 0x04, 0x39, 0xF4, 0x6C, 0x14, 0xD0, 0x3C, 0x86, 0x0C, 0x68,
-    0x88, 0x12, 0x16, 0x08, 0x84, 0xA3, 0x1C, 0x10, 0x45, 0xC0, 0x24, 0x32, 0x95, 0x26, 0x23, 0x70,
-    0xC8, 0x67, 0xC3, 0x9E, 0x8D, 0x88, 0xB9, 0xFB, 0x3B, 0xED, 0x67, 0xB3, 0xCB, 0x2B, 0xDA, 0x45,
-    0x13, 0xDA, 0x46, 0x1F, 0xB8, 0x85, 0x7F, 0xC2, 0x29, 0x73, 0x70, 0x8C, 0xEE, 0x19, 0xB3, 0x3A,
-    0x57, 0x74, 0x3E, 0x06, 0xAB, 0x4E, 0x5D, 0xD0, 0xF1, 0xC5, 0x64, 0xB2, 0x03, 0x2E, 0xB4, 0xB7,
-    0xC5, 0xDD, 0x6E, 0xFE, 0x0E, 0x8A, 0x26, 0xB6, 0x82, 0xBC, 0xB9, 0x7B, 0xA1, 0xA9, 0x2B, 0x3A,
-    0x76, 0xBA, 0x3F, 0x28, 0x57, 0xE6, 0x7E, 0x4A, 0x4E, 0x96, 0x39, 0xB0, 0x21, 0xDF, 0xDF, 0xAF,
-    0xEE, 0x5E, 0x8E, 0x99, 0x42, 0x08, 0x1B, 0x06, 0xA6, 0x17, 0xF7, 0xD6, 0x4C, 0x4D, 0x2B, 0xAA,
-    0x2A, 0x6B, 0xD4, 0xF7, 0x8E, 0xAE, 0x77, 0xD7, 0x26, 0xE7, 0x0B, 0x5A, 0x8A, 0x91, 0x4B, 0x02,
-    0x1A, 0x66, 0xAD, 0x3E, 0xE6, 0xEE, 0xC3, 0xD5, 0x43, 0x66, 0x29, 0x3A, 0x9E, 0x68, 0x08, 0x68,
-    0x6F, 0x03, 0x12, 0x5C, 0x4B, 0x6B, 0x02, 0x6B, 0xC2, 0x1D, 0x59, 0x57, 0xDD, 0xF9, 0xFD, 0x5D,
-    0x86, 0x3E, 0x8C, 0x59, 0x09, 0x7A, 0xC6, 0xA7, 0x8F, 0x6E, 0xE4, 0x8D, 0x5E, 0xF6, 0x1B, 0xFD,
-    0xB5, 0x57, 0xEB, 0xAF, 0xFD, 0x9B, 0xFA, 0x6B, 0xA6, 0x3F, 0x98, 0x6B, 0xE4, 0x3A, 0x1A, 0x4F,
-    0x6D, 0xE3, 0xBD, 0x5E, 0xE6, 0x26, 0x87, 0x27, 0x74, 0x6F, 0x2F, 0x6F, 0x6B, 0xE3, 0x07, 0x75,
-    0x97, 0x0A, 0x6E, 0x6A, 0xA3, 0xC6, 0x16, 0x21, 0x80, 0xFD, 0xFD, 0xF9, 0xCE, 0xEA, 0x9C, 0xCB,
-    0x41, 0x23, 0xC6, 0xBF, 0x53, 0x1A, 0x11, 0xA3, 0xC3, 0x87, 0x25, 0x64, 0x36, 0x6B, 0xD7, 0x2E,
-    0x90, 0xEA, 0x16, 0x79, 0xC7, 0x97, 0x6B, 0x0C, 0x54, 0xC9, 0x19, 0x66, 0x09, 0x6F, 0x6C, 0x48,
-    0x28, 0x7F, 0xD5, 0xF3, 0x36, 0xF0, 0x6C, 0xB0, 0xFA, 0xAB, 0x37, 0xA4, 0x06, 0xCA, 0x40, 0x48,
-    0x80, 0x49, 0x4C, 0xDD, 0x25, 0x6F, 0x56, 0x76, 0xFE, 0x0F, 0xD8, 0x19, 0xE5, 0x66, 0x74, 0x23,
-    0x58, 0x58, 0xA4, 0xF9, 0xEF, 0xC9, 0x0B, 0x2B, 0xEB, 0x27, 0xAE, 0x8A, 0x01, 0x73, 0xC8, 0x9C,
-    0xB2, 0x1C, 0x0C, 0xA2, 0xFD, 0xBB, 0x2F, 0x0D, 0x4A, 0x23, 0x41, 0x3C, 0x27, 0x40, 0x2A, 0xFD,
-    0x1E, 0xBE, 0x05, 0x79, 0xBF, 0x4C, 0x81, 0x60, 0xFE, 0xA1, 0x46, 0x8C, 0x5A, 0x58, 0xA8, 0x49,
-    0x18, 0xD6, 0x61, 0x20, 0x67, 0x4C, 0xFB, 0x14, 0x2C, 0xAD, 0x43, 0xB7, 0x1D, 0xBF, 0x42, 0x64,
-    0xAB, 0xA0, 0xFA, 0x5F, 0x51, 0x5F, 0xFA, 0x34, 0xB2, 0x51, 0x09, 0xA9, 0x76, 0x9A, 0xA0, 0x8C,
-    0x0A, 0x64, 0xAD, 0x18, 0x95, 0xFE, 0x6D, 0x91, 0xF3, 0xF7, 0x2F, 0xA8, 0xCF, 0x58, 0x37, 0x61,
-    0x84, 0x89, 0x3C, 0xF6, 0x9C, 0xE5, 0x3B, 0x87, 0x54, 0x6B, 0xD8, 0xEF, 0x0E, 0xF3, 0xB0, 0xEC,
-    0x9F, 0xB3, 0x8C, 0xB1, 0x20, 0x40, 0x21, 0x2C, 0x49, 0x04, 0x59, 0x3F, 0xFE, 0x96, 0x50, 0x9E,
-    0xD4, 0x5D, 0x09, 0x9B, 0x06, 0xED, 0xF9, 0xDC, 0xD4, 0xF6, 0x6C, 0xEA, 0xAC, 0x64, 0xE3, 0x02,
-    0xBB, 0xC7, 0x5F, 0xAA, 0xC2, 0x22, 0x7A, 0x73, 0xE9, 0xED, 0x87, 0x7D, 0x02, 0xBB, 0xC9, 0x7F,
-    0x57, 0x2F, 0x35, 0x73, 0x36, 0x18, 0x56, 0xDB, 0xEA, 0x34, 0x4D, 0x7A, 0xEB, 0xF2, 0x0A, 0x8A,
-    0xD9, 0x2C, 0x1E, 0x1C, 0x13, 0x3E, 0x94, 0x4E, 0x73, 0x75, 0x84, 0x4E, 0x73, 0x7F, 0xB2, 0xA7,
-    0xD1, 0x07, 0x14, 0x68, 0x9D, 0x0F, 0x70, 0xF3, 0x5A, 0xE8, 0xF6, 0x87, 0x98, 0x91, 0x47, 0x06,
-    0x3E, 0x6D, 0xD0, 0xAE, 0x39, 0xFD, 0x3E, 0xE0, 0x2C, 0xBE, 0xFE, 0xBF, 0x04, 0xC3, 0x33, 0x13,
-    0x41, 0xB2, 0x16, 0xEB, 0xB6, 0x0F, 0x2B, 0xE5, 0xC0, 0x3A, 0xE8, 0x33, 0x4F, 0x94, 0xC8, 0x0E,
-    0x38, 0x12, 0x20, 0x1C, 0x53, 0x9F, 0xC2, 0x07, 0x9C, 0x21, 0x93, 0xF5, 0x08, 0x1C, 0x3E, 0x13,
-    0x68, 0x22, 0x0E, 0x27, 0xA4, 0xB8, 0x9B, 0x72, 0xF5, 0xC3, 0x57, 0xDD, 0x02, 0xF5, 0x62, 0x66,
-    0x88, 0x7B, 0xFE, 0xE8, 0x14, 0xAD, 0x4B, 0x08, 0x3D, 0x69, 0x9E, 0xB8, 0x72, 0xE3, 0x07, 0x84,
-    0xE2, 0x07, 0xFA, 0x5C, 0xC7, 0x52, 0xEA, 0xE7, 0x20, 0xCD, 0xE2, 0xA1, 0x0F, 0x77, 0x9E, 0xB3,
-    0x0F, 0x9E, 0xE3, 0xEA, 0x4A, 0x35, 0x14, 0x4C, 0x8A, 0x81, 0x60, 0x22, 0xFA, 0xF6, 0x71, 0x47,
-    0x61, 0x1B, 0x32, 0x9C, 0x41, 0xA6, 0xD4, 0xA9, 0xB1, 0x8B, 0x6F, 0x97, 0x96, 0x45, 0xA4, 0x25,
-    0x32, 0x7A, 0xA0, 0x44, 0x1C, 0x7B, 0x77, 0x44, 0x77, 0x65, 0xD4, 0x4A, 0x00, 0x5E, 0x47, 0x89,
-    0x46, 0x77, 0xC1, 0xDD, 0xC9, 0x46, 0x77, 0xB9, 0x88, 0xEE, 0x1A, 0x8F, 0x20, 0x21, 0x66, 0x6A,
-    0x42, 0x1E, 0xA2, 0x9A, 0xEE, 0x21, 0xE3, 0xDA, 0x8A, 0x87, 0x35, 0xC0, 0x49, 0x3A, 0x51, 0x83,
-    0x0B, 0x53, 0x00, 0x3E, 0x7A, 0xE1, 0xDA, 0xD9, 0x8F, 0x30, 0xC0, 0xEA, 0xBE, 0x07, 0x08, 0x67,
-    0x6F, 0xC6, 0xDF, 0x1C, 0x3B, 0x40, 0x66, 0xEC, 0x08, 0xE8, 0xBC, 0xD7, 0xDA, 0x64, 0x84, 0x53,
-    0xA3, 0x29, 0x3B, 0xE2, 0x04, 0xB6, 0x1F, 0xF0, 0x74, 0x66, 0xC1, 0x2C, 0x6F, 0x3F, 0x29, 0x06,
-    0xED, 0x2E, 0x8D, 0x95, 0x94, 0x7F, 0x34, 0x7D, 0x47, 0xBF, 0xCE, 0x9A, 0x33, 0xA5, 0xBC, 0x86,
-    0x1D, 0x4E, 0x5A, 0x4F, 0x36, 0x4B, 0xAA, 0x16, 0x86, 0x5E, 0x8B, 0xF2, 0xC5, 0xED, 0xFE, 0x2B,
-    0x76, 0xD9, 0x2D, 0xC4, 0x04, 0x6A, 0xBE, 0xCA, 0x6C, 0x80, 0x5C, 0xB5, 0x3D, 0x4C, 0xB7, 0x2B,
-    0xCD, 0x59, 0xE9, 0x05, 0xF8, 0x97, 0xA0, 0x24, 0x9F, 0x2A, 0x08, 0x53, 0xE3, 0xC8, 0x99, 0xC5,
-    0x89, 0xC9, 0x54, 0xF0, 0x74, 0xCA, 0x6E, 0xD8, 0xED, 0x48, 0xBD, 0xE7, 0xFD, 0x6E, 0xA5, 0x7D,
-    0x0E, 0x81, 0x67, 0x57, 0xD2, 0x9B, 0x85, 0x09, 0xAF, 0x23, 0xAC, 0xF6, 0xE6, 0xCA, 0xA6, 0x19,
-    0xB9, 0x23, 0x2C, 0x63, 0x7D, 0xA2, 0x94, 0x57, 0xF8, 0xE0, 0xED, 0xC3, 0x60, 0xF1, 0xF8, 0xA4,
-    0x0E, 0xCC, 0xB9, 0xA6, 0xDC, 0x40, 0x3F, 0x1C, 0x36, 0x05, 0xDA, 0xFB, 0x38, 0x9C, 0x80, 0xC1,
-    0x39, 0xCC, 0x58, 0x2E, 0x05, 0x2D, 0xBC, 0x74, 0x28, 0x01, 0xDC, 0x47, 0x2A, 0xAF, 0x4D, 0x76,
-    0xD4, 0x5F, 0xAF, 0xB3, 0xE5, 0x01, 0x09, 0xBD, 0x7B, 0x89, 0x03, 0x25, 0x07, 0x4D, 0xCF, 0x08,
-    0x31, 0x50, 0x33, 0xBA, 0xDD, 0xB5, 0xB2, 0xB2, 0x89, 0x58, 0x44, 0x1E, 0x2C, 0x9C, 0x9C, 0x4A,
-    0xC8, 0x06, 0xBA, 0xD5, 0xD4, 0x38, 0xB3, 0x97, 0xEE, 0xE5, 0xC0, 0xD5, 0x5D, 0xB2, 0x16, 0x19,
-    0xF2, 0x2C, 0xF7, 0x76, 0xF8, 0x3A, 0x8B, 0xEC, 0x24, 0x4C, 0x0F, 0x42, 0xCF, 0x6B, 0xFA, 0x60,
-    0xCF, 0xB7, 0xAA, 0xE0, 0x33, 0x22, 0x32, 0x89, 0xDB, 0x99, 0x7E, 0x92, 0x43, 0x59, 0xF4, 0x4E,
-    0x69, 0xF2, 0xFA, 0x28, 0xEC, 0x8C, 0xE8, 0xCC, 0x94, 0x19, 0x28, 0x8F, 0x09, 0x6E, 0x5C, 0x57,
-    0xE9, 0xCC, 0x20, 0xA9, 0x24, 0xE3, 0x89, 0x63, 0x0E, 0xFC, 0x70, 0xD5, 0x63, 0xA8, 0x5A, 0x49,
-    0x95, 0x57, 0x84, 0xAF, 0x55, 0x61, 0x12, 0x87, 0xCB, 0x33, 0x22, 0xB1, 0x16, 0xAB, 0x1D, 0x3A,
-    0x2B, 0x2F, 0xA5, 0x48, 0xCD, 0xC9, 0x05, 0xF8, 0x7F, 0xE6, 0x62, 0x43, 0xB4, 0x41, 0x88, 0x9D,
-    0x79, 0x06, 0x43, 0xFD, 0x0F, 0x87, 0xD1, 0xED, 0xAE, 0xA6, 0xD3, 0xD8, 0xFE, 0xF8, 0x19, 0x3F,
-    0xBB, 0xF2, 0x49, 0xFD, 0x7F, 0x68, 0xE3, 0x5F, 0xBE, 0xD7, 0x0A, 0x4D, 0x9C, 0xBB, 0xC8, 0xC8,
-    0x11, 0xC8, 0x44, 0xF8, 0xC3, 0x27, 0x59, 0x67, 0xEE, 0xD8, 0xBB, 0x9F, 0x24, 0x35, 0xE6, 0xDF,
-    0x27, 0xE1, 0x3F, 0x22, 0xC1, 0x84, 0xFC, 0x3D, 0xD3, 0x5F, 0xF4, 0x9B, 0xCE, 0xA6, 0xDA, 0x82,
-    0xC6, 0x98, 0x49, 0xBC, 0xA6, 0xF7, 0x73, 0xF2, 0xE8, 0x5D, 0x48, 0x94, 0xE6, 0xF4, 0xEC, 0xB3,
-    0x71, 0xDA, 0xAF, 0xE2, 0xFD, 0x67, 0x65, 0x62, 0x4C, 0x2B, 0x72, 0xE5, 0x34, 0x56, 0xF9, 0xF4,
-    0x81, 0x3E, 0x1B, 0x6A, 0xA3, 0xCE, 0xAC, 0xA3, 0x86, 0x82, 0x6E, 0xD6, 0xAB, 0x26, 0x27, 0x4F,
-    0xC8, 0x39, 0xE4, 0x1A, 0x84, 0xD6, 0xDA, 0xD8, 0xAA, 0x27, 0xB1, 0xEC, 0x5E, 0x55, 0x93, 0x0B,
-    0xBF, 0xCA, 0x34, 0x50, 0x71, 0xF8, 0xCE, 0x07, 0x93, 0xC9, 0xA4, 0x8D, 0xD4, 0xBB, 0x55, 0x0F,
-    0x85, 0xD3, 0x6E, 0xAA, 0xA9, 0x42, 0x65, 0x3B, 0x47, 0x6A, 0xE9, 0xB1, 0x2C, 0xB5, 0x75, 0xD0,
-    0xD0, 0x1B, 0x19, 0x96, 0xCB, 0xEC, 0x58, 0x5F, 0x51, 0xB1, 0x88, 0x98, 0xD9, 0xE6, 0x67, 0x3A,
-    0x71, 0x76, 0xC3, 0x15, 0x43, 0xA3, 0x86, 0xA4, 0xF8, 0xE0, 0x42, 0x05, 0x76, 0xBC, 0x0B, 0x85,
-    0x89, 0x0C, 0xAF, 0xFE, 0x14, 0x36, 0xD3, 0x15, 0x56, 0x38, 0xCE, 0x6F, 0xCC, 0xF2, 0x2F, 0xB1,
-    0x17, 0xA7, 0x05, 0xCF, 0xBC, 0x44, 0xBD, 0x97, 0x06, 0x25, 0x28, 0x0E, 0x6E, 0xD6, 0xCC, 0xAF,
-    0xD7, 0x3D, 0xF5, 0x77, 0xE4, 0xCD, 0x33, 0x30, 0xED, 0xC8, 0x2F, 0x77, 0xCE, 0x1C, 0x9E, 0x98,
-    0x7C, 0x3D, 0x31, 0xD9, 0x30, 0x31, 0xBE, 0x4E, 0x4C, 0xBC, 0x9E, 0x18, 0xA7, 0x7E, 0x32, 0xD0,
-    0x89, 0x89, 0xFF, 0x50, 0x13, 0xB3, 0xBF, 0xF1, 0xF3, 0x78, 0x33, 0x31, 0xCF, 0xD0, 0xF2, 0x72,
-    0xF3, 0xD2, 0xA9, 0xED, 0x09, 0x0C, 0x3E, 0xB6, 0x09, 0x54, 0x67, 0x98, 0x7A, 0x1D, 0x83, 0xCB,
-    0xF0, 0x6C, 0xB5, 0x1F, 0xD5, 0xEB, 0x80, 0xBE, 0x2B, 0x7D, 0x95, 0x5E, 0xBC, 0xEF, 0x20, 0xB7,
-    0x36, 0x40, 0x18, 0xFD, 0xA6, 0x0D, 0x4C, 0xF1, 0x49, 0x6B, 0x47, 0xAA, 0x1E, 0x47, 0x72, 0x5C,
-    0xDD, 0x69, 0x9D, 0x84, 0x85, 0xA9, 0x50, 0x34, 0x4B, 0x6F, 0xCC, 0x58, 0x1D, 0x4C, 0x34, 0x9B,
-    0x26, 0xB9, 0x03, 0x1F, 0x71, 0x04, 0x32, 0x42, 0x55, 0xA1, 0x34, 0xF4, 0xDE, 0x93, 0x8B, 0x4E,
-    0xAD, 0x4E, 0x00, 0x70, 0x51, 0x57, 0x3C, 0xDD, 0xD8, 0x44, 0xA5, 0xA5, 0x2A, 0xF1, 0x7B, 0x0B,
-    0x1B, 0x9D, 0xD1, 0xCB, 0x94, 0x66, 0x93, 0x29, 0x38, 0x71, 0xB7, 0x71, 0x6A, 0xF5, 0xCC, 0xA3,
-    0xE3, 0xA4, 0xAC, 0x27, 0xB5, 0x3D, 0x3E, 0x05, 0xA1, 0x52, 0xEE, 0xE2, 0xB3, 0x5D, 0x6A, 0x39,
-    0x47, 0xCB, 0x88, 0x6A, 0x1A, 0x64, 0x52, 0xA0, 0x67, 0x4F, 0xA0, 0xEE, 0x28, 0x48, 0x04, 0x86,
-    0x58, 0x2C, 0xA8, 0x41, 0xD5, 0x69, 0x91, 0x9C, 0xA5, 0xA7, 0x83, 0xDC, 0x08, 0xCA, 0x5A, 0xE7,
-    0x6A, 0x1A, 0x19, 0x38, 0x97, 0xC0, 0xBD, 0x1D, 0xFE, 0x1B, 0x9C, 0x3A, 0x66, 0xAE, 0x85, 0xA6,
-    0x7A, 0x8A, 0x4C, 0x46, 0x15, 0xE9, 0x2F, 0xC3, 0x70, 0xA3, 0xFF, 0xF6, 0xC1, 0x42, 0xBB, 0xBF,
-    0xE4, 0x60, 0xE8, 0xF3, 0x00, 0x5D, 0x17, 0x23, 0x12, 0x32, 0x1A, 0xC4, 0x5A, 0x66, 0x7C, 0x43,
-    0x82, 0x11, 0x08, 0x6A, 0x99, 0x2E, 0x05, 0x79, 0x29, 0xBF, 0xB2, 0xC9, 0xCB, 0xAC, 0x26, 0xD6,
-    0xDD, 0xD2, 0xC4, 0x52, 0x07, 0x46, 0x4D, 0x6C, 0x41, 0xD5, 0x98, 0xD5, 0xC4, 0x2E, 0x8C, 0xA6,
-    0xC8, 0x89, 0x73, 0x35, 0x0A, 0xC2, 0x2F, 0xA1, 0x47, 0x5E, 0x93, 0x94, 0x71, 0x1A, 0x4C, 0x4A,
-    0x0D, 0xF7, 0xD9, 0xD1, 0x3A, 0xDB, 0x1F, 0x2C, 0x20, 0x2E, 0x12, 0x2C, 0xD2, 0xFA, 0x31, 0x4A,
-    0x8F, 0x4E, 0x5C, 0xB4, 0x52, 0x4E, 0xE9, 0xFA, 0x85, 0x46, 0xD5, 0x84, 0x21, 0x67, 0xE8, 0x1C,
-    0xC0, 0xC4, 0x5D, 0x8D, 0x85, 0x51, 0x1B, 0xD3, 0xF4, 0xB0, 0x30, 0x63, 0xE9, 0xFB, 0x58, 0x66,
-    0x7C, 0x2C, 0xB3, 0x3D, 0x46, 0x96, 0x04, 0xB8, 0xF4, 0x42, 0xB9, 0xF3, 0xFD, 0xBC, 0x94, 0xFB,
-    0xE4, 0x5E, 0xB7, 0x91, 0x99, 0xC6, 0x67, 0x8E, 0xC8, 0xB3, 0xB1, 0xBA, 0x8B, 0x4E, 0x8D, 0xFA,
-    0x61, 0x68, 0xE8, 0x22, 0x25, 0x2D, 0x79, 0xE6, 0x8F, 0x77, 0x4A, 0xE6, 0xBC, 0x1A, 0xB5, 0x6B,
-    0xDD, 0x7B, 0x9F, 0x90, 0x91, 0x59, 0x97, 0x8C, 0x9D, 0xD7, 0x52, 0x40, 0x70, 0x5D, 0x06, 0x43,
-    0x52, 0xDA, 0xC3, 0x65, 0xA6, 0xD1, 0x50, 0x86, 0x0C, 0x22, 0xFF, 0x73, 0xCF, 0xC5, 0x1B, 0xE5,
-    0x94, 0xE5, 0x7C, 0x50, 0xAB, 0x0C, 0xE5, 0x97, 0x10, 0x91, 0xF0, 0x2E, 0xF5, 0x17, 0x2D, 0x16,
-    0x74, 0xA4, 0x09, 0x33, 0xEB, 0xC1, 0xBE, 0x6E, 0xE9, 0xB1, 0xC5, 0x0C, 0xAA, 0xC1, 0x50, 0xCC,
-    0x71, 0x22, 0x51, 0xB7, 0x64, 0xF5, 0x4D, 0x46, 0xC0, 0xE8, 0x48, 0x9F, 0xCC, 0x47, 0x0E, 0xC5,
-    0x58, 0x9F, 0x2D, 0xC5, 0x2E, 0x5D, 0x89, 0xD6, 0xD1, 0xF1, 0x28, 0x18, 0x1A, 0xCA, 0xC0, 0x50,
-    0x59, 0xE6, 0xD1, 0x77, 0x30, 0x27, 0x4D, 0x3F, 0x28, 0xC3, 0x6A, 0xB5, 0xDA, 0x0F, 0x12, 0xED,
-    0x81, 0x58, 0x5B, 0xAE, 0x95, 0x61, 0x87, 0x16, 0xF8, 0x88, 0x35, 0x3F, 0xA8, 0x42, 0x06, 0x4D,
-    0xB8, 0xC1, 0xB7, 0x4C, 0xB7, 0xF6, 0x00, 0x3F, 0x3C, 0x1A, 0x7E, 0xD2, 0x01, 0x7E, 0x44, 0xA8,
-    0xBF, 0x7E, 0xDE, 0xC2, 0x8F, 0x7A, 0x16, 0x11, 0x7E, 0x18, 0xCA, 0x0F, 0xD1, 0xC5, 0x1D, 0xCC,
-    0xB1, 0xA3, 0x75, 0x45, 0xAB, 0xF1, 0x85, 0x4C, 0x8C, 0x7C, 0xF4, 0x1D, 0x9B, 0x15, 0x85, 0xD5,
-    0x63, 0xCD, 0x37, 0xC2, 0x1D, 0x65, 0x05, 0xFE, 0x72, 0x07, 0x49, 0x59, 0xAB, 0x75, 0xFE, 0xEE,
-    0x4F, 0x4A, 0x89, 0xFA, 0xEE, 0x81, 0x12, 0x75, 0x23, 0x57, 0x5B, 0xBD, 0xC6, 0xFA, 0x0A, 0x38,
-    0xD3, 0x03, 0xB8, 0x39, 0x67, 0x3E, 0x5E, 0x25, 0xEA, 0x3D, 0xE0, 0xE6, 0x3E, 0x38, 0xC9, 0xAD,
-    0x2A, 0xB0, 0xD7, 0xB4, 0x4E, 0x93, 0xBB, 0xB6, 0x9C, 0xA4, 0x30, 0xD7, 0x8F, 0xCF, 0x92, 0xBB,
-    0x48, 0xE9, 0xCE, 0x95, 0xA5, 0x55, 0x19, 0xB0, 0x53, 0xC7, 0xF0, 0xB5, 0xAC, 0x72, 0x12, 0xA6,
-    0xFC, 0x9B, 0x1F, 0xF3, 0x41, 0x42, 0x67, 0xB0, 0xD3, 0xF1, 0xB5, 0x9D, 0x2E, 0xEC, 0xBB, 0xA9,
-    0xF0, 0x9A, 0xD3, 0x8D, 0xB7, 0x37, 0xC8, 0xE7, 0xC4, 0x42, 0x65, 0x3D, 0x7E, 0x96, 0x47, 0x7F,
-    0x86, 0x0C, 0xB8, 0x46, 0x15, 0xA9, 0x46, 0x73, 0xE0, 0x1A, 0x4D, 0x82, 0x6B, 0x34, 0x0B, 0xAE,
-    0xD1, 0x34, 0xB8, 0x6A, 0x71, 0x8A, 0x8D, 0x26, 0xC2, 0x35, 0x9A, 0x09, 0xD7, 0x68, 0x2A, 0x5C,
-    0xA3, 0xB9, 0x70, 0x8D, 0x26, 0xC3, 0x35, 0x9A, 0x0D, 0x57, 0x84, 0xF2, 0xD2, 0x47, 0x18, 0x1C,
-    0xF3, 0xE1, 0x22, 0xE0, 0x1B, 0x6C, 0xB5, 0x66, 0xC4, 0x35, 0x9A, 0x12, 0xD7, 0x68, 0x4E, 0x5C,
-    0xA3, 0x49, 0x71, 0x8D, 0x66, 0xC5, 0xD5, 0xE4, 0x6F, 0xF1, 0x0F, 0x6C, 0x5E, 0x5C, 0x4D, 0x8C,
-    0x6B, 0x09, 0xFD, 0xEA, 0xC0, 0x69, 0x64, 0xCD, 0x95, 0xD8, 0x05, 0xB4, 0x7C, 0x8B, 0xF5, 0xEB,
-    0x3E, 0xC1, 0x84, 0x49, 0x3D, 0xDC, 0xA4, 0x65, 0x74, 0x31, 0x7C, 0x0C, 0x21, 0xF7, 0x4B, 0x39,
-    0x5E, 0xC1, 0x93, 0xFC, 0x8C, 0xB4, 0x7E, 0xC5, 0x9C, 0xF9, 0x86, 0x89, 0x76, 0xCC, 0x99, 0x31,
-    0xF2, 0xB5, 0x9F, 0xD1, 0xFF, 0x61, 0xB2, 0x87, 0x72, 0x59, 0x4B, 0xE9, 0xBF, 0x52, 0x49, 0xE9,
-    0xBD, 0x85, 0xD2, 0xFD, 0x7D, 0x21, 0xA5, 0xC8, 0x24, 0x52, 0x9A, 0x3E, 0x1B, 0x9D, 0x3B, 0x23,
-    0x7B, 0x7D, 0xD4, 0x9C, 0x01, 0x3A, 0xAB, 0x0F, 0xFA, 0xB6, 0x89, 0x15, 0x95, 0x45, 0x51, 0xF5,
-    0xE8, 0xE0, 0x8B, 0xFE, 0x51, 0x18, 0x15, 0xB7, 0xF2, 0x4A, 0x1B, 0x7E, 0xA8, 0xC9, 0x11, 0xB7,
-    0x73, 0xF4, 0x1F, 0x44, 0xEB, 0x80, 0x3F, 0x52, 0x75, 0x23, 0x7D, 0xDF, 0x22, 0x00, 0x84, 0xF7,
-    0x5B, 0x5C, 0x1B, 0xC3, 0x7D, 0x2A, 0x50, 0x1F, 0x92, 0x80, 0x46, 0x9E, 0x29, 0xDB, 0xAD, 0x86,
-    0x8C, 0xFD, 0xC5, 0x3A, 0x45, 0x22, 0xDF, 0x96, 0xA1, 0xBC, 0x61, 0x2C, 0x38, 0x32, 0xA1, 0xCB,
-    0xB0, 0x0A, 0x94, 0x98, 0xE3, 0x85, 0xC6, 0x44, 0x50, 0x7C, 0xF8, 0x12, 0x83, 0xA9, 0x54, 0x6C,
-    0x01, 0x87, 0xE1, 0x17, 0x61, 0x82, 0x60, 0x6F, 0x58, 0x09, 0x37, 0xD8, 0x8A, 0xA8, 0x2F, 0x7C,
-    0x68, 0x0A, 0xBE, 0xB3, 0x53, 0x7C, 0x9A, 0xEC, 0xE9, 0x81, 0x13, 0xC1, 0xD7, 0x72, 0x68, 0x11,
-    0xC2, 0x5B, 0x13, 0x91, 0x70, 0x90, 0x11, 0x33, 0x7C, 0x53, 0xD8, 0x17, 0xE1, 0xAA, 0x84, 0x5E,
-    0x87, 0x37, 0x6B, 0x17, 0xB9, 0x61, 0x2E, 0xF8, 0x7D, 0xF9, 0x0D, 0xC6, 0xEC, 0x3A, 0xD4, 0x57,
-    0x36, 0xFA, 0x52, 0x8C, 0x86, 0x3E, 0xC7, 0xD9, 0x11, 0x5E, 0x64, 0x7F, 0x04, 0x93, 0x61, 0x3E,
-    0xED, 0x30, 0x9F, 0x17, 0x22, 0x31, 0xCF, 0xB8, 0x5B, 0x8B, 0xF5, 0xB0, 0x26, 0x43, 0x95, 0x31,
-    0x09, 0x85, 0x2D, 0xDA, 0x01, 0x68, 0xC4, 0xD1, 0x4C, 0x5B, 0xD8, 0x14, 0xEA, 0x29, 0xC6, 0xAE,
-    0x59, 0xD4, 0xAC, 0x4E, 0x4A, 0xC6, 0x5A, 0x4F, 0x6D, 0x70, 0x2E, 0x90, 0x66, 0x78, 0x63, 0x76,
-    0x09, 0x50, 0x07, 0xD5, 0x78, 0x50, 0x30, 0x6A, 0x59, 0x5F, 0xB6, 0xC3, 0x91, 0x2F, 0x35, 0x91,
-    0x1C, 0x1D, 0xF1, 0x66, 0xB3, 0x66, 0xED, 0x8F, 0x63, 0xD4, 0xAB, 0x79, 0xD0, 0xC4, 0x28, 0xC7,
-    0x4B, 0x1A, 0x28, 0x33, 0xF5, 0x4D, 0x8D, 0xCD, 0x5D, 0xA9, 0x9D, 0x62, 0x88, 0xB4, 0x38, 0xD9,
-    0xAF, 0x5C, 0x06, 0x07, 0x36, 0x69, 0x5F, 0xBA, 0xFB, 0xFF, 0xE2, 0xF6, 0x2A, 0x2A, 0x1D, 0xEC,
-    0x4D, 0xC6, 0xF6, 0xAE, 0xA8, 0xDB, 0xA2, 0x09, 0x96, 0xF4, 0xB4, 0x31, 0x9F, 0x41, 0x66, 0xD1,
-    0x2A, 0xD0, 0x97, 0x96, 0xF4, 0xDF, 0xDF, 0xB9, 0x31, 0x9B, 0x09, 0x63, 0x30, 0xE5, 0x65, 0x47,
-    0x83, 0xE9, 0xA0, 0xA0, 0x43, 0x56, 0xF9, 0x92, 0xF1, 0x3B, 0x9C, 0x88, 0x2C, 0xBD, 0xF0, 0xF6,
-    0x67, 0x8A, 0x94, 0x52, 0x52, 0x92, 0x76, 0xF4, 0xEA, 0x17, 0xE6, 0xC4, 0x51, 0xC1, 0x4F, 0xD0,
-    0x11, 0x82, 0x34, 0x90, 0x2C, 0x21, 0x5F, 0x7D, 0x9C, 0xEF, 0x43, 0x32, 0x97, 0xDC, 0x4B, 0x42,
-    0xDA, 0x6A, 0xF5, 0xFB, 0x66, 0xFA, 0x83, 0xCD, 0xF0, 0x92, 0x7C, 0x1F, 0xD3, 0x2A, 0x12, 0xD3,
-    0x5F, 0x75, 0xE4, 0x70, 0xA7, 0x1A, 0x08, 0x06, 0xDA, 0x12, 0x5E, 0xBD, 0x25, 0xC3, 0x86, 0xDE,
-    0x46, 0x66, 0x72, 0xB6, 0xD6, 0x49, 0xB6, 0x16, 0xCB, 0x51, 0xBB, 0x98, 0xFE, 0xFC, 0x33, 0x85,
-    0xC6, 0x21, 0x63, 0xD5, 0x1F, 0xDD, 0x78, 0xB3, 0x93, 0xA6, 0xD1, 0x12, 0xD9, 0xF2, 0xDD, 0xE7,
-    0x7A, 0x73, 0xD2, 0x26, 0xEC, 0xB2, 0x31, 0x3E, 0xE9, 0xFA, 0x9D, 0x1E, 0x16, 0x5F, 0x36, 0x07,
-    0x18, 0x74, 0xCE, 0xD0, 0xCD, 0xB7, 0x34, 0x29, 0x92, 0x3C, 0xF7, 0x0A, 0xDD, 0x65, 0xE6, 0x14,
-    0x42, 0x7F, 0xB6, 0xB2, 0xE1, 0x3F, 0xEA, 0x5E, 0xC7, 0x6C, 0x8F, 0x40, 0xB2, 0x02, 0x9F, 0x4B,
-    0x04, 0x64, 0xAE, 0x0C, 0xB3, 0xE7, 0xC8, 0x93, 0x5B, 0x9B, 0xCF, 0x5B, 0x97, 0x7B, 0x1F, 0xD6,
-    0x88, 0xE5, 0x88, 0x19, 0x83, 0xBC, 0x41, 0xB5, 0xBC, 0xB0, 0x1D, 0x89, 0x9F, 0xB0, 0x2C, 0x58,
-    0xAA, 0x19, 0xBF, 0xC7, 0xB1, 0x7A, 0xCE, 0x37, 0xB2, 0x90, 0x75, 0xB8, 0x3A, 0x5D, 0x91, 0x87,
-    0xCA, 0x3B, 0x75, 0xD9, 0xDC, 0xDA, 0xFC, 0xED, 0x71, 0x9B, 0xFF, 0x8F, 0x68, 0xFC, 0x0E, 0xF8,
-    0xAF, 0xCC, 0x45, 0xA4, 0x49, 0x15, 0x6E, 0xB9, 0xD6, 0x3F, 0xD4, 0x79, 0xA1, 0x97, 0xB4, 0x3A,
-    0x04, 0x2B, 0x78, 0xCD, 0x2D, 0x5D, 0x3C, 0xF4, 0xD0, 0xFF, 0x67, 0x44, 0x59, 0xE0, 0x56, 0x63,
-    0xDF, 0x59, 0x60, 0x11, 0xB8, 0x09, 0xB2, 0x6F, 0x1C, 0x39, 0xCE, 0x4F, 0x46, 0x94, 0xA5, 0xEF,
-    0x3A, 0x20, 0x15, 0x89, 0x4B, 0x82, 0xEC, 0xEB, 0x87, 0xCD, 0xA0, 0x35, 0x70, 0x76, 0x19, 0xBE,
-    0xFB, 0x5C, 0x87, 0x0C, 0x82, 0x83, 0xF3, 0xDD, 0xC2, 0x72, 0xC8, 0x80, 0x46, 0x5F, 0x11, 0xEA,
-    0xD7, 0xF2, 0x8A, 0xF6, 0x35, 0x75, 0x4F, 0x25, 0x20, 0xC7, 0xD9, 0x06, 0x36, 0x58, 0x67, 0xA2,
-    0x7A, 0x1F, 0xF9, 0x05, 0x16, 0x93, 0x9D, 0x46, 0xC0, 0xAA, 0x3E, 0xD9, 0xDB, 0x04, 0x52, 0xD8,
-    0x32, 0x7B, 0x78, 0xBF, 0xCF, 0xDC, 0x7C, 0xDD, 0xDB, 0xC8, 0x1F, 0xF5, 0x10, 0x52, 0x7B, 0x22,
-    0x25, 0x24, 0x56, 0xFB, 0x79, 0x5D, 0xF9, 0xF0, 0xA8, 0x4F, 0x61, 0x3F, 0xFB, 0xA0, 0x01, 0x83,
-    0x6B, 0x2F, 0xC3, 0x51, 0x82, 0x61, 0x00, 0xA0, 0x7F, 0x74, 0x29, 0xE3, 0x1E, 0x80, 0xE3, 0x65,
-    0x7C, 0xF1, 0x64, 0x4F, 0x30, 0xA2, 0x56, 0xEA, 0x51, 0x8D, 0xB8, 0x5F, 0xE1, 0x5D, 0x34, 0x4F,
-    0xC0, 0x61, 0x81, 0x5D, 0x1A, 0x65, 0x07, 0xC9, 0x13, 0x37, 0x82, 0x2D, 0xD0, 0x32, 0x9E, 0x73,
-    0x65, 0xC8, 0x0C, 0xE3, 0x0E, 0x3B, 0x6B, 0x50, 0xBE, 0x6E, 0xC8, 0xDE, 0x6E, 0x7D, 0x56, 0xBA,
-    0x91, 0xBF, 0x98, 0x17, 0xEA, 0xBF, 0x23, 0x33, 0xF6, 0xC4, 0xEC, 0x25, 0x35, 0xB7, 0xFB, 0x83,
-    0x16, 0x68, 0x60, 0xEC, 0x98, 0x8E, 0x1D, 0xFE, 0x49, 0x6E, 0xDF, 0xD8, 0xD7, 0x24, 0x51, 0xBC,
-    0x7B, 0x13, 0x06, 0xCD, 0x18, 0x8E, 0x59, 0x48, 0xF8, 0xF6, 0xB4, 0x54, 0xD5, 0x21, 0x88, 0x99,
-    0x54, 0xED, 0x0A, 0x2F, 0x2D, 0x60, 0xD2, 0x33, 0x19, 0x19, 0xCC, 0xD5, 0xD0, 0x6B, 0xF4, 0xD5,
-    0x9E, 0x4C, 0x85, 0x48, 0x15, 0x21, 0xE3, 0x3D, 0x3B, 0xE6, 0x9D, 0xC6, 0x9B, 0xEF, 0x1A, 0xEB,
-    0x59, 0x45, 0xD7, 0xB2, 0xC6, 0x99, 0xCD, 0x32, 0xF8, 0x22, 0x58, 0xB7, 0xBF, 0x87, 0x9A, 0x94,
-    0x47, 0x90, 0x45, 0xA2, 0xC0, 0x49, 0x7F, 0xA3, 0x3B, 0xA0, 0xF3, 0x93, 0x78, 0xF9, 0x08, 0x77,
-    0x74, 0xCD, 0x24, 0x8B, 0x4B, 0xB3, 0x0A, 0xB2, 0x43, 0x4E, 0xEA, 0x0F, 0x67, 0xDC, 0x0E, 0xD1,
-    0xE4, 0x2E, 0x73, 0x2A, 0x15, 0x60, 0x21, 0xBE, 0xE0, 0x1D, 0x15, 0xA5, 0x70, 0x5C, 0xB8, 0xB8,
-    0x7F, 0xD7, 0x70, 0xF1, 0x62, 0xB0, 0x9A, 0xD0, 0xE3, 0x43, 0x23, 0x75, 0xBC, 0x8F, 0x1A, 0x2E,
-    0x9E, 0x68, 0xEA, 0xBE, 0x05, 0x92, 0xC5, 0x2F, 0xCF, 0x1C, 0xEA, 0xA7, 0xAB, 0x69, 0x2D, 0x11,
-    0x49, 0x9E, 0x6A, 0x24, 0x79, 0xB3, 0x15, 0x49, 0x6E, 0x35, 0x60, 0xD0, 0x1A, 0x04, 0x87, 0x22,
-    0xC9, 0x11, 0x61, 0xDA, 0x31, 0x92, 0xFC, 0x70, 0xAA, 0xD5, 0xFF, 0x6F, 0x42, 0xE6, 0x3F, 0x2A,
-    0x34, 0x7C, 0x02, 0x33, 0x61, 0xA1, 0x61, 0x7E, 0x2C, 0x34, 0x3C, 0xFC, 0x49, 0x02, 0x19, 0x23,
-    0x99, 0xE5, 0x0B, 0xC8, 0xEE, 0xE4, 0xB7, 0x9C, 0x9C, 0x21, 0x94, 0x48, 0x74, 0xF4, 0xDD, 0xBC,
-    0x12, 0x5A, 0x36, 0x5A, 0xBB, 0xA3, 0x60, 0x44, 0x6A, 0x89, 0x20, 0xCB, 0xC5, 0xFD, 0xB0, 0x72,
-    0x85, 0xA9, 0x2A, 0xF9, 0x26, 0xA9, 0x54, 0x19, 0x04, 0xEA, 0xB1, 0x48, 0xC0, 0xD7, 0xCA, 0x12,
-    0x6A, 0x14, 0xE3, 0xC1, 0x86, 0x9E, 0x2E, 0xA7, 0x42, 0xD4, 0xE0, 0x4E, 0x03, 0x84, 0xF8, 0xF6,
-    0x60, 0xBD, 0xF9, 0x34, 0x38, 0xAB, 0x91, 0xC8, 0x18, 0x5B, 0x3C, 0xCE, 0xC3, 0xC8, 0x4F, 0xF9,
-    0xF8, 0xEC, 0x07, 0x96, 0x89, 0xDC, 0x44, 0xBE, 0x03, 0xA5, 0xC2, 0xD4, 0x51, 0xFB, 0xEC, 0xF2,
-    0x85, 0x87, 0xF0, 0xCD, 0xD5, 0xD7, 0x3E, 0x0E, 0x2F, 0xB5, 0x82, 0xEF, 0xB0, 0xDC, 0x4A, 0x47,
-    0x4F, 0x0C, 0x6E, 0xA1, 0xA4, 0x75, 0x4E, 0x3E, 0xC2, 0x58, 0x65, 0x12, 0xDF, 0xAC, 0xA8, 0x8E,
-    0x01, 0xC8, 0x10, 0xA8, 0x06, 0x7A, 0xB5, 0x8B, 0xE4, 0xD6, 0x23, 0xCA, 0x3C, 0xC1, 0xA8, 0x2D,
-    0x52, 0x7D, 0xD2, 0x22, 0x8D, 0xBB, 0x15, 0xBA, 0x20, 0x23, 0x14, 0xDE, 0x65, 0x2D, 0x51, 0x69,
-    0x14, 0xEA, 0x3B, 0xA5, 0xEA, 0x08, 0x19, 0xF3, 0xCA, 0xBC, 0xB5, 0x10, 0x5E, 0x85, 0x75, 0x2B,
-    0xC9, 0xA9, 0xCC, 0x99, 0x72, 0x7A, 0xAE, 0x82, 0x2A, 0x92, 0x0C, 0xC1, 0x5F, 0x81, 0x2F, 0x3A,
-    0x18, 0xD7, 0x9A, 0x39, 0xC0, 0xE9, 0x0F, 0xE5, 0xB5, 0xA4, 0xCE, 0xAA, 0x51, 0xC3, 0xD1, 0x73,
-    0x1D, 0x08, 0x01, 0x3C, 0x7E, 0xCC, 0x20, 0x84, 0x33, 0x57, 0x35, 0xD1, 0xF5, 0x61, 0xF1, 0xF6,
-    0x8F, 0xE5, 0xA5, 0x81, 0xA4, 0x29, 0x63, 0xA6, 0x77, 0x10, 0xC4, 0x58, 0x7C, 0x76, 0xBB, 0x83,
-    0x7F, 0xE0, 0xE4, 0x73, 0xC8, 0x05, 0xF1, 0x92, 0x15, 0xCA, 0xFD, 0x12, 0x4E, 0x79, 0xE5, 0x18,
-    0x9C, 0x05, 0x8C, 0x31, 0xE5, 0x56, 0xD7, 0xFE, 0x28, 0xDE, 0xA6, 0xE3, 0x5C, 0x7A, 0x42, 0x03,
-    0xA7, 0x11, 0x4E, 0xB2, 0x2B, 0x0F, 0x38, 0x23, 0xC8, 0xF1, 0x4F, 0x0F, 0xDE, 0x9E, 0x7B, 0x67,
-    0x22, 0x69, 0x24, 0xD5, 0xB8, 0x5B, 0x22, 0xE9, 0xF1, 0xFD, 0x24, 0x92, 0x1E, 0xBC, 0x32, 0xF1,
-    0x42, 0xB8, 0xF3, 0x36, 0x91, 0x34, 0x37, 0x08, 0x25, 0xBF, 0x60, 0x29, 0xDC, 0x5B, 0x0B, 0xEF,
-    0x96, 0xEC, 0x50, 0xC8, 0x24, 0xC2, 0xE1, 0xF6, 0xEE, 0xF2, 0xE6, 0x98, 0xF9, 0x66, 0xDA, 0x71,
-    0xC5, 0x87, 0x22, 0x5B, 0xBC, 0xD2, 0xDF, 0xC8, 0x1B, 0x5F, 0x5F, 0x57, 0xFA, 0xF6, 0x7D, 0xBD,
-    0x39, 0x46, 0x4F, 0x04, 0x29, 0x32, 0x0D, 0x96, 0xF4, 0xF4, 0x87, 0x5B, 0xAC, 0x0A, 0x24, 0xB5,
-    0x43, 0xD9, 0x96, 0x37, 0xBE, 0xCA, 0x9E, 0x4F, 0xE3, 0x1B, 0x57, 0xE0, 0x77, 0x56, 0x9D, 0xE6,
-    0xEB, 0x6A, 0x8E, 0x4A, 0xBE, 0x9C, 0x53, 0x09, 0xD1, 0xF7, 0xEB, 0x57, 0xA7, 0x7E, 0xE8, 0xF8,
-    0xA9, 0x5B, 0x7C, 0x34, 0x7A, 0x71, 0xA4, 0x23, 0x9F, 0xBE, 0x9A, 0xA1, 0xC3, 0xFF, 0xD9, 0xCB,
-    0xF7, 0x15, 0x43, 0x75, 0x16, 0x89, 0x8E, 0xE4, 0xBF, 0x7B, 0xC7, 0x7F, 0xB3, 0x16, 0x42, 0x55,
-    0x04, 0x5D, 0x50, 0x3E, 0xA9, 0x82, 0x23, 0xC4, 0x4F, 0xD5, 0x74, 0xDF, 0xF5, 0x85, 0x2A, 0x77,
-    0x54, 0x77, 0xB3, 0xB3, 0x78, 0x77, 0x9B, 0xEC, 0x6F, 0xBC, 0x22, 0xA5, 0xA5, 0xE3, 0x67, 0xAB,
-    0xAF, 0xE5, 0xC2, 0xDD, 0x1E, 0xDF, 0xB3, 0x12, 0x14, 0x87, 0xDE, 0xB3, 0xE2, 0xF1, 0x3D, 0x2B,
-    0x11, 0x5E, 0xBF, 0x82, 0x00, 0x3D, 0xBC, 0xAA, 0x16, 0x8D, 0x74, 0x68, 0xA4, 0xA3, 0x0D, 0x4C,
-    0x11, 0x59, 0x35, 0x1A, 0x84, 0xC8, 0x27, 0x9D, 0xEA, 0x8E, 0xFE, 0xD6, 0x87, 0x12, 0x31, 0x1F,
-    0xCE, 0xCE, 0x7C, 0xED, 0xAC, 0x54, 0x0A, 0x01, 0x44, 0x76, 0xE6, 0x3E, 0x91, 0xCA, 0xA8, 0xC2,
-    0x9D, 0x2D, 0xEE, 0x1C, 0x7D, 0x73, 0x85, 0x97, 0x2D, 0xEE, 0x22, 0xEB, 0xB4, 0x54, 0x3A, 0x8D,
-    0xFF, 0xC6, 0x07, 0xE7, 0x3B, 0xDC, 0xD9, 0x21, 0x8F, 0x73, 0x2D, 0xB3, 0xF5, 0xF1, 0x45, 0xA5,
-    0xF5, 0x97, 0x6C, 0x94, 0x48, 0x7F, 0xF8, 0x36, 0x84, 0x9B, 0x51, 0x52, 0x5A, 0xEA, 0x7B, 0x72,
-    0x3F, 0x54, 0xCC, 0x5A, 0x7C, 0x96, 0x8D, 0xC4, 0x2B, 0xC6, 0xE5, 0x3A, 0x7A, 0x70, 0x2B, 0x5A,
-    0x38, 0x04, 0xD9, 0xC0, 0xD6, 0xFC, 0xB1, 0xBA, 0xCF, 0x25, 0x47, 0xBA, 0xCF, 0xF1, 0xB5, 0x58,
-    0xBF, 0xAB, 0x07, 0x4A, 0xC5, 0xA0, 0x67, 0xC6, 0xCA, 0xAA, 0xE1, 0x92, 0x31, 0xE6, 0xFD, 0x9A,
-    0x92, 0xFC, 0xB9, 0x79, 0x48, 0xEE, 0x73, 0x3F, 0x3F, 0xDE, 0x7D, 0x6E, 0x6C, 0xB5, 0xCF, 0x0C,
-    0x89, 0xFD, 0xAA, 0xBA, 0xA0, 0x8F, 0xEC, 0x4B, 0xC0, 0xC2, 0x23, 0x5E, 0x02, 0x56, 0x1F, 0x7E,
-    0x09, 0x58, 0xC8, 0xE8, 0x3E, 0x08, 0xD9, 0x8F, 0x5C, 0xEE, 0x6F, 0x5C, 0xB4, 0x2F, 0x01, 0x7B,
-    0x7D, 0xEB, 0x25, 0x60, 0xED, 0xF6, 0x4B, 0xC0, 0x0A, 0xD5, 0x4D, 0x23, 0x58, 0x66, 0x78, 0x09,
-    0xD8, 0xBD, 0x06, 0x3A, 0xE9, 0xAF, 0x9F, 0x1D, 0x02, 0x0F, 0xCB, 0x83, 0x81, 0x4E, 0x0F, 0x0D,
-    0xB4, 0xC0, 0x40, 0x3D, 0x24, 0xD7, 0xFC, 0x3F, 0xB5, 0x58, 0x31, 0x70, 0xDC, 0xC6, 0x15, 0xFD,
-    0xC0, 0x92, 0x44, 0x2C, 0xD8, 0x5E, 0x16, 0xD2, 0x4C, 0xE2, 0x8C, 0x84, 0x46, 0x85, 0x27, 0x21,
-    0x0F, 0xAD, 0x8B, 0xBB, 0x03, 0x44, 0x8D, 0xAB, 0x14, 0xD1, 0x64, 0x7C, 0xF1, 0x4C, 0x54, 0xB8,
-    0x49, 0x61, 0xBB, 0x51, 0xE3, 0x42, 0xC5, 0x91, 0x07, 0x5B, 0x85, 0x0B, 0x17, 0x66, 0xC6, 0xB1,
-    0x8B, 0xA4, 0x88, 0x32, 0xB1, 0x8B, 0xD0, 0x45, 0x54, 0xA8, 0x60, 0x71, 0x14, 0x36, 0xE4, 0x24,
-    0x29, 0x54, 0x18, 0x96, 0xC6, 0x93, 0x42, 0x45, 0x90, 0x48, 0x76, 0x11, 0xCF, 0x44, 0x2B, 0x19,
-    0x56, 0x56, 0x12, 0xEE, 0x36, 0xEF, 0x2F, 0x70, 0x12, 0xA9, 0x28, 0x23, 0x32, 0x4E, 0x70, 0x24,
-    0xB0, 0xD8, 0xFD, 0xFF, 0xEF, 0xFF, 0x7F, 0xFF, 0x7F, 0xFB, 0x17, 0xA4, 0xA8, 0x4B, 0x62, 0xDB,
-    0xD6, 0x17, 0xBA, 0xCF, 0x2F, 0x1D, 0x7A, 0xDA, 0xCF, 0xE8, 0x3C, 0x3D, 0x4F, 0x87, 0x68, 0x3F,
-    0x0D, 0x2F, 0x25, 0x52, 0x54, 0x92, 0x26, 0x3B, 0x7D, 0x56, 0x64, 0xE5, 0xF9, 0xA7, 0xF7, 0xCB,
-    0xD9, 0x36, 0xE6, 0x89, 0x62, 0x7B, 0xCD, 0x7E, 0x3D, 0x78, 0x69, 0x57, 0x83, 0x9B, 0xD6, 0x7E,
-    0x89, 0x7F, 0x33, 0x18, 0xB8, 0x0E, 0x1F, 0xED, 0x6B, 0xF8, 0x6F, 0x5F, 0xA9, 0xED, 0xE2, 0xEB,
-    0x7E, 0xFB, 0xFC, 0x6C, 0xD0, 0x5C, 0x4F, 0x18, 0x5E, 0xA4, 0x1F, 0x95, 0xC1, 0xE5, 0x2C, 0xEA,
-    0xD0, 0x70, 0xD3, 0xBB, 0xFD, 0x3F, 0x6E, 0xAA, 0x76, 0x72, 0xCC, 0xF7, 0x15, 0xFE, 0x67, 0xAF,
-    0x1B, 0x1B, 0x1B, 0xBF, 0xC1, 0xEB, 0x1F, 0x30, 0xBD, 0x5F, 0x0C, 0x43, 0x65, 0xA2, 0x93, 0x55,
-    0x12, 0xE8, 0x23, 0x24, 0x8B, 0x3A, 0xDA, 0x36, 0xB1, 0xD0, 0xBD, 0x40, 0x2D, 0x52, 0xB4, 0x5D,
-    0xC7, 0x27, 0x75, 0x12, 0x14, 0xE3, 0x30, 0x3B, 0x45, 0x6B, 0x81, 0x4E, 0xFC, 0x2A, 0xCA, 0xEA,
-    0x50, 0xF5, 0xBC, 0xD4, 0x57, 0xCB, 0x81, 0xEA, 0x85, 0x6A, 0x2C, 0xB3, 0x3A, 0x3A, 0x61, 0x30,
-    0x92, 0x08, 0x3D, 0x82, 0x0C, 0xEF, 0x94, 0x2C, 0xB6, 0xA4, 0x9A, 0x44, 0xAA, 0x8E, 0x4F, 0x98,
-    0xD8, 0xAF, 0xFA, 0x90, 0x26, 0xCA, 0x21, 0x04, 0x7A, 0x29, 0x77, 0xFE, 0xBE, 0x8E, 0x57, 0x4C,
-    0x22, 0x98, 0x7E, 0x55, 0x94, 0xE3, 0x40, 0x6D, 0x42, 0xFA, 0x3C, 0x8B, 0x1F, 0x09, 0x8D, 0xFE,
-    0x78, 0x05, 0x93, 0x18, 0xC9, 0xF3, 0x0C, 0x05, 0x4F, 0x75, 0x98, 0x8E, 0x10, 0x49, 0x45, 0x42,
-    0x13, 0x19, 0xA2, 0x3E, 0x51, 0x98, 0x92, 0x5F, 0x88, 0x7B, 0xF7, 0x72, 0x18, 0xF1, 0x8F, 0x5F,
-    0xFE, 0x42, 0xFB, 0x05, 0xD1, 0x45, 0xA2, 0xE5, 0x76, 0x64, 0x46, 0x26, 0x33, 0x12, 0xA5, 0x7B,
-    0x49, 0x1E, 0x08, 0xA8, 0x67, 0x2F, 0x2C, 0x94, 0x3B, 0x92, 0xE6, 0xD1, 0xC1, 0x0A, 0x95, 0xF4,
-    0x7E, 0xE7, 0xC8, 0xBB, 0xD6, 0xD6, 0xEC, 0x2A, 0x16, 0xD3, 0xD9, 0x43, 0xC2, 0x8F, 0x92, 0x3B,
-    0xE7, 0x57, 0x8A, 0x97, 0x40, 0xF2, 0x09, 0x28, 0xD3, 0xA3, 0x94, 0x82, 0x8F, 0x67, 0xDB, 0x45,
-    0x99, 0x46, 0x26, 0x99, 0x8C, 0x2C, 0xFF, 0x92, 0x69, 0x32, 0x09, 0x2B, 0x42, 0x64, 0x85, 0x85,
-    0x6F, 0xD3, 0xBC, 0xE6, 0xA0, 0xBA, 0x62, 0xB3, 0x4B, 0xB4, 0xE4, 0x96, 0x42, 0xBE, 0x73, 0x67,
-    0x32, 0x9A, 0xE7, 0x16, 0x18, 0x4D, 0x9E, 0xC6, 0xD7, 0x8C, 0x3F, 0x19, 0x51, 0xA4, 0x52, 0x3A,
-    0x45, 0x4D, 0xB7, 0x67, 0x68, 0x2B, 0x4F, 0x13, 0x25, 0xEF, 0x1B, 0x51, 0x93, 0x1D, 0x51, 0xAC,
-    0x64, 0xC9, 0xC3, 0x87, 0x49, 0x5E, 0xBE, 0x33, 0x1D, 0x79, 0x2E, 0x3E, 0x2F, 0xD3, 0x81, 0x12,
-    0xC5, 0x35, 0x0E, 0x3B, 0x0D, 0x6C, 0x49, 0x2F, 0x1C, 0x2C, 0x49, 0x5C, 0xE3, 0x94, 0xDD, 0x73,
-    0xF9, 0xD9, 0xFE, 0x7E, 0x5E, 0x6A, 0xED, 0xE7, 0x83, 0x82, 0xF8, 0x57, 0xD2, 0xC1, 0xF8, 0x06,
-    0xA7, 0x29, 0x70, 0xBF, 0xF0, 0x20, 0x7C, 0xF4, 0xE0, 0xCA, 0x11, 0x10, 0x85, 0xCB, 0x87, 0x9A,
-    0x7C, 0xCD, 0x8D, 0x2D, 0xC4, 0x48, 0xC5, 0x8D, 0xBE, 0xA7, 0x69, 0xEC, 0xDC, 0x91, 0x76, 0xA9,
-    0xC7, 0x8D, 0x40, 0xC9, 0x34, 0xE1, 0x86, 0xA7, 0x45, 0x11, 0x39, 0xFE, 0x21, 0x55, 0xA0, 0xC7,
-    0x15, 0x51, 0xAF, 0xC9, 0x2D, 0xA1, 0xE4, 0xC9, 0xF2, 0x35, 0xA2, 0x57, 0xA9, 0x0A, 0xB6, 0xB5,
-    0xD5, 0x9E, 0x2D, 0x3B, 0xBE, 0xAE, 0x2E, 0xE5, 0x34, 0xDD, 0x0A, 0xBE, 0xA8, 0xC6, 0x3D, 0x81,
-    0xE4, 0x51, 0xB9, 0xE9, 0x45, 0x64, 0xFA, 0xA4, 0x17, 0x6E, 0x24, 0xA1, 0x8A, 0x65, 0x8A, 0x09,
-    0x22, 0xBF, 0x0C, 0x76, 0x14, 0xC4, 0xC9, 0xCC, 0x78, 0xB7, 0x34, 0x22, 0x2B, 0x50, 0x7D, 0x1A,
-    0x0E, 0x11, 0xAE, 0xA2, 0x0C, 0xB3, 0x48, 0x22, 0xA6, 0x7C, 0xED, 0xEB, 0x70, 0xA7, 0x90, 0x29,
-    0x74, 0x1C, 0x8A, 0xD2, 0x60, 0xCE, 0x31, 0xC9, 0x37, 0xAB, 0x08, 0xB1, 0xD2, 0x23, 0xCF, 0x1A,
-    0x61, 0x2B, 0x8E, 0xB9, 0xC8, 0x50, 0xE2, 0xAC, 0xE0, 0x98, 0xD9, 0x65, 0x6F, 0x6B, 0x33, 0x07,
-    0x28, 0xB5, 0x66, 0x7B, 0xBA, 0x6D, 0x6F, 0x45, 0x19, 0x67, 0x86, 0xBB, 0xFA, 0x70, 0xC6, 0xB0,
-    0x6D, 0x47, 0x50, 0xAE, 0xDF, 0xB6, 0xE1, 0x82, 0x2C, 0x6E, 0xDB, 0xF0, 0x42, 0x29, 0x67, 0xB2,
-    0xA1, 0x65, 0x38, 0x03, 0x93, 0x88, 0xFA, 0x8D, 0x53, 0x1B, 0x86, 0x93, 0xE5, 0x77, 0x88, 0x5E,
-    0xE3, 0xBF, 0x2A, 0xF8, 0x54, 0xE7, 0x86, 0x6C, 0xE5, 0x59, 0x20, 0x87, 0x36, 0xA3, 0x3C, 0xCD,
-    0xE1, 0x97, 0x69, 0xF0, 0x85, 0x19, 0x22, 0xF9, 0xFB, 0x41, 0xB9, 0x05, 0xD7, 0xD4, 0x7D, 0x99,
-    0x0E, 0x23, 0x1A, 0x27, 0x64, 0x16, 0x6E, 0xC4, 0x10, 0xF0, 0x03, 0x15, 0xC9, 0x8C, 0xB3, 0xF7,
-    0x84, 0x16, 0xD7, 0x75, 0xB0, 0x53, 0x60, 0x26, 0x40, 0x01, 0x19, 0xE3, 0x55, 0x15, 0x14, 0xE5,
-    0xC5, 0xE8, 0xF7, 0x69, 0xB5, 0x07, 0x5F, 0x08, 0x0D, 0x86, 0x77, 0xC0, 0x90, 0xC6, 0x50, 0xD0,
-    0xAB, 0xC4, 0x15, 0xF8, 0xAB, 0x94, 0x6C, 0x19, 0x16, 0x74, 0x28, 0xF4, 0x18, 0xAA, 0x0D, 0xC1,
-    0x5E, 0xB3, 0xD7, 0x56, 0x34, 0x5B, 0x66, 0x27, 0x9E, 0xAD, 0x85, 0x35, 0x04, 0xCB, 0xE4, 0x84,
-    0xA2, 0x9A, 0xE2, 0xC6, 0x0F, 0x8B, 0xCE, 0x7D, 0xF8, 0x5B, 0xA5, 0xDA, 0x87, 0xB5, 0x21, 0x02,
-    0xA0, 0x83, 0xAD, 0xE8, 0x0D, 0xF4, 0xA0, 0xAD, 0x8C, 0xAF, 0x63, 0xB6, 0x15, 0xA0, 0x87, 0x38,
-    0xA0, 0x8E, 0x5F, 0x0A, 0x85, 0x51, 0x40, 0x0E, 0x8F, 0x8F, 0x09, 0x73, 0x30, 0x89, 0x00, 0x6B,
-    0x2F, 0x28, 0x1C, 0x34, 0xCA, 0x54, 0x47, 0x4C, 0xD8, 0xA3, 0xAE, 0x80, 0x09, 0xA0, 0xBD, 0x00,
-    0xE9, 0x09, 0x9C, 0x2C, 0x95, 0x28, 0x60, 0x0C, 0xD6, 0x95, 0x96, 0x56, 0x41, 0xB8, 0x0D, 0xED,
-    0xFB, 0x94, 0x04, 0xE8, 0xDE, 0xA4, 0xB1, 0x24, 0xB9, 0x52, 0x7A, 0xBA, 0x4B, 0x4B, 0x41, 0xB6,
-    0x2A, 0xDF, 0xD2, 0x54, 0xC7, 0xA2, 0x04, 0x41, 0xA8, 0x84, 0x1E, 0xCA, 0x0C, 0x34, 0x11, 0x8C,
-    0xD2, 0x1D, 0x26, 0xEB, 0x52, 0x24, 0xD4, 0x59, 0xA6, 0xBC, 0x40, 0x4F, 0x01, 0x01, 0x81, 0x73,
-    0x15, 0xF9, 0x7F, 0x21, 0xBA, 0x5D, 0xD0, 0xC5, 0x2E, 0x75, 0xC3, 0x74, 0x99, 0xB4, 0xA4, 0xE5,
-    0x30, 0x15, 0x3B, 0x0A, 0x30, 0x39, 0x87, 0x88, 0x93, 0x2A, 0x2C, 0xC2, 0x32, 0x28, 0x03, 0xED,
-    0x23, 0x74, 0x52, 0xC1, 0x51, 0x14, 0x68, 0x5A, 0xA3, 0x10, 0x7E, 0x98, 0x73, 0x2A, 0x4A, 0x15,
-    0x30, 0xF2, 0x5C, 0xA2, 0x11, 0xD5, 0xA2, 0x0A, 0x8B, 0x38, 0x5B, 0x6B, 0x21, 0xCB, 0x5D, 0x29,
-    0xC5, 0x29, 0x2D, 0xC6, 0x24, 0x0C, 0x16, 0xAA, 0xA6, 0x24, 0xC3, 0x52, 0x68, 0xAF, 0x04, 0xBE,
-    0x46, 0xCA, 0xE1, 0xE0, 0xC8, 0xA1, 0xAC, 0x57, 0x3B, 0x40, 0x84, 0xEC, 0x9A, 0x43, 0x45, 0xB9,
-    0x84, 0x1A, 0xF1, 0xC0, 0x3A, 0xA2, 0x82, 0x3E, 0xC4, 0xB4, 0xE0, 0xF8, 0x13, 0xE6, 0x57, 0x5E,
-    0x8D, 0x49, 0xAD, 0xC3, 0xE9, 0x5B, 0x4C, 0x4C, 0x75, 0xC0, 0xB1, 0x9A, 0x38, 0x81, 0xE8, 0x5D,
-    0x73, 0x10, 0x09, 0x95, 0x58, 0x54, 0x50, 0x62, 0x60, 0x9E, 0x22, 0x58, 0x02, 0xE5, 0xD7, 0xE0,
-    0xC9, 0x24, 0xF3, 0xAA, 0x6F, 0xB1, 0xE9, 0x0B, 0x60, 0x9A, 0x77, 0x8C, 0x6B, 0x52, 0xC5, 0x3B,
-    0x3A, 0xD4, 0x35, 0x8B, 0xC6, 0x4B, 0x74, 0x4E, 0x07, 0x65, 0xED, 0x99, 0x84, 0xFA, 0x12, 0x81,
-    0x8A, 0xB4, 0x36, 0x54, 0x75, 0xA8, 0x17, 0x66, 0x70, 0xA3, 0x50, 0x9B, 0xA4, 0x97, 0xA9, 0xEB,
-    0x91, 0xD7, 0x9A, 0x08, 0x9E, 0xB8, 0x48, 0x2E, 0x1B, 0x79, 0xAB, 0xF6, 0xEB, 0xB9, 0x06, 0x2C,
-    0xE9, 0x8C, 0x4D, 0x13, 0x6B, 0xC5, 0xCD, 0xED, 0x9A, 0xC6, 0xBC, 0xC8, 0x7D, 0x1A, 0x0B, 0xDD,
-    0x3C, 0xB0, 0xDD, 0x8E, 0x69, 0x18, 0x65, 0xC1, 0xE5, 0x92, 0xD6, 0x0C, 0x05, 0x13, 0x58, 0x9A,
-    0xBA, 0x2D, 0x03, 0xE9, 0xFE, 0x20, 0x45, 0x9A, 0x62, 0x00, 0x28, 0x92, 0xC3, 0x2A, 0x18, 0x08,
-    0xB3, 0x00, 0x51, 0xDF, 0xC3, 0x96, 0xFC, 0x1E, 0xC3, 0x28, 0x37, 0xCE, 0x1F, 0x07, 0xC9, 0xD3,
-    0x5D, 0xDC, 0x96, 0x24, 0x6E, 0x17, 0x91, 0xF6, 0x7E, 0x09, 0xC3, 0x91, 0xB1, 0x89, 0x85, 0xD4,
-    0x05, 0xBB, 0x8E, 0x6E, 0x2E, 0x2C, 0x22, 0xE4, 0x3F, 0xE5, 0xEF, 0xE7, 0xE4, 0xE0, 0x83, 0x23,
-    0x51, 0x1F, 0x45, 0xF7, 0x0B, 0xCC, 0x7B, 0x74, 0xD1, 0xAD, 0x25, 0xFB, 0x02, 0xFB, 0x18, 0x7A,
-    0xCE, 0x12, 0xC2, 0x0D, 0xF9, 0x8F, 0x9D, 0x4D, 0x20, 0xA5, 0x80, 0x3C, 0x44, 0xC7, 0xDC, 0x08,
-    0x72, 0x1F, 0x62, 0x2D, 0xF9, 0xD7, 0x38, 0x46, 0xC2, 0xB7, 0x94, 0xF4, 0xCA, 0x63, 0xA4, 0x7B,
-    0x74, 0x76, 0xC8, 0xC3, 0x6E, 0xAF, 0x6C, 0x2E, 0x39, 0xCB, 0x7A, 0x31, 0xC3, 0x91, 0x06, 0x35,
-    0x5D, 0x8D, 0xD4, 0x3E, 0x4F, 0x85, 0xD9, 0xB7, 0x1B, 0x07, 0x7E, 0xFE, 0x57, 0xDB, 0x70, 0xC1,
-    0x30, 0x67, 0xBF, 0xF7, 0xBA, 0xFD, 0xFB, 0x7A, 0x4B, 0x3D, 0x13, 0x10, 0xAD, 0xCD, 0x64, 0x5F,
-    0x6E, 0x7D, 0x84, 0x2A, 0xA4, 0x69, 0x84, 0x3A, 0x6E, 0xE6, 0xF3, 0x8C, 0x70, 0x18, 0x36, 0x9F,
-    0xCE, 0x51, 0xCA, 0x88, 0xEE, 0x42, 0xC3, 0x67, 0xCC, 0x73, 0xB9, 0xBB, 0x45, 0xD4, 0x80, 0x56,
-    0xE4, 0x10, 0xDC, 0x21, 0x11, 0x1D, 0x17, 0xC5, 0x3C, 0x1D, 0xF6, 0xB4, 0x2F, 0x6F, 0x7C, 0x9D,
-    0xAB, 0xF0, 0x6E, 0xF7, 0xCC, 0x9F, 0xA1, 0x87, 0xE6, 0x42, 0xCC, 0xBC, 0x6E, 0xEF, 0xFD, 0x9C,
-    0x7E, 0x92, 0x4F, 0x3F, 0x22, 0xC9, 0x42, 0x10, 0x84, 0x14, 0xDE, 0x64, 0xB3, 0x6E, 0x2A, 0x0A,
-    0xAE, 0x42, 0xB8, 0x7F, 0x0B, 0x38, 0xAC, 0x2F, 0xF1, 0xD4, 0xC8, 0x0F, 0x23, 0x8B, 0x26, 0x1E,
-    0xC7, 0x3C, 0x27, 0xA0, 0x0A, 0x41, 0xB2, 0xC8, 0x0B, 0xB7, 0x48, 0xBB, 0xCB, 0x44, 0xB7, 0xC8,
-    0xE3, 0x56, 0x05, 0xA7, 0xF1, 0xB0, 0x7D, 0x71, 0xBB, 0x8D, 0x7B, 0xC9, 0xDA, 0x17, 0xDE, 0x63,
-    0x18, 0x43, 0x1D, 0x20, 0xF7, 0xDB, 0x17, 0xB7, 0x17, 0xF5, 0x1B, 0xF5, 0x1B, 0xD3, 0xE2, 0x99,
-    0x58, 0xD3, 0x5A, 0xE7, 0x5E, 0xB8, 0xB2, 0x58, 0xFB, 0xED, 0x2A, 0xFD, 0xFB, 0x6F, 0x6D, 0xC0,
-    0x63, 0x8F, 0x1B, 0x59, 0x75, 0x5C, 0x47, 0x06, 0x89, 0xFD, 0xA1, 0xBD, 0xF2, 0x71, 0x05, 0x9F,
-    0xC5, 0x29, 0x6A, 0x92, 0xBD, 0x8D, 0x17, 0x5F, 0xB9, 0x6A, 0x2B, 0xC4, 0xD8, 0x63, 0x86, 0x5C,
-    0xC3, 0x4E, 0x12, 0xFB, 0xE2, 0x60, 0xB6, 0x0D, 0x2C, 0x20, 0xFC, 0x90, 0x10, 0x23, 0x6B, 0x03,
-    0x38, 0x36, 0xF9, 0x28, 0x3F, 0x77, 0xEF, 0x74, 0x7D, 0x9C, 0xE4, 0x76, 0xCA, 0xF1, 0x14, 0x14,
-    0x2E, 0xBA, 0x45, 0x53, 0x1E, 0x05, 0xCD, 0x23, 0x2C, 0xDC, 0x6A, 0x71, 0x1C, 0x71, 0x29, 0x96,
-    0x72, 0xC6, 0x7A, 0x20, 0x8E, 0x0A, 0x0A, 0x2A, 0x97, 0x30, 0x3C, 0x34, 0x79, 0x50, 0x4A, 0xB5,
-    0xA9, 0x33, 0x6C, 0x5C, 0xD2, 0x3E, 0x0E, 0xBB, 0x9C, 0x79, 0xE4, 0x5A, 0x6D, 0x66, 0xB4, 0x4D,
-    0x5A, 0xB5, 0x8F, 0x29, 0x1E, 0xE5, 0x1E, 0x06, 0x2F, 0x07, 0xE6, 0xBF, 0x0D, 0x75, 0x43, 0x3D,
-    0xFD, 0x60, 0xEA, 0xB3, 0xBA, 0x0A, 0x58, 0xE5, 0xA1, 0xE8, 0x84, 0x82, 0xAC, 0x65, 0xF4, 0xA6,
-    0x61, 0x3D, 0x1D, 0xDE, 0x70, 0x09, 0x59, 0x09, 0xA7, 0x5B, 0xC5, 0xB7, 0x1E, 0x2B, 0x25, 0x53,
-    0xC1, 0xDB, 0x10, 0x2F, 0x96, 0xDB, 0x37, 0xBB, 0xBC, 0x30, 0xD2, 0xCD, 0xB0, 0x5B, 0xAB, 0x28,
-    0x65, 0x7C, 0x02, 0xB9, 0x46, 0xD9, 0x86, 0xBF, 0x29, 0xE7, 0xFC, 0x7C, 0x03, 0x4E, 0x0E, 0x5E,
-    0xCE, 0xD8, 0x2C, 0x11, 0xEC, 0x38, 0x31, 0x3D, 0x5D, 0x27, 0x60, 0x9F, 0x30, 0x3C, 0x26, 0x7B,
-    0x6F, 0x6B, 0x7C, 0xAB, 0xD9, 0x1B, 0x86, 0x0B, 0xD7, 0x12, 0x3E, 0x4C, 0xB2, 0x0E, 0xBB, 0xA8,
-    0xC3, 0x09, 0xD0, 0x61, 0xFF, 0x76, 0x58, 0x9B, 0x65, 0xBE, 0xCD, 0xED, 0x75, 0x4C, 0xC2, 0x6E,
-    0xCF, 0x53, 0x28, 0x91, 0xB3, 0x26, 0x23, 0x64, 0x54, 0x43, 0xC2, 0x95, 0x73, 0xD2, 0x1C, 0x01,
-    0x5E, 0xD6, 0x4D, 0x44, 0x32, 0xB2, 0x3A, 0x94, 0xDE, 0x72, 0x8C, 0x4D, 0xE8, 0xB1, 0x53, 0x78,
-    0x41, 0x78, 0xD9, 0x38, 0xE7, 0xC4, 0xA3, 0x84, 0x23, 0x46, 0x22, 0x04, 0x3F, 0x84, 0x55, 0xF2,
-    0x63, 0x6B, 0xCF, 0xA9, 0xDC, 0x56, 0x1A, 0xC7, 0xA5, 0x2E, 0x6A, 0xB4, 0x4F, 0x90, 0x6B, 0xFF,
-    0x44, 0xC7, 0x94, 0x3B, 0xC6, 0xE8, 0xB8, 0x89, 0x8E, 0xFB, 0xE8, 0x98, 0xEC, 0xA6, 0xB8, 0x8A,
-    0x8E, 0x12, 0x1D, 0x05, 0xB6, 0x2A, 0x92, 0x0E, 0x9D, 0x50, 0xCC, 0x03, 0x8B, 0x69, 0x7F, 0x1D,
-    0xCD, 0xF5, 0x7D, 0x40, 0x0C, 0x84, 0x4E, 0x20, 0xF4, 0xE5, 0x4F, 0xE1, 0xD4, 0x65, 0xBC, 0xF8,
-    0x57, 0xB9, 0x91, 0xFC, 0xE7, 0x06, 0xD3, 0x14, 0xDC, 0x00, 0xD7, 0xC7, 0x8E, 0x9D, 0x9E, 0xDB,
-    0xD8, 0x58, 0xC7, 0xF8, 0xBA, 0xE0, 0x43, 0x40, 0xEF, 0x15, 0x60, 0x3D, 0xD4, 0x33, 0xAC, 0xEB,
-    0x0E, 0x1A, 0x35, 0x37, 0x58, 0xE1, 0x09, 0x37, 0xAE, 0xCF, 0x1A, 0x57, 0x67, 0x43, 0x4C, 0x63,
-    0xFA, 0xBF, 0x03, 0x17, 0xB3, 0x03, 0xCC, 0xB3, 0x26, 0xF2, 0x38, 0xAE, 0xF8, 0x9F, 0x63, 0x19,
-    0xFF, 0xC7, 0x85, 0x9A, 0x1F, 0xBD, 0xF7, 0xC7, 0x29, 0x2F, 0xC3, 0x73, 0x33, 0x14, 0x4A, 0x80,
-    0x1C, 0x5B, 0x09, 0xB6, 0xCC, 0x38, 0x13, 0x95, 0x44, 0x75, 0x00, 0x44, 0x58, 0xF4, 0x68, 0x4E,
-    0x54, 0xA3, 0xB7, 0x4D, 0xF2, 0x48, 0xB4, 0xE3, 0xA8, 0xB4, 0x62, 0xA4, 0xAA, 0x71, 0x08, 0xF3,
-    0xCB, 0xF9, 0xFD, 0xEF, 0x06, 0xFF, 0xFF, 0x6B, 0x3F, 0x9B, 0xD7, 0x37, 0x74, 0x49, 0x93, 0xC8,
-    0xDF, 0x58, 0x06, 0x6F, 0xD5, 0x5A, 0xFC, 0xAD, 0xF6, 0x2A, 0xAE, 0x25, 0x19, 0x6A, 0x22, 0x07,
-    0xD0, 0x80, 0x11, 0xBF, 0x39, 0x6B, 0x0E, 0x9B, 0x73, 0x64, 0xEA, 0xAA, 0xAA, 0xD2, 0x61, 0x75,
-    0xED, 0x08, 0xE3, 0x86, 0x50, 0x1D, 0x3A, 0x09, 0x1C, 0xA9, 0xFC, 0x7A, 0xCC, 0x89, 0x00, 0xA1,
-    0x47, 0xF8, 0xD0, 0xE6, 0x21, 0xBD, 0x6E, 0xE0, 0x51, 0xF2, 0x4E, 0x03, 0x4C, 0xDF, 0xA2, 0xEF,
-    0xDA, 0xE9, 0x8F, 0x4D, 0x97, 0x8D, 0xB7, 0xE6, 0x19, 0x07, 0x42, 0xBC, 0x39, 0x70, 0x45, 0x11,
-    0xBA, 0x35, 0xFB, 0x20, 0xE7, 0x22, 0x3D, 0xE4, 0x35, 0xF3, 0x34, 0xF6, 0x64, 0x3A, 0xCB, 0x0E,
-    0x5C, 0x6E, 0xD7, 0xEC, 0x0D, 0xA6, 0xCB, 0xC8, 0xCB, 0x36, 0x9F, 0xA1, 0x7E, 0x78, 0x0E, 0xE7,
-    0xC4, 0x4D, 0x00, 0xCA, 0x97, 0x5C, 0x40, 0x58, 0xE5, 0x0D, 0xF2, 0xBB, 0x03, 0x4E, 0xE5, 0xDB,
-    0x1B, 0xF6, 0xDE, 0x06, 0xF7, 0x90, 0xB8, 0x8F, 0xA1, 0x1A, 0x34, 0x09, 0x88, 0x7D, 0xB5, 0xF9,
-    0xAC, 0x63, 0x27, 0xDA, 0xDC, 0xBD, 0x4C, 0x9C, 0xD5, 0x40, 0x5B, 0x86, 0x5A, 0x6F, 0xFD, 0xF1,
-    0x2B, 0x19, 0x64, 0x8C, 0x35, 0x0E, 0x44, 0x1F, 0x6E, 0xF7, 0x8F, 0xB9, 0x78, 0x25, 0x80, 0xE4,
-    0x0C, 0xE3, 0x40, 0x73, 0x5A, 0x48, 0xB9, 0x1E, 0x36, 0x51, 0xCA, 0x5F, 0x0E, 0x50, 0x82, 0xE1,
-    0xFC, 0x8F, 0xF2, 0xF9, 0x4D, 0x54, 0xC6, 0x28, 0xA9, 0x8D, 0x44, 0x69, 0x5D, 0x0C, 0xC3, 0xAC,
-    0x42, 0x55, 0xEC, 0x6A, 0xAE, 0x63, 0x7E, 0xC1, 0x55, 0x34, 0x95, 0x47, 0x77, 0x89, 0x6C, 0x0A,
-    0x80, 0x91, 0x4B, 0xEE, 0xA8, 0x29, 0x1D, 0xD6, 0xF7, 0x1B, 0x80, 0x67, 0xDD, 0x2D, 0x61, 0xDE,
-    0xE4, 0x5D, 0xF6, 0xB3, 0xBC, 0xCE, 0xDA, 0x8B, 0x6A, 0xBF, 0x02, 0x16, 0x5B, 0xEC, 0x7C, 0x38,
-    0x79, 0x6B, 0xFE, 0x4F, 0x1F, 0x7A, 0x8F, 0xBB, 0xC3, 0xEB, 0x8C, 0x84, 0xA2, 0x9E, 0x70, 0xCF,
-    0xF4, 0x39, 0xBE, 0x1F, 0xDA, 0xEF, 0x1C, 0x4D, 0x21, 0x15, 0x38, 0x9D, 0x3C, 0x27, 0x80, 0xAB,
-    0xB4, 0xFD, 0x5D, 0x0E, 0xE2, 0xBD, 0x93, 0x95, 0x33, 0x6A, 0xCA, 0xED, 0x69, 0x63, 0xED, 0x0A,
-    0xDF, 0x7D, 0x40, 0xE4, 0x8E, 0x99, 0xC6, 0x8F, 0xE3, 0x5C, 0x38, 0x57, 0x4D, 0x93, 0x13, 0xB3,
-    0xA2, 0x6D, 0xFA, 0xE0, 0xB6, 0xF5, 0xA4, 0x29, 0x19, 0x39, 0x16, 0x79, 0x8D, 0x0D, 0x02, 0x42,
-    0xD4, 0x68, 0xF9, 0x35, 0xC7, 0xE9, 0xC5, 0x27, 0x31, 0xBE, 0xBA, 0x77, 0xA2, 0xC9, 0x03, 0xFF,
-    0x7A, 0xCD, 0xE7, 0x8D, 0xE6, 0xE8, 0xD5, 0x77, 0x7A, 0xCB, 0xEC, 0x29, 0xEC, 0x72, 0x38, 0x66,
-    0x16, 0x20, 0x36, 0x82, 0x4F, 0x26, 0x7D, 0x70, 0x78, 0x18, 0xE0, 0x3D, 0xB3, 0x29, 0x01, 0x77,
-    0x71, 0x34, 0xD5, 0x54, 0xEE, 0x3E, 0x3F, 0x9C, 0x99, 0x7D, 0x54, 0x5B, 0x1B, 0x0C, 0x4E, 0x35,
-    0x03, 0x7B, 0x38, 0xE6, 0xC0, 0xB1, 0x88, 0x65, 0x93, 0x59, 0xE2, 0xE6, 0x88, 0xDC, 0x1C, 0xD8,
-    0xD2, 0x8E, 0x61, 0x60, 0x93, 0x1E, 0xE1, 0xF8, 0xB0, 0xA9, 0x47, 0xEF, 0x4C, 0x5A, 0xD8, 0xF5,
-    0x7E, 0x36, 0xC9, 0x7F, 0x75, 0xA5, 0x3D, 0x46, 0x27, 0xF1, 0xB5, 0xBB, 0x38, 0x0F, 0x34, 0xE3,
-    0xC8, 0xF9, 0xC5, 0x51, 0xFC, 0x65, 0x85, 0x80, 0xF5, 0x7F, 0xCD, 0x44, 0xEB, 0x34, 0xFB, 0x2A,
-    0x83, 0x8D, 0xE8, 0xB3, 0xE6, 0x1B, 0x84, 0x50, 0x07, 0xFC, 0x3E, 0x72, 0xBA, 0x08, 0xF8, 0x57,
-    0x1E, 0xE8, 0x3B, 0x47, 0x3E, 0x4D, 0xEA, 0xD8, 0x48, 0x1D, 0xE2, 0x2C, 0xB3, 0x5F, 0xAE, 0xE6,
-    0xFB, 0x88, 0x97, 0x0A, 0x15, 0x14, 0x52, 0x47, 0x55, 0x52, 0xE7, 0xD3, 0xFD, 0x73, 0xFA, 0x59,
-    0x58, 0x2E, 0xBD, 0x70, 0xE1, 0xD9, 0x6E, 0x17, 0x35, 0x8E, 0x3A, 0x80, 0x85, 0xD9, 0xCB, 0xD9,
-    0x7F, 0xE3, 0x99, 0x7F, 0x01, 0xED, 0x54, 0xBD, 0x6E, 0x14, 0x49, 0x10, 0xFE, 0x7A, 0x1A, 0x33,
-    0x42, 0x23, 0x79, 0x1C, 0xB0, 0x09, 0xE8, 0xB6, 0x09, 0x88, 0x90, 0xEC, 0x4D, 0x07, 0x98, 0xDD,
-    0x1D, 0x74, 0x0F, 0x40, 0xB2, 0xBC, 0x81, 0x23, 0x27, 0xA4, 0x0E, 0xC6, 0xB8, 0x11, 0x42, 0x64,
-    0xC0, 0x23, 0x10, 0x10, 0xE0, 0x25, 0x20, 0x59, 0xE9, 0x38, 0xC9, 0xF6, 0xB4, 0xE4, 0xE0, 0x82,
-    0x0B, 0xB6, 0x11, 0x0F, 0xB0, 0x2D, 0x39, 0xB4, 0x90, 0x1B, 0x79, 0x10, 0x63, 0x6B, 0x77, 0x8B,
-    0xEA, 0xB3, 0x0F, 0x04, 0x42, 0x42, 0x44, 0x24, 0xF4, 0x94, 0xFA, 0x4F, 0xA5, 0xAA, 0xFE, 0x7E,
-    0x34, 0xB8, 0x08, 0x35, 0xC7, 0x7C, 0x9E, 0x98, 0xB2, 0x87, 0xA6, 0x8E, 0x3E, 0x9A, 0x78, 0x02,
-    0x55, 0x62, 0xC3, 0x8B, 0x23, 0x9B, 0x8C, 0x75, 0xAF, 0x23, 0xEA, 0x7E, 0xA5, 0xFB, 0x0D, 0x16,
-    0x80, 0x23, 0xBD, 0xB4, 0xFF, 0x38, 0x0B, 0xF1, 0x10, 0x3C, 0x12, 0x0B, 0x65, 0xD1, 0xB7, 0xF8,
-    0xCB, 0x8A, 0x7D, 0x2B, 0xF7, 0x6C, 0xFA, 0xA7, 0x6D, 0x4B, 0x9B, 0x4B, 0x5B, 0xD1, 0x8C, 0x03,
-    0xD2, 0x9E, 0x45, 0x18, 0x92, 0xA6, 0xF7, 0x86, 0x8F, 0x34, 0xD6, 0x11, 0x6B, 0x54, 0x4D, 0x42,
-    0xF5, 0x92, 0x32, 0xE8, 0x21, 0x72, 0xE8, 0x15, 0xF1, 0x64, 0x38, 0xA5, 0x39, 0xEE, 0x00, 0x0B,
-    0x05, 0xC8, 0xC7, 0x27, 0xCF, 0x52, 0x8D, 0x15, 0xA0, 0x0B, 0xE4, 0x95, 0xDE, 0x24, 0xBF, 0x89,
-    0xA6, 0x44, 0x99, 0x23, 0xCF, 0x51, 0x76, 0xD0, 0xA4, 0x07, 0x5E, 0x92, 0xC5, 0xC5, 0x50, 0x98,
-    0xE8, 0x88, 0x48, 0x73, 0xAA, 0xF0, 0x48, 0x0B, 0x94, 0x90, 0x0E, 0x0A, 0x68, 0x20, 0x4D, 0x28,
-    0x51, 0x23, 0x31, 0xA1, 0x0E, 0x0F, 0xC6, 0x4A, 0x38, 0xAE, 0x12, 0xD3, 0x5D, 0x41, 0xBD, 0x1D,
-    0x9B, 0xF9, 0x0E, 0xC8, 0x26, 0x87, 0x76, 0x3B, 0x79, 0x6B, 0x93, 0x27, 0x50, 0x5D, 0x34, 0xBB,
-    0x77, 0x4D, 0x35, 0x45, 0x0B, 0x18, 0xA0, 0x33, 0x8F, 0x8E, 0x77, 0xD3, 0xA2, 0x5B, 0xE2, 0x6F,
-    0x2F, 0x3E, 0x1A, 0x26, 0x63, 0x53, 0xD1, 0xB6, 0xFA, 0xE0, 0x90, 0x68, 0xE4, 0xDC, 0xE5, 0x5A,
-    0x05, 0x72, 0x62, 0x00, 0x14, 0x58, 0x04, 0x1C, 0x4F, 0x2F, 0x4F, 0x9E, 0xD0, 0x54, 0xB8, 0xD3,
-    0xE3, 0x05, 0x0C, 0x87, 0x7C, 0xE4, 0xBE, 0x6B, 0x67, 0x2B, 0x50, 0xD1, 0x38, 0xEC, 0xD6, 0xD3,
-    0xC8, 0xE5, 0xB1, 0x19, 0xA5, 0x85, 0x4F, 0xE1, 0xD3, 0x62, 0x14, 0x6B, 0x66, 0x4D, 0x61, 0x14,
-    0x69, 0x7E, 0xF5, 0x0A, 0x7C, 0xC2, 0x67, 0xD3, 0x8D, 0xEC, 0x32, 0x87, 0x34, 0x79, 0xAC, 0x6B,
-    0x25, 0xED, 0x2A, 0x96, 0x5A, 0x38, 0xA0, 0x07, 0xB5, 0xBA, 0x8D, 0x76, 0x8E, 0xCC, 0x63, 0x5F,
-    0xCB, 0xC7, 0x58, 0xCC, 0x90, 0xB9, 0xB0, 0x7D, 0xC8, 0x1A, 0xFD, 0x8C, 0x9C, 0x88, 0x7D, 0x35,
-    0x39, 0x2C, 0xCB, 0x5B, 0x3E, 0x36, 0x0A, 0xA5, 0xF8, 0xB2, 0x9C, 0xC2, 0x97, 0x27, 0xBB, 0x11,
-    0xD3, 0x09, 0x0F, 0xBE, 0xE9, 0x04, 0x7A, 0x55, 0x21, 0xEA, 0xFF, 0x27, 0xE6, 0x7D, 0x8F, 0x28,
-    0x80, 0x1A, 0x60, 0x93, 0xE4, 0x71, 0xB5, 0xF0, 0x39, 0x77, 0x47, 0x90, 0x8D, 0x5E, 0x39, 0xC4,
-    0x16, 0x2C, 0x63, 0x0F, 0xE2, 0xC3, 0xC9, 0xAB, 0x7F, 0xA8, 0x09, 0xF2, 0xFE, 0xB6, 0xCD, 0x2F,
-    0xB0, 0xCD, 0xF9, 0xAD, 0x88, 0x9A, 0x73, 0x8C, 0x6B, 0x19, 0xD1, 0x1B, 0x9A, 0x6D, 0x44, 0x13,
-    0x2C, 0x7B, 0x39, 0xB9, 0x3F, 0xEB, 0x37, 0x76, 0x00, 0xB1, 0x85, 0xFE, 0x5C, 0xDA, 0xE5, 0x36,
-    0xF2, 0x11, 0x98, 0x93, 0x71, 0xC1, 0x79, 0x41, 0xCB, 0x1D, 0x51, 0x54, 0x33, 0xB4, 0x8A, 0x90,
-    0x40, 0xDC, 0xA7, 0x8D, 0xF6, 0x08, 0x7D, 0x03, 0x82, 0x7C, 0x87, 0x76, 0x89, 0xD1, 0xEB, 0xC4,
-    0x54, 0x0D, 0xA3, 0xBE, 0x8A, 0x55, 0x6E, 0xCE, 0x32, 0xCA, 0x7F, 0xB5, 0x60, 0x4B, 0x6C, 0x03,
-    0x33, 0x70, 0x93, 0xE4, 0x81, 0x51, 0xC2, 0xE5, 0x78, 0xCD, 0x10, 0x2E, 0x3D, 0x17, 0x2C, 0x6D,
-    0x28, 0xBB, 0x0E, 0xBC, 0x1F, 0xBE, 0x1C, 0x13, 0xB1, 0x2C, 0x23, 0xE1, 0x6A, 0xC5, 0x74, 0x30,
-    0xC7, 0x59, 0x00, 0x2F, 0x75, 0x20, 0x21, 0x5B, 0x2B, 0x0E, 0x69, 0xCF, 0xA5, 0xA7, 0x36, 0x77,
-    0xDF, 0xD8, 0x5C, 0xE3, 0xAB, 0x5C, 0x3C, 0x75, 0x4A, 0xDE, 0xF7, 0x8B, 0x0A, 0xD7, 0x3D, 0x48,
-    0xCB, 0x03, 0x9D, 0xA6, 0x45, 0x96, 0x82, 0x6F, 0x75, 0x87, 0x1B, 0x67, 0x67, 0xBF, 0x2C, 0x0E,
-    0x7D, 0x65, 0x4D, 0x6C, 0xC9, 0x6A, 0x56, 0x35, 0x3D, 0x31, 0x95, 0x6F, 0x4D, 0x5A, 0xFC, 0x91,
-    0xC3, 0x8B, 0x7D, 0x9D, 0xA2, 0x9D, 0x7D, 0x77, 0xE3, 0x02, 0xFB, 0x57, 0x7E, 0xF4, 0x1C, 0x4E,
-    0xB8, 0x49, 0xAE, 0x87, 0x3A, 0xFF, 0xCF, 0x6B, 0x59, 0xB0, 0x5B, 0x88, 0x2E, 0xD6, 0xFB, 0xB7,
-    0xFC, 0x0D, 0xB2, 0x59, 0x2B, 0x3C, 0xF9, 0x73, 0x9C, 0x7F, 0xA1, 0x68, 0x1C, 0x7C, 0xB6, 0x81,
-    0xF8, 0x18, 0x97, 0x1D, 0xFB, 0x2C, 0x5E, 0x8D, 0xC7, 0x64, 0x5B, 0x88, 0x91, 0x40, 0xBD, 0xA8,
-    0xA6, 0x29, 0xBE, 0xFA, 0x74, 0x3C, 0xC3, 0xE0, 0x13, 0x9D, 0x57, 0x3D, 0x6C, 0xDD, 0xD6, 0x15,
-    0x3E, 0x24, 0x6B, 0x11, 0x35, 0x81, 0x5E, 0x0F, 0x4E, 0x02, 0xB4, 0xA8, 0xB9, 0x64, 0xE8, 0x62,
-    0x71, 0xEA, 0x26, 0x3D, 0xD2, 0xF1, 0xD0, 0x21, 0x83, 0x5C, 0xC0, 0x4F, 0x8B, 0x80, 0xA4, 0x43,
-    0x37, 0xB7, 0xD0, 0xD2, 0xC1, 0x01, 0x24, 0x91, 0xAD, 0xD7, 0x02, 0xD6, 0xE2, 0x16, 0xC8, 0x62,
-    0x07, 0x48, 0x8A, 0xF8, 0x79, 0x90, 0x07, 0x0D, 0x06, 0x2A, 0xF9, 0xD1, 0x30, 0x8A, 0x0E, 0x19,
-    0x42, 0xD7, 0x6D, 0x3D, 0x14, 0xA8, 0xD9, 0x2A, 0xAE, 0x11, 0x69, 0xF0, 0x8D, 0x4D, 0xD7, 0x94,
-    0x4C, 0xF2, 0xF6, 0xFB, 0x2E, 0x9F, 0x64, 0x39, 0x71, 0x33, 0xF8, 0xE1, 0xF1, 0x90, 0x3C, 0xF7,
-    0xEF, 0xFC, 0x7E, 0xE7, 0x50, 0x04, 0xBF, 0xA8, 0x4B, 0x24, 0x35, 0xA5, 0xC4, 0xD9, 0x75, 0x89,
-    0x13, 0x11, 0x95, 0x8B, 0xF8, 0x85, 0x88, 0xAB, 0x31, 0xD8, 0xC8, 0x68, 0x94, 0x4A, 0x6C, 0x4C,
-    0xAE, 0xB6, 0x47, 0x95, 0xA7, 0x65, 0x05, 0x2C, 0x95, 0xC7, 0xE2, 0x36, 0x98, 0x17, 0x9B, 0xBD,
-    0xAB, 0xAE, 0x31, 0x26, 0x71, 0xD2, 0x61, 0x62, 0x17, 0x7A, 0xFD, 0x22, 0x91, 0x58, 0xFA, 0x9D,
-    0x3C, 0x63, 0x44, 0xB0, 0x5C, 0xE4, 0xF8, 0x11, 0xBC, 0xDD, 0x2A, 0x45, 0xCE, 0x4F, 0x8B, 0x04,
-    0x0F, 0x0B, 0x09, 0x8C, 0xC9, 0x70, 0x35, 0xAE, 0xD1, 0x69, 0x96, 0xBE, 0x17, 0x64, 0xEA, 0x2F,
-    0x45, 0xE5, 0x34, 0xB3, 0x4A, 0xE2, 0xD3, 0xB9, 0xF6, 0xF4, 0xCC, 0x09, 0x89, 0xFD, 0xDF, 0x94,
-    0x7E, 0xB9, 0x3E, 0x2B, 0x2B, 0xEA, 0x74, 0xEE, 0x95, 0x7A, 0x46, 0xE2, 0xD0, 0xCF, 0xBC, 0xAF,
-    0xCA, 0x75, 0x89, 0x7E, 0xA9, 0x12, 0xC7, 0xE4, 0x5A, 0x54, 0xA3, 0x70, 0xDC, 0x9D, 0x52, 0x1C,
-    0x63, 0xD6, 0xB8, 0x61, 0x2D, 0xFF, 0x35, 0xBB, 0xA2, 0xBC, 0x5C, 0x1C, 0x7D, 0x5E, 0xE4, 0x44,
-    0x90, 0x88, 0xFD, 0x39, 0xE3, 0x2E, 0x81, 0xB4, 0xB5, 0x67, 0xE6, 0x5B, 0xAF, 0x15, 0xC7, 0xA1,
-    0x9C, 0x2D, 0xAE, 0x94, 0x56, 0x98, 0x68, 0xEE, 0xE9, 0xA9, 0x77, 0xBE, 0x68, 0xBC, 0x87, 0x6D,
-    0x2C, 0xE6, 0xF9, 0x5C, 0x1E, 0x17, 0x9E, 0x56, 0x85, 0x34, 0xD0, 0x2B, 0x86, 0x5E, 0x41, 0x11,
-    0x8B, 0x53, 0x53, 0x73, 0x30, 0x02, 0x8D, 0x0D, 0x3A, 0x28, 0x1A, 0x9A, 0x3F, 0x5D, 0xC7, 0xE1,
-    0x18, 0x36, 0x9D, 0xC8, 0x91, 0x44, 0x68, 0x13, 0x19, 0x43, 0xEB, 0xC8, 0x18, 0x1D, 0xE4, 0x13,
-    0x5B, 0x6E, 0xF0, 0x18, 0x5C, 0xDF, 0x64, 0x18, 0x53, 0x61, 0x49, 0xC7, 0x25, 0xC9, 0xE1, 0x19,
-    0xDF, 0xEF, 0x46, 0x1C, 0x2C, 0x9C, 0xB5, 0xBD, 0x2B, 0xDF, 0xDC, 0x63, 0xA2, 0xD4, 0x2E, 0x8F,
-    0xD3, 0x4E, 0x37, 0x5F, 0x43, 0x99, 0xEF, 0xC0, 0x41, 0x10, 0x08, 0xCA, 0x04, 0x74, 0x61, 0x85,
-    0x97, 0x4D, 0x91, 0xA9, 0xF1, 0xE8, 0x53, 0x8F, 0x32, 0x9D, 0xEB, 0x46, 0x19, 0x19, 0x54, 0xD7,
-    0x0A, 0x89, 0x2B, 0x7F, 0xA3, 0x1B, 0x9E, 0x39, 0xA4, 0x7F, 0x7F, 0x05, 0xDD, 0x68, 0x74, 0xCD,
-    0x4C, 0x7E, 0xFB, 0x87, 0xF1, 0x57, 0x59, 0xEA, 0xF7, 0xAC, 0xD9, 0x5E, 0x06, 0xCC, 0xD7, 0x51,
-    0xAB, 0x60, 0xDA, 0x7B, 0xA6, 0x4B, 0x4D, 0xA3, 0xBA, 0x79, 0xB3, 0xBB, 0x50, 0xC7, 0xB9, 0x6B,
-    0x12, 0x4F, 0x77, 0xE2, 0xC1, 0x34, 0x77, 0xE1, 0xA9, 0x42, 0xA2, 0xB9, 0x9C, 0xA1, 0xB1, 0x1C,
-    0x33, 0x4A, 0x9C, 0x0A, 0x7C, 0x2D, 0x3E, 0x86, 0xE2, 0x5C, 0xC2, 0xB9, 0xDC, 0x31, 0x76, 0x48,
-    0xF5, 0x43, 0xA9, 0x1D, 0xF2, 0xEE, 0xDB, 0xA1, 0xB0, 0x5F, 0x55, 0xDB, 0x21, 0xFF, 0xB6, 0x1D,
-    0x9A, 0x86, 0xC0, 0x50, 0x55, 0x5B, 0x21, 0x82, 0xCC, 0xDE, 0x66, 0x7A, 0x89, 0xAE, 0xD8, 0x9B,
-    0x57, 0x49, 0x28, 0x4A, 0xC3, 0x6A, 0x71, 0x01, 0xF3, 0x21, 0xDC, 0x72, 0xCF, 0xC0, 0x7E, 0x6A,
-    0x13, 0xAC, 0xD9, 0x06, 0xAC, 0xA7, 0x70, 0xCF, 0xB9, 0xE7, 0x7B, 0xE3, 0x3F, 0x50, 0xCD, 0xFF,
-    0x8C, 0xD7, 0xAE, 0xED, 0x25, 0xD5, 0xC0, 0x47, 0xA8, 0x6D, 0x84, 0xCE, 0xDA, 0x4E, 0xD7, 0x59,
-    0x13, 0x5C, 0xDA, 0x5D, 0xD8, 0x79, 0xE0, 0x95, 0xEA, 0xB2, 0xA8, 0x2C, 0x5E, 0x92, 0x81, 0xAC,
-    0x68, 0xA9, 0xC5, 0x60, 0x96, 0x6B, 0xC0, 0xF2, 0x1B, 0xB0, 0x14, 0x59, 0x51, 0x9E, 0xEE, 0xC1,
-    0x8E, 0x88, 0x05, 0x84, 0xB9, 0x0F, 0xAF, 0xD0, 0x15, 0x11, 0x9E, 0x97, 0x25, 0x44, 0x34, 0x56,
-    0x54, 0x1D, 0xA9, 0xB5, 0x49, 0xB6, 0x5B, 0x9D, 0x00, 0x3B, 0x28, 0x6E, 0x90, 0xED, 0x95, 0x7E,
-    0xE1, 0x36, 0xA9, 0x09, 0x93, 0xC5, 0xCF, 0x4C, 0x9B, 0x9A, 0xF6, 0xCD, 0xF6, 0xA7, 0xF0, 0x3B,
-    0xD8, 0x7B, 0xAB, 0x38, 0x81, 0xFE, 0x1C, 0x60, 0xB6, 0x48, 0x8D, 0xD9, 0xC2, 0xD9, 0xF2, 0x0A,
-    0x76, 0x45, 0x76, 0x60, 0x2E, 0xD3, 0xFB, 0x9D, 0x35, 0x43, 0x12, 0x77, 0x0C, 0x7E, 0xC5, 0xB8,
-    0x14, 0x6F, 0x8F, 0x62, 0x61, 0x2E, 0xE3, 0x7E, 0xD0, 0x7B, 0x3C, 0xF3, 0x4B, 0xEE, 0x27, 0x8D,
-    0x6F, 0x8A, 0x1A, 0xE9, 0x66, 0x9A, 0x81, 0x84, 0x17, 0xEA, 0xF7, 0x54, 0x16, 0xDC, 0xA9, 0x31,
-    0xE0, 0x69, 0x6C, 0x0F, 0x57, 0x86, 0x19, 0x92, 0xBD, 0xF6, 0x6A, 0x6C, 0x55, 0xC9, 0x18, 0x82,
-    0xA5, 0x3C, 0x82, 0x99, 0x90, 0xEA, 0x81, 0x53, 0x43, 0x65, 0x98, 0x06, 0xFB, 0xDD, 0x2E, 0x83,
-    0x12, 0x61, 0x57, 0x13, 0x03, 0x96, 0xED, 0x19, 0xD1, 0x5C, 0xE6, 0x3F, 0x2E, 0xC2, 0xDB, 0xA5,
-    0xB4, 0x63, 0x9E, 0x11, 0x5E, 0x36, 0x05, 0x65, 0x7B, 0xC3, 0x5A, 0x25, 0xF3, 0xB6, 0xA0, 0xB8,
-    0x0C, 0x30, 0x35, 0xA7, 0xB3, 0x5B, 0x59, 0x8A, 0x64, 0x50, 0x06, 0xB7, 0xB4, 0xFF, 0x4F, 0xD9,
-    0x08, 0x93, 0x0F, 0xB4, 0xCA, 0xAA, 0xE0, 0x22, 0x4E, 0xCA, 0xAA, 0x4A, 0x25, 0x8D, 0x9A, 0x3B,
-    0xA5, 0x83, 0x5B, 0xD5, 0x8D, 0x28, 0xB0, 0x81, 0x39, 0x26, 0xD1, 0xB3, 0xD3, 0xDE, 0xED, 0x12,
-    0x1B, 0xCD, 0xCE, 0xCA, 0x60, 0xD6, 0xBD, 0x9B, 0xBB, 0x4F, 0xF2, 0xE9, 0x25, 0x09, 0x97, 0x9C,
-    0x67, 0xB9, 0x3C, 0xCB, 0xD4, 0x0D, 0x51, 0xB5, 0x3C, 0xCF, 0xC4, 0x24, 0xAA, 0x62, 0xBC, 0x8D,
-    0x05, 0x7F, 0x5F, 0xF3, 0x4F, 0x68, 0xFB, 0x52, 0xDC, 0x2D, 0x26, 0x6F, 0x1C, 0x8F, 0xD6, 0xB4,
-    0xF7, 0xA4, 0x94, 0x28, 0x8B, 0x07, 0x08, 0x4F, 0x3E, 0xFA, 0x45, 0x3C, 0x70, 0x57, 0x07, 0x78,
-    0x1C, 0x78, 0x65, 0x8C, 0xEB, 0x35, 0x1F, 0xC5, 0xDB, 0x2A, 0x07, 0xB4, 0x08, 0x1E, 0x61, 0x8A,
-    0xC1, 0x70, 0xA1, 0x1A, 0x20, 0x21, 0x5B, 0x8C, 0x5A, 0xD7, 0xC8, 0x11, 0x92, 0x30, 0xEB, 0x89,
-    0x33, 0x5C, 0xFC, 0x2B, 0xC3, 0xA7, 0xE9, 0xC9, 0x8B, 0x81, 0xA8, 0x0D, 0x33, 0x04, 0xD7, 0xC5,
-    0xCC, 0x6F, 0x17, 0x4C, 0xA6, 0x4A, 0x44, 0x34, 0xE2, 0x2A, 0xCE, 0x00, 0xDB, 0x11, 0xCD, 0x1F,
-    0xBE, 0x4C, 0xD4, 0xE1, 0x57, 0x4E, 0x89, 0xE0, 0xC5, 0x0C, 0x59, 0x38, 0xCE, 0x82, 0x7A, 0xCA,
-    0x64, 0x40, 0x80, 0xCF, 0x33, 0x49, 0x3B, 0x85, 0x23, 0x93, 0x43, 0x29, 0x4E, 0xD0, 0x36, 0xDA,
-    0x92, 0xC3, 0xDC, 0x31, 0x24, 0x05, 0xA0, 0x01, 0x43, 0x3F, 0x6C, 0x24, 0x2A, 0xE4, 0x8C, 0x05,
-    0xFA, 0xA0, 0x9C, 0xA0, 0x3D, 0xA2, 0xA0, 0x7F, 0xE3, 0xC2, 0x4C, 0x11, 0xCF, 0x6C, 0x35, 0x20,
-    0xAA, 0xA0, 0x3E, 0x9C, 0x45, 0xE8, 0x00, 0x9A, 0x51, 0x4A, 0x0A, 0x61, 0xD0, 0x59, 0xBE, 0x2D,
-    0x38, 0x16, 0x7F, 0xC5, 0x58, 0x72, 0x69, 0x91, 0xD5, 0x02, 0xFB, 0xA6, 0x8C, 0x12, 0x40, 0x29,
-    0xB0, 0xC5, 0xAD, 0x90, 0xA8, 0x41, 0x09, 0x12, 0xE6, 0x2E, 0x71, 0x18, 0xA4, 0x01, 0x41, 0x76,
-    0xBB, 0x9A, 0xE1, 0xA6, 0x61, 0x04, 0x57, 0xC7, 0xC4, 0x4C, 0xAC, 0x7C, 0xF3, 0xD9, 0xEE, 0x30,
-    0x61, 0x60, 0xE4, 0x29, 0x89, 0xDB, 0x01, 0x11, 0xDD, 0x1A, 0x07, 0xB9, 0x5A, 0x71, 0x9E, 0xCF,
-    0x15, 0x6E, 0xB5, 0xBF, 0x0B, 0x4E, 0x07, 0x89, 0x32, 0x97, 0xF8, 0xE4, 0x32, 0x2A, 0x40, 0xDC,
-    0x9A, 0x6B, 0x9F, 0x32, 0xBA, 0xEE, 0x91, 0x24, 0x56, 0x43, 0xAB, 0x6F, 0xAF, 0x13, 0xEB, 0x58,
-    0x1C, 0x41, 0x03, 0xA8, 0x04, 0x85, 0x89, 0xA8, 0x36, 0xE5, 0x69, 0xA6, 0xE6, 0x84, 0xA8, 0xAD,
-    0x27, 0x8D, 0xFC, 0x50, 0x61, 0x9D, 0xC4, 0x98, 0xEF, 0xD2, 0xC7, 0x29, 0x51, 0x95, 0x50, 0xCA,
-    0x92, 0xE1, 0x14, 0x2F, 0xF6, 0xCA, 0x27, 0x06, 0x9C, 0xFC, 0xA6, 0x8C, 0xCD, 0x59, 0x5A, 0xCA,
-    0x9A, 0x3F, 0xFA, 0x64, 0x91, 0x45, 0x0A, 0xD0, 0x2E, 0xE3, 0xA4, 0x8F, 0x95, 0xC8, 0xA2, 0x6F,
-    0x94, 0x58, 0xDB, 0x63, 0xAD, 0xDD, 0x87, 0x77, 0x0B, 0xCE, 0x83, 0x1E, 0xF7, 0x91, 0x5E, 0xD6,
-    0x25, 0x80, 0x9B, 0xFE, 0xDE, 0x1C, 0xDC, 0xFB, 0x71, 0xE4, 0x37, 0xCA, 0x4E, 0x06, 0xE8, 0xF0,
-    0x74, 0x68, 0xA8, 0xB6, 0x5F, 0xC6, 0xBF, 0xAF, 0x3D, 0x1A, 0x62, 0xD3, 0x96, 0xBC, 0x28, 0x6F,
-    0x80, 0x0C, 0xA5, 0xA4, 0xA7, 0x90, 0xD0, 0x41, 0xE1, 0x74, 0x58, 0xD8, 0x04, 0x79, 0x88, 0x39,
-    0x6E, 0xAD, 0xB6, 0x01, 0x50, 0x75, 0xA0, 0x09, 0x2E, 0x70, 0x79, 0x11, 0x9A, 0x55, 0xF1, 0x1F,
-    0x75, 0x3D, 0x18, 0xE7, 0x67, 0xEC, 0x5D, 0x4D, 0x2A, 0xC7, 0xC1, 0xBD, 0x07, 0x69, 0x5B, 0xA0,
-    0x64, 0x52, 0xCA, 0xE4, 0x90, 0xFA, 0x83, 0x43, 0xD1, 0x56, 0xD0, 0x04, 0xD8, 0xEA, 0x5F, 0xB0,
-    0x14, 0x9B, 0x0D, 0x95, 0xA1, 0xF8, 0xD5, 0x28, 0x7C, 0x2A, 0xDF, 0xE8, 0x39, 0x41, 0x0E, 0x7D,
-    0x96, 0x43, 0xD8, 0xF1, 0xDF, 0x30, 0x40, 0x3C, 0x4B, 0xE4, 0xC5, 0x41, 0x8A, 0xDA, 0x21, 0xC9,
-    0x8F, 0xC1, 0x3C, 0x01, 0xE3, 0xAA, 0x8A, 0x00, 0xCD, 0x7F, 0xBE, 0x9F, 0x7B, 0x5D, 0xB3, 0x29,
-    0x9B, 0x06, 0x48, 0x3E, 0x57, 0xA2, 0x80, 0xCF, 0x38, 0xD5, 0xB2, 0x9B, 0x58, 0x91, 0x9A, 0xFD,
-    0x92, 0xBA, 0xB1, 0xFF, 0x00, 0xCE, 0x77, 0x17, 0x91, 0x17, 0xF4, 0x01, 0xE0, 0xC3, 0x45, 0x47,
-    0xC1, 0x00, 0x46, 0x02, 0x5D, 0xC3, 0x19, 0x28, 0x4E, 0x19, 0xEC, 0x93, 0xBA, 0x7D, 0xD9, 0x18,
-    0x5D, 0xEB, 0x32, 0x24, 0x2B, 0xD0, 0x12, 0x99, 0xF6, 0xFE, 0xDF, 0x86, 0x37, 0xDF, 0x25, 0xFF,
-    0xC3, 0x6E, 0xB4, 0xF6, 0x25, 0x58, 0x1D, 0xC2, 0x65, 0x11, 0x71, 0xCB, 0x4C, 0x37, 0x30, 0xD2,
-    0xD7, 0xBC, 0xFE, 0x8A, 0x40, 0x68, 0xFA, 0x22, 0xB6, 0x5F, 0xD6, 0x9C, 0x31, 0x56, 0x85, 0x80,
-    0x0B, 0x2C, 0xDF, 0x69, 0xBC, 0x2E, 0xC8, 0xDE, 0x56, 0x15, 0x06, 0xC2, 0x3C, 0x60, 0x42, 0x83,
-    0xA4, 0x9C, 0x77, 0x93, 0xA4, 0x3D, 0x20, 0xA8, 0xAD, 0xDB, 0x57, 0xD9, 0x93, 0xD8, 0xC6, 0xC4,
-    0x90, 0x97, 0x72, 0x4A, 0xCC, 0xC9, 0x71, 0x9C, 0x80, 0x44, 0xD8, 0x20, 0x56, 0x25, 0x88, 0xDF,
-    0x80, 0xB8, 0x66, 0xE7, 0x77, 0x46, 0x18, 0xF9, 0x04, 0x9E, 0x2F, 0x70, 0xF8, 0xEA, 0x7E, 0x61,
-    0x9D, 0xA2, 0xC3, 0x56, 0xAC, 0xAB, 0x28, 0x65, 0x58, 0xD9, 0xB6, 0x85, 0x92, 0x3F, 0x67, 0x7A,
-    0xEF, 0x32, 0xB0, 0x36, 0x28, 0x7B, 0xCC, 0xBE, 0x23, 0xFC, 0x75, 0x4D, 0xA4, 0x30, 0xE6, 0x33,
-    0x8B, 0xCF, 0xAE, 0x2D, 0x39, 0x0D, 0x75, 0xC3, 0xD9, 0x85, 0x85, 0xEE, 0xC7, 0x24, 0x8D, 0x6F,
-    0x13, 0xBB, 0xE2, 0x60, 0x43, 0x30, 0x58, 0x21, 0x82, 0x10, 0x13, 0xE8, 0x5E, 0x89, 0x7F, 0xC2,
-    0x9C, 0xDA, 0xAA, 0x0E, 0x2C, 0x32, 0x05, 0x2F, 0x78, 0x16, 0xAB, 0xB7, 0xC7, 0xDA, 0x45, 0xDB,
-    0x9A, 0x30, 0xB5, 0x27, 0x00, 0x69, 0x83, 0x3B, 0x7A, 0x77, 0xBF, 0x2C, 0x68, 0xCC, 0xCE, 0xEC,
-    0xE5, 0xE3, 0x9A, 0x37, 0x97, 0x86, 0x0B, 0x1C, 0x4A, 0xB7, 0x47, 0xA3, 0x8F, 0x5E, 0x5A, 0x12,
-    0x52, 0x21, 0xB8, 0xE6, 0xB8, 0xDF, 0x0D, 0xD7, 0xB2, 0x88, 0x20, 0xB5, 0x48, 0x6F, 0x1F, 0x49,
-    0xF6, 0x71, 0x99, 0x3D, 0x45, 0x04, 0x7B, 0xD0, 0x94, 0x8E, 0x79, 0xB4, 0x56, 0xA8, 0x6A, 0x66,
-    0x0A, 0x81, 0xC5, 0x16, 0x10, 0x5D, 0x66, 0x9C, 0x28, 0x81, 0x82, 0x33, 0x04, 0x3F, 0xB8, 0x39,
-    0x01, 0xAB, 0x15, 0x45, 0x9F, 0xCE, 0xD0, 0xA7, 0x87, 0x58, 0x90, 0x75, 0x86, 0x65, 0x87, 0x19,
-    0xC6, 0x85, 0x39, 0x3A, 0xD7, 0x34, 0xC3, 0xF6, 0xE3, 0x0C, 0x01, 0x30, 0xDE, 0xF9, 0xBB, 0xB6,
-    0x5D, 0x23, 0x0E, 0x83, 0x3C, 0x2C, 0xE9, 0xE2, 0x51, 0xB8, 0xA3, 0xB8, 0xAE, 0xB3, 0xCD, 0xD1,
-    0x96, 0x00, 0x12, 0x1D, 0x66, 0x2B, 0xED, 0xD8, 0xD0, 0x5B, 0xCD, 0x5B, 0xBB, 0xE7, 0x9E, 0x9E,
-    0xF5, 0xD0, 0x32, 0xCB, 0xEB, 0x10, 0x97, 0x00, 0xE0, 0xB4, 0x47, 0xF0, 0x62, 0x3A, 0x36, 0xBA,
-    0x9D, 0x6D, 0x1D, 0x5E, 0xE0, 0xD1, 0x2E, 0xF3, 0x89, 0x7D, 0xBC, 0x42, 0x27, 0x60, 0xE1, 0x3A,
-    0x99, 0x40, 0x4D, 0x9F, 0xD7, 0x7D, 0xF6, 0x5A, 0x17, 0xB9, 0x96, 0x7A, 0x16, 0xB0, 0x7C, 0xC2,
-    0x1F, 0x28, 0x41, 0xCA, 0x31, 0x16, 0x7A, 0x22, 0x3B, 0x1C, 0xF4, 0x93, 0xAA, 0x1F, 0x1D, 0xCD,
-    0x3E, 0xF6, 0xB7, 0x5A, 0x73, 0xBF, 0x51, 0xBF, 0x5D, 0x56, 0x85, 0x1E, 0xFC, 0x58, 0x9F, 0x70,
-    0xEF, 0x54, 0x7F, 0xCC, 0x7E, 0x15, 0xCC, 0xE5, 0xE3, 0x53, 0xC5, 0x74, 0x8B, 0x63, 0x81, 0x32,
-    0xB2, 0x83, 0x06, 0x59, 0xBC, 0xEC, 0x83, 0x85, 0x44, 0xBE, 0xE7, 0x14, 0x27, 0x45, 0xDE, 0x76,
-    0x93, 0x9F, 0xD9, 0x40, 0x7D, 0x88, 0xAB, 0xE3, 0x43, 0x79, 0x20, 0xEE, 0x68, 0x34, 0xBA, 0x7A,
-    0x30, 0x34, 0x71, 0xF1, 0x81, 0xAF, 0x5F, 0xF7, 0x21, 0xED, 0xAB, 0xC1, 0x9D, 0xC5, 0xDD, 0x21,
-    0x1D, 0x68, 0x2B, 0x98, 0xCA, 0x91, 0x25, 0xE6, 0x7D, 0xA6, 0x16, 0xF3, 0x97, 0x1D, 0x5E, 0x8B,
-    0x56, 0x1B, 0x70, 0xD9, 0xDA, 0xEF, 0x0A, 0x46, 0x26, 0x07, 0x38, 0x5F, 0x15, 0xBD, 0xB1, 0x50,
-    0x81, 0xAD, 0xB9, 0xD2, 0xFE, 0xD3, 0x83, 0x79, 0xB1, 0xF1, 0xB5, 0xFC, 0xFF, 0x05, 0x4C, 0x09,
-    0xB8, 0xF0, 0x18, 0x03, 0x51, 0x47, 0xD4, 0x81, 0x19, 0x57, 0xD8, 0xAC, 0x9E, 0xFE, 0x0A, 0xB1,
-    0xA1, 0x10, 0x88, 0x0E, 0x93, 0x33, 0x05, 0x8E, 0x7F, 0xF4, 0x10, 0xA1, 0x94, 0xF3, 0x7B, 0x44,
-    0xE2, 0x3E, 0x89, 0x2C, 0x08, 0xA1, 0x85, 0xCE, 0x1D, 0xE6, 0x1B, 0x3F, 0x5D, 0x1C, 0xC0, 0xF3,
-    0x53, 0x48, 0xA5, 0x20, 0x27, 0x40, 0xE8, 0xA5, 0x42, 0x8F, 0xE8, 0xB3, 0x6E, 0xB1, 0xC5, 0xD7,
-    0xCB, 0xAD, 0x8F, 0xCE, 0xDB, 0xDE, 0x3E, 0xC8, 0x6D, 0x6F, 0xBF, 0xEC, 0xB1, 0x59, 0xF3, 0xBA,
-    0xF1, 0x68, 0xF4, 0x31, 0xF1, 0x8F, 0xD9, 0xF1, 0x03, 0x9B, 0xD4, 0xC2, 0x11, 0x58, 0x86, 0xD3,
-    0x96, 0xEC, 0x0B, 0xAE, 0xD9, 0xA3, 0x6E, 0x72, 0x52, 0xBC, 0xBB, 0xD5, 0xA6, 0x5B, 0xC8, 0x00,
-    0x5E, 0x9B, 0xC1, 0xDA, 0xE8, 0xDE, 0x23, 0x36, 0x29, 0xD7, 0x15, 0xF3, 0xC5, 0x06, 0x49, 0x2F,
-    0xC4, 0x52, 0x1F, 0x31, 0x7E, 0xEF, 0xBA, 0xE8, 0xC1, 0x7C, 0x62, 0xE3, 0xAC, 0xB2, 0x5F, 0x35,
-    0xFD, 0x94, 0xE3, 0x56, 0x2E, 0x3B, 0xA1, 0xAF, 0x71, 0xDF, 0x4E, 0xCF, 0xB1, 0xFB, 0x0E, 0x29,
-    0x23, 0x3F, 0x6C, 0x4C, 0xE6, 0x21, 0x9C, 0xD3, 0x12, 0x49, 0xAA, 0x51, 0xA6, 0x0A, 0x16, 0xAD,
-    0x30, 0xC7, 0xCC, 0x26, 0xC2, 0x57, 0x89, 0x6C, 0xDA, 0xBA, 0xB9, 0x72, 0x88, 0xC6, 0x68, 0x2D,
-    0x56, 0x49, 0xE9, 0x87, 0xFF, 0x47, 0x5D, 0xD3, 0xAD, 0xD2, 0x12, 0xE8, 0xDA, 0xB7, 0x0D, 0xFB,
-    0x5C, 0xC5, 0x2C, 0x52, 0x25, 0xBF, 0x45, 0xF0, 0x5D, 0x6C, 0x3F, 0x13, 0x6D, 0xF1, 0xF4, 0xD8,
-    0x6E, 0xB0, 0x2D, 0x43, 0x54, 0xB4, 0xA7, 0xC6, 0x25, 0x32, 0xA8, 0x63, 0xBD, 0xC8, 0x9C, 0xF4,
-    0x52, 0xF2, 0x02, 0xF6, 0xF1, 0x6D, 0xF7, 0x29, 0x53, 0xB9, 0x14, 0x7C, 0x87, 0x25, 0xAF, 0xAC,
-    0x04, 0xCE, 0xEA, 0xCF, 0x41, 0xA7, 0xF9, 0x1D, 0xEB, 0x3E, 0xB5, 0xC5, 0x8D, 0xE1, 0x3E, 0x66,
-    0x27, 0x15, 0x77, 0x01, 0xBE, 0x6A, 0x1E, 0x97, 0xEB, 0xAD, 0xD3, 0x4C, 0x07, 0xA7, 0x75, 0xFC,
-    0x4E, 0xB9, 0x1E, 0x5D, 0xD0, 0x98, 0xDB, 0xAC, 0xB8, 0xE5, 0xBA, 0xFA, 0x47, 0x81, 0xC7, 0xCD,
-    0x16, 0x8F, 0xC1, 0x23, 0x3E, 0xAE, 0xB4, 0x92, 0x9C, 0x71, 0x16, 0x6C, 0x07, 0x7E, 0xD3, 0x26,
-    0xA9, 0x3E, 0xC8, 0x60, 0x8B, 0xA4, 0x36, 0x52, 0x27, 0x7D, 0x99, 0xD8, 0x62, 0xFE, 0x96, 0x19,
-    0x8D, 0xAE, 0x58, 0xD7, 0x8B, 0xD9, 0x6F, 0x09, 0x83, 0xD3, 0xB9, 0x9C, 0x04, 0x78, 0xAD, 0xCF,
-    0x40, 0x0C, 0x76, 0x8A, 0x0D, 0x26, 0x34, 0xB1, 0xF8, 0xF8, 0x3E, 0xF3, 0x9F, 0xC0, 0x1C, 0x9F,
-    0xE7, 0xD6, 0x5E, 0x0D, 0x5E, 0xB7, 0x50, 0x27, 0xD5, 0xDE, 0x5A, 0xC5, 0xFA, 0x87, 0xF5, 0x17,
-    0xF0, 0xCA, 0x51, 0x64, 0xC0, 0xCD, 0xC6, 0xD6, 0x57, 0xDF, 0x22, 0x1E, 0x4E, 0x43, 0x9D, 0x7A,
-    0xB2, 0x37, 0x32, 0x17, 0x61, 0x5C, 0x4E, 0x76, 0x0B, 0x7D, 0x70, 0xD0, 0xB1, 0x63, 0xD2, 0x47,
-    0x4E, 0x8D, 0xFE, 0xB7, 0x48, 0x1F, 0x6C, 0xA0, 0xF9, 0xA5, 0xBC, 0x71, 0x6F, 0xC4, 0x95, 0x3E,
-    0x23, 0x27, 0xB7, 0x09, 0x13, 0xB9, 0x06, 0xD3, 0x4B, 0xB0, 0x3B, 0x55, 0x44, 0x88, 0xFD, 0x14,
-    0x65, 0xC0, 0xC2, 0xB9, 0x33, 0x1C, 0x9E, 0x45, 0x73, 0x85, 0xA6, 0xBF, 0xFD, 0x1F, 0xAB, 0xFF,
-    0xFF, 0xFF, 0x7F, 0x3C, 0x10, 0x5F, 0x0C, 0x0D, 0x0D, 0x0D, 0x00, 0x00, 0x45, 0xCF, 0xBD, 0x09,
-    0x02, 0x41, 0x10, 0xC5, 0xF1, 0x07, 0x07, 0x1A, 0x88, 0x4C, 0x09, 0x96, 0x70, 0x89, 0xF9, 0x6C,
-    0x1F, 0x57, 0x8C, 0x96, 0x63, 0x17, 0xA7, 0x9D, 0x5C, 0x60, 0x01, 0x17, 0x6C, 0x60, 0x32, 0x3C,
-    0xE7, 0x63, 0xD1, 0x4D, 0x7E, 0xFC, 0xE1, 0x31, 0xB0, 0xC0, 0xEF, 0x9D, 0x87, 0x56, 0xC8, 0x90,
-    0xA5, 0x0C, 0x59, 0xCA, 0xFB, 0x90, 0x7E, 0x6A, 0x2F, 0x5B, 0xC9, 0xD7, 0x63, 0xB2, 0x18, 0xAF,
-    0xFD, 0x64, 0x31, 0xE6, 0x36, 0x9B, 0x27, 0x19, 0x77, 0x9C, 0xFD, 0x48, 0xCB, 0xBC, 0xD1, 0x34,
-    0x93, 0xDD, 0xBD, 0xAF, 0x64, 0x53, 0xDA, 0xE4, 0x09, 0x65, 0xBF, 0x78, 0xBA, 0x8C, 0x2C, 0x5B,
-    0xB8, 0x44, 0x42, 0x77, 0x89, 0x84, 0x3E, 0xE7, 0x48, 0x28, 0x32, 0xA1, 0x4B, 0xA6, 0xEF, 0x5A,
-    0x59, 0x09, 0xAD, 0xC4, 0xF5, 0xFF, 0x57, 0x7C, 0x01,
+static const uint8_t notosans_16_regularBitmaps[31935] = {
+    0xCD, 0x9B, 0x3F, 0x8C, 0x1D, 0x47, 0x9E, 0xDF, 0x3F, 0xD5, 0x45, 0xB2, 0x81, 0x6B, 0xD8, 0xC5,
+    0x40, 0xB4, 0x0F, 0x4B, 0x78, 0xDB, 0xC1, 0x26, 0xD6, 0x61, 0xD5, 0xE9, 0x05, 0x9A, 0x57, 0xAD,
+    0x5B, 0xEC, 0x39, 0xB8, 0x80, 0x34, 0x20, 0x6A, 0x03, 0x06, 0x8A, 0x4F, 0x86, 0x31, 0x89, 0x83,
+    0x0B, 0x66, 0x5E, 0xB7, 0x24, 0x18, 0x0B, 0x78, 0x03, 0xCD, 0xC1, 0x96, 0x61, 0xC0, 0xC1, 0xEA,
+    0x00, 0x1D, 0x20, 0x3D, 0xC2, 0xE0, 0x06, 0x1B, 0xC8, 0xC0, 0x7B, 0xD3, 0xB5, 0x22, 0x60, 0x06,
+    0x0A, 0xD8, 0x5E, 0x7A, 0xA1, 0x40, 0x81, 0x7A, 0x4F, 0xA2, 0x17, 0x2B, 0x07, 0x2A, 0xAC, 0x9A,
+    0xCB, 0x1A, 0xAA, 0xBA, 0x7F, 0x0E, 0xBA, 0xDF, 0xCC, 0x90, 0x92, 0x56, 0xE2, 0x1E, 0x65, 0xA9,
+    0xDF, 0xAB, 0xEA, 0x7A, 0xD5, 0x7F, 0xEA, 0xDF, 0xEF, 0xEF, 0xF7, 0x57, 0xCF, 0x9A, 0x1B, 0x3E,
+    0xDA, 0x6D, 0x16, 0x9E, 0xCA, 0x5E, 0xEA, 0xDE, 0xFA, 0xBE, 0x02, 0x6C, 0xF1, 0xDE, 0x51, 0x3C,
+    0xC3, 0x3A, 0x7B, 0xCF, 0x6D, 0xD6, 0xD9, 0x7B, 0x6E, 0x6F, 0x9D, 0xDE, 0x74, 0x7B, 0x7B, 0xFA,
+    0xA6, 0x7B, 0xFA, 0xCF, 0x75, 0x0D, 0x3F, 0x57, 0x1D, 0xEC, 0x10, 0xC0, 0xB0, 0x03, 0xA9, 0x33,
+    0x90, 0xF8, 0xD4, 0xC1, 0x5B, 0x89, 0x87, 0x1D, 0xDE, 0xE2, 0xC9, 0xEB, 0x1F, 0x35, 0x6F, 0x1A,
+    0x11, 0x91, 0x17, 0x9F, 0xBB, 0x7B, 0xF5, 0x57, 0x97, 0xB7, 0x57, 0x02, 0x98, 0xF2, 0x81, 0x67,
+    0x44, 0x44, 0x82, 0x15, 0x91, 0x71, 0xBA, 0xA2, 0x9D, 0x01, 0xE5, 0x53, 0x07, 0xEB, 0xC4, 0xC3,
+    0x82, 0xB7, 0x38, 0xBE, 0x52, 0x82, 0x02, 0xB2, 0x7A, 0x4A, 0x17, 0x0F, 0x48, 0x45, 0xDA, 0x5C,
+    0xC4, 0x57, 0xFF, 0xED, 0xBF, 0xF8, 0x4D, 0x56, 0x13, 0xE7, 0x34, 0x64, 0x35, 0xD5, 0x4F, 0x6A,
+    0x0A, 0xA9, 0x49, 0x25, 0x40, 0x25, 0x35, 0x99, 0x78, 0xB2, 0x1F, 0x07, 0xB2, 0x3A, 0x92, 0xD5,
+    0x6B, 0xB2, 0x3A, 0x96, 0xD9, 0x8B, 0x71, 0xBC, 0x7A, 0xBD, 0x17, 0x91, 0xB6, 0x92, 0x11, 0x2E,
+    0xD6, 0x27, 0xEF, 0xCF, 0x6A, 0xE6, 0xA3, 0xE8, 0xA0, 0xC7, 0x88, 0xA3, 0x20, 0xE9, 0x17, 0xE8,
+    0x96, 0x85, 0xF2, 0xAC, 0xD1, 0xAD, 0xC1, 0x94, 0xEC, 0xD1, 0x6B, 0x4F, 0xEA, 0x4C, 0xB9, 0x07,
+    0x7B, 0xF4, 0xA6, 0x26, 0x75, 0xE6, 0x19, 0x0F, 0x4F, 0xD3, 0x2F, 0xCE, 0x1D, 0xE8, 0x36, 0xCF,
+    0x6E, 0x88, 0x7B, 0x2A, 0xF1, 0xFD, 0x61, 0xA3, 0x8E, 0x36, 0x85, 0x29, 0xFB, 0x4C, 0x5E, 0xFE,
+    0x5F, 0xDE, 0xD4, 0x17, 0x0F, 0x62, 0xC1, 0x1A, 0xF2, 0xA4, 0x4B, 0x1D, 0xBA, 0x5B, 0xB0, 0x07,
+    0x7B, 0xBA, 0x4B, 0x1D, 0xA6, 0x7E, 0x8A, 0x3D, 0x12, 0x9F, 0xF8, 0xCC, 0xB1, 0x43, 0x4E, 0x20,
+    0x73, 0x84, 0xBC, 0xA4, 0x27, 0x95, 0x0E, 0x0B, 0x79, 0x00, 0xE0, 0x89, 0x6D, 0x47, 0x73, 0x29,
+    0x81, 0x46, 0x3A, 0x50, 0xE3, 0xD5, 0x1E, 0x74, 0xAF, 0x02, 0x68, 0x4F, 0x3C, 0xC9, 0x55, 0x00,
+    0x15, 0x74, 0x0F, 0x0C, 0x79, 0x07, 0xD8, 0xA6, 0x06, 0xF2, 0x01, 0xA0, 0xEA, 0x81, 0x44, 0x06,
+    0x74, 0x97, 0xF5, 0x55, 0x9D, 0xB6, 0xB9, 0xCB, 0x3B, 0xE3, 0x6C, 0x99, 0x06, 0xE3, 0x2C, 0x6A,
+    0xB4, 0xA5, 0x85, 0x4A, 0xB0, 0x90, 0x47, 0x2C, 0x64, 0x91, 0xC2, 0x61, 0x47, 0xCC, 0xD1, 0x8F,
+    0xA4, 0xAA, 0x53, 0x91, 0x60, 0x3A, 0x1A, 0xA9, 0x75, 0x44, 0x5D, 0x06, 0xD6, 0xEB, 0xF5, 0x7A,
+    0xBD, 0xB7, 0xB7, 0xF7, 0xE7, 0x2C, 0x58, 0xAB, 0xA0, 0x7D, 0xDA, 0x1A, 0x97, 0xD7, 0x45, 0x69,
+    0xB1, 0x2C, 0x59, 0xB2, 0x39, 0xF5, 0x59, 0xB2, 0xC4, 0x62, 0x29, 0x6A, 0xE3, 0x4C, 0x9B, 0x76,
+    0x89, 0x27, 0xB2, 0xCF, 0x99, 0x35, 0x96, 0xBC, 0x34, 0x2E, 0xED, 0xB4, 0x4F, 0x7A, 0x15, 0x88,
+    0xC4, 0xE3, 0x07, 0xB6, 0x9F, 0x0D, 0x03, 0x91, 0x98, 0x04, 0xED, 0x53, 0x9F, 0xB5, 0xA6, 0xB6,
+    0xEC, 0x73, 0x1E, 0x54, 0x09, 0x69, 0x37, 0x25, 0xDD, 0x82, 0x6E, 0xF9, 0x9E, 0x76, 0x67, 0xAB,
+    0xFF, 0xF4, 0x3F, 0xC7, 0x46, 0x44, 0xBE, 0xD3, 0x8C, 0x7F, 0x8F, 0xE9, 0xC1, 0xAE, 0x61, 0x63,
+    0x51, 0xB1, 0xA8, 0x75, 0x6F, 0xDA, 0xC4, 0x67, 0x8E, 0xF3, 0x0A, 0x92, 0x0E, 0x78, 0x0B, 0x78,
+    0x6A, 0x26, 0xBF, 0x53, 0x15, 0x4A, 0x44, 0x86, 0x4A, 0x44, 0x7E, 0x78, 0x65, 0xB8, 0x52, 0x7E,
+    0xDE, 0x1D, 0x33, 0x25, 0x95, 0x60, 0xDA, 0x98, 0xBF, 0xDD, 0x5B, 0xDD, 0xED, 0xA4, 0xEE, 0x3C,
+    0x50, 0xC8, 0x7B, 0x72, 0xF7, 0xCA, 0xB3, 0x98, 0x77, 0x7E, 0x3F, 0x56, 0x6A, 0xBA, 0x39, 0xAF,
+    0xC9, 0x1C, 0xDA, 0xA3, 0x7A, 0x88, 0xB0, 0x80, 0xA2, 0xC4, 0x38, 0xD2, 0x8E, 0xC4, 0x43, 0x84,
+    0x7D, 0xB0, 0x60, 0x6A, 0xB2, 0x16, 0xED, 0x51, 0x01, 0x36, 0x60, 0x1F, 0x7A, 0x16, 0x80, 0x4C,
+    0x6A, 0x72, 0x89, 0x98, 0xBB, 0x95, 0x33, 0x5D, 0x12, 0xB4, 0xC7, 0x26, 0x3D, 0x69, 0x17, 0x21,
+    0x5A, 0xB0, 0xC6, 0x91, 0xDD, 0xEC, 0x48, 0xEE, 0x06, 0xD8, 0x2C, 0xA1, 0x78, 0xBE, 0x26, 0x7B,
+    0x77, 0x5B, 0xB1, 0x80, 0xE2, 0x92, 0xC3, 0xDC, 0xF0, 0x68, 0xBF, 0x41, 0x05, 0x53, 0xB3, 0xD1,
+    0x3D, 0x15, 0xF6, 0x6F, 0x9B, 0x32, 0x15, 0x29, 0x29, 0xA4, 0x84, 0x67, 0x81, 0xA4, 0x53, 0x42,
+    0xE3, 0xAD, 0x98, 0x0F, 0x3E, 0x09, 0xF6, 0x9F, 0x68, 0x8F, 0xE5, 0xAB, 0x66, 0x13, 0xED, 0xD6,
+    0x34, 0x32, 0x20, 0x77, 0x9A, 0x36, 0x2F, 0x93, 0xA8, 0xC0, 0x02, 0x59, 0x0B, 0x49, 0x0F, 0x6C,
+    0x98, 0x2A, 0xF2, 0x1A, 0x8C, 0x83, 0xAC, 0x83, 0xCC, 0x43, 0xFA, 0x65, 0x69, 0x5C, 0xAD, 0xFE,
+    0x6E, 0xBB, 0x48, 0x25, 0x00, 0xBB, 0x52, 0x2B, 0x91, 0x11, 0x79, 0xB5, 0x69, 0x9F, 0x22, 0x89,
+    0x80, 0x2D, 0x4F, 0x35, 0x15, 0x81, 0x0A, 0x68, 0x50, 0x2B, 0x01, 0x19, 0xC0, 0x4A, 0x00, 0xD5,
+    0x38, 0xD0, 0x61, 0xBE, 0x6A, 0x1C, 0x68, 0xBF, 0xBD, 0xFD, 0x09, 0xA8, 0xFE, 0xEA, 0x43, 0xD5,
+    0xBC, 0x2D, 0x22, 0x75, 0x2E, 0x63, 0xC9, 0xD9, 0xCB, 0x00, 0x2A, 0x02, 0xC6, 0x03, 0xE2, 0x20,
+    0x13, 0x60, 0x27, 0x82, 0xFE, 0xC4, 0x43, 0x61, 0x1C, 0x2A, 0x58, 0x30, 0x2E, 0xC2, 0x5A, 0x7B,
+    0xD2, 0xD6, 0x38, 0x16, 0xD3, 0xB4, 0x44, 0xF2, 0x52, 0x7B, 0x02, 0xC6, 0x19, 0x87, 0xA5, 0x12,
+    0x91, 0xBB, 0x22, 0x22, 0xBF, 0x5C, 0xAD, 0xAE, 0x7F, 0x34, 0xCF, 0x06, 0x91, 0xB9, 0x17, 0xC6,
+    0x01, 0x96, 0x5C, 0xA4, 0x2D, 0x44, 0xBA, 0x42, 0xA4, 0x2D, 0xE6, 0x9B, 0xB6, 0x69, 0xB1, 0x4D,
+    0x2F, 0x1C, 0x50, 0xC9, 0x88, 0x15, 0x69, 0xCF, 0x90, 0xFB, 0x69, 0x50, 0x2A, 0xCE, 0xAF, 0x3B,
+    0x95, 0x92, 0x50, 0x92, 0xFA, 0xA3, 0x67, 0xAA, 0x56, 0x44, 0xCA, 0x42, 0x02, 0x5C, 0xD8, 0x0A,
+    0x9B, 0x6A, 0x44, 0x89, 0xD4, 0x89, 0xBC, 0x7A, 0x39, 0x19, 0xE6, 0x47, 0x8E, 0x17, 0xA9, 0x84,
+    0xCC, 0x81, 0xF6, 0xBB, 0x1F, 0x12, 0x1B, 0x71, 0xF6, 0xF0, 0x6A, 0x34, 0x01, 0xFB, 0x72, 0x40,
+    0xFB, 0x08, 0x1B, 0x0B, 0xF9, 0x25, 0x47, 0x7A, 0xDB, 0xA3, 0xFA, 0x0D, 0x6C, 0x8C, 0xC3, 0x26,
+    0x81, 0xA2, 0xB6, 0x6D, 0xE5, 0xB4, 0x88, 0xA3, 0x90, 0x1A, 0x9E, 0x80, 0x4A, 0x44, 0x76, 0x45,
+    0xE4, 0x5D, 0x11, 0xD9, 0x2E, 0xCF, 0xF2, 0x21, 0x6A, 0x48, 0x3B, 0xD0, 0xFD, 0x43, 0xBD, 0x28,
+    0xCA, 0x13, 0x52, 0xD1, 0x1E, 0x54, 0x38, 0xB5, 0xB8, 0xB6, 0x84, 0xDC, 0x81, 0x69, 0xE7, 0x09,
+    0x04, 0xB8, 0x28, 0x07, 0x14, 0x32, 0x52, 0xDC, 0xD9, 0xED, 0x8C, 0x63, 0x48, 0x5B, 0xF2, 0x97,
+    0x7A, 0xD2, 0x6E, 0x83, 0x0A, 0x79, 0xCD, 0x46, 0x07, 0x96, 0xD8, 0xB6, 0x41, 0xCB, 0x08, 0x76,
+    0x04, 0x2B, 0x9E, 0xEA, 0x45, 0x29, 0x2B, 0xD2, 0xDE, 0x42, 0x65, 0xEA, 0x53, 0x1C, 0x65, 0xC1,
+    0x9A, 0x96, 0xFC, 0x17, 0x23, 0xBB, 0x6D, 0x2E, 0xD2, 0xD2, 0x48, 0x3D, 0xF1, 0xCB, 0xD4, 0x5C,
+    0x49, 0x21, 0x91, 0xE2, 0x4E, 0xE3, 0x72, 0x97, 0x04, 0xD3, 0x62, 0xB5, 0x47, 0x77, 0x01, 0xE2,
+    0x12, 0x8A, 0xBC, 0x26, 0xBB, 0xD1, 0xA1, 0xFB, 0x88, 0x1A, 0x8A, 0x5A, 0xC9, 0x0F, 0x86, 0x73,
+    0xE2, 0xAC, 0xFC, 0xCE, 0x27, 0xD2, 0xC5, 0x79, 0x98, 0xA6, 0x9E, 0x68, 0x57, 0xFB, 0x89, 0x7E,
+    0x93, 0x48, 0x79, 0x31, 0x52, 0x48, 0x20, 0x93, 0x0F, 0xA7, 0x15, 0x3B, 0x63, 0xDE, 0xF9, 0xFD,
+    0x60, 0x39, 0x7D, 0xC4, 0x66, 0xF7, 0x37, 0xFE, 0xBC, 0x52, 0xB1, 0xF8, 0xE5, 0x60, 0xDC, 0x03,
+    0x97, 0x50, 0x31, 0x7F, 0x3B, 0x58, 0xED, 0xF7, 0x33, 0x17, 0xCE, 0x1E, 0x57, 0xB6, 0x90, 0xF6,
+    0x90, 0x47, 0xA8, 0x3A, 0x94, 0xD4, 0xA4, 0xE3, 0xA4, 0x84, 0x6C, 0x0B, 0x79, 0x0B, 0x89, 0xD4,
+    0x90, 0x4A, 0x09, 0xF9, 0x08, 0x14, 0x47, 0x40, 0xE3, 0x41, 0x0D, 0x40, 0x5A, 0x6E, 0xDF, 0x64,
+    0x44, 0xE4, 0x86, 0x88, 0x78, 0x1E, 0x3E, 0x56, 0xAB, 0xD5, 0x1B, 0x56, 0x44, 0x8C, 0x88, 0x38,
+    0x80, 0x7F, 0xC1, 0xD4, 0x28, 0x4D, 0x0B, 0x89, 0x94, 0x90, 0x0D, 0x40, 0xB1, 0xAD, 0x52, 0xC2,
+    0xD4, 0x74, 0xD3, 0x71, 0x4E, 0x4A, 0xF2, 0x01, 0x9A, 0x0F, 0xD1, 0x52, 0x4F, 0x8D, 0xFE, 0xFB,
+    0xD3, 0x6F, 0xDF, 0x95, 0xB2, 0x12, 0xD1, 0xF7, 0xAF, 0x86, 0xEF, 0x61, 0x1C, 0xEC, 0x83, 0xEE,
+    0x60, 0x39, 0xCD, 0x5F, 0x04, 0x5B, 0x92, 0xB7, 0xA4, 0x93, 0xE8, 0xB5, 0x93, 0xB6, 0xD8, 0x83,
+    0xD4, 0x9D, 0x52, 0xB2, 0xA4, 0x2D, 0xC8, 0xC4, 0xD4, 0xE3, 0xA4, 0x5C, 0x50, 0xD7, 0x5F, 0x07,
+    0xA8, 0x44, 0x6A, 0xD0, 0xF2, 0xEA, 0x6E, 0x80, 0xBC, 0x43, 0x8D, 0x13, 0xAD, 0x15, 0xB5, 0x0A,
+    0x40, 0xD6, 0x6A, 0xCF, 0x59, 0xB4, 0x4F, 0x5D, 0x22, 0x03, 0xBD, 0xA9, 0x8D, 0x8C, 0x84, 0x1C,
+    0x5B, 0x2E, 0x58, 0x17, 0xAC, 0x59, 0xB0, 0xB7, 0x20, 0xB0, 0x60, 0x6F, 0x47, 0xF5, 0xD3, 0xC9,
+    0xB3, 0xB3, 0x3D, 0xAD, 0x77, 0x54, 0xCF, 0x3E, 0x61, 0x87, 0xC0, 0x80, 0x5F, 0xB0, 0x49, 0x44,
+    0x77, 0x05, 0xF6, 0xE3, 0x5B, 0x1F, 0xBB, 0x1C, 0x33, 0x6A, 0xC1, 0xD4, 0x5C, 0xE6, 0x32, 0x69,
+    0x0B, 0xCC, 0x2C, 0xC1, 0x71, 0x3F, 0x8B, 0xA3, 0x1F, 0x5E, 0xAF, 0x21, 0x9D, 0x25, 0xE1, 0x9F,
+    0xC9, 0xEB, 0x6C, 0xE5, 0x88, 0x0E, 0x00, 0x8D, 0x03, 0xCC, 0x00, 0xA8, 0x7B, 0x1D, 0x60, 0x0B,
+    0x40, 0xFF, 0xBA, 0x67, 0x62, 0x50, 0x8C, 0xDB, 0x80, 0x0A, 0x69, 0x07, 0x05, 0x16, 0xB4, 0x4F,
+    0x7A, 0xD8, 0x60, 0x1C, 0xC6, 0x11, 0x51, 0x22, 0xD2, 0x51, 0x88, 0x08, 0xFA, 0xFE, 0xEA, 0x5A,
+    0xCF, 0x12, 0xF2, 0xDA, 0x38, 0x88, 0x2A, 0x42, 0xD6, 0x15, 0x25, 0x58, 0xED, 0x41, 0xF7, 0x4B,
+    0x20, 0x7F, 0xC5, 0x01, 0xB1, 0x91, 0xDF, 0x62, 0x45, 0x82, 0x11, 0x91, 0x1B, 0x9E, 0x2C, 0x44,
+    0x68, 0x2C, 0x98, 0x5B, 0x6E, 0x92, 0x94, 0x31, 0xC2, 0xA1, 0x85, 0xCA, 0xDC, 0xBF, 0x36, 0x6A,
+    0x91, 0x01, 0x11, 0xE9, 0x2D, 0x54, 0xAF, 0x38, 0xF4, 0x3D, 0x0F, 0x87, 0x11, 0x72, 0x81, 0x54,
+    0x1C, 0x89, 0x78, 0x18, 0x23, 0x88, 0x5D, 0x5D, 0x93, 0x4B, 0x22, 0xF2, 0x03, 0x91, 0xA3, 0x63,
+    0x95, 0x78, 0x44, 0x22, 0x22, 0x54, 0xF7, 0xAF, 0xF5, 0x7A, 0x40, 0xD5, 0xD6, 0x31, 0x29, 0x01,
+    0xD3, 0xCE, 0xB2, 0x21, 0x09, 0xDB, 0x5F, 0xB6, 0x7C, 0x40, 0xC6, 0x1E, 0x57, 0x1D, 0x6E, 0x45,
+    0xBB, 0xEE, 0xB7, 0xF2, 0x3D, 0xEF, 0x66, 0x53, 0x91, 0xE2, 0xE8, 0xCA, 0x9A, 0x42, 0xC4, 0x93,
+    0x89, 0xD4, 0x70, 0x05, 0x1A, 0xF9, 0x2D, 0x88, 0x48, 0x87, 0x88, 0x0C, 0x44, 0x12, 0x29, 0x23,
+    0x14, 0x6D, 0x84, 0xCC, 0x47, 0xD0, 0x7D, 0x84, 0x24, 0x44, 0x50, 0x31, 0x32, 0x8D, 0x78, 0xCA,
+    0x86, 0xE3, 0xEC, 0xB8, 0x4E, 0xC5, 0xED, 0xCD, 0xBA, 0x8F, 0x60, 0x7C, 0x84, 0xC2, 0x45, 0x94,
+    0x94, 0xE3, 0xAA, 0x19, 0xB6, 0x0D, 0x1D, 0x41, 0x23, 0xF2, 0xBE, 0xC8, 0x28, 0x22, 0xEF, 0x3B,
+    0x88, 0x93, 0x3C, 0x7C, 0xF0, 0x24, 0xAB, 0xD5, 0x2B, 0x22, 0x51, 0x44, 0x6E, 0x7D, 0xD1, 0x2D,
+    0x11, 0xCC, 0x47, 0xAB, 0x37, 0x45, 0xE4, 0x63, 0x91, 0xF1, 0x2B, 0xBC, 0x33, 0x82, 0xB9, 0xBF,
+    0x7A, 0x43, 0x44, 0x6E, 0x89, 0xC4, 0x2F, 0xBC, 0xE5, 0xE4, 0x34, 0x4B, 0x98, 0x46, 0x0E, 0xC8,
+    0x45, 0x06, 0xE4, 0xFE, 0xB5, 0xA8, 0x47, 0xF8, 0x9E, 0xE9, 0x99, 0xE4, 0x34, 0xB6, 0x9E, 0x57,
+    0x87, 0x43, 0x80, 0xE1, 0x38, 0x8B, 0xB0, 0x7A, 0x33, 0xA2, 0x44, 0x22, 0x4A, 0x64, 0x00, 0xAA,
+    0x43, 0xC0, 0x56, 0x80, 0xB5, 0x25, 0xD8, 0xC2, 0x81, 0x35, 0x1D, 0xD8, 0x34, 0x82, 0x4D, 0xE4,
+    0xCE, 0x73, 0x42, 0x25, 0x22, 0xA4, 0x22, 0x1F, 0xC2, 0xD9, 0xCB, 0xAC, 0x41, 0xDD, 0xF3, 0x90,
+    0xBD, 0xEF, 0xA0, 0xA8, 0x80, 0x4D, 0x84, 0xE4, 0x0B, 0xAB, 0xEE, 0xAF, 0x56, 0x4D, 0x25, 0x22,
+    0x83, 0x88, 0xC8, 0xA3, 0x3C, 0x78, 0x5C, 0xD5, 0xC8, 0x75, 0xF1, 0xD5, 0x81, 0x71, 0xDA, 0x13,
+    0xB1, 0x7C, 0x59, 0x61, 0xC8, 0x64, 0x14, 0x21, 0x73, 0xC4, 0x89, 0xDB, 0xFE, 0xC8, 0xAC, 0xF8,
+    0x0F, 0x57, 0x7D, 0x33, 0x66, 0x52, 0x9E, 0x85, 0xF5, 0xC4, 0x83, 0xA9, 0x8F, 0xA8, 0x68, 0x1C,
+    0xB6, 0x8C, 0x98, 0xD6, 0x38, 0xDD, 0x13, 0x19, 0x31, 0xAE, 0xA8, 0x89, 0x59, 0x87, 0x79, 0x3B,
+    0x42, 0xAC, 0xC0, 0x7C, 0x1C, 0x40, 0xA4, 0xC5, 0x84, 0x06, 0x46, 0x1D, 0x30, 0xCE, 0xB4, 0x44,
+    0x2A, 0x8C, 0x4B, 0x22, 0x11, 0xD3, 0x19, 0x47, 0x55, 0x46, 0x92, 0x68, 0xDC, 0x44, 0x9B, 0xF6,
+    0x15, 0x87, 0x1A, 0xD6, 0x5F, 0x4E, 0x06, 0x5F, 0xF1, 0x74, 0xFF, 0x84, 0x16, 0x6B, 0x50, 0x22,
+    0x0E, 0xB4, 0x48, 0x07, 0xA9, 0x88, 0x87, 0x4C, 0xC6, 0x1E, 0x4C, 0x13, 0x03, 0xE4, 0x36, 0x46,
+    0xB0, 0x36, 0xEE, 0xC3, 0x8E, 0x8D, 0x16, 0xD6, 0x36, 0x16, 0x10, 0x6C, 0xCC, 0x6B, 0xD5, 0xDB,
+    0x68, 0x5C, 0xE2, 0x6D, 0xCC, 0x5A, 0xDD, 0xD9, 0xA8, 0xBB, 0xCC, 0xD9, 0xA8, 0xBD, 0x71, 0x36,
+    0xAA, 0x3E, 0x2F, 0x6D, 0x24, 0x16, 0xD8, 0xC8, 0x7A, 0x81, 0x8D, 0x2C, 0xF7, 0xB1, 0x71, 0xFE,
+    0x16, 0x01, 0x1B, 0x31, 0xFE, 0x24, 0x4F, 0x5B, 0xEC, 0x21, 0xB0, 0x96, 0x1A, 0xD6, 0xE2, 0x60,
+    0x2D, 0x1E, 0xD6, 0xD2, 0xC3, 0x7A, 0x88, 0xB0, 0x8E, 0x0D, 0xAC, 0xA3, 0x2D, 0x59, 0xC7, 0xDC,
+    0xB1, 0x8E, 0x59, 0xC7, 0x3A, 0xEA, 0x9E, 0x75, 0x54, 0x91, 0x75, 0x64, 0x64, 0x1D, 0xB1, 0xE5,
+    0x3A, 0x52, 0xB8, 0x75, 0xC4, 0x74, 0xEB, 0x88, 0xF6, 0xEB, 0x48, 0x12, 0xD7, 0x11, 0x86, 0x75,
+    0x84, 0x6A, 0x1D, 0xA1, 0x88, 0x11, 0x4C, 0x8C, 0x90, 0xC6, 0x38, 0x4B, 0xAF, 0x49, 0xC1, 0x1D,
+    0x40, 0x25, 0xD2, 0x52, 0x8C, 0x57, 0xA5, 0x4E, 0x03, 0xC9, 0xC0, 0x08, 0xA9, 0x2F, 0x1C, 0x14,
+    0x2F, 0x7B, 0xA6, 0x55, 0xC4, 0xBC, 0xD7, 0x01, 0x87, 0x03, 0x90, 0x4A, 0x0B, 0xD8, 0x08, 0x68,
+    0x71, 0x80, 0x1D, 0x00, 0x2D, 0xED, 0x96, 0x8F, 0xB2, 0xDF, 0x78, 0x60, 0xB0, 0x80, 0xB9, 0x11,
+    0x20, 0x09, 0x79, 0x0B, 0x15, 0x4D, 0x4D, 0xDE, 0x25, 0xF2, 0xEA, 0x6E, 0x20, 0x13, 0x19, 0x21,
+    0x93, 0x11, 0xE0, 0x32, 0x34, 0xF2, 0x3A, 0x22, 0x52, 0x8B, 0x88, 0x8F, 0x64, 0x21, 0x92, 0xC4,
+    0x38, 0x49, 0xB1, 0xCD, 0x9C, 0x86, 0x08, 0x71, 0xAA, 0xCF, 0xBD, 0x88, 0xB4, 0x22, 0x23, 0xB2,
+    0x3A, 0xE0, 0x73, 0xCC, 0xD0, 0xCF, 0xA4, 0xFF, 0xAF, 0xC3, 0x8D, 0x7F, 0x78, 0xB8, 0xCF, 0x7B,
+    0xB6, 0xD2, 0x49, 0x8D, 0x00, 0x69, 0xD8, 0x82, 0x06, 0xB0, 0x2A, 0x1B, 0x79, 0x1D, 0x23, 0x12,
+    0x10, 0x11, 0x6F, 0x1C, 0x4D, 0x3D, 0xB3, 0x9A, 0x69, 0xE3, 0xA4, 0x55, 0xB3, 0x36, 0xC2, 0x60,
+    0x1C, 0xC6, 0x45, 0x74, 0x30, 0x77, 0x9E, 0x1B, 0x11, 0x91, 0xD2, 0x88, 0x38, 0x06, 0x06, 0x8C,
+    0x4B, 0x3D, 0x91, 0xA2, 0x36, 0x8E, 0x81, 0x48, 0xEA, 0x67, 0x4E, 0x55, 0xD1, 0x38, 0xB2, 0x2E,
+    0x82, 0xBD, 0xE4, 0xB6, 0x54, 0xB0, 0x2B, 0x07, 0x5A, 0x24, 0x9A, 0xF1, 0x5A, 0xC8, 0x1D, 0x4F,
+    0xD8, 0xF2, 0x94, 0x13, 0x50, 0x42, 0xE1, 0xC0, 0xF4, 0x90, 0x4A, 0x0D, 0x72, 0x34, 0x39, 0x5E,
+    0x34, 0x1E, 0xD2, 0x38, 0x4B, 0xD4, 0xC3, 0xD9, 0xC0, 0x5E, 0x02, 0x9B, 0xF3, 0xA8, 0x58, 0xBD,
+    0xFA, 0x7C, 0x5F, 0x89, 0xB4, 0x85, 0x8C, 0x70, 0xA1, 0xA4, 0x11, 0x91, 0xDF, 0x89, 0x88, 0xBC,
+    0x23, 0x22, 0xF2, 0x05, 0x9E, 0xC8, 0x63, 0xAD, 0xFA, 0x6A, 0x12, 0xF5, 0xD1, 0xAA, 0xCC, 0x3B,
+    0x1D, 0xD8, 0xDC, 0x91, 0x04, 0xEB, 0x28, 0x9C, 0xBD, 0x73, 0x75, 0xC0, 0x8A, 0xB4, 0xE4, 0x12,
+    0x80, 0x67, 0x61, 0x0D, 0x2C, 0x0F, 0x99, 0x8C, 0x0F, 0xA2, 0x2D, 0x51, 0x31, 0xAF, 0x49, 0x7A,
+    0xE3, 0xD0, 0xDE, 0xB4, 0xA4, 0x3E, 0xED, 0x26, 0xBB, 0xCE, 0xB8, 0xA4, 0x27, 0xAF, 0x55, 0xC4,
+    0x96, 0x44, 0x2C, 0x6C, 0x58, 0x42, 0xC5, 0x00, 0x96, 0x08, 0xC5, 0x4B, 0x01, 0xCC, 0x0D, 0x3F,
+    0x67, 0xE9, 0xBB, 0x2D, 0xE8, 0xFF, 0xEB, 0x66, 0x32, 0x54, 0x52, 0x02, 0x32, 0xAB, 0xB7, 0x25,
+    0x18, 0x47, 0x72, 0x37, 0x42, 0x53, 0x4E, 0xFE, 0xF7, 0x08, 0x36, 0x6B, 0x31, 0x71, 0xF2, 0x44,
+    0x96, 0x9E, 0xAC, 0xB5, 0x24, 0xF7, 0x3A, 0x2C, 0x11, 0x73, 0xCB, 0x11, 0x93, 0x9E, 0x65, 0x41,
+    0xDA, 0xA5, 0x5D, 0xE2, 0xF7, 0x29, 0x4A, 0xE3, 0x8C, 0x0B, 0x44, 0x2C, 0x0B, 0xED, 0xB5, 0x67,
+    0xA3, 0xFA, 0xAC, 0xCD, 0x6B, 0x15, 0x8C, 0x33, 0xF5, 0x06, 0xED, 0x2D, 0x56, 0x7B, 0xCC, 0x2F,
+    0x7A, 0xD6, 0xC6, 0x51, 0xFC, 0x95, 0x53, 0x61, 0x1F, 0x96, 0x16, 0xFD, 0x3B, 0x0F, 0x31, 0x90,
+    0xDD, 0x72, 0xE8, 0x7B, 0x2D, 0xF9, 0x12, 0xD2, 0x8F, 0x61, 0xD1, 0x83, 0x89, 0x93, 0x2F, 0x6B,
+    0x5B, 0x12, 0x01, 0x9A, 0x13, 0xF7, 0xD1, 0xB4, 0x58, 0x50, 0x7D, 0x31, 0xCF, 0x8E, 0x69, 0xB5,
+    0x27, 0xAF, 0x93, 0x80, 0x85, 0x81, 0x0D, 0x54, 0x2A, 0xCC, 0x8C, 0x69, 0xDE, 0x69, 0x27, 0x6B,
+    0x6D, 0x7A, 0x0B, 0x23, 0x73, 0x49, 0x4B, 0x0D, 0xE6, 0x56, 0x0B, 0xF9, 0xCB, 0x1E, 0x6C, 0x12,
+    0x60, 0xC3, 0x80, 0x0A, 0x54, 0x68, 0x4F, 0x51, 0x67, 0x2D, 0xC6, 0xE5, 0x8E, 0xCC, 0x5B, 0xD0,
+    0xFD, 0x21, 0xA8, 0xB8, 0x01, 0x75, 0x14, 0xC1, 0xDC, 0xE8, 0xE1, 0x50, 0x7B, 0xB4, 0xCF, 0xBA,
+    0x89, 0x65, 0xE2, 0xF4, 0x88, 0xC5, 0xC2, 0xA1, 0xEE, 0x21, 0xE6, 0x0E, 0x15, 0x06, 0xD0, 0x9F,
+    0x76, 0x90, 0x0A, 0x60, 0xC2, 0xB1, 0x99, 0xF1, 0x55, 0x49, 0xB2, 0x12, 0x91, 0xE7, 0x4F, 0xDC,
+    0xD2, 0x64, 0xEB, 0x42, 0x0F, 0xD3, 0x9C, 0x1C, 0x3B, 0x99, 0x85, 0x3B, 0x71, 0x34, 0xB7, 0x80,
+    0x85, 0x9E, 0xDC, 0xB4, 0x2F, 0x78, 0xE0, 0xA3, 0xD5, 0xEA, 0x9A, 0x4C, 0x16, 0x96, 0x54, 0x92,
+    0xCB, 0xCD, 0xFB, 0x7F, 0x17, 0x58, 0x92, 0xD7, 0x69, 0xA7, 0x1E, 0xA9, 0x20, 0xB1, 0x92, 0xB3,
+    0x57, 0xCA, 0x7D, 0x30, 0x35, 0xDA, 0xC3, 0xFE, 0x44, 0x57, 0xFE, 0x98, 0xC2, 0x7A, 0x58, 0x80,
+    0x71, 0xA8, 0x1E, 0x2C, 0x64, 0x0E, 0x15, 0xA6, 0x52, 0x0B, 0x53, 0x29, 0x9D, 0x7C, 0xA3, 0x62,
+    0xF2, 0xB2, 0xA3, 0x15, 0x23, 0xBF, 0xBC, 0xD6, 0xB3, 0xA1, 0x28, 0xB3, 0x36, 0x79, 0xB4, 0x82,
+    0x0C, 0x56, 0x7E, 0x78, 0xA5, 0x44, 0xBB, 0x79, 0xF0, 0x52, 0xC2, 0xD2, 0xC3, 0x62, 0x07, 0x4C,
+    0xE6, 0xC8, 0xEA, 0x1E, 0xDD, 0x16, 0x24, 0x5E, 0xB7, 0xF4, 0xAC, 0x59, 0x63, 0xCA, 0x1D, 0x12,
+    0x5F, 0xC0, 0x8E, 0xA9, 0xC9, 0x6E, 0x3A, 0xE8, 0x01, 0xAC, 0x88, 0x58, 0x11, 0x01, 0x78, 0x01,
+    0x5B, 0xE6, 0x2E, 0xED, 0x54, 0xCF, 0xDF, 0x00, 0x28, 0x19, 0xA8, 0x64, 0xE4, 0xE8, 0x2F, 0x07,
+    0x45, 0x32, 0x41, 0xA0, 0x18, 0x07, 0x96, 0x73, 0xD7, 0x62, 0x26, 0xE2, 0xE5, 0xEF, 0x9F, 0xBF,
+    0xD5, 0x61, 0x2B, 0x18, 0x02, 0xFA, 0x5E, 0x47, 0xFE, 0xBE, 0x43, 0x6C, 0x5D, 0xC4, 0x4A, 0xEE,
+    0xFA, 0x6A, 0x4C, 0xDD, 0xD9, 0x92, 0x0B, 0x0F, 0xC3, 0x3C, 0xF6, 0xE1, 0x8A, 0x45, 0x26, 0xA5,
+    0xF9, 0xA9, 0x44, 0x2D, 0xAF, 0x36, 0x4E, 0x4A, 0x1D, 0x6C, 0x4D, 0x65, 0x1C, 0xE6, 0xB6, 0x27,
+    0xE9, 0x23, 0x2C, 0xED, 0x6C, 0x61, 0x7D, 0xE0, 0x51, 0x61, 0x46, 0x3E, 0xEC, 0xA5, 0x0E, 0x73,
+    0x23, 0x62, 0x3A, 0xE9, 0x72, 0xBF, 0xD3, 0x88, 0x37, 0xA9, 0x74, 0x30, 0xBB, 0xDA, 0x4A, 0x8E,
+    0x94, 0x48, 0x67, 0xEF, 0xFC, 0x77, 0xD3, 0xA1, 0x22, 0x14, 0x25, 0xDA, 0x4F, 0x0E, 0xE9, 0x83,
+    0xA7, 0x7E, 0x22, 0xAD, 0x11, 0xD2, 0xE1, 0x6C, 0x97, 0xCB, 0x48, 0x21, 0xED, 0xF4, 0x9A, 0xB3,
+    0x4C, 0xEB, 0xA5, 0xC2, 0x2C, 0xC9, 0xF3, 0xFA, 0x81, 0x8A, 0x62, 0x30, 0x75, 0x23, 0x9F, 0x74,
+    0xD5, 0xAB, 0x55, 0xB0, 0x75, 0x32, 0xE6, 0x0E, 0xFB, 0x4A, 0x4B, 0xB6, 0xED, 0xE7, 0xB6, 0xE3,
+    0xFA, 0xA4, 0xA2, 0xA4, 0xF8, 0x49, 0x87, 0xE9, 0x06, 0xB2, 0x50, 0x74, 0x17, 0xC7, 0x44, 0xE4,
+    0x56, 0x9D, 0xCB, 0xCB, 0xDD, 0xB1, 0x73, 0x9C, 0xC9, 0x01, 0x46, 0x46, 0xCC, 0x87, 0xBB, 0x9D,
+    0x69, 0x89, 0x69, 0x47, 0xF1, 0x52, 0x3F, 0x41, 0x3E, 0xD1, 0xAE, 0x56, 0x8D, 0x11, 0x91, 0x1B,
+    0xF7, 0x57, 0xAB, 0xD7, 0x8E, 0x67, 0xB3, 0x9D, 0x09, 0xC1, 0xD6, 0x90, 0x0E, 0xCF, 0xFC, 0x3B,
+    0x2A, 0x91, 0x32, 0x11, 0x29, 0x51, 0x97, 0x41, 0x5D, 0x21, 0x95, 0x4E, 0x4B, 0xAF, 0x03, 0x44,
+    0x26, 0x7F, 0x92, 0xB4, 0xE3, 0xA2, 0xC4, 0x42, 0x44, 0xED, 0xBE, 0x5A, 0xA6, 0x1D, 0x2A, 0x9C,
+    0xBA, 0xF2, 0xA5, 0x3F, 0xE6, 0x9E, 0xFE, 0x45, 0x97, 0x4B, 0x0C, 0xF9, 0xDD, 0xDD, 0xD1, 0x74,
+    0xC8, 0x8F, 0x3D, 0xE6, 0x1F, 0xFA, 0xC9, 0xA9, 0x3A, 0x3D, 0x74, 0x42, 0x84, 0x85, 0x85, 0xFC,
+    0x95, 0x96, 0xF4, 0x1F, 0x02, 0x3A, 0xD8, 0x52, 0x8D, 0x59, 0x38, 0x27, 0x75, 0x23, 0xF7, 0xBA,
+    0x54, 0xBA, 0xC0, 0x59, 0x16, 0xF3, 0x04, 0x4F, 0x38, 0xCC, 0x13, 0xE8, 0x68, 0x7E, 0x7B, 0x35,
+    0x26, 0x22, 0x91, 0x8B, 0xF2, 0x21, 0x17, 0x1E, 0x42, 0xE2, 0x3E, 0x93, 0x32, 0xA9, 0x17, 0x95,
+    0xF4, 0xF6, 0xE8, 0x47, 0xD1, 0xB6, 0x0C, 0xB6, 0x66, 0x69, 0xC1, 0x3E, 0x6A, 0xFA, 0xD3, 0xFC,
+    0xA6, 0x0F, 0x00, 0xC1, 0x3E, 0x10, 0xDF, 0x99, 0x33, 0xF8, 0x53, 0x72, 0x97, 0x7A, 0xC2, 0xD6,
+    0x82, 0x0A, 0x5F, 0xC1, 0xEF, 0x38, 0x55, 0x58, 0x50, 0xFC, 0xC7, 0xDD, 0x1B, 0xD2, 0x35, 0x2D,
+    0x4F, 0x9C, 0x06, 0x14, 0x3F, 0x37, 0x25, 0x61, 0x41, 0xD6, 0x2D, 0x28, 0xEA, 0x05, 0x0D, 0x8B,
+    0x24, 0xB2, 0xC8, 0x3C, 0x8B, 0xDC, 0xB1, 0xA8, 0x60, 0x21, 0x25, 0x56, 0x1C, 0xF6, 0x27, 0x1E,
+    0xAB, 0x03, 0x0B, 0x06, 0x16, 0x54, 0x2C, 0x28, 0xDC, 0x02, 0xD3, 0x2D, 0xD0, 0xFD, 0x02, 0x15,
+    0x2F, 0xD8, 0x2F, 0x3A, 0xE6, 0x21, 0xF8, 0x62, 0xA0, 0x09, 0xFA, 0x5D, 0x19, 0x73, 0x89, 0x66,
+    0x7C, 0x6E, 0x3C, 0xBA, 0x1A, 0xAC, 0x4B, 0xA4, 0xD4, 0x7E, 0x44, 0x47, 0xB2, 0xDB, 0x1E, 0xD3,
+    0x52, 0x5C, 0x72, 0x58, 0xD8, 0xB7, 0x10, 0x51, 0x7D, 0x44, 0x7B, 0xD2, 0xDB, 0x1E, 0xE3, 0xC8,
+    0xFF, 0xB8, 0x4B, 0x25, 0xC0, 0xD3, 0x99, 0xD4, 0x3B, 0x27, 0x2B, 0x37, 0xFE, 0xB1, 0x2B, 0x07,
+    0x40, 0x22, 0x01, 0x25, 0xD2, 0x63, 0x7F, 0x55, 0xB5, 0xA6, 0xA3, 0x52, 0x91, 0x24, 0x14, 0x93,
+    0x05, 0x40, 0xB4, 0x60, 0x6E, 0xFB, 0x49, 0x84, 0x64, 0xB7, 0xFD, 0x64, 0xA4, 0x9A, 0xB7, 0x67,
+    0x8D, 0x56, 0xD4, 0x23, 0xA9, 0xD7, 0x47, 0xE7, 0x06, 0xF2, 0x09, 0x99, 0xAF, 0x8F, 0x25, 0x8A,
+    0xF9, 0x0B, 0xE9, 0xF4, 0xBB, 0x22, 0xC8, 0x9D, 0x5D, 0x6F, 0x5B, 0x46, 0xD3, 0x91, 0xDF, 0xF0,
+    0x13, 0x7C, 0xB0, 0x79, 0x58, 0x44, 0x2D, 0xED, 0x8C, 0xFB, 0xDF, 0x0E, 0xA4, 0x5E, 0xD0, 0xC1,
+    0x86, 0x34, 0x9A, 0xEB, 0x12, 0xF5, 0xAF, 0x25, 0x10, 0x55, 0xF9, 0x59, 0x41, 0xF8, 0x40, 0xC5,
+    0x83, 0x1C, 0x76, 0xE7, 0xF9, 0xD1, 0x74, 0x34, 0x3F, 0xF6, 0x98, 0x0F, 0x1E, 0xE2, 0xB0, 0x74,
+    0xCB, 0x61, 0xCB, 0x99, 0xC3, 0xB2, 0x99, 0xC3, 0x92, 0xD3, 0x1C, 0xF6, 0xEB, 0xC0, 0xD9, 0xCF,
+    0x13, 0x61, 0x0F, 0x55, 0x3C, 0x9D, 0xC5, 0x1D, 0x1B, 0x77, 0x0E, 0xFF, 0xAB, 0xF5, 0x58, 0x87,
+    0x2D, 0x99, 0x26, 0xF6, 0x0F, 0x7F, 0xA7, 0xD8, 0x43, 0x67, 0x44, 0x6E, 0x0C, 0x67, 0x7B, 0x3B,
+    0xBD, 0xCF, 0x82, 0x1E, 0x26, 0x24, 0xAC, 0x18, 0xA7, 0x94, 0x87, 0x49, 0xD6, 0x6E, 0x26, 0x85,
+    0xB8, 0xD9, 0x67, 0xF7, 0xA6, 0x88, 0x2F, 0x24, 0xA0, 0x2E, 0x83, 0x07, 0x8F, 0xF2, 0x68, 0x4F,
+    0x2E, 0xB1, 0x92, 0xF8, 0xCF, 0xEF, 0x3E, 0xAB, 0x3D, 0x5F, 0xF2, 0xED, 0x49, 0x06, 0x90, 0x81,
+    0x62, 0x40, 0x95, 0x4B, 0x58, 0x2C, 0xC1, 0x7E, 0xC5, 0x54, 0x2D, 0x27, 0x94, 0x4C, 0x6C, 0x99,
+    0x48, 0xD1, 0x5D, 0x14, 0x23, 0x62, 0x13, 0x09, 0x05, 0x67, 0x61, 0x03, 0xF9, 0x4F, 0x6B, 0xB2,
+    0xDB, 0xDB, 0xD0, 0x4D, 0x5E, 0x33, 0x68, 0x8F, 0x65, 0x43, 0x5E, 0x1B, 0x67, 0x9C, 0xF6, 0xDA,
+    0xB3, 0x4C, 0x7A, 0x8C, 0x8B, 0x24, 0x7E, 0x09, 0xCB, 0x62, 0x82, 0xDC, 0x92, 0x7B, 0x2D, 0x58,
+    0x3F, 0x59, 0x45, 0x6A, 0x80, 0x7D, 0x92, 0x48, 0xFA, 0x1B, 0x8F, 0x75, 0x6C, 0x2C, 0x7A, 0xC0,
+    0xBC, 0xDD, 0xD3, 0x78, 0x62, 0x5E, 0x9B, 0xEB, 0xE4, 0x75, 0xE4, 0x6E, 0x9F, 0xF4, 0xC6, 0xE5,
+    0xA6, 0xB6, 0x6C, 0xB4, 0x8F, 0xDA, 0xA7, 0xDD, 0x22, 0x6D, 0xF7, 0xB1, 0x69, 0xBB, 0xC8, 0x9C,
+    0xF6, 0x6B, 0xED, 0x23, 0xC5, 0xA5, 0xBA, 0x30, 0x35, 0x47, 0x3D, 0x77, 0x7B, 0xCC, 0xC7, 0x98,
+    0xEB, 0x70, 0xD8, 0xD1, 0x78, 0xD2, 0x81, 0x74, 0x04, 0xEB, 0xB0, 0x2D, 0x3A, 0x90, 0x44, 0x8A,
+    0x92, 0xA2, 0x8C, 0x64, 0xDD, 0xEC, 0xFC, 0xD8, 0x92, 0x98, 0x75, 0xA4, 0x3E, 0x42, 0xD1, 0x00,
+    0xD2, 0x81, 0x8E, 0x40, 0xE5, 0xC0, 0x8C, 0xA0, 0x7F, 0xDF, 0xC3, 0xA1, 0x71, 0x18, 0x57, 0xA1,
+    0xFB, 0x24, 0x70, 0x88, 0x69, 0x73, 0x47, 0xA5, 0x7B, 0x92, 0xF0, 0x99, 0x29, 0x31, 0x8E, 0x8D,
+    0xF6, 0x58, 0x96, 0xF3, 0x94, 0x24, 0xBD, 0xF6, 0x2C, 0xE6, 0x29, 0x51, 0xFD, 0x02, 0x6C, 0x51,
+    0x92, 0xDD, 0x72, 0xF0, 0x69, 0x37, 0x4D, 0xC9, 0xB1, 0x93, 0x64, 0x1F, 0x90, 0xF8, 0xA0, 0x7B,
+    0xD4, 0xD5, 0x00, 0x4D, 0x9C, 0xD1, 0x69, 0x2B, 0x72, 0x43, 0x24, 0x5E, 0xB8, 0xB2, 0xEB, 0xD0,
+    0x3D, 0x1C, 0x42, 0xEE, 0xD0, 0x7E, 0x5A, 0x9B, 0xA9, 0x34, 0x40, 0x5E, 0x6F, 0x4B, 0x45, 0x4D,
+    0x7A, 0xF7, 0xCA, 0xB3, 0x8D, 0xC8, 0x7B, 0x22, 0x03, 0xFC, 0x35, 0x7A, 0xC4, 0x1C, 0x51, 0xD4,
+    0x5F, 0x48, 0xBC, 0x1B, 0xFE, 0x2C, 0x60, 0x6B, 0x6C, 0x8F, 0x1A, 0x60, 0xF9, 0x45, 0x64, 0x5E,
+    0x92, 0x7F, 0x48, 0x36, 0x4E, 0x0E, 0xEA, 0x13, 0x3B, 0x5F, 0x76, 0xF0, 0x06, 0x7A, 0x24, 0x13,
+    0x26, 0xB3, 0x5B, 0x77, 0x98, 0x9A, 0x05, 0x6C, 0x8B, 0x16, 0x06, 0x90, 0x03, 0xAA, 0x3A, 0x1D,
+    0x69, 0x4A, 0xED, 0x1F, 0xBA, 0x61, 0x81, 0x0A, 0x64, 0xAD, 0x12, 0x6C, 0xCF, 0x38, 0xA1, 0xE6,
+    0x47, 0x70, 0x49, 0x8E, 0x92, 0x77, 0xFF, 0x8F, 0xC8, 0xDD, 0x3A, 0x91, 0x1E, 0xD4, 0x65, 0x38,
+    0x43, 0x49, 0x48, 0x5B, 0xE3, 0x2A, 0x36, 0xDA, 0x67, 0x9D, 0x65, 0xA9, 0xFB, 0xD4, 0x17, 0x75,
+    0x51, 0x0F, 0xD8, 0x32, 0x62, 0x9F, 0x89, 0x58, 0x15, 0xA8, 0x92, 0xC0, 0x52, 0xF7, 0xFC, 0x4C,
+    0xD7, 0x00, 0x67, 0x28, 0x55, 0x6F, 0x9C, 0xF6, 0xB9, 0xD3, 0x3E, 0xAF, 0x53, 0x5F, 0xD4, 0x69,
+    0x67, 0xCB, 0xAC, 0xB3, 0xE4, 0x6E, 0x43, 0x4C, 0x3B, 0xD3, 0x9E, 0xBC, 0x32, 0xE9, 0xF9, 0x59,
+    0x3A, 0xC7, 0xF3, 0xCF, 0x1D, 0xB0, 0x45, 0x71, 0x55, 0x64, 0xB6, 0x92, 0x98, 0xC5, 0xF9, 0xDF,
+    0x3C, 0x14, 0x8F, 0xF8, 0xE6, 0xB1, 0x71, 0xE0, 0x4D, 0x98, 0xDC, 0x88, 0x59, 0xBA, 0x0E, 0xCC,
+    0xC1, 0x2D, 0xB4, 0xFB, 0x16, 0xF6, 0xF7, 0x49, 0x80, 0x2C, 0x00, 0x4A, 0x3A, 0x60, 0x59, 0x94,
+    0x60, 0xEA, 0x0D, 0x24, 0xAD, 0xF2, 0xDF, 0xBA, 0xFE, 0x2A, 0xCE, 0x03, 0x31, 0x73, 0x60, 0xDC,
+    0x00, 0xBC, 0x95, 0xD6, 0x7C, 0xF6, 0xD0, 0x27, 0x30, 0x4F, 0x16, 0x01, 0xA4, 0x05, 0xF2, 0x25,
+    0x4C, 0xDE, 0x32, 0x8B, 0xBC, 0x64, 0xC2, 0x72, 0x88, 0x59, 0x0B, 0x79, 0xBD, 0x84, 0xC4, 0x4F,
+    0xA6, 0x7A, 0x51, 0x92, 0xB5, 0x44, 0x26, 0x0C, 0x36, 0x17, 0x19, 0x49, 0x44, 0xC4, 0x63, 0x57,
+    0xAB, 0x66, 0x36, 0x61, 0x23, 0x93, 0x5B, 0xCB, 0x61, 0xD2, 0x83, 0xF6, 0x16, 0xB0, 0xFF, 0xBA,
+    0x63, 0x52, 0xCA, 0xC7, 0x30, 0xF9, 0x37, 0x10, 0xC0, 0xF8, 0x1F, 0x5B, 0x52, 0xCB, 0xBB, 0x2D,
+    0xBF, 0x64, 0xF5, 0x6C, 0xE7, 0x89, 0x07, 0x3D, 0x42, 0xF2, 0xFA, 0x44, 0xA3, 0xC3, 0x89, 0xB3,
+    0xF5, 0xFD, 0xED, 0xDC, 0x7D, 0x1D, 0x51, 0x08, 0x78, 0x01, 0x4C, 0x47, 0x12, 0xA0, 0x9A, 0x5C,
+    0xD8, 0xEE, 0x6B, 0x6D, 0xEF, 0x3B, 0x25, 0x7A, 0x00, 0xF1, 0x14, 0x97, 0x5C, 0xD6, 0x5A, 0xD5,
+    0xF1, 0xD6, 0xD7, 0x3A, 0xBE, 0x33, 0xEC, 0xEB, 0x2E, 0xED, 0x2C, 0x4F, 0x27, 0xED, 0x09, 0x1D,
+    0x66, 0x53, 0xC8, 0xE1, 0x63, 0x91, 0xE1, 0x1F, 0x19, 0x7A, 0x19, 0x57, 0xAB, 0x9F, 0x4E, 0xBD,
+    0xEE, 0x5E, 0xC0, 0xB4, 0x2A, 0x92, 0xD7, 0xAA, 0xE7, 0xBB, 0xF3, 0x90, 0xFE, 0xA8, 0xE0, 0xC4,
+    0x9F, 0x1C, 0x24, 0x11, 0x5B, 0x9A, 0x56, 0xF5, 0xEC, 0x6C, 0x27, 0xE7, 0x27, 0x12, 0xD3, 0xA3,
+    0x47, 0xD8, 0x0E, 0xA2, 0x3D, 0xB6, 0x6C, 0xE4, 0x1D, 0x89, 0xBC, 0x41, 0x22, 0xA4, 0x52, 0x9B,
+    0x77, 0xDA, 0x45, 0xD2, 0xFF, 0x9C, 0xBD, 0x79, 0x47, 0x96, 0x74, 0x85, 0x78, 0x35, 0x96, 0x13,
+    0x4B, 0x3D, 0xF2, 0x77, 0xA0, 0x10, 0x5F, 0x88, 0x3F, 0xAF, 0x8C, 0x5B, 0xC7, 0xEC, 0xBD, 0x7A,
+    0xEF, 0x78, 0x76, 0x43, 0x23, 0xAE, 0x3A, 0x78, 0xA4, 0xED, 0x2B, 0xBA, 0xCF, 0x24, 0x36, 0xE2,
+    0x38, 0xCB, 0x59, 0xB0, 0xFE, 0x9F, 0x82, 0x8C, 0x1B, 0xF0, 0x55, 0x40, 0xB5, 0x93, 0xBE, 0x99,
+    0x8F, 0x6F, 0x2C, 0x3E, 0x90, 0xBC, 0x06, 0x60, 0xDD, 0xB1, 0xFE, 0x98, 0xE4, 0x99, 0xA9, 0xE1,
+    0x14, 0xA3, 0xCE, 0x1A, 0x52, 0x8E, 0x20, 0x15, 0x19, 0x48, 0xE4, 0x4E, 0x13, 0xA8, 0x6A, 0x8A,
+    0xD6, 0x74, 0x50, 0x25, 0x11, 0x92, 0x60, 0x01, 0x73, 0xD3, 0x03, 0xC3, 0x21, 0x90, 0x7D, 0xDC,
+    0x02, 0xD5, 0x70, 0x82, 0xA8, 0xC7, 0x63, 0x44, 0xDD, 0x0E, 0x40, 0xFA, 0x69, 0x07, 0x1C, 0x56,
+    0xCC, 0xFE, 0x0B, 0xD1, 0xD6, 0x50, 0xBC, 0x38, 0x40, 0xEA, 0xB3, 0x80, 0x1A, 0x29, 0x8E, 0x9E,
+    0x93, 0x9A, 0x46, 0xA4, 0x9B, 0xF7, 0xAF, 0x6D, 0x3D, 0x97, 0x17, 0xD8, 0x8A, 0xAD, 0x24, 0x30,
+    0x5B, 0xFD, 0x53, 0xAF, 0x93, 0xEE, 0x5B, 0xDB, 0xEB, 0xEF, 0x94, 0xCC, 0xA6, 0x29, 0xE2, 0x01,
+    0xFB, 0xBC, 0x83, 0xCC, 0x2D, 0x40, 0x75, 0xFC, 0xFC, 0x5B, 0x3B, 0xD7, 0x67, 0x80, 0x7D, 0xDD,
+    0x41, 0xD6, 0x2E, 0x81, 0xA7, 0x75, 0xFB, 0x39, 0x7A, 0xF0, 0xDB, 0x12, 0x62, 0xE2, 0xC9, 0x72,
+    0xC6, 0x4D, 0x27, 0x03, 0x33, 0x1E, 0x67, 0xA7, 0x27, 0xF8, 0x1B, 0x8A, 0x1B, 0xC0, 0xB9, 0xD7,
+    0x66, 0x6B, 0x61, 0x52, 0xC5, 0x5B, 0x53, 0xEE, 0x01, 0xD3, 0xE2, 0x9B, 0xEA, 0x9C, 0x7A, 0x9D,
+    0x29, 0x06, 0x84, 0xF8, 0x19, 0x49, 0xD8, 0x68, 0x4F, 0x5A, 0x9F, 0x66, 0xA9, 0x6F, 0xAA, 0x73,
+    0x67, 0x28, 0x51, 0xBD, 0xA9, 0x49, 0x3B, 0x0B, 0xE6, 0x21, 0x76, 0x99, 0x2C, 0xC6, 0xCD, 0x63,
+    0xEE, 0x9C, 0xFE, 0x5D, 0x98, 0xB9, 0xEC, 0xD0, 0x78, 0x32, 0x6F, 0x8E, 0x9E, 0x93, 0xD2, 0x88,
+    0xF4, 0xA4, 0x32, 0x32, 0xED, 0xA0, 0x7A, 0x73, 0xB2, 0x97, 0x92, 0x30, 0x6F, 0xB2, 0xF2, 0x0F,
+    0x48, 0xA0, 0x4A, 0xCA, 0x5C, 0xA4, 0x5E, 0xFC, 0x9B, 0xA6, 0x2C, 0x39, 0x9C, 0xA6, 0x6F, 0x32,
+    0x83, 0xD4, 0x4A, 0x12, 0x91, 0x68, 0x7F, 0xFB, 0xA3, 0x4F, 0x02, 0xE6, 0x7D, 0x87, 0x5D, 0xC2,
+    0x10, 0x48, 0xEF, 0x79, 0xEC, 0xAD, 0x2E, 0x93, 0x5C, 0x86, 0xBD, 0x5C, 0x5E, 0xF4, 0xEA, 0x32,
+    0xC0, 0x9F, 0xD4, 0x20, 0x53, 0x90, 0xC0, 0x4E, 0xAD, 0x7C, 0x97, 0xC7, 0xDE, 0x4A, 0xF2, 0x1A,
+    0xD8, 0x8E, 0x44, 0x5A, 0x8A, 0x57, 0x9C, 0xEA, 0x8D, 0x33, 0xE5, 0xC9, 0x76, 0xE7, 0xC7, 0xD5,
+    0xCA, 0x79, 0x85, 0xEE, 0x2C, 0xB9, 0x8B, 0x7C, 0xFF, 0x41, 0x61, 0x9D, 0x4B, 0x9B, 0x8A, 0x74,
+    0xE6, 0x3F, 0xEF, 0xB6, 0xE7, 0x29, 0xEA, 0x69, 0x51, 0xA7, 0x56, 0x5E, 0x68, 0x5C, 0x23, 0x62,
+    0xEE, 0x5F, 0x89, 0x23, 0xFA, 0x9E, 0xC7, 0xBC, 0x5F, 0x63, 0x97, 0xA8, 0x21, 0x62, 0x3E, 0x09,
+    0x89, 0xDC, 0x14, 0x79, 0x3E, 0x95, 0x6E, 0x6F, 0xBB, 0x87, 0xEE, 0x1F, 0x8B, 0x95, 0x3F, 0x35,
+    0x59, 0xB6, 0x55, 0x0D, 0xFB, 0xD3, 0x8A, 0x2E, 0xD0, 0xE2, 0xB0, 0x1D, 0xFC, 0xF5, 0x1C, 0x13,
+    0x4A, 0xE2, 0xEC, 0x6F, 0x25, 0x9E, 0x07, 0xD6, 0x83, 0x62, 0x2C, 0xB1, 0x12, 0xB0, 0x7F, 0xDB,
+    0xD4, 0xB6, 0xD4, 0x3E, 0xAF, 0x39, 0xCC, 0xDA, 0x79, 0xC3, 0xEC, 0xB8, 0x5A, 0x45, 0x2B, 0x22,
+    0xE6, 0xA3, 0xD5, 0xEA, 0xE5, 0x63, 0x9C, 0xAC, 0x9C, 0x16, 0x97, 0x11, 0xC8, 0xEF, 0x9E, 0xFD,
+    0xB9, 0x12, 0x19, 0xC8, 0x64, 0x80, 0xB3, 0xE5, 0xBC, 0xFE, 0xC7, 0x51, 0x22, 0x3F, 0x37, 0xE9,
+    0xBF, 0xCE, 0x26, 0x93, 0xD7, 0x20, 0x19, 0x21, 0x91, 0x16, 0x15, 0x06, 0x54, 0xC8, 0x5A, 0xFA,
+    0xAD, 0xA5, 0xF5, 0xB5, 0x34, 0x79, 0x5E, 0x81, 0x4D, 0xFC, 0x84, 0x3C, 0xB5, 0xDF, 0x7D, 0x88,
+    0xC3, 0x9B, 0x23, 0x10, 0xE9, 0x18, 0xFF, 0x72, 0x64, 0xC0, 0xB8, 0xE5, 0x84, 0x81, 0x5A, 0xE3,
+    0x30, 0x37, 0xEE, 0xAF, 0xAE, 0x79, 0x11, 0x89, 0x76, 0xB5, 0x5A, 0x1D, 0xE3, 0x8D, 0xC3, 0xBC,
+    0x50, 0xD3, 0xDE, 0xDC, 0xFF, 0xFD, 0xCF, 0xDA, 0x54, 0xA4, 0xA7, 0x90, 0x1E, 0x2E, 0xC0, 0x93,
+    0x65, 0xE1, 0xB2, 0x2E, 0xE9, 0x59, 0xCF, 0x86, 0xCE, 0xB4, 0x7B, 0xFC, 0x0F, 0x7F, 0xDE, 0xD0,
+    0x21, 0xF5, 0xC6, 0xD9, 0x19, 0x11, 0x58, 0x60, 0xBF, 0xF4, 0xC3, 0xBF, 0x02, 0x29, 0x13, 0x69,
+    0xB3, 0x0F, 0x7C, 0x5E, 0xC6, 0xA7, 0x79, 0x6A, 0x1E, 0xD0, 0x82, 0xAF, 0x84, 0x44, 0x3E, 0xF8,
+    0x3D, 0xC3, 0x0F, 0x3A, 0xBB, 0xD4, 0x9F, 0xB4, 0x4F, 0x1D, 0xEF, 0x9A, 0xAC, 0x1F, 0x61, 0x93,
+    0x0F, 0x4F, 0xF0, 0x2F, 0x95, 0xD4, 0x3F, 0xD3, 0x72, 0xDF, 0x67, 0xCF, 0x48, 0x9B, 0x4D, 0xFA,
+    0x92, 0xC7, 0x8A, 0x59, 0x3F, 0xC9, 0x69, 0xC7, 0xF3, 0x38, 0x4C, 0x7A, 0xDA, 0x5D, 0xA1, 0x90,
+    0x9A, 0x5C, 0xA4, 0xD4, 0xC3, 0x8F, 0x06, 0x46, 0x52, 0x9F, 0x3B, 0x8A, 0x97, 0xFA, 0x19, 0xCE,
+    0xBE, 0x31, 0xA3, 0xD8, 0xD9, 0x16, 0xD7, 0x36, 0xB7, 0x3D, 0xC4, 0xA2, 0xC4, 0xFC, 0x22, 0x92,
+    0x04, 0xD3, 0x51, 0x61, 0x0F, 0x76, 0x5B, 0x25, 0xD2, 0x93, 0x48, 0x98, 0x95, 0xFF, 0xA4, 0x5F,
+    0x47, 0xA0, 0x98, 0x21, 0x60, 0xC2, 0x43, 0xBC, 0xF9, 0x35, 0xB5, 0xAC, 0x5E, 0x67, 0xDA, 0xEF,
+    0x6A, 0x84, 0x29, 0x42, 0xBF, 0xD1, 0x9E, 0xEF, 0x92, 0x95, 0x5F, 0xFB, 0x98, 0x29, 0x49, 0xDB,
+    0x05, 0x1C, 0xA6, 0x1E, 0xED, 0x76, 0x1E, 0x62, 0x9B, 0xAF, 0x27, 0x78, 0xF0, 0xE6, 0x6C, 0x64,
+    0x15, 0x33, 0xD4, 0x99, 0xF8, 0x07, 0x2C, 0xAC, 0xC7, 0x09, 0x59, 0x4F, 0xC2, 0xCF, 0xD6, 0x13,
+    0x84, 0x31, 0x2B, 0x9D, 0x53, 0x06, 0xD3, 0x63, 0x6D, 0x2B, 0x39, 0x98, 0x4C, 0xA0, 0x62, 0x80,
+    0x43, 0x8B, 0xEA, 0x8D, 0xD3, 0xEE, 0x44, 0x4B, 0x3D, 0xD6, 0xB6, 0xCE, 0x2B, 0x08, 0xC6, 0xA9,
+    0x60, 0x1C, 0x7D, 0xF6, 0x00, 0xB8, 0xF4, 0x78, 0xE7, 0x6F, 0xAB, 0x5D, 0x45, 0xA4, 0x4B, 0x45,
+    0x44, 0xC4, 0x35, 0x47, 0xFF, 0x56, 0x44, 0xB2, 0x40, 0xD6, 0x82, 0xAD, 0x29, 0x4A, 0x92, 0x08,
+    0x9B, 0xE3, 0xF0, 0x7F, 0x05, 0x59, 0x4B, 0x12, 0xA6, 0xFF, 0x99, 0xB4, 0xDB, 0xFF, 0x92, 0x24,
+    0xE3, 0xEA, 0x8D, 0x08, 0xD9, 0xB4, 0xB7, 0xB1, 0x98, 0x90, 0x8D, 0x0D, 0xD8, 0x92, 0x64, 0x02,
+    0xB3, 0xB3, 0xF6, 0xB4, 0xBE, 0xDD, 0x4C, 0x60, 0x4C, 0x0F, 0x79, 0x4B, 0xD6, 0x42, 0xD1, 0x51,
+    0x94, 0x50, 0x1C, 0x3D, 0x27, 0xAB, 0x55, 0x5D, 0x88, 0x88, 0x08, 0x99, 0x88, 0x48, 0x84, 0x2B,
+    0xA7, 0xE7, 0x20, 0x93, 0x36, 0x91, 0x8E, 0x5C, 0x46, 0x2D, 0x52, 0x9A, 0x3B, 0xBB, 0x1F, 0x1C,
+    0x5D, 0xF4, 0xA6, 0xA5, 0xE9, 0xA9, 0xD2, 0x0E, 0x13, 0x30, 0xBF, 0xEC, 0x49, 0x86, 0x09, 0x07,
+    0xAB, 0xA6, 0x60, 0x91, 0xF9, 0x68, 0xD5, 0xDC, 0x72, 0x68, 0x11, 0xF9, 0xC4, 0xC3, 0xB8, 0x5A,
+    0xBD, 0x11, 0x8F, 0xE3, 0xA9, 0xF3, 0x76, 0x8B, 0xAC, 0x07, 0x15, 0xD0, 0x02, 0xD8, 0x32, 0x91,
+    0x0E, 0xF4, 0xD1, 0xB9, 0x28, 0xE5, 0x2E, 0x95, 0x44, 0x23, 0xE2, 0x12, 0x09, 0x54, 0x72, 0x80,
+    0x9A, 0xFF, 0xC4, 0x42, 0x22, 0x22, 0xEF, 0x89, 0xC8, 0x95, 0x2B, 0x57, 0x9E, 0x3D, 0xE6, 0xAB,
+    0xE9, 0xF8, 0x74, 0x3E, 0xFF, 0xEA, 0xCA, 0x74, 0x24, 0xED, 0x5E, 0xE6, 0x42, 0xFE, 0x83, 0xDE,
+    0xA6, 0xFE, 0xC2, 0xF4, 0xDF, 0x9E, 0x50, 0x68, 0xBF, 0x93, 0xBA, 0xF3, 0x24, 0xEE, 0xFB, 0xA9,
+    0xDB, 0xC9, 0xDC, 0xDA, 0xD4, 0x31, 0x7F, 0x26, 0xD8, 0xA4, 0xB7, 0xDA, 0x57, 0xA9, 0xBF, 0xA0,
+    0x2E, 0x9B, 0x76, 0x63, 0xDC, 0x90, 0xBB, 0x58, 0x3C, 0x13, 0x8A, 0xA4, 0x5F, 0x68, 0xBF, 0xA3,
+    0xBB, 0xBD, 0xD4, 0x9D, 0x57, 0xE5, 0x8C, 0x33, 0xAA, 0xC0, 0xA6, 0x29, 0xAD, 0x33, 0x9F, 0x06,
+    0x1D, 0x91, 0x8A, 0xC2, 0x99, 0xAE, 0xE4, 0x32, 0x4F, 0xFC, 0x3F, 0xC5, 0x99, 0x31, 0xB3, 0xDD,
+    0xC6, 0x75, 0xC7, 0x7F, 0xC0, 0x0E, 0x89, 0x99, 0xA0, 0xD8, 0x14, 0xAA, 0xAC, 0x02, 0x75, 0xDC,
+    0xE0, 0x13, 0xF8, 0x1E, 0x38, 0xFE, 0x00, 0x54, 0xA1, 0x67, 0xCD, 0x44, 0x05, 0xDB, 0x4C, 0x54,
+    0xBC, 0x2F, 0xE0, 0x77, 0x81, 0x19, 0x96, 0x2E, 0xE8, 0x22, 0x4C, 0x6B, 0x17, 0xF1, 0x8C, 0x7D,
+    0x59, 0xB0, 0x49, 0xF9, 0xEE, 0xC3, 0x46, 0x2C, 0x54, 0xA8, 0x78, 0x98, 0xD0, 0x4E, 0x8A, 0x14,
+    0x84, 0x47, 0xE2, 0x78, 0xA2, 0x46, 0x2B, 0x3F, 0x38, 0xC4, 0xA3, 0x16, 0xF7, 0x9F, 0x02, 0xF7,
+    0x91, 0x54, 0x2C, 0x3A, 0x72, 0x46, 0x89, 0x31, 0xD8, 0xB3, 0x67, 0xCF, 0x02, 0x77, 0x17, 0xBB,
+    0xE7, 0xFC, 0xCF, 0x39, 0x7B, 0xB3, 0xEE, 0x2D, 0xAC, 0x18, 0x5C, 0xBC, 0x60, 0x53, 0x0C, 0xBC,
+    0xBC, 0x4A, 0x69, 0x91, 0xF4, 0xB9, 0xB4, 0x24, 0xF0, 0x01, 0xFE, 0xB0, 0x7A, 0xB1, 0xFB, 0x85,
+    0xA4, 0x4B, 0x29, 0xBD, 0xF1, 0x91, 0x00, 0x87, 0xDD, 0xEE, 0xA7, 0xD2, 0x41, 0xD2, 0x08, 0x06,
+    0xE0, 0x66, 0x80, 0x3E, 0x00, 0x7E, 0x01, 0xB2, 0xE7, 0x23, 0x60, 0x35, 0xE0, 0x7E, 0x33, 0x01,
+    0x7B, 0x1F, 0xC0, 0x87, 0x3D, 0x64, 0x73, 0x31, 0x42, 0x8D, 0x81, 0x8B, 0xF9, 0x04, 0x7B, 0x7C,
+    0xC0, 0x07, 0x12, 0x99, 0xA4, 0x91, 0x5A, 0x12, 0xEE, 0xC5, 0xEE, 0xE1, 0xC4, 0x16, 0xAA, 0xCE,
+    0x07, 0x48, 0x59, 0x82, 0x72, 0xAC, 0x1B, 0x30, 0x17, 0xC1, 0x4D, 0x5B, 0xA0, 0xBA, 0x1F, 0x80,
+    0xD4, 0x4B, 0x93, 0x8E, 0x25, 0x01, 0x5F, 0x57, 0x0E, 0x27, 0x0D, 0xD2, 0xA1, 0x91, 0x34, 0x2E,
+    0xDC, 0x9D, 0x17, 0xF2, 0xB4, 0xC0, 0x61, 0x81, 0xED, 0x02, 0xED, 0x02, 0xED, 0x1E, 0x2E, 0xF6,
+    0xB0, 0xEC, 0x29, 0xD2, 0xC5, 0xAE, 0x8F, 0xBD, 0x14, 0x7A, 0xCD, 0xF4, 0xFA, 0x0F, 0x4C, 0x9A,
+    0xBD, 0xA4, 0xC7, 0x91, 0x72, 0x4E, 0xD0, 0x1B, 0xF8, 0xCB, 0x80, 0xBB, 0x8A, 0x90, 0x12, 0x5C,
+    0x18, 0xB4, 0xFE, 0xC5, 0xC3, 0x83, 0x93, 0x16, 0x24, 0x4D, 0x06, 0xED, 0xFD, 0x80, 0x7B, 0x1E,
+    0xE1, 0x22, 0x41, 0x25, 0x28, 0x14, 0xC8, 0x15, 0xE1, 0x90, 0x40, 0xB6, 0x7B, 0xA8, 0x3B, 0x92,
+    0x7E, 0x20, 0x5D, 0xD3, 0xAF, 0xEB, 0x2E, 0xE9, 0xF2, 0x4D, 0xEB, 0xFE, 0x27, 0x57, 0x14, 0x92,
+    0x3A, 0x0A, 0x49, 0x81, 0x72, 0xA5, 0x01, 0xFF, 0x66, 0xFA, 0xC6, 0xBB, 0x7B, 0x45, 0xAB, 0x06,
+    0x1F, 0xA8, 0x1B, 0x7C, 0xC0, 0x78, 0x45, 0xF7, 0xAC, 0xBB, 0x88, 0x0F, 0x6E, 0x06, 0x1F, 0x3E,
+    0x78, 0xB1, 0xDB, 0x3D, 0xFA, 0xAC, 0x97, 0x24, 0xAD, 0xF4, 0x1C, 0xC0, 0xDE, 0x44, 0xDF, 0x02,
+    0xB8, 0xD5, 0x4B, 0x4F, 0x57, 0xE5, 0x7A, 0xFA, 0xA6, 0xCF, 0xD2, 0x6E, 0x77, 0xFF, 0x1B, 0x2C,
+    0xD5, 0x67, 0xBB, 0x5F, 0xAE, 0xFA, 0x7E, 0x30, 0xD6, 0x59, 0x6F, 0x61, 0x0B, 0x17, 0x2C, 0x64,
+    0x33, 0x45, 0x24, 0x51, 0x8C, 0x18, 0xD9, 0x4C, 0xD5, 0xE5, 0x33, 0x6E, 0x62, 0x4B, 0x15, 0x70,
+    0x31, 0x9B, 0x49, 0x50, 0x8C, 0xC5, 0x58, 0x8E, 0xE0, 0x87, 0xAA, 0x6B, 0x01, 0x1F, 0xB6, 0x2E,
+    0x02, 0x95, 0xA4, 0x0E, 0x30, 0x29, 0x01, 0xB9, 0xA4, 0xF9, 0xD8, 0x3D, 0x01, 0x4B, 0x36, 0x17,
+    0x11, 0xCA, 0x58, 0x8C, 0x7E, 0x04, 0x5B, 0x75, 0xD8, 0xCD, 0x6C, 0xA9, 0x03, 0x55, 0xC8, 0x66,
+    0xAC, 0x63, 0x59, 0xC7, 0x2E, 0x47, 0xAA, 0x8E, 0x9E, 0x16, 0xB6, 0xB0, 0xB8, 0x89, 0x6C, 0x26,
+    0x4B, 0x75, 0xA0, 0x18, 0xC9, 0x67, 0xD6, 0xDF, 0xEF, 0x0A, 0xE9, 0xC0, 0xE1, 0x1F, 0xFA, 0xF1,
+    0x2D, 0x5C, 0x02, 0xAC, 0x81, 0x72, 0x84, 0x7C, 0x02, 0x16, 0xA0, 0x05, 0x5A, 0x6E, 0x3F, 0x14,
+    0xB9, 0x16, 0xE8, 0x35, 0x03, 0x6D, 0x38, 0x9A, 0xA6, 0x01, 0x7E, 0x00, 0x37, 0x1D, 0xED, 0xA1,
+    0xFD, 0x4B, 0x68, 0x7F, 0xFC, 0xEC, 0x87, 0xFA, 0x50, 0x52, 0x77, 0xAA, 0x43, 0xC3, 0xAD, 0x06,
+    0xCE, 0x21, 0x53, 0x04, 0xAF, 0x00, 0xBD, 0xA0, 0x50, 0x02, 0x53, 0x24, 0x7F, 0xAE, 0x40, 0x75,
+    0x5F, 0x90, 0x2C, 0x51, 0x0E, 0x8A, 0x6C, 0x9C, 0x82, 0x8B, 0x5E, 0x54, 0x8D, 0x25, 0x12, 0x8A,
+    0x3E, 0x38, 0x85, 0x2D, 0x5E, 0x2E, 0x62, 0xA9, 0x06, 0x7D, 0x31, 0xE3, 0x74, 0x19, 0xF0, 0xDA,
+    0x83, 0x69, 0x04, 0x09, 0x9C, 0xA6, 0xE3, 0x18, 0x06, 0x40, 0x36, 0xB9, 0x88, 0x8B, 0x75, 0x43,
+    0xA9, 0x04, 0x85, 0xBA, 0x57, 0xB0, 0x55, 0x03, 0x6D, 0x02, 0xA7, 0x08, 0xB5, 0x02, 0x99, 0x04,
+    0x5E, 0x09, 0xF6, 0x8A, 0x14, 0x9F, 0x28, 0x60, 0x5E, 0xE4, 0x93, 0x25, 0x7C, 0xA7, 0x48, 0x72,
+    0x0A, 0xC5, 0xE0, 0x85, 0x61, 0xC9, 0x45, 0x14, 0xAB, 0xCE, 0x29, 0x24, 0xBC, 0xCA, 0x80, 0xA5,
+    0x2D, 0xE8, 0x2A, 0xE2, 0xF4, 0x79, 0x83, 0xD7, 0x0C, 0xA6, 0x00, 0x5A, 0x8E, 0x63, 0xF8, 0x70,
+    0x0E, 0xF5, 0x9D, 0x40, 0x11, 0x13, 0x2C, 0x3E, 0x50, 0x77, 0x89, 0x22, 0xFA, 0x40, 0x22, 0x51,
+    0x77, 0x3E, 0x14, 0x91, 0x44, 0xC2, 0x07, 0x6B, 0x90, 0x22, 0x5E, 0x0B, 0x2B, 0x13, 0xAC, 0x23,
+    0xB1, 0xE0, 0x43, 0x19, 0x49, 0x58, 0xE7, 0x43, 0x96, 0x48, 0x94, 0xD1, 0x07, 0xAC, 0x4B, 0x64,
+    0xC9, 0x07, 0xCA, 0x98, 0xC0, 0xEE, 0x07, 0xB2, 0x84, 0x97, 0xB4, 0x5A, 0x68, 0x26, 0x29, 0x72,
+    0x06, 0x89, 0xAA, 0xC1, 0x28, 0x06, 0x7C, 0xC8, 0x26, 0x5C, 0x64, 0x0F, 0x89, 0x1A, 0x6C, 0xB5,
+    0xD3, 0x3C, 0xE2, 0x22, 0x09, 0x12, 0x06, 0xB6, 0x1A, 0xA9, 0x7B, 0x25, 0xDC, 0x80, 0xAD, 0xD6,
+    0x5A, 0x0C, 0xB8, 0x98, 0x47, 0x48, 0x24, 0xB0, 0xEF, 0x1E, 0xC0, 0x5F, 0x0A, 0xDC, 0x95, 0x1A,
+    0x48, 0x6F, 0x01, 0xD0, 0x77, 0x90, 0x49, 0x01, 0x9C, 0x34, 0x42, 0x21, 0x45, 0x28, 0x75, 0x98,
+    0xC0, 0xF7, 0x69, 0x86, 0xCA, 0x52, 0x02, 0xB3, 0x74, 0x06, 0xDF, 0xB3, 0x64, 0x70, 0x6E, 0xA9,
+    0x86, 0xD9, 0x52, 0xD5, 0x65, 0x93, 0x25, 0x1F, 0xF2, 0x68, 0xA9, 0x1C, 0xDC, 0x68, 0xC9, 0x8D,
+    0x65, 0xB0, 0xE4, 0xA2, 0x0F, 0x96, 0xB2, 0x69, 0x55, 0x8E, 0x1A, 0x4B, 0x9C, 0x6F, 0xB0, 0xC4,
+    0xF6, 0x0C, 0x4B, 0xC7, 0xBB, 0x9E, 0xB1, 0x84, 0x8F, 0xAF, 0x68, 0x31, 0x60, 0xE7, 0x90, 0x3D,
+    0x8F, 0x50, 0x7C, 0x1E, 0xA0, 0xEA, 0x81, 0x6D, 0x82, 0xEC, 0xCB, 0x37, 0x89, 0x5E, 0xEC, 0x76,
+    0x7D, 0xAF, 0x15, 0x34, 0xF4, 0xE5, 0x9F, 0xF0, 0xE2, 0x4B, 0xD1, 0x51, 0xD7, 0x5A, 0x75, 0xD0,
+    0x4A, 0x1D, 0xF5, 0x8B, 0xF7, 0x45, 0x31, 0x53, 0x24, 0x16, 0xF0, 0x63, 0xDD, 0x41, 0xEB, 0x22,
+    0xB8, 0xB9, 0x05, 0xAA, 0x8F, 0x47, 0x20, 0x2D, 0xAC, 0x5E, 0x00, 0x96, 0x04, 0xF8, 0xA7, 0xAF,
+    0xB1, 0x03, 0x90, 0x2E, 0x00, 0xFF, 0x51, 0x84, 0x2C, 0x19, 0x50, 0xDF, 0x9B, 0xC1, 0x45, 0x3F,
+    0xC0, 0x81, 0xBE, 0xC1, 0x42, 0xAE, 0x07, 0xA7, 0x91, 0x52, 0x4A, 0x50, 0xEA, 0x1A, 0xC8, 0xDE,
+    0x81, 0x5E, 0xD2, 0x95, 0x56, 0x4F, 0x2C, 0x19, 0xAB, 0x8B, 0x71, 0x57, 0xF1, 0x38, 0x9C, 0x7D,
+    0xEB, 0xA2, 0x5E, 0xFF, 0x88, 0xA4, 0x4E, 0x52, 0x4C, 0x94, 0x73, 0x22, 0x4F, 0x69, 0xFD, 0x96,
+    0xFD, 0xB1, 0x2C, 0x09, 0xD2, 0x2A, 0xAF, 0xA2, 0xA4, 0x41, 0x3A, 0xA0, 0xDD, 0x4F, 0x78, 0x93,
+    0xCF, 0x7D, 0xBD, 0x1C, 0x6D, 0x59, 0x9F, 0x62, 0x52, 0xAC, 0x0E, 0xBB, 0xA5, 0x58, 0xC8, 0x3A,
+    0x01, 0x75, 0x38, 0xE2, 0x52, 0xCB, 0x8A, 0x69, 0x2C, 0x47, 0xB4, 0x22, 0x71, 0xF4, 0x63, 0xE9,
+    0x46, 0x72, 0x01, 0x94, 0xF1, 0x88, 0x68, 0x2E, 0x01, 0xD5, 0x78, 0xD4, 0x60, 0xA7, 0x07, 0xEF,
+    0x0F, 0xA5, 0xB4, 0x50, 0x4A, 0x1D, 0xBC, 0x4B, 0x2F, 0xE9, 0x77, 0x92, 0xF4, 0xB1, 0x24, 0x1D,
+    0xC1, 0x26, 0x01, 0x2E, 0xDE, 0xFC, 0xF0, 0xB7, 0x2C, 0xBA, 0x60, 0x85, 0x0E, 0xFC, 0x87, 0x33,
+    0x94, 0xA3, 0x81, 0x8B, 0xE5, 0x48, 0x3E, 0xAF, 0x86, 0x59, 0x77, 0x6C, 0x71, 0x11, 0x6B, 0xB8,
+    0xA0, 0x0A, 0xF8, 0x50, 0x0E, 0xE4, 0xB3, 0x8B, 0x60, 0xF9, 0x04, 0xE5, 0x98, 0x80, 0xB4, 0x05,
+    0xEA, 0x1E, 0x70, 0xEA, 0x80, 0x7E, 0x00, 0x7C, 0xE4, 0xB8, 0x4E, 0x79, 0x02, 0xB2, 0x05, 0x78,
+    0x78, 0x00, 0xDA, 0x03, 0x50, 0x2D, 0x00, 0xEF, 0xF0, 0xFA, 0xB5, 0xAE, 0xFB, 0x8A, 0xB0, 0x3E,
+    0x00, 0xB7, 0xA5, 0x79, 0xF5, 0x5E, 0x23, 0xF5, 0x75, 0xFB, 0xBE, 0xA8, 0x07, 0x1F, 0xAA, 0x58,
+    0x05, 0x17, 0x39, 0x94, 0x23, 0x89, 0xEA, 0x71, 0xC4, 0x70, 0x31, 0xE1, 0x03, 0xFB, 0x16, 0x17,
+    0xA9, 0xEF, 0x06, 0x12, 0xE5, 0x93, 0x88, 0x91, 0x4F, 0x09, 0x1F, 0x48, 0x75, 0xE7, 0x22, 0x6D,
+    0x31, 0x91, 0xB0, 0xAE, 0x6F, 0x8C, 0x36, 0x94, 0x87, 0xBB, 0xFF, 0xAA, 0x40, 0x2B, 0xA9, 0x23,
+    0xEB, 0x75, 0xF8, 0x6F, 0x83, 0xAF, 0x0B, 0x05, 0xEF, 0xAE, 0xE2, 0x6C, 0xAA, 0xC2, 0x6A, 0x0A,
+    0xE5, 0xE0, 0xE2, 0xEA, 0x7F, 0x0D, 0x16, 0xF6, 0xD0, 0x66, 0x09, 0xEA, 0x7B, 0x11, 0xFC, 0xC7,
+    0xC3, 0x1A, 0x34, 0x91, 0x0B, 0xE0, 0xC0, 0x91, 0x73, 0xEA, 0x8E, 0xBD, 0xD5, 0xBD, 0x08, 0x96,
+    0xCF, 0xB0, 0x5F, 0xFD, 0xFA, 0x3A, 0xE9, 0xAE, 0x1C, 0xF1, 0xC1, 0x07, 0x8A, 0x68, 0x0D, 0x6E,
+    0xBA, 0x80, 0x2C, 0x9D, 0x43, 0x1E, 0x7D, 0x00, 0x23, 0x81, 0xFB, 0x7F, 0x61, 0x3F, 0xDB, 0xED,
+    0xFA, 0x5F, 0x48, 0x92, 0x9E, 0x4A, 0xD2, 0x02, 0x50, 0x0E, 0x00, 0xFB, 0xAF, 0x65, 0xDF, 0x3A,
+    0x83, 0xF2, 0xE3, 0x01, 0xD2, 0xFE, 0xF8, 0x85, 0x5F, 0xC3, 0x6C, 0xC1, 0x7F, 0x34, 0x42, 0x32,
+    0xF0, 0x8F, 0x13, 0x59, 0xAA, 0x0E, 0x0F, 0x15, 0x5A, 0x29, 0xD1, 0x1F, 0xEE, 0x84, 0x3F, 0xB0,
+    0x9D, 0x37, 0x30, 0xE7, 0xB0, 0x81, 0xDA, 0xA0, 0xEA, 0xF0, 0x4F, 0x03, 0xC5, 0x88, 0x7B, 0x1E,
+    0xC9, 0xE6, 0xD5, 0xDE, 0xB7, 0x60, 0xED, 0x9F, 0xA3, 0xF3, 0xB3, 0x5D, 0xFF, 0xD9, 0xEE, 0xD1,
+    0x53, 0x49, 0x92, 0x9E, 0xAF, 0xD5, 0x72, 0x0E, 0x67, 0xB0, 0x75, 0x91, 0x7C, 0x22, 0x9B, 0x7D,
+    0xA0, 0x1C, 0x28, 0x46, 0x83, 0xBA, 0xA1, 0xEA, 0x12, 0xEC, 0xFF, 0xDC, 0xDD, 0x2F, 0x76, 0x0F,
+    0x0F, 0xBB, 0x87, 0x87, 0x47, 0xFA, 0xEA, 0xF5, 0x15, 0x8B, 0xBC, 0xB1, 0x84, 0xA3, 0x5D, 0xDC,
+    0x58, 0xC9, 0xCB, 0xEE, 0xAC, 0xE9, 0xD5, 0xB1, 0x86, 0x42, 0xF4, 0x0A, 0x2F, 0xBB, 0xFC, 0x1F,
+    0x61, 0x0F, 0xBF, 0x6C, 0xC0, 0x6B, 0x8D, 0xB0, 0x14, 0xF0, 0xE1, 0xB6, 0x20, 0xE1, 0x66, 0x7C,
+    0xA0, 0x0A, 0x2B, 0xFE, 0xDC, 0x64, 0x5A, 0xAF, 0xB1, 0xF9, 0x8C, 0x0F, 0xF4, 0x70, 0xD8, 0x69,
+    0xC0, 0x4B, 0x13, 0x48, 0x9F, 0x72, 0x0E, 0xE4, 0x57, 0xF1, 0xA5, 0x87, 0xB3, 0x15, 0xF1, 0x12,
+    0x47, 0xE7, 0xF1, 0x75, 0xE2, 0x17, 0xBF, 0x6C, 0xF0, 0x97, 0xD2, 0x88, 0x99, 0x34, 0x91, 0x16,
+    0xAA, 0xC9, 0x5D, 0x45, 0xCA, 0xE8, 0x2F, 0x03, 0x3E, 0x98, 0x41, 0xDD, 0xA4, 0x04, 0x7B, 0x77,
+    0x15, 0xC9, 0x27, 0x7F, 0x19, 0xF0, 0x83, 0x19, 0xB4, 0xA4, 0x44, 0x31, 0xBB, 0xAB, 0x17, 0x3B,
+    0x05, 0x7F, 0x29, 0xCD, 0x98, 0xE9, 0x7A, 0x55, 0x52, 0xF6, 0xFF, 0x43, 0xB9, 0xD8, 0xBD, 0x43,
+    0xAF, 0x43, 0xD3, 0x4B, 0xE3, 0x9E, 0x6A, 0xDA, 0x93, 0xA7, 0x35, 0x97, 0x63, 0x7F, 0xCC, 0xEB,
+    0xF6, 0x6B, 0x3B, 0x4B, 0x7B, 0x8A, 0xF9, 0x98, 0xDF, 0x75, 0xBD, 0x3E, 0x5D, 0x17, 0xFD, 0x6D,
+    0xCD, 0x14, 0xD2, 0x01, 0x7F, 0xFD, 0x81, 0x78, 0x6B, 0x45, 0x99, 0xEC, 0x70, 0x83, 0xB4, 0xF9,
+    0x0C, 0x14, 0xF1, 0xC6, 0x0D, 0x59, 0xF3, 0xDD, 0xDD, 0xEE, 0x90, 0x49, 0x9A, 0x8B, 0x35, 0x0D,
+    0xA6, 0x6E, 0x8E, 0x53, 0x79, 0xE5, 0x10, 0x2E, 0x6E, 0x5A, 0xD6, 0x41, 0x91, 0x8A, 0x67, 0x3F,
+    0x54, 0xA8, 0xA4, 0x99, 0x5A, 0x87, 0x06, 0x4E, 0xBE, 0x12, 0xE4, 0xDE, 0xD6, 0x35, 0x3E, 0xE0,
+    0xA5, 0xD1, 0x45, 0xAA, 0xC3, 0x07, 0x22, 0xE1, 0x23, 0x55, 0x34, 0xFC, 0x08, 0x07, 0x1F, 0x8A,
+    0x08, 0xD5, 0xE3, 0x98, 0x4F, 0xE0, 0xA6, 0xB4, 0xC6, 0xF1, 0x46, 0xBB, 0xEE, 0x45, 0xD5, 0x81,
+    0xBB, 0x3A, 0x3C, 0x1A, 0x81, 0xB4, 0x26, 0x24, 0xD6, 0xEA, 0xB0, 0x86, 0x25, 0x75, 0x07, 0xEE,
+    0x2A, 0x16, 0x23, 0x90, 0x52, 0x96, 0xD6, 0x8D, 0x33, 0xA0, 0xBA, 0x0C, 0x7E, 0x00, 0xFF, 0x49,
+    0xCC, 0x12, 0x14, 0x31, 0x61, 0x1D, 0x6E, 0x36, 0x8A, 0x19, 0x97, 0x7C, 0xA0, 0x7D, 0xF6, 0x7E,
+    0x72, 0x91, 0x42, 0x4A, 0x24, 0xA8, 0x35, 0x01, 0x70, 0x0B, 0xE0, 0x76, 0xAF, 0x50, 0x4A, 0xC9,
+    0x49, 0x0A, 0x6A, 0x48, 0x55, 0x58, 0x3D, 0x5F, 0xAA, 0x1B, 0xFC, 0x87, 0x13, 0xA4, 0xBA, 0xC3,
+    0xFF, 0x73, 0x82, 0xE4, 0x23, 0x3E, 0xD8, 0xB3, 0x93, 0xC4, 0x31, 0xD6, 0x4D, 0xF8, 0x67, 0x77,
+    0x43, 0x9E, 0x48, 0x18, 0x3E, 0xF8, 0x91, 0x94, 0x1D, 0x63, 0xEA, 0x54, 0x8E, 0xC7, 0xB7, 0xAC,
+    0xC1, 0x7F, 0x3C, 0x1E, 0x35, 0xBD, 0xD0, 0x8C, 0xB4, 0xE4, 0xD7, 0xEF, 0xA5, 0x75, 0x47, 0x8A,
+    0x71, 0x5D, 0x69, 0xE3, 0x3B, 0x7D, 0x2A, 0xA5, 0xA8, 0x67, 0x77, 0x2F, 0x47, 0xAC, 0x85, 0x65,
+    0xA6, 0x78, 0x3E, 0x52, 0x3F, 0x0D, 0x99, 0xAC, 0xAB, 0x53, 0xAB, 0xDF, 0xC5, 0xF6, 0x50, 0x84,
+    0x5B, 0x00, 0xFC, 0x0D, 0x94, 0x8A, 0x54, 0x12, 0xA5, 0x7E, 0xBE, 0xEE, 0xB3, 0x01, 0x65, 0x00,
+    0x66, 0xA0, 0xE2, 0x84, 0xFC, 0x0B, 0x1D, 0xB0, 0x5E, 0xC9, 0xA9, 0xA9, 0xA2, 0x05, 0xEC, 0x07,
+    0xF3, 0x1A, 0xC8, 0xF9, 0xC7, 0xF1, 0x88, 0xBD, 0x4F, 0x22, 0x2C, 0x2F, 0x25, 0x75, 0x43, 0x15,
+    0x12, 0x6E, 0x2A, 0x47, 0x5A, 0x6C, 0x38, 0x1D, 0x90, 0x26, 0x72, 0xCD, 0xAB, 0x73, 0x36, 0x5D,
+    0x63, 0xD2, 0x60, 0xBB, 0x47, 0xD1, 0x70, 0xB3, 0x91, 0x1D, 0x8B, 0x9B, 0x6C, 0xF7, 0x68, 0x30,
+    0x1D, 0x30, 0x69, 0x34, 0x8A, 0xD9, 0xD6, 0x11, 0x96, 0xB5, 0xCE, 0x92, 0x9D, 0x9C, 0xCE, 0x26,
+    0x8D, 0xC7, 0x67, 0x4C, 0xB2, 0xDD, 0xCE, 0xE0, 0x9B, 0xDF, 0x98, 0x14, 0x8E, 0x64, 0xF7, 0x28,
+    0xB0, 0xA1, 0x7C, 0x9D, 0x7C, 0xEF, 0x25, 0x39, 0xA3, 0x0C, 0xFC, 0x88, 0x32, 0x70, 0x4E, 0x19,
+    0x48, 0x94, 0x81, 0x99, 0x32, 0xE4, 0x13, 0x65, 0x70, 0x91, 0x32, 0xDC, 0x7D, 0x76, 0x72, 0xF7,
+    0x59, 0xFF, 0x32, 0xB1, 0x3F, 0xBF, 0x49, 0xE2, 0x5F, 0x23, 0x7F, 0x0B, 0x7C, 0x77, 0x55, 0xEE,
+    0x03, 0x99, 0x34, 0x14, 0xD7, 0x6F, 0x4F, 0x7E, 0xC8, 0x52, 0xDD, 0xB1, 0x18, 0x6C, 0x0D, 0xDA,
+    0x76, 0xB7, 0x53, 0x2B, 0xA9, 0xDD, 0xED, 0x76, 0xDB, 0xE3, 0x1E, 0x18, 0x50, 0x77, 0xE0, 0x47,
+    0x28, 0x96, 0xEC, 0x3C, 0x93, 0x12, 0xB5, 0x3E, 0x85, 0x77, 0x31, 0xF2, 0x48, 0xFD, 0xFD, 0x19,
+    0xA3, 0x18, 0xCB, 0xC1, 0x45, 0x12, 0x86, 0x51, 0x37, 0xD9, 0xEC, 0x62, 0x31, 0x52, 0x0E, 0x46,
+    0x02, 0x73, 0xB1, 0x6E, 0xC8, 0xAE, 0xDB, 0xF7, 0x47, 0x8E, 0xD1, 0x35, 0x92, 0x06, 0xA8, 0xEF,
+    0xC5, 0x16, 0x8A, 0x68, 0xF9, 0x0C, 0xC9, 0x45, 0x3F, 0x50, 0x77, 0x86, 0x51, 0x44, 0x17, 0xF3,
+    0x79, 0x55, 0xC6, 0xE1, 0x18, 0xDF, 0x44, 0x6C, 0xB5, 0xFC, 0xAC, 0x57, 0xD3, 0x4A, 0xEE, 0xD9,
+    0xDB, 0x33, 0x54, 0x2F, 0x8F, 0x19, 0xF2, 0x39, 0xDF, 0x1D, 0x68, 0xD5, 0x38, 0x1D, 0xD6, 0xB8,
+    0xAC, 0x1C, 0x60, 0xBB, 0x2A, 0xE6, 0x72, 0x4D, 0x7B, 0x29, 0x4D, 0xAD, 0x66, 0x6E, 0xBD, 0xC3,
+    0x06, 0x0E, 0x1B, 0x72, 0x6D, 0x70, 0xDA, 0x50, 0x6A, 0x43, 0xD5, 0x6E, 0x30, 0xDB, 0xF0, 0x23,
+    0xDB, 0x30, 0xDB, 0x26, 0x8F, 0xB6, 0x29, 0x06, 0xDB, 0xF8, 0x60, 0x9B, 0xAA, 0xB1, 0xCD, 0x06,
+    0xDB, 0x9C, 0x63, 0x36, 0x63, 0x16, 0x31, 0x1B, 0x30, 0x0B, 0x58, 0xF6, 0xB3, 0xFC, 0x27, 0x79,
+    0x2C, 0x06, 0x96, 0x2A, 0xD0, 0x0A, 0xFE, 0xE2, 0xD3, 0x97, 0x30, 0xF2, 0x6D, 0x8D, 0xB1, 0x59,
+    0x75, 0x32, 0x1A, 0xE5, 0x60, 0x54, 0x9D, 0x61, 0x18, 0x0B, 0x96, 0xCD, 0xD8, 0x7B, 0x11, 0xD3,
+    0x80, 0x69, 0xC4, 0xDC, 0x84, 0x65, 0x09, 0xE3, 0x02, 0xC3, 0x1A, 0xA3, 0x0A, 0x46, 0x39, 0x1A,
+    0x6E, 0x32, 0xB2, 0x44, 0x2B, 0x75, 0x95, 0x34, 0x16, 0x9F, 0xED, 0xE6, 0x3C, 0xB2, 0xE1, 0x1C,
+    0xDF, 0xD5, 0xB8, 0xB1, 0x0C, 0xCC, 0x2E, 0xB2, 0x21, 0xE1, 0x3B, 0xC3, 0x8D, 0xBE, 0x63, 0x76,
+    0x23, 0x1B, 0x26, 0x7C, 0x77, 0x86, 0x1B, 0x0D, 0x5E, 0x9C, 0x06, 0x36, 0x1A, 0xF0, 0xFD, 0x80,
+    0x1B, 0x01, 0x2C, 0x40, 0x7B, 0x7F, 0x82, 0xFA, 0x4A, 0xE0, 0x93, 0x02, 0xA5, 0x36, 0x33, 0xEE,
+    0xF3, 0xCB, 0x47, 0x64, 0xCF, 0xAF, 0x7E, 0x3B, 0x90, 0xD2, 0x9C, 0x38, 0xB3, 0x4D, 0xD5, 0xD4,
+    0xFE, 0xF2, 0xDE, 0xE8, 0xEF, 0x5D, 0x8D, 0xE7, 0x65, 0x48, 0xB3, 0xBF, 0x37, 0xDA, 0xC6, 0x7D,
+    0x31, 0xF9, 0xCB, 0xEE, 0x2C, 0xB9, 0xAB, 0xD1, 0x2F, 0xA4, 0x39, 0x17, 0xB6, 0xC1, 0x3A, 0x7F,
+    0xD9, 0x95, 0xC1, 0xC5, 0xCD, 0xAA, 0x96, 0x5F, 0x5F, 0x4E, 0x4E, 0x2E, 0x4C, 0x3A, 0xD8, 0x7A,
+    0x9E, 0xB4, 0xFD, 0x63, 0x85, 0xF5, 0xD8, 0x66, 0x22, 0x93, 0x22, 0xED, 0x83, 0x36, 0xF8, 0x81,
+    0x3E, 0x9F, 0x71, 0x93, 0x1D, 0x23, 0xD6, 0xD4, 0xDE, 0x84, 0x70, 0xDB, 0x63, 0x8A, 0x78, 0x03,
+    0x2C, 0x59, 0xAA, 0x3B, 0xAC, 0x59, 0x28, 0x63, 0x71, 0x7D, 0x7B, 0xA1, 0x92, 0x1A, 0x6A, 0x75,
+    0x70, 0x0B, 0x4C, 0x5A, 0x4C, 0x5A, 0x6C, 0xB7, 0x5B, 0x0C, 0xF6, 0xFF, 0xDB, 0x02, 0xE0, 0xFF,
+    0x5A, 0xA3, 0xFB, 0x37, 0x09, 0x3D, 0x3B, 0x8D, 0x36, 0x70, 0xF0, 0x23, 0xD5, 0xE3, 0x88, 0x9B,
+    0xD2, 0xFA, 0x54, 0x75, 0x3F, 0x50, 0x7C, 0x12, 0xC9, 0xE6, 0xB4, 0x7E, 0x58, 0x7D, 0x27, 0xE0,
+    0x9F, 0xCC, 0x14, 0x51, 0xB8, 0xD9, 0xE6, 0x22, 0xF9, 0x47, 0x4A, 0xEE, 0x37, 0x9A, 0x49, 0x59,
+    0xB3, 0x9E, 0x32, 0x85, 0xA3, 0xCF, 0x4B, 0x37, 0xC7, 0x4E, 0xE1, 0x55, 0xC0, 0x03, 0xFD, 0xA1,
+    0xA9, 0xA4, 0x4C, 0x27, 0xFF, 0xE4, 0x47, 0xE8, 0xD7, 0x2E, 0x1F, 0x60, 0x0B, 0xD9, 0x11, 0xD1,
+    0xAB, 0x6E, 0x7D, 0xF3, 0x08, 0xF2, 0x6E, 0x82, 0xF2, 0x3A, 0xFB, 0x59, 0x29, 0x75, 0xB7, 0xB5,
+    0xC0, 0x5B, 0xB4, 0x6B, 0xAE, 0xFF, 0x9F, 0xBB, 0xC3, 0xAE, 0xCB, 0xE3, 0x0A, 0xDB, 0x35, 0x70,
+    0x0E, 0xDF, 0xB8, 0xB9, 0x87, 0xEA, 0xA7, 0x1D, 0xE5, 0x93, 0x88, 0x8B, 0x7B, 0xB2, 0xB9, 0x0A,
+    0x2C, 0x2E, 0x62, 0x6C, 0xA9, 0x3A, 0x1F, 0x7C, 0xC8, 0x27, 0x17, 0xD9, 0xE4, 0x13, 0x3E, 0x24,
+    0xB2, 0x69, 0x0B, 0x56, 0x37, 0x94, 0x97, 0x01, 0xBE, 0x1C, 0xC1, 0x22, 0x14, 0xE9, 0x98, 0xAE,
+    0x1A, 0xEB, 0xBC, 0x7D, 0x58, 0xC3, 0x84, 0x62, 0x22, 0x7B, 0x34, 0x43, 0x9F, 0xA0, 0x7A, 0xCD,
+    0x63, 0x32, 0x03, 0xF8, 0xEE, 0x8D, 0x6C, 0x96, 0x80, 0x52, 0x87, 0x86, 0x52, 0x52, 0xE3, 0x74,
+    0xF7, 0xDF, 0x17, 0xFA, 0x66, 0x2E, 0xA7, 0x2A, 0xF8, 0xAE, 0x7E, 0x3C, 0x31, 0xB3, 0x18, 0xBE,
+    0x2B, 0x7F, 0x1B, 0x99, 0x69, 0xB7, 0xF8, 0xCE, 0x3D, 0x1F, 0x99, 0xB1, 0x16, 0xDF, 0xB9, 0xAB,
+    0xC8, 0xCC, 0xD6, 0x1A, 0xDF, 0xF9, 0x7F, 0x49, 0xCC, 0x59, 0xF2, 0xA3, 0xEF, 0xDA, 0xCE, 0x86,
+    0xF9, 0x74, 0x44, 0xD2, 0x4C, 0x26, 0x5D, 0x03, 0xA7, 0xBF, 0xFA, 0x26, 0xD3, 0x61, 0x5E, 0xBD,
+    0x47, 0x11, 0xB1, 0xE6, 0x82, 0xBA, 0xF3, 0xC1, 0x87, 0x2C, 0xF9, 0x81, 0xFA, 0xC7, 0x23, 0xEE,
+    0xCB, 0xB8, 0xAE, 0x43, 0x39, 0x43, 0x7E, 0x80, 0x4C, 0xC3, 0x1A, 0xC4, 0x2F, 0x55, 0xE0, 0x22,
+    0x9F, 0x57, 0x54, 0x68, 0x8A, 0x58, 0x77, 0x5C, 0x54, 0x01, 0x3F, 0x6C, 0xE0, 0x8C, 0x44, 0x3E,
+    0xB9, 0x48, 0x39, 0xF8, 0x40, 0xDD, 0x18, 0xEC, 0xFF, 0x64, 0xD1, 0xAF, 0x4F, 0xDA, 0xBF, 0x37,
+    0x49, 0x51, 0x92, 0xC2, 0xF1, 0x9C, 0x70, 0x0D, 0x5A, 0xE3, 0x8D, 0x23, 0xFF, 0x0E, 0x09, 0xBE,
+    0x8C, 0x38, 0x05, 0xBC, 0xC0, 0x12, 0xE8, 0xB5, 0x66, 0x4F, 0x96, 0xB4, 0xEB, 0xBF, 0x90, 0x14,
+    0x4E, 0xAF, 0x8F, 0x2A, 0x77, 0xA3, 0x90, 0x2F, 0x9B, 0x1B, 0xB2, 0x09, 0xFF, 0xD1, 0x48, 0xDD,
+    0x90, 0xB6, 0xE4, 0xDF, 0x7E, 0xE3, 0xF7, 0x27, 0xED, 0x83, 0x93, 0xD4, 0x4A, 0x92, 0x3E, 0x92,
+    0x24, 0xA5, 0x0D, 0xF9, 0x84, 0xEF, 0x8C, 0x7C, 0xC2, 0x87, 0xFF, 0xCB, 0xEA, 0xE4, 0xBD, 0xEB,
+    0x93, 0xD3, 0x5F, 0x99, 0xA4, 0x15, 0xDC, 0xA4, 0x35, 0x75, 0x87, 0xCD, 0x1F, 0xA9, 0xFE, 0xAA,
+    0x55, 0x03, 0xBD, 0x1A, 0xF8, 0xBB, 0xBE, 0xB9, 0x09, 0x7F, 0x5F, 0x23, 0x0F, 0x1A, 0xA8, 0x57,
+    0xE4, 0x52, 0xA4, 0x6E, 0xDE, 0x9E, 0xA9, 0x9B, 0x2C, 0x51, 0x37, 0x24, 0xEA, 0x86, 0xE5, 0x86,
+    0xCB, 0x13, 0xF5, 0x83, 0xD3, 0x89, 0x5A, 0x1A, 0xA8, 0xB5, 0xB0, 0x01, 0xAA, 0x3B, 0x01, 0x8A,
+    0x27, 0x11, 0xB2, 0x29, 0x01, 0x67, 0xF6, 0x4A, 0xF8, 0xFB, 0x77, 0xC9, 0x26, 0x69, 0xE6, 0xCC,
+    0xA4, 0xA1, 0xBA, 0x13, 0x8A, 0x54, 0x3C, 0x89, 0xD8, 0xF7, 0xA7, 0x44, 0x39, 0x9E, 0x19, 0xD9,
+    0x5C, 0xDD, 0x09, 0xEC, 0x8B, 0x27, 0x91, 0x36, 0x9B, 0x96, 0x1F, 0xAA, 0x3B, 0x33, 0xA9, 0xAB,
+    0xEE, 0xE8, 0x40, 0x31, 0x6C, 0xBE, 0x7E, 0x9B, 0x7F, 0xFF, 0x0E, 0x5E, 0xEA, 0x4C, 0x1A, 0x12,
+    0xED, 0xE3, 0x88, 0xDD, 0x09, 0x6C, 0x8D, 0x6C, 0x4E, 0x94, 0x9F, 0x44, 0xCC, 0xFF, 0xFA, 0x83,
+    0xD9, 0xA4, 0x4E, 0x6B, 0xC6, 0x90, 0x6B, 0xA1, 0xD5, 0xEC, 0x1E, 0x9C, 0xC6, 0x35, 0xBE, 0xBF,
+    0x71, 0xFE, 0xB7, 0x4E, 0xDE, 0x8F, 0x92, 0xBC, 0x14, 0xC1, 0x56, 0x44, 0x5B, 0xFF, 0x1A, 0x71,
+    0xF3, 0xCF, 0x6F, 0xAB, 0x94, 0x42, 0xAB, 0x81, 0x5B, 0xCD, 0x4B, 0x9F, 0x9D, 0x69, 0xC6, 0xF0,
+    0x12, 0x86, 0xFD, 0xBA, 0x0D, 0xC6, 0x05, 0xE5, 0x68, 0x24, 0x5C, 0xB4, 0x6C, 0x26, 0x9B, 0x2D,
+    0x9F, 0x20, 0xD9, 0x7B, 0x13, 0x24, 0x53, 0x7C, 0x45, 0xDD, 0x04, 0xE9, 0xD8, 0xBB, 0x3E, 0x49,
+    0xC2, 0x4D, 0xC6, 0x05, 0x45, 0x34, 0x6C, 0x38, 0x0D, 0x86, 0x97, 0x1A, 0x3B, 0x06, 0xA1, 0xDC,
+    0x02, 0x4E, 0xB5, 0x14, 0xD2, 0xE2, 0x5F, 0xEC, 0x96, 0x3A, 0x7C, 0xD5, 0x2F, 0xD4, 0x1D, 0x7B,
+    0x7F, 0x7D, 0xB2, 0x2F, 0xA4, 0x85, 0x5E, 0x0B, 0x2D, 0x7B, 0x16, 0xF6, 0xF9, 0xCC, 0xBE, 0x88,
+    0xEC, 0x7D, 0x60, 0x6F, 0x1D, 0xFB, 0xF6, 0xE8, 0x43, 0x48, 0x65, 0x20, 0xF9, 0x40, 0x2A, 0xC3,
+    0x57, 0x0E, 0x9F, 0xBE, 0xC5, 0xA0, 0xEF, 0xBF, 0x00, 0xD5, 0xBD, 0x5D, 0x8C, 0x25, 0xC7, 0x95,
+    0xE7, 0xF7, 0xCB, 0x0C, 0x56, 0xE7, 0xA8, 0x73, 0xC5, 0xA0, 0xB1, 0xDD, 0x1A, 0x0E, 0x5B, 0x62,
+    0xEA, 0x41, 0x36, 0x34, 0x1A, 0x91, 0x29, 0x03, 0x84, 0x41, 0x03, 0x55, 0x37, 0x92, 0x22, 0xBC,
+    0xF3, 0x40, 0xC0, 0x6C, 0x60, 0xBB, 0x28, 0x60, 0x09, 0x9B, 0x02, 0x76, 0xE0, 0xC5, 0x70, 0xD7,
+    0x2E, 0x2E, 0x20, 0xC0, 0xFD, 0xD0, 0x75, 0x33, 0xA9, 0x86, 0x21, 0xC0, 0x02, 0x96, 0xB5, 0xD8,
+    0xE5, 0xC2, 0x80, 0x1F, 0xD4, 0xB0, 0xA9, 0x35, 0x75, 0x1B, 0xBB, 0xCD, 0x5D, 0x10, 0x70, 0x8F,
+    0x71, 0x6F, 0x65, 0x90, 0x6D, 0xA3, 0x61, 0xEB, 0x81, 0xA9, 0xE1, 0x08, 0x04, 0x2C, 0x03, 0x4C,
+    0x0D, 0xC9, 0xE1, 0xA8, 0x05, 0x83, 0x21, 0x32, 0x5B, 0xCA, 0x6A, 0x46, 0xDE, 0xE3, 0x87, 0xC8,
+    0x5B, 0x1F, 0xCD, 0xE6, 0x97, 0x44, 0x51, 0x72, 0x56, 0xE5, 0xC7, 0x8D, 0x9B, 0x37, 0x33, 0xE3,
+    0x44, 0xC4, 0x89, 0xF3, 0xF1, 0x3F, 0x27, 0xD1, 0x3F, 0xFC, 0xE5, 0x60, 0x22, 0xE0, 0x9E, 0xF4,
+    0xEB, 0xED, 0xE5, 0x89, 0x3E, 0xDF, 0x7A, 0xA3, 0xAF, 0x38, 0x6F, 0xF4, 0x95, 0x5F, 0xF8, 0x92,
+    0xB0, 0xCC, 0x21, 0xB5, 0xB0, 0x28, 0x22, 0x11, 0x5B, 0x8A, 0xCF, 0xBA, 0x63, 0x0F, 0xF6, 0x50,
+    0x42, 0xDA, 0x80, 0x07, 0x6D, 0x8F, 0xEC, 0x1A, 0xD8, 0x85, 0xC4, 0x81, 0xB1, 0x14, 0xF2, 0xAF,
+    0xE7, 0x89, 0x88, 0x4D, 0xA4, 0x25, 0xB5, 0x70, 0x19, 0xD2, 0x0A, 0xEE, 0x08, 0x97, 0x8E, 0xEA,
+    0x3D, 0x62, 0x11, 0x17, 0x2F, 0x1F, 0xE9, 0xF0, 0xDC, 0xC6, 0x14, 0xC8, 0x8B, 0x70, 0xE5, 0xB8,
+    0x03, 0x16, 0x87, 0x0A, 0x6A, 0x11, 0x6B, 0x44, 0xDC, 0x5A, 0xF9, 0xF4, 0x99, 0xF7, 0x9E, 0xA1,
+    0x2D, 0x28, 0x17, 0xD6, 0x74, 0x39, 0x9B, 0x5D, 0x94, 0x71, 0xB1, 0x00, 0x49, 0x71, 0x47, 0xF2,
+    0xF5, 0x5F, 0xCA, 0x9B, 0xAD, 0x11, 0x71, 0xAA, 0x4B, 0x5C, 0xE4, 0xD8, 0xE0, 0x32, 0xA9, 0xDD,
+    0x00, 0xA7, 0x0B, 0xD6, 0x55, 0x43, 0xC6, 0x1C, 0x5D, 0xE9, 0x2A, 0xB5, 0xC9, 0x72, 0xAB, 0x4B,
+    0x44, 0xE4, 0xEB, 0xEE, 0xF1, 0x07, 0xDB, 0x3B, 0xE0, 0x8E, 0x29, 0xC4, 0x9D, 0x07, 0xFD, 0x42,
+    0x0F, 0x0B, 0xD5, 0xA1, 0x5C, 0xE2, 0xC8, 0x49, 0x9B, 0xA8, 0x47, 0x5B, 0x6D, 0xC9, 0x8B, 0x29,
+    0x18, 0xE5, 0x60, 0x91, 0x55, 0xE0, 0x3D, 0xC4, 0xEF, 0x36, 0x44, 0xDF, 0x90, 0x4D, 0xB4, 0x88,
+    0xC7, 0x88, 0x38, 0x30, 0x00, 0x1E, 0xD6, 0xBE, 0x71, 0xFD, 0x4C, 0x28, 0x9A, 0xD5, 0xB3, 0x0A,
+    0x3C, 0xE1, 0xD1, 0xD1, 0x16, 0x30, 0x70, 0x62, 0xE3, 0xD0, 0x72, 0x62, 0x6C, 0x8B, 0x3F, 0x3E,
+    0x5C, 0x08, 0x27, 0xCF, 0x90, 0xCB, 0xA0, 0x45, 0x7E, 0xD4, 0x73, 0x67, 0x1E, 0x08, 0x92, 0x35,
+    0x50, 0x37, 0xC4, 0xD2, 0x52, 0x4A, 0xAB, 0xAB, 0xF2, 0x45, 0xC7, 0x6E, 0x8E, 0x7A, 0xDB, 0x91,
+    0x67, 0x95, 0x72, 0x52, 0x6C, 0x2B, 0xB9, 0x54, 0x25, 0xE2, 0x88, 0xA5, 0x22, 0x1A, 0xC6, 0xB6,
+    0x82, 0xE4, 0xB5, 0xD7, 0xA3, 0xC1, 0x88, 0x3C, 0x50, 0x4B, 0x05, 0x70, 0x1B, 0x85, 0x4F, 0xAF,
+    0xB8, 0xFC, 0xA1, 0xEA, 0xDC, 0x78, 0x7B, 0x8E, 0xC9, 0x1E, 0x90, 0x2E, 0x2F, 0x0D, 0xA0, 0x7A,
+    0x8E, 0xF5, 0xD0, 0x43, 0xD2, 0x32, 0x61, 0xAD, 0xD0, 0x55, 0x5A, 0xA5, 0x62, 0x37, 0x70, 0x89,
+    0xF8, 0xC8, 0xDD, 0xC3, 0x40, 0xA1, 0x1F, 0xB4, 0x79, 0x01, 0x67, 0xD7, 0x95, 0x03, 0x75, 0xB5,
+    0x9A, 0x00, 0xEB, 0x67, 0x55, 0x03, 0xEA, 0x6A, 0xB5, 0x71, 0xF0, 0xE1, 0x8A, 0x9D, 0x00, 0xEB,
+    0xEB, 0xB1, 0x83, 0xE4, 0xDB, 0x8D, 0xAE, 0xE0, 0x79, 0x4D, 0x7D, 0xD1, 0x6A, 0x2E, 0x47, 0xE2,
+    0x55, 0xA3, 0x9A, 0xE8, 0xFB, 0xCC, 0xC9, 0x2A, 0x30, 0x50, 0x16, 0xE4, 0x16, 0xEA, 0xEF, 0xD7,
+    0x2D, 0x50, 0x4B, 0x0B, 0x70, 0x72, 0xEC, 0x53, 0xAD, 0xA9, 0x9F, 0x64, 0x1D, 0xD5, 0xDC, 0xB5,
+    0xC8, 0xE5, 0x27, 0x76, 0xA3, 0x53, 0xAF, 0x16, 0xDB, 0xBB, 0x5B, 0x7F, 0x29, 0xFF, 0x05, 0x50,
+    0x8A, 0xC8, 0x63, 0x22, 0xF2, 0xA3, 0xCD, 0xCD, 0xCD, 0x0E, 0xD8, 0x00, 0x74, 0x01, 0xAA, 0x01,
+    0x56, 0x05, 0xC7, 0x81, 0x5C, 0x7E, 0x22, 0xD7, 0x37, 0xCF, 0x7C, 0x84, 0x9A, 0x83, 0xAE, 0xD2,
+    0xAA, 0x5E, 0xB2, 0x81, 0x4B, 0x43, 0xCD, 0xE7, 0x49, 0xAB, 0x1F, 0xB4, 0xA9, 0x35, 0x9C, 0x5D,
+    0x67, 0xAE, 0x9C, 0xBA, 0x5A, 0xA5, 0x76, 0xC2, 0xFA, 0x59, 0x16, 0x5B, 0x56, 0x5D, 0xAD, 0x52,
+    0x71, 0xAC, 0x9F, 0x65, 0x77, 0x17, 0x75, 0xC5, 0xA6, 0x2F, 0x3A, 0xD6, 0xD7, 0x99, 0x6B, 0x9B,
+    0x7C, 0xBB, 0x49, 0xED, 0x36, 0xCF, 0x6B, 0xE6, 0xCA, 0x69, 0x2E, 0xA7, 0x36, 0x3B, 0xDF, 0xA8,
+    0xE6, 0x0C, 0x67, 0x3E, 0xBC, 0xE6, 0x5F, 0x99, 0xCD, 0x66, 0xFF, 0x42, 0x44, 0xE4, 0x2B, 0xB3,
+    0xD9, 0xEC, 0x02, 0x10, 0x4B, 0xA5, 0xC5, 0xE5, 0xCC, 0x37, 0x58, 0x5F, 0x67, 0x63, 0x9D, 0x8D,
+    0x0D, 0xD6, 0x73, 0xE6, 0x5A, 0x5C, 0x1C, 0x1A, 0x38, 0x6E, 0x81, 0xCB, 0xC0, 0xBD, 0x84, 0x61,
+    0x79, 0xA8, 0x20, 0x12, 0x91, 0xA1, 0x14, 0x91, 0xFF, 0x6C, 0x73, 0xD8, 0x2C, 0x6E, 0x75, 0x46,
+    0x28, 0x00, 0xD6, 0x36, 0x37, 0x37, 0xFF, 0x54, 0x44, 0xAE, 0x8B, 0xC8, 0xC0, 0x19, 0xF2, 0xA5,
+    0xBA, 0xB1, 0x1B, 0x73, 0x0E, 0x1C, 0x89, 0x25, 0x27, 0x72, 0x64, 0x45, 0xD4, 0xAD, 0x36, 0x88,
+    0x5C, 0x11, 0x01, 0x38, 0x43, 0x29, 0x6A, 0xAF, 0x5E, 0xDB, 0x3F, 0x77, 0x11, 0x49, 0x13, 0x5F,
+    0x6A, 0x49, 0x1A, 0x74, 0xC5, 0x84, 0xE8, 0xFA, 0x8D, 0x4B, 0x57, 0xA5, 0x67, 0x93, 0xE8, 0x59,
+    0xD5, 0xA7, 0x6D, 0x56, 0x4D, 0x38, 0xCB, 0x04, 0x8C, 0xF9, 0x78, 0x6B, 0x69, 0xA0, 0x36, 0x55,
+    0x24, 0xA6, 0x3D, 0x25, 0x46, 0x24, 0x9F, 0x94, 0x7D, 0x3E, 0x89, 0x0A, 0x4C, 0x18, 0x6D, 0xB7,
+    0x5C, 0x89, 0x36, 0x37, 0x8B, 0x54, 0x64, 0x50, 0x22, 0x17, 0x1B, 0x11, 0x77, 0x4F, 0x26, 0x12,
+    0xBF, 0x2C, 0xE2, 0xEE, 0x31, 0x1F, 0x7C, 0xF0, 0x23, 0x11, 0x77, 0x8F, 0x16, 0x89, 0x1B, 0x23,
+    0xEE, 0x1E, 0x6A, 0x89, 0x1B, 0x70, 0xF7, 0x80, 0xFE, 0xB5, 0x0E, 0x00, 0xF4, 0x0F, 0x7F, 0xB9,
+    0x2C, 0x23, 0x94, 0x4D, 0x0B, 0xED, 0x22, 0xCF, 0x39, 0xE6, 0x75, 0x57, 0xEE, 0x40, 0xE2, 0xEA,
+    0x57, 0xDF, 0x3A, 0x77, 0xEE, 0x01, 0x97, 0xD8, 0x8C, 0x73, 0xD1, 0xC1, 0x0E, 0x20, 0xEB, 0xE3,
+    0xA5, 0xCF, 0x98, 0x3F, 0xCF, 0x3B, 0x4D, 0xFC, 0x2A, 0xE9, 0x39, 0xEE, 0x79, 0x9E, 0xEB, 0x2E,
+    0x79, 0xF1, 0xC6, 0x22, 0x0E, 0x9C, 0xF1, 0x32, 0xDC, 0x4D, 0xE2, 0x61, 0x83, 0xDC, 0xC3, 0x9C,
+    0xC5, 0x39, 0x22, 0xC7, 0x17, 0xCF, 0xA1, 0x5A, 0x38, 0x47, 0x6A, 0xE1, 0x1C, 0xBA, 0x80, 0x73,
+    0xE4, 0xC0, 0x39, 0xCE, 0x01, 0xE7, 0xE8, 0xA3, 0x82, 0x73, 0xB1, 0x4B, 0x5B, 0xCE, 0xA9, 0x46,
+    0xB7, 0x9C, 0xD3, 0x95, 0x69, 0x39, 0x97, 0xF1, 0xBF, 0xB6, 0x9C, 0x98, 0x44, 0xEF, 0xB4, 0x30,
+    0x57, 0x57, 0x5A, 0xE8, 0xD2, 0x07, 0x5B, 0x54, 0x7B, 0xB7, 0x6A, 0x49, 0xEC, 0x86, 0x6A, 0xD1,
+    0x45, 0x2D, 0x4B, 0x72, 0x4A, 0x19, 0x38, 0x07, 0xAA, 0xA5, 0x07, 0xD5, 0x46, 0x0E, 0x54, 0xCB,
+    0x36, 0xDC, 0x0D, 0x75, 0x85, 0x2E, 0xA2, 0x30, 0x69, 0xF4, 0x3D, 0x89, 0xE5, 0xC4, 0x04, 0xD5,
+    0x82, 0xAE, 0xE2, 0x70, 0x5E, 0x07, 0xF4, 0xCC, 0x81, 0x09, 0xE7, 0x00, 0x5D, 0x4D, 0xA2, 0x67,
+    0x50, 0x6D, 0xAE, 0xC5, 0xD2, 0xEB, 0x87, 0xFF, 0xC6, 0x33, 0xD1, 0x55, 0x95, 0xA1, 0xBF, 0x63,
+    0x51, 0x4D, 0xF4, 0x60, 0x4B, 0xE4, 0x88, 0x1D, 0x5C, 0x86, 0x0E, 0xCE, 0x41, 0x0F, 0xDB, 0x70,
+    0x0E, 0xB6, 0x61, 0x03, 0xB6, 0x21, 0x87, 0x6D, 0xC8, 0x60, 0x1B, 0x74, 0x85, 0x11, 0x97, 0x58,
+    0xB4, 0xF8, 0x91, 0x09, 0xD4, 0x1D, 0xE8, 0xC2, 0x48, 0x4B, 0xEC, 0xE2, 0x2A, 0x0F, 0xCC, 0xC2,
+    0xA1, 0x2B, 0xC8, 0x18, 0x9F, 0x7F, 0x03, 0xCA, 0x9E, 0xD4, 0x92, 0x48, 0x15, 0x75, 0xC0, 0x16,
+    0x13, 0x80, 0x3E, 0xB1, 0x27, 0x41, 0x57, 0x5D, 0xD2, 0x42, 0x97, 0xB3, 0x4C, 0x77, 0xCA, 0xC4,
+    0xE6, 0x6D, 0x29, 0x4D, 0x9F, 0xFC, 0x5B, 0x1E, 0xDF, 0xC9, 0x79, 0xA7, 0x05, 0xD5, 0x6C, 0x4C,
+    0x80, 0xCB, 0xE9, 0xF9, 0x16, 0x32, 0xDC, 0x04, 0x54, 0xBB, 0xA1, 0x1C, 0xCC, 0x13, 0x91, 0x16,
+    0x5D, 0x18, 0x59, 0xA2, 0x5A, 0x98, 0x30, 0x52, 0x4F, 0x17, 0x84, 0x5B, 0x80, 0x81, 0xB4, 0x83,
+    0xBA, 0x40, 0x39, 0xB8, 0x6D, 0xC5, 0xBC, 0x88, 0x5B, 0xB8, 0x17, 0x54, 0x0B, 0x0B, 0xC8, 0x2C,
+    0xA9, 0x23, 0xF6, 0x50, 0x43, 0x66, 0x51, 0x0E, 0x26, 0xAC, 0x2E, 0xAA, 0x1C, 0xB7, 0xE5, 0xAF,
+    0x9F, 0x6A, 0x6A, 0x91, 0x58, 0xA4, 0x60, 0x13, 0xA2, 0x22, 0x2A, 0x40, 0xAA, 0xB3, 0x60, 0xE4,
+    0x12, 0xA8, 0x17, 0xA4, 0x85, 0x6F, 0x45, 0xCF, 0x70, 0x64, 0x51, 0x0E, 0xC0, 0x54, 0x40, 0xEA,
+    0x01, 0xA4, 0x01, 0xB2, 0x29, 0xA0, 0xDE, 0x76, 0xC0, 0x24, 0x2B, 0x20, 0x6D, 0x3C, 0xE0, 0xD3,
+    0x06, 0xB2, 0x6A, 0x0A, 0xB1, 0x53, 0x0E, 0x0C, 0x79, 0x41, 0xDA, 0xE0, 0xC1, 0xA3, 0x2D, 0x99,
+    0xC8, 0x92, 0x58, 0x44, 0x1C, 0x66, 0x36, 0xAB, 0x8B, 0xA4, 0x25, 0xEA, 0x83, 0x98, 0x91, 0x59,
+    0xD8, 0x8D, 0x3B, 0x50, 0xCE, 0x00, 0xE6, 0x4F, 0x5B, 0x88, 0x7A, 0xBF, 0x9A, 0x3B, 0x59, 0xDD,
+    0x3E, 0xFE, 0x1B, 0x07, 0xAC, 0xA7, 0x80, 0xAA, 0x9E, 0x07, 0xD6, 0x35, 0x10, 0x49, 0x0B, 0x24,
+    0x3D, 0x40, 0x6D, 0x01, 0x3D, 0x00, 0xD1, 0xAF, 0x5A, 0xC0, 0xE4, 0x80, 0xFA, 0x69, 0x07, 0x2C,
+    0xB4, 0x05, 0x6D, 0x17, 0x10, 0xF5, 0x49, 0x0B, 0x39, 0x06, 0x94, 0x8B, 0x3B, 0x58, 0xA0, 0x2D,
+    0xDA, 0xE2, 0x89, 0x44, 0xA4, 0x25, 0x17, 0x11, 0xD4, 0x8D, 0xD9, 0xC5, 0x8E, 0x29, 0x64, 0x95,
+    0xB6, 0xE0, 0x23, 0x0F, 0x69, 0x9B, 0x17, 0xA3, 0x4C, 0xA0, 0xBA, 0x29, 0x90, 0x3D, 0x65, 0xC3,
+    0xEC, 0x4F, 0x2D, 0x22, 0x45, 0x98, 0x8D, 0x1A, 0x30, 0x22, 0xD2, 0x41, 0x76, 0xDE, 0x01, 0xE8,
+    0xC6, 0x03, 0x24, 0xCE, 0x00, 0xC4, 0x5D, 0xA8, 0x95, 0x0F, 0xD4, 0x5D, 0xE0, 0x43, 0x43, 0x1B,
+    0x80, 0xBC, 0xD0, 0xD7, 0x66, 0x17, 0xD0, 0x56, 0x89, 0xF4, 0xA4, 0x0D, 0x22, 0x4B, 0x94, 0xC3,
+    0x00, 0xF1, 0x28, 0xFB, 0x88, 0x88, 0x03, 0xCA, 0xD9, 0xCC, 0x87, 0x1E, 0x62, 0x80, 0xAC, 0x22,
+    0x54, 0x10, 0xE5, 0x82, 0x00, 0xE0, 0x41, 0x75, 0x60, 0x66, 0xB3, 0x27, 0x3D, 0x68, 0x91, 0x6E,
+    0x00, 0x25, 0x32, 0x24, 0xB2, 0xDC, 0x81, 0x5A, 0xA4, 0x25, 0x15, 0x91, 0x86, 0x05, 0xB1, 0x14,
+    0x69, 0x43, 0xEC, 0x59, 0x80, 0x76, 0x69, 0x03, 0xA6, 0x58, 0x40, 0xDC, 0xA7, 0x0D, 0x64, 0x76,
+    0x01, 0xF8, 0xB4, 0x05, 0xFD, 0x92, 0x48, 0xC3, 0x20, 0x32, 0xA0, 0xFF, 0x6F, 0x99, 0x55, 0xA1,
+    0xD5, 0x03, 0x55, 0x7D, 0xDA, 0x40, 0x5E, 0x2D, 0x40, 0x75, 0x69, 0x03, 0xC2, 0x02, 0x72, 0x9B,
+    0x36, 0x64, 0x1D, 0xF5, 0xAC, 0x1E, 0x48, 0x45, 0x96, 0x50, 0xCB, 0x1E, 0x10, 0x9D, 0x8E, 0x2A,
+    0xA8, 0x9B, 0x75, 0xC8, 0xE4, 0xAD, 0x0A, 0x65, 0x6B, 0x07, 0xF7, 0x73, 0xF9, 0x68, 0x0F, 0xDC,
+    0x92, 0x1D, 0x28, 0x45, 0x1A, 0xF2, 0xE5, 0xA3, 0x52, 0x25, 0x3D, 0xF1, 0xC0, 0x12, 0x12, 0x97,
+    0x5B, 0xC8, 0xCF, 0x3B, 0xC0, 0x97, 0x80, 0xFE, 0x49, 0x0B, 0xEC, 0x0E, 0x40, 0x22, 0x0D, 0x60,
+    0x3C, 0xA0, 0xC4, 0x02, 0x66, 0x00, 0x94, 0x34, 0x40, 0xB9, 0x0B, 0xA4, 0x6F, 0x3A, 0x60, 0x30,
+    0x80, 0xBE, 0xD2, 0x43, 0xDC, 0x67, 0x0D, 0x94, 0xD4, 0x15, 0x59, 0x1B, 0xCB, 0xD3, 0x5B, 0xFD,
+    0xF8, 0xA8, 0xA9, 0x2C, 0x01, 0x4E, 0x87, 0x67, 0xD9, 0x21, 0xFA, 0x61, 0x43, 0xF6, 0x54, 0x13,
+    0x79, 0xDD, 0x64, 0x56, 0xFF, 0xC8, 0xA3, 0xDF, 0xB2, 0x68, 0x0F, 0x79, 0x4B, 0x24, 0x0D, 0xD9,
+    0x4B, 0x87, 0xBF, 0x7B, 0xC5, 0xA2, 0x8B, 0x71, 0xD0, 0xFE, 0x01, 0x6C, 0xC9, 0x3F, 0xEF, 0x28,
+    0x45, 0x84, 0x7C, 0xF9, 0xA8, 0xD8, 0xA4, 0x47, 0x0D, 0x2C, 0xC1, 0xB8, 0xDC, 0xA2, 0xE5, 0xBC,
+    0x23, 0xEE, 0x7C, 0x09, 0x53, 0xFD, 0x93, 0x16, 0x6D, 0x77, 0x07, 0x62, 0x97, 0x48, 0xC3, 0x36,
+    0xC6, 0xA3, 0xAD, 0x12, 0xAB, 0x1C, 0x66, 0x60, 0x81, 0x92, 0x26, 0xAB, 0x28, 0x77, 0x95, 0x23,
+    0x7D, 0xD3, 0x2D, 0x60, 0x30, 0x59, 0x85, 0xBE, 0x22, 0x8E, 0xB8, 0xCF, 0xFC, 0x7E, 0x55, 0x12,
+    0x79, 0x7A, 0xAB, 0x47, 0x44, 0x96, 0xE4, 0x0F, 0xC9, 0x12, 0x2E, 0xAC, 0xAA, 0x02, 0x10, 0x5F,
+    0x00, 0x72, 0x0B, 0xD1, 0xFE, 0x48, 0x9B, 0x03, 0xAA, 0x3A, 0x44, 0xFE, 0x05, 0x44, 0x7B, 0x1E,
+    0xF4, 0x95, 0x0E, 0x76, 0x95, 0x43, 0xB9, 0xB4, 0x25, 0xAF, 0xB4, 0xC5, 0x93, 0x57, 0x69, 0x13,
+    0xFA, 0xED, 0xAE, 0xEA, 0xC0, 0x67, 0x96, 0xA8, 0x1F, 0x40, 0xBD, 0xDB, 0x42, 0x22, 0x80, 0xEE,
+    0x81, 0xCC, 0x72, 0x20, 0x25, 0x1F, 0x15, 0x89, 0x6F, 0x51, 0x34, 0x1F, 0x0B, 0x57, 0xEB, 0x72,
+    0xB6, 0x83, 0x88, 0x14, 0x22, 0xD2, 0x7A, 0xB2, 0xCE, 0x13, 0x7B, 0x0F, 0x83, 0x87, 0xC5, 0xA1,
+    0xD5, 0x87, 0xF2, 0xB4, 0x93, 0x8B, 0xD2, 0x84, 0xF3, 0x77, 0x8E, 0x5C, 0x67, 0xB5, 0xB2, 0x76,
+    0x06, 0x32, 0xE9, 0x49, 0x45, 0xBA, 0x78, 0x60, 0xCB, 0x9A, 0x82, 0x41, 0x39, 0xD2, 0xC6, 0xC0,
+    0x42, 0x39, 0x32, 0x6B, 0x48, 0x9C, 0x72, 0xB1, 0xC7, 0x50, 0xA3, 0x9C, 0xB6, 0x18, 0x3C, 0xCA,
+    0xE9, 0x06, 0x43, 0x59, 0x29, 0x17, 0x0B, 0x86, 0x64, 0x50, 0x8E, 0xB4, 0x33, 0x90, 0x5F, 0x71,
+    0xB0, 0x30, 0x90, 0xBC, 0xE6, 0x60, 0xDB, 0x40, 0xFA, 0xB2, 0xBB, 0x1C, 0x7B, 0x93, 0x8A, 0x3C,
+    0xE8, 0x72, 0x69, 0x60, 0xAD, 0x80, 0x13, 0x7C, 0x31, 0x59, 0xC6, 0x8D, 0x91, 0x4B, 0x51, 0x5B,
+    0x76, 0x29, 0x77, 0x15, 0x2B, 0x32, 0x67, 0xD2, 0x24, 0x22, 0xAD, 0xFE, 0x97, 0x5B, 0xCD, 0x1D,
+    0xE4, 0x41, 0x2E, 0xC4, 0x83, 0x72, 0x3C, 0x5E, 0xDB, 0x5A, 0x44, 0xDF, 0xD8, 0xF4, 0x4B, 0xD4,
+    0xAF, 0x1C, 0xFA, 0xD5, 0x0A, 0x33, 0x25, 0x1A, 0x3C, 0xFA, 0x9D, 0x3E, 0x96, 0xAB, 0x22, 0x8F,
+    0x25, 0xD2, 0x9E, 0x63, 0x25, 0xD8, 0x9A, 0x16, 0xF5, 0x66, 0xCB, 0xED, 0xCA, 0xF2, 0x2D, 0x0D,
+    0xEE, 0x1C, 0xB1, 0x34, 0x44, 0x07, 0xE3, 0x2A, 0x91, 0x2E, 0x12, 0xE9, 0xD5, 0x1B, 0xA7, 0xBA,
+    0xDB, 0x48, 0xDB, 0x40, 0xFA, 0x70, 0xC3, 0xBB, 0x2E, 0xB9, 0x5C, 0xE4, 0xCA, 0xF2, 0xE9, 0xD2,
+    0x54, 0x0C, 0x1E, 0xF5, 0xAB, 0x16, 0xFD, 0x6A, 0x45, 0x59, 0xA2, 0xFC, 0x92, 0xFA, 0x17, 0x22,
+    0xAF, 0xBC, 0x20, 0x7D, 0x36, 0x4A, 0xE6, 0x41, 0x8C, 0xEE, 0x62, 0x69, 0x10, 0xF1, 0xA5, 0xB4,
+    0xF1, 0xDE, 0x1F, 0xBE, 0xDB, 0x65, 0x6D, 0x84, 0x12, 0xB4, 0x85, 0xB4, 0x23, 0xAB, 0x20, 0xB3,
+    0x18, 0xA0, 0x04, 0xCF, 0xE7, 0x2E, 0x2E, 0x67, 0x17, 0x5D, 0x1A, 0x14, 0x39, 0xF9, 0xFE, 0xD6,
+    0xB5, 0xD9, 0x4C, 0xB7, 0x4C, 0x81, 0x92, 0xC8, 0x43, 0xD4, 0x93, 0x3A, 0x48, 0x5A, 0x4C, 0x0B,
+    0x99, 0x8D, 0xA5, 0x01, 0x53, 0x95, 0x8F, 0xBD, 0xFE, 0xB9, 0xA6, 0x94, 0x2E, 0x13, 0x29, 0xCA,
+    0x25, 0x99, 0x74, 0xAC, 0x15, 0x44, 0xA7, 0xC3, 0xF0, 0x8A, 0xBA, 0xC4, 0x92, 0xFF, 0x8D, 0x87,
+    0x72, 0x49, 0xD0, 0x82, 0x64, 0x80, 0xF2, 0x3B, 0x0E, 0x55, 0x65, 0x76, 0x54, 0x2A, 0x95, 0xE3,
+    0xF8, 0xCF, 0xF2, 0x42, 0xCB, 0xD0, 0x2B, 0xB9, 0x24, 0x76, 0x49, 0xEA, 0x33, 0x4B, 0x7E, 0xA5,
+    0x0B, 0xCC, 0x20, 0x7D, 0x79, 0x6C, 0xC6, 0xF4, 0x65, 0x07, 0xDE, 0x80, 0x7E, 0xB1, 0x27, 0xEA,
+    0xC7, 0x66, 0xCF, 0xDA, 0x48, 0xA4, 0x27, 0x96, 0xBD, 0x91, 0x25, 0x9C, 0xE4, 0x4E, 0xD2, 0x41,
+    0xD9, 0x48, 0x96, 0x3D, 0xF7, 0xA4, 0x42, 0x5C, 0xA5, 0x87, 0x06, 0x4F, 0x2C, 0x3D, 0x91, 0x48,
+    0x87, 0xF9, 0x71, 0xD9, 0xE8, 0x96, 0x32, 0xF2, 0xC4, 0x7D, 0x5E, 0xA0, 0xAF, 0xAC, 0x2E, 0x7F,
+    0xE4, 0x86, 0x83, 0x01, 0xFD, 0xE2, 0x38, 0x90, 0xF2, 0x6A, 0x49, 0xE2, 0xD4, 0xDE, 0xB1, 0x81,
+    0x4C, 0xA4, 0x20, 0x97, 0x0A, 0xD6, 0x00, 0x8A, 0xB1, 0x23, 0x97, 0xA3, 0x8A, 0x1C, 0xED, 0xEC,
+    0xDF, 0xF1, 0x90, 0x88, 0xBF, 0xB9, 0x59, 0x1C, 0x99, 0xC5, 0xA3, 0x61, 0xFC, 0x49, 0x78, 0xC2,
+    0x35, 0x62, 0xE9, 0x7A, 0x44, 0x64, 0x7C, 0xBA, 0x48, 0x22, 0x8F, 0xE9, 0xF2, 0x22, 0x7D, 0xF5,
+    0x8A, 0x8B, 0x3A, 0x6F, 0x98, 0xE8, 0x97, 0x9D, 0xB6, 0x0B, 0x13, 0x77, 0xE9, 0xCB, 0x6E, 0xCA,
+    0x60, 0xB4, 0xD5, 0x2F, 0xFE, 0xD2, 0xE1, 0xB3, 0x81, 0xBC, 0x92, 0x2A, 0x71, 0xC9, 0x70, 0x6C,
+    0xA0, 0x16, 0x29, 0xB2, 0x4B, 0x52, 0xF1, 0xC4, 0xDA, 0xFE, 0x0D, 0x8F, 0x57, 0x84, 0x46, 0x1C,
+    0xB5, 0xF7, 0xD8, 0x01, 0xEE, 0x08, 0x57, 0xC9, 0xBE, 0x57, 0x91, 0xBE, 0xEC, 0x50, 0x6E, 0x41,
+    0xD4, 0x6B, 0xCB, 0x42, 0x39, 0x0C, 0x53, 0xB2, 0x4A, 0x5B, 0x6D, 0xE3, 0x4E, 0x39, 0x26, 0x71,
+    0x87, 0xB6, 0x9E, 0xA8, 0x9B, 0x80, 0xC9, 0x0B, 0xD2, 0x97, 0x2C, 0xBC, 0xDB, 0x82, 0x71, 0x90,
+    0x78, 0x60, 0x60, 0x7F, 0xF6, 0x23, 0x6D, 0x46, 0x7B, 0x41, 0x47, 0xF4, 0x68, 0x0F, 0xB5, 0x87,
+    0xBC, 0x1B, 0x95, 0xA9, 0x95, 0x31, 0x81, 0x71, 0xCA, 0xBC, 0xA9, 0x20, 0x95, 0x4A, 0x7F, 0x4F,
+    0xBC, 0x92, 0xA7, 0x6B, 0x2B, 0x85, 0xEA, 0x4D, 0x85, 0xD1, 0x16, 0xFD, 0xB2, 0x0B, 0x56, 0x82,
+    0xA9, 0x09, 0x73, 0x7D, 0xF2, 0x9A, 0x0B, 0x92, 0xC9, 0xC2, 0x80, 0x79, 0xB8, 0x45, 0x5F, 0xF1,
+    0xE8, 0x56, 0xDA, 0xCC, 0x4D, 0x6A, 0x71, 0xFA, 0x3B, 0xD2, 0x2A, 0xB7, 0xF6, 0x7E, 0x77, 0xD9,
+    0x17, 0x68, 0xEE, 0x88, 0xC0, 0xC4, 0x0E, 0x6D, 0x3D, 0x71, 0x73, 0xF7, 0x91, 0x19, 0x2F, 0xEE,
+    0x60, 0x3A, 0x85, 0xFC, 0x61, 0x8B, 0x7E, 0xB1, 0x23, 0x69, 0x4D, 0x10, 0x19, 0x7C, 0xD4, 0x33,
+    0xC5, 0x60, 0x48, 0x1B, 0x6D, 0xE9, 0xD3, 0x06, 0xA3, 0x1C, 0x49, 0xD3, 0x83, 0x5F, 0x40, 0x6E,
+    0x40, 0xBD, 0x55, 0x81, 0x58, 0xC8, 0x02, 0x21, 0xC2, 0x8D, 0xA7, 0x87, 0x2C, 0x2A, 0xBA, 0x61,
+    0x6D, 0xAB, 0x25, 0x16, 0x07, 0x75, 0x03, 0x70, 0x7C, 0xF6, 0x03, 0x88, 0x44, 0x5A, 0xC8, 0x64,
+    0xF8, 0xBD, 0x13, 0x00, 0xA3, 0xD9, 0xAC, 0x4A, 0x45, 0x8A, 0x6C, 0x5F, 0x68, 0x27, 0x92, 0x81,
+    0x52, 0x96, 0xEC, 0xFD, 0xBD, 0x21, 0x22, 0xEE, 0xC3, 0x63, 0x06, 0x2E, 0x76, 0xEC, 0xA2, 0x4F,
+    0x45, 0x9C, 0x7C, 0xFF, 0xB1, 0x97, 0x5A, 0x4C, 0x09, 0x43, 0x8F, 0xFA, 0x55, 0x4B, 0xF6, 0xAA,
+    0x45, 0x4C, 0x95, 0xFB, 0x52, 0xAE, 0xBB, 0x72, 0x99, 0xD8, 0xB5, 0x02, 0xEE, 0xE4, 0x33, 0x10,
+    0xB5, 0x71, 0x0B, 0xFA, 0x9A, 0x07, 0x4A, 0x29, 0x80, 0x7F, 0x5B, 0xFD, 0xDE, 0x11, 0x21, 0xAE,
+    0xD8, 0x49, 0x0B, 0x5D, 0x64, 0xD7, 0x3C, 0xB9, 0x58, 0xD2, 0xD7, 0xF9, 0xC4, 0xE7, 0x0E, 0x03,
+    0xA0, 0x7E, 0xC7, 0x62, 0x34, 0x19, 0x80, 0xB2, 0x8C, 0xC6, 0x1B, 0x34, 0x07, 0x87, 0x7F, 0x0B,
+    0x50, 0x36, 0x07, 0x22, 0x59, 0x29, 0x45, 0x22, 0xD2, 0xAA, 0x37, 0x4E, 0x75, 0xA1, 0x23, 0x1C,
+    0x9A, 0xEA, 0x8F, 0x5D, 0xF4, 0xB1, 0x88, 0xD7, 0x37, 0x36, 0xBD, 0xA9, 0xF0, 0x25, 0xF8, 0x29,
+    0xF8, 0x29, 0x91, 0x2F, 0x51, 0xDE, 0x54, 0xB9, 0xCF, 0x64, 0x38, 0x97, 0x48, 0x7B, 0x8E, 0x93,
+    0x5C, 0x0E, 0x2A, 0x55, 0x62, 0x83, 0x6D, 0x34, 0xB5, 0x90, 0xDC, 0x80, 0x58, 0x80, 0x13, 0xC0,
+    0x0F, 0x08, 0x2C, 0x0D, 0x53, 0x8C, 0x03, 0x2B, 0x2B, 0x56, 0xCF, 0x75, 0xC0, 0xF0, 0x97, 0x05,
+    0xB5, 0x88, 0xCD, 0x96, 0xB3, 0x01, 0x29, 0xF8, 0xA6, 0x76, 0x40, 0xCD, 0xEA, 0x17, 0x16, 0xD8,
+    0x5D, 0x7D, 0xD2, 0xCD, 0x11, 0x19, 0x68, 0xBF, 0x28, 0xAF, 0xC2, 0x54, 0x19, 0x98, 0x9B, 0xF2,
+    0x2B, 0xDD, 0x26, 0xED, 0x81, 0x74, 0xB9, 0xB9, 0x45, 0x2A, 0xE2, 0x89, 0x45, 0x5A, 0x38, 0x59,
+    0x04, 0x76, 0x1B, 0x7B, 0x28, 0x41, 0x5B, 0x62, 0x07, 0xF7, 0x1F, 0xEA, 0x1C, 0x3B, 0x99, 0x2C,
+    0xD5, 0xF2, 0x1F, 0x34, 0x4B, 0xC8, 0x2C, 0x71, 0x47, 0x68, 0xAF, 0xF7, 0xEC, 0x0A, 0x22, 0x0F,
+    0xBA, 0x85, 0xB2, 0xF9, 0x2F, 0x23, 0x91, 0x36, 0x96, 0x21, 0x90, 0xF9, 0x2B, 0x8C, 0x74, 0xC8,
+    0x96, 0x04, 0x4E, 0xA3, 0xAB, 0x05, 0x3C, 0xCF, 0xB9, 0xDF, 0x7D, 0xDD, 0xE3, 0x0B, 0x60, 0x5A,
+    0x62, 0x09, 0x72, 0x79, 0x9F, 0x5A, 0x5D, 0x24, 0xD5, 0xA1, 0xDA, 0x27, 0x22, 0x95, 0x79, 0xE3,
+    0xDF, 0xA8, 0x3E, 0x3C, 0xC2, 0xE2, 0x30, 0xAF, 0x58, 0x0D, 0x93, 0xF0, 0xB1, 0x08, 0x77, 0x5E,
+    0x42, 0x24, 0x0F, 0x9C, 0x8D, 0x44, 0x5A, 0x6A, 0x29, 0xC2, 0x9C, 0xFB, 0x99, 0x23, 0x8F, 0x9A,
+    0x5A, 0x6E, 0x5E, 0x6A, 0xD9, 0x21, 0x17, 0x71, 0x89, 0xCC, 0xEA, 0xC2, 0x34, 0xDC, 0xA9, 0xFC,
+    0x28, 0x5C, 0x33, 0x10, 0x26, 0xC2, 0x50, 0xB9, 0x61, 0xBF, 0xBE, 0xFB, 0x22, 0xF0, 0x7E, 0x51,
+    0xDA, 0xEE, 0x4B, 0xCB, 0x05, 0x20, 0x40, 0xB4, 0x04, 0xE2, 0x25, 0x10, 0xCB, 0xD3, 0x8F, 0xDA,
+    0x58, 0x44, 0xA0, 0x96, 0x1E, 0xD6, 0x4E, 0x43, 0x54, 0x1D, 0x6E, 0x46, 0x0E, 0xC9, 0x01, 0x7B,
+    0x91, 0x48, 0x6B, 0xDE, 0xF8, 0x37, 0xBA, 0x25, 0xF2, 0x90, 0x17, 0xB7, 0x6A, 0xF2, 0x70, 0xDB,
+    0xCC, 0xC2, 0x12, 0x92, 0x61, 0xAD, 0xCD, 0x64, 0x49, 0x2E, 0x0D, 0x6B, 0xF0, 0x65, 0x8E, 0xC3,
+    0x36, 0x3D, 0x4C, 0xB3, 0x0A, 0x76, 0xFD, 0x8A, 0x2B, 0x0C, 0xBF, 0xFB, 0x1E, 0x1F, 0x57, 0x5C,
+    0x48, 0x9B, 0xAC, 0x4A, 0xFF, 0xB2, 0x47, 0xBF, 0x55, 0xA1, 0xFD, 0x78, 0xA7, 0x4F, 0xB4, 0xD5,
+    0xA3, 0x1D, 0xFE, 0x0C, 0xFA, 0xD8, 0x81, 0xD1, 0x16, 0x32, 0x01, 0x92, 0x01, 0x02, 0xA3, 0x39,
+    0xD4, 0xF4, 0x3F, 0x03, 0x11, 0x69, 0x11, 0x91, 0x01, 0x4F, 0x2C, 0x85, 0x87, 0xBC, 0xF1, 0x90,
+    0x3A, 0x0F, 0xAA, 0xF3, 0x10, 0xF7, 0x1E, 0x22, 0xEF, 0x09, 0x8E, 0x84, 0xB0, 0x19, 0xF6, 0x37,
+    0xFB, 0x65, 0x91, 0x5F, 0x9D, 0xAC, 0x3A, 0x0F, 0xDA, 0x79, 0xC8, 0xAD, 0x27, 0x92, 0x62, 0x39,
+    0xAB, 0x87, 0xD5, 0x8D, 0xF6, 0x82, 0x9D, 0x36, 0x3A, 0x0D, 0x51, 0x6F, 0x80, 0xEC, 0x3B, 0x0D,
+    0x44, 0xFD, 0x39, 0x20, 0xFB, 0x6E, 0x01, 0x51, 0xEF, 0x46, 0xB1, 0x88, 0xA8, 0x87, 0x7C, 0xD0,
+    0x15, 0xB9, 0xF8, 0x9E, 0x64, 0xEF, 0x1B, 0x52, 0xB1, 0x24, 0xED, 0xC9, 0x2C, 0xA6, 0x52, 0x1D,
+    0x71, 0x8F, 0x81, 0xAC, 0x52, 0x8E, 0xE8, 0xE0, 0x90, 0xA3, 0xA5, 0x05, 0x79, 0x15, 0xF7, 0xA8,
+    0x1E, 0xDD, 0x50, 0x57, 0xD4, 0xD5, 0x56, 0x4F, 0x2C, 0xF2, 0x52, 0x45, 0x22, 0x6D, 0x0F, 0x51,
+    0x01, 0xFC, 0x5E, 0x98, 0x16, 0x46, 0x41, 0x39, 0xAB, 0xC2, 0x26, 0xDA, 0xDC, 0xFA, 0x2B, 0x12,
+    0x11, 0x1F, 0x36, 0x07, 0x5F, 0xE4, 0x43, 0x56, 0x45, 0x22, 0x4F, 0x55, 0xC9, 0xF0, 0xA8, 0x54,
+    0xBA, 0x45, 0xAA, 0xCC, 0x62, 0x2A, 0x53, 0x90, 0x57, 0x06, 0xB2, 0xA3, 0x1B, 0x7D, 0xF8, 0x63,
+    0x41, 0x5E, 0xE5, 0x15, 0xA6, 0xD2, 0x0D, 0x75, 0x95, 0xF6, 0xC7, 0xA4, 0x0A, 0xC4, 0x28, 0x97,
+    0xBA, 0x22, 0x2A, 0xE0, 0xD8, 0x6C, 0x86, 0x88, 0x4B, 0x83, 0x61, 0x1C, 0x48, 0x45, 0x06, 0x11,
+    0x79, 0x4B, 0x64, 0x78, 0xAF, 0x8F, 0x6D, 0xDC, 0xDD, 0x98, 0x3D, 0x2B, 0x22, 0x2F, 0x89, 0xF8,
+    0xF7, 0x3D, 0xC5, 0xC2, 0x72, 0x36, 0xFB, 0x9E, 0xC8, 0x52, 0x44, 0xDA, 0x68, 0x36, 0xAB, 0x28,
+    0xA5, 0x3B, 0x2A, 0xBA, 0xA5, 0xB2, 0x83, 0x96, 0x25, 0xFA, 0xF5, 0xAD, 0x56, 0x37, 0xF8, 0xA4,
+    0x25, 0xFF, 0x76, 0x87, 0x72, 0x1E, 0xBC, 0x99, 0xCD, 0x6A, 0x2D, 0x22, 0x57, 0x6E, 0xCC, 0x66,
+    0x17, 0xF6, 0xE5, 0xD2, 0x66, 0xB4, 0x03, 0x98, 0x0A, 0x92, 0xE1, 0x81, 0xFF, 0x9A, 0x52, 0xA4,
+    0x88, 0x45, 0x0A, 0xA2, 0xD3, 0x1C, 0xE7, 0x18, 0x0E, 0x97, 0x5C, 0xDB, 0x25, 0x17, 0xCB, 0xD6,
+    0xCE, 0x6F, 0xB5, 0x4A, 0x15, 0x3B, 0x5C, 0xE6, 0x79, 0xF4, 0x35, 0x4F, 0x24, 0x1E, 0x8E, 0xBF,
+    0x7E, 0x78, 0xBC, 0xED, 0x81, 0x48, 0xCB, 0xF2, 0xEF, 0x2D, 0x19, 0xD0, 0x76, 0x1A, 0x94, 0x2A,
+    0xA3, 0x2D, 0xFA, 0xCA, 0x8D, 0xD9, 0x45, 0x27, 0x22, 0xDE, 0xCC, 0x66, 0xB3, 0x7D, 0xD9, 0x7B,
+    0x18, 0x39, 0x91, 0xEA, 0x81, 0xF2, 0xAF, 0x3E, 0xD7, 0x24, 0x22, 0x1D, 0xB9, 0x74, 0x41, 0x35,
+    0x38, 0x36, 0x0E, 0x11, 0x7B, 0x74, 0x3A, 0xFF, 0xAD, 0xD4, 0x0D, 0xAA, 0xF7, 0x28, 0x03, 0xBF,
+    0xC5, 0xBA, 0xD5, 0x22, 0xAF, 0x86, 0x3B, 0xBF, 0xFA, 0x7E, 0x0F, 0x27, 0xB3, 0xD9, 0x53, 0x22,
+    0x5E, 0x44, 0x5E, 0x7A, 0xBF, 0x53, 0x3C, 0xE8, 0x6B, 0xB3, 0x1F, 0x04, 0x62, 0x2C, 0x21, 0x0B,
+    0x02, 0xDA, 0xE5, 0xE0, 0x67, 0xEB, 0x40, 0xFF, 0x2C, 0x88, 0x65, 0xA7, 0x3F, 0xE9, 0xCE, 0x67,
+    0x89, 0x1E, 0xAD, 0x82, 0x54, 0xA6, 0x1A, 0x88, 0x1C, 0x04, 0xD7, 0xC0, 0xDF, 0x8E, 0x22, 0xC9,
+    0x1A, 0x9F, 0xE1, 0x58, 0xE1, 0xE3, 0x4E, 0xB9, 0x05, 0x5A, 0x0A, 0xCA, 0x96, 0xA8, 0x3F, 0x60,
+    0xCD, 0x9F, 0x7C, 0xF5, 0xE3, 0x8A, 0x0B, 0x2C, 0xA2, 0x9E, 0xF4, 0x47, 0x3D, 0xEC, 0xF6, 0xA0,
+    0xF7, 0x4D, 0x4B, 0xE3, 0x92, 0x2F, 0x0B, 0x8C, 0xF4, 0x98, 0x7F, 0x5E, 0x57, 0xA6, 0x50, 0x2E,
+    0xAB, 0xD8, 0x4D, 0x1B, 0xF4, 0x15, 0x87, 0x72, 0xCB, 0xD9, 0xCC, 0x1B, 0x11, 0xD1, 0xD7, 0x66,
+    0xB3, 0xF3, 0xFB, 0x9A, 0x61, 0x31, 0xCA, 0x08, 0x4B, 0x20, 0xBB, 0xBE, 0xF6, 0x7C, 0x24, 0x32,
+    0x90, 0xCA, 0x10, 0x0C, 0x47, 0x1C, 0xAF, 0x80, 0xBC, 0x1D, 0x1D, 0x16, 0x51, 0x3F, 0x40, 0xD2,
+    0xE6, 0x05, 0xBA, 0x48, 0x0E, 0x77, 0xA1, 0xA8, 0x96, 0x1D, 0x32, 0x91, 0x01, 0xB9, 0x71, 0xD1,
+    0xAB, 0x25, 0x7C, 0x49, 0xEF, 0x4F, 0xC3, 0x66, 0x7F, 0x96, 0xDD, 0x5D, 0x4D, 0xB5, 0x61, 0xE3,
+    0x61, 0xF6, 0x03, 0x4F, 0x24, 0xE2, 0x89, 0x44, 0x86, 0x95, 0x95, 0xD4, 0x94, 0x80, 0x31, 0x05,
+    0x98, 0xDC, 0x82, 0xD1, 0x2D, 0x98, 0xC4, 0x83, 0x89, 0xE5, 0x8D, 0x47, 0x24, 0x98, 0x32, 0x13,
+    0x91, 0xD7, 0x47, 0x61, 0xE4, 0x19, 0x88, 0x04, 0x10, 0x37, 0x8A, 0xDA, 0x49, 0xCB, 0x59, 0xEE,
+    0x39, 0x44, 0x97, 0x21, 0xAD, 0x4A, 0x79, 0xA7, 0x2D, 0x7F, 0x5C, 0xF7, 0xA6, 0x52, 0xCB, 0xCC,
+    0x62, 0xBE, 0xDB, 0x90, 0xAE, 0x74, 0xEA, 0xA9, 0x01, 0xFD, 0x94, 0x45, 0xBD, 0xE6, 0x20, 0x14,
+    0x14, 0x64, 0xDF, 0x6D, 0xD1, 0xED, 0x40, 0xD2, 0xE7, 0xED, 0xA9, 0x65, 0x2C, 0xF2, 0x6A, 0x95,
+    0xC9, 0xF9, 0x96, 0x13, 0xF4, 0x47, 0x34, 0xDB, 0xD3, 0x68, 0x67, 0xBE, 0xBF, 0xE5, 0x52, 0x11,
+    0x17, 0xAC, 0xC6, 0xC7, 0x88, 0x0B, 0xD2, 0x2A, 0x2D, 0x50, 0x37, 0x6A, 0x02, 0x27, 0xE1, 0x4F,
+    0x76, 0xF8, 0x7D, 0x21, 0xD8, 0x0E, 0x17, 0x58, 0xE7, 0x1C, 0xE9, 0xB5, 0x01, 0x64, 0x09, 0xC7,
+    0x0E, 0xCB, 0x15, 0x75, 0x77, 0x6F, 0x24, 0xF2, 0xD2, 0x93, 0xF2, 0x88, 0xB4, 0x4B, 0x74, 0x5F,
+    0xC2, 0x32, 0x2F, 0xC8, 0x0F, 0x1B, 0x21, 0x26, 0x87, 0x08, 0x16, 0xF5, 0x03, 0x4C, 0xF3, 0x0A,
+    0x73, 0xBE, 0x23, 0x6B, 0xEB, 0x6A, 0xAB, 0x4F, 0x45, 0xA6, 0x61, 0x3E, 0x3A, 0xAD, 0xDA, 0xC0,
+    0xE4, 0x58, 0x00, 0x26, 0x2A, 0x30, 0x76, 0xF9, 0x74, 0x6D, 0x73, 0x11, 0x1B, 0xD5, 0xCB, 0x02,
+    0x88, 0x59, 0x31, 0xA4, 0x83, 0xCD, 0xD1, 0xE5, 0x77, 0x4A, 0x2C, 0x4E, 0xAF, 0x1E, 0xBE, 0x82,
+    0xA4, 0xB9, 0x99, 0x6F, 0x7E, 0xCA, 0xC4, 0xFA, 0xDD, 0x93, 0x23, 0x58, 0x72, 0x9B, 0x95, 0x36,
+    0xA2, 0xAB, 0x95, 0xAA, 0x7C, 0x0F, 0xA3, 0xC6, 0xCA, 0x9D, 0xA3, 0x36, 0xAD, 0x8B, 0x91, 0x83,
+    0x3A, 0xE0, 0x70, 0x17, 0xFB, 0x94, 0xC7, 0x23, 0xCF, 0xAE, 0x3C, 0x02, 0x75, 0x07, 0xE9, 0x6B,
+    0x0E, 0xB6, 0x95, 0x43, 0x35, 0x71, 0x7B, 0xF0, 0x4C, 0x73, 0x88, 0x7E, 0xE5, 0x20, 0x7D, 0xD5,
+    0x42, 0x5E, 0x12, 0xAC, 0xFB, 0xF1, 0xFB, 0x16, 0xDD, 0x98, 0xCD, 0xEA, 0x52, 0xC2, 0x54, 0x2D,
+    0x1F, 0xE7, 0x87, 0xFB, 0x45, 0xFC, 0x31, 0x80, 0x14, 0x10, 0x4B, 0x33, 0x3E, 0x57, 0x56, 0x78,
+    0x58, 0xE7, 0xDE, 0xD5, 0x53, 0x9D, 0xDC, 0xB7, 0x8F, 0x7C, 0xC8, 0x26, 0x95, 0x8A, 0x49, 0x29,
+    0x1D, 0x66, 0xEF, 0x1B, 0x1E, 0xD3, 0x30, 0x60, 0x2A, 0xA6, 0xC1, 0x49, 0xF7, 0x1B, 0x6C, 0x62,
+    0x07, 0x49, 0x83, 0x87, 0xB8, 0xC3, 0x30, 0xDA, 0x5A, 0xC8, 0x8B, 0x80, 0x88, 0xAA, 0x45, 0x44,
+    0xE4, 0x5A, 0x3D, 0x9B, 0xCD, 0xE4, 0x99, 0xF0, 0x85, 0x72, 0x8C, 0x76, 0xA7, 0xB8, 0xC3, 0x5C,
+    0x9B, 0xCD, 0x06, 0xB4, 0x88, 0x48, 0xA1, 0x44, 0x44, 0x6E, 0x75, 0xA9, 0xA3, 0xBF, 0xF8, 0x28,
+    0x5F, 0x44, 0xA7, 0xC7, 0x8A, 0x2B, 0x07, 0x51, 0xB9, 0x79, 0x86, 0x5A, 0xC4, 0xA6, 0x22, 0x7D,
+    0xE8, 0x6C, 0xE1, 0xAB, 0xCF, 0x9D, 0x66, 0x92, 0x49, 0xAB, 0x7E, 0x2E, 0x52, 0x99, 0x2E, 0xF6,
+    0xCA, 0x93, 0xB6, 0xA6, 0xC0, 0x28, 0x17, 0x4C, 0x5D, 0x1F, 0xEF, 0x20, 0x2A, 0xA2, 0x07, 0x85,
+    0xD7, 0xE4, 0x46, 0xE7, 0xCA, 0xFE, 0xC0, 0x63, 0x9D, 0x4B, 0x9B, 0x8A, 0x27, 0x7B, 0x1D, 0x15,
+    0x7C, 0x9F, 0x66, 0xDF, 0x19, 0xFA, 0x31, 0x3E, 0x14, 0xB1, 0x08, 0xB5, 0xD8, 0xA8, 0x88, 0x93,
+    0x65, 0x7C, 0x45, 0x6E, 0xBC, 0xDD, 0x94, 0xDD, 0x73, 0xF1, 0xBE, 0x5B, 0xBC, 0xFF, 0x35, 0xAF,
+    0x0B, 0x5F, 0x99, 0x7D, 0x5F, 0xE4, 0x4D, 0x91, 0x62, 0x94, 0x4C, 0xBE, 0x2D, 0x42, 0xB9, 0x83,
+    0x47, 0x39, 0xB4, 0xC5, 0xF0, 0x51, 0x0F, 0x9B, 0x54, 0x7C, 0x2E, 0xEE, 0xF1, 0xD9, 0xFF, 0x24,
+    0xF2, 0xC3, 0x95, 0x72, 0xA1, 0xDA, 0x8F, 0x77, 0x11, 0xCB, 0x37, 0xF9, 0xE3, 0x36, 0x7A, 0xED,
+    0x46, 0xAD, 0xA4, 0x8B, 0xFF, 0xB7, 0x95, 0xC4, 0xDB, 0xE7, 0xE2, 0x92, 0xBD, 0x8F, 0x7B, 0x29,
+    0x03, 0x03, 0xB5, 0xBC, 0x28, 0xC2, 0x05, 0xFE, 0xAB, 0x46, 0x5D, 0xBD, 0x56, 0xA7, 0xE2, 0x8E,
+    0xED, 0x8D, 0x34, 0x9B, 0xF0, 0x31, 0x6B, 0x59, 0xCB, 0x25, 0x71, 0xE5, 0x8E, 0xB6, 0xCA, 0xE1,
+    0x31, 0x7C, 0xD8, 0xC1, 0x90, 0xCA, 0x52, 0x84, 0x7B, 0xB9, 0x17, 0x4D, 0x6A, 0x63, 0x47, 0x79,
+    0x21, 0xF5, 0x9C, 0x88, 0xAA, 0xCC, 0x96, 0x2B, 0x8E, 0xD7, 0x2B, 0xA7, 0xAD, 0xC1, 0xBF, 0xCF,
+    0x2E, 0xC3, 0xA5, 0xD5, 0x06, 0x9D, 0xBA, 0xF1, 0xA7, 0x43, 0x54, 0xB0, 0xC3, 0x80, 0x29, 0x56,
+    0x86, 0x9E, 0x58, 0x96, 0xB5, 0xBC, 0xB0, 0x2C, 0x3E, 0xFC, 0x51, 0xC6, 0x83, 0x2E, 0x97, 0x77,
+    0xC5, 0x4F, 0xCC, 0xCD, 0x4B, 0x2D, 0x55, 0xBE, 0x25, 0x2E, 0x6D, 0xCA, 0x9D, 0xB8, 0x1B, 0x9D,
+    0x1E, 0x79, 0xE1, 0x49, 0x9B, 0xD1, 0xC6, 0xFF, 0x6B, 0x17, 0x0C, 0xA4, 0x3F, 0x11, 0x1F, 0xFF,
+    0x52, 0xE4, 0x08, 0x7E, 0x32, 0x71, 0x44, 0x8F, 0xF6, 0x41, 0xF6, 0x29, 0x83, 0x92, 0x7E, 0x27,
+    0x6B, 0x99, 0x4D, 0x5F, 0x71, 0xAA, 0xEF, 0xD9, 0x3E, 0x60, 0xBC, 0x3D, 0xDB, 0x86, 0xFC, 0x61,
+    0x9B, 0xBE, 0xEC, 0xE2, 0xCE, 0xB3, 0xF8, 0xE8, 0x1F, 0x0A, 0xD2, 0x86, 0x60, 0xFF, 0x25, 0x2F,
+    0xD0, 0x36, 0xDE, 0x72, 0x88, 0xC3, 0xB4, 0xC1, 0x34, 0xB9, 0x84, 0xB2, 0x23, 0xFB, 0x6E, 0xA3,
+    0xDA, 0xBC, 0x38, 0x64, 0x35, 0x4C, 0x3F, 0x48, 0xE0, 0xFE, 0xCD, 0x76, 0x79, 0xB5, 0xF6, 0xA8,
+    0xA3, 0x5E, 0x92, 0xAE, 0x2C, 0x78, 0x7F, 0x0C, 0x52, 0xC4, 0xD2, 0xA4, 0xAF, 0xB9, 0xAC, 0xF0,
+    0x07, 0xAC, 0x7D, 0xB2, 0x02, 0x50, 0xFC, 0x7A, 0xFF, 0x13, 0xD8, 0xE5, 0x5F, 0x7B, 0xA4, 0xA7,
+    0x6E, 0x98, 0x8F, 0x4E, 0x22, 0xE7, 0x89, 0xBC, 0xB6, 0x98, 0xC2, 0xA3, 0x1B, 0x6D, 0x55, 0x87,
+    0x67, 0x89, 0xB6, 0x79, 0x85, 0x4F, 0x5B, 0xF4, 0x8B, 0x3E, 0xA0, 0x16, 0xF4, 0x5B, 0x3D, 0x88,
+    0x34, 0xE8, 0xBE, 0x86, 0xA5, 0xEA, 0xD1, 0x56, 0x37, 0x78, 0x4A, 0xB4, 0x8D, 0x3D, 0x1E, 0xDD,
+    0x6A, 0x4B, 0x59, 0x78, 0x62, 0xAF, 0x6D, 0x30, 0x07, 0x99, 0xA7, 0x6C, 0x70, 0xE7, 0x1D, 0x76,
+    0x4F, 0x4C, 0x56, 0xE2, 0xC0, 0xE5, 0x95, 0x20, 0x50, 0x04, 0x31, 0x60, 0xF2, 0x81, 0x6B, 0xDC,
+    0x4F, 0x48, 0xDB, 0x09, 0x79, 0x35, 0xA1, 0x66, 0x12, 0x7B, 0x26, 0xA9, 0x63, 0x92, 0x59, 0x26,
+    0x25, 0x4C, 0xA4, 0xC0, 0x88, 0xC5, 0x7C, 0xD7, 0x61, 0x54, 0xCF, 0x84, 0x81, 0x09, 0x25, 0x13,
+    0x72, 0x3B, 0x41, 0xB7, 0x13, 0x54, 0x37, 0x09, 0x9A, 0xDB, 0x08, 0x69, 0xB3, 0x8C, 0xD8, 0xA9,
+    0x80, 0x27, 0x5C, 0x07, 0xEE, 0x00, 0x43, 0xDC, 0x1B, 0x52, 0x67, 0xC8, 0xAD, 0xA1, 0xC4, 0x44,
+    0x03, 0x46, 0x75, 0x18, 0xDD, 0x62, 0x4C, 0x85, 0xA9, 0x2B, 0x8C, 0x34, 0x98, 0x57, 0x1C, 0xE6,
+    0xEB, 0x3D, 0x86, 0x01, 0x43, 0x49, 0x38, 0x5F, 0xB7, 0x06, 0xD5, 0x19, 0x22, 0xCF, 0x0F, 0x82,
+    0x11, 0xDE, 0x14, 0xC1, 0x72, 0x59, 0x1C, 0xD1, 0xD8, 0xF3, 0x9B, 0x4C, 0x7B, 0xBF, 0xE1, 0x47,
+    0x09, 0xE8, 0xCB, 0xA7, 0x44, 0x96, 0x3C, 0xAB, 0xFA, 0xC4, 0x69, 0x6B, 0x38, 0x0B, 0x9C, 0xC4,
+    0x7C, 0xEC, 0xBF, 0xF9, 0x27, 0xD6, 0xC1, 0x6F, 0x1C, 0x52, 0xC4, 0x0F, 0x88, 0xDE, 0x43, 0x56,
+    0x10, 0xB7, 0xB0, 0x0E, 0x11, 0x9C, 0x1C, 0x41, 0xDF, 0xEF, 0xB7, 0xB1, 0x90, 0x3F, 0x74, 0xE5,
+    0xA7, 0xEE, 0xF9, 0x13, 0xCC, 0x49, 0x5E, 0xB5, 0x6C, 0x7B, 0xD2, 0x97, 0x2C, 0x9D, 0x47, 0x6B,
+    0x4B, 0xF5, 0x1B, 0x3E, 0xDA, 0xC9, 0xE8, 0x41, 0xE7, 0x8D, 0x3E, 0xEF, 0x9C, 0xB9, 0x5B, 0xBD,
+    0x6D, 0x4D, 0x40, 0x30, 0x7D, 0x8C, 0xCD, 0x47, 0xA2, 0xD7, 0x97, 0xB4, 0xD5, 0x8D, 0x67, 0xD0,
+    0x36, 0xB5, 0x1F, 0xE5, 0xA1, 0xDE, 0x97, 0x69, 0x7F, 0xC9, 0x98, 0x87, 0x5F, 0x7A, 0xF9, 0x6D,
+    0xF7, 0x7E, 0xFC, 0x3C, 0x38, 0xB0, 0x3F, 0xD0, 0xA7, 0x1B, 0x0A, 0xD2, 0x02, 0xF3, 0x98, 0x43,
+    0x4B, 0x8B, 0x92, 0x8A, 0x58, 0x0A, 0x94, 0x10, 0x3C, 0xB2, 0x7F, 0xF7, 0x96, 0x3F, 0x91, 0xD9,
+    0x6C, 0xC7, 0x88, 0xF4, 0x5A, 0x64, 0xC9, 0x69, 0xB2, 0x2A, 0xEA, 0x6F, 0xB5, 0x29, 0xB2, 0x45,
+    0x24, 0x6D, 0xD6, 0xA5, 0xBD, 0x92, 0x2A, 0xEF, 0xDF, 0xE7, 0x3C, 0x88, 0x9F, 0x59, 0xF9, 0xA9,
+    0x82, 0xB1, 0xBD, 0x80, 0xC0, 0xE4, 0x8F, 0x38, 0xAA, 0x76, 0x81, 0xB9, 0x54, 0x30, 0x17, 0x0B,
+    0x73, 0x71, 0x30, 0x97, 0x0E, 0xE6, 0x83, 0x87, 0xB9, 0xAF, 0x61, 0xEE, 0x4D, 0xC1, 0xDC, 0x67,
+    0x96, 0xB9, 0x4F, 0x5B, 0xE6, 0x5E, 0x75, 0xCC, 0x7D, 0xE4, 0x99, 0x7B, 0x96, 0xCC, 0x3D, 0xA6,
+    0x98, 0x7B, 0x72, 0x3B, 0xF7, 0xE8, 0x76, 0xEE, 0x51, 0x6E, 0xEE, 0x89, 0xFD, 0xDC, 0xC3, 0x30,
+    0xF7, 0x50, 0xCE, 0x3D, 0xE4, 0xDE, 0x83, 0xF6, 0x1E, 0x12, 0xEF, 0x21, 0xF6, 0xC1, 0x90, 0x61,
+    0xAA, 0xA0, 0x1A, 0x8D, 0xE3, 0xED, 0xC0, 0x5D, 0xC3, 0x7A, 0x2A, 0xD5, 0x46, 0x29, 0x9D, 0xD9,
+    0xFB, 0x86, 0x37, 0x0D, 0x4B, 0x53, 0x31, 0x35, 0x1F, 0x1F, 0x1A, 0x6C, 0x7E, 0x77, 0xF5, 0x3B,
+    0x58, 0x26, 0xAC, 0x48, 0x3F, 0x5F, 0xD1, 0x3F, 0x72, 0x2B, 0xFC, 0xC6, 0x27, 0x58, 0xD7, 0x23,
+    0xB8, 0x81, 0x11, 0x49, 0x1B, 0xDC, 0x98, 0x45, 0xB0, 0x83, 0x5F, 0xE0, 0xCB, 0xA3, 0x27, 0x27,
+    0xFB, 0x4E, 0x0B, 0xE9, 0x5B, 0x76, 0xB4, 0x9D, 0x1D, 0x75, 0xE5, 0xFC, 0xAE, 0x68, 0x16, 0x17,
+    0xD1, 0x4E, 0xEC, 0xD2, 0x06, 0x9F, 0x17, 0x98, 0x21, 0x68, 0x88, 0x49, 0xFB, 0x89, 0xF7, 0x89,
+    0xCC, 0xAE, 0x46, 0x46, 0xDC, 0xAD, 0x5C, 0x50, 0x81, 0x7A, 0x59, 0x01, 0xA4, 0x2F, 0xB6, 0xE5,
+    0x10, 0xB7, 0x5E, 0xA4, 0x3D, 0x6D, 0x86, 0x47, 0x06, 0x74, 0x4F, 0x6E, 0x95, 0x47, 0x39, 0x96,
+    0xE0, 0x31, 0x05, 0x39, 0xDA, 0x92, 0x5A, 0xE5, 0x88, 0x1D, 0x1E, 0xE6, 0x18, 0x3E, 0x62, 0xE1,
+    0x2D, 0xA9, 0xDB, 0xDF, 0x44, 0xDD, 0x6A, 0x9F, 0xBA, 0x8E, 0xB9, 0x57, 0x3D, 0x73, 0x8F, 0x67,
+    0xEE, 0xA9, 0x99, 0x7B, 0x4C, 0x35, 0xF7, 0x68, 0x3B, 0xF7, 0x24, 0x6E, 0xEE, 0x51, 0xFD, 0xDC,
+    0x83, 0xDF, 0x27, 0xAC, 0xB9, 0x99, 0xB0, 0xFB, 0x56, 0xC9, 0xF9, 0xAA, 0xBA, 0x51, 0x0F, 0x6B,
+    0x8F, 0x76, 0x90, 0x4A, 0x0B, 0xA9, 0x14, 0xFB, 0x7E, 0xF4, 0xF5, 0x54, 0x76, 0x6E, 0x22, 0x72,
+    0xF9, 0x6B, 0x76, 0xC6, 0x9B, 0xD7, 0x29, 0xFC, 0x47, 0x43, 0x40, 0x63, 0x9A, 0x96, 0xE3, 0xB3,
+    0x19, 0x20, 0xE2, 0xE0, 0xC0, 0x31, 0xF2, 0xFB, 0x06, 0xF5, 0x7C, 0x7C, 0x76, 0x01, 0x1D, 0x1C,
+    0xAD, 0xEE, 0xB7, 0x0D, 0xE7, 0xFA, 0x0C, 0xC7, 0x00, 0x87, 0x83, 0xF4, 0xDA, 0x2E, 0x60, 0xA4,
+    0x82, 0x03, 0x0F, 0xCB, 0xEF, 0x1B, 0x6D, 0x2E, 0xF0, 0x4D, 0x34, 0x1A, 0x76, 0x2F, 0xB6, 0xC4,
+    0xD2, 0xC3, 0xBE, 0x9E, 0xF7, 0x5B, 0xC4, 0xBC, 0x3D, 0x7B, 0xBC, 0x82, 0xFC, 0xDB, 0x3D, 0x28,
+    0x57, 0x02, 0x73, 0x6D, 0x21, 0x8B, 0x1C, 0xC4, 0xF6, 0xFE, 0xA3, 0x94, 0x3A, 0x26, 0x7B, 0x90,
+    0x88, 0x0C, 0xC4, 0xF2, 0x46, 0xDD, 0x53, 0x56, 0xE4, 0x8D, 0x6E, 0xA1, 0x8C, 0x3D, 0xC4, 0xBD,
+    0x01, 0xF4, 0x55, 0x07, 0x0C, 0xBB, 0x40, 0xFA, 0x56, 0x03, 0x94, 0xC3, 0x01, 0x91, 0xFC, 0x3E,
+    0x91, 0xCC, 0x00, 0x24, 0xEF, 0xB6, 0xC0, 0x6E, 0xC9, 0xF8, 0xE8, 0x78, 0x53, 0x41, 0xFE, 0xE4,
+    0x00, 0x89, 0x4B, 0x7B, 0xA2, 0x25, 0xF9, 0xDE, 0x23, 0x52, 0x05, 0xA7, 0xE7, 0x18, 0xBF, 0xB3,
+    0x16, 0x50, 0x70, 0xCF, 0x12, 0xF7, 0x79, 0x85, 0x51, 0x8E, 0xD4, 0x7A, 0x22, 0x97, 0xC1, 0x57,
+    0x8F, 0xE0, 0x6B, 0x73, 0xA9, 0xC8, 0x44, 0x0A, 0x35, 0x7C, 0x63, 0x60, 0x49, 0xE2, 0x32, 0x4B,
+    0xFE, 0xED, 0x6E, 0x24, 0xD5, 0x15, 0x77, 0x13, 0x30, 0x51, 0xBF, 0xEC, 0xC0, 0xE7, 0x05, 0xFA,
+    0x05, 0x4F, 0xDC, 0xEB, 0x96, 0x12, 0xB3, 0xB3, 0xD5, 0x44, 0x22, 0x5D, 0x68, 0x8D, 0x30, 0xA0,
+    0xBF, 0x02, 0x68, 0xB7, 0x72, 0xAA, 0x8C, 0xBA, 0x56, 0xD4, 0x1E, 0xF1, 0x5A, 0x3F, 0x83, 0x16,
+    0xE9, 0x11, 0x11, 0xA7, 0x2D, 0x75, 0x35, 0xEA, 0x2C, 0xBA, 0xF1, 0x01, 0xE4, 0x93, 0x36, 0x1E,
+    0x06, 0x6D, 0xD1, 0xD6, 0xA3, 0x7A, 0xFD, 0xC6, 0x23, 0x4B, 0x44, 0xA4, 0xD0, 0x22, 0x96, 0x81,
+    0x01, 0x6D, 0x13, 0x87, 0x0F, 0x60, 0xE0, 0x01, 0x4F, 0xE2, 0x46, 0x95, 0x27, 0xF2, 0xDA, 0x92,
+    0xB6, 0x1E, 0xCC, 0xC3, 0x96, 0xD8, 0x13, 0x3D, 0x83, 0xEA, 0xD0, 0x2D, 0x59, 0xC5, 0x84, 0x7D,
+    0x88, 0xF7, 0x7A, 0xEA, 0x37, 0x8C, 0xDF, 0xD8, 0xFD, 0x1F, 0x8C, 0xC3, 0x58, 0x4C, 0xF1, 0x91,
+    0x54, 0xAE, 0x4F, 0xF5, 0xC9, 0x6F, 0xA1, 0x64, 0xD9, 0x9B, 0x94, 0xAC, 0x5F, 0xBB, 0x22, 0x63,
+    0x0F, 0x28, 0x30, 0xB0, 0x01, 0xE7, 0xE0, 0x79, 0x38, 0x0D, 0xC7, 0x89, 0x2B, 0xE6, 0x51, 0x47,
+    0xDC, 0x2D, 0x40, 0xBF, 0x55, 0x81, 0x69, 0x39, 0xAC, 0x66, 0x7D, 0xBA, 0x44, 0xF8, 0x33, 0xFE,
+    0x68, 0xC2, 0x5C, 0x5F, 0x71, 0x89, 0xD8, 0x48, 0x8A, 0x60, 0xD1, 0xFE, 0x0D, 0x6A, 0x7D, 0xBC,
+    0x0A, 0xCE, 0xD6, 0x51, 0x06, 0x8C, 0xDD, 0x0A, 0xEF, 0xB5, 0xCF, 0xEA, 0x94, 0x88, 0xD7, 0xCB,
+    0x8B, 0x7D, 0x66, 0x39, 0x61, 0x8A, 0x43, 0xF3, 0x49, 0x11, 0x7E, 0xA9, 0x3B, 0x48, 0xA4, 0x02,
+    0xD9, 0x83, 0x4C, 0x2A, 0xA8, 0x0F, 0x03, 0x42, 0x77, 0x47, 0x43, 0xF4, 0x14, 0x58, 0xDC, 0x41,
+    0xE4, 0xCB, 0xA7, 0x1F, 0xEB, 0x4A, 0x91, 0x26, 0x97, 0xE5, 0x08, 0x99, 0xFA, 0x73, 0xD0, 0x0D,
+    0xAA, 0x87, 0x29, 0xE8, 0x8A, 0x03, 0x13, 0x74, 0x24, 0x4B, 0x44, 0xBC, 0x69, 0x1E, 0x7B, 0xD0,
+    0xC1, 0x74, 0x84, 0xCA, 0x34, 0x20, 0x21, 0x04, 0x33, 0x96, 0x96, 0x48, 0x2A, 0x22, 0x1F, 0x10,
+    0xA7, 0xDB, 0x90, 0xBE, 0xD2, 0x1C, 0xF3, 0xA5, 0x48, 0x2C, 0x52, 0x71, 0x72, 0x44, 0xD6, 0xA7,
+    0x3D, 0xE4, 0x03, 0x4C, 0x4D, 0x11, 0xF5, 0x69, 0xA3, 0x9A, 0xC8, 0x7D, 0xAA, 0x55, 0xBC, 0xAB,
+    0x40, 0x79, 0x10, 0x87, 0x79, 0xCC, 0xA6, 0x76, 0x1A, 0xB5, 0x3C, 0xFF, 0x09, 0x56, 0xF1, 0xD3,
+    0xA8, 0xC6, 0xA9, 0x2A, 0x8C, 0xB2, 0x6C, 0xE5, 0x8F, 0x99, 0x07, 0x0B, 0x6C, 0xDD, 0x41, 0x5D,
+    0x8D, 0x58, 0x9F, 0x56, 0x8B, 0x5C, 0x19, 0xD6, 0x3A, 0x13, 0xA4, 0x46, 0x03, 0x6A, 0x08, 0xD8,
+    0xC5, 0x7C, 0x19, 0xD6, 0xEC, 0x00, 0x05, 0x94, 0x34, 0xB0, 0xD8, 0x66, 0xEB, 0xAA, 0x88, 0xCB,
+    0xA5, 0x27, 0x72, 0x70, 0x77, 0xF8, 0x45, 0xEC, 0x40, 0x17, 0x44, 0x8E, 0x6C, 0x49, 0x24, 0x01,
+    0x65, 0x14, 0x77, 0x49, 0xCB, 0x22, 0xAB, 0xC8, 0x77, 0x83, 0x9F, 0x57, 0xB9, 0x4F, 0xB5, 0xA3,
+    0xFE, 0x11, 0xC7, 0x8A, 0x3E, 0x76, 0xCA, 0x79, 0x32, 0x81, 0xB2, 0x39, 0x84, 0x3D, 0xFA, 0x04,
+    0x5A, 0xB1, 0x16, 0x91, 0xB7, 0x45, 0x44, 0x7E, 0x28, 0x22, 0xF2, 0x31, 0x82, 0x34, 0x7E, 0x83,
+    0xA2, 0xE7, 0x57, 0xF0, 0xCE, 0xBC, 0x25, 0x3C, 0x58, 0x70, 0x5E, 0x4D, 0x46, 0xCF, 0xB1, 0x5A,
+    0x06, 0xAC, 0xB8, 0x23, 0x72, 0x28, 0x47, 0x26, 0xBE, 0x14, 0xFF, 0x87, 0xD7, 0xCF, 0x28, 0xC7,
+    0x87, 0xFC, 0x77, 0xC4, 0x03, 0xC8, 0x40, 0x3E, 0x90, 0x16, 0x68, 0xC8, 0x83, 0x61, 0xB2, 0x83,
+    0x0E, 0x71, 0x48, 0xC5, 0x0E, 0x7F, 0x86, 0x72, 0x69, 0x83, 0x72, 0x8B, 0x71, 0x9E, 0x57, 0x4B,
+    0x8E, 0x68, 0x1C, 0xBF, 0x1B, 0xBA, 0x70, 0x62, 0xEC, 0x08, 0xA1, 0x93, 0x3B, 0x1C, 0x2E, 0x0A,
+    0x21, 0x94, 0x0E, 0x32, 0xF1, 0x94, 0xE2, 0xF9, 0xC3, 0xEB, 0x67, 0xF6, 0x63, 0xE2, 0x3F, 0xD2,
+    0xDA, 0x41, 0x3C, 0x00, 0x32, 0x04, 0x76, 0x14, 0x15, 0xEF, 0xA9, 0xDD, 0x74, 0x54, 0x0D, 0x02,
+    0x0D, 0xB2, 0x8A, 0x9B, 0x8A, 0x4E, 0x3E, 0xF6, 0xE3, 0x02, 0x11, 0xA9, 0x94, 0xC8, 0x72, 0xC4,
+    0x29, 0xBC, 0xF7, 0xAC, 0x0F, 0x2C, 0xFA, 0xC0, 0xF6, 0xFC, 0x93, 0x1B, 0xCF, 0x18, 0xF1, 0x7F,
+    0x72, 0xE3, 0xD9, 0x0F, 0x6A, 0xCF, 0xA8, 0x60, 0x8D, 0x3F, 0x20, 0x96, 0xEA, 0x39, 0x32, 0xF9,
+    0xB9, 0xE5, 0xF9, 0x7C, 0xB8, 0x29, 0xDE, 0xC2, 0x7C, 0x74, 0x9F, 0xDF, 0x47, 0x2E, 0x52, 0x6F,
+    0xF7, 0xA3, 0xB8, 0xB8, 0xAB, 0x1D, 0xA9, 0xD3, 0x7B, 0x8F, 0x48, 0xA1, 0x45, 0x3A, 0x12, 0x59,
+    0x8E, 0x8E, 0xC1, 0x13, 0x7C, 0x31, 0x92, 0xEA, 0x39, 0x25, 0x37, 0x5C, 0xFA, 0x80, 0x34, 0x29,
+    0x5F, 0xD9, 0x0F, 0xBD, 0x98, 0xC2, 0x64, 0x0A, 0xE6, 0x23, 0xAE, 0xE5, 0x14, 0x6A, 0x03, 0x62,
+    0x8A, 0x58, 0xF2, 0xF6, 0x94, 0x68, 0x11, 0x13, 0x4B, 0x9F, 0xB3, 0x36, 0xAA, 0x25, 0x4A, 0xC4,
+    0x1E, 0xD5, 0x9C, 0xD4, 0x27, 0x57, 0xD9, 0x83, 0x22, 0x93, 0x57, 0x41, 0x9F, 0x48, 0x5B, 0x81,
+    0x1A, 0x79, 0x7A, 0xAB, 0x43, 0x44, 0x0A, 0x4A, 0x69, 0x21, 0x3A, 0x0D, 0xD1, 0x6C, 0x56, 0xC5,
+    0x22, 0x36, 0x1E, 0xF3, 0x31, 0x7C, 0xE2, 0xD5, 0xBD, 0xC0, 0x37, 0x51, 0x56, 0x59, 0x92, 0x6B,
+    0xBB, 0x90, 0x8A, 0xBB, 0x49, 0xD5, 0xF8, 0x1D, 0x35, 0x77, 0x5C, 0x45, 0x3B, 0x71, 0xA3, 0x6C,
+    0x74, 0xE3, 0x92, 0xA5, 0x16, 0x38, 0x75, 0x00, 0x4E, 0xFB, 0x44, 0xEB, 0x1F, 0xE6, 0xB7, 0x1E,
+    0xD8, 0xEB, 0x20, 0x29, 0x1C, 0x7C, 0x41, 0x59, 0x38, 0x7B, 0xF7, 0xC8, 0x29, 0xF9, 0x6F, 0x0E,
+    0x51, 0x43, 0x7F, 0xC2, 0x3D, 0x20, 0x2F, 0x01, 0xBF, 0x0B, 0xEA, 0x17, 0x1E, 0xF2, 0xF3, 0x9E,
+    0xD8, 0xAB, 0xE5, 0x66, 0xDD, 0x28, 0x91, 0x81, 0x48, 0xA4, 0x1A, 0xA1, 0x49, 0x8C, 0x4E, 0xFD,
+    0xC9, 0x14, 0xCE, 0x6A, 0xF8, 0x96, 0x86, 0xF5, 0x2C, 0x30, 0x9B, 0x63, 0xED, 0x6F, 0x87, 0x34,
+    0xC7, 0xAB, 0x67, 0xA1, 0x4C, 0xDB, 0xE0, 0x11, 0xCE, 0x63, 0x07, 0x5D, 0x06, 0x69, 0xF1, 0xDC,
+    0x21, 0x8A, 0x7C, 0xC2, 0x5D, 0x23, 0xFE, 0x95, 0x03, 0xFD, 0xC3, 0x36, 0x98, 0x92, 0xE2, 0xDE,
+    0x58, 0x72, 0x6B, 0xDE, 0x78, 0x74, 0xC0, 0x88, 0x34, 0x64, 0xD2, 0x03, 0x67, 0x80, 0xBB, 0xE2,
+    0x0B, 0x94, 0x89, 0xC3, 0x6B, 0x1B, 0x75, 0x39, 0xAA, 0xD9, 0x38, 0xF2, 0x60, 0x9F, 0x24, 0x21,
+    0x3E, 0xED, 0x2A, 0x0E, 0xC0, 0x23, 0xED, 0x4A, 0xF7, 0xB9, 0x1C, 0xFC, 0xCE, 0xE3, 0xFC, 0x9D,
+    0xBF, 0x1E, 0x62, 0x0F, 0x61, 0x8D, 0x29, 0x4C, 0xB2, 0x0A, 0x7D, 0xB5, 0x45, 0xFD, 0xA2, 0x0F,
+    0x68, 0x30, 0xF3, 0x41, 0x05, 0x91, 0x9F, 0x42, 0xAD, 0x2D, 0xE6, 0x4A, 0x47, 0xEE, 0xEA, 0x6A,
+    0xCB, 0x6B, 0x11, 0x43, 0xBD, 0xD4, 0x96, 0xD3, 0xE9, 0x0A, 0x02, 0x68, 0x6F, 0x0D, 0x01, 0x5C,
+    0x01, 0xE4, 0xD8, 0x17, 0x0B, 0xD3, 0xD1, 0xCD, 0x3E, 0x35, 0x05, 0x8C, 0x58, 0x39, 0x60, 0x23,
+    0x44, 0x97, 0x1C, 0x5D, 0xA6, 0x21, 0x6C, 0xE2, 0xBA, 0x87, 0x3A, 0xD8, 0x29, 0xD4, 0x12, 0x4C,
+    0xDA, 0xA0, 0x3D, 0x51, 0x9F, 0x55, 0x4C, 0x43, 0x70, 0x68, 0xFC, 0xAB, 0x16, 0x83, 0x47, 0xBF,
+    0x64, 0xF1, 0x71, 0xC7, 0x34, 0x27, 0x69, 0x93, 0x36, 0x76, 0xDB, 0xE4, 0x85, 0xB6, 0xDA, 0xF6,
+    0x78, 0x0C, 0x13, 0xE5, 0x94, 0x63, 0x11, 0x75, 0x69, 0x93, 0x55, 0x51, 0xAF, 0xAD, 0xAE, 0x16,
+    0x28, 0x67, 0x30, 0xCA, 0xA1, 0x5F, 0xE8, 0x98, 0x6B, 0x4B, 0xFE, 0x90, 0x8D, 0xFA, 0x6D, 0x98,
+    0x9A, 0x10, 0x42, 0xE4, 0x7B, 0xD2, 0x97, 0x2C, 0xEA, 0x57, 0x0D, 0xD9, 0x14, 0x92, 0xB7, 0x60,
+    0xD2, 0x05, 0x91, 0x53, 0x2C, 0x98, 0x26, 0xD4, 0xB5, 0x0E, 0x40, 0xCF, 0x68, 0xCC, 0xCA, 0xC3,
+    0x88, 0x7E, 0x30, 0x16, 0x40, 0x0B, 0x80, 0xBA, 0xEE, 0x21, 0x04, 0xB2, 0xC2, 0xDD, 0xA4, 0xC5,
+    0xD1, 0xDA, 0x6E, 0x13, 0x7B, 0x92, 0x37, 0x1D, 0xC6, 0xB2, 0x30, 0xA8, 0x01, 0xFD, 0x62, 0x47,
+    0xED, 0xF0, 0x59, 0xA5, 0x2F, 0x91, 0x55, 0x9E, 0xEB, 0x5D, 0xDC, 0x69, 0x9B, 0xE9, 0xCA, 0xB0,
+    0x50, 0xCE, 0x2B, 0x97, 0xB4, 0x93, 0xA4, 0xD9, 0xC6, 0x24, 0xCD, 0x24, 0xB5, 0xCA, 0xCD, 0x95,
+    0xF3, 0xE4, 0x0F, 0x57, 0xB9, 0xAE, 0xD8, 0xEB, 0xB8, 0xDE, 0xA1, 0xDF, 0x42, 0x5F, 0x82, 0xDD,
+    0x96, 0xDA, 0x91, 0x0C, 0x24, 0x4B, 0x30, 0x16, 0xD3, 0xA0, 0xFA, 0xA0, 0x45, 0x1F, 0x81, 0xFE,
+    0x24, 0xAF, 0x75, 0x30, 0x8D, 0x1D, 0xAA, 0x39, 0x6C, 0x93, 0xF8, 0xF4, 0x63, 0x8D, 0x89, 0x2F,
+    0x84, 0xE8, 0x8A, 0x58, 0x1A, 0xA2, 0x7E, 0x20, 0xEA, 0xD3, 0x86, 0xEE, 0x50, 0x60, 0xCB, 0xA7,
+    0x1C, 0xA9, 0xC8, 0x6D, 0x14, 0xD0, 0x6B, 0x1B, 0x38, 0x5B, 0x5A, 0x9C, 0xBD, 0xA9, 0xB3, 0xE6,
+    0x05, 0x4C, 0x4B, 0x50, 0x6E, 0x80, 0xBC, 0xF2, 0xE0, 0xE3, 0x9E, 0xB4, 0x55, 0x0E, 0x43, 0xDA,
+    0xC6, 0xDD, 0x98, 0xBA, 0xA8, 0x1A, 0xC0, 0x24, 0x6E, 0x1C, 0x01, 0xCB, 0x1E, 0x22, 0xB1, 0x2B,
+    0x51, 0xF7, 0x63, 0x8A, 0xA7, 0x1C, 0xDF, 0x09, 0x96, 0x73, 0xD5, 0x85, 0x35, 0xEA, 0x8E, 0x3A,
+    0x94, 0x56, 0x19, 0x78, 0x5E, 0x09, 0x49, 0x0F, 0xE2, 0xB1, 0x87, 0x32, 0x8C, 0xA1, 0x20, 0xE5,
+    0x21, 0x8D, 0x28, 0x0B, 0x21, 0x88, 0x07, 0xE1, 0xA1, 0x5D, 0x70, 0x9C, 0xDC, 0xFA, 0x07, 0xD7,
+    0x42, 0xD6, 0xA7, 0x65, 0x10, 0x54, 0xFF, 0x1C, 0xB2, 0x06, 0x15, 0x90, 0x06, 0x59, 0x41, 0xBC,
+    0x0F, 0x03, 0x34, 0x22, 0x57, 0x44, 0xFC, 0xC9, 0xCD, 0x2D, 0x8B, 0xEA, 0x60, 0x77, 0x3F, 0x0B,
+    0xC6, 0x62, 0xFF, 0x68, 0x80, 0xAC, 0x5A, 0x1D, 0xE5, 0x15, 0xC9, 0xF5, 0xCD, 0x33, 0xB5, 0xC8,
+    0x4F, 0x44, 0x06, 0xD8, 0x39, 0x04, 0xC4, 0xBD, 0x29, 0xBC, 0x67, 0x3F, 0xA8, 0xF6, 0xB1, 0x90,
+    0xDA, 0x21, 0x6D, 0x3F, 0xCA, 0x93, 0x7F, 0xA4, 0xAA, 0xCE, 0x66, 0xB3, 0x4B, 0x22, 0xF2, 0xAE,
+    0x88, 0x78, 0x3E, 0x13, 0x3C, 0x13, 0xA6, 0xE2, 0x90, 0xA5, 0x00, 0x94, 0x88, 0x37, 0x22, 0x2F,
+    0x6C, 0x3E, 0xE2, 0xC1, 0x14, 0xA4, 0x21, 0xA2, 0xC7, 0x40, 0xDA, 0xAC, 0x8E, 0x74, 0x43, 0xD4,
+    0xAF, 0x8E, 0xE2, 0x1E, 0xCA, 0xCD, 0xCD, 0x87, 0x44, 0x86, 0x5A, 0xA4, 0x89, 0x2B, 0x2E, 0xB0,
+    0x4D, 0x4F, 0xF2, 0xD3, 0x3E, 0xC4, 0xF1, 0xA4, 0xFE, 0xA8, 0xEF, 0xE7, 0xD3, 0x69, 0xBE, 0x3F,
+    0xE2, 0x58, 0xD4, 0x2B, 0x97, 0xB4, 0x41, 0x95, 0xAD, 0xED, 0xE8, 0x87, 0xF9, 0x24, 0x9A, 0xEF,
+    0x64, 0xA1, 0xC5, 0xCA, 0x32, 0x75, 0x1F, 0x17, 0xB6, 0x74, 0xE4, 0x90, 0xAF, 0x60, 0x2A, 0x6D,
+    0x95, 0xA3, 0x67, 0x3D, 0x7A, 0x46, 0x37, 0x43, 0xDA, 0x4E, 0xE2, 0x06, 0xFE, 0x1C, 0x04, 0x25,
+    0x56, 0xBF, 0xE2, 0x72, 0xFC, 0x59, 0xEE, 0x09, 0x10, 0xB4, 0xBF, 0x96, 0x65, 0xE7, 0x4A, 0x7F,
+    0x5F, 0xF4, 0x2C, 0xB3, 0xD9, 0x25, 0x91, 0xE0, 0x2D, 0xD0, 0x01, 0x91, 0x77, 0x7D, 0x73, 0x73,
+    0xF3, 0x4B, 0xDC, 0xB9, 0xCE, 0x7A, 0x3E, 0xEB, 0xB5, 0xB4, 0xD1, 0x6E, 0x71, 0x62, 0x77, 0x77,
+    0x9B, 0x3B, 0x78, 0xC8, 0x6E, 0x2F, 0x92, 0x37, 0xED, 0xFA, 0xC9, 0x48, 0x9E, 0xDC, 0x2A, 0xEE,
+    0xA5, 0xCB, 0x6D, 0xA7, 0xEC, 0x1A, 0x90, 0x75, 0x93, 0xED, 0xE7, 0xEF, 0x7E, 0xEE, 0xF6, 0xB3,
+    0xF7, 0x1A, 0x9F, 0xB6, 0x3C, 0x73, 0x57, 0x31, 0xE8, 0x66, 0x9A, 0xB6, 0x46, 0xB5, 0x79, 0xDC,
+    0xDE, 0x4E, 0xCB, 0x7B, 0x4D, 0x71, 0x27, 0xB6, 0xB7, 0xB7, 0xB7, 0xB7, 0x39, 0xBD, 0xD6, 0xE7,
+    0xAB, 0x3F, 0xF8, 0x4A, 0x7C, 0x41, 0x37, 0x03, 0x5E, 0x5B, 0xFD, 0x64, 0x17, 0xB9, 0x8C, 0xDB,
+    0x03, 0x9F, 0xDD, 0x86, 0x5D, 0xD8, 0xE5, 0x4B, 0x5F, 0x3E, 0xF2, 0x60, 0x3C, 0x4E, 0x2A, 0x6D,
+    0xF6, 0xF3, 0x7E, 0x83, 0xF5, 0xFB, 0xF9, 0x6A, 0x6C, 0xCF, 0xA5, 0xB6, 0xCF, 0x1F, 0x74, 0x26,
+    0x71, 0x27, 0xD1, 0x8D, 0xCF, 0x5E, 0xE8, 0x73, 0xE5, 0x36, 0x12, 0x7B, 0x82, 0x69, 0xE2, 0x4C,
+    0xDC, 0x65, 0x95, 0x4F, 0xED, 0x7A, 0x54, 0xA4, 0xCD, 0xA0, 0x5F, 0xE8, 0xF3, 0x07, 0xDD, 0x44,
+    0xD9, 0x13, 0x81, 0x7C, 0x8D, 0x72, 0xF4, 0x7C, 0x95, 0x67, 0x63, 0x9F, 0x38, 0x6D, 0x73, 0xEE,
+    0x07, 0xB2, 0x48, 0x44, 0x5C, 0x16, 0xB9, 0x35, 0x74, 0xD1, 0x69, 0x11, 0x29, 0xBA, 0x35, 0x4E,
+    0x6E, 0x3E, 0x24, 0xFE, 0xF1, 0x8B, 0x96, 0x75, 0xD4, 0xFE, 0x26, 0xAE, 0x38, 0xC1, 0x80, 0x8F,
+    0x7C, 0xD2, 0x95, 0x4D, 0xC9, 0x1D, 0xAC, 0x99, 0xB3, 0xCF, 0x3D, 0x77, 0x36, 0x5F, 0x8B, 0x0A,
+    0x65, 0x95, 0x55, 0xB6, 0x5E, 0x96, 0xC3, 0xC9, 0x33, 0xF5, 0xF2, 0x1F, 0xFF, 0x2C, 0x7C, 0x06,
+    0x65, 0x95, 0xDD, 0xDA, 0xAB, 0x97, 0x7F, 0xF8, 0x57, 0xCA, 0xC6, 0x15, 0x88, 0x88, 0x44, 0xA7,
+    0xF3, 0xD8, 0xE5, 0xB1, 0xCB, 0xD5, 0x8D, 0xA5, 0xFC, 0xF0, 0xF5, 0x33, 0xBA, 0xEA, 0x75, 0xD5,
+    0xEB, 0xCA, 0xA7, 0x37, 0xCA, 0x5F, 0xEC, 0xAE, 0xEF, 0xEE, 0xAE, 0x1F, 0xB4, 0xC4, 0xCD, 0x94,
+    0xD7, 0xB6, 0xCF, 0xBE, 0xDE, 0xAE, 0x47, 0x28, 0x9B, 0x54, 0xBA, 0x63, 0xCE, 0x06, 0xE7, 0xCA,
+    0xDE, 0x34, 0x11, 0xDD, 0xBD, 0x89, 0xBD, 0x9C, 0xDA, 0xFA, 0x7F, 0x96, 0xA8, 0x18, 0x49, 0xBF,
+    0xB9, 0xB9, 0x29, 0x22, 0x37, 0x66, 0x97, 0x3A, 0xB2, 0xF0, 0x7F, 0x9A, 0xB5, 0xB3, 0x3A, 0x7A,
+    0xD9, 0xBA, 0xF5, 0x5C, 0xA4, 0x9A, 0xA6, 0xCD, 0x2D, 0x2C, 0xA8, 0x87, 0xFB, 0x54, 0xD4, 0x9F,
+    0xE5, 0x9E, 0x55, 0x67, 0xE9, 0x6E, 0xD9, 0x26, 0xD1, 0xE9, 0xA8, 0xAA, 0x9B, 0xF5, 0x5C, 0xDE,
+    0x3A, 0x6F, 0x6B, 0x77, 0x3F, 0x97, 0xF7, 0xBB, 0x5C, 0x19, 0xB8, 0xD3, 0x6A, 0x3C, 0x8F, 0xDD,
+    0x6F, 0xE4, 0x20, 0xC7, 0x67, 0xB3, 0xD9, 0xD8, 0x19, 0xA3, 0x22, 0x4E, 0x87, 0xF8, 0xAA, 0xDC,
+    0x78, 0xBB, 0xA9, 0xDD, 0x85, 0xF8, 0x02, 0x47, 0xFB, 0xEA, 0x6C, 0x36, 0x0B, 0xE7, 0x8A, 0x48,
+    0x38, 0x06, 0xF8, 0x2A, 0x59, 0x9B, 0xF6, 0xA9, 0x4F, 0x06, 0xA6, 0x01, 0x21, 0x1E, 0x15, 0xB0,
+    0x11, 0x78, 0x64, 0x1F, 0x22, 0x41, 0xDA, 0x9B, 0x0B, 0xDC, 0x4D, 0x05, 0xF1, 0xFB, 0x14, 0x24,
+    0xA1, 0x40, 0x17, 0xC4, 0x21, 0x5D, 0x51, 0x62, 0xE1, 0xB4, 0xBF, 0x57, 0xEB, 0x7B, 0xFD, 0xE9,
+    0xD3, 0xAC, 0xED, 0xD3, 0x73, 0x39, 0xAB, 0x45, 0x64, 0x73, 0x73, 0x93, 0xE0, 0xD9, 0x99, 0xCE,
+    0x2E, 0xBE, 0x52, 0x71, 0xCF, 0x59, 0xE2, 0x57, 0x2A, 0xEE, 0x29, 0x45, 0xFE, 0x72, 0x36, 0x7B,
+    0x36, 0xBD, 0xBE, 0x8C, 0xDF, 0x5D, 0xF6, 0xEB, 0x5A, 0x5D, 0x2D, 0x9E, 0xFB, 0xC2, 0x89, 0x13,
+    0x1B, 0xE7, 0xF2, 0x2E, 0x6D, 0xB3, 0x6E, 0x63, 0x7E, 0xE2, 0x4B, 0xC7, 0x5E, 0xF4, 0x1B, 0xAA,
+    0xC9, 0xE9, 0x13, 0x3B, 0x37, 0x0F, 0x56, 0x1F, 0x44, 0xA6, 0xF7, 0xEB, 0xC4, 0xEF, 0x6D, 0x80,
+    0x32, 0xF1, 0x89, 0x3D, 0xA7, 0x8B, 0x1D, 0x74, 0x13, 0x25, 0x4E, 0xBD, 0x7D, 0xBD, 0xF3, 0x7E,
+    0x7A, 0xEF, 0x86, 0xE6, 0x76, 0x38, 0xA1, 0x9A, 0x0D, 0xD5, 0x9A, 0x76, 0x38, 0xB9, 0xB9, 0x79,
+    0xA6, 0x14, 0x19, 0xA6, 0xB3, 0xD9, 0xE2, 0x1C, 0x6C, 0xAC, 0xD6, 0x13, 0xC1, 0xE0, 0xF3, 0xBE,
+    0xCF, 0x71, 0x74, 0x40, 0x1B, 0x6F, 0x3C, 0xEB, 0xE3, 0x5F, 0x54, 0x70, 0x72, 0xFD, 0xCE, 0x54,
+    0xCE, 0xBF, 0x28, 0xCB, 0x7E, 0x3D, 0x17, 0xF5, 0x9D, 0xFF, 0xAB, 0xE2, 0x6B, 0xE3, 0x15, 0x82,
+    0xF9, 0x25, 0x2B, 0xE0, 0x34, 0x49, 0xAF, 0x5E, 0x90, 0xBD, 0xCB, 0x1B, 0x99, 0x3C, 0x68, 0xF3,
+    0x86, 0xB5, 0x30, 0x73, 0xE7, 0x15, 0x5C, 0xE0, 0x58, 0xF5, 0x99, 0xBC, 0xBF, 0x67, 0x52, 0xFB,
+    0x6F, 0xA5, 0x1D, 0xA0, 0xDB, 0xBB, 0xCD, 0x72, 0xFB, 0x6C, 0xE9, 0x9F, 0x38, 0xD6, 0x02, 0xC9,
+    0x03, 0x4D, 0x2E, 0x7D, 0x29, 0x83, 0x7E, 0xC0, 0xC5, 0x0F, 0x04, 0x99, 0x3A, 0xAE, 0xD2, 0x36,
+    0xEF, 0xC3, 0x98, 0x53, 0xB6, 0xB6, 0x79, 0xAF, 0x96, 0xD2, 0xE4, 0x7D, 0x12, 0x9E, 0x5E, 0xAF,
+    0xB6, 0x7F, 0xFF, 0xFF, 0x40, 0x9F, 0xE6, 0xDF, 0xFF, 0x33, 0xD6, 0xB8, 0x1D, 0x9E, 0x83, 0xCF,
+    0xC0, 0x37, 0xE1, 0x8B, 0xF0, 0x19, 0x4E, 0x3F, 0x01, 0xB7, 0xAF, 0x8D, 0x67, 0xEE, 0x80, 0xD2,
+    0xAE, 0x81, 0x64, 0xFC, 0xED, 0x85, 0x27, 0xE0, 0xF6, 0xE3, 0x3C, 0x01, 0x9F, 0x5D, 0xFD, 0x2A,
+    0x5C, 0x81, 0x7F, 0xF7, 0x9F, 0x83, 0xE3, 0x1F, 0xFE, 0x9F, 0x07, 0x77, 0x01, 0xB4, 0xD8, 0xBC,
+    0x57, 0x12, 0x9E, 0x01, 0x5D, 0x94, 0xD5, 0x6E, 0xFA, 0x66, 0xDF, 0x01, 0xC9, 0x95, 0x9F, 0x36,
+    0xCF, 0xDF, 0xAD, 0xDC, 0x57, 0xC7, 0x8C, 0x79, 0xFF, 0xAA, 0x5F, 0x67, 0xFD, 0xC4, 0xFA, 0x89,
+    0xC0, 0xFD, 0xF8, 0x32, 0x7F, 0xF0, 0xC5, 0x89, 0xD7, 0x9D, 0x76, 0xA6, 0xFF, 0xC2, 0xFD, 0xC0,
+    0xE9, 0x69, 0xF9, 0x94, 0xAD, 0x8B, 0x5D, 0x2E, 0x14, 0x7A, 0xC7, 0x34, 0xD3, 0xEC, 0xE7, 0xED,
+    0x05, 0xBE, 0x08, 0xAA, 0x55, 0x6D, 0xD6, 0xD6, 0xE4, 0x0F, 0xBB, 0xF4, 0xFA, 0x9B, 0xE7, 0xBB,
+    0xAF, 0xAE, 0xDF, 0xA7, 0x9E, 0x6C, 0xB8, 0x37, 0x69, 0xD7, 0x53, 0x75, 0xF5, 0x47, 0x3B, 0x27,
+    0xA6, 0xF5, 0x36, 0x71, 0xF5, 0x77, 0xFF, 0x77, 0xE3, 0xCB, 0x21, 0x6D, 0xEF, 0xBD, 0xFC, 0x07,
+    0x5F, 0x04, 0xA8, 0x1F, 0x6B, 0x4D, 0xFD, 0xD6, 0xD5, 0xCA, 0x7D, 0xF5, 0x5B, 0x3A, 0x7A, 0xA5,
+    0x72, 0x5F, 0x35, 0xF5, 0x5B, 0xB6, 0xD6, 0x2D, 0xDC, 0xCE, 0xE7, 0x43, 0x5B, 0xDE, 0xCF, 0x13,
+    0xF0, 0x67, 0x00, 0xD1, 0xBF, 0x68, 0x00, 0xCE, 0xE5, 0x15, 0x90, 0x17, 0xF5, 0x0E, 0x6C, 0x35,
+    0x91, 0xC8, 0x25, 0xE9, 0x88, 0x6A, 0x91, 0xD7, 0x81, 0xBB, 0x66, 0xC5, 0xC7, 0x3D, 0xFB, 0x60,
+    0x38, 0x03, 0xEF, 0xF9, 0xC8, 0x66, 0x01, 0x9C, 0xAE, 0x65, 0x0F, 0xEE, 0x36, 0xEF, 0x8A, 0x5C,
+    0xBB, 0x74, 0xB5, 0xE2, 0x94, 0x48, 0x77, 0x01, 0xA2, 0xC7, 0x9F, 0x39, 0x64, 0xE3, 0x1E, 0x1D,
+    0xCF, 0xD2, 0x60, 0xF6, 0x8A, 0xCF, 0x89, 0xD5, 0x2D, 0x50, 0x07, 0x3B, 0xB8, 0x9F, 0xB3, 0xD2,
+    0x01, 0x57, 0xCB, 0x98, 0xA1, 0xEC, 0x1E, 0x25, 0x22, 0x22, 0xCB, 0xD0, 0xBF, 0x83, 0xE7, 0x6A,
+    0xB4, 0xD5, 0x7D, 0x69, 0x1F, 0xFF, 0xD9, 0xDD, 0xF6, 0x79, 0x3E, 0x9B, 0x0E, 0xF7, 0x7F, 0xF6,
+    0x6B, 0x9F, 0xDD, 0x58, 0xAC, 0x15, 0x49, 0xF7, 0xF9, 0x2F, 0xDC, 0x77, 0xDC, 0xC8, 0x7D, 0x7C,
+    0x19, 0xFD, 0x83, 0xE8, 0xCC, 0x7F, 0x60, 0x3F, 0xFF, 0x4F, 0xAF, 0x7E, 0xFE, 0x9F, 0xBE, 0x40,
+    0xDA, 0xA5, 0xC9, 0x83, 0xFC, 0x3B, 0xFB, 0xF9, 0x27, 0x92, 0xCF, 0xC6, 0x4F, 0xFE, 0xDC, 0xAE,
+    0x15, 0x5F, 0x3B, 0xBE, 0xFA, 0xBB, 0xEF, 0xF6, 0x7B, 0x77, 0xD7, 0x8A, 0xD4, 0xB9, 0x3F, 0xE5,
+    0xF3, 0x3C, 0x41, 0x13, 0x5D, 0x2B, 0xCE, 0x70, 0x9C, 0xE3, 0x1C, 0x4F, 0xAF, 0xDD, 0x7F, 0xF7,
+    0x13, 0xB7, 0x3F, 0x71, 0xFC, 0x89, 0xE3, 0xF7, 0xDD, 0x7E, 0xEF, 0x6E, 0x54, 0x7C, 0x8D, 0xFB,
+    0xB8, 0x8F, 0xFF, 0xA4, 0x5F, 0xBF, 0xFD, 0xBE, 0x74, 0xF5, 0x77, 0x47, 0xF4, 0x8F, 0x7E, 0x31,
+    0xDC, 0x9D, 0x7E, 0xFB, 0x6A, 0x64, 0xFF, 0x63, 0xFB, 0xC4, 0xDF, 0x79, 0xE2, 0xF3, 0xEA, 0xF3,
+    0x09, 0x57, 0x23, 0xFB, 0xB5, 0xE2, 0x8E, 0xDB, 0xFE, 0xD1, 0x0F, 0x9B, 0xE7, 0x52, 0x9E, 0x4B,
+    0x79, 0x2E, 0x02, 0x9A, 0xBC, 0x6D, 0x3E, 0x4B, 0xF3, 0x59, 0x9A, 0x74, 0xE7, 0xE4, 0xD7, 0x92,
+    0xCF, 0xAA, 0x27, 0xAD, 0xBD, 0xEF, 0xB9, 0xE3, 0xF7, 0xF1, 0xFF, 0xB0, 0x41, 0xC4, 0x97, 0x3E,
+    0xA3, 0x1E, 0xE2, 0xBF, 0x25, 0x2D, 0x54, 0xAB, 0xFE, 0x59, 0x6C, 0x9B, 0xE2, 0xB6, 0xF8, 0x99,
+    0x20, 0x31, 0xED, 0x06, 0xB1, 0x2E, 0xB5, 0x1C, 0x84, 0x42, 0xFD, 0x36, 0xE2, 0xD2, 0x6A, 0x09,
+    0xC6, 0x38, 0x91, 0x22, 0x0D, 0x24, 0x0F, 0x6D, 0x14, 0x44, 0x78, 0xC3, 0x3E, 0xE6, 0xE5, 0x48,
+    0xF1, 0xDA, 0x66, 0xC8, 0x27, 0x56, 0xA1, 0x44, 0xC4, 0xA2, 0xAF, 0x53, 0x5B, 0x0C, 0x98, 0x0A,
+    0x0F, 0xE5, 0x08, 0x60, 0x0F, 0x48, 0xF6, 0x00, 0x69, 0xF7, 0x04, 0x88, 0x5E, 0xE4, 0xD1, 0x16,
+    0xDD, 0x60, 0xA2, 0x4D, 0x01, 0xAF, 0xC5, 0xA1, 0x9C, 0x59, 0xC2, 0x81, 0x8F, 0x2D, 0xB3, 0xB7,
+    0x14, 0xD7, 0xEB, 0x10, 0x33, 0xF9, 0x61, 0x95, 0xFB, 0x58, 0xBB, 0x55, 0x7F, 0x7D, 0x1D, 0x23,
+    0xE2, 0xB2, 0xE5, 0x6C, 0x48, 0x06, 0xA2, 0x4A, 0xC6, 0x30, 0x7C, 0xD5, 0x8D, 0x82, 0x69, 0xDA,
+    0x8E, 0x92, 0xAA, 0xBE, 0x36, 0x9B, 0x15, 0x22, 0xE2, 0xB5, 0x88, 0xD8, 0x61, 0x05, 0x99, 0xDB,
+    0xDD, 0x4F, 0xF4, 0xB0, 0x8A, 0x45, 0xCF, 0xDA, 0xD1, 0xB0, 0xA0, 0xE4, 0xE9, 0x47, 0x9B, 0x34,
+    0x44, 0xE6, 0x49, 0xC5, 0x2A, 0xE3, 0xD2, 0x6F, 0xD1, 0x0F, 0x94, 0x8D, 0x7E, 0xA0, 0xB9, 0xBF,
+    0xF5, 0x02, 0xE9, 0x77, 0xAE, 0xBC, 0xDD, 0xF9, 0xC5, 0x1F, 0x1D, 0x1F, 0x21, 0xD5, 0x1F, 0x11,
+    0x32, 0x7F, 0xE4, 0x80, 0xD4, 0x86, 0x36, 0xFE, 0xB5, 0x37, 0xF9, 0x7F, 0xF7, 0xA8, 0xAB, 0x97,
+    0xA9, 0x14, 0x6B, 0x61, 0x4E, 0x5B, 0x06, 0xDF, 0xDC, 0x4D, 0xFB, 0x82, 0xE9, 0x07, 0xED, 0xF3,
+    0xD5, 0x9E, 0xFD, 0x7D, 0x39, 0x3B, 0x1D, 0xF6, 0x22, 0x05, 0x06, 0x4A, 0x11, 0x87, 0x81, 0x29,
+    0xA7, 0x7C, 0xD8, 0x33, 0x8C, 0xFB, 0xDD, 0x71, 0x5F, 0x32, 0x81, 0x29, 0x98, 0xFD, 0xFD, 0xF6,
+    0x58, 0x3E, 0x1F, 0xCF, 0xF7, 0x30, 0x45, 0xF9, 0x8B, 0x3D, 0x94, 0xB3, 0xBA, 0x13, 0x07, 0xA5,
+    0x88, 0x95, 0x06, 0x4A, 0xD9, 0xE3, 0xC4, 0xD1, 0x2C, 0xC9, 0x63, 0x17, 0x5B, 0x75, 0xB3, 0x8F,
+    0xF7, 0xB1, 0x09, 0xED, 0x1B, 0x26, 0xF9, 0x9D, 0x71, 0xB2, 0xB7, 0xCB, 0xCD, 0xCD, 0xC7, 0xDE,
+    0xF8, 0x07, 0x12, 0x4E, 0x56, 0x63, 0xE8, 0xB0, 0x1E, 0x87, 0xC2, 0x22, 0x7C, 0x4C, 0xDF, 0x3A,
+    0xF2, 0x51, 0x07, 0x46, 0x11, 0x8D, 0x27, 0x97, 0x4F, 0x59, 0x58, 0xCE, 0x6A, 0x17, 0x12, 0xFB,
+    0xF5, 0xDA, 0x82, 0xC8, 0xEB, 0xD4, 0x12, 0xE2, 0x6F, 0x64, 0x08, 0x87, 0xE3, 0x90, 0x1F, 0xF3,
+    0x0D, 0xDE, 0xFA, 0xF0, 0xE4, 0x19, 0x42, 0x3A, 0x63, 0x44, 0xA4, 0x43, 0x5F, 0xA7, 0xB4, 0x78,
+    0x18, 0xD0, 0x96, 0xC4, 0x85, 0xF1, 0x1E, 0x18, 0xC0, 0x47, 0x3B, 0xE4, 0xAE, 0x02, 0x92, 0x6E,
+    0xEC, 0xDB, 0xF9, 0x2A, 0x15, 0xEF, 0xF3, 0x1C, 0x89, 0xF2, 0xCA, 0x1F, 0x0E, 0x40, 0x79, 0x06,
+    0x6D, 0xC9, 0xAB, 0x11, 0x7F, 0xE0, 0x47, 0x44, 0x42, 0xE2, 0xF0, 0x78, 0xB4, 0x35, 0x05, 0x22,
+    0x0E, 0x2D, 0x43, 0x80, 0x8D, 0x69, 0x6B, 0x2A, 0x3C, 0x03, 0xDA, 0xA6, 0x0E, 0x8F, 0xA9, 0xB4,
+    0x8D, 0x3C, 0x9E, 0xD4, 0x69, 0x8B, 0x59, 0xC1, 0x20, 0xD2, 0x7D, 0xA0, 0xBC, 0xE7, 0xAE, 0x6A,
+    0x15, 0x90, 0x67, 0x8A, 0x15, 0x2B, 0x9C, 0x30, 0xA2, 0xD3, 0x0F, 0xC7, 0x9D, 0x89, 0x03, 0x2D,
+    0x16, 0x6A, 0x81, 0x44, 0x3C, 0x18, 0x71, 0xC4, 0xBF, 0x12, 0x4B, 0xF6, 0x94, 0x80, 0x37, 0x9E,
+    0xB4, 0x11, 0xC7, 0x44, 0x89, 0x55, 0x4E, 0x0B, 0x59, 0x61, 0x3C, 0x1E, 0x71, 0xDA, 0x2A, 0xB1,
+    0x53, 0xB4, 0x28, 0x87, 0xF1, 0x39, 0xC8, 0x2F, 0x7A, 0x94, 0xBC, 0x64, 0xD1, 0xB2, 0x00, 0x23,
+    0x2D, 0x88, 0x80, 0x92, 0x6E, 0xBC, 0x87, 0x59, 0x85, 0xF0, 0x69, 0x1B, 0x42, 0x65, 0xC9, 0xC4,
+    0xAD, 0x92, 0x59, 0xEE, 0xC3, 0xA9, 0x7A, 0x02, 0xF0, 0x07, 0x93, 0xB6, 0xA3, 0xC1, 0x47, 0xDB,
+    0xBC, 0x0A, 0x16, 0x1F, 0xE5, 0xD8, 0x25, 0xEA, 0xD1, 0x96, 0x81, 0xB8, 0xA7, 0x5C, 0xA5, 0x1B,
+    0x6A, 0xB5, 0x1D, 0x33, 0x11, 0xE5, 0xE7, 0x1D, 0xC1, 0xE4, 0x1A, 0x52, 0x78, 0xE8, 0x90, 0x4A,
+    0xA4, 0x58, 0x19, 0x0D, 0x75, 0xB3, 0x62, 0x77, 0x49, 0x07, 0xF1, 0xA5, 0x1E, 0x22, 0xE9, 0x81,
+    0xB2, 0x1B, 0x85, 0x7D, 0xE6, 0x10, 0xBF, 0xE3, 0x08, 0x1D, 0xD4, 0x98, 0x31, 0x4F, 0x85, 0xFA,
+    0x44, 0x8B, 0x6E, 0xCC, 0x66, 0x97, 0x5E, 0x12, 0x11, 0x31, 0x22, 0xE2, 0xDF, 0xD7, 0xA9, 0x18,
+    0x8D, 0xD3, 0x0A, 0x66, 0x15, 0xDE, 0xD2, 0x8E, 0xD6, 0xA8, 0xB3, 0x87, 0xA3, 0xAF, 0x89, 0x44,
+    0x9A, 0x64, 0xEF, 0x54, 0xA7, 0x9B, 0xC8, 0xE7, 0x15, 0x83, 0x09, 0xB1, 0x8C, 0x65, 0x39, 0x9B,
+    0x49, 0x29, 0x22, 0xE5, 0x6C, 0x36, 0x9B, 0x1E, 0xC2, 0x28, 0xE6, 0x55, 0xC8, 0x7C, 0x93, 0x0C,
+    0xD1, 0x3C, 0x12, 0xF1, 0xE4, 0xF2, 0x3A, 0x9C, 0xE1, 0x48, 0x7C, 0xDB, 0xB1, 0x7A, 0x76, 0x01,
+    0x11, 0x21, 0x15, 0x71, 0x37, 0xC5, 0xB7, 0x99, 0x4C, 0x1A, 0xF5, 0xEE, 0x91, 0xF8, 0xB6, 0xEA,
+    0xD7, 0x8D, 0x6F, 0x5B, 0x4D, 0xD1, 0x47, 0x0E, 0xD2, 0x96, 0xE8, 0xA2, 0x1F, 0xE7, 0x0E, 0xD9,
+    0x81, 0x67, 0x89, 0x3D, 0x89, 0x43, 0x5B, 0xF2, 0x83, 0x9E, 0x6C, 0x44, 0x8C, 0x88, 0x99, 0xCD,
+    0x3E, 0x56, 0x10, 0xCB, 0x38, 0x27, 0x17, 0x99, 0x48, 0x24, 0x9B, 0xCF, 0xEB, 0x16, 0x76, 0x0F,
+    0x62, 0x21, 0xCA, 0xCD, 0xCD, 0x48, 0x64, 0x48, 0x44, 0xBA, 0xEC, 0x20, 0xBB, 0x54, 0xDC, 0x87,
+    0x39, 0x35, 0xDD, 0x8B, 0x2E, 0xA4, 0x22, 0xD5, 0x31, 0x19, 0xC6, 0xB0, 0x53, 0x72, 0x69, 0x32,
+    0x91, 0xF3, 0x7B, 0x8F, 0xB8, 0x45, 0x60, 0xA1, 0xBB, 0xC1, 0x6A, 0x9D, 0xED, 0x05, 0xA0, 0xDD,
+    0xD6, 0x10, 0xAC, 0x9D, 0x79, 0x60, 0x4F, 0xA9, 0x05, 0xFF, 0x17, 0x94, 0xDF, 0x15, 0x71, 0xB9,
+    0x74, 0xAC, 0x9D, 0xE6, 0xCE, 0xEC, 0xAA, 0xEB, 0x01, 0xFA, 0x5B, 0x46, 0x2F, 0x70, 0xE7, 0x9D,
+    0x93, 0x89, 0x31, 0x1B, 0x1B, 0xAB, 0xD8, 0xB7, 0x0F, 0xFF, 0xE3, 0x4E, 0x32, 0x9B, 0xB8, 0x83,
+    0xF0, 0xD7, 0xFE, 0xE3, 0x4D, 0x92, 0x13, 0xF2, 0xFF, 0x7E, 0xEB, 0x8A, 0xB4, 0x75, 0x33, 0x4E,
+    0x46, 0xFB, 0xBB, 0xE9, 0xAC, 0x0E, 0xA3, 0x24, 0xBF, 0xE5, 0xEE, 0xE9, 0x02, 0x3C, 0xB9, 0x48,
+    0x11, 0x76, 0x2D, 0x9E, 0xBC, 0x38, 0xD5, 0xD3, 0x93, 0x17, 0x91, 0xA7, 0x27, 0x2F, 0xF0, 0x74,
+    0xE4, 0x05, 0x3E, 0x0A, 0x3B, 0xE5, 0xC8, 0x8B, 0xB8, 0xFF, 0x1F, 0x1D, 0xF9, 0xD3, 0x5B, 0x4E,
+    0x1A, 0x72, 0x91, 0x46, 0x0A, 0x72, 0xD9, 0x3B, 0x84, 0x2E, 0xDF, 0x06, 0x3C, 0x21, 0x5F, 0x18,
+    0x21, 0x55, 0x0A, 0x79, 0x90, 0x3D, 0x16, 0xEF, 0xF9, 0x4A, 0x44, 0x64, 0x0F, 0x23, 0x22, 0x22,
+    0xC5, 0x72, 0x76, 0xF1, 0xC6, 0x4C, 0x1E, 0x74, 0xA4, 0x0D, 0x75, 0xF8, 0x95, 0x37, 0xB0, 0x40,
+    0x39, 0x4F, 0xDC, 0xA1, 0xAF, 0x1C, 0x7C, 0xF5, 0xF4, 0x56, 0x67, 0xA0, 0x16, 0x29, 0x3C, 0xB1,
+    0x48, 0xF3, 0x9E, 0x31, 0xF1, 0x0C, 0x22, 0x52, 0xDD, 0x22, 0xE6, 0xD3, 0x64, 0xD2, 0xAE, 0xC6,
+    0xC4, 0xF0, 0x1B, 0x8F, 0x89, 0xBB, 0xAA, 0x30, 0xEA, 0x87, 0x30, 0xE0, 0x55, 0xC3, 0x61, 0xD7,
+    0xC6, 0x84, 0xA8, 0x37, 0x28, 0x67, 0x48, 0x1B, 0x43, 0x56, 0x85, 0xA0, 0x9B, 0x01, 0x13, 0xF5,
+    0x98, 0x6F, 0xB8, 0x10, 0x5C, 0x24, 0x6D, 0x08, 0x3A, 0x8A, 0x3C, 0x86, 0x5D, 0x0C, 0xA6, 0x30,
+    0x64, 0xD6, 0x90, 0x1E, 0x09, 0x30, 0xA2, 0x1C, 0xFD, 0x08, 0x49, 0x33, 0x66, 0x2E, 0x7C, 0xFE,
+    0x30, 0xA8, 0x7F, 0x39, 0x21, 0x96, 0x09, 0x4A, 0x26, 0xA4, 0x32, 0x21, 0x2B, 0x27, 0x18, 0x33,
+    0xE1, 0x9C, 0x99, 0xD0, 0x9B, 0x49, 0xEC, 0xCC, 0x24, 0x69, 0xCC, 0x44, 0x5B, 0x33, 0xC9, 0x0A,
+    0x33, 0x99, 0x60, 0x26, 0x73, 0x8C, 0xE9, 0x31, 0xC6, 0x61, 0x4C, 0x83, 0x31, 0x16, 0x13, 0x5D,
+    0x88, 0x77, 0xD8, 0xA0, 0x47, 0xFF, 0xC8, 0x07, 0x6C, 0xC6, 0xB1, 0xBF, 0xFD, 0x80, 0x04, 0x80,
+    0x25, 0xEA, 0x83, 0x12, 0x00, 0xFE, 0xE8, 0x23, 0x25, 0x00, 0x34, 0x63, 0xB5, 0xB2, 0x86, 0x63,
+    0xF5, 0x98, 0x00, 0xB0, 0x6C, 0xC6, 0xBE, 0x64, 0xC2, 0x34, 0xF3, 0xF1, 0xD7, 0xCD, 0xCD, 0xC1,
+    0x88, 0x0C, 0x46, 0x64, 0x20, 0x69, 0x39, 0xB2, 0xC6, 0x3B, 0x18, 0xC8, 0x0B, 0x92, 0xD7, 0x5C,
+    0x30, 0x4B, 0x9B, 0x60, 0xBA, 0x7D, 0xCD, 0x11, 0xF5, 0x63, 0x38, 0xB9, 0x25, 0xFD, 0xEB, 0x3E,
+    0x88, 0x3A, 0x21, 0x85, 0x71, 0xFA, 0x23, 0x0F, 0x03, 0x78, 0x6D, 0xC9, 0x5A, 0xB4, 0x1D, 0x50,
+    0x12, 0x72, 0x04, 0x19, 0x47, 0x56, 0x95, 0xA4, 0x52, 0xC4, 0x9D, 0x72, 0x0C, 0x3D, 0x86, 0xBC,
+    0xC8, 0x9E, 0xB2, 0xCA, 0x45, 0x3E, 0x76, 0x03, 0x53, 0xB4, 0x35, 0x49, 0x9B, 0x36, 0x2C, 0x92,
+    0xC6, 0xE0, 0x49, 0xDC, 0x3C, 0xEE, 0xB2, 0x0A, 0xA3, 0xAD, 0x7E, 0xD1, 0x11, 0xED, 0x75, 0x01,
+    0x47, 0xFB, 0x16, 0xC9, 0xBB, 0x0D, 0x94, 0x2D, 0xC6, 0x83, 0x1A, 0x88, 0xA4, 0x58, 0xA5, 0xD1,
+    0x3E, 0x70, 0x95, 0x29, 0x47, 0xF2, 0x4A, 0x8B, 0x81, 0xC5, 0x84, 0xB8, 0x23, 0x7D, 0xD9, 0x91,
+    0x17, 0xCC, 0x0D, 0x51, 0x8F, 0x7E, 0xD1, 0x91, 0x55, 0xF8, 0xAC, 0xC0, 0x93, 0x55, 0x3D, 0x99,
+    0x8D, 0x3B, 0x6D, 0xD5, 0x80, 0x61, 0x41, 0xD9, 0xAA, 0x36, 0x69, 0xB5, 0xB0, 0xC0, 0x44, 0xD7,
+    0x3B, 0x6D, 0xA3, 0x2E, 0xD7, 0x2F, 0xF4, 0xE8, 0x2B, 0xCD, 0xDC, 0xC0, 0x62, 0xAE, 0xDE, 0x6C,
+    0x51, 0x52, 0xE4, 0x1E, 0x32, 0x87, 0x14, 0x30, 0x90, 0xB6, 0xAB, 0x68, 0x84, 0x66, 0xEC, 0x07,
+    0xD1, 0xE6, 0x72, 0xF3, 0x34, 0x75, 0x98, 0x93, 0x44, 0x56, 0xB9, 0xA7, 0x16, 0x2B, 0x5F, 0xD0,
+    0x78, 0xE6, 0x72, 0x16, 0xB2, 0x2E, 0x55, 0xE4, 0x22, 0x9E, 0xB4, 0xA1, 0xB6, 0x71, 0x87, 0xEA,
+    0x58, 0xC0, 0x2E, 0x79, 0x41, 0x56, 0xA5, 0x0D, 0x49, 0x1B, 0x77, 0xC4, 0x3D, 0x0B, 0x18, 0xC8,
+    0x0B, 0x84, 0xF4, 0xDA, 0x45, 0x29, 0x62, 0x11, 0x29, 0x42, 0xEE, 0xA4, 0x33, 0xFB, 0xD2, 0xE1,
+    0xFE, 0xA6, 0x96, 0x00, 0x6E, 0xAE, 0x78, 0x7C, 0x39, 0x2B, 0x6E, 0xFE, 0x36, 0x6C, 0x96, 0xB3,
+    0x33, 0x20, 0x22, 0x4D, 0x90, 0x21, 0x3D, 0xB1, 0x0F, 0x22, 0xA4, 0x1F, 0xF3, 0x5B, 0x2F, 0xF0,
+    0x44, 0x9E, 0x61, 0xF3, 0xB1, 0x7E, 0x95, 0xC2, 0x6A, 0x15, 0xBF, 0x16, 0x3B, 0x38, 0x26, 0x83,
+    0xB6, 0x44, 0x22, 0x52, 0x43, 0xBE, 0xBC, 0xE8, 0x3D, 0xF1, 0x12, 0xFE, 0xA1, 0x23, 0x0B, 0xF9,
+    0x69, 0x97, 0x80, 0x09, 0x9E, 0x2B, 0x4F, 0x5E, 0x81, 0x72, 0x41, 0x89, 0xB3, 0x81, 0xE9, 0x5C,
+    0xAB, 0xAF, 0xCD, 0x66, 0x41, 0xCE, 0xF6, 0xC1, 0xF4, 0xE0, 0xB4, 0x4D, 0x02, 0x3F, 0xD2, 0x21,
+    0xB7, 0xE0, 0xC8, 0xB3, 0xC2, 0xAF, 0xE2, 0x00, 0x8C, 0x1E, 0x07, 0x48, 0x1A, 0x38, 0xA5, 0xEE,
+    0x82, 0xAC, 0xBD, 0xDC, 0xDC, 0x32, 0x41, 0x26, 0xF6, 0x70, 0x4C, 0xA4, 0xD9, 0x57, 0x69, 0x83,
+    0xB5, 0xE3, 0x98, 0xF4, 0x86, 0x58, 0xE4, 0x65, 0x47, 0xFD, 0xF4, 0xDC, 0x04, 0x0F, 0x85, 0xEA,
+    0xC6, 0x58, 0x7D, 0xE5, 0x92, 0x16, 0xCC, 0xE6, 0x72, 0x73, 0x53, 0x89, 0x88, 0x38, 0x23, 0x22,
+    0xA2, 0x42, 0xE6, 0xAB, 0x30, 0xB1, 0x86, 0xD7, 0x73, 0x84, 0xBC, 0x89, 0x41, 0x7A, 0xDE, 0x3B,
+    0xF6, 0xB2, 0xC3, 0xC8, 0x60, 0xA0, 0x94, 0xEA, 0x50, 0xCE, 0x52, 0xA8, 0x0B, 0x08, 0x51, 0x64,
+    0x64, 0x81, 0xE2, 0x3D, 0x63, 0xA6, 0x61, 0xF2, 0x87, 0x1A, 0xC2, 0x48, 0x21, 0x6D, 0x02, 0xF3,
+    0x9F, 0x42, 0xB4, 0x9C, 0x8D, 0x7A, 0x01, 0xE1, 0x85, 0x24, 0x71, 0x37, 0x49, 0x1B, 0xB4, 0xED,
+    0x33, 0xCB, 0x54, 0xB5, 0x06, 0xE5, 0x74, 0x35, 0x25, 0xB3, 0x13, 0x3C, 0x0B, 0xFA, 0xB8, 0x53,
+    0x4E, 0xB5, 0x89, 0xCB, 0x2B, 0x5D, 0xE9, 0xC6, 0x33, 0x21, 0xFB, 0x4E, 0x4B, 0x8F, 0x31, 0x85,
+    0x6A, 0xD9, 0x0D, 0xD1, 0xA6, 0xDA, 0x03, 0xD3, 0x0E, 0xE2, 0x77, 0x5A, 0xD0, 0xDF, 0xB5, 0x30,
+    0xD7, 0x55, 0x60, 0xD0, 0x59, 0xB5, 0x80, 0x31, 0xC3, 0x56, 0x47, 0xFE, 0xF0, 0xD5, 0x16, 0x6F,
+    0xB4, 0x4D, 0x1B, 0x9F, 0x55, 0x46, 0x39, 0x13, 0xF5, 0xDA, 0x2E, 0xB4, 0x35, 0x78, 0x83, 0x8F,
+    0x7F, 0xD9, 0x29, 0x97, 0xB4, 0x73, 0x56, 0xD1, 0xF1, 0x49, 0x18, 0xFF, 0xDA, 0x83, 0x87, 0x6C,
+    0x08, 0x21, 0xBC, 0xC1, 0x27, 0x63, 0xF2, 0x02, 0x0F, 0xDB, 0x59, 0x85, 0x0F, 0x35, 0xF5, 0x44,
+    0x7D, 0xDA, 0xE2, 0x89, 0x3B, 0xE5, 0x90, 0xD9, 0xC5, 0x1B, 0x17, 0xBB, 0xB1, 0xE5, 0x57, 0x3B,
+    0x4F, 0x76, 0xDE, 0xED, 0xE2, 0x31, 0x0F, 0x3A, 0x83, 0xA7, 0x54, 0x2E, 0x2F, 0x3C, 0x0B, 0xE5,
+    0x32, 0xEB, 0xF1, 0xCA, 0xE9, 0xC6, 0xC7, 0xBD, 0x72, 0x69, 0xEB, 0x95, 0x53, 0x4E, 0x39, 0x9F,
+    0x38, 0xE5, 0xE2, 0xDE, 0xEB, 0x46, 0xB9, 0xC8, 0xFB, 0x10, 0x55, 0xEE, 0xF3, 0x4A, 0x39, 0xEA,
+    0x09, 0x94, 0x05, 0x13, 0x10, 0xCB, 0x84, 0xE8, 0x5D, 0xCB, 0x04, 0xF5, 0x4E, 0xCB, 0x04, 0xF5,
+    0xD7, 0x8E, 0x09, 0xE9, 0x0B, 0x3D, 0x13, 0x74, 0xE5, 0x31, 0x9B, 0x5B, 0x4F, 0x2F, 0xC2, 0x24,
+    0x3B, 0x6E, 0x27, 0xF8, 0x49, 0x56, 0x4D, 0xE8, 0x27, 0xDA, 0x4E, 0xE2, 0x6E, 0x92, 0x34, 0x13,
+    0xE5, 0x26, 0xCA, 0x4D, 0x92, 0x66, 0x12, 0x77, 0x13, 0x6D, 0x27, 0xF4, 0x93, 0xAC, 0x9A, 0xE0,
+    0x27, 0x86, 0x09, 0xD3, 0x44, 0x44, 0xA4, 0x3D, 0xBC, 0x8D, 0x03, 0x78, 0x75, 0x01, 0x25, 0x98,
+    0x22, 0x68, 0x96, 0xAA, 0x23, 0x80, 0x18, 0x89, 0x7C, 0x5E, 0x01, 0xBB, 0x53, 0x20, 0xE4, 0x26,
+    0xC9, 0x44, 0x7A, 0xA8, 0xE5, 0xDD, 0x25, 0x0C, 0x49, 0x6B, 0x8A, 0xB8, 0x4F, 0xDA, 0xCC, 0x2A,
+    0x97, 0xB4, 0xBA, 0x49, 0x5C, 0xD2, 0x26, 0x6D, 0xDA, 0x24, 0xAD, 0x72, 0xDA, 0x26, 0xAD, 0xEA,
+    0x32, 0x9B, 0xB4, 0x71, 0x9F, 0x57, 0x49, 0x8B, 0x37, 0x45, 0xD2, 0xE2, 0x0D, 0x49, 0xCB, 0x62,
+    0x4A, 0xD2, 0x32, 0x0D, 0x96, 0xA4, 0x5A, 0x44, 0x6C, 0xC8, 0xE3, 0xA9, 0x2D, 0x8B, 0x51, 0xCB,
+    0x08, 0xE9, 0x3F, 0x93, 0x9F, 0xF6, 0x40, 0x5E, 0x17, 0x60, 0x44, 0x0A, 0xF4, 0xBB, 0xEF, 0x0E,
+    0xA8, 0x2E, 0x57, 0x8E, 0x69, 0xEC, 0xB2, 0x2A, 0x6D, 0x72, 0x3C, 0x3E, 0x76, 0x69, 0x93, 0x15,
+    0x39, 0x13, 0xE5, 0x62, 0xA7, 0xDC, 0x84, 0x9C, 0xEC, 0xA1, 0x26, 0x76, 0xF8, 0x39, 0xB5, 0x88,
+    0x0C, 0xDA, 0xA6, 0x22, 0x22, 0x8D, 0x5F, 0x7D, 0x54, 0x5D, 0xD0, 0x77, 0xB4, 0x0D, 0xFA, 0x8C,
+    0x21, 0xF2, 0x81, 0x89, 0x98, 0xFD, 0x32, 0x0F, 0xF9, 0xF9, 0x0E, 0x6D, 0x61, 0x58, 0x80, 0xCC,
+    0x66, 0x97, 0xE4, 0xAF, 0x46, 0x9B, 0xFA, 0xD8, 0x27, 0xA4, 0xD1, 0x36, 0x1A, 0xD2, 0xA6, 0xC4,
+    0x63, 0x8A, 0x45, 0xD4, 0x6B, 0x9B, 0xB8, 0xB4, 0xD1, 0xD6, 0xB3, 0x60, 0xC1, 0x42, 0x5B, 0x6D,
+    0xD3, 0x26, 0x69, 0x3D, 0x9E, 0x05, 0x46, 0xDB, 0xBC, 0x4A, 0x9B, 0xB8, 0xF3, 0xCA, 0xB1, 0x20,
+    0x7B, 0xCA, 0x1A, 0xD2, 0x06, 0xEF, 0x93, 0x96, 0x05, 0xFA, 0x25, 0x3B, 0x90, 0x36, 0x6C, 0x4F,
+    0x62, 0x11, 0x11, 0xFA, 0x54, 0x44, 0xBC, 0x6A, 0xF5, 0xB5, 0xD9, 0xA5, 0x46, 0x57, 0xDA, 0xB2,
+    0x60, 0x82, 0xB6, 0x69, 0x43, 0x8F, 0xB6, 0xBB, 0xA8, 0x96, 0xEC, 0x3B, 0x2D, 0xFA, 0xC7, 0x9B,
+    0x5B, 0x12, 0xDE, 0x09, 0x10, 0x38, 0x64, 0x5D, 0x37, 0xAA, 0x4D, 0x9B, 0xB9, 0xB6, 0xBA, 0x32,
+    0xB1, 0xCB, 0xAA, 0x49, 0xDC, 0xA5, 0xD6, 0xD0, 0x6B, 0x9B, 0xB3, 0x50, 0xED, 0x94, 0x39, 0x5E,
+    0x9F, 0x0F, 0xA4, 0xD2, 0x55, 0x6A, 0x93, 0xB6, 0x5F, 0x90, 0xA3, 0x6D, 0x54, 0x70, 0x9A, 0x3E,
+    0x5A, 0xA2, 0x5F, 0x58, 0x16, 0xD1, 0xD0, 0x07, 0x84, 0xD8, 0x96, 0xEC, 0x44, 0x22, 0x12, 0xC9,
+    0xD3, 0x5B, 0x6E, 0x23, 0x24, 0x91, 0x7A, 0x4F, 0x90, 0xAA, 0xA9, 0xA0, 0xAC, 0x8E, 0xCF, 0xA4,
+    0x50, 0x41, 0x97, 0xEE, 0xC7, 0x8C, 0x8E, 0xF1, 0x7E, 0x02, 0xAA, 0x15, 0xCC, 0x7A, 0x77, 0x2C,
+    0x30, 0x96, 0x93, 0x75, 0x73, 0x4A, 0xA4, 0x31, 0xB2, 0x2C, 0xF2, 0x37, 0x82, 0xBA, 0xA8, 0x1C,
+    0xB0, 0x2C, 0xD6, 0x4E, 0x67, 0x22, 0xF2, 0x82, 0x88, 0xB8, 0x68, 0x73, 0xF3, 0x9F, 0x1C, 0x8A,
+    0xC2, 0xCE, 0x6C, 0x1E, 0x0B, 0x66, 0xAB, 0xC2, 0x74, 0x9C, 0x92, 0x2E, 0x12, 0xF1, 0xEA, 0x8D,
+    0x53, 0x63, 0x9A, 0xDE, 0xD4, 0x42, 0x0E, 0x51, 0xCF, 0xE3, 0x75, 0x15, 0x4B, 0x47, 0x2A, 0xFD,
+    0xE8, 0x43, 0x3E, 0x94, 0xC8, 0x77, 0x17, 0x1E, 0x73, 0xA7, 0x44, 0xBE, 0x2E, 0xD2, 0x66, 0x6F,
+    0x04, 0x25, 0xD4, 0x41, 0x72, 0x63, 0xF6, 0x83, 0x54, 0x64, 0x79, 0x2C, 0x3C, 0x3E, 0x9E, 0x9C,
+    0xF4, 0x55, 0xAB, 0x1C, 0x0B, 0x8F, 0xF9, 0xF0, 0x43, 0xFD, 0xAA, 0x55, 0x0E, 0x3F, 0x60, 0xD0,
+    0x3F, 0x6C, 0x95, 0xC3, 0x1B, 0x0C, 0xF9, 0xF9, 0x5E, 0xB9, 0xC4, 0xE9, 0xCE, 0xC4, 0x4B, 0x4A,
+    0x19, 0xE7, 0xBB, 0x06, 0xFE, 0xF1, 0x72, 0xDF, 0x60, 0x30, 0xE6, 0x00, 0xBE, 0xE5, 0xE1, 0xC9,
+    0x7D, 0x6B, 0xCA, 0x68, 0x16, 0xDF, 0xFF, 0xFE, 0x68, 0xE1, 0x36, 0x86, 0x49, 0x56, 0x69, 0xAB,
+    0xAF, 0xB6, 0xCA, 0xA9, 0x5F, 0xF4, 0x78, 0x16, 0x53, 0x0C, 0xD9, 0x63, 0x95, 0xB6, 0xC9, 0x9B,
+    0xAD, 0x72, 0xD1, 0x5E, 0x8F, 0x67, 0x32, 0xC5, 0xA0, 0xBF, 0x57, 0x69, 0xAB, 0xDE, 0x6C, 0x95,
+    0x8B, 0xFA, 0x1E, 0xCF, 0xC2, 0x60, 0x30, 0xBA, 0xD1, 0x36, 0x7B, 0xC1, 0x2B, 0x97, 0x35, 0xF9,
+    0xEB, 0x43, 0xD9, 0xC6, 0x22, 0xD2, 0x70, 0x4A, 0xA4, 0x1A, 0x81, 0x1D, 0xEF, 0x7B, 0xF7, 0xC3,
+    0x85, 0x1F, 0x1C, 0x54, 0x96, 0x7E, 0x60, 0x50, 0xD9, 0x1B, 0x9B, 0x9B, 0x9B, 0xB5, 0x1C, 0x2C,
+    0x07, 0xA1, 0x66, 0xBF, 0xC9, 0xBB, 0x15, 0x42, 0xF4, 0x52, 0x88, 0x1C, 0xDB, 0x0A, 0x91, 0x63,
+    0xFD, 0x91, 0xC8, 0xB1, 0xCD, 0xCD, 0xC7, 0x5E, 0x96, 0x20, 0x69, 0xCA, 0x4D, 0x91, 0x63, 0x15,
+    0x79, 0x35, 0x90, 0x38, 0xB5, 0x17, 0xDF, 0x14, 0x39, 0x36, 0x07, 0xB2, 0xB7, 0x7B, 0x88, 0xE4,
+    0x8A, 0x03, 0xFD, 0x4B, 0xDD, 0x40, 0x49, 0x56, 0xA1, 0xBA, 0xD1, 0x9C, 0xBD, 0x80, 0x29, 0x51,
+    0x3F, 0x62, 0x8E, 0xB5, 0x25, 0x6D, 0x98, 0x42, 0x66, 0x43, 0xAA, 0xDC, 0xD0, 0x19, 0xA7, 0x80,
+    0x0F, 0xFA, 0x54, 0x30, 0x3B, 0x4C, 0x19, 0xEF, 0x8E, 0x79, 0xD8, 0x02, 0xD3, 0x09, 0xC0, 0xD0,
+    0x01, 0xE1, 0x2D, 0x3C, 0x89, 0x40, 0xB0, 0xFB, 0x8E, 0x69, 0x60, 0xC7, 0x20, 0xAC, 0x7A, 0x17,
+    0xF2, 0x77, 0x1C, 0xEA, 0xBA, 0x29, 0x98, 0x8F, 0xAF, 0x1A, 0x8B, 0x3A, 0x16, 0xE4, 0x24, 0xED,
+    0x88, 0x2C, 0x8A, 0xBB, 0x34, 0xC4, 0xED, 0xE0, 0x75, 0x45, 0xF2, 0x97, 0x5D, 0x30, 0x96, 0xC4,
+    0xEF, 0xB4, 0x90, 0x2D, 0xC6, 0x78, 0xF2, 0xB4, 0x87, 0xF8, 0xC2, 0x57, 0x80, 0xB4, 0xDD, 0x85,
+    0x70, 0x3E, 0xDA, 0xF6, 0x80, 0x2E, 0x3A, 0x20, 0xA5, 0x3D, 0x82, 0x64, 0xF9, 0xFD, 0xA1, 0xC6,
+    0x5D, 0x0F, 0x5C, 0x20, 0xF2, 0x99, 0x25, 0x6D, 0x16, 0x90, 0x2B, 0x07, 0x97, 0x75, 0x45, 0x6C,
+    0xBF, 0x7A, 0xE4, 0x69, 0xD3, 0x77, 0x5B, 0x62, 0x31, 0x60, 0xFE, 0x7E, 0x47, 0x6A, 0xB3, 0x0A,
+    0x8F, 0x27, 0x2B, 0xD2, 0x26, 0x76, 0x4C, 0x31, 0x41, 0xD6, 0xCA, 0x8B, 0x79, 0x90, 0x0C, 0xB4,
+    0xED, 0x61, 0x3B, 0x2F, 0x82, 0x8D, 0x29, 0x9F, 0x40, 0xF4, 0x6E, 0x33, 0x0A, 0x2E, 0xF5, 0x91,
+    0x9C, 0xDE, 0xB9, 0xEC, 0xEC, 0x27, 0x79, 0x1C, 0x05, 0x7E, 0xF9, 0x59, 0xED, 0x46, 0xB7, 0xD4,
+    0xE8, 0x5F, 0xA4, 0x2C, 0xD0, 0xED, 0x2A, 0x29, 0x76, 0x18, 0x37, 0xDA, 0x82, 0x79, 0xB0, 0x85,
+    0x45, 0x09, 0x94, 0xDA, 0x06, 0xC8, 0x30, 0x3E, 0xAB, 0xC8, 0x9E, 0x6A, 0xC6, 0xDC, 0xDD, 0x3E,
+    0x84, 0xF8, 0x07, 0x85, 0x1A, 0xCC, 0x03, 0x9E, 0xEC, 0x41, 0x07, 0x0C, 0xCA, 0x05, 0x69, 0x4D,
+    0xB9, 0xA4, 0x55, 0x6D, 0x30, 0x63, 0x69, 0x9B, 0x17, 0x0B, 0xC2, 0xAC, 0xEA, 0xA3, 0x80, 0xBE,
+    0x99, 0xA8, 0x56, 0x39, 0x48, 0x5B, 0x7C, 0x8E, 0x6E, 0xC0, 0x10, 0x75, 0x9E, 0xCC, 0xA2, 0x7A,
+    0xD4, 0x6B, 0x0D, 0xA6, 0x21, 0xB7, 0xA4, 0x6F, 0x81, 0x79, 0xE3, 0xD1, 0x31, 0x6A, 0xDA, 0x84,
+    0x57, 0xCF, 0x34, 0x90, 0xC9, 0xCA, 0xDD, 0xC1, 0xE9, 0x95, 0xF1, 0x8C, 0xA3, 0xA3, 0xDF, 0x1C,
+    0x56, 0x37, 0x47, 0xB0, 0xF1, 0xEA, 0xCB, 0x7F, 0x35, 0xEC, 0x83, 0x8F, 0x9A, 0x43, 0x10, 0xDF,
+    0xA3, 0x71, 0x8B, 0x49, 0x0B, 0x8B, 0x48, 0xA4, 0x53, 0x0E, 0xBC, 0x1A, 0xBE, 0x31, 0xC4, 0xFD,
+    0x2A, 0x26, 0xD1, 0xA3, 0x5C, 0x66, 0xC9, 0xAB, 0x05, 0xCA, 0xE5, 0x05, 0xDA, 0x4E, 0xC3, 0xFB,
+    0x35, 0xB4, 0x35, 0x68, 0x6B, 0x40, 0x37, 0x79, 0x91, 0x55, 0x06, 0xD2, 0x46, 0xDB, 0xBC, 0x30,
+    0x90, 0x36, 0xA9, 0x35, 0x01, 0xC3, 0x94, 0xB4, 0xD3, 0xD0, 0x1F, 0x95, 0x9B, 0x8F, 0x29, 0x65,
+    0x42, 0xE5, 0xF3, 0x8A, 0xBD, 0x0E, 0xDD, 0x52, 0xC2, 0xAE, 0x43, 0xED, 0x1D, 0x1B, 0xA0, 0x6C,
+    0x43, 0xC8, 0x29, 0xA6, 0x09, 0x01, 0x95, 0xA1, 0x22, 0xA7, 0x57, 0xE6, 0xC3, 0x23, 0xB5, 0x35,
+    0x87, 0x90, 0x7D, 0x01, 0xDE, 0x35, 0x86, 0xD5, 0xC5, 0x8F, 0xB9, 0x9B, 0xEA, 0xAC, 0x82, 0x86,
+    0x72, 0xAC, 0x82, 0xA0, 0x4E, 0x87, 0x74, 0xC7, 0xE4, 0x22, 0x5D, 0x40, 0x85, 0xA1, 0x06, 0xDD,
+    0xD4, 0x85, 0x76, 0x90, 0xD9, 0xDC, 0x42, 0xEA, 0x42, 0x7A, 0xF0, 0x12, 0x88, 0xFB, 0x5D, 0x20,
+    0xF2, 0x21, 0xED, 0x5B, 0xC8, 0x00, 0xE7, 0xDF, 0xB3, 0x0D, 0xDF, 0xEE, 0xB2, 0x62, 0xB5, 0x71,
+    0x1F, 0xAE, 0x10, 0xAE, 0xA6, 0x5B, 0xC8, 0x9A, 0xC4, 0xA7, 0x4D, 0x5D, 0x45, 0x22, 0xEF, 0x2E,
+    0xA1, 0x14, 0xE9, 0xE0, 0x58, 0x30, 0x3E, 0xE5, 0x8E, 0x95, 0x0E, 0xC8, 0x97, 0x19, 0x73, 0x46,
+    0x9F, 0x0A, 0x71, 0xA8, 0x4B, 0xD4, 0x52, 0x6A, 0x9B, 0xB6, 0x7F, 0xAE, 0xDB, 0xCC, 0x86, 0x76,
+    0x08, 0xB9, 0x82, 0xFD, 0xFB, 0x6E, 0xF2, 0x82, 0xA8, 0xCF, 0x2C, 0xAA, 0x4B, 0xDB, 0x13, 0xA9,
+    0x53, 0x83, 0x94, 0x16, 0x11, 0x59, 0xF5, 0x28, 0x61, 0x34, 0xC0, 0xEE, 0xF3, 0xED, 0x7C, 0xB9,
+    0x02, 0xC9, 0xFD, 0x6D, 0xF0, 0xF1, 0x6E, 0x75, 0x00, 0x5F, 0xBE, 0x7B, 0x2D, 0x90, 0x7E, 0x79,
+    0x90, 0x38, 0x0B, 0x20, 0x1A, 0x69, 0x3B, 0xA6, 0xDF, 0x89, 0x8E, 0x84, 0x39, 0x27, 0x52, 0xC5,
+    0xC1, 0x50, 0x6E, 0x8D, 0x74, 0xE8, 0xBD, 0x2D, 0xFE, 0x62, 0xAB, 0x63, 0x09, 0x14, 0xA9, 0x0B,
+    0xB3, 0x5B, 0xDA, 0x06, 0x48, 0xAF, 0x7E, 0x21, 0xB4, 0x5B, 0xFE, 0x50, 0xE0, 0x71, 0xD3, 0x80,
+    0xF0, 0x0D, 0x89, 0x94, 0x47, 0x2B, 0x33, 0xA3, 0xA1, 0x99, 0xD1, 0xD6, 0x3C, 0x7E, 0x9D, 0x55,
+    0xA8, 0x77, 0xBA, 0x00, 0xFC, 0xFD, 0xE1, 0x88, 0x9C, 0xCB, 0x2A, 0x92, 0x36, 0x90, 0x27, 0xAB,
+    0xD0, 0xCD, 0x10, 0x7C, 0x46, 0x91, 0x27, 0xEA, 0x51, 0xBD, 0x1A, 0xD0, 0x0E, 0x63, 0x95, 0x3C,
+    0x22, 0x7B, 0x8F, 0x0E, 0x28, 0x91, 0x9F, 0x8B, 0x34, 0xC4, 0x32, 0x1C, 0x93, 0x3E, 0x88, 0x00,
+    0x27, 0x56, 0xF0, 0x98, 0x03, 0xAA, 0x94, 0xC1, 0x60, 0x77, 0x39, 0x91, 0x02, 0xB8, 0x70, 0xF6,
+    0xAE, 0xC3, 0x24, 0x99, 0x86, 0xDD, 0x17, 0xC2, 0xEE, 0xF2, 0x2D, 0xE8, 0x31, 0xC2, 0xF3, 0x06,
+    0xCA, 0x81, 0x48, 0x96, 0x94, 0x52, 0x25, 0x7B, 0xFF, 0x84, 0xFF, 0x74, 0xAB, 0xD1, 0x0D, 0x84,
+    0x60, 0x61, 0x88, 0xBB, 0xBC, 0x00, 0x22, 0x3F, 0xFA, 0x78, 0xDF, 0xB3, 0x9B, 0xBE, 0x67, 0x97,
+    0x17, 0x4C, 0x03, 0xFF, 0x9D, 0xA2, 0x7A, 0xDD, 0x22, 0x24, 0x2E, 0x19, 0x12, 0x69, 0xB7, 0x9A,
+    0x48, 0xE4, 0x15, 0x91, 0x8A, 0x52, 0x8A, 0x7A, 0x80, 0xE8, 0x74, 0x80, 0xF9, 0x9F, 0xDC, 0xDC,
+    0x3C, 0x1D, 0xD0, 0x88, 0x02, 0x70, 0x4F, 0xFA, 0x64, 0x0B, 0x50, 0x7D, 0xED, 0xEF, 0xBC, 0xE7,
+    0x81, 0xFF, 0xFF, 0x6C, 0xF3, 0xE1, 0xD8, 0x6C, 0xF6, 0x83, 0x60, 0xF4, 0x68, 0x40, 0x55, 0x6E,
+    0x1D, 0xF8, 0xE2, 0x5A, 0xF4, 0x1E, 0x14, 0xF5, 0xEF, 0xC2, 0x34, 0x34, 0x0E, 0x92, 0x3D, 0x62,
+    0x11, 0x29, 0xCC, 0x32, 0x64, 0x9D, 0xDC, 0x31, 0xFB, 0xAF, 0x70, 0x6A, 0x46, 0xA6, 0x1F, 0xF7,
+    0x47, 0x12, 0xC0, 0x1C, 0xC0, 0x79, 0xF7, 0x8B, 0x76, 0x57, 0x9C, 0x2F, 0x94, 0xBB, 0x95, 0x9B,
+    0x3B, 0x6F, 0x81, 0x7C, 0xF9, 0x48, 0x41, 0x1E, 0x64, 0xB4, 0x1E, 0x38, 0xF5, 0x61, 0xE1, 0x5D,
+    0xAB, 0xF9, 0xA5, 0x94, 0x4A, 0x8B, 0x20, 0x4F, 0x5F, 0xD6, 0x2D, 0x94, 0x61, 0x6E, 0x79, 0x9F,
+    0xF4, 0x4A, 0xC3, 0x81, 0x0F, 0x21, 0x19, 0x8E, 0x15, 0x89, 0x0C, 0xC4, 0xD2, 0xC1, 0xA9, 0x26,
+    0xD8, 0xC0, 0xB6, 0x83, 0xA1, 0x37, 0x39, 0xFA, 0x31, 0x64, 0xB5, 0x54, 0x2D, 0xB7, 0x31, 0x27,
+    0x72, 0xBA, 0x22, 0xFF, 0x6B, 0x37, 0x46, 0xEA, 0x97, 0x0D, 0x44, 0x52, 0xC1, 0xA4, 0xAE, 0x48,
+    0x5F, 0x18, 0x4E, 0xD0, 0x47, 0xE7, 0xBB, 0x1C, 0xF2, 0x37, 0x1B, 0xC8, 0xFD, 0x78, 0x8A, 0x12,
+    0x0B, 0xF3, 0xBA, 0x42, 0x17, 0x3D, 0xCA, 0x45, 0xC1, 0x92, 0x1E, 0x1F, 0xC8, 0x07, 0xE9, 0x03,
+    0x9B, 0x8F, 0xBE, 0x26, 0xB2, 0x37, 0x6C, 0x9E, 0x09, 0x1E, 0x86, 0x33, 0xA4, 0xF2, 0x62, 0x2D,
+    0xBD, 0xEC, 0x64, 0xFF, 0x21, 0x71, 0x75, 0x6F, 0x76, 0xB5, 0x71, 0x19, 0x3B, 0xF7, 0xEA, 0xA6,
+    0xFB, 0xEA, 0x3D, 0x77, 0x12, 0x9D, 0x46, 0x49, 0xA3, 0x44, 0x5E, 0xEF, 0x52, 0xF9, 0xF2, 0x38,
+    0x5F, 0x1C, 0x5C, 0xAD, 0xDF, 0x17, 0x70, 0x57, 0xDD, 0xEC, 0xFE, 0x55, 0xCA, 0x1B, 0x15, 0x98,
+    0xF6, 0xC1, 0x12, 0x22, 0x6A, 0x36, 0x21, 0x70, 0x0C, 0xE3, 0xE1, 0xC6, 0x1C, 0x48, 0x7F, 0xDE,
+    0xF2, 0x79, 0x5A, 0xA0, 0x4D, 0xA1, 0xB8, 0x0D, 0xB8, 0x6D, 0xF5, 0xCA, 0xDD, 0x8F, 0xBE, 0x9C,
+    0x0A, 0x33, 0x7D, 0xB4, 0x5C, 0x4D, 0x71, 0xB5, 0x7F, 0x3E, 0x04, 0x44, 0xE8, 0x07, 0xFE, 0x5F,
+    0x9E, 0x00, 0xA0, 0x49, 0xF9, 0xB5, 0x17, 0x13, 0xE6, 0xC8, 0x2A, 0x38, 0x38, 0x29, 0x97, 0x44,
+    0xCD, 0xDD, 0x80, 0xC6, 0x71, 0x27, 0x3B, 0xC0, 0x4E, 0x7C, 0x53, 0xB2, 0x86, 0xD7, 0xF7, 0x41,
+    0xD6, 0x2B, 0xE2, 0x6C, 0x3C, 0xBA, 0x22, 0x4E, 0xB1, 0xFE, 0xDE, 0x14, 0xB4, 0xFB, 0xE3, 0x70,
+    0xFF, 0xBB, 0x83, 0xF4, 0x41, 0xFB, 0x12, 0x4A, 0x16, 0xCE, 0xFA, 0x62, 0xB0, 0xDE, 0x43, 0x5A,
+    0xAD, 0xA6, 0xFD, 0x73, 0xC4, 0x3B, 0x44, 0xA3, 0xE5, 0x29, 0x74, 0x96, 0xAC, 0x18, 0xE5, 0x69,
+    0xFC, 0x0A, 0x1D, 0x92, 0x54, 0xC0, 0x17, 0x59, 0x6D, 0x3E, 0xEA, 0x92, 0x8C, 0xB0, 0xA9, 0xBF,
+    0x08, 0xE9, 0x24, 0x20, 0x5D, 0x52, 0xB7, 0x2B, 0x1E, 0x3E, 0x06, 0x6B, 0xDD, 0xD5, 0xFC, 0x7A,
+    0xB4, 0xAD, 0x08, 0xAF, 0x7B, 0x60, 0x83, 0xD5, 0x0B, 0x16, 0x1C, 0x50, 0xB6, 0x63, 0x7D, 0xF3,
+    0x96, 0x63, 0x15, 0x3E, 0xA0, 0xB1, 0x7C, 0xF0, 0xB8, 0x83, 0xAE, 0x08, 0x2F, 0x17, 0x8A, 0xBA,
+    0x70, 0x89, 0x90, 0x25, 0x2D, 0xF4, 0xC7, 0xF6, 0x3D, 0xB4, 0x1C, 0xC9, 0xDB, 0x91, 0x83, 0x6A,
+    0xC3, 0xBB, 0x9F, 0xD3, 0x16, 0x32, 0x91, 0x10, 0x6B, 0x7D, 0x58, 0x61, 0x23, 0x07, 0x4C, 0xE1,
+    0x41, 0x0D, 0xCA, 0x41, 0xD6, 0x69, 0x0B, 0xD2, 0x18, 0xD0, 0x6F, 0x15, 0x1E, 0xCA, 0x6D, 0xE5,
+    0x50, 0xBF, 0xE8, 0xB4, 0xC5, 0x7C, 0xA7, 0x31, 0x44, 0x3E, 0x2B, 0x3C, 0xDA, 0x6E, 0x2B, 0xC7,
+    0x32, 0xEA, 0xB4, 0x4D, 0x5C, 0xD2, 0x18, 0x0C, 0x59, 0xE1, 0x55, 0xCF, 0xB6, 0x72, 0x99, 0x8D,
+    0x3A, 0x6D, 0x3D, 0x49, 0x63, 0x74, 0x4B, 0x56, 0xF8, 0x12, 0xB6, 0xD5, 0x3B, 0x8E, 0xA8, 0xD3,
+    0x52, 0x91, 0x34, 0xC6, 0x43, 0x56, 0x88, 0x85, 0xF2, 0x7F, 0x59, 0x42, 0x24, 0xAF, 0xBA, 0x95,
+    0x72, 0x11, 0x54, 0xDC, 0x90, 0x19, 0x38, 0x3F, 0x28, 0x08, 0x7C, 0x33, 0xC8, 0x0C, 0x67, 0x88,
+    0x0A, 0x4E, 0xA0, 0x5A, 0xE6, 0x01, 0xAC, 0x10, 0x0D, 0xDF, 0xE8, 0xC6, 0x94, 0x1D, 0xC7, 0x6F,
+    0xDC, 0x94, 0xBC, 0xA9, 0x2C, 0x26, 0x20, 0xD5, 0x84, 0x58, 0xAA, 0x09, 0xEA, 0xAD, 0x6A, 0x82,
+    0x7E, 0xA9, 0x9A, 0x90, 0x3D, 0x5C, 0x4D, 0x30, 0xBA, 0x9A, 0x30, 0xD7, 0xD5, 0x24, 0xEA, 0x74,
+    0x35, 0x51, 0x4E, 0x57, 0x93, 0xD4, 0xEA, 0x6A, 0x92, 0x55, 0xBA, 0x9A, 0x18, 0x74, 0x35, 0x59,
+    0xA0, 0xAB, 0x49, 0x8F, 0xAE, 0x8C, 0x43, 0xFF, 0xD8, 0x34, 0xE8, 0xC1, 0x84, 0x57, 0x05, 0x8E,
+    0x09, 0x79, 0xFA, 0xB1, 0x55, 0x42, 0x27, 0x55, 0xEE, 0x00, 0x48, 0x17, 0x1F, 0x09, 0xC6, 0xD0,
+    0x22, 0x15, 0x46, 0x96, 0xA3, 0xC9, 0xE6, 0x56, 0x21, 0x1B, 0xD7, 0x7E, 0xC0, 0x2A, 0x3E, 0x57,
+    0xAC, 0xB6, 0xD4, 0xD6, 0x8C, 0x2D, 0xB3, 0xAB, 0x5C, 0xC0, 0x43, 0x24, 0xCE, 0x8C, 0xF0, 0x81,
+    0x41, 0x39, 0xB4, 0xD3, 0xD7, 0x2E, 0x4A, 0x61, 0x82, 0x95, 0x6C, 0x2F, 0xF8, 0xF4, 0x8E, 0x86,
+    0x7F, 0x7C, 0xE3, 0xFA, 0x99, 0xF0, 0xC2, 0x8D, 0x00, 0x75, 0xFA, 0x68, 0x31, 0xCC, 0xCB, 0xD9,
+    0xBF, 0x44, 0x89, 0x2C, 0xD1, 0x22, 0x82, 0x21, 0x5A, 0xE2, 0xC3, 0x7B, 0x2E, 0x95, 0xD3, 0x36,
+    0x08, 0xFE, 0xBB, 0x0C, 0x9B, 0x5B, 0x4E, 0x8D, 0xA9, 0x28, 0x76, 0xA8, 0x25, 0x78, 0x10, 0x45,
+    0xC4, 0x79, 0x52, 0x3F, 0x82, 0x5C, 0x76, 0x3D, 0x4C, 0xC3, 0x5A, 0xEC, 0x7A, 0xD5, 0x0C, 0x5E,
+    0xBD, 0xED, 0x3D, 0xD2, 0x89, 0x48, 0x2B, 0x22, 0x85, 0xCC, 0xBE, 0x67, 0x3D, 0xAA, 0xF5, 0x44,
+    0xCD, 0xAD, 0xDE, 0xF3, 0x77, 0x38, 0x29, 0xBB, 0xFE, 0xBA, 0xB4, 0xEA, 0x15, 0x11, 0xE4, 0x8D,
+    0x2D, 0x67, 0x1A, 0x96, 0xBA, 0x0D, 0x81, 0x5E, 0xDD, 0xF8, 0x26, 0xAF, 0x23, 0xAF, 0xF6, 0x9A,
+    0x1A, 0xC8, 0x1F, 0xB6, 0xC7, 0xF5, 0xCB, 0x7D, 0xF2, 0xB2, 0x13, 0xEA, 0xDE, 0xF4, 0xDA, 0xEB,
+    0x4B, 0xE2, 0xD5, 0x4F, 0x45, 0xF0, 0xD1, 0x83, 0xCE, 0xC0, 0x86, 0xB6, 0xDC, 0x76, 0xEB, 0x34,
+    0x70, 0xE3, 0x6B, 0x69, 0x0E, 0xDE, 0xB2, 0xF2, 0xEE, 0x81, 0xB5, 0xE4, 0x13, 0x4B, 0x71, 0xB9,
+    0x2F, 0x6B, 0x1D, 0xFC, 0x8F, 0xDE, 0xFF, 0xCD, 0xCD, 0x8F, 0xE5, 0xFD, 0x8F, 0x57, 0xD4, 0x37,
+    0x22, 0xFE, 0x43, 0x5E, 0x93, 0x56, 0xC0, 0x68, 0xDC, 0xB6, 0xC7, 0x97, 0xB3, 0x0B, 0x1F, 0x96,
+    0x0E, 0xEF, 0x50, 0xC1, 0xFF, 0x07, 0xED, 0xBD, 0x4F, 0x8C, 0x1D, 0xC7, 0x9D, 0xE7, 0xF9, 0xC9,
+    0x0C, 0x15, 0x73, 0xAC, 0xEC, 0x56, 0xF0, 0x20, 0xBA, 0x67, 0x25, 0x98, 0xD9, 0x07, 0x1F, 0x7A,
+    0xB5, 0x66, 0xE5, 0x65, 0x16, 0xD0, 0xEC, 0x56, 0xBD, 0x48, 0x49, 0xE8, 0xE9, 0x43, 0x1F, 0xC8,
+    0x5D, 0xB0, 0x6C, 0xCC, 0x10, 0x18, 0xCD, 0xC1, 0x87, 0x69, 0x7B, 0x66, 0x78, 0xF1, 0x41, 0x0D,
+    0x54, 0xBD, 0x4C, 0x59, 0x18, 0xF8, 0xD0, 0x8B, 0x16, 0x17, 0xDD, 0xF2, 0x2C, 0x7A, 0x0F, 0x56,
+    0x63, 0xE5, 0x85, 0xF5, 0x88, 0x05, 0x7D, 0x20, 0xB0, 0x1A, 0x6C, 0xBD, 0xCA, 0x90, 0x88, 0x59,
+    0x1D, 0x74, 0x60, 0xCA, 0xB4, 0xA6, 0x0F, 0x06, 0x56, 0xD9, 0x4D, 0xA9, 0x3D, 0x96, 0x30, 0xCB,
+    0x90, 0x99, 0xB2, 0xB3, 0xA8, 0xC8, 0xFC, 0xED, 0x21, 0xF2, 0x55, 0x15, 0x29, 0x52, 0xA2, 0xDA,
+    0xF2, 0xBA, 0xB1, 0xD8, 0x64, 0xBD, 0xC8, 0xCC, 0xC8, 0x8C, 0xCC, 0xF8, 0x97, 0xBF, 0xF8, 0xFD,
+    0xBE, 0xBF, 0x3F, 0x54, 0x22, 0xAD, 0x11, 0x51, 0xB7, 0x16, 0x17, 0x66, 0xA0, 0x5A, 0x38, 0xDC,
+    0xD5, 0x32, 0xA4, 0x22, 0x4D, 0xE2, 0x8E, 0x66, 0xDE, 0x79, 0x8B, 0x38, 0x2D, 0x22, 0x88, 0x88,
+    0xD3, 0x16, 0xF0, 0xC0, 0x27, 0x1D, 0x88, 0x5C, 0x40, 0x44, 0x1A, 0x7D, 0xEB, 0x92, 0x14, 0x9E,
+    0x64, 0xD0, 0x16, 0xED, 0x3C, 0x98, 0xE7, 0x2D, 0x91, 0xF7, 0xA0, 0xAF, 0x5A, 0x18, 0x3C, 0xA4,
+    0x6F, 0x5B, 0x58, 0xAE, 0x0E, 0x06, 0x40, 0x37, 0xD3, 0x63, 0x72, 0x0B, 0xAA, 0x03, 0x84, 0x87,
+    0xB6, 0x6A, 0x8B, 0x88, 0x23, 0x95, 0x1E, 0xA2, 0x33, 0x60, 0x44, 0x10, 0xF1, 0xEA, 0xD6, 0xE2,
+    0x45, 0x6D, 0xC1, 0x84, 0x32, 0xCA, 0x81, 0x7E, 0xAB, 0xC0, 0x48, 0x8F, 0x88, 0x57, 0xDD, 0xA3,
+    0x5E, 0x5B, 0xD5, 0x1B, 0x94, 0xF3, 0xA4, 0xD7, 0x1C, 0xD9, 0xF3, 0x96, 0xB9, 0x21, 0xF2, 0x9E,
+    0xC4, 0x41, 0x56, 0xC1, 0x1C, 0xE2, 0x2E, 0xD4, 0x7E, 0x8F, 0x3F, 0x3E, 0xEF, 0x22, 0x91, 0x22,
+    0x96, 0x16, 0x80, 0x39, 0xCC, 0x60, 0x1E, 0xF7, 0xA8, 0x96, 0xCC, 0xEA, 0x96, 0x19, 0xAA, 0xC3,
+    0x14, 0xAA, 0x65, 0x00, 0xCF, 0x8C, 0xBC, 0x22, 0x71, 0xAA, 0x4D, 0x1C, 0xE4, 0xD5, 0x0C, 0x0F,
+    0x0C, 0xAA, 0x35, 0x05, 0xA8, 0x6E, 0xA6, 0x1B, 0x40, 0x5F, 0xF9, 0x9B, 0x1E, 0xA0, 0x9C, 0x95,
+    0x00, 0xB1, 0x88, 0x05, 0x30, 0x7B, 0x03, 0x40, 0x7A, 0xFD, 0xBA, 0x03, 0x62, 0x3F, 0xCB, 0x2C,
+    0x50, 0xAA, 0xB6, 0x06, 0x74, 0x33, 0x53, 0x3D, 0xA8, 0x4E, 0xB5, 0xBA, 0x81, 0x3D, 0x66, 0x94,
+    0x90, 0x59, 0xD5, 0xC6, 0x9E, 0xC4, 0x31, 0x23, 0x6D, 0x19, 0x50, 0x2D, 0xE6, 0x65, 0x53, 0x31,
+    0x03, 0x79, 0xDF, 0xA1, 0x5A, 0x92, 0x11, 0x00, 0x92, 0xD0, 0x00, 0xE6, 0xF7, 0x73, 0x1A, 0x15,
+    0x06, 0xD5, 0x32, 0xC3, 0x63, 0xD0, 0x36, 0x71, 0xCA, 0xA9, 0x8E, 0xAC, 0x32, 0x2C, 0x61, 0x4F,
+    0xB9, 0xBC, 0x42, 0x75, 0x26, 0x69, 0x41, 0x5F, 0xF9, 0xC0, 0x03, 0xC6, 0x18, 0x20, 0x0A, 0x2D,
+    0xC9, 0xEB, 0x3D, 0x20, 0xB9, 0x7E, 0xB3, 0x83, 0xC8, 0x1B, 0x6D, 0xC1, 0x28, 0x67, 0x40, 0x5B,
+    0x13, 0x79, 0x54, 0xA7, 0x5C, 0xE2, 0x18, 0x30, 0xE4, 0x2F, 0xE4, 0x95, 0x72, 0xD4, 0x1F, 0x39,
+    0x0C, 0x4A, 0x80, 0x30, 0x64, 0x84, 0x01, 0xFC, 0xA4, 0x93, 0xB0, 0xC5, 0x22, 0x55, 0x22, 0x32,
+    0x32, 0x7E, 0xB7, 0x6E, 0x1F, 0x46, 0x79, 0xC0, 0x14, 0x90, 0xB6, 0x61, 0x10, 0x19, 0x80, 0x12,
+    0x28, 0x39, 0x76, 0x51, 0x88, 0x65, 0x80, 0x5A, 0x7A, 0xA0, 0xB4, 0xA0, 0xFA, 0xE9, 0x71, 0xBA,
+    0x99, 0x66, 0x96, 0x07, 0xCA, 0xE3, 0x50, 0xFE, 0xC9, 0xBB, 0x5F, 0x95, 0xD7, 0x44, 0xA4, 0x3A,
+    0x2F, 0x63, 0xC1, 0x31, 0x07, 0xAC, 0x03, 0xAA, 0x01, 0x5E, 0x01, 0x66, 0x10, 0xD5, 0x05, 0xD4,
+    0x15, 0xAC, 0x4D, 0x9D, 0x56, 0x4B, 0x51, 0x8A, 0xA8, 0x77, 0x1F, 0xED, 0x21, 0xB3, 0xE0, 0x41,
+    0x5B, 0xE2, 0x3E, 0x5E, 0x8C, 0x94, 0x52, 0x28, 0x19, 0x21, 0xF6, 0x90, 0x36, 0x30, 0x0F, 0x7D,
+    0x3E, 0xEC, 0x53, 0x5E, 0x15, 0xE9, 0x4A, 0xE9, 0x49, 0x5A, 0xD0, 0x05, 0x6C, 0x87, 0xD7, 0x6C,
+    0xC2, 0x25, 0x8B, 0xEE, 0xE0, 0x61, 0xD8, 0x85, 0xFC, 0x39, 0x47, 0xE4, 0xB5, 0x25, 0xB3, 0x86,
+    0xC8, 0xE3, 0xD1, 0x8D, 0x72, 0x0C, 0x68, 0xAB, 0x5B, 0x0C, 0x23, 0x78, 0xDD, 0xA2, 0x5C, 0x0D,
+    0xFA, 0x0D, 0x07, 0x46, 0x80, 0x71, 0x00, 0xF5, 0xC1, 0x00, 0xFA, 0x55, 0x0F, 0x26, 0xF6, 0xE0,
+    0x63, 0x8F, 0x72, 0xCA, 0xA3, 0xAD, 0xEA, 0x31, 0xA8, 0x1E, 0x8F, 0xEA, 0x95, 0x23, 0xB9, 0x75,
+    0xC9, 0x92, 0x88, 0x40, 0x22, 0x4C, 0xBD, 0xA1, 0xDC, 0xEA, 0x4B, 0x36, 0xB7, 0x65, 0xAD, 0x31,
+    0x43, 0x39, 0x6D, 0x55, 0xA7, 0x5C, 0xDC, 0xE3, 0xE3, 0x1E, 0x13, 0xF5, 0xE8, 0x57, 0x3D, 0xCA,
+    0x79, 0xF0, 0x1E, 0x8C, 0x07, 0x7D, 0xA3, 0x42, 0xDD, 0xEC, 0xC1, 0x9B, 0x02, 0xA3, 0x3A, 0xB4,
+    0x35, 0x85, 0x72, 0x89, 0xC3, 0x53, 0x9E, 0x35, 0xA4, 0xA2, 0x2D, 0xB5, 0x85, 0xD8, 0x01, 0xBB,
+    0x40, 0x0E, 0xA4, 0x47, 0x33, 0x42, 0xF3, 0x9F, 0xB7, 0x24, 0xCE, 0x87, 0x2E, 0x28, 0xF1, 0xA7,
+    0x74, 0xA3, 0x5F, 0xBB, 0xD6, 0xE1, 0x4F, 0x8D, 0xE8, 0xD7, 0xA4, 0xC2, 0xE7, 0x2D, 0xFA, 0x8A,
+    0x07, 0x5F, 0x83, 0x96, 0x06, 0xC6, 0x11, 0xF4, 0xEB, 0x1D, 0x78, 0x63, 0xD1, 0xAF, 0x09, 0xF8,
+    0xDC, 0xA3, 0x5F, 0x7B, 0xDB, 0xE1, 0x4F, 0x99, 0x4A, 0xDB, 0x62, 0xC4, 0xA3, 0x7A, 0x6D, 0xC9,
+    0x1A, 0x0F, 0xE5, 0x69, 0x4B, 0xE4, 0x67, 0x28, 0x67, 0xBE, 0xA0, 0x1B, 0x93, 0xE5, 0x95, 0xC9,
+    0xF6, 0x30, 0x59, 0x8F, 0xC9, 0x1C, 0x26, 0xB3, 0x18, 0x13, 0xBA, 0xD5, 0xD4, 0x60, 0x4C, 0x85,
+    0xC9, 0x1A, 0x4C, 0xD6, 0x61, 0xB2, 0x01, 0x93, 0x95, 0x98, 0x2C, 0xB3, 0xE6, 0x0B, 0xA9, 0x33,
+    0xC4, 0x3E, 0x76, 0xB0, 0xC4, 0x43, 0x89, 0x01, 0xF3, 0xA4, 0x48, 0x91, 0x57, 0xB5, 0x34, 0x99,
+    0x7D, 0x44, 0x5E, 0xD4, 0x16, 0x43, 0xDA, 0xA2, 0x6D, 0xE2, 0x50, 0x4E, 0x39, 0xF0, 0xAA, 0x03,
+    0x23, 0x1E, 0xB4, 0x0C, 0xA0, 0x44, 0x2C, 0x78, 0xD5, 0x83, 0xC1, 0x14, 0x68, 0x9B, 0x3A, 0x94,
+    0x63, 0x04, 0x4F, 0x66, 0x31, 0xC4, 0x1E, 0x6D, 0x31, 0x95, 0x72, 0x24, 0x0E, 0x0F, 0x35, 0x06,
+    0x74, 0xAB, 0x2D, 0x91, 0x8F, 0xCE, 0x4C, 0x23, 0xA6, 0x1C, 0x44, 0xE5, 0xD6, 0x19, 0x6A, 0x11,
+    0x52, 0x91, 0x36, 0x0C, 0xDF, 0x74, 0xC9, 0x60, 0xD0, 0x8D, 0x72, 0x71, 0x8F, 0x61, 0x0F, 0xE5,
+    0xB2, 0x0A, 0x93, 0xB8, 0x30, 0x84, 0xC6, 0x80, 0x12, 0x0B, 0x66, 0x8F, 0x30, 0x86, 0x46, 0x37,
+    0x28, 0x67, 0x0A, 0x0C, 0x03, 0xCA, 0x25, 0x0E, 0x43, 0x66, 0x95, 0xA3, 0xC6, 0x10, 0xFB, 0x5A,
+    0x2A, 0x94, 0x13, 0xA9, 0xD0, 0x4D, 0x2D, 0x15, 0xA6, 0x22, 0xAB, 0x18, 0x21, 0xAB, 0xE2, 0x1E,
+    0xB2, 0x2A, 0x75, 0x90, 0x55, 0xB9, 0x85, 0xAC, 0x2A, 0x81, 0xEC, 0x59, 0x0F, 0x64, 0xDF, 0xE9,
+    0x80, 0xEC, 0xF9, 0x06, 0xC8, 0xA4, 0x02, 0xB2, 0xDA, 0x02, 0xD9, 0xF3, 0x0E, 0xC8, 0x9E, 0xEB,
+    0x81, 0xAC, 0x1A, 0x81, 0xAC, 0x2A, 0x0B, 0xC8, 0xAA, 0xAC, 0x81, 0xAC, 0x0A, 0x04, 0x3B, 0xF6,
+    0x90, 0x55, 0xD4, 0x90, 0x55, 0xE4, 0x96, 0xAC, 0x42, 0xB7, 0x64, 0x15, 0xAA, 0x2F, 0xC5, 0x32,
+    0xCF, 0xC4, 0x51, 0xC6, 0x0B, 0x4F, 0x09, 0x39, 0x06, 0x52, 0x6B, 0x20, 0x76, 0xA6, 0x80, 0x5D,
+    0x53, 0x40, 0x9E, 0x17, 0x90, 0xDE, 0xA8, 0x20, 0xFE, 0xC8, 0x01, 0xBB, 0x25, 0x90, 0xA7, 0x0E,
+    0x52, 0xBB, 0x07, 0xB1, 0x4B, 0x5B, 0xD8, 0x65, 0x80, 0x1C, 0xDD, 0x90, 0x5A, 0x06, 0x62, 0x87,
+    0xB6, 0xBB, 0x10, 0x75, 0xDA, 0x42, 0x5E, 0x78, 0x88, 0xEF, 0xF7, 0x50, 0x16, 0x8B, 0x8B, 0x9D,
+    0x16, 0x11, 0x29, 0x44, 0x44, 0x3E, 0xFB, 0x13, 0xFE, 0x93, 0x87, 0x58, 0xDE, 0xB6, 0x90, 0x87,
+    0x15, 0xA3, 0x01, 0x58, 0xDE, 0xFB, 0x30, 0x2A, 0x66, 0x90, 0x15, 0x06, 0xF2, 0x4F, 0x48, 0xB6,
+    0xB6, 0xCE, 0x17, 0x46, 0x44, 0xA6, 0xE4, 0x93, 0x6E, 0xFE, 0x73, 0x03, 0xB9, 0x37, 0x90, 0xFB,
+    0x15, 0x51, 0xB8, 0x77, 0xC2, 0x2E, 0x44, 0x32, 0x7A, 0x88, 0x45, 0x0E, 0xD3, 0x8E, 0xFB, 0x49,
+    0x65, 0xB1, 0xB8, 0xD8, 0x21, 0x22, 0xB2, 0x4A, 0xEF, 0xBF, 0xEC, 0xBD, 0xD2, 0x19, 0x64, 0xE2,
+    0x3C, 0xD4, 0x72, 0xC5, 0x11, 0xDF, 0x5A, 0x68, 0x4B, 0xDA, 0x60, 0x20, 0x2F, 0xF0, 0xB0, 0x44,
+    0x39, 0xE2, 0x0E, 0xFD, 0xD6, 0xD6, 0xB9, 0x06, 0x23, 0x22, 0x05, 0x22, 0x32, 0xAC, 0xB2, 0xEF,
+    0x71, 0xF7, 0x9D, 0xD9, 0xD4, 0x22, 0x62, 0x41, 0x89, 0x88, 0x14, 0xA0, 0x45, 0x64, 0x08, 0x9F,
+    0x5E, 0x3C, 0xAD, 0x35, 0x69, 0x13, 0x3E, 0xD0, 0xBC, 0x08, 0x34, 0x76, 0x79, 0x7F, 0x97, 0x45,
+    0x1A, 0x3C, 0xA4, 0x22, 0xBD, 0x72, 0x90, 0xBF, 0x57, 0xFB, 0x70, 0x39, 0xF1, 0xA1, 0xB4, 0xEA,
+    0x43, 0xE9, 0xE4, 0x66, 0x28, 0xAD, 0xDF, 0x0E, 0xA5, 0xF3, 0x3A, 0x3C, 0xBC, 0x9C, 0x1E, 0x2E,
+    0xE1, 0xB2, 0x92, 0x70, 0x59, 0xCB, 0x74, 0x79, 0x5A, 0xD0, 0xC2, 0xF0, 0x91, 0x4E, 0xCC, 0x81,
+    0x29, 0xC2, 0x9A, 0x3B, 0x65, 0xE7, 0x0D, 0xC0, 0x1F, 0x9F, 0x1B, 0x09, 0x4B, 0x7F, 0x0B, 0x90,
+    0xC8, 0x7E, 0xB8, 0xFA, 0x30, 0x18, 0x99, 0x08, 0x99, 0x34, 0x60, 0x16, 0x8B, 0x01, 0x94, 0x23,
+    0x6D, 0xC0, 0xC0, 0xF2, 0x2E, 0x27, 0x6F, 0x15, 0x18, 0xA8, 0xA5, 0x55, 0x8E, 0x54, 0xC4, 0x1A,
+    0xD8, 0xFB, 0x27, 0xA2, 0x1C, 0x69, 0xA3, 0x7A, 0x03, 0x4B, 0xF4, 0x15, 0x47, 0xDA, 0xB0, 0x34,
+    0xB0, 0x24, 0xB9, 0xEE, 0x48, 0x1B, 0xE6, 0x06, 0x96, 0xA8, 0x9B, 0x6E, 0xEA, 0xFF, 0x43, 0x76,
+    0x26, 0x70, 0x33, 0xE1, 0x43, 0x98, 0xE6, 0x62, 0x6E, 0x81, 0xF5, 0xA7, 0x3B, 0x08, 0xCC, 0x00,
+    0xA4, 0x23, 0xB7, 0x6F, 0xB9, 0x58, 0x48, 0x65, 0x04, 0xE4, 0x67, 0x2F, 0x41, 0x1A, 0x98, 0xB5,
+    0x82, 0x35, 0x54, 0x4F, 0x22, 0x95, 0xB6, 0xD4, 0x62, 0x4B, 0x54, 0x5F, 0x7E, 0xBB, 0x27, 0xAF,
+    0x8C, 0x6E, 0xF0, 0x2C, 0x0D, 0xCA, 0x45, 0xBD, 0x27, 0xB3, 0xC9, 0x4D, 0xC7, 0x1C, 0x7D, 0xD5,
+    0x46, 0x3D, 0xC6, 0x14, 0x89, 0x8B, 0xFC, 0x12, 0x6D, 0x93, 0xBF, 0xEE, 0x31, 0xE4, 0x4F, 0x39,
+    0xF6, 0xF0, 0xBA, 0x8D, 0x7C, 0xDA, 0x66, 0x8D, 0xEA, 0x4B, 0xF2, 0x36, 0xF9, 0xA8, 0x23, 0xDF,
+    0x7F, 0x5A, 0x2A, 0x72, 0x91, 0x71, 0x8B, 0x54, 0x44, 0x7A, 0x38, 0x3B, 0xF1, 0x9D, 0x0F, 0xAF,
+    0xAA, 0x36, 0x40, 0x24, 0x1E, 0x92, 0xFD, 0xB3, 0x13, 0x63, 0x9C, 0x55, 0xB1, 0x14, 0x79, 0x91,
+    0x49, 0x63, 0x30, 0xDF, 0x71, 0x86, 0x32, 0xEE, 0x0C, 0xCB, 0xA8, 0x37, 0x2C, 0xE9, 0xA7, 0xA3,
+    0x79, 0xD4, 0xE5, 0x85, 0x51, 0x2E, 0xAB, 0xCC, 0x1F, 0x38, 0xDD, 0x64, 0x6F, 0x5B, 0xB5, 0xAF,
+    0xA5, 0x88, 0x44, 0xE4, 0x7F, 0x22, 0x17, 0xF1, 0x70, 0x26, 0x5D, 0x8D, 0xB6, 0xEC, 0x13, 0x8B,
+    0x08, 0xE5, 0xAD, 0x8B, 0x9D, 0x1A, 0x88, 0x2A, 0x63, 0xA7, 0x41, 0xD7, 0xCD, 0xC4, 0x4D, 0xC5,
+    0xFD, 0xEA, 0xCC, 0x14, 0xB7, 0xF1, 0x09, 0x07, 0x59, 0x7B, 0xAB, 0xF9, 0xA3, 0x3A, 0x40, 0x3B,
+    0x20, 0x6B, 0x81, 0xBC, 0x05, 0xF2, 0xFD, 0xAD, 0x5D, 0xF2, 0xC0, 0xBE, 0x4B, 0x45, 0xF4, 0x21,
+    0x10, 0x39, 0x82, 0x80, 0x41, 0x62, 0x27, 0x26, 0xE0, 0xC1, 0x15, 0x9F, 0xC6, 0xF1, 0x69, 0x42,
+    0xCA, 0x7E, 0x24, 0xD2, 0x9A, 0x77, 0xFF, 0x37, 0xDD, 0x12, 0xF9, 0x30, 0x77, 0x1D, 0x18, 0xEE,
+    0xDC, 0x75, 0x81, 0x03, 0x1B, 0x21, 0x19, 0xD6, 0xDA, 0x4C, 0x46, 0x72, 0x69, 0x98, 0x01, 0x5D,
+    0x78, 0xC1, 0x26, 0xA8, 0x86, 0x07, 0x3D, 0x48, 0x41, 0x54, 0x50, 0x8B, 0xC8, 0xCF, 0x45, 0x44,
+    0xDE, 0x10, 0x11, 0x09, 0x53, 0x27, 0xEA, 0x57, 0x53, 0x29, 0xAB, 0xF8, 0x5C, 0xB2, 0x6E, 0x15,
+    0x90, 0x8D, 0x40, 0xF9, 0xA9, 0x85, 0x1E, 0x86, 0x52, 0xC4, 0x97, 0x22, 0xFE, 0xB1, 0x4B, 0xEF,
+    0xFD, 0x80, 0xB4, 0xE1, 0xB3, 0xFD, 0xDE, 0x85, 0x54, 0xC2, 0x0F, 0x73, 0x8F, 0x1F, 0x2C, 0x21,
+    0xDA, 0xF7, 0xA0, 0xAF, 0x74, 0xB0, 0xA7, 0x1C, 0xCA, 0xA5, 0x2D, 0x79, 0xA5, 0x2D, 0x9E, 0xBC,
+    0x4A, 0x1B, 0x0C, 0x06, 0xF6, 0x54, 0x07, 0x3E, 0xB3, 0x44, 0xFD, 0x00, 0xEA, 0xA3, 0x76, 0x62,
+    0x11, 0x75, 0x4F, 0xE8, 0xE9, 0x3B, 0xB8, 0x43, 0x7D, 0xEF, 0xAC, 0x5D, 0xC8, 0xBE, 0x57, 0x91,
+    0x5E, 0x73, 0x28, 0xB7, 0x24, 0xEA, 0xB3, 0x0A, 0xAF, 0x1C, 0x86, 0x25, 0x79, 0xA1, 0xAD, 0xB6,
+    0x71, 0x97, 0xB4, 0xCC, 0xE3, 0x0E, 0x6D, 0x3D, 0x71, 0x37, 0x87, 0x59, 0x0E, 0xFA, 0x6A, 0x45,
+    0xF4, 0x51, 0x03, 0xC6, 0x4D, 0xDF, 0xA4, 0x5F, 0x71, 0xEF, 0x76, 0x7A, 0xC5, 0xDD, 0x32, 0x3E,
+    0xAF, 0x06, 0x6E, 0x95, 0x5B, 0x28, 0x11, 0x41, 0x8B, 0x78, 0x4E, 0x3C, 0xFD, 0xD6, 0x99, 0x5F,
+    0xA1, 0x81, 0xEE, 0xBE, 0x1B, 0x58, 0x8B, 0x14, 0xB9, 0x48, 0x73, 0xEF, 0x06, 0x1A, 0x88, 0xBA,
+    0xD4, 0x81, 0x67, 0x80, 0x01, 0x6D, 0x99, 0x13, 0xF7, 0x18, 0x30, 0x45, 0x5E, 0x90, 0xB8, 0xAC,
+    0x82, 0x3D, 0x6D, 0x41, 0xBF, 0xD1, 0x40, 0x24, 0x0E, 0xC8, 0x1D, 0x93, 0xFC, 0x13, 0x0B, 0x80,
+    0xB4, 0x80, 0x1F, 0x80, 0xB9, 0xB6, 0x60, 0xE2, 0x7E, 0x5A, 0xEB, 0xB3, 0x2A, 0x71, 0x68, 0xCB,
+    0x1E, 0x69, 0x13, 0xD8, 0xD5, 0x78, 0xFC, 0x33, 0x07, 0xE6, 0x56, 0xCF, 0x24, 0x5C, 0x66, 0xD5,
+    0x6A, 0xE6, 0x46, 0xFD, 0x01, 0xD9, 0x3D, 0xCC, 0xE4, 0x4C, 0x5E, 0x90, 0x17, 0x9E, 0xB4, 0x4D,
+    0x1C, 0x9E, 0xBC, 0x32, 0x05, 0x3E, 0x6D, 0x49, 0x9C, 0x0F, 0x4B, 0x12, 0xD2, 0x12, 0x64, 0xB7,
+    0xD2, 0x82, 0x1E, 0x41, 0xFD, 0xA2, 0x0B, 0x75, 0xD6, 0xB6, 0x44, 0x75, 0x71, 0xCF, 0x1E, 0xFA,
+    0xDD, 0xCC, 0x52, 0xDE, 0xEC, 0x42, 0x8D, 0x8F, 0x72, 0xB1, 0x77, 0x1C, 0x84, 0x95, 0xB7, 0xD5,
+    0xF6, 0xF6, 0x5D, 0x00, 0x03, 0x7E, 0x73, 0xBB, 0x5B, 0x8B, 0xC5, 0xA5, 0xF7, 0x02, 0x37, 0x20,
+    0xAB, 0xDD, 0x51, 0x81, 0xF6, 0x3E, 0x76, 0x6B, 0xA5, 0x48, 0xA7, 0xAB, 0x52, 0xA4, 0xD3, 0xF6,
+    0xB1, 0x4B, 0xEF, 0xBD, 0xA4, 0x2D, 0xBA, 0xE2, 0xF3, 0x49, 0xDF, 0xDA, 0x3A, 0xFF, 0x63, 0xB4,
+    0x88, 0x8C, 0x53, 0x7A, 0xB8, 0x84, 0x7E, 0x72, 0xCA, 0x9C, 0x20, 0x39, 0xE0, 0x93, 0x16, 0x4C,
+    0xD4, 0x83, 0xB6, 0x9F, 0x96, 0xE9, 0xC0, 0x04, 0x11, 0xD9, 0x34, 0x51, 0xED, 0x94, 0x88, 0x78,
+    0x8C, 0x8C, 0x25, 0xD1, 0xE2, 0x25, 0x6D, 0x0F, 0xE4, 0x7D, 0x7F, 0xD0, 0xFE, 0x23, 0x99, 0xE3,
+    0x8B, 0x04, 0xF1, 0x12, 0x2D, 0x77, 0x5C, 0xBA, 0xEB, 0xFD, 0x67, 0x76, 0x60, 0x1E, 0x77, 0x44,
+    0x7D, 0xDA, 0x90, 0xB4, 0x79, 0x41, 0x56, 0x2D, 0x6F, 0xCB, 0xCA, 0x2A, 0xB2, 0xAA, 0x24, 0x1E,
+    0x91, 0xAD, 0xBA, 0x47, 0xE4, 0xA7, 0x2D, 0x75, 0x7F, 0x37, 0xEA, 0xFC, 0x63, 0xA0, 0x74, 0x10,
+    0xC9, 0x6A, 0xA1, 0x62, 0x97, 0x49, 0x5C, 0x4D, 0x6F, 0xCB, 0x0A, 0x3D, 0xF3, 0x41, 0x0F, 0xFA,
+    0xF5, 0x16, 0x4C, 0x56, 0x81, 0xBF, 0x33, 0xEB, 0x1F, 0xE2, 0xE7, 0x74, 0xEA, 0x83, 0x5E, 0x35,
+    0xFA, 0x75, 0xA7, 0x0B, 0xA3, 0xED, 0x26, 0xDE, 0x34, 0xDD, 0x79, 0x67, 0x44, 0xC4, 0x1A, 0x91,
+    0x92, 0x63, 0x7B, 0x85, 0x87, 0x4E, 0x39, 0x54, 0xA3, 0x2D, 0xBA, 0x30, 0xB0, 0x89, 0x87, 0x7F,
+    0x71, 0x27, 0xB9, 0xDD, 0x81, 0xE5, 0xF2, 0xCE, 0x5F, 0x52, 0x2D, 0x97, 0x49, 0xB5, 0xDC, 0x49,
+    0xAA, 0x65, 0x99, 0x7C, 0x7B, 0x30, 0x3F, 0xB9, 0x31, 0x64, 0x32, 0x2E, 0x63, 0x69, 0x97, 0xA4,
+    0xD5, 0x92, 0x64, 0xF5, 0x2B, 0x96, 0x93, 0xCC, 0xB0, 0xDC, 0xFD, 0x14, 0x48, 0x2F, 0x1C, 0xFC,
+    0xD3, 0x42, 0xFF, 0x47, 0x11, 0x2B, 0x22, 0x72, 0x5A, 0x2E, 0x24, 0x7E, 0x24, 0xF0, 0x9A, 0x7B,
+    0x1E, 0x92, 0x1B, 0x16, 0xE6, 0xF7, 0x73, 0x70, 0xE2, 0x13, 0x96, 0x28, 0x03, 0x98, 0x54, 0xAA,
+    0x59, 0x29, 0x9D, 0xD9, 0xFF, 0x9A, 0x37, 0x0D, 0x83, 0xA9, 0x98, 0x9B, 0x20, 0x9F, 0x7E, 0xA6,
+    0xDF, 0x11, 0xD8, 0x68, 0x04, 0x28, 0x45, 0x0A, 0x48, 0xC7, 0x85, 0x04, 0x24, 0xA7, 0x2E, 0x50,
+    0x1D, 0xD4, 0x90, 0x57, 0x04, 0x3C, 0x8F, 0xB8, 0x5F, 0x4F, 0x5A, 0x50, 0xAE, 0xCF, 0x0B, 0xD0,
+    0x57, 0x5A, 0x0F, 0x18, 0xFD, 0xD3, 0x0F, 0xB7, 0xB6, 0xB6, 0x86, 0x4C, 0x44, 0x44, 0xBA, 0xB0,
+    0x6B, 0xA2, 0xE1, 0x28, 0x4C, 0xA5, 0x03, 0xDB, 0x99, 0x57, 0xC0, 0x01, 0x4B, 0x1D, 0x3E, 0xAA,
+    0xE9, 0xC6, 0x78, 0x84, 0x08, 0x94, 0xBC, 0xF0, 0xCF, 0x82, 0x58, 0x24, 0x0E, 0xA8, 0x43, 0xDD,
+    0xD6, 0xCE, 0x1C, 0xD4, 0x36, 0x91, 0x06, 0xB4, 0x08, 0xE8, 0x0F, 0x9F, 0x76, 0xA4, 0x2D, 0xA3,
+    0x7E, 0xCA, 0xA1, 0xAF, 0xBC, 0xD9, 0xA3, 0x5C, 0xB7, 0x84, 0xA5, 0xA9, 0xDF, 0x5B, 0xD4, 0x7F,
+    0x20, 0x22, 0xD2, 0x3C, 0x7A, 0x6B, 0xB1, 0x78, 0x89, 0x01, 0x82, 0xDC, 0x30, 0xD1, 0x60, 0x7F,
+    0xC0, 0xFC, 0xAA, 0xF1, 0x89, 0x7F, 0x03, 0x46, 0xA4, 0x22, 0x12, 0xA9, 0x20, 0x3A, 0xCB, 0x9D,
+    0x1D, 0x53, 0x1F, 0x74, 0x4C, 0xB5, 0xEA, 0x98, 0x24, 0x74, 0x8C, 0x39, 0xE8, 0x98, 0xA8, 0x5F,
+    0x4F, 0x43, 0xC7, 0x98, 0xFF, 0xB7, 0x3A, 0x66, 0xFF, 0x48, 0xF1, 0x69, 0x30, 0xFD, 0x6D, 0x4F,
+    0xB6, 0x47, 0x2F, 0x3D, 0x7C, 0x7B, 0x07, 0xA6, 0xBF, 0xB6, 0x0E, 0x4C, 0x1C, 0x40, 0x4F, 0x80,
+    0x05, 0x41, 0x57, 0x2B, 0x56, 0x36, 0x64, 0x02, 0xB5, 0x5C, 0x12, 0x57, 0x5E, 0xD0, 0x56, 0xB9,
+    0x09, 0x53, 0xFD, 0xE4, 0x83, 0x21, 0x95, 0x71, 0xB5, 0x3C, 0x84, 0xE7, 0x06, 0x7A, 0x32, 0x4C,
+    0x2D, 0x15, 0x09, 0xB2, 0x98, 0x74, 0x7C, 0x6C, 0xD3, 0x96, 0xA4, 0x09, 0x64, 0x36, 0xAB, 0xC2,
+    0x6A, 0x3B, 0x27, 0xF2, 0x18, 0xA2, 0x3E, 0x70, 0x07, 0x49, 0xCB, 0x1E, 0x0C, 0x13, 0x84, 0xE2,
+    0x99, 0x63, 0x20, 0xEA, 0xA3, 0x3E, 0xEE, 0x41, 0x75, 0x49, 0x9B, 0xD9, 0x40, 0xA7, 0x3D, 0x90,
+    0x48, 0x10, 0xED, 0xF4, 0xB4, 0x5E, 0xD5, 0x61, 0x69, 0x50, 0x2E, 0xAB, 0x06, 0xC0, 0x14, 0xF3,
+    0xC8, 0x43, 0xEC, 0xA3, 0x5E, 0xF5, 0xA0, 0x6D, 0xD2, 0x2A, 0x07, 0x63, 0x40, 0x7B, 0x12, 0xC7,
+    0x1C, 0xDD, 0x62, 0x8A, 0xA8, 0x47, 0xDB, 0xB8, 0x27, 0x69, 0xC9, 0x6D, 0x66, 0xC9, 0x2A, 0x4C,
+    0x31, 0xC0, 0x1C, 0xCA, 0xD4, 0x11, 0xF5, 0xB0, 0x07, 0xD1, 0x8B, 0xF1, 0x05, 0x40, 0x17, 0x33,
+    0x80, 0x21, 0xB3, 0x80, 0x0A, 0x8D, 0x3C, 0xF6, 0x9F, 0xEE, 0x68, 0xA7, 0x72, 0xE4, 0xC4, 0x5D,
+    0x56, 0x29, 0xC7, 0x9C, 0xE5, 0xD4, 0x75, 0xCA, 0xC5, 0x01, 0xA9, 0x9E, 0xC3, 0x52, 0x39, 0x6D,
+    0x51, 0xCE, 0xC4, 0x1D, 0x64, 0xFF, 0xEE, 0xC3, 0xBD, 0x50, 0x7D, 0x0B, 0x5A, 0x64, 0x80, 0xB8,
+    0x37, 0x89, 0x83, 0x52, 0xB9, 0xBC, 0x42, 0x5B, 0xC3, 0x40, 0xDC, 0x2B, 0xA7, 0x1C, 0x25, 0x86,
+    0xBC, 0x0A, 0x43, 0x11, 0xF7, 0x18, 0x12, 0x57, 0xA2, 0x1C, 0x79, 0x35, 0x21, 0xB1, 0xF1, 0x6D,
+    0x48, 0x6C, 0x66, 0x57, 0x48, 0x6C, 0x83, 0x61, 0x58, 0x21, 0xB1, 0x7B, 0xA0, 0xDF, 0x68, 0xC1,
+    0xD4, 0x2F, 0x83, 0x88, 0x34, 0x4A, 0x44, 0x9C, 0x6E, 0x28, 0x9D, 0x81, 0xCC, 0x79, 0xD0, 0xD7,
+    0x1C, 0xE4, 0x57, 0x6D, 0xA0, 0x50, 0x0C, 0x1E, 0xE2, 0x5F, 0xBA, 0x49, 0xFB, 0x91, 0x97, 0x13,
+    0x35, 0x3E, 0x24, 0xF2, 0x7B, 0x2B, 0x91, 0xAA, 0xB4, 0xBC, 0xFB, 0xB4, 0x0F, 0x30, 0xA1, 0x96,
+    0x0E, 0x38, 0x0B, 0x33, 0xE2, 0x6E, 0x46, 0xDA, 0xCC, 0xC8, 0xAB, 0x19, 0x7B, 0xCC, 0xE2, 0x9E,
+    0x59, 0xD2, 0x32, 0xCB, 0x2A, 0x66, 0x73, 0x30, 0xD2, 0x61, 0x44, 0x0A, 0xF3, 0xFD, 0xBA, 0x9D,
+    0x91, 0x76, 0x33, 0x62, 0x3F, 0x03, 0x3F, 0x83, 0xE5, 0x0C, 0x76, 0x66, 0x30, 0x9F, 0x85, 0x05,
+    0x6F, 0x67, 0x7A, 0xB5, 0x0F, 0x72, 0x9C, 0xEA, 0xF8, 0xF7, 0xE7, 0x5B, 0x6A, 0xB1, 0x13, 0xE8,
+    0x14, 0xBE, 0xCB, 0x02, 0x75, 0x34, 0x6D, 0xC9, 0x57, 0x69, 0xD2, 0x1C, 0xA6, 0xA9, 0x25, 0x2F,
+    0xD0, 0x1F, 0x4F, 0x2B, 0xF2, 0x82, 0xAC, 0x22, 0x2F, 0x56, 0x7F, 0x90, 0x17, 0x13, 0x88, 0x12,
+    0xD2, 0x39, 0xE4, 0x05, 0xCB, 0x15, 0xAC, 0xB2, 0x4A, 0xFF, 0xA0, 0x83, 0xFC, 0x67, 0xE2, 0x20,
+    0x1F, 0xC4, 0x42, 0xEE, 0x1F, 0x3E, 0xF8, 0xDE, 0xA2, 0x8E, 0xD5, 0x7A, 0x3C, 0x51, 0x86, 0x80,
+    0x60, 0x04, 0xCA, 0xB1, 0x56, 0x90, 0x89, 0x4C, 0x49, 0xBE, 0xA8, 0x0B, 0xF2, 0xF0, 0xE6, 0xBC,
+    0xC0, 0x1C, 0x24, 0xB3, 0xF0, 0xEE, 0xBC, 0x60, 0x87, 0xBC, 0x60, 0x37, 0xBC, 0x78, 0x4A, 0xA2,
+    0x8E, 0xBC, 0x50, 0x8E, 0xBC, 0xD0, 0x2D, 0xF9, 0x9F, 0x8B, 0x25, 0xF7, 0xB2, 0x02, 0xC3, 0x7A,
+    0x82, 0x94, 0x39, 0x49, 0xB4, 0x87, 0x62, 0x6D, 0x7B, 0x00, 0x86, 0xDD, 0x31, 0xC0, 0x77, 0x19,
+    0xF3, 0xC3, 0xAC, 0x5B, 0x8B, 0x45, 0x5D, 0x8A, 0xC8, 0x20, 0x22, 0xF2, 0x59, 0x0A, 0xDE, 0x7D,
+    0xFE, 0x94, 0xAB, 0xF9, 0x63, 0x2C, 0xEF, 0x9E, 0x9B, 0xE6, 0x4F, 0x2A, 0xFD, 0x6A, 0xFE, 0x90,
+    0x9D, 0xB6, 0xA4, 0xD7, 0x1C, 0x71, 0xE7, 0x61, 0x69, 0x20, 0x3F, 0xC8, 0x18, 0xB6, 0xB6, 0x06,
+    0x23, 0x22, 0xA7, 0x45, 0xE4, 0xEE, 0x77, 0x1C, 0xCD, 0x68, 0x26, 0x1C, 0x6B, 0x02, 0xAD, 0xC8,
+    0x2C, 0xE8, 0x86, 0x7F, 0x7C, 0xDE, 0xA1, 0xC5, 0x11, 0xC9, 0x61, 0x7F, 0xFC, 0x26, 0x40, 0xD4,
+    0x9F, 0x1D, 0x82, 0xA8, 0xFE, 0x70, 0xED, 0xE8, 0x0F, 0xA8, 0x7E, 0x98, 0x38, 0xF3, 0xC3, 0x79,
+    0x73, 0x96, 0x5F, 0x2F, 0x88, 0xFA, 0x29, 0xF3, 0xE6, 0x3E, 0x38, 0xC9, 0xDB, 0xB2, 0x1C, 0x18,
+    0x6D, 0xC1, 0x9B, 0x26, 0xAA, 0x57, 0x9C, 0xE4, 0x58, 0xF2, 0xC8, 0xA2, 0xF8, 0x04, 0x29, 0x3D,
+    0xBA, 0x64, 0x27, 0xC8, 0x20, 0xF7, 0xF7, 0xE6, 0x6B, 0x63, 0x07, 0x44, 0x05, 0x3B, 0x30, 0x5F,
+    0xDE, 0xE3, 0x37, 0x87, 0x79, 0x49, 0x3C, 0x9A, 0xB7, 0xCE, 0x8F, 0x5A, 0xC6, 0x79, 0x2C, 0xED,
+    0x7C, 0xEA, 0xD0, 0xE9, 0xB7, 0xB6, 0x17, 0x64, 0x3D, 0x3D, 0x86, 0x9A, 0xDC, 0xED, 0x17, 0x14,
+    0x6C, 0x91, 0x10, 0x80, 0x54, 0x24, 0xC8, 0xE5, 0xE2, 0x20, 0x15, 0xC6, 0x0E, 0x74, 0x8D, 0xEF,
+    0x21, 0x33, 0x41, 0xE3, 0x64, 0xF0, 0x3B, 0xB0, 0x69, 0xF0, 0x06, 0x76, 0x0D, 0x3E, 0x87, 0xDE,
+    0xE0, 0xB3, 0x2A, 0xEA, 0x0C, 0x5E, 0xDB, 0xD8, 0x19, 0x7C, 0xDA, 0xA8, 0xD6, 0xE0, 0x55, 0x9B,
+    0x58, 0x83, 0x57, 0x4E, 0x5B, 0x83, 0x8F, 0x3A, 0x5D, 0x18, 0x3C, 0x3E, 0xC7, 0xE0, 0xD9, 0x9D,
+    0x61, 0xF0, 0xCC, 0x77, 0x30, 0x78, 0x8C, 0xC7, 0xE0, 0xC9, 0x7B, 0x0C, 0x1E, 0xED, 0x30, 0x3F,
+    0x08, 0x3B, 0xEF, 0x49, 0x1A, 0xCC, 0xB4, 0xD0, 0x87, 0xE5, 0x38, 0x90, 0x9E, 0x15, 0x57, 0x32,
+    0x0D, 0xE0, 0xC4, 0xB7, 0x64, 0x81, 0x47, 0x59, 0xC3, 0x58, 0x10, 0x4C, 0x43, 0x24, 0x98, 0x16,
+    0x25, 0x18, 0x87, 0x12, 0x66, 0x1D, 0xE9, 0x0D, 0x36, 0x3D, 0xFA, 0x12, 0x9B, 0xDB, 0x64, 0xE7,
+    0xD9, 0x9C, 0x61, 0x72, 0x36, 0xC3, 0x9F, 0x2E, 0x76, 0x73, 0x36, 0xB5, 0xED, 0x73, 0x36, 0x93,
+    0x57, 0x5D, 0xCE, 0xA6, 0xBA, 0xEE, 0x72, 0x36, 0xE3, 0x5F, 0x36, 0x39, 0x9B, 0x91, 0xD8, 0x9C,
+    0x4D, 0xA4, 0xCA, 0xCF, 0x6E, 0x52, 0x92, 0xFB, 0x4D, 0x0C, 0x79, 0x7F, 0x58, 0xB7, 0xA3, 0x54,
+    0x31, 0xB0, 0x28, 0x01, 0x1E, 0x9D, 0x58, 0xA7, 0x5F, 0x89, 0x51, 0x89, 0x9D, 0x6A, 0x09, 0x82,
+    0x15, 0xB5, 0x58, 0x0E, 0xBE, 0xF1, 0xA3, 0x4B, 0x36, 0x81, 0x87, 0x24, 0xC0, 0x8D, 0xD2, 0x00,
+    0xD9, 0x1C, 0x50, 0x3F, 0x77, 0xC0, 0x2C, 0x2B, 0x20, 0x6D, 0x3C, 0xE0, 0xD3, 0x06, 0xB2, 0x6A,
+    0x0E, 0xB1, 0x0B, 0xB0, 0x5E, 0x5E, 0x90, 0x36, 0x78, 0xF0, 0x68, 0x4B, 0x26, 0x32, 0x4E, 0xBC,
+    0xA1, 0x59, 0x2C, 0xEA, 0x22, 0x69, 0x89, 0xFA, 0x20, 0x50, 0x66, 0x16, 0xF6, 0xE2, 0x0E, 0x94,
+    0x33, 0x80, 0xF9, 0x83, 0x16, 0xA2, 0x3E, 0x88, 0x2D, 0xD1, 0x8B, 0xF1, 0x85, 0xA4, 0xD1, 0x85,
+    0x7E, 0xD3, 0xA3, 0xA5, 0x39, 0xCA, 0x56, 0x64, 0xD2, 0x24, 0x22, 0xAD, 0xFE, 0xF3, 0xF3, 0xCD,
+    0x71, 0xF2, 0xEA, 0xA8, 0x11, 0xC1, 0x37, 0x6A, 0x5B, 0x8B, 0xE8, 0x5B, 0x5B, 0x7E, 0x44, 0xFD,
+    0xD2, 0xA1, 0xDF, 0xAE, 0x30, 0x73, 0xA2, 0xC1, 0xA3, 0x6F, 0xF6, 0xB1, 0xBC, 0x2E, 0xF2, 0x74,
+    0x22, 0xED, 0x36, 0x67, 0x81, 0x88, 0xE3, 0x80, 0x4F, 0x2D, 0x68, 0xEB, 0x81, 0x57, 0x92, 0xEA,
+    0xE3, 0x6C, 0xDA, 0xDF, 0x87, 0xCE, 0xE0, 0x78, 0x84, 0x6A, 0x0D, 0x99, 0xF5, 0x6C, 0xC6, 0xB7,
+    0x0D, 0xD6, 0xE7, 0xD5, 0x19, 0x01, 0x8C, 0x29, 0xA0, 0x9C, 0xF4, 0x00, 0x22, 0xD2, 0x41, 0xF6,
+    0x9C, 0x0B, 0x1F, 0x85, 0x07, 0x48, 0x9C, 0x81, 0x15, 0x69, 0x06, 0x1F, 0xBA, 0x66, 0xB9, 0x92,
+    0xE5, 0x4D, 0xA0, 0xCA, 0xFA, 0xBD, 0xC5, 0x8B, 0x68, 0xAB, 0x44, 0x7A, 0xD2, 0x06, 0x91, 0x31,
+    0xA8, 0x30, 0x03, 0x2B, 0x62, 0x81, 0x49, 0x52, 0x28, 0x17, 0x8B, 0x09, 0x29, 0x33, 0x01, 0x89,
+    0x9A, 0xC8, 0x89, 0x72, 0x81, 0x59, 0x0F, 0xFC, 0x0C, 0x66, 0xB1, 0x78, 0xD6, 0x83, 0x16, 0xE9,
+    0x82, 0x9E, 0x62, 0x62, 0x6C, 0x38, 0x26, 0x5D, 0x2C, 0x0D, 0x22, 0xBE, 0x94, 0x36, 0xDE, 0xFF,
+    0x9D, 0x8F, 0xBA, 0xAC, 0x8D, 0x50, 0x82, 0xB6, 0x90, 0x76, 0x64, 0x15, 0x41, 0x05, 0x0B, 0x25,
+    0x78, 0xBE, 0x78, 0x71, 0x5C, 0x5C, 0x74, 0xA9, 0x88, 0x88, 0x58, 0xF9, 0xFE, 0xF9, 0xF7, 0x16,
+    0x0B, 0xDD, 0x32, 0x07, 0x4A, 0x22, 0x0F, 0x51, 0x4F, 0xEA, 0x20, 0x69, 0x31, 0x2D, 0x64, 0x36,
+    0x96, 0x06, 0x4C, 0x55, 0x3E, 0xFD, 0xCE, 0x17, 0x9B, 0x52, 0xBA, 0x4C, 0xA4, 0x28, 0x47, 0x32,
+    0xE9, 0x58, 0x2B, 0x88, 0x82, 0xE0, 0xE7, 0xA3, 0x2E, 0x6D, 0x0C, 0x46, 0x1A, 0xEA, 0x15, 0x93,
+    0x9F, 0x06, 0x36, 0xE0, 0x86, 0xC8, 0x10, 0x6C, 0x0B, 0xF8, 0xF8, 0xEE, 0xD6, 0xE2, 0x07, 0x22,
+    0x72, 0x55, 0xC4, 0xDF, 0xF3, 0x16, 0x0B, 0xE3, 0x62, 0xF1, 0x3D, 0x91, 0x51, 0x44, 0x5A, 0x5E,
+    0x8C, 0x5F, 0x64, 0x46, 0x4F, 0xFA, 0xA6, 0x07, 0x19, 0xE0, 0x58, 0x7F, 0x64, 0x1E, 0xD4, 0xFB,
+    0x20, 0xD2, 0x32, 0xFE, 0x93, 0x91, 0x01, 0x6D, 0xE7, 0xC4, 0x7D, 0x5E, 0x60, 0xB4, 0x45, 0x5F,
+    0xB9, 0xB5, 0xB8, 0xE8, 0x44, 0xC4, 0x9B, 0xC5, 0x62, 0x71, 0x80, 0x49, 0x0E, 0x13, 0x95, 0x53,
+    0x3D, 0x50, 0xFE, 0xF8, 0x8B, 0x4D, 0x22, 0xD2, 0x91, 0x4B, 0x07, 0x27, 0x38, 0x6C, 0x49, 0x41,
+    0x2A, 0x22, 0x15, 0xF5, 0xCF, 0xBE, 0x29, 0x1C, 0x83, 0x24, 0x2C, 0xC3, 0xED, 0x81, 0x50, 0x18,
+    0xF7, 0x87, 0xF4, 0xD2, 0x1F, 0x52, 0xD0, 0xA5, 0x11, 0x11, 0xB9, 0x2E, 0x22, 0x32, 0x9A, 0xC5,
+    0x62, 0x71, 0xE9, 0xBA, 0x03, 0x96, 0xA6, 0x00, 0xFD, 0xA3, 0x0E, 0xF0, 0x59, 0x05, 0x79, 0xE5,
+    0x41, 0x75, 0x69, 0x0B, 0x82, 0xA9, 0x30, 0x36, 0x92, 0x17, 0xCE, 0x77, 0x24, 0x22, 0x03, 0xA4,
+    0x32, 0xC0, 0xAA, 0xA7, 0x39, 0x26, 0xFB, 0xE4, 0x22, 0x36, 0x7F, 0xE1, 0xBC, 0x9B, 0xAA, 0xED,
+    0x27, 0x56, 0xBB, 0x04, 0xCC, 0x63, 0x13, 0x0B, 0x56, 0x8A, 0x88, 0x81, 0x99, 0x81, 0xB9, 0x29,
+    0xF0, 0x99, 0x8D, 0x7B, 0xDD, 0x3D, 0xEA, 0x94, 0x88, 0xA5, 0x1E, 0x21, 0x2A, 0xEE, 0xF8, 0xF8,
+    0x87, 0x7B, 0x7D, 0xFC, 0x7F, 0x8F, 0xDA, 0x1F, 0x11, 0x75, 0xBA, 0x8A, 0xFB, 0xCC, 0xE2, 0x74,
+    0x71, 0xB4, 0x92, 0x9F, 0x6B, 0xBF, 0x00, 0x0F, 0x04, 0xC2, 0x52, 0x84, 0xE9, 0xB5, 0x9C, 0xD6,
+    0xC5, 0x3B, 0x5E, 0xFA, 0xFF, 0x19, 0x51, 0x96, 0xE3, 0x51, 0x68, 0xC2, 0x2E, 0x2B, 0x02, 0x4E,
+    0x5A, 0x6D, 0xDF, 0xB5, 0x9D, 0xBF, 0x19, 0x51, 0x96, 0xE2, 0x81, 0x30, 0x53, 0x8D, 0x72, 0xA4,
+    0xD5, 0x33, 0x77, 0xAA, 0x41, 0x7B, 0x4A, 0x91, 0x56, 0xFF, 0xEC, 0x9B, 0x63, 0x54, 0x60, 0x56,
+    0xC6, 0x77, 0x7B, 0x13, 0x87, 0xAC, 0x9B, 0x40, 0x4C, 0x13, 0xC7, 0x37, 0x6A, 0x47, 0x2E, 0x4D,
+    0xD0, 0xE6, 0x85, 0x89, 0x6C, 0xAA, 0x23, 0xD4, 0xC0, 0x4C, 0xFA, 0xEB, 0xE4, 0x03, 0x48, 0xFA,
+    0xBD, 0xAD, 0xF3, 0x3E, 0x17, 0xE9, 0x8F, 0x89, 0xBC, 0x03, 0x67, 0xC3, 0x27, 0xB3, 0x9B, 0x34,
+    0xDA, 0x2E, 0x79, 0x46, 0xD9, 0xC3, 0x1A, 0xFC, 0xAA, 0x06, 0x55, 0x6B, 0x67, 0x30, 0x22, 0xA3,
+    0x16, 0x91, 0xE7, 0xC2, 0xC8, 0xEB, 0xBB, 0xFD, 0x9A, 0xE9, 0xB7, 0x0F, 0x4A, 0x46, 0x10, 0xE9,
+    0x21, 0x92, 0x02, 0xD2, 0x55, 0x03, 0xF2, 0x6A, 0x32, 0x29, 0xEB, 0x01, 0x5F, 0x80, 0x98, 0x0B,
+    0xC7, 0x44, 0x8B, 0x48, 0x40, 0xA5, 0x4E, 0x14, 0x60, 0x44, 0x3A, 0x23, 0xD2, 0x3F, 0xB6, 0xB8,
+    0xD8, 0x85, 0x2A, 0xE5, 0xC1, 0x98, 0x30, 0xEA, 0x43, 0x47, 0xAD, 0xCC, 0x12, 0xA5, 0x00, 0x19,
+    0xE1, 0x92, 0x58, 0xC8, 0xDC, 0xEA, 0xA9, 0x2B, 0xE0, 0xF5, 0x76, 0xD9, 0x3B, 0xEE, 0xCF, 0x90,
+    0xBA, 0xFA, 0x85, 0xBA, 0x09, 0xF6, 0x3B, 0xEF, 0xC0, 0x63, 0x8B, 0x97, 0x82, 0xBA, 0x3D, 0x59,
+    0xA1, 0x40, 0x2B, 0xC6, 0x2E, 0x11, 0x1B, 0xEC, 0x93, 0x62, 0xF1, 0x90, 0x89, 0x03, 0x11, 0x4B,
+    0xFA, 0xB6, 0xC0, 0xDC, 0x78, 0x94, 0x13, 0x47, 0xFE, 0x94, 0x58, 0x7A, 0x2D, 0x68, 0x6B, 0x3C,
+    0x3B, 0x88, 0x53, 0x4E, 0x89, 0x35, 0x68, 0x89, 0x7A, 0x8C, 0xD7, 0x16, 0x71, 0xBB, 0x28, 0x79,
+    0xBD, 0x45, 0x8B, 0x01, 0x33, 0x76, 0x20, 0x52, 0xA1, 0x82, 0x71, 0x52, 0x33, 0x99, 0x96, 0xF9,
+    0x68, 0xB1, 0xA8, 0x62, 0x91, 0x66, 0x32, 0xFB, 0x9B, 0x80, 0x2A, 0xC6, 0x19, 0xB1, 0xCC, 0x50,
+    0x32, 0x23, 0x95, 0x19, 0x59, 0x39, 0xC3, 0x98, 0x19, 0xDB, 0x66, 0x46, 0x6F, 0x66, 0xB1, 0x33,
+    0xB3, 0xA4, 0x31, 0x33, 0x6D, 0xCD, 0x2C, 0x2B, 0xCC, 0x6C, 0x86, 0x99, 0xED, 0x62, 0x4C, 0x8F,
+    0x31, 0x0E, 0x63, 0x1A, 0x8C, 0xB1, 0x18, 0x1E, 0xA0, 0x08, 0x93, 0x53, 0x39, 0x53, 0x7C, 0x7C,
+    0x76, 0x92, 0x13, 0xCC, 0x18, 0x94, 0xB8, 0xA0, 0xB2, 0x8F, 0x44, 0x40, 0x8B, 0x87, 0xA5, 0x38,
+    0x92, 0xEB, 0x62, 0x31, 0x5A, 0x88, 0x3B, 0xE3, 0xD1, 0x95, 0x38, 0xBC, 0x12, 0x9B, 0x34, 0x5A,
+    0x30, 0x18, 0xAF, 0x1C, 0xE2, 0xB2, 0x4A, 0x89, 0xF5, 0x68, 0x49, 0x2D, 0xC6, 0xCF, 0x41, 0x6E,
+    0x3A, 0x94, 0xDC, 0x28, 0xD0, 0xD2, 0x83, 0x11, 0x1B, 0x16, 0x44, 0x25, 0x6E, 0xC5, 0x2D, 0xD1,
+    0x6B, 0x1B, 0x79, 0x6D, 0xE9, 0xD2, 0xDB, 0xC8, 0xFA, 0xE7, 0xD6, 0xEE, 0x88, 0x07, 0x80, 0x1D,
+    0xD5, 0x40, 0xDA, 0xCC, 0x81, 0x0D, 0xD5, 0xDC, 0x85, 0x62, 0x9C, 0x97, 0x0B, 0x50, 0x8A, 0x34,
+    0xE4, 0xE3, 0x39, 0xA9, 0x92, 0x9E, 0x78, 0x60, 0x84, 0xC4, 0xE5, 0x36, 0x20, 0x54, 0xE0, 0x4B,
+    0x40, 0xFF, 0xA4, 0x05, 0xF6, 0x86, 0x15, 0x0C, 0x1A, 0xB4, 0x26, 0x4A, 0x2C, 0x60, 0x06, 0x40,
+    0x49, 0x03, 0x94, 0x7B, 0x40, 0xFA, 0x53, 0x07, 0x0C, 0x06, 0xD0, 0x57, 0x7A, 0x88, 0xFB, 0xAC,
+    0x81, 0x92, 0xBA, 0x22, 0x6B, 0x63, 0x79, 0xE1, 0x7C, 0x4F, 0x2A, 0x32, 0xAE, 0xAC, 0x23, 0x08,
+    0xEB, 0x67, 0x41, 0xD2, 0xCC, 0x60, 0x2F, 0x69, 0x51, 0x76, 0xF3, 0x8E, 0x7A, 0xC6, 0xD2, 0x13,
+    0x89, 0x74, 0x98, 0xB7, 0xCA, 0x46, 0xB7, 0x94, 0x91, 0x0F, 0x0C, 0x84, 0xBE, 0xE2, 0xC0, 0x9B,
+    0x09, 0x01, 0x5B, 0x1A, 0x48, 0xAF, 0xB9, 0xF0, 0x72, 0xFD, 0xDA, 0xA4, 0x8B, 0xCD, 0xAB, 0x91,
+    0xC4, 0xA9, 0xFD, 0x63, 0xC3, 0x84, 0xD6, 0xC8, 0xA1, 0xB5, 0xE5, 0x27, 0xF4, 0x41, 0xFA, 0x89,
+    0x7D, 0xF0, 0xEE, 0xD6, 0xD6, 0x56, 0x2D, 0x87, 0xDB, 0x61, 0xCF, 0xFC, 0x0A, 0x7D, 0x10, 0x1A,
+    0x4A, 0x68, 0xE8, 0xF9, 0xD0, 0xD0, 0xFE, 0xB6, 0x86, 0x6E, 0x6D, 0x3D, 0x7D, 0x4D, 0x44, 0x06,
+    0x13, 0xC0, 0x93, 0xA3, 0x0D, 0xAD, 0xC8, 0xAB, 0x81, 0xC4, 0xA9, 0xFD, 0xF8, 0xCE, 0x86, 0xFE,
+    0x8A, 0xB3, 0xE1, 0x37, 0xD0, 0x13, 0xD3, 0x6C, 0x58, 0xDE, 0x73, 0x36, 0x7C, 0xFE, 0x9D, 0x54,
+    0x3C, 0x30, 0x2D, 0xB3, 0x46, 0xB9, 0xBB, 0xF1, 0x5B, 0x51, 0x2D, 0x15, 0xA5, 0x48, 0x8B, 0x7C,
+    0xB7, 0x76, 0x51, 0x11, 0x94, 0xDF, 0x59, 0x0B, 0x64, 0xCD, 0x4A, 0x13, 0x51, 0x32, 0xD1, 0x7A,
+    0xD5, 0xC5, 0x8B, 0xC5, 0xA5, 0x36, 0x13, 0x91, 0xAA, 0x0C, 0x0C, 0x42, 0xDC, 0xAD, 0xE4, 0xE4,
+    0x03, 0xB0, 0x24, 0x6D, 0x57, 0x5A, 0xE7, 0x60, 0xA4, 0x32, 0xDF, 0x3A, 0xEF, 0x23, 0x11, 0xA9,
+    0x62, 0x91, 0x77, 0x56, 0xDA, 0x9B, 0xE3, 0x51, 0xA7, 0xAB, 0xFC, 0x59, 0x7F, 0x3B, 0x8F, 0x13,
+    0xCB, 0x40, 0x29, 0xBD, 0x7A, 0xE1, 0xBC, 0x0B, 0xEB, 0xE4, 0x6A, 0x05, 0x5B, 0xDB, 0x3A, 0xE7,
+    0x44, 0x44, 0x8B, 0x04, 0x2B, 0x96, 0xA4, 0x0D, 0x56, 0x59, 0x16, 0xD5, 0x7F, 0xFF, 0x98, 0xA4,
+    0x22, 0xB6, 0x94, 0x86, 0xB5, 0x02, 0x1E, 0x59, 0xFC, 0x60, 0x62, 0x22, 0x8F, 0x12, 0xDF, 0xD5,
+    0x4A, 0x75, 0xCD, 0x11, 0xD0, 0xE7, 0xB8, 0xD7, 0x16, 0x7C, 0xDC, 0xC3, 0x5E, 0x10, 0x87, 0xD2,
+    0x96, 0xAC, 0xC2, 0xA3, 0x1B, 0xF2, 0x2A, 0x71, 0x28, 0x17, 0x77, 0xB0, 0x17, 0x96, 0xD6, 0x25,
+    0xC4, 0xBD, 0x61, 0x02, 0x93, 0xD2, 0x1B, 0x76, 0x65, 0x18, 0x90, 0x77, 0x4C, 0x0A, 0xFA, 0xA0,
+    0x17, 0xA9, 0x27, 0x8B, 0x28, 0x1E, 0x93, 0x6A, 0xB2, 0xD9, 0x4C, 0xA4, 0x58, 0xE9, 0x5C, 0xA2,
+    0xC5, 0xA2, 0xA2, 0x94, 0x8E, 0xEC, 0x40, 0xA2, 0x82, 0xBC, 0x20, 0xF9, 0x69, 0x1B, 0x30, 0x42,
+    0x9F, 0x17, 0xCC, 0x13, 0x87, 0x29, 0x3C, 0xDA, 0x66, 0x55, 0xD2, 0x2A, 0xA7, 0x1C, 0x4B, 0x3C,
+    0xBA, 0x5A, 0x06, 0x41, 0x75, 0x27, 0xAB, 0xD0, 0x6F, 0x34, 0xC4, 0x37, 0x1D, 0xCC, 0x7A, 0xD0,
+    0x1E, 0x22, 0x39, 0xCA, 0x4D, 0xB4, 0x13, 0x66, 0xE5, 0x83, 0xE2, 0xE8, 0x9B, 0x23, 0xE4, 0x02,
+    0xC9, 0xC0, 0x4A, 0x08, 0x57, 0xAD, 0x21, 0x58, 0x0C, 0xDF, 0x29, 0xDE, 0x1E, 0x30, 0xD8, 0xCB,
+    0xA0, 0x60, 0x6C, 0x27, 0x96, 0x59, 0xDB, 0xBC, 0x22, 0x6D, 0x95, 0x43, 0x39, 0xF6, 0x26, 0x36,
+    0x73, 0x20, 0xEE, 0x29, 0x57, 0x52, 0x77, 0xAB, 0xED, 0xC4, 0xCF, 0xE5, 0xCF, 0xB9, 0x09, 0x6F,
+    0x63, 0xCF, 0x13, 0x90, 0x2C, 0x62, 0x29, 0x02, 0xBC, 0x3A, 0x31, 0xEC, 0xA9, 0x03, 0x92, 0x0E,
+    0xE2, 0x4B, 0x3D, 0x44, 0xC1, 0xF8, 0xBC, 0x63, 0xC5, 0x15, 0x1F, 0x8F, 0x60, 0xA6, 0x5C, 0x30,
+    0x05, 0x69, 0x4E, 0xDE, 0x5E, 0xC1, 0x2E, 0x00, 0x69, 0xF9, 0x69, 0x8B, 0x7E, 0xAD, 0x23, 0x69,
+    0x4B, 0x54, 0xA7, 0x2D, 0x3E, 0xEA, 0x99, 0x63, 0x30, 0xA4, 0x8D, 0xB6, 0xF4, 0x69, 0x83, 0x51,
+    0x8E, 0xE4, 0xCD, 0x1E, 0xFC, 0x12, 0x72, 0x03, 0xEA, 0x46, 0x05, 0x2B, 0x16, 0xE3, 0xC0, 0xB8,
+    0x7D, 0x7E, 0x04, 0x8D, 0xCD, 0x1A, 0x8E, 0xD5, 0x2D, 0xB1, 0x38, 0x28, 0x03, 0x59, 0x79, 0xE4,
+    0x89, 0x97, 0x26, 0xA1, 0x3C, 0x69, 0x97, 0xA0, 0xDA, 0x19, 0xC4, 0x6E, 0x06, 0xB4, 0xB7, 0x55,
+    0x6D, 0x8F, 0x50, 0x2B, 0xF4, 0x6B, 0x3D, 0xA4, 0xAD, 0x21, 0xD8, 0xD5, 0xC4, 0x7D, 0x80, 0x24,
+    0xF2, 0x8A, 0x39, 0xCA, 0x61, 0x0A, 0xF6, 0xC8, 0x2C, 0xDA, 0xA6, 0x0D, 0x71, 0xAF, 0x1C, 0x98,
+    0xB8, 0x83, 0xB4, 0xF5, 0x04, 0xB8, 0x32, 0x18, 0x80, 0x28, 0xA9, 0x80, 0xBA, 0x59, 0xD9, 0x8A,
+    0xA9, 0x6E, 0x65, 0x68, 0x18, 0x0D, 0xC0, 0xC5, 0x11, 0x28, 0x47, 0x20, 0x1B, 0x0E, 0x49, 0x4D,
+    0xF4, 0xE2, 0x63, 0x44, 0x3E, 0xB3, 0x0C, 0xDA, 0xB2, 0x93, 0x36, 0x6C, 0xAA, 0x86, 0x2F, 0xC5,
+    0x87, 0x04, 0x72, 0x79, 0xA7, 0x25, 0x8E, 0xB6, 0x2C, 0x95, 0xC3, 0x30, 0x27, 0xAB, 0x82, 0xA9,
+    0x91, 0x72, 0xCC, 0x26, 0x4B, 0x9C, 0xA8, 0x9B, 0x81, 0xC9, 0x0B, 0xD2, 0xAB, 0x16, 0x3E, 0x6A,
+    0x83, 0x25, 0x4E, 0xE2, 0x57, 0x5C, 0xEC, 0x64, 0xD5, 0xB2, 0xB2, 0xCA, 0x54, 0x1D, 0xD1, 0xB9,
+    0x1E, 0x6A, 0x3F, 0x7D, 0x20, 0x1C, 0x07, 0x52, 0xBB, 0x03, 0x43, 0xDA, 0x92, 0x54, 0x1B, 0xB7,
+    0x4F, 0xB7, 0xA4, 0x81, 0xDD, 0xE5, 0x64, 0x85, 0xE3, 0xEF, 0x7E, 0xF0, 0x7A, 0x1B, 0x7A, 0x65,
+    0xA2, 0x87, 0x96, 0xEC, 0x55, 0x79, 0xAF, 0xF6, 0x89, 0x88, 0xD8, 0x54, 0xDE, 0xF9, 0x34, 0x3F,
+    0x9B, 0x23, 0x07, 0xC5, 0x03, 0xE8, 0xCA, 0x63, 0x94, 0xE3, 0xF2, 0x6D, 0xAC, 0x8A, 0x81, 0x99,
+    0x07, 0x71, 0x28, 0xB1, 0x68, 0x09, 0x1C, 0xC1, 0xEA, 0xF4, 0x86, 0xA5, 0x34, 0xEF, 0x5D, 0xF2,
+    0xA5, 0x88, 0x7B, 0x74, 0x3C, 0x7D, 0x87, 0x27, 0xCD, 0xEA, 0xB4, 0x16, 0xB9, 0x31, 0x2D, 0x1A,
+    0xF7, 0x42, 0x18, 0xEE, 0x73, 0x77, 0x0B, 0xC4, 0xA1, 0x85, 0xBB, 0x1B, 0xF2, 0x71, 0x06, 0x8C,
+    0x8C, 0x46, 0x46, 0xB3, 0x78, 0xD9, 0xAC, 0x20, 0x9D, 0x4F, 0xFA, 0x3B, 0x83, 0xE9, 0x30, 0x1D,
+    0xF1, 0xC7, 0xFE, 0x38, 0x10, 0x42, 0x83, 0x08, 0xBA, 0xA7, 0x1C, 0xE0, 0xD2, 0xBB, 0x88, 0x9F,
+    0x01, 0xE9, 0xF6, 0x80, 0xBA, 0xE9, 0x98, 0xBC, 0x93, 0x82, 0x86, 0x0E, 0x7F, 0x8F, 0xEC, 0x71,
+    0x71, 0x06, 0x75, 0x53, 0xA4, 0x47, 0x5F, 0x15, 0x19, 0x30, 0xA6, 0x48, 0x06, 0xBC, 0x27, 0xF6,
+    0xEA, 0xA6, 0x43, 0x39, 0x7D, 0xD5, 0x92, 0x36, 0xC6, 0x40, 0x5E, 0x78, 0x0F, 0x4B, 0x75, 0xD3,
+    0xA1, 0x3A, 0x7D, 0xD5, 0x92, 0x59, 0x63, 0x88, 0x46, 0xFC, 0xB8, 0xA8, 0x9D, 0xBA, 0x29, 0x32,
+    0xA2, 0xAF, 0xCA, 0x58, 0x60, 0x56, 0x84, 0xCC, 0xE5, 0x2B, 0x21, 0x72, 0x3D, 0x72, 0x1F, 0xAB,
+    0x6F, 0x0F, 0xEC, 0x18, 0x82, 0xF6, 0x86, 0xE4, 0x9A, 0x83, 0xA8, 0xF3, 0x87, 0x99, 0x6F, 0x9D,
+    0x21, 0xB9, 0x26, 0xD2, 0x46, 0x9D, 0x88, 0x14, 0x3B, 0x86, 0xCC, 0x65, 0xA7, 0x2D, 0x43, 0x72,
+    0xCD, 0x91, 0x3F, 0xDB, 0x79, 0x92, 0x76, 0xC7, 0x10, 0x77, 0xD9, 0x69, 0x1B, 0xF9, 0xE4, 0xDA,
+    0x87, 0xE7, 0xC6, 0xA8, 0x13, 0x19, 0xD9, 0x31, 0xD2, 0x93, 0x15, 0xB1, 0x88, 0x54, 0x22, 0xE2,
+    0x8C, 0x88, 0xFF, 0x44, 0x6B, 0x3B, 0x4C, 0x01, 0x22, 0x82, 0x11, 0xB1, 0x0F, 0x8E, 0x8B, 0x17,
+    0x3F, 0xC5, 0x40, 0x4F, 0x5E, 0x9C, 0xBC, 0x44, 0xE4, 0xCE, 0xDB, 0x66, 0xA0, 0xA4, 0x08, 0x14,
+    0xEC, 0x91, 0x02, 0xD4, 0xDF, 0xC5, 0x67, 0xCD, 0x9C, 0x41, 0x49, 0x81, 0xE9, 0x20, 0x2B, 0x88,
+    0xC2, 0x2E, 0x76, 0xA4, 0x02, 0x75, 0x43, 0x7C, 0xE1, 0xD7, 0x6C, 0x3E, 0x57, 0xDC, 0xD5, 0x7C,
+    0xEE, 0x39, 0x07, 0xE6, 0x17, 0xFD, 0x6A, 0xA5, 0xCA, 0x8A, 0x89, 0x38, 0x4C, 0x8A, 0xCB, 0x5D,
+    0x26, 0x15, 0x4C, 0x58, 0x49, 0xFE, 0x4B, 0x3E, 0x27, 0xF3, 0xB9, 0x1F, 0xDF, 0xDB, 0x7C, 0x6E,
+    0x36, 0xA1, 0xCF, 0xDA, 0x03, 0x7F, 0x14, 0x4C, 0xD0, 0x73, 0x8B, 0x72, 0xBA, 0x09, 0x5E, 0x46,
+    0x59, 0x15, 0xBA, 0x64, 0x60, 0x09, 0x65, 0xD4, 0x4F, 0x6B, 0x9F, 0x7E, 0xA3, 0x09, 0x52, 0xA7,
+    0x16, 0x91, 0x46, 0x8B, 0x48, 0xFB, 0xE0, 0x45, 0x79, 0xEF, 0x42, 0xA0, 0xE7, 0xFA, 0x6A, 0x33,
+    0x01, 0xBD, 0x26, 0xEE, 0x61, 0x60, 0x20, 0xEA, 0x99, 0xC0, 0x87, 0xB4, 0x09, 0xD8, 0x74, 0xEA,
+    0x0C, 0xA8, 0x6E, 0x0F, 0x22, 0xFF, 0x69, 0x0D, 0xDD, 0x92, 0x77, 0xCF, 0xAC, 0x1C, 0x0F, 0xDB,
+    0xC3, 0x86, 0xCE, 0xEF, 0x68, 0x68, 0x93, 0x59, 0x4A, 0xD5, 0x11, 0xF7, 0x58, 0x36, 0x50, 0xAF,
+    0x89, 0xFF, 0xE1, 0xC6, 0xEF, 0x7D, 0xE5, 0xC1, 0xDF, 0x8A, 0x2B, 0x5E, 0xE4, 0xF7, 0x78, 0x90,
+    0xFB, 0x39, 0x88, 0x0A, 0xB0, 0xB4, 0x38, 0x64, 0x7C, 0x48, 0x55, 0xED, 0x8B, 0xBF, 0x75, 0xBF,
+    0x25, 0xA7, 0x83, 0x35, 0xC8, 0xE5, 0x27, 0xF2, 0xE1, 0xD6, 0xD9, 0x23, 0x07, 0x90, 0x8B, 0xC8,
+    0xFB, 0x22, 0xD2, 0x6F, 0x6D, 0x6D, 0x9D, 0x3D, 0x74, 0x63, 0x13, 0x11, 0x91, 0x8F, 0xA6, 0xFD,
+    0x5B, 0x5B, 0x61, 0x3B, 0xCE, 0x7F, 0xDF, 0x26, 0x6F, 0x54, 0xD9, 0x3A, 0xDB, 0xAF, 0x44, 0x3F,
+    0xFF, 0x9C, 0x0F, 0x57, 0x6C, 0xA3, 0x88, 0xDC, 0x94, 0x43, 0x2E, 0x72, 0xB1, 0x58, 0xFC, 0x2F,
+    0x22, 0xF2, 0x1F, 0xB6, 0xB6, 0xB6, 0xB2, 0xD7, 0x7C, 0xFE, 0x94, 0x33, 0x49, 0xB3, 0x9B, 0x56,
+    0x67, 0x98, 0x27, 0xCE, 0xC4, 0x5D, 0x56, 0xF9, 0xD4, 0x6E, 0x46, 0x45, 0x66, 0x7D, 0xFE, 0xAA,
+    0xCF, 0x9F, 0xEC, 0x8D, 0xEA, 0x8C, 0x72, 0x3B, 0xAA, 0xDD, 0x4D, 0xEC, 0x2B, 0x69, 0x75, 0x66,
+    0x8D, 0x79, 0xE2, 0x4A, 0xE5, 0x8C, 0xEA, 0xF2, 0x27, 0xBB, 0xAC, 0xEA, 0x75, 0xE5, 0x53, 0xBB,
+    0xAD, 0xEC, 0x66, 0x54, 0x3C, 0xCC, 0x89, 0x03, 0x20, 0xBE, 0x87, 0x19, 0xA4, 0x05, 0x71, 0xA3,
+    0x6E, 0xDD, 0xAA, 0x45, 0xE4, 0xFF, 0xFE, 0x9F, 0xFF, 0xC2, 0xC5, 0x0D, 0x5C, 0x86, 0x53, 0xD3,
+    0x95, 0xD5, 0x6D, 0xBA, 0x42, 0xB5, 0xD0, 0x83, 0x39, 0x78, 0x80, 0x5F, 0x9D, 0x70, 0xE2, 0xB6,
+    0x65, 0x63, 0x1D, 0xE2, 0x96, 0x17, 0xD6, 0x4F, 0x3C, 0x2F, 0xE2, 0x45, 0xC4, 0xC6, 0x0D, 0xAC,
+    0x7F, 0x6C, 0x81, 0x69, 0x61, 0x9D, 0xB5, 0x27, 0x9B, 0xB3, 0x13, 0x5C, 0x5E, 0x7C, 0x89, 0x22,
+    0x9E, 0x48, 0xC7, 0xE1, 0x9D, 0x45, 0xD6, 0x9B, 0xA1, 0x94, 0x52, 0x4A, 0x31, 0xA3, 0x19, 0xD2,
+    0x0E, 0x7E, 0x8F, 0xB4, 0x89, 0xA5, 0xA8, 0x7D, 0x2E, 0x3F, 0x91, 0x1F, 0x49, 0xB5, 0xC7, 0x57,
+    0x02, 0x58, 0xF9, 0x27, 0xBF, 0x18, 0xCA, 0xB5, 0x09, 0xCE, 0xEB, 0xEB, 0x22, 0xFF, 0x49, 0x1F,
+    0x0F, 0x25, 0x99, 0x2D, 0x38, 0x83, 0x7E, 0xE3, 0x17, 0x63, 0x19, 0x01, 0xB9, 0xBC, 0xC1, 0x67,
+    0x9A, 0x87, 0x71, 0xC5, 0x8B, 0x81, 0xAF, 0xD6, 0xD2, 0xF2, 0xF8, 0x67, 0x9B, 0x83, 0x0F, 0x12,
+    0x57, 0x9C, 0x91, 0xDB, 0xB6, 0xB8, 0xBA, 0xBF, 0x7F, 0x51, 0x21, 0xF2, 0xEE, 0x56, 0x43, 0x43,
+    0x43, 0xCB, 0x67, 0x2B, 0xB7, 0x75, 0x8E, 0x84, 0x84, 0x84, 0xF4, 0xB3, 0x94, 0x3B, 0xA2, 0x75,
+    0xA8, 0x82, 0xAB, 0x25, 0xE2, 0x27, 0x95, 0xE5, 0x52, 0x57, 0x41, 0x83, 0x39, 0x8B, 0x5C, 0x30,
+    0x86, 0xD2, 0xC5, 0x06, 0x9B, 0x00, 0x89, 0xD5, 0x85, 0x01, 0x88, 0x9C, 0x6A, 0x32, 0x00, 0xB6,
+    0xE9, 0x74, 0x05, 0x90, 0xB1, 0x19, 0x26, 0xBA, 0xB2, 0xFA, 0xA9, 0xF6, 0x8F, 0xE0, 0x5F, 0xD2,
+    0x25, 0xAF, 0x39, 0x71, 0x91, 0xB4, 0xEB, 0xB1, 0xEB, 0xF6, 0x6A, 0xC6, 0x65, 0xF2, 0xB7, 0xDD,
+    0xEE, 0xA6, 0x6A, 0x76, 0x53, 0x5B, 0xF7, 0x9B, 0x19, 0xFD, 0x0C, 0x77, 0xEC, 0x1D, 0x93, 0xDA,
+    0x5C, 0x17, 0x9B, 0x90, 0xC5, 0x6D, 0x72, 0xC5, 0xEA, 0x0A, 0x5D, 0xF5, 0xD1, 0x07, 0x4E, 0xB5,
+    0x24, 0x76, 0xC6, 0xF6, 0x36, 0x3D, 0xAA, 0x4D, 0xAB, 0x4C, 0x33, 0x23, 0x76, 0xB1, 0x4B, 0xAF,
+    0x34, 0xBA, 0xA0, 0x63, 0x5B, 0xB5, 0x7D, 0x62, 0xD9, 0x45, 0x3F, 0xDB, 0x65, 0xCA, 0xB1, 0x49,
+    0x24, 0xBD, 0x92, 0x0E, 0x03, 0x59, 0x8F, 0x09, 0x9C, 0xC8, 0x19, 0xB8, 0x83, 0xF1, 0xA8, 0x2B,
+    0x0E, 0x64, 0x14, 0xF1, 0x1C, 0x2C, 0xF3, 0xCB, 0xAC, 0x3A, 0xB0, 0x23, 0x9B, 0xC5, 0x8E, 0x15,
+    0x84, 0x9C, 0x15, 0x9B, 0xC1, 0xDE, 0x2C, 0x74, 0x41, 0x95, 0xAF, 0xC4, 0x5D, 0xA7, 0xDA, 0x03,
+    0x79, 0x73, 0x9B, 0x3E, 0x5D, 0x7D, 0xD9, 0x19, 0xB3, 0x03, 0xF4, 0x20, 0xB1, 0xFA, 0xA9, 0xF6,
+    0xBF, 0x80, 0x3F, 0x82, 0x3F, 0xA2, 0x4B, 0xDE, 0x74, 0x75, 0x8F, 0x74, 0x91, 0x38, 0x13, 0xBB,
+    0xBE, 0xAC, 0x8B, 0xBA, 0x66, 0x1C, 0x93, 0xBF, 0xED, 0xB7, 0x8D, 0x72, 0xB3, 0xA4, 0x5D, 0xA6,
+    0xB6, 0xF6, 0x33, 0x5D, 0x6C, 0x67, 0xEC, 0x1A, 0xFA, 0x63, 0xEF, 0xE4, 0x89, 0xD5, 0x7F, 0x68,
+    0x33, 0x5D, 0xCD, 0x40, 0x3F, 0xE1, 0xD4, 0x75, 0x97, 0x5C, 0x69, 0x52, 0x4B, 0x6A, 0xB7, 0xE9,
+    0xFB, 0xA8, 0xEB, 0x62, 0x87, 0x6A, 0x32, 0x66, 0x33, 0x76, 0x36, 0xD9, 0x45, 0xB9, 0xC4, 0xEA,
+    0x3F, 0xB1, 0x99, 0x2E, 0x72, 0x22, 0x17, 0x75, 0xEA, 0x47, 0x2E, 0xBD, 0xD2, 0xEA, 0x8A, 0x9E,
+    0x59, 0xE4, 0xB6, 0x95, 0xDB, 0x55, 0x0D, 0xDB, 0xA4, 0xD6, 0xEB, 0x67, 0xBB, 0xEC, 0x49, 0xC7,
+    0x0C, 0x64, 0x88, 0xC4, 0x2B, 0xE9, 0xC9, 0x41, 0x0F, 0x64, 0x7E, 0xA5, 0xC9, 0x3E, 0x0E, 0x67,
+    0xE0, 0x0C, 0xEC, 0xE0, 0x63, 0xA7, 0xDA, 0xD4, 0xEA, 0x62, 0x9D, 0x0D, 0xBE, 0x05, 0x3B, 0xA9,
+    0xD5, 0xB6, 0x8F, 0x5D, 0xCE, 0x4C, 0x35, 0xA9, 0xDD, 0xA5, 0xD3, 0xAC, 0xC7, 0xAD, 0xB2, 0x1B,
+    0x7C, 0x2B, 0x2D, 0x60, 0x27, 0xB5, 0xBB, 0x78, 0xFD, 0x6C, 0x1F, 0xBB, 0x5C, 0x39, 0xD5, 0x6E,
+    0x26, 0x4D, 0x6A, 0x77, 0x75, 0xA5, 0x0B, 0x97, 0xB1, 0x1E, 0xB7, 0x9B, 0x6C, 0x28, 0xBB, 0xCD,
+    0xB7, 0xD2, 0xE2, 0x87, 0xEC, 0x60, 0xC8, 0x0A, 0x6D, 0x55, 0x13, 0x3B, 0x3A, 0xB6, 0xF9, 0xCA,
+    0x8E, 0xAE, 0xF4, 0x6B, 0x2E, 0xEA, 0x66, 0x98, 0xC4, 0xAA, 0xE6, 0x15, 0x76, 0x35, 0xFA, 0xC9,
+    0x36, 0x72, 0x1B, 0x7C, 0x25, 0xA9, 0x76, 0xF4, 0xB7, 0x1D, 0x3E, 0x57, 0x6D, 0xD4, 0xCD, 0x52,
+    0xAB, 0xDC, 0xB6, 0xAE, 0x54, 0xF3, 0x4A, 0x46, 0x6A, 0xDD, 0x3A, 0xFA, 0xC9, 0x76, 0x83, 0x4C,
+    0xD9, 0x67, 0xF8, 0x4A, 0x52, 0xFD, 0x90, 0x2F, 0x40, 0x6A, 0x51, 0x1D, 0xF1, 0xDB, 0xF0, 0xF3,
+    0x86, 0xCB, 0x1B, 0x6C, 0xA4, 0xC5, 0x29, 0x9C, 0xE6, 0x54, 0x5A, 0xA8, 0x2B, 0x96, 0xCB, 0x3C,
+    0x80, 0xAE, 0xB4, 0x4D, 0x9B, 0xB4, 0x4D, 0xDA, 0xC4, 0xC5, 0x3D, 0xA6, 0x50, 0x1D, 0x26, 0x68,
+    0x22, 0x52, 0xE0, 0x01, 0x76, 0x26, 0xFF, 0xEC, 0xA8, 0x67, 0x8F, 0x12, 0xAF, 0xBA, 0xB4, 0xC9,
+    0xAB, 0xF9, 0x44, 0x91, 0x26, 0x40, 0x26, 0x2F, 0x38, 0x9E, 0xA3, 0x7A, 0xF4, 0x13, 0x1E, 0x53,
+    0x29, 0x97, 0xB8, 0xA8, 0x0D, 0x5E, 0xA4, 0x18, 0x28, 0x41, 0x5B, 0x22, 0xBF, 0x52, 0x8F, 0x7A,
+    0x20, 0xB3, 0x06, 0xA0, 0xD4, 0x96, 0xE8, 0x42, 0x24, 0x8E, 0x97, 0x0C, 0x89, 0x27, 0x7B, 0xBD,
+    0xC3, 0xD8, 0xC8, 0x1B, 0xB4, 0xA0, 0x2D, 0xEA, 0x83, 0xE0, 0xE6, 0x97, 0x04, 0x6E, 0x22, 0x0B,
+    0x6A, 0xD6, 0x39, 0xA8, 0xA0, 0x06, 0xF1, 0x41, 0xE9, 0xC9, 0x1A, 0x59, 0xA5, 0xAD, 0xEA, 0x98,
+    0xC7, 0x0E, 0x53, 0x45, 0xDD, 0x3F, 0x40, 0x75, 0x1C, 0x23, 0xE0, 0x37, 0x86, 0xB9, 0xB6, 0xF9,
+    0x15, 0x97, 0x3A, 0x1F, 0x79, 0xC3, 0x5C, 0xDB, 0xEC, 0x39, 0x97, 0xB4, 0x3E, 0xEA, 0x0D, 0x33,
+    0x6D, 0xF5, 0x53, 0x4E, 0x35, 0x3D, 0xDD, 0x3A, 0x9B, 0x69, 0xA5, 0x9F, 0x6C, 0x95, 0x7D, 0x05,
+    0x77, 0x8A, 0x8D, 0x88, 0xE8, 0x40, 0xA4, 0x99, 0xE7, 0x8D, 0x79, 0xA3, 0xD7, 0x1F, 0xF8, 0xD8,
+    0x3F, 0x30, 0x19, 0x7E, 0x9E, 0x97, 0xC2, 0x88, 0xA8, 0x1B, 0xAF, 0x79, 0x76, 0x93, 0x26, 0xB5,
+    0x33, 0x76, 0x95, 0x0B, 0xBB, 0x36, 0xB1, 0xBB, 0x6C, 0x67, 0x55, 0xF2, 0x46, 0xCB, 0xBC, 0x27,
+    0x19, 0xA0, 0x2C, 0x50, 0xED, 0xCA, 0x2D, 0xE8, 0xA8, 0x08, 0x5E, 0x41, 0x1D, 0x84, 0xD2, 0x39,
+    0x44, 0x05, 0x8F, 0x2D, 0x16, 0x8B, 0x3F, 0x13, 0x11, 0x79, 0x6C, 0xB1, 0x58, 0xBC, 0xF8, 0x65,
+    0xE0, 0xB7, 0x36, 0x80, 0xAF, 0x68, 0xE0, 0x72, 0x62, 0x89, 0xDB, 0xA8, 0x27, 0xAB, 0x30, 0x32,
+    0xC0, 0x31, 0xB9, 0x00, 0x6C, 0x01, 0x99, 0x74, 0x50, 0xBF, 0x50, 0xA3, 0x5A, 0x12, 0x9B, 0x16,
+    0xE0, 0xBE, 0x04, 0x3C, 0xBE, 0x01, 0x7C, 0xE9, 0x78, 0x90, 0x4B, 0xD6, 0x60, 0x1D, 0x36, 0xE0,
+    0x19, 0xE8, 0x88, 0x1C, 0x71, 0x83, 0xB2, 0xA4, 0x15, 0x1A, 0x4E, 0xC2, 0x06, 0x6C, 0xC3, 0x00,
+    0x42, 0xFC, 0x93, 0x42, 0x5D, 0xB1, 0xE9, 0xB7, 0xAD, 0x8E, 0xDA, 0x93, 0xB8, 0x4D, 0x9E, 0xD9,
+    0x66, 0x03, 0x8E, 0x68, 0x58, 0x57, 0x06, 0x1D, 0x2B, 0x2B, 0x94, 0x03, 0x93, 0xF4, 0x95, 0x78,
+    0x03, 0x9C, 0x49, 0xAB, 0x7F, 0x18, 0x3A, 0xF0, 0xDD, 0xBF, 0x0E, 0x36, 0x1C, 0x3A, 0x28, 0xE9,
+    0x21, 0xFA, 0x86, 0xBC, 0x77, 0x61, 0xBA, 0x7B, 0xF5, 0x80, 0x6C, 0xBE, 0x7A, 0xF6, 0x1B, 0x53,
+    0x1F, 0x4D, 0xEA, 0xFB, 0x15, 0xD0, 0x08, 0x44, 0x7D, 0xB0, 0x2A, 0x59, 0x2B, 0x1E, 0xA0, 0x88,
+    0x8A, 0xC9, 0x38, 0x36, 0xEE, 0x56, 0x06, 0x4E, 0xCB, 0x95, 0x91, 0x6C, 0x46, 0xF0, 0x76, 0x27,
+    0xB1, 0x7C, 0x59, 0x35, 0x6B, 0x3C, 0x1C, 0xB9, 0x58, 0xBF, 0xF3, 0x61, 0x6D, 0xD3, 0xFD, 0x8D,
+    0xF3, 0x7F, 0x25, 0x22, 0x2E, 0x16, 0x91, 0xFE, 0x1B, 0x72, 0xEB, 0xCF, 0xF9, 0x67, 0xF5, 0xF8,
+    0x7D, 0x74, 0x47, 0x90, 0xC6, 0xD3, 0x1B, 0x80, 0xBA, 0x61, 0x83, 0xA0, 0x13, 0x7F, 0xD0, 0x07,
+    0xB0, 0x2B, 0xEA, 0x4D, 0xA1, 0x7A, 0xDD, 0x84, 0xF9, 0xB8, 0x1B, 0x77, 0x60, 0xE8, 0x83, 0xFC,
+    0x14, 0x15, 0xC7, 0x39, 0xCA, 0x85, 0xA9, 0x66, 0xEA, 0x0F, 0x5D, 0x4C, 0x76, 0x30, 0xDB, 0xD3,
+    0x49, 0xEC, 0x56, 0x27, 0xD5, 0x74, 0xB2, 0x39, 0xD9, 0x3F, 0x45, 0x2B, 0x4E, 0x39, 0xB5, 0x93,
+    0x35, 0xCD, 0x6C, 0xE5, 0xAD, 0xD6, 0x4F, 0x9D, 0xAA, 0x9A, 0xE9, 0x24, 0x5B, 0x9D, 0x94, 0x52,
+    0xCA, 0xFC, 0xE5, 0x1D, 0x3E, 0xFE, 0x6F, 0xBE, 0x55, 0x4A, 0x29, 0x77, 0xBB, 0xB2, 0x43, 0x29,
+    0xA5, 0x9C, 0xD8, 0x32, 0x72, 0x5A, 0x7E, 0x74, 0xB1, 0x63, 0x49, 0x5E, 0xA4, 0x4D, 0x7C, 0xFB,
+    0xC1, 0xEF, 0x3F, 0x7D, 0x4D, 0x3A, 0x19, 0xEE, 0x76, 0xA9, 0x48, 0x9B, 0xB8, 0x93, 0xC1, 0xC8,
+    0xEF, 0x6F, 0x15, 0x87, 0x16, 0x0D, 0x9C, 0x97, 0xA2, 0x14, 0x49, 0x44, 0x9C, 0xF9, 0x7E, 0xFD,
+    0xDC, 0xAD, 0x73, 0xFE, 0xCB, 0xE8, 0xD7, 0x0A, 0x86, 0x20, 0x7C, 0xCC, 0x0F, 0x04, 0xA7, 0x24,
+    0xEC, 0xD2, 0x66, 0x85, 0x3E, 0xE2, 0xC1, 0x14, 0xA8, 0x8E, 0x68, 0x80, 0xAC, 0x21, 0xE9, 0xA0,
+    0x2C, 0xD0, 0x21, 0x40, 0xC7, 0xC4, 0x29, 0x4D, 0x9F, 0xCE, 0x76, 0xE8, 0x92, 0x69, 0xF7, 0xF0,
+    0x81, 0xF2, 0xF7, 0xC8, 0xB6, 0x13, 0xDE, 0x28, 0xE1, 0xB3, 0x9A, 0x76, 0x63, 0xD0, 0xC6, 0x1D,
+    0x29, 0x10, 0xD5, 0x03, 0xD9, 0x77, 0x44, 0x5C, 0xEA, 0xC6, 0xEF, 0x8E, 0xB1, 0xFF, 0x32, 0xDA,
+    0x96, 0x10, 0x75, 0x59, 0x05, 0xB3, 0xA4, 0x85, 0xEC, 0xD9, 0x7E, 0xC2, 0xC5, 0x95, 0xD3, 0x15,
+    0xAA, 0x53, 0x0D, 0x49, 0x47, 0x47, 0xD2, 0xB1, 0x89, 0x72, 0xE8, 0x42, 0x39, 0x54, 0x43, 0x07,
+    0x8E, 0x6D, 0xD8, 0x20, 0x03, 0x4D, 0x54, 0xDC, 0xBE, 0xF8, 0x66, 0x05, 0x59, 0xA5, 0x1D, 0xDA,
+    0x29, 0x8F, 0xF2, 0x8C, 0x50, 0xB3, 0x76, 0xA0, 0x6A, 0x30, 0x9C, 0x97, 0xCA, 0x28, 0x11, 0x67,
+    0xD4, 0x78, 0xCE, 0x9B, 0xA8, 0x08, 0xA8, 0xB8, 0xB9, 0x3D, 0x99, 0x1B, 0x82, 0x46, 0x43, 0xF5,
+    0x06, 0x74, 0x3B, 0x03, 0x53, 0xAD, 0xC3, 0xC0, 0x3A, 0x71, 0xC7, 0x3A, 0xAA, 0x65, 0x1D, 0xD5,
+    0x70, 0x0A, 0xD5, 0xF0, 0xC0, 0xED, 0x1D, 0x63, 0x48, 0x5A, 0xEA, 0x42, 0x3B, 0xEA, 0x4A, 0x3B,
+    0x4A, 0x52, 0x17, 0x6E, 0xA9, 0x45, 0xC4, 0x04, 0x7E, 0xFC, 0x6B, 0x2E, 0xCC, 0xC8, 0xE8, 0xA8,
+    0xBE, 0xD0, 0x4C, 0x53, 0x2F, 0xAB, 0xC2, 0x58, 0xA5, 0x93, 0x5A, 0x56, 0xDD, 0x79, 0x63, 0x09,
+    0x6C, 0x6D, 0x9D, 0xC5, 0x88, 0x74, 0xFA, 0xA2, 0xC8, 0x73, 0xB6, 0x96, 0xCE, 0xE5, 0x22, 0x1B,
+    0xA9, 0xC8, 0xD5, 0x58, 0xE4, 0x97, 0xB6, 0x96, 0xD1, 0xE5, 0x22, 0xBB, 0xA9, 0xC8, 0x8D, 0x58,
+    0xE4, 0x23, 0x5B, 0xCB, 0x70, 0xF4, 0x8E, 0x6B, 0xB6, 0x96, 0xD6, 0xE5, 0xD2, 0x6C, 0xA4, 0x05,
+    0x3A, 0x6E, 0x50, 0xF6, 0x32, 0xB8, 0x53, 0x70, 0x7F, 0x19, 0x61, 0xFB, 0xAF, 0x44, 0x9A, 0x5C,
+    0x64, 0x48, 0x45, 0xBE, 0xF6, 0xA6, 0x88, 0x3B, 0x95, 0x8B, 0xC4, 0xD7, 0x44, 0xDC, 0x29, 0x73,
+    0xEF, 0x83, 0x5C, 0x24, 0x6E, 0x44, 0xDC, 0xA9, 0x54, 0xE4, 0x62, 0x93, 0x8B, 0x0C, 0x3C, 0xB2,
+    0x58, 0x5C, 0x30, 0x22, 0x17, 0x94, 0x88, 0xD8, 0xCD, 0xA7, 0x45, 0x94, 0xAD, 0xA5, 0xDF, 0x48,
+    0x45, 0xAE, 0xD8, 0x5A, 0xFC, 0x46, 0x1A, 0x2A, 0x3C, 0x6C, 0xA4, 0x22, 0xD7, 0x57, 0x07, 0xD7,
+    0x56, 0x97, 0xAE, 0xD8, 0x5A, 0xFA, 0xD9, 0x25, 0x11, 0x25, 0x22, 0xF6, 0xB1, 0xC5, 0xA2, 0x0A,
+    0x33, 0x2F, 0x69, 0x27, 0x64, 0xB9, 0x01, 0xD5, 0xF0, 0x65, 0x65, 0xD7, 0xCA, 0x3F, 0xFB, 0x3F,
+    0xC7, 0x5A, 0x44, 0x1E, 0x59, 0x51, 0x21, 0xB3, 0x0B, 0x4B, 0x43, 0xE4, 0xF3, 0x4A, 0x75, 0xBA,
+    0x89, 0x5D, 0x6A, 0x39, 0x1E, 0xF1, 0x80, 0xEA, 0xCA, 0xEF, 0xF4, 0xE6, 0x63, 0xBA, 0x7D, 0xF3,
+    0x64, 0xAF, 0xAD, 0x4F, 0xEC, 0x66, 0xDC, 0xAE, 0xDD, 0xFF, 0x6A, 0xF0, 0xEB, 0xDF, 0xEE, 0x67,
+    0xF1, 0xFA, 0x15, 0xBB, 0x64, 0x8A, 0x26, 0xF3, 0xAB, 0x3E, 0x23, 0xAB, 0x92, 0x37, 0x9C, 0xFA,
+    0x1B, 0x1F, 0x75, 0x9B, 0xEC, 0xC2, 0x26, 0x64, 0xA0, 0x2B, 0x92, 0x86, 0x38, 0x88, 0x92, 0xDB,
+    0x41, 0x4C, 0x2C, 0x48, 0x2D, 0xAA, 0x25, 0x0A, 0xF2, 0xE1, 0x26, 0xE4, 0xE1, 0x46, 0xFB, 0xE0,
+    0x53, 0x2E, 0x75, 0x5D, 0xEC, 0x77, 0x29, 0x21, 0x82, 0x13, 0x67, 0x80, 0x88, 0x5A, 0xDE, 0x81,
+    0xA8, 0x0D, 0xEE, 0xD6, 0xDD, 0x92, 0x47, 0x65, 0xFC, 0x6A, 0xBF, 0x01, 0xC7, 0x44, 0xFA, 0xDF,
+    0x06, 0xA2, 0xBA, 0x9D, 0xD4, 0x1A, 0xA9, 0x74, 0x50, 0x7F, 0xB7, 0x26, 0x6E, 0x49, 0x6D, 0x5A,
+    0x10, 0xB9, 0x93, 0xC0, 0x33, 0x1B, 0xC0, 0xA9, 0x69, 0xCC, 0xBE, 0x05, 0xA4, 0x15, 0x51, 0xF5,
+    0xCA, 0x6F, 0x33, 0x4B, 0x9F, 0x73, 0xF4, 0xAF, 0x78, 0xD4, 0xFB, 0x35, 0x68, 0xB1, 0xD1, 0x56,
+    0xBD, 0xBF, 0x65, 0x44, 0xE4, 0xE7, 0x0B, 0xB9, 0xB5, 0x40, 0x8B, 0x45, 0x7D, 0x54, 0x83, 0x7F,
+    0xC5, 0x63, 0xD2, 0xE7, 0x5C, 0x6C, 0x5F, 0x79, 0x08, 0xD2, 0x6A, 0x8A, 0x30, 0x73, 0xD4, 0x08,
+    0x86, 0xB2, 0x80, 0x01, 0xA2, 0x0B, 0x77, 0x1F, 0xC9, 0xA4, 0x0A, 0x9A, 0xA4, 0xF1, 0xE8, 0x72,
+    0x7F, 0x97, 0x2D, 0x2A, 0xC0, 0x14, 0x44, 0x43, 0x40, 0xD8, 0x8F, 0x15, 0xEC, 0xA4, 0xB6, 0xCF,
+    0x0A, 0x93, 0x34, 0xBB, 0xDA, 0xE6, 0xCA, 0x6D, 0xA6, 0x56, 0x3F, 0xEB, 0x72, 0xD5, 0xA6, 0xB6,
+    0xD7, 0xB1, 0x53, 0xCD, 0x76, 0x5A, 0x75, 0x71, 0xBB, 0xA9, 0xEC, 0x2B, 0xB8, 0x93, 0x71, 0xB3,
+    0xC1, 0xB7, 0x52, 0xDA, 0x2F, 0x1D, 0x79, 0x64, 0x60, 0x00, 0xCA, 0x82, 0x95, 0x36, 0xED, 0x9E,
+    0x95, 0xFC, 0xF8, 0xF6, 0x0C, 0xC0, 0x33, 0xA6, 0x00, 0xCC, 0xF3, 0x2D, 0xA0, 0xAF, 0x1F, 0x80,
+    0xFF, 0xF7, 0xB5, 0x1D, 0x3F, 0xE2, 0xEF, 0x13, 0x5E, 0x3E, 0x35, 0xFF, 0xEB, 0x87, 0xBD, 0xD7,
+    0x00, 0xE9, 0xF5, 0x1E, 0x50, 0x7E, 0x00, 0x18, 0x1F, 0x01, 0x78, 0xF0, 0x7E, 0xDF, 0x11, 0x18,
+    0xA9, 0xA4, 0x3B, 0xE2, 0x9F, 0xB4, 0x7E, 0xBF, 0x65, 0xA3, 0x02, 0x88, 0x9E, 0xEA, 0x00, 0xD5,
+    0x8D, 0x40, 0x34, 0x86, 0xD6, 0x3E, 0x59, 0x00, 0x71, 0x81, 0xBE, 0xD2, 0x8F, 0xF9, 0xDD, 0x4A,
+    0x1E, 0x7B, 0xAE, 0x1B, 0xCD, 0x13, 0x2B, 0xA6, 0x6D, 0x3C, 0x48, 0x96, 0x9F, 0xF6, 0xCA, 0x07,
+    0x80, 0xE3, 0xA6, 0x20, 0xEA, 0x4D, 0x85, 0xF2, 0xA6, 0x20, 0xF6, 0x27, 0x81, 0xCB, 0x9F, 0x56,
+    0xF0, 0x5F, 0xDE, 0xFE, 0xA2, 0xE1, 0xA0, 0x7F, 0x27, 0x33, 0xB9, 0x7E, 0x65, 0xE7, 0x40, 0x5C,
+    0xE8, 0xEA, 0x0B, 0xA8, 0x5E, 0xB5, 0xBA, 0x61, 0xA4, 0x57, 0x3D, 0xA6, 0x98, 0x31, 0x10, 0x15,
+    0xBA, 0x5A, 0x3B, 0x30, 0x2C, 0x3E, 0x52, 0x22, 0x70, 0x53, 0x41, 0xD7, 0x7C, 0x7E, 0x85, 0x70,
+    0xCD, 0xB7, 0xB6, 0xCE, 0x4C, 0xCE, 0x52, 0x47, 0x4B, 0x3C, 0xC0, 0x8C, 0xE3, 0xE8, 0x46, 0x57,
+    0x06, 0xD5, 0xAB, 0x36, 0x6B, 0x18, 0xE9, 0x13, 0xC7, 0x49, 0x66, 0xBC, 0xC2, 0x1D, 0x25, 0x5E,
+    0x0A, 0xFC, 0xE8, 0x2F, 0x86, 0x89, 0xEC, 0x46, 0xFF, 0xE3, 0x50, 0x7F, 0xEF, 0x47, 0xAB, 0x80,
+    0x15, 0xF9, 0x4F, 0xF6, 0xFD, 0x03, 0xD3, 0xF5, 0x08, 0x8E, 0x97, 0xF9, 0xFB, 0x9D, 0x87, 0xF8,
+    0x2F, 0x87, 0xFA, 0x7B, 0x3F, 0xBA, 0xC0, 0x0A, 0x95, 0x11, 0xF9, 0xDA, 0x5B, 0x01, 0x83, 0x50,
+    0xF6, 0x33, 0xE2, 0x23, 0xE7, 0x9A, 0xA4, 0x49, 0x9A, 0xA4, 0xFD, 0x4C, 0x38, 0x47, 0x3D, 0x1A,
+    0x9F, 0xF7, 0xDA, 0xA5, 0xAD, 0xB2, 0xF7, 0x5B, 0x2A, 0xE0, 0x23, 0x51, 0xA1, 0x6C, 0xD2, 0x68,
+    0x97, 0x75, 0xC6, 0xD7, 0xE3, 0xFD, 0x97, 0x8C, 0xAB, 0xB4, 0xFD, 0xCA, 0xE3, 0x3F, 0x7C, 0x68,
+    0x63, 0x43, 0xBB, 0xFB, 0x7F, 0x67, 0x54, 0x48, 0xF5, 0xB5, 0xEA, 0xEF, 0xD2, 0x33, 0x3C, 0x4C,
+    0x36, 0x32, 0x8E, 0xA9, 0xDD, 0x9E, 0xD1, 0x77, 0xF1, 0x2F, 0x6D, 0xF2, 0x36, 0xD9, 0x36, 0x3B,
+    0x2E, 0xBA, 0xD9, 0xA4, 0x57, 0xAB, 0x59, 0x1E, 0x75, 0xA6, 0xAE, 0x4C, 0xCF, 0x1A, 0xDC, 0xAC,
+    0x8E, 0x5F, 0xFF, 0xD3, 0xC7, 0xAF, 0xFF, 0xE9, 0xE3, 0xD7, 0xFF, 0xED, 0x64, 0x90, 0x9E, 0x35,
+    0x98, 0x86, 0xFF, 0xBD, 0x89, 0xAE, 0x37, 0xEA, 0x4A, 0xA3, 0x9F, 0x6A, 0x4E, 0xAA, 0x66, 0x43,
+    0x35, 0xB5, 0x0C, 0xB5, 0x0C, 0xA8, 0x66, 0xFA, 0x03, 0x50, 0xE2, 0xE7, 0x8B, 0xEF, 0x54, 0x3C,
+    0x43, 0x52, 0x51, 0xF7, 0xA9, 0x74, 0xC7, 0x33, 0xCB, 0x8C, 0xB8, 0x65, 0x56, 0x24, 0x6F, 0x2F,
+    0xBC, 0x8C, 0x6C, 0xC1, 0x5A, 0x81, 0xB8, 0xE4, 0xD6, 0x8B, 0xBA, 0x62, 0x1D, 0x36, 0x61, 0xA3,
+    0xAE, 0x4A, 0x71, 0x25, 0xFD, 0x36, 0xDB, 0x1B, 0x6C, 0x6C, 0xB0, 0x9D, 0xD3, 0xEB, 0xF7, 0x9D,
+    0x92, 0x26, 0x08, 0x90, 0x22, 0x37, 0x45, 0x2A, 0x36, 0x89, 0x1C, 0xBA, 0x60, 0x1B, 0xD5, 0x92,
+    0x41, 0x8F, 0xB2, 0xAC, 0x43, 0x47, 0x6A, 0x03, 0xFC, 0xC4, 0xC3, 0x64, 0xC2, 0x7E, 0x9D, 0xDA,
+    0xCD, 0x75, 0xBA, 0xDD, 0xC4, 0x8E, 0x4B, 0xA4, 0x49, 0x6F, 0x34, 0xBB, 0xE9, 0xB5, 0x26, 0x7D,
+    0x9E, 0x6C, 0x93, 0x7E, 0xEF, 0xBC, 0xAD, 0x3D, 0x27, 0xE0, 0x2C, 0xF9, 0x18, 0xEF, 0xEF, 0xE9,
+    0x62, 0x73, 0x9B, 0x7F, 0xEF, 0xA2, 0x5F, 0xDA, 0xF4, 0x6A, 0x55, 0x66, 0xB2, 0x9B, 0x7D, 0xD8,
+    0x92, 0x56, 0x6C, 0xA0, 0xDA, 0xC7, 0x6A, 0xA4, 0x8D, 0xCE, 0x42, 0xC1, 0x43, 0xD0, 0xF2, 0x10,
+    0x17, 0x6F, 0x3D, 0x2F, 0x3E, 0x6A, 0xC3, 0xE9, 0x17, 0x58, 0x2C, 0x9E, 0x17, 0x0F, 0x7C, 0x63,
+    0xDA, 0x43, 0x2D, 0x57, 0xC5, 0xC3, 0x33, 0x3A, 0x6E, 0x37, 0x12, 0x7B, 0x59, 0x17, 0x4E, 0xE3,
+    0x74, 0x71, 0x39, 0xA9, 0x36, 0x54, 0x93, 0x71, 0x39, 0xAE, 0x50, 0x76, 0x1D, 0x97, 0x56, 0x1B,
+    0xCA, 0x6E, 0xC6, 0xCD, 0xA9, 0xB8, 0x39, 0xA5, 0xEC, 0x46, 0x52, 0x75, 0x99, 0x6A, 0xBE, 0xCE,
+    0xF1, 0x13, 0xBC, 0x2F, 0xCF, 0x75, 0xD9, 0x69, 0x4E, 0x6E, 0xF0, 0xB8, 0xE3, 0x7A, 0xA5, 0xFE,
+    0x94, 0x87, 0x1E, 0xE7, 0xF1, 0x96, 0xEB, 0x95, 0xFA, 0xB7, 0xAC, 0x7D, 0xA6, 0xE1, 0x24, 0x71,
+    0xF5, 0xDB, 0x37, 0xB6, 0xB7, 0x9F, 0x70, 0x89, 0xCD, 0xD8, 0x8E, 0x0E, 0x77, 0xA1, 0xF9, 0xEA,
+    0xD6, 0x5E, 0xCC, 0x36, 0x38, 0x12, 0x4B, 0x4E, 0xE4, 0xC8, 0x8A, 0xA8, 0x5B, 0x25, 0x88, 0x5C,
+    0x09, 0xD6, 0x99, 0x67, 0x29, 0x45, 0xED, 0xD7, 0x6B, 0x07, 0xF7, 0x2E, 0x23, 0x69, 0xE2, 0x4B,
+    0x2D, 0x49, 0x83, 0xAE, 0x98, 0x11, 0x7D, 0x78, 0xEB, 0xD2, 0xEB, 0xD2, 0xB3, 0xC5, 0xFF, 0x3F,
+    0x6D, 0x7E, 0x13, 0xD3, 0xE6, 0xD8, 0xCB, 0xB1, 0xF4, 0x0F, 0x28, 0xCB, 0x29, 0xE2, 0x37, 0x65,
+    0xD8, 0x89, 0xDF, 0xE6, 0x94, 0x53, 0x6F, 0x3F, 0x3B, 0x98, 0xBE, 0x39, 0x4B, 0xF4, 0x32, 0x66,
+    0x54, 0xCD, 0xA9, 0x93, 0x6C, 0x5C, 0xE6, 0xA6, 0xC8, 0xD5, 0x82, 0x53, 0xB0, 0x0D, 0xCB, 0xA8,
+    0xA8, 0x07, 0x4E, 0x14, 0xD1, 0xCB, 0x18, 0x51, 0x4D, 0x76, 0x92, 0x93, 0x97, 0x31, 0x16, 0x41,
+    0xFD, 0x67, 0x4E, 0x6E, 0x73, 0xF9, 0x95, 0xD4, 0xD6, 0x3D, 0x27, 0xF8, 0x32, 0x5F, 0x5F, 0xC7,
+    0xE9, 0xA7, 0x1A, 0xF5, 0x46, 0x15, 0x09, 0xEC, 0xC2, 0x40, 0xFC, 0x36, 0xE9, 0x73, 0x36, 0x8B,
+    0xDA, 0x0D, 0x5E, 0x01, 0x1E, 0x79, 0x29, 0x92, 0x01, 0xB6, 0xE1, 0x19, 0xF8, 0x60, 0x71, 0xF1,
+    0xAA, 0xC8, 0x06, 0x1B, 0x97, 0xA3, 0xB6, 0xCB, 0x90, 0x96, 0x87, 0x79, 0x1C, 0x5A, 0x54, 0xC5,
+    0x43, 0xF0, 0xF8, 0x37, 0x8A, 0x1B, 0x72, 0xA5, 0xD5, 0x61, 0x9A, 0xB7, 0x77, 0x4C, 0xF3, 0x8A,
+    0xDB, 0xEE, 0xE5, 0x42, 0x9B, 0xA9, 0x67, 0xDD, 0x43, 0x19, 0xFF, 0xD8, 0x21, 0x95, 0x7A, 0xBF,
+    0xD2, 0xBA, 0x78, 0x5C, 0xD3, 0x66, 0xAA, 0xCA, 0x81, 0xC7, 0x27, 0x92, 0xF5, 0xA7, 0x8F, 0x5F,
+    0xAF, 0x7E, 0xF7, 0x1B, 0xD1, 0xCB, 0xAA, 0x1E, 0xEA, 0x7E, 0x16, 0x79, 0x75, 0xCD, 0xEA, 0xE2,
+    0x4B, 0x1B, 0xB8, 0xE8, 0x7A, 0xA5, 0x39, 0xF9, 0xF8, 0x5D, 0x0F, 0x5A, 0x80, 0xDF, 0xFD, 0xB4,
+    0xEA, 0xFC, 0xEE, 0x37, 0x8A, 0xFF, 0x56, 0xDA, 0x19, 0xDD, 0x06, 0xDB, 0x1B, 0x6C, 0x3C, 0xCE,
+    0xC6, 0x06, 0x1B, 0x1B, 0x6C, 0x6C, 0xF2, 0x8C, 0x79, 0xC2, 0xFD, 0x37, 0xD2, 0x3C, 0x7E, 0x82,
+    0xC7, 0x39, 0xFC, 0x3B, 0xF6, 0x83, 0x4C, 0xAE, 0xA2, 0x2C, 0x3B, 0x24, 0xFB, 0x3C, 0xDA, 0xB2,
+    0x49, 0xF2, 0xF5, 0xE4, 0xAA, 0x34, 0x27, 0x48, 0x48, 0xC9, 0x7E, 0x50, 0x7B, 0xCD, 0x6D, 0xFF,
+    0xAA, 0x64, 0x98, 0x9C, 0x34, 0xF2, 0xB1, 0xA0, 0x94, 0x16, 0x53, 0xFD, 0xF0, 0xD0, 0xC0, 0xA6,
+    0x99, 0x10, 0x10, 0xCF, 0x62, 0x51, 0x62, 0x44, 0xAC, 0x7E, 0x6F, 0xD1, 0x29, 0xC7, 0x1C, 0x8F,
+    0xB6, 0x26, 0x78, 0xC1, 0x1A, 0xB9, 0xF5, 0x72, 0x2C, 0x22, 0x45, 0x54, 0x6E, 0x15, 0xF7, 0xD0,
+    0xF5, 0x8A, 0x04, 0x53, 0x54, 0x1E, 0x5E, 0x03, 0xF5, 0x6A, 0x0B, 0xCF, 0xAC, 0x43, 0xFA, 0xD3,
+    0x60, 0x33, 0x9C, 0x8A, 0xF8, 0x58, 0x5C, 0x59, 0x95, 0xFF, 0x3C, 0xAD, 0xF4, 0x8F, 0x9A, 0x2E,
+    0xF2, 0x9B, 0x1A, 0xF3, 0x94, 0x75, 0xCA, 0x6D, 0x9C, 0xC4, 0x24, 0xDF, 0x6E, 0x93, 0xF6, 0xF2,
+    0x26, 0x73, 0xFD, 0x94, 0x55, 0xAD, 0xDB, 0xC0, 0x64, 0x49, 0xA5, 0x3E, 0x68, 0x2F, 0x93, 0xFF,
+    0x6B, 0x5D, 0x44, 0x62, 0x1D, 0xDA, 0x6B, 0x30, 0x6F, 0xB6, 0x44, 0x22, 0x97, 0xAA, 0x54, 0xA4,
+    0xE7, 0x17, 0xB2, 0x8F, 0x56, 0x96, 0xC8, 0x3D, 0x03, 0x27, 0xD3, 0x03, 0x54, 0x61, 0x2C, 0x62,
+    0x91, 0x5E, 0xC9, 0x57, 0x07, 0x35, 0x10, 0x45, 0xFE, 0x48, 0x94, 0xC8, 0x55, 0xA0, 0x2D, 0xE5,
+    0x8E, 0x3D, 0xF9, 0x8E, 0x57, 0x3F, 0x1D, 0x0C, 0xF2, 0xD1, 0x69, 0x6B, 0x1A, 0xE5, 0x74, 0x33,
+    0x05, 0x71, 0xF1, 0xA4, 0x8D, 0x09, 0xB6, 0x24, 0x46, 0x39, 0x52, 0xE7, 0x61, 0x34, 0x90, 0xC9,
+    0x7F, 0xF8, 0x61, 0x24, 0xE2, 0x83, 0x39, 0xDC, 0x5A, 0x11, 0x82, 0x28, 0xD5, 0x22, 0x36, 0x17,
+    0x71, 0xE9, 0x27, 0x46, 0x38, 0xCC, 0x83, 0x4B, 0x40, 0x17, 0x8B, 0x8C, 0x21, 0xE4, 0xCB, 0x91,
+    0x3B, 0x1E, 0x19, 0x17, 0xA4, 0x22, 0x4D, 0x74, 0xE9, 0xD6, 0x8B, 0x1F, 0x7F, 0xC6, 0xD4, 0xA8,
+    0x7D, 0x62, 0x11, 0x17, 0x8D, 0x5F, 0xED, 0x19, 0x78, 0x80, 0xF9, 0xA4, 0x57, 0x3E, 0xEA, 0x85,
+    0x79, 0xAC, 0x5E, 0xFC, 0x40, 0x89, 0x08, 0xDF, 0x1C, 0x17, 0x15, 0xCB, 0xD0, 0xDC, 0x78, 0x52,
+    0xA7, 0xDA, 0x13, 0xE3, 0xD6, 0x99, 0x23, 0xED, 0x0F, 0xBF, 0x74, 0x5C, 0x2C, 0x2E, 0xCA, 0xA1,
+    0xA5, 0xC7, 0xC1, 0xD6, 0x4D, 0x4A, 0x04, 0x98, 0x00, 0xB2, 0x00, 0x8F, 0xB9, 0x7C, 0xD0, 0xD2,
+    0xAB, 0xBF, 0x92, 0xB1, 0x14, 0xAF, 0xC7, 0xAF, 0xCA, 0xFE, 0xB9, 0xDE, 0xD8, 0x58, 0x0A, 0xE5,
+    0x46, 0x54, 0x88, 0xB8, 0xAA, 0x1B, 0xF2, 0xD3, 0x16, 0x13, 0x8C, 0x13, 0x3C, 0x51, 0xE7, 0x49,
+    0x1D, 0xC9, 0x35, 0x87, 0xB1, 0x64, 0xA7, 0x6D, 0x24, 0xB0, 0x63, 0xD0, 0xE1, 0x52, 0xE9, 0x48,
+    0xAE, 0x39, 0xF5, 0xB6, 0x25, 0x3B, 0x6D, 0xB3, 0x50, 0xAA, 0xF7, 0x44, 0x9D, 0x4F, 0xAE, 0x38,
+    0x92, 0x6B, 0x6E, 0x5D, 0x5B, 0xB2, 0x82, 0xC0, 0xF7, 0x4F, 0x96, 0x2E, 0x1B, 0x93, 0x7D, 0x50,
+    0x20, 0xF5, 0x1D, 0x19, 0xDA, 0xB1, 0x8B, 0x69, 0x62, 0x87, 0x54, 0xA9, 0x55, 0x42, 0x8E, 0x5E,
+    0xB2, 0xCB, 0xA6, 0x8F, 0x1D, 0x1F, 0xBA, 0xD4, 0x7E, 0xF3, 0xA3, 0x5B, 0xF5, 0xFF, 0x2A, 0x22,
+    0xF2, 0xB7, 0xF5, 0xA5, 0x8B, 0xB7, 0x8A, 0x6E, 0x96, 0x58, 0xD5, 0xEE, 0x66, 0xD1, 0xA5, 0xF7,
+    0xC7, 0xF1, 0xA2, 0x88, 0xC8, 0x0B, 0xFB, 0xE7, 0xDE, 0x7F, 0x57, 0xB5, 0xFA, 0x7B, 0xE8, 0xCA,
+    0x6C, 0x33, 0x63, 0xEE, 0xE8, 0x11, 0xAB, 0xDA, 0x58, 0xD0, 0x55, 0xE2, 0x99, 0xA1, 0x1D, 0x3D,
+    0xB9, 0x2D, 0x6F, 0x15, 0xAB, 0x88, 0x68, 0x89, 0x88, 0x83, 0xAC, 0xC8, 0x5B, 0xD8, 0x21, 0xB3,
+    0x44, 0x1D, 0x06, 0x92, 0x86, 0x25, 0x64, 0x45, 0xDC, 0x9D, 0x64, 0x87, 0xB4, 0x79, 0x25, 0xEA,
+    0x30, 0xAA, 0x4D, 0x9A, 0xD8, 0x97, 0x92, 0x15, 0xE7, 0xDF, 0x90, 0xA1, 0x94, 0xE1, 0x8B, 0xC3,
+    0x7F, 0x27, 0xD2, 0xA8, 0x36, 0xB9, 0x75, 0x01, 0x5D, 0x65, 0x05, 0xCC, 0xD8, 0x01, 0xFA, 0xA8,
+    0x03, 0xD5, 0x26, 0x0D, 0x77, 0xC9, 0xEE, 0x92, 0x06, 0x52, 0xF9, 0x5E, 0xB1, 0x0A, 0x6D, 0x16,
+    0x15, 0x66, 0x2C, 0x00, 0x1D, 0x9C, 0x1D, 0x6E, 0x49, 0x0B, 0xF4, 0x51, 0x30, 0xB2, 0xC8, 0x0B,
+    0xD0, 0x55, 0xD2, 0x82, 0x6A, 0xF1, 0x89, 0x34, 0x3D, 0x26, 0x11, 0x3F, 0x23, 0x7B, 0xAE, 0xFF,
+    0xE7, 0xBA, 0x4A, 0xDF, 0xEC, 0x51, 0xAD, 0x72, 0x3B, 0xB0, 0x7F, 0xAE, 0xCF, 0x2A, 0x8C, 0xF4,
+    0xAA, 0x47, 0x4B, 0x47, 0xDD, 0xA8, 0xB6, 0x24, 0x1D, 0xE9, 0xB5, 0xA5, 0x74, 0xB3, 0xA8, 0x27,
+    0x12, 0x5D, 0x19, 0xD0, 0x57, 0xDA, 0xB4, 0x25, 0xEE, 0x7A, 0x3C, 0xEC, 0xCC, 0xC8, 0x0B, 0xF2,
+    0xD3, 0x55, 0xF2, 0xF3, 0x26, 0xBB, 0xD2, 0x32, 0xD4, 0xD2, 0xF4, 0x64, 0xDF, 0x0B, 0x30, 0xF3,
+    0x09, 0xD8, 0x21, 0xAB, 0xD4, 0xF5, 0x26, 0xF6, 0xCC, 0x66, 0xE4, 0x36, 0xB9, 0xE6, 0xD4, 0xC0,
+    0x76, 0xCE, 0xAC, 0x4D, 0x5F, 0x75, 0xC9, 0xFF, 0xC5, 0x6E, 0x56, 0xFC, 0xB1, 0xD3, 0x55, 0x97,
+    0x3E, 0x4F, 0xAF, 0xAB, 0xAE, 0xD3, 0x85, 0xD7, 0xA7, 0x9F, 0x70, 0xE9, 0xAB, 0xDD, 0x2B, 0x79,
+    0x70, 0xB9, 0xAA, 0x45, 0x44, 0xDC, 0xE6, 0xBA, 0xBA, 0xD2, 0xAA, 0xEB, 0xCD, 0xE6, 0x26, 0xB3,
+    0xCD, 0xF8, 0x9A, 0x8D, 0x6F, 0xDA, 0xF5, 0x6D, 0xB2, 0xED, 0xE8, 0x97, 0x96, 0x5F, 0x56, 0xFA,
+    0x15, 0x74, 0xCF, 0x47, 0x15, 0x52, 0xE8, 0x8E, 0xD4, 0x51, 0x43, 0x4D, 0xE2, 0x48, 0x1C, 0x25,
+    0x46, 0x7E, 0x46, 0x7C, 0x5D, 0xC4, 0x63, 0xCC, 0xE2, 0x92, 0x53, 0x37, 0x5B, 0xF2, 0xCA, 0xCC,
+    0xC0, 0xAB, 0x9B, 0x2D, 0x49, 0x63, 0x66, 0xF1, 0x85, 0x99, 0xBA, 0xD9, 0xCE, 0x54, 0x6B, 0x66,
+    0xAA, 0xFD, 0x3B, 0x1E, 0xA2, 0xAE, 0xB7, 0x33, 0xD8, 0x99, 0xA9, 0x96, 0xEC, 0x4A, 0x3B, 0xDB,
+    0x3A, 0xD7, 0xCD, 0x94, 0xC8, 0xA0, 0x5A, 0x33, 0xC5, 0xFC, 0x38, 0x08, 0x9C, 0x94, 0x55, 0x44,
+    0x5B, 0xE7, 0x7F, 0x4C, 0x22, 0xE2, 0x43, 0x72, 0x78, 0x21, 0x1F, 0xB2, 0x2A, 0x12, 0x79, 0xBE,
+    0x4A, 0x86, 0x73, 0x52, 0xE9, 0x16, 0xA9, 0x32, 0x8B, 0xA9, 0x4C, 0x41, 0x5E, 0x19, 0xC8, 0x6E,
+    0x4F, 0xF4, 0xD1, 0xD3, 0x82, 0xBC, 0xCA, 0x2B, 0x4C, 0xA5, 0x1B, 0xEA, 0x2A, 0xED, 0x8F, 0x49,
+    0x15, 0x8B, 0x5C, 0xAD, 0x28, 0x47, 0x5D, 0xDD, 0x01, 0xD5, 0x2A, 0x11, 0x71, 0x6A, 0x72, 0xA9,
+    0x3B, 0xD4, 0x52, 0x8E, 0x90, 0x8B, 0x14, 0xB1, 0xFC, 0x85, 0x27, 0x6F, 0x38, 0x73, 0xBB, 0x39,
+    0x6C, 0xD4, 0x4F, 0x67, 0x4A, 0x44, 0x2A, 0x3D, 0xF9, 0xE8, 0x05, 0xAA, 0x12, 0x95, 0x5B, 0x67,
+    0xD1, 0x22, 0x3D, 0x46, 0xA4, 0x09, 0x7E, 0xB1, 0xC1, 0x05, 0xB9, 0x58, 0x19, 0xE0, 0x06, 0x63,
+    0x9A, 0x17, 0xCE, 0x83, 0x88, 0x87, 0x52, 0x1A, 0x58, 0x2B, 0x88, 0x1C, 0x71, 0x17, 0x3B, 0xD2,
+    0x36, 0x76, 0x64, 0x36, 0x76, 0x18, 0x62, 0x87, 0x27, 0x76, 0xAA, 0x0B, 0x11, 0x3A, 0x63, 0x97,
+    0x59, 0x62, 0x67, 0x20, 0x76, 0x1E, 0xBE, 0xF8, 0xCB, 0xFD, 0xAD, 0xA2, 0x16, 0x11, 0x5B, 0x8A,
+    0x88, 0x8D, 0xC7, 0x39, 0xC4, 0xBD, 0x29, 0x88, 0x9D, 0xB6, 0xC4, 0x2E, 0x69, 0x89, 0x5D, 0xDC,
+    0xAD, 0x9E, 0x42, 0x49, 0xEC, 0xC8, 0xAB, 0xD8, 0xA1, 0x9B, 0xD8, 0x91, 0xB8, 0xD8, 0x11, 0xF7,
+    0xA5, 0x88, 0x7C, 0x28, 0x22, 0xF2, 0x57, 0x21, 0x86, 0xE3, 0x1D, 0x01, 0xBF, 0x5E, 0x6D, 0xC1,
+    0xE4, 0x16, 0xA4, 0x27, 0x84, 0x2F, 0xCE, 0x57, 0x71, 0xC3, 0x6A, 0x7F, 0x12, 0x7D, 0xFD, 0xA6,
+    0xE7, 0x4B, 0x5A, 0x8A, 0x60, 0x48, 0x18, 0x8F, 0x53, 0xE0, 0xA0, 0x54, 0x6C, 0x58, 0x32, 0xA2,
+    0xE6, 0x2E, 0xAE, 0xD8, 0x2B, 0xC0, 0x7E, 0x2C, 0x00, 0xCC, 0xD4, 0xFD, 0xF9, 0xF7, 0xCF, 0x0F,
+    0x93, 0x78, 0x5F, 0x17, 0x61, 0xAE, 0x04, 0x8D, 0x4B, 0x5E, 0x84, 0xE0, 0x06, 0x66, 0xE5, 0x4F,
+    0x3A, 0xC1, 0x27, 0xB3, 0xC9, 0xE4, 0x6D, 0x67, 0x0A, 0xCA, 0xB5, 0x9C, 0xF6, 0xFE, 0x60, 0x1F,
+    0xAE, 0xF7, 0xA8, 0x2E, 0x96, 0x2A, 0xEA, 0x50, 0x2E, 0x13, 0x17, 0x3B, 0x92, 0xD6, 0xFC, 0xBB,
+    0x5E, 0x39, 0x74, 0xB3, 0xC4, 0x2B, 0x47, 0x6E, 0x3D, 0x3E, 0x69, 0x29, 0x9F, 0xE8, 0xF1, 0x69,
+    0x13, 0x8D, 0x71, 0x87, 0x4F, 0x6D, 0xD6, 0x2B, 0x17, 0xF7, 0xFA, 0x3D, 0x69, 0x54, 0x9F, 0x3A,
+    0x2D, 0x23, 0x4A, 0xA4, 0xC9, 0xE4, 0x02, 0xC9, 0x8D, 0x10, 0xCD, 0x25, 0xB5, 0x67, 0x6E, 0x53,
+    0x45, 0x1D, 0xEC, 0xAB, 0x03, 0xD8, 0xFD, 0x36, 0x75, 0x94, 0x39, 0xF4, 0xA5, 0x38, 0x98, 0x6D,
+    0x93, 0xB3, 0x49, 0xFA, 0xD7, 0x1E, 0xBC, 0xB6, 0xE8, 0x6A, 0x17, 0xFA, 0xD4, 0x06, 0x83, 0x6F,
+    0xAF, 0x2D, 0xA9, 0xED, 0x61, 0x27, 0x03, 0xF5, 0x37, 0x0E, 0xCC, 0xE6, 0x14, 0x98, 0x49, 0x77,
+    0xC1, 0x4E, 0xF9, 0x78, 0xDA, 0x92, 0x22, 0xD0, 0xE5, 0x3D, 0xF9, 0xEB, 0x6F, 0x5B, 0x35, 0xFA,
+    0x25, 0x4B, 0x51, 0xAD, 0x3E, 0xDD, 0x1A, 0xE5, 0x36, 0xA2, 0x6E, 0x27, 0x2E, 0x74, 0xB5, 0xB2,
+    0xEB, 0xB6, 0x2B, 0x0B, 0xAC, 0xC9, 0x96, 0xF2, 0x0B, 0xE7, 0xAB, 0x60, 0xF3, 0xA5, 0x7B, 0x62,
+    0xD9, 0x07, 0x2D, 0x52, 0x61, 0x2E, 0x8A, 0xC5, 0x53, 0x56, 0xCA, 0x51, 0xC6, 0x61, 0xD9, 0x58,
+    0x5C, 0x1C, 0x2B, 0x4F, 0xD2, 0x2A, 0x47, 0x56, 0x3D, 0xFD, 0xD6, 0xD6, 0xDE, 0x1F, 0x8A, 0x88,
+    0xFC, 0xC5, 0xB8, 0xB8, 0xF4, 0x33, 0xE5, 0x18, 0xD1, 0xAF, 0x9E, 0x77, 0x98, 0xE0, 0x61, 0x74,
+    0xE1, 0x53, 0xC3, 0xE4, 0xAD, 0x90, 0xB5, 0x68, 0xB5, 0xAC, 0x45, 0xB5, 0x5C, 0x20, 0x13, 0x19,
+    0x10, 0x79, 0xDF, 0xAB, 0x31, 0xAD, 0xBE, 0xAC, 0xBB, 0xB4, 0x22, 0xB3, 0x69, 0x85, 0xA9, 0xD2,
+    0x8A, 0x92, 0xB4, 0x62, 0x8F, 0xB4, 0x62, 0x38, 0x48, 0x3C, 0xE9, 0x7B, 0x2F, 0x7B, 0xD2, 0xC0,
+    0x98, 0xC8, 0x40, 0x5A, 0x95, 0x7B, 0xA4, 0x95, 0x29, 0x49, 0x2B, 0x63, 0x8A, 0xB4, 0x32, 0xB9,
+    0x4D, 0x2B, 0xA3, 0xDB, 0xB4, 0x32, 0x89, 0x4F, 0x2B, 0x13, 0xCB, 0xFB, 0xDF, 0x15, 0x4A, 0x11,
+    0x21, 0x11, 0x79, 0x07, 0xD2, 0x0B, 0xAB, 0x85, 0xF5, 0x58, 0xB1, 0x0A, 0x89, 0x60, 0x2C, 0x90,
+    0x75, 0x2B, 0x4B, 0x35, 0xF5, 0x91, 0x85, 0x68, 0xBF, 0x07, 0x76, 0x83, 0x3D, 0x75, 0x13, 0xB4,
+    0x33, 0xF9, 0x41, 0x48, 0x45, 0x17, 0xF7, 0x91, 0x07, 0x1F, 0x34, 0xCE, 0x69, 0x93, 0xCA, 0x2A,
+    0xE2, 0xA2, 0x4F, 0x1C, 0x69, 0x1B, 0x77, 0xE0, 0x83, 0xA6, 0x69, 0x0E, 0x69, 0x6B, 0x8A, 0x30,
+    0xBC, 0xC1, 0x61, 0x39, 0xB9, 0xDE, 0x1D, 0xF4, 0xC8, 0x31, 0xD9, 0x47, 0x89, 0x78, 0xCC, 0x7B,
+    0xB5, 0x8B, 0x0B, 0xCA, 0x62, 0x32, 0xE5, 0xCE, 0xAA, 0x89, 0xFE, 0xE4, 0x7F, 0xB8, 0x5A, 0x16,
+    0x1C, 0xC7, 0xA4, 0xE2, 0x98, 0x54, 0x24, 0x52, 0xF1, 0x55, 0x79, 0x61, 0xEB, 0x9C, 0x88, 0x48,
+    0xF9, 0xDE, 0x62, 0xF1, 0x97, 0xB7, 0x15, 0xC9, 0x6C, 0x00, 0xBE, 0x1E, 0x4E, 0xC6, 0xAD, 0x4B,
+    0x55, 0x2E, 0xD2, 0x73, 0x5E, 0xF6, 0x61, 0xAD, 0x58, 0xD1, 0xE5, 0x0D, 0x20, 0x97, 0x77, 0x48,
+    0x45, 0x7C, 0x24, 0x37, 0x2E, 0x35, 0xBA, 0xDB, 0x38, 0x86, 0xE0, 0x48, 0x9D, 0xB2, 0x98, 0x42,
+    0x13, 0x79, 0x36, 0x48, 0x5B, 0x1C, 0xA6, 0x50, 0x96, 0x01, 0x8D, 0x72, 0x6C, 0xA0, 0xED, 0xD1,
+    0xAC, 0xB8, 0x67, 0x83, 0xC4, 0xE1, 0xD0, 0x8D, 0xB2, 0x18, 0xAB, 0xA1, 0xAC, 0x36, 0xA0, 0xAE,
+    0x1C, 0xD4, 0xEF, 0xFF, 0x47, 0x17, 0x3C, 0xFB, 0x72, 0x19, 0x27, 0x93, 0x40, 0x65, 0x27, 0xC0,
+    0xF2, 0x87, 0x38, 0x70, 0x38, 0x70, 0x91, 0x23, 0x72, 0xB1, 0x23, 0x95, 0x10, 0x25, 0x52, 0xFC,
+    0xEF, 0xEC, 0x7F, 0xF3, 0xC3, 0xB3, 0xCA, 0xA9, 0x29, 0xA0, 0xF4, 0x67, 0x4C, 0xE2, 0x0E, 0xE5,
+    0xA2, 0x61, 0x4D, 0x39, 0x64, 0x54, 0x0E, 0x33, 0x72, 0x54, 0x77, 0x77, 0x4C, 0xF6, 0x83, 0xC7,
+    0x21, 0xE8, 0xFD, 0x73, 0x3D, 0x94, 0x50, 0x4C, 0xA4, 0x26, 0x7C, 0xD7, 0xE6, 0x10, 0x0E, 0x0E,
+    0x11, 0x62, 0xD5, 0x10, 0x62, 0x2F, 0x15, 0x40, 0x22, 0x2D, 0x2B, 0xE3, 0xF7, 0x29, 0xDE, 0x45,
+    0xF0, 0x79, 0x57, 0xDD, 0xEF, 0x3D, 0x58, 0xBD, 0x94, 0x5C, 0x1F, 0xE4, 0x6D, 0xAF, 0xFF, 0x87,
+    0x1D, 0xDD, 0xB8, 0xD9, 0x7F, 0xED, 0x4E, 0xC6, 0x6F, 0x76, 0xFF, 0x47, 0xF5, 0xAD, 0xF4, 0xB4,
+    0xAD, 0x9F, 0x68, 0xD6, 0x07, 0x6A, 0x79, 0x4F, 0x1A, 0xDE, 0x17, 0xE9, 0x50, 0xD5, 0x1F, 0x9F,
+    0x2B, 0x78, 0x28, 0x6A, 0x4E, 0xC1, 0x97, 0xE3, 0xE2, 0x5F, 0x50, 0x8A, 0xC8, 0x4F, 0x45, 0x64,
+    0x2C, 0x27, 0xE7, 0xCE, 0x50, 0xDD, 0xC5, 0x62, 0xF1, 0xF2, 0xC1, 0xA5, 0x69, 0x88, 0x0F, 0xC6,
+    0xFA, 0xEF, 0x7A, 0x50, 0x86, 0xD5, 0xE0, 0xCD, 0xF3, 0xFB, 0x5B, 0xC1, 0xF5, 0xB1, 0x05, 0x6D,
+    0x13, 0x11, 0x79, 0x7A, 0x0A, 0x0F, 0x4C, 0x66, 0x89, 0x06, 0x8E, 0xD5, 0x2D, 0xE5, 0x00, 0x43,
+    0x98, 0x99, 0x2B, 0xBF, 0x73, 0xDD, 0x84, 0xCE, 0x5A, 0xB9, 0xD3, 0x97, 0x41, 0xF4, 0x88, 0x7C,
+    0x20, 0x39, 0x47, 0xBF, 0xFF, 0x7F, 0x05, 0xFE, 0xBC, 0x0B, 0x0E, 0x89, 0xF9, 0x08, 0x5A, 0x0A,
+    0x98, 0xFB, 0xD8, 0xF1, 0xD4, 0x07, 0x62, 0xD1, 0xF2, 0x0E, 0x91, 0xBC, 0x03, 0xA5, 0x27, 0xFE,
+    0xCB, 0x9F, 0x3A, 0xB4, 0xD5, 0x36, 0x78, 0xCA, 0x7B, 0x26, 0x22, 0x64, 0xD0, 0x36, 0xF2, 0x18,
+    0x74, 0x83, 0x8F, 0x46, 0xD4, 0x87, 0x75, 0x1B, 0x62, 0x8B, 0x1B, 0xB9, 0x5D, 0x27, 0x5B, 0x56,
+    0xC1, 0x30, 0x31, 0xD8, 0x49, 0xF5, 0x00, 0xCF, 0x24, 0x16, 0x48, 0x83, 0x07, 0xCF, 0x8E, 0x6A,
+    0x00, 0x35, 0xD6, 0x8B, 0xC5, 0x4B, 0x68, 0x11, 0x91, 0x9E, 0x47, 0x45, 0x44, 0x1C, 0xAA, 0x81,
+    0xAC, 0x62, 0x13, 0xD8, 0x5E, 0x29, 0x77, 0x36, 0x1F, 0x8C, 0x8B, 0x53, 0xA8, 0x6B, 0xDD, 0x32,
+    0x6E, 0x98, 0x89, 0x74, 0x1B, 0xA8, 0x31, 0xFF, 0xAB, 0x1B, 0x16, 0x53, 0xFD, 0x50, 0xBB, 0xE0,
+    0x11, 0x31, 0x59, 0xB7, 0xB2, 0x1D, 0x66, 0xCC, 0xE4, 0x0C, 0x9C, 0xBF, 0xFB, 0xD5, 0x02, 0xA8,
+    0xA5, 0x9B, 0xFC, 0x3F, 0x0F, 0x02, 0x79, 0x05, 0xBC, 0x57, 0xB9, 0x4F, 0x4F, 0xBF, 0x79, 0xAB,
+    0x80, 0x4C, 0x82, 0xAB, 0x91, 0x48, 0xA5, 0x46, 0xE5, 0xCA, 0x36, 0x75, 0xCA, 0xA5, 0x2E, 0xC4,
+    0x3A, 0xCF, 0xAC, 0x72, 0xF8, 0xBC, 0x50, 0x2E, 0x44, 0xED, 0x65, 0x7E, 0x24, 0x35, 0x86, 0xF8,
+    0xC2, 0x64, 0xD4, 0x7D, 0xCF, 0x34, 0x96, 0xF1, 0x02, 0x5A, 0xA4, 0xC3, 0xBC, 0x27, 0x3D, 0x1E,
+    0xED, 0x94, 0x0B, 0xB1, 0xD7, 0x33, 0x6B, 0xA6, 0xC8, 0x86, 0x5E, 0x39, 0x94, 0xD3, 0x96, 0xBC,
+    0x32, 0x44, 0x03, 0xC3, 0x13, 0x75, 0x5B, 0x8B, 0x8C, 0xB1, 0x88, 0x54, 0x51, 0xF9, 0x42, 0x71,
+    0x34, 0xEE, 0xCA, 0xAD, 0x1F, 0x84, 0xE8, 0xEC, 0x27, 0xC6, 0xAD, 0xE2, 0xAE, 0x2B, 0x41, 0x74,
+    0xE1, 0xEB, 0xC0, 0x7A, 0x5A, 0x40, 0xFC, 0x61, 0x07, 0xD4, 0xD2, 0x42, 0x2D, 0xD2, 0x60, 0xC6,
+    0x54, 0xAA, 0xF4, 0xE7, 0xED, 0xE5, 0x21, 0xF2, 0xEB, 0xE9, 0x53, 0xCE, 0x3C, 0xD9, 0x5E, 0xCE,
+    0x9F, 0x73, 0xEB, 0x69, 0xE1, 0xE7, 0x71, 0x7B, 0x59, 0xFF, 0xA4, 0x59, 0x4F, 0x8B, 0xE5, 0x10,
+    0xB7, 0x97, 0xD3, 0x1B, 0xCD, 0x7A, 0x5A, 0xCC, 0x07, 0x8A, 0x33, 0xD1, 0xB9, 0x66, 0xE5, 0xC9,
+    0x31, 0x45, 0x30, 0x33, 0x87, 0x5E, 0xE7, 0xC1, 0xD5, 0x3C, 0x04, 0x7C, 0x1E, 0x01, 0x7E, 0x47,
+    0x16, 0x8B, 0x17, 0xB5, 0x4C, 0xD2, 0x62, 0xE0, 0x49, 0xD2, 0xA7, 0x2C, 0xA7, 0x34, 0x5C, 0xDE,
+    0xA0, 0x16, 0xA7, 0x44, 0xBC, 0x16, 0xF1, 0x86, 0xA4, 0xF7, 0x24, 0x37, 0x1D, 0xFA, 0x6A, 0x88,
+    0x98, 0xEF, 0x3D, 0xC9, 0x75, 0x47, 0xA9, 0x6F, 0x5D, 0xEA, 0x8C, 0x8C, 0x88, 0xC8, 0x73, 0x8E,
+    0xF2, 0xAA, 0xC5, 0x94, 0xB0, 0xE7, 0x89, 0xC4, 0x91, 0x88, 0x25, 0x17, 0x18, 0x3D, 0xE9, 0xCD,
+    0x5B, 0x0B, 0x79, 0x5E, 0xA4, 0x33, 0x32, 0x12, 0x37, 0xEE, 0xE0, 0x45, 0xC7, 0x8F, 0xAF, 0xBC,
+    0xC8, 0x22, 0x91, 0xA6, 0x7C, 0x77, 0x57, 0xB7, 0xC4, 0xFD, 0x81, 0x05, 0xC2, 0xE4, 0x02, 0x3C,
+    0xED, 0xA6, 0xCC, 0xBC, 0x22, 0x1A, 0x20, 0xDD, 0x3F, 0xD6, 0xE4, 0x32, 0x50, 0x4A, 0x15, 0xC8,
+    0x79, 0xB4, 0xB5, 0x75, 0xD6, 0x88, 0x5C, 0x17, 0x19, 0xCA, 0xF0, 0x01, 0xCB, 0x9B, 0x5B, 0x5B,
+    0x5B, 0x67, 0x88, 0xB6, 0x88, 0xCE, 0x92, 0x48, 0x9B, 0x8A, 0x55, 0xD2, 0xA5, 0xE2, 0x54, 0x4F,
+    0xD2, 0xAD, 0x38, 0xA6, 0x39, 0x84, 0x80, 0xF3, 0xC1, 0x41, 0x4B, 0x5B, 0x1E, 0x15, 0x9F, 0x49,
+    0x97, 0x8B, 0x18, 0x19, 0xA3, 0xF3, 0x2F, 0xFC, 0x7E, 0xB9, 0x35, 0x5D, 0x88, 0xFA, 0x55, 0xB5,
+    0xEE, 0x28, 0xF1, 0x2B, 0x5E, 0x20, 0xDA, 0x82, 0x48, 0xFA, 0x2F, 0x63, 0xE4, 0x74, 0xA3, 0x5B,
+    0x06, 0x3C, 0xA9, 0xBD, 0x8D, 0x64, 0x3D, 0x2A, 0x3E, 0x7D, 0x43, 0xC4, 0xEE, 0x7E, 0x71, 0xFF,
+    0x6C, 0x6A, 0xB3, 0x8A, 0xDD, 0xA8, 0xE7, 0x57, 0x39, 0x20, 0xDA, 0x8A, 0x8A, 0x48, 0xFA, 0x5D,
+    0x8C, 0xFC, 0xA1, 0xD5, 0x2D, 0xBB, 0xAB, 0x97, 0x1E, 0xDE, 0xF3, 0xEB, 0x78, 0x29, 0xD1, 0x59,
+    0xC2, 0x68, 0xBC, 0x5A, 0x29, 0xE9, 0x52, 0xF9, 0xC0, 0x87, 0xF1, 0x28, 0xC3, 0x80, 0xE8, 0x6A,
+    0xEA, 0x94, 0xD0, 0x5D, 0x53, 0x7F, 0x4D, 0x83, 0xA2, 0x2F, 0x89, 0x18, 0x19, 0xD5, 0x5F, 0x87,
+    0x61, 0xE9, 0xC3, 0xC5, 0x59, 0xE8, 0xCD, 0xA9, 0xA4, 0x6A, 0x43, 0xC9, 0xCF, 0xFD, 0x62, 0xA8,
+    0xFC, 0x5A, 0xA8, 0xFC, 0x95, 0x36, 0xCC, 0xA5, 0x3E, 0x54, 0x7E, 0x76, 0x5B, 0xE5, 0xEF, 0x7C,
+    0xD0, 0xDF, 0x87, 0xCA, 0x9F, 0x38, 0x33, 0x45, 0x83, 0x4C, 0x45, 0x1A, 0xB2, 0xE6, 0x51, 0x87,
+    0x29, 0xE2, 0x0E, 0xC3, 0x1D, 0xC9, 0xA3, 0x32, 0x18, 0x8C, 0x8C, 0x86, 0x2F, 0xEE, 0x9F, 0xFD,
+    0xD8, 0xD5, 0xFB, 0x48, 0xA2, 0x0E, 0x13, 0x82, 0x3A, 0x30, 0x62, 0xA0, 0x1E, 0xCD, 0x14, 0x25,
+    0x9B, 0x33, 0x04, 0xDF, 0xFA, 0x15, 0x03, 0x41, 0x2D, 0x41, 0x41, 0x1C, 0x9C, 0x37, 0x0B, 0x1D,
+    0xB8, 0x75, 0x13, 0xFC, 0xDF, 0x3D, 0x90, 0x34, 0xCA, 0x11, 0x89, 0x54, 0xA5, 0x38, 0x23, 0x92,
+    0x8A, 0x5C, 0x19, 0xD6, 0xBA, 0xB5, 0x61, 0x6B, 0x82, 0xB5, 0xE6, 0x81, 0xB0, 0x06, 0x70, 0x52,
+    0x0D, 0x80, 0x47, 0x49, 0x81, 0x72, 0xC4, 0x12, 0xA6, 0x4E, 0xDD, 0x07, 0x57, 0xAF, 0x3E, 0x3C,
+    0xD0, 0x29, 0x07, 0xC1, 0xCF, 0x6E, 0x8A, 0xFF, 0x05, 0x4B, 0x06, 0xB2, 0xE2, 0x51, 0x17, 0x0F,
+    0x0F, 0x94, 0x22, 0x28, 0xE9, 0x6A, 0x69, 0x89, 0xC5, 0x46, 0x67, 0x8E, 0xB8, 0x04, 0x03, 0xF0,
+    0xDB, 0xD3, 0x7E, 0xF2, 0x84, 0xD4, 0xD3, 0x7E, 0xF2, 0x8C, 0xD4, 0xD3, 0x7E, 0x8A, 0x3D, 0xA3,
+    0xDF, 0x39, 0x36, 0x4C, 0x7A, 0xD0, 0x61, 0x0A, 0x06, 0x32, 0x00, 0xF2, 0xEA, 0x0F, 0xD4, 0x00,
+    0x5A, 0xEA, 0x2E, 0x1D, 0x40, 0x44, 0xDA, 0x7C, 0x08, 0x51, 0x2C, 0x64, 0x40, 0x44, 0x5C, 0x22,
+    0x83, 0x16, 0x11, 0x4A, 0x19, 0x8C, 0x88, 0x4B, 0x42, 0x2C, 0x82, 0xAA, 0x16, 0x29, 0x8C, 0x0C,
+    0x4A, 0xA4, 0xC3, 0x84, 0x40, 0x33, 0x98, 0xF0, 0xDF, 0x28, 0x84, 0x7D, 0x01, 0x46, 0xCE, 0x49,
+    0x07, 0x18, 0xA7, 0x27, 0xCF, 0xC5, 0xE0, 0xCC, 0x66, 0x08, 0xAB, 0xAF, 0x39, 0x17, 0xC0, 0xBE,
+    0x15, 0xD3, 0x30, 0xD9, 0x2F, 0xAF, 0xFE, 0x37, 0x00, 0xFE, 0xD1, 0x91, 0xC6, 0xFE, 0x3F,
 };
 
 static const EpdGlyph notosans_16_regularGlyphs[] = {
@@ -2101,7 +2105,7 @@ static const EpdGlyph notosans_16_regularGlyphs[] = {
     { 4, 35, 18, 7, 26, 35, 8187 }, // |
     { 11, 30, 13, 1, 24, 83, 8222 }, // }
     { 17, 5, 19, 1, 14, 22, 8305 }, // ~
-    { 0, 0, 9, 0, 0, 0, 0 }, //  
+    { 0, 0, 9, 0, 0, 0, 8327 }, //  
     { 5, 26, 9, 2, 19, 33, 0 }, // ¡
     { 14, 26, 19, 3, 25, 91, 33 }, // ¢
     { 17, 25, 19, 1, 25, 107, 124 }, // £
@@ -2112,775 +2116,782 @@ static const EpdGlyph notosans_16_regularGlyphs[] = {
     { 11, 4, 19, 4, 25, 11, 543 }, // ¨
     { 26, 26, 28, 1, 25, 169, 554 }, // ©
     { 10, 13, 12, 1, 25, 33, 723 }, // ª
-    { 15, 15, 17, 1, 16, 57, 756 }, // «
-    { 17, 9, 19, 1, 13, 39, 813 }, // ¬
-    { 9, 4, 11, 1, 11, 9, 852 }, // ­
-    { 26, 26, 28, 1, 25, 169, 861 }, // ®
-    { 18, 3, 17, -1, 28, 14, 1030 }, // ¯
-    { 12, 12, 14, 1, 25, 36, 1044 }, // °
-    { 17, 20, 19, 1, 20, 85, 1080 }, // ±
-    { 11, 16, 12, 0, 29, 44, 1165 }, // ²
-    { 11, 16, 12, 0, 29, 44, 1209 }, // ³
-    { 8, 6, 9, 1, 26, 12, 1253 }, // ´
-    { 16, 26, 21, 2, 18, 104, 1265 }, // µ
-    { 18, 31, 22, 1, 26, 140, 1369 }, // ¶
-    { 5, 6, 9, 2, 15, 8, 1509 }, // ·
-    { 8, 8, 8, 0, 0, 16, 1517 }, // ¸
-    { 7, 16, 12, 1, 29, 28, 1533 }, // ¹
-    { 11, 13, 13, 1, 25, 36, 1561 }, // º
-    { 15, 15, 17, 1, 16, 57, 1597 }, // »
-    { 24, 24, 25, 1, 24, 144, 1654 }, // ¼
-    { 25, 24, 26, 0, 24, 150, 1798 }, // ½
-    { 26, 25, 26, 0, 25, 163, 1948 }, // ¾
-    { 14, 26, 14, 0, 19, 91, 2111 }, // ¿
-    { 22, 32, 21, 0, 32, 176, 2202 }, // À
-    { 22, 32, 21, 0, 32, 176, 2378 }, // Á
-    { 22, 32, 21, 0, 32, 176, 2554 }, // Â
-    { 22, 31, 21, 0, 31, 171, 2730 }, // Ã
-    { 22, 31, 21, 0, 31, 171, 2901 }, // Ä
-    { 22, 30, 21, 0, 30, 165, 3072 }, // Å
-    { 29, 24, 29, -1, 24, 174, 3237 }, // Æ
-    { 19, 33, 21, 2, 25, 157, 3411 }, // Ç
-    { 14, 32, 19, 3, 32, 112, 3568 }, // È
-    { 14, 32, 19, 3, 32, 112, 3680 }, // É
-    { 14, 32, 19, 3, 32, 112, 3792 }, // Ê
-    { 14, 31, 19, 3, 31, 109, 3904 }, // Ë
-    { 9, 32, 11, 1, 32, 72, 4013 }, // Ì
-    { 10, 32, 11, 1, 32, 80, 4085 }, // Í
-    { 12, 32, 11, 0, 32, 96, 4165 }, // Î
-    { 10, 31, 11, 1, 31, 78, 4261 }, // Ï
-    { 22, 24, 24, 1, 24, 132, 4339 }, // Ð
-    { 20, 31, 25, 3, 31, 155, 4471 }, // Ñ
-    { 22, 33, 26, 2, 32, 182, 4626 }, // Ò
-    { 22, 33, 26, 2, 32, 182, 4808 }, // Ó
-    { 22, 33, 26, 2, 32, 182, 4990 }, // Ô
-    { 22, 32, 26, 2, 31, 176, 5172 }, // Õ
-    { 22, 32, 26, 2, 31, 176, 5348 }, // Ö
-    { 15, 16, 19, 2, 20, 60, 5524 }, // ×
-    { 22, 27, 26, 2, 25, 149, 5584 }, // Ø
-    { 19, 33, 24, 3, 32, 157, 5733 }, // Ù
-    { 19, 33, 24, 3, 32, 157, 5890 }, // Ú
-    { 19, 33, 24, 3, 32, 157, 6047 }, // Û
-    { 19, 32, 24, 3, 31, 152, 6204 }, // Ü
-    { 19, 32, 19, 0, 32, 152, 6356 }, // Ý
-    { 16, 24, 20, 3, 24, 96, 6508 }, // Þ
-    { 18, 27, 21, 2, 26, 122, 6604 }, // ß
-    { 15, 27, 19, 1, 26, 102, 6726 }, // à
-    { 15, 27, 19, 1, 26, 102, 6828 }, // á
-    { 15, 27, 19, 1, 26, 102, 6930 }, // â
-    { 15, 26, 19, 1, 25, 98, 7032 }, // ã
-    { 15, 26, 19, 1, 25, 98, 7130 }, // ä
-    { 15, 29, 19, 1, 28, 109, 7228 }, // å
-    { 27, 20, 29, 1, 19, 135, 7337 }, // æ
-    { 14, 27, 16, 1, 19, 95, 7472 }, // ç
-    { 17, 27, 19, 1, 26, 115, 7567 }, // è
-    { 17, 27, 19, 1, 26, 115, 7682 }, // é
-    { 17, 27, 19, 1, 26, 115, 7797 }, // ê
-    { 17, 26, 19, 1, 25, 111, 7912 }, // ë
-    { 8, 26, 9, -1, 26, 52, 8023 }, // ì
-    { 8, 26, 9, 2, 26, 52, 8075 }, // í
-    { 12, 26, 9, -2, 26, 78, 8127 }, // î
-    { 10, 25, 9, -1, 25, 63, 8205 }, // ï
-    { 18, 27, 20, 1, 26, 122, 8268 }, // ð
-    { 16, 25, 21, 2, 25, 100, 8390 }, // ñ
-    { 18, 27, 20, 1, 26, 122, 8490 }, // ò
-    { 18, 27, 20, 1, 26, 122, 8612 }, // ó
-    { 18, 27, 20, 1, 26, 122, 8734 }, // ô
-    { 18, 26, 20, 1, 25, 117, 8856 }, // õ
-    { 18, 26, 20, 1, 25, 117, 8973 }, // ö
-    { 17, 16, 19, 1, 20, 68, 9090 }, // ÷
-    { 18, 21, 20, 1, 19, 95, 9158 }, // ø
-    { 16, 27, 21, 2, 26, 108, 9253 }, // ù
-    { 16, 27, 21, 2, 26, 108, 9361 }, // ú
-    { 16, 27, 21, 2, 26, 108, 9469 }, // û
-    { 16, 26, 21, 2, 25, 104, 9577 }, // ü
-    { 17, 34, 17, 0, 26, 145, 9681 }, // ý
-    { 17, 34, 21, 2, 26, 145, 9826 }, // þ
-    { 17, 33, 17, 0, 25, 141, 9971 }, // ÿ
-    { 22, 29, 21, 0, 29, 160, 0 }, // Ā
-    { 15, 24, 19, 1, 23, 90, 160 }, // ā
-    { 22, 31, 21, 0, 31, 171, 250 }, // Ă
-    { 15, 26, 19, 1, 25, 98, 421 }, // ă
-    { 22, 32, 21, 0, 24, 176, 519 }, // Ą
-    { 16, 27, 19, 1, 19, 108, 695 }, // ą
-    { 19, 33, 21, 2, 32, 157, 803 }, // Ć
-    { 14, 27, 16, 1, 26, 95, 960 }, // ć
-    { 19, 33, 21, 2, 32, 157, 1055 }, // Ĉ
-    { 15, 27, 16, 1, 26, 102, 1212 }, // ĉ
-    { 19, 32, 21, 2, 31, 152, 1314 }, // Ċ
-    { 14, 26, 16, 1, 25, 91, 1466 }, // ċ
-    { 19, 33, 21, 2, 32, 157, 1557 }, // Č
-    { 15, 27, 16, 1, 26, 102, 1714 }, // č
-    { 20, 32, 24, 3, 32, 160, 1816 }, // Ď
-    { 22, 27, 21, 1, 26, 149, 1976 }, // ď
-    { 22, 24, 24, 1, 24, 132, 2125 }, // Đ
-    { 20, 27, 21, 1, 26, 135, 2257 }, // đ
-    { 14, 29, 19, 3, 29, 102, 2392 }, // Ē
-    { 17, 24, 19, 1, 23, 102, 2494 }, // ē
-    { 14, 31, 19, 3, 31, 109, 2596 }, // Ĕ
-    { 17, 26, 19, 1, 25, 111, 2705 }, // ĕ
-    { 14, 31, 19, 3, 31, 109, 2816 }, // Ė
-    { 17, 26, 19, 1, 25, 111, 2925 }, // ė
-    { 14, 32, 19, 3, 24, 112, 3036 }, // Ę
-    { 17, 27, 19, 1, 19, 115, 3148 }, // ę
-    { 14, 32, 19, 3, 32, 112, 3263 }, // Ě
-    { 17, 27, 19, 1, 26, 115, 3375 }, // ě
-    { 20, 33, 24, 2, 32, 165, 3490 }, // Ĝ
-    { 17, 34, 21, 1, 26, 145, 3655 }, // ĝ
-    { 20, 32, 24, 2, 31, 160, 3800 }, // Ğ
-    { 17, 33, 21, 1, 25, 141, 3960 }, // ğ
-    { 20, 32, 24, 2, 31, 160, 4101 }, // Ġ
-    { 17, 33, 21, 1, 25, 141, 4261 }, // ġ
-    { 20, 33, 24, 2, 25, 165, 4402 }, // Ģ
-    { 17, 34, 21, 1, 26, 145, 4567 }, // ģ
-    { 19, 32, 25, 3, 32, 152, 4712 }, // Ĥ
-    { 20, 33, 21, -2, 33, 165, 4864 }, // ĥ
-    { 25, 24, 25, 0, 24, 150, 5029 }, // Ħ
-    { 18, 26, 21, 0, 26, 117, 5179 }, // ħ
-    { 13, 31, 11, -1, 31, 101, 5296 }, // Ĩ
-    { 13, 25, 9, -2, 25, 82, 5397 }, // ĩ
-    { 11, 29, 11, 0, 29, 80, 5479 }, // Ī
-    { 11, 23, 9, -1, 23, 64, 5559 }, // ī
-    { 11, 31, 11, 0, 31, 86, 5623 }, // Ĭ
-    { 11, 25, 9, -1, 25, 69, 5709 }, // ĭ
-    { 9, 32, 11, 1, 24, 72, 5778 }, // Į
-    { 7, 33, 9, 0, 25, 58, 5850 }, // į
-    { 9, 31, 11, 1, 31, 70, 5908 }, // İ
-    { 4, 18, 9, 2, 18, 18, 5978 }, // ı
-    { 17, 31, 20, 1, 24, 132, 5996 }, // Ĳ
-    { 13, 33, 17, 2, 25, 108, 6128 }, // ĳ
-    { 14, 39, 9, -3, 32, 137, 6236 }, // Ĵ
-    { 12, 34, 9, -2, 26, 102, 6373 }, // ĵ
-    { 18, 32, 21, 3, 24, 144, 6475 }, // Ķ
-    { 16, 34, 18, 2, 26, 136, 6619 }, // ķ
-    { 16, 18, 18, 2, 18, 72, 6755 }, // ĸ
-    { 15, 32, 17, 2, 32, 120, 6827 }, // Ĺ
-    { 8, 33, 9, 2, 33, 66, 6947 }, // ĺ
-    { 14, 32, 17, 3, 24, 112, 7013 }, // Ļ
-    { 5, 34, 9, 2, 26, 43, 7125 }, // ļ
-    { 14, 24, 17, 3, 24, 84, 7168 }, // Ľ
-    { 10, 26, 9, 2, 26, 65, 7252 }, // ľ
-    { 14, 24, 17, 3, 24, 84, 7317 }, // Ŀ
-    { 9, 26, 9, 2, 26, 59, 7401 }, // ŀ
-    { 17, 24, 17, 0, 24, 102, 7460 }, // Ł
-    { 10, 26, 9, -1, 26, 65, 7562 }, // ł
-    { 20, 32, 25, 3, 32, 160, 7627 }, // Ń
-    { 16, 26, 21, 2, 26, 104, 7787 }, // ń
-    { 20, 32, 25, 3, 24, 160, 7891 }, // Ņ
-    { 16, 27, 21, 2, 19, 108, 8051 }, // ņ
-    { 20, 32, 25, 3, 32, 160, 8159 }, // Ň
-    { 16, 26, 21, 2, 26, 104, 8319 }, // ň
-    { 21, 24, 23, 0, 24, 126, 8423 }, // ŉ
-    { 20, 31, 25, 3, 24, 155, 8549 }, // Ŋ
-    { 16, 27, 21, 2, 19, 108, 8704 }, // ŋ
-    { 22, 30, 26, 2, 29, 165, 8812 }, // Ō
-    { 18, 24, 20, 1, 23, 108, 8977 }, // ō
-    { 22, 32, 26, 2, 31, 176, 9085 }, // Ŏ
-    { 18, 26, 20, 1, 25, 117, 9261 }, // ŏ
-    { 22, 33, 26, 2, 32, 182, 9378 }, // Ő
-    { 18, 27, 20, 1, 26, 122, 9560 }, // ő
-    { 27, 26, 31, 2, 25, 176, 9682 }, // Œ
-    { 29, 20, 32, 1, 19, 145, 9858 }, // œ
-    { 18, 32, 21, 3, 32, 144, 10003 }, // Ŕ
-    { 12, 26, 14, 2, 26, 78, 10147 }, // ŕ
-    { 18, 32, 21, 3, 24, 144, 10225 }, // Ŗ
-    { 12, 27, 14, 2, 19, 81, 10369 }, // ŗ
-    { 18, 32, 21, 3, 32, 144, 10450 }, // Ř
-    { 12, 26, 14, 2, 26, 78, 10594 }, // ř
-    { 16, 33, 18, 1, 32, 132, 10672 }, // Ś
-    { 14, 27, 16, 1, 26, 95, 10804 }, // ś
-    { 16, 33, 18, 1, 32, 132, 10899 }, // Ŝ
-    { 14, 27, 16, 1, 26, 95, 11031 }, // ŝ
-    { 16, 33, 18, 1, 25, 132, 11126 }, // Ş
-    { 14, 27, 16, 1, 19, 95, 11258 }, // ş
-    { 16, 33, 18, 1, 32, 132, 11353 }, // Š
-    { 14, 27, 16, 1, 26, 95, 11485 }, // š
-    { 19, 32, 19, 0, 24, 152, 11580 }, // Ţ
-    { 12, 30, 12, 0, 22, 90, 11732 }, // ţ
-    { 19, 32, 19, 0, 32, 152, 11822 }, // Ť
-    { 16, 27, 12, 0, 26, 108, 11974 }, // ť
-    { 19, 24, 19, 0, 24, 114, 12082 }, // Ŧ
-    { 12, 23, 12, 0, 22, 69, 12196 }, // ŧ
-    { 19, 32, 24, 3, 31, 152, 12265 }, // Ũ
-    { 16, 26, 21, 2, 25, 104, 12417 }, // ũ
-    { 19, 30, 24, 3, 29, 143, 12521 }, // Ū
-    { 16, 24, 21, 2, 23, 96, 12664 }, // ū
-    { 19, 32, 24, 3, 31, 152, 12760 }, // Ŭ
-    { 16, 26, 21, 2, 25, 104, 12912 }, // ŭ
-    { 19, 35, 24, 3, 34, 167, 13016 }, // Ů
-    { 16, 29, 21, 2, 28, 116, 13183 }, // ů
-    { 19, 33, 24, 3, 32, 157, 13299 }, // Ű
-    { 16, 27, 21, 2, 26, 108, 13456 }, // ű
-    { 19, 32, 24, 3, 24, 152, 13564 }, // Ų
-    { 17, 26, 21, 2, 18, 111, 13716 }, // ų
-    { 31, 32, 31, 0, 32, 248, 13827 }, // Ŵ
-    { 26, 26, 26, 0, 26, 169, 14075 }, // ŵ
-    { 19, 32, 19, 0, 32, 152, 14244 }, // Ŷ
-    { 17, 34, 17, 0, 26, 145, 14396 }, // ŷ
-    { 19, 31, 19, 0, 31, 148, 14541 }, // Ÿ
-    { 17, 32, 19, 1, 32, 136, 14689 }, // Ź
-    { 14, 26, 16, 1, 26, 91, 14825 }, // ź
-    { 17, 31, 19, 1, 31, 132, 14916 }, // Ż
-    { 14, 25, 16, 1, 25, 88, 15048 }, // ż
-    { 17, 32, 19, 1, 32, 136, 15136 }, // Ž
-    { 14, 26, 16, 1, 26, 91, 15272 }, // ž
-    { 11, 26, 11, 2, 26, 72, 15363 }, // ſ
-    { 8, 6, 0, -17, 26, 12, 0 }, // ̀
-    { 7, 6, 0, -11, 26, 11, 12 }, // ́
-    { 12, 6, 0, -6, 26, 18, 23 }, // ̂
-    { 13, 5, 0, -17, 25, 17, 41 }, // ̃
-    { 10, 3, 0, -5, 23, 8, 58 }, // ̄
-    { 14, 4, 0, -7, 29, 14, 66 }, // ̅
-    { 12, 5, 0, -6, 25, 15, 80 }, // ̆
-    { 4, 5, 0, -2, 25, 5, 95 }, // ̇
-    { 10, 4, 0, -5, 25, 10, 100 }, // ̈
-    { 7, 9, 0, -13, 28, 16, 110 }, // ̉
-    { 8, 8, 0, -4, 28, 16, 126 }, // ̊
-    { 13, 6, 0, -5, 26, 20, 142 }, // ̋
-    { 12, 6, 0, -6, 26, 18, 162 }, // ̌
-    { 4, 7, 0, -2, 26, 7, 180 }, // ̍
-    { 8, 7, 0, -4, 26, 14, 187 }, // ̎
-    { 13, 6, 0, -18, 26, 20, 201 }, // ̏
-    { 12, 9, 0, -6, 29, 27, 221 }, // ̐
-    { 12, 5, 0, -6, 25, 15, 248 }, // ̑
-    { 6, 9, 0, -3, 24, 14, 263 }, // ̒
-    { 6, 9, 0, -3, 24, 14, 277 }, // ̓
-    { 6, 9, 0, -3, 24, 14, 291 }, // ̔
-    { 6, 9, 0, -3, 24, 14, 305 }, // ̕
-    { 8, 6, 0, -4, -1, 12, 319 }, // ̖
-    { 8, 6, 0, -4, -1, 12, 331 }, // ̗
-    { 6, 8, 0, -3, 0, 12, 343 }, // ̘
-    { 6, 8, 0, -3, 0, 12, 355 }, // ̙
-    { 10, 9, 10, 0, 26, 23, 367 }, // ̚
-    { 8, 8, 0, -4, 26, 16, 390 }, // ̛
-    { 4, 8, 0, -2, 0, 8, 406 }, // ̜
-    { 8, 6, 0, -4, -1, 12, 414 }, // ̝
-    { 8, 6, 0, -4, -1, 12, 426 }, // ̞
-    { 8, 8, 0, -4, 0, 16, 438 }, // ̟
-    { 8, 3, 0, -4, -2, 6, 454 }, // ̠
-    { 6, 10, 0, -6, 2, 15, 460 }, // ̡
-    { 6, 10, 0, 0, 2, 15, 475 }, // ̢
-    { 4, 4, 0, -12, -2, 4, 490 }, // ̣
-    { 10, 4, 0, -5, -2, 10, 494 }, // ̤
-    { 8, 8, 0, -4, 0, 16, 504 }, // ̥
-    { 6, 6, 0, -3, -2, 9, 520 }, // ̦
-    { 8, 8, 0, -4, 0, 16, 529 }, // ̧
-    { 6, 9, 0, -3, 1, 14, 545 }, // ̨
-    { 4, 7, 0, -2, -1, 7, 559 }, // ̩
-    { 12, 7, 0, -6, -1, 21, 566 }, // ̪
-    { 14, 4, 0, -7, -2, 14, 587 }, // ̫
-    { 12, 6, 0, -6, -1, 18, 601 }, // ̬
-    { 12, 6, 0, -6, -1, 18, 619 }, // ̭
-    { 12, 5, 0, -6, -1, 15, 637 }, // ̮
-    { 12, 5, 0, -6, -1, 15, 652 }, // ̯
-    { 14, 5, 0, -7, -1, 18, 667 }, // ̰
-    { 10, 3, 0, -5, -2, 8, 685 }, // ̱
-    { 16, 3, 0, -8, -3, 12, 693 }, // ̲
-    { 14, 8, 0, -7, 0, 28, 705 }, // ̳
-    { 13, 5, 0, -6, 12, 17, 733 }, // ̴
-    { 14, 4, 0, -7, 12, 14, 750 }, // ̵
-    { 24, 3, 0, -12, 11, 18, 764 }, // ̶
-    { 10, 8, 0, -5, 14, 20, 782 }, // ̷
-    { 14, 28, 0, -7, 26, 98, 802 }, // ̸
-    { 4, 8, 0, -2, 0, 8, 900 }, // ̹
-    { 12, 7, 0, -6, -1, 21, 908 }, // ̺
-    { 14, 8, 0, -7, 0, 28, 929 }, // ̻
-    { 14, 4, 0, -7, -2, 14, 957 }, // ̼
-    { 8, 7, 0, -4, 26, 14, 971 }, // ̽
-    { 6, 10, 0, -3, 29, 15, 985 }, // ̾
-    { 14, 8, 0, -7, 33, 28, 1000 }, // ̿
-    { 8, 6, 0, -6, 26, 12, 1028 }, // ̀
-    { 8, 6, 0, -2, 26, 12, 1040 }, // ́
-    { 14, 5, 0, -7, 25, 18, 1052 }, // ͂
-    { 6, 6, 0, -3, 26, 9, 1070 }, // ̓
-    { 13, 6, 0, -6, 26, 20, 1079 }, // ̈́
-    { 6, 6, 0, -2, -2, 9, 1099 }, // ͅ
-    { 16, 7, 0, -8, 26, 28, 1108 }, // ͆
-    { 14, 8, 0, -7, 0, 28, 1136 }, // ͇
-    { 8, 7, 0, -4, -1, 14, 1164 }, // ͈
-    { 8, 6, 0, -4, -2, 12, 1178 }, // ͉
-    { 14, 8, 0, -7, 26, 28, 1190 }, // ͊
-    { 14, 12, 0, -7, 31, 42, 1218 }, // ͋
-    { 12, 9, 0, -6, 29, 27, 1260 }, // ͌
-    { 12, 7, 0, -6, -1, 21, 1287 }, // ͍
-    { 8, 8, 0, -4, 0, 16, 1308 }, // ͎
-    { 24, 24, 0, -12, 24, 144, 1324 }, // ͏
-    { 6, 8, 0, -3, 27, 12, 1468 }, // ͐
-    { 5, 8, 0, -2, 28, 10, 1480 }, // ͑
-    { 12, 8, 0, -6, 28, 24, 1490 }, // ͒
-    { 8, 7, 0, -4, -1, 14, 1514 }, // ͓
-    { 6, 7, 0, -3, -1, 11, 1528 }, // ͔
-    { 6, 7, 0, -3, -1, 11, 1539 }, // ͕
-    { 14, 7, 0, -7, -1, 25, 1550 }, // ͖
-    { 5, 8, 0, -2, 28, 10, 1575 }, // ͗
-    { 4, 5, 0, 4, 25, 5, 1585 }, // ͘
-    { 8, 7, 0, -4, -1, 14, 1590 }, // ͙
-    { 14, 8, 0, -7, 0, 28, 1604 }, // ͚
-    { 8, 8, 0, -4, 27, 16, 1632 }, // ͛
-    { 26, 7, 0, -13, -1, 46, 1648 }, // ͜
-    { 26, 7, 0, -13, 26, 46, 1694 }, // ͝
-    { 20, 3, 0, -10, 23, 15, 1740 }, // ͞
-    { 20, 3, 0, -10, -2, 15, 1755 }, // ͟
-    { 26, 5, 0, -13, 25, 33, 1770 }, // ͠
-    { 26, 8, 0, -13, 29, 52, 1803 }, // ͡
-    { 27, 7, 0, -13, -1, 48, 1855 }, // ͢
-    { 8, 8, 0, -4, 28, 16, 1903 }, // ͣ
-    { 8, 8, 0, -4, 28, 16, 1919 }, // ͤ
-    { 3, 11, 0, -1, 31, 9, 1935 }, // ͥ
-    { 9, 8, 0, -4, 28, 18, 1944 }, // ͦ
-    { 8, 8, 0, -4, 28, 16, 1962 }, // ͧ
-    { 7, 8, 0, -3, 28, 14, 1978 }, // ͨ
-    { 8, 11, 0, -4, 31, 22, 1992 }, // ͩ
-    { 8, 11, 0, -4, 31, 22, 2014 }, // ͪ
-    { 13, 8, 0, -6, 28, 26, 2036 }, // ͫ
-    { 6, 8, 0, -2, 28, 12, 2062 }, // ͬ
-    { 6, 10, 0, -3, 30, 15, 2074 }, // ͭ
-    { 9, 8, 0, -4, 28, 18, 2089 }, // ͮ
-    { 9, 8, 0, -4, 28, 18, 2107 }, // ͯ
-    { 14, 32, 19, 3, 32, 112, 0 }, // Ѐ
-    { 14, 31, 19, 3, 31, 109, 112 }, // Ё
-    { 23, 25, 24, 0, 24, 144, 221 }, // Ђ
-    { 14, 32, 17, 3, 32, 112, 365 }, // Ѓ
-    { 18, 26, 21, 2, 25, 117, 477 }, // Є
-    { 16, 26, 18, 1, 25, 104, 594 }, // Ѕ
-    { 4, 24, 9, 3, 24, 24, 698 }, // І
-    { 9, 31, 9, 0, 31, 70, 722 }, // Ї
-    { 10, 31, 9, -3, 24, 78, 792 }, // Ј
-    { 32, 25, 34, 0, 24, 200, 870 }, // Љ
-    { 30, 24, 34, 3, 24, 180, 1070 }, // Њ
-    { 22, 24, 24, 0, 24, 132, 1250 }, // Ћ
-    { 18, 32, 21, 3, 32, 144, 1382 }, // Ќ
-    { 19, 32, 25, 3, 32, 152, 1526 }, // Ѝ
-    { 21, 32, 21, 0, 31, 168, 1678 }, // Ў
-    { 19, 30, 24, 3, 24, 143, 1846 }, // Џ
-    { 22, 24, 21, 0, 24, 132, 1989 }, // А
-    { 16, 24, 20, 3, 24, 96, 2121 }, // Б
-    { 17, 24, 22, 3, 24, 102, 2217 }, // В
-    { 14, 24, 17, 3, 24, 84, 2319 }, // Г
-    { 24, 30, 24, 0, 24, 180, 2403 }, // Д
-    { 14, 24, 19, 3, 24, 84, 2583 }, // Е
-    { 31, 24, 30, 0, 24, 186, 2667 }, // Ж
-    { 17, 26, 19, 1, 25, 111, 2853 }, // З
-    { 19, 24, 25, 3, 24, 114, 2964 }, // И
-    { 19, 31, 25, 3, 31, 148, 3078 }, // Й
-    { 18, 24, 21, 3, 24, 108, 3226 }, // К
-    { 21, 25, 23, 0, 24, 132, 3334 }, // Л
-    { 24, 24, 30, 3, 24, 144, 3466 }, // М
-    { 19, 24, 25, 3, 24, 114, 3610 }, // Н
-    { 22, 26, 25, 2, 25, 143, 3724 }, // О
-    { 19, 24, 24, 3, 24, 114, 3867 }, // П
-    { 16, 24, 20, 3, 24, 96, 3981 }, // Р
-    { 18, 26, 21, 2, 25, 117, 4077 }, // С
-    { 19, 24, 19, 0, 24, 114, 4194 }, // Т
-    { 21, 25, 21, 0, 24, 132, 4308 }, // У
-    { 25, 26, 27, 1, 25, 163, 4440 }, // Ф
-    { 20, 24, 20, 0, 24, 120, 4603 }, // Х
-    { 22, 30, 25, 3, 24, 165, 4723 }, // Ц
-    { 18, 24, 22, 2, 24, 108, 4888 }, // Ч
-    { 29, 24, 35, 3, 24, 174, 4996 }, // Ш
-    { 31, 30, 34, 3, 24, 233, 5170 }, // Щ
-    { 22, 24, 23, 0, 24, 132, 5403 }, // Ъ
-    { 23, 24, 28, 3, 24, 138, 5535 }, // Ы
-    { 16, 24, 20, 3, 24, 96, 5673 }, // Ь
-    { 19, 26, 22, 1, 25, 124, 5769 }, // Э
-    { 29, 26, 33, 3, 25, 189, 5893 }, // Ю
-    { 18, 24, 21, 1, 24, 108, 6082 }, // Я
-    { 15, 20, 19, 1, 19, 75, 6190 }, // а
-    { 18, 27, 20, 1, 26, 122, 6265 }, // б
-    { 16, 18, 19, 2, 18, 72, 6387 }, // в
-    { 12, 18, 15, 2, 18, 54, 6459 }, // г
-    { 20, 23, 20, 0, 18, 115, 6513 }, // д
-    { 16, 20, 18, 1, 19, 80, 6628 }, // е
-    { 26, 18, 25, 0, 18, 117, 6708 }, // ж
-    { 14, 20, 16, 1, 19, 70, 6825 }, // з
-    { 16, 18, 21, 2, 18, 72, 6895 }, // и
-    { 16, 25, 21, 2, 25, 100, 6967 }, // й
-    { 16, 18, 18, 2, 18, 72, 7067 }, // к
-    { 17, 19, 20, 0, 18, 81, 7139 }, // л
-    { 21, 18, 26, 2, 18, 95, 7220 }, // м
-    { 16, 18, 20, 2, 18, 72, 7315 }, // н
-    { 18, 20, 20, 1, 19, 90, 7387 }, // о
-    { 16, 18, 20, 2, 18, 72, 7477 }, // п
-    { 17, 27, 20, 2, 19, 115, 7549 }, // р
-    { 15, 20, 16, 1, 19, 75, 7664 }, // с
-    { 15, 18, 16, 0, 18, 68, 7739 }, // т
-    { 17, 26, 17, 0, 18, 111, 7807 }, // у
-    { 22, 34, 25, 1, 26, 187, 7918 }, // ф
-    { 17, 18, 17, 0, 18, 77, 8105 }, // х
-    { 19, 23, 20, 2, 18, 110, 8182 }, // ц
-    { 15, 18, 20, 2, 18, 68, 8292 }, // ч
-    { 26, 18, 30, 2, 18, 117, 8360 }, // ш
-    { 28, 23, 30, 2, 18, 161, 8477 }, // щ
-    { 20, 18, 21, 0, 18, 90, 8638 }, // ъ
-    { 21, 18, 25, 2, 18, 95, 8728 }, // ы
-    { 15, 18, 18, 2, 18, 68, 8823 }, // ь
-    { 14, 20, 16, 1, 19, 70, 8891 }, // э
-    { 24, 20, 27, 2, 19, 120, 8961 }, // ю
-    { 16, 18, 19, 1, 18, 72, 9081 }, // я
-    { 16, 27, 18, 1, 26, 108, 9153 }, // ѐ
-    { 16, 26, 18, 1, 25, 104, 9261 }, // ё
-    { 18, 34, 21, 0, 26, 153, 9365 }, // ђ
-    { 12, 26, 15, 2, 26, 78, 9518 }, // ѓ
-    { 15, 20, 16, 1, 19, 75, 9596 }, // є
-    { 14, 20, 16, 1, 19, 70, 9671 }, // ѕ
-    { 5, 25, 9, 2, 25, 32, 9741 }, // і
-    { 8, 25, 9, 0, 25, 50, 9773 }, // ї
-    { 9, 33, 9, -2, 25, 75, 9823 }, // ј
-    { 28, 19, 29, 0, 18, 133, 9898 }, // љ
-    { 27, 18, 30, 2, 18, 122, 10031 }, // њ
-    { 18, 26, 21, 0, 26, 117, 10153 }, // ћ
-    { 16, 26, 18, 2, 26, 104, 10270 }, // ќ
-    { 16, 26, 21, 2, 26, 104, 10374 }, // ѝ
-    { 17, 33, 17, 0, 25, 141, 10478 }, // ў
-    { 16, 23, 20, 2, 18, 92, 10619 }, // џ
-    { 30, 25, 31, 0, 24, 188, 10711 }, // Ѡ
-    { 26, 18, 26, 0, 18, 117, 10899 }, // ѡ
-    { 21, 24, 23, 0, 24, 126, 11016 }, // Ѣ
-    { 20, 22, 21, 0, 22, 110, 11142 }, // ѣ
-    { 27, 26, 31, 3, 25, 176, 11252 }, // Ѥ
-    { 22, 20, 25, 2, 19, 110, 11428 }, // ѥ
-    { 23, 24, 23, 0, 24, 138, 11538 }, // Ѧ
-    { 19, 18, 19, 0, 18, 86, 11676 }, // ѧ
-    { 28, 24, 31, 3, 24, 168, 11762 }, // Ѩ
-    { 24, 18, 26, 2, 18, 108, 11930 }, // ѩ
-    { 24, 24, 24, 0, 24, 144, 12038 }, // Ѫ
-    { 22, 18, 21, 0, 18, 99, 12182 }, // ѫ
-    { 30, 24, 33, 3, 24, 180, 12281 }, // Ѭ
-    { 27, 18, 28, 2, 18, 122, 12461 }, // ѭ
-    { 17, 37, 20, 1, 29, 158, 12583 }, // Ѯ
-    { 15, 30, 16, 0, 23, 113, 12741 }, // ѯ
-    { 22, 24, 27, 3, 24, 132, 12854 }, // Ѱ
-    { 21, 34, 25, 2, 26, 179, 12986 }, // ѱ
-    { 22, 26, 26, 2, 25, 143, 13165 }, // Ѳ
-    { 18, 20, 20, 1, 19, 90, 13308 }, // ѳ
-    { 23, 24, 21, 0, 24, 138, 13398 }, // Ѵ
-    { 18, 19, 17, 0, 19, 86, 13536 }, // ѵ
-    { 23, 32, 21, 0, 32, 184, 13622 }, // Ѷ
-    { 18, 26, 17, 0, 26, 117, 13806 }, // ѷ
-    { 39, 33, 41, 2, 25, 322, 13923 }, // Ѹ
-    { 36, 27, 37, 1, 19, 243, 14245 }, // ѹ
-    { 24, 28, 27, 2, 26, 168, 14488 }, // Ѻ
-    { 20, 22, 22, 1, 20, 110, 14656 }, // ѻ
-    { 31, 36, 34, 2, 35, 279, 14766 }, // Ѽ
-    { 28, 31, 30, 1, 30, 217, 15045 }, // ѽ
-    { 30, 31, 31, 0, 30, 233, 15262 }, // Ѿ
-    { 26, 24, 26, 0, 24, 156, 15495 }, // ѿ
-    { 19, 33, 21, 2, 25, 157, 15651 }, // Ҁ
-    { 15, 27, 16, 1, 19, 102, 15808 }, // ҁ
-    { 18, 22, 20, 1, 21, 99, 15910 }, // ҂
-    { 13, 5, 0, -16, 24, 17, 16009 }, // ҃
-    { 13, 5, 0, -16, 25, 17, 16026 }, // ҄
-    { 5, 6, 0, -12, 26, 8, 16043 }, // ҅
-    { 5, 6, 0, -12, 26, 8, 16051 }, // ҆
-    { 13, 5, 0, -7, 30, 17, 16059 }, // ҇
-    { 38, 36, 0, -19, 27, 342, 16076 }, // ҈
-    { 38, 38, 0, -19, 28, 361, 16418 }, // ҉
-    { 23, 38, 26, 3, 31, 219, 16779 }, // Ҋ
-    { 20, 33, 22, 2, 26, 165, 16998 }, // ҋ
-    { 19, 24, 21, 0, 24, 114, 17163 }, // Ҍ
-    { 19, 26, 20, 0, 26, 124, 17277 }, // ҍ
-    { 16, 24, 20, 3, 24, 96, 17401 }, // Ҏ
-    { 17, 27, 21, 2, 19, 115, 17497 }, // ҏ
-    { 14, 29, 18, 3, 29, 102, 17612 }, // Ґ
-    { 12, 24, 15, 2, 24, 72, 17714 }, // ґ
-    { 17, 24, 18, 0, 24, 102, 17786 }, // Ғ
-    { 14, 18, 14, 0, 18, 63, 17888 }, // ғ
-    { 18, 33, 22, 3, 24, 149, 17951 }, // Ҕ
-    { 15, 27, 18, 2, 18, 102, 18100 }, // ҕ
-    { 30, 31, 30, 0, 24, 233, 18202 }, // Җ
-    { 26, 25, 27, 0, 18, 163, 18435 }, // җ
-    { 17, 33, 19, 1, 25, 141, 18598 }, // Ҙ
-    { 14, 27, 16, 1, 19, 95, 18739 }, // ҙ
-    { 19, 31, 22, 3, 24, 148, 18834 }, // Қ
-    { 17, 25, 19, 2, 18, 107, 18982 }, // қ
-    { 18, 24, 21, 3, 24, 108, 19089 }, // Ҝ
-    { 16, 18, 18, 2, 18, 72, 19197 }, // ҝ
-    { 21, 24, 21, 0, 24, 126, 19269 }, // Ҟ
-    { 18, 26, 18, 0, 26, 117, 19395 }, // ҟ
-    { 24, 24, 23, 0, 24, 144, 19512 }, // Ҡ
-    { 21, 18, 21, 0, 18, 95, 19656 }, // ҡ
-    { 22, 31, 25, 3, 24, 171, 19751 }, // Ң
-    { 20, 25, 22, 2, 18, 125, 19922 }, // ң
-    { 24, 24, 27, 3, 24, 144, 20047 }, // Ҥ
-    { 23, 18, 25, 2, 18, 104, 20191 }, // ҥ
-    { 31, 33, 35, 3, 24, 256, 20295 }, // Ҧ
-    { 26, 27, 29, 2, 18, 176, 20551 }, // ҧ
-    { 23, 27, 26, 2, 25, 156, 20727 }, // Ҩ
-    { 20, 20, 21, 1, 19, 100, 20883 }, // ҩ
-    { 19, 33, 21, 2, 25, 157, 20983 }, // Ҫ
-    { 14, 27, 16, 1, 19, 95, 21140 }, // ҫ
-    { 19, 31, 19, 0, 24, 148, 21235 }, // Ҭ
-    { 16, 25, 16, 0, 18, 100, 21383 }, // ҭ
-    { 19, 24, 19, 0, 24, 114, 21483 }, // Ү
-    { 17, 26, 17, 0, 18, 111, 21597 }, // ү
-    { 19, 24, 19, 0, 24, 114, 21708 }, // Ұ
-    { 17, 26, 17, 0, 18, 111, 21822 }, // ұ
-    { 21, 31, 21, 0, 24, 163, 21933 }, // Ҳ
-    { 18, 25, 18, 0, 18, 113, 22096 }, // ҳ
-    { 28, 31, 29, 0, 24, 217, 22209 }, // Ҵ
-    { 24, 25, 24, 0, 18, 150, 22426 }, // ҵ
-    { 21, 31, 23, 2, 24, 163, 22576 }, // Ҷ
-    { 19, 25, 21, 2, 18, 119, 22739 }, // ҷ
-    { 19, 24, 23, 2, 24, 114, 22858 }, // Ҹ
-    { 16, 18, 20, 2, 18, 72, 22972 }, // ҹ
-    { 18, 24, 23, 3, 24, 108, 23044 }, // Һ
-    { 16, 26, 21, 2, 26, 104, 23152 }, // һ
-    { 27, 26, 28, 0, 25, 176, 23256 }, // Ҽ
-    { 21, 20, 22, 0, 19, 105, 23432 }, // ҽ
-    { 27, 32, 28, 0, 25, 216, 23537 }, // Ҿ
-    { 21, 26, 22, 0, 19, 137, 23753 }, // ҿ
-    { 9, 24, 11, 1, 24, 54, 23890 }, // Ӏ
-    { 31, 31, 30, 0, 31, 241, 23944 }, // Ӂ
-    { 26, 25, 25, 0, 25, 163, 24185 }, // ӂ
-    { 19, 33, 23, 3, 24, 157, 24348 }, // Ӄ
-    { 16, 27, 19, 2, 18, 108, 24505 }, // ӄ
-    { 24, 31, 24, 0, 24, 186, 24613 }, // Ӆ
-    { 20, 25, 20, 0, 18, 125, 24799 }, // ӆ
-    { 19, 33, 24, 3, 24, 157, 24924 }, // Ӈ
-    { 17, 27, 21, 2, 18, 115, 25081 }, // ӈ
-    { 22, 31, 25, 3, 24, 171, 25196 }, // Ӊ
-    { 20, 25, 22, 2, 18, 125, 25367 }, // ӊ
-    { 19, 31, 23, 2, 24, 148, 25492 }, // Ӌ
-    { 16, 25, 20, 2, 18, 100, 25640 }, // ӌ
-    { 28, 31, 31, 3, 24, 217, 25740 }, // Ӎ
-    { 24, 25, 25, 2, 18, 150, 25957 }, // ӎ
-    { 9, 24, 11, 1, 24, 54, 26107 }, // ӏ
-    { 22, 31, 21, 0, 31, 171, 26161 }, // Ӑ
-    { 15, 26, 19, 1, 25, 98, 26332 }, // ӑ
-    { 22, 31, 21, 0, 31, 171, 26430 }, // Ӓ
-    { 15, 26, 19, 1, 25, 98, 26601 }, // ӓ
-    { 29, 24, 29, -1, 24, 174, 26699 }, // Ӕ
-    { 27, 20, 29, 1, 19, 135, 26873 }, // ӕ
-    { 14, 31, 19, 3, 31, 109, 27008 }, // Ӗ
-    { 17, 26, 19, 1, 25, 111, 27117 }, // ӗ
-    { 22, 26, 25, 1, 25, 143, 27228 }, // Ә
-    { 16, 20, 19, 1, 19, 80, 27371 }, // ә
-    { 22, 32, 25, 1, 31, 176, 27451 }, // Ӛ
-    { 16, 26, 19, 1, 25, 104, 27627 }, // ӛ
-    { 31, 31, 30, 0, 31, 241, 27731 }, // Ӝ
-    { 26, 25, 25, 0, 25, 163, 27972 }, // ӝ
-    { 17, 32, 19, 1, 31, 136, 28135 }, // Ӟ
-    { 14, 26, 16, 1, 25, 91, 28271 }, // ӟ
-    { 17, 25, 19, 1, 24, 107, 28362 }, // Ӡ
-    { 16, 26, 17, 0, 18, 104, 28469 }, // ӡ
-    { 19, 29, 25, 3, 29, 138, 28573 }, // Ӣ
-    { 16, 23, 21, 2, 23, 92, 28711 }, // ӣ
-    { 19, 31, 25, 3, 31, 148, 28803 }, // Ӥ
-    { 16, 25, 21, 2, 25, 100, 28951 }, // ӥ
-    { 22, 32, 26, 2, 31, 176, 29051 }, // Ӧ
-    { 18, 26, 20, 1, 25, 117, 29227 }, // ӧ
-    { 22, 26, 26, 2, 25, 143, 29344 }, // Ө
-    { 18, 20, 20, 1, 19, 90, 29487 }, // ө
-    { 22, 32, 26, 2, 31, 176, 29577 }, // Ӫ
-    { 18, 26, 20, 1, 25, 117, 29753 }, // ӫ
-    { 19, 32, 22, 1, 31, 152, 29870 }, // Ӭ
-    { 14, 26, 16, 1, 25, 91, 30022 }, // ӭ
-    { 21, 30, 21, 0, 29, 158, 30113 }, // Ӯ
-    { 17, 31, 17, 0, 23, 132, 30271 }, // ӯ
-    { 21, 32, 21, 0, 31, 168, 30403 }, // Ӱ
-    { 17, 33, 17, 0, 25, 141, 30571 }, // ӱ
-    { 21, 33, 21, 0, 32, 174, 30712 }, // Ӳ
-    { 17, 34, 17, 0, 26, 145, 30886 }, // ӳ
-    { 18, 31, 22, 2, 31, 140, 31031 }, // Ӵ
-    { 15, 25, 20, 2, 25, 94, 31171 }, // ӵ
-    { 14, 31, 18, 3, 24, 109, 31265 }, // Ӷ
-    { 12, 25, 14, 2, 18, 75, 31374 }, // ӷ
-    { 23, 31, 28, 3, 31, 179, 31449 }, // Ӹ
-    { 21, 25, 25, 2, 25, 132, 31628 }, // ӹ
-    { 17, 31, 18, 0, 24, 132, 31760 }, // Ӻ
-    { 14, 25, 14, 0, 18, 88, 31892 }, // ӻ
-    { 21, 31, 21, 0, 24, 163, 31980 }, // Ӽ
-    { 18, 25, 18, 0, 18, 113, 32143 }, // ӽ
-    { 20, 24, 20, 0, 24, 120, 32256 }, // Ӿ
-    { 18, 18, 18, 0, 18, 81, 32376 }, // ӿ
-    { 0, 0, 17, 0, 0, 0, 0 }, //  
-    { 0, 0, 33, 0, 0, 0, 0 }, //  
-    { 0, 0, 17, 0, 0, 0, 0 }, //  
-    { 0, 0, 33, 0, 0, 0, 0 }, //  
-    { 0, 0, 11, 0, 0, 0, 0 }, //  
-    { 0, 0, 8, 0, 0, 0, 0 }, //  
-    { 0, 0, 6, 0, 0, 0, 0 }, //  
-    { 0, 0, 19, 0, 0, 0, 0 }, //  
-    { 0, 0, 9, 0, 0, 0, 0 }, //  
-    { 0, 0, 6, 0, 0, 0, 0 }, //  
-    { 0, 0, 3, 0, 0, 0, 0 }, //  
-    { 0, 0, 0, 0, 0, 0, 0 }, // ​
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‍
-    { 9, 28, 0, -1, 23, 63, 0 }, // ‎
-    { 9, 28, 0, -8, 23, 63, 63 }, // ‏
-    { 9, 4, 11, 1, 11, 9, 126 }, // ‐
-    { 9, 4, 11, 1, 11, 9, 135 }, // ‑
-    { 17, 4, 19, 1, 14, 17, 144 }, // ‒
-    { 15, 4, 17, 1, 11, 15, 161 }, // –
-    { 31, 4, 33, 1, 11, 31, 176 }, // —
-    { 31, 4, 33, 1, 11, 31, 207 }, // ―
-    { 11, 35, 18, 4, 26, 97, 238 }, // ‖
-    { 15, 8, 14, -1, 0, 30, 335 }, // ‗
-    { 6, 9, 6, 0, 24, 14, 365 }, // ‘
-    { 6, 9, 6, 0, 24, 14, 379 }, // ’
-    { 6, 9, 8, 1, 4, 14, 393 }, // ‚
-    { 6, 9, 6, 0, 24, 14, 407 }, // ‛
-    { 12, 9, 12, 0, 24, 27, 421 }, // “
-    { 12, 9, 12, 0, 24, 27, 448 }, // ”
-    { 12, 9, 14, 1, 4, 27, 475 }, // „
-    { 12, 9, 12, 0, 24, 27, 502 }, // ‟
-    { 13, 26, 17, 2, 26, 85, 529 }, // †
-    { 14, 26, 17, 2, 26, 91, 614 }, // ‡
-    { 8, 9, 13, 2, 17, 18, 705 }, // •
-    { 9, 11, 12, 2, 18, 25, 723 }, // ‣
-    { 5, 6, 17, 6, 5, 8, 748 }, // ․
-    { 14, 6, 18, 2, 5, 21, 756 }, // ‥
-    { 22, 6, 26, 2, 5, 33, 777 }, // …
-    { 5, 6, 9, 2, 11, 8, 810 }, // ‧
-    { 0, 0, 20, 0, 0, 0, 818 }, //  
-    { 0, 0, 20, 0, 0, 0, 818 }, //  
-    { 9, 26, 0, -1, 21, 59, 818 }, // ‪
-    { 9, 26, 0, -8, 21, 59, 877 }, // ‫
-    { 8, 28, 0, -4, 23, 56, 936 }, // ‬
-    { 8, 28, 0, -4, 23, 56, 992 }, // ‭
-    { 8, 28, 0, -4, 23, 56, 1048 }, // ‮
-    { 0, 0, 6, 0, 0, 0, 1104 }, //  
-    { 37, 26, 39, 1, 25, 241, 1104 }, // ‰
-    { 49, 26, 51, 1, 25, 319, 1345 }, // ‱
-    { 8, 9, 8, 1, 24, 18, 1664 }, // ′
-    { 14, 9, 14, 1, 24, 32, 1682 }, // ″
-    { 20, 9, 19, 1, 24, 45, 1714 }, // ‴
-    { 8, 9, 8, -1, 24, 18, 1759 }, // ‵
-    { 13, 9, 15, -1, 24, 30, 1777 }, // ‶
-    { 19, 9, 20, -1, 24, 43, 1807 }, // ‷
-    { 13, 11, 13, 0, 3, 36, 1850 }, // ‸
-    { 9, 15, 10, 1, 16, 34, 1886 }, // ‹
-    { 8, 15, 10, 1, 16, 30, 1920 }, // ›
-    { 26, 26, 28, 1, 25, 169, 1950 }, // ※
-    { 13, 25, 17, 2, 24, 82, 2119 }, // ‼
-    { 14, 26, 15, 0, 25, 91, 2201 }, // ‽
-    { 18, 3, 17, -1, 28, 14, 2292 }, // ‾
-    { 20, 7, 20, 0, -1, 35, 2306 }, // ‿
-    { 20, 8, 20, 0, 27, 40, 2341 }, // ⁀
-    { 12, 22, 12, 0, 14, 66, 2381 }, // ⁁
-    { 37, 31, 37, 0, 26, 287, 2447 }, // ⁂
-    { 9, 4, 11, 1, 11, 9, 2734 }, // ⁃
-    { 18, 24, 4, -7, 24, 108, 2743 }, // ⁄
-    { 8, 30, 11, 2, 24, 60, 2851 }, // ⁅
-    { 9, 30, 11, 0, 24, 68, 2911 }, // ⁆
-    { 28, 26, 29, 0, 25, 182, 2979 }, // ⁇
-    { 21, 26, 23, 0, 25, 137, 3161 }, // ⁈
-    { 20, 26, 23, 2, 25, 130, 3298 }, // ⁉
-    { 17, 18, 19, 1, 18, 77, 3428 }, // ⁊
-    { 17, 31, 22, 3, 26, 132, 3505 }, // ⁋
-    { 18, 17, 21, 1, 18, 77, 3637 }, // ⁌
-    { 18, 17, 21, 2, 18, 77, 3714 }, // ⁍
-    { 16, 16, 18, 1, 9, 64, 3791 }, // ⁎
-    { 6, 24, 8, 1, 19, 36, 3855 }, // ⁏
-    { 20, 35, 20, 0, 27, 175, 3891 }, // ⁐
-    { 16, 33, 18, 1, 26, 132, 4066 }, // ⁑
-    { 13, 26, 12, 0, 25, 85, 4198 }, // ⁒
-    { 29, 6, 33, 2, 13, 44, 4283 }, // ⁓
-    { 20, 8, 20, 0, 0, 40, 4327 }, // ⁔
-    { 18, 18, 19, 0, 17, 81, 4367 }, // ⁕
-    { 15, 26, 17, 1, 25, 98, 4448 }, // ⁖
-    { 25, 9, 25, 1, 24, 57, 4546 }, // ⁗
-    { 25, 26, 27, 1, 25, 163, 4603 }, // ⁘
-    { 25, 26, 28, 1, 25, 163, 4766 }, // ⁙
-    { 5, 26, 7, 1, 25, 33, 4929 }, // ⁚
-    { 20, 26, 22, 1, 25, 130, 4962 }, // ⁛
-    { 25, 26, 27, 1, 25, 163, 5092 }, // ⁜
-    { 5, 25, 9, 2, 24, 32, 5255 }, // ⁝
-    { 5, 26, 9, 2, 25, 33, 5287 }, // ⁞
-    { 0, 0, 7, 0, 0, 0, 5320 }, //  
-    { 0, 0, 20, 0, 0, 0, 5320 }, // ⁠
-    { 0, 0, 20, 0, 0, 0, 5320 }, // ⁡
-    { 0, 0, 20, 0, 0, 0, 5320 }, // ⁢
-    { 0, 0, 20, 0, 0, 0, 5320 }, // ⁣
-    { 0, 0, 20, 0, 0, 0, 5320 }, // ⁤
-    { 0, 0, 0, 0, 0, 0, 5320 }, // ⁦
-    { 0, 0, 0, 0, 0, 0, 5320 }, // ⁧
-    { 0, 0, 0, 0, 0, 0, 5320 }, // ⁨
-    { 0, 0, 0, 0, 0, 0, 5320 }, // ⁩
-    { 8, 28, 0, -4, 23, 56, 5320 }, // ⁪
-    { 8, 28, 0, -4, 23, 56, 5376 }, // ⁫
-    { 8, 28, 0, -4, 23, 56, 5432 }, // ⁬
-    { 8, 29, 0, -4, 24, 58, 5488 }, // ⁭
-    { 8, 28, 0, -4, 23, 56, 5546 }, // ⁮
-    { 8, 28, 0, -4, 23, 56, 5602 }, // ⁯
-    { 11, 16, 12, 0, 29, 44, 0 }, // ⁰
-    { 3, 16, 6, 1, 25, 12, 44 }, // ⁱ
-    { 12, 16, 12, 0, 29, 48, 56 }, // ⁴
-    { 10, 16, 12, 1, 29, 40, 104 }, // ⁵
-    { 12, 16, 12, 0, 29, 48, 144 }, // ⁶
-    { 11, 16, 12, 0, 29, 44, 192 }, // ⁷
-    { 11, 16, 12, 0, 29, 44, 236 }, // ⁸
-    { 11, 16, 12, 0, 29, 44, 280 }, // ⁹
-    { 10, 10, 11, 1, 25, 25, 324 }, // ⁺
-    { 10, 3, 11, 1, 21, 8, 349 }, // ⁻
-    { 10, 6, 11, 1, 23, 15, 357 }, // ⁼
-    { 6, 19, 8, 2, 31, 29, 372 }, // ⁽
-    { 6, 19, 8, 0, 31, 29, 401 }, // ⁾
-    { 11, 12, 13, 1, 21, 33, 430 }, // ⁿ
-    { 11, 16, 12, 0, 11, 44, 463 }, // ₀
-    { 7, 16, 12, 1, 11, 28, 507 }, // ₁
-    { 11, 16, 12, 0, 11, 44, 535 }, // ₂
-    { 11, 16, 12, 0, 11, 44, 579 }, // ₃
-    { 12, 16, 12, 0, 11, 48, 623 }, // ₄
-    { 10, 16, 12, 1, 11, 40, 671 }, // ₅
-    { 12, 16, 12, 0, 11, 48, 711 }, // ₆
-    { 11, 16, 12, 0, 11, 44, 759 }, // ₇
-    { 11, 16, 12, 0, 11, 44, 803 }, // ₈
-    { 11, 16, 12, 0, 11, 44, 847 }, // ₉
-    { 10, 10, 11, 1, 7, 25, 891 }, // ₊
-    { 10, 3, 11, 1, 3, 8, 916 }, // ₋
-    { 10, 6, 11, 1, 5, 15, 924 }, // ₌
-    { 6, 19, 8, 2, 13, 29, 939 }, // ₍
-    { 6, 19, 8, 0, 13, 29, 968 }, // ₎
-    { 10, 12, 12, 1, 8, 30, 997 }, // ₐ
-    { 11, 12, 12, 1, 8, 33, 1027 }, // ₑ
-    { 11, 12, 13, 1, 8, 33, 1060 }, // ₒ
-    { 12, 12, 11, 0, 8, 36, 1093 }, // ₓ
-    { 11, 12, 12, 1, 8, 33, 1129 }, // ₔ
-    { 11, 16, 13, 1, 12, 44, 1162 }, // ₕ
-    { 11, 16, 12, 1, 12, 44, 1206 }, // ₖ
-    { 3, 16, 6, 1, 12, 12, 1250 }, // ₗ
-    { 18, 12, 20, 1, 8, 54, 1262 }, // ₘ
-    { 11, 12, 13, 1, 8, 33, 1316 }, // ₙ
-    { 12, 16, 13, 1, 8, 48, 1349 }, // ₚ
-    { 9, 12, 10, 1, 8, 27, 1397 }, // ₛ
-    { 8, 14, 8, 0, 10, 28, 1424 }, // ₜ
-    { 17, 25, 19, 1, 25, 107, 0 }, // ₠
-    { 18, 28, 19, 1, 26, 126, 107 }, // ₡
-    { 17, 26, 19, 1, 25, 111, 233 }, // ₢
-    { 17, 24, 19, 1, 24, 102, 344 }, // ₣
-    { 17, 25, 19, 1, 25, 107, 446 }, // ₤
-    { 27, 27, 31, 2, 23, 183, 553 }, // ₥
-    { 19, 24, 19, 0, 24, 114, 736 }, // ₦
-    { 23, 25, 26, 2, 24, 144, 850 }, // ₧
-    { 25, 25, 28, 2, 24, 157, 994 }, // ₨
-    { 22, 24, 22, 0, 24, 132, 1151 }, // ₩
-    { 22, 24, 27, 2, 24, 132, 1283 }, // ₪
-    { 20, 32, 21, 1, 26, 160, 1415 }, // ₫
-    { 19, 26, 19, 0, 25, 124, 1575 }, // €
-    { 20, 24, 19, 0, 24, 120, 1699 }, // ₭
-    { 19, 24, 19, 0, 24, 114, 1819 }, // ₮
-    { 32, 33, 32, 0, 25, 264, 1933 }, // ₯
-    { 18, 33, 19, 0, 25, 149, 2197 }, // ₰
-    { 19, 24, 19, 0, 24, 114, 2346 }, // ₱
-    { 20, 29, 24, 2, 26, 145, 2460 }, // ₲
-    { 21, 24, 20, 0, 24, 126, 2605 }, // ₳
-    { 18, 26, 18, 0, 25, 117, 2731 }, // ₴
-    { 19, 29, 21, 2, 26, 138, 2848 }, // ₵
-    { 20, 23, 21, 0, 22, 115, 2986 }, // ₶
-    { 23, 28, 24, 0, 25, 161, 3101 }, // ₷
-    { 18, 24, 18, 0, 24, 108, 3262 }, // ₸
-    { 15, 24, 19, 2, 24, 90, 3370 }, // ₹
-    { 19, 25, 19, 0, 24, 119, 3460 }, // ₺
-    { 26, 26, 26, 0, 25, 169, 3579 }, // ₻
-    { 24, 24, 27, 1, 24, 144, 3748 }, // ₼
-    { 19, 24, 19, 0, 24, 114, 3892 }, // ₽
-    { 22, 26, 26, 2, 26, 143, 4006 }, // ₾
-    { 15, 32, 19, 3, 28, 120, 4149 }, // ₿
-    { 14, 24, 16, 1, 19, 84, 4269 }, // ⃀
-    { 17, 3, 19, 1, 13, 13, 0 }, // −
-    { 31, 32, 33, 1, 26, 248, 0 }, // �
+    { 15, 15, 17, 1, 16, 57, 8327 }, // «
+    { 17, 9, 19, 1, 13, 39, 756 }, // ¬
+    { 9, 4, 11, 1, 11, 9, 795 }, // ­
+    { 26, 26, 28, 1, 25, 169, 804 }, // ®
+    { 18, 3, 17, -1, 28, 14, 973 }, // ¯
+    { 12, 12, 14, 1, 25, 36, 987 }, // °
+    { 17, 20, 19, 1, 20, 85, 1023 }, // ±
+    { 11, 16, 12, 0, 29, 44, 1108 }, // ²
+    { 11, 16, 12, 0, 29, 44, 1152 }, // ³
+    { 8, 6, 9, 1, 26, 12, 1196 }, // ´
+    { 16, 26, 21, 2, 18, 104, 1208 }, // µ
+    { 18, 31, 22, 1, 26, 140, 1312 }, // ¶
+    { 5, 6, 9, 2, 15, 8, 1452 }, // ·
+    { 8, 8, 8, 0, 0, 16, 1460 }, // ¸
+    { 7, 16, 12, 1, 29, 28, 1476 }, // ¹
+    { 11, 13, 13, 1, 25, 36, 1504 }, // º
+    { 15, 15, 17, 1, 16, 57, 8384 }, // »
+    { 24, 24, 25, 1, 24, 144, 1540 }, // ¼
+    { 25, 24, 26, 0, 24, 150, 1684 }, // ½
+    { 26, 25, 26, 0, 25, 163, 1834 }, // ¾
+    { 14, 26, 14, 0, 19, 91, 1997 }, // ¿
+    { 22, 32, 21, 0, 32, 176, 8441 }, // À
+    { 22, 32, 21, 0, 32, 176, 8617 }, // Á
+    { 22, 32, 21, 0, 32, 176, 8793 }, // Â
+    { 22, 31, 21, 0, 31, 171, 2088 }, // Ã
+    { 22, 31, 21, 0, 31, 171, 8969 }, // Ä
+    { 22, 30, 21, 0, 30, 165, 2259 }, // Å
+    { 29, 24, 29, -1, 24, 174, 2424 }, // Æ
+    { 19, 33, 21, 2, 25, 157, 9140 }, // Ç
+    { 14, 32, 19, 3, 32, 112, 9297 }, // È
+    { 14, 32, 19, 3, 32, 112, 9409 }, // É
+    { 14, 32, 19, 3, 32, 112, 9521 }, // Ê
+    { 14, 31, 19, 3, 31, 109, 9633 }, // Ë
+    { 9, 32, 11, 1, 32, 72, 9742 }, // Ì
+    { 10, 32, 11, 1, 32, 80, 9814 }, // Í
+    { 12, 32, 11, 0, 32, 96, 9894 }, // Î
+    { 10, 31, 11, 1, 31, 78, 9990 }, // Ï
+    { 22, 24, 24, 1, 24, 132, 2598 }, // Ð
+    { 20, 31, 25, 3, 31, 155, 10068 }, // Ñ
+    { 22, 33, 26, 2, 32, 182, 10223 }, // Ò
+    { 22, 33, 26, 2, 32, 182, 10405 }, // Ó
+    { 22, 33, 26, 2, 32, 182, 10587 }, // Ô
+    { 22, 32, 26, 2, 31, 176, 2730 }, // Õ
+    { 22, 32, 26, 2, 31, 176, 10769 }, // Ö
+    { 15, 16, 19, 2, 20, 60, 2906 }, // ×
+    { 22, 27, 26, 2, 25, 149, 2966 }, // Ø
+    { 19, 33, 24, 3, 32, 157, 10945 }, // Ù
+    { 19, 33, 24, 3, 32, 157, 11102 }, // Ú
+    { 19, 33, 24, 3, 32, 157, 11259 }, // Û
+    { 19, 32, 24, 3, 31, 152, 11416 }, // Ü
+    { 19, 32, 19, 0, 32, 152, 3115 }, // Ý
+    { 16, 24, 20, 3, 24, 96, 3267 }, // Þ
+    { 18, 27, 21, 2, 26, 122, 3363 }, // ß
+    { 15, 27, 19, 1, 26, 102, 11568 }, // à
+    { 15, 27, 19, 1, 26, 102, 11670 }, // á
+    { 15, 27, 19, 1, 26, 102, 11772 }, // â
+    { 15, 26, 19, 1, 25, 98, 3485 }, // ã
+    { 15, 26, 19, 1, 25, 98, 11874 }, // ä
+    { 15, 29, 19, 1, 28, 109, 3583 }, // å
+    { 27, 20, 29, 1, 19, 135, 3692 }, // æ
+    { 14, 27, 16, 1, 19, 95, 11972 }, // ç
+    { 17, 27, 19, 1, 26, 115, 12067 }, // è
+    { 17, 27, 19, 1, 26, 115, 12182 }, // é
+    { 17, 27, 19, 1, 26, 115, 12297 }, // ê
+    { 17, 26, 19, 1, 25, 111, 12412 }, // ë
+    { 8, 26, 9, -1, 26, 52, 12523 }, // ì
+    { 8, 26, 9, 2, 26, 52, 12575 }, // í
+    { 12, 26, 9, -2, 26, 78, 12627 }, // î
+    { 10, 25, 9, -1, 25, 63, 12705 }, // ï
+    { 18, 27, 20, 1, 26, 122, 3827 }, // ð
+    { 16, 25, 21, 2, 25, 100, 12768 }, // ñ
+    { 18, 27, 20, 1, 26, 122, 12868 }, // ò
+    { 18, 27, 20, 1, 26, 122, 12990 }, // ó
+    { 18, 27, 20, 1, 26, 122, 13112 }, // ô
+    { 18, 26, 20, 1, 25, 117, 3949 }, // õ
+    { 18, 26, 20, 1, 25, 117, 13234 }, // ö
+    { 17, 16, 19, 1, 20, 68, 4066 }, // ÷
+    { 18, 21, 20, 1, 19, 95, 4134 }, // ø
+    { 16, 27, 21, 2, 26, 108, 13351 }, // ù
+    { 16, 27, 21, 2, 26, 108, 13459 }, // ú
+    { 16, 27, 21, 2, 26, 108, 13567 }, // û
+    { 16, 26, 21, 2, 25, 104, 13675 }, // ü
+    { 17, 34, 17, 0, 26, 145, 4229 }, // ý
+    { 17, 34, 21, 2, 26, 145, 4374 }, // þ
+    { 17, 33, 17, 0, 25, 141, 4519 }, // ÿ
+    { 22, 29, 21, 0, 29, 160, 4660 }, // Ā
+    { 15, 24, 19, 1, 23, 90, 4820 }, // ā
+    { 22, 31, 21, 0, 31, 171, 4910 }, // Ă
+    { 15, 26, 19, 1, 25, 98, 5081 }, // ă
+    { 22, 32, 21, 0, 24, 176, 5179 }, // Ą
+    { 16, 27, 19, 1, 19, 108, 5355 }, // ą
+    { 19, 33, 21, 2, 32, 157, 5463 }, // Ć
+    { 14, 27, 16, 1, 26, 95, 5620 }, // ć
+    { 19, 33, 21, 2, 32, 157, 5715 }, // Ĉ
+    { 15, 27, 16, 1, 26, 102, 5872 }, // ĉ
+    { 19, 32, 21, 2, 31, 152, 5974 }, // Ċ
+    { 14, 26, 16, 1, 25, 91, 6126 }, // ċ
+    { 19, 33, 21, 2, 32, 157, 6217 }, // Č
+    { 15, 27, 16, 1, 26, 102, 6374 }, // č
+    { 20, 32, 24, 3, 32, 160, 6476 }, // Ď
+    { 22, 27, 21, 1, 26, 149, 6636 }, // ď
+    { 22, 24, 24, 1, 24, 132, 6785 }, // Đ
+    { 20, 27, 21, 1, 26, 135, 6917 }, // đ
+    { 14, 29, 19, 3, 29, 102, 7052 }, // Ē
+    { 17, 24, 19, 1, 23, 102, 7154 }, // ē
+    { 14, 31, 19, 3, 31, 109, 7256 }, // Ĕ
+    { 17, 26, 19, 1, 25, 111, 7365 }, // ĕ
+    { 14, 31, 19, 3, 31, 109, 7476 }, // Ė
+    { 17, 26, 19, 1, 25, 111, 7585 }, // ė
+    { 14, 32, 19, 3, 24, 112, 7696 }, // Ę
+    { 17, 27, 19, 1, 19, 115, 7808 }, // ę
+    { 14, 32, 19, 3, 32, 112, 7923 }, // Ě
+    { 17, 27, 19, 1, 26, 115, 8035 }, // ě
+    { 20, 33, 24, 2, 32, 165, 8150 }, // Ĝ
+    { 17, 34, 21, 1, 26, 145, 8315 }, // ĝ
+    { 20, 32, 24, 2, 31, 160, 8460 }, // Ğ
+    { 17, 33, 21, 1, 25, 141, 8620 }, // ğ
+    { 20, 32, 24, 2, 31, 160, 8761 }, // Ġ
+    { 17, 33, 21, 1, 25, 141, 8921 }, // ġ
+    { 20, 33, 24, 2, 25, 165, 9062 }, // Ģ
+    { 17, 34, 21, 1, 26, 145, 9227 }, // ģ
+    { 19, 32, 25, 3, 32, 152, 9372 }, // Ĥ
+    { 20, 33, 21, -2, 33, 165, 9524 }, // ĥ
+    { 25, 24, 25, 0, 24, 150, 9689 }, // Ħ
+    { 18, 26, 21, 0, 26, 117, 9839 }, // ħ
+    { 13, 31, 11, -1, 31, 101, 9956 }, // Ĩ
+    { 13, 25, 9, -2, 25, 82, 10057 }, // ĩ
+    { 11, 29, 11, 0, 29, 80, 10139 }, // Ī
+    { 11, 23, 9, -1, 23, 64, 10219 }, // ī
+    { 11, 31, 11, 0, 31, 86, 10283 }, // Ĭ
+    { 11, 25, 9, -1, 25, 69, 10369 }, // ĭ
+    { 9, 32, 11, 1, 24, 72, 10438 }, // Į
+    { 7, 33, 9, 0, 25, 58, 10510 }, // į
+    { 9, 31, 11, 1, 31, 70, 10568 }, // İ
+    { 4, 18, 9, 2, 18, 18, 10638 }, // ı
+    { 17, 31, 20, 1, 24, 132, 10656 }, // Ĳ
+    { 13, 33, 17, 2, 25, 108, 10788 }, // ĳ
+    { 14, 39, 9, -3, 32, 137, 10896 }, // Ĵ
+    { 12, 34, 9, -2, 26, 102, 11033 }, // ĵ
+    { 18, 32, 21, 3, 24, 144, 11135 }, // Ķ
+    { 16, 34, 18, 2, 26, 136, 11279 }, // ķ
+    { 16, 18, 18, 2, 18, 72, 11415 }, // ĸ
+    { 15, 32, 17, 2, 32, 120, 11487 }, // Ĺ
+    { 8, 33, 9, 2, 33, 66, 11607 }, // ĺ
+    { 14, 32, 17, 3, 24, 112, 11673 }, // Ļ
+    { 5, 34, 9, 2, 26, 43, 11785 }, // ļ
+    { 14, 24, 17, 3, 24, 84, 11828 }, // Ľ
+    { 10, 26, 9, 2, 26, 65, 11912 }, // ľ
+    { 14, 24, 17, 3, 24, 84, 11977 }, // Ŀ
+    { 9, 26, 9, 2, 26, 59, 12061 }, // ŀ
+    { 17, 24, 17, 0, 24, 102, 12120 }, // Ł
+    { 10, 26, 9, -1, 26, 65, 12222 }, // ł
+    { 20, 32, 25, 3, 32, 160, 12287 }, // Ń
+    { 16, 26, 21, 2, 26, 104, 12447 }, // ń
+    { 20, 32, 25, 3, 24, 160, 12551 }, // Ņ
+    { 16, 27, 21, 2, 19, 108, 12711 }, // ņ
+    { 20, 32, 25, 3, 32, 160, 12819 }, // Ň
+    { 16, 26, 21, 2, 26, 104, 12979 }, // ň
+    { 21, 24, 23, 0, 24, 126, 13083 }, // ŉ
+    { 20, 31, 25, 3, 24, 155, 13209 }, // Ŋ
+    { 16, 27, 21, 2, 19, 108, 13364 }, // ŋ
+    { 22, 30, 26, 2, 29, 165, 13472 }, // Ō
+    { 18, 24, 20, 1, 23, 108, 13637 }, // ō
+    { 22, 32, 26, 2, 31, 176, 13745 }, // Ŏ
+    { 18, 26, 20, 1, 25, 117, 13921 }, // ŏ
+    { 22, 33, 26, 2, 32, 182, 14038 }, // Ő
+    { 18, 27, 20, 1, 26, 122, 14220 }, // ő
+    { 27, 26, 31, 2, 25, 176, 13779 }, // Œ
+    { 29, 20, 32, 1, 19, 145, 13955 }, // œ
+    { 18, 32, 21, 3, 32, 144, 14342 }, // Ŕ
+    { 12, 26, 14, 2, 26, 78, 14486 }, // ŕ
+    { 18, 32, 21, 3, 24, 144, 14564 }, // Ŗ
+    { 12, 27, 14, 2, 19, 81, 14708 }, // ŗ
+    { 18, 32, 21, 3, 32, 144, 14789 }, // Ř
+    { 12, 26, 14, 2, 26, 78, 14933 }, // ř
+    { 16, 33, 18, 1, 32, 132, 15011 }, // Ś
+    { 14, 27, 16, 1, 26, 95, 15143 }, // ś
+    { 16, 33, 18, 1, 32, 132, 15238 }, // Ŝ
+    { 14, 27, 16, 1, 26, 95, 15370 }, // ŝ
+    { 16, 33, 18, 1, 25, 132, 15465 }, // Ş
+    { 14, 27, 16, 1, 19, 95, 15597 }, // ş
+    { 16, 33, 18, 1, 32, 132, 15692 }, // Š
+    { 14, 27, 16, 1, 26, 95, 15824 }, // š
+    { 19, 32, 19, 0, 24, 152, 15919 }, // Ţ
+    { 12, 30, 12, 0, 22, 90, 16071 }, // ţ
+    { 19, 32, 19, 0, 32, 152, 16161 }, // Ť
+    { 16, 27, 12, 0, 26, 108, 16313 }, // ť
+    { 19, 24, 19, 0, 24, 114, 16421 }, // Ŧ
+    { 12, 23, 12, 0, 22, 69, 16535 }, // ŧ
+    { 19, 32, 24, 3, 31, 152, 16604 }, // Ũ
+    { 16, 26, 21, 2, 25, 104, 16756 }, // ũ
+    { 19, 30, 24, 3, 29, 143, 16860 }, // Ū
+    { 16, 24, 21, 2, 23, 96, 17003 }, // ū
+    { 19, 32, 24, 3, 31, 152, 17099 }, // Ŭ
+    { 16, 26, 21, 2, 25, 104, 17251 }, // ŭ
+    { 19, 35, 24, 3, 34, 167, 17355 }, // Ů
+    { 16, 29, 21, 2, 28, 116, 17522 }, // ů
+    { 19, 33, 24, 3, 32, 157, 17638 }, // Ű
+    { 16, 27, 21, 2, 26, 108, 17795 }, // ű
+    { 19, 32, 24, 3, 24, 152, 17903 }, // Ų
+    { 17, 26, 21, 2, 18, 111, 18055 }, // ų
+    { 31, 32, 31, 0, 32, 248, 18166 }, // Ŵ
+    { 26, 26, 26, 0, 26, 169, 18414 }, // ŵ
+    { 19, 32, 19, 0, 32, 152, 18583 }, // Ŷ
+    { 17, 34, 17, 0, 26, 145, 18735 }, // ŷ
+    { 19, 31, 19, 0, 31, 148, 18880 }, // Ÿ
+    { 17, 32, 19, 1, 32, 136, 19028 }, // Ź
+    { 14, 26, 16, 1, 26, 91, 19164 }, // ź
+    { 17, 31, 19, 1, 31, 132, 19255 }, // Ż
+    { 14, 25, 16, 1, 25, 88, 19387 }, // ż
+    { 17, 32, 19, 1, 32, 136, 19475 }, // Ž
+    { 14, 26, 16, 1, 26, 91, 19611 }, // ž
+    { 11, 26, 11, 2, 26, 72, 19702 }, // ſ
+    { 8, 6, 0, -17, 26, 12, 19774 }, // ̀
+    { 7, 6, 0, -11, 26, 11, 19786 }, // ́
+    { 12, 6, 0, -6, 26, 18, 19797 }, // ̂
+    { 13, 5, 0, -17, 25, 17, 19815 }, // ̃
+    { 10, 3, 0, -5, 23, 8, 19832 }, // ̄
+    { 14, 4, 0, -7, 29, 14, 19840 }, // ̅
+    { 12, 5, 0, -6, 25, 15, 19854 }, // ̆
+    { 4, 5, 0, -2, 25, 5, 19869 }, // ̇
+    { 10, 4, 0, -5, 25, 10, 19874 }, // ̈
+    { 7, 9, 0, -13, 28, 16, 19884 }, // ̉
+    { 8, 8, 0, -4, 28, 16, 19900 }, // ̊
+    { 13, 6, 0, -5, 26, 20, 19916 }, // ̋
+    { 12, 6, 0, -6, 26, 18, 19936 }, // ̌
+    { 4, 7, 0, -2, 26, 7, 19954 }, // ̍
+    { 8, 7, 0, -4, 26, 14, 19961 }, // ̎
+    { 13, 6, 0, -18, 26, 20, 19975 }, // ̏
+    { 12, 9, 0, -6, 29, 27, 19995 }, // ̐
+    { 12, 5, 0, -6, 25, 15, 20022 }, // ̑
+    { 6, 9, 0, -3, 24, 14, 20037 }, // ̒
+    { 6, 9, 0, -3, 24, 14, 20051 }, // ̓
+    { 6, 9, 0, -3, 24, 14, 20065 }, // ̔
+    { 6, 9, 0, -3, 24, 14, 20079 }, // ̕
+    { 8, 6, 0, -4, -1, 12, 20093 }, // ̖
+    { 8, 6, 0, -4, -1, 12, 20105 }, // ̗
+    { 6, 8, 0, -3, 0, 12, 20117 }, // ̘
+    { 6, 8, 0, -3, 0, 12, 20129 }, // ̙
+    { 10, 9, 10, 0, 26, 23, 20141 }, // ̚
+    { 8, 8, 0, -4, 26, 16, 20164 }, // ̛
+    { 4, 8, 0, -2, 0, 8, 20180 }, // ̜
+    { 8, 6, 0, -4, -1, 12, 20188 }, // ̝
+    { 8, 6, 0, -4, -1, 12, 20200 }, // ̞
+    { 8, 8, 0, -4, 0, 16, 20212 }, // ̟
+    { 8, 3, 0, -4, -2, 6, 20228 }, // ̠
+    { 6, 10, 0, -6, 2, 15, 20234 }, // ̡
+    { 6, 10, 0, 0, 2, 15, 20249 }, // ̢
+    { 4, 4, 0, -12, -2, 4, 20264 }, // ̣
+    { 10, 4, 0, -5, -2, 10, 20268 }, // ̤
+    { 8, 8, 0, -4, 0, 16, 20278 }, // ̥
+    { 6, 6, 0, -3, -2, 9, 20294 }, // ̦
+    { 8, 8, 0, -4, 0, 16, 20303 }, // ̧
+    { 6, 9, 0, -3, 1, 14, 20319 }, // ̨
+    { 4, 7, 0, -2, -1, 7, 20333 }, // ̩
+    { 12, 7, 0, -6, -1, 21, 20340 }, // ̪
+    { 14, 4, 0, -7, -2, 14, 20361 }, // ̫
+    { 12, 6, 0, -6, -1, 18, 20375 }, // ̬
+    { 12, 6, 0, -6, -1, 18, 20393 }, // ̭
+    { 12, 5, 0, -6, -1, 15, 20411 }, // ̮
+    { 12, 5, 0, -6, -1, 15, 20426 }, // ̯
+    { 14, 5, 0, -7, -1, 18, 20441 }, // ̰
+    { 10, 3, 0, -5, -2, 8, 20459 }, // ̱
+    { 16, 3, 0, -8, -3, 12, 20467 }, // ̲
+    { 14, 8, 0, -7, 0, 28, 20479 }, // ̳
+    { 13, 5, 0, -6, 12, 17, 20507 }, // ̴
+    { 14, 4, 0, -7, 12, 14, 20524 }, // ̵
+    { 24, 3, 0, -12, 11, 18, 20538 }, // ̶
+    { 10, 8, 0, -5, 14, 20, 20556 }, // ̷
+    { 14, 28, 0, -7, 26, 98, 20576 }, // ̸
+    { 4, 8, 0, -2, 0, 8, 20674 }, // ̹
+    { 12, 7, 0, -6, -1, 21, 20682 }, // ̺
+    { 14, 8, 0, -7, 0, 28, 20703 }, // ̻
+    { 14, 4, 0, -7, -2, 14, 20731 }, // ̼
+    { 8, 7, 0, -4, 26, 14, 20745 }, // ̽
+    { 6, 10, 0, -3, 29, 15, 20759 }, // ̾
+    { 14, 8, 0, -7, 33, 28, 20774 }, // ̿
+    { 8, 6, 0, -6, 26, 12, 20802 }, // ̀
+    { 8, 6, 0, -2, 26, 12, 20814 }, // ́
+    { 14, 5, 0, -7, 25, 18, 20826 }, // ͂
+    { 6, 6, 0, -3, 26, 9, 20844 }, // ̓
+    { 13, 6, 0, -6, 26, 20, 20853 }, // ̈́
+    { 6, 6, 0, -2, -2, 9, 20873 }, // ͅ
+    { 16, 7, 0, -8, 26, 28, 20882 }, // ͆
+    { 14, 8, 0, -7, 0, 28, 20910 }, // ͇
+    { 8, 7, 0, -4, -1, 14, 20938 }, // ͈
+    { 8, 6, 0, -4, -2, 12, 20952 }, // ͉
+    { 14, 8, 0, -7, 26, 28, 20964 }, // ͊
+    { 14, 12, 0, -7, 31, 42, 20992 }, // ͋
+    { 12, 9, 0, -6, 29, 27, 21034 }, // ͌
+    { 12, 7, 0, -6, -1, 21, 21061 }, // ͍
+    { 8, 8, 0, -4, 0, 16, 21082 }, // ͎
+    { 24, 24, 0, -12, 24, 144, 21098 }, // ͏
+    { 6, 8, 0, -3, 27, 12, 21242 }, // ͐
+    { 5, 8, 0, -2, 28, 10, 21254 }, // ͑
+    { 12, 8, 0, -6, 28, 24, 21264 }, // ͒
+    { 8, 7, 0, -4, -1, 14, 21288 }, // ͓
+    { 6, 7, 0, -3, -1, 11, 21302 }, // ͔
+    { 6, 7, 0, -3, -1, 11, 21313 }, // ͕
+    { 14, 7, 0, -7, -1, 25, 21324 }, // ͖
+    { 5, 8, 0, -2, 28, 10, 21349 }, // ͗
+    { 4, 5, 0, 4, 25, 5, 21359 }, // ͘
+    { 8, 7, 0, -4, -1, 14, 21364 }, // ͙
+    { 14, 8, 0, -7, 0, 28, 21378 }, // ͚
+    { 8, 8, 0, -4, 27, 16, 21406 }, // ͛
+    { 26, 7, 0, -13, -1, 46, 21422 }, // ͜
+    { 26, 7, 0, -13, 26, 46, 21468 }, // ͝
+    { 20, 3, 0, -10, 23, 15, 21514 }, // ͞
+    { 20, 3, 0, -10, -2, 15, 21529 }, // ͟
+    { 26, 5, 0, -13, 25, 33, 21544 }, // ͠
+    { 26, 8, 0, -13, 29, 52, 21577 }, // ͡
+    { 27, 7, 0, -13, -1, 48, 21629 }, // ͢
+    { 8, 8, 0, -4, 28, 16, 21677 }, // ͣ
+    { 8, 8, 0, -4, 28, 16, 21693 }, // ͤ
+    { 3, 11, 0, -1, 31, 9, 21709 }, // ͥ
+    { 9, 8, 0, -4, 28, 18, 21718 }, // ͦ
+    { 8, 8, 0, -4, 28, 16, 21736 }, // ͧ
+    { 7, 8, 0, -3, 28, 14, 21752 }, // ͨ
+    { 8, 11, 0, -4, 31, 22, 21766 }, // ͩ
+    { 8, 11, 0, -4, 31, 22, 21788 }, // ͪ
+    { 13, 8, 0, -6, 28, 26, 21810 }, // ͫ
+    { 6, 8, 0, -2, 28, 12, 21836 }, // ͬ
+    { 6, 10, 0, -3, 30, 15, 21848 }, // ͭ
+    { 9, 8, 0, -4, 28, 18, 21863 }, // ͮ
+    { 9, 8, 0, -4, 28, 18, 21881 }, // ͯ
+    { 14, 32, 19, 3, 32, 112, 21899 }, // Ѐ
+    { 14, 31, 19, 3, 31, 109, 0 }, // Ё
+    { 23, 25, 24, 0, 24, 144, 22011 }, // Ђ
+    { 14, 32, 17, 3, 32, 112, 22155 }, // Ѓ
+    { 18, 26, 21, 2, 25, 117, 22267 }, // Є
+    { 16, 26, 18, 1, 25, 104, 22384 }, // Ѕ
+    { 4, 24, 9, 3, 24, 24, 22488 }, // І
+    { 9, 31, 9, 0, 31, 70, 22512 }, // Ї
+    { 10, 31, 9, -3, 24, 78, 22582 }, // Ј
+    { 32, 25, 34, 0, 24, 200, 22660 }, // Љ
+    { 30, 24, 34, 3, 24, 180, 22860 }, // Њ
+    { 22, 24, 24, 0, 24, 132, 23040 }, // Ћ
+    { 18, 32, 21, 3, 32, 144, 23172 }, // Ќ
+    { 19, 32, 25, 3, 32, 152, 23316 }, // Ѝ
+    { 21, 32, 21, 0, 31, 168, 23468 }, // Ў
+    { 19, 30, 24, 3, 24, 143, 23636 }, // Џ
+    { 22, 24, 21, 0, 24, 132, 109 }, // А
+    { 16, 24, 20, 3, 24, 96, 241 }, // Б
+    { 17, 24, 22, 3, 24, 102, 337 }, // В
+    { 14, 24, 17, 3, 24, 84, 439 }, // Г
+    { 24, 30, 24, 0, 24, 180, 523 }, // Д
+    { 14, 24, 19, 3, 24, 84, 703 }, // Е
+    { 31, 24, 30, 0, 24, 186, 787 }, // Ж
+    { 17, 26, 19, 1, 25, 111, 973 }, // З
+    { 19, 24, 25, 3, 24, 114, 1084 }, // И
+    { 19, 31, 25, 3, 31, 148, 1198 }, // Й
+    { 18, 24, 21, 3, 24, 108, 1346 }, // К
+    { 21, 25, 23, 0, 24, 132, 1454 }, // Л
+    { 24, 24, 30, 3, 24, 144, 1586 }, // М
+    { 19, 24, 25, 3, 24, 114, 1730 }, // Н
+    { 22, 26, 25, 2, 25, 143, 1844 }, // О
+    { 19, 24, 24, 3, 24, 114, 1987 }, // П
+    { 16, 24, 20, 3, 24, 96, 2101 }, // Р
+    { 18, 26, 21, 2, 25, 117, 2197 }, // С
+    { 19, 24, 19, 0, 24, 114, 2314 }, // Т
+    { 21, 25, 21, 0, 24, 132, 2428 }, // У
+    { 25, 26, 27, 1, 25, 163, 2560 }, // Ф
+    { 20, 24, 20, 0, 24, 120, 2723 }, // Х
+    { 22, 30, 25, 3, 24, 165, 2843 }, // Ц
+    { 18, 24, 22, 2, 24, 108, 3008 }, // Ч
+    { 29, 24, 35, 3, 24, 174, 3116 }, // Ш
+    { 31, 30, 34, 3, 24, 233, 3290 }, // Щ
+    { 22, 24, 23, 0, 24, 132, 3523 }, // Ъ
+    { 23, 24, 28, 3, 24, 138, 3655 }, // Ы
+    { 16, 24, 20, 3, 24, 96, 3793 }, // Ь
+    { 19, 26, 22, 1, 25, 124, 3889 }, // Э
+    { 29, 26, 33, 3, 25, 189, 4013 }, // Ю
+    { 18, 24, 21, 1, 24, 108, 4202 }, // Я
+    { 15, 20, 19, 1, 19, 75, 4310 }, // а
+    { 18, 27, 20, 1, 26, 122, 4385 }, // б
+    { 16, 18, 19, 2, 18, 72, 4507 }, // в
+    { 12, 18, 15, 2, 18, 54, 4579 }, // г
+    { 20, 23, 20, 0, 18, 115, 4633 }, // д
+    { 16, 20, 18, 1, 19, 80, 4748 }, // е
+    { 26, 18, 25, 0, 18, 117, 4828 }, // ж
+    { 14, 20, 16, 1, 19, 70, 4945 }, // з
+    { 16, 18, 21, 2, 18, 72, 5015 }, // и
+    { 16, 25, 21, 2, 25, 100, 5087 }, // й
+    { 16, 18, 18, 2, 18, 72, 5187 }, // к
+    { 17, 19, 20, 0, 18, 81, 5259 }, // л
+    { 21, 18, 26, 2, 18, 95, 5340 }, // м
+    { 16, 18, 20, 2, 18, 72, 5435 }, // н
+    { 18, 20, 20, 1, 19, 90, 5507 }, // о
+    { 16, 18, 20, 2, 18, 72, 5597 }, // п
+    { 17, 27, 20, 2, 19, 115, 5669 }, // р
+    { 15, 20, 16, 1, 19, 75, 5784 }, // с
+    { 15, 18, 16, 0, 18, 68, 5859 }, // т
+    { 17, 26, 17, 0, 18, 111, 5927 }, // у
+    { 22, 34, 25, 1, 26, 187, 6038 }, // ф
+    { 17, 18, 17, 0, 18, 77, 6225 }, // х
+    { 19, 23, 20, 2, 18, 110, 6302 }, // ц
+    { 15, 18, 20, 2, 18, 68, 6412 }, // ч
+    { 26, 18, 30, 2, 18, 117, 6480 }, // ш
+    { 28, 23, 30, 2, 18, 161, 6597 }, // щ
+    { 20, 18, 21, 0, 18, 90, 6758 }, // ъ
+    { 21, 18, 25, 2, 18, 95, 6848 }, // ы
+    { 15, 18, 18, 2, 18, 68, 6943 }, // ь
+    { 14, 20, 16, 1, 19, 70, 7011 }, // э
+    { 24, 20, 27, 2, 19, 120, 7081 }, // ю
+    { 16, 18, 19, 1, 18, 72, 7201 }, // я
+    { 16, 27, 18, 1, 26, 108, 23779 }, // ѐ
+    { 16, 26, 18, 1, 25, 104, 7273 }, // ё
+    { 18, 34, 21, 0, 26, 153, 23887 }, // ђ
+    { 12, 26, 15, 2, 26, 78, 24040 }, // ѓ
+    { 15, 20, 16, 1, 19, 75, 24118 }, // є
+    { 14, 20, 16, 1, 19, 70, 24193 }, // ѕ
+    { 5, 25, 9, 2, 25, 32, 24263 }, // і
+    { 8, 25, 9, 0, 25, 50, 24295 }, // ї
+    { 9, 33, 9, -2, 25, 75, 24345 }, // ј
+    { 28, 19, 29, 0, 18, 133, 24420 }, // љ
+    { 27, 18, 30, 2, 18, 122, 24553 }, // њ
+    { 18, 26, 21, 0, 26, 117, 24675 }, // ћ
+    { 16, 26, 18, 2, 26, 104, 24792 }, // ќ
+    { 16, 26, 21, 2, 26, 104, 24896 }, // ѝ
+    { 17, 33, 17, 0, 25, 141, 25000 }, // ў
+    { 16, 23, 20, 2, 18, 92, 25141 }, // џ
+    { 30, 25, 31, 0, 24, 188, 25233 }, // Ѡ
+    { 26, 18, 26, 0, 18, 117, 25421 }, // ѡ
+    { 21, 24, 23, 0, 24, 126, 25538 }, // Ѣ
+    { 20, 22, 21, 0, 22, 110, 25664 }, // ѣ
+    { 27, 26, 31, 3, 25, 176, 25774 }, // Ѥ
+    { 22, 20, 25, 2, 19, 110, 25950 }, // ѥ
+    { 23, 24, 23, 0, 24, 138, 26060 }, // Ѧ
+    { 19, 18, 19, 0, 18, 86, 26198 }, // ѧ
+    { 28, 24, 31, 3, 24, 168, 26284 }, // Ѩ
+    { 24, 18, 26, 2, 18, 108, 26452 }, // ѩ
+    { 24, 24, 24, 0, 24, 144, 26560 }, // Ѫ
+    { 22, 18, 21, 0, 18, 99, 26704 }, // ѫ
+    { 30, 24, 33, 3, 24, 180, 26803 }, // Ѭ
+    { 27, 18, 28, 2, 18, 122, 26983 }, // ѭ
+    { 17, 37, 20, 1, 29, 158, 27105 }, // Ѯ
+    { 15, 30, 16, 0, 23, 113, 27263 }, // ѯ
+    { 22, 24, 27, 3, 24, 132, 27376 }, // Ѱ
+    { 21, 34, 25, 2, 26, 179, 27508 }, // ѱ
+    { 22, 26, 26, 2, 25, 143, 27687 }, // Ѳ
+    { 18, 20, 20, 1, 19, 90, 27830 }, // ѳ
+    { 23, 24, 21, 0, 24, 138, 27920 }, // Ѵ
+    { 18, 19, 17, 0, 19, 86, 28058 }, // ѵ
+    { 23, 32, 21, 0, 32, 184, 28144 }, // Ѷ
+    { 18, 26, 17, 0, 26, 117, 28328 }, // ѷ
+    { 39, 33, 41, 2, 25, 322, 28445 }, // Ѹ
+    { 36, 27, 37, 1, 19, 243, 28767 }, // ѹ
+    { 24, 28, 27, 2, 26, 168, 29010 }, // Ѻ
+    { 20, 22, 22, 1, 20, 110, 29178 }, // ѻ
+    { 31, 36, 34, 2, 35, 279, 29288 }, // Ѽ
+    { 28, 31, 30, 1, 30, 217, 29567 }, // ѽ
+    { 30, 31, 31, 0, 30, 233, 29784 }, // Ѿ
+    { 26, 24, 26, 0, 24, 156, 30017 }, // ѿ
+    { 19, 33, 21, 2, 25, 157, 30173 }, // Ҁ
+    { 15, 27, 16, 1, 19, 102, 30330 }, // ҁ
+    { 18, 22, 20, 1, 21, 99, 30432 }, // ҂
+    { 13, 5, 0, -16, 24, 17, 30531 }, // ҃
+    { 13, 5, 0, -16, 25, 17, 30548 }, // ҄
+    { 5, 6, 0, -12, 26, 8, 30565 }, // ҅
+    { 5, 6, 0, -12, 26, 8, 30573 }, // ҆
+    { 13, 5, 0, -7, 30, 17, 30581 }, // ҇
+    { 38, 36, 0, -19, 27, 342, 30598 }, // ҈
+    { 38, 38, 0, -19, 28, 361, 30940 }, // ҉
+    { 23, 38, 26, 3, 31, 219, 31301 }, // Ҋ
+    { 20, 33, 22, 2, 26, 165, 31520 }, // ҋ
+    { 19, 24, 21, 0, 24, 114, 31685 }, // Ҍ
+    { 19, 26, 20, 0, 26, 124, 31799 }, // ҍ
+    { 16, 24, 20, 3, 24, 96, 31923 }, // Ҏ
+    { 17, 27, 21, 2, 19, 115, 32019 }, // ҏ
+    { 14, 29, 18, 3, 29, 102, 32134 }, // Ґ
+    { 12, 24, 15, 2, 24, 72, 32236 }, // ґ
+    { 17, 24, 18, 0, 24, 102, 32308 }, // Ғ
+    { 14, 18, 14, 0, 18, 63, 0 }, // ғ
+    { 18, 33, 22, 3, 24, 149, 63 }, // Ҕ
+    { 15, 27, 18, 2, 18, 102, 212 }, // ҕ
+    { 30, 31, 30, 0, 24, 233, 314 }, // Җ
+    { 26, 25, 27, 0, 18, 163, 547 }, // җ
+    { 17, 33, 19, 1, 25, 141, 710 }, // Ҙ
+    { 14, 27, 16, 1, 19, 95, 851 }, // ҙ
+    { 19, 31, 22, 3, 24, 148, 946 }, // Қ
+    { 17, 25, 19, 2, 18, 107, 1094 }, // қ
+    { 18, 24, 21, 3, 24, 108, 1201 }, // Ҝ
+    { 16, 18, 18, 2, 18, 72, 1309 }, // ҝ
+    { 21, 24, 21, 0, 24, 126, 1381 }, // Ҟ
+    { 18, 26, 18, 0, 26, 117, 1507 }, // ҟ
+    { 24, 24, 23, 0, 24, 144, 1624 }, // Ҡ
+    { 21, 18, 21, 0, 18, 95, 1768 }, // ҡ
+    { 22, 31, 25, 3, 24, 171, 1863 }, // Ң
+    { 20, 25, 22, 2, 18, 125, 2034 }, // ң
+    { 24, 24, 27, 3, 24, 144, 2159 }, // Ҥ
+    { 23, 18, 25, 2, 18, 104, 2303 }, // ҥ
+    { 31, 33, 35, 3, 24, 256, 2407 }, // Ҧ
+    { 26, 27, 29, 2, 18, 176, 2663 }, // ҧ
+    { 23, 27, 26, 2, 25, 156, 2839 }, // Ҩ
+    { 20, 20, 21, 1, 19, 100, 2995 }, // ҩ
+    { 19, 33, 21, 2, 25, 157, 3095 }, // Ҫ
+    { 14, 27, 16, 1, 19, 95, 3252 }, // ҫ
+    { 19, 31, 19, 0, 24, 148, 3347 }, // Ҭ
+    { 16, 25, 16, 0, 18, 100, 3495 }, // ҭ
+    { 19, 24, 19, 0, 24, 114, 3595 }, // Ү
+    { 17, 26, 17, 0, 18, 111, 3709 }, // ү
+    { 19, 24, 19, 0, 24, 114, 3820 }, // Ұ
+    { 17, 26, 17, 0, 18, 111, 3934 }, // ұ
+    { 21, 31, 21, 0, 24, 163, 4045 }, // Ҳ
+    { 18, 25, 18, 0, 18, 113, 4208 }, // ҳ
+    { 28, 31, 29, 0, 24, 217, 4321 }, // Ҵ
+    { 24, 25, 24, 0, 18, 150, 4538 }, // ҵ
+    { 21, 31, 23, 2, 24, 163, 4688 }, // Ҷ
+    { 19, 25, 21, 2, 18, 119, 4851 }, // ҷ
+    { 19, 24, 23, 2, 24, 114, 4970 }, // Ҹ
+    { 16, 18, 20, 2, 18, 72, 5084 }, // ҹ
+    { 18, 24, 23, 3, 24, 108, 5156 }, // Һ
+    { 16, 26, 21, 2, 26, 104, 5264 }, // һ
+    { 27, 26, 28, 0, 25, 176, 5368 }, // Ҽ
+    { 21, 20, 22, 0, 19, 105, 5544 }, // ҽ
+    { 27, 32, 28, 0, 25, 216, 5649 }, // Ҿ
+    { 21, 26, 22, 0, 19, 137, 5865 }, // ҿ
+    { 9, 24, 11, 1, 24, 54, 6002 }, // Ӏ
+    { 31, 31, 30, 0, 31, 241, 6056 }, // Ӂ
+    { 26, 25, 25, 0, 25, 163, 6297 }, // ӂ
+    { 19, 33, 23, 3, 24, 157, 6460 }, // Ӄ
+    { 16, 27, 19, 2, 18, 108, 6617 }, // ӄ
+    { 24, 31, 24, 0, 24, 186, 6725 }, // Ӆ
+    { 20, 25, 20, 0, 18, 125, 6911 }, // ӆ
+    { 19, 33, 24, 3, 24, 157, 7036 }, // Ӈ
+    { 17, 27, 21, 2, 18, 115, 7193 }, // ӈ
+    { 22, 31, 25, 3, 24, 171, 7308 }, // Ӊ
+    { 20, 25, 22, 2, 18, 125, 7479 }, // ӊ
+    { 19, 31, 23, 2, 24, 148, 7604 }, // Ӌ
+    { 16, 25, 20, 2, 18, 100, 7752 }, // ӌ
+    { 28, 31, 31, 3, 24, 217, 7852 }, // Ӎ
+    { 24, 25, 25, 2, 18, 150, 8069 }, // ӎ
+    { 9, 24, 11, 1, 24, 54, 8219 }, // ӏ
+    { 22, 31, 21, 0, 31, 171, 8273 }, // Ӑ
+    { 15, 26, 19, 1, 25, 98, 8444 }, // ӑ
+    { 22, 31, 21, 0, 31, 171, 8542 }, // Ӓ
+    { 15, 26, 19, 1, 25, 98, 8713 }, // ӓ
+    { 29, 24, 29, -1, 24, 174, 8811 }, // Ӕ
+    { 27, 20, 29, 1, 19, 135, 8985 }, // ӕ
+    { 14, 31, 19, 3, 31, 109, 9120 }, // Ӗ
+    { 17, 26, 19, 1, 25, 111, 9229 }, // ӗ
+    { 22, 26, 25, 1, 25, 143, 9340 }, // Ә
+    { 16, 20, 19, 1, 19, 80, 9483 }, // ә
+    { 22, 32, 25, 1, 31, 176, 9563 }, // Ӛ
+    { 16, 26, 19, 1, 25, 104, 9739 }, // ӛ
+    { 31, 31, 30, 0, 31, 241, 9843 }, // Ӝ
+    { 26, 25, 25, 0, 25, 163, 10084 }, // ӝ
+    { 17, 32, 19, 1, 31, 136, 10247 }, // Ӟ
+    { 14, 26, 16, 1, 25, 91, 10383 }, // ӟ
+    { 17, 25, 19, 1, 24, 107, 10474 }, // Ӡ
+    { 16, 26, 17, 0, 18, 104, 10581 }, // ӡ
+    { 19, 29, 25, 3, 29, 138, 10685 }, // Ӣ
+    { 16, 23, 21, 2, 23, 92, 10823 }, // ӣ
+    { 19, 31, 25, 3, 31, 148, 10915 }, // Ӥ
+    { 16, 25, 21, 2, 25, 100, 11063 }, // ӥ
+    { 22, 32, 26, 2, 31, 176, 11163 }, // Ӧ
+    { 18, 26, 20, 1, 25, 117, 11339 }, // ӧ
+    { 22, 26, 26, 2, 25, 143, 11456 }, // Ө
+    { 18, 20, 20, 1, 19, 90, 11599 }, // ө
+    { 22, 32, 26, 2, 31, 176, 11689 }, // Ӫ
+    { 18, 26, 20, 1, 25, 117, 11865 }, // ӫ
+    { 19, 32, 22, 1, 31, 152, 11982 }, // Ӭ
+    { 14, 26, 16, 1, 25, 91, 12134 }, // ӭ
+    { 21, 30, 21, 0, 29, 158, 12225 }, // Ӯ
+    { 17, 31, 17, 0, 23, 132, 12383 }, // ӯ
+    { 21, 32, 21, 0, 31, 168, 12515 }, // Ӱ
+    { 17, 33, 17, 0, 25, 141, 12683 }, // ӱ
+    { 21, 33, 21, 0, 32, 174, 12824 }, // Ӳ
+    { 17, 34, 17, 0, 26, 145, 12998 }, // ӳ
+    { 18, 31, 22, 2, 31, 140, 13143 }, // Ӵ
+    { 15, 25, 20, 2, 25, 94, 13283 }, // ӵ
+    { 14, 31, 18, 3, 24, 109, 13377 }, // Ӷ
+    { 12, 25, 14, 2, 18, 75, 13486 }, // ӷ
+    { 23, 31, 28, 3, 31, 179, 13561 }, // Ӹ
+    { 21, 25, 25, 2, 25, 132, 13740 }, // ӹ
+    { 17, 31, 18, 0, 24, 132, 13872 }, // Ӻ
+    { 14, 25, 14, 0, 18, 88, 14004 }, // ӻ
+    { 21, 31, 21, 0, 24, 163, 14092 }, // Ӽ
+    { 18, 25, 18, 0, 18, 113, 14255 }, // ӽ
+    { 20, 24, 20, 0, 24, 120, 14368 }, // Ӿ
+    { 18, 18, 18, 0, 18, 81, 14488 }, // ӿ
+    { 0, 0, 17, 0, 0, 0, 14569 }, //  
+    { 0, 0, 33, 0, 0, 0, 14569 }, //  
+    { 0, 0, 17, 0, 0, 0, 14569 }, //  
+    { 0, 0, 33, 0, 0, 0, 14569 }, //  
+    { 0, 0, 11, 0, 0, 0, 14569 }, //  
+    { 0, 0, 8, 0, 0, 0, 14569 }, //  
+    { 0, 0, 6, 0, 0, 0, 14569 }, //  
+    { 0, 0, 19, 0, 0, 0, 14569 }, //  
+    { 0, 0, 9, 0, 0, 0, 14569 }, //  
+    { 0, 0, 6, 0, 0, 0, 14569 }, //  
+    { 0, 0, 3, 0, 0, 0, 14569 }, //  
+    { 0, 0, 0, 0, 0, 0, 14569 }, // ​
+    { 0, 0, 0, 0, 0, 0, 14569 }, // ‌
+    { 0, 0, 0, 0, 0, 0, 14569 }, // ‍
+    { 9, 28, 0, -1, 23, 63, 14569 }, // ‎
+    { 9, 28, 0, -8, 23, 63, 14632 }, // ‏
+    { 9, 4, 11, 1, 11, 9, 14695 }, // ‐
+    { 9, 4, 11, 1, 11, 9, 14704 }, // ‑
+    { 17, 4, 19, 1, 14, 17, 14713 }, // ‒
+    { 15, 4, 17, 1, 11, 15, 14100 }, // –
+    { 31, 4, 33, 1, 11, 31, 14115 }, // —
+    { 31, 4, 33, 1, 11, 31, 14730 }, // ―
+    { 11, 35, 18, 4, 26, 97, 14761 }, // ‖
+    { 15, 8, 14, -1, 0, 30, 14858 }, // ‗
+    { 6, 9, 6, 0, 24, 14, 14146 }, // ‘
+    { 6, 9, 6, 0, 24, 14, 14160 }, // ’
+    { 6, 9, 8, 1, 4, 14, 14888 }, // ‚
+    { 6, 9, 6, 0, 24, 14, 14902 }, // ‛
+    { 12, 9, 12, 0, 24, 27, 14174 }, // “
+    { 12, 9, 12, 0, 24, 27, 14201 }, // ”
+    { 12, 9, 14, 1, 4, 27, 14916 }, // „
+    { 12, 9, 12, 0, 24, 27, 14943 }, // ‟
+    { 13, 26, 17, 2, 26, 85, 14970 }, // †
+    { 14, 26, 17, 2, 26, 91, 15055 }, // ‡
+    { 8, 9, 13, 2, 17, 18, 15146 }, // •
+    { 9, 11, 12, 2, 18, 25, 15164 }, // ‣
+    { 5, 6, 17, 6, 5, 8, 15189 }, // ․
+    { 14, 6, 18, 2, 5, 21, 15197 }, // ‥
+    { 22, 6, 26, 2, 5, 33, 14228 }, // …
+    { 5, 6, 9, 2, 11, 8, 15218 }, // ‧
+    { 0, 0, 20, 0, 0, 0, 15226 }, //  
+    { 0, 0, 20, 0, 0, 0, 15226 }, //  
+    { 9, 26, 0, -1, 21, 59, 15226 }, // ‪
+    { 9, 26, 0, -8, 21, 59, 15285 }, // ‫
+    { 8, 28, 0, -4, 23, 56, 15344 }, // ‬
+    { 8, 28, 0, -4, 23, 56, 15400 }, // ‭
+    { 8, 28, 0, -4, 23, 56, 15456 }, // ‮
+    { 0, 0, 6, 0, 0, 0, 15512 }, //  
+    { 37, 26, 39, 1, 25, 241, 15512 }, // ‰
+    { 49, 26, 51, 1, 25, 319, 15753 }, // ‱
+    { 8, 9, 8, 1, 24, 18, 16072 }, // ′
+    { 14, 9, 14, 1, 24, 32, 16090 }, // ″
+    { 20, 9, 19, 1, 24, 45, 16122 }, // ‴
+    { 8, 9, 8, -1, 24, 18, 16167 }, // ‵
+    { 13, 9, 15, -1, 24, 30, 16185 }, // ‶
+    { 19, 9, 20, -1, 24, 43, 16215 }, // ‷
+    { 13, 11, 13, 0, 3, 36, 16258 }, // ‸
+    { 9, 15, 10, 1, 16, 34, 16294 }, // ‹
+    { 8, 15, 10, 1, 16, 30, 16328 }, // ›
+    { 26, 26, 28, 1, 25, 169, 16358 }, // ※
+    { 13, 25, 17, 2, 24, 82, 16527 }, // ‼
+    { 14, 26, 15, 0, 25, 91, 16609 }, // ‽
+    { 18, 3, 17, -1, 28, 14, 16700 }, // ‾
+    { 20, 7, 20, 0, -1, 35, 16714 }, // ‿
+    { 20, 8, 20, 0, 27, 40, 16749 }, // ⁀
+    { 12, 22, 12, 0, 14, 66, 16789 }, // ⁁
+    { 37, 31, 37, 0, 26, 287, 16855 }, // ⁂
+    { 9, 4, 11, 1, 11, 9, 17142 }, // ⁃
+    { 18, 24, 4, -7, 24, 108, 17151 }, // ⁄
+    { 8, 30, 11, 2, 24, 60, 17259 }, // ⁅
+    { 9, 30, 11, 0, 24, 68, 17319 }, // ⁆
+    { 28, 26, 29, 0, 25, 182, 17387 }, // ⁇
+    { 21, 26, 23, 0, 25, 137, 17569 }, // ⁈
+    { 20, 26, 23, 2, 25, 130, 17706 }, // ⁉
+    { 17, 18, 19, 1, 18, 77, 17836 }, // ⁊
+    { 17, 31, 22, 3, 26, 132, 17913 }, // ⁋
+    { 18, 17, 21, 1, 18, 77, 18045 }, // ⁌
+    { 18, 17, 21, 2, 18, 77, 18122 }, // ⁍
+    { 16, 16, 18, 1, 9, 64, 18199 }, // ⁎
+    { 6, 24, 8, 1, 19, 36, 18263 }, // ⁏
+    { 20, 35, 20, 0, 27, 175, 18299 }, // ⁐
+    { 16, 33, 18, 1, 26, 132, 18474 }, // ⁑
+    { 13, 26, 12, 0, 25, 85, 18606 }, // ⁒
+    { 29, 6, 33, 2, 13, 44, 18691 }, // ⁓
+    { 20, 8, 20, 0, 0, 40, 18735 }, // ⁔
+    { 18, 18, 19, 0, 17, 81, 18775 }, // ⁕
+    { 15, 26, 17, 1, 25, 98, 18856 }, // ⁖
+    { 25, 9, 25, 1, 24, 57, 18954 }, // ⁗
+    { 25, 26, 27, 1, 25, 163, 19011 }, // ⁘
+    { 25, 26, 28, 1, 25, 163, 19174 }, // ⁙
+    { 5, 26, 7, 1, 25, 33, 19337 }, // ⁚
+    { 20, 26, 22, 1, 25, 130, 19370 }, // ⁛
+    { 25, 26, 27, 1, 25, 163, 19500 }, // ⁜
+    { 5, 25, 9, 2, 24, 32, 19663 }, // ⁝
+    { 5, 26, 9, 2, 25, 33, 19695 }, // ⁞
+    { 0, 0, 7, 0, 0, 0, 19728 }, //  
+    { 0, 0, 20, 0, 0, 0, 19728 }, // ⁠
+    { 0, 0, 20, 0, 0, 0, 19728 }, // ⁡
+    { 0, 0, 20, 0, 0, 0, 19728 }, // ⁢
+    { 0, 0, 20, 0, 0, 0, 19728 }, // ⁣
+    { 0, 0, 20, 0, 0, 0, 19728 }, // ⁤
+    { 0, 0, 0, 0, 0, 0, 19728 }, // ⁦
+    { 0, 0, 0, 0, 0, 0, 19728 }, // ⁧
+    { 0, 0, 0, 0, 0, 0, 19728 }, // ⁨
+    { 0, 0, 0, 0, 0, 0, 19728 }, // ⁩
+    { 8, 28, 0, -4, 23, 56, 19728 }, // ⁪
+    { 8, 28, 0, -4, 23, 56, 19784 }, // ⁫
+    { 8, 28, 0, -4, 23, 56, 19840 }, // ⁬
+    { 8, 29, 0, -4, 24, 58, 19896 }, // ⁭
+    { 8, 28, 0, -4, 23, 56, 19954 }, // ⁮
+    { 8, 28, 0, -4, 23, 56, 20010 }, // ⁯
+    { 11, 16, 12, 0, 29, 44, 20066 }, // ⁰
+    { 3, 16, 6, 1, 25, 12, 20110 }, // ⁱ
+    { 12, 16, 12, 0, 29, 48, 20122 }, // ⁴
+    { 10, 16, 12, 1, 29, 40, 20170 }, // ⁵
+    { 12, 16, 12, 0, 29, 48, 20210 }, // ⁶
+    { 11, 16, 12, 0, 29, 44, 20258 }, // ⁷
+    { 11, 16, 12, 0, 29, 44, 20302 }, // ⁸
+    { 11, 16, 12, 0, 29, 44, 20346 }, // ⁹
+    { 10, 10, 11, 1, 25, 25, 20390 }, // ⁺
+    { 10, 3, 11, 1, 21, 8, 20415 }, // ⁻
+    { 10, 6, 11, 1, 23, 15, 20423 }, // ⁼
+    { 6, 19, 8, 2, 31, 29, 20438 }, // ⁽
+    { 6, 19, 8, 0, 31, 29, 20467 }, // ⁾
+    { 11, 12, 13, 1, 21, 33, 20496 }, // ⁿ
+    { 11, 16, 12, 0, 11, 44, 20529 }, // ₀
+    { 7, 16, 12, 1, 11, 28, 20573 }, // ₁
+    { 11, 16, 12, 0, 11, 44, 20601 }, // ₂
+    { 11, 16, 12, 0, 11, 44, 20645 }, // ₃
+    { 12, 16, 12, 0, 11, 48, 20689 }, // ₄
+    { 10, 16, 12, 1, 11, 40, 20737 }, // ₅
+    { 12, 16, 12, 0, 11, 48, 20777 }, // ₆
+    { 11, 16, 12, 0, 11, 44, 20825 }, // ₇
+    { 11, 16, 12, 0, 11, 44, 20869 }, // ₈
+    { 11, 16, 12, 0, 11, 44, 20913 }, // ₉
+    { 10, 10, 11, 1, 7, 25, 20957 }, // ₊
+    { 10, 3, 11, 1, 3, 8, 20982 }, // ₋
+    { 10, 6, 11, 1, 5, 15, 20990 }, // ₌
+    { 6, 19, 8, 2, 13, 29, 21005 }, // ₍
+    { 6, 19, 8, 0, 13, 29, 21034 }, // ₎
+    { 10, 12, 12, 1, 8, 30, 21063 }, // ₐ
+    { 11, 12, 12, 1, 8, 33, 21093 }, // ₑ
+    { 11, 12, 13, 1, 8, 33, 21126 }, // ₒ
+    { 12, 12, 11, 0, 8, 36, 21159 }, // ₓ
+    { 11, 12, 12, 1, 8, 33, 21195 }, // ₔ
+    { 11, 16, 13, 1, 12, 44, 21228 }, // ₕ
+    { 11, 16, 12, 1, 12, 44, 21272 }, // ₖ
+    { 3, 16, 6, 1, 12, 12, 21316 }, // ₗ
+    { 18, 12, 20, 1, 8, 54, 21328 }, // ₘ
+    { 11, 12, 13, 1, 8, 33, 21382 }, // ₙ
+    { 12, 16, 13, 1, 8, 48, 21415 }, // ₚ
+    { 9, 12, 10, 1, 8, 27, 21463 }, // ₛ
+    { 8, 14, 8, 0, 10, 28, 21490 }, // ₜ
+    { 17, 25, 19, 1, 25, 107, 21518 }, // ₠
+    { 18, 28, 19, 1, 26, 126, 21625 }, // ₡
+    { 17, 26, 19, 1, 25, 111, 21751 }, // ₢
+    { 17, 24, 19, 1, 24, 102, 21862 }, // ₣
+    { 17, 25, 19, 1, 25, 107, 21964 }, // ₤
+    { 27, 27, 31, 2, 23, 183, 22071 }, // ₥
+    { 19, 24, 19, 0, 24, 114, 22254 }, // ₦
+    { 23, 25, 26, 2, 24, 144, 22368 }, // ₧
+    { 25, 25, 28, 2, 24, 157, 22512 }, // ₨
+    { 22, 24, 22, 0, 24, 132, 22669 }, // ₩
+    { 22, 24, 27, 2, 24, 132, 22801 }, // ₪
+    { 20, 32, 21, 1, 26, 160, 22933 }, // ₫
+    { 19, 26, 19, 0, 25, 124, 23093 }, // €
+    { 20, 24, 19, 0, 24, 120, 23217 }, // ₭
+    { 19, 24, 19, 0, 24, 114, 23337 }, // ₮
+    { 32, 33, 32, 0, 25, 264, 23451 }, // ₯
+    { 18, 33, 19, 0, 25, 149, 23715 }, // ₰
+    { 19, 24, 19, 0, 24, 114, 23864 }, // ₱
+    { 20, 29, 24, 2, 26, 145, 23978 }, // ₲
+    { 21, 24, 20, 0, 24, 126, 24123 }, // ₳
+    { 18, 26, 18, 0, 25, 117, 24249 }, // ₴
+    { 19, 29, 21, 2, 26, 138, 24366 }, // ₵
+    { 20, 23, 21, 0, 22, 115, 24504 }, // ₶
+    { 23, 28, 24, 0, 25, 161, 24619 }, // ₷
+    { 18, 24, 18, 0, 24, 108, 24780 }, // ₸
+    { 15, 24, 19, 2, 24, 90, 24888 }, // ₹
+    { 19, 25, 19, 0, 24, 119, 24978 }, // ₺
+    { 26, 26, 26, 0, 25, 169, 25097 }, // ₻
+    { 24, 24, 27, 1, 24, 144, 25266 }, // ₼
+    { 19, 24, 19, 0, 24, 114, 25410 }, // ₽
+    { 22, 26, 26, 2, 26, 143, 25524 }, // ₾
+    { 15, 32, 19, 3, 28, 120, 25667 }, // ₿
+    { 14, 24, 16, 1, 19, 84, 25787 }, // ⃀
+    { 17, 3, 19, 1, 13, 13, 25871 }, // −
+    { 25, 26, 23, 0, 26, 163, 25884 }, // ﬀ
+    { 18, 26, 20, 0, 26, 117, 26047 }, // ﬁ
+    { 18, 26, 20, 0, 26, 117, 26164 }, // ﬂ
+    { 29, 26, 32, 0, 26, 189, 26281 }, // ﬃ
+    { 29, 26, 32, 0, 26, 189, 26470 }, // ﬄ
+    { 20, 27, 22, 2, 26, 135, 26659 }, // ﬅ
+    { 27, 27, 28, 1, 26, 183, 26794 }, // ﬆ
+    { 31, 32, 33, 1, 26, 248, 26977 }, // �
 };
 
 static const EpdUnicodeInterval notosans_16_regularIntervals[] = {
@@ -2898,31 +2909,296 @@ static const EpdUnicodeInterval notosans_16_regularIntervals[] = {
     { 0x2090, 0x209C, 0x33D },
     { 0x20A0, 0x20C0, 0x34A },
     { 0x2212, 0x2212, 0x36B },
-    { 0xFFFD, 0xFFFD, 0x36C },
+    { 0xFB00, 0xFB06, 0x36C },
+    { 0xFFFD, 0xFFFD, 0x373 },
 };
 
 static const EpdFontGroup notosans_16_regularGroups[] = {
-    { 0, 3873, 8327, 97, 0 },
-    { 3873, 3908, 10112, 96, 97 },
-    { 7781, 5068, 15435, 128, 193 },
-    { 12849, 1318, 2125, 112, 321 },
-    { 14167, 11905, 32457, 256, 433 },
-    { 26072, 2557, 5658, 111, 689 },
-    { 28629, 708, 1452, 42, 800 },
-    { 29337, 2389, 4353, 33, 842 },
-    { 31726, 14, 13, 1, 875 },
-    { 31740, 125, 248, 1, 876 },
+    { 0, 5275, 14261, 151, 2 },
+    { 5275, 3134, 7377, 66, 434 },
+    { 8409, 12269, 32410, 370, 0 },
+    { 20678, 11257, 27225, 297, 580 },
+};
+
+static const uint8_t notosans_16_regularGlyphGroups[884] = {
+    2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2,
+    2, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 2, 2,
+    2, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 0, 0, 3, 3, 3, 0, 0, 3, 3, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+};
+
+static const uint8_t notosans_16_regularKernLeftClasses[884] = {
+    0, 0, 0, 0, 2, 0, 0, 0, 64, 2, 28, 0, 0, 0, 4, 37,
+    4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 0, 0, 0,
+    0, 0, 0, 11, 0, 41, 18, 33, 59, 0, 0, 0, 0, 41, 21, 0,
+    0, 18, 40, 18, 0, 0, 12, 42, 35, 35, 41, 15, 66, 28, 0, 0,
+    0, 69, 0, 0, 32, 62, 0, 32, 49, 0, 0, 0, 0, 0, 0, 0,
+    0, 32, 32, 0, 24, 0, 62, 0, 36, 36, 70, 36, 0, 28, 0, 0,
+    0, 0, 65, 0, 0, 0, 0, 0, 0, 0, 0, 0, 55, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 31, 0, 0, 0,
+    56, 11, 11, 11, 11, 11, 11, 33, 41, 33, 33, 33, 33, 0, 0, 0,
+    0, 18, 0, 18, 18, 18, 18, 18, 0, 18, 42, 42, 42, 42, 15, 40,
+    0, 0, 0, 0, 0, 0, 0, 32, 0, 32, 32, 32, 32, 0, 0, 57,
+    57, 32, 0, 32, 32, 32, 32, 32, 0, 32, 0, 0, 0, 0, 36, 32,
+    36, 11, 0, 11, 0, 45, 0, 41, 0, 41, 0, 41, 0, 41, 0, 18,
+    26, 18, 0, 33, 32, 33, 32, 33, 32, 33, 32, 33, 32, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 58, 0, 57, 0, 0, 33,
+    0, 0, 0, 0, 0, 0, 0, 41, 0, 70, 21, 0, 21, 0, 21, 26,
+    21, 0, 21, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 32, 18,
+    32, 18, 32, 33, 32, 0, 24, 0, 24, 0, 24, 0, 0, 0, 0, 0,
+    0, 0, 0, 12, 62, 12, 43, 12, 62, 42, 0, 42, 0, 42, 0, 42,
+    0, 42, 0, 42, 0, 35, 36, 15, 36, 15, 66, 0, 66, 0, 66, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 47, 47, 23, 16, 27, 42, 0, 0, 0, 19, 19, 23, 10, 0, 1,
+    0, 8, 0, 72, 16, 3, 47, 10, 72, 0, 0, 10, 0, 0, 0, 13,
+    0, 22, 27, 16, 1, 46, 10, 3, 0, 0, 3, 19, 0, 19, 13, 13,
+    0, 48, 60, 52, 30, 5, 7, 20, 52, 39, 39, 20, 39, 39, 39, 7,
+    39, 7, 51, 30, 14, 7, 20, 5, 39, 39, 5, 6, 39, 6, 7, 7,
+    39, 7, 7, 54, 30, 51, 67, 0, 68, 71, 6, 6, 61, 20, 39, 14,
+    39, 13, 50, 44, 6, 27, 51, 8, 38, 8, 38, 0, 0, 0, 0, 42,
+    0, 0, 7, 13, 7, 1, 50, 1, 50, 14, 14, 13, 7, 13, 7, 13,
+    50, 27, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 5, 44, 6, 22,
+    7, 9, 34, 17, 53, 0, 0, 29, 0, 42, 52, 29, 0, 10, 20, 10,
+    20, 10, 20, 3, 5, 17, 34, 0, 0, 0, 7, 27, 51, 9, 34, 25,
+    42, 25, 42, 29, 0, 3, 5, 3, 5, 0, 0, 0, 0, 39, 63, 39,
+    63, 0, 10, 20, 0, 0, 3, 5, 0, 0, 3, 5, 0, 0, 3, 5,
+    0, 8, 48, 8, 48, 47, 63, 47, 63, 13, 7, 13, 7, 10, 20, 42,
+    52, 0, 0, 0, 39, 0, 39, 13, 7, 13, 7, 13, 7, 13, 7, 1,
+    14, 1, 14, 1, 14, 0, 39, 9, 34, 0, 39, 17, 53, 29, 0, 10,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 37, 37, 37, 0, 0, 2, 2, 4, 0, 2, 2, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 55, 31, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 0, 0, 0,
+    0, 0, 0, 0,
+};
+
+static const uint8_t notosans_16_regularKernRightClasses[884] = {
+    0, 0, 0, 66, 6, 0, 0, 0, 51, 6, 0, 42, 0, 0, 2, 30,
+    2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 41, 41, 0, 0,
+    0, 55, 0, 7, 0, 3, 0, 0, 0, 3, 0, 0, 43, 0, 0, 0,
+    0, 3, 0, 3, 0, 0, 20, 47, 32, 32, 61, 24, 0, 0, 0, 42,
+    0, 0, 0, 16, 58, 1, 1, 1, 0, 29, 58, 0, 69, 58, 58, 11,
+    11, 1, 11, 1, 11, 11, 0, 11, 22, 22, 22, 22, 51, 0, 0, 42,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 25, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 0, 0, 0,
+    0, 7, 7, 7, 7, 7, 7, 59, 3, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 3, 3, 3, 3, 3, 0, 3, 47, 47, 47, 47, 24, 0,
+    0, 1, 16, 16, 16, 16, 16, 16, 1, 1, 1, 1, 1, 0, 0, 0,
+    0, 0, 0, 1, 1, 1, 1, 1, 0, 1, 11, 11, 11, 11, 22, 58,
+    22, 7, 16, 7, 16, 7, 16, 3, 1, 3, 1, 3, 1, 3, 1, 0,
+    1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 3, 29, 3,
+    29, 3, 29, 3, 29, 0, 58, 0, 68, 0, 62, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 58, 11, 0, 58, 0, 58, 0, 58,
+    0, 58, 0, 0, 0, 11, 0, 11, 0, 0, 0, 0, 11, 3, 1, 3,
+    1, 3, 1, 3, 1, 0, 11, 0, 11, 0, 0, 0, 11, 0, 0, 0,
+    11, 0, 0, 20, 0, 20, 0, 20, 0, 47, 11, 47, 11, 47, 11, 47,
+    11, 47, 11, 47, 11, 32, 22, 24, 22, 24, 0, 51, 0, 51, 0, 51,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4, 0, 34, 64, 0, 0, 33, 27, 0, 4, 0, 0, 13,
+    0, 9, 0, 0, 0, 40, 0, 14, 67, 0, 0, 0, 27, 0, 0, 34,
+    0, 0, 34, 4, 13, 50, 14, 0, 17, 0, 0, 4, 0, 0, 67, 0,
+    54, 5, 60, 41, 41, 18, 19, 10, 35, 41, 41, 41, 26, 41, 41, 19,
+    41, 41, 19, 21, 15, 19, 10, 41, 8, 41, 41, 21, 41, 41, 35, 41,
+    52, 19, 19, 31, 41, 19, 63, 0, 65, 45, 26, 41, 31, 41, 41, 15,
+    41, 12, 48, 56, 0, 0, 23, 9, 18, 0, 23, 0, 0, 0, 23, 67,
+    0, 17, 0, 12, 5, 53, 48, 53, 48, 12, 5, 12, 5, 12, 5, 12,
+    48, 12, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 23, 56, 31, 0,
+    23, 0, 23, 56, 0, 0, 23, 14, 10, 67, 35, 0, 23, 0, 23, 0,
+    31, 37, 21, 0, 23, 0, 23, 0, 23, 12, 5, 12, 5, 4, 21, 46,
+    57, 46, 57, 14, 10, 37, 21, 17, 8, 17, 8, 0, 23, 28, 39, 28,
+    39, 0, 14, 10, 0, 23, 44, 18, 0, 23, 0, 23, 17, 8, 0, 23,
+    0, 9, 38, 9, 38, 9, 38, 0, 5, 0, 38, 0, 38, 14, 10, 67,
+    35, 0, 0, 0, 41, 0, 41, 12, 5, 12, 5, 12, 5, 67, 35, 13,
+    15, 13, 15, 13, 15, 17, 8, 0, 23, 0, 41, 56, 0, 14, 10, 14,
+    10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 30, 30, 30, 0, 0, 36, 6, 2, 0, 36, 6, 2,
+    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 25, 49, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0,
+};
+
+static const int8_t notosans_16_regularKernMatrix[5110] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, -2, 1, 0, -1, -4, -1, 0, 0, 0, 0, 0, 0, 0, -3, -2, 0, 0, 0, 0, 0, -2, -2, -3, -1, 0, -1, 2, 0, 0, -1, -1, 0, 0, 0, -1, -3, 0, 0, 0, -2, 0, 0, 0, 0, -1, -1, 0, -2, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0,
+    0, -2, 0, 0, 1, -1, 0, -2, 0, -2, 0, -1, 0, 1, 1, 1, -1, 0, -2, 0, 1, 1, 0, 0, 0, 0, -2, -1, 0, -1, 0, 1, 1, 0, 0, 1, 0, 1, -1, 0, -2, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 2, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, -1, 1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, -2, 0, 0, 0, -2, 0, 0, 0, -2, -1, 0, 0, 0, -3, 0, 0, -2, -1, 0, 0, -2, 0, 0, 0, -2, 0, 0, 0, -2, 2, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, 0, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, 0, -3, 0, -1, 0, -1, 0, 0, -1, 0, -2, 0, -2, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, 0, -2, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 2, -1, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 1, -2, 0, 0, -2, -2, -1, 0, -1, 0, 0, -1, 0, 0, -2, 0, 0, -1, 0, -2, 0, -2, 0, -1, -2, 0, -1, 0, 0, 0, -1, -1, 0, 0, -3, -2, -2, 0, 0, 0, -2, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, -2, -1, 0, 0, 0, -2, 0, 0, 0, -2, 0, 0, 0, 0, -3, 0, 0, 0, 1, 0, -1, 0, 0, -2, 0, 0, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, 0, 0, 0, 0, 0, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, -2, -1, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 1, -1, 1, 0, -1, -2, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 1, -1, 0, 0, -2, -2, -1, 0, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, 1, 0, 0, 0, -1, 0, 1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, 0, -3, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -4, 0, 0, -1, 0, 0, 0, -2, 0, 0, 0, -1, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, 0, -2, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -5, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, -2, 0, 0, -1, -2, 0, 0, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, -2, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, -2, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -4, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const EpdLigaturePair notosans_16_regularLigatures[] = {
+    { 0x66, 0x66, 0xFB00 },
+    { 0x66, 0x69, 0xFB01 },
+    { 0x66, 0x6C, 0xFB02 },
+    { 0xFB00, 0x69, 0xFB03 },
+    { 0xFB00, 0x6C, 0xFB04 },
+};
+
+static const uint16_t notosans_16_regularGlyphLookup[368] = {
+    0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0001, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, 0x0010, 0x0011,
+    0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, 0x0020, 0x0021,
+    0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, 0x0030, 0x0031,
+    0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, 0x0040, 0x0041,
+    0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051,
+    0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, 0x0060, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070,
+    0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, 0x0080,
+    0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F, 0x0090,
+    0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F, 0x00A0,
+    0x00A1, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF, 0x00B0,
+    0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF, 0x00C0,
+    0x02B1, 0x02B2, 0x02B3, 0x02B4, 0x02B5, 0x02B6, 0x02B7, 0x02B8, 0x02B9, 0x02BA, 0x02BB, 0x02BC, 0x02BD, 0x02BE, 0x02BF, 0x02C0,
+    0x02C1, 0x02C2, 0x02C3, 0x02C4, 0x02C5, 0x02C6, 0x02C7, 0x02C8, 0x02C9, 0x02CA, 0x02CB, 0x02CC, 0x02CD, 0x02CE, 0x02CF, 0x02D0,
+    0x02D1, 0x02D2, 0x02D3, 0x02D4, 0x02D5, 0x02D6, 0x02D7, 0x02D8, 0x02D9, 0x02DA, 0x02DB, 0x02DC, 0x02DD, 0x02DE, 0x02DF, 0x02E0,
+    0x02E1, 0x02E2, 0x02E3, 0x02E4, 0x02E5, 0x02E6, 0x02E7, 0x02E8, 0x02E9, 0x02EA, 0x02EB, 0x02EC, 0x02ED, 0x02EE, 0x02EF, 0x02F0,
+    0x02F1, 0x02F2, 0x02F3, 0x02F4, 0x02F5, 0x02F6, 0x02F7, 0x02F8, 0x02F9, 0x02FA, 0x02FB, 0x02FC, 0x02FD, 0x02FE, 0x02FF, 0x0300,
+    0x0301, 0x0302, 0x0303, 0x0304, 0x0305, 0x0306, 0x0307, 0x0308, 0x0309, 0x030A, 0x030B, 0x030C, 0x030D, 0x030E, 0x030F, 0x0310,
+    0x0311, 0x0312, 0x0313, 0x0314, 0x0315, 0xFFFF, 0x0316, 0x0317, 0x0318, 0x0319, 0x031A, 0x031B, 0x031C, 0x031D, 0x031E, 0x031F,
 };
 
 static const EpdFontData notosans_16_regular = {
     notosans_16_regularBitmaps,
     notosans_16_regularGlyphs,
     notosans_16_regularIntervals,
-    15,
+    16,
     45,
     36,
     -10,
     true,
     notosans_16_regularGroups,
-    10,
+    4,
+    notosans_16_regularKernLeftClasses,
+    notosans_16_regularKernRightClasses,
+    notosans_16_regularKernMatrix,
+    70,
+    notosans_16_regularLigatures,
+    5,
+    0x4000000001ull,
+    notosans_16_regularGlyphLookup,
+    notosans_16_regularGlyphGroups,
+    false,
+    nullptr,
 };
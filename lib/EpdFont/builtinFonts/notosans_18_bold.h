@@ -3,2495 +3,2538 @@
  * name: notosans_18_bold
  * size: 18
  * mode: 2-bit  compressed: true
- * Command used: fontconvert.py notosans_18_bold 18 ../builtinFonts/source/NotoSans/NotoSans-Bold.ttf --2bit --compress
+ * Command used: fontconvert.py notosans_18_bold 18 ../builtinFonts/source/NotoSans/NotoSans-Bold.ttf --2bit --compress --frequency-corpus ../../../test/hyphenation_eval/resources/english_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/french_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/german_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/italian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/russian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/spanish_hyphenation_tests.txt
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t notosans_18_boldBitmaps[39718] = {
-    0xD5, 0x5A, 0xBF, 0x8F, 0xDD, 0x56, 0x76, 0xBE, 0x7C, 0x6F, 0x67, 0x1E, 0xB0, 0x0F, 0x09, 0x9B,
-    0x08, 0x08, 0x56, 0x08, 0xD8, 0x2B, 0x05, 0xFF, 0x82, 0x80, 0xDC, 0x15, 0x02, 0x17, 0x2E, 0x34,
-    0x85, 0xDE, 0x06, 0x58, 0x17, 0x5E, 0x20, 0xA9, 0x14, 0x24, 0xD3, 0x06, 0x29, 0x96, 0x5C, 0x6F,
-    0x91, 0xC2, 0x85, 0xB5, 0x40, 0x92, 0x62, 0x53, 0xD8, 0x01, 0x5C, 0x78, 0x47, 0x40, 0x94, 0x22,
-    0x45, 0x0A, 0x03, 0xA4, 0xAD, 0x04, 0x2A, 0x54, 0x88, 0x5E, 0x23, 0x70, 0xA1, 0x42, 0x4F, 0xB1,
-    0xBC, 0xBB, 0x91, 0x0B, 0x51, 0x12, 0xED, 0xE1, 0xCC, 0x90, 0x3C, 0xFB, 0x7D, 0xDF, 0x25, 0xDF,
-    0xCC, 0x48, 0xB2, 0x3C, 0x16, 0xD6, 0x45, 0x1E, 0xE6, 0x5D, 0xCE, 0x23, 0xEF, 0xCF, 0x73, 0xCF,
-    0xF9, 0xCE, 0x77, 0xCE, 0x65, 0xB1, 0x6F, 0x77, 0x6D, 0xB7, 0x2F, 0x1E, 0xDB, 0x2D, 0x8B, 0xBB,
-    0xEC, 0x91, 0xDD, 0xB4, 0xA8, 0xCB, 0x6A, 0xBB, 0x31, 0x84, 0x6D, 0xB2, 0xB6, 0x9F, 0x5E, 0x76,
-    0xF8, 0xFC, 0xED, 0xD2, 0x92, 0xDE, 0xF6, 0xED, 0x93, 0x21, 0xD8, 0x29, 0xD6, 0xC5, 0x9D, 0x61,
-    0x39, 0xE0, 0xF2, 0x49, 0xBF, 0xE8, 0xB3, 0x2A, 0xC3, 0xA5, 0x4B, 0xCA, 0xE4, 0x46, 0x37, 0x9F,
-    0x2E, 0xCE, 0x5D, 0xC8, 0xAF, 0xA4, 0xCE, 0x65, 0x79, 0x81, 0xC6, 0x45, 0x6A, 0x28, 0xCD, 0xA9,
-    0x0C, 0x06, 0x95, 0xBD, 0x73, 0xC1, 0x30, 0xEB, 0x5C, 0xF0, 0xC3, 0xE1, 0x2F, 0xFA, 0xCB, 0xA1,
-    0xE1, 0xD3, 0x9F, 0x2C, 0xB7, 0xAF, 0x0D, 0xD7, 0x0F, 0xDF, 0x73, 0x8B, 0x36, 0xAC, 0x9D, 0x5B,
-    0x36, 0x2C, 0xC3, 0x3A, 0x5A, 0x3B, 0x17, 0xD5, 0xF1, 0xDA, 0x25, 0xAC, 0x53, 0x9F, 0x2C, 0x2F,
-    0x14, 0x0F, 0x8A, 0x07, 0xEF, 0xB8, 0xA4, 0xCC, 0x72, 0x87, 0xB2, 0xD0, 0xE0, 0xB6, 0x19, 0xBC,
-    0x38, 0x39, 0xF8, 0xAC, 0xE7, 0x92, 0xFE, 0x08, 0xDF, 0x19, 0xBA, 0x75, 0xCB, 0x12, 0x73, 0x29,
-    0x7E, 0x89, 0x4A, 0x66, 0x55, 0x84, 0xCE, 0x3E, 0x62, 0x8F, 0x9C, 0x46, 0x9B, 0x74, 0xEF, 0x6F,
-    0x7F, 0x60, 0x1F, 0xD6, 0x6E, 0x61, 0xAF, 0x96, 0x2E, 0xB4, 0x5D, 0xF4, 0x6D, 0x58, 0x5D, 0x66,
-    0x2D, 0x0B, 0x4B, 0x5D, 0x6C, 0x56, 0xBA, 0x25, 0x1A, 0xBA, 0x99, 0xFE, 0x7B, 0x68, 0xB9, 0x8B,
-    0x23, 0x0C, 0xF6, 0x7E, 0xDC, 0xE7, 0xB3, 0xBA, 0xD8, 0x3F, 0x58, 0xDE, 0xB4, 0xB7, 0xB9, 0x22,
-    0x54, 0xB7, 0x7B, 0xF8, 0x0E, 0x01, 0xC6, 0xC9, 0xDD, 0x56, 0x86, 0x29, 0xBA, 0xF7, 0x4F, 0x4E,
-    0xE2, 0xE4, 0x27, 0x40, 0x8F, 0x58, 0x07, 0xC6, 0xC4, 0x48, 0x45, 0x89, 0x71, 0x30, 0x69, 0x8C,
-    0x97, 0x1C, 0x99, 0x9B, 0x63, 0x15, 0x59, 0x69, 0xE9, 0xA2, 0xE3, 0x23, 0xCB, 0x43, 0x54, 0xB1,
-    0xBC, 0x28, 0xA3, 0xDA, 0x5F, 0x93, 0xCA, 0x5F, 0xD1, 0x4C, 0x57, 0x34, 0x73, 0x45, 0x5E, 0xBC,
-    0x61, 0xC1, 0x65, 0xD6, 0xFF, 0x59, 0x1F, 0x59, 0x9E, 0x7C, 0x64, 0x61, 0x9B, 0xD9, 0x1A, 0xD2,
-    0x8B, 0x6A, 0xB3, 0x26, 0xB4, 0x2E, 0xB9, 0x67, 0x97, 0xBA, 0xB9, 0x35, 0xD9, 0x87, 0x36, 0xEF,
-    0xDD, 0x95, 0xD4, 0x2E, 0x0E, 0x1C, 0x69, 0x86, 0x5F, 0xBC, 0xA2, 0xEC, 0x67, 0xB8, 0x2E, 0x3B,
-    0x7F, 0x0D, 0x1B, 0x7F, 0x3F, 0x59, 0xCF, 0x07, 0xD4, 0xC7, 0x8C, 0x58, 0x93, 0x23, 0x06, 0xF6,
-    0x36, 0x36, 0x16, 0x32, 0x40, 0xBF, 0x8E, 0xB7, 0x12, 0x5B, 0xA3, 0x19, 0x9A, 0x62, 0xDD, 0xFA,
-    0xEC, 0x6C, 0xD6, 0xB9, 0x8D, 0x2A, 0x8E, 0x35, 0xB8, 0x3F, 0x68, 0x00, 0x19, 0x52, 0x92, 0x68,
-    0xE0, 0xE6, 0xD8, 0x88, 0x9A, 0x17, 0x97, 0x9C, 0xBA, 0x64, 0xBA, 0xE4, 0xAC, 0x12, 0xD8, 0x1D,
-    0x36, 0x60, 0x3B, 0xDF, 0x4B, 0xC7, 0x0B, 0x96, 0xE5, 0x56, 0x3B, 0xDA, 0x0F, 0xAB, 0xB1, 0x37,
-    0x4D, 0xA0, 0x7D, 0xED, 0x67, 0x56, 0x26, 0x43, 0x64, 0x17, 0xB1, 0xFA, 0x6E, 0x81, 0x96, 0x2E,
-    0xC3, 0x13, 0x1B, 0x70, 0x41, 0x93, 0xCE, 0x65, 0xAD, 0x8B, 0x30, 0x9B, 0xAC, 0xC7, 0x3C, 0x6B,
-    0xF4, 0xF5, 0x4F, 0x05, 0x7E, 0x51, 0x1F, 0x50, 0x65, 0xC9, 0x8B, 0xE5, 0x9C, 0xD9, 0x27, 0xE8,
-    0x3D, 0xB6, 0x83, 0x80, 0x1B, 0xB3, 0xE2, 0x70, 0xC5, 0xE7, 0x43, 0xF1, 0x9B, 0x1E, 0x56, 0x00,
-    0xD5, 0xC7, 0x1F, 0x04, 0x03, 0x19, 0x60, 0xB9, 0xD9, 0x1A, 0x93, 0x8D, 0x5A, 0x88, 0x7C, 0xBC,
-    0x56, 0xB8, 0x86, 0x1D, 0x04, 0x16, 0x58, 0xBE, 0xE8, 0x5D, 0x84, 0xB1, 0xAA, 0x00, 0xDB, 0xD8,
-    0xF3, 0x69, 0xB6, 0x76, 0xC6, 0x8A, 0x68, 0x88, 0x07, 0x58, 0xAA, 0x95, 0xA8, 0x86, 0x1B, 0x78,
-    0x8C, 0x46, 0xD8, 0xE3, 0xA8, 0x86, 0x6E, 0x53, 0xBA, 0x29, 0xEF, 0x0E, 0xBC, 0x1B, 0x8F, 0x35,
-    0x67, 0xE8, 0x45, 0x37, 0xF4, 0xCB, 0xF7, 0x12, 0xD7, 0x18, 0x79, 0x66, 0x9B, 0xBB, 0xA8, 0x80,
-    0xEA, 0x36, 0x4E, 0x46, 0xBF, 0x93, 0x1A, 0x43, 0xE0, 0x79, 0x46, 0xA1, 0xC3, 0x00, 0x38, 0x75,
-    0x48, 0xB1, 0x92, 0xB5, 0x42, 0xC8, 0x90, 0x66, 0xBA, 0xAC, 0x83, 0x57, 0x0E, 0xE2, 0x0F, 0x0D,
-    0x8A, 0x6E, 0x1D, 0x34, 0xD7, 0x9E, 0x50, 0x12, 0xE5, 0x96, 0x1D, 0xA4, 0x92, 0x93, 0xA4, 0x3D,
-    0x1F, 0xB2, 0x0A, 0xBD, 0x71, 0xCA, 0x3F, 0x45, 0xD1, 0xCF, 0x21, 0x9B, 0x7F, 0x5F, 0x6C, 0x36,
-    0x99, 0x10, 0xB2, 0xC0, 0x2D, 0x47, 0x03, 0x76, 0xB4, 0x50, 0x19, 0xE2, 0x89, 0x5B, 0x25, 0xAD,
-    0xC9, 0x7A, 0x76, 0xBD, 0xCF, 0xE2, 0xAE, 0xA4, 0xFE, 0x74, 0xAD, 0x67, 0x1A, 0x6E, 0x5D, 0x0E,
-    0xFB, 0xA8, 0x8B, 0xDA, 0xB8, 0x49, 0xEA, 0x64, 0x9D, 0x41, 0xE3, 0x8B, 0x74, 0xB5, 0x7A, 0xDD,
-    0xA6, 0xCF, 0x17, 0xAB, 0xD5, 0xF9, 0x37, 0xEC, 0xB6, 0x65, 0xBD, 0x7D, 0x61, 0x39, 0xA7, 0x81,
-    0xD5, 0xBA, 0x08, 0x5F, 0x88, 0x42, 0xFA, 0x04, 0xB1, 0x3B, 0x9A, 0x1A, 0x74, 0x65, 0x06, 0xED,
-    0x9C, 0xC3, 0x56, 0x16, 0x58, 0xFB, 0x72, 0x38, 0x43, 0x55, 0xF7, 0xC2, 0xAA, 0xC7, 0x9F, 0xF3,
-    0x6C, 0x55, 0x40, 0xC3, 0xE6, 0xD4, 0x53, 0xAA, 0x52, 0x19, 0xDA, 0xBF, 0x58, 0x15, 0xF7, 0xD0,
-    0xCF, 0x04, 0xE2, 0xAF, 0x93, 0xD6, 0x25, 0x0D, 0xD4, 0x30, 0x69, 0xA1, 0xDC, 0x49, 0x57, 0xD4,
-    0x2E, 0xFE, 0x9A, 0x42, 0xF5, 0xD4, 0x22, 0x51, 0x81, 0x5E, 0x9A, 0x88, 0xFD, 0x85, 0xF6, 0x8A,
-    0xAD, 0x35, 0x06, 0x47, 0x4B, 0x61, 0x1A, 0x30, 0xC0, 0x88, 0xC6, 0xA2, 0x6D, 0x80, 0x16, 0x3A,
-    0x8C, 0x1B, 0x5A, 0xB5, 0xA0, 0x41, 0x58, 0x55, 0x58, 0x9F, 0x0C, 0x50, 0xEA, 0xB7, 0xFA, 0xB8,
-    0xB2, 0xAA, 0x09, 0x7B, 0x2D, 0xF2, 0x65, 0x2F, 0xFA, 0x70, 0xB4, 0x19, 0xF7, 0x8F, 0x18, 0x9A,
-    0x73, 0x63, 0xAB, 0xC4, 0xAE, 0x61, 0x6A, 0x50, 0xBF, 0x66, 0x9E, 0xD3, 0xDE, 0x20, 0xA6, 0x4D,
-    0x41, 0x7B, 0x76, 0xD4, 0xA4, 0x19, 0x3B, 0x58, 0xD0, 0xA0, 0x43, 0xAA, 0x5F, 0x42, 0x98, 0x26,
-    0x3C, 0xCC, 0x79, 0x3F, 0x24, 0x8A, 0x9D, 0xB8, 0xB5, 0xA9, 0x35, 0xE9, 0xE5, 0xD3, 0x85, 0xA6,
-    0x32, 0x23, 0xD4, 0xE2, 0xE7, 0x3A, 0x9A, 0x5C, 0xC5, 0x3A, 0xF9, 0xBF, 0x5D, 0x2B, 0xFF, 0xCE,
-    0x37, 0x8E, 0xBB, 0x71, 0xFC, 0x99, 0xFA, 0xA3, 0x53, 0xC2, 0xDC, 0x33, 0x88, 0x2C, 0x60, 0xC3,
-    0x05, 0x8B, 0x88, 0x60, 0x74, 0x6E, 0xD7, 0x23, 0x92, 0x26, 0x98, 0x4F, 0x43, 0x77, 0xAC, 0xFF,
-    0x05, 0x7F, 0x5D, 0xFF, 0xC7, 0x6D, 0xEB, 0x39, 0xEC, 0xFF, 0x52, 0xED, 0x28, 0xFE, 0xF5, 0xB6,
-    0x11, 0x21, 0xB6, 0x24, 0x74, 0x4A, 0xDD, 0x11, 0x60, 0xD0, 0x68, 0xD0, 0xA4, 0xD1, 0x47, 0xCC,
-    0x2E, 0x85, 0xEF, 0xA1, 0x11, 0x57, 0x35, 0x62, 0x2F, 0x6B, 0x82, 0x3E, 0xCC, 0x2C, 0x84, 0x01,
-    0x10, 0xAC, 0x9C, 0xB0, 0x0E, 0xB0, 0x0E, 0x90, 0xA8, 0x70, 0x13, 0x80, 0x6B, 0x39, 0xAC, 0xDB,
-    0x2F, 0xCA, 0xDB, 0x8B, 0x2C, 0xC7, 0x28, 0x6A, 0xFB, 0xEF, 0xD5, 0x2A, 0xEB, 0x01, 0xB0, 0x21,
-    0x07, 0x9A, 0x0B, 0x71, 0xB5, 0xFB, 0x09, 0x47, 0x0F, 0x3D, 0x94, 0xE5, 0xB4, 0x66, 0xA2, 0x66,
-    0x47, 0x25, 0xA9, 0xB9, 0x4F, 0xA5, 0xF6, 0x82, 0x62, 0xA0, 0x62, 0x4B, 0xA3, 0x25, 0x19, 0x21,
-    0xE4, 0x62, 0x6A, 0x53, 0x72, 0x8D, 0xF9, 0x4F, 0x7E, 0x21, 0xBC, 0xCD, 0xFA, 0x69, 0x51, 0x5E,
-    0x38, 0xF9, 0x38, 0x68, 0xD6, 0x5C, 0xC5, 0xAF, 0x1B, 0x07, 0x7F, 0x5E, 0xC8, 0x8B, 0x4A, 0xEC,
-    0xA9, 0xD1, 0x19, 0x14, 0x54, 0xC6, 0xE0, 0xF2, 0xC6, 0x32, 0x76, 0x21, 0xD0, 0x05, 0x9D, 0x67,
-    0xC2, 0x82, 0x8A, 0x32, 0xB7, 0x61, 0x95, 0x2F, 0x37, 0x5D, 0xD1, 0xA8, 0x46, 0x55, 0xA9, 0xB7,
-    0x52, 0x4C, 0x08, 0x1D, 0x64, 0xBF, 0xE1, 0x3C, 0x1E, 0x42, 0xC4, 0x9C, 0x4C, 0x53, 0x98, 0x2B,
-    0xDA, 0xA2, 0xF5, 0x66, 0x13, 0xF9, 0x22, 0xDB, 0x14, 0x58, 0x75, 0xDC, 0x61, 0x9B, 0x93, 0x36,
-    0xB4, 0xEF, 0x5B, 0xC3, 0xC5, 0xD7, 0x73, 0xB9, 0x99, 0x82, 0x6B, 0x38, 0x2F, 0xF7, 0xB3, 0x92,
-    0x07, 0xB1, 0xEE, 0x79, 0xC5, 0x69, 0x2D, 0x95, 0xCF, 0x29, 0xC7, 0xC5, 0x2E, 0xA8, 0x92, 0xD2,
-    0x04, 0x6A, 0x8E, 0x57, 0x26, 0x49, 0xB9, 0x98, 0xEA, 0xCE, 0x7C, 0xDD, 0xF2, 0x64, 0xDD, 0xA8,
-    0x1F, 0x55, 0xE7, 0x99, 0xBA, 0xD5, 0x31, 0x60, 0xAC, 0x8F, 0xE5, 0x5E, 0x52, 0x86, 0xEB, 0x78,
-    0x08, 0x26, 0xAC, 0x80, 0xBD, 0x37, 0x04, 0x8C, 0x1A, 0x03, 0x16, 0xD8, 0xBB, 0x19, 0x6D, 0xF9,
-    0x21, 0x1D, 0x03, 0xD5, 0x28, 0xE3, 0x8A, 0xC8, 0x4F, 0x04, 0x36, 0x21, 0x90, 0xB4, 0x8C, 0x61,
-    0xE8, 0x6C, 0x96, 0xB5, 0x1E, 0x3F, 0xD6, 0xD8, 0x5D, 0x5F, 0x08, 0x49, 0xE8, 0xF9, 0x92, 0x49,
-    0x0D, 0x2A, 0x8F, 0x1A, 0x22, 0x38, 0xDE, 0xBD, 0xF9, 0x09, 0xE5, 0x9C, 0x50, 0xAB, 0x09, 0xC9,
-    0x27, 0x96, 0x09, 0x11, 0x0C, 0x13, 0xB2, 0x1A, 0xBD, 0x64, 0x0D, 0x8A, 0xA4, 0xA5, 0x67, 0xEC,
-    0x54, 0x4C, 0x40, 0x95, 0xB0, 0x7B, 0x50, 0x0B, 0xBB, 0x6E, 0x1D, 0x9B, 0x75, 0xD8, 0x80, 0xBB,
-    0x1D, 0xAC, 0x12, 0x2E, 0xE8, 0x7B, 0xEF, 0xC6, 0xED, 0xF1, 0xEE, 0x6E, 0xB4, 0xA8, 0xFC, 0x0E,
-    0xD4, 0x22, 0x0D, 0x47, 0xFC, 0x68, 0x59, 0x00, 0x5E, 0xA4, 0x38, 0x9C, 0x4F, 0x34, 0xE2, 0x79,
-    0x63, 0xF9, 0xCE, 0x69, 0xCA, 0xB4, 0xBD, 0x2E, 0x9E, 0x60, 0xB9, 0x59, 0x9F, 0xAD, 0xCF, 0xB9,
-    0xC5, 0x1A, 0x7B, 0x0F, 0x64, 0x8B, 0xFB, 0xB0, 0x0D, 0x52, 0xF7, 0xCC, 0xE7, 0x79, 0x9E, 0x63,
-    0xC3, 0xBD, 0x6A, 0xEF, 0x92, 0x5C, 0x24, 0x88, 0xEF, 0x3C, 0x18, 0x64, 0x98, 0x06, 0xF9, 0xC1,
-    0x42, 0x4C, 0x6C, 0x48, 0x3D, 0x52, 0x45, 0x76, 0x95, 0x96, 0xDC, 0xD2, 0x7E, 0x71, 0x2F, 0xE0,
-    0x64, 0x31, 0x7F, 0xFD, 0xEE, 0xB8, 0xA9, 0x53, 0x5F, 0xEE, 0xBC, 0xF3, 0xDC, 0xC4, 0xEC, 0xE0,
-    0x94, 0x9B, 0xB3, 0xD3, 0x13, 0xFB, 0xDE, 0x1E, 0x3E, 0xA7, 0x9D, 0x21, 0x2C, 0x7A, 0xA5, 0xAD,
-    0x08, 0xD6, 0x1B, 0xE7, 0x27, 0x3B, 0xA3, 0x12, 0xD2, 0xFD, 0x62, 0x16, 0x2D, 0xC7, 0xE2, 0xCD,
-    0xC2, 0x43, 0x4B, 0xC5, 0x09, 0x94, 0xFC, 0xC9, 0xE9, 0x34, 0x64, 0x2C, 0xD8, 0x45, 0x69, 0x54,
-    0xAA, 0xA5, 0x10, 0xE8, 0x7C, 0x5F, 0x7F, 0x72, 0x7A, 0x02, 0xE7, 0x51, 0x13, 0xA6, 0xDE, 0x0A,
-    0xC4, 0xA8, 0x17, 0x3F, 0xB0, 0x7F, 0xB6, 0xEE, 0x0F, 0xBD, 0x2E, 0x47, 0xDD, 0x68, 0x00, 0x54,
-    0x76, 0xEA, 0xB4, 0x16, 0xC8, 0x95, 0x26, 0x46, 0xFD, 0xCE, 0x3D, 0x71, 0xA5, 0x1F, 0x9C, 0x09,
-    0x60, 0xEB, 0xC9, 0xEF, 0x4C, 0x9F, 0xE5, 0xD5, 0xD1, 0x7A, 0xB2, 0x6E, 0x04, 0xFB, 0x4C, 0x72,
-    0x82, 0xF4, 0xB7, 0xD2, 0x11, 0x14, 0xAE, 0x8E, 0x92, 0xD2, 0x4A, 0xC5, 0x04, 0xB8, 0xB8, 0x3D,
-    0xAE, 0x25, 0x1E, 0xB4, 0x2D, 0x33, 0xD9, 0xDF, 0x40, 0xAA, 0xE4, 0xC8, 0x90, 0x40, 0xB8, 0xEC,
-    0xFE, 0xB2, 0x5B, 0x76, 0xD8, 0x80, 0x2E, 0xAC, 0x93, 0x0A, 0x2B, 0xA8, 0xE3, 0x8F, 0x2C, 0xB0,
-    0xCF, 0x8A, 0x32, 0x7B, 0xB3, 0x01, 0x9C, 0x01, 0xEF, 0x10, 0x1D, 0x94, 0x0B, 0x84, 0x27, 0x06,
-    0xFE, 0x1A, 0xD5, 0xE1, 0x93, 0x0E, 0x1E, 0x29, 0x2B, 0x93, 0xDB, 0xA8, 0x0F, 0xBA, 0x3A, 0x24,
-    0x60, 0xCA, 0xCB, 0x6E, 0xD1, 0xF2, 0x71, 0xB2, 0x4E, 0x3E, 0xEE, 0x16, 0xD0, 0xD4, 0x0F, 0x2C,
-    0x6C, 0xC2, 0xA1, 0xB0, 0x87, 0x4D, 0x0C, 0xBC, 0xED, 0xE9, 0xD0, 0xCA, 0xC8, 0x2A, 0xCC, 0xCD,
-    0xF2, 0xEF, 0xFE, 0xD6, 0xFD, 0x5B, 0xAA, 0xA9, 0x0B, 0x6A, 0xA7, 0x2B, 0x04, 0xF0, 0x37, 0xBC,
-    0x1E, 0xFE, 0xA2, 0x68, 0x3C, 0x9B, 0xE5, 0x2D, 0xD2, 0xFE, 0xC1, 0x0B, 0xF8, 0x50, 0x35, 0x63,
-    0x61, 0xF3, 0x7C, 0xE2, 0xAC, 0xB4, 0xFE, 0xD0, 0xD7, 0x30, 0x69, 0x4D, 0x74, 0xC8, 0x1E, 0xE7,
-    0xF6, 0xBA, 0xAC, 0xA4, 0xA6, 0xA8, 0x96, 0x26, 0xA4, 0x01, 0xF2, 0x31, 0x1E, 0xEA, 0x49, 0x3F,
-    0x66, 0x1E, 0xB9, 0x93, 0x96, 0xFB, 0x83, 0x1D, 0xE1, 0x0E, 0x15, 0x74, 0x0E, 0x44, 0x1B, 0xFC,
-    0x05, 0x26, 0xE4, 0x8D, 0xC5, 0x5F, 0xE7, 0x1E, 0xD2, 0xE4, 0x27, 0xAA, 0xA5, 0x3D, 0xD8, 0x2B,
-    0x06, 0x79, 0x5E, 0xAB, 0x23, 0x79, 0xA0, 0x8B, 0x9C, 0x45, 0x46, 0x36, 0x81, 0x71, 0x6F, 0x4A,
-    0x93, 0x7A, 0xE2, 0x09, 0xB0, 0xA7, 0xB0, 0xC3, 0xAB, 0x72, 0xB6, 0x15, 0x61, 0x62, 0x50, 0x4F,
-    0x95, 0x1D, 0xC2, 0xAE, 0x51, 0x3B, 0xB6, 0x4B, 0xDC, 0x93, 0x8F, 0x09, 0xAB, 0x8D, 0xD1, 0xF6,
-    0x71, 0x33, 0x04, 0xFA, 0x3B, 0xD2, 0xED, 0x11, 0xFE, 0x07, 0x35, 0x5F, 0x2B, 0xBE, 0x9B, 0xDB,
-    0xFF, 0xBC, 0x66, 0x35, 0x6B, 0x0E, 0x09, 0x79, 0xD1, 0x6D, 0x46, 0x0B, 0x4F, 0xD0, 0x3C, 0xE9,
-    0x70, 0x33, 0x32, 0x35, 0xBF, 0x6D, 0x7B, 0xD7, 0xD1, 0x27, 0xA1, 0x69, 0x13, 0xE9, 0xB1, 0xF9,
-    0xB0, 0xB1, 0x54, 0x6A, 0x35, 0x81, 0xBC, 0x0D, 0x14, 0x58, 0x99, 0xF7, 0x6A, 0x0F, 0xE0, 0x30,
-    0x07, 0x37, 0xAB, 0xE4, 0x9F, 0xE4, 0x6F, 0x05, 0xBC, 0x72, 0xDC, 0x1E, 0x65, 0x25, 0x5F, 0x61,
-    0xB0, 0x9E, 0xCC, 0x7D, 0x10, 0xB1, 0xB9, 0xB9, 0xA4, 0xE0, 0x03, 0xFF, 0xBB, 0x77, 0xA3, 0x25,
-    0x05, 0xB4, 0xFB, 0x1F, 0x63, 0xC4, 0xD7, 0xE4, 0x34, 0x4D, 0xAB, 0x29, 0xB9, 0xBB, 0x35, 0x7D,
-    0xEA, 0xDA, 0xFB, 0x7A, 0x88, 0x69, 0x47, 0xD0, 0x2B, 0xE0, 0x1A, 0xD7, 0x2C, 0x57, 0x4B, 0x99,
-    0xA1, 0x7A, 0xCF, 0x11, 0x25, 0x34, 0x10, 0x19, 0x34, 0x9D, 0x69, 0xD9, 0x5E, 0x02, 0x21, 0xD7,
-    0x4D, 0x91, 0x63, 0xE4, 0x62, 0x5F, 0x3C, 0xF3, 0x2E, 0x19, 0xA6, 0x65, 0x9B, 0xDB, 0x27, 0x6A,
-    0x4B, 0x74, 0xBE, 0x93, 0xD0, 0x6E, 0x8C, 0x7D, 0x5F, 0x1B, 0x8D, 0x76, 0xD0, 0x90, 0xD5, 0x66,
-    0x26, 0x07, 0xDE, 0xA2, 0x06, 0xBA, 0xCC, 0x13, 0xDF, 0x81, 0x8A, 0xF4, 0xCC, 0xB7, 0x91, 0x50,
-    0xBB, 0x53, 0xDF, 0x2F, 0x56, 0x97, 0x9F, 0x5B, 0x97, 0xDF, 0xC3, 0xBD, 0xBD, 0xA7, 0xFA, 0xB5,
-    0x71, 0xAC, 0xD3, 0xDF, 0xAF, 0x6A, 0x5F, 0x7F, 0xC3, 0xF1, 0x9E, 0xFA, 0x4E, 0xB0, 0x5D, 0xD8,
-    0x7D, 0xBF, 0x48, 0x89, 0xBE, 0xF5, 0x12, 0x80, 0x49, 0x5D, 0x03, 0x43, 0xC0, 0x8E, 0xFE, 0xD5,
-    0x42, 0x3C, 0x28, 0xF6, 0x91, 0x66, 0xED, 0x46, 0xF8, 0x21, 0x1D, 0x9E, 0xFC, 0x30, 0x76, 0x08,
-    0x00, 0x79, 0x5B, 0x2E, 0x8E, 0xCE, 0x16, 0x1C, 0x00, 0x21, 0x92, 0x3D, 0xB6, 0x6A, 0xFB, 0x9A,
-    0xDD, 0x12, 0x23, 0xA4, 0x4F, 0xA0, 0x6B, 0x21, 0x23, 0x28, 0xE8, 0x1A, 0x4A, 0x18, 0xD4, 0x02,
-    0x4E, 0x78, 0x58, 0x15, 0x5E, 0x31, 0xC4, 0x2F, 0xBC, 0x66, 0x98, 0x16, 0x06, 0x38, 0xDB, 0x5A,
-    0x79, 0x06, 0x91, 0x3D, 0xC6, 0x90, 0x8C, 0x5A, 0x39, 0xF8, 0x2E, 0xA3, 0x86, 0x9E, 0x03, 0x67,
-    0x5F, 0xBE, 0xF8, 0xF6, 0x6A, 0xF5, 0x9A, 0xED, 0x8A, 0xE7, 0x51, 0xB6, 0xF6, 0xA5, 0xD8, 0xDE,
-    0x1D, 0x95, 0xBB, 0xFD, 0x6A, 0xB5, 0x7B, 0xA6, 0x4E, 0x5E, 0x70, 0x3B, 0x2D, 0xB4, 0x63, 0x77,
-    0xD5, 0x35, 0x7C, 0x74, 0xE3, 0xE4, 0xC0, 0xA1, 0x79, 0x82, 0xFD, 0xB3, 0xFF, 0xC8, 0x68, 0x84,
-    0xAD, 0x4D, 0xBD, 0xD1, 0x5B, 0x7E, 0xC3, 0x1E, 0xCE, 0xF8, 0x83, 0x00, 0xC1, 0x7D, 0xBE, 0x64,
-    0x50, 0x7D, 0x5B, 0x0B, 0x1D, 0xD6, 0xDB, 0x03, 0x29, 0x22, 0xAA, 0x70, 0x55, 0x99, 0xA8, 0x20,
-    0xB8, 0x38, 0x11, 0x99, 0x88, 0x08, 0xF2, 0x47, 0xF7, 0x51, 0xD4, 0xD8, 0xF6, 0xA5, 0xD1, 0xBC,
-    0x8B, 0x3A, 0x61, 0xB0, 0x4F, 0xB7, 0x55, 0x3C, 0x66, 0x8E, 0x42, 0x86, 0x56, 0x8C, 0x29, 0x9D,
-    0x5E, 0xFF, 0xD6, 0x9E, 0x30, 0xBB, 0xA2, 0x57, 0x5D, 0xDF, 0x2C, 0xA4, 0xBF, 0xE1, 0x1C, 0x8A,
-    0x7A, 0xC6, 0x14, 0x03, 0xA3, 0x13, 0xAE, 0xBE, 0xD3, 0x04, 0x89, 0xCE, 0xA1, 0xBD, 0x3A, 0xCD,
-    0x61, 0x8E, 0x1B, 0x6B, 0x8F, 0x2C, 0xB4, 0x7D, 0x81, 0x0D, 0xD5, 0xEF, 0xF7, 0x77, 0x63, 0x6F,
-    0xEF, 0x9A, 0x3D, 0xF5, 0xE9, 0x32, 0xB9, 0x5F, 0xF0, 0x42, 0xC5, 0x4E, 0x47, 0x26, 0x6F, 0x3B,
-    0x98, 0x1A, 0xC3, 0x42, 0x19, 0xC7, 0xE2, 0xA1, 0xD2, 0x58, 0x47, 0x03, 0xEE, 0x26, 0x0F, 0x07,
-    0x43, 0x10, 0x1F, 0xEE, 0x5B, 0x71, 0x17, 0x3C, 0xAF, 0xB3, 0x87, 0x5F, 0x32, 0xD3, 0x94, 0x1C,
-    0xF5, 0xB8, 0x6B, 0x97, 0x06, 0xBB, 0x84, 0xF0, 0xE3, 0x86, 0x15, 0x1F, 0x63, 0xDD, 0xF7, 0xE0,
-    0x0D, 0xB3, 0x32, 0x6C, 0xB2, 0x23, 0xB0, 0xAB, 0x45, 0x17, 0x0D, 0x00, 0xF9, 0xD9, 0xB0, 0xB0,
-    0xA2, 0x2A, 0x4A, 0xB0, 0xEC, 0x87, 0x0D, 0x1E, 0x95, 0x78, 0x38, 0x37, 0xF8, 0xCC, 0x01, 0xA2,
-    0xB9, 0xDD, 0xF0, 0x61, 0x64, 0x70, 0xCF, 0x0F, 0x9B, 0x39, 0x53, 0x2E, 0x47, 0x3D, 0x6D, 0x92,
-    0x0F, 0x23, 0xDA, 0x1C, 0x73, 0x23, 0x6B, 0x3E, 0x64, 0x74, 0xC7, 0x87, 0x70, 0x63, 0x60, 0xF0,
-    0x4C, 0x3B, 0x99, 0xC8, 0x0C, 0xAC, 0x8F, 0x24, 0xE3, 0x31, 0xE9, 0x0B, 0x88, 0xAB, 0xD5, 0x7A,
-    0x30, 0xE8, 0x01, 0xDD, 0xC6, 0x63, 0x6E, 0x1D, 0x1E, 0xDC, 0x62, 0x76, 0x24, 0xA6, 0x67, 0xB1,
-    0x5B, 0x3D, 0x2C, 0x1B, 0x0F, 0x2E, 0x82, 0x42, 0x77, 0x45, 0x95, 0xB5, 0x78, 0xD0, 0x40, 0x7A,
-    0x78, 0x40, 0x2E, 0xFD, 0xD8, 0x52, 0x90, 0xC3, 0x8E, 0x23, 0xDF, 0xC0, 0x03, 0x04, 0x11, 0x78,
-    0x40, 0x08, 0xC6, 0x83, 0xC0, 0x3E, 0xC7, 0x03, 0x62, 0x77, 0x4C, 0x15, 0xE6, 0x03, 0x4C, 0xF7,
-    0x31, 0xC7, 0x36, 0x3E, 0x98, 0xE9, 0x01, 0x9E, 0xF3, 0xC1, 0xC2, 0xEA, 0x63, 0xEE, 0x34, 0x8C,
-    0x94, 0x45, 0xF1, 0x1C, 0x54, 0x68, 0x66, 0x63, 0xE0, 0xF3, 0xA0, 0x20, 0x93, 0xAF, 0xF0, 0x1F,
-    0x29, 0x53, 0x60, 0x0D, 0x21, 0x64, 0x69, 0xFF, 0xE0, 0x19, 0x10, 0xE2, 0x17, 0x2C, 0xE8, 0x16,
-    0xFD, 0x8E, 0xC7, 0x79, 0x8F, 0xFC, 0xD0, 0x57, 0x53, 0x0C, 0xF6, 0xF0, 0xF8, 0x07, 0xB5, 0x5B,
-    0xD5, 0x7C, 0x9B, 0x9B, 0xEC, 0x20, 0xE9, 0x7C, 0x6F, 0x6F, 0xF8, 0xAE, 0x43, 0x63, 0x3E, 0x05,
-    0x43, 0xFD, 0xBA, 0xF0, 0x2E, 0x60, 0xE3, 0x8D, 0xC4, 0x03, 0xD8, 0xDA, 0x3B, 0x51, 0x85, 0x62,
-    0x70, 0x59, 0xE9, 0x7C, 0xF2, 0xCC, 0x0D, 0x9D, 0x47, 0x63, 0xCA, 0xF3, 0xC0, 0x4A, 0xEE, 0x32,
-    0x5F, 0x51, 0xD0, 0xD6, 0x98, 0x12, 0x3B, 0x62, 0x46, 0x0D, 0x53, 0x59, 0xF0, 0x56, 0x82, 0x79,
-    0x9E, 0xF7, 0xD9, 0xA0, 0x4B, 0xCA, 0x95, 0xD2, 0x4C, 0xD8, 0xCD, 0xDC, 0x1E, 0xEC, 0x1C, 0x07,
-    0xC8, 0xCE, 0xE7, 0xF0, 0x4A, 0xF7, 0x95, 0xB7, 0xDC, 0xFF, 0x43, 0xE9, 0x89, 0x45, 0x04, 0xBB,
-    0x7E, 0xFA, 0x9E, 0xC1, 0xCD, 0xBD, 0x1A, 0x84, 0xF2, 0x29, 0x4E, 0xE6, 0x87, 0xD1, 0x5A, 0x05,
-    0x1B, 0xAB, 0x94, 0x42, 0x56, 0x2F, 0x0A, 0x73, 0x2D, 0xF7, 0x1D, 0xDA, 0x61, 0xC1, 0xB0, 0x0B,
-    0x6B, 0xCE, 0xD1, 0x3A, 0x43, 0x8C, 0x4A, 0xB9, 0x50, 0xD4, 0x9D, 0xFE, 0xD5, 0xDD, 0x46, 0x15,
-    0x54, 0xB7, 0xDA, 0x38, 0xB6, 0x5E, 0x9D, 0xA5, 0xBC, 0x4B, 0xAA, 0x44, 0x36, 0xAF, 0x9E, 0xF0,
-    0xC7, 0x88, 0x0B, 0xB0, 0x54, 0xF9, 0x5F, 0xC4, 0x2B, 0xDF, 0x6F, 0x25, 0x66, 0x25, 0xFA, 0xD1,
-    0xCA, 0x7E, 0xAA, 0x29, 0x08, 0x27, 0x57, 0xF4, 0x8C, 0xA1, 0xD5, 0x14, 0x33, 0xD0, 0x08, 0x12,
-    0xA5, 0xFF, 0x50, 0x0C, 0xAE, 0x30, 0xD5, 0xCB, 0xAE, 0xA6, 0xB6, 0x4F, 0x09, 0x8B, 0x50, 0xB6,
-    0x68, 0xA2, 0x9D, 0xF2, 0x25, 0xDA, 0x0C, 0x1F, 0x7E, 0x4C, 0x3B, 0xED, 0x33, 0x08, 0x37, 0x19,
-    0xC0, 0x45, 0xC3, 0x0F, 0xAD, 0x25, 0xF3, 0xFC, 0x80, 0xD3, 0xA7, 0x5C, 0x41, 0xBA, 0x49, 0x2E,
-    0xB7, 0x76, 0x7C, 0x16, 0x47, 0x69, 0xF2, 0x67, 0xD2, 0x19, 0xE5, 0x26, 0x71, 0xF1, 0xDC, 0x6C,
-    0xC6, 0xB7, 0x72, 0x93, 0x70, 0x9D, 0x3D, 0x11, 0xFF, 0xBA, 0x2D, 0x5D, 0x14, 0x2D, 0xEB, 0x44,
-    0xCB, 0x7E, 0xEF, 0xB7, 0x19, 0x49, 0x21, 0x4C, 0x6E, 0x49, 0x38, 0x21, 0x8E, 0x10, 0xF1, 0x16,
-    0x24, 0xE5, 0xA9, 0x84, 0xD4, 0xAF, 0x17, 0x9F, 0xAC, 0xC8, 0x6F, 0x18, 0xED, 0x50, 0x5C, 0x9C,
-    0xE0, 0x42, 0x2D, 0x09, 0x5E, 0x29, 0xE7, 0xAF, 0x54, 0x6C, 0x13, 0x6B, 0x0C, 0x86, 0x22, 0x58,
-    0x07, 0x16, 0x05, 0xF7, 0x8B, 0x5B, 0x33, 0x26, 0x03, 0x53, 0xFE, 0x66, 0x76, 0x4B, 0x9E, 0x34,
-    0x26, 0xEB, 0x4E, 0xB9, 0x58, 0x5B, 0x33, 0x8C, 0x88, 0xBB, 0x99, 0x88, 0xA5, 0x24, 0x01, 0x0A,
-    0x59, 0x93, 0xE5, 0xF8, 0x01, 0x24, 0x26, 0xF0, 0x70, 0xDA, 0xE6, 0x81, 0x4F, 0x68, 0x28, 0x9D,
-    0x35, 0x46, 0x29, 0xD2, 0xFE, 0xB9, 0xF5, 0x3E, 0x70, 0xF1, 0xF9, 0xBF, 0x72, 0x8A, 0x83, 0x8A,
-    0xB5, 0x42, 0x35, 0x3F, 0x57, 0xB1, 0xDD, 0x9B, 0xE6, 0x49, 0x35, 0x66, 0xCC, 0x78, 0x3A, 0xF7,
-    0xC9, 0x0C, 0x66, 0x92, 0xA3, 0x4E, 0xBE, 0xBA, 0x93, 0x97, 0x05, 0xD0, 0x10, 0xC9, 0x73, 0xA6,
-    0x2D, 0x38, 0x6F, 0x26, 0xBE, 0xE2, 0x23, 0xE6, 0x3F, 0x30, 0xCF, 0xF0, 0xC0, 0xE8, 0x20, 0xB2,
-    0x7A, 0xDE, 0x27, 0xD5, 0x92, 0x89, 0xEF, 0xC0, 0x42, 0xAE, 0x1A, 0x7F, 0xC5, 0x0D, 0x63, 0x16,
-    0xAB, 0x58, 0x27, 0x6B, 0x60, 0x3E, 0x7B, 0x8D, 0x1A, 0x84, 0xF9, 0xCC, 0x87, 0x2C, 0x51, 0x45,
-    0x79, 0x4A, 0xAC, 0x85, 0xD5, 0x5C, 0xDC, 0x5A, 0x1E, 0x3D, 0x92, 0x02, 0x27, 0xD5, 0xBC, 0x57,
-    0x82, 0xF7, 0x2E, 0x3C, 0xC7, 0x75, 0x62, 0xFB, 0x11, 0xC3, 0x1A, 0x1D, 0x5A, 0x28, 0x6A, 0x56,
-    0x26, 0x8C, 0xE9, 0x54, 0x9E, 0x2F, 0x51, 0x2B, 0xBD, 0x63, 0xAD, 0x7D, 0x12, 0x9C, 0x86, 0x1E,
-    0x48, 0x12, 0x0C, 0x3A, 0x18, 0x73, 0x78, 0xCF, 0xCC, 0xC8, 0x01, 0x64, 0x41, 0x44, 0x08, 0x61,
-    0x23, 0x85, 0x02, 0x7E, 0x80, 0x3F, 0xA7, 0xD4, 0x09, 0xEF, 0x72, 0x53, 0x8B, 0x26, 0x6B, 0x27,
-    0xFA, 0x1F, 0x88, 0x79, 0x10, 0x63, 0x24, 0x44, 0x73, 0x53, 0xA4, 0x3F, 0x42, 0x8B, 0x32, 0x86,
-    0x3E, 0x8E, 0xE7, 0x63, 0x41, 0x29, 0xCD, 0x31, 0xB0, 0x4F, 0xE5, 0x28, 0x99, 0x25, 0x82, 0xC9,
-    0x33, 0x87, 0x46, 0x24, 0x68, 0x28, 0xED, 0x48, 0xCC, 0x67, 0xCE, 0x8C, 0x21, 0xA5, 0xCF, 0x5C,
-    0xEA, 0x12, 0x78, 0x49, 0x12, 0xD1, 0x92, 0xED, 0x2B, 0x0B, 0x84, 0xEA, 0xDA, 0x98, 0x3A, 0x62,
-    0xD4, 0xB8, 0x5E, 0x52, 0x9C, 0xA5, 0x18, 0x71, 0xEE, 0xD1, 0x64, 0x0C, 0x13, 0x8B, 0x26, 0xF1,
-    0x2A, 0xDB, 0x4C, 0x70, 0xAB, 0x14, 0x8D, 0x47, 0x01, 0x4E, 0x46, 0xC1, 0x93, 0x1D, 0x23, 0xA3,
-    0x52, 0x84, 0xDE, 0xBA, 0x5E, 0xAA, 0x8C, 0x27, 0x1F, 0xE3, 0x83, 0x41, 0x79, 0xA7, 0x3E, 0x1E,
-    0x53, 0x27, 0x8A, 0xD5, 0x14, 0xDA, 0xCD, 0xFD, 0xF0, 0x95, 0x4F, 0xE2, 0x8E, 0x14, 0x5F, 0x45,
-    0xA1, 0x04, 0x5E, 0x37, 0x81, 0x92, 0x08, 0x7F, 0xB4, 0x89, 0x0B, 0x9F, 0xE9, 0x41, 0x47, 0x50,
-    0x88, 0x69, 0xDE, 0x13, 0x0A, 0x09, 0x9A, 0x6E, 0xDB, 0x74, 0xF2, 0x01, 0x62, 0xF5, 0x09, 0x0F,
-    0xF3, 0x58, 0x54, 0x8B, 0xDE, 0xBD, 0x7C, 0x31, 0xF5, 0x02, 0x76, 0xBA, 0xF6, 0x19, 0x30, 0x06,
-    0xF2, 0xCC, 0x89, 0x31, 0xF9, 0x4A, 0x45, 0x5D, 0x0C, 0x3E, 0x1B, 0xCB, 0x14, 0x83, 0xB2, 0x2E,
-    0xCA, 0xE8, 0x9C, 0xA8, 0x1C, 0x8D, 0x95, 0x97, 0xBD, 0x3F, 0x8B, 0xF0, 0x95, 0xF3, 0x17, 0x57,
-    0xA6, 0xFE, 0x7E, 0xCA, 0x75, 0x3D, 0x61, 0x10, 0x5B, 0xCF, 0x5F, 0xBE, 0x78, 0x32, 0xF6, 0xC2,
-    0xF3, 0x3D, 0xF7, 0x13, 0x37, 0x9D, 0x1D, 0x85, 0x9B, 0x18, 0x7A, 0xEE, 0x6D, 0x43, 0x39, 0x0B,
-    0x26, 0xC1, 0x8A, 0xB7, 0x68, 0x59, 0x1F, 0x30, 0x84, 0x5A, 0xA3, 0x6A, 0x58, 0x2F, 0x10, 0x3B,
-    0x41, 0x49, 0xD3, 0x39, 0x74, 0x14, 0x91, 0x16, 0x8F, 0x36, 0x99, 0x9F, 0x2A, 0x79, 0xF2, 0xD9,
-    0xC6, 0xCC, 0x82, 0x12, 0xEE, 0xCE, 0xA5, 0x17, 0xF6, 0xF6, 0xF6, 0x2E, 0x8D, 0x0A, 0xD0, 0x5C,
-    0x79, 0x8F, 0xDA, 0xBC, 0x20, 0x4D, 0xE3, 0xA9, 0x93, 0x8E, 0x16, 0x2F, 0xBB, 0xED, 0xE2, 0x5D,
-    0xAA, 0x60, 0x4F, 0x5F, 0xD2, 0x2B, 0x9E, 0x0C, 0x80, 0xA3, 0xCD, 0x2C, 0x0D, 0xC6, 0xBC, 0xA2,
-    0xB6, 0x7B, 0x6B, 0xCF, 0xBA, 0x6D, 0x06, 0x69, 0x0C, 0xA4, 0x6E, 0xD9, 0x70, 0xDD, 0xA0, 0xF3,
-    0x09, 0xB3, 0xEE, 0xF0, 0x3C, 0x50, 0xF8, 0xBB, 0x34, 0x96, 0x0C, 0x78, 0xA2, 0xEC, 0x2F, 0xE8,
-    0xE6, 0xC0, 0xF8, 0xE2, 0x57, 0x70, 0x87, 0x3D, 0x26, 0xCA, 0x2C, 0xDC, 0x85, 0x77, 0x94, 0xE2,
-    0x3E, 0x43, 0x71, 0xFE, 0x3E, 0x0A, 0x98, 0x43, 0xB6, 0x2F, 0x9F, 0x8A, 0x41, 0x33, 0xFB, 0xDC,
-    0xC8, 0x6A, 0x33, 0xDA, 0x5B, 0xDC, 0xC3, 0x30, 0xC2, 0x81, 0x85, 0x65, 0xCD, 0x73, 0x0A, 0x3D,
-    0x05, 0x0F, 0x1E, 0x32, 0x4E, 0x31, 0xB3, 0x9F, 0x53, 0xF9, 0xB0, 0x7E, 0xDF, 0x15, 0xB6, 0xB0,
-    0xCC, 0xAA, 0x82, 0x6A, 0xCC, 0x04, 0x67, 0x50, 0xDC, 0x27, 0x5D, 0xEA, 0x9C, 0x4F, 0xCE, 0x32,
-    0x7F, 0x77, 0x08, 0x1C, 0x6D, 0xDC, 0x8F, 0xE3, 0x61, 0x5C, 0xBE, 0x4F, 0xEB, 0xE4, 0xDE, 0xA8,
-    0x4E, 0xFC, 0x33, 0x3E, 0xA2, 0x7B, 0xFF, 0x0E, 0x48, 0xD6, 0xEB, 0x39, 0x33, 0x2A, 0xF4, 0x39,
-    0x08, 0x72, 0x00, 0x36, 0xE7, 0x8F, 0x93, 0xF6, 0xDB, 0xBF, 0xD4, 0xCE, 0x7E, 0x4D, 0xB1, 0x3C,
-    0x58, 0x92, 0x3E, 0xDD, 0x82, 0xD0, 0x10, 0x78, 0x2C, 0xFD, 0x69, 0xFA, 0x91, 0x21, 0x74, 0x4E,
-    0x13, 0x8A, 0x3B, 0xF4, 0xE9, 0x1D, 0xC1, 0x7E, 0xC2, 0x9C, 0xF2, 0xD3, 0x45, 0xE7, 0xBD, 0x65,
-    0x68, 0x98, 0x7A, 0x84, 0x66, 0x57, 0xFD, 0x41, 0x82, 0xCD, 0xD9, 0x5F, 0x40, 0x2D, 0x00, 0x26,
-    0xCC, 0x80, 0x52, 0x3B, 0x0A, 0xFB, 0x95, 0x81, 0x1D, 0xFC, 0xE9, 0xF1, 0x78, 0x9E, 0xF1, 0xF3,
-    0xA2, 0x85, 0x81, 0xCB, 0x83, 0x85, 0x3D, 0xFB, 0x1B, 0x92, 0x61, 0xEF, 0xFA, 0xA0, 0xCC, 0xC8,
-    0x89, 0xA2, 0x9D, 0x70, 0x46, 0xB8, 0x30, 0x42, 0x42, 0x1E, 0xFC, 0x27, 0xD3, 0xDC, 0xED, 0x4C,
-    0x5C, 0x2B, 0x23, 0x47, 0x59, 0x2A, 0x88, 0x3F, 0xC7, 0xE1, 0xAE, 0xBC, 0xAB, 0x93, 0x7E, 0x8C,
-    0x03, 0x18, 0xC7, 0x23, 0x8A, 0x5C, 0x58, 0x3F, 0xF8, 0x14, 0x60, 0x60, 0x9F, 0xED, 0x50, 0x0D,
-    0xD9, 0xC5, 0xF7, 0xE9, 0xB7, 0xFF, 0xD4, 0x0E, 0xDF, 0x91, 0xFD, 0xD1, 0xA2, 0x95, 0x24, 0xD4,
-    0xD1, 0xFE, 0x37, 0xBF, 0x01, 0xB9, 0x06, 0x2B, 0xC8, 0xF5, 0x06, 0xE5, 0xBA, 0x6F, 0x0B, 0x2F,
-    0xD7, 0x07, 0x94, 0xAB, 0x3B, 0x96, 0xEB, 0x57, 0x88, 0x74, 0x94, 0xEB, 0x28, 0xDC, 0x98, 0xA1,
-    0x73, 0xC4, 0xB3, 0xB9, 0x49, 0xAE, 0x46, 0xB9, 0xDE, 0xA1, 0x5C, 0x97, 0x94, 0xAB, 0xB6, 0xD2,
-    0x1F, 0x6D, 0x0C, 0x7F, 0x20, 0x97, 0x71, 0xF8, 0x23, 0xEB, 0xC2, 0x89, 0x21, 0x2A, 0x54, 0x48,
-    0x83, 0xEB, 0x76, 0xFF, 0x9B, 0x98, 0xC3, 0x81, 0xCC, 0xA1, 0xA4, 0x39, 0xD4, 0x99, 0x87, 0xD2,
-    0x43, 0xE2, 0x1F, 0xFC, 0x25, 0x34, 0x3C, 0xA2, 0xAE, 0x7B, 0x73, 0x18, 0x8B, 0xE6, 0xA5, 0x8A,
-    0xED, 0x14, 0x1C, 0xE3, 0xED, 0x21, 0x69, 0x78, 0x5C, 0x8C, 0x3D, 0x83, 0xB6, 0x5C, 0xEA, 0x93,
-    0xE6, 0x45, 0x17, 0xB7, 0x9D, 0x3A, 0xF9, 0x39, 0x68, 0x00, 0x09, 0xC7, 0xF8, 0x96, 0xC2, 0xB9,
-    0x9D, 0x80, 0x47, 0x2B, 0x69, 0xD4, 0xEB, 0x4D, 0x81, 0x97, 0xF8, 0xB7, 0xD8, 0xBF, 0x4E, 0xD7,
-    0x91, 0x30, 0x81, 0xF9, 0x03, 0x60, 0xCC, 0x85, 0x77, 0x37, 0x8C, 0x53, 0x6A, 0xF7, 0x35, 0xFF,
-    0x6E, 0xAD, 0x2E, 0xF2, 0x58, 0x87, 0xC7, 0xC3, 0x19, 0xB8, 0x4B, 0xCE, 0x8D, 0x6E, 0xE5, 0x94,
-    0x19, 0x18, 0x24, 0x0C, 0x82, 0xE6, 0x70, 0x8C, 0xA9, 0x4B, 0xBE, 0x84, 0x82, 0xCC, 0x19, 0x95,
-    0xF9, 0x93, 0x34, 0x9D, 0xFD, 0xF0, 0x5F, 0xB2, 0x3C, 0x66, 0x36, 0x78, 0xFC, 0x25, 0x3A, 0xC5,
-    0x93, 0xB0, 0x80, 0x29, 0x2A, 0x1E, 0xB2, 0xF1, 0x14, 0x09, 0x4C, 0x7C, 0x1C, 0x02, 0x5C, 0xE5,
-    0xC2, 0xBF, 0xC2, 0x23, 0xBD, 0xDE, 0x67, 0x5F, 0x9C, 0xF9, 0xD2, 0x9C, 0x4B, 0xB1, 0xAF, 0xDF,
-    0x3D, 0x74, 0xD9, 0x47, 0x3A, 0x1D, 0x5C, 0xF3, 0x74, 0x0E, 0x2E, 0x41, 0x4C, 0xDF, 0xEF, 0x31,
-    0x2C, 0xFF, 0xD0, 0x06, 0x6C, 0x33, 0x58, 0x4C, 0xCC, 0x4D, 0x4E, 0x18, 0x98, 0x10, 0x00, 0x07,
-    0x8F, 0x72, 0x31, 0x13, 0x2B, 0xD8, 0x3B, 0x25, 0x78, 0xBE, 0xAD, 0xAB, 0xE6, 0xC9, 0x49, 0x56,
-    0x9C, 0x61, 0xF3, 0xED, 0xE9, 0x1F, 0x00, 0xE9, 0x1D, 0xC5, 0xAF, 0x64, 0x7E, 0x63, 0x9C, 0x06,
-    0xF6, 0xF4, 0x6B, 0xEB, 0x94, 0x77, 0x7A, 0x83, 0x11, 0xA0, 0x32, 0xDF, 0xBD, 0x8C, 0xF2, 0x12,
-    0x81, 0xEB, 0x53, 0xF2, 0x60, 0x1E, 0x9F, 0x85, 0xC4, 0xA4, 0xB9, 0xBD, 0x45, 0x06, 0xF6, 0x2B,
-    0x65, 0xBA, 0xB2, 0x56, 0xC1, 0x60, 0x9E, 0xF5, 0x3E, 0xBD, 0xAD, 0xF0, 0x38, 0x18, 0x63, 0x64,
-    0x3A, 0x56, 0x9E, 0x9A, 0x60, 0x71, 0xBF, 0x75, 0xD9, 0x9A, 0xBE, 0x06, 0xB2, 0x5F, 0x8F, 0x5E,
-    0xE2, 0x8C, 0xBE, 0xA6, 0xFD, 0x7A, 0x5F, 0xB3, 0x4F, 0xB3, 0x6D, 0x0A, 0xBE, 0x2A, 0x03, 0x5F,
-    0x73, 0x26, 0x6B, 0x77, 0xCF, 0x00, 0xD6, 0xF2, 0x24, 0x60, 0xC5, 0xA7, 0x01, 0xEB, 0x8C, 0x8E,
-    0x60, 0x02, 0xAC, 0xC5, 0x31, 0x60, 0x25, 0x27, 0x00, 0xEB, 0x4C, 0x05, 0x64, 0xF5, 0x08, 0xC6,
-    0x78, 0x13, 0x2E, 0x20, 0x1A, 0xB4, 0xCA, 0x47, 0x66, 0x9F, 0xBD, 0xA2, 0x77, 0x7D, 0xC4, 0x55,
-    0x03, 0x1D, 0x4A, 0xA7, 0x3A, 0xA8, 0xC5, 0x3A, 0x5E, 0xFC, 0xD3, 0xB9, 0xF3, 0x43, 0x4A, 0xB6,
-    0xC1, 0x13, 0x0E, 0x1E, 0x48, 0xC3, 0x28, 0xB7, 0x3B, 0x04, 0x27, 0x81, 0x4E, 0x7C, 0x4D, 0x6F,
-    0x3F, 0x35, 0x34, 0x48, 0xBD, 0xB5, 0x96, 0x2A, 0xE4, 0xDD, 0xF6, 0xBB, 0x57, 0xFA, 0xF8, 0x38,
-    0xEC, 0xFE, 0x4C, 0x49, 0x48, 0x65, 0x32, 0x11, 0x0F, 0xF8, 0xB7, 0xD0, 0x72, 0xFF, 0xEA, 0x40,
-    0x5C, 0xEA, 0x35, 0x30, 0x1D, 0x21, 0x16, 0x0C, 0xB2, 0x3F, 0xBB, 0x0C, 0x39, 0x76, 0xC9, 0xF8,
-    0x85, 0x73, 0x79, 0x2F, 0x50, 0xF0, 0x7D, 0x96, 0x2F, 0x4F, 0xFD, 0x9A, 0x3F, 0x96, 0xCB, 0xE2,
-    0xEB, 0x28, 0x89, 0x62, 0x2D, 0xBD, 0xC6, 0x04, 0xD7, 0xB6, 0xB5, 0x7A, 0x49, 0x85, 0x9F, 0x8A,
-    0x88, 0xEA, 0x25, 0x03, 0xCF, 0x20, 0x5B, 0x44, 0xB1, 0xA4, 0xE8, 0x03, 0xD6, 0x75, 0x34, 0x60,
-    0xBF, 0x3E, 0x06, 0xB3, 0xE3, 0xFB, 0x64, 0xE4, 0x73, 0xAB, 0x1D, 0x17, 0xAC, 0x98, 0x1F, 0x55,
-    0xDC, 0x3B, 0xB7, 0x9F, 0x31, 0xE3, 0xD2, 0x44, 0x9D, 0xF2, 0x15, 0x30, 0x0F, 0xC4, 0x1E, 0x63,
-    0x7C, 0xA7, 0xC0, 0x35, 0xA1, 0x09, 0x93, 0xDE, 0x02, 0x60, 0x60, 0x22, 0x3D, 0xF9, 0x65, 0x76,
-    0x4F, 0xE1, 0x2A, 0xB3, 0x70, 0xF1, 0xBE, 0x82, 0xB3, 0x42, 0x6F, 0x53, 0xF4, 0x4A, 0x68, 0x89,
-    0xC6, 0xCB, 0xAF, 0x9B, 0x1B, 0x4F, 0x72, 0x30, 0xE6, 0xB9, 0xCB, 0x5C, 0x64, 0xCD, 0x80, 0x28,
-    0x24, 0xEA, 0x67, 0x83, 0x7F, 0x41, 0xC0, 0xCC, 0xBF, 0x23, 0x40, 0x3A, 0xDC, 0x32, 0x96, 0xE4,
-    0x90, 0x61, 0x3F, 0x1B, 0x8A, 0x3C, 0xAB, 0x97, 0x03, 0x02, 0x43, 0x8C, 0xBB, 0x30, 0xBE, 0xDD,
-    0xC8, 0x88, 0xFC, 0x95, 0x2E, 0xA9, 0x38, 0xAF, 0x37, 0xDB, 0xF8, 0x1E, 0xD3, 0xFC, 0x6F, 0x36,
-    0xD1, 0x63, 0xBE, 0xA5, 0x71, 0xBB, 0x0E, 0x9F, 0x30, 0x42, 0xD4, 0x15, 0xB3, 0xB8, 0xBB, 0x5E,
-    0xEE, 0xF3, 0x40, 0xFE, 0x61, 0xB5, 0x38, 0x92, 0x1A, 0x94, 0x73, 0x7F, 0x50, 0xEA, 0xAF, 0x31,
-    0xAF, 0x8A, 0xFA, 0x10, 0x5E, 0x35, 0x7A, 0xC1, 0x85, 0x13, 0xC5, 0x24, 0x83, 0x15, 0xCF, 0xE1,
-    0x94, 0xB5, 0x89, 0xF8, 0x72, 0x83, 0xA4, 0x50, 0x15, 0xAD, 0x3F, 0x51, 0x73, 0xC5, 0x91, 0x96,
-    0xEE, 0xDB, 0xDA, 0xE9, 0xF5, 0x16, 0x9E, 0xE6, 0xFA, 0x2C, 0x6F, 0x33, 0xD6, 0x55, 0x33, 0xF6,
-    0xC0, 0x57, 0x00, 0xE6, 0x4C, 0xA4, 0xA1, 0x5F, 0x06, 0x4A, 0x30, 0x6F, 0x3A, 0x88, 0x72, 0xC5,
-    0x3D, 0x79, 0x95, 0x7E, 0xA4, 0x4B, 0x4E, 0xEC, 0x07, 0x61, 0xD9, 0x27, 0x0D, 0xFC, 0x7E, 0x24,
-    0x8D, 0x12, 0x09, 0x8C, 0xC9, 0x23, 0xBF, 0x1F, 0x8C, 0x5C, 0x96, 0x03, 0x59, 0x4A, 0xF2, 0xC8,
-    0xEF, 0x07, 0x26, 0x11, 0xED, 0xDB, 0x94, 0x1D, 0xF0, 0x08, 0x95, 0x1C, 0xCF, 0x2F, 0xD2, 0x21,
-    0xA9, 0x82, 0x32, 0xA5, 0x15, 0x74, 0xA8, 0x3C, 0x9D, 0xC4, 0x81, 0x3C, 0x5D, 0xE3, 0xA3, 0xD8,
-    0x9F, 0x9C, 0xFB, 0x4C, 0x5B, 0x35, 0x9D, 0xD9, 0x9D, 0x5B, 0xAD, 0x56, 0x04, 0xBF, 0x9B, 0x26,
-    0x8B, 0x95, 0xE5, 0x0E, 0x9E, 0xA4, 0x2C, 0xF5, 0xD6, 0x56, 0x2E, 0x2A, 0x3B, 0x57, 0x6A, 0x65,
-    0x3C, 0xDF, 0xF6, 0x67, 0x9B, 0x3E, 0x00, 0x64, 0x14, 0x9A, 0xF4, 0xAB, 0x55, 0x3C, 0x9E, 0xBB,
-    0xEF, 0x4F, 0x79, 0x26, 0x0C, 0x73, 0xA5, 0x64, 0xDC, 0x1E, 0x32, 0x38, 0xEF, 0xA1, 0xC2, 0x3A,
-    0xD3, 0x4D, 0x6A, 0x85, 0x53, 0xCF, 0x5C, 0x20, 0x8B, 0x5D, 0xE6, 0x4C, 0x5A, 0xF6, 0xB8, 0x60,
-    0xBA, 0x5A, 0x89, 0x0C, 0xF7, 0x95, 0x0D, 0x48, 0xE0, 0xE2, 0x3E, 0x9D, 0xC9, 0x17, 0x54, 0x4A,
-    0x10, 0xEC, 0x56, 0xAB, 0xF8, 0xCE, 0x97, 0x7D, 0xB1, 0x7B, 0xC6, 0xE2, 0x47, 0xF9, 0xDF, 0xA7,
-    0x02, 0x8C, 0x82, 0xF9, 0xD8, 0x06, 0x94, 0x3C, 0x65, 0xA0, 0x18, 0xF0, 0xF5, 0xA4, 0x67, 0x2F,
-    0xA5, 0x4F, 0x62, 0x0D, 0xD0, 0x2B, 0xE5, 0x7E, 0x02, 0xD9, 0x7B, 0xA9, 0xF7, 0x89, 0xCA, 0xE7,
-    0x35, 0xC8, 0xD9, 0x19, 0xFA, 0xD4, 0xC1, 0x8F, 0x69, 0xA0, 0xEC, 0xEA, 0xF8, 0x9A, 0x26, 0x4F,
-    0xA9, 0xFF, 0xD2, 0xEC, 0xFE, 0x79, 0xBD, 0xAB, 0x90, 0x5D, 0x87, 0xD0, 0x98, 0xB7, 0xFB, 0x2F,
-    0xE7, 0xFE, 0xFA, 0xBE, 0xFB, 0x1D, 0xD5, 0x5B, 0x3D, 0xB0, 0xDC, 0xD6, 0x75, 0xBE, 0x00, 0xC4,
-    0x07, 0x0F, 0x31, 0x13, 0xB8, 0x10, 0x1B, 0x32, 0x36, 0xDC, 0x9A, 0x0D, 0x1A, 0xD7, 0xBE, 0x20,
-    0x39, 0x19, 0x17, 0x2E, 0xA4, 0x78, 0xB8, 0x2A, 0xE2, 0x82, 0x2E, 0xD2, 0x44, 0x29, 0xD8, 0xA4,
-    0x15, 0x01, 0x4A, 0x65, 0x0A, 0x3D, 0x15, 0x99, 0x14, 0x29, 0xC2, 0x82, 0x99, 0x21, 0x97, 0xE3,
-    0x61, 0xE3, 0xC2, 0x85, 0x68, 0x40, 0xD2, 0x64, 0x54, 0xB0, 0x10, 0x24, 0x26, 0xA3, 0x99, 0xB8,
-    0xE0, 0x66, 0x4C, 0xD9, 0x63, 0xAA, 0x30, 0x44, 0x83, 0x7E, 0xE0, 0x23, 0x80, 0x93, 0xEF, 0x3B,
-    0x17, 0xD8, 0xDD, 0xF7, 0xC8, 0x71, 0x64, 0x5A, 0x7E, 0x9A, 0xB7, 0xF3, 0xF6, 0xEE, 0x2E, 0x2E,
-    0x70, 0xEF, 0xF9, 0xB9, 0xE7, 0x3B, 0x3F, 0xF7, 0xBE, 0x13, 0x99, 0xDC, 0x95, 0x7C, 0x94, 0xC7,
-    0xF2, 0xDE, 0x0D, 0xC3, 0x57, 0x30, 0xC6, 0x9D, 0x5D, 0xC9, 0x5B, 0x12, 0xF7, 0xF9, 0x17, 0xF2,
-    0xA1, 0x24, 0x7D, 0xFE, 0x08, 0xB7, 0xA4, 0x7D, 0xF9, 0x07, 0xB9, 0x2F, 0x97, 0x07, 0xBD, 0xC9,
-    0x44, 0x2B, 0x34, 0xBF, 0x98, 0xBE, 0x9C, 0x91, 0xD1, 0xC4, 0x22, 0x7D, 0x20, 0x22, 0x05, 0xDE,
-    0x4D, 0x22, 0x1F, 0x5F, 0xF6, 0x05, 0x3D, 0xB6, 0xC7, 0x80, 0x52, 0x18, 0x93, 0xB7, 0xC6, 0x84,
-    0x92, 0x6D, 0x7F, 0xE9, 0xD8, 0x55, 0xB9, 0x7B, 0x7C, 0x69, 0xCC, 0xDF, 0xC7, 0xB2, 0x5F, 0x66,
-    0xA5, 0x48, 0xEB, 0x63, 0x8C, 0x2C, 0xC4, 0x17, 0xB3, 0x23, 0x0F, 0x0E, 0xCD, 0x65, 0x2E, 0x9A,
-    0xF9, 0x55, 0x8E, 0x99, 0x89, 0x44, 0x3A, 0x93, 0xF2, 0xD6, 0x1C, 0xF3, 0x1A, 0x19, 0x7E, 0xBC,
-    0x32, 0xF8, 0xCC, 0x8C, 0xD4, 0xB8, 0xE3, 0x39, 0x0D, 0x6E, 0x93, 0xC3, 0x8D, 0xF7, 0x9C, 0xFB,
-    0x3C, 0x92, 0xA6, 0xA4, 0x47, 0xA3, 0x71, 0x8F, 0x8D, 0xE5, 0x73, 0x1A, 0x1F, 0xC4, 0x9B, 0xD4,
-    0xDB, 0xB5, 0x24, 0x5A, 0x40, 0xB4, 0x74, 0x6C, 0x8A, 0x78, 0xBC, 0xD4, 0x9B, 0xBC, 0x8A, 0x5B,
-    0x7F, 0x30, 0xF1, 0x2A, 0x6A, 0x8C, 0xAD, 0xD2, 0xDA, 0x60, 0xC2, 0x22, 0xEC, 0x8C, 0x14, 0x79,
-    0x4D, 0x61, 0x19, 0x8B, 0x86, 0x5F, 0x24, 0x78, 0x52, 0xFE, 0x6B, 0x1B, 0x14, 0x26, 0xCC, 0x1C,
-    0x6B, 0x0D, 0x08, 0xF8, 0x10, 0x62, 0xB2, 0x5D, 0xDA, 0x43, 0x5E, 0x24, 0x49, 0x56, 0x91, 0x98,
-    0xA4, 0x37, 0xB6, 0x01, 0x59, 0xBE, 0x14, 0xB6, 0x31, 0x71, 0x4F, 0xE2, 0xCA, 0x1A, 0xB4, 0x06,
-    0x92, 0x42, 0xA0, 0xE9, 0x9E, 0x90, 0x7E, 0x32, 0x10, 0x49, 0xAF, 0x74, 0x17, 0x18, 0x89, 0xA2,
-    0x49, 0x1C, 0xA7, 0xFC, 0x6A, 0x62, 0xD5, 0x22, 0xEF, 0x3A, 0x71, 0x69, 0x5C, 0xFC, 0xD1, 0x1B,
-    0xB6, 0xBE, 0x2E, 0xD2, 0x5F, 0xFE, 0x61, 0x28, 0x2F, 0x6F, 0x35, 0x8F, 0x6F, 0x4C, 0xAA, 0x38,
-    0xF1, 0xA3, 0x83, 0x1D, 0x68, 0xFE, 0xAE, 0x30, 0xA7, 0x6F, 0x72, 0xBC, 0x16, 0x3A, 0xEA, 0x31,
-    0x78, 0x97, 0x36, 0x5E, 0x63, 0xA1, 0xC2, 0x14, 0x13, 0x24, 0x18, 0x35, 0xC6, 0x0A, 0xF1, 0xB1,
-    0x74, 0x20, 0x80, 0x3A, 0xDE, 0xC7, 0xAA, 0x59, 0xA5, 0x7D, 0x5A, 0x87, 0xBD, 0xAD, 0x83, 0x21,
-    0x6D, 0x82, 0x21, 0x19, 0x82, 0x3E, 0x96, 0xFB, 0xBD, 0x4F, 0x92, 0x72, 0x50, 0x10, 0x42, 0xCD,
-    0x26, 0x07, 0x5B, 0x11, 0x9E, 0x0E, 0x86, 0xEF, 0x98, 0x70, 0xB0, 0xBB, 0x49, 0x0F, 0x21, 0xB6,
-    0x78, 0x43, 0x3C, 0x10, 0xC6, 0x29, 0x15, 0xA0, 0xDF, 0xFB, 0x83, 0x6D, 0xEC, 0x1E, 0x84, 0x6B,
-    0x57, 0x76, 0x75, 0xDD, 0x5C, 0x5F, 0xAF, 0x1A, 0xCC, 0xC8, 0x5B, 0xB0, 0x5E, 0xC9, 0x58, 0xFA,
-    0xE4, 0x6F, 0x4A, 0x92, 0x54, 0x83, 0x52, 0x7C, 0x50, 0xDD, 0x0D, 0x3E, 0xA2, 0x31, 0x2B, 0x4D,
-    0x5C, 0x24, 0xD2, 0x45, 0x75, 0x5C, 0x25, 0xE3, 0x60, 0xFA, 0xA0, 0x8E, 0x57, 0x9E, 0x49, 0xCE,
-    0x37, 0xB8, 0xC1, 0x04, 0x4D, 0x1F, 0xE0, 0xC3, 0xBC, 0xFB, 0x7D, 0x8F, 0x52, 0x4E, 0xE2, 0x2C,
-    0xC7, 0x47, 0x78, 0xAF, 0x4E, 0x30, 0x82, 0xD7, 0xB6, 0x21, 0x57, 0xEA, 0x1B, 0x73, 0x67, 0x61,
-    0xB9, 0x78, 0xDF, 0x6F, 0xE2, 0x9A, 0x4F, 0xBE, 0xE1, 0x61, 0x62, 0xAF, 0x8B, 0x2B, 0xFB, 0xD9,
-    0x4F, 0x4D, 0xEF, 0xB5, 0x60, 0x3F, 0xBB, 0x62, 0x6C, 0x96, 0x60, 0x55, 0x98, 0xA0, 0xA5, 0xD2,
-    0x32, 0x2C, 0x13, 0xE8, 0x35, 0x83, 0x31, 0x66, 0x3B, 0x34, 0x16, 0xAC, 0xF0, 0x51, 0xD7, 0x05,
-    0x56, 0x3B, 0x5F, 0x8E, 0x4B, 0x5A, 0x52, 0x6D, 0x21, 0x58, 0x19, 0xBE, 0xE1, 0xA1, 0x7F, 0xDC,
-    0x91, 0xD1, 0x62, 0x5D, 0xEE, 0x8E, 0x62, 0x46, 0xF1, 0x47, 0xB9, 0x3D, 0xE6, 0x72, 0x25, 0xE9,
-    0xBE, 0xAF, 0x7C, 0x1B, 0xB3, 0x6B, 0x82, 0x0E, 0xA3, 0xFA, 0x52, 0xE5, 0xB0, 0xB1, 0xDA, 0x76,
-    0x9E, 0xAC, 0x60, 0x7D, 0xAE, 0x69, 0xD2, 0x01, 0x0D, 0xF4, 0x92, 0xB7, 0x31, 0xCD, 0x19, 0xB6,
-    0xE9, 0xBA, 0xD3, 0x41, 0xD7, 0x5B, 0x05, 0x83, 0xB5, 0x7D, 0x24, 0x19, 0x3A, 0xB0, 0x3C, 0xF3,
-    0x55, 0xDC, 0x99, 0xB0, 0x30, 0xCD, 0x5A, 0xB0, 0xBA, 0x76, 0x64, 0x8F, 0xCD, 0x7D, 0x36, 0x34,
-    0x19, 0xF2, 0x1F, 0xF3, 0x16, 0x5B, 0x71, 0x11, 0x11, 0x5E, 0x0E, 0x5E, 0x5A, 0x2C, 0x16, 0x97,
-    0x64, 0x7E, 0x3D, 0x5E, 0x2C, 0xFE, 0x24, 0x35, 0xBD, 0x29, 0x37, 0x0C, 0xD5, 0x54, 0x42, 0xF7,
-    0x50, 0x53, 0x0A, 0x19, 0x41, 0x4D, 0x51, 0x9D, 0x56, 0x50, 0x93, 0xDF, 0x06, 0x0D, 0xD4, 0x64,
-    0xEE, 0x98, 0x1E, 0x6A, 0x32, 0x69, 0x66, 0xA9, 0xA6, 0xA8, 0xB6, 0x05, 0xD4, 0x84, 0x25, 0x55,
-    0x41, 0x4D, 0x90, 0x67, 0x01, 0x35, 0x99, 0xF4, 0x56, 0x43, 0x35, 0x45, 0xF5, 0x40, 0x35, 0xF9,
-    0x6D, 0x5C, 0x41, 0x4D, 0xE6, 0x8E, 0xDF, 0x51, 0x4D, 0x7C, 0x12, 0x6A, 0x8A, 0xEA, 0xA8, 0x81,
-    0x9A, 0xCE, 0xB7, 0x66, 0xF8, 0x93, 0xD5, 0x64, 0xD4, 0xD0, 0x65, 0xD3, 0x9C, 0x5D, 0x2E, 0x97,
-    0x37, 0x79, 0xFD, 0xCC, 0x08, 0x43, 0x1D, 0x68, 0x25, 0xF6, 0xB3, 0xF2, 0xC3, 0xCE, 0xEF, 0x73,
-    0x93, 0x7C, 0xDA, 0x60, 0x8A, 0x2C, 0xB9, 0x37, 0x84, 0x7D, 0xAA, 0x80, 0xDA, 0xF8, 0x18, 0xCF,
-    0xE3, 0x12, 0xA6, 0x7C, 0x42, 0x8E, 0x9D, 0x70, 0x81, 0x71, 0x76, 0xEA, 0x7D, 0x7D, 0xE9, 0xC4,
-    0xA2, 0xFC, 0xEF, 0x05, 0xE5, 0x3E, 0xAC, 0x55, 0xF1, 0x3F, 0x4B, 0x79, 0xB8, 0x3C, 0x78, 0xD7,
-    0xE1, 0x07, 0x4F, 0x5E, 0x73, 0x34, 0x1E, 0x7C, 0x50, 0x75, 0xC8, 0xCB, 0x97, 0x3B, 0x02, 0x0A,
-    0x74, 0x19, 0x7F, 0x2E, 0xE7, 0x2A, 0x5B, 0x9B, 0xB8, 0x35, 0x61, 0x0F, 0x9E, 0x61, 0xB8, 0xF3,
-    0x1F, 0xBF, 0x2F, 0x2E, 0xE0, 0x1E, 0xC7, 0xE0, 0x7F, 0x2E, 0x16, 0xAF, 0x7A, 0xE5, 0x03, 0xB0,
-    0xB5, 0x02, 0x07, 0xE6, 0x49, 0xD2, 0xE9, 0x9C, 0x51, 0x6B, 0x5E, 0x13, 0xA8, 0xB4, 0x30, 0xE0,
-    0xE7, 0x64, 0x49, 0x63, 0x06, 0x70, 0xF5, 0xDF, 0x33, 0xF9, 0x07, 0xE3, 0x6D, 0x9A, 0xF1, 0x79,
-    0x4C, 0xE4, 0x2D, 0x77, 0x8D, 0x79, 0xFD, 0x86, 0x11, 0x18, 0x46, 0x45, 0xC4, 0xEB, 0x4C, 0x5E,
-    0x9B, 0x53, 0x10, 0xE6, 0xAB, 0xE0, 0x0F, 0xEE, 0x23, 0x1E, 0x5F, 0xBC, 0x49, 0x46, 0xAC, 0xE2,
-    0x74, 0x04, 0x86, 0x58, 0x98, 0xC6, 0x39, 0x19, 0x15, 0xD7, 0xD1, 0x3C, 0x65, 0xF3, 0xAB, 0x31,
-    0xDF, 0x93, 0x37, 0x71, 0xDF, 0xCB, 0xCE, 0x4F, 0x7D, 0x99, 0xC6, 0x78, 0xAF, 0x2F, 0x97, 0x8A,
-    0x9D, 0x35, 0x58, 0x95, 0x96, 0xCD, 0x80, 0x55, 0xDB, 0xA4, 0x3F, 0x80, 0x38, 0xA2, 0x4F, 0xF0,
-    0xD3, 0x6F, 0xD1, 0x54, 0x77, 0x2C, 0x2F, 0xBE, 0xC2, 0x8B, 0xF7, 0x0E, 0x5D, 0xFC, 0x21, 0x2F,
-    0x7E, 0xAC, 0x17, 0x2D, 0x2F, 0x86, 0xBC, 0x98, 0xE5, 0xB8, 0xC8, 0x85, 0xEA, 0x63, 0x9A, 0xB8,
-    0xBA, 0x43, 0xE8, 0x48, 0xB1, 0x9E, 0x70, 0x11, 0xCB, 0xE9, 0x85, 0x2F, 0xBE, 0x1B, 0x55, 0x67,
-    0xDE, 0x94, 0x8F, 0x24, 0x1F, 0xE0, 0xF2, 0x8B, 0x8B, 0xB8, 0x8A, 0x75, 0x0C, 0x31, 0x47, 0x10,
-    0x49, 0x15, 0xF5, 0x39, 0xBC, 0x4E, 0x63, 0xA1, 0xAE, 0xD3, 0xBB, 0x11, 0xEC, 0xFE, 0x63, 0x19,
-    0x72, 0xB9, 0xB7, 0x3F, 0x7C, 0x2B, 0x05, 0x26, 0x1B, 0xFB, 0x9C, 0xC6, 0x2D, 0x71, 0x18, 0x27,
-    0x50, 0x0C, 0xEC, 0xE7, 0x57, 0x05, 0x8E, 0xEE, 0xA3, 0x26, 0xDC, 0xEB, 0xBD, 0x01, 0xDE, 0x2E,
-    0xAF, 0xD2, 0x4F, 0xBB, 0xB8, 0x01, 0xFA, 0x03, 0x4B, 0x4D, 0xE9, 0x24, 0x56, 0x98, 0xEF, 0x28,
-    0x12, 0x31, 0x10, 0x80, 0x0F, 0x28, 0x9B, 0x84, 0x80, 0xE3, 0xD3, 0xC7, 0x35, 0x70, 0x77, 0xC9,
-    0xA8, 0xD8, 0x53, 0x13, 0x7B, 0x7A, 0xDC, 0xA2, 0x58, 0xA4, 0xFD, 0x91, 0x78, 0x84, 0x79, 0x3C,
-    0x14, 0xC2, 0x2E, 0xE8, 0x07, 0xE1, 0x19, 0xCA, 0x2A, 0x6D, 0x4D, 0x50, 0x99, 0x9F, 0xCD, 0xB6,
-    0xC6, 0x30, 0x21, 0x2F, 0xD4, 0x83, 0x83, 0x40, 0x18, 0xA5, 0xBA, 0x9C, 0x80, 0x60, 0x44, 0x8F,
-    0x8A, 0x47, 0x22, 0x30, 0xF8, 0x06, 0xD6, 0x1E, 0x21, 0xE8, 0x6F, 0x75, 0xF9, 0x1A, 0x0A, 0x20,
-    0x21, 0x2C, 0xE1, 0x56, 0x9A, 0x32, 0x86, 0x0D, 0x7B, 0xC5, 0x21, 0xF0, 0xA9, 0xDD, 0xF8, 0x96,
-    0xAF, 0xD0, 0x1D, 0xB7, 0x0C, 0x0B, 0xCA, 0xAA, 0x2C, 0xD2, 0x11, 0xDD, 0x41, 0xEF, 0x81, 0xB3,
-    0xA8, 0xB7, 0x2B, 0xFA, 0xB3, 0x13, 0xE7, 0xC4, 0xDC, 0x61, 0xD4, 0x10, 0x77, 0xE1, 0xEF, 0x35,
-    0x70, 0xA8, 0xEC, 0x2B, 0x8C, 0x74, 0x06, 0xBF, 0x73, 0xBE, 0x2F, 0xA9, 0xD8, 0x4D, 0x61, 0xE1,
-    0xF6, 0xA8, 0xA3, 0xF7, 0x27, 0x21, 0x31, 0xAD, 0x4D, 0x09, 0x41, 0x37, 0x09, 0xE1, 0x77, 0x37,
-    0xD0, 0x9A, 0x23, 0x93, 0x37, 0xCA, 0x02, 0xA3, 0x25, 0x50, 0x03, 0x99, 0x35, 0xCA, 0xE1, 0xCC,
-    0x52, 0x72, 0xA9, 0x51, 0x68, 0x3D, 0x81, 0xE7, 0x39, 0x19, 0x79, 0xC9, 0xAB, 0x2D, 0x9E, 0xE0,
-    0x81, 0xD5, 0xA4, 0xE9, 0x5D, 0x19, 0x48, 0xA5, 0x4D, 0x04, 0xCF, 0x5C, 0x29, 0x53, 0x74, 0xB2,
-    0x69, 0x93, 0xAE, 0x34, 0xA0, 0x6A, 0x6C, 0xF5, 0x46, 0x0C, 0xF1, 0x37, 0x52, 0x7C, 0x13, 0x62,
-    0x20, 0x57, 0x14, 0x90, 0x12, 0x15, 0x33, 0x82, 0xC3, 0x77, 0xDB, 0xB8, 0xEF, 0x0C, 0x94, 0x54,
-    0xBE, 0x84, 0x39, 0xA0, 0x03, 0xA5, 0x56, 0x16, 0xDA, 0x4D, 0xC4, 0x97, 0x87, 0x37, 0xF9, 0x98,
-    0x47, 0x20, 0xC7, 0x63, 0xFA, 0x09, 0x9E, 0x3C, 0x07, 0xEC, 0x4E, 0x61, 0x24, 0x4E, 0xC0, 0x12,
-    0xF8, 0x05, 0x1F, 0x10, 0x45, 0x46, 0xBA, 0xE3, 0xF3, 0xA3, 0x93, 0x08, 0xD6, 0x8A, 0xAA, 0x26,
-    0xA9, 0x95, 0x0D, 0x60, 0x48, 0xA8, 0x71, 0x65, 0xAD, 0xAA, 0x89, 0xA5, 0xA6, 0x30, 0xCC, 0xE9,
-    0xB2, 0x8E, 0x75, 0x7D, 0x59, 0xA8, 0x46, 0x63, 0x96, 0x0B, 0xD0, 0x99, 0x57, 0x04, 0x50, 0x4D,
-    0xD2, 0x87, 0xFB, 0xE5, 0x17, 0x42, 0x07, 0x27, 0xF2, 0x0A, 0x22, 0x12, 0x38, 0x8B, 0x36, 0xAF,
-    0xAE, 0x88, 0xD9, 0xF9, 0x8F, 0x60, 0x08, 0xF6, 0x7A, 0x15, 0x4A, 0x7A, 0x49, 0x69, 0x3E, 0xD7,
-    0x53, 0x68, 0x51, 0x17, 0xBF, 0xA7, 0x2C, 0x55, 0xBF, 0xD0, 0xD9, 0x46, 0x6A, 0x2A, 0x03, 0x21,
-    0x89, 0x52, 0x2E, 0xB0, 0x4F, 0x51, 0x20, 0x44, 0x14, 0xA2, 0x8C, 0x93, 0x46, 0x25, 0x84, 0x4F,
-    0x33, 0x5C, 0x4D, 0x27, 0x22, 0x8D, 0x1D, 0xA6, 0x50, 0x97, 0x38, 0x68, 0x5E, 0x36, 0x5B, 0xAF,
-    0x93, 0xD7, 0xCD, 0xA4, 0xE6, 0x96, 0xF7, 0x50, 0x0E, 0xA0, 0x21, 0xD7, 0x65, 0xCB, 0xE8, 0x96,
-    0x0E, 0xAF, 0x99, 0xE3, 0xE8, 0xCC, 0x09, 0x9D, 0x5F, 0xBE, 0x89, 0x2B, 0x97, 0x49, 0x51, 0x47,
-    0xE8, 0xA9, 0x10, 0x8A, 0x0E, 0x2A, 0x51, 0x6F, 0x89, 0x01, 0xFD, 0xA5, 0x22, 0x7A, 0xAC, 0x3A,
-    0x57, 0x32, 0x5C, 0x48, 0x69, 0xA6, 0xB0, 0xD6, 0xE9, 0x91, 0x61, 0xDB, 0xAB, 0x1B, 0x4A, 0x52,
-    0x52, 0xE1, 0xAC, 0xC4, 0x68, 0xB4, 0xC5, 0x01, 0xF4, 0x36, 0x8D, 0x08, 0x4D, 0xB2, 0xCF, 0xE1,
-    0x02, 0xB9, 0x44, 0x1E, 0x6C, 0xC3, 0x71, 0x22, 0xD1, 0xE0, 0x50, 0x56, 0xA5, 0x86, 0x8C, 0x08,
-    0x53, 0x21, 0x80, 0xCA, 0x82, 0x13, 0xDB, 0xE1, 0x0B, 0xCD, 0x1B, 0xF1, 0x2A, 0x67, 0xC6, 0x52,
-    0x8F, 0x89, 0xFC, 0x2E, 0x46, 0x68, 0xE9, 0x28, 0xA1, 0x6C, 0x8D, 0x7C, 0x7B, 0xF5, 0x3B, 0xB4,
-    0xED, 0x87, 0xCB, 0x72, 0x54, 0xF6, 0x85, 0x80, 0x80, 0xD1, 0x2F, 0x68, 0xC0, 0xDE, 0x39, 0xE6,
-    0x3F, 0x24, 0x7D, 0xE9, 0xC0, 0x10, 0x50, 0x45, 0x62, 0x4E, 0x2E, 0x33, 0xB5, 0xCF, 0x95, 0x12,
-    0xAC, 0x0E, 0xD7, 0xC5, 0xAA, 0xBA, 0x12, 0x9D, 0x54, 0xC1, 0x62, 0x66, 0x8E, 0x2F, 0x8F, 0x27,
-    0x97, 0x2E, 0x14, 0xEA, 0x5C, 0x50, 0x41, 0x7A, 0x93, 0xA7, 0x24, 0x31, 0x1C, 0x19, 0x02, 0x7B,
-    0x98, 0xBB, 0x51, 0x16, 0x4F, 0x1D, 0x5F, 0x1E, 0x5F, 0x52, 0x15, 0xC5, 0x83, 0xA7, 0xF9, 0xE0,
-    0x88, 0x68, 0x0A, 0x9C, 0x6A, 0x0E, 0xF2, 0x6B, 0xD1, 0x40, 0xD9, 0x27, 0xBD, 0x27, 0x8C, 0x77,
-    0x8C, 0xF5, 0x38, 0xC5, 0x80, 0x15, 0xFD, 0x4D, 0x34, 0x84, 0xA4, 0xB4, 0xAC, 0x19, 0xD0, 0x86,
-    0x3D, 0xC1, 0xC3, 0x9C, 0xCE, 0x4E, 0x6F, 0x2F, 0xD3, 0x63, 0xC9, 0xA3, 0xE7, 0xB0, 0xC4, 0x99,
-    0xA3, 0x55, 0x98, 0x09, 0x1F, 0xAB, 0x3D, 0xBE, 0xAB, 0xD9, 0x50, 0x54, 0x5D, 0x51, 0x4E, 0x2E,
-    0xD5, 0x1B, 0xB6, 0xA6, 0xDB, 0x9C, 0x27, 0x10, 0x7D, 0x34, 0xD6, 0xA0, 0xD3, 0x93, 0xDB, 0x84,
-    0x72, 0xFB, 0x98, 0x93, 0x04, 0xE2, 0x7C, 0x4A, 0xC3, 0xE9, 0xE3, 0x31, 0xD2, 0x14, 0xB7, 0xA6,
-    0x2F, 0x4C, 0x7B, 0x62, 0x21, 0xDC, 0x31, 0x31, 0x2E, 0x6F, 0x09, 0x6E, 0xE8, 0x8D, 0x47, 0x45,
-    0xD1, 0x29, 0xA5, 0x95, 0x4C, 0x33, 0xF3, 0xCE, 0x85, 0xE0, 0x15, 0x93, 0x73, 0xCC, 0x57, 0x8E,
-    0xCB, 0x5B, 0x02, 0x8F, 0xCD, 0x09, 0x3D, 0x4E, 0x5C, 0xB6, 0x44, 0xE9, 0x50, 0xDE, 0x72, 0x25,
-    0x09, 0xE2, 0x89, 0x8F, 0x18, 0x18, 0x22, 0x4E, 0x5C, 0x4A, 0x2D, 0x9A, 0x55, 0xA7, 0xEE, 0x71,
-    0x13, 0xCC, 0x17, 0xF2, 0xE9, 0x42, 0x3C, 0x5D, 0xF0, 0xE4, 0x7D, 0x07, 0xB1, 0xB6, 0x4B, 0x7A,
-    0x97, 0xA2, 0x4D, 0x98, 0x5B, 0xAE, 0xDC, 0x05, 0x2C, 0x75, 0xBD, 0x00, 0x8D, 0x24, 0xCA, 0xB8,
-    0x6D, 0x3D, 0x95, 0x3B, 0x83, 0x5D, 0x8D, 0x06, 0x64, 0xE5, 0x2E, 0xE0, 0x7E, 0xBD, 0x00, 0xDF,
-    0xE1, 0xCB, 0x67, 0x8B, 0x8B, 0x66, 0x4E, 0xA9, 0x22, 0x65, 0x65, 0x22, 0x4B, 0x7D, 0xD7, 0x74,
-    0x21, 0xA0, 0xD2, 0xFA, 0xB9, 0x80, 0x50, 0x19, 0x95, 0x45, 0x32, 0x2E, 0x97, 0xEF, 0x28, 0x69,
-    0xA0, 0x94, 0xCA, 0xE3, 0xA0, 0x9F, 0x82, 0x35, 0xBD, 0x40, 0xDD, 0x25, 0x8E, 0x97, 0x69, 0xDD,
-    0x3D, 0x51, 0x0B, 0xEC, 0xD8, 0x3B, 0xEA, 0xFA, 0xC0, 0x34, 0x0F, 0x11, 0x6A, 0x21, 0xDA, 0xA9,
-    0xE9, 0x99, 0x10, 0x3B, 0xAB, 0xA2, 0x94, 0xB9, 0x82, 0x8C, 0x68, 0xD1, 0x44, 0x73, 0xBA, 0x7E,
-    0xEE, 0x09, 0x1C, 0x7D, 0xEB, 0x8B, 0xEA, 0xE3, 0x9D, 0x31, 0x50, 0xD0, 0xF8, 0x5D, 0xF1, 0x37,
-    0xBE, 0xFE, 0x04, 0x33, 0xFE, 0x58, 0x6B, 0x47, 0xAE, 0x1E, 0x52, 0xF9, 0x5A, 0x83, 0x88, 0x74,
-    0x3D, 0xC4, 0xFF, 0xC5, 0x59, 0x5A, 0x27, 0x2E, 0x17, 0xA5, 0x4D, 0x89, 0xA4, 0xBA, 0x59, 0x46,
-    0x40, 0x98, 0xAA, 0x75, 0x21, 0xA8, 0x39, 0xBD, 0xE4, 0xC0, 0x85, 0xA3, 0x88, 0x0B, 0x24, 0xD6,
-    0xDA, 0xD2, 0x94, 0x38, 0xA9, 0xB2, 0xB4, 0x6A, 0xB3, 0xF5, 0x1E, 0x69, 0x2B, 0xCF, 0xBC, 0x5B,
-    0x15, 0x41, 0x7F, 0xE0, 0xFD, 0x78, 0x71, 0xF1, 0xB9, 0xF7, 0xF2, 0xBD, 0xBF, 0x5C, 0x1E, 0x1A,
-    0x57, 0x34, 0x89, 0xA1, 0x00, 0x28, 0x09, 0xAA, 0x21, 0x75, 0xF9, 0xCE, 0x8C, 0xD5, 0x47, 0x4A,
-    0xCB, 0xD9, 0x1B, 0x1C, 0x84, 0x0A, 0x2F, 0x42, 0x41, 0x9C, 0xD4, 0xA5, 0xAD, 0xAD, 0xC3, 0xE1,
-    0xD4, 0x54, 0x4E, 0x3B, 0x5A, 0xB9, 0x30, 0x79, 0x8F, 0x9A, 0xA4, 0x8B, 0xFB, 0x04, 0x36, 0x12,
-    0xB7, 0x71, 0xE7, 0xEF, 0xFA, 0xBB, 0x33, 0xEE, 0x1D, 0x25, 0x2D, 0xD0, 0x10, 0xE3, 0x07, 0xAE,
-    0xCD, 0x64, 0x8A, 0x68, 0xCB, 0x6A, 0x92, 0x09, 0x4C, 0xEA, 0x1E, 0xED, 0x45, 0x04, 0x39, 0x1C,
-    0x02, 0xC9, 0x81, 0xF6, 0xC9, 0x91, 0x5E, 0xE4, 0xC3, 0x53, 0x73, 0xEA, 0xEC, 0x7A, 0xCC, 0xDA,
-    0xEC, 0x2C, 0x0B, 0xAE, 0x0E, 0x18, 0x47, 0xC4, 0x34, 0x22, 0x63, 0x96, 0x3B, 0x61, 0x28, 0x48,
-    0x43, 0x9E, 0xC8, 0x04, 0x11, 0x99, 0x61, 0x13, 0x11, 0x9F, 0x7B, 0x5D, 0xFF, 0x2F, 0xF2, 0x11,
-    0x32, 0x59, 0x12, 0x84, 0xF5, 0xF3, 0x98, 0xD9, 0xA1, 0xD5, 0xB0, 0x8A, 0xBB, 0xE4, 0xC0, 0x6A,
-    0x80, 0xE5, 0xB5, 0xF1, 0xF4, 0x8E, 0x68, 0x8A, 0x25, 0x9E, 0x21, 0xC2, 0xFE, 0xB9, 0xEF, 0x7C,
-    0x34, 0x24, 0x25, 0xDE, 0x1A, 0xDF, 0xD5, 0xEA, 0xFA, 0x7C, 0x65, 0xF7, 0xC6, 0x50, 0x6C, 0xBD,
-    0x5D, 0xAB, 0xFB, 0x0B, 0x6B, 0x00, 0x30, 0xF3, 0x5B, 0x57, 0xB3, 0x51, 0xC4, 0xD0, 0x0F, 0xC5,
-    0x51, 0x33, 0x39, 0x0C, 0x90, 0x9C, 0xF2, 0x36, 0xA4, 0x67, 0xA2, 0xF4, 0xB3, 0x32, 0x4D, 0x0F,
-    0x53, 0xF1, 0x87, 0xED, 0x7D, 0x2D, 0xBB, 0xBE, 0x0F, 0x57, 0x02, 0x3F, 0x68, 0xB5, 0x4C, 0xC3,
-    0xCC, 0xFE, 0xF0, 0x0F, 0x77, 0xDB, 0xD6, 0x33, 0x91, 0xF3, 0x57, 0x6E, 0x34, 0x37, 0xB4, 0xCE,
-    0xF3, 0x70, 0xAA, 0x65, 0x13, 0x68, 0xD5, 0x71, 0x6D, 0x68, 0xD3, 0x5A, 0x18, 0x32, 0x87, 0x53,
-    0xEA, 0xFA, 0xE2, 0x8A, 0xC8, 0xFF, 0xEF, 0xAB, 0x39, 0x52, 0xB2, 0xFF, 0xC6, 0x08, 0x31, 0x66,
-    0x1E, 0x6C, 0xBC, 0xAD, 0x40, 0x02, 0xF2, 0x66, 0x5D, 0x98, 0x60, 0x28, 0x77, 0xE9, 0x27, 0xEC,
-    0x23, 0x8E, 0x1A, 0xC3, 0x56, 0x1A, 0xED, 0x18, 0xB5, 0x83, 0x54, 0x3C, 0x92, 0xBC, 0x67, 0xC7,
-    0x5D, 0xD6, 0xF7, 0x90, 0xF6, 0xC1, 0x7D, 0xDE, 0x1D, 0xD2, 0x81, 0x1D, 0x17, 0x90, 0x7C, 0xF7,
-    0x65, 0x9D, 0x23, 0x55, 0x4D, 0xA1, 0x33, 0x76, 0x00, 0xC7, 0xD1, 0x91, 0xA5, 0x03, 0x3B, 0x02,
-    0xF9, 0x00, 0x1D, 0xA6, 0xEC, 0xD0, 0x01, 0x40, 0x66, 0x87, 0x27, 0x9F, 0xA3, 0x83, 0x68, 0x8E,
-    0x0E, 0xA8, 0x1C, 0x1D, 0x20, 0xF5, 0x11, 0xE7, 0x16, 0x76, 0xF8, 0xDA, 0x81, 0xFE, 0xBB, 0xEA,
-    0x73, 0x91, 0x37, 0x2D, 0x77, 0xB7, 0x32, 0x16, 0x7B, 0x30, 0x63, 0x29, 0xB6, 0x33, 0x96, 0x0D,
-    0x7B, 0x5E, 0x49, 0x07, 0x31, 0x15, 0xAC, 0x4B, 0xF5, 0x60, 0xAA, 0xBE, 0x2C, 0x92, 0xF1, 0x16,
-    0xB8, 0xD5, 0xF5, 0xD2, 0x30, 0xFB, 0x4F, 0x5C, 0xE4, 0x52, 0x76, 0xAC, 0x1D, 0x87, 0xE0, 0xB8,
-    0xE0, 0x1C, 0x04, 0x10, 0xBA, 0x78, 0xA3, 0x61, 0x4C, 0xC3, 0x1F, 0xBF, 0xE3, 0x8F, 0x64, 0xDC,
-    0xFA, 0x91, 0x0E, 0xEE, 0xB6, 0x5F, 0xBA, 0x67, 0x72, 0x0D, 0x7D, 0x3E, 0x70, 0xA3, 0xB9, 0xA1,
-    0x33, 0xA1, 0x8D, 0xC1, 0x4A, 0xC7, 0x7F, 0xC4, 0x8C, 0xD6, 0xAD, 0x23, 0xD1, 0xEC, 0xDE, 0xD7,
-    0xD8, 0x8A, 0x1F, 0x0F, 0xB6, 0xAA, 0x81, 0x07, 0xF3, 0x16, 0xCD, 0x58, 0x93, 0x3F, 0x9E, 0xB7,
-    0x1C, 0x53, 0x4E, 0x5D, 0xF6, 0x12, 0x6C, 0x67, 0x2F, 0xE9, 0x53, 0x8D, 0x1A, 0x06, 0xBA, 0x71,
-    0x64, 0x2F, 0xE9, 0xE1, 0xEC, 0xE5, 0x98, 0x72, 0x8A, 0x1C, 0x46, 0xB5, 0xC8, 0x1C, 0x26, 0x74,
-    0x39, 0x8C, 0xFC, 0x3F, 0x39, 0xCC, 0x71, 0x5D, 0xBD, 0x2E, 0x93, 0x29, 0x5C, 0x26, 0x13, 0x69,
-    0xBA, 0x51, 0xC3, 0xA2, 0x99, 0xC9, 0xD0, 0x6A, 0x4F, 0x9B, 0x67, 0x32, 0x99, 0xE3, 0xCA, 0xE9,
-    0x4B, 0xA6, 0x35, 0x41, 0x6D, 0x6B, 0x23, 0x3F, 0x90, 0x0C, 0xD1, 0xFC, 0x80, 0x20, 0x2E, 0xDF,
-    0x93, 0x82, 0x55, 0x6D, 0x8C, 0xD4, 0xB9, 0xCC, 0x20, 0xD0, 0x04, 0x49, 0x81, 0x9C, 0x99, 0x47,
-    0x82, 0x40, 0xB6, 0xC8, 0x9B, 0x1C, 0x11, 0xFC, 0xD5, 0xCE, 0x84, 0xCD, 0x8E, 0x31, 0x7F, 0x7D,
-    0x38, 0xB3, 0xFB, 0x2B, 0x95, 0xC9, 0xFF, 0x0E, 0x2E, 0xF9, 0xAA, 0x54, 0x26, 0xED, 0x46, 0x26,
-    0xB7, 0x9D, 0x4C, 0x62, 0x95, 0x09, 0x6E, 0xA1, 0x4C, 0xAC, 0x50, 0x26, 0xF1, 0x53, 0xCA, 0xC4,
-    0x13, 0x95, 0x89, 0x7D, 0x9F, 0x32, 0x89, 0x5B, 0xCA, 0xC4, 0x1B, 0x55, 0x0C, 0xB6, 0xA2, 0x4C,
-    0xE2, 0x96, 0x3F, 0xBC, 0x51, 0x65, 0x62, 0x2B, 0xCA, 0xE4, 0xED, 0x96, 0x32, 0x19, 0x46, 0x95,
-    0x09, 0x67, 0x84, 0x4C, 0x5A, 0x90, 0x7F, 0x0E, 0x34, 0x1F, 0x96, 0x89, 0xEF, 0x64, 0x62, 0x95,
-    0xA8, 0x78, 0x5F, 0x65, 0x92, 0x3A, 0x99, 0x4C, 0x9A, 0x7D, 0x5D, 0x77, 0xFD, 0x26, 0xB3, 0x56,
-    0xFC, 0xCA, 0x9B, 0x4D, 0xAB, 0x85, 0xC7, 0xCD, 0x6A, 0x61, 0x58, 0x9E, 0xFF, 0x1E, 0x73, 0xFA,
-    0xF2, 0x11, 0x8B, 0x88, 0x62, 0x35, 0x18, 0xD0, 0xB5, 0xF0, 0x95, 0x5F, 0x76, 0x3E, 0x36, 0x67,
-    0x75, 0xB1, 0x21, 0xF5, 0x72, 0x5E, 0xC6, 0xD7, 0xDC, 0xBE, 0xB4, 0xE8, 0x86, 0xEB, 0xA0, 0x89,
-    0x5B, 0x4D, 0xF9, 0xB7, 0xEB, 0xFA, 0x97, 0x2B, 0x97, 0x69, 0x9A, 0xE7, 0x12, 0x96, 0xD8, 0x6D,
-    0xE2, 0xD4, 0xEB, 0x7C, 0x63, 0x03, 0xC6, 0xC7, 0x80, 0x1D, 0xE5, 0x26, 0x52, 0xF7, 0xA2, 0x96,
-    0x17, 0x8E, 0xE4, 0x24, 0x5F, 0xA1, 0x0D, 0x06, 0x46, 0x99, 0x5B, 0x88, 0x7B, 0x0C, 0xD8, 0x71,
-    0x3E, 0xD1, 0x94, 0x64, 0x84, 0x95, 0x93, 0xB4, 0x63, 0x15, 0xD5, 0xD2, 0x30, 0xCD, 0x3F, 0x98,
-    0xEF, 0x1E, 0xB0, 0xAC, 0xE3, 0xC0, 0xCE, 0x59, 0x67, 0x3D, 0x2E, 0xA5, 0xAD, 0x35, 0x87, 0xD6,
-    0xD0, 0xA7, 0xDF, 0x32, 0x9E, 0x0D, 0x43, 0x2D, 0xA7, 0x26, 0x9A, 0xE5, 0x3D, 0xD3, 0x66, 0xD6,
-    0xAF, 0x8D, 0xDB, 0x03, 0x09, 0xB4, 0x2E, 0x10, 0xD2, 0x60, 0x6B, 0x66, 0xDC, 0xAE, 0x48, 0x03,
-    0x8B, 0x77, 0x64, 0xB5, 0x33, 0x5A, 0xC6, 0x9A, 0xDA, 0x87, 0x53, 0x79, 0xC0, 0x65, 0xE1, 0x6E,
-    0xA9, 0xF7, 0x9B, 0xC2, 0xA9, 0x7D, 0xE1, 0x36, 0x6F, 0xA6, 0xD4, 0x5C, 0xCB, 0x32, 0x5A, 0x6B,
-    0x2E, 0xF7, 0x6F, 0x6A, 0xCD, 0x65, 0x15, 0xCD, 0x1B, 0x62, 0x0D, 0x21, 0xEE, 0x91, 0x54, 0x67,
-    0x80, 0x45, 0xB8, 0xF1, 0x36, 0xA0, 0x4C, 0x10, 0xDD, 0xD9, 0x91, 0xC5, 0x8E, 0xA7, 0xDC, 0x42,
-    0xC4, 0xA5, 0x14, 0x69, 0xDE, 0x0E, 0xEE, 0xC2, 0xEB, 0x9F, 0x59, 0xD6, 0x48, 0xA7, 0xC2, 0x36,
-    0x9C, 0xE7, 0xC3, 0xEB, 0xDB, 0xC3, 0x1F, 0x98, 0xD1, 0xB8, 0x92, 0xB7, 0xB9, 0x2C, 0xB2, 0xAB,
-    0x40, 0xDE, 0x69, 0x75, 0x64, 0x74, 0xB5, 0x1F, 0x86, 0xD7, 0x80, 0x7E, 0x4B, 0xE8, 0x2F, 0x40,
-    0x2E, 0xC1, 0xB9, 0x65, 0xBE, 0xA7, 0x7B, 0x81, 0x8C, 0xBE, 0xCA, 0x1E, 0x2D, 0x41, 0x3C, 0x6F,
-    0x59, 0x39, 0xD0, 0xCD, 0x6F, 0xB4, 0x44, 0x03, 0x7C, 0xC7, 0x34, 0x6C, 0x5B, 0xBD, 0x47, 0x78,
-    0xBF, 0x70, 0xF3, 0x1C, 0x63, 0x36, 0x68, 0x7D, 0xA0, 0xB2, 0x9E, 0x48, 0x60, 0x6B, 0xD7, 0xED,
-    0xF7, 0xF4, 0x8A, 0xFD, 0x9C, 0xBD, 0xCC, 0x04, 0xB4, 0xAD, 0x39, 0xE6, 0x38, 0x43, 0xA3, 0x42,
-    0x68, 0xD9, 0x1D, 0xD8, 0x49, 0xB4, 0xD3, 0xEE, 0xD3, 0x06, 0x6E, 0x76, 0xCA, 0xEB, 0x54, 0x9C,
-    0x22, 0xF3, 0xA0, 0xC9, 0xAE, 0x87, 0x15, 0xD6, 0xFA, 0x99, 0x56, 0xAC, 0xB4, 0xC2, 0x02, 0xCD,
-    0x9F, 0x58, 0x4A, 0xBF, 0x33, 0x0B, 0xF9, 0x2E, 0xFD, 0x07, 0x56, 0x8A, 0x1D, 0x70, 0x8B, 0xEC,
-    0x71, 0x99, 0xDC, 0x1F, 0x40, 0x6E, 0xDE, 0x7B, 0xBA, 0x39, 0x4B, 0xF9, 0x8E, 0x74, 0x02, 0x9F,
-    0x08, 0x12, 0x2A, 0xB8, 0xEC, 0xC5, 0x24, 0xC3, 0x6B, 0x73, 0xA1, 0xAB, 0x99, 0xF0, 0x8F, 0xA0,
-    0xA1, 0xE8, 0xB7, 0x06, 0xBF, 0x23, 0x23, 0xC7, 0x47, 0x6A, 0x6C, 0xB8, 0x2F, 0xC5, 0x0C, 0x15,
-    0xD4, 0xD0, 0x51, 0xBF, 0x27, 0x45, 0xDC, 0x19, 0xC9, 0x4E, 0xAD, 0x4F, 0x00, 0x1D, 0x19, 0x39,
-    0x5E, 0x86, 0xBC, 0x1C, 0x69, 0x72, 0x15, 0xCB, 0x93, 0x91, 0xF5, 0x89, 0x36, 0x78, 0x52, 0x82,
-    0x9C, 0x0A, 0x40, 0xF4, 0xF2, 0x3A, 0xA6, 0x3B, 0x3A, 0x65, 0x4D, 0xE7, 0x5B, 0x0C, 0x2B, 0x28,
-    0xB0, 0xBF, 0x9C, 0x9B, 0x7B, 0x10, 0xD1, 0xF6, 0x21, 0x97, 0xA3, 0x24, 0xE7, 0xD4, 0x5C, 0xDD,
-    0x2B, 0x19, 0x0E, 0x3D, 0x66, 0xC1, 0xB1, 0xC0, 0xBA, 0xB9, 0xC2, 0x03, 0x32, 0x43, 0xCE, 0xF4,
-    0xB5, 0x9F, 0xAB, 0x77, 0x33, 0xA0, 0x7B, 0xB7, 0x7F, 0xAB, 0xC1, 0x4F, 0xC6, 0xAA, 0x69, 0x96,
-    0xEA, 0x41, 0xAC, 0x7F, 0x29, 0x07, 0xB3, 0xEB, 0xE0, 0xC8, 0x15, 0xF5, 0x2A, 0xEF, 0xF5, 0x52,
-    0xBC, 0x72, 0x42, 0x02, 0xCC, 0x7D, 0x0B, 0xC0, 0x8B, 0x27, 0x78, 0x0E, 0x65, 0xE0, 0x5E, 0xF1,
-    0x1E, 0x0F, 0x89, 0xDD, 0xE7, 0x19, 0x2E, 0x06, 0x2B, 0x2C, 0x00, 0x95, 0x0D, 0x94, 0x53, 0x02,
-    0x34, 0xCE, 0x89, 0x8B, 0x40, 0x76, 0x64, 0xD7, 0x83, 0x20, 0x80, 0x0B, 0x43, 0xA2, 0xB1, 0x8E,
-    0xD6, 0x7D, 0x6A, 0x57, 0xBD, 0x65, 0xDC, 0xF4, 0x1A, 0x2D, 0xB3, 0x43, 0x64, 0x83, 0x5C, 0x59,
-    0xCB, 0xB3, 0x80, 0x0A, 0x2D, 0xA2, 0xBB, 0xBA, 0x0C, 0xE4, 0x33, 0x2E, 0x6F, 0xBB, 0x2A, 0x28,
-    0x5E, 0xD1, 0xF4, 0x99, 0xCA, 0xC3, 0x52, 0xCF, 0x72, 0x0C, 0x0E, 0x09, 0x49, 0xD2, 0x64, 0xCC,
-    0x79, 0xEF, 0x3E, 0x4B, 0xDD, 0xFC, 0xE5, 0xD9, 0xA5, 0xC2, 0xFB, 0xB9, 0x75, 0x8F, 0x21, 0xEA,
-    0x92, 0x8E, 0x9F, 0x91, 0x3B, 0x2D, 0xD0, 0x79, 0x40, 0x84, 0x1D, 0x02, 0x17, 0x6D, 0x8C, 0xFE,
-    0xC1, 0x2B, 0x1F, 0x90, 0xD8, 0x9E, 0x81, 0x69, 0x65, 0xF5, 0xCE, 0x7D, 0xF1, 0x80, 0x3F, 0x3F,
-    0x49, 0xC7, 0xAD, 0xE3, 0x72, 0x7A, 0x2E, 0xCD, 0x76, 0x07, 0xBE, 0x6C, 0x9D, 0xA4, 0x7B, 0x29,
-    0x96, 0xFA, 0x52, 0x41, 0xE8, 0xD4, 0x13, 0x79, 0x7A, 0x46, 0xEE, 0x0C, 0x13, 0x91, 0x88, 0xF1,
-    0xED, 0x38, 0x27, 0x9C, 0xBA, 0xA7, 0x0A, 0xC5, 0xBD, 0x94, 0x70, 0x17, 0x57, 0x4B, 0xE1, 0xB5,
-    0xF3, 0xA1, 0x0A, 0x4F, 0xA9, 0x1E, 0x10, 0x71, 0x0E, 0xA3, 0x9E, 0xF1, 0xC9, 0xC5, 0x43, 0x17,
-    0xD7, 0xA1, 0xFD, 0x2E, 0x0B, 0x28, 0xA3, 0xA6, 0x3B, 0x15, 0x27, 0x6B, 0x62, 0x79, 0xA7, 0xEC,
-    0x12, 0x0A, 0x33, 0xA5, 0x24, 0x55, 0x8C, 0x96, 0x32, 0xA4, 0x0C, 0xB6, 0x9B, 0x6E, 0x76, 0x23,
-    0x9A, 0xED, 0x27, 0xAE, 0xA4, 0x0C, 0x59, 0xE9, 0x11, 0x3A, 0x07, 0xE4, 0xBA, 0xC3, 0x1A, 0x51,
-    0x3E, 0x3C, 0xFC, 0x31, 0xA1, 0x54, 0x38, 0x2D, 0xDD, 0xE9, 0x69, 0xC2, 0x94, 0x56, 0x78, 0x37,
-    0x07, 0x03, 0x8F, 0x96, 0x2A, 0x05, 0xAB, 0xD0, 0x55, 0xD1, 0x19, 0x98, 0x3C, 0xE5, 0xBC, 0x40,
-    0xAB, 0x60, 0x44, 0x90, 0x02, 0xE0, 0x98, 0xE1, 0xF3, 0x88, 0x65, 0xA5, 0xD1, 0x83, 0x29, 0x61,
-    0xEE, 0x05, 0x0F, 0x53, 0xBC, 0x47, 0x4F, 0x4B, 0x94, 0xF8, 0xEE, 0xC1, 0x90, 0xE9, 0x48, 0xA9,
-    0x3A, 0x7B, 0x93, 0x3E, 0x26, 0xD0, 0x1D, 0x0E, 0x96, 0xC3, 0xB9, 0xF7, 0xA5, 0x5A, 0x5B, 0xE8,
-    0x79, 0xCD, 0x17, 0xFE, 0x3B, 0x7B, 0x43, 0x8B, 0x69, 0xB5, 0x3B, 0x2D, 0x64, 0xEB, 0x29, 0x80,
-    0xC2, 0x8C, 0xB6, 0x7D, 0xF1, 0x3F, 0x57, 0xBF, 0xD7, 0x20, 0x0E, 0x12, 0x90, 0x2A, 0x6D, 0x6D,
-    0x53, 0x56, 0x51, 0xBF, 0x98, 0x97, 0x1A, 0xE5, 0xAC, 0x9B, 0x6B, 0x5F, 0xE1, 0x5B, 0x8F, 0x95,
-    0xE5, 0x6F, 0x09, 0xF7, 0xBC, 0xE2, 0x3E, 0x6D, 0xD2, 0xE6, 0x2C, 0x72, 0xEA, 0xF9, 0xC5, 0x19,
-    0xC1, 0x2F, 0x37, 0xBD, 0x08, 0x52, 0x7C, 0xE0, 0xCF, 0xF9, 0xE9, 0x65, 0x4C, 0xE9, 0x06, 0x9F,
-    0x19, 0xEC, 0x6F, 0x46, 0x2D, 0x85, 0x16, 0x0E, 0x09, 0xF4, 0xDC, 0xA8, 0xD1, 0xB8, 0xD5, 0x72,
-    0xC3, 0x39, 0xAC, 0x19, 0x75, 0x15, 0x2E, 0x31, 0x62, 0x50, 0x24, 0x97, 0x5B, 0x33, 0x6D, 0x0D,
-    0x61, 0xDD, 0xE8, 0x26, 0x62, 0x3E, 0x78, 0xC2, 0x92, 0x61, 0x2C, 0x6F, 0x33, 0x46, 0xFD, 0x15,
-    0x46, 0xB0, 0x1D, 0x37, 0x1A, 0x47, 0x0D, 0xBC, 0xDE, 0xE6, 0x19, 0x90, 0x7B, 0x4C, 0x3E, 0x1B,
-    0x66, 0xAF, 0x7D, 0x8C, 0xB0, 0x6C, 0xF0, 0xD7, 0xBB, 0x3E, 0x1A, 0xBB, 0x19, 0x07, 0x53, 0xCE,
-    0x66, 0xD4, 0xED, 0xDA, 0x16, 0x6E, 0x84, 0xB5, 0x4E, 0x5F, 0xA3, 0x6A, 0xFA, 0xDD, 0xA0, 0x01,
-    0x30, 0x6F, 0xCA, 0x9C, 0xA7, 0xB2, 0x33, 0x4F, 0x4C, 0xFE, 0x31, 0x71, 0xFC, 0x37, 0xA4, 0x82,
-    0xAE, 0x20, 0x07, 0x6A, 0x0E, 0xB9, 0xF0, 0x90, 0xD7, 0xC0, 0x33, 0x5F, 0x3D, 0x4F, 0x7F, 0x75,
-    0xEB, 0xE6, 0xC5, 0x8E, 0x8F, 0x71, 0xF9, 0xCE, 0xFB, 0x5A, 0xD6, 0x1D, 0x0D, 0x62, 0xA5, 0x8E,
-    0xC7, 0x6E, 0x59, 0xCB, 0xDA, 0x8E, 0x94, 0xBC, 0xF2, 0x9A, 0x96, 0xD1, 0x2B, 0x77, 0x7E, 0x91,
-    0x5E, 0x0E, 0x31, 0xFA, 0xAF, 0xA5, 0x0F, 0x79, 0xA4, 0xED, 0x4D, 0x3D, 0xE8, 0xC4, 0xE3, 0x36,
-    0x03, 0x24, 0x13, 0xCA, 0x2B, 0xB4, 0xBE, 0x67, 0xC4, 0x45, 0x19, 0x7E, 0xA2, 0xE2, 0xD2, 0x83,
-    0x97, 0xB0, 0x2C, 0x0A, 0x98, 0x42, 0x5A, 0x1F, 0xD4, 0xE5, 0x1C, 0xC3, 0x66, 0x5E, 0x4D, 0xFC,
-    0xDC, 0x5E, 0x58, 0x3B, 0xA7, 0xE3, 0x0A, 0xDA, 0x9A, 0x55, 0x6C, 0x72, 0xD8, 0xAF, 0x83, 0x3A,
-    0xCF, 0x11, 0x37, 0xCC, 0xA7, 0x93, 0xCB, 0xDF, 0xF5, 0xD3, 0xC1, 0xE5, 0x1C, 0x26, 0xB5, 0x9D,
-    0x92, 0x7E, 0x2D, 0xD4, 0x65, 0x08, 0x4D, 0xE0, 0xEA, 0xEE, 0x70, 0x2F, 0xBA, 0xD4, 0xB4, 0xAD,
-    0xF2, 0xB0, 0x80, 0x2A, 0x73, 0x87, 0x1B, 0x42, 0x5B, 0x85, 0xBB, 0xAF, 0x47, 0xB3, 0x7A, 0x6E,
-    0x33, 0x5E, 0xF1, 0xBC, 0x37, 0xF1, 0x88, 0x36, 0x8C, 0x28, 0xA7, 0x32, 0x3B, 0xC5, 0x4E, 0x71,
-    0x10, 0xCD, 0xBF, 0x06, 0xEA, 0x5E, 0x9E, 0xCF, 0x91, 0xBA, 0x13, 0x5F, 0xD5, 0xE4, 0x8F, 0x83,
-    0x76, 0x8B, 0xB0, 0x67, 0x8F, 0x96, 0x8E, 0x13, 0xC5, 0xBB, 0xEB, 0x40, 0xA4, 0x9A, 0x2A, 0xE0,
-    0x1A, 0x62, 0x44, 0xF5, 0xFA, 0xD9, 0xCB, 0x0F, 0xFE, 0x49, 0xC1, 0xA1, 0x08, 0xE7, 0xC4, 0x1A,
-    0xB9, 0xD8, 0x28, 0x08, 0x8B, 0xE0, 0xAA, 0x80, 0x4B, 0xA1, 0xF4, 0x96, 0x59, 0x77, 0x3C, 0x06,
-    0xA3, 0x7C, 0x2A, 0xE7, 0x46, 0xFB, 0x58, 0x6A, 0xA1, 0xD1, 0xCA, 0x05, 0xA0, 0x4E, 0x7E, 0x95,
-    0x1B, 0x31, 0x48, 0xDA, 0x84, 0x27, 0x0A, 0x13, 0x59, 0x25, 0x90, 0x1F, 0xB2, 0x52, 0x9E, 0xDF,
-    0xD2, 0xD8, 0xC8, 0xB9, 0xBD, 0xC2, 0x1F, 0xB9, 0xCB, 0xF2, 0x6D, 0x6F, 0x5D, 0x74, 0xD8, 0x04,
-    0x41, 0xD3, 0xDE, 0x75, 0xF5, 0xDC, 0x20, 0xE8, 0xAB, 0x3D, 0x96, 0x9A, 0xC3, 0xB7, 0x9E, 0x97,
-    0x51, 0x77, 0x81, 0x62, 0x1E, 0x4B, 0x05, 0xD3, 0xF7, 0x46, 0x23, 0xE0, 0x6D, 0xBB, 0x5A, 0x15,
-    0xCE, 0x7B, 0xFB, 0xCE, 0x01, 0xCB, 0x33, 0x41, 0xD0, 0x11, 0x53, 0xA5, 0x41, 0x50, 0x74, 0x28,
-    0x08, 0xBA, 0x8A, 0x0C, 0x02, 0xF9, 0xD2, 0x56, 0x10, 0x74, 0xD4, 0xB2, 0x9A, 0x82, 0x20, 0xE8,
-    0xEE, 0x2A, 0xEB, 0xA6, 0x57, 0x9F, 0x1F, 0x04, 0x1D, 0x39, 0x55, 0x8A, 0x85, 0xD3, 0x29, 0x88,
-    0xF5, 0xCA, 0xCA, 0xF5, 0xF4, 0x4B, 0x7B, 0x20, 0x92, 0x5D, 0xE0, 0xFE, 0xC5, 0x0F, 0x79, 0x68,
-    0xB5, 0x57, 0xE3, 0x7C, 0x4B, 0xEB, 0x11, 0x89, 0x6E, 0x84, 0x32, 0x47, 0x9B, 0xFF, 0x23, 0x84,
-    0x3B, 0x89, 0x48, 0x05, 0xE0, 0xD3, 0x93, 0x9E, 0xE5, 0x24, 0xE1, 0xE1, 0xA2, 0x68, 0x54, 0x3F,
-    0xFF, 0xC5, 0xFA, 0x9F, 0x43, 0x92, 0xE9, 0x9F, 0x43, 0x9A, 0xD9, 0x7E, 0xAD, 0xB3, 0x39, 0x3D,
-    0x16, 0xAE, 0x0E, 0x6C, 0x53, 0xFD, 0xF4, 0x37, 0x6E, 0x8E, 0x9B, 0x72, 0xDE, 0x2D, 0x76, 0xA5,
-    0x2E, 0x93, 0x73, 0x27, 0xDD, 0xEB, 0xB9, 0x7E, 0x75, 0xF6, 0x9A, 0xF9, 0x92, 0xC7, 0xA5, 0xCF,
-    0x3C, 0x30, 0x34, 0xC3, 0x2C, 0xDF, 0xA3, 0xB7, 0x66, 0xAC, 0x99, 0xCB, 0xE7, 0xF4, 0xD6, 0x2C,
-    0x98, 0xF0, 0x1F, 0x0D, 0xD6, 0x3E, 0x5A, 0x28, 0xD7, 0xED, 0xA6, 0x9B, 0x1A, 0x4A, 0x38, 0xA1,
-    0x57, 0xB7, 0x80, 0xE7, 0x77, 0xF8, 0xEC, 0xE4, 0xF3, 0x1B, 0x0E, 0x0A, 0x2B, 0x2F, 0x59, 0xD5,
-    0x01, 0x9E, 0x7F, 0xE9, 0xF3, 0xDB, 0xEE, 0xFF, 0x28, 0xBA, 0xA0, 0x23, 0x04, 0x95, 0x3C, 0xBF,
-    0x4A, 0xB1, 0x29, 0xBC, 0x7A, 0xD7, 0xBC, 0x6B, 0xDB, 0xF0, 0x7A, 0x2C, 0xD4, 0xF1, 0x7F, 0xD5,
-    0x5C, 0xBF, 0x93, 0xDC, 0x56, 0x72, 0x7E, 0xC0, 0x88, 0x3B, 0x55, 0x44, 0xD9, 0x50, 0xC0, 0x75,
-    0x9D, 0xC8, 0x00, 0x89, 0x23, 0xBA, 0x5C, 0xF8, 0x0B, 0x5C, 0x80, 0xA4, 0x2A, 0x2B, 0x60, 0xA0,
-    0x0D, 0x38, 0x17, 0x9C, 0x03, 0x5E, 0xA0, 0x88, 0x17, 0xEC, 0x7F, 0x70, 0x18, 0x9F, 0x83, 0x0B,
-    0x2E, 0x10, 0xCF, 0x55, 0x8A, 0x1C, 0xDC, 0x9E, 0xCD, 0x60, 0x39, 0x1B, 0x30, 0x71, 0xE0, 0x44,
-    0x07, 0x9C, 0x18, 0x30, 0x60, 0x20, 0x9C, 0x58, 0x2E, 0x05, 0x0A, 0x38, 0x57, 0x3A, 0x9D, 0xEB,
-    0x28, 0x97, 0x09, 0x52, 0x90, 0x38, 0xBB, 0x04, 0xD0, 0xEE, 0xEF, 0x6B, 0x60, 0x66, 0x96, 0xA2,
-    0x28, 0x8A, 0xE2, 0xAE, 0x96, 0x4B, 0xCE, 0xC3, 0x0C, 0x7E, 0xBC, 0xD7, 0xAF, 0xBB, 0x5F, 0xFF,
-    0x7E, 0x70, 0xDE, 0x64, 0x72, 0xD1, 0x39, 0x97, 0x89, 0x14, 0xCE, 0x8D, 0x45, 0x9A, 0xE5, 0x8F,
-    0xFE, 0x4A, 0xFF, 0x17, 0xCB, 0x54, 0xDB, 0x11, 0xAF, 0xEB, 0x0D, 0xA5, 0xB6, 0xA1, 0x74, 0xF8,
-    0x21, 0x52, 0x69, 0x1B, 0x1D, 0x48, 0x8A, 0xEB, 0x97, 0x16, 0xFA, 0x23, 0xA9, 0xD0, 0x41, 0x20,
-    0x61, 0x8B, 0xEB, 0xF3, 0x5C, 0x6F, 0x08, 0xDB, 0xB1, 0x38, 0xE7, 0x4B, 0x91, 0xD4, 0x7A, 0x7D,
-    0xA1, 0x5F, 0x74, 0xB4, 0x34, 0xD2, 0xEE, 0xF4, 0xAA, 0xCC, 0xB5, 0x33, 0xFC, 0xF7, 0x44, 0xFF,
-    0x6A, 0x1D, 0x4C, 0xFF, 0xA6, 0x23, 0xB4, 0x0D, 0xA0, 0x11, 0x29, 0x03, 0xB9, 0x3B, 0xCB, 0x3B,
-    0x87, 0xB1, 0xA4, 0x8A, 0x3A, 0xF4, 0xFE, 0x26, 0xA0, 0xC8, 0x16, 0x49, 0x83, 0x71, 0x6F, 0x02,
-    0xBE, 0xB8, 0xD5, 0x87, 0xB5, 0x93, 0xCA, 0x4D, 0x26, 0x13, 0x3D, 0x29, 0xAD, 0x76, 0xAA, 0xA7,
-    0x12, 0xED, 0x80, 0xA7, 0xEC, 0xEF, 0x67, 0x07, 0x29, 0x7A, 0x2D, 0x47, 0xD6, 0xB1, 0xCE, 0x36,
-    0xFA, 0x6C, 0x5B, 0xD2, 0xBF, 0x75, 0xE8, 0xD7, 0xA1, 0x3F, 0x8C, 0xF3, 0x93, 0xEB, 0x52, 0x6C,
-    0xEB, 0x45, 0xDC, 0xD0, 0xE4, 0x72, 0x57, 0xBE, 0xC0, 0x13, 0x77, 0x3A, 0xED, 0x32, 0xD3, 0x2E,
-    0x5B, 0x29, 0x3D, 0x79, 0xA8, 0x8F, 0xCA, 0x87, 0x00, 0x50, 0x41, 0xBE, 0xD7, 0x24, 0xD2, 0xC6,
-    0x55, 0x2C, 0x65, 0x56, 0x9C, 0xDA, 0xD2, 0x4E, 0x82, 0xD2, 0xC5, 0x8A, 0x94, 0xDC, 0x8D, 0x6B,
-    0xE0, 0x76, 0x4F, 0x88, 0x47, 0xE2, 0x0E, 0x50, 0x01, 0xD2, 0x05, 0x01, 0x7A, 0xD5, 0xBD, 0xAC,
-    0x88, 0xF6, 0x16, 0x6E, 0x3C, 0x1F, 0x57, 0x2E, 0x99, 0x86, 0xDD, 0xF5, 0xC6, 0x45, 0xA2, 0x23,
-    0xC4, 0x00, 0x37, 0x22, 0xE4, 0x69, 0x3F, 0xA9, 0x8D, 0xFC, 0x2A, 0x98, 0xAB, 0x05, 0x25, 0x5A,
-    0x97, 0xEB, 0x68, 0x5E, 0xF7, 0x63, 0xA9, 0xFD, 0xD4, 0xD3, 0xFB, 0xB5, 0xD3, 0x02, 0x93, 0x74,
-    0xA7, 0x66, 0xD2, 0x6C, 0x28, 0x0C, 0x95, 0xDE, 0x20, 0xB7, 0xA4, 0xBB, 0x2E, 0x49, 0x0B, 0x44,
-    0xCF, 0x9D, 0x22, 0x3A, 0x55, 0xDC, 0xB7, 0xDA, 0x6D, 0xD6, 0x78, 0xD2, 0x00, 0xD2, 0x07, 0x22,
-    0x9D, 0xDC, 0x10, 0xF9, 0x48, 0x7C, 0x69, 0xC7, 0x8D, 0x9B, 0xBC, 0x8C, 0x7C, 0x0A, 0x2E, 0x61,
-    0xEB, 0x13, 0x60, 0x97, 0xA4, 0xAB, 0x53, 0x4E, 0xD8, 0x86, 0xDD, 0x1C, 0x87, 0x9C, 0x93, 0xF0,
-    0x85, 0x3F, 0x36, 0x76, 0x89, 0x52, 0x80, 0x91, 0x92, 0x8B, 0x7D, 0xA0, 0x8D, 0x38, 0x75, 0x57,
-    0x74, 0xAC, 0x81, 0x8D, 0xB5, 0x01, 0x52, 0x3D, 0x60, 0x9C, 0x7C, 0x1C, 0xCB, 0x41, 0xDE, 0x00,
-    0xAB, 0x8D, 0xDE, 0xA4, 0x4D, 0x6D, 0x4D, 0xD6, 0x10, 0xAD, 0x89, 0xDD, 0xA2, 0x9C, 0xAC, 0xCB,
-    0xE6, 0x42, 0x63, 0x78, 0xDD, 0x4C, 0x43, 0x8C, 0x99, 0x00, 0xAF, 0x39, 0x06, 0xEF, 0x96, 0xB0,
-    0xC9, 0xFF, 0xA2, 0x01, 0xF2, 0x12, 0x34, 0x1B, 0x57, 0xB5, 0x39, 0x7F, 0x0D, 0x54, 0xC0, 0x3D,
-    0x5C, 0x4D, 0x44, 0x6D, 0x08, 0x58, 0x42, 0x40, 0xE5, 0x6D, 0x2D, 0x19, 0x3D, 0x97, 0x3F, 0x39,
-    0x80, 0x3D, 0x57, 0xC6, 0x90, 0x05, 0x9A, 0x46, 0xA7, 0xB2, 0xD7, 0x8D, 0x74, 0x51, 0x04, 0xAF,
-    0x73, 0x7D, 0xC8, 0x72, 0x22, 0xEC, 0x2B, 0x30, 0xD2, 0x15, 0xB6, 0x3E, 0xFB, 0x2B, 0xA1, 0xB8,
-    0x43, 0x27, 0x63, 0x0C, 0x38, 0xB6, 0xDF, 0x35, 0x19, 0x82, 0xBF, 0x6B, 0xE7, 0x4D, 0x73, 0xF9,
-    0x6C, 0xBB, 0x0A, 0x49, 0x2C, 0xD0, 0xCA, 0x71, 0xE9, 0x83, 0x88, 0x3A, 0xB5, 0x4D, 0x00, 0xE6,
-    0xCF, 0xAE, 0x28, 0x5C, 0x3A, 0x68, 0xD4, 0xE2, 0x19, 0x1D, 0x0D, 0xFD, 0x24, 0xF3, 0x35, 0xB8,
-    0xBD, 0x9C, 0x50, 0xB3, 0x87, 0x42, 0xF1, 0xB5, 0x08, 0xE4, 0x40, 0x3C, 0xED, 0xFE, 0xA7, 0x98,
-    0x33, 0xE1, 0x30, 0x42, 0x4F, 0xC1, 0x3E, 0x87, 0xBE, 0xF4, 0x97, 0x7C, 0x05, 0xF3, 0x95, 0x50,
-    0xCA, 0x4B, 0x0A, 0x8F, 0x2C, 0x40, 0xBD, 0xA9, 0x02, 0xB2, 0x70, 0xE7, 0x80, 0x48, 0x0F, 0x22,
-    0xF7, 0xFC, 0x2E, 0x26, 0x47, 0x46, 0xC1, 0x14, 0xA2, 0x47, 0x0A, 0x49, 0x54, 0xC7, 0xB5, 0x36,
-    0x9E, 0x00, 0x94, 0x53, 0xE9, 0x89, 0xC5, 0xA1, 0x3F, 0xD3, 0x2F, 0x58, 0x70, 0x00, 0x3D, 0xE8,
-    0x20, 0x24, 0xDF, 0x10, 0x97, 0x95, 0x41, 0xB3, 0x82, 0xFB, 0x38, 0x70, 0xB8, 0x81, 0xA1, 0x82,
-    0xEE, 0xF0, 0xBC, 0xD0, 0x87, 0xF3, 0x17, 0xEE, 0xD0, 0xDF, 0x09, 0xE4, 0xC3, 0x77, 0x70, 0x7F,
-    0xFD, 0x38, 0x2A, 0x82, 0xF9, 0x1A, 0xD4, 0xC7, 0x80, 0xC3, 0xCB, 0xA9, 0x9B, 0xE9, 0xD2, 0xF5,
-    0xF4, 0x49, 0x15, 0xB2, 0x53, 0xA8, 0xD2, 0x29, 0x44, 0x4E, 0x01, 0xE9, 0x4E, 0x03, 0x21, 0x3D,
-    0xB1, 0x38, 0x54, 0x51, 0x74, 0x7A, 0x87, 0xB0, 0x87, 0x6D, 0xBC, 0x30, 0xD0, 0x23, 0x28, 0x05,
-    0x42, 0xBE, 0x79, 0x71, 0x0D, 0x8B, 0x50, 0x47, 0xB8, 0x81, 0x1D, 0xCD, 0x81, 0x46, 0x97, 0xB5,
-    0xEE, 0x47, 0x94, 0xB4, 0x04, 0xC8, 0x0C, 0x82, 0x79, 0x8F, 0xC3, 0xB0, 0x1B, 0x18, 0x09, 0x20,
-    0x8E, 0x4C, 0x81, 0x14, 0xEE, 0x55, 0x62, 0x52, 0xC7, 0xEF, 0xA0, 0xE3, 0x16, 0x80, 0x64, 0x6E,
-    0xA8, 0x84, 0x62, 0xF2, 0xAF, 0x39, 0x7F, 0xD7, 0x8D, 0x3A, 0x97, 0x97, 0xFA, 0x48, 0x48, 0xE9,
-    0x82, 0x1E, 0xC7, 0x62, 0xB8, 0xC0, 0x64, 0x4F, 0x4D, 0x56, 0xD8, 0x3C, 0xD8, 0x82, 0xF5, 0x22,
-    0x04, 0xDC, 0x7A, 0x54, 0x18, 0xD1, 0x28, 0x46, 0x0B, 0x15, 0xCB, 0x80, 0x4B, 0xC5, 0x75, 0x03,
-    0xBC, 0xE8, 0xC3, 0xBE, 0xDA, 0x26, 0x85, 0x3E, 0xF1, 0xA1, 0x00, 0x64, 0x9C, 0x56, 0x0D, 0xA3,
-    0x7D, 0xE6, 0x6A, 0x9F, 0xE8, 0xC5, 0x3B, 0x82, 0x31, 0xB2, 0xE5, 0xE9, 0xB5, 0xBB, 0xE3, 0x6E,
-    0xD9, 0x49, 0xA8, 0xCA, 0xD4, 0xFA, 0xDE, 0x53, 0xD8, 0x12, 0x0E, 0x4C, 0x95, 0xB6, 0x84, 0x64,
-    0xBF, 0x57, 0xE6, 0xD7, 0xFC, 0x6B, 0x84, 0x7A, 0x6C, 0xC0, 0x07, 0x8D, 0x1D, 0x16, 0x3C, 0x84,
-    0x95, 0x1D, 0xE6, 0x3C, 0x9C, 0x9E, 0xF2, 0x80, 0x66, 0x9F, 0x87, 0x5C, 0x15, 0x3B, 0x78, 0x4F,
-    0x1E, 0x11, 0x28, 0xCC, 0x4B, 0xBB, 0x7E, 0x84, 0x43, 0x24, 0x69, 0x22, 0x54, 0x25, 0x98, 0x9E,
-    0xC2, 0xC5, 0xC3, 0x82, 0x8F, 0xEB, 0x61, 0xFC, 0x8D, 0x87, 0xC6, 0x6E, 0xB1, 0x07, 0x94, 0xFD,
-    0x23, 0x76, 0xF6, 0xEB, 0x9C, 0x5D, 0x73, 0x84, 0xB1, 0x8D, 0xA7, 0xCC, 0x7B, 0x9B, 0x14, 0x55,
-    0x93, 0x61, 0xA9, 0x8C, 0x14, 0x96, 0xBF, 0xA4, 0x34, 0xCC, 0x94, 0xBC, 0x3E, 0x35, 0xBA, 0x29,
-    0x76, 0xFB, 0xA1, 0xA4, 0x6C, 0xF4, 0x77, 0x09, 0x4B, 0x40, 0xC1, 0x8B, 0x89, 0x2E, 0xFC, 0x50,
-    0xAA, 0xE3, 0x47, 0xD2, 0xF8, 0xC4, 0xE6, 0x07, 0x79, 0x37, 0x53, 0xFC, 0x2A, 0xDE, 0x2A, 0x5F,
-    0x47, 0xD1, 0xC7, 0x1F, 0xFB, 0x61, 0xB7, 0xAD, 0x3D, 0x13, 0xC8, 0x74, 0xD5, 0x9B, 0x75, 0xCD,
-    0x71, 0xEE, 0xF6, 0xFC, 0xA3, 0xF8, 0x27, 0x04, 0xE9, 0x0A, 0xB6, 0x2E, 0xED, 0x29, 0x40, 0x53,
-    0x87, 0x26, 0x03, 0x8C, 0x96, 0xD3, 0x7B, 0xF2, 0x17, 0x9A, 0xED, 0x0D, 0x4D, 0x82, 0x0A, 0xF3,
-    0x05, 0x63, 0xDA, 0x52, 0x02, 0x72, 0xCE, 0xEE, 0xC4, 0xC0, 0xD2, 0x42, 0xEF, 0xCE, 0xD5, 0x6C,
-    0x2A, 0x0C, 0xF3, 0xD4, 0xF7, 0x3E, 0x16, 0xAC, 0x2E, 0xA5, 0x42, 0xEF, 0x36, 0xDC, 0x6B, 0x07,
-    0x71, 0x83, 0x67, 0xB3, 0x8A, 0xB6, 0x4E, 0xA1, 0xA8, 0x1D, 0xF3, 0x74, 0xA4, 0xA7, 0x4B, 0x1D,
-    0xD2, 0xEE, 0x56, 0x1B, 0x2F, 0xEB, 0x3B, 0xA1, 0xF5, 0x53, 0x69, 0x7B, 0x1F, 0x8F, 0x29, 0x97,
-    0x3A, 0x13, 0xF6, 0xA7, 0x26, 0x93, 0x2D, 0x98, 0xE0, 0xC3, 0x07, 0xBF, 0xCD, 0x32, 0x93, 0x0E,
-    0x56, 0xDE, 0xDA, 0xA7, 0xC3, 0x4C, 0xBE, 0xF6, 0xA9, 0xB9, 0x3E, 0x9B, 0x43, 0x9F, 0x2F, 0x27,
-    0x17, 0x9F, 0x78, 0x2F, 0x3E, 0x07, 0xB3, 0xD9, 0x63, 0xFD, 0x8A, 0x59, 0xFE, 0x44, 0xE4, 0xAA,
-    0x59, 0x79, 0x03, 0x5E, 0x7E, 0xC5, 0x99, 0xCD, 0x0A, 0xA4, 0x81, 0xD9, 0x75, 0x7A, 0xBF, 0xCE,
-    0x17, 0x2A, 0xA6, 0xA2, 0x46, 0xB1, 0x16, 0xB6, 0x60, 0xB0, 0x2E, 0xE9, 0x66, 0xD7, 0x3B, 0xAE,
-    0x8A, 0xB5, 0x66, 0x31, 0xC8, 0x82, 0x95, 0x60, 0x0B, 0x65, 0xEA, 0xFD, 0x17, 0xC5, 0xA0, 0x4F,
-    0xEE, 0xC9, 0x60, 0x28, 0x2A, 0xBA, 0xAF, 0x50, 0x2E, 0xC5, 0x53, 0xF7, 0xF3, 0xA8, 0x70, 0x1D,
-    0xAC, 0xE5, 0xC0, 0xEE, 0x99, 0xEB, 0x2D, 0xE9, 0x60, 0x2A, 0x1F, 0x27, 0x5E, 0x68, 0xBB, 0x7B,
-    0x3A, 0x41, 0xB5, 0xAF, 0xEF, 0x82, 0x6C, 0xC6, 0xF9, 0x9D, 0x89, 0x58, 0xE7, 0x5E, 0x71, 0x3F,
-    0x04, 0x86, 0x9C, 0xA7, 0xC7, 0xA8, 0x31, 0xE1, 0xCF, 0x8F, 0x7E, 0x0F, 0xEA, 0xA5, 0xE2, 0x3B,
-    0x56, 0xCE, 0x71, 0xAF, 0xD1, 0x4B, 0xE3, 0x52, 0x2A, 0xFB, 0xC6, 0xE7, 0xA2, 0xCA, 0x53, 0x77,
-    0x48, 0x1B, 0x1F, 0x23, 0x86, 0x8E, 0x17, 0x03, 0xF0, 0x5D, 0xA3, 0xD2, 0xEC, 0xFF, 0x2C, 0xB5,
-    0x89, 0xE7, 0x9F, 0x83, 0x0E, 0xA6, 0x8F, 0x55, 0x17, 0x3C, 0x65, 0xF6, 0xF1, 0x0B, 0x9C, 0xBD,
-    0x6A, 0x94, 0xCD, 0x6C, 0xDA, 0x3B, 0x20, 0xF4, 0x97, 0x46, 0x78, 0x70, 0xCC, 0xA6, 0xFD, 0x29,
-    0xC8, 0x53, 0x0D, 0x5E, 0x55, 0x36, 0xBF, 0x3C, 0x75, 0xB3, 0x0B, 0xAA, 0xD3, 0xA7, 0xF9, 0x1F,
-    0xA4, 0x08, 0x55, 0xE4, 0x39, 0x88, 0x44, 0xBA, 0xA5, 0x93, 0xD5, 0x5A, 0x8B, 0xE9, 0x69, 0xD2,
-    0x99, 0x24, 0x82, 0x3A, 0x72, 0x9B, 0xF4, 0x54, 0x06, 0x56, 0xEC, 0x44, 0x4A, 0x51, 0x0C, 0xC7,
-    0x14, 0xFE, 0x11, 0x63, 0x02, 0x1F, 0xC8, 0x7F, 0x4F, 0xB6, 0x56, 0x77, 0x7C, 0xED, 0x91, 0xD9,
-    0xEC, 0xDF, 0xFB, 0x4E, 0x65, 0x18, 0xA5, 0x52, 0x23, 0x60, 0xE3, 0xAA, 0xAF, 0x7A, 0x4E, 0xC5,
-    0xF0, 0x1F, 0xCD, 0x5E, 0xC1, 0x7C, 0x69, 0xA8, 0x81, 0xC5, 0x27, 0x5B, 0x3F, 0xC8, 0x92, 0x73,
-    0xA7, 0x67, 0x74, 0xE7, 0x4C, 0x9F, 0xC3, 0x66, 0xC9, 0xEF, 0x35, 0x40, 0x2A, 0x54, 0x3B, 0x6C,
-    0x77, 0xE7, 0x2E, 0xAE, 0xB9, 0x6E, 0xDB, 0xB0, 0x04, 0xA2, 0xC1, 0xF5, 0x35, 0xF3, 0xA4, 0xD6,
-    0xAF, 0x33, 0xD5, 0x6E, 0x8A, 0xDF, 0xD7, 0x2C, 0xAC, 0x11, 0x70, 0x9D, 0x10, 0x06, 0xA3, 0x09,
-    0x4D, 0xBE, 0x5E, 0x6B, 0xA9, 0xB3, 0x2A, 0x30, 0x43, 0x14, 0x26, 0x35, 0x43, 0xB4, 0xAF, 0x04,
-    0x2A, 0xA4, 0xC9, 0x6B, 0x6F, 0xA6, 0xB4, 0x98, 0xEB, 0x13, 0x37, 0xE9, 0x79, 0x87, 0x70, 0x7D,
-    0x1A, 0xF0, 0x59, 0x56, 0x25, 0xD4, 0x45, 0xB9, 0xBC, 0xB7, 0x6D, 0xB6, 0x90, 0x59, 0x7E, 0x50,
-    0x68, 0xBD, 0xE9, 0xF7, 0xA7, 0xDE, 0x26, 0xF5, 0xE0, 0xC6, 0x11, 0xA1, 0x44, 0x6D, 0x02, 0xD5,
-    0x9F, 0x17, 0x30, 0x6E, 0x5C, 0x5C, 0x79, 0xAB, 0x99, 0x04, 0xFB, 0xDE, 0x44, 0x9F, 0xBE, 0xA1,
-    0xD6, 0x80, 0x3C, 0x14, 0xA0, 0x47, 0xC7, 0x53, 0xED, 0x1B, 0x41, 0xA9, 0x51, 0x15, 0xD2, 0xB4,
-    0xA0, 0x99, 0xF1, 0xC4, 0xA6, 0xB1, 0x26, 0x90, 0x18, 0x51, 0xA1, 0x48, 0xA6, 0x99, 0xD0, 0xE0,
-    0x60, 0x44, 0x40, 0x27, 0xF8, 0x89, 0x0E, 0xA8, 0xBC, 0xA2, 0x03, 0xD2, 0xF6, 0xA1, 0x35, 0x19,
-    0x76, 0x7F, 0x05, 0x1B, 0x27, 0x3C, 0xF8, 0x89, 0xC0, 0xCB, 0x96, 0x05, 0x9A, 0x39, 0x9A, 0xD4,
-    0xBB, 0x8E, 0x29, 0x84, 0x8C, 0x1A, 0xC5, 0x85, 0x07, 0xDC, 0xDF, 0x05, 0x3F, 0x51, 0x61, 0xF5,
-    0x21, 0x23, 0x0B, 0x03, 0x9C, 0x5A, 0x89, 0x9E, 0x93, 0x4E, 0x8C, 0xC6, 0x8D, 0x2A, 0xA7, 0xB8,
-    0xD4, 0x4B, 0x77, 0x15, 0x9E, 0xC4, 0x56, 0x21, 0x97, 0x4B, 0xBD, 0x3E, 0x93, 0x93, 0x49, 0x0C,
-    0xE7, 0xBD, 0x43, 0x53, 0x6B, 0xE1, 0x06, 0x9F, 0xC4, 0x6C, 0x2A, 0x3E, 0x7D, 0xD8, 0x23, 0x7B,
-    0x19, 0x88, 0x41, 0x7D, 0xC6, 0xA0, 0x06, 0x03, 0x6F, 0xF4, 0x71, 0x3C, 0x06, 0xC9, 0xB2, 0x43,
-    0xFA, 0xEC, 0x84, 0x12, 0xA3, 0x17, 0x8D, 0xF8, 0x0E, 0xE1, 0x4D, 0xEB, 0x7E, 0x61, 0x4E, 0x4A,
-    0x28, 0xDD, 0x9E, 0x28, 0xC8, 0xA9, 0x7B, 0x67, 0xCC, 0x18, 0x59, 0x2C, 0x4B, 0x92, 0x99, 0x07,
-    0x49, 0x67, 0x92, 0xF2, 0x19, 0x34, 0x7C, 0x0C, 0xBD, 0xC4, 0xFA, 0x03, 0x29, 0x37, 0xF6, 0x54,
-    0x50, 0x4F, 0xF5, 0x09, 0xFA, 0x10, 0x88, 0x94, 0x29, 0x7A, 0x73, 0x98, 0xD5, 0x85, 0x60, 0x4E,
-    0xBE, 0x74, 0x93, 0xBC, 0xE1, 0x2C, 0x2A, 0xB6, 0x85, 0x6F, 0x1E, 0x46, 0x4E, 0x61, 0xBA, 0xF2,
-    0xE1, 0xD4, 0x7D, 0xDE, 0x21, 0x7D, 0xE9, 0x00, 0x91, 0xB2, 0xC9, 0x7C, 0x19, 0x38, 0x1B, 0xD3,
-    0x9E, 0xB1, 0x70, 0xC8, 0x06, 0xEE, 0xA3, 0xD7, 0x14, 0x33, 0xCE, 0x06, 0x6A, 0xE4, 0x45, 0x4F,
-    0x26, 0xB7, 0xF4, 0xB1, 0x8F, 0x83, 0x24, 0xC9, 0xD7, 0x48, 0x22, 0x20, 0x49, 0xF7, 0x14, 0x92,
-    0xCC, 0x76, 0x96, 0x0E, 0x6C, 0x66, 0x3E, 0x72, 0x3E, 0xC7, 0x54, 0xB3, 0x39, 0xDC, 0xDD, 0xAC,
-    0xC4, 0x24, 0x37, 0x07, 0xD3, 0x4D, 0xEF, 0xCA, 0x1E, 0xE8, 0xB4, 0x3C, 0x0C, 0xA6, 0xE0, 0x6C,
-    0xC3, 0x21, 0x6F, 0x41, 0x92, 0xEC, 0xAB, 0xA7, 0x9F, 0x9E, 0x4C, 0xFE, 0x49, 0x10, 0x8C, 0x97,
-    0x16, 0x3C, 0x2D, 0x5F, 0xA1, 0xD1, 0xD3, 0xF8, 0xDB, 0x6E, 0x27, 0x93, 0xED, 0x67, 0xEA, 0xE4,
-    0x29, 0xA7, 0x53, 0x77, 0x79, 0xD7, 0x0D, 0xC1, 0xCC, 0x91, 0xD0, 0x61, 0x85, 0xCD, 0xE0, 0xE2,
-    0x3A, 0x81, 0x69, 0x54, 0x80, 0x84, 0x9B, 0x50, 0x83, 0xC3, 0xDF, 0xF9, 0x1D, 0x4E, 0xA9, 0x7E,
-    0xF6, 0xF6, 0xDC, 0x3E, 0x5A, 0xAC, 0xC8, 0xEC, 0xA1, 0x39, 0x4B, 0xE6, 0x38, 0x1D, 0xE8, 0xA0,
-    0xF0, 0xA3, 0x3A, 0xC4, 0x1D, 0x54, 0x5D, 0xAB, 0xA3, 0x1E, 0x76, 0x08, 0xE2, 0xAE, 0xDA, 0xFA,
-    0x7B, 0xB6, 0x1E, 0xA7, 0x5A, 0x92, 0xFB, 0xF5, 0x44, 0x4C, 0x24, 0x50, 0xEC, 0xE8, 0x47, 0xEC,
-    0x2F, 0xB7, 0xC3, 0x3D, 0x3B, 0xEC, 0x5F, 0x22, 0xCE, 0xDF, 0xF3, 0x1F, 0x7B, 0x92, 0xC8, 0x36,
-    0xC7, 0x5D, 0x52, 0xF2, 0x3E, 0x2E, 0xAE, 0x85, 0xC3, 0x71, 0xF1, 0x3D, 0x7D, 0x32, 0xF5, 0xBF,
-    0x61, 0x4C, 0xA2, 0xFB, 0x39, 0x2E, 0xFA, 0xB3, 0x74, 0x30, 0x6C, 0x18, 0x88, 0xD9, 0x80, 0xC3,
-    0xED, 0x38, 0x70, 0x38, 0xF8, 0x75, 0xF5, 0xF2, 0x06, 0xDE, 0x5B, 0xAB, 0xA3, 0x3C, 0x92, 0x0B,
-    0x8A, 0xE5, 0xE4, 0xE1, 0x72, 0xC1, 0x42, 0x26, 0xB7, 0x23, 0x88, 0xE5, 0x39, 0x97, 0x0D, 0x04,
-    0xBA, 0x54, 0x8C, 0x1E, 0xA0, 0x5F, 0xFD, 0xBA, 0x78, 0xAE, 0xAF, 0xEE, 0x8C, 0xDB, 0xD4, 0x71,
-    0x93, 0x50, 0xF6, 0x61, 0x56, 0x36, 0xC9, 0xBF, 0xC9, 0x22, 0x71, 0x79, 0x79, 0xA6, 0x67, 0x18,
-    0x9F, 0xC3, 0xDA, 0x87, 0x91, 0x3B, 0x68, 0x84, 0x40, 0xDC, 0xF7, 0xFE, 0xE8, 0x52, 0xF6, 0x2C,
-    0x82, 0xB7, 0xEC, 0xDF, 0x6D, 0xB9, 0x33, 0xE3, 0xCE, 0xBD, 0x1F, 0xCB, 0x9F, 0x11, 0xD4, 0x5F,
-    0x64, 0x97, 0xA4, 0x7A, 0x5F, 0x99, 0xE0, 0xCC, 0xE0, 0xD4, 0xC1, 0xEA, 0x63, 0x86, 0xE3, 0xC5,
-    0x7D, 0xD4, 0xA3, 0x4E, 0xC8, 0x3E, 0x8F, 0x54, 0x34, 0x9B, 0x7B, 0x1D, 0x40, 0x54, 0x49, 0x8B,
-    0x45, 0x2A, 0xD0, 0x4F, 0x69, 0x20, 0xB4, 0x92, 0x73, 0x04, 0x18, 0xDC, 0xB3, 0xFF, 0x50, 0x89,
-    0xAE, 0x92, 0xFA, 0xDD, 0x65, 0x6F, 0xE9, 0xA6, 0x72, 0xA1, 0x0D, 0xA4, 0xBF, 0x36, 0xCD, 0x95,
-    0x3F, 0x75, 0x91, 0x64, 0x87, 0x8D, 0x51, 0x23, 0xED, 0xF0, 0x3C, 0x3F, 0x7E, 0xEE, 0xBC, 0x7D,
-    0x65, 0x84, 0x4F, 0x65, 0x0F, 0x26, 0xFE, 0x42, 0x3F, 0x53, 0xFA, 0xC2, 0xAF, 0xF6, 0xB9, 0x25,
-    0x29, 0x75, 0xBC, 0x37, 0x15, 0x88, 0x80, 0x91, 0x9D, 0xD6, 0x59, 0x1C, 0xC7, 0x74, 0x77, 0x5E,
-    0x7D, 0xF7, 0x9F, 0x11, 0x06, 0x60, 0xB4, 0x6D, 0xE8, 0xD9, 0x25, 0x6A, 0x33, 0x25, 0x53, 0xBF,
-    0x89, 0x0F, 0x72, 0x88, 0xDB, 0x6A, 0x0C, 0x89, 0x01, 0xB3, 0xCF, 0x4B, 0x8F, 0x8C, 0x76, 0xBA,
-    0x80, 0x55, 0x1A, 0xDD, 0xA1, 0x60, 0x6D, 0x02, 0x9D, 0xF1, 0x77, 0xA5, 0x50, 0xFF, 0x23, 0xEB,
-    0xC0, 0x89, 0x32, 0xF4, 0x56, 0x23, 0xB6, 0xA0, 0xFF, 0x83, 0x8A, 0xAE, 0x1A, 0x82, 0x74, 0x8F,
-    0x74, 0xBD, 0x60, 0xBD, 0xA9, 0x1F, 0xE4, 0x5D, 0x09, 0x9B, 0xA8, 0x8B, 0xBA, 0xB0, 0xA5, 0x0B,
-    0xA7, 0x04, 0x0C, 0xDB, 0x67, 0xFB, 0x37, 0xAA, 0xC3, 0x32, 0x29, 0xB2, 0x34, 0x9B, 0x66, 0x9F,
-    0x27, 0xAA, 0xCA, 0xBC, 0x6B, 0x30, 0x6C, 0x54, 0xBD, 0xC4, 0x14, 0x6A, 0x90, 0x76, 0x71, 0xB9,
-    0x0C, 0xA6, 0x1E, 0xCD, 0xD4, 0x36, 0xB7, 0xE4, 0xB6, 0xBC, 0xDD, 0x26, 0xF5, 0xD3, 0x0E, 0x3A,
-    0x78, 0x1A, 0x21, 0x5B, 0x99, 0xC6, 0x7D, 0x8B, 0x60, 0x73, 0x4C, 0x38, 0x62, 0x06, 0x01, 0x8F,
-    0xBE, 0x85, 0x39, 0x14, 0x37, 0x99, 0xC0, 0x19, 0x5F, 0x87, 0xC4, 0x5A, 0x37, 0x58, 0xA2, 0x7D,
-    0x2B, 0x4C, 0x11, 0x58, 0x68, 0xDB, 0xF4, 0xB9, 0x45, 0x3F, 0xBA, 0xDE, 0x29, 0xDD, 0x48, 0xDD,
-    0xDF, 0xA4, 0xB0, 0x7A, 0x7E, 0x29, 0x53, 0xB5, 0x22, 0xD4, 0xC4, 0x6D, 0x94, 0x7F, 0xA4, 0x52,
-    0xC7, 0xFC, 0x77, 0x2B, 0xDB, 0x47, 0x59, 0x74, 0xB2, 0x85, 0xC8, 0xF1, 0x0D, 0x49, 0x43, 0xC4,
-    0xBB, 0xFB, 0xBB, 0x5E, 0xE4, 0xA9, 0x55, 0xDE, 0xD8, 0x60, 0x87, 0x45, 0xBB, 0x71, 0x9D, 0x21,
-    0x2C, 0xAC, 0x2F, 0xFD, 0xE5, 0x5B, 0x2C, 0xEB, 0x8A, 0xF9, 0xB7, 0x81, 0x9E, 0x41, 0xBC, 0x7D,
-    0xDC, 0xE5, 0xE5, 0xB8, 0x0B, 0xDA, 0x91, 0x6A, 0xDD, 0x72, 0xE9, 0x0C, 0x8E, 0xBF, 0xEE, 0xC0,
-    0x1F, 0xF5, 0x09, 0x00, 0x8D, 0x6C, 0x42, 0x88, 0x79, 0xD1, 0xC9, 0x9F, 0x33, 0x49, 0x9D, 0x60,
-    0x22, 0x8C, 0xF4, 0x5E, 0xBE, 0x4A, 0x8B, 0x04, 0xF6, 0x08, 0x22, 0x18, 0x71, 0x95, 0x54, 0xB0,
-    0x44, 0x26, 0x83, 0x1D, 0x02, 0x49, 0x00, 0xEB, 0xE2, 0xA8, 0x3E, 0x79, 0xED, 0x3E, 0x57, 0x80,
-    0x84, 0x1F, 0x04, 0x50, 0x52, 0x66, 0x47, 0x33, 0xC8, 0x2E, 0xD8, 0x4D, 0x59, 0xA3, 0xF3, 0x88,
-    0x60, 0x34, 0x8E, 0xA4, 0x44, 0x7E, 0xBC, 0xD6, 0xAF, 0x6A, 0x5E, 0xE6, 0x2A, 0xB4, 0x8A, 0x40,
-    0xE0, 0xDC, 0xE4, 0x55, 0x82, 0x35, 0x19, 0x2A, 0x5D, 0x72, 0xB8, 0x2F, 0x96, 0x87, 0xC8, 0x85,
-    0xA2, 0x10, 0xD6, 0x56, 0x8E, 0xDE, 0x03, 0x06, 0xB8, 0xF3, 0x96, 0xF7, 0xDA, 0x63, 0x21, 0xD2,
-    0x51, 0xC0, 0x51, 0xAE, 0x82, 0xB6, 0x0A, 0x90, 0xA2, 0x49, 0xB1, 0x0C, 0x1B, 0x2E, 0x49, 0xE4,
-    0xEA, 0x43, 0xD5, 0xEC, 0x3D, 0x0C, 0x23, 0x39, 0xE4, 0x89, 0x9D, 0xDE, 0x1D, 0xDC, 0x1C, 0x17,
-    0xD5, 0x54, 0xBD, 0x6E, 0xB0, 0xAC, 0x19, 0x32, 0xA2, 0x45, 0x7A, 0xFE, 0xEA, 0x60, 0x49, 0xAC,
-    0x19, 0x15, 0xDF, 0xFC, 0xF5, 0xD4, 0xE4, 0x4D, 0xE8, 0x59, 0x68, 0xFC, 0x4C, 0x1D, 0x80, 0x29,
-    0xEC, 0x6E, 0xD5, 0xB9, 0x4A, 0xB6, 0x29, 0x68, 0x56, 0x27, 0xA0, 0xD3, 0xDB, 0x8A, 0xA1, 0xE4,
-    0x2B, 0x41, 0x92, 0x27, 0x47, 0xE4, 0x41, 0xF8, 0x15, 0xE6, 0x64, 0x02, 0x8D, 0x3F, 0xA2, 0x07,
-    0x97, 0xA8, 0x58, 0x4F, 0xF5, 0x31, 0x9D, 0x5B, 0xB2, 0xF0, 0x60, 0x96, 0xE8, 0x4C, 0xA7, 0xDA,
-    0x6F, 0xA2, 0xBA, 0xBB, 0x1F, 0xC2, 0x5C, 0xC4, 0xE5, 0xDF, 0xD9, 0xDD, 0xA5, 0x2F, 0x11, 0xD3,
-    0x81, 0x61, 0x14, 0x20, 0x29, 0x96, 0xAE, 0xC4, 0xA6, 0x71, 0x83, 0x07, 0x20, 0xCD, 0x2C, 0x49,
-    0x9A, 0x91, 0x61, 0x70, 0xE1, 0x63, 0xF1, 0x4C, 0x91, 0xEA, 0x47, 0xF8, 0x68, 0x24, 0xB8, 0x25,
-    0x41, 0xC6, 0x67, 0x44, 0x5A, 0xD0, 0x23, 0x5F, 0x02, 0xB9, 0xD0, 0xAF, 0x07, 0xD0, 0x87, 0xCD,
-    0xD3, 0x80, 0xB4, 0x21, 0xE0, 0x57, 0x21, 0xDD, 0x1F, 0x30, 0x2F, 0x38, 0x37, 0x6D, 0x82, 0x5C,
-    0x3F, 0xC1, 0xDB, 0x5C, 0x56, 0xB4, 0x2C, 0x0E, 0x25, 0x24, 0x8F, 0xE4, 0x4B, 0x37, 0x9B, 0xFD,
-    0x07, 0xAC, 0x3B, 0x18, 0x77, 0x5F, 0x0C, 0x5F, 0x2A, 0x18, 0xF5, 0x4C, 0xAF, 0x28, 0x1E, 0xA2,
-    0x05, 0x18, 0x60, 0x73, 0xB0, 0xDD, 0x51, 0xF4, 0xF0, 0xA2, 0xFF, 0xD3, 0xF3, 0x69, 0x4C, 0x24,
-    0x11, 0x2C, 0xA9, 0x5E, 0xE4, 0x89, 0xD9, 0x6C, 0x4F, 0x1E, 0xFB, 0x6B, 0x56, 0x11, 0x68, 0x58,
-    0xC7, 0x39, 0xE2, 0xB4, 0x28, 0x62, 0x41, 0xBD, 0x51, 0xD3, 0x07, 0x49, 0xD5, 0xFE, 0x3C, 0xFF,
-    0x5B, 0xF9, 0x58, 0x2E, 0xB5, 0xD9, 0x97, 0xCF, 0x7C, 0x00, 0x53, 0x6D, 0xCC, 0xE2, 0x5A, 0x6E,
-    0x74, 0x61, 0x95, 0xA5, 0x5B, 0x98, 0x5B, 0x76, 0x4F, 0x5C, 0x80, 0x04, 0x22, 0x3C, 0xE7, 0x10,
-    0x0C, 0xA4, 0xCB, 0xDA, 0x45, 0x05, 0x20, 0xA4, 0x14, 0xFE, 0xBE, 0x5F, 0x0E, 0x66, 0xB3, 0x77,
-    0x31, 0x29, 0xCC, 0xEC, 0xC3, 0xE1, 0x4B, 0x71, 0x7E, 0xE7, 0xEC, 0x6F, 0xD5, 0x3A, 0xBA, 0x29,
-    0x6F, 0x76, 0x51, 0x1B, 0x55, 0x59, 0x9D, 0xFF, 0xB3, 0x7C, 0xA4, 0x5A, 0xED, 0x1F, 0xAF, 0xA0,
-    0x4A, 0x43, 0x21, 0x85, 0xAB, 0x00, 0x0F, 0xEE, 0x05, 0xFC, 0x7C, 0x76, 0x12, 0xBE, 0x83, 0x3C,
-    0xD9, 0x6D, 0xA4, 0xC6, 0x10, 0x99, 0xC5, 0x62, 0x7B, 0x57, 0xD7, 0xDA, 0xBF, 0x3C, 0x07, 0x09,
-    0x95, 0x19, 0x01, 0x81, 0x8E, 0xFE, 0xED, 0x87, 0xD7, 0xC6, 0xF2, 0x76, 0xA3, 0x8E, 0xEB, 0xC7,
-    0xB2, 0xDD, 0x91, 0x54, 0x6F, 0xD5, 0xCF, 0xF4, 0x5C, 0x9F, 0xC4, 0xF0, 0x9F, 0xA5, 0xF9, 0x00,
-    0xCD, 0x3D, 0xA6, 0x1B, 0x91, 0x3C, 0xA6, 0x1E, 0xD5, 0x4E, 0xC6, 0xB0, 0x0C, 0xE0, 0xB2, 0xA8,
-    0xC4, 0xC6, 0x8A, 0xA3, 0x73, 0x8C, 0xE6, 0xF4, 0x13, 0x7B, 0xB9, 0x3B, 0x9B, 0xD1, 0x3B, 0x7C,
-    0xAC, 0x71, 0xB3, 0x2B, 0x10, 0xA6, 0x61, 0x47, 0xC1, 0x4A, 0x61, 0xF8, 0x84, 0x1F, 0x3B, 0x8E,
-    0xB1, 0xB3, 0x22, 0x44, 0x6A, 0x52, 0xAD, 0xF0, 0x3A, 0x84, 0x7B, 0xA3, 0xBE, 0xAC, 0x4C, 0x4F,
-    0x7F, 0xD3, 0x33, 0xFC, 0x31, 0xD4, 0x1F, 0x31, 0x05, 0xDC, 0xE7, 0xEA, 0xAD, 0x04, 0xA9, 0x6F,
-    0x2D, 0x12, 0xE3, 0xAD, 0xDC, 0xF8, 0x8C, 0xD5, 0x12, 0x9C, 0x97, 0xDC, 0x62, 0xB4, 0xF8, 0x01,
-    0x66, 0x1B, 0xAA, 0xA1, 0x56, 0xF1, 0x42, 0xC7, 0x0B, 0xC8, 0xD0, 0x3E, 0x80, 0xB8, 0xD4, 0x0B,
-    0xB7, 0x20, 0x18, 0xE3, 0x0A, 0xFC, 0x7F, 0xAB, 0x55, 0x8B, 0x53, 0x2F, 0xBC, 0xA9, 0xB0, 0x36,
-    0x79, 0x99, 0x29, 0x94, 0x71, 0x0D, 0xCE, 0xB8, 0xD5, 0x42, 0x8E, 0x3F, 0x50, 0x0B, 0xAB, 0xC5,
-    0x05, 0x18, 0x2F, 0xB1, 0x0A, 0x88, 0x85, 0x5E, 0x40, 0xA4, 0xE6, 0x01, 0x8C, 0xD4, 0xCF, 0xF5,
-    0x02, 0x44, 0x6E, 0x0C, 0x2A, 0xE1, 0x82, 0x62, 0xF6, 0x01, 0xC6, 0x16, 0x5C, 0xF0, 0x79, 0x41,
-    0xAF, 0xDF, 0x62, 0xB5, 0x40, 0x85, 0xD2, 0x9A, 0x9D, 0x3E, 0x96, 0xB5, 0x56, 0x83, 0x50, 0x0E,
-    0xDA, 0x6D, 0x98, 0xD2, 0x66, 0x7A, 0x6E, 0xDF, 0x65, 0x7F, 0x50, 0xCD, 0x93, 0xFD, 0x8F, 0x9A,
-    0xA9, 0x0C, 0x32, 0x30, 0xC6, 0xC0, 0x10, 0x03, 0x23, 0x0C, 0x0C, 0x30, 0x30, 0xB2, 0x60, 0x4D,
-    0xFD, 0x7C, 0xCD, 0xCB, 0x83, 0xB9, 0xF5, 0x3F, 0x7F, 0xE6, 0x96, 0xC6, 0x81, 0xCB, 0xC8, 0x32,
-    0x91, 0xD5, 0xE1, 0x51, 0x91, 0x8E, 0x4C, 0xA4, 0x5E, 0x3C, 0x4E, 0x4C, 0xAE, 0x83, 0x87, 0xF2,
-    0x29, 0x03, 0x0E, 0xDA, 0xDE, 0x03, 0x69, 0xFD, 0x6E, 0x80, 0x8B, 0xB6, 0x2A, 0x12, 0x5B, 0x29,
-    0x18, 0x19, 0x37, 0x20, 0xB9, 0xE5, 0x68, 0x1C, 0xB2, 0xC2, 0x91, 0x16, 0x0F, 0xE3, 0xB9, 0xAB,
-    0xC0, 0xE1, 0xCB, 0xC3, 0xE2, 0xEB, 0xD9, 0x31, 0xCC, 0x8B, 0x89, 0x9B, 0x27, 0x64, 0xC7, 0x8E,
-    0x8D, 0x30, 0x63, 0x59, 0xFA, 0x06, 0x43, 0x35, 0x59, 0x5F, 0xCC, 0xB8, 0x3C, 0x44, 0x56, 0x4D,
-    0x16, 0x55, 0x13, 0x00, 0x15, 0xCF, 0xF3, 0xDF, 0x23, 0xC4, 0x54, 0xE6, 0x9F, 0xA8, 0xF9, 0xB1,
-    0x99, 0xE6, 0x0C, 0x50, 0xEB, 0xA4, 0x3F, 0xA7, 0x4F, 0xC2, 0xD8, 0x9E, 0x53, 0xCB, 0x10, 0xB1,
-    0x68, 0xB5, 0xA4, 0xA1, 0x75, 0x72, 0x06, 0x1E, 0xE0, 0x10, 0xBC, 0xE0, 0xC3, 0x13, 0xC9, 0x5E,
-    0x90, 0xEC, 0x0B, 0x5E, 0x40, 0xE0, 0xE3, 0x16, 0x1D, 0x0E, 0x25, 0x7B, 0x67, 0x64, 0x2F, 0x41,
-    0x5D, 0xE4, 0x0F, 0x6E, 0xB5, 0xEA, 0xA7, 0xEB, 0x85, 0xD7, 0x55, 0xF8, 0x2A, 0xAD, 0x12, 0xC1,
-    0x85, 0x91, 0x3A, 0x62, 0x4A, 0xAB, 0xAC, 0x03, 0x75, 0x03, 0xB9, 0x03, 0x22, 0x0A, 0x89, 0x18,
-    0x91, 0xBA, 0xBE, 0x90, 0xBA, 0x09, 0xA9, 0x3B, 0x36, 0xEA, 0xE6, 0xA4, 0x6E, 0xC8, 0x0B, 0x8E,
-    0x17, 0x54, 0x6D, 0x58, 0x71, 0xDB, 0x2D, 0x56, 0x8E, 0x56, 0x2B, 0x6C, 0x8E, 0xC4, 0x0D, 0x19,
-    0x96, 0xBF, 0xDE, 0xEB, 0xBD, 0xCF, 0x6A, 0x59, 0xBA, 0x9B, 0xB0, 0x3D, 0xDD, 0x4D, 0x1F, 0x63,
-    0x80, 0xEA, 0x5B, 0x18, 0xA0, 0xFE, 0x5E, 0x2B, 0xF3, 0xB1, 0x06, 0xE9, 0xD4, 0xB3, 0x79, 0xEB,
-    0x86, 0x6A, 0x32, 0x14, 0x8B, 0x02, 0xD2, 0x40, 0x1D, 0xB6, 0x67, 0xAC, 0xA5, 0xF7, 0x72, 0x4B,
-    0xBB, 0x70, 0x56, 0x39, 0x03, 0xA8, 0x8C, 0x9C, 0x2A, 0x46, 0xBB, 0x3D, 0xE0, 0x1E, 0x4E, 0x50,
-    0x15, 0x33, 0xB2, 0xC7, 0xDA, 0xE1, 0x7C, 0x01, 0xB6, 0x19, 0x33, 0x33, 0xA1, 0x86, 0x04, 0xF2,
-    0xFA, 0x56, 0xD4, 0xD5, 0xD7, 0x73, 0xA9, 0xBA, 0x16, 0x82, 0xB6, 0xF6, 0x23, 0x6E, 0xED, 0xB6,
-    0x4F, 0xEC, 0x99, 0x8C, 0x8B, 0xE8, 0x86, 0xF5, 0x66, 0x5D, 0xA7, 0x4C, 0x68, 0xA8, 0x67, 0xD5,
-    0xFD, 0xCC, 0x0A, 0xB3, 0xE1, 0x82, 0xA1, 0xA5, 0xC2, 0x17, 0x3E, 0x6D, 0x59, 0x97, 0x4D, 0x88,
-    0x92, 0xCD, 0x89, 0x4A, 0x94, 0xA8, 0x2F, 0x2E, 0xB2, 0x3A, 0xA3, 0xFE, 0xA4, 0xFD, 0x9D, 0x3B,
-    0x60, 0xB0, 0xA5, 0x61, 0x48, 0x96, 0x6C, 0xD1, 0xAA, 0x16, 0xDF, 0x96, 0x42, 0x87, 0xD6, 0x21,
-    0x21, 0x13, 0x42, 0x78, 0x6E, 0xB7, 0x75, 0x94, 0xAC, 0x46, 0x25, 0x35, 0x32, 0xD5, 0x6A, 0x36,
-    0x41, 0xFA, 0x7C, 0x0A, 0x97, 0x64, 0x81, 0x02, 0xA3, 0x96, 0x41, 0x97, 0x31, 0x12, 0x68, 0x05,
-    0xB4, 0x7F, 0x19, 0xB1, 0xB2, 0x99, 0xC8, 0x8A, 0x7A, 0x8C, 0x95, 0xBD, 0x80, 0x0E, 0x0B, 0xD6,
-    0x4B, 0x77, 0xAC, 0x97, 0x1E, 0x77, 0x7B, 0x56, 0xDA, 0xD5, 0x8B, 0x42, 0xF3, 0xFB, 0x6C, 0x75,
-    0x6E, 0xB9, 0x97, 0x1C, 0xF9, 0x4C, 0xA2, 0x22, 0x28, 0xA8, 0x7C, 0xB6, 0x67, 0x45, 0x01, 0xAC,
-    0x6D, 0x5B, 0x26, 0x84, 0xB7, 0x56, 0xF3, 0xDB, 0x61, 0xDC, 0xB5, 0xC0, 0x65, 0x6E, 0x7F, 0x40,
-    0x6E, 0xEC, 0xCF, 0xD2, 0xD0, 0x23, 0xFF, 0x05, 0x28, 0x03, 0xB1, 0x1E, 0xB7, 0xF4, 0xDF, 0xDE,
-    0x5E, 0x43, 0xFE, 0x8A, 0x22, 0xC8, 0x26, 0x7E, 0xC4, 0xA8, 0x17, 0x8B, 0xC4, 0xD5, 0x13, 0xCF,
-    0x5A, 0x56, 0xBC, 0x33, 0xB5, 0xD9, 0x93, 0xDE, 0xEA, 0x04, 0x2C, 0x85, 0x35, 0xFB, 0x57, 0x78,
-    0x1F, 0x3A, 0x51, 0xD0, 0x41, 0xB8, 0x96, 0x75, 0x28, 0x66, 0xB4, 0x32, 0x2C, 0x85, 0x9A, 0xD5,
-    0x80, 0x67, 0x5E, 0x7E, 0x3A, 0x9C, 0xDD, 0x3D, 0x7F, 0x55, 0xD1, 0x04, 0x1E, 0xED, 0x74, 0x9A,
-    0x23, 0x36, 0x6D, 0xB0, 0x70, 0x7E, 0x3B, 0xAA, 0x0F, 0xCD, 0xF0, 0x07, 0xA1, 0xC3, 0x5A, 0x8D,
-    0xD4, 0x32, 0x35, 0x69, 0x09, 0x68, 0xB1, 0xA4, 0x87, 0xFD, 0xBD, 0x81, 0x84, 0x34, 0x6E, 0x10,
-    0x2B, 0x99, 0x84, 0x46, 0xF2, 0x07, 0x7F, 0x1A, 0x91, 0xA9, 0xA8, 0x0F, 0x52, 0x8F, 0x99, 0x20,
-    0x02, 0x0E, 0xCA, 0x55, 0xD8, 0x0A, 0x55, 0x32, 0x2C, 0x31, 0x15, 0x84, 0xE4, 0xAD, 0x88, 0xF3,
-    0x53, 0x73, 0x15, 0x64, 0x41, 0x6A, 0x7E, 0x39, 0xB9, 0x38, 0x14, 0x6E, 0x0D, 0x3D, 0x78, 0x44,
-    0xE8, 0xDA, 0x10, 0x88, 0x19, 0x30, 0xFA, 0x28, 0x56, 0xE0, 0xA9, 0xDD, 0x7D, 0xB6, 0xAD, 0x5E,
-    0xC3, 0xEE, 0x00, 0x64, 0x9A, 0xD8, 0xB1, 0x1C, 0x66, 0xD1, 0x27, 0x9D, 0xB4, 0xE3, 0x53, 0x5B,
-    0xAB, 0x22, 0x99, 0x5E, 0xEC, 0x20, 0x54, 0x5F, 0x02, 0x2D, 0xED, 0x20, 0x7D, 0xFA, 0xAC, 0xF0,
-    0x81, 0xC8, 0xFE, 0xD8, 0x84, 0x10, 0x64, 0xCA, 0x1B, 0x08, 0x63, 0x91, 0x7A, 0x8C, 0x22, 0x21,
-    0xC5, 0x0B, 0xFC, 0xDF, 0x9D, 0xE5, 0xF7, 0xF5, 0x31, 0xE6, 0x43, 0x6F, 0x52, 0x83, 0xE9, 0x1F,
-    0xB4, 0x33, 0x3D, 0xB4, 0x04, 0xD6, 0xCB, 0xD4, 0x8A, 0x80, 0xA3, 0xA1, 0xA4, 0x5C, 0xAC, 0xEA,
-    0x75, 0x4A, 0xBF, 0x48, 0x9F, 0xBC, 0x02, 0xB5, 0x3A, 0x2E, 0xA2, 0x7E, 0x68, 0xE3, 0x66, 0x4B,
-    0xF3, 0xC8, 0x5C, 0x2C, 0xC8, 0xA5, 0x4A, 0x8B, 0xD4, 0xBA, 0x38, 0xB8, 0x20, 0x1B, 0xB3, 0xE9,
-    0x50, 0x03, 0x60, 0x05, 0xD0, 0x2C, 0x6D, 0x62, 0xF2, 0x0A, 0x0B, 0x67, 0xAD, 0xE6, 0x26, 0x97,
-    0x83, 0xD4, 0xB8, 0x88, 0x30, 0x4D, 0xAD, 0x30, 0x58, 0x0E, 0x72, 0xB8, 0x9F, 0x48, 0x23, 0x20,
-    0xA1, 0xB8, 0x08, 0x11, 0x89, 0x83, 0x43, 0x0E, 0x6E, 0x71, 0x16, 0x9A, 0xCA, 0x6A, 0xDE, 0xC0,
-    0x7B, 0xCB, 0x65, 0xC6, 0xBC, 0x1D, 0x92, 0x66, 0x07, 0x39, 0x98, 0x00, 0xF4, 0x61, 0x4F, 0xFA,
-    0x5F, 0x71, 0x85, 0xE4, 0x46, 0x69, 0xBF, 0x10, 0x8C, 0xB3, 0x7E, 0x4B, 0x8A, 0x60, 0x96, 0x1E,
-    0x2F, 0x68, 0x39, 0xEA, 0x3A, 0xBA, 0xBC, 0x4B, 0x8F, 0x24, 0x69, 0xE8, 0x81, 0xA9, 0x5A, 0x87,
-    0x33, 0xD2, 0x43, 0xAD, 0x5A, 0xFA, 0xBE, 0x22, 0xFC, 0x66, 0x97, 0x88, 0xAE, 0x4A, 0x55, 0xD0,
-    0x72, 0x5F, 0xE4, 0xB3, 0xB7, 0xA4, 0x26, 0x7F, 0x29, 0x4B, 0x7F, 0x47, 0xD7, 0xFC, 0x64, 0x62,
-    0xE0, 0xB1, 0xA8, 0xA3, 0x05, 0xE9, 0xD6, 0xA3, 0x8E, 0xC5, 0xA1, 0xA8, 0xE3, 0x0B, 0x46, 0xCA,
-    0xB0, 0xBF, 0x6A, 0x66, 0x1B, 0x06, 0x10, 0xC9, 0xEB, 0xAC, 0x9A, 0x00, 0x05, 0x1D, 0x2C, 0xED,
-    0xDA, 0x71, 0x67, 0xAF, 0xB8, 0xAC, 0x0C, 0xB1, 0xC6, 0x7F, 0x29, 0xBD, 0x50, 0x52, 0x0E, 0xAF,
-    0x87, 0x74, 0xF7, 0xAA, 0x8E, 0xFF, 0x44, 0xA2, 0xF8, 0xFC, 0xD4, 0x5D, 0xBE, 0xA0, 0xB6, 0x44,
-    0x81, 0x8A, 0xB9, 0x40, 0xFA, 0x42, 0xBE, 0x90, 0x85, 0x7C, 0xC6, 0x68, 0xA7, 0xB6, 0x36, 0x9A,
-    0x71, 0x8B, 0xC0, 0xF1, 0xBB, 0xBA, 0xD2, 0x1F, 0x49, 0xA5, 0x8B, 0x50, 0xE5, 0xAC, 0xBC, 0xE7,
-    0x61, 0x7E, 0x90, 0xFA, 0x51, 0x67, 0xA2, 0x88, 0xB5, 0x2E, 0xC0, 0xDB, 0xB0, 0xC1, 0xE7, 0xE9,
-    0x27, 0x86, 0xCA, 0x38, 0xE0, 0x8A, 0x35, 0x3A, 0x54, 0x70, 0xDD, 0x10, 0x4B, 0x5E, 0x9A, 0x74,
-    0xE7, 0x68, 0x51, 0x2B, 0xC2, 0x12, 0x56, 0xE8, 0xAB, 0xB0, 0x8A, 0x50, 0x51, 0xAB, 0xCA, 0xE7,
-    0xEF, 0xD7, 0xF6, 0x0C, 0x34, 0x26, 0x69, 0x75, 0x08, 0x5A, 0xE6, 0x7A, 0x61, 0xD4, 0xC7, 0x87,
-    0x2B, 0xC8, 0x72, 0xD0, 0x4C, 0xAA, 0xC1, 0x9C, 0x5C, 0xA6, 0x36, 0x22, 0x5A, 0x91, 0xF7, 0x6B,
-    0xEE, 0x1D, 0x7B, 0x2F, 0xEF, 0x68, 0x0F, 0x41, 0xC0, 0xA7, 0x14, 0x8A, 0xD9, 0x72, 0xC7, 0x8B,
-    0x3B, 0x3B, 0x33, 0xC9, 0x8D, 0xC7, 0x30, 0x62, 0xD0, 0xF6, 0xF1, 0x8E, 0x01, 0xCE, 0x73, 0x6A,
-    0xA3, 0xE6, 0xF6, 0xE0, 0x5C, 0x8F, 0x75, 0xD2, 0x6E, 0x34, 0xDA, 0xBD, 0x67, 0x3B, 0x9D, 0x5A,
-    0x63, 0x0A, 0xA6, 0x21, 0x12, 0x14, 0x78, 0xA0, 0xFB, 0x0D, 0x53, 0x31, 0x85, 0x4D, 0x3D, 0x6C,
-    0xFE, 0x81, 0xB1, 0x7C, 0xC1, 0xBE, 0x3B, 0x65, 0x01, 0xA1, 0x79, 0x36, 0x45, 0xEA, 0x15, 0x3C,
-    0x08, 0x1B, 0x40, 0xFA, 0xF2, 0x09, 0xF8, 0x6E, 0x23, 0x75, 0x1A, 0xD4, 0x04, 0x50, 0x8E, 0x9C,
-    0x2C, 0x43, 0x2E, 0x27, 0x02, 0x55, 0xD8, 0x60, 0x15, 0x31, 0xFB, 0x0A, 0x07, 0x41, 0xF9, 0xBC,
-    0x89, 0x16, 0xA1, 0x72, 0xEC, 0xEB, 0xCB, 0x2D, 0x4A, 0x47, 0x8B, 0xAA, 0xBE, 0x56, 0x0C, 0xBB,
-    0x09, 0x6D, 0x93, 0x05, 0xEB, 0x6A, 0xCA, 0x4C, 0xF6, 0x04, 0xAA, 0xF6, 0x3F, 0x0F, 0xEF, 0x31,
-    0xC1, 0x46, 0x1D, 0x0B, 0xBF, 0x71, 0x27, 0x63, 0x48, 0xE7, 0x5D, 0x58, 0x04, 0xC6, 0x42, 0x09,
-    0x0E, 0x69, 0xBB, 0xC5, 0x06, 0xDC, 0x65, 0x2C, 0x84, 0xBD, 0x09, 0x8D, 0x16, 0x75, 0x3F, 0x96,
-    0x05, 0x90, 0xF0, 0xFB, 0xC1, 0x04, 0x28, 0x09, 0xAE, 0x25, 0x0E, 0x42, 0x56, 0x1B, 0xD5, 0x43,
-    0x5E, 0x01, 0x6C, 0xFD, 0xBA, 0xF4, 0xFB, 0x27, 0xB9, 0xC4, 0x58, 0xF9, 0x76, 0x64, 0xD8, 0x60,
-    0xE2, 0xB7, 0xEB, 0x6B, 0x64, 0x18, 0xEC, 0x50, 0x08, 0x5E, 0x89, 0x6A, 0x03, 0x00, 0x3D, 0xC7,
-    0xFB, 0x26, 0xC2, 0x76, 0xA2, 0xDA, 0x47, 0x10, 0x5F, 0xDD, 0xC5, 0xD8, 0xB6, 0x44, 0xD4, 0xFD,
-    0x1E, 0xB9, 0xE5, 0x66, 0x9E, 0x93, 0xC0, 0x5A, 0xDF, 0x2E, 0xAC, 0x8E, 0x96, 0xB5, 0x68, 0xB8,
-    0xFC, 0x06, 0xCD, 0x43, 0x1A, 0x4B, 0xB4, 0x41, 0x68, 0x0E, 0x16, 0xC6, 0x50, 0x61, 0xB7, 0x4C,
-    0x6A, 0x31, 0x5E, 0x7A, 0xB4, 0x27, 0x9D, 0x6D, 0x51, 0x49, 0x57, 0xE9, 0xE5, 0xE9, 0x10, 0x6F,
-    0x0B, 0x06, 0x1A, 0xB0, 0x92, 0xDC, 0xEC, 0xAA, 0xB8, 0x30, 0x7D, 0x09, 0xDB, 0x27, 0x07, 0x6B,
-    0x7F, 0x76, 0x31, 0x10, 0x6E, 0x4B, 0xE5, 0xE7, 0xEF, 0xE4, 0x60, 0xD7, 0x2A, 0x99, 0x9E, 0xE5,
-    0x53, 0xEA, 0xA7, 0xFE, 0x91, 0x83, 0x09, 0x06, 0xB7, 0x34, 0x11, 0x6E, 0x80, 0xD1, 0xCE, 0xFB,
-    0x7D, 0xAC, 0x00, 0x15, 0xD1, 0x1B, 0x24, 0x4A, 0x02, 0xBB, 0x16, 0xD0, 0xBB, 0x4D, 0x3D, 0xEE,
-    0xD6, 0x4A, 0xE6, 0x63, 0xA4, 0xF4, 0x10, 0xF5, 0x49, 0x2C, 0x91, 0x6C, 0xFB, 0x97, 0xD6, 0xB7,
-    0x6A, 0x9D, 0x34, 0x74, 0x33, 0x3A, 0x38, 0x44, 0x53, 0x06, 0x5C, 0xC7, 0x85, 0xDF, 0x21, 0x7E,
-    0xA8, 0x98, 0xCD, 0x0A, 0x6F, 0xC7, 0x74, 0x02, 0x70, 0xDB, 0xE7, 0x61, 0xFB, 0xD4, 0x24, 0xBE,
-    0x02, 0xC3, 0x3D, 0xB3, 0x7B, 0x16, 0x4C, 0xFC, 0x2E, 0x5F, 0x69, 0x4C, 0x00, 0xE7, 0x26, 0x9E,
-    0x2C, 0x1A, 0x60, 0x05, 0x04, 0xC4, 0x3C, 0x0D, 0xF7, 0xE7, 0x47, 0xD9, 0xC6, 0x9E, 0xDC, 0x9D,
-    0xFA, 0x43, 0x61, 0x2B, 0x0D, 0xEB, 0x61, 0xDF, 0xDF, 0xF3, 0xA3, 0xEC, 0x3B, 0xB2, 0x9C, 0x8E,
-    0x59, 0x25, 0x6B, 0x9F, 0x67, 0x63, 0x39, 0x65, 0x17, 0x8F, 0x56, 0xB1, 0xAE, 0x54, 0xEC, 0xA3,
-    0x3C, 0x18, 0xF2, 0xDE, 0xA3, 0x7D, 0x54, 0xAC, 0x46, 0xD3, 0x98, 0xCE, 0xE3, 0x72, 0xC3, 0x0D,
-    0xB2, 0x50, 0xD9, 0x17, 0xF4, 0xA9, 0x3E, 0xE4, 0xCA, 0xA7, 0xBF, 0xD5, 0xD0, 0xB9, 0x7A, 0xE1,
-    0xA7, 0x6D, 0x43, 0x1A, 0x2D, 0xCF, 0x8A, 0xB5, 0x74, 0x6F, 0x88, 0xAA, 0x0C, 0xAB, 0x71, 0xE5,
-    0xDE, 0x3F, 0x16, 0x20, 0x60, 0x6E, 0xB9, 0x55, 0x6C, 0x43, 0x8E, 0x79, 0xA9, 0x4E, 0x27, 0xA9,
-    0x47, 0x28, 0x0C, 0xF8, 0xCD, 0xDC, 0xE7, 0xAD, 0xFB, 0xF0, 0xB0, 0x2A, 0x5D, 0x2F, 0x5E, 0xBA,
-    0x56, 0x07, 0x72, 0x6A, 0xF2, 0x7D, 0x02, 0x70, 0xDA, 0x44, 0x08, 0xE3, 0xC5, 0x08, 0xE8, 0x65,
-    0x6A, 0x34, 0xBF, 0x61, 0x7B, 0x36, 0xD4, 0x7F, 0x93, 0x47, 0x9D, 0x2E, 0xC9, 0xDB, 0xAA, 0x3F,
-    0x3B, 0xB5, 0x30, 0x08, 0x95, 0x85, 0xA3, 0x68, 0x72, 0xB2, 0x0A, 0xCE, 0xDE, 0xFE, 0xB0, 0x16,
-    0xA5, 0x0A, 0xB8, 0x8E, 0x8F, 0x12, 0x9B, 0x6B, 0xA7, 0x1F, 0x30, 0xAF, 0x7E, 0x93, 0x3B, 0x4F,
-    0x51, 0xAD, 0x2D, 0x35, 0x7D, 0x5C, 0x2B, 0x40, 0xE4, 0x3A, 0x28, 0xED, 0x7D, 0x08, 0xAA, 0xB9,
-    0xE8, 0xF2, 0x51, 0xAA, 0x3C, 0x75, 0xB3, 0xDA, 0x31, 0xE3, 0xF3, 0x7D, 0x6C, 0x96, 0xF6, 0x1B,
-    0xEC, 0xFF, 0x19, 0xF1, 0xF5, 0x15, 0x81, 0x98, 0x29, 0x8C, 0x95, 0x64, 0x65, 0xD6, 0xAB, 0x77,
-    0x57, 0x9C, 0x78, 0xA6, 0xF5, 0xFB, 0xFD, 0x6E, 0x51, 0xBF, 0xDF, 0x2D, 0xFF, 0x86, 0xFD, 0x6E,
-    0xC7, 0x8C, 0x64, 0xAB, 0x49, 0xB0, 0x00, 0x03, 0x0D, 0x1A, 0x7F, 0x91, 0x31, 0xB8, 0xF9, 0x3E,
-    0x4E, 0xF8, 0x80, 0xEC, 0x77, 0xDB, 0xC5, 0xB0, 0x3D, 0xC7, 0xAA, 0xF5, 0x57, 0x58, 0x87, 0x7D,
-    0x16, 0x1D, 0x3D, 0x2F, 0xDB, 0xE9, 0x5B, 0xF4, 0x2E, 0xA0, 0xAA, 0xB3, 0x86, 0xF5, 0x2E, 0x65,
-    0xAE, 0xC6, 0x90, 0xED, 0x39, 0xA8, 0x9D, 0xAC, 0x55, 0xE1, 0x6E, 0x9B, 0x67, 0x69, 0xA6, 0xD9,
-    0x19, 0xD7, 0xA7, 0x85, 0x43, 0xE6, 0xFA, 0x3F, 0x06, 0xC8, 0x69, 0xD3, 0x37, 0xFC, 0x19, 0x98,
-    0x9D, 0x5B, 0xF4, 0x37, 0xFF, 0x00, 0x54, 0x38, 0x7D, 0x0D, 0x4E, 0x41, 0x5E, 0xC9, 0xB0, 0x41,
-    0x3B, 0xA9, 0x32, 0x88, 0x73, 0xE4, 0xDD, 0xC2, 0x39, 0x34, 0xC4, 0x99, 0x95, 0xBF, 0x77, 0xF2,
-    0xE5, 0xF3, 0xF9, 0xDD, 0xCB, 0x3B, 0x6A, 0x2C, 0xC2, 0x91, 0xFF, 0x00, 0x05, 0xD5, 0x6A, 0xCA,
-    0x8C, 0x9B, 0xB0, 0xB6, 0xA9, 0x9C, 0x5A, 0xD6, 0xE6, 0x1C, 0x2F, 0x92, 0x4F, 0x2C, 0xDA, 0x18,
-    0x41, 0xBD, 0xF4, 0xF8, 0xF6, 0x8C, 0xB8, 0x58, 0x1A, 0xAF, 0xBE, 0x5C, 0x74, 0x43, 0x2E, 0xD9,
-    0x4A, 0xB3, 0xC6, 0xDD, 0xB1, 0x22, 0x8F, 0x6F, 0x84, 0x89, 0x8A, 0xE1, 0x0D, 0x31, 0xF9, 0xEA,
-    0x15, 0x2C, 0xFF, 0xD7, 0x67, 0x78, 0xED, 0x9D, 0x2B, 0x1B, 0xBB, 0xAE, 0x7F, 0x07, 0x87, 0x5B,
-    0xCB, 0x7F, 0x58, 0x05, 0x07, 0x43, 0xA6, 0x72, 0xBD, 0xEE, 0xBF, 0xFC, 0xC2, 0x4E, 0x79, 0x92,
-    0x46, 0x76, 0xEA, 0xD0, 0xF6, 0x06, 0xE3, 0x72, 0x9F, 0x7B, 0x61, 0xB8, 0x4B, 0x1D, 0x35, 0x7F,
-    0x37, 0x6D, 0x7B, 0xBE, 0xDA, 0x50, 0x0C, 0xB6, 0xA2, 0x8C, 0x2C, 0x31, 0xAB, 0x39, 0x6A, 0x58,
-    0x04, 0xD8, 0xB0, 0x7C, 0x8F, 0x95, 0x82, 0xA8, 0x1D, 0xAB, 0xB9, 0x27, 0x44, 0x4A, 0xB5, 0xB4,
-    0xE2, 0x47, 0x3A, 0xC5, 0x4A, 0x97, 0x78, 0xB8, 0x2F, 0x30, 0x1A, 0xB3, 0x6A, 0xD4, 0x26, 0x65,
-    0xD0, 0xF1, 0x05, 0x13, 0xA1, 0x92, 0x45, 0x1F, 0x48, 0xF3, 0x1B, 0x82, 0x10, 0x56, 0x3E, 0x4F,
-    0xE6, 0x79, 0x99, 0xA1, 0xD7, 0xA8, 0x8E, 0x16, 0x31, 0xDC, 0xBA, 0xA0, 0xB1, 0x65, 0x89, 0x0D,
-    0xFC, 0xB8, 0x4D, 0x05, 0x9F, 0x4C, 0xA3, 0xFB, 0xF4, 0x82, 0x93, 0x72, 0xD4, 0x22, 0x93, 0x2F,
-    0x77, 0xD4, 0x1C, 0xC1, 0xFC, 0x92, 0x47, 0x8D, 0x55, 0x81, 0x06, 0xA8, 0xF7, 0x14, 0xDB, 0xF9,
-    0x0F, 0xD1, 0x34, 0xB5, 0xC2, 0x95, 0x04, 0x42, 0x34, 0x64, 0x48, 0xB6, 0x32, 0x2C, 0x79, 0x96,
-    0xAC, 0xC3, 0xBA, 0x37, 0x43, 0x9A, 0xEF, 0x60, 0x19, 0xEC, 0x7D, 0x3E, 0x3F, 0x35, 0x31, 0x9D,
-    0x93, 0x4D, 0xC2, 0x85, 0x21, 0x2D, 0x29, 0xC7, 0xED, 0xD7, 0x71, 0xA7, 0xAE, 0x9E, 0x7A, 0xA5,
-    0xCA, 0x1C, 0x15, 0xDF, 0x66, 0xD0, 0x02, 0x11, 0x9D, 0xC5, 0x9A, 0x59, 0xFE, 0x1B, 0x63, 0x83,
-    0x16, 0xEA, 0x00, 0x1B, 0xC0, 0x95, 0xD4, 0x61, 0xEB, 0x77, 0xF9, 0x34, 0x53, 0xDB, 0x49, 0x27,
-    0x52, 0xE4, 0xF3, 0xB1, 0x8A, 0x9D, 0xA4, 0x00, 0x9B, 0xBE, 0xD5, 0x24, 0x25, 0x6A, 0x0C, 0x7F,
-    0xB5, 0x88, 0xFF, 0x88, 0x80, 0xFE, 0xAF, 0xEA, 0xE8, 0x01, 0x32, 0x14, 0x1F, 0x56, 0xE1, 0x17,
-    0x98, 0x11, 0x8F, 0x0A, 0xE5, 0x9D, 0x79, 0xF0, 0x10, 0x62, 0xF9, 0x5E, 0x39, 0x7E, 0x44, 0x17,
-    0xB2, 0xA0, 0x07, 0x3D, 0x1C, 0x63, 0x1C, 0x19, 0x40, 0x98, 0xFA, 0xB6, 0x2F, 0x32, 0xB5, 0xA8,
-    0xF3, 0xE1, 0x5D, 0x2F, 0xE9, 0xE1, 0x5D, 0x2F, 0xD9, 0xE3, 0xBB, 0x5E, 0x10, 0x28, 0x88, 0x99,
-    0x46, 0xA1, 0xFC, 0xC7, 0x1B, 0x8E, 0x90, 0x86, 0x98, 0x07, 0xA0, 0x5E, 0xC1, 0x5D, 0x55, 0x53,
-    0x8B, 0xE9, 0xF5, 0x2F, 0x3F, 0xCA, 0xEB, 0xC4, 0x96, 0x61, 0x3D, 0xA4, 0x69, 0x42, 0xBE, 0xFF,
-    0x6A, 0xDC, 0x57, 0x15, 0x63, 0x44, 0x4F, 0x8C, 0x91, 0xED, 0x8D, 0x4D, 0x64, 0xD8, 0xE4, 0xF9,
-    0x5B, 0x8F, 0x1B, 0x92, 0x12, 0x74, 0xCC, 0xCA, 0x01, 0x5F, 0x98, 0xB3, 0x28, 0x61, 0xBB, 0x57,
-    0x88, 0xC8, 0xAE, 0xB6, 0x7F, 0xC2, 0x21, 0x9F, 0x5C, 0x40, 0xB4, 0xBF, 0x61, 0xBE, 0x05, 0xC5,
-    0x5B, 0x59, 0x6D, 0xDB, 0x50, 0xC0, 0xB6, 0xF3, 0x80, 0x9C, 0x9A, 0xA0, 0x80, 0xD0, 0xB8, 0x39,
-    0x6A, 0x50, 0x0A, 0xA0, 0x5A, 0x6F, 0x8E, 0x0C, 0x02, 0xF0, 0x7C, 0x9F, 0x36, 0x1E, 0x95, 0xF0,
-    0x43, 0x19, 0x32, 0xD5, 0x96, 0x92, 0x49, 0x6C, 0x8A, 0x0B, 0x96, 0x64, 0xA4, 0xC3, 0x5E, 0xB4,
-    0x3E, 0xC2, 0x5F, 0xAC, 0x5E, 0x79, 0x92, 0x3A, 0x6F, 0x0F, 0x97, 0x62, 0x03, 0x57, 0xD2, 0xBE,
-    0xCC, 0xCA, 0x5F, 0x8F, 0x2E, 0x47, 0x73, 0xA4, 0xD0, 0x92, 0x8A, 0xF5, 0x12, 0x15, 0xEA, 0x2C,
-    0xE3, 0x0A, 0x11, 0x9B, 0x8D, 0xE9, 0xC6, 0xF4, 0xF0, 0xDB, 0x6C, 0x4E, 0x3E, 0x89, 0xEC, 0x35,
-    0x4B, 0xC6, 0x7F, 0xB4, 0x21, 0xAD, 0x59, 0xEE, 0x7B, 0xDB, 0x4C, 0x97, 0xAF, 0x42, 0xD3, 0xBF,
-    0xB7, 0xD1, 0xDC, 0xA6, 0x85, 0x41, 0x7F, 0xD1, 0x5E, 0xCD, 0xD1, 0xC7, 0x63, 0x69, 0x35, 0x8D,
-    0x96, 0xFB, 0xF3, 0x3D, 0xEB, 0xA9, 0x1A, 0x1A, 0x06, 0xB6, 0xB2, 0x66, 0xC0, 0x35, 0x77, 0x00,
-    0xF6, 0xFB, 0xA1, 0x9F, 0xD4, 0x03, 0x0B, 0xD7, 0x0E, 0x66, 0xB3, 0x5D, 0x19, 0x2A, 0x48, 0xED,
-    0xDD, 0x6E, 0x5F, 0xF4, 0xA5, 0x96, 0xDF, 0x16, 0x60, 0x55, 0x3F, 0x63, 0x12, 0x31, 0x83, 0xC4,
-    0xA8, 0x3E, 0xA3, 0xFB, 0x9D, 0xDD, 0x1E, 0xB0, 0x82, 0x6E, 0xCA, 0x41, 0x46, 0xD4, 0x52, 0xA5,
-    0x41, 0x6B, 0x2F, 0x0A, 0x33, 0x50, 0x81, 0xD9, 0xA4, 0x9D, 0x4C, 0x30, 0xC5, 0x3B, 0xBD, 0x83,
-    0xDC, 0x9A, 0x55, 0x65, 0xEF, 0x33, 0x8A, 0x16, 0x87, 0x5F, 0x92, 0xC3, 0xCD, 0x8C, 0x87, 0x37,
-    0xA1, 0x9E, 0x30, 0x9C, 0xE1, 0x65, 0x0E, 0xE3, 0x3E, 0x83, 0xC8, 0x30, 0x3A, 0x74, 0x89, 0xDF,
-    0xAE, 0xED, 0x14, 0x38, 0x32, 0x9C, 0xF5, 0x51, 0x9C, 0x6A, 0x8C, 0xEA, 0xC0, 0x0B, 0x87, 0xA3,
-    0x38, 0xD9, 0xA1, 0x28, 0xCE, 0xC9, 0xC2, 0xD9, 0xB7, 0x87, 0x10, 0x8F, 0x90, 0xCF, 0xCE, 0x5E,
-    0x83, 0x1C, 0x0A, 0x19, 0x2D, 0xAE, 0x13, 0xE1, 0xE6, 0x38, 0x0A, 0xC7, 0xE9, 0x8B, 0x3B, 0xB8,
-    0xFF, 0x07, 0xA5, 0x56, 0x31, 0x6C, 0x1C, 0xC7, 0x15, 0xFD, 0xBB, 0x4B, 0x72, 0x6D, 0x2D, 0xE2,
-    0xBD, 0xE2, 0x0E, 0x90, 0x94, 0x04, 0xEB, 0x82, 0x85, 0x40, 0x84, 0x9E, 0x26, 0x85, 0x8B, 0xBB,
-    0x9B, 0x55, 0x5C, 0xA4, 0x10, 0x02, 0x5D, 0x41, 0xC2, 0x40, 0x5C, 0x28, 0x85, 0x81, 0x20, 0x02,
-    0x02, 0x21, 0x55, 0x68, 0xE0, 0x7C, 0xB3, 0xB2, 0x81, 0xB0, 0x70, 0xE1, 0xEB, 0x52, 0xB8, 0xB0,
-    0x0B, 0x16, 0xD4, 0x06, 0x81, 0x5D, 0xAA, 0x20, 0xB9, 0x6B, 0x1D, 0x10, 0x15, 0x2E, 0xBC, 0x22,
-    0x61, 0xA4, 0x30, 0x82, 0xAC, 0x42, 0x39, 0x09, 0xA2, 0x82, 0x1B, 0x6B, 0x29, 0xAF, 0xA8, 0x99,
-    0xFD, 0xF9, 0x7F, 0xEF, 0x28, 0x93, 0x82, 0x2C, 0x18, 0xC8, 0xCC, 0x0D, 0x67, 0xF8, 0xE7, 0xCF,
-    0x9F, 0x99, 0xFF, 0xDF, 0x7F, 0xB3, 0xF1, 0x06, 0x60, 0xC1, 0xBF, 0xA4, 0x00, 0x95, 0x83, 0xCA,
-    0xA0, 0x03, 0x70, 0x75, 0x93, 0x24, 0x0E, 0xA6, 0x5E, 0x0D, 0xA2, 0x9C, 0xC9, 0x60, 0x69, 0x13,
-    0x00, 0x6B, 0xB0, 0x11, 0x43, 0xAF, 0xC6, 0x2C, 0x28, 0x45, 0xA1, 0x32, 0x4F, 0xD3, 0xD4, 0x0A,
-    0xB4, 0xA0, 0xE3, 0x60, 0x38, 0xF2, 0xF1, 0x51, 0x2D, 0x10, 0xB5, 0xFC, 0x00, 0xAB, 0x11, 0x24,
-    0x59, 0x1B, 0xE6, 0xA0, 0xB3, 0xBA, 0xFA, 0x1A, 0x8B, 0x10, 0x27, 0xD4, 0xD1, 0x7F, 0xE1, 0xD5,
-    0x38, 0xBE, 0x81, 0x27, 0x0A, 0xC9, 0x56, 0xB6, 0xC1, 0x3E, 0xD2, 0x10, 0xEC, 0xE1, 0x9F, 0xD0,
-    0x43, 0x2C, 0x7D, 0xDA, 0xC4, 0xC5, 0x1C, 0xC8, 0x30, 0xCC, 0x0F, 0x44, 0x25, 0x35, 0x57, 0x8F,
-    0x04, 0xE0, 0x68, 0x47, 0x27, 0x99, 0xBA, 0x6F, 0xBC, 0x5A, 0xA5, 0xEA, 0xCE, 0x86, 0xB5, 0x01,
-    0x20, 0x6A, 0x0F, 0xBF, 0x46, 0x03, 0x18, 0xC9, 0x3C, 0x28, 0x64, 0xE9, 0xE7, 0xF6, 0x06, 0x58,
-    0x03, 0x0B, 0x73, 0x85, 0xEF, 0xDD, 0xD5, 0xDA, 0xFB, 0x7B, 0xBA, 0xBD, 0x73, 0x6D, 0x82, 0x55,
-    0x60, 0xE8, 0x44, 0x56, 0xFC, 0x87, 0x18, 0x70, 0x0F, 0x23, 0xBC, 0x83, 0x91, 0xCA, 0x68, 0x51,
-    0x86, 0xA1, 0x4C, 0x55, 0x38, 0x1F, 0xCE, 0xD3, 0xDD, 0x43, 0x88, 0x7D, 0x6D, 0xD1, 0xEC, 0x2E,
-    0x46, 0x74, 0x8E, 0xC8, 0x42, 0x4C, 0x21, 0xA0, 0x66, 0xAD, 0x86, 0x30, 0x3D, 0x71, 0x2C, 0xDF,
-    0xD1, 0x4F, 0xFD, 0x96, 0x2E, 0x6E, 0x2E, 0x7D, 0x14, 0x47, 0xBE, 0x09, 0x34, 0xE0, 0x2D, 0x0C,
-    0xFD, 0x4A, 0x90, 0x5B, 0x6D, 0x03, 0x7E, 0x21, 0x52, 0xF2, 0xD0, 0x00, 0x44, 0x08, 0xAE, 0x06,
-    0xF2, 0xA6, 0x37, 0xD1, 0xA3, 0xD1, 0x8B, 0xDE, 0x5E, 0x69, 0x6B, 0x72, 0x56, 0x84, 0x98, 0xDB,
-    0x58, 0x02, 0x69, 0x80, 0x78, 0xC4, 0xEE, 0x8D, 0xC8, 0x03, 0x45, 0x40, 0x5E, 0x90, 0x99, 0xA3,
-    0x25, 0x40, 0xE3, 0x62, 0xCB, 0x38, 0xC6, 0xD5, 0x9E, 0xF6, 0xAB, 0xA0, 0x94, 0xA5, 0x2C, 0x54,
-    0xD1, 0x19, 0x78, 0xC6, 0x37, 0xBE, 0x0E, 0xB4, 0xA0, 0x50, 0xC8, 0x9C, 0x6E, 0x90, 0x76, 0x28,
-    0x86, 0xAA, 0x90, 0x85, 0x28, 0x83, 0xCA, 0x27, 0x6D, 0x72, 0x96, 0x81, 0x95, 0x67, 0xE9, 0x2D,
-    0xDD, 0x00, 0x1F, 0x81, 0x62, 0x0C, 0x49, 0x0E, 0xA2, 0x02, 0xD7, 0x70, 0x1C, 0x49, 0x8A, 0x95,
-    0x8D, 0x99, 0x8B, 0xE0, 0x6B, 0x90, 0x79, 0x13, 0xF8, 0x1E, 0xF4, 0x96, 0xB6, 0x95, 0x59, 0x32,
-    0x3C, 0x02, 0x18, 0x52, 0x1D, 0x6D, 0x2A, 0xA3, 0x36, 0x79, 0x44, 0xB8, 0x88, 0xFF, 0x88, 0xA8,
-    0x08, 0x41, 0x02, 0xEC, 0x93, 0x7F, 0xCE, 0x41, 0x3C, 0xF6, 0x6B, 0x0B, 0x33, 0xA1, 0x5D, 0xFC,
-    0x39, 0x16, 0x4A, 0xD3, 0x1E, 0x6F, 0xD2, 0x82, 0x70, 0x5B, 0xEC, 0x95, 0x23, 0x27, 0x97, 0xD7,
-    0xCD, 0x42, 0x46, 0x01, 0x4D, 0xB9, 0xBE, 0xF1, 0x15, 0x62, 0x52, 0x43, 0xE3, 0x60, 0x37, 0x9B,
-    0xCA, 0xB8, 0xBE, 0xFE, 0x05, 0x4B, 0x78, 0x64, 0x47, 0x9D, 0xD5, 0xCB, 0xF8, 0x00, 0x2B, 0x48,
-    0x52, 0x51, 0x78, 0xDA, 0xC6, 0x66, 0x10, 0x18, 0xAC, 0x15, 0x5E, 0xC1, 0x77, 0x30, 0xE4, 0xF0,
-    0xFB, 0x95, 0x53, 0x37, 0x38, 0xF0, 0x8D, 0x8D, 0x46, 0xE1, 0x25, 0xCC, 0x54, 0xBE, 0x70, 0x11,
-    0x3F, 0x43, 0x65, 0x92, 0x62, 0x07, 0x9E, 0x89, 0xA0, 0xEF, 0x84, 0xCA, 0x99, 0x4D, 0xF2, 0x5B,
-    0x15, 0x14, 0x22, 0x93, 0xE4, 0x33, 0x87, 0x72, 0x21, 0xF4, 0x10, 0x3C, 0x72, 0xCD, 0xA7, 0x2E,
-    0x41, 0x7A, 0x82, 0x25, 0xB9, 0xCE, 0x1A, 0xBB, 0x45, 0x90, 0xCA, 0x28, 0x81, 0x24, 0x4C, 0xFE,
-    0xA3, 0x50, 0xA0, 0x3D, 0xC3, 0x77, 0x4C, 0xBB, 0x51, 0x30, 0xEB, 0x04, 0xF1, 0x7E, 0x0A, 0xFD,
-    0x2D, 0x70, 0x66, 0x1D, 0x03, 0xF9, 0x82, 0x1D, 0x5D, 0xE8, 0x3A, 0x69, 0x57, 0x5C, 0x39, 0xAC,
-    0x08, 0x67, 0x85, 0xB5, 0x71, 0x3E, 0xBC, 0x1A, 0x41, 0x7C, 0xE9, 0x09, 0xF8, 0x6A, 0x8A, 0xCE,
-    0x49, 0xF0, 0x9D, 0x4C, 0x41, 0x97, 0x53, 0xB0, 0x12, 0xA5, 0xCA, 0xDC, 0x06, 0x1F, 0x8C, 0x13,
-    0x19, 0x11, 0xA2, 0x8E, 0x92, 0xC6, 0x9A, 0xC3, 0x0B, 0xD9, 0xA1, 0x56, 0xF8, 0x5C, 0x5C, 0x11,
-    0xEC, 0xDA, 0x2E, 0x86, 0x6F, 0x07, 0x78, 0x64, 0x28, 0x47, 0xB5, 0xFA, 0x00, 0xCB, 0xB7, 0x9F,
-    0x97, 0xBA, 0xF1, 0x87, 0x7C, 0x33, 0xBA, 0x11, 0xA7, 0x27, 0xC0, 0x71, 0x12, 0xAF, 0x52, 0x81,
-    0x59, 0x39, 0x25, 0x6B, 0x37, 0xD4, 0x20, 0x4F, 0x52, 0x83, 0x6C, 0xEC, 0x53, 0xAA, 0x3D, 0x83,
-    0x08, 0x66, 0x26, 0x92, 0x46, 0x50, 0x9F, 0xEE, 0x78, 0x77, 0x5A, 0x42, 0x77, 0x22, 0x0D, 0xCA,
-    0x98, 0x24, 0x05, 0x65, 0x40, 0x61, 0x28, 0x30, 0x0A, 0x18, 0xB4, 0x19, 0x43, 0x96, 0x67, 0xE6,
-    0xA6, 0x56, 0x7E, 0x43, 0x8D, 0x70, 0x6D, 0x53, 0xDA, 0x39, 0x15, 0x80, 0x4B, 0x33, 0x5E, 0x01,
-    0xE0, 0x13, 0xEA, 0x28, 0x29, 0x41, 0x46, 0x94, 0x8E, 0xE4, 0x9E, 0x84, 0xD4, 0xD8, 0x53, 0x4F,
-    0xAB, 0x91, 0xAD, 0x80, 0xD5, 0xB8, 0x3D, 0xA5, 0xC6, 0xED, 0x39, 0x6A, 0x5C, 0x5A, 0x6E, 0xAE,
-    0xAE, 0x6B, 0x2F, 0xDB, 0x12, 0xB7, 0xCB, 0xB7, 0x58, 0xE0, 0x9D, 0x82, 0xC0, 0xFD, 0xE9, 0xBD,
-    0xD8, 0x89, 0x72, 0xEA, 0x64, 0xDD, 0x05, 0xE8, 0x1E, 0xB7, 0xDE, 0xEA, 0xEA, 0x90, 0x65, 0x4B,
-    0x71, 0xBC, 0x49, 0xC8, 0x60, 0x26, 0x2A, 0x84, 0x57, 0xDC, 0x64, 0xC4, 0x30, 0x72, 0x00, 0x16,
-    0xCF, 0x6E, 0x8F, 0xA4, 0xF6, 0x8B, 0xA0, 0x54, 0x66, 0xD8, 0x6B, 0xCD, 0xC1, 0x45, 0x23, 0xD7,
-    0xB3, 0x9E, 0x5D, 0xF8, 0xE9, 0xD0, 0xDD, 0xD5, 0xCA, 0x82, 0xEF, 0x13, 0x1F, 0xCA, 0xF8, 0x60,
-    0xCA, 0x03, 0x74, 0x14, 0x22, 0x7B, 0xA6, 0xA8, 0x86, 0x07, 0x92, 0xCA, 0x62, 0x97, 0x86, 0xDF,
-    0xF2, 0xC0, 0x13, 0x92, 0x3F, 0x32, 0xB3, 0x48, 0x96, 0xC7, 0x24, 0x0F, 0x16, 0xAE, 0xE3, 0x1B,
-    0xB5, 0x5B, 0x05, 0xA9, 0x81, 0xF0, 0x78, 0x9B, 0x02, 0xE4, 0x75, 0xDC, 0xD3, 0xC9, 0x2D, 0x5C,
-    0xAF, 0x89, 0x6F, 0xBD, 0x3A, 0x99, 0x18, 0xD7, 0x9C, 0x77, 0xB5, 0xC5, 0xEC, 0xDC, 0x84, 0x39,
-    0x6D, 0xEA, 0x3D, 0xC5, 0xEC, 0x5E, 0xD1, 0x5D, 0xE3, 0x77, 0x91, 0x4D, 0xC7, 0xF1, 0xC7, 0x13,
-    0x0A, 0xD2, 0x90, 0xE8, 0xC6, 0x6D, 0x06, 0x5D, 0xE6, 0x89, 0xEF, 0x73, 0x9F, 0x67, 0x32, 0x33,
-    0x91, 0x95, 0x59, 0xDA, 0x6E, 0xE8, 0x8B, 0xAB, 0x15, 0xC1, 0xB9, 0xFE, 0xB9, 0x00, 0x27, 0xFB,
-    0x58, 0x6F, 0x6F, 0x4B, 0xFC, 0x7C, 0xFD, 0xA0, 0x18, 0xDC, 0x24, 0x9C, 0xC0, 0x34, 0x5D, 0x28,
-    0x92, 0x16, 0x86, 0x4D, 0x90, 0xE9, 0xC9, 0x59, 0x18, 0xDB, 0x79, 0x52, 0x05, 0xEB, 0x88, 0x46,
-    0x1C, 0x60, 0x41, 0x64, 0x66, 0x0D, 0x3A, 0x83, 0x66, 0x36, 0x28, 0xA7, 0x61, 0xDF, 0x39, 0x3E,
-    0x49, 0x98, 0x64, 0x3D, 0x81, 0x07, 0x93, 0x87, 0x58, 0x0D, 0xED, 0x9A, 0x25, 0x6E, 0xE5, 0xEC,
-    0xE2, 0xA3, 0x2D, 0x99, 0xE0, 0x7A, 0xAA, 0x8A, 0x36, 0x3F, 0x68, 0x54, 0x7E, 0xE4, 0x84, 0xDE,
-    0x17, 0x23, 0xCA, 0xD1, 0xE6, 0x05, 0x18, 0x3A, 0x19, 0x44, 0x2F, 0x4F, 0x2D, 0xD8, 0x91, 0x9B,
-    0x07, 0xD5, 0x0F, 0xFF, 0xED, 0x64, 0xD3, 0xAA, 0x4A, 0x8A, 0x4D, 0x60, 0x66, 0xDD, 0x5B, 0x03,
-    0x58, 0x85, 0xF9, 0xDF, 0xAE, 0x35, 0xAA, 0xCB, 0xD4, 0xB5, 0x9B, 0xEE, 0xA5, 0xEE, 0x27, 0xB0,
-    0x0C, 0xF0, 0x52, 0xFB, 0x13, 0x68, 0xFC, 0xC4, 0xAE, 0xB2, 0x23, 0xFE, 0xC1, 0x0B, 0x24, 0x59,
-    0x84, 0xD6, 0x8F, 0xA9, 0x5B, 0x9B, 0x5B, 0xE3, 0xBC, 0x68, 0x2D, 0xAF, 0xF1, 0x21, 0xE6, 0x96,
-    0xD7, 0xBA, 0x6C, 0x64, 0x79, 0x6D, 0x91, 0xBA, 0xB3, 0xCB, 0x33, 0x9B, 0x8B, 0x8D, 0xE6, 0x59,
-    0xE0, 0xEE, 0xA7, 0x8D, 0x3B, 0xD8, 0x23, 0x33, 0x9B, 0xD6, 0x2F, 0xE0, 0x77, 0x21, 0xCC, 0xF6,
-    0xA3, 0x05, 0x17, 0xA6, 0x87, 0x80, 0x6F, 0xBB, 0xD3, 0xC7, 0x6D, 0x41, 0x65, 0xD7, 0x61, 0x62,
-    0x69, 0xB5, 0x5F, 0xBE, 0x48, 0x47, 0xDA, 0x3F, 0x32, 0x5A, 0xFA, 0x77, 0xEB, 0x20, 0x1A, 0x40,
-    0x72, 0x8F, 0x32, 0x37, 0x27, 0x3A, 0x7A, 0x8D, 0xDE, 0x35, 0x05, 0xDE, 0x97, 0xBB, 0x7A, 0xD4,
-    0x56, 0x77, 0x42, 0x7E, 0x88, 0x64, 0x13, 0xEA, 0x76, 0xAB, 0x37, 0x3C, 0x06, 0xF8, 0x4F, 0xF8,
-    0xAC, 0x73, 0xD6, 0x7F, 0x93, 0xF7, 0x4B, 0x19, 0x12, 0xED, 0xA7, 0x6E, 0x0B, 0x4A, 0x87, 0x5E,
-    0x97, 0xC6, 0xF6, 0x0F, 0x18, 0x73, 0x44, 0xAA, 0x84, 0x21, 0xA7, 0xB4, 0x8D, 0xC8, 0xDD, 0xF2,
-    0x9B, 0x34, 0xB9, 0xFD, 0xF9, 0xE5, 0xBC, 0x17, 0xBC, 0x0A, 0x45, 0x17, 0xFA, 0xFE, 0xD7, 0x26,
-    0x58, 0xFF, 0xD7, 0x63, 0xAD, 0xDB, 0xB0, 0x10, 0xE2, 0x6D, 0xFC, 0xB0, 0x96, 0xA5, 0x8A, 0xEC,
-    0xC8, 0x49, 0x7F, 0xFF, 0xB7, 0xA4, 0xBE, 0x72, 0x18, 0x94, 0xFD, 0xAD, 0x17, 0x5E, 0x5E, 0xA8,
-    0xC4, 0x98, 0x09, 0xB2, 0xE7, 0xE5, 0x43, 0x4E, 0x34, 0x6E, 0x3C, 0x66, 0x99, 0x5B, 0x89, 0x6C,
-    0x8E, 0xBC, 0xDC, 0x05, 0x69, 0x94, 0xA6, 0x6E, 0x0D, 0x7E, 0x35, 0x45, 0xE0, 0xFC, 0xEB, 0xBA,
-    0x79, 0x56, 0x8C, 0xAC, 0x18, 0x40, 0x44, 0xDE, 0x8F, 0x00, 0x16, 0x1A, 0x0A, 0x3E, 0xA2, 0x08,
-    0xF3, 0x0B, 0x40, 0xD8, 0x69, 0x5E, 0x02, 0x64, 0x4C, 0x58, 0x09, 0xDE, 0x03, 0xF8, 0x7F, 0xD6,
-    0x76, 0x18, 0xE9, 0x2B, 0xAA, 0x99, 0x53, 0x33, 0x0D, 0x2E, 0xDF, 0x25, 0x87, 0x0E, 0xF3, 0xAA,
-    0x35, 0x26, 0x42, 0xA1, 0xAF, 0xA5, 0x9D, 0xA0, 0x79, 0x9B, 0x92, 0xBD, 0x69, 0xD6, 0x68, 0x35,
-    0xFE, 0x25, 0xF7, 0x1E, 0xE5, 0xD9, 0x79, 0x42, 0x23, 0x3C, 0x29, 0x0B, 0xCC, 0xB5, 0x44, 0x95,
-    0x34, 0x39, 0x6E, 0x58, 0x0A, 0x89, 0x61, 0x45, 0xB3, 0x88, 0xDE, 0x92, 0x7B, 0x74, 0x18, 0x0A,
-    0x00, 0xEB, 0x5F, 0xAB, 0x64, 0xC6, 0x9A, 0xEA, 0x2F, 0x1F, 0x35, 0x0B, 0x6F, 0xC0, 0xA9, 0x32,
-    0x9E, 0x76, 0x4E, 0x7E, 0xA6, 0x21, 0xF0, 0x8F, 0x0B, 0x39, 0xDD, 0xB9, 0x98, 0xE5, 0xED, 0x74,
-    0x4B, 0xE6, 0x53, 0x2E, 0xFE, 0x31, 0x7F, 0x82, 0xC5, 0x5F, 0x23, 0xF3, 0x5E, 0x3A, 0xBF, 0xE5,
-    0xE3, 0xA4, 0x18, 0xF6, 0xBD, 0x09, 0x6A, 0xEF, 0x1F, 0xA9, 0x35, 0xF6, 0x70, 0xFD, 0xCE, 0xC3,
-    0xC3, 0x11, 0x3D, 0x43, 0x40, 0xA7, 0x46, 0xED, 0xD6, 0xF0, 0xEB, 0x7F, 0x76, 0x1E, 0x1F, 0xEC,
-    0x3C, 0x3E, 0xF8, 0x33, 0x71, 0x0B, 0x56, 0xE2, 0xD2, 0x5E, 0xDE, 0xEF, 0x3B, 0x0F, 0x72, 0x29,
-    0xDC, 0x0C, 0x35, 0x7D, 0x86, 0xAD, 0xCC, 0x8F, 0x9C, 0x83, 0xE8, 0x71, 0xDE, 0xAF, 0xFC, 0x1D,
-    0xE7, 0xE0, 0xD3, 0x23, 0xAC, 0xC5, 0x5F, 0x43, 0xEB, 0x86, 0x83, 0xB7, 0xCA, 0x41, 0x45, 0x9C,
-    0xE0, 0x47, 0x4E, 0xD1, 0x52, 0xAC, 0x09, 0xF6, 0x18, 0xFA, 0x74, 0xD8, 0x73, 0x7D, 0x1F, 0xF7,
-    0x0F, 0x77, 0xFA, 0xCE, 0x7E, 0x46, 0xA6, 0xF6, 0x8B, 0x51, 0x80, 0xF9, 0x68, 0x79, 0x83, 0xE6,
-    0x48, 0xF7, 0xEE, 0x18, 0x51, 0xBE, 0x77, 0x90, 0x1E, 0x1B, 0x8C, 0x8E, 0xF2, 0x57, 0x06, 0x6F,
-    0x9E, 0xF9, 0x19, 0xD6, 0xF8, 0xD9, 0x57, 0x46, 0x5C, 0x73, 0x8A, 0xDE, 0x96, 0x1F, 0x3D, 0x2C,
-    0xFA, 0xCE, 0x97, 0x69, 0xE5, 0x5F, 0x73, 0xF2, 0xDE, 0x9A, 0x17, 0x96, 0xED, 0xC5, 0x6F, 0x1E,
-    0xD4, 0x97, 0xA3, 0x1E, 0x41, 0x37, 0xF3, 0x43, 0x22, 0x37, 0xE8, 0xDA, 0x87, 0xC2, 0x08, 0xD8,
-    0xB2, 0x0B, 0x2F, 0x15, 0xFC, 0xF1, 0x16, 0xB6, 0x61, 0x50, 0xF9, 0xB7, 0x8A, 0x9E, 0xB3, 0x5B,
-    0xF8, 0xEF, 0x47, 0xC1, 0x90, 0xD9, 0x57, 0x01, 0xDC, 0x84, 0x8E, 0x35, 0xD8, 0x12, 0x60, 0x4A,
-    0xFA, 0xBA, 0xA1, 0x07, 0xCD, 0xAF, 0x68, 0xE8, 0x91, 0x9E, 0x9D, 0xFF, 0x0F, 0xED, 0x7D, 0x4D,
-    0x8C, 0x1D, 0x57, 0x76, 0x5E, 0xD5, 0x7B, 0xD3, 0xFD, 0x6C, 0x3E, 0x60, 0xCA, 0x0B, 0xD3, 0x89,
-    0xA5, 0x04, 0x35, 0x8B, 0x6C, 0xC2, 0xC4, 0x53, 0x9B, 0x2C, 0xB2, 0x70, 0xA6, 0x4A, 0x12, 0x90,
-    0x01, 0xA2, 0x85, 0xE8, 0x98, 0x4F, 0x02, 0x86, 0x0B, 0x7A, 0x13, 0xC0, 0xA6, 0x16, 0x9D, 0x85,
-    0x57, 0xC1, 0xC4, 0xF5, 0x46, 0x42, 0xA0, 0xC5, 0x2C, 0x44, 0x1B, 0x16, 0xBC, 0xC8, 0x42, 0x0A,
-    0xA0, 0x01, 0xA4, 0xC7, 0x45, 0x7B, 0xE1, 0x00, 0x63, 0x60, 0xE2, 0x2A, 0x89, 0x08, 0xB8, 0xE0,
-    0x82, 0x6F, 0x86, 0x11, 0x04, 0x44, 0x0B, 0xBE, 0x91, 0xA8, 0xB1, 0x43, 0x2D, 0x58, 0x43, 0x15,
-    0x87, 0xD5, 0xCD, 0xAA, 0xBA, 0x39, 0xDF, 0x77, 0xCE, 0xAD, 0xF7, 0xBA, 0xD9, 0xA4, 0x48, 0x8E,
-    0x44, 0x49, 0x41, 0x9A, 0xEC, 0xAA, 0xEA, 0xBA, 0xF5, 0x73, 0xEB, 0xFE, 0x9C, 0xDF, 0xEF, 0x9C,
-    0x7B, 0x6C, 0x11, 0x04, 0x13, 0x57, 0x06, 0xA1, 0x5B, 0x06, 0x41, 0x5E, 0x05, 0x41, 0xD4, 0x06,
-    0xC1, 0xB8, 0x0F, 0x82, 0xE0, 0x54, 0x80, 0x9F, 0xC2, 0xB9, 0xDE, 0x1D, 0xFE, 0x91, 0xCB, 0x8E,
-    0xFC, 0x75, 0xAE, 0x3B, 0xF0, 0x7B, 0x6B, 0x76, 0xEA, 0x3E, 0xD7, 0xDE, 0xF5, 0x5C, 0xBC, 0x6F,
-    0x5A, 0x4D, 0xAB, 0xA8, 0x89, 0x9B, 0xB8, 0x4D, 0x1A, 0xEC, 0xF1, 0x77, 0x60, 0x3F, 0x8F, 0xB3,
-    0x2E, 0x27, 0x16, 0xF2, 0x33, 0x0F, 0x72, 0x1C, 0x1F, 0xDE, 0xA5, 0xBA, 0x0B, 0xC6, 0xD8, 0x7C,
-    0xD6, 0xEE, 0xBF, 0x2C, 0x32, 0xEC, 0x9C, 0x6B, 0x75, 0xE7, 0x32, 0xDD, 0x2D, 0x75, 0x57, 0xC9,
-    0xEE, 0xDA, 0xC8, 0xD5, 0xBC, 0x21, 0x6F, 0xB8, 0x4B, 0xDB, 0x7B, 0xEF, 0x72, 0xEE, 0x42, 0x87,
-    0x2B, 0x7F, 0xA0, 0xB7, 0xCB, 0x6E, 0xA5, 0xBB, 0x39, 0x77, 0x1D, 0x1B, 0x6B, 0x26, 0xAF, 0x0D,
-    0x8E, 0x49, 0xEF, 0x46, 0xF2, 0xC6, 0x09, 0xDF, 0x1A, 0xF0, 0x77, 0x84, 0x76, 0x3E, 0xAE, 0x2D,
-    0x8A, 0x0F, 0xDA, 0x95, 0xDF, 0x3B, 0xBE, 0x09, 0xA4, 0x89, 0xDD, 0x0D, 0xA9, 0xE9, 0x94, 0x17,
-    0x96, 0xD2, 0xE6, 0xD2, 0x3E, 0xC9, 0xE7, 0x78, 0x22, 0x58, 0x77, 0xE6, 0x35, 0x39, 0x2B, 0xAF,
-    0x95, 0xCA, 0xA1, 0x71, 0xF0, 0xE6, 0xA5, 0x1C, 0x9E, 0x77, 0xD2, 0xBE, 0x59, 0xF0, 0xA7, 0x23,
-    0xF4, 0x0C, 0x2B, 0x1F, 0xE0, 0xA3, 0xF1, 0xA8, 0x25, 0x4F, 0xE0, 0x66, 0xF4, 0x40, 0x8D, 0x7E,
-    0x73, 0x2B, 0xB6, 0xE2, 0x3C, 0xC2, 0x07, 0x04, 0x69, 0xBF, 0x58, 0xBC, 0xC9, 0x2E, 0xB5, 0xAB,
-    0x27, 0xEC, 0x05, 0x7F, 0x8F, 0x7E, 0x71, 0x16, 0xFC, 0x63, 0x79, 0xD9, 0xC7, 0x2F, 0x56, 0xBC,
-    0xBF, 0x0C, 0x74, 0xE4, 0x15, 0xEC, 0xA0, 0x84, 0xFD, 0x1A, 0xCE, 0x7C, 0x25, 0x77, 0xA4, 0x65,
-    0x63, 0x19, 0x3D, 0xA1, 0x5C, 0xD3, 0xE0, 0x1D, 0x65, 0xD1, 0x9F, 0x77, 0x63, 0xB9, 0xEB, 0x6F,
-    0x22, 0xCC, 0x91, 0xB4, 0x0E, 0x74, 0x08, 0x8D, 0xE5, 0x42, 0xF9, 0xBE, 0x1A, 0x2F, 0xEB, 0xB0,
-    0x91, 0xD7, 0x44, 0x78, 0xFA, 0x14, 0x9B, 0x91, 0x63, 0x33, 0xE0, 0x5B, 0x58, 0x8B, 0x14, 0xDF,
-    0x83, 0x56, 0x19, 0xB9, 0x8B, 0x73, 0xB9, 0x2E, 0xDE, 0x7B, 0xDE, 0xD5, 0xE8, 0x8B, 0x77, 0x30,
-    0x54, 0xD1, 0x1E, 0xE5, 0x08, 0x1F, 0x18, 0x6C, 0x9D, 0x94, 0xEB, 0x6E, 0xB8, 0x07, 0xFA, 0xA9,
-    0xE2, 0x1F, 0x34, 0xE9, 0x95, 0x3E, 0xFF, 0x08, 0xFF, 0xD3, 0x77, 0xBB, 0xAD, 0xE0, 0xA4, 0x7E,
-    0x44, 0x88, 0xA7, 0x7D, 0x9E, 0xFF, 0xA5, 0x59, 0xD9, 0xB1, 0xF2, 0x05, 0xD2, 0xAD, 0xD3, 0xCF,
-    0xEF, 0x0F, 0x69, 0x17, 0x69, 0xD6, 0xC8, 0x3D, 0xE7, 0xDC, 0x05, 0xE9, 0x5A, 0xF9, 0xA6, 0xD4,
-    0xAD, 0xB6, 0xFB, 0x0C, 0x4D, 0x8B, 0xFE, 0xC5, 0x8F, 0xCD, 0x79, 0xB6, 0xB1, 0x92, 0x8C, 0x23,
-    0x4F, 0x95, 0x81, 0x9D, 0x6A, 0xAD, 0xFB, 0xEF, 0x75, 0x6A, 0xFF, 0x47, 0xFE, 0x14, 0xFA, 0x3E,
-    0xB4, 0x01, 0x91, 0x05, 0xB1, 0x9E, 0xEA, 0x86, 0x53, 0x55, 0x10, 0x37, 0xB8, 0x51, 0x46, 0xD0,
-    0x48, 0xAE, 0x94, 0xBF, 0x8B, 0x36, 0x48, 0x78, 0x6A, 0x8C, 0x66, 0xC9, 0x70, 0x4A, 0xBE, 0x40,
-    0xC6, 0x44, 0xC4, 0x2F, 0x1A, 0xAF, 0x4F, 0x55, 0x38, 0x25, 0x64, 0x16, 0x33, 0xC0, 0x55, 0x32,
-    0x7B, 0xCF, 0xCB, 0x78, 0x89, 0x64, 0xAC, 0x3B, 0x0E, 0x17, 0x0E, 0x64, 0x8C, 0x91, 0x48, 0xC7,
-    0x99, 0xD1, 0xAF, 0x00, 0x43, 0x52, 0x4E, 0xED, 0x79, 0x62, 0x1C, 0x28, 0x89, 0x2E, 0x56, 0x36,
-    0x7C, 0xF8, 0x3D, 0x9F, 0xDB, 0xC1, 0xFE, 0x62, 0xE1, 0xF6, 0xDF, 0xCE, 0x38, 0x13, 0x51, 0x0F,
-    0x7F, 0xE0, 0xE6, 0xFE, 0x60, 0xE5, 0x0F, 0x2A, 0xBD, 0x6B, 0xE4, 0x1A, 0xBB, 0x3D, 0x6F, 0xED,
-    0x20, 0xF5, 0x07, 0xC9, 0x5D, 0x07, 0xBE, 0x28, 0x74, 0x7A, 0xB0, 0x5F, 0xB8, 0xBA, 0xA8, 0xAC,
-    0xFB, 0xFC, 0x41, 0x69, 0x07, 0x7D, 0x60, 0x07, 0xE7, 0x94, 0xDC, 0x66, 0x98, 0x82, 0x46, 0x2C,
-    0xA4, 0x6A, 0x31, 0xAB, 0x33, 0x50, 0xE2, 0x48, 0xC7, 0x46, 0xDA, 0x68, 0xB7, 0xAE, 0x36, 0x28,
-    0xF0, 0x50, 0x74, 0xFC, 0x54, 0x60, 0x4F, 0xF6, 0x74, 0x38, 0xD2, 0x5D, 0xAA, 0xA3, 0xC6, 0xED,
-    0x3D, 0x25, 0x4D, 0x8E, 0xBB, 0x8A, 0x86, 0x77, 0xE1, 0xF9, 0x4A, 0x90, 0xD1, 0x59, 0xBD, 0x52,
-    0xE1, 0x87, 0x28, 0x0A, 0x46, 0x0B, 0xD4, 0x20, 0xED, 0x06, 0x72, 0x14, 0xB7, 0x36, 0xEA, 0x64,
-    0x40, 0xB3, 0xAA, 0x5B, 0xD9, 0x46, 0xBF, 0x86, 0xEE, 0x67, 0x1C, 0x02, 0x18, 0x24, 0x45, 0x2D,
-    0x13, 0x43, 0xA8, 0x17, 0x27, 0x05, 0x67, 0xDD, 0x52, 0x4E, 0xC7, 0x3D, 0xE6, 0x0B, 0x46, 0x5E,
-    0xA5, 0x93, 0x46, 0x18, 0xC6, 0xD4, 0xBD, 0x20, 0x77, 0x25, 0x24, 0x5F, 0x05, 0xDA, 0x64, 0xC4,
-    0x26, 0x99, 0xF2, 0xD3, 0x92, 0x6E, 0x07, 0x0F, 0xAB, 0x12, 0x5E, 0x2D, 0x35, 0x91, 0xDB, 0x84,
-    0x98, 0xCA, 0x43, 0x64, 0xEC, 0xCA, 0xB3, 0x5D, 0x2D, 0xA7, 0x43, 0xA7, 0x4F, 0xAB, 0x12, 0xF0,
-    0x96, 0xA5, 0x9C, 0x9E, 0xB8, 0x77, 0x59, 0x93, 0x4B, 0x4E, 0x29, 0xF0, 0x31, 0xF0, 0x30, 0x8A,
-    0x09, 0x43, 0xEB, 0x92, 0xF2, 0x05, 0x53, 0x7E, 0xD0, 0x48, 0x67, 0xD3, 0x6C, 0x73, 0x8C, 0xB2,
-    0x8F, 0x47, 0xDC, 0x8E, 0xB9, 0x9D, 0x72, 0x1B, 0x71, 0x9B, 0x70, 0x9B, 0x72, 0x5B, 0xDC, 0xC0,
-    0xD6, 0x5D, 0x95, 0xED, 0xC8, 0x9D, 0x91, 0xED, 0xD8, 0xC5, 0xB2, 0x9D, 0x76, 0xD8, 0x46, 0x2D,
-    0xB6, 0x49, 0x8D, 0x31, 0x94, 0x56, 0xD8, 0x16, 0x4B, 0x6C, 0x5D, 0x29, 0xDB, 0x9B, 0x2E, 0x93,
-    0xED, 0xA7, 0x0E, 0x23, 0xEC, 0x0E, 0x3E, 0xAA, 0x90, 0x81, 0x81, 0x2D, 0xC7, 0x9C, 0x54, 0x13,
-    0xDB, 0x92, 0xDB, 0x39, 0xB7, 0xE0, 0x42, 0x45, 0xAF, 0xBC, 0x28, 0xB0, 0xEA, 0x17, 0x10, 0x7D,
-    0xE6, 0x32, 0x41, 0x83, 0x74, 0x4F, 0x5A, 0x13, 0xE3, 0xAB, 0x25, 0x9B, 0x50, 0x96, 0x73, 0x2D,
-    0x38, 0xF0, 0x13, 0x77, 0x38, 0x79, 0x01, 0x0D, 0x21, 0x93, 0xA1, 0xC6, 0xA7, 0x82, 0x94, 0xB0,
-    0x8B, 0x82, 0xA8, 0x43, 0xCF, 0x4B, 0x53, 0x92, 0x22, 0x08, 0x8F, 0x5E, 0x82, 0x74, 0xC8, 0xF4,
-    0x97, 0xF9, 0x2A, 0x14, 0x13, 0xEF, 0x70, 0x2B, 0x0C, 0x81, 0xB8, 0x95, 0x4B, 0xE5, 0x92, 0xEF,
-    0xA2, 0xDD, 0xF2, 0x9B, 0x1C, 0xC0, 0x1D, 0x9E, 0x39, 0x72, 0x6C, 0xDC, 0x14, 0xA4, 0x1F, 0x0D,
-    0xC6, 0xE6, 0x26, 0x3B, 0x4F, 0x9C, 0xD2, 0xB7, 0x39, 0x0B, 0xE4, 0xD2, 0x27, 0x76, 0x31, 0xA2,
-    0xA6, 0xBC, 0x61, 0xA4, 0xE4, 0xAF, 0xE0, 0x36, 0xE1, 0x48, 0xB3, 0xCE, 0x40, 0x4F, 0xA4, 0xBF,
-    0xA2, 0x78, 0xF7, 0x81, 0xC3, 0xC7, 0xED, 0xE0, 0xF5, 0x1D, 0xA6, 0x56, 0xFE, 0x38, 0x4E, 0x2F,
-    0x16, 0xBB, 0x6E, 0x07, 0xD3, 0xAB, 0x23, 0xE5, 0xF8, 0x15, 0x89, 0xC7, 0x07, 0x6E, 0xA0, 0xB0,
-    0x56, 0x45, 0xD2, 0x58, 0x3C, 0x22, 0x18, 0x26, 0xC9, 0x89, 0x37, 0xF4, 0xB3, 0xE7, 0x9C, 0xC9,
-    0x7A, 0xA5, 0x09, 0x00, 0xBD, 0xD2, 0x7C, 0xDC, 0x17, 0xEF, 0x3B, 0x4A, 0x57, 0x67, 0x30, 0x9B,
-    0xD2, 0x0A, 0x4F, 0x99, 0x3A, 0x34, 0x2E, 0xBA, 0x07, 0xC2, 0x6C, 0x37, 0x51, 0x21, 0x04, 0xC3,
-    0x35, 0x6D, 0x94, 0x77, 0x65, 0x78, 0x03, 0xC6, 0x1C, 0x48, 0x30, 0xFE, 0x93, 0xB4, 0xD4, 0x98,
-    0x43, 0x32, 0x73, 0x48, 0x1B, 0x5A, 0x15, 0xF5, 0x64, 0xCE, 0x5D, 0x5F, 0xC8, 0x88, 0x51, 0x41,
-    0x51, 0x66, 0x9F, 0x3C, 0xFD, 0x19, 0x0A, 0xCA, 0x4D, 0x4A, 0x71, 0xEE, 0x22, 0xEA, 0x97, 0x74,
-    0xE8, 0x2F, 0x99, 0x45, 0xB9, 0x27, 0x91, 0x77, 0x6D, 0x3C, 0xA1, 0xBD, 0x6B, 0xB3, 0xFF, 0x23,
-    0xD2, 0xDB, 0x3D, 0xD2, 0x5A, 0xD2, 0xD9, 0x0A, 0x1B, 0x21, 0xAB, 0xDB, 0x3A, 0x47, 0xD0, 0x9E,
-    0x6C, 0xD4, 0xB8, 0xF7, 0x47, 0x09, 0x36, 0x45, 0x5B, 0xEC, 0xEF, 0xCA, 0x75, 0xFE, 0x8E, 0x65,
-    0x41, 0x9A, 0x09, 0x7A, 0x59, 0xB8, 0x7D, 0x25, 0x9A, 0x4B, 0x4A, 0x45, 0x63, 0xE5, 0x2E, 0x72,
-    0x75, 0x2B, 0x95, 0x8E, 0x85, 0xB9, 0x4A, 0x83, 0x5C, 0x91, 0x96, 0xC8, 0x6B, 0xCC, 0x94, 0x0E,
-    0x4C, 0x57, 0xD8, 0x90, 0x94, 0x3C, 0xC3, 0x06, 0x50, 0x49, 0x0A, 0xF7, 0x90, 0x3E, 0x3E, 0xE3,
-    0xDE, 0x7B, 0xC1, 0x55, 0xB8, 0xB2, 0xA7, 0x08, 0x7A, 0x19, 0xA4, 0xF2, 0x53, 0x0E, 0x6C, 0x87,
-    0xF9, 0xCC, 0xDB, 0x2F, 0x3B, 0xE9, 0xE8, 0x2B, 0x24, 0xE4, 0xDC, 0xF8, 0xDB, 0x85, 0x75, 0x7F,
-    0x19, 0x22, 0xE6, 0x58, 0x25, 0x3B, 0x2F, 0x18, 0xA4, 0x2A, 0x7D, 0x9B, 0x74, 0x30, 0x14, 0x52,
-    0xE4, 0xC0, 0xB4, 0xC4, 0x8D, 0x11, 0xE5, 0x10, 0x2F, 0xD9, 0x84, 0x56, 0x98, 0x6B, 0x61, 0xCC,
-    0x69, 0x1D, 0x4C, 0x7B, 0x16, 0x82, 0xFB, 0xA3, 0xB0, 0x58, 0xB2, 0x50, 0x86, 0x16, 0x0A, 0xE5,
-    0x01, 0x28, 0x1C, 0x93, 0xDE, 0xF2, 0x10, 0x85, 0x32, 0x58, 0x50, 0x98, 0xEB, 0x19, 0xF0, 0x27,
-    0xE9, 0xD9, 0x42, 0xE6, 0x85, 0xFC, 0x2A, 0x2B, 0xED, 0x8D, 0xA7, 0xEE, 0xEA, 0xEE, 0x13, 0xDD,
-    0xED, 0x73, 0x42, 0x44, 0x3D, 0x47, 0xC9, 0xD8, 0xED, 0x2A, 0x29, 0xF8, 0x44, 0x05, 0x59, 0x5F,
-    0x78, 0xF6, 0x1C, 0xA6, 0xCE, 0x22, 0x7B, 0x9C, 0x7A, 0x51, 0x6C, 0x1F, 0xC5, 0x49, 0x21, 0x33,
-    0x6D, 0x04, 0xA1, 0x7D, 0x8E, 0x53, 0x29, 0x88, 0x2F, 0x4E, 0x45, 0x14, 0x72, 0x02, 0x90, 0xBF,
-    0x25, 0xA6, 0x1B, 0xE8, 0x62, 0xCB, 0xEE, 0xC1, 0x88, 0xA4, 0xC0, 0x1C, 0x75, 0xD4, 0x37, 0xA5,
-    0xD0, 0x2D, 0x29, 0x0C, 0x27, 0x42, 0x12, 0xB5, 0xEF, 0xDC, 0xC7, 0xF2, 0x4F, 0x65, 0x77, 0xED,
-    0xB6, 0xC0, 0x33, 0x68, 0xEB, 0xBA, 0xDA, 0x54, 0x41, 0x76, 0xA2, 0x8C, 0xDA, 0x9D, 0x7E, 0xA7,
-    0x67, 0xD9, 0x52, 0xFE, 0xA1, 0xB0, 0x68, 0x30, 0xED, 0x4B, 0xCA, 0xFD, 0xF2, 0x78, 0xF2, 0xFB,
-    0xA5, 0x54, 0x02, 0x85, 0x05, 0x2A, 0x31, 0x25, 0x73, 0x23, 0xBD, 0xEE, 0x29, 0xB9, 0xCB, 0xFB,
-    0x28, 0xC3, 0xE0, 0x94, 0x14, 0x82, 0xE5, 0xE1, 0x83, 0xBA, 0x11, 0x48, 0x44, 0xC7, 0xA9, 0xED,
-    0xFB, 0xB2, 0x54, 0x91, 0x9A, 0xEC, 0xC5, 0x4F, 0x94, 0x92, 0xC3, 0x3D, 0xDE, 0x3F, 0xEF, 0xAA,
-    0x6F, 0x06, 0x7C, 0x8D, 0x4A, 0x22, 0xBA, 0xA9, 0x6D, 0xB2, 0x4F, 0xF0, 0x16, 0xD0, 0x3D, 0xC8,
-    0x2F, 0x01, 0xA5, 0x3A, 0x7E, 0xC3, 0x6C, 0x57, 0xA9, 0x77, 0xE3, 0x15, 0x83, 0x64, 0xD8, 0xA4,
-    0xED, 0xB7, 0x50, 0xE5, 0xFC, 0x47, 0xA7, 0x5D, 0x83, 0x79, 0x44, 0x0A, 0x53, 0x62, 0x13, 0x3C,
-    0xE9, 0xC0, 0x9B, 0xB6, 0x4E, 0x7D, 0x8D, 0xB8, 0x6D, 0x51, 0x42, 0x5C, 0xC8, 0x57, 0xB0, 0x30,
-    0x28, 0xB3, 0x8D, 0x39, 0x4C, 0x27, 0xDA, 0x93, 0xC5, 0xDE, 0x41, 0x5E, 0xFB, 0xD5, 0xFF, 0xAE,
-    0xAF, 0xB4, 0xCC, 0x36, 0x25, 0x93, 0x35, 0x53, 0x83, 0xCE, 0x9B, 0x94, 0x4A, 0x45, 0x64, 0x05,
-    0x34, 0xF9, 0x90, 0x0D, 0x80, 0x06, 0x8A, 0x64, 0x13, 0xA3, 0xF6, 0xD9, 0x84, 0x05, 0xA1, 0x16,
-    0xE4, 0x2C, 0xE0, 0x67, 0x65, 0x32, 0xE5, 0xA5, 0x00, 0xC4, 0x4F, 0x0A, 0x44, 0xA4, 0x89, 0x29,
-    0xEE, 0xE8, 0xFC, 0x96, 0x02, 0x68, 0x3B, 0x52, 0x20, 0xCF, 0x94, 0x82, 0x1C, 0xF5, 0xC9, 0x64,
-    0x34, 0x87, 0xEE, 0x7F, 0xA3, 0xAD, 0xF2, 0xDB, 0x64, 0xF8, 0x9D, 0x23, 0x03, 0xCE, 0x49, 0x61,
-    0xAF, 0x82, 0x77, 0xE6, 0xB5, 0x09, 0x2A, 0x8E, 0xDC, 0xFE, 0x06, 0x66, 0x7E, 0x24, 0xBC, 0xA2,
-    0xC5, 0xB0, 0xE8, 0x8D, 0x5C, 0x17, 0x38, 0x2B, 0x4C, 0x03, 0xF3, 0x26, 0x77, 0x77, 0x7A, 0x48,
-    0x5C, 0x37, 0x7A, 0x97, 0x2F, 0x83, 0xE8, 0xB6, 0x2B, 0xAE, 0x4A, 0x25, 0x5A, 0x77, 0xE3, 0x57,
-    0x22, 0x74, 0xF5, 0xE9, 0x9D, 0x4E, 0xCE, 0xBA, 0xE7, 0x7A, 0xF7, 0x5C, 0x13, 0xE4, 0x17, 0x5C,
-    0x71, 0x45, 0xE4, 0xAE, 0x9F, 0xBB, 0x1B, 0x75, 0x5E, 0x46, 0x75, 0x7E, 0xA7, 0x8B, 0x9A, 0x49,
-    0x1B, 0xF7, 0xC2, 0xD3, 0x46, 0xFD, 0xC4, 0x15, 0xCB, 0xA2, 0x74, 0x4F, 0x49, 0xA1, 0x14, 0x95,
-    0x52, 0x38, 0x76, 0xC9, 0x4A, 0x0A, 0xB3, 0xE2, 0x72, 0x8D, 0xC2, 0xD8, 0xB5, 0xA1, 0x14, 0x8E,
-    0x65, 0x92, 0x4B, 0x21, 0xB4, 0x77, 0x14, 0xC6, 0xAE, 0x44, 0xA1, 0x50, 0x0D, 0x14, 0x62, 0xB2,
-    0xA3, 0x50, 0x9A, 0x2E, 0x6E, 0x07, 0x61, 0x4B, 0x09, 0xB5, 0x52, 0x6D, 0x25, 0xE1, 0x4A, 0xB2,
-    0xEF, 0x7D, 0x7A, 0x36, 0x7B, 0x41, 0x19, 0x80, 0x72, 0x83, 0xFD, 0x0D, 0x56, 0xB0, 0xDB, 0xCD,
-    0x66, 0x3B, 0x0F, 0xF4, 0x90, 0xFB, 0x9C, 0x9E, 0xFB, 0x49, 0x25, 0x84, 0xEB, 0x9C, 0xDA, 0x7D,
-    0x1A, 0x55, 0xAA, 0x5B, 0xE5, 0x92, 0xE0, 0x7E, 0xBD, 0x48, 0x08, 0xB0, 0xBD, 0x8C, 0x31, 0xC2,
-    0x30, 0xED, 0xAA, 0x88, 0x66, 0xA3, 0x65, 0x4E, 0xC6, 0xFA, 0x12, 0x7A, 0x21, 0x76, 0x91, 0x1A,
-    0x30, 0x48, 0xA9, 0x28, 0x17, 0xC8, 0x15, 0x17, 0x94, 0xDA, 0x1E, 0x55, 0xF4, 0xAE, 0xF6, 0x28,
-    0x0D, 0x31, 0x42, 0x98, 0x59, 0x9B, 0x25, 0x8C, 0x20, 0x09, 0x34, 0xE9, 0x00, 0x96, 0xAF, 0xC2,
-    0xBD, 0x56, 0x98, 0x8E, 0x6D, 0xB5, 0xA1, 0xB1, 0x04, 0x35, 0x94, 0xAB, 0xFA, 0x41, 0xB7, 0xA0,
-    0x48, 0x76, 0x93, 0x8D, 0x72, 0x89, 0x5B, 0x0A, 0x6C, 0x6D, 0xA1, 0xA7, 0x31, 0xA4, 0x2E, 0x91,
-    0x83, 0x93, 0x63, 0x53, 0xC5, 0xCC, 0x1F, 0xD7, 0x69, 0xC8, 0x5C, 0x9C, 0x6B, 0x94, 0x99, 0x6A,
-    0x9A, 0xA7, 0x50, 0xAD, 0x4F, 0xA1, 0xF2, 0x5F, 0x75, 0xD2, 0x7A, 0x05, 0x4C, 0x1B, 0x50, 0x82,
-    0xEF, 0xE0, 0x53, 0x6F, 0xC0, 0x1A, 0x20, 0xA7, 0xD2, 0xCE, 0x55, 0x13, 0xB9, 0x4A, 0x7E, 0x5E,
-    0xC5, 0xB7, 0xA4, 0x26, 0x80, 0xC9, 0xA8, 0xBB, 0xFE, 0x66, 0x10, 0x0D, 0xB6, 0x22, 0x6D, 0xCB,
-    0x32, 0xB8, 0xE7, 0x29, 0xFF, 0x33, 0x82, 0x00, 0xC8, 0x8A, 0x84, 0x9C, 0xEC, 0x68, 0x9C, 0x32,
-    0x96, 0xAE, 0x6D, 0xC6, 0xD2, 0x9E, 0x93, 0xA0, 0xE8, 0xBC, 0x51, 0x2D, 0x54, 0x6D, 0xC1, 0x58,
-    0xA7, 0x7F, 0x2A, 0x9F, 0x78, 0x8F, 0xC3, 0xA4, 0x0B, 0xFC, 0x6D, 0x6A, 0x96, 0x23, 0x77, 0x9E,
-    0x48, 0x0F, 0x86, 0xF3, 0xC4, 0xED, 0x9D, 0x6E, 0xB5, 0xEF, 0xC6, 0x36, 0x9C, 0xCC, 0xFA, 0xB5,
-    0xD4, 0xDE, 0x23, 0x0F, 0x7F, 0x1D, 0x9B, 0xDB, 0xCE, 0x64, 0x0F, 0xE7, 0x72, 0xED, 0x6C, 0xF2,
-    0xC9, 0xA8, 0x1F, 0x74, 0x76, 0x55, 0x82, 0xBE, 0xC8, 0x93, 0x42, 0xA8, 0xA0, 0x28, 0x70, 0x34,
-    0x62, 0x5C, 0x0B, 0xB9, 0xC3, 0x87, 0x92, 0xA8, 0x82, 0x63, 0x93, 0xEC, 0x9B, 0x39, 0x4A, 0x69,
-    0x22, 0xAD, 0x1D, 0x73, 0x4C, 0x74, 0x0A, 0x79, 0xF3, 0x9C, 0xD2, 0x21, 0x98, 0x7B, 0xD4, 0x41,
-    0x26, 0x92, 0x91, 0x40, 0x83, 0xE0, 0x6D, 0x47, 0x0D, 0x4D, 0xDF, 0xC9, 0x8F, 0x4F, 0x9C, 0xCA,
-    0x70, 0x2A, 0xB7, 0xA8, 0x40, 0xD3, 0x0F, 0x3A, 0xDD, 0x59, 0x5A, 0x05, 0xD5, 0xEE, 0x48, 0x5B,
-    0xA1, 0x19, 0x0B, 0xD5, 0x5A, 0x18, 0x84, 0xDE, 0xF0, 0x73, 0x5C, 0x2D, 0x05, 0x66, 0xCD, 0x30,
-    0x25, 0xDC, 0xFE, 0x94, 0x49, 0x0D, 0x61, 0x60, 0xA4, 0xA6, 0x91, 0xD0, 0xC4, 0x3F, 0x36, 0x2E,
-    0x84, 0x99, 0x3D, 0xF7, 0x0B, 0xE7, 0xC6, 0x32, 0x9B, 0xFB, 0xD0, 0x41, 0x6F, 0x81, 0xCD, 0xF4,
-    0x92, 0x90, 0xED, 0x5E, 0xD5, 0x09, 0xC8, 0x3F, 0x32, 0x1E, 0x61, 0x78, 0xEB, 0x71, 0xBC, 0xF9,
-    0xA7, 0x96, 0x7E, 0x62, 0x17, 0xDB, 0xBD, 0x17, 0x5C, 0xCD, 0x47, 0x45, 0x42, 0xA7, 0x84, 0x52,
-    0xF9, 0x17, 0xF9, 0xF7, 0x8E, 0x4C, 0x48, 0x0B, 0x77, 0x1D, 0x69, 0xCD, 0xD1, 0x75, 0x96, 0x2F,
-    0x3F, 0x67, 0xC3, 0x6B, 0xEA, 0x20, 0x67, 0x85, 0x98, 0x3B, 0x3C, 0x91, 0x63, 0xF4, 0x64, 0xB0,
-    0x98, 0xA8, 0x86, 0x86, 0x6B, 0xF2, 0x46, 0x4D, 0xD8, 0x25, 0x1A, 0x33, 0xE2, 0x34, 0x14, 0xC2,
-    0xAB, 0x46, 0x78, 0x1B, 0x91, 0xAD, 0xCA, 0x85, 0x73, 0x8E, 0xC9, 0x4A, 0x75, 0xC4, 0x39, 0x9B,
-    0xB9, 0x0B, 0x86, 0xCB, 0x64, 0xF4, 0x51, 0x63, 0x4B, 0xA8, 0x80, 0xCF, 0x55, 0xD2, 0x05, 0x71,
-    0x02, 0x37, 0x83, 0xF5, 0x07, 0x9C, 0x35, 0xA0, 0xA0, 0x31, 0x87, 0xBE, 0x97, 0x76, 0x63, 0x4E,
-    0xF3, 0xAA, 0xA0, 0x69, 0xD7, 0xBA, 0x9D, 0xCA, 0x80, 0x53, 0x25, 0xE0, 0xCB, 0xFD, 0x03, 0x36,
-    0xBB, 0xFE, 0xFC, 0xA6, 0x22, 0xF1, 0xC9, 0xE6, 0x1F, 0xAB, 0x8D, 0x06, 0xBF, 0xF7, 0x1F, 0x67,
-    0xCF, 0x51, 0xD6, 0x7A, 0x1F, 0x26, 0xB1, 0x1E, 0x53, 0xC3, 0xFD, 0xFD, 0x03, 0x1E, 0x42, 0x90,
-    0xFD, 0x08, 0x62, 0x47, 0x9F, 0x62, 0x96, 0x7C, 0xC8, 0x57, 0x53, 0xC0, 0x58, 0xA5, 0xCE, 0x14,
-    0x52, 0x79, 0xD5, 0xD9, 0x1F, 0xE9, 0x9B, 0xF8, 0xD6, 0x07, 0x3E, 0x14, 0x19, 0x43, 0x64, 0x0E,
-    0xD8, 0xBF, 0x49, 0xED, 0x22, 0xC7, 0x0D, 0x39, 0xC4, 0x57, 0xFE, 0xC4, 0x03, 0xFF, 0x54, 0xC5,
-    0x4A, 0xCD, 0x86, 0x4B, 0xEF, 0xE0, 0xA9, 0xF9, 0x28, 0xC8, 0x57, 0x63, 0xA5, 0x8D, 0xD0, 0x92,
-    0x2A, 0x5C, 0x14, 0x7E, 0xE5, 0x2F, 0xB2, 0x9F, 0x3B, 0x0F, 0xF2, 0xE5, 0x83, 0x11, 0xCE, 0x0D,
-    0xBC, 0xAB, 0xF4, 0x9A, 0x82, 0x77, 0xF9, 0x25, 0x47, 0x5D, 0x94, 0x92, 0x40, 0x86, 0xAA, 0x13,
-    0x9A, 0xBD, 0x4E, 0x35, 0x89, 0x40, 0x8B, 0x86, 0xCB, 0xED, 0x76, 0x7D, 0xDC, 0xC8, 0x17, 0xCD,
-    0x4E, 0x06, 0xE6, 0x79, 0x52, 0x3D, 0x72, 0xAE, 0x24, 0x6B, 0x6E, 0x22, 0xB3, 0x50, 0x87, 0x59,
-    0xA1, 0x5A, 0x7C, 0xAA, 0x3A, 0x7D, 0x41, 0x0D, 0x3F, 0x54, 0xA6, 0x30, 0x56, 0xED, 0x3F, 0x56,
-    0x5B, 0x80, 0x63, 0x11, 0xD4, 0xC2, 0x44, 0xA6, 0x61, 0xAF, 0x0F, 0x34, 0x1A, 0xA8, 0x32, 0x78,
-    0xC5, 0x77, 0xFD, 0x83, 0x19, 0xBA, 0x54, 0x82, 0x90, 0xF2, 0x4B, 0xAC, 0x61, 0x71, 0x53, 0x39,
-    0x2B, 0x25, 0x0A, 0xB9, 0xFC, 0xFE, 0x85, 0xFD, 0xDB, 0x19, 0x0B, 0x51, 0xD7, 0xE2, 0x26, 0xF9,
-    0x7B, 0x42, 0xF1, 0x67, 0x35, 0xA5, 0x2C, 0xD4, 0xF2, 0xCE, 0x1D, 0xD1, 0x40, 0x6E, 0x92, 0x8E,
-    0xF1, 0xCE, 0xB4, 0xE5, 0x63, 0xA7, 0xEE, 0x69, 0x14, 0x0A, 0x55, 0xE5, 0x63, 0x8B, 0x03, 0x85,
-    0xA9, 0xC3, 0x9D, 0x0B, 0xA9, 0x32, 0x1F, 0x4B, 0xBD, 0x08, 0x3B, 0x7D, 0xEC, 0x9C, 0xEF, 0xDC,
-    0x43, 0x8B, 0x9C, 0x7D, 0xE3, 0x5E, 0x86, 0xAC, 0xA3, 0x36, 0xB7, 0x66, 0x26, 0xC7, 0xE1, 0x61,
-    0xD9, 0x60, 0x0E, 0xAB, 0x8B, 0x5B, 0xCF, 0x53, 0x69, 0xA3, 0xD3, 0x20, 0x59, 0x5B, 0xB8, 0x86,
-    0x4D, 0x7A, 0x94, 0x85, 0xAB, 0x5C, 0x5B, 0xB8, 0xF4, 0xE7, 0x49, 0xB4, 0x37, 0xFB, 0x71, 0xCC,
-    0xB6, 0xA0, 0xD4, 0x15, 0xBA, 0xEB, 0x22, 0x4C, 0x7E, 0x53, 0x74, 0x11, 0xA5, 0x22, 0xD5, 0xE0,
-    0x05, 0x4C, 0xDB, 0x61, 0x10, 0x08, 0xF5, 0x77, 0xDE, 0x3E, 0x76, 0xE0, 0x70, 0xB1, 0x38, 0xAF,
-    0x3C, 0xBB, 0x1B, 0xAE, 0x4D, 0xDB, 0xE1, 0x09, 0xAE, 0xFE, 0x16, 0xA4, 0xD0, 0xF1, 0xBE, 0x8C,
-    0x0F, 0xEA, 0xFC, 0xF5, 0xFA, 0xC5, 0x30, 0x74, 0xC1, 0x51, 0xB5, 0x75, 0x6A, 0x43, 0x1A, 0x83,
-    0xDC, 0xB0, 0xCD, 0x51, 0x01, 0x7D, 0x48, 0x0E, 0xA6, 0x6A, 0x6C, 0xA4, 0x1E, 0x47, 0x85, 0x9E,
-    0xD6, 0xE2, 0xFD, 0x02, 0x6E, 0x8F, 0x31, 0x18, 0x0F, 0x8C, 0x20, 0x54, 0x9B, 0x2A, 0xD0, 0xF8,
-    0x4C, 0x35, 0x4B, 0x7C, 0x44, 0x5E, 0x8B, 0x1E, 0x4B, 0x53, 0xC6, 0x0F, 0xDD, 0x0C, 0x75, 0x4C,
-    0xD1, 0x45, 0xE4, 0x62, 0x97, 0x54, 0x62, 0xE6, 0x89, 0x36, 0xB0, 0x11, 0xA2, 0x27, 0x6E, 0xED,
-    0xB4, 0x7A, 0x45, 0x60, 0xB7, 0x0C, 0xCF, 0xD0, 0x87, 0x36, 0xCA, 0x49, 0xF8, 0x96, 0xDC, 0x5E,
-    0x0B, 0x83, 0x48, 0x8E, 0x7A, 0xC4, 0xEE, 0xE3, 0x9C, 0xFE, 0x98, 0xC2, 0x6A, 0x3A, 0x52, 0x91,
-    0xB2, 0xE2, 0xB8, 0x56, 0x8B, 0x18, 0xBF, 0x79, 0x2D, 0xA7, 0x3C, 0x41, 0x37, 0x99, 0xF9, 0x2F,
-    0xE5, 0x1A, 0x8E, 0x4A, 0x35, 0xC3, 0x4D, 0xA1, 0x3B, 0x9A, 0x3A, 0x4B, 0xDD, 0x7A, 0xCC, 0x61,
-    0xA8, 0xAE, 0x32, 0xF5, 0x02, 0xAA, 0x96, 0xEB, 0x64, 0x20, 0x1E, 0xF4, 0xCD, 0xE6, 0x78, 0x48,
-    0xE8, 0x94, 0xCC, 0x72, 0x42, 0x36, 0x53, 0xBA, 0xD3, 0x30, 0x74, 0x51, 0x21, 0x91, 0x1F, 0x46,
-    0x10, 0x73, 0xF9, 0xEC, 0x5A, 0x1E, 0x32, 0xE5, 0x24, 0xCD, 0x5B, 0x1A, 0xEB, 0xD5, 0x04, 0xF7,
-    0x84, 0x8C, 0x9B, 0x18, 0x83, 0x11, 0x55, 0xA2, 0x3F, 0x77, 0xBC, 0xF7, 0xBC, 0xAB, 0xB6, 0x14,
-    0xF9, 0x30, 0x36, 0x2F, 0xD2, 0xD6, 0xC2, 0x35, 0x13, 0x3F, 0x50, 0x7F, 0x28, 0x72, 0x73, 0x2F,
-    0x2F, 0x48, 0xF7, 0x4C, 0x0A, 0x12, 0xFD, 0x4A, 0xA6, 0x5C, 0x9F, 0xCB, 0xFD, 0x0D, 0xAA, 0xF6,
-    0x21, 0x0C, 0x64, 0x2F, 0x3B, 0x77, 0xA5, 0x1F, 0xC9, 0x6D, 0x8D, 0xF7, 0xAA, 0xFF, 0xCE, 0x8F,
-    0xD9, 0x32, 0xAC, 0x78, 0x89, 0xD6, 0xAB, 0xD4, 0xBD, 0x2C, 0x4A, 0xC2, 0x49, 0x3A, 0xB7, 0x75,
-    0x7C, 0xD1, 0x4E, 0x3D, 0x71, 0xE1, 0xDB, 0x52, 0xCB, 0xEF, 0xA2, 0x62, 0x97, 0x60, 0x4A, 0x12,
-    0xDA, 0xD9, 0x92, 0x90, 0xBE, 0x0C, 0x35, 0xEC, 0x97, 0xF8, 0x9C, 0x2E, 0x87, 0x02, 0xFE, 0xBA,
-    0x23, 0xB3, 0x05, 0x12, 0x80, 0x72, 0x11, 0xBD, 0x4C, 0xAF, 0xE2, 0xE4, 0x87, 0x54, 0xD6, 0xE5,
-    0x6F, 0x4C, 0xE7, 0xB9, 0x0C, 0x7C, 0x36, 0x1B, 0xBA, 0xC1, 0xA8, 0xE4, 0x94, 0x22, 0x10, 0x9C,
-    0xC9, 0xC7, 0x67, 0x33, 0x7A, 0xD2, 0xF8, 0x91, 0x2D, 0x2E, 0x69, 0x73, 0x69, 0x86, 0x5F, 0xA2,
-    0x73, 0xDE, 0x07, 0x0B, 0xA7, 0xBA, 0x9F, 0xEF, 0x9D, 0x76, 0x3F, 0xF5, 0xAE, 0xE8, 0x25, 0xAE,
-    0xAA, 0xED, 0x2A, 0x72, 0xFE, 0xB1, 0xBB, 0x0A, 0x33, 0x02, 0xCC, 0x00, 0x7B, 0x78, 0xD5, 0xFB,
-    0x60, 0xF5, 0xB8, 0x6A, 0x95, 0x43, 0x10, 0x9D, 0xCD, 0x66, 0x7F, 0x28, 0x7F, 0x5C, 0x96, 0x5F,
-    0x99, 0x19, 0x2D, 0xD5, 0xA0, 0x39, 0x99, 0x1C, 0xE4, 0x6F, 0x62, 0x15, 0x1E, 0xE2, 0x4F, 0xD6,
-    0x79, 0xA6, 0x5E, 0xBA, 0xF9, 0x51, 0xDB, 0x6A, 0x7C, 0x68, 0x9B, 0xAF, 0x0E, 0x6F, 0x0B, 0xDD,
-    0x2E, 0xE9, 0xB0, 0x2B, 0x87, 0xED, 0x08, 0xD6, 0xFE, 0xF9, 0x3F, 0x72, 0xA2, 0x7C, 0xFF, 0xA5,
-    0x4A, 0x4D, 0x47, 0x6C, 0xE1, 0x65, 0xB9, 0xE7, 0x16, 0x52, 0xB9, 0x0C, 0xFD, 0xB0, 0x38, 0xA7,
-    0xAA, 0x6A, 0xE8, 0x15, 0x20, 0x19, 0xD7, 0x7F, 0x5E, 0xD4, 0x6C, 0x4C, 0x68, 0x11, 0x2D, 0x9C,
-    0x83, 0x5D, 0xDE, 0x2F, 0x76, 0x3B, 0x4C, 0xFB, 0xCD, 0xCD, 0xDA, 0x50, 0xD8, 0x7A, 0x7D, 0x2C,
-    0x72, 0xE7, 0xC2, 0x1A, 0x73, 0xAC, 0x1E, 0x51, 0x94, 0x2E, 0x1C, 0xD9, 0x0C, 0x86, 0xE8, 0xF1,
-    0x93, 0xC1, 0xF1, 0x53, 0x20, 0x32, 0x5B, 0xA7, 0x54, 0x2F, 0x89, 0x20, 0x11, 0x86, 0x30, 0x4A,
-    0xA0, 0xD1, 0xF2, 0x4A, 0x1D, 0x4F, 0x31, 0x67, 0x57, 0xD2, 0xCA, 0xE8, 0xA2, 0xBA, 0xF2, 0x03,
-    0x11, 0x9C, 0xE1, 0xB6, 0xA8, 0x73, 0xAA, 0xE5, 0xA2, 0x8E, 0xAA, 0x65, 0xD9, 0xDB, 0x53, 0x13,
-    0x37, 0xB0, 0x51, 0xA7, 0x3A, 0x65, 0xD1, 0x3B, 0xEA, 0x48, 0xDF, 0xA5, 0x96, 0x34, 0x71, 0xEF,
-    0xC8, 0x3F, 0x18, 0xE1, 0xCA, 0xBC, 0x4A, 0xC0, 0xFA, 0xF4, 0x15, 0x21, 0x84, 0x67, 0xCC, 0x5B,
-    0x78, 0x75, 0x85, 0x5D, 0xCC, 0x65, 0x18, 0xE7, 0x30, 0x51, 0xE5, 0x2D, 0x6D, 0x22, 0x32, 0x00,
-    0x77, 0xF7, 0xF1, 0xD4, 0x96, 0xA0, 0x06, 0xBC, 0x25, 0x79, 0x6D, 0xC7, 0x85, 0x3A, 0xE9, 0x52,
-    0x35, 0xDA, 0x3F, 0x2F, 0x4A, 0x69, 0x4E, 0x9F, 0x6E, 0x07, 0x2A, 0x59, 0x07, 0xB3, 0x1D, 0x67,
-    0xB2, 0x60, 0x4A, 0xB3, 0xFD, 0xDF, 0x4A, 0xD1, 0xAE, 0x39, 0x8E, 0xC0, 0x9F, 0x56, 0x09, 0x98,
-    0x00, 0x28, 0xAD, 0x8C, 0x8B, 0xE3, 0xA7, 0xE4, 0x51, 0x45, 0x87, 0xA1, 0xD9, 0x61, 0x14, 0x77,
-    0x30, 0x45, 0x75, 0x20, 0xE8, 0x1D, 0x86, 0xAE, 0x6C, 0xD2, 0x1B, 0xB2, 0xC9, 0x2F, 0xCB, 0xC6,
-    0xBD, 0xDA, 0xC9, 0xB8, 0x8E, 0x3A, 0x77, 0xA5, 0x93, 0xCD, 0x07, 0xAD, 0x6C, 0xAE, 0xD6, 0xB2,
-    0xB9, 0x51, 0xC9, 0x06, 0x36, 0x62, 0xE8, 0x4B, 0xB2, 0xC9, 0x64, 0xD3, 0xC3, 0x27, 0x07, 0x8B,
-    0xB0, 0x43, 0xD7, 0x4D, 0x85, 0x4D, 0x94, 0x13, 0xD1, 0x7A, 0x64, 0xC4, 0x3C, 0x03, 0xE5, 0x04,
-    0xD3, 0x9B, 0x6D, 0x16, 0x93, 0x61, 0xFC, 0x96, 0x51, 0xFC, 0xC7, 0x56, 0xA1, 0x19, 0x06, 0x02,
-    0x7D, 0xCD, 0xA0, 0x4D, 0x15, 0x09, 0xA0, 0x5B, 0x41, 0x2C, 0x5B, 0xC9, 0x38, 0x10, 0xF1, 0xBB,
-    0x55, 0x0F, 0xA5, 0x68, 0x68, 0xAB, 0xC0, 0xD3, 0xD2, 0x79, 0xA0, 0xD6, 0xC0, 0x3B, 0x54, 0xEC,
-    0x8A, 0x06, 0xD7, 0x75, 0x70, 0x4A, 0x0A, 0xD9, 0x14, 0x19, 0xA2, 0x84, 0x76, 0xB7, 0xB4, 0xE7,
-    0x09, 0xFF, 0xC5, 0xE3, 0x7B, 0x9D, 0x7E, 0x9C, 0xDD, 0xE8, 0xC3, 0x26, 0x1C, 0xE4, 0xFA, 0x79,
-    0x82, 0x07, 0x4C, 0x3B, 0x3A, 0xD6, 0xA0, 0x21, 0x72, 0x82, 0x51, 0x7B, 0x8E, 0x84, 0x30, 0x37,
-    0x63, 0x0E, 0x49, 0xCE, 0xB4, 0xB4, 0x52, 0xD7, 0x67, 0x0A, 0xC2, 0x1D, 0xF5, 0xA7, 0xD1, 0x8C,
-    0xB0, 0xEA, 0x89, 0xA6, 0x49, 0x93, 0x48, 0xA5, 0xCA, 0xA6, 0x0C, 0x54, 0x6D, 0x45, 0x11, 0x1C,
-    0xB6, 0x66, 0xCF, 0x51, 0x90, 0xEA, 0x74, 0xAA, 0x5F, 0x75, 0xA0, 0x81, 0x68, 0x14, 0x79, 0xF7,
-    0x55, 0x34, 0x86, 0x43, 0x33, 0x85, 0xAE, 0xB8, 0xDA, 0xB9, 0x2C, 0xF9, 0xA4, 0x73, 0x97, 0x9B,
-    0x71, 0xEB, 0xAE, 0xB6, 0x79, 0x89, 0x96, 0xBD, 0xD0, 0x45, 0xB5, 0xFC, 0x91, 0x54, 0x68, 0xDC,
-    0x77, 0x9C, 0xEC, 0xAF, 0xB6, 0xD1, 0x6D, 0x34, 0xB2, 0x88, 0x11, 0xA5, 0xFC, 0x31, 0x11, 0xFD,
-    0xB5, 0x03, 0x17, 0xCF, 0xE4, 0x0F, 0x98, 0xBA, 0xE4, 0x0F, 0xD4, 0xF6, 0x2A, 0xBD, 0x14, 0xF2,
-    0xC7, 0x14, 0x07, 0x68, 0xE5, 0x17, 0xD0, 0x6C, 0x37, 0x20, 0x64, 0x10, 0x17, 0x80, 0x46, 0xB9,
-    0x73, 0xE8, 0xD4, 0xAD, 0x59, 0x4E, 0x91, 0xF7, 0x86, 0xF7, 0x6F, 0xF5, 0x2A, 0x05, 0x7F, 0xE6,
-    0x8D, 0xC4, 0x0A, 0x84, 0xC5, 0x9B, 0x81, 0x5A, 0x4A, 0xE0, 0x31, 0xA3, 0xF6, 0x20, 0x83, 0xE5,
-    0x63, 0xCC, 0x99, 0xF9, 0x44, 0xD8, 0x40, 0xA9, 0xFD, 0x21, 0xFA, 0x37, 0x50, 0x62, 0xAF, 0x77,
-    0xA6, 0x7E, 0x09, 0x57, 0x5A, 0xAA, 0x3A, 0x26, 0x6C, 0x00, 0xA4, 0xE7, 0x0A, 0x19, 0xAA, 0xF4,
-    0x79, 0x2A, 0x0C, 0x24, 0xCB, 0xBB, 0x35, 0x0B, 0x0E, 0x74, 0xBC, 0x4E, 0x21, 0xC4, 0x11, 0x73,
-    0x30, 0x33, 0x1A, 0x2D, 0x2D, 0x69, 0x66, 0x98, 0x4E, 0x4D, 0x33, 0x52, 0xBD, 0xAB, 0xA8, 0x5E,
-    0x8E, 0x31, 0x86, 0xEA, 0x3D, 0xF2, 0xA9, 0x7A, 0x96, 0xED, 0xC8, 0x48, 0x7A, 0x57, 0x5E, 0x0C,
-    0x56, 0x30, 0xA7, 0x94, 0x05, 0x78, 0x57, 0x05, 0x89, 0x00, 0xAE, 0xC7, 0xBC, 0x21, 0x28, 0x84,
-    0x62, 0xF5, 0x91, 0x9B, 0x4A, 0x7D, 0x8C, 0xB2, 0x11, 0x11, 0xB2, 0x71, 0xFD, 0xBF, 0x55, 0xEF,
-    0xE2, 0x8A, 0x44, 0x0A, 0xD4, 0x20, 0x70, 0x3F, 0x07, 0xDF, 0x5C, 0xC9, 0x27, 0x91, 0x53, 0x3C,
-    0xC0, 0x46, 0x5A, 0xFB, 0x1A, 0x9A, 0x83, 0x52, 0x09, 0x84, 0x38, 0x98, 0x31, 0x8A, 0x50, 0xA8,
-    0xCE, 0x6F, 0xA5, 0x9D, 0x59, 0xBA, 0x52, 0xE2, 0x00, 0x32, 0x35, 0x13, 0x0D, 0x07, 0x14, 0x11,
-    0x52, 0x0A, 0x58, 0x15, 0xA6, 0xFD, 0xB5, 0x27, 0xE1, 0xAF, 0x6D, 0x40, 0xED, 0xE7, 0x53, 0x08,
-    0x16, 0x94, 0x47, 0x85, 0x1B, 0xA0, 0x71, 0x9F, 0x1F, 0x54, 0x71, 0x10, 0xAE, 0xFE, 0xEC, 0x2E,
-    0xEC, 0x79, 0x40, 0x0F, 0xF0, 0x51, 0xDE, 0xF9, 0x15, 0x3C, 0xF2, 0x29, 0x80, 0x59, 0x8E, 0x9F,
-    0x2C, 0x6A, 0x9A, 0x44, 0xA0, 0x41, 0x8E, 0x29, 0x03, 0x4C, 0x40, 0x9A, 0x4A, 0xDA, 0x6E, 0x40,
-    0x59, 0x85, 0x14, 0xA7, 0x35, 0xD5, 0x94, 0x15, 0x8D, 0xF4, 0x42, 0xBC, 0xE5, 0x86, 0xA7, 0xA1,
-    0xEA, 0xF4, 0x90, 0x3E, 0x22, 0x6F, 0xB3, 0x86, 0x25, 0xFE, 0x46, 0xEB, 0xDD, 0xEA, 0x23, 0xA7,
-    0x5E, 0xF5, 0x96, 0xBC, 0x68, 0x45, 0xBE, 0x90, 0x79, 0x0E, 0xA5, 0xCD, 0xA8, 0xAE, 0x7A, 0x33,
-    0x0E, 0x4A, 0x9D, 0x4E, 0x50, 0x19, 0x73, 0x6A, 0x94, 0xC4, 0xC5, 0x91, 0xF2, 0x15, 0xF3, 0xE9,
-    0x84, 0x04, 0x90, 0x78, 0x15, 0xEC, 0xC1, 0x77, 0x3B, 0x1C, 0xB1, 0xB1, 0x72, 0x29, 0x9A, 0x34,
-    0xD4, 0x07, 0x08, 0xCF, 0xCA, 0x2F, 0x64, 0x04, 0x54, 0xB1, 0x7B, 0x4A, 0x66, 0x74, 0x93, 0x74,
-    0xB4, 0xE0, 0xA5, 0x22, 0x98, 0x95, 0x98, 0x27, 0x21, 0x1A, 0x21, 0xB7, 0x1D, 0x58, 0x13, 0xA4,
-    0x95, 0xCD, 0x93, 0x69, 0x83, 0x5D, 0xC7, 0x1B, 0x92, 0x36, 0xEE, 0xD1, 0x36, 0x32, 0x6B, 0xDE,
-    0x91, 0xF1, 0x5A, 0x4F, 0xD4, 0x74, 0xA2, 0xF6, 0xAC, 0xB9, 0x79, 0x4D, 0x28, 0xFC, 0x9E, 0x1B,
-    0x90, 0x3C, 0x0F, 0xFF, 0x29, 0xDC, 0x49, 0xB7, 0x85, 0x33, 0x20, 0x08, 0x68, 0x0A, 0x17, 0xB2,
-    0x5B, 0xC8, 0xF8, 0x29, 0xC7, 0x74, 0x0A, 0xA9, 0x69, 0xBD, 0xF8, 0x15, 0x19, 0xB6, 0x53, 0xEF,
-    0x18, 0x35, 0xD4, 0x12, 0x6D, 0xDA, 0xF8, 0xC3, 0xC8, 0x9C, 0x22, 0x8D, 0x5D, 0x1B, 0xF5, 0x0A,
-    0x40, 0x2B, 0x1A, 0x7D, 0x18, 0x9F, 0x3B, 0xE6, 0x2B, 0x0A, 0x48, 0x88, 0x25, 0x45, 0x86, 0x31,
-    0x07, 0x46, 0x5A, 0x53, 0xEE, 0xFE, 0x9C, 0x0E, 0xF7, 0x66, 0x3B, 0x1D, 0x89, 0x88, 0x4B, 0xD5,
-    0xD6, 0x3D, 0x1C, 0x56, 0xC3, 0x08, 0xC9, 0x8F, 0x3C, 0x3C, 0x7E, 0x52, 0x09, 0x2B, 0x85, 0x63,
-    0x9D, 0x8D, 0x53, 0xDC, 0x95, 0xB8, 0xE1, 0xD4, 0x0D, 0x9C, 0x92, 0xF1, 0x9D, 0xF4, 0xD0, 0xE9,
-    0x3E, 0x1D, 0x8C, 0xFE, 0xA0, 0x8E, 0x2D, 0x5C, 0x43, 0x55, 0x70, 0x7C, 0xA4, 0x78, 0x0F, 0xAF,
-    0xE8, 0x2B, 0xA0, 0x72, 0x7D, 0x4A, 0xDE, 0x81, 0xFF, 0x67, 0xFA, 0x83, 0xB6, 0xCD, 0x2F, 0xFE,
-    0xCF, 0x8F, 0x67, 0xC2, 0x11, 0x9C, 0xC1, 0x36, 0xBD, 0x07, 0xFD, 0xD0, 0x9F, 0x2B, 0xAB, 0x5D,
-    0x06, 0xB1, 0x1D, 0xFF, 0x23, 0xBB, 0x7B, 0x4C, 0xA1, 0x14, 0xB6, 0x49, 0x7D, 0xEA, 0xEA, 0x8B,
-    0xBC, 0x40, 0x6A, 0x8A, 0xFF, 0xA9, 0x55, 0xEA, 0xAA, 0xED, 0x6F, 0xDB, 0xBE, 0xF3, 0xB6, 0x1A,
-    0x83, 0xA9, 0xE9, 0xD0, 0xF7, 0xE0, 0x2F, 0xD3, 0x60, 0x48, 0x02, 0x0E, 0x5D, 0xB0, 0x75, 0x72,
-    0x06, 0x1E, 0x2E, 0x7D, 0xD9, 0x1F, 0xDA, 0x9E, 0xDD, 0xED, 0xD7, 0x96, 0x47, 0xDB, 0xD2, 0x7A,
-    0xAD, 0xF8, 0xCB, 0xC8, 0xB4, 0x3C, 0x0C, 0x89, 0xA8, 0x9F, 0x89, 0x64, 0x08, 0x4A, 0x66, 0xF5,
-    0x5E, 0xFF, 0x8F, 0xB1, 0x0D, 0x8B, 0xCE, 0x5F, 0x39, 0xDC, 0x45, 0x08, 0x65, 0x13, 0xD0, 0xC4,
-    0x23, 0x1C, 0x0E, 0x20, 0x3C, 0x77, 0xB9, 0xA7, 0xF9, 0x84, 0x42, 0x36, 0x59, 0x8B, 0xD4, 0xE5,
-    0xD3, 0x83, 0x45, 0xCE, 0xBD, 0x81, 0x22, 0xDA, 0x2A, 0x3E, 0x55, 0x4B, 0x0A, 0xD4, 0x97, 0x06,
-    0x77, 0x6D, 0xC3, 0x90, 0x02, 0xF9, 0x6A, 0x89, 0xBB, 0x26, 0x42, 0x3E, 0x2F, 0xC3, 0x18, 0xCE,
-    0x07, 0xC2, 0xE5, 0xEB, 0x56, 0x4F, 0xCA, 0xEC, 0xC3, 0x5D, 0xBD, 0xDE, 0x55, 0xF1, 0x81, 0x3D,
-    0x1F, 0x28, 0xEA, 0x71, 0x51, 0xA1, 0x36, 0xFC, 0x54, 0xBC, 0xFB, 0x88, 0x03, 0x7C, 0xBF, 0x07,
-    0x18, 0x93, 0xC3, 0x5D, 0xC6, 0x97, 0xE3, 0x95, 0x37, 0xFC, 0xF0, 0xBA, 0x81, 0x6F, 0xC6, 0x9B,
-    0xD0, 0x45, 0xAD, 0x9F, 0x08, 0x25, 0xDB, 0x6C, 0x4B, 0x38, 0xDA, 0x04, 0x55, 0x17, 0x3E, 0x5E,
-    0x8D, 0xE9, 0xF0, 0x59, 0xC8, 0xEB, 0xB3, 0x50, 0x9D, 0xEB, 0xCA, 0xB5, 0x44, 0xC7, 0x29, 0x13,
-    0x7E, 0x98, 0xD3, 0x83, 0x10, 0x67, 0x94, 0x84, 0xF3, 0x1A, 0x57, 0xFF, 0xAD, 0x74, 0xD1, 0xD4,
-    0x0C, 0x2D, 0x50, 0x3F, 0x3A, 0xF5, 0xBE, 0x41, 0xB5, 0x97, 0x2F, 0xD8, 0xEE, 0x09, 0x76, 0xCC,
-    0xC9, 0x70, 0xF1, 0x94, 0x4C, 0x05, 0xC2, 0x12, 0x76, 0xFB, 0x4F, 0x20, 0xA1, 0x88, 0x52, 0x5B,
-    0xD4, 0x36, 0xDA, 0x64, 0x07, 0x4A, 0xE1, 0x6E, 0xC1, 0xA4, 0xD3, 0x2A, 0x7A, 0xB6, 0x3B, 0x6A,
-    0x27, 0xCD, 0x47, 0x90, 0x8D, 0xDE, 0xD7, 0x52, 0x70, 0x15, 0xC1, 0x60, 0x05, 0xC2, 0x5E, 0xA9,
-    0x3B, 0x6D, 0xA5, 0x20, 0xEF, 0x92, 0x82, 0x6C, 0x4F, 0x33, 0xA4, 0x3A, 0x53, 0x14, 0xE4, 0x86,
-    0x91, 0x46, 0x21, 0x07, 0xAD, 0x42, 0xEE, 0x30, 0x71, 0x1F, 0x9F, 0x91, 0xF6, 0xC9, 0xE8, 0xE1,
-    0xB1, 0xCD, 0x14, 0x7F, 0xB2, 0x80, 0x97, 0x04, 0x6B, 0xD9, 0x08, 0xBA, 0x05, 0x35, 0x67, 0xA9,
-    0xFD, 0x54, 0xF4, 0x25, 0x11, 0x84, 0xC7, 0xD0, 0x65, 0xF8, 0x80, 0x04, 0x36, 0x1B, 0x3A, 0x24,
-    0x82, 0xC5, 0x1B, 0x1E, 0x89, 0x1E, 0xF7, 0xC3, 0x98, 0x57, 0x73, 0xD2, 0x6A, 0x13, 0xCA, 0xF9,
-    0x58, 0x95, 0xC1, 0x20, 0x0F, 0xFE, 0x0C, 0xB5, 0x80, 0xFC, 0xF5, 0x0E, 0x18, 0x3D, 0x8E, 0xF2,
-    0xAC, 0xD8, 0x04, 0x52, 0x3C, 0xD6, 0x0A, 0x8D, 0xC8, 0xE9, 0x79, 0x8B, 0xDA, 0x54, 0xBC, 0xEE,
-    0xD1, 0x6E, 0x1E, 0x6E, 0x5C, 0x20, 0x87, 0x5B, 0x7F, 0x49, 0x30, 0x64, 0x03, 0x49, 0x44, 0x47,
-    0xB0, 0x68, 0x0C, 0xB8, 0x6E, 0x0C, 0x3B, 0x05, 0x10, 0x3C, 0x31, 0xE5, 0x1B, 0x0E, 0x0E, 0x92,
-    0x2F, 0x25, 0x6A, 0x8F, 0x72, 0x78, 0x84, 0xAB, 0x81, 0x1C, 0xFD, 0xAC, 0x6B, 0xBD, 0xDF, 0xAE,
-    0x50, 0x15, 0x19, 0x1F, 0xBC, 0x03, 0xF1, 0x63, 0xF1, 0x16, 0xA1, 0xAF, 0xF2, 0x10, 0x7A, 0x00,
-    0xE1, 0xFE, 0xC8, 0x82, 0xF0, 0xA4, 0x69, 0x2A, 0x9F, 0xAF, 0xAD, 0x23, 0x2C, 0xFE, 0xCF, 0x51,
-    0xD2, 0x69, 0x25, 0xD2, 0x69, 0xEB, 0x45, 0xD0, 0xBD, 0xD9, 0x49, 0x4C, 0xBC, 0x4C, 0x7A, 0xA8,
-    0xD6, 0x03, 0x39, 0xC3, 0xE1, 0xA8, 0xD2, 0xE9, 0x8A, 0x4A, 0xE9, 0xF6, 0x3D, 0xA4, 0xD3, 0xE0,
-    0x5F, 0xF4, 0x80, 0x20, 0xC9, 0xF4, 0x52, 0x49, 0xBA, 0xCA, 0xF7, 0xB6, 0x1B, 0x51, 0xCD, 0xBE,
-    0x41, 0x49, 0x13, 0x62, 0x45, 0xCA, 0x68, 0x14, 0x00, 0xA0, 0xD4, 0x80, 0x04, 0xDB, 0x65, 0x6F,
-    0xB0, 0x53, 0xF0, 0xD8, 0xB8, 0xFD, 0xCF, 0x88, 0x59, 0x90, 0x7B, 0x5F, 0xB1, 0x90, 0x85, 0x32,
-    0x26, 0x1D, 0x3A, 0x85, 0x59, 0x50, 0x5C, 0x71, 0xAF, 0x0A, 0x69, 0xCC, 0xD1, 0xB5, 0xA2, 0xA1,
-    0x7E, 0x24, 0xBA, 0x89, 0x90, 0x83, 0xFB, 0xEC, 0xB6, 0x82, 0x93, 0x45, 0x74, 0xA5, 0x2B, 0x2E,
-    0xFF, 0xCA, 0xA5, 0x17, 0x9B, 0x3F, 0x9B, 0x1A, 0xC2, 0x6A, 0x06, 0x8D, 0x32, 0x6D, 0xE8, 0x71,
-    0x9C, 0x3F, 0xCC, 0x61, 0xB0, 0x9D, 0x41, 0x57, 0xA7, 0xFF, 0x4E, 0x88, 0x50, 0x6E, 0xD8, 0x87,
-    0xE3, 0x27, 0x43, 0x40, 0xD5, 0x32, 0xA0, 0x53, 0xEA, 0x47, 0x3A, 0x2C, 0x6E, 0xEF, 0xA2, 0xA3,
-    0x53, 0xD0, 0xE8, 0xA7, 0xD1, 0xCA, 0xC7, 0x95, 0xC9, 0xA9, 0xC6, 0x66, 0xF0, 0xB4, 0xDA, 0x02,
-    0x12, 0x3A, 0x0F, 0x5C, 0xCB, 0x18, 0x5E, 0x10, 0x1A, 0xA4, 0x8D, 0x52, 0x3C, 0x10, 0xC7, 0x31,
-    0x99, 0x5E, 0x4E, 0x12, 0x2A, 0x04, 0xCD, 0xD4, 0xEA, 0x49, 0x4F, 0xB3, 0xF0, 0x72, 0x84, 0x17,
-    0x6E, 0xC1, 0x64, 0x88, 0x77, 0x0B, 0x01, 0x4B, 0x6A, 0x62, 0x6F, 0x4A, 0x51, 0xAC, 0x61, 0x76,
-    0x93, 0x49, 0x42, 0x8F, 0x65, 0xFB, 0x02, 0xBE, 0xF4, 0xA9, 0xBC, 0x4F, 0x4D, 0x5E, 0x7D, 0xCE,
-    0x1C, 0xBF, 0x2F, 0x4B, 0x45, 0x62, 0x12, 0xE9, 0x1A, 0xBC, 0x61, 0x2F, 0x08, 0x3D, 0x35, 0x80,
-    0xE4, 0x75, 0x32, 0x30, 0x80, 0x72, 0x60, 0x0E, 0x6E, 0x8E, 0xC0, 0x58, 0x71, 0xB3, 0x5E, 0xD9,
-    0x39, 0xBA, 0x98, 0x3F, 0xD7, 0xC6, 0xE6, 0xC2, 0x31, 0x8F, 0x4F, 0x6B, 0x02, 0x44, 0xC3, 0xBB,
-    0x21, 0xAE, 0xCD, 0x59, 0xDD, 0xCB, 0xE6, 0x3D, 0xD7, 0xBB, 0xC9, 0x7B, 0xF3, 0x7A, 0x5B, 0x8B,
-    0x01, 0x79, 0xB0, 0xD8, 0x9F, 0x54, 0xF1, 0xFC, 0x73, 0xB2, 0x17, 0xE1, 0xC4, 0x5F, 0x7D, 0x1A,
-    0xB2, 0xBD, 0x98, 0x1B, 0xF0, 0x42, 0x3D, 0xD1, 0xB4, 0xA5, 0xCD, 0x2D, 0x70, 0xCE, 0x48, 0x83,
-    0x36, 0xF5, 0x63, 0xB1, 0xD1, 0x8C, 0x16, 0xE7, 0x02, 0x0F, 0x3C, 0x44, 0x7D, 0xA6, 0x4A, 0xD6,
-    0x18, 0x3A, 0x55, 0x6E, 0xF0, 0xA6, 0xC7, 0x66, 0x9D, 0x0A, 0xD2, 0x6A, 0xD2, 0x01, 0xF1, 0x97,
-    0xD4, 0x32, 0xD8, 0xDF, 0x51, 0x95, 0x86, 0xEA, 0xB5, 0xE2, 0xD5, 0x39, 0x3B, 0x7E, 0xDB, 0x0F,
-    0xC9, 0xAF, 0x95, 0x32, 0x8B, 0x4E, 0xFD, 0xC3, 0xCF, 0xCF, 0x4E, 0x92, 0xDF, 0xBE, 0xDB, 0x0C,
-    0x53, 0x1F, 0xAD, 0xCF, 0x18, 0x0A, 0xE4, 0xC4, 0x5B, 0x9C, 0x92, 0x27, 0xDE, 0xA2, 0x14, 0x65,
-    0x60, 0x6C, 0x46, 0x0E, 0x5E, 0x56, 0x27, 0x25, 0x31, 0xD9, 0xE3, 0x35, 0x42, 0x5B, 0x2E, 0xB9,
-    0x09, 0x6A, 0xDE, 0xD2, 0xF1, 0xC3, 0x98, 0xA4, 0xA8, 0x8F, 0x7B, 0x7E, 0x6B, 0x5E, 0x13, 0xBF,
-    0x8D, 0xE9, 0x4A, 0xCA, 0x41, 0x30, 0x46, 0x89, 0xD6, 0x82, 0xF1, 0x38, 0x43, 0x28, 0x12, 0x80,
-    0x23, 0xC0, 0xDE, 0xC3, 0x8C, 0x27, 0xB3, 0x49, 0x48, 0x17, 0xE4, 0x3C, 0xA8, 0xA1, 0x04, 0x8F,
-    0xE4, 0xAE, 0xA3, 0x0A, 0xFB, 0xAE, 0xCC, 0xF2, 0x08, 0x06, 0xDC, 0xE7, 0x1A, 0xE1, 0x29, 0x78,
-    0x45, 0xFA, 0x53, 0xF7, 0x33, 0x60, 0x26, 0x3B, 0x91, 0xA7, 0x2E, 0x77, 0xA0, 0x86, 0xF2, 0x48,
-    0xC2, 0x17, 0x28, 0xD7, 0x81, 0xDB, 0xB8, 0x2C, 0x51, 0x97, 0x15, 0x7C, 0x90, 0x4B, 0x0D, 0xA3,
-    0xCB, 0x15, 0x41, 0xC3, 0x7A, 0x7A, 0x7B, 0xF7, 0x2C, 0x67, 0x9B, 0xC8, 0x33, 0x6B, 0x06, 0x66,
-    0xF5, 0x4A, 0x51, 0x44, 0x81, 0xE7, 0x9E, 0xD0, 0x14, 0xA8, 0x05, 0x2D, 0x2F, 0x92, 0x4B, 0x63,
-    0x8A, 0x6C, 0x40, 0x15, 0x13, 0x41, 0x02, 0xD5, 0x47, 0xBA, 0x3D, 0xAD, 0xE1, 0x5E, 0x03, 0x8A,
-    0x63, 0x0C, 0xF6, 0x59, 0xD2, 0x2F, 0x00, 0xC9, 0x72, 0x89, 0x41, 0x2A, 0x63, 0x5D, 0x06, 0xD7,
-    0x95, 0x9E, 0x11, 0x19, 0xC5, 0xDF, 0xB7, 0xE9, 0xA7, 0xC0, 0xA3, 0xB8, 0x26, 0x56, 0x3F, 0x63,
-    0x15, 0x29, 0x88, 0x5C, 0x26, 0x30, 0xED, 0x43, 0xE5, 0x58, 0x07, 0xC8, 0x5C, 0x7D, 0x6B, 0x24,
-    0xFC, 0xF9, 0x7A, 0x3B, 0x13, 0xAE, 0x9C, 0x05, 0x6B, 0xF8, 0xE5, 0xE6, 0xB6, 0x3C, 0x70, 0x65,
-    0x90, 0xEF, 0xBF, 0x36, 0x60, 0xF2, 0xF2, 0x21, 0xD0, 0x94, 0xC4, 0x10, 0xF8, 0x42, 0xA1, 0x98,
-    0xA4, 0xFA, 0x29, 0xB8, 0x11, 0xD1, 0x95, 0x35, 0x6D, 0xFD, 0x35, 0x04, 0x51, 0x34, 0x0C, 0xCF,
-    0x14, 0x72, 0x4D, 0xBF, 0xAB, 0x5A, 0x80, 0x31, 0x81, 0x25, 0xB6, 0xEA, 0x86, 0x3A, 0xE7, 0x23,
-    0x2A, 0xF2, 0xBB, 0xEA, 0x59, 0xF8, 0x7A, 0x96, 0x07, 0xB6, 0x7A, 0xFE, 0xEE, 0xEB, 0xA5, 0xB6,
-    0x8B, 0x93, 0x5A, 0xCF, 0x6C, 0xE3, 0x5D, 0xF2, 0xDE, 0x5B, 0xB3, 0xA2, 0x5D, 0xD7, 0x27, 0xDA,
-    0xA8, 0x6D, 0xAE, 0xF1, 0x14, 0xED, 0xC6, 0xF5, 0x25, 0xB6, 0x7B, 0x07, 0xC0, 0xBE, 0x70, 0x26,
-    0xEA, 0xF0, 0x60, 0x58, 0x19, 0x59, 0x03, 0x61, 0xBE, 0xFA, 0x77, 0xEE, 0xAE, 0x17, 0x08, 0x13,
-    0x13, 0xE2, 0x31, 0xAA, 0xE8, 0xF3, 0xE3, 0x1C, 0x51, 0x6C, 0x5A, 0x51, 0x91, 0x4D, 0xA9, 0x43,
-    0x91, 0xBE, 0xE7, 0x33, 0x6E, 0x36, 0x3B, 0x65, 0x21, 0x6C, 0xED, 0xBD, 0xF7, 0xB7, 0x76, 0xF4,
-    0x3A, 0x7F, 0xDF, 0xB0, 0x9F, 0xDA, 0xF3, 0x26, 0xF6, 0xFC, 0xB1, 0xBD, 0x0F, 0x63, 0x35, 0xF8,
-    0x16, 0xEA, 0xE1, 0x5E, 0x7B, 0xB1, 0x26, 0x00, 0xD9, 0x31, 0x8E, 0x2D, 0xB6, 0xFD, 0xC8, 0xF6,
-    0xC1, 0x8E, 0x77, 0x55, 0x83, 0xEC, 0x4A, 0x93, 0xBD, 0xB8, 0xFF, 0x14, 0xD0, 0xB1, 0x0E, 0xD6,
-    0x5B, 0x5C, 0xF4, 0x7A, 0x47, 0x08, 0x30, 0x18, 0xE6, 0xDE, 0xE9, 0x5F, 0x82, 0x04, 0x33, 0x50,
-    0x17, 0x6C, 0x2D, 0x56, 0x7C, 0x3C, 0x3A, 0x74, 0xB1, 0x50, 0x43, 0x54, 0x3B, 0xB1, 0x28, 0x4F,
-    0x45, 0x5B, 0xF9, 0xA2, 0x65, 0x42, 0x05, 0x2E, 0x43, 0xDF, 0x48, 0x63, 0xAB, 0xAB, 0x18, 0x16,
-    0xCA, 0xFF, 0x8E, 0x19, 0xEB, 0xD4, 0xA9, 0xE7, 0xDC, 0x19, 0xBA, 0x56, 0xBA, 0x1C, 0xE4, 0x58,
-    0x95, 0x74, 0x78, 0x03, 0x65, 0x34, 0xF3, 0x38, 0x56, 0xD3, 0xA8, 0x22, 0xD5, 0x2C, 0xFC, 0x28,
-    0xC8, 0xAF, 0x2A, 0x85, 0xBC, 0xA4, 0xBB, 0x57, 0x94, 0xA7, 0x20, 0xBE, 0x41, 0x06, 0x3D, 0x99,
-    0x8B, 0x90, 0x78, 0xC2, 0xD6, 0x18, 0x45, 0xE5, 0xA5, 0xA0, 0x64, 0x1D, 0x73, 0x51, 0x05, 0x36,
-    0x34, 0x64, 0x36, 0xB9, 0xD7, 0x81, 0xAF, 0xBB, 0xE0, 0xA6, 0x20, 0xDD, 0x2F, 0x8B, 0x26, 0x16,
-    0xC0, 0x91, 0x32, 0xC6, 0x0E, 0x4F, 0x9B, 0x4F, 0x85, 0xE8, 0xD3, 0x24, 0x37, 0x86, 0xAF, 0x1A,
-    0xCE, 0xA5, 0xA0, 0x58, 0x25, 0xF0, 0x21, 0x00, 0x65, 0x27, 0xBB, 0xB4, 0xC6, 0xAC, 0xA5, 0x10,
-    0x01, 0xE1, 0xA7, 0x55, 0xB6, 0x01, 0x1A, 0x32, 0x6C, 0x47, 0x1A, 0x95, 0xDD, 0xA3, 0x36, 0x93,
-    0x36, 0x87, 0xF8, 0xD2, 0xC2, 0xC7, 0x14, 0xD7, 0x10, 0xDA, 0x93, 0x2A, 0x82, 0x70, 0xBB, 0xBF,
-    0xAB, 0xA0, 0xEB, 0x5E, 0x85, 0x19, 0x85, 0xCB, 0x65, 0x63, 0xB7, 0xB3, 0x07, 0x07, 0x4F, 0x5C,
-    0x17, 0xCB, 0x69, 0x17, 0xD7, 0x40, 0xA9, 0xC7, 0x75, 0x5A, 0x25, 0x4D, 0x5C, 0x27, 0x4D, 0x2A,
-    0x0F, 0x00, 0xBE, 0x37, 0x06, 0xF7, 0x5B, 0xC5, 0x42, 0x45, 0xF2, 0x4A, 0x83, 0x93, 0x46, 0x1A,
-    0x66, 0x12, 0x58, 0xF0, 0x48, 0xA7, 0x74, 0x3A, 0xE5, 0x37, 0x03, 0x53, 0xB5, 0xAB, 0x81, 0x1F,
-    0xD3, 0x2E, 0x5F, 0xF1, 0x12, 0xC6, 0x28, 0x25, 0xF0, 0x66, 0xBF, 0xE4, 0x32, 0xBA, 0xD2, 0xDB,
-    0xB1, 0x22, 0x49, 0xD2, 0x15, 0x43, 0x50, 0x66, 0xCF, 0x8B, 0xE8, 0x67, 0xB1, 0x48, 0xE6, 0x38,
-    0x76, 0x83, 0x3F, 0xDD, 0x84, 0x79, 0x0D, 0x96, 0x07, 0x4C, 0xE5, 0x57, 0x18, 0x44, 0x18, 0x93,
-    0xDF, 0xED, 0xE3, 0x86, 0xE2, 0x61, 0xDC, 0xA4, 0x70, 0xD5, 0xE7, 0xAB, 0x7C, 0x05, 0x90, 0xFB,
-    0x58, 0xE4, 0xFC, 0x1F, 0xC0, 0x89, 0x1F, 0xB5, 0x93, 0x1E, 0x0D, 0x2D, 0x34, 0x2F, 0x6E, 0xA6,
-    0x3D, 0x74, 0xDC, 0x2C, 0x5F, 0x81, 0x60, 0xC6, 0x2D, 0x02, 0xE0, 0x64, 0xC4, 0x16, 0x2B, 0x11,
-    0x3F, 0x8B, 0x0F, 0xA5, 0x93, 0x32, 0xC8, 0xA3, 0x97, 0x80, 0x0C, 0xA1, 0xFF, 0x14, 0x83, 0x57,
-    0xE6, 0x88, 0x46, 0xB0, 0xF5, 0xDC, 0x87, 0x8E, 0x1F, 0xA3, 0xFC, 0x11, 0x7B, 0xC4, 0xAF, 0xA5,
-    0xF8, 0x1C, 0x69, 0x76, 0x84, 0xBB, 0x36, 0xE9, 0x8A, 0xA1, 0x35, 0x75, 0x22, 0x33, 0x64, 0x7F,
-    0x51, 0x54, 0x71, 0xA3, 0x18, 0x50, 0x92, 0x7A, 0x37, 0xE0, 0x26, 0xF0, 0x25, 0xE9, 0xFE, 0x79,
-    0x57, 0xDC, 0x71, 0x74, 0xDF, 0x26, 0x35, 0xBC, 0x45, 0x93, 0x5E, 0xF6, 0x65, 0x2A, 0xB5, 0x4E,
-    0xEA, 0x7C, 0x99, 0x56, 0x52, 0x4F, 0xE9, 0x8C, 0x14, 0x18, 0xFE, 0x3A, 0xB5, 0xA3, 0x58, 0xFA,
-    0x56, 0x86, 0x48, 0x8D, 0x3E, 0x96, 0x69, 0x50, 0x4F, 0xFB, 0xD1, 0x81, 0xE7, 0x97, 0x63, 0xFB,
-    0x33, 0x32, 0x13, 0x56, 0xAE, 0x88, 0x38, 0x1F, 0x9A, 0x13, 0xF5, 0xCA, 0x58, 0x69, 0x0A, 0xA6,
-    0xED, 0x8A, 0x34, 0x7C, 0xE2, 0x22, 0x43, 0x67, 0x52, 0xB2, 0x0C, 0x15, 0x87, 0x1C, 0xEA, 0x38,
-    0x36, 0x3C, 0x9B, 0xFA, 0x49, 0xE7, 0x81, 0xC5, 0x8A, 0xC1, 0xD4, 0xFA, 0x4B, 0x72, 0x55, 0xD8,
-    0x19, 0x20, 0x9A, 0x14, 0x15, 0xA3, 0x61, 0x8C, 0x99, 0xCE, 0xE5, 0xEB, 0x5B, 0x85, 0x0D, 0x42,
-    0x84, 0x53, 0xF8, 0x1E, 0x8F, 0x64, 0x48, 0x75, 0xA4, 0x2D, 0x2F, 0x31, 0x36, 0x38, 0x85, 0x28,
-    0x4C, 0x77, 0xEE, 0x16, 0x9C, 0x08, 0x27, 0x53, 0x1F, 0x90, 0xA5, 0x11, 0xE8, 0x70, 0xB2, 0xBE,
-    0x77, 0x1A, 0xD6, 0xD1, 0x8C, 0x4D, 0x3F, 0x22, 0x24, 0x32, 0x69, 0x7C, 0x08, 0x45, 0xE2, 0xC3,
-    0x9B, 0xD4, 0x5B, 0x9E, 0xA9, 0x03, 0x28, 0x6A, 0x8B, 0x4B, 0x42, 0x85, 0xDF, 0x75, 0x91, 0x8C,
-    0x86, 0x69, 0x8B, 0x69, 0x90, 0x54, 0xE9, 0x32, 0x2F, 0x8B, 0x52, 0xBA, 0x7A, 0x24, 0xFF, 0xA2,
-    0x46, 0x46, 0x61, 0x97, 0x2F, 0xA5, 0xA8, 0x45, 0x2D, 0xF9, 0xAA, 0xA4, 0xB5, 0xE6, 0x44, 0x85,
-    0x79, 0x84, 0xF1, 0x65, 0xF1, 0xC0, 0x95, 0x19, 0xC7, 0x13, 0x22, 0x36, 0x46, 0xAC, 0x3C, 0xA3,
-    0x12, 0x4A, 0x0D, 0x73, 0x02, 0xF5, 0x62, 0xCC, 0x46, 0xE6, 0x34, 0x48, 0x2A, 0x87, 0xB4, 0x2A,
-    0xA3, 0x7B, 0x76, 0xDA, 0x19, 0x89, 0x34, 0xC2, 0x60, 0xD6, 0x50, 0x3F, 0xE0, 0x5D, 0xE0, 0xC7,
-    0xB7, 0x08, 0xCB, 0xEF, 0xBD, 0x00, 0x77, 0x5A, 0xC7, 0x16, 0xF9, 0xD0, 0x5D, 0x24, 0xDE, 0x03,
-    0x08, 0x95, 0x1C, 0x6C, 0x3C, 0xAF, 0x85, 0xBB, 0xF7, 0xC4, 0x8E, 0xB0, 0x99, 0x01, 0x6D, 0x41,
-    0x74, 0x45, 0x4D, 0xC1, 0x05, 0x7F, 0xF1, 0x34, 0x3E, 0xE3, 0x5D, 0x88, 0x95, 0xBC, 0x05, 0xF7,
-    0x52, 0xA6, 0x4C, 0x20, 0x29, 0x60, 0xE2, 0x5C, 0x72, 0x26, 0x5D, 0xD6, 0xC7, 0x4F, 0xB2, 0xD1,
-    0x33, 0x0D, 0xB0, 0x71, 0x20, 0x47, 0x54, 0x71, 0xB4, 0x1D, 0x96, 0x18, 0x9C, 0xAF, 0x9D, 0x51,
-    0x7F, 0x26, 0xFD, 0xEC, 0xD2, 0xE8, 0xF0, 0x70, 0xB6, 0xA2, 0xB4, 0xA5, 0x1C, 0xE3, 0xBB, 0x1A,
-    0xDC, 0xE3, 0x3C, 0x22, 0x89, 0x8D, 0xBF, 0x31, 0xC4, 0x69, 0xBC, 0x2A, 0xE3, 0xC6, 0x5D, 0x06,
-    0x75, 0x93, 0xB6, 0x17, 0x72, 0x22, 0xB3, 0x1F, 0xE3, 0x57, 0x46, 0xB8, 0xFC, 0x4A, 0x87, 0xE8,
-    0x3F, 0x21, 0x8C, 0x3D, 0xE8, 0xA2, 0x4C, 0x67, 0xE9, 0x92, 0x29, 0x06, 0xB8, 0x4C, 0x86, 0x98,
-    0x64, 0xF9, 0x3F, 0xC8, 0x5C, 0x03, 0xF9, 0x1B, 0xF7, 0xA0, 0xF2, 0xE3, 0x3E, 0xDE, 0x93, 0x41,
-    0xD0, 0x3B, 0x43, 0x62, 0x03, 0x0B, 0x7C, 0x8D, 0xCD, 0xDA, 0x71, 0x90, 0xAA, 0x3E, 0x29, 0x74,
-    0x7A, 0xEF, 0x7B, 0x32, 0x50, 0x1B, 0x86, 0x5F, 0x9B, 0x1B, 0xC9, 0xC4, 0x5E, 0xCA, 0x95, 0x10,
-    0x1B, 0x71, 0xEB, 0x3A, 0x1C, 0x45, 0xC3, 0x03, 0x7C, 0x8A, 0x86, 0xE0, 0xF8, 0xF7, 0x14, 0x88,
-    0x9F, 0x77, 0x83, 0xA8, 0xAC, 0x20, 0x2F, 0xF5, 0x6E, 0x18, 0xD3, 0xA4, 0xC9, 0x44, 0x84, 0xA9,
-    0x82, 0x9F, 0xEC, 0x4C, 0x11, 0xEB, 0xD9, 0xB9, 0xD2, 0x34, 0x7B, 0x33, 0x6F, 0x36, 0x53, 0xC3,
-    0x71, 0xDA, 0x01, 0xD8, 0x51, 0x0C, 0x62, 0x51, 0x66, 0x8A, 0xF3, 0x8E, 0xA9, 0xD1, 0xF6, 0x93,
-    0x8D, 0x1A, 0x2A, 0xC8, 0x08, 0x91, 0x92, 0x61, 0xFC, 0x66, 0x90, 0xDC, 0xA1, 0xDF, 0xBD, 0xD6,
-    0x80, 0x99, 0x48, 0x01, 0x70, 0x40, 0x63, 0xED, 0xCD, 0x8A, 0x26, 0xB4, 0x08, 0xD2, 0x88, 0xE6,
-    0xDE, 0x3A, 0x38, 0xA6, 0xA1, 0xF6, 0xC4, 0x52, 0xF5, 0xE4, 0x52, 0xAB, 0x60, 0xEB, 0x79, 0x0D,
-    0x2E, 0x68, 0x7D, 0x55, 0xD4, 0xC1, 0xD6, 0xE2, 0xCD, 0xE4, 0xB3, 0xE4, 0xB2, 0xB0, 0xBF, 0xEC,
-    0xC1, 0xDC, 0x22, 0x45, 0x68, 0x2F, 0xDD, 0xDC, 0x12, 0x9D, 0x9F, 0xC8, 0x93, 0xC4, 0x53, 0xE3,
-    0x39, 0xBE, 0x57, 0xAD, 0x0C, 0xF0, 0x80, 0x07, 0xF1, 0x1D, 0x37, 0x8F, 0x5A, 0xDA, 0xBB, 0xD3,
-    0x8A, 0x4D, 0x89, 0xF9, 0x41, 0xB6, 0x05, 0xA2, 0xF2, 0x60, 0x45, 0x37, 0x58, 0xD4, 0x53, 0xD3,
-    0x4F, 0x6B, 0x11, 0x0E, 0x84, 0x4A, 0x5F, 0xC0, 0x28, 0x8C, 0x85, 0x77, 0xEE, 0xB9, 0x0F, 0x68,
-    0xA1, 0xF5, 0x99, 0x2F, 0x5C, 0xA3, 0xD3, 0x66, 0x4E, 0x3A, 0xA5, 0xA6, 0x88, 0xC0, 0x52, 0x1D,
-    0xB0, 0xA1, 0xAB, 0x60, 0x08, 0x3C, 0x3F, 0xBA, 0x68, 0xB4, 0xD8, 0x34, 0xE8, 0x9B, 0x7D, 0x5F,
-    0x85, 0x03, 0x33, 0xEE, 0xDF, 0x5D, 0x74, 0x1C, 0x46, 0xA7, 0xD9, 0x53, 0xCA, 0xB4, 0x5F, 0x41,
-    0x35, 0xA7, 0x08, 0x0F, 0x04, 0xF7, 0xA6, 0x80, 0x9D, 0xDE, 0x42, 0x11, 0x70, 0xC5, 0x01, 0x38,
-    0xF8, 0xEB, 0xF4, 0xAC, 0xF7, 0x2C, 0x4A, 0x3A, 0x16, 0x15, 0xB7, 0x1D, 0x75, 0xBA, 0xAB, 0x1A,
-    0x95, 0xA7, 0x77, 0xB5, 0x1A, 0xAC, 0xF7, 0x11, 0x98, 0x92, 0x68, 0x13, 0x20, 0x21, 0x79, 0x1B,
-    0xBB, 0xBF, 0x72, 0xA7, 0x15, 0x54, 0x6C, 0x43, 0xCB, 0xA9, 0xE4, 0xD5, 0x6B, 0x18, 0xCB, 0xDC,
-    0x77, 0xE2, 0x83, 0x56, 0xFE, 0x70, 0xD1, 0x06, 0xA4, 0x50, 0x91, 0x53, 0x7C, 0x6C, 0xE7, 0xD1,
-    0xEC, 0x85, 0x7B, 0x6D, 0x07, 0xE4, 0x6F, 0x4E, 0xAC, 0xE4, 0x0A, 0xCA, 0xB6, 0x1A, 0xE4, 0x5E,
-    0x51, 0xBB, 0x1B, 0xE6, 0x82, 0x06, 0x83, 0xA8, 0x65, 0x7B, 0x70, 0xA6, 0xF4, 0x9B, 0xDE, 0x9F,
-    0xDE, 0xED, 0x2F, 0x16, 0x0B, 0x86, 0x4B, 0xCB, 0x7B, 0xF5, 0x9E, 0x8B, 0xC4, 0x83, 0xB5, 0xFA,
-    0x34, 0xC6, 0xD8, 0x40, 0xB9, 0xCA, 0x10, 0x1D, 0xC0, 0x97, 0x52, 0x8A, 0x83, 0x52, 0xAD, 0x1F,
-    0xAB, 0x53, 0x09, 0xE6, 0xDC, 0x75, 0x78, 0x00, 0x0D, 0xBC, 0xB4, 0x5D, 0xC6, 0x3E, 0xC0, 0x6B,
-    0x09, 0x70, 0x7E, 0xCB, 0x8C, 0x13, 0x2F, 0x29, 0x80, 0x00, 0x46, 0x76, 0x02, 0x77, 0xCF, 0x78,
-    0xC8, 0x96, 0x23, 0x78, 0xAB, 0x4F, 0x7B, 0xA1, 0x5C, 0xCF, 0x6D, 0x00, 0x08, 0x64, 0x96, 0xB5,
-    0x91, 0x3B, 0x57, 0x74, 0xE1, 0x30, 0x79, 0xEF, 0x02, 0x10, 0x30, 0x05, 0x45, 0xFE, 0xA1, 0x6A,
-    0xA7, 0x57, 0xE8, 0x22, 0x47, 0x60, 0xB1, 0x7C, 0x42, 0xC7, 0x10, 0x19, 0xF7, 0x37, 0x68, 0x6B,
-    0x8D, 0x2E, 0x20, 0xD2, 0xAA, 0x24, 0xCD, 0x72, 0xD9, 0x90, 0x30, 0x21, 0xC3, 0xF4, 0x8B, 0x35,
-    0x7E, 0x16, 0x4F, 0xC3, 0x24, 0x00, 0xBC, 0xB5, 0x8C, 0xD9, 0x12, 0x59, 0x41, 0x17, 0x09, 0x3B,
-    0x29, 0x6E, 0x39, 0xA3, 0xC1, 0xEE, 0xD1, 0x7B, 0x57, 0x1C, 0x29, 0xD6, 0xEB, 0xAA, 0xAF, 0xE7,
-    0x6A, 0xC7, 0xD5, 0xD0, 0x71, 0x1F, 0x2F, 0xBA, 0x5C, 0x4B, 0x86, 0xA1, 0x9E, 0xD3, 0x18, 0x17,
-    0x78, 0x62, 0x8E, 0xFD, 0x05, 0x63, 0x78, 0x01, 0xA1, 0x88, 0x15, 0x3F, 0xD7, 0x33, 0xF2, 0x4D,
-    0xA4, 0x3C, 0x06, 0xEB, 0x4B, 0x9D, 0x4B, 0x82, 0x99, 0x50, 0x0B, 0x06, 0xF7, 0x42, 0x3E, 0x10,
-    0x32, 0x0C, 0xC9, 0xA7, 0xC6, 0x67, 0xE5, 0x3F, 0xA7, 0xD4, 0x77, 0x89, 0x5E, 0x61, 0x48, 0x82,
-    0x93, 0x5E, 0xCD, 0x54, 0xDD, 0x20, 0x44, 0xA7, 0x1C, 0x91, 0xC5, 0x40, 0x5B, 0xB7, 0x17, 0xC7,
-    0xDE, 0x62, 0xA7, 0x27, 0x0C, 0x41, 0x11, 0x2E, 0x8C, 0x5D, 0xAD, 0xBB, 0x2A, 0x61, 0x60, 0xFB,
-    0x2A, 0x51, 0x5B, 0xCD, 0xF1, 0x75, 0x8E, 0x9C, 0xAF, 0x67, 0x2B, 0x9F, 0x78, 0x13, 0x38, 0xE1,
-    0x9C, 0xE1, 0xF8, 0xF9, 0x92, 0x66, 0xE3, 0x77, 0xF0, 0x86, 0x62, 0xCE, 0x84, 0x07, 0x59, 0x4F,
-    0xE3, 0xCF, 0x86, 0x95, 0xEC, 0xCB, 0xE9, 0x93, 0x03, 0x3F, 0xA3, 0x35, 0xAE, 0x18, 0x23, 0x7E,
-    0x20, 0x0A, 0x1B, 0xDE, 0x4F, 0x8B, 0xA5, 0x34, 0x3C, 0xFA, 0xBE, 0x86, 0xED, 0xB2, 0x3D, 0x98,
-    0x8F, 0x49, 0x6F, 0x85, 0xBA, 0xDD, 0x6E, 0xCD, 0xA0, 0x9D, 0x30, 0xE8, 0xB9, 0x9B, 0x10, 0xB1,
-    0xC9, 0x68, 0xD7, 0x5E, 0xC1, 0xF3, 0x39, 0x43, 0x49, 0x14, 0x58, 0xCE, 0x24, 0x05, 0x70, 0x3A,
-    0x59, 0xC0, 0x5C, 0x44, 0x70, 0xAC, 0x5B, 0xA9, 0x0B, 0x42, 0xDA, 0x70, 0xA4, 0x21, 0x2F, 0x10,
-    0x0E, 0x9B, 0xF1, 0x70, 0x4C, 0x1F, 0xBC, 0x5D, 0x1F, 0xB7, 0x13, 0x8D, 0x0A, 0x41, 0x48, 0x73,
-    0x0F, 0x18, 0x16, 0x9F, 0x0F, 0x41, 0xB6, 0x0B, 0xF4, 0xBD, 0x01, 0xA2, 0x61, 0x35, 0x08, 0x1B,
-    0x14, 0x6D, 0xA7, 0x61, 0x3D, 0x89, 0x33, 0xA6, 0xE2, 0x3A, 0x0F, 0x34, 0x24, 0x19, 0xD6, 0xA2,
-    0xBD, 0xD3, 0xAA, 0xB7, 0x2D, 0x87, 0xEF, 0x4D, 0x7D, 0x28, 0xFD, 0xDC, 0x12, 0x32, 0xA4, 0xDA,
-    0x3E, 0xB4, 0xA3, 0x6D, 0xBB, 0x8D, 0xB4, 0x4C, 0xD4, 0x29, 0x87, 0x00, 0x9F, 0x75, 0x32, 0x07,
-    0xF3, 0x1A, 0x6F, 0x1C, 0x17, 0x03, 0x83, 0x0F, 0xCF, 0xBB, 0x6A, 0xA3, 0x13, 0x96, 0x1B, 0xC7,
-    0xD9, 0xFA, 0x78, 0x4D, 0xA4, 0x43, 0xED, 0xA7, 0xB0, 0x78, 0x23, 0xD0, 0x66, 0xA6, 0xD8, 0xCB,
-    0xD0, 0x21, 0x62, 0x7B, 0x97, 0x53, 0x06, 0xA2, 0x8E, 0x15, 0x9E, 0x3D, 0xA7, 0x46, 0xFF, 0x0B,
-    0xD7, 0xAA, 0xE1, 0x30, 0x96, 0xA6, 0xEB, 0x35, 0xBC, 0x35, 0xA1, 0x65, 0x88, 0x36, 0xD9, 0x94,
-    0x01, 0x47, 0x05, 0xB9, 0x0F, 0x43, 0x1B, 0xC0, 0x78, 0x2C, 0x8B, 0x4B, 0x22, 0xCA, 0x92, 0x1D,
-    0x32, 0x6D, 0x87, 0x1E, 0x32, 0xE6, 0x4B, 0x0F, 0xA7, 0x7D, 0x02, 0xC7, 0x25, 0x6E, 0x1B, 0xBB,
-    0x74, 0x9D, 0xD0, 0x28, 0x67, 0x8C, 0x80, 0x66, 0x97, 0x58, 0x32, 0x74, 0x88, 0x89, 0x7E, 0x4A,
-    0x4B, 0x77, 0xC5, 0x48, 0xA5, 0xD0, 0xEB, 0xCA, 0x99, 0x61, 0x85, 0x35, 0x26, 0x4C, 0xE1, 0xBA,
-    0xF4, 0x32, 0x2A, 0xA4, 0x78, 0xA3, 0x15, 0x37, 0x1A, 0x31, 0x5F, 0xB7, 0xE1, 0xD0, 0x84, 0xA3,
-    0xF3, 0xC3, 0xC8, 0x1E, 0xBB, 0x21, 0x9E, 0x62, 0xEC, 0x86, 0x18, 0xC1, 0xF1, 0x10, 0x77, 0x21,
-    0x87, 0xE7, 0x0E, 0xB8, 0x09, 0xBB, 0x60, 0x43, 0x3C, 0x28, 0x38, 0xA2, 0xA7, 0x3A, 0x02, 0x54,
-    0x8B, 0x1F, 0x6D, 0x64, 0xE0, 0x81, 0xD8, 0xF5, 0x91, 0x4B, 0xE0, 0x4A, 0xCE, 0xDE, 0x1A, 0x0B,
-    0x63, 0xEE, 0x03, 0x1F, 0x26, 0x2F, 0xAC, 0x91, 0xB1, 0xEC, 0xA2, 0x14, 0xD5, 0x94, 0xAA, 0x74,
-    0xF2, 0xDD, 0x77, 0x57, 0xA8, 0xE9, 0x9A, 0xF7, 0xE5, 0x8D, 0x3D, 0x05, 0x78, 0x2C, 0x44, 0x31,
-    0xB8, 0xEC, 0xD4, 0x18, 0x16, 0xC3, 0x9F, 0xF5, 0x0C, 0xBE, 0x75, 0x1A, 0x92, 0x30, 0xA4, 0xED,
-    0x32, 0xA8, 0x0C, 0xEA, 0x29, 0x82, 0xD8, 0xDE, 0x06, 0x6B, 0x0F, 0x6D, 0x20, 0x2A, 0x38, 0x73,
-    0xC4, 0x73, 0xB9, 0x26, 0x1A, 0x39, 0x17, 0xA8, 0xCB, 0x5C, 0x25, 0xE5, 0xE9, 0x10, 0x2B, 0x29,
-    0xF3, 0xEA, 0xFD, 0xB6, 0x68, 0x93, 0x6E, 0x7B, 0xCE, 0x09, 0x19, 0x12, 0x71, 0x4D, 0x80, 0x9D,
-    0x42, 0xAE, 0x15, 0xB0, 0x16, 0xD0, 0xCD, 0xA7, 0xC9, 0x30, 0xA0, 0x4C, 0x60, 0x40, 0xE7, 0x6D,
-    0xFA, 0xB2, 0x4C, 0xD0, 0xDE, 0x15, 0xBD, 0x25, 0x9E, 0x18, 0xAA, 0xB8, 0x42, 0xC7, 0x36, 0x43,
-    0xBE, 0x9C, 0xE9, 0x61, 0xE2, 0x63, 0xC1, 0x02, 0x99, 0xA7, 0x2D, 0x06, 0xAA, 0x1F, 0x5B, 0x8E,
-    0x03, 0x4C, 0x53, 0xEB, 0xE1, 0x3C, 0xD3, 0x08, 0xC2, 0xE0, 0x89, 0x57, 0x96, 0x67, 0xED, 0xF2,
-    0xFE, 0xAE, 0xF8, 0x99, 0x78, 0x18, 0x0E, 0xBE, 0xB3, 0xC3, 0xF6, 0xF0, 0x19, 0x4F, 0x7F, 0x91,
-    0x3C, 0x61, 0x47, 0x5E, 0x18, 0x2A, 0x36, 0x5E, 0x81, 0xF6, 0x1A, 0x48, 0x83, 0x6E, 0x9E, 0xD2,
-    0x19, 0xD9, 0x9F, 0x29, 0x83, 0xBD, 0x1D, 0x19, 0xC3, 0xAD, 0xDC, 0xF6, 0x2D, 0x21, 0x51, 0x36,
-    0x0C, 0xE3, 0xDE, 0x26, 0xFB, 0x58, 0xE5, 0x98, 0x75, 0xD4, 0x8A, 0x4F, 0x05, 0xC3, 0x32, 0xAB,
-    0x33, 0x03, 0x0B, 0x75, 0x14, 0xDF, 0xB1, 0x8B, 0x08, 0xFB, 0xD4, 0xBC, 0x19, 0xBB, 0xAD, 0xD9,
-    0x4C, 0x3E, 0x70, 0x2A, 0x9A, 0xE7, 0xB7, 0x0C, 0xBA, 0x4F, 0xC1, 0x85, 0x19, 0x76, 0x14, 0x22,
-    0x05, 0xDB, 0xE0, 0x4B, 0x14, 0x68, 0x2C, 0x98, 0x38, 0x02, 0x2E, 0x43, 0x14, 0xD7, 0xBE, 0x40,
-    0x10, 0x73, 0x6D, 0x5E, 0x2A, 0x13, 0x9A, 0x06, 0x45, 0xF3, 0x59, 0x1E, 0x20, 0x1E, 0x63, 0x47,
-    0x7D, 0xAD, 0x27, 0x87, 0x9C, 0x45, 0xBF, 0xED, 0xE7, 0x51, 0x63, 0x7B, 0x53, 0x40, 0x2C, 0x0A,
-    0x39, 0x48, 0x7F, 0xA1, 0xEA, 0x4F, 0xB4, 0x9A, 0xAA, 0x55, 0xE0, 0xBF, 0x75, 0x4A, 0xEB, 0x02,
-    0xDF, 0xE6, 0x1E, 0x12, 0x13, 0x7A, 0x4A, 0x95, 0xFA, 0x59, 0x6A, 0xBD, 0x9A, 0xDA, 0xFE, 0x1B,
-    0xD6, 0xEC, 0x4D, 0xB0, 0xAD, 0xAD, 0xBE, 0x8A, 0xD5, 0x35, 0x0F, 0x92, 0x05, 0x27, 0x9E, 0xEA,
-    0x00, 0xAE, 0xFF, 0x49, 0x10, 0xED, 0x02, 0x95, 0xC6, 0xB7, 0x34, 0x8C, 0x18, 0xF0, 0x31, 0xD6,
-    0x3E, 0x07, 0x11, 0x68, 0x80, 0xCE, 0xF7, 0xB8, 0xA3, 0x0F, 0x1F, 0xE6, 0x77, 0xB2, 0x7D, 0x08,
-    0x73, 0x34, 0x4C, 0x33, 0xC9, 0x0B, 0xB0, 0x18, 0x34, 0x91, 0x77, 0x0C, 0xF5, 0x00, 0x50, 0x1B,
-    0x9E, 0xA4, 0x2E, 0x76, 0xDD, 0x93, 0x6E, 0xE9, 0x6D, 0x4D, 0x63, 0xF5, 0x41, 0x30, 0x4F, 0xC0,
-    0x33, 0xD8, 0x87, 0x94, 0xFE, 0x56, 0xDA, 0x52, 0xC7, 0x83, 0x35, 0x3D, 0x58, 0x7B, 0x36, 0x35,
-    0x36, 0x03, 0x3F, 0x75, 0x3C, 0x52, 0x7C, 0x65, 0xF9, 0xAF, 0xC7, 0x47, 0x0D, 0xEF, 0x63, 0x0B,
-    0xAA, 0x9D, 0xC7, 0x16, 0x4A, 0x2B, 0x75, 0xEE, 0x83, 0xC6, 0x1D, 0xF0, 0x5F, 0x04, 0x3E, 0xA7,
-    0x8C, 0xFA, 0x2F, 0x8A, 0x5A, 0xFD, 0x17, 0x1F, 0x7A, 0xFF, 0xC5, 0x2B, 0xF8, 0x2A, 0x98, 0x95,
-    0x09, 0x7A, 0x5B, 0xA9, 0xFF, 0x22, 0xA6, 0xD9, 0x81, 0x26, 0x59, 0x4A, 0x06, 0x4B, 0x10, 0x39,
-    0xF8, 0x2A, 0xE6, 0x50, 0x12, 0x19, 0x57, 0x4A, 0xF4, 0xB2, 0xA8, 0x1D, 0x63, 0xA7, 0x51, 0x23,
-    0x4D, 0xEC, 0xC8, 0x40, 0x5D, 0x55, 0x5C, 0xEE, 0xB5, 0xBD, 0xFA, 0xB4, 0xA5, 0xF0, 0xF4, 0x6A,
-    0x9D, 0xD7, 0x08, 0x3D, 0x74, 0x79, 0x29, 0x55, 0x63, 0x96, 0xB0, 0x90, 0x09, 0x6B, 0x12, 0xBA,
-    0xD3, 0xC9, 0x10, 0x85, 0xC9, 0x28, 0x36, 0xCF, 0x5C, 0x43, 0x44, 0xAF, 0x97, 0x0A, 0x25, 0xD0,
-    0xA9, 0x71, 0x76, 0xB1, 0x78, 0xDB, 0xE7, 0xAC, 0xB4, 0x76, 0x62, 0x0F, 0x7E, 0xE7, 0x85, 0xF7,
-    0x7E, 0x82, 0xFD, 0x3F, 0x19, 0x97, 0xFF, 0xEA, 0xEE, 0x46, 0xFA, 0xDA, 0xB8, 0x3B, 0x86, 0x6C,
-    0x02, 0x6F, 0x04, 0xEA, 0x64, 0x88, 0x86, 0x48, 0x1F, 0x51, 0x3D, 0x64, 0x12, 0x06, 0x42, 0x05,
-    0xC3, 0x1F, 0x4F, 0x34, 0x9A, 0xEA, 0x70, 0x28, 0x96, 0x0E, 0x66, 0xCB, 0x6D, 0xB3, 0xB6, 0x1F,
-    0x1C, 0x30, 0x2B, 0x2C, 0x07, 0x92, 0x68, 0x85, 0xDD, 0x3A, 0x7E, 0xDA, 0x69, 0x24, 0xBA, 0x7B,
-    0xED, 0xC5, 0x6C, 0x34, 0x68, 0x69, 0xB5, 0x57, 0x7E, 0x77, 0x38, 0x34, 0xC3, 0x9D, 0x6E, 0x60,
-    0x92, 0xE1, 0xC6, 0xD3, 0xE2, 0x7B, 0x9F, 0x0E, 0x15, 0x48, 0xA5, 0x18, 0xA9, 0x5C, 0xC1, 0x17,
-    0xEE, 0x69, 0xA9, 0xF7, 0x1F, 0xDD, 0x07, 0x1A, 0x8C, 0x33, 0x07, 0xA1, 0xC1, 0x91, 0x5B, 0xFE,
-    0x2E, 0xA9, 0xFE, 0x48, 0x43, 0xBE, 0x68, 0xF9, 0xBA, 0x0F, 0xFC, 0xEB, 0xAE, 0x03, 0x75, 0xD6,
-    0x8F, 0x57, 0xCA, 0x2A, 0x46, 0x41, 0x54, 0xCA, 0x3E, 0xC9, 0x80, 0xD1, 0x41, 0xA5, 0x3B, 0x2F,
-    0x11, 0x90, 0xCD, 0x69, 0xD2, 0xC9, 0x8B, 0xE8, 0xB3, 0xEC, 0x7F, 0x7C, 0x33, 0xC8, 0x83, 0xDF,
-    0x48, 0x97, 0x1D, 0x28, 0x73, 0x33, 0xC4, 0xF8, 0xD7, 0x3E, 0x62, 0x3F, 0x85, 0x68, 0x9F, 0x23,
-    0xF5, 0x5C, 0x1B, 0xFC, 0x75, 0x10, 0xD2, 0x7F, 0x4E, 0x1A, 0xFD, 0xC6, 0xC1, 0x61, 0x18, 0xFD,
-    0x74, 0x36, 0x2B, 0x5E, 0xD7, 0x28, 0xE2, 0x5B, 0xDD, 0x6C, 0x36, 0x5E, 0x79, 0xB8, 0xD5, 0xD4,
-    0x55, 0xBF, 0x23, 0x0D, 0x93, 0xD2, 0xE7, 0xFF, 0x57, 0x5D, 0x7A, 0x2D, 0xE8, 0x84, 0xBB, 0x9E,
-    0x7A, 0xF2, 0x15, 0xE1, 0x50, 0x4D, 0x31, 0x6E, 0xA2, 0xEA, 0xD8, 0xB7, 0x9F, 0xED, 0xDC, 0x4D,
-    0x37, 0xFD, 0x79, 0xEB, 0xFE, 0x5D, 0x06, 0xC2, 0x3A, 0x85, 0x09, 0x50, 0x58, 0x1A, 0xA4, 0xC6,
-    0xF4, 0x13, 0xF9, 0x95, 0x69, 0x78, 0xC2, 0x67, 0x34, 0xFC, 0xAD, 0x0D, 0xF6, 0x37, 0x24, 0xA9,
-    0x88, 0xD6, 0xD2, 0xF9, 0xB7, 0xC3, 0x41, 0x38, 0xFC, 0xFD, 0xE0, 0x4F, 0x83, 0x7B, 0xFF, 0x4C,
-    0x94, 0x0F, 0x15, 0x94, 0x51, 0x4B, 0x36, 0x8E, 0xDC, 0xF9, 0x6F, 0x5E, 0x40, 0x0F, 0x4F, 0x5F,
-    0xFB, 0x71, 0x20, 0x37, 0xE3, 0xA1, 0xDF, 0x94, 0xC7, 0xD8, 0x4B, 0xBF, 0xE1, 0x49, 0xF1, 0x23,
-    0xFC, 0x78, 0xDD, 0x65, 0x6B, 0x08, 0x4C, 0x0D, 0x11, 0x95, 0x52, 0x1A, 0xBF, 0x6B, 0x7E, 0x5F,
-    0x69, 0x61, 0x30, 0xCD, 0xBE, 0xFF, 0xA7, 0x81, 0x7E, 0x41, 0x14, 0xFC, 0xD3, 0xE0, 0x73, 0xF8,
-    0xD1, 0x37, 0x1F, 0x1F, 0x62, 0x5C, 0x47, 0xEA, 0x73, 0x29, 0xBD, 0xFD, 0x4F, 0xDF, 0x1C, 0x65,
-    0xDF, 0x5F, 0x7F, 0xF1, 0xBF, 0xBC, 0xCF, 0xE3, 0xC6, 0x6B, 0x21, 0xFB, 0xA1, 0x5A, 0xFD, 0xF7,
-    0xD6, 0x4F, 0x28, 0x87, 0xC3, 0x9F, 0xAC, 0x07, 0xD0, 0x3A, 0xE1, 0x48, 0x3D, 0x70, 0xD8, 0x24,
-    0xF3, 0x37, 0x8C, 0xED, 0xF1, 0xDF, 0x01, 0x7E, 0x2D, 0x08, 0xFE, 0x46, 0x3E, 0xC3, 0xF8, 0x2D,
-    0xFC, 0x48, 0xE5, 0xA0, 0xFA, 0xFE, 0xDD, 0x80, 0x1B, 0xE6, 0x1D, 0x23, 0xF2, 0xE2, 0x6F, 0x63,
-    0xF3, 0x9B, 0x6A, 0x19, 0x7C, 0xE4, 0x8E, 0xFB, 0x46, 0x30, 0xF5, 0xCE, 0xC7, 0x4E, 0x3D, 0xCE,
-    0x14, 0x46, 0xB2, 0xDC, 0x6A, 0x06, 0x21, 0xC1, 0xDB, 0x84, 0x56, 0xC1, 0xE7, 0xF2, 0x43, 0x72,
-    0x3F, 0xE5, 0x7B, 0x38, 0x3E, 0x5B, 0x7D, 0xB9, 0x97, 0xDB, 0xA6, 0x95, 0x27, 0x48, 0x14, 0x15,
-    0xD2, 0x25, 0x0B, 0xF1, 0xC5, 0x73, 0xDE, 0xE1, 0x71, 0x51, 0x0D, 0xFA, 0x44, 0x75, 0xCD, 0xB5,
-    0x7E, 0x34, 0x74, 0x17, 0x9A, 0xF4, 0xEE, 0x8E, 0xF9, 0x67, 0x03, 0xFC, 0x03, 0x2E, 0xDD, 0x49,
-    0xAF, 0x42, 0x7E, 0xA4, 0x96, 0x01, 0xE6, 0xB9, 0x5A, 0x1A, 0x4F, 0x37, 0x56, 0xB5, 0x52, 0x63,
-    0x58, 0x73, 0xF7, 0x57, 0x84, 0x24, 0x7E, 0x22, 0x32, 0x77, 0x9A, 0xD3, 0x02, 0xC4, 0x05, 0x29,
-    0x07, 0x0B, 0x24, 0xD1, 0x80, 0xCB, 0x21, 0xA3, 0xCE, 0x8D, 0xE2, 0x42, 0x8B, 0xC9, 0x33, 0x91,
-    0x2B, 0xAD, 0x63, 0x71, 0xE8, 0xDE, 0x67, 0x71, 0xE4, 0x62, 0x16, 0x17, 0x55, 0xBE, 0xA4, 0xDD,
-    0xF4, 0x25, 0x16, 0xA7, 0xED, 0x14, 0xC5, 0x70, 0x6C, 0xA2, 0x18, 0xE1, 0x6D, 0x28, 0x86, 0xA9,
-    0x5E, 0x8A, 0x9F, 0x11, 0xC1, 0x05, 0xC5, 0x42, 0x6B, 0x51, 0x7C, 0x4B, 0x9F, 0x5C, 0x5C, 0x85,
-    0x0B, 0x2D, 0x63, 0x1A, 0xC4, 0x69, 0xA7, 0x96, 0x30, 0x14, 0xAB, 0x9A, 0xD5, 0x21, 0xD0, 0x68,
-    0x84, 0xC8, 0x31, 0xB5, 0x15, 0x5E, 0xD2, 0x90, 0xEC, 0x3E, 0x51, 0xAC, 0x5F, 0x1D, 0x0C, 0x23,
-    0x6F, 0xAD, 0xFD, 0x04, 0x49, 0x73, 0x00, 0xD0, 0xEC, 0x67, 0xB9, 0x89, 0xBD, 0xDE, 0x7C, 0x20,
-    0x5A, 0x23, 0xD1, 0xB1, 0xBC, 0x6F, 0xAC, 0x39, 0x96, 0x35, 0xC5, 0x72, 0x49, 0xED, 0xCD, 0xF9,
-    0x64, 0x92, 0x4E, 0x23, 0xB8, 0x75, 0xB2, 0x6D, 0x65, 0x07, 0x18, 0x7E, 0x38, 0x3B, 0x09, 0x01,
-    0x6D, 0xA2, 0x72, 0x5A, 0x64, 0xE2, 0x9A, 0xEE, 0x72, 0xDD, 0xD1, 0xD8, 0x59, 0x8F, 0x74, 0x37,
-    0x86, 0xCE, 0x9E, 0x4A, 0xCB, 0xC0, 0xEB, 0x50, 0x27, 0x2D, 0x77, 0x69, 0x03, 0x78, 0x4C, 0x45,
-    0xE4, 0x45, 0x7A, 0x93, 0xD8, 0x18, 0x80, 0x4D, 0x72, 0x1A, 0x49, 0x09, 0x9D, 0x71, 0x9D, 0xEE,
-    0x1A, 0xDD, 0xC1, 0x9F, 0xDE, 0xA5, 0x84, 0x08, 0xB4, 0x29, 0x11, 0x07, 0x6D, 0xCA, 0x50, 0x5B,
-    0xFD, 0xF0, 0xA8, 0xDE, 0x54, 0x24, 0xD2, 0x03, 0xBB, 0x7C, 0xB5, 0xD9, 0x34, 0x46, 0xF4, 0x10,
-    0x56, 0x5A, 0x0E, 0x2D, 0xA5, 0x96, 0x75, 0x8A, 0x3E, 0xA9, 0xA5, 0x3B, 0xA3, 0x89, 0x0A, 0x3D,
-    0x73, 0xCC, 0xED, 0xBF, 0x3D, 0x0C, 0x7A, 0xBD, 0xBA, 0x7F, 0x2D, 0x0B, 0x14, 0x47, 0xAA, 0xEC,
-    0x5C, 0xF5, 0xB1, 0xC4, 0x22, 0xA5, 0x7F, 0xC7, 0x35, 0x1B, 0x19, 0xAF, 0x2C, 0x56, 0x98, 0xA9,
-    0x83, 0xA9, 0xD4, 0x6B, 0x0C, 0x75, 0x99, 0x88, 0xD0, 0xA1, 0x3A, 0x5C, 0x35, 0x1A, 0x1C, 0x49,
-    0xF4, 0x2B, 0x21, 0x35, 0xCA, 0x21, 0x44, 0x99, 0x1E, 0xBE, 0xE0, 0x5E, 0x3B, 0x65, 0x6E, 0xEB,
-    0x21, 0x33, 0xD6, 0xD2, 0x47, 0x8B, 0x1F, 0xBA, 0xF6, 0x5E, 0x87, 0xD7, 0x7F, 0xA4, 0x13, 0x47,
-    0xF3, 0x46, 0x06, 0x06, 0x39, 0x7B, 0xED, 0xB4, 0xE8, 0x25, 0x77, 0x63, 0xC7, 0xA8, 0xAD, 0xF0,
-    0x02, 0x88, 0xCF, 0x4C, 0xD1, 0x38, 0x66, 0x58, 0x49, 0xEE, 0xF6, 0x29, 0xC9, 0x28, 0xAE, 0x36,
-    0x21, 0x82, 0x40, 0xB3, 0x1A, 0x4D, 0xA0, 0x0E, 0x4D, 0xA0, 0x1C, 0x45, 0xEC, 0xF7, 0xDE, 0x95,
-    0xFF, 0xD1, 0xDD, 0x71, 0xD1, 0x47, 0x72, 0x4A, 0xFA, 0x54, 0x66, 0x8F, 0xA6, 0x44, 0xFA, 0x21,
-    0x63, 0x2B, 0x7D, 0x12, 0xC9, 0x91, 0x7B, 0xEF, 0xDF, 0xF7, 0xB0, 0x96, 0x21, 0x25, 0xD9, 0xF8,
-    0x28, 0x24, 0xD1, 0xC1, 0x53, 0x32, 0x0E, 0x9F, 0xFC, 0x07, 0x78, 0xCB, 0x61, 0x1F, 0x4C, 0x9D,
-    0x2A, 0xB0, 0x52, 0xD7, 0xEB, 0x80, 0xF8, 0x95, 0x91, 0xCC, 0x3B, 0x69, 0xFF, 0x15, 0x63, 0xB1,
-    0xF0, 0x2D, 0xF0, 0x99, 0x41, 0x05, 0x81, 0x75, 0x85, 0xA1, 0x5A, 0x69, 0x33, 0x79, 0x55, 0x54,
-    0x93, 0xE9, 0x6D, 0x39, 0xF9, 0x2E, 0x70, 0xA5, 0x22, 0x21, 0xD4, 0x22, 0x20, 0x28, 0x42, 0xB0,
-    0x37, 0xC8, 0xF5, 0x07, 0xC0, 0xE4, 0xD5, 0x39, 0xD2, 0xC7, 0x04, 0x7F, 0xE0, 0xD0, 0x34, 0xDF,
-    0x86, 0xBC, 0x13, 0x7E, 0x56, 0x06, 0x1F, 0x9B, 0x28, 0x3A, 0x39, 0xD3, 0xEA, 0xC0, 0x41, 0x71,
-    0x8F, 0xEC, 0x12, 0x26, 0x70, 0x46, 0x5F, 0xD8, 0xC1, 0xC0, 0x40, 0x0F, 0xFF, 0x1E, 0x9F, 0x9D,
-    0x66, 0x14, 0xCC, 0xF0, 0xDB, 0x2F, 0x16, 0x34, 0x1C, 0xFC, 0x1A, 0xBF, 0x74, 0x45, 0x6A, 0x32,
-    0xA7, 0x44, 0x23, 0x0C, 0x4C, 0x4C, 0x55, 0xCB, 0x9F, 0x76, 0xE9, 0xD4, 0x0D, 0xCC, 0x64, 0x7D,
-    0x72, 0xD7, 0x2D, 0xDE, 0x52, 0x6D, 0x2D, 0xF2, 0xC3, 0xAD, 0x0E, 0x4C, 0x66, 0x3E, 0x78, 0xE5,
-    0x91, 0xB7, 0x1F, 0x79, 0x32, 0x84, 0x6F, 0x1A, 0x52, 0xFF, 0xC4, 0x62, 0xBE, 0xED, 0xA0, 0x32,
-    0x9F, 0xA2, 0x3F, 0x88, 0x0C, 0x68, 0xCF, 0xC4, 0x20, 0x19, 0x0E, 0xB6, 0x90, 0x13, 0xE2, 0xC0,
-    0x35, 0x47, 0x1D, 0xAC, 0xF3, 0x07, 0x68, 0x86, 0xB2, 0x64, 0x40, 0x42, 0x94, 0xA3, 0xC3, 0x44,
-    0x66, 0xD3, 0x0B, 0x79, 0xE0, 0x34, 0xE6, 0xFD, 0xC8, 0x99, 0x04, 0x4E, 0xA0, 0xD9, 0x90, 0xC9,
-    0xFA, 0x69, 0xF7, 0xBF, 0x44, 0x88, 0x65, 0xCA, 0x3E, 0xB5, 0xDD, 0x68, 0x3E, 0xEA, 0x9B, 0x43,
-    0x2E, 0xDB, 0xFB, 0xE6, 0x51, 0x53, 0x05, 0xC2, 0xB4, 0x99, 0xD2, 0x7C, 0xA2, 0xFD, 0x2E, 0xC3,
-    0x57, 0x2D, 0xAB, 0x74, 0x4D, 0x9A, 0x40, 0x9A, 0xB6, 0x5A, 0x07, 0xDE, 0xAB, 0xDF, 0xF0, 0xAE,
-    0x4D, 0x73, 0x30, 0x5D, 0x24, 0x37, 0xFD, 0x82, 0x2E, 0x7C, 0xAA, 0xE2, 0x9B, 0x39, 0x26, 0x65,
-    0x9E, 0x39, 0x40, 0x0B, 0x8A, 0x86, 0xD1, 0x12, 0x50, 0x07, 0x39, 0x21, 0x15, 0xC1, 0xCF, 0x23,
-    0xAF, 0x1C, 0x58, 0x02, 0x49, 0x53, 0x4E, 0xCF, 0x6B, 0x5E, 0x06, 0x66, 0xB3, 0x87, 0x9B, 0x88,
-    0xAC, 0x70, 0x35, 0x98, 0x2E, 0xC0, 0xBB, 0x14, 0x5C, 0xA9, 0xD9, 0xCB, 0xA9, 0x5D, 0x33, 0x05,
-    0x13, 0xDE, 0x53, 0x33, 0x4A, 0x95, 0x09, 0xCD, 0x23, 0x76, 0xAB, 0x5D, 0x4B, 0x93, 0x34, 0xCC,
-    0xF1, 0xCC, 0x9F, 0x55, 0x47, 0x1A, 0x4C, 0x03, 0x4C, 0x26, 0x13, 0x67, 0x34, 0x6A, 0x99, 0x0F,
-    0xE0, 0xB8, 0x7C, 0xAE, 0x57, 0x7E, 0xA9, 0xF9, 0xF1, 0x68, 0x00, 0x52, 0x13, 0xF0, 0x68, 0x48,
-    0xD9, 0x9E, 0xDF, 0x76, 0x6A, 0xEC, 0x10, 0x75, 0xF7, 0x96, 0x39, 0x31, 0x2F, 0xB8, 0x67, 0x55,
-    0x24, 0x01, 0xEA, 0x83, 0x3C, 0xA5, 0x07, 0xA2, 0x65, 0x45, 0x6D, 0x8C, 0xEA, 0x2D, 0x2C, 0x6F,
-    0xF4, 0x1A, 0x92, 0x56, 0x20, 0xF2, 0x0F, 0x7C, 0x06, 0x55, 0x85, 0xE2, 0x85, 0x60, 0x58, 0x36,
-    0x62, 0x6C, 0x56, 0x11, 0xCD, 0x5C, 0x4B, 0xCF, 0x71, 0x61, 0x9F, 0x3D, 0x4C, 0xE6, 0xF5, 0xF2,
-    0x04, 0xC5, 0x23, 0x9F, 0x5A, 0x6D, 0xCD, 0xB0, 0x7C, 0x40, 0x38, 0x93, 0xD7, 0x67, 0x63, 0x60,
-    0xAF, 0xE6, 0xE3, 0xA1, 0xE1, 0x1C, 0x5D, 0x9F, 0xCC, 0x66, 0x35, 0x56, 0xC4, 0x16, 0x0C, 0x12,
-    0x99, 0xC6, 0x00, 0x01, 0x0E, 0xC5, 0x48, 0xBF, 0x97, 0xF5, 0x9B, 0x61, 0xC1, 0x39, 0xD3, 0xF9,
-    0x86, 0x69, 0xBC, 0xD1, 0x45, 0x13, 0x5B, 0x59, 0x53, 0x21, 0x8F, 0xEF, 0x99, 0x9E, 0x03, 0x11,
-    0x77, 0x65, 0xFE, 0x39, 0xCC, 0xF5, 0x61, 0x1E, 0x02, 0x36, 0x4F, 0xDE, 0x9D, 0x0A, 0xE9, 0xFA,
-    0x49, 0x40, 0x8C, 0xB5, 0x3E, 0x7D, 0xC4, 0x1A, 0x8E, 0x45, 0x12, 0xB2, 0xC6, 0xE9, 0x0F, 0xEA,
-    0x52, 0x8F, 0x7A, 0x60, 0xB9, 0x40, 0xBE, 0x32, 0x39, 0x52, 0x19, 0x0C, 0x93, 0x72, 0x21, 0x08,
-    0xEA, 0x46, 0x95, 0x6D, 0xC6, 0x45, 0x65, 0x6A, 0x22, 0x55, 0xFB, 0xF0, 0xED, 0xE0, 0x8B, 0xCC,
-    0x56, 0x40, 0xAD, 0xBD, 0x34, 0x03, 0x2C, 0x8C, 0x82, 0xB1, 0xA8, 0xF6, 0xBB, 0x8D, 0x66, 0xD1,
-    0x83, 0x7D, 0x61, 0xFB, 0x2D, 0xCB, 0x13, 0xBC, 0x24, 0x3E, 0x6C, 0x35, 0xB5, 0xA4, 0x73, 0xA5,
-    0x26, 0x0F, 0x85, 0xCB, 0x04, 0x38, 0x15, 0xA6, 0x22, 0xD6, 0xC4, 0x44, 0xA4, 0x5D, 0x40, 0x10,
-    0xC1, 0xF2, 0xD3, 0xFB, 0x8C, 0x76, 0x96, 0x3E, 0xA8, 0xB8, 0x6D, 0x89, 0xE5, 0xC8, 0xE3, 0x73,
-    0x1A, 0x27, 0x98, 0xAE, 0x5A, 0x58, 0x76, 0xCD, 0x3B, 0xE8, 0xE3, 0x0E, 0xD5, 0xFE, 0x9A, 0xF4,
-    0x8A, 0x71, 0x5C, 0x5A, 0xDE, 0x3B, 0xE6, 0x57, 0x61, 0x16, 0xE2, 0xC2, 0xF5, 0xCC, 0xB8, 0x0A,
-    0x92, 0x18, 0x3A, 0xD2, 0x41, 0xB5, 0x65, 0x1B, 0x6F, 0xB6, 0xE4, 0x92, 0x96, 0x15, 0xFE, 0x5E,
-    0x05, 0x49, 0x2D, 0x0C, 0x7C, 0x6B, 0x46, 0x5C, 0x50, 0xC3, 0x98, 0x80, 0x92, 0xF1, 0x0B, 0xF4,
-    0xD4, 0x94, 0x90, 0xF6, 0xD1, 0x9A, 0x4F, 0x31, 0xCC, 0x3D, 0x66, 0x82, 0x3E, 0x1A, 0xDF, 0xAF,
-    0x3A, 0x6F, 0xA7, 0x8F, 0x99, 0x64, 0xDB, 0x4E, 0xFF, 0x94, 0x31, 0x29, 0x4F, 0x13, 0x00, 0x3D,
-    0xA2, 0x15, 0x70, 0xEC, 0x3E, 0xFE, 0x03, 0x72, 0xB7, 0x8B, 0xC4, 0x3B, 0xC6, 0x90, 0x21, 0xDB,
-    0x1C, 0xF3, 0xBC, 0x1A, 0x84, 0x54, 0x95, 0xED, 0x15, 0xF7, 0x90, 0x1E, 0x7D, 0xFA, 0xF8, 0xC9,
-    0x62, 0x65, 0xC6, 0xD5, 0xA4, 0xA7, 0xEF, 0xA6, 0x12, 0x2A, 0x4B, 0xA7, 0x5C, 0x0B, 0x03, 0xED,
-    0x05, 0x40, 0x3B, 0x5C, 0x44, 0xF3, 0x62, 0xAA, 0x7E, 0xF5, 0x8E, 0x64, 0x6A, 0x65, 0xA6, 0x59,
-    0xF5, 0x68, 0x88, 0x80, 0x96, 0x19, 0xE2, 0x3D, 0x62, 0xD3, 0xAB, 0x6B, 0xC3, 0x55, 0x8C, 0xAC,
-    0xB9, 0x40, 0x1B, 0x67, 0xA4, 0xD2, 0x94, 0x7A, 0xFE, 0x50, 0xF5, 0x0B, 0xB7, 0x21, 0x69, 0x45,
-    0x97, 0xE0, 0x8F, 0xFA, 0xE7, 0x11, 0x73, 0xD3, 0xC5, 0xA4, 0x09, 0x89, 0x3E, 0xB9, 0x0F, 0xD8,
-    0x84, 0x44, 0xC5, 0xAF, 0xF2, 0xFA, 0xC7, 0xB9, 0x8C, 0xD2, 0x67, 0x2F, 0x13, 0xD5, 0x04, 0x31,
-    0xF1, 0x59, 0x42, 0x85, 0x0B, 0xF8, 0x67, 0x9E, 0x65, 0x36, 0x2E, 0xB6, 0x11, 0x5E, 0x9E, 0x83,
-    0xE4, 0xCB, 0x61, 0x17, 0xF8, 0xB3, 0xCF, 0x12, 0x5F, 0x5F, 0x38, 0x1E, 0x36, 0x3C, 0x5C, 0xF2,
-    0x61, 0x42, 0x94, 0x7E, 0x82, 0xE7, 0xCA, 0x2B, 0x2A, 0xB6, 0xDE, 0x1C, 0x1C, 0x19, 0x8D, 0x0C,
-    0xE3, 0x7B, 0x58, 0xDC, 0x12, 0xB2, 0xF6, 0x14, 0xC3, 0x8E, 0xE6, 0x8A, 0xFB, 0x8E, 0xC1, 0x4D,
-    0xB1, 0x6C, 0xCB, 0x4F, 0x99, 0x35, 0xE8, 0x24, 0x34, 0x30, 0x67, 0x09, 0xB0, 0x41, 0xB4, 0x8A,
-    0x5B, 0xB9, 0x2E, 0xAB, 0xA2, 0xD1, 0x55, 0x7D, 0x60, 0xA9, 0x6E, 0x55, 0xDA, 0xB7, 0x5C, 0xB7,
-    0x00, 0x6A, 0x55, 0x96, 0xEC, 0xD6, 0x10, 0xB7, 0x9A, 0xED, 0x96, 0x92, 0x7D, 0x36, 0x1A, 0x92,
-    0xF2, 0x25, 0xCE, 0x6C, 0xFE, 0xCC, 0xA9, 0xAD, 0x49, 0xF7, 0x6D, 0xC5, 0x88, 0x5A, 0x45, 0xFC,
-    0xB1, 0x25, 0x8C, 0xC7, 0xF6, 0x45, 0x77, 0xFD, 0x1C, 0xE9, 0x47, 0x75, 0x70, 0xBB, 0xBE, 0x06,
-    0x61, 0x53, 0xF3, 0x10, 0x64, 0x59, 0xA9, 0xF4, 0x9C, 0x24, 0x71, 0x9E, 0x70, 0x19, 0x88, 0x5C,
-    0x97, 0xD8, 0xA9, 0x48, 0x92, 0x4B, 0xCB, 0xB5, 0xC3, 0x0C, 0x40, 0xE8, 0x5A, 0xBA, 0xCF, 0x77,
-    0x99, 0x4C, 0xE9, 0x55, 0x76, 0xF6, 0xCB, 0x96, 0x68, 0xA5, 0xE2, 0xBD, 0xCC, 0x13, 0x46, 0xBA,
-    0x6A, 0xCF, 0x1C, 0x13, 0x40, 0xAF, 0xEF, 0x42, 0xD8, 0x06, 0xA1, 0xA2, 0x0D, 0x5B, 0xA4, 0xA8,
-    0x1D, 0x3D, 0x00, 0x2B, 0x05, 0x8E, 0x95, 0x6A, 0x4E, 0xE5, 0x34, 0x82, 0xA1, 0x14, 0x50, 0xEF,
-    0x86, 0x3B, 0x67, 0xCE, 0x7A, 0x18, 0x49, 0x7A, 0x32, 0x9D, 0xA8, 0xA7, 0x34, 0x42, 0x03, 0xB1,
-    0x39, 0x53, 0x02, 0xCD, 0x47, 0x47, 0xF1, 0x45, 0x4F, 0xA6, 0x7A, 0x49, 0xA4, 0x37, 0x68, 0x66,
-    0xEC, 0x7E, 0x64, 0x16, 0x47, 0x5A, 0x0F, 0x7B, 0xC6, 0x35, 0x6A, 0xA4, 0xAD, 0xAE, 0xC0, 0x92,
-    0x29, 0x7C, 0xA0, 0xD4, 0x14, 0x6F, 0xCC, 0xF4, 0xE6, 0x97, 0xC5, 0x00, 0x6A, 0x6B, 0xC6, 0x30,
-    0x76, 0x38, 0x58, 0x7A, 0x02, 0xAA, 0x88, 0xCC, 0x91, 0x2F, 0x0D, 0x16, 0xBB, 0xBA, 0x70, 0x47,
-    0xDC, 0xA8, 0x95, 0x74, 0xA5, 0xD2, 0xC1, 0xCB, 0x68, 0xF2, 0x09, 0x85, 0x2D, 0xE4, 0xEC, 0xA7,
-    0xD4, 0x64, 0x46, 0x5C, 0xA6, 0x36, 0xF7, 0x45, 0x4C, 0xAB, 0x8F, 0xBB, 0x28, 0xF3, 0xCE, 0xB9,
-    0x20, 0x83, 0x3A, 0xB4, 0xE3, 0x46, 0x13, 0xB2, 0x63, 0xBA, 0xA0, 0x08, 0xBB, 0x09, 0x5B, 0x4D,
-    0x53, 0x32, 0x6A, 0x69, 0xFD, 0xE8, 0xBB, 0x5B, 0xB3, 0x59, 0x51, 0x2B, 0x1E, 0xF1, 0x5E, 0x3B,
-    0xBB, 0xE4, 0xE1, 0x1E, 0x4D, 0xF2, 0x89, 0x39, 0x78, 0xE4, 0x6E, 0x53, 0x7E, 0x78, 0x88, 0x5D,
-    0x4F, 0x52, 0x10, 0x50, 0x0D, 0x2B, 0x2D, 0x23, 0x9D, 0xE5, 0x2C, 0xD5, 0x15, 0x28, 0x8E, 0x28,
-    0x00, 0xCC, 0x47, 0x1D, 0x62, 0xE5, 0x78, 0xED, 0x9F, 0x1C, 0x0A, 0xEE, 0xFB, 0x28, 0xBA, 0x3B,
-    0x0B, 0xD7, 0x2A, 0x47, 0x67, 0x81, 0xC9, 0x71, 0xD5, 0x9A, 0x78, 0x8E, 0xDD, 0x86, 0x41, 0xE0,
-    0x88, 0x82, 0x19, 0xAD, 0x6B, 0xF2, 0xD1, 0x8A, 0x5D, 0xB1, 0x55, 0x23, 0x9C, 0xAE, 0x15, 0xE1,
-    0x3A, 0x6B, 0x11, 0x5D, 0x45, 0xC2, 0xF0, 0xD4, 0xD9, 0xC8, 0x96, 0x26, 0xB3, 0x16, 0x4D, 0x7C,
-    0x21, 0x80, 0xA4, 0x8A, 0x6F, 0x65, 0x42, 0x98, 0xF5, 0xFA, 0x0D, 0x9D, 0x01, 0x48, 0xA5, 0xF0,
-    0xBD, 0xD9, 0xF3, 0x47, 0xDC, 0x79, 0xDF, 0xC7, 0x7E, 0x76, 0xA1, 0x12, 0xE1, 0xD9, 0x49, 0x6D,
-    0x89, 0x2B, 0x6C, 0x16, 0x48, 0xB7, 0x23, 0x58, 0xB7, 0xD1, 0x2E, 0x8B, 0x37, 0x0F, 0xE4, 0x09,
-    0x8C, 0x0C, 0xDD, 0xCD, 0x46, 0xB6, 0x16, 0xB7, 0xE6, 0x8F, 0x2C, 0xFB, 0xAD, 0x15, 0x1D, 0x75,
-    0x97, 0xAE, 0x3B, 0x70, 0x9F, 0x22, 0x5B, 0x91, 0x4C, 0x3D, 0x73, 0x3E, 0x05, 0xAA, 0xB9, 0x8D,
-    0x8F, 0x3C, 0xB5, 0xE1, 0x65, 0x19, 0x3F, 0xFA, 0x29, 0x48, 0x34, 0x3C, 0x45, 0x1B, 0x8B, 0x9D,
-    0x52, 0xB2, 0xAC, 0xAB, 0xF5, 0xF8, 0x53, 0x2D, 0x4F, 0x75, 0x4F, 0xED, 0x70, 0x85, 0x1F, 0x26,
-    0xA5, 0xA2, 0x78, 0x9B, 0x2A, 0x6A, 0x5A, 0x4F, 0x31, 0x41, 0x9D, 0xAD, 0x11, 0x60, 0xA7, 0xC2,
-    0xE1, 0x14, 0xDD, 0xC8, 0xAC, 0x04, 0x07, 0xCC, 0x81, 0x53, 0xE1, 0xE0, 0xF1, 0x1E, 0x60, 0x11,
-    0xE3, 0xE1, 0xD4, 0x60, 0xBD, 0xD4, 0x85, 0xBF, 0x82, 0xD1, 0x7E, 0x61, 0x1A, 0x4F, 0xE2, 0x7D,
-    0x96, 0x23, 0xAF, 0x7B, 0x98, 0x9C, 0xA4, 0x5E, 0xA5, 0xE5, 0x46, 0xCA, 0x5D, 0xA8, 0x6D, 0xA7,
-    0xD6, 0x4B, 0x4C, 0x8D, 0x87, 0xFC, 0x58, 0x7A, 0xA7, 0xF4, 0x1D, 0x3D, 0x52, 0xDA, 0x08, 0x1E,
-    0x83, 0xB5, 0x01, 0x2D, 0x57, 0x19, 0x15, 0xC5, 0xFB, 0x6F, 0x6A, 0xB1, 0xEB, 0xB4, 0xD8, 0x11,
-    0x56, 0x92, 0x58, 0x44, 0x3B, 0x60, 0x08, 0x2C, 0x7E, 0xC7, 0xB5, 0x7A, 0x77, 0x51, 0xEB, 0xDD,
-    0x08, 0x7F, 0x27, 0x52, 0xF9, 0x02, 0x1F, 0x4E, 0x78, 0x3A, 0x92, 0xF3, 0xB5, 0x5A, 0x6C, 0x06,
-    0x6B, 0xDF, 0x12, 0x83, 0xA1, 0x92, 0x1F, 0x9F, 0x29, 0x1E, 0x6B, 0xB4, 0x6F, 0x6B, 0xEB, 0x99,
-    0x5B, 0x3B, 0x31, 0x43, 0xA4, 0x19, 0x3F, 0xC3, 0xA2, 0xBF, 0xDB, 0xCE, 0x3B, 0x65, 0xF3, 0x8D,
-    0x36, 0xD3, 0x6A, 0x8E, 0xD5, 0x95, 0x99, 0xB8, 0x8F, 0xFF, 0x7A, 0x68, 0x5E, 0xB8, 0xC3, 0x77,
-    0xCE, 0x05, 0x74, 0xC2, 0xD6, 0x9A, 0x18, 0xA0, 0x66, 0xDC, 0x18, 0x33, 0xD3, 0x17, 0xFB, 0x58,
-    0xFB, 0x04, 0x5C, 0xF1, 0x02, 0x62, 0x13, 0xC6, 0x10, 0x64, 0x00, 0xEA, 0x47, 0xE0, 0x63, 0x09,
-    0x6B, 0x25, 0x70, 0xD0, 0xEF, 0x6A, 0xD1, 0x14, 0xA0, 0xF6, 0xB8, 0x8D, 0x91, 0x46, 0xAA, 0x58,
-    0xA5, 0x84, 0xBB, 0x66, 0x85, 0x14, 0x20, 0xBB, 0x18, 0x12, 0xD1, 0xC1, 0x24, 0xF0, 0x3A, 0xC5,
-    0xAD, 0xC1, 0x98, 0x38, 0xC4, 0x45, 0xE8, 0x10, 0x6F, 0xA1, 0x6A, 0x9B, 0xC4, 0x17, 0xFE, 0x89,
-    0xD4, 0xFE, 0xEF, 0x18, 0x16, 0x89, 0xBA, 0xC7, 0xEA, 0x80, 0xD3, 0x05, 0xDA, 0xAE, 0x03, 0x97,
-    0xD6, 0x04, 0x67, 0x33, 0x26, 0x0D, 0x64, 0x2C, 0x26, 0x54, 0xEB, 0x08, 0xC1, 0xCC, 0x4B, 0xD1,
-    0x50, 0x5F, 0x11, 0xCD, 0xE9, 0x19, 0xE1, 0xAC, 0x13, 0x40, 0xAF, 0xEB, 0xB8, 0x4A, 0x2A, 0x29,
-    0x5E, 0x82, 0xC3, 0xBB, 0x8B, 0x1D, 0x12, 0x69, 0x02, 0x53, 0xF4, 0x8A, 0xD9, 0x14, 0xD8, 0x87,
-    0xEE, 0x13, 0x1E, 0x77, 0x50, 0x39, 0xF0, 0x8E, 0x53, 0xEA, 0xF8, 0x1C, 0xDC, 0x0D, 0x72, 0xCD,
-    0x9E, 0xA2, 0x09, 0x88, 0xA9, 0x0C, 0x2D, 0x05, 0xC1, 0x75, 0x91, 0xF2, 0x64, 0x3A, 0x2F, 0x89,
-    0xAA, 0x4E, 0x7B, 0xEF, 0xEB, 0x9C, 0x68, 0x72, 0x8A, 0xA5, 0x37, 0x33, 0xA8, 0xE6, 0xEB, 0x86,
-    0xD1, 0xBD, 0x3E, 0x39, 0x5D, 0x67, 0xF2, 0x26, 0x97, 0x9F, 0x6A, 0x66, 0x54, 0x39, 0xFC, 0x23,
-    0x66, 0xE4, 0x5E, 0x1B, 0x25, 0xD9, 0x50, 0x95, 0x2D, 0x18, 0x14, 0x5F, 0x1B, 0x90, 0x0A, 0xC4,
-    0x1C, 0x4E, 0x1A, 0x8F, 0x96, 0x39, 0xA1, 0x79, 0xA8, 0x97, 0x16, 0x47, 0x1E, 0x9C, 0x98, 0x1F,
-    0x95, 0x32, 0x69, 0x2A, 0x9A, 0x01, 0x52, 0x26, 0xFD, 0x51, 0xD2, 0x7B, 0xBF, 0xE8, 0x10, 0x9D,
-    0xDE, 0x1C, 0x38, 0x28, 0xD7, 0x7E, 0xD1, 0x6F, 0x44, 0x6E, 0x79, 0xE6, 0xAE, 0xA0, 0x74, 0xA9,
-    0xC4, 0xB4, 0xF6, 0xFA, 0x59, 0xEF, 0xD5, 0x33, 0x67, 0xDA, 0x59, 0xEA, 0xEC, 0x21, 0x4F, 0xD8,
-    0x32, 0x60, 0x57, 0x0F, 0x65, 0x10, 0x4F, 0xBF, 0xE8, 0x0C, 0xE2, 0x4E, 0x63, 0x57, 0x2B, 0xCB,
-    0xF6, 0x06, 0x6B, 0xBA, 0x9E, 0x34, 0xC7, 0x54, 0xDC, 0x7A, 0x24, 0x7D, 0x78, 0x8F, 0x93, 0x20,
-    0x21, 0xB3, 0x74, 0xA8, 0x2C, 0x37, 0x27, 0xCE, 0xBB, 0xFD, 0x85, 0xDE, 0xF1, 0xC8, 0x1B, 0xCA,
-    0x41, 0x07, 0x36, 0xC6, 0x75, 0xEF, 0xBF, 0x61, 0xA0, 0x2D, 0x72, 0x3C, 0x42, 0x33, 0x68, 0x31,
-    0x6A, 0x80, 0x76, 0x57, 0x85, 0x33, 0xD3, 0x64, 0x44, 0x13, 0x50, 0x9A, 0xA5, 0x5A, 0x2C, 0x62,
-    0x0A, 0xA8, 0x29, 0x75, 0x18, 0xB5, 0x58, 0xA8, 0x15, 0x54, 0x13, 0x51, 0x19, 0x59, 0xE0, 0x20,
-    0xD4, 0x38, 0x2C, 0x5D, 0xA9, 0xA9, 0x59, 0xD3, 0xA0, 0x47, 0xD9, 0xCE, 0xE0, 0x15, 0x79, 0x96,
-    0x20, 0x11, 0xA2, 0x45, 0x2E, 0x10, 0x2B, 0xA9, 0x70, 0x3A, 0x04, 0xC1, 0xAC, 0x08, 0x76, 0xA0,
-    0x19, 0x85, 0xC9, 0x93, 0x00, 0x6F, 0xD1, 0x0C, 0xC5, 0xF4, 0xB5, 0x43, 0x26, 0x66, 0x7A, 0xFE,
-    0xB1, 0x63, 0x95, 0xEF, 0x68, 0x38, 0xEF, 0xCA, 0xC3, 0x41, 0xF3, 0x75, 0x4A, 0x25, 0x5D, 0x57,
-    0xCB, 0xE4, 0xE5, 0x87, 0x4B, 0x51, 0xFD, 0x78, 0x9A, 0x71, 0xB4, 0x28, 0xFA, 0x85, 0x2E, 0xE3,
-    0x71, 0xC4, 0xF6, 0xAB, 0xD7, 0x8C, 0xB4, 0xBE, 0x4C, 0x86, 0x60, 0x4F, 0x3B, 0xBC, 0x4F, 0x33,
-    0x6A, 0x06, 0x78, 0x6A, 0x1E, 0x5A, 0x33, 0x05, 0x53, 0x32, 0xEB, 0xF2, 0x08, 0x48, 0x95, 0x95,
-    0x1A, 0xCE, 0x4A, 0x9F, 0x04, 0x9E, 0xE9, 0xED, 0x82, 0x21, 0x0B, 0xFC, 0xC4, 0x15, 0xCD, 0x3A,
-    0xBF, 0x7B, 0x60, 0x7C, 0x5C, 0xF3, 0xC0, 0x7B, 0xCF, 0xAE, 0x8A, 0x48, 0xA3, 0x21, 0x4B, 0x83,
-    0x6A, 0x49, 0x1C, 0xA5, 0x9A, 0x0A, 0x1E, 0x90, 0x19, 0x35, 0xEC, 0x4F, 0x08, 0xCB, 0x5C, 0x8E,
-    0x89, 0x7F, 0x05, 0x04, 0x8E, 0x12, 0x8C, 0x88, 0xBE, 0xCC, 0x06, 0xCF, 0x25, 0xB4, 0x00, 0x80,
-    0x56, 0x8C, 0x6D, 0xBB, 0x89, 0x71, 0x7D, 0x98, 0x1D, 0xF3, 0x80, 0x65, 0x4C, 0x2E, 0x83, 0xD5,
-    0x86, 0x74, 0x71, 0xC8, 0x14, 0x36, 0xF9, 0x15, 0x57, 0x1A, 0x22, 0x16, 0x38, 0xEF, 0x2D, 0x9E,
-    0xD2, 0x67, 0xFD, 0xD2, 0x3C, 0x1C, 0x06, 0xE1, 0x64, 0xB0, 0xA1, 0x9D, 0xD7, 0x6B, 0xF4, 0x7A,
-    0xDE, 0x8B, 0xE7, 0x74, 0xA7, 0xF0, 0x4C, 0xD7, 0xF1, 0xF9, 0x1D, 0xDF, 0xD5, 0x51, 0x2F, 0xED,
-    0xD6, 0x61, 0x0F, 0x0F, 0xB2, 0xDD, 0x3A, 0x95, 0xEA, 0x3A, 0x60, 0x9A, 0xB4, 0xA1, 0x8F, 0xFC,
-    0x22, 0x8C, 0xA9, 0x5F, 0x86, 0xD1, 0x2F, 0xC4, 0xF8, 0xB2, 0x32, 0x0F, 0xEB, 0xE2, 0xC4, 0xA7,
-    0x68, 0xA0, 0x7E, 0xBE, 0x0A, 0x0C, 0xE6, 0xF7, 0xE5, 0x5C, 0xC2, 0x15, 0xB7, 0x5C, 0x30, 0xC4,
-    0xFD, 0x8E, 0x7C, 0x7C, 0xA5, 0x85, 0x9B, 0x95, 0x3E, 0x00, 0xED, 0x30, 0x6E, 0xD9, 0x03, 0x02,
-    0x06, 0x51, 0x73, 0xF2, 0x40, 0x97, 0x80, 0xE8, 0x87, 0x33, 0x0A, 0x29, 0x8D, 0x3A, 0x61, 0x11,
-    0x21, 0xE3, 0xFF, 0x3C, 0x21, 0x73, 0x1A, 0x8B, 0xFF, 0x71, 0x95, 0x1D, 0x66, 0x54, 0xE1, 0x63,
-    0x3F, 0x97, 0x3F, 0x55, 0x53, 0xB1, 0x98, 0xE1, 0x20, 0xDE, 0x5C, 0x9B, 0x61, 0xF8, 0x73, 0x33,
-    0x00, 0x28, 0x78, 0xA8, 0x3F, 0x99, 0xAF, 0x8C, 0xAB, 0x9E, 0xD2, 0xDE, 0xC8, 0x66, 0x56, 0x68,
-    0xB5, 0x26, 0x4C, 0x6F, 0x02, 0x05, 0xAE, 0x3D, 0x44, 0x61, 0xA5, 0x85, 0x7D, 0xA0, 0x16, 0x9F,
-    0xBD, 0x17, 0x7D, 0x50, 0x2E, 0xF8, 0xBA, 0x5F, 0x22, 0xD9, 0x59, 0xAE, 0x55, 0x35, 0x7B, 0x6C,
-    0x0D, 0x58, 0x57, 0xB3, 0xC1, 0x5B, 0xA2, 0x77, 0x93, 0x7E, 0x47, 0xC3, 0x22, 0x61, 0xDD, 0x86,
-    0xB8, 0x6B, 0x6B, 0x91, 0xF8, 0x42, 0x1F, 0xF8, 0xE3, 0x11, 0x30, 0x26, 0xF6, 0xA7, 0xF7, 0x2F,
-    0x9C, 0x51, 0xEF, 0xD6, 0x8C, 0xF7, 0x4A, 0x2A, 0x2D, 0x21, 0xBE, 0xDA, 0x48, 0x8E, 0x28, 0x50,
-    0x95, 0x4D, 0x57, 0x86, 0x9A, 0xB8, 0xF7, 0x76, 0x35, 0xD5, 0x87, 0x2D, 0x61, 0x4A, 0xE0, 0x27,
-    0x10, 0xC6, 0xDB, 0x8B, 0xEC, 0x28, 0x0B, 0xAA, 0xE6, 0xAD, 0x24, 0x89, 0x4D, 0x9D, 0xCA, 0x87,
-    0x46, 0xD8, 0x14, 0xF5, 0xD9, 0xAC, 0x0D, 0xEF, 0xE1, 0xBD, 0x0A, 0x82, 0x59, 0xF0, 0xE0, 0x2B,
-    0x38, 0x8E, 0xCE, 0xE1, 0x74, 0x34, 0xC7, 0xE9, 0xEF, 0xF0, 0xB4, 0xD0, 0xDC, 0x9D, 0x6E, 0xBC,
-    0x92, 0xD3, 0x6D, 0xF4, 0x03, 0x77, 0xCB, 0xF5, 0xB9, 0xD3, 0x95, 0xFE, 0xDC, 0x77, 0x9D, 0x4F,
-    0x11, 0x8D, 0x14, 0x7D, 0xEE, 0xCF, 0xB1, 0x8E, 0x8A, 0x2E, 0xD3, 0xB1, 0x02, 0xEB, 0x90, 0x87,
-    0x48, 0x5B, 0x7E, 0x87, 0xB6, 0xF3, 0x8D, 0xD3, 0x87, 0xB1, 0x77, 0x6C, 0x51, 0xF2, 0x9B, 0xA3,
-    0x37, 0xDF, 0xF7, 0x9B, 0x4A, 0x37, 0x09, 0x52, 0x13, 0xDB, 0xD2, 0x31, 0x9C, 0xB3, 0x53, 0x5A,
-    0x12, 0x76, 0x48, 0xA7, 0xBF, 0x7F, 0x70, 0xF3, 0xC7, 0x53, 0xE7, 0x47, 0xC5, 0xD4, 0x11, 0x51,
-    0x74, 0x37, 0xDC, 0xD0, 0x55, 0xF7, 0x3B, 0xFD, 0xCE, 0xAE, 0x3B, 0x17, 0xC1, 0xC9, 0xAC, 0xA1,
-    0x67, 0xCC, 0xCE, 0x86, 0xCF, 0xDF, 0x47, 0xCE, 0xA7, 0x6B, 0x32, 0xB4, 0x94, 0xA5, 0x73, 0x10,
-    0x7F, 0xCA, 0x18, 0x96, 0xCB, 0x34, 0x68, 0xAA, 0x32, 0xFB, 0xA0, 0xA7, 0x35, 0x37, 0x03, 0xDB,
-    0xE5, 0xB3, 0x36, 0x4F, 0xEE, 0xC1, 0x88, 0x2B, 0xCC, 0xFA, 0xB6, 0xB9, 0x3A, 0xDA, 0x5C, 0x2A,
-    0xD3, 0x09, 0xA3, 0x4B, 0x7B, 0x51, 0x23, 0xE2, 0x1E, 0xAB, 0xD8, 0x61, 0x61, 0x0E, 0xBF, 0xA9,
-    0x1F, 0x69, 0x73, 0x20, 0x7D, 0x98, 0x8E, 0xCC, 0xC9, 0x86, 0x59, 0xA1, 0xF3, 0xE6, 0x05, 0x8A,
-    0x2F, 0xFD, 0x79, 0x35, 0x87, 0xD6, 0xD4, 0x3F, 0x46, 0x3A, 0xA3, 0x73, 0x5D, 0xAA, 0xA5, 0x4F,
-    0x2A, 0x8A, 0x31, 0xEE, 0x72, 0x4B, 0x46, 0x9B, 0x7F, 0x2A, 0x4A, 0x9C, 0x10, 0xC7, 0x9D, 0x21,
-    0xB7, 0xE0, 0x8E, 0xED, 0xAF, 0x78, 0xD4, 0xB6, 0x85, 0x85, 0xF7, 0xC1, 0x0B, 0xEE, 0xBD, 0x19,
-    0x53, 0x2C, 0x79, 0x4F, 0x5B, 0xD2, 0x1D, 0xC2, 0x0A, 0x7A, 0xDF, 0x1D, 0xE5, 0x8F, 0x89, 0xAD,
-    0xB2, 0xB3, 0x03, 0x5E, 0xE8, 0x3E, 0x3E, 0xAD, 0xB1, 0x32, 0x6B, 0x0C, 0x8E, 0x73, 0x86, 0xA9,
-    0xEF, 0x15, 0xDD, 0x64, 0x8B, 0xBB, 0xFA, 0x8C, 0xFD, 0x4F, 0xEE, 0x1B, 0xB1, 0xD0, 0x69, 0xA6,
-    0x66, 0x5E, 0x7E, 0x8B, 0xE8, 0x7C, 0xEF, 0x74, 0xC4, 0xDB, 0xA6, 0x58, 0x63, 0xCD, 0x7D, 0x04,
-    0x29, 0x60, 0xDA, 0xA7, 0x77, 0xDC, 0xF5, 0x85, 0xA5, 0xBD, 0x74, 0x4A, 0x59, 0x2B, 0xFD, 0x18,
-    0xEF, 0xFB, 0x48, 0xDB, 0x0D, 0x5C, 0x7E, 0x6C, 0x2B, 0xAF, 0xC8, 0xAD, 0x73, 0x36, 0xA6, 0xC5,
-    0x2D, 0xCC, 0x7D, 0xEA, 0x0F, 0x33, 0x89, 0x12, 0xEA, 0xF0, 0xFF, 0x5A, 0xF3, 0x17, 0x6E, 0x58,
-    0xAE, 0xE3, 0x50, 0xF3, 0xFB, 0x25, 0x3E, 0x26, 0xEE, 0x10, 0x17, 0xF5, 0x6C, 0x35, 0xFE, 0x8C,
-    0x0B, 0x1E, 0xA8, 0xDF, 0xDE, 0xD1, 0x7E, 0x4B, 0xBE, 0xC8, 0x7E, 0x23, 0x81, 0x21, 0xF2, 0x8D,
-    0x91, 0xC0, 0xF7, 0xFF, 0x03, 0x4E, 0xD2, 0x82, 0x64, 0xEC, 0x2A, 0xD7, 0xC5, 0x6D, 0x81, 0xE3,
-    0x7D, 0xC4, 0x65, 0xD3, 0x73, 0x18, 0x14, 0x1A, 0xE7, 0x9F, 0x56, 0x1F, 0x58, 0xB1, 0xB8, 0x31,
-    0xC6, 0x20, 0x9C, 0x3C, 0xA9, 0x8D, 0x4B, 0x9E, 0xF6, 0x56, 0xA2, 0xC1, 0xD8, 0x35, 0xDC, 0x05,
-    0x5D, 0xFF, 0xC8, 0x9F, 0x50, 0x57, 0x38, 0x96, 0xAF, 0x24, 0x7B, 0x5B, 0x32, 0xCD, 0x0B, 0x63,
-    0x0E, 0xCC, 0xEA, 0xA5, 0x8B, 0x68, 0xEA, 0xBA, 0x9A, 0x54, 0x1D, 0xB0, 0x18, 0xE0, 0x98, 0x23,
-    0x92, 0x61, 0xC0, 0x16, 0xDD, 0xB6, 0xB4, 0x64, 0xC6, 0x11, 0x97, 0x92, 0x41, 0x21, 0x97, 0x2F,
-    0xC4, 0x58, 0x3D, 0xD3, 0x9B, 0xC3, 0xDB, 0x0B, 0x29, 0xE3, 0x61, 0x65, 0xF7, 0xD4, 0xC7, 0xE1,
-    0x0D, 0x23, 0x2A, 0x94, 0x56, 0xFB, 0x85, 0x2A, 0xEA, 0x5D, 0xD4, 0x45, 0x0A, 0x85, 0x9E, 0xEB,
-    0x62, 0x75, 0x5C, 0x61, 0x94, 0x09, 0x5B, 0x90, 0x3A, 0x6B, 0xA9, 0xCB, 0x21, 0x32, 0xE0, 0xB8,
-    0xB5, 0xA5, 0x49, 0xC7, 0x9A, 0xDB, 0x5C, 0xF1, 0xF2, 0x13, 0xAD, 0x3D, 0xD6, 0x06, 0xAD, 0xF5,
-    0x83, 0x96, 0x09, 0x97, 0xE4, 0x09, 0x10, 0x6C, 0x6D, 0x9F, 0x0D, 0x3A, 0xCF, 0xA4, 0x56, 0x10,
-    0x86, 0x34, 0xB7, 0x96, 0x66, 0xB6, 0xDA, 0x68, 0x47, 0x63, 0xD8, 0x18, 0x8D, 0xE7, 0x0E, 0x04,
-    0x96, 0x0C, 0x79, 0xAE, 0xBE, 0x46, 0x99, 0xFB, 0xB9, 0xBA, 0xE5, 0x4A, 0x2D, 0xAD, 0xF4, 0x00,
-    0x67, 0x5C, 0xAD, 0x85, 0x03, 0x4E, 0xB3, 0x54, 0x54, 0x96, 0x7E, 0x47, 0x93, 0xE6, 0x14, 0x55,
-    0x42, 0xF7, 0x5D, 0xCE, 0x90, 0x54, 0xCA, 0x7C, 0xCC, 0xB2, 0x5A, 0xDC, 0x71, 0x16, 0x07, 0x91,
-    0x59, 0xB8, 0x56, 0x31, 0xA0, 0x99, 0xE4, 0xC9, 0x7B, 0xA1, 0xDA, 0x86, 0x47, 0x9A, 0x34, 0x47,
-    0xB1, 0x38, 0x1A, 0x50, 0xAD, 0x12, 0x8A, 0xC2, 0x70, 0x8E, 0xDA, 0x06, 0x03, 0x1A, 0x47, 0x27,
-    0x6C, 0xAE, 0xE3, 0xA2, 0x36, 0x38, 0x8E, 0x26, 0x52, 0x53, 0x3C, 0x41, 0xA0, 0x44, 0x53, 0x69,
-    0x69, 0xC8, 0x7C, 0x63, 0xC8, 0x30, 0x0F, 0xA5, 0xE8, 0x02, 0xE4, 0x32, 0xE6, 0x65, 0x2B, 0x19,
-    0x62, 0x09, 0x0F, 0xDB, 0x12, 0xFE, 0xBC, 0xA5, 0xC5, 0x9D, 0xEC, 0x6B, 0x66, 0x76, 0x35, 0x39,
-    0xAA, 0xF4, 0xC6, 0xD4, 0x72, 0x8D, 0xAD, 0x8F, 0x8C, 0xD8, 0x23, 0x0C, 0xA7, 0x4E, 0x57, 0xE4,
-    0xE8, 0x2D, 0x3A, 0x8C, 0xE9, 0xEE, 0x98, 0xFB, 0x2E, 0x5C, 0xE3, 0xA7, 0x28, 0xDE, 0xC5, 0x1A,
-    0x3D, 0x19, 0x04, 0xFF, 0xA9, 0xD0, 0x98, 0x6D, 0x06, 0x05, 0x12, 0x40, 0xCB, 0x10, 0xC0, 0x21,
-    0x93, 0xA8, 0x0D, 0xFA, 0xA9, 0xF3, 0x96, 0x57, 0xA5, 0x37, 0xB6, 0xB2, 0xD7, 0xD8, 0x6C, 0xFF,
-    0x51, 0xA7, 0x6D, 0x91, 0x56, 0x86, 0x15, 0x53, 0x89, 0x7B, 0x62, 0xE4, 0xCC, 0x44, 0x6E, 0x5B,
-    0x98, 0xDE, 0x2F, 0x5A, 0x6F, 0x13, 0x97, 0x77, 0x45, 0xBD, 0xDE, 0x95, 0x36, 0x81, 0xF7, 0x37,
-    0x78, 0x87, 0x83, 0x05, 0x12, 0x2B, 0x52, 0xA6, 0xD1, 0xAA, 0x9B, 0x38, 0x3F, 0x66, 0x04, 0x1C,
-    0x3D, 0x84, 0x5B, 0x39, 0xD3, 0x7B, 0x09, 0x2F, 0x61, 0xAB, 0x77, 0x85, 0xE6, 0x46, 0xB9, 0x69,
-    0xAB, 0x2E, 0x5F, 0xD2, 0xA0, 0xD1, 0x5E, 0x13, 0xE3, 0x19, 0x15, 0x0A, 0x8E, 0xB4, 0x58, 0x7B,
-    0x08, 0xF4, 0xB0, 0xAA, 0xA1, 0x9A, 0x92, 0xD4, 0x1A, 0xBA, 0xC5, 0x85, 0x40, 0x2C, 0xF5, 0x94,
-    0xAE, 0x6F, 0x48, 0x82, 0x0C, 0xE3, 0x44, 0xCF, 0x85, 0x7B, 0x98, 0x2E, 0x31, 0x60, 0xF6, 0xC4,
-    0xC0, 0x32, 0x50, 0xC9, 0x07, 0xF2, 0x99, 0x98, 0x68, 0x04, 0xE8, 0xA2, 0x28, 0x66, 0xA2, 0x2A,
-    0xA1, 0x65, 0x21, 0xF5, 0xFC, 0x0C, 0x45, 0x80, 0x43, 0x73, 0x00, 0xA3, 0xE8, 0xBF, 0x72, 0x32,
-    0x8E, 0x15, 0xE3, 0x71, 0x43, 0xC1, 0x53, 0x39, 0xFD, 0x2D, 0xAD, 0x59, 0xDB, 0x38, 0xB3, 0x95,
-    0xB4, 0x2A, 0x55, 0x08, 0x92, 0xCD, 0x2C, 0x0B, 0x26, 0x7B, 0x1B, 0x8E, 0x58, 0x3F, 0x4A, 0x14,
-    0xC2, 0x7C, 0xBD, 0x72, 0xE4, 0xC3, 0xAE, 0xA5, 0x0E, 0x97, 0xD7, 0x3D, 0xD6, 0x52, 0xDF, 0xC1,
-    0x1A, 0xA1, 0xBF, 0xEE, 0xF2, 0xED, 0xD9, 0xC0, 0x8C, 0x0D, 0xAD, 0x3C, 0x57, 0x6C, 0xDB, 0x88,
-    0x91, 0xCE, 0xB6, 0x36, 0xAD, 0x4F, 0xC4, 0xAE, 0x91, 0x6B, 0x1E, 0xDB, 0x86, 0xB9, 0x44, 0x87,
-    0xD4, 0x67, 0x6C, 0xE0, 0xE9, 0x3A, 0x64, 0x09, 0xD5, 0x73, 0x0F, 0x70, 0xAF, 0xFA, 0xBB, 0x82,
-    0x68, 0xD8, 0x08, 0x5F, 0xFE, 0x06, 0xEA, 0x17, 0x7D, 0xA2, 0x39, 0x7E, 0x6A, 0x9D, 0xA4, 0xD4,
-    0x90, 0xB6, 0xBD, 0xF3, 0x27, 0xDF, 0x58, 0xC4, 0xFB, 0xD7, 0xF3, 0xFE, 0x7D, 0x81, 0x1E, 0x47,
-    0xEF, 0x02, 0x6D, 0x8B, 0x03, 0xFE, 0xD1, 0x1F, 0x6A, 0xE1, 0x72, 0x13, 0x7B, 0x6D, 0xC2, 0xD0,
-    0x10, 0x75, 0xB9, 0x99, 0x56, 0xDF, 0x8B, 0x63, 0x16, 0x5B, 0x2D, 0x4F, 0x51, 0x2F, 0xB1, 0x39,
-    0x0E, 0xB5, 0x05, 0x3F, 0xFB, 0x0F, 0xBA, 0x23, 0xC7, 0xEB, 0x0C, 0x1B, 0xEB, 0x3F, 0xAC, 0xE4,
-    0xBE, 0x0F, 0x60, 0x36, 0x4F, 0x69, 0x90, 0x0B, 0x9B, 0x7F, 0x70, 0x96, 0xC4, 0x86, 0xF7, 0xDB,
-    0xF8, 0x1C, 0x1F, 0xB4, 0xB3, 0x5C, 0x9B, 0x18, 0x4C, 0xBA, 0xDB, 0x3A, 0x15, 0xFC, 0x9A, 0xC3,
-    0x19, 0xE1, 0x5F, 0x50, 0x5A, 0xE5, 0x84, 0x28, 0xAD, 0xDF, 0x3B, 0x4A, 0x69, 0x1D, 0xA9, 0xD2,
-    0x7A, 0xFC, 0x1E, 0x91, 0x61, 0x9A, 0xA3, 0x30, 0x75, 0x9D, 0x97, 0x8F, 0x34, 0xFA, 0x2F, 0xDA,
-    0xB0, 0xBB, 0xBA, 0xD5, 0xE0, 0x33, 0xD0, 0x2E, 0xB9, 0xFB, 0x74, 0x47, 0x3B, 0xAC, 0xA8, 0xB8,
-    0xB6, 0xC6, 0xC9, 0x7D, 0x36, 0x85, 0x6D, 0x44, 0x89, 0xEB, 0xBE, 0xE7, 0xFA, 0xD4, 0x2F, 0xAB,
-    0x04, 0x78, 0xAD, 0xB0, 0x95, 0xB3, 0x6F, 0xF2, 0x1D, 0xC3, 0xC6, 0xF2, 0xD9, 0x1C, 0xDC, 0xB4,
-    0xC1, 0x67, 0x6D, 0xA4, 0x69, 0x6D, 0xB5, 0xE5, 0x52, 0x17, 0x19, 0x4D, 0x79, 0x50, 0xAA, 0x41,
-    0xB7, 0xD0, 0x60, 0x7F, 0x1C, 0x2C, 0xFD, 0xC1, 0x4A, 0x39, 0x53, 0x71, 0x03, 0xF9, 0x86, 0x70,
-    0x70, 0xB5, 0xD6, 0x84, 0x5F, 0xB6, 0xF6, 0xB2, 0x1C, 0x7C, 0x20, 0x53, 0xB0, 0xC1, 0xC1, 0xFB,
-    0x32, 0x21, 0x6B, 0x1C, 0x5C, 0x11, 0xB9, 0xBB, 0xE2, 0x01, 0x97, 0x60, 0x96, 0x83, 0x9F, 0xCA,
-    0x01, 0x62, 0x0E, 0x8B, 0xA5, 0x9B, 0xE7, 0xEF, 0xE8, 0x41, 0x59, 0xFC, 0x80, 0x07, 0x5C, 0x89,
-    0x19, 0x07, 0x72, 0x45, 0xA8, 0x07, 0x37, 0x7B, 0x3D, 0x48, 0x3E, 0xED, 0xF4, 0x80, 0x0B, 0x32,
-    0xE3, 0x20, 0x72, 0x8D, 0x1E, 0x4C, 0x69, 0x78, 0x68, 0x41, 0xF5, 0x91, 0x91, 0xAA, 0xB1, 0x75,
-    0x99, 0x45, 0x92, 0x80, 0x01, 0x17, 0x54, 0xBA, 0x40, 0xA8, 0xBF, 0x39, 0x47, 0xD8, 0x3F, 0x3E,
-    0x98, 0xA7, 0xF0, 0x5E, 0x5E, 0xAF, 0x4D, 0x0C, 0xD1, 0xD3, 0xC3, 0x6A, 0xC9, 0x43, 0x40, 0xF6,
-    0xB0, 0xC2, 0x6E, 0x04, 0xC3, 0x9E, 0x90, 0xBE, 0xD9, 0x29, 0xC6, 0x69, 0x84, 0xC4, 0xEB, 0xF4,
-    0x6A, 0x6D, 0x56, 0x73, 0xD5, 0x8A, 0xD9, 0xF3, 0x62, 0x86, 0x1E, 0xF7, 0xFC, 0x1D, 0xBB, 0xA2,
-    0x1C, 0x23, 0x17, 0x85, 0xBB, 0x2C, 0x95, 0xCD, 0xE5, 0x82, 0x4F, 0x45, 0x0A, 0x7E, 0x1D, 0x50,
-    0xDD, 0xBC, 0x4C, 0x2F, 0xE2, 0x82, 0xA8, 0x49, 0x7E, 0x89, 0x0B, 0xDE, 0x75, 0x51, 0x8D, 0x0B,
-    0xAA, 0xFC, 0x62, 0x1B, 0xE3, 0x82, 0x68, 0xBF, 0x67, 0xB0, 0xCE, 0x08, 0xE9, 0x9A, 0xB1, 0x68,
-    0x95, 0xF4, 0x10, 0x2F, 0x88, 0xDC, 0x8A, 0x17, 0x8C, 0x20, 0xC5, 0xC9, 0x5C, 0x0B, 0xE0, 0x2F,
-    0x15, 0x29, 0xA4, 0x64, 0xAA, 0xCE, 0x06, 0x2C, 0x8F, 0x00, 0x45, 0x63, 0xA9, 0x87, 0x3E, 0xD5,
-    0x37, 0x42, 0xEC, 0xD3, 0xF8, 0xB7, 0xC1, 0x81, 0xE0, 0x17, 0xAF, 0x31, 0xC0, 0x03, 0xFE, 0x45,
-    0xEB, 0x28, 0x4C, 0x69, 0xCC, 0x04, 0xC9, 0xD0, 0xA7, 0x6E, 0xE5, 0xD5, 0xE0, 0x67, 0x36, 0xBA,
-    0xF1, 0xE4, 0x3A, 0x2E, 0x70, 0x9D, 0x0E, 0xC2, 0xE0, 0xB0, 0xE5, 0x60, 0x07, 0x57, 0xBF, 0x84,
-    0x99, 0xC3, 0x43, 0xB7, 0x4B, 0x97, 0xE2, 0x2D, 0x5D, 0x1F, 0x36, 0xD2, 0x78, 0x07, 0x4D, 0x67,
-    0x4C, 0x26, 0x22, 0x5A, 0x02, 0xC1, 0x9C, 0x1A, 0xB2, 0x33, 0x27, 0x24, 0x17, 0xEB, 0x82, 0x18,
-    0xDE, 0x85, 0x2A, 0x82, 0x26, 0x74, 0x34, 0x92, 0x6F, 0xB9, 0xEB, 0x34, 0xFB, 0x80, 0x88, 0xC0,
-    0xFD, 0xE2, 0xBC, 0x2E, 0x57, 0xAB, 0xB9, 0x3B, 0xE0, 0xDA, 0xE9, 0x14, 0x85, 0x4B, 0x87, 0xA7,
-    0xAA, 0xDC, 0x57, 0x99, 0x55, 0x45, 0x3A, 0x7B, 0x9E, 0xD0, 0xD1, 0x5D, 0x4E, 0xFB, 0x69, 0xAF,
-    0xE8, 0xAC, 0x58, 0x57, 0x87, 0x5C, 0x6D, 0xB8, 0x88, 0xB7, 0x8B, 0x37, 0x99, 0xA2, 0x51, 0xB3,
-    0x6B, 0x60, 0xBD, 0xB8, 0xB0, 0x7F, 0x5E, 0x68, 0x54, 0x16, 0x1A, 0xDC, 0x99, 0xC3, 0x6F, 0x6B,
-    0xE1, 0xDA, 0x6D, 0xBF, 0x22, 0xE2, 0x25, 0x04, 0xDA, 0x62, 0x7D, 0x3A, 0x24, 0x92, 0x75, 0xB7,
-    0x6D, 0x61, 0xB6, 0xD8, 0x61, 0x7D, 0xBA, 0xD6, 0x16, 0xCB, 0xEE, 0x65, 0x74, 0xB8, 0x9F, 0xC9,
-    0x08, 0xEA, 0x26, 0xAD, 0x8F, 0x76, 0xD7, 0x41, 0x30, 0x4F, 0x81, 0x0C, 0xED, 0xA8, 0x95, 0xC2,
-    0xE5, 0x8E, 0x9C, 0x89, 0x94, 0x64, 0x9E, 0x08, 0x9E, 0xB8, 0x2B, 0xB0, 0x2E, 0x31, 0xCC, 0x9C,
-    0xCA, 0xD9, 0x96, 0xF2, 0x43, 0x1D, 0x39, 0x9C, 0x5B, 0xF1, 0xBE, 0x66, 0xD9, 0x3D, 0x43, 0x53,
-    0x65, 0xA5, 0xA0, 0xD3, 0x48, 0x13, 0x4A, 0x53, 0x58, 0xEF, 0x26, 0x1A, 0x17, 0x05, 0xFB, 0x2A,
-    0xD6, 0x8B, 0x82, 0xC8, 0x9B, 0xC5, 0xAD, 0xCF, 0x5E, 0xA3, 0x98, 0xF3, 0x70, 0x83, 0xAD, 0xCE,
-    0xCD, 0xE8, 0x9B, 0x1B, 0xB2, 0xE4, 0xFA, 0x02, 0x79, 0x15, 0x2A, 0xEF, 0x4C, 0x9B, 0x2A, 0xCC,
-    0x39, 0x6F, 0xD4, 0xF3, 0x7C, 0x51, 0x97, 0xF5, 0x65, 0x06, 0x34, 0x9B, 0xEC, 0xA3, 0x76, 0x24,
-    0x8D, 0xD1, 0x20, 0x63, 0x36, 0xA2, 0xA2, 0x5C, 0x26, 0x97, 0xBC, 0x29, 0xFF, 0xD6, 0x3F, 0x8F,
-    0xB1, 0xC9, 0x4D, 0x6E, 0xF0, 0x12, 0x83, 0x5F, 0xC5, 0xC6, 0x74, 0xDD, 0xCE, 0x10, 0x25, 0xD4,
-    0x01, 0xDE, 0x35, 0x9D, 0xB2, 0x51, 0x5E, 0xAF, 0x8A, 0x20, 0xCD, 0x0B, 0x7A, 0x22, 0xEA, 0xF4,
-    0xC4, 0x88, 0x10, 0x5A, 0x5A, 0xA5, 0x43, 0x5B, 0x72, 0x5B, 0x97, 0x5E, 0x0C, 0x34, 0x17, 0xB8,
-    0xE9, 0x71, 0x84, 0x7B, 0x95, 0x23, 0xF7, 0xF1, 0xEC, 0x94, 0x25, 0x61, 0x35, 0x25, 0xBA, 0x0C,
-    0x3C, 0x1E, 0xC9, 0xAA, 0x45, 0x6F, 0xDE, 0x75, 0x05, 0xB4, 0x14, 0x95, 0x72, 0xE2, 0x88, 0x6E,
-    0xB9, 0xC5, 0xE2, 0xCF, 0x55, 0x3D, 0x71, 0x9D, 0xFA, 0xBF, 0x98, 0x57, 0x54, 0x4F, 0xE8, 0x62,
-    0x48, 0xA8, 0xFA, 0xB6, 0x3B, 0x87, 0xA5, 0xAC, 0x00, 0x71, 0xC1, 0xD2, 0x35, 0x13, 0x5D, 0x0B,
-    0x6B, 0x69, 0xA9, 0xF0, 0x2A, 0xB4, 0xAD, 0x4C, 0xBC, 0x26, 0xE0, 0xDA, 0x9C, 0xB1, 0x85, 0x27,
-    0x70, 0x8C, 0xD0, 0x9C, 0x86, 0x86, 0x16, 0x09, 0x43, 0xC1, 0x11, 0x6A, 0xD7, 0xB5, 0x55, 0xDE,
-    0xAF, 0x53, 0xDC, 0x4A, 0x3B, 0xE5, 0xAE, 0x79, 0x63, 0xFB, 0x5A, 0x15, 0x3E, 0x00, 0xED, 0xFA,
-    0x40, 0xF1, 0xA0, 0x22, 0xB5, 0xFF, 0xD8, 0xE7, 0x22, 0x4F, 0x94, 0xDE, 0x34, 0xB0, 0xFB, 0x27,
-    0x44, 0x5E, 0xF4, 0xC8, 0x56, 0x73, 0x8E, 0xF1, 0x77, 0x96, 0xBD, 0x21, 0x5F, 0x4E, 0xBA, 0xB4,
-    0x9A, 0xB6, 0xC9, 0xDE, 0x0E, 0x22, 0x95, 0x6A, 0x72, 0xF8, 0x9D, 0x8D, 0xB4, 0xB4, 0xB6, 0x92,
-    0xF2, 0xC6, 0x6F, 0xAF, 0x0B, 0x30, 0x1F, 0xFA, 0x55, 0xA9, 0xB8, 0x3D, 0xF0, 0x7B, 0x6B, 0x76,
-    0xEA, 0xC8, 0x6B, 0xF1, 0xBB, 0x4F, 0x7F, 0xD4, 0xE6, 0x73, 0x5D, 0xA8, 0xCB, 0xA4, 0x95, 0x5C,
-    0x2B, 0xAD, 0x58, 0x69, 0x42, 0x18, 0x9A, 0xB5, 0x18, 0x81, 0x1F, 0x6C, 0xDD, 0xB5, 0x9E, 0x43,
-    0x70, 0x60, 0x3D, 0x87, 0x26, 0xF6, 0x19, 0x01, 0x3A, 0x35, 0x4F, 0xA2, 0x31, 0x29, 0x43, 0x6C,
-    0x6C, 0x0E, 0xAE, 0xE7, 0x10, 0xAB, 0x4B, 0x61, 0x8E, 0x40, 0x7D, 0x87, 0x28, 0x3B, 0x5B, 0x45,
-    0x84, 0xF1, 0x11, 0xE7, 0x36, 0x2D, 0x91, 0x9A, 0x59, 0x45, 0xA3, 0xF3, 0x42, 0x37, 0xC0, 0x5E,
-    0x80, 0x4F, 0xEF, 0x17, 0x88, 0x4A, 0x42, 0xD2, 0xC1, 0x6E, 0xB4, 0xB4, 0x10, 0x78, 0x43, 0xA6,
-    0x78, 0xC5, 0xDC, 0x40, 0x59, 0x49, 0xAB, 0x4B, 0x63, 0x5D, 0xDD, 0x5C, 0x5C, 0xE6, 0xD0, 0x1F,
-    0x72, 0x41, 0xDE, 0x69, 0x70, 0xDA, 0x45, 0x5D, 0xEB, 0x3E, 0x65, 0xA4, 0xFD, 0x4B, 0x94, 0x4B,
-    0xE0, 0x62, 0xC7, 0xE8, 0x29, 0xDC, 0x6B, 0x85, 0xC1, 0x18, 0x29, 0xF6, 0x13, 0x4D, 0xEB, 0xCC,
-    0x17, 0xCA, 0xEC, 0x29, 0x6A, 0xD5, 0x7D, 0xB1, 0xE7, 0x22, 0xBC, 0x9A, 0x08, 0x44, 0x23, 0xA0,
-    0x22, 0x58, 0x26, 0x7F, 0x63, 0x33, 0x96, 0x40, 0x21, 0xB4, 0xDD, 0x89, 0x85, 0xB4, 0x17, 0x66,
-    0xC8, 0xC6, 0x26, 0x05, 0xC2, 0x3C, 0xB5, 0xD4, 0x69, 0x69, 0x6B, 0x99, 0xAF, 0x3F, 0xB1, 0x65,
-    0x56, 0x74, 0xC1, 0xE7, 0x84, 0xCC, 0x6C, 0x83, 0xB4, 0x16, 0x19, 0xE0, 0xFD, 0xC2, 0xBD, 0x69,
-    0x89, 0x2A, 0x39, 0x8D, 0x1A, 0xFE, 0xF1, 0xCF, 0x83, 0x13, 0x87, 0x09, 0xEB, 0x93, 0x6C, 0xE8,
-    0x84, 0x13, 0x28, 0xDE, 0x4C, 0x6D, 0x23, 0xC3, 0x7E, 0xD7, 0xB5, 0x23, 0x7E, 0xC0, 0xF2, 0xF7,
-    0x06, 0x1F, 0xBB, 0x49, 0xF7, 0xD6, 0xA2, 0xDE, 0x50, 0xF9, 0x3F, 0x67, 0x1B, 0x36, 0xDD, 0x23,
-    0x9B, 0xF7, 0xD6, 0x6C, 0xF6, 0x82, 0x26, 0x9E, 0x4B, 0x5A, 0x65, 0xB2, 0x17, 0x08, 0xD0, 0x6D,
-    0x98, 0x0A, 0x95, 0x61, 0x00, 0x13, 0x00, 0x02, 0xF6, 0x4E, 0xFB, 0x04, 0xAA, 0x3E, 0x79, 0xB5,
-    0x02, 0x87, 0xB0, 0xBB, 0x66, 0x41, 0xC4, 0xF6, 0x23, 0xE4, 0x58, 0xCE, 0x3E, 0x0D, 0x16, 0xF9,
-    0x34, 0xD4, 0x65, 0x84, 0x06, 0xFF, 0x71, 0xF0, 0x27, 0x9B, 0x5F, 0xF7, 0xA5, 0xB4, 0x3F, 0xA9,
-    0x66, 0x33, 0xF6, 0x11, 0xBC, 0xA5, 0x89, 0x7A, 0x51, 0xEB, 0x53, 0xFD, 0x15, 0xA5, 0x45, 0xFB,
-    0x86, 0x6F, 0x84, 0x6F, 0x1C, 0x6D, 0xED, 0x04, 0x79, 0x42, 0xF6, 0x19, 0xB2, 0x9C, 0x08, 0x8E,
-    0xF9, 0xE5, 0x44, 0x53, 0x5F, 0x28, 0xEC, 0x4E, 0x0D, 0x87, 0x6A, 0x4B, 0x0C, 0x19, 0x34, 0x9A,
-    0x45, 0x9D, 0x41, 0x18, 0x03, 0x05, 0x7D, 0xD0, 0x08, 0xE9, 0x17, 0x6C, 0xE3, 0x2A, 0xD9, 0x8C,
-    0xBA, 0xE8, 0xD4, 0xE0, 0xE1, 0x3E, 0x96, 0x7F, 0x4B, 0xB3, 0x88, 0xFB, 0x84, 0x6A, 0xE6, 0x7F,
-    0x1E, 0x7B, 0xE3, 0xDE, 0x1A, 0xB8, 0x19, 0xBB, 0x9D, 0x7E, 0x47, 0x9D, 0xFF, 0x4B, 0xF9, 0xC7,
-    0x78, 0x99, 0x06, 0x4C, 0xB5, 0x34, 0xAB, 0x6A, 0x4A, 0x23, 0x0D, 0x33, 0x27, 0xD6, 0xB4, 0x56,
-    0x82, 0x67, 0x96, 0x66, 0x8E, 0x4D, 0x7B, 0x26, 0x4B, 0x51, 0x0B, 0x6D, 0xCE, 0xDA, 0x2B, 0xF0,
-    0x80, 0x1F, 0xC4, 0x10, 0x0A, 0xA6, 0xD4, 0x67, 0xFE, 0x26, 0x26, 0xDD, 0x29, 0x37, 0xA4, 0xAD,
-    0x76, 0x64, 0x9A, 0xD9, 0xDC, 0xBB, 0x18, 0xD5, 0xF2, 0x1E, 0xD5, 0x91, 0xB6, 0xF1, 0x41, 0xAE,
-    0xFA, 0xF5, 0xB4, 0x76, 0x06, 0x96, 0x30, 0x4A, 0xC5, 0xED, 0xCC, 0x56, 0xF9, 0x84, 0xE8, 0xFC,
-    0xC7, 0xF2, 0xEF, 0x90, 0x3B, 0xE6, 0xAB, 0x10, 0xD5, 0x64, 0x5E, 0xAB, 0x51, 0x17, 0x76, 0x24,
-    0x32, 0x48, 0x22, 0x4B, 0x32, 0xF3, 0x66, 0xF0, 0xD6, 0xBA, 0xB6, 0x5F, 0xE8, 0xEA, 0xAB, 0xCC,
-    0x7C, 0x9E, 0x7A, 0x9F, 0x51, 0x33, 0xFC, 0x49, 0x4B, 0xFF, 0xDC, 0x10, 0x8D, 0xAE, 0xD1, 0xB4,
-    0xFE, 0x9B, 0xA7, 0x7A, 0x1A, 0x64, 0x7B, 0xB3, 0xD0, 0xF2, 0x8E, 0xE3, 0xA7, 0xD5, 0x4D, 0x37,
-    0x64, 0x3E, 0x5B, 0xEB, 0xBA, 0x71, 0x7F, 0x0E, 0x86, 0xFC, 0xFE, 0xE4, 0xB6, 0x8A, 0x58, 0xF5,
-    0xB0, 0x08, 0x64, 0xB6, 0x6E, 0x8B, 0xE3, 0x3E, 0x5F, 0x72, 0x73, 0x70, 0xE3, 0xA3, 0xBB, 0xD8,
-    0xC5, 0x18, 0xDE, 0xEB, 0x55, 0xB1, 0xE2, 0xDE, 0xDB, 0x8C, 0xA9, 0x3C, 0xF8, 0x0A, 0xD9, 0x8A,
-    0xCD, 0x9A, 0x4E, 0x43, 0x13, 0xCE, 0xA4, 0x43, 0x54, 0x65, 0x3C, 0x64, 0x8B, 0xB5, 0x6E, 0xBA,
-    0x86, 0xA4, 0x51, 0x20, 0xD5, 0x95, 0x2D, 0x70, 0xA9, 0x2B, 0x9D, 0xB7, 0x22, 0x5C, 0xF6, 0x73,
-    0x9A, 0x2C, 0x4F, 0xFA, 0xD5, 0xE9, 0x37, 0xB7, 0x7A, 0x7E, 0x30, 0x51, 0xD1, 0xF4, 0x33, 0x72,
-    0x8A, 0x7E, 0x6E, 0xB9, 0xC2, 0x76, 0x4B, 0x9B, 0xBB, 0x26, 0xC0, 0xE7, 0x52, 0xED, 0xDC, 0x16,
-    0x37, 0xB0, 0x75, 0x57, 0x5B, 0x20, 0x82, 0xCF, 0xB4, 0xB0, 0xBF, 0xC7, 0xB2, 0x9D, 0x76, 0xD8,
-    0x46, 0x2D, 0xB6, 0x49, 0x0D, 0x14, 0x75, 0xCA, 0x05, 0xDE, 0x91, 0x02, 0x5C, 0x34, 0x1F, 0xAC,
-    0xE7, 0x7E, 0x13, 0xA1, 0x87, 0xC5, 0xA7, 0x40, 0x7C, 0x15, 0x77, 0x5A, 0x2E, 0x1C, 0xDF, 0x70,
-    0x5B, 0x71, 0xBB, 0xE2, 0xB6, 0xE4, 0x76, 0xCE, 0x2D, 0xD1, 0xD8, 0x3D, 0x3F, 0x14, 0x5E, 0xC0,
-    0x91, 0xA5, 0x01, 0xB5, 0x4D, 0x60, 0x6B, 0xDF, 0x3C, 0xCE, 0x45, 0x45, 0x8C, 0x34, 0xAF, 0x10,
-    0xC6, 0x27, 0xDF, 0x07, 0x3F, 0x41, 0x95, 0x32, 0xB3, 0x3B, 0x8E, 0xB7, 0xE7, 0xDB, 0x07, 0x35,
-    0xC5, 0xAF, 0x41, 0xC3, 0x6A, 0xC6, 0xB0, 0xB0, 0x67, 0x16, 0x7C, 0xDD, 0x20, 0x21, 0x77, 0x20,
-    0x53, 0x78, 0x93, 0xE8, 0x3C, 0xEE, 0x26, 0x3E, 0xA8, 0x1C, 0xBA, 0x25, 0x38, 0xA8, 0x28, 0x87,
-    0xED, 0xD1, 0xCA, 0xA1, 0x7A, 0xA8, 0x2D, 0x97, 0xA1, 0x66, 0x73, 0xA6, 0x6C, 0x98, 0x4D, 0xD5,
-    0x35, 0x4D, 0x0B, 0x69, 0x05, 0xF1, 0x25, 0x56, 0xA5, 0xAD, 0x60, 0x86, 0xBF, 0x89, 0xF9, 0x05,
-    0x88, 0xA5, 0x1B, 0x31, 0xD4, 0xCF, 0x60, 0x91, 0x23, 0xCD, 0x13, 0x17, 0xF7, 0x1B, 0x7F, 0x24,
-    0x9D, 0x5E, 0xF6, 0x81, 0xDE, 0x93, 0xB7, 0x2A, 0xC2, 0xF0, 0x69, 0xFA, 0xE8, 0x8C, 0x2B, 0x04,
-    0x23, 0x0B, 0xDC, 0x8B, 0x3E, 0xB7, 0xFC, 0x3C, 0xF0, 0x29, 0xDF, 0xC9, 0x3E, 0xBC, 0x08, 0x73,
-    0x7C, 0xF8, 0x02, 0x8E, 0xA5, 0x08, 0x29, 0x47, 0xD0, 0xF6, 0x99, 0x4A, 0x06, 0x87, 0x07, 0x12,
-    0x52, 0x4D, 0x6A, 0xC0, 0x4B, 0xB4, 0x91, 0x5E, 0xF7, 0x17, 0x43, 0x7A, 0xDD, 0xA5, 0xA5, 0xD7,
-    0xED, 0x98, 0x3C, 0x12, 0x91, 0xCE, 0xBA, 0x4C, 0x7B, 0x43, 0xDF, 0x89, 0x5F, 0xA6, 0x3D, 0x14,
-    0x95, 0x10, 0x96, 0x10, 0xA8, 0x2F, 0x2D, 0xD3, 0x41, 0x86, 0xF7, 0x58, 0xA6, 0x3D, 0xFB, 0xFF,
-    0xF9, 0x88, 0x1F, 0x3A, 0x1F, 0xF1, 0xC6, 0xC0, 0xE5, 0x8A, 0x14, 0x1B, 0x03, 0x77, 0x3A, 0x0C,
-    0xDC, 0xE0, 0xC1, 0x07, 0xEE, 0xDE, 0xF3, 0x18, 0xB8, 0xE8, 0xBA, 0x8A, 0x31, 0x71, 0x1A, 0x9C,
-    0xAD, 0xB9, 0x5B, 0xC7, 0xD6, 0xAE, 0xD6, 0xC8, 0x07, 0xC4, 0xED, 0x1B, 0x07, 0x1B, 0x59, 0x5A,
-    0x77, 0x57, 0xD3, 0x20, 0x6A, 0x23, 0xC7, 0x04, 0xFF, 0x5A, 0xF6, 0xBE, 0x94, 0x49, 0xFD, 0xA6,
-    0x5C, 0xA3, 0x6B, 0x84, 0x81, 0x2B, 0x2F, 0x7D, 0xD8, 0x81, 0xDB, 0xDE, 0x7F, 0xE0, 0x7E, 0x49,
-    0xFD, 0x90, 0x94, 0x89, 0x88, 0xC4, 0x3D, 0xEC, 0x89, 0x79, 0x85, 0xA5, 0x0A, 0x7A, 0x2C, 0x8C,
-    0x75, 0x2C, 0x3B, 0x96, 0xDD, 0xD5, 0xFC, 0x23, 0x7E, 0xE7, 0x90, 0x0A, 0xC5, 0x65, 0x31, 0x69,
-    0x06, 0x12, 0xB1, 0xAD, 0x06, 0xD3, 0x6B, 0xDE, 0x0C, 0x2A, 0x4F, 0xA2, 0x71, 0xEF, 0x4B, 0x55,
-    0xFA, 0x2C, 0xDF, 0xDC, 0x70, 0x78, 0x4C, 0xD4, 0xEA, 0x6E, 0x48, 0x1F, 0x97, 0xB4, 0xC3, 0x6D,
-    0xB9, 0x82, 0xF9, 0x9F, 0x06, 0xD9, 0xA9, 0x52, 0x91, 0xAA, 0x0E, 0xE7, 0x60, 0xE1, 0x32, 0x69,
-    0xD7, 0x36, 0xF5, 0x1B, 0xC8, 0x82, 0xC2, 0x59, 0x6A, 0xE4, 0x33, 0xC8, 0x92, 0x2A, 0xAE, 0x0E,
-    0x4A, 0x82, 0x8F, 0x61, 0xD5, 0x4D, 0x93, 0x12, 0x34, 0x90, 0xD8, 0xFC, 0xD8, 0x0A, 0x35, 0xD8,
-    0x10, 0x1F, 0x68, 0xA5, 0x2E, 0x28, 0x2E, 0xEB, 0x80, 0x52, 0x99, 0x9A, 0xF2, 0x36, 0x1C, 0x44,
-    0x3E, 0xB0, 0xAF, 0xB4, 0xA5, 0xDD, 0x72, 0x62, 0x34, 0x12, 0x7A, 0xA5, 0x23, 0x22, 0x67, 0x27,
-    0x14, 0x9C, 0xE9, 0x4B, 0x62, 0x4E, 0x40, 0x8C, 0x6C, 0xDA, 0xBF, 0x28, 0xE6, 0x6B, 0x22, 0x58,
-    0x45, 0x7C, 0x8F, 0x54, 0x3F, 0x49, 0x0D, 0x89, 0xA1, 0x10, 0x8D, 0x55, 0x60, 0x4A, 0xFF, 0xF6,
-    0x79, 0x1B, 0xAB, 0xBA, 0x50, 0x86, 0xDA, 0x95, 0xD4, 0xDC, 0x54, 0x6F, 0x8C, 0x5E, 0xAD, 0x7B,
-    0xE1, 0x88, 0x0C, 0x31, 0xC2, 0xD6, 0x6E, 0x7E, 0x52, 0x48, 0x13, 0xFB, 0x94, 0xB8, 0x75, 0x5A,
-    0x63, 0x57, 0x9A, 0x32, 0x52, 0xDD, 0x66, 0x8C, 0x36, 0x65, 0x20, 0x54, 0xA0, 0xD9, 0x14, 0x10,
-    0xBE, 0xB3, 0xD4, 0x2C, 0xC8, 0xC8, 0x87, 0x84, 0xA0, 0xE3, 0x15, 0x7D, 0x17, 0x17, 0x19, 0x3C,
-    0xB2, 0xC3, 0x18, 0xD2, 0x35, 0x86, 0x5A, 0xD5, 0x45, 0xB5, 0x1D, 0x93, 0xBA, 0x12, 0x30, 0xE0,
-    0x11, 0x80, 0xFD, 0x3A, 0xE3, 0x98, 0x26, 0xB1, 0x40, 0x3E, 0xE9, 0x5D, 0xC3, 0xEA, 0x0F, 0x6B,
-    0xE3, 0xB0, 0x27, 0x46, 0x9B, 0xE9, 0x73, 0x55, 0x49, 0x0A, 0x45, 0x81, 0x99, 0x7B, 0x05, 0xC9,
-    0xD4, 0xA3, 0xBB, 0x94, 0xA3, 0xBC, 0xF6, 0x91, 0xFA, 0x4A, 0x5F, 0xB9, 0x72, 0x75, 0xA0, 0x79,
-    0x8C, 0x98, 0xEC, 0x69, 0x65, 0x31, 0xF8, 0x91, 0xAD, 0x9E, 0xA7, 0x69, 0x00, 0xE6, 0x10, 0x40,
-    0x15, 0xD8, 0xAC, 0x4E, 0x4D, 0x48, 0x3E, 0xCC, 0x43, 0x0C, 0x42, 0x4F, 0xFF, 0xFF, 0x6D, 0xB7,
-    0x36, 0x9B, 0xAB, 0xDF, 0x30, 0x31, 0x18, 0x63, 0xBD, 0xCE, 0x9D, 0x98, 0xF6, 0x03, 0x62, 0xEB,
-    0x6C, 0x61, 0x29, 0x02, 0xE6, 0xC6, 0xDF, 0xD0, 0x21, 0x84, 0x2A, 0xB8, 0x35, 0x31, 0xF7, 0xB5,
-    0x9E, 0xE7, 0x73, 0x15, 0x50, 0x4C, 0x91, 0x56, 0xA1, 0xEB, 0x30, 0x55, 0xFD, 0x9A, 0xAD, 0x4B,
-    0x3E, 0x5A, 0x1C, 0x7B, 0x3B, 0xE0, 0xB2, 0x68, 0x1A, 0xA5, 0x8C, 0x6B, 0x75, 0xFB, 0x54, 0x3F,
-    0xA4, 0x2A, 0xDF, 0x5A, 0xA3, 0x78, 0xBE, 0x76, 0x7D, 0xB7, 0xF8, 0x0B, 0x64, 0x92, 0x41, 0x73,
-    0x4E, 0xE8, 0x07, 0x91, 0x5A, 0x63, 0xBD, 0xDA, 0xBC, 0x0C, 0x26, 0x35, 0xC4, 0xE8, 0x83, 0x69,
-    0xD8, 0x7D, 0xB0, 0x48, 0x63, 0xF1, 0xEC, 0x79, 0xAD, 0x3E, 0x6A, 0xCE, 0x39, 0x06, 0x1D, 0x6A,
-    0xBF, 0x61, 0x29, 0xB8, 0xDA, 0xA6, 0x9C, 0x83, 0xEB, 0x40, 0xBB, 0x2D, 0xFD, 0x25, 0xBF, 0x11,
-    0x53, 0x30, 0xBE, 0x3D, 0xB4, 0xBB, 0x4A, 0x35, 0xE9, 0x3A, 0x58, 0x44, 0x3B, 0x6D, 0x1D, 0x73,
-    0xA3, 0x9E, 0x37, 0x0B, 0x72, 0xCB, 0x2C, 0x21, 0xB8, 0xAD, 0x0B, 0xA7, 0x1F, 0xB9, 0x1C, 0x96,
-    0x5D, 0xDF, 0x98, 0x6C, 0x58, 0xE2, 0x48, 0x66, 0x36, 0xA7, 0xFD, 0x32, 0x5D, 0x05, 0xE1, 0xA1,
-    0x99, 0x46, 0xF1, 0xFF, 0x7D, 0x46, 0xB2, 0xA3, 0xDB, 0x98, 0x5C, 0xFE, 0x41, 0x0E, 0x1B, 0xCA,
-    0x6F, 0xC0, 0xB5, 0xA4, 0xE8, 0xC1, 0x0F, 0x35, 0xE8, 0x81, 0xFC, 0x58, 0x17, 0x9C, 0xD0, 0x35,
-    0x80, 0xCE, 0xFE, 0xE8, 0x61, 0x03, 0x86, 0x7C, 0x2E, 0x0C, 0x69, 0xFA, 0x49, 0x0D, 0xD5, 0xA5,
-    0xA2, 0xE2, 0x0E, 0x7B, 0x43, 0x30, 0x7A, 0x63, 0xB4, 0x61, 0x89, 0x7A, 0x1C, 0xAB, 0xA3, 0xE7,
-    0x76, 0x0F, 0xD1, 0x24, 0x1F, 0xAC, 0x0F, 0xEC, 0xD2, 0xE9, 0xE7, 0x71, 0xA0, 0xD8, 0x88, 0x15,
-    0x13, 0x1A, 0x0F, 0x07, 0x9F, 0x9D, 0x07, 0xB5, 0xA3, 0x3A, 0x7F, 0x4A, 0x93, 0x8C, 0xDA, 0x6F,
-    0xBF, 0x78, 0xEB, 0xA1, 0x13, 0x67, 0xD1, 0x48, 0xB3, 0xFE, 0x25, 0xDC, 0xE0, 0x5E, 0xBF, 0x9B,
-    0xC4, 0x4E, 0xC4, 0x17, 0xDA, 0xDC, 0xD4, 0x68, 0xAB, 0x43, 0x2C, 0x50, 0x07, 0xD2, 0xDD, 0x52,
-    0xCC, 0xC0, 0x30, 0x26, 0xCE, 0x64, 0x93, 0x4B, 0x6E, 0x23, 0x0F, 0x36, 0x23, 0x9A, 0xD1, 0x1E,
-    0xF7, 0x2F, 0xEC, 0xDF, 0xCE, 0x58, 0x88, 0xF9, 0x5C, 0xDC, 0xD4, 0xF4, 0x77, 0x6D, 0xA1, 0x2B,
-    0xDB, 0x24, 0x9A, 0xEC, 0x4B, 0xEE, 0xDC, 0x71, 0x73, 0xDC, 0x89, 0xA4, 0xE8, 0xD4, 0x5C, 0x5B,
-    0x3E, 0x16, 0x11, 0xA9, 0x97, 0x30, 0x2A, 0x96, 0x7C, 0x6C, 0x71, 0xA0, 0x10, 0xEA, 0xC1, 0x25,
-    0xB7, 0x80, 0x55, 0x82, 0x79, 0xE2, 0x4A, 0x7D, 0x6C, 0xA9, 0x8F, 0x9D, 0xF3, 0x9D, 0x7B, 0x1B,
-    0xB9, 0x8C, 0x82, 0xA8, 0x62, 0x04, 0x66, 0xB1, 0xCC, 0x19, 0x49, 0xF3, 0x34, 0x33, 0x37, 0xA8,
-    0x63, 0x70, 0xFB, 0xDC, 0xF6, 0xB9, 0x43, 0x5F, 0xFE, 0xD5, 0x5A, 0x68, 0xFD, 0x4B, 0x49, 0x93,
-    0xD6, 0x2F, 0xE6, 0x3A, 0xB8, 0x47, 0x96, 0x68, 0xBC, 0x1F, 0x16, 0x0F, 0x23, 0x22, 0x38, 0x39,
-    0x18, 0x5C, 0xFA, 0x57, 0x9A, 0x41, 0x9A, 0x12, 0x45, 0xE3, 0xB9, 0xD9, 0xDA, 0x1F, 0xFE, 0xF9,
-    0xE5, 0x56, 0x23, 0x52, 0xAE, 0xD5, 0xE8, 0xC2, 0xE1, 0x20, 0x30, 0xA7, 0xC4, 0xFA, 0x60, 0x9B,
-    0x69, 0x5A, 0xE8, 0x8E, 0xAE, 0x94, 0xCF, 0x20, 0x11, 0x92, 0x9A, 0xFE, 0x14, 0x2F, 0xDB, 0x04,
-    0x94, 0x8E, 0x99, 0x84, 0x45, 0x63, 0xD4, 0x46, 0x9A, 0x64, 0x4B, 0x2D, 0xAE, 0xA5, 0x37, 0xC0,
-    0x72, 0xB9, 0x8D, 0xD4, 0xCC, 0xB3, 0xCB, 0x01, 0x93, 0xED, 0x33, 0x6C, 0xE5, 0x96, 0x0F, 0x48,
-    0x9D, 0x98, 0xEA, 0xC2, 0xCF, 0x4D, 0xF6, 0xF2, 0x51, 0xE6, 0x54, 0xC7, 0x3E, 0x52, 0x94, 0x0D,
-    0x05, 0xB0, 0xA2, 0x99, 0x32, 0x79, 0x0D, 0xDF, 0x95, 0x72, 0x4D, 0xAB, 0x97, 0xA8, 0x2F, 0xF4,
-    0xB1, 0x66, 0xAB, 0x56, 0x3C, 0xDA, 0x27, 0x8A, 0x5A, 0x99, 0x6F, 0x60, 0xA3, 0x0C, 0x4F, 0xE8,
-    0xC1, 0xF3, 0x28, 0xFA, 0xCD, 0xC2, 0xE0, 0xC5, 0x95, 0x82, 0x2B, 0xE7, 0x81, 0xF7, 0xAD, 0x69,
-    0x7A, 0x64, 0x2F, 0xC1, 0x88, 0x00, 0x0A, 0x2F, 0x74, 0x4F, 0x6B, 0x31, 0x16, 0x9A, 0x64, 0x3A,
-    0xB4, 0x65, 0xD1, 0xD0, 0xE4, 0x00, 0x94, 0x40, 0xD1, 0xDA, 0x4A, 0x52, 0x83, 0x50, 0x39, 0x2C,
-    0x30, 0x32, 0xF2, 0x40, 0xF4, 0xC0, 0x40, 0xA7, 0x7A, 0x35, 0x43, 0x30, 0xF5, 0x21, 0x31, 0xE2,
-    0xCD, 0x2B, 0x22, 0x56, 0x2E, 0x33, 0x90, 0x93, 0x51, 0x79, 0xED, 0x1A, 0x42, 0x58, 0x94, 0x03,
-    0x50, 0x8A, 0xBD, 0xF4, 0xBB, 0xBA, 0x0E, 0x8C, 0xC6, 0x87, 0xB6, 0x43, 0xDE, 0xB9, 0xED, 0x37,
-    0xAD, 0x9B, 0xD4, 0xD0, 0x3F, 0xD7, 0x5E, 0x8A, 0x59, 0x57, 0xEB, 0x24, 0x04, 0xDA, 0x57, 0xBE,
-    0x8F, 0x8A, 0x9A, 0x79, 0x64, 0xD8, 0x45, 0xA1, 0x33, 0xAE, 0xEC, 0x33, 0x36, 0x54, 0xE4, 0x70,
-    0xAA, 0x15, 0x39, 0x75, 0x57, 0x97, 0x27, 0x76, 0x9D, 0xBB, 0xFE, 0x86, 0x75, 0x8F, 0xA2, 0x32,
-    0xAC, 0x77, 0x74, 0x01, 0x00, 0xED, 0x9C, 0x9C, 0xB0, 0x69, 0xF6, 0x4D, 0xC0, 0x8C, 0x37, 0x2B,
-    0x76, 0x4D, 0xA7, 0xA8, 0xEB, 0x4B, 0xEC, 0x99, 0x86, 0xAD, 0xFA, 0x0C, 0xB3, 0x3F, 0x61, 0xC9,
-    0x12, 0xAC, 0xE5, 0xC5, 0xA0, 0x53, 0xB4, 0x87, 0x65, 0xF5, 0xBF, 0xA3, 0x91, 0xD6, 0x4D, 0xB0,
-    0xB5, 0xE3, 0xDC, 0x2C, 0x58, 0x57, 0x6A, 0x7D, 0xC8, 0x75, 0xD5, 0x6A, 0xBB, 0x96, 0xB7, 0xE1,
-    0x09, 0xB5, 0x46, 0xB0, 0xF2, 0xB9, 0x10, 0xFA, 0x68, 0xD5, 0x97, 0x13, 0xFF, 0x17, 0xC5, 0x59,
-    0x3D, 0xAC, 0xDE, 0xD4, 0x19, 0x3E, 0xB6, 0xB9, 0xD7, 0x52, 0x2C, 0xEA, 0x0C, 0xB9, 0x95, 0x48,
-    0x54, 0x79, 0xA5, 0xA8, 0xAD, 0x97, 0x0E, 0x0C, 0xC0, 0x31, 0x64, 0xC8, 0xC0, 0x90, 0xDB, 0xEA,
-    0x7E, 0x52, 0x55, 0x86, 0x74, 0xE8, 0x50, 0x65, 0xE0, 0xB2, 0x20, 0xB5, 0x12, 0xAD, 0xBF, 0x90,
-    0x81, 0x81, 0x81, 0xEC, 0x1D, 0xC8, 0x00, 0x52, 0x72, 0x2B, 0x7A, 0x3B, 0x74, 0xA0, 0x52, 0x2E,
-    0x36, 0x61, 0x60, 0xC8, 0x10, 0x27, 0x0C, 0x0C, 0x19, 0x70, 0x0B, 0x57, 0x48, 0x30, 0x60, 0x88,
-    0x43, 0x9C, 0xC4, 0xF6, 0xDB, 0xE7, 0x79, 0xED, 0xEF, 0x27, 0xBF, 0x0D, 0x49, 0x11, 0xBE, 0xB1,
-    0xBF, 0xF3, 0xFB, 0x9E, 0xF7, 0xEF, 0x3C, 0xEF, 0x7B, 0x4E, 0xCC, 0xBA, 0xF9, 0xB9, 0x71, 0x2F,
-    0x6C, 0xED, 0x88, 0x9C, 0xF1, 0xDF, 0xF0, 0x8F, 0x9F, 0x9D, 0x56, 0xE6, 0x29, 0x13, 0x1A, 0x2F,
-    0x37, 0xF7, 0x5B, 0xD8, 0x63, 0x8C, 0x93, 0x38, 0x25, 0xFE, 0xAE, 0x9F, 0xCE, 0xE4, 0x5C, 0x52,
-    0xFD, 0xF3, 0xA9, 0x3D, 0xDF, 0x89, 0xC0, 0x58, 0x78, 0x72, 0x32, 0x39, 0x22, 0xB3, 0xE7, 0xCA,
-    0x64, 0x72, 0x4B, 0x75, 0x0D, 0x0D, 0x1B, 0x19, 0xCA, 0xED, 0xE2, 0x93, 0xF2, 0x63, 0xF0, 0xC4,
-    0x28, 0x5C, 0xC2, 0xFB, 0x2D, 0xDE, 0x8E, 0x5D, 0x89, 0x59, 0x7E, 0xB2, 0x91, 0x4C, 0x7B, 0x8F,
-    0x82, 0xB9, 0xED, 0xF9, 0x4E, 0xB3, 0xD6, 0xCC, 0xCA, 0xAF, 0x3B, 0x63, 0xCF, 0xD5, 0x46, 0xE2,
-    0xC2, 0x6B, 0xB3, 0x24, 0xFC, 0xE6, 0x07, 0xAA, 0x7E, 0x7D, 0xCA, 0xEC, 0x9F, 0x92, 0xA5, 0x10,
-    0x0C, 0x7E, 0x84, 0xB7, 0xA6, 0xE6, 0x66, 0x7C, 0x7A, 0x6C, 0xA0, 0x96, 0xA8, 0x4F, 0xE3, 0x74,
-    0x5E, 0xE7, 0xB7, 0x41, 0x1B, 0xB6, 0x51, 0x63, 0x6B, 0x5B, 0xA5, 0xD5, 0xDA, 0x7A, 0xD0, 0x85,
-    0x1D, 0xEA, 0x6D, 0x54, 0xC7, 0x95, 0x2D, 0x6D, 0x91, 0xE6, 0x6B, 0x98, 0xE5, 0x48, 0x9E, 0x95,
-    0xB6, 0x0E, 0x5B, 0xAF, 0x77, 0xC4, 0x64, 0xB9, 0x2D, 0x56, 0xD6, 0x4D, 0x5A, 0xA6, 0x95, 0xAD,
-    0xE2, 0x3A, 0x6A, 0x42, 0x10, 0xF1, 0x3A, 0xB7, 0x33, 0x13, 0xA7, 0x33, 0x99, 0x91, 0x24, 0xCD,
-    0xD3, 0x3C, 0x2E, 0xE3, 0x2A, 0x64, 0x57, 0xE7, 0xF7, 0x9E, 0x78, 0x92, 0x48, 0x4E, 0x2A, 0x98,
-    0xD3, 0xAC, 0x6C, 0xAC, 0x6C, 0x98, 0xA0, 0x63, 0xEB, 0xB3, 0xB3, 0x56, 0xD0, 0xA9, 0x95, 0x4E,
-    0xAF, 0x6B, 0x48, 0x92, 0x81, 0x06, 0xD6, 0x49, 0xB0, 0x52, 0xD8, 0xFA, 0x3D, 0xFA, 0xFA, 0xA8,
-    0x0D, 0xBB, 0x18, 0x24, 0x2D, 0x08, 0xDB, 0x2A, 0xAA, 0x6D, 0x11, 0x57, 0x18, 0x54, 0x66, 0x53,
-    0x9B, 0x4F, 0xCC, 0x5A, 0x92, 0x96, 0xA0, 0xD2, 0x86, 0xFD, 0xC0, 0x70, 0x81, 0x21, 0x18, 0xCC,
-    0x0A, 0x88, 0xD9, 0x32, 0xAC, 0x83, 0x16, 0x3C, 0x0A, 0x06, 0xAE, 0x25, 0xE6, 0x89, 0x13, 0xC6,
-    0xD8, 0x0A, 0x6F, 0x09, 0x07, 0xE2, 0x5B, 0x18, 0x13, 0xF1, 0xCD, 0xCD, 0x7A, 0x98, 0xEF, 0xA3,
-    0x79, 0x67, 0x6F, 0xBF, 0xFD, 0x45, 0x6B, 0xC2, 0xDC, 0xE8, 0x1B, 0xCD, 0xDE, 0x71, 0x7C, 0x3C,
-    0x7B, 0x47, 0x3A, 0x76, 0xF9, 0xAD, 0x6E, 0x7E, 0xF7, 0x9F, 0xC4, 0x98, 0x6A, 0x78, 0x23, 0xBE,
-    0x18, 0x13, 0xF2, 0x2D, 0x8C, 0x7C, 0xF5, 0x65, 0x47, 0xC3, 0xCC, 0x5E, 0xB6, 0x69, 0x5F, 0x54,
-    0xDD, 0x3C, 0x07, 0x6D, 0xA7, 0x8F, 0xEC, 0x9E, 0x5E, 0x1E, 0xFB, 0xF6, 0xE1, 0x0B, 0xBF, 0xB9,
-    0x69, 0xFC, 0x6C, 0x0E, 0xD7, 0x9C, 0x18, 0x5F, 0x8A, 0x50, 0xEA, 0x58, 0x5A, 0xCB, 0x7F, 0x9D,
-    0xFE, 0x63, 0x39, 0x96, 0x26, 0x94, 0xCA, 0x15, 0xBA, 0x0B, 0xDE, 0xC6, 0x40, 0xE9, 0x46, 0x4A,
-    0x23, 0xBD, 0x11, 0x29, 0x44, 0x1A, 0xFD, 0x57, 0xB0, 0x5A, 0xB2, 0xAB, 0xD1, 0x61, 0x78, 0x0E,
-    0x1C, 0x93, 0xF3, 0x92, 0xF5, 0x59, 0x2D, 0xF9, 0x86, 0x39, 0x30, 0x35, 0x2F, 0x06, 0x62, 0xA2,
-    0x56, 0x6A, 0x4F, 0x3E, 0x91, 0xC4, 0xF6, 0x52, 0xBB, 0xF2, 0x71, 0x0F, 0xA3, 0xAD, 0x24, 0xD8,
-    0x18, 0xE8, 0x3F, 0x6D, 0xDC, 0xCF, 0xB2, 0xCA, 0x93, 0x69, 0xD8, 0x71, 0x50, 0x8E, 0xFD, 0x5A,
-    0xFB, 0xC3, 0x0F, 0x6A, 0x51, 0x9F, 0x96, 0xAE, 0x24, 0x3A, 0x7C, 0x9F, 0x71, 0xD6, 0x0F, 0xBC,
-    0x0A, 0xEA, 0x69, 0x27, 0x57, 0x64, 0xBA, 0x61, 0x8E, 0x6E, 0x61, 0xB3, 0x3D, 0x00, 0x9C, 0xB0,
-    0xE0, 0xE6, 0x66, 0x6B, 0x2B, 0x95, 0x07, 0x98, 0x39, 0x16, 0x7E, 0x94, 0xCA, 0xC7, 0xD2, 0xDD,
-    0xF2, 0x41, 0x4F, 0x68, 0x1E, 0xE8, 0x83, 0xE9, 0x5B, 0xA7, 0x5E, 0x32, 0xBE, 0x31, 0xFA, 0x79,
-    0x79, 0x72, 0xE8, 0xE1, 0xA8, 0x5D, 0xDC, 0x7A, 0xC7, 0x98, 0xC2, 0x3C, 0xAA, 0x9F, 0xB5, 0xC9,
-    0x43, 0xF1, 0xB6, 0xFC, 0x44, 0x1D, 0x80, 0x62, 0xC0, 0xB6, 0x50, 0x60, 0xF4, 0x2C, 0x67, 0xD1,
-    0x85, 0x2B, 0x98, 0xB0, 0xD6, 0x66, 0x7B, 0x03, 0x36, 0xE9, 0xB5, 0xE8, 0xB7, 0x68, 0x4B, 0xF3,
-    0x01, 0x32, 0x73, 0x98, 0xB8, 0x19, 0x26, 0x36, 0x41, 0x8B, 0x5D, 0xAC, 0x8F, 0x4C, 0x09, 0x18,
-    0xF3, 0xE6, 0xA0, 0x5D, 0x34, 0x8F, 0x48, 0x1D, 0x34, 0x41, 0x13, 0x57, 0xD8, 0x94, 0x66, 0x83,
-    0x44, 0x8E, 0x77, 0x11, 0x9C, 0x52, 0x1A, 0xAF, 0x8B, 0x2A, 0x79, 0x0D, 0xFE, 0x67, 0xA5, 0xB2,
-    0x22, 0xA8, 0x48, 0x0D, 0x58, 0x9B, 0x8A, 0x7C, 0xD0, 0x47, 0x70, 0x3E, 0x79, 0x1D, 0x9B, 0xBB,
-    0x4E, 0xCF, 0x8A, 0xD7, 0x01, 0xAC, 0x8A, 0xD5, 0xB7, 0xC2, 0x1A, 0x90, 0xF5, 0x9F, 0xDE, 0xED,
-    0xC9, 0xAE, 0xD7, 0x79, 0xBD, 0x2D, 0x75, 0x1B, 0x14, 0x00, 0x8A, 0x4F, 0x7B, 0x17, 0xFC, 0x28,
-    0x4E, 0x8D, 0xCD, 0xF0, 0xD5, 0xC2, 0x0E, 0xCD, 0xB6, 0x04, 0xEC, 0x90, 0x48, 0x09, 0x81, 0xB0,
-    0x75, 0xEC, 0x05, 0x4C, 0x27, 0x8B, 0x8E, 0xBC, 0xD9, 0x86, 0xD7, 0xA0, 0x01, 0x6C, 0x29, 0x2C,
-    0x9D, 0x64, 0x50, 0x08, 0x7B, 0xAC, 0x94, 0xC0, 0xD2, 0x41, 0x37, 0x59, 0x63, 0x02, 0x19, 0x76,
-    0x86, 0x59, 0x37, 0x66, 0x25, 0xB9, 0x3D, 0x96, 0x40, 0x6D, 0xA3, 0xEA, 0x54, 0x72, 0x8C, 0x0E,
-    0xDA, 0xA5, 0x48, 0x53, 0x2B, 0xCD, 0xF1, 0xA1, 0x72, 0x5D, 0x59, 0x58, 0x03, 0x92, 0x99, 0x45,
-    0x15, 0x68, 0xDD, 0x98, 0xD9, 0x6A, 0xB0, 0x13, 0xD9, 0x1F, 0xD5, 0x3F, 0xD7, 0x75, 0xB9, 0xA0,
-    0x05, 0x41, 0xA3, 0x85, 0x75, 0xA9, 0xFE, 0x25, 0x3E, 0x5C, 0x4C, 0x86, 0x99, 0xD6, 0x19, 0xBF,
-    0x8C, 0x33, 0xAA, 0x3E, 0x04, 0xF1, 0xAC, 0x85, 0x44, 0x45, 0x58, 0xA7, 0x17, 0x25, 0x44, 0x94,
-    0x13, 0xC9, 0x03, 0x01, 0x5A, 0x4B, 0x25, 0x54, 0x7F, 0x26, 0xAD, 0x8F, 0x26, 0x8B, 0x48, 0xF2,
-    0x5A, 0xBF, 0x59, 0xD9, 0x6F, 0xE5, 0xA0, 0x1C, 0x69, 0x66, 0x96, 0x00, 0xBF, 0xA5, 0x3C, 0x27,
-    0x66, 0xFF, 0x09, 0xFC, 0x4E, 0x61, 0xA2, 0xA0, 0x65, 0x34, 0x50, 0x41, 0xCA, 0xF8, 0x1B, 0x80,
-    0x71, 0x54, 0x85, 0xAA, 0x0F, 0x72, 0x03, 0x90, 0xFF, 0xB0, 0xA5, 0xF0, 0x04, 0x7E, 0x57, 0xC0,
-    0xED, 0xD7, 0xC4, 0x7E, 0xEA, 0x03, 0x0B, 0x9D, 0x6B, 0xFD, 0x96, 0x41, 0x80, 0xFA, 0x80, 0x51,
-    0xFE, 0x2D, 0xAE, 0x84, 0x35, 0xE5, 0x11, 0xF5, 0x3B, 0x5B, 0xC8, 0xF1, 0x9E, 0x8A, 0xCC, 0xE0,
-    0x2D, 0x7F, 0x45, 0x6C, 0xC8, 0x8A, 0x0C, 0xC0, 0x43, 0x7D, 0xC4, 0x82, 0x20, 0x22, 0x55, 0x28,
-    0x6A, 0x5C, 0xC6, 0x3D, 0x34, 0x55, 0x0E, 0x53, 0x03, 0x05, 0xC7, 0xDE, 0x38, 0x00, 0x86, 0x68,
-    0x96, 0x29, 0x6C, 0x30, 0x8B, 0x31, 0x80, 0x1F, 0xB0, 0x89, 0x58, 0x9A, 0x83, 0xA8, 0x05, 0x28,
-    0x99, 0xB0, 0x02, 0x6D, 0xEC, 0x05, 0x00, 0x7C, 0xAF, 0x7D, 0x11, 0x94, 0x9F, 0xB3, 0xDF, 0x47,
-    0xD8, 0x2D, 0x2D, 0xD0, 0xD3, 0xE1, 0x28, 0x08, 0x94, 0x4D, 0xD3, 0xDC, 0x6B, 0x75, 0x2C, 0x60,
-    0xBD, 0x47, 0x18, 0x1C, 0xC6, 0xC3, 0x5C, 0x56, 0xC3, 0x24, 0xD4, 0x9B, 0x16, 0xE0, 0x05, 0x4A,
-    0xC9, 0xB3, 0x5C, 0x27, 0x4A, 0xE2, 0xD1, 0x1F, 0x05, 0x1B, 0xC0, 0xE7, 0x54, 0x10, 0xAA, 0x82,
-    0x5A, 0x29, 0x60, 0x65, 0x3B, 0x8D, 0x73, 0x44, 0x1A, 0xB8, 0x6A, 0x5A, 0xD2, 0xD1, 0xE8, 0x8D,
-    0xB0, 0x19, 0xF7, 0xA6, 0x0F, 0x97, 0x83, 0x43, 0xD2, 0xBA, 0xB5, 0x61, 0x90, 0x33, 0xCA, 0x91,
-    0x7A, 0x83, 0xD2, 0x55, 0x76, 0x8C, 0xCD, 0xC1, 0xB8, 0xD2, 0x0A, 0x2A, 0x1F, 0x4E, 0xD6, 0xB8,
-    0x2D, 0x67, 0x80, 0xA5, 0x21, 0x66, 0xEB, 0x2C, 0x6C, 0x64, 0xCE, 0x73, 0xC6, 0x99, 0xD0, 0x25,
-    0xE7, 0xDA, 0x61, 0x36, 0x44, 0xE1, 0xFC, 0x60, 0xA0, 0xE0, 0x35, 0x4A, 0xC3, 0x19, 0x7C, 0xF7,
-    0x19, 0x28, 0xAD, 0xA5, 0x53, 0x41, 0xE3, 0x95, 0xF1, 0xAE, 0x96, 0x26, 0x3C, 0x9F, 0x9B, 0x9D,
-    0x28, 0xF7, 0x2A, 0x9B, 0xC4, 0x49, 0x6A, 0x5A, 0xD3, 0x05, 0x85, 0xD3, 0x5A, 0xE3, 0xD5, 0xC6,
-    0xD5, 0xE8, 0x14, 0xB7, 0xD8, 0x0B, 0x0E, 0xF7, 0xCE, 0x34, 0x14, 0x63, 0x5B, 0x93, 0xD6, 0xFC,
-    0x46, 0x3D, 0xFC, 0x2D, 0x71, 0x05, 0x32, 0x56, 0x5A, 0x6F, 0x8C, 0x4F, 0x17, 0x77, 0xA6, 0x9C,
-    0x84, 0x31, 0x98, 0x87, 0xF1, 0x08, 0x16, 0x98, 0x3B, 0xD6, 0x31, 0x8C, 0xC1, 0x0B, 0x9E, 0x99,
-    0x60, 0xBA, 0x6D, 0xA8, 0x27, 0x2F, 0x5F, 0xDE, 0x75, 0x7B, 0x69, 0xBE, 0x47, 0x90, 0xE1, 0x06,
-    0x20, 0x3F, 0x45, 0x7E, 0x84, 0xC1, 0x4D, 0xC8, 0x68, 0x86, 0x78, 0x25, 0x65, 0x54, 0xE1, 0x07,
-    0xD5, 0x13, 0xF8, 0x61, 0x84, 0xE3, 0x4F, 0xD8, 0xEB, 0xCF, 0x30, 0x84, 0x55, 0xFD, 0x31, 0xF2,
-    0x25, 0xFB, 0x4A, 0x7A, 0xD3, 0x7B, 0x21, 0x3C, 0x13, 0x29, 0xD0, 0xE5, 0x51, 0x02, 0x8E, 0x2C,
-    0x02, 0x38, 0x2E, 0x76, 0x88, 0x23, 0xC7, 0x4E, 0x06, 0x80, 0xC9, 0x3D, 0x09, 0xA8, 0x84, 0xDC,
-    0xD1, 0x5C, 0xA8, 0xD0, 0x1F, 0x56, 0x75, 0xA1, 0x62, 0x58, 0xA8, 0xE3, 0xCF, 0x7B, 0x86, 0x73,
-    0x4D, 0x56, 0x84, 0xD8, 0x5D, 0x94, 0x01, 0xBB, 0x8A, 0x3C, 0x84, 0xB9, 0x07, 0x97, 0x4F, 0x0C,
-    0xC5, 0x89, 0x13, 0x05, 0x10, 0x0F, 0x41, 0x31, 0xB1, 0x1A, 0x64, 0xCF, 0xB1, 0xC0, 0x78, 0x7A,
-    0x8E, 0x0C, 0xCC, 0x0B, 0x29, 0x0A, 0xAF, 0xC1, 0xCD, 0x9B, 0x14, 0x6A, 0x99, 0x17, 0x8E, 0xA3,
-    0x00, 0x54, 0x74, 0xE4, 0x60, 0x0F, 0x77, 0x9C, 0x17, 0x80, 0xB5, 0x93, 0xB9, 0xA2, 0x9C, 0x77,
-    0xCD, 0x9E, 0x13, 0xA4, 0xF3, 0xC6, 0xB0, 0x84, 0x3F, 0xAC, 0xA5, 0x61, 0x79, 0x43, 0x37, 0x06,
-    0x9E, 0x4D, 0x41, 0x55, 0xE4, 0x55, 0xBC, 0x0D, 0xC0, 0x58, 0x9E, 0x47, 0x80, 0x2E, 0x2F, 0x21,
-    0x57, 0x04, 0xD2, 0x32, 0x25, 0x44, 0x3C, 0xAF, 0xD2, 0xD2, 0x6F, 0x2D, 0xEC, 0x9B, 0x36, 0x08,
-    0x4F, 0x70, 0x32, 0x82, 0x25, 0xC0, 0x8D, 0x56, 0xD5, 0x5C, 0x04, 0x7E, 0x8A, 0x86, 0x5B, 0xD1,
-    0xF1, 0xB4, 0x51, 0xB5, 0x98, 0xB4, 0x65, 0x2A, 0x8F, 0x90, 0x42, 0x78, 0x83, 0x2F, 0x2C, 0x90,
-    0x94, 0xEB, 0xC9, 0xE2, 0xF3, 0xC4, 0xD6, 0xD6, 0xD6, 0xE9, 0xA1, 0xE7, 0x77, 0xC4, 0xC0, 0x83,
-    0x0C, 0x2E, 0x91, 0x8F, 0x19, 0x4E, 0x15, 0x30, 0x2D, 0x4B, 0x82, 0xD2, 0xB8, 0xD8, 0x22, 0xFD,
-    0x6F, 0x41, 0x0A, 0x58, 0x05, 0x16, 0x9C, 0xEC, 0x1A, 0xC7, 0x1F, 0x7D, 0x4B, 0xCF, 0x0B, 0x3D,
-    0x57, 0xF9, 0x0A, 0x1A, 0x4E, 0xB1, 0x53, 0x12, 0x9F, 0xA9, 0x5B, 0xF2, 0x34, 0x7B, 0x3C, 0x62,
-    0xE7, 0x2F, 0x42, 0x0E, 0x7D, 0xF2, 0x26, 0x26, 0xC1, 0x9B, 0x0B, 0x32, 0x1E, 0xA4, 0xF0, 0x8B,
-    0x31, 0x13, 0x04, 0x9B, 0x16, 0x5D, 0x7F, 0x19, 0xBA, 0x9D, 0x66, 0xEC, 0x06, 0x89, 0x60, 0x4C,
-    0x16, 0xE3, 0x31, 0x09, 0xDC, 0x41, 0x5F, 0x7B, 0x06, 0x14, 0x9E, 0xC1, 0x90, 0xD8, 0x04, 0x45,
-    0x34, 0x0D, 0xF3, 0x30, 0x8F, 0xB0, 0xB4, 0xD5, 0x49, 0xC6, 0xAC, 0x9E, 0x9A, 0xAF, 0xB5, 0xC0,
-    0x73, 0xBF, 0xBD, 0x43, 0xA3, 0x37, 0x6B, 0x5C, 0x01, 0x44, 0x3C, 0x32, 0xC6, 0x90, 0xE3, 0xCD,
-    0xE6, 0x18, 0x62, 0xA1, 0xA0, 0x7E, 0x16, 0x67, 0x44, 0xCA, 0x79, 0xE3, 0x4C, 0xEF, 0x9B, 0xB2,
-    0x3E, 0x3F, 0x0D, 0x34, 0x8B, 0x18, 0x54, 0xCC, 0xE2, 0xCD, 0xB7, 0x32, 0xEF, 0x0E, 0x67, 0x2B,
-    0x49, 0x91, 0x8D, 0xFD, 0x6E, 0xEB, 0x35, 0x63, 0x68, 0x71, 0xA7, 0x8F, 0x6B, 0x24, 0x1A, 0x62,
-    0x97, 0x06, 0xFE, 0x21, 0xCC, 0x6B, 0xA3, 0x4E, 0x0D, 0x18, 0x6C, 0xAC, 0x72, 0x9E, 0x25, 0xE6,
-    0x4F, 0x6E, 0xBB, 0x5A, 0x9A, 0xCF, 0xFC, 0xCA, 0xFF, 0x50, 0xB6, 0x2F, 0x71, 0xF3, 0x65, 0x9B,
-    0x7A, 0x98, 0x22, 0x30, 0x0B, 0xBC, 0x58, 0x14, 0xA6, 0x91, 0xD1, 0x1E, 0x85, 0x0C, 0x27, 0x9D,
-    0xBF, 0x89, 0x5C, 0x07, 0xB2, 0xD7, 0xCA, 0x0B, 0x35, 0x49, 0xA7, 0x00, 0xAB, 0xD8, 0x5E, 0x3D,
-    0x99, 0x8C, 0xAE, 0xB6, 0xC0, 0xAC, 0xC3, 0xD4, 0x7B, 0x0F, 0x2D, 0xDB, 0x8A, 0x4C, 0xCA, 0xFB,
-    0x32, 0xC5, 0x81, 0xA3, 0x27, 0x47, 0xC4, 0xC5, 0x3C, 0xE6, 0xC8, 0xE4, 0xCF, 0x06, 0x50, 0x40,
-    0x7F, 0xDA, 0xEB, 0x20, 0xDC, 0x4D, 0x36, 0x44, 0x2E, 0x0B, 0xDC, 0x1C, 0x0E, 0xD5, 0x4E, 0x26,
-    0x6C, 0x77, 0x54, 0x69, 0x1A, 0x10, 0x34, 0xE1, 0x51, 0xAE, 0x69, 0x3F, 0x0D, 0x18, 0x83, 0x78,
-    0x6A, 0x0E, 0x15, 0x77, 0xC8, 0x6D, 0xBE, 0x9F, 0xD1, 0x66, 0x29, 0xE3, 0x2C, 0x80, 0xEA, 0x77,
-    0xFC, 0xEC, 0x1E, 0x9A, 0x0D, 0xD9, 0x3D, 0x74, 0x97, 0x21, 0x85, 0x3F, 0xCF, 0x5B, 0x0B, 0x2B,
-    0x9F, 0x52, 0x56, 0xC8, 0x0C, 0x35, 0x79, 0x77, 0xFC, 0xAC, 0xA5, 0x97, 0xC7, 0x21, 0x6B, 0xE9,
-    0x5D, 0x86, 0x18, 0x3B, 0x1B, 0x62, 0x65, 0x91, 0x64, 0xAC, 0x4A, 0x9F, 0xCC, 0xE0, 0x61, 0xCA,
-    0xA4, 0x9E, 0x26, 0x3C, 0xCE, 0x93, 0x26, 0x77, 0xEB, 0x21, 0xDA, 0x37, 0xDB, 0xCD, 0x24, 0xEC,
-    0x5F, 0x90, 0x92, 0x21, 0xE0, 0x27, 0xB0, 0xE6, 0x54, 0x63, 0x86, 0x42, 0xA1, 0x43, 0xAB, 0xC6,
-    0x8D, 0x99, 0x21, 0xAF, 0x21, 0xC0, 0x6B, 0x25, 0x60, 0x0F, 0x7D, 0x94, 0x27, 0x6D, 0xA6, 0x84,
-    0x21, 0x1A, 0x1C, 0x6D, 0x68, 0xE8, 0xD3, 0x09, 0x36, 0x31, 0x74, 0x9A, 0x31, 0xA0, 0xD7, 0x23,
-    0xB2, 0x50, 0xBF, 0xD4, 0xA7, 0x66, 0x50, 0x74, 0x47, 0xA6, 0x37, 0x4B, 0x58, 0xB7, 0xFC, 0xFC,
-    0x8B, 0x67, 0x99, 0xA9, 0xA2, 0xFE, 0xC0, 0x05, 0x11, 0x88, 0xA9, 0x9C, 0xA3, 0x80, 0xA5, 0x20,
-    0x31, 0xE4, 0x77, 0x38, 0xAC, 0x9A, 0x25, 0x4C, 0xDA, 0xB8, 0x49, 0x76, 0x4F, 0x2E, 0x52, 0xF2,
-    0x50, 0x36, 0xF9, 0x63, 0x5B, 0x4A, 0x9D, 0x0C, 0x32, 0x23, 0xE4, 0x50, 0x62, 0x95, 0x0C, 0x47,
-    0xDC, 0x56, 0xD7, 0xC9, 0x54, 0x70, 0x57, 0x17, 0xAC, 0x47, 0x39, 0xA3, 0x56, 0xA5, 0x4C, 0x99,
-    0x65, 0x22, 0xC8, 0x31, 0xFB, 0x35, 0x7E, 0xAF, 0xF2, 0x21, 0x18, 0x52, 0x3A, 0xAB, 0x39, 0x00,
-    0xF6, 0x16, 0x25, 0x83, 0x9F, 0x50, 0xAE, 0x95, 0xF5, 0xDB, 0x25, 0x02, 0x98, 0x53, 0x1E, 0xAC,
-    0x45, 0x69, 0xA4, 0xA6, 0x2C, 0x9E, 0x14, 0x94, 0x04, 0x01, 0x8B, 0x72, 0x80, 0x20, 0xA5, 0x58,
-    0x99, 0x65, 0x94, 0x92, 0xAC, 0xF2, 0x8C, 0x07, 0x56, 0x04, 0xD9, 0xDF, 0x41, 0x1A, 0x2E, 0xAB,
-    0x23, 0xDD, 0x90, 0x46, 0x76, 0x71, 0xCE, 0xAB, 0xFC, 0x64, 0x08, 0x81, 0x18, 0x4B, 0xE6, 0x4D,
-    0xF6, 0xF9, 0x10, 0x1D, 0x69, 0x42, 0x57, 0x3E, 0x54, 0xBB, 0x35, 0xAC, 0xA4, 0xE2, 0x8B, 0x9A,
-    0xCA, 0xEA, 0xA2, 0xDC, 0x85, 0x98, 0x00, 0xD6, 0xB1, 0x13, 0x59, 0x81, 0x60, 0xAC, 0x34, 0xCC,
-    0x36, 0x6F, 0x33, 0x0A, 0x4C, 0xB1, 0xAA, 0x61, 0xD8, 0x01, 0x18, 0x61, 0xD7, 0x23, 0x49, 0x0B,
-    0x99, 0x15, 0x94, 0x63, 0xC5, 0xEF, 0xD5, 0x04, 0xE0, 0x5D, 0x53, 0x56, 0xDE, 0x11, 0x11, 0x31,
-    0xAE, 0xF2, 0xF3, 0x09, 0x51, 0x0F, 0x71, 0x81, 0xEC, 0x51, 0x7D, 0x1A, 0x6A, 0x0C, 0xF1, 0x40,
-    0xBD, 0x82, 0x0A, 0x5C, 0x6A, 0x2E, 0xC7, 0x66, 0x5B, 0x8F, 0x86, 0xD7, 0x60, 0xBD, 0x68, 0x6E,
-    0xC6, 0x66, 0x10, 0x5C, 0x57, 0xEC, 0x64, 0xB2, 0x8F, 0xAD, 0xA3, 0x80, 0x6A, 0x51, 0x6E, 0xC3,
-    0x9C, 0x3E, 0xCE, 0x53, 0x49, 0xD5, 0x62, 0x40, 0xCB, 0x46, 0xD1, 0xC6, 0x0F, 0xEE, 0xDA, 0x58,
-    0xB2, 0xB1, 0x62, 0x63, 0xC3, 0xC6, 0x06, 0x69, 0x12, 0x64, 0x6B, 0x19, 0x27, 0x2C, 0x63, 0x40,
-    0x98, 0x33, 0x3C, 0x56, 0x0C, 0x29, 0x0F, 0xD4, 0x38, 0x3D, 0xA3, 0xC1, 0x9C, 0x37, 0x3B, 0xB4,
-    0x5E, 0xC1, 0x6D, 0xA8, 0x7B, 0x11, 0x56, 0x45, 0x01, 0x1B, 0xB1, 0x0B, 0xE8, 0xA9, 0xCF, 0xF1,
-    0x06, 0xA8, 0xD8, 0xB1, 0x6C, 0x3C, 0xCC, 0xC6, 0x8F, 0x6E, 0x69, 0x7C, 0x9E, 0x8D, 0x17, 0xB4,
-    0x11, 0xF5, 0xDD, 0xCE, 0xA7, 0xDC, 0x09, 0x81, 0xBA, 0x58, 0x25, 0x4D, 0xAE, 0xB1, 0x81, 0x65,
-    0xD6, 0x79, 0x49, 0xD6, 0xEB, 0x4D, 0x59, 0xA1, 0x30, 0xBE, 0x83, 0x85, 0x9A, 0x33, 0xF0, 0xA3,
-    0x96, 0x9F, 0x6E, 0xFE, 0xE9, 0xEF, 0xF0, 0xE9, 0xE6, 0xE3, 0xDA, 0x9D, 0x23, 0x98, 0xA6, 0x04,
-    0xF8, 0xC9, 0x95, 0xE8, 0x44, 0x51, 0xD9, 0x65, 0x98, 0xD7, 0x13, 0x8B, 0x46, 0x16, 0x19, 0xA3,
-    0x5F, 0x12, 0x54, 0xCE, 0xA1, 0x6B, 0xF1, 0x59, 0x89, 0x67, 0xD7, 0x71, 0x97, 0xC9, 0x62, 0xBE,
-    0x22, 0xD7, 0x98, 0x7A, 0xA9, 0x23, 0x22, 0xE9, 0xEF, 0xD3, 0x02, 0xB0, 0xC5, 0xFD, 0x74, 0x0C,
-    0x9F, 0x8E, 0x81, 0xEB, 0x1F, 0xFE, 0xDC, 0xD9, 0xD2, 0x0A, 0x07, 0x98, 0x26, 0x43, 0x4E, 0xB4,
-    0x72, 0x07, 0x6C, 0x58, 0x4B, 0xB2, 0x6A, 0x71, 0xBD, 0xC5, 0xEC, 0xDC, 0xED, 0x1E, 0x22, 0x7D,
-    0xF8, 0x81, 0x9E, 0x55, 0x7E, 0x7E, 0x49, 0xD6, 0x9C, 0xEA, 0x15, 0x86, 0x1B, 0xB3, 0x83, 0x62,
-    0x8D, 0xC4, 0xD3, 0xC4, 0xC8, 0xF3, 0x77, 0xB7, 0x99, 0xBB, 0xEB, 0x7D, 0xE9, 0x01, 0x39, 0x61,
-    0xBE, 0x4F, 0x7D, 0x9B, 0xAD, 0x64, 0x0C, 0x6F, 0xE1, 0x3C, 0x27, 0x00, 0xF9, 0xBD, 0x6E, 0x6B,
-    0x7E, 0xD5, 0x3F, 0x5F, 0x65, 0x1A, 0xFC, 0xE3, 0xF1, 0xC6, 0x0D, 0x09, 0x41, 0xDA, 0xAF, 0x03,
-    0x5A, 0x14, 0xF7, 0x89, 0xF7, 0x6F, 0xD6, 0x86, 0xD7, 0x7E, 0x7A, 0xE7, 0x08, 0xAD, 0xC3, 0x00,
-    0x3F, 0x73, 0x96, 0x92, 0xFD, 0xB8, 0x74, 0x3B, 0xC0, 0x14, 0x72, 0xD7, 0x00, 0x2F, 0x0E, 0xAE,
-    0x15, 0xCE, 0x39, 0x53, 0x1E, 0x84, 0xD3, 0x7C, 0xC8, 0x47, 0x20, 0xE3, 0x08, 0x9C, 0x1A, 0x69,
-    0x19, 0x22, 0xE6, 0xB7, 0x64, 0x85, 0x19, 0xA1, 0x55, 0x03, 0x35, 0x71, 0x6A, 0x38, 0x91, 0xBA,
-    0x27, 0x71, 0x48, 0x6D, 0xA3, 0x2A, 0xE6, 0x85, 0x41, 0x9F, 0xE6, 0x51, 0x9F, 0xE5, 0x04, 0x10,
-    0x67, 0x09, 0x76, 0x23, 0xD9, 0xE5, 0xCF, 0x1F, 0x98, 0xC1, 0x5C, 0x07, 0x32, 0x01, 0xEB, 0xF9,
-    0xBC, 0xBD, 0xD9, 0xC4, 0xFD, 0x70, 0x4F, 0x5C, 0xD9, 0xA9, 0xD9, 0xCF, 0xC2, 0x94, 0x89, 0xE2,
-    0x4A, 0x26, 0xD7, 0xE6, 0x97, 0xC6, 0xF3, 0x43, 0xBD, 0x68, 0xC4, 0xA2, 0x5F, 0xD9, 0xCF, 0x7E,
-    0x2C, 0x3C, 0x2F, 0x99, 0x54, 0x73, 0xCB, 0x67, 0x1C, 0xE2, 0xED, 0xD3, 0xEA, 0x51, 0xAF, 0x68,
-    0xAE, 0x37, 0xD5, 0x64, 0x53, 0x93, 0xC6, 0xC7, 0xC3, 0xFC, 0xA4, 0xDB, 0xD8, 0xA0, 0x0C, 0x1B,
-    0x1C, 0xA4, 0xC3, 0x1B, 0x37, 0x78, 0x4A, 0x52, 0x9C, 0x6F, 0x8D, 0xDC, 0xF4, 0xE4, 0x6C, 0x32,
-    0xBC, 0xBC, 0x00, 0x7B, 0x8D, 0xC9, 0xCE, 0x9F, 0x6F, 0xBC, 0xD6, 0x86, 0x95, 0x97, 0xB7, 0xE1,
-    0x40, 0x4B, 0xD3, 0x55, 0x3C, 0x8F, 0x51, 0x26, 0x26, 0xBB, 0x4C, 0x08, 0x6D, 0x3F, 0x16, 0x34,
-    0x43, 0x79, 0xE4, 0x2E, 0x4E, 0x46, 0x35, 0x07, 0xF4, 0xA1, 0x59, 0x54, 0xD6, 0xD0, 0x6E, 0xDE,
-    0xBA, 0x97, 0x63, 0x32, 0x31, 0x9C, 0x2F, 0xA1, 0xC9, 0x1D, 0x17, 0xE5, 0x7E, 0xE2, 0xC5, 0x33,
-    0xFF, 0x78, 0xCE, 0x3E, 0x86, 0xBF, 0x69, 0xA0, 0x37, 0xD4, 0x21, 0x4F, 0xE4, 0xB6, 0x48, 0x8B,
-    0x14, 0x47, 0x67, 0x1C, 0x39, 0x98, 0xE1, 0xF1, 0xB8, 0x1C, 0xF1, 0x7E, 0x23, 0x9B, 0x66, 0x09,
-    0x42, 0x2E, 0x4F, 0xD3, 0xAD, 0xDF, 0xE0, 0x70, 0x1C, 0x17, 0x31, 0x4E, 0xB0, 0x70, 0xB2, 0xDE,
-    0x74, 0xA6, 0x73, 0xBA, 0xB9, 0x68, 0x66, 0x64, 0x0E, 0x96, 0xEF, 0xC6, 0xCC, 0x78, 0x3A, 0xDC,
-    0x6E, 0x15, 0x73, 0x59, 0xF8, 0x24, 0xF7, 0xB9, 0xC1, 0x74, 0xBC, 0xD7, 0x2B, 0x31, 0x17, 0x51,
-    0x88, 0xC4, 0xE4, 0x86, 0x12, 0x8B, 0x3B, 0x5D, 0xC9, 0x17, 0x97, 0x3B, 0xCB, 0xFC, 0xF4, 0x3E,
-    0x29, 0xBA, 0x03, 0x5F, 0x33, 0x86, 0xC6, 0x14, 0xDD, 0x8E, 0xB7, 0x6D, 0x63, 0x6E, 0x9E, 0x92,
-    0xBF, 0x55, 0x65, 0xF2, 0xF7, 0xAA, 0x38, 0x87, 0x47, 0x36, 0xC6, 0xB0, 0xAB, 0x9A, 0x98, 0xD9,
-    0x9E, 0x57, 0x4E, 0xB0, 0xCA, 0xE1, 0x66, 0x48, 0xC8, 0xF7, 0x6A, 0x68, 0xF8, 0x9F, 0x8B, 0xEF,
-    0x9D, 0xDD, 0x22, 0xCD, 0xAF, 0xAD, 0x16, 0x6B, 0x07, 0xC3, 0x65, 0x89, 0x06, 0xC6, 0xF9, 0xEA,
-    0xF7, 0xF1, 0x64, 0x89, 0xDA, 0x5B, 0x13, 0x87, 0x40, 0xD2, 0x5E, 0xB3, 0xF9, 0xAF, 0x94, 0x98,
-    0x5C, 0x57, 0x62, 0x51, 0x1B, 0x51, 0x45, 0x6A, 0x26, 0x79, 0x1D, 0x43, 0x70, 0xB4, 0x3C, 0xDB,
-    0xDD, 0x9D, 0xA2, 0xF3, 0x6E, 0xD4, 0x22, 0xEC, 0x7F, 0x29, 0x87, 0xDB, 0x79, 0x22, 0x13, 0x0C,
-    0xE9, 0xBB, 0x7A, 0xB2, 0xCC, 0x8B, 0x43, 0xEB, 0xFE, 0x7B, 0xB3, 0x8A, 0xE3, 0xBA, 0xD9, 0xEF,
-    0xEB, 0xA1, 0x9C, 0xB1, 0x0D, 0xBC, 0x4D, 0x81, 0xF1, 0x19, 0x8B, 0x9F, 0x6B, 0x2B, 0x45, 0x7D,
-    0xEC, 0xDE, 0x42, 0xEA, 0x12, 0x4B, 0x0B, 0x2F, 0x15, 0xFD, 0x6E, 0x38, 0xAB, 0x0D, 0xBA, 0xCC,
-    0x97, 0x8E, 0x70, 0xA7, 0x51, 0x5D, 0x3D, 0x89, 0x74, 0x03, 0xC1, 0x45, 0x72, 0x64, 0x68, 0x70,
-    0x59, 0xE4, 0xED, 0x70, 0x62, 0xE6, 0x4E, 0x5A, 0x6D, 0x91, 0xBA, 0x78, 0x2D, 0x53, 0x97, 0x7D,
-    0x18, 0xAC, 0x47, 0xF1, 0xD9, 0xF1, 0x6F, 0x99, 0x14, 0xA2, 0x65, 0xB6, 0x3B, 0x99, 0xBC, 0x30,
-    0xEC, 0xF6, 0x11, 0x78, 0xA0, 0xA0, 0xA1, 0x7A, 0x74, 0x6B, 0x4B, 0xBE, 0xD8, 0xDA, 0x3A, 0x71,
-    0xE7, 0xB9, 0x30, 0x3A, 0xAA, 0xBC, 0x17, 0xE3, 0x42, 0xC9, 0x6C, 0xDD, 0x91, 0x8D, 0x19, 0x57,
-    0x23, 0x93, 0x88, 0x1C, 0x36, 0x0F, 0xCA, 0xDB, 0xD9, 0x18, 0x0E, 0xA4, 0x09, 0x72, 0xC6, 0xB4,
-    0xCF, 0xAE, 0xC9, 0xFB, 0xEF, 0x2E, 0x10, 0xF2, 0x82, 0x5C, 0x92, 0xED, 0x3E, 0x6B, 0x46, 0x2F,
-    0xA4, 0x01, 0x4F, 0xD8, 0x6F, 0xB0, 0x59, 0x32, 0x24, 0x90, 0x4F, 0x98, 0xD5, 0x67, 0x79, 0xDF,
-    0xCF, 0xFF, 0x4D, 0x60, 0x7F, 0x7C, 0x91, 0x1D, 0xD8, 0x3A, 0x2F, 0x12, 0x67, 0x53, 0x0E, 0xDB,
-    0xEE, 0x6C, 0xB9, 0x4F, 0x5D, 0xE8, 0x32, 0x6C, 0xB3, 0x09, 0x67, 0x49, 0xE5, 0xE2, 0xF6, 0xA9,
-    0xC5, 0xFD, 0xF5, 0xDA, 0x95, 0x43, 0x0F, 0x7B, 0x2F, 0xFF, 0xCE, 0x4B, 0xE6, 0x63, 0xF3, 0xA8,
-    0x7E, 0x5E, 0x7E, 0xB8, 0x9B, 0x74, 0x2B, 0x67, 0xF9, 0xFF, 0x2A, 0xC8, 0x26, 0x79, 0x17, 0x38,
-    0x7D, 0x70, 0x42, 0xB3, 0x7B, 0xF9, 0x90, 0x01, 0xDB, 0xE6, 0x70, 0x23, 0xA9, 0x62, 0x9C, 0xAB,
-    0xDA, 0x87, 0xA0, 0xB6, 0x0E, 0x8E, 0x82, 0xBF, 0xBB, 0xC5, 0x1F, 0x9F, 0xF2, 0xF2, 0x2B, 0x15,
-    0x6F, 0x1C, 0x1F, 0x82, 0xB7, 0xB4, 0x74, 0xB7, 0xCD, 0xFF, 0xCD, 0x0A, 0xFF, 0x05, 0xED, 0x55,
-    0xB1, 0x6E, 0x24, 0x45, 0x10, 0xAD, 0x99, 0x06, 0xAF, 0xE4, 0x09, 0x3A, 0xE1, 0x12, 0x9F, 0xD0,
-    0xE4, 0x7B, 0xC1, 0x24, 0xE4, 0x3D, 0x77, 0xCE, 0x20, 0xB8, 0x0D, 0x58, 0x3E, 0x62, 0x13, 0x7F,
-    0xC2, 0x8C, 0xE4, 0x80, 0x80, 0x64, 0xA5, 0x93, 0x48, 0x08, 0xEE, 0x02, 0x02, 0x7B, 0x1D, 0xEC,
-    0x0F, 0x80, 0x7B, 0xF0, 0x0A, 0x11, 0x10, 0x78, 0x0E, 0x7F, 0x00, 0x83, 0x38, 0x84, 0x04, 0x81,
-    0xFB, 0x60, 0xB8, 0xEB, 0xB5, 0xBB, 0xBB, 0x78, 0x3D, 0xBB, 0xB6, 0x84, 0xE1, 0x12, 0x52, 0x58,
-    0xB5, 0xBA, 0xA6, 0xA7, 0x5F, 0x57, 0x57, 0xBD, 0x7A, 0x35, 0x4B, 0x44, 0x94, 0x05, 0x12, 0xEC,
-    0x89, 0xD9, 0xE4, 0xCC, 0x87, 0x2C, 0x9D, 0xEA, 0xAA, 0x95, 0x1F, 0x79, 0xD5, 0xAA, 0x0B, 0x2F,
-    0x36, 0x06, 0xAB, 0xAE, 0x3A, 0xC3, 0x9E, 0x64, 0xAE, 0x35, 0x9B, 0x94, 0x1D, 0xED, 0xAC, 0xA9,
-    0xC8, 0x7F, 0xEC, 0xDF, 0x21, 0x79, 0xD1, 0x7B, 0xF5, 0xF8, 0x76, 0x2A, 0x89, 0x52, 0x4F, 0xA4,
-    0x3B, 0x92, 0xD1, 0x73, 0x47, 0x3A, 0x90, 0xBC, 0xEC, 0xC4, 0xAB, 0x40, 0xA7, 0x45, 0x27, 0xCF,
-    0x82, 0xE8, 0x8B, 0xAE, 0x3A, 0xE1, 0x13, 0x66, 0xD6, 0xCC, 0x2F, 0xA7, 0x07, 0x7F, 0x50, 0x1A,
-    0x88, 0x8A, 0x8E, 0x68, 0x4A, 0x7B, 0x8B, 0xA3, 0x8C, 0x39, 0x65, 0x6E, 0xC2, 0x74, 0x02, 0x5F,
-    0xB2, 0x85, 0x8F, 0x35, 0xA2, 0xEB, 0x0A, 0x8E, 0x5E, 0x1B, 0x92, 0x86, 0x84, 0x9B, 0x24, 0x5C,
-    0x7C, 0xCA, 0x9F, 0x30, 0x7F, 0x05, 0xE4, 0xCE, 0x31, 0xD2, 0xB8, 0xCF, 0x24, 0xD9, 0x08, 0x66,
-    0xE2, 0x9F, 0x26, 0xB9, 0x19, 0x5C, 0xAA, 0x6F, 0xAC, 0x08, 0xDC, 0x2B, 0xE6, 0x55, 0xCC, 0xA4,
-    0x51, 0x17, 0x2E, 0x8D, 0x09, 0x3D, 0xE7, 0xA7, 0x0E, 0xB7, 0x94, 0x05, 0xB7, 0xF4, 0xE0, 0x19,
-    0x2D, 0x16, 0x0B, 0x40, 0xBE, 0x67, 0x7E, 0xB5, 0x38, 0x71, 0x94, 0xE0, 0x20, 0x97, 0x54, 0x35,
-    0xA4, 0x5A, 0x82, 0x23, 0x69, 0x69, 0xE4, 0x48, 0x04, 0x4A, 0x18, 0x1B, 0xC3, 0xDB, 0xC2, 0xD0,
-    0xDB, 0x13, 0x1A, 0x7E, 0x59, 0x28, 0x33, 0x0E, 0x88, 0x2F, 0x26, 0x75, 0xE6, 0x85, 0xCB, 0xBB,
-    0xAA, 0xE6, 0x4B, 0x04, 0x62, 0x49, 0x71, 0x1B, 0x29, 0xF5, 0x23, 0xA7, 0x9A, 0x62, 0xB8, 0xBA,
-    0xAB, 0x10, 0xAF, 0x8D, 0x07, 0x76, 0xAE, 0xB6, 0xC7, 0x29, 0x63, 0x9F, 0x80, 0x7C, 0xD5, 0xE9,
-    0x43, 0x27, 0x22, 0x72, 0xE5, 0x44, 0x44, 0x7E, 0xC7, 0xEC, 0x25, 0xEB, 0x66, 0xEF, 0x89, 0x23,
-    0xAA, 0x6A, 0xCA, 0xFB, 0xDD, 0x25, 0x92, 0xE3, 0x46, 0x82, 0xD3, 0xE5, 0x33, 0xA2, 0x2F, 0x88,
-    0xDC, 0x76, 0xCC, 0xF8, 0x48, 0xB3, 0xC3, 0xB8, 0x7D, 0x83, 0xDD, 0xD9, 0x62, 0xFB, 0x72, 0x33,
-    0xB0, 0xC4, 0x85, 0xD3, 0xE9, 0x87, 0x5B, 0x24, 0xCA, 0x64, 0xF3, 0xC6, 0x8F, 0x4C, 0x51, 0x7B,
-    0x61, 0xF2, 0x46, 0xA7, 0x2E, 0xEB, 0x8A, 0x46, 0x27, 0x6E, 0x64, 0x64, 0xAB, 0xEA, 0x8A, 0x7C,
-    0xE2, 0x52, 0x7B, 0x1A, 0x8D, 0xE8, 0x33, 0x20, 0x54, 0x19, 0x52, 0x0B, 0x4C, 0x7D, 0x9A, 0x5A,
-    0xD9, 0xA9, 0x87, 0x2E, 0x33, 0x98, 0x64, 0x7B, 0x0A, 0x5F, 0xA5, 0xF8, 0x8D, 0x5B, 0xA5, 0x79,
-    0x9F, 0x3F, 0x43, 0x0E, 0x6A, 0x65, 0x53, 0xA7, 0xEA, 0x62, 0xD5, 0xC3, 0x94, 0x77, 0x4C, 0x43,
-    0x37, 0xD4, 0xFD, 0x6B, 0xE1, 0xD1, 0xDE, 0x3C, 0xF3, 0x82, 0x9F, 0xB3, 0xAF, 0xF8, 0xE2, 0xCA,
-    0xBF, 0x5B, 0xB4, 0xC2, 0xA3, 0x30, 0x7F, 0x9F, 0xEE, 0x95, 0xF1, 0xA6, 0x03, 0x8B, 0x5B, 0x5A,
-    0x66, 0x27, 0x7F, 0xE5, 0x87, 0x0D, 0x0A, 0x28, 0xFB, 0x6D, 0x4D, 0x05, 0xDF, 0x8C, 0xF8, 0x3C,
-    0xDD, 0x07, 0x06, 0xB2, 0x84, 0x1A, 0xBE, 0x9E, 0x4E, 0x27, 0x89, 0x7E, 0x91, 0x0C, 0xC2, 0x63,
-    0x5A, 0xE7, 0x76, 0x28, 0x42, 0xD6, 0xD3, 0x47, 0x51, 0x68, 0x35, 0xA1, 0xBE, 0xBB, 0xBA, 0xA7,
-    0xA8, 0x13, 0xE1, 0xDE, 0xA3, 0x6A, 0x15, 0x96, 0x0E, 0xE7, 0x1E, 0xE1, 0xA2, 0x64, 0x31, 0xFF,
-    0xBF, 0x07, 0xFE, 0x73, 0x3D, 0xB0, 0x51, 0x4B, 0xA3, 0x96, 0xFD, 0x5B, 0x04, 0x96, 0x54, 0x73,
-    0xC0, 0x06, 0x72, 0xD2, 0x25, 0x83, 0xF4, 0x73, 0x93, 0xFF, 0xCE, 0x1A, 0x02, 0x51, 0xE9, 0x7A,
-    0xA7, 0x4E, 0xF4, 0x5C, 0x70, 0x10, 0x61, 0xF9, 0x43, 0x48, 0x9C, 0x26, 0x55, 0x0D, 0xCC, 0xBF,
-    0xF6, 0x88, 0x8B, 0x22, 0xDD, 0x8F, 0xF8, 0x12, 0xA5, 0xB6, 0xB4, 0x7C, 0x01, 0xAF, 0xF3, 0x98,
-    0xAF, 0xBA, 0xE6, 0x91, 0x1D, 0xF5, 0xC0, 0x9E, 0x9B, 0xD4, 0x31, 0x15, 0xE7, 0x46, 0xC4, 0x93,
-    0x2B, 0x9B, 0xF5, 0x51, 0x9F, 0x1A, 0x45, 0x59, 0xCE, 0x69, 0x56, 0xEE, 0x3D, 0x01, 0xFF, 0xD2,
-    0x30, 0x55, 0x4F, 0xDB, 0xD8, 0x2C, 0x92, 0x37, 0x32, 0xE4, 0x52, 0x60, 0xA5, 0x1F, 0x77, 0x79,
-    0xA7, 0xF7, 0xC1, 0xF1, 0xAC, 0xDC, 0x9D, 0xDF, 0x0F, 0xA5, 0x64, 0x2F, 0x7E, 0xE1, 0xB6, 0x44,
-    0x75, 0x49, 0xDF, 0x9B, 0x1E, 0xC4, 0x30, 0xC0, 0x79, 0x20, 0x5D, 0xA0, 0x89, 0x83, 0x6E, 0x50,
-    0xBF, 0xE4, 0xB4, 0xA4, 0x31, 0x91, 0x80, 0xD8, 0x21, 0xC6, 0x5B, 0xA3, 0x6B, 0xB4, 0x3B, 0xB4,
-    0x66, 0x21, 0xA6, 0x95, 0x7B, 0x73, 0xBB, 0x9F, 0x7D, 0x9E, 0x1C, 0x8D, 0xD1, 0x86, 0x90, 0x94,
-    0x40, 0x13, 0x49, 0x48, 0x5C, 0xD5, 0x71, 0x39, 0xDB, 0xB7, 0x19, 0x38, 0x84, 0x9F, 0x8F, 0x2D,
-    0xF9, 0xAA, 0x16, 0xD7, 0x31, 0x5C, 0x03, 0xC9, 0x18, 0x62, 0x69, 0x84, 0xCD, 0x3B, 0xD9, 0x15,
-    0xA8, 0x82, 0x6A, 0x8E, 0x69, 0x5C, 0x8F, 0xEF, 0xFC, 0xCF, 0x0C, 0xD3, 0xFB, 0xF3, 0x71, 0x06,
-    0x2F, 0xE2, 0x35, 0xC2, 0x36, 0x10, 0xF0, 0x20, 0xB5, 0x10, 0x25, 0x14, 0x45, 0x64, 0x45, 0x8C,
-    0xAB, 0x1C, 0x22, 0x13, 0xF6, 0x4D, 0x8F, 0xE3, 0x72, 0x5C, 0xEE, 0xD5, 0xE3, 0xC1, 0x4B, 0xF4,
-    0x71, 0xE8, 0x37, 0x12, 0xB4, 0xFF, 0x90, 0x4C, 0x34, 0x1B, 0x74, 0x0F, 0x74, 0x07, 0xF4, 0xBE,
-    0x83, 0xB4, 0x6B, 0x75, 0x83, 0x8E, 0x06, 0xCC, 0x45, 0xBD, 0x63, 0xEF, 0x1A, 0xDF, 0xC4, 0x0F,
-    0xBA, 0xBB, 0xCC, 0x11, 0xED, 0x84, 0x92, 0xF9, 0xDB, 0xAB, 0x2F, 0x41, 0x04, 0xCF, 0x13, 0xEE,
-    0x09, 0xB5, 0x29, 0x1C, 0x65, 0x2F, 0x29, 0x3F, 0xBF, 0xC6, 0xE7, 0xC7, 0x3C, 0xC0, 0x37, 0x6E,
-    0x42, 0x05, 0x09, 0x43, 0xFA, 0xB8, 0xE2, 0x9F, 0x39, 0x64, 0x78, 0xA2, 0xBF, 0x4C, 0x15, 0xD8,
-    0x37, 0xA3, 0xF5, 0x9F, 0x95, 0x58, 0x3D, 0x8F, 0xDD, 0xC6, 0x15, 0x1D, 0x3E, 0x4A, 0x22, 0x20,
-    0x02, 0x61, 0x0A, 0x29, 0x80, 0xA3, 0x82, 0x69, 0x93, 0x14, 0x6C, 0x52, 0xA4, 0x89, 0x86, 0xF1,
-    0x16, 0x2E, 0x52, 0x68, 0x8B, 0x5D, 0xB9, 0x50, 0xE1, 0x26, 0x85, 0x63, 0x04, 0xD8, 0x3F, 0x60,
-    0x85, 0x8C, 0x5D, 0xAA, 0xD0, 0x02, 0x89, 0x6B, 0xAB, 0x48, 0xE1, 0x3C, 0x15, 0x9B, 0x1F, 0x20,
-    0x98, 0x94, 0x85, 0xC4, 0x85, 0x0A, 0x3D, 0x41, 0xA5, 0x0B, 0x3D, 0x40, 0x12, 0x6C, 0xCB, 0xC5,
-    0x8E, 0x22, 0x2A, 0xE6, 0xEE, 0x92, 0x73, 0x73, 0xCE, 0x1D, 0xBE, 0xB7, 0x2B, 0x5B, 0x71, 0xEC,
-    0x87, 0xDD, 0xB9, 0xC3, 0x99, 0xE1, 0x7C, 0xDC, 0x8F, 0x73, 0xCF, 0xD0, 0x18, 0xFE, 0xCE, 0xC8,
-    0x81, 0x31, 0xA9, 0x48, 0x6B, 0x32, 0x11, 0xC7, 0x5A, 0x67, 0x62, 0x79, 0xF2, 0x47, 0x33, 0x93,
-    0x05, 0xBA, 0x65, 0x89, 0xC2, 0x76, 0x28, 0xB2, 0x61, 0x36, 0x9F, 0xFF, 0x45, 0x22, 0x91, 0x5E,
-    0xDA, 0x4A, 0xBC, 0x75, 0xB9, 0xC8, 0xF5, 0x31, 0x11, 0x34, 0xFE, 0x59, 0x6A, 0xD3, 0x74, 0xD5,
-    0x92, 0x73, 0xF8, 0xF9, 0x4C, 0xF0, 0x6B, 0x0B, 0x14, 0x0E, 0xA3, 0x65, 0x30, 0xD1, 0x8E, 0x9F,
-    0x1B, 0x93, 0x78, 0xCC, 0x12, 0x61, 0xA4, 0x31, 0xD5, 0x8B, 0x2D, 0x63, 0xF0, 0x7A, 0x6D, 0x12,
-    0xC1, 0x0A, 0x9C, 0x13, 0x8D, 0x82, 0x01, 0xD1, 0xE6, 0x39, 0x2E, 0x98, 0x60, 0xED, 0x78, 0x79,
-    0x0B, 0xCF, 0xCD, 0x5E, 0xCB, 0x41, 0xBE, 0x8C, 0x75, 0x2A, 0x4E, 0x5D, 0x5A, 0xF1, 0xE2, 0x32,
-    0xD9, 0xDF, 0xC0, 0x6E, 0x9E, 0x75, 0x17, 0x8D, 0x1D, 0x8B, 0x78, 0x11, 0xCB, 0xFB, 0xEE, 0x5D,
-    0x53, 0x75, 0x17, 0xD3, 0x36, 0x95, 0x78, 0x31, 0x98, 0xC6, 0x5D, 0xCD, 0xEA, 0x54, 0xD2, 0xDB,
-    0x1D, 0xAA, 0x43, 0x8E, 0xA3, 0x65, 0xEF, 0x39, 0x54, 0x3B, 0x8B, 0x09, 0x3F, 0x8C, 0x97, 0xC6,
-    0x7A, 0x77, 0x15, 0xC7, 0x94, 0xA4, 0xC5, 0x5E, 0x96, 0xB7, 0x4E, 0x9B, 0x46, 0x3E, 0xFC, 0x6A,
-    0xC9, 0x75, 0x3C, 0x0F, 0x82, 0x8D, 0xE5, 0xAC, 0x1A, 0xAE, 0x6E, 0xF2, 0x0D, 0x87, 0xDD, 0xB8,
-    0x8B, 0xD8, 0x5D, 0xC1, 0xDD, 0x9D, 0xF8, 0x45, 0x8D, 0xEC, 0xF2, 0x85, 0x11, 0x47, 0x90, 0x41,
-    0x8F, 0x1C, 0xCB, 0xC1, 0x95, 0x2E, 0x85, 0x52, 0x7F, 0x96, 0x09, 0xDF, 0x18, 0x79, 0xA8, 0x81,
-    0x45, 0xCF, 0xE3, 0x77, 0xA7, 0xCB, 0xB7, 0x1B, 0x97, 0x3D, 0x18, 0x51, 0x7C, 0x3E, 0xA0, 0x90,
-    0xE3, 0x02, 0x3B, 0xCC, 0x30, 0x53, 0x97, 0x0D, 0x18, 0xCC, 0x62, 0x40, 0x51, 0x78, 0x14, 0x99,
-    0x5C, 0x1A, 0x4E, 0xC1, 0x40, 0xE3, 0x2D, 0xD5, 0x45, 0xD0, 0xAD, 0x65, 0x01, 0x05, 0x61, 0x4B,
-    0xA7, 0x37, 0xA9, 0x49, 0x19, 0x67, 0xAF, 0x2C, 0x5A, 0x63, 0xBE, 0xA3, 0xC0, 0x2C, 0xDF, 0x2A,
-    0x9E, 0xCE, 0x3F, 0xFA, 0xC6, 0xB8, 0x8A, 0x86, 0x3A, 0x2E, 0xFE, 0xE7, 0x7C, 0x6B, 0xBD, 0xD4,
-    0x74, 0xA8, 0xDE, 0x14, 0xF4, 0xAA, 0x8A, 0xFE, 0x25, 0xE3, 0x95, 0xA5, 0x81, 0x2C, 0x4D, 0x70,
-    0xAF, 0x55, 0xF1, 0x13, 0x79, 0xB2, 0xCD, 0x11, 0xB2, 0x2E, 0x7C, 0xE8, 0x88, 0x58, 0xBC, 0xD4,
-    0x21, 0xA1, 0x2D, 0xE2, 0x42, 0x31, 0xDD, 0x29, 0xA5, 0x63, 0xB1, 0xC3, 0x37, 0xAF, 0x28, 0x74,
-    0x2B, 0xCD, 0xB4, 0x25, 0x3F, 0xED, 0x6C, 0x0C, 0x32, 0x86, 0x49, 0xCE, 0x97, 0x17, 0x0E, 0x12,
-    0x7F, 0x68, 0xAA, 0xFB, 0x22, 0xF7, 0x60, 0xF4, 0xEA, 0x73, 0xFA, 0x98, 0xF4, 0x95, 0x0A, 0x19,
-    0x2A, 0x39, 0x12, 0x39, 0x14, 0x5F, 0x71, 0xF1, 0xBA, 0xF0, 0x15, 0x75, 0x0E, 0x5B, 0x54, 0xB4,
-    0x0A, 0x65, 0x4F, 0xF3, 0xA6, 0x52, 0x75, 0xA6, 0x18, 0x5E, 0x2D, 0xED, 0x24, 0xAB, 0x49, 0x4A,
-    0x90, 0xD1, 0x24, 0xE3, 0x49, 0x26, 0x93, 0xCC, 0x26, 0x99, 0x4F, 0xB2, 0xD8, 0xA7, 0x84, 0xEF,
-    0xD4, 0xE6, 0x55, 0x87, 0x99, 0x0D, 0x2F, 0x79, 0x63, 0x22, 0x65, 0xDC, 0x73, 0x29, 0xDB, 0x26,
-    0xD2, 0xE2, 0x84, 0xD5, 0xA8, 0x55, 0xC7, 0xAA, 0xB0, 0x7A, 0xD4, 0xB1, 0x5A, 0xD5, 0xA8, 0xFE,
-    0x67, 0x88, 0x87, 0x33, 0xCD, 0xFE, 0xD3, 0xE6, 0x0B, 0xEA, 0x4A, 0xEE, 0xEA, 0x89, 0x2F, 0x1C,
-    0x34, 0x6F, 0x8E, 0x65, 0xF5, 0x7E, 0x87, 0x01, 0xBD, 0xBD, 0x33, 0xA4, 0xDA, 0xAA, 0x03, 0xFE,
-    0x25, 0x4F, 0x45, 0xBE, 0x48, 0xFA, 0xF4, 0x39, 0x66, 0xA8, 0xAB, 0x0A, 0x03, 0xE2, 0x23, 0x56,
-    0x0B, 0x41, 0x95, 0x07, 0xAA, 0xEA, 0x8C, 0x55, 0xA3, 0xD5, 0x44, 0xAB, 0x96, 0x1A, 0xFB, 0x52,
-    0x37, 0x27, 0xA2, 0xF1, 0x4F, 0xFF, 0xA5, 0xE5, 0x19, 0x65, 0x74, 0x17, 0x3B, 0x49, 0x59, 0xE4,
-    0xA2, 0xDD, 0x65, 0xCE, 0xC3, 0x21, 0x0E, 0x6C, 0x1F, 0x3B, 0xE2, 0x8F, 0x2C, 0x8B, 0x16, 0xDD,
-    0xB0, 0xB7, 0xB0, 0x3B, 0xF3, 0xC9, 0xC0, 0xEE, 0xA6, 0x2B, 0x5E, 0x6C, 0x59, 0x68, 0xEA, 0x53,
-    0x38, 0xD7, 0x64, 0xF2, 0x3B, 0x90, 0xFF, 0xC6, 0x3F, 0xB1, 0xE8, 0x34, 0x90, 0x06, 0x93, 0xEF,
-    0x1A, 0x4C, 0x2F, 0x5F, 0x6E, 0xE2, 0x55, 0xBE, 0x4D, 0x30, 0xE3, 0xDB, 0x58, 0xD8, 0x05, 0x70,
-    0x63, 0x37, 0x21, 0x67, 0xD5, 0x3D, 0x4E, 0xDD, 0x32, 0x68, 0x77, 0x83, 0xC9, 0xD5, 0x53, 0x31,
-    0x79, 0xC9, 0xE7, 0x49, 0xF5, 0xE7, 0xD7, 0x07, 0xB3, 0xE1, 0x40, 0x94, 0xFD, 0x24, 0xC7, 0x49,
-    0x8A, 0x4A, 0x97, 0x4F, 0x12, 0xF6, 0x39, 0xEB, 0x4B, 0xEB, 0xB0, 0x50, 0x23, 0x3D, 0xE5, 0xEB,
-    0x12, 0xE4, 0x1B, 0x88, 0x12, 0xF6, 0xA7, 0x72, 0xD9, 0x71, 0x3C, 0xB6, 0xF0, 0x63, 0xCE, 0xC3,
-    0xAD, 0x40, 0x02, 0x4F, 0x4A, 0x5D, 0x07, 0xB6, 0xA4, 0x6C, 0x63, 0x38, 0xB7, 0x3D, 0xC2, 0xD6,
-    0x1B, 0x59, 0x58, 0xA7, 0x70, 0x85, 0xF7, 0x1A, 0x87, 0x18, 0x1C, 0xAC, 0x23, 0xD2, 0x54, 0x90,
-    0x70, 0x42, 0x1C, 0xD7, 0x12, 0x54, 0x82, 0x94, 0xB3, 0x25, 0x65, 0x22, 0x97, 0x0E, 0x1B, 0x5D,
-    0xF7, 0x9E, 0xAE, 0x3B, 0x93, 0x87, 0xC2, 0x79, 0x8C, 0x20, 0x00, 0x4A, 0x3D, 0x14, 0x00, 0xC5,
-    0xB6, 0x33, 0x29, 0xE1, 0x05, 0xD0, 0x7C, 0x99, 0xAA, 0xA8, 0xB3, 0xDE, 0x02, 0x24, 0xDB, 0xAC,
-    0x2B, 0x96, 0xB0, 0x6F, 0xE6, 0x72, 0x4C, 0xD5, 0xE6, 0x10, 0xE9, 0xFE, 0x22, 0x77, 0x99, 0xCB,
-    0x1E, 0x2E, 0x8A, 0x65, 0xD6, 0x65, 0x9F, 0x2D, 0x55, 0xDC, 0x75, 0x76, 0x91, 0xF6, 0xF9, 0xA7,
-    0xCE, 0xB6, 0x93, 0x68, 0xE4, 0xD8, 0xA1, 0x64, 0x9C, 0x44, 0x3C, 0xD8, 0x8D, 0xA1, 0x29, 0x67,
-    0x63, 0xF5, 0x3A, 0x44, 0x34, 0x56, 0xD1, 0x80, 0x40, 0xF7, 0x0D, 0x85, 0xF1, 0x8D, 0x19, 0x21,
-    0x70, 0x5E, 0x4F, 0x58, 0x18, 0xF9, 0x67, 0x1A, 0x98, 0x7F, 0xE0, 0x19, 0xF9, 0xB7, 0x12, 0xF4,
-    0xB5, 0x5E, 0x61, 0x16, 0x7F, 0x98, 0xFA, 0x6F, 0x50, 0x86, 0x55, 0x2C, 0x6F, 0x1E, 0x72, 0x1D,
-    0x53, 0x7C, 0x4D, 0xE1, 0xD2, 0x51, 0x16, 0x51, 0x03, 0x58, 0xAC, 0x1C, 0x4C, 0xDE, 0x36, 0x0F,
-    0xF9, 0xAE, 0x43, 0x67, 0x2C, 0xE9, 0x88, 0xCE, 0x56, 0x6E, 0xC3, 0x2E, 0x15, 0xF4, 0x59, 0x2D,
-    0xD1, 0x99, 0x0D, 0x79, 0xAF, 0x9D, 0x89, 0x9F, 0x3A, 0xDF, 0xFB, 0x21, 0x9D, 0xCF, 0xB5, 0x33,
-    0x1B, 0xD0, 0xC9, 0x6C, 0x06, 0xE3, 0x70, 0xD5, 0xEB, 0x44, 0xF6, 0x04, 0x2E, 0xC5, 0x70, 0x90,
-    0x25, 0x3A, 0xB9, 0x33, 0x74, 0xF2, 0x29, 0x1B, 0x32, 0xCD, 0x3B, 0x4C, 0xD1, 0x7F, 0x67, 0x59,
-    0x68, 0x98, 0xC3, 0xBA, 0xE6, 0xEC, 0x4D, 0x3A, 0x5D, 0xA5, 0x99, 0x95, 0x6F, 0x10, 0xFE, 0x03,
-    0x18, 0x32, 0x86, 0x88, 0x14, 0x3F, 0xBD, 0xA1, 0xD0, 0xD3, 0x63, 0x74, 0x83, 0x5C, 0xD9, 0x6A,
-    0x04, 0xAB, 0x2F, 0x02, 0xD6, 0xFB, 0x84, 0xC9, 0x13, 0xDE, 0xD3, 0x5A, 0xB8, 0xB9, 0x10, 0x8D,
-    0x8B, 0x81, 0xEF, 0x56, 0xCC, 0x3E, 0x80, 0x55, 0xCB, 0x5D, 0xB1, 0x39, 0x47, 0xF3, 0x82, 0xF9,
-    0x48, 0x47, 0xE7, 0xB2, 0xA8, 0xA6, 0x49, 0x14, 0x6D, 0x39, 0xF7, 0x33, 0xBE, 0xE6, 0x11, 0x36,
-    0xE6, 0x74, 0x69, 0x5E, 0x4E, 0x8A, 0xF3, 0xF9, 0xFC, 0x23, 0xA2, 0x3F, 0xA7, 0x9F, 0xC2, 0xFB,
-    0x02, 0x02, 0x91, 0xAF, 0xD2, 0x63, 0x69, 0x91, 0x90, 0x15, 0x6E, 0xC2, 0x64, 0xDE, 0x9C, 0x36,
-    0xF9, 0xA8, 0x88, 0x10, 0xE2, 0x7F, 0xCA, 0x08, 0x9A, 0x86, 0xA9, 0x1E, 0x35, 0xE6, 0x38, 0x65,
-    0x17, 0x2A, 0x21, 0x40, 0x88, 0x70, 0x8A, 0x10, 0x6B, 0x95, 0x92, 0x14, 0x06, 0x66, 0x18, 0x64,
-    0x47, 0x55, 0xC6, 0xC1, 0x95, 0xD6, 0xE8, 0x26, 0x32, 0xEE, 0x9B, 0xB3, 0x90, 0xF3, 0x10, 0x85,
-    0xA2, 0x2D, 0x1E, 0x13, 0x83, 0x89, 0xD0, 0x50, 0x4A, 0x09, 0xCD, 0x11, 0x94, 0x11, 0x5F, 0x25,
-    0x9C, 0x87, 0x78, 0x4C, 0x30, 0xC5, 0x2A, 0x80, 0x60, 0xAA, 0x64, 0x43, 0xB8, 0x0A, 0x36, 0x9E,
-    0xC8, 0x5B, 0xF4, 0xB8, 0xAF, 0xB1, 0x4D, 0xF5, 0x5E, 0x55, 0xAF, 0xD3, 0x2A, 0xA6, 0x96, 0xA7,
-    0xBB, 0x89, 0xDC, 0xD3, 0x1D, 0x55, 0x4E, 0x5F, 0xAB, 0x51, 0xCD, 0x07, 0x9D, 0xCC, 0xE9, 0xBC,
-    0x25, 0x97, 0x18, 0xD6, 0xAB, 0x65, 0x5C, 0xD8, 0x54, 0xDC, 0x03, 0xAD, 0xC2, 0x79, 0x3E, 0x64,
-    0xA1, 0x99, 0xE8, 0x80, 0x85, 0xD7, 0xC6, 0x3A, 0xD0, 0x87, 0xCC, 0x9F, 0xE2, 0xF9, 0xAF, 0xB7,
-    0x04, 0x24, 0x47, 0x6C, 0x70, 0x54, 0xDC, 0x72, 0xF2, 0x80, 0x88, 0x35, 0x98, 0xF9, 0x57, 0x58,
-    0xD0, 0x57, 0x93, 0x73, 0xF4, 0x7C, 0xFB, 0x9C, 0x95, 0x95, 0x8E, 0x52, 0x6A, 0x20, 0xE7, 0xC8,
-    0x82, 0x80, 0x55, 0x30, 0x4F, 0xC6, 0x0F, 0xD8, 0x58, 0x06, 0xCA, 0xD7, 0xAF, 0x46, 0xAE, 0x7F,
-    0x3B, 0x64, 0x8A, 0x13, 0x78, 0xF7, 0x2B, 0x34, 0x0F, 0xA8, 0x97, 0xCB, 0x04, 0x77, 0xF1, 0xE1,
-    0x76, 0x13, 0x08, 0x00, 0xB9, 0x48, 0x48, 0x4C, 0xDB, 0x9B, 0x59, 0xC0, 0x13, 0xDB, 0xE9, 0xD6,
-    0x14, 0x7D, 0x95, 0x0C, 0x51, 0xFF, 0xA9, 0xC2, 0x22, 0xAC, 0x10, 0x85, 0xF7, 0x30, 0x02, 0x5A,
-    0x0B, 0xA4, 0x33, 0x1F, 0xA6, 0xD1, 0x89, 0x4C, 0xA3, 0x31, 0xEE, 0xCC, 0xA1, 0x1A, 0x58, 0x00,
-    0x90, 0x3D, 0x47, 0xDB, 0x1E, 0xEE, 0x55, 0x63, 0x74, 0x31, 0xE6, 0xBE, 0x71, 0x39, 0x79, 0x52,
-    0x36, 0xC4, 0x3E, 0x65, 0x92, 0xDE, 0x00, 0x46, 0xBC, 0x07, 0xC8, 0x92, 0x4F, 0x10, 0xF9, 0x4B,
-    0xA6, 0x17, 0x44, 0x20, 0x70, 0xEC, 0x90, 0x90, 0xB9, 0x8C, 0x47, 0x6E, 0x7C, 0x91, 0x8D, 0x89,
-    0x9A, 0xB0, 0xA5, 0xAA, 0x36, 0x48, 0x30, 0x49, 0x80, 0x6A, 0x24, 0x3A, 0x6C, 0x67, 0x7F, 0xC2,
-    0x42, 0xBB, 0xDC, 0x0A, 0x6A, 0xC8, 0xBB, 0x55, 0xA2, 0x5D, 0xE5, 0xDD, 0x99, 0xAC, 0x54, 0xB4,
-    0xE6, 0x3E, 0x76, 0x69, 0xBE, 0x31, 0x3A, 0xFD, 0xF6, 0x68, 0xA5, 0xC3, 0x9D, 0x2A, 0xB4, 0x65,
-    0xD1, 0x6B, 0x38, 0xC3, 0x47, 0x3B, 0x68, 0xD5, 0xF6, 0x79, 0x8F, 0x24, 0x14, 0x7B, 0x46, 0x03,
-    0xEC, 0x02, 0x62, 0x82, 0xC6, 0xA1, 0xE8, 0xC8, 0x63, 0x31, 0x97, 0x3C, 0x82, 0x71, 0xAC, 0xC7,
-    0xEE, 0x12, 0x0D, 0x2E, 0x2D, 0x68, 0xD0, 0x53, 0x31, 0xDC, 0x21, 0xAE, 0xA1, 0xE0, 0xC8, 0x51,
-    0xF1, 0x3E, 0xA3, 0xD3, 0x7D, 0x0A, 0xFB, 0x20, 0x57, 0x90, 0x96, 0x8F, 0x4D, 0x97, 0xED, 0xFB,
-    0xCC, 0xA7, 0xCF, 0x00, 0x3C, 0x77, 0xFA, 0xA2, 0xAE, 0xC0, 0x02, 0x5A, 0xDA, 0x7A, 0x53, 0xE9,
-    0x14, 0x23, 0x7F, 0x82, 0x1B, 0x36, 0x46, 0x57, 0xD8, 0xA8, 0x86, 0xB6, 0x34, 0x5F, 0x16, 0xDC,
-    0x6B, 0x97, 0xDE, 0xB5, 0x6B, 0x42, 0x24, 0xAB, 0xF6, 0x34, 0x16, 0x50, 0xBD, 0xCC, 0x60, 0x75,
-    0x04, 0x55, 0xFA, 0xC7, 0x3D, 0xC5, 0xFA, 0x3D, 0x99, 0xEF, 0x49, 0x8D, 0xB8, 0x95, 0x05, 0xED,
-    0x32, 0x06, 0x4A, 0x21, 0xC7, 0x9C, 0x03, 0xAD, 0x04, 0xEC, 0x17, 0x3B, 0xA2, 0x93, 0x29, 0x38,
-    0xF4, 0xAC, 0x12, 0xE8, 0x09, 0x77, 0xC1, 0x4F, 0x18, 0xF9, 0xDF, 0x59, 0xC5, 0x7E, 0x6F, 0xA8,
-    0xD3, 0x2C, 0xF4, 0x6E, 0x83, 0x6D, 0x46, 0xEA, 0xAE, 0x76, 0x05, 0x24, 0xBC, 0x3D, 0xC8, 0x1E,
-    0x60, 0x70, 0x1C, 0xA3, 0xDD, 0x5C, 0xDE, 0x87, 0xFE, 0x9B, 0x01, 0xA3, 0x19, 0x78, 0x60, 0xF9,
-    0x62, 0xB8, 0x60, 0x17, 0x77, 0x74, 0x32, 0x34, 0x67, 0x8A, 0x78, 0x96, 0x17, 0x8F, 0x01, 0x14,
-    0x4A, 0xE4, 0x39, 0x9A, 0xB9, 0xE9, 0xD2, 0xEE, 0x0B, 0xF8, 0xDF, 0x98, 0x0F, 0xD5, 0x10, 0x23,
-    0xD0, 0xA5, 0xCB, 0xEE, 0xC3, 0xCB, 0x9C, 0x7D, 0x03, 0x5A, 0x75, 0x68, 0x4E, 0xE5, 0xE8, 0x90,
-    0x40, 0x4B, 0xD5, 0x68, 0xA9, 0x07, 0x1B, 0xC8, 0xB5, 0x09, 0xEB, 0xF9, 0x63, 0xF5, 0x13, 0x75,
-    0xAE, 0xC0, 0x14, 0xC6, 0x10, 0x49, 0xB5, 0x9E, 0xC5, 0x69, 0xA0, 0x8D, 0xEA, 0x22, 0xDA, 0xD4,
-    0x68, 0x93, 0x3D, 0x62, 0x53, 0x7E, 0xC0, 0xA6, 0x6C, 0xB4, 0x8A, 0x83, 0xE9, 0xA8, 0x31, 0x1E,
-    0x48, 0xCF, 0x3A, 0xAF, 0x22, 0x78, 0x18, 0x51, 0xB0, 0x20, 0x46, 0xBD, 0x29, 0x1F, 0xBC, 0xE5,
-    0xB7, 0x42, 0x47, 0xA1, 0xE5, 0x3F, 0x9B, 0x83, 0xED, 0xB7, 0x64, 0x33, 0x1F, 0xF4, 0x9C, 0x30,
-    0x73, 0x45, 0x42, 0x82, 0x39, 0xF9, 0x12, 0x9A, 0xB8, 0x1A, 0x72, 0x58, 0x47, 0x1F, 0x60, 0x18,
-    0x92, 0x25, 0x90, 0x65, 0xBB, 0x13, 0x57, 0x9E, 0x33, 0x0A, 0x49, 0xCA, 0xC8, 0x03, 0x26, 0x14,
-    0x7E, 0x0F, 0x6F, 0x3F, 0x0E, 0xD7, 0x9D, 0xC0, 0xED, 0xB3, 0x70, 0x84, 0xC5, 0x3B, 0xF3, 0x79,
-    0xE3, 0xAF, 0x1D, 0xEF, 0xEF, 0x36, 0x70, 0x62, 0xDC, 0x62, 0x66, 0x50, 0x16, 0x38, 0x01, 0x69,
-    0xF0, 0x85, 0x1D, 0xDC, 0x3C, 0xE6, 0xB5, 0x9E, 0x37, 0x20, 0x90, 0xA2, 0x06, 0x33, 0xC3, 0x6B,
-    0x60, 0x5E, 0xDB, 0xCD, 0x22, 0x56, 0xB8, 0x29, 0x14, 0x7D, 0x9A, 0x09, 0xD6, 0x89, 0x4D, 0xE7,
-    0xCB, 0x63, 0x07, 0x98, 0xD0, 0x9F, 0xD0, 0x16, 0xAE, 0x2B, 0x52, 0xB2, 0x50, 0x74, 0x5D, 0x58,
-    0xB9, 0x74, 0x1F, 0xF8, 0x01, 0x2B, 0x23, 0x42, 0xC6, 0x60, 0x7B, 0x60, 0x13, 0xEC, 0xAD, 0xA6,
-    0x87, 0xEF, 0x6B, 0x66, 0xB4, 0x84, 0x63, 0x34, 0xC2, 0xF0, 0x4A, 0xE2, 0x49, 0xF3, 0x4B, 0x0B,
-    0x74, 0x58, 0xA0, 0x91, 0x66, 0xE7, 0x20, 0x26, 0x25, 0x07, 0x3B, 0x5A, 0x9F, 0x2D, 0xCE, 0xD1,
-    0xE8, 0x5E, 0x71, 0xB1, 0xCE, 0x8E, 0xDD, 0x18, 0x26, 0x7F, 0xBC, 0xBA, 0x74, 0xA8, 0xC5, 0xE9,
-    0x9D, 0x45, 0x4B, 0xE2, 0x9E, 0x21, 0x24, 0x14, 0x4A, 0x1A, 0xAA, 0x9D, 0xB6, 0x8A, 0xE4, 0xC9,
-    0xCE, 0xB8, 0xFD, 0xBA, 0x5A, 0xE9, 0x51, 0xB8, 0x8A, 0x68, 0xE9, 0x7F, 0x89, 0x8B, 0x88, 0x9F,
-    0x97, 0x95, 0xA3, 0xA7, 0xE7, 0xC3, 0x4C, 0xA9, 0x04, 0x7D, 0x1F, 0x26, 0x63, 0xB4, 0xFE, 0xC0,
-    0x0E, 0x89, 0xEA, 0x0A, 0xCC, 0x4D, 0x88, 0x98, 0xD0, 0x61, 0x42, 0xB8, 0x14, 0x5A, 0x3F, 0xF8,
-    0x5B, 0xB4, 0x75, 0xF2, 0x82, 0x4B, 0x8F, 0x8D, 0x02, 0xDA, 0x57, 0x1A, 0x93, 0x81, 0xB9, 0xCF,
-    0xE4, 0x70, 0xAF, 0x57, 0xD2, 0x75, 0x61, 0xCA, 0xDA, 0xD3, 0xC7, 0x82, 0x70, 0x31, 0x23, 0x40,
-    0x05, 0xC8, 0xD3, 0xA3, 0x67, 0x41, 0x54, 0x2B, 0xB7, 0xEE, 0xB5, 0x4B, 0xED, 0x3C, 0x0B, 0x04,
-    0x61, 0x1A, 0x18, 0xCB, 0xF2, 0xED, 0xB3, 0xBB, 0x7F, 0xC8, 0xC4, 0x7E, 0x2D, 0xFB, 0x83, 0x7D,
-    0xBE, 0x7F, 0x28, 0x7B, 0x0F, 0xE4, 0xD7, 0x63, 0xBA, 0xBC, 0x6A, 0x1F, 0xED, 0xB7, 0x57, 0xE3,
-    0xCF, 0xC7, 0x7C, 0x4C, 0x60, 0x45, 0x58, 0xD3, 0x5F, 0x51, 0x22, 0x42, 0x2F, 0x48, 0x3F, 0x13,
-    0x1A, 0xFC, 0x56, 0xF2, 0xE4, 0x63, 0xD8, 0x1E, 0xC3, 0x96, 0x7C, 0x58, 0xFC, 0x26, 0xB0, 0x70,
-    0xB9, 0xBE, 0xD6, 0x68, 0x7F, 0x32, 0xA5, 0xAE, 0x7F, 0xDB, 0xF8, 0x6D, 0xBD, 0x72, 0xE4, 0xF9,
-    0xCB, 0xF2, 0x62, 0xBB, 0x3C, 0x91, 0x13, 0x27, 0x9C, 0x7C, 0x39, 0x51, 0x7E, 0xEF, 0x46, 0xFA,
-    0xE1, 0x67, 0x2B, 0xEA, 0xBB, 0x88, 0xC4, 0x4D, 0xBA, 0x83, 0xAD, 0xDE, 0xB9, 0x29, 0x4F, 0xAF,
-    0xAD, 0xBB, 0x4C, 0x88, 0x3C, 0xA2, 0x7B, 0x67, 0xDE, 0x09, 0x08, 0xA2, 0x6C, 0x1F, 0x66, 0x5C,
-    0x84, 0x0F, 0x0A, 0xFA, 0x36, 0x2F, 0x06, 0xFA, 0x34, 0x0B, 0x00, 0x5D, 0x2A, 0x1D, 0xA6, 0x1A,
-    0xA7, 0xA7, 0x66, 0xF5, 0x14, 0x98, 0x51, 0xB7, 0x0A, 0xCC, 0x58, 0x7E, 0xFB, 0x0F, 0x34, 0x7E,
-    0x35, 0xA8, 0x8A, 0x88, 0x3E, 0x9E, 0x91, 0xF8, 0x58, 0xF1, 0xFE, 0x14, 0xDA, 0xBA, 0x1D, 0xF3,
-    0xA3, 0x4B, 0x53, 0x7A, 0x72, 0x81, 0x37, 0x29, 0x5F, 0xA0, 0x29, 0x8B, 0xA3, 0x23, 0x70, 0xA6,
-    0x71, 0x97, 0xB7, 0xB2, 0x92, 0x57, 0xB4, 0x96, 0xDF, 0x2D, 0x08, 0x23, 0x45, 0xCF, 0x9B, 0x1C,
-    0x12, 0x0E, 0x2E, 0x66, 0x58, 0xA8, 0x0A, 0xF8, 0x50, 0x1A, 0x2D, 0x6C, 0x08, 0x79, 0xC6, 0xEB,
-    0xF6, 0x09, 0xCE, 0x58, 0x05, 0x4A, 0x91, 0xAB, 0x3B, 0x98, 0x78, 0x19, 0x2E, 0xBB, 0xEF, 0x46,
-    0x9A, 0x36, 0xD3, 0x36, 0xD7, 0xCC, 0xFA, 0x71, 0x88, 0xA1, 0x00, 0x77, 0x8F, 0x83, 0x59, 0xA5,
-    0x9F, 0x85, 0x9B, 0xBA, 0x4B, 0x83, 0x6C, 0x2F, 0x04, 0x1C, 0x0C, 0x01, 0xB7, 0x83, 0x6B, 0x11,
-    0x81, 0xE8, 0x4F, 0x78, 0x8C, 0xDB, 0x1B, 0xF0, 0x89, 0xFC, 0xBE, 0x2F, 0xCA, 0x8B, 0x40, 0x08,
-    0x50, 0xE3, 0x84, 0x08, 0xBF, 0x27, 0x9E, 0x09, 0x75, 0xD9, 0x5C, 0x22, 0x02, 0x76, 0xB3, 0x45,
-    0xB1, 0xBB, 0x72, 0xE6, 0x15, 0x87, 0xB1, 0x55, 0xC8, 0xE3, 0xB7, 0xC5, 0xDF, 0xEC, 0x14, 0x59,
-    0xC2, 0x1D, 0x49, 0x3F, 0x6C, 0x84, 0xAF, 0x0F, 0x3A, 0x3E, 0xA0, 0xF4, 0x9A, 0x0D, 0x5B, 0x37,
-    0x31, 0x26, 0xF3, 0xFD, 0x1F, 0xAF, 0xC8, 0x5F, 0x43, 0x78, 0xE8, 0xE7, 0x30, 0x91, 0x29, 0x05,
-    0x2A, 0xC0, 0xE6, 0x7A, 0x32, 0xE4, 0xB1, 0xCE, 0x3E, 0x83, 0x56, 0x01, 0x56, 0x28, 0x7A, 0xC5,
-    0xF8, 0x19, 0xAE, 0x1D, 0x60, 0xE9, 0x50, 0x37, 0xB4, 0xCF, 0x5B, 0xDC, 0x23, 0x92, 0x49, 0x93,
-    0x7A, 0x58, 0x06, 0x8F, 0xCD, 0x73, 0x7D, 0xE4, 0xDD, 0xC3, 0xFC, 0xE2, 0x86, 0xA9, 0x9E, 0x4F,
-    0x8C, 0x2A, 0x2C, 0xFA, 0x7F, 0x1E, 0xF9, 0x19, 0xEF, 0x4B, 0x3D, 0x6C, 0xA0, 0x46, 0x5E, 0xAB,
-    0xFD, 0xF4, 0x9D, 0x8F, 0x5F, 0x18, 0x94, 0xBF, 0x2D, 0x0B, 0x72, 0xAF, 0x40, 0xCE, 0x58, 0xF5,
-    0xA8, 0xC2, 0x23, 0x8B, 0xF1, 0xF2, 0x04, 0xFA, 0xD7, 0xD6, 0x3C, 0xB9, 0xA7, 0x02, 0x0F, 0x90,
-    0x97, 0x70, 0x27, 0x0F, 0x54, 0x43, 0x49, 0xFB, 0x99, 0xC6, 0xCF, 0xEB, 0x00, 0xE9, 0x6B, 0x4A,
-    0x31, 0x9C, 0x1C, 0x70, 0xB2, 0x0A, 0x8D, 0x65, 0xFA, 0x31, 0xC1, 0xA9, 0x8D, 0xEC, 0x5E, 0x1B,
-    0x0C, 0x52, 0x87, 0x9D, 0xD6, 0x26, 0x64, 0x5D, 0xB8, 0xDE, 0x9E, 0x7E, 0x38, 0x74, 0xD0, 0x5C,
-    0x2E, 0x36, 0xBB, 0x47, 0xDA, 0xE3, 0x86, 0xAA, 0xAF, 0x7A, 0x9B, 0xDD, 0x41, 0xCE, 0xD9, 0x70,
-    0x43, 0x31, 0x34, 0xCE, 0x66, 0xB7, 0x71, 0x05, 0xC6, 0x6C, 0xB9, 0x07, 0xA0, 0x67, 0x2D, 0xA8,
-    0x5F, 0xEC, 0xA0, 0x5C, 0x65, 0x17, 0x2B, 0x7A, 0x51, 0x9D, 0x44, 0xB7, 0x70, 0x25, 0x0B, 0x7C,
-    0x09, 0xDA, 0xAA, 0x83, 0x03, 0x97, 0xC1, 0x21, 0x90, 0xC3, 0xA2, 0xE0, 0x97, 0xC1, 0x6A, 0x2F,
-    0x3D, 0x18, 0xF3, 0xFB, 0xD7, 0x10, 0x05, 0x77, 0x10, 0x92, 0xC3, 0xC5, 0x50, 0xA9, 0xA4, 0xE1,
-    0xA1, 0xBD, 0x9E, 0x39, 0x5D, 0x29, 0x2A, 0xC5, 0x7B, 0x5D, 0x03, 0x9C, 0xBE, 0x86, 0x3B, 0x42,
-    0xCF, 0xCA, 0xEF, 0x68, 0xF7, 0xC6, 0x15, 0x4A, 0x59, 0x17, 0x8D, 0x7E, 0x17, 0xC0, 0x69, 0xC3,
-    0xE0, 0xCB, 0xA2, 0x63, 0xEE, 0x22, 0x93, 0xE0, 0x44, 0x33, 0x56, 0x78, 0xB4, 0x98, 0x95, 0x66,
-    0x68, 0x40, 0x7B, 0xAF, 0x4D, 0x33, 0x2B, 0x05, 0x2B, 0x1B, 0xFA, 0xED, 0x4B, 0xDB, 0x30, 0x1F,
-    0xFD, 0x5C, 0x11, 0xFF, 0x31, 0x31, 0xB9, 0xE7, 0xA6, 0x6B, 0x7E, 0x7B, 0xC8, 0xE4, 0x90, 0x3B,
-    0x31, 0x9B, 0xA4, 0x29, 0x0A, 0x49, 0x0C, 0xD8, 0x44, 0xA1, 0xA6, 0x3B, 0x51, 0x51, 0xCD, 0xAC,
-    0xA0, 0xE8, 0x1C, 0xAE, 0x8C, 0x3B, 0x35, 0xCD, 0x1D, 0x4F, 0x19, 0x91, 0x2E, 0x3C, 0xF2, 0x2B,
-    0xEF, 0x71, 0xE0, 0x33, 0x88, 0xF9, 0xC9, 0x66, 0x60, 0xE5, 0x13, 0xDE, 0x1A, 0xFF, 0x0B, 0x63,
-    0x60, 0x00, 0x82, 0xFF, 0x40, 0xF0, 0x19, 0x44, 0x9C, 0x07, 0x11, 0xF6, 0x40, 0xFC, 0x03, 0x00,
-    0x45, 0xD0, 0xB1, 0x0D, 0x02, 0x31, 0x0C, 0x05, 0x50, 0xDB, 0x57, 0x50, 0x66, 0x84, 0x8C, 0xC0,
-    0x08, 0xC7, 0x3C, 0x34, 0x8C, 0x10, 0x36, 0x63, 0x05, 0x36, 0x20, 0xA2, 0xA4, 0x72, 0x41, 0x03,
-    0x8A, 0x62, 0xBE, 0x13, 0x47, 0x44, 0x72, 0xEE, 0xE5, 0xCB, 0x76, 0x71, 0x44, 0xFF, 0xC3, 0x35,
-    0x90, 0x03, 0x6C, 0x81, 0x1C, 0x60, 0x0B, 0xE4, 0x00, 0xDB, 0x77, 0x02, 0x23, 0x47, 0x07, 0x37,
-    0xA2, 0xE4, 0xC8, 0x3A, 0xF7, 0xB0, 0xDD, 0xCF, 0xB4, 0x57, 0x1F, 0x79, 0x74, 0x42, 0x33, 0x76,
-    0x58, 0xDB, 0x00, 0xEC, 0xB0, 0x9A, 0xAC, 0x7A, 0x60, 0x54, 0xAC, 0x8E, 0x60, 0x43, 0xE1, 0xDB,
-    0x69, 0x37, 0x7B, 0x02, 0x7A, 0xC0, 0x25, 0xA8, 0x53, 0xC1, 0x43, 0xC6, 0x2C, 0xDA, 0x01, 0x4D,
-    0x28, 0xC7, 0xEB, 0x86, 0xC0, 0xE1, 0xED, 0x0B, 0xE4, 0x78, 0x27, 0x0F, 0x80, 0x6B, 0xF6, 0x80,
-    0xA4, 0x53, 0xD1, 0x81, 0x26, 0x23, 0x20, 0xF9, 0x5C, 0x74, 0xC2, 0x66, 0x00, 0xE8, 0x42, 0xFC,
-    0x0E, 0xD1, 0x85, 0x71, 0xFF, 0x00,
+static const uint8_t notosans_18_boldBitmaps[40416] = {
+    0xD5, 0x9C, 0xBD, 0xAF, 0x26, 0xC7, 0x95, 0xDE, 0x9F, 0xEE, 0xD6, 0x4C, 0x03, 0x6A, 0xD8, 0x95,
+    0xE8, 0x02, 0x06, 0x07, 0x46, 0x3B, 0x5D, 0x6E, 0xD0, 0x7F, 0x81, 0x51, 0x2D, 0x12, 0x0B, 0x05,
+    0x0A, 0x78, 0x83, 0xB9, 0x32, 0xB0, 0x0A, 0xB4, 0x80, 0x9D, 0x98, 0x0B, 0x7B, 0x52, 0xC3, 0xC1,
+    0x56, 0x4B, 0x0A, 0x1C, 0x28, 0xD0, 0x2C, 0x60, 0x3B, 0x58, 0x05, 0xA4, 0x01, 0x06, 0xE4, 0x25,
+    0x60, 0x3A, 0xD8, 0xC0, 0x81, 0x80, 0x2A, 0x6A, 0xBC, 0x60, 0x30, 0x01, 0x9B, 0xA2, 0x0D, 0x06,
+    0x0C, 0xA6, 0x65, 0x51, 0xAB, 0x35, 0x15, 0x4C, 0x73, 0xD8, 0xE2, 0xF4, 0xCC, 0x54, 0xF5, 0xCF,
+    0x41, 0xF5, 0x7B, 0x3F, 0x48, 0x8A, 0xA4, 0x66, 0xA5, 0x91, 0xF8, 0xE2, 0x76, 0xD5, 0xDB, 0xF5,
+    0x56, 0x57, 0xD7, 0xC7, 0xA9, 0xF3, 0xF1, 0x9C, 0x53, 0xD7, 0xDF, 0xE7, 0x0E, 0x37, 0x92, 0xBF,
+    0xC7, 0x6D, 0xBA, 0xE8, 0x3E, 0xE0, 0x0D, 0xDA, 0xE8, 0x66, 0x6E, 0x6D, 0x66, 0xB5, 0x13, 0xDF,
+    0xBD, 0x2E, 0x49, 0xFF, 0xBE, 0xC1, 0x26, 0xEE, 0xF3, 0xCE, 0x56, 0x1C, 0xFB, 0xC9, 0xBF, 0xBB,
+    0x35, 0x9B, 0x9F, 0xFC, 0x3B, 0xA9, 0x4E, 0x6E, 0x74, 0xEF, 0xA4, 0x3A, 0xDA, 0x60, 0x6F, 0xC5,
+    0xEA, 0x90, 0x49, 0x4F, 0x0F, 0xCF, 0xF7, 0x92, 0x1B, 0xBC, 0x24, 0xDF, 0x23, 0x09, 0x21, 0x89,
+    0x62, 0x93, 0x44, 0x91, 0xA4, 0x62, 0x2B, 0xA3, 0x8A, 0x6F, 0x6D, 0xFF, 0x2A, 0x5D, 0x37, 0x00,
+    0xE9, 0x62, 0x7A, 0xF5, 0xD5, 0xED, 0xB5, 0x87, 0x2F, 0xAB, 0x5E, 0xCD, 0x2C, 0x35, 0x8B, 0x99,
+    0x25, 0x33, 0xB7, 0x93, 0xD4, 0xCE, 0xDD, 0x24, 0x0B, 0x30, 0x5F, 0x4C, 0x9F, 0xF6, 0xEF, 0xFB,
+    0xF7, 0x5F, 0x94, 0x0D, 0x6E, 0x90, 0x6C, 0xF0, 0xBD, 0xE4, 0x06, 0xCE, 0x5E, 0xEE, 0x2F, 0xBE,
+    0xBC, 0x4C, 0x92, 0xF4, 0x35, 0x49, 0xE5, 0x2C, 0xA9, 0x09, 0x52, 0xE1, 0x5F, 0x91, 0x3C, 0x8C,
+    0x2D, 0xF0, 0x16, 0x80, 0x01, 0x56, 0x1B, 0x7F, 0x7C, 0xF5, 0x75, 0x7E, 0x32, 0xAB, 0xE6, 0x9B,
+    0x41, 0x86, 0x1B, 0x92, 0x25, 0x4A, 0x8E, 0x55, 0x72, 0xD0, 0xAB, 0x83, 0xA0, 0x06, 0x46, 0x95,
+    0x10, 0xD4, 0xDC, 0x65, 0x50, 0xD7, 0x22, 0xFD, 0xB8, 0x4B, 0x43, 0x39, 0xFB, 0xFB, 0x0F, 0x9A,
+    0x37, 0x78, 0x01, 0x48, 0x0E, 0xF8, 0x19, 0xB0, 0x15, 0x1E, 0x06, 0x5D, 0x71, 0xBD, 0xA4, 0x1F,
+    0x5F, 0xEC, 0xC4, 0xC5, 0x4F, 0xC1, 0x28, 0xD9, 0x20, 0xC3, 0x2A, 0xF9, 0xA0, 0x8E, 0x24, 0xD1,
+    0xCB, 0x3E, 0x42, 0xD5, 0x26, 0xB9, 0x40, 0x5F, 0x47, 0xC9, 0x07, 0x06, 0xB3, 0x4A, 0x0C, 0x3E,
+    0xB4, 0x73, 0xCE, 0xED, 0x98, 0x73, 0x1F, 0x72, 0x4E, 0x2F, 0xF9, 0xC1, 0x7F, 0x8F, 0xE2, 0xBA,
+    0x7C, 0xE0, 0xFB, 0xA9, 0x65, 0xB0, 0x6F, 0x61, 0x56, 0xC7, 0x64, 0xA1, 0x9D, 0x61, 0x31, 0x44,
+    0xFB, 0x33, 0x9E, 0x8B, 0x15, 0x8B, 0xFB, 0x09, 0x55, 0xD2, 0xF3, 0x3D, 0xCF, 0x6E, 0xD5, 0x26,
+    0x95, 0x54, 0xA9, 0xDA, 0xA4, 0x2A, 0x55, 0xA9, 0xDC, 0xA4, 0x26, 0xE6, 0xDC, 0x2C, 0xB9, 0xDC,
+    0x4E, 0xD5, 0x56, 0x25, 0xC9, 0x85, 0x92, 0x2A, 0x49, 0x0C, 0x05, 0x2F, 0x44, 0x15, 0x48, 0xB0,
+    0xA8, 0x4A, 0x92, 0x65, 0x52, 0x13, 0xA5, 0x86, 0x21, 0x8F, 0xEE, 0xF8, 0x6C, 0x9C, 0x57, 0x59,
+    0x24, 0xC9, 0x82, 0x24, 0x01, 0x41, 0x2A, 0x81, 0x49, 0xAA, 0x78, 0x8B, 0x59, 0xAA, 0x90, 0xBD,
+    0x94, 0xB9, 0x59, 0xAA, 0x18, 0x98, 0xA4, 0x82, 0x77, 0x09, 0xF9, 0xB9, 0xDC, 0x4A, 0x94, 0x24,
+    0xC7, 0xA4, 0x93, 0xE3, 0x12, 0x82, 0x98, 0x1B, 0x58, 0x0A, 0xC6, 0x16, 0x52, 0x49, 0xB0, 0x5B,
+    0xCB, 0xB3, 0x0C, 0x36, 0xD6, 0xBC, 0x8B, 0xDC, 0x52, 0xC0, 0x26, 0xB7, 0xC8, 0x11, 0xE5, 0x56,
+    0xB5, 0x2C, 0x72, 0x49, 0x0D, 0xB3, 0x2C, 0xFF, 0xC5, 0xB3, 0xA8, 0x05, 0xD8, 0xD4, 0x00, 0x30,
+    0x94, 0xC0, 0x3B, 0x4C, 0xEA, 0x78, 0x50, 0xB0, 0x4A, 0x27, 0x92, 0xE4, 0x7F, 0xB5, 0xF9, 0x5F,
+    0x26, 0xF7, 0x4E, 0xB2, 0xB7, 0xA2, 0xBD, 0x15, 0x65, 0x16, 0x31, 0x34, 0x51, 0x6E, 0xAA, 0x50,
+    0xBB, 0xCA, 0x87, 0x3D, 0x1F, 0x2B, 0x64, 0xA2, 0xEC, 0x54, 0x30, 0xD4, 0x49, 0xED, 0x22, 0x37,
+    0x16, 0xF4, 0x75, 0x52, 0xBB, 0xCA, 0x4D, 0x22, 0x54, 0xA8, 0x89, 0x6A, 0x17, 0xD9, 0x59, 0x84,
+    0x82, 0xA1, 0x42, 0x75, 0x92, 0x89, 0x32, 0xAB, 0xDA, 0xD9, 0x0D, 0x62, 0x28, 0xE8, 0x2B, 0x54,
+    0x6F, 0x32, 0x51, 0xDD, 0x5E, 0xB3, 0xA4, 0xCF, 0x05, 0x76, 0x3E, 0x6B, 0xA5, 0x9B, 0xE5, 0x43,
+    0xC9, 0x59, 0x69, 0xBD, 0xA9, 0x5B, 0xF2, 0xAF, 0xED, 0x9A, 0xEF, 0xED, 0x5C, 0x30, 0x98, 0x28,
+    0x17, 0xA4, 0xF2, 0x15, 0x49, 0x66, 0x91, 0x64, 0x47, 0x49, 0x48, 0xAA, 0xA2, 0xD4, 0x37, 0x73,
+    0xF1, 0x8D, 0x07, 0xDD, 0x4F, 0xE8, 0x80, 0xE8, 0x81, 0x0F, 0x01, 0xC2, 0x15, 0x1E, 0xF4, 0x6A,
+    0x98, 0xF3, 0x6C, 0x57, 0x9B, 0x1B, 0x65, 0x67, 0x42, 0xC1, 0x77, 0x09, 0x45, 0xAA, 0x56, 0xE9,
+    0x7F, 0xD4, 0x67, 0x8B, 0x7C, 0x5D, 0x52, 0xBD, 0x4A, 0x6A, 0x27, 0x49, 0x6E, 0x90, 0x8A, 0xED,
+    0x72, 0x51, 0x90, 0x03, 0x12, 0xC0, 0x7D, 0x80, 0x3B, 0xC0, 0xF6, 0x89, 0x5A, 0x9F, 0x78, 0xF0,
+    0xCA, 0x75, 0x93, 0xDA, 0xD8, 0xAE, 0xDD, 0x62, 0x67, 0x3B, 0xB9, 0xE0, 0x83, 0xEF, 0x4F, 0x4E,
+    0xBE, 0xC3, 0xE1, 0xF3, 0xEB, 0x93, 0x93, 0x6B, 0xDF, 0xE3, 0x4D, 0x5C, 0xE2, 0xD7, 0x0C, 0xD7,
+    0x25, 0x99, 0x28, 0xB5, 0x51, 0xEA, 0x16, 0xC9, 0xCE, 0x92, 0x9B, 0x24, 0x46, 0x89, 0xA0, 0x92,
+    0x41, 0x15, 0xBD, 0x6A, 0xA4, 0x66, 0xFB, 0x02, 0x55, 0xF5, 0x99, 0x55, 0xCF, 0x3F, 0xD7, 0x18,
+    0x25, 0x4F, 0x54, 0x05, 0xA8, 0x01, 0x82, 0xE1, 0x47, 0x8C, 0x5D, 0x12, 0xB3, 0x8D, 0x72, 0xB3,
+    0x5D, 0x65, 0x17, 0xB7, 0xC8, 0xAE, 0x6E, 0x96, 0x8D, 0x7E, 0x56, 0xF7, 0x39, 0x89, 0x9B, 0x65,
+    0xA3, 0x5B, 0x64, 0x57, 0xBB, 0xC8, 0xAE, 0x36, 0xCA, 0x2D, 0x6D, 0x12, 0xB3, 0xE1, 0x1B, 0x4C,
+    0x0D, 0x10, 0x2A, 0xA0, 0x17, 0x24, 0xA9, 0x65, 0xDA, 0x97, 0x41, 0x7E, 0x54, 0x97, 0x64, 0x18,
+    0x6B, 0x52, 0x09, 0xA3, 0x27, 0xD9, 0x8D, 0x77, 0xF8, 0x61, 0xEA, 0x46, 0xC6, 0xC5, 0x24, 0x89,
+    0x51, 0x8F, 0x9B, 0x49, 0xCA, 0x6F, 0x2B, 0x61, 0x93, 0x01, 0x06, 0x07, 0x8C, 0x96, 0x57, 0x99,
+    0xCD, 0x22, 0x96, 0x6A, 0x90, 0x5B, 0x24, 0xD9, 0xB3, 0xC4, 0xCD, 0x92, 0x98, 0xA5, 0x92, 0x51,
+    0xAA, 0x09, 0x92, 0x41, 0x92, 0x4D, 0x92, 0x58, 0xA4, 0x8A, 0x51, 0x32, 0xF4, 0x97, 0x8A, 0xCE,
+    0x6A, 0x1D, 0xE8, 0xF2, 0xE3, 0x89, 0x24, 0xA9, 0x84, 0x41, 0x1E, 0xA6, 0xF6, 0x20, 0x2A, 0x26,
+    0xFB, 0xFF, 0x6E, 0x10, 0xFE, 0x43, 0x7E, 0xB8, 0x8B, 0xFB, 0xFB, 0x4B, 0x82, 0x64, 0x92, 0x54,
+    0x30, 0xC9, 0x91, 0x54, 0xC0, 0xA0, 0x1A, 0x06, 0xB5, 0x30, 0xE9, 0xE8, 0x46, 0xE6, 0x48, 0xA3,
+    0x54, 0x33, 0x1C, 0x5E, 0x1D, 0xA5, 0x82, 0x5F, 0x4B, 0x86, 0xD7, 0xFE, 0xF3, 0x55, 0x92, 0x07,
+    0xFE, 0x2F, 0x40, 0x03, 0x4C, 0x57, 0x61, 0x95, 0xAE, 0x5C, 0xD7, 0x3E, 0xEB, 0x92, 0x5B, 0x25,
+    0xD9, 0x4D, 0x92, 0x65, 0x90, 0x3A, 0x26, 0x65, 0xFE, 0x6E, 0xD8, 0xA4, 0x06, 0x06, 0xD5, 0x89,
+    0x49, 0xD5, 0x66, 0x57, 0x95, 0x98, 0x4D, 0x05, 0xCF, 0x32, 0x88, 0x81, 0x49, 0x3E, 0xD8, 0x55,
+    0x6E, 0x34, 0x9B, 0xEC, 0x54, 0x31, 0x74, 0xB3, 0xF2, 0xA0, 0xF2, 0x7E, 0x49, 0x00, 0x38, 0x80,
+    0xBF, 0x3B, 0x39, 0x71, 0xE9, 0x58, 0x32, 0x9B, 0xA4, 0x8A, 0x41, 0x12, 0x93, 0x24, 0xBB, 0x4A,
+    0x32, 0x99, 0x95, 0x0D, 0x1D, 0x20, 0x20, 0x56, 0xC0, 0x6C, 0x80, 0x60, 0x17, 0x49, 0x04, 0xA9,
+    0x62, 0xDF, 0x27, 0x72, 0xB3, 0x54, 0xC0, 0xA6, 0xFA, 0xF0, 0x4C, 0xF0, 0xC0, 0xF0, 0x57, 0x7F,
+    0x03, 0x92, 0x5C, 0x3A, 0x0C, 0x2A, 0x4F, 0xCE, 0xB0, 0xBF, 0xD4, 0x2D, 0x37, 0x55, 0x71, 0xEB,
+    0xC1, 0x9F, 0x79, 0xCC, 0x61, 0xDA, 0x7B, 0x60, 0x91, 0x27, 0x49, 0xC5, 0xF5, 0xB3, 0x9D, 0x71,
+    0x83, 0x51, 0x35, 0x8C, 0xB2, 0x30, 0x0A, 0x18, 0x2B, 0xB6, 0x93, 0xA1, 0x39, 0x6B, 0xAA, 0x8D,
+    0x67, 0xA4, 0x32, 0x5F, 0xE9, 0xE5, 0x66, 0x92, 0xDC, 0x2F, 0x21, 0xF8, 0xBB, 0x30, 0x79, 0x60,
+    0xF1, 0xC8, 0xAF, 0x7E, 0xCD, 0xDB, 0xA6, 0xCD, 0x89, 0x3B, 0x4B, 0xEC, 0xAA, 0x2E, 0x76, 0x51,
+    0x76, 0x35, 0x7C, 0x9D, 0xA5, 0x01, 0xE6, 0x0A, 0x08, 0xF2, 0x20, 0x5D, 0x63, 0x91, 0x74, 0x22,
+    0x01, 0xC4, 0x4F, 0x4B, 0x2E, 0x53, 0xE9, 0x24, 0x15, 0x79, 0x8E, 0x06, 0xA9, 0xA6, 0xDF, 0x29,
+    0xC1, 0xA4, 0x03, 0x31, 0xD9, 0x55, 0x92, 0x3F, 0xD4, 0x2D, 0x73, 0xDD, 0x70, 0xB1, 0x6E, 0x9B,
+    0x76, 0xD2, 0xF9, 0x44, 0xDD, 0xF1, 0x9C, 0x61, 0x4C, 0xE7, 0xF3, 0x1E, 0x0C, 0x30, 0x75, 0x5B,
+    0x71, 0xE0, 0x15, 0x8B, 0xEC, 0x62, 0x57, 0xD9, 0xB9, 0x8B, 0xF2, 0xB3, 0xA1, 0x64, 0xAC, 0xB9,
+    0xCB, 0x50, 0xC0, 0x26, 0x39, 0x96, 0xAC, 0x9F, 0x54, 0x80, 0x0C, 0x77, 0x08, 0x5D, 0x2A, 0x99,
+    0xED, 0x22, 0xB7, 0x66, 0xFE, 0x31, 0xC9, 0xEC, 0xC9, 0xAC, 0x2E, 0xBA, 0x28, 0xB7, 0xDA, 0x03,
+    0x19, 0x8C, 0x99, 0x6B, 0x38, 0x56, 0xED, 0xE2, 0x2D, 0x77, 0x68, 0x50, 0x01, 0xAB, 0x6A, 0x40,
+    0x2D, 0x10, 0x2C, 0x3F, 0x62, 0xB4, 0x51, 0xCC, 0x7E, 0x96, 0x5B, 0xFC, 0x2C, 0xBB, 0x32, 0xA9,
+    0x8B, 0x4C, 0x17, 0x18, 0x95, 0x8D, 0x2E, 0x8A, 0x68, 0x79, 0x8D, 0xD8, 0x02, 0xB1, 0x81, 0x3B,
+    0xB1, 0x84, 0x76, 0xD5, 0x53, 0x2F, 0x75, 0xEB, 0xF9, 0xEA, 0x9E, 0x51, 0x51, 0xF8, 0x8A, 0x6E,
+    0xD0, 0x9B, 0x9D, 0x7F, 0xAC, 0x32, 0x30, 0xCA, 0x90, 0xA4, 0xE2, 0x44, 0x52, 0xBB, 0xF3, 0xF3,
+    0x85, 0xE1, 0xF8, 0xB2, 0xCA, 0x74, 0x75, 0xF2, 0x1F, 0x72, 0x07, 0x97, 0xDC, 0x74, 0xA4, 0x7A,
+    0x6A, 0xA3, 0x4D, 0x76, 0xEB, 0x92, 0x59, 0x8B, 0x5E, 0x9F, 0xF8, 0x7C, 0x9A, 0xE4, 0x38, 0xD3,
+    0xBD, 0xE6, 0x2C, 0x92, 0xD4, 0x22, 0xD5, 0xC4, 0xCC, 0x0C, 0x1C, 0xA3, 0x5A, 0x16, 0xD5, 0x24,
+    0x89, 0xAD, 0xCF, 0x9C, 0xAA, 0xE5, 0xA6, 0xD4, 0xB1, 0x4A, 0x0D, 0x5B, 0xAF, 0x02, 0x46, 0xE9,
+    0x46, 0xBE, 0x8F, 0x52, 0xC9, 0xA1, 0x2D, 0x5D, 0x53, 0xD6, 0x4D, 0xE0, 0xC1, 0x25, 0x31, 0xC7,
+    0xE5, 0x8E, 0x3D, 0x75, 0x7A, 0x7A, 0x7A, 0x7A, 0x59, 0x18, 0xFE, 0xDD, 0xC9, 0xC9, 0xC9, 0x89,
+    0x24, 0x15, 0xD3, 0x99, 0xF0, 0xDB, 0x24, 0x39, 0x86, 0x2C, 0x7E, 0xD5, 0xB2, 0x4A, 0x25, 0x9B,
+    0x24, 0x9F, 0x59, 0xCB, 0x28, 0x35, 0x04, 0xC9, 0x23, 0xDD, 0x60, 0x51, 0xC7, 0x03, 0x5D, 0xCB,
+    0x14, 0xD5, 0xCB, 0x31, 0xAA, 0x60, 0xDA, 0xDB, 0xFA, 0xE7, 0x97, 0x3B, 0x70, 0x8D, 0x07, 0xEA,
+    0x60, 0x6D, 0x80, 0xC9, 0x02, 0xCF, 0xF0, 0x5F, 0x89, 0xFF, 0x34, 0xD3, 0x72, 0x1B, 0xF7, 0x0D,
+    0xD0, 0xC5, 0x4C, 0xD3, 0x25, 0xB3, 0x44, 0x94, 0x2C, 0x92, 0x61, 0xC8, 0x8A, 0x6B, 0xB7, 0x48,
+    0x25, 0x92, 0xBA, 0xF9, 0x20, 0x77, 0x0E, 0x9F, 0xE6, 0xE6, 0xBE, 0x7B, 0x5C, 0xDC, 0x99, 0xBD,
+    0x8B, 0x52, 0x49, 0x2F, 0x5D, 0xE9, 0x77, 0xA6, 0x70, 0x73, 0x9F, 0xA9, 0x55, 0x52, 0x0B, 0x6C,
+    0x52, 0xC9, 0x76, 0xEA, 0x91, 0xBA, 0x4D, 0x6A, 0x51, 0xC9, 0x20, 0xD5, 0x9B, 0xDA, 0x45, 0x52,
+    0x9D, 0xC4, 0xD0, 0xF0, 0x5E, 0x13, 0x9B, 0x58, 0x40, 0x34, 0xB3, 0x1D, 0x3B, 0x98, 0xBB, 0xB7,
+    0x28, 0xF8, 0x85, 0x0F, 0xEE, 0x07, 0x8B, 0x89, 0x42, 0xD8, 0xE0, 0x42, 0x1D, 0xAB, 0x48, 0xB9,
+    0xA9, 0x9D, 0xCD, 0x87, 0xD1, 0x2C, 0x72, 0xC1, 0xBE, 0x39, 0xDB, 0xB1, 0x40, 0x9B, 0x0D, 0xF4,
+    0x4D, 0xAC, 0x57, 0xCA, 0x4D, 0x76, 0xB2, 0x6F, 0xC7, 0x3A, 0x96, 0xBC, 0x8E, 0x59, 0xCC, 0xE6,
+    0xB9, 0xBB, 0x74, 0x53, 0x4B, 0x82, 0xC1, 0x85, 0x96, 0x91, 0x55, 0x0C, 0x5F, 0xFD, 0x07, 0xFD,
+    0xF7, 0xBE, 0x24, 0x77, 0xBB, 0x3A, 0xCB, 0x47, 0xE9, 0xDF, 0x49, 0x15, 0x0F, 0xFF, 0xC6, 0x2F,
+    0x59, 0x9B, 0x65, 0x94, 0x0A, 0x0F, 0x5B, 0x9E, 0xE0, 0x87, 0xBD, 0x24, 0x75, 0x0C, 0x92, 0xAA,
+    0x83, 0xCE, 0x3A, 0x6A, 0x17, 0x04, 0x12, 0xCC, 0x92, 0xDA, 0x87, 0xF4, 0x52, 0xC5, 0x77, 0x56,
+    0x49, 0x76, 0x26, 0x48, 0x0D, 0x26, 0x49, 0x62, 0xF2, 0xB3, 0x64, 0x52, 0x8D, 0x54, 0x66, 0xCE,
+    0x6D, 0xD7, 0x92, 0xA0, 0x9A, 0xBE, 0x8D, 0x92, 0x9F, 0xC5, 0x24, 0x83, 0x0C, 0x2A, 0x00, 0x16,
+    0x75, 0x00, 0x43, 0x95, 0x59, 0x9A, 0x03, 0x18, 0x1B, 0xDE, 0x3F, 0xF5, 0x9B, 0x98, 0x25, 0xE6,
+    0x76, 0x93, 0x1A, 0x9E, 0x65, 0x94, 0xDC, 0x6A, 0xA3, 0x54, 0xF1, 0x06, 0x83, 0xD4, 0x25, 0x16,
+    0xA9, 0x60, 0xF6, 0x3C, 0xBC, 0x29, 0x0B, 0x8C, 0x06, 0xD8, 0x2A, 0x80, 0x91, 0x87, 0xAF, 0x11,
+    0x6D, 0x54, 0xC7, 0x73, 0xA8, 0xE4, 0x6D, 0x82, 0xFC, 0xC2, 0xAC, 0x2E, 0xDA, 0x28, 0x83, 0x41,
+    0x2D, 0xCF, 0xB2, 0xB3, 0xFF, 0x4D, 0x16, 0x98, 0x0C, 0x40, 0xC5, 0xFF, 0xF9, 0x36, 0x33, 0xB3,
+    0xBA, 0xCD, 0x46, 0x55, 0xBC, 0x89, 0xC4, 0x87, 0x04, 0xD9, 0xC8, 0xAC, 0x16, 0x1B, 0x65, 0x78,
+    0x93, 0xD3, 0xD7, 0x78, 0x1B, 0x60, 0x3E, 0xB3, 0xF4, 0x26, 0x03, 0xDB, 0xD9, 0x4E, 0xED, 0x78,
+    0x20, 0x79, 0x58, 0x0B, 0x60, 0x2B, 0xC8, 0x52, 0xED, 0x7D, 0x06, 0x36, 0x95, 0xA3, 0x4B, 0x07,
+    0x79, 0x6B, 0xD0, 0x2E, 0xB8, 0x33, 0x97, 0x65, 0x3E, 0xF0, 0x60, 0x83, 0x76, 0x0E, 0x7D, 0xA1,
+    0xB0, 0xA1, 0x97, 0x8A, 0x7C, 0x9F, 0xB4, 0xEF, 0xA4, 0x82, 0x24, 0xFD, 0x45, 0xC7, 0x83, 0x6F,
+    0xC7, 0x0A, 0x40, 0x16, 0x08, 0x25, 0x30, 0xAB, 0x81, 0x29, 0xCB, 0x7A, 0xCF, 0xC3, 0x63, 0x55,
+    0xEC, 0x8C, 0x6B, 0x1F, 0x33, 0x22, 0xCF, 0x59, 0x28, 0x49, 0x06, 0x89, 0x68, 0xA3, 0xC4, 0xC2,
+    0xAC, 0x92, 0x0F, 0x09, 0xFB, 0x0C, 0x18, 0x6C, 0x94, 0xBA, 0xC4, 0x2C, 0xF9, 0xFB, 0x04, 0x95,
+    0xDC, 0x41, 0x6A, 0x70, 0x67, 0xC5, 0x17, 0x6A, 0x77, 0xDB, 0x59, 0x23, 0x86, 0x5B, 0x7B, 0xDB,
+    0xAF, 0xEE, 0x9B, 0x76, 0x13, 0x07, 0x6E, 0xBE, 0xCA, 0xC0, 0x83, 0xBC, 0xA3, 0x36, 0x0F, 0x5C,
+    0xB8, 0x36, 0x3F, 0x67, 0x11, 0x74, 0xE9, 0x5A, 0x24, 0x9F, 0xD5, 0xA8, 0xF3, 0xEB, 0xD7, 0x27,
+    0xD7, 0x3F, 0xB5, 0xEE, 0x2C, 0xF9, 0x87, 0xA7, 0xA7, 0x1F, 0x6B, 0x97, 0xFD, 0x5D, 0x97, 0xAF,
+    0xDF, 0xF4, 0xFC, 0xFC, 0x5B, 0xBE, 0xEF, 0x63, 0xD7, 0x81, 0x6D, 0x7B, 0xDE, 0xCB, 0x83, 0x94,
+    0x01, 0xD6, 0x3C, 0x03, 0x86, 0xED, 0x55, 0xE4, 0xE9, 0xF5, 0x6F, 0x6A, 0x26, 0x49, 0x5D, 0xB6,
+    0x34, 0x67, 0xED, 0xEC, 0x47, 0x5D, 0xD2, 0x41, 0x0E, 0x57, 0x84, 0x1A, 0xDE, 0x44, 0x2D, 0xD8,
+    0x28, 0x47, 0x64, 0x2E, 0xE0, 0x1E, 0xE3, 0xD5, 0x57, 0xB9, 0xCD, 0xA0, 0x9A, 0x16, 0xA9, 0x8D,
+    0x36, 0x49, 0x6E, 0xF6, 0x51, 0x05, 0x81, 0xA8, 0x9A, 0x92, 0xED, 0xC4, 0x67, 0xC2, 0x98, 0x2B,
+    0x0E, 0x94, 0x81, 0xE4, 0xE1, 0xA6, 0x74, 0xE5, 0x24, 0x6B, 0x10, 0xEE, 0x1E, 0x41, 0x05, 0xEF,
+    0x22, 0xD5, 0xDC, 0x88, 0x52, 0x9B, 0xFC, 0x2C, 0xB9, 0x8F, 0x3E, 0xBB, 0xF8, 0xE4, 0xE4, 0xDB,
+    0xDC, 0x00, 0xB2, 0x8E, 0xC9, 0x47, 0x00, 0xBC, 0x0B, 0xC0, 0x8D, 0x74, 0x72, 0x72, 0xE3, 0x0B,
+    0x35, 0xF2, 0x19, 0xC5, 0xBD, 0x07, 0x07, 0x77, 0xE0, 0x23, 0x88, 0x0D, 0x8B, 0xFC, 0xAC, 0x2E,
+    0xAA, 0x41, 0x25, 0xE1, 0xB7, 0xB8, 0x71, 0x5B, 0x01, 0x2B, 0x87, 0xD6, 0x16, 0xD5, 0xBF, 0x6D,
+    0x0B, 0x5F, 0xF0, 0xC6, 0x46, 0x99, 0x4D, 0x86, 0xE7, 0xE0, 0x16, 0x4C, 0x30, 0x5B, 0xA6, 0xAB,
+    0x5B, 0x2F, 0x37, 0xAB, 0xE4, 0x5D, 0x24, 0x17, 0xFD, 0xAC, 0x96, 0x06, 0x55, 0x8C, 0x7E, 0x16,
+    0x4B, 0x83, 0xBA, 0x4D, 0x7E, 0xAE, 0x09, 0x0D, 0x05, 0xB3, 0xFC, 0x6C, 0x93, 0x1A, 0x0C, 0x83,
+    0xFC, 0x3D, 0xA6, 0x7D, 0xA3, 0xF9, 0x1D, 0xD2, 0x49, 0x92, 0xDF, 0x37, 0x37, 0x83, 0x7C, 0xB2,
+    0x49, 0x87, 0xC7, 0x0C, 0x43, 0x83, 0x6C, 0x94, 0x9F, 0x4B, 0xE6, 0x06, 0x19, 0x7A, 0x3F, 0xCB,
+    0xC5, 0x06, 0x95, 0x4C, 0x7E, 0x96, 0xE1, 0x9B, 0x87, 0x3E, 0x54, 0x4C, 0x7E, 0xCA, 0x9C, 0xC5,
+    0xB0, 0x33, 0x1B, 0xE6, 0xDF, 0x65, 0xC1, 0xE9, 0xE9, 0xAB, 0x7C, 0xEC, 0x13, 0x1D, 0x92, 0x3A,
+    0xEE, 0x66, 0xDB, 0xE9, 0x11, 0x51, 0xAA, 0xD9, 0x40, 0xAA, 0xC0, 0x33, 0x4A, 0x70, 0x37, 0xC3,
+    0x58, 0x8F, 0x36, 0x24, 0x7B, 0x77, 0xC3, 0x8D, 0x32, 0xF7, 0xF1, 0x77, 0x56, 0xD5, 0x91, 0xBB,
+    0x1F, 0xA1, 0x6A, 0xB3, 0x8F, 0x92, 0x1B, 0xC5, 0x73, 0x1B, 0xCF, 0xAD, 0x72, 0xB7, 0xF0, 0x6F,
+    0x23, 0xFB, 0x33, 0xEE, 0x2E, 0x2E, 0x98, 0xC5, 0x3D, 0x4A, 0x66, 0xAD, 0x63, 0xBB, 0xF1, 0x2C,
+    0xE5, 0x56, 0xE3, 0x47, 0x1F, 0xF8, 0x3A, 0x77, 0x17, 0xB3, 0xB8, 0xE0, 0x1E, 0xA5, 0x8A, 0x6E,
+    0x6A, 0x37, 0x7A, 0xFF, 0xE6, 0x52, 0xE3, 0xC7, 0x96, 0x58, 0x70, 0x77, 0xA9, 0xD8, 0xE4, 0x1E,
+    0x25, 0x79, 0xFA, 0x76, 0xA3, 0x6F, 0x09, 0x35, 0x7E, 0xAC, 0x98, 0x0A, 0xEE, 0x2E, 0x62, 0x91,
+    0x7B, 0x94, 0xD4, 0x46, 0xB5, 0xD1, 0x6D, 0x52, 0x45, 0xC7, 0x28, 0x71, 0x9B, 0x28, 0xD9, 0x7B,
+    0xD0, 0xCB, 0x44, 0xCF, 0xAC, 0x8A, 0x8E, 0x4D, 0xE2, 0x36, 0x04, 0xD9, 0x7B, 0xB8, 0x28, 0x13,
+    0xFD, 0x6D, 0xFA, 0x8A, 0x6E, 0x66, 0x16, 0xB7, 0x53, 0x97, 0x64, 0xEF, 0xF1, 0x2C, 0xC1, 0x44,
+    0x3F, 0xBA, 0xB5, 0xA2, 0x5B, 0x0C, 0xE2, 0x76, 0x2A, 0x98, 0xED, 0x3D, 0xFA, 0x2E, 0x99, 0xE8,
+    0xC7, 0x8A, 0x5B, 0x74, 0x8B, 0xFC, 0xCA, 0xED, 0x24, 0x83, 0xBD, 0x47, 0x5F, 0xF0, 0xAB, 0xE8,
+    0x47, 0x59, 0xE8, 0x16, 0xD5, 0x70, 0x3B, 0x49, 0x9E, 0x7B, 0xF4, 0x32, 0x44, 0x3F, 0xAA, 0x84,
+    0x6E, 0x91, 0x2C, 0xB7, 0x93, 0x54, 0x33, 0x9F, 0xEB, 0x4E, 0xDB, 0xAE, 0xB2, 0x48, 0x0D, 0x90,
+    0xB2, 0xF4, 0x5F, 0xE4, 0x79, 0xDF, 0x13, 0x0C, 0xA3, 0x3C, 0x25, 0xB3, 0x0A, 0x16, 0x9B, 0xA4,
+    0x86, 0xFF, 0x94, 0x35, 0x20, 0xBF, 0x4A, 0x15, 0xB7, 0xE9, 0x0F, 0x7C, 0x3E, 0x73, 0x7E, 0x75,
+    0x1B, 0xB3, 0x54, 0x70, 0xF7, 0xFC, 0xA6, 0xE4, 0xDD, 0x5C, 0x2D, 0x3F, 0xF3, 0x06, 0x41, 0xB2,
+    0x31, 0xB7, 0xF6, 0xBD, 0xDC, 0xB4, 0x21, 0xC8, 0x21, 0xCF, 0xDF, 0xFB, 0x2C, 0x02, 0xCE, 0xA4,
+    0x91, 0x3A, 0xA0, 0x97, 0xBA, 0x2C, 0x44, 0x8B, 0xEB, 0x92, 0x3C, 0x0F, 0xFB, 0xEA, 0x20, 0x99,
+    0x17, 0x0B, 0x2C, 0x00, 0x1F, 0x12, 0x1A, 0xEE, 0xA0, 0x06, 0x1F, 0x65, 0x36, 0x66, 0xD9, 0x47,
+    0x04, 0x71, 0x17, 0xD5, 0xF8, 0x28, 0x9B, 0x98, 0xAF, 0x65, 0x34, 0xE8, 0x39, 0x60, 0xB5, 0xC0,
+    0x00, 0x4C, 0x15, 0xEF, 0x1F, 0x9F, 0x1B, 0xC8, 0xCA, 0x18, 0x5E, 0xD0, 0x6F, 0x2C, 0xD2, 0x97,
+    0x70, 0xF6, 0x18, 0x25, 0x15, 0x37, 0x72, 0xF7, 0xB3, 0x06, 0x57, 0x65, 0x32, 0x30, 0x84, 0xAC,
+    0xCF, 0x65, 0xF8, 0x61, 0x95, 0xA4, 0x2B, 0x27, 0xBD, 0xE7, 0x61, 0x2F, 0xC3, 0x6E, 0xE6, 0x32,
+    0xE4, 0x06, 0x79, 0xE8, 0x99, 0x0D, 0x6A, 0x19, 0x98, 0xE5, 0x56, 0x83, 0x2A, 0x02, 0xB3, 0x6C,
+    0x34, 0xA8, 0xCA, 0xA5, 0x8B, 0x41, 0x2D, 0xE2, 0xA1, 0xCF, 0xBA, 0xD7, 0x2A, 0x20, 0xC9, 0x64,
+    0x78, 0xE7, 0xA1, 0x8F, 0x32, 0x14, 0x4C, 0x62, 0xCE, 0x1A, 0x9F, 0x8B, 0x62, 0x2E, 0x19, 0xF3,
+    0x1D, 0xB3, 0x7C, 0x6E, 0x77, 0x64, 0x56, 0x8B, 0x41, 0x62, 0x65, 0xCE, 0x7A, 0x6A, 0xD6, 0xB7,
+    0x27, 0x99, 0x5D, 0x63, 0x58, 0x0D, 0x30, 0x3A, 0x5E, 0xA5, 0x64, 0xD4, 0xDF, 0x9A, 0xED, 0x60,
+    0xA6, 0xE6, 0xB9, 0x9B, 0xA5, 0xFA, 0x0C, 0xB0, 0x30, 0xD0, 0xCB, 0x40, 0x50, 0x0D, 0x41, 0x05,
+    0x84, 0xDD, 0x26, 0xE9, 0xCE, 0x56, 0x3A, 0x23, 0x08, 0x6F, 0x8C, 0x32, 0xB4, 0xDB, 0xB7, 0x58,
+    0x1D, 0xF0, 0x3A, 0x90, 0x2A, 0x60, 0x2C, 0x60, 0x91, 0xAE, 0x1C, 0x67, 0x14, 0x87, 0x17, 0x3E,
+    0x0D, 0xCE, 0x08, 0x67, 0xC0, 0xC5, 0xA7, 0xA2, 0x19, 0xBF, 0x97, 0x42, 0x3F, 0x49, 0xEE, 0x43,
+    0x82, 0x4A, 0xDE, 0x44, 0x6A, 0xB2, 0x5A, 0x16, 0x99, 0x25, 0xFF, 0x3B, 0x2F, 0xEE, 0xA2, 0x64,
+    0xA3, 0x5B, 0x55, 0x30, 0xB3, 0xC8, 0xF0, 0x0C, 0xDB, 0xB7, 0x32, 0x30, 0x93, 0xC9, 0x2F, 0xA9,
+    0x02, 0x46, 0x15, 0x9E, 0x45, 0x79, 0xBA, 0xFC, 0x24, 0xD5, 0x74, 0x51, 0xAA, 0xB8, 0x45, 0x2F,
+    0x31, 0x31, 0x4B, 0x6E, 0xE9, 0xA2, 0xD4, 0xC5, 0x8A, 0x5E, 0x66, 0x13, 0x93, 0x6A, 0xD4, 0x45,
+    0x95, 0x84, 0x8A, 0x5E, 0x4C, 0x62, 0x92, 0x9B, 0xD5, 0x45, 0x75, 0x51, 0x15, 0xBD, 0xD9, 0x24,
+    0xA6, 0x1A, 0xA9, 0x8B, 0x25, 0x41, 0x15, 0x62, 0x92, 0x98, 0xEC, 0x2C, 0xB5, 0x31, 0xBF, 0xC0,
+    0x6C, 0x92, 0x78, 0x1B, 0x49, 0xED, 0x83, 0x0C, 0x68, 0xF8, 0xF1, 0xDC, 0x4A, 0x21, 0x4A, 0xAA,
+    0x48, 0xD9, 0x70, 0xC9, 0xF8, 0x5F, 0x38, 0xD8, 0x41, 0x7E, 0x52, 0xC9, 0xB0, 0xF7, 0x95, 0x59,
+    0x25, 0x6F, 0x90, 0x95, 0x6A, 0x26, 0x46, 0xB5, 0x0C, 0x19, 0xCC, 0x68, 0x98, 0xD5, 0xC6, 0x06,
+    0x55, 0x44, 0x35, 0x14, 0x04, 0x41, 0x5F, 0x31, 0xD8, 0x45, 0x8E, 0x49, 0x8C, 0x66, 0x53, 0xF7,
+    0x28, 0xCA, 0xCD, 0x25, 0xC1, 0x3C, 0x40, 0x6D, 0x94, 0x9B, 0xAB, 0x64, 0xC7, 0x66, 0x93, 0x89,
+    0x05, 0x26, 0x56, 0xF4, 0x15, 0xBD, 0xBF, 0x85, 0x08, 0xF2, 0x93, 0x9D, 0xFC, 0xE8, 0x66, 0xB5,
+    0xB1, 0x5D, 0xDA, 0xB5, 0x5B, 0x55, 0xD1, 0xC4, 0x0A, 0x93, 0xF2, 0x58, 0xFC, 0x2D, 0xA4, 0x6E,
+    0x65, 0x68, 0x3F, 0x20, 0xA8, 0xC6, 0x8E, 0x55, 0x72, 0x93, 0xC4, 0x9D, 0x59, 0xBC, 0xB6, 0x48,
+    0xF6, 0x51, 0x54, 0x47, 0x94, 0x9A, 0x6C, 0x35, 0x4B, 0x45, 0x86, 0x53, 0x07, 0xC9, 0x12, 0x64,
+    0xB3, 0x60, 0x9D, 0x33, 0x08, 0x5E, 0xB2, 0xAA, 0x20, 0xEE, 0xA0, 0x98, 0xDD, 0x0E, 0x92, 0xB9,
+    0x21, 0xC8, 0x30, 0xB0, 0xA8, 0x26, 0xB4, 0xA8, 0x62, 0x2C, 0x99, 0x4A, 0x26, 0xD9, 0x28, 0x66,
+    0xD5, 0x04, 0x16, 0xC9, 0x2F, 0x6E, 0x3D, 0xA8, 0xFF, 0x05, 0x24, 0x49, 0x1D, 0xD9, 0x32, 0x41,
+    0x07, 0x4B, 0x7F, 0x67, 0x2D, 0x86, 0x55, 0xCA, 0x76, 0xBC, 0x2A, 0x32, 0x2B, 0x65, 0x93, 0x0A,
+    0x7E, 0xCE, 0xA8, 0x8C, 0x28, 0xCB, 0xAF, 0x0D, 0x83, 0x5C, 0x14, 0x8B, 0x6C, 0x52, 0x8B, 0xBA,
+    0x4D, 0x15, 0x53, 0x8B, 0x64, 0x93, 0xA1, 0x57, 0xC3, 0x6D, 0x82, 0xC4, 0xEA, 0x17, 0x65, 0x14,
+    0x48, 0x2E, 0xDA, 0x24, 0x31, 0xB7, 0xA8, 0x60, 0x6A, 0xE8, 0x2B, 0x42, 0x45, 0xA8, 0x19, 0x32,
+    0x37, 0xD9, 0xCD, 0x44, 0xBF, 0xD8, 0x4C, 0xB2, 0xCB, 0x81, 0xDD, 0x1A, 0x32, 0x30, 0x9A, 0x89,
+    0x23, 0x1B, 0x4F, 0x9C, 0x73, 0x46, 0xB7, 0xEA, 0xB0, 0xBB, 0x1E, 0x2B, 0xED, 0x0E, 0x32, 0x26,
+    0x1B, 0x83, 0x0B, 0x40, 0xEA, 0x76, 0xE8, 0xA4, 0xA1, 0xDF, 0x4D, 0xBB, 0x2A, 0xBF, 0x7E, 0xCC,
+    0x20, 0xEE, 0xAE, 0xE2, 0x33, 0x2B, 0x1B, 0x34, 0x72, 0xF1, 0xC0, 0x94, 0xBA, 0x74, 0x40, 0x50,
+    0xCC, 0xA7, 0xB6, 0x10, 0xA4, 0x92, 0x87, 0xA7, 0xA7, 0x2F, 0x03, 0x60, 0x01, 0xDE, 0xE4, 0xE0,
+    0xF9, 0x88, 0x8E, 0x77, 0x48, 0x39, 0x19, 0xEB, 0xA4, 0xC7, 0x4F, 0x0E, 0xAD, 0x30, 0xFA, 0x29,
+    0x23, 0x60, 0x76, 0x91, 0xBA, 0x35, 0x83, 0xAF, 0x26, 0x49, 0xF5, 0x96, 0xD1, 0xD8, 0x92, 0x3E,
+    0xA3, 0x2E, 0x84, 0xBC, 0xF7, 0x0F, 0x95, 0xDB, 0xBD, 0x72, 0x93, 0xB2, 0x2F, 0x22, 0x57, 0x1E,
+    0x3E, 0xBB, 0xB2, 0x64, 0xF9, 0x39, 0x58, 0x3E, 0x04, 0xD9, 0xB9, 0x7A, 0xFC, 0xE4, 0xC3, 0xBD,
+    0x15, 0xCB, 0x24, 0xFD, 0x95, 0x0E, 0xBE, 0x23, 0x73, 0x66, 0x43, 0x57, 0x79, 0x6F, 0x24, 0x49,
+    0xB8, 0x20, 0xF9, 0x1F, 0x2E, 0x92, 0x7D, 0x1D, 0xA9, 0x9D, 0xEC, 0x28, 0x33, 0xD7, 0x51, 0x75,
+    0x14, 0x7D, 0x95, 0xD4, 0xCE, 0x05, 0xAA, 0x36, 0xD1, 0xCB, 0x05, 0x1B, 0x64, 0xD6, 0x6E, 0x52,
+    0xC1, 0x95, 0x63, 0xE9, 0xA8, 0x7F, 0xFA, 0xF4, 0xF4, 0xF4, 0xB9, 0x9D, 0x00, 0x96, 0xE7, 0x5F,
+    0x56, 0xB7, 0xA9, 0xA6, 0x2F, 0x18, 0x65, 0x67, 0x35, 0x51, 0xBA, 0xAE, 0xAB, 0xFE, 0x25, 0xD5,
+    0x90, 0x64, 0x21, 0xC9, 0x43, 0x2C, 0xB6, 0x6F, 0xB1, 0x94, 0x7D, 0xB1, 0xE3, 0x8A, 0x92, 0x41,
+    0x57, 0x4E, 0x89, 0x57, 0x81, 0xD9, 0x03, 0xB7, 0xD9, 0x5E, 0xC3, 0x26, 0xD9, 0xC4, 0x24, 0xEE,
+    0xD3, 0x57, 0xDC, 0x49, 0x6A, 0x71, 0xB1, 0xC8, 0xE8, 0xEF, 0x3D, 0xD8, 0xB8, 0x05, 0x3F, 0xA5,
+    0x24, 0xD5, 0x51, 0x27, 0x92, 0x9E, 0x7E, 0x51, 0xCA, 0x2E, 0x8C, 0xCF, 0x4B, 0xAE, 0xBD, 0x27,
+    0xB7, 0x40, 0xEF, 0xEE, 0xC3, 0xE8, 0x80, 0xD9, 0xF1, 0x2B, 0xA2, 0xDB, 0xE4, 0xA2, 0x8B, 0xEA,
+    0x92, 0x5B, 0x65, 0x36, 0xB7, 0xCA, 0xE0, 0x96, 0x4F, 0x49, 0x56, 0x99, 0xCD, 0x45, 0xB5, 0x9B,
+    0x4B, 0xB2, 0xC9, 0xF1, 0xD7, 0x44, 0x07, 0x2C, 0xB9, 0xA9, 0x9F, 0x43, 0x70, 0xA3, 0xDF, 0x24,
+    0x15, 0xBD, 0x54, 0xF8, 0xF7, 0x54, 0x42, 0x54, 0x06, 0x67, 0x59, 0x1B, 0x1E, 0x52, 0xB0, 0xE8,
+    0x2F, 0xBA, 0x6D, 0x1F, 0x7E, 0x86, 0x75, 0x86, 0xBC, 0xA9, 0x2E, 0x7C, 0xD9, 0x7F, 0x2A, 0x99,
+    0xF5, 0x15, 0xC3, 0xF8, 0x9D, 0xC1, 0xC3, 0x5A, 0x01, 0x43, 0x03, 0xAB, 0xAE, 0x9D, 0x83, 0xF6,
+    0x57, 0x5F, 0x91, 0xD4, 0xF0, 0x39, 0x49, 0xF3, 0xA0, 0x41, 0x9E, 0xDB, 0x94, 0xF0, 0x88, 0x26,
+    0x7B, 0xD3, 0x1F, 0x41, 0x4B, 0x6F, 0xB1, 0x29, 0xF3, 0x39, 0x83, 0x5D, 0xD5, 0x60, 0x57, 0xD5,
+    0x9F, 0x48, 0x62, 0x96, 0x96, 0x86, 0x6E, 0x53, 0x4B, 0xCB, 0xCD, 0xEC, 0x48, 0xA0, 0x82, 0x47,
+    0x14, 0xF0, 0x36, 0xEA, 0x28, 0x51, 0x71, 0x2C, 0xA9, 0xF0, 0x37, 0xA5, 0x6C, 0x0A, 0xEC, 0x4E,
+    0xAF, 0xD9, 0xF0, 0xD7, 0x7E, 0x6D, 0xB7, 0x2C, 0xC1, 0x4C, 0xB2, 0x51, 0xCD, 0x66, 0xB7, 0xD3,
+    0xD7, 0x36, 0x0B, 0x5C, 0x4C, 0xD6, 0x03, 0x9F, 0xB1, 0xF1, 0x9C, 0x25, 0x0C, 0xC5, 0xFF, 0xAC,
+    0x81, 0xB5, 0x04, 0x56, 0x39, 0x58, 0xD4, 0xC0, 0x4D, 0xE9, 0xE8, 0x58, 0xD2, 0xF3, 0x2F, 0xA9,
+    0xCC, 0xEF, 0x99, 0x4A, 0x58, 0x04, 0x31, 0xF3, 0xFA, 0x2D, 0x43, 0x80, 0x05, 0xBF, 0x38, 0xAE,
+    0x21, 0xD5, 0xC0, 0xD7, 0x81, 0xF1, 0x4F, 0x79, 0xF8, 0xA2, 0xEC, 0x92, 0x77, 0x74, 0x45, 0x9F,
+    0xFD, 0x64, 0x8F, 0x51, 0xA0, 0xE6, 0x41, 0x71, 0x22, 0xCF, 0x2D, 0x4A, 0xB8, 0x4F, 0x9D, 0xE7,
+    0xF5, 0x7D, 0x68, 0xD1, 0xF9, 0xBC, 0xFE, 0x86, 0x29, 0xDD, 0xE7, 0x75, 0x9F, 0xDC, 0x6E, 0x93,
+    0xA1, 0x65, 0x70, 0x67, 0xF3, 0x0A, 0x05, 0xBC, 0x8B, 0x3A, 0x1A, 0x54, 0x1C, 0x37, 0x1C, 0xB8,
+    0xA3, 0xD9, 0xFE, 0x89, 0x64, 0x93, 0x79, 0xF8, 0xE7, 0x44, 0x73, 0xD0, 0x10, 0x27, 0x03, 0xF4,
+    0xC5, 0x6B, 0xBC, 0xF7, 0xDB, 0x6C, 0x87, 0x07, 0x72, 0x0B, 0x04, 0x77, 0x1F, 0x66, 0x97, 0x59,
+    0xE9, 0x43, 0x92, 0x43, 0x76, 0x73, 0x49, 0xED, 0xE6, 0xE2, 0xBE, 0x1D, 0xF6, 0x64, 0x79, 0xAC,
+    0xE4, 0x6A, 0xCF, 0x1B, 0xBC, 0xB0, 0xD9, 0xC5, 0x0D, 0x92, 0x8E, 0x8E, 0x79, 0x9B, 0xE7, 0x92,
+    0x5D, 0x3E, 0x2B, 0xD3, 0xD5, 0x5E, 0x84, 0x9A, 0xA1, 0xDD, 0x64, 0x17, 0xB9, 0x3D, 0x4A, 0xE1,
+    0xE8, 0xB8, 0x60, 0xAC, 0xE9, 0xDB, 0x24, 0xB7, 0x3C, 0xD6, 0x57, 0x7F, 0xFF, 0x35, 0xDE, 0x04,
+    0xCB, 0x0C, 0xCF, 0x30, 0xE9, 0xE9, 0x97, 0xCE, 0x34, 0x4E, 0xBB, 0x7E, 0xFE, 0xD7, 0x2B, 0x27,
+    0xCF, 0x32, 0x14, 0xCC, 0x76, 0x95, 0x8B, 0x15, 0x43, 0x8B, 0xEC, 0x5A, 0x11, 0xB2, 0x61, 0x60,
+    0x17, 0x9B, 0x54, 0xF1, 0x1C, 0xBD, 0xEC, 0x47, 0x8C, 0xAA, 0xF0, 0x51, 0xD9, 0x93, 0x56, 0x01,
+    0x92, 0x85, 0xA8, 0x8A, 0x7B, 0x4C, 0xB2, 0xAB, 0xC9, 0xEA, 0x54, 0x94, 0x5D, 0x0B, 0xE6, 0x8A,
+    0xA1, 0x61, 0xB0, 0xAB, 0x6C, 0xAA, 0x0E, 0xAF, 0x68, 0x08, 0x4F, 0xFF, 0x37, 0xDE, 0xE1, 0x3B,
+    0xC9, 0xFD, 0xFA, 0x0B, 0x67, 0xCB, 0x51, 0x7F, 0xED, 0x81, 0xBE, 0xFA, 0x50, 0xEE, 0x2D, 0x08,
+    0x9E, 0xC9, 0xFD, 0x12, 0x3E, 0x24, 0x6B, 0xFA, 0x79, 0x8D, 0x1F, 0xC1, 0x43, 0x36, 0x87, 0x1C,
+    0x43, 0xB7, 0xB9, 0x28, 0x8B, 0x0C, 0x2E, 0xAA, 0xDB, 0x32, 0x97, 0xEB, 0x92, 0x1A, 0xDC, 0x92,
+    0x01, 0x9E, 0xDF, 0x57, 0x7E, 0xD4, 0x5F, 0x7B, 0x20, 0xF7, 0x16, 0x8C, 0xEE, 0x97, 0x3B, 0x0F,
+    0xFD, 0xFD, 0xD0, 0x9F, 0x0A, 0xFF, 0xA2, 0xD4, 0x40, 0x90, 0x39, 0xD8, 0x69, 0xA3, 0xE1, 0xEF,
+    0x89, 0x35, 0xA1, 0xE1, 0x7B, 0x8C, 0xCA, 0xC8, 0x77, 0xB2, 0xAB, 0x6A, 0x9E, 0xDB, 0x24, 0x7E,
+    0xCE, 0x90, 0xDD, 0x67, 0x66, 0xB3, 0xAB, 0x2A, 0x7E, 0x88, 0x0A, 0x7E, 0x4A, 0x90, 0x9F, 0xDD,
+    0x2A, 0x1B, 0x0D, 0x83, 0x4B, 0x19, 0xDE, 0x6E, 0x21, 0x83, 0xFA, 0x52, 0x43, 0x52, 0xF6, 0x9A,
+    0x1C, 0xF5, 0xD7, 0xFE, 0x41, 0x6E, 0x82, 0xDE, 0x7D, 0x08, 0xD3, 0x2E, 0x25, 0xBE, 0xA0, 0xAC,
+    0x59, 0x3F, 0x5F, 0xD6, 0xDC, 0x87, 0xE0, 0x16, 0xBF, 0xC9, 0x2D, 0x45, 0xFF, 0xC5, 0x76, 0xBB,
+    0x3E, 0xC1, 0xB0, 0x9A, 0x8B, 0x0C, 0xAB, 0xBB, 0xCC, 0xB0, 0xBE, 0xA0, 0x20, 0x38, 0x30, 0xAC,
+    0xFA, 0x9C, 0x61, 0xD9, 0x0B, 0x0C, 0xEB, 0x0B, 0x25, 0x47, 0xFD, 0xB5, 0x0F, 0x78, 0x86, 0x37,
+    0x36, 0x4B, 0xBB, 0x11, 0x1D, 0x7C, 0x00, 0xBF, 0xF8, 0x06, 0x8B, 0x5A, 0x24, 0xB7, 0xAA, 0x60,
+    0x54, 0x4D, 0xAF, 0x36, 0x49, 0x6E, 0xF9, 0x9C, 0x5B, 0xE9, 0xDA, 0xD6, 0xCB, 0x67, 0x0F, 0xC7,
+    0xE4, 0x61, 0xB1, 0xE9, 0x6A, 0x6C, 0xA3, 0x8A, 0x9A, 0x5E, 0x22, 0x49, 0x96, 0x45, 0x15, 0x4C,
+    0xB2, 0xD0, 0x17, 0xB0, 0xE8, 0x6A, 0x5E, 0xBD, 0x90, 0xED, 0x63, 0x13, 0xFF, 0xA5, 0x1A, 0x0C,
+    0x70, 0x0B, 0x08, 0xE4, 0x28, 0xB4, 0x21, 0x87, 0x0E, 0x74, 0x41, 0xB2, 0x21, 0xBB, 0x10, 0x7D,
+    0x50, 0xC1, 0x2F, 0xAE, 0x37, 0x10, 0xED, 0x7E, 0xFD, 0x29, 0x0F, 0x5F, 0x2E, 0x08, 0xFA, 0x62,
+    0xD7, 0xA8, 0x82, 0xE5, 0x9F, 0x09, 0xA2, 0x3C, 0x51, 0x96, 0xA8, 0x26, 0x87, 0x31, 0x1D, 0x1D,
+    0xEB, 0xCA, 0xC9, 0x63, 0x12, 0xFC, 0x21, 0x69, 0x37, 0xB7, 0xAA, 0xDB, 0x5C, 0x94, 0xDB, 0x2C,
+    0xCF, 0xB0, 0x75, 0xC0, 0x66, 0xE0, 0xD1, 0x56, 0xC3, 0xDB, 0x9B, 0xD8, 0xAA, 0x4D, 0x57, 0x8E,
+    0xA5, 0x93, 0x63, 0x15, 0x27, 0xDF, 0x64, 0xB7, 0x7B, 0x2B, 0xBE, 0x4F, 0x90, 0x5B, 0xDA, 0x28,
+    0x83, 0x18, 0xC5, 0xD4, 0x1C, 0xEC, 0x3B, 0x42, 0x45, 0x6F, 0x17, 0x75, 0xB1, 0x46, 0x22, 0xF8,
+    0x49, 0x26, 0x99, 0x28, 0xB9, 0x9F, 0x11, 0x54, 0xD1, 0x2D, 0x52, 0x77, 0x1F, 0xA9, 0xC0, 0x4F,
+    0xCA, 0x6E, 0x62, 0xF9, 0xAC, 0xC6, 0xAF, 0xCA, 0x5E, 0xC9, 0xEC, 0xC9, 0x39, 0x39, 0xD6, 0xD1,
+    0x75, 0x5D, 0x39, 0x71, 0xB3, 0x6C, 0x92, 0x49, 0x76, 0x91, 0xDB, 0x72, 0x80, 0x00, 0xE4, 0x18,
+    0x01, 0x90, 0x5D, 0x4D, 0x2C, 0xA0, 0xB7, 0x8B, 0x49, 0xE5, 0xE6, 0x07, 0x37, 0x37, 0x5B, 0x95,
+    0x5C, 0xF0, 0x53, 0x4D, 0x15, 0x6D, 0x60, 0xAC, 0xF8, 0x46, 0xB4, 0x23, 0xA1, 0xE2, 0x07, 0x6B,
+    0xF7, 0x33, 0x42, 0xC9, 0x0F, 0x96, 0xF6, 0x1E, 0x83, 0x78, 0x73, 0x36, 0x1F, 0xD2, 0xEF, 0xB9,
+    0xE4, 0xEF, 0x4C, 0xCD, 0xFD, 0x4D, 0x72, 0x77, 0xC7, 0xFA, 0x51, 0x92, 0x2C, 0xA1, 0xCA, 0x8E,
+    0xD2, 0x9C, 0x77, 0x84, 0x2A, 0x63, 0x29, 0x43, 0xC9, 0x22, 0x19, 0xFA, 0x82, 0x59, 0x47, 0xD7,
+    0x55, 0x9C, 0x3C, 0xCB, 0x98, 0x51, 0x9B, 0x16, 0xF9, 0xCC, 0xF1, 0x47, 0xBF, 0x66, 0x8F, 0x9A,
+    0xFC, 0x23, 0x82, 0x2A, 0xF2, 0xB3, 0x5C, 0x1E, 0xAF, 0xCF, 0x6A, 0x6E, 0x46, 0x79, 0x97, 0xBD,
+    0xAE, 0x21, 0xE3, 0x3F, 0x7E, 0x91, 0x5B, 0x2B, 0x82, 0x41, 0x2D, 0x15, 0xA3, 0x58, 0x5C, 0x54,
+    0x45, 0x38, 0x39, 0x96, 0x4E, 0xBE, 0x49, 0x2F, 0x1B, 0xED, 0x85, 0xF5, 0x48, 0x6A, 0xC8, 0xA0,
+    0x41, 0x5E, 0x0F, 0xBB, 0x94, 0x84, 0x6C, 0x93, 0xB7, 0x79, 0x3D, 0x46, 0x3F, 0xA9, 0xD9, 0x4C,
+    0x92, 0xEC, 0x07, 0x79, 0x3D, 0x56, 0xA9, 0xBD, 0xCF, 0x01, 0x1D, 0xC8, 0x1C, 0xCA, 0x9E, 0xF7,
+    0xAF, 0xA5, 0x3F, 0x18, 0x65, 0x66, 0xD3, 0x1E, 0x20, 0x71, 0xF0, 0xC4, 0xF5, 0x2A, 0x5E, 0x65,
+    0x56, 0x36, 0xBB, 0xCB, 0x1D, 0x69, 0x1B, 0x0F, 0x3E, 0xBB, 0xA3, 0x93, 0x93, 0x93, 0x16, 0x78,
+    0x03, 0xF8, 0x20, 0x73, 0xEF, 0x8C, 0x42, 0x65, 0x5B, 0xA3, 0x66, 0x50, 0x45, 0x50, 0x45, 0x50,
+    0x79, 0xF0, 0x6F, 0x67, 0xDF, 0x66, 0x36, 0x00, 0xDD, 0x2A, 0xD9, 0x74, 0x72, 0xD2, 0xED, 0x7E,
+    0xF7, 0xFB, 0x07, 0x9C, 0xA9, 0x97, 0x9E, 0x0F, 0x72, 0x49, 0x86, 0xB1, 0x24, 0xA9, 0xDB, 0xFA,
+    0x92, 0x5E, 0x76, 0x56, 0x85, 0x3E, 0x99, 0x35, 0xE8, 0x06, 0x53, 0xCD, 0x2A, 0xB7, 0xAA, 0x66,
+    0xD9, 0x03, 0x03, 0xF4, 0x1B, 0x1F, 0xA8, 0xE8, 0xD5, 0xA5, 0xBE, 0x24, 0xC9, 0x30, 0xCA, 0x25,
+    0xE9, 0xC6, 0x78, 0xD2, 0xBD, 0xFB, 0x51, 0xF2, 0x37, 0xBE, 0x60, 0xF2, 0xE7, 0xC3, 0x7F, 0xEC,
+    0xD5, 0x10, 0xE4, 0x51, 0xC3, 0xA2, 0x6B, 0xF4, 0xEA, 0x56, 0x15, 0x0C, 0x6A, 0x3F, 0x99, 0x85,
+    0x0C, 0x62, 0x6D, 0x43, 0x49, 0x54, 0x49, 0x28, 0x88, 0xF2, 0x04, 0xB3, 0xA9, 0x20, 0x7C, 0xDA,
+    0x03, 0x83, 0xBA, 0x55, 0xD7, 0xE8, 0x1B, 0x96, 0xFC, 0x86, 0x20, 0x77, 0x73, 0x0F, 0xD3, 0xEC,
+    0x18, 0xF4, 0xAF, 0xE1, 0xBD, 0x6B, 0x77, 0x00, 0xDC, 0x6B, 0x90, 0xC6, 0x02, 0xFE, 0x97, 0xF4,
+    0x97, 0xEF, 0x49, 0xA5, 0x74, 0x53, 0xD5, 0x2A, 0xDF, 0x97, 0x04, 0xB7, 0x94, 0x8C, 0x76, 0x2D,
+    0x98, 0x6C, 0x54, 0x4E, 0xE6, 0x2E, 0x89, 0xB9, 0x4D, 0x72, 0x8B, 0xD9, 0x64, 0xA8, 0x08, 0xF9,
+    0xE7, 0x2E, 0x55, 0x0C, 0x25, 0xC1, 0xAD, 0xB2, 0x31, 0x43, 0x0D, 0x7E, 0x96, 0x9B, 0xCC, 0xAA,
+    0x7A, 0xD0, 0x0E, 0xA8, 0x17, 0x83, 0xFE, 0x85, 0xAA, 0x55, 0x5E, 0x35, 0x3D, 0x93, 0xFC, 0xDC,
+    0x6E, 0x32, 0x94, 0x8C, 0x62, 0xEE, 0xA2, 0xDA, 0xAD, 0x22, 0x14, 0x8C, 0x36, 0xAA, 0x8B, 0x35,
+    0xBD, 0xA1, 0x22, 0x18, 0x4A, 0xC6, 0x86, 0x8C, 0x60, 0x30, 0xD5, 0x0C, 0xCC, 0x59, 0x61, 0xF2,
+    0xA1, 0x5B, 0x54, 0x05, 0xFD, 0xED, 0x01, 0x70, 0x2E, 0x4F, 0x5F, 0xD4, 0x4E, 0x79, 0x87, 0xF8,
+    0x9D, 0x83, 0x47, 0xB1, 0xC8, 0x30, 0x6E, 0xB5, 0xE5, 0x68, 0x91, 0x0B, 0xA1, 0x26, 0x5F, 0x2E,
+    0xB7, 0xBD, 0xA4, 0xAF, 0x9E, 0xF6, 0x92, 0x4A, 0xA6, 0x73, 0x2C, 0xC6, 0xA4, 0x8C, 0x58, 0x67,
+    0xF8, 0x7A, 0x90, 0xCE, 0x82, 0x2F, 0xBE, 0x9C, 0x63, 0xFC, 0xEA, 0xE9, 0x05, 0xB4, 0xDD, 0x33,
+    0x4A, 0x6A, 0x1F, 0xD1, 0x4B, 0xF5, 0xD6, 0x24, 0xA9, 0xA0, 0x6F, 0x67, 0xE9, 0x4A, 0xAF, 0xA3,
+    0x2F, 0xF1, 0x3A, 0x4A, 0x92, 0x6C, 0xB0, 0x41, 0x6A, 0x52, 0xBD, 0x49, 0xF2, 0xA3, 0x9F, 0xA4,
+    0x3A, 0xD6, 0x49, 0xD2, 0x53, 0xFD, 0x53, 0x9F, 0x88, 0x73, 0xFA, 0x52, 0x8E, 0xF1, 0x8F, 0x2B,
+    0xA8, 0xC3, 0xFC, 0x6F, 0x49, 0xF5, 0x72, 0x26, 0xAB, 0x9A, 0xA8, 0x3D, 0x3C, 0x5A, 0x2E, 0x64,
+    0x04, 0x58, 0x15, 0x8B, 0x32, 0xD6, 0xF6, 0xD4, 0x69, 0x8E, 0x72, 0x2F, 0x19, 0x0F, 0xCA, 0xDD,
+    0x1E, 0x09, 0x75, 0x72, 0x08, 0xFF, 0x7A, 0x62, 0x21, 0x18, 0xD2, 0xF3, 0x2F, 0x4B, 0xCC, 0xAA,
+    0x76, 0x89, 0xD0, 0x2D, 0xB9, 0xCF, 0xFB, 0x26, 0x78, 0xA2, 0x7D, 0x79, 0xFA, 0x65, 0xC9, 0xA3,
+    0x02, 0x86, 0x1A, 0x3F, 0x9A, 0xB5, 0x5B, 0xEC, 0x58, 0xA7, 0xA3, 0x3D, 0x3A, 0xEC, 0xC9, 0xCE,
+    0x8B, 0xD4, 0xCC, 0xCD, 0xDC, 0xAE, 0x26, 0xB6, 0x6B, 0x1B, 0xCD, 0x62, 0xD6, 0xF2, 0x66, 0x79,
+    0xF3, 0xB0, 0x69, 0x9E, 0x64, 0x5F, 0x9E, 0x7F, 0x59, 0x25, 0x93, 0x1A, 0x7A, 0xB5, 0x31, 0x43,
+    0xB5, 0x3E, 0xEC, 0x73, 0xD2, 0xC1, 0xDB, 0x90, 0x2C, 0xFC, 0x14, 0x62, 0x49, 0x52, 0x83, 0xE4,
+    0xE7, 0xC7, 0xCA, 0x0A, 0xD6, 0x22, 0x3B, 0x69, 0xF7, 0x36, 0x47, 0x5D, 0x3D, 0x1D, 0xC4, 0x2C,
+    0x1B, 0xD5, 0x6C, 0x2A, 0xE9, 0xE5, 0xC6, 0x8C, 0xA8, 0x49, 0x1E, 0x9E, 0xCB, 0x40, 0xFB, 0x37,
+    0x61, 0x6E, 0x58, 0x76, 0x2F, 0xD2, 0x63, 0x65, 0x35, 0x53, 0x0D, 0x13, 0x67, 0x6D, 0xF6, 0x1F,
+    0xA3, 0x86, 0xC9, 0xAC, 0xED, 0x25, 0x6A, 0x68, 0x60, 0x31, 0xFB, 0xD5, 0xC0, 0x2C, 0x4F, 0xAF,
+    0xEC, 0xDA, 0xFA, 0xC7, 0x5D, 0x6E, 0x53, 0x9D, 0xD1, 0xAB, 0xB3, 0xF6, 0x25, 0x95, 0xB1, 0x8C,
+    0x6E, 0xB2, 0xF7, 0xB7, 0x1A, 0x3B, 0xDA, 0xE9, 0x25, 0xBD, 0x74, 0xC6, 0x89, 0x7E, 0xBF, 0x2B,
+    0xA0, 0xAF, 0xE9, 0x48, 0x12, 0xA3, 0x09, 0x12, 0xBC, 0x30, 0xED, 0x11, 0x27, 0xB2, 0x3F, 0x62,
+    0x95, 0x4C, 0xE8, 0x96, 0x0C, 0xEE, 0x9E, 0x91, 0xE6, 0x97, 0x26, 0x20, 0xA2, 0x3C, 0xBD, 0x79,
+    0x41, 0xB5, 0xB2, 0x97, 0x55, 0xAB, 0xE1, 0xA2, 0x6A, 0xD5, 0x5F, 0x0C, 0xE0, 0x9A, 0xA4, 0x02,
+    0xC8, 0x01, 0x61, 0x8C, 0x59, 0xA6, 0xF4, 0x0D, 0xDB, 0xAB, 0x44, 0x91, 0xD4, 0x30, 0x77, 0x48,
+    0x6D, 0x16, 0x23, 0x7E, 0xCD, 0x41, 0xA4, 0xB7, 0x19, 0x24, 0x1B, 0x73, 0xB4, 0x65, 0xF6, 0xFC,
+    0xEF, 0x61, 0x00, 0x77, 0x91, 0xD4, 0x6E, 0x17, 0x6E, 0xBA, 0x94, 0xAB, 0xBD, 0x9B, 0x9F, 0x71,
+    0xBB, 0x0F, 0x75, 0x94, 0xFC, 0x9A, 0x9B, 0xEE, 0x89, 0xAA, 0x99, 0x1B, 0xB6, 0xBF, 0xCC, 0xDE,
+    0x04, 0x18, 0x04, 0xE4, 0x53, 0x0D, 0xE4, 0x90, 0xCE, 0xF7, 0x24, 0xE9, 0x28, 0xF7, 0xFD, 0xB2,
+    0x82, 0xB5, 0xE8, 0x10, 0xE4, 0xFD, 0x9B, 0x15, 0xAC, 0x2F, 0xE9, 0x48, 0xB3, 0x9A, 0x55, 0x5D,
+    0x54, 0xB3, 0xBA, 0x47, 0x48, 0xAA, 0x53, 0x13, 0xA5, 0x82, 0xBE, 0xFB, 0xB8, 0x9A, 0xF5, 0x65,
+    0x5D, 0xD3, 0xAC, 0x6C, 0x0D, 0x59, 0xD9, 0x6A, 0x92, 0x24, 0x46, 0x3F, 0x4A, 0x75, 0xAC, 0xA3,
+    0xA4, 0xA7, 0xF4, 0x09, 0x65, 0xEB, 0xCB, 0x39, 0xD2, 0xE7, 0x5F, 0x96, 0xA4, 0x7D, 0x45, 0x17,
+    0x1D, 0x0E, 0x3A, 0xEC, 0xA9, 0x9D, 0x2E, 0x4D, 0xC9, 0x1F, 0x7D, 0x5C, 0xC4, 0xC1, 0xA4, 0x6B,
+    0xCF, 0x63, 0x3C, 0xCD, 0x76, 0x76, 0xFE, 0x26, 0xAB, 0x6E, 0xE7, 0xFB, 0xF0, 0x4B, 0x30, 0x9C,
+    0xD3, 0x17, 0x25, 0x35, 0x4C, 0x92, 0x3C, 0x93, 0x54, 0x6F, 0x7E, 0x94, 0xDC, 0xE4, 0x47, 0x55,
+    0x49, 0x6E, 0xBC, 0xB8, 0xD9, 0xBE, 0x04, 0xC3, 0xC9, 0xEC, 0x50, 0x5E, 0xAA, 0xB7, 0x7A, 0x93,
+    0xBA, 0xB5, 0x5D, 0x25, 0x3B, 0xDA, 0x51, 0xFA, 0xB7, 0xFA, 0x93, 0x4B, 0xFB, 0xE9, 0x8F, 0x7F,
+    0x38, 0xCF, 0xBF, 0x2C, 0xC9, 0xAF, 0x97, 0x30, 0x6F, 0x3B, 0x1F, 0x4E, 0x3D, 0x1C, 0xE8, 0xEC,
+    0x49, 0xF9, 0xA5, 0xA5, 0xE2, 0xF4, 0xC5, 0x9D, 0xF4, 0x99, 0x77, 0xC2, 0xF7, 0xE3, 0x4E, 0xF6,
+    0x67, 0x54, 0xFF, 0xC4, 0xBA, 0x53, 0x9E, 0x0E, 0x39, 0x14, 0xA8, 0x80, 0x41, 0x66, 0x63, 0x10,
+    0xAF, 0x33, 0x98, 0x55, 0xF4, 0x47, 0x67, 0x87, 0x42, 0x9E, 0xDC, 0xEC, 0x64, 0x45, 0x2F, 0xA9,
+    0x5D, 0x4D, 0x94, 0x9B, 0xDD, 0x2C, 0x7A, 0x06, 0x9D, 0x6B, 0x7B, 0x4F, 0xB4, 0x3B, 0xBF, 0x67,
+    0x77, 0x7D, 0xF3, 0x9E, 0xA4, 0xED, 0xA0, 0x88, 0xB4, 0xB3, 0x24, 0x7A, 0x7D, 0xA5, 0x5D, 0x72,
+    0x8C, 0x96, 0xD9, 0x63, 0xB3, 0x32, 0x09, 0x77, 0x9B, 0xF6, 0x03, 0x6A, 0x05, 0xE3, 0x81, 0x86,
+    0x33, 0xB3, 0xBC, 0x7E, 0x26, 0xDC, 0x9E, 0xA8, 0x93, 0xBD, 0x38, 0x7D, 0xF1, 0xD2, 0x49, 0xD0,
+    0x75, 0x27, 0xE5, 0x92, 0x8B, 0x9D, 0x7A, 0xC2, 0xBD, 0x2A, 0x4F, 0x87, 0x3D, 0xD8, 0xB7, 0x65,
+    0x95, 0xEC, 0xA3, 0x4D, 0xE2, 0x75, 0x86, 0x6A, 0x93, 0x1D, 0x8B, 0xE3, 0xB3, 0x2D, 0xF6, 0x84,
+    0xE7, 0x4A, 0x92, 0xBC, 0x7C, 0x5F, 0x30, 0x10, 0x0A, 0x5E, 0x27, 0x64, 0xC2, 0xFE, 0x93, 0xCB,
+    0xFC, 0xF4, 0x89, 0xF6, 0xEA, 0xE9, 0x57, 0xD4, 0xA2, 0x8A, 0x20, 0x26, 0x75, 0x8B, 0xEA, 0xB4,
+    0xAF, 0xDA, 0x49, 0x2F, 0xC6, 0xC7, 0xFF, 0x7B, 0xFA, 0x65, 0xB1, 0x94, 0x8C, 0x0D, 0x6A, 0x57,
+    0xD9, 0x71, 0x97, 0x7D, 0x47, 0xC7, 0xB2, 0xCB, 0xE3, 0xFF, 0x65, 0x9C, 0x24, 0xA9, 0x02, 0x35,
+    0x1B, 0xA1, 0x5B, 0xEC, 0xEC, 0x43, 0x13, 0x4F, 0x0E, 0xA4, 0x76, 0x74, 0x9C, 0xC3, 0x31, 0x7E,
+    0x97, 0x97, 0x24, 0xD7, 0xBB, 0xEF, 0x53, 0x61, 0xA2, 0x89, 0xDD, 0xDC, 0xCD, 0x4F, 0xEB, 0xA9,
+    0xB3, 0xD5, 0x3A, 0x3A, 0x96, 0x18, 0x55, 0xD1, 0xCB, 0xA4, 0xFC, 0xC0, 0x3F, 0xE6, 0xB6, 0xE8,
+    0x8B, 0x63, 0xD9, 0xA5, 0x9A, 0x05, 0x2F, 0x4C, 0x25, 0x30, 0x56, 0x0F, 0x3C, 0x43, 0x35, 0x37,
+    0xDB, 0x05, 0x03, 0xF3, 0xC9, 0xF9, 0xC8, 0x9F, 0x7E, 0xE5, 0x0C, 0xA1, 0xB3, 0x51, 0x39, 0x68,
+    0x2D, 0xC7, 0xBE, 0xA9, 0xA0, 0xBF, 0x28, 0xAF, 0xFE, 0x00, 0xDE, 0xF4, 0x83, 0xDE, 0x95, 0x51,
+    0xBD, 0xB3, 0xC3, 0xBF, 0x76, 0x3E, 0x68, 0xC4, 0xE7, 0x2A, 0xE4, 0x1F, 0xA2, 0x77, 0x45, 0xEE,
+    0x5C, 0x92, 0x04, 0xA3, 0xE4, 0xEF, 0x46, 0xC9, 0x8F, 0x04, 0xB9, 0xD0, 0xC4, 0x8B, 0x1A, 0xE1,
+    0x1F, 0x66, 0xEE, 0x24, 0xB5, 0x93, 0x99, 0x64, 0x62, 0x93, 0x54, 0x51, 0xD1, 0xCB, 0x07, 0x1F,
+    0x74, 0x75, 0xB8, 0x3A, 0x5C, 0xE6, 0x48, 0x4F, 0xBE, 0x77, 0xE7, 0xF2, 0x6E, 0x87, 0x83, 0xC3,
+    0xA7, 0xCA, 0xBB, 0x27, 0xEB, 0x0E, 0xDF, 0xAD, 0x96, 0x2C, 0xEF, 0xCE, 0x23, 0xEE, 0x3F, 0x21,
+    0xEF, 0x9E, 0x70, 0xAF, 0xCA, 0xD3, 0x41, 0x39, 0xBA, 0xF9, 0x82, 0xBC, 0xFB, 0x2E, 0x7D, 0xB5,
+    0xC9, 0x5D, 0x90, 0x77, 0x4F, 0x7A, 0xAE, 0x76, 0x79, 0xA7, 0x82, 0xEF, 0x32, 0x14, 0x7C, 0xF7,
+    0xD3, 0xE5, 0xDD, 0x1F, 0xA2, 0x57, 0x87, 0xF3, 0xDD, 0x87, 0xC3, 0x7F, 0xB0, 0x54, 0x39, 0x4F,
+    0x7B, 0xCE, 0x33, 0x70, 0x0A, 0x10, 0x88, 0x59, 0xB5, 0xF1, 0x19, 0x26, 0x95, 0xCD, 0x3E, 0x15,
+    0xB5, 0x9C, 0x9F, 0xAD, 0x6E, 0xC8, 0xAE, 0x8D, 0x92, 0x70, 0x76, 0x48, 0x72, 0xB3, 0x31, 0x07,
+    0x44, 0xFF, 0x70, 0x3F, 0x24, 0xF3, 0x73, 0x82, 0x4A, 0x60, 0x65, 0x96, 0xFC, 0xAF, 0x4F, 0xAE,
+    0x77, 0xE9, 0x72, 0x0B, 0x05, 0xD3, 0xE5, 0x57, 0x34, 0x0C, 0xD9, 0xD7, 0xC9, 0x9A, 0x63, 0x62,
+    0x3A, 0x7E, 0x71, 0x83, 0xF7, 0x4F, 0x5F, 0x3E, 0x74, 0xB2, 0xB7, 0x39, 0x1F, 0x0F, 0xA3, 0xD8,
+    0xFF, 0xFD, 0x4D, 0x3A, 0x37, 0xE3, 0x0A, 0x7F, 0x53, 0xD7, 0x1E, 0x4A, 0xF2, 0xAC, 0x0D, 0x8C,
+    0x6A, 0xB3, 0x33, 0x3D, 0x9F, 0x6E, 0xC9, 0x3B, 0xF9, 0x21, 0x3C, 0xA8, 0x09, 0x2E, 0xCA, 0x33,
+    0x54, 0x3C, 0x43, 0x10, 0x51, 0xCD, 0x66, 0x50, 0xC9, 0x94, 0x43, 0x2F, 0x6A, 0xDE, 0x3F, 0xF5,
+    0x1F, 0x30, 0xCA, 0x00, 0xBC, 0x41, 0x9F, 0x11, 0x8B, 0x36, 0xED, 0xFF, 0x91, 0xC1, 0x2E, 0xD9,
+    0xC3, 0x23, 0xA6, 0xAC, 0x77, 0x54, 0xB9, 0x15, 0xA9, 0x61, 0xA8, 0x59, 0x25, 0x19, 0x6E, 0x7A,
+    0x56, 0xD5, 0xA1, 0xDD, 0x5F, 0x9D, 0x61, 0x17, 0x88, 0xEA, 0x32, 0xEC, 0x3C, 0xAB, 0xE1, 0x81,
+    0x1C, 0x29, 0xEF, 0xA5, 0xC3, 0xFF, 0x9F, 0xE8, 0xF6, 0x33, 0x94, 0x1F, 0x1D, 0xCE, 0x55, 0x5E,
+    0x46, 0x74, 0xFC, 0xE1, 0x24, 0xDD, 0x67, 0x7C, 0x39, 0xE7, 0x65, 0xA9, 0x4A, 0x75, 0x6C, 0xA2,
+    0x89, 0xED, 0x6A, 0x17, 0x3B, 0xBB, 0xF9, 0xE8, 0xB8, 0x49, 0x26, 0x99, 0xD8, 0xC6, 0x76, 0xE9,
+    0x66, 0x3B, 0xD9, 0xD1, 0x85, 0x23, 0x15, 0x49, 0x5E, 0xF4, 0x2E, 0xB8, 0xD0, 0x4D, 0xDD, 0x6C,
+    0x56, 0x13, 0x9B, 0x54, 0x6F, 0x15, 0x15, 0x3D, 0x81, 0xE0, 0x27, 0x37, 0xDB, 0xF5, 0xCA, 0xF5,
+    0x2B, 0xD7, 0xD5, 0xA4, 0x8A, 0x8A, 0xAF, 0x1F, 0x4A, 0xBB, 0xA5, 0x5D, 0x4C, 0x6C, 0x62, 0xB5,
+    0x55, 0x5B, 0x81, 0xE8, 0x7D, 0x70, 0xC1, 0x8E, 0x57, 0xFA, 0x2B, 0xC7, 0xBA, 0x36, 0xE8, 0x15,
+    0x95, 0xEF, 0xF9, 0xB9, 0x62, 0x30, 0x89, 0xA5, 0x22, 0x74, 0xB0, 0xD4, 0x39, 0xAB, 0x08, 0xED,
+    0xE6, 0xA6, 0x92, 0xDE, 0xC4, 0x2B, 0xBD, 0xBE, 0xA6, 0xE2, 0xF8, 0xFF, 0x03, 0xCD, 0x9A, 0xBF,
+    0x8F, 0xE6, 0xC6, 0x79, 0xC7, 0xBF, 0x24, 0x71, 0x62, 0x41, 0xC0, 0xE3, 0x66, 0x13, 0x20, 0x2A,
+    0xE8, 0x3A, 0x0D, 0xFF, 0x84, 0xA1, 0x2D, 0x20, 0x2E, 0xB5, 0x80, 0xEF, 0x95, 0x0A, 0x15, 0xEA,
+    0xAF, 0xB9, 0xFF, 0x20, 0xA4, 0xED, 0xD2, 0x85, 0x2E, 0x40, 0x5C, 0xDB, 0x85, 0x5D, 0x78, 0x55,
+    0x6C, 0x1B, 0x57, 0x33, 0x92, 0x8A, 0x14, 0x57, 0x1C, 0x1D, 0x21, 0x30, 0x10, 0x15, 0x4B, 0xDB,
+    0x77, 0x76, 0x20, 0x15, 0x3B, 0xD6, 0x51, 0x16, 0x77, 0x77, 0x86, 0x9F, 0x14, 0xC3, 0x77, 0x4F,
+    0xA7, 0x9C, 0x6C, 0xC5, 0xB0, 0x15, 0x13, 0xEF, 0xFB, 0xCC, 0x70, 0x7E, 0x71, 0x38, 0x3F, 0x9E,
+    0xE7, 0xF9, 0x7E, 0x87, 0x92, 0xD4, 0x84, 0x26, 0x98, 0xB5, 0x5D, 0xDB, 0xD8, 0xAD, 0x66, 0x6D,
+    0xD7, 0x26, 0x34, 0x41, 0xFB, 0xE5, 0x60, 0xE3, 0xF3, 0x57, 0x90, 0x5E, 0xF8, 0x87, 0xF4, 0xDC,
+    0xFF, 0x93, 0xC3, 0xDD, 0x3F, 0x52, 0xF6, 0x7F, 0xB5, 0x2B, 0x75, 0x8C, 0x92, 0x2A, 0xA2, 0x24,
+    0x0D, 0x4C, 0x92, 0x0C, 0x9B, 0x24, 0x41, 0x90, 0xD4, 0x5E, 0xD3, 0x4B, 0x15, 0x6F, 0xAE, 0x92,
+    0x6C, 0xC0, 0x4B, 0x0D, 0x26, 0x49, 0x62, 0x76, 0x41, 0x32, 0xA9, 0x46, 0x2A, 0xF1, 0x76, 0x91,
+    0xEC, 0x5A, 0xE2, 0x55, 0xD3, 0xB7, 0x51, 0x72, 0x41, 0xCC, 0x32, 0xC8, 0xA0, 0x02, 0x60, 0x51,
+    0x07, 0x30, 0x56, 0x00, 0x51, 0x03, 0xC0, 0xD4, 0xF0, 0xE1, 0x99, 0xDB, 0xF6, 0x4E, 0xB6, 0x9B,
+    0xD4, 0xF0, 0x0A, 0x93, 0x34, 0xAC, 0x36, 0x4A, 0x15, 0xFF, 0xCE, 0x28, 0x75, 0x89, 0x45, 0x2A,
+    0x08, 0x03, 0x30, 0xBB, 0x17, 0x89, 0x20, 0xE9, 0x85, 0xE2, 0xFA, 0xA7, 0xBD, 0x1C, 0x5C, 0xC9,
+    0x01, 0xA3, 0x03, 0x82, 0x03, 0x56, 0x17, 0x5E, 0x22, 0xBA, 0x20, 0x9B, 0x5C, 0x50, 0x9B, 0x5C,
+    0x50, 0xBB, 0x1D, 0x63, 0x5D, 0x72, 0x41, 0x2E, 0xBA, 0xEB, 0x73, 0xD6, 0xDB, 0x1A, 0x93, 0x83,
+    0x4D, 0x0E, 0x1E, 0xC8, 0x71, 0xFD, 0x40, 0x16, 0x98, 0x0C, 0xB0, 0x55, 0x00, 0x33, 0xD7, 0xE7,
+    0x44, 0x1B, 0xD5, 0xF2, 0x2A, 0x2A, 0x79, 0x1F, 0xAF, 0x61, 0x21, 0xA8, 0x4B, 0x36, 0xCA, 0x60,
+    0x50, 0xCB, 0x2B, 0x00, 0x23, 0xB0, 0xC9, 0x02, 0xB3, 0x01, 0x78, 0x85, 0xFF, 0x7C, 0x9D, 0x40,
+    0x50, 0xB7, 0xD9, 0xA8, 0x8A, 0x47, 0x48, 0x3C, 0xC5, 0xCB, 0x46, 0x82, 0x0C, 0x36, 0xCA, 0xF0,
+    0x88, 0xB3, 0x73, 0xDE, 0x07, 0x08, 0x00, 0xE1, 0x58, 0x7D, 0xEB, 0x35, 0x00, 0xE7, 0xC0, 0xCD,
+    0x71, 0x86, 0x1D, 0x70, 0x19, 0xA5, 0x26, 0xCF, 0x4C, 0x1E, 0x89, 0xEE, 0x2F, 0x98, 0x20, 0x55,
+    0x00, 0x5E, 0xDA, 0xD7, 0xA6, 0x05, 0xA2, 0x64, 0xF2, 0x9A, 0xBA, 0xCD, 0xF4, 0x72, 0x41, 0xB2,
+    0x41, 0x5D, 0x94, 0x4C, 0x54, 0x83, 0x54, 0xA3, 0x12, 0xAF, 0x62, 0xCF, 0x1C, 0x72, 0x66, 0xBB,
+    0xAA, 0x41, 0x6A, 0x36, 0x95, 0x78, 0x95, 0x8C, 0x72, 0x41, 0x72, 0x93, 0xBA, 0x28, 0xD9, 0x45,
+    0x0D, 0x92, 0x89, 0x2A, 0xF1, 0xAA, 0x90, 0x5C, 0x50, 0x89, 0x57, 0x17, 0x25, 0x26, 0x35, 0x48,
+    0x43, 0x4E, 0xB1, 0xAB, 0xE4, 0xC2, 0x4B, 0x8E, 0xB3, 0x33, 0xC7, 0x59, 0x5E, 0xE4, 0x9B, 0xCB,
+    0xE1, 0x79, 0x0E, 0x3E, 0xCA, 0xC1, 0x35, 0x5E, 0x92, 0xD9, 0x5C, 0x90, 0x54, 0x71, 0x1E, 0x25,
+    0x89, 0x8F, 0x90, 0x24, 0x7B, 0xCC, 0xBC, 0xF7, 0x40, 0x52, 0x71, 0xD6, 0x7F, 0x95, 0x7B, 0xB2,
+    0xDD, 0x5F, 0x6A, 0x13, 0x41, 0x26, 0xA9, 0x64, 0xAA, 0x19, 0xC5, 0x24, 0xBB, 0xAA, 0x8B, 0x32,
+    0x49, 0x06, 0x89, 0x20, 0xA6, 0x82, 0x49, 0x35, 0xBD, 0x49, 0xB2, 0x51, 0xEA, 0xA2, 0x98, 0x0C,
+    0x92, 0x08, 0x26, 0x15, 0x4C, 0x52, 0x4D, 0xCF, 0x64, 0xA3, 0xA4, 0x2E, 0x9A, 0x94, 0xE7, 0x8E,
+    0x27, 0x3C, 0x61, 0x92, 0x54, 0xE7, 0x8D, 0xA8, 0x3C, 0x7F, 0xCF, 0xE6, 0x75, 0xD9, 0xD5, 0x10,
+    0x78, 0x49, 0x2D, 0xF7, 0xB7, 0xFB, 0x9B, 0xA4, 0x8A, 0x89, 0x89, 0x45, 0x92, 0x5B, 0x4D, 0xAA,
+    0xF1, 0x92, 0x41, 0x4C, 0x76, 0x93, 0x2A, 0x26, 0x93, 0xC4, 0x22, 0xB9, 0x28, 0xA6, 0x06, 0x2F,
+    0x83, 0x4C, 0x92, 0xDD, 0x54, 0x31, 0x8B, 0x49, 0x04, 0x0D, 0x51, 0x26, 0xA9, 0xC1, 0x1B, 0x7A,
+    0x31, 0xC9, 0xA6, 0x92, 0x59, 0x26, 0xA9, 0x20, 0x0C, 0xC7, 0xB9, 0xF4, 0x92, 0xA4, 0xC2, 0x31,
+    0xAB, 0x3B, 0x6E, 0x14, 0x6F, 0x81, 0xB9, 0xBD, 0x7E, 0x9B, 0xF0, 0x35, 0x89, 0x45, 0x92, 0x5D,
+    0x6F, 0xC5, 0xB2, 0x6F, 0xF6, 0x9A, 0x49, 0x40, 0x2F, 0x58, 0x25, 0xB8, 0x92, 0x00, 0xAF, 0xC3,
+    0x39, 0x41, 0x92, 0x5B, 0x25, 0xED, 0x63, 0x71, 0x14, 0x36, 0x7E, 0x43, 0x72, 0x71, 0xF8, 0xE9,
+    0x1B, 0xAC, 0x03, 0x64, 0x0D, 0xE3, 0x07, 0x40, 0x2F, 0xC3, 0x63, 0xE9, 0xCE, 0x5D, 0x69, 0x08,
+    0x12, 0xD1, 0x05, 0x95, 0x44, 0x17, 0x54, 0x11, 0x5D, 0x50, 0x43, 0x74, 0x41, 0x86, 0xE8, 0x82,
+    0xBA, 0xAC, 0x49, 0x88, 0x2E, 0xC8, 0x5D, 0x46, 0x17, 0xC4, 0x45, 0x74, 0xA1, 0xE4, 0xCD, 0xE8,
+    0x42, 0x45, 0x1B, 0x5D, 0x68, 0x52, 0x1B, 0x5D, 0x30, 0xB1, 0x8D, 0x2E, 0x74, 0x4B, 0x17, 0x5D,
+    0xB0, 0xA1, 0x8B, 0x2E, 0xB8, 0xA9, 0x8B, 0x2E, 0xE0, 0xBB, 0xE8, 0x3E, 0xA6, 0xEF, 0xA2, 0x7B,
+    0x8A, 0xBA, 0xE8, 0x6E, 0xA2, 0xBA, 0xE8, 0x58, 0xD5, 0x45, 0x47, 0x50, 0x17, 0x1D, 0xB3, 0xBA,
+    0xE8, 0xF0, 0xEA, 0xA2, 0x63, 0x54, 0x17, 0x1D, 0x52, 0x17, 0xDD, 0xB6, 0xBF, 0x89, 0x24, 0x39,
+    0xDF, 0x44, 0x69, 0x98, 0x4D, 0x94, 0xEC, 0xD5, 0xB0, 0x4A, 0x2D, 0x04, 0xA9, 0xCE, 0x33, 0xE9,
+    0xAE, 0xF4, 0xDC, 0xF5, 0xB7, 0xFF, 0x5E, 0x43, 0x50, 0xC1, 0x7F, 0xE0, 0x65, 0x68, 0x90, 0xDC,
+    0xD2, 0x45, 0xD5, 0x8C, 0x2E, 0xC8, 0xC6, 0x12, 0x5F, 0x32, 0x35, 0xA8, 0xDD, 0xD4, 0x45, 0x11,
+    0xE4, 0x42, 0x83, 0x4A, 0xFC, 0xB0, 0xAA, 0xE1, 0x75, 0xBC, 0x3A, 0x88, 0x92, 0x83, 0x59, 0x25,
+    0x30, 0xAA, 0x01, 0x7A, 0x75, 0xE9, 0x3E, 0x92, 0x0B, 0x1D, 0x2A, 0xF1, 0x36, 0xA9, 0x41, 0x43,
+    0x54, 0x17, 0xE5, 0xA2, 0x5C, 0x10, 0x4B, 0x89, 0x2F, 0xC8, 0xAD, 0x85, 0x2E, 0xAA, 0x62, 0x72,
+    0x41, 0x35, 0xEF, 0xE2, 0x65, 0x78, 0x88, 0x64, 0xE8, 0xD5, 0x00, 0xF4, 0x15, 0x90, 0xD7, 0x1D,
+    0x8B, 0x2C, 0x90, 0xB2, 0x1A, 0xEC, 0x2B, 0x54, 0x30, 0x09, 0xAF, 0x61, 0x91, 0x0D, 0x6A, 0x93,
+    0xDA, 0xA8, 0x9A, 0xBE, 0x46, 0x05, 0x53, 0x91, 0x33, 0x86, 0xA0, 0x36, 0xA9, 0x8B, 0xAA, 0xE9,
+    0x9B, 0x4D, 0x05, 0x53, 0xC9, 0xA8, 0x61, 0x91, 0x9B, 0xD5, 0x26, 0xD9, 0x75, 0xDF, 0xDF, 0x05,
+    0x53, 0x45, 0xAF, 0x61, 0x11, 0x93, 0xDA, 0xA4, 0x21, 0xA8, 0xA6, 0xB7, 0x51, 0x05, 0xFF, 0xE5,
+    0x36, 0x69, 0xF8, 0x14, 0x7A, 0xB5, 0x09, 0xBC, 0x6A, 0x06, 0xBC, 0x0A, 0x2E, 0x18, 0xA5, 0x61,
+    0x39, 0xE4, 0xC9, 0x46, 0x52, 0xC7, 0x25, 0x93, 0x64, 0xB8, 0x21, 0x4A, 0x35, 0xDB, 0xAE, 0xAE,
+    0x1D, 0x93, 0x04, 0x97, 0xAC, 0xD2, 0xC0, 0xCD, 0x86, 0x64, 0x2F, 0x37, 0x86, 0x49, 0xE6, 0x53,
+    0xDC, 0xC5, 0xAA, 0x3A, 0x72, 0xF9, 0x07, 0x54, 0x6D, 0xF6, 0x26, 0x0D, 0x93, 0x78, 0x75, 0xE3,
+    0xD5, 0x55, 0xC3, 0x7B, 0xB8, 0xF7, 0x91, 0xFD, 0x15, 0x97, 0xCB, 0xE0, 0xCD, 0x32, 0xDC, 0x24,
+    0xB3, 0xD6, 0xB1, 0xDD, 0x78, 0x85, 0x72, 0xAB, 0x71, 0x93, 0xF3, 0x7C, 0x93, 0xCB, 0xC5, 0x2C,
+    0x83, 0x1F, 0x6E, 0x52, 0x45, 0x37, 0xB7, 0x1B, 0xBD, 0x7B, 0xB4, 0xD4, 0xB8, 0xA9, 0x25, 0x16,
+    0x5C, 0x2E, 0x15, 0x9B, 0x86, 0x9B, 0x24, 0x47, 0xDF, 0x6E, 0xF4, 0x2D, 0xBE, 0xC6, 0x4D, 0x15,
+    0x73, 0xC1, 0xE5, 0x22, 0x16, 0x0D, 0x37, 0x49, 0x6D, 0x54, 0x1B, 0x87, 0x20, 0xD9, 0x3F, 0xE0,
+    0x77, 0x45, 0x9D, 0xB5, 0x76, 0x56, 0xE1, 0x59, 0x65, 0x7F, 0x71, 0xF2, 0xE1, 0xF0, 0x7A, 0x36,
+    0x00, 0xD9, 0x1A, 0x5C, 0x7F, 0xC6, 0x14, 0x9C, 0xA7, 0xC3, 0xE1, 0xFE, 0x97, 0x6A, 0xE4, 0x8F,
+    0x24, 0x8F, 0xC7, 0x4D, 0x55, 0x38, 0x1E, 0x48, 0x1A, 0x60, 0x95, 0x9A, 0xAC, 0x60, 0xB3, 0x9E,
+    0x6D, 0xD8, 0xCE, 0x89, 0xB2, 0xF4, 0x15, 0x4B, 0x49, 0x50, 0x49, 0x30, 0xF4, 0xAA, 0x98, 0x86,
+    0x28, 0x35, 0x7C, 0x8F, 0x49, 0x6A, 0x31, 0x48, 0xB2, 0xD1, 0x46, 0x49, 0x04, 0x82, 0x54, 0xF1,
+    0x5E, 0xD6, 0xB6, 0x2F, 0xCA, 0x7A, 0x37, 0xCF, 0x68, 0xCD, 0x28, 0xB9, 0xD5, 0x20, 0x55, 0x4C,
+    0x16, 0xA9, 0x43, 0x03, 0x2A, 0x59, 0xE4, 0xF8, 0xA1, 0xC3, 0xEF, 0xDD, 0xD0, 0xAE, 0xD8, 0x1D,
+    0xAC, 0x92, 0xBA, 0xEC, 0xED, 0xE9, 0x90, 0x3B, 0x0D, 0x1F, 0x03, 0xF0, 0x10, 0x80, 0x0E, 0x20,
+    0xBA, 0x9C, 0xEC, 0x55, 0xF0, 0x10, 0xA9, 0xA6, 0x8B, 0x52, 0x1B, 0x5D, 0x90, 0x86, 0xAF, 0x2A,
+    0x59, 0x8E, 0xEB, 0xBE, 0x3A, 0xFA, 0x4C, 0x8B, 0x05, 0x16, 0x80, 0xA7, 0xF8, 0x86, 0x0B, 0xD4,
+    0xE0, 0xA2, 0xCC, 0x46, 0x90, 0xBD, 0xC1, 0x8B, 0x4B, 0x54, 0xE3, 0xA2, 0x6C, 0x22, 0xD4, 0x3C,
+    0x05, 0x78, 0x0B, 0x88, 0x76, 0x77, 0xC0, 0x96, 0x8A, 0x0F, 0x7F, 0xA2, 0x7D, 0x3C, 0x95, 0xAD,
+    0x71, 0xB5, 0x9B, 0xB4, 0x17, 0x26, 0x1D, 0xAF, 0x12, 0x1E, 0xA8, 0x02, 0xE6, 0x02, 0x48, 0x72,
+    0x80, 0x6F, 0xD9, 0xCE, 0xD7, 0x8A, 0x55, 0xB5, 0x5C, 0x52, 0x56, 0x0F, 0x2A, 0x08, 0x92, 0xBA,
+    0xDD, 0x74, 0x1E, 0x5B, 0xAD, 0xF0, 0x5F, 0x18, 0xED, 0x92, 0x8E, 0xD5, 0x0C, 0xBD, 0x24, 0xA2,
+    0xA4, 0x9A, 0x45, 0xC5, 0xD8, 0x71, 0xF5, 0x46, 0xCC, 0x73, 0x57, 0xED, 0xCB, 0x09, 0xBC, 0x1A,
+    0x98, 0xF2, 0xEC, 0x59, 0x80, 0x1F, 0x01, 0x7C, 0xCA, 0xEE, 0x7B, 0xC0, 0x90, 0x27, 0xDB, 0xAE,
+    0x92, 0x4C, 0xEE, 0xC9, 0x28, 0x89, 0xF9, 0x68, 0x3C, 0xFF, 0x5A, 0x89, 0xC3, 0x22, 0x35, 0xE4,
+    0xD5, 0xF8, 0x3D, 0x26, 0x15, 0x78, 0x1B, 0x25, 0x42, 0x83, 0x64, 0x17, 0x31, 0xAB, 0x8B, 0xB2,
+    0x51, 0x66, 0xDB, 0x75, 0xA2, 0x08, 0x25, 0xA3, 0xDA, 0x28, 0xBC, 0x2A, 0xC6, 0x21, 0x48, 0x43,
+    0xB0, 0x8B, 0x64, 0x52, 0x1B, 0xA5, 0x82, 0x87, 0x9B, 0x24, 0xFB, 0x29, 0x92, 0x1A, 0xF2, 0x33,
+    0x99, 0x24, 0x75, 0x64, 0x1F, 0x2E, 0xFB, 0x2D, 0xD9, 0xA1, 0xD9, 0x24, 0xA9, 0x43, 0xD2, 0x3D,
+    0x47, 0x2F, 0x75, 0x30, 0x4A, 0x0D, 0x78, 0xA9, 0xDC, 0xCD, 0x21, 0xBD, 0xA4, 0xE2, 0xEE, 0x3E,
+    0xB1, 0x27, 0xBD, 0x74, 0x7C, 0xA3, 0xE3, 0xEB, 0x1C, 0x6F, 0x0B, 0x07, 0x8F, 0xA5, 0x12, 0x60,
+    0xCD, 0x68, 0x86, 0x90, 0xB7, 0x0B, 0xDE, 0x70, 0xC5, 0x6F, 0xA1, 0x22, 0x98, 0xAD, 0x60, 0xB5,
+    0x51, 0xCC, 0x15, 0x0F, 0xE9, 0xCD, 0x96, 0xE1, 0x04, 0xB3, 0xB8, 0x44, 0x66, 0x93, 0xD9, 0x98,
+    0x9F, 0xBF, 0xCD, 0xB9, 0x1F, 0xED, 0x85, 0xF7, 0xBA, 0xEF, 0xB1, 0x98, 0xAD, 0x60, 0x35, 0x5C,
+    0x73, 0x0D, 0xC7, 0x07, 0x1D, 0x9F, 0x5B, 0xEE, 0x4E, 0x5A, 0x71, 0x0E, 0x0F, 0xBE, 0xB0, 0xCF,
+    0xD2, 0xBD, 0x07, 0xFB, 0xF2, 0x6A, 0x28, 0x99, 0x55, 0x30, 0x1B, 0x24, 0x1B, 0x35, 0x44, 0x35,
+    0xF4, 0x25, 0xD3, 0x8E, 0xD0, 0x6C, 0x94, 0x86, 0xB5, 0xA6, 0x57, 0x85, 0x27, 0x48, 0x86, 0x2E,
+    0x4A, 0x1A, 0x6E, 0x18, 0xA5, 0x8A, 0x7D, 0x45, 0xC6, 0xEC, 0x17, 0x8E, 0x92, 0x6A, 0x42, 0xC6,
+    0x88, 0xA3, 0xA4, 0x8E, 0xA4, 0xDB, 0x62, 0x7C, 0x9A, 0x11, 0x5B, 0x97, 0xA4, 0x8A, 0x31, 0x7B,
+    0xBA, 0x35, 0xA3, 0xDA, 0x24, 0x9B, 0x54, 0xE1, 0x0B, 0x82, 0x5C, 0x50, 0xC3, 0xD8, 0x6E, 0x92,
+    0x4D, 0x15, 0x5E, 0x05, 0xC1, 0x2D, 0x92, 0x39, 0x4E, 0x7B, 0x83, 0xD4, 0x90, 0x41, 0xC0, 0xFF,
+    0xEF, 0xCD, 0xF5, 0xD9, 0x19, 0xDB, 0xDB, 0x9F, 0x05, 0x12, 0x1F, 0x7D, 0xF6, 0x66, 0xFE, 0xCC,
+    0x80, 0x7F, 0xF1, 0xCD, 0xBD, 0x07, 0x43, 0x90, 0xF8, 0x25, 0xBD, 0xCC, 0x36, 0x2C, 0x12, 0xBF,
+    0xFB, 0x92, 0xD1, 0x55, 0xE2, 0x37, 0x78, 0x99, 0xCD, 0xD2, 0xD7, 0xFC, 0x1A, 0x60, 0x33, 0x00,
+    0xB3, 0x65, 0x07, 0xA4, 0xCC, 0xBA, 0xF7, 0xD3, 0xFC, 0x24, 0xE6, 0xDB, 0x87, 0x7E, 0x89, 0xA8,
+    0x9B, 0xD5, 0x6C, 0x92, 0xBB, 0xCC, 0x78, 0xC2, 0x40, 0xC8, 0xD8, 0x82, 0xBF, 0xFD, 0x84, 0x2F,
+    0x7D, 0x05, 0x37, 0xCB, 0x6C, 0x12, 0x93, 0x8D, 0xAA, 0x18, 0x35, 0x2C, 0x06, 0x89, 0x59, 0x6D,
+    0xAA, 0xB2, 0x6E, 0xAC, 0xE9, 0x09, 0x32, 0x9B, 0x8A, 0xBF, 0xF9, 0x42, 0xFB, 0x75, 0xF3, 0x65,
+    0xDE, 0xFC, 0x08, 0x0B, 0x1A, 0x6E, 0x6D, 0x97, 0x3F, 0x22, 0x85, 0x23, 0xDD, 0xD4, 0xBD, 0xA8,
+    0x90, 0x05, 0x2F, 0x15, 0x19, 0x13, 0xD6, 0xB9, 0xA1, 0x8C, 0x24, 0x94, 0xB3, 0x6E, 0x8B, 0xEF,
+    0xD5, 0x73, 0x73, 0xE5, 0x31, 0xEB, 0x70, 0x2A, 0x65, 0xF0, 0x96, 0x71, 0xE4, 0x98, 0x55, 0xD6,
+    0xB8, 0xBB, 0xCC, 0xEA, 0xD2, 0xC1, 0x65, 0x14, 0x6F, 0x33, 0xA6, 0x77, 0x8B, 0x1A, 0x54, 0x64,
+    0xA3, 0x50, 0x65, 0xF4, 0xDF, 0x66, 0x2E, 0x80, 0x45, 0x0D, 0x6A, 0xF0, 0xEA, 0xB6, 0xB7, 0xD9,
+    0x72, 0x83, 0xBB, 0x0E, 0xCC, 0x3E, 0x78, 0x90, 0x3A, 0xF8, 0xEF, 0x8C, 0x67, 0x76, 0x0F, 0x42,
+    0x25, 0x0F, 0x91, 0x24, 0xF7, 0x71, 0xB6, 0xAC, 0xD1, 0x05, 0x49, 0xCD, 0x9F, 0xC8, 0xDC, 0x7E,
+    0xD6, 0xAB, 0xE4, 0x21, 0x30, 0xCA, 0x7D, 0x0C, 0x24, 0x75, 0xD1, 0x01, 0x73, 0x43, 0x07, 0xC4,
+    0x92, 0x87, 0xE8, 0x3E, 0xA3, 0xFB, 0x18, 0x5F, 0x10, 0xBA, 0xE8, 0x82, 0x6C, 0x6C, 0xE8, 0xA2,
+    0x1A, 0xBE, 0xC5, 0x43, 0x54, 0x32, 0xB9, 0x8F, 0xF1, 0x72, 0xCF, 0x65, 0x5A, 0x4A, 0x1E, 0x72,
+    0x06, 0xBD, 0xFB, 0x18, 0xC0, 0xE7, 0x66, 0x7D, 0x6E, 0x76, 0x2C, 0x79, 0x08, 0x57, 0x92, 0x0B,
+    0xF7, 0x7E, 0xFC, 0x45, 0x44, 0xD6, 0x8B, 0xC4, 0x27, 0x87, 0xDD, 0x8F, 0x73, 0x40, 0x7F, 0x4B,
+    0x87, 0x2D, 0xEE, 0x93, 0xD7, 0x88, 0x2E, 0x68, 0x88, 0x47, 0x36, 0xAB, 0x7D, 0x5E, 0xD8, 0x17,
+    0x31, 0x5C, 0xFE, 0x19, 0xC3, 0x95, 0xAF, 0x97, 0xD9, 0xF6, 0x79, 0xAC, 0x80, 0x24, 0x0B, 0x2C,
+    0x05, 0x1F, 0x3A, 0xFC, 0xD7, 0x7A, 0x0D, 0x59, 0x8B, 0xE4, 0x41, 0x1F, 0x8F, 0x9E, 0x4C, 0x79,
+    0xF4, 0x64, 0x38, 0xF2, 0x63, 0xCF, 0x45, 0xCF, 0xCE, 0xDE, 0xCE, 0x36, 0x3B, 0xDD, 0x96, 0xB5,
+    0xF1, 0xB6, 0x05, 0x96, 0x6F, 0x48, 0x03, 0xD5, 0xF5, 0xC1, 0x65, 0xCC, 0xBF, 0x3C, 0x7B, 0x70,
+    0xAF, 0x81, 0xAD, 0xCF, 0x88, 0xFC, 0xF6, 0xAA, 0x91, 0x5E, 0x62, 0x93, 0x5C, 0x50, 0x0D, 0x5B,
+    0x5E, 0x46, 0x10, 0xE5, 0xB2, 0x7D, 0x0E, 0x0D, 0x32, 0x5C, 0x3B, 0xBC, 0x0B, 0x15, 0x41, 0x2E,
+    0x35, 0xC8, 0x46, 0x15, 0x04, 0x17, 0x1A, 0xFA, 0x8C, 0x2C, 0x09, 0xD2, 0xB0, 0xB8, 0x60, 0x36,
+    0xA9, 0xE2, 0x07, 0x1C, 0x98, 0x24, 0x1B, 0x1D, 0x24, 0xA9, 0xE2, 0x61, 0xF6, 0x98, 0x6D, 0x74,
+    0x10, 0xB5, 0xAF, 0x90, 0x9C, 0xF0, 0xC9, 0xFD, 0x98, 0x4B, 0x68, 0xAF, 0x72, 0xDB, 0x46, 0x6E,
+    0x74, 0xCD, 0x96, 0xC4, 0x90, 0x31, 0x66, 0x41, 0x70, 0xA1, 0x62, 0xD6, 0x90, 0x1A, 0xD4, 0xF2,
+    0x64, 0xC0, 0xBB, 0x90, 0xD7, 0x74, 0x83, 0xCA, 0xEC, 0x52, 0x06, 0x35, 0x40, 0x66, 0xC4, 0xD8,
+    0xB2, 0x5F, 0xB2, 0xFB, 0x29, 0xFF, 0x00, 0x41, 0x2D, 0xE0, 0x4B, 0x00, 0x75, 0x40, 0x76, 0x0B,
+    0x43, 0xC3, 0x74, 0x0B, 0x67, 0x09, 0xEA, 0x62, 0x85, 0x97, 0x0B, 0x06, 0x95, 0xF8, 0x2E, 0x3E,
+    0x43, 0xB9, 0x70, 0x46, 0xD8, 0x61, 0x40, 0x26, 0x7E, 0x06, 0x88, 0x2A, 0xC8, 0x6A, 0xB6, 0xC4,
+    0xCB, 0xAD, 0x0D, 0xAA, 0xF1, 0x5D, 0x94, 0x4D, 0x72, 0xA1, 0x64, 0x2E, 0xF1, 0x2D, 0x6A, 0x10,
+    0x8B, 0xBA, 0xD8, 0x30, 0xCA, 0x85, 0x21, 0xAA, 0xE4, 0xBD, 0x9D, 0x82, 0xFB, 0x07, 0x1E, 0xA8,
+    0x85, 0x55, 0x40, 0x2C, 0x80, 0xB5, 0xBA, 0x7A, 0x8D, 0x70, 0x47, 0x05, 0xD3, 0xEE, 0x24, 0x9A,
+    0x4D, 0x77, 0xCE, 0x58, 0xEB, 0xE3, 0x42, 0xFD, 0x01, 0xDB, 0xF9, 0x66, 0x93, 0xEC, 0xD5, 0xEE,
+    0x05, 0x55, 0x9C, 0x27, 0x75, 0xDB, 0x10, 0x0B, 0x56, 0x80, 0x5F, 0xC3, 0xC6, 0xF7, 0xE1, 0xFD,
+    0xAD, 0x64, 0xAD, 0x57, 0x9D, 0xE4, 0x69, 0xFF, 0xBB, 0x7F, 0x93, 0x1A, 0x36, 0x69, 0x00, 0x2F,
+    0x07, 0x41, 0x0E, 0xA2, 0x1C, 0xD7, 0xA7, 0xB2, 0xF4, 0xFB, 0xFA, 0x32, 0x49, 0x52, 0x4D, 0xF1,
+    0x33, 0x95, 0x7C, 0x9B, 0x55, 0x3C, 0x04, 0x6F, 0x6F, 0x20, 0x1A, 0x80, 0xEF, 0xB3, 0x94, 0xFC,
+    0x9E, 0x45, 0x5D, 0x1A, 0xA2, 0x6A, 0x7E, 0x84, 0xC4, 0x6F, 0x18, 0x65, 0x23, 0xB3, 0x0C, 0x76,
+    0x55, 0xC5, 0x5B, 0x48, 0xFC, 0x1A, 0xAF, 0x61, 0xB1, 0xAB, 0x6C, 0x6C, 0x18, 0x87, 0x2D, 0x0F,
+    0x5B, 0x0B, 0xEC, 0x5A, 0xB2, 0x21, 0x49, 0xBA, 0x73, 0x2A, 0x9D, 0x1C, 0x0E, 0x7D, 0x01, 0xF9,
+    0x25, 0x63, 0x0B, 0xC4, 0xE1, 0xEA, 0x35, 0x7E, 0xCF, 0x54, 0xF2, 0x4B, 0xFA, 0x9A, 0x36, 0xA9,
+    0x8B, 0xC3, 0xD5, 0x1B, 0xFC, 0x02, 0x48, 0x35, 0x30, 0xB5, 0xC0, 0xB2, 0x97, 0x12, 0xBF, 0xA3,
+    0xAF, 0xB8, 0x48, 0x32, 0x0C, 0x8B, 0xDC, 0x15, 0xC0, 0x2F, 0x81, 0xAD, 0x05, 0xE6, 0x01, 0x1E,
+    0xEB, 0x70, 0x38, 0x7C, 0x07, 0x78, 0x04, 0x58, 0x88, 0xC0, 0x53, 0x46, 0x99, 0x2D, 0xFB, 0xDF,
+    0xCC, 0xAA, 0xFE, 0x2F, 0xB7, 0xD2, 0xC9, 0xE1, 0x70, 0xE8, 0x65, 0x81, 0xF1, 0x45, 0x32, 0x54,
+    0x9F, 0x93, 0xC3, 0xFC, 0x79, 0xE9, 0xB2, 0x9C, 0x2A, 0x46, 0xE1, 0x6F, 0x65, 0xC9, 0x58, 0x31,
+    0xFE, 0x3D, 0x87, 0xD7, 0xF9, 0xD7, 0xEC, 0x35, 0xBD, 0x40, 0x4E, 0x52, 0xF3, 0x85, 0xF2, 0xA4,
+    0x97, 0x8A, 0xBB, 0x2A, 0xDC, 0x83, 0x0C, 0x55, 0x8B, 0x23, 0x00, 0x0A, 0x86, 0x7F, 0x71, 0x4B,
+    0x9B, 0xD4, 0x45, 0x1B, 0x65, 0xA2, 0x5D, 0x65, 0xD2, 0xB0, 0x9D, 0x9D, 0xA7, 0x01, 0xF8, 0xAC,
+    0x78, 0x46, 0x14, 0xC6, 0x23, 0x1E, 0x33, 0x3C, 0x28, 0x96, 0x06, 0x58, 0x4A, 0x60, 0x91, 0x83,
+    0x65, 0xC7, 0x14, 0x27, 0xA7, 0x3A, 0xB9, 0xAB, 0x3B, 0x77, 0x75, 0xE7, 0x6E, 0xC6, 0x25, 0x06,
+    0xB9, 0x50, 0xE0, 0x6B, 0x64, 0x36, 0x0D, 0xA1, 0x62, 0x2C, 0x98, 0xDA, 0x58, 0xE1, 0xD5, 0xC5,
+    0x9A, 0x02, 0xAF, 0x8A, 0xEF, 0xE2, 0x99, 0xA4, 0x61, 0x19, 0x02, 0x41, 0x6A, 0x70, 0x99, 0x59,
+    0x3E, 0xF2, 0xA9, 0x1D, 0xB7, 0x66, 0x94, 0x8C, 0x29, 0xDD, 0xC6, 0x22, 0x35, 0x7C, 0x1B, 0x83,
+    0x54, 0xF3, 0x0E, 0xEF, 0x10, 0x54, 0xE1, 0x87, 0xD0, 0x6D, 0x2A, 0xF7, 0x47, 0x14, 0x84, 0x1A,
+    0x0D, 0x51, 0x84, 0x02, 0xDF, 0x30, 0xB2, 0x6A, 0x08, 0x62, 0x19, 0xA2, 0xDA, 0xA8, 0x16, 0x15,
+    0xE7, 0xD7, 0x6A, 0x21, 0xD6, 0x80, 0x07, 0x62, 0xF7, 0xC3, 0xFB, 0x14, 0x79, 0xD3, 0xD9, 0x4C,
+    0xDA, 0xBF, 0xE6, 0x92, 0x06, 0x56, 0xB5, 0x24, 0xD5, 0xB0, 0xE8, 0x70, 0x9F, 0xDD, 0x17, 0xB4,
+    0x51, 0x32, 0xFC, 0x5C, 0x2D, 0xE7, 0xC0, 0x07, 0x3B, 0xFE, 0x9F, 0x3B, 0x78, 0xA0, 0x3B, 0x77,
+    0xA5, 0x43, 0xAF, 0x93, 0xBB, 0x4C, 0x72, 0x89, 0x49, 0x24, 0xA6, 0x92, 0xC4, 0x54, 0x91, 0x98,
+    0x0C, 0x89, 0xA9, 0x25, 0x31, 0xD9, 0xCB, 0xC4, 0x34, 0x3C, 0x4A, 0x4C, 0xBC, 0x95, 0xF8, 0x05,
+    0x26, 0xF1, 0x7E, 0x32, 0x89, 0x0F, 0xA2, 0x49, 0x5C, 0x2C, 0x26, 0x71, 0x19, 0x4C, 0x82, 0xC9,
+    0x24, 0xF0, 0x26, 0x41, 0x6F, 0x12, 0x9B, 0x4C, 0x22, 0xCA, 0x24, 0x56, 0x99, 0xD4, 0x24, 0xE1,
+    0xEB, 0xAD, 0x60, 0xAC, 0x78, 0x85, 0xBE, 0x84, 0x4D, 0x82, 0x28, 0xB5, 0x4C, 0x92, 0xBE, 0xBE,
+    0x6B, 0xFC, 0xAF, 0xAC, 0x43, 0x87, 0x53, 0x9D, 0xDC, 0x65, 0x96, 0x5D, 0x99, 0x45, 0x60, 0x2E,
+    0xF1, 0xCC, 0x35, 0x3D, 0xB3, 0xD9, 0xC4, 0x6C, 0xA3, 0x98, 0xDD, 0x22, 0xAE, 0x99, 0x75, 0xD4,
+    0xA5, 0xA3, 0x32, 0x1B, 0x78, 0x43, 0x10, 0xB3, 0x5B, 0xC5, 0x6C, 0x93, 0x98, 0x5B, 0xC4, 0xDC,
+    0xE0, 0x99, 0x2B, 0xA6, 0xBD, 0x3D, 0xB9, 0xC8, 0x2C, 0xBB, 0xE5, 0xED, 0xD7, 0x02, 0x73, 0x0D,
+    0xAC, 0xC5, 0xAD, 0x5F, 0x3F, 0x76, 0xAB, 0x98, 0x9B, 0x24, 0xBB, 0x96, 0xF4, 0x66, 0xCB, 0x1B,
+    0xCC, 0x2E, 0x62, 0x36, 0x51, 0x76, 0xAD, 0x90, 0xD9, 0xF2, 0x4E, 0xB3, 0x41, 0xCC, 0x6D, 0x94,
+    0x5D, 0x1B, 0x64, 0xB6, 0x37, 0x18, 0x2B, 0x1C, 0x93, 0xB8, 0xCC, 0x94, 0x48, 0xC8, 0x60, 0xB3,
+    0xE2, 0xBB, 0x79, 0x14, 0x0F, 0xD2, 0x9D, 0xC3, 0xAB, 0x04, 0x95, 0xA4, 0xBC, 0xD5, 0x2F, 0x88,
+    0xAA, 0x49, 0x30, 0xC9, 0x71, 0xC1, 0x26, 0x43, 0xE2, 0x32, 0x14, 0xB8, 0x8B, 0x44, 0xDF, 0x7D,
+    0x94, 0x78, 0xB4, 0x56, 0x91, 0x8B, 0x38, 0xF8, 0xE1, 0x51, 0xE2, 0xBD, 0x64, 0x16, 0x2E, 0x62,
+    0x17, 0x30, 0x89, 0x77, 0xE8, 0x02, 0x17, 0xD1, 0x7C, 0x9A, 0x4C, 0xC2, 0x3B, 0x3C, 0x17, 0xB1,
+    0x66, 0x35, 0x09, 0x6F, 0xE9, 0xB9, 0x88, 0x25, 0xC1, 0x24, 0xBC, 0xD9, 0xC4, 0x45, 0x14, 0x93,
+    0x49, 0xF8, 0x26, 0x8A, 0xE9, 0x70, 0xAA, 0x93, 0xD7, 0x19, 0xC5, 0xE5, 0xA6, 0x0A, 0xB7, 0x66,
+    0x88, 0x6C, 0x6F, 0x3E, 0x97, 0xF4, 0xC9, 0x61, 0xB8, 0x01, 0xB8, 0x3C, 0x9E, 0x6F, 0x6D, 0xD9,
+    0x0B, 0xFE, 0x93, 0x15, 0x67, 0xD9, 0x55, 0x85, 0xFB, 0x89, 0x32, 0x53, 0x62, 0x60, 0x93, 0xC9,
+    0xEE, 0xC8, 0x13, 0x62, 0xCD, 0x58, 0xF3, 0x7D, 0x7C, 0x9E, 0x8F, 0x36, 0xD9, 0x45, 0x15, 0x3F,
+    0x4A, 0x3B, 0xFC, 0xB2, 0x57, 0x4C, 0x19, 0x8E, 0x55, 0xBC, 0xB5, 0xA9, 0xE0, 0x7D, 0xBC, 0x5C,
+    0x70, 0x8B, 0x6C, 0x34, 0xF4, 0x43, 0x7A, 0x66, 0x82, 0x95, 0xD7, 0x6B, 0xC3, 0x95, 0xA4, 0x3B,
+    0xBD, 0x74, 0xD8, 0x75, 0x34, 0x17, 0x47, 0x1A, 0x26, 0x65, 0x6A, 0x66, 0x14, 0x17, 0x9B, 0x2A,
+    0x86, 0x55, 0x26, 0x31, 0xCB, 0xFE, 0xD9, 0x49, 0xCB, 0xA1, 0xBF, 0x3F, 0x8B, 0x77, 0xD9, 0xC4,
+    0xA3, 0xCC, 0x6A, 0x31, 0xC1, 0xDB, 0x04, 0xA2, 0x58, 0x08, 0x1A, 0x56, 0x42, 0x36, 0x66, 0xDD,
+    0x8B, 0x45, 0xC8, 0x67, 0x8C, 0x36, 0xB2, 0xCA, 0xAD, 0x6C, 0xFF, 0x94, 0x4F, 0x17, 0x67, 0x00,
+    0xCF, 0x07, 0x20, 0x7E, 0xC5, 0x2A, 0xE6, 0x3B, 0x7D, 0xB6, 0x14, 0x5F, 0x42, 0xA8, 0x70, 0x8F,
+    0x55, 0xEE, 0x5E, 0x89, 0xB7, 0xB0, 0x1A, 0xAE, 0x5D, 0xC1, 0xA2, 0xAF, 0xDB, 0xB4, 0x33, 0x5D,
+    0x76, 0x95, 0x6A, 0xFA, 0x4C, 0x13, 0xDD, 0x46, 0x2A, 0xC6, 0xAC, 0x90, 0x4A, 0x82, 0xD4, 0xF2,
+    0xF8, 0xE5, 0xD1, 0xC1, 0x5A, 0x01, 0x63, 0x03, 0x6B, 0xF6, 0x47, 0x8B, 0xBB, 0x3A, 0x1C, 0x0E,
+    0x87, 0xD7, 0x6E, 0xA1, 0xF8, 0x39, 0xB0, 0xDD, 0x3B, 0xE7, 0xC3, 0x9F, 0xA8, 0x4D, 0xCA, 0x4D,
+    0x1D, 0x0F, 0xBF, 0xF4, 0x67, 0x27, 0x9D, 0xDC, 0x95, 0x4E, 0x4E, 0xDD, 0xA2, 0x0A, 0xCF, 0x2C,
+    0xB3, 0x55, 0x78, 0x0D, 0x4B, 0x4D, 0x5F, 0xE2, 0xCD, 0x26, 0xB3, 0xA9, 0x8B, 0x1A, 0x82, 0xEC,
+    0x52, 0xE2, 0xC5, 0x6C, 0x92, 0x0A, 0xFC, 0x10, 0x54, 0xF1, 0x2D, 0x46, 0x35, 0x9B, 0x49, 0x92,
+    0x39, 0x72, 0xD6, 0xA3, 0x34, 0x5C, 0xC6, 0xE3, 0xB1, 0x7A, 0x49, 0x3E, 0x55, 0x8F, 0x92, 0x0C,
+    0xB3, 0xA4, 0x96, 0xFE, 0x68, 0xA1, 0xF2, 0x30, 0xD6, 0xF9, 0x24, 0x32, 0x1E, 0xD9, 0xC3, 0x7F,
+    0x84, 0x63, 0xED, 0x0A, 0x7A, 0xC9, 0x64, 0xBB, 0xB2, 0x9F, 0xE9, 0x14, 0x67, 0xFD, 0x67, 0x20,
+    0xD8, 0x97, 0x0F, 0xEE, 0x73, 0xB5, 0x5B, 0xA5, 0x65, 0x3F, 0xF3, 0xCB, 0x67, 0x80, 0x4C, 0x0D,
+    0xBF, 0xE5, 0x03, 0x42, 0xCB, 0x37, 0xF1, 0x6E, 0xED, 0x52, 0x81, 0xB7, 0xD1, 0xC6, 0x02, 0xDF,
+    0x26, 0xBB, 0x14, 0x78, 0xB3, 0x0D, 0x7B, 0x10, 0x0A, 0xBC, 0x61, 0x78, 0x2E, 0xD1, 0xAE, 0x05,
+    0xDE, 0x24, 0x1B, 0x0B, 0x7C, 0x17, 0xDB, 0xAD, 0xC0, 0x0F, 0xD1, 0xF0, 0x0E, 0xEF, 0xB2, 0xD4,
+    0x99, 0x3A, 0xC9, 0x7C, 0xD6, 0xB8, 0x9F, 0x9A, 0xA8, 0x24, 0x23, 0x8F, 0x92, 0xE9, 0xCF, 0x7A,
+    0x95, 0x12, 0x2F, 0x9D, 0xDC, 0x55, 0x71, 0x78, 0x85, 0x29, 0x53, 0xE1, 0x2D, 0x72, 0x6B, 0x85,
+    0xAF, 0xF0, 0xC3, 0xBA, 0x53, 0xEB, 0xEE, 0x0F, 0x78, 0x55, 0x90, 0x4F, 0xC7, 0x24, 0x39, 0xBC,
+    0x54, 0xB1, 0x1E, 0xA3, 0x66, 0x3F, 0x14, 0x59, 0xF7, 0xB2, 0x66, 0x33, 0xA8, 0xC2, 0xBB, 0x35,
+    0x37, 0x66, 0x50, 0x4B, 0xC5, 0x24, 0xB7, 0xBA, 0x55, 0x15, 0xFE, 0xE4, 0x54, 0x27, 0x77, 0x2B,
+    0xFA, 0xFC, 0x15, 0x44, 0x17, 0xFF, 0x62, 0xD1, 0xAB, 0xC3, 0xFD, 0xF4, 0x1D, 0xC8, 0x6E, 0x1E,
+    0x99, 0xC5, 0xCE, 0xD1, 0x70, 0xBB, 0x42, 0x86, 0x17, 0x46, 0x4F, 0x4E, 0xB3, 0x62, 0xF5, 0x72,
+    0x59, 0x39, 0x45, 0x35, 0x10, 0xD4, 0x71, 0x9B, 0x74, 0x19, 0xD5, 0xE0, 0x16, 0x75, 0x1B, 0x4B,
+    0x91, 0xDB, 0x7E, 0x08, 0x60, 0x80, 0x58, 0xB3, 0x11, 0x74, 0x52, 0xE6, 0xEF, 0x3D, 0x8E, 0x40,
+    0xDF, 0x85, 0x7D, 0x94, 0xF7, 0xA4, 0xC3, 0xA9, 0x0E, 0xA7, 0x3A, 0xBC, 0xB9, 0x3D, 0xCF, 0x6D,
+    0xFE, 0xF5, 0x6F, 0x9F, 0x1C, 0xF8, 0xE4, 0x90, 0x8D, 0xC1, 0xB3, 0x13, 0xF4, 0xCF, 0xDD, 0xCE,
+    0x7B, 0xEF, 0x7A, 0xBB, 0xCA, 0xAE, 0xB2, 0xAB, 0xD9, 0x6B, 0x57, 0x8C, 0xF9, 0xB7, 0xB7, 0x3A,
+    0xFF, 0x35, 0x0B, 0x3C, 0x39, 0xF0, 0xE4, 0xC0, 0x13, 0xBB, 0x77, 0xEA, 0x62, 0x0F, 0x3F, 0xDD,
+    0xC3, 0x74, 0xE4, 0x6A, 0xFA, 0x9D, 0xC1, 0x9D, 0x72, 0x68, 0x97, 0x1C, 0x9A, 0x94, 0xC3, 0xEA,
+    0xF3, 0x05, 0xEE, 0x9C, 0x1E, 0x0E, 0x07, 0x49, 0x6E, 0x27, 0x59, 0x9E, 0xC9, 0x7B, 0xE7, 0xDB,
+    0x33, 0xE6, 0x71, 0x97, 0xF0, 0x38, 0x7F, 0x9D, 0x31, 0xCA, 0xEC, 0x28, 0x0F, 0xA2, 0xCC, 0x76,
+    0x70, 0x49, 0x66, 0x53, 0xB7, 0xF7, 0xFB, 0xD9, 0xAF, 0xDD, 0x64, 0xB6, 0xC2, 0xA5, 0x63, 0xC9,
+    0xDB, 0x5A, 0x5E, 0x06, 0x56, 0x1D, 0x4E, 0x25, 0x1D, 0xBE, 0xC3, 0x28, 0x95, 0x3C, 0xDA, 0x24,
+    0x35, 0xD8, 0x55, 0xCA, 0xA6, 0x45, 0x72, 0x4F, 0x9F, 0xCF, 0x82, 0x1F, 0xAB, 0x8B, 0xC0, 0x2A,
+    0xF7, 0x34, 0x33, 0x29, 0x8F, 0x80, 0xB5, 0xC1, 0xAE, 0x2F, 0x11, 0xBA, 0xC8, 0x5C, 0x32, 0xB9,
+    0xA7, 0x8C, 0x35, 0xDF, 0xE2, 0xD1, 0xA6, 0x36, 0x35, 0xD8, 0x55, 0x6E, 0xE9, 0x22, 0xF3, 0xCB,
+    0x78, 0xF7, 0x14, 0xD8, 0x72, 0xAD, 0xD0, 0x60, 0x61, 0x53, 0x17, 0x61, 0xEB, 0xE5, 0xC2, 0xE1,
+    0x74, 0x7F, 0x55, 0xE6, 0x17, 0x46, 0xE0, 0xB1, 0x80, 0xD5, 0x1C, 0xBF, 0x9F, 0x79, 0xB4, 0x1D,
+    0x5C, 0x62, 0x2E, 0xF3, 0x92, 0xDA, 0xD7, 0x56, 0xBB, 0x31, 0xBF, 0xCC, 0x05, 0x19, 0x52, 0x61,
+    0x76, 0x87, 0x7A, 0xD4, 0x1D, 0xF7, 0x58, 0x35, 0xAC, 0x1A, 0x20, 0x54, 0x80, 0x6F, 0xCF, 0xD8,
+    0xD4, 0x17, 0xF9, 0x70, 0x3D, 0x5B, 0xAD, 0xC3, 0xEB, 0xF8, 0x0E, 0x62, 0x09, 0x39, 0x52, 0x1C,
+    0x5E, 0xCF, 0x24, 0xC1, 0x5E, 0x86, 0xE5, 0xE7, 0x72, 0x34, 0x3B, 0xD1, 0xB2, 0x34, 0x90, 0xF2,
+    0xE9, 0x5B, 0x71, 0x57, 0x3A, 0x9C, 0xEA, 0xA5, 0x6D, 0x14, 0xB3, 0x06, 0x56, 0x31, 0x97, 0x40,
+    0x9F, 0x1D, 0x42, 0xCF, 0x6C, 0xF8, 0x88, 0xC0, 0xDC, 0x25, 0xB9, 0x65, 0x5F, 0x6D, 0xCC, 0x76,
+    0x51, 0x17, 0xF9, 0xC4, 0x05, 0xB5, 0x11, 0x08, 0x6A, 0xD3, 0x8B, 0x82, 0xC8, 0x3C, 0x04, 0x75,
+    0x31, 0xD7, 0x8B, 0xCC, 0x36, 0x6A, 0x58, 0x99, 0x5B, 0xBE, 0x49, 0xC8, 0xC7, 0x69, 0x33, 0x73,
+    0x95, 0x1F, 0x24, 0xD8, 0xC4, 0xAC, 0x36, 0x1F, 0xA6, 0xE8, 0x90, 0x9D, 0xC5, 0x43, 0x76, 0x72,
+    0x00, 0x2A, 0x80, 0x9A, 0x27, 0x6F, 0x62, 0xE8, 0x1B, 0x0C, 0xDA, 0x45, 0x43, 0xDF, 0xE4, 0x8C,
+    0x8A, 0x63, 0xE1, 0x5C, 0xAD, 0xE5, 0x1C, 0xD9, 0xD8, 0x20, 0xB7, 0x34, 0x14, 0xCC, 0x0D, 0x15,
+    0xBE, 0xC9, 0x0D, 0x74, 0x9B, 0x1A, 0x86, 0xCC, 0x4E, 0xE8, 0x9F, 0x25, 0x3C, 0xA3, 0x78, 0x07,
+    0x9F, 0x63, 0x43, 0xEF, 0x3E, 0xFB, 0xC9, 0xC2, 0x57, 0x8A, 0x03, 0xFF, 0x07, 0xD5, 0xBD, 0x4F,
+    0xAC, 0xE5, 0xC6, 0x9D, 0x2E, 0xF6, 0x91, 0xA5, 0x7B, 0x39, 0x23, 0x62, 0x5C, 0x5A, 0xF4, 0x1D,
+    0xD8, 0xD2, 0x9B, 0x70, 0x16, 0x5E, 0x0C, 0x7A, 0x9E, 0x86, 0x9B, 0x59, 0xBC, 0x85, 0xA4, 0xA2,
+    0x24, 0x24, 0x06, 0x22, 0x04, 0xBA, 0xEF, 0xBD, 0x3E, 0x36, 0x60, 0x2D, 0x34, 0x0B, 0x07, 0x41,
+    0x64, 0x04, 0x9D, 0x00, 0x03, 0xC4, 0x0F, 0x90, 0x55, 0xB4, 0x8D, 0x44, 0x0B, 0x2F, 0xD4, 0xF3,
+    0x10, 0x61, 0x16, 0x6F, 0xE1, 0x9E, 0xA4, 0x07, 0xE8, 0x3E, 0x8D, 0x87, 0x9E, 0xC5, 0x04, 0xF0,
+    0x42, 0x72, 0xD1, 0x6A, 0x24, 0x5A, 0xF4, 0x42, 0x94, 0x3A, 0x86, 0x80, 0x08, 0x81, 0xE8, 0x91,
+    0x64, 0xBF, 0x91, 0x82, 0x74, 0xB9, 0xC5, 0x56, 0xB3, 0x6F, 0x57, 0xF1, 0xCB, 0xE2, 0x57, 0x3C,
+    0xF7, 0xDC, 0x56, 0x4B, 0x96, 0x64, 0x49, 0x96, 0xCE, 0xBD, 0x87, 0xE4, 0xE1, 0x21, 0x79, 0x8A,
+    0x55, 0xC5, 0xAA, 0xDF, 0x9F, 0xEF, 0xF7, 0xFD, 0x76, 0x1A, 0x5E, 0xA2, 0x9D, 0x79, 0x8D, 0x3F,
+    0x3F, 0x0B, 0x00, 0x50, 0xB3, 0x9E, 0xCC, 0xC0, 0x1F, 0x51, 0x07, 0xFB, 0x1B, 0xBE, 0xC8, 0x2A,
+    0xD8, 0xAB, 0xBC, 0xC4, 0x3A, 0xB8, 0xF7, 0xF8, 0x3A, 0x4F, 0x46, 0x00, 0x00, 0xCA, 0x01, 0xC0,
+    0xCF, 0xD2, 0xC6, 0x3D, 0x9C, 0xA1, 0xC9, 0xA0, 0x48, 0xB6, 0x24, 0x7D, 0xC5, 0x97, 0x4F, 0xE6,
+    0x1C, 0x00, 0x13, 0x00, 0xC5, 0x16, 0xB0, 0x23, 0x50, 0xB0, 0xD9, 0xDE, 0x98, 0x00, 0xC5, 0x4E,
+    0x8E, 0xC9, 0xE9, 0xF1, 0x1D, 0xCD, 0x03, 0xD7, 0x38, 0x72, 0xCC, 0x49, 0x36, 0x05, 0x39, 0x62,
+    0x97, 0x6F, 0xDE, 0xF2, 0x5B, 0x38, 0x81, 0xE5, 0xE5, 0xE6, 0x06, 0x25, 0x39, 0xA1, 0x26, 0x47,
+    0x58, 0xD2, 0x83, 0xF1, 0xB1, 0x01, 0xF4, 0x68, 0xC0, 0x1E, 0xB8, 0xDD, 0xC2, 0x92, 0xBC, 0x75,
+    0x91, 0xDD, 0xE6, 0xB8, 0x8C, 0x5D, 0x2A, 0x7A, 0x39, 0x43, 0x4E, 0x9B, 0xDD, 0x6D, 0x16, 0x39,
+    0x90, 0xA3, 0xCE, 0x4E, 0x99, 0x9C, 0x24, 0x0B, 0x92, 0x53, 0x41, 0xB2, 0xD5, 0xF3, 0xE3, 0x01,
+    0xB6, 0xD3, 0x63, 0x1E, 0xA1, 0x87, 0xD2, 0xC3, 0x74, 0x75, 0x0F, 0xC2, 0xB6, 0xC5, 0x04, 0xB6,
+    0xB6, 0x57, 0x24, 0x61, 0x48, 0x2A, 0x92, 0x54, 0x37, 0xDC, 0xDF, 0x8E, 0xAA, 0x45, 0xD1, 0xC8,
+    0xAD, 0x79, 0x64, 0x7C, 0x91, 0x0D, 0xCC, 0x54, 0x07, 0x14, 0x04, 0x7B, 0x70, 0x28, 0x89, 0x2A,
+    0xC0, 0x78, 0xC5, 0x36, 0x67, 0x6B, 0x3C, 0x74, 0x28, 0x67, 0xC0, 0xF5, 0xEC, 0xA0, 0x58, 0x4F,
+    0x40, 0x7D, 0x9D, 0x00, 0xC8, 0x1E, 0x28, 0x19, 0x00, 0x58, 0xB6, 0xC8, 0x48, 0x7A, 0x54, 0x72,
+    0xA7, 0xA4, 0x07, 0x74, 0x44, 0xBA, 0xCD, 0x9D, 0xC7, 0xE7, 0xD5, 0x87, 0x1E, 0xB0, 0xB5, 0xB9,
+    0xAA, 0x5F, 0x7B, 0x2F, 0xBA, 0x93, 0x5B, 0x8B, 0x6B, 0x67, 0x53, 0x53, 0xEC, 0xFC, 0x9B, 0xA3,
+    0x5F, 0xBC, 0x17, 0xDD, 0xB7, 0x5B, 0xDC, 0x7D, 0x0E, 0x19, 0x39, 0x96, 0x64, 0xA8, 0xC8, 0xA9,
+    0xF6, 0x99, 0x37, 0x03, 0x50, 0x7B, 0xA0, 0x8A, 0x80, 0xE6, 0x80, 0x9C, 0x33, 0x14, 0xD9, 0xEB,
+    0x03, 0xFA, 0x6A, 0xA8, 0x43, 0xDD, 0x17, 0xC1, 0xF4, 0x2A, 0xD6, 0x5E, 0xC5, 0x2A, 0xAA, 0xA0,
+    0xF9, 0x7A, 0xC8, 0x49, 0x0F, 0xCB, 0x1E, 0x05, 0x47, 0xC0, 0x06, 0xA0, 0x8C, 0x80, 0x8A, 0x7F,
+    0x8A, 0x22, 0x9A, 0x53, 0x55, 0x30, 0xE4, 0x68, 0xC8, 0xA1, 0xE4, 0x0C, 0xEC, 0x35, 0x00, 0x90,
+    0x87, 0x3C, 0x1A, 0x6F, 0xAE, 0x53, 0xD1, 0x0C, 0x66, 0x38, 0x83, 0x33, 0x9B, 0x5E, 0x93, 0x73,
+    0x6E, 0x00, 0x68, 0x32, 0x02, 0xA8, 0x6F, 0xFC, 0xE7, 0x6E, 0x00, 0xEA, 0x1E, 0x19, 0x81, 0xBA,
+    0x05, 0x4A, 0x8F, 0xBA, 0x2D, 0xE7, 0xC6, 0x41, 0xB7, 0x15, 0xA7, 0xB2, 0xD7, 0x5D, 0x35, 0x47,
+    0x04, 0xD5, 0xEB, 0x21, 0x43, 0xF5, 0x90, 0x2F, 0x3D, 0xA0, 0x7C, 0x50, 0x1E, 0xC0, 0x73, 0x0F,
+    0x64, 0x01, 0x40, 0xA5, 0x1B, 0x0B, 0xA0, 0xB8, 0xDC, 0x57, 0x2D, 0x90, 0x8D, 0x63, 0x31, 0x00,
+    0xF8, 0xFE, 0xF2, 0x65, 0x6B, 0x00, 0x94, 0x2F, 0x78, 0xDD, 0x03, 0xCA, 0x7F, 0x3F, 0x8B, 0x40,
+    0x36, 0xE9, 0xCE, 0xBC, 0xF5, 0x1F, 0x11, 0xB2, 0x51, 0x91, 0xCD, 0x53, 0x30, 0x4D, 0xC5, 0xD6,
+    0x42, 0x8D, 0x00, 0x6C, 0x03, 0xDB, 0x02, 0xAE, 0x81, 0x9A, 0x9B, 0x5D, 0x36, 0x40, 0x4D, 0xCE,
+    0x00, 0xE0, 0x38, 0x01, 0x58, 0xEE, 0x12, 0x28, 0xD8, 0x1B, 0x4E, 0x35, 0xE3, 0x1F, 0x64, 0x33,
+    0x30, 0xEF, 0x72, 0x36, 0x9C, 0xDD, 0xA9, 0x99, 0x98, 0x99, 0xCF, 0xBC, 0x30, 0x5B, 0x3E, 0x55,
+    0x4D, 0x0F, 0xA4, 0x5B, 0xCF, 0x48, 0xF2, 0x3A, 0x49, 0xBE, 0x4E, 0x92, 0x96, 0x64, 0x00, 0xA0,
+    0x3D, 0x00, 0xD3, 0x01, 0x20, 0x00, 0x75, 0x74, 0xD7, 0x6A, 0xB5, 0x7A, 0x9C, 0xCB, 0xEB, 0xDA,
+    0x6A, 0xF5, 0xB1, 0xEA, 0xF1, 0x87, 0x3C, 0x0B, 0x07, 0xDD, 0x3A, 0x0E, 0x65, 0xAF, 0xBB, 0x9A,
+    0x33, 0x82, 0xEA, 0xCB, 0xBE, 0xEE, 0xAA, 0x87, 0x7C, 0x3E, 0x2A, 0xAF, 0x7C, 0xC0, 0xF3, 0x08,
+    0x78, 0xEE, 0x01, 0xD4, 0x8D, 0x41, 0xA5, 0x9B, 0xB2, 0x37, 0x6D, 0x71, 0xB9, 0xCF, 0xC9, 0x2E,
+    0x1B, 0x47, 0x38, 0xB6, 0xF8, 0xFE, 0x03, 0xA8, 0xCF, 0x7B, 0x54, 0xBA, 0x2D, 0xFB, 0x88, 0xF2,
+    0x05, 0x9F, 0x8F, 0xBA, 0x53, 0xFE, 0xFB, 0x78, 0x3E, 0x9F, 0xB2, 0x49, 0x77, 0x75, 0x63, 0x10,
+    0xB2, 0xB1, 0xEC, 0x4B, 0xFF, 0x14, 0xCC, 0x43, 0x23, 0xE2, 0xC7, 0xAE, 0x47, 0xC0, 0x90, 0xE4,
+    0xE1, 0xE2, 0xF8, 0x7A, 0xBD, 0x3E, 0x07, 0x00, 0xF7, 0xCC, 0x28, 0x19, 0x33, 0x72, 0x34, 0x6F,
+    0xB9, 0x17, 0xA7, 0x3C, 0x58, 0x54, 0xAF, 0x7A, 0x44, 0xDB, 0x54, 0x97, 0x63, 0x11, 0x6A, 0xB2,
+    0x25, 0x7D, 0xCE, 0x09, 0xD9, 0x19, 0x00, 0x2B, 0x00, 0xC5, 0x04, 0xA0, 0x1A, 0x00, 0xD8, 0x16,
+    0xC8, 0xE6, 0xAD, 0x5D, 0x3B, 0x2B, 0xF7, 0x8B, 0x95, 0x25, 0x19, 0x37, 0x4D, 0xF1, 0x7F, 0xAF,
+    0xF9, 0xF6, 0xFA, 0xE8, 0x51, 0xB7, 0x9E, 0x78, 0xE7, 0x69, 0x29, 0xE3, 0xD1, 0x13, 0x5F, 0x27,
+    0x49, 0x00, 0x38, 0x39, 0x81, 0xEC, 0xC9, 0xA0, 0xDF, 0xE1, 0x83, 0x9D, 0xE9, 0xA1, 0x47, 0x14,
+    0x01, 0x6A, 0x86, 0xE2, 0xF2, 0x3F, 0x43, 0x71, 0xF5, 0x30, 0x19, 0xE4, 0x06, 0xFF, 0x8F, 0xD5,
+    0x6A, 0x3F, 0x73, 0x6F, 0x66, 0xE4, 0x50, 0x93, 0xB8, 0x51, 0x4D, 0x80, 0x6D, 0x51, 0x8E, 0xF8,
+    0x26, 0xA1, 0xD9, 0x82, 0x13, 0xEE, 0x74, 0x23, 0x60, 0x3B, 0xA8, 0xF0, 0x97, 0xB0, 0x17, 0xE7,
+    0x0B, 0xC1, 0x90, 0x0F, 0x91, 0x7D, 0xB6, 0x3E, 0x05, 0x3C, 0x71, 0x16, 0x1C, 0x15, 0xBB, 0x92,
+    0xA8, 0x26, 0xD8, 0x1E, 0x7B, 0xC0, 0xDE, 0x3E, 0x76, 0x56, 0x76, 0x84, 0x9E, 0x3F, 0xF9, 0xA2,
+    0x9A, 0xED, 0x84, 0x7A, 0xB6, 0x01, 0x66, 0xB6, 0x7C, 0x90, 0xB3, 0x25, 0x39, 0x5B, 0xF2, 0xE6,
+    0x6C, 0xC9, 0x37, 0x66, 0x7B, 0x9D, 0x3F, 0x9C, 0xED, 0x78, 0x4C, 0x26, 0x92, 0x8F, 0xB2, 0x40,
+    0xF6, 0xC4, 0x7A, 0x8D, 0x8A, 0x64, 0x5F, 0x93, 0x1C, 0x6B, 0x92, 0x51, 0x93, 0xBE, 0xFE, 0x06,
+    0x19, 0xCA, 0x57, 0x48, 0xE6, 0x23, 0xC9, 0xEE, 0x79, 0x43, 0xFA, 0xFA, 0x51, 0x32, 0x94, 0x97,
+    0x6F, 0xD9, 0xF9, 0x08, 0x19, 0xCA, 0x97, 0x49, 0xE6, 0xA3, 0x21, 0xBB, 0xE7, 0x0B, 0xD2, 0xD7,
+    0x8D, 0x65, 0x28, 0xFB, 0x9C, 0xCC, 0x47, 0x40, 0x77, 0xCF, 0x03, 0xCA, 0xD7, 0x0D, 0x10, 0xCA,
+    0x1E, 0x30, 0x9F, 0x78, 0xE7, 0x73, 0x65, 0x77, 0xCF, 0x0F, 0xF9, 0x12, 0x6D, 0xE4, 0x35, 0xB6,
+    0x27, 0xA0, 0x3C, 0x6C, 0x53, 0x12, 0x65, 0x80, 0xE9, 0xCA, 0x60, 0xF9, 0x22, 0xBD, 0x99, 0x80,
+    0xBB, 0x4F, 0x95, 0x51, 0xF1, 0x65, 0x46, 0xCB, 0xCB, 0x07, 0xF1, 0x4F, 0xEA, 0x5E, 0x45, 0x98,
+    0xDB, 0x2C, 0xA4, 0x8B, 0xBB, 0x01, 0x64, 0x43, 0x8E, 0xF6, 0x07, 0x34, 0x5D, 0xFD, 0x92, 0x2F,
+    0xAE, 0x87, 0x2C, 0x12, 0xD6, 0x76, 0xF5, 0xAB, 0x93, 0xF6, 0xE4, 0x54, 0x71, 0x82, 0x1B, 0x37,
+    0xB3, 0xBB, 0x6D, 0x91, 0xB1, 0x83, 0x8A, 0x40, 0x4D, 0xA0, 0xF6, 0x50, 0x0C, 0x00, 0x1B, 0x18,
+    0x7A, 0x94, 0x13, 0xF0, 0x7D, 0xDB, 0xC1, 0x74, 0xC0, 0xBF, 0x26, 0xD4, 0x0C, 0xA0, 0x0C, 0xA8,
+    0x3C, 0x80, 0xDA, 0x83, 0x0D, 0x00, 0xD7, 0x15, 0x01, 0x40, 0x4E, 0x98, 0x1E, 0x40, 0x19, 0x72,
+    0xC2, 0x0E, 0xA8, 0xBD, 0x1E, 0x15, 0x5B, 0xB8, 0xCE, 0xB5, 0xF5, 0x8C, 0x9C, 0x2A, 0x64, 0x9C,
+    0x50, 0x06, 0x33, 0x68, 0x0E, 0xD8, 0x79, 0x90, 0x78, 0x9E, 0x2D, 0xA0, 0xA7, 0xE2, 0xDD, 0x19,
+    0x80, 0xED, 0xCC, 0xA3, 0x13, 0xA0, 0x62, 0x3E, 0xC9, 0xEC, 0x51, 0x75, 0x6C, 0x01, 0x36, 0x24,
+    0x07, 0x94, 0x93, 0x22, 0xD9, 0xC1, 0x74, 0x9A, 0x4C, 0x05, 0x61, 0x8B, 0xCA, 0x03, 0x6A, 0x06,
+    0xE4, 0x42, 0x9B, 0x3B, 0x82, 0xF5, 0x00, 0x1B, 0xE4, 0xF4, 0xC8, 0x09, 0x68, 0x7A, 0xA8, 0x88,
+    0xCD, 0x2D, 0x55, 0x8F, 0x7B, 0x68, 0x0F, 0xEC, 0x54, 0x1E, 0x66, 0x90, 0x7B, 0xB1, 0xDD, 0xD6,
+    0x3D, 0xD5, 0x3E, 0x23, 0x00, 0xD4, 0x5E, 0x45, 0x9C, 0x00, 0x6A, 0x5F, 0x86, 0x8A, 0x1D, 0x6A,
+    0xAF, 0x47, 0xD2, 0xA3, 0xF6, 0xF5, 0x40, 0x4E, 0xA8, 0xBD, 0xE9, 0xBE, 0xAF, 0x03, 0x6A, 0xCF,
+    0xF6, 0xAE, 0x22, 0x60, 0xE7, 0x41, 0x02, 0x65, 0x90, 0x42, 0xE9, 0x11, 0x28, 0x02, 0x60, 0xBC,
+    0x6C, 0xB3, 0x4B, 0xF5, 0x0B, 0xC0, 0xF4, 0xD0, 0x01, 0x80, 0x6B, 0x61, 0xBC, 0x0C, 0xC9, 0x7C,
+    0xFB, 0x1C, 0xD4, 0x8C, 0x8C, 0x8C, 0x28, 0x82, 0xAC, 0xF5, 0x24, 0xEB, 0xF4, 0x2A, 0xD9, 0x00,
+    0x44, 0x4E, 0xB6, 0x28, 0x27, 0x68, 0xB2, 0x81, 0xED, 0xA0, 0x1F, 0x9A, 0xA5, 0x46, 0xD4, 0x24,
+    0x4D, 0x53, 0xF5, 0x60, 0x03, 0x7C, 0x93, 0x28, 0x02, 0xA0, 0xD8, 0xC3, 0xF4, 0x80, 0x66, 0x9F,
+    0x13, 0xC0, 0xDD, 0xAE, 0xD7, 0x23, 0x00, 0x98, 0xCE, 0xB5, 0x00, 0xC0, 0x87, 0x43, 0xCE, 0xAC,
+    0x55, 0xC1, 0x0C, 0x55, 0x28, 0x0E, 0xDC, 0x6F, 0x08, 0xFA, 0x8A, 0x7C, 0x74, 0x2C, 0xD9, 0xD5,
+    0x1C, 0x6D, 0xF7, 0x14, 0xB1, 0xFB, 0xF7, 0x2A, 0xAA, 0xEB, 0x01, 0x40, 0xED, 0xEB, 0xC7, 0x3D,
+    0x00, 0x3E, 0x18, 0x6C, 0x07, 0x94, 0x93, 0xFE, 0x39, 0x01, 0x98, 0xEE, 0x67, 0x45, 0x00, 0xD4,
+    0xAC, 0x48, 0x36, 0xA8, 0x7C, 0x45, 0x46, 0x80, 0x8D, 0x25, 0x47, 0x14, 0x01, 0x28, 0x22, 0x60,
+    0x7A, 0xA0, 0x92, 0x56, 0x81, 0xED, 0x44, 0xE0, 0xAB, 0x53, 0x21, 0x61, 0x62, 0x12, 0x16, 0xAB,
+    0x09, 0xC0, 0x31, 0x6C, 0xBD, 0xEE, 0x3C, 0x83, 0xD4, 0xCC, 0x23, 0xA0, 0xD8, 0x00, 0xF4, 0x80,
+    0x8D, 0x40, 0xCD, 0x06, 0x25, 0x7B, 0x64, 0xF4, 0x8B, 0x24, 0xDA, 0x48, 0xA5, 0x2B, 0x36, 0xB8,
+    0xCB, 0x04, 0x9C, 0x54, 0x24, 0xA7, 0x8A, 0x64, 0xE7, 0xC8, 0x98, 0x91, 0x11, 0xD9, 0xFA, 0x0C,
+    0x80, 0x3B, 0xB0, 0xD3, 0x00, 0x3A, 0x66, 0x13, 0xA0, 0x38, 0xBB, 0x06, 0x70, 0x22, 0x19, 0xFD,
+    0x8A, 0x11, 0xC8, 0xA6, 0x9C, 0x0D, 0xB0, 0x83, 0x6C, 0xAB, 0x24, 0x35, 0x5B, 0x40, 0x9E, 0x12,
+    0xC0, 0x8A, 0xF0, 0x24, 0xD3, 0x0D, 0xE9, 0x01, 0x54, 0x07, 0x6C, 0x00, 0xC5, 0xC7, 0x27, 0x00,
+    0xC6, 0xB3, 0x03, 0x4A, 0xEA, 0x08, 0x80, 0x83, 0xF3, 0x80, 0x8E, 0x05, 0x81, 0x9C, 0x9D, 0x19,
+    0x01, 0x33, 0xE5, 0xEC, 0x50, 0xB0, 0xA9, 0x02, 0xE0, 0x3C, 0x38, 0x40, 0x13, 0x5A, 0x24, 0x34,
+    0x8E, 0xA8, 0x49, 0xB2, 0x55, 0x24, 0x19, 0x60, 0x49, 0xB2, 0x2F, 0xF9, 0xF6, 0xDA, 0xCD, 0xA0,
+    0x07, 0xE8, 0xAB, 0x19, 0x28, 0xF9, 0x30, 0x7B, 0xC0, 0x4E, 0x72, 0xF3, 0x2F, 0xB2, 0x05, 0xEA,
+    0xC8, 0x11, 0x52, 0x25, 0xD9, 0x3E, 0x00, 0x80, 0x83, 0xCC, 0x7F, 0x1D, 0x80, 0xE2, 0x5A, 0x04,
+    0x80, 0xE7, 0x8A, 0x01, 0x40, 0xD9, 0x3D, 0x05, 0x00, 0xF6, 0xF1, 0xFE, 0xF0, 0xB6, 0xD2, 0x61,
+    0xD2, 0xF3, 0xC8, 0x41, 0x24, 0x00, 0x00, 0x19, 0x2F, 0x8C, 0x00, 0xCC, 0x35, 0xB6, 0x80, 0xA2,
+    0xF4, 0x61, 0xCF, 0x1E, 0xD0, 0x73, 0x49, 0x00, 0xEC, 0xAD, 0x07, 0xEA, 0xA0, 0xD8, 0x40, 0xB1,
+    0xAD, 0x03, 0x60, 0xC7, 0x8C, 0x1D, 0x4A, 0x42, 0xCF, 0x00, 0x3D, 0x92, 0x10, 0xCA, 0x26, 0x27,
+    0xC9, 0x49, 0xE6, 0xE4, 0xAE, 0x20, 0xC9, 0x08, 0x37, 0xAF, 0xCF, 0x73, 0xD0, 0x04, 0x34, 0x33,
+    0x0E, 0x80, 0x1B, 0x4D, 0x04, 0x0A, 0xFE, 0x48, 0x94, 0x08, 0x3B, 0x01, 0x39, 0x5F, 0x67, 0x03,
+    0x54, 0x22, 0x04, 0x93, 0xEC, 0x21, 0x15, 0x15, 0x01, 0xB5, 0xEC, 0xB0, 0x69, 0x87, 0x4E, 0x3B,
+    0x32, 0xBE, 0xC0, 0x0E, 0x00, 0xCC, 0x54, 0x05, 0x11, 0xAA, 0x32, 0xD9, 0xE1, 0x06, 0xD9, 0xA1,
+    0xA3, 0xEC, 0xC8, 0xD9, 0x55, 0x11, 0x00, 0xCC, 0x98, 0x91, 0x0C, 0x28, 0x89, 0x8A, 0x64, 0x07,
+    0x0E, 0xB2, 0xA3, 0x0A, 0xB2, 0x43, 0xB1, 0xCB, 0xF9, 0xD6, 0xEA, 0x04, 0x16, 0x19, 0xAB, 0x24,
+    0xC9, 0x2E, 0x15, 0x2B, 0x20, 0x15, 0xAB, 0x03, 0x14, 0xDF, 0x5E, 0xBB, 0xB0, 0x88, 0xFC, 0x1D,
+    0xA0, 0x67, 0xA0, 0x9A, 0xD7, 0xEB, 0xBF, 0x61, 0x8F, 0x8C, 0x64, 0x34, 0x01, 0xA8, 0x48, 0xBE,
+    0xCA, 0x46, 0x76, 0xD0, 0xCB, 0x8E, 0x3E, 0x27, 0xFF, 0x59, 0x84, 0x1A, 0xB6, 0xC8, 0x49, 0xB2,
+    0x95, 0xEB, 0x22, 0x55, 0x60, 0x1D, 0x50, 0xB3, 0xCF, 0xD9, 0xC1, 0x10, 0x75, 0x00, 0x38, 0xE6,
+    0xEC, 0x50, 0xB2, 0xAB, 0x03, 0x60, 0x42, 0xCE, 0x0E, 0x8A, 0x2F, 0xB8, 0x79, 0x8D, 0x3A, 0x1A,
+    0xD2, 0xE7, 0xBC, 0x4C, 0xF2, 0xD6, 0x0F, 0x72, 0xD8, 0xD6, 0x39, 0xA5, 0xB4, 0x9F, 0x5C, 0x4D,
+    0x2E, 0x5D, 0xB3, 0xCF, 0xF9, 0x76, 0xD2, 0xC6, 0x38, 0x4B, 0x09, 0x9A, 0xC3, 0xB2, 0xCD, 0x0D,
+    0xE4, 0xB1, 0x02, 0x50, 0xC5, 0x6C, 0x02, 0x0A, 0x79, 0xAC, 0xF8, 0x5B, 0x1E, 0xAB, 0xCC, 0x71,
+    0xC0, 0xA2, 0x97, 0x38, 0x92, 0xBD, 0xDC, 0x63, 0x53, 0x72, 0x3E, 0xCF, 0x00, 0x46, 0x94, 0xF4,
+    0x35, 0x81, 0x4A, 0xBA, 0xBB, 0x9B, 0x6C, 0x00, 0x0A, 0x5E, 0x62, 0x0B, 0x98, 0xE0, 0x46, 0xE9,
+    0x17, 0x00, 0xEA, 0x48, 0x0F, 0xE4, 0xBC, 0x42, 0x00, 0xD5, 0xBC, 0xF5, 0xA1, 0x8E, 0x72, 0xD8,
+    0x6B, 0x72, 0x8E, 0x0D, 0x80, 0xE2, 0x45, 0xB9, 0x9A, 0x5C, 0xBA, 0x61, 0x40, 0x41, 0x5F, 0x72,
+    0xFE, 0x2E, 0xA3, 0xF4, 0xCC, 0x16, 0x24, 0x39, 0x20, 0x27, 0x39, 0x02, 0x39, 0xF9, 0xE6, 0x96,
+    0x4C, 0x79, 0x07, 0x46, 0xA8, 0xDE, 0xF4, 0xE0, 0x37, 0xD8, 0x98, 0xA9, 0x8A, 0x7A, 0x86, 0xBD,
+    0xCE, 0x36, 0x23, 0x07, 0x14, 0x9C, 0xA4, 0x9B, 0x2A, 0x7A, 0x80, 0xEC, 0x60, 0x48, 0xE8, 0xB9,
+    0x0A, 0x8A, 0xAD, 0xF5, 0x76, 0xC8, 0xF8, 0x83, 0x09, 0x85, 0xDF, 0x05, 0xFE, 0x05, 0x6E, 0x79,
+    0x7D, 0x05, 0xC8, 0x1C, 0x7F, 0x19, 0x65, 0x24, 0xE8, 0xE0, 0x0E, 0xC7, 0x83, 0xA6, 0xE4, 0x7C,
+    0x41, 0xEA, 0x44, 0xD3, 0xD7, 0x44, 0x46, 0x3E, 0xCC, 0x1E, 0x86, 0x93, 0x0D, 0xD0, 0x37, 0x79,
+    0x89, 0x6D, 0x46, 0x13, 0xDC, 0x08, 0xF3, 0x02, 0x5F, 0x27, 0xF4, 0x58, 0x47, 0xFA, 0x6C, 0xCE,
+    0x79, 0x85, 0x30, 0x5D, 0x35, 0xD3, 0xEB, 0x31, 0xE7, 0x15, 0x66, 0x33, 0xEA, 0xE8, 0x46, 0xD3,
+    0xE5, 0x7C, 0x8D, 0xCF, 0x8C, 0x30, 0xC1, 0xC6, 0x19, 0x8A, 0x17, 0xC9, 0x0E, 0x6E, 0xAA, 0x39,
+    0xA2, 0xE2, 0x83, 0xE4, 0xFB, 0xEA, 0x24, 0x97, 0x3A, 0x31, 0x24, 0x47, 0xE8, 0x03, 0xF2, 0x4D,
+    0xA0, 0x96, 0x3A, 0xD9, 0xC8, 0xDA, 0xC7, 0xCF, 0x02, 0x00, 0x47, 0x00, 0x39, 0x7B, 0x00, 0x05,
+    0x01, 0xC8, 0xBC, 0x27, 0xD3, 0x2E, 0xF6, 0x0E, 0xB5, 0xFC, 0x11, 0xA8, 0x83, 0x0D, 0x80, 0x0D,
+    0x26, 0x02, 0xF4, 0x15, 0x91, 0x71, 0x28, 0xD9, 0x28, 0x76, 0x8A, 0x5D, 0xC1, 0x36, 0x67, 0xAF,
+    0xB9, 0x8C, 0x7A, 0x6E, 0x34, 0x01, 0x30, 0xC1, 0x8E, 0x4B, 0x8B, 0x6B, 0xB2, 0x07, 0x8A, 0xF4,
+    0xBC, 0xB1, 0x01, 0x32, 0x91, 0x9C, 0xD3, 0x50, 0x3D, 0xC9, 0xD3, 0xFF, 0x49, 0x97, 0xD6, 0x03,
+    0xB9, 0x8C, 0xE6, 0x69, 0xCE, 0x82, 0x3B, 0x38, 0xD7, 0xE4, 0x24, 0x87, 0x72, 0x11, 0x39, 0xBD,
+    0x23, 0x79, 0x95, 0xDD, 0x3D, 0x7C, 0x8D, 0x28, 0x79, 0x21, 0x40, 0xD3, 0x79, 0x98, 0x99, 0x1D,
+    0x78, 0x93, 0x50, 0xBC, 0x10, 0x50, 0xCF, 0xCE, 0xEF, 0xF2, 0x2A, 0x49, 0xFE, 0x98, 0x64, 0xA8,
+    0xD3, 0xCC, 0x34, 0xE5, 0x7C, 0xFB, 0xCC, 0xF6, 0xE5, 0x8F, 0xFC, 0x22, 0xD2, 0x9C, 0x75, 0x92,
+    0x3C, 0x85, 0x9C, 0xE4, 0x84, 0x92, 0xE4, 0x2C, 0x83, 0x29, 0x0C, 0x51, 0xB1, 0x31, 0x01, 0x05,
+    0x5B, 0x33, 0x41, 0xB1, 0xB5, 0x23, 0x4A, 0x36, 0x76, 0x44, 0x35, 0xC3, 0x8E, 0x70, 0x01, 0x76,
+    0x54, 0xF4, 0xB0, 0x63, 0xC9, 0x16, 0x76, 0xD4, 0x33, 0x60, 0xC7, 0x8A, 0x80, 0x1D, 0x35, 0x3B,
+    0xD8, 0x51, 0x73, 0x84, 0x1D, 0x15, 0x09, 0x3B, 0x82, 0xEC, 0xEC, 0x88, 0x8A, 0xDE, 0x8E, 0xC8,
+    0x39, 0xD9, 0x11, 0xB0, 0xC1, 0x8E, 0x4B, 0x9D, 0x9B, 0x60, 0xC7, 0xBF, 0x84, 0x0D, 0x76, 0x34,
+    0xEF, 0x70, 0xB2, 0xA3, 0x21, 0xBD, 0x1D, 0x0D, 0xD9, 0xDB, 0xB1, 0x92, 0xF9, 0x70, 0xAF, 0x01,
+    0xB2, 0x26, 0xDB, 0x87, 0x1B, 0x74, 0xA7, 0x79, 0x63, 0x86, 0x25, 0x47, 0x75, 0xC3, 0xB1, 0xD5,
+    0x5D, 0x35, 0xE1, 0xD8, 0x66, 0x00, 0xD8, 0x75, 0x67, 0x50, 0x50, 0x7A, 0x57, 0x84, 0x23, 0x43,
+    0x36, 0x7F, 0x93, 0x63, 0xDE, 0x64, 0x1C, 0x92, 0x48, 0xA0, 0x89, 0x9D, 0x35, 0xC3, 0xEE, 0x52,
+    0xC9, 0x97, 0x38, 0x5F, 0xA0, 0x89, 0x30, 0x91, 0x03, 0x78, 0x9D, 0x8D, 0xE2, 0xEB, 0x11, 0x15,
+    0x6D, 0xC8, 0x18, 0x48, 0xF2, 0x2A, 0x39, 0xF3, 0x22, 0xF9, 0x0A, 0x73, 0xC6, 0x22, 0x40, 0x74,
+    0xDA, 0xBD, 0x45, 0x8C, 0x72, 0x04, 0xD4, 0xB5, 0x19, 0xA8, 0xDA, 0x00, 0x3C, 0xA5, 0x3C, 0x10,
+    0x6D, 0x8B, 0x9C, 0x21, 0x55, 0x3A, 0xF6, 0x97, 0xA1, 0xE9, 0xC2, 0x3F, 0x23, 0x23, 0xD9, 0x68,
+    0x92, 0x4D, 0x4D, 0x12, 0xF6, 0x59, 0x17, 0x71, 0x4A, 0xBA, 0x14, 0x3D, 0xA0, 0xD8, 0x65, 0x4F,
+    0x38, 0x66, 0x2E, 0xB5, 0xE6, 0x55, 0xF2, 0x3C, 0x5F, 0x62, 0xA3, 0x69, 0x27, 0x98, 0xC8, 0x1E,
+    0xBC, 0xCE, 0xA6, 0xE0, 0xEB, 0x84, 0xA5, 0x21, 0x19, 0x1C, 0xE9, 0x3C, 0x39, 0xBA, 0xCE, 0xF1,
+    0x41, 0xCA, 0x93, 0xB3, 0xCB, 0x53, 0x99, 0x3B, 0x83, 0x9C, 0x8C, 0x15, 0x89, 0x82, 0xA4, 0x23,
+    0x7B, 0x99, 0xD2, 0xE8, 0xB3, 0xF9, 0x9B, 0x64, 0x6F, 0x27, 0x34, 0xB0, 0x33, 0xAA, 0x00, 0xC0,
+    0x04, 0x31, 0xDC, 0x98, 0x80, 0x72, 0xC6, 0xCE, 0x9A, 0xF3, 0xFA, 0xC2, 0x9C, 0x25, 0x35, 0xBE,
+    0x4C, 0xEB, 0x9A, 0x6F, 0x3B, 0x92, 0x34, 0x51, 0x7A, 0xB3, 0x9D, 0xD2, 0x7A, 0x84, 0x0D, 0xB2,
+    0x76, 0x33, 0x00, 0x1B, 0x72, 0xB2, 0xCD, 0x7E, 0x6A, 0xE4, 0xB4, 0xA9, 0x26, 0x27, 0x92, 0x53,
+    0x29, 0x3A, 0xD5, 0x94, 0x71, 0xC6, 0x2E, 0x79, 0x0A, 0x3B, 0x0D, 0xB0, 0xB3, 0x0F, 0x64, 0x0D,
+    0x1A, 0x20, 0xE6, 0x1E, 0xE0, 0xAF, 0x67, 0xA0, 0x26, 0x5B, 0x80, 0x4C, 0x06, 0x29, 0x38, 0x8E,
+    0x80, 0xB9, 0xC9, 0x06, 0x45, 0xEF, 0x3C, 0xD0, 0x6A, 0x11, 0x93, 0x3A, 0x58, 0x9E, 0x1C, 0x41,
+    0x92, 0x20, 0xC9, 0x8E, 0x24, 0x47, 0x1B, 0x33, 0xC6, 0x3A, 0x42, 0xF3, 0x19, 0x22, 0xE3, 0x1B,
+    0x6C, 0x61, 0x26, 0x0E, 0xD0, 0xB3, 0x99, 0xA0, 0xF8, 0xCC, 0x8C, 0x8C, 0x97, 0xD9, 0xC1, 0x79,
+    0x37, 0xC2, 0x04, 0xCD, 0xC6, 0xC4, 0x9C, 0x8B, 0x79, 0x0D, 0x39, 0x49, 0xE0, 0x1E, 0x46, 0x00,
+    0x3B, 0x0D, 0x80, 0xAC, 0xC1, 0x3E, 0x0A, 0x36, 0xCF, 0xA3, 0x60, 0x74, 0x50, 0x24, 0xBB, 0x2C,
+    0x5A, 0x76, 0x78, 0x1E, 0xAE, 0xDB, 0x9E, 0x7D, 0x32, 0x77, 0x1A, 0x28, 0xC9, 0x4E, 0xCC, 0x1C,
+    0x9A, 0x64, 0xAF, 0xF9, 0x2B, 0x86, 0x82, 0x5D, 0xC9, 0x1F, 0xB2, 0x07, 0x3D, 0x3D, 0xEA, 0x68,
+    0x26, 0x14, 0x7C, 0x74, 0x06, 0xDE, 0x5F, 0x3A, 0x22, 0xE3, 0x2B, 0xEC, 0xE0, 0xBC, 0x9D, 0x60,
+    0x82, 0x66, 0x6B, 0x63, 0x46, 0x92, 0x87, 0x06, 0x37, 0xA0, 0x3C, 0x2C, 0x1D, 0x8E, 0x2D, 0x6A,
+    0xBF, 0xC8, 0xFF, 0x1D, 0x44, 0x26, 0x56, 0xE3, 0xD6, 0x1C, 0xF0, 0x7E, 0x4B, 0xC0, 0x9C, 0x4A,
+    0x7C, 0x0A, 0x10, 0x51, 0x5F, 0x06, 0x3B, 0x51, 0xCB, 0x80, 0xB2, 0xDF, 0x9C, 0x7B, 0xF2, 0xCD,
+    0xBF, 0x46, 0x4E, 0xB2, 0x2D, 0x98, 0xFA, 0xD0, 0xA8, 0x38, 0x93, 0x19, 0xBD, 0x66, 0xEF, 0x7C,
+    0xC1, 0x60, 0x82, 0x22, 0xF5, 0xAC, 0x66, 0xBE, 0xCA, 0x07, 0x67, 0x73, 0x8D, 0x3D, 0xF5, 0x6C,
+    0x47, 0x3E, 0xCC, 0x67, 0x66, 0xFB, 0x03, 0x5E, 0x26, 0x3B, 0x3B, 0x92, 0xBD, 0x09, 0x15, 0x87,
+    0x8A, 0x8A, 0x63, 0xCD, 0xC6, 0x92, 0x6C, 0x4B, 0x91, 0x7E, 0xC8, 0x36, 0x9F, 0x39, 0x37, 0xF8,
+    0xCF, 0xB2, 0xFD, 0xC3, 0x52, 0xAF, 0x4F, 0x43, 0x44, 0x79, 0x79, 0xD0, 0x44, 0xA8, 0xB2, 0x03,
+    0x44, 0x76, 0xDF, 0x32, 0xED, 0xAE, 0xF6, 0x81, 0xD5, 0x23, 0x6C, 0x60, 0x82, 0x99, 0xA0, 0xF8,
+    0x23, 0x76, 0xB0, 0x63, 0x15, 0x51, 0x12, 0x1C, 0x0E, 0x2D, 0xA1, 0x63, 0xCE, 0x4E, 0xB1, 0x35,
+    0x23, 0xAA, 0x50, 0x10, 0x60, 0xEF, 0x06, 0x94, 0xB3, 0x8E, 0x80, 0xF9, 0xCD, 0xC6, 0x28, 0x5A,
+    0x25, 0xA3, 0xA8, 0x5F, 0xEA, 0xD9, 0x48, 0xDD, 0x4C, 0x00, 0x2A, 0x36, 0xE9, 0x49, 0x85, 0x9E,
+    0xB1, 0x3C, 0xE0, 0x26, 0x00, 0xD0, 0x6C, 0x90, 0x9D, 0xA7, 0x07, 0x6A, 0x79, 0xF4, 0xC5, 0x80,
+    0xD4, 0x2F, 0x93, 0xD6, 0xF1, 0xD3, 0xF8, 0x88, 0x56, 0x88, 0x7B, 0xDE, 0x84, 0x1D, 0xC9, 0xC6,
+    0x5E, 0x27, 0x7B, 0x4B, 0xD2, 0x5B, 0xBE, 0xC3, 0x60, 0x09, 0x1B, 0x6C, 0x40, 0x1D, 0xED, 0x04,
+    0x3D, 0xDB, 0x09, 0x9A, 0x76, 0x3C, 0xBA, 0x98, 0xD2, 0x62, 0xB6, 0x01, 0xD5, 0x6C, 0x23, 0x4C,
+    0xB4, 0xFC, 0x1B, 0x06, 0x4B, 0x72, 0x94, 0x4B, 0x5D, 0x27, 0x3B, 0x3B, 0xBA, 0x19, 0x76, 0xCC,
+    0x9A, 0x8F, 0x6E, 0x16, 0x11, 0xFB, 0xE1, 0xA4, 0x26, 0x80, 0x9D, 0xEB, 0xA1, 0x83, 0x8E, 0x80,
+    0xEB, 0x5C, 0x87, 0xEC, 0x74, 0x76, 0x7A, 0x5B, 0xE2, 0xF8, 0x52, 0x34, 0x07, 0xB2, 0xD5, 0xEA,
+    0x84, 0x3C, 0x1A, 0x1D, 0x50, 0x30, 0x99, 0xBF, 0xD9, 0x6D, 0xBE, 0xF9, 0x72, 0xAA, 0x69, 0xAB,
+    0xD5, 0x0A, 0x2A, 0x8D, 0x3E, 0x23, 0x0C, 0xD9, 0x63, 0xB5, 0x31, 0xC3, 0x7E, 0xF7, 0xA0, 0x81,
+    0x4D, 0x4F, 0x71, 0x5F, 0x92, 0xEC, 0xAA, 0xB7, 0x4E, 0xB2, 0xF9, 0x3A, 0xAA, 0x79, 0xA9, 0x37,
+    0x7A, 0x7C, 0xFB, 0x02, 0xBB, 0x93, 0x69, 0xDC, 0x0F, 0x8E, 0x6F, 0xF3, 0x5D, 0xF6, 0x8A, 0xAF,
+    0xCF, 0xD2, 0xCB, 0x4C, 0x64, 0x9F, 0xF1, 0x3A, 0xBB, 0x8A, 0x2F, 0xC9, 0xAC, 0xC0, 0x2B, 0xC1,
+    0x30, 0xD6, 0xBE, 0x66, 0x6F, 0xBB, 0x9D, 0x7D, 0x19, 0x3E, 0xEA, 0x06, 0x70, 0x28, 0x46, 0xA0,
+    0xE0, 0x79, 0x8A, 0x06, 0xD3, 0x03, 0x20, 0x47, 0x00, 0x59, 0x32, 0xA8, 0xDE, 0xF5, 0xA5, 0xD5,
+    0x87, 0xB3, 0x09, 0xC5, 0x50, 0x78, 0x98, 0x56, 0xCF, 0x17, 0x02, 0x2A, 0x72, 0x40, 0xCD, 0x19,
+    0xA8, 0xD8, 0x6F, 0x09, 0xAF, 0x9F, 0x9F, 0x40, 0xF2, 0x65, 0x33, 0x27, 0x00, 0xA5, 0x17, 0xDF,
+    0x8B, 0x18, 0xD4, 0x9B, 0xC3, 0x5D, 0x10, 0x31, 0x55, 0xCF, 0x83, 0xF8, 0xED, 0xC4, 0x7F, 0x30,
+    0x00, 0xC0, 0xEE, 0x59, 0xEC, 0xBA, 0x33, 0x22, 0x46, 0xA9, 0xA4, 0xD4, 0x8A, 0x44, 0x33, 0x2E,
+    0x72, 0x94, 0x49, 0x02, 0xCD, 0xCE, 0x9A, 0x21, 0x73, 0x64, 0x28, 0x45, 0x36, 0x3E, 0x70, 0xC1,
+    0x44, 0xD1, 0xFC, 0x4D, 0xB0, 0xA3, 0x2C, 0x6C, 0xB0, 0x21, 0x63, 0x30, 0x49, 0x7C, 0xBE, 0x12,
+    0x34, 0xF9, 0x48, 0x90, 0x7A, 0xDD, 0x6B, 0xF4, 0x00, 0xC0, 0xB4, 0x00, 0x1C, 0x00, 0xCC, 0x9B,
+    0xB2, 0xF1, 0xFF, 0x05, 0x20, 0xA3, 0x51, 0x04, 0xB0, 0x7B, 0x06, 0xC0, 0xF1, 0x73, 0x00, 0xEA,
+    0x19, 0x90, 0xA7, 0x49, 0xC7, 0x45, 0x47, 0xD1, 0x13, 0x36, 0xD6, 0x13, 0xF1, 0x26, 0xBC, 0x89,
+    0x9C, 0xE4, 0xB0, 0x71, 0xFF, 0x05, 0x45, 0x9E, 0x9F, 0x15, 0x27, 0x94, 0x0F, 0x72, 0x04, 0xC0,
+    0xCD, 0x8D, 0x54, 0xF3, 0x32, 0xFF, 0x29, 0x31, 0x08, 0xF8, 0xC3, 0x11, 0x0E, 0x47, 0x76, 0xD6,
+    0x11, 0x40, 0x21, 0x9F, 0x47, 0x88, 0x19, 0x16, 0x05, 0x47, 0x64, 0xAD, 0xE3, 0x5B, 0x27, 0xBD,
+    0x26, 0x19, 0x44, 0x58, 0x2A, 0x49, 0x76, 0x49, 0xCC, 0xDA, 0xDB, 0x07, 0x90, 0xAF, 0x4F, 0x01,
+    0x6E, 0x12, 0x47, 0x5B, 0xC1, 0x46, 0xE4, 0x01, 0x33, 0x6C, 0x95, 0x3B, 0x73, 0x6F, 0x22, 0x4F,
+    0x57, 0xE8, 0x0C, 0x39, 0x95, 0x3C, 0x60, 0xC6, 0x11, 0x7F, 0x55, 0xCF, 0x5B, 0xAE, 0x59, 0xC5,
+    0x56, 0xD4, 0x9C, 0xAD, 0x8D, 0x2D, 0xAF, 0xED, 0x1D, 0x9A, 0xFD, 0xE3, 0xAD, 0x23, 0x27, 0x95,
+    0xE6, 0xFF, 0x49, 0x64, 0xAD, 0xEC, 0xC4, 0xA2, 0xE9, 0x19, 0xB6, 0x40, 0xCD, 0x11, 0xA8, 0x6E,
+    0xB2, 0x41, 0x35, 0xD6, 0x23, 0xAA, 0x31, 0x23, 0xB2, 0xFD, 0x24, 0xF2, 0x7C, 0x21, 0xEB, 0x30,
+    0x5F, 0xB7, 0x00, 0x67, 0x29, 0x7A, 0x39, 0xB3, 0xCF, 0xF8, 0x10, 0x61, 0xFB, 0x32, 0x1C, 0x96,
+    0xFB, 0xF3, 0xA8, 0xC3, 0xDD, 0x06, 0xC9, 0x09, 0xBD, 0x7D, 0xB3, 0x13, 0x80, 0x7C, 0x3A, 0x6A,
+    0x19, 0xF8, 0x02, 0xF6, 0xC3, 0xEF, 0x00, 0xA8, 0xC7, 0x5B, 0xAB, 0xA2, 0x1C, 0xB0, 0x6D, 0xE0,
+    0xF9, 0xCC, 0xEB, 0xF0, 0x89, 0x06, 0x6B, 0xE8, 0x90, 0xB1, 0x05, 0x5F, 0x61, 0x0B, 0x4D, 0x71,
+    0x8B, 0x77, 0x40, 0x25, 0x02, 0x42, 0xF3, 0x85, 0xAD, 0xC3, 0xDD, 0x33, 0xB8, 0xF3, 0xB4, 0x0E,
+    0x19, 0x5B, 0x1D, 0xEB, 0x49, 0x8A, 0x5E, 0x31, 0xA4, 0x92, 0xEF, 0x9D, 0xD8, 0xAA, 0x45, 0x38,
+    0x12, 0x3A, 0x5D, 0x68, 0x28, 0x79, 0x40, 0xD8, 0x88, 0xAF, 0xE6, 0x1C, 0x52, 0x81, 0x44, 0x20,
+    0x18, 0x52, 0x1D, 0xEA, 0x79, 0xE9, 0x48, 0x49, 0x53, 0x05, 0x4A, 0x76, 0xB8, 0x4B, 0xB3, 0x7F,
+    0xBC, 0xAD, 0xC9, 0x19, 0x26, 0xD9, 0xF3, 0x86, 0xA4, 0x3E, 0xAD, 0x80, 0xFC, 0x1C, 0xF2, 0xB3,
+    0x50, 0x33, 0x5C, 0x0F, 0x45, 0x1D, 0x81, 0x82, 0x1C, 0x80, 0x82, 0x52, 0x17, 0x1E, 0xC0, 0xCE,
+    0xEA, 0xB0, 0x36, 0x0F, 0xF6, 0xA1, 0x48, 0x4E, 0xD0, 0x4C, 0x57, 0x4C, 0xBA, 0xDD, 0xAC, 0xD8,
+    0xE5, 0x8C, 0x9A, 0x00, 0x83, 0x09, 0x00, 0x47, 0x7A, 0xE4, 0x7C, 0x97, 0x1D, 0x14, 0x5F, 0x22,
+    0xA0, 0x69, 0xC2, 0x62, 0xC2, 0x71, 0xD7, 0xD9, 0x25, 0x33, 0x5E, 0x49, 0xBB, 0xD9, 0xBD, 0x75,
+    0x74, 0x3D, 0x6F, 0x2E, 0xA2, 0x79, 0x31, 0x5D, 0xFB, 0x3C, 0x39, 0x18, 0x92, 0x33, 0xB8, 0x28,
+    0x3B, 0x13, 0x34, 0x79, 0x23, 0x4D, 0xE6, 0xE7, 0xF2, 0x73, 0x00, 0x4A, 0x16, 0x52, 0x78, 0x51,
+    0x95, 0x58, 0x4E, 0x00, 0x4A, 0x6A, 0x2F, 0xAB, 0x01, 0x40, 0xC9, 0x3B, 0x5B, 0x24, 0x7B, 0x4B,
+    0x79, 0xA3, 0x24, 0x00, 0xC7, 0x4B, 0x04, 0x72, 0xF2, 0x26, 0x93, 0x7D, 0x17, 0xD0, 0xBC, 0x49,
+    0x31, 0x17, 0x1A, 0x02, 0x26, 0x42, 0x53, 0x74, 0x71, 0x02, 0x66, 0x42, 0x29, 0xAB, 0xE2, 0x03,
+    0x57, 0x41, 0x0E, 0x91, 0x13, 0xEA, 0x19, 0x15, 0x81, 0x8A, 0x7F, 0xE3, 0x98, 0xCC, 0xD5, 0x40,
+    0x21, 0xBF, 0x97, 0x91, 0x97, 0x09, 0xC0, 0x30, 0xE7, 0x66, 0x32, 0xFA, 0xF2, 0xD9, 0x83, 0xB1,
+    0x7B, 0x0E, 0x8B, 0x51, 0x0B, 0xCE, 0x03, 0x77, 0x9E, 0xE7, 0x3F, 0x03, 0x96, 0x0C, 0xC9, 0xE4,
+    0x5B, 0x2C, 0x66, 0xF2, 0x2E, 0x55, 0xFF, 0xDD, 0xA7, 0xEB, 0x80, 0x92, 0x93, 0xF3, 0x70, 0x9C,
+    0xD9, 0x95, 0x1B, 0x4D, 0x3F, 0xE4, 0x9C, 0x0A, 0x7A, 0xCD, 0x4E, 0xB1, 0x93, 0xBA, 0xA7, 0x47,
+    0x1D, 0x14, 0x3B, 0x58, 0xAF, 0x89, 0x8C, 0x9D, 0x11, 0x34, 0x8D, 0x47, 0x15, 0x14, 0x7B, 0xB8,
+    0x74, 0x74, 0xC5, 0xDE, 0xA6, 0x8B, 0xC0, 0x52, 0xF0, 0x26, 0xBF, 0x61, 0x07, 0x3B, 0x2B, 0x26,
+    0xBD, 0x7C, 0x67, 0xB5, 0xDA, 0xD7, 0xE4, 0xB8, 0xBC, 0x77, 0x56, 0xAB, 0xFD, 0xA4, 0x8A, 0xCF,
+    0x4E, 0x0C, 0x32, 0xCB, 0x7B, 0x76, 0x5E, 0xEE, 0xE6, 0xC8, 0x7B, 0x04, 0x9C, 0xD8, 0x77, 0x0E,
+    0xDF, 0xD7, 0x56, 0x27, 0x6E, 0x7B, 0xAC, 0x07, 0xDC, 0xC1, 0x7A, 0x7D, 0xCB, 0x75, 0x29, 0x92,
+    0x3F, 0xC9, 0x66, 0x6B, 0x71, 0xA8, 0x0D, 0x64, 0xEE, 0x14, 0x44, 0x66, 0x5D, 0xB4, 0x70, 0xAF,
+    0xF9, 0x37, 0x6E, 0xAA, 0x66, 0x54, 0xA1, 0x0E, 0xD0, 0xD1, 0x04, 0x94, 0xB3, 0x99, 0xD7, 0x17,
+    0x66, 0x43, 0x72, 0x7B, 0x31, 0x2D, 0x63, 0xC1, 0xE1, 0xC0, 0xA6, 0xD9, 0x66, 0x3F, 0x2D, 0x48,
+    0x4E, 0x62, 0x54, 0xB4, 0xE4, 0x88, 0x92, 0x3C, 0x05, 0xEC, 0xED, 0xA3, 0x6E, 0xF1, 0x54, 0xD5,
+    0x61, 0xD6, 0xF3, 0x85, 0x50, 0xCA, 0x31, 0x03, 0x2C, 0x9B, 0x45, 0x54, 0xFE, 0x3C, 0xEB, 0x25,
+    0x9B, 0x50, 0x0C, 0x59, 0x80, 0x1E, 0xC0, 0xB7, 0xD9, 0xC1, 0x4A, 0xCF, 0x9F, 0x65, 0x88, 0x05,
+    0xEE, 0xC0, 0xEF, 0xA3, 0x86, 0x90, 0x9D, 0x02, 0xAA, 0x20, 0x83, 0x7F, 0x1D, 0xA5, 0x9B, 0x97,
+    0xE3, 0xB6, 0x11, 0xE7, 0xF3, 0xEB, 0x39, 0xF8, 0x1A, 0x36, 0xA0, 0xB6, 0x3E, 0x2D, 0x44, 0xBB,
+    0x76, 0x0D, 0x8E, 0xCC, 0xC6, 0x9F, 0x63, 0x0D, 0x7D, 0xBE, 0x35, 0x50, 0x8C, 0x40, 0xD5, 0x8B,
+    0xFC, 0x6F, 0x1B, 0xB9, 0x71, 0xF7, 0x0E, 0x60, 0x29, 0xF3, 0x71, 0x7E, 0xEE, 0xC3, 0xEE, 0xBE,
+    0xFE, 0x14, 0xEF, 0x7E, 0x00, 0xF6, 0x6C, 0x9B, 0x14, 0x90, 0x3C, 0x88, 0x83, 0x3E, 0x59, 0xFD,
+    0x8A, 0xF8, 0x57, 0xC9, 0x2D, 0x24, 0x5A, 0x95, 0x1D, 0x9E, 0x68, 0xB1, 0x7E, 0x24, 0x80, 0xAD,
+    0x7B, 0x99, 0x9D, 0x9E, 0xD9, 0x81, 0xEC, 0x44, 0x2D, 0x5D, 0x1D, 0x3E, 0x6B, 0x35, 0xC9, 0x4B,
+    0xA2, 0x4C, 0x32, 0x38, 0x72, 0xAE, 0x83, 0x0C, 0x98, 0x39, 0x3B, 0xA9, 0x15, 0xD9, 0xD1, 0x20,
+    0x4F, 0x8A, 0x69, 0xA8, 0x93, 0x4D, 0xE0, 0x05, 0xFE, 0x62, 0xB5, 0x7F, 0x78, 0xC4, 0xFB, 0x4E,
+    0x59, 0xAF, 0xFF, 0xD7, 0x74, 0x51, 0x2E, 0xBF, 0xE2, 0xF3, 0xB3, 0xD8, 0x3D, 0x93, 0xB3, 0x31,
+    0x1E, 0xEE, 0x97, 0x22, 0xAF, 0x00, 0x9A, 0x01, 0x50, 0x1C, 0x93, 0xCD, 0xE8, 0xF7, 0xF0, 0xC8,
+    0xE1, 0xCE, 0x35, 0x20, 0x62, 0x7B, 0xB2, 0x2E, 0xB9, 0x2B, 0x01, 0x28, 0x62, 0x19, 0x00, 0xDB,
+    0x97, 0x01, 0x38, 0xB1, 0xA5, 0xBA, 0x9D, 0xE4, 0x0D, 0xF1, 0xA5, 0xB6, 0x6A, 0x23, 0x9E, 0x8C,
+    0x8A, 0x5C, 0xB3, 0xAB, 0xD9, 0xE3, 0x6B, 0x62, 0xD6, 0x28, 0x0F, 0xAD, 0x50, 0xD2, 0x26, 0xA5,
+    0x60, 0x41, 0x02, 0x00, 0xD0, 0x67, 0xE4, 0xBB, 0xEC, 0x0A, 0xF2, 0x25, 0xA2, 0x22, 0x4D, 0x80,
+    0x65, 0x70, 0x63, 0xB6, 0xE6, 0x55, 0x0E, 0xC8, 0xF8, 0x22, 0x3B, 0x14, 0xD4, 0x6C, 0x50, 0x85,
+    0x9A, 0x80, 0xF5, 0x86, 0xC8, 0xD8, 0x39, 0x3E, 0x7B, 0x92, 0xC9, 0x21, 0x4C, 0x92, 0x1E, 0x6E,
+    0x11, 0xFD, 0xDE, 0x4C, 0x32, 0x69, 0xB6, 0x3E, 0x95, 0x2A, 0x54, 0x33, 0x00, 0xE6, 0x26, 0x01,
+    0xD7, 0xB1, 0xCB, 0x89, 0xDA, 0x67, 0x87, 0x77, 0x52, 0xDE, 0xC8, 0x56, 0x70, 0xBC, 0xC8, 0x9C,
+    0xBC, 0xCE, 0x82, 0x24, 0x35, 0xDF, 0x26, 0x2B, 0xC2, 0xD0, 0x44, 0x11, 0xA5, 0x4A, 0x9A, 0x09,
+    0xC5, 0xED, 0x17, 0x41, 0x16, 0x25, 0xEB, 0x19, 0x9A, 0x15, 0x5B, 0x4B, 0xCD, 0x05, 0x9C, 0x9A,
+    0x91, 0xAF, 0x11, 0x35, 0x4B, 0x22, 0xDB, 0x2F, 0xB9, 0x88, 0xB7, 0x7A, 0xFE, 0x23, 0xC0, 0x44,
+    0x7D, 0xF0, 0x6D, 0x06, 0x4D, 0x72, 0xD2, 0x24, 0x07, 0x4D, 0xB2, 0xC9, 0x2E, 0xF0, 0x4D, 0x40,
+    0xF7, 0xA8, 0x1B, 0xD4, 0x5D, 0x16, 0x00, 0xFB, 0xB6, 0xF3, 0x69, 0xEA, 0x4A, 0x26, 0x23, 0x31,
+    0x03, 0xEC, 0x1C, 0x0E, 0x3D, 0x5F, 0xF4, 0xC6, 0x08, 0x50, 0x1E, 0x11, 0xDA, 0xC3, 0xBD, 0xCD,
+    0x1E, 0x46, 0x9E, 0x42, 0x02, 0x39, 0xC7, 0xED, 0x3B, 0xF9, 0x62, 0x36, 0x06, 0xB2, 0xEF, 0x00,
+    0x40, 0x3D, 0x61, 0xD1, 0x49, 0x44, 0xA6, 0xD2, 0xDC, 0xE0, 0xB9, 0xB7, 0x5F, 0x5F, 0xF4, 0xC6,
+    0xC0, 0xD7, 0x92, 0xC7, 0x08, 0x19, 0x87, 0x64, 0x4D, 0x12, 0x1C, 0xB7, 0x3D, 0x32, 0x9F, 0x7D,
+    0x41, 0x1B, 0x63, 0x81, 0x36, 0xBC, 0x29, 0x83, 0x37, 0x34, 0xC9, 0x49, 0x94, 0x14, 0xCD, 0xF9,
+    0x3C, 0xE1, 0xD8, 0xE0, 0x3B, 0x05, 0x87, 0x45, 0x57, 0x94, 0x26, 0x13, 0x0D, 0xB2, 0x8E, 0x8B,
+    0xB8, 0x0C, 0xF5, 0xBE, 0xEA, 0xA5, 0xCF, 0xC8, 0xAB, 0xEC, 0x77, 0xCF, 0xF3, 0x12, 0x5B, 0x14,
+    0xAC, 0x08, 0x54, 0xC1, 0x44, 0xC0, 0x7A, 0x17, 0x90, 0xB1, 0x63, 0x40, 0xC1, 0x9C, 0xF3, 0xCA,
+    0x05, 0x45, 0x92, 0x5E, 0x91, 0x64, 0x27, 0x3E, 0x33, 0x38, 0xF2, 0xD4, 0xB6, 0x0E, 0x07, 0x3C,
+    0x71, 0x1A, 0x40, 0xC6, 0x76, 0x71, 0x26, 0x25, 0x1F, 0x3D, 0x01, 0x99, 0x54, 0x17, 0xCF, 0xD5,
+    0xEE, 0xE9, 0x05, 0x3A, 0x5C, 0x0F, 0x02, 0x65, 0x03, 0x5C, 0x97, 0x9A, 0x09, 0x1B, 0x1D, 0xFB,
+    0xF3, 0x68, 0x12, 0xF3, 0xBE, 0x26, 0xE1, 0x1F, 0x01, 0x66, 0xFE, 0x90, 0x26, 0x59, 0x9F, 0xDE,
+    0x28, 0xB0, 0x56, 0x74, 0x64, 0x37, 0x00, 0x66, 0xB0, 0x03, 0xD4, 0x0C, 0xDB, 0x63, 0xA7, 0xD9,
+    0xC0, 0x12, 0xAC, 0x07, 0xEC, 0x55, 0x76, 0xC8, 0xF8, 0x1A, 0x81, 0x82, 0x27, 0x03, 0x50, 0x45,
+    0xE7, 0x01, 0xFB, 0xDE, 0x87, 0xEF, 0x5E, 0xAD, 0x1E, 0xE3, 0x49, 0x92, 0x8C, 0x8E, 0x24, 0xDF,
+    0x23, 0x49, 0xBE, 0x46, 0x92, 0x3C, 0x19, 0x57, 0xAB, 0x93, 0x1F, 0xE9, 0x22, 0x1F, 0xB2, 0xBB,
+    0xC1, 0x13, 0x02, 0xAF, 0x88, 0x00, 0x14, 0x09, 0xA0, 0x9C, 0xD9, 0x01, 0xF5, 0x68, 0x3C, 0xE0,
+    0xBA, 0x32, 0x00, 0x7B, 0xDB, 0x71, 0x14, 0xC7, 0x4F, 0x63, 0xE3, 0x15, 0xFA, 0x68, 0xCB, 0x7B,
+    0x6E, 0x00, 0x76, 0x24, 0x3B, 0xD8, 0xEB, 0xA2, 0x2C, 0x89, 0xE2, 0x74, 0xC0, 0x08, 0x4B, 0x98,
+    0x19, 0x36, 0xA2, 0x9A, 0x61, 0x03, 0xF4, 0x0C, 0x3B, 0x6D, 0x2D, 0xC7, 0xDF, 0x71, 0x99, 0xB1,
+    0x43, 0xC6, 0x1E, 0xCE, 0x03, 0x76, 0x44, 0x1D, 0x80, 0x2A, 0xA2, 0x64, 0x83, 0x92, 0x4D, 0xF2,
+    0x6B, 0x3B, 0x59, 0x5D, 0x91, 0xD5, 0x8D, 0xC7, 0xB9, 0x5A, 0x3D, 0xC6, 0x67, 0xF3, 0x5B, 0xCE,
+    0x8C, 0xAB, 0xD5, 0xC9, 0x28, 0x8A, 0x7B, 0x42, 0x9C, 0xB1, 0x87, 0xDB, 0x32, 0x87, 0x47, 0x94,
+    0x7C, 0x76, 0xF5, 0x18, 0x9B, 0xFC, 0x03, 0x7E, 0x13, 0x28, 0x3E, 0xD1, 0x97, 0xF9, 0xBA, 0x59,
+    0x04, 0x1B, 0xC5, 0x16, 0xD8, 0x75, 0xF3, 0x1A, 0x10, 0xC4, 0xCC, 0xA2, 0xD7, 0x8D, 0x9B, 0x03,
+    0x1A, 0x00, 0x66, 0xDC, 0x3D, 0x07, 0xC5, 0x47, 0x18, 0x60, 0xAE, 0x6F, 0x1E, 0x58, 0x43, 0x32,
+    0x2A, 0x8E, 0x8A, 0x83, 0x89, 0xD0, 0x54, 0xEC, 0x40, 0x6F, 0x02, 0x34, 0x15, 0x5B, 0xD0, 0x9B,
+    0xE9, 0x13, 0x6D, 0xE2, 0x18, 0xF6, 0x14, 0x1B, 0xA3, 0x79, 0x63, 0xAE, 0xC9, 0x60, 0xFE, 0x03,
+    0x27, 0x03, 0xD7, 0x1F, 0xDB, 0x40, 0xFF, 0x19, 0x55, 0x7A, 0xE7, 0x64, 0x40, 0xCD, 0x1E, 0x25,
+    0xF1, 0x3B, 0xBF, 0x2B, 0xB6, 0x99, 0x58, 0xF0, 0x36, 0xD7, 0xC7, 0x3E, 0x8E, 0x15, 0x33, 0x9E,
+    0xAF, 0xF9, 0xAB, 0x60, 0xC8, 0xC9, 0x3E, 0x4E, 0xFF, 0x7C, 0xC6, 0xEE, 0xD8, 0xA2, 0xD4, 0xED,
+    0xED, 0x03, 0x66, 0xFC, 0x54, 0xDF, 0xAB, 0xD5, 0xCA, 0x90, 0x57, 0xC8, 0x9B, 0xE4, 0x2C, 0xEA,
+    0x75, 0x49, 0x5E, 0x17, 0x97, 0xFB, 0x49, 0xB2, 0x73, 0x6C, 0x4A, 0x22, 0x67, 0x07, 0xE7, 0x51,
+    0x07, 0x7C, 0xF4, 0x0F, 0x05, 0x87, 0x8A, 0x7C, 0x66, 0x73, 0xB5, 0x66, 0x6F, 0xB5, 0x3A, 0x29,
+    0x3F, 0x44, 0x72, 0x4F, 0x54, 0xF9, 0x9D, 0x13, 0x50, 0x6C, 0xC0, 0x1E, 0x66, 0x84, 0x8E, 0x9F,
+    0xE8, 0xC3, 0x53, 0xC8, 0x6E, 0x04, 0xE8, 0x37, 0x78, 0x9E, 0xA5, 0x40, 0x35, 0xDA, 0x82, 0xE3,
+    0xE2, 0xA0, 0xAB, 0xC9, 0x9E, 0xE4, 0xC3, 0x64, 0x2C, 0x49, 0x9F, 0x33, 0x42, 0xEC, 0x38, 0x32,
+    0x77, 0x3B, 0xFF, 0xF1, 0x3F, 0x56, 0x6C, 0x0B, 0xB1, 0xB6, 0x2D, 0x57, 0x86, 0x01, 0x82, 0x69,
+    0xF3, 0x50, 0x1F, 0xB8, 0x49, 0x93, 0xBE, 0x20, 0x3B, 0xB8, 0x19, 0xC8, 0x9A, 0xCF, 0xAC, 0xED,
+    0x1C, 0x69, 0xC9, 0xD7, 0xC9, 0xF7, 0xC8, 0x50, 0x72, 0xFC, 0xD8, 0x2D, 0x94, 0x3E, 0xD8, 0x39,
+    0x13, 0x94, 0x8B, 0x5C, 0x6D, 0x84, 0x1E, 0xA0, 0x07, 0x94, 0x1E, 0x6A, 0x02, 0x08, 0x98, 0x9B,
+    0xD0, 0xEC, 0x40, 0x8F, 0xDD, 0x33, 0xD9, 0x29, 0x1D, 0xAA, 0xB9, 0x9A, 0x75, 0x2C, 0x26, 0x69,
+    0x40, 0x1D, 0x3F, 0xDA, 0x9F, 0x1A, 0x75, 0x6F, 0x3A, 0xDB, 0xD8, 0xD6, 0xBE, 0x63, 0x58, 0x31,
+    0x3B, 0x87, 0xAF, 0x01, 0xD6, 0xA3, 0x8E, 0x28, 0xD9, 0x64, 0xEC, 0x50, 0xF7, 0x1B, 0x63, 0xEA,
+    0x67, 0x73, 0x6B, 0x7B, 0xFB, 0xBC, 0xCC, 0x47, 0xA3, 0x19, 0x3F, 0x6C, 0xE5, 0xC8, 0xA6, 0x0A,
+    0x24, 0x9B, 0x3A, 0x2D, 0x1D, 0x89, 0x3A, 0x94, 0x1C, 0x51, 0x87, 0x9C, 0xDD, 0xE7, 0xB0, 0x2C,
+    0x38, 0xA0, 0x0E, 0x96, 0x33, 0xEA, 0x23, 0x25, 0x91, 0x25, 0x16, 0x49, 0x34, 0x2D, 0x39, 0x01,
+    0x8A, 0x62, 0xDA, 0x96, 0xF9, 0x5C, 0xAC, 0x1F, 0x73, 0x52, 0x4A, 0x77, 0x1B, 0xFC, 0x71, 0xC3,
+    0x2E, 0xE7, 0xD3, 0x6C, 0x35, 0xAB, 0x19, 0x26, 0x98, 0x11, 0xF4, 0xB6, 0xC5, 0xCF, 0x0E, 0x65,
+    0x9F, 0xBD, 0x7D, 0xAC, 0xF6, 0xD9, 0x2B, 0x5E, 0x64, 0xA3, 0xA9, 0xE3, 0x72, 0xD4, 0xA7, 0xB9,
+    0xEB, 0xD0, 0x6F, 0x2C, 0x65, 0xCF, 0x38, 0x60, 0xF7, 0x02, 0x5B, 0x41, 0x3A, 0xB8, 0x14, 0x26,
+    0x87, 0x82, 0xA7, 0x44, 0xBF, 0x2D, 0x39, 0xA0, 0xE0, 0x8C, 0x62, 0x76, 0x7D, 0x31, 0x97, 0x51,
+    0x45, 0xD8, 0x7E, 0xA3, 0x0C, 0x16, 0xEF, 0x57, 0xE0, 0x3F, 0xEB, 0x1D, 0x26, 0x88, 0x37, 0x41,
+    0xB3, 0xD1, 0xA2, 0xE4, 0x0F, 0x20, 0x3D, 0x0C, 0x07, 0xEC, 0xCE, 0x0D, 0x80, 0x27, 0xCE, 0x00,
+    0x8C, 0x50, 0x24, 0xF4, 0xCC, 0xAE, 0xF6, 0xC6, 0xBB, 0xAE, 0x0C, 0xAB, 0x45, 0x0E, 0xD9, 0xDB,
+    0x17, 0xE9, 0xE2, 0xB3, 0x7A, 0xBB, 0x11, 0xEF, 0xD0, 0x83, 0xF4, 0x20, 0x3B, 0x90, 0x0D, 0x9C,
+    0x40, 0x37, 0x73, 0xBE, 0x46, 0xC0, 0x06, 0xE7, 0x51, 0xB1, 0x24, 0x14, 0x7B, 0xE7, 0xC1, 0xB1,
+    0x24, 0xEA, 0x19, 0xCE, 0x17, 0xEC, 0x4A, 0x66, 0xF4, 0x70, 0xDE, 0x44, 0x94, 0xD4, 0x6C, 0xE1,
+    0xAE, 0x72, 0x48, 0x7E, 0x08, 0x47, 0x76, 0x28, 0xC9, 0x98, 0x02, 0x04, 0x4A, 0x92, 0x2D, 0x5C,
+    0x34, 0x11, 0xCB, 0x69, 0x9A, 0x6D, 0x49, 0x98, 0x00, 0xE7, 0x73, 0xFA, 0x92, 0xD0, 0x6C, 0x9C,
+    0x87, 0x0D, 0x25, 0x91, 0x73, 0x70, 0x1E, 0x9A, 0x8F, 0x2C, 0x65, 0x50, 0x3C, 0xA2, 0x89, 0xDD,
+    0x79, 0x76, 0x51, 0x73, 0x50, 0x09, 0x5E, 0x16, 0x8B, 0x64, 0xAD, 0xA6, 0x05, 0xB6, 0x78, 0xFC,
+    0xCC, 0x22, 0x49, 0x6C, 0x09, 0x15, 0x1F, 0xBC, 0xB9, 0xB3, 0x7A, 0x98, 0x6D, 0x46, 0x6F, 0x26,
+    0xD8, 0xA0, 0xD8, 0x56, 0x84, 0x99, 0x14, 0x3B, 0xC5, 0x96, 0x1E, 0x66, 0x34, 0x11, 0x8A, 0x8F,
+    0xB2, 0x81, 0x79, 0x8F, 0x3D, 0x14, 0x5D, 0x80, 0xE0, 0x4E, 0x14, 0x49, 0xC0, 0x90, 0x01, 0x8A,
+    0x57, 0x39, 0xC0, 0x4C, 0x9A, 0x8D, 0x62, 0x6B, 0x02, 0xCC, 0x94, 0xD1, 0x2B, 0xB6, 0x25, 0x5B,
+    0x33, 0xC1, 0x44, 0xB5, 0xFC, 0x84, 0xA8, 0x88, 0x9B, 0xD7, 0xDD, 0x67, 0x37, 0xBA, 0x44, 0xED,
+    0x21, 0xF1, 0x30, 0x29, 0xD4, 0x50, 0x54, 0x89, 0x3D, 0xE9, 0x0D, 0xD9, 0xEA, 0xE1, 0x45, 0x2C,
+    0x31, 0x41, 0x49, 0x0D, 0x4E, 0x39, 0x7B, 0x81, 0xAF, 0x9A, 0xA9, 0x9A, 0xA1, 0xF8, 0x30, 0x5B,
+    0x98, 0x91, 0x1E, 0x8A, 0x56, 0x0A, 0xD9, 0x1D, 0x16, 0x72, 0x82, 0xE2, 0x01, 0x7B, 0x41, 0x04,
+    0x7E, 0x60, 0x21, 0xE5, 0x27, 0x0A, 0x76, 0x38, 0x7E, 0x0E, 0x28, 0xD9, 0x8A, 0x3E, 0x69, 0x46,
+    0xF1, 0xF5, 0xAB, 0x79, 0x1B, 0x8C, 0x5C, 0x4F, 0x47, 0x1C, 0x92, 0x9F, 0xC9, 0xC6, 0xBC, 0x5E,
+    0xFF, 0x6F, 0x4B, 0x18, 0xE2, 0xBB, 0xCB, 0x86, 0x97, 0x80, 0xBB, 0x7C, 0x09, 0xB8, 0x33, 0x7D,
+    0x2A, 0xD4, 0xF1, 0xD3, 0xB0, 0xE3, 0xA7, 0xFF, 0xEF, 0x52, 0xEC, 0xB6, 0x66, 0x2A, 0xD6, 0x12,
+    0x42, 0xF3, 0xE9, 0xEC, 0x58, 0xAF, 0xCF, 0xF3, 0x96, 0x57, 0x38, 0xB4, 0x40, 0xAF, 0x1B, 0xC0,
+    0xF5, 0x87, 0xE1, 0x51, 0x45, 0x48, 0x46, 0xD2, 0x63, 0xC0, 0xF1, 0xBF, 0xE3, 0xAB, 0x7C, 0x3C,
+    0xDA, 0x6B, 0x1F, 0x79, 0x35, 0x02, 0xD8, 0x5D, 0xD7, 0x23, 0x2F, 0xCE, 0xDA, 0xDB, 0x66, 0x1F,
+    0x6E, 0x80, 0xBD, 0x42, 0x94, 0x91, 0x1E, 0x7C, 0x89, 0xD0, 0x23, 0x3D, 0xA8, 0x89, 0xAA, 0x13,
+    0xB0, 0x78, 0x52, 0xB6, 0x7F, 0x97, 0x8D, 0x83, 0xF5, 0xFA, 0x19, 0x4A, 0xB4, 0x25, 0x5F, 0x5A,
+    0x36, 0xBA, 0xE3, 0xA7, 0xEF, 0xFE, 0x3B, 0xF6, 0x7C, 0x91, 0x0F, 0xCF, 0x55, 0xAC, 0xBC, 0x1D,
+    0xDD, 0x0F, 0xF8, 0x4A, 0x28, 0xF8, 0x5F, 0x9C, 0xAA, 0x22, 0x60, 0x47, 0x64, 0xEC, 0x51, 0xB0,
+    0xC1, 0xA7, 0xF0, 0xF1, 0xA3, 0x37, 0xE1, 0x77, 0x34, 0xC1, 0xCB, 0xEC, 0x4C, 0xA0, 0xD7, 0x34,
+    0x41, 0xF1, 0x19, 0xC2, 0xFC, 0xE8, 0x13, 0x34, 0xE1, 0xF1, 0xD3, 0x28, 0xD8, 0xC0, 0x8E, 0x1F,
+    0x61, 0xF5, 0xB5, 0x82, 0x8F, 0x06, 0xFB, 0x1E, 0x5F, 0xE5, 0xC9, 0xD9, 0x5E, 0xE3, 0xAB, 0xFC,
+    0xC6, 0xF8, 0x91, 0xCE, 0x4B, 0x4E, 0x8C, 0xFC, 0xA3, 0x2C, 0x5E, 0x00, 0x72, 0x5E, 0x69, 0x91,
+    0x93, 0x1D, 0xF2, 0x14, 0xAA, 0xD1, 0x48, 0xF0, 0x45, 0xCD, 0x1E, 0x70, 0xEC, 0x12, 0xFC, 0xB0,
+    0x66, 0x07, 0xDC, 0x79, 0xDB, 0xAB, 0xBC, 0xBD, 0x5E, 0xE7, 0x24, 0x79, 0xCB, 0x02, 0xEB, 0x53,
+    0x30, 0x13, 0xF4, 0x0C, 0xC5, 0x16, 0x1C, 0x6E, 0xFF, 0xE1, 0x34, 0x38, 0xC3, 0xB0, 0xD3, 0x9C,
+    0x0A, 0x4E, 0x25, 0x47, 0xCD, 0x49, 0x71, 0x86, 0x65, 0x7B, 0xE7, 0x07, 0x9D, 0xD3, 0xA6, 0x90,
+    0xAC, 0xE3, 0xE7, 0x80, 0x14, 0xCC, 0x24, 0xBE, 0xFA, 0x14, 0x8B, 0x2F, 0x4B, 0xB1, 0xC4, 0x64,
+    0x87, 0x6A, 0xBC, 0x9D, 0x01, 0xC5, 0x9A, 0x3D, 0xC0, 0x4B, 0x0C, 0x80, 0xB9, 0x4A, 0x36, 0xD0,
+    0xC1, 0xD1, 0x43, 0x51, 0x4C, 0xF0, 0x97, 0xC8, 0x0E, 0xE6, 0x2A, 0x6D, 0x80, 0x0E, 0xEE, 0x12,
+    0x1B, 0xC5, 0xDA, 0xD3, 0x83, 0x97, 0x62, 0x1D, 0x61, 0xAE, 0xF2, 0x61, 0x76, 0x3A, 0xB8, 0xDE,
+    0x4E, 0x8A, 0xF5, 0xA8, 0x09, 0x5E, 0x8A, 0x19, 0xBD, 0xB9, 0xCA, 0xA6, 0x8E, 0x3A, 0xB8, 0x5E,
+    0xF1, 0x22, 0xEB, 0x11, 0x6E, 0xE2, 0xA5, 0x08, 0x4D, 0x73, 0x95, 0x4D, 0xC6, 0x77, 0x82, 0xEB,
+    0x61, 0xC8, 0x7A, 0x44, 0x41, 0x5E, 0x8A, 0x80, 0xE3, 0x55, 0x36, 0xD0, 0x0C, 0xAE, 0x47, 0x4E,
+    0xD6, 0x23, 0x60, 0x78, 0x29, 0x02, 0x05, 0x3D, 0x90, 0xAF, 0x4F, 0x27, 0x5B, 0xD6, 0x16, 0x06,
+    0xA1, 0x5F, 0x66, 0xB7, 0xE5, 0x96, 0xF6, 0x9A, 0x7B, 0x6E, 0xC0, 0xBE, 0x4C, 0xF6, 0xF6, 0xD7,
+    0x09, 0xED, 0x1A, 0x2C, 0x0F, 0x18, 0x2D, 0x61, 0x66, 0x1B, 0x51, 0xCD, 0x36, 0x24, 0xE0, 0x6C,
+    0x5A, 0x7C, 0xC2, 0xB8, 0xE3, 0x2F, 0x4F, 0xCD, 0x6D, 0xBF, 0xF2, 0x35, 0x36, 0xC2, 0x81, 0xC0,
+    0xA8, 0x05, 0xF9, 0x9D, 0x7C, 0x8C, 0x4A, 0x86, 0xD4, 0x13, 0x9F, 0x67, 0x4D, 0x6E, 0x17, 0x6F,
+    0xDD, 0x2E, 0x85, 0x63, 0x0B, 0x64, 0x04, 0x90, 0xCF, 0x4B, 0xB9, 0xB2, 0x7D, 0x00, 0x4F, 0xB4,
+    0x58, 0x37, 0x28, 0x03, 0xD8, 0x02, 0xEE, 0x65, 0xE9, 0x0F, 0x29, 0x4A, 0xAE, 0xC3, 0x82, 0xBC,
+    0x3C, 0x34, 0x1C, 0x7E, 0x79, 0xBA, 0xF8, 0xB6, 0x77, 0xEC, 0x65, 0x76, 0xE2, 0xB8, 0xB9, 0x8D,
+    0x77, 0xEC, 0x73, 0x6B, 0x18, 0x89, 0xB0, 0x4A, 0x81, 0x56, 0x82, 0x26, 0x5B, 0x02, 0xAE, 0x96,
+    0x55, 0x25, 0x68, 0xB2, 0xCA, 0xAF, 0x9A, 0x7B, 0x6E, 0xA0, 0x1E, 0xDC, 0xCF, 0xC9, 0xCE, 0xF4,
+    0xEE, 0x35, 0xD2, 0xEF, 0x35, 0x8E, 0xE4, 0x04, 0x38, 0xBE, 0xC3, 0x00, 0xB8, 0x19, 0x36, 0x00,
+    0x2E, 0xA0, 0x8E, 0x80, 0x9B, 0x50, 0x45, 0xC0, 0x8D, 0xD0, 0x11, 0x70, 0xFE, 0xD3, 0x5E, 0xDD,
+    0xB6, 0xD9, 0x3B, 0xE8, 0xE0, 0x38, 0x41, 0xB1, 0x26, 0x1B, 0xF0, 0x12, 0xE9, 0x61, 0xAE, 0xD2,
+    0xCE, 0xD2, 0xEC, 0xBD, 0x62, 0x3D, 0x32, 0x80, 0x97, 0xA2, 0x66, 0x67, 0xAE, 0xF2, 0x41, 0x8E,
+    0x3A, 0xB8, 0xDE, 0x50, 0xB1, 0x1E, 0x15, 0x3D, 0x2F, 0x45, 0xD8, 0xD9, 0x5C, 0x65, 0x53, 0xF2,
+    0xF5, 0xE0, 0x7A, 0x90, 0xAC, 0x47, 0x54, 0xE4, 0xA5, 0x88, 0x9C, 0xBC, 0xCA, 0x06, 0x86, 0xC1,
+    0xF5, 0x28, 0xA4, 0x75, 0x1D, 0x2F, 0x45, 0x40, 0xF3, 0x2A, 0x1B, 0x80, 0xC1, 0xF5, 0x40, 0x4D,
+    0x01, 0xB7, 0x5D, 0x8A, 0x4B, 0xBC, 0x46, 0xAA, 0x4D, 0x45, 0x2C, 0x1E, 0x96, 0xAF, 0x9C, 0x4F,
+    0xDA, 0xA7, 0xDF, 0x40, 0x77, 0x0D, 0x3D, 0x80, 0x3B, 0xE7, 0xF6, 0x96, 0x0E, 0xE0, 0x7F, 0x4B,
+    0x07, 0x18, 0x7F, 0xA7, 0x27, 0xF3, 0x96, 0x45, 0x35, 0x03, 0x77, 0xBB, 0x88, 0x05, 0x4D, 0x36,
+    0x01, 0x15, 0x07, 0xA0, 0x9C, 0x9B, 0x8F, 0x8A, 0xA5, 0xFF, 0x72, 0xC6, 0x66, 0xEE, 0xAD, 0x56,
+    0x0D, 0xAA, 0x04, 0x2E, 0x0A, 0x29, 0x02, 0x67, 0x6F, 0xB5, 0x19, 0x66, 0xEE, 0x39, 0x00, 0xE0,
+    0x18, 0x00, 0x92, 0x3D, 0x48, 0x46, 0x70, 0x3E, 0xC9, 0xCE, 0x06, 0xB8, 0xA9, 0x8E, 0xD0, 0xD4,
+    0x44, 0xCE, 0xCB, 0x6C, 0x61, 0xC7, 0x23, 0x81, 0x48, 0x9B, 0xF8, 0x1F, 0x8F, 0x2A, 0xD6, 0x01,
+    0x25, 0x0B, 0xB6, 0x8A, 0x1D, 0xA7, 0x82, 0x7D, 0x45, 0xD2, 0x6F, 0xB8, 0x76, 0x3C, 0xE0, 0xD8,
+    0xA7, 0x01, 0x5A, 0x77, 0x30, 0x0D, 0x30, 0xA3, 0xF4, 0x40, 0x31, 0x9F, 0x17, 0x68, 0x57, 0x1A,
+    0x0A, 0x45, 0xEF, 0x93, 0xA7, 0x73, 0xFF, 0xCB, 0x1E, 0x18, 0x1B, 0xA0, 0x3C, 0x4C, 0x9B, 0x07,
+    0x94, 0xF3, 0x79, 0x01, 0x05, 0x2C, 0x21, 0xE4, 0xE2, 0x10, 0xDE, 0xFF, 0xBD, 0x06, 0x5F, 0xAD,
+    0xFF, 0xFD, 0xBA, 0x01, 0x4C, 0xB0, 0x1E, 0x28, 0x24, 0x8A, 0x9D, 0x3F, 0x24, 0x80, 0x7A, 0xB0,
+    0x1D, 0x50, 0x8C, 0x7A, 0x00, 0x70, 0xEC, 0xCB, 0xDF, 0x0E, 0x77, 0x9F, 0x3D, 0x7E, 0x06, 0x7A,
+    0xAE, 0x03, 0xCA, 0x59, 0x07, 0xA8, 0x59, 0x07, 0xA8, 0x58, 0x4E, 0xC8, 0xA3, 0x1A, 0x8F, 0xDC,
+    0xE1, 0xEF, 0xA5, 0x1D, 0x76, 0xD7, 0xED, 0xE2, 0x52, 0x16, 0x3C, 0xAD, 0x44, 0x03, 0x35, 0x89,
+    0x1C, 0x62, 0x0B, 0xC2, 0xE1, 0x78, 0xD0, 0x48, 0xA1, 0x40, 0x92, 0xAD, 0xE0, 0x4C, 0x79, 0xE0,
+    0xE8, 0x35, 0x51, 0xB1, 0xA5, 0x87, 0x9D, 0x34, 0xA1, 0xD8, 0xD1, 0xC3, 0x04, 0x4D, 0x88, 0xA5,
+    0xC3, 0x8E, 0x9A, 0xA8, 0x08, 0x1E, 0x38, 0xF6, 0x1B, 0x07, 0x6C, 0x5C, 0x7C, 0x30, 0x07, 0x2E,
+    0x24, 0xAA, 0x01, 0x7A, 0x89, 0x95, 0xB0, 0x01, 0xF4, 0x12, 0x6B, 0x2C, 0xD8, 0x42, 0x27, 0xD7,
+    0xED, 0xE9, 0x51, 0x51, 0x13, 0xE0, 0x44, 0x2F, 0xD8, 0xAA, 0x27, 0xCE, 0xA2, 0x60, 0x07, 0x13,
+    0xA0, 0xD8, 0xA2, 0x1E, 0x91, 0x73, 0x53, 0xEA, 0xBD, 0xE6, 0x9E, 0xDF, 0xF0, 0x21, 0xBE, 0x38,
+    0x1B, 0x56, 0x33, 0x83, 0x25, 0x7F, 0x43, 0xBE, 0xF5, 0x0D, 0x8E, 0xA8, 0x08, 0xD8, 0xE9, 0xE3,
+    0x6A, 0x7A, 0x5F, 0xCC, 0x1A, 0xB8, 0xC5, 0x88, 0x25, 0x36, 0x9F, 0x6D, 0x23, 0x56, 0x77, 0xC4,
+    0x88, 0xF5, 0x29, 0x57, 0xCA, 0x12, 0xAE, 0xB3, 0x16, 0xFC, 0x39, 0x3B, 0x61, 0x5E, 0xF1, 0x82,
+    0x0F, 0xD8, 0x17, 0x56, 0xA5, 0xBB, 0x4F, 0xC1, 0xF6, 0x3A, 0x20, 0xE7, 0xD3, 0x4C, 0x7D, 0x1C,
+    0x46, 0x30, 0xDE, 0x11, 0xDB, 0xB0, 0xF0, 0x2F, 0x64, 0x15, 0x1F, 0x6F, 0xF1, 0xC4, 0x23, 0x11,
+    0xEC, 0xDC, 0x2F, 0xD9, 0x95, 0x4C, 0xB8, 0x30, 0xCD, 0x7E, 0x23, 0x5F, 0xEE, 0xEC, 0xEF, 0x86,
+    0x22, 0x96, 0xCC, 0xF8, 0x0C, 0x3B, 0x7B, 0x93, 0xBE, 0x22, 0x43, 0x41, 0x3E, 0x9B, 0x31, 0x0A,
+    0x93, 0x5A, 0x35, 0x8B, 0xCF, 0x38, 0x63, 0x2F, 0xF5, 0xB6, 0xC4, 0x8B, 0x7C, 0xF8, 0x8E, 0x05,
+    0x68, 0xC5, 0x31, 0x41, 0x3E, 0xAC, 0x07, 0x8A, 0x79, 0x31, 0x4D, 0x6E, 0x24, 0x84, 0x7B, 0x38,
+    0x41, 0x91, 0x6C, 0x0D, 0x39, 0x2B, 0x92, 0x63, 0xC5, 0xB7, 0xD9, 0xB9, 0x11, 0xF7, 0x6E, 0x41,
+    0xD0, 0x03, 0x00, 0x17, 0x80, 0x8C, 0x33, 0xA0, 0xC8, 0x16, 0x2A, 0x99, 0x1B, 0x3D, 0x32, 0xD2,
+    0x03, 0x56, 0x38, 0x2F, 0x86, 0x84, 0x38, 0xD1, 0x84, 0x20, 0x2B, 0x61, 0x7F, 0x33, 0x42, 0xF1,
+    0x45, 0x3E, 0xEB, 0xE6, 0x8A, 0x49, 0x80, 0x6A, 0x28, 0x7C, 0x80, 0x4B, 0x00, 0x05, 0xEE, 0x5E,
+    0x8B, 0x1A, 0xAD, 0x29, 0xBF, 0x58, 0xC6, 0xA4, 0x3E, 0x2F, 0xE5, 0xBC, 0x67, 0x6E, 0xE0, 0xE4,
+    0xC4, 0xC1, 0x91, 0xA3, 0x89, 0xBB, 0xA1, 0x0A, 0xC8, 0x24, 0x70, 0x26, 0x4A, 0xA7, 0x50, 0x89,
+    0xD7, 0xA0, 0xC9, 0x84, 0x99, 0x90, 0xA9, 0x30, 0xD6, 0x03, 0x3A, 0xDC, 0x8F, 0x92, 0x9A, 0xE4,
+    0xC5, 0x14, 0xB6, 0xDC, 0x57, 0x64, 0x8B, 0x9D, 0x13, 0x00, 0x76, 0xD7, 0x0D, 0x60, 0x98, 0xBC,
+    0xF1, 0xE6, 0x26, 0xA1, 0xA8, 0x88, 0x7A, 0x50, 0x33, 0x56, 0x1B, 0x0D, 0xFE, 0x0B, 0x51, 0x55,
+    0xC7, 0xCF, 0x4A, 0x5C, 0x41, 0xC5, 0x09, 0x7A, 0x66, 0xAB, 0x43, 0x35, 0xE9, 0x09, 0x7C, 0x70,
+    0x13, 0xF1, 0xF2, 0xD9, 0x56, 0x55, 0x82, 0x1E, 0x0D, 0xD0, 0x09, 0xB3, 0x3F, 0x69, 0x92, 0xBD,
+    0xE5, 0x79, 0xE6, 0xEC, 0xF1, 0x8F, 0x47, 0x43, 0x16, 0x72, 0x7A, 0x88, 0x35, 0x47, 0x73, 0x86,
+    0xB0, 0x1E, 0x69, 0xB2, 0x13, 0xAA, 0x07, 0x89, 0xEF, 0xB0, 0x12, 0x7C, 0xB4, 0xD4, 0x9D, 0xF5,
+    0x40, 0xC6, 0x17, 0x7B, 0x68, 0x56, 0xF3, 0x37, 0x39, 0x59, 0x92, 0x3F, 0x17, 0x37, 0x3A, 0xD9,
+    0x67, 0xE4, 0x98, 0xEC, 0xD0, 0xBA, 0x4F, 0xDC, 0x13, 0x62, 0xA6, 0x36, 0x3D, 0xF0, 0x20, 0x53,
+    0x38, 0x9E, 0x66, 0x9F, 0x80, 0x54, 0x9F, 0x59, 0x6D, 0x14, 0x53, 0x42, 0x87, 0x8A, 0xC5, 0x4B,
+    0x4A, 0x70, 0x47, 0x35, 0x26, 0x12, 0xAE, 0x08, 0xD4, 0x37, 0x64, 0x08, 0x3B, 0x5D, 0x8D, 0x39,
+    0x51, 0x4D, 0xC6, 0xA3, 0x16, 0x84, 0xFD, 0x98, 0x42, 0xAE, 0x36, 0xB1, 0x21, 0x5F, 0x84, 0xAE,
+    0xF5, 0xDB, 0x07, 0xAB, 0xCF, 0xB6, 0x6B, 0x19, 0x92, 0xFC, 0xC9, 0x26, 0x64, 0x3E, 0x72, 0x61,
+    0x40, 0x64, 0x27, 0x1D, 0x4A, 0xCF, 0x1B, 0x1F, 0x09, 0x87, 0xA5, 0x97, 0x7D, 0x66, 0x3B, 0x21,
+    0x11, 0x0F, 0xCD, 0xA1, 0xB7, 0xB2, 0x5D, 0xCC, 0x37, 0xE5, 0xD2, 0x06, 0xB0, 0x5C, 0x50, 0xAF,
+    0x75, 0x27, 0xF3, 0xA5, 0xED, 0x00, 0xD7, 0x21, 0xE3, 0x5B, 0x27, 0x4A, 0x32, 0x98, 0xF4, 0xFE,
+    0x73, 0x1E, 0x9C, 0x15, 0x60, 0xCC, 0x47, 0x79, 0xF7, 0xC8, 0x38, 0x7E, 0x15, 0x64, 0x80, 0x63,
+    0x80, 0x61, 0x40, 0xC9, 0x09, 0xB0, 0x29, 0x2C, 0x92, 0x83, 0x18, 0x03, 0x8A, 0x00, 0x94, 0xF2,
+    0x5D, 0x49, 0x8F, 0x82, 0x4D, 0x76, 0x0E, 0xF9, 0x59, 0x98, 0xA1, 0x88, 0x50, 0x2C, 0x67, 0xC0,
+    0x88, 0x5F, 0x52, 0xC2, 0x61, 0xB6, 0x23, 0x7F, 0xBE, 0x68, 0xD5, 0x0D, 0x3C, 0xD1, 0x6E, 0x94,
+    0xF3, 0xA5, 0xAE, 0xEB, 0x2E, 0x9F, 0xA1, 0x02, 0x4C, 0x07, 0xDB, 0x65, 0xA7, 0x65, 0x4E, 0xC8,
+    0xF8, 0xD6, 0x89, 0xE4, 0xD6, 0x4B, 0x9E, 0x2E, 0xB2, 0xC3, 0x9F, 0xF3, 0xE0, 0x6C, 0xEA, 0xEC,
+    0x42, 0x5B, 0xF0, 0xB1, 0x36, 0x23, 0x20, 0x75, 0x2E, 0xC3, 0x93, 0x28, 0x97, 0xE2, 0x8F, 0x2E,
+    0x39, 0x41, 0x48, 0x33, 0x3E, 0x79, 0x95, 0xED, 0x9E, 0xE7, 0xDB, 0x6D, 0xBE, 0xE0, 0x24, 0x03,
+    0xEA, 0xC3, 0x30, 0xB2, 0x4F, 0x5E, 0x65, 0x1F, 0xB3, 0xCB, 0xD5, 0xA4, 0x37, 0x5B, 0xEF, 0x8F,
+    0xD6, 0xE5, 0x56, 0x40, 0x86, 0x6C, 0x1F, 0x60, 0x5F, 0xB5, 0xD0, 0x3C, 0x58, 0xDC, 0xA8, 0xEA,
+    0x86, 0x63, 0x83, 0xAA, 0xAD, 0x47, 0xE0, 0xD8, 0x61, 0xFC, 0x86, 0x1B, 0x00, 0xFB, 0x2E, 0x3B,
+    0xE4, 0x7C, 0x89, 0x40, 0x29, 0x11, 0x62, 0x81, 0x1E, 0x70, 0x9F, 0xFA, 0x6E, 0x89, 0x6F, 0xB2,
+    0x13, 0x32, 0x7A, 0x8E, 0xD0, 0x7C, 0x88, 0xF3, 0x37, 0x85, 0xE5, 0x58, 0x42, 0xC9, 0x22, 0x94,
+    0x30, 0x88, 0x39, 0x01, 0x00, 0xEF, 0x23, 0xD1, 0xDA, 0x98, 0x51, 0x79, 0x90, 0x3F, 0x19, 0x72,
+    0x92, 0xBD, 0xBA, 0xE1, 0xD8, 0x2A, 0x5F, 0xCE, 0x1B, 0xDC, 0xCB, 0xA7, 0xCD, 0x95, 0x69, 0x67,
+    0xC3, 0x87, 0x24, 0x04, 0x60, 0xD6, 0xE4, 0xCD, 0xB9, 0x20, 0x2F, 0xCF, 0xE0, 0xAC, 0x66, 0x29,
+    0x95, 0x58, 0x37, 0x48, 0x36, 0xC2, 0x25, 0x20, 0x64, 0x02, 0x5B, 0x46, 0x8F, 0x72, 0x86, 0x80,
+    0x2A, 0x3F, 0xB3, 0xDA, 0xDC, 0xDA, 0x7D, 0x95, 0x5D, 0x8A, 0x1F, 0xAF, 0xA8, 0xD9, 0x80, 0x63,
+    0xCD, 0xB7, 0x4E, 0x26, 0x3C, 0x1B, 0x0C, 0x29, 0xE8, 0xEA, 0x08, 0xDC, 0x43, 0x36, 0x89, 0x55,
+    0xF5, 0xC3, 0x63, 0x9F, 0x3E, 0xE7, 0xFA, 0x7C, 0x1E, 0xF9, 0x84, 0x3C, 0xA0, 0xEA, 0xA1, 0x78,
+    0x5E, 0x74, 0x87, 0x11, 0x28, 0xC9, 0x16, 0x10, 0xD4, 0xEE, 0x21, 0x15, 0xC2, 0x17, 0xBE, 0xD3,
+    0xE6, 0x29, 0x7C, 0xAA, 0x4A, 0xE1, 0x53, 0xEE, 0x03, 0xC2, 0xA7, 0x3E, 0xE7, 0x4A, 0x16, 0x17,
+    0x77, 0x21, 0xB0, 0x05, 0xB6, 0x40, 0x3E, 0x59, 0x24, 0xAE, 0x54, 0xA1, 0x4D, 0xC5, 0xCF, 0x4E,
+    0x76, 0x4B, 0xB4, 0x87, 0x80, 0xBF, 0x0F, 0x6B, 0xBD, 0x9E, 0x80, 0xEA, 0xB3, 0xEF, 0xCB, 0xB2,
+    0xFB, 0x12, 0x01, 0xCD, 0x6A, 0x4E, 0x24, 0x65, 0x8A, 0xBD, 0xE3, 0xB3, 0x4E, 0x20, 0xEC, 0xC2,
+    0x67, 0xB4, 0x80, 0x3A, 0x4F, 0x8A, 0x66, 0x29, 0xA2, 0xD9, 0xB1, 0x85, 0xE2, 0x44, 0xD3, 0x03,
+    0xFA, 0xD5, 0x09, 0xA8, 0x9A, 0x90, 0x16, 0xFA, 0xD5, 0x29, 0xE1, 0x91, 0x25, 0x4E, 0xEB, 0xD8,
+    0xEF, 0xA7, 0x15, 0xEE, 0x3C, 0x77, 0xFC, 0x6C, 0xA2, 0x72, 0x94, 0x78, 0x5F, 0xE3, 0x6D, 0x8F,
+    0x8C, 0x2A, 0x00, 0x7A, 0x30, 0x1D, 0x70, 0xEC, 0x50, 0xDF, 0xFB, 0xE2, 0x8F, 0xCF, 0xC7, 0xCF,
+    0x3E, 0x71, 0x1A, 0xD6, 0xB3, 0x07, 0x5F, 0x60, 0x93, 0xB3, 0x88, 0x28, 0x82, 0x1E, 0xE5, 0x56,
+    0x76, 0x36, 0x50, 0x8F, 0xCF, 0xB7, 0x92, 0xBF, 0xB0, 0xD5, 0x16, 0x01, 0xEC, 0x3C, 0x7E, 0x2B,
+    0xDA, 0xBF, 0xEE, 0x36, 0xC2, 0x6B, 0xCE, 0x13, 0x58, 0x5C, 0x93, 0x82, 0xF4, 0x29, 0xE6, 0xCF,
+    0xB5, 0xF2, 0x4A, 0x0F, 0xA0, 0xEA, 0x16, 0xC2, 0x11, 0x77, 0xC8, 0xE8, 0xF1, 0xFF, 0x25, 0x87,
+    0xA1, 0x50, 0x78, 0xEC, 0x9E, 0x45, 0xA2, 0x74, 0xC0, 0x96, 0x39, 0x3D, 0xD1, 0x08, 0x1D, 0xF2,
+    0x97, 0x02, 0x19, 0x7F, 0x28, 0xBB, 0x32, 0x36, 0xD5, 0xB8, 0x50, 0xC3, 0x9D, 0x38, 0xC2, 0xB3,
+    0x30, 0x20, 0x67, 0x8B, 0x82, 0x75, 0x00, 0xE8, 0x91, 0xF3, 0x45, 0x89, 0xF6, 0x06, 0x07, 0xF6,
+    0xA8, 0xD8, 0xC2, 0x8C, 0x46, 0xA4, 0xE6, 0x2A, 0x94, 0x84, 0x62, 0x40, 0xC9, 0x4C, 0x80, 0x67,
+    0xC2, 0x90, 0x64, 0x39, 0x80, 0xBD, 0x9E, 0x51, 0xDF, 0x0C, 0xB0, 0x3E, 0x67, 0xA7, 0x6F, 0x10,
+    0x55, 0x80, 0xF5, 0x2A, 0x9A, 0xBE, 0x9C, 0xA1, 0x43, 0x46, 0x1D, 0x14, 0x1B, 0xC5, 0xC6, 0x5D,
+    0x24, 0xD8, 0xC1, 0x0D, 0x66, 0x70, 0xBD, 0xF5, 0xA8, 0x42, 0x35, 0x56, 0x53, 0x3D, 0x41, 0xB1,
+    0x0C, 0xF2, 0x58, 0xF2, 0x32, 0xE1, 0x2E, 0x12, 0xA8, 0x27, 0xB6, 0xD5, 0x6F, 0xD8, 0xA1, 0xA0,
+    0xE9, 0x55, 0xB4, 0x03, 0xC0, 0xD7, 0x3D, 0x78, 0x61, 0x04, 0xCC, 0xCD, 0x20, 0xA0, 0xC2, 0x92,
+    0xB3, 0xC8, 0xED, 0x99, 0x0C, 0x4D, 0xAD, 0xE0, 0x20, 0x0C, 0x7B, 0x19, 0x8C, 0xD2, 0xB8, 0x33,
+    0x21, 0x13, 0xDF, 0x4F, 0x04, 0xCC, 0xBC, 0x45, 0xDE, 0x98, 0xE4, 0x7D, 0x20, 0x23, 0x5B, 0x19,
+    0xA6, 0xDD, 0x00, 0x00, 0x7A, 0x92, 0x4A, 0x33, 0x7D, 0x11, 0xDF, 0x5F, 0x77, 0xAB, 0x7D, 0xEC,
+    0x9D, 0xC0, 0xCE, 0xCA, 0x7A, 0x98, 0x08, 0x1D, 0xCD, 0x28, 0x8C, 0x75, 0x66, 0x02, 0x29, 0x21,
+    0x96, 0x24, 0xCC, 0xA4, 0x43, 0x46, 0x36, 0x66, 0xD4, 0x31, 0x9F, 0x5D, 0x6B, 0x7D, 0x39, 0xAB,
+    0x68, 0x3B, 0x37, 0x14, 0x54, 0xC1, 0x74, 0xEC, 0x15, 0xBF, 0x11, 0x4C, 0xCF, 0x4E, 0xF1, 0xC7,
+    0x53, 0xFD, 0x4B, 0x76, 0x39, 0x7F, 0x3C, 0x56, 0x57, 0xD9, 0x82, 0x2F, 0x79, 0xFD, 0x2E, 0x9B,
+    0xB4, 0x06, 0xDC, 0xEB, 0x43, 0x79, 0x7D, 0x06, 0xEC, 0x95, 0xBE, 0xB8, 0x19, 0x01, 0xC3, 0x4E,
+    0x31, 0x1C, 0xAE, 0x6B, 0x76, 0x4A, 0x0C, 0x08, 0x6D, 0x2E, 0x61, 0x76, 0x8D, 0x58, 0x9D, 0x8F,
+    0x06, 0x51, 0x34, 0x47, 0x83, 0x28, 0xEC, 0xAD, 0x41, 0x14, 0x5F, 0x7C, 0x92, 0x4A, 0x64, 0xC2,
+    0xBE, 0xC6, 0x26, 0x39, 0xA2, 0x73, 0x3A, 0x9F, 0x72, 0x47, 0xD4, 0x3E, 0xE7, 0x76, 0x5C, 0xE4,
+    0x97, 0x83, 0xEF, 0x4B, 0x5E, 0xD5, 0xA0, 0x07, 0xC0, 0xF8, 0x7A, 0x04, 0x8C, 0x37, 0x23, 0x50,
+    0xFB, 0xDA, 0x03, 0xBB, 0xED, 0x6E, 0x7B, 0x94, 0x1C, 0xE5, 0x8B, 0xDF, 0x44, 0xC2, 0xDA, 0x23,
+    0xFD, 0x8F, 0xC3, 0x66, 0xB1, 0x09, 0xA3, 0xDA, 0x64, 0x2B, 0xA8, 0x49, 0xF2, 0x51, 0x92, 0xBC,
+    0x4C, 0x92, 0x23, 0x49, 0xC6, 0x3A, 0xE5, 0x03, 0x28, 0xD9, 0x24, 0xA9, 0x49, 0x6D, 0xC2, 0xBD,
+    0x33, 0xB9, 0x92, 0x5F, 0x16, 0x6E, 0x84, 0xD8, 0x7F, 0xA5, 0xAE, 0xEB, 0x78, 0x18, 0x5E, 0x7B,
+    0xBB, 0x2B, 0x74, 0x40, 0xCE, 0x83, 0xF5, 0xFA, 0x2C, 0x37, 0x09, 0x12, 0x5E, 0xE2, 0x82, 0x4F,
+    0x0C, 0xBF, 0xDD, 0xC0, 0xBA, 0xB7, 0x5A, 0xAD, 0x2A, 0x92, 0x2F, 0x92, 0xFC, 0x8D, 0xB8, 0xB8,
+    0xC5, 0x60, 0x27, 0xBF, 0x55, 0xB0, 0x85, 0x12, 0x4E, 0x09, 0xE4, 0xEC, 0xA5, 0xB4, 0xC2, 0x3B,
+    0x25, 0x45, 0xB5, 0x13, 0x60, 0xE2, 0x6A, 0x55, 0x27, 0xB2, 0xC3, 0xEB, 0x8B, 0x7E, 0xDC, 0x24,
+    0x7A, 0x9C, 0x6A, 0x3A, 0xCA, 0xB9, 0xE2, 0xFC, 0xFB, 0x62, 0x1A, 0xBF, 0x60, 0x75, 0x96, 0x9D,
+    0x5A, 0x90, 0xDA, 0xBD, 0x98, 0xD1, 0xEB, 0x00, 0xE4, 0x71, 0x0B, 0x78, 0xFE, 0x99, 0xD5, 0x59,
+    0xB2, 0xE2, 0xF8, 0x62, 0x86, 0xE2, 0x23, 0x47, 0xAD, 0x38, 0xF6, 0x88, 0x15, 0xE7, 0x8B, 0x55,
+    0x67, 0xBF, 0xDD, 0x84, 0xF8, 0x19, 0xF6, 0xB3, 0xBB, 0xCF, 0xA1, 0x66, 0xD0, 0xE4, 0xCF, 0x25,
+    0xDB, 0x8C, 0x12, 0xAB, 0x8C, 0x62, 0xFB, 0xE9, 0xAD, 0xB0, 0x3E, 0x93, 0x68, 0xD0, 0x9D, 0x87,
+    0x1D, 0x52, 0x5A, 0x8D, 0x27, 0xCE, 0x82, 0x5E, 0xB1, 0x2B, 0x67, 0xD4, 0x63, 0xDA, 0x87, 0xE3,
+    0x67, 0x01, 0x61, 0x55, 0x69, 0xCA, 0x99, 0x7D, 0x35, 0xD6, 0xDE, 0xF6, 0x65, 0xD8, 0x03, 0x4E,
+    0xE0, 0x2E, 0xEC, 0x29, 0x36, 0x4F, 0x6D, 0x47, 0x6F, 0x3D, 0x05, 0xD7, 0x1F, 0xC3, 0x1D, 0xD8,
+    0x5B, 0xAD, 0x1E, 0x16, 0x03, 0xCE, 0x45, 0x32, 0xEC, 0xAD, 0x56, 0xCD, 0x13, 0xEB, 0xF5, 0xB9,
+    0x6D, 0x10, 0xE7, 0xDE, 0x6A, 0x75, 0xE2, 0x79, 0xE4, 0x07, 0x01, 0xD5, 0x65, 0x89, 0x1D, 0x1A,
+    0x35, 0xD9, 0x14, 0x1C, 0x80, 0xBB, 0x80, 0x9D, 0xFD, 0x7A, 0x32, 0xC1, 0x04, 0x13, 0xCA, 0x01,
+    0x80, 0x0A, 0x2A, 0xB8, 0xDE, 0xBE, 0x13, 0xCB, 0xD9, 0x76, 0xF6, 0xE5, 0x33, 0xD9, 0x19, 0xA0,
+    0x9E, 0x4B, 0x5E, 0x65, 0x04, 0x5B, 0x33, 0x54, 0xDE, 0x8C, 0x7A, 0xC8, 0xCF, 0x20, 0xDB, 0xCF,
+    0x38, 0x58, 0xFE, 0xF8, 0x97, 0x21, 0x94, 0xAF, 0x77, 0xCF, 0xFF, 0xEC, 0xE4, 0x45, 0x4E, 0x55,
+    0xC4, 0x1D, 0xC8, 0xD6, 0xFF, 0xF3, 0x1A, 0xBC, 0xCC, 0x96, 0x2F, 0xB3, 0xB5, 0x3D, 0x5B, 0xD3,
+    0xB3, 0x31, 0x9D, 0x6D, 0x76, 0x9A, 0x1D, 0x21, 0x6E, 0xD2, 0x21, 0x63, 0xCB, 0x57, 0xD8, 0x6A,
+    0xB2, 0xCD, 0x24, 0xE8, 0xBA, 0x43, 0xB6, 0x6A, 0x84, 0xE2, 0x9D, 0x6B, 0xF3, 0xC3, 0x70, 0xCB,
+    0xFF, 0xF1, 0x07, 0xCF, 0x1E, 0x3F, 0xBD, 0x6E, 0x75, 0xAC, 0x02, 0xF8, 0x02, 0x1B, 0x3D, 0xD5,
+    0x1E, 0xCC, 0x23, 0xB4, 0xAF, 0x3B, 0x9C, 0xC0, 0x3E, 0xEA, 0x06, 0x85, 0x30, 0x02, 0x5C, 0x0C,
+    0x4F, 0x3D, 0xF5, 0x87, 0xE5, 0xE5, 0x31, 0x4F, 0xB9, 0x5C, 0x86, 0x9C, 0x23, 0xB0, 0x0F, 0xD4,
+    0x37, 0x90, 0x0B, 0x93, 0x94, 0xAF, 0xC8, 0xD1, 0xF4, 0x2A, 0x18, 0x20, 0xEC, 0x01, 0x27, 0xB2,
+    0xA8, 0x62, 0x11, 0xCA, 0xA0, 0xA7, 0x6A, 0x34, 0xA3, 0xF1, 0xD6, 0xEF, 0xED, 0x97, 0x51, 0x47,
+    0x1D, 0xAA, 0x50, 0x8F, 0xB5, 0x37, 0x83, 0xE9, 0x6C, 0xB7, 0x07, 0x3B, 0x58, 0x6F, 0x7C, 0x3D,
+    0x56, 0x93, 0x0E, 0x65, 0x50, 0x41, 0x45, 0x9C, 0xB8, 0xDD, 0x71, 0xC7, 0xCF, 0x41, 0x7C, 0x87,
+    0x70, 0x03, 0xEA, 0x09, 0x45, 0x04, 0x4E, 0xE0, 0xF8, 0x39, 0x70, 0xCA, 0xD9, 0x17, 0x84, 0x0E,
+    0x30, 0x03, 0xF6, 0x00, 0xDC, 0x8F, 0xFB, 0x8F, 0x3F, 0x6F, 0xE3, 0xF1, 0x88, 0xFB, 0x71, 0x3F,
+    0xF0, 0x24, 0x9E, 0xC4, 0x53, 0x67, 0x6D, 0xB4, 0x67, 0x9F, 0xC4, 0x93, 0x00, 0x8E, 0xAF, 0xFF,
+    0x96, 0xB4, 0xF4, 0xA8, 0x91, 0x6F, 0x2F, 0xBE, 0x86, 0xF5, 0x29, 0x3D, 0x67, 0xEC, 0xEB, 0x50,
+    0xF0, 0x1B, 0xF4, 0x36, 0x14, 0x11, 0xDF, 0x01, 0xD0, 0x3C, 0x5F, 0x5F, 0x1E, 0x9F, 0x52, 0x83,
+    0xF9, 0x41, 0xDC, 0xED, 0x01, 0xD5, 0xA9, 0x4E, 0x75, 0x8F, 0xBD, 0x45, 0x3A, 0x01, 0x67, 0xB0,
+    0xE8, 0x65, 0x9F, 0xEA, 0x54, 0xF7, 0xAD, 0x5F, 0x90, 0xA4, 0xEA, 0x54, 0x97, 0xB7, 0x7B, 0xAB,
+    0x47, 0xF9, 0x2E, 0x27, 0xB8, 0xAE, 0xF6, 0x65, 0xC8, 0x09, 0xD7, 0xD5, 0xBE, 0x8A, 0x9C, 0x2D,
+    0x1F, 0xE7, 0x0F, 0xD9, 0xB0, 0x35, 0x83, 0x9E, 0xD4, 0x0C, 0xB6, 0x66, 0xD0, 0x31, 0x67, 0xB4,
+    0x7C, 0x84, 0xBD, 0x1D, 0x76, 0x1F, 0xE4, 0x25, 0xDA, 0xE8, 0xFC, 0xCF, 0x70, 0xDB, 0x1E, 0xF4,
+    0x81, 0x5D, 0xE5, 0xCE, 0xB3, 0x3A, 0x54, 0x53, 0xE5, 0xEB, 0xDE, 0x74, 0x7B, 0x50, 0xE3, 0x61,
+    0x5E, 0x94, 0x9F, 0x17, 0xC1, 0xF0, 0x22, 0xC7, 0x7A, 0x42, 0x76, 0xAA, 0xF0, 0x55, 0x67, 0x5A,
+    0x07, 0xD7, 0xB8, 0xB7, 0x2D, 0x6B, 0xE6, 0xA9, 0x7F, 0xAF, 0x25, 0x8C, 0x6F, 0x76, 0xE4, 0x3B,
+    0x1D, 0x1E, 0x78, 0x0E, 0x2A, 0xAD, 0x06, 0x00, 0x7F, 0x96, 0xB7, 0x7F, 0x76, 0x9F, 0xEA, 0xEE,
+    0xAB, 0x1F, 0xBF, 0x36, 0x69, 0xD2, 0x67, 0x67, 0xEE, 0x6E, 0x84, 0x77, 0x63, 0xE9, 0x7C, 0x87,
+    0xBC, 0x1B, 0xD2, 0xF9, 0xB6, 0x1F, 0xC1, 0x62, 0x66, 0x5F, 0x4D, 0xF5, 0x68, 0xFB, 0x22, 0xEC,
+    0x01, 0x27, 0x6E, 0x0D, 0x7C, 0x53, 0xDB, 0x81, 0x6F, 0x1F, 0xD2, 0xAF, 0xB0, 0x8F, 0x63, 0x05,
+    0x9B, 0xEF, 0x57, 0x3C, 0x88, 0x86, 0x0C, 0xF6, 0x3F, 0x70, 0xFC, 0xFE, 0x87, 0x3D, 0xBA, 0xEB,
+    0x9F, 0x2C, 0xF1, 0xAE, 0xA2, 0xA3, 0xA5, 0xD7, 0xEA, 0x90, 0x13, 0xE8, 0xE8, 0xBE, 0x0F, 0x09,
+    0xEC, 0xBC, 0xDD, 0x40, 0x70, 0x18, 0x78, 0xB6, 0xE4, 0x3B, 0x3B, 0x5C, 0x3D, 0xB1, 0x5E, 0x4B,
+    0x8E, 0xA4, 0x0C, 0xC0, 0x08, 0xB8, 0x0E, 0x36, 0xC2, 0xB2, 0xA9, 0xD9, 0x56, 0xEC, 0x0B, 0xF6,
+    0x30, 0x03, 0x30, 0x6E, 0xCC, 0x47, 0xFF, 0x2D, 0x80, 0x28, 0x48, 0x7E, 0x35, 0x89, 0x2A, 0x59,
+    0x7A, 0x71, 0xB4, 0xD5, 0xDD, 0x16, 0x2B, 0x8B, 0x38, 0xBE, 0xB2, 0x5B, 0x0F, 0x1B, 0x44, 0xCD,
+    0x33, 0x9D, 0x68, 0x7A, 0xDB, 0x87, 0x05, 0x61, 0x47, 0xFE, 0xA0, 0xC3, 0x00, 0xE0, 0xAE, 0x62,
+    0xB0, 0x3F, 0x08, 0x65, 0xFF, 0x5C, 0xFD, 0xE2, 0xF8, 0xEF, 0x00, 0xA0, 0x3C, 0xD2, 0x05, 0xDE,
+    0x91, 0xFB, 0x1A, 0xC4, 0x73, 0x11, 0x0C, 0x19, 0xEE, 0x03, 0xEE, 0x5B, 0xDE, 0xF7, 0xAF, 0x56,
+    0x4F, 0x1A, 0x32, 0x1C, 0x5F, 0xAF, 0xCF, 0x66, 0x67, 0xEE, 0x6E, 0x35, 0xE9, 0xEB, 0xD2, 0xFF,
+    0xF4, 0x3E, 0xD5, 0xDD, 0xF7, 0x67, 0x79, 0xFB, 0x67, 0xC0, 0xD7, 0xBF, 0xFA, 0xFC, 0x53, 0x26,
+    0x68, 0x5F, 0x8D, 0x36, 0x3E, 0x79, 0xFF, 0x5D, 0x77, 0xE0, 0xC1, 0x68, 0x9E, 0xEE, 0xEF, 0xCF,
+    0xBD, 0xEE, 0x9E, 0x2C, 0x5E, 0x09, 0x36, 0xC3, 0x47, 0x69, 0x9F, 0xE3, 0xE7, 0x50, 0xC9, 0x38,
+    0xC0, 0x01, 0xB5, 0xE4, 0x46, 0x39, 0x81, 0xE3, 0xE7, 0xE0, 0xA6, 0x8C, 0x7D, 0xC1, 0xE6, 0x70,
+    0x1C, 0xD8, 0x0C, 0xF2, 0x07, 0x31, 0xB5, 0xE4, 0xB8, 0x0C, 0xF2, 0xC8, 0xF8, 0x34, 0x1F, 0x9B,
+    0x8B, 0xA9, 0xEA, 0xE2, 0x86, 0xB7, 0x94, 0x1E, 0xE6, 0x07, 0xBC, 0x1C, 0xDC, 0x0B, 0x7C, 0x7A,
+    0xE6, 0x65, 0x96, 0xB3, 0xBB, 0x18, 0x8B, 0x78, 0x77, 0x11, 0xB2, 0x33, 0x49, 0xF0, 0x77, 0x9D,
+    0xEB, 0x5C, 0xE7, 0xDE, 0xB4, 0xC1, 0x84, 0x72, 0x3A, 0xBE, 0x5E, 0xAF, 0x7F, 0x44, 0x32, 0x98,
+    0xF5, 0xFA, 0xC2, 0xC5, 0x1E, 0x78, 0xF2, 0x7E, 0xA0, 0xB8, 0xD8, 0x03, 0x4F, 0xDE, 0x07, 0xA8,
+    0xEE, 0xA3, 0xDC, 0xCF, 0x6D, 0x47, 0x66, 0x1B, 0x6D, 0x3C, 0xFE, 0x3C, 0xEE, 0x4F, 0x7F, 0x59,
+    0x8B, 0xAF, 0x3D, 0xF0, 0xB5, 0x8A, 0x17, 0xDF, 0xE0, 0xFC, 0xFC, 0xF3, 0x86, 0x2F, 0x3D, 0x7D,
+    0xC5, 0xEF, 0xFF, 0x14, 0xC8, 0x85, 0xA9, 0x1B, 0xA6, 0x43, 0xC6, 0x06, 0x2A, 0x00, 0xE5, 0x80,
+    0xDD, 0x53, 0xF9, 0xE0, 0xA6, 0xEA, 0x69, 0x32, 0xD6, 0x57, 0xE8, 0x43, 0xC1, 0x6C, 0x7F, 0x6F,
+    0x1F, 0x2A, 0x08, 0xB4, 0xC4, 0xA4, 0xC4, 0x31, 0x00, 0x80, 0xC6, 0xF5, 0xF7, 0xD7, 0xBC, 0x72,
+    0xF1, 0x3D, 0x4E, 0x4F, 0xE6, 0x73, 0xA2, 0x3B, 0x7E, 0x85, 0x37, 0x9E, 0x33, 0x8E, 0x4F, 0x77,
+    0xD6, 0x1F, 0x4B, 0xC6, 0xC2, 0x7F, 0xA1, 0x9A, 0xF2, 0x17, 0x4F, 0x29, 0x21, 0xC4, 0x69, 0x9F,
+    0x54, 0x3D, 0xDA, 0x3F, 0x4D, 0xD6, 0x81, 0xB6, 0x18, 0xAA, 0xE9, 0x9E, 0xFF, 0xA4, 0x7A, 0xF9,
+    0xB3, 0xA3, 0x62, 0x57, 0xC5, 0xB4, 0xFA, 0x77, 0xFB, 0x58, 0x61, 0xE7, 0xBF, 0xFB, 0x1E, 0x00,
+    0xE0, 0xDE, 0xEF, 0x01, 0xC7, 0x80, 0x7B, 0xBF, 0x87, 0xAF, 0xDC, 0xF7, 0x0F, 0xB8, 0x17, 0xF8,
+    0xCA, 0xB1, 0x7F, 0x00, 0xA0, 0x3A, 0xA8, 0x0E, 0xC8, 0x5B, 0xE4, 0x2D, 0xF0, 0x07, 0x00, 0xBE,
+    0x8E, 0xBB, 0xFE, 0x04, 0xC0, 0xF7, 0xEE, 0xF8, 0xDE, 0x1D, 0x00, 0xEE, 0xBA, 0xF7, 0x7B, 0x77,
+    0x01, 0xB8, 0xE3, 0xDE, 0xEF, 0xDD, 0x07, 0xE0, 0xDE, 0x7B, 0xBF, 0xF7, 0x75, 0x00, 0x5F, 0xBD,
+    0x37, 0x5D, 0xF3, 0xEB, 0x7F, 0x02, 0xE0, 0x7B, 0x5F, 0xC5, 0x9F, 0x00, 0xF8, 0x4B, 0x20, 0x6B,
+    0x90, 0x35, 0x9B, 0x6B, 0x66, 0xFF, 0x15, 0xFE, 0x87, 0x06, 0xE9, 0xF7, 0xBE, 0x07, 0xFC, 0x99,
+    0x14, 0x02, 0x87, 0xAB, 0xA3, 0xC5, 0xBD, 0x0B, 0x53, 0x3E, 0x37, 0x2E, 0x0B, 0xF6, 0x8D, 0xF1,
+    0x0F, 0x81, 0xFC, 0x8D, 0x83, 0x18, 0x8C, 0xFE, 0xE5, 0x5C, 0xB5, 0xFB, 0x70, 0x6F, 0xC2, 0x72,
+    0xA8, 0xC8, 0x87, 0x63, 0x11, 0x2C, 0xCA, 0xD7, 0x5E, 0x09, 0x4F, 0x1D, 0xB3, 0x2F, 0x37, 0x45,
+    0x4C, 0x38, 0x1D, 0x1C, 0xBB, 0xEB, 0xFE, 0x27, 0x97, 0x0E, 0xFE, 0x2F, 0xEF, 0x03, 0x70, 0x47,
+    0xF6, 0x1B, 0xF7, 0xCC, 0x68, 0x1A, 0xD7, 0xD5, 0x5D, 0x71, 0x17, 0x46, 0x35, 0x67, 0xCC, 0x82,
+    0x7D, 0x63, 0xFC, 0x23, 0x34, 0x80, 0x1A, 0x10, 0xCA, 0x49, 0x8D, 0x79, 0xAC, 0x87, 0x62, 0xBC,
+    0xDE, 0xB9, 0x17, 0x5F, 0x7A, 0x74, 0xB8, 0xBF, 0xFA, 0x57, 0xF0, 0xF7, 0xE1, 0x01, 0x7D, 0x35,
+    0x56, 0x4F, 0xFF, 0xFA, 0x66, 0x08, 0xC7, 0xB0, 0xDB, 0xF0, 0x45, 0xFE, 0x64, 0x36, 0xA3, 0x6D,
+    0xF3, 0x56, 0x75, 0xFF, 0xE3, 0xFF, 0xE3, 0xE6, 0xC7, 0xAF, 0x55, 0xE3, 0x03, 0xCF, 0xFD, 0xC1,
+    0x9F, 0xEE, 0x4E, 0xF5, 0xA9, 0x8A, 0x1C, 0xEF, 0x2F, 0x87, 0x27, 0xEF, 0x53, 0xDD, 0x7D, 0xF7,
+    0xA9, 0xEE, 0xBE, 0xFB, 0xCB, 0xE1, 0xC9, 0x8A, 0x1C, 0x8B, 0xA9, 0xEE, 0xEF, 0xC0, 0xBD, 0xB8,
+    0x0F, 0x26, 0xDA, 0x80, 0xFB, 0xF0, 0x3D, 0xFC, 0x95, 0xF4, 0xC0, 0x9D, 0x6F, 0x09, 0xFE, 0x36,
+    0x8A, 0xD2, 0xCB, 0x96, 0x37, 0x80, 0x5D, 0x7A, 0x45, 0x1E, 0x48, 0xCA, 0x16, 0xC9, 0xFE, 0x52,
+    0x26, 0xCE, 0x74, 0xE1, 0xE0, 0xF8, 0x5D, 0xCE, 0xDD, 0x5B, 0xAD, 0x56, 0xAB, 0x13, 0x92, 0x55,
+    0x66, 0xC9, 0x2D, 0xB3, 0x08, 0xA3, 0xB7, 0xDB, 0x2F, 0x7E, 0xF9, 0xEC, 0x94, 0x21, 0xCF, 0x00,
+    0x3F, 0xAB, 0x48, 0x72, 0xED, 0x2E, 0xA7, 0x18, 0x1A, 0x7B, 0xEA, 0xDB, 0x24, 0x59, 0xF6, 0xC0,
+    0xDD, 0xC9, 0xB4, 0xB2, 0x20, 0x99, 0xCE, 0x2D, 0x22, 0xF9, 0xA9, 0xE4, 0x2C, 0x4C, 0x40, 0x43,
+    0xB6, 0x25, 0xDF, 0x44, 0xE6, 0x66, 0x81, 0x58, 0x9D, 0x9C, 0x4C, 0x0F, 0x00, 0xF6, 0xFF, 0x14,
+    0x12, 0xEF, 0x73, 0x47, 0xA3, 0x06, 0x4E, 0xC9, 0x4A, 0x0D, 0x77, 0xAE, 0xD7, 0xEB, 0xF5, 0xFA,
+    0x82, 0x4F, 0xAC, 0xFE, 0x3E, 0x3D, 0xB7, 0xF2, 0x93, 0x0B, 0xDB, 0xBC, 0x5E, 0xC6, 0x4F, 0x64,
+    0xE7, 0xC0, 0x69, 0xA7, 0xEC, 0x76, 0x9E, 0xD3, 0xBC, 0xE8, 0x9F, 0x7C, 0xA0, 0xBC, 0xC8, 0x50,
+    0xFE, 0x53, 0x97, 0x9D, 0x2A, 0xF9, 0xF4, 0xCB, 0xEF, 0x5D, 0x7B, 0x8A, 0x74, 0x28, 0x7B, 0x30,
+    0x14, 0x33, 0xFE, 0x9B, 0x5F, 0xED, 0xDD, 0xBC, 0xF2, 0xB3, 0x9B, 0x57, 0xFE, 0x63, 0x76, 0x06,
+    0x9C, 0xEA, 0x47, 0x2E, 0x0F, 0x0F, 0x3C, 0xA0, 0xDE, 0x1D, 0x4C, 0x5D, 0xF4, 0x0C, 0x79, 0xC4,
+    0x89, 0x9D, 0xA7, 0xD4, 0x95, 0xF6, 0xE6, 0xF0, 0xC0, 0xA4, 0x7F, 0xA6, 0xAE, 0xFC, 0xFC, 0x80,
+    0x73, 0xFD, 0x6A, 0x93, 0x9D, 0x53, 0x7C, 0x61, 0xDC, 0x9F, 0x70, 0x3F, 0x74, 0xAB, 0xFC, 0x5D,
+    0x36, 0xE4, 0x11, 0xC8, 0x4F, 0xE1, 0x01, 0xA8, 0xE1, 0x6B, 0x0F, 0x68, 0xBE, 0x71, 0xED, 0x67,
+    0x0F, 0xA8, 0x37, 0xFA, 0x07, 0x1E, 0x50, 0x6F, 0xF8, 0xA7, 0x2A, 0x0E, 0x4F, 0xDD, 0x7B, 0x06,
+    0x0F, 0x40, 0xB7, 0xEA, 0x97, 0xA7, 0x48, 0xF3, 0xE3, 0x2B, 0xDD, 0x72, 0xC1, 0xF6, 0x60, 0xF8,
+    0x8B, 0xFD, 0xEF, 0xDC, 0xF9, 0x10, 0x67, 0x5E, 0x7A, 0x2B, 0xD6, 0x27, 0x95, 0xBF, 0xFF, 0x39,
+    0xDD, 0xBE, 0xE7, 0x1F, 0x50, 0xAF, 0x75, 0x93, 0x3E, 0xA9, 0x86, 0xFB, 0xBF, 0x57, 0x36, 0xE3,
+    0xB1, 0xAF, 0x5F, 0x7F, 0x77, 0x7E, 0xB4, 0xBD, 0x1F, 0xA3, 0xEA, 0x75, 0x73, 0x3F, 0x80, 0xFB,
+    0xF2, 0x6B, 0x75, 0xAC, 0xF1, 0x5C, 0xEE, 0xCB, 0xAE, 0x86, 0x1D, 0x6C, 0x73, 0x0C, 0xFB, 0x93,
+    0x7E, 0xC1, 0xDF, 0xAF, 0x5E, 0xF1, 0xFA, 0x99, 0xB6, 0x7A, 0x12, 0x66, 0x80, 0x05, 0x7E, 0x8A,
+    0xBD, 0x6C, 0xFF, 0xB9, 0x1A, 0x71, 0x04, 0xDB, 0x3C, 0x40, 0x4F, 0x88, 0x63, 0xF9, 0x82, 0xBF,
+    0x3F, 0x1F, 0xEE, 0x5C, 0x4B, 0x64, 0x8B, 0xC0, 0xA5, 0xFC, 0x56, 0x14, 0xE1, 0x89, 0x65, 0x2E,
+    0x9D, 0x6F, 0x0D, 0x9C, 0x5A, 0x54, 0x90, 0xF7, 0xBD, 0x45, 0xFB, 0x38, 0x7C, 0x5F, 0x5B, 0x9D,
+    0xF8, 0x90, 0x63, 0xDF, 0x77, 0xDD, 0xE3, 0xEB, 0xF5, 0x7A, 0xDD, 0x0A, 0x9D, 0xF3, 0xAD, 0xAB,
+    0x04, 0x10, 0x4D, 0xBE, 0xDF, 0xDF, 0xB2, 0xFA, 0x9F, 0xD6, 0x8D, 0x24, 0x50, 0x0A, 0x29, 0x8F,
+    0x52, 0x23, 0x2B, 0x09, 0x09, 0xA5, 0x87, 0xE2, 0x9B, 0x39, 0x47, 0x28, 0xB6, 0xB0, 0x49, 0x9D,
+    0x09, 0x1F, 0xBC, 0xB2, 0x01, 0x8A, 0x6D, 0xC6, 0x09, 0x8A, 0x3F, 0x90, 0xD3, 0x7F, 0x40, 0x0E,
+    0xB2, 0x6A, 0xA1, 0xF8, 0x83, 0xF4, 0xAC, 0xAC, 0x9A, 0x04, 0x34, 0xD3, 0x6C, 0x50, 0xB0, 0x81,
+    0xA2, 0x40, 0xEB, 0x73, 0x1E, 0x86, 0x65, 0x5A, 0x92, 0x17, 0x48, 0xDE, 0x5C, 0xAA, 0xC0, 0x91,
+    0xBC, 0xF2, 0x59, 0xC6, 0x3D, 0x1F, 0x21, 0xDC, 0x95, 0x9C, 0x92, 0x05, 0xC5, 0xB7, 0x4D, 0xF6,
+    0x05, 0x79, 0x9E, 0x30, 0x6C, 0xF0, 0xD7, 0xB9, 0x58, 0xB6, 0x04, 0xB6, 0x1A, 0x36, 0xE9, 0x6E,
+    0x84, 0x72, 0xC9, 0x6C, 0x7C, 0x43, 0x83, 0xDA, 0x02, 0x15, 0x9A, 0x79, 0x2D, 0x6A, 0xE0, 0x61,
+    0x72, 0x9C, 0x76, 0xEB, 0x1C, 0xB9, 0xE3, 0x06, 0x5F, 0x85, 0xE3, 0x5B, 0xDF, 0xF5, 0x92, 0x26,
+    0x03, 0x1B, 0xE6, 0x9E, 0xB0, 0x24, 0xDB, 0xC8, 0x56, 0xDB, 0x70, 0xAA, 0x4A, 0xB2, 0x9B, 0x09,
+    0x9C, 0xAA, 0x73, 0xF3, 0x79, 0x2A, 0x76, 0x0B, 0x9C, 0x6A, 0xDC, 0x30, 0xC0, 0x0E, 0x40, 0x29,
+    0x56, 0xD0, 0xB8, 0x0D, 0xA7, 0x2A, 0x53, 0xFC, 0x5C, 0x07, 0x38, 0x26, 0x2C, 0x5B, 0xC2, 0x0B,
+    0x79, 0x20, 0xE7, 0x8B, 0x2D, 0x34, 0xAB, 0x1B, 0xDF, 0x94, 0x00, 0x96, 0x9F, 0x93, 0x8C, 0x45,
+    0x22, 0x14, 0x1A, 0xC5, 0xED, 0xE2, 0xAE, 0xF0, 0x23, 0xBD, 0x7C, 0xF5, 0x83, 0xC9, 0x5C, 0x9E,
+    0xED, 0x1B, 0xB3, 0x7D, 0x63, 0x36, 0x2F, 0xC4, 0x9D, 0x05, 0x86, 0x9C, 0xB1, 0xCB, 0x3F, 0xD5,
+    0x7F, 0x14, 0x9F, 0x8C, 0xC0, 0xE3, 0xB7, 0x7E, 0x30, 0x01, 0x7A, 0x86, 0xE6, 0xA3, 0xE4, 0x45,
+    0x72, 0x20, 0xBD, 0xE1, 0xB0, 0x3B, 0x37, 0x87, 0xD3, 0x06, 0x12, 0xA7, 0x15, 0x36, 0xA4, 0xAE,
+    0x1F, 0xB0, 0xAB, 0x03, 0x97, 0x90, 0x12, 0xFD, 0xA1, 0xBB, 0x0E, 0xFE, 0x7E, 0xD9, 0x25, 0xC4,
+    0xC6, 0x5D, 0x72, 0x39, 0x56, 0xB2, 0x2B, 0x6E, 0x76, 0x79, 0x54, 0x13, 0x34, 0x61, 0xD9, 0xE4,
+    0x42, 0xF5, 0xE2, 0x02, 0xEA, 0x29, 0x69, 0x9F, 0x39, 0x1B, 0xD0, 0xC3, 0x04, 0x98, 0x11, 0x9A,
+    0xC8, 0xD9, 0xA9, 0xC3, 0x5D, 0x1E, 0x9A, 0x28, 0xD8, 0x95, 0x14, 0x6A, 0xAF, 0xE9, 0x3C, 0x07,
+    0x68, 0x9E, 0x27, 0x35, 0xA3, 0xDC, 0xC0, 0x90, 0x50, 0xE2, 0x9C, 0xF4, 0x32, 0x7E, 0x41, 0x00,
+    0x73, 0xBC, 0xB1, 0xE5, 0x07, 0xB0, 0x5E, 0x5C, 0x5E, 0x70, 0x7E, 0xB1, 0x13, 0x7D, 0x5A, 0x1B,
+    0x07, 0xEB, 0x35, 0x0F, 0xCE, 0x35, 0x49, 0x65, 0xE1, 0xB4, 0x6C, 0xB0, 0x5D, 0x36, 0x86, 0x65,
+    0xC3, 0xCB, 0x59, 0x39, 0xA7, 0x74, 0xBA, 0x0D, 0x69, 0xC3, 0x2C, 0x1B, 0xF5, 0xFB, 0x36, 0x96,
+    0xAF, 0x32, 0xCA, 0xC6, 0x81, 0xE3, 0x98, 0x88, 0xED, 0xD2, 0x05, 0x49, 0x76, 0x69, 0x63, 0x46,
+    0xDA, 0x38, 0x25, 0xC3, 0x6D, 0x93, 0x91, 0xCB, 0x60, 0xC1, 0x49, 0xD2, 0x33, 0x0D, 0x9B, 0x91,
+    0x38, 0x01, 0x95, 0xC4, 0x12, 0x9C, 0x42, 0x40, 0xD3, 0x08, 0xBC, 0xF9, 0x6A, 0xEF, 0x04, 0xD2,
+    0x95, 0x97, 0x71, 0x58, 0xCB, 0x4A, 0x78, 0x95, 0xC1, 0x1B, 0x0F, 0x32, 0x42, 0xB1, 0x85, 0x9B,
+    0x24, 0xAB, 0xDE, 0xB0, 0xD8, 0x97, 0x38, 0x2C, 0xD1, 0xA5, 0xE6, 0x63, 0x7C, 0x95, 0x5C, 0x66,
+    0x26, 0x6E, 0x86, 0x23, 0x49, 0x89, 0x27, 0x74, 0xBC, 0xD3, 0x21, 0xF7, 0x57, 0x6A, 0x57, 0x81,
+    0xF9, 0x6B, 0x96, 0x04, 0xDC, 0x58, 0x07, 0x14, 0x6C, 0x9D, 0x17, 0x9A, 0xE0, 0x9C, 0x7D, 0x49,
+    0x54, 0x33, 0xEA, 0x20, 0x36, 0x2E, 0x79, 0x68, 0xEC, 0x84, 0x92, 0xDF, 0x12, 0x08, 0x91, 0x10,
+    0x2A, 0x48, 0xC4, 0x42, 0x8B, 0x52, 0x28, 0x83, 0xE3, 0x49, 0x02, 0xCE, 0xD7, 0x44, 0xCE, 0xCE,
+    0x44, 0x94, 0x84, 0x0D, 0xA8, 0x03, 0x5C, 0x80, 0xF3, 0x12, 0x16, 0x9F, 0x51, 0xAE, 0xE6, 0xEB,
+    0x90, 0x18, 0x1C, 0x0A, 0xBE, 0xC0, 0x0E, 0x3A, 0xB9, 0xE6, 0x1B, 0xDC, 0xB9, 0x6E, 0x36, 0x04,
+    0x6A, 0x4B, 0xCE, 0xC3, 0xF1, 0x30, 0x90, 0x56, 0x30, 0xE9, 0x58, 0x6D, 0xF7, 0x51, 0x06, 0xE7,
+    0x91, 0x53, 0x68, 0x19, 0x82, 0xF3, 0x28, 0x19, 0x9C, 0x87, 0x66, 0x70, 0x1E, 0x35, 0x83, 0xF3,
+    0x30, 0x0C, 0xCE, 0xC3, 0x5D, 0x09, 0xCE, 0x83, 0xAF, 0x07, 0xE7, 0x73, 0x3E, 0x1E, 0x9C, 0x57,
+    0xAC, 0x82, 0xF3, 0x65, 0xAC, 0x82, 0xF3, 0x3A, 0x54, 0xC1, 0xF9, 0x7A, 0xAC, 0x83, 0xF3, 0xC6,
+    0xD7, 0xC1, 0x79, 0xD7, 0xD7, 0xC1, 0x79, 0x76, 0x75, 0x70, 0x57, 0xD9, 0xD4, 0xC1, 0xBD, 0x4B,
+    0xD4, 0xC1, 0xDD, 0x0C, 0xA8, 0x83, 0xE3, 0x84, 0x3A, 0x38, 0xE9, 0x73, 0x1C, 0x50, 0x07, 0xC7,
+    0x0E, 0x75, 0x70, 0x6C, 0x51, 0x07, 0x47, 0xA0, 0x0E, 0x6E, 0x5E, 0x28, 0xF6, 0xA4, 0xF8, 0xAE,
+    0x43, 0xC6, 0xD6, 0x78, 0xC0, 0xDC, 0xB0, 0xD3, 0x56, 0xC0, 0x96, 0x4C, 0x39, 0x6F, 0x1E, 0x15,
+    0x00, 0xAB, 0x08, 0xE4, 0xBC, 0x28, 0xE0, 0x30, 0x37, 0x42, 0xB8, 0x91, 0x13, 0x93, 0xB3, 0x8E,
+    0x89, 0xA7, 0x5A, 0x00, 0xEC, 0x19, 0xFB, 0x4C, 0xA2, 0x18, 0xDC, 0x80, 0x82, 0x30, 0x1E, 0xE0,
+    0x50, 0x05, 0xA0, 0x0A, 0x3A, 0x02, 0x8A, 0xDF, 0x20, 0x00, 0x7B, 0x95, 0x2D, 0xA0, 0xA3, 0x18,
+    0x70, 0x93, 0x1A, 0x3D, 0x62, 0x49, 0x42, 0x2E, 0x6E, 0xB4, 0xC4, 0x63, 0xA7, 0x85, 0x47, 0x8E,
+    0x1D, 0x70, 0xF7, 0x05, 0x49, 0x54, 0x2E, 0x04, 0x7E, 0xF2, 0x00, 0x0B, 0x5B, 0x7A, 0x0A, 0xFC,
+    0xDC, 0xB4, 0x84, 0xF9, 0xE4, 0x7C, 0x68, 0xBF, 0xF3, 0xEE, 0xF5, 0xFA, 0xC2, 0x07, 0x11, 0xB6,
+    0x35, 0xE9, 0x69, 0xB0, 0x7E, 0x83, 0xF5, 0x93, 0x08, 0x4B, 0xD9, 0x7D, 0xFC, 0xF4, 0x42, 0x2B,
+    0x67, 0x37, 0xFC, 0xA5, 0xC2, 0xE7, 0x25, 0x34, 0x7E, 0xC3, 0xF6, 0xD3, 0xB3, 0xE1, 0x49, 0xCD,
+    0x8E, 0xF0, 0xA4, 0x8E, 0x55, 0x44, 0x1D, 0x4C, 0x80, 0x0E, 0x66, 0x82, 0x8E, 0x76, 0x5E, 0x5F,
+    0x88, 0x76, 0xD1, 0x29, 0xD2, 0xE2, 0x28, 0x4F, 0x6A, 0x2D, 0x06, 0xF6, 0x53, 0xD9, 0x58, 0x92,
+    0x1C, 0x25, 0xFA, 0xC7, 0x25, 0x9E, 0x54, 0x21, 0x95, 0xBF, 0x95, 0x81, 0x4C, 0x2F, 0x52, 0x44,
+    0xD8, 0xDE, 0x3C, 0xCA, 0x1B, 0xB2, 0xF3, 0xBF, 0x40, 0xF1, 0x1B, 0x9C, 0x60, 0xDE, 0x5B, 0x18,
+    0xC8, 0x5A, 0x23, 0xFC, 0xF8, 0x53, 0xC1, 0xDE, 0xCC, 0xA8, 0x66, 0x31, 0x5D, 0x98, 0x00, 0x3D,
+    0xCB, 0xC0, 0x62, 0xA6, 0x4F, 0xB4, 0xB9, 0x19, 0xF3, 0x0E, 0x37, 0x73, 0xF6, 0xC0, 0x13, 0xE2,
+    0xBB, 0x96, 0x1C, 0x62, 0x7E, 0xE9, 0x5F, 0x27, 0x6F, 0x00, 0x58, 0xA7, 0x80, 0x9B, 0x09, 0x39,
+    0x5B, 0x54, 0x23, 0xC0, 0x66, 0xF1, 0x68, 0xAE, 0x56, 0xAB, 0x7F, 0x9B, 0x7C, 0x09, 0x46, 0xC8,
+    0x18, 0xDE, 0x65, 0x0B, 0x3D, 0xCB, 0x1D, 0x72, 0x80, 0xFA, 0x38, 0x1F, 0x81, 0xCC, 0xFD, 0xF3,
+    0xD1, 0x94, 0x05, 0x9A, 0x07, 0x2E, 0xA3, 0xC7, 0x5D, 0x87, 0x99, 0x0A, 0x6E, 0xAC, 0xF6, 0x0B,
+    0x52, 0x92, 0xDC, 0xCA, 0xC6, 0x8D, 0xD5, 0xBE, 0x64, 0xA0, 0x0D, 0x89, 0xAF, 0xB2, 0x62, 0xBF,
+    0xFB, 0xBE, 0x94, 0x05, 0xB3, 0xA0, 0x83, 0xFE, 0x7C, 0x6E, 0x40, 0xF2, 0x41, 0x99, 0x55, 0xE9,
+    0xED, 0x8D, 0xDD, 0xA9, 0x0A, 0xB8, 0x43, 0xC0, 0xD0, 0xD3, 0x06, 0x0C, 0xDD, 0xC3, 0x48, 0x00,
+    0x95, 0x17, 0x0A, 0xFE, 0x72, 0x11, 0x56, 0xAB, 0xF0, 0x7D, 0x68, 0x56, 0x24, 0x9F, 0x4E, 0x42,
+    0x59, 0xB7, 0x01, 0x43, 0xEF, 0x34, 0xEE, 0x32, 0x9F, 0xA1, 0x99, 0x6C, 0x0B, 0x60, 0xEF, 0x04,
+    0xDF, 0xE0, 0x33, 0xB3, 0x99, 0x3E, 0x6C, 0xB5, 0x83, 0x7D, 0xA7, 0x2F, 0x47, 0xF7, 0xD2, 0x7B,
+    0x34, 0x2F, 0x4E, 0x4F, 0x95, 0x42, 0xEA, 0x92, 0xAD, 0x1A, 0x3D, 0xC3, 0x4C, 0xE0, 0xA0, 0xD8,
+    0x7E, 0x9C, 0x4D, 0xEC, 0x36, 0x60, 0x57, 0xB0, 0xAD, 0x66, 0x98, 0x11, 0xB6, 0x5D, 0x70, 0x37,
+    0x62, 0xE8, 0xAA, 0x22, 0xEC, 0xF8, 0x89, 0x36, 0xDD, 0xF5, 0x0B, 0x7C, 0x89, 0x34, 0xF4, 0xE4,
+    0x43, 0x1C, 0x44, 0x0F, 0x5F, 0x04, 0x2B, 0xC9, 0x64, 0x2B, 0x21, 0x95, 0x58, 0x54, 0x72, 0x23,
+    0x8E, 0x44, 0xE8, 0x90, 0x2D, 0xD9, 0x28, 0xAD, 0xE4, 0x34, 0x6A, 0x2B, 0xF2, 0x4D, 0xC0, 0x0E,
+    0x05, 0xC9, 0x01, 0xD5, 0x94, 0xC9, 0xFC, 0x3D, 0xC3, 0x4A, 0xAA, 0x9A, 0xA6, 0x8A, 0x3B, 0x0C,
+    0x70, 0x7D, 0xC1, 0x46, 0x13, 0xF5, 0x98, 0xB1, 0xCF, 0xD9, 0xE9, 0x00, 0x3B, 0xC2, 0x79, 0x45,
+    0x54, 0x11, 0x26, 0x7C, 0x8B, 0x5D, 0xC1, 0x07, 0xED, 0x6C, 0x24, 0x4F, 0x2C, 0x1F, 0x4D, 0x9C,
+    0x89, 0x3F, 0xE2, 0x88, 0x8A, 0x64, 0xC3, 0x11, 0x05, 0x79, 0xE3, 0x30, 0xF3, 0xDC, 0x6A, 0x1F,
+    0x7B, 0xFB, 0x48, 0x43, 0x30, 0xA0, 0x67, 0x49, 0xE2, 0x62, 0x24, 0xD2, 0x1A, 0x1C, 0x60, 0xC7,
+    0x0F, 0xF9, 0x9A, 0x24, 0xF9, 0x66, 0xCA, 0x0F, 0x18, 0x74, 0x5A, 0x2F, 0xF9, 0xFB, 0x38, 0xC0,
+    0x8E, 0x19, 0xDF, 0x65, 0x9B, 0xB1, 0xCF, 0xF9, 0xD2, 0x8C, 0x82, 0x4D, 0x41, 0x39, 0xBB, 0x0E,
+    0x1C, 0x60, 0xC7, 0x5D, 0xF9, 0x9A, 0xE4, 0x33, 0x49, 0xBB, 0x31, 0x22, 0xB1, 0xB4, 0x1C, 0x60,
+    0xC9, 0xD3, 0x5F, 0x82, 0x31, 0x64, 0x77, 0xDD, 0x26, 0xC5, 0xA9, 0x5E, 0x62, 0x3F, 0xC0, 0x36,
+    0xA9, 0xE3, 0x9B, 0x08, 0xC2, 0xD5, 0x3E, 0xF6, 0x4E, 0x70, 0x90, 0x80, 0x45, 0x7A, 0x0E, 0x39,
+    0x3B, 0x0E, 0x05, 0x1B, 0x0E, 0x7A, 0x96, 0x92, 0x70, 0x70, 0x23, 0x78, 0xC0, 0x01, 0xCB, 0x8D,
+    0xB5, 0x29, 0x36, 0xF8, 0x26, 0x3D, 0x38, 0xB8, 0x09, 0x1C, 0x4C, 0x04, 0x87, 0x8A, 0xE0, 0x50,
+    0xB2, 0xE3, 0xA0, 0xD8, 0xA7, 0xEB, 0xC1, 0x05, 0x0E, 0x30, 0x73, 0xBE, 0x3E, 0xB5, 0xA4, 0xFF,
+    0x30, 0x61, 0x89, 0xC2, 0xDF, 0x8A, 0x69, 0x5C, 0xA6, 0x82, 0x55, 0x83, 0xBD, 0x13, 0xEC, 0xE1,
+    0x22, 0x7B, 0x30, 0xB2, 0xCF, 0x19, 0xD9, 0x2B, 0x46, 0xF6, 0x9A, 0x91, 0x7D, 0xC5, 0xC8, 0xDE,
+    0x5C, 0x89, 0xEC, 0xED, 0x4B, 0x91, 0x3D, 0x9F, 0x89, 0x7C, 0x99, 0x3A, 0xF2, 0x72, 0xD4, 0x91,
+    0xAF, 0x05, 0x1D, 0xF9, 0xFA, 0xA8, 0x23, 0xAF, 0x78, 0x1D, 0xC9, 0x5E, 0x47, 0xB2, 0xD3, 0x91,
+    0x6C, 0x74, 0xE4, 0x0C, 0x1D, 0x19, 0xA0, 0x23, 0x27, 0xE8, 0x08, 0xE3, 0x8B, 0x08, 0xB8, 0xAE,
+    0x1E, 0x91, 0xF1, 0xE7, 0x42, 0x9E, 0x14, 0x17, 0xBE, 0xB4, 0x5C, 0x9E, 0x8E, 0x4D, 0xB2, 0xED,
+    0xBD, 0x13, 0xC0, 0xDE, 0xBE, 0x1B, 0xA1, 0xD8, 0x71, 0x80, 0x9E, 0x15, 0x3B, 0xD8, 0x51, 0x58,
+    0x2E, 0xF5, 0x0C, 0x3D, 0xA3, 0x0E, 0xB0, 0x5E, 0x70, 0x21, 0xE0, 0xA0, 0x23, 0x32, 0x76, 0xD6,
+    0x43, 0xF1, 0x21, 0xB6, 0x09, 0x18, 0xA2, 0x43, 0x9A, 0xCF, 0x5B, 0xC0, 0x5E, 0x09, 0x0B, 0x32,
+    0x44, 0xE0, 0x1D, 0x92, 0xEC, 0x4A, 0x73, 0xD8, 0x40, 0x43, 0x52, 0x70, 0xC4, 0xB0, 0x99, 0x59,
+    0x4D, 0x40, 0xF2, 0x35, 0x1F, 0xE7, 0x06, 0x57, 0x22, 0x60, 0x0C, 0x2D, 0x99, 0x55, 0x6E, 0x2C,
+    0x8D, 0xFA, 0x6F, 0xD9, 0x82, 0xAF, 0xCF, 0x50, 0xB4, 0x13, 0x74, 0xE4, 0x00, 0x73, 0xFD, 0x13,
+    0xEE, 0xB2, 0x9B, 0x3C, 0x8B, 0xDC, 0xA4, 0x5E, 0x1C, 0x6F, 0x97, 0x8B, 0xB5, 0x0E, 0x09, 0xA7,
+    0x71, 0xFC, 0x2C, 0x0A, 0x36, 0x38, 0x7E, 0x96, 0x1E, 0x55, 0x4C, 0x99, 0x4A, 0xEC, 0x24, 0xC9,
+    0x4A, 0x32, 0x0E, 0xC2, 0x72, 0xAB, 0xD8, 0xC1, 0x04, 0x7A, 0x68, 0x02, 0xBC, 0xCA, 0x5E, 0x4C,
+    0x24, 0x3F, 0x16, 0xAD, 0x4B, 0xCF, 0xD5, 0x0C, 0xC5, 0x1E, 0x76, 0x34, 0x01, 0x9A, 0x6D, 0xC6,
+    0x9E, 0x1E, 0x96, 0x28, 0x99, 0x0B, 0x80, 0xA9, 0x0E, 0x05, 0x1B, 0x4D, 0x0F, 0x7A, 0x3D, 0xC3,
+    0xB2, 0x57, 0x6C, 0x4D, 0x50, 0x64, 0x5B, 0x45, 0xB8, 0x51, 0x93, 0x92, 0xED, 0xCB, 0x32, 0x2A,
+    0x76, 0x8A, 0x2F, 0xD0, 0x4C, 0x3A, 0xA2, 0xE0, 0xA3, 0x13, 0xBD, 0xF5, 0xD0, 0xB3, 0x79, 0x99,
+    0xAF, 0xB0, 0x45, 0x1D, 0xA9, 0xF8, 0x52, 0x04, 0x0C, 0x43, 0x21, 0xD0, 0x20, 0x0E, 0x3A, 0xD1,
+    0x75, 0x37, 0x09, 0x82, 0x13, 0x04, 0x20, 0xA6, 0x38, 0x08, 0x50, 0xA0, 0x94, 0x72, 0x62, 0x6F,
+    0x81, 0x75, 0x8D, 0xA8, 0x03, 0xF4, 0x6C, 0x46, 0x54, 0x41, 0x82, 0x7F, 0xAB, 0x08, 0x1D, 0x65,
+    0x5D, 0x45, 0xD1, 0x8D, 0x85, 0xF6, 0x7D, 0x46, 0x1D, 0xAA, 0x80, 0x92, 0xA8, 0x83, 0x8E, 0xD0,
+    0x84, 0x99, 0xF4, 0x8C, 0x8A, 0x8D, 0x19, 0x4B, 0xC2, 0xB0, 0xB5, 0x5E, 0xB1, 0xB1, 0xEC, 0xDC,
+    0xA0, 0xD8, 0x92, 0x1D, 0xFB, 0x8C, 0x3F, 0x27, 0x5F, 0x66, 0x07, 0x5E, 0x9E, 0xED, 0x55, 0xB6,
+    0x70, 0xBF, 0x0E, 0xE6, 0x5D, 0x02, 0x86, 0x53, 0x25, 0xA9, 0x9A, 0xBC, 0x16, 0x85, 0x73, 0x28,
+    0x38, 0x01, 0x05, 0x3B, 0x25, 0x1D, 0xA4, 0x05, 0xFB, 0x45, 0xE2, 0xDF, 0x22, 0xB3, 0x5D, 0xD9,
+    0x1B, 0xC9, 0x91, 0xDC, 0xBF, 0x6F, 0xD9, 0xDD, 0x42, 0x7B, 0x7B, 0xF0, 0xAC, 0x58, 0x9B, 0x26,
+    0xB1, 0x39, 0x89, 0x29, 0x6D, 0x80, 0x95, 0x40, 0xA7, 0x71, 0x97, 0x01, 0x76, 0x84, 0x89, 0xB0,
+    0x23, 0xAA, 0x78, 0x48, 0x5A, 0x2B, 0x59, 0x76, 0xEB, 0xB8, 0xE4, 0xDA, 0x9D, 0x2F, 0x08, 0x6F,
+    0x7D, 0x9A, 0x04, 0x7A, 0x61, 0x80, 0x86, 0x25, 0x4F, 0x7D, 0x20, 0x19, 0xEF, 0xCA, 0x2D, 0xE5,
+    0xEC, 0x8E, 0x2C, 0x65, 0xFF, 0xED, 0x48, 0x7A, 0x0F, 0xD6, 0xFB, 0x52, 0xCE, 0x66, 0xEB, 0xB7,
+    0x26, 0xD8, 0x6B, 0x2B, 0x17, 0x0E, 0xCB, 0xA3, 0xB7, 0x4A, 0x6B, 0xC3, 0x86, 0xC8, 0x77, 0x39,
+    0xBE, 0x83, 0xDD, 0x24, 0xCB, 0x49, 0x23, 0x68, 0xC9, 0xB9, 0x91, 0xEE, 0xC1, 0xC9, 0x49, 0x7E,
+    0x16, 0x51, 0x87, 0xE4, 0xB3, 0xE5, 0xDB, 0xCE, 0x3B, 0x0F, 0x46, 0xE4, 0xDE, 0x79, 0xC9, 0xF2,
+    0xE6, 0xFC, 0x02, 0xCB, 0x29, 0xD8, 0x00, 0x70, 0x5E, 0x8C, 0x17, 0xEE, 0xDA, 0xE3, 0x5C, 0xAD,
+    0x4E, 0x24, 0x25, 0x3D, 0x7C, 0xF0, 0xFA, 0xDA, 0x49, 0x39, 0x6E, 0x39, 0x6F, 0xB3, 0x2E, 0xD3,
+    0xF5, 0x8A, 0x74, 0x7D, 0x95, 0x7E, 0x2F, 0x67, 0x00, 0xFE, 0xD4, 0x79, 0x90, 0xCF, 0x7E, 0x77,
+    0x74, 0x5E, 0xAC, 0x6D, 0x4E, 0x12, 0xCC, 0x8F, 0xCE, 0x4B, 0x4C, 0xBC, 0xF3, 0x29, 0x6B, 0xF2,
+    0x32, 0xEC, 0xEE, 0x03, 0xDF, 0x3D, 0x78, 0x90, 0x3D, 0x2A, 0xF2, 0xD7, 0xC2, 0x0A, 0xFC, 0x93,
+    0x88, 0x9A, 0x0C, 0x76, 0xCC, 0x78, 0xE3, 0xB1, 0xDF, 0xB0, 0x4F, 0xA6, 0x48, 0x33, 0x01, 0x55,
+    0x14, 0x2B, 0xEF, 0x7C, 0x81, 0xEB, 0xB5, 0x24, 0xD7, 0x0D, 0x45, 0xB2, 0x63, 0x91, 0x24, 0xBB,
+    0xE5, 0xAB, 0xBE, 0x0E, 0x40, 0xC1, 0x26, 0xC5, 0xCF, 0xD2, 0x03, 0x76, 0xCC, 0xE9, 0xF1, 0xBF,
+    0x0B, 0xE4, 0xF6, 0x55, 0x36, 0x05, 0xC9, 0xC7, 0x23, 0x0A, 0x32, 0xDA, 0x11, 0x99, 0xC8, 0x2A,
+    0x82, 0x59, 0xD6, 0xB2, 0x5D, 0x89, 0xD6, 0x5A, 0x8B, 0x05, 0x48, 0x14, 0x2C, 0xD8, 0xD7, 0x65,
+    0x84, 0xBC, 0x24, 0xAB, 0xA7, 0x65, 0x4E, 0x51, 0x02, 0x85, 0xCA, 0xD9, 0x00, 0x45, 0x04, 0xDB,
+    0x45, 0x4F, 0x5C, 0xA4, 0xA0, 0x5A, 0xCC, 0x4D, 0xC2, 0x2D, 0x97, 0xBA, 0x06, 0xDC, 0xAF, 0xF9,
+    0x93, 0x00, 0xF0, 0x22, 0xCB, 0x88, 0x8C, 0x3F, 0x62, 0x41, 0x28, 0x3E, 0x4C, 0x25, 0x11, 0xAB,
+    0x39, 0xDB, 0x72, 0x56, 0xCC, 0xD8, 0xE9, 0xA8, 0x08, 0xF6, 0x55, 0x50, 0x84, 0x1B, 0xEA, 0x49,
+    0x11, 0xD6, 0x9B, 0x51, 0x11, 0x66, 0xB4, 0x5E, 0x11, 0x75, 0xE0, 0xA0, 0x88, 0x2A, 0x2C, 0x51,
+    0x88, 0x09, 0x27, 0x47, 0x81, 0xDC, 0xB6, 0x80, 0x9A, 0x5D, 0x07, 0x14, 0xC1, 0xF6, 0x80, 0x0E,
+    0xC6, 0x03, 0xD5, 0x58, 0x8D, 0x40, 0xED, 0xF5, 0x04, 0x98, 0x83, 0x0B, 0x62, 0x0A, 0x48, 0x20,
+    0x04, 0x49, 0x53, 0xD8, 0x28, 0x9E, 0xBC, 0xC1, 0xAE, 0x98, 0xAB, 0xD1, 0xF5, 0x65, 0xAC, 0x46,
+    0x3B, 0xE8, 0x50, 0x8D, 0xC6, 0xD7, 0x53, 0x35, 0xD6, 0x93, 0x19, 0xAB, 0xB1, 0x0A, 0xD6, 0x57,
+    0xA3, 0x8E, 0x1C, 0xAA, 0xB1, 0xA4, 0xF5, 0x92, 0x46, 0x31, 0x67, 0x27, 0x3F, 0x2E, 0xB4, 0xCC,
+    0x29, 0x15, 0x8B, 0xE1, 0x94, 0x4C, 0x47, 0x17, 0x12, 0xA3, 0x6D, 0xB4, 0x83, 0x24, 0x60, 0xF2,
+    0xEC, 0x50, 0x87, 0x84, 0x05, 0x76, 0x1E, 0x65, 0x50, 0x33, 0x72, 0x76, 0x30, 0x83, 0x0E, 0x28,
+    0xB9, 0xFA, 0x26, 0x9B, 0x2A, 0xD1, 0x44, 0x2F, 0xF4, 0xF4, 0x1B, 0x0A, 0xF5, 0x25, 0x0F, 0x2E,
+    0x25, 0x5B, 0xD2, 0xCA, 0xBD, 0xC7, 0x9F, 0x44, 0x38, 0x9F, 0xF3, 0x1B, 0x73, 0x35, 0xE5, 0xEC,
+    0x74, 0xA8, 0x26, 0xE3, 0x4B, 0xC2, 0x0E, 0x76, 0x70, 0x7D, 0x1D, 0x14, 0x1F, 0xE4, 0x0F, 0xD8,
+    0x39, 0xAF, 0x43, 0x31, 0x2B, 0xE6, 0xEC, 0xDC, 0x50, 0x4D, 0xE5, 0x5C, 0x52, 0xB1, 0xB1, 0x43,
+    0x15, 0xEA, 0x50, 0x85, 0x8C, 0xAD, 0x19, 0x9D, 0x77, 0x43, 0x31, 0xC3, 0xFD, 0x13, 0x2F, 0xB2,
+    0xA9, 0xA6, 0x8C, 0x97, 0x58, 0x07, 0xD8, 0x41, 0xB1, 0xDD, 0xDB, 0x07, 0x56, 0x27, 0x84, 0x86,
+    0x86, 0x33, 0x60, 0xBC, 0xC0, 0x13, 0x8D, 0x97, 0xF9, 0xD1, 0x78, 0xA8, 0xC8, 0x0E, 0xC6, 0xA3,
+    0x0C, 0xB6, 0x87, 0xF1, 0xD0, 0x93, 0x19, 0x60, 0x3C, 0xEA, 0xB1, 0xF6, 0x30, 0x07, 0x6B, 0xE7,
+    0xAB, 0x49, 0x4C, 0x49, 0x0C, 0x69, 0x9D, 0xA8, 0x24, 0x48, 0x98, 0x83, 0xF3, 0x74, 0x37, 0x09,
+    0xE3, 0x15, 0xEB, 0x91, 0xAD, 0xF1, 0xC5, 0x5C, 0x8F, 0xEC, 0x8C, 0xD7, 0xA1, 0x1E, 0x6D, 0x6F,
+    0x7C, 0x15, 0xEA, 0xD1, 0x78, 0xE3, 0xEB, 0xB1, 0x1E, 0x4D, 0xDA, 0xAA, 0x82, 0xF1, 0x6E, 0xA8,
+    0x47, 0x1D, 0x8C, 0x67, 0x5F, 0x8F, 0xE5, 0x9C, 0x1F, 0xB9, 0x7E, 0xA7, 0xD2, 0x47, 0x9D, 0x34,
+    0x6A, 0xBB, 0x70, 0x56, 0x74, 0xA8, 0x85, 0x56, 0xB4, 0x24, 0x00, 0x33, 0x89, 0x7E, 0xCD, 0xDE,
+    0x8C, 0x00, 0x0A, 0x8A, 0x7E, 0x28, 0xC6, 0x6E, 0x64, 0xA4, 0xB8, 0xEC, 0x64, 0x9D, 0x00, 0x11,
+    0x95, 0x58, 0xD6, 0x52, 0x56, 0x4B, 0xB8, 0xC9, 0xFD, 0x86, 0x1E, 0x7A, 0x2E, 0x59, 0x4A, 0x9A,
+    0x01, 0x6F, 0x26, 0xD4, 0x21, 0x4D, 0xA6, 0xAD, 0xF3, 0x55, 0x80, 0xF5, 0xA5, 0x88, 0x70, 0x62,
+    0x9F, 0xE2, 0x50, 0x12, 0xD6, 0x57, 0x11, 0xCE, 0x2B, 0xFE, 0x90, 0x5D, 0x49, 0x41, 0xC5, 0x3A,
+    0x9F, 0xB1, 0xDB, 0x59, 0xAD, 0x56, 0xAB, 0x7D, 0x31, 0xE0, 0x91, 0xC9, 0xC6, 0x4E, 0x9F, 0xF1,
+    0x17, 0x8F, 0x11, 0x42, 0xFF, 0x24, 0x0F, 0xA1, 0x20, 0x61, 0x05, 0x39, 0x5A, 0x53, 0x42, 0xC1,
+    0x93, 0xD5, 0x4E, 0xA8, 0xC7, 0xA1, 0x83, 0xBB, 0x14, 0x61, 0x5F, 0xA0, 0x0E, 0x8A, 0x65, 0xA8,
+    0xBD, 0x9E, 0x6A, 0x6F, 0x7A, 0xDB, 0xB9, 0x8E, 0x17, 0x99, 0x33, 0xA7, 0x9E, 0xCA, 0xA0, 0xA2,
+    0xED, 0x6B, 0xAF, 0x83, 0xF5, 0xD2, 0xC1, 0x7C, 0x1D, 0x52, 0x75, 0x96, 0x4C, 0x9D, 0x30, 0x67,
+    0xA7, 0x93, 0xC5, 0xD3, 0xCB, 0x98, 0xD4, 0xD6, 0x01, 0x75, 0x80, 0x90, 0x47, 0xE6, 0xEC, 0xC4,
+    0x96, 0x0E, 0x33, 0x25, 0x66, 0x72, 0xC5, 0x86, 0x3D, 0xEA, 0x00, 0x58, 0xCF, 0x01, 0x25, 0x57,
+    0xAB, 0xC7, 0x98, 0x86, 0xC8, 0x85, 0xF5, 0x49, 0x4C, 0xA7, 0x4B, 0x87, 0x27, 0x96, 0xFE, 0x3D,
+    0xE4, 0xFC, 0xC5, 0xB7, 0x48, 0xBA, 0x08, 0xE7, 0x33, 0xFE, 0x13, 0x5F, 0x64, 0x57, 0x07, 0xD0,
+    0x3B, 0x6F, 0xC7, 0x92, 0xB0, 0x63, 0x1D, 0xF4, 0x9C, 0xB3, 0x4B, 0xD5, 0xEC, 0xBC, 0x9E, 0x73,
+    0x76, 0x76, 0xAC, 0x43, 0xC1, 0xC6, 0x79, 0x3D, 0x97, 0xCC, 0xD9, 0xD5, 0x21, 0xE7, 0x0B, 0xEC,
+    0xA4, 0xB6, 0x47, 0xE7, 0xED, 0x98, 0xB3, 0xD3, 0x73, 0x1D, 0x6A, 0x61, 0x4D, 0xBD, 0xC4, 0x24,
+    0x5D, 0x8E, 0x7B, 0xFB, 0x3B, 0xAB, 0xD5, 0x6A, 0xD5, 0xB0, 0xB3, 0x42, 0xF9, 0x9F, 0x89, 0x8A,
+    0x23, 0xF5, 0xD0, 0x1B, 0xAF, 0xF8, 0xEC, 0xE3, 0x33, 0xD8, 0x29, 0xC2, 0x7A, 0x45, 0x14, 0x54,
+    0x84, 0x0E, 0x28, 0x66, 0xE3, 0x61, 0x0E, 0xD6, 0x17, 0x52, 0x2C, 0x0E, 0x39, 0x23, 0x29, 0x48,
+    0xA9, 0xEF, 0x49, 0x17, 0x27, 0x67, 0xB0, 0xAB, 0x26, 0xBE, 0x14, 0x14, 0xC1, 0x8B, 0xAC, 0x46,
+    0x1D, 0xD4, 0xAC, 0x83, 0xF1, 0xC6, 0x57, 0xDE, 0x78, 0xD7, 0x51, 0xFE, 0x1E, 0xA6, 0x9A, 0x15,
+    0x15, 0x75, 0xA8, 0xBC, 0x0E, 0x65, 0x30, 0x9E, 0x9D, 0xF1, 0x02, 0x7F, 0xFF, 0xAF, 0xA1, 0x22,
+    0xAA, 0x00, 0x35, 0xE7, 0xF4, 0x50, 0x73, 0x75, 0xA3, 0x81, 0x9A, 0x97, 0xA4, 0x7F, 0xC9, 0x73,
+    0xEC, 0xC8, 0x88, 0x8A, 0xA4, 0xE8, 0x93, 0x11, 0xBC, 0xF1, 0x6D, 0x06, 0x4C, 0x00, 0x7D, 0xB6,
+    0x44, 0x34, 0x89, 0xD8, 0x5B, 0x4B, 0x34, 0xE9, 0x00, 0x64, 0x8E, 0x87, 0x46, 0xD2, 0x09, 0x28,
+    0xB9, 0x71, 0x42, 0x61, 0xEF, 0xDB, 0xE2, 0x60, 0xB0, 0xF1, 0x90, 0x06, 0xD9, 0xF9, 0x0D, 0xAE,
+    0x3A, 0x4D, 0x9A, 0x01, 0xC0, 0x49, 0xF6, 0x99, 0x5B, 0x12, 0xA7, 0x79, 0x49, 0xF1, 0x51, 0x4B,
+    0x98, 0xD2, 0x8D, 0xD5, 0x62, 0xA5, 0x12, 0xA2, 0x41, 0x13, 0x57, 0xAB, 0x26, 0x11, 0xDB, 0x6C,
+    0x22, 0x99, 0x22, 0x70, 0x32, 0xA9, 0xD1, 0x0B, 0xDA, 0x22, 0x9F, 0x50, 0x4D, 0x19, 0xE1, 0x26,
+    0xD8, 0x17, 0x78, 0x06, 0xF5, 0xCD, 0x00, 0x54, 0x62, 0x75, 0x62, 0xA3, 0x25, 0x25, 0x21, 0x39,
+    0xAA, 0x1B, 0x2B, 0x37, 0x65, 0xC9, 0x46, 0xA6, 0x27, 0x49, 0x10, 0x79, 0xA7, 0x38, 0x13, 0xD8,
+    0x6C, 0x42, 0xF9, 0x07, 0xEC, 0x7C, 0x93, 0xD3, 0x72, 0xEB, 0x3A, 0x2E, 0x71, 0xB4, 0x36, 0xE0,
+    0x64, 0x9A, 0x67, 0x7D, 0x95, 0xEC, 0x2F, 0x37, 0x60, 0x6E, 0xAC, 0x00, 0xDB, 0x63, 0x59, 0x5C,
+    0x5B, 0xAD, 0x60, 0x48, 0xB6, 0xF5, 0x32, 0x1A, 0xB7, 0x99, 0x5B, 0x9C, 0xDB, 0xAE, 0x57, 0x44,
+    0x75, 0x93, 0xAD, 0x0E, 0x70, 0x9C, 0x61, 0x7C, 0x4E, 0x4E, 0x60, 0x57, 0x92, 0x83, 0x22, 0x6A,
+    0x7E, 0xD4, 0xAF, 0xAE, 0x4C, 0x60, 0x57, 0xCE, 0xCE, 0x2B, 0xC2, 0x8C, 0xEC, 0x75, 0xC8, 0x78,
+    0x91, 0xBD, 0xF1, 0x15, 0x0B, 0xDE, 0xE0, 0x6B, 0x1C, 0xE5, 0x41, 0x69, 0xB5, 0x3C, 0x49, 0x25,
+    0x93, 0x87, 0x66, 0x31, 0x45, 0x6C, 0x13, 0xB0, 0x19, 0xBF, 0xC5, 0xE7, 0x77, 0xDB, 0xAF, 0x12,
+    0xE3, 0x9F, 0xB4, 0x4B, 0x12, 0x66, 0x05, 0x1F, 0x9E, 0x5A, 0xEC, 0x36, 0x5F, 0xED, 0xED, 0x2B,
+    0x36, 0xAB, 0x07, 0x65, 0xD2, 0x7E, 0x9A, 0x30, 0x63, 0xC9, 0x2A, 0x80, 0x7D, 0x15, 0xAC, 0x57,
+    0x6C, 0xCC, 0x35, 0x76, 0x3A, 0x82, 0xAF, 0x12, 0x66, 0x54, 0xFC, 0x49, 0x00, 0x7B, 0x3D, 0x5B,
+    0xAF, 0xD8, 0xD4, 0x91, 0x9D, 0x8E, 0x70, 0xD7, 0x09, 0x33, 0xE6, 0x7C, 0x3D, 0x80, 0x7D, 0x49,
+    0x39, 0x2B, 0xB0, 0xD7, 0x11, 0x7C, 0x83, 0xAD, 0x19, 0x0B, 0x3E, 0xCA, 0x86, 0xBD, 0x0D, 0x15,
+    0xFF, 0x96, 0x8F, 0x49, 0xC6, 0xC5, 0xD4, 0xB5, 0x28, 0x92, 0xD7, 0x8C, 0x44, 0x8C, 0xBC, 0xA1,
+    0x0F, 0xF9, 0x68, 0x85, 0xBF, 0xF5, 0xAB, 0x85, 0xCF, 0x60, 0x86, 0x8C, 0xEE, 0x72, 0xD9, 0x28,
+    0x43, 0xD5, 0x08, 0xC7, 0x67, 0x4F, 0xB2, 0xD3, 0x6C, 0x61, 0x98, 0x73, 0x00, 0x38, 0x8A, 0x41,
+    0xEE, 0x69, 0xB1, 0xBB, 0x39, 0x0F, 0x64, 0xBC, 0x44, 0x00, 0x95, 0xC4, 0x57, 0x8B, 0x4E, 0xB7,
+    0xB8, 0xCE, 0xAF, 0xA4, 0x0F, 0x07, 0xEB, 0xF5, 0x9A, 0xAF, 0x11, 0x80, 0x8E, 0x72, 0xCE, 0x8B,
+    0x6C, 0x20, 0x76, 0x58, 0x28, 0xFE, 0x90, 0x3D, 0xE0, 0x46, 0xCD, 0x06, 0x35, 0xE5, 0x47, 0x7B,
+    0xC5, 0xAD, 0x2C, 0x97, 0xE9, 0x51, 0x42, 0x2D, 0x69, 0x0E, 0x25, 0xDA, 0x2F, 0x73, 0xA7, 0x92,
+    0xED, 0xB2, 0xDA, 0xE2, 0x51, 0x3A, 0xD8, 0xF0, 0x28, 0x75, 0x89, 0x47, 0x29, 0x98, 0x09, 0x05,
+    0x1F, 0x27, 0xC9, 0x57, 0x49, 0xF2, 0x06, 0x49, 0xCE, 0x66, 0x5E, 0x5F, 0xE0, 0xA3, 0x33, 0x32,
+    0x5E, 0x66, 0x07, 0xE7, 0xDD, 0x04, 0x1B, 0x34, 0x4F, 0xB9, 0x98, 0x6D, 0x1E, 0x5E, 0xE4, 0xA9,
+    0xA6, 0x6F, 0x24, 0x6B, 0x82, 0x1B, 0x00, 0xD8, 0x7F, 0x12, 0xED, 0xF4, 0x32, 0x1B, 0xC0, 0xF2,
+    0x51, 0x02, 0x8A, 0xB1, 0x0E, 0x40, 0xC5, 0x7F, 0x34, 0xE3, 0x92, 0x0E, 0x5A, 0xB1, 0xCD, 0xD9,
+    0xA1, 0x0A, 0x92, 0x47, 0x20, 0xB9, 0x84, 0x1A, 0xD4, 0x01, 0x55, 0x10, 0x6A, 0xFD, 0x01, 0xE0,
+    0xA0, 0xD8, 0x20, 0x67, 0x57, 0x05, 0x40, 0xB1, 0x71, 0x03, 0xA0, 0x67, 0xC5, 0x06, 0xA8, 0x42,
+    0x15, 0x00, 0x18, 0xEF, 0x06, 0x48, 0x38, 0x12, 0x90, 0xF1, 0x27, 0xA2, 0xAF, 0x5B, 0xB1, 0xE3,
+    0x8A, 0x71, 0x5C, 0x9C, 0x02, 0x46, 0x1A, 0x58, 0x24, 0x43, 0x09, 0x33, 0x4A, 0xC4, 0x41, 0xAB,
+    0x7D, 0xE0, 0xCE, 0x7F, 0xCF, 0x0E, 0x39, 0x7F, 0xCD, 0x06, 0x15, 0x9F, 0x21, 0xC0, 0xB9, 0x0A,
+    0x28, 0x38, 0x99, 0x51, 0xA8, 0xB4, 0xC1, 0x2E, 0x63, 0x57, 0x12, 0x8A, 0x8D, 0x19, 0x53, 0x78,
+    0x95, 0x0E, 0xE5, 0x0C, 0x98, 0xD1, 0x8C, 0x80, 0xFD, 0x25, 0x3B, 0x80, 0x97, 0x22, 0x90, 0x53,
+    0xF8, 0x69, 0xC4, 0x4C, 0x15, 0x37, 0x42, 0xB4, 0x61, 0xBB, 0x0C, 0x88, 0x99, 0x18, 0x8C, 0xEE,
+    0x3C, 0x0B, 0x40, 0xC7, 0x7A, 0x02, 0xA0, 0x43, 0xED, 0x01, 0xE8, 0x51, 0x56, 0xBE, 0xEE, 0x01,
+    0xE8, 0xA1, 0x16, 0x5B, 0xCD, 0xDE, 0x76, 0x38, 0xD8, 0x97, 0xB1, 0x96, 0x8F, 0x9F, 0x79, 0xE2,
+    0x34, 0x60, 0x3D, 0x3B, 0xC0, 0xF6, 0xEC, 0x00, 0xF7, 0x73, 0x36, 0x80, 0x6B, 0x09, 0xC0, 0x36,
+    0xF3, 0x11, 0xA2, 0xB3, 0xDF, 0x5B, 0x9B, 0x1C, 0xA5, 0x3C, 0x5D, 0x94, 0x35, 0x11, 0xFD, 0xE2,
+    0x36, 0xE8, 0x30, 0x59, 0xCF, 0x12, 0x30, 0x45, 0x7C, 0x63, 0x3C, 0xB8, 0xB0, 0xB0, 0xA6, 0x56,
+    0x82, 0x38, 0x91, 0x53, 0x67, 0xC0, 0x86, 0x9D, 0x15, 0xB0, 0x77, 0x42, 0x72, 0xCC, 0x16, 0x6C,
+    0x25, 0x28, 0x32, 0x19, 0x20, 0xCD, 0x64, 0x47, 0x40, 0x33, 0x67, 0x07, 0x37, 0x3A, 0x8F, 0x0D,
+    0x4B, 0x53, 0x22, 0x79, 0xA6, 0x07, 0x07, 0x71, 0x41, 0x48, 0xF8, 0x5E, 0xDA, 0x36, 0x93, 0xDA,
+    0x6C, 0xD7, 0x41, 0xB1, 0x49, 0xC7, 0x57, 0xA1, 0x20, 0xE4, 0x3A, 0xD0, 0xB3, 0x9E, 0xE1, 0x46,
+    0x88, 0x43, 0x5D, 0x47, 0xC8, 0xEF, 0x42, 0xB1, 0x0A, 0x90, 0xF2, 0x20, 0xE7, 0xC9, 0x09, 0xF5,
+    0x0C, 0x98, 0x80, 0x8C, 0xCE, 0xA3, 0x62, 0x0B, 0x4E, 0x62, 0xF0, 0xD2, 0xBC, 0xF1, 0x98, 0xE8,
+    0x6D, 0xFD, 0xE6, 0x7E, 0x8D, 0xE8, 0x38, 0x14, 0xBE, 0x9B, 0x16, 0x29, 0x82, 0x5E, 0xEC, 0x68,
+    0xBB, 0xDC, 0x02, 0x9E, 0x48, 0x70, 0xF5, 0x36, 0x59, 0x6B, 0x75, 0xC8, 0xBE, 0x9D, 0xA4, 0x86,
+    0xC3, 0x98, 0xA9, 0xE4, 0x9D, 0x3A, 0x7F, 0xC8, 0x3E, 0x9B, 0xF3, 0x30, 0x00, 0x6B, 0x13, 0x3F,
+    0x89, 0x8D, 0xC1, 0x30, 0xE1, 0x35, 0x4E, 0x2D, 0xDC, 0x71, 0x52, 0xCD, 0xA8, 0xC9, 0x25, 0x0D,
+    0xAE, 0x64, 0x97, 0x6F, 0x60, 0x47, 0x25, 0x59, 0xC5, 0x5A, 0x38, 0xAF, 0xF9, 0x2B, 0x06, 0x31,
+    0x1C, 0x56, 0x44, 0x3D, 0x8B, 0xEB, 0xB1, 0x96, 0x34, 0xAE, 0x43, 0xCE, 0xCE, 0x04, 0x94, 0x6C,
+    0x9C, 0x57, 0x6C, 0xCC, 0x84, 0x82, 0x8D, 0x19, 0x0B, 0x26, 0x3F, 0x75, 0x3D, 0x95, 0x73, 0xDA,
+    0xAC, 0x82, 0xF8, 0x30, 0x15, 0x05, 0xFF, 0x2F, 0x9B, 0xE5, 0x5C, 0x4F, 0x30, 0x01, 0x05, 0x1B,
+    0x45, 0x73, 0x08, 0xD9, 0xB0, 0x1E, 0xD5, 0x0C, 0x4D, 0x51, 0xB8, 0x35, 0x5B, 0x1B, 0x85, 0x7D,
+    0xB6, 0x48, 0x3A, 0x43, 0x9A, 0xAD, 0x7D, 0x0A, 0x9D, 0xB3, 0x49, 0x84, 0xDF, 0xA4, 0x17, 0xAC,
+    0xE6, 0x4D, 0xA4, 0xFA, 0x56, 0x2D, 0x6E, 0x55, 0xE2, 0x21, 0x19, 0x59, 0xB6, 0xA9, 0xC2, 0xFC,
+    0xFC, 0xA6, 0x67, 0x0B, 0x0B, 0xC8, 0xB2, 0x89, 0xCD, 0x66, 0x38, 0xDC, 0x3C, 0x75, 0x24, 0x3F,
+    0x67, 0xC4, 0x96, 0x78, 0xE0, 0x52, 0x16, 0x36, 0xB2, 0x5F, 0xB4, 0xF8, 0x7C, 0x0B, 0x63, 0xC0,
+    0x46, 0xF3, 0x0D, 0xD6, 0xEC, 0x6A, 0x36, 0x67, 0x15, 0x07, 0x33, 0x03, 0x19, 0xBD, 0x0D, 0x00,
+    0x38, 0xBA, 0x09, 0x80, 0x9B, 0x52, 0x8C, 0x4E, 0xE2, 0xDA, 0xFB, 0xB0, 0x95, 0x13, 0xD3, 0xB5,
+    0x9B, 0x00, 0xD8, 0x29, 0x5D, 0xC5, 0x44, 0x20, 0xA3, 0xAF, 0xD9, 0x9C, 0x50, 0x1C, 0x34, 0x5F,
+    0x99, 0x2B, 0x76, 0xF2, 0xEB, 0xAD, 0x68, 0x10, 0xA2, 0x3F, 0x4C, 0x32, 0x63, 0xF7, 0x40, 0xE6,
+    0xC4, 0xA4, 0x94, 0xA6, 0xF6, 0x6C, 0x5E, 0x20, 0x86, 0x00, 0x90, 0x37, 0x58, 0xEC, 0xE1, 0x05,
+    0x4F, 0x01, 0xC5, 0xA2, 0x80, 0xC4, 0x34, 0xD5, 0x3B, 0x71, 0x17, 0xBC, 0x1A, 0x5C, 0xA8, 0xE3,
+    0x6E, 0x4B, 0x4F, 0x8F, 0x8C, 0x6F, 0xB0, 0x4D, 0x0C, 0x9C, 0x9A, 0x66, 0x02, 0x4C, 0xE0, 0x00,
+    0xF0, 0x5D, 0xB6, 0x4B, 0x32, 0xE9, 0xB9, 0x0E, 0x80, 0x1B, 0x6D, 0x30, 0x3F, 0x62, 0xC7, 0x99,
+    0x6E, 0x4E, 0x88, 0x98, 0x4D, 0x11, 0x07, 0xA0, 0x96, 0xFA, 0x0C, 0xB7, 0x4D, 0x89, 0x97, 0x18,
+    0x74, 0x17, 0xC6, 0x8C, 0x25, 0x85, 0xB1, 0x10, 0xC4, 0x00, 0xC8, 0xE8, 0x52, 0x0B, 0xDB, 0xC6,
+    0x49, 0xFB, 0xDD, 0xFD, 0x74, 0xFF, 0x04, 0xB6, 0x29, 0x77, 0x17, 0x51, 0xFC, 0x90, 0xAC, 0x79,
+    0xC9, 0x00, 0x0A, 0x08, 0x9A, 0xFD, 0xE8, 0x9E, 0x65, 0xFC, 0x3D, 0x39, 0x03, 0x27, 0xE7, 0x46,
+    0x14, 0xDD, 0x0D, 0x6B, 0xA9, 0x49, 0x86, 0xC0, 0xA6, 0x24, 0x03, 0x38, 0x3F, 0xDE, 0xE1, 0xC6,
+    0x49, 0xB6, 0x36, 0x60, 0x1F, 0x7F, 0x2A, 0xA9, 0xA0, 0x00, 0xA0, 0x9A, 0xD3, 0xC3, 0xAE, 0x44,
+    0x8E, 0x41, 0xE2, 0xE0, 0x10, 0x34, 0x80, 0xF3, 0xE9, 0xBB, 0x54, 0x66, 0x08, 0xE3, 0x24, 0x00,
+    0x73, 0x33, 0x1D, 0xA4, 0x67, 0x8A, 0x85, 0x44, 0xF1, 0x42, 0x48, 0x36, 0x93, 0xD7, 0x52, 0xFA,
+    0x1F, 0x7B, 0x2D, 0x25, 0x7F, 0xAA, 0x83, 0x99, 0x90, 0xB3, 0x13, 0x7A, 0x54, 0x38, 0x8F, 0x82,
+    0x3F, 0xA4, 0x87, 0x20, 0x32, 0x0C, 0xA1, 0xD9, 0x0A, 0x41, 0xA5, 0xE3, 0x7C, 0x21, 0x41, 0xDF,
+    0x36, 0x42, 0xD3, 0x46, 0xD1, 0x7C, 0x84, 0x9C, 0x80, 0x5D, 0xCE, 0x38, 0x29, 0xBE, 0xD6, 0xFD,
+    0x0D, 0x2A, 0xE3, 0xD8, 0xF2, 0x1C, 0x4D, 0x4B, 0xE8, 0xF1, 0xB8, 0x60, 0x2A, 0x25, 0x88, 0xF2,
+    0x57, 0xA2, 0xFE, 0xE8, 0xA1, 0x14, 0xAB, 0xC0, 0xDF, 0x45, 0x19, 0xEB, 0xB0, 0xD4, 0x79, 0x12,
+    0x2D, 0x97, 0xA7, 0x08, 0x30, 0xCB, 0x53, 0x9A, 0x5A, 0xD5, 0xA4, 0x75, 0x8A, 0x59, 0x38, 0x39,
+    0x61, 0x57, 0x6A, 0x7D, 0xA8, 0xC4, 0x35, 0x3F, 0x2A, 0x72, 0xC8, 0xC4, 0x38, 0x39, 0x83, 0xF3,
+    0x73, 0xD0, 0x17, 0xD8, 0xD9, 0x94, 0x71, 0x46, 0x32, 0xF3, 0x49, 0x05, 0x6C, 0x50, 0x16, 0x10,
+    0x96, 0x58, 0x00, 0x55, 0x34, 0x13, 0xC4, 0xFC, 0x3E, 0x43, 0xB1, 0xC9, 0x78, 0x59, 0x0C, 0xD3,
+    0x76, 0xA4, 0x87, 0x19, 0x51, 0x47, 0x13, 0xA0, 0x23, 0x34, 0x4B, 0x76, 0x25, 0xDB, 0x92, 0x1D,
+    0x63, 0xC5, 0x78, 0x0F, 0xFB, 0xC5, 0xD6, 0xA4, 0xC4, 0x07, 0x31, 0xC2, 0x90, 0x0F, 0x93, 0x23,
+    0x32, 0xCE, 0xA8, 0x39, 0x48, 0x4D, 0xED, 0xE1, 0x70, 0x3C, 0x38, 0xF4, 0x6C, 0x4A, 0x42, 0x6D,
+    0x00, 0x18, 0xAB, 0x7C, 0x00, 0x80, 0xAC, 0xFB, 0x57, 0xEA, 0x76, 0xDD, 0xFB, 0xCE, 0x35, 0x32,
+    0xF6, 0xB8, 0x73, 0x2D, 0x63, 0xA5, 0x3C, 0xFB, 0xD5, 0x7C, 0x8B, 0xFF, 0x02, 0xF4, 0xDB, 0xFE,
+    0x0B, 0x37, 0x8A, 0xFF, 0xE2, 0x9F, 0x16, 0xFF, 0xC5, 0xD3, 0x6C, 0xC1, 0x11, 0x55, 0xD4, 0x14,
+    0x67, 0xC1, 0x68, 0x02, 0x2A, 0x76, 0x39, 0x3B, 0xE7, 0x41, 0xA2, 0x64, 0xC6, 0x5E, 0x31, 0x48,
+    0x6E, 0x8F, 0x8A, 0x23, 0x38, 0x68, 0x82, 0x1C, 0x0A, 0x36, 0x75, 0x54, 0x64, 0x57, 0x07, 0x98,
+    0xA9, 0x22, 0x1B, 0x7A, 0xD0, 0xBB, 0x97, 0x66, 0xA9, 0xAF, 0xD9, 0x84, 0x2A, 0x40, 0xF1, 0x99,
+    0xD1, 0x8E, 0x6E, 0x40, 0x49, 0xDB, 0xF1, 0x5D, 0xC1, 0x41, 0x65, 0xBC, 0x12, 0x80, 0x9A, 0x93,
+    0x4A, 0x13, 0x62, 0x5F, 0x2E, 0xCC, 0x54, 0xE2, 0x1A, 0xE2, 0x84, 0x4A, 0x20, 0x2A, 0x7D, 0x1A,
+    0xA1, 0x9F, 0x58, 0x0B, 0xAA, 0xDA, 0x25, 0x64, 0x9E, 0x4D, 0x32, 0xC5, 0x03, 0xDF, 0xFA, 0xC5,
+    0x73, 0x12, 0x1A, 0xD0, 0xFD, 0xE5, 0xFB, 0x2B, 0xE9, 0x4B, 0xE3, 0xEE, 0xD8, 0x10, 0xD4, 0x9E,
+    0xDE, 0x4A, 0x33, 0x19, 0x36, 0x69, 0x26, 0x2F, 0x10, 0x6E, 0x46, 0xF6, 0xD3, 0x82, 0xFD, 0x02,
+    0x1B, 0x59, 0xD2, 0x4C, 0xB6, 0xEF, 0x4B, 0x33, 0x79, 0x88, 0x41, 0xDD, 0x36, 0x2B, 0xF4, 0x9B,
+    0x21, 0x31, 0x7D, 0x19, 0x37, 0x26, 0x86, 0xC4, 0xA1, 0x49, 0x3E, 0xFB, 0xDD, 0x26, 0xDF, 0x68,
+    0x69, 0xE3, 0xA2, 0xFC, 0x9E, 0x94, 0x00, 0xEA, 0x93, 0x71, 0x33, 0x49, 0x66, 0x5B, 0x57, 0xAB,
+    0x3E, 0x78, 0x77, 0xE6, 0xDE, 0x44, 0x41, 0x86, 0x9C, 0x64, 0x67, 0x05, 0x7C, 0xC1, 0x87, 0xE8,
+    0xF1, 0x57, 0x26, 0x2E, 0x49, 0x54, 0xA6, 0x74, 0x82, 0x1D, 0xB1, 0xF1, 0x8C, 0x27, 0x5C, 0x46,
+    0x48, 0xBC, 0x81, 0x9A, 0xFD, 0xD7, 0xE0, 0xC8, 0x21, 0x27, 0x67, 0x01, 0x21, 0x95, 0x9C, 0x93,
+    0xB3, 0x51, 0x7F, 0x84, 0x0D, 0x71, 0xD6, 0xAB, 0x41, 0xA6, 0x8A, 0x1C, 0xBA, 0x43, 0x39, 0xD4,
+    0x0D, 0x74, 0xB4, 0x40, 0x26, 0xC2, 0x41, 0x58, 0xA6, 0x39, 0x81, 0xD5, 0xBE, 0x38, 0x03, 0x75,
+    0xF3, 0xFC, 0x57, 0x60, 0xF1, 0x07, 0xA6, 0x8F, 0x40, 0x35, 0x4F, 0x8B, 0x5C, 0x50, 0x8F, 0x0B,
+    0x54, 0xD8, 0xB8, 0x01, 0xB0, 0xE5, 0x04, 0x04, 0xFC, 0x03, 0xB2, 0x09, 0x80, 0xF2, 0x00, 0x70,
+    0xFA, 0x68, 0x37, 0xD4, 0x2F, 0xAF, 0x56, 0xEE, 0x27, 0x12, 0xB9, 0x74, 0x2D, 0xAE, 0x56, 0x6A,
+    0x58, 0x20, 0x6C, 0x25, 0xFD, 0x1F, 0x93, 0x93, 0x84, 0x32, 0xFD, 0x6D, 0x34, 0x6F, 0x22, 0xDE,
+    0x05, 0x9C, 0xB8, 0xE7, 0x69, 0x3A, 0x4E, 0x4E, 0x4D, 0xDA, 0xDF, 0xF9, 0x17, 0x8F, 0x44, 0x5E,
+    0x65, 0xF9, 0xCB, 0xC0, 0xFF, 0xB2, 0xC1, 0x31, 0xA0, 0x64, 0x8F, 0x9A, 0x73, 0x63, 0xC8, 0x68,
+    0xDE, 0x61, 0x34, 0x4D, 0x1D, 0x8F, 0x2F, 0x98, 0xCD, 0xBB, 0xB6, 0xA6, 0xBF, 0x4D, 0x48, 0x82,
+    0x3E, 0x94, 0xCE, 0xFF, 0x22, 0xDB, 0x08, 0x87, 0xF7, 0xE1, 0xAF, 0xF1, 0xC1, 0xAF, 0x42, 0xE6,
+    0x21, 0xD7, 0xA6, 0x8C, 0x1B, 0x92, 0xE8, 0xFA, 0xFE, 0x6F, 0xF5, 0x00, 0xCA, 0x67, 0x7F, 0x0A,
+    0xFC, 0x35, 0x06, 0x00, 0x5F, 0xC1, 0x7D, 0xCB, 0x8F, 0xDE, 0x71, 0x48, 0xFE, 0xF5, 0xB1, 0x5F,
+    0x8B, 0xEE, 0xB2, 0xB3, 0x41, 0x6D, 0x67, 0x1C, 0xEA, 0x34, 0x17, 0x28, 0x4E, 0xF7, 0xC9, 0x58,
+    0x88, 0xB2, 0x79, 0xF2, 0xAF, 0xE1, 0x53, 0xBC, 0xC3, 0x9F, 0xE0, 0x53, 0x78, 0xED, 0x2F, 0xBC,
+    0x21, 0xE9, 0x97, 0x73, 0xF1, 0xB9, 0x74, 0x8B, 0xFD, 0x4F, 0x7E, 0x59, 0x37, 0x4F, 0x1E, 0xDE,
+    0xF1, 0xBF, 0xFC, 0x90, 0xCB, 0xA9, 0x43, 0x21, 0xFB, 0x63, 0xD5, 0xFA, 0xBD, 0x87, 0x57, 0x38,
+    0x4C, 0xC2, 0xF4, 0xDC, 0x61, 0x07, 0xDA, 0xB4, 0x65, 0x36, 0x6E, 0x66, 0xD8, 0xBA, 0x59, 0x4E,
+    0x50, 0xE9, 0xF2, 0x0F, 0x08, 0x35, 0xE0, 0x3F, 0x02, 0x79, 0x9A, 0x6F, 0x3B, 0x40, 0x77, 0x1B,
+    0xD5, 0xF7, 0x67, 0x1B, 0x08, 0x9C, 0xF2, 0x00, 0xF2, 0x09, 0x00, 0xFE, 0x02, 0x00, 0xFE, 0x50,
+    0x2C, 0x83, 0x9F, 0xB8, 0xE1, 0xEE, 0x40, 0xB9, 0x38, 0x1F, 0xA3, 0x78, 0x9C, 0x01, 0xE8, 0xB9,
+    0xB1, 0xA9, 0x64, 0x9C, 0x71, 0x72, 0xB1, 0x09, 0x0D, 0xF8, 0x54, 0x5E, 0x7F, 0x09, 0x00, 0x25,
+    0x90, 0xEE, 0x50, 0x92, 0x68, 0xC4, 0x8D, 0xDC, 0x56, 0xFA, 0x0D, 0xD3, 0x94, 0x69, 0x84, 0x16,
+    0x34, 0x02, 0x13, 0x80, 0x16, 0xD0, 0x1D, 0x16, 0x5C, 0xD4, 0x04, 0xDC, 0x97, 0x74, 0xCD, 0x43,
+    0xFD, 0xE8, 0x30, 0x7F, 0xC7, 0x03, 0xB7, 0x6B, 0x98, 0xAF, 0x6F, 0xE0, 0x1F, 0xAB, 0x06, 0x28,
+    0x66, 0x11, 0xF2, 0xB5, 0x58, 0x06, 0x60, 0xA2, 0x8C, 0xB6, 0x26, 0xC1, 0xC3, 0x6D, 0x8A, 0xF9,
+    0xBC, 0x67, 0x51, 0x6A, 0x8F, 0x68, 0x09, 0x6C, 0x00, 0x1B, 0x51, 0x46, 0xC9, 0x38, 0x51, 0x8F,
+    0x02, 0xAA, 0x74, 0x3D, 0x32, 0xB2, 0xC9, 0xD9, 0x40, 0x53, 0xBE, 0x76, 0xF2, 0xB5, 0xA2, 0x7C,
+    0x5D, 0x47, 0x36, 0x39, 0x9B, 0x8C, 0xAF, 0x46, 0x94, 0x11, 0x9A, 0xD5, 0x88, 0x7A, 0x84, 0xF3,
+    0xB6, 0x87, 0xEB, 0x15, 0x7F, 0xC8, 0x26, 0x67, 0x63, 0x42, 0x19, 0x51, 0xC6, 0x8C, 0x7D, 0x3D,
+    0xA2, 0x1E, 0x35, 0xE1, 0x7A, 0xB8, 0xDE, 0xF9, 0x9C, 0x4D, 0xCE, 0x87, 0xD9, 0x96, 0x11, 0x65,
+    0x34, 0x01, 0xF5, 0x88, 0xFA, 0x9A, 0x5C, 0xD9, 0xBD, 0x3E, 0x23, 0x67, 0x93, 0x93, 0x1E, 0x65,
+    0x14, 0x4B, 0x58, 0x3D, 0x2E, 0x39, 0xEE, 0xA2, 0x63, 0x2F, 0x59, 0x17, 0xC4, 0x56, 0x78, 0x49,
+    0x98, 0x3F, 0xE6, 0x5A, 0xB0, 0x7E, 0xA9, 0x7F, 0xBA, 0x6E, 0x5B, 0xFB, 0x49, 0xC9, 0xAC, 0x17,
+    0x53, 0xE1, 0xE6, 0x29, 0x4F, 0x62, 0xEF, 0x62, 0x3E, 0x28, 0xD9, 0x64, 0x27, 0x80, 0x15, 0xA0,
+    0x08, 0x25, 0x51, 0x24, 0x12, 0x44, 0xD2, 0x55, 0xB3, 0x18, 0x0F, 0x52, 0x7E, 0x03, 0x61, 0x31,
+    0x92, 0x87, 0x6D, 0xA7, 0x39, 0x32, 0xE1, 0x67, 0xAB, 0x7D, 0x98, 0x11, 0x85, 0xC8, 0x69, 0x3A,
+    0x89, 0x6B, 0xB2, 0xB2, 0xB2, 0x22, 0x05, 0xFB, 0x42, 0x0F, 0x33, 0x2A, 0x3A, 0x0F, 0x33, 0x6A,
+    0x1A, 0x0F, 0x33, 0xD6, 0xC1, 0x78, 0x98, 0xD1, 0x4C, 0xD6, 0xC3, 0x78, 0x7A, 0xEB, 0x61, 0xAE,
+    0xB2, 0xB3, 0x1E, 0xE6, 0x3A, 0x5B, 0xEB, 0x61, 0x48, 0x58, 0x0F, 0xC3, 0x28, 0xAB, 0x49, 0x56,
+    0x1E, 0x96, 0xD1, 0xB0, 0x87, 0x65, 0x30, 0x6C, 0x65, 0x05, 0xD8, 0xD4, 0xE6, 0x7A, 0xDC, 0x56,
+    0x24, 0xCC, 0x91, 0x95, 0x24, 0x84, 0x59, 0xAA, 0x26, 0x0D, 0x7A, 0xAB, 0x46, 0xBC, 0x68, 0xE5,
+    0xA1, 0x53, 0x41, 0x93, 0x73, 0xCA, 0x97, 0x06, 0x4A, 0x14, 0x0E, 0xD9, 0xE2, 0x4E, 0x1E, 0x9C,
+    0xDB, 0x74, 0x7A, 0x39, 0x7A, 0x7E, 0xB6, 0x81, 0xE0, 0x48, 0x73, 0x1E, 0xEA, 0x63, 0xB5, 0x78,
+    0xE8, 0xFD, 0x1F, 0x73, 0xDA, 0xC2, 0x61, 0x77, 0xA2, 0x60, 0x3B, 0x9F, 0x92, 0x37, 0xA6, 0xBC,
+    0x77, 0x5D, 0x3D, 0x5F, 0x48, 0x3A, 0x9C, 0xCF, 0x37, 0x8E, 0xA4, 0x21, 0x25, 0xF6, 0xBE, 0x15,
+    0x51, 0x26, 0x9B, 0xDF, 0xE2, 0xB3, 0x27, 0x0E, 0xB9, 0xB7, 0x93, 0xE1, 0x74, 0xA1, 0x85, 0xFB,
+    0x08, 0xE9, 0xEE, 0x00, 0xC5, 0xB7, 0xFF, 0x5E, 0x1E, 0x9C, 0x56, 0x6D, 0x2C, 0xD3, 0x41, 0xF1,
+    0xD9, 0xC7, 0xD8, 0xDF, 0x06, 0x3B, 0xA6, 0xD8, 0xA7, 0x03, 0x48, 0x36, 0x66, 0xA1, 0xC5, 0x3A,
+    0x05, 0xCB, 0x83, 0x26, 0x27, 0xC5, 0xA8, 0x3F, 0xD6, 0x24, 0x47, 0x47, 0xF2, 0x2A, 0xBB, 0x82,
+    0xAF, 0x11, 0x05, 0x2F, 0x04, 0x68, 0x3A, 0x0F, 0x33, 0xB3, 0xFB, 0xEF, 0x79, 0x93, 0xFA, 0x0D,
+    0x5E, 0x08, 0x86, 0xD1, 0x79, 0xCB, 0xAB, 0x24, 0xF9, 0x63, 0x4A, 0x94, 0xA9, 0x84, 0x23, 0xE4,
+    0xFC, 0xC5, 0xBF, 0x99, 0x4B, 0x42, 0x8D, 0x75, 0x80, 0xBA, 0x1D, 0x92, 0xE8, 0xE8, 0x2E, 0xEC,
+    0xED, 0xDF, 0xF3, 0x9F, 0xA0, 0x83, 0xE1, 0xA0, 0x68, 0x84, 0x20, 0x99, 0xBD, 0xE1, 0xDB, 0x0C,
+    0x9A, 0x9D, 0xE6, 0xC3, 0xEC, 0x32, 0x0E, 0xF4, 0xE2, 0xA1, 0xD4, 0xD4, 0x33, 0x72, 0x5E, 0x64,
+    0x0B, 0xE7, 0x39, 0xA0, 0x0E, 0x66, 0x2A, 0x9E, 0xA1, 0x66, 0x79, 0x9D, 0x17, 0xF9, 0x02, 0x39,
+    0x70, 0x32, 0x1C, 0x0D, 0xFF, 0x56, 0x10, 0x82, 0xB3, 0xD4, 0x0D, 0x5F, 0x23, 0x5B, 0x33, 0x5A,
+    0x8E, 0x7A, 0xC6, 0xBF, 0xA6, 0x62, 0x8B, 0xBF, 0x00, 0x07, 0x64, 0x1F, 0x81, 0x63, 0x35, 0x61,
+    0x16, 0x53, 0x27, 0xDC, 0xDA, 0x70, 0x1F, 0x10, 0xEF, 0xF3, 0x29, 0xA4, 0x5A, 0xFB, 0xF0, 0x8D,
+    0xCD, 0x04, 0x7A, 0xEB, 0x7B, 0x6F, 0xF5, 0x18, 0x4D, 0x22, 0x19, 0x31, 0x24, 0xCD, 0xBC, 0x5E,
+    0x9B, 0x49, 0xEE, 0xE7, 0x93, 0xBE, 0x25, 0xA3, 0x81, 0x23, 0xD9, 0xD5, 0x24, 0x7D, 0xC9, 0x24,
+    0xA6, 0x8A, 0xE5, 0x4F, 0x9A, 0xB4, 0xE4, 0x66, 0x32, 0x39, 0xDC, 0x79, 0x81, 0xEB, 0xB3, 0xA2,
+    0xAD, 0xE9, 0xA5, 0xBB, 0x8D, 0x48, 0x32, 0xF3, 0xD1, 0x23, 0x6F, 0x7B, 0xFA, 0x6D, 0x77, 0x66,
+    0xAB, 0xD5, 0x6A, 0xDF, 0x92, 0x73, 0x41, 0x72, 0x38, 0xDC, 0xF0, 0xC9, 0xA7, 0xB8, 0x6C, 0x68,
+    0x92, 0xA0, 0xF0, 0x7C, 0x08, 0x6B, 0xF3, 0x8E, 0xBB, 0xB6, 0x3A, 0x7A, 0xCC, 0xED, 0x36, 0x0E,
+    0x53, 0xC6, 0x97, 0x5C, 0x58, 0x67, 0x05, 0x09, 0xD1, 0xE5, 0xB7, 0x0E, 0x32, 0xDB, 0x5E, 0xC8,
+    0x23, 0xBB, 0xC9, 0x37, 0x91, 0x33, 0x49, 0xE0, 0x64, 0x53, 0x1F, 0xC6, 0xEA, 0x3C, 0xC4, 0xFF,
+    0xEB, 0x8F, 0x29, 0x81, 0x24, 0x62, 0xBB, 0x91, 0x88, 0x9B, 0xC3, 0xAC, 0xEB, 0x62, 0x8C, 0xD0,
+    0xB3, 0xF3, 0x80, 0x39, 0x60, 0x07, 0xF0, 0x1D, 0x2E, 0x9D, 0x53, 0x14, 0x88, 0xA4, 0xCD, 0x74,
+    0xC9, 0x27, 0x3A, 0x5F, 0xA0, 0x4F, 0xAE, 0x77, 0x21, 0x40, 0x35, 0x64, 0x23, 0x19, 0x56, 0xC5,
+    0x2C, 0xBA, 0xB7, 0x4A, 0x7E, 0xC3, 0xF7, 0x2D, 0x0E, 0x21, 0xF6, 0x87, 0x8B, 0x79, 0xDD, 0xC0,
+    0x24, 0x55, 0x7C, 0x86, 0x59, 0x52, 0x72, 0x0F, 0x66, 0x2A, 0xE8, 0xCD, 0x04, 0x37, 0x99, 0x49,
+    0x9E, 0xC5, 0x2A, 0x98, 0x69, 0x41, 0xF0, 0x9B, 0x49, 0xBC, 0x7A, 0x55, 0x58, 0xAA, 0xC1, 0x84,
+    0xA4, 0x9C, 0x9E, 0x97, 0xD4, 0x30, 0x03, 0x2A, 0x71, 0x13, 0xCD, 0x92, 0xEB, 0x15, 0x00, 0xF0,
+    0xFF, 0x03, 0xED, 0xBD, 0x3D, 0xAC, 0x1E, 0x47, 0x7A, 0x2E, 0xF8, 0x74, 0x97, 0xCE, 0xE9, 0x5D,
+    0x35, 0xEC, 0x9A, 0x40, 0x34, 0x30, 0x12, 0x2E, 0xFA, 0x86, 0xD7, 0xF4, 0xFA, 0x76, 0xE2, 0xC0,
+    0x81, 0x3D, 0xD5, 0x12, 0x03, 0x01, 0xAB, 0x40, 0xE7, 0xEE, 0xF2, 0xD3, 0x2C, 0xAC, 0x40, 0x0E,
+    0x6E, 0x30, 0x96, 0x17, 0x97, 0x4E, 0x2E, 0xB0, 0x77, 0x31, 0xE3, 0x6E, 0x0D, 0x83, 0x09, 0x14,
+    0xE8, 0x78, 0xBD, 0xB3, 0x1B, 0x38, 0x18, 0x61, 0x21, 0x03, 0xD2, 0x27, 0xDC, 0x3D, 0x0E, 0x36,
+    0x18, 0x03, 0x1A, 0x55, 0x49, 0x84, 0x57, 0x01, 0x03, 0xB6, 0x46, 0x30, 0x14, 0x28, 0x60, 0xDB,
+    0x12, 0xEF, 0x78, 0xA8, 0x80, 0x25, 0xB1, 0x29, 0x36, 0xC9, 0xAA, 0x7A, 0x36, 0x78, 0xAB, 0xBF,
+    0x73, 0x48, 0x51, 0x1A, 0xFD, 0xCC, 0xF8, 0x67, 0x77, 0x3F, 0x9C, 0x53, 0xDD, 0x5D, 0x55, 0xFD,
+    0x53, 0xFF, 0xEF, 0xCF, 0xF3, 0xBE, 0x65, 0x66, 0x28, 0x76, 0x30, 0x73, 0x49, 0x07, 0x33, 0x43,
+    0x13, 0x9A, 0x50, 0xEC, 0x4A, 0x8E, 0x30, 0x0B, 0xCC, 0x0C, 0xB3, 0xA0, 0xA0, 0x53, 0xEC, 0x34,
+    0x01, 0xCD, 0x9C, 0x17, 0x66, 0x51, 0xEC, 0xCC, 0x0C, 0x14, 0x74, 0x66, 0xD6, 0x09, 0x40, 0x4D,
+    0xC5, 0xC7, 0xE8, 0x00, 0x98, 0xC5, 0xCC, 0x66, 0x06, 0x50, 0xF0, 0x02, 0x9F, 0x4C, 0x00, 0x50,
+    0xD3, 0x7C, 0x42, 0x07, 0x00, 0xE6, 0x0E, 0xED, 0x0C, 0x00, 0x25, 0x49, 0x02, 0x00, 0xFA, 0x9B,
+    0xEC, 0x03, 0x00, 0xE8, 0x64, 0x6E, 0x70, 0x04, 0xA0, 0x78, 0x81, 0x4F, 0x10, 0x00, 0xFA, 0xD9,
+    0xCC, 0x26, 0x00, 0xD0, 0x49, 0xF1, 0x51, 0x4E, 0x80, 0xA2, 0x33, 0x73, 0x4D, 0x00, 0x76, 0x56,
+    0xEC, 0x4C, 0x00, 0x74, 0x82, 0x99, 0x0B, 0x4E, 0x50, 0x74, 0x8A, 0x5D, 0x4D, 0x4E, 0x76, 0x86,
+    0x99, 0x61, 0xC8, 0x26, 0x41, 0xB1, 0x2B, 0xC8, 0xEB, 0x52, 0xC6, 0x9A, 0xB4, 0xB9, 0xD8, 0xF4,
+    0x90, 0x5F, 0xCD, 0x7C, 0x02, 0xFB, 0x95, 0xA3, 0xA6, 0xBD, 0x0D, 0x8A, 0x0D, 0x8A, 0x4D, 0x57,
+    0xB3, 0x53, 0xEC, 0x2A, 0x0E, 0x6A, 0x57, 0x71, 0xF4, 0x8A, 0x5D, 0x1B, 0x80, 0x7E, 0x51, 0xEC,
+    0xFA, 0x19, 0x68, 0xA3, 0x62, 0xC7, 0x09, 0xD0, 0x54, 0x3C, 0x43, 0x07, 0x28, 0x9E, 0x97, 0x32,
+    0x17, 0x7C, 0x87, 0xCF, 0xC4, 0xB5, 0x62, 0x16, 0x00, 0x30, 0xA4, 0x7C, 0x2C, 0x73, 0x55, 0x95,
+    0x7C, 0x87, 0xCF, 0x24, 0x00, 0x15, 0xCF, 0xF3, 0x09, 0x76, 0xEB, 0x73, 0x46, 0xC0, 0x04, 0xC5,
+    0x8E, 0x3E, 0x57, 0x4F, 0x1F, 0xCF, 0x16, 0x9C, 0x14, 0xBB, 0x96, 0x69, 0xFD, 0x9E, 0xA4, 0xD9,
+    0x29, 0x76, 0x8A, 0xA9, 0xCD, 0x95, 0x93, 0x72, 0x29, 0xAA, 0xAF, 0x77, 0x52, 0x9C, 0x95, 0x83,
+    0xE5, 0x84, 0x96, 0x4C, 0x30, 0x24, 0x9D, 0x21, 0x39, 0x35, 0xB7, 0x5F, 0xA5, 0xFF, 0x75, 0x80,
+    0x33, 0x00, 0xB3, 0xEC, 0x82, 0x39, 0x57, 0x67, 0xC5, 0x11, 0x24, 0x3B, 0x90, 0x0B, 0x40, 0xDE,
+    0x02, 0x48, 0x3A, 0x6C, 0x8E, 0xE8, 0x01, 0xD8, 0x05, 0x80, 0x09, 0x00, 0xDA, 0x5D, 0x60, 0xC2,
+    0xBF, 0x06, 0x6C, 0xE8, 0xFF, 0xF2, 0x69, 0x2E, 0x3D, 0x49, 0xDF, 0x93, 0x74, 0x3D, 0x49, 0x3C,
+    0x42, 0x7E, 0x00, 0xEC, 0x59, 0x00, 0x30, 0x03, 0x00, 0x3D, 0x01, 0xD0, 0x3E, 0x07, 0xCA, 0x7A,
+    0x40, 0xD1, 0x03, 0x8A, 0x0E, 0x28, 0x5E, 0x01, 0x8A, 0xA3, 0xDB, 0x68, 0xC8, 0x50, 0x91, 0x74,
+    0x24, 0x43, 0xFB, 0xC3, 0x73, 0x2C, 0x50, 0x70, 0x04, 0x8C, 0x07, 0xDA, 0x80, 0xA7, 0x6C, 0x44,
+    0xCF, 0x05, 0x0D, 0x23, 0x2A, 0x72, 0xC6, 0xE6, 0x1C, 0x01, 0x70, 0x92, 0x2F, 0xD3, 0xFC, 0x6B,
+    0x34, 0x3C, 0x22, 0xF9, 0x1E, 0xC9, 0x8F, 0x49, 0x4E, 0x2D, 0x79, 0x88, 0xBD, 0x08, 0xA0, 0x71,
+    0x40, 0x19, 0x00, 0xF4, 0x1D, 0xD0, 0x4C, 0x28, 0x8F, 0x16, 0x80, 0x01, 0x30, 0x11, 0xD8, 0x7F,
+    0x19, 0xE8, 0x3D, 0x4A, 0x8E, 0x6D, 0x40, 0xC1, 0xA9, 0x26, 0x40, 0x5F, 0xD2, 0x81, 0x1E, 0xD6,
+    0xC3, 0xCE, 0x68, 0x03, 0xFA, 0x05, 0x35, 0x61, 0x02, 0x4A, 0xBA, 0x36, 0x00, 0xD6, 0x37, 0x11,
+    0x68, 0x83, 0x4E, 0x40, 0x4D, 0x4D, 0xA0, 0xE4, 0x45, 0x02, 0xB0, 0x37, 0xD9, 0x01, 0x2D, 0xE9,
+    0x80, 0x9A, 0x7D, 0x00, 0x4A, 0xBE, 0xC5, 0x01, 0xB0, 0x9E, 0x33, 0xD0, 0x06, 0x4D, 0xA0, 0x66,
+    0x41, 0x8F, 0x92, 0xAE, 0x4D, 0x80, 0xF5, 0x8A, 0x23, 0xDA, 0x00, 0x13, 0x50, 0x13, 0x15, 0x79,
+    0x9B, 0x0E, 0x96, 0xC9, 0x7A, 0x68, 0xF2, 0x28, 0xA0, 0x20, 0x3F, 0x24, 0xD0, 0x72, 0x91, 0x71,
+    0x0A, 0x00, 0x8A, 0x03, 0x72, 0xF9, 0x73, 0x6B, 0xDE, 0x2F, 0xA1, 0x9D, 0x4F, 0x1D, 0x60, 0x6F,
+    0x53, 0x70, 0x84, 0x5D, 0x2A, 0x76, 0x15, 0x5D, 0x13, 0x61, 0x02, 0xFA, 0x59, 0xD1, 0x15, 0x1C,
+    0xDB, 0x88, 0x8A, 0x8F, 0x72, 0x42, 0x13, 0x9B, 0x04, 0xF4, 0x33, 0x3D, 0x0A, 0x5E, 0x26, 0x50,
+    0x91, 0x0B, 0xD0, 0x44, 0xCE, 0xBB, 0xE8, 0xB7, 0xE9, 0x51, 0xF1, 0x31, 0x7A, 0x34, 0xB1, 0xE4,
+    0x84, 0x7E, 0x56, 0xBC, 0xF2, 0xEF, 0x38, 0x2A, 0xF2, 0x2D, 0x76, 0x15, 0xD9, 0x44, 0xD4, 0x0C,
+    0xFD, 0x8C, 0x3A, 0x0F, 0x18, 0x07, 0x40, 0x11, 0x00, 0x74, 0x00, 0xA4, 0x31, 0xEF, 0x13, 0x7D,
+    0xEA, 0xC0, 0x4E, 0x28, 0x79, 0x81, 0x0E, 0x6D, 0xD2, 0x44, 0x41, 0x6F, 0x82, 0xD1, 0x04, 0x7D,
+    0xE0, 0xAC, 0x78, 0xE1, 0x0E, 0x07, 0x4D, 0xCD, 0x00, 0x13, 0x0C, 0x1D, 0xE8, 0x19, 0xA1, 0x78,
+    0x81, 0x13, 0x34, 0x35, 0x01, 0x13, 0xE8, 0x01, 0xDE, 0x61, 0x07, 0x45, 0x46, 0x40, 0xB3, 0x0F,
+    0x80, 0x09, 0x76, 0x01, 0xE8, 0x39, 0x43, 0xF1, 0x02, 0x3D, 0x34, 0x35, 0x3D, 0x4C, 0x30, 0x9C,
+    0x40, 0x4F, 0x8E, 0x8A, 0x17, 0x6E, 0xD2, 0x69, 0xEA, 0x8B, 0x74, 0x26, 0xFC, 0xA6, 0xE6, 0x40,
+    0x8F, 0x86, 0x67, 0xE8, 0xD0, 0xCA, 0x93, 0x13, 0x4E, 0x1D, 0x60, 0x6F, 0x53, 0xB1, 0x2B, 0x39,
+    0xF5, 0xF3, 0x8F, 0xFB, 0x50, 0xF1, 0x89, 0x4B, 0x44, 0x3F, 0x5B, 0xBA, 0x8A, 0x4F, 0x70, 0x46,
+    0x3F, 0xDB, 0x84, 0x8A, 0x4F, 0x70, 0x90, 0x9A, 0xAA, 0xD8, 0x07, 0xA0, 0x27, 0x07, 0x54, 0xEC,
+    0x23, 0xD6, 0xD8, 0x27, 0xE8, 0xD0, 0xCF, 0x96, 0xA8, 0xF8, 0x04, 0x17, 0xF4, 0xB3, 0xE5, 0x58,
+    0xF1, 0x89, 0x4B, 0xEC, 0xFA, 0xF9, 0xB5, 0x3E, 0x54, 0xEC, 0x4A, 0xFA, 0x7E, 0x46, 0xCD, 0xA1,
+    0x22, 0xD0, 0xC4, 0x92, 0x0E, 0x9A, 0x85, 0xBD, 0xD1, 0xD5, 0x7C, 0x94, 0x9C, 0x2B, 0x0E, 0x3D,
+    0xA3, 0xA2, 0x6B, 0xC8, 0xC7, 0x38, 0x56, 0xE4, 0xDB, 0x9C, 0xD0, 0xC7, 0x03, 0x7A, 0xD4, 0x84,
+    0xF5, 0x28, 0xE9, 0xFA, 0x05, 0xB0, 0x37, 0xFA, 0x00, 0xB4, 0x64, 0x00, 0x6A, 0x32, 0xC9, 0x84,
+    0x3F, 0x00, 0x96, 0x9C, 0x81, 0x36, 0x9E, 0x23, 0x50, 0xB3, 0x94, 0x5E, 0x68, 0x22, 0x60, 0x7D,
+    0x45, 0x87, 0x36, 0xC0, 0x06, 0xD4, 0x84, 0x66, 0x57, 0xD2, 0x15, 0x32, 0x04, 0x5A, 0xA2, 0x0D,
+    0x50, 0x1C, 0x6B, 0x02, 0x7D, 0x90, 0xAF, 0x72, 0xD6, 0x03, 0x9C, 0xCB, 0x6D, 0xB7, 0xEB, 0x74,
+    0x12, 0xFE, 0x31, 0xAF, 0x1E, 0x02, 0x32, 0x67, 0x9E, 0x0C, 0x8F, 0xF3, 0x6C, 0x0E, 0x14, 0x87,
+    0x82, 0x5E, 0xE5, 0x59, 0x7A, 0xD0, 0xEC, 0x14, 0x87, 0x36, 0x42, 0x71, 0xE8, 0x17, 0x28, 0x3E,
+    0x47, 0x0F, 0xC5, 0xF3, 0x74, 0x50, 0x7C, 0x81, 0x80, 0xE2, 0x51, 0x04, 0x14, 0x19, 0x00, 0xC5,
+    0xA3, 0x04, 0x28, 0xBE, 0xC0, 0x6E, 0x97, 0x47, 0xF2, 0x0F, 0x7D, 0x80, 0xE2, 0xD0, 0x26, 0xEC,
+    0x9E, 0xA9, 0x38, 0xEE, 0xDE, 0x05, 0x1B, 0xC8, 0x08, 0xB4, 0x0B, 0x99, 0x00, 0x3B, 0x93, 0x09,
+    0x05, 0x27, 0x32, 0x41, 0xD1, 0x91, 0x09, 0x9A, 0x80, 0x4E, 0x68, 0x23, 0xA0, 0x13, 0xFA, 0x05,
+    0xD0, 0x09, 0x9C, 0x64, 0x01, 0x74, 0x80, 0x4E, 0x35, 0x01, 0xE8, 0xD4, 0x44, 0x59, 0x31, 0x17,
+    0x00, 0x3A, 0xD1, 0x03, 0xD0, 0xB2, 0x4A, 0xE8, 0x64, 0x25, 0xD2, 0x48, 0x16, 0x2D, 0x37, 0x54,
+    0x72, 0x7B, 0x29, 0x0F, 0x03, 0x67, 0x79, 0x83, 0xAC, 0x9F, 0x6D, 0x02, 0x74, 0x82, 0x66, 0x07,
+    0x9D, 0xA0, 0xE8, 0xA0, 0x13, 0x0A, 0x7A, 0xE8, 0x04, 0xD8, 0x05, 0x3A, 0x01, 0x26, 0x6E, 0x36,
+    0x1B, 0x14, 0x9B, 0x33, 0xE4, 0x02, 0x9D, 0x34, 0x39, 0x81, 0x93, 0x21, 0x07, 0x4D, 0x6C, 0x8F,
+    0x12, 0xAC, 0x07, 0x9A, 0xA5, 0x62, 0x07, 0xF4, 0x93, 0x50, 0x07, 0xE7, 0x39, 0x00, 0x55, 0x6A,
+    0x03, 0x80, 0xE6, 0x36, 0x1D, 0x80, 0x9E, 0x11, 0x40, 0xC1, 0xA3, 0x80, 0xE3, 0xA4, 0xC5, 0x04,
+    0x00, 0xFD, 0x64, 0x16, 0xA0, 0xE0, 0xD0, 0x2F, 0x40, 0x95, 0x60, 0x67, 0xA0, 0x59, 0x60, 0x3D,
+    0xD0, 0x4F, 0xA0, 0x47, 0xC1, 0x01, 0xF4, 0xA8, 0x12, 0x0A, 0x4E, 0xBD, 0x07, 0x7A, 0x2F, 0xA9,
+    0xF3, 0x57, 0x3F, 0xDC, 0xD8, 0x6C, 0xEC, 0x0C, 0x4B, 0x92, 0x9F, 0x75, 0xC8, 0x59, 0xBE, 0xDC,
+    0xA3, 0x99, 0xE4, 0xC0, 0xFB, 0x1E, 0x4E, 0xD2, 0x0F, 0x5F, 0xE2, 0x90, 0x4E, 0x1D, 0x60, 0x6F,
+    0x03, 0x9D, 0x50, 0xD2, 0x29, 0x0E, 0xB0, 0x1E, 0x9C, 0xD0, 0x06, 0x98, 0x05, 0x35, 0xEF, 0x9B,
+    0x90, 0xB6, 0x47, 0x84, 0x26, 0x49, 0xA7, 0x48, 0xD2, 0x83, 0x24, 0x77, 0x09, 0x9F, 0xFB, 0x28,
+    0x5E, 0xE7, 0x00, 0xCB, 0x20, 0x2B, 0xBA, 0x59, 0x50, 0x33, 0xD3, 0x71, 0xFE, 0x78, 0xF2, 0x94,
+    0x89, 0x14, 0x9F, 0x99, 0xB0, 0xE9, 0x7A, 0x29, 0x74, 0x1B, 0x80, 0x86, 0x7C, 0x4F, 0x26, 0xF7,
+    0x4F, 0xE8, 0x50, 0x90, 0x31, 0xD7, 0xC8, 0xB9, 0x00, 0x34, 0x11, 0x35, 0x81, 0x8A, 0x5D, 0x49,
+    0x87, 0x82, 0xE3, 0x5A, 0xA3, 0xED, 0x9A, 0xB8, 0xD9, 0x3C, 0xCD, 0xAE, 0x24, 0x49, 0x8E, 0x6B,
+    0xFB, 0xB4, 0x24, 0x19, 0x51, 0x93, 0x24, 0xBB, 0x92, 0x7F, 0xBB, 0x79, 0xEA, 0x3E, 0x77, 0x7E,
+    0xEE, 0x63, 0x7F, 0x71, 0xA2, 0x4C, 0xC2, 0x9B, 0x03, 0xA9, 0x89, 0x77, 0x38, 0xC0, 0x92, 0x4F,
+    0x26, 0x94, 0x64, 0x34, 0x0B, 0x6A, 0x6E, 0x5F, 0x92, 0xDA, 0xCB, 0x55, 0x29, 0xF5, 0x9A, 0x2B,
+    0x39, 0xD7, 0x78, 0xAE, 0x7E, 0x69, 0x8B, 0x5D, 0xD2, 0xFD, 0xEE, 0x5A, 0x50, 0x7F, 0x7E, 0x52,
+    0x4F, 0x99, 0x4E, 0xA5, 0xD4, 0x01, 0x80, 0xD4, 0x86, 0xFB, 0xAC, 0xA8, 0x4C, 0x3F, 0xC1, 0x7A,
+    0xA1, 0x7A, 0xBE, 0x5A, 0x14, 0x79, 0x28, 0x51, 0x24, 0xA7, 0x35, 0x4A, 0xA6, 0x65, 0x43, 0x92,
+    0xDD, 0x1A, 0x15, 0x6A, 0x02, 0x26, 0x3E, 0x7A, 0x8E, 0x3E, 0x3F, 0xAB, 0xE5, 0x13, 0xF9, 0x59,
+    0x76, 0xC9, 0x51, 0x8A, 0x17, 0x73, 0x54, 0x1B, 0x72, 0x54, 0xB1, 0x8B, 0x6A, 0xE2, 0xFA, 0x11,
+    0x7C, 0xEF, 0xDE, 0xA8, 0x42, 0xFA, 0xDA, 0x4A, 0x14, 0x4A, 0x5F, 0x5B, 0xA3, 0x84, 0x48, 0x01,
+    0x60, 0xA4, 0xFB, 0x95, 0xB7, 0xAD, 0xD0, 0x22, 0x79, 0x39, 0xCA, 0xCC, 0x07, 0xD6, 0x28, 0xB9,
+    0xAF, 0x20, 0xC7, 0x7C, 0xDF, 0xA9, 0x0E, 0x38, 0xB5, 0xD9, 0x6C, 0xCE, 0x42, 0x1A, 0xCE, 0x43,
+    0xCA, 0xE4, 0x20, 0x4D, 0x07, 0xC0, 0xA4, 0xAD, 0x0D, 0x42, 0xE4, 0x08, 0x31, 0x39, 0x94, 0x32,
+    0xBD, 0xCA, 0x48, 0x35, 0x8B, 0xD0, 0xA8, 0x9C, 0x60, 0x6F, 0xBF, 0x24, 0xC9, 0x8C, 0x92, 0xCC,
+    0x04, 0xB3, 0x08, 0x7D, 0xCC, 0x09, 0x96, 0x8C, 0x8A, 0x43, 0xC9, 0x37, 0x18, 0xE4, 0x6E, 0x3B,
+    0xCB, 0xDD, 0x9C, 0x38, 0xC1, 0xFA, 0x92, 0x17, 0x38, 0x94, 0x74, 0x15, 0x25, 0xB9, 0x09, 0x92,
+    0xDC, 0xFB, 0xFC, 0xD9, 0xEE, 0x2E, 0x56, 0x44, 0x08, 0xB1, 0x4E, 0x71, 0x04, 0x50, 0xDE, 0x96,
+    0x62, 0xD6, 0xE4, 0x9C, 0x0B, 0xDB, 0x49, 0xB7, 0x98, 0x85, 0x50, 0x5F, 0x29, 0xF7, 0x13, 0xBF,
+    0x9A, 0x8B, 0x54, 0x90, 0x17, 0xC6, 0xC3, 0x01, 0x8A, 0x4C, 0x00, 0x5A, 0x5E, 0xF9, 0xAB, 0x5D,
+    0xF5, 0xD6, 0x1C, 0x70, 0xEE, 0x10, 0x26, 0xA0, 0xE1, 0x0C, 0x4E, 0x25, 0x39, 0x57, 0xEC, 0x34,
+    0xE9, 0xDB, 0x00, 0x7B, 0x9B, 0x93, 0xF5, 0x8A, 0xCF, 0xF1, 0x02, 0x9D, 0x0E, 0x8A, 0x9A, 0x30,
+    0x5E, 0x07, 0x13, 0x40, 0x67, 0x3C, 0xBD, 0x22, 0xF8, 0xA6, 0x24, 0xD5, 0xEC, 0x8C, 0x6F, 0x42,
+    0x93, 0x60, 0x47, 0x3B, 0x99, 0x50, 0xF0, 0x02, 0x3B, 0x1B, 0x14, 0xFB, 0x00, 0xC6, 0x8A, 0x74,
+    0x25, 0xF9, 0x23, 0x46, 0x69, 0x83, 0x49, 0x0E, 0x74, 0x32, 0x07, 0x48, 0x17, 0x0F, 0xC0, 0xDE,
+    0x41, 0xA6, 0xF8, 0x8A, 0x3F, 0x02, 0xCA, 0xD7, 0x0F, 0x01, 0x90, 0x0E, 0x68, 0x98, 0x00, 0x90,
+    0x33, 0xA0, 0x79, 0xD5, 0x01, 0xFD, 0x82, 0x67, 0xBB, 0x92, 0xAE, 0xE1, 0xA4, 0x13, 0xC8, 0xC9,
+    0x2C, 0x9A, 0x7C, 0x83, 0xA3, 0xF9, 0x84, 0x3F, 0x60, 0xC7, 0x33, 0xA9, 0x89, 0x55, 0xA8, 0x83,
+    0x99, 0x1B, 0xDF, 0x7A, 0x4E, 0x66, 0xE4, 0x79, 0x3A, 0xBE, 0x15, 0x6B, 0x3E, 0x46, 0xEB, 0x35,
+    0x7F, 0x40, 0x76, 0x2D, 0xC9, 0x05, 0x2D, 0xC9, 0x0F, 0xBB, 0x96, 0x64, 0xC4, 0x23, 0x24, 0x67,
+    0xE0, 0x6C, 0x25, 0xBD, 0xE8, 0x60, 0xAD, 0xCE, 0x96, 0xB7, 0x00, 0x4B, 0x2E, 0x05, 0xC9, 0x54,
+    0x90, 0x24, 0xC8, 0xAB, 0x1C, 0x98, 0x50, 0x8E, 0x7D, 0x04, 0x60, 0x12, 0x00, 0x4D, 0x00, 0x15,
+    0x07, 0xA0, 0xE4, 0x08, 0x40, 0xAA, 0x3F, 0xAC, 0x29, 0xD2, 0xBB, 0x8F, 0x23, 0x6B, 0x76, 0x40,
+    0x21, 0xD7, 0x11, 0x40, 0x4D, 0x07, 0x14, 0x8C, 0xC0, 0x1F, 0xB6, 0xBC, 0xF5, 0x74, 0x50, 0x24,
+    0x29, 0xFC, 0x57, 0x49, 0xD2, 0xA3, 0x26, 0x27, 0xA0, 0xF9, 0x00, 0x40, 0x11, 0x01, 0xA0, 0x75,
+    0x00, 0xAA, 0x05, 0x40, 0x91, 0x00, 0x9C, 0xE6, 0x00, 0xD4, 0x1C, 0x81, 0x92, 0x13, 0x80, 0xD3,
+    0x03, 0x80, 0xC2, 0x7E, 0x80, 0x92, 0x0C, 0xC8, 0x7C, 0xDC, 0x52, 0xF3, 0x36, 0x0B, 0xCE, 0xF8,
+    0xC3, 0x36, 0xE5, 0x6F, 0x32, 0x21, 0xD3, 0x55, 0x66, 0xB9, 0xEB, 0x24, 0x27, 0x95, 0xF4, 0x78,
+    0x40, 0x73, 0x7C, 0x66, 0xB0, 0xE4, 0xA2, 0x48, 0x0E, 0x35, 0xB9, 0xE0, 0x11, 0x46, 0xA0, 0x9E,
+    0x57, 0xFE, 0x2C, 0xAD, 0xEC, 0x19, 0x33, 0x77, 0x66, 0x98, 0x1F, 0xF2, 0xF0, 0xA1, 0x4C, 0x2C,
+    0x97, 0x49, 0xF2, 0x26, 0x49, 0x46, 0x92, 0xA4, 0xC9, 0x73, 0xE8, 0xB2, 0xB2, 0x1D, 0x42, 0xDC,
+    0x71, 0x5A, 0xC7, 0xC0, 0xD7, 0x8D, 0x24, 0x1D, 0x54, 0x26, 0x1E, 0x03, 0x60, 0xC8, 0x1C, 0x09,
+    0x19, 0x7A, 0x4D, 0x00, 0x50, 0x71, 0x37, 0x04, 0x3F, 0x1D, 0x79, 0x6A, 0xB3, 0xD9, 0x6C, 0xCC,
+    0xEE, 0x63, 0x0D, 0x49, 0x9E, 0x7E, 0x95, 0xB7, 0xB7, 0x72, 0xC7, 0x57, 0x0E, 0xE8, 0xEF, 0x0D,
+    0xF2, 0xAA, 0xFB, 0xF9, 0xC1, 0xA9, 0x03, 0x3B, 0x03, 0x6D, 0xE8, 0x03, 0xD0, 0x07, 0x13, 0x01,
+    0xFA, 0x86, 0xC2, 0x70, 0x76, 0x8A, 0x4E, 0xD1, 0x55, 0x1C, 0x4A, 0x8E, 0x22, 0xB1, 0x68, 0x12,
+    0x60, 0x67, 0x13, 0x00, 0x13, 0x44, 0x62, 0x41, 0x0F, 0x68, 0x72, 0x04, 0xAA, 0x75, 0x5A, 0xE8,
+    0x80, 0x42, 0xA6, 0x18, 0x99, 0x58, 0xB3, 0xB8, 0xE2, 0x2B, 0x87, 0x9B, 0x03, 0x14, 0x9B, 0x27,
+    0xD8, 0xC1, 0x04, 0x13, 0x50, 0xF1, 0x02, 0x1D, 0xEC, 0xDC, 0x24, 0x68, 0x82, 0x5E, 0x78, 0xE3,
+    0x36, 0xA0, 0x5F, 0xE4, 0x7B, 0xFB, 0x19, 0x6D, 0xD4, 0x84, 0xCC, 0x95, 0x35, 0x9B, 0x08, 0xF4,
+    0x1F, 0xD3, 0x41, 0xB1, 0x9F, 0x81, 0xF6, 0x0E, 0x01, 0x50, 0xC4, 0x2C, 0x11, 0x40, 0x2F, 0x9F,
+    0xBD, 0x00, 0x68, 0xE5, 0xAB, 0xFD, 0x8E, 0x6B, 0xE5, 0xF4, 0x45, 0x4F, 0xFF, 0x71, 0xAA, 0xB1,
+    0xDC, 0xDA, 0xB4, 0xED, 0x14, 0x49, 0xDE, 0x27, 0xFC, 0xE7, 0x57, 0x8D, 0x3D, 0x49, 0x57, 0x91,
+    0x0C, 0x27, 0x4F, 0x3F, 0xA7, 0x1A, 0x4D, 0x00, 0x6A, 0xA2, 0x4D, 0x80, 0x7C, 0x19, 0x4C, 0x40,
+    0x45, 0x07, 0x3B, 0xA3, 0xE4, 0x58, 0x70, 0x12, 0xC1, 0x99, 0x03, 0x7A, 0x61, 0x2A, 0x4C, 0x10,
+    0x56, 0x86, 0xAD, 0x0C, 0x33, 0xBB, 0x00, 0x79, 0x8C, 0xE6, 0xD9, 0x1E, 0xB0, 0x22, 0x7C, 0xE8,
+    0x33, 0x49, 0xCA, 0x41, 0x16, 0xB3, 0xF1, 0x38, 0xA7, 0x16, 0xA1, 0x5A, 0x1B, 0xDB, 0x08, 0xC0,
+    0x2C, 0x9A, 0x00, 0xE8, 0x2B, 0x0E, 0x28, 0x38, 0x2A, 0x8E, 0x50, 0x74, 0xC8, 0x14, 0x8C, 0x65,
+    0x68, 0x12, 0x60, 0x18, 0x4C, 0x00, 0x1A, 0x06, 0x3B, 0x03, 0x3A, 0x53, 0x11, 0xCD, 0x97, 0x3F,
+    0x9C, 0x3A, 0x8B, 0x62, 0xD3, 0xB5, 0x09, 0x35, 0x9D, 0x66, 0xA7, 0x89, 0x8A, 0xCE, 0x44, 0x94,
+    0x9C, 0xFA, 0x00, 0xD0, 0xD3, 0x03, 0x7D, 0xE2, 0xB8, 0x52, 0x26, 0x9A, 0xB2, 0x30, 0xC8, 0x1C,
+    0x25, 0xE5, 0x8E, 0x58, 0xE3, 0x25, 0x8F, 0xE4, 0xA7, 0xA7, 0x47, 0xC9, 0xA9, 0x8F, 0x67, 0x2B,
+    0x3A, 0xC3, 0xA8, 0xD9, 0x69, 0xC6, 0x36, 0xA1, 0x66, 0xEC, 0x03, 0x14, 0x23, 0x00, 0xE8, 0x2F,
+    0x1C, 0xEE, 0x9D, 0x35, 0x24, 0x79, 0x86, 0x43, 0x41, 0x92, 0x49, 0x27, 0x54, 0x24, 0xB9, 0x98,
+    0x05, 0x0D, 0x49, 0x4E, 0x9C, 0x64, 0x72, 0x3E, 0x2F, 0x8B, 0x47, 0x6E, 0xE2, 0x36, 0xE4, 0xBE,
+    0x68, 0xBD, 0x34, 0x77, 0x49, 0x27, 0xF3, 0xEB, 0x3F, 0x41, 0x16, 0x6E, 0xB7, 0x76, 0x25, 0x13,
+    0xC8, 0x20, 0x62, 0xE7, 0xBC, 0x20, 0xCA, 0x12, 0xD2, 0x92, 0x3B, 0x51, 0xF4, 0xAE, 0xA5, 0xB0,
+    0xD2, 0x57, 0xC7, 0xA4, 0x66, 0xF5, 0x85, 0xB2, 0x9C, 0xDA, 0x6C, 0x36, 0xC5, 0x06, 0x8A, 0xE4,
+    0xD2, 0x7B, 0x18, 0x92, 0x3F, 0xE0, 0xEE, 0xF2, 0xB4, 0x4D, 0xDB, 0xC7, 0x29, 0x77, 0xF4, 0x1E,
+    0x68, 0x02, 0xAA, 0x5F, 0xD6, 0xA5, 0x70, 0x2A, 0x45, 0x2E, 0x67, 0x23, 0xA5, 0xBB, 0xE7, 0x12,
+    0xC7, 0xBC, 0xD9, 0xCA, 0xAF, 0x7D, 0xC1, 0xCB, 0x4D, 0x67, 0x16, 0xA0, 0x15, 0x49, 0x40, 0x4D,
+    0x28, 0x0E, 0x28, 0xE9, 0xC0, 0x09, 0xB0, 0x1E, 0x66, 0x01, 0xDA, 0xF0, 0xE5, 0x12, 0xBD, 0x24,
+    0x26, 0x88, 0xC4, 0xE7, 0xD6, 0x1F, 0x93, 0xF9, 0xF3, 0x9D, 0x74, 0xAB, 0x95, 0x95, 0x00, 0x1A,
+    0x8A, 0xD8, 0x63, 0x0F, 0x65, 0xFE, 0xAE, 0x2C, 0x83, 0x6F, 0xC3, 0x49, 0xEA, 0xB7, 0xCC, 0x74,
+    0xAE, 0x95, 0xAE, 0x9E, 0xC9, 0xDD, 0x5A, 0x86, 0xFF, 0x9A, 0x98, 0x7B, 0x37, 0x94, 0xD0, 0xC2,
+    0xC8, 0x64, 0xBF, 0xF9, 0xFC, 0xC4, 0xCD, 0x01, 0xF6, 0x36, 0x30, 0x41, 0x04, 0x3B, 0x00, 0x27,
+    0x25, 0xE4, 0x87, 0xC8, 0x48, 0xEE, 0x93, 0x20, 0x2C, 0x5B, 0x1B, 0x50, 0x71, 0xA8, 0xF8, 0xB7,
+    0x47, 0x9C, 0x40, 0x92, 0x32, 0x76, 0x12, 0x0A, 0xF2, 0x7D, 0x0E, 0xD8, 0xDF, 0x76, 0xF7, 0x93,
+    0xA0, 0x72, 0x02, 0x44, 0x16, 0x0E, 0x43, 0xA1, 0x0F, 0xF3, 0xC4, 0x36, 0x01, 0x40, 0xB3, 0x1C,
+    0x0B, 0xDE, 0x8B, 0xCF, 0x4A, 0xC0, 0x46, 0x38, 0x59, 0xE1, 0xB3, 0x85, 0xE9, 0x3E, 0xB7, 0x72,
+    0x51, 0xF7, 0x46, 0x97, 0x87, 0x4D, 0xB4, 0x5E, 0x0F, 0xFD, 0x27, 0x74, 0xDF, 0x2A, 0xF8, 0x1E,
+    0xB1, 0x54, 0x3C, 0x17, 0xD5, 0xD4, 0x44, 0x1B, 0xF4, 0x73, 0xBC, 0xC1, 0xD4, 0x93, 0xEF, 0x90,
+    0x24, 0x1F, 0x27, 0xC9, 0x58, 0x91, 0xE4, 0x5C, 0x90, 0x7F, 0xC6, 0x11, 0xC5, 0x52, 0xB1, 0x83,
+    0x9A, 0x9A, 0x08, 0xE8, 0xA1, 0x9F, 0x81, 0x6F, 0x15, 0x1C, 0x81, 0x13, 0xD1, 0x40, 0x2F, 0x4A,
+    0xA1, 0x11, 0x40, 0xC5, 0x6E, 0x73, 0x80, 0xBD, 0x0D, 0x27, 0xA1, 0x4C, 0xEF, 0x13, 0x7C, 0x77,
+    0x0D, 0xBC, 0x04, 0x2D, 0x6D, 0x22, 0xD9, 0x93, 0x64, 0x4B, 0x92, 0x35, 0xF9, 0x1E, 0x71, 0x2E,
+    0xD4, 0x04, 0xBE, 0x7B, 0x77, 0xF0, 0x9D, 0x9A, 0x6B, 0xAF, 0xA8, 0x69, 0xA7, 0x1D, 0x01, 0xAD,
+    0x79, 0xCC, 0x33, 0xD2, 0x7F, 0x5E, 0xF4, 0x1B, 0x47, 0x3C, 0xD4, 0xB4, 0xE4, 0x24, 0x5D, 0x91,
+    0x24, 0xF9, 0x0E, 0x79, 0x9B, 0xBC, 0xC4, 0x0F, 0xD0, 0x52, 0x96, 0x74, 0x7A, 0xC0, 0x5E, 0xA7,
+    0x43, 0xC9, 0x4B, 0x04, 0x6A, 0x0A, 0x33, 0xFB, 0x45, 0xA3, 0x71, 0xFA, 0xC5, 0xB5, 0x5E, 0x7E,
+    0x51, 0xF0, 0xC8, 0x2D, 0xF4, 0x33, 0xE9, 0xFA, 0x9B, 0x59, 0xD5, 0x11, 0x7A, 0xDE, 0x66, 0xEC,
+    0x09, 0x93, 0xFA, 0x88, 0x26, 0xF5, 0x01, 0x3A, 0xF5, 0xCB, 0x2E, 0x98, 0xBF, 0x52, 0x70, 0x82,
+    0x13, 0x2C, 0x32, 0xDB, 0x5C, 0x9D, 0x10, 0x2B, 0xC4, 0x55, 0xBC, 0x30, 0x02, 0x15, 0xD3, 0xAB,
+    0x22, 0x0E, 0x9D, 0x51, 0xD3, 0xA1, 0x94, 0x11, 0xDD, 0x3B, 0x7A, 0x40, 0xA7, 0xD6, 0xF7, 0x0B,
+    0x50, 0xF2, 0x52, 0x68, 0x23, 0x80, 0xFE, 0x3A, 0x7F, 0xC4, 0xCD, 0x66, 0x73, 0x4E, 0xE8, 0x77,
+    0x92, 0xE7, 0xF2, 0xF1, 0x9D, 0x7C, 0x5C, 0x8C, 0x1C, 0x13, 0xBE, 0xCD, 0xBF, 0xDD, 0x6C, 0x36,
+    0x9B, 0x63, 0x4D, 0x5B, 0x1B, 0xD7, 0x09, 0x76, 0xC8, 0xB3, 0xD3, 0x9A, 0x40, 0x00, 0x95, 0x7C,
+    0x03, 0xCE, 0x39, 0xA0, 0xE7, 0x95, 0xA7, 0xE9, 0x4F, 0xC8, 0x40, 0xFA, 0x3C, 0xB9, 0x2B, 0x0A,
+    0x17, 0x9B, 0x95, 0x43, 0x00, 0xF6, 0x44, 0x5D, 0x85, 0x47, 0x6E, 0xE7, 0xC9, 0x42, 0x86, 0x99,
+    0x88, 0x79, 0xE9, 0x01, 0x1B, 0x6B, 0xBE, 0x11, 0x75, 0x42, 0x13, 0xCC, 0x9B, 0x74, 0xE0, 0xFB,
+    0xC1, 0x04, 0xD4, 0xC9, 0xDC, 0xE1, 0xD5, 0x2D, 0xAF, 0xCB, 0xD7, 0xCA, 0xCC, 0xEA, 0xA5, 0x30,
+    0xAB, 0xEE, 0x43, 0xBA, 0x52, 0x9E, 0xAB, 0x1A, 0xA9, 0x54, 0x06, 0xD4, 0x03, 0x2A, 0x8A, 0x56,
+    0x43, 0xA4, 0x37, 0xBD, 0x0C, 0x71, 0x11, 0x89, 0xE2, 0xD4, 0x01, 0xFE, 0x5F, 0x57, 0xFD, 0x36,
+    0x57, 0x7F, 0xF5, 0xA9, 0xEA, 0xCF, 0x53, 0xF7, 0x6E, 0x5D, 0xDD, 0xAD, 0xA2, 0xEB, 0xB2, 0xDA,
+    0xFC, 0x82, 0x0C, 0x5F, 0xA8, 0xDD, 0xDE, 0x90, 0x76, 0x6B, 0x7F, 0x95, 0xED, 0x66, 0x27, 0x00,
+    0xA8, 0xA5, 0x92, 0xEC, 0xF8, 0xF9, 0x17, 0xC5, 0x59, 0xC0, 0x92, 0x3D, 0x79, 0x99, 0xFC, 0x84,
+    0x0C, 0x35, 0x67, 0x58, 0x8F, 0x36, 0xA0, 0x26, 0x4A, 0xBA, 0x2F, 0x71, 0xD1, 0xA7, 0x82, 0x5C,
+    0xB8, 0x3E, 0x6D, 0x3E, 0xD9, 0x7D, 0x9A, 0x25, 0x2F, 0x0C, 0xA0, 0x6B, 0xE7, 0xBC, 0x4A, 0x3E,
+    0xBD, 0x4A, 0x89, 0x76, 0xC2, 0xAE, 0xDD, 0x5D, 0x85, 0xFD, 0x00, 0xF7, 0xFD, 0x15, 0x74, 0xD0,
+    0x11, 0xB0, 0x93, 0x26, 0xC0, 0x11, 0x6D, 0x44, 0xBF, 0x40, 0xC7, 0x55, 0xEA, 0xC5, 0x11, 0xF4,
+    0xD0, 0x84, 0x8E, 0x68, 0x22, 0xD0, 0xCF, 0xE0, 0xA8, 0xE8, 0x50, 0xD2, 0xE9, 0x08, 0xE1, 0x77,
+    0xC0, 0xB1, 0x89, 0x00, 0xFA, 0x59, 0x47, 0x45, 0x07, 0x94, 0x74, 0x1C, 0xAD, 0xF0, 0x5F, 0xCF,
+    0xA4, 0xAC, 0xF0, 0x5E, 0x89, 0x94, 0x2C, 0x28, 0xC5, 0x2A, 0x55, 0x3C, 0x29, 0xD4, 0x2C, 0xF8,
+    0x09, 0xFF, 0x8B, 0x30, 0xEA, 0x51, 0x47, 0xCD, 0x0E, 0xA8, 0x39, 0x70, 0xEC, 0x03, 0x00, 0x7A,
+    0x1D, 0x15, 0x27, 0xC0, 0x44, 0x70, 0xD4, 0xEC, 0x50, 0xD3, 0xE9, 0x08, 0x1B, 0x00, 0x7A, 0x70,
+    0x54, 0x9C, 0x60, 0x12, 0x74, 0x84, 0xD0, 0xDE, 0xE0, 0x08, 0x1B, 0xC0, 0x59, 0x0A, 0x34, 0xB6,
+    0x09, 0xE0, 0x88, 0x86, 0xD5, 0x5A, 0xEC, 0x00, 0x18, 0x5F, 0x09, 0x5D, 0x1C, 0x4A, 0x76, 0x00,
+    0x0A, 0xBE, 0x91, 0x85, 0xDD, 0xB9, 0x1E, 0xF3, 0x82, 0x0D, 0xB4, 0x3C, 0x94, 0x5A, 0x7B, 0xE8,
+    0x64, 0x15, 0x9E, 0x3A, 0x8B, 0xBD, 0xB3, 0xD8, 0x3B, 0x5B, 0xB1, 0xAB, 0x08, 0x4D, 0x58, 0x5F,
+    0xD0, 0x55, 0x84, 0x4E, 0xE8, 0xBD, 0xE2, 0x50, 0x70, 0x6C, 0x82, 0xA2, 0x43, 0x1B, 0x2A, 0x16,
+    0x59, 0xA1, 0xE4, 0x38, 0x02, 0xFD, 0xDC, 0x7B, 0x19, 0x50, 0x36, 0x59, 0x9F, 0x05, 0x92, 0xB3,
+    0xF4, 0x7B, 0x06, 0x48, 0x8F, 0x14, 0x46, 0xC1, 0x26, 0xCE, 0x40, 0xCD, 0xC7, 0xA9, 0x09, 0x54,
+    0x7C, 0x83, 0x6F, 0xD0, 0x43, 0xD1, 0xF5, 0xBE, 0x4D, 0x28, 0xF3, 0x2B, 0x0A, 0xFA, 0x8A, 0xE8,
+    0x03, 0xE8, 0x0B, 0xBA, 0x9A, 0x03, 0x17, 0xF4, 0x1E, 0x9C, 0xFB, 0x80, 0x26, 0xA0, 0x21, 0x7A,
+    0x8F, 0x82, 0x93, 0x48, 0x5A, 0xAD, 0x87, 0x66, 0x67, 0x3D, 0xDA, 0x08, 0xEB, 0xD1, 0x2F, 0xB0,
+    0x5E, 0x74, 0x72, 0x8A, 0x0E, 0xD6, 0x6B, 0x02, 0xD6, 0xB7, 0x11, 0xB0, 0xBE, 0x9F, 0x01, 0xEB,
+    0x39, 0x01, 0xF6, 0x3A, 0x07, 0xC0, 0xDE, 0xA1, 0x4C, 0x00, 0xA9, 0x83, 0x25, 0xB9, 0xE4, 0xC9,
+    0x40, 0x84, 0xD2, 0xF6, 0x56, 0x21, 0xB2, 0xE1, 0x92, 0xB3, 0xF5, 0x80, 0x0D, 0xD6, 0x03, 0x26,
+    0x58, 0xBF, 0x52, 0x28, 0x3A, 0x7D, 0x56, 0x08, 0x00, 0x42, 0x52, 0xC8, 0x80, 0xED, 0xA5, 0x5F,
+    0xCC, 0x40, 0x3A, 0xCA, 0xEA, 0xBE, 0x11, 0x82, 0x27, 0x80, 0x4C, 0x9A, 0x32, 0x97, 0x16, 0x67,
+    0x21, 0x62, 0xFC, 0x27, 0x13, 0x6A, 0x5E, 0xE0, 0x50, 0xD1, 0x71, 0xAA, 0xE8, 0xCC, 0xA2, 0xE8,
+    0x74, 0x52, 0x1C, 0x15, 0xCF, 0x73, 0x04, 0xFF, 0x9E, 0x23, 0xCC, 0x6D, 0x8E, 0xD0, 0xAB, 0xC8,
+    0x51, 0xA8, 0xB7, 0xC1, 0x90, 0x5C, 0x74, 0xE6, 0x8B, 0x2A, 0x7A, 0x4E, 0x30, 0xD1, 0x2C, 0x50,
+    0x7C, 0x21, 0x01, 0xBC, 0xCE, 0x01, 0x6D, 0xE0, 0x84, 0x8A, 0x02, 0x9D, 0x59, 0x49, 0x55, 0xB3,
+    0xAC, 0xDF, 0xDC, 0x10, 0xF8, 0x9F, 0x2D, 0x07, 0x34, 0xA4, 0x43, 0x45, 0x8E, 0x28, 0x48, 0x07,
+    0xB4, 0x99, 0xE6, 0xCC, 0x44, 0x7C, 0x27, 0x7D, 0x3E, 0xE5, 0xB6, 0x5E, 0x72, 0xDB, 0x4F, 0x79,
+    0x74, 0x0C, 0x80, 0x8E, 0x52, 0x17, 0x46, 0x48, 0xEC, 0x22, 0x53, 0xDC, 0x55, 0x9E, 0xCE, 0x32,
+    0xC9, 0x0D, 0x4E, 0x3B, 0xE1, 0x1C, 0x27, 0xE4, 0x81, 0x0B, 0x18, 0x51, 0xEE, 0x15, 0x59, 0x8A,
+    0x96, 0xF5, 0x0D, 0xAB, 0xC2, 0x01, 0x9C, 0xA0, 0x93, 0x10, 0xC2, 0x66, 0x91, 0x4F, 0xCF, 0xE4,
+    0xBC, 0xE2, 0xB0, 0x6A, 0x08, 0xF7, 0xFA, 0x08, 0x18, 0xF2, 0x9C, 0xD4, 0x7A, 0xB4, 0x1C, 0xA0,
+    0xC8, 0x8F, 0x19, 0x00, 0x4D, 0x5E, 0xE4, 0x00, 0x18, 0xA6, 0xE2, 0x40, 0xA0, 0x00, 0x77, 0x71,
+    0x16, 0x77, 0x4B, 0xAC, 0x33, 0x5D, 0xB8, 0xD2, 0x62, 0xAB, 0x28, 0x49, 0xA4, 0xA1, 0x7B, 0x9B,
+    0xCD, 0xA6, 0x93, 0xE9, 0xA1, 0x43, 0x21, 0xEB, 0x60, 0x25, 0xE3, 0xA0, 0x4D, 0xAF, 0x72, 0x04,
+    0xEC, 0x58, 0xB1, 0x43, 0xC9, 0xAE, 0x89, 0x80, 0x8E, 0xE8, 0x67, 0xC0, 0xF8, 0x82, 0x23, 0x40,
+    0x57, 0xB1, 0x83, 0x22, 0x9A, 0x08, 0x34, 0x01, 0xFD, 0x0C, 0xD8, 0xA9, 0xE0, 0x08, 0xC5, 0xAE,
+    0x62, 0x07, 0x1D, 0xD0, 0x44, 0xC0, 0x7A, 0xF4, 0x33, 0xFE, 0x82, 0x43, 0xC1, 0x51, 0x09, 0xC6,
+    0xE3, 0x1A, 0x3D, 0x1A, 0xB2, 0x27, 0xD0, 0x33, 0x64, 0x69, 0xDB, 0x43, 0x00, 0x20, 0x53, 0xAB,
+    0xCC, 0x0A, 0x68, 0xFD, 0x89, 0x72, 0x65, 0xDA, 0xBB, 0x5D, 0x4E, 0xF0, 0x0F, 0xC5, 0x06, 0xBD,
+    0xCF, 0x32, 0x95, 0x5F, 0x48, 0x89, 0x7F, 0x2A, 0x7A, 0xB3, 0x79, 0x5A, 0x16, 0xEB, 0x68, 0x49,
+    0xF2, 0x13, 0x32, 0x83, 0x4C, 0xC8, 0x73, 0x71, 0xB3, 0x39, 0x17, 0xBF, 0x38, 0x95, 0x7F, 0xDF,
+    0xE8, 0x6E, 0xB7, 0x18, 0xD3, 0x67, 0xC9, 0x3E, 0xD0, 0x47, 0x94, 0xB7, 0x8F, 0x32, 0x9F, 0xDC,
+    0xA1, 0x25, 0x67, 0xC0, 0xE6, 0xFA, 0x9F, 0x00, 0xEC, 0x1D, 0xE4, 0xB1, 0x64, 0x16, 0xD4, 0xFC,
+    0x05, 0x41, 0xDA, 0x1E, 0xF1, 0x1E, 0x49, 0xA8, 0xC4, 0x7D, 0x81, 0x7B, 0x45, 0xDF, 0x05, 0xBD,
+    0x0B, 0x9A, 0x84, 0x07, 0xD0, 0x47, 0xE8, 0x0F, 0x19, 0xA0, 0xC9, 0x59, 0x06, 0xA9, 0x26, 0x07,
+    0xEC, 0xAF, 0xCA, 0x9F, 0xAC, 0x1C, 0xFE, 0x25, 0x68, 0xFF, 0x7E, 0x85, 0x1A, 0xC7, 0x55, 0x05,
+    0x1A, 0xEC, 0x5D, 0xFA, 0xD1, 0xE7, 0x25, 0x31, 0xB3, 0x9E, 0xFE, 0x24, 0x31, 0x94, 0x09, 0xF4,
+    0xCC, 0x9E, 0xAE, 0xCC, 0x70, 0x26, 0xC7, 0x04, 0x58, 0x87, 0x36, 0x48, 0xC3, 0xAC, 0x8A, 0x43,
+    0xA9, 0xC1, 0x5F, 0x7C, 0x91, 0xB6, 0x47, 0x5C, 0x57, 0x5E, 0x93, 0xA9, 0x22, 0xB9, 0xC8, 0x29,
+    0x9F, 0xFB, 0x00, 0x06, 0xD1, 0x0E, 0x5F, 0x38, 0x79, 0x31, 0x00, 0x40, 0x93, 0xF1, 0x7E, 0x27,
+    0x8A, 0x93, 0x07, 0x89, 0x50, 0x44, 0x22, 0x62, 0xC8, 0xD4, 0xDD, 0xDE, 0x59, 0x7C, 0xCD, 0xEE,
+    0x7C, 0x2E, 0x02, 0x4D, 0xB4, 0x01, 0x05, 0x6F, 0x30, 0xFD, 0xC1, 0xFD, 0x98, 0xD6, 0x52, 0x98,
+    0xD6, 0x53, 0xB9, 0xF3, 0xDF, 0xCB, 0x9D, 0x6A, 0x11, 0xB0, 0x32, 0xAE, 0xF4, 0x91, 0xE2, 0x89,
+    0xE8, 0x65, 0x27, 0xC5, 0x14, 0xA2, 0x51, 0x9A, 0xE4, 0xD3, 0xD1, 0x11, 0x10, 0x16, 0xD7, 0x0B,
+    0x3E, 0xE3, 0x73, 0x02, 0x9B, 0x83, 0x26, 0xF5, 0xF1, 0x0F, 0x98, 0x0C, 0xC9, 0xD4, 0x90, 0x4C,
+    0x15, 0xF9, 0x42, 0xC2, 0xB3, 0x2F, 0xE9, 0xB4, 0xBE, 0x48, 0x27, 0x40, 0xF3, 0x3E, 0x41, 0xC0,
+    0x2F, 0x0A, 0xF6, 0xCE, 0x8A, 0x58, 0xB4, 0xA5, 0x83, 0x95, 0x12, 0x3A, 0x58, 0x3A, 0x11, 0xE8,
+    0x5A, 0x3A, 0x11, 0xA2, 0x5A, 0x59, 0x3B, 0x1D, 0x2C, 0x27, 0x59, 0x99, 0xEC, 0x35, 0x0F, 0x95,
+    0xE8, 0x60, 0x2F, 0xCF, 0x50, 0x91, 0x0E, 0xF6, 0xF2, 0x82, 0x2A, 0xD0, 0xC1, 0xBE, 0x17, 0xA0,
+    0x17, 0x3A, 0xD8, 0x77, 0x23, 0xF4, 0x4C, 0x07, 0xFB, 0x4E, 0x42, 0xE3, 0xE9, 0x60, 0xDF, 0x21,
+    0xCC, 0xDF, 0xD1, 0xC1, 0xBE, 0x4D, 0x98, 0xB7, 0xE9, 0x60, 0x47, 0x0E, 0xFD, 0x1B, 0x72, 0xE2,
+    0xEC, 0x73, 0x74, 0xB0, 0xA3, 0x75, 0x7C, 0x94, 0x0E, 0x76, 0x34, 0x6F, 0xB3, 0x90, 0x93, 0x8F,
+    0x93, 0x9C, 0xB4, 0xD7, 0xA3, 0x9C, 0x34, 0x0C, 0x72, 0xA2, 0xB9, 0xC8, 0x49, 0xCD, 0xB9, 0x20,
+    0x83, 0x1D, 0x2B, 0xFA, 0x82, 0x5C, 0xEC, 0xA8, 0x38, 0x15, 0xE4, 0x6C, 0x47, 0xC5, 0xB1, 0x20,
+    0xBD, 0x1D, 0x0B, 0xBA, 0xAC, 0x1C, 0x01, 0x00, 0x33, 0xAD, 0x48, 0xCD, 0x55, 0xCB, 0xBB, 0x72,
+    0x13, 0xEB, 0x20, 0x5A, 0x79, 0x80, 0x75, 0x4A, 0x3C, 0xB1, 0x16, 0x41, 0x13, 0xA7, 0x36, 0x1D,
+    0x8A, 0xCD, 0x59, 0x68, 0x7A, 0x14, 0x4C, 0x50, 0x4C, 0x22, 0x6D, 0x16, 0x71, 0xD5, 0x04, 0xC3,
+    0x19, 0x0D, 0x17, 0x68, 0x26, 0x68, 0x26, 0x28, 0x5A, 0xA7, 0x12, 0x07, 0xF0, 0xD2, 0x5C, 0xB0,
+    0x9F, 0x60, 0xAE, 0x13, 0xFC, 0xD1, 0x02, 0x1D, 0x7A, 0x67, 0xDE, 0x4A, 0x50, 0xD4, 0x4B, 0xFB,
+    0x11, 0x07, 0xF0, 0x4D, 0xEA, 0xB9, 0x9F, 0x60, 0x7C, 0xFF, 0x56, 0x68, 0x16, 0xE8, 0xA0, 0x6F,
+    0xA7, 0x2A, 0x41, 0xB1, 0x24, 0x1F, 0xE5, 0x00, 0xBA, 0x9E, 0xAE, 0x9F, 0x60, 0xBC, 0xE6, 0xD4,
+    0x2C, 0xD0, 0xA1, 0xA4, 0xAF, 0xC8, 0x0B, 0x84, 0x09, 0x05, 0xE9, 0xE9, 0x74, 0x42, 0xCF, 0xC5,
+    0xF8, 0x82, 0x68, 0x18, 0x57, 0x32, 0xE2, 0x9E, 0xA2, 0xAE, 0x95, 0xD0, 0xE4, 0x95, 0x78, 0x15,
+    0xEE, 0xA9, 0x1D, 0x87, 0x35, 0xEC, 0x34, 0xE0, 0xBF, 0x6A, 0x1E, 0x85, 0x4E, 0x07, 0x40, 0x87,
+    0x82, 0x03, 0xD0, 0xDF, 0xE8, 0xFD, 0x4E, 0xCF, 0x9C, 0xE7, 0x8D, 0x47, 0xD6, 0x8F, 0x39, 0xFE,
+    0x95, 0xCC, 0x70, 0x58, 0xB7, 0x93, 0x83, 0x8B, 0x5E, 0x22, 0x8B, 0xC3, 0x0B, 0x1E, 0xCD, 0x00,
+    0xCC, 0x0D, 0x0E, 0x80, 0xA2, 0x0E, 0x00, 0xAC, 0xE7, 0xB8, 0x83, 0x4D, 0x71, 0xEC, 0x3D, 0xD0,
+    0x06, 0xC5, 0x0E, 0x8A, 0x43, 0x1B, 0x80, 0x7E, 0x2E, 0xE8, 0x32, 0xDE, 0x05, 0xF4, 0x90, 0x25,
+    0x9F, 0x79, 0xCA, 0x5F, 0x64, 0x26, 0x74, 0x95, 0x4C, 0xF8, 0x36, 0x6D, 0x5F, 0xE5, 0x24, 0x58,
+    0xE8, 0x82, 0x13, 0x60, 0x67, 0x13, 0x05, 0x85, 0xEB, 0x00, 0x13, 0x84, 0xE5, 0xBE, 0xCC, 0x0E,
+    0x68, 0x08, 0x0E, 0xAD, 0x57, 0x04, 0x5D, 0x9D, 0xEA, 0x24, 0xE8, 0xAC, 0x86, 0xEC, 0x50, 0x73,
+    0x3A, 0xA1, 0x22, 0xDE, 0xB7, 0x2F, 0xA1, 0x22, 0x23, 0x0C, 0x19, 0x61, 0xC9, 0x50, 0xA4, 0xA7,
+    0x38, 0x97, 0x5D, 0x91, 0xE1, 0xCE, 0x80, 0x26, 0xF6, 0xB6, 0x0C, 0xFB, 0x24, 0xBD, 0x25, 0x79,
+    0x91, 0xE9, 0x88, 0x26, 0xC2, 0x44, 0x4E, 0xE0, 0x4D, 0x76, 0x8A, 0x97, 0x23, 0x1A, 0xF6, 0xA1,
+    0x60, 0xA0, 0xC0, 0x4F, 0x13, 0x2F, 0x90, 0x3F, 0x65, 0xC9, 0x58, 0x05, 0x6C, 0x4E, 0x54, 0xA2,
+    0x19, 0x8C, 0x03, 0xEA, 0x58, 0x47, 0x00, 0x76, 0xB4, 0x13, 0x50, 0x85, 0x2A, 0x02, 0x78, 0x18,
+    0x0F, 0x77, 0xF7, 0x56, 0x79, 0x9B, 0x31, 0x73, 0x42, 0x67, 0x73, 0x44, 0x9E, 0x6F, 0x00, 0x19,
+    0x5B, 0xCD, 0x6D, 0x76, 0x80, 0xE2, 0x33, 0x0B, 0x00, 0xE3, 0x05, 0x74, 0xAA, 0x23, 0x00, 0x4E,
+    0xD6, 0x03, 0x3A, 0x56, 0x04, 0x4A, 0x3A, 0x33, 0x03, 0x66, 0x29, 0xE9, 0x50, 0xB1, 0x6B, 0x02,
+    0x32, 0xDC, 0x48, 0x30, 0xE7, 0xC5, 0x89, 0x65, 0x75, 0xC8, 0x42, 0xDF, 0x3E, 0x23, 0x4B, 0xAE,
+    0x6E, 0x6D, 0x02, 0xFD, 0xAA, 0x4C, 0xAB, 0x05, 0xE6, 0xDC, 0x2F, 0xA2, 0x79, 0x7E, 0x8B, 0x03,
+    0xD0, 0x46, 0xCE, 0xAB, 0x3A, 0x1C, 0x28, 0x43, 0x19, 0xD1, 0x2C, 0x3A, 0xA0, 0xF7, 0xBD, 0x07,
+    0x3B, 0x0E, 0x78, 0x09, 0x2F, 0x9D, 0x28, 0xD4, 0x3F, 0x62, 0x95, 0x67, 0xBA, 0x61, 0xA5, 0x18,
+    0x32, 0x7A, 0x61, 0xCC, 0xBC, 0x6E, 0xCC, 0x88, 0x12, 0x8E, 0x28, 0xF8, 0x66, 0xE6, 0x29, 0x17,
+    0x59, 0xEB, 0x85, 0x11, 0x04, 0x60, 0x27, 0x89, 0xD0, 0x51, 0x22, 0x4A, 0xBA, 0xCC, 0xFC, 0xCC,
+    0x05, 0xC9, 0x80, 0x9A, 0x68, 0x48, 0x3A, 0x70, 0x92, 0x88, 0x46, 0x04, 0xFE, 0x4E, 0xD1, 0x95,
+    0xBC, 0xB2, 0x39, 0x8B, 0x3E, 0x33, 0x8B, 0xF5, 0xCA, 0x60, 0xAF, 0xCC, 0x74, 0x9B, 0x23, 0x14,
+    0xAF, 0x0A, 0xA0, 0xC5, 0x7A, 0x59, 0x89, 0x75, 0x02, 0x9A, 0xB4, 0xDD, 0xFE, 0x99, 0xB0, 0x27,
+    0x8C, 0xA2, 0xFF, 0x22, 0xDF, 0x5D, 0x49, 0x70, 0x7A, 0x89, 0x18, 0xB1, 0xCF, 0xC3, 0xC2, 0xBE,
+    0x84, 0x92, 0x8C, 0x0D, 0x89, 0x8A, 0xA4, 0x25, 0x47, 0x95, 0x55, 0x2D, 0x45, 0x7A, 0x8A, 0x1C,
+    0xFB, 0x05, 0x1D, 0xFA, 0x24, 0x84, 0x8C, 0x09, 0x22, 0x68, 0x37, 0x01, 0x75, 0xC2, 0xDE, 0x96,
+    0x69, 0x7B, 0x24, 0xE0, 0x08, 0x91, 0xEB, 0x52, 0x84, 0xBC, 0x57, 0x2D, 0x49, 0x9A, 0x28, 0xAB,
+    0x6B, 0xBF, 0xE4, 0xE3, 0x2C, 0x0C, 0x5F, 0x3F, 0xC3, 0x26, 0x08, 0x1E, 0x94, 0x43, 0xF1, 0xE3,
+    0x2C, 0xBF, 0x5A, 0x5A, 0x99, 0x6F, 0x96, 0x9A, 0x1C, 0x5B, 0x72, 0x29, 0x98, 0xB0, 0x4F, 0x1E,
+    0x62, 0xAF, 0x13, 0xB2, 0x15, 0x40, 0x3F, 0x56, 0xD1, 0xF8, 0x3A, 0xB4, 0xB7, 0xCE, 0x05, 0x4D,
+    0xCE, 0x8A, 0x1C, 0x71, 0xEE, 0xD6, 0xAE, 0x87, 0xF4, 0x64, 0xB2, 0x52, 0x8E, 0xF5, 0x3F, 0x59,
+    0x51, 0x58, 0xDC, 0xFD, 0x2F, 0x54, 0x71, 0xB8, 0xEB, 0xFF, 0xC6, 0xE6, 0xEC, 0x7D, 0xF3, 0x7A,
+    0xC0, 0xDE, 0xDE, 0x6E, 0xEF, 0x79, 0x2E, 0x0B, 0x0E, 0xC6, 0x83, 0xCE, 0x78, 0x70, 0xB2, 0x13,
+    0xFA, 0xAC, 0x95, 0x02, 0x2A, 0x2E, 0x00, 0xF6, 0x8E, 0x25, 0x82, 0x87, 0x40, 0xCB, 0x24, 0xD8,
+    0x78, 0x45, 0xD2, 0x6B, 0xFE, 0x99, 0x5D, 0x9A, 0x84, 0x26, 0xB4, 0x01, 0x3A, 0x8A, 0x78, 0x32,
+    0x6D, 0x8F, 0x84, 0x86, 0x38, 0x11, 0x1C, 0x43, 0xEE, 0xC3, 0x2A, 0xDA, 0xD2, 0x1C, 0x8A, 0x1F,
+    0x57, 0x24, 0x97, 0x92, 0xE4, 0x82, 0x9E, 0x9C, 0x51, 0x93, 0x87, 0x27, 0x25, 0x91, 0x85, 0xE5,
+    0x2D, 0xC1, 0x4B, 0x45, 0x19, 0xA5, 0x02, 0x7B, 0xA1, 0x2F, 0x99, 0xB6, 0xA4, 0x6B, 0x3F, 0x00,
+    0x6C, 0x2C, 0x47, 0x81, 0x7A, 0xAC, 0xC8, 0x94, 0x95, 0x31, 0xCF, 0xA0, 0xAC, 0x36, 0x6C, 0x36,
+    0x9B, 0xCD, 0x53, 0x02, 0xE2, 0xC8, 0x00, 0x8E, 0x7B, 0x2F, 0x36, 0x9B, 0x4D, 0x1F, 0xAD, 0x17,
+    0xB4, 0x3A, 0x00, 0x13, 0xCC, 0x0C, 0x54, 0xFC, 0x3E, 0x5D, 0x56, 0xB1, 0xA3, 0x4F, 0xB0, 0xFC,
+    0xA1, 0xCD, 0x30, 0xC6, 0x19, 0x5A, 0x46, 0x50, 0xCB, 0xAC, 0x0B, 0x4D, 0xDD, 0x4E, 0xAA, 0xFB,
+    0xC7, 0xA9, 0x43, 0x4D, 0x2E, 0xD0, 0x24, 0x3B, 0x4D, 0x72, 0xD4, 0x57, 0x9E, 0xA6, 0xFF, 0xAF,
+    0x4E, 0xDA, 0x12, 0x08, 0x84, 0x36, 0x9E, 0xDE, 0x6E, 0x8F, 0x52, 0x4F, 0xF2, 0x44, 0x60, 0x3C,
+    0x9A, 0x68, 0x3C, 0xDA, 0x60, 0x16, 0x98, 0xD0, 0x44, 0xD8, 0x59, 0xF3, 0x43, 0x7A, 0x25, 0x03,
+    0x8D, 0x04, 0x5A, 0xCE, 0xC0, 0xC9, 0xA9, 0xD5, 0x76, 0x7D, 0x07, 0xE8, 0xA0, 0x03, 0x00, 0x3A,
+    0x3A, 0x40, 0x2F, 0x3A, 0x00, 0xF8, 0x4D, 0x9C, 0xBE, 0x77, 0x62, 0x7D, 0x84, 0x3C, 0x94, 0x6F,
+    0x1F, 0x65, 0xC1, 0x19, 0x32, 0xA2, 0xA9, 0xE5, 0xD5, 0x23, 0x86, 0x32, 0x75, 0xA8, 0x39, 0xFE,
+    0xF6, 0x4E, 0xC7, 0x9E, 0xA9, 0xFB, 0x5C, 0xA3, 0xAB, 0xA0, 0xF2, 0x6F, 0x36, 0x27, 0x64, 0xBA,
+    0xF7, 0xAD, 0xDE, 0x1B, 0x9B, 0xCD, 0xB7, 0xF9, 0x1E, 0x01, 0xB4, 0x41, 0x16, 0xD9, 0x0B, 0xEC,
+    0x80, 0x7E, 0x69, 0x83, 0xAC, 0x62, 0x1E, 0x15, 0xA7, 0x9A, 0xB7, 0x9E, 0x66, 0x58, 0xA5, 0x6D,
+    0x32, 0x23, 0x09, 0x70, 0x08, 0x65, 0x16, 0xD8, 0x6E, 0x76, 0x6B, 0x43, 0x02, 0x51, 0xF2, 0x31,
+    0x76, 0x25, 0x1F, 0xE3, 0x50, 0xB0, 0x60, 0x87, 0xEF, 0xE0, 0x8F, 0x4E, 0x96, 0xEE, 0x9F, 0xA4,
+    0xFE, 0x01, 0xA0, 0x5A, 0xD4, 0xB2, 0x12, 0x18, 0x99, 0xD4, 0xD3, 0x21, 0x2B, 0xF5, 0x60, 0x9D,
+    0xCD, 0x60, 0xBF, 0x17, 0x8B, 0x17, 0xEF, 0x2F, 0xED, 0x6C, 0x02, 0xC0, 0x11, 0x75, 0x02, 0x3D,
+    0x74, 0x44, 0xC9, 0xB1, 0xE2, 0x00, 0x31, 0x88, 0x6A, 0x43, 0x16, 0x1C, 0x8A, 0x2C, 0xB1, 0xE0,
+    0x88, 0x8A, 0x9D, 0x8E, 0x19, 0xC2, 0x08, 0x01, 0x7D, 0x80, 0x5E, 0xC7, 0x42, 0x44, 0xF4, 0x1D,
+    0xC7, 0x6C, 0xB6, 0xA2, 0xA3, 0x08, 0x3C, 0x78, 0x85, 0x57, 0xB2, 0x0A, 0x6C, 0x45, 0x69, 0x9A,
+    0x55, 0xFF, 0xAC, 0x56, 0xE1, 0xDE, 0x31, 0x70, 0xB3, 0xE1, 0xB9, 0x74, 0x4E, 0x94, 0xFF, 0x23,
+    0x47, 0xCE, 0x00, 0xEC, 0xA2, 0x63, 0x95, 0xD7, 0x28, 0x8E, 0x26, 0x01, 0x8A, 0xA3, 0x8E, 0xE0,
+    0x0C, 0xD8, 0x00, 0x8E, 0x35, 0x5D, 0x16, 0xC7, 0x9A, 0x04, 0xC5, 0x29, 0x4B, 0x68, 0xFB, 0x00,
+    0x1D, 0x33, 0xF0, 0x00, 0x1C, 0x61, 0x62, 0xC9, 0x09, 0x3A, 0xA2, 0xA0, 0xEF, 0x73, 0xB1, 0x77,
+    0x20, 0x4A, 0x59, 0x47, 0x33, 0x67, 0x36, 0xAC, 0x2A, 0x46, 0x91, 0xBC, 0xEB, 0x59, 0x4B, 0x1D,
+    0xDF, 0xBD, 0xAA, 0xFE, 0xCB, 0x94, 0x76, 0x4A, 0x7F, 0x48, 0x10, 0x72, 0xBB, 0x53, 0x3C, 0xC3,
+    0xAE, 0x64, 0x41, 0xE0, 0x3B, 0xF8, 0xCE, 0xBD, 0xEA, 0x98, 0x7F, 0x0E, 0x56, 0x4D, 0x59, 0x6B,
+    0x55, 0xC6, 0x22, 0x82, 0x8E, 0xCE, 0x78, 0xE3, 0xF5, 0xA2, 0x03, 0x5E, 0xC2, 0xCB, 0xC7, 0x5F,
+    0xFB, 0xAB, 0xB3, 0x67, 0x3A, 0x2B, 0x1D, 0x76, 0x36, 0xAB, 0xCE, 0x68, 0xD9, 0x5D, 0x7A, 0x40,
+    0x73, 0xC8, 0x88, 0x46, 0x2E, 0x80, 0x12, 0xD0, 0xD0, 0x2E, 0x2A, 0x75, 0x00, 0xF3, 0x02, 0x36,
+    0x8A, 0x55, 0xC6, 0xA9, 0xA7, 0x45, 0x4D, 0x17, 0x77, 0xCB, 0xD2, 0x2E, 0x68, 0xD2, 0x21, 0x60,
+    0x62, 0x3A, 0xD8, 0x17, 0x12, 0x6B, 0x16, 0xD0, 0x09, 0xC9, 0xEE, 0xB8, 0x2E, 0x4E, 0x6D, 0x36,
+    0x9B, 0x83, 0xBB, 0xBF, 0x65, 0x31, 0x2B, 0x68, 0xD7, 0x89, 0xB8, 0x15, 0x7D, 0xC8, 0xE4, 0x61,
+    0xC5, 0x21, 0xBF, 0x46, 0xD4, 0x05, 0x9C, 0x8E, 0x3F, 0xC8, 0xC1, 0x52, 0xF2, 0xCC, 0x10, 0xB9,
+    0x7F, 0x9E, 0xA6, 0x76, 0x73, 0x55, 0x13, 0x8F, 0x9B, 0xE9, 0x03, 0x14, 0x5C, 0x78, 0xF5, 0x48,
+    0x54, 0xC3, 0xA3, 0x80, 0x9F, 0xC9, 0x80, 0x7D, 0x9B, 0x06, 0x60, 0x6F, 0xB3, 0x39, 0x00, 0x1A,
+    0x66, 0x2A, 0x69, 0x17, 0x4A, 0xFC, 0x4E, 0x44, 0xC5, 0x60, 0x3D, 0x4A, 0x0A, 0xFA, 0x39, 0x58,
+    0x8F, 0x9A, 0xC1, 0x7A, 0x68, 0x06, 0xEB, 0xD1, 0x32, 0x58, 0x0F, 0xC3, 0x60, 0x3D, 0xEC, 0xB5,
+    0x60, 0x3D, 0x78, 0x39, 0x58, 0x5F, 0xF2, 0x99, 0x60, 0xBD, 0x62, 0x13, 0xAC, 0xAF, 0x63, 0x13,
+    0xAC, 0xD7, 0xA1, 0x09, 0xD6, 0xB7, 0x73, 0x1B, 0xAC, 0x37, 0xBE, 0x0D, 0xD6, 0xDB, 0xB1, 0x0D,
+    0xD6, 0xD3, 0xB5, 0xC1, 0x7E, 0xCC, 0xAE, 0x0D, 0xF6, 0x3A, 0xD1, 0x06, 0x7B, 0x27, 0xA0, 0x0D,
+    0x96, 0x0B, 0xDA, 0x60, 0xE9, 0xD1, 0x06, 0xCB, 0x09, 0x6D, 0xB0, 0x74, 0x68, 0x83, 0xE5, 0x80,
+    0x36, 0x58, 0x02, 0x6D, 0xB0, 0x09, 0x68, 0x03, 0x36, 0x9B, 0x8D, 0x60, 0xA5, 0x8F, 0x03, 0x6C,
+    0x36, 0x9B, 0x15, 0x12, 0x82, 0x53, 0x67, 0x39, 0xC2, 0x46, 0x8E, 0x60, 0xE4, 0x58, 0x32, 0x72,
+    0x54, 0x8C, 0x1C, 0x35, 0x23, 0xC7, 0x86, 0x91, 0xA3, 0xB9, 0x16, 0x39, 0xF6, 0x97, 0x22, 0x47,
+    0xBE, 0x10, 0xF9, 0x36, 0x75, 0xE4, 0x3B, 0x51, 0x47, 0xBE, 0x17, 0x74, 0xE4, 0xE5, 0x59, 0x47,
+    0x5E, 0xF3, 0x3A, 0x92, 0xA3, 0x8E, 0xA4, 0xD3, 0x91, 0xEC, 0x74, 0x64, 0x82, 0x8E, 0x0C, 0xD0,
+    0x91, 0xCB, 0x8A, 0xC8, 0x00, 0x9A, 0x49, 0x4F, 0x80, 0xF1, 0xAD, 0x07, 0x8C, 0x37, 0x33, 0xD0,
+    0xFA, 0xD6, 0x03, 0xFB, 0xC3, 0xFE, 0xDD, 0x9C, 0xE2, 0xBF, 0x80, 0x8A, 0x05, 0x80, 0x22, 0x16,
+    0x09, 0x8A, 0x8A, 0x12, 0x94, 0x2C, 0x09, 0xBC, 0x7C, 0xD7, 0xA4, 0xF3, 0x8F, 0x5D, 0xC5, 0x77,
+    0x33, 0x87, 0x1C, 0xED, 0x08, 0x54, 0xA1, 0x0A, 0xF7, 0x67, 0x0E, 0x45, 0x43, 0x5D, 0x64, 0xA5,
+    0x2B, 0xC9, 0x51, 0x68, 0xC3, 0xAE, 0x16, 0xD5, 0x34, 0x23, 0x6A, 0xFA, 0x96, 0x40, 0x23, 0x4C,
+    0x9B, 0x5D, 0xFA, 0x00, 0x54, 0x59, 0x2F, 0x10, 0xEC, 0x2C, 0xDC, 0x32, 0x56, 0x58, 0x64, 0xC9,
+    0x6B, 0x22, 0xE0, 0x3D, 0x71, 0xD1, 0x46, 0xC9, 0xF6, 0x9E, 0xDC, 0xD3, 0x07, 0x21, 0x61, 0x46,
+    0xC0, 0x2E, 0xF2, 0xE8, 0x8E, 0x01, 0x15, 0x7D, 0xCD, 0xF4, 0xC7, 0xC2, 0xD2, 0x91, 0x43, 0x56,
+    0x95, 0x94, 0xB2, 0x7C, 0xAC, 0x24, 0xCC, 0xA9, 0x5D, 0x09, 0x9A, 0x49, 0x4F, 0xD0, 0xA1, 0x8E,
+    0x50, 0x54, 0xEC, 0x84, 0x32, 0xB8, 0xB7, 0x23, 0x15, 0xF6, 0x45, 0x88, 0xC1, 0x8B, 0x26, 0x23,
+    0x84, 0x8A, 0xE1, 0x7F, 0x61, 0xA8, 0xE8, 0x6A, 0x7E, 0x9F, 0xA3, 0x60, 0xEE, 0xDA, 0x68, 0x16,
+    0x54, 0x7C, 0x32, 0x01, 0x7C, 0x9F, 0x03, 0xCC, 0xC2, 0x49, 0x2C, 0xB3, 0x14, 0x5F, 0x20, 0x0A,
+    0xFE, 0x94, 0x0E, 0xD6, 0xF7, 0x0B, 0x4C, 0xD0, 0x1C, 0xFA, 0x28, 0x28, 0xF0, 0x86, 0x19, 0xEF,
+    0x04, 0xD4, 0x8C, 0x00, 0xF6, 0xBA, 0x93, 0xD4, 0x61, 0xCA, 0xAB, 0xDD, 0xAA, 0xF8, 0x2F, 0x57,
+    0x93, 0xA4, 0x1F, 0x9E, 0xA3, 0xD3, 0x1C, 0x60, 0x58, 0x72, 0x02, 0x38, 0x0B, 0x23, 0xFC, 0x03,
+    0x41, 0x48, 0x5A, 0x8F, 0x6C, 0x43, 0x81, 0xE6, 0x2E, 0x4A, 0x30, 0xC9, 0xC5, 0xB5, 0x7C, 0x71,
+    0x7B, 0xBB, 0xDD, 0x0A, 0x59, 0xA8, 0xA3, 0xDC, 0xF3, 0x16, 0x3B, 0xA0, 0x0D, 0xF2, 0xB4, 0xEF,
+    0x73, 0x04, 0xEC, 0xAC, 0xD9, 0xA1, 0xA5, 0xBC, 0x54, 0xF8, 0x39, 0xA1, 0xE8, 0x92, 0xAC, 0xC8,
+    0xDD, 0x8E, 0xEA, 0x16, 0xD3, 0xDF, 0xC2, 0x1E, 0x66, 0xF1, 0x4D, 0x73, 0xA2, 0xC2, 0x6E, 0xEF,
+    0x2A, 0xCC, 0xE5, 0x0A, 0x0B, 0x66, 0x41, 0xC5, 0x67, 0x48, 0xF2, 0x5D, 0x92, 0xBC, 0x45, 0x92,
+    0xC9, 0xA4, 0xED, 0x11, 0x9F, 0x4C, 0x28, 0xF8, 0x0E, 0x1D, 0xAC, 0xB7, 0x0B, 0xFA, 0xA0, 0x79,
+    0x68, 0x63, 0x41, 0x32, 0x09, 0x9D, 0x5F, 0x92, 0x09, 0xA8, 0x79, 0xEB, 0x9E, 0x0A, 0x33, 0x83,
+    0x19, 0x80, 0x3A, 0x9C, 0xE8, 0xB8, 0xF5, 0xAE, 0xE3, 0xE2, 0x8B, 0x77, 0xDC, 0x5B, 0x4F, 0x31,
+    0x80, 0x0B, 0x14, 0x7D, 0x9B, 0x00, 0x2D, 0xC6, 0xD9, 0x66, 0xE9, 0x67, 0x64, 0x73, 0x15, 0x34,
+    0xB9, 0x92, 0xEF, 0x22, 0xB7, 0xAF, 0xDD, 0x5D, 0xC9, 0xDB, 0xED, 0xF6, 0x28, 0x0A, 0x05, 0xF3,
+    0x9E, 0xDC, 0xD3, 0xCF, 0xC8, 0x06, 0xA6, 0x30, 0x4B, 0x1B, 0x81, 0x9A, 0x1D, 0x67, 0x94, 0xF4,
+    0x35, 0x6F, 0x3D, 0xF5, 0xA5, 0x3B, 0x6E, 0xF8, 0xFC, 0x8E, 0xFB, 0x4F, 0xD4, 0x0E, 0xAD, 0x6B,
+    0x47, 0x54, 0x49, 0x11, 0xE8, 0xBD, 0xF1, 0x50, 0x49, 0x25, 0xE0, 0xC1, 0xEE, 0xC1, 0xEE, 0x53,
+    0xD5, 0x5F, 0x92, 0x19, 0x3E, 0x2A, 0x1D, 0xAB, 0x6B, 0xD2, 0xAB, 0x0C, 0xF8, 0x00, 0x55, 0x16,
+    0xE8, 0xED, 0x94, 0x80, 0xC2, 0xF2, 0xB4, 0x62, 0xF7, 0x3E, 0x0A, 0xD3, 0x47, 0x29, 0xD2, 0xEE,
+    0xF4, 0xC1, 0xED, 0xD6, 0xC6, 0x55, 0x5D, 0x28, 0x79, 0xE5, 0xB6, 0x5E, 0xC0, 0xFC, 0x8F, 0x01,
+    0x15, 0xBD, 0xF9, 0xCB, 0xA7, 0x29, 0xA6, 0x11, 0xDD, 0xEE, 0xC5, 0x33, 0x2A, 0xA9, 0xE4, 0x1D,
+    0x7F, 0x93, 0x90, 0xD0, 0xFA, 0x76, 0x56, 0x7C, 0x8C, 0x5D, 0xEB, 0x1B, 0x7F, 0x37, 0x25, 0xB8,
+    0x67, 0x3F, 0x10, 0xD3, 0xE4, 0x9E, 0x99, 0x1D, 0x69, 0xB6, 0x4C, 0xE8, 0x8E, 0xE9, 0x0B, 0x13,
+    0xB0, 0xF9, 0x36, 0x5D, 0x4B, 0x86, 0x92, 0x94, 0x93, 0x62, 0xF3, 0xED, 0xD5, 0x26, 0xA2, 0xE2,
+    0x00, 0x70, 0xFE, 0x6B, 0x58, 0xD6, 0x24, 0x9D, 0x25, 0xE7, 0x9A, 0x8C, 0xC2, 0xDA, 0x17, 0x67,
+    0xB1, 0x52, 0x09, 0x62, 0x48, 0x9C, 0xF5, 0xD8, 0x02, 0x35, 0x38, 0x41, 0x3E, 0x54, 0xEC, 0x00,
+    0xEB, 0xE9, 0xD7, 0x0E, 0x25, 0x34, 0xB5, 0xA6, 0xE8, 0x68, 0xBB, 0xD5, 0xB0, 0xCF, 0x81, 0x13,
+    0xFA, 0x19, 0xBD, 0x87, 0x26, 0xDA, 0x05, 0x85, 0x88, 0x5E, 0xCD, 0x52, 0x11, 0xA8, 0xA8, 0xD8,
+    0x01, 0x7C, 0x9B, 0x0E, 0x68, 0x82, 0x9D, 0x00, 0xC5, 0xDE, 0x03, 0xB0, 0x94, 0xAA, 0x93, 0x6A,
+    0x15, 0x84, 0x5C, 0x46, 0x62, 0x08, 0x44, 0x63, 0x42, 0x66, 0xFA, 0xF7, 0x5F, 0xCD, 0x7D, 0x75,
+    0x01, 0x60, 0xB3, 0x5C, 0x49, 0xC4, 0x4D, 0xF3, 0x89, 0xDE, 0x2B, 0xDF, 0x6E, 0x49, 0x97, 0x29,
+    0x89, 0x5A, 0x2C, 0x77, 0x76, 0x45, 0x2A, 0x36, 0x1D, 0x8A, 0x4D, 0xCD, 0x0E, 0x26, 0xE8, 0x04,
+    0x70, 0x32, 0x01, 0x15, 0x3B, 0x51, 0x9B, 0x71, 0x02, 0xA7, 0x92, 0xAE, 0x22, 0xC4, 0x9B, 0x82,
+    0x4E, 0xE0, 0x88, 0x26, 0x54, 0x04, 0xCC, 0xDC, 0x2E, 0x80, 0x9D, 0x38, 0x02, 0x7C, 0x8B, 0x80,
+    0xE2, 0xB9, 0x05, 0xA8, 0xD2, 0x31, 0x86, 0x5A, 0xD8, 0x45, 0x91, 0x1D, 0x33, 0xAD, 0x80, 0x81,
+    0x15, 0x01, 0x98, 0x76, 0xC0, 0x22, 0x89, 0x30, 0x11, 0x28, 0x8F, 0x32, 0x56, 0x1F, 0x80, 0xE1,
+    0x0C, 0x80, 0xEC, 0x80, 0x72, 0xC5, 0x78, 0x1C, 0x33, 0x49, 0x05, 0x9F, 0xE3, 0xB0, 0x32, 0x48,
+    0x99, 0x3D, 0xFA, 0x14, 0x73, 0xD4, 0xCF, 0xAB, 0xA5, 0xBE, 0xCC, 0xAF, 0x05, 0x9D, 0x09, 0x00,
+    0x7D, 0x4D, 0xC0, 0xCC, 0xAB, 0xF1, 0x65, 0x80, 0x4E, 0x10, 0xDE, 0x09, 0xF4, 0x25, 0x07, 0x34,
+    0x01, 0x02, 0x6C, 0x16, 0xA5, 0xA6, 0x99, 0x01, 0x1D, 0x9B, 0x00, 0x14, 0xBC, 0x98, 0x00, 0x98,
+    0x9B, 0x3C, 0x16, 0x9B, 0x8B, 0xDE, 0xB0, 0xCD, 0x30, 0x46, 0x61, 0x26, 0x85, 0xCB, 0x4C, 0x3B,
+    0xC4, 0xD6, 0xB3, 0x36, 0xBB, 0x08, 0x18, 0xF2, 0xFA, 0x86, 0x52, 0xB8, 0x4D, 0xCB, 0xE3, 0xC9,
+    0x7C, 0xFD, 0xEA, 0xA1, 0x1F, 0x84, 0x40, 0xC9, 0x8C, 0xB4, 0x10, 0x5D, 0xF7, 0xCE, 0xAA, 0xA7,
+    0xCE, 0x66, 0x0B, 0x13, 0x45, 0xC7, 0x29, 0x5B, 0x2B, 0xF7, 0xB3, 0x28, 0x40, 0x75, 0xCA, 0x50,
+    0xD8, 0xDE, 0x67, 0x0F, 0x22, 0x9C, 0x74, 0x44, 0x41, 0xD7, 0x7B, 0x28, 0x3E, 0xC6, 0x01, 0x75,
+    0xD2, 0x11, 0xD0, 0xA1, 0xF7, 0x80, 0xF9, 0x84, 0x03, 0xD0, 0x5F, 0x0B, 0xAB, 0x94, 0xB9, 0xA4,
+    0x08, 0x99, 0xC5, 0x1C, 0x6A, 0x02, 0xD0, 0xB0, 0x3B, 0x46, 0x6C, 0x4E, 0x3B, 0x90, 0x98, 0x91,
+    0x81, 0x3F, 0x02, 0xA7, 0xC9, 0xF5, 0x6E, 0x31, 0xB0, 0xD0, 0xC2, 0x47, 0x66, 0x11, 0x5F, 0xB9,
+    0x7D, 0xF0, 0x15, 0x40, 0xF1, 0x79, 0x8A, 0x95, 0x32, 0x80, 0x1C, 0x3E, 0x9A, 0x00, 0xF4, 0x5D,
+    0x02, 0xB0, 0x77, 0x8C, 0xE2, 0xF9, 0x17, 0xD7, 0x76, 0xDB, 0xFF, 0x65, 0xDB, 0xC1, 0x84, 0xDE,
+    0xA3, 0xA2, 0x0E, 0x00, 0xBF, 0x4F, 0xA0, 0x9D, 0x7A, 0x87, 0x6A, 0xD6, 0x13, 0xF0, 0xD0, 0x4E,
+    0xFF, 0xB0, 0x39, 0x00, 0x56, 0x63, 0x91, 0x25, 0xDB, 0xB3, 0xF7, 0xB3, 0xE8, 0xA8, 0x39, 0x81,
+    0x53, 0x4D, 0x34, 0x41, 0xDA, 0x4D, 0x71, 0x30, 0x73, 0x1E, 0x72, 0x1C, 0xED, 0x94, 0x9B, 0xCD,
+    0x7C, 0x44, 0x07, 0xC5, 0x76, 0x01, 0x9A, 0x9B, 0xBB, 0x7A, 0x17, 0xAA, 0xC6, 0x1C, 0x1B, 0x8B,
+    0x48, 0xA3, 0x1D, 0xDB, 0xDC, 0x88, 0xE6, 0x2D, 0x1B, 0xB9, 0x75, 0x28, 0x5E, 0xA5, 0xCF, 0x33,
+    0x47, 0x99, 0x69, 0x8B, 0x71, 0x9D, 0xD1, 0x4F, 0x0E, 0xB6, 0x7E, 0xEA, 0x27, 0x54, 0xA9, 0x22,
+    0x60, 0x46, 0x33, 0xA1, 0xB8, 0x67, 0xA4, 0xF5, 0x1E, 0xE0, 0xBB, 0xEC, 0x04, 0xD2, 0x0A, 0xFE,
+    0xEC, 0x0B, 0x9E, 0x2E, 0x00, 0xDF, 0xA7, 0x83, 0x4E, 0x86, 0x5D, 0xC5, 0xBF, 0x17, 0xA3, 0x07,
+    0x32, 0x63, 0x80, 0x13, 0x2C, 0xC9, 0x09, 0xCF, 0xFE, 0xE5, 0x97, 0x35, 0x18, 0x5A, 0x7D, 0x61,
+    0xA0, 0x9A, 0xAB, 0x19, 0xC6, 0x1B, 0x0F, 0x3A, 0x3A, 0xC5, 0x92, 0x28, 0x5F, 0x2C, 0x4F, 0x48,
+    0xA2, 0x36, 0x07, 0x38, 0xF5, 0x6D, 0x61, 0x44, 0xC5, 0xF0, 0xAE, 0x26, 0xBD, 0x58, 0x79, 0x48,
+    0xD4, 0xB5, 0x80, 0x9A, 0x76, 0x46, 0x9B, 0x38, 0x17, 0x02, 0x65, 0xBC, 0x48, 0x92, 0x9A, 0x64,
+    0xA8, 0x98, 0xE8, 0x71, 0xAA, 0x14, 0x25, 0xCC, 0xBA, 0x0E, 0x8A, 0x4C, 0xF5, 0x38, 0xAA, 0xCF,
+    0xF7, 0x44, 0x9B, 0x79, 0xFB, 0x7C, 0x92, 0xB3, 0xD6, 0xBF, 0x8C, 0x13, 0xC1, 0x46, 0x4C, 0xB0,
+    0x4C, 0xC7, 0x27, 0xC8, 0x7E, 0x0C, 0x3E, 0xFB, 0x24, 0x02, 0xA7, 0x36, 0x9B, 0xB3, 0x86, 0x0C,
+    0xBB, 0xFF, 0xB4, 0x7D, 0xD9, 0x2C, 0x22, 0x58, 0xF9, 0xC2, 0xFF, 0x4C, 0x77, 0xFD, 0xA3, 0xFA,
+    0x9C, 0xFF, 0x93, 0x93, 0x5D, 0xEB, 0x5A, 0x07, 0x88, 0xEE, 0x08, 0xB9, 0x8B, 0x41, 0x14, 0x48,
+    0x9F, 0xA6, 0x62, 0x76, 0x0B, 0x46, 0xC5, 0x4C, 0x9B, 0x5C, 0x24, 0x00, 0xD8, 0x8F, 0x33, 0xBD,
+    0x62, 0x05, 0x4D, 0xF3, 0xF9, 0x89, 0xE9, 0x95, 0x0E, 0x25, 0x2F, 0x92, 0x1C, 0x60, 0x3F, 0x26,
+    0x19, 0xD1, 0x06, 0x4B, 0x72, 0xAA, 0xD9, 0x92, 0x0C, 0x25, 0x2F, 0x12, 0xE7, 0x38, 0xD8, 0x8F,
+    0xE9, 0x0A, 0xFA, 0x36, 0x58, 0x0F, 0x13, 0x6A, 0xB6, 0x01, 0x35, 0x1F, 0xE3, 0x45, 0xA2, 0xE4,
+    0x68, 0x3F, 0xA6, 0x83, 0xBD, 0x2B, 0xD1, 0xB0, 0xE4, 0x45, 0x6E, 0xC9, 0xCE, 0x7E, 0x4C, 0x92,
+    0x4E, 0x1E, 0xEB, 0xE4, 0xB1, 0x43, 0xC9, 0x8B, 0xE4, 0xAD, 0x13, 0xBE, 0x8C, 0xA0, 0xBD, 0xF6,
+    0x00, 0xEC, 0xD8, 0x4F, 0x40, 0xC9, 0xC7, 0x38, 0xEC, 0x14, 0x83, 0xFB, 0x87, 0xFB, 0x87, 0xF7,
+    0x94, 0x7C, 0x73, 0x00, 0x60, 0xF3, 0xDF, 0x8B, 0xC1, 0xEA, 0x25, 0x51, 0xDB, 0x9A, 0x05, 0x10,
+    0xF4, 0xDB, 0x0A, 0x01, 0x3C, 0x4E, 0x22, 0x5F, 0x44, 0x1B, 0x04, 0x05, 0x78, 0x5D, 0xCA, 0x75,
+    0x49, 0x94, 0x34, 0x66, 0xD9, 0xA7, 0x6F, 0x03, 0xA7, 0x92, 0xA3, 0xBD, 0xCE, 0xA1, 0xE2, 0x63,
+    0xBC, 0x94, 0xD0, 0xC4, 0x9A, 0x66, 0x81, 0x9D, 0xDB, 0xC0, 0xE9, 0x11, 0x3A, 0x7B, 0x9D, 0x64,
+    0x92, 0xBB, 0x7C, 0x4D, 0x43, 0x26, 0xB4, 0x41, 0xC0, 0x85, 0xBE, 0xD8, 0x01, 0x0B, 0x5D, 0x2B,
+    0xE9, 0x99, 0xF6, 0xA2, 0x14, 0xB0, 0x0D, 0x2B, 0xE0, 0xAC, 0x3C, 0x86, 0xE4, 0xB5, 0x01, 0xC0,
+    0x11, 0xB7, 0x2F, 0xC3, 0xEC, 0x84, 0xD4, 0x42, 0x11, 0x66, 0x86, 0xEB, 0xEE, 0x9C, 0x9F, 0xBA,
+    0x3D, 0x6D, 0x07, 0xE9, 0xDC, 0x42, 0xF9, 0xD8, 0xCC, 0x15, 0x0D, 0x2B, 0x22, 0xB8, 0xBD, 0xDB,
+    0xB8, 0xF4, 0x7F, 0xE7, 0x08, 0x71, 0x3A, 0xA5, 0x45, 0x34, 0x16, 0x90, 0x25, 0x87, 0x99, 0xF8,
+    0xD9, 0x6C, 0x0E, 0x7A, 0xC1, 0x7C, 0x70, 0x3A, 0x3E, 0xF1, 0x79, 0x6D, 0x5B, 0x4F, 0xB4, 0x58,
+    0x10, 0x73, 0xD6, 0x24, 0x3B, 0x92, 0xF3, 0x9E, 0xBD, 0xB1, 0x39, 0x99, 0xA7, 0x03, 0x7A, 0x06,
+    0xB1, 0x2E, 0xDC, 0x9D, 0x20, 0x2B, 0x25, 0x8E, 0x4F, 0xF6, 0xFB, 0x45, 0x16, 0x8D, 0x9A, 0x5E,
+    0xD6, 0x99, 0xE2, 0x95, 0x55, 0xF4, 0x27, 0x78, 0xD9, 0x05, 0x9C, 0x51, 0x89, 0x13, 0x16, 0xB1,
+    0x51, 0x2B, 0xC5, 0xC9, 0x96, 0x48, 0x5C, 0xDD, 0x2A, 0x80, 0x1D, 0x00, 0x4D, 0x93, 0xC5, 0xB3,
+    0xE3, 0x0E, 0x93, 0xBD, 0x7A, 0xD8, 0xEA, 0xB3, 0x3F, 0x20, 0x51, 0x62, 0x8A, 0x0A, 0xBF, 0xCF,
+    0xB4, 0xD7, 0x6A, 0x65, 0x3E, 0x01, 0x05, 0xDF, 0x17, 0x94, 0x8D, 0xA2, 0x03, 0xEC, 0x52, 0x73,
+    0x40, 0x25, 0xEF, 0x32, 0x11, 0x0D, 0xF9, 0x7D, 0x4E, 0x30, 0x4C, 0x0D, 0x01, 0xC3, 0x45, 0xF0,
+    0x68, 0x1F, 0x0A, 0x6A, 0x65, 0x38, 0x81, 0x8D, 0xCA, 0x78, 0xC2, 0x15, 0x3C, 0x3F, 0x00, 0xF8,
+    0xAF, 0x6D, 0x86, 0x17, 0x7B, 0x01, 0x57, 0x0E, 0x58, 0x75, 0x6B, 0xD0, 0x3B, 0xD0, 0xA5, 0x98,
+    0xE6, 0x71, 0x46, 0x9B, 0x40, 0x5F, 0xD0, 0x97, 0x9C, 0x34, 0xA1, 0x38, 0xDA, 0x05, 0x8A, 0x17,
+    0xE8, 0x50, 0xD3, 0x0A, 0xB0, 0x71, 0x3A, 0x26, 0x2A, 0xA5, 0x00, 0xC3, 0x4A, 0x23, 0xEB, 0x4C,
+    0x77, 0x44, 0xE4, 0xDC, 0x26, 0x98, 0x90, 0x1F, 0xD2, 0x24, 0x90, 0x9E, 0xBE, 0x20, 0x2F, 0xB1,
+    0x53, 0x64, 0x1F, 0x56, 0xCD, 0xBA, 0x40, 0x08, 0xAD, 0xDB, 0x01, 0xA5, 0x74, 0x00, 0xF0, 0x4D,
+    0x3B, 0x01, 0xE8, 0xC5, 0x3E, 0x54, 0x6C, 0xFF, 0x1C, 0x80, 0xFD, 0x97, 0x72, 0x33, 0x89, 0xA0,
+    0x7F, 0x90, 0x56, 0x6A, 0x08, 0xC5, 0x31, 0x37, 0x92, 0x09, 0xA0, 0x5F, 0xDB, 0xC8, 0xCE, 0xFD,
+    0xB2, 0x36, 0x51, 0xC1, 0xBC, 0x2A, 0xAF, 0x1E, 0x1B, 0xBC, 0x26, 0x99, 0xB9, 0x22, 0x8A, 0xBA,
+    0xDA, 0x9D, 0x3E, 0x22, 0xAF, 0xBE, 0x98, 0x9B, 0x47, 0x50, 0x19, 0xB9, 0x75, 0xE8, 0xC5, 0x81,
+    0x43, 0xCD, 0x01, 0x7D, 0x00, 0x67, 0x69, 0x1B, 0xB4, 0x09, 0x8A, 0x53, 0x43, 0xC0, 0x44, 0x41,
+    0x5D, 0x5F, 0xA4, 0x03, 0xB8, 0x9C, 0x3A, 0x8B, 0x62, 0x73, 0x86, 0x23, 0xEC, 0xA2, 0x89, 0x86,
+    0xB0, 0x62, 0x74, 0x3A, 0xDA, 0x25, 0x7B, 0x4E, 0xB2, 0x77, 0xC4, 0xD2, 0x7A, 0xC1, 0xDE, 0x39,
+    0x72, 0x83, 0xE3, 0x8F, 0x3A, 0x3E, 0x4D, 0x50, 0x02, 0x40, 0xBC, 0x43, 0x27, 0xB7, 0x29, 0x8E,
+    0x76, 0x16, 0x0B, 0x56, 0x4D, 0x34, 0x54, 0x1C, 0x45, 0xAA, 0xAF, 0xE8, 0x70, 0x80, 0xDF, 0x46,
+    0xF9, 0xF6, 0xF6, 0x27, 0xE4, 0x6B, 0xD5, 0x0B, 0xD5, 0xF9, 0x37, 0x07, 0x8F, 0xDF, 0x83, 0x86,
+    0x72, 0xF8, 0xA2, 0x27, 0x0F, 0x02, 0x45, 0x57, 0x4C, 0xC5, 0x54, 0xDC, 0x7E, 0xC5, 0xF2, 0x62,
+    0xE7, 0xFF, 0xAF, 0xDF, 0x7B, 0xF0, 0x4B, 0x3D, 0x20, 0x9F, 0xFC, 0xEE, 0x66, 0xF3, 0xCC, 0x6A,
+    0x70, 0xC1, 0x1B, 0x9B, 0xCD, 0x3D, 0x97, 0xA7, 0x36, 0x9B, 0xCD, 0x59, 0x4B, 0x51, 0x1C, 0xE7,
+    0x60, 0xD5, 0xD5, 0x67, 0x95, 0x55, 0xCE, 0x1C, 0x3E, 0xE7, 0xE4, 0x98, 0x08, 0xC7, 0xDE, 0x7F,
+    0x17, 0x61, 0x2E, 0xCE, 0x60, 0x3B, 0xAA, 0x60, 0x3B, 0xFD, 0xF1, 0x3F, 0xD1, 0xE5, 0x47, 0x2F,
+    0xE3, 0x61, 0x19, 0x94, 0xD9, 0xC2, 0x64, 0xCE, 0xFE, 0x34, 0xB0, 0xEA, 0xB9, 0x66, 0x92, 0xF1,
+    0xD4, 0x66, 0xB3, 0x81, 0x62, 0x41, 0x67, 0x27, 0x33, 0xEB, 0xA0, 0x52, 0x41, 0x58, 0x67, 0xC6,
+    0xBD, 0x03, 0xF4, 0x53, 0xEF, 0x8D, 0x6F, 0xE7, 0x66, 0xD1, 0xA1, 0x0E, 0x2A, 0x96, 0x11, 0x1B,
+    0x1D, 0xAA, 0xA4, 0x43, 0x9D, 0x9A, 0xA0, 0x63, 0xBB, 0xE8, 0x60, 0xBC, 0x5E, 0x8C, 0x6F, 0x66,
+    0x33, 0xB6, 0xBE, 0x77, 0x66, 0xB2, 0x83, 0x71, 0x1B, 0x9C, 0xEA, 0xFA, 0xA9, 0x9D, 0x9B, 0xA0,
+    0x93, 0x3C, 0x7A, 0x34, 0xBE, 0x59, 0x74, 0x50, 0x2C, 0xD8, 0x59, 0x67, 0x26, 0x3D, 0xD7, 0xA1,
+    0x8C, 0x20, 0x4E, 0x75, 0xA7, 0x3A, 0x9C, 0x3E, 0x14, 0x95, 0x88, 0x99, 0x80, 0x76, 0x02, 0xDA,
+    0x11, 0x68, 0x46, 0xA0, 0x71, 0x38, 0xD0, 0xEE, 0x21, 0x92, 0x61, 0xFD, 0x4F, 0x47, 0x57, 0x03,
+    0xB4, 0x03, 0xB4, 0x13, 0x9F, 0x6E, 0x8D, 0xCB, 0x79, 0x47, 0xB9, 0xAF, 0x1D, 0xF3, 0x33, 0x26,
+    0x79, 0xDE, 0xEE, 0xDF, 0xDF, 0xFD, 0xFF, 0xF0, 0x8B, 0x32, 0xE4, 0x5B, 0x0F, 0x34, 0x1E, 0x68,
+    0x26, 0xF1, 0x51, 0xA7, 0x47, 0xF0, 0xDA, 0x87, 0x31, 0x8B, 0x95, 0x22, 0xC9, 0x08, 0x3D, 0x4A,
+    0x5A, 0xE3, 0xEF, 0xBE, 0x47, 0x4F, 0x78, 0xE5, 0x99, 0x2B, 0xAF, 0x9C, 0xCC, 0xFB, 0x97, 0x4F,
+    0xBE, 0xFD, 0x3F, 0xDC, 0x95, 0x7F, 0xBD, 0xC7, 0x78, 0x60, 0x83, 0x8A, 0xA3, 0xE6, 0xDC, 0x32,
+    0x18, 0x06, 0xC3, 0x68, 0x18, 0x0D, 0x83, 0x61, 0x68, 0xB9, 0x68, 0xE1, 0x56, 0x80, 0x01, 0x58,
+    0x00, 0x76, 0xE0, 0x04, 0x26, 0x90, 0x23, 0xB9, 0x90, 0x0B, 0x39, 0x8A, 0xC3, 0x12, 0x76, 0x58,
+    0x00, 0x11, 0x37, 0x3D, 0xF2, 0x1C, 0x2F, 0xD1, 0x26, 0x3B, 0xD3, 0x9D, 0xC5, 0x23, 0x03, 0xFE,
+    0x43, 0x4D, 0x34, 0x81, 0xB3, 0xE2, 0x65, 0x76, 0x26, 0x71, 0x2E, 0xF9, 0x6E, 0x82, 0x0E, 0x7B,
+    0x1D, 0x4E, 0xE1, 0x91, 0xEF, 0xF3, 0x12, 0xFB, 0xC8, 0x1B, 0x1C, 0xCE, 0xE2, 0xD9, 0xAD, 0x25,
+    0xBF, 0xC2, 0x78, 0xFA, 0x3D, 0x68, 0x94, 0x0E, 0xDB, 0x6D, 0xCF, 0xAF, 0x70, 0x67, 0x3E, 0xF9,
+    0xF5, 0x9E, 0xEF, 0x32, 0xDE, 0x13, 0xC0, 0x43, 0xE3, 0x2B, 0x05, 0x3D, 0xDF, 0xDD, 0xBE, 0xFC,
+    0x27, 0xA8, 0x80, 0x3F, 0x41, 0x05, 0xFC, 0xC7, 0xCD, 0xE3, 0x5F, 0xEF, 0x69, 0x3F, 0xDD, 0xFE,
+    0x67, 0x60, 0xC4, 0xAF, 0x01, 0x23, 0x7E, 0xED, 0xD4, 0xE6, 0x6B, 0x7D, 0xDB, 0x5D, 0xAA, 0xED,
+    0x08, 0xA8, 0x0C, 0x23, 0xE6, 0x92, 0x57, 0x1B, 0x31, 0x8E, 0xD7, 0x42, 0x86, 0x98, 0x3B, 0x84,
+    0x92, 0x55, 0xB4, 0x0A, 0x7A, 0x46, 0x9F, 0x6D, 0x6D, 0x1D, 0x87, 0xAC, 0xF1, 0xD5, 0x4B, 0x1D,
+    0x56, 0x58, 0x21, 0x07, 0xEB, 0xCC, 0xB8, 0x8B, 0xAE, 0xC3, 0x71, 0x74, 0x5E, 0x54, 0xEB, 0xA5,
+    0x5E, 0x5A, 0x7F, 0xAA, 0x03, 0xCE, 0xC2, 0x3A, 0x9E, 0x8F, 0x0D, 0x07, 0x70, 0x51, 0xB1, 0xF1,
+    0xFC, 0x01, 0x13, 0x0C, 0xBD, 0x21, 0x1B, 0x2F, 0xD4, 0xCC, 0x40, 0x5E, 0x48, 0xCD, 0x4C, 0xC7,
+    0xE7, 0x83, 0xE2, 0xDC, 0xBF, 0x49, 0x15, 0x5B, 0x6F, 0xC6, 0xFD, 0x97, 0xF4, 0x6C, 0x26, 0xF3,
+    0xF7, 0xA9, 0x4C, 0x40, 0x49, 0x15, 0x55, 0x32, 0x53, 0xEB, 0x01, 0x33, 0x9A, 0xB1, 0x7D, 0x3F,
+    0x95, 0x04, 0xEA, 0xA0, 0x62, 0x99, 0xA3, 0xD9, 0x99, 0xD1, 0x48, 0xB4, 0x99, 0x54, 0x52, 0xB1,
+    0xF5, 0x66, 0x42, 0x15, 0xD0, 0x7A, 0xF3, 0x36, 0x55, 0x04, 0x38, 0x14, 0xFC, 0x51, 0xD0, 0xB7,
+    0xAC, 0x43, 0xE3, 0xA1, 0xC9, 0xCE, 0x72, 0x81, 0x8A, 0x80, 0xE1, 0xA4, 0x48, 0xA9, 0x1B, 0xBB,
+    0x64, 0x2C, 0xBC, 0x80, 0xF5, 0xF6, 0x3E, 0x45, 0xFD, 0xC3, 0xCE, 0x58, 0xAB, 0x6E, 0xF5, 0x36,
+    0x50, 0x9F, 0x9C, 0xBA, 0x67, 0xA8, 0x78, 0x2C, 0xA1, 0xBE, 0xC3, 0x15, 0x04, 0x0D, 0x00, 0x8D,
+    0x37, 0x23, 0x8E, 0x2F, 0xEB, 0xA0, 0x17, 0x1C, 0x23, 0x1E, 0x55, 0x2A, 0xB9, 0x56, 0xFF, 0xAE,
+    0xAE, 0xA7, 0xE3, 0x67, 0x4D, 0xAD, 0x6F, 0x8E, 0x5B, 0x57, 0x2F, 0x75, 0x38, 0xF1, 0x1D, 0x65,
+    0x2A, 0x59, 0x87, 0xE2, 0x00, 0x38, 0x05, 0x14, 0xB9, 0xEA, 0x35, 0x07, 0xB1, 0xB3, 0x1E, 0xF5,
+    0xDC, 0xFF, 0x94, 0x9A, 0x01, 0xA4, 0xAB, 0x19, 0x15, 0xE9, 0xA9, 0xC9, 0xC1, 0x32, 0x54, 0xA4,
+    0x33, 0x9C, 0xF9, 0x83, 0x74, 0xCE, 0x9B, 0x4F, 0x78, 0x86, 0xCF, 0x2C, 0x6B, 0x4B, 0x34, 0xDE,
+    0x4C, 0x7C, 0x8C, 0x78, 0xF8, 0xD0, 0x4C, 0x1C, 0xF8, 0x7C, 0xA8, 0x43, 0xEF, 0x7A, 0x07, 0x34,
+    0xDE, 0x4C, 0xED, 0xC7, 0x2C, 0xD8, 0x78, 0x3D, 0x8B, 0xF4, 0xAB, 0x0E, 0xD6, 0xF5, 0x6F, 0x05,
+    0x15, 0x81, 0x3A, 0xA8, 0x54, 0xB2, 0xF5, 0xCD, 0x47, 0x04, 0x3B, 0xA8, 0x08, 0x0E, 0xF6, 0x62,
+    0xA8, 0x42, 0xEF, 0xCC, 0x88, 0x92, 0x68, 0xBD, 0xF9, 0x3B, 0x96, 0xD4, 0x73, 0xE3, 0x01, 0xA2,
+    0x0A, 0x7A, 0x36, 0x23, 0xCF, 0xA7, 0x3A, 0x00, 0x76, 0x00, 0xFF, 0x22, 0xE8, 0x68, 0x47, 0xFB,
+    0x6E, 0x02, 0x7A, 0x87, 0x96, 0xA9, 0x10, 0x9A, 0x00, 0x30, 0x13, 0x14, 0x89, 0x96, 0xBE, 0x20,
+    0x3B, 0x99, 0xEB, 0xC4, 0x69, 0x5D, 0xB3, 0x12, 0x75, 0x67, 0x81, 0xA2, 0x13, 0x63, 0xAC, 0x66,
+    0x06, 0x5D, 0x1D, 0x60, 0xA6, 0x92, 0xD0, 0x1E, 0x76, 0x50, 0x01, 0xED, 0x88, 0x04, 0xA0, 0x99,
+    0x9B, 0x05, 0x74, 0x74, 0x75, 0xA8, 0x22, 0xCC, 0x64, 0x7C, 0xC9, 0x82, 0xD0, 0x5E, 0xCF, 0xB0,
+    0x43, 0xEF, 0x54, 0x50, 0x01, 0xED, 0xD8, 0x4C, 0x48, 0xB0, 0x39, 0xBF, 0x5E, 0x60, 0xBC, 0xF1,
+    0xED, 0x0C, 0xEB, 0xFA, 0xD1, 0x4C, 0xE0, 0x40, 0x67, 0x5D, 0xC9, 0x82, 0x60, 0xA7, 0x82, 0x8A,
+    0x25, 0x51, 0x2F, 0x55, 0x50, 0x01, 0xDA, 0x6B, 0x5F, 0xCF, 0x68, 0xC7, 0x66, 0xD2, 0x1E, 0x66,
+    0x68, 0x5D, 0xE3, 0xD0, 0x7A, 0xF4, 0x13, 0xAC, 0x03, 0x87, 0x82, 0x28, 0x13, 0x54, 0x40, 0xB5,
+    0xA0, 0xF6, 0xD0, 0x53, 0xEB, 0x9B, 0x59, 0xD8, 0xD0, 0x3A, 0x54, 0x51, 0x7A, 0x43, 0x41, 0xB0,
+    0x83, 0x1D, 0x7A, 0x07, 0xE3, 0xDA, 0x11, 0xCD, 0xA4, 0x3D, 0x6A, 0x5F, 0xCD, 0x50, 0x4B, 0x19,
+    0x5A, 0xDF, 0xCC, 0x7A, 0x81, 0x2C, 0x96, 0xA8, 0x43, 0x15, 0x55, 0x82, 0x4A, 0x25, 0x8B, 0x7C,
+    0xA7, 0x1D, 0x60, 0x87, 0xDE, 0x19, 0xB9, 0xBB, 0x99, 0xD0, 0x4C, 0xDA, 0xD7, 0xF2, 0x04, 0xB5,
+    0x40, 0x2D, 0x65, 0x28, 0xA4, 0xEF, 0x7E, 0x0B, 0x28, 0x02, 0xA0, 0x17, 0xA0, 0xF7, 0x50, 0x37,
+    0x27, 0xE8, 0x4B, 0x0E, 0x3F, 0x69, 0x9C, 0xF2, 0xA6, 0x6B, 0xBB, 0x1E, 0x01, 0xB1, 0x1E, 0x8B,
+    0x60, 0xA0, 0x66, 0x94, 0x80, 0x9E, 0xD0, 0x06, 0xD8, 0xB9, 0xE0, 0x24, 0x36, 0xF0, 0x26, 0xA0,
+    0x9F, 0x61, 0x02, 0x9A, 0x84, 0x5A, 0x2C, 0x20, 0xE8, 0x61, 0x02, 0x9A, 0x05, 0xD5, 0x00, 0xA0,
+    0x18, 0xA0, 0xA7, 0x6C, 0x0D, 0xA1, 0x09, 0x45, 0x57, 0x70, 0xBD, 0x36, 0x41, 0x9C, 0x9F, 0xD6,
+    0xEC, 0x1A, 0xF1, 0x94, 0xE5, 0xA1, 0xDC, 0xC9, 0x51, 0xF7, 0x0D, 0x68, 0x8F, 0x07, 0xF0, 0xDB,
+    0xA8, 0x13, 0xEA, 0xA1, 0x1D, 0x15, 0x5D, 0xBD, 0xE8, 0x24, 0x92, 0x2A, 0x4E, 0x8D, 0x17, 0x30,
+    0xEF, 0x61, 0xB6, 0x68, 0xCA, 0xBE, 0x20, 0x04, 0xFF, 0x3B, 0x65, 0xEF, 0x89, 0x19, 0x8B, 0xF3,
+    0x21, 0x01, 0x3D, 0x69, 0x12, 0xAF, 0xEB, 0x08, 0x12, 0xF6, 0x7A, 0x2E, 0x01, 0xA7, 0x9A, 0x63,
+    0xCD, 0xD6, 0xD7, 0x8C, 0x05, 0x9F, 0x7B, 0xB1, 0x26, 0xC7, 0x07, 0xBB, 0x15, 0xDB, 0x5A, 0x13,
+    0x1C, 0x81, 0x9A, 0xD0, 0x31, 0x9B, 0x4E, 0x8D, 0xF2, 0xA2, 0x88, 0x9A, 0x78, 0x1D, 0x1C, 0x6B,
+    0xC2, 0x8E, 0x3A, 0x2A, 0xC2, 0x2C, 0xA0, 0x33, 0xD0, 0x09, 0xDA, 0x29, 0x94, 0xEC, 0xE0, 0x00,
+    0xB4, 0x5D, 0x76, 0x61, 0x7C, 0x89, 0x9D, 0x09, 0x9C, 0x15, 0x2F, 0xB2, 0x33, 0xC1, 0x7A, 0xC5,
+    0x8B, 0xC4, 0x89, 0x93, 0xDE, 0x2B, 0xFE, 0x80, 0x68, 0x97, 0xDE, 0x97, 0xC7, 0x27, 0xE7, 0x89,
+    0x76, 0x36, 0x53, 0xC1, 0x33, 0x09, 0xCD, 0xF1, 0xC9, 0xA9, 0xEE, 0x04, 0x20, 0xAA, 0xF8, 0x31,
+    0x1E, 0x3C, 0xB4, 0x5E, 0xF1, 0x05, 0x79, 0x45, 0x25, 0xEF, 0xEA, 0xA7, 0x92, 0xDD, 0x59, 0x14,
+    0x32, 0x46, 0xCE, 0x71, 0x2A, 0x49, 0x7E, 0x7F, 0xC5, 0x4D, 0x3C, 0xC1, 0x1B, 0x9C, 0xDE, 0x8B,
+    0x3A, 0x94, 0x54, 0x84, 0x75, 0x74, 0xAD, 0xEF, 0xA7, 0x2A, 0x98, 0xB9, 0x60, 0xBF, 0x64, 0xC4,
+    0xC8, 0x22, 0xE2, 0x49, 0x66, 0xD2, 0x42, 0x87, 0x63, 0x0C, 0xF9, 0xF1, 0xEF, 0x95, 0x6C, 0xFF,
+    0x24, 0x8E, 0x40, 0x57, 0xBD, 0x87, 0x3B, 0x31, 0x93, 0xDE, 0xEB, 0x1C, 0x69, 0xBB, 0xDD, 0xBE,
+    0x22, 0x29, 0x7F, 0x08, 0x40, 0x9D, 0x19, 0x01, 0x34, 0x95, 0x03, 0x0A, 0x5F, 0x8F, 0x40, 0xD3,
+    0xD5, 0x13, 0xCA, 0x05, 0x75, 0xFA, 0x03, 0x0E, 0x82, 0x59, 0x41, 0x61, 0x6F, 0x01, 0xC0, 0xB3,
+    0x2F, 0x21, 0x43, 0x23, 0x2B, 0x5E, 0x63, 0x87, 0xBE, 0x83, 0xED, 0xAA, 0x09, 0x68, 0xBB, 0xDF,
+    0x07, 0xD0, 0xAA, 0x09, 0xC0, 0xBF, 0xD5, 0x00, 0xF0, 0xBB, 0x77, 0x7D, 0x64, 0x00, 0xCA, 0x19,
+    0x50, 0x1E, 0xA8, 0xC6, 0x4C, 0xD8, 0x0D, 0x80, 0x01, 0xF0, 0xA7, 0x92, 0x5C, 0x2C, 0x39, 0x79,
+    0x02, 0xEA, 0x4C, 0xFB, 0xB5, 0x99, 0xA6, 0xFB, 0xC9, 0x02, 0x84, 0xD7, 0x50, 0xCE, 0xDF, 0x82,
+    0xF2, 0x2D, 0xEA, 0xB1, 0x19, 0xB4, 0xD3, 0xAE, 0xE9, 0xAA, 0xC9, 0x40, 0x79, 0x40, 0xBC, 0xFB,
+    0xAE, 0xD2, 0xA2, 0x5D, 0x37, 0xAE, 0xC2, 0x7D, 0x22, 0xD5, 0x1A, 0xB9, 0x07, 0x33, 0x3C, 0x90,
+    0xD7, 0x90, 0xF3, 0xCB, 0xB9, 0xD5, 0x2E, 0x8E, 0xAB, 0x9F, 0xE6, 0x6C, 0x06, 0x88, 0x63, 0x77,
+    0x74, 0xD2, 0x90, 0x07, 0x3B, 0xF2, 0x7A, 0x39, 0x5E, 0x83, 0x56, 0xE9, 0x69, 0xF3, 0x09, 0x77,
+    0xC9, 0x2B, 0xEE, 0x3F, 0x2B, 0x4A, 0x45, 0xB4, 0x9A, 0x71, 0x73, 0x66, 0x2A, 0x87, 0x7F, 0x03,
+    0x0E, 0xC8, 0x6B, 0x97, 0x5E, 0x00, 0xC8, 0x32, 0xCF, 0x61, 0xFD, 0x48, 0xF1, 0xDC, 0x25, 0xE8,
+    0xE4, 0x0E, 0xFF, 0xA9, 0x0C, 0xFB, 0x13, 0x3E, 0xA8, 0x7C, 0xF5, 0x16, 0x8F, 0xDE, 0x23, 0x74,
+    0xB2, 0xE7, 0x82, 0x25, 0x29, 0x72, 0x99, 0x8B, 0x19, 0xD6, 0x48, 0xC6, 0x67, 0xC9, 0xF4, 0x62,
+    0xF1, 0x2A, 0x79, 0x7B, 0x40, 0x96, 0x00, 0x4C, 0xAB, 0x4E, 0xC6, 0xB2, 0x43, 0x9D, 0x08, 0xA0,
+    0xB9, 0x19, 0x50, 0xF0, 0xC9, 0x05, 0x50, 0xC9, 0x78, 0x18, 0x6F, 0x47, 0x80, 0x6F, 0x70, 0xA8,
+    0x92, 0x4A, 0x19, 0x53, 0x59, 0xBB, 0x16, 0x40, 0xD3, 0x7D, 0x0F, 0x78, 0x00, 0x1D, 0x80, 0x6F,
+    0x14, 0xC0, 0xA9, 0xCD, 0x59, 0xF2, 0x3A, 0x79, 0x89, 0x34, 0x0C, 0x9B, 0x4D, 0xB7, 0x7A, 0x37,
+    0x03, 0xBB, 0x95, 0xBD, 0x36, 0x0E, 0xD2, 0x7E, 0x68, 0xFC, 0x5A, 0xBC, 0x2A, 0x20, 0x17, 0xB7,
+    0xE0, 0xAF, 0x2E, 0x37, 0x4E, 0x50, 0x9C, 0x63, 0x15, 0x71, 0xDF, 0xE0, 0xCA, 0xE3, 0x6B, 0x96,
+    0x2B, 0x8F, 0x7F, 0x46, 0x96, 0xB1, 0xDA, 0xD1, 0xAD, 0xA3, 0xE1, 0xFB, 0xA4, 0xE1, 0x75, 0x12,
+    0xC6, 0xAB, 0xFB, 0x06, 0xA7, 0xFA, 0xEB, 0x39, 0xCB, 0xA9, 0xFE, 0x33, 0xB2, 0xC0, 0xAC, 0x59,
+    0x0C, 0x8F, 0x89, 0x8C, 0x7D, 0xA6, 0x6E, 0x9D, 0x1E, 0x86, 0x96, 0x9C, 0x5B, 0x92, 0xE7, 0x57,
+    0xAC, 0xD7, 0xE3, 0x24, 0xBD, 0xBD, 0x62, 0xA9, 0xD3, 0xD3, 0x9C, 0x26, 0xB4, 0xE1, 0x5F, 0x89,
+    0x9C, 0xAB, 0xCF, 0x52, 0xE0, 0x82, 0x4E, 0x64, 0x60, 0xF5, 0x0A, 0x2B, 0x13, 0x25, 0x4A, 0x56,
+    0x20, 0x32, 0x7B, 0xC0, 0x6E, 0x38, 0x40, 0xD3, 0xA1, 0xE0, 0x22, 0x91, 0x9A, 0xDD, 0xAA, 0xDB,
+    0x14, 0x9B, 0x51, 0xC5, 0x5C, 0xBF, 0x7A, 0xC9, 0xD2, 0x11, 0x33, 0x02, 0xC5, 0xC1, 0xA7, 0xC1,
+    0x9F, 0xF9, 0xF7, 0xD7, 0x00, 0x1E, 0x19, 0xB0, 0x33, 0x6F, 0x45, 0x1F, 0xC4, 0xAC, 0xB1, 0xA0,
+    0x17, 0x5D, 0x4A, 0x25, 0x22, 0xA6, 0x6C, 0x9A, 0xBF, 0x9B, 0x93, 0xCE, 0xDE, 0x55, 0x76, 0xC5,
+    0x9F, 0x92, 0x1C, 0x34, 0xCF, 0x91, 0x1C, 0x4C, 0x30, 0x24, 0x3B, 0x29, 0xB3, 0xA2, 0x9B, 0xD0,
+    0x86, 0x5A, 0x84, 0x6E, 0x6D, 0x00, 0x0A, 0x71, 0x47, 0x5C, 0xB3, 0xA4, 0x03, 0xFA, 0x39, 0x97,
+    0xB3, 0x09, 0x00, 0x83, 0xE8, 0x5E, 0x5D, 0xC1, 0x01, 0x5C, 0x50, 0x25, 0x54, 0xEC, 0xD0, 0x2C,
+    0x68, 0x67, 0xC0, 0x4C, 0xB0, 0x0E, 0xE0, 0x50, 0x12, 0x50, 0x11, 0xC5, 0xC1, 0x0E, 0xA4, 0x7E,
+    0x57, 0x89, 0x8A, 0x1F, 0x43, 0x0B, 0x76, 0xA8, 0x0F, 0x00, 0xE7, 0x82, 0x1E, 0x8A, 0x63, 0x25,
+    0x2A, 0xDF, 0x3A, 0x02, 0xCD, 0x22, 0x08, 0xF7, 0x9D, 0x23, 0xC7, 0x6E, 0x9F, 0x09, 0xA2, 0x5B,
+    0xD6, 0x3C, 0x43, 0x72, 0xB6, 0x73, 0x43, 0xF2, 0x22, 0xC1, 0x2B, 0x36, 0x59, 0x5F, 0x75, 0xB2,
+    0x04, 0xA2, 0xA6, 0xF5, 0x00, 0xEC, 0xCF, 0x64, 0x75, 0xEC, 0x8F, 0x61, 0xD8, 0x5C, 0xC4, 0x77,
+    0x6B, 0x45, 0xA0, 0xE1, 0x60, 0x3C, 0x14, 0x47, 0x95, 0xC4, 0x75, 0xCF, 0x04, 0x1D, 0xA0, 0x12,
+    0xC0, 0x01, 0x66, 0x82, 0x5E, 0x50, 0x9C, 0xFD, 0x74, 0xA3, 0x3C, 0x32, 0x60, 0x7F, 0x42, 0x4D,
+    0x14, 0x1C, 0x21, 0xF2, 0x35, 0xCD, 0xAE, 0xE4, 0x94, 0x2F, 0xAA, 0x04, 0xD0, 0x61, 0xAF, 0x43,
+    0x71, 0x20, 0x78, 0xBE, 0xCD, 0xCE, 0xD9, 0xDF, 0x65, 0x92, 0xE9, 0xF4, 0x76, 0x2B, 0x88, 0x8B,
+    0x21, 0xCB, 0xC5, 0xEC, 0x98, 0x7B, 0x45, 0x3B, 0xDF, 0x15, 0x3D, 0xE5, 0xE8, 0xBC, 0x33, 0x41,
+    0xF6, 0xE6, 0x73, 0x1C, 0x9D, 0x8D, 0xA4, 0x71, 0x7A, 0xBB, 0x3D, 0x80, 0x26, 0x39, 0xA9, 0x9D,
+    0x9C, 0x69, 0x32, 0x8A, 0x0C, 0xDA, 0x91, 0x3C, 0xEF, 0x0D, 0xE9, 0x83, 0x26, 0x83, 0x51, 0x24,
+    0xB5, 0x23, 0x79, 0xE1, 0x33, 0x23, 0xA7, 0xA0, 0x49, 0x6F, 0x14, 0xB9, 0x68, 0x47, 0x2E, 0xCA,
+    0x1B, 0x4E, 0x08, 0xDA, 0x01, 0x46, 0x79, 0x40, 0xBB, 0x00, 0x28, 0x6F, 0x80, 0xAF, 0x16, 0x39,
+    0xBC, 0xB6, 0xCA, 0x87, 0xC5, 0xDE, 0xA2, 0x65, 0x1E, 0x8B, 0x51, 0x93, 0x73, 0xFB, 0x38, 0x19,
+    0xEB, 0x9F, 0x92, 0x7C, 0x6C, 0x26, 0x39, 0xFE, 0xC4, 0x90, 0x73, 0xFB, 0x24, 0x19, 0xEB, 0x77,
+    0xEE, 0x89, 0x7C, 0x82, 0x8C, 0xF5, 0xDB, 0x24, 0x1F, 0x9B, 0x0D, 0x79, 0x45, 0x8C, 0x21, 0x3B,
+    0x4B, 0x72, 0xDC, 0x27, 0x39, 0xA3, 0xD8, 0x6C, 0xCE, 0x6E, 0x36, 0x9B, 0x03, 0xD8, 0x55, 0xDD,
+    0x35, 0x5A, 0x92, 0xFE, 0x27, 0x9A, 0x5C, 0x5E, 0xAB, 0xC9, 0xF0, 0x5A, 0x4D, 0xC6, 0x5D, 0x90,
+    0xEE, 0x13, 0xC4, 0x5D, 0xBE, 0xF0, 0x93, 0x67, 0xC8, 0xC5, 0xAE, 0x16, 0x34, 0xCE, 0x92, 0x09,
+    0x62, 0xC9, 0x5D, 0xBE, 0x82, 0xCC, 0x39, 0x99, 0x51, 0xBC, 0x3E, 0x42, 0x05, 0xA0, 0xAB, 0x7D,
+    0xF1, 0xF8, 0xAD, 0xF6, 0x4D, 0xD1, 0x7C, 0x58, 0x52, 0x34, 0x5C, 0x6E, 0x8F, 0xB7, 0xB2, 0x98,
+    0xBA, 0xE7, 0x04, 0x95, 0xFA, 0x11, 0xC6, 0xD3, 0x15, 0x7C, 0x8E, 0xAE, 0x88, 0x6A, 0x01, 0xFE,
+    0xAA, 0xDA, 0x75, 0xB6, 0xDE, 0x73, 0xE6, 0x62, 0x67, 0x33, 0xED, 0xDD, 0x0F, 0x9C, 0xDC, 0x59,
+    0x7F, 0x2C, 0x57, 0xAA, 0x82, 0x0A, 0x65, 0xFC, 0x1A, 0xE4, 0xC3, 0x3F, 0xD1, 0x6F, 0x1F, 0x00,
+    0x7E, 0xE7, 0xF7, 0x01, 0x14, 0xFE, 0xBB, 0x00, 0x1A, 0xFC, 0x04, 0x28, 0x66, 0xBC, 0x0E, 0xB4,
+    0x03, 0xEC, 0x95, 0xA3, 0x05, 0xE8, 0xC9, 0x0E, 0x78, 0x84, 0x87, 0xF8, 0x55, 0xD6, 0x37, 0xB6,
+    0x5D, 0x5E, 0xDE, 0xF4, 0x8E, 0x26, 0x20, 0xF0, 0x8D, 0x32, 0xE0, 0xDF, 0xA5, 0x27, 0xBC, 0xBD,
+    0xB8, 0xBA, 0x6B, 0x0A, 0x62, 0x0B, 0xD4, 0xA7, 0x03, 0x94, 0x32, 0xEF, 0x2F, 0x00, 0x7F, 0x34,
+    0x43, 0x07, 0xE3, 0x05, 0x39, 0xD1, 0x77, 0x09, 0xF8, 0x6F, 0x8A, 0x13, 0xC4, 0x7E, 0x3B, 0x95,
+    0xD1, 0xFA, 0x2A, 0x70, 0xAE, 0x03, 0x67, 0x3D, 0xF7, 0xBE, 0xF5, 0xCD, 0x60, 0x26, 0x21, 0x9B,
+    0x38, 0x00, 0xEC, 0x90, 0x27, 0x4E, 0x54, 0x99, 0x69, 0xD9, 0x09, 0xBD, 0x46, 0xE4, 0xA9, 0x15,
+    0x05, 0x01, 0x95, 0x24, 0x5B, 0x1D, 0xCA, 0x17, 0xF5, 0xAC, 0x43, 0xE3, 0xDB, 0x64, 0xA6, 0x36,
+    0xF5, 0xAE, 0x49, 0xD6, 0xE9, 0x90, 0x97, 0x94, 0x95, 0x5C, 0xE2, 0x15, 0x00, 0xF8, 0x4E, 0x41,
+    0xF2, 0x76, 0x87, 0x22, 0x88, 0x55, 0xD2, 0x5F, 0x9E, 0x5B, 0xDA, 0x24, 0x82, 0x57, 0x6F, 0x06,
+    0x3C, 0x4C, 0x92, 0xC3, 0x9F, 0x02, 0xD8, 0xB3, 0xBC, 0xB5, 0x93, 0xC2, 0xDE, 0xE5, 0x4B, 0x57,
+    0x90, 0x52, 0xE6, 0x83, 0xDF, 0x20, 0xD4, 0x0C, 0xF4, 0x30, 0x00, 0xBE, 0x55, 0x78, 0x00, 0xBF,
+    0xAF, 0x01, 0xE0, 0xBB, 0x0F, 0x40, 0x04, 0x6F, 0x01, 0x42, 0x69, 0xFE, 0x1B, 0xED, 0x5E, 0x2C,
+    0x17, 0x53, 0x4F, 0x7A, 0x09, 0xD6, 0xE9, 0x3B, 0x77, 0x82, 0x78, 0x1E, 0x15, 0x9E, 0xFD, 0xE4,
+    0xCF, 0x69, 0x06, 0x41, 0xEA, 0xD4, 0xE4, 0x02, 0x7B, 0xE9, 0xD2, 0xA2, 0x82, 0xD1, 0x5E, 0xB9,
+    0xA0, 0xE5, 0x59, 0xD0, 0x52, 0x9D, 0xDF, 0xCC, 0x40, 0xE6, 0x92, 0xA3, 0x2C, 0x81, 0x25, 0xC7,
+    0x4C, 0xA1, 0x3C, 0xF0, 0x19, 0x9D, 0xCC, 0x4C, 0xD9, 0x9A, 0x67, 0x5D, 0x95, 0x45, 0xDD, 0xF9,
+    0xD2, 0xE7, 0x75, 0xCC, 0x7A, 0x3E, 0xF1, 0x0A, 0xC5, 0x29, 0xA3, 0xA7, 0xFB, 0x0E, 0xCD, 0xDC,
+    0xFA, 0xD6, 0xB7, 0x1E, 0x74, 0x7C, 0x8E, 0xCF, 0x71, 0xA8, 0x43, 0x1D, 0x74, 0xD0, 0x01, 0x66,
+    0x32, 0x63, 0x3F, 0xF6, 0xAE, 0x64, 0x49, 0x95, 0x54, 0x82, 0xF6, 0xDA, 0x37, 0xBE, 0xF1, 0xB0,
+    0x83, 0xED, 0xD8, 0xB1, 0x53, 0x41, 0x85, 0x6A, 0xA9, 0x16, 0xB4, 0x63, 0xEB, 0x8C, 0x33, 0x0E,
+    0x09, 0x11, 0x51, 0x1C, 0xD9, 0xE2, 0x9B, 0x77, 0x79, 0x05, 0xCA, 0xBE, 0x8A, 0xB4, 0xC8, 0x52,
+    0x56, 0xF4, 0xC0, 0x2A, 0x3B, 0xE9, 0xBE, 0xE0, 0x00, 0x33, 0x13, 0x00, 0x95, 0x5A, 0x01, 0x3F,
+    0x5D, 0x16, 0x74, 0xC6, 0x1D, 0x51, 0x6E, 0xC5, 0xAC, 0xF5, 0x2D, 0x0F, 0x01, 0xE0, 0x37, 0xBF,
+    0xE0, 0x13, 0xCB, 0x88, 0x93, 0x1F, 0x94, 0x49, 0x74, 0x93, 0xEE, 0x72, 0x71, 0xD4, 0x77, 0x00,
+    0xF6, 0x3B, 0x00, 0xF8, 0xF7, 0x8D, 0x38, 0x35, 0xB9, 0x24, 0xE4, 0xE5, 0x4D, 0xF1, 0x78, 0x93,
+    0xEC, 0x0C, 0xA0, 0xE6, 0x93, 0x62, 0x6E, 0x3E, 0x7C, 0x03, 0x00, 0x8A, 0x5F, 0xF8, 0xF2, 0x6F,
+    0xAC, 0x52, 0xA4, 0x93, 0x7E, 0x02, 0xF2, 0xBB, 0xB3, 0xC1, 0xD6, 0xEA, 0x5D, 0x69, 0xFF, 0x8B,
+    0x56, 0x91, 0xED, 0x00, 0xD4, 0x73, 0x56, 0x64, 0xF7, 0xA2, 0xE7, 0xBC, 0x26, 0x10, 0x0F, 0xF1,
+    0xF4, 0xDF, 0x84, 0xE6, 0x70, 0xF5, 0x37, 0xCC, 0xE7, 0xD9, 0x27, 0xDE, 0xE0, 0x9B, 0xF1, 0xB3,
+    0x9F, 0x58, 0xFC, 0xB8, 0x09, 0xBC, 0xC9, 0x0F, 0xF9, 0x64, 0xD8, 0x11, 0x32, 0x75, 0x3A, 0xF6,
+    0xD3, 0x7A, 0xEC, 0xB2, 0x55, 0x62, 0x1F, 0xFE, 0xFC, 0x4F, 0x7D, 0xB0, 0x03, 0x1E, 0xAE, 0x08,
+    0xE8, 0xC8, 0x19, 0x05, 0xAF, 0x71, 0x40, 0x4B, 0x3B, 0xA3, 0xE0, 0xCF, 0x08, 0xE8, 0xB8, 0xDF,
+    0xED, 0x3A, 0xCF, 0x67, 0xFD, 0x1E, 0xEE, 0xEE, 0x7E, 0xF1, 0x89, 0x53, 0x71, 0xFE, 0x91, 0xD7,
+    0x18, 0xE1, 0x85, 0x32, 0x77, 0xF4, 0x0A, 0x8C, 0xDB, 0x7F, 0x11, 0x66, 0x51, 0xA1, 0xA4, 0xAB,
+    0xE8, 0x8C, 0x33, 0x11, 0x7D, 0x50, 0x41, 0x71, 0x54, 0x74, 0xC6, 0x99, 0x80, 0x76, 0x56, 0xA1,
+    0xE0, 0x80, 0x87, 0x60, 0x5C, 0xD1, 0x9D, 0x60, 0xFF, 0x4E, 0x3E, 0x6A, 0xB3, 0xD9, 0xD8, 0x2B,
+    0x9B, 0xCD, 0xD3, 0xD9, 0x33, 0x57, 0xD6, 0xF8, 0x7C, 0x98, 0x2F, 0x9F, 0xDD, 0x6E, 0x79, 0x75,
+    0xBB, 0x3D, 0xBC, 0xFF, 0xBD, 0xF8, 0x06, 0x8C, 0x43, 0x87, 0xC6, 0xAB, 0x50, 0xB0, 0x5B, 0xDF,
+    0x9B, 0x3F, 0x63, 0xFD, 0xAA, 0xFC, 0x91, 0x78, 0x1D, 0xC6, 0xD5, 0xD3, 0xA7, 0x3F, 0x43, 0x18,
+    0xD2, 0x8E, 0x17, 0xD9, 0x27, 0x7B, 0x8B, 0x6F, 0xFC, 0xF8, 0x78, 0x86, 0x7C, 0x9B, 0xEF, 0xF1,
+    0x28, 0xD9, 0x25, 0xF7, 0x42, 0x00, 0xC5, 0xA1, 0xF9, 0x98, 0x97, 0x69, 0x53, 0xEF, 0x4F, 0x63,
+    0xFF, 0x51, 0x5E, 0x62, 0x9F, 0xEC, 0xCC, 0xE1, 0x1B, 0x40, 0xFB, 0x53, 0x5E, 0xA6, 0x8D, 0xBD,
+    0xFF, 0x0F, 0x40, 0x71, 0xD0, 0x7F, 0xCC, 0xCB, 0x3C, 0x8A, 0x66, 0x7A, 0x08, 0xA8, 0x67, 0x7B,
+    0x9D, 0xD7, 0x78, 0x2E, 0x34, 0x87, 0x3D, 0x7F, 0x7A, 0xF4, 0xF2, 0xB1, 0xFC, 0xFA, 0xD4, 0x8D,
+    0xC7, 0xBF, 0xAE, 0x5C, 0xFE, 0x3F, 0xFF, 0x09, 0xDE, 0xC5, 0xAF, 0xFD, 0x09, 0xDE, 0xC5, 0xAF,
+    0xFD, 0xC7, 0xAF, 0x27, 0x49, 0x37, 0x7C, 0x93, 0x8B, 0x26, 0xEC, 0xA4, 0x02, 0xDA, 0xE1, 0xAB,
+    0x3F, 0x68, 0x95, 0xCB, 0x6B, 0x14, 0x33, 0x8C, 0xAB, 0x22, 0xE8, 0x5B, 0x9E, 0x67, 0xF8, 0x1A,
+    0x4F, 0x3B, 0x40, 0x3B, 0xD4, 0xFF, 0x67, 0x39, 0xFE, 0x4F, 0xBF, 0xA7, 0xDC, 0x0D, 0xAF, 0xC2,
+    0xD7, 0xFA, 0xB6, 0x7E, 0x2A, 0x8F, 0xF0, 0x4B, 0x6B, 0x85, 0x3C, 0x88, 0x15, 0x23, 0x48, 0xDF,
+    0x90, 0xE7, 0xA9, 0x83, 0x99, 0xFA, 0x0B, 0xB1, 0x8A, 0x66, 0x34, 0xEF, 0x44, 0x25, 0x87, 0x2A,
+    0x9A, 0xA9, 0x7F, 0x93, 0x3A, 0x88, 0x28, 0xDA, 0x97, 0x0C, 0xD8, 0xBF, 0x85, 0xB6, 0x79, 0x7F,
+    0x7E, 0x08, 0xFA, 0x9D, 0x39, 0x9A, 0x27, 0x77, 0x41, 0x27, 0xD3, 0xA9, 0x9D, 0x64, 0xB3, 0x92,
+    0x09, 0x36, 0x41, 0x5F, 0x9B, 0xD4, 0x27, 0x09, 0xAF, 0xB7, 0x93, 0x7E, 0x33, 0xA9, 0xB9, 0x9D,
+    0xFA, 0x57, 0xF9, 0xAA, 0x58, 0xD8, 0x7E, 0xB4, 0x39, 0x77, 0x03, 0x65, 0x12, 0xD6, 0x7C, 0x83,
+    0x87, 0xB7, 0x2F, 0xD7, 0x64, 0x49, 0xBA, 0xB4, 0x39, 0x30, 0x1D, 0xF4, 0x08, 0xC5, 0x5B, 0x20,
+    0xA7, 0x96, 0x11, 0xB0, 0x0E, 0xDA, 0x43, 0x85, 0x83, 0x82, 0xED, 0xFF, 0xC6, 0xE7, 0xC9, 0x37,
+    0x48, 0xB7, 0xFF, 0x0A, 0x80, 0x47, 0x08, 0x4D, 0xAF, 0x48, 0xF0, 0xCA, 0x41, 0xE3, 0x51, 0x26,
+    0xC0, 0xBC, 0xB5, 0xA8, 0xC4, 0xD9, 0x90, 0x17, 0xA2, 0x8A, 0xC6, 0x99, 0x77, 0x42, 0x19, 0xCD,
+    0x68, 0xDE, 0xE6, 0x8F, 0x42, 0x4D, 0x76, 0x2D, 0x47, 0xFC, 0xD6, 0x8B, 0xD8, 0x6E, 0xB7, 0x46,
+    0xBC, 0x29, 0x6C, 0x5F, 0x0D, 0x28, 0x12, 0xC0, 0x0E, 0xBD, 0x83, 0x19, 0xD1, 0x78, 0xE8, 0x05,
+    0x55, 0x80, 0x4A, 0x28, 0x08, 0xD0, 0xC1, 0x8C, 0x68, 0xFD, 0x8E, 0x0B, 0xAC, 0x53, 0x57, 0x33,
+    0x81, 0x9C, 0xDB, 0xA9, 0x7F, 0x33, 0xAA, 0xD0, 0x4C, 0xFD, 0xC0, 0x6B, 0x5E, 0x71, 0x81, 0xE1,
+    0xD8, 0x90, 0xE7, 0x63, 0x15, 0x8C, 0x6B, 0xDF, 0x09, 0x65, 0x34, 0x53, 0xFF, 0x06, 0xB9, 0xD4,
+    0x4C, 0xD8, 0xBF, 0xBD, 0x56, 0x7E, 0xCD, 0x58, 0x90, 0xDE, 0x4C, 0xF6, 0x7C, 0x50, 0xC1, 0xB8,
+    0xF6, 0x42, 0x50, 0xD1, 0x4C, 0xFD, 0x4F, 0xC9, 0xA8, 0x69, 0xDD, 0xC3, 0x7F, 0x1E, 0x80, 0x7E,
+    0x40, 0x33, 0x3F, 0x78, 0x44, 0x90, 0x4E, 0x73, 0xC2, 0xD1, 0x8B, 0xC0, 0x6B, 0x40, 0xC8, 0x7F,
+    0xCF, 0xF2, 0x65, 0xCB, 0x60, 0x19, 0x76, 0x31, 0x78, 0x0D, 0xCF, 0x6E, 0x73, 0xA4, 0xFC, 0x3D,
+    0xBB, 0x7D, 0x19, 0xC0, 0x66, 0x73, 0x36, 0xE7, 0x04, 0xCA, 0xA5, 0x71, 0xB1, 0xF2, 0xED, 0x10,
+    0x95, 0x6F, 0x9C, 0x2D, 0x43, 0x3D, 0xB5, 0xCE, 0x16, 0xA1, 0xF2, 0x7A, 0x34, 0x43, 0x8F, 0x58,
+    0x84, 0x72, 0x79, 0x1D, 0xB1, 0x08, 0x6A, 0xAE, 0x7D, 0xE3, 0x4C, 0x97, 0xCA, 0xA5, 0x9E, 0xDA,
+    0xE1, 0xF5, 0x72, 0xD1, 0x93, 0x79, 0x34, 0xD4, 0xDE, 0x3C, 0x1A, 0xF4, 0xF8, 0x3A, 0x80, 0x4E,
+    0x7D, 0xCC, 0xD1, 0x58, 0x9E, 0xE1, 0x5F, 0x04, 0xE3, 0xCC, 0x85, 0xA5, 0x0C, 0x66, 0x68, 0x2F,
+    0xCC, 0x65, 0x30, 0xDD, 0x3D, 0x87, 0x75, 0xEE, 0xFA, 0x1A, 0x1D, 0x0F, 0x0F, 0x1F, 0xD6, 0x51,
+    0xF1, 0x6D, 0xC6, 0x9E, 0xEF, 0xDC, 0x8E, 0xFF, 0xAA, 0x1D, 0x55, 0x84, 0xB9, 0x4F, 0x20, 0xE8,
+    0xE6, 0x73, 0x8B, 0xE8, 0x4A, 0x83, 0xFE, 0x90, 0x8F, 0x3A, 0x33, 0x42, 0xCF, 0xB9, 0x4D, 0x15,
+    0xD7, 0xBF, 0x04, 0xC5, 0xCD, 0x19, 0x21, 0x85, 0x0D, 0xF9, 0x37, 0x9B, 0xCD, 0x41, 0x61, 0x3F,
+    0x28, 0xC4, 0xB2, 0x0E, 0xB7, 0x9A, 0x05, 0xE8, 0x07, 0xD4, 0x33, 0x9E, 0x22, 0xB4, 0xC8, 0x0A,
+    0x1E, 0xB4, 0x33, 0xD0, 0x3B, 0xA8, 0xF0, 0x3B, 0xE8, 0x2F, 0xA4, 0xA3, 0x60, 0xC8, 0xC7, 0xC8,
+    0xB1, 0xD8, 0x1E, 0xFE, 0xFF, 0x63, 0xE0, 0xFF, 0x73, 0x63, 0x40, 0x7A, 0x8B, 0x33, 0x47, 0xF3,
+    0x03, 0x20, 0x60, 0xDC, 0x39, 0x7A, 0x32, 0xD8, 0x8E, 0xC6, 0x99, 0x4B, 0xBE, 0xB9, 0x4E, 0x1B,
+    0x0C, 0x4D, 0x79, 0x6B, 0x7F, 0x28, 0xEC, 0xA1, 0x62, 0x52, 0xE9, 0xE8, 0xEF, 0x52, 0x11, 0x2C,
+    0x8C, 0x78, 0x5F, 0xB9, 0x19, 0x37, 0x67, 0x2D, 0xD0, 0x78, 0x3C, 0xC6, 0x6B, 0x53, 0xCB, 0x05,
+    0x47, 0x1F, 0xA0, 0xB0, 0x87, 0x20, 0x9D, 0xB9, 0xC3, 0x6A, 0xA9, 0x66, 0x0B, 0x73, 0xC9, 0x97,
+    0x81, 0x68, 0x2F, 0x79, 0x15, 0x2C, 0xCC, 0x85, 0xA5, 0x9E, 0x5B, 0x12, 0x96, 0x0E, 0x47, 0x87,
+    0x78, 0xB6, 0x7B, 0xF8, 0xCF, 0xA3, 0x0A, 0xDA, 0x13, 0xFD, 0x8F, 0xC6, 0x92, 0x01, 0x9A, 0xD2,
+    0x0D, 0xD9, 0x29, 0x06, 0xD8, 0x27, 0xA7, 0x66, 0xB2, 0x67, 0x82, 0x0A, 0xCF, 0x76, 0x0F, 0x1E,
+    0x3E, 0x92, 0x3A, 0xCD, 0xA8, 0xAE, 0x72, 0xEC, 0xAA, 0x00, 0xD8, 0x53, 0x9B, 0x73, 0x97, 0xC9,
+    0x9B, 0x64, 0x4C, 0xB0, 0xAD, 0x33, 0x17, 0x92, 0x75, 0x86, 0x63, 0xF1, 0x7A, 0x87, 0xD3, 0x80,
+    0x9A, 0x01, 0xD3, 0x1D, 0x1F, 0xEC, 0x60, 0x2C, 0x15, 0xB9, 0x98, 0xD1, 0x5C, 0x08, 0x9F, 0x3D,
+    0xDC, 0xDF, 0x7C, 0xA9, 0x78, 0xF9, 0x74, 0x07, 0x24, 0x40, 0x2D, 0x82, 0x7E, 0x30, 0x03, 0x90,
+    0xF0, 0xEC, 0x99, 0xA5, 0x5E, 0xF4, 0x64, 0x07, 0xF3, 0x83, 0x05, 0xB1, 0x1F, 0xD4, 0x9D, 0x00,
+    0x4D, 0x0F, 0x43, 0x0F, 0x6A, 0xAF, 0x96, 0x66, 0xD2, 0x53, 0x3B, 0x9A, 0xC1, 0xB8, 0x57, 0x70,
+    0x7A, 0x38, 0x7D, 0xCF, 0x3A, 0xF3, 0xE4, 0x3B, 0x73, 0x34, 0xFF, 0xED, 0xE1, 0xE9, 0x7A, 0xA9,
+    0x17, 0x75, 0x93, 0x37, 0xE9, 0xC5, 0xDD, 0x79, 0xAC, 0x92, 0x0A, 0xC6, 0x19, 0xD7, 0x5E, 0x58,
+    0x54, 0x28, 0x83, 0xE9, 0xCC, 0xD0, 0x5E, 0x98, 0xD5, 0xF2, 0x59, 0xA7, 0xA7, 0xBB, 0xD3, 0xDD,
+    0xC3, 0xC3, 0xE9, 0x7A, 0x51, 0xF2, 0x8C, 0xF3, 0x51, 0xBA, 0xE0, 0x72, 0x9F, 0xC2, 0x5C, 0x98,
+    0xCB, 0x20, 0xB9, 0x67, 0x75, 0x93, 0x93, 0x21, 0xCF, 0x84, 0x2A, 0x98, 0xC1, 0xAC, 0xB9, 0x97,
+    0x32, 0x18, 0x67, 0x2E, 0xC4, 0x2A, 0x18, 0xF2, 0xCC, 0x1D, 0x8E, 0xE6, 0x89, 0xE9, 0xDE, 0x9A,
+    0x03, 0xF6, 0x53, 0x47, 0x5E, 0xBC, 0xFD, 0x13, 0x33, 0x80, 0x87, 0x05, 0x67, 0x30, 0xA0, 0x0D,
+    0xA8, 0x3F, 0x42, 0x73, 0xE9, 0x0E, 0x0D, 0xFD, 0x6F, 0xDD, 0x02, 0x0E, 0xD0, 0x42, 0x79, 0xD8,
+    0x57, 0x7A, 0xFE, 0x8C, 0xA9, 0xF6, 0xB0, 0xB8, 0x2B, 0xE8, 0xA9, 0xE8, 0xAB, 0x5B, 0xAB, 0x4C,
+    0xF4, 0xD6, 0xB1, 0x39, 0x9C, 0x97, 0x4D, 0x65, 0x14, 0xAF, 0xFC, 0x8F, 0xEB, 0x8E, 0x25, 0xD3,
+    0x6A, 0xFA, 0xAC, 0x43, 0xB9, 0xDD, 0xFE, 0x39, 0x0B, 0x72, 0xA1, 0xEB, 0x99, 0x8C, 0x6F, 0xC8,
+    0x17, 0x62, 0xC5, 0xED, 0x9F, 0xF3, 0x39, 0x0E, 0xB0, 0x73, 0x3F, 0x41, 0x93, 0x69, 0x5B, 0x72,
+    0x07, 0xD9, 0x14, 0xCF, 0x25, 0xC5, 0xB9, 0xB4, 0xCD, 0xEE, 0xC1, 0xC4, 0x19, 0x51, 0x7F, 0xE3,
+    0x2C, 0xD0, 0xC8, 0x46, 0x76, 0xE2, 0x8F, 0x6A, 0x01, 0x7A, 0x26, 0xA0, 0x38, 0x78, 0x08, 0x80,
+    0xA9, 0x46, 0x40, 0x4D, 0xAF, 0x01, 0x85, 0x3D, 0x72, 0xA8, 0xC8, 0xD4, 0x29, 0xE6, 0x3D, 0x4B,
+    0xD8, 0x19, 0x26, 0x7A, 0xCD, 0x6B, 0x67, 0x58, 0xF0, 0xA3, 0xF9, 0x5B, 0x30, 0xB1, 0x55, 0xA3,
+    0xE2, 0x79, 0xFF, 0x5D, 0xF4, 0xF3, 0xB7, 0x6A, 0x57, 0x53, 0x8D, 0x01, 0xD6, 0x7F, 0x4F, 0x0F,
+    0x35, 0xEB, 0x37, 0x66, 0x58, 0x1F, 0x1A, 0xD4, 0xD4, 0xDF, 0xF7, 0xB0, 0x7E, 0x36, 0xA8, 0xF8,
+    0x23, 0x35, 0xC1, 0x24, 0xFF, 0x3D, 0x94, 0x64, 0xE5, 0xD0, 0x70, 0x7A, 0x6D, 0x0F, 0x96, 0x3F,
+    0xFA, 0x70, 0x12, 0x97, 0xC2, 0x9A, 0xE4, 0x84, 0x26, 0x5B, 0x11, 0xA7, 0x0E, 0xCD, 0x19, 0x0F,
+    0x14, 0xFE, 0x5B, 0x00, 0xDA, 0x6A, 0xBC, 0xD7, 0xF0, 0xEC, 0x50, 0x8C, 0x09, 0x7B, 0x32, 0x14,
+    0x02, 0xBC, 0xBB, 0xF5, 0xF4, 0x5C, 0xD3, 0xE1, 0x5F, 0x6B, 0xAE, 0xEC, 0xAB, 0x09, 0x2B, 0x8E,
+    0xB1, 0x9F, 0xF7, 0xBA, 0xEF, 0x58, 0xAF, 0xDF, 0x89, 0xD6, 0xEB, 0x9F, 0x05, 0xEB, 0x35, 0x8F,
+    0x03, 0x58, 0xAF, 0x23, 0xFA, 0x59, 0x07, 0x98, 0x45, 0x07, 0x98, 0xA0, 0x03, 0xDA, 0xA4, 0x03,
+    0x34, 0x9F, 0x0C, 0x0F, 0xD4, 0x64, 0x7C, 0x4D, 0x71, 0x7D, 0x11, 0x0C, 0x05, 0x0C, 0x3A, 0x02,
+    0x7B, 0x07, 0xE2, 0xC3, 0xA5, 0xBC, 0x6F, 0xE0, 0x32, 0xCE, 0xF5, 0xFE, 0x41, 0x46, 0xD6, 0xDE,
+    0x15, 0x5C, 0xDD, 0xBE, 0x7C, 0x4F, 0xBE, 0x3E, 0x5B, 0x48, 0xE5, 0xE0, 0x33, 0x9F, 0xB7, 0xAB,
+    0x97, 0x41, 0x44, 0x18, 0x2D, 0x39, 0xA3, 0x27, 0x3D, 0x18, 0x9F, 0x9E, 0x40, 0x8F, 0x4E, 0x9C,
+    0x28, 0xEE, 0x82, 0xDF, 0xE0, 0x95, 0x0D, 0x7A, 0x92, 0xBB, 0x40, 0x5C, 0xB6, 0x8A, 0x71, 0xFB,
+    0x5D, 0x09, 0x22, 0x72, 0x16, 0xD6, 0x56, 0xF6, 0x05, 0x48, 0xD9, 0xCB, 0x6C, 0xB2, 0xF7, 0x09,
+    0x84, 0xAD, 0xDD, 0x59, 0x81, 0x65, 0x23, 0xDD, 0x63, 0xE5, 0xDC, 0xA9, 0xEE, 0x91, 0x5B, 0x55,
+    0xBA, 0x8D, 0xFE, 0x6D, 0xF2, 0x12, 0x39, 0xF5, 0x3F, 0x13, 0x87, 0x33, 0x7D, 0xC6, 0xE1, 0xF5,
+    0xBC, 0x43, 0xDE, 0x66, 0xEA, 0x89, 0x9E, 0x43, 0x9B, 0xFA, 0x00, 0x43, 0xD9, 0x08, 0xB2, 0x4D,
+    0xB2, 0xEF, 0x44, 0x1B, 0x51, 0x53, 0x14, 0xDD, 0xF7, 0x3D, 0x9A, 0x7C, 0xEC, 0xF3, 0x91, 0x72,
+    0x2C, 0xF2, 0x51, 0xE5, 0x63, 0x95, 0x8F, 0x3A, 0x1F, 0x9B, 0x7C, 0x6C, 0xAF, 0x05, 0xD9, 0x9E,
+    0x2B, 0x03, 0x49, 0xEE, 0x29, 0x4C, 0x19, 0xEE, 0xF6, 0x95, 0xC1, 0x4E, 0x2D, 0xE8, 0x03, 0x8C,
+    0xAB, 0xE8, 0x54, 0x40, 0x1F, 0x61, 0x5C, 0x45, 0xAF, 0x02, 0x7A, 0xC2, 0xB8, 0xEA, 0xCE, 0xAC,
+    0x02, 0xFA, 0x7E, 0x30, 0xAE, 0xFA, 0x24, 0xA8, 0xB0, 0x6F, 0xAF, 0x5D, 0xB5, 0xFF, 0x60, 0x77,
+    0x4A, 0xBD, 0xF0, 0xC8, 0x2D, 0xFB, 0xED, 0xD8, 0xF5, 0xE7, 0x67, 0xE3, 0xAA, 0xC5, 0x5C, 0x10,
+    0x21, 0x99, 0x00, 0x13, 0xFF, 0x6F, 0x5E, 0x25, 0xFF, 0xA1, 0x5A, 0xEA, 0xEB, 0x01, 0xFD, 0xD0,
+    0xF7, 0xAE, 0x5A, 0xD4, 0x9D, 0x80, 0x7E, 0x68, 0xE9, 0xAA, 0xA5, 0x60, 0x40, 0x3F, 0x68, 0xBA,
+    0x6A, 0x01, 0x03, 0xFA, 0xA1, 0xA2, 0xAB, 0x16, 0x98, 0x00, 0xC3, 0x9F, 0xAF, 0x4A, 0xCE, 0x21,
+    0x43, 0x05, 0xC7, 0xAC, 0xE9, 0x74, 0x59, 0x65, 0xEC, 0x00, 0x70, 0x6C, 0xC4, 0xAB, 0x77, 0x27,
+    0x4E, 0x03, 0x22, 0xCC, 0xA2, 0xBC, 0x98, 0xE2, 0xB4, 0x0E, 0x1C, 0x15, 0x07, 0x8A, 0x19, 0x5C,
+    0x15, 0xA0, 0x23, 0xEC, 0xDC, 0xDE, 0x38, 0x6B, 0xE6, 0x86, 0x6F, 0x89, 0x37, 0xF7, 0x64, 0xC9,
+    0x0B, 0xD9, 0xB3, 0x81, 0x26, 0xD3, 0x5E, 0x7F, 0xE3, 0xAC, 0x21, 0x0F, 0x41, 0x07, 0xFE, 0xFC,
+    0x40, 0x68, 0xB6, 0x0E, 0xD0, 0xAB, 0xAB, 0x22, 0x2F, 0x93, 0x9B, 0xB8, 0x0C, 0x3E, 0x4E, 0x8E,
+    0x39, 0x99, 0x41, 0xDC, 0x3E, 0xD0, 0x4B, 0x4F, 0x15, 0x37, 0x2B, 0x58, 0xB7, 0xD8, 0x3A, 0xB5,
+    0x2B, 0xD8, 0xEA, 0x33, 0xD8, 0x70, 0xF5, 0x66, 0x26, 0x8E, 0xCC, 0x4C, 0x56, 0xE5, 0x1A, 0xDF,
+    0xE4, 0x63, 0xC5, 0xEE, 0xC1, 0xD4, 0x19, 0xAF, 0xD8, 0x59, 0x2E, 0xC6, 0x2B, 0x3E, 0x46, 0x39,
+    0x3E, 0x4E, 0xCE, 0xC6, 0x57, 0xAC, 0xF9, 0x94, 0x37, 0xBE, 0xA1, 0x8E, 0xF8, 0x86, 0x21, 0xA3,
+    0x16, 0x77, 0xAC, 0x73, 0xCD, 0x0E, 0x86, 0x1C, 0x2B, 0x71, 0xE5, 0xE8, 0x14, 0x13, 0xCC, 0x1D,
+    0x71, 0xEE, 0x67, 0x3C, 0x27, 0x34, 0xF4, 0x46, 0x9C, 0xEF, 0x06, 0xE3, 0xCD, 0x02, 0xF4, 0xC1,
+    0xF8, 0x36, 0x00, 0x3A, 0x18, 0x2F, 0x96, 0x58, 0xC6, 0x6B, 0x3E, 0xD8, 0xE9, 0x60, 0x7C, 0xC5,
+    0x27, 0x6F, 0xDB, 0xC5, 0x78, 0xC5, 0x4B, 0xE4, 0x6C, 0x7C, 0xC9, 0xCB, 0xE4, 0x68, 0x3C, 0xF8,
+    0xB3, 0xBC, 0xA1, 0x18, 0xF6, 0x0E, 0x60, 0x5C, 0xC9, 0xAE, 0x5A, 0xCC, 0xA8, 0xD8, 0xD5, 0x8B,
+    0x19, 0x15, 0x07, 0xBD, 0x98, 0x49, 0xD1, 0xE9, 0xB9, 0x9D, 0x2A, 0x3A, 0xED, 0x1B, 0x5F, 0xD1,
+    0x35, 0xBE, 0xF1, 0xF5, 0xB5, 0xB1, 0xF1, 0xDA, 0xEB, 0xCB, 0x63, 0x3B, 0xE9, 0x59, 0xBF, 0x37,
+    0xB5, 0x93, 0x9E, 0xF5, 0x45, 0x6F, 0xC6, 0x7A, 0x69, 0xDE, 0xF2, 0xC6, 0xE5, 0x83, 0x3D, 0x89,
+    0x74, 0x8D, 0xF9, 0xA0, 0x82, 0x39, 0x13, 0x6C, 0x57, 0xC6, 0xFE, 0xB1, 0x60, 0xBB, 0x22, 0xF6,
+    0x45, 0x20, 0x8A, 0x64, 0x8B, 0x40, 0x20, 0x59, 0x44, 0x02, 0x4C, 0x48, 0x09, 0x60, 0x04, 0x23,
+    0x60, 0xC5, 0x01, 0x74, 0x2F, 0xBA, 0xB3, 0x7C, 0x30, 0x61, 0x35, 0x18, 0x31, 0x0B, 0x2C, 0xF9,
+    0x12, 0x4A, 0xE6, 0x6D, 0xED, 0x2E, 0x8B, 0xC6, 0xFA, 0x26, 0x49, 0xFA, 0x3A, 0x72, 0x2C, 0x6C,
+    0x2C, 0xD9, 0x8B, 0x47, 0xE4, 0xCB, 0x01, 0x30, 0xBE, 0xBD, 0x49, 0xC5, 0x3A, 0xD6, 0x91, 0x8E,
+    0x6F, 0xF0, 0x31, 0xF6, 0xDE, 0xF8, 0x7E, 0xB2, 0x97, 0x83, 0x0E, 0xCD, 0xD2, 0xDE, 0xA4, 0x62,
+    0x95, 0x72, 0xE2, 0xF7, 0xBF, 0x4C, 0xE2, 0x75, 0x2A, 0x56, 0x49, 0x07, 0x3A, 0x3A, 0x54, 0x34,
+    0xDE, 0x78, 0x28, 0xBE, 0x10, 0xB4, 0xEC, 0xE3, 0x23, 0x7B, 0xA0, 0xD1, 0x89, 0x00, 0xDA, 0x1B,
+    0x92, 0x93, 0x0E, 0x9A, 0x62, 0x85, 0x8D, 0xFD, 0x57, 0x8E, 0x3D, 0xAB, 0x5B, 0x0F, 0x3C, 0xF8,
+    0x2A, 0x7F, 0x0E, 0xF4, 0x64, 0xC8, 0xD6, 0xCE, 0xD5, 0xEA, 0xEE, 0x6B, 0xDD, 0xDB, 0xEF, 0xE1,
+    0x17, 0xDB, 0x80, 0x9A, 0x8B, 0xF5, 0xB0, 0x4C, 0x74, 0xF5, 0x6E, 0xE3, 0xB0, 0x50, 0x72, 0xA9,
+    0xE8, 0x35, 0x9D, 0xA2, 0x33, 0x51, 0xF6, 0x0E, 0x42, 0x1B, 0x14, 0x1D, 0x7A, 0xAF, 0x99, 0x6D,
+    0xE0, 0x2A, 0x82, 0x1E, 0x4D, 0x50, 0x1C, 0x61, 0x73, 0xEE, 0x86, 0x63, 0x9F, 0x1F, 0x82, 0x9E,
+    0xA4, 0x87, 0xE5, 0x47, 0x74, 0xE8, 0x93, 0xE2, 0xA7, 0x81, 0x74, 0xC5, 0x76, 0xBB, 0x7D, 0x19,
+    0x35, 0xB3, 0xA9, 0x13, 0x1D, 0xB2, 0xDA, 0xA2, 0xCF, 0x76, 0x4F, 0x93, 0x6C, 0x1A, 0xDB, 0xF3,
+    0xD5, 0x00, 0x93, 0xB0, 0x97, 0x1D, 0x07, 0x71, 0x75, 0x84, 0xFA, 0x1B, 0xBC, 0xB2, 0x39, 0x56,
+    0xE7, 0x2D, 0xB0, 0x77, 0x9B, 0x6F, 0xA8, 0xD5, 0xD9, 0xC8, 0x9C, 0xC7, 0x5A, 0x3F, 0xDF, 0x63,
+    0x81, 0x26, 0x90, 0x9E, 0x5B, 0x4F, 0x3B, 0xAC, 0xFB, 0x33, 0x06, 0xC0, 0x92, 0xC0, 0x3E, 0x39,
+    0x00, 0xC5, 0x59, 0x54, 0x44, 0x49, 0xD7, 0xCF, 0x30, 0x4B, 0xC5, 0xAE, 0x26, 0xFA, 0xB9, 0xE0,
+    0x58, 0xB1, 0x33, 0x0B, 0xFA, 0xB9, 0xA2, 0xF8, 0xFA, 0x41, 0x3F, 0xB7, 0x01, 0x15, 0xCF, 0x10,
+    0xE8, 0x67, 0x4E, 0xA8, 0xF8, 0x4C, 0x00, 0xFA, 0x9B, 0x14, 0x17, 0xD8, 0xE2, 0xDB, 0xCC, 0x5B,
+    0x92, 0xDC, 0x27, 0x79, 0xF5, 0xB0, 0xE2, 0xA5, 0x28, 0x7E, 0x6F, 0x50, 0xF1, 0x0C, 0x07, 0xF4,
+    0x73, 0x13, 0x50, 0xB1, 0xA3, 0x17, 0xF3, 0xC9, 0x8A, 0x9D, 0x09, 0xBB, 0xB7, 0x69, 0xA2, 0x9F,
+    0x65, 0x3F, 0x24, 0x25, 0x4E, 0x68, 0xF8, 0x23, 0x92, 0xFC, 0xD9, 0x09, 0xF3, 0x6D, 0xB1, 0x23,
+    0xCF, 0x5B, 0x9B, 0x3D, 0x00, 0x28, 0xBE, 0xE0, 0xB2, 0x49, 0x5E, 0x36, 0x3F, 0x59, 0x9D, 0xDC,
+    0x15, 0xB2, 0x69, 0xCE, 0xF2, 0x3B, 0xA8, 0x98, 0xFA, 0xDC, 0x39, 0x16, 0x72, 0xC0, 0x43, 0x86,
+    0x6B, 0x1D, 0xD5, 0x1C, 0x80, 0x86, 0x53, 0xDE, 0xFE, 0xB9, 0x65, 0x02, 0xD4, 0x3B, 0x1C, 0x80,
+    0xEE, 0x9E, 0x3D, 0xD4, 0x76, 0xBF, 0x73, 0x59, 0x17, 0xA2, 0xB2, 0xDF, 0x6A, 0x64, 0x8F, 0x52,
+    0xD9, 0xA5, 0x41, 0x04, 0x00, 0x75, 0x7B, 0x63, 0x85, 0x00, 0x38, 0xC8, 0xC6, 0x0D, 0xC0, 0xE6,
+    0x20, 0x9B, 0x63, 0xC8, 0x76, 0xEE, 0x62, 0x06, 0x61, 0xB2, 0x37, 0xBC, 0xEC, 0x30, 0xBA, 0xA4,
+    0xCB, 0xA2, 0x6A, 0x4E, 0x59, 0xE6, 0x6F, 0xE6, 0xEC, 0x1E, 0x57, 0x87, 0x2C, 0x49, 0x97, 0xD6,
+    0xDA, 0xBF, 0x9D, 0x37, 0x9A, 0x69, 0xB8, 0x88, 0x17, 0xEC, 0x96, 0x1C, 0xCC, 0x8C, 0x36, 0x36,
+    0xC9, 0xFA, 0x26, 0x40, 0x53, 0x07, 0x95, 0x6A, 0x42, 0xF3, 0x4C, 0x84, 0xFD, 0x3E, 0x07, 0xCD,
+    0x37, 0x89, 0x76, 0xE2, 0xD8, 0xD0, 0xD1, 0xD5, 0x8B, 0xB9, 0x6D, 0x39, 0x9A, 0x49, 0xC5, 0x86,
+    0xE4, 0xA8, 0x63, 0x25, 0x36, 0xDB, 0x15, 0xC9, 0x33, 0xAB, 0x97, 0xC8, 0x81, 0xFC, 0x07, 0x20,
+    0xCB, 0xBE, 0x01, 0x33, 0x9D, 0xBD, 0xDB, 0xCD, 0xE6, 0x31, 0xDC, 0xE7, 0x18, 0xFF, 0x79, 0xBC,
+    0x81, 0xE5, 0x0A, 0xB8, 0xD8, 0xE5, 0xAE, 0x3F, 0x9D, 0x7B, 0xB5, 0x56, 0x56, 0x5C, 0x6D, 0x25,
+    0xC4, 0x71, 0x84, 0x9D, 0x39, 0xC2, 0x2C, 0xCD, 0x02, 0x1D, 0x55, 0x82, 0x62, 0xC7, 0x01, 0x9C,
+    0xFA, 0x11, 0x26, 0xB4, 0x33, 0x6A, 0x31, 0xFD, 0x7C, 0x3F, 0x01, 0x26, 0xB1, 0xCB, 0x96, 0x40,
+    0x79, 0x5F, 0xC4, 0x09, 0x0F, 0x28, 0x7A, 0xA8, 0xC1, 0x04, 0x14, 0x5E, 0xB3, 0x43, 0xD2, 0xF4,
+    0xE8, 0xDF, 0x62, 0x84, 0xB9, 0x43, 0xBA, 0x96, 0xD1, 0xCE, 0xFA, 0x5A, 0xD2, 0xA9, 0xFE, 0x88,
+    0x8A, 0x17, 0x96, 0x76, 0xE8, 0x3F, 0x09, 0xCA, 0xE9, 0x04, 0x1C, 0xE4, 0xFD, 0xF2, 0x76, 0xD6,
+    0x51, 0x3A, 0x01, 0xC5, 0xD3, 0x1C, 0xB2, 0x11, 0xAB, 0x11, 0x13, 0x99, 0x49, 0xAC, 0xA5, 0x2B,
+    0xA6, 0x43, 0xC8, 0x48, 0xAE, 0x57, 0x47, 0x3B, 0x44, 0xCD, 0xA7, 0xB8, 0x88, 0x27, 0x79, 0x4B,
+    0x92, 0x97, 0x48, 0x32, 0x1C, 0x71, 0x7B, 0xC4, 0xC1, 0x7A, 0x81, 0xD0, 0xE9, 0x28, 0x24, 0x05,
+    0x8F, 0x69, 0x8E, 0x9A, 0x30, 0x0B, 0xEC, 0x8D, 0x73, 0x44, 0xCD, 0x3C, 0x39, 0x2C, 0xA8, 0xC9,
+    0x08, 0x58, 0xFE, 0x7C, 0x75, 0x2C, 0x9E, 0xF5, 0x12, 0x9F, 0x7D, 0x0A, 0x88, 0x0F, 0x30, 0x3D,
+    0x02, 0xE2, 0x1F, 0xB0, 0xD8, 0x39, 0xFC, 0x9C, 0x76, 0x4E, 0x02, 0x8E, 0x42, 0xC9, 0x18, 0x8B,
+    0xC3, 0x86, 0xE7, 0x67, 0xC0, 0x06, 0x3D, 0x42, 0xD1, 0x99, 0x0E, 0x0D, 0x11, 0x01, 0x3B, 0xAB,
+    0x19, 0x25, 0x9D, 0x1E, 0xA1, 0x09, 0x43, 0x9A, 0x00, 0x32, 0xD0, 0x2B, 0xF2, 0x3A, 0x9D, 0x26,
+    0x2F, 0xB2, 0x33, 0xD7, 0xD8, 0x26, 0xC4, 0x26, 0xF4, 0x41, 0xCD, 0xBD, 0xE7, 0xAC, 0xDF, 0xE6,
+    0x9B, 0xF4, 0xE6, 0x71, 0x2A, 0xFA, 0xD8, 0x84, 0x9A, 0x77, 0x6E, 0x67, 0x93, 0x17, 0x27, 0x88,
+    0xAE, 0x7A, 0xDD, 0xAB, 0x2A, 0x75, 0x79, 0xD3, 0x46, 0x98, 0x0E, 0x00, 0x84, 0x52, 0x88, 0x32,
+    0x92, 0x06, 0x20, 0xEF, 0x73, 0xAE, 0xF2, 0x9E, 0xCA, 0x62, 0x7C, 0x26, 0x36, 0x49, 0x77, 0x22,
+    0x80, 0xE6, 0x96, 0x38, 0x8A, 0x37, 0x1E, 0x50, 0xAC, 0xA3, 0x78, 0x1D, 0xE3, 0xC7, 0x27, 0xD7,
+    0x55, 0x34, 0xA1, 0x10, 0x77, 0xEE, 0xC6, 0xE3, 0xDB, 0xFC, 0xE1, 0x33, 0xE9, 0xAC, 0xE5, 0x6E,
+    0x97, 0x1D, 0xFE, 0x8D, 0xBD, 0xB5, 0x79, 0x86, 0x07, 0x4D, 0x80, 0x58, 0x72, 0xA3, 0xF7, 0x8A,
+    0x5D, 0xF6, 0x46, 0x59, 0xD2, 0xF1, 0xD8, 0xB0, 0x39, 0x35, 0x01, 0x50, 0xBC, 0xC4, 0x93, 0x9B,
+    0x63, 0x59, 0x1E, 0x62, 0x9F, 0xE4, 0x20, 0x14, 0xB9, 0xCC, 0x09, 0x6D, 0x3A, 0xA2, 0xC3, 0x07,
+    0x59, 0x5B, 0x27, 0x14, 0x9E, 0x14, 0x61, 0x7C, 0x76, 0xBB, 0xB5, 0xE9, 0xF9, 0xE3, 0xEF, 0x7B,
+    0x63, 0x63, 0x19, 0xCF, 0x8A, 0x4D, 0x99, 0xE6, 0x3A, 0x91, 0x4A, 0x5F, 0x38, 0xC7, 0xAB, 0xDB,
+    0xED, 0xF0, 0xA9, 0x5D, 0xFC, 0x08, 0x7C, 0x13, 0x36, 0x6D, 0xEC, 0xA8, 0xC4, 0xA2, 0x72, 0xF5,
+    0xDD, 0x1D, 0x00, 0xD1, 0xD3, 0x8A, 0xD0, 0x4E, 0x3A, 0x40, 0x9E, 0xFD, 0x81, 0x36, 0xB3, 0x2B,
+    0xEC, 0xFA, 0xD5, 0xC5, 0xD7, 0x68, 0xF8, 0xE4, 0xDB, 0xBE, 0xA1, 0x9A, 0xA1, 0xD9, 0x45, 0x69,
+    0xFB, 0x82, 0x93, 0x1E, 0xA5, 0xE9, 0xDB, 0x80, 0x08, 0x4D, 0x98, 0x4E, 0xD1, 0xE9, 0x11, 0xF4,
+    0x6A, 0x86, 0x09, 0x88, 0xA8, 0xD9, 0x99, 0xAE, 0xE4, 0xA8, 0x47, 0xF4, 0x41, 0xCD, 0xD0, 0x44,
+    0x44, 0x49, 0x6F, 0x3A, 0x98, 0xA4, 0xC7, 0x87, 0x6A, 0xDE, 0xB9, 0x9D, 0x64, 0x4F, 0x01, 0x7D,
+    0xDC, 0x8D, 0xC5, 0xE1, 0x87, 0x30, 0x1D, 0xA6, 0xCB, 0xBD, 0xB3, 0x75, 0x65, 0x00, 0xB4, 0x07,
+    0x81, 0x2A, 0xC0, 0x3A, 0x94, 0x84, 0xF1, 0x28, 0x78, 0xE5, 0x5C, 0xDC, 0x3C, 0x46, 0x92, 0x7C,
+    0x5F, 0x58, 0x11, 0x51, 0x0C, 0xFD, 0x16, 0xEF, 0x30, 0x6D, 0xBB, 0xDE, 0xD7, 0x04, 0x9A, 0x20,
+    0x4E, 0x57, 0xB3, 0x6B, 0xCF, 0x36, 0x00, 0x5F, 0x32, 0x81, 0xC5, 0xD0, 0xFB, 0x8A, 0xF4, 0x4D,
+    0x00, 0x19, 0x2A, 0x42, 0x93, 0x05, 0x5D, 0x36, 0xBC, 0x3B, 0x69, 0x41, 0x5B, 0xD8, 0x24, 0x9B,
+    0x19, 0x66, 0x5E, 0x2C, 0xAE, 0x94, 0x7B, 0xC9, 0xDB, 0x47, 0x0B, 0x60, 0x02, 0x1E, 0xD9, 0xB9,
+    0x2F, 0x37, 0xF3, 0x09, 0xB7, 0xCB, 0xA2, 0x8D, 0x2C, 0xF3, 0x26, 0x75, 0xCC, 0x80, 0xB9, 0xDC,
+    0xAD, 0x4F, 0x6C, 0x49, 0x9B, 0xAD, 0xDD, 0x73, 0x46, 0xC5, 0xE9, 0x3B, 0x0F, 0x1E, 0xFE, 0x91,
+    0xA6, 0xB9, 0xC9, 0x6B, 0xC1, 0x5C, 0xBF, 0x76, 0x9B, 0x47, 0xEF, 0xF0, 0x77, 0x63, 0x3D, 0x7D,
+    0xCF, 0xBC, 0x7F, 0xCD, 0x7D, 0x4F, 0xFD, 0x2C, 0x36, 0xB1, 0x1A, 0x0D, 0x9D, 0x61, 0x7A, 0x9A,
+    0x3E, 0x6F, 0x17, 0x5B, 0xBF, 0x47, 0xDE, 0x02, 0x5E, 0xAB, 0xAE, 0xBC, 0x0E, 0xD4, 0xEE, 0x7B,
+    0x6A, 0x02, 0x5E, 0xAB, 0xC6, 0xDF, 0xCF, 0x90, 0xD4, 0x17, 0x76, 0x35, 0xBA, 0x9C, 0x5C, 0x52,
+    0x8F, 0x8D, 0x5F, 0x37, 0x62, 0xA5, 0xFC, 0xE9, 0x9C, 0xA7, 0x9E, 0xE2, 0x8D, 0x4D, 0xF7, 0x4B,
+    0xDB, 0x96, 0xB4, 0x3F, 0x69, 0xA2, 0x3D, 0x16, 0x62, 0x8E, 0xD7, 0x01, 0x6D, 0xC0, 0xB3, 0xAF,
+    0xF2, 0xEA, 0xF3, 0xBB, 0x24, 0xC8, 0xC8, 0x73, 0x00, 0x67, 0x3C, 0x2B, 0x33, 0x88, 0xB8, 0xF2,
+    0xAE, 0x38, 0x8A, 0x40, 0xA1, 0x10, 0x9B, 0xFC, 0x6E, 0xDD, 0x98, 0x75, 0x5A, 0x95, 0xFA, 0x61,
+    0xE7, 0xA7, 0xAD, 0x13, 0x3B, 0x50, 0xC5, 0x29, 0x2F, 0x50, 0x22, 0xCE, 0x89, 0x00, 0x14, 0x1F,
+    0xFD, 0x2B, 0x80, 0x1F, 0xAE, 0x5B, 0xA1, 0x36, 0xB2, 0xAB, 0xC7, 0x07, 0x00, 0x39, 0x3E, 0x00,
+    0xC3, 0xF9, 0x1C, 0x7E, 0xFD, 0xC9, 0xDD, 0xA6, 0xA9, 0xFB, 0xE4, 0x20, 0xF4, 0x82, 0x66, 0x44,
+    0x7B, 0xE7, 0x0E, 0xBB, 0x3A, 0x1E, 0x72, 0x54, 0xEC, 0xCC, 0x0C, 0x3A, 0x1D, 0x65, 0x1A, 0x69,
+    0x17, 0xD9, 0x18, 0xC6, 0xCC, 0x0D, 0xA1, 0x63, 0x2F, 0xF3, 0x43, 0x27, 0x3E, 0x4F, 0xF2, 0x9E,
+    0xAB, 0xB7, 0xEE, 0x72, 0x3E, 0xB9, 0xDB, 0x19, 0xA2, 0x11, 0xEB, 0x52, 0x35, 0x09, 0xB3, 0xFB,
+    0x5D, 0x41, 0xAF, 0xD7, 0xAE, 0x71, 0x00, 0xF0, 0xBA, 0x8C, 0x21, 0x99, 0xEE, 0x3E, 0x90, 0x66,
+    0x15, 0x47, 0xA7, 0xAB, 0x7D, 0x30, 0x49, 0xF7, 0x48, 0x36, 0xA0, 0x2B, 0x22, 0x80, 0x73, 0x13,
+    0x9A, 0x11, 0xC0, 0x9F, 0xA2, 0x88, 0xCA, 0xBD, 0xA8, 0x26, 0x34, 0x6F, 0xA7, 0xB6, 0xFB, 0x16,
+    0x10, 0x2D, 0x53, 0x35, 0x42, 0xF3, 0x88, 0x29, 0x00, 0x9C, 0xEC, 0x93, 0xEC, 0xA0, 0xE7, 0x72,
+    0x6C, 0x0F, 0xD7, 0xCE, 0xBC, 0xD2, 0x30, 0xA6, 0x97, 0x75, 0xFC, 0x0D, 0xA6, 0x57, 0xE7, 0xEC,
+    0x72, 0xB7, 0x13, 0x9B, 0xD8, 0x39, 0x7B, 0x96, 0xED, 0xB0, 0x9B, 0xA5, 0x77, 0xD4, 0x70, 0x76,
+    0xF3, 0xBF, 0xA2, 0xA8, 0xBF, 0xD0, 0xE5, 0xD3, 0xFC, 0x5F, 0xF3, 0x66, 0x21, 0x29, 0xEF, 0x19,
+    0x12, 0xB3, 0xC1, 0x60, 0xDE, 0xA0, 0x91, 0x93, 0xE2, 0x6C, 0x3E, 0xEA, 0x09, 0x3B, 0x2B, 0xC2,
+    0x2E, 0x3A, 0xC1, 0xF8, 0x92, 0x6F, 0xD0, 0x29, 0x42, 0xC7, 0x76, 0x81, 0xF1, 0xE0, 0xFB, 0xEC,
+    0x14, 0x51, 0x27, 0x33, 0xC3, 0x78, 0xD8, 0xEB, 0xEC, 0x14, 0x51, 0xD1, 0x78, 0x9C, 0x7E, 0x11,
+    0xFD, 0xF5, 0x4C, 0x51, 0xC9, 0x4B, 0x7F, 0xC1, 0xA5, 0x2F, 0xC8, 0x9F, 0x67, 0xE7, 0x50, 0xE5,
+    0xCE, 0x5B, 0xD0, 0x92, 0xE5, 0x7C, 0x01, 0x7D, 0x2C, 0xE9, 0x0A, 0x4E, 0x6D, 0x80, 0xA6, 0x10,
+    0x67, 0x6D, 0x80, 0x4E, 0x25, 0x5D, 0xC9, 0xA9, 0x8D, 0x4F, 0xE5, 0x49, 0xFF, 0xF9, 0x1D, 0x9D,
+    0xBC, 0xD4, 0x24, 0x6F, 0xE1, 0xDB, 0xFC, 0xF9, 0xC1, 0xCE, 0x09, 0x90, 0x03, 0xF6, 0x6D, 0xDA,
+    0x0E, 0x32, 0xA5, 0xEF, 0x48, 0x8A, 0x70, 0x32, 0xC3, 0xC9, 0x53, 0xC0, 0xE8, 0x01, 0x80, 0xF2,
+    0xE2, 0x4D, 0xE3, 0xC8, 0x61, 0x35, 0xD5, 0x6E, 0x49, 0x0E, 0x19, 0x47, 0xAD, 0xC8, 0x23, 0x06,
+    0x90, 0x9E, 0x9C, 0x1A, 0x1A, 0x7D, 0x89, 0x8A, 0x17, 0x7C, 0xE8, 0x97, 0x7E, 0x31, 0xFA, 0x02,
+    0x2F, 0xF2, 0x8C, 0x0F, 0x6D, 0xB0, 0xDE, 0xE8, 0x37, 0x78, 0x99, 0xCA, 0x87, 0x26, 0xD1, 0x1B,
+    0xED, 0x78, 0x8D, 0xCA, 0x2F, 0xB2, 0x3B, 0xCD, 0x8E, 0xBC, 0xE8, 0x4F, 0xCE, 0x6E, 0xD9, 0xE5,
+    0x9B, 0xB4, 0x79, 0xDE, 0x46, 0x2B, 0x5B, 0xA9, 0xF4, 0xBC, 0xBA, 0xDD, 0x8A, 0xEF, 0x63, 0x2F,
+    0xAD, 0x76, 0xD7, 0x05, 0xF0, 0xEF, 0xBF, 0x09, 0xE8, 0x0B, 0x13, 0x10, 0xBE, 0x25, 0x27, 0x3D,
+    0xAD, 0xEC, 0x23, 0x6E, 0xC9, 0x50, 0xAF, 0x15, 0x55, 0xB3, 0xE0, 0x6C, 0x7D, 0xC5, 0xE7, 0x89,
+    0x7E, 0xB1, 0xBE, 0xE2, 0x13, 0x84, 0x9D, 0xAD, 0x6F, 0x59, 0x67, 0x24, 0xDF, 0x5C, 0x93, 0x1C,
+    0x24, 0xF3, 0x53, 0x5C, 0xAC, 0xAF, 0x56, 0x5B, 0x83, 0x92, 0x17, 0x89, 0x76, 0x35, 0x3A, 0xB0,
+    0xC1, 0xDE, 0xB6, 0x7C, 0x3E, 0x3F, 0x39, 0xD6, 0x19, 0x26, 0xD8, 0xDD, 0xFD, 0x19, 0x78, 0xF9,
+    0x37, 0xB1, 0xDB, 0x23, 0x7A, 0x29, 0xF2, 0xEE, 0x38, 0xB3, 0xCE, 0x7B, 0x44, 0x1F, 0x98, 0x98,
+    0xA7, 0xA4, 0x7E, 0x59, 0xCD, 0xD2, 0xE7, 0x13, 0x27, 0x2A, 0xBB, 0x4A, 0x42, 0xC9, 0x09, 0x0F,
+    0x35, 0x1C, 0xCF, 0x0D, 0x5C, 0xF7, 0x88, 0xD6, 0xCC, 0x8E, 0x29, 0xEF, 0xC2, 0x64, 0x19, 0x8A,
+    0xC8, 0x26, 0x18, 0x92, 0x6F, 0x6E, 0xB7, 0xDB, 0x97, 0x77, 0xBC, 0xC5, 0xF5, 0x1D, 0x01, 0x69,
+    0x84, 0xE7, 0x78, 0xF6, 0x25, 0xEC, 0x6F, 0x3B, 0xB4, 0x0C, 0x85, 0x90, 0x73, 0x53, 0x23, 0x20,
+    0xF4, 0x4E, 0x64, 0xC3, 0xA1, 0xA2, 0xEC, 0xD4, 0xD8, 0xC6, 0xBC, 0xAB, 0xAF, 0x07, 0xCC, 0x0C,
+    0xD9, 0xAE, 0xE3, 0xCA, 0x81, 0xE6, 0xA6, 0xEB, 0xC9, 0x9F, 0x66, 0x3B, 0xFC, 0x9E, 0x5C, 0x1A,
+    0xB1, 0xB2, 0x9C, 0x7E, 0x8B, 0xB7, 0xFF, 0x8F, 0x23, 0x6E, 0x07, 0xC5, 0x0E, 0x6D, 0x90, 0xF9,
+    0xF1, 0xC4, 0xDD, 0xAB, 0x29, 0xC8, 0xAF, 0x34, 0x19, 0x78, 0xF6, 0xA5, 0xE2, 0x10, 0x35, 0xD9,
+    0x2E, 0x30, 0x4C, 0x26, 0xC0, 0x32, 0x0A, 0xF1, 0xD9, 0x06, 0xD0, 0xA3, 0x9E, 0xB2, 0x09, 0x3C,
+    0x47, 0x00, 0x05, 0xAF, 0x1C, 0x9C, 0x3A, 0xDB, 0x90, 0xB3, 0x09, 0xFD, 0x89, 0xF0, 0xB7, 0x78,
+    0xFB, 0x45, 0x13, 0xC0, 0x11, 0xBF, 0xD2, 0x10, 0xCF, 0xBE, 0xF4, 0xF0, 0x4B, 0x68, 0x33, 0x61,
+    0xFC, 0x3E, 0x5D, 0x4B, 0x3E, 0x49, 0x90, 0xC1, 0x04, 0x45, 0x07, 0x7A, 0x9D, 0xA0, 0xE8, 0xCC,
+    0x0C, 0xCD, 0x82, 0x57, 0x0E, 0x4C, 0xE8, 0xC9, 0x91, 0x37, 0x49, 0x9E, 0xE1, 0x65, 0x32, 0x6A,
+    0xCA, 0xA7, 0x2A, 0x76, 0xA0, 0xD7, 0x71, 0x97, 0x5B, 0xDE, 0xF0, 0x4B, 0x89, 0x5E, 0x7B, 0xCD,
+    0x37, 0x01, 0x4B, 0x5F, 0x91, 0x2F, 0x04, 0x18, 0xA6, 0x82, 0xFC, 0x88, 0x53, 0x4D, 0x8E, 0x86,
+    0x6C, 0x52, 0xEE, 0x3C, 0x7F, 0x27, 0xCE, 0x7E, 0xED, 0x8C, 0x6A, 0x5E, 0xCD, 0x8C, 0x8E, 0x9B,
+    0x6B, 0xD7, 0x87, 0x36, 0x8F, 0x92, 0x7C, 0x82, 0x5C, 0x9A, 0xD8, 0x0B, 0xA6, 0xF9, 0x39, 0xBE,
+    0xBB, 0x76, 0xA8, 0x98, 0xBB, 0xD2, 0x73, 0x1C, 0xF3, 0x8D, 0x4D, 0xCC, 0x2D, 0x5C, 0xFC, 0x33,
+    0x89, 0x5A, 0xEB, 0x64, 0x3B, 0xAC, 0x75, 0x12, 0x73, 0x9D, 0xCC, 0x1C, 0x73, 0x9D, 0xE8, 0xB8,
+    0x0E, 0xA8, 0x5D, 0x9D, 0xE8, 0xB8, 0xD6, 0xC9, 0xEE, 0xA9, 0x3A, 0xAE, 0x75, 0xC2, 0xB7, 0xA5,
+    0x4E, 0x82, 0x8E, 0xBD, 0xEC, 0x67, 0xE4, 0xF8, 0xAE, 0xEC, 0x48, 0x18, 0xF4, 0x5A, 0x27, 0xC3,
+    0x89, 0x1B, 0xD7, 0x5E, 0xFF, 0xCF, 0x24, 0x0A, 0xC5, 0x36, 0x2F, 0xBC, 0x49, 0x5C, 0x31, 0x65,
+    0x8F, 0x66, 0x74, 0xD0, 0xBC, 0x43, 0x02, 0x36, 0xC8, 0x8E, 0xB0, 0x0E, 0xBD, 0x87, 0x4E, 0xEB,
+    0x26, 0x5B, 0x15, 0x7F, 0x78, 0x20, 0x94, 0xFE, 0x05, 0xA1, 0xFA, 0x75, 0x82, 0x21, 0x83, 0x59,
+    0x70, 0xC4, 0xAB, 0x2F, 0x72, 0x42, 0x23, 0xBB, 0x6F, 0xDD, 0x73, 0x17, 0xF0, 0xA5, 0x92, 0x46,
+    0x49, 0x1A, 0xFF, 0x50, 0x76, 0x45, 0xBA, 0xC0, 0x01, 0x2D, 0xA9, 0xF3, 0x3E, 0xD6, 0x0B, 0xD0,
+    0xCA, 0xCC, 0x20, 0xCA, 0xF5, 0xFD, 0xED, 0x41, 0xDE, 0xE9, 0x21, 0x13, 0xE2, 0x59, 0x13, 0x62,
+    0xB2, 0x95, 0x51, 0xC3, 0x6B, 0xE2, 0xCC, 0x2D, 0x21, 0x8B, 0xDC, 0xB3, 0xF8, 0xD0, 0xCA, 0x1E,
+    0xBE, 0x8F, 0x70, 0x86, 0x89, 0x1B, 0x90, 0x1C, 0x7A, 0xF1, 0x84, 0x3B, 0xF5, 0x62, 0xDF, 0x3F,
+    0xB7, 0x64, 0x34, 0xF1, 0xA9, 0xB0, 0x6F, 0xD3, 0xF6, 0x99, 0x88, 0x3D, 0xD9, 0x74, 0x6F, 0x90,
+    0x75, 0x41, 0x9C, 0xDB, 0x79, 0x71, 0xAD, 0x66, 0x82, 0x6C, 0xA2, 0xA7, 0xC5, 0x2F, 0x45, 0xA7,
+    0x64, 0x67, 0x24, 0x0F, 0xF1, 0xAA, 0xC7, 0xEC, 0x8A, 0x57, 0xFC, 0x81, 0x20, 0xEF, 0x3F, 0x07,
+    0x34, 0x01, 0xF4, 0xF8, 0x4F, 0xB2, 0x91, 0x78, 0xF1, 0x0C, 0x2D, 0x87, 0x4A, 0xA4, 0x61, 0x0E,
+    0x22, 0x10, 0x1B, 0xD1, 0x30, 0x35, 0xE4, 0x80, 0x82, 0xEC, 0xF6, 0xCE, 0xDE, 0xEB, 0xDF, 0x0C,
+    0x28, 0x76, 0x12, 0x98, 0x69, 0x15, 0xB5, 0xAC, 0xFB, 0xA4, 0xE4, 0x93, 0x62, 0xB5, 0xB7, 0x6A,
+    0xF2, 0x49, 0xC1, 0xDB, 0x72, 0xD2, 0x4C, 0x62, 0xEF, 0x53, 0x04, 0x51, 0x3B, 0xEF, 0xAC, 0xF9,
+    0x0B, 0x8E, 0xCF, 0xC2, 0x4C, 0x40, 0xC3, 0xCB, 0x09, 0xA2, 0xB9, 0x64, 0x50, 0xA2, 0x29, 0xE4,
+    0xA4, 0x65, 0xAB, 0x06, 0xA2, 0xE7, 0xD4, 0x64, 0x81, 0xC3, 0xC4, 0xEC, 0x5D, 0xFA, 0xEF, 0x49,
+    0xFA, 0x8A, 0x64, 0x99, 0x79, 0x51, 0x5F, 0x66, 0x0F, 0x1D, 0x28, 0xC5, 0xF8, 0xD5, 0xA3, 0x24,
+    0xAF, 0x5A, 0x12, 0x79, 0x43, 0x6B, 0xBF, 0x9E, 0x00, 0x28, 0x39, 0xEB, 0xCC, 0x2A, 0x0D, 0xA2,
+    0x4A, 0x28, 0x53, 0x66, 0xC7, 0xCB, 0x90, 0x65, 0x4A, 0xE5, 0xAD, 0x73, 0x79, 0xB3, 0x8C, 0xD5,
+    0x7E, 0xAC, 0x5C, 0xB7, 0xCA, 0xD9, 0x49, 0x9D, 0xCA, 0xD5, 0xC0, 0xB8, 0x04, 0x00, 0xFC, 0x3F,
 };
 
 static const EpdGlyph notosans_18_boldGlyphs[] = {
@@ -2592,7 +2635,7 @@ static const EpdGlyph notosans_18_boldGlyphs[] = {
     { 5, 38, 21, 8, 29, 48, 11126 }, // |
     { 14, 33, 15, 1, 27, 116, 11174 }, // }
     { 19, 7, 21, 1, 17, 34, 11290 }, // ~
-    { 0, 0, 10, 0, 0, 0, 0 }, //  
+    { 0, 0, 10, 0, 0, 0, 11324 }, //  
     { 7, 28, 11, 2, 21, 49, 0 }, // ¡
     { 18, 29, 21, 2, 28, 131, 49 }, // ¢
     { 20, 28, 21, 1, 28, 140, 180 }, // £
@@ -2603,775 +2646,782 @@ static const EpdGlyph notosans_18_boldGlyphs[] = {
     { 14, 6, 22, 4, 29, 21, 723 }, // ¨
     { 29, 29, 31, 1, 28, 211, 744 }, // ©
     { 12, 15, 14, 1, 28, 45, 955 }, // ª
-    { 21, 18, 23, 1, 19, 95, 1000 }, // «
-    { 19, 12, 21, 1, 16, 57, 1095 }, // ¬
-    { 10, 6, 12, 1, 13, 15, 1152 }, // ­
-    { 29, 29, 31, 1, 28, 211, 1167 }, // ®
-    { 20, 5, 19, -1, 33, 25, 1378 }, // ¯
-    { 14, 14, 16, 1, 28, 49, 1403 }, // °
-    { 19, 24, 21, 1, 24, 114, 1452 }, // ±
-    { 13, 18, 14, 0, 33, 59, 1566 }, // ²
-    { 14, 17, 14, 0, 32, 60, 1625 }, // ³
-    { 12, 7, 14, 1, 29, 21, 1685 }, // ´
-    { 20, 30, 24, 2, 21, 150, 1706 }, // µ
-    { 21, 34, 24, 1, 29, 179, 1856 }, // ¶
-    { 7, 7, 11, 2, 17, 13, 2035 }, // ·
-    { 10, 9, 10, 0, 0, 23, 2048 }, // ¸
-    { 10, 17, 14, 1, 32, 43, 2071 }, // ¹
-    { 13, 15, 14, 1, 28, 49, 2114 }, // º
-    { 21, 18, 23, 1, 19, 95, 2163 }, // »
-    { 31, 27, 31, 0, 27, 210, 2258 }, // ¼
-    { 32, 27, 33, 0, 27, 216, 2468 }, // ½
-    { 31, 28, 32, 1, 28, 217, 2684 }, // ¾
-    { 18, 28, 18, 0, 21, 126, 2901 }, // ¿
-    { 26, 35, 26, 0, 35, 228, 3027 }, // À
-    { 26, 35, 26, 0, 35, 228, 3255 }, // Á
-    { 26, 35, 26, 0, 35, 228, 3483 }, // Â
-    { 26, 35, 26, 0, 35, 228, 3711 }, // Ã
-    { 26, 35, 26, 0, 35, 228, 3939 }, // Ä
-    { 26, 34, 26, 0, 34, 221, 4167 }, // Å
-    { 34, 27, 36, 0, 27, 230, 4388 }, // Æ
-    { 21, 37, 24, 2, 28, 195, 4618 }, // Ç
-    { 16, 35, 21, 3, 35, 140, 4813 }, // È
-    { 16, 35, 21, 3, 35, 140, 4953 }, // É
-    { 16, 35, 21, 3, 35, 140, 5093 }, // Ê
-    { 16, 35, 21, 3, 35, 140, 5233 }, // Ë
-    { 14, 35, 15, 0, 35, 123, 5373 }, // Ì
-    { 14, 35, 15, 1, 35, 123, 5496 }, // Í
-    { 16, 35, 15, -1, 35, 140, 5619 }, // Î
-    { 14, 35, 15, 0, 35, 123, 5759 }, // Ï
-    { 26, 27, 27, 0, 27, 176, 5882 }, // Ð
-    { 25, 35, 30, 3, 35, 219, 6058 }, // Ñ
-    { 26, 36, 30, 2, 35, 234, 6277 }, // Ò
-    { 26, 36, 30, 2, 35, 234, 6511 }, // Ó
-    { 26, 36, 30, 2, 35, 234, 6745 }, // Ô
-    { 26, 36, 30, 2, 35, 234, 6979 }, // Õ
-    { 26, 36, 30, 2, 35, 234, 7213 }, // Ö
-    { 18, 18, 21, 2, 22, 81, 7447 }, // ×
-    { 26, 31, 30, 2, 29, 202, 7528 }, // Ø
-    { 23, 36, 28, 3, 35, 207, 7730 }, // Ù
-    { 23, 36, 28, 3, 35, 207, 7937 }, // Ú
-    { 23, 36, 28, 3, 35, 207, 8144 }, // Û
-    { 23, 36, 28, 3, 35, 207, 8351 }, // Ü
-    { 24, 35, 23, 0, 35, 210, 8558 }, // Ý
-    { 19, 27, 24, 3, 27, 129, 8768 }, // Þ
-    { 24, 30, 26, 2, 29, 180, 8897 }, // ß
-    { 19, 30, 22, 1, 29, 143, 9077 }, // à
-    { 19, 30, 22, 1, 29, 143, 9220 }, // á
-    { 19, 30, 22, 1, 29, 143, 9363 }, // â
-    { 19, 30, 22, 1, 29, 143, 9506 }, // ã
-    { 19, 30, 22, 1, 29, 143, 9649 }, // ä
-    { 19, 33, 22, 1, 32, 157, 9792 }, // å
-    { 32, 22, 34, 1, 21, 176, 9949 }, // æ
-    { 18, 30, 19, 1, 21, 135, 10125 }, // ç
-    { 20, 30, 22, 1, 29, 150, 10260 }, // è
-    { 20, 30, 22, 1, 29, 150, 10410 }, // é
-    { 20, 30, 22, 1, 29, 150, 10560 }, // ê
-    { 20, 30, 22, 1, 29, 150, 10710 }, // ë
-    { 12, 29, 11, -1, 29, 87, 10860 }, // ì
-    { 12, 29, 11, 2, 29, 87, 10947 }, // í
-    { 16, 29, 11, -2, 29, 116, 11034 }, // î
-    { 15, 29, 11, -2, 29, 109, 11150 }, // ï
-    { 21, 30, 24, 1, 29, 158, 11259 }, // ð
-    { 20, 29, 24, 2, 29, 145, 11417 }, // ñ
-    { 21, 30, 23, 1, 29, 158, 11562 }, // ò
-    { 21, 30, 23, 1, 29, 158, 11720 }, // ó
-    { 21, 30, 23, 1, 29, 158, 11878 }, // ô
-    { 21, 30, 23, 1, 29, 158, 12036 }, // õ
-    { 21, 30, 23, 1, 29, 158, 12194 }, // ö
-    { 19, 19, 21, 1, 23, 91, 12352 }, // ÷
-    { 21, 24, 23, 1, 22, 126, 12443 }, // ø
-    { 20, 30, 24, 2, 29, 150, 12569 }, // ù
-    { 20, 30, 24, 2, 29, 150, 12719 }, // ú
-    { 20, 30, 24, 2, 29, 150, 12869 }, // û
-    { 20, 30, 24, 2, 29, 150, 13019 }, // ü
-    { 22, 38, 21, 0, 29, 209, 13169 }, // ý
-    { 20, 38, 24, 2, 29, 190, 13378 }, // þ
-    { 22, 38, 21, 0, 29, 209, 13568 }, // ÿ
-    { 26, 33, 26, 0, 33, 215, 0 }, // Ā
-    { 19, 28, 22, 1, 27, 133, 215 }, // ā
-    { 26, 35, 26, 0, 35, 228, 348 }, // Ă
-    { 19, 30, 22, 1, 29, 143, 576 }, // ă
-    { 26, 36, 26, 0, 27, 234, 719 }, // Ą
-    { 20, 30, 22, 1, 21, 150, 953 }, // ą
-    { 21, 36, 24, 2, 35, 189, 1103 }, // Ć
-    { 18, 30, 19, 1, 29, 135, 1292 }, // ć
-    { 21, 36, 24, 2, 35, 189, 1427 }, // Ĉ
-    { 18, 30, 19, 1, 29, 135, 1616 }, // ĉ
-    { 21, 36, 24, 2, 35, 189, 1751 }, // Ċ
-    { 18, 30, 19, 1, 29, 135, 1940 }, // ċ
-    { 21, 36, 24, 2, 35, 189, 2075 }, // Č
-    { 19, 30, 19, 1, 29, 143, 2264 }, // č
-    { 23, 35, 27, 3, 35, 202, 2407 }, // Ď
-    { 28, 30, 24, 1, 29, 210, 2609 }, // ď
-    { 26, 27, 27, 0, 27, 176, 2819 }, // Đ
-    { 23, 30, 24, 1, 29, 173, 2995 }, // đ
-    { 16, 33, 21, 3, 33, 132, 3168 }, // Ē
-    { 20, 28, 22, 1, 27, 140, 3300 }, // ē
-    { 16, 35, 21, 3, 35, 140, 3440 }, // Ĕ
-    { 20, 30, 22, 1, 29, 150, 3580 }, // ĕ
-    { 16, 35, 21, 3, 35, 140, 3730 }, // Ė
-    { 20, 30, 22, 1, 29, 150, 3870 }, // ė
-    { 16, 36, 21, 3, 27, 144, 4020 }, // Ę
-    { 20, 30, 22, 1, 21, 150, 4164 }, // ę
-    { 17, 35, 21, 3, 35, 149, 4314 }, // Ě
-    { 20, 30, 22, 1, 29, 150, 4463 }, // ě
-    { 23, 36, 27, 2, 35, 207, 4613 }, // Ĝ
-    { 20, 38, 24, 1, 29, 190, 4820 }, // ĝ
-    { 23, 36, 27, 2, 35, 207, 5010 }, // Ğ
-    { 20, 38, 24, 1, 29, 190, 5217 }, // ğ
-    { 23, 36, 27, 2, 35, 207, 5407 }, // Ġ
-    { 20, 38, 24, 1, 29, 190, 5614 }, // ġ
-    { 23, 37, 27, 2, 28, 213, 5804 }, // Ģ
-    { 20, 38, 24, 1, 29, 190, 6017 }, // ģ
-    { 23, 35, 29, 3, 35, 202, 6207 }, // Ĥ
-    { 24, 37, 24, -2, 37, 222, 6409 }, // ĥ
-    { 29, 27, 29, 0, 27, 196, 6631 }, // Ħ
-    { 22, 29, 25, 0, 29, 160, 6827 }, // ħ
-    { 16, 35, 15, -2, 35, 140, 6987 }, // Ĩ
-    { 16, 29, 11, -2, 29, 116, 7127 }, // ĩ
-    { 13, 33, 15, 1, 33, 108, 7243 }, // Ī
-    { 13, 27, 11, -1, 27, 88, 7351 }, // ī
-    { 15, 35, 15, 0, 35, 132, 7439 }, // Ĭ
-    { 16, 29, 11, -2, 29, 116, 7571 }, // ĭ
-    { 13, 36, 15, 1, 27, 117, 7687 }, // Į
-    { 8, 38, 11, 1, 29, 76, 7804 }, // į
-    { 13, 35, 15, 1, 35, 114, 7880 }, // İ
-    { 7, 21, 11, 2, 21, 37, 7994 }, // ı
-    { 24, 35, 27, 1, 27, 210, 8031 }, // Ĳ
-    { 19, 38, 23, 2, 29, 181, 8241 }, // ĳ
-    { 17, 43, 12, -3, 35, 183, 8422 }, // Ĵ
-    { 16, 38, 11, -2, 29, 152, 8605 }, // ĵ
-    { 22, 36, 25, 3, 27, 198, 8757 }, // Ķ
-    { 22, 38, 23, 2, 29, 209, 8955 }, // ķ
-    { 22, 21, 23, 2, 21, 116, 9164 }, // ĸ
-    { 18, 35, 21, 2, 35, 158, 9280 }, // Ĺ
-    { 12, 37, 11, 2, 37, 111, 9438 }, // ĺ
-    { 17, 36, 21, 3, 27, 153, 9549 }, // Ļ
-    { 7, 38, 11, 2, 29, 67, 9702 }, // ļ
-    { 18, 27, 21, 3, 27, 122, 9769 }, // Ľ
-    { 15, 29, 11, 2, 29, 109, 9891 }, // ľ
-    { 17, 27, 21, 3, 27, 115, 10000 }, // Ŀ
-    { 14, 29, 14, 2, 29, 102, 10115 }, // ŀ
-    { 20, 27, 21, 0, 27, 135, 10217 }, // Ł
-    { 13, 29, 11, -1, 29, 95, 10352 }, // ł
-    { 25, 35, 30, 3, 35, 219, 10447 }, // Ń
-    { 20, 29, 24, 2, 29, 145, 10666 }, // ń
-    { 25, 36, 30, 3, 27, 225, 10811 }, // Ņ
-    { 20, 30, 24, 2, 21, 150, 11036 }, // ņ
-    { 25, 35, 30, 3, 35, 219, 11186 }, // Ň
-    { 20, 29, 24, 2, 29, 145, 11405 }, // ň
-    { 28, 27, 29, -1, 27, 189, 11550 }, // ŉ
-    { 25, 35, 30, 3, 27, 219, 11739 }, // Ŋ
-    { 20, 30, 24, 2, 21, 150, 11958 }, // ŋ
-    { 26, 34, 30, 2, 33, 221, 12108 }, // Ō
-    { 21, 28, 23, 1, 27, 147, 12329 }, // ō
-    { 26, 36, 30, 2, 35, 234, 12476 }, // Ŏ
-    { 21, 30, 23, 1, 29, 158, 12710 }, // ŏ
-    { 26, 36, 30, 2, 35, 234, 12868 }, // Ő
-    { 21, 30, 23, 1, 29, 158, 13102 }, // ő
-    { 33, 29, 36, 2, 28, 240, 13260 }, // Œ
-    { 35, 22, 37, 1, 21, 193, 13500 }, // œ
-    { 22, 35, 25, 3, 35, 193, 13693 }, // Ŕ
-    { 15, 29, 17, 2, 29, 109, 13886 }, // ŕ
-    { 22, 36, 25, 3, 27, 198, 13995 }, // Ŗ
-    { 15, 30, 17, 2, 21, 113, 14193 }, // ŗ
-    { 22, 35, 25, 3, 35, 193, 14306 }, // Ř
-    { 17, 29, 17, 1, 29, 124, 14499 }, // ř
-    { 19, 36, 21, 1, 35, 171, 14623 }, // Ś
-    { 17, 30, 19, 1, 29, 128, 14794 }, // ś
-    { 19, 36, 21, 1, 35, 171, 14922 }, // Ŝ
-    { 17, 30, 19, 1, 29, 128, 15093 }, // ŝ
-    { 19, 37, 21, 1, 28, 176, 15221 }, // Ş
-    { 17, 30, 19, 1, 21, 128, 15397 }, // ş
-    { 19, 36, 21, 1, 35, 171, 15525 }, // Š
-    { 17, 30, 19, 1, 29, 128, 15696 }, // š
-    { 21, 36, 22, 0, 27, 189, 15824 }, // Ţ
-    { 16, 34, 16, 0, 25, 136, 16013 }, // ţ
-    { 21, 35, 22, 0, 35, 184, 16149 }, // Ť
-    { 22, 30, 16, 0, 29, 165, 16333 }, // ť
-    { 21, 27, 22, 0, 27, 142, 16498 }, // Ŧ
-    { 16, 26, 16, 0, 25, 104, 16640 }, // ŧ
-    { 23, 36, 28, 3, 35, 207, 16744 }, // Ũ
-    { 20, 30, 24, 2, 29, 150, 16951 }, // ũ
-    { 23, 34, 28, 3, 33, 196, 17101 }, // Ū
-    { 20, 28, 24, 2, 27, 140, 17297 }, // ū
-    { 23, 36, 28, 3, 35, 207, 17437 }, // Ŭ
-    { 20, 30, 24, 2, 29, 150, 17644 }, // ŭ
-    { 23, 39, 28, 3, 38, 225, 17794 }, // Ů
-    { 20, 33, 24, 2, 32, 165, 18019 }, // ů
-    { 23, 36, 28, 3, 35, 207, 18184 }, // Ű
-    { 20, 30, 24, 2, 29, 150, 18391 }, // ű
-    { 23, 36, 28, 3, 27, 207, 18541 }, // Ų
-    { 20, 30, 24, 2, 21, 150, 18748 }, // ų
-    { 37, 35, 36, 0, 35, 324, 18898 }, // Ŵ
-    { 32, 29, 32, 0, 29, 232, 19222 }, // ŵ
-    { 24, 35, 23, 0, 35, 210, 19454 }, // Ŷ
-    { 22, 38, 21, 0, 29, 209, 19664 }, // ŷ
-    { 24, 35, 23, 0, 35, 210, 19873 }, // Ÿ
-    { 21, 35, 22, 0, 35, 184, 20083 }, // Ź
-    { 17, 29, 18, 1, 29, 124, 20267 }, // ź
-    { 21, 35, 22, 0, 35, 184, 20391 }, // Ż
-    { 17, 29, 18, 1, 29, 124, 20575 }, // ż
-    { 21, 35, 22, 0, 35, 184, 20699 }, // Ž
-    { 17, 29, 18, 1, 29, 124, 20883 }, // ž
-    { 14, 29, 14, 2, 29, 102, 21007 }, // ſ
-    { 11, 7, 0, -20, 29, 20, 0 }, // ̀
-    { 12, 7, 0, -14, 29, 21, 20 }, // ́
-    { 16, 7, 0, -8, 29, 28, 41 }, // ̂
-    { 16, 7, 0, -21, 29, 28, 69 }, // ̃
-    { 14, 5, 0, -7, 27, 18, 97 }, // ̄
-    { 16, 5, 0, -8, 32, 20, 115 }, // ̅
-    { 15, 7, 0, -7, 29, 27, 135 }, // ̆
-    { 8, 6, 0, -4, 29, 12, 162 }, // ̇
-    { 14, 6, 0, -7, 29, 21, 174 }, // ̈
-    { 9, 10, 0, -16, 32, 23, 195 }, // ̉
-    { 10, 10, 0, -5, 32, 25, 218 }, // ̊
-    { 17, 7, 0, -6, 29, 30, 243 }, // ̋
-    { 17, 7, 0, -8, 29, 30, 273 }, // ̌
-    { 4, 7, 0, -2, 29, 7, 303 }, // ̍
-    { 12, 7, 0, -6, 29, 21, 310 }, // ̎
-    { 17, 7, 0, -22, 29, 30, 331 }, // ̏
-    { 14, 10, 0, -7, 32, 35, 361 }, // ̐
-    { 16, 7, 0, -8, 29, 28, 396 }, // ̑
-    { 8, 10, 0, -4, 27, 20, 424 }, // ̒
-    { 8, 10, 0, -4, 27, 20, 444 }, // ̓
-    { 8, 10, 0, -4, 27, 20, 464 }, // ̔
-    { 8, 10, 0, -4, 27, 20, 484 }, // ̕
-    { 12, 7, 0, -7, -1, 21, 504 }, // ̖
-    { 12, 7, 0, -6, -1, 21, 525 }, // ̗
-    { 8, 8, 0, -4, -1, 16, 546 }, // ̘
-    { 8, 8, 0, -4, -1, 16, 562 }, // ̙
-    { 10, 10, 11, 0, 29, 25, 578 }, // ̚
-    { 10, 9, 0, -4, 29, 23, 603 }, // ̛
-    { 6, 9, 0, -3, 0, 14, 626 }, // ̜
-    { 8, 7, 0, -4, -1, 14, 640 }, // ̝
-    { 8, 7, 0, -4, -1, 14, 654 }, // ̞
-    { 8, 8, 0, -4, -1, 16, 668 }, // ̟
-    { 9, 3, 0, -5, -3, 7, 684 }, // ̠
-    { 9, 11, 0, -9, 2, 25, 691 }, // ̡
-    { 9, 11, 0, 0, 2, 25, 716 }, // ̢
-    { 7, 6, 0, -16, -2, 11, 741 }, // ̣
-    { 14, 6, 0, -7, -2, 21, 752 }, // ̤
-    { 10, 10, 0, -5, 1, 25, 773 }, // ̥
-    { 8, 7, 0, -4, -2, 14, 798 }, // ̦
-    { 10, 9, 0, -5, 0, 23, 812 }, // ̧
-    { 8, 10, 0, -4, 1, 20, 835 }, // ̨
-    { 4, 7, 0, -2, -1, 7, 855 }, // ̩
-    { 14, 8, 0, -7, -1, 28, 862 }, // ̪
-    { 16, 5, 0, -8, -2, 20, 890 }, // ̫
-    { 17, 7, 0, -8, -1, 30, 910 }, // ̬
-    { 16, 7, 0, -8, -1, 28, 940 }, // ̭
-    { 16, 7, 0, -8, -2, 28, 968 }, // ̮
-    { 16, 7, 0, -8, -2, 28, 996 }, // ̯
-    { 16, 7, 0, -8, -1, 28, 1024 }, // ̰
-    { 14, 5, 0, -7, -2, 18, 1052 }, // ̱
-    { 18, 3, 0, -9, -3, 14, 1070 }, // ̲
-    { 16, 9, 0, -9, 0, 36, 1084 }, // ̳
-    { 16, 7, 0, -8, 14, 28, 1120 }, // ̴
-    { 16, 5, 0, -8, 13, 20, 1148 }, // ̵
-    { 28, 5, 0, -14, 13, 35, 1168 }, // ̶
-    { 14, 11, 0, -7, 16, 39, 1203 }, // ̷
-    { 16, 32, 0, -8, 29, 128, 1242 }, // ̸
-    { 6, 9, 0, -3, 0, 14, 1370 }, // ̹
-    { 14, 8, 0, -7, -1, 28, 1384 }, // ̺
-    { 16, 8, 0, -8, -1, 32, 1412 }, // ̻
-    { 16, 5, 0, -8, -2, 20, 1444 }, // ̼
-    { 8, 9, 0, -4, 30, 18, 1464 }, // ̽
-    { 6, 12, 0, -3, 33, 18, 1482 }, // ̾
-    { 16, 9, 0, -9, 37, 36, 1500 }, // ̿
-    { 12, 7, 0, -9, 29, 21, 1536 }, // ̀
-    { 12, 7, 0, -3, 29, 21, 1557 }, // ́
-    { 16, 7, 0, -8, 29, 28, 1578 }, // ͂
-    { 7, 8, 0, -4, 30, 14, 1606 }, // ̓
-    { 20, 8, 0, -8, 30, 40, 1620 }, // ̈́
-    { 8, 8, 0, -2, -1, 16, 1660 }, // ͅ
-    { 18, 7, 0, -9, 29, 32, 1676 }, // ͆
-    { 16, 9, 0, -9, 0, 36, 1708 }, // ͇
-    { 12, 7, 0, -6, -1, 21, 1744 }, // ͈
-    { 8, 7, 0, -4, -2, 14, 1765 }, // ͉
-    { 14, 8, 0, -7, 29, 28, 1779 }, // ͊
-    { 15, 16, 0, -8, 36, 60, 1807 }, // ͋
-    { 14, 11, 0, -7, 33, 39, 1867 }, // ͌
-    { 14, 8, 0, -7, -1, 28, 1906 }, // ͍
-    { 8, 9, 0, -4, 0, 18, 1934 }, // ͎
-    { 28, 27, 0, -14, 27, 189, 1952 }, // ͏
-    { 7, 8, 0, -4, 30, 14, 2141 }, // ͐
-    { 5, 10, 0, -2, 31, 13, 2155 }, // ͑
-    { 14, 10, 0, -7, 32, 35, 2168 }, // ͒
-    { 8, 8, 0, -4, -1, 16, 2203 }, // ͓
-    { 7, 8, 0, -4, -1, 14, 2219 }, // ͔
-    { 7, 8, 0, -4, -1, 14, 2233 }, // ͕
-    { 15, 8, 0, -7, -1, 30, 2247 }, // ͖
-    { 5, 10, 0, -2, 32, 13, 2277 }, // ͗
-    { 7, 6, 0, 3, 29, 11, 2290 }, // ͘
-    { 8, 8, 0, -4, -1, 16, 2301 }, // ͙
-    { 16, 8, 0, -8, -1, 32, 2317 }, // ͚
-    { 8, 8, 0, -4, 30, 16, 2349 }, // ͛
-    { 30, 8, 0, -15, -1, 60, 2365 }, // ͜
-    { 30, 8, 0, -15, 30, 60, 2425 }, // ͝
-    { 24, 4, 0, -12, 26, 24, 2485 }, // ͞
-    { 24, 4, 0, -12, -2, 24, 2509 }, // ͟
-    { 30, 7, 0, -15, 29, 53, 2533 }, // ͠
-    { 30, 8, 0, -15, 33, 60, 2586 }, // ͡
-    { 31, 9, 0, -15, 0, 70, 2646 }, // ͢
-    { 10, 9, 0, -5, 32, 23, 2716 }, // ͣ
-    { 9, 9, 0, -4, 32, 21, 2739 }, // ͤ
-    { 3, 12, 0, -1, 35, 9, 2760 }, // ͥ
-    { 10, 9, 0, -5, 32, 23, 2769 }, // ͦ
-    { 9, 9, 0, -4, 32, 21, 2792 }, // ͧ
-    { 9, 9, 0, -4, 32, 21, 2813 }, // ͨ
-    { 10, 12, 0, -5, 35, 30, 2834 }, // ͩ
-    { 9, 12, 0, -4, 35, 27, 2864 }, // ͪ
-    { 15, 9, 0, -7, 32, 34, 2891 }, // ͫ
-    { 7, 9, 0, -3, 32, 16, 2925 }, // ͬ
-    { 7, 11, 0, -3, 34, 20, 2941 }, // ͭ
-    { 11, 9, 0, -5, 32, 25, 2961 }, // ͮ
-    { 11, 9, 0, -5, 32, 25, 2986 }, // ͯ
-    { 16, 35, 21, 3, 35, 140, 0 }, // Ѐ
-    { 16, 35, 21, 3, 35, 140, 140 }, // Ё
-    { 28, 28, 29, 0, 27, 196, 280 }, // Ђ
-    { 17, 35, 21, 3, 35, 149, 476 }, // Ѓ
-    { 23, 29, 24, 1, 28, 167, 625 }, // Є
-    { 19, 29, 21, 1, 28, 138, 792 }, // Ѕ
-    { 6, 27, 12, 3, 27, 41, 930 }, // І
-    { 12, 35, 12, 0, 35, 105, 971 }, // Ї
-    { 13, 35, 12, -3, 27, 114, 1076 }, // Ј
-    { 38, 28, 39, 0, 27, 266, 1190 }, // Љ
-    { 36, 27, 40, 3, 27, 243, 1456 }, // Њ
-    { 27, 27, 29, 0, 27, 183, 1699 }, // Ћ
-    { 23, 35, 26, 3, 35, 202, 1882 }, // Ќ
-    { 24, 35, 30, 3, 35, 210, 2084 }, // Ѝ
-    { 25, 37, 24, 0, 36, 232, 2294 }, // Ў
-    { 23, 33, 29, 3, 27, 190, 2526 }, // Џ
-    { 26, 27, 26, 0, 27, 176, 2716 }, // А
-    { 20, 27, 24, 3, 27, 135, 2892 }, // Б
-    { 21, 27, 25, 3, 27, 142, 3027 }, // В
-    { 17, 27, 21, 3, 27, 115, 3169 }, // Г
-    { 29, 33, 29, 0, 27, 240, 3284 }, // Д
-    { 16, 27, 21, 3, 27, 108, 3524 }, // Е
-    { 38, 27, 37, 0, 27, 257, 3632 }, // Ж
-    { 20, 29, 22, 1, 28, 145, 3889 }, // З
-    { 24, 27, 30, 3, 27, 162, 4034 }, // И
-    { 24, 36, 30, 3, 36, 216, 4196 }, // Й
-    { 23, 27, 26, 3, 27, 156, 4412 }, // К
-    { 25, 28, 27, 0, 27, 175, 4568 }, // Л
-    { 29, 27, 35, 3, 27, 196, 4743 }, // М
-    { 23, 27, 29, 3, 27, 156, 4939 }, // Н
-    { 27, 29, 29, 1, 28, 196, 5095 }, // О
-    { 23, 27, 29, 3, 27, 156, 5291 }, // П
-    { 19, 27, 23, 3, 27, 129, 5447 }, // Р
-    { 22, 29, 24, 1, 28, 160, 5576 }, // С
-    { 21, 27, 22, 0, 27, 142, 5736 }, // Т
-    { 25, 28, 24, 0, 27, 175, 5878 }, // У
-    { 30, 29, 34, 2, 28, 218, 6053 }, // Ф
-    { 26, 27, 25, 0, 27, 176, 6271 }, // Х
-    { 26, 33, 29, 3, 27, 215, 6447 }, // Ц
-    { 22, 27, 27, 2, 27, 149, 6662 }, // Ч
-    { 34, 27, 40, 3, 27, 230, 6811 }, // Ш
-    { 37, 33, 40, 3, 27, 306, 7041 }, // Щ
-    { 27, 27, 28, 0, 27, 183, 7347 }, // Ъ
-    { 29, 27, 35, 3, 27, 196, 7530 }, // Ы
-    { 20, 27, 24, 3, 27, 135, 7726 }, // Ь
-    { 22, 29, 25, 1, 28, 160, 7861 }, // Э
-    { 34, 29, 38, 3, 28, 247, 8021 }, // Ю
-    { 23, 27, 26, 0, 27, 156, 8268 }, // Я
-    { 19, 22, 22, 1, 21, 105, 8424 }, // а
-    { 21, 30, 23, 1, 29, 158, 8529 }, // б
-    { 19, 21, 22, 2, 21, 100, 8687 }, // в
-    { 15, 21, 18, 3, 21, 79, 8787 }, // г
-    { 24, 27, 24, 0, 21, 162, 8866 }, // д
-    { 20, 22, 22, 1, 21, 110, 9028 }, // е
-    { 33, 21, 32, 0, 21, 174, 9138 }, // ж
-    { 17, 22, 19, 1, 21, 94, 9312 }, // з
-    { 20, 21, 25, 3, 21, 105, 9406 }, // и
-    { 20, 29, 25, 3, 29, 145, 9511 }, // й
-    { 20, 21, 23, 3, 21, 105, 9656 }, // к
-    { 21, 22, 23, 0, 21, 116, 9761 }, // л
-    { 26, 21, 31, 3, 21, 137, 9877 }, // м
-    { 19, 21, 25, 3, 21, 100, 10014 }, // н
-    { 21, 22, 23, 1, 21, 116, 10114 }, // о
-    { 19, 21, 24, 3, 21, 100, 10230 }, // п
-    { 20, 30, 24, 3, 21, 150, 10330 }, // р
-    { 18, 22, 20, 1, 21, 99, 10480 }, // с
-    { 19, 21, 19, 0, 21, 100, 10579 }, // т
-    { 23, 30, 21, -1, 21, 173, 10679 }, // у
-    { 28, 38, 30, 1, 29, 266, 10852 }, // ф
-    { 22, 21, 22, 0, 21, 116, 11118 }, // х
-    { 22, 27, 24, 2, 21, 149, 11234 }, // ц
-    { 19, 21, 24, 2, 21, 100, 11383 }, // ч
-    { 30, 21, 36, 3, 21, 158, 11483 }, // ш
-    { 33, 27, 36, 3, 21, 223, 11641 }, // щ
-    { 24, 21, 25, 0, 21, 126, 11864 }, // ъ
-    { 27, 21, 32, 3, 21, 142, 11990 }, // ы
-    { 18, 21, 22, 3, 21, 95, 12132 }, // ь
-    { 18, 22, 20, 1, 21, 99, 12227 }, // э
-    { 28, 22, 32, 3, 21, 154, 12326 }, // ю
-    { 20, 21, 23, 0, 21, 105, 12480 }, // я
-    { 20, 30, 22, 1, 29, 150, 12585 }, // ѐ
-    { 20, 29, 22, 1, 28, 145, 12735 }, // ё
-    { 22, 38, 24, 0, 29, 209, 12880 }, // ђ
-    { 15, 29, 18, 3, 29, 109, 13089 }, // ѓ
-    { 18, 22, 20, 1, 21, 99, 13198 }, // є
-    { 17, 22, 19, 1, 21, 94, 13297 }, // ѕ
-    { 7, 29, 12, 2, 29, 51, 13391 }, // і
-    { 11, 29, 11, 0, 29, 80, 13442 }, // ї
-    { 11, 38, 11, -2, 29, 105, 13522 }, // ј
-    { 33, 22, 34, 0, 21, 182, 13627 }, // љ
-    { 31, 21, 35, 3, 21, 163, 13809 }, // њ
-    { 22, 29, 24, 0, 29, 160, 13972 }, // ћ
-    { 20, 29, 23, 3, 29, 145, 14132 }, // ќ
-    { 20, 29, 25, 3, 29, 145, 14277 }, // ѝ
-    { 23, 38, 21, -1, 29, 219, 14422 }, // ў
-    { 19, 27, 24, 3, 21, 129, 14641 }, // џ
-    { 35, 27, 36, 0, 27, 237, 14770 }, // Ѡ
-    { 32, 21, 33, 0, 21, 168, 15007 }, // ѡ
-    { 24, 27, 25, 0, 27, 162, 15175 }, // Ѣ
-    { 24, 25, 25, 0, 25, 150, 15337 }, // ѣ
-    { 32, 29, 36, 3, 28, 232, 15487 }, // Ѥ
-    { 27, 22, 30, 2, 21, 149, 15719 }, // ѥ
-    { 28, 27, 27, 0, 27, 189, 15868 }, // Ѧ
-    { 24, 21, 24, 0, 21, 126, 16057 }, // ѧ
-    { 35, 27, 38, 3, 27, 237, 16183 }, // Ѩ
-    { 32, 21, 34, 2, 21, 168, 16420 }, // ѩ
-    { 30, 27, 30, 0, 27, 203, 16588 }, // Ѫ
-    { 23, 21, 23, 0, 21, 121, 16791 }, // ѫ
-    { 37, 27, 40, 3, 27, 250, 16912 }, // Ѭ
-    { 31, 21, 33, 2, 21, 163, 17162 }, // ѭ
-    { 23, 42, 24, 0, 33, 242, 17325 }, // Ѯ
-    { 20, 35, 21, 0, 26, 175, 17567 }, // ѯ
-    { 27, 27, 33, 3, 27, 183, 17742 }, // Ѱ
-    { 27, 38, 32, 2, 29, 257, 17925 }, // ѱ
-    { 26, 29, 30, 2, 28, 189, 18182 }, // Ѳ
-    { 21, 22, 23, 1, 21, 116, 18371 }, // ѳ
-    { 27, 27, 27, 0, 27, 183, 18487 }, // Ѵ
-    { 23, 21, 23, 0, 21, 121, 18670 }, // ѵ
-    { 27, 35, 27, 0, 35, 237, 18791 }, // Ѷ
-    { 23, 29, 23, 0, 29, 167, 19028 }, // ѷ
-    { 48, 37, 49, 2, 28, 444, 19195 }, // Ѹ
-    { 44, 30, 44, 1, 21, 330, 19639 }, // ѹ
-    { 28, 33, 31, 2, 30, 231, 19969 }, // Ѻ
-    { 23, 26, 26, 1, 23, 150, 20200 }, // ѻ
-    { 37, 42, 41, 2, 41, 389, 20350 }, // Ѽ
-    { 33, 36, 36, 1, 35, 297, 20739 }, // ѽ
-    { 35, 34, 36, 0, 34, 298, 21036 }, // Ѿ
-    { 32, 28, 33, 0, 28, 224, 21334 }, // ѿ
-    { 23, 37, 25, 2, 28, 213, 21558 }, // Ҁ
-    { 18, 30, 20, 1, 21, 135, 21771 }, // ҁ
-    { 20, 25, 23, 1, 24, 125, 21906 }, // ҂
-    { 15, 7, 0, -18, 28, 27, 22031 }, // ҃
-    { 16, 7, 0, -18, 29, 28, 22058 }, // ҄
-    { 6, 8, 0, -13, 30, 12, 22086 }, // ҅
-    { 6, 8, 0, -13, 30, 12, 22098 }, // ҆
-    { 16, 7, 0, -8, 35, 28, 22110 }, // ҇
-    { 44, 40, 0, -22, 30, 440, 22138 }, // ҈
-    { 42, 42, 0, -21, 31, 441, 22578 }, // ҉
-    { 31, 44, 34, 3, 36, 341, 23019 }, // Ҋ
-    { 28, 38, 30, 2, 30, 266, 23360 }, // ҋ
-    { 23, 27, 24, 0, 27, 156, 23626 }, // Ҍ
-    { 22, 29, 23, 0, 29, 160, 23782 }, // ҍ
-    { 19, 27, 24, 3, 27, 129, 23942 }, // Ҏ
-    { 21, 30, 24, 2, 21, 158, 24071 }, // ҏ
-    { 18, 33, 22, 3, 33, 149, 24229 }, // Ґ
-    { 16, 27, 19, 2, 27, 108, 24378 }, // ґ
-    { 21, 27, 21, 0, 27, 142, 24486 }, // Ғ
-    { 18, 21, 18, 0, 21, 95, 24628 }, // ғ
-    { 23, 37, 28, 3, 27, 213, 24723 }, // Ҕ
-    { 20, 31, 23, 2, 21, 155, 24936 }, // ҕ
-    { 38, 35, 39, 0, 27, 333, 25091 }, // Җ
-    { 36, 29, 35, -1, 21, 261, 25424 }, // җ
-    { 20, 37, 22, 1, 28, 185, 25685 }, // Ҙ
-    { 17, 30, 19, 1, 21, 128, 25870 }, // ҙ
-    { 25, 35, 28, 3, 27, 219, 25998 }, // Қ
-    { 23, 29, 25, 2, 21, 167, 26217 }, // қ
-    { 23, 27, 25, 3, 27, 156, 26384 }, // Ҝ
-    { 22, 21, 23, 2, 21, 116, 26540 }, // ҝ
-    { 25, 27, 26, 1, 27, 169, 26656 }, // Ҟ
-    { 24, 29, 24, 0, 29, 174, 26825 }, // ҟ
-    { 28, 27, 27, 0, 27, 189, 26999 }, // Ҡ
-    { 27, 21, 26, 0, 21, 142, 27188 }, // ҡ
-    { 28, 35, 32, 3, 27, 245, 27330 }, // Ң
-    { 25, 29, 28, 2, 21, 182, 27575 }, // ң
-    { 29, 27, 31, 3, 27, 196, 27757 }, // Ҥ
-    { 27, 21, 28, 2, 21, 142, 27953 }, // ҥ
-    { 38, 37, 42, 3, 27, 352, 28095 }, // Ҧ
-    { 31, 31, 33, 2, 21, 241, 28447 }, // ҧ
-    { 27, 30, 29, 2, 28, 203, 28688 }, // Ҩ
-    { 23, 23, 25, 1, 21, 133, 28891 }, // ҩ
-    { 21, 37, 24, 2, 28, 195, 29024 }, // Ҫ
-    { 18, 30, 19, 1, 21, 135, 29219 }, // ҫ
-    { 21, 35, 22, 0, 27, 184, 29354 }, // Ҭ
-    { 20, 29, 21, 0, 21, 145, 29538 }, // ҭ
-    { 24, 27, 23, 0, 27, 162, 29683 }, // Ү
-    { 22, 30, 22, 0, 21, 165, 29845 }, // ү
-    { 24, 27, 23, 0, 27, 162, 30010 }, // Ұ
-    { 22, 30, 22, 0, 21, 165, 30172 }, // ұ
-    { 28, 35, 28, 0, 27, 245, 30337 }, // Ҳ
-    { 24, 29, 24, 0, 21, 174, 30582 }, // ҳ
-    { 35, 35, 35, 0, 27, 307, 30756 }, // Ҵ
-    { 30, 29, 30, 0, 21, 218, 31063 }, // ҵ
-    { 29, 35, 30, 1, 27, 254, 31281 }, // Ҷ
-    { 25, 29, 27, 2, 21, 182, 31535 }, // ҷ
-    { 23, 27, 28, 2, 27, 156, 31717 }, // Ҹ
-    { 20, 21, 25, 2, 21, 105, 31873 }, // ҹ
-    { 23, 27, 28, 3, 27, 156, 31978 }, // Һ
-    { 20, 29, 24, 2, 29, 145, 32134 }, // һ
-    { 33, 29, 36, 0, 28, 240, 32279 }, // Ҽ
-    { 26, 22, 27, -1, 21, 143, 32519 }, // ҽ
-    { 33, 36, 36, 0, 28, 297, 32662 }, // Ҿ
-    { 26, 29, 27, -1, 21, 189, 32959 }, // ҿ
-    { 13, 27, 15, 1, 27, 88, 33148 }, // Ӏ
-    { 38, 36, 37, 0, 36, 342, 33236 }, // Ӂ
-    { 33, 29, 32, 0, 29, 240, 33578 }, // ӂ
-    { 24, 37, 29, 3, 27, 222, 33818 }, // Ӄ
-    { 21, 31, 24, 2, 21, 163, 34040 }, // ӄ
-    { 31, 35, 31, 0, 27, 272, 34203 }, // Ӆ
-    { 27, 29, 27, 0, 21, 196, 34475 }, // ӆ
-    { 23, 37, 29, 3, 27, 213, 34671 }, // Ӈ
-    { 20, 31, 25, 2, 21, 155, 34884 }, // ӈ
-    { 29, 35, 32, 3, 27, 254, 35039 }, // Ӊ
-    { 26, 29, 28, 2, 21, 189, 35293 }, // ӊ
-    { 23, 35, 28, 2, 27, 202, 35482 }, // Ӌ
-    { 20, 29, 25, 2, 21, 145, 35684 }, // ӌ
-    { 36, 35, 39, 3, 27, 315, 35829 }, // Ӎ
-    { 33, 29, 35, 2, 21, 240, 36144 }, // ӎ
-    { 13, 27, 15, 1, 27, 88, 36384 }, // ӏ
-    { 26, 36, 26, 0, 36, 234, 36472 }, // Ӑ
-    { 19, 30, 22, 1, 29, 143, 36706 }, // ӑ
-    { 26, 35, 26, 0, 35, 228, 36849 }, // Ӓ
-    { 19, 30, 22, 1, 29, 143, 37077 }, // ӓ
-    { 34, 27, 36, 0, 27, 230, 37220 }, // Ӕ
-    { 32, 22, 34, 1, 21, 176, 37450 }, // ӕ
-    { 16, 36, 21, 3, 36, 144, 37626 }, // Ӗ
-    { 20, 30, 22, 1, 29, 150, 37770 }, // ӗ
-    { 26, 29, 31, 3, 28, 189, 37920 }, // Ә
-    { 20, 22, 22, 1, 21, 110, 38109 }, // ә
-    { 26, 36, 31, 3, 35, 234, 38219 }, // Ӛ
-    { 20, 30, 22, 1, 29, 150, 38453 }, // ӛ
-    { 38, 35, 37, 0, 35, 333, 38603 }, // Ӝ
-    { 33, 29, 32, 0, 29, 240, 38936 }, // ӝ
-    { 20, 36, 22, 1, 35, 180, 39176 }, // Ӟ
-    { 17, 30, 19, 1, 29, 128, 39356 }, // ӟ
-    { 20, 28, 22, 1, 27, 140, 39484 }, // Ӡ
-    { 20, 30, 22, 1, 21, 150, 39624 }, // ӡ
-    { 24, 33, 30, 3, 33, 198, 39774 }, // Ӣ
-    { 20, 27, 25, 3, 27, 135, 39972 }, // ӣ
-    { 24, 35, 30, 3, 35, 210, 40107 }, // Ӥ
-    { 20, 29, 25, 3, 29, 145, 40317 }, // ӥ
-    { 26, 36, 30, 2, 35, 234, 40462 }, // Ӧ
-    { 21, 30, 23, 1, 29, 158, 40696 }, // ӧ
-    { 26, 29, 30, 2, 28, 189, 40854 }, // Ө
-    { 21, 22, 23, 1, 21, 116, 41043 }, // ө
-    { 26, 36, 30, 2, 35, 234, 41159 }, // Ӫ
-    { 21, 30, 23, 1, 29, 158, 41393 }, // ӫ
-    { 22, 36, 25, 1, 35, 198, 41551 }, // Ӭ
-    { 18, 30, 20, 1, 29, 135, 41749 }, // ӭ
-    { 25, 34, 24, 0, 33, 213, 41884 }, // Ӯ
-    { 23, 36, 21, -1, 27, 207, 42097 }, // ӯ
-    { 25, 36, 24, 0, 35, 225, 42304 }, // Ӱ
-    { 23, 38, 21, -1, 29, 219, 42529 }, // ӱ
-    { 25, 36, 24, 0, 35, 225, 42748 }, // Ӳ
-    { 22, 38, 21, 0, 29, 209, 42973 }, // ӳ
-    { 22, 35, 27, 2, 35, 193, 43182 }, // Ӵ
-    { 19, 29, 24, 2, 29, 138, 43375 }, // ӵ
-    { 18, 35, 21, 3, 27, 158, 43513 }, // Ӷ
-    { 16, 29, 18, 2, 21, 116, 43671 }, // ӷ
-    { 29, 35, 35, 3, 35, 254, 43787 }, // Ӹ
-    { 27, 29, 32, 3, 29, 196, 44041 }, // ӹ
-    { 21, 37, 21, 0, 27, 195, 44237 }, // Ӻ
-    { 18, 30, 18, 0, 21, 135, 44432 }, // ӻ
-    { 27, 37, 27, 0, 27, 250, 44567 }, // Ӽ
-    { 23, 30, 24, 0, 21, 173, 44817 }, // ӽ
-    { 25, 27, 25, 0, 27, 169, 44990 }, // Ӿ
-    { 22, 21, 22, 0, 21, 116, 45159 }, // ӿ
-    { 0, 0, 19, 0, 0, 0, 0 }, //  
-    { 0, 0, 38, 0, 0, 0, 0 }, //  
-    { 0, 0, 19, 0, 0, 0, 0 }, //  
-    { 0, 0, 38, 0, 0, 0, 0 }, //  
-    { 0, 0, 12, 0, 0, 0, 0 }, //  
-    { 0, 0, 9, 0, 0, 0, 0 }, //  
-    { 0, 0, 6, 0, 0, 0, 0 }, //  
-    { 0, 0, 21, 0, 0, 0, 0 }, //  
-    { 0, 0, 11, 0, 0, 0, 0 }, //  
-    { 0, 0, 6, 0, 0, 0, 0 }, //  
-    { 0, 0, 4, 0, 0, 0, 0 }, //  
-    { 0, 0, 0, 0, 0, 0, 0 }, // ​
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‍
-    { 9, 31, 0, -1, 26, 70, 0 }, // ‎
-    { 9, 31, 0, -8, 26, 70, 70 }, // ‏
-    { 10, 6, 12, 1, 13, 15, 140 }, // ‐
-    { 10, 6, 12, 1, 13, 15, 155 }, // ‑
-    { 20, 5, 22, 1, 16, 25, 170 }, // ‒
-    { 17, 6, 19, 1, 13, 26, 195 }, // –
-    { 36, 6, 38, 1, 13, 54, 221 }, // —
-    { 36, 6, 38, 1, 13, 54, 275 }, // ―
-    { 15, 38, 21, 3, 29, 143, 329 }, // ‖
-    { 17, 9, 15, -1, 0, 39, 472 }, // ‗
-    { 8, 10, 8, 0, 27, 20, 511 }, // ‘
-    { 8, 10, 8, 0, 27, 20, 531 }, // ’
-    { 9, 10, 11, 0, 5, 23, 551 }, // ‚
-    { 8, 10, 8, 0, 27, 20, 574 }, // ‛
-    { 17, 10, 17, 0, 27, 43, 594 }, // “
-    { 17, 10, 17, 0, 27, 43, 637 }, // ”
-    { 16, 10, 19, 1, 5, 40, 680 }, // „
-    { 17, 10, 17, 0, 27, 43, 720 }, // ‟
-    { 16, 29, 19, 2, 29, 116, 763 }, // †
-    { 16, 29, 19, 2, 29, 116, 879 }, // ‡
-    { 12, 13, 14, 1, 20, 39, 995 }, // •
-    { 12, 15, 14, 2, 21, 45, 1034 }, // ‣
-    { 7, 7, 19, 6, 6, 13, 1079 }, // ․
-    { 18, 7, 22, 2, 6, 32, 1092 }, // ‥
-    { 28, 7, 32, 2, 6, 49, 1124 }, // …
-    { 7, 7, 11, 2, 13, 13, 1173 }, // ‧
-    { 0, 0, 23, 0, 0, 0, 1186 }, //  
-    { 0, 0, 23, 0, 0, 0, 1186 }, //  
-    { 9, 28, 0, -1, 23, 63, 1186 }, // ‪
-    { 9, 28, 0, -8, 23, 63, 1249 }, // ‫
-    { 10, 31, 0, -5, 26, 78, 1312 }, // ‬
-    { 10, 31, 0, -5, 26, 78, 1390 }, // ‭
-    { 10, 31, 0, -5, 26, 78, 1468 }, // ‮
-    { 0, 0, 6, 0, 0, 0, 1546 }, //  
-    { 46, 29, 48, 1, 28, 334, 1546 }, // ‰
-    { 61, 29, 63, 1, 28, 443, 1880 }, // ‱
-    { 11, 10, 11, 1, 27, 28, 2323 }, // ′
-    { 19, 10, 20, 1, 27, 48, 2351 }, // ″
-    { 28, 10, 28, 1, 27, 70, 2399 }, // ‴
-    { 11, 10, 16, 1, 27, 28, 2469 }, // ‵
-    { 20, 10, 24, 1, 27, 50, 2497 }, // ‶
-    { 28, 10, 32, 1, 27, 70, 2547 }, // ‷
-    { 15, 13, 15, 0, 4, 49, 2617 }, // ‸
-    { 12, 18, 14, 1, 19, 54, 2666 }, // ‹
-    { 12, 18, 14, 1, 19, 54, 2720 }, // ›
-    { 29, 29, 32, 1, 28, 211, 2774 }, // ※
-    { 18, 28, 21, 2, 27, 126, 2985 }, // ‼
-    { 17, 29, 18, 0, 28, 124, 3111 }, // ‽
-    { 20, 5, 19, -1, 33, 25, 3235 }, // ‾
-    { 23, 9, 23, 0, 0, 52, 3260 }, // ‿
-    { 23, 9, 23, 0, 30, 52, 3312 }, // ⁀
-    { 16, 25, 16, 0, 16, 100, 3364 }, // ⁁
-    { 42, 35, 42, 0, 29, 368, 3464 }, // ⁂
-    { 11, 6, 12, 1, 13, 17, 3832 }, // ⁃
-    { 21, 27, 5, -8, 27, 142, 3849 }, // ⁄
-    { 10, 33, 12, 2, 27, 83, 3991 }, // ⁅
-    { 10, 33, 12, 0, 27, 83, 4074 }, // ⁆
-    { 35, 29, 36, 0, 28, 254, 4157 }, // ⁇
-    { 27, 29, 29, 0, 28, 196, 4411 }, // ⁈
-    { 26, 29, 29, 2, 28, 189, 4607 }, // ⁉
-    { 19, 21, 22, 1, 21, 100, 4796 }, // ⁊
-    { 21, 34, 24, 2, 29, 179, 4896 }, // ⁋
-    { 21, 20, 25, 1, 21, 105, 5075 }, // ⁌
-    { 20, 20, 25, 3, 21, 100, 5180 }, // ⁍
-    { 19, 19, 20, 1, 10, 91, 5280 }, // ⁎
-    { 8, 26, 11, 2, 21, 52, 5371 }, // ⁏
-    { 23, 39, 23, 0, 30, 225, 5423 }, // ⁐
-    { 19, 38, 20, 1, 29, 181, 5648 }, // ⁑
-    { 16, 29, 16, 0, 28, 116, 5829 }, // ⁒
-    { 36, 8, 38, 1, 15, 72, 5945 }, // ⁓
-    { 23, 9, 23, 0, 0, 52, 6017 }, // ⁔
-    { 19, 19, 21, 1, 19, 91, 6069 }, // ⁕
-    { 18, 29, 22, 2, 28, 131, 6160 }, // ⁖
-    { 35, 10, 35, 1, 27, 88, 6291 }, // ⁗
-    { 29, 29, 33, 2, 28, 211, 6379 }, // ⁘
-    { 29, 29, 33, 2, 28, 211, 6590 }, // ⁙
-    { 7, 29, 11, 2, 28, 51, 6801 }, // ⁚
-    { 22, 31, 26, 2, 30, 171, 6852 }, // ⁛
-    { 30, 30, 32, 1, 28, 225, 7023 }, // ⁜
-    { 7, 30, 11, 2, 29, 53, 7248 }, // ⁝
-    { 7, 29, 11, 2, 28, 51, 7301 }, // ⁞
-    { 0, 0, 8, 0, 0, 0, 7352 }, //  
-    { 0, 0, 23, 0, 0, 0, 7352 }, // ⁠
-    { 0, 0, 23, 0, 0, 0, 7352 }, // ⁡
-    { 0, 0, 23, 0, 0, 0, 7352 }, // ⁢
-    { 0, 0, 23, 0, 0, 0, 7352 }, // ⁣
-    { 0, 0, 23, 0, 0, 0, 7352 }, // ⁤
-    { 0, 0, 0, 0, 0, 0, 7352 }, // ⁦
-    { 0, 0, 0, 0, 0, 0, 7352 }, // ⁧
-    { 0, 0, 0, 0, 0, 0, 7352 }, // ⁨
-    { 0, 0, 0, 0, 0, 0, 7352 }, // ⁩
-    { 10, 31, 0, -5, 26, 78, 7352 }, // ⁪
-    { 10, 31, 0, -5, 26, 78, 7430 }, // ⁫
-    { 10, 31, 0, -5, 26, 78, 7508 }, // ⁬
-    { 10, 31, 0, -5, 26, 78, 7586 }, // ⁭
-    { 10, 31, 0, -5, 26, 78, 7664 }, // ⁮
-    { 10, 31, 0, -5, 26, 78, 7742 }, // ⁯
-    { 14, 18, 14, 0, 33, 63, 0 }, // ⁰
-    { 5, 18, 7, 1, 28, 23, 63 }, // ⁱ
-    { 14, 17, 14, 0, 32, 60, 86 }, // ⁴
-    { 13, 17, 14, 1, 32, 56, 146 }, // ⁵
-    { 14, 17, 14, 0, 32, 60, 202 }, // ⁶
-    { 13, 17, 14, 1, 32, 56, 262 }, // ⁷
-    { 14, 18, 14, 0, 33, 63, 318 }, // ⁸
-    { 14, 18, 14, 0, 33, 63, 381 }, // ⁹
-    { 12, 11, 13, 1, 28, 33, 444 }, // ⁺
-    { 12, 3, 13, 1, 24, 9, 477 }, // ⁻
-    { 12, 8, 13, 1, 26, 24, 486 }, // ⁼
-    { 7, 21, 9, 2, 34, 37, 510 }, // ⁽
-    { 7, 21, 9, 0, 34, 37, 547 }, // ⁾
-    { 14, 14, 16, 1, 24, 49, 584 }, // ⁿ
-    { 14, 18, 14, 0, 13, 63, 633 }, // ₀
-    { 10, 17, 14, 1, 12, 43, 696 }, // ₁
-    { 13, 18, 14, 0, 13, 59, 739 }, // ₂
-    { 14, 17, 14, 0, 12, 60, 798 }, // ₃
-    { 14, 17, 14, 0, 12, 60, 858 }, // ₄
-    { 13, 17, 14, 1, 12, 56, 918 }, // ₅
-    { 14, 17, 14, 0, 12, 60, 974 }, // ₆
-    { 13, 17, 14, 1, 12, 56, 1034 }, // ₇
-    { 14, 18, 14, 0, 13, 63, 1090 }, // ₈
-    { 14, 18, 14, 0, 13, 63, 1153 }, // ₉
-    { 12, 11, 13, 1, 9, 33, 1216 }, // ₊
-    { 12, 3, 13, 1, 5, 9, 1249 }, // ₋
-    { 12, 8, 13, 1, 7, 24, 1258 }, // ₌
-    { 7, 21, 9, 2, 14, 37, 1282 }, // ₍
-    { 7, 21, 9, 0, 14, 37, 1319 }, // ₎
-    { 13, 13, 15, 0, 9, 43, 1356 }, // ₐ
-    { 13, 13, 15, 1, 9, 43, 1399 }, // ₑ
-    { 14, 13, 15, 1, 9, 46, 1442 }, // ₒ
-    { 14, 13, 14, 0, 9, 46, 1488 }, // ₓ
-    { 13, 13, 15, 1, 9, 43, 1534 }, // ₔ
-    { 14, 18, 16, 1, 14, 63, 1577 }, // ₕ
-    { 15, 18, 15, 1, 14, 68, 1640 }, // ₖ
-    { 5, 18, 7, 1, 14, 23, 1708 }, // ₗ
-    { 22, 13, 24, 1, 9, 72, 1731 }, // ₘ
-    { 14, 13, 16, 1, 9, 46, 1803 }, // ₙ
-    { 14, 18, 15, 1, 9, 63, 1849 }, // ₚ
-    { 11, 13, 12, 1, 9, 36, 1912 }, // ₛ
-    { 10, 16, 10, 0, 12, 40, 1948 }, // ₜ
-    { 21, 28, 21, 0, 28, 147, 0 }, // ₠
-    { 22, 32, 23, 1, 29, 176, 147 }, // ₡
-    { 20, 29, 21, 1, 28, 145, 323 }, // ₢
-    { 20, 27, 21, 0, 27, 135, 468 }, // ₣
-    { 20, 28, 21, 1, 28, 140, 603 }, // ₤
-    { 32, 30, 37, 2, 25, 240, 743 }, // ₥
-    { 22, 27, 21, 0, 27, 149, 983 }, // ₦
-    { 31, 28, 33, 2, 27, 217, 1132 }, // ₧
-    { 32, 28, 34, 2, 27, 224, 1349 }, // ₨
-    { 28, 27, 28, 0, 27, 189, 1573 }, // ₩
-    { 29, 27, 34, 3, 27, 196, 1762 }, // ₪
-    { 23, 35, 24, 1, 29, 202, 1958 }, // ₫
-    { 21, 28, 21, 1, 27, 147, 2160 }, // €
-    { 22, 27, 21, 0, 27, 149, 2307 }, // ₭
-    { 21, 27, 21, 0, 27, 142, 2456 }, // ₮
-    { 37, 37, 38, 0, 28, 343, 2598 }, // ₯
-    { 21, 37, 23, 0, 28, 195, 2941 }, // ₰
-    { 22, 27, 21, 0, 27, 149, 3136 }, // ₱
-    { 23, 32, 28, 2, 29, 184, 3285 }, // ₲
-    { 25, 27, 24, 0, 27, 169, 3469 }, // ₳
-    { 22, 29, 21, 0, 28, 160, 3638 }, // ₴
-    { 21, 32, 24, 2, 29, 168, 3798 }, // ₵
-    { 25, 26, 26, 0, 25, 163, 3966 }, // ₶
-    { 26, 31, 27, 0, 28, 202, 4129 }, // ₷
-    { 21, 27, 21, 0, 27, 142, 4331 }, // ₸
-    { 18, 27, 21, 2, 27, 122, 4473 }, // ₹
-    { 21, 28, 21, 0, 27, 147, 4595 }, // ₺
-    { 30, 29, 30, 0, 28, 218, 4742 }, // ₻
-    { 30, 27, 33, 1, 27, 203, 4960 }, // ₼
-    { 22, 27, 23, 0, 27, 149, 5163 }, // ₽
-    { 26, 29, 30, 2, 29, 189, 5312 }, // ₾
-    { 18, 35, 21, 3, 31, 158, 5501 }, // ₿
-    { 18, 28, 20, 1, 21, 126, 5659 }, // ⃀
-    { 19, 5, 22, 1, 16, 24, 0 }, // −
-    { 35, 35, 38, 1, 29, 307, 0 }, // �
+    { 21, 18, 23, 1, 19, 95, 11324 }, // «
+    { 19, 12, 21, 1, 16, 57, 1000 }, // ¬
+    { 10, 6, 12, 1, 13, 15, 1057 }, // ­
+    { 29, 29, 31, 1, 28, 211, 1072 }, // ®
+    { 20, 5, 19, -1, 33, 25, 1283 }, // ¯
+    { 14, 14, 16, 1, 28, 49, 1308 }, // °
+    { 19, 24, 21, 1, 24, 114, 1357 }, // ±
+    { 13, 18, 14, 0, 33, 59, 1471 }, // ²
+    { 14, 17, 14, 0, 32, 60, 1530 }, // ³
+    { 12, 7, 14, 1, 29, 21, 1590 }, // ´
+    { 20, 30, 24, 2, 21, 150, 1611 }, // µ
+    { 21, 34, 24, 1, 29, 179, 1761 }, // ¶
+    { 7, 7, 11, 2, 17, 13, 1940 }, // ·
+    { 10, 9, 10, 0, 0, 23, 1953 }, // ¸
+    { 10, 17, 14, 1, 32, 43, 1976 }, // ¹
+    { 13, 15, 14, 1, 28, 49, 2019 }, // º
+    { 21, 18, 23, 1, 19, 95, 11419 }, // »
+    { 31, 27, 31, 0, 27, 210, 2068 }, // ¼
+    { 32, 27, 33, 0, 27, 216, 2278 }, // ½
+    { 31, 28, 32, 1, 28, 217, 2494 }, // ¾
+    { 18, 28, 18, 0, 21, 126, 2711 }, // ¿
+    { 26, 35, 26, 0, 35, 228, 11514 }, // À
+    { 26, 35, 26, 0, 35, 228, 11742 }, // Á
+    { 26, 35, 26, 0, 35, 228, 11970 }, // Â
+    { 26, 35, 26, 0, 35, 228, 2837 }, // Ã
+    { 26, 35, 26, 0, 35, 228, 12198 }, // Ä
+    { 26, 34, 26, 0, 34, 221, 3065 }, // Å
+    { 34, 27, 36, 0, 27, 230, 3286 }, // Æ
+    { 21, 37, 24, 2, 28, 195, 12426 }, // Ç
+    { 16, 35, 21, 3, 35, 140, 12621 }, // È
+    { 16, 35, 21, 3, 35, 140, 12761 }, // É
+    { 16, 35, 21, 3, 35, 140, 12901 }, // Ê
+    { 16, 35, 21, 3, 35, 140, 13041 }, // Ë
+    { 14, 35, 15, 0, 35, 123, 13181 }, // Ì
+    { 14, 35, 15, 1, 35, 123, 13304 }, // Í
+    { 16, 35, 15, -1, 35, 140, 13427 }, // Î
+    { 14, 35, 15, 0, 35, 123, 13567 }, // Ï
+    { 26, 27, 27, 0, 27, 176, 3516 }, // Ð
+    { 25, 35, 30, 3, 35, 219, 13690 }, // Ñ
+    { 26, 36, 30, 2, 35, 234, 13909 }, // Ò
+    { 26, 36, 30, 2, 35, 234, 14143 }, // Ó
+    { 26, 36, 30, 2, 35, 234, 14377 }, // Ô
+    { 26, 36, 30, 2, 35, 234, 3692 }, // Õ
+    { 26, 36, 30, 2, 35, 234, 14611 }, // Ö
+    { 18, 18, 21, 2, 22, 81, 3926 }, // ×
+    { 26, 31, 30, 2, 29, 202, 4007 }, // Ø
+    { 23, 36, 28, 3, 35, 207, 14845 }, // Ù
+    { 23, 36, 28, 3, 35, 207, 15052 }, // Ú
+    { 23, 36, 28, 3, 35, 207, 15259 }, // Û
+    { 23, 36, 28, 3, 35, 207, 15466 }, // Ü
+    { 24, 35, 23, 0, 35, 210, 4209 }, // Ý
+    { 19, 27, 24, 3, 27, 129, 4419 }, // Þ
+    { 24, 30, 26, 2, 29, 180, 4548 }, // ß
+    { 19, 30, 22, 1, 29, 143, 15673 }, // à
+    { 19, 30, 22, 1, 29, 143, 15816 }, // á
+    { 19, 30, 22, 1, 29, 143, 15959 }, // â
+    { 19, 30, 22, 1, 29, 143, 4728 }, // ã
+    { 19, 30, 22, 1, 29, 143, 16102 }, // ä
+    { 19, 33, 22, 1, 32, 157, 4871 }, // å
+    { 32, 22, 34, 1, 21, 176, 5028 }, // æ
+    { 18, 30, 19, 1, 21, 135, 16245 }, // ç
+    { 20, 30, 22, 1, 29, 150, 16380 }, // è
+    { 20, 30, 22, 1, 29, 150, 16530 }, // é
+    { 20, 30, 22, 1, 29, 150, 16680 }, // ê
+    { 20, 30, 22, 1, 29, 150, 16830 }, // ë
+    { 12, 29, 11, -1, 29, 87, 16980 }, // ì
+    { 12, 29, 11, 2, 29, 87, 17067 }, // í
+    { 16, 29, 11, -2, 29, 116, 17154 }, // î
+    { 15, 29, 11, -2, 29, 109, 17270 }, // ï
+    { 21, 30, 24, 1, 29, 158, 5204 }, // ð
+    { 20, 29, 24, 2, 29, 145, 17379 }, // ñ
+    { 21, 30, 23, 1, 29, 158, 17524 }, // ò
+    { 21, 30, 23, 1, 29, 158, 17682 }, // ó
+    { 21, 30, 23, 1, 29, 158, 17840 }, // ô
+    { 21, 30, 23, 1, 29, 158, 5362 }, // õ
+    { 21, 30, 23, 1, 29, 158, 17998 }, // ö
+    { 19, 19, 21, 1, 23, 91, 5520 }, // ÷
+    { 21, 24, 23, 1, 22, 126, 5611 }, // ø
+    { 20, 30, 24, 2, 29, 150, 18156 }, // ù
+    { 20, 30, 24, 2, 29, 150, 18306 }, // ú
+    { 20, 30, 24, 2, 29, 150, 18456 }, // û
+    { 20, 30, 24, 2, 29, 150, 18606 }, // ü
+    { 22, 38, 21, 0, 29, 209, 5737 }, // ý
+    { 20, 38, 24, 2, 29, 190, 5946 }, // þ
+    { 22, 38, 21, 0, 29, 209, 6136 }, // ÿ
+    { 26, 33, 26, 0, 33, 215, 6345 }, // Ā
+    { 19, 28, 22, 1, 27, 133, 6560 }, // ā
+    { 26, 35, 26, 0, 35, 228, 6693 }, // Ă
+    { 19, 30, 22, 1, 29, 143, 6921 }, // ă
+    { 26, 36, 26, 0, 27, 234, 7064 }, // Ą
+    { 20, 30, 22, 1, 21, 150, 7298 }, // ą
+    { 21, 36, 24, 2, 35, 189, 7448 }, // Ć
+    { 18, 30, 19, 1, 29, 135, 7637 }, // ć
+    { 21, 36, 24, 2, 35, 189, 7772 }, // Ĉ
+    { 18, 30, 19, 1, 29, 135, 7961 }, // ĉ
+    { 21, 36, 24, 2, 35, 189, 8096 }, // Ċ
+    { 18, 30, 19, 1, 29, 135, 8285 }, // ċ
+    { 21, 36, 24, 2, 35, 189, 8420 }, // Č
+    { 19, 30, 19, 1, 29, 143, 8609 }, // č
+    { 23, 35, 27, 3, 35, 202, 8752 }, // Ď
+    { 28, 30, 24, 1, 29, 210, 8954 }, // ď
+    { 26, 27, 27, 0, 27, 176, 9164 }, // Đ
+    { 23, 30, 24, 1, 29, 173, 9340 }, // đ
+    { 16, 33, 21, 3, 33, 132, 9513 }, // Ē
+    { 20, 28, 22, 1, 27, 140, 9645 }, // ē
+    { 16, 35, 21, 3, 35, 140, 9785 }, // Ĕ
+    { 20, 30, 22, 1, 29, 150, 9925 }, // ĕ
+    { 16, 35, 21, 3, 35, 140, 10075 }, // Ė
+    { 20, 30, 22, 1, 29, 150, 10215 }, // ė
+    { 16, 36, 21, 3, 27, 144, 10365 }, // Ę
+    { 20, 30, 22, 1, 21, 150, 10509 }, // ę
+    { 17, 35, 21, 3, 35, 149, 10659 }, // Ě
+    { 20, 30, 22, 1, 29, 150, 10808 }, // ě
+    { 23, 36, 27, 2, 35, 207, 10958 }, // Ĝ
+    { 20, 38, 24, 1, 29, 190, 11165 }, // ĝ
+    { 23, 36, 27, 2, 35, 207, 11355 }, // Ğ
+    { 20, 38, 24, 1, 29, 190, 11562 }, // ğ
+    { 23, 36, 27, 2, 35, 207, 11752 }, // Ġ
+    { 20, 38, 24, 1, 29, 190, 11959 }, // ġ
+    { 23, 37, 27, 2, 28, 213, 12149 }, // Ģ
+    { 20, 38, 24, 1, 29, 190, 12362 }, // ģ
+    { 23, 35, 29, 3, 35, 202, 12552 }, // Ĥ
+    { 24, 37, 24, -2, 37, 222, 12754 }, // ĥ
+    { 29, 27, 29, 0, 27, 196, 12976 }, // Ħ
+    { 22, 29, 25, 0, 29, 160, 13172 }, // ħ
+    { 16, 35, 15, -2, 35, 140, 13332 }, // Ĩ
+    { 16, 29, 11, -2, 29, 116, 13472 }, // ĩ
+    { 13, 33, 15, 1, 33, 108, 13588 }, // Ī
+    { 13, 27, 11, -1, 27, 88, 13696 }, // ī
+    { 15, 35, 15, 0, 35, 132, 13784 }, // Ĭ
+    { 16, 29, 11, -2, 29, 116, 13916 }, // ĭ
+    { 13, 36, 15, 1, 27, 117, 14032 }, // Į
+    { 8, 38, 11, 1, 29, 76, 14149 }, // į
+    { 13, 35, 15, 1, 35, 114, 14225 }, // İ
+    { 7, 21, 11, 2, 21, 37, 14339 }, // ı
+    { 24, 35, 27, 1, 27, 210, 14376 }, // Ĳ
+    { 19, 38, 23, 2, 29, 181, 14586 }, // ĳ
+    { 17, 43, 12, -3, 35, 183, 14767 }, // Ĵ
+    { 16, 38, 11, -2, 29, 152, 14950 }, // ĵ
+    { 22, 36, 25, 3, 27, 198, 15102 }, // Ķ
+    { 22, 38, 23, 2, 29, 209, 15300 }, // ķ
+    { 22, 21, 23, 2, 21, 116, 15509 }, // ĸ
+    { 18, 35, 21, 2, 35, 158, 15625 }, // Ĺ
+    { 12, 37, 11, 2, 37, 111, 15783 }, // ĺ
+    { 17, 36, 21, 3, 27, 153, 15894 }, // Ļ
+    { 7, 38, 11, 2, 29, 67, 16047 }, // ļ
+    { 18, 27, 21, 3, 27, 122, 16114 }, // Ľ
+    { 15, 29, 11, 2, 29, 109, 16236 }, // ľ
+    { 17, 27, 21, 3, 27, 115, 16345 }, // Ŀ
+    { 14, 29, 14, 2, 29, 102, 16460 }, // ŀ
+    { 20, 27, 21, 0, 27, 135, 16562 }, // Ł
+    { 13, 29, 11, -1, 29, 95, 16697 }, // ł
+    { 25, 35, 30, 3, 35, 219, 16792 }, // Ń
+    { 20, 29, 24, 2, 29, 145, 17011 }, // ń
+    { 25, 36, 30, 3, 27, 225, 17156 }, // Ņ
+    { 20, 30, 24, 2, 21, 150, 17381 }, // ņ
+    { 25, 35, 30, 3, 35, 219, 17531 }, // Ň
+    { 20, 29, 24, 2, 29, 145, 17750 }, // ň
+    { 28, 27, 29, -1, 27, 189, 17895 }, // ŉ
+    { 25, 35, 30, 3, 27, 219, 18084 }, // Ŋ
+    { 20, 30, 24, 2, 21, 150, 18303 }, // ŋ
+    { 26, 34, 30, 2, 33, 221, 18453 }, // Ō
+    { 21, 28, 23, 1, 27, 147, 18674 }, // ō
+    { 26, 36, 30, 2, 35, 234, 18821 }, // Ŏ
+    { 21, 30, 23, 1, 29, 158, 19055 }, // ŏ
+    { 26, 36, 30, 2, 35, 234, 19213 }, // Ő
+    { 21, 30, 23, 1, 29, 158, 19447 }, // ő
+    { 33, 29, 36, 2, 28, 240, 18756 }, // Œ
+    { 35, 22, 37, 1, 21, 193, 18996 }, // œ
+    { 22, 35, 25, 3, 35, 193, 19605 }, // Ŕ
+    { 15, 29, 17, 2, 29, 109, 19798 }, // ŕ
+    { 22, 36, 25, 3, 27, 198, 19907 }, // Ŗ
+    { 15, 30, 17, 2, 21, 113, 20105 }, // ŗ
+    { 22, 35, 25, 3, 35, 193, 20218 }, // Ř
+    { 17, 29, 17, 1, 29, 124, 20411 }, // ř
+    { 19, 36, 21, 1, 35, 171, 20535 }, // Ś
+    { 17, 30, 19, 1, 29, 128, 20706 }, // ś
+    { 19, 36, 21, 1, 35, 171, 20834 }, // Ŝ
+    { 17, 30, 19, 1, 29, 128, 21005 }, // ŝ
+    { 19, 37, 21, 1, 28, 176, 21133 }, // Ş
+    { 17, 30, 19, 1, 21, 128, 21309 }, // ş
+    { 19, 36, 21, 1, 35, 171, 21437 }, // Š
+    { 17, 30, 19, 1, 29, 128, 21608 }, // š
+    { 21, 36, 22, 0, 27, 189, 21736 }, // Ţ
+    { 16, 34, 16, 0, 25, 136, 21925 }, // ţ
+    { 21, 35, 22, 0, 35, 184, 22061 }, // Ť
+    { 22, 30, 16, 0, 29, 165, 22245 }, // ť
+    { 21, 27, 22, 0, 27, 142, 22410 }, // Ŧ
+    { 16, 26, 16, 0, 25, 104, 22552 }, // ŧ
+    { 23, 36, 28, 3, 35, 207, 22656 }, // Ũ
+    { 20, 30, 24, 2, 29, 150, 22863 }, // ũ
+    { 23, 34, 28, 3, 33, 196, 23013 }, // Ū
+    { 20, 28, 24, 2, 27, 140, 23209 }, // ū
+    { 23, 36, 28, 3, 35, 207, 23349 }, // Ŭ
+    { 20, 30, 24, 2, 29, 150, 23556 }, // ŭ
+    { 23, 39, 28, 3, 38, 225, 23706 }, // Ů
+    { 20, 33, 24, 2, 32, 165, 23931 }, // ů
+    { 23, 36, 28, 3, 35, 207, 24096 }, // Ű
+    { 20, 30, 24, 2, 29, 150, 24303 }, // ű
+    { 23, 36, 28, 3, 27, 207, 24453 }, // Ų
+    { 20, 30, 24, 2, 21, 150, 24660 }, // ų
+    { 37, 35, 36, 0, 35, 324, 24810 }, // Ŵ
+    { 32, 29, 32, 0, 29, 232, 25134 }, // ŵ
+    { 24, 35, 23, 0, 35, 210, 25366 }, // Ŷ
+    { 22, 38, 21, 0, 29, 209, 25576 }, // ŷ
+    { 24, 35, 23, 0, 35, 210, 25785 }, // Ÿ
+    { 21, 35, 22, 0, 35, 184, 25995 }, // Ź
+    { 17, 29, 18, 1, 29, 124, 26179 }, // ź
+    { 21, 35, 22, 0, 35, 184, 26303 }, // Ż
+    { 17, 29, 18, 1, 29, 124, 26487 }, // ż
+    { 21, 35, 22, 0, 35, 184, 26611 }, // Ž
+    { 17, 29, 18, 1, 29, 124, 26795 }, // ž
+    { 14, 29, 14, 2, 29, 102, 26919 }, // ſ
+    { 11, 7, 0, -20, 29, 20, 27021 }, // ̀
+    { 12, 7, 0, -14, 29, 21, 27041 }, // ́
+    { 16, 7, 0, -8, 29, 28, 27062 }, // ̂
+    { 16, 7, 0, -21, 29, 28, 27090 }, // ̃
+    { 14, 5, 0, -7, 27, 18, 27118 }, // ̄
+    { 16, 5, 0, -8, 32, 20, 27136 }, // ̅
+    { 15, 7, 0, -7, 29, 27, 27156 }, // ̆
+    { 8, 6, 0, -4, 29, 12, 27183 }, // ̇
+    { 14, 6, 0, -7, 29, 21, 27195 }, // ̈
+    { 9, 10, 0, -16, 32, 23, 27216 }, // ̉
+    { 10, 10, 0, -5, 32, 25, 27239 }, // ̊
+    { 17, 7, 0, -6, 29, 30, 27264 }, // ̋
+    { 17, 7, 0, -8, 29, 30, 27294 }, // ̌
+    { 4, 7, 0, -2, 29, 7, 27324 }, // ̍
+    { 12, 7, 0, -6, 29, 21, 27331 }, // ̎
+    { 17, 7, 0, -22, 29, 30, 27352 }, // ̏
+    { 14, 10, 0, -7, 32, 35, 27382 }, // ̐
+    { 16, 7, 0, -8, 29, 28, 27417 }, // ̑
+    { 8, 10, 0, -4, 27, 20, 27445 }, // ̒
+    { 8, 10, 0, -4, 27, 20, 27465 }, // ̓
+    { 8, 10, 0, -4, 27, 20, 27485 }, // ̔
+    { 8, 10, 0, -4, 27, 20, 27505 }, // ̕
+    { 12, 7, 0, -7, -1, 21, 27525 }, // ̖
+    { 12, 7, 0, -6, -1, 21, 27546 }, // ̗
+    { 8, 8, 0, -4, -1, 16, 27567 }, // ̘
+    { 8, 8, 0, -4, -1, 16, 27583 }, // ̙
+    { 10, 10, 11, 0, 29, 25, 27599 }, // ̚
+    { 10, 9, 0, -4, 29, 23, 27624 }, // ̛
+    { 6, 9, 0, -3, 0, 14, 27647 }, // ̜
+    { 8, 7, 0, -4, -1, 14, 27661 }, // ̝
+    { 8, 7, 0, -4, -1, 14, 27675 }, // ̞
+    { 8, 8, 0, -4, -1, 16, 27689 }, // ̟
+    { 9, 3, 0, -5, -3, 7, 27705 }, // ̠
+    { 9, 11, 0, -9, 2, 25, 27712 }, // ̡
+    { 9, 11, 0, 0, 2, 25, 27737 }, // ̢
+    { 7, 6, 0, -16, -2, 11, 27762 }, // ̣
+    { 14, 6, 0, -7, -2, 21, 27773 }, // ̤
+    { 10, 10, 0, -5, 1, 25, 27794 }, // ̥
+    { 8, 7, 0, -4, -2, 14, 27819 }, // ̦
+    { 10, 9, 0, -5, 0, 23, 27833 }, // ̧
+    { 8, 10, 0, -4, 1, 20, 27856 }, // ̨
+    { 4, 7, 0, -2, -1, 7, 27876 }, // ̩
+    { 14, 8, 0, -7, -1, 28, 27883 }, // ̪
+    { 16, 5, 0, -8, -2, 20, 27911 }, // ̫
+    { 17, 7, 0, -8, -1, 30, 27931 }, // ̬
+    { 16, 7, 0, -8, -1, 28, 27961 }, // ̭
+    { 16, 7, 0, -8, -2, 28, 27989 }, // ̮
+    { 16, 7, 0, -8, -2, 28, 28017 }, // ̯
+    { 16, 7, 0, -8, -1, 28, 28045 }, // ̰
+    { 14, 5, 0, -7, -2, 18, 28073 }, // ̱
+    { 18, 3, 0, -9, -3, 14, 28091 }, // ̲
+    { 16, 9, 0, -9, 0, 36, 28105 }, // ̳
+    { 16, 7, 0, -8, 14, 28, 28141 }, // ̴
+    { 16, 5, 0, -8, 13, 20, 28169 }, // ̵
+    { 28, 5, 0, -14, 13, 35, 28189 }, // ̶
+    { 14, 11, 0, -7, 16, 39, 28224 }, // ̷
+    { 16, 32, 0, -8, 29, 128, 28263 }, // ̸
+    { 6, 9, 0, -3, 0, 14, 28391 }, // ̹
+    { 14, 8, 0, -7, -1, 28, 28405 }, // ̺
+    { 16, 8, 0, -8, -1, 32, 28433 }, // ̻
+    { 16, 5, 0, -8, -2, 20, 28465 }, // ̼
+    { 8, 9, 0, -4, 30, 18, 28485 }, // ̽
+    { 6, 12, 0, -3, 33, 18, 28503 }, // ̾
+    { 16, 9, 0, -9, 37, 36, 28521 }, // ̿
+    { 12, 7, 0, -9, 29, 21, 28557 }, // ̀
+    { 12, 7, 0, -3, 29, 21, 28578 }, // ́
+    { 16, 7, 0, -8, 29, 28, 28599 }, // ͂
+    { 7, 8, 0, -4, 30, 14, 28627 }, // ̓
+    { 20, 8, 0, -8, 30, 40, 28641 }, // ̈́
+    { 8, 8, 0, -2, -1, 16, 28681 }, // ͅ
+    { 18, 7, 0, -9, 29, 32, 28697 }, // ͆
+    { 16, 9, 0, -9, 0, 36, 28729 }, // ͇
+    { 12, 7, 0, -6, -1, 21, 28765 }, // ͈
+    { 8, 7, 0, -4, -2, 14, 28786 }, // ͉
+    { 14, 8, 0, -7, 29, 28, 28800 }, // ͊
+    { 15, 16, 0, -8, 36, 60, 28828 }, // ͋
+    { 14, 11, 0, -7, 33, 39, 28888 }, // ͌
+    { 14, 8, 0, -7, -1, 28, 28927 }, // ͍
+    { 8, 9, 0, -4, 0, 18, 28955 }, // ͎
+    { 28, 27, 0, -14, 27, 189, 28973 }, // ͏
+    { 7, 8, 0, -4, 30, 14, 29162 }, // ͐
+    { 5, 10, 0, -2, 31, 13, 29176 }, // ͑
+    { 14, 10, 0, -7, 32, 35, 29189 }, // ͒
+    { 8, 8, 0, -4, -1, 16, 29224 }, // ͓
+    { 7, 8, 0, -4, -1, 14, 29240 }, // ͔
+    { 7, 8, 0, -4, -1, 14, 29254 }, // ͕
+    { 15, 8, 0, -7, -1, 30, 29268 }, // ͖
+    { 5, 10, 0, -2, 32, 13, 29298 }, // ͗
+    { 7, 6, 0, 3, 29, 11, 29311 }, // ͘
+    { 8, 8, 0, -4, -1, 16, 29322 }, // ͙
+    { 16, 8, 0, -8, -1, 32, 29338 }, // ͚
+    { 8, 8, 0, -4, 30, 16, 29370 }, // ͛
+    { 30, 8, 0, -15, -1, 60, 29386 }, // ͜
+    { 30, 8, 0, -15, 30, 60, 29446 }, // ͝
+    { 24, 4, 0, -12, 26, 24, 29506 }, // ͞
+    { 24, 4, 0, -12, -2, 24, 29530 }, // ͟
+    { 30, 7, 0, -15, 29, 53, 29554 }, // ͠
+    { 30, 8, 0, -15, 33, 60, 29607 }, // ͡
+    { 31, 9, 0, -15, 0, 70, 29667 }, // ͢
+    { 10, 9, 0, -5, 32, 23, 29737 }, // ͣ
+    { 9, 9, 0, -4, 32, 21, 29760 }, // ͤ
+    { 3, 12, 0, -1, 35, 9, 29781 }, // ͥ
+    { 10, 9, 0, -5, 32, 23, 29790 }, // ͦ
+    { 9, 9, 0, -4, 32, 21, 29813 }, // ͧ
+    { 9, 9, 0, -4, 32, 21, 29834 }, // ͨ
+    { 10, 12, 0, -5, 35, 30, 29855 }, // ͩ
+    { 9, 12, 0, -4, 35, 27, 29885 }, // ͪ
+    { 15, 9, 0, -7, 32, 34, 29912 }, // ͫ
+    { 7, 9, 0, -3, 32, 16, 29946 }, // ͬ
+    { 7, 11, 0, -3, 34, 20, 29962 }, // ͭ
+    { 11, 9, 0, -5, 32, 25, 29982 }, // ͮ
+    { 11, 9, 0, -5, 32, 25, 30007 }, // ͯ
+    { 16, 35, 21, 3, 35, 140, 30032 }, // Ѐ
+    { 16, 35, 21, 3, 35, 140, 0 }, // Ё
+    { 28, 28, 29, 0, 27, 196, 30172 }, // Ђ
+    { 17, 35, 21, 3, 35, 149, 30368 }, // Ѓ
+    { 23, 29, 24, 1, 28, 167, 30517 }, // Є
+    { 19, 29, 21, 1, 28, 138, 30684 }, // Ѕ
+    { 6, 27, 12, 3, 27, 41, 30822 }, // І
+    { 12, 35, 12, 0, 35, 105, 30863 }, // Ї
+    { 13, 35, 12, -3, 27, 114, 30968 }, // Ј
+    { 38, 28, 39, 0, 27, 266, 31082 }, // Љ
+    { 36, 27, 40, 3, 27, 243, 31348 }, // Њ
+    { 27, 27, 29, 0, 27, 183, 31591 }, // Ћ
+    { 23, 35, 26, 3, 35, 202, 31774 }, // Ќ
+    { 24, 35, 30, 3, 35, 210, 31976 }, // Ѝ
+    { 25, 37, 24, 0, 36, 232, 32186 }, // Ў
+    { 23, 33, 29, 3, 27, 190, 32418 }, // Џ
+    { 26, 27, 26, 0, 27, 176, 140 }, // А
+    { 20, 27, 24, 3, 27, 135, 316 }, // Б
+    { 21, 27, 25, 3, 27, 142, 451 }, // В
+    { 17, 27, 21, 3, 27, 115, 593 }, // Г
+    { 29, 33, 29, 0, 27, 240, 708 }, // Д
+    { 16, 27, 21, 3, 27, 108, 948 }, // Е
+    { 38, 27, 37, 0, 27, 257, 1056 }, // Ж
+    { 20, 29, 22, 1, 28, 145, 1313 }, // З
+    { 24, 27, 30, 3, 27, 162, 1458 }, // И
+    { 24, 36, 30, 3, 36, 216, 1620 }, // Й
+    { 23, 27, 26, 3, 27, 156, 1836 }, // К
+    { 25, 28, 27, 0, 27, 175, 1992 }, // Л
+    { 29, 27, 35, 3, 27, 196, 2167 }, // М
+    { 23, 27, 29, 3, 27, 156, 2363 }, // Н
+    { 27, 29, 29, 1, 28, 196, 2519 }, // О
+    { 23, 27, 29, 3, 27, 156, 2715 }, // П
+    { 19, 27, 23, 3, 27, 129, 2871 }, // Р
+    { 22, 29, 24, 1, 28, 160, 3000 }, // С
+    { 21, 27, 22, 0, 27, 142, 3160 }, // Т
+    { 25, 28, 24, 0, 27, 175, 3302 }, // У
+    { 30, 29, 34, 2, 28, 218, 3477 }, // Ф
+    { 26, 27, 25, 0, 27, 176, 3695 }, // Х
+    { 26, 33, 29, 3, 27, 215, 3871 }, // Ц
+    { 22, 27, 27, 2, 27, 149, 4086 }, // Ч
+    { 34, 27, 40, 3, 27, 230, 4235 }, // Ш
+    { 37, 33, 40, 3, 27, 306, 4465 }, // Щ
+    { 27, 27, 28, 0, 27, 183, 4771 }, // Ъ
+    { 29, 27, 35, 3, 27, 196, 4954 }, // Ы
+    { 20, 27, 24, 3, 27, 135, 5150 }, // Ь
+    { 22, 29, 25, 1, 28, 160, 5285 }, // Э
+    { 34, 29, 38, 3, 28, 247, 5445 }, // Ю
+    { 23, 27, 26, 0, 27, 156, 5692 }, // Я
+    { 19, 22, 22, 1, 21, 105, 5848 }, // а
+    { 21, 30, 23, 1, 29, 158, 5953 }, // б
+    { 19, 21, 22, 2, 21, 100, 6111 }, // в
+    { 15, 21, 18, 3, 21, 79, 6211 }, // г
+    { 24, 27, 24, 0, 21, 162, 6290 }, // д
+    { 20, 22, 22, 1, 21, 110, 6452 }, // е
+    { 33, 21, 32, 0, 21, 174, 6562 }, // ж
+    { 17, 22, 19, 1, 21, 94, 6736 }, // з
+    { 20, 21, 25, 3, 21, 105, 6830 }, // и
+    { 20, 29, 25, 3, 29, 145, 6935 }, // й
+    { 20, 21, 23, 3, 21, 105, 7080 }, // к
+    { 21, 22, 23, 0, 21, 116, 7185 }, // л
+    { 26, 21, 31, 3, 21, 137, 7301 }, // м
+    { 19, 21, 25, 3, 21, 100, 7438 }, // н
+    { 21, 22, 23, 1, 21, 116, 7538 }, // о
+    { 19, 21, 24, 3, 21, 100, 7654 }, // п
+    { 20, 30, 24, 3, 21, 150, 7754 }, // р
+    { 18, 22, 20, 1, 21, 99, 7904 }, // с
+    { 19, 21, 19, 0, 21, 100, 8003 }, // т
+    { 23, 30, 21, -1, 21, 173, 8103 }, // у
+    { 28, 38, 30, 1, 29, 266, 8276 }, // ф
+    { 22, 21, 22, 0, 21, 116, 8542 }, // х
+    { 22, 27, 24, 2, 21, 149, 8658 }, // ц
+    { 19, 21, 24, 2, 21, 100, 8807 }, // ч
+    { 30, 21, 36, 3, 21, 158, 8907 }, // ш
+    { 33, 27, 36, 3, 21, 223, 9065 }, // щ
+    { 24, 21, 25, 0, 21, 126, 9288 }, // ъ
+    { 27, 21, 32, 3, 21, 142, 9414 }, // ы
+    { 18, 21, 22, 3, 21, 95, 9556 }, // ь
+    { 18, 22, 20, 1, 21, 99, 9651 }, // э
+    { 28, 22, 32, 3, 21, 154, 9750 }, // ю
+    { 20, 21, 23, 0, 21, 105, 9904 }, // я
+    { 20, 30, 22, 1, 29, 150, 32608 }, // ѐ
+    { 20, 29, 22, 1, 28, 145, 10009 }, // ё
+    { 22, 38, 24, 0, 29, 209, 32758 }, // ђ
+    { 15, 29, 18, 3, 29, 109, 32967 }, // ѓ
+    { 18, 22, 20, 1, 21, 99, 33076 }, // є
+    { 17, 22, 19, 1, 21, 94, 33175 }, // ѕ
+    { 7, 29, 12, 2, 29, 51, 33269 }, // і
+    { 11, 29, 11, 0, 29, 80, 33320 }, // ї
+    { 11, 38, 11, -2, 29, 105, 33400 }, // ј
+    { 33, 22, 34, 0, 21, 182, 33505 }, // љ
+    { 31, 21, 35, 3, 21, 163, 33687 }, // њ
+    { 22, 29, 24, 0, 29, 160, 33850 }, // ћ
+    { 20, 29, 23, 3, 29, 145, 34010 }, // ќ
+    { 20, 29, 25, 3, 29, 145, 34155 }, // ѝ
+    { 23, 38, 21, -1, 29, 219, 34300 }, // ў
+    { 19, 27, 24, 3, 21, 129, 34519 }, // џ
+    { 35, 27, 36, 0, 27, 237, 34648 }, // Ѡ
+    { 32, 21, 33, 0, 21, 168, 34885 }, // ѡ
+    { 24, 27, 25, 0, 27, 162, 35053 }, // Ѣ
+    { 24, 25, 25, 0, 25, 150, 35215 }, // ѣ
+    { 32, 29, 36, 3, 28, 232, 35365 }, // Ѥ
+    { 27, 22, 30, 2, 21, 149, 35597 }, // ѥ
+    { 28, 27, 27, 0, 27, 189, 35746 }, // Ѧ
+    { 24, 21, 24, 0, 21, 126, 35935 }, // ѧ
+    { 35, 27, 38, 3, 27, 237, 36061 }, // Ѩ
+    { 32, 21, 34, 2, 21, 168, 36298 }, // ѩ
+    { 30, 27, 30, 0, 27, 203, 36466 }, // Ѫ
+    { 23, 21, 23, 0, 21, 121, 36669 }, // ѫ
+    { 37, 27, 40, 3, 27, 250, 36790 }, // Ѭ
+    { 31, 21, 33, 2, 21, 163, 37040 }, // ѭ
+    { 23, 42, 24, 0, 33, 242, 37203 }, // Ѯ
+    { 20, 35, 21, 0, 26, 175, 37445 }, // ѯ
+    { 27, 27, 33, 3, 27, 183, 37620 }, // Ѱ
+    { 27, 38, 32, 2, 29, 257, 37803 }, // ѱ
+    { 26, 29, 30, 2, 28, 189, 38060 }, // Ѳ
+    { 21, 22, 23, 1, 21, 116, 38249 }, // ѳ
+    { 27, 27, 27, 0, 27, 183, 38365 }, // Ѵ
+    { 23, 21, 23, 0, 21, 121, 38548 }, // ѵ
+    { 27, 35, 27, 0, 35, 237, 38669 }, // Ѷ
+    { 23, 29, 23, 0, 29, 167, 38906 }, // ѷ
+    { 48, 37, 49, 2, 28, 444, 39073 }, // Ѹ
+    { 44, 30, 44, 1, 21, 330, 39517 }, // ѹ
+    { 28, 33, 31, 2, 30, 231, 39847 }, // Ѻ
+    { 23, 26, 26, 1, 23, 150, 40078 }, // ѻ
+    { 37, 42, 41, 2, 41, 389, 40228 }, // Ѽ
+    { 33, 36, 36, 1, 35, 297, 40617 }, // ѽ
+    { 35, 34, 36, 0, 34, 298, 40914 }, // Ѿ
+    { 32, 28, 33, 0, 28, 224, 41212 }, // ѿ
+    { 23, 37, 25, 2, 28, 213, 41436 }, // Ҁ
+    { 18, 30, 20, 1, 21, 135, 41649 }, // ҁ
+    { 20, 25, 23, 1, 24, 125, 41784 }, // ҂
+    { 15, 7, 0, -18, 28, 27, 41909 }, // ҃
+    { 16, 7, 0, -18, 29, 28, 41936 }, // ҄
+    { 6, 8, 0, -13, 30, 12, 41964 }, // ҅
+    { 6, 8, 0, -13, 30, 12, 41976 }, // ҆
+    { 16, 7, 0, -8, 35, 28, 41988 }, // ҇
+    { 44, 40, 0, -22, 30, 440, 42016 }, // ҈
+    { 42, 42, 0, -21, 31, 441, 42456 }, // ҉
+    { 31, 44, 34, 3, 36, 341, 42897 }, // Ҋ
+    { 28, 38, 30, 2, 30, 266, 43238 }, // ҋ
+    { 23, 27, 24, 0, 27, 156, 43504 }, // Ҍ
+    { 22, 29, 23, 0, 29, 160, 43660 }, // ҍ
+    { 19, 27, 24, 3, 27, 129, 43820 }, // Ҏ
+    { 21, 30, 24, 2, 21, 158, 43949 }, // ҏ
+    { 18, 33, 22, 3, 33, 149, 44107 }, // Ґ
+    { 16, 27, 19, 2, 27, 108, 44256 }, // ґ
+    { 21, 27, 21, 0, 27, 142, 44364 }, // Ғ
+    { 18, 21, 18, 0, 21, 95, 44506 }, // ғ
+    { 23, 37, 28, 3, 27, 213, 44601 }, // Ҕ
+    { 20, 31, 23, 2, 21, 155, 44814 }, // ҕ
+    { 38, 35, 39, 0, 27, 333, 0 }, // Җ
+    { 36, 29, 35, -1, 21, 261, 333 }, // җ
+    { 20, 37, 22, 1, 28, 185, 594 }, // Ҙ
+    { 17, 30, 19, 1, 21, 128, 779 }, // ҙ
+    { 25, 35, 28, 3, 27, 219, 907 }, // Қ
+    { 23, 29, 25, 2, 21, 167, 1126 }, // қ
+    { 23, 27, 25, 3, 27, 156, 1293 }, // Ҝ
+    { 22, 21, 23, 2, 21, 116, 1449 }, // ҝ
+    { 25, 27, 26, 1, 27, 169, 1565 }, // Ҟ
+    { 24, 29, 24, 0, 29, 174, 1734 }, // ҟ
+    { 28, 27, 27, 0, 27, 189, 1908 }, // Ҡ
+    { 27, 21, 26, 0, 21, 142, 2097 }, // ҡ
+    { 28, 35, 32, 3, 27, 245, 2239 }, // Ң
+    { 25, 29, 28, 2, 21, 182, 2484 }, // ң
+    { 29, 27, 31, 3, 27, 196, 2666 }, // Ҥ
+    { 27, 21, 28, 2, 21, 142, 2862 }, // ҥ
+    { 38, 37, 42, 3, 27, 352, 3004 }, // Ҧ
+    { 31, 31, 33, 2, 21, 241, 3356 }, // ҧ
+    { 27, 30, 29, 2, 28, 203, 3597 }, // Ҩ
+    { 23, 23, 25, 1, 21, 133, 3800 }, // ҩ
+    { 21, 37, 24, 2, 28, 195, 3933 }, // Ҫ
+    { 18, 30, 19, 1, 21, 135, 4128 }, // ҫ
+    { 21, 35, 22, 0, 27, 184, 4263 }, // Ҭ
+    { 20, 29, 21, 0, 21, 145, 4447 }, // ҭ
+    { 24, 27, 23, 0, 27, 162, 4592 }, // Ү
+    { 22, 30, 22, 0, 21, 165, 4754 }, // ү
+    { 24, 27, 23, 0, 27, 162, 4919 }, // Ұ
+    { 22, 30, 22, 0, 21, 165, 5081 }, // ұ
+    { 28, 35, 28, 0, 27, 245, 5246 }, // Ҳ
+    { 24, 29, 24, 0, 21, 174, 5491 }, // ҳ
+    { 35, 35, 35, 0, 27, 307, 5665 }, // Ҵ
+    { 30, 29, 30, 0, 21, 218, 5972 }, // ҵ
+    { 29, 35, 30, 1, 27, 254, 6190 }, // Ҷ
+    { 25, 29, 27, 2, 21, 182, 6444 }, // ҷ
+    { 23, 27, 28, 2, 27, 156, 6626 }, // Ҹ
+    { 20, 21, 25, 2, 21, 105, 6782 }, // ҹ
+    { 23, 27, 28, 3, 27, 156, 6887 }, // Һ
+    { 20, 29, 24, 2, 29, 145, 7043 }, // һ
+    { 33, 29, 36, 0, 28, 240, 7188 }, // Ҽ
+    { 26, 22, 27, -1, 21, 143, 7428 }, // ҽ
+    { 33, 36, 36, 0, 28, 297, 7571 }, // Ҿ
+    { 26, 29, 27, -1, 21, 189, 7868 }, // ҿ
+    { 13, 27, 15, 1, 27, 88, 8057 }, // Ӏ
+    { 38, 36, 37, 0, 36, 342, 8145 }, // Ӂ
+    { 33, 29, 32, 0, 29, 240, 8487 }, // ӂ
+    { 24, 37, 29, 3, 27, 222, 8727 }, // Ӄ
+    { 21, 31, 24, 2, 21, 163, 8949 }, // ӄ
+    { 31, 35, 31, 0, 27, 272, 9112 }, // Ӆ
+    { 27, 29, 27, 0, 21, 196, 9384 }, // ӆ
+    { 23, 37, 29, 3, 27, 213, 9580 }, // Ӈ
+    { 20, 31, 25, 2, 21, 155, 9793 }, // ӈ
+    { 29, 35, 32, 3, 27, 254, 9948 }, // Ӊ
+    { 26, 29, 28, 2, 21, 189, 10202 }, // ӊ
+    { 23, 35, 28, 2, 27, 202, 10391 }, // Ӌ
+    { 20, 29, 25, 2, 21, 145, 10593 }, // ӌ
+    { 36, 35, 39, 3, 27, 315, 10738 }, // Ӎ
+    { 33, 29, 35, 2, 21, 240, 11053 }, // ӎ
+    { 13, 27, 15, 1, 27, 88, 11293 }, // ӏ
+    { 26, 36, 26, 0, 36, 234, 11381 }, // Ӑ
+    { 19, 30, 22, 1, 29, 143, 11615 }, // ӑ
+    { 26, 35, 26, 0, 35, 228, 11758 }, // Ӓ
+    { 19, 30, 22, 1, 29, 143, 11986 }, // ӓ
+    { 34, 27, 36, 0, 27, 230, 12129 }, // Ӕ
+    { 32, 22, 34, 1, 21, 176, 12359 }, // ӕ
+    { 16, 36, 21, 3, 36, 144, 12535 }, // Ӗ
+    { 20, 30, 22, 1, 29, 150, 12679 }, // ӗ
+    { 26, 29, 31, 3, 28, 189, 12829 }, // Ә
+    { 20, 22, 22, 1, 21, 110, 13018 }, // ә
+    { 26, 36, 31, 3, 35, 234, 13128 }, // Ӛ
+    { 20, 30, 22, 1, 29, 150, 13362 }, // ӛ
+    { 38, 35, 37, 0, 35, 333, 13512 }, // Ӝ
+    { 33, 29, 32, 0, 29, 240, 13845 }, // ӝ
+    { 20, 36, 22, 1, 35, 180, 14085 }, // Ӟ
+    { 17, 30, 19, 1, 29, 128, 14265 }, // ӟ
+    { 20, 28, 22, 1, 27, 140, 14393 }, // Ӡ
+    { 20, 30, 22, 1, 21, 150, 14533 }, // ӡ
+    { 24, 33, 30, 3, 33, 198, 14683 }, // Ӣ
+    { 20, 27, 25, 3, 27, 135, 14881 }, // ӣ
+    { 24, 35, 30, 3, 35, 210, 15016 }, // Ӥ
+    { 20, 29, 25, 3, 29, 145, 15226 }, // ӥ
+    { 26, 36, 30, 2, 35, 234, 15371 }, // Ӧ
+    { 21, 30, 23, 1, 29, 158, 15605 }, // ӧ
+    { 26, 29, 30, 2, 28, 189, 15763 }, // Ө
+    { 21, 22, 23, 1, 21, 116, 15952 }, // ө
+    { 26, 36, 30, 2, 35, 234, 16068 }, // Ӫ
+    { 21, 30, 23, 1, 29, 158, 16302 }, // ӫ
+    { 22, 36, 25, 1, 35, 198, 16460 }, // Ӭ
+    { 18, 30, 20, 1, 29, 135, 16658 }, // ӭ
+    { 25, 34, 24, 0, 33, 213, 16793 }, // Ӯ
+    { 23, 36, 21, -1, 27, 207, 17006 }, // ӯ
+    { 25, 36, 24, 0, 35, 225, 17213 }, // Ӱ
+    { 23, 38, 21, -1, 29, 219, 17438 }, // ӱ
+    { 25, 36, 24, 0, 35, 225, 17657 }, // Ӳ
+    { 22, 38, 21, 0, 29, 209, 17882 }, // ӳ
+    { 22, 35, 27, 2, 35, 193, 18091 }, // Ӵ
+    { 19, 29, 24, 2, 29, 138, 18284 }, // ӵ
+    { 18, 35, 21, 3, 27, 158, 18422 }, // Ӷ
+    { 16, 29, 18, 2, 21, 116, 18580 }, // ӷ
+    { 29, 35, 35, 3, 35, 254, 18696 }, // Ӹ
+    { 27, 29, 32, 3, 29, 196, 18950 }, // ӹ
+    { 21, 37, 21, 0, 27, 195, 19146 }, // Ӻ
+    { 18, 30, 18, 0, 21, 135, 19341 }, // ӻ
+    { 27, 37, 27, 0, 27, 250, 19476 }, // Ӽ
+    { 23, 30, 24, 0, 21, 173, 19726 }, // ӽ
+    { 25, 27, 25, 0, 27, 169, 19899 }, // Ӿ
+    { 22, 21, 22, 0, 21, 116, 20068 }, // ӿ
+    { 0, 0, 19, 0, 0, 0, 20184 }, //  
+    { 0, 0, 38, 0, 0, 0, 20184 }, //  
+    { 0, 0, 19, 0, 0, 0, 20184 }, //  
+    { 0, 0, 38, 0, 0, 0, 20184 }, //  
+    { 0, 0, 12, 0, 0, 0, 20184 }, //  
+    { 0, 0, 9, 0, 0, 0, 20184 }, //  
+    { 0, 0, 6, 0, 0, 0, 20184 }, //  
+    { 0, 0, 21, 0, 0, 0, 20184 }, //  
+    { 0, 0, 11, 0, 0, 0, 20184 }, //  
+    { 0, 0, 6, 0, 0, 0, 20184 }, //  
+    { 0, 0, 4, 0, 0, 0, 20184 }, //  
+    { 0, 0, 0, 0, 0, 0, 20184 }, // ​
+    { 0, 0, 0, 0, 0, 0, 20184 }, // ‌
+    { 0, 0, 0, 0, 0, 0, 20184 }, // ‍
+    { 9, 31, 0, -1, 26, 70, 20184 }, // ‎
+    { 9, 31, 0, -8, 26, 70, 20254 }, // ‏
+    { 10, 6, 12, 1, 13, 15, 20324 }, // ‐
+    { 10, 6, 12, 1, 13, 15, 20339 }, // ‑
+    { 20, 5, 22, 1, 16, 25, 20354 }, // ‒
+    { 17, 6, 19, 1, 13, 26, 19189 }, // –
+    { 36, 6, 38, 1, 13, 54, 19215 }, // —
+    { 36, 6, 38, 1, 13, 54, 20379 }, // ―
+    { 15, 38, 21, 3, 29, 143, 20433 }, // ‖
+    { 17, 9, 15, -1, 0, 39, 20576 }, // ‗
+    { 8, 10, 8, 0, 27, 20, 19269 }, // ‘
+    { 8, 10, 8, 0, 27, 20, 19289 }, // ’
+    { 9, 10, 11, 0, 5, 23, 20615 }, // ‚
+    { 8, 10, 8, 0, 27, 20, 20638 }, // ‛
+    { 17, 10, 17, 0, 27, 43, 19309 }, // “
+    { 17, 10, 17, 0, 27, 43, 19352 }, // ”
+    { 16, 10, 19, 1, 5, 40, 20658 }, // „
+    { 17, 10, 17, 0, 27, 43, 20698 }, // ‟
+    { 16, 29, 19, 2, 29, 116, 20741 }, // †
+    { 16, 29, 19, 2, 29, 116, 20857 }, // ‡
+    { 12, 13, 14, 1, 20, 39, 20973 }, // •
+    { 12, 15, 14, 2, 21, 45, 21012 }, // ‣
+    { 7, 7, 19, 6, 6, 13, 21057 }, // ․
+    { 18, 7, 22, 2, 6, 32, 21070 }, // ‥
+    { 28, 7, 32, 2, 6, 49, 19395 }, // …
+    { 7, 7, 11, 2, 13, 13, 21102 }, // ‧
+    { 0, 0, 23, 0, 0, 0, 21115 }, //  
+    { 0, 0, 23, 0, 0, 0, 21115 }, //  
+    { 9, 28, 0, -1, 23, 63, 21115 }, // ‪
+    { 9, 28, 0, -8, 23, 63, 21178 }, // ‫
+    { 10, 31, 0, -5, 26, 78, 21241 }, // ‬
+    { 10, 31, 0, -5, 26, 78, 21319 }, // ‭
+    { 10, 31, 0, -5, 26, 78, 21397 }, // ‮
+    { 0, 0, 6, 0, 0, 0, 21475 }, //  
+    { 46, 29, 48, 1, 28, 334, 21475 }, // ‰
+    { 61, 29, 63, 1, 28, 443, 21809 }, // ‱
+    { 11, 10, 11, 1, 27, 28, 22252 }, // ′
+    { 19, 10, 20, 1, 27, 48, 22280 }, // ″
+    { 28, 10, 28, 1, 27, 70, 22328 }, // ‴
+    { 11, 10, 16, 1, 27, 28, 22398 }, // ‵
+    { 20, 10, 24, 1, 27, 50, 22426 }, // ‶
+    { 28, 10, 32, 1, 27, 70, 22476 }, // ‷
+    { 15, 13, 15, 0, 4, 49, 22546 }, // ‸
+    { 12, 18, 14, 1, 19, 54, 22595 }, // ‹
+    { 12, 18, 14, 1, 19, 54, 22649 }, // ›
+    { 29, 29, 32, 1, 28, 211, 22703 }, // ※
+    { 18, 28, 21, 2, 27, 126, 22914 }, // ‼
+    { 17, 29, 18, 0, 28, 124, 23040 }, // ‽
+    { 20, 5, 19, -1, 33, 25, 23164 }, // ‾
+    { 23, 9, 23, 0, 0, 52, 23189 }, // ‿
+    { 23, 9, 23, 0, 30, 52, 23241 }, // ⁀
+    { 16, 25, 16, 0, 16, 100, 23293 }, // ⁁
+    { 42, 35, 42, 0, 29, 368, 23393 }, // ⁂
+    { 11, 6, 12, 1, 13, 17, 23761 }, // ⁃
+    { 21, 27, 5, -8, 27, 142, 23778 }, // ⁄
+    { 10, 33, 12, 2, 27, 83, 23920 }, // ⁅
+    { 10, 33, 12, 0, 27, 83, 24003 }, // ⁆
+    { 35, 29, 36, 0, 28, 254, 24086 }, // ⁇
+    { 27, 29, 29, 0, 28, 196, 24340 }, // ⁈
+    { 26, 29, 29, 2, 28, 189, 24536 }, // ⁉
+    { 19, 21, 22, 1, 21, 100, 24725 }, // ⁊
+    { 21, 34, 24, 2, 29, 179, 24825 }, // ⁋
+    { 21, 20, 25, 1, 21, 105, 25004 }, // ⁌
+    { 20, 20, 25, 3, 21, 100, 25109 }, // ⁍
+    { 19, 19, 20, 1, 10, 91, 25209 }, // ⁎
+    { 8, 26, 11, 2, 21, 52, 25300 }, // ⁏
+    { 23, 39, 23, 0, 30, 225, 25352 }, // ⁐
+    { 19, 38, 20, 1, 29, 181, 25577 }, // ⁑
+    { 16, 29, 16, 0, 28, 116, 25758 }, // ⁒
+    { 36, 8, 38, 1, 15, 72, 25874 }, // ⁓
+    { 23, 9, 23, 0, 0, 52, 25946 }, // ⁔
+    { 19, 19, 21, 1, 19, 91, 25998 }, // ⁕
+    { 18, 29, 22, 2, 28, 131, 26089 }, // ⁖
+    { 35, 10, 35, 1, 27, 88, 26220 }, // ⁗
+    { 29, 29, 33, 2, 28, 211, 26308 }, // ⁘
+    { 29, 29, 33, 2, 28, 211, 26519 }, // ⁙
+    { 7, 29, 11, 2, 28, 51, 26730 }, // ⁚
+    { 22, 31, 26, 2, 30, 171, 26781 }, // ⁛
+    { 30, 30, 32, 1, 28, 225, 26952 }, // ⁜
+    { 7, 30, 11, 2, 29, 53, 27177 }, // ⁝
+    { 7, 29, 11, 2, 28, 51, 27230 }, // ⁞
+    { 0, 0, 8, 0, 0, 0, 27281 }, //  
+    { 0, 0, 23, 0, 0, 0, 27281 }, // ⁠
+    { 0, 0, 23, 0, 0, 0, 27281 }, // ⁡
+    { 0, 0, 23, 0, 0, 0, 27281 }, // ⁢
+    { 0, 0, 23, 0, 0, 0, 27281 }, // ⁣
+    { 0, 0, 23, 0, 0, 0, 27281 }, // ⁤
+    { 0, 0, 0, 0, 0, 0, 27281 }, // ⁦
+    { 0, 0, 0, 0, 0, 0, 27281 }, // ⁧
+    { 0, 0, 0, 0, 0, 0, 27281 }, // ⁨
+    { 0, 0, 0, 0, 0, 0, 27281 }, // ⁩
+    { 10, 31, 0, -5, 26, 78, 27281 }, // ⁪
+    { 10, 31, 0, -5, 26, 78, 27359 }, // ⁫
+    { 10, 31, 0, -5, 26, 78, 27437 }, // ⁬
+    { 10, 31, 0, -5, 26, 78, 27515 }, // ⁭
+    { 10, 31, 0, -5, 26, 78, 27593 }, // ⁮
+    { 10, 31, 0, -5, 26, 78, 27671 }, // ⁯
+    { 14, 18, 14, 0, 33, 63, 27749 }, // ⁰
+    { 5, 18, 7, 1, 28, 23, 27812 }, // ⁱ
+    { 14, 17, 14, 0, 32, 60, 27835 }, // ⁴
+    { 13, 17, 14, 1, 32, 56, 27895 }, // ⁵
+    { 14, 17, 14, 0, 32, 60, 27951 }, // ⁶
+    { 13, 17, 14, 1, 32, 56, 28011 }, // ⁷
+    { 14, 18, 14, 0, 33, 63, 28067 }, // ⁸
+    { 14, 18, 14, 0, 33, 63, 28130 }, // ⁹
+    { 12, 11, 13, 1, 28, 33, 28193 }, // ⁺
+    { 12, 3, 13, 1, 24, 9, 28226 }, // ⁻
+    { 12, 8, 13, 1, 26, 24, 28235 }, // ⁼
+    { 7, 21, 9, 2, 34, 37, 28259 }, // ⁽
+    { 7, 21, 9, 0, 34, 37, 28296 }, // ⁾
+    { 14, 14, 16, 1, 24, 49, 28333 }, // ⁿ
+    { 14, 18, 14, 0, 13, 63, 28382 }, // ₀
+    { 10, 17, 14, 1, 12, 43, 28445 }, // ₁
+    { 13, 18, 14, 0, 13, 59, 28488 }, // ₂
+    { 14, 17, 14, 0, 12, 60, 28547 }, // ₃
+    { 14, 17, 14, 0, 12, 60, 28607 }, // ₄
+    { 13, 17, 14, 1, 12, 56, 28667 }, // ₅
+    { 14, 17, 14, 0, 12, 60, 28723 }, // ₆
+    { 13, 17, 14, 1, 12, 56, 28783 }, // ₇
+    { 14, 18, 14, 0, 13, 63, 28839 }, // ₈
+    { 14, 18, 14, 0, 13, 63, 28902 }, // ₉
+    { 12, 11, 13, 1, 9, 33, 28965 }, // ₊
+    { 12, 3, 13, 1, 5, 9, 28998 }, // ₋
+    { 12, 8, 13, 1, 7, 24, 29007 }, // ₌
+    { 7, 21, 9, 2, 14, 37, 29031 }, // ₍
+    { 7, 21, 9, 0, 14, 37, 29068 }, // ₎
+    { 13, 13, 15, 0, 9, 43, 29105 }, // ₐ
+    { 13, 13, 15, 1, 9, 43, 29148 }, // ₑ
+    { 14, 13, 15, 1, 9, 46, 29191 }, // ₒ
+    { 14, 13, 14, 0, 9, 46, 29237 }, // ₓ
+    { 13, 13, 15, 1, 9, 43, 29283 }, // ₔ
+    { 14, 18, 16, 1, 14, 63, 29326 }, // ₕ
+    { 15, 18, 15, 1, 14, 68, 29389 }, // ₖ
+    { 5, 18, 7, 1, 14, 23, 29457 }, // ₗ
+    { 22, 13, 24, 1, 9, 72, 29480 }, // ₘ
+    { 14, 13, 16, 1, 9, 46, 29552 }, // ₙ
+    { 14, 18, 15, 1, 9, 63, 29598 }, // ₚ
+    { 11, 13, 12, 1, 9, 36, 29661 }, // ₛ
+    { 10, 16, 10, 0, 12, 40, 29697 }, // ₜ
+    { 21, 28, 21, 0, 28, 147, 29737 }, // ₠
+    { 22, 32, 23, 1, 29, 176, 29884 }, // ₡
+    { 20, 29, 21, 1, 28, 145, 30060 }, // ₢
+    { 20, 27, 21, 0, 27, 135, 30205 }, // ₣
+    { 20, 28, 21, 1, 28, 140, 30340 }, // ₤
+    { 32, 30, 37, 2, 25, 240, 30480 }, // ₥
+    { 22, 27, 21, 0, 27, 149, 30720 }, // ₦
+    { 31, 28, 33, 2, 27, 217, 30869 }, // ₧
+    { 32, 28, 34, 2, 27, 224, 31086 }, // ₨
+    { 28, 27, 28, 0, 27, 189, 31310 }, // ₩
+    { 29, 27, 34, 3, 27, 196, 31499 }, // ₪
+    { 23, 35, 24, 1, 29, 202, 31695 }, // ₫
+    { 21, 28, 21, 1, 27, 147, 31897 }, // €
+    { 22, 27, 21, 0, 27, 149, 32044 }, // ₭
+    { 21, 27, 21, 0, 27, 142, 32193 }, // ₮
+    { 37, 37, 38, 0, 28, 343, 32335 }, // ₯
+    { 21, 37, 23, 0, 28, 195, 32678 }, // ₰
+    { 22, 27, 21, 0, 27, 149, 32873 }, // ₱
+    { 23, 32, 28, 2, 29, 184, 33022 }, // ₲
+    { 25, 27, 24, 0, 27, 169, 33206 }, // ₳
+    { 22, 29, 21, 0, 28, 160, 33375 }, // ₴
+    { 21, 32, 24, 2, 29, 168, 33535 }, // ₵
+    { 25, 26, 26, 0, 25, 163, 33703 }, // ₶
+    { 26, 31, 27, 0, 28, 202, 33866 }, // ₷
+    { 21, 27, 21, 0, 27, 142, 34068 }, // ₸
+    { 18, 27, 21, 2, 27, 122, 34210 }, // ₹
+    { 21, 28, 21, 0, 27, 147, 34332 }, // ₺
+    { 30, 29, 30, 0, 28, 218, 34479 }, // ₻
+    { 30, 27, 33, 1, 27, 203, 34697 }, // ₼
+    { 22, 27, 23, 0, 27, 149, 34900 }, // ₽
+    { 26, 29, 30, 2, 29, 189, 35049 }, // ₾
+    { 18, 35, 21, 3, 31, 158, 35238 }, // ₿
+    { 18, 28, 20, 1, 21, 126, 35396 }, // ⃀
+    { 19, 5, 22, 1, 16, 24, 35522 }, // −
+    { 31, 29, 29, 0, 29, 225, 35546 }, // ﬀ
+    { 24, 29, 26, 0, 29, 174, 35771 }, // ﬁ
+    { 23, 29, 26, 0, 29, 167, 35945 }, // ﬂ
+    { 38, 29, 40, 0, 29, 276, 36112 }, // ﬃ
+    { 38, 29, 40, 0, 29, 276, 36388 }, // ﬄ
+    { 27, 30, 29, 2, 29, 203, 36664 }, // ﬅ
+    { 33, 30, 35, 1, 29, 248, 36867 }, // ﬆ
+    { 35, 35, 38, 1, 29, 307, 37115 }, // �
 };
 
 static const EpdUnicodeInterval notosans_18_boldIntervals[] = {
@@ -3389,31 +3439,298 @@ static const EpdUnicodeInterval notosans_18_boldIntervals[] = {
     { 0x2090, 0x209C, 0x33D },
     { 0x20A0, 0x20C0, 0x34A },
     { 0x2212, 0x2212, 0x36B },
-    { 0xFFFD, 0xFFFD, 0x36C },
+    { 0xFB00, 0xFB06, 0x36C },
+    { 0xFFFD, 0xFFFD, 0x373 },
 };
 
 static const EpdFontGroup notosans_18_boldGroups[] = {
-    { 0, 4822, 11324, 97, 0 },
-    { 4822, 4473, 13777, 96, 97 },
-    { 9295, 5907, 21109, 128, 193 },
-    { 15202, 1755, 3011, 112, 321 },
-    { 16957, 15633, 45275, 256, 433 },
-    { 32590, 3248, 7820, 111, 689 },
-    { 35838, 902, 1988, 42, 800 },
-    { 36740, 2811, 5785, 33, 842 },
-    { 39551, 17, 24, 1, 875 },
-    { 39568, 150, 307, 1, 876 },
+    { 0, 6189, 19444, 151, 2 },
+    { 6189, 3904, 10154, 66, 434 },
+    { 10093, 15653, 44969, 373, 0 },
+    { 25746, 14670, 37422, 294, 583 },
+};
+
+static const uint8_t notosans_18_boldGlyphGroups[884] = {
+    2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2,
+    2, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 2, 2,
+    2, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 0, 0, 3, 3, 3, 0, 0, 3, 3, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+};
+
+static const uint8_t notosans_18_boldKernLeftClasses[884] = {
+    0, 0, 0, 0, 2, 0, 0, 0, 67, 2, 26, 0, 0, 0, 7, 29,
+    7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 12, 0, 41, 17, 35, 62, 0, 0, 0, 0, 41, 23, 0,
+    0, 17, 40, 17, 0, 0, 11, 48, 36, 36, 41, 15, 69, 26, 0, 0,
+    0, 70, 0, 0, 34, 65, 0, 34, 51, 0, 0, 0, 0, 0, 0, 0,
+    0, 34, 34, 0, 24, 0, 65, 0, 27, 27, 72, 27, 0, 26, 0, 0,
+    0, 0, 68, 0, 0, 0, 0, 0, 0, 0, 0, 0, 59, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32, 0, 0, 0,
+    53, 12, 12, 12, 12, 12, 12, 35, 41, 35, 35, 35, 35, 0, 0, 0,
+    0, 17, 0, 17, 17, 17, 17, 17, 0, 17, 48, 48, 48, 48, 15, 40,
+    0, 0, 0, 0, 0, 0, 0, 34, 0, 34, 34, 34, 34, 0, 0, 60,
+    60, 34, 0, 34, 34, 34, 34, 34, 0, 34, 0, 0, 0, 0, 27, 34,
+    27, 12, 0, 12, 0, 45, 0, 41, 0, 41, 0, 41, 0, 41, 0, 17,
+    21, 17, 0, 35, 34, 35, 34, 35, 34, 35, 34, 35, 34, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 61, 0, 60, 0, 0, 35,
+    0, 0, 0, 0, 0, 0, 0, 41, 0, 72, 23, 0, 23, 0, 23, 21,
+    23, 0, 23, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 34, 17,
+    34, 17, 34, 35, 34, 0, 24, 0, 24, 0, 24, 0, 0, 0, 0, 0,
+    0, 0, 0, 11, 65, 11, 38, 11, 65, 48, 0, 48, 0, 48, 0, 48,
+    0, 48, 0, 48, 0, 36, 27, 15, 27, 15, 69, 0, 69, 0, 69, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 52, 52, 28, 16, 30, 48, 0, 0, 0, 20, 20, 28, 13, 0, 1,
+    0, 10, 0, 73, 16, 4, 52, 13, 73, 0, 0, 13, 0, 0, 0, 9,
+    0, 22, 30, 16, 1, 46, 13, 4, 0, 0, 4, 20, 0, 20, 9, 9,
+    0, 49, 63, 56, 37, 3, 5, 19, 56, 43, 43, 19, 43, 43, 43, 5,
+    43, 5, 55, 37, 14, 5, 19, 3, 43, 43, 3, 8, 43, 8, 5, 5,
+    43, 5, 5, 54, 44, 55, 71, 0, 64, 74, 8, 8, 57, 19, 43, 14,
+    43, 9, 47, 42, 8, 30, 55, 10, 39, 10, 39, 0, 0, 0, 0, 50,
+    0, 0, 5, 9, 5, 1, 47, 1, 47, 14, 14, 9, 5, 9, 5, 9,
+    47, 30, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 3, 42, 8, 22,
+    5, 6, 31, 18, 58, 0, 0, 33, 0, 50, 56, 33, 0, 13, 19, 13,
+    19, 13, 19, 4, 3, 18, 31, 0, 0, 0, 5, 30, 55, 6, 31, 25,
+    50, 25, 50, 33, 0, 4, 3, 4, 3, 0, 0, 0, 0, 43, 66, 43,
+    66, 0, 13, 19, 0, 0, 4, 3, 0, 0, 4, 3, 0, 0, 4, 3,
+    0, 10, 49, 10, 49, 52, 66, 52, 66, 9, 5, 9, 5, 13, 19, 50,
+    56, 0, 0, 0, 43, 0, 43, 9, 5, 9, 5, 9, 5, 9, 5, 1,
+    14, 1, 14, 1, 14, 0, 43, 6, 31, 0, 43, 18, 58, 33, 0, 13,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 29, 29, 29, 0, 0, 2, 2, 7, 0, 2, 2, 7,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 59, 32, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 51, 0, 0, 0,
+    0, 0, 0, 0,
+};
+
+static const uint8_t notosans_18_boldKernRightClasses[884] = {
+    0, 0, 0, 63, 6, 0, 0, 0, 66, 6, 0, 42, 0, 0, 1, 27,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 43, 43, 0, 0,
+    0, 54, 0, 7, 0, 3, 0, 0, 0, 3, 0, 0, 44, 0, 0, 0,
+    0, 3, 0, 3, 0, 0, 18, 50, 31, 31, 62, 24, 0, 0, 0, 42,
+    0, 0, 0, 14, 60, 2, 2, 2, 0, 32, 60, 0, 68, 60, 60, 16,
+    16, 2, 16, 2, 16, 45, 0, 16, 22, 22, 22, 22, 49, 0, 0, 42,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 52, 0, 0, 0,
+    0, 7, 7, 7, 7, 7, 7, 61, 3, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 3, 3, 3, 3, 3, 0, 3, 50, 50, 50, 50, 24, 0,
+    0, 2, 14, 14, 14, 14, 14, 14, 2, 2, 2, 2, 2, 0, 0, 0,
+    0, 0, 0, 2, 2, 2, 2, 2, 0, 2, 16, 16, 16, 16, 22, 60,
+    22, 7, 14, 7, 14, 7, 14, 3, 2, 3, 2, 3, 2, 3, 2, 0,
+    2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 3, 32, 3,
+    32, 3, 32, 3, 32, 0, 60, 0, 69, 0, 59, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 60, 16, 0, 60, 0, 60, 0, 60,
+    0, 60, 0, 0, 0, 16, 0, 16, 0, 0, 0, 0, 16, 3, 2, 3,
+    2, 3, 2, 3, 2, 0, 16, 0, 16, 0, 0, 0, 45, 0, 0, 0,
+    45, 0, 0, 18, 0, 18, 0, 18, 0, 50, 16, 50, 16, 50, 16, 50,
+    16, 50, 16, 50, 16, 31, 22, 24, 22, 24, 0, 49, 0, 49, 0, 49,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4, 0, 28, 67, 0, 0, 34, 29, 0, 4, 0, 0, 11,
+    0, 10, 0, 0, 0, 40, 0, 19, 70, 0, 0, 0, 29, 0, 0, 28,
+    0, 0, 28, 4, 11, 46, 19, 0, 12, 0, 0, 4, 0, 0, 70, 0,
+    55, 5, 58, 43, 43, 15, 17, 8, 39, 43, 43, 43, 25, 43, 43, 17,
+    43, 43, 17, 21, 20, 17, 8, 43, 9, 43, 43, 21, 43, 43, 39, 43,
+    53, 17, 17, 35, 43, 17, 64, 0, 65, 48, 25, 43, 35, 43, 43, 20,
+    43, 13, 51, 57, 0, 0, 23, 10, 15, 0, 23, 0, 0, 0, 23, 70,
+    0, 12, 0, 13, 5, 37, 51, 37, 51, 13, 5, 13, 5, 13, 5, 13,
+    51, 13, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 23, 57, 35, 0,
+    23, 0, 23, 57, 0, 0, 23, 19, 8, 70, 39, 0, 23, 0, 23, 0,
+    35, 36, 21, 0, 23, 0, 23, 0, 23, 13, 5, 13, 5, 4, 21, 37,
+    56, 37, 56, 19, 8, 36, 21, 12, 9, 12, 9, 0, 23, 30, 41, 30,
+    41, 0, 19, 8, 0, 23, 47, 15, 0, 23, 0, 23, 12, 9, 0, 23,
+    0, 10, 38, 10, 38, 10, 38, 0, 5, 0, 38, 0, 38, 19, 8, 70,
+    39, 0, 0, 0, 43, 0, 43, 13, 5, 13, 5, 13, 5, 70, 39, 11,
+    20, 11, 20, 11, 20, 12, 9, 0, 23, 0, 43, 57, 0, 19, 8, 19,
+    8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 27, 27, 27, 0, 0, 33, 6, 1, 0, 33, 6, 1,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 52, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0,
+};
+
+static const int8_t notosans_18_boldKernMatrix[5325] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -3, 0, 0, 0, -2, 1, 0, -1, -1, -4, 0, 0, 0, 0, -4, 0, -3, 0, 0, 0, 0, 0, 0, 0, -2, -2, -1, -2, -3, -1, 0, 0, 0, 0, 2, 0, 0, 0, -1, -4, -1, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, -1, -2, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0,
+    0, 0, -2, 0, 1, -2, 0, -3, 0, 0, -3, 1, 0, 0, -2, -3, -1, 0, 1, 1, 1, 1, 0, 0, 0, -2, 0, 0, 0, -1, 0, 1, -1, 0, 0, 1, 1, 0, -1, 1, -2, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, -3, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, 0, 1, -3, 0, 0, -1, -2, -3, 0, 0, -1, 0, -2, 0, 0, 0, 0, -2, -2, 0, -2, 0, 0, -2, -2, -1, -2, -2, 0, 0, 0, 0, 0, 0, 0, -3, -1, -2, -3, 0, 0, 0, 0, -1, -2, 0, 0, 0, -1, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, -2, 0, 0, 0, 0, -2, 0, -1, -3, -2, 0, 0, 0, 0, -3, 0, 0, -2, 0, 0, -2, 0, 0, 0, 0, 0, -2, -2, 0, 0, 2, 0, -3, -2, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, 0, -3, 0, -1, -2, 0, -1, -3, 0, 0, 0, 0, 0, 0, 0, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, 0, -1, 0, 0, 0, -1, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -3, 0, -3, 0, 0, -1, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, -2, 2, 0, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, -3, -1, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, -3, 0, -2, 0, 1, 0, 0, 0, -1, 0, 0, 0, -2, -2, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -2, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, 0, 0, 0, 1, 0, 0, 0, -1, 0, 0, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, -2, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0,
+    0, -2, 0, 0, 1, -2, 1, 0, 0, -1, -3, 0, 0, 0, 0, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, 0, 1, -2, 0, 0, -1, -2, -2, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 1, 1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, 0, -3, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 1, 0, 0, 4, 0, 0, 0, 0, 0, 3, 0,
+    0, -5, 0, 0, 0, -1, 0, 0, 0, 0, -2, -1, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, -2, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -6, -1, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, 0, 0, -2, 0, 0, 0, -2, -2, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -2, 0, 0, -2, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, -1, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0,
+    0, -2, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, 0, -3, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -2, -1, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, -1, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, 0, 0, 0, 1, 0, 0, 0, -1, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, -3, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -5, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, 0, -2, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, 0, 0, 0, 1, 0, 0, 0, -1, 1, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 2, 0, 1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, 0, -1, 0, 0, 0, -1, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1,
+    0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const EpdLigaturePair notosans_18_boldLigatures[] = {
+    { 0x66, 0x66, 0xFB00 },
+    { 0x66, 0x69, 0xFB01 },
+    { 0x66, 0x6C, 0xFB02 },
+    { 0xFB00, 0x69, 0xFB03 },
+    { 0xFB00, 0x6C, 0xFB04 },
+};
+
+static const uint16_t notosans_18_boldGlyphLookup[368] = {
+    0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0001, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, 0x0010, 0x0011,
+    0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, 0x0020, 0x0021,
+    0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, 0x0030, 0x0031,
+    0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, 0x0040, 0x0041,
+    0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051,
+    0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, 0x0060, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070,
+    0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, 0x0080,
+    0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F, 0x0090,
+    0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F, 0x00A0,
+    0x00A1, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF, 0x00B0,
+    0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF, 0x00C0,
+    0x02B1, 0x02B2, 0x02B3, 0x02B4, 0x02B5, 0x02B6, 0x02B7, 0x02B8, 0x02B9, 0x02BA, 0x02BB, 0x02BC, 0x02BD, 0x02BE, 0x02BF, 0x02C0,
+    0x02C1, 0x02C2, 0x02C3, 0x02C4, 0x02C5, 0x02C6, 0x02C7, 0x02C8, 0x02C9, 0x02CA, 0x02CB, 0x02CC, 0x02CD, 0x02CE, 0x02CF, 0x02D0,
+    0x02D1, 0x02D2, 0x02D3, 0x02D4, 0x02D5, 0x02D6, 0x02D7, 0x02D8, 0x02D9, 0x02DA, 0x02DB, 0x02DC, 0x02DD, 0x02DE, 0x02DF, 0x02E0,
+    0x02E1, 0x02E2, 0x02E3, 0x02E4, 0x02E5, 0x02E6, 0x02E7, 0x02E8, 0x02E9, 0x02EA, 0x02EB, 0x02EC, 0x02ED, 0x02EE, 0x02EF, 0x02F0,
+    0x02F1, 0x02F2, 0x02F3, 0x02F4, 0x02F5, 0x02F6, 0x02F7, 0x02F8, 0x02F9, 0x02FA, 0x02FB, 0x02FC, 0x02FD, 0x02FE, 0x02FF, 0x0300,
+    0x0301, 0x0302, 0x0303, 0x0304, 0x0305, 0x0306, 0x0307, 0x0308, 0x0309, 0x030A, 0x030B, 0x030C, 0x030D, 0x030E, 0x030F, 0x0310,
+    0x0311, 0x0312, 0x0313, 0x0314, 0x0315, 0xFFFF, 0x0316, 0x0317, 0x0318, 0x0319, 0x031A, 0x031B, 0x031C, 0x031D, 0x031E, 0x031F,
 };
 
 static const EpdFontData notosans_18_bold = {
     notosans_18_boldBitmaps,
     notosans_18_boldGlyphs,
     notosans_18_boldIntervals,
-    15,
+    16,
     51,
     41,
     -11,
     true,
     notosans_18_boldGroups,
-    10,
+    4,
+    notosans_18_boldKernLeftClasses,
+    notosans_18_boldKernRightClasses,
+    notosans_18_boldKernMatrix,
+    71,
+    notosans_18_boldLigatures,
+    5,
+    0x4000000001ull,
+    notosans_18_boldGlyphLookup,
+    notosans_18_boldGlyphGroups,
+    false,
+    nullptr,
 };
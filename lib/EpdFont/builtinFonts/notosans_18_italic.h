@@ -3,2676 +3,2699 @@
  * name: notosans_18_italic
  * size: 18
  * mode: 2-bit  compressed: true
- * Command used: fontconvert.py notosans_18_italic 18 ../builtinFonts/source/NotoSans/NotoSans-Italic.ttf --2bit --compress
+ * Command used: fontconvert.py notosans_18_italic 18 ../builtinFonts/source/NotoSans/NotoSans-Italic.ttf --2bit --compress --frequency-corpus ../../../test/hyphenation_eval/resources/english_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/french_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/german_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/italian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/russian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/spanish_hyphenation_tests.txt
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t notosans_18_italicBitmaps[42613] = {
-    0xBD, 0x5A, 0x3D, 0x8C, 0xE5, 0xD6, 0x75, 0xBE, 0x7C, 0xF4, 0x0E, 0x9D, 0xB0, 0x60, 0x0A, 0x6F,
-    0x7E, 0xA0, 0x82, 0x6D, 0xE2, 0x14, 0x6C, 0xD3, 0x78, 0x2E, 0x25, 0x15, 0x2E, 0xD2, 0x4C, 0xB1,
-    0x23, 0x05, 0xD9, 0x42, 0x8D, 0x2B, 0xA5, 0x98, 0x26, 0xA5, 0x66, 0xF8, 0x24, 0x15, 0x2E, 0xB5,
-    0x8D, 0x92, 0x22, 0x85, 0x14, 0xC0, 0x01, 0x9C, 0x51, 0xA1, 0x56, 0x80, 0x77, 0x1E, 0x69, 0x6D,
-    0xA1, 0xC2, 0x85, 0x88, 0x08, 0xB6, 0x0B, 0x15, 0x26, 0xB0, 0x5A, 0x1B, 0x91, 0x80, 0x80, 0x96,
-    0x29, 0x88, 0xB3, 0xE2, 0x4F, 0xBE, 0xEF, 0xBB, 0x97, 0x9C, 0x37, 0xA3, 0x5D, 0xD9, 0x71, 0x91,
-    0x37, 0x3B, 0x9C, 0x7D, 0xE4, 0xFD, 0x39, 0xF7, 0xFC, 0x7E, 0xE7, 0x1C, 0x9A, 0xB8, 0x35, 0xB6,
-    0x32, 0xB3, 0x89, 0x7A, 0x93, 0xD6, 0xA6, 0x34, 0xE1, 0x60, 0x92, 0xC6, 0xD8, 0x3C, 0x18, 0x0C,
-    0x1E, 0x65, 0x5B, 0x33, 0x9A, 0xB0, 0x35, 0x49, 0x65, 0xCE, 0xCC, 0xA6, 0xE3, 0x5F, 0x6B, 0xCC,
-    0x1D, 0xE3, 0x3E, 0x3F, 0x30, 0x71, 0x67, 0x6C, 0x6D, 0xE6, 0x1C, 0xB3, 0x82, 0x1C, 0xA3, 0x47,
-    0xFB, 0xEA, 0x60, 0x9F, 0x1D, 0xEC, 0xA6, 0xB7, 0x9B, 0xF6, 0x34, 0x6C, 0x5F, 0x09, 0x9B, 0xFB,
-    0x61, 0xFD, 0x5E, 0x54, 0x75, 0xD1, 0xD6, 0x98, 0x78, 0x1B, 0xE3, 0x9A, 0x6C, 0x13, 0x5C, 0xD3,
-    0x3C, 0xC9, 0x8D, 0xC9, 0xF0, 0x63, 0xB0, 0x24, 0x16, 0x35, 0xDF, 0xC3, 0x8F, 0x31, 0xF7, 0xCD,
-    0x2B, 0xB8, 0x0E, 0xF8, 0x1B, 0xCD, 0xF8, 0x8C, 0xB1, 0xAE, 0x07, 0xEF, 0x3C, 0x7E, 0xE7, 0xF1,
-    0x8F, 0x4D, 0xD8, 0x84, 0x8D, 0x31, 0x61, 0x1D, 0xD6, 0xC6, 0x44, 0x55, 0x54, 0x61, 0xB1, 0x2A,
-    0xA9, 0xFC, 0x92, 0xB7, 0x4F, 0xDE, 0x3C, 0x79, 0x33, 0x2F, 0x39, 0xBE, 0xE6, 0x65, 0xAE, 0xCC,
-    0x29, 0x7E, 0xAE, 0x96, 0x1C, 0x70, 0xED, 0xF1, 0x63, 0x82, 0x36, 0xE8, 0x8C, 0xD9, 0xB4, 0x9B,
-    0xD6, 0xAC, 0x4B, 0x46, 0xB5, 0x8E, 0x74, 0x64, 0xB8, 0xB2, 0x31, 0xA2, 0x4B, 0x63, 0xCB, 0xF9,
-    0x9E, 0xB1, 0x58, 0x32, 0x9C, 0xA6, 0xD2, 0xD8, 0xF7, 0x9B, 0xEF, 0x98, 0x01, 0x9B, 0x45, 0x0D,
-    0x88, 0xCD, 0x5E, 0xC5, 0x02, 0x67, 0x31, 0x86, 0x8F, 0x87, 0x58, 0x6F, 0xC6, 0xA2, 0xE1, 0x8C,
-    0xD5, 0x82, 0x19, 0x13, 0xCD, 0x8C, 0xFD, 0xC2, 0xCF, 0x70, 0x49, 0xBE, 0x8F, 0x61, 0xAF, 0x24,
-    0x35, 0xF6, 0xB5, 0x39, 0x98, 0x30, 0x1A, 0x73, 0x18, 0xB5, 0x7F, 0x63, 0xBA, 0x32, 0x2F, 0x3F,
-    0x9B, 0xFB, 0x0D, 0x48, 0xCD, 0xB5, 0x8D, 0xE1, 0xB9, 0x0C, 0xF9, 0x22, 0x8A, 0x49, 0xDE, 0xFE,
-    0x27, 0x9E, 0x44, 0x2E, 0x17, 0x1F, 0xCC, 0xEE, 0xA5, 0xCA, 0x64, 0x79, 0xBA, 0x3D, 0x05, 0x29,
-    0x9B, 0x16, 0x13, 0x07, 0x73, 0x88, 0x1F, 0x6B, 0x22, 0x1C, 0x25, 0xAE, 0x71, 0xE8, 0xD3, 0xA0,
-    0x07, 0x7B, 0xE2, 0xCA, 0xEA, 0xEC, 0x60, 0x13, 0xB8, 0xF4, 0x5A, 0x77, 0xDB, 0xF4, 0x41, 0x77,
-    0x96, 0x4E, 0x49, 0x65, 0x93, 0x0F, 0xE6, 0xFE, 0x22, 0xF9, 0xAF, 0x76, 0x4C, 0xF1, 0x9F, 0xD3,
-    0x2C, 0xBF, 0x9F, 0x4D, 0xC9, 0xEB, 0x6D, 0x54, 0xBF, 0x1C, 0xB6, 0x62, 0xDC, 0xFD, 0x18, 0xB3,
-    0x21, 0x28, 0x0A, 0x23, 0x6C, 0x30, 0xBB, 0xC2, 0x42, 0x64, 0x60, 0x86, 0xA5, 0xD2, 0x1C, 0x1C,
-    0xEB, 0xA1, 0x1A, 0xD8, 0x04, 0x44, 0x60, 0x93, 0x31, 0xAD, 0xB0, 0x6F, 0x34, 0xB7, 0xD8, 0xD7,
-    0x64, 0x83, 0x48, 0xFE, 0xCE, 0x15, 0xF5, 0x19, 0xA8, 0x07, 0x67, 0x66, 0x8A, 0x6E, 0x3A, 0xC1,
-    0xD1, 0x92, 0x26, 0xEC, 0x28, 0xC0, 0x0D, 0x86, 0xA7, 0xBA, 0x66, 0x5B, 0xA8, 0x98, 0x49, 0xB7,
-    0x58, 0x15, 0x77, 0x52, 0x70, 0x32, 0xA9, 0x4B, 0xEA, 0xCD, 0x97, 0x60, 0x99, 0x63, 0x2D, 0xD6,
-    0xE7, 0x62, 0x05, 0xAF, 0x9B, 0xB9, 0xD8, 0x9A, 0x1F, 0xC7, 0x5D, 0x5A, 0x6F, 0xFA, 0xAC, 0x8E,
-    0xDB, 0x10, 0xEC, 0x0D, 0xFB, 0xA4, 0x29, 0x4C, 0x30, 0x66, 0xD5, 0xCE, 0x98, 0xB2, 0x84, 0xF6,
-    0x1A, 0x3B, 0x1A, 0x6C, 0x9D, 0x74, 0x50, 0x6E, 0x93, 0x75, 0xA6, 0xD8, 0x06, 0x90, 0x8C, 0xBD,
-    0x3C, 0x19, 0x67, 0x93, 0xCC, 0x73, 0x53, 0x6C, 0x37, 0xF3, 0x64, 0xB2, 0xDA, 0xDC, 0x22, 0xDF,
-    0xB3, 0x37, 0x1E, 0x76, 0x83, 0x4D, 0xBF, 0xFF, 0x7E, 0xFB, 0x1E, 0xB5, 0x31, 0xCB, 0x41, 0x0E,
-    0x68, 0xA1, 0xE2, 0x43, 0x80, 0x71, 0x43, 0x63, 0x08, 0x7B, 0x03, 0xEB, 0xE0, 0xD2, 0x05, 0x69,
-    0xE6, 0x83, 0xA8, 0x35, 0x3C, 0x00, 0x77, 0xE3, 0x91, 0xF8, 0x9D, 0x43, 0xCE, 0x78, 0x1A, 0x08,
-    0xC8, 0x90, 0x25, 0xFC, 0x52, 0x71, 0x3E, 0x15, 0x11, 0x0B, 0xE3, 0xB6, 0xFE, 0x47, 0xA1, 0xF2,
-    0x34, 0xB8, 0x9C, 0x52, 0x95, 0x25, 0xF7, 0x53, 0xCD, 0xF4, 0x83, 0xB9, 0x66, 0x6D, 0xC8, 0x2D,
-    0x6E, 0x90, 0xEB, 0x8B, 0x7B, 0xE2, 0x09, 0x68, 0xF8, 0x90, 0x1B, 0xEE, 0x34, 0x38, 0x73, 0xC4,
-    0xB6, 0x1C, 0xB5, 0x71, 0xC4, 0x3A, 0x7A, 0x2F, 0x44, 0xC5, 0x22, 0x97, 0x1D, 0x99, 0x4A, 0x1D,
-    0x03, 0xC1, 0xDF, 0x82, 0xEE, 0xE0, 0x71, 0x07, 0x2E, 0x3F, 0x5F, 0x99, 0x83, 0xF9, 0x7F, 0x30,
-    0xE4, 0x64, 0x9E, 0x5B, 0xB2, 0xA8, 0x32, 0x65, 0xF5, 0x8F, 0x26, 0xF9, 0x10, 0x92, 0x18, 0x33,
-    0xCA, 0x0D, 0x43, 0x4B, 0xAE, 0xD8, 0x52, 0x5C, 0x79, 0xC4, 0x25, 0xFE, 0x64, 0x31, 0x9E, 0x65,
-    0x41, 0x11, 0xA2, 0x7D, 0xAF, 0xDF, 0xFA, 0xEE, 0xF9, 0x74, 0xFE, 0xEF, 0xB4, 0xCE, 0x5F, 0xF2,
-    0x92, 0x3F, 0x65, 0xD4, 0xFE, 0x2D, 0x6C, 0x6B, 0x8E, 0xCD, 0xB4, 0x19, 0xC2, 0x3E, 0x6A, 0x93,
-    0x26, 0xA9, 0xB2, 0xFC, 0x10, 0xF6, 0xF1, 0xA7, 0xE7, 0x6F, 0x97, 0xF3, 0x47, 0xF3, 0x7C, 0xEB,
-    0xF8, 0xCE, 0xC1, 0x73, 0xA3, 0xFD, 0x68, 0xB4, 0xD5, 0xBD, 0x65, 0x4E, 0xC6, 0x65, 0xA8, 0x33,
-    0x71, 0xE3, 0xD7, 0x0B, 0x69, 0x91, 0xE9, 0x72, 0x5B, 0x24, 0x83, 0x91, 0x66, 0xC3, 0x6D, 0x92,
-    0x7A, 0x9F, 0x19, 0x16, 0xFB, 0x05, 0xBA, 0xCD, 0xB9, 0x05, 0x6F, 0x77, 0xBF, 0x67, 0xC9, 0x69,
-    0x59, 0xD2, 0x7F, 0x0E, 0xA8, 0xA9, 0x25, 0x99, 0x37, 0x95, 0x8D, 0x29, 0xB7, 0x59, 0x05, 0xEF,
-    0x6A, 0xB7, 0xF0, 0xB3, 0x25, 0x56, 0x0E, 0x06, 0xAC, 0x1C, 0xB5, 0x05, 0x54, 0xEB, 0x7D, 0x8A,
-    0x10, 0xDF, 0x82, 0x81, 0x8E, 0xE1, 0xB7, 0xD4, 0x86, 0x0F, 0xB0, 0xCE, 0x04, 0x99, 0x86, 0x3D,
-    0x28, 0x4A, 0x3E, 0xEA, 0x39, 0xA0, 0x06, 0x9D, 0x14, 0x7B, 0x83, 0x8D, 0x0A, 0x08, 0x34, 0x1C,
-    0x20, 0xDB, 0xB4, 0xC6, 0xDE, 0x13, 0x9C, 0x77, 0xD2, 0x9A, 0xE2, 0xD7, 0xE0, 0x24, 0x37, 0x34,
-    0x25, 0x69, 0xB9, 0x2D, 0x2A, 0x2E, 0x4C, 0x34, 0xC2, 0x0E, 0xA1, 0xED, 0xC9, 0xD4, 0x17, 0x9F,
-    0xF7, 0xF6, 0xF9, 0xEE, 0x2F, 0x71, 0x42, 0x10, 0x8A, 0x23, 0x60, 0x4D, 0xF0, 0x1A, 0x2B, 0xE0,
-    0x5C, 0xD8, 0xCD, 0x4A, 0x10, 0x85, 0xD8, 0x30, 0xE9, 0x9C, 0xA4, 0x93, 0xCA, 0x83, 0xC3, 0xBB,
-    0x49, 0xFE, 0x73, 0x82, 0x9D, 0x22, 0x2A, 0x46, 0x36, 0x95, 0x03, 0x88, 0x08, 0x47, 0xCA, 0x9E,
-    0xBB, 0x1A, 0x59, 0x66, 0xB9, 0x68, 0x96, 0x98, 0x25, 0x46, 0x8A, 0x51, 0xB1, 0xE4, 0x42, 0x4E,
-    0x97, 0xE4, 0x3B, 0x27, 0xC4, 0xDD, 0x72, 0x0B, 0x6B, 0x9A, 0x90, 0xE3, 0x13, 0x8E, 0x2A, 0xC0,
-    0xD3, 0x40, 0x3C, 0xED, 0x97, 0x01, 0x05, 0xDD, 0x39, 0x5D, 0x7B, 0xE5, 0x1C, 0xBB, 0xFB, 0x14,
-    0x98, 0x17, 0x93, 0x16, 0x3B, 0xBD, 0x3B, 0xD0, 0x6F, 0x8C, 0xE6, 0xDB, 0x9E, 0x96, 0xE9, 0x1A,
-    0x19, 0x66, 0x25, 0x83, 0x1B, 0xDC, 0x82, 0x4F, 0x09, 0xE7, 0x4B, 0xFA, 0x12, 0xC8, 0xE9, 0xE0,
-    0x1D, 0x8D, 0x28, 0xF3, 0x45, 0xC8, 0x52, 0x07, 0x09, 0xFF, 0xEA, 0x92, 0xF2, 0x9E, 0xAD, 0xFE,
-    0x8E, 0xA4, 0xDA, 0x47, 0x27, 0x13, 0x23, 0x42, 0xCF, 0xBD, 0xA1, 0x2C, 0xB7, 0x8E, 0x44, 0x4C,
-    0xA0, 0x65, 0x78, 0x12, 0x23, 0x02, 0x29, 0x0D, 0xB3, 0xE3, 0xC6, 0x3B, 0xDA, 0x5C, 0x01, 0x8B,
-    0x87, 0x28, 0xF1, 0xC4, 0x3E, 0x8F, 0x27, 0xF6, 0xD9, 0x9E, 0xAA, 0xB6, 0xA3, 0xFD, 0x82, 0xF9,
-    0x59, 0x25, 0x69, 0x80, 0xCD, 0xF2, 0x84, 0x20, 0xE1, 0x82, 0x17, 0x9B, 0x63, 0xF7, 0xA4, 0x52,
-    0x24, 0xFC, 0x9C, 0x97, 0x81, 0x3C, 0x98, 0x16, 0x1B, 0x91, 0xB5, 0x44, 0x72, 0x1E, 0xFD, 0x7A,
-    0x54, 0x2B, 0x27, 0x09, 0x17, 0x17, 0xF3, 0x92, 0x90, 0x4E, 0x8D, 0x4B, 0xB7, 0x5E, 0xE7, 0xDD,
-    0xDC, 0x33, 0xA7, 0x22, 0x9E, 0x37, 0x66, 0x38, 0x96, 0x73, 0x86, 0x23, 0x41, 0xB4, 0x35, 0xE6,
-    0xD1, 0x5F, 0x38, 0x61, 0x6A, 0x4E, 0xB5, 0xE8, 0xB9, 0xE3, 0xCC, 0xFA, 0x55, 0xDC, 0xA2, 0xB9,
-    0x40, 0xE8, 0x6F, 0x9B, 0x70, 0x32, 0xE5, 0x9B, 0x65, 0x0F, 0x35, 0xC4, 0x2A, 0xA9, 0x88, 0xBC,
-    0x9D, 0xAF, 0x26, 0xF1, 0x0C, 0xFC, 0x3E, 0x08, 0x02, 0x5B, 0x1E, 0xDF, 0x37, 0x49, 0xEF, 0xB5,
-    0x45, 0x4A, 0x51, 0x7C, 0xCD, 0x96, 0xC2, 0xF6, 0x6F, 0x1B, 0x93, 0xFD, 0x0C, 0x94, 0x4F, 0x20,
-    0x3F, 0x9C, 0xA1, 0xE2, 0x09, 0x99, 0x02, 0x77, 0x9F, 0xBD, 0x4A, 0x2F, 0x17, 0xD3, 0xAF, 0x41,
-    0x6D, 0xE3, 0x86, 0x0E, 0xEF, 0x39, 0x06, 0x44, 0xAA, 0x75, 0x2B, 0x96, 0xD9, 0x0A, 0x68, 0xA4,
-    0x78, 0x54, 0xC2, 0xDA, 0x18, 0x82, 0xA9, 0x24, 0xF2, 0xED, 0x29, 0x58, 0xD7, 0x92, 0x7F, 0x0F,
-    0x3C, 0x0F, 0xA3, 0xEB, 0xE6, 0x5E, 0x7B, 0xED, 0x75, 0xE6, 0xFE, 0x7B, 0xBC, 0xC0, 0xD5, 0xED,
-    0xFE, 0x9A, 0x73, 0x68, 0x9F, 0x7E, 0x7B, 0xDF, 0x82, 0x42, 0x32, 0x09, 0xDE, 0xA1, 0x83, 0x7A,
-    0x83, 0x5A, 0xC1, 0xAD, 0x82, 0x63, 0x97, 0x0B, 0xEE, 0xD1, 0x39, 0xD9, 0xAD, 0x2C, 0x1D, 0x18,
-    0x2B, 0x7A, 0x3C, 0x7B, 0x88, 0x91, 0x52, 0x6B, 0xE7, 0x8F, 0x07, 0x5A, 0xCC, 0x2C, 0xB0, 0xB6,
-    0xA5, 0x11, 0x57, 0xF4, 0x10, 0x95, 0x42, 0x45, 0xE1, 0x2F, 0x69, 0x85, 0xD3, 0xD9, 0x0A, 0x16,
-    0x54, 0xE6, 0xC9, 0x78, 0x77, 0xA2, 0x5E, 0xF4, 0xF4, 0x4C, 0x3C, 0xDC, 0xD1, 0x42, 0xCF, 0xC6,
-    0x79, 0xAB, 0x8E, 0xF4, 0xB4, 0x18, 0x99, 0x36, 0x51, 0xE7, 0xA7, 0xE6, 0x0C, 0x1B, 0xD1, 0x35,
-    0x66, 0xBF, 0xC6, 0x30, 0x07, 0x07, 0x82, 0xB0, 0x5B, 0xC1, 0x52, 0x2D, 0x94, 0xD3, 0x94, 0x9F,
-    0x4E, 0x03, 0x56, 0xF8, 0x59, 0x63, 0x8A, 0x8E, 0x1A, 0x26, 0xC6, 0xAD, 0x7E, 0x52, 0x3E, 0x36,
-    0x5D, 0x6C, 0x3A, 0x6B, 0xCD, 0xE3, 0x7F, 0x9A, 0x3D, 0x03, 0x48, 0x4D, 0x20, 0x34, 0xF9, 0x57,
-    0x60, 0x44, 0xD2, 0x45, 0x03, 0xE4, 0x7F, 0xCB, 0x3C, 0xF9, 0x73, 0x90, 0xC7, 0x1D, 0x8F, 0x0C,
-    0x01, 0x6F, 0xB8, 0xC9, 0x3D, 0xBA, 0x86, 0x39, 0x8F, 0x04, 0x58, 0x9F, 0x36, 0xC9, 0x7D, 0xEE,
-    0x18, 0x1C, 0x09, 0x7A, 0x3C, 0x52, 0x12, 0x60, 0x76, 0xEF, 0x01, 0xAD, 0x17, 0xCB, 0x9F, 0x51,
-    0x19, 0x6A, 0x1A, 0x00, 0x6D, 0x94, 0x2C, 0x1E, 0x69, 0x43, 0x39, 0x6E, 0xE0, 0x6E, 0xF1, 0x09,
-    0x6E, 0xF4, 0x8B, 0x4B, 0x9A, 0xE4, 0xDF, 0xA5, 0x2B, 0xD2, 0xD9, 0x29, 0xE7, 0xD0, 0xF5, 0x7B,
-    0xD6, 0xF9, 0xB5, 0x4C, 0x60, 0x6E, 0x1F, 0x1F, 0x1F, 0x1F, 0xCD, 0x5E, 0xE1, 0x10, 0xA7, 0x8E,
-    0x8F, 0xEF, 0x3C, 0x81, 0x36, 0x4B, 0xB5, 0x5C, 0x47, 0x29, 0x86, 0x06, 0x5A, 0x44, 0x8A, 0x43,
-    0x8A, 0x44, 0x85, 0xE8, 0x12, 0x61, 0xA2, 0xCC, 0xDF, 0x84, 0x62, 0x40, 0x7E, 0x24, 0xB4, 0x71,
-    0x04, 0x9C, 0x8C, 0x54, 0x10, 0xBA, 0x45, 0xC8, 0xB8, 0x68, 0xFC, 0x5A, 0xC1, 0xD5, 0x76, 0xC5,
-    0x44, 0x3B, 0xAC, 0xA9, 0x7B, 0xF1, 0x96, 0x0E, 0x96, 0xE2, 0x09, 0xF6, 0x7E, 0xA9, 0xB9, 0xD4,
-    0x57, 0xFA, 0x5D, 0x38, 0x45, 0xBA, 0xE5, 0xB4, 0x73, 0x5E, 0x00, 0x67, 0x27, 0x90, 0x09, 0x5B,
-    0x07, 0x59, 0x82, 0x7C, 0x5F, 0x38, 0xCE, 0x49, 0xDA, 0xC6, 0x11, 0xC5, 0xE1, 0x5E, 0x26, 0x07,
-    0xE7, 0x8C, 0xCB, 0x34, 0xBF, 0xCE, 0x78, 0x2B, 0x84, 0x7E, 0x62, 0x59, 0x58, 0x68, 0x38, 0x38,
-    0x4F, 0x30, 0x3A, 0x03, 0x93, 0x7B, 0x02, 0xA4, 0xAF, 0xE9, 0x54, 0x2F, 0xB0, 0x57, 0x36, 0x7F,
-    0x12, 0x35, 0x96, 0x93, 0xF2, 0xC3, 0xB8, 0x8E, 0x80, 0x37, 0xC3, 0x76, 0x90, 0x71, 0xD8, 0x04,
-    0x7E, 0x33, 0x6A, 0xC2, 0xCF, 0x3B, 0x90, 0x72, 0x61, 0x0E, 0x33, 0x7A, 0xCC, 0x2A, 0x7C, 0xD8,
-    0x0A, 0xA5, 0x9E, 0x5A, 0xC3, 0x80, 0x10, 0x3F, 0xC0, 0x57, 0xAC, 0xDB, 0xF3, 0x6B, 0x61, 0xB2,
-    0xE7, 0xF1, 0x35, 0xED, 0xB8, 0x62, 0x79, 0xF7, 0xC3, 0x5F, 0x0C, 0x9B, 0x2E, 0x9C, 0x3B, 0x40,
-    0x49, 0x0C, 0xEC, 0x29, 0x7B, 0x87, 0x59, 0xD7, 0x60, 0x27, 0xD7, 0xE6, 0x7D, 0xFA, 0x11, 0xF1,
-    0xE7, 0xD1, 0xAD, 0x9D, 0x64, 0x32, 0x0B, 0x89, 0xC6, 0xC2, 0xB2, 0x60, 0xC3, 0xF1, 0x62, 0x48,
-    0x9A, 0x9F, 0x6A, 0xB6, 0x42, 0x80, 0x04, 0x65, 0x2C, 0xBD, 0x6C, 0x70, 0xA9, 0xE8, 0xF3, 0x01,
-    0x27, 0x96, 0x74, 0xA1, 0x61, 0x67, 0xE5, 0x21, 0x38, 0x67, 0x20, 0x47, 0xE3, 0x86, 0x1E, 0xA8,
-    0x20, 0x0F, 0x20, 0x82, 0xDD, 0x82, 0x89, 0xE7, 0xE3, 0xBB, 0xAD, 0x52, 0xA1, 0x4A, 0x9A, 0x82,
-    0xC8, 0x79, 0x7E, 0x3E, 0x78, 0x38, 0x58, 0xD2, 0xCE, 0xE9, 0x97, 0x32, 0x7A, 0x00, 0xCC, 0x19,
-    0x29, 0x42, 0x86, 0x38, 0xC1, 0x0B, 0x93, 0x3E, 0x18, 0x9C, 0x0D, 0xC6, 0xF3, 0x63, 0x7C, 0x9D,
-    0x19, 0xAE, 0xC8, 0x7F, 0xCA, 0xF9, 0xA4, 0x53, 0xDC, 0x27, 0x77, 0xE8, 0x67, 0x8C, 0x8B, 0x3E,
-    0x78, 0x40, 0x94, 0x5C, 0x11, 0xA1, 0x74, 0x58, 0x0E, 0x3A, 0x9F, 0x3C, 0x7A, 0x61, 0x06, 0x64,
-    0xE6, 0xDC, 0x4C, 0x01, 0xE2, 0xF2, 0xB8, 0xA4, 0x9B, 0x85, 0x72, 0x10, 0x5E, 0xCA, 0x6F, 0xA5,
-    0x35, 0xAD, 0x7D, 0xE4, 0xFE, 0x49, 0x8D, 0xD3, 0x05, 0x03, 0x35, 0x09, 0x9E, 0xA7, 0x82, 0x9F,
-    0xC0, 0x29, 0xE0, 0x23, 0x48, 0x7C, 0x15, 0x8A, 0x75, 0x08, 0xE6, 0xF7, 0xF6, 0xDD, 0x61, 0xA3,
-    0xF8, 0x5E, 0x73, 0x08, 0x4E, 0x36, 0x99, 0x83, 0x6D, 0x38, 0xAD, 0xD1, 0x87, 0x59, 0x80, 0x53,
-    0x13, 0x53, 0xE4, 0x0B, 0x42, 0x70, 0x91, 0x4E, 0xEE, 0xD5, 0x3D, 0x92, 0xA8, 0xE4, 0xA1, 0x9D,
-    0x0E, 0x45, 0xDD, 0x3A, 0xC1, 0xDF, 0xDD, 0xAE, 0x63, 0x05, 0x28, 0x1C, 0x58, 0x89, 0x47, 0x2A,
-    0xB1, 0x9D, 0xDE, 0x19, 0xE8, 0x01, 0xC1, 0x62, 0x9C, 0xF3, 0x13, 0xC2, 0xCD, 0x5C, 0xF2, 0xFD,
-    0x6F, 0x67, 0x9E, 0x35, 0x6F, 0xCF, 0xC4, 0x6C, 0x01, 0xE0, 0x1C, 0xB8, 0x56, 0xD4, 0x02, 0xE2,
-    0x15, 0xC5, 0x06, 0x7F, 0x29, 0xCB, 0x28, 0x69, 0x39, 0xCE, 0x76, 0x28, 0xC7, 0x8C, 0x9E, 0x58,
-    0x70, 0x8F, 0x68, 0x8D, 0x99, 0x4C, 0x43, 0x12, 0x2C, 0x93, 0xBF, 0x60, 0x94, 0xBC, 0x5B, 0x4E,
-    0xB4, 0xCC, 0x53, 0x36, 0xA3, 0x32, 0x21, 0xAA, 0x2E, 0x94, 0x8D, 0xDE, 0xBB, 0x07, 0x5F, 0x83,
-    0x79, 0x1B, 0x37, 0x01, 0x8C, 0xDA, 0x0A, 0x28, 0x3B, 0x12, 0xE6, 0xF9, 0x47, 0xC6, 0xE9, 0xDE,
-    0xC4, 0xD8, 0x3E, 0x51, 0x9E, 0xA3, 0x0F, 0xC7, 0xD7, 0x03, 0x7C, 0xB1, 0xA2, 0xB1, 0x69, 0xE5,
-    0xD8, 0x74, 0x7C, 0x9C, 0x4B, 0x94, 0xCA, 0x39, 0x21, 0xC9, 0x63, 0xC7, 0x1E, 0x01, 0x5F, 0xA9,
-    0xBD, 0xBC, 0xF6, 0x93, 0xE2, 0xBC, 0x5B, 0x9D, 0xF1, 0xC3, 0xD2, 0x90, 0x0B, 0x59, 0xF1, 0x1F,
-    0x49, 0xC6, 0x20, 0xB8, 0x84, 0xCD, 0x1D, 0x19, 0xD4, 0xC8, 0x10, 0x6A, 0xFD, 0x64, 0x32, 0xEA,
-    0x27, 0x90, 0x71, 0x7D, 0xF5, 0x2B, 0x8C, 0x21, 0x4C, 0x47, 0x4D, 0x2D, 0x49, 0x0E, 0x54, 0x09,
-    0x1E, 0x9E, 0x8E, 0xD0, 0xC4, 0xC2, 0x47, 0xC5, 0x95, 0x12, 0xA4, 0x57, 0x4A, 0xE0, 0x74, 0x45,
-    0xAB, 0xBB, 0x1B, 0x90, 0x62, 0x38, 0x8F, 0xD8, 0x38, 0x9D, 0x99, 0xB0, 0x97, 0xF3, 0x4F, 0x49,
-    0xF5, 0x8E, 0xE3, 0x90, 0x5E, 0xD6, 0xA4, 0x89, 0xB2, 0x2C, 0x38, 0x3A, 0x18, 0x36, 0x23, 0xC9,
-    0xE5, 0xAA, 0x36, 0xA7, 0x3E, 0x11, 0x78, 0x7D, 0x0A, 0xE6, 0xC4, 0xB2, 0xD9, 0x8D, 0x53, 0x28,
-    0x21, 0xA1, 0x98, 0x7A, 0x91, 0x4B, 0xD4, 0xB5, 0x14, 0xA3, 0x25, 0xFD, 0xF8, 0x1F, 0x0F, 0x55,
-    0xEA, 0xA4, 0x56, 0xB9, 0xEF, 0xFA, 0xB8, 0x5C, 0x1F, 0xEF, 0xDC, 0x63, 0xC9, 0xEC, 0xA5, 0x9A,
-    0x32, 0xC4, 0x16, 0x04, 0x33, 0xB0, 0xDD, 0x4F, 0xCF, 0xCF, 0xA7, 0xE5, 0x31, 0x67, 0x57, 0x9C,
-    0x0D, 0x36, 0xEE, 0xE4, 0x92, 0xC8, 0xAC, 0x65, 0x76, 0x74, 0xF3, 0x71, 0xAF, 0xC7, 0x93, 0x84,
-    0xBD, 0x3C, 0xC6, 0x2F, 0x56, 0x4D, 0xF1, 0x7B, 0x40, 0x3B, 0x9D, 0xBC, 0xD4, 0x7C, 0x78, 0xA0,
-    0x4F, 0xE2, 0x11, 0xF4, 0xDB, 0x3A, 0x71, 0x49, 0xBF, 0x6B, 0x37, 0x97, 0xA2, 0x22, 0x2F, 0x49,
-    0x34, 0xD7, 0xB6, 0x5E, 0x4A, 0x3B, 0xB3, 0x2E, 0x75, 0xC0, 0x34, 0x46, 0xE4, 0x37, 0xC6, 0xE5,
-    0xD8, 0x9A, 0xCD, 0x95, 0x84, 0x1C, 0x76, 0x5E, 0xC4, 0xCB, 0xCD, 0xCD, 0xB5, 0x9B, 0xD5, 0xDE,
-    0xCD, 0xE9, 0xE6, 0xCD, 0x7E, 0xEF, 0x26, 0x29, 0x89, 0x97, 0x9B, 0xA3, 0xD7, 0x98, 0xE5, 0x66,
-    0xE8, 0x23, 0x1F, 0x12, 0x91, 0x50, 0xB0, 0x14, 0xBF, 0xD9, 0xB8, 0x56, 0x5A, 0x6A, 0xE3, 0x50,
-    0x78, 0x42, 0x40, 0xCE, 0x60, 0x96, 0xB2, 0x46, 0x86, 0x43, 0x79, 0x39, 0x13, 0xC1, 0xCB, 0x91,
-    0x14, 0x4A, 0x1C, 0x4A, 0x2A, 0x81, 0x99, 0x94, 0xD0, 0x8C, 0xF2, 0x2F, 0x03, 0x6F, 0x07, 0x93,
-    0x2B, 0x53, 0x28, 0xBD, 0x99, 0xDF, 0xA5, 0xD7, 0xA7, 0x5A, 0x81, 0x6F, 0x84, 0x8F, 0x51, 0xEB,
-    0x78, 0x47, 0x52, 0x92, 0x9A, 0xC4, 0x24, 0x44, 0x28, 0xCB, 0x56, 0x95, 0x4F, 0xEE, 0x85, 0xC3,
-    0xF8, 0xD5, 0x55, 0x01, 0x0A, 0xE7, 0x02, 0x63, 0xC9, 0xD3, 0x78, 0x51, 0x8A, 0xDB, 0xA3, 0x13,
-    0x08, 0x4F, 0x58, 0xBA, 0x03, 0x4A, 0xE8, 0x8E, 0xA9, 0x14, 0x11, 0x99, 0xB2, 0x37, 0x68, 0xE7,
-    0x84, 0x48, 0xDE, 0x15, 0x8E, 0x19, 0x1A, 0x04, 0x13, 0xF7, 0xD9, 0xB9, 0x37, 0x1B, 0x40, 0x1A,
-    0x4B, 0x9B, 0x9C, 0xA1, 0x76, 0xE4, 0xDE, 0xEC, 0x50, 0x49, 0x31, 0x28, 0xB2, 0x85, 0x5F, 0xB5,
-    0x66, 0x64, 0x05, 0xE7, 0xDD, 0x6D, 0xF8, 0x3B, 0x56, 0x34, 0xE0, 0x06, 0xDE, 0xA8, 0x4C, 0xF4,
-    0x10, 0x0A, 0x86, 0xBD, 0x6D, 0x8A, 0x08, 0xC3, 0x44, 0x12, 0x2A, 0xF8, 0x00, 0x09, 0xF1, 0x03,
-    0x68, 0x5C, 0x5C, 0x99, 0x0B, 0xA8, 0x78, 0x0F, 0x5B, 0x68, 0x2D, 0x36, 0x3D, 0x35, 0xD9, 0xB3,
-    0x03, 0x33, 0xA2, 0x80, 0x9E, 0x72, 0x08, 0x91, 0xE2, 0x53, 0x17, 0x93, 0xEA, 0x0C, 0xE4, 0xA6,
-    0x5B, 0x1B, 0x92, 0x51, 0x17, 0x66, 0x48, 0xB7, 0x58, 0xAC, 0xDD, 0x00, 0x00, 0xEC, 0x58, 0xD8,
-    0xFA, 0x98, 0xA1, 0xAF, 0x30, 0x69, 0xE1, 0x6A, 0x48, 0x05, 0xBF, 0xE0, 0xC4, 0x73, 0xA5, 0x78,
-    0x06, 0xDC, 0x02, 0x26, 0xFB, 0x62, 0x26, 0xE6, 0x5B, 0xE7, 0x76, 0x78, 0x44, 0xC0, 0xB3, 0x59,
-    0x2A, 0x41, 0x54, 0x87, 0xB9, 0x3C, 0xD5, 0xC0, 0x32, 0x11, 0xD8, 0x12, 0x7E, 0xD5, 0xC8, 0x2A,
-    0xAC, 0xEC, 0xE1, 0xA1, 0x92, 0xDF, 0x0B, 0x22, 0x5D, 0x2C, 0x3D, 0x30, 0xD7, 0x22, 0x89, 0xDC,
-    0x9E, 0x37, 0x82, 0x1E, 0x14, 0xD0, 0x3E, 0x33, 0x52, 0x86, 0xFF, 0x72, 0x26, 0xBD, 0x03, 0x37,
-    0x2C, 0x70, 0xE3, 0xCC, 0xE8, 0x84, 0xB5, 0xC9, 0x7E, 0xD8, 0x2A, 0xA3, 0xDE, 0xA9, 0x90, 0xF4,
-    0xB1, 0xEC, 0x7B, 0x27, 0xCB, 0x46, 0x76, 0x43, 0x29, 0x58, 0xC5, 0x60, 0xB8, 0x7C, 0x59, 0x70,
-    0x27, 0x93, 0x29, 0xF7, 0x4A, 0x7F, 0xF2, 0x22, 0x92, 0x89, 0xC3, 0x02, 0x20, 0x1D, 0x42, 0x41,
-    0xA6, 0x0C, 0x11, 0xCD, 0x74, 0x6A, 0x82, 0x71, 0xA3, 0xD2, 0x8E, 0x49, 0xE9, 0xC6, 0xAC, 0x14,
-    0xA5, 0x94, 0xEB, 0x2C, 0xE5, 0xDD, 0x4A, 0x05, 0xC1, 0x59, 0xD7, 0x49, 0x3E, 0x54, 0xD7, 0x60,
-    0x2C, 0x54, 0x09, 0xE1, 0x35, 0x64, 0x9D, 0x01, 0x79, 0x37, 0xC7, 0x24, 0x2D, 0x41, 0x5C, 0xDA,
-    0x48, 0xCD, 0x59, 0x65, 0x00, 0x44, 0x82, 0x83, 0x8B, 0x69, 0x31, 0x9F, 0xBA, 0x3C, 0x82, 0x00,
-    0xE8, 0x99, 0x59, 0x66, 0x73, 0xDB, 0x2C, 0x21, 0x33, 0x64, 0x90, 0x70, 0x80, 0xA1, 0xF0, 0x30,
-    0x63, 0xA6, 0x60, 0x28, 0x3C, 0xF0, 0xC3, 0x95, 0xCE, 0x4A, 0x41, 0x1D, 0x96, 0xD6, 0x64, 0x65,
-    0x78, 0x12, 0x77, 0x74, 0x9D, 0xC0, 0x1F, 0xC7, 0xC8, 0xE5, 0x15, 0x68, 0x12, 0xC1, 0x8D, 0xC7,
-    0xFF, 0xE1, 0xDD, 0x82, 0x4B, 0xE7, 0x1D, 0x44, 0xAC, 0x97, 0x40, 0xB1, 0xB9, 0xF9, 0xA4, 0xBA,
-    0x51, 0x8B, 0xF9, 0x7F, 0xE7, 0x5D, 0x77, 0x93, 0x77, 0xAA, 0xD0, 0x18, 0xC7, 0xBB, 0x51, 0xBC,
-    0xEB, 0x3C, 0xDA, 0x58, 0x78, 0xF7, 0xE7, 0x0E, 0x78, 0xCE, 0x66, 0x0D, 0x52, 0x1E, 0xA4, 0x38,
-    0xB0, 0x13, 0xE9, 0x31, 0xF3, 0xA4, 0xEB, 0xFC, 0xA5, 0x56, 0x9E, 0xF4, 0x37, 0xF8, 0xDB, 0xAD,
-    0xFC, 0xB5, 0xE4, 0x6F, 0x26, 0xFE, 0x36, 0x2C, 0xE1, 0x93, 0xF3, 0xB0, 0xE5, 0x92, 0xE1, 0xDB,
-    0xBA, 0xF4, 0x6B, 0x66, 0x3D, 0x32, 0x14, 0xEC, 0x9B, 0xC8, 0x45, 0x7A, 0x19, 0x06, 0xA8, 0x84,
-    0x95, 0x25, 0x57, 0x8C, 0x18, 0xE8, 0x24, 0x76, 0x24, 0x0E, 0xA7, 0x4B, 0x59, 0xA6, 0x60, 0x19,
-    0x6E, 0x21, 0x56, 0xF8, 0xED, 0x9E, 0x2B, 0x1A, 0x24, 0x0A, 0x46, 0x8D, 0x79, 0xCF, 0x1D, 0x61,
-    0x5E, 0x63, 0xFE, 0xD5, 0xC5, 0xD5, 0x6E, 0x55, 0x36, 0xA0, 0xAB, 0x4C, 0xE6, 0x25, 0xFD, 0x34,
-    0x45, 0xEF, 0x0B, 0xDC, 0x38, 0xD9, 0xCA, 0x05, 0xBB, 0x96, 0x1F, 0xEC, 0xFA, 0x75, 0x36, 0xFF,
-    0xCC, 0x52, 0x43, 0xF1, 0x69, 0x39, 0x10, 0x84, 0xA8, 0xD4, 0x90, 0xBB, 0x00, 0x4B, 0x9C, 0x34,
-    0x14, 0xCB, 0xC5, 0xD5, 0x3D, 0x9D, 0x82, 0x48, 0xB4, 0x37, 0x91, 0x4E, 0xBB, 0x56, 0x78, 0x6E,
-    0xC0, 0x9D, 0xAB, 0xAD, 0xF3, 0x6B, 0x00, 0xE6, 0xAA, 0x9C, 0xB4, 0x96, 0xB6, 0x9E, 0xB4, 0xBA,
-    0xE2, 0xCC, 0x99, 0xE6, 0x4D, 0x9A, 0xA3, 0xFA, 0x33, 0xCC, 0x5F, 0xE8, 0xDC, 0xC5, 0x50, 0xC5,
-    0xF7, 0xCE, 0xC5, 0x52, 0xCE, 0x8C, 0x5A, 0x07, 0x09, 0x5D, 0x44, 0x88, 0x85, 0x01, 0x48, 0x9B,
-    0x72, 0x21, 0xC7, 0x76, 0x08, 0x47, 0x80, 0x71, 0xEB, 0x22, 0xAB, 0xD0, 0xA4, 0x28, 0x2C, 0x7C,
-    0x0C, 0x77, 0xEE, 0x1D, 0xF7, 0x41, 0x14, 0x04, 0xC9, 0x24, 0xBE, 0x65, 0xBA, 0x9D, 0xCC, 0xEF,
-    0x50, 0xCE, 0xAE, 0xE6, 0x51, 0xC8, 0x18, 0x94, 0x73, 0xB3, 0x02, 0x44, 0xBF, 0x04, 0x12, 0xE4,
-    0x6D, 0x14, 0x17, 0x6A, 0x4B, 0x45, 0x26, 0x49, 0x45, 0xCE, 0x82, 0x42, 0xCB, 0xC2, 0xF2, 0xE8,
-    0x52, 0x05, 0x02, 0x79, 0xC5, 0xC3, 0x89, 0x87, 0x57, 0x51, 0x3C, 0x54, 0x2F, 0xA2, 0x10, 0xA1,
-    0xCC, 0x00, 0x78, 0x2E, 0xFA, 0x3F, 0x63, 0x2E, 0xDC, 0x51, 0xC8, 0xA9, 0x33, 0xD2, 0x4D, 0x5F,
-    0x8A, 0x45, 0x55, 0x1B, 0x71, 0xA9, 0xAB, 0x58, 0x27, 0x61, 0xDB, 0x66, 0xB5, 0x64, 0x65, 0x10,
-    0x58, 0x7E, 0x94, 0x09, 0x84, 0xFC, 0x6B, 0x99, 0xEB, 0x30, 0x5D, 0x6C, 0xC0, 0x20, 0xFC, 0xA5,
-    0xE6, 0xD6, 0xA3, 0xD9, 0xC0, 0x53, 0xA7, 0x40, 0xCF, 0x8C, 0x3A, 0x2C, 0xA4, 0x45, 0x0F, 0x91,
-    0x59, 0x18, 0x17, 0x66, 0xC8, 0xF7, 0xF4, 0x75, 0xBA, 0xDC, 0x9D, 0x41, 0xF8, 0xD8, 0x30, 0x9F,
-    0x3A, 0x93, 0xA6, 0x23, 0xA4, 0x84, 0x6D, 0xCC, 0xBF, 0x48, 0xBA, 0x18, 0x4E, 0x91, 0x03, 0x12,
-    0x88, 0x17, 0xA1, 0xDA, 0x07, 0xA6, 0x88, 0xEB, 0x4D, 0x6B, 0x55, 0xA9, 0xDB, 0xB4, 0xAC, 0x77,
-    0x64, 0x5B, 0x06, 0x1C, 0x06, 0x84, 0xCD, 0x17, 0x2C, 0xD9, 0x9D, 0x99, 0xCD, 0x97, 0x8C, 0xFE,
-    0xF7, 0x4D, 0xF0, 0x25, 0xC3, 0x65, 0xEF, 0x32, 0x71, 0x4B, 0xF7, 0x58, 0xE9, 0x28, 0xAA, 0x22,
-    0xD8, 0xDA, 0x29, 0x32, 0xB5, 0x57, 0x2A, 0xE3, 0x02, 0xB0, 0x4B, 0x8B, 0x7C, 0x40, 0xC7, 0x2D,
-    0xC2, 0xD0, 0xC1, 0x83, 0x33, 0x87, 0x09, 0xA4, 0x96, 0x83, 0x34, 0x34, 0xFB, 0xA1, 0xEA, 0x00,
-    0xBF, 0x13, 0x3E, 0x55, 0x4B, 0xC9, 0xB7, 0x55, 0x1C, 0x84, 0xDD, 0x88, 0x77, 0xAE, 0x0E, 0xE0,
-    0x1F, 0x4F, 0x02, 0xC5, 0xA5, 0x14, 0xBA, 0x10, 0xEE, 0x81, 0xA2, 0x48, 0x9B, 0x5D, 0x4E, 0x42,
-    0x1E, 0xA7, 0x42, 0x12, 0x29, 0xBD, 0x02, 0xFF, 0xE1, 0x56, 0x22, 0x34, 0x23, 0xA5, 0x6B, 0xA8,
-    0x15, 0xC1, 0x40, 0x25, 0xE8, 0x59, 0x92, 0x6E, 0x21, 0x78, 0x15, 0x9A, 0x2D, 0xBB, 0x3F, 0xC4,
-    0xA8, 0x50, 0x06, 0x41, 0x96, 0xA8, 0x51, 0x7F, 0x41, 0x1D, 0x0D, 0xEA, 0x5C, 0x47, 0xAC, 0x7A,
-    0xA9, 0x74, 0xBE, 0x5B, 0xAA, 0x9F, 0x65, 0xB5, 0x24, 0x61, 0x4F, 0xCD, 0x02, 0x86, 0xA5, 0x78,
-    0x79, 0x65, 0x44, 0xCE, 0x7B, 0xD3, 0x55, 0x77, 0xCC, 0x38, 0x71, 0x3E, 0x15, 0x46, 0x56, 0x14,
-    0xBF, 0x9F, 0xCA, 0x71, 0x03, 0x61, 0x2F, 0x97, 0x27, 0x3A, 0x07, 0xE3, 0xBC, 0x66, 0x79, 0x85,
-    0xED, 0xF7, 0x70, 0xBF, 0xDD, 0x9B, 0x51, 0xAF, 0xF4, 0xB8, 0x19, 0x6E, 0x8F, 0xBD, 0xCC, 0xB1,
-    0x5F, 0xEB, 0x33, 0x22, 0x61, 0x4B, 0x9A, 0x64, 0xFA, 0xAA, 0xFD, 0x42, 0xED, 0x5C, 0xCD, 0x80,
-    0x04, 0xB3, 0xBA, 0x7A, 0xE1, 0x1C, 0xC0, 0x02, 0xA8, 0xAE, 0x00, 0x98, 0x06, 0x35, 0x0E, 0xE9,
-    0xEE, 0x01, 0x30, 0xB0, 0x7A, 0xE3, 0x01, 0xD8, 0x0D, 0x94, 0x36, 0xF8, 0x41, 0x5B, 0x87, 0xD2,
-    0x58, 0x9B, 0x53, 0xFE, 0xCF, 0x5E, 0xE6, 0x80, 0x7D, 0xCE, 0xF0, 0x63, 0xF5, 0x93, 0xE5, 0x6C,
-    0x02, 0xA6, 0x5B, 0xF6, 0x41, 0x81, 0x89, 0xEA, 0xB8, 0x8E, 0x1A, 0xAA, 0x32, 0x7F, 0x36, 0x5D,
-    0xD0, 0x07, 0xBD, 0x1A, 0x9F, 0x9B, 0xBD, 0x25, 0x9E, 0xB2, 0xD1, 0xC5, 0x35, 0x38, 0xC8, 0x3A,
-    0x4F, 0xBC, 0x47, 0xBD, 0xC7, 0x98, 0x7B, 0x47, 0x3C, 0x7B, 0xEA, 0x11, 0x11, 0x32, 0xC0, 0xB1,
-    0x94, 0x7D, 0x23, 0x71, 0xB7, 0x5B, 0x1B, 0x01, 0xD3, 0xD2, 0xC0, 0x8B, 0xD9, 0x4C, 0x4A, 0xFE,
-    0x9E, 0x5E, 0x8D, 0x95, 0xA4, 0x43, 0x56, 0xE2, 0xEE, 0xB3, 0xDD, 0xDA, 0xE3, 0x0F, 0xBE, 0x1C,
-    0x72, 0x9B, 0x8C, 0x48, 0x4D, 0x6D, 0xC7, 0xB8, 0x4A, 0x73, 0x13, 0x36, 0x96, 0x0C, 0xA3, 0xDB,
-    0x1A, 0xBE, 0x7B, 0x7E, 0x7E, 0x4E, 0xC1, 0xC0, 0xD1, 0x4F, 0x2F, 0xD3, 0xED, 0xD0, 0x8C, 0xC3,
-    0x3A, 0xF0, 0x40, 0x24, 0x9C, 0x9B, 0x43, 0x66, 0x30, 0x17, 0xA6, 0x78, 0x74, 0x31, 0xC0, 0x10,
-    0xD3, 0x81, 0x7D, 0xED, 0x1E, 0xEA, 0x10, 0x75, 0xEA, 0xBE, 0xA4, 0xEC, 0xD9, 0xD1, 0x06, 0xA9,
-    0xBC, 0xC8, 0xCD, 0x73, 0xE7, 0xB6, 0x52, 0xA6, 0xED, 0x96, 0x97, 0x62, 0x8B, 0xCB, 0xBC, 0xB5,
-    0xF9, 0x86, 0x05, 0x47, 0x80, 0xDE, 0xF4, 0x8B, 0xD2, 0x32, 0x33, 0x3A, 0x04, 0x33, 0xEB, 0xEF,
-    0xF9, 0x16, 0xDA, 0xC1, 0xD6, 0xFB, 0x7B, 0x57, 0xF2, 0x5C, 0x0A, 0xCA, 0xAE, 0x9E, 0xD5, 0x2E,
-    0x11, 0x65, 0x67, 0xEE, 0x80, 0xB7, 0x48, 0x2F, 0x92, 0x0F, 0xA0, 0x3F, 0xB6, 0x78, 0x11, 0x24,
-    0x01, 0xBC, 0x12, 0x10, 0x34, 0x70, 0x18, 0x59, 0x05, 0x96, 0x94, 0x11, 0x0B, 0x31, 0xA2, 0x88,
-    0x6E, 0xE7, 0x75, 0x36, 0xFB, 0x18, 0x6C, 0x5B, 0x66, 0x01, 0xEC, 0x13, 0x4D, 0x09, 0x2B, 0xDC,
-    0xF0, 0x2B, 0xC5, 0x76, 0xAE, 0xA2, 0x21, 0xFA, 0xEC, 0x51, 0x59, 0x65, 0xCC, 0xD4, 0xFA, 0x44,
-    0xF5, 0x5C, 0x15, 0xE3, 0x6E, 0x1F, 0x11, 0x5A, 0x54, 0x40, 0x07, 0xED, 0x66, 0x7E, 0xF3, 0x3D,
-    0xB9, 0xA0, 0xD9, 0x1B, 0x03, 0x09, 0xDB, 0x4F, 0x7F, 0xD6, 0x9C, 0x48, 0xE5, 0xA8, 0x76, 0xB9,
-    0x51, 0x79, 0x1B, 0x98, 0x7F, 0x7E, 0xC1, 0x90, 0x9E, 0xBB, 0x72, 0xB1, 0xAF, 0x5C, 0xEA, 0xBC,
-    0xAE, 0x4E, 0xA6, 0x93, 0x39, 0xA7, 0x9D, 0xED, 0x55, 0x5F, 0x96, 0x02, 0xDA, 0x6D, 0xF5, 0x22,
-    0x27, 0x62, 0xDF, 0x79, 0x20, 0x6A, 0xBC, 0xFB, 0x2B, 0x90, 0x65, 0x92, 0x81, 0x3B, 0x94, 0x2C,
-    0x6B, 0xE3, 0xC0, 0x4C, 0x04, 0x8D, 0x44, 0xC1, 0x85, 0x4A, 0x92, 0x18, 0x37, 0xAE, 0xCF, 0x29,
-    0x61, 0x10, 0xD0, 0x08, 0x18, 0x17, 0xC4, 0xC5, 0x09, 0xB3, 0xD5, 0x8D, 0x5E, 0x36, 0xF8, 0x49,
-    0xEB, 0xE4, 0x01, 0xBB, 0x7C, 0xD0, 0x50, 0x20, 0xA7, 0x6B, 0x39, 0x92, 0x48, 0x00, 0x7A, 0x47,
-    0x16, 0x04, 0xF3, 0x8B, 0x63, 0x80, 0xC0, 0xB8, 0x9D, 0xB0, 0x6C, 0xC1, 0x92, 0x1B, 0x1C, 0x30,
-    0x30, 0xCD, 0x14, 0x7F, 0xF1, 0xEE, 0x24, 0xCC, 0xC2, 0xEC, 0xDC, 0xDE, 0xB9, 0xC9, 0x82, 0xAD,
-    0x1C, 0xC7, 0xB7, 0xC1, 0x82, 0xD2, 0xF7, 0x3F, 0xAF, 0x58, 0x10, 0x9C, 0xAB, 0xC3, 0xA3, 0x71,
-    0x4A, 0x87, 0xBA, 0x6F, 0x2D, 0x0E, 0xCD, 0x71, 0xA4, 0x5F, 0xB1, 0xA8, 0xF3, 0x66, 0xB3, 0x2B,
-    0xF7, 0x93, 0x25, 0xD3, 0xF1, 0x82, 0x36, 0xFE, 0x20, 0x16, 0x7A, 0xC4, 0x21, 0x8C, 0xE2, 0x76,
-    0x10, 0x48, 0x09, 0xBE, 0x61, 0x42, 0xB1, 0x84, 0x9A, 0xFD, 0x09, 0x9B, 0xB5, 0x7A, 0x16, 0xCA,
-    0x2D, 0xDB, 0xD5, 0x16, 0x8D, 0xEB, 0x8C, 0x98, 0x62, 0x82, 0x15, 0x96, 0xF3, 0x6F, 0x81, 0x0E,
-    0x61, 0x2F, 0x40, 0x68, 0x88, 0xCB, 0x12, 0x13, 0xF4, 0x31, 0xAD, 0x65, 0x30, 0x11, 0x1B, 0xCC,
-    0x4E, 0x4A, 0x13, 0x59, 0x24, 0x8B, 0x51, 0xE7, 0xDB, 0x09, 0x69, 0x60, 0xAD, 0x50, 0x26, 0xC3,
-    0x1C, 0x8C, 0x4D, 0x0D, 0x24, 0x86, 0xC5, 0x2F, 0x46, 0xB6, 0xA0, 0x06, 0xF6, 0xE2, 0xD9, 0x19,
-    0x08, 0x8E, 0xAE, 0xF0, 0xF9, 0x5E, 0xCB, 0xAA, 0x34, 0xE1, 0x3D, 0xE6, 0xD1, 0xCA, 0x19, 0x2C,
-    0x19, 0x16, 0x94, 0x97, 0x4F, 0x30, 0xAF, 0xE6, 0x1B, 0xCD, 0x6B, 0xA2, 0x79, 0xCD, 0x34, 0xAF,
-    0x91, 0xE6, 0xD5, 0xC7, 0xCC, 0x00, 0x2D, 0xC1, 0x01, 0x0B, 0xCC, 0xA0, 0x1F, 0x63, 0x2A, 0x41,
-    0x06, 0x60, 0x1D, 0x18, 0x5B, 0xAF, 0x9E, 0x3E, 0x38, 0x66, 0xD5, 0x23, 0x4F, 0x08, 0x2F, 0xD8,
-    0x07, 0xDD, 0xFA, 0xA6, 0x47, 0xA8, 0xE0, 0x57, 0x8D, 0x12, 0xC3, 0x01, 0x43, 0xB7, 0x20, 0xD0,
-    0x55, 0xA7, 0x41, 0x45, 0x97, 0xC1, 0xD5, 0x69, 0x55, 0x7A, 0x29, 0x68, 0x5B, 0xBB, 0xFD, 0xBB,
-    0x5B, 0x16, 0xB5, 0x5D, 0xB1, 0xC5, 0xC9, 0xFD, 0x07, 0xBE, 0xC8, 0xEE, 0x2B, 0x29, 0xE6, 0xE8,
-    0x7A, 0x33, 0xC0, 0x55, 0x97, 0xF6, 0x2A, 0x29, 0x37, 0xAA, 0x28, 0x4B, 0x25, 0xE5, 0x66, 0x41,
-    0xA6, 0x7F, 0x7A, 0x41, 0xE6, 0xE6, 0x52, 0xF4, 0x35, 0xA3, 0x6B, 0x16, 0x94, 0xF7, 0xFE, 0x0F,
-    0x3C, 0x76, 0x05, 0x7A, 0x04, 0x19, 0x95, 0x7C, 0xB3, 0x4A, 0xDA, 0x10, 0x37, 0x4C, 0x19, 0x9E,
-    0xE3, 0x0B, 0x06, 0x84, 0x9C, 0x9F, 0xB3, 0x83, 0xFD, 0x6E, 0x4D, 0xB3, 0xDC, 0xBA, 0xBA, 0x4A,
-    0x42, 0xE4, 0x56, 0x6C, 0x58, 0x01, 0x60, 0x5E, 0x51, 0xAB, 0xFF, 0x22, 0x06, 0x59, 0xD6, 0x9B,
-    0x8B, 0x1C, 0x64, 0x4D, 0x46, 0x65, 0x33, 0x52, 0x32, 0xB8, 0x94, 0xE3, 0x06, 0xDF, 0x58, 0x59,
-    0x54, 0x1D, 0x6C, 0xB9, 0x5B, 0x92, 0xCE, 0xD1, 0x95, 0xB2, 0xDC, 0x5D, 0xCF, 0xFE, 0xC6, 0x29,
-    0x14, 0x14, 0x02, 0x10, 0x37, 0xA9, 0xE6, 0x6E, 0x03, 0x8D, 0x47, 0x3A, 0x50, 0xC1, 0x8A, 0x93,
-    0xB7, 0xFE, 0x65, 0xB4, 0xFF, 0x4A, 0xDD, 0x88, 0x3F, 0x03, 0x5A, 0x05, 0x32, 0x2E, 0xB0, 0x7E,
-    0x38, 0x32, 0xBF, 0x82, 0x1F, 0xAE, 0x68, 0x21, 0x13, 0xD4, 0x04, 0x24, 0x26, 0x75, 0x29, 0x64,
-    0x30, 0xB8, 0x4E, 0x39, 0x95, 0x40, 0xDD, 0x70, 0xD7, 0x32, 0xB7, 0xAF, 0xFA, 0xCE, 0xB8, 0x6F,
-    0x9C, 0xB3, 0x5E, 0xC8, 0x16, 0x39, 0xE1, 0x23, 0x38, 0xC5, 0x5C, 0xB6, 0x75, 0x9A, 0x75, 0x7D,
-    0x09, 0xC6, 0x61, 0x99, 0xE2, 0xCB, 0x98, 0x14, 0xB1, 0x6D, 0xCD, 0x22, 0x5B, 0x51, 0xFC, 0xDB,
-    0x48, 0x69, 0x4C, 0x04, 0xB6, 0x13, 0xCB, 0x95, 0x13, 0x65, 0x34, 0xB1, 0xDD, 0x34, 0xB2, 0x0C,
-    0xCC, 0xD0, 0xC5, 0x97, 0x1F, 0x98, 0x78, 0x75, 0x2E, 0xFB, 0x8A, 0x3A, 0xFA, 0xCF, 0x56, 0x2A,
-    0xAB, 0xFC, 0x8E, 0x60, 0xBC, 0x96, 0x76, 0x5B, 0xB5, 0x02, 0xB7, 0xF2, 0xE3, 0xB7, 0x95, 0xFD,
-    0xD2, 0x3F, 0xB2, 0x5F, 0x7F, 0x79, 0xD2, 0x62, 0xCD, 0xB4, 0x49, 0x18, 0x71, 0x98, 0x1F, 0xCA,
-    0xD1, 0x12, 0xC0, 0x75, 0x7A, 0xD5, 0x80, 0x55, 0x08, 0x61, 0x6F, 0x36, 0x0C, 0x84, 0x79, 0x5F,
-    0xE7, 0x4B, 0x26, 0x7A, 0xED, 0x85, 0xDC, 0x81, 0x13, 0x66, 0xC2, 0xFC, 0x6B, 0x50, 0xA8, 0x36,
-    0x62, 0x41, 0x0F, 0x72, 0x6B, 0xF5, 0x22, 0x30, 0x17, 0x1E, 0xB1, 0x00, 0x5E, 0x3B, 0x44, 0x84,
-    0x63, 0xAB, 0x4A, 0x05, 0x51, 0x38, 0xF4, 0x89, 0xE7, 0xA6, 0xDE, 0x91, 0xC5, 0x4A, 0x63, 0xE2,
-    0x96, 0xAF, 0xD2, 0xF4, 0xCE, 0xD5, 0xAB, 0xA4, 0xC6, 0x30, 0xC7, 0x7E, 0x41, 0xD2, 0x28, 0xCE,
-    0x51, 0x2C, 0xD8, 0x0C, 0x81, 0xCE, 0x9C, 0xED, 0xEE, 0x42, 0xCA, 0x6F, 0x30, 0xC3, 0xAC, 0x67,
-    0xB2, 0x3D, 0xC8, 0xBD, 0xFF, 0x2C, 0x56, 0x47, 0x28, 0xE3, 0x92, 0xB6, 0x3A, 0xEF, 0x58, 0xAE,
-    0x4F, 0xF6, 0x11, 0x01, 0x22, 0xD1, 0xA9, 0x3C, 0xDC, 0x15, 0x22, 0x88, 0xFF, 0x08, 0x44, 0x10,
-    0x12, 0x11, 0x24, 0x25, 0x23, 0x50, 0xE1, 0xBC, 0x1B, 0x02, 0xD0, 0xC8, 0x7D, 0x56, 0x48, 0xBB,
-    0x87, 0x6B, 0x9F, 0x90, 0x75, 0xCA, 0xC8, 0xA0, 0xA0, 0x43, 0x0A, 0xBF, 0x89, 0xCC, 0xF7, 0x72,
-    0xFA, 0x51, 0x20, 0x31, 0xE5, 0x72, 0xCB, 0x74, 0x0E, 0x04, 0xAE, 0xF1, 0x93, 0x4A, 0xAB, 0x5B,
-    0x67, 0x9E, 0x37, 0x4B, 0xAB, 0xE3, 0xD2, 0x89, 0xCA, 0x80, 0xF4, 0x90, 0x01, 0x87, 0xD3, 0x0B,
-    0x83, 0x4B, 0x2C, 0xFD, 0x6F, 0xE7, 0xDE, 0xB0, 0x50, 0x92, 0xC2, 0x64, 0x3B, 0x9E, 0x7D, 0x97,
-    0x8A, 0x95, 0x06, 0xA5, 0x9A, 0xDA, 0xE9, 0x1E, 0xA4, 0x30, 0xBD, 0x30, 0x6F, 0x89, 0xB8, 0xB9,
-    0x94, 0x39, 0x76, 0xCD, 0xBD, 0xB0, 0x56, 0xB7, 0x94, 0x38, 0xC4, 0x1C, 0xCC, 0xF3, 0x43, 0x80,
-    0xF3, 0xBB, 0x5F, 0xDC, 0x59, 0x5E, 0x39, 0xCA, 0xFD, 0x3B, 0x4F, 0x9B, 0x9B, 0xDF, 0xFB, 0xF5,
-    0x3B, 0x8E, 0x37, 0xFD, 0x03, 0xDF, 0xDB, 0x8A, 0xB0, 0xE9, 0xAD, 0x2B, 0x77, 0xC7, 0xD7, 0xB5,
-    0x8C, 0x7D, 0x76, 0x70, 0x96, 0x22, 0x23, 0xCA, 0xF6, 0x3C, 0x30, 0x93, 0x4C, 0xA2, 0x84, 0x6B,
-    0x0E, 0x9B, 0xA9, 0xCD, 0x86, 0x0E, 0x3B, 0xA5, 0x98, 0xE6, 0x2D, 0x0B, 0x2B, 0x0A, 0x38, 0xF1,
-    0xE5, 0xC9, 0x87, 0x55, 0x32, 0xF7, 0x87, 0x10, 0xCB, 0xB3, 0xDD, 0x5E, 0x83, 0x92, 0x7E, 0xE9,
-    0x81, 0x20, 0x55, 0xED, 0xBD, 0x7C, 0x0E, 0xA9, 0x0D, 0x2A, 0xF2, 0x46, 0xCC, 0x17, 0xD5, 0xFD,
-    0x52, 0xC5, 0x84, 0x19, 0xBA, 0x0A, 0xB4, 0xDA, 0x2A, 0x7B, 0x1E, 0xB3, 0x58, 0x00, 0xDC, 0xF4,
-    0xEC, 0x09, 0xFF, 0x86, 0x60, 0x99, 0xA5, 0x5D, 0xC5, 0x50, 0xA6, 0x5E, 0x4B, 0x1C, 0x75, 0xA2,
-    0x86, 0xEE, 0x26, 0xBF, 0xAA, 0x59, 0xE2, 0x28, 0xA9, 0x27, 0xB8, 0x75, 0x61, 0xD2, 0xFB, 0x00,
-    0x70, 0x9D, 0x19, 0x5B, 0xF6, 0xCD, 0xC3, 0xDF, 0x60, 0xBF, 0x6C, 0x9B, 0xA5, 0x39, 0x29, 0xE8,
-    0x4F, 0xE1, 0x45, 0xFB, 0xF8, 0xA7, 0xD0, 0xC0, 0xA8, 0xB1, 0xEA, 0x74, 0xBE, 0xD6, 0x25, 0xAF,
-    0xF5, 0xE6, 0x2C, 0xA9, 0x0E, 0xE1, 0xDD, 0xFA, 0x53, 0xD3, 0x33, 0xB3, 0x6D, 0xC3, 0x87, 0x00,
-    0x3C, 0x6F, 0xE5, 0xC9, 0x5B, 0x95, 0x39, 0xBC, 0x6F, 0x0E, 0x01, 0xC3, 0xBF, 0xAA, 0x19, 0x60,
-    0xB9, 0x05, 0xB4, 0x86, 0x6F, 0x47, 0xF8, 0xCC, 0xB2, 0x5E, 0xA9, 0xA1, 0xC3, 0xF0, 0xC5, 0xE4,
-    0x51, 0x05, 0x01, 0xE5, 0x96, 0x96, 0xEF, 0xA9, 0x6C, 0x7A, 0x55, 0xCD, 0x3F, 0x6C, 0x96, 0xB6,
-    0xB5, 0xCF, 0xC3, 0xAB, 0xA5, 0xDA, 0xA4, 0x7E, 0xB2, 0xB1, 0x34, 0xA3, 0x84, 0x89, 0xFB, 0x66,
-    0x70, 0x65, 0xE5, 0xD1, 0xF7, 0x09, 0xD9, 0x4E, 0xA7, 0x2A, 0x30, 0xC6, 0x55, 0x0E, 0x65, 0x18,
-    0x8F, 0x37, 0x36, 0x4B, 0x77, 0xD2, 0xBD, 0x82, 0xE6, 0xDC, 0x5F, 0xDC, 0x38, 0x0A, 0xD4, 0xDD,
-    0x54, 0xEB, 0xC1, 0x15, 0x02, 0x01, 0xDA, 0x15, 0xBA, 0x5C, 0xF1, 0x9E, 0x2A, 0x18, 0xF4, 0x7A,
-    0x55, 0x40, 0x04, 0x9A, 0x5E, 0x16, 0x3E, 0xB8, 0x74, 0xD1, 0x55, 0xFA, 0x84, 0x78, 0xCA, 0x76,
-    0x2D, 0x24, 0xF9, 0x7A, 0x59, 0x61, 0xD6, 0x64, 0xCE, 0x79, 0x00, 0x07, 0x8D, 0xDC, 0x8B, 0x17,
-    0x2A, 0xA6, 0xFD, 0x44, 0xCD, 0xD8, 0x52, 0x6B, 0x15, 0xCD, 0x95, 0xD0, 0x08, 0x03, 0x81, 0x39,
-    0xAA, 0xE0, 0xF8, 0xC5, 0xC1, 0x7B, 0x0E, 0x66, 0x86, 0xE1, 0xDA, 0x4A, 0xF0, 0x90, 0x59, 0xEF,
-    0xF7, 0x88, 0x6D, 0x8D, 0x4F, 0x26, 0x4B, 0x1F, 0x1C, 0x95, 0x64, 0x6A, 0xE8, 0xCF, 0x8F, 0x8F,
-    0x98, 0x23, 0xFA, 0xEE, 0x98, 0x09, 0xDE, 0xD3, 0x56, 0x11, 0x51, 0x4D, 0xBD, 0xE6, 0x5D, 0xD9,
-    0xD7, 0xF3, 0x2E, 0x9F, 0x52, 0xED, 0xD4, 0x3D, 0x66, 0x55, 0xAC, 0xC0, 0xF0, 0xD2, 0x77, 0x52,
-    0x7C, 0x76, 0xF5, 0x0D, 0xA9, 0x65, 0xEB, 0xBF, 0xF6, 0xEE, 0x64, 0xF0, 0x11, 0x7F, 0x7D, 0xFA,
-    0x87, 0x7C, 0xB0, 0xE8, 0xDB, 0xEE, 0xDD, 0x86, 0xB2, 0x73, 0x19, 0x34, 0x09, 0xBA, 0x91, 0x96,
-    0xF6, 0xEE, 0x7D, 0x86, 0x3D, 0xAA, 0xE5, 0x93, 0x2E, 0x95, 0x8E, 0x53, 0x4F, 0xD2, 0x47, 0x72,
-    0x3F, 0x4A, 0x29, 0xAF, 0x08, 0xFA, 0xFA, 0xD1, 0x98, 0x7C, 0xB1, 0xFA, 0xCA, 0xF7, 0x22, 0x59,
-    0x3A, 0xFD, 0x4F, 0x95, 0xA3, 0xEE, 0x05, 0xBF, 0x9C, 0xE7, 0xCB, 0xF2, 0xA5, 0xBC, 0x9C, 0x87,
-    0x23, 0xF3, 0xCC, 0xEC, 0x7C, 0xF6, 0xFF, 0x02, 0xD5, 0x5B, 0xCF, 0x8F, 0xE5, 0x56, 0x5A, 0xBD,
-    0xB6, 0xBB, 0xCA, 0x99, 0x58, 0xC2, 0xBD, 0x48, 0x4B, 0x24, 0x11, 0x32, 0x0B, 0x16, 0x28, 0x48,
-    0xE3, 0x7F, 0x20, 0x5D, 0xD7, 0x9D, 0x59, 0x64, 0x49, 0x23, 0xA5, 0x32, 0x8B, 0x5E, 0xF4, 0x26,
-    0x0B, 0x08, 0x8B, 0xDA, 0xB2, 0xE8, 0x6E, 0x7B, 0x60, 0xC1, 0x82, 0x05, 0x2D, 0x04, 0xCC, 0x82,
-    0x05, 0x41, 0xCA, 0x22, 0xA9, 0x08, 0xF5, 0x66, 0x16, 0x0D, 0x74, 0x95, 0x3D, 0xD3, 0x8B, 0x41,
-    0x9A, 0x05, 0x6F, 0xC8, 0x64, 0x66, 0x91, 0xC5, 0x18, 0x42, 0x40, 0x64, 0x24, 0x62, 0xC8, 0xCB,
-    0x8C, 0x2B, 0x6D, 0xFB, 0x72, 0xCE, 0xB9, 0xF6, 0x7B, 0x55, 0x95, 0x0A, 0x52, 0x24, 0x68, 0xD2,
-    0x95, 0x7E, 0x96, 0x9F, 0x9F, 0xEF, 0xBD, 0xDF, 0xEF, 0xEF, 0x7C, 0xDF, 0xBD, 0x31, 0x41, 0x61,
-    0x6C, 0x13, 0x38, 0x13, 0x0F, 0x26, 0x6B, 0xCD, 0xB3, 0xC6, 0xFF, 0xED, 0x18, 0x73, 0xDF, 0x44,
-    0xAD, 0x49, 0x0B, 0x73, 0xCB, 0x84, 0x9D, 0x49, 0x1B, 0xB3, 0x67, 0x82, 0xDE, 0x24, 0x2B, 0x63,
-    0x8D, 0x19, 0x4C, 0xDC, 0x99, 0xBC, 0x32, 0x93, 0x89, 0xD6, 0x26, 0x6F, 0x8C, 0x33, 0xD1, 0x60,
-    0xD2, 0x76, 0x1E, 0x9B, 0xCD, 0x9F, 0xAF, 0x1B, 0x13, 0xBA, 0xDE, 0xE4, 0x6E, 0x34, 0xEE, 0xA3,
-    0x21, 0x9A, 0xCC, 0xA5, 0x64, 0x6D, 0xF4, 0x1A, 0x86, 0x18, 0x5B, 0x18, 0x53, 0xE2, 0xAD, 0x1A,
-    0x9F, 0x09, 0x9F, 0xF1, 0xD4, 0x67, 0x9A, 0x9F, 0x97, 0x78, 0xC7, 0xB6, 0x71, 0x95, 0x3A, 0x57,
-    0x45, 0xCE, 0x15, 0xA6, 0x7C, 0xD3, 0x98, 0xAB, 0xF8, 0xE1, 0x16, 0x3E, 0x0F, 0xF0, 0x79, 0xC5,
-    0x6C, 0xFE, 0x82, 0x9A, 0x23, 0x73, 0xBE, 0x15, 0xBA, 0x77, 0x06, 0x43, 0x6E, 0xDE, 0xF0, 0x53,
-    0x91, 0x5A, 0xE3, 0x57, 0x35, 0xE6, 0x98, 0x17, 0x90, 0x8D, 0xBF, 0x54, 0x0F, 0x48, 0x84, 0x09,
-    0x7B, 0x4E, 0x71, 0xF3, 0xC3, 0x7D, 0x4D, 0x81, 0xD1, 0xCE, 0x39, 0x10, 0x9A, 0xF8, 0x81, 0x95,
-    0x99, 0x09, 0x33, 0x91, 0x1E, 0x64, 0xA7, 0x66, 0xD2, 0x03, 0x32, 0x63, 0x62, 0x4D, 0xEA, 0x38,
-    0x32, 0xE2, 0xB5, 0xC8, 0x9C, 0xA6, 0xC2, 0xDF, 0x2F, 0x61, 0xAA, 0xF4, 0x9F, 0xDD, 0x1F, 0x75,
-    0x78, 0xD2, 0xA5, 0x27, 0x07, 0x1D, 0x86, 0x0D, 0x01, 0xC4, 0x5A, 0x0D, 0x90, 0xEE, 0x1E, 0x18,
-    0x4A, 0x2B, 0x93, 0x53, 0xCE, 0xD5, 0x1D, 0x13, 0xAF, 0xD2, 0x36, 0xE9, 0x62, 0xE7, 0xA6, 0xF8,
-    0x91, 0xFB, 0xF8, 0x9F, 0xBA, 0xE7, 0x8A, 0xFE, 0xB2, 0x31, 0x97, 0xF0, 0x9C, 0xA4, 0x94, 0x64,
-    0x87, 0xAB, 0x4E, 0x5C, 0x35, 0x6F, 0x40, 0x39, 0xD8, 0x03, 0x45, 0x23, 0xF5, 0x02, 0x1E, 0xD3,
-    0x86, 0xEC, 0x1E, 0xF1, 0x7B, 0xD4, 0x92, 0x74, 0xCB, 0xB7, 0xC3, 0x8E, 0xF4, 0x67, 0x07, 0x64,
-    0xC5, 0xE1, 0xFB, 0xD3, 0xF7, 0xDC, 0xDB, 0x26, 0x00, 0x39, 0x2B, 0x93, 0x79, 0x2A, 0xEF, 0x90,
-    0x50, 0xE8, 0xD7, 0x04, 0xFB, 0x23, 0xC4, 0x50, 0x3A, 0xB7, 0x36, 0x09, 0x5E, 0x58, 0x04, 0x10,
-    0x8A, 0x3D, 0xBB, 0x65, 0x5A, 0x03, 0x7E, 0xFD, 0xF6, 0xE9, 0xBF, 0xAB, 0x8B, 0x36, 0x9E, 0x39,
-    0xF3, 0xF8, 0x36, 0x9E, 0xBC, 0xFE, 0x26, 0xE7, 0x1C, 0x28, 0xDE, 0x26, 0xEA, 0xCD, 0x6B, 0x12,
-    0x1F, 0x97, 0xD3, 0x4D, 0x4C, 0xF9, 0xE7, 0xBC, 0xC0, 0x62, 0x4C, 0x5D, 0xD3, 0xBC, 0xEA, 0x26,
-    0x6E, 0x83, 0x11, 0x7A, 0x4E, 0x5A, 0x68, 0xEA, 0x0E, 0x18, 0x4A, 0x56, 0x50, 0xC8, 0x60, 0xEC,
-    0xCA, 0x16, 0x81, 0xFB, 0x78, 0x05, 0x45, 0x83, 0x90, 0x5D, 0x68, 0x9C, 0xD6, 0x0B, 0x7D, 0x72,
-    0xB6, 0x23, 0xDD, 0x3C, 0x65, 0x82, 0xC1, 0x4C, 0xAF, 0xBA, 0x22, 0x25, 0x87, 0xB9, 0x9B, 0x6D,
-    0xF3, 0x92, 0xF9, 0xAD, 0x3E, 0x79, 0xBF, 0xB5, 0x07, 0xC5, 0x70, 0xD9, 0x14, 0x1B, 0xDB, 0xD9,
-    0x75, 0x13, 0xBF, 0x40, 0x10, 0xB2, 0xA1, 0x96, 0xB6, 0xB3, 0x18, 0xA8, 0xF5, 0xFC, 0xE6, 0x66,
-    0xF7, 0x6D, 0xDC, 0x67, 0x26, 0x75, 0x7D, 0xB4, 0x4A, 0x8B, 0x74, 0x1A, 0xCD, 0xAD, 0xB8, 0x49,
-    0xDB, 0xC0, 0xA4, 0x2F, 0xB5, 0x94, 0x78, 0xD0, 0xAD, 0x25, 0x97, 0x17, 0x5F, 0x34, 0x22, 0x26,
-    0xF5, 0x43, 0xDF, 0x6D, 0x52, 0x4A, 0x6F, 0xDD, 0x45, 0xA4, 0xE1, 0xEA, 0xF2, 0x63, 0xA1, 0x1F,
-    0xBF, 0xD7, 0x4A, 0xE0, 0xDD, 0x2D, 0x59, 0x57, 0x9F, 0x16, 0xF9, 0x87, 0x7F, 0x6D, 0x6E, 0x05,
-    0x5D, 0x08, 0xEB, 0xD9, 0xC3, 0xF8, 0x64, 0x2A, 0x72, 0x2F, 0xED, 0xBC, 0xF0, 0xDE, 0x50, 0x98,
-    0xE8, 0x04, 0xB6, 0x8E, 0xDB, 0x7C, 0xBA, 0x27, 0xE3, 0xAE, 0x29, 0x31, 0xFC, 0x5D, 0x99, 0xF9,
-    0x09, 0xDC, 0xAF, 0xC4, 0x6E, 0xC8, 0xBE, 0x35, 0xEC, 0x99, 0xFE, 0x96, 0xE9, 0xEF, 0x9B, 0xF5,
-    0xDA, 0x74, 0x6B, 0x52, 0xD7, 0xF6, 0xC9, 0xEA, 0xA8, 0x5C, 0xD9, 0x4F, 0x9A, 0xDD, 0x6B, 0x85,
-    0x09, 0xF8, 0x6E, 0x17, 0x35, 0xC1, 0x10, 0x75, 0xF8, 0xAC, 0xF1, 0xE9, 0xC3, 0x21, 0xEC, 0xC3,
-    0x31, 0x1C, 0x02, 0x7C, 0xB0, 0xFC, 0x04, 0xD1, 0x43, 0xF7, 0x03, 0xF9, 0x87, 0x61, 0x46, 0x1D,
-    0xF4, 0x70, 0x1B, 0x51, 0x20, 0x6D, 0xAC, 0x09, 0xAA, 0xDD, 0xE2, 0x85, 0xC3, 0xC3, 0xC3, 0xBF,
-    0xA2, 0xA9, 0xFF, 0x44, 0xF6, 0x8E, 0x09, 0xA9, 0xE9, 0x80, 0x86, 0x42, 0x63, 0x35, 0xD9, 0xE7,
-    0x1F, 0xC1, 0xF2, 0x0E, 0xDF, 0xA8, 0xDD, 0xBB, 0xCE, 0xED, 0xEC, 0xBF, 0xF2, 0xA5, 0x14, 0x10,
-    0x1C, 0xBE, 0x29, 0x05, 0xD4, 0x70, 0x2F, 0x28, 0x80, 0x61, 0x05, 0x0A, 0x48, 0x56, 0x59, 0x03,
-    0x05, 0x84, 0x90, 0x3D, 0x58, 0x84, 0xF6, 0x1F, 0x50, 0x01, 0x39, 0xC4, 0x0B, 0x05, 0x24, 0x2B,
-    0x5B, 0x41, 0x01, 0x90, 0x66, 0x03, 0x05, 0x60, 0x64, 0x45, 0x05, 0xE4, 0xDF, 0xEE, 0xA8, 0x00,
-    0xC8, 0x82, 0x0A, 0x08, 0xD7, 0x69, 0x43, 0x05, 0x1C, 0xC1, 0x91, 0xA8, 0x00, 0x8C, 0x84, 0x02,
-    0x92, 0x55, 0x0C, 0xB7, 0xB4, 0xA0, 0xFB, 0xE8, 0x4B, 0x2B, 0x40, 0x5E, 0xF3, 0x90, 0x9E, 0x0E,
-    0xF1, 0xBC, 0x49, 0xCF, 0x71, 0x55, 0xE6, 0xD6, 0xF6, 0xDA, 0xF0, 0xC0, 0xEC, 0xF5, 0xB4, 0xF2,
-    0x0C, 0x57, 0xDC, 0xEF, 0x61, 0x72, 0xD7, 0xC7, 0x30, 0xD0, 0x67, 0xE6, 0x58, 0xA6, 0x95, 0x14,
-    0x96, 0xE4, 0x67, 0xC3, 0xF9, 0x47, 0x2F, 0x1C, 0x4E, 0x67, 0x04, 0x7E, 0xF1, 0x5B, 0xA7, 0x1E,
-    0x3D, 0x5D, 0x79, 0x92, 0xCE, 0x6B, 0xEA, 0xF9, 0xDE, 0x58, 0xD7, 0xA4, 0x7F, 0xD2, 0x07, 0x1C,
-    0x90, 0x34, 0x8C, 0xF5, 0x54, 0x52, 0xCF, 0xB1, 0x70, 0x1D, 0x28, 0x19, 0xF2, 0x80, 0xCB, 0x63,
-    0x16, 0x04, 0xB3, 0x15, 0x82, 0xC1, 0x95, 0x59, 0x5F, 0x75, 0x0B, 0xF3, 0x8A, 0x56, 0xC7, 0x5A,
-    0xCA, 0x32, 0x1E, 0x07, 0x43, 0xE0, 0x56, 0x60, 0x52, 0x71, 0xB6, 0xF7, 0xFF, 0xAA, 0x70, 0x3D,
-    0x1D, 0x20, 0xDC, 0x55, 0xBB, 0x90, 0xC0, 0xA1, 0x29, 0x2B, 0x8B, 0xFF, 0xF2, 0x2A, 0x2B, 0x82,
-    0x8D, 0xD2, 0x27, 0xBA, 0x3E, 0x7C, 0x36, 0x69, 0x49, 0xEF, 0xC8, 0x18, 0x96, 0x32, 0x9C, 0x61,
-    0x79, 0x46, 0xB6, 0x8A, 0x4B, 0xAF, 0xBD, 0x05, 0x60, 0x62, 0xFC, 0x3B, 0xA6, 0x3D, 0x60, 0x40,
-    0xBA, 0x1D, 0x80, 0xF8, 0x37, 0x30, 0xF9, 0xD8, 0xCA, 0xD4, 0x55, 0x24, 0xE1, 0xDA, 0x26, 0x71,
-    0x45, 0xEC, 0x6E, 0x7C, 0x42, 0x85, 0x0F, 0xB0, 0x83, 0x9F, 0x4E, 0x60, 0x6E, 0xD8, 0x59, 0x04,
-    0x14, 0xF4, 0x9B, 0x98, 0x1E, 0x6D, 0x43, 0x9A, 0x4F, 0x11, 0x0A, 0xE9, 0x89, 0x0F, 0x16, 0x3B,
-    0xAF, 0x1F, 0xBE, 0x85, 0x19, 0xC0, 0x2B, 0xC3, 0x38, 0xE2, 0xC8, 0x7B, 0xB7, 0x60, 0x9F, 0xCD,
-    0x8B, 0x76, 0x73, 0x29, 0xFF, 0xC7, 0xCB, 0xF6, 0x3D, 0x0D, 0x4B, 0x79, 0x89, 0x78, 0x31, 0x07,
-    0xBC, 0x98, 0xE8, 0x7F, 0xEB, 0xB2, 0x93, 0x7D, 0xFC, 0x68, 0x72, 0xE0, 0xEF, 0x3B, 0x70, 0xE7,
-    0x75, 0x80, 0xBC, 0x80, 0xFF, 0x8E, 0xED, 0x60, 0x57, 0xE6, 0x39, 0x08, 0xA8, 0xEC, 0xA6, 0xFE,
-    0xEA, 0xED, 0x4B, 0x39, 0xB8, 0x87, 0x1C, 0xD6, 0xF0, 0x47, 0x7F, 0x0B, 0x75, 0xDF, 0xC2, 0xED,
-    0x8E, 0xAC, 0x36, 0x9E, 0x10, 0x9C, 0xE3, 0x15, 0x4C, 0xF2, 0x76, 0x17, 0x3C, 0xAA, 0xE2, 0xFF,
-    0x30, 0xD9, 0xDA, 0xFC, 0x6D, 0x1B, 0xBD, 0xDF, 0xE4, 0xE9, 0x8F, 0xBB, 0xCC, 0x15, 0xBB, 0x77,
-    0x8D, 0xA1, 0xEE, 0x7A, 0xCC, 0x61, 0xE1, 0x64, 0x71, 0x9B, 0xFA, 0xC0, 0x90, 0x21, 0x23, 0x45,
-    0x6B, 0x68, 0xA5, 0xA6, 0xDE, 0xF0, 0xC5, 0x36, 0xB6, 0xC9, 0x1B, 0x5B, 0x65, 0xF8, 0xA4, 0xFA,
-    0xE4, 0x55, 0xBC, 0xCA, 0x2A, 0x73, 0x3D, 0x80, 0xCC, 0x77, 0x2B, 0xDA, 0x87, 0x85, 0xC1, 0x75,
-    0xB4, 0x98, 0x64, 0x95, 0x7E, 0x5C, 0x60, 0x8E, 0x34, 0xA3, 0x1E, 0x40, 0x24, 0x35, 0xBB, 0xA7,
-    0x5C, 0xB3, 0x87, 0x35, 0x18, 0x3D, 0xA8, 0xB4, 0x07, 0x52, 0xD2, 0xA0, 0xE0, 0xDE, 0x43, 0x81,
-    0x08, 0x6A, 0x18, 0x3F, 0x04, 0xF0, 0xDD, 0xB8, 0x0F, 0xBB, 0xBC, 0xC8, 0xF0, 0xFD, 0x8E, 0xD9,
-    0xEB, 0x82, 0xEB, 0x83, 0xF9, 0x79, 0x87, 0x6C, 0x17, 0x7D, 0xD0, 0x22, 0xE0, 0x24, 0x0F, 0x01,
-    0x61, 0xAA, 0x2C, 0x22, 0x6A, 0x41, 0xB0, 0xC0, 0xF8, 0x93, 0x9B, 0x3F, 0x0A, 0xFA, 0x90, 0x5A,
-    0x65, 0x90, 0xED, 0x39, 0x79, 0x46, 0xDF, 0x86, 0x24, 0x98, 0xCF, 0x72, 0xEF, 0xC9, 0x0B, 0x9D,
-    0xB0, 0x2C, 0x8C, 0xF4, 0x84, 0x9A, 0x69, 0x4D, 0xDB, 0xF1, 0x94, 0x9A, 0x97, 0x3A, 0x7A, 0x0D,
-    0x41, 0xD1, 0x9A, 0x79, 0x16, 0x37, 0x0B, 0xAD, 0x49, 0xA3, 0x4C, 0x39, 0x68, 0xBE, 0x14, 0xEC,
-    0x97, 0x2D, 0xA9, 0x2D, 0x5D, 0x93, 0x15, 0x47, 0xC9, 0x0F, 0xC7, 0xB0, 0xCB, 0xAA, 0xCB, 0x51,
-    0xAB, 0xAC, 0xBC, 0x47, 0x7A, 0x19, 0x18, 0x49, 0xC1, 0x20, 0x86, 0x71, 0x37, 0xC8, 0x06, 0xAD,
-    0x50, 0x09, 0xF3, 0xC3, 0x91, 0x6C, 0xD6, 0xCA, 0xDD, 0x53, 0x3A, 0x09, 0x5F, 0xE4, 0x22, 0x08,
-    0x31, 0x77, 0x14, 0x35, 0x69, 0xD6, 0xFB, 0xFB, 0xD7, 0x67, 0xC7, 0x22, 0xBD, 0x20, 0x03, 0x2B,
-    0x32, 0x49, 0xAF, 0x61, 0xEA, 0x5C, 0xCB, 0x7B, 0x2B, 0x44, 0x19, 0x7A, 0x8A, 0xA1, 0x11, 0x3A,
-    0x17, 0x7C, 0x1D, 0x01, 0x08, 0x73, 0x26, 0x93, 0x4F, 0x9E, 0xA5, 0xC8, 0x30, 0x7B, 0xDE, 0x2F,
-    0x7A, 0xC6, 0x55, 0x02, 0x89, 0x22, 0xFB, 0x7B, 0x93, 0x5F, 0xEB, 0x8D, 0xB3, 0x7F, 0x31, 0xA4,
-    0x4D, 0xDA, 0xC3, 0xB5, 0x07, 0xF3, 0x68, 0xF5, 0xDC, 0x5D, 0x24, 0xE5, 0x9F, 0x0A, 0x0D, 0x3C,
-    0xB8, 0xC5, 0xA0, 0x13, 0x7F, 0x4F, 0x6B, 0x5D, 0x85, 0x79, 0x20, 0x28, 0xAF, 0x80, 0x08, 0xB2,
-    0xCA, 0xBE, 0x7A, 0x82, 0x85, 0x02, 0x46, 0x77, 0x28, 0x0C, 0x54, 0x7B, 0x45, 0x6A, 0x21, 0xE9,
-    0xC6, 0x03, 0x46, 0xE2, 0x06, 0x72, 0x52, 0x78, 0xAC, 0x86, 0x30, 0xC5, 0xB4, 0x4E, 0xC0, 0xF8,
-    0xEC, 0x16, 0xE7, 0xED, 0xF8, 0x94, 0x42, 0x8E, 0xC0, 0x01, 0x6C, 0xCE, 0xE4, 0x2B, 0x03, 0x70,
-    0x09, 0x54, 0xE0, 0xD5, 0xD5, 0x98, 0x70, 0xF0, 0xAE, 0x5E, 0x7B, 0x5C, 0xB7, 0x20, 0xCE, 0xB2,
-    0xDA, 0x6D, 0xDC, 0x47, 0xEE, 0x1A, 0xC9, 0xA8, 0xA7, 0x25, 0x58, 0xFB, 0x08, 0x69, 0xAB, 0x0D,
-    0x14, 0xF4, 0x41, 0xC0, 0x78, 0xE0, 0xE6, 0x23, 0xFB, 0x16, 0x29, 0xCC, 0x01, 0x5E, 0xC1, 0xA2,
-    0x64, 0x34, 0x89, 0x9C, 0x00, 0xA1, 0xC0, 0xE1, 0xA4, 0x2C, 0xF7, 0x6F, 0x94, 0x9E, 0xA5, 0x74,
-    0xC3, 0xC1, 0x0A, 0x8C, 0x70, 0xAA, 0x9A, 0x04, 0x2B, 0x81, 0x22, 0xF4, 0x40, 0x95, 0x20, 0x7C,
-    0x24, 0x69, 0x24, 0xB0, 0xA4, 0xBA, 0xA3, 0x71, 0xFF, 0xA0, 0xA1, 0x2E, 0x9D, 0x30, 0xE4, 0x60,
-    0x92, 0xCF, 0x0E, 0xDF, 0xE9, 0xA8, 0xF5, 0x74, 0x45, 0x86, 0x6C, 0x41, 0x78, 0x73, 0xEC, 0x99,
-    0x62, 0xE0, 0x8A, 0x3B, 0x4B, 0xE3, 0xFD, 0x2E, 0x97, 0x2E, 0xD3, 0x6E, 0x21, 0x39, 0x78, 0x5B,
-    0x08, 0x6D, 0xD8, 0xD2, 0xE9, 0xD1, 0xAA, 0x3D, 0xC5, 0xCF, 0xF5, 0x73, 0xFC, 0x48, 0x62, 0x33,
-    0x88, 0x32, 0xE9, 0xB0, 0xE5, 0xC8, 0x1E, 0x09, 0xE8, 0x09, 0xE9, 0x0D, 0x77, 0xCC, 0xC2, 0x52,
-    0xB4, 0xB6, 0x9A, 0x5D, 0xEC, 0x35, 0xD6, 0xCC, 0x3C, 0x81, 0x11, 0x5E, 0x27, 0x06, 0x57, 0xF0,
-    0x47, 0xBB, 0x13, 0x53, 0xD0, 0x38, 0x4C, 0x31, 0xD5, 0x35, 0xFF, 0xE8, 0xF0, 0x5E, 0xE3, 0xB9,
-    0x22, 0x2B, 0xB8, 0x8E, 0xB4, 0xF6, 0x50, 0x36, 0xEF, 0xD9, 0x22, 0x2F, 0x71, 0x97, 0xAD, 0x16,
-    0x16, 0x3D, 0xDA, 0x7C, 0x5D, 0x84, 0x3A, 0x85, 0x6D, 0x1A, 0xB6, 0x49, 0x7F, 0x22, 0x41, 0xCB,
-    0xD9, 0x7A, 0x55, 0x03, 0xD7, 0x65, 0x3E, 0x4F, 0x16, 0x5F, 0xBB, 0x45, 0x88, 0xA9, 0xD3, 0x31,
-    0x64, 0xB5, 0xE1, 0x3E, 0xA3, 0x91, 0xFC, 0x90, 0x78, 0x22, 0x6C, 0x13, 0xEA, 0xEA, 0xB2, 0x31,
-    0x17, 0xEB, 0x2A, 0x70, 0x5E, 0x1E, 0xBE, 0x84, 0x59, 0x6F, 0x99, 0xCA, 0xFE, 0x92, 0x22, 0x4A,
-    0xBF, 0xDF, 0x8A, 0x93, 0x61, 0xC3, 0x55, 0x38, 0x28, 0xFB, 0x0D, 0x5A, 0xF5, 0x58, 0x78, 0xD3,
-    0xB3, 0x65, 0x2B, 0x26, 0xBC, 0xAC, 0x91, 0xAB, 0x7C, 0xBA, 0x0F, 0xE2, 0x3D, 0x5F, 0x4C, 0x7B,
-    0x88, 0xA4, 0xD3, 0xE1, 0xA1, 0x92, 0x2D, 0xDF, 0xF5, 0x8C, 0xE1, 0x06, 0xEF, 0xD2, 0xA3, 0x94,
-    0xBE, 0x31, 0xD4, 0x73, 0xC6, 0xFA, 0x07, 0x20, 0x72, 0x58, 0x8C, 0x6D, 0x47, 0xD4, 0xE7, 0x85,
-    0x1E, 0x5C, 0xF3, 0x8F, 0x7B, 0x81, 0xF0, 0x0B, 0xB8, 0x7A, 0x32, 0x8C, 0xF0, 0x77, 0x44, 0x9B,
-    0x50, 0xDF, 0x09, 0x29, 0x51, 0x0A, 0x36, 0xA9, 0x11, 0xEE, 0x8F, 0x29, 0xDF, 0x63, 0x11, 0x5B,
-    0x0B, 0xEA, 0x7E, 0x8E, 0xCD, 0x7A, 0xCB, 0xA0, 0xED, 0xA4, 0x44, 0xBE, 0xC7, 0x0C, 0x38, 0xF3,
-    0x17, 0xFD, 0xA7, 0xEA, 0xA0, 0x87, 0xFC, 0x71, 0x54, 0x32, 0x11, 0x7B, 0x96, 0xAE, 0xED, 0xBD,
-    0x1E, 0xC2, 0x5E, 0xCD, 0xDC, 0x79, 0x44, 0x64, 0xDF, 0x7B, 0x75, 0x50, 0x21, 0xD7, 0xCD, 0xCC,
-    0xD5, 0x87, 0x87, 0xB5, 0x90, 0xCD, 0x48, 0x1D, 0xE1, 0x46, 0xBC, 0x31, 0x14, 0xCC, 0xF2, 0xA1,
-    0x86, 0x82, 0xC1, 0xB3, 0xE6, 0x36, 0x65, 0x30, 0x07, 0x7B, 0x71, 0x2F, 0x55, 0x6B, 0xB9, 0xDC,
-    0x8C, 0x3E, 0x3A, 0x22, 0xA8, 0x58, 0x1F, 0x09, 0xE3, 0xCE, 0x47, 0x4A, 0xC4, 0xAF, 0xDA, 0xDF,
-    0xE4, 0xCD, 0xE4, 0x6F, 0xCA, 0x62, 0x5C, 0xD0, 0xDD, 0x30, 0x6B, 0x35, 0xF0, 0x37, 0xF1, 0x3A,
-    0x1C, 0xF7, 0xF7, 0x39, 0xA8, 0x8B, 0xE6, 0xB2, 0xB2, 0x99, 0x6F, 0x6C, 0x15, 0x9F, 0xE8, 0x27,
-    0xB7, 0x7F, 0xA3, 0xF3, 0xD6, 0xED, 0x7C, 0xC9, 0x16, 0x2D, 0x37, 0x88, 0x86, 0xF7, 0x24, 0x54,
-    0xD0, 0x3D, 0x07, 0xB4, 0x6A, 0xAE, 0xE8, 0xEB, 0x19, 0xCD, 0x05, 0xE3, 0x5C, 0x88, 0x2B, 0x0D,
-    0x14, 0x73, 0xFC, 0x53, 0x1D, 0xCB, 0x14, 0x50, 0x53, 0x44, 0x54, 0xA5, 0x64, 0xB5, 0xFC, 0x1D,
-    0x70, 0xFA, 0x92, 0x45, 0xA2, 0x25, 0xB7, 0xD0, 0xED, 0x6E, 0x15, 0x79, 0x58, 0xCF, 0x39, 0x59,
-    0x87, 0xCC, 0xC1, 0x94, 0xE8, 0xDF, 0x28, 0xCE, 0xFA, 0x56, 0x80, 0x16, 0xF7, 0x3F, 0xD9, 0x53,
-    0x60, 0x72, 0xDB, 0x09, 0xD0, 0x80, 0xF9, 0x69, 0xB5, 0x79, 0x37, 0x17, 0x17, 0xF2, 0xDE, 0x64,
-    0x64, 0xAE, 0xB3, 0x13, 0xBB, 0x15, 0x35, 0x55, 0x07, 0xB6, 0xFF, 0x05, 0xCF, 0xFF, 0x46, 0x2B,
-    0x6D, 0xDA, 0x12, 0xE6, 0x79, 0xDF, 0x85, 0xD0, 0x83, 0x6E, 0xC9, 0x53, 0x3E, 0x08, 0x5A, 0x8F,
-    0x55, 0x9F, 0xAB, 0x96, 0xF2, 0x57, 0x38, 0xD6, 0x97, 0xEA, 0x5A, 0xEE, 0xAA, 0x2F, 0x7B, 0x4F,
-    0x27, 0x2F, 0xE7, 0x26, 0x6A, 0x7B, 0xF2, 0xE5, 0x96, 0x84, 0x29, 0xF9, 0x89, 0x74, 0xBB, 0xC9,
-    0x83, 0xF5, 0x8C, 0xD1, 0x67, 0x76, 0xA7, 0xFD, 0xFD, 0x82, 0x6A, 0xA9, 0x42, 0x16, 0x10, 0x11,
-    0xF5, 0x25, 0xDE, 0xE4, 0x18, 0x5A, 0x55, 0xB8, 0x59, 0x44, 0xC8, 0xA2, 0xFC, 0xC4, 0xDB, 0xD9,
-    0x81, 0xB6, 0x78, 0x59, 0x53, 0xDA, 0x5E, 0xC9, 0x6F, 0x71, 0x78, 0x6F, 0x7C, 0x86, 0xF6, 0x6F,
-    0xDD, 0xD9, 0x00, 0xF4, 0xE2, 0x2B, 0x49, 0xF3, 0xA1, 0x8C, 0x93, 0x0D, 0x07, 0x8A, 0x3F, 0xFB,
-    0xC1, 0x8A, 0xFE, 0xD4, 0x91, 0xE4, 0x9E, 0x24, 0x5F, 0xFE, 0x0A, 0xD2, 0xAC, 0x70, 0xAB, 0x08,
-    0x62, 0x03, 0x5D, 0xFA, 0x73, 0x06, 0xF1, 0x95, 0x22, 0x37, 0x7C, 0xCB, 0x08, 0xD4, 0x09, 0x85,
-    0x29, 0xB4, 0xE3, 0x2D, 0x45, 0xD6, 0xAD, 0x41, 0xA4, 0x70, 0xD4, 0x0C, 0x9F, 0x5D, 0x77, 0x77,
-    0xDB, 0x3B, 0x1C, 0xFC, 0x38, 0x7A, 0x0C, 0x09, 0xD0, 0xA7, 0xF3, 0x24, 0x90, 0x02, 0x12, 0x20,
-    0xB0, 0xDF, 0xF8, 0xD5, 0xD5, 0x18, 0x2B, 0xFC, 0x12, 0xE5, 0xBC, 0xDC, 0x3C, 0xD5, 0xEE, 0xC4,
-    0x88, 0xC0, 0xEA, 0x51, 0xCE, 0xF5, 0x42, 0x35, 0x3B, 0xF4, 0x34, 0x3B, 0x32, 0x21, 0xB9, 0x3C,
-    0xEC, 0x8C, 0x14, 0xE9, 0xBF, 0x24, 0xCA, 0x1C, 0x9C, 0xCC, 0xEF, 0x8A, 0xE7, 0x61, 0x66, 0x59,
-    0x9E, 0xCC, 0x05, 0x25, 0x1D, 0xBB, 0x08, 0xE7, 0xF8, 0x73, 0xEF, 0x0D, 0xB3, 0x64, 0x2E, 0x78,
-    0xAF, 0x9D, 0x59, 0x3D, 0x68, 0x3D, 0x81, 0x89, 0x93, 0x1E, 0x9E, 0x86, 0x14, 0x12, 0xA6, 0x2E,
-    0x96, 0x29, 0xA8, 0x7A, 0x93, 0xD6, 0x82, 0xC6, 0x68, 0x15, 0x9C, 0xB6, 0x47, 0x04, 0x52, 0x86,
-    0x97, 0xC6, 0x3C, 0x3F, 0x15, 0x33, 0x2B, 0x85, 0x97, 0x08, 0xE7, 0x17, 0x75, 0xE3, 0x17, 0x3E,
-    0x9C, 0x69, 0x4B, 0x2E, 0x7C, 0xD8, 0xCE, 0x4E, 0x3C, 0xB2, 0x07, 0x5B, 0x31, 0xCF, 0xA2, 0x00,
-    0x11, 0x4E, 0x63, 0xBD, 0x38, 0x00, 0xE3, 0x97, 0x18, 0x94, 0x55, 0x48, 0x8C, 0xC5, 0x39, 0xBB,
-    0xA3, 0x22, 0xF9, 0xBE, 0x64, 0x16, 0x5D, 0x38, 0xF3, 0xFA, 0x8B, 0x1E, 0x0E, 0xB3, 0xE2, 0xF2,
-    0x0B, 0x1F, 0x56, 0x5E, 0x5C, 0x7C, 0x48, 0x75, 0x52, 0x31, 0x5E, 0x5A, 0x89, 0xFB, 0x77, 0x6F,
-    0x75, 0xAB, 0x39, 0xC9, 0xC4, 0x5D, 0x50, 0xB7, 0x1C, 0x50, 0x0A, 0x05, 0xD8, 0x86, 0x56, 0x53,
-    0x17, 0x5C, 0x6B, 0xA2, 0xB1, 0x47, 0x3D, 0x09, 0x4B, 0x3A, 0x6A, 0x29, 0x17, 0xCC, 0xA8, 0x7F,
-    0x63, 0x3A, 0xAC, 0xA2, 0x51, 0xFE, 0xF2, 0x33, 0x5A, 0xAE, 0xAD, 0xC8, 0xFB, 0xC8, 0x81, 0x49,
-    0xC7, 0x81, 0xB6, 0x81, 0xBE, 0xC2, 0x91, 0xAB, 0xA7, 0x82, 0xFC, 0xAE, 0x00, 0x55, 0x69, 0x1F,
-    0x32, 0x53, 0x03, 0x6E, 0x05, 0xB5, 0x6C, 0x1E, 0x71, 0xC4, 0x93, 0xE0, 0xDC, 0x9B, 0x5E, 0x20,
-    0xCF, 0x9A, 0xAF, 0x99, 0x05, 0x0D, 0x46, 0x6E, 0x22, 0xA8, 0xBD, 0x9A, 0xAB, 0x9A, 0xAB, 0xF2,
-    0xF6, 0x42, 0x38, 0x48, 0xD6, 0x51, 0x3F, 0x3A, 0x89, 0x29, 0x23, 0x84, 0x6B, 0x42, 0x86, 0x26,
-    0xD4, 0xE2, 0x23, 0x25, 0x16, 0x3D, 0x6A, 0xA9, 0x33, 0xCB, 0xEA, 0xAF, 0x88, 0x3F, 0x50, 0x43,
-    0xE7, 0x08, 0x34, 0x96, 0xAA, 0x4B, 0xA0, 0x9C, 0x01, 0x33, 0x00, 0xC7, 0x35, 0x7C, 0x10, 0x10,
-    0x62, 0x10, 0x33, 0xE5, 0xA8, 0xDE, 0x79, 0xCB, 0x91, 0x78, 0x8E, 0x91, 0x1D, 0xE2, 0xDC, 0xDA,
-    0xB0, 0x07, 0x48, 0xE3, 0x32, 0xF9, 0x1F, 0x76, 0x6A, 0x14, 0x1D, 0xAB, 0x20, 0x7D, 0x7F, 0x45,
-    0xD7, 0x3B, 0xF6, 0x68, 0xCB, 0x71, 0xA4, 0xB1, 0xEC, 0x1F, 0x92, 0x5B, 0x4A, 0x25, 0x5D, 0x6F,
-    0x5A, 0xFD, 0xC6, 0xBC, 0x65, 0x36, 0x11, 0x64, 0x2E, 0xB8, 0x7C, 0x7F, 0xDD, 0xC3, 0x90, 0xA8,
-    0xBD, 0xB8, 0xE2, 0x52, 0x62, 0x14, 0x5A, 0xF0, 0x40, 0x0E, 0xAC, 0x02, 0x42, 0xA1, 0x04, 0x03,
-    0x4C, 0x76, 0xCC, 0xAD, 0x74, 0x1C, 0xE8, 0x80, 0x46, 0x34, 0xA9, 0xEE, 0x71, 0xF2, 0x97, 0x5A,
-    0xF1, 0xA6, 0x56, 0xC0, 0xA9, 0x95, 0x86, 0x9D, 0xAE, 0x93, 0xC2, 0x9A, 0xAE, 0xC1, 0xC8, 0x4C,
-    0x1D, 0x0E, 0xBC, 0x7A, 0x88, 0x13, 0xF7, 0x7C, 0x27, 0xF5, 0x05, 0x56, 0xCB, 0x8C, 0x5D, 0x12,
-    0xE3, 0x22, 0xF0, 0x23, 0x65, 0xA3, 0x4E, 0x8E, 0x50, 0x46, 0xF6, 0xCA, 0xD9, 0xF8, 0xE9, 0x79,
-    0x0F, 0x9B, 0xAE, 0xCC, 0x94, 0x3E, 0x77, 0x57, 0x09, 0xBF, 0xD9, 0xC4, 0x4A, 0x0F, 0x7F, 0x3C,
-    0x7E, 0x54, 0x2B, 0x58, 0x25, 0xEC, 0x93, 0xC9, 0xDD, 0xEE, 0x1B, 0xE2, 0x42, 0x09, 0xDA, 0x7A,
-    0x6C, 0x28, 0xD8, 0xDA, 0xB1, 0x7F, 0x91, 0x56, 0xEC, 0x88, 0xEC, 0xA8, 0x7E, 0x7F, 0x22, 0xB9,
-    0x7B, 0xCD, 0xFC, 0x1A, 0xDD, 0xAE, 0xB8, 0xBF, 0x94, 0x62, 0xE9, 0xCB, 0x4C, 0x01, 0x5F, 0x17,
-    0x14, 0xBC, 0x64, 0x9E, 0x58, 0xAD, 0x5D, 0x57, 0xAB, 0x7F, 0x4D, 0xED, 0x44, 0x3D, 0xE3, 0x58,
-    0xA8, 0xA0, 0x64, 0x4E, 0xF5, 0x62, 0x9F, 0x4C, 0x5F, 0x03, 0x46, 0x8E, 0x7E, 0xC0, 0x2E, 0x31,
-    0x0A, 0x9E, 0x3E, 0xE9, 0x40, 0x50, 0x8D, 0x4F, 0xF2, 0x0B, 0xBE, 0xDF, 0x7B, 0x3B, 0x65, 0x7F,
-    0x26, 0x42, 0xAE, 0x8C, 0x7A, 0x77, 0xE6, 0x1D, 0x16, 0x5A, 0x47, 0xBF, 0x6C, 0x14, 0x6F, 0xCF,
-    0xFC, 0x45, 0xA0, 0xA9, 0x9E, 0x5E, 0xEA, 0x99, 0x31, 0x3F, 0x53, 0x7A, 0x62, 0x92, 0x9A, 0x08,
-    0xD6, 0x59, 0xB9, 0x01, 0xE3, 0xF0, 0xDA, 0x51, 0x04, 0xF5, 0xC8, 0x30, 0x56, 0xDA, 0x0A, 0x7E,
-    0x6E, 0x7F, 0xB3, 0x03, 0x1F, 0xF6, 0xF7, 0x07, 0xC8, 0x00, 0x0F, 0x20, 0x95, 0xBC, 0xC9, 0x1F,
-    0xF6, 0x2A, 0x8E, 0x47, 0x84, 0xD0, 0xA8, 0xB7, 0x05, 0x84, 0x34, 0xA5, 0x2B, 0x5C, 0xCB, 0x97,
-    0x3B, 0xBE, 0xF0, 0xDD, 0x01, 0x61, 0x15, 0x9C, 0x7F, 0x63, 0x0D, 0x29, 0xA4, 0x1F, 0xB0, 0xDD,
-    0x18, 0x81, 0xD7, 0x00, 0x79, 0x87, 0x6B, 0xB0, 0x08, 0x86, 0x18, 0x42, 0xFE, 0xAB, 0x8C, 0x9B,
-    0xEE, 0xF1, 0xAA, 0xAC, 0x51, 0x27, 0x94, 0x43, 0x3A, 0xF7, 0x6E, 0x97, 0xF2, 0xF9, 0xCD, 0x6D,
-    0x11, 0x3D, 0xD7, 0x5E, 0x77, 0xCC, 0xA6, 0x70, 0x98, 0xC3, 0xEB, 0x79, 0xDF, 0xB4, 0x7A, 0xAB,
-    0x54, 0x40, 0x3E, 0x56, 0x0E, 0x99, 0x34, 0x9A, 0x09, 0x6D, 0xF0, 0x78, 0x8A, 0xD7, 0x68, 0xED,
-    0x71, 0x95, 0xAF, 0x8D, 0x7D, 0xA2, 0xF3, 0xC8, 0x8A, 0xEA, 0x17, 0x4F, 0x58, 0x60, 0x6E, 0x06,
-    0x08, 0x61, 0x29, 0x0D, 0x56, 0x1E, 0x65, 0x51, 0xC1, 0xD6, 0x9C, 0xAE, 0xCD, 0x79, 0x1D, 0x09,
-    0xA6, 0x42, 0x6D, 0x59, 0x02, 0x5E, 0x65, 0x90, 0x07, 0x2B, 0xD8, 0x77, 0x7C, 0xE7, 0x61, 0x52,
-    0xFD, 0x49, 0x3B, 0x0C, 0x96, 0x5D, 0xA2, 0x17, 0xAA, 0x4D, 0xE1, 0x34, 0x77, 0x0A, 0xBA, 0x2D,
-    0x5F, 0x76, 0xD3, 0x3D, 0x7C, 0x32, 0xB9, 0x9B, 0xBB, 0x90, 0x4A, 0x7E, 0x42, 0xED, 0xD1, 0x89,
-    0xDF, 0xD1, 0xBC, 0x2D, 0x36, 0x72, 0x31, 0xB7, 0xF3, 0xA4, 0x72, 0x57, 0x90, 0xF2, 0xB8, 0x65,
-    0x92, 0x00, 0x38, 0xE5, 0x75, 0x45, 0xE2, 0x83, 0x8B, 0xEA, 0x90, 0x27, 0x89, 0xAF, 0x17, 0x8A,
-    0xD9, 0x22, 0x65, 0x90, 0xF1, 0x66, 0x0F, 0x6E, 0xEF, 0x73, 0xC6, 0x78, 0x87, 0xB4, 0x5B, 0xC6,
-    0x5F, 0x2C, 0x93, 0x74, 0xA0, 0x21, 0x5B, 0x29, 0x52, 0xE0, 0xFD, 0x9A, 0xC8, 0x6B, 0x64, 0xE7,
-    0x89, 0x1D, 0x71, 0x10, 0x1F, 0x11, 0x44, 0x46, 0x8C, 0x27, 0x21, 0x22, 0x9B, 0x09, 0x64, 0x0A,
-    0x6E, 0xBD, 0x98, 0x46, 0xDD, 0x2C, 0xCD, 0x85, 0x8B, 0x0A, 0xB2, 0x61, 0x81, 0x1C, 0x42, 0xEA,
-    0x8A, 0xD1, 0x82, 0xC6, 0xDE, 0x5B, 0xB4, 0xE1, 0xAE, 0x82, 0x23, 0xDB, 0x16, 0x63, 0xBE, 0x0E,
-    0x1B, 0x05, 0x8B, 0x1B, 0x5F, 0x87, 0xD5, 0x8C, 0xF5, 0x13, 0xF9, 0x1A, 0x39, 0x1B, 0x3B, 0x80,
-    0x9C, 0x74, 0xD4, 0xF6, 0x1C, 0xE6, 0x0B, 0x79, 0x01, 0x34, 0x66, 0xFC, 0x22, 0x36, 0x6C, 0x93,
-    0xCF, 0x10, 0x9E, 0x52, 0x75, 0xF8, 0x1D, 0xCA, 0xB2, 0xF3, 0x55, 0xDE, 0xD9, 0x1A, 0x52, 0xFD,
-    0xDC, 0xBB, 0x7E, 0xEF, 0xB4, 0x35, 0xF3, 0xBA, 0x58, 0x31, 0x14, 0x8E, 0x16, 0x72, 0x07, 0xF3,
-    0xC7, 0x42, 0x4D, 0x04, 0xB8, 0xA5, 0x38, 0xC2, 0x5D, 0x59, 0xA9, 0xAD, 0xE5, 0x35, 0xDB, 0xAB,
-    0x9D, 0xA9, 0x63, 0x0D, 0x8D, 0x94, 0xD0, 0xFB, 0x0D, 0xD0, 0x6B, 0x7E, 0xF7, 0x53, 0x5C, 0x96,
-    0xDC, 0x45, 0x80, 0xC0, 0xD5, 0xD2, 0x39, 0x56, 0x46, 0x60, 0x07, 0xB3, 0x95, 0x9C, 0x9C, 0x04,
-    0x40, 0x6E, 0xE6, 0xED, 0x95, 0x8A, 0x5F, 0x28, 0x2D, 0x6E, 0x3A, 0x3E, 0xC5, 0x66, 0x4F, 0xDC,
-    0x9D, 0xDC, 0xC0, 0x0A, 0xC7, 0x29, 0xC3, 0x6E, 0xBA, 0x2A, 0x89, 0xC5, 0x07, 0xED, 0xF4, 0xFA,
-    0x26, 0xD4, 0x1C, 0x6E, 0x7D, 0x83, 0xCC, 0x63, 0xBC, 0xB9, 0xB7, 0xA3, 0xD6, 0x9E, 0xA9, 0xD5,
-    0x89, 0x49, 0x4E, 0x16, 0xA6, 0x37, 0x2D, 0x22, 0x89, 0x45, 0xF4, 0x0A, 0xF1, 0x6A, 0x83, 0x7C,
-    0x0B, 0xEF, 0xAF, 0xA8, 0x62, 0x6B, 0xF7, 0x58, 0xB8, 0x1C, 0x99, 0xF2, 0xC3, 0xA3, 0x21, 0x70,
-    0x26, 0x63, 0x6F, 0x35, 0xED, 0x61, 0x98, 0xF1, 0x3A, 0x6D, 0x7D, 0x77, 0x32, 0xEE, 0x20, 0xE4,
-    0x84, 0xA6, 0x92, 0xB6, 0xEA, 0x67, 0xE2, 0x92, 0xB1, 0x4A, 0xB1, 0xBC, 0x94, 0x95, 0x65, 0xCB,
-    0xDC, 0x32, 0x87, 0x70, 0x5B, 0xD4, 0x64, 0x9F, 0xD6, 0x96, 0x55, 0xD7, 0x1E, 0x4A, 0x34, 0x6E,
-    0xCD, 0x3C, 0x73, 0x0A, 0xD6, 0xA9, 0xD5, 0x25, 0x46, 0x8E, 0x17, 0xEB, 0xD1, 0x8E, 0xFD, 0x16,
-    0x24, 0x3C, 0x5E, 0xAA, 0xD8, 0x09, 0xF0, 0xCD, 0xD2, 0x4C, 0x9E, 0x87, 0xE8, 0x11, 0xF4, 0xDA,
-    0xFB, 0xE2, 0x5E, 0xF5, 0xB6, 0x44, 0x78, 0xBC, 0x54, 0x3D, 0x8B, 0xFF, 0x02, 0x7E, 0x8F, 0xDC,
-    0x08, 0x5C, 0xF0, 0x8F, 0x6C, 0x2E, 0x16, 0x76, 0x75, 0x3A, 0x36, 0x3F, 0x5E, 0x82, 0x74, 0x8E,
-    0x65, 0xA0, 0x48, 0x06, 0xC6, 0xBD, 0x9E, 0x3A, 0xBB, 0x7C, 0x16, 0xD8, 0x3D, 0x5E, 0x82, 0x82,
-    0xBB, 0x4B, 0xE7, 0x7E, 0xEF, 0x00, 0x97, 0xDF, 0x4B, 0x60, 0x52, 0xDF, 0x89, 0x71, 0xB9, 0x95,
-    0xB0, 0xDF, 0x52, 0x6F, 0xBA, 0xFB, 0xC5, 0xFF, 0x0F, 0x7D, 0x58, 0x6D, 0xE7, 0x3A, 0x74, 0xD8,
-    0xA1, 0xB2, 0xC6, 0xAB, 0x2E, 0x2B, 0x81, 0xE6, 0xDC, 0xB7, 0x7F, 0xE6, 0xFE, 0x7C, 0xC2, 0xB2,
-    0xD6, 0x21, 0x6C, 0x39, 0xC0, 0x3E, 0xDF, 0xE4, 0xC6, 0x1B, 0x03, 0x71, 0x5D, 0x63, 0x46, 0xAC,
-    0x8F, 0x38, 0xED, 0x20, 0xE4, 0xF8, 0xD3, 0x03, 0x87, 0xC0, 0x1A, 0x32, 0x25, 0x8C, 0x44, 0xCA,
-    0x6B, 0x45, 0x8F, 0x3F, 0x95, 0x43, 0x13, 0xC1, 0x32, 0x2C, 0xFA, 0x76, 0x44, 0xE2, 0x3B, 0x2D,
-    0xEA, 0x16, 0xA6, 0x5D, 0x02, 0x74, 0xF7, 0xB5, 0x60, 0xBA, 0xF9, 0xBE, 0xFB, 0xB0, 0x2E, 0xAC,
-    0x7B, 0xF7, 0x67, 0x00, 0xB5, 0x91, 0xAB, 0xD6, 0x25, 0x22, 0xE6, 0xCE, 0x72, 0x9C, 0xED, 0xCA,
-    0x75, 0x86, 0xC5, 0x26, 0x70, 0x24, 0xEB, 0xCF, 0xEE, 0x6B, 0xA3, 0xC7, 0xCD, 0x71, 0x9E, 0xEE,
-    0xB9, 0x74, 0x62, 0xCE, 0xF4, 0x4B, 0xD2, 0x65, 0x8B, 0x62, 0x9C, 0x8B, 0xCF, 0x44, 0xE9, 0xE2,
-    0xBD, 0x23, 0xA3, 0xC8, 0xC5, 0x93, 0x2F, 0xD1, 0x8F, 0xB8, 0xAB, 0x34, 0x67, 0x08, 0x85, 0xE6,
-    0x7E, 0x4E, 0x55, 0x4C, 0x49, 0x78, 0x21, 0xD0, 0x9E, 0xA8, 0xBA, 0xB2, 0xCA, 0xD1, 0xCB, 0xBB,
-    0x2C, 0x5A, 0x83, 0xD3, 0xFD, 0xAE, 0x2B, 0x82, 0xC8, 0xEC, 0x9F, 0x74, 0x81, 0xFB, 0xE6, 0xC8,
-    0x13, 0x07, 0x15, 0x8F, 0x0A, 0xF1, 0x20, 0x80, 0x2D, 0x02, 0x40, 0xE0, 0x70, 0x4A, 0x3E, 0xBD,
-    0x37, 0x45, 0x4C, 0x07, 0x6C, 0x69, 0xDB, 0x57, 0xCE, 0x53, 0xE8, 0x7B, 0x6A, 0x4F, 0x81, 0xC2,
-    0x9A, 0x14, 0x36, 0xA2, 0x70, 0x3E, 0xCE, 0xA7, 0x86, 0x5B, 0x7F, 0xBA, 0xE1, 0xD6, 0x9E, 0x23,
-    0x40, 0x14, 0xB0, 0x2F, 0xC2, 0xAD, 0xEF, 0x78, 0xBC, 0xA9, 0x43, 0x0F, 0x95, 0xAD, 0xC2, 0x3E,
-    0xE6, 0x8E, 0xE9, 0x48, 0x6B, 0x01, 0x0D, 0xE1, 0xF8, 0xBB, 0x30, 0x07, 0xC9, 0x18, 0x02, 0x26,
-    0x11, 0x22, 0xC0, 0x2E, 0x29, 0x91, 0x73, 0x23, 0xDD, 0x84, 0x26, 0x1D, 0x6F, 0x74, 0x4C, 0x42,
-    0xC6, 0x93, 0xA1, 0xF2, 0xE2, 0xE9, 0x37, 0x7C, 0x57, 0x2D, 0xE6, 0xB9, 0x96, 0xFF, 0x82, 0x15,
-    0xB6, 0x16, 0xF1, 0x10, 0x7E, 0xB6, 0xE9, 0xAA, 0xFD, 0xDF, 0x8A, 0x61, 0xDB, 0x3C, 0x83, 0x1B,
-    0x54, 0xB7, 0xCF, 0x35, 0xCF, 0xF6, 0xFD, 0xD9, 0x4A, 0x54, 0x27, 0x0D, 0xF9, 0x87, 0xB8, 0x26,
-    0x9E, 0x7E, 0xF9, 0x16, 0xDE, 0x5D, 0x8D, 0x32, 0xDD, 0xA4, 0xCF, 0x7F, 0x5C, 0xF7, 0x98, 0x74,
-    0x2D, 0xEE, 0xC7, 0xEB, 0xA7, 0x0C, 0x65, 0xE9, 0x66, 0xC2, 0xA4, 0x7F, 0x35, 0x72, 0xAF, 0x0E,
-    0xE2, 0x3D, 0x24, 0xC0, 0x09, 0xAE, 0x2B, 0x1B, 0xB0, 0xFF, 0x1B, 0xC2, 0xAA, 0xB9, 0x3B, 0x7F,
-    0x79, 0xCE, 0x70, 0xA8, 0x61, 0x3A, 0xA4, 0xE1, 0x63, 0xEE, 0x44, 0x37, 0x31, 0x0B, 0xA0, 0xCD,
-    0x6D, 0x2F, 0xF8, 0x34, 0xDF, 0x0A, 0x85, 0xBC, 0xCE, 0x53, 0xA5, 0xFC, 0x07, 0x43, 0xCB, 0x2A,
-    0x9A, 0xD0, 0x36, 0x24, 0xD1, 0x7D, 0x57, 0x14, 0x82, 0x9A, 0x46, 0x32, 0x36, 0x86, 0xF5, 0x4E,
-    0xC9, 0xF4, 0xCC, 0xF7, 0x5E, 0x64, 0x9E, 0xF9, 0x3E, 0xCE, 0xDB, 0x1D, 0x25, 0x5C, 0xB1, 0x8B,
-    0x7E, 0xDE, 0x67, 0xCD, 0x83, 0x3B, 0xC6, 0x5E, 0xDE, 0xC4, 0xDF, 0xC9, 0xF8, 0x83, 0x90, 0x98,
-    0x1B, 0xAF, 0x47, 0xEA, 0x77, 0x61, 0x68, 0x22, 0x20, 0x91, 0xEA, 0xA0, 0x03, 0x8F, 0x0D, 0x55,
-    0xA4, 0xC2, 0x9F, 0xA8, 0x28, 0xB5, 0xE8, 0x28, 0x38, 0xCA, 0x0D, 0xFA, 0x31, 0xEE, 0x6C, 0xD0,
-    0x9F, 0xC5, 0xA6, 0x17, 0x50, 0x61, 0xE5, 0x89, 0xC9, 0xF9, 0xEF, 0xAD, 0xFC, 0xF2, 0xCC, 0xF7,
-    0xB5, 0xDF, 0x82, 0xB9, 0xC4, 0x4A, 0x0C, 0x7A, 0xB4, 0xEF, 0x4E, 0xEC, 0x7C, 0x76, 0x6A, 0x35,
-    0xB0, 0x35, 0xC9, 0x36, 0x59, 0x5D, 0xCD, 0xF0, 0x45, 0x9B, 0xB1, 0xDE, 0x42, 0x28, 0xA1, 0xC3,
-    0x97, 0x00, 0x43, 0x1D, 0xCC, 0xAF, 0x76, 0x53, 0x1F, 0x4E, 0xA6, 0x64, 0x40, 0xCC, 0x18, 0x10,
-    0x93, 0xB5, 0x40, 0xAA, 0xE5, 0x3E, 0x20, 0x68, 0x53, 0xB4, 0x4A, 0x78, 0x01, 0x4A, 0x31, 0xEA,
-    0xE7, 0xF9, 0xFD, 0x3E, 0x1E, 0xC8, 0x81, 0x69, 0x66, 0x27, 0x07, 0x32, 0x17, 0xE4, 0x09, 0x01,
-    0x59, 0x5F, 0x3A, 0x6A, 0xF7, 0x59, 0xED, 0x46, 0x35, 0x3C, 0xB4, 0xF5, 0xEC, 0x77, 0x9E, 0x4F,
-    0x75, 0x1A, 0x79, 0xA2, 0xC0, 0xC6, 0xDC, 0x5F, 0xFC, 0x3E, 0xDD, 0xED, 0x17, 0x27, 0xF5, 0x2A,
-    0x74, 0x04, 0xAB, 0x98, 0x6C, 0x22, 0x96, 0x82, 0x6D, 0xE0, 0xC7, 0x36, 0xA6, 0xBC, 0x43, 0x89,
-    0x9E, 0x9E, 0x24, 0x09, 0x57, 0x8C, 0x9A, 0x3C, 0x1E, 0x19, 0xCF, 0xBF, 0x4C, 0xFA, 0x85, 0x58,
-    0x8B, 0xC7, 0xBD, 0x78, 0x9E, 0x13, 0xD8, 0x7D, 0xA0, 0xEA, 0x27, 0x1F, 0xE6, 0x36, 0x9B, 0x42,
-    0xA7, 0x36, 0x0F, 0x9A, 0xA5, 0x75, 0x76, 0xE9, 0x74, 0xCA, 0x48, 0xB0, 0x7E, 0x48, 0xB0, 0x9A,
-    0x9F, 0x1C, 0x74, 0x64, 0xB1, 0x85, 0x58, 0xF2, 0x86, 0xC5, 0xB8, 0xB6, 0x3F, 0x85, 0xED, 0xA0,
-    0xDA, 0xF4, 0x5D, 0xF6, 0x23, 0xA1, 0x7B, 0x21, 0x70, 0xED, 0x89, 0xDB, 0x3F, 0xC0, 0xE4, 0x83,
-    0xCE, 0x9E, 0x59, 0xF6, 0x42, 0xCB, 0x8A, 0xAD, 0x8D, 0x7F, 0x55, 0x81, 0xCD, 0x03, 0x19, 0xD3,
-    0xB6, 0x4B, 0xA7, 0x7E, 0x9E, 0x5B, 0x0E, 0x53, 0x94, 0x8B, 0x72, 0xF6, 0xCE, 0x9C, 0xA3, 0x78,
-    0x6C, 0xE4, 0x08, 0xA9, 0xD9, 0xD5, 0xBC, 0xFD, 0x67, 0x6F, 0x56, 0xBE, 0xF7, 0xB6, 0xC7, 0x0A,
-    0xB1, 0xD8, 0x94, 0x1C, 0x8F, 0x8D, 0x1C, 0x76, 0xCC, 0x64, 0x3E, 0xB5, 0xBB, 0xE7, 0xAD, 0x47,
-    0xCD, 0xB2, 0xAD, 0xF1, 0xD0, 0xCC, 0x42, 0xDF, 0xBF, 0x61, 0x32, 0xBC, 0x31, 0x60, 0xB2, 0x98,
-    0x1D, 0xF5, 0xA4, 0xD3, 0x51, 0x65, 0x3A, 0xCA, 0xCB, 0x58, 0x6D, 0x64, 0xE7, 0x78, 0xCD, 0xA6,
-    0xC6, 0x43, 0xC2, 0xEF, 0xB4, 0xF1, 0x9B, 0xFC, 0x69, 0x3B, 0x78, 0x7A, 0xE1, 0x1C, 0x3C, 0xE4,
-    0x9C, 0xB5, 0xF0, 0x01, 0x7B, 0x52, 0xC3, 0xE6, 0x9C, 0xDA, 0xFA, 0xD5, 0xD2, 0xD2, 0x60, 0x8F,
-    0x4B, 0x55, 0xA5, 0xE0, 0x3F, 0xF1, 0xD0, 0xB9, 0xF6, 0xD6, 0x63, 0xA3, 0xE4, 0xBE, 0x99, 0xB3,
-    0xAF, 0x76, 0x7A, 0x55, 0xA7, 0xBD, 0x76, 0x8A, 0x8E, 0xA7, 0x0F, 0x0F, 0x0F, 0xDF, 0xE2, 0xD6,
-    0xFA, 0xA7, 0x4E, 0xA7, 0xAF, 0xCF, 0x75, 0x9F, 0xBA, 0x65, 0x20, 0x4F, 0x98, 0x06, 0x67, 0x71,
-    0x12, 0xF4, 0x7A, 0x1F, 0x3C, 0x9C, 0xE8, 0x10, 0x35, 0x6A, 0xB4, 0x0F, 0xEB, 0x15, 0x14, 0x9B,
-    0xD3, 0x15, 0xEB, 0x2E, 0x41, 0x12, 0x42, 0xCD, 0x13, 0x7D, 0xB2, 0x46, 0xB9, 0xFB, 0x70, 0x9D,
-    0x57, 0xF9, 0x37, 0x10, 0x17, 0x8E, 0x51, 0x46, 0xF2, 0x80, 0xAF, 0x8D, 0x3A, 0x24, 0xB0, 0xB4,
-    0x81, 0x88, 0x72, 0x04, 0x6A, 0xCB, 0x03, 0x04, 0x16, 0x22, 0x40, 0x8D, 0xCB, 0x82, 0xEB, 0xE4,
-    0xA6, 0x36, 0x24, 0x5A, 0x73, 0x4C, 0xE5, 0xBE, 0xB8, 0xED, 0x12, 0x05, 0xE7, 0xDC, 0x71, 0x75,
-    0xB1, 0x3B, 0xFA, 0xA2, 0x32, 0x6D, 0xCB, 0x45, 0xFE, 0x49, 0xEB, 0xC3, 0x52, 0x5E, 0xB1, 0x6A,
-    0x8C, 0x59, 0xD3, 0x4A, 0xCA, 0xEC, 0x97, 0x79, 0x21, 0x36, 0x3E, 0x50, 0x71, 0x6F, 0x28, 0x1C,
-    0x52, 0x9E, 0xF8, 0xC5, 0xEB, 0xAE, 0x42, 0x1D, 0x3C, 0x22, 0x1E, 0x3C, 0xEA, 0x92, 0x93, 0x83,
-    0x7F, 0x68, 0x52, 0xD7, 0xEF, 0x21, 0x56, 0x5E, 0x5B, 0x6F, 0x1A, 0x57, 0x67, 0xDD, 0xB1, 0x5E,
-    0x08, 0xDB, 0x3B, 0xBF, 0x69, 0xF0, 0x78, 0xC8, 0x91, 0x3B, 0x96, 0x1B, 0x77, 0x3C, 0x60, 0x30,
-    0xCE, 0x59, 0xED, 0xDB, 0xD3, 0xEE, 0xF8, 0xD8, 0xC8, 0xA1, 0xC5, 0xEB, 0x28, 0xCC, 0x17, 0x39,
-    0x81, 0x47, 0x3E, 0x51, 0x9F, 0xCD, 0xF3, 0x5B, 0xD5, 0xF3, 0xDE, 0xD3, 0x37, 0xC4, 0x75, 0xBE,
-    0xF7, 0x90, 0xD1, 0x25, 0x8E, 0x75, 0x08, 0x37, 0x63, 0xD2, 0x3C, 0x36, 0xEA, 0x9C, 0xC6, 0xBD,
-    0x0A, 0x68, 0xA1, 0x6C, 0x67, 0xF6, 0x86, 0x70, 0xBA, 0xF1, 0x49, 0x17, 0xB9, 0x29, 0xAD, 0x22,
-    0xC7, 0x6E, 0xD5, 0x12, 0x13, 0xD5, 0x1B, 0xF9, 0x72, 0xED, 0x3A, 0xF9, 0x9A, 0xB0, 0xC1, 0x5A,
-    0xE7, 0x82, 0x97, 0x9C, 0x9D, 0xB4, 0x6A, 0xC8, 0xE8, 0x30, 0x5C, 0xD4, 0xF9, 0xBE, 0x80, 0x3A,
-    0x40, 0xEC, 0xE6, 0xE2, 0x65, 0xBF, 0x59, 0xC9, 0xAE, 0x41, 0x40, 0xCE, 0x70, 0x55, 0x89, 0xDD,
-    0xAB, 0xD7, 0x30, 0xF8, 0xAE, 0x88, 0x48, 0x38, 0x56, 0x2A, 0xAE, 0xB7, 0xA7, 0xF7, 0xD4, 0x50,
-    0x58, 0x9A, 0x12, 0xD3, 0xA9, 0xDD, 0x9A, 0xF5, 0xF6, 0xF8, 0x9C, 0xBC, 0xF1, 0xEF, 0x74, 0xBA,
-    0x5D, 0xFF, 0x8B, 0x89, 0x29, 0xE7, 0xFF, 0x99, 0xE0, 0xB7, 0x37, 0x9C, 0xA8, 0x17, 0xA0, 0xB7,
-    0xE5, 0x2A, 0x1E, 0xA4, 0x9C, 0xFA, 0xA5, 0x45, 0xF0, 0x89, 0xD6, 0x39, 0x81, 0x49, 0x09, 0x27,
-    0xB3, 0xE5, 0x37, 0x07, 0x56, 0x48, 0xB6, 0x4A, 0xD4, 0xF6, 0x51, 0x9F, 0x45, 0x29, 0xB3, 0xE4,
-    0xFF, 0xD1, 0xA1, 0x1A, 0x47, 0x40, 0xC2, 0x9F, 0xE2, 0xD1, 0x19, 0x54, 0xA6, 0x73, 0xFE, 0x92,
-    0xB6, 0x29, 0xD1, 0x4C, 0x34, 0x12, 0x22, 0x03, 0xFC, 0x0D, 0xE6, 0x0E, 0x63, 0x59, 0xFE, 0xC7,
-    0xEC, 0xBC, 0xAC, 0x6A, 0xA6, 0x60, 0x62, 0xB8, 0x61, 0xC3, 0x56, 0xBE, 0x39, 0x1A, 0xA2, 0xD8,
-    0xE2, 0xF9, 0xAB, 0xB7, 0xDB, 0x6E, 0x0C, 0x5B, 0x97, 0xCC, 0xD2, 0x92, 0x4B, 0x57, 0xDB, 0xE3,
-    0x54, 0x5F, 0xD0, 0x9E, 0x7B, 0xA2, 0xB4, 0xF4, 0xDF, 0xD5, 0x5C, 0x3D, 0x8C, 0xE5, 0xD6, 0x75,
-    0xBE, 0x24, 0x35, 0xC3, 0x58, 0x04, 0x4C, 0x15, 0xDE, 0xC4, 0x91, 0x10, 0x30, 0x85, 0x10, 0xE4,
-    0xCF, 0x66, 0x9B, 0x42, 0x1A, 0xD2, 0x76, 0xE1, 0x52, 0x5B, 0xCC, 0x48, 0x41, 0xB6, 0x90, 0x0B,
-    0x17, 0xB2, 0x5C, 0x4C, 0xE3, 0x22, 0x85, 0x35, 0xA4, 0xAD, 0xC2, 0x45, 0x8A, 0x6C, 0x63, 0x07,
-    0x88, 0x0B, 0x6D, 0x21, 0x04, 0xF6, 0xBA, 0xD8, 0x14, 0x29, 0x04, 0x44, 0xF3, 0x48, 0x49, 0x40,
-    0x54, 0xA4, 0x30, 0x63, 0xC0, 0x4E, 0xE1, 0x22, 0x04, 0xA4, 0x8D, 0x91, 0x75, 0xA1, 0x67, 0xE9,
-    0x2D, 0xF4, 0x46, 0x22, 0x79, 0x73, 0xBE, 0xEF, 0x5C, 0xF2, 0xF1, 0xBD, 0x79, 0x6B, 0x39, 0xB0,
-    0xB3, 0xD8, 0x5D, 0x69, 0x38, 0xF3, 0x1E, 0x7F, 0xEE, 0xB9, 0xDF, 0x39, 0xF7, 0xFC, 0x5F, 0x1A,
-    0x63, 0xAE, 0x9C, 0x1C, 0x1B, 0x63, 0x32, 0xDB, 0xC9, 0xB1, 0xB0, 0x6B, 0x83, 0x6F, 0xAE, 0x9A,
-    0xED, 0x7F, 0x3E, 0x4E, 0x9A, 0x90, 0xC7, 0x98, 0xC7, 0xA4, 0xC7, 0x31, 0x3B, 0xC7, 0xF1, 0xEC,
-    0x0C, 0xC7, 0xEE, 0x8C, 0x17, 0x66, 0x72, 0x0C, 0x56, 0x38, 0x46, 0x4B, 0x1C, 0xE3, 0x1A, 0xC7,
-    0xB4, 0xCC, 0x72, 0x79, 0xBC, 0xC1, 0x71, 0x90, 0x4F, 0xC6, 0xEB, 0x70, 0x0C, 0xFA, 0x93, 0xD3,
-    0xDA, 0x84, 0xD6, 0xDA, 0xDA, 0xC4, 0x3C, 0xA6, 0x77, 0x6E, 0xDE, 0xAA, 0x71, 0x59, 0xDC, 0x98,
-    0xCA, 0xE0, 0x28, 0x03, 0x45, 0x2D, 0x08, 0x88, 0xDA, 0x60, 0x25, 0x44, 0x2C, 0xE3, 0x25, 0x8E,
-    0x49, 0x83, 0x63, 0x56, 0xCB, 0x68, 0xF2, 0xF9, 0x44, 0x48, 0xF6, 0xAC, 0x6D, 0x8D, 0x6F, 0x6D,
-    0x83, 0x8F, 0xB9, 0xA3, 0xFC, 0x0A, 0xC8, 0xB1, 0xED, 0x91, 0x49, 0x6C, 0x77, 0x6E, 0x8A, 0xDB,
-    0xE7, 0x9D, 0x67, 0x4D, 0xD2, 0x05, 0x9D, 0x89, 0xD7, 0xE1, 0xCA, 0x84, 0xAB, 0xB8, 0xD5, 0x87,
-    0x85, 0xCB, 0xB4, 0x06, 0xC9, 0xA5, 0x89, 0x5B, 0x0E, 0x2F, 0x87, 0x04, 0xB4, 0x67, 0x38, 0x14,
-    0xA5, 0x1C, 0xAC, 0x4C, 0xC2, 0xB7, 0x79, 0x56, 0x47, 0xF2, 0x88, 0xBB, 0x55, 0x26, 0x24, 0x77,
-    0x47, 0x32, 0x62, 0xF3, 0xB4, 0x31, 0x9F, 0xD1, 0xE1, 0xFE, 0xCA, 0xFC, 0x91, 0x1C, 0x9F, 0x32,
-    0x4F, 0x03, 0x9C, 0x7F, 0x04, 0x52, 0x89, 0x5D, 0x02, 0x3A, 0x5B, 0xE2, 0xF4, 0x63, 0xE6, 0x21,
-    0x03, 0xD6, 0x6B, 0xCC, 0x3F, 0x1B, 0x6F, 0xE9, 0xC9, 0x99, 0xE1, 0xB4, 0x35, 0xA6, 0x92, 0x27,
-    0x99, 0x74, 0x00, 0x59, 0x23, 0xC2, 0xF7, 0x1B, 0x62, 0x85, 0x2C, 0x01, 0xAA, 0x06, 0xD4, 0xC8,
-    0x2C, 0xF3, 0x11, 0x31, 0xEF, 0x02, 0xF2, 0x1B, 0xBF, 0x2D, 0x94, 0x9A, 0x2A, 0xAE, 0x47, 0xC0,
-    0xD2, 0x1A, 0xF7, 0x74, 0x10, 0x94, 0xA8, 0x95, 0x99, 0x2B, 0x5E, 0xC1, 0xDA, 0x2C, 0xE4, 0x41,
-    0xB5, 0x2F, 0xF7, 0xD8, 0x93, 0x6B, 0x4B, 0x07, 0x57, 0x26, 0x47, 0xE3, 0x0F, 0x37, 0x6F, 0x76,
-    0x00, 0x49, 0x90, 0x21, 0x5A, 0x40, 0x28, 0x2D, 0x85, 0x7E, 0xB9, 0x47, 0x80, 0xF3, 0x3A, 0x05,
-    0xAB, 0x90, 0xA1, 0x93, 0xB7, 0xF0, 0xF4, 0x8C, 0xB4, 0x61, 0x60, 0x73, 0x84, 0x43, 0xC0, 0x3F,
-    0x53, 0x92, 0x4C, 0x8A, 0x03, 0x52, 0x1C, 0x11, 0xBB, 0x68, 0x75, 0xFF, 0xC1, 0xC3, 0x90, 0x61,
-    0x03, 0xE8, 0xF2, 0x91, 0x5C, 0x12, 0xCA, 0xBF, 0x32, 0x9C, 0x8D, 0x97, 0x1B, 0xC1, 0xFC, 0x73,
-    0xC8, 0x6B, 0x48, 0x32, 0x49, 0x71, 0x86, 0xCF, 0x11, 0x6E, 0xF7, 0xF9, 0xE5, 0x23, 0x3B, 0x82,
-    0x7C, 0x2A, 0x6B, 0x4F, 0xD4, 0x87, 0x2C, 0x3E, 0xC1, 0x4F, 0x88, 0x1F, 0xCC, 0x61, 0x19, 0xF0,
-    0xCE, 0x0A, 0x77, 0x26, 0x40, 0x23, 0x20, 0x0E, 0x80, 0xCC, 0x0D, 0x45, 0x51, 0x07, 0xA6, 0xEE,
-    0x14, 0x07, 0x09, 0xF8, 0x7C, 0xC8, 0xB3, 0x1B, 0x9F, 0x37, 0xB8, 0x6F, 0xCB, 0xE9, 0xDA, 0xB4,
-    0xA1, 0x00, 0x10, 0xCD, 0xDE, 0x78, 0xB9, 0xC9, 0x86, 0x1F, 0x75, 0x10, 0x50, 0x61, 0xA1, 0x68,
-    0x82, 0x77, 0xE5, 0x7B, 0xA7, 0x04, 0x30, 0x15, 0x5C, 0x0D, 0xC1, 0x8E, 0xDD, 0x4F, 0x24, 0x83,
-    0x7A, 0x93, 0x8E, 0xB8, 0x4A, 0xC1, 0x96, 0xBB, 0x96, 0xBE, 0xFD, 0xEE, 0x6B, 0x9E, 0x75, 0x0F,
-    0xAE, 0xDC, 0x88, 0x49, 0x8D, 0x35, 0x67, 0x20, 0x30, 0x4A, 0xB3, 0x2E, 0x3F, 0xC7, 0x52, 0x7E,
-    0x51, 0x3B, 0x9E, 0xDA, 0x9F, 0x9E, 0x63, 0xBD, 0xE5, 0xF2, 0x3C, 0xB9, 0xF1, 0x98, 0x8F, 0x7F,
-    0xF4, 0x3A, 0x50, 0x23, 0xA5, 0x15, 0x9E, 0x90, 0xFE, 0x18, 0x57, 0xB7, 0x19, 0xA1, 0x5C, 0x81,
-    0x35, 0xDE, 0xC3, 0x82, 0x25, 0xA6, 0x02, 0x35, 0x15, 0xC9, 0x0C, 0xA3, 0x77, 0x96, 0x32, 0x8B,
-    0x33, 0x81, 0x33, 0x6C, 0xE4, 0x96, 0xC7, 0xEE, 0x0B, 0x96, 0x7E, 0x3E, 0x49, 0x24, 0x61, 0xD0,
-    0xA5, 0x75, 0x68, 0xF6, 0xFC, 0x3B, 0xB4, 0x03, 0x74, 0x83, 0xED, 0x65, 0x7D, 0x61, 0x22, 0x02,
-    0xEA, 0x0B, 0x26, 0xC3, 0x4D, 0x11, 0xC6, 0xF6, 0x54, 0xAC, 0xEB, 0x09, 0x1A, 0x4E, 0x3F, 0x6E,
-    0x26, 0x0D, 0xC3, 0x53, 0x24, 0x53, 0x01, 0x0C, 0x36, 0x00, 0x86, 0x1B, 0x58, 0xDD, 0x05, 0xB8,
-    0xD6, 0x27, 0x0B, 0x94, 0x1B, 0x55, 0x23, 0x6C, 0x0D, 0xEC, 0x9D, 0x4A, 0xD6, 0x2C, 0x78, 0x28,
-    0xCB, 0x7B, 0x90, 0xCB, 0x0F, 0x8E, 0xC7, 0x49, 0xE0, 0x69, 0x1E, 0x6E, 0x28, 0x76, 0xE9, 0x17,
-    0xA4, 0xC5, 0x88, 0x81, 0xF2, 0x3A, 0x1A, 0x9E, 0x6D, 0x61, 0x1B, 0xC0, 0x25, 0x12, 0x35, 0xB8,
-    0x1B, 0xC0, 0x67, 0x51, 0x0C, 0x4A, 0x53, 0x37, 0x47, 0x71, 0xE5, 0x66, 0x02, 0x96, 0x06, 0xF6,
-    0xD9, 0x95, 0x88, 0x50, 0x2F, 0xCF, 0x93, 0x1B, 0x3D, 0x1A, 0xF5, 0xC3, 0xD2, 0xBF, 0x81, 0x85,
-    0x2F, 0x37, 0x79, 0x2B, 0x3C, 0x2A, 0x7E, 0x0F, 0xB4, 0x17, 0xA0, 0x3A, 0xE0, 0x04, 0x0E, 0x1E,
-    0x96, 0x95, 0xFD, 0x68, 0x2E, 0x53, 0x79, 0x49, 0x66, 0xE2, 0x63, 0x22, 0x9C, 0x47, 0xB5, 0x74,
-    0x0F, 0x99, 0x26, 0x01, 0x79, 0x4C, 0xC5, 0x04, 0x27, 0x02, 0x29, 0xE0, 0xA4, 0x40, 0x66, 0x4E,
-    0x08, 0x89, 0x27, 0x24, 0x92, 0xE0, 0x82, 0x04, 0x12, 0x93, 0x8D, 0xDA, 0x3A, 0x1B, 0xC9, 0xC3,
-    0x0D, 0x64, 0x6F, 0xDC, 0x5F, 0x6B, 0x08, 0xA9, 0x0A, 0xE5, 0x15, 0xB2, 0xB3, 0x34, 0xAF, 0x42,
-    0xA3, 0x88, 0xD9, 0x35, 0xF1, 0x9B, 0x90, 0x87, 0x84, 0xC8, 0x64, 0x14, 0x8D, 0x82, 0x86, 0xFF,
-    0x78, 0x1B, 0xD3, 0xD4, 0xBE, 0x8A, 0x29, 0x42, 0xB8, 0x61, 0x74, 0x4A, 0x21, 0xE2, 0x50, 0x8E,
-    0x0B, 0x99, 0x5F, 0x8E, 0x01, 0x2D, 0x98, 0x29, 0x03, 0x16, 0x10, 0x30, 0x10, 0x17, 0xB7, 0x60,
-    0x77, 0x5A, 0x03, 0xBC, 0xCA, 0x50, 0x1C, 0xC2, 0x25, 0xC0, 0xC6, 0xA0, 0x59, 0x89, 0x79, 0x0C,
-    0x34, 0xE2, 0x2B, 0x48, 0x41, 0x5A, 0x83, 0xB3, 0x16, 0x86, 0x2D, 0x5A, 0x41, 0xA4, 0x69, 0x23,
-    0x82, 0x5E, 0x7C, 0x03, 0x59, 0x01, 0x32, 0xF3, 0x10, 0xAE, 0xC2, 0xA1, 0x30, 0xD6, 0x8E, 0xEB,
-    0xA3, 0x84, 0x84, 0x5E, 0x77, 0x2B, 0xA7, 0xFC, 0x1A, 0x25, 0xB9, 0x26, 0x17, 0x93, 0x37, 0x38,
-    0x8F, 0xF4, 0x2D, 0x32, 0x36, 0xFD, 0x0E, 0xB9, 0x93, 0x3D, 0xC3, 0x69, 0x65, 0x9F, 0xE2, 0x0D,
-    0x85, 0x5A, 0xB2, 0x85, 0xDA, 0xB2, 0x73, 0x4E, 0xB0, 0xC3, 0xCD, 0x95, 0xD8, 0x33, 0x11, 0x34,
-    0x4B, 0xA5, 0x21, 0x8C, 0xC1, 0xCA, 0xC3, 0xF0, 0x2B, 0x8A, 0x2F, 0x66, 0x40, 0xCB, 0x46, 0x51,
-    0x01, 0x43, 0x84, 0x05, 0x51, 0x6B, 0x9C, 0x97, 0x62, 0x68, 0xE1, 0xC8, 0x85, 0x4C, 0x7F, 0x01,
-    0x4B, 0xDA, 0x39, 0x9C, 0xF3, 0x61, 0xF6, 0xC5, 0xD6, 0x41, 0xB3, 0xD0, 0xDA, 0x19, 0xB5, 0x77,
-    0xD0, 0xB5, 0xCD, 0x4B, 0xA0, 0xC8, 0x39, 0x0C, 0x91, 0xFD, 0x1F, 0x3A, 0xB8, 0x22, 0xC1, 0x22,
-    0x3E, 0x16, 0xE3, 0x7A, 0x55, 0x0B, 0x2F, 0xA9, 0xA0, 0x13, 0x94, 0xD5, 0x60, 0x76, 0x95, 0x63,
-    0xAC, 0x01, 0x8A, 0x2A, 0x58, 0x07, 0xA4, 0x13, 0x34, 0xA4, 0xF4, 0xB2, 0xAA, 0xBF, 0x18, 0x6E,
-    0x96, 0x41, 0x6F, 0x65, 0x1D, 0xC5, 0xBF, 0xB4, 0x56, 0x56, 0x55, 0x09, 0x27, 0xA0, 0xA7, 0x47,
-    0xB1, 0x24, 0x91, 0xF5, 0x02, 0x22, 0x02, 0x1E, 0xC4, 0x4B, 0xF0, 0xC0, 0xE6, 0x10, 0x4A, 0x30,
-    0xCF, 0xB3, 0x65, 0xD4, 0x7A, 0xA2, 0xFA, 0x33, 0x32, 0x5C, 0x49, 0xB0, 0x94, 0x00, 0x45, 0xDB,
-    0xB8, 0xC5, 0xAB, 0xB2, 0xA8, 0xEB, 0x86, 0x8A, 0xCB, 0xE9, 0x8E, 0x83, 0x93, 0xE2, 0x78, 0x84,
-    0x99, 0x28, 0x87, 0xB6, 0xED, 0x47, 0x8C, 0xAB, 0xDB, 0x8B, 0xCE, 0x21, 0xAC, 0x00, 0x2B, 0xBE,
-    0x0A, 0xAF, 0x3C, 0x4F, 0x8E, 0x0A, 0xAE, 0x62, 0xAB, 0xD0, 0x2A, 0xB2, 0x0A, 0xAC, 0xE2, 0xAA,
-    0xB0, 0x2A, 0xAA, 0x59, 0x1D, 0x57, 0x23, 0xA6, 0xB1, 0x5D, 0x1F, 0x4D, 0x88, 0x3A, 0x40, 0x19,
-    0x31, 0x30, 0x54, 0xA8, 0x04, 0x8A, 0x9D, 0x70, 0x21, 0x22, 0x48, 0x38, 0x24, 0x98, 0x02, 0x67,
-    0x94, 0x96, 0xE3, 0xBA, 0xCF, 0x26, 0x71, 0xA9, 0x26, 0x45, 0x4E, 0x29, 0x1B, 0xC4, 0x65, 0x07,
-    0x77, 0x4A, 0x1F, 0x20, 0x05, 0x17, 0x27, 0x27, 0xBA, 0xF2, 0xB8, 0x0E, 0x21, 0x21, 0x14, 0x0C,
-    0xD5, 0xCF, 0xC4, 0x4A, 0x1F, 0xBC, 0x79, 0xBA, 0xB5, 0x04, 0x78, 0x05, 0x55, 0x25, 0x97, 0x7B,
-    0xF2, 0x3C, 0x1F, 0x48, 0x83, 0xC4, 0x83, 0x13, 0xB7, 0xFE, 0x0E, 0xA8, 0x0D, 0x84, 0xF1, 0x02,
-    0x6B, 0xF1, 0x53, 0x61, 0x51, 0x29, 0xCE, 0x54, 0xE9, 0xAF, 0xE5, 0x61, 0xBD, 0x3C, 0xBA, 0x90,
-    0x81, 0xAA, 0x6F, 0xF7, 0x5F, 0xB7, 0x25, 0x88, 0xC8, 0xEC, 0x85, 0x89, 0x7F, 0xEA, 0x48, 0xE8,
-    0xDC, 0x0C, 0xB0, 0x0C, 0x45, 0x6F, 0xFB, 0x26, 0xBB, 0x7B, 0x5A, 0x07, 0x18, 0x2A, 0x85, 0x7E,
-    0xBC, 0xA2, 0xCE, 0xFF, 0xE7, 0x8C, 0xF9, 0xA6, 0xFC, 0x27, 0xAE, 0xFF, 0x5A, 0xD5, 0x8E, 0xC0,
-    0x51, 0xEE, 0xFA, 0xFD, 0x0F, 0x08, 0x42, 0x61, 0xEE, 0xD7, 0xA4, 0x36, 0xB8, 0x10, 0x75, 0x45,
-    0x62, 0xE9, 0x9E, 0x8C, 0xB4, 0x7A, 0xC7, 0xE0, 0xFB, 0x1A, 0x6B, 0x66, 0x49, 0xB0, 0x92, 0x96,
-    0x0B, 0x23, 0x2D, 0x0B, 0x19, 0x18, 0x68, 0x21, 0xD4, 0x68, 0xD3, 0x9F, 0x55, 0xEB, 0x00, 0xF3,
-    0x00, 0x5C, 0xC1, 0xDD, 0x7C, 0xAE, 0x3E, 0x73, 0x67, 0x1F, 0x65, 0x91, 0xFF, 0xB1, 0x98, 0xF3,
-    0xCA, 0x10, 0xB0, 0x08, 0x92, 0xA3, 0xD6, 0xC8, 0x7C, 0x76, 0x9A, 0xA3, 0x9D, 0x26, 0xFA, 0xE4,
-    0x25, 0x53, 0xFE, 0x80, 0x20, 0x06, 0x4D, 0xAF, 0x13, 0x1A, 0xDC, 0xD8, 0x7E, 0x3E, 0x37, 0xDC,
-    0x8A, 0x17, 0x0C, 0x77, 0xD8, 0x3F, 0xBF, 0x0A, 0xD7, 0xA2, 0x92, 0x05, 0xAE, 0x6F, 0x21, 0x8E,
-    0xE8, 0x11, 0x2B, 0xC8, 0xEA, 0x04, 0x5A, 0x32, 0x91, 0x95, 0x00, 0x71, 0xDD, 0xF4, 0x57, 0x77,
-    0x0C, 0xF7, 0xE0, 0xB0, 0x12, 0xC3, 0xDD, 0x61, 0xE0, 0x99, 0xE1, 0x7E, 0x50, 0x20, 0x88, 0x31,
-    0x1C, 0xB5, 0xEB, 0xF4, 0x18, 0x46, 0x3A, 0xFA, 0x17, 0x23, 0x31, 0xBB, 0x89, 0x0C, 0x61, 0xAD,
-    0x06, 0x4A, 0x90, 0x67, 0x9F, 0xEB, 0xC5, 0xE5, 0x82, 0xA9, 0x8A, 0x5A, 0x08, 0x50, 0x96, 0x7B,
-    0x9D, 0xC4, 0x5E, 0x43, 0x74, 0xF7, 0xD6, 0x40, 0xF9, 0x81, 0x65, 0xCF, 0x8E, 0x77, 0x9D, 0xC1,
-    0x92, 0xBE, 0xC2, 0xEF, 0x51, 0x7A, 0x62, 0x78, 0x00, 0x8C, 0x40, 0x9F, 0x87, 0xA9, 0x2D, 0xF5,
-    0x5A, 0xC4, 0x34, 0x3E, 0xAE, 0x87, 0xDD, 0x49, 0x60, 0x1A, 0x87, 0x71, 0xFC, 0x17, 0xCC, 0xE3,
-    0xB8, 0x26, 0xCD, 0x8D, 0xB7, 0x06, 0x4E, 0x69, 0x95, 0x8F, 0x44, 0xE2, 0x2F, 0x73, 0x90, 0x6F,
-    0xC5, 0xE2, 0x34, 0x83, 0x54, 0xCF, 0x05, 0x66, 0x4C, 0x28, 0x08, 0x8F, 0xBA, 0x28, 0xDD, 0x04,
-    0x32, 0xF1, 0x89, 0x37, 0x67, 0x80, 0x32, 0xEE, 0x11, 0xA3, 0x82, 0x1B, 0xE3, 0xDB, 0xA2, 0x6F,
-    0x2E, 0xDD, 0x53, 0x8E, 0x38, 0x73, 0x72, 0x5E, 0x37, 0x71, 0x4B, 0xCF, 0x80, 0xB5, 0x30, 0xC4,
-    0x64, 0x57, 0x0D, 0xB3, 0xE0, 0xDD, 0x90, 0x39, 0x0A, 0xED, 0xC9, 0xCB, 0xF2, 0xA8, 0x0C, 0x04,
-    0x33, 0x4A, 0x23, 0xE5, 0xC7, 0x73, 0x88, 0x23, 0x19, 0x98, 0xAB, 0x34, 0xB9, 0x5B, 0x34, 0x04,
-    0x59, 0x68, 0x5B, 0x18, 0xA0, 0x1C, 0x60, 0x1A, 0x80, 0xD9, 0x54, 0x7F, 0x63, 0x5B, 0xE2, 0x1C,
-    0xC3, 0x13, 0x05, 0xD0, 0x24, 0x8E, 0xC4, 0x90, 0x2C, 0x7A, 0x60, 0xE2, 0x91, 0x95, 0xC4, 0xDA,
-    0xD0, 0xF2, 0xD0, 0xC9, 0x71, 0x28, 0xF9, 0x34, 0x58, 0xD9, 0x52, 0x0D, 0x2C, 0xE8, 0xFE, 0x7B,
-    0xCA, 0x6D, 0x42, 0xA3, 0x9C, 0xC8, 0x17, 0x57, 0x77, 0xA3, 0xC2, 0x27, 0x44, 0x25, 0x38, 0x07,
-    0xA7, 0xE2, 0xD0, 0x03, 0x38, 0x45, 0x8D, 0x18, 0x6D, 0x9C, 0x23, 0xF5, 0xFA, 0x92, 0x8D, 0xD7,
-    0xA7, 0xCE, 0x21, 0x41, 0xD6, 0x2F, 0x64, 0x19, 0x05, 0x16, 0x0A, 0x3A, 0xB1, 0xCB, 0x0C, 0xF1,
-    0xC0, 0x1B, 0x90, 0x8D, 0x05, 0xAE, 0x0B, 0xD6, 0x1A, 0xD2, 0x81, 0xFA, 0x02, 0x57, 0x7B, 0x9D,
-    0xCF, 0xC4, 0x06, 0x9E, 0x9A, 0xE5, 0x70, 0x20, 0xC5, 0x2A, 0xDA, 0x3B, 0xD4, 0x3B, 0x00, 0xD6,
-    0x57, 0x0F, 0xF2, 0x8A, 0x4E, 0xEA, 0x87, 0xE4, 0x42, 0x3D, 0x86, 0x66, 0xF4, 0x22, 0x16, 0xC0,
-    0xE4, 0xDC, 0x3C, 0xBD, 0x15, 0x99, 0x11, 0x84, 0x62, 0x08, 0x60, 0x50, 0x7E, 0xB5, 0x52, 0xC7,
-    0xA6, 0x10, 0x03, 0x00, 0x0B, 0x5A, 0x21, 0x2F, 0x90, 0x34, 0x34, 0xB9, 0x42, 0x93, 0x50, 0x00,
-    0xE8, 0xB0, 0x0A, 0xB3, 0x92, 0xF6, 0x36, 0x86, 0x93, 0x23, 0x4F, 0x15, 0x9A, 0x3A, 0x04, 0x1E,
-    0x34, 0xB6, 0xF2, 0xA5, 0x6D, 0xE4, 0x9B, 0x8F, 0x45, 0xBB, 0xFE, 0xAC, 0xEF, 0xE0, 0xBC, 0x88,
-    0x69, 0xAF, 0x64, 0x61, 0xC8, 0x8A, 0xE7, 0x5A, 0xE4, 0xFA, 0xF4, 0xD7, 0xD3, 0x62, 0x16, 0xFD,
-    0x79, 0x1D, 0xEC, 0x27, 0xA0, 0x19, 0x7C, 0x09, 0xAF, 0xBA, 0x50, 0xDE, 0xD4, 0xA6, 0xC5, 0x8A,
-    0xC0, 0x9A, 0x48, 0xFF, 0x89, 0xB6, 0x8A, 0x2C, 0xCA, 0xF6, 0x7A, 0xF4, 0x87, 0x90, 0x00, 0x75,
-    0x85, 0x52, 0xAA, 0x05, 0x79, 0xDC, 0xEB, 0x1A, 0x1A, 0xF9, 0xB3, 0xD0, 0x6A, 0xC6, 0x0B, 0xC6,
-    0x37, 0x0C, 0x57, 0xD4, 0x6F, 0xD6, 0x2F, 0x30, 0x43, 0x6B, 0xBF, 0xB4, 0x12, 0x16, 0x77, 0x32,
-    0x1B, 0x31, 0x21, 0x70, 0xE8, 0xD3, 0x6F, 0xF5, 0xA3, 0x37, 0x1A, 0x20, 0x7B, 0x81, 0x2C, 0x45,
-    0x0D, 0xE6, 0x08, 0xE5, 0x32, 0x19, 0x0B, 0x6E, 0xC1, 0xCB, 0x28, 0x84, 0x15, 0x1F, 0x55, 0x1D,
-    0x97, 0x1D, 0x6C, 0x0F, 0x64, 0x85, 0x06, 0xDA, 0x98, 0x6F, 0x98, 0xBF, 0x34, 0xE6, 0xF3, 0x48,
-    0x9E, 0x84, 0x17, 0x10, 0x77, 0xCC, 0x97, 0x31, 0xE7, 0xE4, 0x82, 0xB8, 0xCC, 0x89, 0x67, 0xD7,
-    0x31, 0x54, 0xDB, 0xDB, 0xF2, 0xC4, 0xEF, 0x7D, 0xB8, 0x54, 0x37, 0x08, 0xD9, 0x1B, 0xAC, 0xAC,
-    0x22, 0xCF, 0xE0, 0x58, 0xD3, 0xC3, 0x14, 0xAA, 0xFD, 0x0E, 0xAA, 0x7B, 0xA0, 0xC7, 0x97, 0xD3,
-    0x01, 0x12, 0x90, 0x63, 0xB0, 0x45, 0x34, 0xB5, 0x38, 0x4F, 0xC2, 0x16, 0x41, 0x22, 0x97, 0x6F,
-    0xDE, 0x93, 0xF0, 0xF5, 0xDA, 0x87, 0xE2, 0x31, 0xD9, 0xF7, 0xD7, 0x90, 0xF5, 0x1E, 0xEC, 0xCF,
-    0x26, 0xFF, 0x6C, 0xA3, 0x12, 0x84, 0xCF, 0x9F, 0xCE, 0x7D, 0x3A, 0xD0, 0x84, 0xA2, 0x07, 0xB6,
-    0xEF, 0x3A, 0xF3, 0x79, 0x7D, 0x8A, 0x27, 0x75, 0xC9, 0xEA, 0x8A, 0xF7, 0xCA, 0x7B, 0xC4, 0xAA,
-    0x0F, 0x36, 0x47, 0xD4, 0x28, 0xD3, 0xD6, 0x24, 0x93, 0xBA, 0x37, 0x5F, 0xD9, 0x9E, 0xC5, 0x03,
-    0xCE, 0x91, 0x87, 0x44, 0x25, 0x71, 0x3D, 0xDF, 0xE0, 0xF8, 0xE5, 0x64, 0x42, 0x98, 0xB8, 0xD3,
-    0x7C, 0x9D, 0x47, 0xE8, 0x47, 0xC5, 0xE4, 0x97, 0xA3, 0x05, 0xA6, 0x0D, 0xF4, 0xD6, 0xD3, 0x2D,
-    0x8B, 0xED, 0xA5, 0xFF, 0x60, 0x2B, 0x30, 0x73, 0xC8, 0x19, 0x6B, 0x5E, 0x21, 0x60, 0x5A, 0x37,
-    0xB8, 0x4B, 0xFB, 0xB4, 0x42, 0xBA, 0x32, 0x58, 0x72, 0x76, 0x57, 0x67, 0xCB, 0x5F, 0x67, 0xBF,
-    0x62, 0x52, 0xB2, 0x27, 0xF7, 0x0B, 0xCE, 0x3C, 0xA1, 0x64, 0x47, 0x8C, 0x96, 0x03, 0x8D, 0x33,
-    0xBB, 0xD9, 0xE9, 0x74, 0x73, 0xBA, 0xE4, 0xE9, 0x06, 0xD6, 0xFB, 0x39, 0xFA, 0x37, 0x62, 0xF1,
-    0xB0, 0xFA, 0x44, 0x64, 0x3F, 0xBA, 0x79, 0xB3, 0x1A, 0x4F, 0x77, 0x94, 0xF6, 0xC2, 0xB8, 0xCC,
-    0xBA, 0x4C, 0x82, 0x71, 0xA1, 0x3B, 0xED, 0xED, 0x9E, 0x5E, 0x68, 0xE8, 0x5A, 0x62, 0x85, 0x4C,
-    0xA7, 0x8D, 0xFF, 0x03, 0x88, 0x0F, 0xE2, 0x12, 0x44, 0x0B, 0xC9, 0x8F, 0x85, 0xE9, 0x6B, 0x81,
-    0x28, 0xCD, 0x45, 0x63, 0x6F, 0xCC, 0x26, 0x43, 0xC1, 0x6C, 0xD4, 0x15, 0x94, 0x6A, 0x5A, 0xE5,
-    0x7E, 0x5C, 0x71, 0x94, 0xF6, 0x85, 0x81, 0x77, 0x91, 0x8A, 0x3B, 0xF8, 0xB6, 0xD0, 0x9A, 0x15,
-    0xE2, 0x58, 0x09, 0x1F, 0xD6, 0x22, 0x57, 0x12, 0xCC, 0x48, 0x84, 0x57, 0x8A, 0xC8, 0xF5, 0xC2,
-    0x46, 0xB9, 0x46, 0xB8, 0x8A, 0xB8, 0xB4, 0x12, 0x5A, 0x39, 0x5E, 0xDC, 0x08, 0xA1, 0x99, 0x70,
-    0xC4, 0xEB, 0x04, 0x97, 0x08, 0x92, 0x9B, 0x95, 0x1D, 0x2E, 0x17, 0xDE, 0x22, 0x97, 0x90, 0x20,
-    0xE6, 0x5F, 0x68, 0xA6, 0x37, 0xDD, 0x8D, 0xC2, 0x15, 0xBB, 0x83, 0xE2, 0xBB, 0x27, 0x27, 0xD5,
-    0x71, 0x02, 0xA4, 0x6C, 0x97, 0xEA, 0xAF, 0x2B, 0xD5, 0xC9, 0xC9, 0xB3, 0xFD, 0x31, 0x16, 0x39,
-    0x68, 0x1F, 0x94, 0xED, 0xBD, 0xBA, 0xCB, 0x0A, 0x30, 0xD4, 0x9B, 0x88, 0xBC, 0xAF, 0xBF, 0x02,
-    0x81, 0xF8, 0x56, 0x6B, 0x1C, 0xC6, 0xCC, 0x65, 0xD4, 0x9A, 0x10, 0xA8, 0x1D, 0xF3, 0x1C, 0x8E,
-    0xF4, 0xF1, 0x76, 0x69, 0x70, 0x8C, 0x70, 0x55, 0x0F, 0x42, 0xD6, 0x1B, 0xC7, 0xE1, 0x4B, 0x30,
-    0x2E, 0x5D, 0x1C, 0x9D, 0x42, 0xBD, 0x3E, 0x77, 0xF7, 0x64, 0x82, 0x91, 0xD2, 0x25, 0xA8, 0xBD,
-    0x85, 0xE8, 0x25, 0xFB, 0x51, 0xE7, 0x7D, 0xDC, 0x86, 0xAB, 0x68, 0xD8, 0x85, 0x11, 0xF1, 0x3D,
-    0x61, 0x2C, 0xF6, 0xC1, 0xD8, 0xFC, 0x3A, 0x18, 0xCD, 0x57, 0x45, 0x47, 0x26, 0x5D, 0x50, 0x1B,
-    0x3B, 0x2C, 0x4C, 0xF4, 0x6F, 0x32, 0xF1, 0xA7, 0x3C, 0x11, 0xFB, 0x2D, 0xBF, 0x13, 0x0B, 0x07,
-    0xF1, 0xB4, 0xD0, 0x79, 0x7A, 0x71, 0x2F, 0x96, 0x3B, 0xFD, 0xA6, 0x9E, 0xDA, 0xB6, 0x84, 0xE4,
-    0x6E, 0xDA, 0x5C, 0x6D, 0xE9, 0xF6, 0xE5, 0xB5, 0x73, 0x3F, 0xB9, 0x08, 0xE3, 0xF1, 0xF2, 0x43,
-    0x44, 0x15, 0xD0, 0x3C, 0x11, 0xB4, 0x24, 0x4C, 0xD5, 0x75, 0xDB, 0x7C, 0x2E, 0xB3, 0xBF, 0x7C,
-    0xFB, 0x27, 0x76, 0xFD, 0x2F, 0xFE, 0x30, 0xCF, 0x47, 0x0F, 0x3A, 0x68, 0x47, 0x4A, 0xF0, 0x18,
-    0x54, 0x4E, 0x96, 0x7C, 0x2A, 0x90, 0x5D, 0x5C, 0x3A, 0x5D, 0x72, 0xE8, 0x4C, 0xE9, 0x71, 0xA7,
-    0x11, 0x8E, 0x6B, 0x69, 0x0E, 0xBC, 0xBF, 0x72, 0x32, 0x4B, 0x87, 0x81, 0x0C, 0xCC, 0xFD, 0x50,
-    0x02, 0x22, 0x4E, 0x1D, 0xD7, 0x63, 0x00, 0xCE, 0x70, 0x31, 0x86, 0xDD, 0x7B, 0xBF, 0xAC, 0x75,
-    0x10, 0x7F, 0xEF, 0x97, 0xF3, 0x38, 0xED, 0xB4, 0xD5, 0xF9, 0x56, 0x58, 0x7D, 0x07, 0x27, 0x27,
-    0x22, 0xBC, 0xA9, 0x1D, 0xA6, 0xB4, 0x00, 0xAE, 0xEB, 0x31, 0x09, 0x79, 0xBC, 0xDC, 0x17, 0x80,
-    0xE9, 0x78, 0x48, 0x84, 0x0C, 0x37, 0xC6, 0x8E, 0x21, 0x01, 0x10, 0xBA, 0x0C, 0x39, 0x12, 0xA6,
-    0x4C, 0x38, 0x22, 0xB8, 0xC4, 0x38, 0xFA, 0x35, 0x31, 0xD7, 0xF4, 0x55, 0x32, 0x8C, 0x50, 0xAD,
-    0xA8, 0xAC, 0xB6, 0x39, 0x4C, 0x02, 0x38, 0x4B, 0xF2, 0xA1, 0x77, 0xEC, 0xE1, 0x8C, 0xD2, 0x29,
-    0xF5, 0x98, 0x3B, 0xB6, 0x17, 0x23, 0x7B, 0xB7, 0xAF, 0xAB, 0xDD, 0xC4, 0x2E, 0x5F, 0x37, 0x38,
-    0xE9, 0x38, 0xD4, 0xAC, 0xB7, 0xD1, 0xB9, 0x7E, 0xDA, 0x44, 0x5F, 0xAA, 0xC3, 0x7A, 0xF8, 0x7A,
-    0x9B, 0x22, 0x06, 0x6B, 0x67, 0xA5, 0x86, 0x41, 0xF3, 0x6C, 0x5C, 0x75, 0x6E, 0xB1, 0x66, 0xBA,
-    0xFC, 0x76, 0x3F, 0xB7, 0x5C, 0xC5, 0x5B, 0x9F, 0x57, 0x6E, 0x52, 0x89, 0xFC, 0x70, 0x4E, 0x83,
-    0x23, 0xB5, 0x53, 0x4A, 0xF1, 0x00, 0xF5, 0x37, 0x94, 0xCE, 0x70, 0xA9, 0x64, 0xD2, 0x32, 0xD6,
-    0x2A, 0xD5, 0x98, 0x0C, 0xD3, 0x97, 0x2E, 0x67, 0x50, 0x38, 0x2E, 0xBA, 0x47, 0x61, 0x22, 0x10,
-    0x0C, 0xCE, 0xE3, 0x9B, 0x6A, 0xDF, 0x50, 0xB6, 0x41, 0x04, 0x0A, 0x9B, 0x00, 0xEB, 0x88, 0xB4,
-    0xA2, 0x16, 0x4F, 0xF1, 0xEF, 0x0F, 0xF9, 0xDC, 0x58, 0xC9, 0x9F, 0x5B, 0x8A, 0x7D, 0xE4, 0x77,
-    0xAA, 0x47, 0x76, 0x3F, 0xA3, 0xBC, 0xB6, 0xF3, 0xB9, 0x31, 0xDE, 0x0A, 0x56, 0x57, 0x8E, 0x46,
-    0x1E, 0xF4, 0x34, 0x43, 0x4F, 0x31, 0x9C, 0xCE, 0xE5, 0x72, 0x09, 0x7D, 0xCC, 0x0C, 0xAE, 0x11,
-    0x66, 0xB7, 0x53, 0x8F, 0xB8, 0x9F, 0x40, 0xA9, 0x3F, 0xD5, 0x89, 0x09, 0x5F, 0x4B, 0xF4, 0xB7,
-    0x84, 0x9F, 0x85, 0x92, 0x67, 0x2C, 0x41, 0x60, 0x5A, 0xC2, 0x9A, 0x67, 0x72, 0x3B, 0x4B, 0x98,
-    0xA0, 0x6A, 0x41, 0xBA, 0x7A, 0x52, 0xD6, 0xE3, 0x56, 0x90, 0xD4, 0x73, 0x41, 0x71, 0x25, 0xC8,
-    0x47, 0xEA, 0x3C, 0x90, 0x26, 0x7F, 0x84, 0x3C, 0x46, 0x50, 0x72, 0x2E, 0xC1, 0x08, 0xF5, 0xD7,
-    0x1A, 0xAA, 0x44, 0x62, 0xCF, 0x45, 0x82, 0xD4, 0x62, 0x09, 0xAA, 0x85, 0x60, 0x64, 0x59, 0x49,
-    0x79, 0x45, 0xDA, 0x17, 0xA4, 0x5E, 0x95, 0x63, 0xB7, 0x35, 0xA0, 0xCC, 0x42, 0xD8, 0x24, 0xF3,
-    0x40, 0xC5, 0x55, 0x42, 0x55, 0x7A, 0x39, 0x54, 0x69, 0xBA, 0x5E, 0x9C, 0x37, 0x86, 0x58, 0x0D,
-    0xE5, 0x11, 0x1C, 0x3B, 0x1E, 0xDB, 0x8D, 0x17, 0x9D, 0x9B, 0x1B, 0xF2, 0xF8, 0x18, 0x8E, 0x56,
-    0x56, 0x0A, 0x5D, 0x3D, 0xFC, 0x9F, 0xEB, 0x3B, 0xBE, 0xB6, 0xE8, 0xF7, 0x9A, 0xEE, 0x40, 0x8C,
-    0xCA, 0x2F, 0x2E, 0x97, 0x5F, 0x59, 0x4E, 0x4B, 0x9F, 0x21, 0x37, 0x0C, 0x3B, 0x2E, 0x73, 0xEC,
-    0x61, 0xE3, 0xF1, 0x2B, 0xAE, 0x69, 0xE0, 0x59, 0x28, 0x86, 0x75, 0x17, 0x32, 0x33, 0x35, 0xED,
-    0x99, 0x4C, 0x5E, 0x2F, 0xC7, 0x58, 0xE2, 0xAC, 0xDE, 0x43, 0x61, 0x17, 0x4E, 0x06, 0x63, 0x38,
-    0x36, 0x8C, 0xC9, 0xB4, 0x1D, 0xC0, 0x3C, 0x0A, 0xAF, 0x27, 0xEA, 0xC6, 0x06, 0x81, 0xF0, 0x83,
-    0xA5, 0xAB, 0x0C, 0x46, 0x8D, 0x38, 0x6A, 0x9B, 0xAA, 0xDA, 0x98, 0x07, 0x6B, 0xC6, 0xC7, 0x7A,
-    0x7B, 0x13, 0x0B, 0xAB, 0x7D, 0x89, 0x85, 0x7D, 0x29, 0x87, 0x6C, 0xDF, 0x99, 0xC5, 0xF6, 0x19,
-    0x75, 0xDE, 0x66, 0x67, 0xF2, 0xD1, 0xA0, 0xCC, 0xCE, 0x0C, 0xD3, 0x23, 0x51, 0xF2, 0x60, 0xE2,
-    0x22, 0xC3, 0x21, 0xB2, 0x33, 0x13, 0xE7, 0xC1, 0xF9, 0x49, 0x58, 0x99, 0x82, 0x9D, 0xFF, 0xB9,
-    0xCC, 0xAC, 0x93, 0x95, 0x9C, 0x94, 0xF2, 0xB4, 0xC7, 0xB6, 0xA3, 0x53, 0x0E, 0x72, 0x2F, 0xDB,
-    0x37, 0x1A, 0xB3, 0x7B, 0xDA, 0xBE, 0xD2, 0x51, 0xB4, 0xCF, 0xF6, 0x8D, 0x86, 0x73, 0xE7, 0xF2,
-    0xDE, 0x95, 0xAC, 0x52, 0x10, 0x8C, 0x1C, 0x80, 0x3F, 0xE4, 0x0E, 0x6A, 0xB9, 0x0F, 0xAA, 0x9F,
-    0x59, 0xF4, 0x8C, 0x06, 0xC0, 0xD2, 0xEF, 0x53, 0x2F, 0x1E, 0xD5, 0x0A, 0x96, 0xAA, 0x18, 0x46,
-    0x99, 0x8A, 0xE5, 0xA1, 0x81, 0x85, 0xCB, 0x9E, 0x15, 0xAC, 0x0E, 0x5F, 0x7B, 0x83, 0x8A, 0xAA,
-    0x65, 0xE2, 0xE9, 0x16, 0x12, 0x26, 0xBD, 0xDA, 0x32, 0x08, 0xB5, 0x78, 0xDB, 0x64, 0x38, 0x65,
-    0xA3, 0x61, 0x9D, 0xA7, 0x06, 0x45, 0x6E, 0xA8, 0xDA, 0x69, 0x20, 0x35, 0x3A, 0x29, 0x53, 0xF5,
-    0xC8, 0xBB, 0x6E, 0x57, 0xEA, 0x37, 0xF1, 0x02, 0x21, 0x19, 0x2B, 0x09, 0xF9, 0x14, 0x30, 0x88,
-    0x69, 0xDA, 0xF4, 0x9E, 0xFC, 0xA6, 0x2E, 0x26, 0x41, 0xCC, 0x24, 0x20, 0x13, 0xAA, 0x0A, 0x19,
-    0x9B, 0x31, 0x41, 0xD4, 0x82, 0x88, 0x2F, 0x42, 0x3B, 0xC8, 0x1F, 0xE1, 0xFB, 0xF2, 0x47, 0x7A,
-    0xAB, 0xD1, 0xF8, 0x3C, 0xC0, 0xA2, 0x8C, 0x57, 0x70, 0xC3, 0x7C, 0xE8, 0x0E, 0xB9, 0x3D, 0x6E,
-    0x50, 0x76, 0x70, 0x2B, 0xAB, 0x96, 0xA9, 0x16, 0xB9, 0xCC, 0x06, 0xFA, 0xC9, 0xEB, 0x76, 0x89,
-    0x27, 0x33, 0xBA, 0x31, 0xD2, 0x39, 0x9A, 0xE2, 0x99, 0x8D, 0x0E, 0xDF, 0x22, 0xC7, 0xFF, 0xDD,
-    0x93, 0x03, 0x17, 0x5D, 0x18, 0x87, 0x98, 0x1A, 0x1C, 0xEA, 0xD5, 0xDA, 0xCC, 0xCC, 0x88, 0xF8,
-    0xC3, 0xF8, 0xD6, 0x39, 0xA9, 0xC0, 0x88, 0xDE, 0xAB, 0x3A, 0xA4, 0x5A, 0xA4, 0x53, 0x89, 0xEC,
-    0xF4, 0x22, 0x4C, 0xA9, 0xDF, 0xBE, 0x68, 0xAD, 0xCF, 0xCE, 0x14, 0xFE, 0xC8, 0x5D, 0x24, 0x0E,
-    0xF1, 0x3B, 0xF2, 0xF3, 0x3C, 0x53, 0x6E, 0x50, 0x09, 0x05, 0x9B, 0x53, 0xC0, 0x18, 0x04, 0x38,
-    0x60, 0xE5, 0x63, 0x9B, 0x00, 0x61, 0x76, 0x73, 0xE6, 0x46, 0xD8, 0xA1, 0x88, 0x42, 0xA9, 0x17,
-    0xED, 0x50, 0x74, 0x99, 0xEC, 0x91, 0xA2, 0x4B, 0x64, 0xAB, 0xB6, 0x41, 0x2C, 0xB7, 0x33, 0x1D,
-    0x37, 0x58, 0xE5, 0x54, 0xDA, 0x6C, 0x3A, 0x6E, 0xB0, 0x3D, 0x14, 0x6D, 0x30, 0xE2, 0x45, 0xD6,
-    0xAE, 0x65, 0xBE, 0xFF, 0x69, 0xA9, 0xC7, 0x5D, 0xBF, 0x89, 0xC6, 0xAE, 0xB8, 0xF2, 0x25, 0x0D,
-    0x68, 0xD3, 0x51, 0x66, 0x1F, 0x1F, 0x63, 0x03, 0xBF, 0xDB, 0xEF, 0xB5, 0xE4, 0xAE, 0xCE, 0xF5,
-    0x89, 0x5E, 0xCC, 0x6A, 0x8F, 0x17, 0x33, 0xB6, 0x68, 0x08, 0xC9, 0xBE, 0x9A, 0xFD, 0xD7, 0xD1,
-    0xC0, 0xA5, 0x31, 0x59, 0xD4, 0xF8, 0xAF, 0x42, 0x64, 0x44, 0xFC, 0xCD, 0x39, 0x42, 0x60, 0x94,
-    0x0D, 0x53, 0x3C, 0x05, 0x36, 0xD0, 0x73, 0xAB, 0xA5, 0x1A, 0xFB, 0x00, 0xEE, 0xE5, 0x9D, 0x7F,
-    0x92, 0x42, 0xF3, 0x37, 0x97, 0x23, 0xDF, 0x2E, 0xB8, 0x34, 0xA1, 0x82, 0x73, 0x58, 0xBE, 0x20,
-    0x97, 0x89, 0xFB, 0xF0, 0xE6, 0x9A, 0x15, 0xD8, 0xEC, 0xEF, 0x44, 0xE2, 0x9F, 0xC9, 0x59, 0x78,
-    0x1D, 0xDD, 0x80, 0x5E, 0x7F, 0xBC, 0x5D, 0x8F, 0x62, 0xF4, 0x26, 0xF6, 0x79, 0x14, 0xA3, 0x37,
-    0xB1, 0xE3, 0x51, 0x4C, 0x7C, 0xA7, 0x37, 0xB3, 0x7B, 0xB1, 0xBB, 0xB0, 0x32, 0x73, 0x2F, 0xE6,
-    0x49, 0x19, 0xB3, 0xF7, 0xD7, 0x5E, 0x1F, 0xAC, 0xBC, 0x4E, 0xC6, 0xFD, 0xCA, 0x27, 0x7A, 0x31,
-    0x32, 0x45, 0x54, 0x14, 0x58, 0x50, 0x10, 0x81, 0x46, 0x97, 0x59, 0xA7, 0xD1, 0x1C, 0x9D, 0x2D,
-    0xF7, 0x79, 0x31, 0x96, 0x81, 0x43, 0xF7, 0xF9, 0x30, 0xCF, 0xBE, 0xBC, 0x8C, 0xDF, 0xEC, 0xC2,
-    0x65, 0xE5, 0x77, 0x07, 0xE3, 0xF9, 0x1D, 0x41, 0xD8, 0xFA, 0xAC, 0xF9, 0x01, 0xED, 0x6D, 0xBB,
-    0x07, 0x0E, 0xB5, 0x2E, 0xA2, 0xEC, 0x8B, 0x02, 0x69, 0x82, 0x40, 0xA4, 0x34, 0x95, 0x0C, 0x26,
-    0x81, 0x4A, 0x08, 0xAF, 0x0A, 0xAA, 0x5E, 0x7E, 0xFE, 0x64, 0xE6, 0xA4, 0x8D, 0x8F, 0xC2, 0x62,
-    0x47, 0xD2, 0x5E, 0x7E, 0xFA, 0x04, 0x2B, 0x17, 0xE9, 0x7A, 0x68, 0x6C, 0x61, 0x66, 0xCC, 0x3A,
-    0x6B, 0xC7, 0xDA, 0x6B, 0x29, 0x94, 0x30, 0x0B, 0x6F, 0x8A, 0x6F, 0xF8, 0x76, 0x19, 0x0F, 0xE2,
-    0xC2, 0x24, 0x9D, 0xFC, 0x25, 0x16, 0xFF, 0x91, 0x1E, 0xB3, 0x95, 0x53, 0x0B, 0x43, 0xFD, 0x24,
-    0x10, 0x23, 0x35, 0xD4, 0xAA, 0xD4, 0x08, 0xF7, 0xB5, 0x46, 0xAC, 0xAB, 0x44, 0x93, 0x4F, 0x9A,
-    0xEC, 0x73, 0xFA, 0x53, 0xD5, 0xBB, 0x77, 0x29, 0x9D, 0xB8, 0x60, 0x8D, 0x26, 0xD6, 0x0C, 0x04,
-    0x1C, 0x0B, 0xF1, 0x51, 0x68, 0x5C, 0x02, 0xD4, 0xC0, 0x45, 0xFB, 0x2D, 0x68, 0xC8, 0x3E, 0xA0,
-    0x3B, 0x77, 0xC6, 0x80, 0x26, 0xFA, 0x0F, 0x92, 0xDB, 0xCB, 0x14, 0xCE, 0xE4, 0xC2, 0x05, 0xA8,
-    0x40, 0x8B, 0x41, 0x2F, 0x66, 0x1A, 0x0B, 0xC0, 0x5F, 0x0B, 0x8F, 0x3B, 0xAE, 0x05, 0x75, 0x8B,
-    0xE8, 0x42, 0x85, 0x12, 0xFA, 0x86, 0x42, 0xAE, 0x7C, 0x71, 0x2E, 0xA8, 0x17, 0x0C, 0x94, 0xFE,
-    0x9D, 0x19, 0x97, 0xFE, 0x9C, 0xAB, 0xEC, 0x3D, 0xB6, 0xD7, 0x65, 0x1D, 0xC3, 0x46, 0xCB, 0x4A,
-    0x7B, 0xB2, 0xA6, 0x28, 0xD9, 0x7C, 0x84, 0x52, 0xA6, 0xF0, 0xC3, 0x31, 0xE9, 0x16, 0x4D, 0xCB,
-    0x84, 0xC6, 0x9A, 0xB9, 0xA3, 0x4D, 0x24, 0xF5, 0xA2, 0x90, 0x1A, 0x8A, 0xD8, 0x64, 0x70, 0x5B,
-    0x8B, 0xE2, 0xFB, 0x3D, 0x4C, 0xF6, 0x80, 0xD6, 0x9E, 0x01, 0x2E, 0xD5, 0x00, 0xA8, 0x06, 0x74,
-    0xF6, 0xF4, 0xA8, 0xBB, 0xA3, 0x8B, 0x8E, 0x39, 0xC6, 0x00, 0xAD, 0x74, 0x72, 0x40, 0x65, 0x1C,
-    0xE5, 0xF1, 0x25, 0x93, 0x1F, 0x30, 0xEE, 0x2D, 0x9C, 0xD6, 0x86, 0x79, 0x12, 0x31, 0xF1, 0x69,
-    0x0D, 0x53, 0xAB, 0x09, 0x08, 0xB1, 0x43, 0x96, 0x42, 0x9E, 0x50, 0x2D, 0xF9, 0xF0, 0x6A, 0x3A,
-    0x3A, 0x6F, 0x49, 0x1D, 0x7C, 0xDC, 0x42, 0xC6, 0x32, 0x14, 0xD0, 0xF3, 0xF0, 0x1D, 0x86, 0x8B,
-    0xE7, 0xE0, 0xB0, 0x3C, 0x4B, 0x60, 0x94, 0xF9, 0x47, 0x28, 0xC0, 0xC4, 0x35, 0xBE, 0xF0, 0x60,
-    0x7B, 0xE0, 0x24, 0xA6, 0x65, 0x02, 0xC7, 0xB3, 0xF3, 0xD5, 0x7F, 0xCC, 0x30, 0x7F, 0xA4, 0x14,
-    0xCE, 0xE4, 0xF6, 0x0C, 0xAB, 0x2E, 0xFD, 0xCE, 0x92, 0x31, 0xE8, 0x82, 0x0E, 0xF5, 0xCF, 0x99,
-    0x3C, 0x5A, 0x68, 0x3B, 0xA7, 0x65, 0x2E, 0x0B, 0x30, 0x22, 0x72, 0xD7, 0xE4, 0xD2, 0x6A, 0x5A,
-    0x8D, 0x7B, 0x7C, 0x01, 0x56, 0xC3, 0x46, 0x67, 0xC0, 0x57, 0x77, 0xE1, 0x69, 0x75, 0x22, 0x4B,
-    0x33, 0x6F, 0x45, 0xBD, 0x4F, 0x90, 0xCE, 0xBC, 0xC1, 0x57, 0xA7, 0xFA, 0x63, 0x3B, 0x55, 0x1D,
-    0x27, 0xF2, 0x1C, 0x59, 0x37, 0xCC, 0x0B, 0x66, 0xEC, 0xA9, 0x31, 0x99, 0x76, 0x65, 0x7D, 0x4C,
-    0x75, 0x1D, 0xF7, 0x66, 0xD3, 0x56, 0xE3, 0x5D, 0x7D, 0xD8, 0x45, 0xFF, 0x4F, 0xCD, 0xA3, 0xB9,
-    0x9B, 0x67, 0x87, 0x03, 0x5B, 0x87, 0x02, 0x86, 0x07, 0x9C, 0xE2, 0xAC, 0x44, 0x29, 0x9C, 0x8A,
-    0xDF, 0x10, 0x26, 0x05, 0xBF, 0x12, 0x3F, 0xDB, 0xEB, 0x87, 0xD3, 0x95, 0xB2, 0x2A, 0x5B, 0xA3,
-    0xE2, 0xB7, 0xD6, 0xB8, 0x27, 0x58, 0x93, 0x57, 0xCC, 0xB6, 0x1B, 0xE2, 0x2F, 0x8C, 0x89, 0x5B,
-    0x32, 0x4B, 0x26, 0xE1, 0x8D, 0x67, 0x10, 0x9F, 0x91, 0x5B, 0x8C, 0xE9, 0xC8, 0x5A, 0x70, 0xBA,
-    0x32, 0x8E, 0x5D, 0x8B, 0x29, 0xF0, 0xF2, 0x37, 0x0D, 0x5C, 0xE1, 0xA6, 0xB7, 0x4B, 0x66, 0x7B,
-    0xF8, 0xAA, 0xBF, 0x82, 0xE8, 0x1C, 0x05, 0xEF, 0x5B, 0xFB, 0x46, 0x4E, 0xD9, 0x89, 0x2C, 0x6A,
-    0x8F, 0x02, 0xB5, 0x44, 0x59, 0xA0, 0x08, 0xED, 0x56, 0x3D, 0xDC, 0xAA, 0xA4, 0xD1, 0x31, 0x38,
-    0x30, 0x12, 0x2C, 0x6B, 0x8D, 0x0B, 0x29, 0x3B, 0x3A, 0x32, 0x08, 0x5D, 0x6A, 0x18, 0x4A, 0x11,
-    0xBA, 0x74, 0xC3, 0x6F, 0xB9, 0x2E, 0xA3, 0xCD, 0xBA, 0xCC, 0xE6, 0xEB, 0x32, 0x99, 0xAF, 0xCB,
-    0xE8, 0x9E, 0xEB, 0xD2, 0x6C, 0xAD, 0xCB, 0xB3, 0xF9, 0xBA, 0x4C, 0x3B, 0x65, 0xEB, 0x7C, 0x5D,
-    0x32, 0x36, 0x73, 0x88, 0x29, 0x9A, 0x2E, 0x82, 0x8D, 0x34, 0x6C, 0xB5, 0xDA, 0x07, 0x56, 0x4F,
-    0xE5, 0xD4, 0xE9, 0xDF, 0x31, 0x72, 0x88, 0x2E, 0xBB, 0x7B, 0x34, 0xCB, 0xEE, 0x46, 0x48, 0x4B,
-    0xA6, 0xBF, 0x8B, 0xEC, 0xEE, 0x4E, 0x68, 0x4A, 0x0E, 0x93, 0xD7, 0x95, 0xB6, 0x30, 0x08, 0x1B,
-    0x6B, 0x17, 0xB1, 0xB1, 0x91, 0x06, 0x12, 0x69, 0xB5, 0x29, 0xA9, 0xD4, 0x5C, 0xDE, 0x6E, 0x7F,
-    0xC6, 0xBB, 0xDA, 0xCE, 0x66, 0x5C, 0x0F, 0x35, 0xE4, 0x5C, 0x40, 0xAC, 0x51, 0x53, 0xB1, 0xD0,
-    0xEC, 0x18, 0x42, 0x5C, 0x04, 0xE6, 0xE4, 0x28, 0xF7, 0x56, 0xC7, 0x53, 0xFF, 0x89, 0xA6, 0xAD,
-    0xA2, 0x88, 0x59, 0x1E, 0x07, 0x1A, 0x40, 0x1E, 0xBD, 0x1E, 0x25, 0x2C, 0xBF, 0xC3, 0x31, 0xE8,
-    0xF0, 0x4D, 0xB8, 0x66, 0x9A, 0x90, 0x2D, 0xEA, 0x49, 0xCB, 0x10, 0xAC, 0x16, 0xC1, 0xF1, 0x2C,
-    0x4A, 0x2B, 0x11, 0xAA, 0xE8, 0x77, 0xB4, 0x37, 0x09, 0xB0, 0x3E, 0x61, 0xFB, 0xB1, 0x34, 0xA5,
-    0x53, 0x89, 0x41, 0x25, 0x9B, 0x97, 0x36, 0x9B, 0x04, 0x8E, 0x8D, 0xB6, 0x05, 0x45, 0xCC, 0x11,
-    0xDE, 0xAE, 0xEA, 0x70, 0x8D, 0x8E, 0x6A, 0xF1, 0x05, 0x98, 0x09, 0x61, 0x1B, 0x38, 0xA2, 0xAE,
-    0x9F, 0x60, 0x3D, 0x3F, 0x83, 0x74, 0xA7, 0xD0, 0x11, 0x2E, 0x3B, 0xD7, 0x15, 0x37, 0x08, 0xF6,
-    0xC1, 0x92, 0xC9, 0x0E, 0x2B, 0xD8, 0xCB, 0x02, 0x4C, 0xDB, 0xC0, 0x7E, 0x9F, 0xF5, 0x7C, 0x24,
-    0x1E, 0xD7, 0x53, 0xDD, 0x32, 0x28, 0x3D, 0x04, 0x7F, 0x75, 0x80, 0xE3, 0x05, 0xC2, 0x41, 0x4F,
-    0x05, 0xA1, 0x58, 0xEF, 0xB5, 0xE4, 0x0F, 0x09, 0xB0, 0x9C, 0x56, 0x8C, 0xCC, 0x1C, 0xF7, 0x3C,
-    0x14, 0x90, 0x15, 0xCE, 0xE8, 0x91, 0x79, 0xF5, 0xC9, 0xD7, 0x9B, 0x65, 0x21, 0x0E, 0xD7, 0xC4,
-    0xD4, 0x94, 0x21, 0xBA, 0x89, 0x22, 0xB4, 0xB5, 0xB3, 0xD3, 0x50, 0xBC, 0x3B, 0x84, 0xCE, 0x48,
-    0x1F, 0x23, 0x04, 0x7B, 0x4B, 0xA4, 0xAF, 0x40, 0x17, 0x24, 0x36, 0x3E, 0xC4, 0x2D, 0x3C, 0x31,
-    0x95, 0x73, 0x38, 0x4C, 0x49, 0xEB, 0x8B, 0xDE, 0xBB, 0xA8, 0x44, 0xFF, 0x22, 0x83, 0x9D, 0x50,
-    0x2C, 0xC7, 0x36, 0x85, 0xC7, 0xA9, 0x3C, 0x9D, 0x87, 0xAD, 0xAE, 0x37, 0x42, 0x37, 0xF3, 0x3A,
-    0x43, 0xCB, 0x94, 0x8D, 0x2B, 0x26, 0x7F, 0xE4, 0x92, 0xD7, 0x54, 0x31, 0xF2, 0x57, 0xBF, 0xBB,
-    0xD0, 0xA6, 0x5D, 0xA2, 0x8D, 0x04, 0xA3, 0x68, 0x65, 0xC2, 0x4D, 0x2F, 0x2C, 0x69, 0x5C, 0x13,
-    0x50, 0xC5, 0xE4, 0x81, 0x02, 0xEE, 0x6A, 0x0D, 0x8A, 0xB8, 0x46, 0x03, 0x4B, 0x85, 0x5C, 0x29,
-    0x69, 0x15, 0x73, 0x16, 0x12, 0xD3, 0x5A, 0x41, 0xE7, 0x19, 0x0A, 0x1A, 0xCA, 0x9E, 0x1D, 0x9B,
-    0x92, 0x15, 0x76, 0x8C, 0x26, 0xEB, 0x4F, 0x71, 0x37, 0xD9, 0x70, 0x0B, 0x33, 0x54, 0xE0, 0xBD,
-    0x4A, 0xD5, 0xC5, 0x15, 0x33, 0x9B, 0x6F, 0xA1, 0x61, 0x56, 0x3F, 0x4E, 0x96, 0x73, 0x4D, 0x91,
-    0xB1, 0x9C, 0xCF, 0xF4, 0x8A, 0x71, 0x82, 0x8E, 0x5A, 0x88, 0x51, 0x3E, 0xC8, 0x90, 0x09, 0xAA,
-    0x1D, 0x32, 0x19, 0x4D, 0xEC, 0xD1, 0x91, 0x16, 0xF1, 0x11, 0xAB, 0xB0, 0x76, 0x85, 0xD9, 0x00,
-    0x49, 0x39, 0x58, 0x0D, 0xCC, 0x10, 0x3A, 0x8E, 0x15, 0x40, 0xA6, 0xD1, 0xA0, 0x34, 0xA1, 0x60,
-    0x29, 0xF4, 0x26, 0x1E, 0x4E, 0x71, 0x0F, 0xAB, 0x0A, 0xC5, 0x60, 0x8C, 0xD9, 0x29, 0xD8, 0x3D,
-    0x81, 0xE2, 0x0F, 0x0B, 0xB3, 0x6C, 0x3C, 0x0D, 0xDD, 0x6F, 0xC1, 0x99, 0xB8, 0x15, 0xB5, 0xDA,
-    0x19, 0xEB, 0xBA, 0xAB, 0x3A, 0xD7, 0x4C, 0xB6, 0x76, 0x79, 0x6E, 0x2D, 0x28, 0x50, 0x55, 0xF5,
-    0xCE, 0x4D, 0xEC, 0xD5, 0x33, 0xF6, 0xD0, 0x82, 0x83, 0x78, 0x99, 0x8D, 0x7B, 0xFA, 0x9B, 0x76,
-    0x17, 0x1D, 0x4F, 0xAE, 0x62, 0x81, 0xB0, 0x3A, 0x74, 0xBF, 0x23, 0xD7, 0x9F, 0x16, 0xBB, 0x04,
-    0x88, 0x46, 0x6E, 0xB5, 0x7A, 0x23, 0x69, 0xA3, 0x1E, 0x68, 0xBC, 0xD4, 0xB4, 0x84, 0x70, 0x41,
-    0xDB, 0x93, 0x45, 0xFE, 0xAD, 0x5B, 0x01, 0xE8, 0xF3, 0xD1, 0xE9, 0x2C, 0x37, 0xBC, 0x80, 0x98,
-    0xA3, 0x6D, 0x0E, 0x0D, 0x39, 0x56, 0xFB, 0x9E, 0x12, 0xF9, 0x9D, 0x5E, 0x9C, 0xBE, 0x6F, 0x9F,
-    0x83, 0x5E, 0x88, 0xDF, 0x6B, 0x58, 0x81, 0x47, 0xD5, 0xA9, 0x41, 0xC4, 0xD3, 0x52, 0xAA, 0x51,
-    0x20, 0xEF, 0x00, 0xB9, 0xA8, 0x9D, 0x06, 0x25, 0x93, 0xDB, 0xB7, 0x28, 0x35, 0xE8, 0x59, 0x8D,
-    0x1B, 0x6D, 0x7A, 0x06, 0xF6, 0x77, 0x35, 0x47, 0x32, 0x6E, 0x7A, 0xB2, 0xAA, 0xC4, 0x69, 0x50,
-    0xC0, 0x84, 0x35, 0xE7, 0x16, 0x0A, 0x65, 0x9F, 0x35, 0xF6, 0xBF, 0xED, 0x33, 0x17, 0xD7, 0xC4,
-    0xB2, 0xDA, 0x55, 0xC2, 0x12, 0xCB, 0xA0, 0x7D, 0x77, 0x07, 0xDA, 0xD8, 0x87, 0x7F, 0x37, 0xA7,
-    0xDC, 0x1D, 0xFB, 0xB0, 0x37, 0x8D, 0x64, 0xD9, 0xE5, 0xA6, 0x11, 0xDF, 0x7E, 0xC4, 0x3E, 0x0C,
-    0xA6, 0x9A, 0xD1, 0x69, 0x54, 0x3F, 0x31, 0x30, 0x50, 0xA9, 0x35, 0x2D, 0xCC, 0x2C, 0x2E, 0x0D,
-    0x3A, 0x97, 0x33, 0xCD, 0x8F, 0x1A, 0x6D, 0xB6, 0xA5, 0x16, 0xC0, 0x30, 0xD5, 0xEE, 0x23, 0xBB,
-    0xD6, 0x36, 0x40, 0xD3, 0x69, 0x8E, 0x1D, 0x06, 0x1E, 0xF9, 0x56, 0xEE, 0x48, 0x0A, 0xD0, 0xA7,
-    0xEA, 0xD1, 0x1F, 0xAB, 0xE8, 0x39, 0xC0, 0x1B, 0x19, 0xAB, 0xCF, 0xE2, 0x87, 0xBA, 0xD9, 0x9B,
-    0x17, 0x9D, 0x7F, 0x04, 0xBE, 0xA4, 0xEE, 0x07, 0x79, 0x92, 0x49, 0x83, 0xCA, 0x24, 0xC5, 0x37,
-    0x81, 0x11, 0x2D, 0x83, 0x5F, 0x7C, 0x74, 0x9D, 0x65, 0xD7, 0xAA, 0x21, 0xE2, 0xF4, 0x0E, 0xB1,
-    0x0E, 0x3F, 0xB9, 0x6E, 0xB4, 0xF5, 0x65, 0xBF, 0xE9, 0x26, 0x0E, 0xAC, 0x36, 0x46, 0x02, 0x58,
-    0x73, 0x8A, 0x9E, 0x48, 0xB4, 0x6C, 0x43, 0x6C, 0x98, 0x28, 0xD7, 0xA4, 0x36, 0x33, 0xDE, 0x1B,
-    0x47, 0x0B, 0x39, 0x73, 0x26, 0x97, 0x91, 0xDF, 0x46, 0x0B, 0x31, 0x8C, 0x03, 0x5B, 0xDA, 0x82,
-    0xA5, 0xC6, 0xBC, 0x03, 0xA8, 0x61, 0xDA, 0x1C, 0xD1, 0x60, 0x2D, 0x9F, 0xD9, 0xC2, 0xEB, 0x33,
-    0x09, 0xBF, 0x00, 0xBF, 0xC7, 0x26, 0x09, 0x3A, 0xDE, 0xC6, 0x6E, 0xB1, 0xE8, 0x07, 0xDC, 0x31,
-    0x36, 0xF1, 0x8F, 0x09, 0xC0, 0x98, 0x5E, 0x5B, 0x3D, 0xDB, 0xAE, 0x75, 0x70, 0x15, 0x4E, 0xA4,
-    0x8C, 0x91, 0xC8, 0x68, 0x17, 0xC3, 0xAB, 0x9A, 0x78, 0x4E, 0x57, 0x2E, 0x27, 0xCD, 0x18, 0x8C,
-    0x7E, 0x4A, 0x75, 0x29, 0x73, 0xFA, 0x9B, 0x64, 0x0C, 0xE7, 0xFF, 0xBE, 0x36, 0x5D, 0x30, 0xE5,
-    0xF6, 0xEA, 0xD1, 0xCD, 0x77, 0xD4, 0xFC, 0x19, 0xBC, 0xDF, 0xB0, 0xC1, 0x13, 0xE8, 0xFD, 0xC6,
-    0xEF, 0x95, 0x90, 0xB5, 0x7A, 0xEC, 0x67, 0xD9, 0x6D, 0xD0, 0x7B, 0x90, 0x84, 0xF0, 0x71, 0x24,
-    0x2F, 0xD6, 0xBE, 0x8C, 0xCC, 0x66, 0x6C, 0xF6, 0x29, 0x35, 0x6E, 0xEB, 0xCA, 0x95, 0x99, 0x18,
-    0x12, 0xEE, 0x4E, 0x16, 0x67, 0xFC, 0xCA, 0x9D, 0x9C, 0x72, 0x08, 0xB4, 0xD9, 0xE9, 0x80, 0x39,
-    0xD2, 0x20, 0x54, 0xFB, 0xAB, 0x7D, 0x63, 0xBB, 0xE9, 0xFE, 0xAA, 0xA0, 0x71, 0x49, 0x4B, 0x7D,
-    0x44, 0x3C, 0x31, 0x86, 0x1B, 0xE1, 0x56, 0x5B, 0x5B, 0xF4, 0xDC, 0x46, 0x8E, 0xEB, 0xC6, 0x75,
-    0x00, 0x8A, 0x71, 0x93, 0x85, 0xF0, 0x9A, 0x86, 0x18, 0x76, 0x4A, 0xE4, 0x0F, 0xDB, 0xDD, 0xB8,
-    0x45, 0x3D, 0xED, 0x0C, 0xB3, 0x53, 0xA9, 0x85, 0x5A, 0x86, 0xBB, 0xD8, 0x3C, 0x3B, 0x05, 0x62,
-    0x1C, 0x97, 0x1C, 0xCB, 0xA6, 0x8F, 0xD6, 0x7C, 0x03, 0xB3, 0x2C, 0xEE, 0x54, 0x9D, 0xF6, 0x46,
-    0xEA, 0x16, 0x18, 0xD7, 0xE5, 0xF2, 0xA2, 0xBB, 0x6C, 0x5C, 0xC0, 0xC9, 0xCE, 0x02, 0xF6, 0x4E,
-    0xB0, 0xD4, 0x48, 0x6B, 0x1D, 0x8B, 0x22, 0xE3, 0x7E, 0x99, 0xCE, 0x41, 0x00, 0x01, 0xE5, 0x66,
-    0x15, 0x6C, 0x5B, 0x51, 0x01, 0xEE, 0xDC, 0x6E, 0xC0, 0x68, 0xEC, 0xA3, 0xD5, 0x52, 0xF2, 0x93,
-    0x08, 0x4A, 0x6F, 0x9F, 0xA2, 0x43, 0x19, 0x0D, 0x00, 0xAB, 0xAD, 0xC6, 0x3F, 0xEE, 0xC9, 0x62,
-    0x83, 0x36, 0x1A, 0x32, 0xD8, 0xF7, 0xC7, 0x1D, 0x59, 0xBB, 0x75, 0x97, 0x07, 0x09, 0x38, 0x6C,
-    0x66, 0x2B, 0xB0, 0x0F, 0x46, 0xFC, 0x92, 0xF7, 0x91, 0x56, 0xEA, 0x64, 0xCD, 0x1F, 0x09, 0xBD,
-    0x8F, 0x4C, 0xB0, 0x61, 0x9A, 0x42, 0x68, 0x30, 0x3C, 0xDB, 0x8D, 0x09, 0xAB, 0xD0, 0x69, 0x3C,
-    0x80, 0xE6, 0x8D, 0xDE, 0x59, 0x64, 0x1D, 0x66, 0x70, 0x39, 0x98, 0xCE, 0x62, 0x76, 0xEC, 0xBA,
-    0xA8, 0xA0, 0xE1, 0x59, 0xB6, 0xC0, 0x2B, 0x62, 0x27, 0x0F, 0x18, 0x10, 0x54, 0x27, 0xF1, 0x54,
-    0xE0, 0x7A, 0x62, 0x6A, 0x7E, 0xF2, 0xC7, 0xA6, 0x66, 0x36, 0x10, 0x69, 0x2F, 0xD1, 0xFF, 0x07,
-    0x20, 0x68, 0x7F, 0xFE, 0x5B, 0xB7, 0x08, 0xB1, 0xEC, 0x63, 0xD7, 0x8D, 0x8C, 0x5E, 0x5D, 0x78,
-    0xA3, 0xEF, 0x4E, 0xBD, 0xC7, 0xDC, 0x67, 0x95, 0xC0, 0xB1, 0xE5, 0xF6, 0xA4, 0xD0, 0x4E, 0xBB,
-    0xAC, 0xAE, 0x3E, 0xA8, 0x4B, 0x93, 0x6A, 0xAD, 0xFB, 0xF5, 0x6A, 0xCD, 0x3B, 0x71, 0x35, 0x2D,
-    0x52, 0x7B, 0xFB, 0xB4, 0x56, 0x47, 0x76, 0x8C, 0x77, 0xE9, 0xDC, 0xF6, 0xAE, 0x1B, 0x5B, 0xA9,
-    0xAA, 0x96, 0x0E, 0x5A, 0xDD, 0x45, 0xB5, 0x69, 0x58, 0xF8, 0x14, 0xAC, 0x30, 0xD0, 0x8D, 0x75,
-    0x2F, 0xC5, 0x4A, 0x3B, 0x0E, 0xB1, 0x67, 0xD9, 0xD2, 0x3D, 0x7C, 0xC3, 0xB2, 0x2D, 0xF2, 0x93,
-    0x8A, 0x97, 0xBF, 0x65, 0x59, 0xB3, 0xD9, 0x53, 0xD6, 0xDC, 0x14, 0x3C, 0x7D, 0x3A, 0xDC, 0xCB,
-    0x29, 0xAD, 0x36, 0xDB, 0x7A, 0x98, 0x8E, 0x8D, 0x7A, 0xDA, 0xB4, 0xA6, 0x75, 0xDD, 0x43, 0x71,
-    0x38, 0x1B, 0x8A, 0x23, 0x2B, 0x16, 0x87, 0xAC, 0xEF, 0xAC, 0xAE, 0xDD, 0x3D, 0x9E, 0x25, 0xB6,
-    0xA7, 0x8A, 0xC6, 0x6E, 0x22, 0x7B, 0x31, 0x3A, 0xA6, 0xFE, 0xF0, 0xD7, 0xC2, 0x1D, 0x11, 0x9A,
-    0x1A, 0x12, 0xF7, 0x14, 0xC5, 0xFD, 0xB0, 0xE3, 0x90, 0x11, 0xAF, 0x86, 0x13, 0x01, 0x4A, 0x1E,
-    0x05, 0xCB, 0xD8, 0xE6, 0x1E, 0x2C, 0xFB, 0x31, 0x51, 0xC6, 0x20, 0x81, 0xFB, 0xD0, 0xAE, 0x6C,
-    0x15, 0x58, 0xD1, 0xAD, 0x55, 0x8C, 0x87, 0xB5, 0x2B, 0x7D, 0x75, 0x63, 0x05, 0x63, 0x77, 0x73,
-    0xC0, 0x72, 0xE4, 0xD6, 0xEE, 0x0E, 0x81, 0x8D, 0x68, 0xE5, 0x5B, 0x5B, 0x0F, 0x16, 0x53, 0x86,
-    0xA8, 0x1F, 0x39, 0xB0, 0xEF, 0xE9, 0xCE, 0x3D, 0xE8, 0xB5, 0xEA, 0x23, 0x5F, 0x1D, 0x7E, 0x59,
-    0x7C, 0xA4, 0x67, 0xC4, 0x0A, 0x7F, 0x4A, 0x9D, 0x8D, 0x81, 0xDE, 0x75, 0x89, 0x26, 0xC1, 0xDF,
-    0xEF, 0x4F, 0xFE, 0x4F, 0x85, 0x8D, 0xA9, 0x5E, 0x81, 0xBF, 0x6F, 0x63, 0x63, 0x5B, 0x4D, 0x10,
-    0x11, 0x8B, 0xFC, 0x36, 0xD3, 0xE7, 0xA6, 0x80, 0x0A, 0x62, 0x7A, 0xB3, 0xBA, 0x73, 0x63, 0x74,
-    0x98, 0xEF, 0x35, 0xFD, 0xEE, 0xD7, 0x4E, 0x1F, 0xDD, 0xC1, 0x4F, 0x6B, 0x85, 0xB1, 0x23, 0xA5,
-    0xA7, 0xAC, 0x24, 0x34, 0x22, 0x23, 0xEC, 0xAC, 0xD2, 0x08, 0x27, 0xE6, 0x5E, 0x43, 0xE4, 0x5E,
-    0xFE, 0xE0, 0xE2, 0x78, 0xDE, 0x78, 0xD5, 0x4E, 0x9D, 0x55, 0x82, 0x53, 0x74, 0xF1, 0x15, 0xC8,
-    0x09, 0x4C, 0x02, 0xD5, 0x8A, 0x3C, 0xFB, 0x06, 0xF4, 0x80, 0xC7, 0xB2, 0xF6, 0x2F, 0xE5, 0xA2,
-    0x23, 0x40, 0x60, 0xBE, 0x49, 0xAD, 0x70, 0xE9, 0x15, 0x04, 0x19, 0xDD, 0xC6, 0x82, 0x98, 0x6B,
-    0x0D, 0x68, 0x20, 0xF9, 0x2C, 0x29, 0x29, 0xEE, 0xEC, 0x62, 0x5C, 0x29, 0xFE, 0xAA, 0x41, 0x75,
-    0xE3, 0x9B, 0x96, 0x79, 0x58, 0x0D, 0x69, 0xA8, 0x2B, 0x6B, 0xAD, 0x1B, 0xE9, 0x1E, 0x44, 0x76,
-    0xEC, 0x95, 0xCA, 0x0D, 0x9A, 0x7A, 0x33, 0x7F, 0x55, 0x81, 0x56, 0x0A, 0x11, 0xAA, 0x31, 0xA8,
-    0x16, 0x65, 0x9C, 0x2C, 0xD1, 0x21, 0x19, 0xDB, 0x1F, 0xC1, 0x25, 0xB6, 0x1A, 0x43, 0x32, 0xFF,
-    0xE1, 0x02, 0x96, 0xAF, 0x9A, 0x27, 0x4D, 0xDC, 0xFB, 0xD8, 0xB4, 0x78, 0xCB, 0x84, 0x3F, 0x11,
-    0xEE, 0x7D, 0x1E, 0x02, 0xBE, 0x35, 0x21, 0xBA, 0x7B, 0xC9, 0xA5, 0x0E, 0x3D, 0xB4, 0x54, 0x64,
-    0x5F, 0x40, 0x2E, 0x87, 0x31, 0x6E, 0x36, 0xA6, 0xC2, 0xE8, 0xAD, 0x27, 0x53, 0x1E, 0x6D, 0x6D,
-    0x42, 0xF4, 0xEE, 0x66, 0x2D, 0xF7, 0xC1, 0x59, 0x73, 0xD4, 0xF9, 0xC3, 0xB5, 0x0F, 0x96, 0x81,
-    0xF0, 0xA6, 0x0C, 0xB8, 0x05, 0x4E, 0xD5, 0xF6, 0x01, 0x33, 0x60, 0xCC, 0x24, 0xB9, 0xE3, 0xC1,
-    0xC9, 0xF1, 0xC3, 0x89, 0x2A, 0x73, 0x62, 0xC9, 0x9E, 0x9C, 0x98, 0xCA, 0x76, 0xF6, 0xAD, 0xCB,
-    0xF9, 0xC3, 0x11, 0xB4, 0xB8, 0x46, 0x84, 0x13, 0xEC, 0x62, 0xEC, 0x21, 0xC9, 0xCA, 0x17, 0x15,
-    0x14, 0xA5, 0xF8, 0xD2, 0x08, 0x64, 0xD3, 0x15, 0x7B, 0xB8, 0xD3, 0xDB, 0x55, 0x86, 0x06, 0xB9,
-    0xB5, 0xC9, 0xFA, 0xB0, 0x19, 0x23, 0xCC, 0xC8, 0x84, 0xB0, 0x9F, 0x39, 0xFA, 0xBA, 0xA2, 0xDB,
-    0x15, 0x7B, 0x61, 0xA8, 0x3B, 0x18, 0x59, 0x5F, 0x7A, 0xD1, 0xC0, 0xC3, 0x02, 0xEC, 0x98, 0x13,
-    0x73, 0x9B, 0x01, 0xAB, 0xCB, 0x39, 0xB1, 0xFB, 0x26, 0xAE, 0xE6, 0x71, 0x32, 0x55, 0xB7, 0xB0,
-    0xDD, 0xA5, 0x26, 0xAA, 0x9F, 0xDA, 0x1C, 0x1B, 0x1C, 0xBD, 0x8F, 0x98, 0x81, 0xAC, 0xDA, 0x7D,
-    0x79, 0xC8, 0x87, 0x46, 0x45, 0x1C, 0xA2, 0xD9, 0x0B, 0xBE, 0x50, 0xFC, 0x0F, 0x32, 0xCA, 0x53,
-    0x12, 0x6F, 0x7A, 0x6D, 0x8C, 0x89, 0x8A, 0xBB, 0x16, 0x41, 0x13, 0x46, 0xFD, 0xEE, 0xF4, 0x50,
-    0x6F, 0x08, 0x27, 0x89, 0xDE, 0xD3, 0xE5, 0xCB, 0x0C, 0x70, 0xCB, 0x7A, 0x8F, 0x98, 0x16, 0xB7,
-    0x1C, 0x42, 0x2C, 0x07, 0x71, 0x0B, 0x8D, 0x07, 0xF9, 0x8E, 0xC1, 0x86, 0xAA, 0xE1, 0xBE, 0xD9,
-    0xEA, 0x7B, 0x5D, 0x27, 0x1A, 0xEA, 0x65, 0x51, 0x53, 0x68, 0x5D, 0x77, 0xF9, 0xAF, 0x47, 0x6F,
-    0xBC, 0x48, 0xA3, 0xA2, 0x7B, 0xCC, 0xB5, 0xDD, 0x13, 0x5E, 0x83, 0xBF, 0x82, 0xE3, 0xE8, 0x2D,
-    0xB9, 0xAD, 0xEE, 0xB1, 0x5D, 0xDC, 0x69, 0xD5, 0x4A, 0x36, 0x47, 0xB7, 0xCE, 0xFA, 0x29, 0xF0,
-    0x8A, 0x92, 0x1A, 0x3C, 0x9E, 0x6E, 0xDC, 0x69, 0xED, 0x03, 0xE0, 0x96, 0x65, 0x77, 0x5A, 0xA1,
-    0x0F, 0xD4, 0xCA, 0xEE, 0x9E, 0x66, 0x97, 0xDC, 0xA5, 0xD3, 0x04, 0x5F, 0xBB, 0x42, 0x70, 0x42,
-    0xA0, 0xAF, 0x18, 0x73, 0x29, 0xFA, 0x01, 0x77, 0x2E, 0x68, 0xFA, 0x02, 0x39, 0x90, 0xEB, 0x1B,
-    0xF8, 0x35, 0x19, 0xE9, 0x43, 0x86, 0x29, 0xC8, 0x22, 0xBF, 0x38, 0x20, 0x17, 0xF9, 0x5A, 0x48,
-    0x03, 0x9C, 0xEF, 0x42, 0xAF, 0xF1, 0x3A, 0xB1, 0x8F, 0x00, 0xB2, 0xA6, 0x14, 0xA7, 0x48, 0xDE,
-    0x8C, 0x91, 0xFC, 0xEE, 0x99, 0xC2, 0x90, 0x01, 0xC8, 0xA5, 0xB5, 0xE4, 0x80, 0x7C, 0x8D, 0x3C,
-    0x1D, 0x58, 0x10, 0x5D, 0x9C, 0x4A, 0x3C, 0x47, 0x1E, 0xC4, 0xF6, 0x0B, 0xAB, 0x31, 0x09, 0xF9,
-    0x10, 0x48, 0xF1, 0xF9, 0xA6, 0x5A, 0x1B, 0x31, 0x6B, 0xC3, 0x04, 0x8E, 0x6B, 0xE6, 0xD2, 0xED,
-    0x20, 0xF1, 0xEC, 0x8D, 0x41, 0x33, 0x49, 0x41, 0x86, 0xA9, 0x98, 0xB4, 0xC6, 0xAE, 0xB8, 0x06,
-    0x9A, 0x65, 0x1F, 0x76, 0xA5, 0xBB, 0x90, 0xA9, 0xFA, 0x1D, 0x41, 0x94, 0xCB, 0x6D, 0x09, 0x0C,
-    0xB9, 0xA3, 0x83, 0x10, 0x72, 0xEF, 0x37, 0x11, 0xF4, 0xA8, 0x9D, 0x99, 0x54, 0x48, 0xC6, 0x96,
-    0xBB, 0x60, 0xAA, 0xDE, 0x66, 0x2B, 0x63, 0xE6, 0x35, 0x5E, 0xDF, 0x6D, 0x6D, 0x8F, 0x1C, 0x91,
-    0xA9, 0xDB, 0x90, 0xC9, 0xDD, 0x75, 0x46, 0x87, 0x67, 0x9F, 0x89, 0xEE, 0x6A, 0x39, 0xD8, 0x4D,
-    0x54, 0x8C, 0xC2, 0x41, 0x31, 0xEA, 0x19, 0x8E, 0x05, 0xF8, 0x9D, 0x35, 0x5A, 0x1B, 0xA8, 0x60,
-    0x5F, 0x7A, 0x2E, 0x74, 0xEC, 0xAC, 0xF5, 0x3F, 0x6E, 0xA9, 0x11, 0x83, 0x0F, 0x90, 0xC7, 0x5E,
-    0x98, 0xF0, 0x9D, 0x96, 0x3D, 0xAE, 0xF1, 0x5B, 0x4B, 0x72, 0x3A, 0x79, 0x19, 0xA9, 0xA1, 0x05,
-    0x4A, 0xB5, 0xEC, 0xE0, 0x3C, 0x63, 0xBE, 0xED, 0xCC, 0xF4, 0x01, 0x36, 0x21, 0x9D, 0xE1, 0xBD,
-    0x40, 0xE8, 0xAA, 0xF3, 0x57, 0xEC, 0xF4, 0x2F, 0x70, 0x56, 0xC0, 0x28, 0xA2, 0xC6, 0xC7, 0x7B,
-    0x96, 0x8A, 0xB8, 0xF6, 0x97, 0xF0, 0xC9, 0xD3, 0xD2, 0x47, 0xC5, 0x27, 0xCB, 0x54, 0x87, 0x66,
-    0x67, 0xC6, 0xFF, 0x10, 0xEB, 0xE0, 0x75, 0xE3, 0x7D, 0xD8, 0xF2, 0x6D, 0x0F, 0x1E, 0x7C, 0xEE,
-    0x6C, 0xA9, 0x01, 0x65, 0x86, 0xCA, 0x4F, 0x4E, 0xA2, 0xA7, 0x77, 0x4E, 0xF4, 0x53, 0xAF, 0xD3,
-    0xB4, 0xD7, 0xC5, 0x6D, 0xD1, 0x0B, 0xD6, 0x5A, 0x65, 0xFD, 0x02, 0xB5, 0xB3, 0xEE, 0x76, 0xB9,
-    0x8C, 0x0B, 0x04, 0x5D, 0x04, 0xE7, 0xBF, 0x1A, 0xC4, 0x7F, 0x15, 0x36, 0x47, 0xC9, 0x57, 0xE7,
-    0x26, 0x79, 0xDD, 0xA4, 0x6F, 0xCA, 0xDA, 0x97, 0x05, 0x1C, 0xB5, 0xC1, 0x2F, 0x1A, 0x28, 0xA7,
-    0x34, 0xC9, 0xB3, 0x7C, 0x61, 0xD6, 0x2F, 0xA1, 0x13, 0x38, 0x7A, 0x63, 0x15, 0xB7, 0x61, 0x9B,
-    0xC9, 0xFF, 0x26, 0xF9, 0xF6, 0x2A, 0xFE, 0xF6, 0xDA, 0x9C, 0xC5, 0xF5, 0x51, 0x5C, 0x7B, 0xEB,
-    0x97, 0xCC, 0x1A, 0x88, 0x2D, 0x83, 0x77, 0x96, 0x26, 0x79, 0x25, 0x8F, 0x5F, 0xA9, 0xCD, 0xD1,
-    0xEB, 0xE6, 0x48, 0x04, 0xF1, 0xE3, 0x06, 0x3B, 0x7B, 0x30, 0x84, 0x4C, 0x03, 0xC5, 0x5C, 0x4D,
-    0x7B, 0x65, 0xE4, 0x19, 0x6B, 0x2C, 0x0C, 0x3E, 0xA0, 0x0B, 0x82, 0xBB, 0xAC, 0xC5, 0x9E, 0x23,
-    0xE0, 0x4D, 0xB1, 0xDC, 0xE6, 0xC9, 0xE3, 0x33, 0x2C, 0x2F, 0xBC, 0x7E, 0x02, 0x5B, 0x70, 0x23,
-    0xBA, 0x11, 0x0D, 0x3B, 0x84, 0xE3, 0x9A, 0x7B, 0x69, 0xBC, 0x5E, 0x3B, 0x20, 0xC3, 0x96, 0xC6,
-    0x2E, 0xA9, 0xD5, 0xE2, 0xF9, 0x2B, 0xEC, 0x25, 0xB9, 0x60, 0x5E, 0x67, 0x6C, 0x1D, 0xD5, 0x9D,
-    0x9A, 0x45, 0x7E, 0x8F, 0xCD, 0xCE, 0x1B, 0x97, 0x7B, 0xBD, 0xE5, 0x72, 0xBB, 0x22, 0xAC, 0x12,
-    0xAD, 0x54, 0xEB, 0xE3, 0x48, 0xB7, 0x90, 0x70, 0x4E, 0xED, 0x90, 0x9A, 0x5D, 0xD2, 0x55, 0xC0,
-    0xFD, 0xF1, 0x45, 0x50, 0xDC, 0xEB, 0xE1, 0x76, 0x04, 0xC8, 0x31, 0x65, 0x10, 0xA6, 0x5E, 0x39,
-    0x1A, 0xDD, 0x96, 0xBA, 0xD9, 0x87, 0xBA, 0x74, 0xA5, 0x59, 0x63, 0xBE, 0x2D, 0x00, 0x06, 0xDE,
-    0x6D, 0x40, 0x36, 0x6B, 0xD2, 0xDD, 0x29, 0xB9, 0x1A, 0x84, 0x32, 0x53, 0xC7, 0xF8, 0x58, 0xA3,
-    0x7A, 0xD7, 0xDA, 0x50, 0x98, 0x69, 0x72, 0x1A, 0xC7, 0x6A, 0x76, 0x55, 0xFB, 0x65, 0xD8, 0x60,
-    0xFA, 0xAF, 0xBA, 0x91, 0x99, 0xCF, 0x2A, 0xB4, 0x0B, 0xDA, 0x43, 0xB1, 0x27, 0x6A, 0xD8, 0x27,
-    0x9A, 0xB9, 0x57, 0x84, 0x79, 0x97, 0x5C, 0xA8, 0x07, 0x88, 0x25, 0xFA, 0x9E, 0x29, 0xF7, 0xE6,
-    0x9C, 0x66, 0xD3, 0x5D, 0xD0, 0x4C, 0x7D, 0xAB, 0xDE, 0xCE, 0x1A, 0xC0, 0xBE, 0xA3, 0x86, 0x15,
-    0x98, 0x3C, 0xE0, 0x96, 0x2D, 0xC0, 0xD1, 0x4E, 0xA3, 0xBA, 0xD7, 0xEF, 0x6C, 0x5E, 0xB2, 0x35,
-    0xDB, 0xCF, 0xA7, 0x6F, 0xE9, 0xD9, 0x6C, 0xED, 0xF3, 0x66, 0x77, 0xD8, 0xD9, 0x1D, 0x3B, 0xEF,
-    0xF5, 0x99, 0xBD, 0x95, 0x46, 0x37, 0x5C, 0x6A, 0x3F, 0x3A, 0xF2, 0x12, 0x78, 0x03, 0x84, 0x6E,
-    0xC9, 0x27, 0x20, 0xDA, 0xCF, 0x8D, 0x94, 0x49, 0x38, 0x6D, 0xE6, 0x58, 0x8D, 0x49, 0x82, 0xAD,
-    0x8C, 0x8F, 0x23, 0xBF, 0x93, 0xC0, 0xE1, 0xF9, 0xA5, 0x23, 0x58, 0xEF, 0x99, 0x72, 0xBE, 0xE3,
-    0x6B, 0x69, 0x48, 0xEA, 0x94, 0x35, 0xB1, 0xA3, 0x0C, 0x14, 0x5B, 0x77, 0xF4, 0x12, 0x91, 0xB0,
-    0x0B, 0xCD, 0x6D, 0xD3, 0x77, 0x6F, 0x26, 0xA0, 0xCC, 0x29, 0xD1, 0x8A, 0xF8, 0xDE, 0x37, 0x25,
-    0x85, 0x24, 0x3F, 0xB5, 0xBA, 0x3F, 0x47, 0x0B, 0xD2, 0xBA, 0x19, 0x72, 0xFE, 0x56, 0x9E, 0xCD,
-    0x2B, 0x8E, 0x66, 0x9B, 0x51, 0x67, 0x70, 0x87, 0xFB, 0xE1, 0xEE, 0x37, 0x9D, 0x0F, 0x9F, 0x0C,
-    0x37, 0xCB, 0x69, 0x20, 0xA1, 0x0C, 0x59, 0x18, 0xC4, 0xBF, 0xEB, 0x6E, 0x1E, 0xE1, 0x98, 0x63,
-    0xBA, 0xB4, 0x85, 0x16, 0x65, 0x32, 0x82, 0x79, 0xE5, 0xA4, 0x70, 0x6F, 0xF6, 0xF1, 0xC6, 0x97,
-    0x07, 0xF0, 0x2D, 0x49, 0x9D, 0xA3, 0x91, 0x79, 0xE3, 0x29, 0x41, 0x3C, 0x5E, 0xDA, 0x39, 0x22,
-    0x78, 0x29, 0x80, 0x04, 0x86, 0xAE, 0xFF, 0x92, 0xEF, 0x18, 0x42, 0x1F, 0x10, 0x10, 0xF8, 0x32,
-    0x8B, 0x86, 0x5A, 0x31, 0xDB, 0xCC, 0x62, 0x27, 0x95, 0xF7, 0x20, 0x0B, 0xA8, 0x7F, 0xDD, 0xFC,
-    0xC0, 0x84, 0x8D, 0xAC, 0x72, 0xF4, 0x3C, 0x69, 0x4E, 0x32, 0xE9, 0xC6, 0xC7, 0x7C, 0xE6, 0xBE,
-    0x0A, 0xA8, 0xF7, 0xC3, 0x69, 0x0F, 0x07, 0xDF, 0x32, 0x10, 0xB7, 0x8F, 0x4D, 0xBD, 0x46, 0xF9,
-    0x94, 0x27, 0x29, 0x36, 0x7D, 0xED, 0x1B, 0xC5, 0xE0, 0xCD, 0x04, 0x72, 0xBD, 0xF7, 0x86, 0xE5,
-    0x06, 0xEE, 0x66, 0x4A, 0xD5, 0x25, 0xB3, 0x1B, 0x36, 0xAF, 0xA3, 0x2A, 0x36, 0x8B, 0x63, 0xB1,
-    0xA3, 0x85, 0x92, 0x7A, 0xBB, 0xFD, 0x29, 0x98, 0x18, 0x11, 0x69, 0x76, 0x0D, 0x0F, 0x88, 0xB8,
-    0x81, 0xF5, 0x7F, 0x01, 0xB5, 0x56, 0x41, 0x6C, 0x1B, 0xC7, 0x15, 0xFD, 0xB3, 0x23, 0x69, 0x52,
-    0x6D, 0xA8, 0xE5, 0x41, 0x36, 0x1C, 0x5B, 0xD1, 0x5E, 0x74, 0x50, 0x05, 0xD1, 0xDB, 0x03, 0x0F,
-    0x04, 0x4A, 0x69, 0xC7, 0x56, 0x51, 0x1F, 0x82, 0x22, 0x2C, 0x60, 0x35, 0x47, 0xE7, 0xE0, 0x4B,
-    0x04, 0x04, 0x66, 0x80, 0x1C, 0x18, 0x54, 0xE4, 0xAE, 0xAD, 0x43, 0x8A, 0xE6, 0x60, 0x1E, 0xDA,
-    0x53, 0x51, 0x54, 0x07, 0x1D, 0x6C, 0xA6, 0x80, 0x79, 0x30, 0x0A, 0x1E, 0x28, 0xEF, 0xD8, 0x3C,
-    0xF8, 0x90, 0xCB, 0xAA, 0x2E, 0x92, 0x43, 0x0B, 0x74, 0x9D, 0xD8, 0x48, 0x0B, 0x23, 0xCD, 0x36,
-    0x59, 0x21, 0xAB, 0x78, 0x96, 0xD3, 0x3F, 0xBB, 0x94, 0xDA, 0x04, 0xC9, 0xB1, 0xCB, 0x5D, 0x0E,
-    0xE7, 0xEF, 0x9F, 0xFF, 0xFF, 0xFC, 0xFF, 0xFE, 0x1B, 0x6E, 0x41, 0x46, 0xA4, 0x91, 0xD0, 0x98,
-    0x86, 0x04, 0x60, 0x8B, 0xBB, 0xC2, 0xC1, 0x8F, 0x2D, 0x2C, 0x1F, 0xA7, 0x30, 0xDB, 0x05, 0x4B,
-    0x82, 0xA9, 0xB8, 0xF9, 0x49, 0x6C, 0x86, 0x1D, 0x4B, 0xB0, 0x03, 0x0E, 0x65, 0xD2, 0x85, 0x5D,
-    0x27, 0x65, 0xF7, 0xD5, 0x78, 0xDF, 0x7A, 0x57, 0xC5, 0xDB, 0x44, 0x01, 0x47, 0xE5, 0x53, 0x9B,
-    0x97, 0x5D, 0x25, 0x3D, 0x95, 0x9E, 0xDA, 0x6C, 0x9C, 0xED, 0xF5, 0x6E, 0xBB, 0x4A, 0x65, 0xF8,
-    0x48, 0x7C, 0x05, 0x7D, 0xF8, 0x71, 0x44, 0x9F, 0xFD, 0x33, 0xB0, 0x54, 0x62, 0x29, 0x4E, 0x38,
-    0xBC, 0x64, 0x7F, 0x70, 0x28, 0xCF, 0xC0, 0x14, 0xFC, 0x3C, 0x35, 0xFF, 0x1E, 0xB9, 0xD7, 0xB8,
-    0x2C, 0x03, 0xDF, 0xBA, 0xA8, 0x0E, 0xAE, 0xF8, 0x2E, 0x49, 0x83, 0x87, 0x89, 0x0D, 0x2D, 0x20,
-    0x5D, 0xA6, 0x76, 0x9E, 0x1E, 0x46, 0x8B, 0x2D, 0xF6, 0x07, 0xE3, 0x93, 0xE7, 0xB1, 0x9B, 0x68,
-    0x47, 0x2B, 0xC6, 0x1E, 0x4D, 0x31, 0xCA, 0xEB, 0x92, 0xA4, 0x16, 0x06, 0x2A, 0x21, 0x31, 0x31,
-    0xDA, 0x79, 0x80, 0x3D, 0x58, 0x69, 0x83, 0x74, 0x2E, 0xC5, 0xD6, 0xE7, 0x82, 0x29, 0xA0, 0xE8,
-    0xBA, 0x01, 0x46, 0xD7, 0x65, 0xD1, 0xBE, 0x25, 0xA4, 0x7D, 0x23, 0x71, 0x68, 0x7C, 0x0A, 0x66,
-    0x2F, 0xEC, 0xB6, 0xCD, 0x07, 0x89, 0x8B, 0x22, 0x97, 0x3D, 0x4E, 0x9D, 0x9F, 0x76, 0x6F, 0xC1,
-    0x56, 0x61, 0xD3, 0x16, 0x19, 0xEC, 0xB3, 0x98, 0xC6, 0x36, 0xB7, 0xFC, 0x21, 0xEE, 0x94, 0xC3,
-    0x32, 0xC0, 0x38, 0xBF, 0x33, 0x78, 0x7B, 0x69, 0x79, 0x00, 0xC3, 0xCE, 0x6B, 0x89, 0xAB, 0x22,
-    0xCC, 0x09, 0xDA, 0xC6, 0x84, 0x31, 0x15, 0xDB, 0x4A, 0xAE, 0xC3, 0x70, 0x1B, 0xEA, 0x65, 0xDC,
-    0x8F, 0x0D, 0x96, 0x30, 0x43, 0xCC, 0x67, 0x4A, 0x24, 0x2E, 0xF3, 0x30, 0xA3, 0xD3, 0xA8, 0xE8,
-    0x81, 0x2B, 0xAC, 0xD0, 0x8C, 0x69, 0x82, 0x62, 0x09, 0x1D, 0x70, 0x60, 0x1A, 0xC0, 0xB5, 0x46,
-    0x49, 0xE6, 0xBE, 0x72, 0x90, 0xB4, 0xAD, 0x0B, 0xFC, 0x7B, 0x74, 0x7A, 0x58, 0x9F, 0x94, 0xC6,
-    0x2C, 0x62, 0x62, 0x52, 0x21, 0x5D, 0x23, 0xDB, 0x2F, 0x2A, 0x64, 0x83, 0x79, 0xFF, 0xFD, 0x48,
-    0x25, 0x2B, 0x52, 0xFF, 0x14, 0x5A, 0xE0, 0x80, 0x7B, 0xDB, 0xCD, 0xBC, 0x5B, 0x43, 0x48, 0x51,
-    0xE1, 0x6C, 0xEF, 0x96, 0xAB, 0xEB, 0x80, 0xB9, 0x18, 0x82, 0x96, 0x24, 0x00, 0x31, 0x90, 0x18,
-    0x8C, 0x18, 0x68, 0x84, 0xD9, 0x81, 0x15, 0x6E, 0x6B, 0xA7, 0xA9, 0x21, 0x59, 0x86, 0x29, 0x4B,
-    0x74, 0xBD, 0x80, 0x4B, 0xF7, 0x92, 0x18, 0x98, 0xFE, 0xBA, 0x11, 0x6B, 0x37, 0x68, 0xD4, 0xF2,
-    0x69, 0x78, 0xFA, 0xE8, 0x55, 0xF5, 0xA9, 0x42, 0x0D, 0x5B, 0x3D, 0xC3, 0x4A, 0x72, 0x0C, 0x29,
-    0x86, 0x01, 0xC0, 0x36, 0xBA, 0x9E, 0xCE, 0x2E, 0x2A, 0xE9, 0x2A, 0x61, 0x6B, 0xCB, 0x2F, 0x21,
-    0x1A, 0x36, 0x34, 0x18, 0x7C, 0x98, 0xE5, 0x2C, 0x32, 0x12, 0x4C, 0x9F, 0x0B, 0xB6, 0x30, 0x23,
-    0x9A, 0x78, 0xD2, 0xCE, 0x8C, 0x23, 0x94, 0x77, 0x8C, 0xC4, 0x12, 0x2E, 0x91, 0x2C, 0x72, 0x84,
-    0x97, 0xAA, 0x28, 0xE0, 0x88, 0x8A, 0x2F, 0xE4, 0x3C, 0xEE, 0xBA, 0xEC, 0x60, 0x00, 0x78, 0x83,
-    0x9C, 0xC2, 0x2A, 0xEC, 0x81, 0x8A, 0x9D, 0x2B, 0x3B, 0xA2, 0x5E, 0xA7, 0x23, 0xB1, 0xED, 0xDC,
-    0xE1, 0x41, 0x84, 0x40, 0x20, 0x7B, 0x96, 0xE8, 0x60, 0xA9, 0x20, 0xD1, 0x11, 0x26, 0x44, 0xE7,
-    0x6D, 0x8C, 0x5E, 0x5C, 0xB8, 0xE7, 0x4A, 0x37, 0x24, 0x89, 0x43, 0x62, 0xCB, 0x6F, 0x93, 0x94,
-    0x2A, 0x86, 0xBB, 0x37, 0xBA, 0x1D, 0x33, 0x94, 0x96, 0x48, 0x11, 0x07, 0xAE, 0xC6, 0x81, 0xBE,
-    0x2C, 0xC4, 0xA7, 0x8D, 0x8F, 0x83, 0xD9, 0xC1, 0x27, 0x5D, 0x47, 0x43, 0x6B, 0x3A, 0x3B, 0x78,
-    0x5D, 0x35, 0xF8, 0x56, 0x54, 0x31, 0x3E, 0xFA, 0x30, 0xBB, 0x86, 0x6A, 0xF1, 0x4C, 0xF7, 0x0D,
-    0x04, 0xD8, 0x0F, 0xDB, 0x44, 0x3A, 0x4C, 0x03, 0xCC, 0x3C, 0x06, 0x18, 0x26, 0x10, 0x02, 0x61,
-    0x20, 0x26, 0xBE, 0x8C, 0x1D, 0x5F, 0xEE, 0x43, 0xBB, 0x01, 0x53, 0x7D, 0xA8, 0x0D, 0x60, 0x10,
-    0xFC, 0x2E, 0x46, 0xAC, 0x58, 0x13, 0xAC, 0xF8, 0x4C, 0xA3, 0x5F, 0x3A, 0xBC, 0x5D, 0x87, 0x0A,
-    0x62, 0x05, 0xFB, 0xA8, 0xAB, 0xC2, 0x8A, 0xAB, 0x9E, 0x3D, 0xFC, 0xB3, 0x4A, 0xEF, 0x1A, 0x63,
-    0x72, 0xD2, 0x45, 0x78, 0x17, 0x5D, 0xD4, 0xBB, 0xA9, 0x94, 0xFA, 0x18, 0x9F, 0xA2, 0x2C, 0xF8,
-    0x43, 0x62, 0x30, 0x4A, 0x6C, 0x6E, 0x6E, 0x5E, 0x86, 0xE3, 0x0B, 0xBB, 0x4C, 0x51, 0x7C, 0xE2,
-    0x53, 0x5A, 0xFA, 0x9D, 0x66, 0x57, 0x26, 0x0D, 0xE9, 0x4D, 0x1A, 0x52, 0x2F, 0x51, 0x58, 0x4B,
-    0x7D, 0x65, 0x5B, 0x3D, 0x7D, 0xF9, 0x80, 0x3D, 0x84, 0xC8, 0x33, 0x25, 0x78, 0x11, 0xB6, 0x8F,
-    0x93, 0x80, 0xEB, 0xC3, 0xC2, 0x89, 0x97, 0x69, 0xDD, 0xE4, 0x50, 0xAC, 0xD6, 0x5F, 0x2C, 0x3A,
-    0x99, 0xDB, 0xFA, 0x15, 0xCD, 0xB3, 0xB6, 0x9F, 0xA7, 0xD5, 0x3F, 0x99, 0x77, 0xF2, 0x39, 0x02,
-    0x13, 0x48, 0x72, 0xB2, 0xD4, 0x0C, 0xF5, 0x77, 0xFA, 0xFF, 0x30, 0x35, 0x89, 0x15, 0x24, 0x0B,
-    0x17, 0x49, 0xB4, 0xE6, 0x8C, 0xA2, 0x42, 0x62, 0x71, 0xA8, 0xDB, 0x88, 0xD4, 0xE3, 0x4A, 0x63,
-    0x02, 0xB0, 0x8F, 0x55, 0x6E, 0xD8, 0x2C, 0xB2, 0x2A, 0x2D, 0x80, 0xC1, 0x22, 0x22, 0xE0, 0x3C,
-    0xB6, 0xC8, 0xFA, 0xE6, 0x2F, 0xB0, 0x76, 0x2A, 0xC2, 0xC4, 0x75, 0xC9, 0xDE, 0x59, 0x8E, 0x89,
-    0x1B, 0x1D, 0x64, 0x76, 0xC5, 0x08, 0xD7, 0x76, 0x67, 0xE0, 0x75, 0xC4, 0xD3, 0x85, 0x07, 0x87,
-    0xA9, 0x9B, 0xB2, 0x84, 0x8E, 0x99, 0x3A, 0x88, 0x92, 0x72, 0xEE, 0xD6, 0x11, 0x6E, 0xD7, 0xE6,
-    0x2C, 0xC4, 0x88, 0x1C, 0x60, 0x08, 0xC2, 0x99, 0x94, 0xA6, 0xBA, 0xFA, 0xDF, 0xAE, 0x5E, 0xE3,
-    0x7B, 0xAA, 0xB7, 0xF5, 0x0D, 0x42, 0xEE, 0x81, 0xE7, 0xBB, 0xF8, 0x71, 0x7C, 0x9B, 0xE3, 0x54,
-    0x33, 0xAF, 0x8A, 0xCE, 0x3B, 0xEA, 0xD9, 0xE8, 0x40, 0xA5, 0xAD, 0xA2, 0xB4, 0x60, 0xA6, 0x2A,
-    0xDC, 0x67, 0xE1, 0xD0, 0x9E, 0x18, 0xB4, 0x62, 0x68, 0x78, 0x3F, 0x31, 0x1F, 0xA5, 0xD2, 0xBD,
-    0xF9, 0x30, 0x96, 0x43, 0xDB, 0xDF, 0x08, 0xCB, 0x9A, 0x4A, 0x6C, 0xBE, 0x4F, 0x63, 0xEB, 0x2F,
-    0x6E, 0xEC, 0xF9, 0x1A, 0x5A, 0xAF, 0xA2, 0xD3, 0x47, 0x5F, 0xF7, 0xDE, 0x8F, 0x31, 0x9B, 0xDB,
-    0xDB, 0xD8, 0xE3, 0x98, 0x17, 0xEB, 0x3D, 0x1F, 0x68, 0x9E, 0x52, 0x76, 0x0C, 0xBC, 0xFF, 0x85,
-    0xDA, 0x89, 0x30, 0x8F, 0xF5, 0x2C, 0xD9, 0x95, 0xD6, 0x28, 0xEE, 0x60, 0x47, 0x75, 0x34, 0xA3,
-    0xCE, 0xFA, 0xB7, 0xC0, 0xCB, 0x02, 0xB9, 0x25, 0x41, 0x93, 0x4F, 0xA2, 0xFB, 0xC8, 0x87, 0x99,
-    0x57, 0x6E, 0xF8, 0x81, 0xB4, 0x99, 0xFA, 0x3A, 0x59, 0x77, 0x94, 0x88, 0x9F, 0x4B, 0xC2, 0xB0,
-    0xA8, 0x53, 0xDA, 0xDE, 0x2E, 0x7A, 0x44, 0x6F, 0x2E, 0x16, 0x1D, 0x69, 0xE4, 0x2A, 0x5C, 0xB5,
-    0x33, 0x2A, 0xD4, 0xD8, 0x33, 0x3F, 0x54, 0x49, 0x1D, 0x14, 0x6F, 0x20, 0xAB, 0x23, 0x79, 0x14,
-    0x4A, 0xA8, 0x5F, 0x9E, 0xC4, 0x71, 0x0F, 0xEA, 0x54, 0x3D, 0x4D, 0xCC, 0x8F, 0x54, 0x6C, 0x61,
-    0x8A, 0xB4, 0x08, 0x59, 0x02, 0x3B, 0x6D, 0x23, 0x74, 0xEE, 0x28, 0x51, 0x37, 0x14, 0xAA, 0x96,
-    0x73, 0xFD, 0x59, 0x43, 0xB0, 0xA7, 0xDE, 0x06, 0xC2, 0xDC, 0x51, 0xCA, 0xDF, 0x46, 0xCA, 0xF2,
-    0xBB, 0x85, 0x91, 0x19, 0xD8, 0x37, 0xE5, 0xB5, 0x27, 0xEB, 0x90, 0x30, 0xE1, 0x80, 0x97, 0x50,
-    0x24, 0xAF, 0x6C, 0x32, 0xBC, 0xD3, 0x80, 0x4D, 0x98, 0x7E, 0xB3, 0x95, 0x2B, 0x56, 0x5A, 0xBA,
-    0x35, 0xF4, 0x30, 0x57, 0xEF, 0x43, 0x05, 0x60, 0x6E, 0xBE, 0xAF, 0x51, 0x29, 0xF4, 0x0D, 0x86,
-    0xAF, 0x6F, 0x78, 0x01, 0x25, 0x4B, 0x50, 0x7E, 0x19, 0x87, 0xD6, 0x54, 0x4B, 0xEF, 0xAE, 0x5C,
-    0x69, 0xE9, 0x78, 0xA7, 0x2A, 0xAD, 0xBA, 0x36, 0x52, 0x69, 0x2D, 0xE1, 0x70, 0xA6, 0x32, 0xB1,
-    0xB9, 0x94, 0x6B, 0x9E, 0x01, 0x3D, 0x54, 0x31, 0x7C, 0xAE, 0xEF, 0x63, 0x9B, 0xE4, 0x67, 0xF0,
-    0x16, 0x87, 0x89, 0x3F, 0x5C, 0xB0, 0x5C, 0x04, 0x01, 0xFF, 0x1D, 0xBE, 0x19, 0x2E, 0xA7, 0x11,
-    0xCB, 0x8C, 0x8C, 0x1D, 0xAA, 0x9B, 0x21, 0x7A, 0x69, 0xDC, 0x73, 0x76, 0xC2, 0x3A, 0x15, 0x6E,
-    0xCE, 0x8D, 0x6F, 0x80, 0xA3, 0x2E, 0x2A, 0x65, 0xFB, 0x9D, 0x01, 0xBC, 0x73, 0x31, 0x6A, 0xD8,
-    0x02, 0x02, 0x20, 0x79, 0xCB, 0x94, 0xCB, 0xDB, 0x03, 0x57, 0x5A, 0xB1, 0x13, 0x07, 0xB2, 0x5E,
-    0xD3, 0xC1, 0x1A, 0xFF, 0x0E, 0xAE, 0x44, 0x1E, 0x28, 0x84, 0xDC, 0x2C, 0x37, 0x22, 0x76, 0x64,
-    0x8C, 0x8D, 0x34, 0xF8, 0xEB, 0x93, 0x65, 0x7D, 0xF4, 0xE2, 0x81, 0x31, 0x64, 0x47, 0x34, 0x31,
-    0x32, 0x1B, 0xD9, 0xF6, 0x2B, 0x11, 0x8C, 0x3E, 0xB8, 0x19, 0x9D, 0xB7, 0x96, 0x21, 0xAE, 0xBC,
-    0x60, 0x8A, 0xD4, 0xA2, 0x0F, 0x3E, 0xFD, 0x12, 0x6B, 0x3E, 0xA1, 0x71, 0x3C, 0x5B, 0x12, 0xDA,
-    0xFE, 0x58, 0xC9, 0x73, 0x87, 0x34, 0xA3, 0x5F, 0x89, 0x25, 0xDF, 0x44, 0x8E, 0x47, 0xF4, 0xBC,
-    0x77, 0x5D, 0xDA, 0x75, 0x1A, 0x56, 0x62, 0x8B, 0xFF, 0x29, 0xF2, 0xE8, 0x48, 0xA9, 0xB1, 0x91,
-    0x39, 0xD1, 0x3C, 0xD4, 0x71, 0xCB, 0x81, 0x54, 0x29, 0xDC, 0xC5, 0x33, 0x6A, 0x77, 0x3E, 0xDF,
-    0xE9, 0xE5, 0x75, 0xFD, 0x6D, 0x24, 0x8E, 0xAE, 0xB2, 0x15, 0x59, 0xBA, 0x9F, 0x03, 0xA4, 0xD2,
-    0x2E, 0x5C, 0xCB, 0xF2, 0x96, 0x52, 0x28, 0x39, 0x87, 0x26, 0xB4, 0xDA, 0xE9, 0xDB, 0x18, 0x65,
-    0x41, 0xED, 0xF3, 0x39, 0x1D, 0x10, 0x69, 0x6B, 0xC2, 0x30, 0x63, 0x53, 0x53, 0x86, 0x87, 0x34,
-    0xDD, 0x85, 0x73, 0xA8, 0x1A, 0x14, 0x94, 0x8A, 0x9D, 0x3F, 0xD6, 0x84, 0x73, 0xBA, 0xA7, 0xD7,
-    0x69, 0xA4, 0xEB, 0x6E, 0xD4, 0x7F, 0x5B, 0x34, 0x01, 0xE3, 0xF4, 0xBB, 0x64, 0x70, 0xFA, 0x37,
-    0x39, 0x7A, 0x3C, 0x75, 0x84, 0x1D, 0x21, 0xD0, 0xD4, 0xF8, 0xB7, 0x57, 0xC2, 0x0E, 0xCC, 0xA0,
-    0x46, 0xB8, 0x86, 0x3E, 0x03, 0xE5, 0xC3, 0xB7, 0x2E, 0x94, 0x3D, 0x81, 0xC2, 0x2D, 0xC7, 0x72,
-    0xF4, 0xEE, 0x28, 0x9F, 0xA2, 0x67, 0x12, 0x08, 0x57, 0xEB, 0xBA, 0x3B, 0x05, 0xA3, 0x39, 0x39,
-    0xC7, 0xAE, 0x15, 0x4B, 0x8A, 0x95, 0xD4, 0xD7, 0x4E, 0x37, 0x5F, 0x8B, 0x83, 0x82, 0xAC, 0x8B,
-    0x41, 0x16, 0xEF, 0x0A, 0x72, 0x33, 0xF8, 0xB1, 0x9B, 0x06, 0xEF, 0xFC, 0x6D, 0x91, 0xED, 0x88,
-    0x5A, 0x95, 0x5D, 0xE2, 0xFD, 0xA6, 0x45, 0xDF, 0x8D, 0xEC, 0x5F, 0xA1, 0xD8, 0x1C, 0xAE, 0x96,
-    0xAA, 0xAB, 0x41, 0x74, 0x17, 0xFF, 0x89, 0xB5, 0x5E, 0xB7, 0x71, 0xD9, 0x2A, 0x16, 0x9F, 0x41,
-    0x7F, 0x0E, 0xC2, 0x17, 0x89, 0x58, 0x45, 0x0B, 0x0D, 0xF2, 0xFC, 0x7A, 0x58, 0x8D, 0xE6, 0xAA,
-    0xF4, 0xF7, 0xF0, 0x88, 0xF7, 0x0F, 0xEF, 0x9A, 0x11, 0xF6, 0x28, 0x0F, 0x57, 0x17, 0xE8, 0x0D,
-    0x51, 0xAD, 0x31, 0xCA, 0xFB, 0xD5, 0x45, 0xFA, 0xEB, 0x50, 0xDB, 0xBB, 0xCC, 0x3E, 0x7B, 0x19,
-    0x6A, 0x08, 0xDB, 0x26, 0xBC, 0x0D, 0x6B, 0x65, 0xD4, 0x44, 0x46, 0x9C, 0x03, 0x08, 0xA7, 0x17,
-    0xD8, 0xBF, 0xEE, 0x87, 0xAD, 0x3A, 0xDD, 0xE0, 0xCD, 0xA6, 0xC9, 0x48, 0x54, 0x7B, 0x93, 0xA4,
-    0xBE, 0xC1, 0x89, 0x40, 0xC7, 0xB5, 0xC6, 0xDC, 0xE7, 0x1B, 0xE2, 0x71, 0x58, 0xED, 0x97, 0x6A,
-    0xAC, 0x64, 0x3C, 0x84, 0xC7, 0x7E, 0x15, 0xA6, 0x09, 0xAF, 0x7C, 0xF6, 0x4B, 0x31, 0x38, 0xCF,
-    0xA8, 0xE8, 0x2F, 0x94, 0xA8, 0xDF, 0x6F, 0x96, 0xD0, 0x61, 0xB3, 0x34, 0x67, 0x88, 0xE6, 0x8F,
-    0x7E, 0x40, 0x7C, 0x32, 0xC5, 0xDA, 0xA6, 0x6F, 0x41, 0x09, 0x8F, 0xA2, 0xD5, 0xDC, 0x29, 0xC0,
-    0x8B, 0x70, 0x68, 0xFE, 0xA3, 0x04, 0x4D, 0x43, 0xCC, 0xE1, 0x3C, 0xC2, 0xE3, 0xA0, 0x4C, 0x16,
-    0x8C, 0x11, 0x84, 0x61, 0x54, 0x6D, 0xCE, 0xD5, 0x8C, 0x3F, 0xE2, 0xD9, 0xB1, 0xA8, 0x33, 0x58,
-    0x36, 0x29, 0x2F, 0xD5, 0x00, 0xB1, 0xD3, 0xD2, 0x87, 0x48, 0x2D, 0xA4, 0x0F, 0xC4, 0x32, 0xE5,
-    0xFF, 0x01, 0xED, 0x7D, 0x4F, 0xAC, 0xDD, 0xD6, 0x79, 0xE7, 0xE1, 0xA5, 0x25, 0x36, 0x26, 0x66,
-    0xE8, 0x85, 0x94, 0xE9, 0xC4, 0x28, 0xD8, 0x45, 0x81, 0x09, 0xDC, 0x69, 0xB8, 0xE9, 0xA2, 0x18,
-    0xD4, 0x22, 0x6D, 0x2F, 0xB2, 0xC8, 0xC2, 0x5A, 0xF8, 0xD9, 0x18, 0x68, 0xA1, 0x59, 0xCC, 0x00,
-    0x85, 0x0B, 0xF4, 0xCD, 0x22, 0x8B, 0x01, 0x26, 0x7E, 0xBC, 0x49, 0x16, 0x59, 0x64, 0x61, 0x2D,
-    0xA2, 0x16, 0x98, 0x4D, 0x82, 0x81, 0x0B, 0xD4, 0x4F, 0x18, 0xA8, 0x8B, 0x2E, 0x0A, 0x44, 0xEF,
-    0x92, 0x89, 0x81, 0xF1, 0xC2, 0x8B, 0x30, 0xF6, 0x38, 0x06, 0x26, 0x0B, 0x33, 0x89, 0xD5, 0x4C,
-    0x65, 0x0C, 0x44, 0xC7, 0x54, 0xC3, 0x27, 0x91, 0x3C, 0xF3, 0xFD, 0x7E, 0xDF, 0x21, 0xEF, 0x9F,
-    0xF7, 0xA4, 0xD8, 0x8D, 0xE3, 0xDA, 0xE8, 0x3C, 0xCB, 0x57, 0x7A, 0x97, 0xF7, 0x92, 0xE7, 0x7C,
-    0xE7, 0x3B, 0xDF, 0xDF, 0xDF, 0xF7, 0x1D, 0x63, 0x3E, 0xB7, 0x34, 0xC6, 0x44, 0xB5, 0xBC, 0xF8,
-    0x8D, 0xBC, 0x78, 0x9D, 0xBC, 0x98, 0x1B, 0x78, 0xB9, 0x80, 0x97, 0x87, 0xCC, 0xC6, 0x4F, 0x64,
-    0xED, 0x60, 0x62, 0x6B, 0x7B, 0x93, 0xE0, 0x25, 0xC5, 0x57, 0xD3, 0x0C, 0x2F, 0xB8, 0x9A, 0xE3,
-    0x65, 0x85, 0x97, 0x11, 0x2F, 0x03, 0x5E, 0x7A, 0xDC, 0x72, 0xD8, 0xDB, 0x33, 0x0B, 0x6B, 0xAD,
-    0xF1, 0xF9, 0x72, 0x2C, 0xBF, 0x06, 0x78, 0x56, 0xC8, 0x17, 0x3C, 0x3A, 0xAA, 0xF0, 0x52, 0xCA,
-    0x4B, 0x8C, 0x97, 0x04, 0x2F, 0x1B, 0x77, 0xB7, 0xB6, 0x35, 0xB9, 0xB5, 0x8D, 0x29, 0xF0, 0x62,
-    0xCC, 0xC3, 0xE6, 0x3B, 0xF2, 0xEE, 0x93, 0xAD, 0xBC, 0x3C, 0x85, 0x17, 0x8C, 0xFC, 0x21, 0x93,
-    0x7D, 0xE2, 0x46, 0x2A, 0xCF, 0xB6, 0x4D, 0x3A, 0xBF, 0x9C, 0xB8, 0x4D, 0x35, 0xDD, 0x46, 0xEF,
-    0xC5, 0xDB, 0x3C, 0x91, 0xF1, 0x36, 0x19, 0x6E, 0x53, 0x9B, 0xE2, 0x6E, 0xD1, 0xC9, 0x20, 0x83,
-    0x5E, 0x06, 0xE9, 0x8D, 0x18, 0xA4, 0xF5, 0xE4, 0xA5, 0x58, 0xC8, 0x32, 0x15, 0x7E, 0xEB, 0x5E,
-    0x46, 0x0C, 0x72, 0x90, 0x17, 0xBF, 0x97, 0xBB, 0x87, 0x6D, 0x54, 0xFD, 0xBB, 0xA2, 0x89, 0xCA,
-    0xD4, 0x96, 0x71, 0x99, 0x62, 0x76, 0x67, 0x48, 0x1B, 0xEF, 0x65, 0x79, 0x09, 0xBA, 0x69, 0xBD,
-    0x39, 0xE2, 0x23, 0xBC, 0xDF, 0xE2, 0x6A, 0xB6, 0xB3, 0xD2, 0xFD, 0x4C, 0xBF, 0xEE, 0x03, 0xD3,
-    0x0F, 0x2F, 0x18, 0x9A, 0xC1, 0xA8, 0xF4, 0xE5, 0xC3, 0xD1, 0x6F, 0xFB, 0xEE, 0xD3, 0x4F, 0x21,
-    0x94, 0x00, 0x45, 0x4B, 0x21, 0x4A, 0x21, 0x43, 0xEA, 0x4C, 0x90, 0x05, 0x78, 0x96, 0xB1, 0x78,
-    0x49, 0x71, 0x93, 0xA0, 0x9D, 0x7F, 0xE7, 0x33, 0x16, 0xBC, 0x9E, 0xBE, 0x29, 0x4B, 0xE8, 0x93,
-    0xF8, 0x58, 0x02, 0x13, 0xDC, 0x3D, 0x3C, 0xBC, 0x62, 0x0A, 0x33, 0x8D, 0x49, 0xFF, 0xC9, 0x31,
-    0x9A, 0x1C, 0x23, 0xF0, 0xBB, 0xF9, 0x8E, 0x9E, 0xDE, 0x4C, 0x08, 0x9F, 0x99, 0x74, 0xBC, 0xD6,
-    0x72, 0x08, 0x99, 0xBC, 0x8D, 0xD1, 0x98, 0xF3, 0x6B, 0x7A, 0xED, 0xDB, 0x0A, 0xCF, 0x18, 0x84,
-    0x6A, 0x32, 0xBA, 0xB4, 0x36, 0xFF, 0x45, 0xEF, 0x65, 0xB7, 0x29, 0x34, 0xCE, 0x03, 0xCC, 0x39,
-    0xF5, 0x96, 0x74, 0xC6, 0x50, 0x2D, 0x06, 0x9C, 0xE3, 0xC9, 0xE1, 0x30, 0x3F, 0x38, 0x5F, 0xCE,
-    0xA4, 0x59, 0x6E, 0x11, 0xC9, 0x9A, 0x2F, 0x1B, 0x7F, 0x34, 0xF9, 0x2D, 0x79, 0x18, 0x99, 0x24,
-    0xB6, 0x63, 0xE6, 0x06, 0x14, 0x95, 0xB2, 0x06, 0x49, 0x29, 0xB3, 0x48, 0x33, 0xD9, 0x15, 0x39,
-    0x66, 0x39, 0x0A, 0x41, 0xE4, 0xDD, 0xB8, 0x5C, 0xF0, 0xDD, 0x56, 0xDF, 0x5D, 0x81, 0x4C, 0x7C,
-    0x17, 0xDB, 0x43, 0xDE, 0x4D, 0x41, 0x06, 0x90, 0xFD, 0x77, 0x1E, 0x36, 0xD1, 0x6B, 0x75, 0xF0,
-    0x7E, 0x67, 0xBA, 0x23, 0x73, 0xEE, 0xCC, 0x34, 0xCB, 0x94, 0x4B, 0x26, 0xDF, 0x04, 0x89, 0x86,
-    0x93, 0xBF, 0xE7, 0xFA, 0x7B, 0xCD, 0x65, 0xD7, 0xDF, 0x93, 0xF9, 0xF7, 0x7E, 0xFA, 0x3D, 0xDA,
-    0xFA, 0x7D, 0xC9, 0x3B, 0x27, 0x99, 0xAE, 0x19, 0x96, 0x81, 0x2C, 0xB4, 0x72, 0x53, 0x9D, 0xDE,
-    0x5C, 0x6C, 0xBD, 0x59, 0x6E, 0xBC, 0x39, 0xEE, 0xBE, 0xD9, 0x6D, 0xBC, 0x09, 0x0E, 0x0B, 0xA7,
-    0x37, 0x07, 0xC7, 0x5E, 0xD3, 0x9B, 0x18, 0x35, 0x6E, 0xB1, 0x18, 0xB1, 0x76, 0x42, 0x55, 0xF9,
-    0x3F, 0x19, 0x36, 0x79, 0xCE, 0x92, 0xA3, 0xE4, 0x82, 0xFE, 0xC3, 0xB3, 0x2A, 0x7C, 0x70, 0x3B,
-    0xE5, 0x1D, 0x99, 0x08, 0x79, 0x1A, 0x92, 0x93, 0x3C, 0x87, 0x21, 0xE8, 0x3F, 0xE4, 0x7D, 0xF2,
-    0x37, 0x7E, 0x4D, 0xF4, 0x1F, 0xA5, 0x9B, 0x6E, 0xBC, 0x34, 0xE9, 0x55, 0x37, 0xED, 0xD4, 0x1E,
-    0xEB, 0xB0, 0x64, 0x1D, 0x97, 0x24, 0x49, 0x71, 0x08, 0xEE, 0x5A, 0x61, 0x12, 0x71, 0xC3, 0x51,
-    0x0F, 0x1C, 0x6A, 0x8F, 0x3F, 0x7E, 0x0F, 0xFA, 0xC8, 0x1F, 0x19, 0xB8, 0x8C, 0x02, 0x7F, 0x7A,
-    0x8C, 0x42, 0x3E, 0x20, 0x7F, 0xB0, 0xFF, 0x5B, 0x37, 0xA8, 0x80, 0xC2, 0x46, 0x86, 0x20, 0xFF,
-    0x88, 0x6B, 0xF0, 0x73, 0x58, 0x7B, 0x45, 0x99, 0x5B, 0x6E, 0x6D, 0x6B, 0xF2, 0x81, 0xFF, 0xE8,
-    0x4C, 0x2E, 0x73, 0x53, 0xFE, 0x59, 0xEF, 0xFD, 0x52, 0x77, 0xB3, 0x7C, 0x9B, 0xAB, 0x91, 0xB8,
-    0xBF, 0x85, 0x03, 0x49, 0x49, 0x21, 0x2D, 0x77, 0x76, 0xEA, 0x54, 0x46, 0xEE, 0x36, 0x50, 0xE1,
-    0xF6, 0xD4, 0xE8, 0xE4, 0xCB, 0xE0, 0x76, 0x62, 0xAF, 0xB7, 0x04, 0xFD, 0xAC, 0xCC, 0x77, 0xC1,
-    0xBF, 0x6D, 0xE9, 0xEB, 0xDF, 0x0D, 0xEE, 0x91, 0x66, 0x71, 0x8F, 0x7B, 0xA4, 0x90, 0x60, 0x0D,
-    0x6F, 0x39, 0x84, 0x8E, 0x0E, 0xB8, 0xC7, 0x80, 0xBF, 0x4B, 0x25, 0x87, 0x0E, 0xCB, 0xEB, 0x65,
-    0x58, 0x98, 0x7D, 0xAF, 0xC3, 0x0A, 0x5B, 0x1D, 0x56, 0x5E, 0x63, 0x58, 0x72, 0xDF, 0x25, 0x86,
-    0x85, 0x4D, 0x29, 0xF7, 0x08, 0xAD, 0xBD, 0xA2, 0xC2, 0x18, 0x93, 0xEF, 0xF9, 0x64, 0x27, 0x7B,
-    0xB8, 0x80, 0x9C, 0x8E, 0x6E, 0x52, 0x0A, 0x9F, 0x78, 0xE3, 0xCA, 0x43, 0x64, 0x81, 0xD1, 0xA8,
-    0x58, 0x4F, 0xC6, 0xEB, 0x16, 0xB3, 0x4B, 0x6A, 0x90, 0xBA, 0xC7, 0xDC, 0x0A, 0xE5, 0x6C, 0x59,
-    0xDC, 0xB0, 0x96, 0xB1, 0xFA, 0x2D, 0xF9, 0x1F, 0x14, 0x4B, 0x75, 0x4F, 0x6C, 0x5C, 0x91, 0xA9,
-    0xF5, 0x5E, 0xEF, 0x9E, 0xA2, 0xAA, 0x57, 0xF7, 0xB9, 0x3E, 0x5C, 0xC7, 0x11, 0x92, 0x83, 0xE2,
-    0xEC, 0x84, 0xFA, 0xD5, 0xB5, 0x91, 0xC9, 0xCA, 0xF8, 0xA2, 0x06, 0xE3, 0x97, 0x3F, 0x32, 0xFD,
-    0x42, 0x18, 0x29, 0xF3, 0xB8, 0x25, 0x21, 0xDD, 0x73, 0x92, 0x7F, 0x45, 0x21, 0x36, 0x52, 0xE0,
-    0x0C, 0x60, 0x74, 0x8F, 0x94, 0xF5, 0x86, 0xFD, 0x0A, 0x12, 0x47, 0x04, 0x99, 0xF2, 0xBD, 0x68,
-    0x39, 0x8C, 0x20, 0x68, 0x74, 0x63, 0x80, 0xDA, 0x61, 0x8D, 0x4F, 0x46, 0x15, 0x56, 0x24, 0x82,
-    0x2C, 0x91, 0x07, 0x62, 0xD4, 0xF2, 0xB4, 0x81, 0x6C, 0x50, 0x90, 0x09, 0xF0, 0x87, 0xBF, 0xEA,
-    0xCE, 0x5F, 0xB9, 0x65, 0x37, 0xCF, 0x9B, 0x59, 0x08, 0x2B, 0xE3, 0xE8, 0x0E, 0x77, 0xDC, 0x62,
-    0xCC, 0xE3, 0x7C, 0xF5, 0x76, 0x66, 0x86, 0x8B, 0x51, 0x8D, 0xCF, 0x47, 0x1D, 0x59, 0x69, 0xC0,
-    0xAD, 0x03, 0x9B, 0x81, 0x72, 0xC2, 0x2D, 0xC2, 0xDC, 0xF7, 0x1A, 0xB0, 0xFE, 0x5D, 0x5C, 0xF6,
-    0x7A, 0x5E, 0xEE, 0x53, 0x3C, 0x47, 0x58, 0x02, 0xA2, 0x2B, 0xC4, 0xE5, 0x5C, 0x86, 0x2B, 0x53,
-    0x37, 0xB8, 0x9C, 0x66, 0xB8, 0x9C, 0x2C, 0x71, 0x39, 0x29, 0xC3, 0x7A, 0xD1, 0xC7, 0xA5, 0x90,
-    0x78, 0x85, 0xAF, 0x98, 0xF4, 0xE9, 0x1A, 0x94, 0x7A, 0x4D, 0xD6, 0xB2, 0x0C, 0x7E, 0x29, 0xDB,
-    0xA5, 0x5E, 0xDC, 0xE3, 0x06, 0xB2, 0x14, 0x4F, 0xA9, 0x12, 0x92, 0xB3, 0x86, 0xAA, 0x89, 0xEA,
-    0xC5, 0xE0, 0x16, 0xE8, 0x5F, 0x9B, 0x87, 0x29, 0x71, 0x02, 0x99, 0xED, 0xA2, 0x25, 0xEB, 0xE7,
-    0x14, 0x11, 0x81, 0x0A, 0x8A, 0xCF, 0x5E, 0xDC, 0x99, 0x9A, 0x4A, 0x2F, 0x48, 0xA4, 0x3C, 0x03,
-    0x57, 0xA5, 0x4B, 0x47, 0xCD, 0x94, 0x24, 0x93, 0xE1, 0x08, 0xBD, 0x65, 0x59, 0xA1, 0xC2, 0x72,
-    0xEE, 0x76, 0x0A, 0x6C, 0xFC, 0x6B, 0x24, 0x4B, 0x16, 0x5C, 0x79, 0xDC, 0xC0, 0x6F, 0xC9, 0xB5,
-    0x2B, 0xD5, 0xA0, 0xDF, 0x24, 0x8B, 0xBE, 0x4F, 0xB2, 0x8E, 0x7C, 0x76, 0x42, 0x7A, 0xAB, 0x6E,
-    0x54, 0x85, 0xA3, 0x1A, 0x07, 0x3C, 0x32, 0xF3, 0x5A, 0x81, 0x2F, 0x7F, 0xD7, 0x52, 0x09, 0xF1,
-    0x35, 0xB4, 0xBC, 0xFA, 0xCC, 0x7A, 0xFF, 0x1F, 0x70, 0x0F, 0xAC, 0xB8, 0x47, 0x48, 0x69, 0xBC,
-    0x66, 0x58, 0xCE, 0x94, 0x8B, 0x9A, 0x53, 0x0C, 0x16, 0xA4, 0xC8, 0xC8, 0xC5, 0x1B, 0x28, 0x05,
-    0x7A, 0xF0, 0x10, 0xC6, 0x2E, 0xE4, 0xE4, 0x3C, 0x40, 0xB1, 0x08, 0x54, 0x37, 0x5C, 0x24, 0x91,
-    0x81, 0xE0, 0xAD, 0x74, 0x49, 0x3A, 0x60, 0x6D, 0xE5, 0x86, 0x78, 0x60, 0x7E, 0xFF, 0x07, 0x62,
-    0xCB, 0x62, 0xF7, 0x89, 0xB4, 0x2A, 0x54, 0x18, 0x2B, 0x57, 0x51, 0x18, 0xC9, 0x0A, 0xAC, 0x59,
-    0x4B, 0x5F, 0x83, 0x5A, 0xE7, 0xA1, 0x16, 0x40, 0xCC, 0xF7, 0x38, 0xCD, 0x80, 0xD3, 0x4C, 0x69,
-    0xF2, 0x1C, 0xD3, 0x0C, 0x7A, 0x15, 0x1F, 0x2D, 0xF0, 0x7C, 0xBF, 0x4D, 0x29, 0xEA, 0xF0, 0x9D,
-    0x1E, 0xF7, 0xE1, 0x96, 0x95, 0x61, 0x41, 0xAC, 0x80, 0xA5, 0x54, 0x7F, 0x1A, 0xBB, 0x77, 0xA9,
-    0x81, 0x5C, 0x91, 0x1B, 0xD2, 0xA0, 0x58, 0x8C, 0x87, 0x87, 0xBD, 0xE1, 0xEE, 0x06, 0x39, 0x74,
-    0xC2, 0xC9, 0x32, 0xE1, 0x64, 0x06, 0x0C, 0x55, 0x76, 0xAA, 0x50, 0x06, 0x06, 0x41, 0xFC, 0x4A,
-    0xAF, 0x62, 0x93, 0x22, 0x98, 0x37, 0x81, 0x30, 0xAC, 0x75, 0xA1, 0xD2, 0x6C, 0xB2, 0x8C, 0xC8,
-    0x52, 0x3A, 0xBB, 0x61, 0xE7, 0x0A, 0xF6, 0xED, 0x02, 0x52, 0x0D, 0x6A, 0xA9, 0x92, 0x2B, 0x21,
-    0x54, 0x38, 0xF8, 0xAA, 0x01, 0x8B, 0x52, 0x21, 0x0C, 0xE4, 0x36, 0x10, 0x19, 0x72, 0xA2, 0x82,
-    0x45, 0xD8, 0x40, 0x3D, 0x74, 0x72, 0x25, 0x26, 0x3D, 0x69, 0xDA, 0x75, 0x2A, 0x16, 0x31, 0x9A,
-    0xBF, 0xE7, 0x9D, 0x3B, 0x8A, 0xE6, 0x52, 0x46, 0xB3, 0xDF, 0xE3, 0x99, 0x16, 0xCF, 0x8C, 0x2B,
-    0xAA, 0x95, 0x05, 0x75, 0xFC, 0xE8, 0x08, 0x92, 0x2E, 0xA1, 0xCD, 0xCA, 0xE0, 0xCE, 0x5E, 0xC1,
-    0x19, 0x64, 0x2A, 0x21, 0xD3, 0xAB, 0xFB, 0x2D, 0x47, 0x83, 0x35, 0x0E, 0x1A, 0xFD, 0x0E, 0x25,
-    0x06, 0x19, 0x5D, 0xAE, 0xF8, 0xAD, 0x8C, 0x66, 0xD1, 0xCB, 0x68, 0xC4, 0xC6, 0x19, 0xE4, 0x79,
-    0x24, 0x62, 0x16, 0xE3, 0xEB, 0x32, 0x9A, 0x77, 0x3E, 0x49, 0x96, 0xA7, 0x4F, 0x0A, 0x53, 0xEE,
-    0x0F, 0x3A, 0x2E, 0x32, 0xD1, 0xA0, 0x7C, 0x15, 0xAB, 0x3A, 0x97, 0x47, 0xAA, 0x2E, 0xA4, 0x38,
-    0x04, 0x03, 0x06, 0x4E, 0x25, 0xE6, 0xFA, 0xDC, 0xD0, 0x69, 0xC2, 0x41, 0x1F, 0x4E, 0x45, 0xD8,
-    0x39, 0x7D, 0x9A, 0x71, 0x10, 0xBE, 0x5A, 0x50, 0xF8, 0x02, 0x2D, 0x99, 0x9A, 0x6C, 0x3C, 0x69,
-    0x09, 0x2A, 0x0F, 0x9D, 0xCB, 0xE8, 0x74, 0x6B, 0xA5, 0x83, 0xEF, 0xD5, 0xE6, 0x85, 0x3A, 0x1C,
-    0x39, 0x90, 0x40, 0x15, 0x2A, 0x37, 0x89, 0x70, 0x55, 0xC4, 0xBF, 0xE8, 0x33, 0xE0, 0x4B, 0x9C,
-    0xB9, 0x6A, 0x1F, 0xA7, 0x94, 0xF0, 0x25, 0xD5, 0x38, 0x10, 0x94, 0x93, 0x08, 0xFE, 0x64, 0xB8,
-    0x78, 0xE2, 0x92, 0xC8, 0xC6, 0x5E, 0xD0, 0xF0, 0x81, 0x45, 0x43, 0x93, 0x52, 0xC6, 0x17, 0x57,
-    0x90, 0x4D, 0x72, 0x6B, 0x48, 0xB2, 0x14, 0x77, 0x1E, 0x49, 0x24, 0xD9, 0x77, 0x3D, 0xEF, 0x2F,
-    0xFF, 0xF1, 0x91, 0x95, 0x4C, 0x51, 0xF7, 0x52, 0x5C, 0x52, 0xF6, 0x89, 0xE4, 0xFC, 0x2A, 0xC7,
-    0xEB, 0x75, 0xE9, 0x17, 0x3B, 0x95, 0x8F, 0xC5, 0xF5, 0x7A, 0x32, 0xF1, 0x48, 0x1D, 0xE5, 0x65,
-    0x7C, 0xEB, 0x78, 0x54, 0x51, 0x19, 0xD5, 0x83, 0xDA, 0x71, 0x69, 0xD9, 0xAB, 0x46, 0xB3, 0xAA,
-    0x47, 0x85, 0x0B, 0x1C, 0xF5, 0xC2, 0x56, 0xB7, 0x87, 0xD8, 0x59, 0x3E, 0x45, 0x9F, 0x8C, 0x4D,
-    0xE5, 0xA1, 0xEC, 0x20, 0x8C, 0xD4, 0xC0, 0x50, 0x90, 0x91, 0xCA, 0x44, 0x23, 0xDA, 0x87, 0x42,
-    0xFB, 0xA4, 0xE2, 0xE6, 0x2A, 0x4D, 0xB1, 0xA4, 0x36, 0x77, 0x22, 0xCB, 0x78, 0x85, 0xD8, 0x81,
-    0x8B, 0xC9, 0xDE, 0xA8, 0xCD, 0x67, 0x4C, 0x30, 0xCC, 0x82, 0x3B, 0x6A, 0x66, 0xA9, 0xB6, 0x96,
-    0x18, 0x9C, 0xA5, 0x90, 0xC5, 0xDB, 0x2B, 0x2A, 0x7C, 0x53, 0x3E, 0x88, 0x6F, 0x9B, 0xF3, 0x7F,
-    0xCA, 0x49, 0xF2, 0xB2, 0x3A, 0x35, 0x6B, 0xD3, 0x26, 0xD8, 0xB9, 0x91, 0x35, 0xFF, 0x51, 0x36,
-    0xE4, 0x32, 0xBE, 0x7B, 0xCD, 0x96, 0xE0, 0x22, 0xD1, 0xF0, 0x7A, 0x8F, 0x8B, 0x93, 0x3E, 0x48,
-    0x97, 0x34, 0xCF, 0x6A, 0x7C, 0x29, 0xA1, 0xC8, 0x8F, 0x29, 0x9F, 0x23, 0x0A, 0x89, 0xE8, 0x36,
-    0x64, 0x7B, 0xF8, 0x2E, 0x2E, 0x07, 0xEF, 0xE3, 0xB2, 0xDF, 0xF4, 0xF4, 0x35, 0x72, 0x8A, 0x4D,
-    0x11, 0x15, 0x42, 0x19, 0xCA, 0xA7, 0x9E, 0x0A, 0x63, 0x80, 0x86, 0xCD, 0x56, 0x94, 0xFA, 0x05,
-    0x75, 0x82, 0xE8, 0xDA, 0x6A, 0xD1, 0xD1, 0x3D, 0x19, 0xA8, 0x1F, 0xD3, 0x04, 0x76, 0x46, 0xFC,
-    0x36, 0xF6, 0x59, 0x78, 0x1B, 0x82, 0xCC, 0x87, 0x9B, 0xD5, 0x18, 0xA1, 0x0A, 0x2E, 0x37, 0xB0,
-    0xBC, 0x62, 0xD5, 0x25, 0xED, 0xE4, 0xF3, 0x5D, 0x31, 0x2F, 0xC9, 0x5F, 0x9D, 0x33, 0xF6, 0x0B,
-    0xAA, 0x36, 0xAB, 0xD6, 0x3C, 0xA9, 0xFB, 0xD2, 0x49, 0x73, 0xEA, 0xD3, 0x31, 0xB5, 0x4F, 0x83,
-    0xDD, 0x57, 0x40, 0x60, 0x70, 0x33, 0xF5, 0x6A, 0xED, 0xF7, 0x2A, 0x1F, 0x3B, 0xE3, 0xFC, 0x12,
-    0x8A, 0x3A, 0x6A, 0x43, 0x72, 0x20, 0x15, 0x13, 0xA7, 0x87, 0xEF, 0x83, 0xD6, 0x15, 0xBD, 0x23,
-    0x2C, 0x8A, 0x18, 0x8C, 0x18, 0x57, 0xAA, 0x3E, 0x62, 0xAE, 0xA2, 0x62, 0xA5, 0x2C, 0xAF, 0xBE,
-    0xA7, 0x73, 0x21, 0x31, 0xBE, 0x95, 0x8A, 0x7E, 0x67, 0x9F, 0xA9, 0x21, 0xA2, 0x36, 0x08, 0x99,
-    0x3C, 0x26, 0xED, 0xE0, 0x74, 0xC3, 0x3F, 0xB0, 0x1C, 0x46, 0xAE, 0x9F, 0x82, 0xF7, 0xA3, 0xBE,
-    0x9C, 0xB2, 0x43, 0xA7, 0x7E, 0x79, 0x0E, 0x82, 0x41, 0x39, 0x97, 0xF4, 0xD0, 0xE9, 0xA4, 0xC3,
-    0xB3, 0xBF, 0x21, 0xDF, 0xBD, 0x57, 0xD3, 0xD4, 0x4A, 0xF2, 0x2C, 0xF8, 0xB9, 0x8C, 0xB7, 0x17,
-    0x41, 0x79, 0x59, 0x64, 0xF4, 0x5B, 0xB2, 0xE3, 0x2F, 0xC8, 0xC0, 0xC4, 0xC2, 0x6C, 0x20, 0xB2,
-    0xC4, 0xBD, 0x7E, 0x45, 0xC4, 0xD5, 0xD7, 0x5B, 0x73, 0x20, 0xF3, 0xE9, 0x23, 0xB0, 0x8A, 0x58,
-    0x26, 0xE0, 0x85, 0x1B, 0x26, 0x85, 0xCF, 0xED, 0xB5, 0x5E, 0x07, 0x83, 0x37, 0xA8, 0x60, 0xDA,
-    0x89, 0xB9, 0xB1, 0x3C, 0x92, 0x39, 0x25, 0xD9, 0x05, 0xBF, 0xA1, 0x21, 0xD5, 0x27, 0x59, 0x22,
-    0x82, 0x04, 0xB7, 0x13, 0x5F, 0xB0, 0x8C, 0x5E, 0x83, 0x69, 0x21, 0x06, 0x12, 0x4C, 0x33, 0x18,
-    0x1B, 0x90, 0x2C, 0xE2, 0xEE, 0xDB, 0x25, 0xDC, 0x7A, 0x98, 0x7C, 0x62, 0x34, 0x76, 0x20, 0x25,
-    0x6E, 0x26, 0xEF, 0x78, 0xBD, 0x63, 0xF0, 0x24, 0xD3, 0x05, 0x05, 0x2D, 0x02, 0x84, 0x03, 0x40,
-    0x15, 0x10, 0x72, 0x54, 0xFE, 0x9F, 0x2E, 0x77, 0xF3, 0xE5, 0x6E, 0xFB, 0xF2, 0x9D, 0xBD, 0xBD,
-    0x7D, 0xEA, 0x79, 0x91, 0xCC, 0x96, 0x76, 0x58, 0x7A, 0x78, 0x78, 0x38, 0xB8, 0x15, 0x02, 0xFD,
-    0xD4, 0x36, 0x0A, 0x29, 0xF5, 0x38, 0x1C, 0x2C, 0xC3, 0xE6, 0x65, 0x7F, 0xBE, 0xEC, 0xEF, 0x5C,
-    0xAE, 0x9D, 0x4C, 0xD2, 0x9F, 0x18, 0xDE, 0xAF, 0x47, 0x8D, 0x1B, 0xDA, 0xDB, 0x22, 0x88, 0x52,
-    0x59, 0x8D, 0x0A, 0x52, 0x32, 0x6A, 0xA0, 0xE6, 0x82, 0xD6, 0xA7, 0x61, 0x0C, 0xCD, 0xB7, 0xA0,
-    0x69, 0xE5, 0x51, 0x2E, 0xD3, 0x1D, 0x94, 0x57, 0xB0, 0x89, 0xBC, 0x66, 0xB8, 0x9A, 0xEB, 0x2B,
-    0xE5, 0x5F, 0x41, 0x0D, 0x50, 0x50, 0xF6, 0x51, 0x2C, 0x34, 0x39, 0x75, 0x12, 0x55, 0x2C, 0x2D,
-    0x6B, 0x31, 0x52, 0x4A, 0x48, 0x42, 0xF1, 0x96, 0xFD, 0x01, 0x9C, 0x10, 0x0B, 0xEB, 0xDA, 0x5B,
-    0x18, 0x8F, 0x6A, 0x85, 0x58, 0xAD, 0xFB, 0x3D, 0x17, 0x1E, 0x73, 0x16, 0x9C, 0x9A, 0x70, 0x6A,
-    0xC3, 0x21, 0x88, 0x92, 0x81, 0x31, 0xD5, 0xA0, 0xA5, 0xB9, 0x4B, 0xC2, 0x44, 0xF7, 0xBD, 0xBC,
-    0x74, 0x97, 0x87, 0x8D, 0xCB, 0x31, 0x2F, 0x87, 0xEB, 0xCB, 0xD5, 0x74, 0x99, 0xEC, 0x8E, 0xCB,
-    0x85, 0xBB, 0xEC, 0xAF, 0x2F, 0x37, 0xDB, 0x97, 0x6B, 0xDD, 0x32, 0x11, 0x6C, 0xAA, 0x00, 0xE3,
-    0xA3, 0x76, 0x96, 0x61, 0x08, 0x6F, 0xA7, 0x99, 0xF8, 0x32, 0x51, 0xA9, 0x92, 0x2F, 0x6C, 0xD4,
-    0x6A, 0x1C, 0x71, 0x91, 0xBB, 0x9B, 0x8A, 0x09, 0x91, 0x0C, 0x5C, 0x89, 0x44, 0xA6, 0xED, 0x15,
-    0x9D, 0x2A, 0xE8, 0x18, 0x37, 0x0A, 0xEF, 0xBE, 0x9C, 0x6D, 0x59, 0xA7, 0x6B, 0x8F, 0xB9, 0x99,
-    0x75, 0xCD, 0xEE, 0x95, 0xFA, 0x23, 0x0A, 0xE7, 0xAD, 0xB5, 0x19, 0x95, 0x9F, 0x0B, 0xDC, 0x7D,
-    0x88, 0x70, 0x5E, 0xF8, 0x80, 0x70, 0x1E, 0x22, 0x04, 0x7D, 0x3A, 0xBF, 0xE8, 0x2C, 0xBC, 0x1D,
-    0xF3, 0xB2, 0xFB, 0x35, 0xCD, 0xCB, 0x62, 0xCB, 0x7A, 0xF2, 0x4E, 0x31, 0x5E, 0x3F, 0x6D, 0xFE,
-    0xE2, 0x7A, 0xF3, 0xEA, 0x3E, 0x2E, 0xD4, 0x7C, 0x26, 0xE5, 0x3F, 0x5B, 0xDC, 0xCD, 0xA8, 0x84,
-    0x6D, 0x65, 0x9C, 0x04, 0x49, 0x8F, 0xC3, 0x3A, 0x6F, 0x7C, 0x30, 0x5B, 0x52, 0x25, 0x60, 0xDE,
-    0xA4, 0x1C, 0x41, 0xCD, 0xF4, 0x4B, 0xD4, 0x6D, 0xA2, 0x23, 0xA1, 0x65, 0x3B, 0x1A, 0x7E, 0x91,
-    0xC8, 0x55, 0x70, 0xEA, 0xE5, 0x12, 0xD4, 0x93, 0xCD, 0x8C, 0x50, 0xCF, 0x7B, 0x3D, 0xC5, 0xDC,
-    0xD7, 0xB1, 0x61, 0x20, 0x04, 0xC0, 0xF5, 0x75, 0x2C, 0xCA, 0x4B, 0xFC, 0x89, 0x44, 0xCC, 0xBC,
-    0x42, 0x23, 0xEF, 0xD0, 0xE4, 0x34, 0x66, 0xCC, 0xD9, 0xE2, 0xEE, 0xC5, 0xDD, 0x91, 0xB9, 0x00,
-    0x85, 0x39, 0x6F, 0x5C, 0xBC, 0x0E, 0xBA, 0xB4, 0x27, 0xAF, 0xA8, 0x61, 0x8E, 0x10, 0x5E, 0xC5,
-    0xED, 0x5A, 0xD1, 0x55, 0xA5, 0x15, 0xCE, 0xF5, 0x66, 0xA8, 0xCA, 0x24, 0xDF, 0x20, 0x17, 0xBC,
-    0xAF, 0x8C, 0xDA, 0xAD, 0xA9, 0xE9, 0xAB, 0x77, 0xAA, 0x16, 0x87, 0xAD, 0xD6, 0x97, 0x47, 0x72,
-    0x41, 0xC1, 0x07, 0xE7, 0x2E, 0x94, 0x96, 0x92, 0x4D, 0xD4, 0xA6, 0x77, 0xCA, 0x2A, 0xA5, 0x3D,
-    0x87, 0x85, 0xA6, 0xFE, 0x8A, 0x9A, 0x49, 0x8C, 0x3A, 0x35, 0xA9, 0x06, 0x30, 0x84, 0x43, 0xFF,
-    0x60, 0xD1, 0xD2, 0x73, 0x92, 0xF3, 0xE5, 0x59, 0x38, 0x04, 0xBB, 0xA2, 0xA5, 0xD9, 0xBA, 0xAC,
-    0x0E, 0xFA, 0xE2, 0x74, 0xD1, 0xB2, 0xD2, 0xCB, 0xD9, 0x5A, 0xF2, 0x04, 0x1A, 0x5A, 0xB7, 0x2D,
-    0x88, 0x6D, 0x87, 0x50, 0x9D, 0x90, 0x35, 0x3F, 0xB8, 0x10, 0x69, 0x3B, 0x87, 0x42, 0xDC, 0x6E,
-    0x80, 0xAA, 0x87, 0xF3, 0x9E, 0x64, 0x0C, 0x10, 0x32, 0x8A, 0xC8, 0x98, 0x1E, 0xA6, 0x39, 0xE2,
-    0xF3, 0xE9, 0xE6, 0x95, 0xE5, 0x7C, 0xA5, 0xC3, 0x15, 0x04, 0x32, 0x4B, 0xE1, 0x9E, 0x00, 0x9C,
-    0xF4, 0x28, 0x23, 0x03, 0x03, 0x05, 0x72, 0x66, 0x1E, 0x1D, 0xF7, 0x67, 0x69, 0xF4, 0xE1, 0xE4,
-    0x54, 0xC4, 0x78, 0xA9, 0x68, 0xD1, 0x29, 0x56, 0x0D, 0x12, 0x8E, 0x6E, 0xF5, 0x35, 0x6C, 0x0D,
-    0xC3, 0xB0, 0x74, 0x91, 0x0E, 0x46, 0xB0, 0x03, 0x6E, 0x45, 0xF9, 0x94, 0x8C, 0x50, 0x3F, 0xC5,
-    0x2F, 0xB8, 0xA0, 0x07, 0x3F, 0xA5, 0x5F, 0x58, 0x74, 0x2E, 0xE4, 0x0D, 0x6B, 0x50, 0xAD, 0x98,
-    0x4C, 0xE3, 0x06, 0x1A, 0x55, 0x61, 0x30, 0x9D, 0xC9, 0x1D, 0x17, 0x25, 0xD1, 0x4F, 0xF1, 0x0B,
-    0x2E, 0xC0, 0xC2, 0x4F, 0xF9, 0x6A, 0xDC, 0x14, 0xEB, 0xE8, 0x7B, 0x41, 0x49, 0x23, 0x56, 0xE4,
-    0x14, 0x98, 0xD7, 0x2F, 0xB8, 0xD8, 0x09, 0xB4, 0x93, 0xC6, 0x5E, 0x65, 0x2F, 0xE8, 0xEA, 0x58,
-    0xE7, 0x8D, 0x6E, 0x4E, 0x36, 0xE4, 0x64, 0x57, 0x0F, 0x9C, 0x2C, 0xB4, 0x82, 0x92, 0x64, 0x8E,
-    0xE4, 0xFF, 0xCA, 0xC9, 0xD6, 0x4A, 0x9D, 0xAD, 0xC9, 0x66, 0x1A, 0x99, 0xF6, 0x26, 0x1A, 0x7E,
-    0xE0, 0xC9, 0x6A, 0xCC, 0x29, 0x79, 0xE0, 0x64, 0xED, 0x0F, 0xDD, 0xDF, 0xD6, 0x4D, 0xD6, 0xF6,
-    0x4E, 0x3E, 0x05, 0x93, 0xA5, 0xE7, 0xF2, 0x0E, 0x6E, 0xF9, 0xD7, 0x91, 0xC9, 0x0D, 0x53, 0xE4,
-    0x40, 0x44, 0x08, 0x58, 0x50, 0x5F, 0x76, 0x44, 0x7D, 0x7D, 0xBF, 0xE4, 0xDD, 0x55, 0xBA, 0xB2,
-    0xC7, 0x2E, 0x9E, 0xCF, 0x58, 0x3E, 0xE3, 0xF8, 0x8C, 0xE1, 0x23, 0x6C, 0xCF, 0xD8, 0x3D, 0xA2,
-    0xF7, 0x3D, 0x63, 0xF6, 0xB4, 0x8B, 0x7D, 0x28, 0x61, 0xC6, 0xE9, 0x19, 0xA3, 0x67, 0x70, 0x88,
-    0xB1, 0x79, 0x8D, 0xCB, 0xAB, 0xE8, 0x5E, 0xAA, 0xBA, 0xE1, 0x22, 0x39, 0xBA, 0xBB, 0x15, 0x72,
-    0x44, 0x77, 0xCB, 0x63, 0x1C, 0xC5, 0x4F, 0xF9, 0xCC, 0x9B, 0x19, 0xF9, 0x15, 0x23, 0x93, 0xCF,
-    0x80, 0x09, 0x10, 0xED, 0x3C, 0xB4, 0x25, 0x97, 0x24, 0xEC, 0x34, 0x06, 0xA7, 0x3E, 0x0B, 0x02,
-    0x06, 0x15, 0x83, 0x1B, 0xBA, 0x18, 0x83, 0xF2, 0x68, 0xAE, 0x2B, 0x81, 0x68, 0x37, 0x03, 0x4E,
-    0x5C, 0x86, 0xA8, 0xE1, 0x67, 0xE2, 0x4E, 0xD7, 0x00, 0x4B, 0x14, 0xC3, 0x5A, 0x48, 0x97, 0x0C,
-    0x30, 0x39, 0xF7, 0x65, 0xCE, 0x25, 0xE8, 0xCE, 0x73, 0xD1, 0x92, 0x39, 0x4E, 0xA2, 0xDA, 0x87,
-    0x44, 0x1D, 0x9E, 0x61, 0x4A, 0x42, 0xE3, 0x5C, 0xE9, 0xAD, 0x02, 0x01, 0xF5, 0x5C, 0xA4, 0x80,
-    0x37, 0xF0, 0x99, 0x2E, 0x27, 0x10, 0xD5, 0xBD, 0x26, 0x03, 0xE2, 0xEF, 0xBB, 0x2C, 0x40, 0xF1,
-    0x14, 0xC3, 0xFF, 0x32, 0x02, 0xC6, 0xFD, 0x0B, 0xE6, 0x56, 0x26, 0xAF, 0x5A, 0x2D, 0x0E, 0x91,
-    0x17, 0x16, 0x1E, 0xF6, 0x1F, 0x3A, 0xB7, 0x3A, 0xDA, 0xB5, 0x14, 0xA8, 0x2D, 0xA7, 0x18, 0x89,
-    0xFE, 0xD3, 0x83, 0xF5, 0xAB, 0xCE, 0x4D, 0x44, 0x75, 0x72, 0x78, 0x78, 0x6D, 0x6D, 0x81, 0xA8,
-    0xD9, 0x41, 0x4A, 0x43, 0x5B, 0x38, 0xE1, 0xCF, 0x3B, 0xF2, 0xE6, 0xA2, 0x5A, 0x1F, 0x91, 0x99,
-    0x64, 0xC1, 0x78, 0x5D, 0x9E, 0xCE, 0x08, 0xC7, 0x42, 0x03, 0x5D, 0x7B, 0xD9, 0x6E, 0x90, 0xF8,
-    0x51, 0xAB, 0xC6, 0x70, 0x44, 0x7B, 0xAD, 0x37, 0xEA, 0x8A, 0x8B, 0xF6, 0xB7, 0xCB, 0x60, 0xA4,
-    0x10, 0xA7, 0xFF, 0x97, 0xAA, 0x4A, 0x10, 0x8E, 0x80, 0xEF, 0x27, 0x0F, 0x54, 0x97, 0x4F, 0x5C,
-    0x84, 0x3A, 0xD0, 0xE0, 0xE8, 0xA0, 0x16, 0x80, 0x38, 0x16, 0x9A, 0x88, 0xF1, 0x86, 0x67, 0x07,
-    0x8D, 0xFA, 0x30, 0xD0, 0xE1, 0x21, 0x03, 0xA2, 0xAB, 0x91, 0x1E, 0x16, 0x88, 0x62, 0x89, 0x46,
-    0xD3, 0x55, 0x59, 0x16, 0x9C, 0x56, 0xD0, 0x86, 0x35, 0x25, 0x76, 0xE1, 0x82, 0xB1, 0xB2, 0xD4,
-    0xB4, 0xE1, 0xBD, 0x9E, 0xF9, 0x45, 0x7C, 0x32, 0x29, 0xF1, 0x78, 0x86, 0x16, 0x65, 0x3C, 0x0B,
-    0xFA, 0xCC, 0x79, 0x25, 0x63, 0xF5, 0x31, 0x45, 0x18, 0xCE, 0x39, 0x35, 0xBF, 0x26, 0xC9, 0x42,
-    0x55, 0x81, 0x72, 0x07, 0x17, 0x1D, 0x7F, 0x1E, 0xFA, 0x99, 0x0B, 0x05, 0xA6, 0x41, 0x40, 0x13,
-    0x36, 0x8C, 0xD8, 0xF8, 0x1E, 0xF3, 0x5C, 0x1A, 0x58, 0x93, 0x3F, 0x01, 0x7D, 0x46, 0x06, 0x14,
-    0xF1, 0x8A, 0x7F, 0xF0, 0x8E, 0x3E, 0x15, 0xB3, 0x67, 0x61, 0xAE, 0xAA, 0x31, 0x09, 0xAE, 0x2B,
-    0x69, 0xC5, 0xC1, 0x65, 0x5C, 0x62, 0x1E, 0x96, 0x49, 0x2A, 0x86, 0xAB, 0xC3, 0x96, 0x41, 0x5C,
-    0x9A, 0xDA, 0x29, 0x1D, 0x5A, 0xCB, 0x4C, 0x1A, 0xE3, 0x79, 0x01, 0x93, 0x69, 0x51, 0xE3, 0x88,
-    0x4C, 0xC6, 0x3C, 0xCF, 0x78, 0x6B, 0xF5, 0x15, 0xB9, 0xA1, 0xD8, 0x22, 0xC5, 0xCD, 0xA1, 0x97,
-    0xC1, 0x25, 0x1D, 0xA6, 0xDB, 0x82, 0x11, 0x1B, 0xDA, 0x61, 0x94, 0x4B, 0x90, 0xBE, 0x35, 0xC4,
-    0x60, 0x45, 0xA1, 0x45, 0x51, 0x49, 0x9F, 0x15, 0x09, 0xBD, 0x4C, 0x5E, 0xAC, 0xBC, 0xF8, 0x16,
-    0x8A, 0x5E, 0xB6, 0xD7, 0x9D, 0xD5, 0x05, 0x59, 0xE2, 0xEE, 0x05, 0x79, 0x47, 0xEE, 0x6E, 0xCE,
-    0x39, 0x06, 0xC0, 0xF3, 0x1E, 0x95, 0x09, 0x78, 0xCA, 0x23, 0xE3, 0xB7, 0xE4, 0xBA, 0x4C, 0xC4,
-    0x1F, 0x26, 0xAE, 0x52, 0x13, 0x78, 0x98, 0x0D, 0x99, 0xF4, 0x8B, 0xC2, 0x51, 0xF1, 0x6B, 0x08,
-    0x9D, 0xBE, 0x7B, 0xCB, 0x56, 0xF2, 0x69, 0x99, 0x06, 0xC4, 0x0E, 0x5C, 0x5D, 0x2A, 0x47, 0x1F,
-    0x03, 0x35, 0x3D, 0x35, 0x26, 0xBE, 0x18, 0x97, 0x29, 0x7D, 0xFD, 0x12, 0xA2, 0xA7, 0x51, 0x4E,
-    0x51, 0xCD, 0x95, 0x83, 0xAA, 0x62, 0xED, 0x15, 0x57, 0x21, 0x1D, 0x48, 0xC1, 0x82, 0x46, 0x9E,
-    0xDA, 0x78, 0xB0, 0x8E, 0xF7, 0xE5, 0x4D, 0xA1, 0xAD, 0x09, 0xC7, 0x4B, 0xDD, 0x62, 0x50, 0xAF,
-    0x09, 0x1A, 0x39, 0x2A, 0x21, 0xCE, 0x84, 0x27, 0x8A, 0xA7, 0x8E, 0xF7, 0x8A, 0x4A, 0x16, 0xB3,
-    0x0A, 0x60, 0x7C, 0xE5, 0x7B, 0x97, 0x60, 0x28, 0x45, 0x35, 0x82, 0xA1, 0x74, 0xF9, 0xE5, 0x0B,
-    0x85, 0x7C, 0x33, 0xAE, 0xA2, 0xE3, 0x4B, 0x8C, 0xE8, 0xBB, 0x87, 0x9C, 0x77, 0x7E, 0xD5, 0xA3,
-    0xBA, 0xC5, 0x4A, 0x1F, 0x97, 0x55, 0x32, 0x4C, 0x79, 0x5D, 0xC4, 0x37, 0xC2, 0x9E, 0x49, 0xF2,
-    0x85, 0x70, 0x54, 0x20, 0x63, 0x41, 0xAA, 0x1C, 0x6F, 0xFB, 0x73, 0x76, 0x37, 0xE3, 0x9E, 0xFB,
-    0xED, 0x85, 0xFD, 0xF3, 0x15, 0x78, 0x6A, 0xC9, 0x68, 0x07, 0xF9, 0xED, 0x6C, 0x71, 0x05, 0x8C,
-    0x31, 0x90, 0x47, 0x32, 0xF3, 0x19, 0xCD, 0xC0, 0xEB, 0x06, 0x9D, 0x8D, 0x81, 0x45, 0xBF, 0x61,
-    0x90, 0x07, 0xF6, 0x87, 0x90, 0x66, 0xB2, 0xF2, 0xF6, 0xEA, 0xD8, 0xCB, 0x22, 0x24, 0x9C, 0x0C,
-    0x26, 0x1C, 0x74, 0x88, 0x64, 0x77, 0xB2, 0xE8, 0x3E, 0x92, 0x8E, 0x32, 0x2F, 0xE7, 0x4F, 0x72,
-    0xAA, 0x5C, 0xFE, 0x14, 0x2F, 0x79, 0x26, 0x57, 0xA1, 0x2A, 0xC1, 0xAA, 0xC7, 0xFB, 0x4C, 0x1B,
-    0x60, 0x79, 0xC7, 0x19, 0x90, 0x71, 0x3E, 0xE3, 0xAF, 0x32, 0x4E, 0x91, 0xC7, 0x7F, 0x01, 0xFE,
-    0x4A, 0x33, 0x64, 0xEB, 0x0B, 0xDE, 0x19, 0x44, 0x5D, 0x0C, 0xD1, 0x9D, 0xEB, 0x23, 0xC1, 0x05,
-    0x90, 0x1A, 0xF9, 0x45, 0x95, 0x4B, 0x1C, 0xB4, 0xCB, 0xC9, 0x82, 0xB3, 0x7F, 0x4B, 0x46, 0x59,
-    0x28, 0xFF, 0x43, 0xBC, 0x79, 0xCF, 0xCC, 0x86, 0xED, 0x99, 0x0C, 0x5C, 0x94, 0xCA, 0x33, 0x44,
-    0xB1, 0x40, 0xD2, 0xE7, 0xD6, 0x9C, 0x2F, 0x96, 0xB2, 0xBD, 0xC7, 0x67, 0xC0, 0x47, 0x49, 0x46,
-    0xE7, 0xA8, 0x77, 0x91, 0x61, 0xC8, 0x7B, 0x0A, 0x61, 0x04, 0x50, 0x73, 0x4D, 0xDD, 0xAD, 0xD4,
-    0x88, 0x1A, 0x9F, 0x3B, 0xBE, 0x5C, 0xB9, 0xB8, 0xB8, 0x9D, 0x9C, 0x60, 0x95, 0x76, 0xCF, 0x0E,
-    0x97, 0x6A, 0x1A, 0x5B, 0x61, 0x4D, 0x3D, 0x28, 0xFB, 0x20, 0x5B, 0xA9, 0xC7, 0xD3, 0x3B, 0x85,
-    0x15, 0x34, 0x1C, 0x73, 0x5A, 0xC6, 0x4B, 0x21, 0xA1, 0x27, 0x0B, 0x7C, 0x64, 0x92, 0x9B, 0x59,
-    0xC4, 0xCC, 0x5E, 0x3A, 0x62, 0x61, 0x91, 0x53, 0xE8, 0xDC, 0x76, 0x00, 0x7D, 0x64, 0x16, 0x22,
-    0xB8, 0x91, 0x27, 0x6E, 0x17, 0xE4, 0x08, 0xC8, 0x1B, 0xAE, 0x74, 0xAF, 0xEB, 0x24, 0x2C, 0xFB,
-    0x58, 0x51, 0x19, 0x20, 0x5C, 0x72, 0xF0, 0x51, 0xE2, 0xE0, 0x02, 0xBE, 0xFB, 0x3F, 0x68, 0x64,
-    0x4B, 0xD6, 0xE2, 0xBE, 0x96, 0x18, 0xF1, 0x3E, 0x54, 0xF9, 0xDE, 0x86, 0xB8, 0x65, 0x8E, 0xB6,
-    0x5F, 0x20, 0x1A, 0xEF, 0xB7, 0x1A, 0x0B, 0xC7, 0x38, 0xDD, 0x4B, 0xC3, 0x2C, 0x3A, 0xF6, 0x78,
-    0xCD, 0xD0, 0x54, 0xCC, 0x3D, 0x55, 0x6A, 0xE8, 0x3C, 0x05, 0xF3, 0x53, 0xC4, 0x58, 0x59, 0x64,
-    0xA4, 0x31, 0x96, 0xA1, 0xD0, 0xF2, 0xA6, 0xEE, 0xEC, 0x03, 0xC8, 0x8D, 0x17, 0xDC, 0xCE, 0xF6,
-    0x1B, 0x31, 0xB1, 0xFC, 0x86, 0xD1, 0x6C, 0xEC, 0x46, 0xCA, 0xA8, 0x1C, 0x3C, 0xE0, 0x65, 0x3B,
-    0xF2, 0xFF, 0xE3, 0x19, 0xD0, 0xE4, 0xFC, 0xA4, 0x10, 0xD4, 0x29, 0x95, 0x7F, 0xA9, 0x89, 0x37,
-    0x71, 0xC8, 0xDC, 0x8D, 0x83, 0x06, 0x11, 0x65, 0x46, 0x56, 0x18, 0x23, 0x4F, 0xA1, 0x99, 0x22,
-    0xCB, 0x00, 0x92, 0x3C, 0x63, 0xC1, 0x90, 0xE2, 0x4A, 0x6D, 0x58, 0x7C, 0xA7, 0x54, 0x41, 0x3D,
-    0xBA, 0x20, 0xE5, 0xC8, 0x28, 0x4F, 0xE6, 0xD2, 0xDC, 0x13, 0x9C, 0xA2, 0xD4, 0xE4, 0x80, 0x89,
-    0x6E, 0x5D, 0xA3, 0xE1, 0x87, 0xF0, 0x1C, 0x3F, 0x46, 0x20, 0x8A, 0xBA, 0x2D, 0xF2, 0x86, 0xDA,
-    0x80, 0x23, 0xC1, 0x00, 0x34, 0x17, 0x23, 0xFA, 0x62, 0x4C, 0x8F, 0x68, 0x42, 0x80, 0x34, 0x60,
-    0x0C, 0x32, 0x53, 0x65, 0x11, 0x36, 0x67, 0x0B, 0x84, 0xD5, 0x93, 0x11, 0xFC, 0x51, 0x54, 0x6B,
-    0x7B, 0x6E, 0x06, 0xAF, 0x60, 0xFC, 0x1A, 0x5A, 0x4D, 0x3B, 0xC6, 0xF7, 0x72, 0xD1, 0x07, 0x58,
-    0x8E, 0xD6, 0x0C, 0x42, 0xEB, 0x5F, 0x8A, 0x8D, 0xDB, 0xC1, 0x35, 0xF6, 0x64, 0xC7, 0x47, 0xAF,
-    0xD6, 0xF8, 0x2B, 0xFE, 0x66, 0xB5, 0x68, 0x6F, 0x98, 0x54, 0x66, 0xD7, 0xBC, 0x60, 0x8E, 0xF0,
-    0xD7, 0xE3, 0xA6, 0x8F, 0xCB, 0xA0, 0xBE, 0xE0, 0x8B, 0x3F, 0x12, 0x56, 0x69, 0x20, 0x42, 0x3F,
-    0xAC, 0x12, 0x71, 0xB5, 0xB1, 0x14, 0x09, 0xD2, 0xCD, 0x65, 0x0C, 0x3C, 0x80, 0x30, 0x39, 0xD4,
-    0x72, 0x92, 0x45, 0x1D, 0xF3, 0x98, 0x11, 0x4C, 0xE8, 0x14, 0x99, 0xFD, 0x7E, 0xBD, 0x00, 0x62,
-    0x3C, 0x61, 0x59, 0x15, 0xD1, 0xB1, 0xC2, 0x66, 0x84, 0xE3, 0xB9, 0xE4, 0x95, 0x60, 0x7D, 0xA5,
-    0x38, 0x3C, 0x1C, 0x69, 0xDB, 0x2E, 0xB1, 0xE1, 0x2A, 0x4A, 0xD2, 0x05, 0xAF, 0x8C, 0x2E, 0x4C,
-    0xC0, 0x90, 0x4D, 0xE4, 0xAE, 0x4C, 0xC1, 0x9C, 0xD5, 0x94, 0x93, 0xA2, 0xF0, 0x8E, 0x35, 0x02,
-    0x24, 0x0B, 0x7E, 0x67, 0xBF, 0x41, 0xF4, 0xA7, 0x8E, 0x2B, 0xFA, 0xDD, 0x26, 0x65, 0xCC, 0x34,
-    0x41, 0x70, 0x14, 0xC9, 0xA5, 0x57, 0x60, 0xEF, 0x46, 0x80, 0x58, 0x40, 0x67, 0xFE, 0x04, 0x0E,
-    0xF1, 0x53, 0xD0, 0x14, 0x78, 0x42, 0xCD, 0x98, 0x6F, 0x9E, 0x41, 0xCD, 0x40, 0x4F, 0xC0, 0xD6,
-    0x33, 0x05, 0x6C, 0x54, 0x15, 0x67, 0x10, 0x39, 0xA9, 0x70, 0x9A, 0xB9, 0x00, 0xDB, 0xF9, 0xA0,
-    0x90, 0x65, 0x2E, 0x5A, 0x19, 0x0D, 0xE5, 0x8E, 0x6C, 0xD0, 0x9E, 0xDA, 0x9D, 0xB3, 0x22, 0x80,
-    0x65, 0xB2, 0x7E, 0x19, 0xF0, 0xA4, 0x6F, 0x2D, 0xBA, 0xA9, 0xA6, 0x59, 0xA9, 0x09, 0x2B, 0xA1,
-    0xA6, 0xE3, 0xEF, 0x64, 0xC9, 0xD9, 0xA4, 0xCE, 0xEA, 0x82, 0x50, 0x4F, 0x19, 0x34, 0xFF, 0x09,
-    0x74, 0xD5, 0x41, 0x2E, 0xE2, 0x21, 0xB4, 0x99, 0x68, 0x77, 0x0B, 0xD6, 0x89, 0x5A, 0xB8, 0x52,
-    0x96, 0x59, 0x65, 0x28, 0xE9, 0x05, 0x5D, 0x08, 0x6A, 0x69, 0x8D, 0x10, 0xE7, 0x70, 0x59, 0x42,
-    0x3A, 0x33, 0x74, 0x9E, 0xF8, 0x05, 0x19, 0xA2, 0x0C, 0x30, 0x16, 0x11, 0x59, 0x2E, 0xEE, 0x41,
-    0x5E, 0xA7, 0x4F, 0x0B, 0xC7, 0xFB, 0x4D, 0x4A, 0x5E, 0x3C, 0x37, 0xF9, 0x0F, 0xAB, 0x75, 0xF0,
-    0x60, 0xCB, 0x4E, 0x9C, 0x9C, 0x00, 0xE7, 0xE9, 0x52, 0xB8, 0x17, 0x54, 0x42, 0x8D, 0x68, 0xA4,
-    0x76, 0xE1, 0xD2, 0x77, 0xD4, 0xDD, 0x98, 0x04, 0xAC, 0x28, 0x98, 0x67, 0xFC, 0xFC, 0xA4, 0xEF,
-    0x26, 0xE1, 0xEE, 0x6D, 0x08, 0xF7, 0x47, 0x84, 0xDA, 0x37, 0x20, 0xDC, 0x55, 0x5D, 0x7A, 0xAA,
-    0x92, 0xCF, 0x51, 0x37, 0xF7, 0xB1, 0x35, 0xC2, 0xF5, 0xFE, 0x4F, 0xAD, 0xF5, 0x45, 0x93, 0xC4,
-    0xDF, 0xFE, 0xF3, 0x21, 0xFD, 0x0B, 0x99, 0x54, 0xE3, 0xDF, 0x93, 0xA9, 0xFA, 0xD0, 0xD6, 0x20,
-    0x65, 0x6B, 0x12, 0xF8, 0xF8, 0x39, 0x43, 0xF8, 0x83, 0x6E, 0x1A, 0xBF, 0xA1, 0x99, 0x0F, 0xA3,
-    0x80, 0x3B, 0xB5, 0x30, 0x64, 0x2A, 0xBF, 0x83, 0xA1, 0x85, 0x28, 0x13, 0x25, 0x82, 0xCC, 0x7C,
-    0x34, 0xBC, 0xA2, 0x5B, 0x9C, 0xC2, 0x87, 0x57, 0x72, 0x4E, 0x67, 0x50, 0x43, 0x8D, 0x82, 0x89,
-    0x81, 0x43, 0xBD, 0xD9, 0x0C, 0xDF, 0xC3, 0x0C, 0x07, 0x17, 0x89, 0xD7, 0xB8, 0x3F, 0x6D, 0x02,
-    0xE6, 0xF2, 0x68, 0x68, 0x51, 0x8D, 0x12, 0x4F, 0xD0, 0x6A, 0xEC, 0x19, 0x53, 0xF7, 0x98, 0x5A,
-    0xF3, 0x34, 0xD0, 0xA2, 0x89, 0xB7, 0x9E, 0x74, 0x66, 0x68, 0xD7, 0xDC, 0x38, 0x20, 0x48, 0x95,
-    0x34, 0x3F, 0x50, 0x5B, 0xBC, 0x99, 0x76, 0xB9, 0x8B, 0xF6, 0x29, 0x9F, 0xB8, 0x88, 0xCF, 0xB0,
-    0x86, 0x03, 0x68, 0x5C, 0x31, 0x21, 0xFE, 0x91, 0xB1, 0xAC, 0x94, 0xB6, 0x7B, 0xF2, 0x8E, 0x1B,
-    0xEF, 0xC3, 0xCB, 0x39, 0x52, 0xA7, 0x6A, 0x4F, 0x57, 0x5A, 0xEF, 0xD6, 0xAF, 0xBD, 0x48, 0x2E,
-    0x35, 0x22, 0xD2, 0xE6, 0x2C, 0x38, 0xD0, 0x63, 0x84, 0x2B, 0x1E, 0x0B, 0xB1, 0x62, 0xED, 0xA2,
-    0x13, 0x35, 0x27, 0x4C, 0x9C, 0x2E, 0x61, 0x7F, 0xE6, 0x74, 0x74, 0x87, 0x04, 0x3A, 0xB7, 0xA5,
-    0x30, 0xF8, 0x19, 0xDC, 0xA5, 0xF4, 0x32, 0x34, 0xDF, 0x00, 0x9F, 0x2B, 0x78, 0x8F, 0xC2, 0xE2,
-    0x95, 0x06, 0x19, 0x22, 0x30, 0x7E, 0xD8, 0x88, 0x75, 0x25, 0x96, 0x63, 0xFA, 0xC3, 0x1E, 0x6E,
-    0x99, 0xBD, 0x27, 0x4F, 0xC8, 0x89, 0x7C, 0x48, 0xE8, 0xD4, 0xB8, 0x49, 0x2C, 0x67, 0xD7, 0x43,
-    0x79, 0x4E, 0x53, 0xBC, 0xF7, 0x19, 0xFB, 0xE4, 0xDE, 0x26, 0x90, 0xD5, 0x49, 0xA9, 0x5B, 0x83,
-    0x0E, 0xC2, 0xA2, 0xC3, 0x22, 0xA5, 0x10, 0xE9, 0xE1, 0x8F, 0x31, 0x39, 0xBA, 0xBB, 0x69, 0x3B,
-    0x3D, 0xC8, 0x1F, 0xA9, 0xF5, 0x4B, 0x43, 0xD3, 0x4B, 0x25, 0x83, 0x37, 0x10, 0x96, 0xE5, 0x31,
-    0x18, 0x90, 0xC2, 0x96, 0x96, 0x25, 0x2E, 0x40, 0x21, 0x24, 0xA5, 0x96, 0xA7, 0xEB, 0xB4, 0xEE,
-    0x23, 0xD0, 0x69, 0x59, 0x72, 0xB3, 0x48, 0xFF, 0x97, 0xE8, 0xB4, 0xB4, 0x17, 0x49, 0x13, 0xC1,
-    0x5E, 0x58, 0x67, 0xFC, 0xFD, 0xD9, 0xA0, 0xA3, 0x47, 0xE9, 0x14, 0xAC, 0xF0, 0x62, 0xCE, 0x47,
-    0x38, 0x87, 0x31, 0xFA, 0x7E, 0xAF, 0x99, 0x82, 0x54, 0x84, 0x5D, 0xD0, 0xE1, 0xFE, 0xE2, 0x39,
-    0xA6, 0x8D, 0x2C, 0x9A, 0x95, 0xDD, 0x7A, 0xAF, 0x96, 0xBB, 0x8B, 0xBD, 0x77, 0xAC, 0x79, 0x05,
-    0xE7, 0x14, 0x2E, 0x4E, 0x3A, 0xAD, 0xCD, 0x26, 0x76, 0x89, 0xC8, 0x3F, 0x05, 0x05, 0xD0, 0xF6,
-    0x19, 0xD4, 0xEE, 0xE6, 0x15, 0x6E, 0x32, 0x88, 0x30, 0x33, 0x6D, 0x3F, 0x6C, 0x9A, 0x86, 0x9B,
-    0x4C, 0x77, 0x4C, 0xAA, 0x9E, 0xD6, 0x29, 0xDB, 0x2F, 0x97, 0xE1, 0x7B, 0xF0, 0x51, 0x10, 0x0C,
-    0x55, 0x97, 0x1B, 0xC6, 0xAB, 0x15, 0xB2, 0x60, 0x77, 0x03, 0x93, 0xF1, 0xF8, 0x60, 0xBE, 0xDB,
-    0x2C, 0xC6, 0x4B, 0x6F, 0x8C, 0xFB, 0x3F, 0x10, 0x6B, 0x69, 0x0C, 0x6C, 0x7F, 0x01, 0x0A, 0x3F,
-    0xB0, 0x5F, 0x15, 0xA2, 0x5C, 0x9C, 0x3D, 0xAE, 0x4F, 0xC8, 0x50, 0x5B, 0x37, 0xD4, 0x3B, 0x3A,
-    0xD4, 0xA4, 0xE7, 0x50, 0x97, 0xB2, 0x83, 0x39, 0xD4, 0x89, 0x79, 0x86, 0xED, 0xC8, 0xCC, 0x14,
-    0x98, 0x99, 0x04, 0x8B, 0x9B, 0x53, 0x32, 0xC7, 0x67, 0x1E, 0xBB, 0x7E, 0x0A, 0xB8, 0x5A, 0x63,
-    0x27, 0xFF, 0xFB, 0x65, 0x7A, 0x85, 0x95, 0x26, 0x31, 0x52, 0xE4, 0x1A, 0x10, 0x4D, 0x20, 0xCA,
-    0x90, 0xD3, 0xD4, 0x7F, 0xE5, 0x1A, 0x9B, 0x12, 0x52, 0x24, 0x37, 0x45, 0xFA, 0xC3, 0x13, 0x81,
-    0x1F, 0x36, 0x5B, 0xEB, 0xF3, 0x8E, 0x1A, 0x28, 0x08, 0x48, 0x43, 0xA8, 0x32, 0xE6, 0xFE, 0x19,
-    0x6D, 0x5F, 0x74, 0x1C, 0xAE, 0x46, 0x75, 0x45, 0xAB, 0xDD, 0x3D, 0x64, 0xC8, 0x04, 0x4E, 0x53,
-    0x43, 0x5C, 0x0B, 0x4C, 0xA6, 0xA4, 0xE6, 0x37, 0x0B, 0x5A, 0xDC, 0x48, 0xBF, 0x62, 0x33, 0x52,
-    0xEC, 0xC1, 0xB6, 0x82, 0xF5, 0x04, 0x31, 0x40, 0x5F, 0x2D, 0x3C, 0xBE, 0xDC, 0x31, 0xBC, 0x3A,
-    0xD2, 0x3E, 0x20, 0x16, 0xCE, 0xD9, 0xF5, 0x66, 0x13, 0xCE, 0x5A, 0x6F, 0x7A, 0x41, 0xD3, 0x9B,
-    0xFF, 0xF0, 0xB2, 0xA1, 0x9B, 0x8F, 0x1C, 0x55, 0x9E, 0x85, 0x70, 0x5A, 0x0A, 0xAC, 0xD6, 0xEB,
-    0x58, 0xD0, 0x95, 0x66, 0xCC, 0x0A, 0x78, 0x7D, 0x99, 0xF8, 0x0E, 0x65, 0xA4, 0xBE, 0x83, 0x53,
-    0x2F, 0x32, 0xE1, 0x80, 0x78, 0x66, 0x5B, 0x86, 0x37, 0x8B, 0x7A, 0x1B, 0x31, 0x4B, 0x01, 0xDD,
-    0x2F, 0x0E, 0xAF, 0x31, 0x8C, 0xA0, 0xA1, 0x04, 0x97, 0xE4, 0xE5, 0xE6, 0x8B, 0x18, 0xC5, 0xC0,
-    0xD6, 0x3D, 0xBE, 0x34, 0x1A, 0x85, 0x6D, 0x55, 0x33, 0x17, 0x9E, 0x21, 0x4C, 0x13, 0x50, 0x39,
-    0x99, 0x0C, 0xD7, 0x83, 0xCE, 0x11, 0x0C, 0x1D, 0xF9, 0x66, 0x58, 0x23, 0x10, 0x26, 0xC4, 0xC4,
-    0xF6, 0xCC, 0x88, 0xAF, 0x1C, 0x68, 0x19, 0xF8, 0x6D, 0x72, 0x0B, 0x59, 0xC0, 0xAA, 0x60, 0xC4,
-    0xE0, 0x29, 0xD8, 0x32, 0xB0, 0x4A, 0xE8, 0x7F, 0xE7, 0xB4, 0x0E, 0xBF, 0x46, 0xD5, 0x31, 0x88,
-    0x8E, 0x87, 0x21, 0xC1, 0x78, 0x23, 0x6E, 0x01, 0xFF, 0x0B, 0x44, 0xBC, 0x59, 0x40, 0xA8, 0xE4,
-    0x96, 0x4E, 0x6F, 0xA2, 0x19, 0x8C, 0xF5, 0xC2, 0x8A, 0xF3, 0xA9, 0x90, 0x2E, 0x78, 0x23, 0xD7,
-    0x3A, 0xC3, 0xC4, 0x04, 0xEF, 0x80, 0xED, 0x52, 0x72, 0x75, 0x0C, 0xD3, 0x0F, 0xCC, 0xD6, 0x79,
-    0xF6, 0xB0, 0x70, 0x01, 0x07, 0xFA, 0xEB, 0xC6, 0x82, 0x02, 0xC0, 0x34, 0x41, 0x6C, 0xC3, 0xF7,
-    0x53, 0x1C, 0x14, 0xA0, 0xB7, 0xB0, 0x85, 0x11, 0x70, 0x48, 0x19, 0xDA, 0x37, 0xDE, 0x5F, 0x39,
-    0xD5, 0x4E, 0x5E, 0x81, 0x26, 0x0B, 0x4B, 0x82, 0x16, 0xD6, 0x68, 0xCF, 0xDF, 0xA8, 0x5F, 0xE8,
-    0x58, 0x07, 0x5C, 0x80, 0x7D, 0x0B, 0xD1, 0xBC, 0x7C, 0x78, 0x43, 0x42, 0xE0, 0x43, 0x81, 0x82,
-    0xC1, 0x44, 0xA4, 0xDF, 0x44, 0x46, 0x54, 0x2C, 0x09, 0x18, 0xEA, 0x78, 0xBC, 0x90, 0xA4, 0x10,
-    0x26, 0x48, 0xAA, 0xF4, 0x47, 0x45, 0xC7, 0xE7, 0x23, 0xDE, 0x19, 0xDC, 0x71, 0x42, 0x51, 0x9D,
-    0xBC, 0xC9, 0xA3, 0x16, 0x22, 0xFE, 0x2E, 0x47, 0x10, 0xB0, 0xFA, 0x01, 0xE6, 0xE2, 0x19, 0xBA,
-    0xE3, 0x4B, 0xF7, 0x29, 0x8A, 0x57, 0x2A, 0x1E, 0x87, 0x38, 0xAA, 0xCD, 0x73, 0x77, 0xF6, 0xDC,
-    0x6E, 0x5F, 0x51, 0xAC, 0x9F, 0x7D, 0x49, 0x58, 0x16, 0x00, 0x40, 0x71, 0xC6, 0xBD, 0xBB, 0xC7,
-    0x71, 0x13, 0x5A, 0xF8, 0x97, 0x30, 0x67, 0x64, 0x0D, 0x87, 0xC0, 0xCD, 0x03, 0x60, 0x0B, 0x16,
-    0x43, 0x88, 0x36, 0x2B, 0x35, 0xB1, 0xCB, 0xA9, 0xC1, 0x61, 0x07, 0x33, 0x08, 0x45, 0x7A, 0x57,
-    0x23, 0x81, 0x5C, 0x42, 0x5C, 0x0E, 0xD3, 0x03, 0xA6, 0x5D, 0x9D, 0x4F, 0x36, 0x02, 0x63, 0x66,
-    0x80, 0x36, 0x62, 0xBC, 0x11, 0x43, 0x4A, 0x6A, 0xD2, 0x3D, 0xB6, 0x54, 0x5D, 0x90, 0x94, 0x73,
-    0xBA, 0x40, 0x23, 0x9B, 0x13, 0x17, 0xFD, 0x46, 0x63, 0x18, 0xCA, 0x15, 0xB3, 0x41, 0xF9, 0x37,
-    0xA7, 0x1B, 0x94, 0x77, 0x0F, 0xBF, 0xE3, 0x76, 0xFD, 0xB8, 0x65, 0x50, 0x9A, 0x1D, 0x83, 0xF2,
-    0x48, 0x23, 0x21, 0xE0, 0x0A, 0x8D, 0xF1, 0x3C, 0x83, 0x4D, 0xF1, 0x8E, 0xC1, 0x8E, 0x1E, 0x9F,
-    0x85, 0x08, 0x7F, 0x28, 0x68, 0xDC, 0xB8, 0x5B, 0x8D, 0x42, 0x79, 0xF4, 0x5C, 0x31, 0x09, 0xEB,
-    0x7E, 0x81, 0xC3, 0xCD, 0xA4, 0x14, 0xFE, 0xAF, 0xAE, 0xC0, 0xA1, 0x78, 0xD6, 0x2E, 0xE1, 0xE4,
-    0x25, 0x93, 0xB3, 0x7D, 0x36, 0x63, 0xC0, 0x50, 0x08, 0x3B, 0x17, 0x12, 0xB0, 0x20, 0xC1, 0xAC,
-    0x0B, 0x12, 0x9A, 0xDD, 0x82, 0x84, 0x6E, 0xAB, 0x20, 0x01, 0x8B, 0xF3, 0xF9, 0xDF, 0x36, 0xC9,
-    0xD3, 0x65, 0xF4, 0x56, 0xE3, 0xBF, 0xD7, 0x99, 0xDF, 0x3B, 0xB7, 0xE9, 0xD8, 0x65, 0xEB, 0x8C,
-    0xC3, 0xBA, 0x2A, 0x61, 0xF7, 0xF7, 0x13, 0x55, 0x0B, 0x73, 0x95, 0x82, 0xFC, 0x7C, 0x47, 0xD7,
-    0xDD, 0x77, 0x62, 0xCC, 0x5C, 0xD9, 0xC1, 0x08, 0xB9, 0xF8, 0x35, 0x28, 0x09, 0x93, 0x8B, 0x60,
-    0x01, 0xB7, 0xB4, 0xB9, 0x63, 0xD3, 0x8D, 0xA0, 0x04, 0x9E, 0xBB, 0x70, 0xD2, 0xD0, 0x81, 0x5D,
-    0x28, 0xA0, 0x79, 0x9B, 0x53, 0x6E, 0x95, 0xEB, 0x2A, 0x42, 0x88, 0x82, 0x66, 0xC5, 0x95, 0xED,
-    0x4C, 0x39, 0x6D, 0x54, 0x9F, 0xC9, 0x4C, 0x7A, 0xCE, 0xAD, 0x59, 0x07, 0xFC, 0x35, 0xC9, 0x32,
-    0x65, 0x7F, 0x9D, 0x4B, 0xAD, 0x00, 0x8C, 0xFF, 0xF6, 0x92, 0x51, 0xF9, 0xAA, 0xE8, 0x20, 0xFC,
-    0x8D, 0x75, 0xA8, 0x82, 0x5E, 0x31, 0x73, 0xCC, 0x08, 0x42, 0x4F, 0xD7, 0xEA, 0x4F, 0x13, 0x90,
-    0x2B, 0xC3, 0x61, 0x14, 0x17, 0xD9, 0x58, 0x9F, 0x45, 0x06, 0xE9, 0xFF, 0x84, 0x33, 0x3D, 0x5E,
-    0xEA, 0x13, 0x0D, 0xD6, 0x56, 0x45, 0xA5, 0xC2, 0xC1, 0xEC, 0xE4, 0x7F, 0x15, 0xD5, 0x36, 0x15,
-    0x42, 0xC0, 0x38, 0x68, 0x48, 0x9A, 0x09, 0xE8, 0x98, 0x9F, 0xF6, 0x19, 0x5A, 0x97, 0x44, 0x2B,
-    0xB6, 0x2E, 0x79, 0xB3, 0x8C, 0x6E, 0x1D, 0x16, 0xB7, 0xAE, 0x77, 0x5A, 0x47, 0x61, 0x17, 0xBD,
-    0xFA, 0x09, 0x2B, 0xC2, 0x00, 0x1B, 0xB5, 0x3E, 0x7A, 0x45, 0x0A, 0x15, 0x2C, 0x77, 0x82, 0xD4,
-    0x97, 0x89, 0xBF, 0x59, 0xC0, 0x95, 0x15, 0x21, 0x42, 0x35, 0x9C, 0xDB, 0xE5, 0x3C, 0xBE, 0x0F,
-    0x23, 0x6A, 0x12, 0x91, 0xF8, 0xAF, 0x40, 0xA2, 0xA5, 0xB7, 0x7B, 0xEF, 0x5E, 0x1D, 0xB4, 0x74,
-    0x9E, 0xC4, 0xA9, 0x80, 0x21, 0x2F, 0xB2, 0x03, 0xA6, 0x2B, 0x1D, 0x52, 0x58, 0x94, 0xA7, 0x89,
-    0x9A, 0xEA, 0x81, 0xA2, 0x46, 0xEB, 0xAF, 0xD4, 0x60, 0x1F, 0x67, 0x5B, 0xE6, 0xE0, 0xF4, 0x52,
-    0xBB, 0x8F, 0x33, 0x42, 0x43, 0xC0, 0x3E, 0xED, 0x2E, 0x05, 0x19, 0x93, 0x89, 0x68, 0x77, 0x71,
-    0xA1, 0x1F, 0xF9, 0xA7, 0x09, 0x53, 0x85, 0x25, 0x61, 0xD8, 0x15, 0xE1, 0xAF, 0x00, 0x0F, 0x63,
-    0x1B, 0x64, 0x73, 0x32, 0x7D, 0xB7, 0x7E, 0xE0, 0xD3, 0xE6, 0x68, 0x7E, 0x9C, 0xB4, 0xF4, 0x96,
-    0xDB, 0xD8, 0x94, 0x35, 0x2C, 0x05, 0x2F, 0x8F, 0x69, 0x2E, 0x9E, 0x11, 0xD5, 0xC6, 0x15, 0xF1,
-    0x24, 0xAF, 0x74, 0xCA, 0x12, 0x23, 0x73, 0xEE, 0x98, 0x8E, 0x02, 0xE1, 0x85, 0x0B, 0x5D, 0x5D,
-    0x8F, 0x4B, 0xD1, 0xAB, 0x4D, 0xE0, 0xB2, 0x0B, 0x19, 0xA7, 0x3D, 0x92, 0xED, 0x5C, 0x29, 0xCC,
-    0xC2, 0x02, 0x4D, 0x81, 0xE8, 0xC0, 0xE0, 0x30, 0xFD, 0x96, 0xA5, 0x4A, 0x83, 0x09, 0x6E, 0x63,
-    0x67, 0x81, 0x0F, 0x51, 0xC9, 0xC1, 0xBC, 0x25, 0x81, 0x4B, 0x69, 0x09, 0x0F, 0x8D, 0x7E, 0xC6,
-    0x11, 0x03, 0x5A, 0x58, 0x1E, 0xC7, 0xF4, 0x62, 0x18, 0x66, 0x08, 0x53, 0xFD, 0xB0, 0xD3, 0xA2,
-    0xC7, 0xF4, 0x45, 0x51, 0x2D, 0x98, 0x45, 0x21, 0x13, 0xFE, 0x05, 0x12, 0x54, 0xB6, 0x51, 0x9D,
-    0xED, 0xCB, 0x73, 0x53, 0xAA, 0x73, 0x04, 0x7F, 0x2A, 0x97, 0x9F, 0x1B, 0xCD, 0xC9, 0x1F, 0xF5,
-    0x79, 0xA2, 0x37, 0x1A, 0x2D, 0x9C, 0x72, 0xA5, 0x55, 0xF9, 0x5C, 0x6D, 0x04, 0x32, 0xAB, 0x40,
-    0x4A, 0xBE, 0xAA, 0xA0, 0x94, 0x8A, 0x17, 0x09, 0x9D, 0x2C, 0x32, 0x2E, 0x55, 0x0E, 0x11, 0xCC,
-    0xAA, 0x11, 0x99, 0xA2, 0x49, 0x01, 0xFF, 0x94, 0x11, 0x5F, 0x16, 0x3F, 0x6A, 0xD1, 0x46, 0x5F,
-    0x87, 0x18, 0x58, 0x45, 0x25, 0x24, 0x57, 0xFC, 0x5A, 0x95, 0x3C, 0x2D, 0xA4, 0xF9, 0x65, 0x1D,
-    0xBC, 0x8B, 0x9C, 0x64, 0x43, 0x6F, 0x3B, 0x6E, 0xC8, 0x58, 0x7E, 0xEB, 0xBC, 0xCA, 0x60, 0x2B,
-    0x21, 0xDA, 0x33, 0x45, 0x66, 0x11, 0x3D, 0xAD, 0x53, 0x97, 0xB7, 0xDD, 0xF0, 0x41, 0x21, 0x46,
-    0xA2, 0x9B, 0x17, 0x8D, 0xD1, 0x9C, 0xB1, 0x58, 0x07, 0xE3, 0xA1, 0x08, 0xC2, 0xE5, 0x62, 0xA0,
-    0x80, 0x07, 0x21, 0x99, 0x3B, 0x5B, 0x29, 0xF6, 0x24, 0xAA, 0x45, 0x17, 0x60, 0x5E, 0xF9, 0xF7,
-    0xC4, 0xAA, 0x6A, 0x44, 0x12, 0x0E, 0xD4, 0x2F, 0xA9, 0xCB, 0x97, 0x3E, 0xCF, 0xDC, 0xE5, 0xF7,
-    0x18, 0xDA, 0xF7, 0xDF, 0xD3, 0x84, 0xE1, 0x30, 0xEE, 0x53, 0x56, 0x2B, 0xC0, 0x28, 0x55, 0x58,
-    0x7E, 0xD4, 0x69, 0xFC, 0x8A, 0x34, 0x61, 0x2C, 0xA4, 0xD7, 0x8D, 0x90, 0xEF, 0xBF, 0x83, 0xBD,
-    0x01, 0x97, 0x0B, 0xE1, 0x3C, 0x91, 0xB7, 0x14, 0x9D, 0x26, 0xFF, 0x2A, 0xAB, 0xD8, 0x42, 0x30,
-    0x59, 0xAE, 0x2E, 0x38, 0x86, 0x11, 0x01, 0xC5, 0x61, 0x92, 0x6F, 0x10, 0xE2, 0x1E, 0xBF, 0x8E,
-    0xD9, 0x8A, 0xFF, 0x65, 0xB9, 0xDF, 0x91, 0x5A, 0x93, 0x1B, 0x6D, 0x42, 0x75, 0xDC, 0xCF, 0x11,
-    0x75, 0x87, 0xA6, 0x97, 0xE1, 0xE2, 0x10, 0x26, 0x40, 0x0A, 0xC8, 0x93, 0x8F, 0x4D, 0x48, 0xA4,
-    0x90, 0x82, 0xC6, 0x32, 0x85, 0x7E, 0x51, 0x98, 0x3A, 0x3D, 0xD9, 0x38, 0xC8, 0xD8, 0xE8, 0x0C,
-    0x12, 0x57, 0xA3, 0xA7, 0x28, 0x72, 0x03, 0xC8, 0xDB, 0xD5, 0xBD, 0x3D, 0xC5, 0x0F, 0xCD, 0xD0,
-    0x25, 0xEA, 0xD2, 0xC3, 0xEB, 0x77, 0xF6, 0xF6, 0xB2, 0x39, 0xBB, 0x0E, 0xEF, 0xA5, 0x76, 0x51,
-    0xA1, 0xD1, 0x39, 0xA8, 0xFA, 0x06, 0x54, 0x94, 0xDB, 0xE5, 0xFA, 0x34, 0x3A, 0x04, 0x2A, 0x1E,
-    0x98, 0xD3, 0xC3, 0x36, 0x8C, 0x85, 0xD3, 0x48, 0xBD, 0x62, 0xBC, 0x4E, 0x94, 0x0D, 0x51, 0x7A,
-    0x2C, 0x64, 0xB4, 0x6E, 0xD2, 0x73, 0xCA, 0xE2, 0xCC, 0x33, 0x0C, 0x1A, 0xD3, 0x7F, 0x81, 0xA6,
-    0x8B, 0xCA, 0x85, 0xBD, 0xFA, 0xB7, 0xC8, 0xE8, 0x2C, 0x89, 0x80, 0x27, 0xFF, 0x2C, 0xB4, 0xC2,
-    0x84, 0x39, 0x5C, 0xCD, 0xB8, 0x14, 0x87, 0xF6, 0xF0, 0x90, 0x08, 0x2C, 0x87, 0xDE, 0x1C, 0x89,
-    0x92, 0xA7, 0x42, 0xEC, 0x15, 0x3B, 0xAF, 0x39, 0x79, 0x35, 0x3F, 0xB9, 0xA2, 0x0D, 0x00, 0x97,
-    0x80, 0x96, 0xD9, 0x67, 0x51, 0xB0, 0x21, 0x2B, 0x98, 0xD1, 0x67, 0xAA, 0x37, 0x7C, 0xA6, 0x97,
-    0xD7, 0x90, 0x31, 0x9F, 0xE4, 0x0D, 0x5C, 0x52, 0x88, 0x53, 0xBB, 0x4E, 0xE9, 0x12, 0x63, 0xBE,
-    0xAB, 0x98, 0x98, 0x4C, 0x2D, 0xB2, 0x51, 0x5B, 0x98, 0x86, 0xF3, 0x4D, 0x64, 0x93, 0xA8, 0x87,
-    0xC1, 0xDD, 0x90, 0x32, 0xD7, 0xDF, 0x85, 0x4F, 0x97, 0x3C, 0x45, 0x6F, 0xEF, 0x29, 0x3A, 0x71,
-    0xE0, 0xE0, 0x32, 0xA5, 0x45, 0x78, 0x40, 0xA8, 0xCA, 0x11, 0xE3, 0xDE, 0x3D, 0xF3, 0x4A, 0x3D,
-    0x20, 0xD7, 0x88, 0xAD, 0x85, 0xC8, 0xB1, 0xAC, 0xC4, 0x72, 0x6C, 0xCD, 0x8A, 0x4A, 0x73, 0x4A,
-    0x3C, 0x78, 0x0A, 0x77, 0x26, 0x04, 0x0D, 0x1C, 0xFB, 0x36, 0x0C, 0xAF, 0x17, 0x61, 0xC6, 0xB2,
-    0x9A, 0x10, 0x09, 0xE4, 0x3E, 0x84, 0x85, 0x23, 0x2A, 0x34, 0xB4, 0x14, 0x1D, 0x70, 0x00, 0xBF,
-    0xF9, 0x8A, 0xDC, 0x02, 0xA1, 0xF0, 0x21, 0xFA, 0x7E, 0xB7, 0xE8, 0xE3, 0xAF, 0x89, 0x5F, 0x9F,
-    0x3C, 0xD1, 0x87, 0xB2, 0x97, 0x7A, 0xF8, 0xE5, 0x3D, 0x32, 0xBB, 0x43, 0x2E, 0xBA, 0x7B, 0xC5,
-    0x6A, 0xBD, 0xC7, 0xB4, 0x22, 0x32, 0x22, 0x7C, 0x9B, 0x02, 0x27, 0x57, 0x7A, 0xC8, 0x12, 0xFB,
-    0xF7, 0x68, 0xAE, 0x2C, 0xEE, 0xB6, 0xB4, 0x89, 0xFA, 0x03, 0x85, 0x2C, 0xC7, 0x0C, 0xC5, 0xE6,
-    0xAA, 0x97, 0xE0, 0xA6, 0x6A, 0x7C, 0x05, 0xA5, 0x13, 0x97, 0x85, 0x32, 0x0A, 0xD8, 0xD1, 0x82,
-    0x27, 0xEC, 0xCD, 0xC3, 0x6B, 0x77, 0x8B, 0xEB, 0x25, 0x0C, 0xBD, 0xF8, 0x29, 0xC2, 0x2D, 0xC2,
-    0x0A, 0xE1, 0x83, 0x02, 0x46, 0x11, 0x22, 0xFD, 0x18, 0x5B, 0x96, 0x80, 0x46, 0x70, 0x89, 0x93,
-    0x4C, 0x04, 0x16, 0x52, 0xF6, 0x22, 0x48, 0xC5, 0x94, 0x93, 0xFF, 0x56, 0x32, 0x3E, 0x21, 0x54,
-    0xFA, 0x64, 0x0F, 0x64, 0xCB, 0x8B, 0xDF, 0x1B, 0x4C, 0x92, 0x85, 0xBF, 0x6C, 0x46, 0x75, 0x6D,
-    0x9D, 0x29, 0xBD, 0x84, 0x5E, 0xC3, 0x38, 0x68, 0x76, 0x45, 0xCC, 0x8F, 0x87, 0x3F, 0x86, 0xE9,
-    0xE1, 0xFF, 0x42, 0xED, 0xC5, 0x03, 0x7E, 0x9E, 0x60, 0x94, 0xC1, 0xA7, 0x9C, 0x39, 0xEC, 0x75,
-    0x8C, 0x6A, 0xC0, 0x55, 0xF2, 0xF4, 0x57, 0x7F, 0x2A, 0xE6, 0x5B, 0xF4, 0x7A, 0x7B, 0x80, 0x7C,
-    0xD7, 0x51, 0x5C, 0x8E, 0x32, 0x46, 0xF9, 0xF3, 0x64, 0x07, 0x01, 0xF8, 0xBD, 0x3E, 0xA8, 0xD3,
-    0x2F, 0x36, 0xC3, 0xA2, 0x0D, 0x7F, 0x2A, 0x22, 0x56, 0xE6, 0x30, 0x20, 0x5A, 0x92, 0x6B, 0x9D,
-    0x0D, 0xAC, 0x5C, 0xBB, 0xFE, 0x6B, 0xA0, 0x34, 0x09, 0x3A, 0xB5, 0xF2, 0x6B, 0xE3, 0x60, 0xEF,
-    0x2E, 0x3D, 0x04, 0xE8, 0x81, 0xE6, 0x16, 0x5D, 0x5D, 0x84, 0xEE, 0xE1, 0x41, 0x77, 0x5D, 0xA1,
-    0x5B, 0xCC, 0x3A, 0x3C, 0x31, 0x6C, 0x06, 0x7F, 0x48, 0x5E, 0x85, 0xEE, 0x12, 0x99, 0x32, 0xAA,
-    0xB6, 0x2A, 0x34, 0x56, 0xC3, 0x6A, 0x9D, 0x7C, 0x0A, 0x07, 0xA5, 0x9A, 0x5A, 0x49, 0x75, 0x4F,
-    0xD0, 0xFF, 0xEF, 0xB9, 0x31, 0x18, 0x1D, 0x72, 0x4E, 0x8B, 0x3A, 0x28, 0xC8, 0xEA, 0xB7, 0xEB,
-    0x70, 0x27, 0xA7, 0x50, 0x13, 0x7B, 0x28, 0x8B, 0x7D, 0xF7, 0xF0, 0x7A, 0x07, 0x31, 0x45, 0xA4,
-    0x9C, 0x82, 0x27, 0x3A, 0xF5, 0x8A, 0x9F, 0x62, 0xAC, 0x92, 0xC0, 0xC1, 0xB3, 0x34, 0xEC, 0x63,
-    0x8D, 0xED, 0xFE, 0xFC, 0xD8, 0x42, 0x4B, 0x0D, 0xC4, 0x78, 0xA6, 0x20, 0x3E, 0x8A, 0xF8, 0x61,
-    0x0B, 0xD4, 0x40, 0x6F, 0x2F, 0x5A, 0x2E, 0x22, 0xA2, 0x48, 0xA8, 0xEF, 0x42, 0x90, 0x0E, 0x38,
-    0xDD, 0x74, 0x19, 0xB0, 0x6C, 0x32, 0xAC, 0x7C, 0x07, 0xB0, 0xCC, 0x28, 0xB6, 0xB0, 0xB0, 0xBA,
-    0x34, 0x0A, 0x14, 0x41, 0xE5, 0x00, 0x01, 0xC3, 0x85, 0x2A, 0x2F, 0x3A, 0x45, 0x8D, 0x8B, 0xDB,
-    0xD2, 0xB2, 0x40, 0xB1, 0x01, 0xE1, 0x55, 0xB9, 0xAA, 0xFA, 0x34, 0x70, 0xD5, 0x07, 0x2B, 0xE0,
-    0x59, 0xD2, 0xAB, 0x7B, 0xCF, 0xDA, 0x6E, 0xAA, 0xE3, 0x55, 0x73, 0x5B, 0x53, 0xC1, 0xC2, 0x9D,
-    0xE3, 0xE5, 0xD7, 0x99, 0x7B, 0x8B, 0xAB, 0x5C, 0x8D, 0xF6, 0x81, 0x61, 0xC0, 0xB8, 0x44, 0x46,
-    0x47, 0x6E, 0x01, 0x1E, 0xC5, 0x7F, 0x94, 0x50, 0x3D, 0xA1, 0xE5, 0x48, 0x58, 0xD1, 0x83, 0x21,
-    0xE2, 0xA8, 0x5E, 0x68, 0xF9, 0x04, 0xFE, 0xA9, 0xF8, 0x76, 0xC6, 0x3C, 0x58, 0x9E, 0xDE, 0x33,
-    0xF4, 0x02, 0x79, 0x46, 0x58, 0xE2, 0x06, 0x5C, 0x3C, 0x5D, 0x16, 0xE4, 0xBA, 0x2A, 0xD5, 0x4A,
-    0xE2, 0x40, 0x88, 0x4E, 0x89, 0x60, 0x88, 0x95, 0xA7, 0xD5, 0x8B, 0xAC, 0x21, 0xC5, 0x08, 0x53,
-    0x5D, 0xB0, 0x0B, 0x7F, 0xD6, 0xB2, 0x6C, 0x8F, 0xFC, 0x65, 0xA7, 0xDE, 0x00, 0x3F, 0xBF, 0x6B,
-    0x99, 0x6F, 0xEA, 0x31, 0x2E, 0xB9, 0xE1, 0xA2, 0x43, 0x3A, 0x3B, 0x96, 0x8D, 0x2E, 0x86, 0x46,
-    0x08, 0x8C, 0xFE, 0x53, 0x1D, 0x76, 0x92, 0xB0, 0x30, 0x76, 0x52, 0xD0, 0x80, 0x45, 0x92, 0x27,
-    0x3B, 0x24, 0xFB, 0xC2, 0x7A, 0x40, 0x22, 0x50, 0x5D, 0x8C, 0x25, 0x24, 0xC2, 0x05, 0x04, 0xCD,
-    0xBD, 0x8E, 0xF8, 0x2D, 0x7A, 0x23, 0x79, 0x4D, 0x18, 0x12, 0x5D, 0x78, 0x24, 0xA6, 0xC6, 0x82,
-    0x6A, 0x53, 0xAC, 0xA4, 0x73, 0x4E, 0x8A, 0xAA, 0xDA, 0x18, 0x77, 0xB2, 0x4B, 0xE9, 0x5C, 0xF8,
-    0x73, 0x19, 0x2B, 0x42, 0x3E, 0x26, 0x2C, 0xEC, 0xB1, 0x6B, 0x76, 0x0D, 0xDD, 0xD5, 0x2F, 0xEC,
-    0xB6, 0x35, 0xD8, 0xC0, 0x26, 0xA5, 0x34, 0x80, 0x10, 0x7F, 0x29, 0x98, 0x46, 0x62, 0x89, 0x0F,
-    0x2C, 0xB3, 0xF1, 0x5B, 0x5B, 0xE5, 0x41, 0x6A, 0xB5, 0xA6, 0x77, 0x0B, 0x46, 0x9F, 0x18, 0xA5,
-    0x70, 0x01, 0x88, 0xFF, 0x20, 0xE3, 0xAF, 0x19, 0x0C, 0x16, 0x9B, 0xD6, 0xFF, 0xE9, 0x71, 0xA6,
-    0x22, 0x35, 0x06, 0x66, 0x55, 0x74, 0x92, 0x07, 0xAF, 0xCA, 0x3F, 0xBE, 0xD4, 0x89, 0x1B, 0xC3,
-    0xE7, 0x72, 0x95, 0xF2, 0x29, 0x15, 0xB1, 0x5F, 0xAA, 0xDB, 0x98, 0x58, 0x56, 0x88, 0x64, 0xD3,
-    0x10, 0x57, 0x53, 0xCB, 0x91, 0x70, 0xEA, 0x48, 0x81, 0x09, 0x9D, 0x15, 0xDD, 0x97, 0x30, 0x90,
-    0x02, 0x49, 0xF0, 0x8E, 0x9B, 0x49, 0x32, 0x7D, 0x8B, 0xC9, 0x16, 0x8F, 0xE0, 0xA8, 0xE7, 0x5F,
-    0xFE, 0xB3, 0x39, 0x4E, 0x9C, 0x64, 0x1E, 0x82, 0x9C, 0x48, 0x6E, 0x12, 0xE3, 0x2A, 0x0B, 0x86,
-    0x51, 0xF4, 0x64, 0xBF, 0xA0, 0x21, 0x52, 0x3A, 0xF9, 0x1E, 0x25, 0xED, 0x18, 0x82, 0xA3, 0xFC,
-    0x36, 0x05, 0x48, 0x16, 0x0E, 0x9A, 0x10, 0xBF, 0x20, 0x0C, 0xD6, 0xC7, 0x2D, 0x7A, 0x9A, 0x78,
-    0x72, 0x8B, 0xC2, 0x1B, 0x98, 0x30, 0x21, 0xB2, 0x5A, 0xEC, 0xD2, 0xC6, 0x47, 0xFD, 0x41, 0x2C,
-    0x9F, 0x41, 0xBE, 0x59, 0xF1, 0x0F, 0x13, 0xC6, 0x58, 0x8B, 0x29, 0x9D, 0x3B, 0xE0, 0x84, 0xAA,
-    0xCB, 0x11, 0x38, 0xBC, 0xE1, 0xB0, 0x19, 0xD1, 0x9E, 0xB9, 0xF8, 0xE1, 0x6C, 0xF6, 0x05, 0x4F,
-    0xA4, 0x71, 0xB4, 0x1B, 0x8B, 0x22, 0x68, 0xE7, 0x14, 0x14, 0x18, 0x14, 0xAA, 0x28, 0x59, 0xC2,
-    0x1E, 0x3D, 0x42, 0x54, 0x17, 0xDB, 0x0A, 0x59, 0xE0, 0xB0, 0x41, 0x68, 0x5B, 0x4C, 0x29, 0x21,
-    0xFA, 0x0A, 0x56, 0xB7, 0xDF, 0x41, 0x54, 0x44, 0x6F, 0x40, 0x70, 0xA4, 0x11, 0x6B, 0x95, 0x72,
-    0xEC, 0xB1, 0x9F, 0x60, 0x8F, 0xA4, 0x5F, 0x12, 0x7E, 0x86, 0xDC, 0x8C, 0x4B, 0xD9, 0xB7, 0xD9,
-    0x4A, 0x4C, 0x38, 0xFB, 0x64, 0x97, 0x34, 0x0B, 0x7B, 0xFB, 0x5D, 0x5D, 0x7F, 0x00, 0xAC, 0x58,
-    0xF6, 0x10, 0xBE, 0xB3, 0x93, 0x05, 0xF3, 0x9B, 0xF5, 0x24, 0x4E, 0x8C, 0x3D, 0xDD, 0x34, 0xD4,
-    0x42, 0xA2, 0xDD, 0xC8, 0xF5, 0x5A, 0x37, 0x2B, 0x6C, 0x28, 0xC6, 0x6E, 0x5E, 0x9A, 0xB0, 0x03,
-    0xD8, 0xDC, 0x27, 0x44, 0xC4, 0x1B, 0xC8, 0x85, 0x23, 0x29, 0x66, 0x35, 0x04, 0xC7, 0xBB, 0x17,
-    0x14, 0xEB, 0x56, 0xE3, 0x03, 0x7C, 0x1D, 0xDD, 0x2B, 0x20, 0x22, 0x83, 0x46, 0xED, 0x58, 0xE4,
-    0x41, 0x3F, 0x20, 0xE8, 0xA8, 0x21, 0x1A, 0x22, 0xE2, 0x6A, 0x04, 0xA8, 0x72, 0x54, 0x04, 0x8A,
-    0x21, 0x10, 0x0E, 0x48, 0x86, 0xA2, 0xA4, 0xA3, 0x73, 0x58, 0x40, 0xF3, 0x28, 0x81, 0xB0, 0xCE,
-    0xAE, 0x3C, 0xCF, 0xB1, 0x32, 0x4D, 0xDE, 0x8A, 0x05, 0xB9, 0x8F, 0x7A, 0x13, 0x91, 0x5D, 0xB5,
-    0x86, 0x16, 0xD9, 0x68, 0x66, 0x60, 0x09, 0x6B, 0x71, 0x78, 0x78, 0xFD, 0x0D, 0x0C, 0x81, 0x00,
-    0x18, 0x79, 0x28, 0xA8, 0x6E, 0xD2, 0xAF, 0x37, 0xEA, 0x41, 0x86, 0x2E, 0x4D, 0x0E, 0x34, 0x56,
-    0xF1, 0x77, 0x53, 0x9A, 0x9C, 0x88, 0x8F, 0x33, 0xCE, 0xDF, 0x8F, 0xEF, 0x20, 0x50, 0x64, 0xDF,
-    0x82, 0xE5, 0x7F, 0xEF, 0xE9, 0xD2, 0xE5, 0xD0, 0xB4, 0x3E, 0x86, 0x61, 0x99, 0x45, 0xAF, 0x00,
-    0x01, 0xC3, 0x4A, 0x31, 0x28, 0xE0, 0xD6, 0x01, 0xB0, 0xE9, 0x39, 0xA1, 0xF8, 0x9C, 0xA8, 0x70,
-    0xCC, 0x95, 0xC0, 0x1D, 0x51, 0x82, 0xF5, 0x5C, 0xCF, 0xF2, 0x54, 0x47, 0xB3, 0x8B, 0xA5, 0xA6,
-    0x58, 0x9B, 0xE0, 0x67, 0xDC, 0x90, 0xB7, 0xE9, 0xF6, 0x69, 0x9D, 0x45, 0x3D, 0x9B, 0x6D, 0xD1,
-    0x1A, 0xF7, 0x38, 0x7B, 0xA5, 0x09, 0x24, 0xA4, 0x7D, 0x51, 0x2C, 0x81, 0x8A, 0x31, 0xA1, 0x95,
-    0x02, 0x0B, 0xA0, 0x0B, 0x39, 0x0A, 0xC4, 0x26, 0x88, 0xC7, 0x87, 0xBB, 0xDA, 0xB0, 0xCA, 0x78,
-    0xA5, 0x40, 0x01, 0x73, 0x04, 0xA0, 0x76, 0x07, 0x57, 0xF2, 0xE7, 0x48, 0x03, 0x14, 0xEA, 0x2E,
-    0x68, 0x01, 0x36, 0x13, 0x89, 0x0F, 0x5F, 0x79, 0xDE, 0x38, 0x2F, 0xD2, 0xC0, 0x1C, 0x51, 0x23,
-    0x48, 0xBE, 0xC8, 0xD7, 0x1B, 0x01, 0x04, 0xD5, 0xC5, 0x6D, 0xE7, 0x9E, 0xBB, 0x20, 0x7F, 0x8B,
-    0xB1, 0x9B, 0xCB, 0x30, 0xDE, 0xFE, 0x6F, 0x6A, 0x14, 0x50, 0xAB, 0xD9, 0x4C, 0x8D, 0xD4, 0x87,
-    0x8D, 0x43, 0x3C, 0xAC, 0x5C, 0x7B, 0x0C, 0xF5, 0x2B, 0x08, 0xC9, 0xA2, 0xAB, 0x4A, 0x6E, 0xED,
-    0xB5, 0x5C, 0x9D, 0x79, 0x8A, 0x0A, 0xE4, 0x4B, 0x9F, 0xC0, 0x18, 0x8E, 0x40, 0x3E, 0x3A, 0x7D,
-    0x26, 0xF8, 0x29, 0x13, 0x3A, 0x2F, 0x52, 0x7E, 0x91, 0xB5, 0x99, 0x0F, 0x25, 0x18, 0x8F, 0xB6,
-    0xDD, 0xE4, 0xFE, 0x53, 0x80, 0x3D, 0xBF, 0x78, 0x49, 0xB9, 0x96, 0xB1, 0x98, 0x05, 0x0C, 0x5C,
-    0xA1, 0x88, 0xE8, 0xCF, 0x3A, 0x41, 0x8C, 0xE2, 0xDC, 0x76, 0xE8, 0xE4, 0x37, 0x49, 0xD8, 0xAD,
-    0x9F, 0xC5, 0x1A, 0xFC, 0x1A, 0xB9, 0xB6, 0x25, 0x6A, 0x67, 0xD8, 0xE9, 0x9F, 0x9D, 0x0B, 0x65,
-    0xD0, 0xF9, 0x5C, 0xB8, 0x1B, 0x10, 0x58, 0x5A, 0xCE, 0xA2, 0x4B, 0xB5, 0x81, 0xEA, 0x87, 0x11,
-    0xEB, 0x53, 0xA8, 0x7F, 0x51, 0x92, 0x4F, 0xD5, 0x06, 0x63, 0xB1, 0x84, 0xEE, 0xC2, 0x29, 0x17,
-    0x28, 0x9F, 0xF3, 0x3A, 0xC5, 0x72, 0x28, 0x14, 0x8E, 0x02, 0x54, 0x41, 0xA4, 0x5A, 0x9F, 0xAE,
-    0xF8, 0x43, 0x85, 0x26, 0x7B, 0x03, 0x09, 0x41, 0xF4, 0x2C, 0xF0, 0x68, 0xB9, 0x3E, 0x36, 0x2D,
-    0xB9, 0x91, 0x88, 0x5B, 0xAD, 0x29, 0xD8, 0x75, 0x63, 0x9B, 0x03, 0x98, 0x47, 0x1A, 0x4E, 0x8F,
-    0x5E, 0x25, 0xF0, 0x14, 0x3A, 0x83, 0xE6, 0x94, 0x0C, 0x1D, 0xB8, 0xDE, 0xBE, 0x67, 0x9D, 0x8F,
-    0xEC, 0x76, 0x93, 0xC0, 0x4D, 0xB4, 0x50, 0x67, 0x8C, 0x5A, 0xC3, 0x66, 0x19, 0xA6, 0x52, 0x20,
-    0x02, 0xC2, 0x9C, 0xF5, 0x76, 0x7E, 0x4B, 0x24, 0x9B, 0x75, 0x41, 0xEE, 0x06, 0x6A, 0x7C, 0xAE,
-    0x1C, 0x59, 0x07, 0x79, 0xF4, 0x9F, 0x73, 0xD7, 0x18, 0xEF, 0xF6, 0x7A, 0x21, 0x8A, 0xF5, 0x3F,
-    0xE3, 0x6E, 0x03, 0xE2, 0xE9, 0x96, 0x87, 0xEC, 0xE9, 0x31, 0x10, 0x49, 0x04, 0xBB, 0xC8, 0x8A,
-    0x9B, 0x45, 0xC9, 0x00, 0x04, 0x40, 0x28, 0x35, 0x69, 0xE9, 0x77, 0x8A, 0x0C, 0x4F, 0xCA, 0xD0,
-    0xA1, 0x64, 0x1C, 0x8A, 0x1E, 0x1E, 0x1A, 0xC3, 0x5A, 0x0A, 0xCF, 0x86, 0x9B, 0xD1, 0xD2, 0xB4,
-    0x42, 0x3C, 0xA6, 0x59, 0xB4, 0x5A, 0xD1, 0x01, 0xDE, 0x52, 0xA0, 0x14, 0x1C, 0xA4, 0x78, 0xAA,
-    0x1F, 0x62, 0xEA, 0x9B, 0xA2, 0xBA, 0x57, 0x3C, 0x8D, 0x7C, 0xBD, 0x3F, 0x22, 0xF5, 0x72, 0x25,
-    0x5E, 0x5C, 0x83, 0x21, 0x56, 0xB0, 0xFE, 0xC6, 0x7D, 0x08, 0xAF, 0x86, 0xCE, 0xB8, 0xD0, 0x24,
-    0x67, 0xA6, 0x64, 0x9C, 0x6B, 0xAA, 0xB2, 0x2D, 0x69, 0x3F, 0xA3, 0x3E, 0x66, 0x9F, 0x62, 0x83,
-    0x64, 0xEB, 0x7C, 0x79, 0xE2, 0x3C, 0x5B, 0xF3, 0x5F, 0xED, 0x64, 0x3A, 0xE7, 0x33, 0xB5, 0xF2,
-    0xAD, 0x52, 0x31, 0x47, 0x7D, 0x65, 0x70, 0x75, 0x40, 0x8B, 0x09, 0x6F, 0x81, 0x26, 0x02, 0xDF,
-    0x1E, 0xED, 0x52, 0x64, 0xFB, 0x5F, 0x09, 0x43, 0x58, 0xDA, 0x3A, 0x05, 0x13, 0x21, 0xAC, 0x6C,
-    0xD5, 0xD2, 0xA7, 0x41, 0xB9, 0xF0, 0x1B, 0x84, 0xC6, 0xFF, 0x94, 0x0E, 0x43, 0xA7, 0x21, 0x58,
-    0x8D, 0x80, 0x3D, 0x4D, 0xCB, 0xE8, 0x2D, 0x2A, 0xB9, 0xF7, 0x14, 0x6B, 0x4B, 0xF4, 0x36, 0xFB,
-    0xCE, 0x98, 0x82, 0xB2, 0x34, 0x2D, 0x2D, 0x87, 0x0D, 0x1E, 0x4D, 0xC4, 0xEB, 0xF0, 0xB2, 0x44,
-    0x04, 0xCB, 0x5B, 0x7D, 0xDE, 0xD2, 0x08, 0x6E, 0x5C, 0xB1, 0xB6, 0x2B, 0xBF, 0x76, 0x22, 0x75,
-    0x83, 0x43, 0x36, 0xCB, 0x8D, 0x29, 0x3C, 0x16, 0x96, 0xFE, 0x34, 0xD3, 0x72, 0xB6, 0xF6, 0xC6,
-    0xF8, 0x4B, 0x0D, 0xEB, 0x01, 0x08, 0x49, 0x22, 0x63, 0xB0, 0xCB, 0x4D, 0xB2, 0xD4, 0x62, 0x46,
-    0xBE, 0x2C, 0x7A, 0x4A, 0xBD, 0xD4, 0xF5, 0xAA, 0xE0, 0xCE, 0x8B, 0x6A, 0x16, 0x03, 0xC7, 0x3F,
-    0x69, 0x8B, 0x8C, 0xAC, 0xED, 0x53, 0x5D, 0x33, 0x00, 0xCE, 0xE0, 0xC7, 0x16, 0x10, 0xEE, 0x73,
-    0x2E, 0x05, 0x9B, 0x3A, 0xB2, 0xA7, 0xCE, 0x64, 0x89, 0xB3, 0x7D, 0x8E, 0x35, 0xFC, 0xFE, 0x95,
-    0x3F, 0xDB, 0x66, 0xEE, 0xDC, 0x65, 0xB6, 0x7C, 0xB7, 0x62, 0x9E, 0x5B, 0x1C, 0x7F, 0x5A, 0xA4,
-    0x6D, 0x0C, 0x7B, 0x32, 0x32, 0xAB, 0x25, 0x93, 0x6A, 0x23, 0xB5, 0xAE, 0x91, 0x1E, 0xAE, 0x4C,
-    0x51, 0xFD, 0x8E, 0xF9, 0x32, 0xB2, 0xEE, 0xA5, 0x96, 0x96, 0xA9, 0x88, 0x89, 0x6A, 0x65, 0x04,
-    0xBF, 0x73, 0xBB, 0xAD, 0x98, 0xCC, 0xA5, 0x57, 0x26, 0xEB, 0xC9, 0x59, 0x4C, 0x9D, 0xF3, 0xE7,
-    0x47, 0xA7, 0xA6, 0xD0, 0xBB, 0x85, 0x03, 0x7F, 0xA3, 0x5B, 0x7F, 0x10, 0xDB, 0x01, 0x4B, 0x87,
-    0x9B, 0x8C, 0x44, 0xE8, 0x2A, 0xEE, 0x98, 0x4A, 0xF5, 0x7B, 0xAE, 0x41, 0x55, 0xA5, 0xB5, 0x5D,
-    0x51, 0x13, 0x29, 0x9A, 0xBC, 0x5D, 0xB0, 0x34, 0x03, 0x28, 0x9B, 0x52, 0x86, 0x1E, 0x02, 0x46,
-    0x76, 0xDD, 0x8E, 0xD7, 0x91, 0x8D, 0xB1, 0x03, 0x35, 0x77, 0x60, 0xDB, 0x90, 0x92, 0xE2, 0x4C,
-    0x36, 0xC5, 0x3E, 0xC2, 0x63, 0xE7, 0xEE, 0x71, 0x18, 0xC3, 0x3E, 0x63, 0x64, 0xAD, 0x87, 0x3A,
-    0x39, 0xEF, 0x62, 0xCF, 0x0F, 0x79, 0xE3, 0x54, 0x47, 0xC2, 0x9F, 0x3F, 0xD0, 0xBF, 0xFE, 0x76,
-    0x8B, 0x9A, 0x9B, 0x3F, 0xE7, 0x99, 0xAE, 0x08, 0x6C, 0x13, 0x13, 0x66, 0xDD, 0x44, 0x68, 0x85,
-    0xF0, 0x77, 0x55, 0x78, 0xB9, 0xE5, 0x9D, 0x7C, 0x82, 0xB8, 0x5D, 0x2D, 0xB7, 0x8B, 0xFB, 0x4F,
-    0xA1, 0x6A, 0xD3, 0xBB, 0xAA, 0x05, 0x8A, 0x32, 0xF2, 0x0A, 0x50, 0x18, 0x80, 0x67, 0x93, 0x5F,
-    0x90, 0x8D, 0x69, 0x09, 0x95, 0x04, 0xCF, 0x30, 0x83, 0x9D, 0xD2, 0x31, 0x2A, 0x93, 0x0A, 0x50,
-    0xBE, 0x2C, 0xBA, 0x5B, 0xD8, 0x6B, 0xA3, 0x96, 0xB3, 0x62, 0x53, 0x0D, 0x09, 0xF8, 0x42, 0xA6,
-    0xB1, 0x5D, 0xE0, 0x17, 0x58, 0x2D, 0x95, 0x34, 0xD1, 0xE1, 0x5D, 0x75, 0xB2, 0xFF, 0xC8, 0xCF,
-    0xFE, 0xB3, 0xB2, 0xC1, 0x43, 0x3B, 0x9C, 0xE0, 0xBE, 0x51, 0xBB, 0x1A, 0x6D, 0xED, 0xD5, 0x24,
-    0xCF, 0x77, 0xBD, 0xA1, 0xD2, 0xAF, 0x6B, 0x78, 0x59, 0x61, 0x44, 0xA3, 0xE3, 0x66, 0x6A, 0xE9,
-    0xA5, 0x0B, 0x2F, 0x0F, 0x2E, 0xBC, 0xCC, 0xF8, 0xB7, 0xA7, 0x5D, 0x44, 0x32, 0x20, 0xFB, 0xB4,
-    0xA7, 0x48, 0x01, 0x85, 0x0F, 0x2D, 0x69, 0x33, 0x15, 0x8A, 0xE9, 0xA8, 0xF0, 0x0D, 0xEF, 0x5E,
-    0xA7, 0x45, 0x71, 0xD1, 0x0F, 0x6A, 0x75, 0xE2, 0x57, 0x2C, 0xC2, 0x45, 0x95, 0x4A, 0x41, 0x8C,
-    0x71, 0x99, 0x3C, 0x41, 0xBC, 0x65, 0x8E, 0x98, 0x7B, 0xA0, 0x9A, 0x9B, 0xB6, 0x00, 0xE2, 0x1B,
-    0x29, 0x62, 0x94, 0x40, 0x68, 0xB1, 0x4C, 0x2F, 0x79, 0x7B, 0xE9, 0xF5, 0x90, 0x6A, 0xB9, 0xD0,
-    0x90, 0x6A, 0xD4, 0x56, 0x1A, 0xE2, 0x82, 0xF1, 0x94, 0x4C, 0x10, 0xA9, 0x75, 0x04, 0x40, 0x7F,
-    0x1E, 0x3B, 0x3C, 0x7C, 0xD9, 0xA9, 0x5B, 0xC4, 0x9F, 0xAA, 0xAF, 0x04, 0x58, 0xA0, 0xEA, 0x5F,
-    0x98, 0xD2, 0x9C, 0xFE, 0xC3, 0xEC, 0x9C, 0x19, 0x52, 0x07, 0x56, 0x22, 0x36, 0x07, 0x01, 0x51,
-    0x18, 0x81, 0x3F, 0xEC, 0x15, 0x60, 0xC7, 0xF0, 0xC4, 0xA2, 0xD3, 0x80, 0xF4, 0xA0, 0x01, 0xE9,
-    0x1C, 0x8B, 0xAA, 0x81, 0x88, 0x00, 0x90, 0x11, 0x71, 0x78, 0x2D, 0x7A, 0x61, 0x00, 0xFE, 0x07,
-    0x4B, 0xD1, 0xBB, 0xD3, 0xD1, 0x31, 0xEA, 0x10, 0x42, 0x0B, 0xEB, 0x1E, 0x58, 0x7D, 0xAF, 0x3F,
-    0x5A, 0xB4, 0xA0, 0xE7, 0x81, 0x39, 0x60, 0x6F, 0x2C, 0x4E, 0xC8, 0xB3, 0x6A, 0x0F, 0x02, 0xA3,
-    0xBF, 0x31, 0xB0, 0x7D, 0x0A, 0x7D, 0x87, 0x9D, 0x11, 0xA3, 0x74, 0x34, 0x67, 0x97, 0x2A, 0x8C,
-    0x11, 0x21, 0x44, 0x39, 0xC5, 0xC9, 0x92, 0x17, 0xF5, 0x73, 0xB4, 0xF1, 0xC4, 0xDA, 0x87, 0x9D,
-    0x3A, 0x8D, 0xCC, 0x4E, 0xA6, 0x56, 0xDD, 0xB4, 0xEB, 0x0F, 0xF4, 0x6B, 0xDD, 0x30, 0x95, 0xEA,
-    0x32, 0x6D, 0xF2, 0x3F, 0x28, 0xF4, 0xD9, 0x41, 0xAC, 0xDF, 0x69, 0x69, 0xC1, 0xDB, 0xF9, 0xBB,
-    0x45, 0xC0, 0x6B, 0x1F, 0xDA, 0xE9, 0x21, 0xF4, 0xB1, 0x90, 0x3B, 0x78, 0xCC, 0x9C, 0x5F, 0xFD,
-    0x5B, 0xAA, 0x7F, 0x3B, 0x65, 0xCE, 0x97, 0xDB, 0x3D, 0xE1, 0x66, 0x10, 0x4D, 0x54, 0xBA, 0x5B,
-    0x0F, 0x53, 0xE6, 0x9C, 0xE6, 0xD6, 0x2D, 0x44, 0xC6, 0x3A, 0xA7, 0xDF, 0xF3, 0xDD, 0xD6, 0x73,
-    0x9B, 0x08, 0x9C, 0xF9, 0x4D, 0x97, 0xAC, 0x0A, 0x97, 0x7A, 0xE1, 0xB7, 0x98, 0x84, 0x5E, 0x8A,
-    0x64, 0x48, 0x60, 0xCF, 0xF9, 0x14, 0x2E, 0x39, 0xF5, 0x93, 0x06, 0x83, 0x50, 0x6F, 0x0A, 0xBF,
-    0x7A, 0xE5, 0x75, 0x7F, 0x24, 0x7B, 0xF8, 0x77, 0x0B, 0x76, 0xBA, 0xBC, 0xD7, 0xB0, 0x1E, 0x05,
-    0xC3, 0xA6, 0x46, 0xC3, 0xA3, 0x56, 0xF8, 0xBD, 0x87, 0x01, 0xD7, 0x2E, 0x2A, 0xD5, 0x95, 0x5A,
-    0x2D, 0xBD, 0xC1, 0x90, 0x90, 0xD9, 0xF1, 0x2B, 0xC2, 0x8A, 0xA2, 0x6F, 0xDA, 0xD5, 0x9C, 0xDF,
-    0x3E, 0x87, 0x96, 0x06, 0x9F, 0xB5, 0xF6, 0x5D, 0x5B, 0xA5, 0x63, 0xE6, 0x35, 0xAE, 0x35, 0xCA,
-    0x2B, 0xF5, 0xE3, 0x06, 0xF7, 0x12, 0xDB, 0xAA, 0x3B, 0x08, 0xBF, 0xF4, 0x4D, 0xDD, 0xD6, 0xF1,
-    0x31, 0x34, 0xEE, 0x95, 0xE8, 0x47, 0x76, 0xF8, 0x8A, 0xD9, 0x6F, 0xAF, 0x4C, 0x90, 0x87, 0x47,
-    0x36, 0x84, 0xC3, 0x72, 0x6D, 0x70, 0xCE, 0x2A, 0xFC, 0x0B, 0xDE, 0xAC, 0x7F, 0xFE, 0xD8, 0x7C,
-    0xD9, 0xDC, 0xFF, 0x27, 0x50, 0x71, 0x59, 0x2C, 0xA7, 0x12, 0x63, 0xEE, 0xB6, 0xC7, 0x9F, 0x63,
-    0x29, 0xC2, 0x55, 0x11, 0x9B, 0x5F, 0x36, 0xB8, 0xE9, 0xBF, 0x94, 0xDB, 0xB8, 0x87, 0x3E, 0x74,
-    0xA2, 0x37, 0xDA, 0x07, 0xFF, 0x99, 0x00, 0x71, 0x67, 0xD4, 0x28, 0x64, 0x48, 0xA1, 0xD6, 0xE7,
-    0x12, 0xF6, 0xF1, 0xC7, 0x0B, 0x9D, 0x41, 0x98, 0x7D, 0xE5, 0xCB, 0x46, 0x67, 0x10, 0x99, 0xDF,
-    0x31, 0x1F, 0xC1, 0xCF, 0xC5, 0x0D, 0x57, 0xD3, 0x4C, 0xAD, 0x1F, 0x13, 0xD7, 0x9D, 0x4A, 0x56,
-    0x59, 0x9F, 0x1C, 0x65, 0x5F, 0x59, 0xCF, 0xF8, 0xDF, 0x3E, 0xE0, 0x76, 0xBE, 0xCD, 0xFE, 0x51,
-    0x54, 0xFF, 0x83, 0xF5, 0x1D, 0xD6, 0x22, 0xE9, 0xC6, 0xDA, 0x4E, 0x99, 0xD7, 0xD2, 0x73, 0x60,
-    0xE6, 0x73, 0x53, 0x0F, 0x37, 0x7C, 0x61, 0x32, 0x2A, 0x2E, 0xE8, 0xAE, 0xFB, 0x9B, 0xA9, 0x09,
-    0x17, 0x0B, 0xC5, 0x35, 0x02, 0x40, 0x16, 0xD5, 0x12, 0x90, 0x66, 0xDA, 0xA2, 0xBA, 0x17, 0xBE,
-    0x80, 0x97, 0xCF, 0x9C, 0x62, 0x3C, 0x7C, 0x98, 0x85, 0x7B, 0x68, 0x52, 0xC1, 0xC4, 0xED, 0xB9,
-    0x35, 0x8C, 0xC6, 0x2C, 0x77, 0x23, 0xB3, 0xA3, 0xD9, 0x9F, 0x70, 0x5D, 0xB5, 0xF9, 0x48, 0x7E,
-    0xFE, 0x90, 0x0C, 0x31, 0x5B, 0x71, 0xFE, 0x5C, 0x8C, 0xB5, 0xB0, 0x53, 0x4D, 0xB1, 0x2B, 0xF6,
-    0x26, 0x40, 0x44, 0x53, 0xA2, 0x98, 0xF1, 0x92, 0xDF, 0x08, 0xCB, 0xD9, 0x95, 0xFD, 0x63, 0xB3,
-    0xD1, 0x13, 0xCF, 0xCC, 0xB9, 0x76, 0x33, 0x03, 0x01, 0x76, 0x17, 0xE6, 0xF7, 0xD6, 0xD8, 0xE4,
-    0x97, 0x99, 0x94, 0x57, 0xE0, 0x11, 0xE9, 0x69, 0x9F, 0x55, 0x6D, 0xE4, 0xEA, 0xF2, 0x77, 0xB0,
-    0x2B, 0x7C, 0x6C, 0xC2, 0xAA, 0x83, 0x40, 0xEB, 0xB7, 0x2D, 0xBF, 0x96, 0xD2, 0x53, 0x08, 0xB5,
-    0x56, 0x6F, 0x64, 0x67, 0x89, 0x9C, 0x70, 0x1B, 0x64, 0x41, 0x57, 0x22, 0x07, 0x0F, 0x20, 0x47,
-    0x56, 0x61, 0x6D, 0x5C, 0x78, 0xAC, 0xF4, 0x9B, 0xA8, 0x94, 0xC1, 0x23, 0x5F, 0x9D, 0x2C, 0x93,
-    0x65, 0xBC, 0x84, 0xEA, 0x5C, 0xE0, 0x9B, 0x3D, 0x81, 0x3A, 0xC4, 0xF1, 0xC0, 0x35, 0xCB, 0x4D,
-    0xF8, 0x3A, 0x41, 0x26, 0x3D, 0x15, 0x56, 0xF4, 0x83, 0x8A, 0x5D, 0x4A, 0x58, 0xB8, 0x81, 0xE8,
-    0x9F, 0x38, 0xE3, 0x96, 0x0D, 0x59, 0x00, 0x30, 0x4E, 0x47, 0x28, 0x13, 0x79, 0x03, 0x96, 0x61,
-    0xAA, 0xB2, 0x32, 0x31, 0x1B, 0x4D, 0xDC, 0xD4, 0x00, 0x54, 0xB3, 0xCF, 0x01, 0xEB, 0x5D, 0x6D,
-    0xF9, 0xDA, 0x86, 0xFA, 0x9C, 0x31, 0x2F, 0x99, 0x23, 0xF9, 0xC6, 0x82, 0xE0, 0xCE, 0x36, 0x50,
-    0x04, 0x96, 0x51, 0xAB, 0xED, 0xE2, 0x76, 0xA6, 0x97, 0x35, 0x5A, 0xF4, 0xF9, 0x7B, 0x3A, 0x5B,
-    0x74, 0x7F, 0xD6, 0x70, 0x0D, 0x84, 0xC1, 0xC7, 0x5D, 0x74, 0x47, 0xCE, 0xA2, 0x0A, 0x44, 0x82,
-    0x50, 0xE4, 0x67, 0xC5, 0x42, 0x09, 0x11, 0xAD, 0xBA, 0xD7, 0x84, 0xC7, 0xFB, 0x3F, 0x18, 0x23,
-    0xDB, 0xA7, 0x5D, 0x64, 0x9F, 0x10, 0xFD, 0x92, 0x71, 0xFD, 0xB8, 0x9C, 0x64, 0x92, 0xA3, 0x89,
-    0xF5, 0xB9, 0xD6, 0xBD, 0x6B, 0xED, 0x38, 0x38, 0xFD, 0xF0, 0xD9, 0x61, 0x4F, 0x93, 0x4E, 0xF0,
-    0xCA, 0xCF, 0x14, 0x57, 0x2F, 0xCE, 0x6D, 0x34, 0xE7, 0xFE, 0x99, 0xCC, 0xEB, 0x32, 0x04, 0x97,
-    0x20, 0xBE, 0x3D, 0x5E, 0x23, 0x98, 0x96, 0x95, 0x68, 0x18, 0xD8, 0x08, 0x2F, 0xB1, 0x76, 0xCD,
-    0x31, 0x61, 0x28, 0x68, 0x1D, 0xDE, 0xD7, 0x50, 0xE1, 0x92, 0x2A, 0x36, 0x13, 0xDB, 0xE3, 0xEF,
-    0x5D, 0x92, 0x3F, 0x77, 0x77, 0x1F, 0xF5, 0xE6, 0xA9, 0x66, 0x6D, 0xCC, 0xBF, 0x92, 0x71, 0x10,
-    0xAD, 0x74, 0x1A, 0x62, 0x69, 0x42, 0x2B, 0xE1, 0xFF, 0x77, 0xEF, 0x32, 0x53, 0x07, 0x14, 0xAD,
-    0xD8, 0x1B, 0xB0, 0x8B, 0x36, 0xFE, 0x47, 0x60, 0x51, 0xAC, 0xCD, 0x9B, 0xFB, 0x4D, 0xCC, 0xE6,
-    0x9E, 0x83, 0x16, 0x9E, 0x84, 0x78, 0xBA, 0xAF, 0x76, 0x25, 0xBC, 0xA3, 0x1C, 0x56, 0x93, 0x58,
-    0x37, 0x56, 0x13, 0x5E, 0xC4, 0x3B, 0xD0, 0xF6, 0x61, 0x21, 0x06, 0x73, 0xA2, 0x65, 0x54, 0xFD,
-    0x01, 0xAC, 0xB5, 0xE8, 0x35, 0xB9, 0xB2, 0x10, 0x9D, 0x5F, 0xEC, 0x15, 0xAE, 0xB2, 0x98, 0x20,
-    0x5A, 0xFF, 0xEE, 0x5F, 0xD2, 0x9A, 0xD5, 0x76, 0xB5, 0xB5, 0x6B, 0x8F, 0x57, 0x4D, 0xCE, 0xA2,
-    0xEA, 0xFC, 0xD5, 0x29, 0x2D, 0xF5, 0x26, 0xF8, 0x69, 0x83, 0x3E, 0xAF, 0x7D, 0x8E, 0x42, 0x95,
-    0xFC, 0xB9, 0x5E, 0xDB, 0x3D, 0x21, 0x5E, 0x50, 0x0B, 0x33, 0xA2, 0x5C, 0x85, 0x3D, 0x3D, 0xE1,
-    0x27, 0x10, 0x39, 0x06, 0xAC, 0x58, 0xA7, 0x51, 0x26, 0x84, 0xF9, 0x32, 0xED, 0xF6, 0x59, 0x9E,
-    0x8B, 0xEA, 0xA8, 0x49, 0xC5, 0x06, 0x1D, 0x82, 0xB7, 0xC4, 0x88, 0x2E, 0x65, 0x60, 0x07, 0x2B,
-    0xF1, 0xA3, 0x92, 0x17, 0x01, 0x9C, 0xAD, 0x2C, 0x30, 0x56, 0xDE, 0x97, 0x2A, 0x6D, 0xDC, 0x8A,
-    0xEF, 0x60, 0x6E, 0x9E, 0x8E, 0xD3, 0x5F, 0x8F, 0xB3, 0xD8, 0xAA, 0x47, 0x57, 0x90, 0x9C, 0xA2,
-    0xB8, 0xDA, 0x75, 0x0E, 0xC0, 0x05, 0x27, 0xE0, 0x2B, 0xCE, 0x8D, 0x58, 0xFA, 0x93, 0x6D, 0x02,
-    0x3F, 0x68, 0x23, 0x96, 0x07, 0x5C, 0xD9, 0x69, 0x84, 0xBA, 0xDB, 0x22, 0xB5, 0x9F, 0xAF, 0x98,
-    0x53, 0xDA, 0xE9, 0xF2, 0x8B, 0xB9, 0xC2, 0x1F, 0x31, 0xD4, 0x61, 0xEF, 0xE2, 0xD4, 0xC3, 0x8E,
-    0xF3, 0x9E, 0xFA, 0xDA, 0x71, 0xD2, 0x27, 0xDE, 0x5C, 0x39, 0x33, 0xEB, 0xE4, 0x9B, 0x99, 0x99,
-    0x22, 0x37, 0x1B, 0xDD, 0xE9, 0x76, 0x80, 0x2C, 0xF7, 0xE9, 0xAF, 0xC2, 0x11, 0xFF, 0xFE, 0x78,
-    0xB8, 0x74, 0x15, 0xF9, 0x30, 0xC8, 0xD7, 0xDD, 0x5B, 0x82, 0x07, 0x76, 0x6F, 0x39, 0xED, 0xEE,
-    0x53, 0x44, 0x4D, 0x27, 0x38, 0x1E, 0xBE, 0x74, 0xEA, 0x04, 0xCF, 0x14, 0x7B, 0x44, 0xCB, 0x31,
-    0x94, 0x1C, 0xB4, 0x1F, 0x78, 0x82, 0x23, 0x6E, 0x3D, 0x62, 0x82, 0xC3, 0x09, 0xA4, 0xCE, 0xF6,
-    0x04, 0x57, 0xDB, 0xED, 0xF7, 0xC6, 0xC3, 0x4C, 0xE3, 0xD6, 0xDA, 0x7E, 0xAF, 0x3D, 0x4B, 0xC9,
-    0x9E, 0x56, 0xEC, 0xE2, 0xC3, 0x3E, 0x5B, 0x0C, 0x1B, 0x31, 0xD0, 0x44, 0xD7, 0x98, 0xCE, 0x32,
-    0xC2, 0x46, 0x1D, 0x61, 0x3D, 0xA9, 0x73, 0xB2, 0x69, 0x99, 0x87, 0xCD, 0x24, 0x81, 0x68, 0x8C,
-    0xE7, 0xB4, 0xBC, 0xA1, 0x72, 0x85, 0xFE, 0x87, 0xC0, 0x6D, 0xC3, 0x1D, 0x08, 0x19, 0x3A, 0x9F,
-    0x9B, 0x60, 0x2B, 0xE4, 0xB4, 0x07, 0x45, 0x26, 0x10, 0xE4, 0x96, 0x38, 0xF9, 0x87, 0x97, 0xD8,
-    0x89, 0x0D, 0x94, 0x8B, 0x2A, 0x11, 0x11, 0x65, 0xD8, 0x22, 0x19, 0x09, 0x30, 0x33, 0xF6, 0x72,
-    0x4A, 0xF1, 0xE1, 0x51, 0x8C, 0x68, 0x83, 0xC5, 0x09, 0x50, 0x3E, 0xF5, 0x3D, 0x49, 0xCB, 0x73,
-    0x9E, 0x5D, 0x26, 0xD7, 0x47, 0x94, 0x63, 0x6B, 0xEA, 0xC9, 0x6D, 0x15, 0xD1, 0x14, 0x32, 0xEC,
-    0x98, 0xB1, 0xF2, 0x7C, 0xA9, 0x50, 0x39, 0xB6, 0x43, 0xCB, 0xB4, 0x98, 0x9B, 0x7D, 0x2C, 0x7D,
-    0x2D, 0x1F, 0xCD, 0xF9, 0x86, 0x8F, 0xD6, 0x7D, 0x2E, 0x75, 0x5C, 0xA5, 0xBA, 0x61, 0x52, 0x8D,
-    0xE2, 0x45, 0x55, 0xAF, 0x1E, 0x48, 0xF2, 0xEA, 0x7B, 0xAA, 0x7B, 0xD2, 0xFD, 0x6F, 0xBB, 0xE8,
-    0xC4, 0x38, 0x4E, 0x7D, 0x21, 0x55, 0x98, 0xA4, 0x6F, 0xBF, 0xAD, 0x5D, 0x03, 0x87, 0x5C, 0x1D,
-    0xC0, 0xE4, 0x75, 0x0D, 0x54, 0x2C, 0xC6, 0xA8, 0xD2, 0x8E, 0x00, 0x75, 0xAA, 0x45, 0xC5, 0xA3,
-    0xA7, 0xFE, 0x3B, 0x16, 0x43, 0x33, 0x1C, 0x0E, 0x6A, 0x11, 0x31, 0x7C, 0x87, 0x41, 0x66, 0x0A,
-    0x05, 0x08, 0xD9, 0x41, 0xB3, 0x60, 0x1D, 0xCD, 0x0A, 0xA1, 0xE7, 0x80, 0xF5, 0x55, 0x0B, 0x7B,
-    0xA2, 0x65, 0x45, 0xBB, 0x19, 0x54, 0xDA, 0x64, 0xD0, 0x45, 0xB7, 0x59, 0xAC, 0x70, 0x22, 0x1F,
-    0xB3, 0xE7, 0x20, 0xE6, 0xB1, 0x85, 0x8C, 0x49, 0x46, 0x78, 0x55, 0x48, 0x19, 0x57, 0x67, 0xF6,
-    0x6B, 0xBF, 0x09, 0xB4, 0x2C, 0x38, 0xA5, 0x9A, 0x45, 0xE6, 0xD9, 0x35, 0x32, 0x3A, 0xE2, 0xF3,
-    0xA0, 0x13, 0x9D, 0xC4, 0xD2, 0x10, 0xC4, 0x62, 0xD8, 0xFF, 0x51, 0xEF, 0x62, 0x49, 0x13, 0x54,
-    0x55, 0xBD, 0xB4, 0xF4, 0xA9, 0x86, 0xDC, 0x0B, 0x10, 0x87, 0xD6, 0x0F, 0x07, 0x5A, 0x1C, 0x1C,
-    0x97, 0x07, 0x5A, 0x13, 0xDC, 0x85, 0x5A, 0x41, 0x61, 0x35, 0x28, 0x7F, 0xBE, 0x10, 0xF7, 0x35,
-    0x3C, 0x7E, 0x26, 0xB0, 0x40, 0x73, 0xA4, 0x76, 0x99, 0x77, 0xD0, 0x9B, 0x45, 0xEB, 0x2A, 0x07,
-    0xF2, 0xDD, 0x78, 0xEC, 0x14, 0x6D, 0x0C, 0xAB, 0x1D, 0xD2, 0x4C, 0x14, 0x99, 0xA3, 0x90, 0x9F,
-    0xAC, 0xAE, 0x8A, 0x8F, 0x72, 0xBC, 0xED, 0x6C, 0xEE, 0xA9, 0x3D, 0x39, 0xCB, 0x7C, 0x05, 0xAD,
-    0x75, 0x5B, 0x80, 0xFC, 0x8F, 0xBC, 0x0E, 0x7A, 0x9F, 0x5E, 0x86, 0x5A, 0xFA, 0xD3, 0xFF, 0x09,
-    0x7B, 0x1E, 0xAE, 0x1F, 0x2D, 0x74, 0xD5, 0x3C, 0x94, 0xF2, 0x64, 0x42, 0x98, 0x5C, 0x01, 0x7B,
-    0x69, 0xC1, 0xF8, 0x7F, 0xC8, 0x00, 0x0D, 0x53, 0x6C, 0x0C, 0xBB, 0x16, 0xDC, 0x42, 0x2B, 0xBC,
-    0x6D, 0x06, 0xEE, 0x22, 0x46, 0x52, 0xBD, 0x61, 0x70, 0x11, 0x6F, 0x74, 0xCF, 0xD3, 0x6D, 0xC7,
-    0x38, 0x6B, 0xA3, 0xED, 0xD8, 0xE8, 0x5A, 0xA3, 0x1C, 0x15, 0xE5, 0x1F, 0x4C, 0xCB, 0x68, 0xE7,
-    0x41, 0xD7, 0x0D, 0x49, 0x51, 0x34, 0x39, 0x33, 0x3B, 0x89, 0x25, 0x12, 0x84, 0xC8, 0x76, 0x5D,
-    0x41, 0x57, 0x4F, 0xDB, 0xAF, 0x93, 0xA5, 0xCA, 0xFD, 0xFE, 0x46, 0x57, 0xE0, 0x60, 0xAB, 0x18,
-    0x98, 0xD5, 0x6F, 0xCC, 0x43, 0x88, 0x29, 0x52, 0xB2, 0x12, 0x35, 0x04, 0x93, 0x33, 0x17, 0x05,
-    0xF3, 0x29, 0xF8, 0x05, 0x12, 0x35, 0xD7, 0x4B, 0xB6, 0xFC, 0x93, 0x11, 0x23, 0x0A, 0xFE, 0x1A,
-    0x42, 0xBC, 0x2C, 0x95, 0x63, 0x67, 0x26, 0x22, 0x71, 0x09, 0x5A, 0xCC, 0x01, 0x0F, 0xB1, 0x90,
-    0xA4, 0xB6, 0x41, 0x55, 0xC8, 0xD2, 0xAD, 0x8C, 0x3F, 0xDB, 0x80, 0x07, 0xD3, 0x98, 0xB8, 0x5F,
-    0x52, 0x25, 0x2B, 0xA3, 0xFF, 0xD1, 0xA9, 0x64, 0x7D, 0xEA, 0xDD, 0xD6, 0xD5, 0xB6, 0x8A, 0x15,
-    0x8A, 0xD5, 0x2C, 0x82, 0x13, 0x64, 0x05, 0xB5, 0xBD, 0x51, 0x8F, 0x0E, 0xE0, 0x3E, 0xBD, 0xA7,
-    0xBB, 0x75, 0xDC, 0x20, 0x6B, 0x4E, 0xB2, 0x16, 0x44, 0x9D, 0x5B, 0x92, 0xF5, 0x1E, 0xC9, 0xFA,
-    0xDF, 0x4F, 0x21, 0xEB, 0x94, 0x19, 0xD0, 0x36, 0x19, 0xD3, 0x66, 0x42, 0x86, 0xED, 0xF3, 0x71,
-    0xED, 0xF5, 0x5F, 0xC9, 0x97, 0x5E, 0xFF, 0x02, 0x82, 0x4F, 0x05, 0xCC, 0x35, 0xF6, 0xAA, 0x94,
-    0x91, 0xA1, 0x6C, 0xD1, 0x84, 0x3F, 0x6F, 0x9C, 0xEF, 0x19, 0xDD, 0xAE, 0x1C, 0xA5, 0xE2, 0x57,
-    0x91, 0xE9, 0xFF, 0x26, 0xAC, 0xA5, 0xA7, 0x01, 0x0F, 0x79, 0x1A, 0x62, 0x39, 0x02, 0xFE, 0x2D,
-    0x96, 0xCD, 0xB6, 0x3A, 0x43, 0x60, 0x8D, 0x42, 0x56, 0x26, 0x52, 0x10, 0xA4, 0x9B, 0x96, 0xDE,
-    0xFE, 0x9B, 0x42, 0x0A, 0xD9, 0x2C, 0x0B, 0x62, 0xDC, 0x64, 0x30, 0x62, 0x17, 0xEF, 0x72, 0xD8,
-    0x78, 0x92, 0x14, 0xCA, 0x61, 0xED, 0x9A, 0xC3, 0xEE, 0xDC, 0x87, 0xC3, 0xAA, 0x68, 0xA3, 0xB7,
-    0xE5, 0x42, 0xBB, 0xAA, 0x6D, 0x92, 0x22, 0xDD, 0x21, 0xC5, 0xA9, 0xF0, 0x71, 0x06, 0xC3, 0x8C,
-    0x79, 0xEE, 0xCE, 0x33, 0x5B, 0xF0, 0x71, 0x59, 0x4A, 0xE1, 0x2B, 0x28, 0x99, 0xA4, 0x12, 0xBE,
-    0x82, 0x41, 0x29, 0x63, 0x4C, 0x9F, 0x84, 0xB1, 0x89, 0x4E, 0x55, 0xBF, 0x40, 0xCC, 0xFF, 0xDB,
-    0x95, 0x62, 0x93, 0x36, 0xF9, 0xAA, 0xD9, 0xE6, 0xAB, 0x72, 0xE6, 0x2B, 0x35, 0x94, 0x01, 0xD7,
-    0xD4, 0x1A, 0xB7, 0x31, 0x66, 0x99, 0x40, 0xC0, 0xF3, 0x0A, 0x68, 0x4C, 0x58, 0x85, 0xF9, 0x93,
-    0xE1, 0x2C, 0x47, 0xA9, 0x71, 0x2D, 0x86, 0xF2, 0x80, 0x5A, 0xC7, 0xEA, 0x93, 0x14, 0x96, 0x93,
-    0x50, 0xE3, 0x41, 0xDB, 0x87, 0x30, 0x76, 0x10, 0xBD, 0x0D, 0xC1, 0xC3, 0xA5, 0x44, 0xE8, 0x98,
-    0xB3, 0xD1, 0xFC, 0x5B, 0xA6, 0x5D, 0xE4, 0xB4, 0xEF, 0x19, 0x44, 0xCE, 0x82, 0x38, 0x74, 0xBA,
-    0x87, 0x53, 0x9C, 0x30, 0x62, 0x43, 0x1A, 0xC4, 0x50, 0x55, 0x6B, 0x4F, 0x69, 0x64, 0x1F, 0x75,
-    0x2A, 0x3D, 0xBA, 0xA2, 0x17, 0x67, 0x0F, 0x2D, 0xDE, 0xD6, 0xD6, 0x69, 0x2B, 0xED, 0x49, 0x56,
-    0x18, 0x2D, 0x39, 0x67, 0x02, 0x4F, 0xBE, 0x4B, 0x1C, 0xA2, 0x32, 0x32, 0x1F, 0x9D, 0x30, 0x7A,
-    0xC6, 0xDA, 0x16, 0x8C, 0x85, 0xFB, 0x53, 0xDB, 0x4F, 0x47, 0x65, 0xC0, 0x4C, 0x78, 0xC2, 0x10,
-    0x29, 0xEB, 0x18, 0xF8, 0x09, 0x44, 0x51, 0x32, 0x62, 0xF0, 0xB4, 0x13, 0x5E, 0xE3, 0x7A, 0x83,
-    0x42, 0xE3, 0x14, 0xDA, 0xC1, 0x6D, 0xC9, 0xF6, 0xC6, 0xD3, 0xE5, 0x62, 0xBE, 0xBC, 0x72, 0x0D,
-    0xDE, 0xD0, 0xB4, 0xD8, 0x01, 0xEF, 0xD8, 0x85, 0x18, 0x6A, 0xF1, 0x16, 0x6A, 0xEF, 0xDD, 0xE5,
-    0xC6, 0x9D, 0xAE, 0xE1, 0xFC, 0x0E, 0xD7, 0x43, 0x73, 0xFA, 0x76, 0xB0, 0x7B, 0x59, 0x7B, 0x68,
-    0xDA, 0x8E, 0x3D, 0x34, 0x07, 0x5E, 0xD6, 0x60, 0x8D, 0x6A, 0xA7, 0xA0, 0xD9, 0x50, 0xD5, 0xC3,
-    0x86, 0x96, 0xDE, 0xBC, 0xBC, 0x55, 0xE5, 0x52, 0xB1, 0xD1, 0x15, 0xDB, 0xB6, 0x68, 0xD3, 0x53,
-    0xF6, 0xEA, 0x62, 0xFD, 0x0B, 0x2B, 0x60, 0xD8, 0x9B, 0x0B, 0xB8, 0xA6, 0x91, 0xA3, 0xCF, 0xA8,
-    0x91, 0xE7, 0x2B, 0x9D, 0xB6, 0xE1, 0x1A, 0x4F, 0x7E, 0xC7, 0xBE, 0x8E, 0xCA, 0x35, 0x64, 0x50,
-    0xD2, 0x1D, 0x8F, 0x64, 0xD7, 0x57, 0x99, 0x7C, 0x2A, 0x52, 0xDB, 0x6A, 0xCB, 0x39, 0x6B, 0x95,
-    0xA2, 0x0E, 0xB6, 0x3A, 0x55, 0xB6, 0xB8, 0xA2, 0x18, 0x5A, 0x71, 0xDA, 0xE3, 0x75, 0xEA, 0xE7,
-    0xEA, 0x28, 0xCF, 0x4B, 0x93, 0x97, 0x99, 0x2A, 0xBC, 0x6C, 0x6F, 0x70, 0xE8, 0xB2, 0xC6, 0x81,
-    0xCB, 0xF0, 0x8D, 0x43, 0x4C, 0x68, 0x6E, 0xEE, 0xAA, 0xAB, 0x60, 0x5C, 0x8F, 0x4C, 0xE3, 0x16,
-    0x62, 0x42, 0x5F, 0xBA, 0x86, 0xA5, 0x7A, 0xA9, 0xD7, 0x4B, 0x93, 0x37, 0x3B, 0xD5, 0xDB, 0x38,
-    0xBD, 0x39, 0x17, 0x2B, 0x96, 0x5B, 0xAA, 0xC1, 0xA0, 0x71, 0x36, 0x4F, 0x73, 0x41, 0x15, 0x5F,
-    0x7C, 0xEB, 0xAF, 0x5C, 0x7F, 0x59, 0x57, 0x30, 0xA4, 0xD5, 0x46, 0xAE, 0x1D, 0x9A, 0x6B, 0x86,
-    0x96, 0xDC, 0x3A, 0xBC, 0xAE, 0xDD, 0xA5, 0xE0, 0x5B, 0xA8, 0xF9, 0xA3, 0x25, 0x49, 0xAE, 0xB3,
-    0x9A, 0x6B, 0x80, 0x16, 0xDD, 0xE7, 0x16, 0x9D, 0x6B, 0x68, 0xE6, 0x5A, 0xC2, 0x19, 0x37, 0x77,
-    0xD7, 0x97, 0x9A, 0xB6, 0x66, 0xAC, 0x80, 0x3B, 0x45, 0x97, 0xD6, 0x6E, 0x79, 0x06, 0x37, 0x62,
-    0x4A, 0xA0, 0xD4, 0x59, 0x1E, 0xDA, 0xDA, 0xCF, 0xD5, 0xAF, 0xB5, 0x53, 0x63, 0x43, 0xC7, 0x63,
-    0xC1, 0xA4, 0x94, 0x8A, 0xE9, 0x5E, 0x77, 0x5F, 0xD2, 0x3D, 0xCB, 0xD4, 0x21, 0xAB, 0xDD, 0xAC,
-    0x6B, 0x15, 0xE8, 0x59, 0x74, 0xA7, 0x80, 0x86, 0xB4, 0xEC, 0x60, 0x8D, 0xFE, 0xF1, 0xDA, 0x24,
-    0x51, 0xD3, 0xFF, 0x81, 0xCB, 0x54, 0x32, 0xAB, 0xF6, 0x43, 0x6D, 0xB6, 0x4B, 0x7C, 0x0C, 0xA7,
-    0xFA, 0x7A, 0xE7, 0x92, 0x38, 0xDA, 0x57, 0xD0, 0xC4, 0x6F, 0x34, 0xEE, 0x1C, 0x11, 0x3D, 0x38,
-    0x60, 0x2D, 0x28, 0xBA, 0x9D, 0x4C, 0x63, 0xD4, 0xEC, 0x24, 0xD5, 0x0B, 0xF7, 0x49, 0x0D, 0xED,
-    0x85, 0x38, 0xF4, 0x46, 0x2B, 0xA3, 0x46, 0x17, 0x77, 0x1E, 0xD7, 0x65, 0x8B, 0xF3, 0x8F, 0xA3,
-    0x97, 0xEB, 0x74, 0x37, 0x1E, 0x5E, 0x53, 0x4B, 0xC9, 0xB9, 0x26, 0xCE, 0x3B, 0x71, 0xCC, 0xE9,
-    0x38, 0x81, 0xC5, 0x26, 0x22, 0xCB, 0xE0, 0xA9, 0x10, 0x0C, 0x9C, 0x11, 0x6D, 0x6D, 0xD9, 0x87,
-    0xE2, 0x1D, 0xB8, 0x2C, 0x40, 0x5B, 0x76, 0x0C, 0x50, 0x2C, 0x90, 0x6A, 0x4B, 0x96, 0x4C, 0xB5,
-    0x21, 0xCD, 0x96, 0x92, 0xC6, 0xBD, 0x76, 0x7D, 0x47, 0x3C, 0x44, 0xFD, 0x18, 0x33, 0x4E, 0x26,
-    0xA8, 0x4B, 0xA8, 0xBA, 0xD9, 0xBA, 0xCD, 0xED, 0xA6, 0x4A, 0x3D, 0x76, 0xCE, 0xD0, 0x74, 0x88,
-    0xAF, 0x5B, 0xC5, 0x69, 0x28, 0xEE, 0xEB, 0x44, 0x38, 0xCF, 0xC5, 0xB4, 0x0A, 0xCD, 0x4B, 0xB2,
-    0x72, 0xE0, 0x18, 0xF1, 0xF0, 0x7C, 0xCA, 0x9A, 0x3C, 0x9F, 0xB1, 0x6F, 0x58, 0x03, 0x8F, 0xC8,
-    0x22, 0x9D, 0x9C, 0x7E, 0xBF, 0xA7, 0x82, 0x90, 0xA5, 0x11, 0x19, 0x3D, 0xB2, 0x12, 0x6F, 0x64,
-    0xD5, 0xC5, 0x48, 0xA4, 0xD1, 0x48, 0xD1, 0x35, 0xE2, 0x00, 0x01, 0x6F, 0xC0, 0x2B, 0xFA, 0xE6,
-    0x02, 0x59, 0x2B, 0xF6, 0x9D, 0xDC, 0x25, 0x5D, 0x8A, 0xEB, 0xD8, 0xA4, 0x65, 0xD8, 0x00, 0x4C,
-    0x25, 0xAA, 0x14, 0x18, 0xB8, 0x0E, 0xD5, 0xDC, 0x0B, 0x66, 0x9B, 0x6F, 0x61, 0x0C, 0xC2, 0xFA,
-    0x77, 0xFF, 0x1A, 0x05, 0xB4, 0xF8, 0xE5, 0xFC, 0x93, 0xEA, 0x1E, 0x7D, 0x2E, 0x53, 0xF7, 0x30,
-    0xC0, 0xAF, 0xD4, 0x5E, 0xF6, 0xCD, 0x8B, 0xBA, 0xAC, 0x32, 0xB8, 0xFD, 0x2B, 0x68, 0x41, 0x27,
-    0x6E, 0xA8, 0xF8, 0x91, 0x49, 0x19, 0xD7, 0x23, 0xFA, 0x89, 0xAD, 0x20, 0x9A, 0x56, 0x88, 0xB0,
-    0xAC, 0x80, 0x82, 0x19, 0xD0, 0xC1, 0x5B, 0x68, 0x9B, 0xC3, 0x47, 0xCC, 0x91, 0xCE, 0x4F, 0x9F,
-    0xAE, 0xC5, 0xA5, 0xB2, 0x65, 0x38, 0xEC, 0xF3, 0xD4, 0x9E, 0xF1, 0x25, 0xD8, 0xF3, 0x9D, 0xF1,
-    0x2E, 0x26, 0xED, 0x16, 0x99, 0xFE, 0x89, 0xD3, 0x56, 0xDA, 0x61, 0xB6, 0x77, 0xF5, 0x7B, 0x9E,
-    0xF6, 0x7B, 0x7B, 0x21, 0x9B, 0x53, 0xBF, 0xC9, 0x3A, 0xEA, 0x9B, 0xCE, 0x01, 0x1F, 0x36, 0x0F,
-    0x5D, 0xD8, 0xCD, 0x9C, 0xF0, 0xAF, 0x9F, 0xB6, 0x2A, 0x9D, 0x45, 0x67, 0xDF, 0x3C, 0x22, 0x8C,
-    0x9F, 0x05, 0x9F, 0xFE, 0x3B, 0x2E, 0xDA, 0x1F, 0x63, 0x56, 0x95, 0x46, 0xF9, 0x29, 0x0F, 0xC6,
-    0xD9, 0xAE, 0x56, 0x8F, 0xAE, 0xCF, 0xA7, 0x17, 0x77, 0x66, 0x81, 0xF3, 0xDC, 0x4E, 0x69, 0xB8,
-    0xD0, 0x6C, 0x35, 0x46, 0xDC, 0x2D, 0x36, 0x9A, 0xE3, 0x18, 0xA7, 0x85, 0x30, 0xE6, 0x46, 0xB8,
-    0x7A, 0x77, 0xAC, 0x1D, 0xED, 0x5F, 0xF6, 0x9C, 0x38, 0xBD, 0x6E, 0x69, 0x26, 0xDD, 0xC1, 0x06,
-    0xBD, 0x9E, 0x81, 0x10, 0xF0, 0x1B, 0x51, 0x63, 0x05, 0x9A, 0xF8, 0xD8, 0x1E, 0xC5, 0x12, 0x17,
-    0x0E, 0x2E, 0xB5, 0xE3, 0xA5, 0x56, 0xE4, 0x59, 0xF8, 0xAE, 0x18, 0x33, 0x38, 0x2F, 0x03, 0x7A,
-    0x3F, 0x65, 0x6F, 0x82, 0x15, 0x9A, 0xC0, 0x0D, 0xDA, 0x4F, 0x9A, 0xDD, 0x50, 0x14, 0x61, 0x9E,
-    0x9A, 0x95, 0xE6, 0x64, 0x37, 0x7A, 0x9E, 0xC4, 0xAE, 0xE7, 0xC9, 0x6A, 0xB3, 0xE7, 0x49, 0xBD,
-    0xDD, 0xF3, 0x84, 0x35, 0x93, 0x6C, 0x8B, 0x80, 0x2B, 0x77, 0xD8, 0x60, 0xC1, 0x24, 0xF0, 0x7F,
-    0xA0, 0x27, 0x9C, 0x64, 0x4B, 0xB6, 0x3B, 0x19, 0x4C, 0x7E, 0xFC, 0xA4, 0x88, 0xF2, 0x6D, 0x7C,
-    0x51, 0x58, 0x1F, 0xD0, 0x30, 0x33, 0x1A, 0xAA, 0x09, 0x59, 0x51, 0x58, 0x11, 0x0D, 0x15, 0x95,
-    0x34, 0x6D, 0x3C, 0x46, 0x2E, 0x45, 0x3E, 0xD7, 0x04, 0x09, 0xB1, 0xD8, 0x0D, 0x67, 0x22, 0xA1,
-    0xDB, 0xB5, 0x77, 0xCC, 0x8E, 0xEC, 0xED, 0x04, 0x62, 0xA3, 0x30, 0xCD, 0xB3, 0x07, 0xC4, 0xCA,
-    0xEE, 0xDB, 0xE9, 0x78, 0x86, 0xB0, 0xA1, 0x43, 0xD0, 0x40, 0xBC, 0x9D, 0x6B, 0x20, 0xE1, 0x77,
-    0xC4, 0xAE, 0xB1, 0x02, 0x86, 0xC0, 0x44, 0xD6, 0x9F, 0x0C, 0x3C, 0x9A, 0x0A, 0x9F, 0x03, 0x84,
-    0x2D, 0x01, 0x3A, 0xF2, 0x00, 0x19, 0xFF, 0x63, 0x3A, 0x55, 0x95, 0xAB, 0x14, 0x61, 0x97, 0x11,
-    0x6D, 0x41, 0x38, 0x83, 0x80, 0xB7, 0x7C, 0xA8, 0x4D, 0xFB, 0xDA, 0x11, 0x29, 0x9F, 0xF2, 0x03,
-    0x6C, 0x67, 0xA7, 0xB1, 0xD9, 0x82, 0x91, 0xE3, 0x8A, 0x5D, 0x29, 0x0C, 0x09, 0x43, 0x30, 0xBA,
-    0x52, 0x46, 0x98, 0x04, 0xEA, 0x90, 0x9D, 0xEE, 0x19, 0x8C, 0x20, 0x6D, 0x4C, 0xFC, 0xED, 0x72,
-    0x22, 0x8E, 0x56, 0xAD, 0x14, 0x73, 0xE3, 0xE9, 0xBD, 0x7C, 0x2F, 0xD3, 0x03, 0x30, 0x7C, 0x9A,
-    0x21, 0x8F, 0x5D, 0x87, 0xA6, 0xDC, 0xE8, 0xF7, 0xA3, 0x86, 0xDB, 0x86, 0x84, 0xC8, 0xB7, 0x71,
-    0x7E, 0xE5, 0x64, 0xB1, 0xB1, 0xBD, 0x36, 0xC1, 0xE8, 0x7E, 0xA7, 0xED, 0xF4, 0xB5, 0x52, 0x88,
-    0x31, 0xE1, 0x54, 0x0D, 0x3B, 0x36, 0x5F, 0xC2, 0xB6, 0x39, 0xA2, 0xA1, 0x02, 0x52, 0x05, 0x3F,
-    0xEB, 0xA6, 0xD5, 0xE3, 0x79, 0x35, 0x0E, 0x73, 0x90, 0x4D, 0x12, 0x8C, 0xC6, 0xB3, 0xC3, 0x67,
-    0xCB, 0x87, 0x9E, 0x1D, 0xF7, 0xEE, 0x17, 0xCC, 0xDD, 0x08, 0xD9, 0x7E, 0x02, 0x9B, 0x1C, 0xB3,
-    0xCF, 0xF1, 0x42, 0x6C, 0x2E, 0x36, 0xE6, 0xA2, 0xFB, 0xBF, 0x69, 0x0C, 0x6F, 0x76, 0x10, 0x5E,
-    0x9C, 0xD2, 0x41, 0x78, 0x1B, 0x4F, 0xA1, 0x87, 0xDC, 0xB0, 0xBA, 0x55, 0xDB, 0x2D, 0xE8, 0x54,
-    0x52, 0x55, 0xFB, 0x2C, 0xAD, 0xFF, 0x41, 0xAD, 0x65, 0x6C, 0x53, 0xB9, 0x92, 0xF6, 0x1A, 0xEF,
-    0x35, 0x03, 0x8C, 0xDF, 0xE9, 0xF4, 0xFC, 0x0C, 0x96, 0x66, 0xA7, 0xDD, 0x90, 0x89, 0x2C, 0xD2,
-    0xAE, 0x93, 0x29, 0x50, 0xE0, 0x0B, 0x5B, 0xA2, 0x0D, 0xE7, 0xA9, 0xF0, 0x03, 0x4D, 0x5A, 0x1D,
-    0x6D, 0x42, 0xF8, 0x29, 0x45, 0x51, 0x46, 0x27, 0x42, 0x3C, 0x7E, 0x95, 0x35, 0xCE, 0x05, 0x37,
-    0x9E, 0x36, 0xEA, 0x9A, 0x4E, 0x3F, 0x50, 0x20, 0x1E, 0x8B, 0x41, 0x8D, 0x6B, 0x76, 0x09, 0xEE,
-    0x52, 0xBF, 0xC7, 0x9D, 0xB0, 0xE4, 0x8C, 0x3D, 0xED, 0xC2, 0xEC, 0x8C, 0x32, 0xD7, 0xA5, 0x39,
-    0xAA, 0xA7, 0xF3, 0x63, 0x9C, 0x95, 0xE3, 0xCE, 0x56, 0x48, 0x33, 0x77, 0x94, 0x92, 0x33, 0xFF,
-    0xD4, 0xA4, 0x33, 0xCE, 0x4C, 0x53, 0x1B, 0x51, 0xCF, 0x61, 0xCB, 0x22, 0xED, 0x94, 0x9B, 0x4E,
-    0x36, 0xE7, 0xE9, 0xA8, 0x75, 0x27, 0xA5, 0xF2, 0xCD, 0x40, 0x63, 0xB4, 0x03, 0x67, 0x82, 0xB6,
-    0x88, 0x00, 0x90, 0xAE, 0xD2, 0x87, 0xAF, 0x8D, 0x87, 0xDE, 0x6E, 0xC3, 0x36, 0xAD, 0x88, 0x0B,
-    0x1A, 0x37, 0x41, 0x56, 0x47, 0xEB, 0xF4, 0x58, 0x85, 0xA2, 0xAD, 0xD0, 0xD4, 0x3E, 0x03, 0x02,
-    0xBA, 0x62, 0x7F, 0x21, 0x80, 0x99, 0x22, 0x48, 0x14, 0xEF, 0x5E, 0x83, 0x86, 0x21, 0x2F, 0xDE,
-    0x84, 0x81, 0x93, 0xA2, 0xE0, 0x31, 0x13, 0xEB, 0xC7, 0xCB, 0x94, 0x25, 0xD4, 0xDE, 0x0A, 0xD7,
-    0x2D, 0x9A, 0xDC, 0xC1, 0x6A, 0x0E, 0xAD, 0xEE, 0x4F, 0xEC, 0xC0, 0x1A, 0x6E, 0x36, 0xEE, 0xF4,
-    0x3B, 0x1A, 0xAA, 0x24, 0xF8, 0x62, 0xBE, 0x52, 0x33, 0x2C, 0xBE, 0xBE, 0xA2, 0xDF, 0x29, 0x9C,
-    0x2F, 0x1A, 0xB4, 0xC1, 0x80, 0x9C, 0x14, 0xED, 0x74, 0x31, 0x15, 0xF7, 0x45, 0x42, 0xBC, 0x14,
-    0x9D, 0xB6, 0xE7, 0x28, 0xEC, 0xD7, 0x57, 0x3C, 0x92, 0x36, 0x9F, 0xFD, 0xDD, 0x07, 0xF8, 0x59,
-    0x49, 0xB6, 0x4B, 0xDA, 0x71, 0xAA, 0xDF, 0x9C, 0x1B, 0xDF, 0x76, 0x0A, 0xF3, 0x42, 0x27, 0xF4,
-    0x00, 0x98, 0xC0, 0xAD, 0x3E, 0x46, 0xEF, 0xBA, 0x3E, 0x46, 0xDD, 0xE9, 0xCD, 0x77, 0x09, 0xD8,
-    0xD0, 0x6E, 0x0E, 0x99, 0x39, 0xAD, 0xA2, 0xD4, 0x55, 0x9E, 0xFE, 0x6A, 0xAA, 0x79, 0x9B, 0x54,
-    0xFB, 0x13, 0xB9, 0x52, 0x26, 0xB8, 0x12, 0x2D, 0x85, 0x9E, 0xBE, 0xA8, 0xAA, 0xC2, 0x6B, 0x40,
-    0xB5, 0x1B, 0xA0, 0x5A, 0xBE, 0x4D, 0xB5, 0xDF, 0x27, 0x6C, 0xFD, 0x06, 0x9E, 0x7E, 0x81, 0xA5,
-    0x0D, 0xE8, 0x98, 0xEA, 0x43, 0x20, 0x7A, 0xCD, 0x06, 0xD5, 0x36, 0xE8, 0xB9, 0x7C, 0x20, 0x2D,
-    0x9E, 0x68, 0x84, 0x16, 0x5F, 0x10, 0x5A, 0xF8, 0xB5, 0xD0, 0xE2, 0x71, 0xA1, 0xC5, 0x37, 0xDE,
-    0xDE, 0xA4, 0xC5, 0x00, 0x63, 0x1E, 0x5B, 0x04, 0x99, 0xDE, 0x04, 0x90, 0x4B, 0x2C, 0xF4, 0xE7,
-    0x83, 0xCD, 0x46, 0xC4, 0x0C, 0x27, 0x9F, 0xFA, 0xDC, 0xDD, 0x11, 0x39, 0x4F, 0x59, 0xAC, 0xDC,
-    0xE8, 0x47, 0xB2, 0x83, 0xB0, 0x91, 0xC4, 0xCE, 0x18, 0xAF, 0x59, 0x74, 0x71, 0x48, 0x14, 0x51,
-    0xA6, 0x50, 0xB6, 0x0F, 0x4A, 0xC0, 0x66, 0x9B, 0xED, 0xF2, 0x13, 0x01, 0xA8, 0xFB, 0x2A, 0xC8,
-    0x67, 0x50, 0x33, 0x39, 0xC2, 0xEA, 0xB1, 0x26, 0xCD, 0x9F, 0x1B, 0xE0, 0xBF, 0x75, 0xC8, 0xD8,
-    0xD4, 0xDB, 0xFD, 0x0B, 0x12, 0xD7, 0xBF, 0xE0, 0x1F, 0xD1, 0x2A, 0x65, 0x86, 0x33, 0x53, 0x52,
-    0x86, 0x5A, 0x18, 0xA2, 0x07, 0xB2, 0x89, 0xD0, 0x86, 0x79, 0x83, 0x82, 0x22, 0xC6, 0x35, 0x19,
-    0x1E, 0xCA, 0xA6, 0xB3, 0x2B, 0x83, 0x96, 0x08, 0xC5, 0xE4, 0x55, 0x64, 0x45, 0x16, 0x36, 0xF9,
-    0x22, 0xA6, 0xD6, 0xAC, 0xC4, 0xB7, 0xBC, 0x6E, 0x9F, 0xD4, 0x06, 0xE5, 0xBE, 0xC3, 0x1E, 0x16,
-    0xF6, 0xEE, 0xB7, 0x66, 0xF9, 0xE2, 0x9C, 0xA7, 0x60, 0xAB, 0x60, 0xC6, 0x39, 0x8A, 0x2E, 0x17,
-    0xE3, 0x3E, 0xA1, 0x7F, 0xE1, 0xA8, 0xD6, 0xBF, 0x86, 0x5E, 0x3C, 0xD4, 0x83, 0x5B, 0xE8, 0x44,
-    0x07, 0x0E, 0xE4, 0xEA, 0xDA, 0x2D, 0xC3, 0x25, 0x61, 0x0B, 0xD6, 0x85, 0x1E, 0x8A, 0xF1, 0x5C,
-    0xEF, 0x5A, 0x17, 0x8F, 0xC0, 0x3E, 0x88, 0xDC, 0xB9, 0xC3, 0x0E, 0x3B, 0x47, 0x68, 0xB1, 0x93,
-    0xBC, 0x7D, 0x93, 0x3D, 0x76, 0x98, 0x44, 0x87, 0x0D, 0x5F, 0x5C, 0xDC, 0x8A, 0xF5, 0x7B, 0x6B,
-    0x37, 0x41, 0x8C, 0xEC, 0xDF, 0x36, 0x6C, 0x75, 0xE3, 0xBA, 0x10, 0xB3, 0xB1, 0xCA, 0x96, 0x4F,
-    0xFA, 0x29, 0xA5, 0xDB, 0x90, 0x9D, 0x2C, 0x5A, 0x5A, 0x6D, 0x5A, 0xAE, 0x5B, 0x2A, 0xC1, 0xAC,
-    0x3B, 0x18, 0x7D, 0x7C, 0x64, 0x0E, 0xDB, 0x07, 0x26, 0xC2, 0x35, 0xFA, 0xCE, 0x53, 0xE5, 0x7A,
-    0x73, 0x16, 0xB3, 0x1A, 0x4F, 0xB6, 0x6C, 0xF9, 0x40, 0x00, 0x88, 0x9D, 0xEE, 0x2F, 0xAB, 0x35,
-    0x96, 0xE2, 0x2C, 0x53, 0x4B, 0x8D, 0x1E, 0x6D, 0x22, 0x3F, 0x9F, 0x07, 0x2A, 0x05, 0x3F, 0x2F,
-    0x4C, 0xC9, 0xB7, 0x7C, 0xDA, 0x43, 0xE9, 0xD4, 0x8F, 0x7E, 0x46, 0x6C, 0x79, 0xFF, 0xE9, 0x74,
-    0xC8, 0xD1, 0x3F, 0xCB, 0x43, 0xD0, 0xD8, 0x2F, 0x57, 0xF9, 0xCA, 0x25, 0xF6, 0x92, 0x65, 0x31,
-    0x51, 0xCE, 0x39, 0x22, 0xE9, 0xB8, 0x09, 0x97, 0x98, 0x7F, 0xDC, 0x29, 0xD7, 0x17, 0x51, 0xDE,
-    0x04, 0x1F, 0xA0, 0x01, 0x88, 0x30, 0x97, 0x65, 0x2F, 0xCF, 0xEC, 0xA3, 0x74, 0xD1, 0x5E, 0xC5,
-    0x3A, 0x86, 0xCC, 0x01, 0xC0, 0xF6, 0x56, 0x9E, 0x1D, 0x58, 0x6D, 0xA3, 0x47, 0x79, 0x2A, 0xD3,
-    0x54, 0xC9, 0x52, 0x43, 0x9D, 0x57, 0xC7, 0xE7, 0xDA, 0x29, 0x0E, 0x57, 0x6E, 0xB6, 0x3E, 0x8E,
-    0xDF, 0x2C, 0x9E, 0xE5, 0x28, 0x57, 0xAC, 0xB0, 0xD0, 0x4C, 0xB2, 0xCB, 0x6E, 0xEA, 0xB9, 0x63,
-    0x40, 0x4A, 0xE9, 0x09, 0x4C, 0x4D, 0x40, 0x1F, 0xE4, 0x59, 0x8B, 0x92, 0xEB, 0xE3, 0x8B, 0x18,
-    0x13, 0x00, 0x4A, 0xCB, 0x78, 0x64, 0xF9, 0xED, 0xE8, 0x26, 0x81, 0x2C, 0xE7, 0xAF, 0x48, 0x0D,
-    0x69, 0xC6, 0xCD, 0x3C, 0x30, 0xE3, 0xA6, 0xF9, 0x90, 0x51, 0xD7, 0xB1, 0xD3, 0x21, 0x23, 0x2C,
-    0x79, 0xA8, 0x27, 0x8C, 0x25, 0xDA, 0x19, 0xA5, 0x73, 0x8D, 0x52, 0x34, 0xEA, 0xA8, 0x18, 0x6C,
-    0x35, 0x0A, 0xF5, 0x15, 0x53, 0x19, 0xDD, 0x21, 0x50, 0x29, 0xB9, 0x3C, 0x77, 0x69, 0x47, 0xE7,
-    0x98, 0xAA, 0x00, 0xD1, 0x64, 0x91, 0x9E, 0xB0, 0x09, 0x23, 0x8C, 0xCD, 0x3E, 0xFC, 0x5B, 0x05,
-    0x31, 0x5D, 0x90, 0x6F, 0x7A, 0xDE, 0x98, 0x36, 0xFD, 0xFA, 0xD0, 0xD9, 0x37, 0x59, 0x45, 0xDE,
-    0x25, 0x7A, 0xE7, 0x32, 0xFA, 0xB6, 0xE8, 0x71, 0x44, 0x35, 0x0F, 0x54, 0xA6, 0xC3, 0xDD, 0x6B,
-    0xDF, 0x96, 0x60, 0x56, 0x52, 0xC5, 0xE4, 0xB5, 0x6A, 0xE9, 0xC6, 0xF4, 0x9B, 0x98, 0xEB, 0xEC,
-    0x9F, 0x7F, 0x0F, 0x6C, 0xA1, 0xA7, 0xC2, 0x6C, 0xC0, 0x63, 0x93, 0x59, 0x1E, 0x57, 0x0A, 0x71,
-    0x37, 0xD3, 0xD9, 0x29, 0xAC, 0x24, 0x9D, 0x4E, 0x47, 0x81, 0x00, 0xD0, 0x03, 0xA7, 0x83, 0xC6,
-    0x4D, 0xC3, 0x38, 0x57, 0x43, 0xCB, 0xF3, 0x9C, 0xFD, 0x0A, 0xC6, 0xD3, 0xCE, 0x50, 0x0B, 0xED,
-    0xEB, 0xE5, 0xFA, 0x3E, 0x69, 0x54, 0xDA, 0x49, 0x1B, 0x77, 0xEC, 0x99, 0x3B, 0xDA, 0x4C, 0xE3,
-    0xE4, 0x10, 0x3C, 0x71, 0xA5, 0x18, 0x3D, 0x3D, 0x4B, 0x99, 0x16, 0xF0, 0x63, 0xEC, 0xC7, 0xBE,
-    0x84, 0xCC, 0x48, 0x7B, 0x9F, 0x95, 0x2F, 0x35, 0x13, 0xE2, 0xC9, 0xBA, 0x34, 0x6E, 0xB6, 0x13,
-    0x8B, 0x4D, 0xB9, 0xAC, 0x45, 0x16, 0xDE, 0x70, 0x02, 0x40, 0x19, 0xD8, 0x7E, 0x42, 0x0C, 0x5A,
-    0x9C, 0x64, 0x10, 0x57, 0xAE, 0x7E, 0x88, 0xA7, 0x7B, 0x4E, 0x07, 0xC0, 0x11, 0x22, 0xCF, 0x6E,
-    0xC4, 0xAC, 0x3A, 0xD7, 0xC3, 0x21, 0xC2, 0x5A, 0xED, 0x77, 0x52, 0x5C, 0xFB, 0xF3, 0xA7, 0xAE,
-    0x73, 0x73, 0x8C, 0x3A, 0xF2, 0x7D, 0x70, 0xF6, 0x97, 0x90, 0x9D, 0x6A, 0xD0, 0xAC, 0x8F, 0xDB,
-    0x34, 0xD8, 0x68, 0x95, 0xBB, 0xF6, 0x97, 0x0E, 0x66, 0xD5, 0xC1, 0x93, 0xC3, 0x7E, 0xFD, 0xFC,
-    0xCD, 0xF2, 0x23, 0xCE, 0xDF, 0x9C, 0x3C, 0x22, 0xCD, 0x39, 0xA3, 0xCD, 0x9A, 0xC6, 0x8B, 0x9D,
-    0x73, 0x93, 0x74, 0x03, 0x78, 0x96, 0x5D, 0xED, 0x73, 0xAB, 0x7D, 0x27, 0xB8, 0x00, 0x67, 0x2E,
-    0x7E, 0x3C, 0xC9, 0x9C, 0x6E, 0x7D, 0xE8, 0xEA, 0x29, 0xC1, 0x00, 0x6F, 0x02, 0x27, 0x9C, 0xC3,
-    0x68, 0xC3, 0x7B, 0x7A, 0x98, 0x6C, 0xB6, 0x59, 0x7E, 0xF5, 0x09, 0x4E, 0xA5, 0xF5, 0x9B, 0xA9,
-    0x34, 0x33, 0xF3, 0x93, 0x33, 0x40, 0xC2, 0x7A, 0xA3, 0x5C, 0xAC, 0x3B, 0xB1, 0x3A, 0x1F, 0x4F,
-    0x2A, 0x0D, 0xA5, 0xA3, 0xB6, 0x9D, 0x53, 0x69, 0x8F, 0xAF, 0xAD, 0x91, 0xED, 0xEE, 0x5A, 0xD3,
-    0x6A, 0x7C, 0x18, 0xCF, 0x0A, 0x57, 0xCA, 0xC9, 0x31, 0x58, 0x7C, 0x34, 0xFE, 0x28, 0x3D, 0xD1,
-    0x58, 0x0B, 0x23, 0x97, 0xA7, 0x7C, 0x7A, 0xDB, 0x3B, 0x35, 0xFD, 0x4E, 0xD1, 0xCA, 0x8C, 0x3B,
-    0x35, 0x40, 0x40, 0xC4, 0xAF, 0xB4, 0x1A, 0xA4, 0x4C, 0xD9, 0xBB, 0x45, 0xA4, 0x9D, 0x85, 0x93,
-    0x2F, 0x93, 0x4A, 0xC4, 0xBC, 0x2B, 0x6E, 0x57, 0x91, 0x6D, 0x71, 0xDA, 0x1B, 0x98, 0x72, 0x31,
-    0xB5, 0x23, 0x9C, 0x4E, 0x92, 0xD7, 0x36, 0x48, 0xA3, 0x43, 0xC4, 0x6F, 0x5D, 0x09, 0x4E, 0xB8,
-    0xA4, 0xA1, 0x3B, 0xA7, 0x31, 0xD5, 0x8A, 0x1C, 0xF6, 0x22, 0x0C, 0xAD, 0x7A, 0xB2, 0x32, 0x25,
-    0x44, 0xCC, 0xFC, 0x7B, 0x62, 0x7D, 0x40, 0xB8, 0x5D, 0x5F, 0xFA, 0xEF, 0xCB, 0x7C, 0xFB, 0x81,
-    0x25, 0xBD, 0x28, 0x85, 0x5E, 0xA5, 0x7A, 0x4E, 0x63, 0x8B, 0x2A, 0x61, 0x3D, 0xA7, 0x31, 0x7A,
-    0x45, 0x78, 0x2C, 0x2C, 0xCD, 0x11, 0xCE, 0x50, 0x14, 0xEE, 0x6F, 0x60, 0x55, 0xBD, 0x60, 0x50,
-    0x28, 0x94, 0x3E, 0xD1, 0x79, 0x80, 0x0A, 0xF7, 0x7E, 0x8D, 0x23, 0xD5, 0xD0, 0xBC, 0xE6, 0x00,
-    0xB1, 0xC5, 0x65, 0xCA, 0x82, 0xCC, 0x23, 0xD3, 0xC7, 0x4B, 0xB8, 0xC8, 0x8B, 0xA6, 0x67, 0xC7,
-    0x89, 0xF0, 0xC7, 0x15, 0xDB, 0x8C, 0xC5, 0xB9, 0x42, 0xB4, 0x73, 0xEA, 0xAE, 0x0A, 0xC0, 0x6B,
-    0x20, 0xA5, 0x71, 0xB6, 0xA0, 0x2D, 0xF5, 0x00, 0xB3, 0x81, 0xB1, 0x52, 0x33, 0x59, 0x35, 0x71,
-    0x66, 0x36, 0x22, 0x5C, 0xF3, 0x99, 0x79, 0xF9, 0x76, 0xA6, 0x6C, 0x0A, 0x1F, 0x9F, 0xEC, 0x64,
-    0x85, 0xC2, 0xC2, 0xA2, 0x64, 0xF7, 0x99, 0x06, 0xB5, 0x3C, 0x69, 0x07, 0xC2, 0xC4, 0x83, 0x39,
-    0x92, 0x09, 0xDE, 0x36, 0xE9, 0x0B, 0x26, 0x78, 0xBB, 0x8C, 0x5E, 0xCC, 0xFC, 0xF7, 0x9B, 0xE0,
-    0x67, 0xF5, 0xE2, 0xBD, 0xCE, 0x6B, 0x3B, 0xD3, 0x1D, 0x99, 0x1B, 0x89, 0xB9, 0x91, 0x62, 0xFA,
-    0x17, 0x84, 0x95, 0xBF, 0x8A, 0x66, 0x2D, 0x41, 0xF5, 0x42, 0xFC, 0x44, 0xB7, 0x68, 0xA3, 0xA7,
-    0x4B, 0xB9, 0xEC, 0xFF, 0xBC, 0x82, 0xB1, 0x74, 0x4F, 0x66, 0x2E, 0x3E, 0xBD, 0x98, 0x33, 0x41,
-    0x15, 0xCA, 0xAD, 0x5F, 0x47, 0xBD, 0x69, 0xD1, 0xA0, 0xA1, 0x8C, 0x43, 0x6E, 0xDF, 0xD8, 0x80,
-    0xB0, 0x27, 0x9B, 0x5B, 0xB3, 0x5A, 0xBB, 0x10, 0x0C, 0x58, 0x7D, 0xAC, 0xB6, 0xF8, 0x9F, 0xD0,
-    0x14, 0x4F, 0x5C, 0xA7, 0x5C, 0xF2, 0x90, 0xD6, 0xB1, 0xA9, 0x3F, 0x66, 0xFE, 0xFD, 0x89, 0x32,
-    0x04, 0x15, 0x1C, 0x5A, 0x24, 0xAC, 0x27, 0x87, 0xF3, 0xA0, 0x50, 0x17, 0x8A, 0x35, 0xF1, 0xB7,
-    0xB9, 0x2D, 0x5E, 0xA5, 0x37, 0xD7, 0x28, 0xA0, 0x29, 0xE5, 0xD7, 0x38, 0xDD, 0xDE, 0xB5, 0x3E,
-    0x54, 0x30, 0xAC, 0x1E, 0x2D, 0xA9, 0xA7, 0x5C, 0x72, 0xEE, 0x77, 0xF6, 0x8A, 0xA9, 0x11, 0x82,
-    0x4F, 0xF9, 0xA8, 0x27, 0x88, 0xBB, 0xE4, 0x6F, 0x31, 0x19, 0x0B, 0x38, 0x08, 0xA1, 0x9C, 0x64,
-    0x62, 0x5C, 0xEA, 0x21, 0xE2, 0x0A, 0x25, 0xF5, 0xDD, 0x29, 0xE2, 0x1E, 0xF4, 0x32, 0x4E, 0x11,
-    0x75, 0xC1, 0x5A, 0xAB, 0xB5, 0x24, 0xD9, 0x66, 0x65, 0xC5, 0x79, 0x4D, 0xA8, 0x5C, 0x00, 0xBD,
-    0x8F, 0x4C, 0x7E, 0xF3, 0xA8, 0x97, 0x69, 0xC5, 0xB8, 0x45, 0x84, 0x9C, 0x47, 0x80, 0xF8, 0x0B,
-    0x5B, 0x09, 0xF2, 0xEC, 0xB5, 0xAD, 0x93, 0x6C, 0x32, 0x8D, 0xAF, 0xA7, 0x78, 0xC9, 0xD1, 0x10,
-    0x1A, 0xD8, 0x73, 0xD1, 0x6F, 0x69, 0x29, 0x5B, 0x2D, 0xBE, 0x53, 0xA4, 0x58, 0xC7, 0x0B, 0xD8,
-    0xAF, 0x8F, 0xCF, 0x27, 0x4B, 0x9C, 0x61, 0x71, 0x0E, 0x4F, 0x74, 0x73, 0x85, 0xF5, 0xA9, 0x6B,
-    0x6C, 0xFB, 0xC8, 0xA9, 0x1E, 0xCE, 0x62, 0xE3, 0xF8, 0x41, 0x2D, 0xAD, 0x8F, 0x87, 0x35, 0xA1,
-    0x0F, 0x68, 0x24, 0xF4, 0x44, 0x50, 0xF5, 0xE9, 0x4C, 0xE7, 0xB0, 0xD1, 0x3C, 0x17, 0x0F, 0x6C,
-    0x5F, 0xAA, 0x61, 0xA5, 0xBA, 0x9A, 0xF5, 0xB2, 0xAC, 0x86, 0x1E, 0xF6, 0xD8, 0x71, 0x04, 0x54,
-    0xD6, 0x83, 0xBB, 0x91, 0xA5, 0x2F, 0xDD, 0x61, 0x13, 0xC5, 0x74, 0x74, 0x9D, 0x1E, 0xA7, 0xA5,
-    0x47, 0x1D, 0x05, 0x8D, 0xD2, 0x38, 0x26, 0x78, 0x2E, 0x75, 0x59, 0xB4, 0x47, 0x40, 0x4A, 0xD9,
-    0xFA, 0xAE, 0xF2, 0xB2, 0x83, 0x31, 0xF3, 0x88, 0xB7, 0x5B, 0xB9, 0xF9, 0x71, 0x92, 0x98, 0xF3,
-    0x19, 0xE6, 0x04, 0xDD, 0xD4, 0x76, 0x48, 0xCB, 0x51, 0x5C, 0x21, 0xA2, 0xB6, 0xC2, 0x50, 0x18,
-    0xD8, 0x54, 0xCF, 0x5E, 0x4C, 0xE2, 0x63, 0x9C, 0x12, 0xEE, 0xC3, 0x24, 0x48, 0xA6, 0x1C, 0xF5,
-    0x14, 0x37, 0x68, 0x17, 0x38, 0xCE, 0x1B, 0xAE, 0x8B, 0xEF, 0xEC, 0xE1, 0xD2, 0xFD, 0x23, 0x5D,
-    0x06, 0xC7, 0xBC, 0x64, 0xF7, 0x2E, 0x69, 0xC5, 0xD8, 0x54, 0x13, 0xEA, 0x4F, 0xFF, 0x08, 0xEF,
-    0x1E, 0x5E, 0xAF, 0x5C, 0x85, 0x86, 0xF3, 0x1A, 0x97, 0x4E, 0x68, 0x15, 0x53, 0xDB, 0xFC, 0x09,
-    0xE8, 0xE0, 0xF7, 0x1B, 0xA7, 0x68, 0xB1, 0xC1, 0x7D, 0xA4, 0x48, 0x0A, 0xED, 0xD4, 0xE6, 0x22,
-    0xD1, 0xE7, 0x69, 0x3E, 0x79, 0xB6, 0x79, 0x5C, 0x98, 0x5B, 0xEC, 0x95, 0x38, 0x47, 0x3E, 0xF4,
-    0x2F, 0xDE, 0xB5, 0x7F, 0x3E, 0x7A, 0xA8, 0x60, 0x90, 0xBB, 0xE3, 0x2C, 0x56, 0x9D, 0xAC, 0xCD,
-    0x98, 0x9C, 0x47, 0xC3, 0x65, 0xE6, 0x17, 0x3C, 0x8B, 0x58, 0xF3, 0x9D, 0x7D, 0xF4, 0x67, 0x26,
-    0x02, 0x14, 0x07, 0x3F, 0x29, 0xC8, 0x21, 0xFD, 0x16, 0x45, 0x4A, 0xA2, 0x70, 0xEC, 0x48, 0x8F,
-    0x61, 0x08, 0x59, 0xDB, 0x9E, 0x05, 0x8C, 0x84, 0x34, 0x68, 0x59, 0xFC, 0x19, 0x6F, 0xBC, 0xFC,
-    0x63, 0x7B, 0xB3, 0x10, 0x2B, 0xE0, 0x8D, 0x77, 0x2D, 0xCF, 0x59, 0x6A, 0x73, 0x91, 0x5C, 0x67,
-    0xA6, 0x0E, 0xA8, 0xF4, 0xF5, 0xE3, 0x8C, 0x56, 0x00, 0x36, 0x3A, 0x47, 0xAD, 0xCE, 0xFD, 0xB6,
-    0x6C, 0x21, 0xC2, 0x1B, 0x84, 0x5A, 0xEA, 0x71, 0x01, 0xF9, 0x7D, 0x23, 0xC0, 0xC5, 0xBA, 0xF5,
-    0x0F, 0xAF, 0x80, 0xE8, 0x9E, 0x83, 0x90, 0x22, 0xA9, 0x7D, 0x75, 0xEF, 0xE2, 0x7D, 0xD1, 0x39,
-    0x9B, 0x15, 0x0F, 0x8B, 0x8D, 0x2B, 0xAE, 0x7E, 0x62, 0x98, 0x9C, 0x1C, 0x71, 0xB4, 0x5B, 0x35,
-    0x5E, 0xD8, 0x05, 0x3E, 0x67, 0x19, 0xFB, 0xB8, 0xE9, 0x54, 0xC3, 0x68, 0x25, 0x6E, 0x13, 0x4D,
-    0xB3, 0x83, 0x01, 0x5E, 0xD8, 0x32, 0x82, 0x33, 0x9B, 0x2C, 0xD9, 0x67, 0x67, 0x50, 0xB3, 0xA7,
-    0x58, 0x26, 0x3F, 0x2A, 0x3A, 0x9E, 0x92, 0xEB, 0xF3, 0xC0, 0xB7, 0x37, 0x27, 0xAB, 0xA7, 0x9F,
-    0xF3, 0x76, 0xB5, 0x32, 0xC4, 0xEF, 0xE2, 0xFC, 0x91, 0x52, 0xE1, 0x73, 0xAC, 0xE6, 0xDF, 0xE8,
-    0x4D, 0x7F, 0x16, 0x6D, 0x8D, 0x48, 0x1D, 0xB7, 0x65, 0x2F, 0x64, 0x8A, 0xA7, 0x34, 0x1A, 0x8E,
-    0x18, 0x77, 0x7B, 0x6B, 0xBA, 0xD3, 0x0D, 0x96, 0xEB, 0x3E, 0x74, 0xF2, 0xF6, 0x19, 0x70, 0xDF,
-    0xBE, 0xB6, 0x20, 0x66, 0x05, 0xCC, 0xDD, 0xBD, 0xCB, 0x0D, 0x4B, 0x8D, 0xBE, 0x36, 0xB2, 0x70,
-    0x1A, 0x6B, 0xD3, 0x20, 0x18, 0x56, 0x3C, 0xA1, 0x27, 0x09, 0xB3, 0xE5, 0x05, 0xB6, 0xE7, 0x80,
-    0xAA, 0xAD, 0x42, 0xFE, 0xDC, 0x2D, 0x06, 0xD7, 0x66, 0xC0, 0x95, 0x78, 0xAB, 0xF5, 0xEE, 0x3D,
-    0xA3, 0x87, 0x00, 0xE3, 0x80, 0xB1, 0xF0, 0xE6, 0xE5, 0xCE, 0xCB, 0x8C, 0x75, 0xC3, 0xA0, 0x72,
-    0x5E, 0xE9, 0x6A, 0x7A, 0x97, 0x6B, 0xAF, 0xB0, 0xEC, 0x8D, 0x1D, 0xD8, 0xAB, 0x39, 0x8E, 0x8E,
-    0xFA, 0x3E, 0x3C, 0xED, 0x81, 0x82, 0x4B, 0xC4, 0x41, 0x15, 0x74, 0x8B, 0xF1, 0x12, 0x4F, 0x97,
-    0xD2, 0xE2, 0x4F, 0x17, 0xB7, 0xC8, 0x1E, 0x9A, 0x65, 0xE7, 0xA0, 0xF0, 0x5D, 0xA0, 0x72, 0xBD,
-    0x53, 0xEB, 0x1C, 0x3D, 0xB4, 0x3E, 0x34, 0xDC, 0x73, 0xAA, 0x45, 0xA2, 0x2B, 0xAE, 0x73, 0x42,
-    0xBA, 0x41, 0x95, 0x62, 0xED, 0x01, 0xBA, 0xF6, 0x3C, 0xF5, 0xFA, 0x22, 0xC0, 0x56, 0xCF, 0x5F,
-    0x6B, 0x89, 0xDB, 0x28, 0x15, 0x72, 0x64, 0xC7, 0xAB, 0xCF, 0xF5, 0x48, 0xC0, 0x89, 0xB8, 0xC0,
-    0xE4, 0xD9, 0x12, 0xB9, 0x67, 0xD7, 0x03, 0x76, 0x96, 0x19, 0x09, 0x12, 0x80, 0x1A, 0xC2, 0xB9,
-    0x6B, 0x2D, 0x4B, 0x79, 0xC6, 0xEB, 0x36, 0x73, 0x7D, 0xD6, 0x14, 0xB6, 0xE2, 0x82, 0x9E, 0xE8,
-    0xE1, 0x82, 0xC9, 0xB0, 0x65, 0x2E, 0xB5, 0x40, 0xE6, 0xED, 0x04, 0x08, 0x73, 0xB6, 0x79, 0xB2,
-    0xCB, 0xC5, 0xF1, 0x73, 0xA3, 0x88, 0x37, 0x0D, 0xCB, 0x64, 0x53, 0xEF, 0xF0, 0xA5, 0x1A, 0x03,
-    0x67, 0xF2, 0x25, 0xC8, 0x49, 0xF6, 0xCA, 0x8F, 0x9F, 0x6B, 0xE4, 0xB1, 0x05, 0x23, 0x17, 0x88,
-    0x1F, 0xC2, 0x39, 0x11, 0x1B, 0x1C, 0xFD, 0x2A, 0x2E, 0xB9, 0x76, 0x51, 0xE9, 0x7C, 0xA2, 0xD8,
-    0xA6, 0xDE, 0x49, 0x9D, 0xA3, 0xAC, 0x96, 0x33, 0xCD, 0x94, 0xA9, 0xB4, 0xF1, 0xA1, 0x5F, 0x55,
-    0x87, 0xF8, 0xCF, 0x32, 0x0C, 0x27, 0x5A, 0xCE, 0xA9, 0x90, 0xDA, 0x15, 0x2A, 0x26, 0x4B, 0xA7,
-    0x30, 0x8E, 0xA6, 0xFA, 0xCF, 0xCC, 0x3B, 0x95, 0x5E, 0x9F, 0xFA, 0x30, 0x9C, 0xF6, 0xED, 0xF1,
-    0x9B, 0x78, 0x3A, 0x73, 0xF6, 0x05, 0xC5, 0xEA, 0x6C, 0xD9, 0x30, 0x8F, 0x6A, 0x3B, 0x33, 0x99,
-    0x23, 0x4F, 0xBB, 0x33, 0x57, 0x14, 0x84, 0x15, 0x74, 0x33, 0x10, 0x68, 0xC7, 0xD7, 0xD2, 0x4A,
-    0x10, 0x94, 0xC5, 0x5D, 0x62, 0xF3, 0x8F, 0xCE, 0x29, 0x09, 0xEF, 0xD9, 0x62, 0x39, 0x4B, 0x36,
-    0x6E, 0xCD, 0x8D, 0xA8, 0xF7, 0x8E, 0xD3, 0x16, 0x35, 0x67, 0x33, 0x1C, 0xB4, 0x69, 0x0F, 0x8B,
-    0x5E, 0xA1, 0x4F, 0xA1, 0x76, 0x38, 0xDC, 0xD3, 0x2A, 0xF3, 0x87, 0xB4, 0x03, 0x91, 0x3A, 0x16,
-    0xDD, 0xB6, 0xEC, 0x80, 0x0E, 0x45, 0x19, 0x3D, 0x54, 0x40, 0x72, 0x15, 0x58, 0x07, 0x8A, 0xD1,
-    0xCD, 0x8A, 0x75, 0xE1, 0x68, 0x14, 0x12, 0x00, 0xA8, 0x1A, 0x28, 0xD0, 0x2C, 0xDB, 0xEC, 0x1E,
-    0x6F, 0xF4, 0x5C, 0x07, 0xB1, 0x5E, 0xAE, 0xEE, 0xE3, 0x3C, 0x8B, 0xC6, 0xC3, 0xC1, 0x0E, 0xEB,
-    0x13, 0xD1, 0xB3, 0x60, 0x3A, 0x0F, 0x9D, 0x60, 0xA0, 0x75, 0x2D, 0xD1, 0x7D, 0x5F, 0xEA, 0xE9,
-    0x85, 0x50, 0x37, 0xED, 0xEF, 0x7C, 0x58, 0xB4, 0xB3, 0xF5, 0x1D, 0xCF, 0xB9, 0xB8, 0x8D, 0xDA,
-    0x0C, 0xBE, 0xC9, 0x1B, 0x8B, 0x20, 0xBD, 0x82, 0x3E, 0x27, 0xC5, 0x5F, 0x5E, 0xEF, 0x15, 0xAE,
-    0xE1, 0xB0, 0x56, 0x7B, 0x9B, 0xB5, 0x5A, 0x56, 0xAB, 0xAA, 0x1E, 0x26, 0x0A, 0x50, 0x27, 0xCD,
-    0x5B, 0x68, 0x71, 0x82, 0xD9, 0x3C, 0x03, 0x80, 0xF7, 0x1F, 0x26, 0x6F, 0x8B, 0xD5, 0xF6, 0x7A,
-    0x70, 0xA5, 0xD6, 0xA7, 0xAF, 0xD5, 0x72, 0x32, 0x83, 0x92, 0xE2, 0x53, 0xE0, 0x49, 0xB9, 0x36,
-    0x00, 0xF9, 0x32, 0xC6, 0x96, 0xDF, 0x05, 0xF7, 0x43, 0x99, 0x3C, 0x6C, 0xB5, 0xF7, 0xF3, 0xDE,
-    0xDE, 0xC5, 0x09, 0xC3, 0x27, 0xD2, 0x0A, 0x4F, 0x3B, 0xB3, 0xB7, 0xB7, 0xB3, 0x87, 0x14, 0x20,
-    0x9B, 0xB3, 0xF3, 0x0D, 0x20, 0xA4, 0x16, 0xD0, 0x0C, 0xE4, 0xF4, 0x5A, 0xFA, 0x8B, 0x38, 0x76,
-    0x87, 0x08, 0x92, 0x15, 0xDB, 0x82, 0xE7, 0x44, 0x6E, 0xA4, 0xDA, 0xEE, 0xF0, 0x8B, 0xD8, 0xF8,
-    0xC9, 0xD7, 0x7A, 0x46, 0xEC, 0x46, 0xF6, 0x77, 0xC5, 0x65, 0x9C, 0x2B, 0xE4, 0xB7, 0x38, 0x5F,
-    0x03, 0x42, 0x03, 0x07, 0xE9, 0xB2, 0x95, 0x58, 0xC2, 0x53, 0xB4, 0xA3, 0x37, 0x80, 0x9B, 0xF0,
-    0x7F, 0x81, 0xD0, 0x24, 0xE0, 0xD8, 0x68, 0x1F, 0x47, 0x9F, 0x24, 0xD5, 0x23, 0x76, 0x47, 0xAD,
-    0xDB, 0x35, 0xEE, 0x58, 0x2D, 0x74, 0x2B, 0x72, 0x50, 0x5A, 0x0F, 0xDD, 0x70, 0x79, 0x36, 0x55,
-    0x8E, 0x09, 0xED, 0x6D, 0x9E, 0x6A, 0x0A, 0x1B, 0xEB, 0xAB, 0x27, 0x53, 0x89, 0xCC, 0xF5, 0x33,
-    0xD5, 0x5F, 0x28, 0x1E, 0xC7, 0x73, 0x6D, 0xD3, 0xD4, 0x67, 0xA0, 0xB7, 0x4D, 0x33, 0x39, 0x17,
-    0x89, 0xE3, 0xA3, 0xCD, 0x74, 0xD2, 0x8A, 0x29, 0x7A, 0xBB, 0xC4, 0xD1, 0x3F, 0x68, 0x74, 0xDE,
-    0xC1, 0x75, 0xAE, 0x66, 0x3B, 0x85, 0x36, 0xBA, 0x93, 0xF0, 0x8C, 0x89, 0x4C, 0x32, 0xEB, 0x91,
-    0xD3, 0xE5, 0x13, 0xC3, 0x48, 0x3C, 0x4F, 0x37, 0xA5, 0xFD, 0x9F, 0xB0, 0x97, 0x2F, 0xAB, 0x40,
-    0x11, 0x58, 0x42, 0x48, 0xE3, 0x36, 0x60, 0x4C, 0xE1, 0xBB, 0xB8, 0x0C, 0xEC, 0x0B, 0x44, 0x04,
-    0x8F, 0x86, 0x69, 0x73, 0xBA, 0x71, 0x09, 0x1B, 0xE9, 0xF1, 0xA0, 0x5D, 0xED, 0x5A, 0x39, 0xB0,
-    0x97, 0xD5, 0x8A, 0x24, 0xD7, 0x03, 0x74, 0x73, 0x1E, 0xF3, 0x4C, 0x88, 0xE5, 0xC0, 0xF3, 0xDB,
-    0x53, 0xB6, 0x72, 0x8B, 0xDF, 0x06, 0x70, 0x3D, 0xBC, 0x8D, 0xBC, 0xAB, 0xAF, 0x21, 0x79, 0xCB,
-    0xAE, 0xB1, 0x08, 0x65, 0x14, 0x0C, 0xA5, 0x8B, 0xB7, 0xE8, 0xDA, 0x6E, 0x52, 0xC0, 0xD2, 0xCF,
-    0xD1, 0x82, 0x65, 0xD4, 0x08, 0x9D, 0x90, 0xB9, 0x04, 0x4A, 0xC4, 0x27, 0xFA, 0xD0, 0xD7, 0xF3,
-    0xB7, 0x88, 0x0A, 0x4B, 0x77, 0x89, 0xEF, 0x92, 0xC0, 0x40, 0xCC, 0xC0, 0xE1, 0xAC, 0xE9, 0x77,
-    0x58, 0x73, 0xA1, 0x17, 0x4D, 0xFA, 0xBE, 0x48, 0xEC, 0x31, 0x5A, 0xFA, 0x6C, 0x20, 0xEE, 0x0C,
-    0x34, 0xB6, 0x64, 0xA3, 0x70, 0xD1, 0xEF, 0x3B, 0xEB, 0xE4, 0x7E, 0x3A, 0xE0, 0x23, 0x69, 0xFA,
-    0x57, 0x70, 0xAB, 0x59, 0xBE, 0x6A, 0xB7, 0xA6, 0xA9, 0xE9, 0x5F, 0xC6, 0xA6, 0x7F, 0xD9, 0xAF,
-    0xDF, 0xF4, 0x0F, 0xD3, 0x0A, 0xAB, 0x07, 0x50, 0x18, 0xCA, 0x6C, 0xA1, 0x5F, 0x86, 0x73, 0x80,
-    0x73, 0x4B, 0x97, 0x41, 0xC7, 0xC6, 0x5C, 0x2C, 0x16, 0xC7, 0xFE, 0x40, 0x5E, 0x76, 0x60, 0x0C,
-    0x7D, 0x70, 0x27, 0xE8, 0xA1, 0x85, 0x0B, 0x5D, 0x56, 0x02, 0x14, 0x52, 0xCD, 0xB5, 0xA3, 0xC6,
-    0x85, 0x9D, 0xB5, 0xD2, 0xE3, 0xA2, 0xE6, 0xA1, 0x3E, 0x9A, 0x89, 0xD8, 0x3C, 0x07, 0xF2, 0xFF,
-    0x37, 0x4B, 0xDC, 0x6A, 0x96, 0x38, 0x59, 0xC5, 0x5C, 0x22, 0x3D, 0x5E, 0xD7, 0x39, 0xFE, 0x27,
-    0xCD, 0xE2, 0x4F, 0x0B, 0xE9, 0xD6, 0x9B, 0x9A, 0xB9, 0x94, 0xE0, 0x41, 0x2C, 0x37, 0x4C, 0x2C,
-    0xE7, 0x83, 0xE5, 0x18, 0x40, 0x80, 0x23, 0x31, 0xB1, 0xDC, 0xAD, 0xC3, 0x6B, 0x2D, 0xC6, 0xF8,
-    0x0A, 0x09, 0x5C, 0x9D, 0x64, 0xB9, 0x9A, 0x2C, 0x87, 0x73, 0x8B, 0x4F, 0x63, 0xB9, 0x73, 0x10,
-    0x9C, 0x4A, 0x5A, 0x36, 0xF3, 0x57, 0xCA, 0x3E, 0xB2, 0x6D, 0x0F, 0x7F, 0x82, 0xCF, 0xCE, 0xC6,
-    0xF8, 0x61, 0x8C, 0x62, 0xF0, 0x37, 0xE4, 0xEF, 0xCD, 0x91, 0xFF, 0xC6, 0x4E, 0xB0, 0x52, 0x5D,
-    0xAD, 0xE9, 0x33, 0x4F, 0x63, 0x1E, 0xE7, 0xF7, 0x2E, 0x9E, 0xD4, 0x30, 0x2E, 0xAA, 0xC4, 0x53,
-    0xA7, 0x09, 0xFD, 0x34, 0xDA, 0x18, 0x59, 0xC1, 0x89, 0x2E, 0x16, 0x92, 0x67, 0x0E, 0x07, 0x67,
-    0xB4, 0xE0, 0x3B, 0x5D, 0x6E, 0x22, 0x30, 0x35, 0x02, 0xFE, 0xA4, 0x02, 0x7F, 0x68, 0x3D, 0x76,
-    0x6A, 0x10, 0xD3, 0xB9, 0x8E, 0x6E, 0x67, 0x73, 0xF7, 0x11, 0xD7, 0x59, 0xCD, 0x75, 0x9E, 0x6F,
-    0xD6, 0xB9, 0x59, 0x35, 0x47, 0xD9, 0x0A, 0x2E, 0x2C, 0x14, 0x60, 0xAE, 0x01, 0x86, 0x76, 0x6D,
-    0xA9, 0xCF, 0x93, 0x8A, 0x68, 0x55, 0x53, 0x99, 0xCB, 0x3B, 0xCF, 0x9C, 0x98, 0x93, 0x26, 0x8C,
-    0x79, 0x00, 0x02, 0x9B, 0xA7, 0xD5, 0x0E, 0xD8, 0xC7, 0xF2, 0x2E, 0x6D, 0x3D, 0xC8, 0xD9, 0x36,
-    0x9A, 0x18, 0x52, 0x8A, 0x6A, 0x17, 0x24, 0x8C, 0x8C, 0x2D, 0x08, 0xE1, 0xF2, 0xE0, 0xA9, 0x5A,
-    0x29, 0xDD, 0x2B, 0xEE, 0x58, 0xA3, 0x14, 0x1C, 0x52, 0xD1, 0xAC, 0xA7, 0xA3, 0x6E, 0x4F, 0xBE,
-    0x0E, 0x77, 0x2B, 0x73, 0xA9, 0x3D, 0xE8, 0x30, 0x7E, 0xE0, 0x9B, 0xEF, 0x2A, 0x2E, 0x76, 0xD8,
-    0x6C, 0x1F, 0xA8, 0x72, 0x43, 0x15, 0x96, 0xBA, 0xD3, 0x2E, 0x14, 0xE9, 0xDD, 0xA7, 0x6F, 0x90,
-    0x16, 0xE3, 0x33, 0x9A, 0x98, 0x11, 0x28, 0x0B, 0xA5, 0xBD, 0x2E, 0x8D, 0xD4, 0x29, 0x8B, 0x7A,
-    0x0D, 0x98, 0x26, 0x65, 0xB1, 0x4C, 0xE5, 0xEA, 0x98, 0xD8, 0x09, 0x4A, 0xFB, 0x76, 0xF0, 0xFC,
-    0x19, 0x5F, 0x3B, 0x0F, 0xAE, 0x14, 0xB9, 0xFE, 0x4D, 0x7A, 0x00, 0xEF, 0x2B, 0xAF, 0xB7, 0x6B,
-    0x04, 0x6D, 0xB0, 0x93, 0x3C, 0x74, 0xE6, 0xF6, 0x34, 0x6D, 0x82, 0x91, 0xBF, 0xCB, 0xD5, 0x4D,
-    0x5C, 0x73, 0x97, 0xCC, 0x98, 0xF5, 0xA1, 0x3B, 0x1F, 0x5C, 0x30, 0x7E, 0x1A, 0x97, 0xCF, 0xB5,
-    0x89, 0x65, 0x7F, 0x16, 0x3D, 0xF9, 0x07, 0x16, 0x24, 0x04, 0x23, 0x9A, 0xAB, 0xCA, 0x6B, 0x74,
-    0xAA, 0x81, 0x97, 0x3A, 0x07, 0x1C, 0x02, 0x85, 0xD1, 0x76, 0x2D, 0xE4, 0xC4, 0x09, 0x6E, 0xCC,
-    0xB1, 0xB3, 0xB3, 0xAE, 0x1E, 0x53, 0xE8, 0x92, 0xF7, 0x7A, 0x24, 0x0C, 0x60, 0x0E, 0x2C, 0xA8,
-    0x48, 0xD4, 0xB2, 0x61, 0x9B, 0x16, 0x6D, 0x3A, 0xFD, 0x75, 0x4A, 0x22, 0xF6, 0x84, 0x75, 0x33,
-    0xD5, 0xE0, 0x74, 0x68, 0x37, 0x92, 0x04, 0x1A, 0x51, 0xD1, 0x8C, 0xBB, 0x96, 0x82, 0xB0, 0xC4,
-    0x44, 0x31, 0xFF, 0x5F, 0xA0, 0x3B, 0x14, 0xF2, 0x75, 0xA1, 0x50, 0xE9, 0xF5, 0x49, 0x16, 0x0F,
-    0x7F, 0x67, 0x73, 0x9E, 0x3C, 0x1F, 0xA9, 0x65, 0xE8, 0x83, 0xF3, 0xF4, 0xEE, 0x33, 0x4F, 0xF6,
-    0x62, 0x9D, 0x72, 0x06, 0x33, 0x92, 0x3B, 0xAA, 0x26, 0x70, 0x41, 0xAE, 0x15, 0x71, 0xCC, 0x38,
-    0xB8, 0x40, 0x40, 0xAF, 0x47, 0x77, 0x64, 0x0A, 0x73, 0xC4, 0x80, 0x75, 0x41, 0xCD, 0x81, 0x16,
-    0x6C, 0xB0, 0x41, 0xA6, 0x36, 0xA5, 0x77, 0xF3, 0x4C, 0x4E, 0xCE, 0x53, 0x97, 0x34, 0xDE, 0x10,
-    0x36, 0xC1, 0x89, 0x74, 0x38, 0x31, 0x29, 0x8B, 0xDB, 0x7A, 0x4E, 0x3D, 0x5F, 0xE7, 0xFE, 0xA7,
-    0x0C, 0xC7, 0x20, 0x7F, 0xA6, 0xF6, 0xBD, 0xD7, 0x69, 0x66, 0xE8, 0x64, 0x02, 0xA6, 0x75, 0x81,
-    0xB0, 0xA8, 0x64, 0x91, 0x1C, 0xDB, 0x07, 0xF2, 0x20, 0x1A, 0xAD, 0xA0, 0xDB, 0xB8, 0xB2, 0x9C,
-    0xAF, 0xB0, 0x28, 0x15, 0xF5, 0xB0, 0x25, 0x8A, 0x6D, 0x1B, 0x71, 0x9C, 0x1E, 0xE5, 0xF9, 0x09,
-    0x83, 0xEB, 0x61, 0xFE, 0xE8, 0xB8, 0xBF, 0x0D, 0x09, 0xFB, 0xC0, 0x5D, 0x53, 0xB8, 0xA5, 0x10,
-    0x6B, 0xE2, 0x43, 0xA1, 0xB1, 0x4F, 0x18, 0xBD, 0xEC, 0x25, 0x34, 0xE8, 0x9E, 0x77, 0x09, 0x51,
-    0x31, 0x40, 0x5E, 0xE9, 0xD4, 0x5A, 0xC8, 0xC5, 0xC9, 0x8A, 0x5A, 0x1C, 0x83, 0xE9, 0xF7, 0x9E,
-    0xC5, 0x91, 0x2B, 0x2B, 0xD1, 0x2A, 0x2F, 0x56, 0x0B, 0x7B, 0x65, 0x6A, 0x06, 0xB4, 0xE8, 0x9D,
-    0x07, 0xB9, 0x9D, 0xF6, 0x2C, 0x7E, 0xBD, 0xBE, 0x20, 0x0F, 0x2E, 0xD9, 0x59, 0x57, 0xEB, 0x54,
-    0xA7, 0x38, 0xB2, 0xE3, 0xD4, 0x64, 0x2E, 0xDF, 0xA9, 0x0B, 0x99, 0xEF, 0xB2, 0x73, 0xAB, 0x4D,
-    0x04, 0x78, 0x4F, 0xAD, 0x79, 0xBF, 0x6E, 0x20, 0xA7, 0xE5, 0xF4, 0x96, 0xBA, 0x8B, 0xE6, 0x9C,
-    0x5E, 0xAB, 0x4A, 0xCA, 0x6E, 0x7C, 0x27, 0x3A, 0xE5, 0x3B, 0x66, 0xEE, 0xB2, 0xCC, 0x78, 0x8D,
-    0x71, 0xEC, 0x30, 0xC7, 0x6C, 0xCC, 0x7D, 0x32, 0x4F, 0x73, 0x61, 0xD1, 0xD2, 0x4D, 0xC0, 0x9D,
-    0x53, 0xAF, 0x92, 0xAA, 0x9F, 0xFC, 0xF8, 0x48, 0xBB, 0xC1, 0x68, 0xE5, 0x64, 0x3D, 0xCD, 0x7F,
-    0xE7, 0x33, 0x6F, 0x02, 0x1E, 0xB4, 0x0C, 0x18, 0xB9, 0xAE, 0x17, 0xEE, 0x80, 0x1E, 0x80, 0x29,
-    0xD9, 0x90, 0x12, 0xBD, 0x45, 0x19, 0x5D, 0xA3, 0x5F, 0x48, 0xF0, 0x01, 0x4B, 0x42, 0x34, 0x2E,
-    0x87, 0x86, 0x5A, 0xA9, 0xAA, 0x0F, 0x1E, 0xCE, 0xAB, 0x9F, 0xA9, 0xD9, 0x04, 0x21, 0xE2, 0x49,
-    0x1F, 0x88, 0xF7, 0xB8, 0xF6, 0x47, 0x85, 0x9E, 0x14, 0x21, 0x1E, 0xA2, 0x75, 0x27, 0xDF, 0x4C,
-    0xB6, 0xA3, 0x7A, 0xBF, 0x81, 0xB6, 0xDC, 0x38, 0xD0, 0x52, 0x89, 0xEC, 0x3E, 0x0D, 0xF2, 0xD8,
-    0x57, 0xAA, 0x52, 0xC5, 0xE8, 0x29, 0xC2, 0x1B, 0x5F, 0xF3, 0xD4, 0xDE, 0xE0, 0xD9, 0xAF, 0x3A,
-    0x3C, 0xAC, 0x44, 0x7E, 0xF8, 0x1D, 0xD8, 0x23, 0x04, 0x72, 0x30, 0x36, 0x89, 0x14, 0xAA, 0xF8,
-    0x30, 0x83, 0x3B, 0x9E, 0x02, 0x55, 0xFD, 0x84, 0x71, 0xE1, 0xD9, 0xF8, 0x85, 0xED, 0x9C, 0x90,
-    0xE0, 0x82, 0x7A, 0x04, 0x3A, 0xE4, 0xAA, 0x5D, 0xE6, 0xEC, 0x1E, 0xCC, 0xB2, 0xCA, 0x96, 0x71,
-    0x67, 0xB5, 0x97, 0x34, 0xC4, 0xA9, 0xA9, 0x10, 0x3C, 0xE0, 0xFE, 0xDD, 0x86, 0x76, 0x42, 0x69,
-    0xBC, 0xF2, 0xB0, 0xC5, 0xD0, 0xAC, 0x9E, 0x54, 0x39, 0xDC, 0x0F, 0xB2, 0x7D, 0xDF, 0x76, 0x4B,
-    0xAE, 0xA2, 0xA6, 0x9C, 0x40, 0xF9, 0x1A, 0x20, 0x3E, 0x9A, 0xCB, 0xF3, 0x88, 0x9A, 0x67, 0x4C,
-    0x96, 0x3A, 0x4D, 0x0B, 0x0C, 0xB3, 0x6D, 0x1E, 0x8F, 0xB0, 0xE4, 0x68, 0x02, 0xC4, 0x1D, 0x7C,
-    0xE2, 0x84, 0xE0, 0x4B, 0x77, 0x2E, 0xF2, 0x94, 0x45, 0x3A, 0x49, 0xDE, 0xBC, 0xD3, 0xBB, 0x5D,
-    0xE8, 0x43, 0x70, 0x77, 0xA9, 0x45, 0x29, 0xAC, 0x10, 0xF7, 0xE7, 0x23, 0x34, 0x6B, 0x1D, 0xD0,
-    0x62, 0xDF, 0x35, 0x47, 0xF3, 0xD7, 0x6E, 0xD1, 0x27, 0xB7, 0x94, 0x87, 0x61, 0xDD, 0x94, 0x0F,
-    0x8E, 0xB6, 0x6A, 0x75, 0x96, 0xBB, 0x50, 0x80, 0x7F, 0xB3, 0x91, 0xF0, 0x75, 0x55, 0x87, 0xE7,
-    0x36, 0x4A, 0x79, 0xD4, 0x68, 0x06, 0x70, 0x7D, 0xDD, 0x3F, 0x20, 0x65, 0x1F, 0x82, 0xDD, 0x52,
-    0x1E, 0xFF, 0x57, 0x94, 0xF2, 0x2C, 0xFA, 0x8D, 0x52, 0x9E, 0x40, 0x4B, 0x79, 0xFE, 0x0F, 0x4B,
-    0x79, 0x96, 0x73, 0x29, 0x4F, 0xB2, 0x86, 0xA6, 0xA5, 0x73, 0x29, 0xCF, 0x63, 0xC3, 0xC4, 0x23,
-    0xAE, 0x59, 0xFA, 0xC5, 0x8F, 0x8A, 0xF4, 0xCF, 0x17, 0xE3, 0xA1, 0x66, 0x70, 0x35, 0xDB, 0x25,
-    0xDE, 0xC5, 0xB3, 0x16, 0x67, 0x78, 0x7D, 0x08, 0xD2, 0x27, 0x33, 0xE9, 0x6B, 0x92, 0xBE, 0xD7,
-    0xF6, 0xED, 0xB3, 0xA8, 0xFC, 0xD0, 0x84, 0x7C, 0xF8, 0x9A, 0x3D, 0xCC, 0x14, 0x99, 0xAE, 0x20,
-    0xF0, 0x13, 0x35, 0x51, 0xA7, 0x10, 0x32, 0xD3, 0x33, 0x05, 0x53, 0x96, 0xEE, 0xFC, 0x3F, 0xC5,
-    0x59, 0xBF, 0x93, 0xDD, 0xC4, 0x1D, 0xFF, 0x4A, 0xF2, 0xB3, 0x26, 0xA7, 0xC1, 0x72, 0x81, 0x93,
-    0x00, 0x33, 0x28, 0x05, 0x45, 0xC8, 0xC4, 0x56, 0x4B, 0x71, 0x3E, 0x09, 0x33, 0x89, 0x8B, 0x14,
-    0xBE, 0xC2, 0x97, 0xCC, 0xD0, 0x40, 0x41, 0x66, 0x08, 0x45, 0x4C, 0xC3, 0x0C, 0x85, 0xEF, 0x49,
-    0xC6, 0x45, 0x0A, 0x0A, 0x6E, 0x32, 0xF9, 0x03, 0x28, 0x28, 0xEC, 0x97, 0x80, 0x53, 0x50, 0x98,
-    0xE4, 0xFD, 0x10, 0xBE, 0xC2, 0xC5, 0x15, 0x16, 0x76, 0xE1, 0x22, 0x05, 0x1A, 0x60, 0x86, 0x19,
-    0x6E, 0x06, 0x34, 0x89, 0x18, 0x04, 0xE8, 0x69, 0xF3, 0xF9, 0xEC, 0x4A, 0xEF, 0xDE, 0x19, 0x70,
-    0x9C, 0x33, 0x93, 0xE8, 0xFC, 0x76, 0x57, 0xBB, 0xDF, 0xFD, 0xEE, 0x77, 0x3F, 0xFB, 0xFD, 0xB5,
-    0xB2, 0xAC, 0xCB, 0x71, 0xB1, 0xDF, 0x1B, 0x4D, 0x94, 0x1A, 0xBB, 0xAF, 0xB9, 0x17, 0xAF, 0xA5,
-    0xA5, 0xAC, 0x8A, 0x2F, 0x4E, 0x26, 0xF7, 0xDA, 0x58, 0x11, 0xB1, 0x62, 0xAB, 0xC0, 0xDF, 0x57,
-    0x97, 0x67, 0x6A, 0x27, 0x2E, 0xDF, 0x5E, 0x5D, 0xF9, 0xAF, 0x18, 0x74, 0x8D, 0x27, 0x56, 0x46,
-    0xAF, 0xCF, 0xD4, 0x2D, 0xA5, 0x06, 0x1B, 0x67, 0x97, 0x9A, 0x91, 0x52, 0xEA, 0x63, 0xFC, 0xE6,
-    0x33, 0x14, 0xD9, 0xCA, 0x68, 0x34, 0xFA, 0x15, 0x1A, 0x1F, 0xE2, 0x57, 0x6D, 0x6C, 0x90, 0xD2,
-    0x3C, 0x6F, 0x70, 0x58, 0x75, 0x23, 0xFA, 0xF9, 0xC5, 0x86, 0x79, 0xEE, 0x85, 0xE4, 0xA7, 0xF2,
-    0xF8, 0xA6, 0xAC, 0xFD, 0x2F, 0xFF, 0x89, 0x79, 0x5C, 0x48, 0x71, 0xB3, 0xDF, 0x8B, 0x2C, 0x75,
-    0x7E, 0xC0, 0xCE, 0x63, 0xBA, 0xF3, 0xA4, 0x8C, 0xAD, 0xDA, 0xA9, 0xDC, 0xD2, 0xCF, 0xC3, 0x2C,
-    0x4A, 0x67, 0xF1, 0x86, 0x48, 0x6B, 0xCD, 0x9D, 0xC6, 0xA9, 0xBC, 0xC2, 0xCF, 0x82, 0x34, 0x92,
-    0x4D, 0x01, 0xDD, 0xD9, 0xAE, 0x0F, 0x74, 0xEC, 0x1B, 0xCA, 0x58, 0xA6, 0x78, 0x92, 0x28, 0x8A,
-    0xC2, 0x01, 0xB8, 0x54, 0x76, 0xE9, 0x81, 0x7A, 0x28, 0x73, 0xA7, 0x74, 0x4B, 0xB0, 0x8A, 0xE7,
-    0x76, 0x03, 0xEA, 0x02, 0x3C, 0x4F, 0x35, 0xD6, 0xD9, 0xC1, 0x3A, 0xF8, 0x62, 0x9D, 0x0A, 0x43,
-    0x59, 0x2B, 0x73, 0xB7, 0xF4, 0x30, 0x14, 0x49, 0x63, 0xD5, 0x5E, 0xEE, 0x67, 0x58, 0xC5, 0x2A,
-    0xAD, 0xF5, 0x41, 0xCC, 0x95, 0xD6, 0x41, 0x95, 0x47, 0x99, 0x02, 0x15, 0x16, 0x0C, 0xD3, 0x28,
-    0x26, 0x55, 0x41, 0xAA, 0xA1, 0xC5, 0x85, 0x52, 0x99, 0xB8, 0xFF, 0xAA, 0x83, 0x9D, 0x22, 0x09,
-    0xD3, 0x66, 0xE8, 0x94, 0xB5, 0xB7, 0x5D, 0x86, 0x67, 0xB2, 0xCD, 0x50, 0xAA, 0x07, 0x2D, 0xB0,
-    0xB8, 0x84, 0x6D, 0x96, 0x22, 0x61, 0x26, 0x32, 0x15, 0xB1, 0xD1, 0xF4, 0xD1, 0x5C, 0x13, 0x4B,
-    0xCA, 0x41, 0xA8, 0x54, 0xCD, 0x63, 0xBA, 0xFC, 0xCE, 0x9F, 0x63, 0x27, 0xC7, 0x08, 0x30, 0x39,
-    0xDF, 0x11, 0xA5, 0xC4, 0x43, 0xAC, 0x4A, 0xC4, 0x03, 0x7D, 0x84, 0x91, 0x06, 0x9C, 0x0A, 0x70,
-    0xC2, 0xC8, 0x5C, 0xC4, 0x01, 0x51, 0x80, 0x11, 0x85, 0x66, 0x8D, 0x66, 0x41, 0x40, 0x57, 0xB6,
-    0x30, 0x05, 0x83, 0x7A, 0xC4, 0x42, 0xB7, 0x84, 0xB1, 0xE1, 0x27, 0x27, 0xD0, 0xDE, 0xDD, 0x6D,
-    0x1C, 0x2A, 0x57, 0xB4, 0xBB, 0x8B, 0xB1, 0xAB, 0x62, 0x96, 0x31, 0x74, 0xA9, 0xE1, 0xA3, 0x57,
-    0x22, 0x6F, 0x40, 0x8D, 0xF5, 0x32, 0xB1, 0xD7, 0xCF, 0x1F, 0x8B, 0x13, 0x9C, 0x91, 0x87, 0x99,
-    0xF2, 0xDB, 0x33, 0x83, 0xD7, 0xC5, 0xE2, 0x70, 0xD8, 0xD3, 0x25, 0x64, 0xC3, 0xD5, 0x5B, 0x4A,
-    0xB0, 0xEE, 0xA8, 0x53, 0xAA, 0x52, 0x6D, 0xA2, 0xDE, 0x57, 0x5F, 0xA8, 0x46, 0xB5, 0x81, 0xB2,
-    0xF4, 0x80, 0x07, 0xAA, 0x5C, 0xFC, 0x5A, 0x02, 0x25, 0xA1, 0xCA, 0x43, 0x55, 0x47, 0xEA, 0xA3,
-    0xA8, 0x95, 0x24, 0xA7, 0x20, 0x90, 0x72, 0xE0, 0x7F, 0xDD, 0xAA, 0xD9, 0x2F, 0xE5, 0x70, 0x2C,
-    0xEB, 0xB3, 0xD8, 0xFF, 0x70, 0x2E, 0xB3, 0x1B, 0x95, 0xD3, 0x46, 0x99, 0x57, 0x3E, 0x26, 0x03,
-    0xDD, 0x2D, 0x03, 0xAF, 0xC2, 0x86, 0x03, 0x8C, 0x25, 0x99, 0x5F, 0xAB, 0x38, 0x2C, 0x49, 0xE0,
-    0xA2, 0xD3, 0x8E, 0xE5, 0x39, 0x52, 0x39, 0x4D, 0x72, 0xBB, 0x49, 0x2E, 0x6C, 0xBD, 0x30, 0x82,
-    0x11, 0x1C, 0xC0, 0x38, 0xD9, 0xB0, 0x33, 0x19, 0x8D, 0x12, 0x75, 0x80, 0x99, 0x5D, 0xE3, 0x48,
-    0xA2, 0x6E, 0xAB, 0xF9, 0x1D, 0x05, 0x46, 0x70, 0xBE, 0x07, 0x29, 0x30, 0x7D, 0x74, 0xE9, 0x45,
-    0x71, 0x45, 0x74, 0xF1, 0xD2, 0xC6, 0xE9, 0xFB, 0xE3, 0x76, 0x73, 0xF4, 0xA6, 0x48, 0x2E, 0x0F,
-    0xE8, 0xE2, 0xD8, 0xC6, 0x7D, 0xC9, 0xB6, 0xF7, 0x78, 0x38, 0x66, 0x87, 0x7A, 0xE0, 0xA8, 0x5A,
-    0x2B, 0x2B, 0x14, 0xFE, 0x99, 0x4C, 0x2B, 0xA0, 0x04, 0xE9, 0xA6, 0xD6, 0x5D, 0xA8, 0x22, 0xF4,
-    0x5C, 0x8F, 0xAD, 0xE1, 0x2F, 0xD2, 0x4E, 0x20, 0x77, 0x73, 0x2F, 0x67, 0x6B, 0x0C, 0xC3, 0xA3,
-    0x0A, 0xC2, 0x42, 0xBC, 0x4C, 0x8F, 0x81, 0xB4, 0xA1, 0xB9, 0x50, 0x51, 0xFD, 0x57, 0xAA, 0x63,
-    0xD0, 0x92, 0xB8, 0xB6, 0xAA, 0x61, 0xD0, 0x8A, 0xAF, 0x60, 0x83, 0xFE, 0x75, 0x55, 0x3B, 0xAA,
-    0x99, 0xF8, 0x37, 0xCB, 0x79, 0x90, 0xB5, 0xFE, 0x6D, 0x55, 0x6F, 0x86, 0xF1, 0x18, 0xCB, 0x85,
-    0xAD, 0x7F, 0xB1, 0x74, 0x6F, 0x95, 0x4E, 0xF1, 0x82, 0x53, 0x6E, 0xCA, 0x26, 0x97, 0x93, 0xB1,
-    0x97, 0x79, 0xD7, 0xB1, 0x9C, 0x04, 0x71, 0x23, 0x63, 0x2C, 0x07, 0x81, 0xC1, 0xF8, 0x06, 0x96,
-    0xC3, 0x4A, 0xB5, 0xD4, 0x58, 0x0E, 0x8A, 0xED, 0xA7, 0xC1, 0x99, 0xCC, 0x4F, 0x41, 0x57, 0x3B,
-    0x65, 0x03, 0xEB, 0xA9, 0xD1, 0xB5, 0xE9, 0x67, 0x5A, 0x60, 0xAC, 0x33, 0x0D, 0x32, 0x08, 0xEC,
-    0xAA, 0xD2, 0x51, 0x15, 0x05, 0x0E, 0x1B, 0x09, 0xE6, 0x5A, 0xDC, 0x07, 0x45, 0x8E, 0xC9, 0xFE,
-    0x67, 0x01, 0xCB, 0x3E, 0x64, 0x96, 0xC1, 0x59, 0xC6, 0x67, 0x1F, 0x44, 0xCB, 0x28, 0xED, 0x03,
-    0x6A, 0x19, 0xAB, 0x7D, 0x70, 0x2D, 0x23, 0xB6, 0x0F, 0xB4, 0x65, 0xDC, 0xC4, 0x53, 0x67, 0x16,
-    0xD0, 0x2D, 0xA3, 0x97, 0x4F, 0xBD, 0x8F, 0x17, 0x00, 0x02, 0xDD, 0x05, 0x86, 0x1F, 0x54, 0x4E,
-    0xB9, 0x80, 0x31, 0xA2, 0x40, 0x1D, 0x92, 0xB7, 0x0A, 0x6C, 0xAD, 0x07, 0x93, 0xCE, 0xBE, 0xC7,
-    0x73, 0x27, 0x73, 0xF3, 0x05, 0xA4, 0x63, 0x48, 0xDB, 0xA3, 0xFA, 0x6A, 0xE6, 0x67, 0x0B, 0x60,
-    0xC7, 0x70, 0x6F, 0x3D, 0xB6, 0xDC, 0xC2, 0x02, 0xDE, 0xC4, 0xCB, 0x17, 0x08, 0x03, 0xB4, 0x3D,
-    0x90, 0xFD, 0x76, 0x09, 0xE7, 0x81, 0xF6, 0x5B, 0x41, 0xE6, 0xE7, 0x6E, 0xE9, 0x94, 0x20, 0x6A,
-    0xE0, 0x3D, 0xD7, 0xB4, 0x17, 0x0D, 0x2F, 0xD4, 0x92, 0x38, 0x15, 0x7D, 0xBB, 0x05, 0x3C, 0x9C,
-    0x32, 0x88, 0xDD, 0x22, 0x02, 0x52, 0xE7, 0x25, 0xC0, 0x92, 0x6B, 0x70, 0x61, 0xAB, 0xF4, 0xB8,
-    0xA0, 0xE3, 0xEC, 0xE8, 0x54, 0x4D, 0xD2, 0x08, 0x7E, 0xB3, 0xF1, 0x72, 0x52, 0x37, 0x02, 0x5F,
-    0x1E, 0x72, 0x82, 0x53, 0x58, 0xA5, 0x9F, 0x8E, 0x39, 0x87, 0x06, 0x7E, 0xD2, 0x2E, 0xB0, 0x99,
-    0x09, 0x02, 0x55, 0x89, 0x90, 0x04, 0x1F, 0x5D, 0xE3, 0xC0, 0xB2, 0x10, 0xC4, 0x4F, 0x95, 0xC1,
-    0x2B, 0x95, 0xFF, 0x6E, 0xED, 0x67, 0x8D, 0x9B, 0x8D, 0x9D, 0x1C, 0x33, 0x4F, 0xDA, 0xE5, 0x9A,
-    0x94, 0x8F, 0x62, 0x74, 0x68, 0x57, 0x91, 0x43, 0x02, 0x84, 0x19, 0x92, 0x65, 0x8D, 0x9F, 0x9E,
-    0xF7, 0xB2, 0x1A, 0x64, 0x5E, 0xB6, 0x86, 0x12, 0x94, 0x4E, 0xEE, 0x5B, 0xC5, 0x71, 0x73, 0x74,
-    0x5D, 0x9C, 0x98, 0xC5, 0xE2, 0xBE, 0x8F, 0x48, 0xB0, 0x2A, 0x76, 0xF1, 0xB6, 0x04, 0x56, 0x21,
-    0x95, 0x03, 0xD5, 0xF4, 0x81, 0xE8, 0x71, 0x38, 0x9B, 0x97, 0x4F, 0x92, 0xD2, 0x62, 0xD4, 0x08,
-    0x32, 0x6E, 0x55, 0x92, 0x38, 0xC8, 0xE1, 0x0F, 0x23, 0xB1, 0x6B, 0x32, 0x98, 0xD2, 0x47, 0x43,
-    0xCB, 0x1A, 0x39, 0x4C, 0x27, 0xBB, 0xC6, 0xD7, 0x20, 0xC5, 0x2B, 0xB4, 0x4D, 0xD3, 0x60, 0x1A,
-    0xB6, 0x2E, 0x51, 0xEC, 0xE7, 0x80, 0x6B, 0x53, 0xAC, 0x78, 0xA1, 0xB9, 0x31, 0x19, 0x58, 0x52,
-    0x09, 0x28, 0x9C, 0x3C, 0x8A, 0xE1, 0xC7, 0x1D, 0x84, 0x67, 0xCC, 0x43, 0xA0, 0xC0, 0x2B, 0x2B,
-    0xBC, 0xEA, 0xB0, 0x11, 0xC5, 0xBA, 0xC2, 0xAB, 0x0E, 0x22, 0x49, 0xAC, 0x2B, 0xB7, 0xD2, 0x95,
-    0x24, 0x4F, 0xD5, 0x3C, 0x2D, 0xF7, 0x8B, 0x5A, 0x0E, 0x21, 0x54, 0x24, 0x58, 0x76, 0xBB, 0x21,
-    0x5B, 0xAF, 0x82, 0x8F, 0x56, 0xB1, 0x35, 0x0F, 0x62, 0xE7, 0xEB, 0x8A, 0x31, 0xCA, 0xA9, 0x13,
-    0x4A, 0xE0, 0xD4, 0xD8, 0x84, 0x66, 0x9D, 0x98, 0x8A, 0x31, 0x94, 0xCC, 0x12, 0x53, 0xE1, 0xD5,
-    0x2C, 0xC4, 0xEA, 0x04, 0x5E, 0x51, 0x05, 0xB9, 0x24, 0x50, 0x02, 0xB0, 0x75, 0x8B, 0x1F, 0xEB,
-    0x18, 0xF9, 0x2C, 0x28, 0x1E, 0x32, 0x56, 0x48, 0x02, 0xDF, 0x14, 0xE0, 0x1C, 0x14, 0x1E, 0x70,
-    0xC8, 0x51, 0x84, 0x19, 0x04, 0x8A, 0xA0, 0x42, 0x12, 0xA5, 0x60, 0x10, 0xC5, 0x88, 0x9C, 0x09,
-    0xA3, 0xF5, 0x0C, 0x1D, 0x80, 0x0F, 0x1B, 0x9B, 0x53, 0x2F, 0x1B, 0xAE, 0x0C, 0xA5, 0x60, 0xB4,
-    0x9C, 0x88, 0x5D, 0xA1, 0x0D, 0x28, 0x75, 0x51, 0x8B, 0xB5, 0x8E, 0xD8, 0xB4, 0xF7, 0x1C, 0x8E,
-    0xAD, 0x54, 0xC2, 0xDC, 0x2F, 0x25, 0xCA, 0x83, 0xBE, 0xC8, 0x10, 0xA1, 0x75, 0x14, 0xD3, 0xCF,
-    0xAC, 0x85, 0x15, 0xAA, 0xDC, 0x57, 0xAA, 0xF4, 0xCE, 0x5D, 0x07, 0x9C, 0xD7, 0x1A, 0x89, 0x2E,
-    0xE0, 0xF7, 0x24, 0x16, 0xB2, 0xF1, 0x83, 0xA4, 0x53, 0x88, 0x37, 0x0F, 0x61, 0x46, 0x2A, 0x16,
-    0xB8, 0x68, 0x4B, 0x55, 0xF8, 0x21, 0x20, 0xC3, 0x04, 0xEC, 0xDA, 0x04, 0x5F, 0x3A, 0x96, 0xA5,
-    0x13, 0xD3, 0xEC, 0xB1, 0x0B, 0x89, 0xD0, 0x1F, 0xB1, 0xCE, 0x8C, 0x95, 0x68, 0x08, 0x10, 0xBF,
-    0xB7, 0xF1, 0x2B, 0x99, 0x21, 0xFE, 0x84, 0x46, 0xF4, 0x57, 0x14, 0x4F, 0xBC, 0x4C, 0x65, 0x5B,
-    0x05, 0xAB, 0x3C, 0xC0, 0xDC, 0xD8, 0x2B, 0x90, 0x3F, 0xD8, 0x4A, 0x31, 0xD1, 0xA0, 0xAD, 0x59,
-    0x23, 0xA4, 0x14, 0x09, 0x96, 0xF6, 0xBF, 0xFC, 0x11, 0x0D, 0xCC, 0xAA, 0x90, 0x32, 0x58, 0xE5,
-    0xDB, 0x90, 0xE1, 0x36, 0x53, 0x86, 0xBF, 0x80, 0xE6, 0xC8, 0x3E, 0x87, 0xB7, 0x4A, 0xC7, 0x03,
-    0x39, 0xAC, 0xA2, 0x7B, 0xF1, 0x98, 0x63, 0x30, 0x52, 0x9C, 0xA4, 0x4A, 0xA4, 0x46, 0xB9, 0xE5,
-    0xB8, 0x49, 0x2F, 0x44, 0x2A, 0x93, 0x9C, 0x18, 0x27, 0x39, 0xA5, 0x33, 0xE4, 0xC6, 0x6E, 0xA0,
-    0x71, 0x15, 0x02, 0xFA, 0x5E, 0x2C, 0x76, 0x0E, 0x21, 0xCF, 0x43, 0xDD, 0x7D, 0xA1, 0x1D, 0xA0,
-    0xB1, 0xAA, 0x79, 0x75, 0x9E, 0xA0, 0x7B, 0x98, 0xC1, 0x74, 0xAD, 0x05, 0x22, 0xBD, 0x57, 0x3C,
-    0xB4, 0xC8, 0x43, 0x83, 0xB4, 0x9F, 0x19, 0xD6, 0xAB, 0x5D, 0xEB, 0x11, 0x35, 0xEE, 0xCF, 0x0F,
-    0x19, 0x59, 0x17, 0xD3, 0xEC, 0x45, 0xCB, 0x9B, 0x23, 0xE7, 0x31, 0xA3, 0xE7, 0x7A, 0xC6, 0x6D,
-    0xD0, 0x35, 0x9C, 0xC6, 0xEF, 0xD6, 0x45, 0x82, 0xD9, 0xF9, 0x5D, 0x3B, 0xF7, 0x8C, 0x2F, 0x3F,
-    0x2A, 0x31, 0x8C, 0x52, 0x4C, 0x92, 0x64, 0xC7, 0x3A, 0x5D, 0x9A, 0x4A, 0x9F, 0x38, 0x8D, 0x8D,
-    0x53, 0x07, 0x15, 0x5A, 0x16, 0xC1, 0x80, 0x33, 0x21, 0x0E, 0x88, 0x46, 0xB3, 0x1C, 0xB0, 0xB8,
-    0x2D, 0xA0, 0x3B, 0x37, 0x2F, 0x29, 0xCC, 0x67, 0x20, 0x41, 0x46, 0x93, 0x43, 0x58, 0x65, 0x74,
-    0x87, 0xC7, 0xD2, 0x4A, 0x50, 0x3D, 0x8D, 0xF5, 0xD5, 0x85, 0xDF, 0xC9, 0x90, 0xFC, 0x9C, 0x2F,
-    0xA0, 0x20, 0x0D, 0xB7, 0x18, 0x6C, 0x17, 0x10, 0x89, 0x00, 0x24, 0xA7, 0xA8, 0xEB, 0x04, 0xA5,
-    0x85, 0xF2, 0x7A, 0x29, 0xEC, 0x1F, 0xFE, 0x02, 0x47, 0xA9, 0x3D, 0xCC, 0x51, 0x1A, 0x8A, 0xFC,
-    0x40, 0xCB, 0xFB, 0x9C, 0xAC, 0x8C, 0xFE, 0xA8, 0xDA, 0x48, 0xBD, 0x67, 0x72, 0x74, 0x66, 0x9F,
-    0xC6, 0x0F, 0x75, 0x61, 0xCB, 0x84, 0x9F, 0xE1, 0x62, 0x0B, 0x06, 0x60, 0xBB, 0x32, 0xC8, 0xEE,
-    0x91, 0xE9, 0x19, 0x9B, 0xD2, 0x9F, 0xEA, 0x77, 0x90, 0x19, 0xC6, 0x13, 0x0D, 0xC3, 0x1E, 0x99,
-    0x61, 0xAC, 0xCF, 0xB0, 0xCF, 0x06, 0xEE, 0x58, 0x1F, 0x03, 0x08, 0xA4, 0x1E, 0x74, 0x34, 0x52,
-    0xB1, 0x4E, 0x8B, 0x4B, 0xC3, 0x77, 0x62, 0x66, 0x73, 0x42, 0x62, 0x8C, 0xC4, 0xCF, 0xF7, 0xE7,
-    0xCE, 0x9F, 0x68, 0x53, 0x72, 0x70, 0xB4, 0xCC, 0x90, 0x87, 0x46, 0x28, 0xDF, 0x24, 0xD8, 0xF0,
-    0x9E, 0xC2, 0x83, 0x83, 0xC9, 0x93, 0xDE, 0xE9, 0x98, 0x4E, 0x19, 0xB7, 0xA1, 0xFF, 0x30, 0xBD,
-    0x48, 0x69, 0xC5, 0xD8, 0x7B, 0xF9, 0x8E, 0x29, 0x13, 0xED, 0x09, 0x7B, 0x39, 0xB8, 0x0B, 0x08,
-    0x4E, 0x7A, 0xD5, 0x30, 0xA8, 0x19, 0x5D, 0x5D, 0x12, 0x76, 0xF8, 0xED, 0xC2, 0x6A, 0xA6, 0x5A,
-    0x56, 0x2C, 0x37, 0x6B, 0x97, 0x6C, 0x2C, 0xC1, 0xCB, 0xB9, 0x36, 0xA6, 0x1A, 0xE0, 0x57, 0xF8,
-    0xED, 0xAC, 0xF2, 0xD5, 0xAC, 0xF2, 0x52, 0xB7, 0x76, 0x53, 0x17, 0xF3, 0xED, 0xEE, 0x67, 0x2D,
-    0xFD, 0x64, 0xA9, 0xAD, 0x9D, 0x35, 0xE5, 0x2A, 0xBB, 0xEB, 0x49, 0x6E, 0x1C, 0x07, 0xE2, 0x8D,
-    0xCC, 0x52, 0x71, 0x78, 0xC1, 0xC0, 0x1A, 0x01, 0x77, 0x51, 0x19, 0x3F, 0xC2, 0x5F, 0x6B, 0x14,
-    0x98, 0x3B, 0xB2, 0xBA, 0xFD, 0xDA, 0x9D, 0x1B, 0x62, 0x9B, 0xAE, 0xC8, 0x5A, 0x97, 0x6F, 0x3C,
-    0x74, 0x4B, 0x56, 0xE7, 0x9A, 0x78, 0x51, 0x89, 0x8A, 0x25, 0x17, 0x55, 0xEC, 0xB1, 0xA7, 0xAB,
-    0x1A, 0xEC, 0x4D, 0x0B, 0x14, 0xDD, 0xE8, 0x0C, 0x07, 0xE6, 0x97, 0xD1, 0x57, 0x2A, 0x77, 0x1A,
-    0x6E, 0x50, 0x0B, 0x31, 0x13, 0x86, 0x89, 0x20, 0xE3, 0xB5, 0x0A, 0xD7, 0x37, 0xAE, 0xDD, 0xE8,
-    0x80, 0xD0, 0x6A, 0x75, 0x9E, 0x69, 0x1C, 0x67, 0x74, 0xE6, 0x28, 0x79, 0x42, 0x2A, 0x76, 0xE8,
-    0x3E, 0xB5, 0xBA, 0x28, 0x0D, 0x73, 0xAB, 0xCF, 0x6A, 0xA8, 0x4D, 0x30, 0xD2, 0xFB, 0xA0, 0x25,
-    0x37, 0x5A, 0xD0, 0x3B, 0x92, 0x38, 0xC4, 0x10, 0x6B, 0x8B, 0xD2, 0xDB, 0x73, 0xDE, 0x60, 0x44,
-    0xA5, 0x04, 0x08, 0xD2, 0x83, 0x13, 0xBC, 0x3C, 0x45, 0x5E, 0xDA, 0x75, 0x98, 0xD9, 0xCC, 0xF3,
-    0x94, 0xA5, 0xA8, 0x6A, 0x8D, 0xAB, 0x66, 0x48, 0x5D, 0x0A, 0x3F, 0xC6, 0xDD, 0x85, 0x42, 0xFB,
-    0x05, 0x0F, 0x86, 0x81, 0xA7, 0x34, 0x92, 0xA6, 0xFA, 0xF4, 0x29, 0x36, 0x53, 0x11, 0xA1, 0x7C,
-    0xDC, 0x16, 0x36, 0x45, 0x5F, 0xA1, 0x05, 0xE7, 0x41, 0x30, 0x18, 0x1B, 0xC9, 0x01, 0x21, 0x4F,
-    0x60, 0xAE, 0xD5, 0x4A, 0xAB, 0x5F, 0xAF, 0x37, 0x34, 0x58, 0x1C, 0xC0, 0x72, 0x48, 0x30, 0xF6,
-    0xB2, 0xC5, 0x7F, 0x3C, 0x65, 0x72, 0x66, 0x3C, 0x89, 0x79, 0xC6, 0xD4, 0x14, 0x48, 0xC1, 0xDB,
-    0xDB, 0xA0, 0xF7, 0x01, 0xDA, 0xF3, 0x29, 0xF5, 0x8F, 0xEE, 0xB3, 0xC1, 0xAF, 0x9B, 0xDE, 0xEC,
-    0x74, 0x20, 0xAE, 0x7A, 0x47, 0xDB, 0x88, 0xD1, 0xD7, 0xFD, 0xDD, 0xD6, 0xA2, 0x7B, 0xD6, 0x77,
-    0x47, 0xDF, 0xE8, 0xFE, 0xD9, 0xE8, 0xF2, 0x3A, 0xAC, 0x01, 0xCE, 0x8B, 0x9F, 0x3C, 0xB2, 0x93,
-    0xBF, 0x81, 0xA7, 0x5D, 0xC5, 0xBD, 0xB4, 0x62, 0xD1, 0x2C, 0x8A, 0xF9, 0x5D, 0x8B, 0x3D, 0x3A,
-    0x3D, 0x4D, 0x33, 0xC8, 0x50, 0x7C, 0x89, 0xBC, 0x0E, 0x5B, 0xFC, 0x7E, 0x8A, 0xCE, 0xD7, 0xC0,
-    0xC2, 0x70, 0x01, 0x56, 0x17, 0x95, 0xFA, 0x7C, 0x08, 0x91, 0xD3, 0x77, 0x20, 0xBB, 0xBD, 0x8B,
-    0xBB, 0xBB, 0x07, 0x8F, 0x5C, 0x9C, 0xC0, 0x50, 0xFA, 0x77, 0x76, 0x7D, 0xB6, 0xAF, 0xEB, 0x6F,
-    0xEC, 0xFA, 0x98, 0x5D, 0xAF, 0xB1, 0x0B, 0x91, 0x25, 0xBD, 0xCA, 0x0D, 0x17, 0x21, 0x47, 0x07,
-    0xA3, 0xD1, 0xE5, 0x1E, 0x6C, 0xDA, 0xB0, 0xAA, 0x4E, 0x10, 0x87, 0xAB, 0x68, 0xFE, 0x93, 0x14,
-    0x3B, 0x29, 0x18, 0xBD, 0x85, 0xD1, 0x96, 0x5D, 0x2D, 0xBB, 0xBE, 0x66, 0xD7, 0xA7, 0x9C, 0xB0,
-    0xE8, 0xDA, 0x65, 0xD7, 0xEF, 0xD1, 0xD5, 0xB0, 0x8B, 0x9F, 0x52, 0x14, 0x79, 0x15, 0x0F, 0x8F,
-    0x46, 0x7F, 0xEA, 0x83, 0xE3, 0xBC, 0xF7, 0xA9, 0x50, 0x20, 0x1D, 0x07, 0x27, 0x88, 0xBF, 0x8E,
-    0x3A, 0x9D, 0xC9, 0x61, 0xF5, 0xA9, 0x9C, 0x95, 0x73, 0x0C, 0x74, 0x48, 0x44, 0x32, 0x51, 0xD9,
-    0xD3, 0xE2, 0xDF, 0xE0, 0xE7, 0x85, 0x90, 0x6A, 0x3A, 0xE4, 0x71, 0xE1, 0xE4, 0x4A, 0xFA, 0xC8,
-    0x58, 0x6B, 0x26, 0x55, 0xE4, 0x39, 0x7B, 0xEE, 0xCC, 0x5D, 0x5A, 0xDB, 0xB7, 0x58, 0x3A, 0x4D,
-    0x47, 0xC1, 0xB4, 0xA6, 0xFA, 0x6F, 0xA8, 0xEF, 0x2F, 0x3A, 0xF4, 0xBE, 0xF0, 0x86, 0xF9, 0xDE,
-    0x03, 0xCD, 0x8C, 0x3E, 0x7A, 0xA6, 0xE8, 0x94, 0x95, 0x8E, 0xE3, 0xBC, 0x20, 0xC4, 0x23, 0x1D,
-    0x78, 0x54, 0x67, 0x12, 0x3F, 0xFF, 0x46, 0x3E, 0xF1, 0x7F, 0x7D, 0x74, 0x9E, 0x24, 0x3A, 0x51,
-    0x12, 0x9D, 0x29, 0x89, 0x4E, 0x95, 0x44, 0xE7, 0x4A, 0xA2, 0x93, 0xA5, 0x2E, 0x5B, 0x32, 0xE9,
-    0x52, 0xEF, 0x09, 0x4C, 0x02, 0xB0, 0x88, 0x72, 0x47, 0x45, 0xC7, 0x00, 0xA6, 0x45, 0x2A, 0x07,
-    0x90, 0x44, 0xFE, 0x41, 0x1D, 0xD0, 0x69, 0x8E, 0x88, 0x0A, 0x12, 0x96, 0x3F, 0x4C, 0x0D, 0xF8,
-    0x4E, 0xC5, 0x40, 0xDE, 0x12, 0x9A, 0x50, 0x5F, 0xEB, 0x34, 0xFE, 0x96, 0x0E, 0x58, 0x22, 0x5B,
-    0xBD, 0x64, 0xC6, 0x4F, 0x4E, 0xF7, 0xA2, 0x22, 0x3D, 0xBB, 0x76, 0x61, 0x43, 0xA6, 0x54, 0x5E,
-    0xCB, 0x6B, 0xD0, 0xB9, 0xB6, 0x84, 0x2F, 0x78, 0x44, 0xAF, 0xE0, 0x71, 0x31, 0x5B, 0x3D, 0xF9,
-    0x3C, 0x34, 0x80, 0x2B, 0x44, 0x7F, 0xC8, 0x68, 0xFD, 0x6B, 0x0C, 0x14, 0xD4, 0x0F, 0x2F, 0xA6,
-    0x05, 0x1F, 0xD5, 0xB6, 0xDA, 0xFB, 0x02, 0xF4, 0x6F, 0xCE, 0x52, 0x6F, 0x07, 0x99, 0x1F, 0x2E,
-    0x16, 0x4F, 0xEA, 0x0C, 0x66, 0x68, 0xE2, 0x7B, 0xA3, 0x11, 0x60, 0xC7, 0x9A, 0x91, 0xE0, 0xDE,
-    0x3A, 0x52, 0x7F, 0xBB, 0xB4, 0xDB, 0x35, 0x09, 0x77, 0x73, 0x62, 0x67, 0xE9, 0x38, 0xC6, 0x3D,
-    0xC4, 0x00, 0x63, 0x8B, 0x29, 0xA1, 0x1A, 0x29, 0xF5, 0x11, 0x02, 0xE0, 0x84, 0xF8, 0x7C, 0x75,
-    0xA5, 0x64, 0x32, 0x43, 0x1D, 0x3D, 0x62, 0x52, 0xB5, 0xAD, 0x85, 0x59, 0x62, 0x7A, 0xD0, 0x22,
-    0x44, 0x4C, 0xA1, 0x9B, 0x8C, 0x42, 0x15, 0xC5, 0x5A, 0xE5, 0xB6, 0x8F, 0x33, 0xB3, 0x3B, 0x72,
-    0x48, 0x27, 0x7E, 0x26, 0xCD, 0x42, 0x61, 0xCB, 0xD8, 0x86, 0xE4, 0x63, 0xDE, 0x06, 0xC7, 0x08,
-    0xD8, 0xCD, 0x98, 0x3E, 0x5C, 0x31, 0xC2, 0x21, 0x99, 0x1A, 0x5D, 0x51, 0x9F, 0x5C, 0xA2, 0xFD,
-    0x34, 0xFC, 0x78, 0xDA, 0xE8, 0x3E, 0x33, 0x3A, 0x07, 0x1D, 0xCE, 0x24, 0xC2, 0x16, 0x38, 0x37,
-    0x1E, 0x3B, 0xF1, 0x1E, 0x53, 0x59, 0x24, 0x98, 0xE6, 0x9B, 0x1B, 0x83, 0x25, 0x63, 0x83, 0x76,
-    0x8B, 0x77, 0x79, 0x06, 0x62, 0x62, 0xAF, 0xA6, 0x55, 0x8B, 0xB4, 0xE8, 0x3F, 0x3C, 0xB4, 0x24,
-    0xC6, 0x4C, 0xAE, 0xA2, 0x83, 0xC8, 0x43, 0xFA, 0x06, 0x1B, 0x64, 0x13, 0x5E, 0x76, 0x79, 0x7F,
-    0xC0, 0x25, 0x16, 0x2D, 0x5E, 0x79, 0x27, 0x6E, 0xC1, 0x7B, 0x2C, 0x6E, 0xA3, 0xB8, 0xF8, 0xDA,
-    0x68, 0xF1, 0x2A, 0x9B, 0x47, 0xBC, 0xFE, 0x7A, 0xB8, 0x05, 0xEB, 0xDB, 0x6C, 0xCD, 0x4B, 0xF0,
-    0x71, 0x9D, 0x9B, 0xEB, 0x1D, 0x74, 0x0E, 0x5A, 0x47, 0x9D, 0xE5, 0x2A, 0x39, 0x88, 0xE9, 0x18,
-    0x05, 0x7D, 0x2C, 0xD2, 0x6A, 0xDB, 0xEA, 0xCA, 0x52, 0xA6, 0x6A, 0x83, 0xF8, 0x0E, 0xFC, 0xEE,
-    0xFD, 0x19, 0x76, 0x02, 0xEE, 0x93, 0xB3, 0x93, 0xFA, 0xC7, 0xA2, 0x35, 0x8A, 0x99, 0xB7, 0x67,
-    0xD2, 0xD3, 0x8B, 0xFA, 0xBB, 0x8C, 0x5F, 0x2A, 0x93, 0xAB, 0x1B, 0x94, 0xA7, 0x07, 0xF3, 0x05,
-    0x27, 0xBA, 0xF0, 0x6E, 0x72, 0x50, 0xBF, 0x32, 0xC1, 0xB2, 0xFB, 0x52, 0xF3, 0xF8, 0xC1, 0x78,
-    0x1A, 0x20, 0xAE, 0xEA, 0x54, 0x40, 0x12, 0x23, 0x6D, 0x58, 0x68, 0x69, 0xDD, 0x7A, 0xA5, 0x4B,
-    0xCA, 0x11, 0xED, 0xA3, 0xED, 0x79, 0x98, 0xAD, 0xDF, 0x85, 0x51, 0xB8, 0xDD, 0x44, 0x37, 0x9B,
-    0x45, 0xF2, 0x64, 0x32, 0x67, 0x8D, 0xB6, 0xD3, 0x2C, 0x9A, 0xFA, 0x42, 0x7C, 0x4F, 0x8F, 0x9E,
-    0xDF, 0x70, 0x52, 0x78, 0x4B, 0xE7, 0x82, 0xCC, 0x1B, 0xC2, 0xFC, 0x59, 0x23, 0xCF, 0xBD, 0x3D,
-    0x76, 0x73, 0x87, 0x0C, 0x61, 0xB6, 0xF0, 0x8F, 0xF2, 0xBC, 0xA1, 0x99, 0x2C, 0x55, 0x47, 0x51,
-    0x1D, 0xE2, 0xE7, 0x6B, 0x68, 0x33, 0x6F, 0xB9, 0x13, 0x9C, 0x6E, 0x57, 0x89, 0xE9, 0xEC, 0x48,
-    0xEE, 0x98, 0xB7, 0xAF, 0x4A, 0xF4, 0xFF, 0x77, 0xCC, 0x67, 0xFB, 0xAA, 0xBB, 0x4D, 0xE8, 0xAB,
-    0x06, 0xD5, 0xB4, 0x5B, 0xB6, 0xAF, 0xB4, 0x2C, 0x8A, 0x5B, 0x9E, 0x98, 0x58, 0xBA, 0x7F, 0x9E,
-    0xBE, 0xE0, 0xD8, 0x75, 0x74, 0x7D, 0x1E, 0xBD, 0x5B, 0x2D, 0xB6, 0x8D, 0xA3, 0x4A, 0x6E, 0x35,
-    0x0F, 0xF7, 0x29, 0xD8, 0xC0, 0x69, 0x92, 0x5B, 0xF3, 0x08, 0x87, 0xE7, 0x54, 0xC9, 0x4E, 0x93,
-    0x5C, 0xE3, 0x51, 0x3F, 0xEC, 0x36, 0xB3, 0x9D, 0x26, 0x4A, 0x89, 0x45, 0x74, 0xBA, 0x99, 0x5D,
-    0x6F, 0x98, 0xEC, 0x5B, 0x5B, 0xC9, 0xAB, 0xCD, 0x6C, 0xBB, 0x1E, 0xF0, 0x1B, 0xED, 0x95, 0x4B,
-    0x7B, 0xDF, 0x59, 0x8F, 0x7D, 0x7E, 0xFA, 0x7E, 0xBF, 0x1F, 0xBF, 0xF9, 0xA2, 0xDC, 0x96, 0x07,
-    0x74, 0xF1, 0xD2, 0xFD, 0x7D, 0xF1, 0x8D, 0xD4, 0x35, 0x55, 0xFB, 0x4A, 0x66, 0x05, 0x4E, 0x15,
-    0x21, 0xE3, 0xC0, 0x8C, 0xFA, 0xEF, 0xC7, 0x3E, 0x33, 0x81, 0x28, 0x73, 0xE7, 0xA2, 0xCA, 0x10,
-    0x59, 0x56, 0x73, 0x1F, 0xDC, 0xD6, 0x21, 0x91, 0xF7, 0x96, 0x9D, 0xBF, 0x8C, 0xFC, 0xED, 0xF3,
-    0x12, 0x02, 0xDE, 0x8F, 0x6C, 0x49, 0x61, 0x5F, 0x91, 0xEF, 0xED, 0x14, 0xFE, 0x0D, 0x65, 0x95,
-    0x31, 0x8C, 0xD4, 0x46, 0x14, 0x86, 0xFF, 0xF1, 0xC0, 0x59, 0x62, 0x8A, 0x49, 0x41, 0xA4, 0x00,
-    0x12, 0x6E, 0xD1, 0x4A, 0xB7, 0x6E, 0x29, 0xD6, 0x6B, 0x13, 0x0A, 0x0A, 0x8A, 0x10, 0x29, 0xA7,
-    0x14, 0x14, 0x50, 0x50, 0x24, 0x14, 0xB9, 0xF6, 0x0A, 0xDF, 0x9D, 0x93, 0x14, 0x94, 0x39, 0xA4,
-    0x74, 0x34, 0x27, 0xE5, 0x0A, 0x30, 0x45, 0x52, 0x50, 0x6C, 0xB1, 0x77, 0x3B, 0x77, 0x28, 0x4A,
-    0x19, 0xA3, 0x84, 0x2A, 0x45, 0x5C, 0x84, 0x14, 0x34, 0x99, 0x23, 0x0E, 0xEC, 0x11, 0xEF, 0x4E,
-    0xFE, 0xF1, 0x1E, 0x09, 0x52, 0x56, 0xD6, 0xEE, 0xF8, 0xD9, 0x33, 0xEF, 0xBD, 0xFF, 0x7D, 0xEF,
-    0x2D, 0x00, 0xA8, 0x19, 0xB4, 0xAB, 0xF4, 0x93, 0x56, 0x55, 0xB1, 0xB4, 0xE1, 0x7E, 0x23, 0xEC,
-    0x18, 0xF9, 0x10, 0xB1, 0x2E, 0xD4, 0xE3, 0x4A, 0xDA, 0x06, 0xD3, 0x04, 0xB9, 0x2E, 0x52, 0x69,
-    0xE3, 0x6C, 0x32, 0x29, 0xB4, 0x2B, 0x70, 0x9B, 0xFB, 0xB2, 0x28, 0xA8, 0xF9, 0x73, 0x31, 0x2C,
-    0x1E, 0x69, 0xD8, 0xF3, 0x41, 0x9D, 0x48, 0x93, 0xAB, 0xA2, 0xA1, 0x0D, 0x3A, 0x83, 0xAE, 0xA0,
-    0x2D, 0x54, 0x0B, 0xF5, 0x07, 0xC2, 0x1F, 0x0B, 0xF9, 0x53, 0x25, 0x9F, 0x58, 0x59, 0x8F, 0x03,
-    0x3B, 0x0C, 0x8E, 0x6E, 0xFC, 0xEC, 0xDC, 0x3C, 0x75, 0x2E, 0xC3, 0x18, 0x18, 0x76, 0xEF, 0x8B,
-    0x0C, 0x28, 0x4B, 0xA4, 0xCE, 0x44, 0xE5, 0xB6, 0x32, 0x90, 0x15, 0x60, 0x81, 0x8D, 0x1D, 0x6F,
-    0x5A, 0xBA, 0x37, 0x05, 0x52, 0xC6, 0x6A, 0x10, 0xD0, 0xD8, 0x9E, 0xC6, 0x6E, 0xF8, 0x7C, 0x2E,
-    0xDC, 0x1C, 0x4B, 0x3B, 0x74, 0x17, 0xB8, 0x4C, 0x39, 0xA3, 0x9F, 0x5D, 0xD3, 0x06, 0x21, 0xB7,
-    0xD6, 0x10, 0x87, 0x33, 0xEC, 0xB9, 0x3A, 0x7D, 0xD2, 0x6A, 0x13, 0x5D, 0xAE, 0x65, 0xD5, 0xA0,
-    0x19, 0x62, 0xAC, 0xCD, 0x50, 0xCC, 0x27, 0x88, 0x1D, 0xC4, 0x03, 0xE0, 0x54, 0x59, 0x4A, 0xE7,
-    0x4C, 0xF9, 0xB0, 0x86, 0xB4, 0x10, 0x8C, 0x9C, 0x5E, 0x18, 0xD0, 0x46, 0xE7, 0x2B, 0x66, 0x0E,
-    0x05, 0xFC, 0x89, 0xDD, 0xE3, 0x60, 0xF1, 0xF8, 0xB4, 0x4F, 0x2F, 0x6E, 0xB0, 0xE9, 0xB2, 0x34,
-    0xB4, 0x11, 0x72, 0x65, 0x22, 0x61, 0xA9, 0xCE, 0x0D, 0x23, 0x5D, 0x26, 0x9D, 0x09, 0xFF, 0x6A,
-    0x65, 0xAD, 0xBF, 0xB0, 0x92, 0x2A, 0xB6, 0x31, 0x86, 0xE1, 0xD1, 0x84, 0x2F, 0x77, 0xFE, 0x10,
-    0xD7, 0x7E, 0x99, 0x5E, 0xAF, 0x53, 0xB4, 0x3A, 0x8B, 0x42, 0x13, 0xEE, 0xDB, 0xC0, 0xAE, 0x8B,
-    0x56, 0xFF, 0xCE, 0x64, 0x7E, 0xCD, 0x4E, 0xDD, 0xE9, 0x82, 0x67, 0x8A, 0xC1, 0x74, 0xE9, 0xE1,
-    0x54, 0xB8, 0x06, 0xBD, 0x2D, 0x78, 0x1D, 0xA4, 0x81, 0x06, 0x06, 0x28, 0x5F, 0x7F, 0xE3, 0xDC,
-    0xF7, 0x37, 0x56, 0xB8, 0x5C, 0x58, 0x4F, 0x7A, 0xD5, 0xBC, 0x6D, 0x65, 0x65, 0xB1, 0x30, 0x3E,
-    0xC0, 0xFF, 0x6C, 0x38, 0xC5, 0x2C, 0x94, 0x09, 0x8D, 0xAC, 0x79, 0xEC, 0x94, 0xE9, 0xA5, 0x54,
-    0x3B, 0xAC, 0x84, 0xE5, 0x32, 0xA6, 0xA0, 0x5C, 0xE4, 0xB4, 0xB0, 0x96, 0xB9, 0x3F, 0x0C, 0xB7,
-    0xE8, 0x88, 0xDA, 0x8F, 0x11, 0x51, 0xCA, 0xEE, 0xA1, 0x5F, 0x70, 0x6F, 0xCB, 0x42, 0x45, 0xD4,
-    0x23, 0xAC, 0xFC, 0x51, 0x54, 0xAB, 0xC1, 0x47, 0x9D, 0x2F, 0x7C, 0x37, 0x29, 0x12, 0xD7, 0xE8,
-    0x3A, 0x0E, 0x6B, 0x75, 0x60, 0x83, 0x7A, 0x8A, 0x66, 0x80, 0x41, 0x84, 0x48, 0x15, 0xEA, 0xCB,
-    0x4E, 0x7B, 0x3B, 0xE0, 0x39, 0xC7, 0x9F, 0xCD, 0x5A, 0xB8, 0x36, 0x6C, 0x76, 0x59, 0x8B, 0x28,
-    0x4B, 0x63, 0xC4, 0x43, 0xA4, 0x09, 0x86, 0xB9, 0xBF, 0x12, 0x92, 0x47, 0xD9, 0x72, 0xD1, 0x0C,
-    0xA5, 0x4D, 0xBF, 0xAD, 0xB4, 0xCB, 0x04, 0x0B, 0x7C, 0x56, 0xCC, 0xD5, 0x6C, 0x73, 0x37, 0x1F,
-    0xBF, 0xD3, 0x62, 0x2A, 0x08, 0x68, 0x40, 0x79, 0x65, 0x1D, 0x56, 0xCA, 0x68, 0xA3, 0x8B, 0x93,
-    0xC7, 0x15, 0x29, 0xFA, 0x57, 0xAC, 0xC0, 0x7A, 0x87, 0x93, 0xC7, 0xC0, 0x76, 0x4A, 0x36, 0xFE,
-    0x92, 0x8D, 0xBF, 0x0D, 0xAD, 0x2F, 0x66, 0xE8, 0xDC, 0x81, 0x73, 0x76, 0x65, 0x65, 0x11, 0xFE,
-    0xB9, 0x39, 0x79, 0xB0, 0xE1, 0xDD, 0x59, 0xB7, 0x8F, 0xA9, 0x8B, 0x8E, 0x85, 0x49, 0x8D, 0x94,
-    0xF5, 0x8E, 0x0A, 0x7F, 0x8F, 0x84, 0xAB, 0x4B, 0xD0, 0xFB, 0xAF, 0x57, 0xAB, 0xD4, 0x55, 0xA2,
-    0x24, 0xAC, 0x88, 0xDE, 0x40, 0xAE, 0x09, 0xF9, 0x9C, 0x90, 0x67, 0xE1, 0xE3, 0x63, 0xC8, 0x65,
-    0xED, 0x21, 0xFF, 0xFA, 0x0D, 0xE4, 0xED, 0xDB, 0x90, 0xF7, 0xCA, 0x2C, 0x66, 0xBF, 0x3D, 0xDF,
-    0x66, 0xF5, 0xFC, 0xD1, 0x74, 0x32, 0xDC, 0x41, 0xE4, 0xAA, 0xE0, 0x5E, 0xDB, 0x51, 0xE7, 0xC9,
-    0x27, 0x6C, 0xF9, 0x09, 0xA4, 0xF2, 0xF9, 0x04, 0xCE, 0x61, 0xC9, 0xC3, 0xB3, 0xE4, 0xD8, 0xA7,
-    0x26, 0x22, 0xE4, 0x05, 0x16, 0xFD, 0x11, 0xBC, 0x98, 0xF1, 0x69, 0xD5, 0x41, 0x1E, 0x87, 0x55,
-    0x07, 0x53, 0x4E, 0xB2, 0x8A, 0xF5, 0xE0, 0xF5, 0x1E, 0xD2, 0x39, 0xC4, 0x7D, 0xF6, 0x46, 0x59,
-    0xBE, 0xEF, 0x5C, 0x7D, 0xFB, 0xE1, 0xC2, 0x15, 0x5D, 0xAC, 0x2F, 0xF0, 0xEE, 0x72, 0xF3, 0x78,
-    0x57, 0xC7, 0x4A, 0x89, 0xC5, 0xE3, 0x5D, 0xE0, 0x5D, 0xAF, 0xCB, 0x6A, 0x1D, 0xB0, 0x4E, 0xF5,
-    0x86, 0x32, 0x31, 0x8F, 0x57, 0x26, 0x91, 0x2F, 0xA6, 0x70, 0x55, 0xE8, 0x4C, 0x7C, 0x87, 0xCC,
-    0x36, 0x2C, 0xC5, 0x14, 0xD3, 0x56, 0x34, 0x9B, 0xD7, 0x6D, 0xEC, 0x8A, 0x80, 0xBE, 0x56, 0xB7,
-    0x02, 0x37, 0x55, 0xCF, 0x18, 0xC1, 0x30, 0xC2, 0x30, 0x3E, 0xBE, 0xF6, 0xA2, 0x5F, 0x66, 0xCA,
-    0x8D, 0xC5, 0xCE, 0xD8, 0xE7, 0x45, 0x5F, 0xDA, 0x94, 0x2E, 0x73, 0x53, 0xDC, 0xA6, 0x1A, 0x17,
-    0xFF, 0xA5, 0xBB, 0xB7, 0x77, 0xDF, 0xB9, 0xC3, 0x8F, 0x9F, 0x2E, 0x40, 0xA7, 0x95, 0x62, 0xF5,
-    0x4A, 0x6F, 0x5B, 0x59, 0xC9, 0xBA, 0x85, 0xED, 0xEA, 0xD5, 0x2B, 0x77, 0x16, 0x36, 0x9C, 0xA5,
-    0xA4, 0xBA, 0x58, 0x10, 0x29, 0x3C, 0xA0, 0x09, 0x01, 0x55, 0x46, 0x7A, 0xCE, 0x87, 0xC4, 0x9E,
-    0xAD, 0xE4, 0x31, 0xA6, 0x52, 0xA3, 0x0E, 0xED, 0xF7, 0xBC, 0x6E, 0x96, 0x6F, 0xE9, 0x22, 0x78,
-    0x83, 0x7F, 0xD7, 0x14, 0x49, 0x07, 0xB6, 0xAC, 0x78, 0xD3, 0x74, 0x3D, 0x92, 0x77, 0x7D, 0xDE,
-    0x13, 0x98, 0xBC, 0x34, 0xBB, 0xCA, 0x8B, 0x4A, 0x42, 0xF9, 0xCE, 0xD5, 0x42, 0x1E, 0xD0, 0x15,
-    0x5F, 0xEA, 0x63, 0x57, 0x19, 0x16, 0xE7, 0x4F, 0xA3, 0x2A, 0xB6, 0x68, 0xCF, 0x0F, 0xA0, 0xB1,
-    0xBE, 0x62, 0x96, 0x13, 0x1C, 0x1E, 0xAE, 0x5E, 0x75, 0x75, 0xFF, 0x1A, 0xCF, 0x62, 0x57, 0x85,
-    0xD5, 0x09, 0xE5, 0xEC, 0xD2, 0x11, 0x29, 0xCE, 0x02, 0x67, 0x75, 0x35, 0x8E, 0x91, 0x0C, 0xD0,
-    0xCF, 0xD1, 0x1F, 0x61, 0xB9, 0x41, 0xD2, 0x20, 0x1F, 0xA1, 0x49, 0xA4, 0x8D, 0x28, 0xE2, 0x11,
-    0xB3, 0x16, 0x59, 0x9F, 0x41, 0xD8, 0x3E, 0xD4, 0x55, 0x83, 0x84, 0xA5, 0x61, 0x51, 0x22, 0x40,
-    0xB2, 0x3C, 0xAF, 0x68, 0xE8, 0x33, 0x6B, 0x32, 0xA6, 0x8A, 0x4F, 0x70, 0x01, 0xA2, 0x24, 0xBC,
-    0xC5, 0x16, 0x51, 0x64, 0x3D, 0x73, 0xF2, 0x14, 0xB9, 0xC7, 0x47, 0x1B, 0x8C, 0xC1, 0xAA, 0x3B,
-    0x8C, 0xC7, 0x19, 0xF5, 0x1B, 0x70, 0xB3, 0x13, 0x94, 0x47, 0xA8, 0x62, 0x31, 0x56, 0x3F, 0xC5,
-    0xC0, 0xD5, 0x51, 0x9D, 0xAB, 0x4A, 0x73, 0x36, 0x1A, 0x0B, 0x66, 0xB8, 0xD6, 0x47, 0x9F, 0x72,
-    0x5E, 0x36, 0x72, 0xDF, 0x0A, 0x3B, 0xC2, 0xE8, 0x0C, 0xF5, 0xFA, 0xFF, 0x56, 0x91, 0x0D, 0xC2,
-    0xEA, 0x3C, 0x3B, 0xEF, 0x8A, 0x91, 0x3F, 0x18, 0x1F, 0xD0, 0xA6, 0x45, 0xFC, 0x19, 0xFC, 0x46,
-    0x33, 0xE2, 0x24, 0xC4, 0x28, 0xA8, 0xCF, 0x30, 0x32, 0xDC, 0x94, 0x26, 0xC2, 0x5A, 0x50, 0x69,
-    0x0C, 0x04, 0xA3, 0x4D, 0x60, 0x43, 0xD3, 0x47, 0xD3, 0x59, 0xC5, 0x16, 0xC4, 0xA5, 0x9D, 0xA5,
-    0x6D, 0xF9, 0xD5, 0x2C, 0x6E, 0xC3, 0x51, 0xFF, 0x51, 0xC2, 0x50, 0x4C, 0x5F, 0x17, 0x11, 0x96,
-    0x35, 0x53, 0xE1, 0xF0, 0x58, 0xC6, 0xA0, 0x4F, 0xDF, 0x79, 0xC2, 0xAF, 0xD1, 0x00, 0x6B, 0x68,
-    0x72, 0x3C, 0x82, 0xE5, 0xAF, 0xB0, 0xB7, 0xB0, 0x2D, 0xB6, 0xC4, 0xE7, 0x0F, 0xF0, 0x92, 0xF4,
-    0x57, 0x6D, 0x64, 0x22, 0x06, 0x74, 0x40, 0x51, 0x9A, 0xB7, 0x27, 0x4F, 0x25, 0x2B, 0x66, 0x76,
-    0xC1, 0xC7, 0x72, 0xAD, 0x07, 0x15, 0xB7, 0xF8, 0xFB, 0x72, 0xAD, 0xFD, 0xB8, 0xF6, 0xE2, 0x46,
-    0x92, 0x33, 0x90, 0x75, 0xE0, 0x64, 0x34, 0x63, 0x8C, 0x38, 0xBD, 0xF0, 0x8A, 0xFF, 0x21, 0xAA,
-    0x12, 0xFC, 0x57, 0x5B, 0x86, 0x67, 0xD2, 0xA7, 0x1E, 0x16, 0x7E, 0x9A, 0x66, 0x9B, 0x4E, 0x67,
-    0x1F, 0xD6, 0x5E, 0x88, 0x99, 0xAF, 0x07, 0xC7, 0x09, 0x05, 0x59, 0x2B, 0xF4, 0x07, 0xCE, 0xAE,
-    0x52, 0x61, 0x08, 0x9E, 0x12, 0x3D, 0x9D, 0xCC, 0x35, 0xE9, 0x3D, 0x8F, 0x3E, 0x7C, 0xD4, 0x39,
-    0xB1, 0x1B, 0x71, 0xDC, 0x9D, 0xDB, 0xFA, 0x07, 0x75, 0x58, 0x3D, 0x8C, 0xDD, 0x58, 0x15, 0x3E,
-    0xB6, 0x37, 0x63, 0x69, 0x2D, 0x30, 0xC5, 0xAE, 0x10, 0x44, 0xC2, 0x94, 0x28, 0x82, 0x98, 0x92,
-    0x62, 0x66, 0xAE, 0x93, 0x14, 0x94, 0x4C, 0x91, 0xC9, 0x16, 0x29, 0x42, 0x41, 0x81, 0x58, 0xA4,
-    0x69, 0x29, 0x26, 0x63, 0xB3, 0x5B, 0x6C, 0x3B, 0xCD, 0x2E, 0x25, 0x5B, 0x50, 0xB0, 0x6F, 0x25,
-    0x86, 0x06, 0x29, 0x12, 0x93, 0xB1, 0xC3, 0x16, 0x14, 0x5B, 0xAC, 0xD1, 0x92, 0xA5, 0xA0, 0x58,
-    0x0B, 0xB2, 0x5A, 0x48, 0x41, 0x8C, 0xE2, 0x80, 0x67, 0x62, 0xFB, 0xF2, 0x7D, 0xE7, 0xDA, 0x6F,
-    0x26, 0x2B, 0xF1, 0x32, 0xB9, 0xCF, 0xCF, 0xBE, 0xF7, 0xDC, 0xF3, 0xF3, 0x9D, 0xEF, 0x9C, 0x6B,
-    0x11, 0x7E, 0x36, 0x6C, 0x23, 0x62, 0x6C, 0x2F, 0x62, 0xDF, 0x69, 0x25, 0x18, 0x70, 0x2B, 0x6C,
-    0x31, 0xC4, 0xB8, 0x2D, 0x49, 0x85, 0x21, 0x2D, 0x30, 0x98, 0xEC, 0xEB, 0xAB, 0x5F, 0x1B, 0x49,
-    0xED, 0x60, 0x38, 0x3B, 0x17, 0x23, 0x92, 0xE3, 0x1F, 0xBE, 0x0F, 0x30, 0x14, 0xF7, 0x31, 0xAF,
-    0xC1, 0xE2, 0xD8, 0x5A, 0x5B, 0xF9, 0x1C, 0xE4, 0xAB, 0xD3, 0x2A, 0x93, 0xA0, 0xC3, 0xE2, 0xA0,
-    0x5D, 0x86, 0x90, 0x52, 0xA3, 0x9A, 0xF2, 0x1F, 0xBF, 0xC7, 0xD9, 0x13, 0x87, 0x91, 0x8A, 0xDC,
-    0xBC, 0x84, 0x61, 0x2B, 0xC6, 0x66, 0x49, 0x80, 0x6D, 0xE3, 0x4F, 0x30, 0x3F, 0xE5, 0xA3, 0x12,
-    0xC2, 0x3C, 0x7B, 0x9A, 0x37, 0x9E, 0x3D, 0x8E, 0x77, 0x3C, 0xBB, 0x1D, 0x55, 0x62, 0xE3, 0xA0,
-    0x96, 0x32, 0x7A, 0xD0, 0x8A, 0xB9, 0x51, 0xF7, 0x92, 0x3E, 0x68, 0x37, 0x25, 0xAE, 0xFB, 0x14,
-    0xBA, 0x6F, 0xC6, 0x99, 0x3F, 0xA4, 0x61, 0x25, 0x27, 0xF1, 0x8D, 0x46, 0xCC, 0x5B, 0x55, 0x2B,
-    0xF1, 0xDF, 0x9B, 0x63, 0x09, 0xFA, 0x76, 0x4B, 0xE4, 0xE4, 0x38, 0x81, 0xD8, 0x11, 0xDB, 0x84,
-    0x96, 0xDB, 0xD8, 0x37, 0xB0, 0x4D, 0xD2, 0x75, 0x5F, 0x13, 0x2A, 0x9D, 0x09, 0x86, 0x5A, 0xF6,
-    0xF7, 0xCE, 0x32, 0xE1, 0x36, 0xC2, 0x6D, 0x84, 0xDB, 0xBC, 0xF8, 0x49, 0xEC, 0x23, 0xF1, 0x2C,
-    0x94, 0x8F, 0x2C, 0x34, 0x34, 0x9D, 0xFC, 0x54, 0x4A, 0x28, 0xEE, 0x4D, 0xB4, 0xB3, 0xA7, 0x89,
-    0x5F, 0x74, 0xE1, 0x2B, 0x1B, 0xEF, 0x9A, 0x6C, 0xCB, 0xB4, 0x46, 0xB6, 0x6C, 0x03, 0xC7, 0x75,
-    0x52, 0x4A, 0x09, 0x1D, 0xC5, 0x42, 0x27, 0x99, 0x38, 0xC0, 0x7B, 0x27, 0x1E, 0x86, 0xD2, 0x87,
-    0x84, 0x9C, 0x8E, 0x33, 0x6F, 0xD2, 0x07, 0x1F, 0x60, 0x88, 0x9F, 0x37, 0x2F, 0x61, 0xB3, 0xE7,
-    0x03, 0xD5, 0xC4, 0x9C, 0x1C, 0x0A, 0x88, 0x77, 0x93, 0xBA, 0xE4, 0x16, 0x11, 0x8C, 0xA8, 0x8C,
-    0x53, 0x3E, 0xE6, 0x86, 0x94, 0x33, 0x47, 0x4E, 0x23, 0xC0, 0x70, 0xCD, 0x21, 0x60, 0xD0, 0xA0,
-    0x20, 0x75, 0x13, 0x75, 0x7C, 0xFC, 0x70, 0x77, 0x87, 0xD6, 0xC0, 0xFA, 0xC4, 0xDA, 0x56, 0xFC,
-    0x69, 0xB5, 0x62, 0xC0, 0x5F, 0x5C, 0x70, 0xFB, 0xD9, 0x0E, 0x71, 0x62, 0x0B, 0x09, 0xAC, 0xED,
-    0x96, 0x1D, 0xD4, 0x3A, 0xEA, 0xFB, 0xC2, 0x82, 0xE5, 0xE3, 0x95, 0xDC, 0x20, 0xA5, 0x64, 0xDF,
-    0xBE, 0x8F, 0x05, 0x49, 0x23, 0xEF, 0x0A, 0xAD, 0x9D, 0x41, 0x26, 0x29, 0xD7, 0xC3, 0xF6, 0xB5,
-    0x9E, 0xAA, 0xFD, 0xAB, 0x25, 0x34, 0x72, 0xD6, 0x84, 0x18, 0xA9, 0x02, 0x85, 0xCB, 0xB0, 0x5E,
-    0x18, 0xD3, 0xEF, 0x34, 0xBD, 0x15, 0xEF, 0xFD, 0xB3, 0x55, 0x31, 0x6B, 0x32, 0x4B, 0x6A, 0xD7,
-    0xFA, 0x84, 0x2A, 0x14, 0x32, 0x6C, 0x13, 0x70, 0xCC, 0x60, 0xA1, 0x1D, 0x9C, 0x76, 0x84, 0x1A,
-    0xB5, 0x9F, 0x55, 0xDE, 0x9A, 0xEF, 0xAA, 0x9C, 0x9B, 0xDE, 0xB3, 0x9B, 0xB8, 0xB4, 0x9D, 0xC1,
-    0x0E, 0x43, 0x6E, 0x3F, 0x04, 0x06, 0xE3, 0x5F, 0xBE, 0x63, 0xED, 0x2F, 0x46, 0xCF, 0xD6, 0x11,
-    0x7E, 0x34, 0x69, 0x2B, 0x79, 0x2B, 0x27, 0xC1, 0x28, 0xE1, 0x00, 0x77, 0x9A, 0x8A, 0x4A, 0x4E,
-    0xD8, 0x10, 0xB1, 0x8F, 0xEB, 0x52, 0xCD, 0x1C, 0xE0, 0x66, 0x53, 0x43, 0x37, 0x9D, 0xE4, 0xF7,
-    0x10, 0x8E, 0xC4, 0x30, 0x3F, 0x1F, 0xC4, 0xF4, 0x30, 0x38, 0x2D, 0x42, 0xB8, 0xC6, 0x00, 0x31,
-    0xCF, 0x5B, 0xD8, 0x65, 0xB2, 0x14, 0xAE, 0x3E, 0x09, 0xDA, 0xF0, 0xAF, 0x14, 0x91, 0x4B, 0xEF,
-    0x44, 0xA4, 0xB1, 0x8A, 0x08, 0x6B, 0x88, 0x80, 0xEE, 0xBD, 0x53, 0x34, 0x75, 0x5F, 0x04, 0xE8,
-    0xDA, 0x37, 0xE7, 0x1F, 0xC8, 0x84, 0x7D, 0x79, 0x85, 0xD9, 0xD1, 0x20, 0x49, 0x81, 0x7D, 0xFD,
-    0x4E, 0xE2, 0x91, 0x40, 0x78, 0x5E, 0xC3, 0x43, 0xC9, 0x81, 0x6C, 0x8B, 0xFF, 0xB4, 0x09, 0x6B,
-    0x31, 0x46, 0xEE, 0xCB, 0xEB, 0xCF, 0xCF, 0x8E, 0xFE, 0x19, 0xAB, 0xA7, 0x38, 0x8C, 0x72, 0x9C,
-    0x5C, 0xC7, 0x82, 0xAA, 0xC3, 0x3E, 0x43, 0xFC, 0x66, 0xAB, 0xEE, 0x83, 0x3B, 0xF0, 0xB9, 0x96,
-    0xEF, 0x8E, 0x27, 0x3B, 0x41, 0x1B, 0x7D, 0x58, 0x41, 0xC6, 0xDD, 0x01, 0x59, 0x1D, 0x7E, 0x5A,
-    0x40, 0x86, 0xE1, 0x82, 0x00, 0x26, 0xC1, 0x3E, 0x58, 0x50, 0x04, 0x56, 0xBC, 0x0E, 0xBC, 0x20,
-    0x69, 0xE6, 0x13, 0x09, 0xC9, 0x19, 0x63, 0xE2, 0x13, 0x44, 0x8A, 0x25, 0x8D, 0x7A, 0xD2, 0x2B,
-    0x3C, 0xE1, 0x3F, 0x86, 0x76, 0xD4, 0x20, 0x32, 0x73, 0x60, 0xF4, 0xE4, 0x51, 0x54, 0x5C, 0xEF,
-    0x33, 0xBA, 0xC8, 0x59, 0x60, 0x2E, 0x7D, 0x80, 0x6C, 0x2F, 0xC2, 0xBE, 0x7C, 0x3B, 0xE8, 0x3C,
-    0x5B, 0xDA, 0xD6, 0xDC, 0xB2, 0x9F, 0xDA, 0x09, 0x30, 0x69, 0xC1, 0x2D, 0x25, 0x90, 0x79, 0x1F,
-    0xD4, 0xB2, 0xC3, 0xD5, 0xA3, 0x7A, 0x85, 0xF1, 0x4C, 0x2A, 0xA2, 0xD5, 0xEF, 0x35, 0x21, 0xD2,
-    0x8C, 0x48, 0x83, 0x07, 0x8C, 0xEE, 0x4B, 0xB0, 0xE0, 0x3F, 0x31, 0x6E, 0xDE, 0x66, 0x56, 0x04,
-    0xB6, 0x51, 0x5D, 0x15, 0xA5, 0xF2, 0x2A, 0xB4, 0xB2, 0xBF, 0x72, 0x0E, 0x9F, 0x81, 0x33, 0x03,
-    0x28, 0xE8, 0x2E, 0xF7, 0x2E, 0x05, 0xA2, 0x39, 0x4B, 0xE2, 0x39, 0x19, 0x4C, 0xF6, 0x6A, 0xA6,
-    0x0A, 0x44, 0x50, 0x87, 0x3B, 0x40, 0x4D, 0x28, 0x90, 0xFC, 0xF1, 0xF4, 0x4E, 0x86, 0x1D, 0x26,
-    0x53, 0x90, 0x31, 0xA3, 0x96, 0xDB, 0x00, 0x4E, 0x4C, 0x72, 0x78, 0xB7, 0xA7, 0xD1, 0x80, 0x67,
-    0x96, 0xD6, 0xE4, 0xBC, 0x96, 0xC0, 0x09, 0x3A, 0xC8, 0xCC, 0x1B, 0x48, 0x06, 0x9A, 0x0D, 0xB0,
-    0x44, 0x80, 0x9B, 0xDA, 0x1B, 0x68, 0x8F, 0xA9, 0xA2, 0x86, 0xC9, 0x00, 0x2E, 0xCE, 0xB8, 0xF5,
-    0x40, 0xB7, 0x67, 0x70, 0x22, 0x6E, 0x4E, 0xDF, 0xC4, 0x0E, 0x69, 0xE5, 0x0F, 0xE3, 0xED, 0x01,
-    0x6B, 0xC2, 0xA7, 0xC8, 0x25, 0x98, 0x9D, 0xFC, 0xC1, 0x71, 0xAD, 0xDA, 0x25, 0xC7, 0xC0, 0x85,
-    0xDF, 0xC2, 0x78, 0x8B, 0x0D, 0x10, 0xB8, 0x01, 0x54, 0x0E, 0x8A, 0x6F, 0x90, 0x11, 0xBD, 0xD8,
-    0x02, 0x77, 0x9A, 0xF0, 0x5F, 0xB8, 0x97, 0x14, 0x57, 0xEF, 0xE1, 0xDE, 0x81, 0xFC, 0xA7, 0x89,
-    0x2B, 0xAF, 0x0B, 0x3F, 0x2A, 0xEE, 0x4A, 0x58, 0x6F, 0x6F, 0x11, 0x45, 0xD7, 0xDA, 0x0E, 0x38,
-    0xBB, 0x1F, 0x7D, 0x50, 0xDF, 0x65, 0xA2, 0x33, 0x5B, 0x75, 0x1C, 0xFC, 0xF2, 0xE8, 0xF1, 0xD9,
-    0x74, 0x28, 0xC3, 0x56, 0x00, 0x02, 0x0B, 0xFE, 0xDD, 0x26, 0x31, 0x9C, 0xF2, 0x51, 0xB1, 0xBF,
-    0x0F, 0xCD, 0xB7, 0xBC, 0xA7, 0x50, 0xFC, 0xB4, 0x0D, 0x3F, 0x42, 0x85, 0x78, 0x52, 0x24, 0xB8,
-    0x17, 0x1F, 0xD3, 0x50, 0xE0, 0xC6, 0x07, 0x7E, 0xC4, 0x66, 0x40, 0x2D, 0xAB, 0x51, 0xDA, 0x28,
-    0x8F, 0x96, 0x9A, 0xD0, 0xBE, 0xE3, 0x1C, 0x3B, 0xC1, 0xCA, 0xDA, 0xF1, 0xF5, 0xC0, 0x5D, 0x47,
-    0xC2, 0xAE, 0x45, 0xE2, 0xC1, 0x2D, 0x86, 0x11, 0x4E, 0x0A, 0x80, 0xC1, 0xEB, 0x7D, 0xA2, 0x01,
-    0x38, 0x34, 0x74, 0xA0, 0xF4, 0x98, 0x32, 0x04, 0x6D, 0x52, 0x1C, 0xE0, 0xE7, 0x81, 0xDF, 0x45,
-    0x8D, 0xD7, 0x47, 0xB5, 0xC9, 0xEE, 0x63, 0x01, 0xEE, 0x53, 0x04, 0xA7, 0x41, 0x84, 0x37, 0x84,
-    0x0D, 0x45, 0x24, 0xC5, 0x7D, 0x88, 0x38, 0xF1, 0x3B, 0xDE, 0xC7, 0x54, 0x2E, 0x57, 0x11, 0x15,
-    0x25, 0x1E, 0x78, 0x7D, 0x48, 0x11, 0x4D, 0xAA, 0x22, 0xB8, 0x53, 0xA5, 0x01, 0x23, 0x04, 0x98,
-    0x8F, 0xB9, 0x70, 0x37, 0x9A, 0x70, 0x00, 0x4E, 0x2D, 0x7B, 0x8A, 0x50, 0x9E, 0x1E, 0x02, 0xFD,
-    0x72, 0x1C, 0xF9, 0xEE, 0x85, 0xF4, 0xCD, 0x65, 0x21, 0x45, 0xC7, 0xC7, 0x5A, 0xFB, 0x10, 0xAC,
-    0xDD, 0x71, 0x67, 0x79, 0x7C, 0x29, 0x23, 0x88, 0xF3, 0x29, 0x56, 0x94, 0x3C, 0x05, 0x94, 0xCB,
-    0xCF, 0x4E, 0xB8, 0x19, 0x12, 0x8F, 0x98, 0x60, 0x21, 0x82, 0x80, 0xA4, 0xA6, 0xDB, 0x42, 0xD2,
-    0x0A, 0xA9, 0x9A, 0x9E, 0x73, 0x94, 0x84, 0xD5, 0x46, 0xD1, 0x89, 0x3F, 0x3C, 0x0B, 0x5C, 0xCD,
-    0x1F, 0xB4, 0x76, 0xC1, 0x77, 0x48, 0x4D, 0x3C, 0x28, 0x6B, 0xDE, 0x7D, 0x4E, 0x70, 0x7D, 0x32,
-    0x68, 0x55, 0xEF, 0xB7, 0xB1, 0x77, 0xD9, 0x25, 0xD0, 0xC9, 0xCB, 0xBE, 0x50, 0x0D, 0xE5, 0xCA,
-    0x6A, 0xF5, 0x9E, 0xF2, 0x3C, 0x54, 0x8E, 0xB4, 0xF6, 0xAF, 0x3F, 0x21, 0xDB, 0x8B, 0x90, 0x4C,
-    0xEE, 0x0A, 0x57, 0x59, 0x87, 0xEA, 0x91, 0xB9, 0x4E, 0xB2, 0xFC, 0xCD, 0xDC, 0xED, 0x7E, 0x93,
-    0xE8, 0x69, 0x7B, 0xE3, 0xE2, 0xEA, 0xDD, 0xF9, 0x6C, 0x37, 0xBB, 0x58, 0x6B, 0x5E, 0x9F, 0x56,
-    0x87, 0xAE, 0xEA, 0xCE, 0xBE, 0x61, 0x32, 0xCD, 0x15, 0x28, 0x3D, 0xAF, 0x7C, 0x5A, 0x7A, 0xE9,
-    0x0A, 0xE0, 0xCB, 0xAE, 0x7A, 0x2D, 0x18, 0xCC, 0x7D, 0x6A, 0x03, 0x17, 0xBA, 0x26, 0x04, 0xAB,
-    0xE8, 0x87, 0x96, 0x92, 0xE1, 0x38, 0x8C, 0x96, 0xFE, 0xA1, 0x3F, 0x4C, 0xC6, 0xA4, 0x46, 0x32,
-    0xD4, 0xF4, 0x7A, 0xC9, 0x48, 0x28, 0x83, 0x4D, 0x11, 0x0B, 0xCA, 0xC8, 0xDB, 0x32, 0xF0, 0x36,
-    0x4A, 0x10, 0x7A, 0xA7, 0x92, 0xDC, 0x28, 0xAF, 0xD9, 0xA3, 0x87, 0x3B, 0x12, 0x8C, 0x0C, 0x0D,
-    0xB0, 0x44, 0xC3, 0x99, 0x8B, 0x28, 0x0E, 0xB4, 0x2D, 0xAE, 0x19, 0x04, 0xC0, 0x63, 0x94, 0x65,
-    0xAB, 0x8A, 0x11, 0x65, 0x40, 0x34, 0x26, 0xF8, 0x69, 0x94, 0xF6, 0x70, 0x13, 0x4A, 0x29, 0xE1,
-    0x56, 0x94, 0x3F, 0xB0, 0x08, 0x42, 0xFD, 0xB9, 0xA8, 0x9F, 0x3B, 0xCB, 0x64, 0x19, 0x77, 0x3A,
-    0xA6, 0xDF, 0x40, 0xF5, 0xF0, 0x0B, 0xF5, 0x52, 0x1B, 0x63, 0xEA, 0x19, 0x69, 0x37, 0x67, 0x2B,
-    0x40, 0xD2, 0xF6, 0x60, 0x8E, 0xC9, 0x20, 0xB0, 0xE1, 0x0D, 0x9D, 0x95, 0x9F, 0xCF, 0x9A, 0x74,
-    0x16, 0x6E, 0xFA, 0x13, 0x17, 0x6C, 0xD3, 0xD1, 0xDE, 0x75, 0xDD, 0xCC, 0x7C, 0xA1, 0x83, 0x58,
-    0x7F, 0x36, 0xAC, 0x3D, 0xD4, 0x0B, 0xB3, 0x40, 0x39, 0x9D, 0x8E, 0x5C, 0xE0, 0xBF, 0x24, 0x2C,
-    0x8C, 0xEE, 0x13, 0x39, 0x5C, 0x6F, 0x1C, 0x7A, 0x6E, 0x12, 0xB1, 0xB5, 0x94, 0x59, 0x2D, 0xD0,
-    0xEA, 0xFB, 0x62, 0x6E, 0x56, 0x5C, 0x37, 0x80, 0xFB, 0xAE, 0x98, 0x1B, 0x39, 0xBF, 0x70, 0x8F,
-    0xF2, 0x0B, 0x1D, 0x43, 0x5A, 0xB0, 0xFF, 0x19, 0xA9, 0x63, 0x02, 0xE7, 0x30, 0x05, 0x32, 0x47,
-    0xB4, 0x52, 0x7A, 0xD3, 0xF7, 0x7B, 0x5E, 0x4C, 0x41, 0xE7, 0x0F, 0x08, 0xB3, 0x3F, 0x84, 0x78,
-    0x00, 0x3B, 0xC2, 0x1E, 0x1A, 0x30, 0x8B, 0x13, 0xE4, 0x3A, 0xD2, 0xBC, 0x45, 0x13, 0x86, 0xAC,
-    0x45, 0x12, 0x5F, 0xB6, 0xCA, 0xE4, 0x31, 0xC3, 0x99, 0x3E, 0xDB, 0x6B, 0x14, 0x30, 0xEC, 0x77,
-    0x62, 0xB6, 0x5A, 0x26, 0x9F, 0x79, 0x33, 0xBF, 0x34, 0xA3, 0xFF, 0x60, 0xF1, 0xC4, 0xC9, 0x72,
-    0x31, 0x2E, 0x17, 0x4B, 0x29, 0xF6, 0x96, 0x0B, 0xBF, 0x5F, 0xAA, 0x72, 0xB7, 0x5C, 0xBC, 0xD0,
-    0x27, 0x85, 0xEA, 0x9C, 0x92, 0xB9, 0x10, 0x9E, 0x52, 0x8C, 0xB9, 0xC6, 0x15, 0x43, 0x40, 0x08,
-    0xD5, 0x09, 0x81, 0x2B, 0x77, 0x49, 0xD8, 0xAE, 0x58, 0xB1, 0x71, 0x89, 0x2A, 0x46, 0x3D, 0xE5,
-    0x0C, 0x39, 0x66, 0x68, 0xFC, 0x67, 0x94, 0x1D, 0x3E, 0xA1, 0x7B, 0x62, 0x17, 0x3B, 0xED, 0x0C,
-    0x28, 0xFA, 0x2B, 0x5C, 0xE7, 0x17, 0xBC, 0x91, 0xF8, 0xCC, 0x83, 0x31, 0x29, 0x19, 0x9B, 0x41,
-    0x3B, 0x49, 0xD2, 0xF3, 0xD3, 0x11, 0xF9, 0x60, 0xA2, 0x26, 0xC9, 0xBC, 0x3E, 0x11, 0x12, 0xE4,
-    0x77, 0x3D, 0x55, 0x5A, 0x1B, 0x76, 0xF6, 0x0F, 0x8B, 0xC9, 0xCE, 0x96, 0x58, 0x65, 0x33, 0x94,
-    0xC1, 0x51, 0xA7, 0xFD, 0x18, 0x67, 0xA4, 0x8F, 0xF4, 0xF2, 0x91, 0xA6, 0x70, 0xAF, 0xD5, 0xAC,
-    0xC1, 0x02, 0x8F, 0xC4, 0x94, 0x01, 0xB2, 0xAF, 0x9D, 0xEE, 0xE6, 0x7F, 0x66, 0x07, 0x66, 0xFF,
-    0x74, 0x74, 0xB6, 0x2A, 0xFF, 0x01, 0xDF, 0xF9, 0xAC, 0xEF, 0x8C, 0xFD, 0x00, 0xE7, 0x28, 0xCE,
-    0xBB, 0x52, 0xAB, 0x88, 0xB2, 0x3D, 0xFC, 0x85, 0x24, 0x33, 0x2B, 0x88, 0x09, 0xB5, 0xEB, 0x2C,
-    0x29, 0x36, 0xFE, 0x6C, 0xED, 0xE5, 0xE4, 0xFF, 0x37, 0xBB, 0xAE, 0xC1, 0x5C, 0x47, 0xC7, 0xC5,
-    0x8D, 0x2C, 0x26, 0x7B, 0xD4, 0x30, 0x21, 0x6E, 0x7D, 0xCD, 0x5B, 0xD3, 0xDF, 0x8B, 0xAA, 0x60,
-    0x62, 0x27, 0x95, 0x36, 0xA8, 0x52, 0xC0, 0x2A, 0x0B, 0x52, 0xCB, 0xCE, 0x30, 0xCF, 0xE0, 0x6D,
-    0x30, 0x02, 0xBA, 0x43, 0x50, 0x6A, 0x4B, 0x9B, 0x71, 0xB4, 0x60, 0x61, 0x52, 0x92, 0x61, 0x4B,
-    0x94, 0x21, 0x53, 0xD1, 0xE0, 0x41, 0x20, 0x9A, 0xBF, 0x7D, 0xBF, 0x4F, 0x6A, 0x1F, 0xC9, 0x8F,
-    0x9A, 0x5C, 0x98, 0x6C, 0x92, 0x2D, 0xE0, 0x6E, 0xF0, 0xC0, 0x03, 0x51, 0x17, 0x55, 0x69, 0x11,
-    0xB7, 0xDB, 0x00, 0x4A, 0xDA, 0x75, 0x50, 0x2F, 0xB5, 0x8F, 0x91, 0x31, 0xA9, 0x76, 0xB8, 0x91,
-    0xE6, 0x53, 0xA0, 0x96, 0xC5, 0xAA, 0xEA, 0xFE, 0x8C, 0x9D, 0xB9, 0x32, 0x28, 0xEC, 0x63, 0xC5,
-    0x98, 0xA7, 0x09, 0x2C, 0x46, 0x6D, 0x0B, 0xFF, 0xEB, 0x3A, 0x79, 0x2D, 0x1D, 0x7A, 0x56, 0x80,
-    0x13, 0xD4, 0x01, 0x25, 0xA3, 0xAE, 0x0D, 0x5B, 0xA5, 0x8E, 0x1D, 0xE4, 0x27, 0x76, 0x55, 0x3E,
-    0x06, 0xC1, 0x37, 0x0C, 0xA2, 0xA7, 0x6D, 0xE1, 0xA5, 0xFC, 0xE1, 0xAD, 0x71, 0xC7, 0x77, 0x95,
-    0x5B, 0x27, 0xB7, 0x4C, 0x31, 0xC4, 0x84, 0x14, 0x33, 0x6A, 0x8C, 0x5D, 0xB1, 0x70, 0xC1, 0x62,
-    0x77, 0xCB, 0xC4, 0xCD, 0x49, 0x51, 0xF0, 0xB1, 0x37, 0xAE, 0xBB, 0xB7, 0x35, 0xB8, 0x41, 0x0E,
-    0xBD, 0x6B, 0x69, 0x74, 0x7F, 0x40, 0xA0, 0xF6, 0x94, 0xE7, 0x5D, 0x37, 0xEE, 0x38, 0xA5, 0x5F,
-    0x5F, 0x86, 0xDD, 0xC6, 0x6A, 0xB5, 0xB2, 0x87, 0xDC, 0x7C, 0xD2, 0x0E, 0xB4, 0xC6, 0xC9, 0x81,
-    0x0D, 0x1B, 0x59, 0xDE, 0xB7, 0xA7, 0xB3, 0x15, 0x37, 0x54, 0xBB, 0xE4, 0x74, 0x77, 0x77, 0xD7,
-    0x1D, 0x21, 0x14, 0x84, 0x17, 0x6A, 0xC3, 0x7C, 0xB7, 0x93, 0x8D, 0x4C, 0xF2, 0x33, 0xE0, 0xD2,
-    0x15, 0x51, 0xDF, 0x51, 0xD5, 0xEE, 0x45, 0x1C, 0xF4, 0xAA, 0xE5, 0xA4, 0xA5, 0x69, 0x14, 0x77,
-    0x5E, 0xB5, 0x7F, 0x6B, 0x7F, 0x8C, 0x26, 0x0B, 0x10, 0x89, 0x3A, 0x60, 0xC1, 0xA1, 0x00, 0x4D,
-    0x56, 0x45, 0xBD, 0xEF, 0xB1, 0x54, 0xC5, 0x5A, 0x38, 0x3B, 0xFA, 0x21, 0xE1, 0x23, 0x00, 0x04,
-    0x76, 0x6C, 0x2B, 0xBA, 0xD9, 0xAC, 0xC9, 0x26, 0x01, 0x13, 0xEA, 0x82, 0x63, 0xDE, 0x25, 0x76,
-    0x7A, 0xE1, 0x49, 0xAE, 0xC2, 0x02, 0x7F, 0x24, 0xA2, 0xE2, 0xF6, 0x2A, 0x83, 0xF3, 0x71, 0xF3,
-    0x0A, 0x5D, 0x84, 0x33, 0x60, 0xA4, 0x85, 0xF1, 0x32, 0xBB, 0x1A, 0x89, 0x95, 0x54, 0xDD, 0x49,
-    0x48, 0x3D, 0x99, 0x79, 0x87, 0xFC, 0xBD, 0x49, 0x0A, 0x80, 0x26, 0xEC, 0x3F, 0x68, 0xA7, 0x29,
-    0x3C, 0xA6, 0xC9, 0xA8, 0x8E, 0x79, 0xB0, 0xF7, 0xF0, 0xF6, 0xB3, 0x9B, 0x70, 0x44, 0xC9, 0x2C,
-    0x00, 0x2A, 0xA1, 0x09, 0x79, 0x91, 0x24, 0x1B, 0x3A, 0x42, 0x64, 0x76, 0xA0, 0x0C, 0x75, 0x0C,
-    0x29, 0xCB, 0x7F, 0xE5, 0xDA, 0x02, 0x2D, 0x3F, 0x68, 0x49, 0xA1, 0xE4, 0xA8, 0xFA, 0xD6, 0xDC,
-    0x61, 0xD2, 0xF0, 0x3E, 0xFB, 0x21, 0x1E, 0xE4, 0x16, 0x0F, 0x3C, 0xAB, 0xA9, 0xB4, 0x73, 0x91,
-    0xB1, 0x18, 0x15, 0xF5, 0xAF, 0x36, 0x64, 0x8C, 0x34, 0x7A, 0xB6, 0x0D, 0x1E, 0x96, 0x1D, 0x0A,
-    0x1C, 0xA7, 0x7B, 0x8E, 0x13, 0x5D, 0xDC, 0x99, 0x40, 0xFA, 0xC8, 0xB5, 0x07, 0xA5, 0x3B, 0x7E,
-    0x39, 0x2C, 0x7B, 0x5A, 0xB4, 0xF0, 0xCB, 0xCD, 0xCC, 0xDD, 0x57, 0x3A, 0xAF, 0x73, 0x64, 0x99,
-    0xD6, 0xFE, 0xE1, 0xB7, 0x36, 0x90, 0x54, 0xE6, 0x2F, 0x43, 0x59, 0x8D, 0xDE, 0xE7, 0xDD, 0xEF,
-    0x63, 0x70, 0xC6, 0x9D, 0x6B, 0xED, 0x77, 0x92, 0xEA, 0xCB, 0x3F, 0x8B, 0x8A, 0xDF, 0x02, 0xC1,
-    0xF5, 0x66, 0xF0, 0x21, 0x5B, 0x67, 0x10, 0x79, 0xA6, 0xB0, 0x81, 0x9D, 0x9F, 0x5B, 0x6A, 0x1B,
-    0x66, 0xBF, 0xBB, 0x03, 0x29, 0xDF, 0x0E, 0x2A, 0x38, 0x53, 0xDA, 0x58, 0xF4, 0x55, 0x04, 0xF3,
-    0x82, 0x98, 0x1B, 0x2E, 0x1C, 0x0C, 0xD7, 0x1F, 0x5D, 0xCF, 0x0A, 0xDC, 0x96, 0xDA, 0x92, 0x9C,
-    0xBF, 0xCC, 0x50, 0x72, 0x39, 0x3F, 0xE4, 0x2B, 0x12, 0xB5, 0xFD, 0x77, 0xC7, 0xFD, 0x6A, 0xF1,
-    0x80, 0xD6, 0xB8, 0x7C, 0xDD, 0xDA, 0x9D, 0xAC, 0xEB, 0xC4, 0xB8, 0x40, 0x57, 0xF3, 0x9B, 0x00,
-    0xEC, 0xA9, 0x46, 0x7D, 0xC5, 0x9E, 0xAD, 0x66, 0x17, 0xA9, 0x00, 0x2C, 0xDB, 0xBD, 0x35, 0xDD,
-    0x0C, 0x14, 0xFA, 0xAE, 0xB5, 0x2A, 0x17, 0x9E, 0xE3, 0xAC, 0xCB, 0x03, 0xA3, 0x80, 0x38, 0x93,
-    0xD3, 0x54, 0x8D, 0x65, 0xD9, 0x85, 0x3D, 0x74, 0xB6, 0xD3, 0xB6, 0x5E, 0xD4, 0xD3, 0x13, 0xB5,
-    0x5D, 0xC7, 0xC8, 0xD1, 0xFA, 0xB4, 0x3E, 0x38, 0xE3, 0xC8, 0x54, 0xC0, 0xCA, 0xCB, 0x2D, 0x50,
-    0x5B, 0x76, 0x3C, 0xF4, 0x1C, 0x62, 0x23, 0x6D, 0xA4, 0x78, 0x50, 0xB3, 0xED, 0x46, 0xE3, 0xDD,
-    0xE8, 0xF7, 0xF4, 0xC9, 0x23, 0xF6, 0xA3, 0xEB, 0x56, 0x0F, 0x83, 0xFF, 0x71, 0x4F, 0x7E, 0x1E,
-    0xE7, 0x57, 0x44, 0x69, 0x91, 0x90, 0x51, 0x00, 0xA7, 0xA8, 0x85, 0x2A, 0xF8, 0x1B, 0xC8, 0xA0,
-    0x39, 0xCF, 0xC4, 0x69, 0x95, 0x8C, 0x2E, 0x03, 0x1C, 0x5F, 0x68, 0xAE, 0x7A, 0xE7, 0x50, 0x0B,
-    0x47, 0x77, 0xF4, 0xA2, 0x4E, 0x5B, 0xEA, 0xDC, 0x7B, 0x7C, 0x2F, 0x23, 0x9D, 0x8E, 0xBD, 0x8E,
-    0xA3, 0x7A, 0x9E, 0x71, 0x9A, 0x1C, 0x53, 0xD4, 0xE1, 0x4C, 0x64, 0x10, 0xD5, 0x6B, 0x35, 0xD8,
-    0x57, 0xE6, 0xDF, 0x94, 0xBB, 0x2F, 0x71, 0xDC, 0xFF, 0x46, 0x98, 0x6D, 0xCA, 0x71, 0x99, 0x54,
-    0xFB, 0x3C, 0xAD, 0x34, 0x38, 0xED, 0xBC, 0xD5, 0x62, 0xFE, 0x18, 0x54, 0x79, 0x4D, 0x4F, 0x5C,
-    0x92, 0x58, 0xFD, 0x71, 0xA0, 0x88, 0xF8, 0xDE, 0x78, 0xA1, 0x39, 0x37, 0x67, 0x47, 0x32, 0xBF,
-    0xB8, 0x72, 0x04, 0xB5, 0x50, 0xCA, 0x32, 0x61, 0x26, 0x6C, 0xF7, 0x82, 0x65, 0x6E, 0x72, 0xE6,
-    0x96, 0x20, 0x6C, 0xE5, 0xFC, 0xA5, 0x87, 0x73, 0xB6, 0xF7, 0xFA, 0xB4, 0xE3, 0x12, 0xC9, 0x91,
-    0x25, 0x1C, 0x11, 0xDA, 0x77, 0xC6, 0x3D, 0xA8, 0x5D, 0xC7, 0x4D, 0xDC, 0x06, 0xA3, 0xA6, 0x65,
-    0xD2, 0xF0, 0x68, 0x53, 0x94, 0x14, 0x51, 0x06, 0x3C, 0xC8, 0xFA, 0xEC, 0x64, 0x26, 0xC0, 0x2F,
-    0xA7, 0x43, 0xCD, 0x1B, 0x83, 0x3B, 0x23, 0xE3, 0xAC, 0xA1, 0x6F, 0x12, 0xB8, 0xCD, 0x03, 0xDD,
-    0x75, 0xD2, 0x5D, 0x83, 0x5E, 0x77, 0x8D, 0x6B, 0xDD, 0x55, 0xDF, 0x2E, 0x39, 0x4D, 0x4B, 0x3D,
-    0xDD, 0x2A, 0xB2, 0x3C, 0x97, 0x2E, 0x83, 0xEC, 0xF1, 0x5D, 0x05, 0x1A, 0x59, 0x4A, 0x06, 0x3C,
-    0x88, 0xF8, 0x51, 0x95, 0x1F, 0x15, 0x45, 0x23, 0x41, 0xEF, 0x0D, 0x73, 0x91, 0x80, 0xF3, 0x5D,
-    0x0B, 0x5D, 0xD6, 0x2F, 0x97, 0x8F, 0x41, 0xB8, 0xB1, 0x1A, 0xC3, 0xFA, 0x9A, 0x2D, 0x3E, 0xC9,
-    0xCF, 0x3B, 0xA5, 0x2B, 0x16, 0x0D, 0x3C, 0x83, 0x55, 0x2F, 0x1D, 0xBC, 0x73, 0x98, 0x2B, 0x08,
-    0xAE, 0x86, 0xB8, 0xEE, 0x28, 0x5C, 0x7A, 0x24, 0xBF, 0xF8, 0x11, 0xBF, 0x5A, 0x7D, 0x43, 0xB3,
-    0xAF, 0xBC, 0x78, 0x35, 0x54, 0x6B, 0x94, 0x2E, 0xD6, 0xB2, 0x08, 0xC6, 0x21, 0x01, 0xF1, 0xDA,
-    0xDF, 0xF0, 0xB1, 0xFD, 0xC1, 0x75, 0xC4, 0xC0, 0xDE, 0xA8, 0xEF, 0x11, 0xED, 0x5C, 0x6D, 0x2A,
-    0xAE, 0x8E, 0x6B, 0xAE, 0x46, 0xAB, 0x77, 0x9D, 0xC4, 0xA7, 0xC2, 0xC7, 0x0B, 0xB1, 0x72, 0x2F,
-    0x80, 0xE6, 0x06, 0x6D, 0xB8, 0xF8, 0xA0, 0xB9, 0xD0, 0xD4, 0x39, 0x7E, 0x9B, 0x89, 0xAD, 0xCC,
-    0xD6, 0x50, 0xD5, 0x33, 0xB0, 0xBA, 0xC0, 0x56, 0x81, 0x43, 0xA1, 0xC8, 0xCB, 0x7E, 0xC1, 0x57,
-    0x89, 0x7C, 0x13, 0x41, 0xC5, 0x92, 0x08, 0x64, 0x6C, 0x9F, 0x64, 0x3C, 0x94, 0xD4, 0x74, 0x14,
-    0x0E, 0xE6, 0x15, 0x12, 0x19, 0x41, 0x55, 0x76, 0x9E, 0x08, 0xD9, 0x89, 0x4E, 0x9B, 0x98, 0xEC,
-    0x23, 0xBE, 0x7C, 0x66, 0x13, 0xA8, 0x75, 0xDA, 0x2D, 0x6B, 0x6F, 0xEE, 0x5C, 0x10, 0xA1, 0xD3,
-    0x5B, 0x56, 0xA3, 0xCF, 0xD3, 0x6F, 0xCC, 0x97, 0x01, 0x71, 0xAB, 0x59, 0x86, 0xC8, 0x60, 0x40,
-    0x60, 0x9A, 0x84, 0x47, 0x41, 0x9E, 0x2C, 0xD0, 0x7B, 0xE0, 0x64, 0x6D, 0xF4, 0x7D, 0x25, 0x77,
-    0xCC, 0x19, 0x1E, 0xAF, 0x85, 0x6F, 0xFC, 0x86, 0xEF, 0x43, 0xEA, 0x8E, 0x8E, 0xC6, 0x61, 0xF4,
-    0x7F, 0xE3, 0x5A, 0xB5, 0x60, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF, 0xB3, 0x86, 0x86, 0x00, 0x00, 0x45,
-    0xD0, 0xB1, 0x0D, 0x02, 0x31, 0x0C, 0x05, 0x50, 0xDB, 0x57, 0x50, 0x66, 0x84, 0x8C, 0xC0, 0x08,
-    0xC7, 0x3C, 0x34, 0x8C, 0x10, 0x36, 0x63, 0x05, 0x36, 0x20, 0xA2, 0xA4, 0x72, 0x41, 0x03, 0x8A,
-    0x62, 0xBE, 0x13, 0x47, 0x44, 0x72, 0xEE, 0xE5, 0xCB, 0x76, 0x71, 0x44, 0xFF, 0xC3, 0x35, 0x90,
-    0x03, 0x6C, 0x81, 0x1C, 0x60, 0x0B, 0xE4, 0x00, 0xDB, 0x77, 0x02, 0x23, 0x47, 0x07, 0x37, 0xA2,
-    0xE4, 0xC8, 0x3A, 0xF7, 0xB0, 0xDD, 0xCF, 0xB4, 0x57, 0x1F, 0x79, 0x74, 0x42, 0x33, 0x76, 0x58,
-    0xDB, 0x00, 0xEC, 0xB0, 0x9A, 0xAC, 0x7A, 0x60, 0x54, 0xAC, 0x8E, 0x60, 0x43, 0xE1, 0xDB, 0x69,
-    0x37, 0x7B, 0x02, 0x7A, 0xC0, 0x25, 0xA8, 0x53, 0xC1, 0x43, 0xC6, 0x2C, 0xDA, 0x01, 0x4D, 0x28,
-    0xC7, 0xEB, 0x86, 0xC0, 0xE1, 0xED, 0x0B, 0xE4, 0x78, 0x27, 0x0F, 0x80, 0x6B, 0xF6, 0x80, 0xA4,
-    0x53, 0xD1, 0x81, 0x26, 0x23, 0x20, 0xF9, 0x5C, 0x74, 0xC2, 0x66, 0x00, 0xE8, 0x42, 0xFC, 0x0E,
-    0xD1, 0x85, 0x71, 0xFF, 0x00,
+static const uint8_t notosans_18_italicBitmaps[42978] = {
+    0xD5, 0x9C, 0x3D, 0xB0, 0x25, 0x49, 0x95, 0xDF, 0x7F, 0x59, 0x39, 0xDD, 0xB5, 0x50, 0x46, 0x8E,
+    0x41, 0x4B, 0xBB, 0x60, 0x94, 0x4C, 0x09, 0x19, 0xE5, 0xCA, 0x99, 0xCE, 0x1C, 0x08, 0x05, 0xC6,
+    0x1A, 0x6A, 0xA3, 0x1F, 0x28, 0x34, 0x06, 0x0E, 0x16, 0x6B, 0xB4, 0x23, 0x93, 0x7E, 0x55, 0x80,
+    0x81, 0x49, 0x3B, 0x48, 0x86, 0x0C, 0x46, 0x11, 0x28, 0x02, 0x1A, 0x63, 0x5C, 0x14, 0xDB, 0xEF,
+    0x56, 0xC2, 0x18, 0x63, 0x60, 0x90, 0x12, 0x02, 0x0C, 0x8C, 0xCD, 0x88, 0x66, 0xD8, 0xD8, 0x21,
+    0x42, 0xCA, 0x85, 0x42, 0x64, 0xCF, 0x64, 0xD5, 0x59, 0x23, 0xEB, 0xDE, 0xF7, 0x31, 0xDD, 0x2C,
+    0xDA, 0x08, 0x46, 0x4C, 0xBD, 0x78, 0xF7, 0xBD, 0x9B, 0xF5, 0x71, 0x4F, 0x66, 0x9E, 0x3C, 0xE7,
+    0x7F, 0xFE, 0xE7, 0xE4, 0xA5, 0x4B, 0x58, 0x8F, 0xD0, 0x66, 0xFA, 0xC0, 0x8C, 0x2E, 0x98, 0x88,
+    0x75, 0xAA, 0xD0, 0x25, 0x86, 0x89, 0x15, 0x9D, 0x30, 0x9E, 0x73, 0x9A, 0x05, 0xE3, 0xB1, 0x70,
+    0x9F, 0x7A, 0x7C, 0x81, 0x6E, 0xC1, 0x06, 0xC4, 0xE9, 0x82, 0x72, 0x0C, 0xD3, 0x6A, 0xBF, 0x5C,
+    0xEC, 0xAB, 0xC5, 0x36, 0xD9, 0x36, 0xE9, 0xA1, 0x4E, 0x5F, 0xD2, 0xF1, 0x89, 0x0E, 0xDF, 0x6B,
+    0xFD, 0xD2, 0x4E, 0xD0, 0x4D, 0xDD, 0x04, 0x66, 0x32, 0x13, 0xF4, 0xCE, 0x38, 0x18, 0x18, 0x00,
+    0x8B, 0x05, 0x5E, 0xE1, 0x15, 0xE0, 0x09, 0x5F, 0x02, 0x0A, 0x4F, 0x68, 0x45, 0x44, 0xD6, 0x4E,
+    0x44, 0x64, 0xBD, 0xFD, 0xDD, 0x77, 0xBF, 0xFB, 0xEE, 0xB7, 0xD1, 0x51, 0x47, 0xD0, 0x41, 0x07,
+    0x68, 0x7D, 0xEB, 0xC1, 0x78, 0xE3, 0xF7, 0x47, 0xDE, 0x79, 0xF0, 0x8D, 0x07, 0xDF, 0x70, 0xB3,
+    0x88, 0x48, 0x10, 0x11, 0x11, 0xCF, 0x43, 0x1E, 0x5E, 0x79, 0x64, 0x01, 0x32, 0x19, 0x54, 0x52,
+    0x0B, 0x34, 0xA9, 0x49, 0x9C, 0x1E, 0xD9, 0x06, 0x00, 0xEE, 0x01, 0xAD, 0x07, 0x06, 0x80, 0x0C,
+    0x6A, 0x96, 0x47, 0x58, 0x91, 0xA0, 0xB7, 0x6D, 0xC6, 0xFE, 0x20, 0x7E, 0x8C, 0x62, 0x26, 0xDA,
+    0xF8, 0x0A, 0x0C, 0x5F, 0x4E, 0x70, 0xDE, 0x79, 0x58, 0xEF, 0x42, 0x23, 0x0B, 0x68, 0x89, 0xA0,
+    0x24, 0x03, 0x52, 0x40, 0xFF, 0xAA, 0x80, 0xF9, 0x4C, 0x82, 0x2F, 0x99, 0x80, 0x4A, 0xD6, 0xD1,
+    0x4D, 0x2B, 0xDC, 0x6D, 0xD3, 0xBF, 0x62, 0x99, 0xDD, 0xFC, 0x2B, 0xC9, 0x8D, 0x88, 0x38, 0x35,
+    0xCB, 0x23, 0xD0, 0x01, 0x30, 0x0E, 0xF8, 0x12, 0xD0, 0x24, 0xAE, 0x1D, 0xDD, 0x06, 0x3A, 0x6A,
+    0xC9, 0x50, 0x38, 0x7C, 0xDE, 0x33, 0xB8, 0x7E, 0x7A, 0x48, 0x1B, 0x9B, 0xA4, 0x03, 0x85, 0xBB,
+    0xDC, 0xC5, 0xD2, 0x86, 0x36, 0x74, 0x81, 0x27, 0x3C, 0x54, 0x19, 0xE3, 0x3B, 0x6F, 0xA1, 0x50,
+    0x8C, 0xC7, 0x4C, 0xE6, 0x2B, 0xCB, 0x1D, 0xB2, 0x5A, 0xCE, 0xFB, 0xCD, 0x78, 0x6B, 0xDE, 0x92,
+    0x7C, 0x61, 0xFE, 0x67, 0x5A, 0xFB, 0xB7, 0x24, 0x3F, 0x1C, 0xDC, 0x93, 0x61, 0x33, 0x5F, 0x4D,
+    0x6D, 0xF8, 0xA2, 0x4E, 0x0F, 0x79, 0x08, 0x4F, 0x3A, 0xDF, 0x79, 0x7A, 0x57, 0x78, 0x82, 0x8E,
+    0x66, 0x32, 0x9E, 0x42, 0x26, 0x33, 0x60, 0xA6, 0xDE, 0xB5, 0x81, 0xAC, 0x13, 0x19, 0x33, 0x3D,
+    0xC4, 0xC2, 0xDA, 0xFB, 0x2E, 0xD0, 0x4A, 0x52, 0x19, 0x86, 0x02, 0xC0, 0xC7, 0x2E, 0xA5, 0x1F,
+    0x36, 0x40, 0x89, 0x04, 0x68, 0xB7, 0x07, 0x09, 0x4C, 0xD4, 0x0B, 0x18, 0xDF, 0x64, 0xE8, 0x7D,
+    0x93, 0x61, 0x98, 0x9A, 0x05, 0xFA, 0x49, 0x27, 0xE8, 0x7D, 0x1F, 0xC1, 0x84, 0x79, 0x82, 0xEE,
+    0x77, 0x2B, 0xFB, 0xD0, 0xD2, 0x0A, 0xC0, 0x28, 0x40, 0x23, 0xE3, 0xC4, 0xB7, 0xBB, 0xA5, 0x0F,
+    0x4D, 0x1E, 0x42, 0x97, 0x74, 0xB2, 0x4E, 0x67, 0x13, 0x47, 0xD4, 0x3A, 0xF8, 0x03, 0xCC, 0x33,
+    0x2B, 0xD8, 0x95, 0x0D, 0xCC, 0xC2, 0x0C, 0xC3, 0xC2, 0x38, 0x29, 0x29, 0xD8, 0x67, 0x0F, 0x56,
+    0xC1, 0x88, 0xC4, 0x71, 0x6A, 0x64, 0x63, 0x08, 0xDC, 0x72, 0xC0, 0xF0, 0xF5, 0xA7, 0x4B, 0xB1,
+    0xFD, 0x67, 0x7E, 0x90, 0xBE, 0xF7, 0x0A, 0x30, 0x38, 0xFA, 0x89, 0xDE, 0x63, 0x3C, 0x26, 0xD0,
+    0x45, 0x74, 0x42, 0x67, 0x54, 0x81, 0x15, 0x46, 0x18, 0x26, 0x4C, 0xA0, 0x4D, 0x34, 0x19, 0x56,
+    0xB0, 0x60, 0x3C, 0x6D, 0x42, 0x15, 0x38, 0x87, 0x7E, 0xA2, 0x8D, 0xA8, 0x5C, 0xDF, 0x78, 0x74,
+    0x82, 0x02, 0x83, 0xA3, 0x8D, 0xF5, 0x3F, 0xD0, 0x11, 0x68, 0x22, 0x3C, 0x04, 0x33, 0xD1, 0x24,
+    0x78, 0x08, 0xFD, 0x74, 0xBC, 0xD8, 0x82, 0x09, 0xE8, 0xA5, 0x7E, 0x80, 0xC3, 0x84, 0xE3, 0x99,
+    0x5D, 0x80, 0x88, 0x5E, 0x50, 0x05, 0x0E, 0x60, 0x61, 0xA8, 0xC2, 0x26, 0x74, 0xA2, 0xA9, 0xC2,
+    0x56, 0x79, 0x2F, 0xE0, 0xFC, 0x72, 0x5E, 0x0E, 0x80, 0x4E, 0x80, 0xF1, 0xBC, 0xC4, 0x5D, 0xB8,
+    0x60, 0x41, 0xCB, 0xA7, 0x3D, 0xB7, 0xE5, 0x7F, 0xF3, 0x31, 0x1E, 0x88, 0x24, 0x8C, 0x88, 0x67,
+    0xF6, 0xFF, 0x01, 0xF3, 0xA3, 0x09, 0xD6, 0x01, 0x4C, 0xBC, 0x0B, 0x33, 0x05, 0x52, 0xB3, 0x80,
+    0x6B, 0x13, 0xF0, 0x91, 0xE3, 0xE2, 0x39, 0x3E, 0x10, 0x2C, 0x40, 0xB9, 0xD9, 0xF4, 0xC9, 0xC7,
+    0xDB, 0xE3, 0xFF, 0x2A, 0x22, 0xF2, 0x33, 0x11, 0x11, 0xF7, 0x82, 0xAB, 0xAE, 0x36, 0x4D, 0xC0,
+    0x19, 0x5B, 0x53, 0x74, 0x6E, 0x93, 0x89, 0xC6, 0x0F, 0xEE, 0x2E, 0x5F, 0xE2, 0xA3, 0x8F, 0x5F,
+    0x9F, 0xE5, 0xC7, 0x22, 0xB7, 0xCE, 0xEE, 0xDF, 0xFE, 0xD4, 0x6A, 0x7F, 0xBC, 0x5A, 0xFF, 0xE8,
+    0x78, 0xCF, 0xE0, 0x81, 0x15, 0xE8, 0xE2, 0xFE, 0x3C, 0x9D, 0x81, 0xFE, 0xD8, 0xDC, 0x26, 0xC0,
+    0x3A, 0x68, 0x0A, 0x60, 0xC2, 0xD5, 0xC1, 0xB0, 0x13, 0xA8, 0x02, 0x98, 0x08, 0x8C, 0x80, 0x5E,
+    0xFE, 0x91, 0x47, 0x6E, 0xC7, 0x47, 0xEE, 0xC7, 0x6D, 0x89, 0x30, 0x4B, 0xC2, 0x6C, 0x73, 0x64,
+    0x9E, 0x06, 0xDF, 0x66, 0xEC, 0x64, 0x3D, 0xB3, 0x2A, 0xA8, 0x62, 0x22, 0x6D, 0x1A, 0x1D, 0xFD,
+    0x0F, 0x0A, 0x8C, 0x26, 0xA2, 0x8A, 0x75, 0x74, 0x7F, 0x5F, 0x60, 0x78, 0x2B, 0xC1, 0x36, 0x4C,
+    0xE8, 0x7C, 0x00, 0xF3, 0xE3, 0x0C, 0xA3, 0x09, 0x34, 0xC5, 0x3A, 0x4C, 0xDC, 0x60, 0x6C, 0x32,
+    0xBA, 0x74, 0x89, 0x3E, 0xF4, 0x9E, 0x0D, 0xEB, 0x4D, 0x62, 0xFC, 0xA5, 0x38, 0x66, 0x49, 0x30,
+    0x6F, 0xC0, 0x1D, 0x00, 0x2E, 0x68, 0x57, 0x86, 0xA2, 0xA4, 0x98, 0x2D, 0x8F, 0xBF, 0xCE, 0xF6,
+    0xD3, 0xCB, 0x9F, 0xEB, 0x44, 0x9B, 0xE8, 0x22, 0x26, 0x60, 0x3C, 0xBD, 0x67, 0xF0, 0x0C, 0x13,
+    0xD6, 0x61, 0x61, 0x84, 0x03, 0x6C, 0xB0, 0x42, 0x41, 0x15, 0x9A, 0x8C, 0x5E, 0xA8, 0x37, 0xED,
+    0xC7, 0x03, 0x71, 0xB4, 0x22, 0x89, 0x61, 0x9B, 0x0B, 0x7D, 0xD0, 0x2B, 0x1F, 0xA9, 0x23, 0x80,
+    0x00, 0xCC, 0x47, 0xCD, 0x62, 0x65, 0x1F, 0x48, 0x9D, 0x81, 0x2E, 0x01, 0x43, 0x00, 0x66, 0x07,
+    0xCD, 0x06, 0x74, 0xCB, 0xB1, 0x49, 0x1C, 0xE8, 0x15, 0x30, 0x09, 0x18, 0x3D, 0xA8, 0x0D, 0x68,
+    0xF3, 0xF1, 0x82, 0x51, 0x44, 0xFC, 0x2C, 0x22, 0xBE, 0x1A, 0xF6, 0x7A, 0x8C, 0xE2, 0xE8, 0x44,
+    0x12, 0x76, 0x7B, 0xA3, 0xD0, 0x4F, 0x7A, 0xE5, 0xCF, 0x76, 0x59, 0xB6, 0x6B, 0x62, 0x70, 0x12,
+    0xC3, 0x24, 0xB8, 0x35, 0x4F, 0x68, 0x79, 0x06, 0xAD, 0x44, 0xB8, 0xFD, 0xDD, 0x95, 0x5D, 0xAA,
+    0x3A, 0xC9, 0x26, 0x1C, 0x27, 0xFF, 0xF2, 0xA5, 0x0F, 0x80, 0xF5, 0xFF, 0x06, 0xC4, 0xD9, 0xB7,
+    0x1F, 0x6C, 0x58, 0x91, 0x4C, 0x27, 0x32, 0xC1, 0xAD, 0x7B, 0x00, 0xA8, 0x95, 0xBD, 0x27, 0x88,
+    0x07, 0x24, 0x01, 0x87, 0x02, 0x1C, 0xCE, 0x81, 0x71, 0x70, 0x30, 0x1A, 0x0F, 0xF6, 0xD3, 0x09,
+    0xEC, 0xAB, 0x19, 0xEC, 0x74, 0x80, 0x61, 0xB2, 0x8E, 0xC1, 0x1B, 0x4F, 0xEF, 0xDB, 0x54, 0x2D,
+    0xA1, 0x09, 0x5C, 0x60, 0x02, 0xD6, 0x99, 0x88, 0xF1, 0xAD, 0x88, 0xC8, 0xAF, 0x45, 0x44, 0xCA,
+    0x2C, 0x22, 0xDB, 0x71, 0x8D, 0x18, 0x0F, 0xB4, 0x11, 0x68, 0xF2, 0xA9, 0xAB, 0x16, 0x68, 0x45,
+    0x0A, 0x9D, 0x48, 0xC1, 0x88, 0xE4, 0x7A, 0x5D, 0x3F, 0xED, 0x3A, 0x5F, 0xEF, 0x3D, 0xAF, 0x2A,
+    0xB2, 0x8F, 0x0D, 0xE5, 0x0C, 0x94, 0x48, 0x44, 0x8B, 0xAC, 0xF0, 0xF6, 0x3F, 0xAF, 0x93, 0x39,
+    0x01, 0xD6, 0x1F, 0xF5, 0xBC, 0x8E, 0xCC, 0xE9, 0xED, 0xE0, 0xF7, 0xE5, 0xC2, 0xCC, 0xEB, 0xE8,
+    0x8D, 0xF9, 0x1B, 0x73, 0x66, 0x16, 0x89, 0xF4, 0xB2, 0x01, 0x77, 0xDC, 0x69, 0x49, 0x7C, 0x42,
+    0x02, 0x9D, 0x08, 0xC8, 0xBB, 0x4F, 0x30, 0x79, 0xD7, 0x96, 0x2E, 0x1D, 0x97, 0xD8, 0xB5, 0xB5,
+    0xA4, 0xD3, 0xBF, 0x8E, 0x0C, 0x3F, 0x94, 0xCC, 0x26, 0x92, 0xB5, 0x78, 0x93, 0x4C, 0xC6, 0x84,
+    0x71, 0x62, 0xF8, 0x72, 0x81, 0x43, 0x97, 0x68, 0xF2, 0x30, 0xD1, 0xC5, 0x03, 0xD8, 0x4F, 0x65,
+    0x28, 0x6D, 0xA2, 0x4B, 0x26, 0x60, 0x9D, 0xF5, 0xBA, 0x30, 0xBE, 0x3D, 0x7B, 0x66, 0x29, 0x55,
+    0x49, 0xB8, 0xE5, 0xA0, 0x17, 0x91, 0x34, 0x8B, 0xC8, 0x9B, 0xFB, 0x18, 0xB6, 0xD7, 0x97, 0x7B,
+    0xD8, 0xB5, 0xB7, 0x2E, 0xF7, 0x7F, 0xC4, 0x0A, 0x5C, 0x36, 0xE7, 0x6B, 0xC6, 0x21, 0xBD, 0xB8,
+    0xF9, 0xEA, 0x0A, 0xD2, 0x22, 0x11, 0xB3, 0xCD, 0x0B, 0x43, 0xD0, 0xA5, 0xC2, 0xAD, 0x11, 0xD6,
+    0xD3, 0x4B, 0xC1, 0xD2, 0x14, 0xEC, 0xD4, 0x25, 0xFA, 0x60, 0x03, 0xED, 0xBB, 0xB2, 0x43, 0x8C,
+    0x5E, 0x22, 0xC8, 0xCF, 0x0B, 0x7A, 0x45, 0x30, 0x11, 0x3B, 0x0D, 0x9E, 0xC1, 0x5B, 0x87, 0xF1,
+    0x16, 0x4C, 0x18, 0xF7, 0x97, 0xDE, 0xDB, 0x09, 0xEB, 0x87, 0xC0, 0xEC, 0xCC, 0xFA, 0xDA, 0x46,
+    0x2B, 0x92, 0x61, 0x96, 0x09, 0xD4, 0xBD, 0xA3, 0x3C, 0x4D, 0xB5, 0x56, 0x0B, 0x66, 0x9B, 0x13,
+    0xB3, 0xEB, 0x63, 0xBB, 0xEC, 0xB7, 0xBA, 0x02, 0x6B, 0x7B, 0x6D, 0xB0, 0xBF, 0x92, 0x61, 0xED,
+    0x22, 0xDD, 0xD2, 0x7B, 0x46, 0x6F, 0x7D, 0x2B, 0xCC, 0xEF, 0x6C, 0x85, 0x59, 0x7E, 0x18, 0x19,
+    0x17, 0xEB, 0xF6, 0x81, 0x3B, 0xD9, 0xC9, 0xA6, 0xEC, 0x73, 0xAB, 0x36, 0x60, 0x48, 0xBC, 0xFB,
+    0x57, 0xB2, 0x0F, 0x80, 0x64, 0x50, 0xF7, 0x01, 0xFE, 0x82, 0x21, 0x98, 0xA5, 0x2D, 0x6C, 0xDC,
+    0xE2, 0xF9, 0xC7, 0x6D, 0xD7, 0x2D, 0x7A, 0x45, 0x9C, 0xF5, 0x8D, 0x03, 0xF5, 0x88, 0x21, 0x20,
+    0xAE, 0x2D, 0x98, 0xF8, 0xC2, 0x9B, 0xEA, 0x71, 0x9F, 0x76, 0xC1, 0x7A, 0x56, 0xBA, 0x84, 0x75,
+    0x2A, 0xEF, 0x80, 0x76, 0x9F, 0x96, 0x97, 0x81, 0x36, 0x80, 0x12, 0x07, 0xE3, 0x02, 0xFD, 0x0A,
+    0xAD, 0x38, 0x94, 0x04, 0x18, 0x7F, 0x01, 0x7D, 0x3E, 0x9A, 0xA4, 0x0D, 0xB8, 0x2D, 0x01, 0x98,
+    0x33, 0xD0, 0x6F, 0x0E, 0xDA, 0xCB, 0xF7, 0xC3, 0xB2, 0x3F, 0x0B, 0xC5, 0x9D, 0xB3, 0xB3, 0xB3,
+    0x7B, 0xB2, 0x2B, 0x9C, 0xDC, 0x3A, 0x3B, 0x3B, 0xBB, 0xFF, 0x1C, 0xD9, 0xAC, 0x88, 0xA4, 0xD3,
+    0x55, 0xDC, 0x03, 0xD4, 0x02, 0xB4, 0x2B, 0xD0, 0x89, 0xA3, 0x4A, 0xC1, 0xB8, 0x50, 0x05, 0xA3,
+    0xBD, 0x6C, 0xB4, 0x01, 0x1A, 0x71, 0x28, 0x89, 0x55, 0x80, 0x07, 0x2B, 0xF4, 0xE2, 0xE8, 0x64,
+    0x82, 0x31, 0xEE, 0xCF, 0x52, 0x97, 0x1F, 0x37, 0x6E, 0x74, 0x22, 0xC1, 0x6C, 0xF3, 0xD2, 0x4D,
+    0x6D, 0xAE, 0xD3, 0xA3, 0xAE, 0xFC, 0xEA, 0x5C, 0xF5, 0x75, 0x08, 0x30, 0x3B, 0xF4, 0x0A, 0xFD,
+    0x52, 0xAD, 0xC0, 0x06, 0x2A, 0x57, 0x37, 0xA9, 0x23, 0x28, 0x77, 0x75, 0x72, 0xAA, 0x91, 0xB4,
+    0xB1, 0x0A, 0x65, 0x3D, 0xC7, 0x39, 0xB9, 0xFD, 0xF8, 0x11, 0x40, 0x2F, 0xB2, 0xB0, 0xAF, 0x42,
+    0x30, 0x2B, 0xCC, 0x1E, 0x5D, 0xAA, 0x25, 0x58, 0xEB, 0x02, 0xB3, 0x0E, 0x30, 0xDE, 0x04, 0x6E,
+    0xDD, 0xE3, 0x42, 0x65, 0x06, 0xF9, 0x45, 0x1B, 0x2D, 0xBD, 0x88, 0xBB, 0xDB, 0x85, 0x36, 0xEB,
+    0xA4, 0x53, 0xA1, 0x60, 0xB1, 0x66, 0xB2, 0xAE, 0x8D, 0xFA, 0xD7, 0x8B, 0x8E, 0x5C, 0x70, 0x77,
+    0xE0, 0x02, 0xE3, 0xF5, 0xD3, 0x64, 0x3C, 0x85, 0x87, 0x96, 0x42, 0x3F, 0x75, 0x6F, 0x26, 0xE3,
+    0xF5, 0x42, 0xB6, 0x14, 0x46, 0x86, 0x4F, 0x27, 0xE3, 0xFB, 0xA5, 0x8D, 0x96, 0xF9, 0xB5, 0x1F,
+    0xFD, 0xB4, 0x34, 0x8B, 0x96, 0x65, 0x14, 0xFA, 0xA9, 0xCB, 0x4A, 0x5C, 0xB5, 0x84, 0x97, 0xAE,
+    0xDC, 0x4E, 0xF5, 0xAF, 0x38, 0xB8, 0x07, 0x5A, 0xEE, 0xDD, 0x3A, 0x00, 0x9D, 0x88, 0xC4, 0xFA,
+    0x37, 0x00, 0xA8, 0xB3, 0xE3, 0x42, 0x2A, 0x00, 0x7D, 0xE2, 0xE8, 0x02, 0x5A, 0x71, 0x80, 0xBD,
+    0x00, 0xD4, 0xB3, 0x0C, 0x98, 0xB7, 0x22, 0x30, 0x1B, 0x0F, 0x7A, 0xB1, 0xC0, 0xE0, 0x0B, 0x50,
+    0x74, 0x82, 0x2E, 0x9A, 0x00, 0x23, 0xD6, 0xA1, 0x33, 0x87, 0x23, 0x26, 0x96, 0xB3, 0xD7, 0x12,
+    0xAD, 0x88, 0x78, 0xAC, 0x88, 0xD0, 0x6C, 0x8F, 0x1F, 0x97, 0x1D, 0x0E, 0xCE, 0x60, 0x82, 0x5E,
+    0x60, 0x98, 0x06, 0x0F, 0x07, 0x56, 0x50, 0xC5, 0x24, 0x2A, 0xBC, 0xA0, 0x7F, 0xB3, 0xD4, 0x35,
+    0xD8, 0xC9, 0xBB, 0x0E, 0x44, 0x64, 0xA2, 0x17, 0x11, 0x54, 0xE1, 0xC1, 0xC2, 0x30, 0x61, 0xBD,
+    0x5E, 0x68, 0x0A, 0x96, 0xEA, 0x7D, 0x54, 0x61, 0x86, 0xC1, 0x9B, 0x48, 0xBB, 0xB0, 0xA2, 0x36,
+    0xCC, 0xDB, 0x9F, 0x95, 0x49, 0x89, 0xC8, 0xC4, 0x20, 0x12, 0xD1, 0xCF, 0xCE, 0xE6, 0x80, 0x75,
+    0xCC, 0x4E, 0x27, 0x9A, 0xC2, 0x08, 0x7D, 0xE8, 0x22, 0xAC, 0xAC, 0x60, 0x82, 0xF1, 0xA8, 0xA2,
+    0x0A, 0x58, 0x3F, 0x78, 0xBA, 0xA5, 0xC9, 0xB4, 0x82, 0x15, 0x11, 0xAF, 0x45, 0x24, 0x32, 0x8A,
+    0x3C, 0xBA, 0x6A, 0x0E, 0x23, 0x8C, 0x22, 0x01, 0x2B, 0x52, 0x30, 0x1B, 0xB7, 0x27, 0xBD, 0x9D,
+    0xBC, 0x4F, 0x1F, 0xA1, 0xAA, 0x09, 0xA3, 0x3B, 0x22, 0x84, 0xEA, 0xE9, 0x06, 0x7F, 0x3A, 0x65,
+    0xA7, 0xA3, 0x85, 0xAE, 0x3A, 0xD4, 0x2E, 0xA7, 0x1B, 0xF6, 0xD6, 0xE9, 0x74, 0xED, 0x10, 0x4E,
+    0x60, 0xA5, 0x5B, 0x51, 0x0E, 0xBB, 0x7D, 0xB7, 0xC0, 0x2C, 0xE2, 0x51, 0x22, 0xBF, 0x00, 0xCE,
+    0x1C, 0xD0, 0xC9, 0xDF, 0xD5, 0xE5, 0x19, 0x50, 0x22, 0x12, 0x69, 0x93, 0x9A, 0x23, 0xC3, 0xC4,
+    0x18, 0x58, 0xC1, 0x7A, 0x9D, 0x60, 0x76, 0xBD, 0x87, 0x8D, 0x19, 0x74, 0xAE, 0x6B, 0xC7, 0x04,
+    0x18, 0xBC, 0x05, 0x66, 0x55, 0x40, 0x97, 0x2E, 0x82, 0x89, 0x76, 0x02, 0x3B, 0xAD, 0xA0, 0x56,
+    0x9D, 0xA0, 0x4B, 0xBD, 0x07, 0xEB, 0x0F, 0xD0, 0xAC, 0x7A, 0x01, 0x93, 0x8C, 0x07, 0x71, 0x23,
+    0x98, 0xDC, 0x14, 0x94, 0x4C, 0x5D, 0x54, 0x73, 0xC6, 0x8A, 0x88, 0xA3, 0x8A, 0x20, 0xF2, 0x2D,
+    0xAA, 0xEE, 0x6D, 0x18, 0x91, 0x8D, 0x5E, 0x64, 0xDD, 0xDD, 0xF1, 0x75, 0x07, 0x3F, 0x9E, 0xD0,
+    0xD8, 0x76, 0x1A, 0xB1, 0xED, 0xEC, 0xCC, 0x29, 0x11, 0x99, 0x1A, 0x11, 0x71, 0xFA, 0xD9, 0xD9,
+    0x59, 0x1D, 0x1E, 0x9D, 0x8E, 0x6A, 0xDF, 0xC5, 0x17, 0xF8, 0xF9, 0xFA, 0x74, 0x91, 0x8C, 0x15,
+    0x59, 0x18, 0x45, 0xD2, 0x3F, 0x59, 0x8C, 0x02, 0xA8, 0xF5, 0xEC, 0x8C, 0x2A, 0x86, 0x88, 0xA0,
+    0xB7, 0xC7, 0x8F, 0x9F, 0x2F, 0x46, 0x78, 0x8E, 0x18, 0xD7, 0x9F, 0x7E, 0x89, 0x31, 0x9E, 0x41,
+    0x2B, 0x22, 0x13, 0xB3, 0xC8, 0x8A, 0xD9, 0x68, 0x12, 0x32, 0x01, 0x5D, 0x06, 0x18, 0x2F, 0x95,
+    0xA0, 0xBF, 0x54, 0x82, 0xAA, 0x2B, 0x83, 0x3F, 0x35, 0xE8, 0x8C, 0x96, 0xD5, 0x04, 0x7A, 0x49,
+    0xD6, 0x31, 0xCB, 0xF7, 0x57, 0xE0, 0xD0, 0x2E, 0xA0, 0xB3, 0x09, 0x60, 0x82, 0x9D, 0x60, 0x44,
+    0x40, 0x95, 0x66, 0x85, 0x2E, 0xEA, 0x02, 0xD6, 0x75, 0x2B, 0xAA, 0xD0, 0xC9, 0x3B, 0x92, 0xE8,
+    0x44, 0xC4, 0xD3, 0x54, 0x85, 0xBA, 0xE3, 0x80, 0x2E, 0xC0, 0xE0, 0xF4, 0x02, 0x26, 0xA8, 0x02,
+    0x3A, 0x31, 0x82, 0x2A, 0x0C, 0x13, 0xCC, 0x98, 0x00, 0x76, 0xD2, 0xE9, 0xCA, 0xE9, 0xF9, 0x74,
+    0xFA, 0x50, 0x4F, 0x3B, 0xFD, 0xEC, 0xEC, 0xEC, 0xF3, 0x41, 0x89, 0x88, 0x24, 0x66, 0x11, 0x29,
+    0xD8, 0x77, 0x1E, 0x3F, 0xDE, 0x8E, 0xA7, 0x13, 0x18, 0xAF, 0x0A, 0xB4, 0x89, 0x03, 0x34, 0x05,
+    0xEB, 0x2E, 0xEF, 0x6E, 0x6F, 0x9E, 0xCE, 0x58, 0x07, 0x1B, 0xC6, 0x5F, 0x9E, 0x06, 0x23, 0x85,
+    0x5E, 0x0A, 0xB7, 0xE5, 0x51, 0x9D, 0xB6, 0xB5, 0x4E, 0x9A, 0x2A, 0x15, 0x69, 0xEA, 0x65, 0xFF,
+    0x4D, 0x75, 0xBA, 0xBA, 0x58, 0xE7, 0xC9, 0xF8, 0x3A, 0x55, 0x83, 0xAF, 0x13, 0x65, 0x5D, 0x9D,
+    0xA6, 0x71, 0xC7, 0xE2, 0xFB, 0xA3, 0x6E, 0x6F, 0x30, 0x4A, 0x62, 0x96, 0x48, 0x8D, 0xB1, 0x31,
+    0xA1, 0x3E, 0x49, 0x95, 0xFD, 0x52, 0x7B, 0xA5, 0xB1, 0xB9, 0xD6, 0xE8, 0xAF, 0x34, 0x6E, 0x37,
+    0x1B, 0xF3, 0x95, 0xC6, 0xDE, 0x57, 0x47, 0xD6, 0xE4, 0xBD, 0x07, 0x96, 0xCB, 0x46, 0xBD, 0x7B,
+    0xBE, 0x66, 0x43, 0x8B, 0x80, 0x08, 0x0C, 0xEB, 0x89, 0x69, 0x09, 0x54, 0x14, 0x6E, 0x12, 0xBD,
+    0xC7, 0x7A, 0x7A, 0x8F, 0xC0, 0x30, 0xED, 0xF3, 0x9C, 0xC0, 0x32, 0x04, 0x18, 0x99, 0x1D, 0xCC,
+    0xCD, 0x0A, 0x6C, 0xDD, 0x02, 0xAC, 0x43, 0x00, 0xCA, 0xEC, 0x40, 0x6D, 0x95, 0xA6, 0x10, 0x07,
+    0x5A, 0xDE, 0xF0, 0xA0, 0x57, 0x13, 0x40, 0x27, 0x13, 0xA1, 0x4D, 0x75, 0xEC, 0x74, 0x06, 0x13,
+    0x9A, 0x02, 0xC6, 0xB3, 0x72, 0xFC, 0x28, 0xBF, 0x07, 0xF7, 0x76, 0xC2, 0x3A, 0x06, 0xBF, 0xB3,
+    0x00, 0x63, 0x35, 0x81, 0x5D, 0x00, 0xEB, 0xD8, 0xA7, 0x92, 0x61, 0x82, 0xB5, 0x4E, 0x48, 0xEF,
+    0xA9, 0xC6, 0xA8, 0x0E, 0xA0, 0xAD, 0x83, 0xDA, 0xC5, 0x3A, 0x28, 0x57, 0x2E, 0x3A, 0xD4, 0x49,
+    0x34, 0x1E, 0xC6, 0x3A, 0x18, 0x5D, 0xAC, 0x4B, 0x7C, 0x8F, 0xCE, 0xF7, 0x65, 0x33, 0x2C, 0xD8,
+    0x04, 0x48, 0x50, 0xE2, 0xA1, 0x93, 0x8A, 0x4A, 0xC6, 0x82, 0xBD, 0x00, 0xFD, 0x5E, 0x62, 0xCD,
+    0xD0, 0xBF, 0x31, 0xE9, 0xDF, 0x44, 0x28, 0x2B, 0xFD, 0xD7, 0x3D, 0xED, 0xD3, 0xC4, 0xC1, 0x82,
+    0xED, 0xBD, 0x5E, 0x0A, 0x4D, 0x3E, 0x60, 0xDE, 0x4C, 0x98, 0x37, 0x33, 0xB6, 0xF3, 0x5C, 0x98,
+    0xA0, 0xF2, 0xE0, 0x74, 0xB2, 0x74, 0xF1, 0x21, 0xC3, 0xAB, 0x05, 0xFB, 0x6A, 0x56, 0xA5, 0x8B,
+    0x14, 0x1D, 0x8D, 0xB7, 0xAE, 0x4D, 0xC6, 0x9F, 0xB3, 0xD2, 0x4F, 0x56, 0xA7, 0x36, 0x71, 0x41,
+    0xE9, 0xA7, 0xDE, 0xEB, 0xD4, 0xA4, 0xC2, 0x01, 0xE3, 0xBB, 0x9F, 0x07, 0xBD, 0x30, 0xD2, 0x8F,
+    0x95, 0x43, 0x1A, 0x17, 0x46, 0x4C, 0x40, 0x7C, 0x53, 0xB0, 0xE8, 0x15, 0x13, 0xD9, 0xC9, 0xCC,
+    0x36, 0x61, 0xAB, 0xD9, 0xE9, 0x22, 0xB4, 0x01, 0x01, 0x56, 0xFA, 0x0C, 0xC6, 0x37, 0xE2, 0xA1,
+    0x60, 0x57, 0xE8, 0xBD, 0x7E, 0x2F, 0xD2, 0x64, 0xAC, 0x05, 0xEB, 0xDA, 0xA7, 0x0B, 0x3A, 0x71,
+    0xD1, 0x7B, 0x46, 0x4C, 0x28, 0xB4, 0x91, 0xD2, 0x45, 0x0E, 0x18, 0x3F, 0x62, 0x82, 0xCA, 0x7A,
+    0xA1, 0x30, 0x4C, 0xC3, 0xD4, 0x7B, 0xBD, 0x50, 0x9A, 0x8C, 0xC5, 0x04, 0xEB, 0xDA, 0xC4, 0xA8,
+    0x17, 0xCE, 0xD1, 0xC9, 0xD2, 0x05, 0x86, 0xAF, 0x25, 0x0A, 0xAA, 0x1C, 0x30, 0x1E, 0xF3, 0xF3,
+    0xA0, 0x0A, 0x1C, 0x0A, 0xC3, 0x84, 0x16, 0xAF, 0x17, 0xB0, 0x05, 0x0B, 0x4A, 0xEA, 0xFA, 0x5F,
+    0x18, 0x8F, 0x56, 0x73, 0x57, 0x48, 0xF9, 0x05, 0x20, 0x22, 0xEC, 0x58, 0xA0, 0xCF, 0xD8, 0xC4,
+    0xE8, 0xE9, 0x32, 0x02, 0xBA, 0x34, 0x05, 0xD4, 0xAA, 0x33, 0xB0, 0x75, 0x09, 0x10, 0x13, 0x81,
+    0xB9, 0xF7, 0xC0, 0x3C, 0x78, 0x60, 0xB6, 0x13, 0x20, 0x76, 0x02, 0x36, 0xEB, 0x8E, 0xAF, 0x6A,
+    0x1D, 0x1D, 0x34, 0x65, 0x74, 0xA0, 0x8B, 0x75, 0xD0, 0x66, 0x3B, 0x81, 0x49, 0xD6, 0x43, 0x1F,
+    0x87, 0x00, 0xA3, 0x37, 0x09, 0x25, 0xAE, 0x5B, 0xE9, 0x36, 0xB4, 0xBC, 0x53, 0xE3, 0x08, 0x09,
+    0xF0, 0x09, 0x59, 0x39, 0x72, 0x0E, 0x9D, 0xFC, 0x1D, 0x68, 0x91, 0x4C, 0x05, 0x0C, 0xE3, 0x0E,
+    0x33, 0x04, 0x13, 0xE8, 0xBD, 0x4E, 0xE8, 0x54, 0xA9, 0xB3, 0x19, 0x46, 0xEC, 0x44, 0xEF, 0x4D,
+    0xC0, 0x24, 0x9D, 0xE8, 0x16, 0x55, 0xE8, 0x0A, 0xF3, 0xD9, 0x1B, 0xA5, 0x3A, 0x1A, 0x23, 0x12,
+    0xD1, 0xEF, 0xFE, 0xB7, 0xDD, 0x2C, 0xD4, 0x70, 0xBE, 0x42, 0xC4, 0x70, 0x74, 0x14, 0xCD, 0xCD,
+    0x33, 0xFE, 0x06, 0x17, 0xF3, 0x81, 0x8F, 0xDD, 0x72, 0x73, 0xEC, 0xAC, 0x37, 0x09, 0xEA, 0xD8,
+    0xAD, 0x68, 0x79, 0x47, 0x96, 0x1D, 0x6D, 0x1C, 0xC7, 0xEE, 0x9F, 0x55, 0xE0, 0x29, 0x9C, 0x9C,
+    0xD4, 0x0E, 0x52, 0x2A, 0xD8, 0x69, 0x0B, 0xD4, 0x38, 0xE9, 0xFA, 0xF8, 0x7A, 0x46, 0x1E, 0xE4,
+    0x1B, 0xE3, 0xBB, 0x9C, 0xC6, 0xD7, 0x62, 0x27, 0x06, 0x6F, 0x02, 0x26, 0xEA, 0x84, 0x49, 0xAA,
+    0x30, 0x2C, 0xCC, 0x22, 0x0B, 0xB6, 0x86, 0x5F, 0xE2, 0xD1, 0x49, 0x27, 0x54, 0x61, 0x83, 0x03,
+    0x83, 0xC7, 0x3A, 0xBD, 0x60, 0x3C, 0x1B, 0x95, 0x8C, 0x28, 0xE8, 0x85, 0x03, 0x08, 0xD6, 0xD1,
+    0x7B, 0xE3, 0xD1, 0xB9, 0x4D, 0x47, 0x61, 0x81, 0x07, 0xF2, 0xA8, 0x92, 0x06, 0x46, 0xA4, 0x60,
+    0x23, 0xDF, 0xAB, 0x5D, 0x90, 0x93, 0xCF, 0xBF, 0x7C, 0xA9, 0xDC, 0xAD, 0x07, 0xEC, 0x02, 0x18,
+    0x39, 0x86, 0x9F, 0x8C, 0x79, 0x27, 0xB8, 0x51, 0x72, 0x1A, 0x05, 0x7B, 0xA2, 0x1F, 0xEC, 0xE9,
+    0xAD, 0xF0, 0x1F, 0xD1, 0x1B, 0xE3, 0x3B, 0x73, 0x61, 0xDC, 0xA9, 0x06, 0x57, 0x1D, 0xAC, 0x15,
+    0x91, 0x32, 0x1E, 0x5F, 0x2A, 0xEF, 0x59, 0x15, 0x44, 0xE7, 0x23, 0x10, 0xBC, 0x02, 0x31, 0xD2,
+    0x89, 0xE1, 0xB9, 0x01, 0x77, 0x2E, 0x3F, 0xDA, 0x5D, 0x03, 0x30, 0x97, 0x74, 0xD2, 0x89, 0xDA,
+    0x7A, 0xDE, 0xD3, 0xB1, 0xC0, 0x39, 0x23, 0xB0, 0x71, 0x00, 0x56, 0x36, 0xA0, 0x54, 0x74, 0x5E,
+    0x7D, 0xA8, 0x2A, 0xA0, 0x97, 0xEA, 0x4B, 0xF5, 0x02, 0x6D, 0xAA, 0x90, 0xB0, 0x7A, 0x84, 0x2E,
+    0x81, 0x09, 0x26, 0xEE, 0xB1, 0x50, 0x1D, 0x76, 0x06, 0xDF, 0x7B, 0xB0, 0x53, 0xF5, 0xAC, 0x76,
+    0x02, 0x8B, 0x75, 0x7B, 0xC8, 0xC0, 0xB6, 0x9B, 0x77, 0x3B, 0xD1, 0x14, 0x06, 0x4F, 0xBB, 0xD0,
+    0x27, 0x86, 0x84, 0x91, 0xEF, 0x8A, 0x47, 0x57, 0xCE, 0x63, 0x94, 0x5F, 0xEC, 0xBA, 0xC4, 0x39,
+    0x30, 0x7C, 0x2D, 0x81, 0x5E, 0x46, 0x60, 0xD6, 0x09, 0xFA, 0x60, 0x41, 0x17, 0xBD, 0xC0, 0xE8,
+    0xAC, 0xC3, 0x24, 0xBD, 0xA0, 0xD6, 0x1A, 0x2A, 0x34, 0xB9, 0xEA, 0x04, 0x1B, 0xAA, 0x54, 0x52,
+    0x5C, 0x67, 0x28, 0x8C, 0x60, 0xBC, 0x89, 0xB0, 0xAA, 0x02, 0x26, 0x58, 0x07, 0x17, 0xB5, 0x2B,
+    0x2B, 0x70, 0xDE, 0x7B, 0x68, 0x9F, 0x2E, 0xC0, 0x38, 0x02, 0xBA, 0x86, 0xAE, 0x05, 0xD0, 0x02,
+    0x35, 0x68, 0xDC, 0x57, 0xF2, 0x0A, 0x26, 0xA0, 0xCA, 0x0A, 0x43, 0x40, 0x97, 0x15, 0x6C, 0x40,
+    0x2F, 0x2B, 0xCC, 0x91, 0x2E, 0xAD, 0x20, 0x11, 0x13, 0x56, 0x9A, 0xF7, 0x22, 0xBD, 0x3F, 0xA0,
+    0x7F, 0x13, 0xB1, 0xD3, 0x81, 0xF6, 0x69, 0x64, 0xA4, 0xBA, 0x99, 0x8D, 0x03, 0xFD, 0x57, 0x13,
+    0x85, 0x03, 0x56, 0xA7, 0x26, 0x73, 0xE0, 0x5C, 0x27, 0x9D, 0x38, 0x67, 0xD5, 0xA9, 0x4B, 0x9C,
+    0x53, 0x74, 0x32, 0x81, 0xB1, 0x59, 0x74, 0xEA, 0x3D, 0xA3, 0x4E, 0x3A, 0x59, 0xC7, 0xD8, 0x85,
+    0x26, 0x59, 0x18, 0x8D, 0x6F, 0xD2, 0x01, 0xEC, 0x30, 0x35, 0xA9, 0x80, 0xB5, 0x34, 0xBF, 0xCD,
+    0x60, 0xCF, 0x69, 0x7E, 0x97, 0xC0, 0x3E, 0x41, 0xFD, 0x2E, 0x82, 0xCD, 0x35, 0x12, 0xB7, 0x09,
+    0x25, 0x1E, 0x6C, 0xAC, 0x2C, 0x82, 0x0D, 0x55, 0x91, 0xAD, 0xDF, 0x55, 0xA6, 0x3A, 0xE0, 0x1A,
+    0x16, 0xED, 0x0E, 0xBD, 0x8B, 0xF4, 0x01, 0xCA, 0x0E, 0xCE, 0x2A, 0x26, 0xE8, 0x12, 0x95, 0xCD,
+    0x82, 0xE1, 0x6B, 0x0B, 0xD0, 0xFE, 0x66, 0x01, 0x90, 0x0C, 0xC7, 0xB4, 0x4A, 0x85, 0xB0, 0x8D,
+    0xC0, 0x91, 0x07, 0xD8, 0x4F, 0x6F, 0x16, 0x60, 0x36, 0x81, 0x4A, 0x14, 0x83, 0x75, 0x16, 0xB0,
+    0x53, 0x8D, 0x49, 0x9A, 0x02, 0xBD, 0xC7, 0x42, 0x1F, 0x30, 0x11, 0x13, 0x69, 0x0A, 0x26, 0x81,
+    0xA5, 0x4B, 0x60, 0x22, 0xE7, 0xA0, 0x8A, 0x05, 0x9D, 0xAD, 0xA3, 0x4B, 0xC3, 0x54, 0x89, 0x66,
+    0x3B, 0x19, 0xCF, 0x8C, 0x09, 0x6A, 0xAD, 0x90, 0xA5, 0x8D, 0x5D, 0x42, 0xA7, 0xDE, 0xA3, 0x93,
+    0x9D, 0x68, 0x96, 0x19, 0xD4, 0xB3, 0x02, 0xC8, 0x72, 0x64, 0x3F, 0x67, 0x7F, 0x0C, 0xC2, 0x5E,
+    0x18, 0x05, 0x94, 0x23, 0x79, 0x79, 0xB9, 0x88, 0xAA, 0xF5, 0x6E, 0x45, 0x64, 0x61, 0x10, 0x91,
+    0x80, 0x88, 0xD4, 0x70, 0x2D, 0xDF, 0x0C, 0xE5, 0x3C, 0xD0, 0xAC, 0x1C, 0xE3, 0xC4, 0x6A, 0x60,
+    0xAA, 0xD5, 0x9C, 0x2F, 0xB1, 0xFD, 0x15, 0xDC, 0x6F, 0xAF, 0xDC, 0x11, 0x4E, 0xF2, 0xD4, 0x3B,
+    0xEA, 0x67, 0x5C, 0x89, 0x1C, 0xF3, 0x89, 0x9F, 0x41, 0x44, 0x64, 0x6A, 0x45, 0x64, 0xA5, 0xE6,
+    0xF7, 0x3A, 0x89, 0xD8, 0xCA, 0x19, 0xB4, 0xA9, 0xB2, 0xAB, 0x17, 0xD5, 0x00, 0x1C, 0x01, 0xD5,
+    0x25, 0x00, 0xA3, 0x54, 0x9A, 0x76, 0xB8, 0x0E, 0xC0, 0xCE, 0xA1, 0xD9, 0x01, 0xD8, 0x0D, 0x94,
+    0x56, 0xF6, 0x8B, 0xA6, 0x8A, 0xD2, 0x64, 0xC1, 0x88, 0xC7, 0x0A, 0x3C, 0xA1, 0x70, 0xC1, 0x39,
+    0xE7, 0x58, 0x2C, 0x96, 0xC1, 0x0D, 0xAE, 0x9F, 0xFA, 0xC9, 0x78, 0xE3, 0x8D, 0xEF, 0x42, 0x17,
+    0xDA, 0xA8, 0x53, 0xFD, 0x69, 0x16, 0x95, 0x55, 0xA6, 0x50, 0x68, 0xAE, 0x3C, 0xE2, 0x05, 0x1F,
+    0x74, 0x71, 0x0D, 0x0E, 0xAA, 0xBC, 0x63, 0xCC, 0x5D, 0xFA, 0x1D, 0x63, 0x5E, 0xE9, 0xE2, 0xF9,
+    0x0B, 0xBB, 0x58, 0xD0, 0x92, 0xE8, 0xC5, 0xD7, 0x6C, 0x04, 0xCB, 0x29, 0x11, 0xB0, 0x1D, 0x13,
+    0x78, 0xDD, 0x8F, 0x26, 0x30, 0x7F, 0xE9, 0x61, 0xD0, 0x11, 0xEE, 0x36, 0x09, 0x9E, 0x90, 0x21,
+    0xF3, 0x84, 0x26, 0x71, 0x17, 0x9D, 0x18, 0x68, 0x03, 0x66, 0x32, 0x9E, 0xCE, 0xF7, 0x0E, 0x1D,
+    0x2D, 0x34, 0xCB, 0x39, 0x50, 0x3E, 0xF9, 0xF8, 0xF1, 0x63, 0x2B, 0x22, 0xA3, 0xC8, 0xF6, 0x45,
+    0x56, 0x55, 0x9A, 0x45, 0x27, 0x1D, 0xD4, 0x0E, 0x44, 0xB4, 0xC4, 0xBB, 0xF4, 0x52, 0x2E, 0x18,
+    0xDF, 0xBE, 0x28, 0x4A, 0xE8, 0x8B, 0x2E, 0x98, 0xDC, 0x2E, 0xB4, 0x8B, 0x89, 0xB4, 0xA9, 0x0F,
+    0xB4, 0x69, 0xF0, 0x74, 0xC9, 0x4E, 0x98, 0x68, 0x5D, 0x35, 0x5B, 0xBD, 0xB7, 0x60, 0xBD, 0x85,
+    0x71, 0xB2, 0x20, 0x93, 0x75, 0x8D, 0x38, 0xEB, 0x3B, 0xA1, 0xFF, 0xED, 0x6C, 0x31, 0x52, 0xEE,
+    0xD2, 0x48, 0x78, 0x65, 0x4F, 0xA1, 0xDD, 0x9E, 0x76, 0x7B, 0x5F, 0x29, 0xCF, 0x23, 0xA1, 0x5C,
+    0xF9, 0xAC, 0x74, 0xF4, 0x28, 0x07, 0xEE, 0xA3, 0x97, 0x61, 0xC5, 0xBC, 0x25, 0x2B, 0x76, 0xFC,
+    0x5C, 0x51, 0x12, 0xF4, 0xD2, 0xAD, 0x74, 0xD1, 0x46, 0x06, 0x2F, 0x30, 0xB7, 0x0B, 0x4D, 0x19,
+    0x3C, 0x5D, 0x3A, 0x80, 0xFD, 0xEA, 0x02, 0xAB, 0xF1, 0xE8, 0x34, 0xC2, 0xF0, 0x83, 0x02, 0x9B,
+    0x49, 0x74, 0xC9, 0x06, 0xC6, 0x49, 0x7C, 0x5B, 0xDA, 0x5F, 0xBD, 0x3D, 0xFB, 0xC1, 0x48, 0x21,
+    0x1B, 0x99, 0x8E, 0x64, 0xDC, 0x9D, 0x7B, 0x30, 0x8B, 0x57, 0x22, 0xA9, 0x91, 0x6F, 0x7C, 0x4F,
+    0xC9, 0xAE, 0xD6, 0xF3, 0x2E, 0xD8, 0xD5, 0xF0, 0xE7, 0x14, 0x13, 0x19, 0xBF, 0x0B, 0xBB, 0xEE,
+    0x0B, 0xA4, 0x5B, 0x00, 0xF9, 0xC9, 0x05, 0x46, 0xC4, 0x55, 0xBA, 0x78, 0x67, 0x2E, 0x6F, 0x4F,
+    0xA7, 0x8C, 0x41, 0xEF, 0x4F, 0x46, 0x7B, 0xB8, 0xC2, 0xBE, 0x1C, 0x09, 0xB4, 0x3B, 0x1C, 0xC0,
+    0x6E, 0x5D, 0x60, 0x90, 0xB2, 0xD2, 0x6D, 0xAF, 0xFD, 0x8D, 0x57, 0x82, 0x29, 0x58, 0xCF, 0x3C,
+    0x75, 0x89, 0x76, 0x61, 0x83, 0x91, 0x3E, 0xD0, 0xA6, 0xA6, 0xC0, 0x8C, 0x9D, 0xE8, 0x62, 0xCD,
+    0x73, 0x5A, 0xB7, 0x03, 0x9A, 0x82, 0x85, 0x71, 0xD2, 0x09, 0x93, 0xB1, 0xAE, 0x11, 0xA7, 0x0B,
+    0x7F, 0x9D, 0xEA, 0x7C, 0x20, 0xF2, 0x66, 0xA4, 0x91, 0xF0, 0xF0, 0x44, 0x47, 0xDE, 0x71, 0x30,
+    0x6F, 0x28, 0x91, 0xA4, 0xE4, 0x73, 0xAB, 0xDA, 0xB0, 0xD3, 0x46, 0x17, 0x47, 0xF4, 0x62, 0x9D,
+    0x2A, 0xBD, 0x6F, 0xB6, 0xEE, 0xB7, 0x6F, 0x6C, 0x5A, 0x64, 0x45, 0xE4, 0x17, 0xD8, 0xFB, 0x37,
+    0x87, 0x60, 0x82, 0x76, 0xE1, 0xCF, 0x90, 0x9F, 0xCC, 0x7B, 0xFE, 0xF3, 0x72, 0x08, 0xD4, 0x63,
+    0x07, 0xC8, 0x0A, 0x58, 0xF1, 0xD0, 0x2D, 0x2F, 0x1D, 0x0D, 0x5A, 0x1D, 0x91, 0x7C, 0xC2, 0xA2,
+    0xD5, 0x9A, 0x49, 0xA5, 0xFB, 0x13, 0xDC, 0xD9, 0xCE, 0x8E, 0x68, 0xE3, 0x0F, 0x1A, 0xC2, 0x1D,
+    0x71, 0x98, 0x78, 0x32, 0x99, 0xC6, 0x1F, 0x55, 0xED, 0x05, 0x37, 0x8C, 0x47, 0x57, 0x73, 0xF5,
+    0x86, 0xE6, 0xC4, 0x9E, 0x69, 0x49, 0x27, 0xCF, 0xBB, 0xD5, 0x19, 0xBD, 0xE5, 0x80, 0x71, 0xD3,
+    0x91, 0x59, 0xFE, 0x7E, 0x61, 0x7E, 0xFB, 0xA2, 0x30, 0x7A, 0x2D, 0x75, 0x9A, 0x06, 0x4F, 0x1F,
+    0x4C, 0xA4, 0x4D, 0xED, 0x82, 0x2A, 0x75, 0x96, 0x36, 0xB0, 0x93, 0x75, 0x98, 0x60, 0x42, 0x45,
+    0x2E, 0xBA, 0x50, 0x50, 0x1B, 0x16, 0x64, 0x32, 0x01, 0x09, 0xBA, 0xF0, 0x5E, 0x62, 0xFC, 0xE9,
+    0x5A, 0x30, 0x52, 0x0E, 0x30, 0x2F, 0xD6, 0xA1, 0xEE, 0x5D, 0xE2, 0xF3, 0x2B, 0x29, 0xAB, 0x19,
+    0xFD, 0x88, 0xD9, 0x55, 0x82, 0xD2, 0x8A, 0x38, 0xD4, 0xFC, 0xEC, 0x39, 0xCB, 0x2B, 0xFE, 0xDE,
+    0xE5, 0xB5, 0x61, 0xDE, 0x12, 0xC1, 0x8E, 0x9F, 0x5B, 0x95, 0x04, 0x9D, 0xBB, 0x15, 0x13, 0x6D,
+    0xC4, 0x4E, 0x02, 0x6B, 0xBB, 0xA0, 0x97, 0xC1, 0xD3, 0xFB, 0x03, 0xCC, 0x7A, 0xA1, 0xC9, 0xC6,
+    0xD7, 0x34, 0x89, 0x6D, 0x72, 0x4D, 0xCA, 0x76, 0xC9, 0x3A, 0xEC, 0xB4, 0x27, 0x3D, 0x74, 0x1A,
+    0x26, 0x7A, 0xBF, 0xC2, 0x01, 0x6E, 0x3B, 0x55, 0x2A, 0x04, 0xBA, 0xCC, 0x34, 0x6C, 0x98, 0x40,
+    0xA9, 0x3C, 0xAD, 0x75, 0x3A, 0x31, 0xD2, 0xA5, 0xCA, 0xB5, 0x1C, 0x5B, 0x27, 0xBD, 0x60, 0x2B,
+    0xD9, 0x52, 0xE7, 0xFD, 0x0B, 0x3B, 0xC9, 0xBE, 0x33, 0x29, 0xDC, 0xBB, 0x9E, 0x0C, 0xA8, 0xEC,
+    0xD2, 0x15, 0x26, 0xE5, 0x06, 0x8B, 0x72, 0x64, 0x52, 0x6E, 0x12, 0x32, 0xF9, 0xC5, 0x84, 0xCC,
+    0xCD, 0x47, 0x09, 0xCC, 0x6B, 0x4D, 0x16, 0xCC, 0x8F, 0xFE, 0x1F, 0xC6, 0xB8, 0x12, 0xF4, 0xDE,
+    0xF8, 0xA6, 0x30, 0x32, 0x78, 0x55, 0x9A, 0x42, 0x17, 0x07, 0x8F, 0xFD, 0x54, 0x81, 0x32, 0x78,
+    0xDA, 0x5F, 0x17, 0x18, 0xDE, 0x08, 0x20, 0x32, 0x55, 0x5E, 0xC5, 0x2C, 0x2B, 0x8C, 0x4D, 0xA1,
+    0xC9, 0x7A, 0xC1, 0x84, 0x2E, 0x61, 0x9D, 0x09, 0x14, 0xAC, 0x6F, 0x13, 0xA3, 0x1B, 0x26, 0x36,
+    0x56, 0x54, 0x81, 0xDB, 0x53, 0x1D, 0xB7, 0x72, 0x73, 0xDC, 0x56, 0x7A, 0xAF, 0x0A, 0xC3, 0xA9,
+    0x75, 0xA6, 0x8B, 0xAC, 0x95, 0xCA, 0xAA, 0xAD, 0xFB, 0xF0, 0xC7, 0xAA, 0x50, 0xDC, 0x47, 0xDD,
+    0xC7, 0x78, 0x59, 0x1A, 0x49, 0x94, 0x51, 0xBC, 0x88, 0x37, 0xDF, 0xFC, 0x4F, 0xAB, 0xFD, 0xCF,
+    0xAB, 0x92, 0xD0, 0xFD, 0xCA, 0x9B, 0x38, 0x24, 0xC6, 0xC4, 0x41, 0xAF, 0xB4, 0x85, 0x2E, 0x5A,
+    0xCF, 0xE8, 0xD8, 0xDA, 0x85, 0x2E, 0x61, 0xC2, 0x0C, 0x1B, 0x94, 0x9A, 0x29, 0xEF, 0xFD, 0x5A,
+    0xB3, 0xE1, 0x35, 0x65, 0x6E, 0xBF, 0xBC, 0x67, 0xC6, 0xF7, 0xC4, 0xB9, 0xCE, 0x35, 0x45, 0x6E,
+    0x1D, 0x23, 0x1C, 0x74, 0xAA, 0x8F, 0x18, 0x6F, 0x3E, 0x82, 0xB2, 0x2F, 0xC5, 0x2F, 0x3A, 0x6C,
+    0x2B, 0x09, 0xDB, 0x4B, 0x61, 0x1C, 0xFF, 0xCB, 0xCA, 0x9C, 0xD9, 0x90, 0xC8, 0x86, 0x4C, 0x6C,
+    0x08, 0x6C, 0x6A, 0x83, 0xB5, 0x29, 0xA8, 0xA2, 0x0B, 0x4D, 0xD1, 0x19, 0x9D, 0xDB, 0xA5, 0x46,
+    0x5F, 0xED, 0xD2, 0x25, 0xDA, 0x64, 0x62, 0x65, 0x9B, 0x4D, 0xEC, 0x3D, 0x26, 0x0C, 0x9E, 0xDE,
+    0x5B, 0xCF, 0x50, 0xD3, 0x7E, 0xD5, 0x15, 0x76, 0x12, 0x69, 0x44, 0x12, 0xC3, 0xB3, 0x07, 0x49,
+    0x6D, 0xF4, 0xD1, 0x44, 0x06, 0x3F, 0x83, 0xD5, 0x0B, 0xAC, 0xBD, 0x47, 0x2F, 0x07, 0x30, 0x3F,
+    0x5E, 0xC0, 0x9A, 0x50, 0xD1, 0x5F, 0x97, 0x0A, 0xD8, 0xAF, 0x26, 0x28, 0x26, 0xEC, 0xA3, 0xC3,
+    0x38, 0x75, 0x19, 0xF9, 0xA5, 0x4C, 0x88, 0x64, 0x18, 0x37, 0x4E, 0x39, 0x9E, 0x5B, 0x0E, 0x9D,
+    0x86, 0x15, 0xCA, 0x28, 0x81, 0xBB, 0xE3, 0xE7, 0x0A, 0xFD, 0x5A, 0x09, 0xD1, 0x2E, 0xEA, 0x8D,
+    0xA6, 0x20, 0x30, 0x33, 0xBA, 0x1A, 0xC6, 0x74, 0xA9, 0x8B, 0xE8, 0x5C, 0x4D, 0x7D, 0x01, 0xEB,
+    0x46, 0x18, 0xFC, 0xE0, 0x31, 0xD1, 0x24, 0xBA, 0xA4, 0x57, 0xDA, 0x8C, 0xF8, 0xB6, 0x70, 0x7E,
+    0x78, 0xAD, 0x30, 0x7C, 0x5D, 0x56, 0x4C, 0x90, 0x8C, 0x5E, 0x94, 0xDB, 0xED, 0xE7, 0x78, 0x32,
+    0x84, 0x26, 0x1C, 0xB5, 0xB5, 0x5A, 0xC7, 0xF9, 0x74, 0xE6, 0x2A, 0x22, 0x18, 0xA4, 0x3C, 0x64,
+    0xBE, 0x86, 0x08, 0xBA, 0x7F, 0x02, 0x22, 0xD0, 0xE2, 0xAC, 0x37, 0x33, 0xFD, 0x6F, 0xE7, 0xB1,
+    0x5A, 0xB7, 0x46, 0xC2, 0x0A, 0x77, 0x2E, 0x21, 0xED, 0x15, 0x5C, 0xFB, 0x9C, 0xA8, 0xB3, 0x8B,
+    0x35, 0x06, 0x2B, 0x7D, 0xA1, 0x8C, 0x99, 0x67, 0xDB, 0xB7, 0x94, 0x44, 0x1A, 0x71, 0xE8, 0xAD,
+    0x1A, 0x87, 0x76, 0xA9, 0xD7, 0xBE, 0x8F, 0x5A, 0x9D, 0xEA, 0xF2, 0xBC, 0x49, 0xAD, 0xAE, 0xC7,
+    0x4C, 0xD4, 0x20, 0x0B, 0x22, 0x45, 0x6F, 0x9F, 0x2D, 0x35, 0xB0, 0xDC, 0x7F, 0x97, 0x5A, 0x61,
+    0xA1, 0xC4, 0xD7, 0x60, 0xBB, 0x93, 0x3D, 0x4B, 0x35, 0x84, 0xEA, 0x62, 0x4C, 0x04, 0x13, 0x1E,
+    0x31, 0xF8, 0xED, 0xB3, 0x32, 0x89, 0x08, 0x83, 0x2C, 0x70, 0x56, 0x93, 0x7B, 0x3A, 0xD0, 0xD4,
+    0x92, 0xA3, 0x8D, 0xDB, 0x22, 0x4F, 0x45, 0x96, 0xD7, 0x7E, 0x7B, 0xFF, 0x58, 0x72, 0xE4, 0xF6,
+    0x9A, 0xA7, 0xE6, 0xE6, 0xFB, 0x7C, 0x7A, 0x1F, 0x69, 0xB6, 0x7F, 0xCF, 0x28, 0xB4, 0xE2, 0x4F,
+    0x36, 0xD4, 0x04, 0x4C, 0x1C, 0xC1, 0xBE, 0x5A, 0xEA, 0x4A, 0x69, 0x93, 0x75, 0x0C, 0x57, 0x2C,
+    0xB0, 0xC7, 0xF8, 0x0D, 0xC6, 0x6B, 0x06, 0x7B, 0x6C, 0x32, 0x4D, 0x31, 0x91, 0x3E, 0x5A, 0x87,
+    0x4C, 0x2B, 0xDD, 0xAA, 0x0B, 0xEF, 0xA5, 0xEE, 0xD9, 0x83, 0x1F, 0x79, 0x23, 0xF9, 0x2E, 0x46,
+    0x5E, 0x5D, 0xAE, 0x24, 0x28, 0x0B, 0x0C, 0x6F, 0x2E, 0xB0, 0x9A, 0xB0, 0x5B, 0x79, 0x77, 0xA0,
+    0x29, 0x4D, 0xC6, 0x84, 0x36, 0xB1, 0xD5, 0xEC, 0x97, 0xC5, 0x4E, 0x14, 0x55, 0x2A, 0x41, 0x6B,
+    0xC2, 0x08, 0xC3, 0xA7, 0x17, 0xB8, 0xE8, 0x3D, 0x4D, 0x5E, 0xA1, 0xFD, 0xDB, 0x04, 0xFD, 0xEC,
+    0x76, 0x1F, 0x2A, 0xE1, 0xD2, 0x8F, 0xD6, 0xA9, 0x36, 0x09, 0xF3, 0x37, 0x81, 0xD1, 0x33, 0x5B,
+    0xA7, 0x05, 0xBD, 0x5C, 0xD0, 0x3F, 0x61, 0xF8, 0xC1, 0xC2, 0x9A, 0x58, 0xBB, 0xA8, 0xFF, 0x36,
+    0xB4, 0x69, 0x98, 0x86, 0xDE, 0x59, 0x77, 0x20, 0x3F, 0x54, 0xA5, 0xC9, 0xDD, 0xF7, 0x17, 0x13,
+    0xDB, 0x68, 0xDB, 0x68, 0xE9, 0xBF, 0xB2, 0x98, 0xAF, 0x64, 0xCE, 0x8D, 0xBF, 0x6B, 0xBC, 0xCA,
+    0x0F, 0xC9, 0x07, 0xDA, 0xA7, 0x49, 0x3F, 0x4D, 0xF4, 0xDF, 0x74, 0xE6, 0x9B, 0x9E, 0xBB, 0x4F,
+    0xB8, 0x7B, 0x01, 0xEF, 0x05, 0xDE, 0x4B, 0x68, 0x41, 0x8B, 0xC3, 0x64, 0xCC, 0x1E, 0x59, 0x86,
+    0x93, 0x34, 0x19, 0x9D, 0x77, 0x32, 0x79, 0x65, 0xF0, 0x7B, 0x6C, 0x69, 0xD5, 0x0A, 0x4D, 0xB6,
+    0x0E, 0xCC, 0x8F, 0xE2, 0x31, 0x6D, 0xBD, 0xC7, 0xE1, 0xFE, 0xC8, 0x36, 0x29, 0x89, 0x80, 0x9D,
+    0x01, 0xF3, 0x74, 0x81, 0xA6, 0x54, 0x5A, 0x79, 0xDD, 0xF3, 0x84, 0xED, 0x82, 0x85, 0x8D, 0x26,
+    0x63, 0x7D, 0x45, 0x19, 0xEC, 0x78, 0xA3, 0x39, 0x66, 0x27, 0x6B, 0x09, 0x5A, 0x35, 0x7F, 0x5D,
+    0xAC, 0x12, 0x60, 0x1D, 0x3A, 0x71, 0x60, 0x27, 0x02, 0x75, 0xAA, 0xAE, 0xAB, 0x92, 0xF7, 0x26,
+    0x82, 0xCA, 0xBD, 0x07, 0x95, 0xAD, 0x03, 0xF2, 0x08, 0x50, 0x6A, 0xB8, 0x58, 0x99, 0xBE, 0x05,
+    0x60, 0x4E, 0x27, 0x22, 0x69, 0xE7, 0xCB, 0x46, 0x4E, 0xC1, 0x5C, 0xB5, 0x00, 0x15, 0x1A, 0xD5,
+    0xC2, 0x8B, 0x21, 0x00, 0x7F, 0x2D, 0x8E, 0xEA, 0xFA, 0x6A, 0x62, 0xFC, 0x38, 0x4C, 0x22, 0x2B,
+    0x56, 0xC4, 0xAB, 0xB3, 0xCF, 0x95, 0xDD, 0x72, 0xF4, 0x61, 0x47, 0xC8, 0xDB, 0x11, 0x10, 0xA7,
+    0xBD, 0xBE, 0xC7, 0xBA, 0xBA, 0x50, 0xF4, 0xE9, 0x52, 0xBF, 0x07, 0x99, 0x1B, 0x60, 0x7F, 0x72,
+    0x76, 0xAF, 0x15, 0x91, 0x3D, 0x3B, 0x86, 0xFA, 0x1E, 0x8C, 0x91, 0x56, 0x26, 0x6C, 0x38, 0xC5,
+    0x5D, 0xC3, 0xFB, 0xE3, 0xAE, 0x3D, 0xA4, 0x3A, 0x40, 0x9F, 0x30, 0x02, 0x63, 0x40, 0xCD, 0x7B,
+    0x26, 0x65, 0x8F, 0xAE, 0x7E, 0x4F, 0x68, 0x99, 0xF6, 0xB7, 0xB9, 0xF6, 0x6C, 0x98, 0xF8, 0x97,
+    0x0F, 0xFF, 0x90, 0x03, 0xF4, 0xEB, 0xB5, 0xB6, 0x61, 0x5E, 0x6A, 0x04, 0xDD, 0x4F, 0xEF, 0x0B,
+    0x4B, 0x73, 0xAD, 0x67, 0xB8, 0x22, 0x75, 0x17, 0xC1, 0x3C, 0x83, 0x2E, 0xA3, 0x24, 0xD2, 0xBF,
+    0x0D, 0xEB, 0x1E, 0x52, 0x5E, 0x0A, 0xF4, 0xFE, 0xAE, 0xB5, 0x0B, 0xAD, 0x78, 0xFA, 0x02, 0xE7,
+    0x0E, 0xD4, 0x77, 0x80, 0x51, 0x1E, 0xA9, 0x9F, 0x89, 0x3C, 0x9B, 0x3F, 0xEF, 0x66, 0x29, 0xF7,
+    0xF8, 0x84, 0xEC, 0x36, 0x5B, 0x01, 0x2A, 0x69, 0xAF, 0x8A, 0x4E, 0xAA, 0xE8, 0x45, 0x15, 0x9D,
+    0x9B, 0xD2, 0xE4, 0x66, 0x6D, 0x8A, 0x5A, 0x9B, 0x82, 0x65, 0xA3, 0x8B, 0xC3, 0x44, 0xD1, 0x89,
+    0x61, 0x3A, 0x47, 0x27, 0xE3, 0xF7, 0x9A, 0x57, 0x8B, 0x9A, 0x6E, 0x3B, 0x9C, 0x82, 0xAC, 0x23,
+    0x96, 0x27, 0xB4, 0xD1, 0xD4, 0x4B, 0xFB, 0x69, 0x44, 0x2F, 0x26, 0x30, 0xAB, 0x82, 0x9D, 0x46,
+    0xAC, 0xB7, 0x7E, 0xF0, 0x76, 0xEA, 0xBD, 0x9D, 0x8C, 0xB7, 0x93, 0xF1, 0xC3, 0xD4, 0x86, 0x7E,
+    0xE2, 0x9E, 0x9A, 0x00, 0x3E, 0x3A, 0x5D, 0xD6, 0x02, 0x54, 0x2D, 0x3B, 0x70, 0x42, 0xF0, 0x64,
+    0x00, 0xDC, 0x8D, 0x9A, 0x8E, 0xEE, 0x52, 0x3F, 0xEB, 0xCA, 0xEA, 0x6B, 0xFA, 0x75, 0x01, 0xDA,
+    0xBF, 0x8D, 0x80, 0xED, 0x27, 0x68, 0x8A, 0x05, 0x4C, 0x28, 0x47, 0xFA, 0x4D, 0x27, 0xE3, 0xF7,
+    0x8A, 0x30, 0x55, 0x58, 0xC1, 0xC4, 0x26, 0x53, 0x81, 0x8D, 0x5E, 0xCF, 0x1E, 0xF8, 0x9A, 0xBE,
+    0x47, 0x44, 0x0A, 0xDD, 0xBB, 0x8F, 0xBF, 0x9B, 0x6A, 0x39, 0x68, 0x53, 0xA8, 0xB0, 0x8A, 0x03,
+    0x33, 0x15, 0x6B, 0xD1, 0x56, 0x0E, 0xFA, 0xFB, 0x2B, 0x30, 0x9A, 0x74, 0x14, 0x59, 0x7D, 0xE7,
+    0x92, 0x42, 0xAA, 0x72, 0xF6, 0xFE, 0x14, 0x45, 0xEC, 0xFD, 0xB9, 0x77, 0xB3, 0x48, 0xA5, 0xE2,
+    0x96, 0x4A, 0x44, 0x9B, 0x72, 0xD9, 0x23, 0x7B, 0x01, 0x70, 0x7E, 0x0E, 0x50, 0xCE, 0x39, 0x76,
+    0xA9, 0x16, 0x37, 0x74, 0xA9, 0x46, 0x97, 0x96, 0xBD, 0x4F, 0x27, 0xAA, 0x72, 0x98, 0xF6, 0xBC,
+    0x66, 0xED, 0x54, 0xA5, 0xE5, 0x8D, 0x88, 0x78, 0x86, 0x77, 0x1E, 0xBF, 0xE1, 0xF7, 0x22, 0xD7,
+    0x99, 0x8A, 0xFE, 0xE8, 0x62, 0x4D, 0x4F, 0xD5, 0x6E, 0xD5, 0x02, 0x87, 0x3E, 0x1C, 0xBB, 0x58,
+    0x59, 0xD7, 0x2F, 0x56, 0x0E, 0x7D, 0x02, 0xB4, 0x78, 0xC0, 0xFC, 0x2C, 0x02, 0xB6, 0x59, 0xA8,
+    0xB4, 0x02, 0xDC, 0xBB, 0x5A, 0x8F, 0xFC, 0x21, 0xE9, 0xD7, 0x2D, 0x5E, 0x06, 0x06, 0x57, 0xD8,
+    0xDD, 0x24, 0x96, 0x0C, 0xBC, 0xC4, 0xCB, 0xCF, 0x2D, 0x75, 0xFA, 0x10, 0xCC, 0xD4, 0x9F, 0x6A,
+    0xD5, 0xC7, 0x7F, 0x77, 0x80, 0xE1, 0x14, 0x9B, 0x7E, 0xA2, 0x3A, 0x0F, 0x4E, 0xA5, 0xF8, 0xE3,
+    0x49, 0xB7, 0x6C, 0x75, 0x20, 0x1F, 0x9F, 0xAE, 0x27, 0xA3, 0x96, 0x93, 0x61, 0x78, 0x05, 0xE0,
+    0xA5, 0xEB, 0x69, 0xA8, 0x3F, 0x89, 0x92, 0x0D, 0x50, 0xDF, 0x3E, 0x15, 0xC3, 0xC6, 0xE3, 0x55,
+    0xE7, 0x54, 0x4B, 0x7F, 0xC3, 0x94, 0xFD, 0xC9, 0xC8, 0xFC, 0x98, 0xBD, 0x3A, 0xAF, 0x15, 0x0F,
+    0xFD, 0x0F, 0x03, 0x8C, 0x3A, 0xA1, 0x32, 0x19, 0xDC, 0xB5, 0xA5, 0xF0, 0xA7, 0x22, 0xF3, 0x4B,
+    0xBC, 0x0C, 0x96, 0x02, 0x56, 0x15, 0xB0, 0x2A, 0xDF, 0x50, 0x88, 0x3F, 0x29, 0x71, 0x9B, 0x6F,
+    0x5F, 0x2D, 0xBE, 0xD8, 0xCB, 0xEE, 0x5B, 0x7F, 0x4D, 0x21, 0x3E, 0xD8, 0xB2, 0x90, 0x4F, 0x4E,
+    0x57, 0x91, 0xD5, 0x54, 0xE9, 0xE8, 0x66, 0xB9, 0xB9, 0xAC, 0x44, 0x3C, 0xBD, 0x14, 0x78, 0xF0,
+    0x6C, 0xBF, 0xD6, 0x84, 0x7D, 0x11, 0xF6, 0x7E, 0x5F, 0xC9, 0xD6, 0xED, 0x06, 0xC1, 0x1E, 0x07,
+    0xE7, 0xF0, 0xBE, 0xEB, 0xCA, 0x3E, 0x32, 0xCF, 0xB9, 0x2E, 0xEE, 0x5D, 0x7D, 0x10, 0xAB, 0x80,
+    0x9D, 0x6C, 0x00, 0x1F, 0x7D, 0x04, 0x5D, 0x81, 0x4E, 0x26, 0xBA, 0xDF, 0x24, 0xBA, 0x68, 0xE9,
+    0x82, 0x0E, 0xEA, 0xAA, 0x3E, 0x6A, 0x11, 0x94, 0x88, 0xE7, 0x13, 0x9B, 0x7B, 0x41, 0xBD, 0xCA,
+    0xFA, 0xC2, 0x46, 0x7E, 0x5F, 0x11, 0x4B, 0xBC, 0x64, 0x71, 0xD5, 0x3C, 0xD1, 0x8A, 0xD0, 0x88,
+    0x4C, 0x80, 0x53, 0x50, 0xDA, 0xC8, 0xD8, 0x64, 0xFA, 0xE9, 0x02, 0xDC, 0x0D, 0xBD, 0x33, 0x52,
+    0x68, 0x45, 0xEA, 0x98, 0xE9, 0xE7, 0x3E, 0x79, 0x79, 0x51, 0x63, 0xD9, 0x27, 0x6E, 0x78, 0x6E,
+    0xE3, 0xB4, 0xC3, 0xE3, 0xA5, 0x4E, 0x67, 0x2F, 0xE5, 0x38, 0x5A, 0xFC, 0x05, 0x1F, 0x01, 0xCC,
+    0xDA, 0x44, 0xD0, 0xB2, 0x3D, 0x01, 0x5E, 0x19, 0x64, 0x82, 0x6E, 0x1A, 0xE2, 0x5E, 0x84, 0x7B,
+    0x63, 0x69, 0x7C, 0xE8, 0x6A, 0x35, 0xBE, 0x7D, 0x19, 0x85, 0xEC, 0x58, 0xB1, 0x72, 0x10, 0x35,
+    0x40, 0xD2, 0xF1, 0xF9, 0x60, 0xF1, 0xC3, 0x51, 0xDB, 0x01, 0x7C, 0xFC, 0xD1, 0x29, 0x4A, 0xAC,
+    0x1D, 0xDE, 0x43, 0xAD, 0xC4, 0x71, 0x9F, 0xCE, 0xFB, 0xEB, 0xB0, 0x3F, 0x34, 0xBD, 0xBB, 0xFD,
+    0x3A, 0x50, 0xB7, 0x26, 0xD4, 0xE8, 0x9E, 0xF5, 0x1C, 0xD0, 0x69, 0x70, 0x60, 0xA6, 0xCE, 0xC3,
+    0xAD, 0x6B, 0x25, 0xCF, 0x1F, 0xAA, 0xDE, 0xDD, 0x53, 0x80, 0x5A, 0x3A, 0x7F, 0xAC, 0x61, 0x6C,
+    0x92, 0xF1, 0xBB, 0xAD, 0xE0, 0x79, 0x5E, 0xE9, 0xC3, 0xD1, 0xAF, 0xE6, 0x5B, 0x97, 0x98, 0x77,
+    0x8F, 0xC8, 0xEA, 0x06, 0xB7, 0x81, 0xCB, 0x75, 0x77, 0x73, 0xD2, 0x3E, 0x24, 0xF5, 0x19, 0x47,
+    0x27, 0xB8, 0xA3, 0xD6, 0x1D, 0xD8, 0xA7, 0xCB, 0x7E, 0xD9, 0x9B, 0x5B, 0x2C, 0x3F, 0x64, 0xBD,
+    0xDB, 0x23, 0xEB, 0x9A, 0xB8, 0x4F, 0x80, 0x7E, 0x56, 0x37, 0xE2, 0x3C, 0x04, 0x2C, 0x03, 0xF0,
+    0xB1, 0x9B, 0x06, 0xE5, 0xC3, 0xD3, 0x3B, 0x77, 0x0B, 0x68, 0xE3, 0xE0, 0xA0, 0x8B, 0xD6, 0x41,
+    0x17, 0x2C, 0xA0, 0x9E, 0x07, 0x02, 0x3F, 0x44, 0xFD, 0xFA, 0xE2, 0x29, 0xDA, 0xAA, 0xC4, 0xBB,
+    0x3F, 0x3A, 0x36, 0xB5, 0x70, 0xD5, 0x8B, 0x7F, 0xA0, 0x69, 0xF8, 0xDD, 0x7A, 0xF7, 0xA7, 0xE4,
+    0xD5, 0xE1, 0x18, 0xC4, 0xED, 0x5B, 0x71, 0xFE, 0xFF, 0x48, 0xD5, 0x7C, 0xFB, 0x18, 0x8A, 0xF7,
+    0xDB, 0xBE, 0x05, 0x50, 0x65, 0xE3, 0x69, 0xA3, 0x8E, 0xA8, 0x4B, 0x24, 0xF0, 0xC1, 0x4A, 0xF5,
+    0x32, 0x0E, 0x8A, 0x8E, 0xA8, 0xD2, 0x25, 0xC8, 0x6D, 0x80, 0x97, 0xAF, 0xBB, 0x81, 0x0F, 0x56,
+    0xA0, 0x3F, 0x56, 0xD1, 0x82, 0xFE, 0x5F, 0x75, 0x57, 0x35, 0xE5, 0x18, 0xFA, 0x64, 0xE0, 0x6E,
+    0xD5, 0xDF, 0x4E, 0x26, 0xD4, 0xE6, 0x8E, 0xF1, 0xB0, 0x75, 0x7B, 0xC4, 0x54, 0x76, 0x28, 0xA3,
+    0xAE, 0x46, 0x1A, 0x7F, 0xE4, 0x9A, 0x82, 0x4F, 0x4E, 0xFB, 0x5E, 0xD7, 0x53, 0xA8, 0x13, 0x6F,
+    0x08, 0xC0, 0x1D, 0x07, 0x43, 0xDD, 0xBE, 0x43, 0xBB, 0x7E, 0x7E, 0x51, 0x1B, 0x76, 0xB2, 0x53,
+    0x93, 0xDB, 0x84, 0x75, 0x2B, 0x6D, 0xEA, 0x7D, 0xB3, 0x35, 0xEB, 0x5F, 0xC9, 0x64, 0x45, 0x82,
+    0x16, 0x79, 0x84, 0xBD, 0x7F, 0xDC, 0xD2, 0x7C, 0x24, 0x44, 0xEC, 0x04, 0x6A, 0xA5, 0xC1, 0xAC,
+    0xAF, 0x25, 0xAC, 0xC8, 0xBE, 0x19, 0xF0, 0x0E, 0xC0, 0x47, 0x5F, 0xAF, 0xF1, 0x4C, 0x2B, 0x13,
+    0xED, 0xAF, 0x17, 0xDA, 0x68, 0x69, 0x83, 0x8E, 0x97, 0xF1, 0xF5, 0x1F, 0x77, 0x18, 0x2E, 0xC3,
+    0x96, 0x82, 0x99, 0x1E, 0xDE, 0x08, 0x5B, 0xCE, 0xA0, 0x91, 0x4C, 0x2B, 0xE2, 0xDB, 0xF5, 0xF3,
+    0x4B, 0x9B, 0xD9, 0x74, 0x66, 0xF8, 0x72, 0xC1, 0x84, 0x95, 0x36, 0x8D, 0x74, 0x79, 0xF8, 0xE9,
+    0x9C, 0x8D, 0xC8, 0xA2, 0x45, 0x1E, 0xB1, 0xDE, 0xBB, 0xA2, 0x28, 0xC7, 0x38, 0xB2, 0x0F, 0xFC,
+    0x0B, 0x2D, 0x9F, 0x2D, 0x58, 0x11, 0x1A, 0xD9, 0xEA, 0x3E, 0xC8, 0xDB, 0xAF, 0xB3, 0xD2, 0xFB,
+    0x66, 0xC1, 0xA2, 0xC3, 0xDE, 0x5B, 0x3B, 0x99, 0xA0, 0x93, 0x2A, 0x1C, 0xB0, 0xCE, 0xF8, 0x36,
+    0x35, 0x57, 0xFE, 0xCD, 0x6C, 0x97, 0xFF, 0xAE, 0xC7, 0x9C, 0xAE, 0xC7, 0x7A, 0x06, 0x4F, 0x3F,
+    0x61, 0xA6, 0x2B, 0x56, 0xC7, 0x4E, 0xFB, 0x96, 0xFD, 0x3F, 0x24, 0x5F, 0xB6, 0xDD, 0x78, 0xBF,
+    0xEE, 0x44, 0xD3, 0x18, 0x94, 0x24, 0xFD, 0x7F, 0x73, 0xEF, 0x9F, 0x9C, 0x63, 0x5F, 0x3E, 0x39,
+    0xC6, 0x17, 0x6C, 0xD7, 0xEE, 0x6E, 0x6C, 0xF3, 0x3E, 0x6E, 0x24, 0x38, 0x6D, 0xF3, 0x5E, 0x41,
+    0xF1, 0x92, 0x4E, 0xC6, 0xAF, 0x6D, 0xB2, 0x2A, 0x5F, 0x77, 0x4C, 0xCF, 0x91, 0xC2, 0x42, 0xEF,
+    0xE9, 0x6E, 0xBE, 0x8F, 0xE8, 0x9B, 0xEF, 0x97, 0xBA, 0x23, 0xB0, 0x71, 0x35, 0xDC, 0xEB, 0xE4,
+    0xDD, 0x84, 0xFE, 0x1F, 0x92, 0x69, 0x62, 0x97, 0xAF, 0x45, 0x7A, 0xEA, 0x3B, 0xD4, 0x54, 0xB8,
+    0x79, 0x4B, 0x84, 0xF6, 0x77, 0xCF, 0xE6, 0xD0, 0x48, 0xD4, 0xB9, 0xE6, 0xC2, 0x6D, 0xC4, 0x4E,
+    0x26, 0x61, 0x62, 0x9B, 0xD1, 0x4B, 0x53, 0x50, 0x7B, 0x1E, 0xD9, 0x4E, 0xD8, 0xA9, 0x0F, 0x98,
+    0xD8, 0x26, 0xDA, 0xFD, 0xCC, 0x06, 0x33, 0xD6, 0x61, 0xA7, 0xDE, 0xD7, 0x52, 0x83, 0x36, 0xE9,
+    0x42, 0x53, 0xD8, 0xAA, 0x41, 0x39, 0x11, 0x5F, 0x57, 0x08, 0x12, 0x7F, 0x0C, 0x5D, 0x5E, 0xBA,
+    0x6A, 0xFC, 0x3E, 0x98, 0xAC, 0xF9, 0xC7, 0x1F, 0xBD, 0x6F, 0x1F, 0x74, 0xDA, 0x2D, 0xD4, 0x25,
+    0x05, 0xFF, 0x81, 0x89, 0x73, 0xFB, 0xF5, 0x7D, 0x43, 0xA9, 0x16, 0x0F, 0xF6, 0xF3, 0x53, 0x8D,
+    0x7D, 0xEE, 0x32, 0x80, 0x3B, 0xC1, 0xCC, 0x0F, 0x4C, 0x9C, 0x7B, 0x6A, 0x87, 0x4C, 0x35, 0x39,
+    0xAC, 0xE3, 0xCD, 0x60, 0xE5, 0x96, 0xAB, 0x26, 0x81, 0x59, 0x0A, 0xDD, 0xF6, 0x5A, 0x61, 0x9C,
+    0xDA, 0xAC, 0x33, 0x5D, 0x4D, 0x1B, 0xAF, 0x60, 0x3F, 0x93, 0x60, 0x1D, 0xA6, 0x5A, 0x40, 0x6C,
+    0xDE, 0x5C, 0xEA, 0x16, 0xFC, 0xA6, 0x58, 0x30, 0xB1, 0x54, 0x79, 0x9B, 0x6C, 0x12, 0xBD, 0xEF,
+    0x63, 0xB3, 0x61, 0x9F, 0xCD, 0x11, 0x2B, 0x1B, 0xF4, 0xA7, 0xA2, 0x3A, 0x75, 0x43, 0x6D, 0xC2,
+    0xF3, 0xD5, 0xE6, 0x83, 0x4B, 0x67, 0x5F, 0x57, 0x9B, 0xF9, 0x28, 0xD8, 0xDD, 0x9B, 0xE4, 0xC2,
+    0x07, 0x23, 0xCE, 0xED, 0xD7, 0x81, 0xF1, 0xA4, 0x36, 0x0F, 0x26, 0xDA, 0x34, 0xC0, 0x39, 0xF6,
+    0xAA, 0xDA, 0x7C, 0x60, 0xE2, 0x38, 0xB5, 0x27, 0x32, 0x5E, 0xA4, 0x36, 0xD5, 0x17, 0xEA, 0xDC,
+    0x5F, 0xAF, 0xFE, 0x0A, 0x74, 0xF1, 0x74, 0x57, 0x97, 0x6A, 0x55, 0x73, 0xAD, 0xFE, 0xD2, 0x09,
+    0xBD, 0xF4, 0xA7, 0xD2, 0xB1, 0x4C, 0x9B, 0x4D, 0xC0, 0x46, 0xEB, 0x1A, 0x71, 0xC2, 0xDD, 0xD2,
+    0x6C, 0xAF, 0xFD, 0x26, 0x69, 0xD9, 0xCC, 0xA4, 0x25, 0x3C, 0xBC, 0x99, 0x3E, 0xFB, 0x84, 0xD4,
+    0xEF, 0x1B, 0x10, 0x11, 0x91, 0xB5, 0x7E, 0xAD, 0x91, 0xAC, 0xF4, 0xB9, 0x62, 0x92, 0xD1, 0x1F,
+    0x37, 0x36, 0x9C, 0xBE, 0x91, 0xE4, 0xF8, 0xED, 0x22, 0xE3, 0x3E, 0xC7, 0x47, 0x16, 0x72, 0xDD,
+    0xC9, 0xB8, 0xB5, 0xE2, 0x19, 0xB5, 0x9D, 0x9D, 0x39, 0x3B, 0xD5, 0x5D, 0x94, 0xFB, 0x5F, 0xAC,
+    0x43, 0x3F, 0x3B, 0x3B, 0xDB, 0x13, 0xED, 0x30, 0xBA, 0xAA, 0x1D, 0xA3, 0xDB, 0xCB, 0x53, 0x5D,
+    0x25, 0x34, 0xAB, 0x4F, 0xE2, 0x94, 0xBE, 0x1F, 0xC2, 0xFE, 0x1D, 0x0F, 0xA9, 0x02, 0xFB, 0x6E,
+    0xDD, 0xB3, 0x27, 0xF2, 0x8E, 0xEC, 0xDF, 0x1A, 0x20, 0x22, 0xCB, 0xDE, 0x9D, 0x74, 0x85, 0x15,
+    0xBA, 0xE5, 0xF6, 0xBD, 0x29, 0x11, 0xA9, 0xE0, 0xA0, 0x97, 0x8D, 0xE1, 0xD9, 0x83, 0x5F, 0xCB,
+    0xE7, 0x8A, 0xDA, 0x30, 0xFF, 0x27, 0xE8, 0xC5, 0x44, 0xFA, 0xB5, 0xD6, 0x55, 0xD9, 0x58, 0xCD,
+    0x84, 0xD4, 0xAA, 0x02, 0x9D, 0x19, 0xC3, 0x01, 0xCC, 0xDB, 0x6F, 0x6C, 0x7A, 0xA9, 0x1B, 0x6E,
+    0x4D, 0xA8, 0x39, 0x19, 0x0B, 0xDD, 0x6F, 0x2B, 0x28, 0x3B, 0xA6, 0x8F, 0xA4, 0x6A, 0x52, 0x57,
+    0xAA, 0xEC, 0x63, 0x06, 0x46, 0xD7, 0xCA, 0xC2, 0x9F, 0x23, 0xBF, 0x94, 0x7F, 0xF7, 0xEC, 0xB5,
+    0x84, 0xC8, 0xD2, 0x8B, 0xF8, 0xBA, 0xD7, 0x3D, 0xC3, 0xAD, 0x1A, 0xBD, 0x7C, 0xF4, 0xF1, 0xE3,
+    0xC7, 0x7F, 0x29, 0x22, 0x4F, 0x45, 0x64, 0x39, 0x3B, 0x3B, 0xBB, 0xFF, 0xD1, 0xC7, 0xF5, 0xF8,
+    0xD6, 0x2C, 0xF5, 0x78, 0xBA, 0xFF, 0x95, 0x7F, 0x7B, 0x56, 0x8F, 0xFB, 0xBC, 0xC2, 0x13, 0x95,
+    0xF5, 0xD2, 0x26, 0x13, 0x06, 0x6F, 0xA7, 0xD9, 0x9D, 0xC1, 0xA6, 0x56, 0x5D, 0xF4, 0xD2, 0x45,
+    0xE3, 0xFB, 0xC9, 0xF2, 0x90, 0xFB, 0xF0, 0x0A, 0x4B, 0x93, 0x3A, 0xDF, 0x4F, 0xE7, 0xAC, 0x3A,
+    0xB5, 0x69, 0xF0, 0xD6, 0xAD, 0x4D, 0xE9, 0x92, 0x89, 0x76, 0x9A, 0x3F, 0x55, 0xD4, 0xFD, 0x5B,
+    0xF7, 0x60, 0xD3, 0x4B, 0xBB, 0x0C, 0xDE, 0xFA, 0x8D, 0xB5, 0x4D, 0x5D, 0xB4, 0x93, 0xA5, 0xA8,
+    0xDC, 0x05, 0xE3, 0x2D, 0x0F, 0x55, 0x52, 0xF7, 0x6E, 0x39, 0x6E, 0x3B, 0xEE, 0x71, 0xAB, 0x5B,
+    0x10, 0xFA, 0xA7, 0x2B, 0xA3, 0x37, 0x59, 0xDC, 0x90, 0xF4, 0x66, 0x7D, 0xBB, 0x20, 0x8D, 0xE3,
+    0x0B, 0xDC, 0xE2, 0x1F, 0x00, 0xD5, 0x9A, 0xBF, 0xB3, 0x25, 0xC7, 0x55, 0xC7, 0x3F, 0xDD, 0x8D,
+    0xDC, 0xD8, 0x13, 0xB4, 0x03, 0x2F, 0x45, 0x95, 0x82, 0x21, 0x76, 0xD2, 0x09, 0xA9, 0xD5, 0x5D,
+    0x28, 0x70, 0x40, 0x80, 0x02, 0x3D, 0x13, 0x6C, 0xA0, 0x84, 0x08, 0x82, 0xFD, 0x07, 0xEC, 0x9D,
+    0x31, 0x0E, 0x08, 0x9C, 0x38, 0x60, 0xED, 0x10, 0x02, 0x27, 0x5E, 0x05, 0xFA, 0x03, 0x2C, 0xDD,
+    0xE9, 0xB2, 0x02, 0x07, 0x0E, 0x18, 0xF3, 0xCB, 0x55, 0x10, 0xD0, 0x06, 0xA9, 0x28, 0xE4, 0xC0,
+    0xED, 0xD2, 0x08, 0xFA, 0x49, 0x3D, 0x73, 0x08, 0x7A, 0xEE, 0x7B, 0xBB, 0x8B, 0x4D, 0xD9, 0x05,
+    0x45, 0x99, 0x5B, 0xB5, 0xF7, 0xDE, 0x7D, 0x67, 0xA6, 0xA7, 0xBB, 0xCF, 0x39, 0xDF, 0xF3, 0x3D,
+    0xDF, 0xBE, 0xF0, 0x19, 0xFE, 0x12, 0xC2, 0xEF, 0x6D, 0x10, 0x5E, 0xDD, 0x20, 0x98, 0x02, 0xBF,
+    0x41, 0xE4, 0xFE, 0xE5, 0x44, 0x76, 0x46, 0x91, 0x86, 0x17, 0x69, 0x84, 0x19, 0x08, 0x11, 0x08,
+    0x00, 0x13, 0xC0, 0x05, 0xE0, 0x00, 0xD8, 0x01, 0x1A, 0xA0, 0xF6, 0x9B, 0x1B, 0xB4, 0x88, 0x60,
+    0x44, 0x04, 0x73, 0x7B, 0x73, 0x83, 0x2D, 0xC0, 0x50, 0x80, 0x21, 0x03, 0x6E, 0x05, 0x5C, 0x02,
+    0xC6, 0x04, 0xF8, 0x04, 0xCF, 0x8E, 0x2E, 0xB2, 0x31, 0x89, 0x14, 0x16, 0x91, 0x02, 0xA0, 0x1B,
+    0xC0, 0x58, 0x00, 0x24, 0x01, 0x56, 0x22, 0x10, 0xDE, 0x01, 0xD4, 0x6D, 0x05, 0xDC, 0xF7, 0x33,
+    0xB0, 0xB8, 0x04, 0x66, 0x0B, 0x80, 0x4F, 0x0D, 0x68, 0xA6, 0xC0, 0x90, 0xDD, 0x0A, 0x13, 0x21,
+    0x62, 0x2A, 0x17, 0x18, 0x93, 0xAE, 0x20, 0x37, 0x0F, 0x0B, 0x56, 0x44, 0x12, 0x41, 0x44, 0xD0,
+    0xC7, 0xD3, 0xA7, 0x0D, 0xB7, 0x62, 0x36, 0x16, 0x70, 0xAB, 0xD9, 0xC0, 0xCF, 0x3E, 0xC1, 0x85,
+    0x1D, 0x54, 0x73, 0x05, 0x6C, 0x99, 0x22, 0x8C, 0xEF, 0xB6, 0xBE, 0x0D, 0x4E, 0x44, 0xFA, 0x20,
+    0x5A, 0x44, 0x72, 0xDF, 0x8A, 0x10, 0xAF, 0xCB, 0xB3, 0x05, 0xD0, 0xF5, 0x6E, 0x7F, 0x9E, 0xB1,
+    0x88, 0x44, 0xB4, 0xC8, 0x0E, 0x22, 0xB2, 0x12, 0xE2, 0xD0, 0x18, 0x13, 0x53, 0x1C, 0x0A, 0x2E,
+    0xEB, 0x8A, 0x6E, 0xEC, 0x70, 0x21, 0x40, 0x98, 0xC7, 0x84, 0x5B, 0x87, 0xCC, 0x50, 0x4C, 0xC5,
+    0x56, 0x76, 0xC6, 0x46, 0x10, 0x69, 0x8C, 0x22, 0x95, 0x41, 0xE4, 0x1B, 0x80, 0x93, 0x7F, 0x03,
+    0x2B, 0x52, 0xD1, 0x22, 0x92, 0x38, 0x78, 0xD4, 0x08, 0x11, 0xC1, 0x25, 0xC6, 0xD5, 0x16, 0xCC,
+    0xA6, 0x2B, 0xEC, 0x1C, 0xE7, 0x86, 0x84, 0xD9, 0x25, 0x7C, 0xB2, 0x1F, 0xDD, 0x2C, 0x49, 0x8B,
+    0x48, 0x44, 0xE4, 0x80, 0xF0, 0xE4, 0xD1, 0xC6, 0x98, 0x98, 0xE6, 0xA1, 0x60, 0x4B, 0xBF, 0x67,
+    0x87, 0x30, 0x07, 0x70, 0x79, 0x4C, 0x98, 0x6D, 0xC8, 0xE8, 0x66, 0x2A, 0x4A, 0xD8, 0xD1, 0x42,
+    0x10, 0x91, 0x38, 0x8A, 0x1C, 0x0C, 0x22, 0xEF, 0xF5, 0xF0, 0x69, 0x77, 0xE1, 0x53, 0x7F, 0xE9,
+    0xF0, 0x69, 0xD7, 0x2D, 0x33, 0xDB, 0xF5, 0xED, 0x57, 0x0B, 0x9F, 0xE7, 0x47, 0x07, 0x8C, 0x88,
+    0xAC, 0xC0, 0x24, 0xB2, 0xF7, 0x79, 0x49, 0x02, 0xF6, 0x1E, 0x57, 0x63, 0xC2, 0xCF, 0xA0, 0x6B,
+    0x7F, 0x56, 0x88, 0x84, 0x08, 0xA6, 0xF4, 0xA7, 0x4E, 0x7D, 0xAC, 0x21, 0xF7, 0x47, 0xEF, 0x7D,
+    0xA6, 0x2E, 0xE1, 0x12, 0xA8, 0xDA, 0xA7, 0x1B, 0x22, 0x3E, 0x81, 0x29, 0x98, 0xDA, 0xEF, 0x09,
+    0x11, 0x5C, 0xC6, 0x94, 0xBE, 0xA0, 0x09, 0xF0, 0x33, 0x43, 0xEE, 0x6B, 0x39, 0xFA, 0xAA, 0xDD,
+    0xDA, 0x27, 0xDF, 0xC0, 0x6E, 0x30, 0x26, 0xD4, 0x01, 0xBA, 0x62, 0x45, 0x44, 0x44, 0x58, 0x44,
+    0x44, 0x24, 0x3B, 0x11, 0x11, 0x39, 0x68, 0x00, 0x6E, 0x75, 0x09, 0xA0, 0xA9, 0x9E, 0x14, 0xC9,
+    0xCF, 0x80, 0xAE, 0x66, 0xEB, 0x01, 0x16, 0x00, 0x4C, 0xF9, 0xB5, 0xC9, 0x5E, 0xB5, 0xA1, 0x37,
+    0x74, 0x85, 0x86, 0xD9, 0x18, 0x36, 0xD8, 0x31, 0x85, 0x71, 0x85, 0xC7, 0xD8, 0xC2, 0x34, 0x43,
+    0x60, 0xE8, 0xB9, 0xE3, 0x67, 0xB7, 0x9A, 0x06, 0xB8, 0xE4, 0x92, 0x2B, 0xC0, 0xB0, 0x8E, 0xC9,
+    0xF7, 0x5C, 0x1A, 0xD3, 0x12, 0x01, 0xB3, 0xF9, 0xAF, 0xEE, 0x00, 0xAA, 0x86, 0x2F, 0x56, 0x00,
+    0x8E, 0xE5, 0xAD, 0x0C, 0xC0, 0xE9, 0x5A, 0x7A, 0x2C, 0x03, 0xF6, 0xF6, 0x98, 0x66, 0x00, 0x97,
+    0xF7, 0x31, 0x01, 0x84, 0xD4, 0xDC, 0x0A, 0x20, 0xAA, 0x0D, 0x05, 0xD0, 0xED, 0xDC, 0xBD, 0x61,
+    0xEB, 0xE9, 0xC1, 0x98, 0x4D, 0x51, 0x0D, 0x98, 0x66, 0x53, 0xD8, 0x01, 0xC1, 0x16, 0x26, 0x30,
+    0x8D, 0x21, 0x13, 0x22, 0xAE, 0xE0, 0x56, 0xFC, 0x8C, 0x5F, 0x71, 0x89, 0x31, 0xB1, 0xCC, 0x8C,
+    0x09, 0x97, 0xCF, 0xA0, 0x53, 0x8B, 0xCC, 0x68, 0x91, 0x03, 0x26, 0x91, 0xCC, 0xA7, 0xB1, 0x3B,
+    0xC0, 0x34, 0x03, 0xAE, 0xDC, 0xA1, 0xDA, 0x3D, 0x62, 0xF8, 0x04, 0x8C, 0x2B, 0xEA, 0x66, 0x59,
+    0xD1, 0x22, 0x33, 0xC8, 0x01, 0x3C, 0xF8, 0x93, 0xCA, 0xD5, 0x6C, 0xEA, 0x9D, 0xF3, 0xC6, 0x7B,
+    0x80, 0xB9, 0x1F, 0x48, 0xF8, 0x23, 0x94, 0xCC, 0xE3, 0xC7, 0x6F, 0x4A, 0xB2, 0x22, 0x32, 0xB3,
+    0xF4, 0x31, 0x5E, 0xE3, 0x74, 0x5A, 0x98, 0x6D, 0x81, 0x90, 0x75, 0x03, 0xBF, 0x71, 0xC0, 0xB8,
+    0x13, 0x22, 0x4E, 0x70, 0x09, 0xF7, 0xD3, 0x64, 0x0B, 0xC3, 0x4F, 0xB2, 0x6E, 0xD8, 0x0F, 0x37,
+    0x0E, 0x4C, 0x69, 0x84, 0x68, 0xB6, 0x89, 0x31, 0xE9, 0xEA, 0x93, 0x2D, 0xAA, 0xB9, 0xAC, 0x2B,
+    0xCD, 0x6C, 0x1C, 0xEC, 0x34, 0x42, 0xBC, 0x30, 0x31, 0xA6, 0x05, 0x3F, 0x0F, 0x65, 0xC2, 0xAD,
+    0xBA, 0x86, 0x68, 0x36, 0xF6, 0x30, 0xAB, 0x46, 0xF0, 0x33, 0x0B, 0xE3, 0x3F, 0x25, 0xFC, 0x3C,
+    0xFC, 0x34, 0xE1, 0x56, 0x23, 0x2B, 0xA6, 0x20, 0x19, 0xD5, 0x08, 0x05, 0x16, 0xC6, 0x02, 0x61,
+    0x1E, 0xB6, 0x33, 0xBC, 0xF4, 0x37, 0xF8, 0x36, 0x50, 0xD9, 0x81, 0xC0, 0x02, 0x0C, 0x22, 0x00,
+    0x8B, 0x00, 0xA8, 0x6F, 0xF3, 0xFC, 0xEB, 0xFF, 0xCD, 0xD2, 0x5C, 0x42, 0x57, 0xC6, 0x84, 0x2B,
+    0xF8, 0x84, 0x4F, 0x84, 0x99, 0x25, 0x12, 0xA2, 0xDA, 0x21, 0x60, 0x2B, 0x4C, 0xB8, 0x0C, 0x17,
+    0x42, 0x82, 0x03, 0x01, 0x76, 0xDD, 0xA0, 0xC7, 0xAB, 0xDA, 0x1F, 0xAD, 0xA0, 0x45, 0x22, 0x18,
+    0x11, 0xC0, 0xDC, 0x4E, 0x73, 0xCF, 0x0F, 0x18, 0x8A, 0x5B, 0x61, 0xC8, 0x43, 0x01, 0xB7, 0xDA,
+    0x02, 0x2E, 0x99, 0x0A, 0x63, 0x52, 0x0D, 0x7C, 0xEA, 0x28, 0xCE, 0x72, 0x05, 0xBA, 0x00, 0x61,
+    0x66, 0x82, 0x31, 0x71, 0xE1, 0x0C, 0xDF, 0x45, 0xA4, 0xF5, 0x64, 0x6A, 0xA0, 0xFA, 0x87, 0xAE,
+    0x98, 0x0A, 0x66, 0xC3, 0x6C, 0x1D, 0xEA, 0x0A, 0xD8, 0x8E, 0x92, 0x43, 0xA6, 0x3F, 0x0F, 0x97,
+    0x3B, 0x38, 0xAE, 0x30, 0xCE, 0xB8, 0x04, 0x3E, 0x32, 0x26, 0x08, 0xE0, 0xE7, 0x0E, 0x8D, 0x33,
+    0x5C, 0x7A, 0xC8, 0xEF, 0x1D, 0x8C, 0x3A, 0x40, 0xAA, 0x06, 0x97, 0x0E, 0xFD, 0x7B, 0xC7, 0xFD,
+    0x1D, 0x6C, 0x41, 0x35, 0x18, 0x32, 0xBA, 0xC1, 0x98, 0xD0, 0x15, 0xA6, 0x84, 0xD9, 0x98, 0x04,
+    0x4C, 0x61, 0xEA, 0x57, 0x4D, 0xDB, 0x09, 0x51, 0x67, 0x38, 0x54, 0xC0, 0x6F, 0x4C, 0x05, 0x94,
+    0x24, 0x2D, 0x09, 0x9C, 0xE0, 0x04, 0x58, 0x1A, 0xE1, 0x6D, 0x30, 0x9F, 0x64, 0x8E, 0x0D, 0xFC,
+    0x14, 0xED, 0xBF, 0xAE, 0xD0, 0x1A, 0xFE, 0x8D, 0x99, 0xE1, 0x47, 0x85, 0xFD, 0x15, 0x08, 0x63,
+    0x32, 0xA5, 0x61, 0xB6, 0x0B, 0xEE, 0xDD, 0xC2, 0xF8, 0xB5, 0x8D, 0xC7, 0x2E, 0xD1, 0x5C, 0xD2,
+    0xD5, 0x63, 0xF3, 0x84, 0x5B, 0xDF, 0x26, 0xE8, 0x46, 0x50, 0x9B, 0xAA, 0x2E, 0xAB, 0x66, 0x57,
+    0x97, 0x42, 0x1C, 0xB2, 0x9B, 0xDF, 0xA1, 0xE1, 0xE3, 0x2B, 0xA6, 0xD8, 0x42, 0xA3, 0xF9, 0xE8,
+    0x67, 0x53, 0x4C, 0x69, 0x1C, 0x8C, 0xC9, 0xFD, 0x60, 0x35, 0x1B, 0x17, 0xFC, 0x63, 0xC6, 0x64,
+    0x36, 0x96, 0xC2, 0x84, 0x4B, 0x4A, 0x66, 0x5D, 0x09, 0xD8, 0x86, 0x5B, 0x55, 0xC5, 0x65, 0x42,
+    0x1C, 0x32, 0xA1, 0xD7, 0x98, 0xBE, 0x97, 0xDD, 0xA1, 0xBA, 0x81, 0x2D, 0x1C, 0xA0, 0x1B, 0x21,
+    0xC2, 0xD1, 0xE3, 0xFF, 0x6A, 0xAE, 0x77, 0xE6, 0xFA, 0xBC, 0xF9, 0xA3, 0x9B, 0x9B, 0x47, 0x49,
+    0x8B, 0x88, 0x14, 0x44, 0x44, 0x2A, 0xE1, 0xE9, 0xD3, 0xA7, 0xFB, 0xE9, 0xA1, 0xA1, 0x5C, 0xB9,
+    0xD1, 0x50, 0xD8, 0xFB, 0xDD, 0xC0, 0xF3, 0x66, 0x73, 0x67, 0x36, 0x2F, 0x98, 0xF3, 0x89, 0x49,
+    0xFD, 0x35, 0x4A, 0x06, 0x25, 0xB2, 0xC3, 0x20, 0x3F, 0x95, 0x99, 0xB0, 0x31, 0xAD, 0x2C, 0x33,
+    0xAE, 0xA8, 0x03, 0xEC, 0x66, 0x1A, 0x98, 0x6A, 0x37, 0xD0, 0xCD, 0x15, 0x50, 0xCD, 0xAD, 0xA0,
+    0x9A, 0x4F, 0xA0, 0x5A, 0x98, 0x41, 0xB5, 0x10, 0x41, 0xB7, 0xA9, 0xBF, 0x03, 0xA6, 0x2E, 0x80,
+    0xD9, 0x16, 0xC0, 0x96, 0x05, 0x18, 0xCA, 0x04, 0xB8, 0x75, 0x02, 0x7C, 0x0A, 0x11, 0xC2, 0x1C,
+    0x12, 0x08, 0x63, 0xC6, 0xEC, 0xB8, 0xCA, 0x58, 0x31, 0xF2, 0x81, 0x64, 0xE8, 0x55, 0x61, 0x94,
+    0x0D, 0xE0, 0xE6, 0xE4, 0xB8, 0x27, 0x83, 0xEB, 0x14, 0xAE, 0x73, 0x38, 0xB3, 0x11, 0x22, 0x34,
+    0x5C, 0x82, 0x09, 0x5B, 0xC0, 0x27, 0x5D, 0xC1, 0xFD, 0x42, 0xF3, 0x7C, 0x9A, 0xF7, 0x67, 0xCC,
+    0x63, 0x82, 0x89, 0xE1, 0xDE, 0xBC, 0x5E, 0xCD, 0xA0, 0xBA, 0x79, 0x39, 0xCD, 0xE6, 0xDE, 0x5C,
+    0x9E, 0x37, 0xE7, 0x9E, 0x32, 0x4E, 0xDE, 0x03, 0x2B, 0x92, 0x7B, 0x75, 0xE6, 0x60, 0x2A, 0x84,
+    0xA8, 0x77, 0x5C, 0xEA, 0xC8, 0x37, 0x94, 0xCE, 0x1A, 0x0F, 0x38, 0x7A, 0x76, 0xBB, 0xC4, 0x98,
+    0x6C, 0xC1, 0x15, 0x5D, 0x71, 0x1B, 0xC7, 0xCD, 0x52, 0x7B, 0x81, 0x1E, 0x45, 0x32, 0xC3, 0xC7,
+    0xDF, 0x89, 0xCF, 0xB1, 0xD3, 0xBB, 0xB2, 0x32, 0x94, 0xBB, 0x5A, 0xF3, 0xA2, 0x25, 0x3F, 0x8B,
+    0xBA, 0x8B, 0x64, 0x58, 0x44, 0x12, 0x93, 0x2C, 0x0D, 0x5F, 0xB1, 0xD1, 0xB6, 0x5E, 0x88, 0x80,
+    0x90, 0xE8, 0xD4, 0xE6, 0xFC, 0x7F, 0x87, 0xF6, 0x76, 0x67, 0xEA, 0x4F, 0x08, 0xF1, 0x5A, 0xC8,
+    0x7A, 0x61, 0xEB, 0x69, 0xBC, 0x70, 0xFF, 0xD7, 0x78, 0x7F, 0x6D, 0x02, 0x94, 0x00, 0x0C, 0x3B,
+    0x2A, 0x12, 0x8E, 0x37, 0x37, 0x58, 0x44, 0x22, 0x4A, 0x24, 0x03, 0x0F, 0x22, 0x78, 0x11, 0x69,
+    0xE1, 0xEE, 0xAD, 0xAF, 0x42, 0xBD, 0x40, 0x2F, 0xEB, 0xFF, 0x90, 0x5E, 0x2E, 0xCF, 0xB1, 0x27,
+    0xF5, 0x73, 0xC8, 0x2B, 0x0D, 0xB8, 0x10, 0x22, 0x4C, 0xB1, 0x3B, 0xF2, 0x44, 0xE1, 0x00, 0x2E,
+    0xE3, 0x56, 0x86, 0x82, 0xAE, 0xD8, 0x0D, 0x26, 0x7A, 0x0C, 0xA8, 0x06, 0xA6, 0x72, 0x00, 0x13,
+    0x0B, 0xE0, 0x52, 0x88, 0x60, 0x36, 0x9F, 0x80, 0x4B, 0x9F, 0xD8, 0xD7, 0x33, 0x60, 0x3E, 0x2C,
+    0x00, 0xC7, 0x06, 0xE0, 0x1B, 0x40, 0xDF, 0xFC, 0x3E, 0xAB, 0xBE, 0xE7, 0x2C, 0xF1, 0x8E, 0x76,
+    0xB0, 0x24, 0xE0, 0xBB, 0x92, 0x00, 0x2F, 0x09, 0x18, 0x3A, 0x4B, 0x7A, 0xFD, 0x85, 0x6A, 0x7A,
+    0xE6, 0xF1, 0xD2, 0xE9, 0x73, 0x05, 0xF8, 0xAD, 0xE5, 0xE3, 0x08, 0x83, 0x88, 0xAC, 0x9C, 0x08,
+    0x12, 0x6E, 0x87, 0x3C, 0x15, 0x73, 0x10, 0xA2, 0x5F, 0xFD, 0xCA, 0x8E, 0x4F, 0x07, 0xB6, 0x10,
+    0x7E, 0xBF, 0xE0, 0x13, 0x7B, 0x98, 0x39, 0x30, 0xB5, 0x61, 0x36, 0xDC, 0x8F, 0x0A, 0x2E, 0x11,
+    0xDE, 0x48, 0x4C, 0xD0, 0x26, 0x74, 0x65, 0xF8, 0x59, 0xC3, 0x65, 0xC2, 0xD7, 0x36, 0x42, 0xD4,
+    0xCD, 0x15, 0xD5, 0x18, 0xF3, 0x98, 0x87, 0xA2, 0x05, 0xBF, 0xF9, 0xAF, 0x2E, 0x05, 0x2F, 0x22,
+    0x07, 0x8C, 0x22, 0x32, 0xC3, 0xA7, 0x96, 0x8F, 0x5F, 0x7B, 0x71, 0x66, 0xDD, 0x61, 0xF0, 0x00,
+    0x4E, 0x17, 0x86, 0xA8, 0x1A, 0x84, 0x74, 0x12, 0xF3, 0x21, 0x33, 0xAE, 0xD0, 0x70, 0x2B, 0x84,
+    0xE8, 0x32, 0xD8, 0x32, 0x14, 0xA0, 0xD9, 0x02, 0xF8, 0x3F, 0xDB, 0x00, 0xFB, 0x61, 0x0F, 0xD4,
+    0x7A, 0xBF, 0x9B, 0xA6, 0x75, 0x2E, 0x09, 0xA0, 0x64, 0xBD, 0x37, 0x1F, 0x01, 0x60, 0x71, 0x2B,
+    0x30, 0xE9, 0x7A, 0x47, 0xBC, 0xC3, 0xDC, 0x39, 0xFD, 0x59, 0xAC, 0x02, 0x8C, 0x2B, 0x2E, 0xE3,
+    0x32, 0xBA, 0xE1, 0xCA, 0x15, 0x46, 0xCF, 0x32, 0xD9, 0x09, 0x30, 0x7E, 0xD6, 0xED, 0xBF, 0x87,
+    0x96, 0x06, 0x6E, 0xBD, 0x37, 0xDF, 0x81, 0x83, 0x7D, 0x11, 0x5A, 0xCA, 0x73, 0xE6, 0xA1, 0x40,
+    0x78, 0xC1, 0x7C, 0x07, 0x2D, 0x97, 0x6E, 0x8E, 0xF7, 0xC8, 0x63, 0x0B, 0x41, 0x44, 0x64, 0x1B,
+    0x45, 0x44, 0xF6, 0xA1, 0x37, 0x21, 0xF7, 0xF1, 0xD0, 0x73, 0xBF, 0x47, 0x76, 0x6F, 0x46, 0x7A,
+    0x36, 0x30, 0xCE, 0xE8, 0x0D, 0x7C, 0x6C, 0xE0, 0xD2, 0x04, 0xB6, 0xF8, 0x84, 0x6E, 0x2E, 0xC3,
+    0x61, 0x36, 0x08, 0xCF, 0x5A, 0xE6, 0x3B, 0x4B, 0x85, 0x10, 0x05, 0x5C, 0xF2, 0x2B, 0xB6, 0x98,
+    0x83, 0x97, 0x2B, 0x8B, 0xC8, 0x8E, 0x15, 0x91, 0xC8, 0xCB, 0xC7, 0xA3, 0x3B, 0x34, 0xFA, 0xD5,
+    0x70, 0xCA, 0x25, 0x6C, 0x41, 0x55, 0x26, 0xF0, 0x09, 0x97, 0x75, 0x83, 0xE3, 0xF4, 0xBE, 0xD9,
+    0xA0, 0x11, 0xE2, 0x79, 0x55, 0xA7, 0x1F, 0x7E, 0xB6, 0x05, 0x5D, 0xE1, 0xC0, 0xCF, 0xF4, 0xAB,
+    0x0E, 0xFA, 0x55, 0xFD, 0x06, 0xA6, 0xF3, 0x06, 0xDD, 0x87, 0x9D, 0x71, 0xEB, 0xC9, 0x56, 0x42,
+    0xEC, 0xBA, 0x81, 0x6A, 0x04, 0x18, 0x13, 0x43, 0x51, 0x0D, 0x16, 0xF0, 0x73, 0xCF, 0x70, 0xF6,
+    0x7E, 0x03, 0xBD, 0xA1, 0x08, 0x30, 0x26, 0xD3, 0xC9, 0xCD, 0xD2, 0x6F, 0xC0, 0x54, 0x16, 0x08,
+    0x33, 0x6E, 0x35, 0xE7, 0xB0, 0xE7, 0x0D, 0xAA, 0x75, 0xC7, 0x88, 0x64, 0xD5, 0x3F, 0x65, 0xEE,
+    0xDE, 0x91, 0xB3, 0x1B, 0x7D, 0x76, 0xB1, 0x43, 0xD6, 0xED, 0xA4, 0x58, 0xBF, 0x70, 0xB1, 0xC9,
+    0x16, 0xFA, 0x96, 0xF8, 0xF4, 0xCB, 0x2E, 0x36, 0xF7, 0xDD, 0x79, 0x6E, 0xB1, 0x91, 0x31, 0x61,
+    0x8B, 0xBA, 0xEE, 0xE1, 0x2F, 0xBD, 0x58, 0x5D, 0xFB, 0xEE, 0xFC, 0x77, 0x8B, 0x95, 0x1F, 0x9E,
+    0x9F, 0x72, 0x2E, 0x56, 0xDA, 0x89, 0x4F, 0xF6, 0xCA, 0xF4, 0xFC, 0x7C, 0x7E, 0xD9, 0xAF, 0xBD,
+    0x7E, 0x79, 0x1E, 0xC2, 0xE0, 0x31, 0x5E, 0x36, 0x08, 0xFD, 0xED, 0x05, 0xA8, 0xBF, 0xC3, 0xFB,
+    0xF1, 0x1E, 0xEF, 0x67, 0x20, 0x3C, 0x01, 0x82, 0xDC, 0xC2, 0x24, 0x32, 0xB3, 0x3C, 0x95, 0xCC,
+    0xC1, 0x58, 0xD8, 0x31, 0x95, 0x86, 0x6E, 0xAA, 0xA1, 0x9B, 0x6E, 0x5D, 0x03, 0x31, 0xD5, 0x6C,
+    0x98, 0xCD, 0x14, 0x86, 0x62, 0x0B, 0x63, 0x1E, 0xB2, 0x5A, 0x92, 0x13, 0x11, 0x9C, 0x48, 0x65,
+    0x94, 0x23, 0x5E, 0x6B, 0xCA, 0xDC, 0xCB, 0x4D, 0xD6, 0xAD, 0x27, 0xD3, 0xD1, 0xB3, 0x29, 0x44,
+    0xCE, 0x4D, 0x3F, 0xDD, 0xC3, 0xB9, 0xE3, 0x3F, 0xE7, 0x9A, 0xBF, 0x8B, 0xE0, 0x67, 0x2B, 0x32,
+    0xE3, 0xB2, 0x16, 0xD9, 0x31, 0x1B, 0xF2, 0x54, 0x92, 0x6A, 0x84, 0x38, 0x54, 0x26, 0xC6, 0x44,
+    0xEF, 0x59, 0x70, 0xAB, 0x5B, 0x75, 0xED, 0xB3, 0xDB, 0x61, 0xEF, 0x31, 0x3A, 0x75, 0x4F, 0xF8,
+    0xD4, 0xAF, 0xC9, 0x6E, 0x35, 0x15, 0x57, 0x4C, 0x61, 0x67, 0xAC, 0xDD, 0x07, 0x95, 0x85, 0x51,
+    0x64, 0x23, 0xCC, 0x83, 0xC8, 0x37, 0xAE, 0xED, 0x4B, 0xAF, 0x72, 0x3E, 0x9D, 0x99, 0x77, 0xAA,
+    0x25, 0x77, 0x3A, 0x49, 0xAF, 0x3E, 0x6E, 0x05, 0xF6, 0xD7, 0x61, 0x94, 0xA3, 0xEB, 0x5C, 0xE1,
+    0x83, 0x65, 0x33, 0x1B, 0x53, 0x9A, 0x50, 0xFB, 0x50, 0x70, 0xF9, 0x02, 0x87, 0x5B, 0x71, 0xB9,
+    0xC1, 0x3E, 0x26, 0xC6, 0xEF, 0x35, 0x4C, 0x0B, 0x33, 0xCB, 0xAB, 0x1B, 0x53, 0x0E, 0x22, 0xD5,
+    0x8A, 0xEC, 0x2C, 0x72, 0xCB, 0x7D, 0x57, 0xDD, 0x19, 0xC7, 0x8A, 0x95, 0x45, 0x66, 0x7E, 0xF7,
+    0x6C, 0xAB, 0xDD, 0x8B, 0x4C, 0xC1, 0xA7, 0x6B, 0x3D, 0xEE, 0x6E, 0x55, 0x0D, 0x75, 0x73, 0xF3,
+    0x28, 0xF5, 0xE6, 0xC6, 0x89, 0xC8, 0xCC, 0xD3, 0xA7, 0x6F, 0xDE, 0x33, 0x90, 0x4E, 0x3B, 0x0E,
+    0x7A, 0x13, 0x7E, 0x05, 0xFF, 0x29, 0x5E, 0x07, 0xB7, 0x8D, 0xCF, 0xA2, 0x25, 0xDA, 0xE3, 0x2D,
+    0x59, 0xBB, 0xC2, 0xA1, 0xBB, 0xD0, 0x75, 0x13, 0x9F, 0x2B, 0x9E, 0x0D, 0x5E, 0x96, 0x4E, 0x86,
+    0x9D, 0x48, 0x46, 0x37, 0x7A, 0x2B, 0x1E, 0x66, 0x25, 0xB3, 0x3D, 0x30, 0x1B, 0x21, 0xE1, 0x0A,
+    0xA1, 0x97, 0x84, 0xD9, 0x16, 0xB5, 0x83, 0x69, 0x67, 0xCB, 0x37, 0x26, 0x97, 0xED, 0x06, 0xAA,
+    0xB1, 0x77, 0x06, 0xB0, 0xBA, 0xE4, 0x32, 0xB0, 0xAB, 0xFD, 0x4B, 0x7B, 0x57, 0x7D, 0x44, 0x12,
+    0xA8, 0x66, 0x7A, 0x52, 0xF8, 0x14, 0x9E, 0x2E, 0x33, 0xE8, 0x66, 0x4B, 0xF7, 0xCA, 0xBC, 0x10,
+    0x22, 0xD8, 0x6D, 0xC8, 0x66, 0x03, 0x16, 0xF6, 0xCE, 0x23, 0x73, 0x6F, 0x08, 0x55, 0x53, 0x0D,
+    0x9F, 0x20, 0xCC, 0x3E, 0xA9, 0x9D, 0x2E, 0x2D, 0xBA, 0x82, 0xDE, 0x09, 0x91, 0x69, 0x55, 0x32,
+    0x9B, 0x82, 0x96, 0x0F, 0x24, 0x33, 0xC1, 0x20, 0xB2, 0x31, 0x64, 0x18, 0x7A, 0x09, 0x04, 0xF5,
+    0x5A, 0xFF, 0xFC, 0x63, 0x39, 0xC0, 0x8A, 0xEC, 0x10, 0xBA, 0xA0, 0xB9, 0xAA, 0x86, 0x3A, 0x50,
+    0x0D, 0xD3, 0x4E, 0x61, 0xCD, 0x6C, 0xD8, 0x82, 0x29, 0x0C, 0x05, 0x5B, 0x18, 0xFA, 0x97, 0x8D,
+    0x21, 0x63, 0x1A, 0x6E, 0x45, 0x49, 0x74, 0xE9, 0x24, 0x93, 0x8C, 0x22, 0x09, 0xBC, 0xC8, 0x0C,
+    0xD3, 0x1C, 0x22, 0x08, 0x01, 0x4C, 0x63, 0x82, 0x61, 0xE3, 0x02, 0x63, 0x66, 0x87, 0x90, 0xD8,
+    0x41, 0x50, 0x0D, 0xBD, 0xA3, 0x1B, 0xB6, 0xA2, 0x2B, 0xAE, 0x9C, 0x9B, 0x6C, 0xCA, 0x49, 0x0C,
+    0xAC, 0xAC, 0x5F, 0xC6, 0x4B, 0x6D, 0x2C, 0xEF, 0xEF, 0x4D, 0x1D, 0xF8, 0x6A, 0x2A, 0x6E, 0x1B,
+    0x0A, 0xAE, 0xB8, 0x95, 0xA1, 0x8C, 0x89, 0xA1, 0x84, 0x19, 0x97, 0x43, 0xC4, 0xAD, 0x01, 0xC6,
+    0x34, 0x81, 0x4F, 0x13, 0x84, 0x79, 0x82, 0x25, 0x4E, 0x20, 0x71, 0xC2, 0x08, 0x61, 0x76, 0x0B,
+    0xFE, 0xA3, 0xCB, 0x2B, 0x38, 0xA9, 0x5F, 0xC1, 0xC8, 0xFA, 0x65, 0xF8, 0xDC, 0x19, 0x00, 0x0F,
+    0x80, 0x97, 0x25, 0xA1, 0x7A, 0x8C, 0x1C, 0x7F, 0x8E, 0x91, 0x19, 0xCC, 0x7E, 0x8D, 0xAA, 0x4E,
+    0x81, 0xF7, 0x3B, 0x22, 0x13, 0xBE, 0x28, 0x2B, 0xE3, 0x0F, 0xE4, 0x60, 0xF8, 0xC9, 0x07, 0xB2,
+    0x1A, 0x99, 0x6D, 0x45, 0x66, 0x16, 0xA6, 0xD4, 0x8B, 0xA3, 0xD9, 0x86, 0x02, 0xCD, 0x54, 0x08,
+    0xEC, 0x30, 0xA6, 0x00, 0x43, 0x71, 0x09, 0x53, 0x3B, 0x66, 0xEE, 0x67, 0xE5, 0x9A, 0xB0, 0x1B,
+    0xD3, 0xCC, 0xF2, 0x44, 0x66, 0x9C, 0xC8, 0x0C, 0x8B, 0xC4, 0x3B, 0x8E, 0xF7, 0x20, 0xC2, 0x23,
+    0x99, 0xF1, 0x22, 0x0C, 0xC7, 0xC3, 0xAA, 0xF7, 0xDE, 0x35, 0x35, 0x97, 0x71, 0xA9, 0xA1, 0x9B,
+    0x4F, 0x2C, 0xAF, 0xDE, 0xDE, 0x2C, 0x6B, 0x10, 0x59, 0xAD, 0xC8, 0xC1, 0x74, 0xF3, 0xB0, 0xD9,
+    0x82, 0xCB, 0x13, 0x4C, 0xB6, 0x60, 0x4B, 0x88, 0x2C, 0x7A, 0x67, 0x5C, 0xDD, 0xED, 0xC3, 0xC6,
+    0x24, 0x72, 0x3E, 0xE4, 0xC1, 0xD9, 0x57, 0xBD, 0xDC, 0x53, 0x2C, 0x99, 0xDB, 0x87, 0xED, 0x44,
+    0x06, 0x97, 0x3A, 0x6C, 0xDB, 0x0A, 0x43, 0x83, 0xA9, 0xA2, 0x65, 0xC3, 0xCA, 0xCC, 0xB0, 0xF7,
+    0x3F, 0x9B, 0x7A, 0xEE, 0x4A, 0x88, 0xE0, 0x0A, 0xBF, 0xAD, 0xE5, 0x9B, 0x17, 0x82, 0xC8, 0xAC,
+    0x45, 0x62, 0x8F, 0xB7, 0x4F, 0x2D, 0xDF, 0x00, 0x2F, 0x3B, 0x8C, 0x22, 0x91, 0x4F, 0x33, 0xA5,
+    0xBB, 0x04, 0xBD, 0x23, 0x03, 0xBA, 0x3D, 0x43, 0xC8, 0xAD, 0xFC, 0xB0, 0x11, 0xA4, 0x36, 0xE4,
+    0xC9, 0xD1, 0xCC, 0x8E, 0x6F, 0xB6, 0xE0, 0x9A, 0xCB, 0xD8, 0x3A, 0x26, 0x4C, 0x0D, 0x33, 0x66,
+    0x0B, 0x11, 0x5B, 0xC2, 0xD9, 0x4F, 0xBA, 0x3C, 0x9D, 0xEE, 0x0F, 0x69, 0x82, 0x29, 0x86, 0xC8,
+    0x81, 0x4F, 0xA6, 0xE1, 0x6E, 0x1F, 0x15, 0xAC, 0x48, 0x42, 0xC9, 0x01, 0xBC, 0x14, 0xCF, 0x6D,
+    0x55, 0x1D, 0xE8, 0xB2, 0x96, 0x6F, 0x35, 0x75, 0x10, 0xE2, 0x81, 0x5B, 0x17, 0xCC, 0x16, 0xA2,
+    0x6E, 0x3E, 0xE9, 0xDD, 0x7D, 0xF4, 0xD6, 0x61, 0x44, 0x76, 0x44, 0xDE, 0x63, 0x7A, 0xAD, 0xE3,
+    0x92, 0x2D, 0x27, 0x97, 0x0A, 0x33, 0x0C, 0x1B, 0xBF, 0x89, 0x3C, 0x59, 0x7A, 0xFC, 0x2F, 0x32,
+    0xA3, 0x5E, 0xBF, 0x23, 0xB6, 0x2F, 0x45, 0x23, 0x33, 0x01, 0x2D, 0xC9, 0x49, 0x52, 0x8D, 0x49,
+    0x78, 0xB0, 0xCC, 0x43, 0x36, 0xC7, 0xEB, 0xB0, 0xE0, 0x63, 0x48, 0x40, 0x3B, 0x95, 0x61, 0xB3,
+    0x99, 0xE2, 0xD6, 0x53, 0x40, 0x9D, 0x00, 0x7C, 0xBC, 0x74, 0x12, 0x75, 0xFC, 0xE1, 0xED, 0x1B,
+    0xEB, 0xA9, 0x8B, 0xCB, 0xB5, 0x09, 0xEE, 0x68, 0xF7, 0xA5, 0xFD, 0x61, 0x06, 0x74, 0x1D, 0xB2,
+    0x9F, 0x01, 0xB7, 0x86, 0x78, 0xE9, 0x1D, 0x4F, 0x3B, 0x0B, 0x96, 0x2D, 0xB6, 0x00, 0x21, 0x8D,
+    0xB3, 0xCB, 0xA8, 0x87, 0x8D, 0x77, 0xF0, 0xEF, 0x47, 0x27, 0xC9, 0x14, 0xC2, 0xC1, 0x54, 0x71,
+    0x09, 0x5F, 0xCF, 0x74, 0x78, 0x29, 0x82, 0x7A, 0x1D, 0xB5, 0x48, 0x32, 0x22, 0x9B, 0xBE, 0x7D,
+    0xD8, 0x40, 0xED, 0xA7, 0xA7, 0x5B, 0xF7, 0x93, 0xDD, 0xF8, 0xFC, 0xB2, 0x12, 0x76, 0x98, 0x24,
+    0x82, 0x5F, 0xFB, 0xCE, 0x98, 0xF3, 0x9F, 0x2D, 0x11, 0x97, 0x8F, 0x9B, 0x25, 0x89, 0x08, 0x8F,
+    0x64, 0x3B, 0xBB, 0xF7, 0x13, 0x6E, 0x77, 0xD5, 0xA0, 0xE9, 0x8A, 0x6A, 0x66, 0xEB, 0x5A, 0xB8,
+    0xD9, 0x6C, 0x39, 0xDF, 0xCA, 0x90, 0xB1, 0xC5, 0xAD, 0x0C, 0xD9, 0x25, 0xDC, 0x3A, 0x26, 0x5C,
+    0xF2, 0xA9, 0x4B, 0xE7, 0x21, 0x85, 0xD8, 0x21, 0x46, 0x62, 0x88, 0x5A, 0x08, 0xF3, 0xB0, 0xE0,
+    0xDF, 0xEF, 0x99, 0xFD, 0x18, 0x2B, 0xEB, 0x57, 0xCE, 0xCC, 0x36, 0x45, 0x55, 0x4C, 0xD1, 0x1B,
+    0xBA, 0x0E, 0x05, 0x44, 0x12, 0x4C, 0x07, 0xA0, 0xE2, 0x0B, 0xF8, 0xFF, 0x7F, 0x33, 0xA1, 0x6B,
+    0xF3, 0x13, 0x66, 0x53, 0x08, 0x49, 0x35, 0x42, 0xE2, 0x82, 0x4F, 0x84, 0xE8, 0xCF, 0x81, 0x6D,
+    0x19, 0xD7, 0x53, 0x59, 0x59, 0xDE, 0xCA, 0x10, 0x24, 0x83, 0x93, 0x46, 0xCF, 0x62, 0xDD, 0x86,
+    0x72, 0x9E, 0x6F, 0xF5, 0x7B, 0x52, 0x07, 0xEA, 0xE3, 0x14, 0x29, 0x0F, 0x4C, 0x25, 0xC4, 0xDE,
+    0xF0, 0x5E, 0x7B, 0x7E, 0x49, 0xFD, 0x70, 0x00, 0xF7, 0xC1, 0x9B, 0x0D, 0x26, 0x86, 0x7C, 0x2A,
+    0x4D, 0x6E, 0xED, 0xD4, 0xB1, 0xF3, 0xC6, 0xCE, 0x01, 0x0F, 0x08, 0x27, 0x5D, 0x74, 0x89, 0x21,
+    0xF7, 0xE3, 0x91, 0x7E, 0x20, 0xE0, 0x56, 0x86, 0x4C, 0x38, 0x3B, 0x36, 0xD3, 0x18, 0xCA, 0xA7,
+    0x96, 0x15, 0x3F, 0xFB, 0x03, 0x76, 0x96, 0xF5, 0x9E, 0xCF, 0x5D, 0x5F, 0x21, 0x83, 0xEB, 0xD2,
+    0x6A, 0xA8, 0x4C, 0x05, 0xA6, 0x8D, 0x4B, 0x01, 0xD9, 0xD8, 0x37, 0xF4, 0x7F, 0x14, 0x5A, 0xC5,
+    0x7C, 0x58, 0x54, 0x6D, 0xB8, 0xEF, 0x67, 0x55, 0x1B, 0xE3, 0xD7, 0x57, 0xBD, 0xBD, 0x4D, 0x70,
+    0xC9, 0x94, 0xAF, 0xF0, 0x8E, 0x4B, 0xA6, 0x7C, 0x81, 0x36, 0x26, 0x9B, 0x5F, 0x31, 0xC5, 0xCF,
+    0xC3, 0x1A, 0x6C, 0x0E, 0x71, 0x58, 0xBD, 0x4B, 0x01, 0x97, 0xBC, 0x8F, 0x01, 0x97, 0xC6, 0x85,
+    0x89, 0x71, 0x76, 0x8D, 0x0B, 0x3E, 0xBA, 0xCA, 0x4E, 0x88, 0xAE, 0xD0, 0x08, 0x0C, 0x2B, 0xED,
+    0xDE, 0x01, 0x6E, 0x35, 0x05, 0x53, 0x54, 0x43, 0x35, 0x2E, 0xB0, 0x10, 0x22, 0x7E, 0x76, 0x6B,
+    0x97, 0x60, 0xAF, 0x96, 0xE5, 0xE9, 0xD3, 0x83, 0x20, 0x22, 0xB3, 0x13, 0x91, 0xD5, 0x16, 0x6C,
+    0xD1, 0x0D, 0xD5, 0x38, 0x4E, 0x99, 0x20, 0x44, 0x97, 0xFA, 0x3D, 0xF6, 0x5E, 0xCC, 0xB9, 0x5C,
+    0xCF, 0xA4, 0x78, 0x10, 0xBB, 0xAE, 0xA6, 0x45, 0x0A, 0xE1, 0xA3, 0x47, 0x45, 0xEF, 0xB8, 0x3C,
+    0xAE, 0xF8, 0x74, 0x40, 0x30, 0x1B, 0xEC, 0x3E, 0x61, 0xB6, 0x03, 0xDC, 0xBB, 0x1B, 0x04, 0x97,
+    0x50, 0x6D, 0x82, 0xE1, 0xC7, 0x0D, 0xC2, 0xAB, 0x05, 0xD5, 0x5C, 0xC2, 0xE5, 0x30, 0x33, 0x31,
+    0x45, 0x5B, 0x91, 0x27, 0x32, 0x23, 0x52, 0x61, 0x39, 0xE2, 0x15, 0xCE, 0x78, 0x00, 0xC1, 0xCA,
+    0xCA, 0x2B, 0x5E, 0x36, 0x1E, 0x2F, 0x6F, 0x36, 0x96, 0x4D, 0x37, 0x24, 0xA9, 0x86, 0x44, 0x9A,
+    0x3A, 0x3A, 0x81, 0x50, 0x4D, 0xB7, 0x6B, 0x7C, 0x9B, 0x82, 0x29, 0xB6, 0xF4, 0xDE, 0x7A, 0x28,
+    0x2E, 0xE3, 0xB2, 0x5B, 0xFB, 0x81, 0x95, 0x4B, 0xE3, 0x19, 0xDF, 0x7E, 0x0E, 0xB1, 0x77, 0xCB,
+    0x21, 0x9E, 0x24, 0x22, 0x18, 0x59, 0x31, 0x3F, 0x16, 0x99, 0x79, 0x3C, 0x3D, 0x6C, 0x0C, 0x12,
+    0xC7, 0x8C, 0xAC, 0x1C, 0xB8, 0x8D, 0xA1, 0x28, 0x81, 0x89, 0x71, 0x65, 0x28, 0xBA, 0xC1, 0x42,
+    0x98, 0x71, 0xB9, 0x2B, 0xC4, 0x53, 0xC4, 0xA5, 0xA1, 0xA0, 0x5B, 0x6F, 0x9E, 0xDC, 0xC6, 0x50,
+    0x90, 0xA8, 0x0E, 0xC6, 0xC6, 0x94, 0xF4, 0x27, 0xB7, 0x8F, 0x0A, 0xE1, 0x0F, 0xA4, 0x61, 0x4A,
+    0x38, 0x20, 0xF0, 0xB9, 0x6B, 0xFF, 0x70, 0xB9, 0x17, 0x0F, 0x9E, 0xE3, 0x89, 0xD7, 0x26, 0xE0,
+    0xEC, 0x74, 0x79, 0x10, 0x51, 0x8B, 0xCC, 0x5A, 0xA4, 0x68, 0xF9, 0xE6, 0xA6, 0xCF, 0xE3, 0x3B,
+    0x96, 0xB3, 0x54, 0xF9, 0xD4, 0x3B, 0x09, 0xB3, 0x9D, 0x23, 0x4D, 0xDC, 0x83, 0xBB, 0x7A, 0x06,
+    0xDC, 0x3F, 0x8B, 0x3C, 0x79, 0x9B, 0xF1, 0x5A, 0x2E, 0x55, 0x2F, 0xC9, 0x9F, 0x83, 0xD7, 0xA1,
+    0x8D, 0x82, 0x3F, 0x30, 0xFF, 0x2C, 0x62, 0xE4, 0x60, 0xFC, 0x8B, 0x6F, 0xEE, 0xE1, 0x5B, 0x8D,
+    0xA5, 0x98, 0x4F, 0xB2, 0xD9, 0x8C, 0x30, 0x1C, 0xB8, 0xD5, 0x6D, 0xF8, 0x42, 0x88, 0xD3, 0xCC,
+    0xD2, 0x61, 0xC6, 0x34, 0x4C, 0x19, 0x0A, 0x6E, 0x65, 0x4C, 0x3D, 0x53, 0x17, 0x1A, 0xAA, 0x61,
+    0xAA, 0x2D, 0x0C, 0x19, 0xB7, 0xFA, 0xD4, 0xA5, 0xFE, 0x03, 0x5A, 0x87, 0x24, 0x5B, 0x3A, 0xF8,
+    0xF8, 0x44, 0x88, 0x13, 0x1C, 0xB0, 0x77, 0xA2, 0x66, 0x8B, 0x3B, 0x4F, 0xB4, 0xFA, 0x60, 0x97,
+    0x3B, 0xA0, 0xC9, 0xB0, 0x9F, 0x4A, 0x7C, 0xD7, 0xFD, 0x6D, 0x39, 0xCF, 0x38, 0xC7, 0x84, 0x29,
+    0x84, 0x19, 0xB3, 0x31, 0x81, 0xDE, 0xBA, 0xF6, 0xAC, 0x1A, 0xA8, 0x6A, 0x36, 0x50, 0x5D, 0x68,
+    0xE9, 0x07, 0x6F, 0x6D, 0x4C, 0x40, 0x0B, 0x11, 0x78, 0xFB, 0x31, 0xC0, 0xDB, 0x0D, 0xE0, 0x71,
+    0xE7, 0xE2, 0xE5, 0x9A, 0xE5, 0xA7, 0xDA, 0xD7, 0xE3, 0xE4, 0x54, 0x7C, 0xF6, 0xFB, 0x9F, 0x03,
+    0x74, 0x5D, 0xD1, 0x67, 0x20, 0x48, 0x02, 0xC2, 0x01, 0xE0, 0xDF, 0x3B, 0xE7, 0xFB, 0x99, 0xF9,
+    0x4E, 0xA9, 0xEB, 0x65, 0xAF, 0x7B, 0xBA, 0x8F, 0xD6, 0xEE, 0xBB, 0x48, 0x3F, 0x03, 0xEA, 0x00,
+    0x3E, 0x25, 0x32, 0xA3, 0x44, 0x64, 0x65, 0x3C, 0x16, 0x59, 0x95, 0xE8, 0x1A, 0xD2, 0x98, 0xDD,
+    0x1A, 0x66, 0x21, 0x30, 0xD9, 0xA2, 0x1A, 0xBB, 0x9F, 0x87, 0x6C, 0xB6, 0x9D, 0x10, 0xDD, 0xBF,
+    0x14, 0x76, 0xC2, 0x1B, 0xC9, 0x14, 0xF6, 0x89, 0x31, 0xD9, 0x9F, 0x35, 0x2E, 0xF8, 0x77, 0x8B,
+    0xD9, 0xD8, 0xDD, 0xEA, 0xD2, 0x50, 0x7C, 0x0A, 0x2C, 0x31, 0xFC, 0xB0, 0x0D, 0x95, 0x49, 0x3E,
+    0x91, 0x99, 0x49, 0x64, 0x03, 0x2F, 0xB7, 0xF7, 0x8B, 0x98, 0xEF, 0x5A, 0x8F, 0x1E, 0x73, 0xFD,
+    0x88, 0xF7, 0x17, 0xCC, 0xFD, 0xDA, 0xDE, 0xFA, 0x64, 0x36, 0x7C, 0xEA, 0xA9, 0xE1, 0x92, 0xCB,
+    0xE8, 0xEA, 0x32, 0x84, 0xA1, 0xC0, 0xF0, 0x8F, 0x05, 0x90, 0x02, 0x84, 0xED, 0xFA, 0x20, 0x73,
+    0x00, 0x46, 0x12, 0x68, 0xD9, 0xE8, 0xC8, 0xA0, 0x76, 0xB7, 0x9E, 0x05, 0xEB, 0x20, 0x80, 0x30,
+    0x64, 0x16, 0x68, 0x2C, 0xB1, 0xCB, 0x9E, 0x3F, 0xA7, 0xA6, 0xD5, 0xFF, 0x85, 0x9A, 0x16, 0xFD,
+    0xFB, 0x4B, 0xF8, 0x5B, 0x27, 0x35, 0x34, 0x2B, 0xAB, 0xAB, 0x7C, 0xEE, 0x99, 0x13, 0x7F, 0x73,
+    0x47, 0xE8, 0x86, 0x7C, 0x5F, 0x60, 0x2F, 0x30, 0xB9, 0x95, 0xE1, 0xDA, 0x30, 0xBA, 0xEF, 0xB5,
+    0x7E, 0x52, 0x10, 0xDE, 0xDD, 0xB0, 0x35, 0x44, 0xE4, 0xD5, 0x8D, 0x50, 0x42, 0x1A, 0x45, 0x8B,
+    0x7C, 0x92, 0x9D, 0xD4, 0x1D, 0x7F, 0xDB, 0xCF, 0x15, 0xCE, 0xA6, 0x50, 0xFF, 0xD7, 0xA6, 0xF5,
+    0xBE, 0xC6, 0xF4, 0x63, 0x7F, 0xB7, 0xF6, 0x1F, 0x05, 0x84, 0x78, 0x81, 0xBD, 0xF3, 0x6E, 0x53,
+    0xFA, 0xFA, 0xC6, 0x84, 0x9F, 0x03, 0xD7, 0xF4, 0xD3, 0xB5, 0xAF, 0xFD, 0x9A, 0x7E, 0xA1, 0x77,
+    0x5A, 0x3F, 0x27, 0xFD, 0x26, 0x2E, 0xA8, 0x1D, 0xDD, 0xCC, 0x86, 0xEB, 0x2D, 0x37, 0x53, 0x42,
+    0xE6, 0x10, 0x8D, 0x30, 0xEC, 0x1C, 0x7C, 0x61, 0xE7, 0xBB, 0x45, 0x1F, 0x0F, 0xFF, 0xE6, 0x78,
+    0xF4, 0x57, 0xC9, 0xC8, 0x61, 0xA5, 0xBD, 0x82, 0x95, 0xD5, 0xCA, 0x57, 0x37, 0x78, 0xED, 0xAE,
+    0xE3, 0xFA, 0x35, 0x99, 0xEA, 0x76, 0x4E, 0xF5, 0xA3, 0x3E, 0x55, 0xDF, 0xAC, 0xAC, 0x56, 0xE6,
+    0x50, 0xFA, 0x54, 0xAF, 0xC1, 0xB3, 0x3F, 0xAF, 0xCC, 0x5C, 0x85, 0x99, 0x2B, 0xB0, 0x9C, 0x6B,
+    0xF2, 0x77, 0xFA, 0xCC, 0xE7, 0xDF, 0x7A, 0x41, 0x8A, 0xBF, 0xD7, 0xE3, 0xFF, 0xE1, 0x3B, 0xE0,
+    0x45, 0xD6, 0x7E, 0x88, 0x11, 0xA2, 0x6D, 0x4C, 0xA8, 0x9D, 0x89, 0xDE, 0x29, 0x9F, 0xDF, 0xA6,
+    0xAE, 0x4D, 0x99, 0x8A, 0x7F, 0xFF, 0x51, 0xC1, 0x89, 0x24, 0xF4, 0x33, 0x6C, 0xFD, 0x2E, 0xA3,
+    0x76, 0x1A, 0xF4, 0x3D, 0x44, 0xB5, 0x7E, 0xF6, 0x9F, 0x42, 0x04, 0x5D, 0x4D, 0xB9, 0x53, 0x75,
+    0x4D, 0xB1, 0x1F, 0x3F, 0x85, 0x89, 0x45, 0x84, 0xA1, 0x38, 0x91, 0xC6, 0x85, 0x1D, 0x9F, 0xDD,
+    0x3A, 0x26, 0x16, 0x9A, 0x6A, 0xD8, 0x32, 0x26, 0x9F, 0x98, 0x74, 0x55, 0x0D, 0x5B, 0x42, 0x1C,
+    0x13, 0x87, 0xD9, 0xD8, 0x19, 0x53, 0x60, 0xB8, 0x7D, 0xA3, 0xDA, 0x42, 0x90, 0x83, 0x0B, 0x2C,
+    0x12, 0xDD, 0x7A, 0xE5, 0xF5, 0x57, 0xDD, 0x72, 0x4C, 0x7D, 0xD1, 0xF7, 0x5D, 0xD0, 0xF5, 0x8F,
+    0xFF, 0xFE, 0x1D, 0x8C, 0x48, 0x43, 0x44, 0xD2, 0x14, 0x87, 0x3A, 0x26, 0x96, 0x21, 0xE3, 0xFE,
+    0xBA, 0x62, 0xCA, 0xA5, 0x9F, 0x98, 0x2D, 0x76, 0x63, 0x8A, 0xF2, 0x64, 0x49, 0xAE, 0xF7, 0x0E,
+    0x67, 0x79, 0x79, 0x29, 0x62, 0x65, 0xC7, 0x89, 0xA4, 0xE1, 0xFD, 0x25, 0xF7, 0x60, 0x37, 0xB5,
+    0x83, 0xA8, 0x6A, 0xA0, 0x9A, 0x7E, 0xFA, 0x66, 0x33, 0x22, 0xA7, 0x94, 0x70, 0x1E, 0xF2, 0x62,
+    0x4F, 0x99, 0x7A, 0x4C, 0x91, 0x69, 0xBE, 0x7D, 0x78, 0x20, 0x52, 0x59, 0x64, 0xBD, 0x8B, 0xC2,
+    0x97, 0x22, 0x66, 0xC3, 0xCA, 0x86, 0x5B, 0x11, 0xD9, 0x08, 0xB8, 0xDB, 0x47, 0x45, 0x35, 0x16,
+    0x5C, 0x1E, 0xB2, 0x2D, 0x8C, 0x29, 0xC4, 0x30, 0x13, 0x62, 0xA3, 0xC1, 0x6E, 0xCB, 0x50, 0x30,
+    0x9B, 0xFF, 0x60, 0x99, 0x71, 0xEB, 0x22, 0x3B, 0x84, 0x57, 0x45, 0x3A, 0x2B, 0x19, 0x13, 0x43,
+    0x99, 0x98, 0x20, 0xFC, 0x69, 0x55, 0x0D, 0x76, 0x97, 0x4D, 0x61, 0x28, 0x21, 0xBA, 0x95, 0x10,
+    0x1B, 0x3E, 0x99, 0x66, 0x0B, 0xE1, 0xFD, 0x25, 0xF9, 0x99, 0x49, 0x1A, 0x3B, 0xF8, 0x7E, 0x82,
+    0x71, 0xEF, 0x58, 0x5E, 0x3E, 0x7F, 0xD2, 0x55, 0x08, 0xC7, 0x9B, 0x15, 0xBF, 0xB2, 0xE3, 0xD6,
+    0x7E, 0x3A, 0xEA, 0x92, 0x6A, 0xFD, 0xA7, 0x1C, 0xBA, 0xF6, 0xD3, 0x3A, 0x25, 0x4F, 0x97, 0x53,
+    0x70, 0x50, 0x22, 0x05, 0xC4, 0x54, 0x10, 0x76, 0x58, 0x62, 0x80, 0x29, 0xF6, 0xDF, 0x41, 0x65,
+    0x42, 0x32, 0xB5, 0x0B, 0x0E, 0x21, 0x9D, 0xC2, 0x37, 0x10, 0xA8, 0x98, 0xE2, 0x13, 0x41, 0x57,
+    0xD4, 0xFC, 0x99, 0x67, 0x32, 0x54, 0xBD, 0x0E, 0xB6, 0xFF, 0x18, 0x2B, 0xB3, 0xBC, 0x2F, 0x8C,
+    0xD9, 0x6C, 0xA6, 0x12, 0xE2, 0x82, 0xD9, 0xDC, 0xCA, 0xA2, 0x1B, 0x7E, 0x0D, 0x7F, 0xBF, 0x54,
+    0x23, 0xB2, 0x13, 0xE4, 0x16, 0xFB, 0xD1, 0x09, 0x4A, 0xBD, 0xC9, 0xBA, 0x76, 0xB4, 0x7E, 0xE5,
+    0x77, 0x90, 0x27, 0x0B, 0x56, 0xA4, 0x74, 0x09, 0xE6, 0xA5, 0xD7, 0xE0, 0x3F, 0x01, 0xD5, 0xBD,
+    0x4F, 0xAC, 0x27, 0x57, 0x95, 0xE7, 0xF9, 0x89, 0xB8, 0x99, 0x19, 0x94, 0xA3, 0xE1, 0xE6, 0xC2,
+    0x49, 0x17, 0xA6, 0xA8, 0xE8, 0x05, 0x1A, 0xD1, 0x1E, 0x4C, 0xCC, 0x82, 0x85, 0x35, 0x93, 0xCE,
+    0x1B, 0xD8, 0xA3, 0x61, 0x51, 0x1A, 0x91, 0x23, 0xF9, 0x99, 0xD1, 0x78, 0x61, 0x16, 0x2C, 0xAA,
+    0xDC, 0xEA, 0x4E, 0x46, 0x62, 0xE1, 0x56, 0xA7, 0x5F, 0x04, 0xB0, 0xA0, 0x35, 0xB5, 0x20, 0x35,
+    0x6A, 0xAA, 0xA4, 0x2E, 0x8D, 0xCA, 0x23, 0x79, 0x46, 0xF0, 0x98, 0x56, 0xB2, 0x40, 0x23, 0x6B,
+    0x3A, 0xF3, 0xC5, 0xB5, 0x2D, 0x35, 0x23, 0xB1, 0x20, 0x80, 0x06, 0x16, 0x8C, 0x54, 0x51, 0x18,
+    0x37, 0x53, 0xA0, 0x6E, 0xDF, 0x82, 0xF0, 0x10, 0x69, 0xDF, 0x88, 0x33, 0x8B, 0x73, 0xE3, 0xF7,
+    0x7E, 0xEF, 0x65, 0x9A, 0x02, 0x15, 0x45, 0xC1, 0x4F, 0xF6, 0x7B, 0x2F, 0x7F, 0xFF, 0xE2, 0xC6,
+    0xB9, 0xFF, 0xCE, 0xF9, 0x9E, 0xEF, 0xF9, 0x5E, 0xB2, 0x06, 0xE7, 0x33, 0xA1, 0x88, 0x54, 0x23,
+    0xEF, 0x42, 0x1F, 0xE7, 0xE1, 0x05, 0xCC, 0x88, 0x6D, 0xB8, 0x4E, 0x1E, 0xB0, 0x9E, 0x2B, 0x64,
+    0x33, 0xE5, 0x80, 0x83, 0x48, 0x11, 0xA8, 0x3B, 0x56, 0xCC, 0x44, 0xED, 0x11, 0x4C, 0xC4, 0x8E,
+    0xE9, 0xB3, 0x55, 0xFA, 0xFF, 0x03, 0x90, 0xCB, 0x4C, 0x2D, 0x0B, 0xF2, 0xA3, 0x68, 0x56, 0xCE,
+    0x95, 0x13, 0xD8, 0x11, 0x6A, 0x0F, 0xAE, 0x81, 0x16, 0xE8, 0x81, 0x15, 0x58, 0xF6, 0xFE, 0x5F,
+    0xD3, 0xF3, 0x6D, 0x03, 0x6E, 0x2C, 0x3A, 0x2B, 0xD2, 0x19, 0x91, 0x86, 0xF6, 0x79, 0x78, 0x04,
+    0xB8, 0x0E, 0xDC, 0x02, 0x1E, 0x67, 0xF7, 0xC8, 0xFA, 0x05, 0xA8, 0x45, 0x1A, 0x72, 0xF9, 0x52,
+    0x84, 0x6A, 0xE4, 0x39, 0xFD, 0x2A, 0x8A, 0x00, 0x7A, 0x55, 0x38, 0x06, 0x30, 0x13, 0x80, 0xF5,
+    0xA0, 0x8D, 0x20, 0x9F, 0x81, 0xEC, 0xA9, 0x57, 0x0F, 0xA0, 0x16, 0x89, 0x20, 0x22, 0x23, 0x94,
+    0xFA, 0xC1, 0x8E, 0xD4, 0x30, 0x4C, 0x00, 0xA8, 0xF6, 0xBE, 0x29, 0x80, 0xDE, 0x0C, 0xC5, 0x04,
+    0x20, 0x22, 0x32, 0x1A, 0x11, 0x91, 0xA6, 0x12, 0x91, 0x08, 0xC0, 0x3B, 0xA0, 0xB4, 0xDF, 0x97,
+    0x3F, 0x0E, 0x22, 0x12, 0xEC, 0x9D, 0x6B, 0xC1, 0x04, 0x62, 0x16, 0xB0, 0x5D, 0x24, 0x0F, 0x57,
+    0xE0, 0xBA, 0xED, 0xA8, 0xF3, 0x80, 0xED, 0x0E, 0x29, 0x06, 0x3B, 0x96, 0xA1, 0x10, 0x59, 0x8B,
+    0x37, 0xE5, 0xB5, 0xBF, 0x0C, 0x0F, 0x34, 0xF3, 0x45, 0x38, 0x47, 0x31, 0x40, 0xDD, 0xB5, 0x50,
+    0x04, 0x13, 0x60, 0xC5, 0x35, 0xD4, 0x3E, 0x9F, 0x29, 0x02, 0x95, 0x67, 0x81, 0x48, 0xED, 0xB1,
+    0xBE, 0x08, 0x70, 0x9B, 0x05, 0xCC, 0x58, 0x77, 0xE0, 0x4C, 0x80, 0x3C, 0x2C, 0x40, 0x75, 0xAD,
+    0x03, 0x24, 0xC0, 0x7D, 0x37, 0xE5, 0x8B, 0x64, 0x22, 0x32, 0x50, 0x69, 0x2B, 0x0F, 0x01, 0xCA,
+    0x01, 0xB2, 0x83, 0xE5, 0x00, 0x5A, 0x91, 0x89, 0x52, 0x44, 0x36, 0x03, 0xE4, 0x13, 0x80, 0x3B,
+    0xB9, 0xE9, 0x43, 0x80, 0xF7, 0x3D, 0xBB, 0xFF, 0x78, 0x64, 0xEB, 0x8D, 0xFB, 0x4F, 0x3D, 0xFD,
+    0x2C, 0xF0, 0xF4, 0xF3, 0xD0, 0x4A, 0xA4, 0x16, 0xF1, 0x66, 0xE6, 0xE3, 0x1C, 0xA7, 0xCB, 0x71,
+    0x0C, 0x14, 0x33, 0x50, 0xCF, 0x80, 0xCC, 0xD0, 0xF7, 0x81, 0xBA, 0xEB, 0x7D, 0x31, 0x66, 0x0B,
+    0xB7, 0x28, 0x47, 0xEB, 0x39, 0x64, 0xA1, 0x1C, 0xCA, 0x40, 0xC4, 0x0D, 0xAE, 0xC9, 0xE4, 0xB5,
+    0x81, 0x5C, 0x02, 0x5C, 0x90, 0x06, 0x8A, 0x08, 0xD8, 0x01, 0xB8, 0x0D, 0xD8, 0xE1, 0x6D, 0x64,
+    0x91, 0xF5, 0x09, 0x69, 0xAC, 0xC8, 0x40, 0x2D, 0x69, 0x6C, 0x9E, 0xE3, 0xBF, 0x9B, 0xCB, 0xEF,
+    0x8D, 0xEE, 0x5A, 0x13, 0x2F, 0xD2, 0xEC, 0xC6, 0xCE, 0x05, 0x59, 0x1B, 0xA0, 0x12, 0x59, 0x80,
+    0x7A, 0xA4, 0x1A, 0x77, 0x03, 0xD4, 0xE9, 0xFD, 0xD6, 0x5C, 0xF8, 0x22, 0x8E, 0x0A, 0x2B, 0xB3,
+    0x19, 0x6C, 0x63, 0xD7, 0x85, 0xEB, 0x85, 0xB7, 0x63, 0x86, 0x7D, 0x74, 0x2C, 0x02, 0x64, 0x61,
+    0x32, 0x01, 0xB8, 0x7C, 0x99, 0x08, 0x58, 0xAB, 0x1F, 0xFD, 0x96, 0xB7, 0x1D, 0x30, 0x05, 0x33,
+    0x02, 0x8F, 0x6C, 0x2F, 0x36, 0x0E, 0x30, 0x2F, 0x8D, 0xE5, 0x00, 0x59, 0xB8, 0xCE, 0x02, 0xCC,
+    0xB6, 0xA9, 0x5F, 0xFD, 0x37, 0x5C, 0xCF, 0x42, 0x2E, 0xD2, 0x5C, 0xC1, 0x51, 0xAE, 0x4D, 0xAD,
+    0xD6, 0xAE, 0x1B, 0x9D, 0x0D, 0x0D, 0xE6, 0x0E, 0x59, 0xDF, 0x40, 0xBD, 0xDE, 0x5C, 0x01, 0x7A,
+    0x99, 0x01, 0xB8, 0x94, 0xEE, 0x27, 0x93, 0xF7, 0x14, 0x12, 0xAB, 0x4F, 0xC5, 0x2B, 0xCC, 0xD7,
+    0x99, 0x5F, 0x60, 0x9A, 0x08, 0x53, 0x16, 0x26, 0x33, 0xCE, 0xE5, 0x70, 0xBB, 0x1D, 0xDC, 0x4F,
+    0xFD, 0x85, 0x0F, 0x35, 0x0F, 0x1E, 0x1D, 0x1D, 0xFD, 0xAF, 0x22, 0x22, 0xDF, 0x15, 0x11, 0x69,
+    0x80, 0x67, 0x81, 0x6C, 0x02, 0x8A, 0x01, 0xA8, 0xEE, 0x7E, 0x0A, 0xEE, 0x3B, 0x7A, 0xAE, 0x97,
+    0x6F, 0x89, 0x9C, 0x3F, 0x78, 0xFC, 0x97, 0x32, 0x5E, 0x76, 0xF4, 0x3C, 0x8E, 0x8A, 0x5E, 0x46,
+    0x33, 0xD8, 0xA6, 0x96, 0x85, 0xEB, 0x85, 0x2F, 0x87, 0xCA, 0xDB, 0x47, 0xC7, 0x7C, 0x32, 0x21,
+    0x0B, 0x13, 0xB7, 0xB9, 0xC5, 0xE5, 0xCB, 0xD4, 0x8D, 0xC3, 0x5A, 0xCA, 0xC1, 0x75, 0xE6, 0x5B,
+    0x3E, 0x17, 0xF1, 0x4C, 0x81, 0x5E, 0x3A, 0x1E, 0xB9, 0x4C, 0xFD, 0xA7, 0x01, 0x6B, 0x9B, 0x72,
+    0xB8, 0x8D, 0x79, 0x69, 0xCC, 0x27, 0xEB, 0xB3, 0x70, 0x9D, 0xDB, 0xF9, 0xCC, 0x6C, 0x9B, 0xBA,
+    0x71, 0x5C, 0xCF, 0x42, 0x39, 0x14, 0xE1, 0x0A, 0x2E, 0x9B, 0xB8, 0xFD, 0x4B, 0x1B, 0x8F, 0x52,
+    0x44, 0x5E, 0x16, 0x91, 0x70, 0x74, 0x74, 0xF4, 0x3C, 0x90, 0x4B, 0x57, 0xC9, 0xE4, 0x3E, 0x14,
+    0x6F, 0x71, 0x65, 0xA6, 0x9E, 0xA9, 0x66, 0xEA, 0x5B, 0x5C, 0xB9, 0xC2, 0xED, 0x5A, 0xE6, 0x42,
+    0x06, 0xEE, 0x4F, 0xEB, 0x90, 0x09, 0xDB, 0x92, 0xE2, 0x00, 0xE2, 0xD9, 0xA7, 0x1E, 0x3C, 0x5A,
+    0x4F, 0x19, 0xFC, 0xDE, 0xEF, 0xDA, 0x7B, 0xEA, 0xBE, 0x4E, 0x9B, 0x74, 0xB6, 0xA7, 0xDE, 0x3D,
+    0xE3, 0xC4, 0xDB, 0xFF, 0x79, 0xCE, 0x70, 0x50, 0x7A, 0xCC, 0x48, 0x36, 0xC1, 0x0C, 0x91, 0x2C,
+    0x92, 0xCD, 0xE4, 0x33, 0xF9, 0x84, 0x09, 0x18, 0x91, 0x41, 0x64, 0xBA, 0x94, 0xFA, 0xAB, 0x1F,
+    0x0B, 0x89, 0x66, 0x38, 0x06, 0x07, 0x0E, 0x1E, 0x21, 0x8B, 0x99, 0x0C, 0xB9, 0x74, 0x14, 0x01,
+    0x66, 0xFD, 0xAF, 0xCB, 0xA7, 0xF5, 0x5A, 0x10, 0xE9, 0x2E, 0x3C, 0x0F, 0x47, 0xB4, 0x9D, 0xEB,
+    0x5C, 0x57, 0x77, 0x55, 0x93, 0xED, 0x3A, 0x7D, 0x85, 0x63, 0xEC, 0x40, 0x39, 0x12, 0x61, 0xA1,
+    0xF2, 0x58, 0x9F, 0xCF, 0x64, 0x11, 0xD7, 0x50, 0x77, 0x26, 0x60, 0x26, 0x1D, 0x01, 0x45, 0xA0,
+    0x08, 0x1C, 0x43, 0x8B, 0x1D, 0xB0, 0x27, 0x1F, 0xA8, 0x7D, 0x1E, 0x31, 0x11, 0xD7, 0xD1, 0x77,
+    0x66, 0xA6, 0x9E, 0x71, 0xBE, 0x94, 0xA6, 0x90, 0x27, 0x7F, 0x1A, 0xE8, 0x25, 0x3A, 0xEC, 0x5F,
+    0xAC, 0x66, 0x24, 0x9E, 0xDF, 0x0C, 0x94, 0xCD, 0xBB, 0xF5, 0xD8, 0x9C, 0x2C, 0x47, 0xBA, 0xBC,
+    0x1F, 0x03, 0x94, 0x3A, 0xD1, 0xCF, 0x3F, 0x7D, 0xF4, 0x05, 0x7A, 0x91, 0x68, 0x44, 0x24, 0x5A,
+    0x91, 0x6F, 0x5F, 0xAF, 0x44, 0xFC, 0x65, 0xB7, 0xFB, 0xD1, 0xFE, 0xDC, 0x1F, 0x27, 0xEF, 0xAB,
+    0x44, 0xFC, 0x65, 0x2B, 0xE2, 0x2F, 0x1B, 0x11, 0x7F, 0x99, 0x6B, 0xE2, 0x2F, 0x83, 0xF9, 0x55,
+    0xFD, 0x38, 0x5F, 0xBD, 0xF6, 0xE6, 0x2A, 0xE7, 0xE1, 0x2B, 0x59, 0x30, 0x53, 0xB6, 0xE2, 0x70,
+    0x1C, 0xBB, 0xE8, 0x06, 0x1E, 0xA0, 0xF6, 0x6D, 0x58, 0xE7, 0x47, 0x9E, 0x3D, 0x57, 0x63, 0xBD,
+    0x19, 0x99, 0x78, 0x16, 0xFD, 0x33, 0x9B, 0xB8, 0x4E, 0xCD, 0xF9, 0x06, 0xA0, 0x58, 0x69, 0xA5,
+    0x18, 0xAE, 0x5C, 0xE1, 0xD9, 0x90, 0xBD, 0xD9, 0x15, 0xFF, 0x89, 0x6A, 0xE2, 0xFF, 0x1A, 0xCD,
+    0xF7, 0x7C, 0x6D, 0xBF, 0x13, 0x2A, 0x69, 0x2E, 0xDC, 0x80, 0x0B, 0x1D, 0xCC, 0x38, 0x8F, 0x09,
+    0xB9, 0x74, 0x94, 0x83, 0x7D, 0xAD, 0xA1, 0xEA, 0x6C, 0x05, 0x8E, 0x73, 0x35, 0x44, 0xB8, 0x42,
+    0x3E, 0xC1, 0x15, 0x8A, 0x11, 0x9E, 0xC5, 0x7A, 0xB8, 0x85, 0x03, 0x22, 0xB7, 0x81, 0x39, 0x9B,
+    0x79, 0x81, 0xC9, 0x84, 0x3C, 0x66, 0x93, 0xF5, 0xC5, 0x9C, 0x87, 0xBA, 0xA9, 0x26, 0x13, 0x0E,
+    0xB9, 0x12, 0xB2, 0xAB, 0x91, 0xFF, 0x2F, 0x90, 0x07, 0xF3, 0xCA, 0x48, 0x31, 0x94, 0x2F, 0x8F,
+    0xD8, 0xAE, 0x32, 0x03, 0x8E, 0xEB, 0x85, 0xE7, 0x36, 0x77, 0x9E, 0xFA, 0xF7, 0xD9, 0x9C, 0x8B,
+    0x44, 0x13, 0x72, 0x91, 0xD9, 0x7A, 0xA8, 0xA8, 0x1B, 0xA8, 0x39, 0x04, 0x6A, 0x9D, 0x85, 0x5B,
+    0x3B, 0x4D, 0x04, 0x87, 0x36, 0x94, 0x75, 0x22, 0x9B, 0xD1, 0x96, 0xF2, 0x68, 0xA0, 0xF4, 0x70,
+    0x85, 0x6C, 0x02, 0x33, 0x72, 0x85, 0xAD, 0xAD, 0xA5, 0xCF, 0x27, 0x20, 0x72, 0x08, 0xD8, 0xCE,
+    0xFA, 0x76, 0x64, 0x32, 0xA1, 0x15, 0x5F, 0x35, 0xB7, 0xCB, 0x6F, 0x2C, 0x79, 0xA8, 0xBA, 0x8B,
+    0x66, 0x74, 0x26, 0xC0, 0x95, 0xEC, 0x6A, 0x84, 0x62, 0xA0, 0x6E, 0x20, 0x52, 0x8C, 0x50, 0x37,
+    0x44, 0x28, 0x47, 0x1C, 0xE4, 0x33, 0xE5, 0x00, 0xB7, 0xC9, 0x66, 0x70, 0x0D, 0x0E, 0xAC, 0xC7,
+    0x7A, 0x8A, 0x91, 0x7C, 0x02, 0x91, 0x70, 0x08, 0x95, 0x08, 0x90, 0x1D, 0x1C, 0x5C, 0x4D, 0x93,
+    0x22, 0x97, 0x0E, 0x4A, 0xDF, 0x8A, 0x87, 0x43, 0xA6, 0xBA, 0xC3, 0x84, 0x6D, 0xA6, 0x71, 0x8B,
+    0x5C, 0x5B, 0x5C, 0x75, 0xD0, 0x42, 0x24, 0x93, 0x01, 0xEB, 0x29, 0x57, 0xDD, 0xB4, 0x5A, 0x8A,
+    0x11, 0xB8, 0xA2, 0x63, 0x7A, 0x36, 0x21, 0x0B, 0x98, 0xB1, 0x6E, 0xAA, 0xFF, 0x9B, 0xFA, 0x43,
+    0x33, 0xE2, 0xFE, 0x2C, 0x5A, 0x6F, 0x67, 0x91, 0x2E, 0xF2, 0xE6, 0xF0, 0xC0, 0x8D, 0x72, 0x28,
+    0xFF, 0x02, 0x38, 0xE4, 0xD6, 0x75, 0x30, 0xA1, 0x78, 0x29, 0x80, 0xE3, 0x11, 0xDB, 0x91, 0x4F,
+    0x66, 0x78, 0x04, 0xAA, 0xCE, 0x3D, 0x71, 0x07, 0x62, 0x26, 0xB2, 0x60, 0x7D, 0x21, 0x12, 0xB4,
+    0x23, 0x29, 0x46, 0x30, 0x03, 0x2E, 0x39, 0x6A, 0xC0, 0xFD, 0x40, 0xD6, 0xA8, 0x8F, 0x24, 0x0D,
+    0x45, 0x54, 0x47, 0xED, 0x5D, 0x27, 0xFE, 0xD5, 0x79, 0xDD, 0x0E, 0x4C, 0x80, 0xAA, 0x23, 0x8B,
+    0x50, 0x0F, 0x98, 0x15, 0xDC, 0xA0, 0xDD, 0xE5, 0xC9, 0xA3, 0x4E, 0xD3, 0x5E, 0xFD, 0xA9, 0xCD,
+    0xD3, 0x6B, 0xBB, 0x0B, 0x5E, 0x7E, 0x24, 0x1F, 0x12, 0x59, 0xE8, 0xD7, 0x6D, 0xA1, 0xBD, 0xD0,
+    0xE4, 0x0D, 0xD8, 0x25, 0x1F, 0xA1, 0x94, 0x37, 0x02, 0x98, 0x6F, 0xC8, 0x0C, 0xF9, 0x58, 0xCE,
+    0xC0, 0x45, 0xEE, 0x7A, 0xE4, 0x51, 0xB7, 0x37, 0x00, 0x44, 0x7D, 0x37, 0x5D, 0x04, 0x6E, 0x03,
+    0x54, 0x7F, 0xDE, 0x01, 0xF6, 0xAB, 0x23, 0x50, 0x86, 0x08, 0x98, 0xC9, 0x01, 0x79, 0xB4, 0x1E,
+    0x88, 0x26, 0x00, 0xC7, 0x2C, 0x40, 0x8B, 0x6B, 0xC0, 0x75, 0xE5, 0x08, 0x95, 0xCF, 0x67, 0xB0,
+    0xAF, 0x1F, 0xF4, 0x50, 0x88, 0x88, 0xC7, 0x88, 0x48, 0x20, 0x5F, 0x8F, 0x8E, 0x22, 0x2C, 0xE0,
+    0x1A, 0x7A, 0xB0, 0x03, 0xAE, 0x21, 0x9F, 0xA9, 0x7D, 0x5A, 0xFB, 0xA8, 0xBC, 0x0D, 0x50, 0x84,
+    0x62, 0x82, 0x2C, 0x9A, 0xB8, 0xAD, 0x47, 0xFC, 0x11, 0x80, 0x5D, 0x01, 0xEE, 0x1C, 0x92, 0x66,
+    0x3B, 0x96, 0x00, 0x5C, 0x2E, 0x3C, 0x70, 0x7C, 0x1B, 0xA0, 0x1F, 0xB8, 0xD7, 0xAD, 0xF6, 0x90,
+    0x3C, 0x1A, 0x5C, 0x00, 0x32, 0x19, 0x00, 0xFB, 0x5A, 0x03, 0x1C, 0x1E, 0x02, 0xE6, 0xAF, 0x67,
+    0xA0, 0x7E, 0x39, 0x00, 0x8B, 0xF5, 0x50, 0x06, 0x07, 0x38, 0x22, 0xE4, 0xB3, 0x99, 0xA0, 0xF2,
+    0x76, 0x80, 0x95, 0xBA, 0x4B, 0x8B, 0xAF, 0xFB, 0xF6, 0x13, 0x91, 0x4C, 0x44, 0x02, 0x56, 0x44,
+    0x3C, 0xFD, 0xD1, 0x51, 0x8F, 0x99, 0x60, 0xA1, 0xF6, 0x98, 0x89, 0x05, 0xCA, 0xB1, 0x0C, 0x50,
+    0x77, 0xAE, 0x81, 0xD6, 0x44, 0xC8, 0x62, 0x35, 0x40, 0x11, 0x64, 0xE7, 0x2D, 0x5B, 0xD1, 0x7D,
+    0x1E, 0xB7, 0x39, 0xB7, 0xED, 0xF6, 0xC7, 0xE2, 0x74, 0xC3, 0x32, 0xD1, 0x69, 0x27, 0x17, 0xA1,
+    0xD5, 0x1B, 0xB2, 0x63, 0xAF, 0x7F, 0xD4, 0x7E, 0xD5, 0x3F, 0xDA, 0x66, 0xD9, 0x36, 0x92, 0x98,
+    0x3A, 0x37, 0xD3, 0x3F, 0x8A, 0x29, 0x5F, 0x0E, 0x0E, 0x00, 0x1B, 0x4C, 0xF2, 0x3E, 0x7D, 0xFA,
+    0xC3, 0x75, 0xC5, 0x9D, 0x83, 0x03, 0x40, 0x0E, 0x9E, 0x0C, 0x3A, 0x16, 0x44, 0x3D, 0x3B, 0xB3,
+    0xFD, 0x51, 0xBE, 0x71, 0x74, 0x73, 0x00, 0xA8, 0x86, 0xE4, 0xA5, 0xBB, 0x2E, 0x39, 0xFE, 0x7D,
+    0xDA, 0x38, 0xB2, 0x25, 0xF9, 0xEB, 0x26, 0xA6, 0x3F, 0xCA, 0x90, 0xDC, 0x5D, 0x3B, 0x42, 0x2F,
+    0x12, 0x70, 0x1E, 0x44, 0x24, 0x40, 0x29, 0x7F, 0xA5, 0x37, 0x3B, 0xA4, 0xAB, 0x15, 0x21, 0xEB,
+    0x47, 0xEA, 0x8E, 0x76, 0x60, 0x01, 0xE7, 0x4D, 0x80, 0xBE, 0xA9, 0x3C, 0xAC, 0xF4, 0x60, 0x66,
+    0x33, 0x43, 0x19, 0xEC, 0x00, 0xB5, 0x77, 0x40, 0xFF, 0x9F, 0xAF, 0x47, 0x9D, 0x59, 0x44, 0x56,
+    0xEC, 0x8F, 0x45, 0x26, 0x5C, 0xB7, 0x40, 0xB6, 0x98, 0x00, 0x65, 0xA8, 0x3C, 0x38, 0x7F, 0x0C,
+    0xF9, 0x62, 0x26, 0xB0, 0xC1, 0x7A, 0x90, 0xA6, 0x05, 0x3B, 0xE7, 0x91, 0x4C, 0xBA, 0x72, 0xCC,
+    0xFA, 0x19, 0x27, 0x22, 0x8D, 0x86, 0x25, 0x85, 0xC8, 0xF3, 0x6A, 0xBD, 0x8F, 0xF3, 0x5E, 0x30,
+    0xD2, 0xBC, 0xB0, 0xCD, 0x21, 0xFB, 0x61, 0x19, 0xE1, 0x03, 0xF4, 0x1D, 0x9C, 0xBB, 0x6B, 0x06,
+    0x95, 0xF2, 0x03, 0x8D, 0x50, 0xB6, 0xA1, 0x5E, 0xCD, 0xB8, 0x40, 0xEB, 0x29, 0x67, 0x04, 0x4C,
+    0xCC, 0x23, 0x64, 0x8B, 0x99, 0x81, 0xB5, 0x0C, 0x80, 0xD8, 0x11, 0xE8, 0x2B, 0x0F, 0xF4, 0xB5,
+    0x07, 0x7A, 0xD7, 0x01, 0xE2, 0x3A, 0x60, 0x75, 0xCD, 0xF6, 0x33, 0x5B, 0xDA, 0x06, 0xF2, 0xD8,
+    0x36, 0xDB, 0x08, 0x28, 0x66, 0xD7, 0x81, 0x0D, 0xCE, 0x43, 0x35, 0xD6, 0x03, 0xB4, 0xDE, 0x06,
+    0x32, 0x69, 0xCA, 0x85, 0x72, 0xC5, 0xC8, 0x8F, 0x64, 0x86, 0x5E, 0x64, 0x80, 0x77, 0xEB, 0xA8,
+    0xBA, 0x94, 0x5A, 0x6A, 0xC1, 0x7C, 0x2D, 0x60, 0xA6, 0x1E, 0x33, 0x97, 0xC1, 0xCC, 0xF4, 0x66,
+    0xA6, 0xFC, 0xD9, 0x0C, 0xFD, 0x0C, 0x76, 0x06, 0x23, 0x60, 0x24, 0x60, 0x66, 0x39, 0xF5, 0x9E,
+    0xBF, 0x9E, 0xE1, 0xF6, 0xEF, 0xC2, 0xEF, 0x9C, 0xBD, 0x7B, 0xD3, 0x40, 0xBF, 0x3E, 0x3A, 0x63,
+    0x44, 0xDE, 0x88, 0x14, 0x22, 0x12, 0x29, 0x56, 0xCA, 0x85, 0x22, 0x82, 0x34, 0x26, 0x82, 0x84,
+    0x3C, 0x42, 0xBF, 0xB0, 0x42, 0xEB, 0xBA, 0x1E, 0xDC, 0x47, 0x82, 0xEB, 0x70, 0x9F, 0x8E, 0x95,
+    0xC7, 0x75, 0x7D, 0x19, 0xA8, 0x7D, 0xFD, 0xF2, 0x4C, 0xE5, 0x6D, 0x58, 0xB0, 0x83, 0x99, 0x5D,
+    0x63, 0x47, 0x56, 0x3B, 0xD8, 0x91, 0xF6, 0xC3, 0xA1, 0x0C, 0xD4, 0x2F, 0xC6, 0x22, 0x60, 0x83,
+    0x7B, 0x6C, 0xA2, 0x98, 0xED, 0x2B, 0x33, 0x26, 0x1A, 0x99, 0xC9, 0x56, 0xFA, 0x08, 0x82, 0x8D,
+    0x64, 0xD2, 0xE4, 0xD2, 0xE4, 0xD2, 0x21, 0xEB, 0x4D, 0xE9, 0x50, 0xDF, 0xAE, 0x2F, 0x65, 0x01,
+    0x9B, 0x76, 0xF6, 0xED, 0xF1, 0x60, 0x03, 0xC8, 0xB6, 0x04, 0x16, 0x3B, 0x7F, 0xF1, 0xCA, 0xB6,
+    0x74, 0xEF, 0x1E, 0x87, 0x90, 0x45, 0x07, 0x66, 0x76, 0x0D, 0x65, 0xA8, 0x3B, 0xAA, 0xA1, 0xF2,
+    0xB8, 0xCE, 0x7A, 0x7A, 0xEC, 0x90, 0x2D, 0x94, 0xA3, 0x99, 0x29, 0xC6, 0x32, 0x60, 0x42, 0xE5,
+    0x31, 0xC1, 0x75, 0xE4, 0x53, 0x0F, 0xD9, 0x9D, 0x08, 0xC8, 0x94, 0x22, 0x44, 0x7A, 0x9F, 0x42,
+    0x70, 0x0D, 0x91, 0xFB, 0xE4, 0xF7, 0xA5, 0x48, 0x38, 0x02, 0x59, 0xDC, 0x42, 0x67, 0x33, 0x6F,
+    0x2E, 0x99, 0x3A, 0x63, 0xE5, 0xB0, 0xC5, 0x63, 0x95, 0xDF, 0x7E, 0xD4, 0x1D, 0xE0, 0x64, 0x01,
+    0x27, 0xE2, 0x69, 0x45, 0x02, 0x3D, 0xE5, 0xCC, 0x4A, 0x1E, 0x59, 0xC8, 0x22, 0x11, 0x96, 0x2C,
+    0xC2, 0x92, 0xCF, 0x64, 0xD1, 0x4C, 0xE4, 0xD1, 0x4C, 0x98, 0xD9, 0x04, 0x6C, 0x28, 0x02, 0xED,
+    0x58, 0xBE, 0x71, 0x53, 0x3A, 0x2B, 0xB2, 0x60, 0x45, 0x6E, 0xA4, 0x2F, 0x3E, 0xF9, 0xF6, 0x66,
+    0x5B, 0x83, 0xDB, 0xCD, 0x22, 0x4F, 0xDF, 0x50, 0x3F, 0x7F, 0x24, 0x5D, 0x97, 0x72, 0xCE, 0x17,
+    0xC8, 0x16, 0xEC, 0x08, 0xAE, 0xE3, 0x18, 0x4C, 0xA0, 0x1C, 0xA1, 0x25, 0x53, 0x1F, 0xA0, 0xED,
+    0x60, 0xA1, 0x1E, 0xC1, 0x7A, 0x3B, 0x03, 0xD1, 0x2C, 0x40, 0xE5, 0x05, 0xC8, 0x67, 0x75, 0xD6,
+    0x3F, 0xA4, 0x9E, 0xBA, 0x1D, 0x80, 0x16, 0x69, 0xA0, 0x0C, 0x66, 0x05, 0x8E, 0xB1, 0xB3, 0x6E,
+    0x18, 0x23, 0x44, 0x10, 0xA8, 0x3C, 0x66, 0x22, 0x4F, 0xEE, 0x44, 0x87, 0x99, 0x30, 0x93, 0x86,
+    0x48, 0x6F, 0xC3, 0x06, 0x8A, 0x70, 0xE7, 0xC9, 0x05, 0x8E, 0xAD, 0x48, 0x83, 0x1D, 0x5A, 0xE9,
+    0x20, 0x72, 0xA9, 0xD9, 0xB0, 0x06, 0xDD, 0xFB, 0xD0, 0x15, 0x56, 0xC3, 0x6F, 0x44, 0xA7, 0xF4,
+    0x00, 0xD0, 0x4F, 0x00, 0xE5, 0x9D, 0x74, 0xD3, 0xEF, 0xE2, 0x5D, 0x64, 0x32, 0x3C, 0x82, 0x91,
+    0x25, 0x52, 0x7C, 0x53, 0x26, 0x6C, 0xE3, 0x06, 0xCE, 0x9F, 0x8C, 0x94, 0x4B, 0x80, 0x91, 0xF1,
+    0x0A, 0x95, 0xC4, 0xDB, 0xB4, 0xAF, 0xDE, 0x8E, 0x99, 0x50, 0x45, 0x13, 0xB1, 0x73, 0x31, 0x51,
+    0x4C, 0x76, 0xA4, 0x08, 0xD5, 0x40, 0x11, 0x6A, 0x4F, 0x19, 0x5C, 0x87, 0x1D, 0x5D, 0x83, 0x1D,
+    0x5C, 0x43, 0xE5, 0x1D, 0x38, 0xEF, 0xA0, 0xED, 0x1C, 0x48, 0xE7, 0x9A, 0x5C, 0x1A, 0xE7, 0x4B,
+    0xA1, 0x7A, 0xBD, 0x77, 0x58, 0x89, 0x57, 0xC8, 0x65, 0x78, 0x64, 0x1B, 0x9E, 0xD9, 0x0D, 0xA0,
+    0x5A, 0x80, 0x2B, 0xD7, 0x80, 0x67, 0xCA, 0x0E, 0xBE, 0x52, 0x74, 0x70, 0xBD, 0x6C, 0xC0, 0xF5,
+    0x80, 0x8D, 0xC0, 0x49, 0x50, 0xFE, 0xEB, 0x6D, 0xDF, 0x25, 0x38, 0x7F, 0x95, 0x4C, 0xC2, 0x23,
+    0xB5, 0x34, 0xB9, 0x48, 0xD5, 0x4A, 0xC8, 0xE5, 0x4F, 0x7F, 0x2C, 0x7F, 0xB2, 0x66, 0x82, 0x13,
+    0x6A, 0x2F, 0x14, 0xA2, 0x5B, 0x9A, 0x34, 0x79, 0x74, 0x1D, 0xCE, 0xB3, 0x54, 0x03, 0x76, 0xC8,
+    0xA4, 0x0C, 0x14, 0xAF, 0x5F, 0x13, 0x33, 0x93, 0x8B, 0xAC, 0x2C, 0x20, 0x32, 0xE1, 0x1A, 0xDC,
+    0xBF, 0x02, 0xEB, 0xA9, 0x07, 0x30, 0x01, 0xAB, 0x0E, 0x6A, 0xB9, 0x02, 0xAE, 0x29, 0xC4, 0x83,
+    0x0D, 0xA5, 0xCC, 0xFC, 0x4E, 0xB6, 0x3E, 0xF5, 0x3D, 0x79, 0xB5, 0x6F, 0x9C, 0x7C, 0xEB, 0xC7,
+    0x22, 0x83, 0x91, 0x6E, 0x6A, 0xE5, 0x06, 0xE7, 0x37, 0x8C, 0xEB, 0x1C, 0xE7, 0xA0, 0xE6, 0x59,
+    0x70, 0xDF, 0x5A, 0xC1, 0x4A, 0x00, 0x23, 0x0D, 0x54, 0x02, 0x99, 0xF4, 0x5D, 0x1A, 0x95, 0x5D,
+    0x39, 0x6E, 0x03, 0xC4, 0x04, 0xB2, 0xA3, 0x47, 0x27, 0x2A, 0xF9, 0xC9, 0x44, 0x2F, 0xEB, 0x9C,
+    0xAF, 0xB4, 0x73, 0x31, 0x51, 0x4D, 0x76, 0xA4, 0x9C, 0x6A, 0x4F, 0x31, 0xB9, 0x8E, 0x22, 0xB8,
+    0x46, 0xEF, 0xAB, 0x0C, 0x2D, 0xD8, 0xA1, 0x05, 0xEB, 0xDB, 0xE4, 0x07, 0xB4, 0x38, 0x9F, 0xAD,
+    0x54, 0x77, 0xAE, 0xCD, 0x14, 0x22, 0x23, 0x99, 0xAC, 0x90, 0xD6, 0xA7, 0x8F, 0xF3, 0x5E, 0xF5,
+    0xE0, 0x7A, 0xB9, 0xA9, 0xEE, 0xDB, 0x07, 0xE8, 0xBB, 0x3D, 0x87, 0xE6, 0x7C, 0xA3, 0x18, 0x20,
+    0xBD, 0x44, 0xCA, 0xF5, 0xC9, 0x48, 0xDB, 0x15, 0xB3, 0x99, 0x29, 0x43, 0xED, 0xB1, 0x7E, 0x01,
+    0xF7, 0xE1, 0x00, 0x4B, 0xDD, 0x61, 0xA6, 0x05, 0xEC, 0xCB, 0x13, 0xB4, 0xD6, 0x93, 0x47, 0x07,
+    0x76, 0x8C, 0xE0, 0xCC, 0x44, 0x3E, 0xDB, 0x40, 0xE5, 0xAB, 0x31, 0x5F, 0x71, 0x77, 0xFA, 0x11,
+    0x27, 0x2B, 0x54, 0xD2, 0xA9, 0xD7, 0x0A, 0x2F, 0x00, 0xE5, 0x04, 0xD4, 0xC3, 0xB6, 0x68, 0x7D,
+    0x7C, 0x6F, 0x59, 0xBC, 0xEF, 0xE8, 0xE8, 0xE8, 0x0B, 0xAD, 0x88, 0xBC, 0x2E, 0x22, 0x3A, 0x63,
+    0xF6, 0x37, 0x86, 0xB0, 0x7D, 0xB0, 0x6F, 0xD2, 0xA2, 0xB6, 0x07, 0x0E, 0x5D, 0xE2, 0x05, 0x72,
+    0xB9, 0x13, 0xA9, 0x45, 0x02, 0xFD, 0xAB, 0xFD, 0x90, 0xAD, 0xD4, 0xA3, 0x99, 0xE9, 0x43, 0x19,
+    0x32, 0x09, 0x76, 0x30, 0x3F, 0x9D, 0x2A, 0x6F, 0x5F, 0x9E, 0xEA, 0xAE, 0x7E, 0x2C, 0xB8, 0xE6,
+    0xD8, 0x04, 0x97, 0x45, 0x13, 0x9C, 0x09, 0xC5, 0xE8, 0xAC, 0x2F, 0x07, 0x57, 0x37, 0xD6, 0xBB,
+    0x95, 0xBA, 0x73, 0x91, 0x96, 0x2A, 0x64, 0x0B, 0xF6, 0xCE, 0x53, 0x33, 0x4E, 0x64, 0xE4, 0xB8,
+    0x5D, 0xE1, 0x72, 0xD6, 0x9C, 0x5D, 0xF1, 0x75, 0x86, 0xEB, 0xD4, 0xD7, 0x65, 0x55, 0x7D, 0x30,
+    0xC7, 0x5D, 0xEB, 0xBE, 0xBE, 0x96, 0x47, 0xEC, 0x80, 0x99, 0xB0, 0x03, 0x65, 0xA0, 0x1C, 0x53,
+    0x88, 0x5E, 0x7B, 0x8A, 0x80, 0x6B, 0x30, 0x41, 0x57, 0xBB, 0x2C, 0x82, 0x09, 0x66, 0x06, 0x33,
+    0x15, 0x01, 0xF2, 0xD9, 0x8E, 0x90, 0xCD, 0x95, 0x87, 0x6C, 0x76, 0x0D, 0x30, 0xB7, 0x00, 0x51,
+    0xD7, 0xFA, 0x08, 0x70, 0x3C, 0x01, 0xF4, 0x01, 0xA0, 0x55, 0xF7, 0xBB, 0x3B, 0x59, 0x6A, 0x57,
+    0xB6, 0x0D, 0x21, 0x85, 0xE6, 0x09, 0x3B, 0x1D, 0x80, 0x7F, 0x2B, 0x0D, 0xD0, 0x2F, 0x00, 0x6D,
+    0x82, 0xE2, 0xFE, 0x70, 0x77, 0x27, 0x95, 0xDF, 0xDE, 0x6D, 0xE6, 0xDD, 0xF6, 0xB2, 0xF7, 0xCA,
+    0x78, 0xBE, 0xC1, 0x4C, 0xF5, 0x02, 0xB1, 0x95, 0x11, 0xD7, 0x7E, 0x34, 0x52, 0x2D, 0xB8, 0xAE,
+    0x5C, 0x28, 0x47, 0xB3, 0x92, 0x47, 0x04, 0x7A, 0xDA, 0x86, 0xDA, 0xD7, 0x9E, 0x32, 0x94, 0x23,
+    0x66, 0x56, 0xE7, 0x36, 0x82, 0xA3, 0x45, 0x5F, 0xB1, 0xA3, 0x0D, 0x94, 0xC1, 0x2C, 0x14, 0x33,
+    0xE2, 0x8B, 0xC8, 0xE1, 0xFA, 0x64, 0xA4, 0xFE, 0x9C, 0x2C, 0xD8, 0xA1, 0x9F, 0x31, 0x53, 0x76,
+    0x55, 0xF7, 0x36, 0xBD, 0xAD, 0xBA, 0xDB, 0xF6, 0x31, 0x13, 0x76, 0xF7, 0xD7, 0x9F, 0x80, 0xC2,
+    0x90, 0x35, 0xE7, 0x80, 0x72, 0x70, 0x80, 0xD5, 0x9F, 0xDE, 0x01, 0xD9, 0x3D, 0xFC, 0xAF, 0xDF,
+    0xBE, 0x5E, 0x42, 0x91, 0x23, 0x27, 0x11, 0x68, 0x65, 0x06, 0x2E, 0xED, 0xE2, 0xDD, 0xD3, 0x81,
+    0x99, 0x06, 0x2C, 0xBA, 0x8A, 0x57, 0xCB, 0x49, 0x5C, 0x76, 0x78, 0x08, 0x10, 0x0F, 0x41, 0x27,
+    0x75, 0x0A, 0xCB, 0x34, 0x64, 0x51, 0x5B, 0xA5, 0x88, 0x03, 0xD7, 0xA4, 0x98, 0x25, 0x8B, 0xD4,
+    0x1D, 0x66, 0x39, 0xB8, 0xE6, 0x93, 0xA7, 0xAA, 0x41, 0x4B, 0xFD, 0xA3, 0xA3, 0x9B, 0x1E, 0xD7,
+    0x60, 0x87, 0x14, 0x93, 0x2D, 0x50, 0x8E, 0x79, 0x84, 0x72, 0x34, 0x13, 0x14, 0x41, 0x43, 0x32,
+    0x0D, 0x5B, 0x9C, 0xD7, 0x7E, 0x3B, 0x38, 0xB8, 0x4A, 0x26, 0x32, 0x92, 0x8B, 0x0C, 0x70, 0x70,
+    0xD0, 0xFC, 0xBD, 0x6C, 0x32, 0x3C, 0xCC, 0x7B, 0x80, 0xCB, 0x3C, 0x02, 0xB8, 0x7F, 0x1D, 0x81,
+    0x4A, 0x02, 0x50, 0x48, 0x77, 0xCF, 0x40, 0xF0, 0x37, 0xDD, 0xB0, 0xD9, 0xC0, 0x97, 0xC9, 0x42,
+    0x16, 0x60, 0xBD, 0x36, 0x42, 0x2F, 0x1E, 0xEA, 0xF5, 0xEF, 0x71, 0x1F, 0x4F, 0x26, 0xAB, 0xC2,
+    0x0E, 0x23, 0x28, 0xA4, 0xD9, 0x2C, 0x96, 0xDD, 0x99, 0x77, 0x08, 0x41, 0x6F, 0xFD, 0x66, 0xB0,
+    0xDA, 0xC7, 0x0D, 0x1F, 0x28, 0x47, 0x3B, 0x24, 0x7B, 0x99, 0x99, 0xE3, 0x0D, 0x1D, 0x90, 0x83,
+    0x27, 0x43, 0x32, 0x97, 0x13, 0x91, 0x84, 0x0D, 0xE8, 0x24, 0xEE, 0xC1, 0x0E, 0x66, 0x82, 0xBA,
+    0x53, 0x64, 0x60, 0x81, 0x2C, 0xAA, 0xB1, 0xDA, 0x06, 0xAA, 0x97, 0x77, 0xB8, 0x40, 0x3E, 0xB2,
+    0x39, 0xED, 0x66, 0x64, 0x87, 0x7A, 0xC5, 0x13, 0x9F, 0xAE, 0x5C, 0xD9, 0x36, 0xB2, 0x5F, 0xB3,
+    0xF1, 0x4E, 0xE3, 0xFE, 0x6E, 0xD7, 0x50, 0x07, 0xE0, 0x26, 0xC0, 0x86, 0xBD, 0xED, 0xA9, 0xDB,
+    0xE5, 0xBB, 0xD6, 0x9D, 0x5F, 0x5A, 0x0E, 0xBB, 0x2C, 0xD1, 0xD9, 0xA5, 0xEF, 0x9A, 0x8C, 0xD0,
+    0x8A, 0x0C, 0x38, 0x91, 0x88, 0x5D, 0xB9, 0xD0, 0x19, 0x05, 0xE0, 0x3B, 0xA0, 0x1A, 0x53, 0x38,
+    0x9E, 0xB6, 0x6E, 0xBD, 0xD4, 0xB2, 0x4B, 0xDA, 0xE9, 0x4B, 0x6E, 0x0F, 0xF6, 0x3D, 0xC9, 0xB7,
+    0xB5, 0xCD, 0xC9, 0xB3, 0xDD, 0xEE, 0xBD, 0xF5, 0x70, 0xE2, 0x21, 0x2F, 0x64, 0x0D, 0x6E, 0xFD,
+    0x52, 0x84, 0x5E, 0xC4, 0x93, 0x89, 0xFC, 0x00, 0x48, 0x8B, 0xC0, 0x83, 0x9D, 0xBE, 0xBB, 0x1A,
+    0x74, 0xA1, 0xB7, 0x03, 0x94, 0x7E, 0xF3, 0x2B, 0x80, 0x4B, 0x57, 0xA1, 0x17, 0x9F, 0x89, 0x84,
+    0x5C, 0x3E, 0xFF, 0x42, 0x26, 0xE9, 0x8B, 0xFB, 0x74, 0xC5, 0xCA, 0xEB, 0x2A, 0x6A, 0xE6, 0xD4,
+    0x66, 0x97, 0x36, 0x6A, 0x13, 0xB6, 0x27, 0x7C, 0xEA, 0x53, 0xF9, 0xF6, 0x6D, 0xAC, 0x48, 0x43,
+    0x2F, 0xDD, 0x96, 0xBC, 0xBC, 0xEF, 0x06, 0x90, 0x0B, 0x68, 0x64, 0x4B, 0xFD, 0x75, 0x0F, 0xE5,
+    0xE8, 0x20, 0x9F, 0x98, 0xE0, 0x7E, 0xB2, 0xDF, 0x16, 0x5B, 0xDE, 0x77, 0x43, 0x97, 0xA9, 0x52,
+    0x1A, 0xCA, 0x57, 0x02, 0xE5, 0x78, 0x88, 0x1D, 0x8A, 0x21, 0x6B, 0xB6, 0xA5, 0xED, 0xEF, 0xD8,
+    0x96, 0x79, 0xB3, 0x1B, 0x91, 0xD5, 0xB8, 0x9B, 0x5A, 0x17, 0xEE, 0xB5, 0x0F, 0x5F, 0x90, 0x15,
+    0x0A, 0x91, 0x05, 0x23, 0x22, 0x1E, 0x19, 0xF9, 0x43, 0xDC, 0x08, 0x94, 0x33, 0x90, 0xE9, 0xB0,
+    0xF6, 0x27, 0x69, 0x5D, 0x36, 0x47, 0x40, 0x57, 0x18, 0xE7, 0x77, 0xFE, 0x8A, 0x3B, 0xB1, 0x5A,
+    0x7B, 0x62, 0x4B, 0x7D, 0x76, 0xDE, 0xBD, 0x37, 0x5F, 0xD8, 0xF5, 0x46, 0x3F, 0x70, 0x3F, 0x46,
+    0x7E, 0xD4, 0x7B, 0x4A, 0x91, 0x08, 0x95, 0xAC, 0x0D, 0x9C, 0x7F, 0x7C, 0xBB, 0x09, 0x33, 0x29,
+    0x4E, 0x45, 0x7B, 0xB6, 0xFD, 0x07, 0x0D, 0xB9, 0x08, 0x85, 0x88, 0x2F, 0xD7, 0x27, 0xC6, 0x22,
+    0x6A, 0x2F, 0xE5, 0x31, 0xDD, 0x78, 0x9B, 0xFA, 0xD9, 0x8E, 0xA9, 0x4D, 0x71, 0xDF, 0x8A, 0x53,
+    0xBA, 0x93, 0x7A, 0x00, 0x23, 0x4F, 0x4C, 0x38, 0x59, 0xC8, 0x65, 0x85, 0xEC, 0x2A, 0xC0, 0x85,
+    0x2E, 0x7F, 0x0E, 0xAE, 0x10, 0x21, 0x9B, 0x5A, 0xC0, 0xBE, 0xE6, 0x81, 0x36, 0x00, 0x66, 0xD9,
+    0x60, 0xE0, 0xDF, 0x8A, 0xD1, 0x78, 0x5F, 0x93, 0x3F, 0xC7, 0xB3, 0x44, 0xF2, 0xA9, 0x4D, 0xF7,
+    0xD1, 0x87, 0xF4, 0x25, 0xBB, 0x9B, 0xB8, 0x74, 0x15, 0x6A, 0x09, 0x54, 0x22, 0x94, 0xEB, 0x13,
+    0x63, 0x26, 0xDB, 0x10, 0x0B, 0xC9, 0x9E, 0x95, 0x4F, 0xC6, 0x75, 0x5D, 0x6A, 0x8C, 0xDB, 0x56,
+    0x6B, 0xB7, 0x35, 0xCF, 0xF9, 0xD4, 0xBD, 0x76, 0x79, 0x72, 0x50, 0x84, 0xA3, 0x97, 0x2E, 0x81,
+    0x59, 0x79, 0xC7, 0xF3, 0x50, 0xFA, 0xBA, 0x03, 0xFB, 0xD2, 0x0C, 0x54, 0x7D, 0x07, 0xB8, 0xF9,
+    0xC4, 0x37, 0x7B, 0xFC, 0xB4, 0x4D, 0x6B, 0x79, 0x5E, 0x61, 0xBA, 0x86, 0x42, 0x44, 0x3A, 0x2A,
+    0x7F, 0x41, 0x3A, 0x8E, 0xC9, 0xA4, 0x31, 0x13, 0x08, 0xD6, 0x93, 0x2F, 0xB4, 0x60, 0xE6, 0x3C,
+    0x82, 0x1D, 0x15, 0x6B, 0x77, 0x0D, 0xF4, 0x44, 0xC8, 0x63, 0x11, 0xC0, 0x86, 0xBA, 0x03, 0xD7,
+    0xAD, 0xC0, 0x6A, 0x26, 0x28, 0x26, 0xEB, 0xA1, 0xF6, 0x2D, 0x20, 0xF9, 0x0C, 0xE5, 0x64, 0x87,
+    0xB4, 0x47, 0x98, 0x25, 0x8B, 0xE0, 0xC6, 0x32, 0x50, 0xAC, 0xD4, 0xDD, 0x05, 0x19, 0x91, 0x6D,
+    0x7E, 0x74, 0x54, 0xB2, 0xDE, 0x48, 0x33, 0xA7, 0x53, 0x78, 0xDB, 0x2F, 0x00, 0xD5, 0x8B, 0x9A,
+    0x92, 0x7B, 0x59, 0xFD, 0xC8, 0xCF, 0x0E, 0x00, 0xEE, 0x23, 0x1D, 0x80, 0x53, 0x08, 0xAE, 0xD5,
+    0x9D, 0xEC, 0x58, 0xF7, 0xB2, 0xDB, 0x40, 0x2D, 0x71, 0x01, 0xFA, 0x57, 0x6F, 0x47, 0xC8, 0x04,
+    0xAB, 0xA3, 0xB8, 0x9C, 0xA1, 0x0C, 0x14, 0xCA, 0x12, 0x29, 0x02, 0x54, 0x03, 0x45, 0x80, 0xDA,
+    0x53, 0x06, 0x70, 0x1D, 0xA5, 0xE6, 0x96, 0xED, 0x00, 0xAE, 0xA1, 0xF2, 0x9A, 0x5E, 0xD1, 0x5F,
+    0x6D, 0x07, 0x0E, 0xA4, 0x03, 0xD7, 0xE4, 0xD2, 0x80, 0xF3, 0x65, 0x0F, 0xBA, 0xDB, 0xA1, 0xFB,
+    0x1D, 0xE4, 0x32, 0x3C, 0xBB, 0x17, 0x3F, 0xFD, 0x66, 0x03, 0xBC, 0x5C, 0xE8, 0x4E, 0xE2, 0x3E,
+    0x85, 0x82, 0x6A, 0x9F, 0x16, 0xAE, 0xB4, 0x76, 0x9C, 0x3F, 0x68, 0x1F, 0xDF, 0xCC, 0x7C, 0x89,
+    0x63, 0x28, 0x64, 0x5C, 0x36, 0x1B, 0xF7, 0xAF, 0x1E, 0xC7, 0x64, 0x61, 0x35, 0xB0, 0xDA, 0x57,
+    0xCD, 0x5B, 0x79, 0x8A, 0x90, 0x8C, 0xAB, 0xB6, 0x55, 0xD3, 0xAA, 0x65, 0xD5, 0xB0, 0x6A, 0x57,
+    0x35, 0xAB, 0x5A, 0xD5, 0x79, 0xDB, 0x6F, 0x36, 0xB5, 0x32, 0x5F, 0xD9, 0x59, 0xF4, 0xFE, 0xBD,
+    0x88, 0xA1, 0xD5, 0xA0, 0x7F, 0x3A, 0x1B, 0x2E, 0x94, 0x22, 0x2B, 0x56, 0x64, 0x55, 0xBE, 0x40,
+    0xF5, 0x56, 0xC8, 0xDD, 0x19, 0xB0, 0x71, 0x3D, 0x38, 0x68, 0x32, 0x11, 0xE9, 0x72, 0x11, 0x69,
+    0xCC, 0x9D, 0x83, 0x03, 0x9D, 0x79, 0x26, 0x6C, 0xA1, 0x71, 0x39, 0x6E, 0xEB, 0xB3, 0x3D, 0x01,
+    0x1C, 0xF7, 0x50, 0x47, 0x99, 0x71, 0x22, 0x93, 0xA2, 0x8E, 0x64, 0x07, 0x07, 0x4D, 0x2E, 0x32,
+    0xD2, 0xCB, 0xC4, 0x8E, 0xCC, 0x70, 0xFE, 0x2A, 0xD4, 0xD2, 0xD1, 0x4A, 0xA4, 0xFD, 0xB6, 0x34,
+    0x6D, 0x67, 0x47, 0xD7, 0xE5, 0x73, 0xE5, 0x59, 0xEC, 0x40, 0x5B, 0x04, 0xFA, 0x4F, 0x2F, 0xFF,
+    0x44, 0x3A, 0x11, 0x69, 0x9C, 0xDC, 0xC1, 0x7E, 0x3B, 0x35, 0x21, 0xA6, 0x3B, 0xB0, 0x23, 0x64,
+    0x0B, 0x39, 0xEE, 0xF5, 0x6B, 0xDE, 0x88, 0x04, 0xA5, 0x9E, 0x5C, 0x52, 0xE7, 0xFF, 0x21, 0xB8,
+    0xCE, 0x75, 0x70, 0xFF, 0x7A, 0xD6, 0x65, 0x87, 0x52, 0xBA, 0xB3, 0x7E, 0xFF, 0x6F, 0x88, 0x85,
+    0x8A, 0x26, 0xF7, 0x5C, 0xE7, 0x3A, 0xE6, 0x4E, 0xDF, 0x69, 0x63, 0xFB, 0xFD, 0xBC, 0x5C, 0xF6,
+    0xB8, 0x22, 0x3B, 0x99, 0x48, 0xA0, 0xFD, 0xB6, 0x34, 0xD5, 0x68, 0x66, 0x33, 0x53, 0x77, 0x2D,
+    0x66, 0xB2, 0x03, 0x6D, 0x16, 0xA9, 0xC7, 0xFA, 0x3B, 0xFD, 0x6C, 0x44, 0x16, 0x9C, 0xDC, 0xC1,
+    0xBC, 0xDE, 0xEC, 0x2F, 0x9F, 0x4D, 0xDA, 0x1F, 0xAB, 0x81, 0x7F, 0x84, 0x7C, 0xBB, 0xC7, 0x88,
+    0x04, 0x4A, 0x99, 0xB7, 0xDD, 0x88, 0xDF, 0xDD, 0xDD, 0xA3, 0xEC, 0x6E, 0xF4, 0xBD, 0xF7, 0xC8,
+    0x6A, 0xFC, 0x46, 0x58, 0x8C, 0xBC, 0x4B, 0x37, 0xB4, 0xA6, 0x6B, 0xE7, 0xFB, 0x88, 0xCE, 0x81,
+    0xDA, 0xAB, 0x10, 0xF1, 0xC5, 0xF2, 0xD4, 0x54, 0xCC, 0xAC, 0x66, 0xA6, 0xFE, 0x54, 0xC4, 0x0E,
+    0x0B, 0x45, 0x68, 0x29, 0xE7, 0xFA, 0x3B, 0xFD, 0x6C, 0x45, 0x26, 0x23, 0x72, 0x83, 0xE5, 0xEA,
+    0x99, 0x8D, 0x7B, 0x4D, 0xB6, 0x32, 0xF2, 0x44, 0xC4, 0x89, 0xEC, 0x6D, 0xDC, 0xBF, 0x29, 0x26,
+    0xB0, 0x1B, 0x69, 0x88, 0xDD, 0xD7, 0x98, 0x13, 0x40, 0x52, 0x1A, 0x40, 0x4E, 0x22, 0xC3, 0x06,
+    0xFA, 0x95, 0x4C, 0x24, 0x64, 0xF2, 0xD1, 0x25, 0x5B, 0x71, 0xDD, 0x4A, 0x39, 0xB6, 0x98, 0xC9,
+    0x35, 0x59, 0xAC, 0x7C, 0xBE, 0x96, 0xAF, 0xDF, 0x5C, 0x8D, 0xC8, 0x82, 0xC8, 0x0F, 0x70, 0x8F,
+    0x9F, 0x75, 0x06, 0x3B, 0x28, 0x26, 0xDE, 0x86, 0x7C, 0xBB, 0xC7, 0x8A, 0x78, 0x8D, 0x40, 0x9F,
+    0xEA, 0xC0, 0x76, 0xFA, 0xDE, 0x62, 0x80, 0x3C, 0x24, 0x5E, 0x58, 0x15, 0x21, 0x5F, 0xB7, 0xEB,
+    0xFF, 0x21, 0x0F, 0x80, 0xF5, 0x75, 0x93, 0xC0, 0x94, 0xBA, 0x6F, 0xB6, 0x46, 0xF6, 0xCD, 0x0E,
+    0xE3, 0xDC, 0xC5, 0xE2, 0x22, 0x9A, 0xA5, 0x19, 0x35, 0x57, 0x98, 0xB0, 0xA9, 0x9D, 0x8B, 0xB2,
+    0x87, 0x19, 0x79, 0x74, 0x25, 0x48, 0xAF, 0xAC, 0x07, 0x07, 0x0D, 0xAD, 0xC8, 0x48, 0x2D, 0x32,
+    0x61, 0x5F, 0x3D, 0x78, 0xFC, 0xEE, 0xCF, 0xFC, 0x7C, 0x9C, 0xC9, 0x8A, 0xAC, 0x18, 0x11, 0x69,
+    0x32, 0x11, 0xF1, 0x70, 0xA1, 0xCB, 0x9E, 0xC3, 0x76, 0x75, 0x43, 0xF5, 0x99, 0x09, 0x5C, 0xDF,
+    0xA4, 0x28, 0xAD, 0x6F, 0xF6, 0xFD, 0x89, 0x4B, 0x0D, 0x94, 0x32, 0xEA, 0x2C, 0xAD, 0x5E, 0x6F,
+    0x87, 0x6C, 0xC5, 0x75, 0x76, 0xE4, 0x98, 0x16, 0x33, 0x99, 0x89, 0xCA, 0x57, 0x3E, 0x5F, 0xE9,
+    0xFF, 0x07, 0x19, 0x8D, 0x66, 0x55, 0xD6, 0x06, 0xF7, 0xF8, 0x29, 0x6A, 0xD2, 0xB0, 0x79, 0x60,
+    0x6D, 0x43, 0x87, 0x7C, 0xBB, 0x07, 0x91, 0x98, 0x9C, 0x9C, 0x64, 0xA5, 0xFC, 0xF9, 0x5D, 0xBA,
+    0x3A, 0x97, 0x01, 0xA8, 0x3F, 0xE7, 0xC1, 0x4C, 0x55, 0x07, 0x8E, 0x0A, 0xB8, 0x7A, 0x36, 0x2A,
+    0x7C, 0xB7, 0xDC, 0x21, 0x39, 0x38, 0xBD, 0xC8, 0x82, 0x5D, 0xC9, 0x03, 0xD2, 0x6D, 0x3E, 0xB8,
+    0x3A, 0x47, 0xEA, 0xF5, 0x55, 0x27, 0x5E, 0x9F, 0x3A, 0x87, 0x9A, 0xD3, 0x15, 0xD4, 0xC9, 0x36,
+    0xB2, 0xD8, 0x81, 0x4A, 0x82, 0x6B, 0xE8, 0xE5, 0xC5, 0x05, 0x38, 0x2E, 0x26, 0x30, 0xB3, 0x86,
+    0x74, 0xAE, 0x83, 0x16, 0x81, 0x2C, 0xE6, 0x0B, 0x94, 0xA3, 0xE6, 0x7E, 0xCB, 0x85, 0x2C, 0x52,
+    0xCA, 0x8F, 0x24, 0x50, 0x8A, 0x88, 0x27, 0x57, 0x0F, 0x32, 0xD1, 0xC1, 0xBE, 0xC8, 0x96, 0x06,
+    0xEB, 0x67, 0xA0, 0x77, 0xC0, 0xB1, 0x09, 0x70, 0x9B, 0x47, 0x4E, 0x45, 0x66, 0xE7, 0x1B, 0xA0,
+    0x5D, 0xCD, 0x48, 0x2F, 0x7F, 0x3D, 0xA9, 0x63, 0xD3, 0x7A, 0x23, 0x38, 0x4F, 0xDF, 0xD5, 0x9E,
+    0x6A, 0xB0, 0xA3, 0x32, 0x05, 0xB2, 0x98, 0x47, 0xE8, 0x59, 0xC1, 0x75, 0xAE, 0xC1, 0x0E, 0x76,
+    0x50, 0x46, 0xA7, 0x89, 0x44, 0xB2, 0x55, 0x37, 0x5B, 0x3B, 0x20, 0x83, 0x89, 0xBC, 0x19, 0x68,
+    0xBF, 0xB3, 0x44, 0xAC, 0xC4, 0x63, 0xE8, 0x27, 0xD7, 0x90, 0x5D, 0xB5, 0x7E, 0x9B, 0x9F, 0xF9,
+    0x09, 0x62, 0xDA, 0x63, 0x6E, 0xD0, 0x37, 0x88, 0x48, 0x87, 0x13, 0x69, 0xC8, 0x7A, 0xCD, 0x07,
+    0xE5, 0x9E, 0x11, 0x6C, 0x67, 0x3B, 0xA8, 0xFF, 0xF7, 0x08, 0x38, 0x19, 0x00, 0x77, 0x4F, 0x8F,
+    0xFE, 0x82, 0xAC, 0x4D, 0x72, 0x85, 0x6A, 0x11, 0x69, 0x8C, 0x74, 0xDC, 0xD2, 0xD0, 0x28, 0xDF,
+    0x0B, 0xAD, 0xF6, 0xFA, 0xC2, 0xF9, 0x94, 0x56, 0xDF, 0xE0, 0x44, 0xE7, 0xD3, 0x3A, 0x23, 0xF2,
+    0xD8, 0x44, 0x21, 0xD1, 0x0E, 0xD4, 0x12, 0xDA, 0x06, 0xEA, 0x4F, 0x2D, 0x9B, 0x37, 0x6A, 0x26,
+    0x3B, 0x42, 0xE5, 0x9D, 0x87, 0x96, 0xBE, 0x21, 0x9F, 0x11, 0xB0, 0x43, 0x2E, 0x0D, 0x2D, 0xB9,
+    0xBC, 0xD1, 0x47, 0x72, 0x4D, 0xC3, 0xF7, 0x72, 0x27, 0x6D, 0xD0, 0xF0, 0x49, 0xDE, 0x0F, 0x1F,
+    0xA0, 0x86, 0xE2, 0x4E, 0xDF, 0x80, 0x48, 0xA7, 0x31, 0xE7, 0x3E, 0x26, 0x7E, 0x09, 0xC8, 0x64,
+    0xB6, 0x5D, 0x2E, 0xF2, 0xD5, 0x21, 0x97, 0x3F, 0xF9, 0x59, 0x50, 0x37, 0x48, 0xC8, 0x57, 0x7A,
+    0x68, 0x1B, 0xD7, 0x51, 0xF9, 0x6A, 0xA0, 0x08, 0x65, 0x20, 0x8F, 0x66, 0x86, 0x55, 0xF9, 0x1E,
+    0xAE, 0xA1, 0xF2, 0xD6, 0x63, 0x83, 0x09, 0x14, 0x33, 0x11, 0xB3, 0xE2, 0x1A, 0x23, 0x8D, 0x0D,
+    0xE6, 0x35, 0x9F, 0xC9, 0x93, 0x3F, 0x0B, 0x38, 0xF9, 0xC9, 0x4C, 0x2E, 0xC3, 0x02, 0xE7, 0x9B,
+    0x7D, 0xB8, 0x7A, 0x9B, 0xF8, 0x79, 0xE4, 0x1D, 0x4D, 0xBE, 0x60, 0x44, 0x56, 0x10, 0x59, 0xE0,
+    0x82, 0xFC, 0x80, 0x93, 0x7C, 0x98, 0xCE, 0x2C, 0x9D, 0xB2, 0x3A, 0xE3, 0xB3, 0xEE, 0x2D, 0x62,
+    0xD5, 0xDF, 0xEC, 0x1E, 0xD1, 0x4D, 0xD9, 0x35, 0xBB, 0x80, 0x2F, 0x00, 0x7C, 0xEC, 0xF4, 0x5D,
+    0xFC, 0x86, 0xF7, 0xC8, 0x6F, 0xC9, 0x92, 0x04, 0x90, 0x3F, 0x07, 0x50, 0x75, 0xBB, 0x2D, 0x44,
+    0xD9, 0xB9, 0x57, 0x00, 0x32, 0x25, 0xC6, 0x6C, 0xEF, 0xEC, 0xB6, 0x1D, 0x38, 0x0F, 0x3B, 0xFA,
+    0x64, 0xDC, 0xB1, 0x25, 0xCF, 0xF3, 0xDB, 0xB1, 0x80, 0x71, 0xE1, 0x39, 0x00, 0xC5, 0x15, 0x8C,
+    0x78, 0xC0, 0xBC, 0xAE, 0x0C, 0xAF, 0xAA, 0x01, 0x13, 0xF2, 0x00, 0x5C, 0x3D, 0x9B, 0x12, 0xCB,
+    0x27, 0x28, 0x07, 0x16, 0x12, 0x17, 0x95, 0x48, 0xE5, 0xA1, 0xA5, 0x1C, 0xA1, 0xF6, 0x46, 0xE3,
+    0xCC, 0xB8, 0xF7, 0x72, 0x7D, 0xF2, 0x72, 0x67, 0x26, 0xB0, 0x03, 0xEB, 0xC1, 0xC1, 0x47, 0xA7,
+    0x44, 0x72, 0xAA, 0x45, 0x44, 0xB0, 0x6F, 0x1C, 0x1D, 0xF5, 0xDB, 0xCB, 0x11, 0x4C, 0xA0, 0x25,
+    0x21, 0xEB, 0xF4, 0xD8, 0xE1, 0xE4, 0xD3, 0xD9, 0xD9, 0x97, 0x95, 0x38, 0xE6, 0x3A, 0x13, 0xF6,
+    0x5E, 0x26, 0xFF, 0x02, 0x50, 0x07, 0xC8, 0x64, 0x84, 0xEA, 0xEB, 0x5E, 0xB3, 0xB9, 0x75, 0x63,
+    0xBB, 0xBD, 0x6D, 0xF3, 0x42, 0x97, 0x7C, 0xB9, 0x2C, 0x6E, 0xA3, 0xDA, 0x75, 0xC9, 0x78, 0x26,
+    0x6C, 0xA3, 0xFD, 0x98, 0xC7, 0x31, 0x53, 0xBD, 0x62, 0xBF, 0x2A, 0x82, 0x6B, 0x3F, 0xBA, 0x64,
+    0x32, 0x98, 0xB9, 0x5C, 0xB0, 0xA3, 0x1B, 0x71, 0x9D, 0xC0, 0x52, 0x4C, 0x98, 0xA9, 0xF6, 0x54,
+    0xFE, 0x18, 0x7A, 0x4D, 0xB0, 0x7A, 0x4D, 0xFD, 0xBA, 0x7C, 0x26, 0x8B, 0x76, 0xA4, 0x0C, 0xAE,
+    0xC1, 0x75, 0x11, 0x96, 0x22, 0x60, 0x42, 0xDD, 0x51, 0xF9, 0x05, 0x8E, 0x15, 0xE9, 0xAD, 0xCF,
+    0x46, 0xE1, 0x6A, 0xBB, 0xF3, 0xED, 0xE7, 0x0F, 0x0E, 0xFA, 0xC7, 0x2B, 0x11, 0x11, 0x89, 0xB5,
+    0xFE, 0xBA, 0xD4, 0x1F, 0x1C, 0x3C, 0xB1, 0x3C, 0x4E, 0xAF, 0x6D, 0x5F, 0xB5, 0xDB, 0x17, 0x75,
+    0x97, 0xD5, 0xC0, 0x99, 0x28, 0xEB, 0x4E, 0x7F, 0x99, 0x37, 0x8E, 0x8E, 0x6E, 0x8E, 0x24, 0x1B,
+    0x17, 0x01, 0xAC, 0x57, 0x40, 0xC0, 0xA7, 0xCE, 0x4B, 0x76, 0xC4, 0xFA, 0xBB, 0xDB, 0x90, 0x3A,
+    0x22, 0x65, 0x3D, 0x70, 0x6A, 0xA3, 0x36, 0x0D, 0xFD, 0x33, 0x66, 0x0C, 0x29, 0x8E, 0xAE, 0x45,
+    0x46, 0x3E, 0xFA, 0xFA, 0xC1, 0xCE, 0x8C, 0x60, 0xA6, 0x6A, 0xC1, 0xBE, 0x2C, 0x0B, 0xCE, 0x7D,
+    0x29, 0x66, 0x6F, 0x8E, 0xC5, 0x54, 0xAE, 0x67, 0xCD, 0x18, 0xAA, 0x64, 0xC6, 0xF6, 0x5E, 0x66,
+    0x1C, 0x7E, 0x9E, 0x19, 0xF9, 0x38, 0x1F, 0xA3, 0x8A, 0xC6, 0x23, 0xEB, 0x31, 0xE5, 0xBF, 0x93,
+    0xC0, 0xE5, 0x4C, 0x1A, 0x9A, 0xD3, 0x19, 0x43, 0x89, 0xD0, 0x4A, 0x80, 0x6B, 0x77, 0xDE, 0xAA,
+    0xCB, 0xD3, 0xFA, 0xA6, 0x9E, 0xDA, 0xE9, 0x11, 0xD2, 0xA4, 0xDB, 0x2E, 0xC2, 0xB6, 0x44, 0x9D,
+    0xBC, 0xDD, 0x27, 0xF7, 0x33, 0x9F, 0x37, 0x8F, 0xD5, 0x35, 0x70, 0x61, 0x85, 0x4C, 0xC4, 0x53,
+    0xCA, 0xAA, 0x5B, 0xD5, 0x0D, 0x19, 0x1E, 0x72, 0xF2, 0xE3, 0xAF, 0x7E, 0x53, 0xE6, 0xAF, 0xE4,
+    0xEB, 0x3E, 0x1E, 0xBD, 0xEA, 0x45, 0x23, 0x54, 0x7E, 0xA3, 0xB7, 0x98, 0x00, 0xAD, 0x5A, 0xF6,
+    0xF8, 0xAE, 0x97, 0x3B, 0xCC, 0x04, 0x4E, 0xDB, 0x93, 0x5E, 0x26, 0x3B, 0x38, 0xD0, 0xD4, 0x9C,
+    0x48, 0xE0, 0xD2, 0x5E, 0x6D, 0x01, 0x4A, 0x14, 0x0A, 0x5C, 0x90, 0x1B, 0x7A, 0xEB, 0x56, 0x99,
+    0x14, 0x7A, 0x87, 0xC7, 0x5B, 0xD8, 0x7D, 0xCF, 0x27, 0xBD, 0x5E, 0x24, 0xBF, 0xE7, 0x93, 0xFB,
+    0x71, 0xDA, 0xB5, 0x51, 0xEF, 0xB7, 0x97, 0x11, 0xCE, 0x1F, 0x1C, 0x54, 0x22, 0xB5, 0xAC, 0x27,
+    0x35, 0x0E, 0x2B, 0x5A, 0x5C, 0x93, 0x45, 0xF2, 0x19, 0x33, 0x61, 0x02, 0x45, 0x38, 0xC9, 0xDD,
+    0x5A, 0x4F, 0xE5, 0xA9, 0x3B, 0x5C, 0x97, 0xD8, 0xC2, 0x2D, 0x1C, 0x6B, 0x2F, 0x15, 0x4D, 0xEE,
+    0x79, 0x81, 0x5B, 0xEA, 0xAB, 0x38, 0x19, 0x13, 0x57, 0xE7, 0xEA, 0x99, 0x1E, 0xCE, 0x44, 0xBC,
+    0xDE, 0xA5, 0x1D, 0x53, 0x07, 0x5B, 0x9F, 0xEE, 0xA8, 0xDE, 0x41, 0x8F, 0x4D, 0xEA, 0xF6, 0x76,
+    0xEB, 0xDE, 0xD3, 0xEF, 0xF3, 0xE9, 0xC6, 0xEE, 0x7E, 0xDF, 0x9A, 0x46, 0xC7, 0x05, 0x45, 0xBD,
+    0x13, 0x21, 0xEA, 0x1D, 0x94, 0x8F, 0xF9, 0xC2, 0xAF, 0xFF, 0x64, 0xAC, 0x25, 0x64, 0x32, 0x72,
+    0x8A, 0xE0, 0xEF, 0x9A, 0x34, 0xEB, 0xD2, 0x64, 0x75, 0x3A, 0xFD, 0xCE, 0xFE, 0x7B, 0xC4, 0x9C,
+    0xFD, 0xF7, 0x94, 0x6E, 0xAA, 0x92, 0xA8, 0xF7, 0xB4, 0x15, 0x78, 0x45, 0x6D, 0x69, 0x3E, 0xEB,
+    0x0D, 0x99, 0x49, 0xDB, 0x59, 0x04, 0x6D, 0xA6, 0x1D, 0xF4, 0x6E, 0x2A, 0xAF, 0x37, 0x53, 0x77,
+    0x7A, 0x2F, 0x2E, 0xDD, 0xCA, 0xF1, 0x49, 0xAD, 0xD8, 0x85, 0x55, 0x27, 0x45, 0x2F, 0x23, 0x5C,
+    0xD7, 0xFD, 0xAD, 0xF4, 0x1A, 0x81, 0x56, 0x8D, 0xEE, 0x8E, 0x36, 0x6E, 0xC9, 0x53, 0xE5, 0x44,
+    0x51, 0x79, 0xAC, 0x36, 0x7F, 0x7F, 0xA7, 0xB8, 0x57, 0xF3, 0xA3, 0xAE, 0x23, 0x67, 0xFF, 0xDD,
+    0x61, 0xCF, 0xFE, 0x7B, 0x20, 0x9B, 0xC8, 0xC2, 0x56, 0x81, 0xF1, 0x08, 0xD8, 0x0E, 0x23, 0x9B,
+    0xCB, 0x95, 0x00, 0x7D, 0x3B, 0xA8, 0x6B, 0x64, 0xFD, 0x5D, 0xF9, 0x88, 0x5F, 0xA7, 0xA1, 0xD4,
+    0x9F, 0x8A, 0x59, 0xCC, 0x67, 0x33, 0x99, 0x50, 0x84, 0x32, 0x94, 0xA3, 0x1D, 0xAC, 0xAF, 0x7C,
+    0xDD, 0xB9, 0xCE, 0x35, 0x8E, 0x56, 0x53, 0x98, 0x56, 0x22, 0xC7, 0x54, 0x12, 0x59, 0xB8, 0x20,
+    0x37, 0x58, 0x60, 0x25, 0x8B, 0xB0, 0x90, 0x47, 0x88, 0x68, 0xB1, 0x87, 0x92, 0xDA, 0xB4, 0xDA,
+    0xA3, 0x08, 0x98, 0x89, 0x32, 0x60, 0x42, 0x02, 0x18, 0x95, 0xD7, 0x60, 0x3D, 0x76, 0xD0, 0x0A,
+    0x11, 0xEA, 0x8E, 0xCA, 0x27, 0x4E, 0xAE, 0x6B, 0xA8, 0x3B, 0xDA, 0x8D, 0x60, 0xED, 0xD0, 0x22,
+    0x11, 0x74, 0x71, 0x8C, 0xA7, 0x2E, 0x78, 0x61, 0xC5, 0xCC, 0xB4, 0x12, 0xCC, 0x44, 0x2F, 0xA3,
+    0x3A, 0x98, 0x89, 0x13, 0x33, 0x9E, 0x78, 0x63, 0xBD, 0x87, 0x5C, 0x04, 0xC8, 0x25, 0x02, 0xF9,
+    0x56, 0xF8, 0x05, 0x5C, 0x68, 0x78, 0x8E, 0x16, 0x3B, 0x9A, 0xA8, 0xD4, 0xEF, 0x85, 0xF3, 0x70,
+    0xE3, 0x8C, 0xAF, 0xBD, 0x62, 0xBD, 0x99, 0x68, 0xB5, 0x9C, 0xA5, 0xC5, 0x8E, 0xF9, 0x8C, 0x6B,
+    0xEC, 0x40, 0xC4, 0x51, 0x84, 0x2C, 0x52, 0x77, 0x65, 0x60, 0xD1, 0x22, 0x97, 0x05, 0xEB, 0x4D,
+    0xA0, 0xD5, 0x44, 0xF1, 0x31, 0x76, 0x30, 0x33, 0x4E, 0xB7, 0x76, 0x47, 0x39, 0xEA, 0xDB, 0x47,
+    0x16, 0x5C, 0xF3, 0x56, 0x0B, 0x76, 0x9B, 0xC6, 0xA0, 0x15, 0x9F, 0x62, 0x32, 0xA5, 0x03, 0x70,
+    0xDF, 0x73, 0x40, 0x19, 0x37, 0x82, 0x40, 0xF1, 0xD3, 0x90, 0x32, 0x83, 0xE5, 0x60, 0x46, 0x4E,
+    0xB2, 0x6A, 0x1B, 0x0E, 0x36, 0x6C, 0x5F, 0x9B, 0xDD, 0x13, 0x58, 0x98, 0xEE, 0x05, 0x2C, 0xDC,
+    0x0B, 0x72, 0x70, 0xF7, 0x7A, 0xE5, 0xF8, 0xF4, 0x2B, 0xEA, 0xBC, 0xED, 0xBD, 0xD2, 0x6C, 0x1B,
+    0xCA, 0xDE, 0x2B, 0xEB, 0xEE, 0x2B, 0xFB, 0x4E, 0xD7, 0x72, 0x9C, 0xF8, 0x2D, 0x58, 0xDB, 0x90,
+    0xC4, 0x2F, 0x00, 0xD5, 0xC6, 0x3A, 0xB5, 0xDF, 0x1B, 0xC9, 0x62, 0xE9, 0xA9, 0x3A, 0xEB, 0xB9,
+    0x78, 0x3A, 0x3A, 0x75, 0xCD, 0xCF, 0xD9, 0xFB, 0xB6, 0xCD, 0xEC, 0x2D, 0xF7, 0xBE, 0x2E, 0xB5,
+    0xE8, 0x5E, 0x7B, 0xDF, 0xB0, 0x5F, 0x7D, 0x75, 0xF2, 0xF6, 0x25, 0xA5, 0xAC, 0x6A, 0x69, 0x14,
+    0x03, 0xC8, 0xB5, 0x7E, 0xA1, 0x1C, 0xC8, 0x67, 0xEC, 0x80, 0x0D, 0x54, 0x1E, 0xE7, 0xA9, 0x3C,
+    0x02, 0x75, 0x97, 0xBC, 0xF8, 0x00, 0x8E, 0x7A, 0x48, 0x61, 0x14, 0x7D, 0xBE, 0x00, 0x6B, 0x39,
+    0x01, 0x4B, 0x3D, 0x00, 0xB1, 0x6F, 0x20, 0x5B, 0x75, 0xA8, 0x4A, 0x03, 0x46, 0x6E, 0x7A, 0x30,
+    0x8B, 0xEE, 0x65, 0x76, 0x84, 0x22, 0xE8, 0x74, 0x37, 0x33, 0xD8, 0x21, 0x15, 0x57, 0x2C, 0x6C,
+    0x97, 0xF2, 0x69, 0x05, 0xD2, 0x4D, 0xA7, 0xF6, 0x38, 0xB0, 0x03, 0xED, 0xE9, 0x4C, 0xFD, 0x49,
+    0xBC, 0xA0, 0xA5, 0x51, 0x29, 0x93, 0xD0, 0xEC, 0x02, 0x06, 0x6E, 0x71, 0xC2, 0x3D, 0xF9, 0x45,
+    0x5D, 0x4C, 0x30, 0x13, 0xCE, 0x5B, 0x9F, 0x47, 0x5A, 0x6A, 0x9F, 0xC5, 0x3C, 0x52, 0x8E, 0xB5,
+    0xC7, 0x3D, 0x1A, 0x21, 0xD6, 0x9E, 0xE2, 0x27, 0x11, 0xEA, 0x9B, 0x83, 0xC6, 0xE7, 0x46, 0x04,
+    0xEC, 0xB4, 0x40, 0x9B, 0x47, 0xAD, 0x51, 0xB0, 0x43, 0x19, 0x76, 0x33, 0xCB, 0x17, 0x81, 0xB6,
+    0xA9, 0x3B, 0x56, 0x25, 0x02, 0x9F, 0x69, 0x7C, 0xDD, 0x6D, 0x5D, 0x33, 0xA4, 0x76, 0x6B, 0x3C,
+    0x73, 0xB2, 0x86, 0x9F, 0x6A, 0x4E, 0xFE, 0xAB, 0x6F, 0x4E, 0xFE, 0x05, 0xA8, 0x07, 0xB2, 0x45,
+    0x07, 0xCB, 0xA2, 0xBB, 0xCD, 0xDE, 0x36, 0x52, 0x37, 0xB0, 0xB0, 0x39, 0xA9, 0x1C, 0xEB, 0x38,
+    0xB3, 0xEA, 0x90, 0xE6, 0xA9, 0x9E, 0xC6, 0x35, 0x10, 0xF5, 0x4D, 0x75, 0x47, 0x8A, 0x4C, 0x76,
+    0x6F, 0x52, 0xD2, 0x30, 0x4E, 0xCD, 0x5F, 0xA6, 0x37, 0x89, 0xC8, 0x2B, 0x22, 0xF2, 0x94, 0x48,
+    0xD4, 0x25, 0xA1, 0x6D, 0x30, 0xEA, 0x4A, 0xE5, 0x93, 0x76, 0xE5, 0xC5, 0x93, 0x00, 0x61, 0xEF,
+    0xC3, 0x2E, 0x5D, 0xE1, 0x4C, 0x8B, 0x06, 0x52, 0x3C, 0xB2, 0x25, 0xD3, 0x76, 0x2D, 0xBA, 0xBB,
+    0xD9, 0x5B, 0x8B, 0xEE, 0x6A, 0xB6, 0xAE, 0x36, 0xAE, 0x21, 0x3B, 0x73, 0x3B, 0xE9, 0x62, 0x7D,
+    0x5A, 0xD2, 0xF6, 0x6E, 0x27, 0x5D, 0xEC, 0x1E, 0x2D, 0x3A, 0xB1, 0x51, 0x39, 0x2A, 0xA8, 0x9C,
+    0x8A, 0x1D, 0x4F, 0xF8, 0x26, 0x1A, 0xBB, 0x5A, 0xAF, 0x35, 0x48, 0xA3, 0x52, 0x67, 0x2E, 0x02,
+    0x8A, 0xE1, 0x52, 0x04, 0xF2, 0x78, 0x6F, 0xAF, 0xA5, 0x49, 0x79, 0xAE, 0xBF, 0xD1, 0x8B, 0x99,
+    0xEE, 0xE1, 0xC5, 0x6C, 0x14, 0x0D, 0x13, 0xC8, 0x75, 0xDB, 0xBF, 0x05, 0x97, 0x13, 0xC1, 0xA5,
+    0x1C, 0xF2, 0xE7, 0x71, 0x8D, 0xF5, 0x59, 0xE4, 0x36, 0x45, 0x30, 0x23, 0x75, 0x57, 0xC3, 0x42,
+    0xC0, 0x84, 0x2C, 0xCD, 0x96, 0x7E, 0xE3, 0x01, 0xBC, 0x95, 0x77, 0xFE, 0x37, 0x2D, 0x68, 0xF9,
+    0xC9, 0xDB, 0x45, 0x66, 0x44, 0x64, 0x28, 0xD4, 0x38, 0x17, 0xBA, 0x3F, 0xC4, 0xFA, 0x48, 0xF5,
+    0xD2, 0x4C, 0xFD, 0x72, 0xC0, 0xFD, 0xB1, 0xC7, 0x7D, 0xA4, 0xC1, 0xFD, 0xCE, 0x89, 0x1B, 0x90,
+    0x6A, 0xEA, 0xB3, 0xB3, 0x1E, 0xC5, 0xE6, 0x4D, 0xDC, 0xCB, 0xA3, 0xD8, 0xBC, 0x89, 0x33, 0x1E,
+    0xC5, 0xAE, 0xDF, 0xB5, 0xF8, 0xE9, 0xCC, 0x9B, 0xB9, 0xBB, 0x9E, 0x3F, 0xF2, 0xDE, 0x2C, 0xB2,
+    0xE4, 0x73, 0xB6, 0x98, 0x29, 0x8B, 0x66, 0xE2, 0x63, 0x7F, 0xA3, 0x17, 0x23, 0x32, 0x3B, 0x91,
+    0xA9, 0x15, 0x09, 0x5C, 0xE8, 0x30, 0x81, 0x2C, 0x6A, 0x34, 0xD7, 0x61, 0x87, 0xED, 0xDF, 0xC7,
+    0x5B, 0x1A, 0xB8, 0x48, 0xFF, 0xBE, 0xD0, 0xB8, 0x0F, 0x07, 0xFB, 0x52, 0x2C, 0x42, 0x9F, 0xC7,
+    0xF3, 0xDB, 0xEB, 0x67, 0x06, 0xC2, 0xA9, 0x7F, 0x2B, 0x3E, 0xA0, 0xDC, 0xB6, 0xB7, 0xB0, 0x83,
+    0xD7, 0x49, 0xE4, 0x1E, 0x6D, 0x70, 0x95, 0xA7, 0x95, 0x4E, 0xEB, 0x37, 0x06, 0x8A, 0x15, 0xDA,
+    0x08, 0x2E, 0xC2, 0x7F, 0xB6, 0xE7, 0xA4, 0x6D, 0x5F, 0x65, 0x47, 0x05, 0xED, 0xAD, 0xC8, 0x52,
+    0x89, 0x44, 0xB2, 0xE7, 0xB0, 0x9E, 0x96, 0x3C, 0x62, 0x47, 0x5C, 0xB3, 0xD3, 0x50, 0x58, 0x30,
+    0x13, 0x95, 0xA7, 0xFD, 0x64, 0x2E, 0xC1, 0xAE, 0xF4, 0xBE, 0x8A, 0xB9, 0x84, 0x42, 0xBA, 0x73,
+    0x0B, 0x26, 0x50, 0x79, 0x8E, 0x13, 0x59, 0xD4, 0x91, 0xC5, 0x94, 0xA5, 0x05, 0xB8, 0xF0, 0xFC,
+    0x49, 0x19, 0x40, 0x02, 0x9F, 0x14, 0xEC, 0x4B, 0xEB, 0xA7, 0x2E, 0xEF, 0xD9, 0x5D, 0x70, 0xE2,
+    0xB1, 0x96, 0x4C, 0x2A, 0x02, 0xA1, 0x85, 0x06, 0x75, 0x04, 0xEB, 0x8D, 0x0C, 0x64, 0x11, 0x77,
+    0x0C, 0x75, 0x67, 0x7E, 0x1A, 0x30, 0x13, 0x87, 0xAE, 0xC1, 0x51, 0x7E, 0x23, 0x52, 0x04, 0x16,
+    0xEB, 0x39, 0xC4, 0xFA, 0x63, 0xCA, 0x91, 0x58, 0x04, 0x16, 0xAA, 0xCE, 0x35, 0xD6, 0xE7, 0x73,
+    0x3E, 0x67, 0x11, 0xD7, 0x58, 0xAF, 0x6E, 0x91, 0x99, 0x68, 0x29, 0x82, 0x6B, 0x8A, 0x11, 0x67,
+    0x02, 0xB7, 0xC9, 0xE7, 0x16, 0xEB, 0xA9, 0xBE, 0xA6, 0x05, 0xC0, 0xB7, 0xA9, 0x3C, 0xE5, 0x6B,
+    0x3E, 0x9F, 0xC1, 0x45, 0x5C, 0x83, 0x11, 0x6F, 0x02, 0x54, 0x33, 0x0E, 0x90, 0x66, 0x33, 0x25,
+    0x64, 0x5F, 0xDC, 0x40, 0xB7, 0x72, 0x37, 0x4D, 0xB4, 0x48, 0x92, 0x53, 0x91, 0xD4, 0xD3, 0x0D,
+    0xAE, 0x90, 0x80, 0xAB, 0x24, 0xD2, 0xB6, 0x7F, 0xB6, 0xD0, 0xCF, 0xAC, 0xC8, 0xC8, 0x8A, 0x74,
+    0xAC, 0x08, 0xAC, 0xD9, 0x0A, 0x4B, 0x1E, 0xB5, 0x60, 0x2F, 0x8F, 0x66, 0xC6, 0xCC, 0xC5, 0x84,
+    0x99, 0x8B, 0x40, 0x31, 0x95, 0x81, 0x22, 0xD8, 0x51, 0xD3, 0xFB, 0x76, 0xAC, 0x3C, 0x76, 0xA8,
+    0xBD, 0x42, 0xA2, 0xB5, 0x57, 0xD2, 0x7F, 0x39, 0x42, 0x31, 0x20, 0xC0, 0x42, 0x35, 0x83, 0xF5,
+    0xB9, 0x78, 0x88, 0xB8, 0x05, 0x2A, 0x6F, 0xDE, 0x1C, 0xC9, 0x67, 0x9C, 0x03, 0xD7, 0x14, 0xAF,
+    0x4C, 0x98, 0xC0, 0xED, 0xCA, 0xD3, 0x62, 0x87, 0x48, 0x31, 0x12, 0xCB, 0x91, 0x63, 0xAC, 0x6F,
+    0xB1, 0x43, 0x36, 0x9B, 0x89, 0x48, 0xDD, 0xD5, 0x5D, 0xE5, 0xCD, 0x44, 0xCC, 0xD5, 0x7F, 0x74,
+    0x4D, 0x11, 0x68, 0xCD, 0xC4, 0x21, 0x26, 0x38, 0xCA, 0x81, 0xFA, 0xB3, 0x81, 0x48, 0x16, 0x8F,
+    0xB1, 0x1E, 0xFB, 0xBD, 0x21, 0x8B, 0x70, 0xAC, 0x74, 0x4E, 0xF1, 0x66, 0x52, 0x33, 0x42, 0x26,
+    0x0A, 0x2E, 0x4D, 0xBB, 0xD9, 0x78, 0x0F, 0x5F, 0x80, 0xDB, 0x9C, 0x38, 0x03, 0xB9, 0xBA, 0x0B,
+    0xAA, 0xDD, 0x50, 0x76, 0xEC, 0x53, 0x51, 0x7F, 0x4D, 0x26, 0xDD, 0xF3, 0x06, 0x9F, 0xDF, 0xE5,
+    0x1F, 0xC7, 0x5D, 0xD6, 0x71, 0xD7, 0xBC, 0xD4, 0xAC, 0xE7, 0xF8, 0x43, 0x36, 0x4E, 0x0D, 0x4E,
+    0x59, 0x59, 0x6F, 0xAA, 0xA4, 0x87, 0x96, 0x15, 0x2A, 0xAD, 0x26, 0xBB, 0xFA, 0xDB, 0x3E, 0xF4,
+    0xDF, 0xC7, 0x7D, 0x4D, 0xBA, 0xCF, 0x58, 0x77, 0x89, 0x3A, 0x64, 0xA4, 0xDB, 0x6E, 0x71, 0x2F,
+    0x45, 0xF9, 0x74, 0x83, 0x7D, 0x51, 0x22, 0xE6, 0xAF, 0x45, 0x7C, 0xB6, 0xAC, 0xD7, 0x26, 0xED,
+    0x2A, 0x37, 0xE3, 0x3A, 0x3B, 0x6B, 0xDC, 0x63, 0xE6, 0x6C, 0x85, 0x85, 0x1E, 0x5A, 0x9C, 0xA7,
+    0xF6, 0x76, 0xC4, 0x8E, 0xC5, 0x84, 0x99, 0xB3, 0x48, 0xB6, 0xBD, 0xD2, 0x51, 0x7B, 0x3B, 0x60,
+    0xC7, 0x22, 0x60, 0xA6, 0x3C, 0x92, 0x25, 0x8A, 0x7D, 0xEA, 0xAE, 0xE3, 0x5D, 0xE0, 0x95, 0x9F,
+    0x10, 0xB8, 0x8A, 0x13, 0x6E, 0x97, 0xF5, 0x5C, 0x78, 0x3E, 0x9F, 0x5C, 0x21, 0xE1, 0x8A, 0xF9,
+    0x89, 0xC8, 0x8B, 0x4D, 0xDB, 0xFE, 0xD9, 0x42, 0x29, 0x9D, 0x1D, 0x91, 0x81, 0x15, 0x3B, 0x63,
+    0xC7, 0x4C, 0x60, 0xA1, 0x1E, 0xA8, 0x06, 0xBD, 0x86, 0xEB, 0x14, 0x97, 0x35, 0xB3, 0xC6, 0x85,
+    0x65, 0xA0, 0x08, 0x7A, 0x65, 0x3B, 0x62, 0x83, 0x86, 0xA1, 0x95, 0x57, 0x7F, 0xF8, 0xF4, 0x07,
+    0xFE, 0x96, 0xF3, 0xB2, 0x3C, 0x99, 0x97, 0x6E, 0x7F, 0x5E, 0x56, 0xFB, 0xF3, 0xB2, 0x7C, 0xCB,
+    0x79, 0xC9, 0xA9, 0x79, 0x79, 0xB8, 0x3F, 0x2F, 0xEB, 0xA8, 0xDD, 0xBA, 0x3F, 0x2F, 0x5B, 0x4E,
+    0x02, 0x58, 0xB5, 0x66, 0x8A, 0x60, 0x4B, 0x0D, 0x5B, 0x45, 0x79, 0x60, 0x7E, 0x97, 0x4E, 0xDD,
+    0x3D, 0x1E, 0xC7, 0x84, 0x0D, 0xDD, 0xBD, 0xB2, 0x87, 0xEE, 0x96, 0xA3, 0x1B, 0xA9, 0x7F, 0x15,
+    0xE8, 0xEE, 0x99, 0xD0, 0x34, 0x8F, 0x5B, 0x5F, 0xF7, 0xA9, 0x98, 0xA7, 0x14, 0x9F, 0x22, 0x36,
+    0xB2, 0x83, 0x83, 0x06, 0x8C, 0x88, 0x92, 0x92, 0x3A, 0xC5, 0xF2, 0x7E, 0x2B, 0xAB, 0x4E, 0xB3,
+    0x83, 0x83, 0x06, 0x2B, 0x92, 0xC8, 0x4B, 0x27, 0x45, 0x02, 0x8F, 0xA3, 0xB4, 0xA0, 0x52, 0xC4,
+    0xD3, 0xBF, 0xDA, 0xFB, 0x62, 0xA6, 0xED, 0x5C, 0x47, 0x9F, 0x47, 0x88, 0x76, 0xC0, 0x4C, 0x2D,
+    0xD8, 0x6F, 0xCE, 0xE0, 0x3E, 0x32, 0x40, 0x74, 0x0D, 0x45, 0x88, 0x89, 0x15, 0xB7, 0x5A, 0x8F,
+    0x09, 0xAE, 0xA1, 0xEE, 0x84, 0x2C, 0x6A, 0xF1, 0x90, 0xFC, 0xD9, 0x8A, 0xD1, 0x72, 0xAA, 0x79,
+    0x97, 0xB7, 0x34, 0x5D, 0x36, 0x80, 0xF1, 0x66, 0x00, 0x73, 0xE7, 0xA6, 0x87, 0x4C, 0x07, 0x42,
+    0x3B, 0xDF, 0x73, 0x27, 0xFF, 0x2D, 0x31, 0xAC, 0xE9, 0xB2, 0x01, 0x8B, 0x6D, 0xB4, 0xE6, 0xA1,
+    0x15, 0x9F, 0xEE, 0xE8, 0xDC, 0xAF, 0xBD, 0x4C, 0x8C, 0xFC, 0xF9, 0x07, 0x3A, 0x14, 0xAB, 0xDF,
+    0x28, 0x8C, 0x26, 0xD4, 0x0D, 0x70, 0xAB, 0x18, 0x80, 0x9A, 0x09, 0xA0, 0xB9, 0xBB, 0x76, 0x47,
+    0x95, 0x0B, 0xD4, 0xEF, 0x6E, 0x95, 0xB4, 0x3B, 0xE3, 0x02, 0x45, 0x84, 0xBE, 0x53, 0x73, 0x53,
+    0x7B, 0xA8, 0x86, 0x44, 0x02, 0xEA, 0x01, 0x1B, 0xD4, 0xE0, 0x29, 0xD7, 0xA0, 0x16, 0xD7, 0x68,
+    0x20, 0xA8, 0xC9, 0xB5, 0x25, 0xA3, 0xDA, 0xBC, 0x98, 0x80, 0xDA, 0xAB, 0xD1, 0xCD, 0x04, 0x3A,
+    0xD0, 0xB0, 0xC1, 0x44, 0xC8, 0x56, 0x85, 0x14, 0x3C, 0x02, 0xD5, 0x84, 0xDA, 0x1D, 0xB7, 0xDE,
+    0x94, 0x6E, 0x33, 0x7C, 0xD6, 0xEB, 0x72, 0x91, 0x0A, 0xA9, 0xF5, 0x7E, 0x5B, 0x0D, 0xB3, 0x96,
+    0xED, 0x66, 0x6F, 0x15, 0x03, 0xD4, 0xD9, 0x74, 0xFA, 0x4E, 0x2F, 0x91, 0x06, 0x3A, 0xB5, 0x08,
+    0xDA, 0x0F, 0xD9, 0x4A, 0x35, 0xE2, 0x3A, 0xFA, 0x04, 0xEC, 0x2D, 0xE0, 0x9A, 0xCA, 0x63, 0x26,
+    0x45, 0xFB, 0x5D, 0x83, 0x09, 0x5A, 0xCA, 0xEA, 0xA0, 0xDC, 0x94, 0xA9, 0x50, 0x18, 0x2D, 0x9F,
+    0x71, 0x9E, 0x96, 0x6C, 0xA5, 0x1E, 0xB1, 0xEB, 0xB5, 0x19, 0xED, 0x13, 0xDA, 0x75, 0xBF, 0x86,
+    0xED, 0x68, 0x07, 0x14, 0xB5, 0xCD, 0x29, 0xD6, 0x92, 0xBB, 0x9B, 0xA1, 0x90, 0xCB, 0x1B, 0x0D,
+    0x88, 0xAC, 0x28, 0xEB, 0xA8, 0xF2, 0xEF, 0x5E, 0x29, 0x47, 0x9C, 0x57, 0x0C, 0x32, 0xC2, 0xA2,
+    0xBB, 0x47, 0xED, 0xB1, 0xDE, 0x8E, 0x94, 0x41, 0x77, 0x88, 0x88, 0x89, 0xB4, 0x94, 0x0B, 0x75,
+    0x2A, 0x20, 0x9E, 0x95, 0x73, 0x46, 0x54, 0x40, 0xD7, 0x75, 0x0A, 0xEE, 0xD9, 0x81, 0x05, 0x13,
+    0x70, 0x5D, 0x16, 0x29, 0x02, 0x3D, 0x2C, 0xD4, 0x1D, 0xCE, 0x6F, 0xA9, 0x4E, 0xD6, 0x2C, 0x26,
+    0x88, 0xF7, 0xE9, 0xB4, 0x19, 0xBB, 0x4E, 0x23, 0x98, 0xBA, 0xD3, 0xA0, 0x7C, 0x37, 0x5D, 0xB3,
+    0xC7, 0x71, 0x85, 0x60, 0xBF, 0x2A, 0x9D, 0xF9, 0xE1, 0x1B, 0x37, 0x32, 0x19, 0x55, 0xF9, 0xC1,
+    0x8D, 0x0A, 0xD5, 0x14, 0xD3, 0x2F, 0x92, 0xA4, 0x38, 0xF5, 0xE4, 0x72, 0x42, 0x5D, 0x35, 0xA2,
+    0x2C, 0x3C, 0xF1, 0xB4, 0x5C, 0x9B, 0xA9, 0x3B, 0x44, 0xF1, 0x56, 0x13, 0x30, 0x93, 0x22, 0xA8,
+    0x3D, 0xB8, 0xBD, 0x5D, 0xDD, 0x04, 0x6C, 0xC8, 0x22, 0xF5, 0x44, 0x2F, 0x32, 0x69, 0x15, 0xA2,
+    0x15, 0xF1, 0x98, 0xA0, 0x01, 0xD6, 0x0A, 0xC7, 0x8A, 0xD1, 0x9A, 0x09, 0xEB, 0x59, 0x95, 0x2F,
+    0x9A, 0x47, 0xCC, 0xC4, 0x31, 0x08, 0x5B, 0x46, 0xDE, 0xCC, 0x45, 0xD8, 0x82, 0x90, 0xED, 0xF1,
+    0x85, 0x9D, 0x3C, 0x98, 0xDB, 0xA1, 0x4D, 0xB6, 0x03, 0x0A, 0xBF, 0x57, 0x1B, 0x74, 0xFE, 0x2A,
+    0xF6, 0x45, 0xF1, 0xB8, 0x6A, 0x85, 0x3B, 0xEB, 0xF3, 0x8A, 0x72, 0xD6, 0x53, 0x02, 0x40, 0x4D,
+    0xDC, 0x36, 0xC5, 0xFE, 0x2E, 0x98, 0xEE, 0x17, 0x81, 0xA7, 0xF6, 0x1F, 0x7F, 0xB4, 0x7B, 0xC3,
+    0x0E, 0x48, 0xF2, 0x9B, 0x4F, 0x99, 0x5A, 0xF3, 0x8F, 0xB9, 0xAF, 0xA1, 0x18, 0x2A, 0x9F, 0x5C,
+    0x2D, 0xFB, 0x5A, 0x07, 0xB9, 0xF8, 0x8D, 0x3C, 0x71, 0x96, 0x0D, 0xF6, 0x9B, 0x34, 0x08, 0x1F,
+    0xE0, 0x42, 0xC7, 0x9C, 0x4F, 0x14, 0xE3, 0x92, 0x78, 0x6C, 0x32, 0xA4, 0x3A, 0x89, 0x4B, 0x7B,
+    0xC3, 0xD0, 0xBE, 0x28, 0x9E, 0xD8, 0xCE, 0xD8, 0x3F, 0xFF, 0x51, 0x93, 0xC9, 0xA8, 0xD6, 0x36,
+    0x6B, 0xBA, 0xC7, 0x62, 0x4A, 0xC6, 0x2E, 0xEF, 0x9D, 0x82, 0x9A, 0xDF, 0x32, 0x05, 0x45, 0x42,
+    0xC8, 0xF4, 0x2B, 0xEC, 0xAE, 0x63, 0x6E, 0x6F, 0xFA, 0x61, 0x67, 0x72, 0x9A, 0xD7, 0xE4, 0x06,
+    0x89, 0x6E, 0x26, 0x11, 0x37, 0xF2, 0x82, 0xFA, 0xB3, 0xB2, 0x43, 0x8D, 0xD7, 0xD3, 0xD4, 0xCF,
+    0xD6, 0xEF, 0xCA, 0x90, 0x64, 0x87, 0xEB, 0xB7, 0xF3, 0x56, 0x32, 0xA5, 0xA2, 0x30, 0x6D, 0xB7,
+    0x5D, 0xD7, 0xF9, 0xDD, 0x5F, 0xFA, 0xB5, 0x9F, 0xC4, 0xAC, 0xB4, 0x3F, 0xEA, 0xA3, 0x12, 0xF1,
+    0xB4, 0xDE, 0x22, 0x51, 0x2A, 0x9E, 0x4E, 0x6F, 0xDB, 0x26, 0x70, 0x75, 0x66, 0x02, 0x67, 0x07,
+    0x50, 0x6A, 0x5B, 0xBD, 0xBD, 0xF3, 0x64, 0x30, 0x53, 0x32, 0x4A, 0x9B, 0x06, 0xA8, 0x59, 0x52,
+    0x8D, 0x84, 0x0E, 0xE0, 0x98, 0x4A, 0xCF, 0xCA, 0x8D, 0xB4, 0xA9, 0x79, 0xCB, 0xF7, 0x52, 0x06,
+    0xFB, 0xEA, 0xB5, 0xD9, 0x68, 0xB6, 0x79, 0x3A, 0xC5, 0x32, 0xCB, 0x85, 0xC4, 0x06, 0xAE, 0xBE,
+    0xEE, 0x95, 0x64, 0x96, 0x4F, 0x4C, 0x77, 0x81, 0xFC, 0xBF, 0x49, 0x86, 0x7B, 0xB0, 0x83, 0xD6,
+    0x93, 0x49, 0xA0, 0xF8, 0xC9, 0x44, 0xE5, 0x23, 0x87, 0x5C, 0xE1, 0x62, 0xDA, 0xD7, 0xB3, 0x03,
+    0xA8, 0x65, 0x42, 0x24, 0x9A, 0xF5, 0x89, 0xB8, 0xA1, 0x23, 0x45, 0x5A, 0xF1, 0xCC, 0x02, 0xD9,
+    0xE6, 0x0A, 0x94, 0x92, 0x6C, 0x56, 0x0F, 0x09, 0x3B, 0x19, 0xC1, 0x0E, 0x37, 0xA8, 0xFD, 0xFA,
+    0x84, 0x74, 0x22, 0xA2, 0x16, 0x3B, 0xF8, 0x0D, 0x33, 0x44, 0xD5, 0xA9, 0x56, 0x49, 0x42, 0xA8,
+    0xDF, 0xBD, 0x63, 0xDA, 0xE4, 0x1B, 0x83, 0xD6, 0x88, 0xDF, 0x88, 0x2B, 0x7F, 0x17, 0x06, 0x79,
+    0x16, 0x78, 0x26, 0x4D, 0xC2, 0xBE, 0x49, 0xB4, 0xD7, 0x0E, 0xEA, 0x86, 0x6A, 0x85, 0xEA, 0x07,
+    0x3B, 0xA2, 0xEB, 0x15, 0x22, 0x54, 0x1F, 0x0E, 0xA9, 0x16, 0xA6, 0x90, 0x5D, 0x49, 0xCF, 0xD5,
+    0xDF, 0xD4, 0xA9, 0xF9, 0x00, 0x17, 0x3A, 0xE2, 0xCF, 0x5F, 0xD6, 0xB2, 0x83, 0x94, 0x40, 0x11,
+    0x89, 0xB8, 0x57, 0xAF, 0x79, 0xF5, 0x9A, 0xB6, 0xE0, 0xAA, 0x6D, 0xD2, 0x5D, 0x56, 0x71, 0x6B,
+    0x55, 0x1F, 0x92, 0x69, 0xB5, 0x64, 0xE7, 0x24, 0x3B, 0xFE, 0x3B, 0xE4, 0x91, 0xF5, 0x09, 0xE9,
+    0xAC, 0x12, 0xF7, 0x27, 0xA5, 0xB7, 0x59, 0x11, 0x91, 0x42, 0x44, 0xE4, 0x45, 0x11, 0x91, 0xF1,
+    0x6F, 0xCC, 0x94, 0xFD, 0x2D, 0x73, 0x68, 0xC3, 0x3D, 0x72, 0x68, 0x27, 0xD9, 0xB5, 0x7C, 0x00,
+    0x08, 0x3B, 0x0C, 0x67, 0xAF, 0xCE, 0xAD, 0xDE, 0x58, 0x61, 0xCA, 0x90, 0xD2, 0x24, 0xE2, 0x85,
+    0x06, 0x33, 0x90, 0x87, 0x94, 0x50, 0xBD, 0x20, 0xF2, 0x8A, 0xC8, 0xF4, 0xE4, 0xEB, 0x8F, 0xEF,
+    0xA1, 0xA8, 0x3B, 0xF8, 0xFC, 0x2C, 0x6A, 0x9A, 0xFE, 0x3D, 0x92, 0xAF, 0xFF, 0x3D, 0xAD, 0x50,
+    0x88, 0xE7, 0x59, 0xB8, 0x0C, 0x75, 0xC7, 0x85, 0x08, 0x35, 0x94, 0x9E, 0x22, 0x20, 0x93, 0xF2,
+    0x11, 0xEF, 0xE3, 0x42, 0xA7, 0x9C, 0x6A, 0x13, 0x96, 0x0D, 0x95, 0x91, 0x61, 0x2B, 0x07, 0xBB,
+    0x74, 0x2A, 0x9B, 0x27, 0x22, 0xB1, 0xDD, 0x7E, 0xCC, 0x29, 0xCF, 0x12, 0x4F, 0xA9, 0xC9, 0xEC,
+    0x31, 0xD1, 0xC3, 0xD6, 0x5B, 0x67, 0xE9, 0xE8, 0x27, 0x43, 0xEB, 0xB4, 0x56, 0xCD, 0xF1, 0x0E,
+    0x8E, 0x58, 0x76, 0x5A, 0x35, 0xF7, 0xF8, 0xF6, 0xE4, 0x1E, 0x2C, 0x9A, 0x62, 0x30, 0x81, 0x0B,
+    0x1F, 0x1E, 0xB0, 0x1F, 0xE9, 0xA8, 0x7F, 0x47, 0x9D, 0x8D, 0x15, 0xDE, 0x2D, 0xD2, 0x39, 0x91,
+    0xE6, 0x9D, 0xCB, 0xC1, 0x2F, 0x85, 0xA2, 0xEF, 0xC0, 0xF1, 0x0E, 0xEA, 0x57, 0x3B, 0x2A, 0xF1,
+    0x14, 0xA2, 0x89, 0xA3, 0xBF, 0xCD, 0xED, 0xB7, 0x22, 0x93, 0x2A, 0x55, 0x1D, 0xF5, 0x3F, 0x7A,
+    0x6E, 0x73, 0x98, 0xDF, 0xEA, 0xF6, 0xE3, 0xCF, 0xBD, 0xFD, 0xEC, 0x06, 0x3C, 0xA2, 0xE9, 0xAC,
+    0x08, 0xAE, 0xE3, 0x9A, 0xAC, 0x56, 0x64, 0x78, 0xF2, 0xF5, 0xC7, 0x69, 0xF5, 0xB6, 0x34, 0xE9,
+    0xE5, 0x64, 0x31, 0x22, 0xFE, 0x1F, 0xDE, 0x79, 0x7C, 0x9F, 0xE5, 0x33, 0xEE, 0x68, 0x3C, 0x2B,
+    0x94, 0x77, 0x3E, 0x46, 0x2B, 0x64, 0x12, 0x74, 0x59, 0xC9, 0x6E, 0xF0, 0x1C, 0x94, 0x6B, 0x16,
+    0xA0, 0x96, 0x1F, 0x0F, 0x70, 0xA5, 0x12, 0x0F, 0xD7, 0x33, 0xB9, 0x57, 0xBD, 0xBB, 0x03, 0x0E,
+    0x69, 0x81, 0x35, 0x25, 0x1C, 0x56, 0x20, 0x6A, 0xFE, 0x42, 0xED, 0x9E, 0x45, 0x52, 0xEC, 0x61,
+    0x26, 0x5D, 0x41, 0xB5, 0xCA, 0x4A, 0x73, 0x0A, 0x65, 0x00, 0x3B, 0x58, 0xD5, 0xED, 0x51, 0x85,
+    0x36, 0x0F, 0xB5, 0xAF, 0x3C, 0xB8, 0x4E, 0x7B, 0xC3, 0x75, 0xE0, 0xD8, 0xAF, 0x8B, 0xD7, 0xB4,
+    0x94, 0xEB, 0xC8, 0x23, 0xB5, 0xA7, 0x98, 0xA8, 0x02, 0x75, 0xC0, 0xCA, 0x97, 0x54, 0x0E, 0x6E,
+    0x05, 0x5A, 0xF9, 0x41, 0x2A, 0x7B, 0xD9, 0x17, 0x3E, 0x11, 0xB9, 0x49, 0xF1, 0xCD, 0xBB, 0x85,
+    0x4F, 0xD4, 0xC4, 0x66, 0xAE, 0xEE, 0xA2, 0x83, 0x8D, 0x2E, 0x49, 0x07, 0xC5, 0x32, 0xA8, 0xF8,
+    0x92, 0xE2, 0x2E, 0x26, 0x60, 0xA6, 0x6A, 0x07, 0xDA, 0xCC, 0x14, 0xB3, 0x1D, 0x70, 0xA3, 0x6B,
+    0x72, 0x69, 0x84, 0x2B, 0x31, 0x5F, 0x9F, 0xFC, 0x69, 0x30, 0xB2, 0xDA, 0xCE, 0xC8, 0xF0, 0xEC,
+    0xB6, 0x6C, 0x9F, 0x57, 0xAD, 0x34, 0x91, 0xDD, 0xCF, 0x7D, 0x6D, 0xD6, 0xDF, 0x2A, 0xAB, 0x66,
+    0x07, 0x07, 0x8D, 0x8A, 0x2A, 0x9E, 0x01, 0x60, 0x74, 0x6C, 0xBB, 0x4F, 0xDD, 0x0D, 0x56, 0x6D,
+    0x46, 0xB3, 0xBE, 0x07, 0x67, 0xCE, 0xDA, 0x38, 0x8B, 0xE5, 0xA8, 0x55, 0xF1, 0x6D, 0xB7, 0x60,
+    0x56, 0x33, 0x51, 0x4F, 0x36, 0x98, 0xD7, 0x7C, 0xFD, 0x6A, 0xEF, 0x70, 0x32, 0xCE, 0xB8, 0xA5,
+    0xD8, 0xE9, 0x22, 0x95, 0x14, 0x1D, 0xD8, 0xC6, 0x36, 0x50, 0xBE, 0xDA, 0x03, 0x85, 0x2C, 0xA0,
+    0xE3, 0xF9, 0xEE, 0xAA, 0xF6, 0xDF, 0x16, 0xC3, 0x6E, 0x00, 0x4C, 0xAA, 0x3C, 0xEB, 0xEF, 0x06,
+    0x60, 0x7E, 0x6D, 0xC3, 0x95, 0x07, 0x54, 0xD8, 0x26, 0x00, 0xF9, 0xEB, 0xF3, 0x4E, 0x1B, 0x31,
+    0xFD, 0x1C, 0x2E, 0x03, 0xD9, 0x1B, 0x33, 0x40, 0x3F, 0xDE, 0x0B, 0xF4, 0xFA, 0xAD, 0x59, 0x22,
+    0x2E, 0xDC, 0x00, 0x64, 0x04, 0xFB, 0xA7, 0x83, 0xAA, 0x3E, 0x66, 0xA3, 0x05, 0xE3, 0x9F, 0x81,
+    0xF2, 0xC7, 0x03, 0x94, 0xCB, 0xD9, 0xDB, 0x5B, 0x60, 0x2D, 0x76, 0x23, 0xFA, 0x1E, 0x94, 0xD2,
+    0x08, 0xD1, 0x8E, 0xAA, 0xD8, 0x54, 0x6F, 0xD8, 0x6D, 0x11, 0xEA, 0x8E, 0xDA, 0xAF, 0x64, 0xAB,
+    0x99, 0xB0, 0xB3, 0x1D, 0xE8, 0x07, 0xE7, 0x6D, 0x4F, 0xFF, 0x27, 0x31, 0x22, 0xF2, 0x99, 0x11,
+    0x99, 0xAA, 0x66, 0x03, 0x5B, 0xEE, 0x7B, 0xEE, 0x69, 0xA0, 0x08, 0x5A, 0xD0, 0xAC, 0xDC, 0xC2,
+    0xAA, 0x83, 0x7C, 0xB2, 0x1D, 0x64, 0xC1, 0x36, 0xC0, 0xC5, 0xEC, 0x6E, 0xDD, 0x1A, 0xAA, 0xAE,
+    0x08, 0x28, 0x23, 0x0A, 0x33, 0x25, 0xC3, 0xAB, 0x95, 0x74, 0xC3, 0x2B, 0x02, 0xD8, 0x21, 0xBD,
+    0xAC, 0x49, 0x67, 0x07, 0xF4, 0xE9, 0x65, 0x35, 0xBD, 0xD1, 0x5D, 0xF6, 0xEC, 0xCB, 0xAA, 0xC6,
+    0x79, 0xF6, 0xE5, 0x06, 0xD6, 0x44, 0x41, 0x30, 0x33, 0xD4, 0x9E, 0x5E, 0xB5, 0x1D, 0x03, 0x75,
+    0xC0, 0xC8, 0x8F, 0x24, 0xA0, 0xF0, 0x05, 0x99, 0xC8, 0x8D, 0x13, 0xF3, 0x2B, 0xF2, 0x95, 0x47,
+    0x3B, 0xE8, 0x40, 0x26, 0x96, 0x03, 0xC4, 0x62, 0x80, 0x17, 0x0A, 0x0F, 0xF7, 0x9F, 0x8E, 0x48,
+    0x17, 0x58, 0x35, 0x5E, 0xAF, 0x3C, 0xD6, 0x97, 0x23, 0x45, 0x50, 0xFC, 0x6A, 0x17, 0xC9, 0xB3,
+    0x45, 0xF2, 0x67, 0x5F, 0x69, 0xA9, 0x3B, 0xCD, 0xA4, 0x54, 0xA3, 0x99, 0xB0, 0x33, 0x0B, 0xE5,
+    0xA2, 0x75, 0xB2, 0xE5, 0x9D, 0x6B, 0x5F, 0xF7, 0xDA, 0x07, 0x56, 0x3E, 0x34, 0x6D, 0x88, 0xD7,
+    0x6F, 0xC1, 0x28, 0xBE, 0x7D, 0x92, 0x1A, 0x2C, 0x3D, 0x1B, 0x80, 0x93, 0x98, 0x43, 0x5A, 0x7B,
+    0x60, 0xF7, 0xE4, 0x69, 0xF6, 0x46, 0xCA, 0x80, 0x1D, 0xDB, 0xDD, 0xAA, 0x71, 0x76, 0xB8, 0x1A,
+    0x85, 0x74, 0xD7, 0xB3, 0xA3, 0xBB, 0xCD, 0x67, 0xF2, 0x68, 0x47, 0xAA, 0xD1, 0x35, 0x48, 0xB7,
+    0x50, 0x2E, 0x26, 0xF2, 0x66, 0x28, 0xEF, 0x5C, 0xFB, 0xBA, 0xB7, 0x32, 0x5F, 0x51, 0x0B, 0x66,
+    0x8D, 0x6D, 0x12, 0xA8, 0x50, 0x6D, 0xFC, 0x2E, 0xB3, 0x4B, 0x15, 0xBA, 0x09, 0xF6, 0x13, 0x8A,
+    0x79, 0xAA, 0xA3, 0x2E, 0x53, 0x23, 0xEB, 0x54, 0xFD, 0xD7, 0xAB, 0x86, 0x56, 0x92, 0xF2, 0xA3,
+    0x1C, 0xB4, 0x84, 0xE2, 0xFC, 0x59, 0xA0, 0x62, 0x1B, 0x1C, 0x76, 0x20, 0x8B, 0x8B, 0x6A, 0xDE,
+    0xC6, 0x45, 0x45, 0x6F, 0xA7, 0x05, 0xFA, 0x91, 0x32, 0x2C, 0x20, 0x23, 0x76, 0x58, 0xC8, 0xDF,
+    0x1C, 0xA9, 0xFC, 0x31, 0xE6, 0xA7, 0x23, 0xAE, 0x3B, 0xA6, 0x78, 0x65, 0xA4, 0xE5, 0x18, 0xFB,
+    0x72, 0x60, 0xE5, 0x98, 0xEA, 0x33, 0x81, 0xC8, 0x31, 0xCE, 0x84, 0x7C, 0xE6, 0x98, 0x43, 0x13,
+    0x4C, 0xE0, 0x90, 0xC5, 0x84, 0x32, 0x70, 0x48, 0x34, 0xC1, 0x0E, 0xB4, 0xF9, 0x64, 0x42, 0xE5,
+    0x69, 0x4D, 0x30, 0xC1, 0x35, 0xB4, 0xE5, 0x90, 0x07, 0x07, 0xAD, 0xF5, 0x79, 0x38, 0x06, 0x57,
+    0x77, 0x79, 0x88, 0xE0, 0x9C, 0xAE, 0xA1, 0xEE, 0x90, 0xFC, 0x67, 0x01, 0xDC, 0x2D, 0xB2, 0x9F,
+    0x8D, 0xE0, 0x66, 0x95, 0x8C, 0x75, 0x41, 0x03, 0x4A, 0x37, 0x92, 0x49, 0x03, 0x6E, 0x60, 0x27,
+    0x70, 0xB0, 0xEC, 0x88, 0x35, 0xBB, 0xC2, 0x8A, 0x54, 0x0F, 0x66, 0x66, 0x4D, 0xE9, 0x7D, 0x68,
+    0x66, 0x57, 0x5A, 0x71, 0xB7, 0x5D, 0xCC, 0x84, 0x0D, 0xD8, 0xBF, 0x18, 0x68, 0x3D, 0xBD, 0x6B,
+    0x8C, 0x60, 0xA6, 0xDB, 0x54, 0xB7, 0xA8, 0x5F, 0x9A, 0x58, 0x02, 0x4B, 0x39, 0x9A, 0x1F, 0x0E,
+    0x45, 0xA8, 0xBB, 0xBA, 0x6A, 0x5C, 0x73, 0xCC, 0xFC, 0x6C, 0x16, 0xF3, 0xB9, 0x7C, 0x71, 0xB2,
+    0x63, 0x31, 0xBA, 0x62, 0x74, 0x54, 0x9F, 0x9E, 0xEC, 0xA7, 0x67, 0x0E, 0xAD, 0xBF, 0x62, 0x7D,
+    0x36, 0x3F, 0xCB, 0x7C, 0x4C, 0xF1, 0x4A, 0x30, 0xAF, 0x04, 0xAA, 0x3F, 0x6F, 0xEC, 0x9F, 0x7B,
+    0xAE, 0xDC, 0xE2, 0xCA, 0x6D, 0x78, 0x73, 0xE0, 0xCD, 0x80, 0x11, 0x8C, 0x34, 0xD8, 0x19, 0xAB,
+    0xB0, 0x97, 0x1B, 0x00, 0x1E, 0xE8, 0x50, 0x2C, 0x15, 0x09, 0x60, 0x5E, 0x9F, 0xC1, 0xFA, 0xDB,
+    0x70, 0x85, 0x1A, 0xEE, 0x3F, 0x05, 0x1E, 0xFF, 0xA6, 0xA8, 0x63, 0xA6, 0x46, 0x6B, 0xAB, 0xF5,
+    0xEB, 0xCC, 0xEB, 0x0A, 0x70, 0xDE, 0x06, 0x1C, 0x35, 0x67, 0x9B, 0xFE, 0x5B, 0x27, 0x1D, 0x96,
+    0x35, 0xE7, 0x92, 0x2C, 0x9A, 0x1D, 0x5C, 0xD2, 0xA3, 0xBA, 0x87, 0x26, 0xDA, 0x6F, 0x4E, 0x97,
+    0xA8, 0xA8, 0x51, 0x92, 0x69, 0x19, 0x4E, 0x52, 0xD9, 0xC3, 0x8E, 0x24, 0x99, 0x9D, 0x99, 0x03,
+    0x95, 0x88, 0x0C, 0xF4, 0x5A, 0x92, 0x97, 0x44, 0x90, 0xEB, 0x71, 0x77, 0xD5, 0xA4, 0xF5, 0x72,
+    0xA2, 0xE8, 0xB4, 0x57, 0x3C, 0xA6, 0x92, 0x30, 0x27, 0x75, 0x64, 0xD9, 0xDE, 0x27, 0x64, 0xEF,
+    0x13, 0x67, 0x44, 0x64, 0xF6, 0x24, 0x50, 0xB4, 0xBA, 0x4F, 0xC9, 0xCF, 0x22, 0x22, 0xDE, 0x48,
+    0xAA, 0xFF, 0x96, 0x69, 0x47, 0x1E, 0xEE, 0x9B, 0x04, 0xC9, 0xBA, 0x24, 0x2A, 0xA3, 0x20, 0xC1,
+    0x29, 0xC4, 0x27, 0x35, 0x3F, 0x72, 0xFE, 0xE0, 0xA9, 0x90, 0x1A, 0xAC, 0x9F, 0xD9, 0x61, 0xBE,
+    0x9B, 0x06, 0x4A, 0x35, 0x6C, 0xB8, 0xF0, 0x98, 0xDA, 0x59, 0x6E, 0x50, 0xF0, 0xC9, 0x27, 0x96,
+    0x83, 0x03, 0x3D, 0x52, 0x24, 0xD5, 0x84, 0xA7, 0x32, 0x78, 0xD7, 0xEC, 0x1A, 0xAD, 0x16, 0xBF,
+    0xA7, 0x2C, 0x4F, 0x21, 0x22, 0x13, 0xB5, 0x68, 0x31, 0x88, 0x66, 0x3F, 0xB5, 0xF2, 0x6E, 0x5F,
+    0x02, 0xE6, 0x44, 0x4F, 0x67, 0xAF, 0xF2, 0x71, 0xCF, 0xDC, 0xC5, 0xBD, 0xCD, 0xBD, 0x9C, 0xA4,
+    0xD9, 0xFF, 0x66, 0x73, 0x8B, 0x48, 0x40, 0x44, 0xA4, 0x2B, 0x36, 0xC9, 0x6B, 0x6E, 0xA4, 0xFB,
+    0x28, 0x36, 0x8C, 0xE9, 0xAE, 0x7A, 0x4D, 0x27, 0x32, 0x18, 0x91, 0xC8, 0xA5, 0x83, 0x36, 0xC9,
+    0xC8, 0x64, 0x5B, 0xA5, 0xBA, 0x1D, 0x53, 0x73, 0xFA, 0x0D, 0x37, 0xDE, 0x01, 0xC4, 0xDB, 0x5B,
+    0x63, 0x6A, 0x84, 0x1D, 0x93, 0x21, 0x5B, 0x91, 0x90, 0xC8, 0x7E, 0xF7, 0x35, 0xF9, 0x73, 0x50,
+    0x75, 0x0E, 0xA8, 0x3F, 0x1C, 0x48, 0xB2, 0xA9, 0x2A, 0xCE, 0x93, 0x12, 0x30, 0x57, 0x7F, 0x6B,
+    0x06, 0x68, 0x7E, 0x83, 0x2F, 0x50, 0x0C, 0xD6, 0x53, 0x7E, 0x23, 0x26, 0x4C, 0xB2, 0x8A, 0xDB,
+    0xD7, 0xDC, 0xFF, 0x6B, 0x1D, 0xA0, 0xD9, 0x17, 0x77, 0x05, 0x03, 0xBD, 0x74, 0x60, 0xC7, 0x8B,
+    0x3B, 0x62, 0x4B, 0xB3, 0xC3, 0x49, 0xDA, 0x13, 0x12, 0xF5, 0xC9, 0xC2, 0x90, 0xED, 0x0D, 0xC8,
+    0xF9, 0x9E, 0x1F, 0x08, 0x27, 0xE6, 0x1E, 0x76, 0x50, 0x5D, 0xB5, 0xF7, 0x81, 0x13, 0xED, 0xA3,
+    0xF6, 0x64, 0x72, 0x1C, 0x9F, 0x59, 0x85, 0x2A, 0x7F, 0x9A, 0x6B, 0x63, 0x76, 0x1D, 0xA1, 0x02,
+    0xC0, 0xFD, 0xC4, 0x26, 0xFF, 0xFB, 0x34, 0x4B, 0x16, 0xF3, 0xC9, 0x04, 0x33, 0x64, 0xF0, 0x74,
+    0xE3, 0x7C, 0xED, 0x6B, 0x5F, 0x79, 0xDB, 0x65, 0xCA, 0x65, 0xB5, 0x91, 0x52, 0x9A, 0xF2, 0x95,
+    0x50, 0x0E, 0x87, 0xD6, 0x17, 0xDF, 0x68, 0xB8, 0x98, 0xDD, 0xE0, 0xB9, 0x7A, 0x2E, 0x5E, 0x94,
+    0xF5, 0xB6, 0xFD, 0xAC, 0x84, 0xEB, 0x99, 0xD0, 0xA8, 0x94, 0x8B, 0x93, 0xD8, 0xCA, 0x7C, 0xE9,
+    0xE0, 0xEA, 0x03, 0x47, 0x47, 0x5F, 0x74, 0x22, 0x8B, 0x4B, 0xE3, 0xE8, 0xCB, 0xFC, 0x57, 0xA3,
+    0xF9, 0xF1, 0x5F, 0xF5, 0x56, 0x26, 0x2B, 0x4D, 0xD6, 0xF0, 0xAE, 0xEA, 0x6B, 0xAF, 0xC7, 0xDF,
+    0xD5, 0x23, 0x76, 0xFE, 0x62, 0x3B, 0x62, 0xE7, 0xE9, 0x47, 0xE5, 0x1B, 0x4F, 0x75, 0x2E, 0x9B,
+    0xFB, 0xAF, 0x4E, 0x15, 0xCF, 0x90, 0xDD, 0x28, 0xE4, 0x33, 0xAF, 0xBE, 0x3E, 0xFE, 0xFE, 0x33,
+    0xC5, 0x9F, 0xE7, 0xAF, 0xBC, 0x19, 0xDC, 0x44, 0x03, 0x0F, 0xE6, 0xCF, 0x9B, 0xB9, 0xF6, 0xF5,
+    0xA7, 0x62, 0x36, 0x5B, 0x6F, 0xBB, 0xC8, 0x54, 0x76, 0x19, 0xF7, 0xC3, 0xF3, 0x3C, 0xF8, 0x2C,
+    0xB1, 0xFE, 0x70, 0xB0, 0xAF, 0xF9, 0x42, 0x30, 0x11, 0xAE, 0x92, 0xDF, 0x70, 0xC5, 0x78, 0xDB,
+    0xFA, 0x58, 0x7D, 0x7A, 0xAA, 0x4D, 0xB8, 0xC4, 0x7D, 0x1F, 0x7A, 0xEE, 0xD9, 0xF2, 0xA5, 0xC9,
+    0x59, 0x1F, 0x5D, 0xF1, 0x97, 0x73, 0xFD, 0xDF, 0xDC, 0xF8, 0x02, 0x4F, 0xEB, 0x77, 0x56, 0x7E,
+    0xE1, 0x76, 0x11, 0x4C, 0xA8, 0x1A, 0xDB, 0xDD, 0xE2, 0x62, 0xD6, 0xF0, 0x3E, 0x58, 0x53, 0x51,
+    0xD7, 0x27, 0xDF, 0xFB, 0xBE, 0x17, 0xB8, 0x75, 0xF8, 0xD1, 0xC9, 0xC9, 0x58, 0x4A, 0xC3, 0x55,
+    0x78, 0xBA, 0x29, 0x24, 0x54, 0x12, 0xAF, 0x70, 0xEB, 0x3A, 0x97, 0x2F, 0x72, 0x8E, 0x0A, 0xEB,
+    0xCB, 0xC1, 0x04, 0x33, 0x67, 0x91, 0x95, 0xB6, 0x71, 0xFE, 0xFC, 0x55, 0x25, 0x50, 0xD9, 0xA1,
+    0x0C, 0x66, 0xCA, 0x22, 0x91, 0x43, 0x6A, 0xCE, 0x83, 0xB3, 0x2F, 0x4F, 0x8B, 0xFB, 0x83, 0x6F,
+    0x4C, 0xCF, 0xDA, 0x0F, 0x35, 0x6F, 0xF1, 0x9E, 0xA3, 0x2C, 0xE6, 0xB3, 0x09, 0xC5, 0x58, 0xF8,
+    0xD4, 0x43, 0xCE, 0xD7, 0xBE, 0xEA, 0xB4, 0x87, 0x2A, 0xCA, 0x17, 0xBF, 0x34, 0xCA, 0xF4, 0x60,
+    0xA4, 0xA2, 0xF4, 0x50, 0x51, 0xE3, 0xBE, 0xE8, 0x96, 0xF6, 0x0B, 0xB7, 0x98, 0x81, 0x07, 0x8E,
+    0xBE, 0xE0, 0x64, 0x71, 0xA2, 0x64, 0xE4, 0x19, 0x26, 0x08, 0x64, 0x81, 0x3C, 0x60, 0x46, 0xF2,
+    0x1B, 0x3C, 0xD8, 0x54, 0x43, 0x19, 0xCC, 0x9C, 0xC7, 0x62, 0x31, 0x51, 0x29, 0x0D, 0x34, 0xD1,
+    0x7D, 0xD8, 0xBF, 0x50, 0x76, 0x57, 0xF2, 0x90, 0x29, 0x5C, 0x6C, 0x3B, 0x33, 0xBC, 0xF3, 0xCE,
+    0x47, 0xE4, 0x87, 0x32, 0x41, 0x25, 0x3F, 0x96, 0xC9, 0x36, 0x85, 0xCF, 0x02, 0x2F, 0xC0, 0x75,
+    0x4A, 0x7F, 0x7E, 0x79, 0x54, 0xA2, 0x13, 0x5F, 0x91, 0x07, 0xDE, 0xC5, 0xA5, 0x83, 0xC7, 0x24,
+    0xB6, 0xD2, 0x71, 0x5F, 0x53, 0x8C, 0xF9, 0xC4, 0x82, 0xA3, 0xF2, 0xE5, 0x68, 0xA6, 0x36, 0x56,
+    0x4B, 0x7E, 0x87, 0xFB, 0x9A, 0xC3, 0x7C, 0xB2, 0xDE, 0x65, 0xB1, 0x18, 0x6B, 0xDF, 0xCE, 0x32,
+    0xF6, 0xCD, 0xBB, 0xAA, 0xAF, 0xFD, 0x24, 0xDE, 0xCF, 0x79, 0x2E, 0xD6, 0x4D, 0x74, 0x4D, 0x74,
+    0xC4, 0x73, 0x5C, 0xCC, 0x9E, 0x47, 0x42, 0xFD, 0xD4, 0x67, 0xFC, 0xE5, 0xCB, 0xE6, 0x65, 0x7F,
+    0xBD, 0xBE, 0xD9, 0xF4, 0x23, 0x0D, 0xD9, 0xF3, 0xD6, 0x1F, 0x9A, 0x50, 0x31, 0x65, 0xC0, 0x74,
+    0xF6, 0x48, 0x94, 0x6C, 0xAA, 0xB3, 0x60, 0xBB, 0x67, 0xB3, 0xD9, 0x48, 0x11, 0x21, 0xBF, 0x71,
+    0x58, 0x0E, 0xD1, 0xFA, 0xB9, 0xFA, 0xF4, 0xE4, 0x4C, 0xB8, 0x94, 0xCA, 0xA9, 0x24, 0x56, 0x22,
+    0xB1, 0x86, 0x5B, 0x35, 0xCC, 0x57, 0x60, 0x7A, 0x24, 0x95, 0x45, 0x7F, 0x3C, 0x6F, 0x9E, 0x1E,
+    0x1F, 0xCA, 0xBF, 0xFB, 0x9D, 0xE5, 0x9A, 0x15, 0x09, 0x17, 0x6E, 0xFC, 0x11, 0xCF, 0xF3, 0x8F,
+    0x9F, 0xCD, 0x62, 0x5D, 0x04, 0xFB, 0x9A, 0x2F, 0xB7, 0x01, 0xC6, 0x83, 0x0D, 0xBD, 0xCF, 0x65,
+    0x2C, 0x7F, 0x1A, 0xEA, 0x2E, 0xDE, 0xE6, 0xD9, 0xAB, 0x9C, 0xFB, 0x32, 0x0F, 0xBF, 0xC0, 0x0B,
+    0xFD, 0x9F, 0x05, 0x27, 0xA3, 0x4D, 0x63, 0xA5, 0x2B, 0x64, 0xB2, 0x12, 0xEB, 0xE6, 0xD9, 0xCB,
+    0x3C, 0x74, 0x91, 0x73, 0xF7, 0xAC, 0x95, 0xD4, 0x59, 0xE4, 0x24, 0xEA, 0x2C, 0x3A, 0xFA, 0x9C,
+    0x88, 0x7C, 0x7F, 0xDB, 0xA6, 0x49, 0x07, 0xD4, 0x88, 0x3F, 0x38, 0xD8, 0x03, 0xEE, 0x9C, 0x88,
+    0x18, 0x11, 0x09, 0x97, 0x0E, 0x0E, 0x1E, 0xBF, 0x77, 0x09, 0xE6, 0x83, 0x69, 0x42, 0xB6, 0x69,
+    0x42, 0x3A, 0x11, 0x11, 0xF9, 0xA1, 0x88, 0x88, 0x2C, 0x4F, 0x1F, 0x1D, 0x1D, 0x1D, 0x1D, 0x75,
+    0x70, 0x3F, 0x59, 0xA4, 0x8C, 0xB4, 0x63, 0x21, 0xD4, 0x13, 0xAE, 0xE3, 0xF7, 0x4E, 0x57, 0x7D,
+    0xEB, 0x8A, 0xA4, 0x07, 0xE9, 0x9C, 0x24, 0x13, 0xAA, 0x93, 0x75, 0xEC, 0xF6, 0x2E, 0xFA, 0xDB,
+    0x3B, 0xF7, 0x4B, 0x8F, 0xE3, 0x39, 0x39, 0x83, 0xA7, 0x1C, 0x76, 0x84, 0xDC, 0x5F, 0xF5, 0x57,
+    0xA5, 0xB6, 0x12, 0x8B, 0xE1, 0xF7, 0xB3, 0xF1, 0x91, 0xFA, 0xE5, 0x54, 0xD3, 0x65, 0x1B, 0x2E,
+    0x57, 0x70, 0x7D, 0xEB, 0x69, 0x27, 0x32, 0xB9, 0xB4, 0xA4, 0x97, 0x6A, 0xD5, 0x68, 0xE1, 0x85,
+    0xDF, 0x87, 0xE9, 0x03, 0x10, 0xAE, 0x1C, 0x3C, 0x11, 0x9C, 0xC8, 0xF8, 0xE0, 0xD1, 0xD1, 0x8D,
+    0xEC, 0xF9, 0x07, 0x9A, 0x56, 0xE4, 0xE5, 0x6F, 0x2C, 0xD5, 0x43, 0xF9, 0xF0, 0xC8, 0x73, 0x17,
+    0xF8, 0x18, 0xE4, 0x1F, 0x7A, 0xE9, 0xF5, 0xD9, 0xCD, 0xC5, 0x64, 0xD6, 0x42, 0xBE, 0x31, 0x4E,
+    0x17, 0x81, 0xF3, 0xD4, 0xDE, 0xDD, 0xA8, 0x9A, 0x62, 0x60, 0xA6, 0xA6, 0x18, 0xB2, 0xE9, 0xC2,
+    0x6C, 0xE6, 0x6D, 0xA7, 0xDD, 0xEF, 0xBD, 0xAB, 0x6F, 0xD1, 0x7B, 0xA7, 0x17, 0xE4, 0x33, 0xE7,
+    0x29, 0x65, 0x37, 0x78, 0x4E, 0xC6, 0x0F, 0xD4, 0xF2, 0xE3, 0x97, 0xBF, 0x21, 0xF3, 0x33, 0xA9,
+    0xBA, 0xB6, 0x9C, 0x65, 0xB8, 0x5D, 0x0C, 0xB7, 0xAA, 0xCD, 0xF5, 0x0F, 0x5C, 0x6D, 0xFF, 0xEB,
+    0xF2, 0x5B, 0x73, 0x74, 0x9F, 0xFB, 0x6A, 0x88, 0xB7, 0xAA, 0xEE, 0xB1, 0xE1, 0x22, 0xE7, 0xA1,
+    0x6A, 0x6E, 0x9B, 0x60, 0xFF, 0xBD, 0x0B, 0x6D, 0xF7, 0xC0, 0xD1, 0xD1, 0xD1, 0x47, 0x44, 0xE4,
+    0x5B, 0x6F, 0x1C, 0x7D, 0x29, 0x4C, 0x70, 0xFD, 0x3A, 0xD4, 0x35, 0xD8, 0x3F, 0xEE, 0x30, 0xC3,
+    0xE6, 0x5C, 0x7D, 0x5F, 0x44, 0xA6, 0xFD, 0xA1, 0xB6, 0x7B, 0xF2, 0xD2, 0xC1, 0xC1, 0xE3, 0x3C,
+    0x90, 0x3D, 0x17, 0xED, 0xCB, 0xE1, 0xB0, 0xFA, 0xF4, 0x74, 0x58, 0xBE, 0x34, 0xB9, 0xFB, 0xBA,
+    0x2F, 0xD0, 0x2E, 0x7D, 0x7C, 0x3A, 0x72, 0x8B, 0x99, 0x29, 0x0B, 0xD0, 0x71, 0xE1, 0x0F, 0x3E,
+    0xDD, 0xF5, 0xB1, 0x2A, 0xE4, 0x8D, 0xE9, 0x4A, 0x2D, 0x3E, 0xBC, 0x19, 0xB3, 0xA2, 0x4B, 0x70,
+    0xE2, 0x73, 0x27, 0x25, 0x23, 0x2F, 0xC0, 0xC7, 0xF9, 0x78, 0xB5, 0x18, 0x2F, 0x6B, 0x5B, 0x7E,
+    0x47, 0xA6, 0xCB, 0x48, 0x73, 0xF5, 0x7E, 0x25, 0xDE, 0xA7, 0xD2, 0x90, 0x1D, 0x66, 0x7E, 0xCC,
+    0x65, 0x23, 0xAF, 0x4E, 0xE5, 0x77, 0x25, 0xD8, 0x8D, 0xBF, 0xFB, 0x3C, 0xA3, 0x95, 0xC7, 0x86,
+    0xFA, 0xA6, 0xF8, 0xCB, 0xB9, 0x70, 0x91, 0x8B, 0x70, 0x11, 0xEE, 0xCB, 0x7D, 0xF1, 0x6A, 0xFB,
+    0x98, 0xC8, 0x52, 0x8B, 0x74, 0xD7, 0x0B, 0x9F, 0x75, 0x9B, 0x36, 0x1D, 0xB7, 0xCB, 0x78, 0xED,
+    0x07, 0x57, 0x98, 0x0A, 0x5F, 0xD3, 0x4E, 0x46, 0x7C, 0xB5, 0xA4, 0x5F, 0xFF, 0xFC, 0x2A, 0x07,
+    0x9C, 0xFF, 0xA7, 0xCF, 0x00, 0xF0, 0xD0, 0x33, 0x70, 0x3F, 0x3C, 0xF4, 0x0C, 0xEF, 0xB8, 0xFC,
+    0x65, 0x1E, 0x82, 0x77, 0xDC, 0xFF, 0x65, 0xC0, 0x78, 0x8C, 0x87, 0xBC, 0x23, 0xEF, 0xE0, 0x6D,
+    0xC0, 0x7B, 0xB9, 0xF8, 0x1E, 0xE0, 0x99, 0x73, 0xCF, 0x9C, 0x03, 0x2E, 0x3E, 0xF4, 0xCC, 0x45,
+    0xE0, 0xDC, 0x43, 0xCF, 0x5C, 0x06, 0x1E, 0x7A, 0xE8, 0x99, 0xF7, 0x02, 0xBF, 0xFB, 0x50, 0xFA,
+    0xCE, 0xF7, 0xBE, 0x07, 0x78, 0xE6, 0x77, 0x79, 0x0F, 0xF0, 0x41, 0xC8, 0x1A, 0xB2, 0x66, 0xF7,
+    0x9D, 0xD9, 0x7F, 0xCB, 0xFF, 0xD8, 0x90, 0xAE, 0xF7, 0x0C, 0xBC, 0x4F, 0x1B, 0xC1, 0xC9, 0xAF,
+    0xD3, 0xCD, 0x6D, 0xCC, 0x58, 0x2C, 0xF9, 0x52, 0xBC, 0x2E, 0x9F, 0x1B, 0xDE, 0x0B, 0x57, 0x8F,
+    0xEB, 0xCF, 0x0C, 0x97, 0x8D, 0x77, 0x4C, 0x19, 0xFC, 0x11, 0xB5, 0x3C, 0x2A, 0x52, 0x75, 0x87,
+    0x2F, 0xF0, 0xCF, 0x1F, 0x1D, 0xAF, 0x56, 0x9E, 0x3E, 0xA9, 0x3B, 0x5C, 0xBC, 0x78, 0xFD, 0x05,
+    0x17, 0x6D, 0xA8, 0x43, 0x1F, 0x2F, 0x3F, 0x0C, 0x9C, 0xCB, 0xFF, 0xBA, 0x7F, 0x6A, 0x6C, 0x91,
+    0xAE, 0xEE, 0xEE, 0x6B, 0xF2, 0xB1, 0xB8, 0x93, 0xAF, 0xF9, 0xDC, 0x7F, 0xEF, 0x07, 0xEF, 0xA3,
+    0x01, 0x33, 0x72, 0xAB, 0xB8, 0x63, 0xA6, 0x7C, 0xA9, 0x82, 0x99, 0x7E, 0xE6, 0xFB, 0x97, 0xBF,
+    0xF6, 0xB9, 0xF1, 0x03, 0xF6, 0x7D, 0x84, 0x87, 0xDE, 0x56, 0xFA, 0xD9, 0x9A, 0x97, 0x7E, 0xF8,
+    0xD3, 0x00, 0x69, 0x19, 0xCF, 0x6F, 0x30, 0x99, 0x67, 0xBF, 0x2F, 0xF1, 0xDD, 0xAF, 0x9B, 0xC5,
+    0xFC, 0xCC, 0xBF, 0xB7, 0x2B, 0xC7, 0xBE, 0x11, 0x91, 0x3F, 0xFE, 0x54, 0xAC, 0x2E, 0x9B, 0xE1,
+    0xA1, 0x60, 0x9B, 0xFF, 0x73, 0x6C, 0xCD, 0xCB, 0x22, 0x6B, 0xBE, 0xD4, 0xE3, 0xFD, 0x5C, 0xE6,
+    0x19, 0xFA, 0x28, 0x33, 0x5F, 0x21, 0xF0, 0x9C, 0xFA, 0x75, 0x8F, 0x5F, 0xD1, 0xEA, 0x0B, 0xAD,
+    0x40, 0x1C, 0x95, 0x21, 0xD7, 0x15, 0x72, 0x83, 0x6B, 0x4B, 0x3A, 0x40, 0x11, 0xDE, 0xAD, 0x68,
+    0x14, 0xEF, 0xFC, 0x62, 0xB3, 0xE5, 0x0D, 0xEF, 0x77, 0x1A, 0x82, 0x26, 0xC1, 0xF0, 0x72, 0x02,
+    0x5A, 0x9F, 0xCB, 0x0D, 0xDE, 0xBD, 0x42, 0xAF, 0x4B, 0x6A, 0x29, 0x7A, 0x1E, 0xDD, 0x3B, 0x8F,
+    0x1A, 0xB8, 0x74, 0x70, 0x70, 0xF0, 0xB8, 0x13, 0x75, 0x5B, 0x24, 0x5E, 0x3A, 0x38, 0x38, 0x78,
+    0xFC, 0x5E, 0xCF, 0xF1, 0xCE, 0x7F, 0x05, 0x5C, 0xA0, 0x95, 0x3B, 0x50, 0xF8, 0x5E, 0x64, 0xFD,
+    0xFC, 0x53, 0xC3, 0x21, 0x17, 0x44, 0x64, 0x78, 0x04, 0xB2, 0x5E, 0xEE, 0x52, 0x66, 0xC9, 0x7A,
+    0xF9, 0x01, 0x7A, 0xD9, 0x86, 0x5A, 0x8E, 0x6E, 0x4A, 0x67, 0xD6, 0x86, 0xAC, 0xF7, 0x9A, 0x8C,
+    0xFC, 0x8C, 0xAE, 0x68, 0x75, 0x73, 0x42, 0xAE, 0x4F, 0xA0, 0xAA, 0xE9, 0x2E, 0x1D, 0x1C, 0x1C,
+    0x1C, 0x7C, 0x34, 0xF4, 0xBA, 0x58, 0xEB, 0x2F, 0x45, 0xA8, 0x54, 0x18, 0x78, 0x4F, 0x3A, 0xEC,
+    0x6A, 0x73, 0xF8, 0xFF, 0xFC, 0x7E, 0xF1, 0x19, 0xFF, 0xF0, 0x07, 0x8B, 0x0F, 0x37, 0x5F, 0xFE,
+    0x84, 0x35, 0x9F, 0x1D, 0xAB, 0x7F, 0x09, 0x57, 0xCB, 0x5B, 0xEF, 0x7F, 0xFB, 0x07, 0xDF, 0xDF,
+    0x8F, 0x5F, 0xE1, 0xCB, 0x3C, 0xF3, 0xB1, 0x6A, 0x84, 0xF7, 0xC3, 0xC5, 0x82, 0x2F, 0xBF, 0x83,
+    0xE1, 0x1F, 0x64, 0xFE, 0xFD, 0x79, 0xC3, 0xD5, 0xEC, 0xCD, 0x4F, 0x0D, 0x1F, 0x1C, 0xDF, 0xF1,
+    0x41, 0xF3, 0xBF, 0xF0, 0xAD, 0xE6, 0xCB, 0xAF, 0x7F, 0xA5, 0x1C, 0x39, 0x47, 0x33, 0xBC, 0xFF,
+    0xF7, 0xCC, 0xA7, 0xFD, 0x07, 0x1F, 0x2E, 0x4C, 0xF3, 0xE5, 0x0F, 0xFE, 0xBE, 0xF9, 0x9F, 0x86,
+    0xEA, 0x5F, 0xC2, 0xE3, 0xC5, 0x7F, 0x7C, 0x0F, 0x0F, 0xF3, 0x41, 0x3E, 0xC1, 0x27, 0x79, 0xE4,
+    0x62, 0x39, 0xC2, 0xC7, 0x78, 0x07, 0x0C, 0xE7, 0x7F, 0xAF, 0xF8, 0x4F, 0x2F, 0x0E, 0xCF, 0x5C,
+    0x36, 0x8F, 0x35, 0x9F, 0xF8, 0x44, 0x59, 0x64, 0xE3, 0xC3, 0xFF, 0x34, 0x9B, 0xBB, 0xBC, 0xC9,
+    0x3C, 0x5F, 0xE6, 0xE1, 0xAB, 0xEF, 0x78, 0xED, 0x31, 0xFF, 0x97, 0xC3, 0x07, 0xBF, 0xFC, 0xF6,
+    0x87, 0x8B, 0xB7, 0xE7, 0x5F, 0xE5, 0x2F, 0xBB, 0x0F, 0x72, 0x3E, 0x6B, 0x1E, 0xFA, 0x8F, 0xFF,
+    0xC2, 0xBF, 0xF0, 0x81, 0xC2, 0xF8, 0x2F, 0xFF, 0xDE, 0xDB, 0x4D, 0xF7, 0xE5, 0x4F, 0xBC, 0xDD,
+    0x7C, 0xDA, 0x7F, 0xE2, 0xED, 0xEF, 0xC8, 0xFD, 0x27, 0xFE, 0x8B, 0xDF, 0xC9, 0xBA, 0xEC, 0x5C,
+    0xF1, 0x6C, 0xD9, 0x59, 0xDE, 0xCE, 0xEF, 0xF1, 0x7E, 0x1E, 0xE6, 0x83, 0xC0, 0x3F, 0xE0, 0xF5,
+    0xF2, 0xFF, 0x7D, 0x3B, 0x9F, 0xC8, 0xFD, 0x3B, 0xF8, 0x20, 0x63, 0x36, 0x71, 0x31, 0xFB, 0xBD,
+    0xFC, 0x65, 0x86, 0x61, 0xFC, 0xE0, 0x27, 0xDE, 0xF1, 0x70, 0xFE, 0x7F, 0x70, 0x9B, 0xDF, 0x87,
+    0x8C, 0x8B, 0xA5, 0x69, 0xDE, 0xFE, 0x30, 0x75, 0xC7, 0x33, 0x98, 0xC0, 0xC3, 0x83, 0x79, 0xC9,
+    0xBF, 0xCF, 0x34, 0x09, 0x52, 0xB1, 0x3B, 0xF9, 0x19, 0x9D, 0x0D, 0xB7, 0x76, 0x85, 0x30, 0xE7,
+    0x4E, 0xD7, 0x5C, 0xCB, 0xA2, 0x31, 0x40, 0x2D, 0x12, 0xF7, 0xB2, 0xC7, 0x27, 0x52, 0x69, 0xC7,
+    0xF7, 0x40, 0x0F, 0x16, 0xD5, 0x29, 0x10, 0x8C, 0x88, 0x60, 0xEE, 0x1C, 0x1C, 0xEC, 0x25, 0x67,
+    0xDF, 0x52, 0x2A, 0x6D, 0xEF, 0xDB, 0x77, 0x52, 0x69, 0xBD, 0x52, 0x0C, 0x44, 0x82, 0xDB, 0xFD,
+    0xB8, 0xEB, 0x6B, 0x06, 0xEE, 0x3E, 0x3E, 0xE5, 0x43, 0x0D, 0xAA, 0x8D, 0xD2, 0x8A, 0x8C, 0xF4,
+    0x6F, 0xF4, 0x33, 0x2B, 0x45, 0x64, 0x21, 0x5B, 0x89, 0x20, 0x59, 0x84, 0x3E, 0x9F, 0x95, 0xF8,
+    0xAD, 0x3F, 0xD6, 0x22, 0x24, 0xEC, 0x35, 0x96, 0x23, 0xE5, 0x64, 0x87, 0xFF, 0xB2, 0x0F, 0xD6,
+    0x3B, 0xF1, 0x95, 0x77, 0xCB, 0xCE, 0x0F, 0xC8, 0xBE, 0x48, 0x3A, 0x88, 0x73, 0x27, 0x05, 0xF1,
+    0x56, 0x04, 0x2E, 0x2B, 0x12, 0x77, 0xF6, 0x9B, 0x7F, 0x61, 0xFB, 0x9D, 0xA0, 0x2F, 0xD3, 0x29,
+    0xF4, 0xE5, 0x17, 0xB6, 0xDF, 0xE9, 0x6F, 0xDF, 0x51, 0x73, 0x65, 0x4C, 0x02, 0xB0, 0xAD, 0xF4,
+    0x91, 0x7A, 0xA6, 0x68, 0x14, 0x95, 0x96, 0x5D, 0x60, 0xFA, 0x16, 0x2A, 0xBE, 0xDF, 0x3E, 0x38,
+    0x48, 0xE7, 0x7D, 0x39, 0x11, 0xA1, 0x78, 0xE3, 0xE8, 0xE8, 0x46, 0x8A, 0x88, 0xF7, 0xE0, 0x84,
+    0x70, 0xAF, 0x50, 0x57, 0x89, 0x2D, 0x76, 0xD3, 0xA0, 0x9D, 0xA0, 0x17, 0x69, 0x54, 0x67, 0xFE,
+    0x94, 0x5C, 0xCF, 0x35, 0x19, 0x36, 0x46, 0x4D, 0x1F, 0x71, 0x23, 0xCF, 0xE8, 0x77, 0xC9, 0x19,
+    0x31, 0xBE, 0xD3, 0x8C, 0x9A, 0x7A, 0x8F, 0x51, 0x33, 0xEC, 0x18, 0x35, 0xCB, 0xBD, 0x18, 0x35,
+    0xA7, 0x09, 0x10, 0x3F, 0x8F, 0x51, 0x63, 0x7D, 0x16, 0xA9, 0xBD, 0x99, 0xB5, 0x1C, 0xBD, 0xA5,
+    0x0C, 0xAC, 0x5A, 0xAD, 0x5E, 0xF9, 0x7C, 0x56, 0xBA, 0x67, 0x4B, 0x19, 0x54, 0xA8, 0x26, 0x2A,
+    0xE5, 0xD3, 0x75, 0x66, 0xD2, 0x83, 0x1C, 0x8F, 0x81, 0xF7, 0xDC, 0x87, 0xFD, 0xDA, 0x58, 0xFC,
+    0x74, 0x66, 0xBE, 0xCD, 0xFD, 0xE7, 0xF7, 0x12, 0x73, 0x5A, 0x57, 0x69, 0xCE, 0xD4, 0x59, 0xA6,
+    0x7F, 0xB7, 0x67, 0xEA, 0x2C, 0xEF, 0x25, 0xAF, 0xE0, 0xEF, 0x92, 0x57, 0xD8, 0x2A, 0x6B, 0xED,
+    0xA0, 0xDD, 0x70, 0x97, 0xEC, 0xC7, 0x5B, 0x2B, 0x7C, 0xC4, 0xB7, 0x22, 0xCF, 0x6E, 0x4F, 0x6E,
+    0x62, 0xD3, 0xF9, 0xBE, 0xD8, 0xF4, 0xBE, 0x02, 0x75, 0xAE, 0x72, 0x81, 0x46, 0x04, 0x44, 0xA0,
+    0x5E, 0xF6, 0xC7, 0xDC, 0x89, 0xFF, 0xAE, 0x95, 0x10, 0xB2, 0xC1, 0x5D, 0x73, 0x1A, 0x3B, 0x66,
+    0x4A, 0x70, 0x81, 0x09, 0x29, 0x94, 0x2F, 0xB6, 0x3F, 0xCA, 0x31, 0x89, 0xB9, 0xDA, 0x21, 0x55,
+    0xEE, 0xA9, 0x36, 0x82, 0xA6, 0x56, 0xDC, 0xE7, 0xD3, 0x6D, 0x3B, 0xB9, 0xA3, 0xCD, 0x6A, 0x45,
+    0x3A, 0x68, 0xA1, 0x3F, 0x12, 0x25, 0x5C, 0xAC, 0x54, 0x01, 0x16, 0x58, 0x30, 0x33, 0x44, 0x94,
+    0x58, 0x9A, 0xA9, 0x4A, 0x49, 0x24, 0xD7, 0x43, 0x40, 0xA3, 0xE6, 0x75, 0x31, 0x73, 0x92, 0x67,
+    0xD0, 0x46, 0xA9, 0x7A, 0x89, 0xD6, 0xC5, 0x56, 0xA3, 0x16, 0xB5, 0x65, 0xBD, 0x6F, 0x45, 0xE9,
+    0x4E, 0xB4, 0x0B, 0xCA, 0x4C, 0x6D, 0xA7, 0x4D, 0x9C, 0xFA, 0x54, 0x26, 0x30, 0xAA, 0xA5, 0x36,
+    0xD5, 0x91, 0x2C, 0x09, 0x24, 0x6F, 0xE2, 0x23, 0x9B, 0x4E, 0xF2, 0x46, 0x14, 0x2D, 0x12, 0x6C,
+    0xB3, 0xA9, 0x2A, 0x6F, 0x12, 0x27, 0x76, 0xD0, 0x95, 0xC1, 0x6A, 0xA9, 0x83, 0x88, 0xDC, 0x51,
+    0x05, 0xA0, 0x84, 0x16, 0x89, 0x48, 0x30, 0x01, 0x5C, 0x53, 0xC5, 0x22, 0x80, 0xC3, 0xC4, 0x52,
+    0x79, 0x27, 0x4B, 0x22, 0x9E, 0xAC, 0xA9, 0x1A, 0x7B, 0xB5, 0x9A, 0xD4, 0x58, 0xB4, 0x59, 0x59,
+    0xAC, 0x3D, 0x79, 0xC4, 0x44, 0x6D, 0x56, 0x39, 0x69, 0xB3, 0xDA, 0xD1, 0xE9, 0x69, 0x71, 0x5D,
+    0x9B, 0x54, 0x74, 0x8F, 0xA1, 0x14, 0xB9, 0xA1, 0x8B, 0xB1, 0x95, 0x74, 0x66, 0xA8, 0xA4, 0xB5,
+    0x67, 0x4F, 0xE0, 0x71, 0xD9, 0x2D, 0x3E, 0xFB, 0xAA, 0x62, 0xE7, 0xD8, 0xA7, 0x01, 0xD7, 0xEB,
+    0x4D, 0xC1, 0x8E, 0xD4, 0xA3, 0x99, 0x54, 0x0E, 0x8B, 0x3E, 0x1D, 0x3E, 0xD2, 0xE9, 0xE1, 0x02,
+    0x9A, 0xCC, 0x53, 0xAD, 0x65, 0x9D, 0x13, 0x7B, 0xAF, 0x04, 0x88, 0x59, 0xDC, 0x00, 0x77, 0xCD,
+    0x11, 0xA8, 0x2B, 0xBC, 0xEC, 0xC1, 0xEE, 0xC3, 0x49, 0x1E, 0xEE, 0xDC, 0xDD, 0x59, 0xDA, 0x7C,
+    0x4E, 0x32, 0x27, 0xB5, 0xA7, 0xF6, 0xB8, 0x8E, 0xBE, 0xC1, 0x35, 0xD9, 0x02, 0x8E, 0x62, 0x86,
+    0x16, 0x3B, 0xC2, 0x31, 0xCE, 0xA3, 0xF5, 0x7B, 0x2C, 0x79, 0x84, 0x2C, 0x2A, 0x58, 0x79, 0x6D,
+    0x38, 0x51, 0x24, 0x10, 0xC0, 0xDC, 0x69, 0x3B, 0x28, 0x82, 0x4E, 0x0C, 0x3B, 0x9C, 0x64, 0x1F,
+    0x55, 0x96, 0xC9, 0xCC, 0x50, 0xF9, 0x2C, 0x42, 0xED, 0x59, 0xD0, 0x5A, 0x01, 0x5C, 0x93, 0x94,
+    0x70, 0x5C, 0x97, 0x66, 0xFE, 0xF1, 0x86, 0x05, 0x3E, 0xCD, 0x09, 0xB6, 0x95, 0x2A, 0x55, 0xD5,
+    0x47, 0x32, 0xFB, 0x75, 0x88, 0x67, 0xF3, 0xCF, 0x26, 0x80, 0x1D, 0xB3, 0x08, 0x76, 0xA6, 0x87,
+    0x72, 0xC1, 0x75, 0x14, 0xD2, 0xD8, 0x21, 0x95, 0xCF, 0x99, 0x37, 0x43, 0x16, 0xC9, 0xDF, 0x98,
+    0xE9, 0xC9, 0xE2, 0x82, 0xEB, 0x88, 0x0E, 0x3B, 0xB0, 0x54, 0xBE, 0x08, 0x1C, 0x97, 0x21, 0x8B,
+    0xB4, 0x66, 0xE6, 0x18, 0xC7, 0x82, 0xAA, 0x9D, 0xD8, 0xA1, 0xEE, 0x2A, 0x5F, 0x84, 0xDA, 0x97,
+    0x63, 0x1E, 0x2B, 0x6F, 0x26, 0x8E, 0xED, 0xC0, 0x82, 0xFB, 0xC8, 0x48, 0x8B, 0xFD, 0xDA, 0x48,
+    0xED, 0x8B, 0x9F, 0x05, 0xCA, 0x31, 0x7F, 0x33, 0x60, 0x26, 0x64, 0x82, 0x88, 0x53, 0x43, 0x46,
+    0xA8, 0xBD, 0x1E, 0x96, 0x99, 0xA7, 0x62, 0x7E, 0xDE, 0xC5, 0x7D, 0x0D, 0x58, 0x5F, 0x8C, 0x90,
+    0x4F, 0xCA, 0x42, 0x94, 0x09, 0x28, 0x74, 0xA1, 0x78, 0xE7, 0xD9, 0xAA, 0x44, 0x5D, 0xBD, 0x5C,
+    0x03, 0x6D, 0x53, 0x8E, 0x28, 0xE1, 0x7B, 0x13, 0x74, 0x18, 0x53, 0xAA, 0x27, 0x9F, 0x29, 0x26,
+    0x68, 0x53, 0x59, 0x7D, 0x16, 0xC1, 0xCC, 0x49, 0xF1, 0xBD, 0x07, 0xAC, 0x57, 0x88, 0x5F, 0x15,
+    0x9E, 0x74, 0x07, 0xFD, 0xE3, 0x11, 0x30, 0x3F, 0x55, 0x04, 0x52, 0x25, 0xEA, 0xF6, 0x33, 0xB6,
+    0xEB, 0x5E, 0xF9, 0x70, 0xDF, 0x9C, 0x8C, 0xB5, 0xDE, 0x03, 0xFF, 0x56, 0xFC, 0xAE, 0x02, 0x2D,
+    0xC9, 0x75, 0x3C, 0x7E, 0x32, 0xFF, 0x0F, 0x53, 0xFD, 0x7E, 0xED, 0x53, 0x42, 0x99, 0x25, 0x89,
+    0x01, 0x68, 0xB5, 0xBF, 0x6A, 0x07, 0xF4, 0x1B, 0x4D, 0x40, 0xF3, 0xF9, 0x4A, 0x8B, 0x2F, 0x83,
+    0xAA, 0x01, 0xA8, 0xB6, 0x80, 0x16, 0xA6, 0xE8, 0x89, 0x95, 0x2A, 0x23, 0xA0, 0xCA, 0x05, 0xAA,
+    0x16, 0xA0, 0x31, 0xA2, 0xEA, 0x03, 0xBC, 0xE5, 0x05, 0x25, 0x41, 0xB9, 0x32, 0x6F, 0x21, 0x80,
+    0x8E, 0x2A, 0x85, 0x57, 0xF5, 0x3C, 0x0A, 0x1D, 0x5A, 0x49, 0x35, 0x66, 0xDC, 0xA9, 0x8E, 0xB8,
+    0x2E, 0x3D, 0x79, 0xB8, 0x65, 0xB9, 0xF7, 0x59, 0x31, 0x97, 0x1A, 0x32, 0x59, 0xC9, 0x45, 0xC6,
+    0x5C, 0xFE, 0x34, 0x66, 0x2B, 0xAE, 0x59, 0xB1, 0x43, 0x8F, 0x99, 0x5C, 0x93, 0xC7, 0xDA, 0xE7,
+    0x8B, 0xDD, 0xD7, 0xA7, 0x6D, 0xAF, 0xEA, 0xDA, 0x50, 0x84, 0xD4, 0xAB, 0xAE, 0x83, 0x72, 0xE2,
+    0x6D, 0xC8, 0xE7, 0x7B, 0x2A, 0x95, 0x98, 0xEA, 0x94, 0xA1, 0xF0, 0xCB, 0xA8, 0x90, 0x5D, 0x78,
+    0x1E, 0xFB, 0x4D, 0x89, 0xB4, 0x4E, 0xE6, 0xEC, 0x8D, 0x3B, 0x55, 0x28, 0x05, 0x3B, 0xB8, 0x80,
+    0x6B, 0xA4, 0x61, 0x29, 0x66, 0x4D, 0xAA, 0x57, 0xBE, 0xFF, 0x55, 0x97, 0xFB, 0x19, 0xD9, 0x74,
+    0x69, 0xEA, 0x69, 0x97, 0x23, 0xAB, 0x53, 0x69, 0x7C, 0xE5, 0x75, 0x30, 0x58, 0xBF, 0x97, 0x1A,
+    0x3B, 0x80, 0x77, 0x4B, 0xC4, 0x8A, 0x78, 0x73, 0xE7, 0xC9, 0x8D, 0x25, 0xBF, 0xED, 0xBF, 0xC5,
+    0xAC, 0xA9, 0xF8, 0x76, 0x26, 0x97, 0x89, 0x42, 0x3A, 0xCA, 0x45, 0x9F, 0x3E, 0x39, 0xF2, 0xA1,
+    0x01, 0x1B, 0xF8, 0xDD, 0x5C, 0xFE, 0xE4, 0x18, 0xA7, 0xE2, 0xC4, 0x4D, 0xAA, 0xE5, 0xBD, 0xD4,
+    0x90, 0xE9, 0x33, 0x21, 0x97, 0x3F, 0xF9, 0x4A, 0xBE, 0xA6, 0x61, 0xDC, 0xA7, 0xCF, 0xD5, 0x1E,
+    0xEC, 0x1B, 0x47, 0xCF, 0x19, 0x91, 0x88, 0xC8, 0xAA, 0x14, 0xFD, 0x7B, 0x74, 0xC9, 0x45, 0xE4,
+    0xF3, 0xB7, 0xA9, 0x4E, 0x9F, 0x1F, 0xF1, 0x38, 0xD4, 0xF2, 0x83, 0x3D, 0x7E, 0xF6, 0xB9, 0x9F,
+    0xCB, 0xCF, 0xCE, 0x7E, 0x41, 0xC2, 0xFA, 0x85, 0x26, 0x8B, 0x7A, 0xD8, 0xF5, 0xF9, 0x7D, 0x99,
+    0xA1, 0xE4, 0x5E, 0xED, 0xBB, 0x62, 0xC7, 0xFB, 0xCF, 0xEE, 0x39, 0x5D, 0x76, 0x80, 0xF7, 0xFD,
+    0x2E, 0xF5, 0x47, 0xBC, 0xFD, 0x6E, 0x30, 0x7F, 0x3D, 0xF3, 0xDE, 0xFB, 0x4F, 0xAB, 0xE2, 0xDC,
+    0x43, 0xA7, 0xEB, 0x1E, 0x8A, 0x17, 0xE6, 0xDE, 0x8A, 0x17, 0x0A, 0xDA, 0xE4, 0xE9, 0x24, 0x09,
+    0x33, 0x73, 0x97, 0x2A, 0xD2, 0x3D, 0xC5, 0x21, 0x52, 0xD7, 0xEE, 0x8B, 0x43, 0xEC, 0x69, 0x4C,
+    0xDC, 0xC5, 0x90, 0x1D, 0x4F, 0x8E, 0x57, 0x39, 0xFB, 0x55, 0x6D, 0x92, 0x26, 0x8D, 0x9A, 0xCC,
+    0xED, 0x6F, 0x9C, 0x76, 0xEE, 0x55, 0xEF, 0x31, 0xC1, 0x01, 0xF6, 0x47, 0x5F, 0x4A, 0xB9, 0x12,
+    0x9B, 0x72, 0x28, 0xAD, 0xB6, 0x70, 0xD3, 0x3C, 0x2A, 0x47, 0x7D, 0xDA, 0xFD, 0xEB, 0xE7, 0xC1,
+    0x0E, 0xAA, 0xF2, 0xE9, 0x74, 0xAF, 0xCF, 0x22, 0xF5, 0x50, 0x44, 0xCA, 0x91, 0x15, 0x33, 0xA5,
+    0xEA, 0xA6, 0x91, 0x88, 0x1D, 0x74, 0xD1, 0x71, 0x8D, 0x2E, 0x2C, 0x2B, 0x45, 0x30, 0x91, 0x3C,
+    0xE2, 0xFE, 0x5D, 0x3F, 0x60, 0xD6, 0x27, 0x63, 0xAD, 0xD2, 0x69, 0x43, 0x3F, 0x40, 0x91, 0x8E,
+    0x8D, 0xDF, 0x3F, 0xB9, 0xC1, 0x0E, 0x5A, 0x25, 0xA3, 0x3E, 0x5E, 0x16, 0x49, 0x07, 0x0E, 0x67,
+    0x49, 0x1C, 0xBE, 0xBD, 0xD7, 0x7B, 0xB4, 0xE4, 0x46, 0x24, 0x55, 0x61, 0x89, 0x48, 0x67, 0x7F,
+    0x74, 0xD4, 0xFF, 0xE8, 0xE6, 0xAC, 0xBE, 0xA2, 0xE4, 0x51, 0x45, 0x20, 0x8E, 0x21, 0x6A, 0x19,
+    0xA9, 0x83, 0xA8, 0x92, 0x5A, 0x7D, 0x11, 0x30, 0x11, 0xF7, 0xE9, 0x19, 0xDA, 0x6F, 0xF7, 0x7E,
+    0x85, 0x52, 0xC4, 0xBB, 0x06, 0xDA, 0x84, 0x57, 0xFC, 0xB2, 0x4B, 0x4D, 0xBD, 0x13, 0x3C, 0x7C,
+    0xED, 0x44, 0xF0, 0x70, 0x38, 0xAD, 0x1B, 0xF9, 0xB7, 0x10, 0x3C, 0xD4, 0x18, 0x73, 0xAF, 0x82,
+    0xE0, 0x78, 0x87, 0x02, 0xDF, 0x1D, 0xA4, 0x6B, 0xA7, 0x98, 0x80, 0xF3, 0x59, 0xC4, 0xF9, 0xAD,
+    0x22, 0xAD, 0xF6, 0xD8, 0xA1, 0xF2, 0x7A, 0xF0, 0x91, 0x92, 0xBB, 0xFA, 0x9B, 0x23, 0x2A, 0xAE,
+    0x67, 0x25, 0xA2, 0x8C, 0xA3, 0x3C, 0xAA, 0x02, 0xE1, 0xB2, 0xAB, 0xC2, 0xD2, 0xD2, 0xAC, 0x35,
+    0xB9, 0x48, 0x2B, 0x66, 0xDE, 0xFA, 0x45, 0x9D, 0x12, 0x65, 0xE6, 0xFB, 0x6D, 0x8F, 0x50, 0xF2,
+    0xD3, 0xCC, 0x59, 0xA6, 0xF2, 0x76, 0x48, 0x69, 0xDC, 0x1D, 0x52, 0x3A, 0x9B, 0x49, 0x79, 0x16,
+    0xFA, 0x23, 0x94, 0x23, 0x45, 0xB0, 0x03, 0xE5, 0x68, 0x53, 0x5B, 0xAD, 0xAF, 0xBD, 0xFA, 0x7A,
+    0xCE, 0xBB, 0x86, 0xB6, 0x73, 0x0D, 0xD2, 0xB8, 0x26, 0x17, 0x5C, 0x57, 0xF6, 0xD4, 0xAF, 0x1E,
+    0x5F, 0xC1, 0xCA, 0x7C, 0x48, 0x21, 0xC3, 0xB3, 0x5B, 0x02, 0xB4, 0xF4, 0x26, 0x40, 0x39, 0x94,
+    0x23, 0x14, 0x63, 0xE5, 0xC1, 0x88, 0x8A, 0xA8, 0xDF, 0xB3, 0x20, 0xD8, 0x8E, 0xB0, 0x50, 0x8E,
+    0xE4, 0x91, 0x22, 0xA4, 0xFF, 0xEC, 0x98, 0x54, 0x44, 0x4C, 0x48, 0xEA, 0x8B, 0x2D, 0xE4, 0x93,
+    0x8A, 0x70, 0x66, 0x11, 0xB2, 0x59, 0x0B, 0x9A, 0x74, 0x89, 0x54, 0x97, 0xBC, 0xF2, 0x68, 0x19,
+    0x33, 0xDC, 0x3A, 0x04, 0xB8, 0x15, 0x01, 0x0E, 0x35, 0xFA, 0x0D, 0x27, 0xDC, 0x15, 0xA5, 0x5A,
+    0xA9, 0x20, 0x49, 0xCF, 0xCE, 0x53, 0x4D, 0x07, 0x97, 0x4D, 0xBB, 0x84, 0xB3, 0xD3, 0x42, 0xBA,
+    0x15, 0xA0, 0xFE, 0xC1, 0xDF, 0x83, 0x2D, 0xB3, 0xEE, 0x1E, 0x45, 0x03, 0x3B, 0xD6, 0xFC, 0x83,
+    0xEC, 0x4E, 0x35, 0x2F, 0x42, 0x0A, 0x54, 0xEA, 0x97, 0x55, 0x64, 0x89, 0xD5, 0x8E, 0xB0, 0x42,
+    0x31, 0xE9, 0xB1, 0x60, 0xD4, 0x3E, 0xC5, 0x2E, 0xAB, 0x99, 0x52, 0xBC, 0x93, 0xA2, 0x90, 0xCA,
+    0xBB, 0x86, 0x62, 0xDA, 0x64, 0x8B, 0x93, 0xBB, 0x9F, 0x4B, 0x93, 0x2A, 0x2F, 0x97, 0xE4, 0xB7,
+    0xC8, 0x4C, 0x11, 0x58, 0x28, 0x5E, 0x1B, 0x71, 0x9D, 0x99, 0x71, 0xAE, 0x23, 0x62, 0xC7, 0x7C,
+    0xEE, 0xB5, 0x8C, 0xD0, 0xBE, 0x14, 0x71, 0xD0, 0x73, 0xBB, 0x08, 0xF9, 0x4C, 0x16, 0x8B, 0x90,
+    0x06, 0xBD, 0x6B, 0x5C, 0xB3, 0x82, 0xFD, 0xC6, 0xAC, 0xC0, 0x8E, 0xFB, 0x9C, 0xCF, 0xA3, 0x6B,
+    0xA0, 0x3F, 0xA4, 0xF8, 0xC9, 0xAC, 0x6C, 0x65, 0x2B, 0x5E, 0xB5, 0xEC, 0x5D, 0x4C, 0x44, 0xBD,
+    0x7E, 0x48, 0xF9, 0xF1, 0xF5, 0x1E, 0xB4, 0x8B, 0xA4, 0xCF, 0xF7, 0xAD, 0xA0, 0xC1, 0x61, 0x0A,
+    0x1F, 0xDB, 0x5D, 0x44, 0xE5, 0x1A, 0x5A, 0x5D, 0x90, 0xEA, 0x4F, 0x45, 0xE5, 0x1F, 0xB5, 0xB0,
+    0x68, 0x58, 0xD0, 0x37, 0x66, 0x2A, 0x02, 0xED, 0x90, 0x45, 0xF5, 0x8C, 0x17, 0x1C, 0xEE, 0x98,
+    0x16, 0x3B, 0x54, 0x4F, 0x75, 0x8E, 0x7C, 0xB2, 0x9F, 0x09, 0x75, 0xC7, 0xB1, 0xF5, 0xD1, 0x7A,
+    0xAA, 0xAF, 0x0D, 0xF5, 0x47, 0x06, 0xCC, 0xCF, 0xC6, 0xE2, 0xC7, 0x23, 0xF4, 0x01, 0x09, 0x50,
+    0x05, 0x5C, 0x20, 0x29, 0x08, 0x6E, 0x53, 0x70, 0x93, 0xAD, 0x24, 0x9E, 0x24, 0x55, 0x46, 0x27,
+    0xB2, 0xB0, 0x2B, 0xF3, 0x29, 0x43, 0x5A, 0x46, 0xEC, 0xAB, 0x57, 0x41, 0x64, 0xA6, 0x12, 0x09,
+    0xF9, 0x7A, 0x24, 0xDE, 0x75, 0xF9, 0x62, 0x26, 0xEC, 0xE8, 0xA0, 0x2F, 0x02, 0x65, 0x38, 0x86,
+    0xDE, 0x0E, 0xD8, 0x71, 0x21, 0x5B, 0x2A, 0x4F, 0xFB, 0x62, 0xA4, 0x0D, 0xB5, 0xC8, 0x62, 0x44,
+    0xD6, 0x14, 0x6F, 0xC3, 0xD3, 0x0D, 0xA8, 0x9A, 0x06, 0xAA, 0xA7, 0x01, 0xAA, 0xA8, 0x81, 0x6A,
+    0x6A, 0xA0, 0xAA, 0x1A, 0xA8, 0x8A, 0x05, 0x98, 0xA8, 0x27, 0x36, 0xAD, 0xEA, 0x63, 0xF4, 0xD0,
+    0x5E, 0xFB, 0x01, 0xCE, 0x53, 0x8B, 0x0C, 0x76, 0xC4, 0x8A, 0xC4, 0x62, 0xC2, 0x4C, 0xB4, 0x9F,
+    0x8A, 0x10, 0x29, 0x43, 0xAF, 0xA7, 0x0D, 0xBB, 0x8E, 0xCA, 0xD3, 0xAA, 0x90, 0x51, 0xFD, 0xD9,
+    0x00, 0x2B, 0xD5, 0x37, 0x23, 0xB8, 0x57, 0xAF, 0x05, 0x01, 0x23, 0x12, 0x5C, 0x07, 0x75, 0x12,
+    0x81, 0x38, 0x55, 0x40, 0x73, 0x1B, 0xE8, 0xE5, 0x06, 0x76, 0x00, 0x11, 0xF1, 0x99, 0x9E, 0x83,
+    0x34, 0x53, 0x79, 0xEA, 0x3B, 0x94, 0xE4, 0x73, 0x22, 0x3E, 0xBA, 0x46, 0x41, 0x23, 0x13, 0xD2,
+    0x8C, 0x6D, 0x93, 0x95, 0xCB, 0x90, 0xC6, 0xC3, 0xBA, 0xE1, 0x10, 0x83, 0x49, 0xD1, 0xC1, 0x41,
+    0xFF, 0xF9, 0x83, 0x03, 0xE5, 0x90, 0x88, 0x0C, 0x29, 0x2E, 0x5F, 0xC0, 0x1D, 0xDD, 0x7C, 0xFD,
+    0xE0, 0xA0, 0xD9, 0x18, 0xC0, 0xE0, 0x52, 0x60, 0x57, 0x6C, 0xDF, 0x75, 0x9C, 0x9E, 0xD0, 0xB3,
+    0x04, 0xD1, 0x1B, 0x4E, 0x81, 0x73, 0xDB, 0xE9, 0xF2, 0xA0, 0xA5, 0x67, 0x75, 0x47, 0x35, 0x93,
+    0x63, 0x26, 0xE8, 0xD7, 0x9B, 0x01, 0xA7, 0x07, 0x2D, 0x28, 0x58, 0xB3, 0x3B, 0xA9, 0x75, 0x2B,
+    0xFB, 0x3B, 0xFF, 0x38, 0x76, 0xC0, 0x4A, 0x64, 0xA1, 0x14, 0xF1, 0xD6, 0xE7, 0xF2, 0xF9, 0x17,
+    0xB2, 0x48, 0xDB, 0x41, 0xDD, 0xD9, 0x80, 0xAA, 0x95, 0x6C, 0xBC, 0x57, 0x55, 0xD0, 0xA3, 0x3F,
+    0x92, 0xA3, 0x23, 0x4A, 0xD9, 0x51, 0x7A, 0x56, 0xAC, 0x4F, 0xA5, 0xAD, 0x5A, 0xDC, 0x6A, 0x3D,
+    0x98, 0x39, 0xB9, 0x9F, 0x76, 0x04, 0x13, 0xE8, 0x3B, 0x68, 0x31, 0xF2, 0xC4, 0x54, 0x8E, 0x58,
+    0x91, 0x66, 0x41, 0x4F, 0x73, 0xD9, 0xD5, 0x02, 0x7F, 0xF1, 0x24, 0x8C, 0x32, 0xAA, 0x03, 0xAE,
+    0x90, 0xA0, 0x8A, 0x77, 0xDC, 0x6C, 0x00, 0x57, 0x75, 0xC0, 0x71, 0xD5, 0x41, 0x16, 0xF5, 0x24,
+    0x0F, 0xF5, 0x85, 0xAD, 0x07, 0xFB, 0xEA, 0x53, 0x03, 0xBA, 0x0F, 0x27, 0x0E, 0xF3, 0x7A, 0xF3,
+    0xC7, 0x81, 0x2C, 0xD6, 0x8F, 0x05, 0xCC, 0x54, 0x3F, 0x16, 0x28, 0x83, 0x33, 0x13, 0xD6, 0xBB,
+    0x7C, 0xC6, 0x75, 0x87, 0xD9, 0x4C, 0xCB, 0xED, 0x2C, 0xB2, 0x12, 0x89, 0x79, 0x24, 0x12, 0xCD,
+    0x94, 0x45, 0x96, 0x32, 0x64, 0x33, 0xC7, 0x95, 0xCF, 0x27, 0x8E, 0x5D, 0xA7, 0x9A, 0xD3, 0x1A,
+    0x48, 0x6B, 0x28, 0xDF, 0xA4, 0xF2, 0x52, 0xFB, 0x17, 0x3E, 0x9D, 0xCD, 0xD0, 0x5A, 0x0F, 0x8B,
+    0x1D, 0xC8, 0x62, 0x39, 0x60, 0xD6, 0x9B, 0x23, 0xA5, 0x48, 0xC0, 0x8A, 0x04, 0xDC, 0x1F, 0xBF,
+    0x1C, 0x68, 0xED, 0xCB, 0x13, 0x8B, 0x7D, 0x69, 0xCE, 0x63, 0xF5, 0xE9, 0xD9, 0x84, 0xFA, 0x43,
+    0xB1, 0x1C, 0x1D, 0xB1, 0xF2, 0x8E, 0xE8, 0xBA, 0x96, 0xA5, 0xE5, 0x90, 0x63, 0xCA, 0x01, 0x1E,
+    0x54, 0xD4, 0xC7, 0x6A, 0x79, 0x9C, 0x55, 0x10, 0xA3, 0x10, 0xA8, 0x3B, 0xCC, 0x9B, 0x1E, 0x3B,
+    0x90, 0xBF, 0x31, 0x61, 0x02, 0xC4, 0x43, 0x95, 0xEC, 0xAA, 0x3A, 0x7A, 0x68, 0x75, 0x5F, 0x72,
+    0x4D, 0xD4, 0x55, 0xC8, 0x61, 0xEE, 0x1C, 0x3C, 0xF5, 0xEA, 0x53, 0x83, 0x02, 0x42, 0x1A, 0xD4,
+    0xC9, 0x8A, 0x3B, 0xFA, 0xD2, 0x1B, 0xFD, 0x4D, 0x6F, 0x87, 0x2C, 0x56, 0x8F, 0x05, 0x13, 0x58,
+    0xCA, 0x21, 0x66, 0x91, 0xDE, 0x04, 0xD7, 0x1C, 0xE3, 0x9A, 0x58, 0x8E, 0xAE, 0xA9, 0xBB, 0xC3,
+    0x6C, 0xB6, 0xBE, 0xF2, 0x75, 0xD3, 0x16, 0xC1, 0x8E, 0xD6, 0xDB, 0x97, 0x62, 0x11, 0x4C, 0x30,
+    0xE1, 0xD8, 0x4C, 0x44, 0x16, 0xF7, 0x68, 0xE4, 0x90, 0xFA, 0x73, 0x2F, 0x2E, 0xD4, 0x4D, 0xF9,
+    0xB3, 0xB0, 0x2A, 0x28, 0x9A, 0x5C, 0xE9, 0x0E, 0x37, 0x62, 0x07, 0xAA, 0x88, 0x09, 0x58, 0x21,
+    0x8B, 0x94, 0xDF, 0xF3, 0x1C, 0x63, 0x7E, 0xA2, 0xFE, 0xE2, 0x21, 0xD6, 0x67, 0xB1, 0xEA, 0x8A,
+    0xC0, 0x62, 0x42, 0xBE, 0x1E, 0xC9, 0x51, 0xD4, 0x36, 0xAA, 0x03, 0x37, 0x58, 0x5F, 0x7D, 0xF5,
+    0xFB, 0x73, 0x11, 0xEC, 0x37, 0xA7, 0xC3, 0x7C, 0x2E, 0xC3, 0xED, 0xCA, 0xAF, 0x26, 0x38, 0x13,
+    0xDC, 0xA3, 0xB3, 0xF5, 0xD1, 0xBE, 0x18, 0x8B, 0xD1, 0x7D, 0x38, 0x2C, 0xF9, 0x54, 0x7E, 0x7F,
+    0x6E, 0x89, 0x59, 0x5C, 0x54, 0x77, 0x15, 0x5A, 0x49, 0xC2, 0xF4, 0xBB, 0x5F, 0x0B, 0xF4, 0x1A,
+    0x1F, 0x69, 0x21, 0x5E, 0x82, 0x74, 0xB0, 0x03, 0x2B, 0x50, 0x06, 0xA3, 0x32, 0xE8, 0x56, 0x0B,
+    0x06, 0x75, 0x0E, 0x2F, 0x3A, 0xEB, 0x94, 0x8E, 0x59, 0x6F, 0xE4, 0x78, 0x99, 0xC1, 0x2C, 0xF5,
+    0x57, 0x17, 0xD5, 0x9E, 0x58, 0x75, 0xB7, 0xEA, 0x21, 0x5D, 0xBD, 0xA5, 0x55, 0xF5, 0xD5, 0x5E,
+    0x85, 0xC6, 0x56, 0x9C, 0xCE, 0x09, 0xD7, 0x14, 0x81, 0x88, 0x6B, 0xEC, 0x98, 0x45, 0x5C, 0x93,
+    0x82, 0x16, 0x0D, 0x50, 0x9A, 0x16, 0x33, 0xA5, 0x73, 0xC9, 0x49, 0xB7, 0xA0, 0xC7, 0x14, 0x4C,
+    0x98, 0x37, 0x8E, 0x6E, 0xCE, 0x70, 0x5B, 0x31, 0x0B, 0x6F, 0x66, 0xC8, 0x66, 0x33, 0x03, 0xF5,
+    0x63, 0x13, 0x60, 0x7E, 0x3A, 0x91, 0x4E, 0xE2, 0xA3, 0x12, 0x99, 0xA0, 0xFE, 0xE1, 0x1D, 0x81,
+    0x6A, 0x58, 0xEC, 0x88, 0x1D, 0x5C, 0x16, 0x29, 0x83, 0xF5, 0x0E, 0x33, 0x15, 0xA3, 0xF5, 0x79,
+    0xCC, 0x27, 0x33, 0x11, 0x89, 0x1C, 0x73, 0x8C, 0xA3, 0xEE, 0x1C, 0x95, 0x2F, 0x82, 0xEB, 0x8A,
+    0x31, 0x8B, 0x50, 0x0E, 0x46, 0x27, 0xB9, 0x6B, 0x2A, 0x49, 0x2B, 0xA2, 0x76, 0x4D, 0x11, 0xB2,
+    0x05, 0x6C, 0xA0, 0xEE, 0xCC, 0x8C, 0xD6, 0xD2, 0x2B, 0x08, 0xAA, 0x47, 0xBF, 0xF7, 0x2A, 0x0E,
+    0xEC, 0xCB, 0x09, 0x7A, 0xA8, 0xBB, 0x4D, 0x64, 0xB1, 0x48, 0xA9, 0xEA, 0xE3, 0xB6, 0x01, 0xF7,
+    0xF9, 0x83, 0x27, 0x64, 0xDE, 0xB0, 0x4A, 0x75, 0xB7, 0x15, 0x2C, 0x74, 0x47, 0x5F, 0x5A, 0x9F,
+    0xFA, 0xE6, 0x0A, 0x0B, 0xD5, 0xD0, 0xAA, 0xD3, 0xBE, 0xE4, 0xD1, 0x4C, 0x54, 0xBE, 0x0C, 0x76,
+    0xB4, 0x03, 0xC7, 0xB8, 0xC6, 0x35, 0xAE, 0x31, 0x53, 0x1E, 0x89, 0xAC, 0x58, 0x6F, 0x87, 0x22,
+    0xE4, 0x33, 0x2D, 0x3D, 0x75, 0x57, 0x8E, 0x79, 0x34, 0x13, 0x2B, 0x75, 0x57, 0x8E, 0x95, 0x37,
+    0x13, 0x3D, 0xAE, 0x59, 0x15, 0x82, 0x8F, 0x45, 0xA0, 0xA5, 0x08, 0x45, 0x70, 0x9D, 0xBA, 0xAF,
+    0xBB, 0xE8, 0xAF, 0xEB, 0x45, 0x64, 0xB0, 0x83, 0x53, 0xB4, 0xB4, 0x78, 0xE3, 0xE8, 0xE6, 0x94,
+    0x45, 0xD5, 0x95, 0x3B, 0x56, 0xAF, 0xD7, 0x35, 0x2A, 0x71, 0xE9, 0x71, 0xEA, 0x03, 0x17, 0xAF,
+    0x4C, 0xE4, 0xEB, 0xD1, 0x91, 0x1E, 0x55, 0xB7, 0xE5, 0x3F, 0x7E, 0xF8, 0x86, 0x60, 0x7D, 0xE5,
+    0xA3, 0x1D, 0x8A, 0x60, 0x07, 0x97, 0xCF, 0xF9, 0x5C, 0x8E, 0x55, 0xD7, 0xB2, 0x16, 0xA1, 0x1C,
+    0xAC, 0x77, 0x8F, 0xCD, 0x26, 0x98, 0x60, 0x5F, 0x8C, 0x44, 0x96, 0x22, 0xAC, 0x38, 0xEA, 0x47,
+    0xE7, 0x96, 0xAA, 0x2B, 0xC7, 0xC5, 0x35, 0xA5, 0x46, 0x61, 0x65, 0x57, 0x0E, 0x70, 0xC5, 0xAC,
+    0x90, 0xCD, 0x6B, 0x03, 0x56, 0x15, 0xAB, 0x46, 0xC8, 0x7A, 0x4D, 0x91, 0x08, 0xB4, 0x6B, 0x1F,
+    0x31, 0x13, 0x6E, 0xE0, 0xFE, 0x8D, 0x21, 0x37, 0xDE, 0x8B, 0x2C, 0xA7, 0x6E, 0x79, 0x00, 0x9E,
+    0x9A, 0xC1, 0xC9, 0x0C, 0x46, 0xD6, 0x06, 0x1E, 0xFC, 0x92, 0x9C, 0xC0, 0x59, 0xE9, 0x2C, 0x8D,
+    0x33, 0xA9, 0x9B, 0x3D, 0xFA, 0x9D, 0x1B, 0x80, 0x6A, 0x86, 0xF3, 0xBD, 0x40, 0x9F, 0xCE, 0x78,
+    0x68, 0xA8, 0xD7, 0x7F, 0xB5, 0xE5, 0x75, 0xDA, 0x13, 0xAF, 0xD5, 0xBD, 0xD1, 0xAF, 0xE4, 0x22,
+    0x32, 0x51, 0x48, 0x02, 0x20, 0x3E, 0x06, 0xD9, 0x98, 0xCF, 0x98, 0x50, 0x8F, 0x98, 0xEF, 0xDF,
+    0x69, 0x52, 0xC5, 0x7E, 0x84, 0x4A, 0x25, 0xBC, 0x23, 0xE6, 0xCE, 0x93, 0x33, 0xE7, 0xF6, 0x84,
+    0xEA, 0x76, 0x1A, 0xB3, 0xD7, 0xBC, 0x86, 0x8D, 0xB5, 0x00, 0xEA, 0xC6, 0xEF, 0xEA, 0x34, 0xB3,
+    0x79, 0x5F, 0x11, 0xB2, 0x88, 0x70, 0x41, 0x06, 0x6A, 0x89, 0x58, 0x59, 0x41, 0x7E, 0x90, 0xEE,
+    0xA4, 0xDE, 0x3E, 0x95, 0x89, 0xC8, 0x90, 0x89, 0x48, 0xC7, 0xD3, 0x5F, 0xFC, 0x67, 0x3B, 0x88,
+    0xB4, 0x6E, 0xB2, 0xB9, 0xF2, 0x2C, 0xD8, 0xB1, 0xA7, 0x08, 0xB8, 0xC7, 0x66, 0x2A, 0x4F, 0xB4,
+    0x03, 0xC7, 0x14, 0xA1, 0xC5, 0xCC, 0xD4, 0x2F, 0x46, 0xEC, 0xC0, 0x5A, 0x06, 0x5A, 0xCC, 0xE4,
+    0xBA, 0x3C, 0x52, 0xF9, 0x05, 0x3B, 0xD2, 0x9B, 0x80, 0x6B, 0xCC, 0x5C, 0x79, 0x22, 0x76, 0x68,
+    0x29, 0x02, 0x7D, 0xB6, 0x50, 0x7B, 0x33, 0x99, 0x99, 0x15, 0xE7, 0x6D, 0x30, 0x93, 0x89, 0x54,
+    0x73, 0xE5, 0xFB, 0x81, 0x5A, 0xD2, 0xF1, 0x95, 0x22, 0x1D, 0x5C, 0xD0, 0x0A, 0x9C, 0x14, 0x0E,
+    0xA4, 0x45, 0x55, 0x7B, 0x60, 0xCB, 0xE5, 0x2C, 0xEC, 0x21, 0xBD, 0xBB, 0x51, 0x7C, 0x5F, 0xB3,
+    0x8B, 0x05, 0x15, 0xE3, 0xB6, 0x7E, 0xD7, 0x1D, 0x9A, 0xC7, 0xD5, 0x44, 0x8A, 0xDB, 0xF8, 0x4A,
+    0x76, 0x28, 0x42, 0x39, 0x3A, 0xEA, 0xAE, 0xFE, 0x54, 0xE4, 0x36, 0x7D, 0x39, 0x9A, 0x29, 0x8F,
+    0xAE, 0xB1, 0xBE, 0x0C, 0x91, 0x96, 0xFA, 0xB3, 0x21, 0x9F, 0x39, 0xAE, 0xBD, 0x1D, 0xCC, 0x7C,
+    0x8C, 0xC3, 0x7E, 0x6B, 0x22, 0xE2, 0xAC, 0x2F, 0x42, 0x16, 0x5B, 0xEA, 0xAE, 0xFC, 0xCB, 0xC8,
+    0x82, 0xFB, 0x83, 0x60, 0x42, 0x1E, 0x6B, 0x5F, 0xF9, 0x6A, 0x68, 0x9B, 0xE3, 0x6C, 0x45, 0x1E,
+    0x9D, 0xEB, 0x90, 0xCB, 0x6B, 0x3F, 0xD6, 0xFE, 0x1F, 0xC8, 0x34, 0xC3, 0x53, 0xFE, 0xE0, 0x54,
+    0x13, 0xB6, 0xBB, 0xD0, 0x9B, 0xB8, 0xAB, 0xED, 0xEE, 0x57, 0x2E, 0xD4, 0x24, 0x8A, 0x0F, 0x38,
+    0x11, 0x91, 0x35, 0xFD, 0x54, 0xA1, 0x26, 0x20, 0x8F, 0x2D, 0x7F, 0x6B, 0xA1, 0x26, 0x2E, 0xA1,
+    0xC7, 0x45, 0xE5, 0x22, 0x13, 0xF5, 0x9D, 0x6B, 0x21, 0x5B, 0x95, 0x9F, 0x51, 0xF9, 0x1E, 0xDC,
+    0x63, 0x93, 0x46, 0x03, 0x66, 0xEA, 0x8F, 0x8E, 0x6E, 0x7E, 0x4B, 0x44, 0xC4, 0x8A, 0x48, 0x74,
+    0x0D, 0x65, 0x88, 0xE0, 0x3E, 0x13, 0x34, 0x82, 0x2C, 0x47, 0xD7, 0xD1, 0xD2, 0x76, 0xC5, 0x4C,
+    0xFF, 0x1F, 0xA4, 0x43, 0x64, 0x4E, 0x92, 0x3F, 0xE7, 0x53, 0xBC, 0x5F, 0xBD, 0x1E, 0x21, 0x97,
+    0xEF, 0x06, 0xA8, 0xDE, 0xFC, 0x88, 0x4F, 0xA2, 0x41, 0x65, 0x12, 0x18, 0x32, 0x53, 0x2A, 0x75,
+    0x50, 0xC0, 0xA4, 0x47, 0x35, 0x30, 0xB3, 0x98, 0x90, 0xAD, 0x05, 0xAC, 0xD7, 0x8C, 0x90, 0xEB,
+    0x52, 0xD2, 0x44, 0x0F, 0xAF, 0xB1, 0x43, 0x0B, 0xD4, 0x8F, 0xCD, 0xC0, 0xB1, 0x56, 0x3B, 0x1C,
+    0x03, 0xC5, 0x2B, 0x01, 0xA8, 0x5E, 0xEB, 0x50, 0xCD, 0x4E, 0x2D, 0xCD, 0x4B, 0x6E, 0x9B, 0x9D,
+    0x4F, 0x14, 0x34, 0xB7, 0xA8, 0xB4, 0x7E, 0x65, 0x22, 0x97, 0xCF, 0x0D, 0x54, 0x83, 0x6B, 0x58,
+    0x38, 0xA6, 0x08, 0xF9, 0x8C, 0x6B, 0x8A, 0x90, 0x45, 0x2A, 0x6F, 0x07, 0xCD, 0xDF, 0x44, 0x93,
+    0xCE, 0x80, 0xB0, 0xC3, 0x31, 0xB8, 0xC7, 0x02, 0xDC, 0xAE, 0x3B, 0xF2, 0x39, 0x42, 0xF1, 0xC3,
+    0x11, 0xAA, 0x9E, 0x74, 0xD8, 0xE7, 0x4E, 0x09, 0xE2, 0xBE, 0x1B, 0x4F, 0x93, 0xA2, 0x48, 0x15,
+    0x28, 0xA6, 0x35, 0x01, 0xB8, 0x6D, 0xC2, 0x4E, 0x88, 0xEA, 0xEA, 0xE9, 0xE0, 0x3E, 0x9B, 0x81,
+    0xF6, 0xBB, 0x01, 0x4A, 0x79, 0xCA, 0x43, 0xFB, 0x1F, 0x1D, 0xAA, 0x26, 0x93, 0x0E, 0x32, 0x59,
+    0x52, 0x9E, 0x40, 0x13, 0x2F, 0xC7, 0x29, 0x05, 0xA8, 0x71, 0x45, 0x0B, 0x95, 0x2A, 0x44, 0x52,
+    0x79, 0x88, 0x0A, 0xC9, 0x6B, 0xB1, 0x9E, 0xEB, 0x52, 0xA5, 0x16, 0xB7, 0xED, 0x88, 0x06, 0x7D,
+    0x14, 0xDF, 0x9F, 0x81, 0xEA, 0x73, 0x1E, 0x68, 0x8F, 0x4F, 0x6A, 0x54, 0xA4, 0xDB, 0x55, 0x7D,
+    0x69, 0xF8, 0xDF, 0x03, 0x3C, 0x9D, 0x3F, 0xAF, 0xA3, 0x36, 0x8B, 0x76, 0x20, 0x9F, 0xAC, 0xC7,
+    0x84, 0xAA, 0xC1, 0x8C, 0x35, 0x64, 0xA7, 0xB8, 0xDC, 0x7F, 0xC7, 0x86, 0x3D, 0xA3, 0x13, 0x75,
+    0x67, 0x8F, 0xAE, 0x10, 0xF6, 0x28, 0xF1, 0xDB, 0x9F, 0x73, 0x82, 0x32, 0xA0, 0x0A, 0xBB, 0x73,
+    0xE1, 0x6C, 0xD8, 0x15, 0x90, 0x95, 0x61, 0xDB, 0x0D, 0xD2, 0xB9, 0x7E, 0x26, 0xA0, 0xA2, 0x6F,
+    0x38, 0xBF, 0x80, 0x6B, 0xD4, 0x07, 0x73, 0x4D, 0x3A, 0x53, 0x35, 0x8F, 0xE5, 0xA8, 0xEA, 0x96,
+    0xD0, 0x67, 0x33, 0xA5, 0xAA, 0x7F, 0x39, 0xDF, 0x62, 0x26, 0x55, 0xFD, 0x1A, 0xAD, 0xCF, 0xA3,
+    0x0A, 0x16, 0xCD, 0x26, 0xA4, 0xFA, 0xC9, 0x6C, 0x61, 0xE1, 0x78, 0x13, 0x3B, 0xAA, 0x9B, 0x36,
+    0xB1, 0xD5, 0x7D, 0x39, 0xBA, 0x8E, 0x05, 0xA8, 0xC6, 0x6C, 0xAE, 0x92, 0xEB, 0x17, 0x38, 0x54,
+    0x31, 0x44, 0x8A, 0x19, 0xFB, 0xD5, 0x40, 0xBE, 0x40, 0x11, 0xD5, 0x9D, 0x72, 0x9E, 0x62, 0xD1,
+    0x82, 0x9E, 0x24, 0x0F, 0x56, 0xDF, 0x06, 0xE4, 0x8D, 0x7E, 0x4D, 0xAA, 0x22, 0xA5, 0xC8, 0xB2,
+    0x91, 0x08, 0xAE, 0xC9, 0xC6, 0x8A, 0x4F, 0x4B, 0xC0, 0x9E, 0x63, 0x61, 0xC7, 0x93, 0xAA, 0x8C,
+    0x70, 0x92, 0x87, 0x9B, 0x4F, 0x0C, 0x7C, 0x52, 0xF8, 0x97, 0xEF, 0x32, 0xE3, 0xD9, 0x6B, 0xEB,
+    0x9E, 0x64, 0xDA, 0x49, 0x25, 0xC2, 0xBC, 0x2F, 0x32, 0xA6, 0xDD, 0x33, 0x6B, 0x55, 0x1D, 0xB5,
+    0x08, 0x76, 0xC0, 0xCC, 0xF4, 0xAF, 0xF6, 0x5A, 0x7A, 0x99, 0xAD, 0x54, 0x63, 0x39, 0x6A, 0x39,
+    0x68, 0x19, 0x8A, 0x40, 0xED, 0xCB, 0xA0, 0x83, 0xD6, 0x35, 0x5B, 0xB2, 0xB4, 0xA7, 0xF2, 0xFA,
+    0xD7, 0x42, 0xDD, 0x61, 0x26, 0x33, 0xE5, 0xAA, 0xA7, 0x19, 0xF2, 0xC9, 0x04, 0x5C, 0x43, 0x11,
+    0xF2, 0xB9, 0x1C, 0x75, 0x69, 0x51, 0x0B, 0xEA, 0x99, 0x3F, 0xAE, 0x53, 0x8D, 0x32, 0xA2, 0x23,
+    0x1D, 0x44, 0x10, 0x6F, 0xA3, 0x62, 0x65, 0xC4, 0x08, 0xD5, 0x98, 0xAF, 0x5A, 0x11, 0xA5, 0xAA,
+    0x65, 0x6D, 0x40, 0x05, 0xFB, 0x68, 0x87, 0x4D, 0xBE, 0x4C, 0x69, 0x20, 0xCD, 0xA9, 0xD5, 0x7E,
+    0x47, 0x4C, 0x39, 0x11, 0x31, 0x3F, 0x31, 0x59, 0xB9, 0xB3, 0x63, 0xBD, 0x69, 0x3A, 0xFE, 0x8B,
+    0x1D, 0xB1, 0xAC, 0xDD, 0x59, 0xAB, 0x1D, 0x4F, 0xD7, 0xC4, 0x84, 0x93, 0x1A, 0x3D, 0x0D, 0x40,
+    0x7B, 0x91, 0x2E, 0xB9, 0xF4, 0x99, 0xFC, 0xF9, 0x2A, 0x5D, 0x26, 0xCD, 0x17, 0x6C, 0x40, 0x54,
+    0x77, 0xAE, 0x81, 0xDA, 0xB7, 0x1D, 0x14, 0x9A, 0x0E, 0x5C, 0x74, 0x14, 0x7E, 0x36, 0x00, 0xF6,
+    0xFB, 0xAA, 0x01, 0xA1, 0x10, 0xAC, 0x22, 0x60, 0x1F, 0x19, 0x80, 0xEA, 0xBB, 0x13, 0x50, 0xFE,
+    0xF5, 0x02, 0x98, 0xD8, 0x36, 0xA4, 0xDC, 0x3A, 0xFD, 0x63, 0x5A, 0x62, 0xA1, 0xE7, 0x46, 0x57,
+    0x03, 0xD4, 0xC1, 0xC4, 0xAC, 0xA9, 0x03, 0xED, 0x77, 0x63, 0x3B, 0x51, 0x2A, 0xF3, 0xA1, 0x15,
+    0x19, 0x21, 0x17, 0x5D, 0x24, 0xE6, 0x33, 0x23, 0x64, 0x9F, 0x3D, 0x80, 0x1B, 0x21, 0x97, 0x05,
+    0x6A, 0xCD, 0x89, 0xC9, 0x98, 0xAD, 0xD5, 0x1F, 0x04, 0x33, 0x63, 0xE6, 0x32, 0x6C, 0x55, 0xBB,
+    0x95, 0x27, 0x8B, 0x75, 0x47, 0x16, 0x5D, 0xA3, 0x3F, 0xF2, 0x54, 0x29, 0x06, 0x66, 0x72, 0x69,
+    0xE6, 0xD9, 0xB1, 0xF6, 0xD4, 0xBE, 0xFA, 0xCB, 0xA9, 0x6F, 0xCA, 0x74, 0x5E, 0xF1, 0x94, 0x00,
+    0xF0, 0x32, 0xEE, 0x89, 0x7C, 0x68, 0x4E, 0xFD, 0xEA, 0xC6, 0xD0, 0xED, 0x36, 0xA6, 0xEE, 0x0D,
+    0x4D, 0xA7, 0x5F, 0x8B, 0x00, 0xE5, 0x4B, 0x37, 0xFE, 0xD9, 0xE9, 0xC1, 0xDD, 0xA6, 0xCC, 0x96,
+    0x49, 0x3D, 0x96, 0xA5, 0xCE, 0x31, 0x5B, 0x27, 0x9D, 0x2E, 0x0A, 0xAB, 0x57, 0x55, 0x81, 0xEA,
+    0x65, 0xB2, 0xEA, 0x5D, 0x47, 0x23, 0x32, 0xD0, 0x0F, 0xEF, 0xE1, 0x93, 0x45, 0x4C, 0x75, 0x75,
+    0x7D, 0xA3, 0x4B, 0x8C, 0x1D, 0x75, 0x20, 0x98, 0x39, 0xCD, 0xB6, 0x7E, 0x73, 0x97, 0x5E, 0xDE,
+    0xBC, 0xA7, 0xE4, 0x31, 0xCD, 0x29, 0x9E, 0x5F, 0xD3, 0x36, 0xE5, 0x3E, 0xA2, 0x1F, 0xA8, 0xBE,
+    0x35, 0x9F, 0xBC, 0xB1, 0xF2, 0xDA, 0x75, 0x65, 0x80, 0xB5, 0xF2, 0x98, 0x19, 0xDA, 0x42, 0x79,
+    0x22, 0xEE, 0xC5, 0x44, 0xC2, 0x19, 0xF4, 0xB4, 0x00, 0x1B, 0xAC, 0x1E, 0x61, 0x33, 0xE5, 0x0B,
+    0x66, 0xA6, 0x9C, 0x69, 0x7D, 0x21, 0x5D, 0x19, 0x29, 0xE5, 0xA6, 0xAC, 0x37, 0x23, 0x88, 0x2C,
+    0x22, 0x33, 0x14, 0x32, 0x95, 0x32, 0x29, 0xF0, 0x91, 0xB0, 0x0F, 0xAD, 0x35, 0xA1, 0x55, 0x40,
+    0x64, 0xB9, 0x26, 0x1E, 0xB2, 0x29, 0xEB, 0x3D, 0x64, 0x57, 0xE3, 0xF9, 0x66, 0x57, 0x32, 0x94,
+    0xE0, 0x7D, 0x78, 0x48, 0x7F, 0xBD, 0x70, 0xCA, 0x9A, 0xFB, 0x8F, 0x4B, 0xF0, 0x38, 0x14, 0x12,
+    0x2A, 0xE9, 0xA8, 0x25, 0x58, 0x09, 0xF4, 0xFF, 0x61, 0x28, 0x9F, 0x9A, 0xB2, 0x15, 0x30, 0xD1,
+    0xCC, 0x6C, 0x3C, 0x85, 0x84, 0xFB, 0x6F, 0x50, 0x35, 0x1A, 0xF9, 0x66, 0xD1, 0x75, 0xFA, 0xAB,
+    0x61, 0x21, 0x8F, 0xAE, 0x21, 0x62, 0x66, 0xA7, 0x27, 0x95, 0xB8, 0x26, 0x8B, 0x94, 0xC1, 0x35,
+    0xF9, 0x8C, 0x1D, 0x9D, 0x37, 0x13, 0xCE, 0xD7, 0x43, 0x31, 0x23, 0x8D, 0x7D, 0xA3, 0x97, 0x2F,
+    0xAD, 0x14, 0x92, 0x26, 0xD5, 0x52, 0xCB, 0x0D, 0x38, 0xDF, 0x9C, 0x39, 0x9A, 0xBB, 0x50, 0x6E,
+    0x2A, 0xD8, 0xA3, 0x37, 0x34, 0xC8, 0x7E, 0xD8, 0x34, 0x9F, 0x20, 0x49, 0x46, 0x36, 0xF7, 0x2A,
+    0x68, 0x1B, 0x93, 0xDC, 0xBE, 0xF2, 0x51, 0x28, 0x43, 0xE2, 0xBF, 0xB8, 0xCF, 0x28, 0xBC, 0x9C,
+    0x2D, 0x9B, 0x76, 0x4A, 0x48, 0xCC, 0x19, 0xD7, 0x6D, 0x87, 0x0C, 0x24, 0x78, 0xB9, 0x08, 0x56,
+    0x4F, 0x1E, 0xD0, 0xF3, 0xD6, 0x26, 0x58, 0x58, 0xA0, 0x1F, 0x92, 0xA8, 0x9C, 0x34, 0xBA, 0x28,
+    0xBA, 0x55, 0x6B, 0xE6, 0xB3, 0x37, 0x67, 0xEC, 0xC8, 0x8A, 0xFD, 0xFA, 0xA8, 0x41, 0xFC, 0x71,
+    0xED, 0xF3, 0x19, 0x1B, 0x4C, 0xE8, 0xB1, 0x9E, 0xDA, 0xD7, 0x1F, 0x8A, 0x1C, 0x43, 0x9B, 0x45,
+    0x33, 0x15, 0xBA, 0x73, 0xDB, 0xC1, 0x75, 0x98, 0xE9, 0x50, 0x85, 0x36, 0xEC, 0x2B, 0x81, 0xDE,
+    0x0E, 0x50, 0xFF, 0x45, 0x97, 0xC5, 0x63, 0xA0, 0x8D, 0x18, 0x09, 0x2A, 0xE7, 0x63, 0x25, 0x39,
+    0x4F, 0xF5, 0x94, 0x22, 0x26, 0x77, 0x86, 0x1F, 0xFB, 0xE0, 0xD1, 0xD1, 0x17, 0xD3, 0x76, 0xDB,
+    0x80, 0x19, 0xAE, 0x17, 0x1E, 0x18, 0xDE, 0x8E, 0xE7, 0xDE, 0x0F, 0x3D, 0x67, 0x61, 0x49, 0xA7,
+    0xC0, 0x28, 0x1D, 0xAA, 0xFE, 0x6C, 0xC0, 0x0E, 0xD8, 0x6F, 0x44, 0x3D, 0x5F, 0xA6, 0x85, 0x85,
+    0x7C, 0x56, 0x40, 0x7A, 0x51, 0x40, 0xBA, 0xCD, 0x22, 0xA5, 0x02, 0x11, 0xC5, 0x42, 0xE5, 0xAD,
+    0x37, 0xD2, 0xD9, 0xC1, 0x04, 0xF3, 0xE6, 0x58, 0x04, 0x96, 0xEC, 0xF5, 0xD9, 0x04, 0xEA, 0x66,
+    0x76, 0xF9, 0x4C, 0x39, 0x46, 0xEB, 0x23, 0x59, 0xBC, 0x9D, 0x4F, 0x0B, 0xB8, 0x43, 0x0E, 0x8F,
+    0xA1, 0x14, 0xAC, 0x40, 0x26, 0xEA, 0x0F, 0xEA, 0x71, 0x34, 0x7B, 0xF4, 0xBD, 0xF1, 0xEF, 0xF3,
+    0x84, 0x7B, 0xC0, 0xAD, 0xFF, 0x86, 0x24, 0xDB, 0x91, 0xC9, 0x49, 0xC1, 0x99, 0xF9, 0x85, 0x0A,
+    0xCE, 0xD2, 0x3E, 0x74, 0xE9, 0x2A, 0xF4, 0xE2, 0x33, 0x91, 0x90, 0xCB, 0xE7, 0x5F, 0xC8, 0x24,
+    0x5D, 0xA2, 0x4F, 0xD7, 0xDE, 0xE7, 0xBD, 0xED, 0xC8, 0x70, 0x77, 0x1D, 0xB6, 0x5B, 0xCE, 0x80,
+    0xFC, 0x28, 0x60, 0x65, 0x4E, 0xFB, 0x7B, 0x7B, 0x2F, 0x6D, 0x4A, 0xB7, 0x97, 0x76, 0x57, 0x1E,
+    0x86, 0x26, 0xAB, 0xCA, 0x4E, 0x5F, 0x78, 0x1B, 0x0E, 0xAA, 0xEE, 0x10, 0xEA, 0x39, 0x82, 0x91,
+    0x69, 0x2B, 0x64, 0xB4, 0x0A, 0x06, 0x0D, 0xE0, 0xAA, 0x08, 0xC7, 0xD9, 0xFC, 0x30, 0x91, 0x7F,
+    0xD4, 0x3F, 0x3A, 0x81, 0x7B, 0x33, 0x40, 0xA1, 0xF5, 0x6E, 0xE3, 0x56, 0xAF, 0x7E, 0x2C, 0x03,
+    0xC4, 0x2A, 0x90, 0x4F, 0xB9, 0x1E, 0x15, 0x97, 0x08, 0x9E, 0x7B, 0x03, 0x32, 0x1B, 0xA1, 0x7A,
+    0x59, 0x44, 0x6A, 0x91, 0xE9, 0x78, 0x97, 0xDF, 0xBE, 0x1F, 0xFA, 0xF8, 0x4E, 0x91, 0x1F, 0xCB,
+    0xE0, 0xD6, 0x26, 0x9D, 0x9C, 0x38, 0xBB, 0x97, 0xC7, 0x47, 0x98, 0xF2, 0x01, 0xEC, 0x57, 0xE7,
+    0xC3, 0xF2, 0x0F, 0xFE, 0x58, 0xA7, 0x75, 0x75, 0x87, 0x4C, 0xE4, 0x86, 0xFD, 0x8E, 0x2C, 0xD7,
+    0xB9, 0x36, 0xDD, 0xD8, 0x28, 0x0F, 0x17, 0xF7, 0x16, 0x87, 0xEE, 0xC4, 0xE1, 0xDC, 0x6D, 0xE1,
+    0x1F, 0xC8, 0x76, 0xFB, 0xCF, 0x65, 0x3E, 0xC9, 0x5B, 0x3F, 0x0A, 0x5D, 0x2E, 0xFB, 0x6E, 0xA3,
+    0xDD, 0x18, 0x09, 0xF0, 0xC8, 0x47, 0x07, 0xA0, 0xFC, 0xFC, 0x0B, 0xF0, 0x49, 0x46, 0xE0, 0x1D,
+    0x5C, 0xDE, 0x2E, 0x7A, 0xEE, 0xEE, 0x72, 0xEA, 0x5F, 0xF8, 0x71, 0x75, 0x57, 0x56, 0x53, 0xCA,
+    0x06, 0x14, 0x8F, 0x7A, 0x5D, 0x30, 0x32, 0x5F, 0xCE, 0xF5, 0x0E, 0xCA, 0xE6, 0xFA, 0x27, 0x55,
+    0x6E, 0x0C, 0xCB, 0x7B, 0xF8, 0x15, 0x3C, 0xAE, 0xEE, 0x85, 0x9A, 0x6C, 0xF4, 0x56, 0xBD, 0x72,
+    0x21, 0x13, 0xE8, 0x95, 0x6D, 0x73, 0xFD, 0xE4, 0x8E, 0xDF, 0xFF, 0x73, 0xBE, 0xCE, 0x9C, 0x9C,
+    0x25, 0xF4, 0x4B, 0x59, 0xFD, 0xA1, 0x93, 0x6F, 0x38, 0x59, 0x92, 0x6E, 0x9D, 0xF8, 0x29, 0xBB,
+    0xBE, 0xCC, 0x92, 0x94, 0xE8, 0xFD, 0x1B, 0x4F, 0x0D, 0xE3, 0x77, 0x4E, 0xC5, 0x15, 0x9D, 0x75,
+    0x5F, 0xD9, 0x88, 0x46, 0xF4, 0x7E, 0x43, 0x00, 0xFA, 0x71, 0x73, 0x07, 0xDB, 0xB0, 0x4D, 0x51,
+    0x9D, 0x0B, 0x1F, 0x00, 0xF8, 0x9D, 0x7B, 0x38, 0x0F, 0xBF, 0x4C, 0xC7, 0x9D, 0xDB, 0xB6, 0x60,
+    0x58, 0x68, 0x53, 0x1F, 0xDA, 0xB5, 0x69, 0x53, 0xCB, 0x64, 0xE5, 0x5A, 0x7A, 0xFD, 0xDD, 0x23,
+    0xBF, 0x92, 0xC7, 0x07, 0x55, 0x23, 0x69, 0xF3, 0xE2, 0x74, 0xB5, 0x5A, 0xD8, 0x64, 0x52, 0xCB,
+    0x80, 0xEA, 0x4E, 0x24, 0x82, 0x88, 0xA6, 0x44, 0x67, 0xA0, 0x03, 0xEB, 0x93, 0x8C, 0x08, 0xD9,
+    0x0C, 0x97, 0xD9, 0xE3, 0xFD, 0x9D, 0x08, 0x8D, 0xB0, 0x23, 0x02, 0x9C, 0xED, 0x98, 0xED, 0xD4,
+    0xF7, 0xFB, 0x3A, 0xBE, 0x08, 0xCC, 0x89, 0x78, 0x94, 0xCF, 0x80, 0x3C, 0xA1, 0xBB, 0x51, 0xE2,
+    0xAA, 0x9D, 0xE1, 0xAE, 0x50, 0x2A, 0x4B, 0x47, 0xCF, 0x82, 0xAB, 0x3C, 0xC8, 0x9E, 0xF2, 0x7E,
+    0x29, 0x9D, 0x09, 0xE4, 0xEB, 0x84, 0x83, 0xD6, 0x51, 0x04, 0xEC, 0xB7, 0x02, 0xC7, 0x98, 0xF9,
+    0x10, 0x3B, 0x70, 0x5C, 0x8E, 0x24, 0x78, 0xCC, 0x9B, 0x60, 0x7D, 0x36, 0xB3, 0x64, 0xE9, 0xB8,
+    0x86, 0xCE, 0x4C, 0x45, 0xC8, 0x27, 0x5C, 0x3A, 0x1A, 0xCC, 0x35, 0x46, 0x43, 0xB3, 0x96, 0xF2,
+    0x9B, 0x2A, 0x28, 0xDF, 0xC2, 0x82, 0xFD, 0xFA, 0x80, 0xF5, 0x99, 0xCC, 0x10, 0xA9, 0x05, 0x2A,
+    0x6F, 0xC4, 0x93, 0xCF, 0xB8, 0x09, 0xDC, 0x6A, 0x56, 0x30, 0xE2, 0x5B, 0x9F, 0xC2, 0xD9, 0x54,
+    0xA4, 0x9F, 0x88, 0x6A, 0x09, 0x32, 0x53, 0xB7, 0x2F, 0xC9, 0xDA, 0x6A, 0x6F, 0x57, 0x27, 0x3E,
+    0xD4, 0x03, 0xF0, 0x3C, 0xB7, 0x29, 0xC6, 0x7C, 0xC2, 0x35, 0xC5, 0x54, 0x28, 0x03, 0x0B, 0xF5,
+    0xDA, 0xAE, 0xFE, 0x1D, 0xA9, 0xB3, 0xCC, 0x49, 0x9D, 0x65, 0xB5, 0x12, 0xDD, 0x6C, 0xE5, 0x43,
+    0xE2, 0xB3, 0xE6, 0xE4, 0x74, 0x26, 0xEB, 0x53, 0x8E, 0xD2, 0xEC, 0xA0, 0xCB, 0x98, 0xE8, 0xAB,
+    0x4B, 0xDA, 0x1F, 0xDE, 0xB9, 0x1C, 0x68, 0xD2, 0x49, 0x44, 0x38, 0xDF, 0x7F, 0xFE, 0xEA, 0x8E,
+    0x2A, 0xBC, 0x77, 0x0C, 0xE2, 0xAB, 0x57, 0x15, 0x82, 0xAB, 0x45, 0x82, 0x59, 0xBF, 0x24, 0x9D,
+    0x6B, 0x4C, 0x2C, 0x82, 0x36, 0x6C, 0x2D, 0x47, 0xEC, 0x98, 0x08, 0xC0, 0xF6, 0x1B, 0x51, 0x93,
+    0x20, 0xFD, 0xA7, 0x67, 0xDA, 0xE0, 0x94, 0xCC, 0xBB, 0xD0, 0xCA, 0x5F, 0xA5, 0x24, 0xFF, 0x99,
+    0x13, 0x6A, 0x9C, 0x66, 0x6D, 0xF8, 0x87, 0xCB, 0xC1, 0x2F, 0x76, 0xCE, 0xDE, 0x8F, 0xDF, 0xC0,
+    0x69, 0x0A, 0x7A, 0x6A, 0x29, 0xE2, 0x31, 0xEC, 0xFD, 0x9F, 0xC5, 0x16, 0x33, 0xBB, 0x57, 0xAF,
+    0x85, 0x4A, 0xC4, 0x1B, 0x59, 0xB6, 0x03, 0xD8, 0xF7, 0x65, 0x9A, 0x3B, 0x5A, 0xEA, 0x69, 0x5F,
+    0xA6, 0x79, 0x3A, 0x2D, 0xD3, 0x5C, 0x77, 0x54, 0xDE, 0x0E, 0x0F, 0xD9, 0x60, 0x82, 0xFD, 0xDA,
+    0x94, 0xC5, 0x5C, 0x22, 0xFD, 0x41, 0x1F, 0xF5, 0xF8, 0x1F, 0x2B, 0x12, 0x31, 0x6F, 0xFC, 0x6F,
+    0xAE, 0x51, 0x59, 0xE0, 0x63, 0x18, 0xCF, 0x2A, 0x47, 0x66, 0x6F, 0x79, 0x2E, 0x1B, 0xFF, 0x3F,
+    0xE5, 0xBD, 0x4F, 0xAC, 0x24, 0xC7, 0x7D, 0xE7, 0xF9, 0x89, 0x0C, 0x76, 0x27, 0xCC, 0x84, 0x1D,
+    0x3C, 0x90, 0x3B, 0xB6, 0x08, 0x38, 0x7D, 0x18, 0x60, 0x35, 0x9C, 0x61, 0xE7, 0x1E, 0xF6, 0xE0,
+    0x43, 0xF7, 0x8B, 0x24, 0x89, 0x5D, 0x1D, 0x7C, 0xD0, 0x5B, 0xA0, 0x9F, 0x88, 0x1D, 0x1E, 0xA8,
+    0x83, 0x06, 0xF0, 0xD0, 0x8B, 0x69, 0x1F, 0x76, 0x00, 0x1D, 0x5E, 0x77, 0xA6, 0xC4, 0x83, 0x0E,
+    0x3E, 0xA8, 0x77, 0x61, 0x7A, 0x0E, 0x73, 0x30, 0xB1, 0xC3, 0x05, 0xA8, 0xC7, 0x9D, 0x69, 0x1D,
+    0xBC, 0x40, 0xCF, 0xFA, 0xBD, 0xCA, 0x20, 0x89, 0x01, 0x0F, 0x3A, 0x28, 0x25, 0x8E, 0xAC, 0x83,
+    0x0F, 0x4C, 0x58, 0xE4, 0x68, 0x96, 0x04, 0xCC, 0x90, 0x99, 0xB4, 0xB2, 0x9B, 0x91, 0xF9, 0xDB,
+    0x43, 0x44, 0x56, 0xD5, 0xEB, 0x6E, 0xD2, 0xB2, 0xA4, 0xF5, 0xCC, 0xEC, 0x16, 0xC8, 0x7A, 0xD5,
+    0x95, 0x55, 0x59, 0x11, 0xBF, 0xF8, 0xC5, 0xEF, 0xCF, 0xF7, 0xF7, 0x27, 0x80, 0x0B, 0x35, 0xDA,
+    0x57, 0x33, 0x84, 0x46, 0x7A, 0x0E, 0x9A, 0x67, 0x03, 0xE5, 0x8C, 0xAD, 0x8B, 0x99, 0x62, 0xD0,
+    0x0B, 0x59, 0x40, 0xA0, 0xA3, 0xA9, 0xA9, 0x5C, 0xE9, 0x28, 0x7C, 0x31, 0xA0, 0x27, 0x3D, 0xC2,
+    0x4C, 0x00, 0x5B, 0x37, 0x50, 0xB9, 0xCA, 0x3D, 0x6A, 0x06, 0xE3, 0x6D, 0xE1, 0xF5, 0x9C, 0xFF,
+    0x70, 0x42, 0x9C, 0x04, 0x6E, 0x6C, 0xAE, 0x05, 0xAA, 0x6F, 0xCA, 0x8C, 0xE9, 0x65, 0x41, 0x8F,
+    0xEA, 0x77, 0x7A, 0x02, 0x04, 0x1A, 0xA8, 0xA8, 0x5A, 0x14, 0xA6, 0x07, 0xB4, 0x07, 0x54, 0x00,
+    0xE8, 0x00, 0xAA, 0x96, 0xF4, 0xB8, 0x00, 0x50, 0x0C, 0x40, 0x36, 0x02, 0x04, 0x00, 0x0B, 0x50,
+    0x3A, 0x3A, 0x91, 0x01, 0x2B, 0x32, 0x52, 0x8A, 0x04, 0x72, 0x0F, 0x64, 0x13, 0xC0, 0xBC, 0xFF,
+    0x31, 0x28, 0x3C, 0xA0, 0x1F, 0x78, 0x65, 0xF8, 0xEC, 0x2B, 0xE3, 0xF6, 0x4A, 0x03, 0x50, 0xDD,
+    0x73, 0x25, 0x6C, 0xAF, 0xAC, 0x5F, 0x2E, 0x5D, 0xFC, 0x39, 0x3D, 0xA5, 0x2F, 0x36, 0x18, 0x11,
+    0xA7, 0x45, 0x06, 0xE6, 0xA3, 0x43, 0x9A, 0x34, 0x3D, 0xD3, 0xC7, 0x69, 0xAB, 0x90, 0x26, 0x7D,
+    0xDF, 0x9B, 0x1B, 0xC0, 0x3E, 0xF0, 0xCD, 0x1A, 0xA0, 0x10, 0x99, 0x31, 0x22, 0x73, 0x9C, 0x7C,
+    0xE5, 0x56, 0xBA, 0xD9, 0x7A, 0x9D, 0x47, 0xB3, 0x25, 0xE8, 0xB2, 0x9D, 0x46, 0x00, 0xFE, 0xE1,
+    0x72, 0xD2, 0xD2, 0x88, 0xB4, 0x74, 0x22, 0x75, 0x9C, 0x4A, 0xEE, 0xD7, 0xA7, 0x62, 0x20, 0xFE,
+    0x28, 0xC6, 0xAD, 0xC4, 0xF8, 0xD4, 0xBB, 0x03, 0xEC, 0x26, 0xB8, 0x9C, 0xBC, 0xF2, 0xC0, 0x09,
+    0x5E, 0xE8, 0x8E, 0xC8, 0x45, 0xFA, 0x4C, 0x64, 0x24, 0x1F, 0x7F, 0xE6, 0x09, 0x2E, 0x18, 0x91,
+    0x85, 0x52, 0x64, 0x4E, 0xE3, 0xF8, 0xB4, 0x09, 0x6E, 0xCE, 0x4D, 0x50, 0x2D, 0x27, 0x35, 0x99,
+    0xC8, 0x88, 0x16, 0x11, 0xF4, 0x78, 0x51, 0x5A, 0xED, 0xB1, 0x7D, 0xEE, 0x31, 0xBE, 0x18, 0x28,
+    0xBC, 0xE9, 0xD1, 0xA3, 0xE9, 0xD1, 0x53, 0xE9, 0xD2, 0x53, 0xA8, 0x5A, 0xF4, 0x64, 0x6B, 0xF4,
+    0x64, 0x41, 0x4F, 0x0D, 0xE4, 0xE3, 0xCA, 0x3D, 0x66, 0x00, 0xAA, 0x1E, 0x68, 0x1C, 0x28, 0xE1,
+    0x21, 0x8A, 0x19, 0x73, 0x22, 0x23, 0x46, 0xA4, 0xA7, 0x90, 0x19, 0x78, 0xAC, 0x4E, 0x24, 0x11,
+    0x09, 0x88, 0x04, 0x96, 0x93, 0x57, 0x54, 0x88, 0x5C, 0xA9, 0xC7, 0x38, 0xCD, 0xDC, 0x43, 0xF1,
+    0xD7, 0xAF, 0x50, 0x88, 0x60, 0x44, 0x9C, 0xE9, 0xAF, 0xF9, 0xD2, 0x15, 0x63, 0xD5, 0xEA, 0xC9,
+    0xD6, 0x59, 0xB0, 0xB5, 0x0A, 0x16, 0x15, 0x1A, 0x54, 0xD8, 0xA0, 0xC2, 0x4C, 0x16, 0x22, 0x3F,
+    0xE9, 0x31, 0x0E, 0xC6, 0x0C, 0x60, 0xDD, 0xA3, 0x4A, 0xDA, 0xEA, 0xD6, 0x42, 0x25, 0x13, 0x85,
+    0xA4, 0x1D, 0x53, 0x0C, 0xE4, 0x03, 0xF9, 0x48, 0xD9, 0x53, 0xB5, 0x34, 0x2D, 0xD6, 0xB1, 0x21,
+    0x9F, 0xA0, 0xA9, 0xF5, 0x88, 0x75, 0x20, 0x18, 0xA7, 0x03, 0xA8, 0x99, 0x06, 0xEB, 0x40, 0x87,
+    0x6C, 0xD2, 0x01, 0xD0, 0xA3, 0xE9, 0x6D, 0xDC, 0x30, 0x36, 0x9B, 0x01, 0x4C, 0x1F, 0xAA, 0x1E,
+    0xA0, 0x7A, 0xEB, 0x27, 0x73, 0x64, 0xF2, 0x6B, 0x7F, 0x3C, 0x00, 0xD0, 0x2D, 0x0B, 0x00, 0x5A,
+    0xC4, 0xC7, 0x2B, 0xEF, 0xBC, 0xE3, 0x00, 0xB2, 0xB9, 0xB1, 0x2D, 0x40, 0xF5, 0xFD, 0xA9, 0x01,
+    0xC8, 0x16, 0xD3, 0x2F, 0x00, 0xE5, 0x60, 0xB3, 0xB8, 0x3E, 0x2A, 0xE8, 0x09, 0x30, 0xBE, 0x18,
+    0x0A, 0x0F, 0x08, 0xB6, 0x36, 0x03, 0x18, 0xCF, 0x4C, 0xE5, 0x40, 0x6A, 0xED, 0xB1, 0x2D, 0xC5,
+    0x48, 0xE9, 0xE8, 0x02, 0x5D, 0xCD, 0x06, 0xC4, 0xE7, 0x13, 0x7A, 0x24, 0x5B, 0x27, 0x1C, 0x17,
+    0x7D, 0xBB, 0x21, 0x57, 0xAE, 0xDD, 0x67, 0xD0, 0x28, 0x12, 0x56, 0xA6, 0xDE, 0xEE, 0xF2, 0xF5,
+    0x71, 0x04, 0xC0, 0x63, 0x75, 0x29, 0x64, 0x23, 0xD5, 0xA2, 0x24, 0x60, 0xEB, 0x52, 0xFA, 0x0B,
+    0xD7, 0x06, 0xED, 0xF3, 0xE5, 0x2A, 0x74, 0x58, 0x04, 0xD0, 0x63, 0x3E, 0x54, 0x0E, 0xB0, 0xED,
+    0x99, 0x1E, 0x81, 0x6C, 0x32, 0x2E, 0x49, 0xAC, 0x60, 0x7A, 0x20, 0x9B, 0xAF, 0xFD, 0x59, 0x94,
+    0x51, 0x22, 0xE2, 0x22, 0x75, 0x24, 0xBE, 0xF1, 0x8C, 0xAF, 0xDA, 0x48, 0xDA, 0x28, 0x6F, 0x96,
+    0x7C, 0xA8, 0x5A, 0xA0, 0x74, 0x37, 0xB2, 0x00, 0xE8, 0xA9, 0xE8, 0xCB, 0xC8, 0x5B, 0x81, 0x05,
+    0x1E, 0xEB, 0x9C, 0x71, 0xC5, 0x9D, 0xAB, 0xB9, 0x78, 0x35, 0x61, 0xA5, 0x6D, 0x26, 0xAA, 0x9A,
+    0x6E, 0x54, 0x87, 0xE7, 0xA6, 0x97, 0xFB, 0xF4, 0x62, 0x93, 0xFE, 0x16, 0xFD, 0x3D, 0xA4, 0x59,
+    0x29, 0x12, 0x25, 0x2C, 0xA0, 0x3A, 0x69, 0xC9, 0x44, 0x16, 0x68, 0x44, 0x06, 0x7E, 0x85, 0x3C,
+    0xCA, 0xB8, 0x16, 0x30, 0x1E, 0xC8, 0xC2, 0x56, 0x6C, 0xD8, 0x7A, 0x15, 0x00, 0x65, 0x8F, 0x3A,
+    0xEA, 0x7A, 0x32, 0x91, 0x16, 0x64, 0x01, 0x1E, 0xFB, 0xBD, 0x69, 0x2B, 0x17, 0xE3, 0xB4, 0x9A,
+    0xAD, 0x04, 0xCD, 0xEF, 0xB9, 0x91, 0xF0, 0x15, 0x94, 0xB4, 0xE5, 0xDD, 0xD7, 0xC4, 0xE5, 0x12,
+    0xC5, 0xCF, 0x02, 0x3C, 0xDE, 0x03, 0x8C, 0x00, 0x07, 0xDB, 0xE1, 0xEA, 0xAD, 0xCC, 0xB7, 0x01,
+    0x30, 0xD3, 0x6E, 0xC1, 0xD4, 0x55, 0x54, 0x27, 0x4E, 0x8B, 0x8C, 0xD9, 0x9D, 0xE7, 0x22, 0x23,
+    0xC7, 0xC9, 0x86, 0x38, 0xC7, 0x7C, 0xE4, 0x89, 0xAE, 0xC7, 0xCE, 0xD0, 0x48, 0x1D, 0xB7, 0x6D,
+    0xEE, 0xE3, 0xEE, 0x8B, 0x3B, 0xB0, 0xC6, 0x0C, 0xCB, 0x51, 0xE7, 0x44, 0x84, 0x6B, 0x32, 0xC2,
+    0x35, 0xC0, 0xD4, 0x60, 0xDA, 0xDD, 0xFF, 0x55, 0x8D, 0x91, 0xBD, 0x9F, 0x2E, 0x7A, 0xB2, 0x80,
+    0xE9, 0x13, 0x4F, 0x56, 0x3D, 0xA5, 0xA3, 0xAB, 0xA9, 0xDA, 0x6C, 0x06, 0x5B, 0x17, 0x23, 0xD8,
+    0xBA, 0xEA, 0xA1, 0xA1, 0xAB, 0xA1, 0xCB, 0x66, 0x60, 0x53, 0x8C, 0xC0, 0x5C, 0xF5, 0x40, 0x68,
+    0x6A, 0x50, 0xF3, 0x0C, 0x64, 0x32, 0x01, 0xFA, 0x93, 0xB8, 0xED, 0x66, 0x40, 0xFB, 0x0E, 0xC8,
+    0xBD, 0x6D, 0xA1, 0x18, 0xCA, 0x1E, 0xCC, 0x50, 0x78, 0x30, 0xBD, 0x9E, 0xA0, 0x74, 0x59, 0x80,
+    0xD2, 0x21, 0x50, 0xB5, 0x34, 0x35, 0xB6, 0xA6, 0x12, 0x6C, 0x8D, 0x59, 0x68, 0x48, 0x2B, 0x18,
+    0x35, 0x52, 0x7C, 0x56, 0xD3, 0x8E, 0xFB, 0xE3, 0xEE, 0xD0, 0xFE, 0x1C, 0xC3, 0xAC, 0xFB, 0xA6,
+    0x72, 0xC6, 0x65, 0x81, 0x86, 0xCA, 0xA9, 0x90, 0x05, 0x8A, 0xA1, 0x72, 0xD8, 0xA7, 0x03, 0x84,
+    0xCA, 0x91, 0xFF, 0x55, 0x80, 0xEA, 0x96, 0x83, 0x2E, 0x80, 0xFE, 0x64, 0x04, 0xF3, 0x1D, 0x0F,
+    0x8D, 0x19, 0xC8, 0xA6, 0xB2, 0xC7, 0x0C, 0x95, 0xC3, 0xD6, 0xB6, 0x25, 0xD0, 0xD4, 0xB9, 0x47,
+    0x42, 0xD5, 0x22, 0x7E, 0x46, 0x49, 0x9B, 0x56, 0x46, 0xFB, 0x75, 0x61, 0x6F, 0xAC, 0x63, 0x32,
+    0x7D, 0xDC, 0x89, 0x45, 0x4F, 0x36, 0x61, 0x7A, 0xCC, 0x03, 0xC9, 0xFA, 0xCC, 0x07, 0x23, 0x58,
+    0x2D, 0x3D, 0x34, 0x5A, 0x6A, 0xE8, 0xF2, 0xFB, 0xC8, 0xDA, 0xD5, 0xA0, 0x16, 0x01, 0x32, 0x11,
+    0x40, 0x7F, 0x12, 0x77, 0xEB, 0xB2, 0x47, 0xD6, 0xA6, 0x85, 0x62, 0xE8, 0x7A, 0x30, 0xBD, 0x78,
+    0x30, 0xFD, 0x27, 0x13, 0x94, 0xEE, 0x7F, 0x7B, 0x00, 0x59, 0x1D, 0x16, 0xCC, 0x40, 0x03, 0xC5,
+    0xB8, 0xDD, 0x4C, 0x7A, 0x22, 0x7C, 0xBE, 0x1C, 0x54, 0x38, 0x6E, 0x5A, 0x15, 0xAE, 0xCF, 0x64,
+    0x53, 0x37, 0xA2, 0x47, 0xE9, 0xD1, 0x5E, 0x6A, 0xF2, 0x9F, 0x04, 0x28, 0x7E, 0xEC, 0xC1, 0xC8,
+    0x00, 0xE6, 0xC3, 0x3E, 0x51, 0xAA, 0x7C, 0x6B, 0x82, 0xEA, 0x0F, 0x02, 0xD8, 0x2F, 0x0A, 0xD8,
+    0x2F, 0x36, 0x2D, 0xD6, 0x94, 0x8E, 0xA6, 0x34, 0x9E, 0xCD, 0x05, 0x3D, 0x31, 0xA3, 0xC2, 0x3E,
+    0x29, 0x3C, 0xA5, 0xC3, 0x3A, 0x75, 0xED, 0x07, 0x74, 0x75, 0x2E, 0x92, 0xCD, 0x14, 0x22, 0xC5,
+    0xC8, 0x85, 0xEE, 0xA5, 0x7B, 0x39, 0x6C, 0xB9, 0x9F, 0x14, 0x91, 0xC3, 0xC6, 0x1D, 0x87, 0x7D,
+    0xFC, 0x29, 0x1C, 0xD6, 0x1B, 0x0F, 0xC6, 0xED, 0x38, 0xAC, 0x3A, 0x4F, 0x0A, 0x7B, 0x0F, 0x29,
+    0x2E, 0xB6, 0x49, 0x7C, 0xAA, 0x90, 0x34, 0x63, 0x21, 0xD2, 0x63, 0x45, 0xE0, 0xD9, 0x8F, 0xAF,
+    0xA6, 0x9D, 0xBF, 0x49, 0x7C, 0xD5, 0x1B, 0x97, 0xCD, 0x34, 0x54, 0xBD, 0x0A, 0xD9, 0x4C, 0x31,
+    0x54, 0x3D, 0xF6, 0xE9, 0x19, 0x42, 0xD5, 0x93, 0xFF, 0xD5, 0x0C, 0xD5, 0x1F, 0xF7, 0xD0, 0xCD,
+    0xE7, 0xF9, 0xCA, 0x9F, 0xE7, 0x2B, 0xB7, 0xE5, 0x2B, 0xAA, 0x16, 0x61, 0x46, 0xCD, 0x58, 0xF1,
+    0xB0, 0x94, 0x12, 0x40, 0x72, 0x11, 0x10, 0xB0, 0x2D, 0x02, 0xA6, 0x47, 0x40, 0x7B, 0x04, 0x54,
+    0x40, 0x80, 0x0E, 0x01, 0x6C, 0x2B, 0x80, 0xE9, 0x05, 0xD0, 0x5E, 0x00, 0x15, 0xA2, 0xF1, 0xD0,
+    0x45, 0x89, 0x5D, 0x03, 0xE6, 0x9D, 0x01, 0xE2, 0x52, 0xA2, 0x82, 0x75, 0xC0, 0x26, 0x1F, 0x01,
+    0x5B, 0x77, 0x80, 0x71, 0x66, 0x80, 0xDC, 0xAB, 0x19, 0xB2, 0x80, 0x75, 0xB0, 0x41, 0x4F, 0x60,
+    0x6B, 0x3A, 0x30, 0x0E, 0xE3, 0xC9, 0x3D, 0x2A, 0x6A, 0xED, 0x2A, 0x49, 0x5E, 0x2D, 0xD2, 0x66,
+    0xA1, 0x91, 0x91, 0xEE, 0xE2, 0x89, 0x50, 0x39, 0x72, 0x5F, 0x78, 0xD8, 0x64, 0x01, 0x4C, 0xDF,
+    0x01, 0x73, 0xE5, 0xC0, 0xBC, 0xE5, 0x41, 0xCD, 0x01, 0xA8, 0x22, 0x23, 0x8F, 0x80, 0xAD, 0x1C,
+    0xE4, 0x7E, 0x01, 0xBA, 0x7C, 0x24, 0xEE, 0x4F, 0x66, 0x16, 0x30, 0x2E, 0x1F, 0x51, 0x81, 0xCA,
+    0x51, 0xB5, 0x2C, 0xE8, 0x68, 0x5F, 0x15, 0x3D, 0x54, 0xB5, 0x1E, 0xC1, 0xF4, 0x2A, 0x80, 0xF6,
+    0x34, 0xA0, 0x02, 0x55, 0x0B, 0x1D, 0xA6, 0x07, 0xDB, 0x6A, 0xBF, 0x77, 0xB9, 0xDB, 0x5E, 0xDE,
+    0xC4, 0xCB, 0xB5, 0xBE, 0x73, 0x74, 0xF4, 0x7C, 0xAF, 0x44, 0x44, 0x3C, 0x9D, 0x88, 0x04, 0xEC,
+    0xFB, 0x27, 0x27, 0xCB, 0x7A, 0xD9, 0x83, 0x71, 0x2A, 0x40, 0xEE, 0xD9, 0x44, 0x6A, 0xD4, 0xBB,
+    0x6F, 0xE7, 0xF7, 0x5E, 0x9E, 0xB0, 0x35, 0xC8, 0x64, 0x1C, 0xD8, 0x39, 0xF7, 0x60, 0xA4, 0xDE,
+    0x69, 0xA7, 0x28, 0x94, 0x92, 0xAA, 0x9E, 0xF7, 0xB4, 0xF4, 0xFE, 0xE5, 0xED, 0xC3, 0xD6, 0x98,
+    0xDE, 0xF4, 0x68, 0xAF, 0x3D, 0x2A, 0xA8, 0x00, 0x1B, 0x36, 0x60, 0x6B, 0x5B, 0x63, 0x9C, 0x71,
+    0xE4, 0x3E, 0xF7, 0x64, 0x21, 0x5B, 0x4E, 0x4E, 0x16, 0x3A, 0x11, 0xA9, 0xAD, 0x88, 0xEC, 0xAE,
+    0x4C, 0xD9, 0x04, 0x0B, 0xCB, 0xFD, 0xDF, 0x91, 0xEF, 0x4F, 0x20, 0x7E, 0x4E, 0x9A, 0x67, 0xCF,
+    0x23, 0xB9, 0xD7, 0x57, 0xD9, 0xA4, 0xA1, 0x14, 0x3D, 0x54, 0x32, 0xC6, 0x09, 0x4A, 0xA4, 0xA8,
+    0x08, 0xB9, 0x8F, 0xDB, 0x21, 0x12, 0x15, 0xE6, 0x64, 0xC5, 0xF9, 0x78, 0xA7, 0xD2, 0xC5, 0x29,
+    0x46, 0xCA, 0xA3, 0xA7, 0x68, 0x7A, 0x47, 0xF2, 0x81, 0x7D, 0xE9, 0xE8, 0x68, 0x86, 0x44, 0x7F,
+    0x0A, 0x89, 0x06, 0x85, 0x3D, 0x39, 0x39, 0x59, 0xD2, 0xCD, 0x92, 0x41, 0x69, 0x5C, 0xBC, 0x59,
+    0x13, 0x87, 0x94, 0x85, 0x78, 0xC9, 0x0C, 0xF1, 0x92, 0xAD, 0xE3, 0xA5, 0x10, 0x2F, 0xE5, 0x3E,
+    0xFE, 0x4E, 0xD5, 0xC6, 0x4B, 0x49, 0x6F, 0xEA, 0x31, 0x5E, 0xDA, 0x5A, 0x4F, 0x49, 0x69, 0x88,
+    0x0C, 0xA6, 0x47, 0x8B, 0xD4, 0x16, 0xCA, 0xF7, 0x5F, 0x8D, 0xA4, 0xA6, 0x18, 0xD0, 0x63, 0x5C,
+    0x07, 0x07, 0x01, 0x1A, 0xC8, 0x7D, 0xE4, 0xF9, 0xF7, 0x4F, 0x6E, 0x0D, 0x44, 0x9A, 0xAF, 0xE6,
+    0x8F, 0x71, 0xE4, 0x1E, 0x1A, 0xA8, 0x1C, 0x91, 0xF2, 0x98, 0x4F, 0xB9, 0xC5, 0x04, 0x55, 0x8B,
+    0xE9, 0x61, 0x4E, 0xC6, 0x47, 0x21, 0x22, 0x12, 0xAD, 0xEA, 0x68, 0x6B, 0x96, 0x22, 0xB2, 0xA4,
+    0x65, 0x88, 0x86, 0x79, 0x9B, 0xD4, 0xCC, 0x98, 0x24, 0x90, 0x4D, 0x96, 0x47, 0xEE, 0xD3, 0xDA,
+    0x75, 0x49, 0x07, 0x16, 0x43, 0x62, 0xAC, 0x39, 0x31, 0x95, 0x71, 0x71, 0x89, 0x55, 0x00, 0x73,
+    0xF7, 0x95, 0xB8, 0x67, 0x45, 0x66, 0xF4, 0x04, 0x46, 0xE2, 0xB2, 0xAA, 0xA0, 0xA4, 0xD7, 0x1E,
+    0x2A, 0xA7, 0x84, 0x06, 0xF4, 0x44, 0x3E, 0x15, 0x03, 0x51, 0x46, 0xCE, 0x69, 0xF2, 0xA6, 0x87,
+    0x06, 0xCA, 0xEF, 0x85, 0xF8, 0x43, 0x73, 0xE9, 0xE2, 0x54, 0xBF, 0x3F, 0xC5, 0x85, 0x9D, 0x6D,
+    0x8D, 0x0A, 0x50, 0xBE, 0xED, 0xA1, 0x72, 0xA8, 0xD0, 0x44, 0xA6, 0xDF, 0x0A, 0x8A, 0xD5, 0xD8,
+    0x68, 0x92, 0x27, 0x61, 0x12, 0xE3, 0x67, 0xAB, 0x31, 0xD7, 0xA5, 0x4F, 0x36, 0x1E, 0xA0, 0x78,
+    0xBF, 0x8B, 0x1A, 0x3F, 0x9A, 0x52, 0x90, 0xA7, 0xBF, 0xA8, 0xAB, 0x7B, 0xFB, 0x25, 0xD1, 0x4B,
+    0x44, 0x66, 0x60, 0x39, 0x79, 0x2D, 0x5A, 0x4A, 0xC9, 0x35, 0x49, 0xDE, 0x49, 0x62, 0xCE, 0xC4,
+    0x09, 0xDA, 0x43, 0xE1, 0xC9, 0xFF, 0xFA, 0x15, 0x8A, 0x81, 0x42, 0xA4, 0x36, 0x3D, 0x46, 0xA4,
+    0x37, 0x0E, 0xF3, 0xEE, 0x35, 0x5F, 0x3A, 0x4A, 0x97, 0x4F, 0x55, 0x4B, 0xE9, 0xB2, 0x60, 0x5B,
+    0xAA, 0x56, 0x05, 0x5B, 0x63, 0x6B, 0x82, 0x05, 0x0B, 0xA1, 0x81, 0x06, 0xC2, 0x06, 0xA2, 0x1F,
+    0xC3, 0xB2, 0x9A, 0xA0, 0xD1, 0x2A, 0x5C, 0x67, 0x9B, 0x36, 0x77, 0x9A, 0x6A, 0xD5, 0x03, 0x8F,
+    0x22, 0x2D, 0x50, 0xDE, 0x12, 0x80, 0x52, 0xA6, 0xE8, 0x11, 0xDE, 0xE4, 0x9E, 0x47, 0x21, 0x23,
+    0xD0, 0xC9, 0x04, 0xB9, 0x88, 0x87, 0xF2, 0x0E, 0x8F, 0x40, 0xD3, 0x47, 0x83, 0x93, 0x17, 0xEA,
+    0x2C, 0x90, 0x8B, 0xCF, 0x47, 0x4A, 0x99, 0x0A, 0x8F, 0x7D, 0x23, 0x98, 0x1E, 0x61, 0x2E, 0x9D,
+    0x9A, 0x59, 0x2A, 0x97, 0x05, 0x16, 0xDB, 0xEA, 0x89, 0xC5, 0xD6, 0x7A, 0x64, 0xB1, 0x75, 0xEE,
+    0x59, 0x9A, 0xBA, 0xF0, 0x6A, 0x6E, 0xEA, 0xC2, 0x67, 0xA1, 0xA9, 0x0B, 0xAF, 0x83, 0xAD, 0x0B,
+    0x9F, 0x8F, 0xB6, 0x2D, 0xBC, 0xF1, 0xD6, 0x15, 0xBE, 0x1C, 0xAA, 0x3E, 0xF7, 0xD6, 0x19, 0xAF,
+    0x27, 0xA1, 0x98, 0x33, 0x99, 0xD1, 0xF2, 0xBE, 0x78, 0xE8, 0x44, 0xEE, 0x7E, 0x9B, 0xC7, 0x23,
+    0xB3, 0x3E, 0xF6, 0x74, 0x74, 0x8F, 0x3E, 0x57, 0x47, 0xF7, 0x30, 0x17, 0x4F, 0xD4, 0x5E, 0xF2,
+    0x83, 0xC3, 0xB8, 0xAC, 0xF9, 0xC8, 0xB5, 0x9B, 0x66, 0xC8, 0x64, 0x2A, 0x5D, 0x21, 0x73, 0xE5,
+    0xCA, 0x61, 0xB1, 0x6D, 0xE5, 0x36, 0xB6, 0xB6, 0xF5, 0xC6, 0xD6, 0x0D, 0x1B, 0x4B, 0xC3, 0x6C,
+    0xE9, 0x08, 0x96, 0x26, 0x0B, 0xB6, 0x6E, 0xF2, 0xB1, 0x72, 0xF6, 0x8B, 0x43, 0x39, 0x58, 0x71,
+    0xC5, 0x7C, 0x6D, 0x41, 0x8B, 0x2C, 0xAF, 0xD0, 0x88, 0x4C, 0xA8, 0xC3, 0x6A, 0x3C, 0x47, 0xA6,
+    0x6B, 0x32, 0x40, 0x93, 0x34, 0x75, 0xC0, 0x2C, 0x5C, 0x6C, 0xF5, 0x02, 0xD0, 0xB5, 0x40, 0x39,
+    0x00, 0x3A, 0x6C, 0xF9, 0x2E, 0xAE, 0xC4, 0xBC, 0xB3, 0xEC, 0xA3, 0x07, 0xD3, 0x6E, 0x0D, 0x49,
+    0x5B, 0x93, 0x9C, 0xE3, 0xF8, 0x85, 0xF4, 0x6E, 0xBB, 0xFD, 0x6C, 0xB5, 0x2E, 0x00, 0x14, 0x33,
+    0xAA, 0xC6, 0x2E, 0xAF, 0x05, 0xE8, 0x44, 0x1C, 0x4A, 0xE4, 0x5D, 0xE0, 0x7A, 0x0D, 0xE8, 0xE8,
+    0x5C, 0x02, 0x64, 0x7E, 0x2B, 0xF4, 0x8B, 0x01, 0xA8, 0x02, 0x90, 0xC9, 0xDE, 0x2C, 0x1E, 0x3B,
+    0x84, 0x4E, 0x9C, 0x12, 0xF1, 0x99, 0xBC, 0x74, 0x5B, 0x49, 0xFA, 0x89, 0x2E, 0xFD, 0xF6, 0x7D,
+    0xD8, 0x8B, 0x4D, 0xFB, 0x5B, 0xFB, 0xF5, 0x0D, 0x97, 0x2C, 0x3A, 0xF9, 0xC1, 0x19, 0x46, 0xA4,
+    0xA6, 0x93, 0x16, 0xFD, 0x2E, 0x70, 0x0A, 0x94, 0x40, 0xDE, 0x83, 0x4A, 0x10, 0x85, 0x59, 0xB6,
+    0x76, 0x75, 0xF4, 0xE8, 0x42, 0xB3, 0x3E, 0x4D, 0x91, 0x95, 0x93, 0xE7, 0xB6, 0x92, 0x40, 0xEF,
+    0x50, 0x94, 0x2D, 0x68, 0x70, 0x2F, 0x94, 0xD2, 0xAE, 0x94, 0xB2, 0xF5, 0xA7, 0x40, 0x18, 0xF3,
+    0xAA, 0x61, 0xE2, 0xDD, 0x65, 0x00, 0x2D, 0x3D, 0x68, 0x71, 0x0F, 0xB8, 0xD5, 0x16, 0x0D, 0xB1,
+    0x24, 0xF3, 0x7A, 0x7D, 0x5C, 0x45, 0x5D, 0x45, 0x7B, 0x1B, 0xE8, 0x02, 0xE6, 0x2D, 0x09, 0x46,
+    0x02, 0x07, 0x37, 0x9E, 0x1B, 0x97, 0xE7, 0x46, 0x25, 0x7D, 0xF1, 0x81, 0x33, 0x43, 0x11, 0x28,
+    0x03, 0x55, 0x6B, 0x7B, 0x1A, 0xC7, 0x06, 0x41, 0xCD, 0xE8, 0x29, 0x1F, 0x29, 0x3C, 0xA6, 0xAF,
+    0x1C, 0xB6, 0xC5, 0xB2, 0x81, 0x19, 0x15, 0xF4, 0x48, 0xEE, 0x29, 0x06, 0xE3, 0x28, 0x5D, 0xC4,
+    0xFE, 0x36, 0x30, 0x67, 0x13, 0x7A, 0x24, 0xF7, 0x66, 0xC0, 0x38, 0x4A, 0x67, 0x6B, 0x1A, 0xD8,
+    0x10, 0xC8, 0x02, 0x7A, 0xCA, 0x3D, 0x66, 0xC0, 0x7C, 0x5C, 0xB5, 0xD8, 0x9A, 0x6A, 0x9E, 0x21,
+    0x40, 0x95, 0x24, 0xDB, 0x2A, 0xFA, 0x36, 0xE7, 0xFD, 0xF8, 0x55, 0x11, 0x25, 0x37, 0x37, 0x49,
+    0x0C, 0x8A, 0xE1, 0x06, 0xA8, 0x60, 0x89, 0x50, 0x4D, 0xE1, 0xAB, 0x96, 0xB2, 0x2F, 0x1D, 0xB6,
+    0x35, 0x8E, 0x0E, 0xD3, 0xAB, 0x99, 0x62, 0xD0, 0x13, 0xF9, 0x50, 0x78, 0xB4, 0x2F, 0x1D, 0xDA,
+    0xDB, 0x96, 0x6C, 0xEC, 0x40, 0xDD, 0x09, 0x80, 0x8C, 0x80, 0xF8, 0x55, 0x98, 0x36, 0xF5, 0x67,
+    0x60, 0x65, 0x71, 0x1D, 0xA6, 0x73, 0xAB, 0xBC, 0x33, 0x46, 0x02, 0x54, 0x6F, 0x8E, 0x30, 0x9B,
+    0x3E, 0x0E, 0xC5, 0xD6, 0x1B, 0xF4, 0xA4, 0x02, 0xA5, 0xCB, 0x3D, 0x0B, 0xC6, 0xE5, 0x1E, 0x8B,
+    0xAD, 0x99, 0xB3, 0x10, 0x11, 0xA7, 0xA2, 0xDF, 0x40, 0xF5, 0xA2, 0x87, 0x1B, 0xB6, 0x8D, 0x23,
+    0xD2, 0x9F, 0xF4, 0x60, 0x04, 0xB0, 0x63, 0xDA, 0x93, 0x59, 0x58, 0xF7, 0x81, 0x3D, 0xE7, 0x43,
+    0xED, 0xDB, 0xD7, 0x89, 0x48, 0x0D, 0x40, 0x3E, 0x40, 0xE9, 0x2C, 0x09, 0x9B, 0xED, 0xA8, 0x5A,
+    0xCA, 0x5E, 0x05, 0xF4, 0x84, 0x71, 0x74, 0x30, 0x53, 0xF6, 0x91, 0x32, 0xDC, 0xA0, 0x23, 0x92,
+    0x06, 0xAB, 0x27, 0x22, 0x6D, 0x28, 0xFF, 0xD8, 0xAD, 0xC4, 0x31, 0xB2, 0x55, 0x35, 0xF9, 0x08,
+    0x1C, 0x35, 0x47, 0x35, 0x95, 0x48, 0x40, 0x8B, 0x88, 0xE3, 0x89, 0x5B, 0x77, 0x5F, 0x59, 0xDD,
+    0xCC, 0xD2, 0x6D, 0x0D, 0xB7, 0x3D, 0x09, 0xB1, 0x43, 0x07, 0x09, 0x50, 0xB9, 0xD5, 0x62, 0x2B,
+    0x7C, 0x64, 0x96, 0x0D, 0x7A, 0xA2, 0x74, 0x2A, 0x90, 0x7B, 0x96, 0x84, 0x09, 0xDB, 0x68, 0xD8,
+    0x55, 0x2E, 0x52, 0x8A, 0xB3, 0x62, 0x48, 0xA4, 0xCA, 0x7F, 0x34, 0xAD, 0xAB, 0x67, 0xCF, 0xD6,
+    0x01, 0x6A, 0xA9, 0x57, 0x09, 0x56, 0xB9, 0xA4, 0xAC, 0x73, 0x91, 0x00, 0x5F, 0x5A, 0x8E, 0x3E,
+    0x0D, 0xCC, 0xDD, 0x83, 0x6C, 0xA3, 0xFE, 0x56, 0x01, 0xAC, 0x4B, 0x7E, 0x5F, 0x31, 0x50, 0xF6,
+    0x10, 0x92, 0x19, 0x16, 0x8D, 0xFD, 0xC2, 0x03, 0x21, 0xF7, 0x40, 0xF5, 0x8D, 0x11, 0xC8, 0x3F,
+    0x1A, 0x01, 0xA2, 0x56, 0xAA, 0x02, 0x5B, 0xB1, 0x17, 0xC5, 0x95, 0x92, 0x7E, 0x77, 0x79, 0xB1,
+    0x00, 0x9D, 0xE9, 0x81, 0x26, 0x9B, 0x00, 0x5B, 0x5B, 0xC0, 0xB6, 0xA6, 0x87, 0x6A, 0x75, 0xEB,
+    0x2D, 0x94, 0x3D, 0xA6, 0xC7, 0x0C, 0x64, 0x32, 0x18, 0x0F, 0x76, 0x2A, 0x3C, 0x98, 0x7D, 0x63,
+    0xB8, 0x74, 0x5B, 0xF1, 0x98, 0x00, 0xF1, 0xE4, 0xF0, 0xEF, 0x5F, 0xDE, 0xD9, 0x6F, 0x13, 0xF9,
+    0x44, 0xE9, 0x58, 0x60, 0xC6, 0xAE, 0x4E, 0x87, 0x8D, 0x6A, 0xDF, 0xD6, 0x60, 0xBE, 0x3B, 0x00,
+    0xDD, 0x04, 0xE4, 0x42, 0x12, 0x90, 0xE4, 0x01, 0x50, 0x32, 0x00, 0xB6, 0x03, 0xCC, 0x8F, 0x46,
+    0x22, 0x46, 0x4A, 0xC7, 0x0C, 0xA5, 0x2B, 0x3C, 0xF9, 0x88, 0x9D, 0x58, 0xC8, 0xC4, 0x59, 0x97,
+    0x40, 0x12, 0x5B, 0x6F, 0x41, 0x86, 0x2D, 0x53, 0xC2, 0xD9, 0x0E, 0x7B, 0x0B, 0x51, 0x8A, 0xEA,
+    0x9F, 0x88, 0x88, 0xF8, 0xF2, 0x2D, 0x11, 0x91, 0xB6, 0x83, 0x2E, 0xDA, 0x21, 0x81, 0x44, 0x01,
+    0x2C, 0x24, 0x53, 0x29, 0x44, 0x33, 0xC4, 0x83, 0x6D, 0x89, 0x7E, 0x0F, 0xCB, 0xD6, 0x50, 0x29,
+    0x1D, 0xA5, 0x83, 0x0D, 0xC9, 0x28, 0xCB, 0xA6, 0xED, 0x2D, 0x9A, 0xF5, 0x16, 0x2A, 0x5A, 0x63,
+    0x85, 0x8F, 0xD6, 0x5A, 0x34, 0x15, 0xE7, 0xAD, 0x91, 0x53, 0xC5, 0x5B, 0x2C, 0xAB, 0x8D, 0xA8,
+    0x45, 0x44, 0xA4, 0x36, 0x12, 0x5D, 0x9E, 0xD5, 0xE6, 0xDC, 0x46, 0x25, 0xE2, 0x7A, 0x68, 0xBF,
+    0x2F, 0xA5, 0x9A, 0x7D, 0xA0, 0x71, 0x0B, 0x33, 0xEE, 0x8C, 0xAF, 0xC9, 0xBC, 0x2D, 0x22, 0xBD,
+    0x7D, 0xF8, 0xB5, 0xE5, 0x44, 0x45, 0x0C, 0x69, 0x88, 0x73, 0x8C, 0x53, 0x8C, 0x33, 0x8C, 0x13,
+    0x9C, 0x61, 0x93, 0xA6, 0x57, 0x3A, 0x8C, 0x63, 0x03, 0x5D, 0xB2, 0xCF, 0x4C, 0x4F, 0xD5, 0x63,
+    0x41, 0x6A, 0x02, 0x26, 0xA0, 0x47, 0xF5, 0x89, 0xC7, 0xDC, 0xB9, 0xF6, 0xCD, 0xF7, 0x28, 0x65,
+    0xB2, 0x13, 0xA5, 0xD4, 0x4D, 0x8F, 0xAA, 0x23, 0x4B, 0x44, 0x7B, 0xAB, 0xF0, 0xBB, 0xF1, 0xCF,
+    0xBB, 0xD1, 0x97, 0x4E, 0xAF, 0xEC, 0x50, 0xBA, 0x0D, 0x14, 0xDE, 0xB6, 0xE8, 0xC9, 0xF4, 0x30,
+    0xE7, 0x1E, 0x6C, 0xB6, 0xBD, 0x32, 0xD8, 0xFA, 0xDC, 0x95, 0xF8, 0x9D, 0x2E, 0xF9, 0xA2, 0xF9,
+    0x98, 0xCF, 0x47, 0x5D, 0x40, 0x44, 0x84, 0x42, 0xE4, 0x9A, 0xE3, 0x89, 0x57, 0xCC, 0x83, 0xF6,
+    0x5C, 0xE5, 0x56, 0xB5, 0xA8, 0x47, 0x40, 0x89, 0x07, 0x9A, 0xAD, 0xBF, 0xFB, 0x19, 0x7E, 0x56,
+    0x55, 0xDF, 0x4B, 0xDA, 0x25, 0x6E, 0x2B, 0x33, 0x84, 0x68, 0x69, 0x97, 0x6F, 0x4C, 0x64, 0xC1,
+    0xD6, 0xD8, 0x17, 0x47, 0xF2, 0xD1, 0x82, 0x3C, 0x33, 0x62, 0xBD, 0x75, 0xA5, 0x64, 0x22, 0x1F,
+    0x0C, 0x46, 0xA6, 0x99, 0x6A, 0x32, 0x2E, 0xDD, 0xB8, 0x72, 0x49, 0xAA, 0xDB, 0x1A, 0x72, 0x69,
+    0xA1, 0x99, 0xA0, 0x90, 0x3A, 0x8D, 0xAE, 0x59, 0x49, 0xB7, 0x59, 0x7F, 0x3A, 0xFC, 0x2C, 0x54,
+    0x53, 0xFB, 0x54, 0xFB, 0x5D, 0x3D, 0x19, 0x57, 0x31, 0xE7, 0xDE, 0xB4, 0x36, 0x0B, 0xBA, 0x2F,
+    0x5D, 0xA7, 0x7C, 0x31, 0x54, 0xEE, 0x34, 0x1F, 0xF3, 0xB9, 0x39, 0x4F, 0xB5, 0x7F, 0x38, 0x9A,
+    0x01, 0x4E, 0xF5, 0x08, 0x07, 0x04, 0x30, 0x6D, 0x03, 0xBA, 0xAF, 0x1C, 0xCA, 0xEF, 0x51, 0x6D,
+    0x8F, 0x9E, 0xED, 0x67, 0xD2, 0xE2, 0x29, 0x6F, 0x5F, 0x1C, 0x2F, 0xE5, 0xA3, 0xD5, 0x83, 0x3C,
+    0x33, 0x5E, 0xB1, 0xDE, 0x7E, 0xE3, 0x9D, 0x7D, 0x5A, 0xCC, 0xC6, 0x61, 0x54, 0x40, 0xF9, 0xCA,
+    0x51, 0xE9, 0x09, 0x3D, 0xD8, 0x9A, 0xCF, 0xE7, 0x7E, 0x9D, 0xFD, 0x90, 0xE0, 0xE4, 0x07, 0xFE,
+    0xEE, 0xBD, 0x23, 0x4A, 0x9E, 0xF2, 0x63, 0x35, 0xE6, 0xCF, 0x44, 0x6A, 0x2D, 0x22, 0xA3, 0x92,
+    0xE5, 0x35, 0xA1, 0xBB, 0x49, 0xD5, 0xDB, 0x36, 0x89, 0xF5, 0xF9, 0x67, 0x26, 0xA0, 0x3F, 0xCF,
+    0x76, 0xCD, 0x7D, 0x00, 0xD4, 0xA7, 0x2A, 0xC8, 0xAB, 0xE8, 0xB1, 0x5A, 0x30, 0x6F, 0x89, 0x60,
+    0x9B, 0x67, 0x67, 0x25, 0xBD, 0x9E, 0x8A, 0x19, 0x33, 0xD8, 0x21, 0x22, 0x41, 0x73, 0x3E, 0xA2,
+    0xC7, 0xCA, 0xC5, 0x9F, 0xEA, 0xF4, 0x48, 0x36, 0x19, 0x87, 0xE9, 0x1B, 0xB0, 0xD9, 0x84, 0x0A,
+    0x66, 0x88, 0x23, 0xB0, 0x6D, 0x88, 0x03, 0xD0, 0xBE, 0x6A, 0x29, 0xDD, 0xBC, 0xC3, 0xDA, 0xA3,
+    0x77, 0x32, 0x44, 0x27, 0x75, 0x8C, 0x9B, 0x7D, 0x04, 0x33, 0x53, 0x79, 0x90, 0x9A, 0xAA, 0xC7,
+    0x44, 0x2F, 0xB7, 0xAB, 0x13, 0x88, 0x48, 0x3E, 0x86, 0xCA, 0x41, 0xF5, 0x56, 0xBF, 0x40, 0x26,
+    0xD5, 0x17, 0x3C, 0x34, 0x7E, 0x53, 0x39, 0x75, 0x4B, 0x9E, 0x16, 0x11, 0x91, 0x41, 0x4B, 0xB4,
+    0x31, 0x3B, 0xB9, 0xFB, 0x87, 0x5B, 0xF9, 0x92, 0x9C, 0xA7, 0x64, 0x7E, 0x24, 0x61, 0x9F, 0x1C,
+    0xC5, 0x14, 0x8B, 0x49, 0x9F, 0x88, 0x7F, 0xCC, 0x8C, 0xFA, 0x36, 0x18, 0x39, 0x91, 0xA8, 0x1E,
+    0x05, 0xC8, 0x25, 0x7A, 0x51, 0x47, 0x75, 0x8A, 0x7B, 0x80, 0x92, 0x05, 0x32, 0x91, 0x81, 0x4C,
+    0x9E, 0x0D, 0x64, 0x33, 0xB6, 0x66, 0xC1, 0xBC, 0xED, 0x3B, 0xF4, 0xC7, 0xA3, 0xAD, 0xB3, 0x70,
+    0x56, 0xB9, 0x6C, 0xAE, 0xDE, 0x79, 0xEF, 0xD6, 0xA2, 0x45, 0x64, 0xA6, 0x11, 0x79, 0x17, 0xBA,
+    0xC3, 0x73, 0x58, 0xBF, 0xDA, 0xB9, 0x09, 0xC5, 0xC8, 0xAF, 0x83, 0xBC, 0xD4, 0x41, 0x29, 0xE2,
+    0xA0, 0x93, 0xF6, 0x1E, 0x9F, 0xF4, 0xBF, 0x50, 0xBA, 0xCD, 0xF5, 0x9E, 0xF8, 0x4F, 0xF7, 0xDA,
+    0xEC, 0x5B, 0xAE, 0xE7, 0x54, 0xC2, 0xD6, 0x75, 0xF9, 0xBB, 0x24, 0x73, 0x31, 0x7E, 0x66, 0x20,
+    0x3C, 0xA2, 0xEF, 0x12, 0x28, 0x25, 0x70, 0x51, 0x6E, 0x46, 0x22, 0xEC, 0xC5, 0x4F, 0xB6, 0xD1,
+    0xCA, 0xFD, 0x88, 0x65, 0x82, 0xA6, 0x56, 0xB0, 0xA9, 0x72, 0x3B, 0x08, 0xC9, 0xB2, 0x05, 0x9F,
+    0xD6, 0x5B, 0x5D, 0x5C, 0xA0, 0x11, 0x4F, 0x27, 0x31, 0x58, 0xF8, 0x79, 0x3E, 0x17, 0x09, 0x71,
+    0x7D, 0x0D, 0xBE, 0x35, 0xEB, 0x1E, 0xB2, 0x12, 0xD6, 0x30, 0xF2, 0x90, 0xA0, 0x8B, 0x7F, 0xC2,
+    0x03, 0x1F, 0x6A, 0x24, 0x1B, 0xC9, 0x26, 0x08, 0xE8, 0x91, 0x62, 0x84, 0x19, 0xED, 0x29, 0x7B,
+    0xB8, 0x41, 0xEE, 0x69, 0x5A, 0xB0, 0x14, 0x03, 0x0B, 0x50, 0xB5, 0xA6, 0xD7, 0x21, 0x62, 0xB6,
+    0xCE, 0x78, 0xA0, 0xE8, 0x4B, 0x57, 0x45, 0x32, 0x96, 0xAE, 0x8B, 0x7E, 0x6B, 0xF5, 0xB5, 0x39,
+    0xC6, 0x4A, 0xEC, 0x17, 0xA2, 0xF6, 0x5E, 0xBA, 0x5B, 0xC3, 0xAA, 0xB6, 0x63, 0x38, 0x53, 0x24,
+    0x02, 0x95, 0xF9, 0x9D, 0xA5, 0x69, 0x01, 0xCC, 0x30, 0xC7, 0x85, 0xB7, 0x2E, 0x46, 0xFD, 0x10,
+    0x15, 0x22, 0x69, 0x43, 0x36, 0x45, 0x98, 0x69, 0xD4, 0x63, 0x36, 0x01, 0xE5, 0xA0, 0xBD, 0x0A,
+    0x40, 0xD3, 0x6A, 0xCF, 0x0C, 0x08, 0xB9, 0xA7, 0x01, 0x1D, 0x28, 0x06, 0x6C, 0x8D, 0xF1, 0x98,
+    0x9E, 0xAA, 0xA5, 0xEA, 0xA3, 0xFB, 0x44, 0xD7, 0x52, 0xBA, 0x28, 0x5E, 0xD1, 0x5E, 0x25, 0xB3,
+    0xC2, 0xA5, 0xC0, 0x5E, 0xD5, 0x76, 0x2B, 0xE5, 0x92, 0x23, 0x62, 0x97, 0xFD, 0x74, 0x89, 0xED,
+    0xE3, 0x42, 0x0D, 0xA0, 0x0E, 0x91, 0x01, 0xE3, 0xE8, 0xBC, 0x16, 0x4F, 0x43, 0x29, 0xEE, 0xC2,
+    0xB5, 0x21, 0x9B, 0x90, 0x97, 0xA0, 0x72, 0x45, 0x6F, 0x3C, 0x60, 0xB1, 0x91, 0x67, 0x67, 0x42,
+    0x8C, 0x6D, 0x8E, 0xB9, 0x8F, 0x4C, 0xD3, 0x57, 0x6D, 0x84, 0x3A, 0x5F, 0x5A, 0x9E, 0x1D, 0x57,
+    0x1C, 0x6E, 0x0D, 0x6E, 0x46, 0x80, 0xE6, 0x07, 0xDD, 0x97, 0x26, 0x80, 0x4D, 0x36, 0x25, 0x5B,
+    0xDB, 0xF4, 0x29, 0xBA, 0x69, 0xA3, 0x5E, 0x98, 0x23, 0x4C, 0x8B, 0xF1, 0xF9, 0xA0, 0x27, 0xF8,
+    0x92, 0x50, 0xD5, 0xC5, 0x9D, 0x43, 0x2D, 0x9E, 0x80, 0x91, 0xB6, 0x5C, 0xD0, 0x9E, 0x62, 0x49,
+    0x93, 0x50, 0x87, 0x7F, 0x63, 0x68, 0x28, 0x46, 0xDC, 0xF8, 0xCC, 0x88, 0x5B, 0x8C, 0x87, 0x2C,
+    0x71, 0x1D, 0xA7, 0x38, 0xE4, 0x1A, 0x2D, 0x27, 0xD2, 0xA3, 0x3D, 0x95, 0x27, 0xF7, 0xE4, 0x13,
+    0xC5, 0x90, 0x82, 0x7B, 0xCC, 0x98, 0x1E, 0x96, 0x64, 0x14, 0xC6, 0xE7, 0xAA, 0x85, 0x05, 0x5B,
+    0xC3, 0x82, 0x05, 0x16, 0x9A, 0x14, 0x76, 0x4C, 0x8E, 0x69, 0x14, 0x20, 0x31, 0x58, 0x54, 0x46,
+    0x03, 0xB8, 0x47, 0x91, 0x49, 0x8D, 0x7E, 0xBF, 0x5B, 0x40, 0x8B, 0x8C, 0x90, 0x45, 0x56, 0xBA,
+    0x70, 0xF8, 0xF3, 0x44, 0xDF, 0x64, 0x88, 0x77, 0x31, 0xEF, 0x3E, 0x3F, 0xD2, 0x60, 0x7C, 0x36,
+    0x61, 0x06, 0xD3, 0x47, 0xEF, 0xAA, 0x21, 0xA0, 0x42, 0xEE, 0xC9, 0xB7, 0x4A, 0xAA, 0x5B, 0xBD,
+    0x56, 0xD3, 0xB3, 0xF7, 0x2F, 0xEB, 0x68, 0xF3, 0x05, 0xFD, 0x89, 0x0C, 0x18, 0x59, 0xA0, 0xDC,
+    0x06, 0xD3, 0x81, 0x6A, 0x2B, 0x8F, 0x7B, 0xC8, 0xE3, 0xFA, 0x56, 0x6D, 0x16, 0x80, 0x19, 0x33,
+    0x80, 0xF6, 0xD8, 0x1A, 0x2A, 0x47, 0x00, 0x96, 0x18, 0x59, 0x1D, 0xA9, 0xA2, 0x60, 0x58, 0x80,
+    0xCD, 0x2A, 0x3D, 0x4A, 0x07, 0xC6, 0xD1, 0x00, 0x4D, 0x94, 0x2A, 0x53, 0x14, 0x22, 0x7D, 0x42,
+    0xA5, 0x93, 0xB4, 0x89, 0x61, 0x4E, 0xAA, 0x16, 0x9A, 0x15, 0x27, 0xD7, 0x1E, 0xCA, 0x9E, 0xD2,
+    0x11, 0x13, 0x90, 0x28, 0x46, 0xF4, 0xC4, 0x13, 0xD2, 0x62, 0xA4, 0x95, 0x00, 0x36, 0x68, 0x69,
+    0x51, 0x32, 0xA8, 0xC3, 0x15, 0x43, 0x42, 0x9D, 0x33, 0xC1, 0xBB, 0x7D, 0xB9, 0x6C, 0x1D, 0xAC,
+    0x8B, 0xB6, 0x7D, 0x1C, 0x02, 0xB9, 0x44, 0xC0, 0xDE, 0x81, 0xBC, 0x36, 0x41, 0xD9, 0x57, 0x2D,
+    0x7A, 0xD4, 0x23, 0x34, 0x58, 0x30, 0x7D, 0xEE, 0x21, 0xB0, 0x89, 0x32, 0x05, 0x3D, 0x46, 0xB4,
+    0xBA, 0x74, 0x14, 0x43, 0xB4, 0xDF, 0xAB, 0x96, 0xD2, 0xE9, 0x11, 0x3D, 0x62, 0xA1, 0x21, 0xF7,
+    0x94, 0x03, 0x1D, 0xD7, 0x02, 0x46, 0x7E, 0x47, 0x40, 0x7C, 0xD7, 0x62, 0x16, 0x12, 0xC0, 0xB4,
+    0xBA, 0xCE, 0x3B, 0x7F, 0xE9, 0xC6, 0x56, 0x75, 0x64, 0xD3, 0x2F, 0x25, 0x7E, 0xD3, 0xFE, 0x92,
+    0xE3, 0x37, 0x21, 0xB1, 0x7F, 0x0C, 0x29, 0xAC, 0xB1, 0x8D, 0xD5, 0xB7, 0x88, 0x34, 0x4E, 0x20,
+    0x4D, 0x94, 0x46, 0x42, 0xDA, 0x00, 0x4A, 0x3A, 0xA9, 0xA1, 0x11, 0xA9, 0x49, 0x79, 0x32, 0x7B,
+    0x3B, 0xE0, 0xFF, 0xDD, 0x60, 0xCE, 0x94, 0x4D, 0x30, 0x33, 0x3F, 0x18, 0x0C, 0x50, 0x6B, 0x72,
+    0xC2, 0xA3, 0x08, 0x14, 0x9F, 0x48, 0x9D, 0x76, 0x68, 0xB3, 0xEC, 0x10, 0xE6, 0xFF, 0x6C, 0x43,
+    0x69, 0x61, 0x3F, 0x94, 0xC6, 0x96, 0x9F, 0x92, 0x01, 0x12, 0x41, 0x82, 0x68, 0xF3, 0x44, 0x9C,
+    0xFD, 0xDC, 0xEA, 0xFC, 0xDD, 0x84, 0xD2, 0xFE, 0x62, 0x02, 0x19, 0xB7, 0xA1, 0xB4, 0x2B, 0x3B,
+    0x6B, 0xA4, 0x5D, 0x07, 0x9A, 0xEF, 0xAF, 0xC6, 0xDF, 0xC6, 0xB3, 0x42, 0x4F, 0xC6, 0xAD, 0x8E,
+    0x41, 0xF6, 0xCB, 0xF1, 0x47, 0x9B, 0x00, 0x94, 0x02, 0x31, 0xA3, 0xEA, 0xBE, 0x4F, 0x9F, 0xF7,
+    0x4E, 0x09, 0xE7, 0x28, 0x39, 0xC3, 0x62, 0x1C, 0xE6, 0x7B, 0x01, 0x42, 0xD5, 0x52, 0xBE, 0x39,
+    0x46, 0x90, 0xD2, 0x3E, 0xE3, 0x29, 0x7C, 0x83, 0x92, 0xDC, 0x63, 0xBD, 0x6D, 0xAB, 0x45, 0x4B,
+    0xF7, 0x61, 0x6F, 0x64, 0x0C, 0x54, 0x53, 0xE9, 0xD2, 0xDA, 0xD8, 0xF5, 0x27, 0x6D, 0xC2, 0x27,
+    0xCB, 0x05, 0x32, 0xE9, 0xEF, 0xB9, 0x92, 0xDF, 0xE7, 0x92, 0x16, 0x13, 0x50, 0x8D, 0x58, 0x0F,
+    0x48, 0xAF, 0xC4, 0x41, 0x21, 0xD1, 0x93, 0x6D, 0x02, 0xF6, 0x0C, 0xF4, 0x27, 0x9E, 0x79, 0x82,
+    0xF2, 0x56, 0xAB, 0x3F, 0x1A, 0x20, 0xCC, 0x94, 0xDF, 0x74, 0xE4, 0x3F, 0xF2, 0x6C, 0x2C, 0xD8,
+    0xD2, 0xE9, 0x31, 0x90, 0x4D, 0x1B, 0xCC, 0x9B, 0x1E, 0xF3, 0xE6, 0x84, 0x2D, 0x1C, 0x67, 0xA6,
+    0x57, 0x53, 0x55, 0x6B, 0x6F, 0x29, 0x86, 0xEB, 0x54, 0x4F, 0x05, 0xEC, 0x53, 0x93, 0x0A, 0xC5,
+    0x40, 0xD0, 0x83, 0x71, 0xB6, 0xCE, 0xBD, 0x71, 0x37, 0x98, 0x29, 0x5B, 0xAB, 0x7D, 0xEE, 0x39,
+    0x23, 0x94, 0x6D, 0xE9, 0xB4, 0xCF, 0x7C, 0x60, 0x83, 0x71, 0xC5, 0x9F, 0xF7, 0x7A, 0xA4, 0xA1,
+    0x6C, 0x30, 0x2E, 0x9B, 0x68, 0x46, 0x1A, 0x4C, 0x8F, 0xB8, 0x2C, 0x60, 0xD1, 0x33, 0x46, 0x5C,
+    0xC0, 0x0C, 0x91, 0x95, 0x6D, 0x42, 0x66, 0xB7, 0xDC, 0xBC, 0xA5, 0x72, 0x31, 0x9C, 0x03, 0x84,
+    0xD7, 0x48, 0xD9, 0x0A, 0x1F, 0x2F, 0xF7, 0x99, 0x8B, 0x76, 0x80, 0xCE, 0x99, 0x00, 0x8D, 0xD7,
+    0x02, 0x76, 0x52, 0xE2, 0x28, 0x67, 0xCE, 0x3C, 0xE6, 0x43, 0xEC, 0x75, 0xF2, 0x77, 0x9C, 0xF9,
+    0x66, 0xAD, 0x3F, 0xF2, 0xF9, 0x8F, 0x86, 0xEC, 0x27, 0x93, 0x1A, 0x27, 0xA6, 0x33, 0x4E, 0x2B,
+    0x4E, 0x2D, 0xB6, 0x70, 0x07, 0xC6, 0x99, 0xAF, 0x79, 0xAB, 0x7D, 0xDE, 0x5F, 0x2F, 0x9F, 0x9A,
+    0xB2, 0xD1, 0x7C, 0xD1, 0x9D, 0x71, 0xAA, 0x7F, 0xDC, 0x5B, 0x2C, 0x9F, 0x78, 0xE3, 0x4C, 0x6B,
+    0x7D, 0x3E, 0xE4, 0x7D, 0x31, 0x29, 0xF9, 0xFE, 0x98, 0x05, 0x3A, 0x1F, 0xB8, 0x81, 0x8D, 0x63,
+    0x3B, 0x65, 0x9B, 0xD3, 0x14, 0xE1, 0x8B, 0x75, 0x6B, 0xF6, 0x3B, 0x17, 0x22, 0x9B, 0xFE, 0xAE,
+    0x6D, 0xF1, 0xDF, 0xE5, 0x73, 0x40, 0x15, 0xA3, 0x25, 0x83, 0xE9, 0x01, 0x91, 0x61, 0xEB, 0x8F,
+    0xF1, 0x3F, 0xD6, 0xF7, 0x12, 0x32, 0x0A, 0x0E, 0x15, 0x65, 0x4C, 0x34, 0x8A, 0x9B, 0x18, 0xF0,
+    0x39, 0x03, 0x28, 0xFF, 0xB8, 0x05, 0xCC, 0x5B, 0x03, 0x50, 0xF8, 0x98, 0xD0, 0x64, 0x81, 0x2C,
+    0x18, 0x07, 0x04, 0x1D, 0xF9, 0x35, 0x26, 0xC3, 0xDA, 0x1A, 0x6C, 0x5B, 0x0C, 0x50, 0xBA, 0x6C,
+    0x02, 0xF3, 0xF1, 0x51, 0x17, 0xED, 0x0C, 0x87, 0x16, 0x11, 0x4F, 0xB6, 0x9C, 0x9C, 0x84, 0x35,
+    0xF8, 0xDB, 0xAD, 0xC6, 0x42, 0x36, 0x51, 0xB9, 0x55, 0x26, 0x96, 0xCE, 0x78, 0xC8, 0x7D, 0x4C,
+    0x25, 0xD5, 0x21, 0x6E, 0x0C, 0x35, 0x12, 0x50, 0xA3, 0x9A, 0x12, 0x58, 0x2B, 0xD2, 0x43, 0x25,
+    0x35, 0xB0, 0x9D, 0xD2, 0x63, 0x31, 0xA0, 0x72, 0x40, 0x29, 0xE1, 0x8C, 0xE6, 0xBD, 0xB3, 0xA0,
+    0x84, 0x32, 0xE8, 0x80, 0x99, 0xF2, 0x91, 0x7C, 0x34, 0x03, 0xB9, 0x2F, 0x7B, 0x72, 0x5F, 0xB9,
+    0x28, 0x80, 0xCC, 0x60, 0x6B, 0x4C, 0x6F, 0xEB, 0x88, 0xAF, 0x5B, 0x67, 0xA1, 0x69, 0x2D, 0x48,
+    0x6B, 0xEB, 0x4C, 0x6A, 0xEB, 0x0A, 0xA1, 0xFC, 0xB8, 0xB3, 0x18, 0x09, 0x07, 0x64, 0xD2, 0x5F,
+    0x81, 0x47, 0x57, 0x7B, 0xFC, 0x11, 0xA0, 0xAA, 0x03, 0x60, 0x9F, 0x8A, 0xE3, 0x9C, 0x80, 0x87,
+    0x78, 0xE4, 0x81, 0x1E, 0x4E, 0xA4, 0x74, 0x74, 0x43, 0x4D, 0x34, 0x11, 0xE6, 0x1D, 0xA1, 0x6F,
+    0xDC, 0x00, 0x08, 0x37, 0x80, 0x2C, 0xD8, 0x2D, 0x9D, 0x0B, 0x1F, 0xE3, 0x5C, 0x16, 0xA8, 0xDA,
+    0x68, 0x58, 0x45, 0x5D, 0x5D, 0xB5, 0x49, 0x13, 0xE9, 0xF9, 0xE8, 0x9A, 0x4B, 0x54, 0x36, 0x22,
+    0xE2, 0xA8, 0xDE, 0x3F, 0xB9, 0xE5, 0xA2, 0xF0, 0x4F, 0x44, 0x9E, 0xA1, 0x18, 0xB2, 0x00, 0xC5,
+    0x10, 0x43, 0xC0, 0x91, 0xC6, 0x65, 0x0F, 0xB9, 0xB7, 0x29, 0x8A, 0xF6, 0x08, 0x35, 0x04, 0x3D,
+    0x10, 0x1D, 0x9E, 0x29, 0xEF, 0xE1, 0x11, 0x75, 0xDE, 0xD5, 0xFD, 0xBB, 0x25, 0x31, 0x26, 0x45,
+    0xB5, 0x23, 0xB4, 0x0C, 0xD0, 0xAC, 0x2F, 0xE6, 0x98, 0x87, 0x8A, 0x0E, 0x31, 0xA5, 0x98, 0xDC,
+    0x27, 0xE9, 0x61, 0x86, 0x6E, 0x15, 0x1F, 0xCB, 0x1A, 0x70, 0x9F, 0x57, 0x41, 0xB2, 0xC6, 0xA8,
+    0x57, 0xDC, 0x60, 0xCC, 0xE6, 0xA3, 0x23, 0xC0, 0x78, 0x9D, 0xEC, 0x61, 0x97, 0x5E, 0xD8, 0x36,
+    0xBF, 0x73, 0x74, 0x04, 0xC8, 0xD1, 0x73, 0x3E, 0x6E, 0x92, 0xB8, 0x97, 0xD0, 0xEB, 0x8B, 0xE2,
+    0xEE, 0xC9, 0xAD, 0x1E, 0xB6, 0xC6, 0xEC, 0x16, 0xC7, 0x86, 0x2E, 0x69, 0x14, 0xB5, 0x26, 0x3A,
+    0xE8, 0xB0, 0x66, 0x3C, 0x78, 0x68, 0x44, 0x46, 0x4C, 0xCC, 0xA4, 0xF0, 0x31, 0x71, 0x37, 0x22,
+    0xD1, 0x8F, 0xC1, 0x85, 0x43, 0x94, 0xF8, 0x2B, 0x95, 0xD4, 0x99, 0x48, 0xD9, 0x88, 0xCF, 0xE4,
+    0x5F, 0x7C, 0x20, 0x7F, 0xB4, 0x28, 0xC1, 0x0A, 0x95, 0x13, 0x72, 0x89, 0x93, 0x95, 0x3A, 0x0B,
+    0xB6, 0xC5, 0x3A, 0xE6, 0xB2, 0xC7, 0xF4, 0x4A, 0x0A, 0x4F, 0xFE, 0xF1, 0x35, 0xD1, 0x53, 0xCC,
+    0x00, 0x9D, 0x21, 0x25, 0x39, 0xD8, 0x3F, 0x04, 0xE3, 0xA8, 0x62, 0x3A, 0xB6, 0x19, 0x81, 0x40,
+    0xB1, 0x00, 0xB6, 0xCE, 0xC5, 0x81, 0xF1, 0x85, 0x4C, 0xFC, 0x8A, 0x5A, 0x9E, 0xFF, 0x73, 0x79,
+    0xAF, 0xAB, 0xAD, 0xBC, 0xFD, 0x81, 0x48, 0xAF, 0xA5, 0x1D, 0x1B, 0xB9, 0xC9, 0x05, 0xE0, 0xEA,
+    0xD6, 0xD7, 0x2F, 0x6B, 0xE3, 0xC8, 0x7D, 0x31, 0x80, 0xC8, 0x9A, 0x12, 0x77, 0x8F, 0x6C, 0x29,
+    0x44, 0x16, 0xB4, 0x88, 0xB4, 0x4A, 0x44, 0xFA, 0x07, 0xEA, 0xD8, 0x3D, 0x64, 0xD1, 0xEE, 0xAE,
+    0xDC, 0x39, 0x3A, 0x42, 0xA5, 0x14, 0x52, 0xE9, 0xB1, 0x2F, 0x1D, 0x1D, 0x7E, 0x6A, 0x76, 0xCE,
+    0x6A, 0x67, 0xEC, 0xB2, 0x51, 0x37, 0x89, 0x5B, 0xA6, 0x98, 0x3F, 0x9F, 0x9C, 0x1C, 0xED, 0xD5,
+    0x18, 0x8D, 0x17, 0x5B, 0x6F, 0xA2, 0xC4, 0x8C, 0x76, 0xE0, 0xD6, 0xA9, 0xBE, 0x70, 0x98, 0xF2,
+    0x36, 0x1B, 0x09, 0xE4, 0xF3, 0xF3, 0x23, 0x4D, 0x6B, 0x06, 0x3D, 0x51, 0xB5, 0xA5, 0x63, 0x66,
+    0x8E, 0x66, 0x4F, 0xD7, 0x56, 0x7F, 0xD6, 0x4D, 0x48, 0x84, 0x40, 0x6F, 0x62, 0x7E, 0xB0, 0x5A,
+    0x3D, 0x61, 0x1B, 0xB7, 0x1B, 0x22, 0x43, 0xFC, 0x16, 0xF6, 0xE3, 0x6B, 0x2E, 0xA6, 0xCF, 0x55,
+    0x32, 0x44, 0xAF, 0x37, 0x3D, 0x2E, 0xCA, 0x12, 0xF3, 0x67, 0xDA, 0xB4, 0x65, 0x0F, 0xEA, 0x98,
+    0x4F, 0x49, 0x84, 0x23, 0x96, 0x3D, 0x81, 0x31, 0xEE, 0x9C, 0x9E, 0xC8, 0xF2, 0xCB, 0x6A, 0x94,
+    0x5F, 0x38, 0xB9, 0xD5, 0x73, 0x4D, 0x44, 0xA8, 0x44, 0x24, 0x68, 0xB9, 0x7B, 0xF4, 0xBC, 0xB7,
+    0x23, 0xD8, 0xAF, 0x2F, 0xA0, 0x82, 0xF1, 0x60, 0x7C, 0x53, 0x43, 0xF7, 0x54, 0x20, 0x06, 0x6B,
+    0xB1, 0xAE, 0xEC, 0xC9, 0x67, 0x6C, 0x4F, 0xD7, 0xD3, 0xDD, 0xED, 0x66, 0xE8, 0x44, 0x5A, 0x68,
+    0x64, 0xD8, 0x5A, 0xEF, 0xEA, 0x2A, 0x94, 0x32, 0x52, 0x89, 0xB4, 0xC5, 0x7B, 0xCF, 0x4F, 0xAA,
+    0x46, 0xD2, 0x30, 0xF4, 0x94, 0xC8, 0x5C, 0xB5, 0xA8, 0xE7, 0x07, 0xD5, 0xC9, 0xA4, 0x45, 0xE6,
+    0x5C, 0x5E, 0x6A, 0xF4, 0x4C, 0xF5, 0x46, 0xC0, 0xF4, 0x33, 0x85, 0xB7, 0xE4, 0xA3, 0xE9, 0xF3,
+    0x29, 0x5B, 0x9E, 0x0B, 0x58, 0x99, 0xD0, 0x32, 0x6E, 0x71, 0x8B, 0xFA, 0xA1, 0xAD, 0xEC, 0x9C,
+    0x63, 0xFA, 0xAE, 0x69, 0x41, 0xF1, 0xD0, 0x83, 0xA0, 0xA1, 0x4E, 0x6E, 0x82, 0x48, 0xF4, 0x91,
+    0xC5, 0x63, 0x6E, 0xD2, 0x0C, 0x00, 0x76, 0x8F, 0x2A, 0xDD, 0xCE, 0x03, 0x8C, 0xA6, 0x5D, 0x84,
+    0x58, 0xEC, 0x1A, 0x18, 0x51, 0x2F, 0xBC, 0x36, 0xF2, 0xB8, 0x88, 0xB8, 0x98, 0x72, 0x24, 0xCB,
+    0x4B, 0xCF, 0x06, 0x33, 0x83, 0x19, 0xBA, 0x16, 0x1A, 0x1D, 0x40, 0x87, 0xB2, 0x87, 0xAA, 0x6F,
+    0x80, 0x45, 0x05, 0x30, 0x3E, 0x1F, 0x51, 0x52, 0x9B, 0x91, 0x6A, 0xA4, 0x5A, 0x6E, 0x49, 0x4D,
+    0x25, 0x32, 0xAC, 0x69, 0x2B, 0x09, 0xF4, 0x3C, 0x54, 0x71, 0x32, 0x7A, 0x2C, 0x5D, 0xD4, 0x02,
+    0xB5, 0xBA, 0x07, 0x20, 0x6C, 0xA4, 0xA7, 0x12, 0x69, 0xB3, 0x3B, 0xCF, 0x2E, 0x3C, 0x1A, 0xB3,
+    0x30, 0x6C, 0x9D, 0xA8, 0x59, 0xB5, 0xD1, 0x18, 0xB8, 0xD0, 0xB4, 0xAA, 0x93, 0xC8, 0x5E, 0xCD,
+    0x9D, 0x67, 0xBD, 0x19, 0xE9, 0xB2, 0x80, 0xE9, 0x6D, 0x9D, 0x05, 0xED, 0x69, 0x6A, 0x5B, 0x97,
+    0x43, 0xB6, 0x3C, 0x17, 0xA2, 0x73, 0x6F, 0xA5, 0x8E, 0x32, 0x99, 0x7D, 0xBD, 0x63, 0x93, 0xA3,
+    0x1C, 0x2D, 0x67, 0x80, 0x03, 0x35, 0xAE, 0x9F, 0xA9, 0xF9, 0xCC, 0xC7, 0xFF, 0x2F, 0x61, 0x38,
+    0x1E, 0x51, 0x49, 0x85, 0x0C, 0xD1, 0x94, 0xA3, 0x6A, 0x93, 0xC2, 0x38, 0x4B, 0x60, 0xF0, 0xF9,
+    0x05, 0xFD, 0xFF, 0x10, 0x0C, 0x87, 0xE2, 0x51, 0xD0, 0xBE, 0x6C, 0xC9, 0x82, 0x19, 0xE0, 0x7A,
+    0xCC, 0xD5, 0x39, 0x67, 0xC3, 0x3C, 0x2E, 0x13, 0x91, 0xEF, 0x73, 0x91, 0x05, 0x6E, 0xC6, 0x24,
+    0xAC, 0x7C, 0xDA, 0x26, 0x02, 0xDD, 0xE3, 0x6B, 0xC5, 0x4A, 0x90, 0x19, 0x1E, 0x7B, 0x6E, 0x86,
+    0x4A, 0xA6, 0xA4, 0x24, 0xD4, 0x97, 0xBA, 0x76, 0x2B, 0xD9, 0x6C, 0x7B, 0x1E, 0xF5, 0xBE, 0xC7,
+    0x69, 0x33, 0xFE, 0x62, 0x4D, 0x39, 0x29, 0x39, 0xE9, 0x42, 0x4C, 0x7D, 0x2A, 0x44, 0x06, 0x50,
+    0x47, 0x10, 0x45, 0x45, 0x36, 0x1A, 0x47, 0x74, 0x2C, 0xA6, 0xF3, 0xB2, 0xE3, 0xC2, 0x21, 0xAA,
+    0x13, 0x87, 0xC8, 0x4C, 0xF5, 0x52, 0xE7, 0x92, 0x18, 0x9D, 0xF7, 0x0A, 0xB9, 0xCA, 0x9E, 0x27,
+    0xBA, 0x1E, 0x23, 0x35, 0x79, 0x4C, 0x34, 0xAB, 0xD3, 0x68, 0xC2, 0xF6, 0x53, 0x35, 0x66, 0xB0,
+    0x2F, 0x5D, 0xF3, 0x46, 0xC4, 0xAB, 0x4E, 0xFA, 0x54, 0x50, 0x62, 0x44, 0xA4, 0xCE, 0x45, 0xC4,
+    0x65, 0x49, 0x6D, 0x9B, 0x5D, 0x2D, 0xD1, 0xA7, 0x3E, 0x0D, 0xEB, 0x53, 0x21, 0x37, 0x41, 0x8B,
+    0xD4, 0x70, 0xD2, 0x8D, 0x5B, 0xEB, 0xBB, 0xDC, 0xC6, 0xE2, 0xF6, 0x6A, 0x33, 0xCA, 0x7E, 0xBD,
+    0x71, 0x3E, 0x65, 0x37, 0x29, 0x02, 0xDD, 0xFF, 0x7E, 0x2B, 0xC4, 0x74, 0x8D, 0x94, 0x6B, 0x75,
+    0xB4, 0x5F, 0xAB, 0x25, 0xB1, 0xAA, 0xEA, 0xE1, 0x93, 0xD7, 0xC2, 0xAA, 0x3B, 0xCA, 0x3E, 0x45,
+    0x44, 0xD4, 0xBC, 0x55, 0x51, 0xFD, 0x7A, 0xFF, 0x79, 0xF5, 0xB6, 0x72, 0xE9, 0xA1, 0x90, 0x09,
+    0xC8, 0x97, 0xF3, 0x6A, 0xB9, 0xDA, 0x26, 0x25, 0x95, 0x0F, 0x48, 0x4F, 0x6A, 0x00, 0xB5, 0xF0,
+    0x3F, 0x53, 0x04, 0x9A, 0xBB, 0xE2, 0x63, 0xF1, 0xD9, 0xC3, 0xF2, 0x6E, 0x2C, 0xC0, 0x39, 0x3A,
+    0x5C, 0x73, 0xF8, 0xB0, 0x32, 0x03, 0x17, 0x8E, 0x8E, 0xEE, 0xD9, 0x43, 0x31, 0x41, 0xB6, 0x01,
+    0xBD, 0x50, 0x39, 0x32, 0xA9, 0xCD, 0x80, 0x92, 0x5E, 0x8F, 0x20, 0x9E, 0x00, 0x4B, 0xA0, 0x81,
+    0xCD, 0x86, 0xCA, 0xD1, 0xD8, 0xDA, 0x0C, 0x58, 0xE3, 0xF4, 0x88, 0xFD, 0x82, 0x57, 0x81, 0xEA,
+    0xEB, 0x81, 0x86, 0xD2, 0x2D, 0x54, 0xAD, 0x71, 0xB6, 0x36, 0x83, 0xE9, 0x8D, 0xD3, 0x63, 0x31,
+    0xE4, 0x5E, 0x85, 0xC2, 0x67, 0x13, 0x5D, 0xEE, 0x99, 0xA9, 0x5E, 0x1C, 0xB1, 0xB5, 0x79, 0x7B,
+    0xA2, 0x74, 0xFA, 0xAF, 0x26, 0x0A, 0xAF, 0xE6, 0x40, 0x36, 0xB1, 0x09, 0x30, 0x63, 0x67, 0xB0,
+    0x98, 0x05, 0x4A, 0xA7, 0x05, 0x0A, 0xAF, 0x04, 0xF4, 0x94, 0xA2, 0x54, 0xA0, 0x8E, 0x8E, 0x6A,
+    0x4A, 0x11, 0x68, 0x64, 0x82, 0xA3, 0xA3, 0xFA, 0x1C, 0xD4, 0x62, 0xBF, 0x76, 0x7F, 0x28, 0x51,
+    0xFB, 0xA8, 0x14, 0x8C, 0xEB, 0x62, 0x3E, 0x8E, 0x0A, 0xA6, 0xA7, 0x18, 0x6C, 0xF4, 0x19, 0x54,
+    0x28, 0x86, 0x68, 0x26, 0x37, 0xED, 0x8C, 0x5E, 0xF4, 0x48, 0x35, 0x1A, 0xAF, 0x3F, 0x74, 0xD5,
+    0x7B, 0x9D, 0xC5, 0xCA, 0x30, 0x61, 0xE7, 0xBC, 0xDF, 0xDA, 0x29, 0x8F, 0x50, 0x6F, 0x25, 0x7C,
+    0xE9, 0xBA, 0x9D, 0xCC, 0x7A, 0xE4, 0xC1, 0xF2, 0xC9, 0x38, 0xB0, 0x6D, 0xEE, 0xC1, 0x0E, 0x59,
+    0x80, 0x6A, 0x64, 0x21, 0x56, 0x81, 0x62, 0x04, 0xE3, 0x30, 0x1F, 0xBA, 0xDC, 0x53, 0x7C, 0x30,
+    0x64, 0x81, 0xFC, 0xA3, 0x91, 0x05, 0xED, 0x03, 0xB6, 0xD6, 0x63, 0x43, 0xE9, 0xB2, 0xA9, 0x72,
+    0xB9, 0x57, 0xC1, 0x0C, 0xD9, 0x44, 0xD0, 0x23, 0x0B, 0x33, 0x01, 0x5B, 0x6F, 0x68, 0x28, 0x5D,
+    0x47, 0xD5, 0x16, 0xBE, 0xC1, 0xF4, 0xD9, 0x64, 0x6B, 0x3D, 0x32, 0xDB, 0x56, 0x05, 0x6C, 0xD5,
+    0xD2, 0x51, 0xBE, 0xE3, 0xA8, 0xDA, 0xE2, 0x43, 0x87, 0xE9, 0x75, 0x84, 0xE4, 0x65, 0x40, 0x05,
+    0xAC, 0x87, 0x8E, 0xD2, 0x83, 0x6D, 0x8B, 0x31, 0xB1, 0x63, 0xAD, 0x92, 0x9F, 0x63, 0x9F, 0x0A,
+    0xD1, 0x0D, 0xB9, 0x5F, 0xE6, 0xEA, 0x31, 0xA6, 0xAA, 0xEC, 0xC7, 0x71, 0xF7, 0xA8, 0x49, 0x28,
+    0x7C, 0x4C, 0x08, 0x3B, 0x4F, 0xFC, 0x14, 0x04, 0x9E, 0xC8, 0x27, 0xD3, 0x63, 0x07, 0x5B, 0x67,
+    0x52, 0x0B, 0x07, 0x21, 0x5B, 0x9E, 0xFB, 0xC8, 0x6B, 0x59, 0x4C, 0xAB, 0xA5, 0xBF, 0x1E, 0x11,
+    0xE3, 0xA4, 0xCE, 0xA3, 0x70, 0x89, 0xDF, 0x4F, 0xD6, 0xC9, 0xA7, 0xE9, 0x80, 0x42, 0xDE, 0x8D,
+    0x02, 0x7B, 0xF5, 0x75, 0xCB, 0x09, 0xEB, 0x69, 0x1C, 0xC5, 0x84, 0x80, 0x0E, 0x59, 0x00, 0x35,
+    0xEB, 0x09, 0x58, 0x62, 0x49, 0x9C, 0x19, 0x80, 0xAE, 0x74, 0x40, 0x57, 0x39, 0xA0, 0xB3, 0x2D,
+    0x20, 0xB6, 0x05, 0x16, 0x5B, 0xAF, 0xCF, 0x6A, 0x6E, 0x6A, 0xC8, 0x42, 0x53, 0xAF, 0x9E, 0x4E,
+    0x3E, 0xD9, 0x16, 0x8C, 0xB7, 0x0E, 0xCA, 0xA1, 0xEA, 0xA1, 0x71, 0xC6, 0xA3, 0xA4, 0x2E, 0x66,
+    0x8A, 0x05, 0x2D, 0xEF, 0xCB, 0x44, 0xB4, 0x9D, 0x79, 0x3C, 0x7A, 0x4F, 0x8F, 0x6D, 0xA7, 0x55,
+    0xF4, 0x9F, 0x41, 0xE1, 0x0B, 0x75, 0xB2, 0x81, 0x3B, 0x09, 0x14, 0xCB, 0x73, 0x81, 0xA6, 0xCD,
+    0x27, 0x3D, 0x51, 0xF8, 0xCA, 0x61, 0xDC, 0x0C, 0xF6, 0x0B, 0x1E, 0xE6, 0xAA, 0x8D, 0x75, 0x4D,
+    0xE6, 0xCD, 0x11, 0x1A, 0xE3, 0xA2, 0xCB, 0x6A, 0x86, 0x00, 0x36, 0xC6, 0xDA, 0x3D, 0xA5, 0x2B,
+    0x87, 0x6C, 0xC1, 0xDE, 0xE9, 0x06, 0xEC, 0x36, 0x12, 0xA1, 0xEA, 0x5F, 0x32, 0xDD, 0xC4, 0x8A,
+    0x88, 0xC4, 0xE7, 0x25, 0x3D, 0x47, 0xBA, 0x01, 0x59, 0x68, 0xF8, 0xC5, 0xE9, 0xF6, 0x18, 0x50,
+    0xC8, 0x10, 0x8B, 0x4E, 0xAB, 0x3B, 0xD7, 0xBC, 0x5A, 0x30, 0x83, 0x19, 0xE2, 0x06, 0xB4, 0xCF,
+    0x8C, 0x31, 0x2D, 0x43, 0x8F, 0xDD, 0xC9, 0xC9, 0xAD, 0xB7, 0x45, 0x44, 0x8C, 0x88, 0x04, 0x5B,
+    0x47, 0xC4, 0xC4, 0xBE, 0xE8, 0x21, 0xF1, 0x69, 0x4B, 0x43, 0xD3, 0xE6, 0x13, 0xDD, 0x7F, 0x90,
+    0x16, 0x91, 0xE9, 0x9C, 0x1B, 0x12, 0xAD, 0xE2, 0xA2, 0xB7, 0x80, 0xE9, 0x77, 0x8E, 0xFF, 0xFD,
+    0x66, 0xF1, 0x7F, 0x29, 0xA4, 0xDB, 0x6D, 0x6A, 0x15, 0x20, 0xE4, 0x9F, 0xC5, 0x72, 0xF3, 0xCA,
+    0x72, 0x7A, 0xD2, 0x53, 0x04, 0x10, 0x4C, 0xBF, 0x63, 0xB9, 0xF7, 0x4F, 0x5E, 0x1B, 0x45, 0x44,
+    0xDE, 0x14, 0x11, 0x31, 0xFD, 0xFD, 0x2C, 0x37, 0x50, 0xBA, 0x72, 0x50, 0x0B, 0xD5, 0x83, 0x58,
+    0xEE, 0x51, 0xEA, 0x95, 0xB4, 0x8B, 0x1E, 0x57, 0xCA, 0x3E, 0x72, 0xDE, 0x1E, 0x56, 0x9D, 0x0C,
+    0x69, 0x1E, 0xB9, 0x74, 0xD2, 0xF2, 0xDF, 0xA6, 0x14, 0xE1, 0x98, 0x34, 0x1D, 0xD3, 0xA1, 0x77,
+    0x45, 0x91, 0x6A, 0x97, 0x23, 0xA9, 0x02, 0xEA, 0xE8, 0xE8, 0x9A, 0xA3, 0x13, 0x09, 0x18, 0x11,
+    0x69, 0x39, 0x39, 0x79, 0x6D, 0x97, 0x39, 0x17, 0x43, 0x29, 0xCB, 0x4E, 0xD1, 0xDF, 0x93, 0x91,
+    0x9D, 0x07, 0x1E, 0x21, 0x93, 0x3A, 0x5F, 0x6E, 0x49, 0x4F, 0x23, 0xE2, 0xC9, 0x92, 0x7E, 0xDF,
+    0x8E, 0xFF, 0x4C, 0x7B, 0x16, 0x3D, 0x72, 0xAA, 0xFD, 0xB9, 0x91, 0x5F, 0xA8, 0xC9, 0x63, 0xC1,
+    0xB8, 0x2B, 0xDE, 0xEB, 0x86, 0x5D, 0xA2, 0x74, 0x96, 0x80, 0x46, 0x15, 0xB2, 0x93, 0xD7, 0x82,
+    0x16, 0x09, 0x5A, 0x64, 0xAF, 0xE0, 0x38, 0x4F, 0x05, 0xC7, 0xA5, 0xAB, 0x69, 0xDA, 0x3B, 0xCF,
+    0x2D, 0x88, 0x4C, 0x74, 0xD2, 0x27, 0x5F, 0x35, 0xEA, 0xEA, 0x18, 0x3E, 0x53, 0x11, 0xF3, 0x78,
+    0xEC, 0xE8, 0xF0, 0x7E, 0x0D, 0x93, 0x50, 0xA5, 0x91, 0x0D, 0x31, 0xF5, 0x93, 0x2C, 0xE2, 0xFD,
+    0x0B, 0xCC, 0x2B, 0x16, 0xD2, 0xD4, 0x29, 0x0F, 0x8E, 0x58, 0xF0, 0x6D, 0xDB, 0xFD, 0x0C, 0xCC,
+    0x88, 0x80, 0x3F, 0x1D, 0x13, 0x7F, 0x02, 0xA0, 0xA6, 0x68, 0x10, 0x5B, 0x00, 0xF3, 0x61, 0x0D,
+    0x64, 0x09, 0x9F, 0x74, 0x3B, 0xF7, 0x2E, 0x2E, 0x4C, 0x8C, 0xCD, 0x46, 0x73, 0xB4, 0x08, 0x40,
+    0xD1, 0xC5, 0x04, 0xF3, 0x08, 0x30, 0x8C, 0x3B, 0x4B, 0x7D, 0x3B, 0x29, 0x23, 0x12, 0x8B, 0x4D,
+    0x80, 0x0B, 0x47, 0x57, 0xEF, 0x9B, 0x53, 0x0C, 0x18, 0xEB, 0x11, 0xD3, 0x53, 0x78, 0x8A, 0x21,
+    0x25, 0xF6, 0x55, 0x8E, 0xDC, 0x63, 0x6B, 0xB4, 0x67, 0x03, 0xD1, 0xF3, 0xD0, 0x3E, 0x52, 0x34,
+    0xF7, 0x44, 0x4E, 0x44, 0x4D, 0xA5, 0x03, 0x35, 0xD9, 0x1A, 0x88, 0x95, 0xD2, 0x21, 0xE6, 0x1D,
+    0x47, 0x94, 0x62, 0x04, 0xE8, 0xFC, 0x6E, 0x3A, 0xD1, 0xED, 0x69, 0x76, 0x70, 0x77, 0x64, 0xAE,
+    0x68, 0x0F, 0xA6, 0x1C, 0xBF, 0x1E, 0xF8, 0xD3, 0x98, 0x17, 0x1B, 0x4B, 0x7A, 0xD7, 0x9C, 0x8A,
+    0xFA, 0xA1, 0xAD, 0xC2, 0x8A, 0xEE, 0x74, 0x82, 0x22, 0x1F, 0xEC, 0x4F, 0x47, 0x0B, 0x77, 0x13,
+    0xC3, 0xB4, 0x75, 0x31, 0x80, 0x6D, 0x55, 0x2C, 0x68, 0x8B, 0xF5, 0x80, 0x71, 0xCA, 0xD9, 0x44,
+    0x3E, 0x42, 0x13, 0x8B, 0x65, 0xFA, 0x54, 0xC7, 0xB4, 0x00, 0x0D, 0xB1, 0x5C, 0xCE, 0xD6, 0xC4,
+    0x2C, 0x2B, 0xD8, 0xC4, 0xCC, 0xF5, 0x3F, 0x18, 0x00, 0xFD, 0x51, 0xE4, 0xF5, 0x71, 0x97, 0x41,
+    0x9B, 0xDF, 0x13, 0x3C, 0x4C, 0xE6, 0xF6, 0x3A, 0xED, 0xCE, 0x01, 0x7F, 0x2A, 0x0E, 0xA8, 0xC4,
+    0x91, 0xF2, 0xF4, 0x12, 0xE4, 0xF4, 0xB7, 0x12, 0x8C, 0xFF, 0x25, 0x2E, 0x1F, 0x0F, 0xDF, 0x7C,
+    0x21, 0xD6, 0x6E, 0xD6, 0xA0, 0xD3, 0x73, 0x55, 0x43, 0xE6, 0xCB, 0x1A, 0x32, 0x6F, 0x1E, 0x68,
+    0xE0, 0xD9, 0xE4, 0x80, 0x43, 0xD9, 0x67, 0xD3, 0xB6, 0x90, 0xD3, 0x63, 0x1C, 0x3A, 0x16, 0xD2,
+    0x07, 0xD8, 0xA0, 0xE6, 0x35, 0x78, 0xAF, 0x47, 0x1A, 0x60, 0x49, 0x05, 0x15, 0x55, 0xB4, 0x6C,
+    0x7A, 0x60, 0x2E, 0x3C, 0x29, 0x1B, 0x9B, 0xFC, 0x2F, 0xA6, 0xDD, 0x4C, 0x23, 0x38, 0x5D, 0xC8,
+    0x5E, 0x90, 0x20, 0x22, 0x2A, 0x31, 0xE2, 0x1E, 0x4B, 0x41, 0xCA, 0x01, 0x52, 0xCE, 0xFF, 0x25,
+    0xF1, 0x40, 0x21, 0x9E, 0x14, 0xDD, 0xDA, 0xE1, 0x13, 0xF0, 0xF0, 0xCB, 0xFB, 0xF3, 0xAC, 0x5A,
+    0xD0, 0x63, 0xD5, 0xAE, 0xF3, 0x54, 0x9F, 0x32, 0x4F, 0xED, 0x89, 0x29, 0xEE, 0xD8, 0x7A, 0x97,
+    0xC9, 0x6D, 0xFA, 0x35, 0xB9, 0xA0, 0x89, 0x15, 0x71, 0x2E, 0x9B, 0xD6, 0xF5, 0x8C, 0x35, 0xF6,
+    0xB1, 0x84, 0x21, 0x6A, 0xDD, 0xB4, 0xA0, 0xDC, 0x88, 0x05, 0x1B, 0xDF, 0xF0, 0x80, 0x8E, 0x89,
+    0xDE, 0x71, 0x9E, 0xD5, 0xFD, 0xF3, 0x8C, 0x4B, 0x5A, 0xEE, 0x09, 0x9B, 0xFC, 0xBE, 0x70, 0x78,
+    0x36, 0x03, 0xD9, 0x87, 0x33, 0xDB, 0x45, 0x2D, 0xA7, 0x7D, 0x38, 0xC6, 0xB8, 0x1B, 0x29, 0xD4,
+    0xA9, 0xA6, 0x18, 0x19, 0xBA, 0x3F, 0x00, 0x33, 0x26, 0x20, 0xCC, 0xB8, 0x86, 0xA8, 0xF6, 0xA2,
+    0x23, 0xBE, 0xC4, 0x0A, 0xBA, 0xBD, 0x2B, 0xED, 0xF6, 0xCA, 0x04, 0xB6, 0x16, 0x30, 0xAE, 0xEA,
+    0xC9, 0xBD, 0x5E, 0x78, 0x7C, 0xA2, 0x5B, 0x01, 0xCF, 0x9A, 0xC7, 0x97, 0x6B, 0xE7, 0x53, 0xC2,
+    0x7E, 0xE6, 0xAE, 0x29, 0x8A, 0x87, 0x62, 0x58, 0xC7, 0xB8, 0x26, 0x6A, 0xEC, 0xFB, 0x8C, 0xDE,
+    0x62, 0x20, 0xF7, 0x73, 0xDC, 0xF3, 0x29, 0x20, 0xEA, 0x28, 0xDF, 0x9C, 0xA2, 0xB5, 0xD0, 0xBC,
+    0x38, 0x62, 0x46, 0x5B, 0x6B, 0xD1, 0x41, 0x89, 0xAF, 0x44, 0x36, 0x88, 0x7C, 0xB3, 0xCF, 0xE4,
+    0xE6, 0x9C, 0x7E, 0x23, 0x0B, 0xC9, 0x83, 0x3C, 0x1F, 0xF6, 0xEC, 0x7E, 0xB1, 0xBE, 0x20, 0x9F,
+    0x5D, 0xB2, 0xB3, 0xAB, 0xD6, 0xE9, 0x1F, 0xE0, 0xC8, 0x2E, 0x80, 0x9D, 0xD7, 0x20, 0xF1, 0x5E,
+    0x5D, 0xC8, 0xF6, 0x2E, 0xF7, 0xDC, 0x6A, 0x3F, 0x03, 0x3C, 0x20, 0x32, 0x7D, 0x6A, 0x37, 0x90,
+    0x07, 0xC5, 0xF4, 0xDA, 0xB8, 0x8B, 0xB6, 0x31, 0xBD, 0x31, 0x2A, 0x29, 0xD9, 0xFB, 0x8E, 0x79,
+    0xC0, 0x77, 0x56, 0xB4, 0x26, 0xE1, 0x35, 0x24, 0x76, 0xD8, 0x62, 0x36, 0x7C, 0x4A, 0xE4, 0x69,
+    0x5B, 0x58, 0xD4, 0xA6, 0x09, 0x64, 0x09, 0xAC, 0x5E, 0x52, 0xDE, 0x7E, 0xF4, 0xE3, 0x4D, 0xEC,
+    0x06, 0x13, 0x2B, 0x27, 0x87, 0x75, 0xFE, 0xF7, 0x7C, 0xE6, 0x07, 0x35, 0x54, 0x6D, 0x2E, 0xD2,
+    0x62, 0x86, 0x4C, 0x64, 0x46, 0x8F, 0xC8, 0x89, 0x38, 0x15, 0xB0, 0x75, 0x31, 0xC5, 0xDC, 0x99,
+    0xE8, 0x17, 0x62, 0x7A, 0xD3, 0x67, 0x13, 0x7A, 0x8C, 0xB8, 0xDC, 0xAC, 0x42, 0x4C, 0xA1, 0xE9,
+    0x28, 0x1D, 0x95, 0x8B, 0x9F, 0x19, 0x4C, 0xAF, 0x27, 0x8C, 0xD7, 0x9E, 0x99, 0x72, 0x52, 0x21,
+    0xC2, 0xF7, 0x1D, 0xA5, 0xC8, 0x88, 0x6D, 0x0B, 0x91, 0x9B, 0x09, 0xFF, 0x8E, 0xB6, 0x63, 0xF4,
+    0x7E, 0xF3, 0xD8, 0x72, 0xE3, 0x46, 0x2C, 0x95, 0xA8, 0x1F, 0xAC, 0xE8, 0x98, 0x01, 0xD3, 0x47,
+    0xC5, 0xA8, 0x62, 0x86, 0x77, 0xD5, 0x12, 0xAB, 0x9D, 0xA0, 0x6A, 0x63, 0xA4, 0x4D, 0x47, 0x95,
+    0xD9, 0x9C, 0xBC, 0x4C, 0xEE, 0x0B, 0x11, 0x4F, 0x87, 0x88, 0xB8, 0x62, 0x30, 0x7D, 0xB6, 0x30,
+    0xAB, 0x40, 0xE1, 0x8D, 0x2B, 0x1D, 0x8D, 0x0A, 0x59, 0x20, 0xF7, 0x55, 0x5B, 0x3A, 0x1A, 0x3D,
+    0xAA, 0x80, 0x19, 0x6C, 0x6D, 0x7A, 0x15, 0xB4, 0xA7, 0x7B, 0x49, 0xDA, 0x06, 0x2D, 0x32, 0x14,
+    0x03, 0x85, 0x8C, 0xCC, 0x5B, 0xD4, 0x3F, 0x42, 0x9C, 0x31, 0x14, 0x22, 0xE2, 0x3F, 0xA3, 0xDB,
+    0xD0, 0x3D, 0x50, 0x1A, 0x01, 0x78, 0x58, 0x4E, 0x5E, 0x26, 0x17, 0x99, 0xC8, 0x44, 0xE6, 0x4F,
+    0x4B, 0xD9, 0xFE, 0xD4, 0x76, 0x4B, 0xA9, 0xA2, 0xC6, 0xAD, 0x49, 0xF9, 0x11, 0x20, 0x3E, 0xDB,
+    0x96, 0xE7, 0x19, 0x07, 0xEA, 0xD6, 0xB0, 0xEA, 0xB4, 0x58, 0x60, 0x58, 0x9F, 0xE7, 0x71, 0x23,
+    0xD2, 0xB2, 0x9C, 0xBC, 0x12, 0x77, 0xF0, 0x9A, 0x59, 0xAF, 0xD7, 0x6C, 0xF2, 0xE7, 0x3E, 0x3E,
+    0xA4, 0x14, 0xA9, 0x33, 0x91, 0x31, 0x22, 0x4D, 0xBB, 0xCF, 0x9D, 0xDB, 0xE9, 0x77, 0xDB, 0x58,
+    0x94, 0x62, 0x64, 0xFD, 0xBA, 0x5D, 0x5B, 0x82, 0x9C, 0x41, 0x76, 0xCD, 0x81, 0x9D, 0x40, 0xEF,
+    0xDC, 0xA2, 0xFF, 0x7C, 0x4B, 0x79, 0x7A, 0xE3, 0xC1, 0xFA, 0xC2, 0xAF, 0x11, 0xDD, 0xB5, 0x56,
+    0xA7, 0xBD, 0x37, 0x15, 0xE0, 0xBF, 0xDE, 0x0B, 0xF8, 0xA6, 0xAA, 0xC3, 0x47, 0xF7, 0x4A, 0x79,
+    0xA2, 0xD1, 0x2C, 0xC4, 0x06, 0x39, 0x6B, 0x29, 0xCF, 0xFC, 0x80, 0x52, 0x1E, 0xFD, 0x37, 0x94,
+    0xF2, 0x64, 0x61, 0xAF, 0x94, 0x27, 0x8F, 0xA5, 0x3C, 0xFF, 0x91, 0x85, 0x4C, 0xDA, 0x6D, 0x29,
+    0x4F, 0xB5, 0x4B, 0x4D, 0xB3, 0xDB, 0x52, 0x9E, 0x27, 0xE6, 0x95, 0x47, 0x62, 0xAA, 0x09, 0x87,
+    0xBF, 0x2C, 0xD2, 0xBF, 0xD0, 0x2D, 0x27, 0x31, 0x82, 0x1B, 0xA3, 0x5D, 0x3D, 0xEA, 0x4B, 0xF2,
+    0xDE, 0xE1, 0xDF, 0x8A, 0xF4, 0xD5, 0x96, 0xF4, 0x03, 0x26, 0xA6, 0x73, 0x7A, 0xB0, 0x5B, 0x51,
+    0xF9, 0xB7, 0x26, 0xE4, 0xC3, 0xAF, 0xC9, 0x49, 0x1D, 0x33, 0xD3, 0x63, 0x12, 0xF8, 0x7D, 0x35,
+    0x51, 0x0F, 0x20, 0x64, 0xCD, 0x42, 0x36, 0x61, 0x1D, 0xC6, 0xC1, 0x21, 0x4F, 0x92, 0x7D, 0xEF,
+    0xE4, 0x4C, 0xE4, 0x34, 0xFF, 0x66, 0xFE, 0xE2, 0x1B, 0xAD, 0xE7, 0x32, 0x06, 0xED, 0xF8, 0x59,
+    0x5F, 0x3C, 0x0C, 0xAA, 0x56, 0x83, 0x1A, 0xD4, 0xDD, 0x6F, 0x75, 0xF2, 0x9D, 0xDA, 0xFF, 0xC9,
+    0xE5, 0x87, 0xFF, 0x56, 0x37, 0x48, 0x2F, 0x7E, 0xFB, 0xE1, 0x93, 0x97, 0x3B, 0x79, 0x5B, 0xE4,
+    0xC2, 0xD1, 0xD5, 0xBD, 0x97, 0x56, 0x44, 0x7E, 0x2C, 0x22, 0x73, 0x27, 0x22, 0xEE, 0xE1, 0x93,
+    0xF8, 0x78, 0xA5, 0x93, 0xF8, 0xF8, 0x51, 0xFA, 0x2B, 0xFF, 0xDD, 0x51, 0x7C, 0x5C, 0xFD, 0x3C,
+    0xFF, 0xE0, 0x3A, 0x07, 0x7F, 0x97, 0xFF, 0xAD, 0x7D, 0x8E, 0x44, 0xE4, 0xFB, 0x22, 0x32, 0x1E,
+    0x1D, 0xED, 0x7C, 0xB1, 0x5C, 0x44, 0xFE, 0x42, 0x44, 0xC6, 0xC7, 0x8E, 0x8E, 0xAE, 0xC2, 0x55,
+    0x35, 0xEB, 0xA0, 0xC7, 0xC2, 0x9B, 0xBE, 0x6C, 0x2D, 0x37, 0x38, 0x65, 0xB3, 0xD9, 0x6C, 0x1A,
+    0x6B, 0x6D, 0x75, 0x81, 0xAB, 0xEA, 0x30, 0x1F, 0xAB, 0xDE, 0x3A, 0x61, 0xCE, 0xC7, 0xC2, 0x57,
+    0xAD, 0xAD, 0x83, 0x9A, 0x8A, 0xC1, 0x38, 0xCB, 0x0D, 0x35, 0x66, 0xBE, 0x68, 0x39, 0xCB, 0x3F,
+    0x9A, 0xCA, 0xEF, 0x0C, 0x4D, 0xD5, 0x86, 0x1B, 0xDA, 0x4F, 0xC5, 0x9B, 0xBE, 0xFA, 0xA2, 0xBB,
+    0x5E, 0x31, 0x3E, 0xAA, 0x6A, 0x78, 0x35, 0xB5, 0x14, 0x88, 0x35, 0x67, 0x59, 0x6A, 0x98, 0x70,
+    0x80, 0xC2, 0x5F, 0xA8, 0x44, 0x26, 0x11, 0xF9, 0xD1, 0xB7, 0xFE, 0xED, 0x6B, 0xB5, 0xEE, 0xC1,
+    0x00, 0xC7, 0xE9, 0x43, 0x2D, 0x5C, 0x89, 0x75, 0xC5, 0x45, 0x6A, 0xFB, 0x10, 0xE2, 0x9E, 0x4A,
+    0x9D, 0x0B, 0x74, 0xCA, 0xA7, 0x8C, 0x60, 0x72, 0xB2, 0x96, 0x1F, 0xBE, 0xC9, 0x4E, 0x4C, 0xAA,
+    0x29, 0xED, 0xCA, 0xCC, 0x03, 0x97, 0xA0, 0xFA, 0xE0, 0x83, 0xA0, 0x45, 0xC4, 0xD9, 0x0F, 0x3E,
+    0x98, 0xE0, 0x36, 0xF1, 0x67, 0xD4, 0x1A, 0x2C, 0x8C, 0xB9, 0xBE, 0xEB, 0x2E, 0xBE, 0x0E, 0xE4,
+    0x8E, 0xEC, 0xF0, 0xF8, 0xB1, 0xBA, 0x11, 0x19, 0x0B, 0x11, 0xE1, 0x9F, 0x7C, 0xF1, 0xC2, 0xCB,
+    0x28, 0x9F, 0x44, 0xFC, 0x56, 0x4E, 0x9B, 0x61, 0xF5, 0x50, 0x0E, 0xB5, 0x3C, 0x2D, 0xA3, 0x2C,
+    0x8D, 0xBC, 0x23, 0x3F, 0x95, 0x20, 0x4B, 0x29, 0x6A, 0x01, 0x28, 0x62, 0x99, 0xDD, 0x44, 0x29,
+    0x54, 0xD2, 0x57, 0x32, 0x59, 0x79, 0xD7, 0x2E, 0x34, 0x3D, 0xB7, 0xA1, 0x86, 0x0B, 0xE6, 0x93,
+    0x45, 0xBA, 0xFF, 0x9E, 0x8B, 0x35, 0x87, 0x5D, 0x6D, 0x7E, 0x34, 0xD3, 0x7D, 0x77, 0xD4, 0x8B,
+    0x75, 0x85, 0xFF, 0xFB, 0x5C, 0xE0, 0xA2, 0x0E, 0xCD, 0x0F, 0x43, 0xF3, 0xB5, 0x9B, 0x2F, 0x9C,
+    0x74, 0x22, 0x3F, 0x07, 0x3B, 0x5F, 0xC6, 0x90, 0x39, 0x4E, 0x4E, 0x1A, 0xF9, 0x39, 0xBE, 0x99,
+    0x5E, 0xFC, 0x5A, 0x23, 0x3F, 0x94, 0xF9, 0x9E, 0x27, 0x3C, 0x86, 0x9F, 0xEB, 0xA9, 0x91, 0x1F,
+    0x9E, 0xBC, 0xFA, 0xFB, 0xE4, 0xF0, 0xFB, 0xE4, 0xF0, 0xCF, 0x8F, 0xBE, 0xF0, 0x8B, 0xDD, 0xED,
+    0xFB, 0x27, 0xFF, 0x1A, 0x7A, 0x7E, 0x15, 0x7A, 0x7E, 0xF5, 0xB1, 0xA3, 0x5F, 0x68, 0x6C, 0x7B,
+    0xA6, 0xF9, 0x92, 0x54, 0xA9, 0x96, 0x29, 0xD9, 0x14, 0x9B, 0xE7, 0x5D, 0x14, 0xF8, 0x65, 0x7B,
+    0x3D, 0x4A, 0xFA, 0xCC, 0xEB, 0x3E, 0x5E, 0x3B, 0xE0, 0x20, 0x69, 0x80, 0x3E, 0xEF, 0xA3, 0xBA,
+    0x3A, 0xE5, 0x7A, 0xB4, 0x0E, 0x8C, 0x2B, 0x9C, 0x4D, 0x68, 0x41, 0x4C, 0xF6, 0xC2, 0xB4, 0xE6,
+    0xEB, 0xE3, 0x63, 0x70, 0xA1, 0x9E, 0xD4, 0x78, 0xA3, 0x5C, 0x30, 0x62, 0x9C, 0x35, 0x6F, 0xC9,
+    0xA4, 0x25, 0x9C, 0x99, 0xEF, 0xFB, 0xB9, 0x74, 0x8B, 0xF9, 0xA1, 0x4C, 0xD7, 0xAB, 0xFA, 0xB4,
+    0x6C, 0xAF, 0x57, 0x8B, 0x79, 0xD1, 0xE7, 0x6F, 0x7B, 0x3D, 0xBC, 0xA0, 0xFD, 0x75, 0xAE, 0x1F,
+    0x70, 0x00, 0xA7, 0x85, 0x2B, 0xDE, 0xEA, 0xF3, 0x9E, 0xB2, 0x0E, 0x9C, 0x9E, 0x72, 0x1D, 0x3D,
+    0x98, 0xD6, 0x7C, 0xD7, 0x15, 0x8E, 0xC0, 0xC4, 0x14, 0x08, 0x54, 0x98, 0xB6, 0xFC, 0xA2, 0x33,
+    0x6D, 0xDE, 0x33, 0x69, 0x1F, 0x32, 0xCF, 0x84, 0x69, 0xAF, 0x1B, 0x77, 0x80, 0x85, 0xB9, 0x74,
+    0x9B, 0xD2, 0x15, 0x3D, 0xB9, 0x78, 0x2D, 0xA3, 0x9A, 0xA0, 0x0A, 0x49, 0xBB, 0xF2, 0xE8, 0xBE,
+    0xCB, 0x79, 0x0F, 0x59, 0xCE, 0x51, 0x66, 0x9F, 0x38, 0xFB, 0xF4, 0x39, 0x47, 0xA2, 0x7D, 0x2A,
+    0x9D, 0x23, 0xD4, 0x3E, 0xAD, 0xCE, 0x91, 0x6B, 0x9F, 0x62, 0xE7, 0x88, 0xB6, 0x4F, 0x37, 0x0A,
+    0xF9, 0xE2, 0x96, 0x74, 0xFB, 0xD4, 0xEB, 0x37, 0xC5, 0x8F, 0xB7, 0x04, 0x34, 0xCE, 0x6E, 0x69,
+    0xF8, 0x17, 0xA3, 0xF6, 0x5B, 0x32, 0x5A, 0xEC, 0x96, 0x92, 0x6F, 0x0F, 0x7A, 0xD8, 0x12, 0xF3,
+    0x3A, 0x07, 0x5B, 0x7A, 0x7E, 0xC7, 0xE5, 0xFD, 0x96, 0xA4, 0xA7, 0x9C, 0x6E, 0xA9, 0xFA, 0x07,
+    0xCE, 0xB8, 0x2D, 0x61, 0x4F, 0xD5, 0xB8, 0xA5, 0x6D, 0xE1, 0xEC, 0x8E, 0xBC, 0x4D, 0xD1, 0x6F,
+    0x29, 0xAC, 0x65, 0xDA, 0x11, 0x39, 0xA6, 0xBA, 0x27, 0x3A, 0x5F, 0x00, 0xAA, 0xB6, 0x74, 0xA6,
+    0xCF, 0xBD, 0xF6, 0x6A, 0x22, 0x70, 0xCC, 0x01, 0x06, 0xA8, 0xBE, 0x36, 0xD1, 0xE8, 0x91, 0x39,
+    0xF7, 0x2A, 0x18, 0xA7, 0x7D, 0x59, 0xE7, 0x83, 0xC5, 0xB8, 0x63, 0x4A, 0x26, 0x0E, 0x94, 0xE7,
+    0xB2, 0xEE, 0xA1, 0xFA, 0xDA, 0x64, 0xFA, 0xDC, 0xDB, 0xA7, 0x27, 0xE6, 0xDC, 0x5B, 0x4A, 0x17,
+    0x8A, 0x5E, 0xFB, 0xB2, 0x0E, 0xDC, 0xD0, 0xBE, 0xC2, 0xB8, 0x63, 0x3D, 0x28, 0x6F, 0xDA, 0x53,
+    0x0E, 0x94, 0x37, 0x68, 0x77, 0x25, 0x1B, 0xA8, 0x38, 0x53, 0x93, 0xF6, 0xC6, 0x95, 0x5C, 0x61,
+    0xCA, 0xBC, 0x76, 0x95, 0xF6, 0xD5, 0x33, 0xBE, 0xFC, 0xFA, 0x68, 0x5E, 0x9F, 0x8C, 0x0B, 0xB9,
+    0x3B, 0xD5, 0xFD, 0xB1, 0x1E, 0xAE, 0x64, 0xFE, 0x00, 0xFF, 0x9B, 0x95, 0xF6, 0x37, 0xB2, 0xD1,
+    0x6A, 0x5F, 0x7E, 0x7D, 0xB4, 0x84, 0xF2, 0xEB, 0xA3, 0x71, 0xC1, 0xB4, 0xC7, 0x85, 0x9B, 0x74,
+    0x7F, 0x5C, 0xB8, 0x03, 0xDD, 0x1F, 0x67, 0xFE, 0x40, 0xF7, 0x46, 0x0D, 0x4F, 0xC6, 0xA5, 0x4B,
+    0x1A, 0xA0, 0xAB, 0xC9, 0xDF, 0x81, 0x2B, 0x97, 0xC9, 0x86, 0x3F, 0xA1, 0x54, 0x03, 0xA3, 0x76,
+    0xA6, 0x35, 0x9C, 0xF2, 0xA4, 0x76, 0x7C, 0xF5, 0x0A, 0x78, 0x14, 0x1C, 0x53, 0xBA, 0xDC, 0xAB,
+    0x40, 0x53, 0x97, 0x7D, 0x3E, 0x62, 0xC9, 0xA6, 0x58, 0xE3, 0xAB, 0x3D, 0x55, 0x4D, 0xE0, 0x22,
+    0xD4, 0x1C, 0xA0, 0x3D, 0x65, 0x4B, 0x20, 0x1F, 0xE2, 0x67, 0x4A, 0x97, 0x4F, 0xCC, 0xD8, 0xDA,
+    0xF4, 0x7A, 0xE4, 0xFA, 0x7E, 0x90, 0xA4, 0xC6, 0x38, 0x14, 0x23, 0xF9, 0x84, 0xEE, 0x6D, 0xAD,
+    0x96, 0xD8, 0x04, 0xC0, 0xA2, 0x27, 0x6C, 0xAD, 0x12, 0xD2, 0xB3, 0xB6, 0xA9, 0xD2, 0xBB, 0x6E,
+    0x2F, 0x34, 0x75, 0x0C, 0xEC, 0x8E, 0xA9, 0x77, 0xDF, 0x33, 0x13, 0x5C, 0x20, 0xFF, 0xE9, 0xC4,
+    0x43, 0x66, 0xA0, 0x99, 0x28, 0xDF, 0x0C, 0xE4, 0x13, 0xC5, 0x28, 0x68, 0xA9, 0xD5, 0x5C, 0xD6,
+    0xFA, 0x93, 0x91, 0x4B, 0xA0, 0xA7, 0x84, 0x74, 0xE7, 0x23, 0x6B, 0x6C, 0x16, 0x3D, 0xC5, 0x6A,
+    0x90, 0x69, 0x2D, 0xC7, 0x26, 0xF7, 0xE9, 0x87, 0xD0, 0x13, 0x97, 0xC8, 0xBD, 0x9E, 0x28, 0x7B,
+    0x1A, 0x35, 0x91, 0x4F, 0xE4, 0xC3, 0xAF, 0xC3, 0x0C, 0x5F, 0x06, 0x7E, 0x23, 0xEE, 0x42, 0x1F,
+    0xFD, 0xBC, 0x29, 0xA6, 0xD5, 0x94, 0x43, 0xE1, 0x29, 0xFB, 0xC2, 0x53, 0x39, 0x33, 0x60, 0x9D,
+    0xE9, 0xB1, 0x6D, 0xD9, 0x63, 0xEB, 0xD2, 0xD1, 0x50, 0x39, 0x3A, 0x6C, 0x1B, 0x81, 0xCA, 0x19,
+    0x9B, 0xFA, 0x08, 0x04, 0x6E, 0xA0, 0x26, 0xCE, 0xC8, 0x46, 0x02, 0xDA, 0xC7, 0xA7, 0x09, 0x75,
+    0xC8, 0x3E, 0x32, 0x7D, 0xB1, 0x56, 0x2D, 0x55, 0x6F, 0x3C, 0xB6, 0x2F, 0xD7, 0x27, 0x57, 0x0E,
+    0x5C, 0xE0, 0x62, 0x22, 0x6F, 0xB7, 0x50, 0x88, 0xF4, 0x46, 0xC4, 0x17, 0xD7, 0xDE, 0x9A, 0xB0,
+    0x6F, 0x04, 0xEC, 0xD7, 0x02, 0xF6, 0xA9, 0x40, 0x93, 0x05, 0x1A, 0x3D, 0xB1, 0x29, 0x3C, 0x73,
+    0xD5, 0x13, 0xA4, 0x46, 0x66, 0x94, 0x8C, 0x28, 0x71, 0x64, 0x4B, 0xF2, 0xF4, 0x7D, 0x14, 0x2C,
+    0xFB, 0x61, 0xAD, 0x8B, 0x75, 0x84, 0xF8, 0xED, 0x10, 0x13, 0x94, 0xAC, 0xDB, 0xA5, 0x99, 0x15,
+    0x29, 0x80, 0xE1, 0x4F, 0x4E, 0x4E, 0x5E, 0xF9, 0x2D, 0xE0, 0xD1, 0x6F, 0x03, 0xBF, 0xFD, 0x55,
+    0xC0, 0x5F, 0x06, 0xDD, 0x97, 0x50, 0xD6, 0xC5, 0xA0, 0xE6, 0x58, 0x4C, 0x48, 0xB5, 0x00, 0xEA,
+    0xE4, 0x26, 0x34, 0x32, 0x62, 0xEE, 0xFC, 0xBD, 0x89, 0x80, 0x1A, 0x4D, 0x8B, 0xF2, 0x7F, 0x02,
+    0xD9, 0x0F, 0x5B, 0xD0, 0xFF, 0x07, 0xF0, 0x6B, 0xE7, 0x04, 0xDE, 0xE5, 0xD4, 0xF2, 0x50, 0x0D,
+    0xE9, 0x1F, 0x45, 0x4B, 0x34, 0x06, 0xAE, 0x00, 0x79, 0x1B, 0x99, 0x9B, 0x27, 0xA3, 0xE1, 0x10,
+    0x1B, 0x34, 0x5E, 0x5A, 0xDD, 0xB0, 0x4D, 0xAA, 0x73, 0xD2, 0xDF, 0x05, 0x6E, 0x7F, 0x1B, 0x4C,
+    0x51, 0x93, 0xF5, 0x5F, 0x85, 0x63, 0xED, 0x30, 0x5C, 0x26, 0x1B, 0xB4, 0xE3, 0x72, 0x4C, 0xF9,
+    0xDF, 0xF7, 0x64, 0xF6, 0x9A, 0xFB, 0x56, 0xF5, 0x3E, 0x4E, 0x19, 0x01, 0xB1, 0xD5, 0xDA, 0x2B,
+    0xDB, 0xF5, 0x9B, 0xD5, 0x74, 0x79, 0x9B, 0x62, 0x72, 0xBA, 0xAE, 0x5F, 0xB5, 0x16, 0xE5, 0x93,
+    0x6D, 0x5F, 0x15, 0xF3, 0x85, 0x97, 0xD3, 0xD5, 0x6B, 0xDB, 0x1A, 0xF1, 0x72, 0xB5, 0xFB, 0x83,
+    0x49, 0xBF, 0x5B, 0xF8, 0x55, 0xEE, 0x66, 0x7D, 0xC2, 0x69, 0x1E, 0xA1, 0xCE, 0xBD, 0x4A, 0x9E,
+    0x72, 0x56, 0xEB, 0x35, 0xC1, 0x3E, 0x9A, 0x44, 0xA7, 0xA9, 0x6A, 0xE7, 0x11, 0x4E, 0x41, 0x91,
+    0x3B, 0xAE, 0x30, 0x81, 0x1E, 0x0A, 0x47, 0xD7, 0x8F, 0x90, 0x2F, 0x45, 0xCB, 0xB5, 0xD9, 0x43,
+    0x26, 0x1F, 0x82, 0xEA, 0x44, 0x7A, 0x1E, 0x17, 0x89, 0xBC, 0x03, 0x8D, 0x2C, 0x94, 0xE3, 0x3F,
+    0x6E, 0x41, 0xBE, 0xF6, 0x4F, 0xB9, 0x71, 0x0A, 0xE8, 0x9F, 0x3A, 0xB2, 0x70, 0x05, 0x28, 0xDF,
+    0x1C, 0x52, 0x06, 0x6F, 0xF3, 0xB4, 0xA7, 0xEC, 0xAB, 0x1A, 0x16, 0x35, 0x51, 0xB4, 0x65, 0x0B,
+    0xC7, 0x04, 0x14, 0xC6, 0xC1, 0x23, 0xCC, 0xC0, 0xAF, 0x00, 0xF0, 0x15, 0x1E, 0x3E, 0xF9, 0x5F,
+    0x65, 0xB1, 0xF2, 0xBD, 0x68, 0x09, 0xC7, 0xD4, 0xAD, 0x38, 0xAD, 0xB0, 0x73, 0x2B, 0x6F, 0x70,
+    0xDE, 0x87, 0x8B, 0x30, 0x48, 0x74, 0x3C, 0xE3, 0xC7, 0x1C, 0xC9, 0x34, 0x4C, 0xAA, 0xEF, 0xC1,
+    0x1F, 0x8B, 0x37, 0x3E, 0xDB, 0x75, 0x74, 0xB0, 0xBB, 0x1B, 0x57, 0xF5, 0x16, 0x2B, 0xB8, 0xEF,
+    0xF7, 0x41, 0xC9, 0x44, 0x21, 0x03, 0x56, 0x6A, 0x52, 0xEF, 0xB1, 0xB2, 0x85, 0xB3, 0x5D, 0xE3,
+    0xB2, 0xD4, 0xFF, 0xCA, 0xF4, 0xE7, 0xAD, 0xE2, 0xF7, 0x6B, 0x64, 0x46, 0x8B, 0xA7, 0x74, 0x70,
+    0x23, 0x0E, 0xCA, 0x44, 0xD3, 0x39, 0xF5, 0x73, 0xC0, 0xD6, 0x31, 0x2F, 0x24, 0xDD, 0x74, 0x03,
+    0x5A, 0x46, 0x8C, 0x38, 0xAC, 0xA4, 0xFE, 0x87, 0xEB, 0x3F, 0x3E, 0xE5, 0x2B, 0x67, 0xA9, 0x53,
+    0x5A, 0x1C, 0x87, 0x8A, 0x85, 0x57, 0x56, 0x40, 0x42, 0xEC, 0xD3, 0x54, 0x9D, 0x1F, 0xEC, 0x8D,
+    0x07, 0x0F, 0xB6, 0x86, 0x10, 0xC7, 0x2A, 0x8E, 0x6E, 0xBF, 0x10, 0xA1, 0x59, 0xE0, 0xDA, 0x52,
+    0x17, 0x22, 0x7D, 0x21, 0x32, 0x98, 0xA5, 0x1B, 0x8D, 0x74, 0x63, 0xD1, 0xE6, 0x53, 0xDE, 0xE6,
+    0xA9, 0x23, 0xDB, 0x2E, 0x02, 0x97, 0x50, 0x99, 0xBD, 0xD7, 0x7A, 0x4A, 0x9D, 0xE1, 0x12, 0xEC,
+    0x57, 0xF5, 0x51, 0x70, 0x74, 0x35, 0x74, 0x2D, 0x7A, 0x8E, 0x28, 0x48, 0x39, 0xC6, 0xFC, 0x22,
+    0xEB, 0xE2, 0xFF, 0xB1, 0x0A, 0x0F, 0x35, 0xA5, 0xBB, 0xF8, 0xE8, 0x36, 0xE8, 0x21, 0x75, 0x5A,
+    0xAE, 0xCF, 0x65, 0x9A, 0x9E, 0x13, 0x4B, 0x2A, 0x89, 0xA6, 0x72, 0x48, 0xE2, 0x69, 0x15, 0x51,
+    0xC3, 0xEE, 0xF6, 0x17, 0xCE, 0x97, 0x9A, 0x96, 0xD2, 0x52, 0xF5, 0x9D, 0xCC, 0x18, 0x6F, 0xEF,
+    0x4A, 0xAF, 0x43, 0xD1, 0xE6, 0x31, 0x0C, 0xD4, 0xD1, 0xD4, 0x6B, 0x1C, 0x21, 0x7A, 0xDA, 0xA9,
+    0xF3, 0xEF, 0xC2, 0x4C, 0x6C, 0xAC, 0x0B, 0x5D, 0x5D, 0x3A, 0xE8, 0xEA, 0x62, 0x00, 0xA9, 0xF5,
+    0x88, 0x8A, 0xEC, 0x22, 0x60, 0x61, 0x81, 0xB2, 0xE5, 0x06, 0xE4, 0x3D, 0x16, 0x32, 0x8F, 0x69,
+    0x21, 0xA0, 0xEA, 0xFB, 0x8C, 0xB8, 0xDF, 0x00, 0x75, 0x93, 0xB2, 0x27, 0x9B, 0x31, 0x13, 0x48,
+    0xAB, 0x67, 0xB0, 0x3D, 0x02, 0xC6, 0x73, 0x01, 0xF6, 0xE5, 0x7F, 0xE5, 0x32, 0x99, 0x40, 0x94,
+    0xC8, 0x8C, 0x0E, 0xB9, 0x74, 0x81, 0x72, 0x30, 0x75, 0x31, 0xD2, 0xD4, 0x60, 0x22, 0x04, 0x5A,
+    0xC5, 0xA4, 0xC5, 0x0E, 0x1B, 0x13, 0x30, 0x23, 0x5A, 0x98, 0x7B, 0x40, 0xA8, 0x62, 0xC7, 0xA9,
+    0x0D, 0x69, 0xE0, 0x94, 0x23, 0xC6, 0xA1, 0xE2, 0xC8, 0xCB, 0x01, 0x35, 0xC1, 0x0C, 0x45, 0xBF,
+    0x36, 0x9E, 0x8B, 0x7C, 0xA3, 0x46, 0x50, 0x87, 0xE7, 0x54, 0x42, 0xDC, 0x2F, 0x37, 0x51, 0x37,
+    0xA1, 0xEA, 0x53, 0x0F, 0x64, 0xA4, 0x46, 0xCF, 0xE4, 0x01, 0x8C, 0xC7, 0x0C, 0x70, 0x61, 0x95,
+    0x01, 0x11, 0x2E, 0x94, 0x3F, 0x4F, 0xCE, 0xF9, 0x97, 0xC2, 0xBA, 0xED, 0x9A, 0x15, 0x15, 0xAC,
+    0xDA, 0xB4, 0x1D, 0xCD, 0x7D, 0x6F, 0xAB, 0x70, 0xAE, 0x2A, 0x74, 0x4C, 0x08, 0xDC, 0xF9, 0xB7,
+    0x9F, 0x38, 0xF9, 0xD6, 0x21, 0x56, 0x64, 0x89, 0xCD, 0x8C, 0xAF, 0x3C, 0x2B, 0xE2, 0x2F, 0x6B,
+    0x91, 0xF1, 0xB2, 0x16, 0x09, 0xDB, 0xA7, 0xF9, 0x33, 0x9F, 0x76, 0x9F, 0x1B, 0x2F, 0xEB, 0x74,
+    0x03, 0x77, 0x59, 0xCB, 0x1D, 0x2E, 0x6B, 0xC7, 0x2F, 0xE9, 0x89, 0x6D, 0xEA, 0x7D, 0x23, 0x22,
+    0x2F, 0x8A, 0x7C, 0x7C, 0xC3, 0x8A, 0xB4, 0xFF, 0x56, 0x64, 0xC9, 0x3E, 0x10, 0x99, 0x8A, 0x4E,
+    0x64, 0xB8, 0x24, 0x22, 0xED, 0x9F, 0x8A, 0x2C, 0xD9, 0x87, 0xE7, 0xDE, 0xFA, 0xBF, 0x44, 0x96,
+    0xEC, 0xC7, 0x22, 0x53, 0xF1, 0x4D, 0x91, 0xE1, 0x52, 0x25, 0xD2, 0xDE, 0xB6, 0x22, 0x32, 0x54,
+    0x22, 0xD2, 0x5E, 0x38, 0x39, 0xF9, 0xD6, 0x4A, 0xEC, 0xBE, 0x10, 0x91, 0xF1, 0xD2, 0xB3, 0x22,
+    0xFE, 0x76, 0x21, 0xF2, 0x57, 0x43, 0x25, 0xF2, 0x9D, 0xB6, 0x13, 0xF9, 0x37, 0x99, 0xC8, 0x72,
+    0xBB, 0x10, 0x59, 0x86, 0x4A, 0xE4, 0x93, 0xB6, 0x13, 0xF9, 0xCB, 0x4C, 0x44, 0xB6, 0x6F, 0x7D,
+    0xD0, 0x76, 0x22, 0xFF, 0x2C, 0x13, 0x09, 0xB7, 0x8B, 0x08, 0x58, 0x48, 0x21, 0x22, 0xC3, 0xE7,
+    0x4E, 0x4E, 0xFE, 0x70, 0x55, 0x8E, 0xFB, 0x6D, 0x72, 0x1F, 0xE2, 0x00, 0xCE, 0xF0, 0x68, 0xF9,
+    0x82, 0xE3, 0xA2, 0xFC, 0x25, 0x57, 0xB9, 0x26, 0xE2, 0x31, 0x22, 0x0E, 0x71, 0xFF, 0x18, 0xF3,
+    0xDD, 0x16, 0xE6, 0x0A, 0xCC, 0x70, 0x03, 0x3A, 0x02, 0xF8, 0x6C, 0x84, 0x3A, 0xF7, 0x49, 0x4D,
+    0x7C, 0x25, 0x9B, 0xF5, 0x9C, 0x07, 0x3D, 0x71, 0xF8, 0x20, 0xD4, 0xFB, 0x31, 0x84, 0x85, 0x0D,
+    0x1B, 0x36, 0xDC, 0xE0, 0x80, 0x83, 0xA8, 0x7A, 0x5F, 0x78, 0x25, 0xA2, 0x2A, 0x35, 0xD8, 0x77,
+    0x9F, 0x1F, 0x12, 0xB3, 0xEA, 0x01, 0x8E, 0x29, 0x6A, 0x78, 0x92, 0xDF, 0x04, 0x7E, 0x8D, 0x7F,
+    0x74, 0x9F, 0x3D, 0xF1, 0x9F, 0xF4, 0xF1, 0x5B, 0xC0, 0xA3, 0x7C, 0x1B, 0xF8, 0x6D, 0xBE, 0x0A,
+    0x78, 0x2E, 0x83, 0xEE, 0x29, 0xA1, 0xAC, 0x29, 0x06, 0x35, 0xA7, 0xD6, 0x0B, 0xC9, 0x5C, 0x5A,
+    0x25, 0x41, 0x34, 0x00, 0xB6, 0x5A, 0xEE, 0x11, 0x26, 0x28, 0x7A, 0x53, 0x83, 0xF4, 0x1E, 0x2E,
+    0xCA, 0x5F, 0xF2, 0x28, 0xAA, 0x8B, 0xC5, 0xC1, 0x12, 0xA0, 0xF2, 0xFF, 0x55, 0x1B, 0x89, 0xAF,
+    0xC7, 0x53, 0x60, 0xD1, 0x03, 0x54, 0xCE, 0x92, 0xE8, 0xAF, 0x52, 0x34, 0xF0, 0x26, 0xE7, 0x4A,
+    0xF2, 0x37, 0x3B, 0xAD, 0x18, 0x40, 0x61, 0x5A, 0xB8, 0xC1, 0x08, 0xC5, 0x62, 0x80, 0x6B, 0x8B,
+    0x57, 0x35, 0x8F, 0x8B, 0x04, 0x28, 0x44, 0x1C, 0x99, 0x3C, 0xF5, 0xBB, 0x70, 0x76, 0x0A, 0xD8,
+    0x6F, 0x38, 0x30, 0xFE, 0x00, 0xB2, 0xA0, 0x3D, 0x14, 0x75, 0xD5, 0xC2, 0x23, 0x11, 0xBF, 0xFF,
+    0x95, 0x6D, 0xFC, 0xF3, 0x7A, 0xD7, 0x16, 0xDF, 0x99, 0x08, 0x4D, 0x5D, 0x3E, 0x55, 0x6B, 0x0F,
+    0x37, 0xA2, 0x7E, 0x0F, 0x50, 0xD6, 0x68, 0x0F, 0x07, 0x71, 0x04, 0x3F, 0xDB, 0x1B, 0xAD, 0x79,
+    0xD3, 0x67, 0xCB, 0x01, 0xD5, 0x07, 0xBD, 0x9A, 0x41, 0xC1, 0xB5, 0xA5, 0x06, 0x8A, 0xBA, 0x13,
+    0xB9, 0x09, 0xB9, 0x93, 0x13, 0x91, 0x77, 0xC9, 0x87, 0x33, 0x54, 0x27, 0x77, 0x6F, 0xF9, 0x2B,
+    0xC0, 0x35, 0x11, 0xFF, 0x6B, 0xD1, 0x54, 0xBB, 0xB9, 0xDD, 0x96, 0x33, 0x94, 0x8B, 0xB4, 0x6C,
+    0xEA, 0xDC, 0x67, 0x1E, 0xC6, 0xC2, 0xC1, 0x65, 0x03, 0x3C, 0x79, 0x19, 0xF8, 0xB5, 0x87, 0x80,
+    0x87, 0x92, 0x99, 0x75, 0x0A, 0x19, 0xA7, 0x19, 0x85, 0x3B, 0x35, 0x4E, 0xFB, 0x53, 0x5B, 0x13,
+    0x4E, 0x67, 0xB0, 0x32, 0x82, 0x91, 0x9E, 0x93, 0x5B, 0xF2, 0xFE, 0xAB, 0x22, 0x22, 0x21, 0xD6,
+    0xD1, 0x1A, 0xE9, 0xD3, 0xD5, 0xF9, 0x74, 0x46, 0x8F, 0xA7, 0x96, 0xA2, 0x3F, 0x35, 0x4E, 0xD7,
+    0xA7, 0xBA, 0xDE, 0xDD, 0x94, 0xAD, 0x81, 0x19, 0xD1, 0x34, 0x33, 0x82, 0x9E, 0xEF, 0x6B, 0xD3,
+    0x71, 0x7F, 0xEE, 0x76, 0x8A, 0x83, 0xEA, 0x39, 0x25, 0x25, 0x94, 0xED, 0xCF, 0xC0, 0x8D, 0x07,
+    0xA9, 0xEE, 0xC0, 0x8C, 0x29, 0xDC, 0xF8, 0x1B, 0x50, 0x7D, 0x6D, 0x2A, 0xDD, 0x19, 0x8D, 0x1E,
+    0xED, 0xD7, 0x02, 0x73, 0xEE, 0x1B, 0x3D, 0xAA, 0x60, 0xDC, 0x59, 0x3E, 0x68, 0x5F, 0xD6, 0x93,
+    0x71, 0xF9, 0x60, 0x33, 0x5F, 0xD6, 0xC6, 0x1D, 0xEB, 0xDE, 0x52, 0x32, 0x15, 0xEE, 0x38, 0x7A,
+    0xB3, 0x13, 0x97, 0x75, 0xFF, 0xA4, 0xF2, 0xEB, 0x0C, 0xB6, 0xA5, 0xED, 0xA9, 0x14, 0x64, 0xFD,
+    0xD3, 0xFC, 0x3C, 0x5B, 0x27, 0x32, 0xE8, 0xDF, 0x8F, 0xC1, 0xFA, 0xC5, 0x3A, 0x40, 0x49, 0xFC,
+    0xB3, 0xC4, 0x12, 0xCC, 0xD3, 0x9F, 0xE7, 0xB6, 0xA9, 0x11, 0xA1, 0x9C, 0x1B, 0x67, 0x1A, 0xF5,
+    0xAF, 0x43, 0x0A, 0x19, 0x3F, 0x12, 0xF3, 0x1E, 0xEC, 0x8B, 0x29, 0x85, 0x4A, 0xA2, 0xAD, 0x1E,
+    0xA9, 0xBC, 0xF9, 0xF9, 0x64, 0xC1, 0xA5, 0xA4, 0xDE, 0xA3, 0x0D, 0x6A, 0xC6, 0xBD, 0xCA, 0x3A,
+    0xF8, 0x07, 0x3F, 0xDF, 0x3D, 0x23, 0x21, 0x6E, 0xA7, 0x1C, 0xAF, 0x38, 0xDA, 0x6A, 0x90, 0x98,
+    0x52, 0xF4, 0x70, 0x32, 0xCA, 0x51, 0x93, 0x7D, 0x73, 0xAE, 0xDC, 0xE1, 0x67, 0xDC, 0xA8, 0x7A,
+    0x33, 0xD8, 0xEF, 0x87, 0xAD, 0xF1, 0x14, 0x2D, 0x67, 0xEB, 0xB6, 0x61, 0xA7, 0xB8, 0x0C, 0x5F,
+    0xFE, 0x59, 0xC7, 0xA5, 0x26, 0x20, 0x58, 0x07, 0xD5, 0xDB, 0x33, 0xE8, 0xA5, 0x72, 0x50, 0xF5,
+    0x5F, 0x8E, 0xE3, 0xF9, 0xD9, 0x1E, 0x59, 0xB8, 0x67, 0x0C, 0xB1, 0x3A, 0x2D, 0xCE, 0xE2, 0x77,
+    0x53, 0x8D, 0xC3, 0xDE, 0x9F, 0x47, 0x38, 0xE3, 0x21, 0xD4, 0xCC, 0x19, 0x0D, 0xD9, 0xC2, 0x19,
+    0x52, 0xA7, 0x3F, 0xC4, 0x37, 0xD3, 0x47, 0xEE, 0xF9, 0xDE, 0xB9, 0x3F, 0x8D, 0xC8, 0x1A, 0x75,
+    0xD8, 0xFD, 0xF9, 0xAC, 0x2F, 0xAC, 0x7F, 0x02, 0x67, 0x6C, 0xD2, 0xCF, 0xAE, 0x7F, 0xD4, 0xCC,
+    0x19, 0x02, 0x5F, 0xE1, 0x2C, 0xEA, 0xD2, 0xF3, 0xDF, 0xBB, 0x1E, 0x0B, 0x6D, 0xED, 0x5B, 0xB3,
+    0x7D, 0x7D, 0xD7, 0x17, 0xD5, 0xBE, 0x39, 0x37, 0x6F, 0x87, 0xCF, 0x6D, 0x53, 0xBE, 0x74, 0x68,
+    0xDE, 0x9E, 0xAD, 0x3B, 0x44, 0x8F, 0xCD, 0x77, 0x42, 0xF3, 0x86, 0x07, 0x3E, 0x97, 0x87, 0xEE,
+    0x3B, 0xC1, 0xB6, 0x87, 0x80, 0xFD, 0x42, 0xE8, 0xDE, 0x0A, 0x55, 0x0D, 0xEA, 0x66, 0xF3, 0x07,
+    0xA1, 0x7B, 0x73, 0xBA, 0x40, 0x23, 0xDF, 0xBF, 0xF5, 0xEA, 0x0E, 0x67, 0x7D, 0xEC, 0xE3, 0x2F,
+    0xFC, 0xA2, 0xF8, 0xF1, 0xBF, 0xFE, 0x7D, 0x7E, 0xC8, 0xAF, 0xFE, 0x3E, 0x3F, 0xE4, 0x57, 0xFF,
+    0xF9, 0x2F, 0x86, 0xF8, 0x5A, 0x79, 0x43, 0x26, 0x23, 0x74, 0x83, 0x0E, 0x54, 0xED, 0xCF, 0x7F,
+    0xA3, 0x15, 0x3F, 0x36, 0xA8, 0x11, 0xEB, 0xF2, 0x19, 0xF1, 0x95, 0xBC, 0x28, 0xE1, 0x17, 0xB8,
+    0xDB, 0x21, 0x55, 0x5B, 0xFC, 0x9B, 0xAC, 0xFF, 0xEA, 0x65, 0xED, 0x3E, 0xF6, 0x3A, 0xFC, 0x42,
+    0x63, 0x6B, 0x86, 0xEC, 0x16, 0xBF, 0xB4, 0x55, 0x88, 0x50, 0x02, 0x46, 0x7A, 0xF3, 0xBD, 0x50,
+    0xF4, 0x95, 0xF6, 0xF9, 0xEB, 0xA3, 0xF2, 0xA7, 0x1C, 0x1F, 0x50, 0x99, 0xB6, 0x78, 0xB3, 0xD7,
+    0x7E, 0x64, 0xBA, 0xC2, 0xB1, 0x69, 0xAD, 0xF6, 0x55, 0xDD, 0x75, 0xAD, 0x91, 0x96, 0x17, 0x80,
+    0xBA, 0xCC, 0x06, 0xE0, 0xB7, 0xF3, 0xF6, 0x4F, 0x0C, 0xFE, 0x37, 0xB3, 0xE1, 0x8A, 0x76, 0xC7,
+    0x45, 0x1B, 0xDD, 0xF3, 0x3A, 0x75, 0xF6, 0x2F, 0x02, 0xC5, 0x87, 0xE4, 0xDF, 0x6D, 0xF5, 0xDB,
+    0xBD, 0xFE, 0x9E, 0xD7, 0xC3, 0x69, 0xE6, 0x0F, 0xB2, 0x3B, 0xCF, 0xFF, 0xFB, 0x98, 0x62, 0x5B,
+    0x73, 0x0A, 0x07, 0x60, 0x6A, 0x54, 0x0D, 0x27, 0x27, 0x58, 0x71, 0xE5, 0xC9, 0xCB, 0x85, 0x43,
+    0xF7, 0xE0, 0xE1, 0xC6, 0x2B, 0x58, 0x71, 0x17, 0xFF, 0xE5, 0x14, 0xCF, 0x4F, 0x70, 0x64, 0x1E,
+    0xC2, 0xA3, 0x9C, 0xE5, 0xEF, 0x2F, 0x4A, 0x16, 0x2E, 0xBE, 0x02, 0x64, 0x52, 0x17, 0xE2, 0xCC,
+    0x7B, 0x87, 0xC6, 0x91, 0x3B, 0xF4, 0x80, 0xFA, 0xC9, 0xCC, 0x46, 0x06, 0xFB, 0xBD, 0x60, 0x5C,
+    0xF9, 0xCC, 0xA0, 0xFB, 0x91, 0xF1, 0x80, 0x53, 0xE3, 0x0E, 0xD4, 0xD2, 0x51, 0x09, 0xEA, 0x5B,
+    0xF0, 0xF0, 0xC9, 0x89, 0x16, 0x71, 0x27, 0xAF, 0x0D, 0x68, 0x8F, 0x1A, 0x61, 0x82, 0x53, 0xB8,
+    0x01, 0x36, 0x1E, 0x89, 0xD1, 0x62, 0x1C, 0xF9, 0x80, 0xF6, 0x64, 0xF1, 0xF2, 0xA3, 0xC4, 0x84,
+    0x80, 0x46, 0x6A, 0x9B, 0xFB, 0x92, 0xE3, 0xC2, 0x95, 0xCA, 0x9B, 0xD6, 0x3E, 0xEF, 0xB4, 0xD4,
+    0x5A, 0x5C, 0xFE, 0x71, 0xD0, 0x83, 0xF9, 0xBA, 0xD7, 0xFE, 0x94, 0x50, 0x71, 0x90, 0xDF, 0xE9,
+    0x68, 0xE2, 0xEF, 0x51, 0x0D, 0x34, 0x82, 0x7D, 0x6E, 0xB0, 0x04, 0x53, 0x97, 0xB9, 0xCB, 0x5F,
+    0xF7, 0x99, 0xBF, 0xAE, 0x82, 0xF9, 0x0F, 0x8B, 0x92, 0x77, 0xEA, 0x87, 0xBF, 0xE1, 0xD0, 0x03,
+    0x99, 0x27, 0x9B, 0x2E, 0xBE, 0x36, 0x29, 0x19, 0x79, 0xE2, 0x26, 0xE0, 0xD1, 0x0E, 0x03, 0x97,
+    0x39, 0xB9, 0xFB, 0xAF, 0x44, 0xFE, 0xDD, 0xF3, 0x47, 0x5C, 0x4E, 0xEF, 0x5E, 0x80, 0x93, 0x93,
+    0x7F, 0x25, 0xF2, 0xEF, 0x8E, 0x8E, 0xE2, 0x8B, 0xE8, 0x22, 0x6C, 0xDF, 0xE3, 0x61, 0x4C, 0x5B,
+    0xB8, 0xDC, 0xE9, 0x21, 0xF3, 0x4C, 0x9C, 0x62, 0x31, 0x75, 0xDE, 0x2B, 0xCF, 0x29, 0x15, 0x85,
+    0x53, 0x9E, 0x63, 0x4C, 0x9D, 0x0D, 0x1C, 0x73, 0x01, 0xF8, 0x0A, 0x06, 0xDD, 0x73, 0x4A, 0x49,
+    0x1E, 0x2F, 0x96, 0xE4, 0x2E, 0xF3, 0x04, 0x0E, 0x28, 0x31, 0x2E, 0xEF, 0xF5, 0x90, 0x79, 0x35,
+    0x32, 0xAE, 0xF9, 0x88, 0xDF, 0xEE, 0xDA, 0x2B, 0x32, 0x9A, 0xA1, 0xCA, 0x87, 0xE2, 0x0D, 0x9F,
+    0x0D, 0x13, 0xE3, 0x65, 0x2E, 0x97, 0x94, 0x45, 0x5B, 0xBC, 0x38, 0xE8, 0x7E, 0xC4, 0x5F, 0xE6,
+    0x78, 0x8B, 0x13, 0x0C, 0x4A, 0x42, 0x3E, 0x9E, 0x19, 0x77, 0x50, 0xD6, 0xB6, 0xA2, 0x3A, 0xC0,
+    0x5E, 0xE1, 0xE0, 0x98, 0x83, 0x63, 0xAE, 0x9C, 0x72, 0x7C, 0x4A, 0x38, 0x56, 0xE3, 0x81, 0xF6,
+    0xF6, 0x56, 0x6F, 0xA4, 0x56, 0xAF, 0xC0, 0xE7, 0xD4, 0x52, 0xCC, 0xCD, 0xD9, 0xF1, 0xE9, 0x23,
+    0x81, 0x49, 0x8D, 0xCA, 0x67, 0x5E, 0x7B, 0x3D, 0xE4, 0x7D, 0xE1, 0x8C, 0x33, 0xED, 0x85, 0xB4,
+    0x22, 0xED, 0xA5, 0x2F, 0x78, 0xC5, 0x75, 0x30, 0x35, 0xB9, 0x43, 0x7B, 0x32, 0x4F, 0x36, 0x92,
+    0x8D, 0xE8, 0x11, 0x1D, 0xDB, 0x1F, 0x0D, 0xE4, 0x22, 0x6F, 0x88, 0xF8, 0x35, 0xB2, 0xFA, 0xF8,
+    0x42, 0x25, 0x3E, 0xFF, 0x5F, 0x66, 0x30, 0x35, 0xBA, 0x47, 0x79, 0xD4, 0x48, 0x37, 0x60, 0x27,
+    0x28, 0x5B, 0x94, 0x87, 0x2B, 0x50, 0x3E, 0x85, 0x79, 0xFD, 0xEE, 0xB5, 0xDE, 0x4A, 0xAF, 0x4E,
+    0xEA, 0xA8, 0x27, 0x23, 0x93, 0x9B, 0x40, 0xB1, 0x90, 0x7F, 0xB7, 0xCE, 0xDF, 0x4C, 0x4C, 0xAE,
+    0x87, 0x83, 0xEC, 0xCE, 0xF3, 0x7F, 0xB8, 0x32, 0x79, 0xD8, 0x67, 0xF2, 0x27, 0x4E, 0xEA, 0x4A,
+    0x7A, 0xF3, 0xFE, 0xCB, 0xDA, 0xA1, 0x3C, 0x4C, 0x70, 0xF0, 0x0A, 0xA5, 0xF4, 0xD9, 0xBF, 0x0C,
+    0x50, 0xD5, 0xE8, 0x1E, 0x46, 0x38, 0x7E, 0x08, 0xAB, 0xDF, 0xEF, 0x10, 0xE1, 0xE2, 0xB7, 0x80,
+    0x8B, 0x82, 0x11, 0x57, 0xBE, 0x77, 0x68, 0x5A, 0xE2, 0xFE, 0xC8, 0xFE, 0x6A, 0x46, 0xA4, 0xB7,
+    0xDF, 0x0B, 0xC6, 0x55, 0x79, 0x9F, 0xBF, 0xEE, 0x33, 0x7F, 0x4C, 0x30, 0xED, 0xF5, 0xEC, 0xEE,
+    0x06, 0xBB, 0xA0, 0x5E, 0x85, 0xEC, 0xE4, 0xE4, 0x69, 0x91, 0xE1, 0x85, 0xD7, 0xE2, 0x4F, 0x05,
+    0xB8, 0x1E, 0xD9, 0x1B, 0xCA, 0xC8, 0xDE, 0x7D, 0xA2, 0x94, 0x8A, 0x97, 0xCF, 0x12, 0xD4, 0x70,
+    0x6D, 0xC8, 0x24, 0xE4, 0xC3, 0x8D, 0xC2, 0x55, 0xC6, 0x55, 0x85, 0xBB, 0xA2, 0xFF, 0x6A, 0x42,
+    0xFA, 0x5C, 0x5C, 0xF5, 0x0D, 0x7F, 0x5D, 0x8D, 0x81, 0x69, 0x62, 0x0A, 0x6A, 0x6C, 0x9E, 0xF3,
+    0x95, 0xB4, 0xD9, 0xAB, 0x70, 0xED, 0x66, 0x26, 0x53, 0xF1, 0x5E, 0x30, 0xED, 0x41, 0xC9, 0x41,
+    0x95, 0xFE, 0xDB, 0x94, 0x7F, 0x3E, 0x17, 0x72, 0xAA, 0x5E, 0x39, 0x85, 0x11, 0xED, 0x31, 0xEE,
+    0x44, 0x6A, 0x99, 0x78, 0xA1, 0x86, 0xDF, 0xDE, 0x72, 0xF7, 0x13, 0x9B, 0x57, 0x45, 0x7E, 0xF2,
+    0xEC, 0x0F, 0x22, 0xA3, 0xE3, 0x51, 0x35, 0x4F, 0x9C, 0xBC, 0x2A, 0xF2, 0x93, 0xA3, 0xA3, 0xFA,
+    0x89, 0x93, 0x57, 0x57, 0xEC, 0xF3, 0x89, 0x93, 0x57, 0xE2, 0x7B, 0x7C, 0x0E, 0x53, 0x9B, 0x36,
+    0x72, 0xA4, 0xF2, 0x04, 0xAE, 0x50, 0x52, 0x38, 0xED, 0x99, 0x38, 0xC0, 0xB4, 0x7A, 0xE0, 0x94,
+    0x12, 0xDD, 0x73, 0x9B, 0x0B, 0xC0, 0xAF, 0x53, 0x38, 0x3C, 0x57, 0x30, 0x6D, 0xB6, 0xB2, 0x7F,
+    0xE6, 0x99, 0xB8, 0x42, 0x89, 0x71, 0xBA, 0xCF, 0x3C, 0x23, 0x13, 0xA7, 0x1C, 0xF3, 0x28, 0xF0,
+    0x84, 0xA2, 0xFB, 0x6B, 0x77, 0x56, 0xF8, 0x63, 0xC2, 0x15, 0x0E, 0x4A, 0xCC, 0xEF, 0xB4, 0xFA,
+    0x8D, 0x41, 0xF9, 0x91, 0xE9, 0x12, 0x67, 0x85, 0xEB, 0x90, 0x8F, 0x5C, 0xD1, 0xDF, 0x84, 0x27,
+    0xEA, 0x42, 0xDC, 0xA9, 0xF9, 0x82, 0x7B, 0xF2, 0x0A, 0x3F, 0xF9, 0xC9, 0xB5, 0xDF, 0x91, 0xE1,
+    0xD2, 0x21, 0x23, 0xD9, 0x40, 0xDE, 0x3F, 0x54, 0x88, 0xBF, 0x78, 0x07, 0x3E, 0x57, 0x67, 0xE2,
+    0x4D, 0x7F, 0x5A, 0x71, 0xE5, 0x32, 0x97, 0x8E, 0xB9, 0x74, 0x9B, 0x27, 0x47, 0xAE, 0x8C, 0x1C,
+    0xDF, 0x66, 0xBC, 0xA2, 0x7D, 0x29, 0x6D, 0x76, 0x07, 0x55, 0xAB, 0xFA, 0x12, 0x13, 0xFE, 0x12,
+    0xC5, 0xEF, 0x38, 0xAE, 0xC4, 0x83, 0x06, 0xCA, 0x08, 0x8D, 0xFD, 0xD4, 0x71, 0xE5, 0x12, 0xA6,
+    0xF6, 0x7A, 0x28, 0xDA, 0xDF, 0xE5, 0xF3, 0xA8, 0x13, 0x2A, 0x69, 0x6F, 0x96, 0x35, 0x15, 0x1C,
+    0xA3, 0x7C, 0x29, 0x6F, 0xDE, 0xB9, 0x71, 0x85, 0x9F, 0xF8, 0xE2, 0x1B, 0xEE, 0xD4, 0x88, 0x2B,
+    0xDE, 0x85, 0x2F, 0xC3, 0x65, 0x28, 0xA1, 0x68, 0xA3, 0x58, 0xFD, 0xA7, 0x5C, 0x96, 0xA1, 0x1C,
+    0x8E, 0x8B, 0xDE, 0x3C, 0x33, 0x68, 0xE7, 0xF1, 0xC7, 0x7C, 0xF5, 0x12, 0x97, 0x4C, 0x6D, 0x9E,
+    0x71, 0xFA, 0x75, 0xAF, 0xFC, 0x6D, 0x6E, 0xFF, 0x06, 0xBF, 0xFE, 0x80, 0xAF, 0xAA, 0xFA, 0x72,
+    0xDE, 0xFF, 0x66, 0xDE, 0x17, 0x5F, 0x70, 0xFA, 0x2D, 0xC7, 0x4F, 0x1D, 0x8D, 0xA7, 0xFA, 0x67,
+    0x98, 0x67, 0x9C, 0x76, 0xB7, 0x95, 0x37, 0xDC, 0xCE, 0x86, 0xDF, 0xE0, 0xF3, 0xF0, 0x65, 0xED,
+    0x4A, 0xBE, 0x9A, 0xF5, 0x86, 0xCB, 0x6A, 0x28, 0xDA, 0x2B, 0xF8, 0xDC, 0x5D, 0x62, 0xD4, 0xAE,
+    0xE4, 0xAB, 0xEA, 0x26, 0xEA, 0xA9, 0x57, 0x2E, 0xBE, 0xAC, 0xBF, 0x39, 0x57, 0x21, 0xBF, 0x7D,
+    0xE9, 0x4F, 0xAE, 0x14, 0xBD, 0x71, 0x97, 0x4C, 0x5B, 0xF2, 0xA4, 0xA1, 0xE2, 0x72, 0xC9, 0x93,
+    0x5C, 0xBE, 0xC4, 0x65, 0x8E, 0xAF, 0x70, 0x99, 0xDB, 0x97, 0xF9, 0x2A, 0xE3, 0x31, 0x7F, 0x82,
+    0xFF, 0x2A, 0xA3, 0xF2, 0x5F, 0xE1, 0x65, 0x75, 0x53, 0x7D, 0xED, 0x5B, 0xFC, 0xB5, 0xF4, 0xB6,
+    0x0F, 0xA5, 0x2B, 0xF3, 0xBE, 0x78, 0xC3, 0xEB, 0x61, 0xDC, 0x97, 0x3C, 0xBD, 0xEE, 0x3D, 0xFE,
+    0xF3, 0x7C, 0x1E, 0x0E, 0x9F, 0xA0, 0xA8, 0x02, 0x9F, 0x3C, 0x33, 0x18, 0x57, 0x2A, 0x8F, 0xBF,
+    0x44, 0xA9, 0x7B, 0xE5, 0x2F, 0x73, 0x29, 0x77, 0xDA, 0x9D, 0x72, 0xDB, 0x0C, 0x15, 0x3F, 0x15,
+    0x67, 0x8A, 0x5E, 0x0D, 0xF0, 0x24, 0x68, 0x07, 0x97, 0x53, 0x6C, 0xE0, 0xA4, 0x6E, 0xC4, 0xD4,
+    0xFF, 0xC3, 0x40, 0x09, 0x33, 0x59, 0x2C, 0x05, 0x6E, 0xF9, 0x6A, 0x6B, 0xBE, 0x28, 0xFE, 0xDA,
+    0xBB, 0x80, 0x72, 0xDA, 0x95, 0x3F, 0xE8, 0x16, 0x83, 0xE1, 0x37, 0xB9, 0xC4, 0x15, 0x2E, 0x73,
+    0xCC, 0x6D, 0x6E, 0xD3, 0x0C, 0x8F, 0xDF, 0x5C, 0x8B, 0xDC, 0x07, 0xB0, 0x32, 0x81, 0xFC, 0x91,
+    0x8F, 0xE6, 0x67, 0xBE, 0xAD, 0x84, 0xDC, 0x4F, 0xED, 0xFC, 0xDC, 0xC9, 0xAB, 0x96, 0x4A, 0x82,
+    0xC5, 0xCA, 0xD4, 0xC4, 0x14, 0xC1, 0x06, 0x2C, 0x37, 0xC0, 0xB6, 0x67, 0x50, 0x0D, 0x21, 0x56,
+    0x37, 0xBA, 0x4C, 0x44, 0x1C, 0x7F, 0x6F, 0x39, 0xA9, 0xEF, 0xCB, 0xCD, 0x1C, 0x56, 0x2F, 0xDC,
+    0xBC, 0xFF, 0x2D, 0x62, 0x7D, 0xB4, 0x89, 0xB5, 0x28, 0x57, 0x2F, 0x00, 0x57, 0x4C, 0x0B, 0xA5,
+    0x76, 0x60, 0xFE, 0xCC, 0x43, 0x25, 0xB1, 0xEE, 0xDD, 0x29, 0xB9, 0xD3, 0x0C, 0x4A, 0x4E, 0xCD,
+    0xA1, 0x92, 0x83, 0xC2, 0x21, 0x46, 0xF7, 0x74, 0xC5, 0xEB, 0x1E, 0xFB, 0x4C, 0x3F, 0x51, 0xBD,
+    0xEE, 0x2F, 0x63, 0xFA, 0xA9, 0x22, 0xF7, 0x97, 0x4D, 0x9D, 0x85, 0x2A, 0x77, 0x6C, 0xCC, 0x33,
+    0x03, 0xF6, 0x1B, 0xCE, 0x63, 0x7E, 0x34, 0x9C, 0xA2, 0x27, 0x7F, 0x05, 0x36, 0xA7, 0x25, 0x54,
+    0xB3, 0x69, 0xC9, 0x45, 0x3B, 0x90, 0xAF, 0x7B, 0x28, 0xC7, 0xF1, 0x37, 0xF6, 0x73, 0xFF, 0x8E,
+    0xAF, 0xDD, 0xAD, 0x39, 0x28, 0x1C, 0x18, 0xDD, 0x43, 0xF1, 0xBA, 0xBF, 0xD7, 0x19, 0x91, 0x77,
+    0x51, 0x29, 0xBC, 0x30, 0x63, 0x47, 0xFE, 0x27, 0xBA, 0x16, 0xD4, 0xB2, 0x26, 0xB6, 0x16, 0xF7,
+    0x92, 0xF0, 0xD1, 0x8B, 0x2F, 0xDB, 0xFA, 0x8A, 0xF5, 0x96, 0x2B, 0x32, 0x34, 0x34, 0x23, 0x1D,
+    0x5D, 0x6C, 0xF7, 0xCE, 0x86, 0x25, 0xF6, 0x6A, 0x67, 0xA3, 0x02, 0x74, 0xD9, 0x04, 0x8D, 0x1E,
+    0x53, 0x51, 0x52, 0xF5, 0xA6, 0x07, 0xF3, 0xC9, 0xF0, 0x10, 0x85, 0x7C, 0x12, 0xC8, 0x44, 0x02,
+    0x34, 0xF2, 0xEE, 0x5A, 0xD7, 0xDE, 0x88, 0x0C, 0x31, 0x25, 0x37, 0x0E, 0xDE, 0xEC, 0x8A, 0x5E,
+    0xAA, 0x76, 0x9B, 0x9F, 0xB8, 0x17, 0x30, 0x68, 0x76, 0xB0, 0x4B, 0xF4, 0xF9, 0x7E, 0x70, 0x74,
+    0x88, 0x12, 0x91, 0x9A, 0x72, 0x6D, 0xFF, 0x72, 0x7F, 0x27, 0xE9, 0xE7, 0x3E, 0x3E, 0x04, 0x2B,
+    0xD2, 0xA6, 0x46, 0x7A, 0xEA, 0xBE, 0xD6, 0xE3, 0xBB, 0x2F, 0xEC, 0x2A, 0x75, 0xE6, 0x18, 0x29,
+    0xAA, 0xC9, 0xE4, 0xB5, 0x00, 0xE5, 0xC0, 0xCB, 0x29, 0xB1, 0x25, 0xA6, 0x69, 0x47, 0x47, 0x67,
+    0xB3, 0xD7, 0x0F, 0xC0, 0x01, 0x8F, 0x75, 0x47, 0x87, 0x69, 0x36, 0xA9, 0x35, 0x44, 0xEC, 0x15,
+    0x1A, 0xB6, 0x5F, 0x34, 0x22, 0x33, 0x31, 0x47, 0x53, 0xBD, 0x76, 0xF7, 0xA4, 0x5D, 0x53, 0xC0,
+    0x37, 0x7B, 0x01, 0x97, 0x7A, 0xDB, 0x97, 0x61, 0xD7, 0x98, 0xB4, 0x2E, 0xD7, 0xCE, 0x24, 0x31,
+    0x57, 0x87, 0xF5, 0xD4, 0x03, 0xD6, 0x38, 0x59, 0x8C, 0xA1, 0x5C, 0x55, 0x1F, 0x5F, 0xC5, 0x38,
+    0x19, 0xAD, 0x78, 0x42, 0x23, 0xDF, 0x11, 0x71, 0xE6, 0x8F, 0xFF, 0x48, 0xE4, 0x5F, 0xCC, 0x4A,
+    0xFA, 0x42, 0x9C, 0x19, 0x2A, 0x4F, 0xE3, 0xD9, 0x44, 0x70, 0xB8, 0x18, 0xAC, 0xA3, 0xA9, 0x59,
+    0xD6, 0xB6, 0xFD, 0x1D, 0x2C, 0x10, 0x8A, 0x01, 0xDB, 0x53, 0xBA, 0x99, 0x3C, 0xC4, 0xEE, 0xB6,
+    0xE2, 0x62, 0xF8, 0x72, 0x42, 0x8F, 0x55, 0x9B, 0x4B, 0x8D, 0xD5, 0x13, 0x9F, 0x78, 0x72, 0x6F,
+    0xEB, 0xAA, 0x81, 0x8D, 0xF6, 0xF9, 0x9F, 0x7B, 0x4C, 0xDF, 0x30, 0xC5, 0x5B, 0x54, 0xA6, 0xA7,
+    0x74, 0x73, 0xDE, 0x07, 0xB2, 0x00, 0x6B, 0xDB, 0xA5, 0x04, 0x3C, 0xF5, 0xE7, 0x7A, 0x34, 0xED,
+    0xA5, 0x2B, 0x9A, 0x96, 0xC6, 0x31, 0x51, 0x04, 0xCA, 0x16, 0x71, 0xD9, 0x88, 0x99, 0xB1, 0xF0,
+    0x49, 0xAF, 0x3D, 0xE5, 0x0D, 0x0E, 0xC8, 0x3E, 0x1A, 0xF2, 0x1E, 0x6B, 0x39, 0xE3, 0xF7, 0x3E,
+    0xB9, 0x7B, 0xEB, 0xFF, 0x36, 0x22, 0x22, 0x43, 0xF4, 0x04, 0x4F, 0xCB, 0xA7, 0x47, 0x8C, 0x1B,
+    0x2B, 0x08, 0xE6, 0x45, 0xAF, 0x45, 0x44, 0x46, 0x2B, 0x22, 0xF2, 0x54, 0x73, 0x34, 0x6F, 0x0E,
+    0xB5, 0x2F, 0xBE, 0xE3, 0x38, 0xE0, 0x7A, 0x20, 0x1F, 0xF2, 0x77, 0x5A, 0xCE, 0xB0, 0x23, 0xC6,
+    0x69, 0xA9, 0x09, 0x58, 0x8F, 0x69, 0xB5, 0xA0, 0x46, 0xAA, 0x81, 0xAA, 0xCE, 0x66, 0xA0, 0xBC,
+    0x1B, 0x0B, 0x84, 0xA4, 0x8D, 0xED, 0x3F, 0x00, 0x3D, 0x96, 0x31, 0x4B, 0xCA, 0x3A, 0xC8, 0x63,
+    0x63, 0x80, 0xCD, 0x9A, 0x57, 0xBD, 0xA8, 0x9A, 0x80, 0xE9, 0x8F, 0x29, 0x1D, 0xB3, 0x69, 0x55,
+    0xA0, 0x7A, 0x7D, 0xA2, 0x6A, 0xF3, 0xA9, 0x7B, 0x49, 0x8F, 0x4A, 0x3A, 0xF1, 0xF6, 0x4B, 0xF2,
+    0x8E, 0x2C, 0xB9, 0x88, 0xCF, 0x07, 0x3A, 0x19, 0x39, 0xC3, 0xBC, 0x7F, 0x98, 0xDA, 0xE9, 0x10,
+    0x52, 0x6A, 0x76, 0x4A, 0xFA, 0xAE, 0xDA, 0xB5, 0x95, 0x9C, 0xF6, 0x58, 0xC0, 0xAE, 0x47, 0xD2,
+    0x35, 0x80, 0x7D, 0xA9, 0x18, 0x40, 0xCB, 0x30, 0x13, 0x3B, 0x7F, 0xC5, 0xBA, 0x88, 0x5C, 0x5E,
+    0x49, 0x11, 0xCF, 0xB0, 0xCD, 0xB3, 0x05, 0xF4, 0xF8, 0xF8, 0x14, 0xB7, 0x40, 0x91, 0x76, 0xC9,
+    0xDA, 0x3C, 0xD0, 0xD6, 0x8F, 0xD5, 0x98, 0x9E, 0xB9, 0x90, 0x11, 0x8B, 0xF6, 0x9D, 0x78, 0x15,
+    0x28, 0xDF, 0xBA, 0xF3, 0x7C, 0x5D, 0x0C, 0x2C, 0xB6, 0x05, 0xDB, 0x16, 0x7E, 0x06, 0x66, 0x25,
+    0x2F, 0x7A, 0xD0, 0x22, 0x93, 0x19, 0xA0, 0x14, 0xA9, 0xAB, 0x1E, 0x3A, 0xF1, 0xD8, 0x1E, 0x3D,
+    0x1A, 0x47, 0x33, 0xC4, 0x2A, 0x1E, 0x3B, 0xC4, 0x63, 0x20, 0x6C, 0x1F, 0x3B, 0x08, 0x58, 0x57,
+    0x0C, 0xB1, 0x27, 0xB3, 0xAD, 0xE3, 0x01, 0x3E, 0x01, 0x5B, 0xC7, 0x0E, 0x28, 0xCB, 0x6F, 0x61,
+    0xDB, 0xCA, 0x65, 0x61, 0x7E, 0x2E, 0xB0, 0x21, 0xFF, 0x48, 0xA4, 0xD7, 0x23, 0xE5, 0x1B, 0x32,
+    0xEF, 0x7A, 0x04, 0x9D, 0x52, 0xB6, 0x99, 0xD7, 0x1E, 0xC1, 0x38, 0xE3, 0x74, 0xE0, 0x06, 0x96,
+    0x2A, 0x9A, 0xE4, 0xD2, 0x1A, 0xA7, 0x87, 0xFC, 0x2F, 0xB9, 0x41, 0xD9, 0x5E, 0xBA, 0x9D, 0x79,
+    0x6E, 0xF0, 0xD7, 0x83, 0x71, 0x6A, 0xCC, 0xBF, 0xDB, 0x5E, 0x27, 0xEF, 0x0F, 0xAE, 0x68, 0x4F,
+    0xF9, 0x94, 0x1F, 0x4D, 0xCB, 0x59, 0xF1, 0x66, 0x7F, 0x9D, 0x4A, 0x62, 0xCF, 0x0E, 0x11, 0x91,
+    0x90, 0x75, 0xB7, 0xDE, 0xBF, 0xBB, 0xDC, 0x24, 0x5C, 0xD1, 0x6F, 0x7A, 0xF4, 0x4F, 0x7C, 0x69,
+    0x6A, 0xCC, 0x77, 0xDB, 0xE3, 0x63, 0xB0, 0x57, 0xD4, 0x47, 0x1E, 0xEE, 0xF8, 0xFC, 0xBB, 0x35,
+    0xFA, 0xC3, 0xB6, 0x3C, 0x06, 0x73, 0x4A, 0x33, 0x80, 0xF5, 0x99, 0xD4, 0x20, 0x75, 0x11, 0x40,
+    0x07, 0xAA, 0x01, 0xCC, 0x10, 0x0F, 0x18, 0xA9, 0x23, 0x4E, 0x52, 0xCA, 0x52, 0x93, 0xF7, 0x51,
+    0x5E, 0x07, 0x2A, 0x91, 0x19, 0xE3, 0xB4, 0xA7, 0xF0, 0x31, 0x75, 0xBD, 0xAA, 0xCB, 0x36, 0x1F,
+    0x50, 0x53, 0x36, 0x72, 0x06, 0xA6, 0xB5, 0x18, 0x67, 0x99, 0xB4, 0x27, 0x68, 0x5F, 0xB6, 0x37,
+    0x30, 0xEE, 0x46, 0x36, 0x16, 0x83, 0x9A, 0x8A, 0xDE, 0xD6, 0x67, 0x54, 0x75, 0xD0, 0xDE, 0x38,
+    0xED, 0x8D, 0xB3, 0x04, 0xAC, 0x0A, 0xF9, 0x50, 0xB6, 0xF9, 0x50, 0xB6, 0x67, 0xD9, 0xC8, 0x26,
+    0x1B, 0x8D, 0xB3, 0x14, 0xBD, 0x25, 0xA4, 0x5B, 0x38, 0x8B, 0x71, 0x37, 0xD4, 0x94, 0x0F, 0x6A,
+    0x2A, 0x86, 0xAA, 0x3E, 0xA3, 0xAA, 0xCF, 0xC0, 0x38, 0x3D, 0x1A, 0x47, 0x36, 0x61, 0x63, 0x83,
+    0x4A, 0xED, 0xCB, 0x96, 0x6A, 0xE0, 0x46, 0xB6, 0x9C, 0x74, 0x13, 0x45, 0x6F, 0x45, 0x16, 0x08,
+    0x5A, 0xD6, 0x43, 0x82, 0x50, 0x2F, 0xEF, 0x6D, 0xDF, 0x66, 0xDB, 0x50, 0x2D, 0xCA, 0xE3, 0x78,
+    0x5C, 0x0B, 0x8F, 0x1D, 0xCD, 0x87, 0xEB, 0xE5, 0x0B, 0x75, 0xD5, 0x42, 0xB3, 0x98, 0x1E, 0x3A,
+    0xF9, 0x68, 0x84, 0xEE, 0xBD, 0x4D, 0x80, 0xC6, 0x69, 0x01, 0xEB, 0xE8, 0x5A, 0x2A, 0x97, 0x92,
+    0x70, 0xF3, 0x78, 0x14, 0x5A, 0x94, 0x1B, 0x51, 0x24, 0xC5, 0x23, 0x40, 0x4C, 0x8F, 0xE9, 0x53,
+    0xFF, 0x7D, 0x1D, 0x20, 0xA0, 0x16, 0xB0, 0x20, 0x2D, 0xA6, 0xA7, 0xEB, 0xD1, 0x81, 0x4F, 0x3C,
+    0x34, 0x7F, 0x16, 0x02, 0x18, 0x99, 0x0E, 0x80, 0x6E, 0x2C, 0x6B, 0xEE, 0x8F, 0x99, 0xF1, 0xC4,
+    0xC9, 0xC9, 0xB7, 0xA0, 0x12, 0x91, 0x9A, 0x62, 0x6D, 0x17, 0xB2, 0xA6, 0x87, 0x0E, 0x90, 0x8B,
+    0xF4, 0x49, 0x71, 0x75, 0x7D, 0xDE, 0x52, 0x0D, 0xDB, 0xBA, 0x16, 0xD9, 0x6A, 0x91, 0x94, 0x00,
+    0x53, 0xAF, 0x2D, 0x9C, 0x2A, 0x91, 0x19, 0xF5, 0xFC, 0x7B, 0x47, 0xF5, 0xBE, 0xAE, 0xF9, 0xBD,
+    0xE5, 0xE4, 0x66, 0xD4, 0xBA, 0x89, 0x36, 0xB6, 0xDD, 0x6A, 0xA0, 0xBD, 0x72, 0xCF, 0x98, 0x6D,
+    0xDC, 0xB5, 0xD4, 0x68, 0x39, 0x89, 0xE7, 0x48, 0xB5, 0xA9, 0xC3, 0x4F, 0x2C, 0x32, 0xBC, 0xEF,
+    0xA4, 0xBF, 0xED, 0x19, 0x84, 0xB1, 0x07, 0x54, 0xE1, 0x1F, 0xD4, 0xD9, 0xF6, 0xBE, 0x93, 0xFE,
+    0xE2, 0x49, 0x34, 0x9D, 0x88, 0x8C, 0x3C, 0x2B, 0xB7, 0x7E, 0x70, 0x88, 0x9E, 0xE3, 0x71, 0xBA,
+    0x31, 0xE7, 0x3A, 0x76, 0x8B, 0x8B, 0xC5, 0x79, 0x59, 0x3C, 0x87, 0x6B, 0xDE, 0x1E, 0x77, 0xE8,
+    0x68, 0xE2, 0x82, 0xB4, 0x7B, 0x87, 0x1E, 0xF6, 0x34, 0x60, 0x7C, 0xEC, 0x29, 0xE2, 0x1A, 0x11,
+    0x09, 0xB9, 0x88, 0x48, 0xBB, 0x2A, 0xF5, 0x1D, 0xB1, 0x6C, 0x5D, 0x83, 0xF6, 0xA7, 0x40, 0xD3,
+    0x38, 0x28, 0xA4, 0x07, 0x64, 0xD8, 0xF6, 0xBA, 0x08, 0x40, 0x2E, 0xCE, 0x91, 0xC9, 0xB4, 0x81,
+    0xC5, 0x76, 0x3D, 0xF9, 0x33, 0xD2, 0xAF, 0x75, 0x6D, 0xF1, 0x53, 0xCB, 0xDA, 0x59, 0x22, 0x5B,
+    0x02, 0x70, 0x50, 0x3A, 0x50, 0x4F, 0xDF, 0x77, 0xE2, 0xD0, 0xF9, 0x40, 0x75, 0x6A, 0xC6, 0x1D,
+    0xC3, 0x93, 0x00, 0xD5, 0x72, 0x2B, 0x2E, 0xFC, 0xAF, 0xAE, 0x47, 0x63, 0xAD, 0x23, 0x80, 0x8B,
+    0x37, 0x63, 0xD2, 0x6A, 0xEA, 0x75, 0x16, 0xD5, 0x6C, 0xEC, 0x08, 0x56, 0xBA, 0x54, 0xAB, 0x56,
+    0xAD, 0x4D, 0xB9, 0x6C, 0xBD, 0xB6, 0xE9, 0x62, 0xF7, 0x22, 0x5E, 0x6A, 0xF6, 0x2C, 0x86, 0xAA,
+    0x55, 0x57, 0x63, 0xC1, 0x59, 0x5B, 0x4A, 0x4B, 0x80, 0xA6, 0x8E, 0x82, 0x96, 0x4E, 0x2D, 0x5F,
+    0x98, 0x54, 0x80, 0x45, 0x8F, 0x59, 0xC8, 0x26, 0xB2, 0x90, 0xFB, 0x78, 0x76, 0xCE, 0x64, 0x7A,
+    0x82, 0xF6, 0x94, 0xDE, 0x38, 0x15, 0x72, 0x4F, 0xE7, 0x8C, 0xD3, 0x53, 0x31, 0x3C, 0x2E, 0x94,
+    0xAE, 0xF0, 0x46, 0x64, 0xA2, 0xFA, 0xF8, 0xDA, 0x60, 0x44, 0x5A, 0xAC, 0x48, 0x6B, 0xE4, 0x5D,
+    0xB0, 0x4D, 0x92, 0x9B, 0xCD, 0x5A, 0xA1, 0xBA, 0x3D, 0xE6, 0x67, 0xB3, 0x5F, 0xC5, 0x72, 0x4E,
+    0x15, 0x6F, 0x4F, 0x7B, 0xDD, 0x9E, 0x7F, 0xBB, 0x3D, 0x22, 0xF7, 0xBC, 0x9D, 0x94, 0x7A, 0x79,
+    0x08, 0x90, 0xDF, 0x99, 0x01, 0xFB, 0xD4, 0x44, 0x2A, 0xFE, 0xCF, 0xFB, 0xB2, 0x85, 0x8A, 0xEB,
+    0xC0, 0xA9, 0xDE, 0x36, 0x61, 0x2A, 0xDC, 0x29, 0x50, 0xE9, 0x01, 0x38, 0xB5, 0x40, 0xF6, 0xF1,
+    0x08, 0xE4, 0x1F, 0xBA, 0x6D, 0xE3, 0xBA, 0xD8, 0x77, 0x69, 0x01, 0x1E, 0xD1, 0x1E, 0xB2, 0xD6,
+    0xF6, 0x50, 0x66, 0xD2, 0xC2, 0x5C, 0x76, 0x50, 0x84, 0x10, 0xA0, 0x91, 0x37, 0x3D, 0xFA, 0xA3,
+    0xB9, 0xE8, 0xB1, 0xC5, 0x50, 0xD6, 0x6A, 0x2A, 0xB9, 0x81, 0x71, 0xFF, 0x4D, 0x04, 0xC6, 0x63,
+    0xBA, 0x49, 0x8C, 0x06, 0xDC, 0xD8, 0xCD, 0x25, 0x56, 0xFA, 0x74, 0x80, 0xBE, 0x15, 0x8F, 0xAB,
+    0x69, 0x81, 0xEA, 0x5D, 0xC0, 0xC8, 0xBB, 0xA0, 0x44, 0x26, 0x28, 0x45, 0x06, 0xB2, 0x49, 0x09,
+    0xD8, 0x5A, 0x4F, 0x3C, 0x7B, 0xE7, 0xA8, 0xF9, 0xF7, 0xA5, 0x88, 0xC8, 0xF7, 0x6E, 0xDD, 0x3D,
+    0xE9, 0xFE, 0x23, 0x9B, 0x54, 0x02, 0x5A, 0xB5, 0x04, 0xF4, 0x98, 0x8B, 0x88, 0x8C, 0x9D, 0x88,
+    0x48, 0x94, 0xF6, 0x7A, 0xA4, 0xAB, 0xB1, 0x27, 0xB1, 0xA7, 0xCD, 0x98, 0x7A, 0x94, 0x98, 0xF7,
+    0xB6, 0x54, 0x2E, 0x3F, 0xDD, 0xD8, 0x8D, 0x06, 0xE6, 0xE6, 0x7C, 0x0F, 0xA0, 0x03, 0x80, 0x6B,
+    0xF2, 0x2E, 0x94, 0x22, 0x0B, 0x99, 0x88, 0x8C, 0xD8, 0xE9, 0x76, 0xE1, 0xF4, 0xA2, 0x7B, 0xA8,
+    0x06, 0x53, 0xA3, 0x16, 0x8E, 0xC1, 0xF8, 0xCC, 0x43, 0x53, 0x9B, 0x16, 0x1D, 0xB8, 0x02, 0x65,
+    0x8F, 0x87, 0x8E, 0xDC, 0xA1, 0x03, 0x15, 0x98, 0x01, 0x91, 0xD1, 0xD6, 0x5A, 0xC4, 0xCD, 0x94,
+    0x22, 0xF9, 0xC8, 0x71, 0x36, 0x95, 0x7D, 0xE6, 0xCD, 0x60, 0x6B, 0xD3, 0xDA, 0x7A, 0xE1, 0x8A,
+    0x0A, 0x3A, 0x28, 0x9F, 0xFB, 0x62, 0x2C, 0x5C, 0xD5, 0x1A, 0x7F, 0xC0, 0x4C, 0x35, 0x8E, 0xB9,
+    0xA7, 0x92, 0xF7, 0xC5, 0x51, 0x89, 0x08, 0x14, 0x22, 0x37, 0x41, 0xBF, 0x97, 0x70, 0xCA, 0x98,
+    0xB8, 0xBE, 0x17, 0x36, 0x49, 0xE5, 0xD4, 0xF3, 0x5E, 0x49, 0x8C, 0xDD, 0x00, 0xE4, 0x3F, 0x8D,
+    0x96, 0x7C, 0xAC, 0x30, 0x7A, 0xD3, 0x6F, 0x9B, 0x12, 0xD2, 0x69, 0x1F, 0x0B, 0x3A, 0xE2, 0x61,
+    0xBF, 0x12, 0x78, 0x41, 0x4E, 0xBA, 0xF7, 0xDB, 0x54, 0x36, 0xA6, 0x02, 0x65, 0xCB, 0x85, 0xE6,
+    0x07, 0x5F, 0x9A, 0x0F, 0xB3, 0xA8, 0xB9, 0xD3, 0x51, 0x2B, 0x95, 0xC3, 0xF4, 0xE8, 0x69, 0x2D,
+    0x0B, 0x8F, 0xCA, 0x22, 0x2E, 0x16, 0x85, 0x4F, 0x9D, 0xA3, 0x63, 0x73, 0x42, 0x35, 0x6F, 0xAD,
+    0xB7, 0x2D, 0x73, 0x73, 0x31, 0xF5, 0xF9, 0x9E, 0xC0, 0x8A, 0x0C, 0x64, 0x7D, 0xAC, 0xD6, 0xCC,
+    0xF7, 0x0E, 0x29, 0xDB, 0x1D, 0x57, 0x94, 0x8F, 0x17, 0x4F, 0x4E, 0x4E, 0xE4, 0xA6, 0x88, 0xC8,
+    0x62, 0x24, 0xD6, 0x9E, 0x74, 0x01, 0x32, 0x99, 0x21, 0x93, 0x3B, 0x69, 0x16, 0xCF, 0xC4, 0x23,
+    0x6B, 0xEE, 0x1C, 0x1D, 0x1D, 0x45, 0x17, 0xC2, 0xF4, 0xE7, 0xCB, 0xFB, 0xD3, 0xBB, 0x23, 0x17,
+    0x6B, 0x9A, 0xBB, 0xB7, 0xC6, 0xA4, 0x44, 0xB3, 0x28, 0xAA, 0x8E, 0xF6, 0xF9, 0x60, 0x8A, 0xED,
+    0xDD, 0x20, 0x17, 0x99, 0x89, 0xFE, 0xAA, 0xFC, 0x85, 0xFF, 0x5D, 0xEC, 0x70, 0x00, 0xC5, 0xA8,
+    0xFB, 0xC4, 0x05, 0xD6, 0x15, 0x8E, 0x7C, 0xE4, 0x36, 0x48, 0x02, 0x90, 0x47, 0xB2, 0x40, 0x09,
+    0xD6, 0x65, 0x1E, 0x3D, 0x71, 0x00, 0xB6, 0xD6, 0x3D, 0x7A, 0xE4, 0x32, 0x34, 0x75, 0xEE, 0xC8,
+    0x47, 0x4E, 0xC1, 0xD6, 0xA6, 0x45, 0x4F, 0x8C, 0x60, 0x5D, 0x09, 0xD9, 0x9C, 0x79, 0x30, 0xFE,
+    0x12, 0xD0, 0xBD, 0x3D, 0x3C, 0x8A, 0x16, 0xE9, 0x1C, 0x85, 0x48, 0x80, 0xC7, 0x65, 0xA9, 0xC1,
+    0xDC, 0x24, 0x25, 0xFA, 0x61, 0x52, 0x82, 0xE4, 0x4D, 0x18, 0xB9, 0x0C, 0x15, 0x85, 0x8B, 0x99,
+    0x94, 0x2C, 0xD8, 0x56, 0x75, 0x22, 0x32, 0x5B, 0x11, 0x91, 0xD7, 0xAF, 0xFD, 0xE0, 0xB9, 0x8F,
+    0xAF, 0xAA, 0x10, 0x4B, 0xF8, 0xE3, 0xA9, 0x8E, 0xB1, 0x4B, 0x8E, 0x23, 0x8F, 0x02, 0x91, 0xAA,
+    0x4D, 0xF5, 0xFF, 0xB1, 0xA9, 0x8C, 0x8B, 0x66, 0x41, 0x03, 0x55, 0x5B, 0x0C, 0xE8, 0x29, 0x56,
+    0xEE, 0x9A, 0x1E, 0xED, 0x59, 0xA0, 0xC1, 0x7C, 0xFC, 0xE5, 0x62, 0xA0, 0x11, 0xE6, 0x54, 0x8E,
+    0x76, 0x2E, 0x89, 0x21, 0x97, 0x3B, 0x29, 0xE1, 0x23, 0xD6, 0xE7, 0x4F, 0x80, 0xD4, 0x17, 0xFB,
+    0xED, 0x71, 0xBD, 0x51, 0xA6, 0xA7, 0x5E, 0xDF, 0x71, 0xDD, 0x63, 0x4B, 0x85, 0x35, 0xC0, 0x16,
+    0x4F, 0x8D, 0x82, 0xC8, 0xCB, 0x2A, 0x9D, 0x3C, 0x20, 0xF1, 0x93, 0xB1, 0xB9, 0x69, 0x2A, 0x71,
+    0x4B, 0xED, 0xDC, 0xA9, 0xFA, 0xEC, 0xE6, 0xE7, 0x2F, 0xB6, 0xB6, 0xB6, 0x3F, 0x0C, 0x9D, 0x9B,
+    0xD5, 0x8F, 0xC7, 0x3F, 0x35, 0x7A, 0xCC, 0x9F, 0x7F, 0xCA, 0x3F, 0x59, 0xBA, 0x5F, 0xFB, 0x6A,
+    0xD1, 0x7E, 0x5B, 0xB0, 0xFD, 0x65, 0xFD, 0x1D, 0x8F, 0xED, 0xBD, 0x91, 0x1A, 0x2B, 0x22, 0x1E,
+    0xF5, 0x63, 0x91, 0x3B, 0x90, 0xD7, 0xFF, 0xE7, 0xF3, 0xC0, 0x3F, 0xD2, 0xEE, 0x32, 0xE0, 0x0D,
+    0x43, 0x4A, 0xF5, 0x0C, 0x46, 0x44, 0xC2, 0x9E, 0x63, 0xB8, 0x0B, 0x50, 0x89, 0x88, 0x6F, 0x44,
+    0xC4, 0x77, 0xB1, 0xB1, 0xDD, 0xCF, 0x7A, 0xC2, 0x9C, 0xE3, 0xBE, 0x13, 0xE6, 0x9A, 0xF3, 0xC5,
+    0xB0, 0xE7, 0x4F, 0x98, 0xCB, 0x44, 0x64, 0x32, 0x22, 0xD2, 0x3F, 0x21, 0x77, 0x4F, 0x12, 0x89,
+    0x6C, 0x1B, 0xBF, 0x76, 0xF4, 0xA5, 0xE5, 0xAA, 0x16, 0x11, 0x5F, 0x46, 0xD3, 0x6A, 0x97, 0x30,
+    0xE4, 0xE0, 0xF1, 0x80, 0x12, 0x71, 0xE4, 0xF2, 0xEE, 0xDA, 0x31, 0xAA, 0x5D, 0x7F, 0x6D, 0xFB,
+    0x1B, 0x7A, 0xD7, 0xF8, 0xAA, 0x5F, 0x87, 0xD7, 0xD4, 0xC9, 0xFA, 0x4A, 0x4D, 0xF4, 0xA7, 0x7B,
+    0x5A, 0x5A, 0x39, 0xD5, 0x92, 0xFB, 0xC7, 0x3D, 0xD9, 0xDC, 0x8D, 0x20, 0x72, 0x13, 0x15, 0x3B,
+    0x84, 0x39, 0xC8, 0xC5, 0x5F, 0x1C, 0xD4, 0x33, 0xD3, 0xB5, 0x11, 0x44, 0xDE, 0x8D, 0x69, 0x76,
+    0xC9, 0xD4, 0x1B, 0x20, 0x7B, 0x7B, 0x82, 0xC0, 0x9C, 0x20, 0xA2, 0xAA, 0x2D, 0x1D, 0xA6, 0x2F,
+    0x06, 0x0A, 0x1F, 0x5B, 0xB4, 0x07, 0x74, 0xA0, 0x21, 0x0F, 0x54, 0xAE, 0x9C, 0xE3, 0x0E, 0x88,
+    0xF2, 0x42, 0xE4, 0xE6, 0xB9, 0xCC, 0xB8, 0x58, 0x86, 0x17, 0x7B, 0xC8, 0x5E, 0x29, 0x1D, 0x70,
+    0xBB, 0x70, 0xA4, 0x14, 0x06, 0xA6, 0xC2, 0x01, 0x73, 0x3C, 0x84, 0x4D, 0xD6, 0x44, 0x29, 0xE9,
+    0xF3, 0x24, 0xC8, 0x40, 0x4D, 0x58, 0xE0, 0x98, 0x03, 0xE0, 0x32, 0xD7, 0x1F, 0x82, 0xCB, 0x1C,
+    0xFF, 0x66, 0x5E, 0x5F, 0xE6, 0xB4, 0x2B, 0xDD, 0x31, 0x22, 0x32, 0x4C, 0xC8, 0x37, 0xBC, 0x78,
+    0x66, 0xED, 0x9A, 0x3E, 0x9B, 0xE0, 0x42, 0xAA, 0xC1, 0xBB, 0x11, 0x00, 0x7E, 0x7B, 0xDE, 0x33,
+    0xCE, 0xED, 0xDD, 0x5B, 0x24, 0xE0, 0x2A, 0x0A, 0xA8, 0x5D, 0xD3, 0x8A, 0x66, 0x5F, 0x60, 0xA7,
+    0xC4, 0xD6, 0xD4, 0xF6, 0xF4, 0xDC, 0xF9, 0x27, 0xA9, 0x61, 0x72, 0xEC, 0x40, 0xF0, 0x7B, 0xCB,
+    0x61, 0xDC, 0x48, 0xD3, 0xDA, 0x3F, 0x35, 0x97, 0x3F, 0x9A, 0xAF, 0x4D, 0xD8, 0xDE, 0x0C, 0xC6,
+    0xEB, 0x98, 0x71, 0x5E, 0x0E, 0x2A, 0x60, 0xDB, 0x8E, 0xDC, 0xD3, 0xE9, 0x89, 0xAA, 0xCD, 0x26,
+    0xD3, 0xB3, 0x60, 0x86, 0x06, 0x3D, 0x62, 0xBF, 0x1E, 0xA2, 0x8F, 0x3C, 0x70, 0x23, 0xD5, 0xEE,
+    0x53, 0xBD, 0x1E, 0x9B, 0xAB, 0xE7, 0xB1, 0x8A, 0x3C, 0x56, 0xAC, 0xF6, 0x0B, 0x24, 0x74, 0x29,
+    0x8E, 0xB4, 0x93, 0x57, 0xD6, 0x1E, 0x7F, 0x2A, 0x6E, 0x97, 0xC0, 0xB5, 0x40, 0x36, 0xA1, 0x67,
+    0xF4, 0x88, 0x9A, 0xD1, 0x1E, 0x66, 0x72, 0x0F, 0x33, 0x85, 0x4F, 0xA7, 0x10, 0xC4, 0x43, 0xB4,
+    0xE2, 0xD9, 0x76, 0xD1, 0x84, 0xEE, 0xFA, 0x87, 0xBB, 0xF7, 0xD3, 0xB9, 0x5D, 0x13, 0xA5, 0xC8,
+    0x52, 0xAF, 0x34, 0x69, 0x76, 0x96, 0xD2, 0x13, 0x12, 0xF3, 0xA4, 0xA5, 0x5F, 0x2D, 0xF8, 0x74,
+    0x7E, 0xC3, 0xA7, 0x9F, 0x92, 0x9E, 0xB5, 0x5F, 0x01, 0xF0, 0x57, 0x00, 0x8E, 0x0D, 0xC0, 0xA5,
+    0xDC, 0x01, 0x46, 0x46, 0xF6, 0xEE, 0x35, 0x82, 0x84, 0xF2, 0x14, 0xE4, 0xDF, 0xE4, 0x0E, 0xE4,
+    0x8B, 0x4F, 0x0F, 0x20, 0xCF, 0xF4, 0xB7, 0xA1, 0xA9, 0xFD, 0x15, 0xB0, 0xEE, 0xD8, 0x80, 0xE9,
+    0x2F, 0xE5, 0x8E, 0xC2, 0x9B, 0xA7, 0x07, 0xF4, 0x94, 0xB5, 0x5F, 0xD9, 0x1E, 0x77, 0x5C, 0xEF,
+    0x00, 0xA0, 0x64, 0xA0, 0x85, 0xFD, 0x0B, 0xC3, 0x9E, 0x51, 0x17, 0xE5, 0x5B, 0x12, 0x6C, 0xB1,
+    0x4B, 0x46, 0x9E, 0xC0, 0xAE, 0xF5, 0xE8, 0x32, 0xA7, 0xD7, 0x93, 0xCB, 0x1E, 0xCE, 0x5A, 0x30,
+    0xDA, 0x41, 0x99, 0x3B, 0x28, 0x8B, 0x96, 0x42, 0x3E, 0xAC, 0x31, 0x22, 0x7D, 0x2C, 0xA0, 0x2E,
+    0xDD, 0xE3, 0x21, 0x1E, 0xAA, 0x61, 0xEB, 0x78, 0xC2, 0xC5, 0x42, 0x03, 0x4B, 0xEC, 0xA9, 0xB0,
+    0x90, 0x05, 0x66, 0x8A, 0x91, 0xE5, 0xA8, 0xEB, 0x55, 0xB2, 0x5C, 0x26, 0xF4, 0x9D, 0x2F, 0x09,
+    0x7A, 0xC4, 0x3A, 0xED, 0x31, 0x43, 0xEE, 0x31, 0xBE, 0x18, 0x28, 0xBC, 0xE9, 0x63, 0x92, 0xB5,
+    0x19, 0x4A, 0x47, 0xD9, 0x57, 0x0E, 0xEB, 0xAA, 0x36, 0x93, 0xDA, 0x8A, 0xCC, 0x58, 0x91, 0x91,
+    0x46, 0x96, 0x1A, 0xE5, 0x6F, 0x43, 0x36, 0x8C, 0xA0, 0xFB, 0x11, 0xB2, 0xF6, 0x65, 0xD8, 0x2B,
+    0x4D, 0x04, 0xD4, 0x49, 0x1D, 0xE3, 0x4A, 0x32, 0x23, 0x33, 0x60, 0xC5, 0x59, 0x71, 0x50, 0x8C,
+    0x0F, 0x15, 0xE3, 0x43, 0xAC, 0x47, 0xB9, 0x6D, 0x0F, 0x82, 0x5B, 0x8F, 0xB3, 0x5D, 0x1B, 0x41,
+    0xC4, 0x52, 0x87, 0x31, 0x55, 0x0A, 0xAE, 0x27, 0x12, 0xC7, 0x83, 0x59, 0x97, 0xA3, 0xA3, 0xE5,
+    0x88, 0xAD, 0x81, 0x01, 0x61, 0x67, 0xD6, 0xC5, 0x7B, 0x85, 0xD5, 0xB5, 0x6B, 0xB7, 0xAE, 0xC8,
+    0xD6, 0xC4, 0x5B, 0xAD, 0xBC, 0xAD, 0xA1, 0xB7, 0x49, 0xAB, 0x14, 0xEF, 0xB5, 0x8E, 0xCB, 0xB8,
+    0x5D, 0xF3, 0x9F, 0xD5, 0x50, 0xAC, 0x3E, 0xFB, 0x5E, 0x4D, 0xCA, 0x93, 0x29, 0x86, 0x1D, 0x4E,
+    0xBA, 0xDE, 0xCB, 0xAC, 0xE3, 0x5A, 0x5B, 0x03, 0x35, 0x35, 0x68, 0xF1, 0x5A, 0x3C, 0x60, 0x43,
+    0x6C, 0xB4, 0xAF, 0x97, 0x58, 0x1B, 0x4D, 0x24, 0x61, 0xEC, 0xFB, 0xD7, 0x7F, 0x19, 0xB0, 0xF2,
+    0x46, 0x00, 0xBA, 0xFA, 0x99, 0x78, 0xA0, 0x47, 0x32, 0xC5, 0xB8, 0xB9, 0x75, 0x13, 0x92, 0x1D,
+    0x95, 0xFE, 0x34, 0x32, 0xC6, 0xE3, 0x9F, 0xBD, 0x71, 0xA8, 0xE7, 0xDF, 0x3B, 0x2C, 0x5D, 0x3C,
+    0xAA, 0xC3, 0xC5, 0x5E, 0xC1, 0x11, 0xFA, 0x4C, 0xE7, 0x81, 0xC4, 0x6E, 0x23, 0x11, 0xCC, 0xAA,
+    0xD9, 0xB0, 0xA6, 0xEF, 0xA6, 0x43, 0x3D, 0xD8, 0x90, 0x8E, 0x0C, 0x51, 0xBB, 0x1F, 0x8F, 0x3D,
+    0x44, 0xD7, 0xDE, 0xFF, 0xD9, 0xB4, 0x1E, 0x27, 0x52, 0x44, 0x60, 0xAC, 0x18, 0x20, 0xF7, 0x98,
+    0x7E, 0xBB, 0x21, 0x93, 0x64, 0x4B, 0x27, 0x7C, 0xA4, 0x54, 0xFE, 0x24, 0xD3, 0x22, 0x4E, 0x6B,
+    0x53, 0x0F, 0x92, 0xB4, 0x55, 0xB6, 0xAD, 0x18, 0xD4, 0x49, 0xFD, 0x6A, 0xA4, 0x44, 0x00, 0xAC,
+    0xBC, 0x1E, 0x29, 0xF1, 0x74, 0x3C, 0x2D, 0xF6, 0x81, 0xA3, 0x58, 0x07, 0x33, 0xFC, 0x8D, 0x94,
+    0xB0, 0x7F, 0x33, 0x25, 0xE6, 0x7D, 0x4A, 0xA8, 0xFF, 0xC4, 0x94, 0xD8, 0xB1, 0xC5, 0x96, 0x33,
+    0xDC, 0x96, 0x24, 0xF5, 0x96, 0x3F, 0x76, 0x2C, 0xA2, 0x02, 0x1C, 0xEE, 0xED, 0xAF, 0x1D, 0x03,
+    0xEF, 0xBD, 0x6A, 0x44, 0x64, 0xA5, 0x93, 0x88, 0x78, 0xD3, 0xA3, 0x9E, 0x7F, 0xEF, 0x68, 0x47,
+    0x2D, 0xD3, 0xAF, 0x87, 0xC2, 0xEC, 0xB8, 0x67, 0x47, 0xB6, 0xAA, 0x5D, 0x29, 0x67, 0xB7, 0xC4,
+    0x8B, 0x4D, 0xE0, 0xD3, 0x2E, 0x49, 0xCC, 0xB4, 0xE3, 0xA7, 0x2D, 0x4B, 0x31, 0xAF, 0xB4, 0xDC,
+    0x91, 0x53, 0x6D, 0x29, 0x9A, 0x5E, 0xC5, 0xC1, 0x27, 0xBA, 0xAE, 0xCB, 0xEB, 0xF7, 0xA8, 0xBB,
+    0x23, 0x70, 0xB1, 0xA5, 0xF1, 0x8E, 0xCC, 0x3B, 0x4A, 0xEF, 0x88, 0xBD, 0xA3, 0xF7, 0x96, 0xE4,
+    0x3B, 0xAA, 0xEF, 0x08, 0x7F, 0x2F, 0xED, 0x5F, 0xDD, 0xD2, 0x3E, 0xDC, 0x4F, 0xFB, 0xC4, 0x91,
+    0x3B, 0xA6, 0xDC, 0xF1, 0xC4, 0xFD, 0xC3, 0x1F, 0x77, 0x0C, 0x7A, 0x0F, 0xED, 0xDD, 0xFD, 0xB4,
+    0xAF, 0xFE, 0xD6, 0xB4, 0xDF, 0x6C, 0x69, 0x3F, 0xFF, 0x02, 0xB4, 0x7F, 0xC0, 0xE0, 0x8B, 0xFF,
+    0x34, 0xB4, 0x4F, 0x99, 0xE2, 0xB1, 0xB1, 0x94, 0x24, 0x97, 0xAD, 0x98, 0xA2, 0x54, 0x8D, 0x47,
+    0xC7, 0xD7, 0xD1, 0x6A, 0xF5, 0x51, 0x4E, 0x37, 0x29, 0xA4, 0x36, 0xC4, 0x1F, 0x99, 0x69, 0x24,
+    0x80, 0xE9, 0x2B, 0x11, 0x87, 0x0A, 0xEA, 0xF9, 0x8F, 0xAF, 0x92, 0x8E, 0xED, 0x4C, 0x90, 0xDE,
+    0xFE, 0x2D, 0x4A, 0xC7, 0x7A, 0xF6, 0xD1, 0xEA, 0xBB, 0xB2, 0xA4, 0x34, 0xEF, 0xD4, 0xF0, 0x3C,
+    0xC4, 0xF9, 0x96, 0x8E, 0xCD, 0xFE, 0x2D, 0xDA, 0xB5, 0x5B, 0xF8, 0x7A, 0xC6, 0x6F, 0x8A, 0x8D,
+    0x9A, 0x8F, 0x5F, 0x86, 0x0D, 0x74, 0x0B, 0x98, 0x9E, 0x4C, 0x06, 0xD6, 0x16, 0x22, 0xE9, 0x34,
+    0xBA, 0x35, 0xD5, 0x71, 0x6D, 0x7E, 0xEF, 0xF7, 0x33, 0x31, 0x23, 0x48, 0xB7, 0x36, 0x3C, 0xA3,
+    0xB8, 0xB3, 0xF3, 0x37, 0x5E, 0x88, 0x90, 0x5A, 0x97, 0xFC, 0xFB, 0x48, 0xA4, 0x7C, 0xCA, 0x93,
+    0xC7, 0x10, 0x5D, 0x8D, 0x78, 0xC2, 0x93, 0x4A, 0xA3, 0x34, 0x2D, 0x01, 0xD4, 0x51, 0x88, 0x4D,
+    0x59, 0xC5, 0x55, 0xB2, 0x10, 0x7D, 0x9A, 0xC1, 0xBE, 0x77, 0xCD, 0x3D, 0x7B, 0xE7, 0xEA, 0x7A,
+    0x92, 0x66, 0xB3, 0xA7, 0xE2, 0x36, 0x51, 0x40, 0x99, 0x3E, 0xE6, 0xD5, 0x06, 0x28, 0x63, 0xEB,
+    0x0C, 0x9A, 0x29, 0xD9, 0x85, 0x89, 0xFA, 0xE2, 0xA2, 0xAD, 0x38, 0x47, 0x1D, 0x69, 0x86, 0x3C,
+    0xF5, 0xC8, 0xEB, 0x22, 0x5F, 0x14, 0x03, 0xBF, 0x42, 0x16, 0xE8, 0x60, 0xF9, 0x92, 0xB4, 0xF9,
+    0x9D, 0x2F, 0x1B, 0x11, 0x8F, 0x95, 0xBA, 0x92, 0xD8, 0x2D, 0xE7, 0xC2, 0xE1, 0x3D, 0xCE, 0x63,
+    0xAA, 0x78, 0xDB, 0x35, 0xA5, 0xDA, 0xF9, 0x7F, 0xEB, 0x11, 0x18, 0x6B, 0x23, 0xBB, 0x84, 0x21,
+    0x01, 0x4A, 0xEE, 0xC6, 0x17, 0xE5, 0x10, 0xF1, 0x63, 0x15, 0xD6, 0x08, 0xAB, 0x8F, 0xF7, 0x51,
+    0xD2, 0xBF, 0x80, 0x1D, 0xA0, 0x94, 0x77, 0x16, 0x64, 0x40, 0xC5, 0x7E, 0xEB, 0x03, 0xA5, 0x88,
+    0x0C, 0x46, 0x06, 0x25, 0x22, 0x42, 0x23, 0x43, 0x99, 0x02, 0x82, 0xC3, 0xEA, 0x33, 0xFC, 0x85,
+    0x88, 0xF8, 0x5C, 0x44, 0x32, 0x11, 0xA9, 0x1B, 0x11, 0x9F, 0xC5, 0x3E, 0x7C, 0x42, 0x26, 0xE2,
+    0x4D, 0xEA, 0xF4, 0xF7, 0x7E, 0x27, 0x92, 0xCA, 0x3E, 0xC4, 0xAF, 0x2F, 0x62, 0xA5, 0x93, 0x49,
+    0xDD, 0xB4, 0xDA, 0x52, 0x00, 0xB2, 0x25, 0x81, 0xA0, 0x59, 0x48, 0x27, 0xA8, 0x67, 0x77, 0xAE,
+    0xF9, 0xB5, 0x6A, 0x64, 0x2D, 0x1F, 0xD9, 0x56, 0xD0, 0xAD, 0x96, 0xEE, 0xD6, 0xE4, 0x05, 0xE0,
+    0xFF, 0x01,
 };
 
 static const EpdGlyph notosans_18_italicGlyphs[] = {
@@ -2773,7 +2796,7 @@ static const EpdGlyph notosans_18_italicGlyphs[] = {
     { 4, 39, 21, 9, 29, 39, 11223 }, // |
     { 15, 33, 13, -2, 27, 124, 11262 }, // }
     { 19, 6, 21, 2, 16, 29, 11386 }, // ~
-    { 0, 0, 10, 0, 0, 0, 0 }, //  
+    { 0, 0, 10, 0, 0, 0, 11415 }, //  
     { 11, 28, 10, -1, 21, 77, 0 }, // ¡
     { 16, 29, 21, 4, 28, 116, 77 }, // ¢
     { 23, 28, 21, -1, 28, 161, 193 }, // £
@@ -2784,774 +2807,781 @@ static const EpdGlyph notosans_18_italicGlyphs[] = {
     { 11, 5, 21, 8, 28, 14, 750 }, // ¨
     { 29, 29, 31, 1, 28, 211, 764 }, // ©
     { 12, 14, 13, 3, 28, 42, 975 }, // ª
-    { 17, 16, 18, 1, 18, 68, 1017 }, // «
-    { 19, 11, 21, 2, 15, 53, 1085 }, // ¬
-    { 11, 4, 12, 0, 12, 11, 1138 }, // ­
-    { 29, 29, 31, 1, 28, 211, 1149 }, // ®
-    { 17, 4, 15, 3, 32, 17, 1360 }, // ¯
-    { 12, 13, 16, 2, 28, 39, 1377 }, // °
-    { 19, 23, 21, 2, 23, 110, 1416 }, // ±
-    { 13, 17, 13, 2, 32, 56, 1526 }, // ²
-    { 12, 18, 13, 3, 33, 54, 1582 }, // ³
-    { 9, 7, 10, 4, 29, 16, 1636 }, // ´
-    { 22, 30, 22, -1, 21, 165, 1652 }, // µ
-    { 20, 34, 25, 3, 29, 170, 1817 }, // ¶
-    { 5, 6, 10, 3, 16, 8, 1987 }, // ·
-    { 8, 9, 8, -4, 0, 18, 1995 }, // ¸
-    { 9, 17, 13, 5, 32, 39, 2013 }, // ¹
-    { 11, 14, 13, 3, 28, 39, 2052 }, // º
-    { 17, 16, 18, 0, 18, 68, 2091 }, // »
-    { 24, 28, 27, 3, 27, 168, 2159 }, // ¼
-    { 26, 28, 30, 3, 27, 182, 2327 }, // ½
-    { 27, 29, 30, 2, 28, 196, 2509 }, // ¾
-    { 15, 29, 16, -1, 21, 109, 2705 }, // ¿
-    { 23, 36, 21, -3, 36, 207, 2814 }, // À
-    { 24, 36, 21, -3, 36, 216, 3021 }, // Á
-    { 24, 36, 21, -3, 36, 216, 3237 }, // Â
-    { 25, 35, 21, -3, 35, 219, 3453 }, // Ã
-    { 24, 35, 21, -3, 35, 210, 3672 }, // Ä
-    { 23, 38, 21, -3, 38, 219, 3882 }, // Å
-    { 36, 27, 31, -3, 27, 243, 4101 }, // Æ
-    { 22, 37, 22, 2, 28, 204, 4344 }, // Ç
-    { 20, 36, 19, 1, 36, 180, 4548 }, // È
-    { 20, 36, 19, 1, 36, 180, 4728 }, // É
-    { 20, 36, 19, 1, 36, 180, 4908 }, // Ê
-    { 20, 35, 19, 1, 35, 175, 5088 }, // Ë
-    { 16, 36, 12, -1, 36, 144, 5263 }, // Ì
-    { 18, 36, 12, -1, 36, 162, 5407 }, // Í
-    { 17, 36, 12, -1, 36, 153, 5569 }, // Î
-    { 17, 35, 12, -1, 35, 149, 5722 }, // Ï
-    { 23, 27, 25, 1, 27, 156, 5871 }, // Ð
-    { 26, 35, 27, 1, 35, 228, 6027 }, // Ñ
-    { 24, 37, 27, 2, 36, 222, 6255 }, // Ò
-    { 24, 37, 27, 2, 36, 222, 6477 }, // Ó
-    { 24, 37, 27, 2, 36, 222, 6699 }, // Ô
-    { 24, 36, 27, 2, 35, 216, 6921 }, // Õ
-    { 24, 36, 27, 2, 35, 216, 7137 }, // Ö
-    { 17, 18, 21, 3, 22, 77, 7353 }, // ×
-    { 25, 31, 27, 2, 29, 194, 7430 }, // Ø
-    { 24, 37, 25, 2, 36, 222, 7624 }, // Ù
-    { 24, 37, 25, 2, 36, 222, 7846 }, // Ú
-    { 24, 37, 25, 2, 36, 222, 8068 }, // Û
-    { 24, 36, 25, 2, 35, 216, 8290 }, // Ü
-    { 20, 36, 19, 3, 36, 180, 8506 }, // Ý
-    { 20, 27, 21, 1, 27, 135, 8686 }, // Þ
-    { 26, 38, 22, -5, 29, 247, 8821 }, // ß
-    { 20, 30, 21, 1, 29, 150, 9068 }, // à
-    { 20, 30, 21, 1, 29, 150, 9218 }, // á
-    { 20, 30, 21, 1, 29, 150, 9368 }, // â
-    { 20, 29, 21, 1, 28, 145, 9518 }, // ã
-    { 20, 29, 21, 1, 28, 145, 9663 }, // ä
-    { 20, 32, 21, 1, 31, 160, 9808 }, // å
-    { 29, 22, 31, 1, 21, 160, 9968 }, // æ
-    { 17, 30, 17, 1, 21, 128, 10128 }, // ç
-    { 17, 30, 19, 1, 29, 128, 10256 }, // è
-    { 18, 30, 19, 1, 29, 135, 10384 }, // é
-    { 17, 30, 19, 1, 29, 128, 10519 }, // ê
-    { 17, 29, 19, 1, 28, 124, 10647 }, // ë
-    { 9, 29, 10, 1, 29, 66, 10771 }, // ì
-    { 13, 29, 10, 1, 29, 95, 10837 }, // í
-    { 12, 29, 10, 1, 29, 87, 10932 }, // î
-    { 13, 28, 10, 1, 28, 91, 11019 }, // ï
-    { 20, 30, 21, 1, 29, 150, 11110 }, // ð
-    { 21, 28, 22, 0, 28, 147, 11260 }, // ñ
-    { 19, 30, 21, 1, 29, 143, 11407 }, // ò
-    { 19, 30, 21, 1, 29, 143, 11550 }, // ó
-    { 19, 30, 21, 1, 29, 143, 11693 }, // ô
-    { 19, 29, 21, 1, 28, 138, 11836 }, // õ
-    { 19, 29, 21, 1, 28, 138, 11974 }, // ö
-    { 19, 18, 21, 2, 22, 86, 12112 }, // ÷
-    { 20, 24, 21, 1, 22, 120, 12198 }, // ø
-    { 19, 30, 22, 2, 29, 143, 12318 }, // ù
-    { 19, 30, 22, 2, 29, 143, 12461 }, // ú
-    { 19, 30, 22, 2, 29, 143, 12604 }, // û
-    { 19, 29, 22, 2, 28, 138, 12747 }, // ü
-    { 24, 38, 18, -4, 29, 228, 12885 }, // ý
-    { 21, 38, 22, -1, 29, 200, 13113 }, // þ
-    { 24, 37, 18, -4, 28, 222, 13313 }, // ÿ
-    { 24, 33, 21, -3, 33, 198, 0 }, // Ā
-    { 20, 27, 21, 1, 26, 135, 198 }, // ā
-    { 24, 35, 21, -3, 35, 210, 333 }, // Ă
-    { 20, 29, 21, 1, 28, 145, 543 }, // ă
-    { 23, 36, 21, -3, 27, 207, 688 }, // Ą
-    { 20, 30, 21, 1, 21, 150, 895 }, // ą
-    { 22, 37, 22, 2, 36, 204, 1045 }, // Ć
-    { 17, 30, 17, 1, 29, 128, 1249 }, // ć
-    { 22, 37, 22, 2, 36, 204, 1377 }, // Ĉ
-    { 17, 30, 17, 1, 29, 128, 1581 }, // ĉ
-    { 22, 36, 22, 2, 35, 198, 1709 }, // Ċ
-    { 17, 29, 17, 1, 28, 124, 1907 }, // ċ
-    { 22, 37, 22, 2, 36, 204, 2031 }, // Č
-    { 18, 30, 17, 1, 29, 135, 2235 }, // č
-    { 23, 36, 25, 1, 36, 207, 2370 }, // Ď
-    { 28, 30, 23, 1, 29, 210, 2577 }, // ď
-    { 23, 27, 25, 1, 27, 156, 2787 }, // Đ
-    { 24, 30, 22, 1, 29, 180, 2943 }, // đ
-    { 20, 33, 19, 1, 33, 165, 3123 }, // Ē
-    { 17, 27, 19, 1, 26, 115, 3288 }, // ē
-    { 20, 35, 19, 1, 35, 175, 3403 }, // Ĕ
-    { 18, 29, 19, 1, 28, 131, 3578 }, // ĕ
-    { 20, 35, 19, 1, 35, 175, 3709 }, // Ė
-    { 17, 29, 19, 1, 28, 124, 3884 }, // ė
-    { 20, 36, 19, 1, 27, 180, 4008 }, // Ę
-    { 17, 30, 19, 1, 21, 128, 4188 }, // ę
-    { 21, 36, 19, 1, 36, 189, 4316 }, // Ě
-    { 19, 30, 19, 1, 29, 143, 4505 }, // ě
-    { 23, 37, 25, 2, 36, 213, 4648 }, // Ĝ
-    { 21, 38, 22, 0, 29, 200, 4861 }, // ĝ
-    { 23, 36, 25, 2, 35, 207, 5061 }, // Ğ
-    { 21, 37, 22, 0, 28, 195, 5268 }, // ğ
-    { 23, 36, 25, 2, 35, 207, 5463 }, // Ġ
-    { 21, 37, 22, 0, 28, 195, 5670 }, // ġ
-    { 23, 37, 25, 2, 28, 213, 5865 }, // Ģ
-    { 21, 38, 22, 0, 29, 200, 6078 }, // ģ
-    { 25, 36, 26, 1, 36, 225, 6278 }, // Ĥ
-    { 19, 37, 22, 1, 37, 176, 6503 }, // ĥ
-    { 28, 27, 26, 1, 27, 189, 6679 }, // Ħ
-    { 19, 29, 22, 1, 29, 138, 6868 }, // ħ
-    { 19, 35, 12, -1, 35, 167, 7006 }, // Ĩ
-    { 14, 28, 10, 1, 28, 98, 7173 }, // ĩ
-    { 17, 33, 12, -1, 33, 141, 7271 }, // Ī
-    { 12, 26, 10, 1, 26, 78, 7412 }, // ī
-    { 18, 35, 12, -1, 35, 158, 7490 }, // Ĭ
-    { 13, 28, 10, 1, 28, 91, 7648 }, // ĭ
-    { 16, 36, 12, -1, 27, 144, 7739 }, // Į
-    { 13, 37, 10, -2, 28, 121, 7883 }, // į
-    { 16, 35, 12, -1, 35, 140, 8004 }, // İ
-    { 8, 21, 10, 1, 21, 42, 8144 }, // ı
-    { 24, 35, 22, -1, 27, 210, 8186 }, // Ĳ
-    { 19, 37, 19, 1, 28, 176, 8396 }, // ĳ
-    { 21, 44, 10, -6, 36, 231, 8572 }, // Ĵ
-    { 19, 38, 10, -5, 29, 181, 8803 }, // ĵ
-    { 24, 36, 21, 1, 27, 216, 8984 }, // Ķ
-    { 19, 38, 19, 1, 29, 181, 9200 }, // ķ
-    { 19, 21, 19, 1, 21, 100, 9381 }, // ĸ
-    { 15, 36, 18, 1, 36, 135, 9481 }, // Ĺ
-    { 15, 37, 10, 1, 37, 139, 9616 }, // ĺ
-    { 15, 36, 18, 1, 27, 135, 9755 }, // Ļ
-    { 13, 38, 10, -2, 29, 124, 9890 }, // ļ
-    { 19, 27, 18, 1, 27, 129, 10014 }, // Ľ
-    { 16, 29, 11, 1, 29, 116, 10143 }, // ľ
-    { 16, 27, 18, 1, 27, 108, 10259 }, // Ŀ
-    { 13, 29, 11, 1, 29, 95, 10367 }, // ŀ
-    { 16, 27, 18, 0, 27, 108, 10462 }, // Ł
-    { 11, 29, 10, 0, 29, 80, 10570 }, // ł
-    { 26, 36, 27, 1, 36, 234, 10650 }, // Ń
-    { 20, 29, 22, 0, 29, 145, 10884 }, // ń
-    { 26, 36, 27, 1, 27, 234, 11029 }, // Ņ
-    { 20, 30, 22, 0, 21, 150, 11263 }, // ņ
-    { 26, 36, 27, 1, 36, 234, 11413 }, // Ň
-    { 21, 29, 22, 0, 29, 153, 11647 }, // ň
-    { 22, 27, 25, 1, 27, 149, 11800 }, // ŉ
-    { 26, 35, 27, 1, 27, 228, 11949 }, // Ŋ
-    { 19, 30, 22, 1, 21, 143, 12177 }, // ŋ
-    { 24, 34, 27, 2, 33, 204, 12320 }, // Ō
-    { 19, 27, 21, 1, 26, 129, 12524 }, // ō
-    { 24, 36, 27, 2, 35, 216, 12653 }, // Ŏ
-    { 19, 29, 21, 1, 28, 138, 12869 }, // ŏ
-    { 26, 37, 27, 2, 36, 241, 13007 }, // Ő
-    { 22, 30, 21, 1, 29, 165, 13248 }, // ő
-    { 32, 29, 32, 2, 28, 232, 13413 }, // Œ
-    { 31, 22, 32, 1, 21, 171, 13645 }, // œ
-    { 21, 36, 21, 1, 36, 189, 13816 }, // Ŕ
-    { 17, 29, 15, 1, 29, 124, 14005 }, // ŕ
-    { 21, 36, 21, 1, 27, 189, 14129 }, // Ŗ
-    { 19, 30, 15, -2, 21, 143, 14318 }, // ŗ
-    { 21, 36, 21, 1, 36, 189, 14461 }, // Ř
-    { 18, 29, 15, 1, 29, 131, 14650 }, // ř
-    { 20, 37, 19, 0, 36, 185, 14781 }, // Ś
-    { 17, 30, 16, 0, 29, 128, 14966 }, // ś
-    { 20, 37, 19, 0, 36, 185, 15094 }, // Ŝ
-    { 16, 30, 16, 0, 29, 120, 15279 }, // ŝ
-    { 20, 37, 19, 0, 28, 185, 15399 }, // Ş
-    { 16, 30, 16, 0, 21, 120, 15584 }, // ş
-    { 20, 37, 19, 0, 36, 185, 15704 }, // Š
-    { 18, 30, 16, 0, 29, 135, 15889 }, // š
-    { 21, 36, 19, 2, 27, 189, 16024 }, // Ţ
-    { 13, 34, 12, 1, 25, 111, 16213 }, // ţ
-    { 20, 36, 19, 3, 36, 180, 16324 }, // Ť
-    { 16, 30, 12, 1, 29, 120, 16504 }, // ť
-    { 20, 27, 19, 3, 27, 135, 16624 }, // Ŧ
-    { 14, 26, 12, 0, 25, 91, 16759 }, // ŧ
-    { 24, 36, 25, 2, 35, 216, 16850 }, // Ũ
-    { 19, 29, 22, 2, 28, 138, 17066 }, // ũ
-    { 24, 34, 25, 2, 33, 204, 17204 }, // Ū
-    { 19, 27, 22, 2, 26, 129, 17408 }, // ū
-    { 24, 36, 25, 2, 35, 216, 17537 }, // Ŭ
-    { 19, 29, 22, 2, 28, 138, 17753 }, // ŭ
-    { 24, 39, 25, 2, 38, 234, 17891 }, // Ů
-    { 19, 32, 22, 2, 31, 152, 18125 }, // ů
-    { 25, 37, 25, 2, 36, 232, 18277 }, // Ű
-    { 21, 30, 22, 2, 29, 158, 18509 }, // ű
-    { 24, 36, 25, 2, 27, 216, 18667 }, // Ų
-    { 19, 30, 22, 2, 21, 143, 18883 }, // ų
-    { 32, 36, 32, 4, 36, 288, 19026 }, // Ŵ
-    { 27, 29, 27, 2, 29, 196, 19314 }, // ŵ
-    { 20, 36, 19, 3, 36, 180, 19510 }, // Ŷ
-    { 24, 38, 18, -4, 29, 228, 19690 }, // ŷ
-    { 20, 35, 19, 3, 35, 175, 19918 }, // Ÿ
-    { 23, 36, 20, -1, 36, 207, 20093 }, // Ź
-    { 19, 29, 17, -1, 29, 138, 20300 }, // ź
-    { 23, 35, 20, -1, 35, 202, 20438 }, // Ż
-    { 18, 28, 17, -1, 28, 126, 20640 }, // ż
-    { 23, 36, 20, -1, 36, 207, 20766 }, // Ž
-    { 19, 29, 17, -1, 29, 138, 20973 }, // ž
-    { 22, 38, 11, -5, 29, 209, 21111 }, // ſ
-    { 7, 7, 0, -15, 29, 13, 0 }, // ̀
-    { 9, 7, 0, -9, 29, 16, 13 }, // ́
-    { 13, 7, 0, -4, 29, 23, 29 }, // ̂
-    { 15, 6, 0, -16, 28, 23, 52 }, // ̃
-    { 12, 4, 0, -3, 26, 12, 75 }, // ̄
-    { 16, 4, 0, -4, 32, 16, 87 }, // ̅
-    { 11, 6, 0, -2, 28, 17, 103 }, // ̆
-    { 5, 5, 0, 1, 28, 7, 120 }, // ̇
-    { 11, 5, 0, -2, 28, 14, 127 }, // ̈
-    { 7, 9, 0, -11, 31, 16, 141 }, // ̉
-    { 9, 9, 0, -1, 31, 21, 157 }, // ̊
-    { 15, 7, 0, -3, 29, 27, 178 }, // ̋
-    { 12, 7, 0, -2, 29, 21, 205 }, // ̌
-    { 6, 11, 0, 0, 29, 17, 226 }, // ̍
-    { 11, 7, 0, -2, 29, 20, 243 }, // ̎
-    { 14, 7, 0, -19, 29, 25, 263 }, // ̏
-    { 12, 10, 0, -2, 32, 30, 288 }, // ̐
-    { 12, 6, 0, -3, 28, 18, 318 }, // ̑
-    { 9, 10, 0, -2, 27, 23, 336 }, // ̒
-    { 9, 10, 0, -2, 27, 23, 359 }, // ̓
-    { 5, 10, 0, 0, 27, 13, 382 }, // ̔
-    { 9, 10, 0, -2, 27, 23, 395 }, // ̕
-    { 7, 7, 0, -7, -1, 13, 418 }, // ̖
-    { 9, 7, 0, -6, -1, 16, 431 }, // ̗
-    { 9, 8, 0, -7, -1, 18, 447 }, // ̘
-    { 8, 8, 0, -7, -1, 16, 465 }, // ̙
-    { 12, 11, 12, 3, 29, 33, 481 }, // ̚
-    { 9, 9, 0, -2, 29, 21, 514 }, // ̛
-    { 6, 9, 0, -2, 0, 14, 535 }, // ̜
-    { 9, 7, 0, -8, -1, 16, 549 }, // ̝
-    { 9, 7, 0, -7, -1, 16, 565 }, // ̞
-    { 10, 8, 0, -8, -1, 20, 581 }, // ̟
-    { 10, 3, 0, -8, -3, 8, 601 }, // ̠
-    { 9, 11, 0, -8, 2, 25, 609 }, // ̡
-    { 7, 11, 0, -4, 2, 20, 634 }, // ̢
-    { 5, 5, 0, -16, -2, 7, 654 }, // ̣
-    { 12, 5, 0, -9, -2, 15, 661 }, // ̤
-    { 10, 9, 0, -8, 0, 23, 676 }, // ̥
-    { 7, 7, 0, 2, -2, 13, 699 }, // ̦
-    { 8, 9, 0, -7, 0, 18, 712 }, // ̧
-    { 7, 9, 0, -6, 0, 16, 730 }, // ̨
-    { 6, 11, 0, -6, -1, 17, 746 }, // ̩
-    { 16, 8, 0, -11, -1, 32, 763 }, // ̪
-    { 15, 5, 0, -10, -2, 19, 795 }, // ̫
-    { 12, 7, 0, -8, -1, 21, 814 }, // ̬
-    { 12, 7, 0, -9, -1, 21, 835 }, // ̭
-    { 12, 6, 0, -8, -2, 18, 856 }, // ̮
-    { 12, 6, 0, -9, -2, 18, 874 }, // ̯
-    { 14, 6, 0, -10, -2, 21, 892 }, // ̰
-    { 12, 4, 0, -9, -3, 12, 913 }, // ̱
-    { 17, 3, 0, -12, -3, 13, 925 }, // ̲
-    { 18, 9, 0, -12, 0, 41, 938 }, // ̳
-    { 14, 6, 0, -7, 13, 21, 979 }, // ̴
-    { 16, 4, 0, -8, 13, 16, 1000 }, // ̵
-    { 26, 3, 0, -13, 12, 20, 1016 }, // ̶
-    { 12, 9, 0, -6, 15, 27, 1036 }, // ̷
-    { 22, 32, 0, -11, 29, 176, 1063 }, // ̸
-    { 6, 9, 0, -3, 0, 14, 1239 }, // ̹
-    { 16, 8, 0, -11, -1, 32, 1253 }, // ̺
-    { 16, 8, 0, -11, -1, 32, 1285 }, // ̻
-    { 15, 5, 0, -10, -2, 19, 1317 }, // ̼
-    { 9, 9, 0, -1, 30, 21, 1336 }, // ̽
-    { 9, 12, 0, -1, 33, 27, 1357 }, // ̾
-    { 18, 9, 0, -4, 37, 41, 1384 }, // ̿
-    { 7, 7, 0, -2, 29, 13, 1425 }, // ̀
-    { 9, 7, 0, 1, 29, 16, 1438 }, // ́
-    { 14, 6, 0, 6, 28, 21, 1454 }, // ͂
-    { 6, 8, 0, 1, 30, 12, 1475 }, // ̓
-    { 15, 8, 0, -4, 30, 30, 1487 }, // ̈́
-    { 7, 6, 0, -5, -3, 11, 1517 }, // ͅ
-    { 17, 7, 0, -5, 29, 30, 1528 }, // ͆
-    { 17, 9, 0, -11, 0, 39, 1558 }, // ͇
-    { 11, 7, 0, -8, -1, 20, 1597 }, // ͈
-    { 8, 7, 0, -6, -2, 14, 1617 }, // ͉
-    { 15, 8, 0, -4, 29, 30, 1631 }, // ͊
-    { 15, 14, 0, -4, 35, 53, 1661 }, // ͋
-    { 16, 11, 0, -4, 33, 44, 1714 }, // ͌
-    { 14, 8, 0, -10, -1, 28, 1758 }, // ͍
-    { 7, 9, 0, -6, 0, 16, 1786 }, // ͎
-    { 28, 27, 0, -14, 27, 189, 1802 }, // ͏
-    { 7, 8, 0, 0, 30, 14, 1991 }, // ͐
-    { 6, 9, 0, 4, 31, 14, 2005 }, // ͑
-    { 11, 10, 0, -2, 32, 28, 2019 }, // ͒
-    { 8, 8, 0, -6, -1, 16, 2047 }, // ͓
-    { 7, 8, 0, -6, -1, 14, 2063 }, // ͔
-    { 7, 8, 0, -5, -1, 14, 2077 }, // ͕
-    { 15, 8, 0, -9, -1, 30, 2091 }, // ͖
-    { 5, 9, 0, 4, 31, 12, 2121 }, // ͗
-    { 5, 5, 0, 1, 28, 7, 2133 }, // ͘
-    { 9, 8, 0, -7, -1, 18, 2140 }, // ͙
-    { 15, 8, 0, -10, -1, 30, 2158 }, // ͚
-    { 8, 8, 0, 0, 30, 16, 2188 }, // ͛
-    { 28, 8, 0, -16, -1, 56, 2204 }, // ͜
-    { 28, 8, 0, -11, 30, 56, 2260 }, // ͝
-    { 20, 4, 0, -7, 26, 20, 2316 }, // ͞
-    { 20, 4, 0, -13, -2, 20, 2336 }, // ͟
-    { 29, 6, 0, -11, 28, 44, 2356 }, // ͠
-    { 27, 8, 0, -10, 33, 54, 2400 }, // ͡
-    { 28, 8, 0, -18, -1, 56, 2454 }, // ͢
-    { 10, 9, 0, -1, 32, 23, 2510 }, // ͣ
-    { 8, 9, 0, 0, 32, 18, 2533 }, // ͤ
-    { 6, 12, 0, 1, 35, 18, 2551 }, // ͥ
-    { 9, 9, 0, -1, 32, 21, 2569 }, // ͦ
-    { 10, 9, 0, -1, 32, 23, 2590 }, // ͧ
-    { 8, 9, 0, 0, 32, 18, 2613 }, // ͨ
-    { 10, 12, 0, -1, 35, 30, 2631 }, // ͩ
-    { 9, 12, 0, -1, 35, 27, 2661 }, // ͪ
-    { 15, 9, 0, -4, 32, 34, 2688 }, // ͫ
-    { 8, 9, 0, 0, 32, 18, 2722 }, // ͬ
-    { 7, 11, 0, 1, 34, 20, 2740 }, // ͭ
-    { 9, 9, 0, 0, 32, 21, 2760 }, // ͮ
-    { 11, 9, 0, -2, 32, 25, 2781 }, // ͯ
-    { 20, 36, 19, 1, 36, 180, 0 }, // Ѐ
-    { 20, 34, 19, 1, 34, 170, 180 }, // Ё
-    { 20, 28, 25, 3, 27, 140, 350 }, // Ђ
-    { 20, 36, 18, 1, 36, 180, 490 }, // Ѓ
-    { 22, 29, 22, 2, 28, 160, 670 }, // Є
-    { 20, 29, 19, 0, 28, 145, 830 }, // Ѕ
-    { 10, 27, 10, 1, 27, 68, 975 }, // І
-    { 13, 34, 10, 1, 34, 111, 1043 }, // Ї
-    { 17, 35, 10, -6, 27, 149, 1154 }, // Ј
-    { 36, 28, 35, -2, 27, 252, 1303 }, // Љ
-    { 32, 27, 35, 1, 27, 216, 1555 }, // Њ
-    { 21, 27, 26, 3, 27, 142, 1771 }, // Ћ
-    { 24, 36, 21, 1, 36, 216, 1913 }, // Ќ
-    { 25, 36, 26, 1, 36, 225, 2129 }, // Ѝ
-    { 25, 36, 21, 0, 35, 225, 2354 }, // Ў
-    { 24, 33, 25, 1, 27, 198, 2579 }, // Џ
-    { 23, 27, 21, -3, 27, 156, 2777 }, // А
-    { 21, 27, 21, 1, 27, 142, 2933 }, // Б
-    { 21, 27, 22, 1, 27, 142, 3075 }, // В
-    { 20, 27, 18, 1, 27, 135, 3217 }, // Г
-    { 30, 33, 26, -4, 27, 248, 3352 }, // Д
-    { 20, 27, 19, 1, 27, 135, 3600 }, // Е
-    { 36, 27, 30, -2, 27, 243, 3735 }, // Ж
-    { 21, 29, 20, -1, 28, 153, 3978 }, // З
-    { 25, 27, 26, 1, 27, 169, 4131 }, // И
-    { 25, 35, 26, 1, 35, 219, 4300 }, // Й
-    { 24, 27, 21, 1, 27, 162, 4519 }, // К
-    { 28, 28, 25, -2, 27, 196, 4681 }, // Л
-    { 31, 27, 31, 1, 27, 210, 4877 }, // М
-    { 25, 27, 25, 1, 27, 169, 5087 }, // Н
-    { 24, 29, 26, 2, 28, 174, 5256 }, // О
-    { 25, 27, 25, 1, 27, 169, 5430 }, // П
-    { 21, 27, 21, 1, 27, 142, 5599 }, // Р
-    { 22, 29, 22, 2, 28, 160, 5741 }, // С
-    { 20, 27, 20, 3, 27, 135, 5901 }, // Т
-    { 25, 28, 21, 0, 27, 175, 6036 }, // У
-    { 27, 29, 30, 2, 28, 196, 6211 }, // Ф
-    { 25, 27, 20, -2, 27, 169, 6407 }, // Х
-    { 25, 33, 25, 1, 27, 207, 6576 }, // Ц
-    { 21, 27, 23, 3, 27, 142, 6783 }, // Ч
-    { 35, 27, 36, 1, 27, 237, 6925 }, // Ш
-    { 35, 33, 36, 1, 27, 289, 7162 }, // Щ
-    { 20, 27, 24, 3, 27, 135, 7451 }, // Ъ
-    { 29, 27, 30, 1, 27, 196, 7586 }, // Ы
-    { 18, 27, 21, 1, 27, 122, 7782 }, // Ь
-    { 22, 29, 22, 0, 28, 160, 7904 }, // Э
-    { 34, 29, 35, 1, 28, 247, 8064 }, // Ю
-    { 24, 27, 22, -2, 27, 162, 8311 }, // Я
-    { 20, 22, 21, 1, 21, 110, 8473 }, // а
-    { 21, 30, 21, 1, 29, 158, 8583 }, // б
-    { 18, 22, 19, 1, 21, 99, 8741 }, // в
-    { 17, 22, 17, 0, 21, 94, 8840 }, // г
-    { 20, 30, 21, 1, 29, 150, 8934 }, // д
-    { 17, 22, 18, 1, 21, 94, 9084 }, // е
-    { 35, 22, 33, -1, 21, 193, 9178 }, // ж
-    { 16, 22, 17, 0, 21, 88, 9371 }, // з
-    { 20, 22, 21, 1, 21, 110, 9459 }, // и
-    { 20, 29, 21, 1, 28, 145, 9569 }, // й
-    { 21, 21, 19, 0, 21, 111, 9714 }, // к
-    { 23, 22, 21, -2, 21, 127, 9825 }, // л
-    { 28, 21, 28, 0, 21, 147, 9952 }, // м
-    { 21, 21, 21, 0, 21, 111, 10099 }, // н
-    { 19, 22, 21, 1, 21, 105, 10210 }, // о
-    { 20, 21, 21, 0, 21, 105, 10315 }, // п
-    { 22, 30, 21, -2, 21, 165, 10420 }, // р
-    { 17, 22, 17, 1, 21, 94, 10585 }, // с
-    { 31, 21, 32, 0, 21, 163, 10679 }, // т
-    { 24, 30, 18, -4, 21, 180, 10842 }, // у
-    { 23, 38, 25, 1, 29, 219, 11022 }, // ф
-    { 21, 21, 17, -2, 21, 111, 11241 }, // х
-    { 20, 27, 22, 1, 21, 135, 11352 }, // ц
-    { 18, 21, 21, 2, 21, 95, 11487 }, // ч
-    { 31, 22, 32, 1, 21, 171, 11582 }, // ш
-    { 31, 27, 33, 1, 21, 210, 11753 }, // щ
-    { 20, 22, 22, 1, 21, 110, 11963 }, // ъ
-    { 26, 22, 27, 1, 21, 143, 12073 }, // ы
-    { 17, 22, 19, 1, 21, 94, 12216 }, // ь
-    { 16, 22, 18, 1, 21, 88, 12310 }, // э
-    { 27, 22, 29, 1, 21, 149, 12398 }, // ю
-    { 21, 21, 19, -2, 21, 111, 12547 }, // я
-    { 17, 30, 18, 1, 29, 128, 12658 }, // ѐ
-    { 18, 29, 18, 1, 28, 131, 12786 }, // ё
-    { 19, 38, 22, 1, 29, 181, 12917 }, // ђ
-    { 17, 30, 17, 0, 29, 128, 13098 }, // ѓ
-    { 17, 22, 17, 1, 21, 94, 13226 }, // є
-    { 16, 22, 16, 0, 21, 88, 13320 }, // ѕ
-    { 10, 28, 10, 1, 28, 70, 13408 }, // і
-    { 13, 28, 9, 0, 28, 91, 13478 }, // ї
-    { 16, 37, 9, -5, 28, 148, 13569 }, // ј
-    { 31, 22, 31, -2, 21, 171, 13717 }, // љ
-    { 29, 22, 30, 0, 21, 160, 13888 }, // њ
-    { 19, 29, 22, 1, 29, 138, 14048 }, // ћ
-    { 21, 29, 19, 0, 29, 153, 14186 }, // ќ
-    { 20, 30, 21, 1, 29, 150, 14339 }, // ѝ
-    { 24, 37, 18, -4, 28, 222, 14489 }, // ў
-    { 20, 29, 21, 1, 21, 145, 14711 }, // џ
-    { 35, 28, 34, 3, 27, 245, 14856 }, // Ѡ
-    { 29, 21, 30, 2, 21, 153, 15101 }, // ѡ
-    { 18, 27, 22, 2, 27, 122, 15254 }, // Ѣ
-    { 29, 22, 31, 0, 21, 160, 15376 }, // ѣ
-    { 34, 29, 32, 1, 28, 247, 15536 }, // Ѥ
-    { 26, 22, 26, 1, 21, 143, 15783 }, // ѥ
-    { 24, 27, 23, -3, 27, 162, 15926 }, // Ѧ
-    { 20, 21, 20, -2, 21, 105, 16088 }, // ѧ
-    { 29, 27, 32, 1, 27, 196, 16193 }, // Ѩ
-    { 25, 21, 27, 1, 21, 132, 16389 }, // ѩ
-    { 28, 27, 25, -2, 27, 189, 16521 }, // Ѫ
-    { 25, 21, 23, -3, 21, 132, 16710 }, // ѫ
-    { 35, 27, 35, 1, 27, 237, 16842 }, // Ѭ
-    { 29, 21, 30, 1, 21, 153, 17079 }, // ѭ
-    { 22, 40, 20, -2, 32, 220, 17232 }, // Ѯ
-    { 19, 33, 17, -2, 25, 157, 17452 }, // ѯ
-    { 27, 27, 28, 4, 27, 183, 17609 }, // Ѱ
-    { 23, 38, 27, 2, 29, 219, 17792 }, // ѱ
-    { 24, 29, 27, 2, 28, 174, 18011 }, // Ѳ
-    { 19, 22, 21, 1, 21, 105, 18185 }, // ѳ
-    { 23, 27, 21, 3, 27, 156, 18290 }, // Ѵ
-    { 19, 21, 17, 1, 21, 100, 18446 }, // ѵ
-    { 23, 36, 21, 3, 36, 207, 18546 }, // Ѷ
-    { 19, 29, 17, 1, 29, 138, 18753 }, // ѷ
-    { 45, 37, 45, 2, 28, 417, 18891 }, // Ѹ
-    { 40, 30, 39, 1, 21, 300, 19308 }, // ѹ
-    { 25, 33, 28, 2, 30, 207, 19608 }, // Ѻ
-    { 20, 26, 22, 1, 23, 130, 19815 }, // ѻ
-    { 33, 40, 36, 2, 39, 330, 19945 }, // Ѽ
-    { 28, 34, 30, 1, 33, 238, 20275 }, // ѽ
-    { 35, 35, 34, 3, 34, 307, 20513 }, // Ѿ
-    { 29, 27, 30, 2, 27, 196, 20820 }, // ѿ
-    { 22, 37, 22, 2, 28, 204, 21016 }, // Ҁ
-    { 17, 30, 17, 1, 21, 128, 21220 }, // ҁ
-    { 20, 25, 23, 2, 24, 125, 21348 }, // ҂
-    { 15, 6, 0, -15, 27, 23, 21473 }, // ҃
-    { 14, 6, 0, -15, 28, 21, 21496 }, // ҄
-    { 6, 8, 0, -11, 30, 12, 21517 }, // ҅
-    { 5, 8, 0, -10, 30, 10, 21529 }, // ҆
-    { 15, 6, 0, -3, 34, 23, 21539 }, // ҇
-    { 44, 40, 0, -22, 30, 440, 21562 }, // ҈
-    { 42, 42, 0, -21, 31, 441, 22002 }, // ҉
-    { 26, 43, 27, 1, 35, 280, 22443 }, // Ҋ
-    { 19, 36, 22, 2, 29, 171, 22723 }, // ҋ
-    { 18, 27, 21, 1, 27, 122, 22894 }, // Ҍ
-    { 16, 30, 20, 2, 29, 120, 23016 }, // ҍ
-    { 21, 27, 21, 1, 27, 142, 23136 }, // Ҏ
-    { 21, 30, 22, -1, 21, 158, 23278 }, // ҏ
-    { 21, 33, 18, 1, 33, 174, 23436 }, // Ґ
-    { 17, 26, 15, 1, 26, 111, 23610 }, // ґ
-    { 20, 27, 18, 1, 27, 135, 23721 }, // Ғ
-    { 17, 21, 15, 0, 21, 90, 23856 }, // ғ
-    { 20, 37, 23, 1, 27, 185, 23946 }, // Ҕ
-    { 16, 31, 19, 1, 21, 124, 24131 }, // ҕ
-    { 35, 35, 31, -2, 27, 307, 24255 }, // Җ
-    { 34, 28, 32, -1, 21, 238, 24562 }, // җ
-    { 21, 37, 20, -1, 28, 195, 24800 }, // Ҙ
-    { 16, 30, 17, 0, 21, 120, 24995 }, // ҙ
-    { 24, 35, 23, 1, 27, 210, 25115 }, // Қ
-    { 19, 28, 20, 1, 21, 133, 25325 }, // қ
-    { 24, 27, 22, 1, 27, 162, 25458 }, // Ҝ
-    { 20, 21, 18, 1, 21, 105, 25620 }, // ҝ
-    { 24, 27, 21, 1, 27, 162, 25725 }, // Ҟ
-    { 19, 29, 18, 1, 29, 138, 25887 }, // ҟ
-    { 25, 27, 24, 3, 27, 169, 26025 }, // Ҡ
-    { 22, 21, 21, 1, 21, 116, 26194 }, // ҡ
-    { 25, 35, 26, 1, 27, 219, 26310 }, // Ң
-    { 21, 28, 23, 1, 21, 147, 26529 }, // ң
-    { 31, 27, 28, 1, 27, 210, 26676 }, // Ҥ
-    { 27, 21, 26, 1, 21, 142, 26886 }, // ҥ
-    { 34, 37, 38, 1, 27, 315, 27028 }, // Ҧ
-    { 28, 31, 31, 1, 21, 217, 27343 }, // ҧ
-    { 24, 30, 27, 2, 28, 180, 27560 }, // Ҩ
-    { 20, 23, 23, 1, 21, 115, 27740 }, // ҩ
-    { 22, 37, 22, 2, 28, 204, 27855 }, // Ҫ
-    { 17, 30, 17, 1, 21, 128, 28059 }, // ҫ
-    { 20, 35, 19, 3, 27, 175, 28187 }, // Ҭ
-    { 31, 28, 33, 1, 21, 217, 28362 }, // ҭ
-    { 20, 27, 19, 3, 27, 135, 28579 }, // Ү
-    { 19, 30, 18, 1, 21, 143, 28714 }, // ү
-    { 22, 27, 19, 1, 27, 149, 28857 }, // Ұ
-    { 21, 30, 18, -1, 21, 158, 29006 }, // ұ
-    { 25, 35, 22, -2, 27, 219, 29164 }, // Ҳ
-    { 22, 28, 20, -1, 21, 154, 29383 }, // ҳ
-    { 27, 35, 29, 3, 27, 237, 29537 }, // Ҵ
-    { 23, 28, 25, 1, 21, 161, 29774 }, // ҵ
-    { 21, 35, 24, 4, 27, 184, 29935 }, // Ҷ
-    { 18, 28, 21, 2, 21, 126, 30119 }, // ҷ
-    { 21, 27, 24, 4, 27, 142, 30245 }, // Ҹ
-    { 18, 21, 21, 2, 21, 95, 30387 }, // ҹ
-    { 21, 27, 24, 1, 27, 142, 30482 }, // Һ
-    { 19, 29, 22, 1, 29, 138, 30624 }, // һ
-    { 27, 29, 29, 2, 28, 196, 30762 }, // Ҽ
-    { 21, 22, 22, 1, 21, 116, 30958 }, // ҽ
-    { 27, 36, 29, 2, 28, 243, 31074 }, // Ҿ
-    { 21, 28, 22, 1, 21, 147, 31317 }, // ҿ
-    { 16, 27, 12, -1, 27, 108, 31464 }, // Ӏ
-    { 36, 35, 30, -2, 35, 315, 31572 }, // Ӂ
-    { 35, 29, 33, -1, 28, 254, 31887 }, // ӂ
-    { 24, 37, 24, 1, 27, 222, 32141 }, // Ӄ
-    { 19, 31, 20, 1, 21, 148, 32363 }, // ӄ
-    { 27, 35, 25, -2, 27, 237, 32511 }, // Ӆ
-    { 22, 28, 21, -2, 21, 154, 32748 }, // ӆ
-    { 25, 37, 26, 1, 27, 232, 32902 }, // Ӈ
-    { 21, 31, 23, 1, 21, 163, 33134 }, // ӈ
-    { 25, 35, 26, 1, 27, 219, 33297 }, // Ӊ
-    { 21, 28, 23, 1, 21, 147, 33516 }, // ӊ
-    { 21, 35, 24, 4, 27, 184, 33663 }, // Ӌ
-    { 18, 28, 22, 3, 21, 126, 33847 }, // ӌ
-    { 31, 35, 32, 1, 27, 272, 33973 }, // Ӎ
-    { 25, 28, 26, 1, 21, 175, 34245 }, // ӎ
-    { 16, 27, 12, -1, 27, 108, 34420 }, // ӏ
-    { 25, 35, 21, -3, 35, 219, 34528 }, // Ӑ
-    { 20, 29, 21, 1, 28, 145, 34747 }, // ӑ
-    { 24, 35, 21, -3, 35, 210, 34892 }, // Ӓ
-    { 20, 29, 21, 1, 28, 145, 35102 }, // ӓ
-    { 36, 27, 31, -3, 27, 243, 35247 }, // Ӕ
-    { 29, 22, 31, 1, 21, 160, 35490 }, // ӕ
-    { 21, 35, 19, 1, 35, 184, 35650 }, // Ӗ
-    { 19, 29, 19, 1, 28, 138, 35834 }, // ӗ
-    { 23, 29, 25, 1, 28, 167, 35972 }, // Ә
-    { 17, 22, 18, 0, 21, 94, 36139 }, // ә
-    { 23, 36, 25, 1, 35, 207, 36233 }, // Ӛ
-    { 18, 29, 18, 0, 28, 131, 36440 }, // ӛ
-    { 36, 35, 30, -2, 35, 315, 36571 }, // Ӝ
-    { 35, 29, 33, -1, 28, 254, 36886 }, // ӝ
-    { 21, 35, 20, -1, 34, 184, 37140 }, // Ӟ
-    { 17, 29, 17, 0, 28, 124, 37324 }, // ӟ
-    { 21, 28, 20, 0, 27, 147, 37448 }, // Ӡ
-    { 20, 30, 17, -3, 21, 150, 37595 }, // ӡ
-    { 25, 33, 26, 1, 33, 207, 37745 }, // Ӣ
-    { 19, 27, 22, 2, 26, 129, 37952 }, // ӣ
-    { 25, 35, 26, 1, 35, 219, 38081 }, // Ӥ
-    { 19, 29, 22, 2, 28, 138, 38300 }, // ӥ
-    { 24, 36, 27, 2, 35, 216, 38438 }, // Ӧ
-    { 19, 29, 21, 1, 28, 138, 38654 }, // ӧ
-    { 24, 29, 27, 2, 28, 174, 38792 }, // Ө
-    { 19, 22, 21, 1, 21, 105, 38966 }, // ө
-    { 24, 35, 27, 2, 34, 210, 39071 }, // Ӫ
-    { 19, 29, 21, 1, 28, 138, 39281 }, // ӫ
-    { 22, 35, 22, 0, 34, 193, 39419 }, // Ӭ
-    { 16, 29, 18, 1, 28, 116, 39612 }, // ӭ
-    { 25, 34, 21, 0, 33, 213, 39728 }, // Ӯ
-    { 24, 35, 18, -4, 26, 210, 39941 }, // ӯ
-    { 25, 36, 21, 0, 35, 225, 40151 }, // Ӱ
-    { 24, 37, 18, -4, 28, 222, 40376 }, // ӱ
-    { 25, 37, 21, 0, 36, 232, 40598 }, // Ӳ
-    { 25, 38, 18, -4, 29, 238, 40830 }, // ӳ
-    { 21, 35, 23, 3, 35, 184, 41068 }, // Ӵ
-    { 18, 28, 21, 2, 28, 126, 41252 }, // ӵ
-    { 20, 35, 18, 1, 27, 175, 41378 }, // Ӷ
-    { 16, 28, 15, 1, 21, 112, 41553 }, // ӷ
-    { 29, 35, 30, 1, 35, 254, 41665 }, // Ӹ
-    { 26, 29, 27, 1, 28, 189, 41919 }, // ӹ
-    { 21, 35, 18, 0, 27, 184, 42108 }, // Ӻ
-    { 18, 29, 15, -1, 21, 131, 42292 }, // ӻ
-    { 25, 35, 20, -2, 27, 219, 42423 }, // Ӽ
-    { 22, 29, 18, -2, 21, 160, 42642 }, // ӽ
-    { 25, 27, 20, -2, 27, 169, 42802 }, // Ӿ
-    { 22, 21, 18, -2, 21, 116, 42971 }, // ӿ
-    { 0, 0, 19, 0, 0, 0, 0 }, //  
-    { 0, 0, 38, 0, 0, 0, 0 }, //  
-    { 0, 0, 19, 0, 0, 0, 0 }, //  
-    { 0, 0, 38, 0, 0, 0, 0 }, //  
-    { 0, 0, 12, 0, 0, 0, 0 }, //  
-    { 0, 0, 9, 0, 0, 0, 0 }, //  
-    { 0, 0, 6, 0, 0, 0, 0 }, //  
-    { 0, 0, 21, 0, 0, 0, 0 }, //  
-    { 0, 0, 10, 0, 0, 0, 0 }, //  
-    { 0, 0, 6, 0, 0, 0, 0 }, //  
-    { 0, 0, 4, 0, 0, 0, 0 }, //  
-    { 0, 0, 0, 0, 0, 0, 0 }, // ​
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‍
-    { 9, 31, 0, -1, 26, 70, 0 }, // ‎
-    { 9, 31, 0, -8, 26, 70, 70 }, // ‏
-    { 11, 4, 12, 0, 12, 11, 140 }, // ‐
-    { 11, 4, 12, 0, 12, 11, 151 }, // ‑
-    { 18, 3, 21, 2, 15, 14, 162 }, // ‒
-    { 17, 4, 18, 0, 12, 17, 176 }, // –
-    { 35, 4, 36, 0, 12, 35, 193 }, // —
-    { 35, 4, 36, 0, 12, 35, 228 }, // ―
-    { 12, 39, 21, 5, 29, 117, 263 }, // ‖
-    { 17, 9, 15, -4, 0, 39, 380 }, // ‗
-    { 8, 10, 7, 2, 27, 20, 419 }, // ‘
-    { 8, 10, 7, 2, 27, 20, 439 }, // ’
-    { 8, 10, 9, -2, 5, 20, 459 }, // ‚
-    { 4, 10, 7, 4, 27, 10, 479 }, // ‛
-    { 15, 10, 13, 2, 27, 38, 489 }, // “
-    { 15, 10, 13, 2, 27, 38, 527 }, // ”
-    { 15, 10, 16, -2, 5, 38, 565 }, // „
-    { 11, 10, 13, 4, 27, 28, 603 }, // ‟
-    { 15, 29, 18, 3, 29, 109, 631 }, // †
-    { 18, 29, 18, 1, 29, 131, 740 }, // ‡
-    { 9, 10, 14, 3, 19, 23, 871 }, // •
-    { 12, 12, 14, 2, 20, 36, 894 }, // ‣
-    { 5, 6, 19, 5, 5, 8, 930 }, // ․
-    { 15, 6, 19, 0, 5, 23, 938 }, // ‥
-    { 25, 6, 29, 0, 5, 38, 961 }, // …
-    { 6, 6, 10, 2, 13, 9, 999 }, // ‧
-    { 0, 0, 23, 0, 0, 0, 1008 }, //  
-    { 0, 0, 23, 0, 0, 0, 1008 }, //  
-    { 9, 28, 0, -1, 23, 63, 1008 }, // ‪
-    { 9, 28, 0, -8, 23, 63, 1071 }, // ‫
-    { 10, 31, 0, -5, 26, 78, 1134 }, // ‬
-    { 10, 31, 0, -5, 26, 78, 1212 }, // ‭
-    { 10, 31, 0, -5, 26, 78, 1290 }, // ‮
-    { 0, 0, 6, 0, 0, 0, 1368 }, //  
-    { 38, 29, 42, 3, 28, 276, 1368 }, // ‰
-    { 50, 29, 54, 3, 28, 363, 1644 }, // ‱
-    { 9, 10, 8, 2, 27, 23, 2007 }, // ′
-    { 16, 10, 15, 2, 27, 40, 2030 }, // ″
-    { 22, 10, 21, 2, 27, 55, 2070 }, // ‴
-    { 7, 10, 10, 4, 27, 18, 2125 }, // ‵
-    { 12, 10, 16, 4, 27, 30, 2143 }, // ‶
-    { 18, 10, 22, 4, 27, 45, 2173 }, // ‷
-    { 15, 13, 15, -4, 4, 49, 2218 }, // ‸
-    { 10, 16, 11, 1, 18, 40, 2267 }, // ‹
-    { 10, 16, 11, 0, 18, 40, 2307 }, // ›
-    { 29, 29, 31, 1, 28, 211, 2347 }, // ※
-    { 20, 28, 19, 0, 27, 140, 2558 }, // ‼
-    { 16, 29, 16, 2, 28, 116, 2698 }, // ‽
-    { 17, 4, 15, 3, 32, 17, 2814 }, // ‾
-    { 20, 8, 20, -2, -1, 40, 2831 }, // ‿
-    { 19, 9, 20, 3, 30, 43, 2871 }, // ⁀
-    { 18, 25, 13, -4, 16, 113, 2914 }, // ⁁
-    { 40, 34, 42, 0, 29, 340, 3027 }, // ⁂
-    { 10, 4, 11, 0, 12, 10, 3367 }, // ⁃
-    { 23, 27, 5, -9, 27, 156, 3377 }, // ⁄
-    { 15, 33, 11, -1, 27, 124, 3533 }, // ⁅
-    { 15, 33, 11, -3, 27, 124, 3657 }, // ⁆
-    { 32, 29, 32, 2, 28, 232, 3781 }, // ⁇
-    { 25, 29, 26, 2, 28, 182, 4013 }, // ⁈
-    { 27, 29, 26, 0, 28, 196, 4195 }, // ⁉
-    { 19, 21, 20, 2, 21, 100, 4391 }, // ⁊
-    { 20, 34, 22, 3, 29, 170, 4491 }, // ⁋
-    { 19, 20, 24, 2, 21, 95, 4661 }, // ⁌
-    { 19, 20, 24, 3, 21, 95, 4756 }, // ⁍
-    { 19, 18, 21, -1, 10, 86, 4851 }, // ⁎
-    { 8, 26, 10, 1, 21, 52, 4937 }, // ⁏
-    { 24, 39, 20, -2, 30, 234, 4989 }, // ⁐
-    { 22, 37, 21, 0, 29, 204, 5223 }, // ⁑
-    { 14, 29, 14, 0, 28, 102, 5427 }, // ⁒
-    { 33, 6, 38, 3, 14, 50, 5529 }, // ⁓
-    { 20, 9, 20, -4, 0, 45, 5579 }, // ⁔
-    { 20, 20, 21, 1, 19, 100, 5624 }, // ⁕
-    { 17, 29, 19, 1, 28, 124, 5724 }, // ⁖
-    { 28, 10, 27, 2, 27, 70, 5848 }, // ⁗
-    { 28, 29, 31, 1, 28, 203, 5918 }, // ⁘
-    { 29, 29, 31, 1, 28, 211, 6121 }, // ⁙
-    { 6, 29, 8, 1, 28, 44, 6332 }, // ⁚
-    { 22, 30, 25, 1, 29, 165, 6376 }, // ⁛
-    { 28, 29, 30, 1, 28, 203, 6541 }, // ⁜
-    { 6, 28, 10, 2, 27, 42, 6744 }, // ⁝
-    { 6, 29, 10, 3, 28, 44, 6786 }, // ⁞
-    { 0, 0, 8, 0, 0, 0, 6830 }, //  
-    { 0, 0, 23, 0, 0, 0, 6830 }, // ⁠
-    { 0, 0, 23, 0, 0, 0, 6830 }, // ⁡
-    { 0, 0, 23, 0, 0, 0, 6830 }, // ⁢
-    { 0, 0, 23, 0, 0, 0, 6830 }, // ⁣
-    { 0, 0, 23, 0, 0, 0, 6830 }, // ⁤
-    { 0, 0, 23, 0, 0, 0, 6830 }, // ⁦
-    { 0, 0, 23, 0, 0, 0, 6830 }, // ⁧
-    { 0, 0, 23, 0, 0, 0, 6830 }, // ⁨
-    { 0, 0, 23, 0, 0, 0, 6830 }, // ⁩
-    { 10, 31, 0, -5, 26, 78, 6830 }, // ⁪
-    { 10, 31, 0, -5, 26, 78, 6908 }, // ⁫
-    { 10, 31, 0, -5, 26, 78, 6986 }, // ⁬
-    { 10, 31, 0, -5, 26, 78, 7064 }, // ⁭
-    { 10, 31, 0, -5, 26, 78, 7142 }, // ⁮
-    { 10, 31, 0, -5, 26, 78, 7220 }, // ⁯
-    { 13, 18, 13, 3, 33, 59, 0 }, // ⁰
-    { 6, 18, 8, 3, 28, 27, 59 }, // ⁱ
-    { 13, 17, 13, 2, 32, 56, 86 }, // ⁴
-    { 13, 17, 13, 3, 32, 56, 142 }, // ⁵
-    { 13, 17, 13, 3, 32, 56, 198 }, // ⁶
-    { 13, 17, 13, 4, 32, 56, 254 }, // ⁷
-    { 13, 17, 13, 3, 32, 56, 310 }, // ⁸
-    { 13, 17, 13, 3, 32, 56, 366 }, // ⁹
-    { 11, 11, 13, 4, 28, 31, 422 }, // ⁺
-    { 11, 3, 13, 4, 24, 9, 453 }, // ⁻
-    { 11, 7, 13, 4, 26, 20, 462 }, // ⁼
-    { 9, 21, 7, 4, 34, 48, 482 }, // ⁽
-    { 9, 21, 7, 0, 34, 48, 530 }, // ⁾
-    { 13, 14, 14, 2, 24, 46, 578 }, // ⁿ
-    { 12, 18, 13, -1, 13, 54, 624 }, // ₀
-    { 8, 17, 13, 1, 12, 34, 678 }, // ₁
-    { 13, 17, 13, -2, 12, 56, 712 }, // ₂
-    { 13, 18, 13, -2, 13, 59, 768 }, // ₃
-    { 13, 17, 13, -2, 12, 56, 827 }, // ₄
-    { 13, 17, 13, -2, 12, 56, 883 }, // ₅
-    { 13, 17, 13, -1, 12, 56, 939 }, // ₆
-    { 13, 17, 13, -1, 12, 56, 995 }, // ₇
-    { 12, 17, 13, -1, 12, 51, 1051 }, // ₈
-    { 12, 17, 13, -1, 12, 51, 1102 }, // ₉
-    { 11, 11, 13, -1, 8, 31, 1153 }, // ₊
-    { 11, 3, 13, -1, 4, 9, 1184 }, // ₋
-    { 11, 7, 13, -1, 6, 20, 1193 }, // ₌
-    { 9, 21, 7, 0, 14, 48, 1213 }, // ₍
-    { 9, 21, 7, -5, 14, 48, 1261 }, // ₎
-    { 13, 13, 14, -1, 9, 43, 1309 }, // ₐ
-    { 11, 13, 12, -1, 9, 36, 1352 }, // ₑ
-    { 12, 13, 14, -1, 9, 39, 1388 }, // ₒ
-    { 14, 13, 12, -3, 9, 46, 1427 }, // ₓ
-    { 11, 13, 12, -2, 9, 36, 1473 }, // ₔ
-    { 13, 18, 16, 0, 14, 59, 1509 }, // ₕ
-    { 13, 18, 13, 0, 14, 59, 1568 }, // ₖ
-    { 7, 18, 9, 0, 14, 32, 1627 }, // ₗ
-    { 20, 13, 24, 0, 9, 65, 1659 }, // ₘ
-    { 13, 13, 14, -2, 9, 43, 1724 }, // ₙ
-    { 14, 18, 14, -3, 9, 63, 1767 }, // ₚ
-    { 10, 13, 12, -1, 9, 33, 1830 }, // ₛ
-    { 8, 16, 8, -1, 12, 32, 1863 }, // ₜ
-    { 20, 28, 21, 2, 28, 140, 0 }, // ₠
-    { 21, 32, 21, 2, 29, 168, 140 }, // ₡
-    { 20, 29, 21, 2, 28, 145, 308 }, // ₢
-    { 22, 27, 21, 0, 27, 149, 453 }, // ₣
-    { 23, 28, 21, -1, 28, 161, 602 }, // ₤
-    { 30, 30, 33, 1, 25, 225, 763 }, // ₥
-    { 22, 27, 21, 0, 27, 149, 988 }, // ₦
-    { 26, 28, 28, 1, 27, 182, 1137 }, // ₧
-    { 31, 28, 30, 0, 27, 217, 1319 }, // ₨
-    { 27, 27, 23, 0, 27, 183, 1536 }, // ₩
-    { 30, 27, 30, 1, 27, 203, 1719 }, // ₪
-    { 25, 35, 22, 0, 29, 219, 1922 }, // ₫
-    { 22, 29, 21, 1, 28, 160, 2141 }, // €
-    { 24, 27, 21, 1, 27, 162, 2301 }, // ₭
-    { 22, 27, 19, 1, 27, 149, 2463 }, // ₮
-    { 36, 37, 36, 0, 28, 333, 2612 }, // ₯
-    { 23, 37, 21, -2, 28, 213, 2945 }, // ₰
-    { 22, 27, 21, 1, 27, 149, 3158 }, // ₱
-    { 23, 32, 25, 2, 29, 184, 3307 }, // ₲
-    { 26, 27, 21, -3, 27, 176, 3491 }, // ₳
-    { 22, 29, 19, -1, 28, 160, 3667 }, // ₴
-    { 22, 32, 22, 2, 29, 176, 3827 }, // ₵
-    { 22, 26, 21, 1, 25, 143, 4003 }, // ₶
-    { 27, 31, 25, -1, 28, 210, 4146 }, // ₷
-    { 20, 27, 18, 2, 27, 135, 4356 }, // ₸
-    { 19, 27, 21, 3, 27, 129, 4491 }, // ₹
-    { 21, 28, 21, 0, 27, 147, 4620 }, // ₺
-    { 24, 29, 25, 2, 28, 174, 4767 }, // ₻
-    { 27, 27, 28, -1, 27, 183, 4941 }, // ₼
-    { 24, 27, 22, -1, 27, 162, 5124 }, // ₽
-    { 25, 31, 22, -1, 31, 194, 5286 }, // ₾
-    { 20, 35, 21, 1, 31, 175, 5480 }, // ₿
-    { 11, 4, 12, 0, 12, 11, 0 }, // −
-    { 35, 35, 38, 1, 29, 307, 0 }, // �
+    { 17, 16, 18, 1, 18, 68, 11415 }, // «
+    { 19, 11, 21, 2, 15, 53, 1017 }, // ¬
+    { 11, 4, 12, 0, 12, 11, 1070 }, // ­
+    { 29, 29, 31, 1, 28, 211, 1081 }, // ®
+    { 17, 4, 15, 3, 32, 17, 1292 }, // ¯
+    { 12, 13, 16, 2, 28, 39, 1309 }, // °
+    { 19, 23, 21, 2, 23, 110, 1348 }, // ±
+    { 13, 17, 13, 2, 32, 56, 1458 }, // ²
+    { 12, 18, 13, 3, 33, 54, 1514 }, // ³
+    { 9, 7, 10, 4, 29, 16, 1568 }, // ´
+    { 22, 30, 22, -1, 21, 165, 1584 }, // µ
+    { 20, 34, 25, 3, 29, 170, 1749 }, // ¶
+    { 5, 6, 10, 3, 16, 8, 1919 }, // ·
+    { 8, 9, 8, -4, 0, 18, 1927 }, // ¸
+    { 9, 17, 13, 5, 32, 39, 1945 }, // ¹
+    { 11, 14, 13, 3, 28, 39, 1984 }, // º
+    { 17, 16, 18, 0, 18, 68, 11483 }, // »
+    { 24, 28, 27, 3, 27, 168, 2023 }, // ¼
+    { 26, 28, 30, 3, 27, 182, 2191 }, // ½
+    { 27, 29, 30, 2, 28, 196, 2373 }, // ¾
+    { 15, 29, 16, -1, 21, 109, 2569 }, // ¿
+    { 23, 36, 21, -3, 36, 207, 11551 }, // À
+    { 24, 36, 21, -3, 36, 216, 11758 }, // Á
+    { 24, 36, 21, -3, 36, 216, 11974 }, // Â
+    { 25, 35, 21, -3, 35, 219, 2678 }, // Ã
+    { 24, 35, 21, -3, 35, 210, 12190 }, // Ä
+    { 23, 38, 21, -3, 38, 219, 2897 }, // Å
+    { 36, 27, 31, -3, 27, 243, 3116 }, // Æ
+    { 22, 37, 22, 2, 28, 204, 12400 }, // Ç
+    { 20, 36, 19, 1, 36, 180, 12604 }, // È
+    { 20, 36, 19, 1, 36, 180, 12784 }, // É
+    { 20, 36, 19, 1, 36, 180, 12964 }, // Ê
+    { 20, 35, 19, 1, 35, 175, 13144 }, // Ë
+    { 16, 36, 12, -1, 36, 144, 13319 }, // Ì
+    { 18, 36, 12, -1, 36, 162, 13463 }, // Í
+    { 17, 36, 12, -1, 36, 153, 13625 }, // Î
+    { 17, 35, 12, -1, 35, 149, 13778 }, // Ï
+    { 23, 27, 25, 1, 27, 156, 3359 }, // Ð
+    { 26, 35, 27, 1, 35, 228, 13927 }, // Ñ
+    { 24, 37, 27, 2, 36, 222, 14155 }, // Ò
+    { 24, 37, 27, 2, 36, 222, 14377 }, // Ó
+    { 24, 37, 27, 2, 36, 222, 14599 }, // Ô
+    { 24, 36, 27, 2, 35, 216, 3515 }, // Õ
+    { 24, 36, 27, 2, 35, 216, 14821 }, // Ö
+    { 17, 18, 21, 3, 22, 77, 3731 }, // ×
+    { 25, 31, 27, 2, 29, 194, 3808 }, // Ø
+    { 24, 37, 25, 2, 36, 222, 15037 }, // Ù
+    { 24, 37, 25, 2, 36, 222, 15259 }, // Ú
+    { 24, 37, 25, 2, 36, 222, 15481 }, // Û
+    { 24, 36, 25, 2, 35, 216, 15703 }, // Ü
+    { 20, 36, 19, 3, 36, 180, 4002 }, // Ý
+    { 20, 27, 21, 1, 27, 135, 4182 }, // Þ
+    { 26, 38, 22, -5, 29, 247, 4317 }, // ß
+    { 20, 30, 21, 1, 29, 150, 15919 }, // à
+    { 20, 30, 21, 1, 29, 150, 16069 }, // á
+    { 20, 30, 21, 1, 29, 150, 16219 }, // â
+    { 20, 29, 21, 1, 28, 145, 4564 }, // ã
+    { 20, 29, 21, 1, 28, 145, 16369 }, // ä
+    { 20, 32, 21, 1, 31, 160, 4709 }, // å
+    { 29, 22, 31, 1, 21, 160, 4869 }, // æ
+    { 17, 30, 17, 1, 21, 128, 16514 }, // ç
+    { 17, 30, 19, 1, 29, 128, 16642 }, // è
+    { 18, 30, 19, 1, 29, 135, 16770 }, // é
+    { 17, 30, 19, 1, 29, 128, 16905 }, // ê
+    { 17, 29, 19, 1, 28, 124, 17033 }, // ë
+    { 9, 29, 10, 1, 29, 66, 17157 }, // ì
+    { 13, 29, 10, 1, 29, 95, 17223 }, // í
+    { 12, 29, 10, 1, 29, 87, 17318 }, // î
+    { 13, 28, 10, 1, 28, 91, 17405 }, // ï
+    { 20, 30, 21, 1, 29, 150, 5029 }, // ð
+    { 21, 28, 22, 0, 28, 147, 17496 }, // ñ
+    { 19, 30, 21, 1, 29, 143, 17643 }, // ò
+    { 19, 30, 21, 1, 29, 143, 17786 }, // ó
+    { 19, 30, 21, 1, 29, 143, 17929 }, // ô
+    { 19, 29, 21, 1, 28, 138, 5179 }, // õ
+    { 19, 29, 21, 1, 28, 138, 18072 }, // ö
+    { 19, 18, 21, 2, 22, 86, 5317 }, // ÷
+    { 20, 24, 21, 1, 22, 120, 5403 }, // ø
+    { 19, 30, 22, 2, 29, 143, 18210 }, // ù
+    { 19, 30, 22, 2, 29, 143, 18353 }, // ú
+    { 19, 30, 22, 2, 29, 143, 18496 }, // û
+    { 19, 29, 22, 2, 28, 138, 18639 }, // ü
+    { 24, 38, 18, -4, 29, 228, 5523 }, // ý
+    { 21, 38, 22, -1, 29, 200, 5751 }, // þ
+    { 24, 37, 18, -4, 28, 222, 5951 }, // ÿ
+    { 24, 33, 21, -3, 33, 198, 6173 }, // Ā
+    { 20, 27, 21, 1, 26, 135, 6371 }, // ā
+    { 24, 35, 21, -3, 35, 210, 6506 }, // Ă
+    { 20, 29, 21, 1, 28, 145, 6716 }, // ă
+    { 23, 36, 21, -3, 27, 207, 6861 }, // Ą
+    { 20, 30, 21, 1, 21, 150, 7068 }, // ą
+    { 22, 37, 22, 2, 36, 204, 7218 }, // Ć
+    { 17, 30, 17, 1, 29, 128, 7422 }, // ć
+    { 22, 37, 22, 2, 36, 204, 7550 }, // Ĉ
+    { 17, 30, 17, 1, 29, 128, 7754 }, // ĉ
+    { 22, 36, 22, 2, 35, 198, 7882 }, // Ċ
+    { 17, 29, 17, 1, 28, 124, 8080 }, // ċ
+    { 22, 37, 22, 2, 36, 204, 8204 }, // Č
+    { 18, 30, 17, 1, 29, 135, 8408 }, // č
+    { 23, 36, 25, 1, 36, 207, 8543 }, // Ď
+    { 28, 30, 23, 1, 29, 210, 8750 }, // ď
+    { 23, 27, 25, 1, 27, 156, 8960 }, // Đ
+    { 24, 30, 22, 1, 29, 180, 9116 }, // đ
+    { 20, 33, 19, 1, 33, 165, 9296 }, // Ē
+    { 17, 27, 19, 1, 26, 115, 9461 }, // ē
+    { 20, 35, 19, 1, 35, 175, 9576 }, // Ĕ
+    { 18, 29, 19, 1, 28, 131, 9751 }, // ĕ
+    { 20, 35, 19, 1, 35, 175, 9882 }, // Ė
+    { 17, 29, 19, 1, 28, 124, 10057 }, // ė
+    { 20, 36, 19, 1, 27, 180, 10181 }, // Ę
+    { 17, 30, 19, 1, 21, 128, 10361 }, // ę
+    { 21, 36, 19, 1, 36, 189, 10489 }, // Ě
+    { 19, 30, 19, 1, 29, 143, 10678 }, // ě
+    { 23, 37, 25, 2, 36, 213, 10821 }, // Ĝ
+    { 21, 38, 22, 0, 29, 200, 11034 }, // ĝ
+    { 23, 36, 25, 2, 35, 207, 11234 }, // Ğ
+    { 21, 37, 22, 0, 28, 195, 11441 }, // ğ
+    { 23, 36, 25, 2, 35, 207, 11636 }, // Ġ
+    { 21, 37, 22, 0, 28, 195, 11843 }, // ġ
+    { 23, 37, 25, 2, 28, 213, 12038 }, // Ģ
+    { 21, 38, 22, 0, 29, 200, 12251 }, // ģ
+    { 25, 36, 26, 1, 36, 225, 12451 }, // Ĥ
+    { 19, 37, 22, 1, 37, 176, 12676 }, // ĥ
+    { 28, 27, 26, 1, 27, 189, 12852 }, // Ħ
+    { 19, 29, 22, 1, 29, 138, 13041 }, // ħ
+    { 19, 35, 12, -1, 35, 167, 13179 }, // Ĩ
+    { 14, 28, 10, 1, 28, 98, 13346 }, // ĩ
+    { 17, 33, 12, -1, 33, 141, 13444 }, // Ī
+    { 12, 26, 10, 1, 26, 78, 13585 }, // ī
+    { 18, 35, 12, -1, 35, 158, 13663 }, // Ĭ
+    { 13, 28, 10, 1, 28, 91, 13821 }, // ĭ
+    { 16, 36, 12, -1, 27, 144, 13912 }, // Į
+    { 13, 37, 10, -2, 28, 121, 14056 }, // į
+    { 16, 35, 12, -1, 35, 140, 14177 }, // İ
+    { 8, 21, 10, 1, 21, 42, 14317 }, // ı
+    { 24, 35, 22, -1, 27, 210, 14359 }, // Ĳ
+    { 19, 37, 19, 1, 28, 176, 14569 }, // ĳ
+    { 21, 44, 10, -6, 36, 231, 14745 }, // Ĵ
+    { 19, 38, 10, -5, 29, 181, 14976 }, // ĵ
+    { 24, 36, 21, 1, 27, 216, 15157 }, // Ķ
+    { 19, 38, 19, 1, 29, 181, 15373 }, // ķ
+    { 19, 21, 19, 1, 21, 100, 15554 }, // ĸ
+    { 15, 36, 18, 1, 36, 135, 15654 }, // Ĺ
+    { 15, 37, 10, 1, 37, 139, 15789 }, // ĺ
+    { 15, 36, 18, 1, 27, 135, 15928 }, // Ļ
+    { 13, 38, 10, -2, 29, 124, 16063 }, // ļ
+    { 19, 27, 18, 1, 27, 129, 16187 }, // Ľ
+    { 16, 29, 11, 1, 29, 116, 16316 }, // ľ
+    { 16, 27, 18, 1, 27, 108, 16432 }, // Ŀ
+    { 13, 29, 11, 1, 29, 95, 16540 }, // ŀ
+    { 16, 27, 18, 0, 27, 108, 16635 }, // Ł
+    { 11, 29, 10, 0, 29, 80, 16743 }, // ł
+    { 26, 36, 27, 1, 36, 234, 16823 }, // Ń
+    { 20, 29, 22, 0, 29, 145, 17057 }, // ń
+    { 26, 36, 27, 1, 27, 234, 17202 }, // Ņ
+    { 20, 30, 22, 0, 21, 150, 17436 }, // ņ
+    { 26, 36, 27, 1, 36, 234, 17586 }, // Ň
+    { 21, 29, 22, 0, 29, 153, 17820 }, // ň
+    { 22, 27, 25, 1, 27, 149, 17973 }, // ŉ
+    { 26, 35, 27, 1, 27, 228, 18122 }, // Ŋ
+    { 19, 30, 22, 1, 21, 143, 18350 }, // ŋ
+    { 24, 34, 27, 2, 33, 204, 18493 }, // Ō
+    { 19, 27, 21, 1, 26, 129, 18697 }, // ō
+    { 24, 36, 27, 2, 35, 216, 18826 }, // Ŏ
+    { 19, 29, 21, 1, 28, 138, 19042 }, // ŏ
+    { 26, 37, 27, 2, 36, 241, 19180 }, // Ő
+    { 22, 30, 21, 1, 29, 165, 19421 }, // ő
+    { 32, 29, 32, 2, 28, 232, 18777 }, // Œ
+    { 31, 22, 32, 1, 21, 171, 19009 }, // œ
+    { 21, 36, 21, 1, 36, 189, 19586 }, // Ŕ
+    { 17, 29, 15, 1, 29, 124, 19775 }, // ŕ
+    { 21, 36, 21, 1, 27, 189, 19899 }, // Ŗ
+    { 19, 30, 15, -2, 21, 143, 20088 }, // ŗ
+    { 21, 36, 21, 1, 36, 189, 20231 }, // Ř
+    { 18, 29, 15, 1, 29, 131, 20420 }, // ř
+    { 20, 37, 19, 0, 36, 185, 20551 }, // Ś
+    { 17, 30, 16, 0, 29, 128, 20736 }, // ś
+    { 20, 37, 19, 0, 36, 185, 20864 }, // Ŝ
+    { 16, 30, 16, 0, 29, 120, 21049 }, // ŝ
+    { 20, 37, 19, 0, 28, 185, 21169 }, // Ş
+    { 16, 30, 16, 0, 21, 120, 21354 }, // ş
+    { 20, 37, 19, 0, 36, 185, 21474 }, // Š
+    { 18, 30, 16, 0, 29, 135, 21659 }, // š
+    { 21, 36, 19, 2, 27, 189, 21794 }, // Ţ
+    { 13, 34, 12, 1, 25, 111, 21983 }, // ţ
+    { 20, 36, 19, 3, 36, 180, 22094 }, // Ť
+    { 16, 30, 12, 1, 29, 120, 22274 }, // ť
+    { 20, 27, 19, 3, 27, 135, 22394 }, // Ŧ
+    { 14, 26, 12, 0, 25, 91, 22529 }, // ŧ
+    { 24, 36, 25, 2, 35, 216, 22620 }, // Ũ
+    { 19, 29, 22, 2, 28, 138, 22836 }, // ũ
+    { 24, 34, 25, 2, 33, 204, 22974 }, // Ū
+    { 19, 27, 22, 2, 26, 129, 23178 }, // ū
+    { 24, 36, 25, 2, 35, 216, 23307 }, // Ŭ
+    { 19, 29, 22, 2, 28, 138, 23523 }, // ŭ
+    { 24, 39, 25, 2, 38, 234, 23661 }, // Ů
+    { 19, 32, 22, 2, 31, 152, 23895 }, // ů
+    { 25, 37, 25, 2, 36, 232, 24047 }, // Ű
+    { 21, 30, 22, 2, 29, 158, 24279 }, // ű
+    { 24, 36, 25, 2, 27, 216, 24437 }, // Ų
+    { 19, 30, 22, 2, 21, 143, 24653 }, // ų
+    { 32, 36, 32, 4, 36, 288, 24796 }, // Ŵ
+    { 27, 29, 27, 2, 29, 196, 25084 }, // ŵ
+    { 20, 36, 19, 3, 36, 180, 25280 }, // Ŷ
+    { 24, 38, 18, -4, 29, 228, 25460 }, // ŷ
+    { 20, 35, 19, 3, 35, 175, 25688 }, // Ÿ
+    { 23, 36, 20, -1, 36, 207, 25863 }, // Ź
+    { 19, 29, 17, -1, 29, 138, 26070 }, // ź
+    { 23, 35, 20, -1, 35, 202, 26208 }, // Ż
+    { 18, 28, 17, -1, 28, 126, 26410 }, // ż
+    { 23, 36, 20, -1, 36, 207, 26536 }, // Ž
+    { 19, 29, 17, -1, 29, 138, 26743 }, // ž
+    { 22, 38, 11, -5, 29, 209, 26881 }, // ſ
+    { 7, 7, 0, -15, 29, 13, 27090 }, // ̀
+    { 9, 7, 0, -9, 29, 16, 27103 }, // ́
+    { 13, 7, 0, -4, 29, 23, 27119 }, // ̂
+    { 15, 6, 0, -16, 28, 23, 27142 }, // ̃
+    { 12, 4, 0, -3, 26, 12, 27165 }, // ̄
+    { 16, 4, 0, -4, 32, 16, 27177 }, // ̅
+    { 11, 6, 0, -2, 28, 17, 27193 }, // ̆
+    { 5, 5, 0, 1, 28, 7, 27210 }, // ̇
+    { 11, 5, 0, -2, 28, 14, 27217 }, // ̈
+    { 7, 9, 0, -11, 31, 16, 27231 }, // ̉
+    { 9, 9, 0, -1, 31, 21, 27247 }, // ̊
+    { 15, 7, 0, -3, 29, 27, 27268 }, // ̋
+    { 12, 7, 0, -2, 29, 21, 27295 }, // ̌
+    { 6, 11, 0, 0, 29, 17, 27316 }, // ̍
+    { 11, 7, 0, -2, 29, 20, 27333 }, // ̎
+    { 14, 7, 0, -19, 29, 25, 27353 }, // ̏
+    { 12, 10, 0, -2, 32, 30, 27378 }, // ̐
+    { 12, 6, 0, -3, 28, 18, 27408 }, // ̑
+    { 9, 10, 0, -2, 27, 23, 27426 }, // ̒
+    { 9, 10, 0, -2, 27, 23, 27449 }, // ̓
+    { 5, 10, 0, 0, 27, 13, 27472 }, // ̔
+    { 9, 10, 0, -2, 27, 23, 27485 }, // ̕
+    { 7, 7, 0, -7, -1, 13, 27508 }, // ̖
+    { 9, 7, 0, -6, -1, 16, 27521 }, // ̗
+    { 9, 8, 0, -7, -1, 18, 27537 }, // ̘
+    { 8, 8, 0, -7, -1, 16, 27555 }, // ̙
+    { 12, 11, 12, 3, 29, 33, 27571 }, // ̚
+    { 9, 9, 0, -2, 29, 21, 27604 }, // ̛
+    { 6, 9, 0, -2, 0, 14, 27625 }, // ̜
+    { 9, 7, 0, -8, -1, 16, 27639 }, // ̝
+    { 9, 7, 0, -7, -1, 16, 27655 }, // ̞
+    { 10, 8, 0, -8, -1, 20, 27671 }, // ̟
+    { 10, 3, 0, -8, -3, 8, 27691 }, // ̠
+    { 9, 11, 0, -8, 2, 25, 27699 }, // ̡
+    { 7, 11, 0, -4, 2, 20, 27724 }, // ̢
+    { 5, 5, 0, -16, -2, 7, 27744 }, // ̣
+    { 12, 5, 0, -9, -2, 15, 27751 }, // ̤
+    { 10, 9, 0, -8, 0, 23, 27766 }, // ̥
+    { 7, 7, 0, 2, -2, 13, 27789 }, // ̦
+    { 8, 9, 0, -7, 0, 18, 27802 }, // ̧
+    { 7, 9, 0, -6, 0, 16, 27820 }, // ̨
+    { 6, 11, 0, -6, -1, 17, 27836 }, // ̩
+    { 16, 8, 0, -11, -1, 32, 27853 }, // ̪
+    { 15, 5, 0, -10, -2, 19, 27885 }, // ̫
+    { 12, 7, 0, -8, -1, 21, 27904 }, // ̬
+    { 12, 7, 0, -9, -1, 21, 27925 }, // ̭
+    { 12, 6, 0, -8, -2, 18, 27946 }, // ̮
+    { 12, 6, 0, -9, -2, 18, 27964 }, // ̯
+    { 14, 6, 0, -10, -2, 21, 27982 }, // ̰
+    { 12, 4, 0, -9, -3, 12, 28003 }, // ̱
+    { 17, 3, 0, -12, -3, 13, 28015 }, // ̲
+    { 18, 9, 0, -12, 0, 41, 28028 }, // ̳
+    { 14, 6, 0, -7, 13, 21, 28069 }, // ̴
+    { 16, 4, 0, -8, 13, 16, 28090 }, // ̵
+    { 26, 3, 0, -13, 12, 20, 28106 }, // ̶
+    { 12, 9, 0, -6, 15, 27, 28126 }, // ̷
+    { 22, 32, 0, -11, 29, 176, 28153 }, // ̸
+    { 6, 9, 0, -3, 0, 14, 28329 }, // ̹
+    { 16, 8, 0, -11, -1, 32, 28343 }, // ̺
+    { 16, 8, 0, -11, -1, 32, 28375 }, // ̻
+    { 15, 5, 0, -10, -2, 19, 28407 }, // ̼
+    { 9, 9, 0, -1, 30, 21, 28426 }, // ̽
+    { 9, 12, 0, -1, 33, 27, 28447 }, // ̾
+    { 18, 9, 0, -4, 37, 41, 28474 }, // ̿
+    { 7, 7, 0, -2, 29, 13, 28515 }, // ̀
+    { 9, 7, 0, 1, 29, 16, 28528 }, // ́
+    { 14, 6, 0, 6, 28, 21, 28544 }, // ͂
+    { 6, 8, 0, 1, 30, 12, 28565 }, // ̓
+    { 15, 8, 0, -4, 30, 30, 28577 }, // ̈́
+    { 7, 6, 0, -5, -3, 11, 28607 }, // ͅ
+    { 17, 7, 0, -5, 29, 30, 28618 }, // ͆
+    { 17, 9, 0, -11, 0, 39, 28648 }, // ͇
+    { 11, 7, 0, -8, -1, 20, 28687 }, // ͈
+    { 8, 7, 0, -6, -2, 14, 28707 }, // ͉
+    { 15, 8, 0, -4, 29, 30, 28721 }, // ͊
+    { 15, 14, 0, -4, 35, 53, 28751 }, // ͋
+    { 16, 11, 0, -4, 33, 44, 28804 }, // ͌
+    { 14, 8, 0, -10, -1, 28, 28848 }, // ͍
+    { 7, 9, 0, -6, 0, 16, 28876 }, // ͎
+    { 28, 27, 0, -14, 27, 189, 28892 }, // ͏
+    { 7, 8, 0, 0, 30, 14, 29081 }, // ͐
+    { 6, 9, 0, 4, 31, 14, 29095 }, // ͑
+    { 11, 10, 0, -2, 32, 28, 29109 }, // ͒
+    { 8, 8, 0, -6, -1, 16, 29137 }, // ͓
+    { 7, 8, 0, -6, -1, 14, 29153 }, // ͔
+    { 7, 8, 0, -5, -1, 14, 29167 }, // ͕
+    { 15, 8, 0, -9, -1, 30, 29181 }, // ͖
+    { 5, 9, 0, 4, 31, 12, 29211 }, // ͗
+    { 5, 5, 0, 1, 28, 7, 29223 }, // ͘
+    { 9, 8, 0, -7, -1, 18, 29230 }, // ͙
+    { 15, 8, 0, -10, -1, 30, 29248 }, // ͚
+    { 8, 8, 0, 0, 30, 16, 29278 }, // ͛
+    { 28, 8, 0, -16, -1, 56, 29294 }, // ͜
+    { 28, 8, 0, -11, 30, 56, 29350 }, // ͝
+    { 20, 4, 0, -7, 26, 20, 29406 }, // ͞
+    { 20, 4, 0, -13, -2, 20, 29426 }, // ͟
+    { 29, 6, 0, -11, 28, 44, 29446 }, // ͠
+    { 27, 8, 0, -10, 33, 54, 29490 }, // ͡
+    { 28, 8, 0, -18, -1, 56, 29544 }, // ͢
+    { 10, 9, 0, -1, 32, 23, 29600 }, // ͣ
+    { 8, 9, 0, 0, 32, 18, 29623 }, // ͤ
+    { 6, 12, 0, 1, 35, 18, 29641 }, // ͥ
+    { 9, 9, 0, -1, 32, 21, 29659 }, // ͦ
+    { 10, 9, 0, -1, 32, 23, 29680 }, // ͧ
+    { 8, 9, 0, 0, 32, 18, 29703 }, // ͨ
+    { 10, 12, 0, -1, 35, 30, 29721 }, // ͩ
+    { 9, 12, 0, -1, 35, 27, 29751 }, // ͪ
+    { 15, 9, 0, -4, 32, 34, 29778 }, // ͫ
+    { 8, 9, 0, 0, 32, 18, 29812 }, // ͬ
+    { 7, 11, 0, 1, 34, 20, 29830 }, // ͭ
+    { 9, 9, 0, 0, 32, 21, 29850 }, // ͮ
+    { 11, 9, 0, -2, 32, 25, 29871 }, // ͯ
+    { 20, 36, 19, 1, 36, 180, 29896 }, // Ѐ
+    { 20, 34, 19, 1, 34, 170, 0 }, // Ё
+    { 20, 28, 25, 3, 27, 140, 30076 }, // Ђ
+    { 20, 36, 18, 1, 36, 180, 30216 }, // Ѓ
+    { 22, 29, 22, 2, 28, 160, 30396 }, // Є
+    { 20, 29, 19, 0, 28, 145, 30556 }, // Ѕ
+    { 10, 27, 10, 1, 27, 68, 30701 }, // І
+    { 13, 34, 10, 1, 34, 111, 30769 }, // Ї
+    { 17, 35, 10, -6, 27, 149, 30880 }, // Ј
+    { 36, 28, 35, -2, 27, 252, 31029 }, // Љ
+    { 32, 27, 35, 1, 27, 216, 31281 }, // Њ
+    { 21, 27, 26, 3, 27, 142, 31497 }, // Ћ
+    { 24, 36, 21, 1, 36, 216, 31639 }, // Ќ
+    { 25, 36, 26, 1, 36, 225, 31855 }, // Ѝ
+    { 25, 36, 21, 0, 35, 225, 32080 }, // Ў
+    { 24, 33, 25, 1, 27, 198, 32305 }, // Џ
+    { 23, 27, 21, -3, 27, 156, 170 }, // А
+    { 21, 27, 21, 1, 27, 142, 326 }, // Б
+    { 21, 27, 22, 1, 27, 142, 468 }, // В
+    { 20, 27, 18, 1, 27, 135, 610 }, // Г
+    { 30, 33, 26, -4, 27, 248, 745 }, // Д
+    { 20, 27, 19, 1, 27, 135, 993 }, // Е
+    { 36, 27, 30, -2, 27, 243, 1128 }, // Ж
+    { 21, 29, 20, -1, 28, 153, 1371 }, // З
+    { 25, 27, 26, 1, 27, 169, 1524 }, // И
+    { 25, 35, 26, 1, 35, 219, 1693 }, // Й
+    { 24, 27, 21, 1, 27, 162, 1912 }, // К
+    { 28, 28, 25, -2, 27, 196, 2074 }, // Л
+    { 31, 27, 31, 1, 27, 210, 2270 }, // М
+    { 25, 27, 25, 1, 27, 169, 2480 }, // Н
+    { 24, 29, 26, 2, 28, 174, 2649 }, // О
+    { 25, 27, 25, 1, 27, 169, 2823 }, // П
+    { 21, 27, 21, 1, 27, 142, 2992 }, // Р
+    { 22, 29, 22, 2, 28, 160, 3134 }, // С
+    { 20, 27, 20, 3, 27, 135, 3294 }, // Т
+    { 25, 28, 21, 0, 27, 175, 3429 }, // У
+    { 27, 29, 30, 2, 28, 196, 3604 }, // Ф
+    { 25, 27, 20, -2, 27, 169, 3800 }, // Х
+    { 25, 33, 25, 1, 27, 207, 3969 }, // Ц
+    { 21, 27, 23, 3, 27, 142, 4176 }, // Ч
+    { 35, 27, 36, 1, 27, 237, 4318 }, // Ш
+    { 35, 33, 36, 1, 27, 289, 4555 }, // Щ
+    { 20, 27, 24, 3, 27, 135, 4844 }, // Ъ
+    { 29, 27, 30, 1, 27, 196, 4979 }, // Ы
+    { 18, 27, 21, 1, 27, 122, 5175 }, // Ь
+    { 22, 29, 22, 0, 28, 160, 5297 }, // Э
+    { 34, 29, 35, 1, 28, 247, 5457 }, // Ю
+    { 24, 27, 22, -2, 27, 162, 5704 }, // Я
+    { 20, 22, 21, 1, 21, 110, 5866 }, // а
+    { 21, 30, 21, 1, 29, 158, 5976 }, // б
+    { 18, 22, 19, 1, 21, 99, 6134 }, // в
+    { 17, 22, 17, 0, 21, 94, 6233 }, // г
+    { 20, 30, 21, 1, 29, 150, 6327 }, // д
+    { 17, 22, 18, 1, 21, 94, 6477 }, // е
+    { 35, 22, 33, -1, 21, 193, 6571 }, // ж
+    { 16, 22, 17, 0, 21, 88, 6764 }, // з
+    { 20, 22, 21, 1, 21, 110, 6852 }, // и
+    { 20, 29, 21, 1, 28, 145, 6962 }, // й
+    { 21, 21, 19, 0, 21, 111, 7107 }, // к
+    { 23, 22, 21, -2, 21, 127, 7218 }, // л
+    { 28, 21, 28, 0, 21, 147, 7345 }, // м
+    { 21, 21, 21, 0, 21, 111, 7492 }, // н
+    { 19, 22, 21, 1, 21, 105, 7603 }, // о
+    { 20, 21, 21, 0, 21, 105, 7708 }, // п
+    { 22, 30, 21, -2, 21, 165, 7813 }, // р
+    { 17, 22, 17, 1, 21, 94, 7978 }, // с
+    { 31, 21, 32, 0, 21, 163, 8072 }, // т
+    { 24, 30, 18, -4, 21, 180, 8235 }, // у
+    { 23, 38, 25, 1, 29, 219, 8415 }, // ф
+    { 21, 21, 17, -2, 21, 111, 8634 }, // х
+    { 20, 27, 22, 1, 21, 135, 8745 }, // ц
+    { 18, 21, 21, 2, 21, 95, 8880 }, // ч
+    { 31, 22, 32, 1, 21, 171, 8975 }, // ш
+    { 31, 27, 33, 1, 21, 210, 9146 }, // щ
+    { 20, 22, 22, 1, 21, 110, 9356 }, // ъ
+    { 26, 22, 27, 1, 21, 143, 9466 }, // ы
+    { 17, 22, 19, 1, 21, 94, 9609 }, // ь
+    { 16, 22, 18, 1, 21, 88, 9703 }, // э
+    { 27, 22, 29, 1, 21, 149, 9791 }, // ю
+    { 21, 21, 19, -2, 21, 111, 9940 }, // я
+    { 17, 30, 18, 1, 29, 128, 32503 }, // ѐ
+    { 18, 29, 18, 1, 28, 131, 10051 }, // ё
+    { 19, 38, 22, 1, 29, 181, 32631 }, // ђ
+    { 17, 30, 17, 0, 29, 128, 32812 }, // ѓ
+    { 17, 22, 17, 1, 21, 94, 32940 }, // є
+    { 16, 22, 16, 0, 21, 88, 33034 }, // ѕ
+    { 10, 28, 10, 1, 28, 70, 33122 }, // і
+    { 13, 28, 9, 0, 28, 91, 33192 }, // ї
+    { 16, 37, 9, -5, 28, 148, 33283 }, // ј
+    { 31, 22, 31, -2, 21, 171, 33431 }, // љ
+    { 29, 22, 30, 0, 21, 160, 33602 }, // њ
+    { 19, 29, 22, 1, 29, 138, 33762 }, // ћ
+    { 21, 29, 19, 0, 29, 153, 33900 }, // ќ
+    { 20, 30, 21, 1, 29, 150, 34053 }, // ѝ
+    { 24, 37, 18, -4, 28, 222, 34203 }, // ў
+    { 20, 29, 21, 1, 21, 145, 34425 }, // џ
+    { 35, 28, 34, 3, 27, 245, 34570 }, // Ѡ
+    { 29, 21, 30, 2, 21, 153, 34815 }, // ѡ
+    { 18, 27, 22, 2, 27, 122, 34968 }, // Ѣ
+    { 29, 22, 31, 0, 21, 160, 35090 }, // ѣ
+    { 34, 29, 32, 1, 28, 247, 35250 }, // Ѥ
+    { 26, 22, 26, 1, 21, 143, 35497 }, // ѥ
+    { 24, 27, 23, -3, 27, 162, 35640 }, // Ѧ
+    { 20, 21, 20, -2, 21, 105, 35802 }, // ѧ
+    { 29, 27, 32, 1, 27, 196, 35907 }, // Ѩ
+    { 25, 21, 27, 1, 21, 132, 36103 }, // ѩ
+    { 28, 27, 25, -2, 27, 189, 36235 }, // Ѫ
+    { 25, 21, 23, -3, 21, 132, 36424 }, // ѫ
+    { 35, 27, 35, 1, 27, 237, 36556 }, // Ѭ
+    { 29, 21, 30, 1, 21, 153, 36793 }, // ѭ
+    { 22, 40, 20, -2, 32, 220, 36946 }, // Ѯ
+    { 19, 33, 17, -2, 25, 157, 37166 }, // ѯ
+    { 27, 27, 28, 4, 27, 183, 37323 }, // Ѱ
+    { 23, 38, 27, 2, 29, 219, 37506 }, // ѱ
+    { 24, 29, 27, 2, 28, 174, 37725 }, // Ѳ
+    { 19, 22, 21, 1, 21, 105, 37899 }, // ѳ
+    { 23, 27, 21, 3, 27, 156, 38004 }, // Ѵ
+    { 19, 21, 17, 1, 21, 100, 38160 }, // ѵ
+    { 23, 36, 21, 3, 36, 207, 38260 }, // Ѷ
+    { 19, 29, 17, 1, 29, 138, 38467 }, // ѷ
+    { 45, 37, 45, 2, 28, 417, 38605 }, // Ѹ
+    { 40, 30, 39, 1, 21, 300, 39022 }, // ѹ
+    { 25, 33, 28, 2, 30, 207, 39322 }, // Ѻ
+    { 20, 26, 22, 1, 23, 130, 39529 }, // ѻ
+    { 33, 40, 36, 2, 39, 330, 39659 }, // Ѽ
+    { 28, 34, 30, 1, 33, 238, 39989 }, // ѽ
+    { 35, 35, 34, 3, 34, 307, 40227 }, // Ѿ
+    { 29, 27, 30, 2, 27, 196, 40534 }, // ѿ
+    { 22, 37, 22, 2, 28, 204, 40730 }, // Ҁ
+    { 17, 30, 17, 1, 21, 128, 40934 }, // ҁ
+    { 20, 25, 23, 2, 24, 125, 41062 }, // ҂
+    { 15, 6, 0, -15, 27, 23, 41187 }, // ҃
+    { 14, 6, 0, -15, 28, 21, 41210 }, // ҄
+    { 6, 8, 0, -11, 30, 12, 41231 }, // ҅
+    { 5, 8, 0, -10, 30, 10, 41243 }, // ҆
+    { 15, 6, 0, -3, 34, 23, 41253 }, // ҇
+    { 44, 40, 0, -22, 30, 440, 41276 }, // ҈
+    { 42, 42, 0, -21, 31, 441, 41716 }, // ҉
+    { 26, 43, 27, 1, 35, 280, 42157 }, // Ҋ
+    { 19, 36, 22, 2, 29, 171, 42437 }, // ҋ
+    { 18, 27, 21, 1, 27, 122, 42608 }, // Ҍ
+    { 16, 30, 20, 2, 29, 120, 42730 }, // ҍ
+    { 21, 27, 21, 1, 27, 142, 42850 }, // Ҏ
+    { 21, 30, 22, -1, 21, 158, 0 }, // ҏ
+    { 21, 33, 18, 1, 33, 174, 158 }, // Ґ
+    { 17, 26, 15, 1, 26, 111, 332 }, // ґ
+    { 20, 27, 18, 1, 27, 135, 443 }, // Ғ
+    { 17, 21, 15, 0, 21, 90, 578 }, // ғ
+    { 20, 37, 23, 1, 27, 185, 668 }, // Ҕ
+    { 16, 31, 19, 1, 21, 124, 853 }, // ҕ
+    { 35, 35, 31, -2, 27, 307, 977 }, // Җ
+    { 34, 28, 32, -1, 21, 238, 1284 }, // җ
+    { 21, 37, 20, -1, 28, 195, 1522 }, // Ҙ
+    { 16, 30, 17, 0, 21, 120, 1717 }, // ҙ
+    { 24, 35, 23, 1, 27, 210, 1837 }, // Қ
+    { 19, 28, 20, 1, 21, 133, 2047 }, // қ
+    { 24, 27, 22, 1, 27, 162, 2180 }, // Ҝ
+    { 20, 21, 18, 1, 21, 105, 2342 }, // ҝ
+    { 24, 27, 21, 1, 27, 162, 2447 }, // Ҟ
+    { 19, 29, 18, 1, 29, 138, 2609 }, // ҟ
+    { 25, 27, 24, 3, 27, 169, 2747 }, // Ҡ
+    { 22, 21, 21, 1, 21, 116, 2916 }, // ҡ
+    { 25, 35, 26, 1, 27, 219, 3032 }, // Ң
+    { 21, 28, 23, 1, 21, 147, 3251 }, // ң
+    { 31, 27, 28, 1, 27, 210, 3398 }, // Ҥ
+    { 27, 21, 26, 1, 21, 142, 3608 }, // ҥ
+    { 34, 37, 38, 1, 27, 315, 3750 }, // Ҧ
+    { 28, 31, 31, 1, 21, 217, 4065 }, // ҧ
+    { 24, 30, 27, 2, 28, 180, 4282 }, // Ҩ
+    { 20, 23, 23, 1, 21, 115, 4462 }, // ҩ
+    { 22, 37, 22, 2, 28, 204, 4577 }, // Ҫ
+    { 17, 30, 17, 1, 21, 128, 4781 }, // ҫ
+    { 20, 35, 19, 3, 27, 175, 4909 }, // Ҭ
+    { 31, 28, 33, 1, 21, 217, 5084 }, // ҭ
+    { 20, 27, 19, 3, 27, 135, 5301 }, // Ү
+    { 19, 30, 18, 1, 21, 143, 5436 }, // ү
+    { 22, 27, 19, 1, 27, 149, 5579 }, // Ұ
+    { 21, 30, 18, -1, 21, 158, 5728 }, // ұ
+    { 25, 35, 22, -2, 27, 219, 5886 }, // Ҳ
+    { 22, 28, 20, -1, 21, 154, 6105 }, // ҳ
+    { 27, 35, 29, 3, 27, 237, 6259 }, // Ҵ
+    { 23, 28, 25, 1, 21, 161, 6496 }, // ҵ
+    { 21, 35, 24, 4, 27, 184, 6657 }, // Ҷ
+    { 18, 28, 21, 2, 21, 126, 6841 }, // ҷ
+    { 21, 27, 24, 4, 27, 142, 6967 }, // Ҹ
+    { 18, 21, 21, 2, 21, 95, 7109 }, // ҹ
+    { 21, 27, 24, 1, 27, 142, 7204 }, // Һ
+    { 19, 29, 22, 1, 29, 138, 7346 }, // һ
+    { 27, 29, 29, 2, 28, 196, 7484 }, // Ҽ
+    { 21, 22, 22, 1, 21, 116, 7680 }, // ҽ
+    { 27, 36, 29, 2, 28, 243, 7796 }, // Ҿ
+    { 21, 28, 22, 1, 21, 147, 8039 }, // ҿ
+    { 16, 27, 12, -1, 27, 108, 8186 }, // Ӏ
+    { 36, 35, 30, -2, 35, 315, 8294 }, // Ӂ
+    { 35, 29, 33, -1, 28, 254, 8609 }, // ӂ
+    { 24, 37, 24, 1, 27, 222, 8863 }, // Ӄ
+    { 19, 31, 20, 1, 21, 148, 9085 }, // ӄ
+    { 27, 35, 25, -2, 27, 237, 9233 }, // Ӆ
+    { 22, 28, 21, -2, 21, 154, 9470 }, // ӆ
+    { 25, 37, 26, 1, 27, 232, 9624 }, // Ӈ
+    { 21, 31, 23, 1, 21, 163, 9856 }, // ӈ
+    { 25, 35, 26, 1, 27, 219, 10019 }, // Ӊ
+    { 21, 28, 23, 1, 21, 147, 10238 }, // ӊ
+    { 21, 35, 24, 4, 27, 184, 10385 }, // Ӌ
+    { 18, 28, 22, 3, 21, 126, 10569 }, // ӌ
+    { 31, 35, 32, 1, 27, 272, 10695 }, // Ӎ
+    { 25, 28, 26, 1, 21, 175, 10967 }, // ӎ
+    { 16, 27, 12, -1, 27, 108, 11142 }, // ӏ
+    { 25, 35, 21, -3, 35, 219, 11250 }, // Ӑ
+    { 20, 29, 21, 1, 28, 145, 11469 }, // ӑ
+    { 24, 35, 21, -3, 35, 210, 11614 }, // Ӓ
+    { 20, 29, 21, 1, 28, 145, 11824 }, // ӓ
+    { 36, 27, 31, -3, 27, 243, 11969 }, // Ӕ
+    { 29, 22, 31, 1, 21, 160, 12212 }, // ӕ
+    { 21, 35, 19, 1, 35, 184, 12372 }, // Ӗ
+    { 19, 29, 19, 1, 28, 138, 12556 }, // ӗ
+    { 23, 29, 25, 1, 28, 167, 12694 }, // Ә
+    { 17, 22, 18, 0, 21, 94, 12861 }, // ә
+    { 23, 36, 25, 1, 35, 207, 12955 }, // Ӛ
+    { 18, 29, 18, 0, 28, 131, 13162 }, // ӛ
+    { 36, 35, 30, -2, 35, 315, 13293 }, // Ӝ
+    { 35, 29, 33, -1, 28, 254, 13608 }, // ӝ
+    { 21, 35, 20, -1, 34, 184, 13862 }, // Ӟ
+    { 17, 29, 17, 0, 28, 124, 14046 }, // ӟ
+    { 21, 28, 20, 0, 27, 147, 14170 }, // Ӡ
+    { 20, 30, 17, -3, 21, 150, 14317 }, // ӡ
+    { 25, 33, 26, 1, 33, 207, 14467 }, // Ӣ
+    { 19, 27, 22, 2, 26, 129, 14674 }, // ӣ
+    { 25, 35, 26, 1, 35, 219, 14803 }, // Ӥ
+    { 19, 29, 22, 2, 28, 138, 15022 }, // ӥ
+    { 24, 36, 27, 2, 35, 216, 15160 }, // Ӧ
+    { 19, 29, 21, 1, 28, 138, 15376 }, // ӧ
+    { 24, 29, 27, 2, 28, 174, 15514 }, // Ө
+    { 19, 22, 21, 1, 21, 105, 15688 }, // ө
+    { 24, 35, 27, 2, 34, 210, 15793 }, // Ӫ
+    { 19, 29, 21, 1, 28, 138, 16003 }, // ӫ
+    { 22, 35, 22, 0, 34, 193, 16141 }, // Ӭ
+    { 16, 29, 18, 1, 28, 116, 16334 }, // ӭ
+    { 25, 34, 21, 0, 33, 213, 16450 }, // Ӯ
+    { 24, 35, 18, -4, 26, 210, 16663 }, // ӯ
+    { 25, 36, 21, 0, 35, 225, 16873 }, // Ӱ
+    { 24, 37, 18, -4, 28, 222, 17098 }, // ӱ
+    { 25, 37, 21, 0, 36, 232, 17320 }, // Ӳ
+    { 25, 38, 18, -4, 29, 238, 17552 }, // ӳ
+    { 21, 35, 23, 3, 35, 184, 17790 }, // Ӵ
+    { 18, 28, 21, 2, 28, 126, 17974 }, // ӵ
+    { 20, 35, 18, 1, 27, 175, 18100 }, // Ӷ
+    { 16, 28, 15, 1, 21, 112, 18275 }, // ӷ
+    { 29, 35, 30, 1, 35, 254, 18387 }, // Ӹ
+    { 26, 29, 27, 1, 28, 189, 18641 }, // ӹ
+    { 21, 35, 18, 0, 27, 184, 18830 }, // Ӻ
+    { 18, 29, 15, -1, 21, 131, 19014 }, // ӻ
+    { 25, 35, 20, -2, 27, 219, 19145 }, // Ӽ
+    { 22, 29, 18, -2, 21, 160, 19364 }, // ӽ
+    { 25, 27, 20, -2, 27, 169, 19524 }, // Ӿ
+    { 22, 21, 18, -2, 21, 116, 19693 }, // ӿ
+    { 0, 0, 19, 0, 0, 0, 19809 }, //  
+    { 0, 0, 38, 0, 0, 0, 19809 }, //  
+    { 0, 0, 19, 0, 0, 0, 19809 }, //  
+    { 0, 0, 38, 0, 0, 0, 19809 }, //  
+    { 0, 0, 12, 0, 0, 0, 19809 }, //  
+    { 0, 0, 9, 0, 0, 0, 19809 }, //  
+    { 0, 0, 6, 0, 0, 0, 19809 }, //  
+    { 0, 0, 21, 0, 0, 0, 19809 }, //  
+    { 0, 0, 10, 0, 0, 0, 19809 }, //  
+    { 0, 0, 6, 0, 0, 0, 19809 }, //  
+    { 0, 0, 4, 0, 0, 0, 19809 }, //  
+    { 0, 0, 0, 0, 0, 0, 19809 }, // ​
+    { 0, 0, 0, 0, 0, 0, 19809 }, // ‌
+    { 0, 0, 0, 0, 0, 0, 19809 }, // ‍
+    { 9, 31, 0, -1, 26, 70, 19809 }, // ‎
+    { 9, 31, 0, -8, 26, 70, 19879 }, // ‏
+    { 11, 4, 12, 0, 12, 11, 19949 }, // ‐
+    { 11, 4, 12, 0, 12, 11, 19960 }, // ‑
+    { 18, 3, 21, 2, 15, 14, 19971 }, // ‒
+    { 17, 4, 18, 0, 12, 17, 19180 }, // –
+    { 35, 4, 36, 0, 12, 35, 19197 }, // —
+    { 35, 4, 36, 0, 12, 35, 19985 }, // ―
+    { 12, 39, 21, 5, 29, 117, 20020 }, // ‖
+    { 17, 9, 15, -4, 0, 39, 20137 }, // ‗
+    { 8, 10, 7, 2, 27, 20, 19232 }, // ‘
+    { 8, 10, 7, 2, 27, 20, 19252 }, // ’
+    { 8, 10, 9, -2, 5, 20, 20176 }, // ‚
+    { 4, 10, 7, 4, 27, 10, 20196 }, // ‛
+    { 15, 10, 13, 2, 27, 38, 19272 }, // “
+    { 15, 10, 13, 2, 27, 38, 19310 }, // ”
+    { 15, 10, 16, -2, 5, 38, 20206 }, // „
+    { 11, 10, 13, 4, 27, 28, 20244 }, // ‟
+    { 15, 29, 18, 3, 29, 109, 20272 }, // †
+    { 18, 29, 18, 1, 29, 131, 20381 }, // ‡
+    { 9, 10, 14, 3, 19, 23, 20512 }, // •
+    { 12, 12, 14, 2, 20, 36, 20535 }, // ‣
+    { 5, 6, 19, 5, 5, 8, 20571 }, // ․
+    { 15, 6, 19, 0, 5, 23, 20579 }, // ‥
+    { 25, 6, 29, 0, 5, 38, 19348 }, // …
+    { 6, 6, 10, 2, 13, 9, 20602 }, // ‧
+    { 0, 0, 23, 0, 0, 0, 20611 }, //  
+    { 0, 0, 23, 0, 0, 0, 20611 }, //  
+    { 9, 28, 0, -1, 23, 63, 20611 }, // ‪
+    { 9, 28, 0, -8, 23, 63, 20674 }, // ‫
+    { 10, 31, 0, -5, 26, 78, 20737 }, // ‬
+    { 10, 31, 0, -5, 26, 78, 20815 }, // ‭
+    { 10, 31, 0, -5, 26, 78, 20893 }, // ‮
+    { 0, 0, 6, 0, 0, 0, 20971 }, //  
+    { 38, 29, 42, 3, 28, 276, 20971 }, // ‰
+    { 50, 29, 54, 3, 28, 363, 21247 }, // ‱
+    { 9, 10, 8, 2, 27, 23, 21610 }, // ′
+    { 16, 10, 15, 2, 27, 40, 21633 }, // ″
+    { 22, 10, 21, 2, 27, 55, 21673 }, // ‴
+    { 7, 10, 10, 4, 27, 18, 21728 }, // ‵
+    { 12, 10, 16, 4, 27, 30, 21746 }, // ‶
+    { 18, 10, 22, 4, 27, 45, 21776 }, // ‷
+    { 15, 13, 15, -4, 4, 49, 21821 }, // ‸
+    { 10, 16, 11, 1, 18, 40, 21870 }, // ‹
+    { 10, 16, 11, 0, 18, 40, 21910 }, // ›
+    { 29, 29, 31, 1, 28, 211, 21950 }, // ※
+    { 20, 28, 19, 0, 27, 140, 22161 }, // ‼
+    { 16, 29, 16, 2, 28, 116, 22301 }, // ‽
+    { 17, 4, 15, 3, 32, 17, 22417 }, // ‾
+    { 20, 8, 20, -2, -1, 40, 22434 }, // ‿
+    { 19, 9, 20, 3, 30, 43, 22474 }, // ⁀
+    { 18, 25, 13, -4, 16, 113, 22517 }, // ⁁
+    { 40, 34, 42, 0, 29, 340, 22630 }, // ⁂
+    { 10, 4, 11, 0, 12, 10, 22970 }, // ⁃
+    { 23, 27, 5, -9, 27, 156, 22980 }, // ⁄
+    { 15, 33, 11, -1, 27, 124, 23136 }, // ⁅
+    { 15, 33, 11, -3, 27, 124, 23260 }, // ⁆
+    { 32, 29, 32, 2, 28, 232, 23384 }, // ⁇
+    { 25, 29, 26, 2, 28, 182, 23616 }, // ⁈
+    { 27, 29, 26, 0, 28, 196, 23798 }, // ⁉
+    { 19, 21, 20, 2, 21, 100, 23994 }, // ⁊
+    { 20, 34, 22, 3, 29, 170, 24094 }, // ⁋
+    { 19, 20, 24, 2, 21, 95, 24264 }, // ⁌
+    { 19, 20, 24, 3, 21, 95, 24359 }, // ⁍
+    { 19, 18, 21, -1, 10, 86, 24454 }, // ⁎
+    { 8, 26, 10, 1, 21, 52, 24540 }, // ⁏
+    { 24, 39, 20, -2, 30, 234, 24592 }, // ⁐
+    { 22, 37, 21, 0, 29, 204, 24826 }, // ⁑
+    { 14, 29, 14, 0, 28, 102, 25030 }, // ⁒
+    { 33, 6, 38, 3, 14, 50, 25132 }, // ⁓
+    { 20, 9, 20, -4, 0, 45, 25182 }, // ⁔
+    { 20, 20, 21, 1, 19, 100, 25227 }, // ⁕
+    { 17, 29, 19, 1, 28, 124, 25327 }, // ⁖
+    { 28, 10, 27, 2, 27, 70, 25451 }, // ⁗
+    { 28, 29, 31, 1, 28, 203, 25521 }, // ⁘
+    { 29, 29, 31, 1, 28, 211, 25724 }, // ⁙
+    { 6, 29, 8, 1, 28, 44, 25935 }, // ⁚
+    { 22, 30, 25, 1, 29, 165, 25979 }, // ⁛
+    { 28, 29, 30, 1, 28, 203, 26144 }, // ⁜
+    { 6, 28, 10, 2, 27, 42, 26347 }, // ⁝
+    { 6, 29, 10, 3, 28, 44, 26389 }, // ⁞
+    { 0, 0, 8, 0, 0, 0, 26433 }, //  
+    { 0, 0, 23, 0, 0, 0, 26433 }, // ⁠
+    { 0, 0, 23, 0, 0, 0, 26433 }, // ⁡
+    { 0, 0, 23, 0, 0, 0, 26433 }, // ⁢
+    { 0, 0, 23, 0, 0, 0, 26433 }, // ⁣
+    { 0, 0, 23, 0, 0, 0, 26433 }, // ⁤
+    { 0, 0, 23, 0, 0, 0, 26433 }, // ⁦
+    { 0, 0, 23, 0, 0, 0, 26433 }, // ⁧
+    { 0, 0, 23, 0, 0, 0, 26433 }, // ⁨
+    { 0, 0, 23, 0, 0, 0, 26433 }, // ⁩
+    { 10, 31, 0, -5, 26, 78, 26433 }, // ⁪
+    { 10, 31, 0, -5, 26, 78, 26511 }, // ⁫
+    { 10, 31, 0, -5, 26, 78, 26589 }, // ⁬
+    { 10, 31, 0, -5, 26, 78, 26667 }, // ⁭
+    { 10, 31, 0, -5, 26, 78, 26745 }, // ⁮
+    { 10, 31, 0, -5, 26, 78, 26823 }, // ⁯
+    { 13, 18, 13, 3, 33, 59, 26901 }, // ⁰
+    { 6, 18, 8, 3, 28, 27, 26960 }, // ⁱ
+    { 13, 17, 13, 2, 32, 56, 26987 }, // ⁴
+    { 13, 17, 13, 3, 32, 56, 27043 }, // ⁵
+    { 13, 17, 13, 3, 32, 56, 27099 }, // ⁶
+    { 13, 17, 13, 4, 32, 56, 27155 }, // ⁷
+    { 13, 17, 13, 3, 32, 56, 27211 }, // ⁸
+    { 13, 17, 13, 3, 32, 56, 27267 }, // ⁹
+    { 11, 11, 13, 4, 28, 31, 27323 }, // ⁺
+    { 11, 3, 13, 4, 24, 9, 27354 }, // ⁻
+    { 11, 7, 13, 4, 26, 20, 27363 }, // ⁼
+    { 9, 21, 7, 4, 34, 48, 27383 }, // ⁽
+    { 9, 21, 7, 0, 34, 48, 27431 }, // ⁾
+    { 13, 14, 14, 2, 24, 46, 27479 }, // ⁿ
+    { 12, 18, 13, -1, 13, 54, 27525 }, // ₀
+    { 8, 17, 13, 1, 12, 34, 27579 }, // ₁
+    { 13, 17, 13, -2, 12, 56, 27613 }, // ₂
+    { 13, 18, 13, -2, 13, 59, 27669 }, // ₃
+    { 13, 17, 13, -2, 12, 56, 27728 }, // ₄
+    { 13, 17, 13, -2, 12, 56, 27784 }, // ₅
+    { 13, 17, 13, -1, 12, 56, 27840 }, // ₆
+    { 13, 17, 13, -1, 12, 56, 27896 }, // ₇
+    { 12, 17, 13, -1, 12, 51, 27952 }, // ₈
+    { 12, 17, 13, -1, 12, 51, 28003 }, // ₉
+    { 11, 11, 13, -1, 8, 31, 28054 }, // ₊
+    { 11, 3, 13, -1, 4, 9, 28085 }, // ₋
+    { 11, 7, 13, -1, 6, 20, 28094 }, // ₌
+    { 9, 21, 7, 0, 14, 48, 28114 }, // ₍
+    { 9, 21, 7, -5, 14, 48, 28162 }, // ₎
+    { 13, 13, 14, -1, 9, 43, 28210 }, // ₐ
+    { 11, 13, 12, -1, 9, 36, 28253 }, // ₑ
+    { 12, 13, 14, -1, 9, 39, 28289 }, // ₒ
+    { 14, 13, 12, -3, 9, 46, 28328 }, // ₓ
+    { 11, 13, 12, -2, 9, 36, 28374 }, // ₔ
+    { 13, 18, 16, 0, 14, 59, 28410 }, // ₕ
+    { 13, 18, 13, 0, 14, 59, 28469 }, // ₖ
+    { 7, 18, 9, 0, 14, 32, 28528 }, // ₗ
+    { 20, 13, 24, 0, 9, 65, 28560 }, // ₘ
+    { 13, 13, 14, -2, 9, 43, 28625 }, // ₙ
+    { 14, 18, 14, -3, 9, 63, 28668 }, // ₚ
+    { 10, 13, 12, -1, 9, 33, 28731 }, // ₛ
+    { 8, 16, 8, -1, 12, 32, 28764 }, // ₜ
+    { 20, 28, 21, 2, 28, 140, 28796 }, // ₠
+    { 21, 32, 21, 2, 29, 168, 28936 }, // ₡
+    { 20, 29, 21, 2, 28, 145, 29104 }, // ₢
+    { 22, 27, 21, 0, 27, 149, 29249 }, // ₣
+    { 23, 28, 21, -1, 28, 161, 29398 }, // ₤
+    { 30, 30, 33, 1, 25, 225, 29559 }, // ₥
+    { 22, 27, 21, 0, 27, 149, 29784 }, // ₦
+    { 26, 28, 28, 1, 27, 182, 29933 }, // ₧
+    { 31, 28, 30, 0, 27, 217, 30115 }, // ₨
+    { 27, 27, 23, 0, 27, 183, 30332 }, // ₩
+    { 30, 27, 30, 1, 27, 203, 30515 }, // ₪
+    { 25, 35, 22, 0, 29, 219, 30718 }, // ₫
+    { 22, 29, 21, 1, 28, 160, 30937 }, // €
+    { 24, 27, 21, 1, 27, 162, 31097 }, // ₭
+    { 22, 27, 19, 1, 27, 149, 31259 }, // ₮
+    { 36, 37, 36, 0, 28, 333, 31408 }, // ₯
+    { 23, 37, 21, -2, 28, 213, 31741 }, // ₰
+    { 22, 27, 21, 1, 27, 149, 31954 }, // ₱
+    { 23, 32, 25, 2, 29, 184, 32103 }, // ₲
+    { 26, 27, 21, -3, 27, 176, 32287 }, // ₳
+    { 22, 29, 19, -1, 28, 160, 32463 }, // ₴
+    { 22, 32, 22, 2, 29, 176, 32623 }, // ₵
+    { 22, 26, 21, 1, 25, 143, 32799 }, // ₶
+    { 27, 31, 25, -1, 28, 210, 32942 }, // ₷
+    { 20, 27, 18, 2, 27, 135, 33152 }, // ₸
+    { 19, 27, 21, 3, 27, 129, 33287 }, // ₹
+    { 21, 28, 21, 0, 27, 147, 33416 }, // ₺
+    { 24, 29, 25, 2, 28, 174, 33563 }, // ₻
+    { 27, 27, 28, -1, 27, 183, 33737 }, // ₼
+    { 24, 27, 22, -1, 27, 162, 33920 }, // ₽
+    { 25, 31, 22, -1, 31, 194, 34082 }, // ₾
+    { 20, 35, 21, 1, 31, 175, 34276 }, // ₿
+    { 11, 4, 12, 0, 12, 11, 34451 }, // −
+    { 34, 38, 24, -5, 29, 323, 34462 }, // ﬀ
+    { 28, 38, 22, -5, 29, 266, 34785 }, // ﬁ
+    { 28, 38, 22, -5, 29, 266, 35051 }, // ﬂ
+    { 40, 38, 34, -5, 29, 380, 35317 }, // ﬃ
+    { 40, 38, 34, -5, 29, 380, 35697 }, // ﬄ
+    { 30, 38, 23, -5, 29, 285, 36077 }, // ﬅ
+    { 30, 30, 29, 0, 29, 225, 36362 }, // ﬆ
+    { 35, 35, 38, 1, 29, 307, 36587 }, // �
 };
 
 static const EpdUnicodeInterval notosans_18_italicIntervals[] = {
@@ -3569,31 +3599,302 @@ static const EpdUnicodeInterval notosans_18_italicIntervals[] = {
     { 0x2090, 0x209C, 0x33D },
     { 0x20A0, 0x20BF, 0x34A },
     { 0x2212, 0x2212, 0x36A },
-    { 0xFFFD, 0xFFFD, 0x36B },
+    { 0xFB00, 0xFB06, 0x36B },
+    { 0xFFFD, 0xFFFD, 0x372 },
 };
 
 static const EpdFontGroup notosans_18_italicGroups[] = {
-    { 0, 5224, 11415, 97, 0 },
-    { 5224, 4897, 13535, 96, 97 },
-    { 10121, 7179, 21320, 128, 193 },
-    { 17300, 1822, 2806, 112, 321 },
-    { 19122, 16077, 43087, 256, 433 },
-    { 35199, 3039, 7298, 111, 689 },
-    { 38238, 1258, 1895, 42, 800 },
-    { 39496, 2953, 5655, 32, 842 },
-    { 42449, 14, 11, 1, 874 },
-    { 42463, 150, 307, 1, 875 },
+    { 0, 6901, 19386, 151, 2 },
+    { 6901, 4425, 10182, 66, 434 },
+    { 11326, 16530, 42992, 366, 0 },
+    { 27856, 15122, 36894, 300, 576 },
+};
+
+static const uint8_t notosans_18_italicGlyphGroups[883] = {
+    2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2,
+    2, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 2, 2,
+    2, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 0, 0, 3, 3, 3, 0, 0, 3, 3, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+};
+
+static const uint8_t notosans_18_italicKernLeftClasses[883] = {
+    0, 0, 75, 0, 2, 0, 0, 0, 61, 2, 19, 0, 0, 0, 7, 24,
+    7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 13, 53, 45, 16, 37, 65, 0, 0, 0, 0, 45, 20, 0,
+    0, 16, 42, 16, 0, 0, 10, 53, 39, 39, 45, 15, 69, 19, 0, 0,
+    0, 73, 0, 0, 36, 78, 0, 36, 58, 0, 0, 0, 0, 63, 0, 0,
+    0, 36, 36, 0, 29, 0, 60, 0, 28, 28, 63, 28, 0, 19, 0, 0,
+    0, 0, 71, 0, 0, 0, 0, 0, 0, 0, 0, 0, 44, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 0, 0, 0,
+    59, 13, 13, 13, 13, 13, 13, 37, 45, 37, 37, 37, 37, 0, 0, 0,
+    0, 16, 0, 16, 16, 16, 16, 16, 0, 16, 53, 53, 53, 53, 15, 42,
+    0, 0, 0, 0, 0, 0, 0, 36, 0, 36, 36, 36, 36, 0, 0, 0,
+    67, 36, 0, 36, 36, 36, 36, 36, 0, 36, 0, 0, 0, 0, 28, 36,
+    28, 13, 0, 13, 0, 13, 0, 45, 0, 45, 0, 45, 0, 45, 0, 16,
+    30, 16, 0, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 62, 0, 67, 0, 0, 37,
+    0, 0, 0, 0, 0, 0, 0, 45, 63, 63, 20, 0, 20, 0, 20, 30,
+    20, 0, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 36, 16,
+    36, 16, 36, 37, 36, 0, 29, 0, 29, 0, 29, 0, 0, 0, 0, 0,
+    0, 0, 0, 10, 60, 10, 66, 10, 60, 53, 0, 53, 0, 53, 0, 53,
+    0, 53, 0, 53, 0, 39, 28, 15, 28, 15, 69, 0, 69, 0, 69, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 14, 12, 32, 74, 0, 0, 72, 14, 14, 48, 9, 0, 1,
+    0, 5, 57, 47, 12, 4, 0, 9, 47, 0, 0, 9, 0, 0, 0, 11,
+    0, 26, 32, 12, 1, 41, 9, 4, 0, 0, 4, 14, 0, 14, 11, 11,
+    0, 46, 54, 38, 34, 43, 34, 21, 38, 46, 46, 49, 46, 46, 46, 3,
+    31, 3, 21, 31, 18, 3, 49, 23, 46, 46, 23, 6, 46, 6, 3, 3,
+    46, 34, 34, 50, 34, 21, 70, 0, 56, 68, 6, 6, 31, 49, 46, 18,
+    46, 1, 52, 40, 6, 32, 0, 5, 35, 5, 35, 0, 0, 0, 0, 47,
+    38, 0, 0, 11, 3, 1, 52, 1, 52, 18, 18, 11, 3, 11, 3, 1,
+    52, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 43, 40, 6, 26,
+    3, 8, 51, 17, 55, 0, 27, 22, 0, 47, 38, 22, 0, 9, 21, 9,
+    21, 9, 21, 4, 43, 17, 51, 0, 27, 0, 3, 32, 0, 8, 43, 25,
+    64, 25, 64, 22, 0, 4, 43, 4, 43, 0, 0, 0, 27, 46, 34, 46,
+    34, 0, 9, 21, 0, 21, 4, 43, 0, 0, 4, 43, 0, 0, 4, 43,
+    0, 5, 0, 5, 0, 0, 34, 0, 34, 11, 3, 11, 3, 9, 21, 47,
+    38, 0, 0, 0, 0, 0, 0, 11, 3, 11, 3, 11, 3, 11, 3, 1,
+    18, 1, 18, 1, 18, 0, 46, 8, 51, 0, 46, 17, 55, 22, 0, 9,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 24, 24, 24, 0, 0, 2, 2, 7, 0, 2, 2, 7,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 44, 33, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 76, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 77, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 58, 0, 0, 0, 0,
+    0, 0, 0,
+};
+
+static const uint8_t notosans_18_italicKernRightClasses[883] = {
+    0, 0, 0, 73, 7, 0, 0, 0, 66, 7, 0, 26, 0, 0, 2, 24,
+    2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 33, 0, 0,
+    0, 61, 0, 10, 0, 4, 0, 0, 0, 4, 0, 0, 46, 0, 0, 0,
+    0, 4, 0, 4, 0, 0, 16, 53, 42, 42, 65, 27, 0, 0, 0, 26,
+    0, 0, 0, 13, 0, 1, 1, 1, 59, 37, 0, 0, 59, 0, 0, 12,
+    12, 1, 12, 1, 12, 38, 0, 12, 22, 22, 0, 22, 52, 0, 0, 26,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 44, 0, 0, 0,
+    0, 10, 10, 10, 10, 10, 10, 72, 4, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4, 4, 4, 4, 4, 0, 4, 53, 53, 53, 53, 27, 0,
+    59, 1, 13, 13, 13, 13, 13, 13, 1, 1, 1, 1, 1, 0, 0, 0,
+    0, 0, 12, 1, 1, 1, 1, 1, 0, 1, 12, 12, 12, 12, 22, 0,
+    22, 10, 13, 10, 13, 10, 13, 4, 1, 4, 1, 4, 1, 4, 1, 0,
+    1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 4, 37, 4,
+    37, 4, 37, 4, 37, 0, 0, 0, 71, 0, 62, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 59, 0, 0, 12, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 12, 0, 12, 0, 12, 0, 0, 12, 4, 1, 4,
+    1, 4, 1, 4, 1, 0, 12, 0, 12, 0, 0, 0, 38, 0, 38, 0,
+    38, 0, 38, 16, 0, 16, 0, 16, 0, 53, 12, 53, 12, 53, 12, 53,
+    12, 53, 12, 53, 12, 42, 22, 27, 22, 27, 0, 52, 0, 52, 0, 52,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 3, 0, 36, 70, 0, 0, 34, 30, 0, 3, 0, 0, 15,
+    0, 11, 0, 0, 0, 48, 0, 19, 40, 0, 0, 0, 30, 0, 0, 36,
+    0, 0, 36, 3, 15, 45, 19, 0, 5, 0, 0, 3, 0, 0, 40, 0,
+    68, 18, 69, 18, 35, 58, 18, 20, 35, 49, 49, 33, 29, 33, 33, 18,
+    33, 33, 18, 33, 9, 18, 64, 49, 6, 49, 49, 17, 49, 49, 20, 33,
+    67, 18, 18, 23, 35, 18, 63, 0, 60, 50, 29, 33, 23, 33, 49, 9,
+    49, 43, 47, 56, 0, 0, 21, 11, 31, 0, 21, 0, 0, 0, 21, 40,
+    35, 5, 21, 14, 8, 43, 47, 43, 47, 14, 8, 14, 8, 14, 8, 43,
+    47, 14, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 56, 23, 0,
+    21, 0, 21, 56, 0, 0, 21, 19, 35, 40, 35, 0, 21, 0, 21, 56,
+    23, 41, 17, 0, 21, 0, 21, 0, 21, 14, 8, 14, 8, 3, 21, 54,
+    57, 54, 57, 19, 20, 41, 17, 5, 6, 5, 6, 0, 21, 32, 39, 32,
+    39, 0, 19, 20, 0, 21, 51, 31, 0, 21, 0, 21, 5, 6, 0, 21,
+    0, 11, 55, 11, 55, 11, 55, 0, 8, 56, 35, 56, 35, 19, 20, 40,
+    35, 0, 0, 0, 21, 0, 21, 14, 8, 14, 8, 14, 8, 40, 20, 15,
+    9, 15, 9, 15, 9, 5, 6, 0, 21, 0, 49, 56, 0, 19, 20, 19,
+    20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 24, 24, 24, 0, 0, 25, 7, 2, 0, 25, 7, 2,
+    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28, 44, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 74, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 75, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 59, 0, 0, 0, 0,
+    0, 0, 0,
+};
+
+static const int8_t notosans_18_italicKernMatrix[6004] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -3, 0, 0, 0, -1, 0, -1, 0, 0, -3, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 2, -1, 0, 0, 0, -2, -2, -3, -2, -1, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, -1, 0, 0, -3, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, 1, 0, 1, 0, 0, -2, 1, -3, -3, -1, -2, 0, 1, 1, 0, 0, 1, 0, 0, 0, 2, 0, 0, 0, 0, 0, -1, -2, -3, 0, 0, 0, 0, 0, -1, -1, 0, 2, 0, 1, 0, 0, 0, 0, 0, -2, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 2, 0, 3, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, -1, -3, 0, -1, -1, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, -2, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 2, 1, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, -3, -2, -3, 0, -1, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 1, 1, 0, -2, 0, 1, 0, -2, 0, 0, 0, 0, -2, 0, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -3, 0, -4, -3, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, -1, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, -2, -3, -2, 0, 0, 0, 0, 0, 0, 0, -2, 0, -3, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -3, -2, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, -2, 0, -3, -2, 0, -2, 0, 0, -1, 0, 0, -2, 0, 0, -1, -2, 0, 0, -2, 0, 0, 0, -2, 0, 0, -2, -2, 0, 0, -1, 0, 0, 0, -3, 0, 0, 0, 0, -2, -2, 0, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, -1, 0, 0, 0, -2, 0, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -3, -2, 0, -1, 0, 0, 0, 0, 0, -2, 0, -2, -3, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -3, -2, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, -2, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, -2, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, -1, -3, 0, -1, 0, 0, 2, -2, 0, 1, 0, 0, -3, -2, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -2, -1, 0, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -3, 0, -3, -1, -3, 0, -1, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, -2, 0, -1, 0, 0, 0, 0, 0, -1, 0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 1, 0, 0, -2, 0, -2, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, 1, -1, 0, 0, 0, 0, 0, 0, -2, -1, 0, 0, -1, 0, 0, 0, -1, 0, 1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, -2, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, -1, 3, 0, 2, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 8, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, -2, -1, -1, 0, 0, 0, 1, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, -1, 2, 0, 0, 1, 2, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 2, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, -2, 0, -2, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -2, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -5, -1, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -3, -3, 0, -1, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -4, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 2, 0, 0,
+    0, 0, 0, -2, 0, -1, -1, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -1, -3, -1, -1, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -2, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, -2, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -5, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -3, 0, -3, -1, -3, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -3, 0, 0, -1, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -2, 0, -1, -1, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const EpdLigaturePair notosans_18_italicLigatures[] = {
+    { 0x66, 0x66, 0xFB00 },
+    { 0x66, 0x69, 0xFB01 },
+    { 0x66, 0x6C, 0xFB02 },
+    { 0xFB00, 0x69, 0xFB03 },
+    { 0xFB00, 0x6C, 0xFB04 },
+};
+
+static const uint16_t notosans_18_italicGlyphLookup[368] = {
+    0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0001, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, 0x0010, 0x0011,
+    0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, 0x0020, 0x0021,
+    0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, 0x0030, 0x0031,
+    0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, 0x0040, 0x0041,
+    0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051,
+    0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, 0x0060, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070,
+    0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, 0x0080,
+    0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F, 0x0090,
+    0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F, 0x00A0,
+    0x00A1, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF, 0x00B0,
+    0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF, 0x00C0,
+    0x02B1, 0x02B2, 0x02B3, 0x02B4, 0x02B5, 0x02B6, 0x02B7, 0x02B8, 0x02B9, 0x02BA, 0x02BB, 0x02BC, 0x02BD, 0x02BE, 0x02BF, 0x02C0,
+    0x02C1, 0x02C2, 0x02C3, 0x02C4, 0x02C5, 0x02C6, 0x02C7, 0x02C8, 0x02C9, 0x02CA, 0x02CB, 0x02CC, 0x02CD, 0x02CE, 0x02CF, 0x02D0,
+    0x02D1, 0x02D2, 0x02D3, 0x02D4, 0x02D5, 0x02D6, 0x02D7, 0x02D8, 0x02D9, 0x02DA, 0x02DB, 0x02DC, 0x02DD, 0x02DE, 0x02DF, 0x02E0,
+    0x02E1, 0x02E2, 0x02E3, 0x02E4, 0x02E5, 0x02E6, 0x02E7, 0x02E8, 0x02E9, 0x02EA, 0x02EB, 0x02EC, 0x02ED, 0x02EE, 0x02EF, 0x02F0,
+    0x02F1, 0x02F2, 0x02F3, 0x02F4, 0x02F5, 0x02F6, 0x02F7, 0x02F8, 0x02F9, 0x02FA, 0x02FB, 0x02FC, 0x02FD, 0x02FE, 0x02FF, 0x0300,
+    0x0301, 0x0302, 0x0303, 0x0304, 0x0305, 0x0306, 0x0307, 0x0308, 0x0309, 0x030A, 0x030B, 0x030C, 0x030D, 0x030E, 0x030F, 0x0310,
+    0x0311, 0x0312, 0x0313, 0x0314, 0x0315, 0xFFFF, 0x0316, 0x0317, 0x0318, 0x0319, 0x031A, 0x031B, 0x031C, 0x031D, 0x031E, 0x031F,
 };
 
 static const EpdFontData notosans_18_italic = {
     notosans_18_italicBitmaps,
     notosans_18_italicGlyphs,
     notosans_18_italicIntervals,
-    15,
+    16,
     51,
     41,
     -11,
     true,
     notosans_18_italicGroups,
-    10,
+    4,
+    notosans_18_italicKernLeftClasses,
+    notosans_18_italicKernRightClasses,
+    notosans_18_italicKernMatrix,
+    76,
+    notosans_18_italicLigatures,
+    5,
+    0x4000000001ull,
+    notosans_18_italicGlyphLookup,
+    notosans_18_italicGlyphGroups,
+    false,
+    nullptr,
 };
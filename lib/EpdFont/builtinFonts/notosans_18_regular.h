@@ -3,2356 +3,2384 @@
  * name: notosans_18_regular
  * size: 18
  * mode: 2-bit  compressed: true
- * Command used: fontconvert.py notosans_18_regular 18 ../builtinFonts/source/NotoSans/NotoSans-Regular.ttf --2bit --compress
+ * Command used: fontconvert.py notosans_18_regular 18 ../builtinFonts/source/NotoSans/NotoSans-Regular.ttf --2bit --compress --frequency-corpus ../../../test/hyphenation_eval/resources/english_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/french_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/german_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/italian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/russian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/spanish_hyphenation_tests.txt
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t notosans_18_regularBitmaps[37491] = {
-    0xD5, 0x5A, 0x3F, 0x8C, 0xDE, 0x46, 0x76, 0x1F, 0x92, 0x58, 0x13, 0x36, 0x8B, 0x71, 0x61, 0xA5,
-    0x88, 0x80, 0xF0, 0x8A, 0x14, 0x97, 0x0B, 0x70, 0x6C, 0xD3, 0x68, 0x49, 0x9D, 0x91, 0x18, 0x88,
-    0x0B, 0xA9, 0xD0, 0xEA, 0x0A, 0x17, 0x6A, 0x0F, 0x3E, 0x20, 0xDB, 0xA4, 0x48, 0x11, 0xED, 0x50,
-    0x76, 0xE1, 0xC2, 0x85, 0x04, 0x24, 0x4A, 0x93, 0x22, 0x57, 0xDC, 0x01, 0xF6, 0xBA, 0x50, 0x1D,
-    0x64, 0xB5, 0xA4, 0xA2, 0xE2, 0x0A, 0x15, 0x4B, 0x5B, 0x50, 0x5C, 0xB8, 0x10, 0x1D, 0xC9, 0x10,
-    0x6C, 0x17, 0x4B, 0x4B, 0xD4, 0x2D, 0xB5, 0xE2, 0x70, 0xEE, 0xF7, 0x7B, 0xC3, 0xEF, 0xDB, 0xD5,
-    0xEA, 0x24, 0x5B, 0xB6, 0x11, 0x20, 0xDF, 0x2E, 0x87, 0xC3, 0xE1, 0xFC, 0x79, 0xF3, 0xFE, 0xBF,
-    0x37, 0xCC, 0xAE, 0x8F, 0x39, 0xFE, 0xFF, 0x7B, 0xCC, 0xDE, 0x19, 0xF0, 0x9F, 0x5E, 0xE8, 0xD3,
-    0x93, 0x7D, 0x5A, 0xF4, 0xBA, 0xE8, 0xB4, 0x3A, 0xAD, 0x94, 0x5A, 0x89, 0x46, 0x73, 0xD3, 0xE6,
-    0xF5, 0x69, 0x13, 0x3E, 0x1A, 0x93, 0xBD, 0x2E, 0xFB, 0x8F, 0x72, 0x63, 0x35, 0x18, 0x86, 0xF8,
-    0x66, 0xAB, 0x4F, 0x15, 0x27, 0x4E, 0xA8, 0xAE, 0x8F, 0x6A, 0xA5, 0x7E, 0x8E, 0x3F, 0xA5, 0x72,
-    0xB5, 0x8A, 0x72, 0x55, 0xCA, 0xF3, 0xEA, 0x04, 0xCA, 0x2D, 0xF5, 0xCF, 0x52, 0x6E, 0xA1, 0x1C,
-    0xF1, 0xA7, 0xD4, 0x80, 0xBF, 0xC4, 0xE1, 0x37, 0x4A, 0x69, 0x5F, 0xFA, 0x68, 0xFF, 0xA3, 0xFD,
-    0x0F, 0x54, 0xD4, 0x45, 0x9D, 0x52, 0x51, 0x1B, 0xB5, 0x28, 0x9B, 0xA8, 0x51, 0x2A, 0xAE, 0x63,
-    0x94, 0x49, 0x9D, 0xD4, 0xEA, 0xD8, 0xB9, 0x5B, 0xE7, 0x6E, 0x9D, 0xCE, 0xD9, 0xBF, 0xF3, 0xA5,
-    0xCA, 0x8A, 0xB4, 0x50, 0x2A, 0xC3, 0x1F, 0x97, 0xCD, 0x97, 0xCB, 0xAE, 0xCA, 0xB2, 0xE7, 0xF1,
-    0xA7, 0xB0, 0xF4, 0xD6, 0x72, 0x71, 0xD9, 0x0C, 0x3B, 0x87, 0xDD, 0x5C, 0xA9, 0xDC, 0x80, 0xCB,
-    0xF5, 0x99, 0x7B, 0xEC, 0xA2, 0x21, 0x0B, 0x7E, 0x53, 0xE1, 0x55, 0xD2, 0xE2, 0xD5, 0x36, 0x2A,
-    0x71, 0x87, 0x4A, 0xFE, 0x49, 0xA7, 0x42, 0xE7, 0x00, 0x85, 0x7B, 0xC4, 0x62, 0x02, 0x54, 0xCE,
-    0x62, 0x78, 0xD5, 0x63, 0x1E, 0x53, 0x63, 0x9E, 0x11, 0x15, 0xDD, 0xA0, 0x62, 0x51, 0x49, 0x6F,
-    0x14, 0x59, 0x32, 0x60, 0x52, 0xC7, 0xBD, 0x95, 0xC7, 0x71, 0x1D, 0x59, 0x54, 0x2A, 0x87, 0x7E,
-    0xA6, 0x95, 0x76, 0x83, 0x35, 0x74, 0xA9, 0xF2, 0x37, 0x01, 0x41, 0xAD, 0xD2, 0x62, 0x4B, 0xC5,
-    0xAD, 0xD2, 0xB5, 0x2E, 0x81, 0x14, 0x60, 0xA6, 0x0D, 0x06, 0x22, 0x4E, 0x10, 0xB8, 0x8A, 0xCD,
-    0x9E, 0x67, 0x6F, 0x5D, 0xE7, 0x82, 0xB0, 0x2E, 0x2B, 0xE4, 0xA5, 0x2E, 0xCF, 0x90, 0x00, 0xC9,
-    0x35, 0xD7, 0x26, 0x75, 0xFA, 0xFA, 0xE7, 0x80, 0x76, 0xD0, 0xD7, 0x3B, 0xAB, 0x9B, 0x6C, 0xF7,
-    0xF3, 0x61, 0x55, 0x0D, 0x91, 0x6B, 0xC7, 0xB4, 0xC8, 0xD5, 0x9F, 0x97, 0xE7, 0x05, 0xAB, 0x2A,
-    0x0F, 0xBB, 0xA0, 0xC7, 0xFA, 0xC5, 0x28, 0x33, 0x62, 0x3E, 0xE0, 0x94, 0xAF, 0x80, 0xF8, 0xA8,
-    0x0D, 0xBB, 0x90, 0x8B, 0xE3, 0xD5, 0xA8, 0xB0, 0xBE, 0x2E, 0x57, 0x49, 0xC2, 0xB0, 0xCF, 0x0B,
-    0xF6, 0xCE, 0xB1, 0x35, 0xAE, 0xCF, 0x1D, 0x92, 0x4D, 0x0E, 0xB6, 0x94, 0x4A, 0x13, 0xD0, 0xD6,
-    0x70, 0xCF, 0xFB, 0x15, 0x16, 0x52, 0x93, 0xCA, 0xD1, 0x18, 0x77, 0xAA, 0x62, 0x87, 0x32, 0x20,
-    0x23, 0x18, 0x3E, 0x73, 0x4A, 0xBE, 0x8A, 0x86, 0x90, 0x6D, 0x71, 0x9F, 0x71, 0x54, 0xF2, 0xD8,
-    0x72, 0x26, 0x2D, 0x53, 0xA8, 0x8C, 0x6F, 0x80, 0xF8, 0x5E, 0x05, 0x67, 0x54, 0x75, 0x1B, 0xA0,
-    0x34, 0xC9, 0xA8, 0x07, 0x92, 0xBD, 0xD4, 0x18, 0x87, 0x91, 0x7A, 0xD0, 0x8D, 0x06, 0xC6, 0x06,
-    0xA3, 0x00, 0x9E, 0x7E, 0xDC, 0x83, 0x1C, 0xA0, 0x57, 0x1D, 0x01, 0x6F, 0x7A, 0x54, 0x09, 0x16,
-    0x32, 0x83, 0x4A, 0x7B, 0x00, 0x37, 0xA8, 0x6C, 0xFA, 0xC8, 0xDD, 0x18, 0x55, 0x06, 0xDA, 0x27,
-    0xA3, 0x3A, 0x0E, 0x82, 0xE2, 0xA6, 0xCE, 0x08, 0x39, 0x8C, 0xD9, 0x58, 0x5D, 0x5D, 0x3D, 0x01,
-    0xBE, 0x16, 0xDC, 0x6F, 0xAB, 0x94, 0x73, 0x18, 0xF0, 0x05, 0x66, 0x4C, 0xEB, 0x90, 0xD0, 0x46,
-    0x3D, 0x96, 0x06, 0xEC, 0xE6, 0x68, 0xC1, 0x17, 0x45, 0x88, 0x75, 0x6A, 0x74, 0x06, 0x38, 0xD2,
-    0x82, 0x87, 0x89, 0x68, 0x4C, 0xCB, 0xF3, 0x40, 0x71, 0xC0, 0x09, 0xD0, 0x79, 0xE2, 0xC4, 0x3D,
-    0x6E, 0x59, 0x8D, 0x27, 0x8B, 0x71, 0xBA, 0xC5, 0xC8, 0x6D, 0x95, 0x95, 0x89, 0xAF, 0x60, 0x6F,
-    0x4D, 0xD4, 0xA1, 0x3F, 0xAA, 0x45, 0x5A, 0x6B, 0x10, 0x3A, 0x1C, 0xF0, 0x68, 0xD5, 0x06, 0x00,
-    0x0D, 0x3E, 0x50, 0xCA, 0xE3, 0x2F, 0xAD, 0x05, 0x97, 0x22, 0x59, 0xE4, 0x07, 0x15, 0xDD, 0xD5,
-    0xC5, 0x86, 0x76, 0x1B, 0xD5, 0x68, 0x28, 0x29, 0xC7, 0xAE, 0xEC, 0xAF, 0xA1, 0x03, 0x85, 0x6B,
-    0x8F, 0xCC, 0x76, 0xAA, 0x51, 0xC1, 0x88, 0x41, 0xBA, 0xCD, 0x6B, 0xE5, 0x54, 0x55, 0xA8, 0x7F,
-    0x52, 0x4B, 0xA6, 0x7C, 0x6D, 0xC1, 0xA2, 0x64, 0x0F, 0x61, 0x58, 0x11, 0x9E, 0x27, 0x9A, 0x7E,
-    0xB6, 0x39, 0x6D, 0xFE, 0x96, 0x42, 0x78, 0x87, 0x45, 0xF9, 0x8C, 0x5E, 0x47, 0x9A, 0x82, 0xD3,
-    0x59, 0xED, 0xA2, 0x3E, 0xAD, 0x4D, 0xD8, 0xEB, 0x7A, 0x35, 0xE8, 0xD4, 0xDB, 0x9B, 0xFF, 0xEE,
-    0xA6, 0xCA, 0x7D, 0xBE, 0x76, 0x66, 0xA9, 0x62, 0xD0, 0xB5, 0x21, 0x43, 0x00, 0x09, 0xC4, 0x1C,
-    0x77, 0x05, 0xBC, 0xB3, 0x01, 0xF0, 0x86, 0x3D, 0x05, 0x5D, 0xF6, 0x6C, 0xC9, 0xAC, 0x0A, 0x58,
-    0x22, 0xB1, 0xD9, 0xB0, 0x2D, 0x0D, 0xE4, 0x2A, 0x34, 0x44, 0x73, 0x43, 0x23, 0x0D, 0x9C, 0xAA,
-    0x9B, 0x11, 0x24, 0xBF, 0x6C, 0xC2, 0x18, 0xC2, 0x6D, 0xF6, 0x5D, 0x19, 0x8D, 0xCA, 0x14, 0x59,
-    0x0D, 0xB6, 0xC4, 0x9C, 0x16, 0x53, 0x85, 0x03, 0x06, 0xC4, 0x1D, 0x57, 0xB8, 0xCE, 0x05, 0x81,
-    0x2D, 0x65, 0xC9, 0xE7, 0x03, 0xE6, 0x4A, 0xEE, 0x60, 0xA6, 0xEC, 0x22, 0xB6, 0xB3, 0xBD, 0x68,
-    0xD2, 0x37, 0x97, 0xBD, 0x64, 0x25, 0x43, 0x58, 0x31, 0x7A, 0x02, 0xA7, 0xC4, 0x1D, 0x59, 0xA7,
-    0x8C, 0xA7, 0x5F, 0x8F, 0xD4, 0x78, 0x35, 0x96, 0x25, 0x89, 0xCE, 0x78, 0xBC, 0xE4, 0x4D, 0xEC,
-    0x8A, 0xCA, 0xEA, 0xBD, 0x87, 0xEE, 0xD4, 0xCD, 0x2E, 0xFF, 0x3B, 0x40, 0x80, 0x3D, 0x03, 0x6A,
-    0x6C, 0xE1, 0x45, 0xAA, 0xF2, 0xAB, 0xB0, 0x29, 0xF0, 0x73, 0x1D, 0xBB, 0xAF, 0x5D, 0x9D, 0xB5,
-    0xAA, 0x2A, 0x7F, 0xAA, 0x44, 0xD6, 0xB8, 0x2F, 0xC1, 0x25, 0x7B, 0x0B, 0x7A, 0x04, 0x2B, 0x82,
-    0x57, 0xD1, 0x9A, 0x94, 0x10, 0x30, 0x21, 0x40, 0x62, 0x33, 0xA5, 0x2F, 0xB4, 0x87, 0x2B, 0x29,
-    0x2A, 0xC1, 0x53, 0x15, 0xB5, 0xA4, 0xFF, 0x45, 0x5C, 0x93, 0xC0, 0x10, 0x54, 0xAE, 0x80, 0x22,
-    0x73, 0xB5, 0x76, 0x5F, 0x01, 0x88, 0x4B, 0xAA, 0xAA, 0xFF, 0xF2, 0x4F, 0x03, 0xC1, 0xA7, 0x71,
-    0x5E, 0xF6, 0x2D, 0xCB, 0xC9, 0x40, 0x35, 0x87, 0x2D, 0xBC, 0xF2, 0x91, 0x23, 0xFB, 0x88, 0xCA,
-    0xA0, 0x56, 0xF0, 0x64, 0x5B, 0x8E, 0x16, 0x56, 0xAF, 0x04, 0xE8, 0x7F, 0xC4, 0xBB, 0x6B, 0xEE,
-    0x77, 0xEB, 0x16, 0xA4, 0x74, 0xCD, 0x4B, 0x8E, 0x98, 0x5D, 0x39, 0x2D, 0x70, 0xC8, 0xC0, 0x4C,
-    0x44, 0x63, 0x14, 0x25, 0xC2, 0xED, 0xDE, 0xC6, 0xD0, 0xF8, 0x1E, 0x85, 0xE0, 0x9B, 0x91, 0xB3,
-    0x61, 0xE2, 0x70, 0xE0, 0x7C, 0xA3, 0x30, 0x14, 0x71, 0xB2, 0xCD, 0xD5, 0x0C, 0x17, 0x11, 0xE9,
-    0xCE, 0x0A, 0x34, 0xA6, 0x60, 0x13, 0xB2, 0x16, 0xE4, 0xAF, 0x21, 0x3D, 0xB9, 0xE3, 0x81, 0xC5,
-    0x94, 0x7B, 0xE6, 0xF7, 0x32, 0x28, 0x28, 0xF5, 0xC0, 0x0A, 0x8C, 0x8B, 0x46, 0x0D, 0xFB, 0x46,
-    0x54, 0x35, 0xAC, 0x48, 0x27, 0x4C, 0x48, 0x65, 0xEA, 0x2B, 0x64, 0x69, 0x45, 0xED, 0x2D, 0x95,
-    0xFC, 0x6F, 0x4F, 0x03, 0x0B, 0x30, 0x34, 0x39, 0x77, 0xF3, 0xE5, 0x59, 0x47, 0x12, 0x01, 0x33,
-    0x1E, 0x57, 0x32, 0xAF, 0x5D, 0xA0, 0xD0, 0xCE, 0x2D, 0x42, 0x34, 0xF3, 0xF7, 0x78, 0xE8, 0xAA,
-    0xDF, 0x5D, 0x11, 0x8B, 0x0A, 0x15, 0x87, 0x41, 0xC1, 0x99, 0x05, 0xBF, 0x1F, 0xC7, 0x3C, 0x29,
-    0x48, 0x94, 0xB8, 0xCD, 0xDF, 0x84, 0xC4, 0x85, 0xC1, 0xCA, 0x50, 0x4E, 0x1E, 0x68, 0x32, 0x04,
-    0xE5, 0x43, 0x80, 0x4F, 0xDA, 0xE3, 0xBF, 0x55, 0xDB, 0x99, 0xEB, 0xF5, 0x67, 0xCE, 0xB5, 0xD0,
-    0xB7, 0xEE, 0x14, 0x14, 0xFE, 0x48, 0xDB, 0x74, 0x1B, 0x03, 0x26, 0xEA, 0xD4, 0xAF, 0xB1, 0xFC,
-    0x36, 0xC4, 0x2B, 0x21, 0x32, 0x27, 0x2A, 0xDB, 0x4F, 0xD8, 0x47, 0x43, 0xB5, 0x17, 0xE6, 0x8B,
-    0xAA, 0x0D, 0x08, 0x7C, 0x48, 0x23, 0x49, 0x46, 0xA7, 0x06, 0x7A, 0x48, 0x4C, 0xDD, 0x9B, 0xD1,
-    0x25, 0x1C, 0x44, 0x75, 0x7C, 0xC0, 0x8A, 0xB2, 0x21, 0xB3, 0x60, 0x45, 0xD9, 0xE7, 0xB6, 0x9A,
-    0xA1, 0xCA, 0x16, 0xBB, 0x5E, 0x0E, 0x91, 0x1D, 0x13, 0xFC, 0x23, 0x43, 0x9C, 0x58, 0x0F, 0x76,
-    0x7A, 0x62, 0x88, 0xFF, 0xAD, 0x63, 0x69, 0x4D, 0x83, 0x04, 0xCE, 0x6C, 0x12, 0x68, 0xE9, 0x1A,
-    0x53, 0xE5, 0x27, 0x49, 0x74, 0x91, 0x79, 0x50, 0x38, 0x69, 0xD9, 0x54, 0x98, 0x02, 0x53, 0x56,
-    0x25, 0x4C, 0x7B, 0xB5, 0x3B, 0x10, 0xFE, 0x02, 0x9B, 0x01, 0x7F, 0xE7, 0x5F, 0xBB, 0x22, 0x1E,
-    0x03, 0x57, 0x82, 0xBB, 0xAA, 0x5F, 0x60, 0x60, 0xA5, 0x67, 0xCD, 0x10, 0x2E, 0x35, 0x43, 0x7E,
-    0xAA, 0xA5, 0x6A, 0x05, 0xBA, 0xBB, 0xFC, 0xD1, 0x59, 0x47, 0x81, 0xEC, 0xC4, 0xBC, 0x28, 0xB5,
-    0xB6, 0x84, 0x64, 0x22, 0x47, 0x02, 0x1C, 0x40, 0x52, 0x02, 0x12, 0x20, 0xAD, 0x50, 0x15, 0x37,
-    0x65, 0x45, 0x61, 0x51, 0xAF, 0x74, 0xA2, 0x57, 0xBA, 0xA5, 0xF6, 0x81, 0x42, 0xEA, 0xC1, 0xF5,
-    0x79, 0xE3, 0xA0, 0x41, 0x4E, 0xBA, 0xAF, 0xAC, 0x05, 0x92, 0xA1, 0x77, 0x0C, 0xE1, 0xF6, 0x78,
-    0x10, 0x96, 0x7A, 0x12, 0x91, 0x44, 0x5D, 0x64, 0xD5, 0xCB, 0x67, 0xB1, 0xED, 0xDC, 0xCD, 0x52,
-    0x26, 0x80, 0xBC, 0x72, 0xA0, 0x6F, 0x9F, 0xF8, 0x2D, 0xF5, 0x70, 0x58, 0xE6, 0xD7, 0xDC, 0x1B,
-    0xA0, 0xE9, 0x8A, 0x7A, 0xEA, 0xB7, 0x52, 0xE4, 0x25, 0x14, 0x65, 0x56, 0xDB, 0xA8, 0x4B, 0xCB,
-    0xAD, 0xB0, 0x5D, 0xDA, 0x8D, 0x98, 0x3C, 0x45, 0x1A, 0xC3, 0xD2, 0xAA, 0x54, 0x5C, 0xA5, 0x12,
-    0x0D, 0x00, 0xCA, 0x80, 0x2E, 0xA9, 0x5D, 0x70, 0xF3, 0x44, 0x2A, 0x8A, 0x65, 0x37, 0x42, 0x3D,
-    0x27, 0xCF, 0x9C, 0xA7, 0x92, 0xE7, 0x61, 0x9E, 0x4B, 0xA9, 0xE2, 0xD8, 0xDA, 0xDA, 0xDA, 0x29,
-    0x3A, 0x89, 0xE4, 0x9E, 0x5B, 0x78, 0x38, 0xF3, 0x34, 0x40, 0xF4, 0xB6, 0x76, 0x16, 0x7D, 0xEA,
-    0x57, 0xD9, 0x44, 0x36, 0x88, 0xAC, 0xF8, 0x0C, 0x64, 0xB2, 0x43, 0x6B, 0x4D, 0xE2, 0x99, 0x50,
-    0x41, 0x54, 0x5C, 0x01, 0x9A, 0x52, 0x1E, 0x83, 0xAA, 0xF7, 0x3D, 0xB2, 0xC9, 0x03, 0x94, 0xB8,
-    0x4B, 0x40, 0x78, 0x3B, 0x1B, 0xD5, 0x60, 0xB9, 0x18, 0x79, 0x01, 0xE2, 0xD9, 0xE4, 0x93, 0xEB,
-    0x7E, 0xAE, 0xE2, 0x61, 0x66, 0xE1, 0x71, 0x66, 0xB9, 0xD1, 0x3F, 0x8B, 0xD7, 0xD1, 0x79, 0x56,
-    0x74, 0x5E, 0x7E, 0xF9, 0x48, 0x3E, 0xCD, 0x0A, 0x35, 0xBB, 0xAC, 0x4A, 0x1D, 0x3B, 0xB4, 0x8B,
-    0x97, 0x67, 0xC1, 0xA4, 0xEA, 0xE3, 0xC5, 0xFA, 0xCB, 0xF2, 0xE6, 0xD7, 0x5F, 0xFA, 0x85, 0x9D,
-    0xC7, 0x13, 0x4C, 0x26, 0x11, 0x79, 0x49, 0xC5, 0xD6, 0xF7, 0x8A, 0x7B, 0x4F, 0x78, 0xF1, 0x27,
-    0x84, 0x01, 0xB6, 0x55, 0xB0, 0x56, 0xD0, 0xCC, 0x06, 0x54, 0xC6, 0xEF, 0x80, 0xC9, 0x40, 0xFE,
-    0xAD, 0x1C, 0x3A, 0x3D, 0x69, 0xE2, 0xEB, 0x2D, 0x38, 0x7E, 0x4B, 0x9D, 0x38, 0xAF, 0xAE, 0xC2,
-    0x30, 0x47, 0x9F, 0xD5, 0xE0, 0xA1, 0x2D, 0xB5, 0xBA, 0x85, 0x8D, 0xEA, 0x3A, 0xDA, 0xAD, 0xA1,
-    0x97, 0x46, 0x75, 0x62, 0xA4, 0xC3, 0x57, 0xC7, 0x3B, 0xF0, 0x40, 0xF1, 0xB8, 0xB5, 0x85, 0x22,
-    0xAB, 0xF5, 0xFB, 0x75, 0xD2, 0xC6, 0x36, 0xEC, 0xCE, 0xAB, 0xFC, 0x7F, 0xFE, 0xF0, 0x68, 0x82,
-    0x5B, 0xEA, 0xAC, 0x86, 0x48, 0xA8, 0x10, 0x7E, 0xCC, 0x25, 0xE1, 0xC1, 0x05, 0x1B, 0xCE, 0xD2,
-    0x4A, 0xE4, 0x11, 0xDE, 0x57, 0xE9, 0x29, 0x5E, 0x5A, 0x81, 0xB3, 0x21, 0xBE, 0x7F, 0x2F, 0xB4,
-    0x71, 0x77, 0xA5, 0xC3, 0x2C, 0x1B, 0x62, 0x91, 0x04, 0x4F, 0x8A, 0x8E, 0x1A, 0x27, 0x10, 0xAD,
-    0xBA, 0x2A, 0xE5, 0x55, 0x3A, 0x3D, 0x8A, 0xE2, 0x41, 0x21, 0x21, 0x1B, 0xF5, 0x44, 0x67, 0xD4,
-    0x51, 0x04, 0x92, 0x96, 0x83, 0x75, 0x13, 0x77, 0x0B, 0x34, 0x64, 0xA5, 0x78, 0x07, 0x42, 0x8D,
-    0x6A, 0x6D, 0xCD, 0x7A, 0x83, 0x05, 0x58, 0x58, 0x86, 0xD3, 0xE6, 0x66, 0x45, 0x2F, 0x0E, 0x9D,
-    0x39, 0x44, 0x5C, 0x47, 0xA8, 0x0B, 0x4E, 0x48, 0xCE, 0x26, 0x01, 0xBD, 0xAA, 0xF1, 0xE6, 0x47,
-    0xCC, 0xDB, 0x64, 0xDC, 0xBE, 0x98, 0x37, 0x2B, 0x4A, 0xAD, 0x36, 0x60, 0x9A, 0xD6, 0x10, 0x60,
-    0x43, 0x1A, 0x98, 0xD9, 0xA8, 0x1C, 0x14, 0x89, 0xF8, 0x02, 0x8D, 0x59, 0x3B, 0xEB, 0x0A, 0xC3,
-    0x2D, 0xFB, 0xB1, 0x78, 0x6C, 0x16, 0xC3, 0x22, 0x2E, 0x20, 0xAB, 0x04, 0xF6, 0x89, 0x42, 0x5E,
-    0xC4, 0x2C, 0xB2, 0x8E, 0xAB, 0x35, 0x2C, 0x38, 0xCB, 0xDD, 0x03, 0xAD, 0xFE, 0x48, 0x58, 0xBF,
-    0xE7, 0xC6, 0x46, 0xB2, 0xF8, 0x3F, 0x28, 0xCF, 0xD7, 0xE5, 0xD2, 0x04, 0xD6, 0x0B, 0x4D, 0x29,
-    0x7A, 0xD1, 0xDB, 0x28, 0x31, 0xC7, 0xF2, 0x46, 0xD4, 0x63, 0x78, 0xA4, 0x51, 0x7A, 0x2A, 0xD9,
-    0xB0, 0xE8, 0xD1, 0x44, 0x9E, 0xDD, 0x92, 0x26, 0x14, 0x96, 0x15, 0x28, 0xB6, 0x4D, 0x57, 0x90,
-    0x23, 0x1B, 0x52, 0x13, 0x2B, 0xAC, 0x88, 0xAA, 0x07, 0x7E, 0x02, 0x21, 0x2E, 0x6D, 0x32, 0xBD,
-    0xE5, 0x60, 0xDD, 0x8A, 0x0F, 0x27, 0xA6, 0x2F, 0x16, 0x4B, 0x1B, 0x8B, 0xD1, 0x15, 0xDC, 0xA8,
-    0xF4, 0x63, 0xB1, 0x40, 0xEF, 0x11, 0x90, 0xCA, 0x5B, 0x33, 0x36, 0xC7, 0xDF, 0x88, 0xBD, 0xFB,
-    0xFD, 0x91, 0xE6, 0xE4, 0x9B, 0x65, 0xEF, 0xC0, 0xB2, 0x59, 0x50, 0xA8, 0xCC, 0x85, 0xE5, 0xDC,
-    0x55, 0x83, 0xE6, 0x75, 0x4F, 0x9F, 0x86, 0x90, 0x0C, 0x84, 0x84, 0xE2, 0x43, 0xD4, 0xE3, 0x9A,
-    0xE4, 0x9A, 0x95, 0xE4, 0x33, 0x2F, 0x68, 0x19, 0xF4, 0x1B, 0xE5, 0x62, 0xFD, 0xDB, 0xFA, 0xFB,
-    0xF9, 0xA7, 0x43, 0xD7, 0x77, 0x5F, 0xEB, 0xE8, 0x7A, 0x9B, 0x9B, 0x1F, 0x7C, 0xA7, 0x31, 0xEA,
-    0xB0, 0x47, 0x4B, 0xCF, 0xEB, 0xAE, 0xB7, 0xB5, 0x22, 0x5D, 0x83, 0xC2, 0x63, 0x5C, 0x6B, 0x4F,
-    0xDB, 0x72, 0xE1, 0x6D, 0x79, 0x0A, 0x7B, 0xE2, 0x7A, 0x3A, 0x8B, 0xE1, 0xF4, 0xD4, 0xF7, 0x8C,
-    0x90, 0x48, 0xB8, 0x7B, 0xA5, 0x66, 0xA8, 0x8B, 0xE6, 0xCC, 0xED, 0x8B, 0xB5, 0xBD, 0x27, 0x76,
-    0xF5, 0x22, 0x59, 0x69, 0xCA, 0x45, 0x3C, 0x60, 0xB4, 0xC0, 0x5A, 0xD4, 0x48, 0xF9, 0x05, 0x96,
-    0x13, 0x19, 0x03, 0x31, 0x9C, 0xDB, 0xDF, 0x74, 0x6D, 0xE0, 0x6D, 0xFD, 0xBA, 0xB0, 0x6B, 0xB0,
-    0xE6, 0x41, 0xD5, 0xA4, 0x67, 0x20, 0x94, 0x4C, 0x5F, 0xA8, 0xFA, 0x70, 0x6D, 0xED, 0xAC, 0x44,
-    0x32, 0xEE, 0xF7, 0x92, 0x35, 0x00, 0x8E, 0x36, 0xAF, 0x7C, 0xDF, 0xC9, 0x0E, 0xAA, 0xB5, 0x71,
-    0xF7, 0x9D, 0xBB, 0x56, 0x3D, 0x02, 0x74, 0x01, 0x7D, 0x75, 0x62, 0xE3, 0xC5, 0xAA, 0x2F, 0x4D,
-    0x27, 0x9D, 0xBB, 0xC1, 0xF4, 0x00, 0xCC, 0x55, 0x45, 0xE4, 0xFD, 0xC0, 0x82, 0x31, 0x66, 0xBE,
-    0x03, 0x07, 0x73, 0x4A, 0x68, 0x24, 0x95, 0x99, 0x59, 0x3D, 0x98, 0xC8, 0xDE, 0x13, 0xA5, 0xC8,
-    0xB1, 0xD1, 0x71, 0x7D, 0xE7, 0xC3, 0x69, 0x34, 0x56, 0xEC, 0x09, 0xD5, 0x8A, 0x3D, 0x31, 0x1C,
-    0x42, 0x81, 0x3D, 0xD2, 0x0E, 0xD3, 0x80, 0xA5, 0x34, 0xFD, 0xB1, 0x83, 0x4D, 0x09, 0x60, 0xD2,
-    0xA5, 0x67, 0x49, 0x77, 0xB6, 0xE7, 0x70, 0xC7, 0xE1, 0x29, 0x03, 0xD5, 0xD0, 0x8A, 0xE3, 0x4B,
-    0x7D, 0x18, 0x8D, 0x5C, 0xC8, 0x94, 0x94, 0x5C, 0x51, 0xB2, 0x4E, 0x94, 0x64, 0xF7, 0x22, 0x8C,
-    0xF9, 0xBD, 0xAE, 0xC3, 0x42, 0x44, 0x5E, 0x4B, 0x2C, 0xA3, 0x56, 0xA5, 0xAD, 0x11, 0xE7, 0xDF,
-    0x1A, 0x51, 0x00, 0x76, 0x63, 0xBE, 0xD1, 0x49, 0xBC, 0x6A, 0x37, 0x38, 0x74, 0xB4, 0x1B, 0x50,
-    0xD8, 0xC1, 0x60, 0x37, 0x24, 0x72, 0xB4, 0x1B, 0xB0, 0x0A, 0x51, 0x87, 0x1B, 0x14, 0x54, 0x6B,
-    0x0D, 0xE0, 0xD7, 0xB5, 0x35, 0x12, 0x8C, 0x5B, 0x03, 0xCB, 0x90, 0x15, 0xD0, 0xB2, 0x88, 0xC4,
-    0x15, 0x6E, 0x8C, 0xA7, 0x71, 0xE3, 0x33, 0x6E, 0xB9, 0xBF, 0x65, 0xB0, 0x9A, 0xB8, 0xA5, 0xD7,
-    0x3B, 0xDE, 0xF4, 0xA7, 0x2D, 0x6F, 0xF4, 0x7D, 0x71, 0x8B, 0x10, 0xA3, 0xC8, 0xAD, 0xE4, 0x8D,
-    0xE6, 0xCD, 0x0A, 0x4D, 0xE4, 0x76, 0x95, 0x37, 0xE6, 0x33, 0xEE, 0x59, 0x49, 0x27, 0x50, 0xE5,
-    0xED, 0x89, 0x53, 0x64, 0x48, 0x87, 0xBD, 0x5D, 0xC6, 0xA2, 0x1B, 0xE8, 0x11, 0xEF, 0xFD, 0x2F,
-    0xB1, 0xBC, 0x01, 0x83, 0x17, 0xEF, 0xB5, 0x68, 0x30, 0x1B, 0x0C, 0x19, 0xF7, 0x5A, 0x34, 0x18,
-    0x80, 0x53, 0xC4, 0x7B, 0x1D, 0xA3, 0x53, 0xAC, 0xDE, 0xA2, 0x8A, 0x06, 0x54, 0xA3, 0x91, 0x55,
-    0x44, 0xEE, 0x58, 0xA9, 0x7A, 0x7D, 0x8F, 0xB4, 0x62, 0x35, 0xBD, 0xB3, 0x47, 0xF5, 0x67, 0x68,
-    0x39, 0x1C, 0xAB, 0xA9, 0x23, 0x56, 0x2A, 0x56, 0x23, 0xA9, 0xA6, 0xDD, 0x81, 0x2B, 0x4C, 0xA1,
-    0x14, 0xDD, 0x1D, 0x4A, 0xE8, 0x46, 0xC9, 0x35, 0x1D, 0xB7, 0x01, 0x2B, 0xEE, 0x44, 0xF1, 0x53,
-    0xBA, 0x61, 0x02, 0x25, 0xDA, 0x12, 0x03, 0x92, 0x7E, 0x2A, 0x2E, 0x95, 0x68, 0x03, 0xE5, 0xBC,
-    0xB9, 0xD8, 0x15, 0xFB, 0xF0, 0x58, 0xAC, 0xC8, 0xE4, 0x55, 0xCD, 0xA1, 0x17, 0x9A, 0x6B, 0x63,
-    0x12, 0xC9, 0xE3, 0x58, 0x3F, 0x95, 0x18, 0x93, 0xBC, 0x74, 0x12, 0x5E, 0x12, 0xA2, 0xAC, 0x0D,
-    0x19, 0x32, 0x76, 0x62, 0x50, 0x3A, 0x81, 0xAA, 0x55, 0x3E, 0x38, 0x57, 0x3E, 0x82, 0x31, 0x50,
-    0xDF, 0xF1, 0x6C, 0xFB, 0x20, 0x04, 0x81, 0xA1, 0x65, 0x35, 0x10, 0x63, 0x31, 0x93, 0x9A, 0x31,
-    0x08, 0xF7, 0x97, 0x70, 0x35, 0x6A, 0x5B, 0xFD, 0x69, 0xE7, 0xCD, 0x45, 0xF5, 0xDE, 0xC3, 0xB3,
-    0x15, 0x6D, 0xE7, 0x10, 0x8B, 0xD9, 0xDD, 0xFC, 0x57, 0x1F, 0x94, 0x99, 0x45, 0x74, 0xF6, 0x2D,
-    0x15, 0xF5, 0xFF, 0x0F, 0x5F, 0xE7, 0xBA, 0xA5, 0xBB, 0x35, 0xC7, 0xBF, 0x2A, 0xF4, 0x0F, 0xB9,
-    0x3C, 0x44, 0x3E, 0x4C, 0x3F, 0x06, 0x5C, 0x7E, 0x29, 0x9E, 0x4C, 0xEF, 0x4D, 0x06, 0x14, 0x99,
-    0xA3, 0xB0, 0x63, 0x1F, 0x54, 0xEA, 0x8B, 0x42, 0x6C, 0x74, 0xB2, 0x7C, 0xD4, 0xCD, 0xDC, 0x25,
-    0x10, 0x62, 0x88, 0x95, 0x6D, 0x59, 0x30, 0x42, 0x4E, 0x1B, 0xA6, 0xC8, 0x24, 0x05, 0xC6, 0x64,
-    0x19, 0x18, 0xD9, 0xCC, 0xAA, 0x0A, 0x6C, 0x7B, 0x78, 0xE6, 0x64, 0xE9, 0xF6, 0x48, 0x20, 0x28,
-    0xA6, 0xEB, 0x92, 0x12, 0x7F, 0x0A, 0xAA, 0x5D, 0x0F, 0xEA, 0xF8, 0x49, 0xBB, 0xC8, 0x47, 0x48,
-    0x10, 0x53, 0xCE, 0xA6, 0x29, 0x95, 0x60, 0xB8, 0x16, 0x37, 0x92, 0x11, 0x94, 0x68, 0x36, 0x29,
-    0x98, 0x23, 0xA6, 0x09, 0x4A, 0xC6, 0x45, 0x6E, 0x62, 0x5A, 0x78, 0x37, 0xD5, 0xEC, 0x00, 0x05,
-    0xF6, 0x6F, 0x00, 0xC9, 0x75, 0xB7, 0x59, 0x31, 0x7B, 0x3C, 0x06, 0xF4, 0x87, 0x25, 0x5B, 0x20,
-    0x66, 0x65, 0x9D, 0xC5, 0x67, 0x4E, 0x3C, 0x17, 0x0F, 0xD5, 0xD3, 0x81, 0xFC, 0xFF, 0x49, 0x23,
-    0x5D, 0xDC, 0x94, 0xDC, 0x10, 0x93, 0x4B, 0x02, 0x61, 0x12, 0x53, 0xFD, 0xA8, 0x8D, 0x96, 0x8D,
-    0x95, 0x59, 0x98, 0xF3, 0xF4, 0x13, 0x26, 0xBA, 0x3A, 0xD8, 0x89, 0xB4, 0x8F, 0xDC, 0x57, 0x88,
-    0x82, 0x72, 0xC1, 0x82, 0xF0, 0x15, 0x1D, 0x73, 0x09, 0xC4, 0xFF, 0x20, 0xB9, 0x1A, 0xA6, 0xC3,
-    0xD4, 0x44, 0x74, 0x7A, 0xD7, 0x3B, 0x63, 0x0C, 0x0D, 0x5C, 0x33, 0xD0, 0xEB, 0x25, 0xD3, 0x26,
-    0x9E, 0xF7, 0x44, 0xD4, 0x7B, 0x0B, 0x09, 0x2A, 0x4A, 0xAA, 0x0A, 0x74, 0x40, 0x43, 0xC0, 0x10,
-    0x82, 0xFC, 0xC1, 0x2C, 0x42, 0x27, 0x26, 0xA5, 0xA6, 0x9F, 0x8A, 0x70, 0x92, 0x80, 0x0A, 0x56,
-    0xAC, 0x4F, 0x05, 0x4B, 0xE8, 0x26, 0x02, 0xA1, 0x77, 0xCB, 0x65, 0x02, 0x58, 0x8C, 0x81, 0x84,
-    0x90, 0x73, 0xDA, 0x63, 0x0E, 0xB6, 0x24, 0x59, 0x47, 0x67, 0xFE, 0xFA, 0xE0, 0x63, 0xB6, 0x2A,
-    0xA1, 0x6C, 0x70, 0xAD, 0xB4, 0x16, 0xDE, 0xD0, 0x0D, 0x63, 0xFB, 0x0D, 0x0E, 0x99, 0x30, 0x66,
-    0x04, 0x6F, 0x61, 0x06, 0xC6, 0xEC, 0x12, 0x33, 0xE4, 0x6F, 0xB6, 0xD0, 0xFB, 0xB0, 0x15, 0x63,
-    0x3A, 0xE7, 0x67, 0xDB, 0x9C, 0xC6, 0xB8, 0xA2, 0x9D, 0xC0, 0x16, 0xD0, 0x06, 0x93, 0x88, 0x32,
-    0xEA, 0xE3, 0x2E, 0xEA, 0x12, 0x6A, 0xE0, 0xAC, 0xC4, 0xA4, 0x25, 0x76, 0x64, 0xC1, 0xA3, 0x00,
-    0x20, 0x8F, 0x3A, 0xBF, 0x07, 0xCB, 0x00, 0x2A, 0x63, 0x76, 0xF2, 0x2A, 0x2E, 0x22, 0xE7, 0x01,
-    0xF0, 0xF1, 0x00, 0xF0, 0xE9, 0x9D, 0x5A, 0x2E, 0x95, 0x6F, 0xFB, 0x4B, 0x49, 0xD4, 0xD9, 0x2B,
-    0x01, 0xD6, 0x33, 0xF7, 0x44, 0x06, 0x57, 0x7E, 0x3F, 0xC9, 0x22, 0x8A, 0x27, 0x53, 0x53, 0x10,
-    0xD2, 0x0B, 0x96, 0xC8, 0x67, 0x88, 0x24, 0xF9, 0x74, 0x49, 0x47, 0x33, 0x0F, 0x28, 0x69, 0x75,
-    0x26, 0x89, 0x81, 0x18, 0xD2, 0x40, 0xB7, 0x24, 0xBB, 0x39, 0x45, 0x29, 0x92, 0x94, 0xA3, 0xE4,
-    0xC0, 0x94, 0x11, 0x46, 0x13, 0x0E, 0x77, 0x92, 0x5C, 0xA1, 0xDE, 0x90, 0x7C, 0x18, 0xE8, 0x2A,
-    0xA1, 0x13, 0xB3, 0xA7, 0x7D, 0x28, 0xB9, 0x30, 0x10, 0x9A, 0x4E, 0x0E, 0xD3, 0x21, 0xA1, 0xB8,
-    0x18, 0xBA, 0x25, 0x1C, 0x15, 0x63, 0xDB, 0x68, 0x14, 0xB6, 0x6A, 0xB9, 0x87, 0xF4, 0xBD, 0x7E,
-    0xA1, 0xFC, 0x24, 0x89, 0xAA, 0x1B, 0x3A, 0x91, 0xA3, 0x92, 0x6C, 0x4A, 0x28, 0xA9, 0x77, 0xDD,
-    0x06, 0xC2, 0x04, 0x39, 0x5D, 0x44, 0x1F, 0xA3, 0x51, 0x44, 0x27, 0x89, 0xB7, 0x1E, 0x10, 0xBE,
-    0xDC, 0xA9, 0x45, 0x9C, 0xEE, 0xBD, 0x56, 0x89, 0x1D, 0x7D, 0x3C, 0xFB, 0xA2, 0x55, 0x26, 0xE6,
-    0xFA, 0x43, 0xE9, 0xE9, 0x39, 0x7D, 0xD6, 0xCC, 0x71, 0x8C, 0x28, 0x06, 0x53, 0x1C, 0xCA, 0x40,
-    0x8A, 0xCC, 0xEB, 0x85, 0xBE, 0x58, 0xE6, 0x90, 0x0E, 0xA9, 0x9D, 0xE5, 0xB0, 0xF2, 0xF0, 0xB0,
-    0x69, 0x39, 0x8C, 0x76, 0x81, 0x8B, 0x3D, 0x96, 0x14, 0x84, 0x73, 0xC6, 0xDD, 0xA6, 0x19, 0xA6,
-    0x83, 0x81, 0x98, 0xFA, 0xFB, 0x54, 0xDC, 0x1E, 0xF3, 0x19, 0xC5, 0x86, 0x4F, 0x83, 0xD1, 0xB7,
-    0x19, 0x25, 0xC5, 0x4D, 0x81, 0x8C, 0x7D, 0x0B, 0xF5, 0x23, 0x5B, 0xEC, 0xDC, 0xE2, 0x35, 0x66,
-    0xEA, 0x5B, 0x18, 0x0F, 0xE7, 0x1E, 0x2B, 0x92, 0xE4, 0xF4, 0x2D, 0xC6, 0xB7, 0x90, 0x97, 0x38,
-    0x5D, 0x93, 0xBB, 0x9B, 0xCE, 0xE6, 0x40, 0xBB, 0x25, 0xF7, 0xFF, 0xA0, 0x62, 0x39, 0x95, 0x5A,
-    0xC6, 0x9A, 0x62, 0x6F, 0x62, 0x41, 0xDE, 0x0E, 0x53, 0x8E, 0x6F, 0x52, 0x69, 0xF0, 0x78, 0x6F,
-    0x95, 0xA7, 0x02, 0x4C, 0x38, 0xE0, 0x7F, 0x8B, 0xA9, 0xF0, 0x55, 0xEE, 0x32, 0x53, 0x71, 0x23,
-    0xA7, 0x5A, 0x2A, 0xA9, 0x53, 0xF0, 0x61, 0xCB, 0x1D, 0xF5, 0xD4, 0x89, 0xE3, 0xCF, 0xE0, 0xF2,
-    0xFF, 0xCB, 0x22, 0xE9, 0xDA, 0xBE, 0x5D, 0x68, 0x9E, 0x9F, 0x50, 0x5E, 0x89, 0x80, 0xD3, 0xA2,
-    0xA8, 0xE8, 0xE6, 0xE2, 0x6D, 0x9B, 0x7C, 0x71, 0x7C, 0x54, 0xA5, 0x04, 0xC0, 0x49, 0xB7, 0xC8,
-    0x71, 0x8A, 0x92, 0x7D, 0xA9, 0x72, 0x5D, 0x0A, 0xED, 0x9F, 0xED, 0x9F, 0x31, 0x19, 0x98, 0x7B,
-    0xA7, 0x15, 0xB1, 0x14, 0x95, 0x58, 0x91, 0x5B, 0x77, 0x20, 0xC1, 0xF7, 0xDD, 0xDA, 0x34, 0xE6,
-    0x6E, 0xCA, 0x42, 0x67, 0x93, 0x3A, 0xC0, 0xDC, 0xBF, 0x3A, 0x9C, 0x72, 0x7D, 0x66, 0x65, 0x4D,
-    0xE9, 0x8F, 0xE1, 0x1B, 0xD8, 0x0A, 0x46, 0xCC, 0xDD, 0x32, 0x1D, 0x10, 0x61, 0x2E, 0xF6, 0x8B,
-    0xDC, 0x29, 0x05, 0x76, 0xA2, 0x99, 0x22, 0x0D, 0xC4, 0x1D, 0x67, 0x52, 0x4C, 0x32, 0x64, 0x54,
-    0x57, 0xEC, 0x43, 0xBF, 0xD0, 0xF2, 0x30, 0x65, 0xC7, 0x42, 0xF0, 0xA7, 0xE9, 0x2D, 0xA7, 0x11,
-    0x59, 0xD4, 0x83, 0x18, 0xB9, 0x95, 0x42, 0xE2, 0x28, 0xA8, 0xE5, 0x26, 0x73, 0xEE, 0x17, 0xEE,
-    0xF2, 0x16, 0xF9, 0xD2, 0x79, 0x66, 0x25, 0x2F, 0x4E, 0x73, 0xCE, 0xA9, 0xF1, 0x22, 0x30, 0x3F,
-    0x12, 0x01, 0xE4, 0x7B, 0x72, 0x33, 0x64, 0xBF, 0xA8, 0xBE, 0xBC, 0x52, 0xD0, 0xF4, 0xAD, 0x63,
-    0xCE, 0x40, 0x92, 0x7F, 0xE1, 0xA5, 0x6F, 0xF3, 0x84, 0x56, 0x4E, 0xC7, 0x5D, 0xE2, 0x7A, 0x13,
-    0x39, 0x77, 0xAF, 0x73, 0xB7, 0xD6, 0x1D, 0x50, 0x67, 0x1E, 0x30, 0xC3, 0x4B, 0x93, 0x4E, 0x9B,
-    0xE2, 0x9E, 0xB3, 0xB3, 0x6A, 0x76, 0xCD, 0x1C, 0xB5, 0xD5, 0xFD, 0x09, 0xAD, 0x7A, 0x7A, 0xEB,
-    0x31, 0x8C, 0xB0, 0xCD, 0x61, 0x7B, 0x5F, 0xEF, 0x24, 0x05, 0x46, 0x47, 0x8F, 0xA7, 0xAA, 0x21,
-    0x4D, 0x4F, 0xF5, 0xB1, 0x69, 0x00, 0x33, 0xD5, 0x0C, 0xA2, 0x4C, 0xEC, 0xEE, 0x06, 0x2D, 0x07,
-    0xB8, 0x3E, 0x65, 0x8E, 0x6F, 0xA4, 0x80, 0xED, 0xEC, 0x23, 0x4A, 0x9E, 0x16, 0xB9, 0x8D, 0x27,
-    0x64, 0x96, 0xCE, 0xCF, 0x6B, 0xB1, 0xFB, 0xB7, 0xAA, 0x48, 0x39, 0x59, 0xC6, 0x24, 0x89, 0x9C,
-    0x0A, 0xBC, 0x7D, 0x09, 0x0F, 0x0D, 0x8F, 0x72, 0x75, 0xF7, 0x1A, 0xC7, 0x84, 0x87, 0xD0, 0x65,
-    0xE9, 0xE5, 0xF1, 0x20, 0xA1, 0x5F, 0x31, 0x97, 0xC5, 0x60, 0x89, 0x12, 0x3D, 0x78, 0xFB, 0x42,
-    0x8F, 0xB2, 0x20, 0x50, 0x96, 0x03, 0x65, 0x77, 0x80, 0x32, 0x53, 0xA5, 0x47, 0x51, 0x56, 0x3D,
-    0x1B, 0x65, 0xE6, 0x09, 0x94, 0x7D, 0x23, 0x28, 0xB3, 0xBF, 0xE4, 0xA9, 0x37, 0xDC, 0x5B, 0xE3,
-    0xDE, 0x20, 0xCA, 0x96, 0xE4, 0xD9, 0x9E, 0x19, 0x30, 0x1C, 0xFF, 0xA2, 0x50, 0xD5, 0x05, 0xE8,
-    0x1F, 0x72, 0x38, 0x9C, 0x28, 0x5C, 0x2F, 0xC0, 0xB7, 0xAE, 0x00, 0xDF, 0x5A, 0xBD, 0xFB, 0xC5,
-    0xBA, 0xE7, 0xDB, 0xC1, 0xF3, 0x6D, 0x0A, 0x81, 0x50, 0x23, 0xF3, 0xD5, 0x3B, 0x3C, 0x84, 0xA3,
-    0x6E, 0xDF, 0x69, 0x5E, 0xA0, 0x52, 0xBF, 0xA2, 0xEF, 0x8C, 0x93, 0x24, 0x31, 0xF3, 0x53, 0x37,
-    0x7B, 0xFB, 0xA7, 0x0A, 0x15, 0x96, 0x14, 0x65, 0xCA, 0x73, 0x58, 0x2C, 0x5C, 0xEE, 0x1F, 0xA6,
-    0x8B, 0x42, 0xC8, 0xEF, 0xBB, 0xAE, 0xCB, 0x3C, 0x0A, 0x48, 0x14, 0xEE, 0x55, 0xEC, 0x83, 0x7D,
-    0x46, 0x83, 0xB9, 0x88, 0x6D, 0xBF, 0xDB, 0x8B, 0x2B, 0x92, 0x97, 0x79, 0xC1, 0xA3, 0xD7, 0x1C,
-    0xDE, 0x0C, 0x58, 0x8A, 0xAE, 0x78, 0xBE, 0x0E, 0xC3, 0xBD, 0x3B, 0xF0, 0x70, 0xA6, 0x54, 0xEE,
-    0xFD, 0x5E, 0x7C, 0x72, 0xDD, 0xE8, 0x2E, 0xEA, 0x61, 0x04, 0xE0, 0x00, 0xC0, 0xBD, 0x88, 0x46,
-    0x9E, 0xC6, 0xC1, 0x47, 0x8A, 0xE9, 0xBD, 0x54, 0xC5, 0xAF, 0xEC, 0x73, 0x7E, 0xA2, 0xB1, 0x80,
-    0xFA, 0x6B, 0x90, 0x9D, 0xCA, 0x15, 0x63, 0xE5, 0x06, 0xD0, 0x57, 0xEF, 0x5E, 0xAE, 0x6E, 0x7B,
-    0x1A, 0xC0, 0x3C, 0x53, 0x7D, 0xC4, 0xF3, 0xE9, 0x0B, 0x59, 0x01, 0xC4, 0x00, 0xC8, 0x01, 0xE9,
-    0xC1, 0x43, 0x17, 0x90, 0x84, 0x96, 0x81, 0x88, 0xCE, 0x3D, 0xD2, 0x7F, 0xAC, 0xC7, 0x7A, 0x06,
-    0x4D, 0xE0, 0x02, 0x57, 0xDC, 0xFA, 0x91, 0xB9, 0x42, 0x32, 0x42, 0x81, 0x1C, 0x1C, 0x3B, 0x8A,
-    0xE4, 0xE5, 0xAA, 0x81, 0x80, 0xE4, 0xB5, 0x9B, 0x93, 0x7B, 0x15, 0x15, 0x1A, 0x73, 0xAE, 0xD1,
-    0x1E, 0x65, 0x74, 0x97, 0x92, 0xC5, 0xBC, 0x31, 0x35, 0x68, 0xB4, 0x3F, 0xF8, 0x18, 0x4F, 0xE5,
-    0x40, 0x77, 0x48, 0x3F, 0x0B, 0xC1, 0x70, 0xC9, 0x50, 0x03, 0x88, 0xA3, 0x3B, 0xCF, 0x63, 0x50,
-    0x7A, 0xFC, 0xA7, 0x7D, 0x66, 0x59, 0x50, 0x3C, 0x52, 0x2B, 0xEF, 0x2E, 0xB4, 0xF2, 0xF0, 0x6C,
-    0xAD, 0xDC, 0x7A, 0x41, 0x4C, 0x0E, 0x6B, 0xE5, 0x80, 0x5A, 0x39, 0xDF, 0x81, 0x5B, 0x3B, 0x38,
-    0x6A, 0x65, 0x04, 0x0A, 0xB5, 0x85, 0x56, 0xD6, 0xCD, 0x4A, 0xF1, 0x7C, 0xD9, 0x5A, 0x64, 0xC2,
-    0x9F, 0xD2, 0x07, 0x3F, 0x92, 0x0A, 0x7D, 0x5A, 0x1F, 0x3C, 0xBF, 0xB2, 0x36, 0x26, 0x6E, 0xCC,
-    0xA7, 0xD1, 0x7D, 0xC8, 0xAC, 0x71, 0x4D, 0x4F, 0xDA, 0x89, 0xAD, 0x98, 0x04, 0xDA, 0xE7, 0xFF,
-    0x33, 0xC5, 0x0B, 0xA2, 0xDD, 0x4D, 0xA0, 0x5F, 0xB2, 0x2F, 0xFE, 0xAC, 0x03, 0x0F, 0xBE, 0x9A,
-    0xCF, 0xB6, 0x95, 0x9A, 0x97, 0xA7, 0x36, 0x02, 0xB9, 0xD7, 0x6D, 0xF3, 0xA1, 0x4F, 0x3C, 0x1F,
-    0x88, 0xF8, 0xC3, 0x91, 0x9F, 0x00, 0xF3, 0xF9, 0xE5, 0x73, 0x3D, 0xED, 0xF4, 0x71, 0xEE, 0xF9,
-    0x18, 0xC8, 0xFA, 0x53, 0x39, 0x0F, 0x91, 0x7C, 0x0D, 0x5D, 0xAE, 0x44, 0x8E, 0x0A, 0x87, 0x73,
-    0x0F, 0xD7, 0xE8, 0x7F, 0x55, 0x62, 0xDE, 0xBC, 0x43, 0xF9, 0x8C, 0x07, 0xC9, 0x55, 0x41, 0x20,
-    0x1E, 0x9D, 0x09, 0x30, 0x25, 0xBF, 0x3D, 0xF1, 0xC7, 0x2A, 0xF2, 0xFD, 0x00, 0x3F, 0x0F, 0x78,
-    0xF0, 0x7D, 0x2A, 0x09, 0x2B, 0x0E, 0x1B, 0x4B, 0xEF, 0x5B, 0x51, 0xC1, 0x40, 0xB9, 0x81, 0xFF,
-    0x01, 0xB6, 0x98, 0xAD, 0xD6, 0x9C, 0x4A, 0x95, 0x64, 0x43, 0xD4, 0xCB, 0x77, 0x08, 0xC2, 0x8D,
-    0xFC, 0xB2, 0xA2, 0x11, 0xE7, 0x19, 0xC0, 0xCD, 0xDF, 0x8A, 0xF0, 0x48, 0x51, 0xC9, 0xA7, 0x1B,
-    0xF3, 0x49, 0xB3, 0x1C, 0x4E, 0x10, 0xC2, 0xFC, 0x0D, 0xDA, 0xE8, 0xF7, 0x5B, 0x1F, 0x1D, 0xA8,
-    0x84, 0xE1, 0x8E, 0x1C, 0x5A, 0x49, 0x14, 0x10, 0x4E, 0xCB, 0x34, 0x84, 0xE4, 0xE5, 0xFC, 0xD1,
-    0x47, 0x85, 0xC8, 0xEA, 0xDD, 0x41, 0x69, 0x7E, 0x03, 0x80, 0x25, 0x19, 0x85, 0x33, 0x8B, 0xC7,
-    0x00, 0x5C, 0x37, 0xD1, 0x7D, 0x7E, 0xFA, 0x82, 0xF0, 0x20, 0x85, 0x27, 0x85, 0x30, 0xAB, 0x65,
-    0xDC, 0x92, 0xAB, 0xAB, 0xBA, 0xCE, 0x00, 0x8B, 0xAE, 0xB7, 0xB1, 0x6A, 0x76, 0x01, 0x5E, 0x38,
-    0xCF, 0x46, 0xB2, 0x22, 0x67, 0x6A, 0xEC, 0x7A, 0x17, 0xF6, 0x30, 0x25, 0x76, 0x55, 0xA5, 0x50,
-    0x84, 0xC9, 0x3D, 0x38, 0x56, 0x44, 0xEA, 0x16, 0x64, 0xA4, 0x94, 0x6C, 0x17, 0x49, 0x99, 0xF7,
-    0x02, 0x13, 0x2D, 0x6C, 0x2E, 0xE9, 0xC0, 0x03, 0xE8, 0x00, 0x44, 0xCC, 0xA8, 0x44, 0xB7, 0xD8,
-    0x68, 0xC6, 0x10, 0x8A, 0x67, 0x9A, 0xC4, 0x4E, 0xFE, 0x0E, 0xBF, 0xDD, 0xA0, 0xBC, 0x0A, 0x4B,
-    0xC8, 0xC7, 0x42, 0x92, 0xA0, 0x60, 0x1E, 0x03, 0x1B, 0x65, 0x16, 0xFF, 0x6B, 0x26, 0x36, 0x18,
-    0xBA, 0x99, 0x40, 0x58, 0xAD, 0xE2, 0x46, 0xF3, 0x12, 0xD8, 0x4B, 0xE9, 0x09, 0x24, 0x1D, 0xC3,
-    0x86, 0x51, 0xCD, 0x99, 0x6A, 0x8F, 0xEF, 0x81, 0x67, 0xA2, 0x9D, 0x30, 0x00, 0x64, 0x0C, 0x21,
-    0x47, 0xEB, 0x8F, 0x72, 0x3C, 0xBE, 0x0B, 0x1F, 0xB0, 0x8C, 0x84, 0x60, 0x9B, 0x9E, 0xAE, 0x11,
-    0x7C, 0xBF, 0x4E, 0x67, 0x89, 0x1A, 0x46, 0xDF, 0x68, 0x17, 0x5F, 0x04, 0xEC, 0x4A, 0x46, 0xA1,
-    0x58, 0xA4, 0x4D, 0xA6, 0xC5, 0xE7, 0x06, 0xDE, 0x81, 0x1D, 0x16, 0xD2, 0x23, 0x9E, 0x06, 0xF5,
-    0xD2, 0x7F, 0xB1, 0x6F, 0x65, 0xE7, 0x0F, 0xB7, 0x7C, 0x72, 0x05, 0x6E, 0x09, 0xAF, 0x63, 0x6B,
-    0xBF, 0x1C, 0x7D, 0x77, 0x71, 0x06, 0x4A, 0x01, 0x97, 0x5B, 0x5A, 0xBA, 0x62, 0xF5, 0xD2, 0x3B,
-    0x93, 0xB8, 0xB5, 0xF7, 0xF3, 0x72, 0x5A, 0xE6, 0xFD, 0x11, 0x45, 0x8C, 0xBC, 0x94, 0xFA, 0x6B,
-    0x09, 0x06, 0x61, 0x03, 0xA8, 0x79, 0x98, 0xD6, 0x9D, 0xC3, 0x67, 0x25, 0x1F, 0x97, 0x1C, 0x7A,
-    0x90, 0x00, 0x34, 0xA2, 0xBD, 0x28, 0xE4, 0xB0, 0xCC, 0x48, 0x7C, 0xFD, 0x54, 0xB7, 0x83, 0x07,
-    0x5A, 0x0E, 0x86, 0xF7, 0x9D, 0x7C, 0x1A, 0xB1, 0xAE, 0xFE, 0x6A, 0xF5, 0xBB, 0xFC, 0xD4, 0x87,
-    0x42, 0x7E, 0x46, 0xD2, 0xA9, 0xFF, 0xFA, 0x06, 0x11, 0x04, 0x50, 0x4E, 0xAC, 0x6E, 0x1F, 0x79,
-    0xC0, 0x5A, 0x3C, 0x79, 0x05, 0x34, 0xC0, 0x68, 0xE8, 0x6A, 0x3C, 0xF8, 0x6F, 0x2B, 0x9E, 0x35,
-    0x86, 0x47, 0x73, 0x98, 0xBA, 0x24, 0x15, 0xFE, 0x93, 0x98, 0xFF, 0x50, 0xD2, 0x7E, 0x8D, 0x42,
-    0xF8, 0xB6, 0xBF, 0x7E, 0xB1, 0x30, 0xCE, 0xFE, 0x84, 0xEF, 0x05, 0xD7, 0x7F, 0x04, 0xD5, 0x5A,
-    0x4F, 0x8C, 0xDE, 0xC6, 0x75, 0x7F, 0xFC, 0xA8, 0x5D, 0xA6, 0x61, 0x01, 0xEA, 0xB0, 0x42, 0x12,
-    0x09, 0x05, 0x7D, 0xE8, 0xA1, 0x15, 0x50, 0xF1, 0xD2, 0xA3, 0xB4, 0xA4, 0xAD, 0x83, 0x8F, 0x51,
-    0x0A, 0xAD, 0x0A, 0x44, 0x07, 0xF7, 0xE0, 0x43, 0xAB, 0x00, 0xDD, 0xAB, 0x0F, 0xD2, 0x92, 0x49,
-    0x81, 0xFA, 0x28, 0x05, 0x88, 0x9D, 0x43, 0x2E, 0x39, 0x28, 0x80, 0xF5, 0x05, 0xC5, 0x5E, 0x95,
-    0x5A, 0xBB, 0xA4, 0xE3, 0x43, 0x0E, 0x3A, 0x2C, 0xDD, 0xD4, 0xF0, 0xC1, 0x07, 0x51, 0x91, 0x54,
-    0xC1, 0xF6, 0x61, 0x09, 0x99, 0xCA, 0x72, 0x25, 0x92, 0xD3, 0xDF, 0xEF, 0xCD, 0xF7, 0xED, 0x7E,
-    0xBB, 0x92, 0x5B, 0xAF, 0x13, 0x2F, 0xAC, 0x4F, 0x22, 0x39, 0x3B, 0xE4, 0xCC, 0xBC, 0x79, 0xF3,
-    0xDE, 0xEF, 0xFD, 0x99, 0x99, 0x73, 0xBB, 0xF8, 0xA3, 0x3E, 0x2E, 0x7E, 0x29, 0x22, 0x73, 0x52,
-    0x07, 0x52, 0x87, 0x2F, 0x37, 0xFC, 0xFF, 0x4A, 0x1B, 0xFD, 0x84, 0xFF, 0xE3, 0xF7, 0x3B, 0xFB,
-    0x5F, 0xF8, 0x73, 0xEA, 0xC9, 0xD5, 0x88, 0x9C, 0x30, 0xF7, 0xC5, 0x98, 0xCE, 0x33, 0x9B, 0x6D,
-    0xD0, 0xCA, 0xD1, 0xA8, 0x14, 0x89, 0x33, 0x5C, 0x89, 0x48, 0x8A, 0x4F, 0xF3, 0x7D, 0x57, 0x3A,
-    0xB9, 0xF8, 0x3E, 0x2E, 0x44, 0xC2, 0x4A, 0x24, 0xE8, 0x9D, 0xCB, 0x2E, 0xFA, 0x90, 0xDC, 0xB4,
-    0x32, 0x3F, 0x24, 0xBB, 0xFD, 0xE3, 0x92, 0x73, 0x32, 0xF9, 0xE5, 0x78, 0xE3, 0x1B, 0x53, 0x4B,
-    0xF4, 0x24, 0xAF, 0x24, 0xCD, 0x9C, 0x42, 0x7B, 0x94, 0x7E, 0xE7, 0xD6, 0x7D, 0xC1, 0xED, 0xC2,
-    0xB0, 0x74, 0x1E, 0x9D, 0xEB, 0x08, 0xB8, 0x7D, 0xE1, 0x77, 0x7A, 0x1B, 0xF1, 0xE6, 0x62, 0x66,
-    0x12, 0x96, 0x1C, 0xD5, 0xA0, 0x89, 0xD9, 0xB9, 0x1D, 0x01, 0x55, 0x6E, 0xF9, 0xC3, 0xA4, 0x4D,
-    0x53, 0x93, 0xFF, 0x18, 0x35, 0xB5, 0xDF, 0xA0, 0x45, 0x27, 0x7E, 0x19, 0x24, 0xB2, 0x38, 0xAA,
-    0x65, 0x54, 0x47, 0x68, 0x8A, 0x82, 0x53, 0x87, 0x22, 0x91, 0xB4, 0xE2, 0x55, 0x7E, 0xE5, 0x74,
-    0x62, 0x1E, 0xE4, 0x65, 0x8C, 0x16, 0xAF, 0xDE, 0xCD, 0xEF, 0x76, 0x7F, 0x23, 0xE2, 0xE9, 0xAC,
-    0x62, 0x5C, 0xD1, 0xF7, 0xC1, 0x85, 0xF0, 0x3D, 0x0C, 0x1C, 0x54, 0x51, 0x26, 0x5E, 0xED, 0xD6,
-    0xE2, 0xB6, 0xB2, 0x2E, 0x68, 0x15, 0x14, 0x98, 0xDB, 0xA8, 0x25, 0xD3, 0x62, 0x72, 0xCD, 0xAF,
-    0x42, 0xB0, 0xAD, 0x0F, 0x40, 0x5B, 0xF8, 0x3B, 0xF0, 0xC7, 0xDD, 0x22, 0xA9, 0x69, 0x2B, 0x72,
-    0x7C, 0xD5, 0x8C, 0xC9, 0x20, 0x53, 0x38, 0xE3, 0xFC, 0x53, 0x2C, 0x25, 0xBF, 0xB1, 0x33, 0x21,
-    0x7B, 0x46, 0x24, 0x76, 0xC2, 0x80, 0x9D, 0x4A, 0xBB, 0x10, 0xBB, 0x5F, 0xFE, 0xED, 0xE2, 0x9E,
-    0xDF, 0x94, 0xF5, 0x0B, 0xFB, 0xAB, 0x7F, 0x78, 0x43, 0x42, 0x63, 0x38, 0xFF, 0xA0, 0x92, 0x37,
-    0x40, 0x9B, 0x33, 0xE9, 0xD5, 0x07, 0x21, 0x81, 0x49, 0x70, 0x55, 0x62, 0xF2, 0x26, 0x28, 0xC3,
-    0x76, 0x51, 0xFC, 0xC7, 0x8D, 0xF8, 0x0F, 0x4B, 0x09, 0xEE, 0x14, 0xB2, 0x18, 0x17, 0x4E, 0x93,
-    0x56, 0x41, 0x11, 0x0F, 0x3D, 0xFA, 0x28, 0x41, 0x17, 0x06, 0xCF, 0x0B, 0x2B, 0x36, 0xEB, 0xA0,
-    0xF3, 0x09, 0x5A, 0xDF, 0xF9, 0xE4, 0x82, 0x01, 0xAF, 0xEA, 0xD0, 0x6C, 0x2B, 0x01, 0x47, 0xE4,
-    0x68, 0x2C, 0x5D, 0xEA, 0x74, 0xB8, 0xA3, 0x3C, 0xA5, 0x4B, 0xE6, 0xCD, 0x40, 0xFA, 0x41, 0x0B,
-    0x27, 0x13, 0x55, 0x2A, 0x4F, 0x13, 0xD9, 0x23, 0x67, 0xC1, 0xC8, 0x48, 0xE6, 0x6F, 0xA0, 0x1C,
-    0x82, 0xA4, 0xD6, 0xC5, 0x22, 0x05, 0x18, 0xF7, 0xB2, 0x57, 0x04, 0x95, 0x23, 0xC1, 0x2B, 0x95,
-    0xA7, 0x62, 0xD6, 0xB8, 0x94, 0xB4, 0xD3, 0xA7, 0x55, 0x00, 0x82, 0xC0, 0x36, 0xFD, 0x7D, 0x11,
-    0x80, 0x22, 0x69, 0x6A, 0x17, 0x7D, 0xCA, 0x99, 0xE9, 0xCB, 0x44, 0x5F, 0xFE, 0xB6, 0xF2, 0x4B,
-    0xB6, 0xBC, 0xAC, 0x5C, 0x6C, 0x83, 0x24, 0x7A, 0xF0, 0x1F, 0x72, 0xD9, 0xA9, 0xC1, 0xE5, 0x64,
-    0x11, 0xED, 0xFD, 0x21, 0x89, 0x44, 0x7B, 0x8D, 0x12, 0x49, 0x13, 0x25, 0xCA, 0xDD, 0x16, 0x27,
-    0x47, 0x31, 0x1A, 0x56, 0x07, 0x15, 0x68, 0x88, 0x3B, 0x7F, 0xC7, 0x12, 0x3B, 0x99, 0x68, 0x80,
-    0x16, 0xCC, 0xCB, 0x15, 0xF4, 0x27, 0x6E, 0xB5, 0x6C, 0xAE, 0x3E, 0x59, 0x5F, 0x93, 0xA7, 0x95,
-    0xBB, 0x99, 0x85, 0xAB, 0x6F, 0x0F, 0xF1, 0xF0, 0xC6, 0xF1, 0x24, 0x81, 0x7A, 0x1E, 0xC1, 0x4B,
-    0xBF, 0x74, 0x1B, 0xBF, 0x76, 0x5B, 0xAF, 0x1E, 0x75, 0x2E, 0x04, 0xD0, 0x6D, 0x1D, 0x5C, 0xD2,
-    0x43, 0x14, 0xD3, 0x64, 0x10, 0xBF, 0xC6, 0xB2, 0xE4, 0x4E, 0x0F, 0x79, 0x82, 0xB4, 0x0C, 0xA8,
-    0x0D, 0xCA, 0xA8, 0xC0, 0x27, 0x8D, 0xFC, 0xB5, 0xBC, 0x74, 0x72, 0x3C, 0x1E, 0x5F, 0xA7, 0x34,
-    0xDF, 0xE3, 0x8D, 0x73, 0x5C, 0xE1, 0xF0, 0x24, 0x46, 0xA7, 0xAA, 0xD3, 0x5E, 0xDC, 0x53, 0x25,
-    0x72, 0x69, 0xFC, 0x0B, 0x33, 0xE4, 0xE6, 0x2E, 0x34, 0xE9, 0x20, 0xCC, 0x77, 0xC6, 0xD7, 0x95,
-    0xF9, 0xB9, 0xA9, 0xC8, 0xFC, 0xC8, 0x28, 0xF3, 0xFD, 0x32, 0x2C, 0xC0, 0xFC, 0x11, 0xF8, 0x0E,
-    0xE6, 0xCB, 0x9A, 0xDC, 0x22, 0xF3, 0x23, 0xB0, 0x16, 0xCC, 0xF7, 0xCB, 0x38, 0x03, 0xF3, 0xC1,
-    0xC9, 0x02, 0xCC, 0x47, 0xCB, 0x8C, 0xCC, 0x8F, 0x7E, 0x5E, 0x93, 0xF9, 0x7E, 0xB9, 0x46, 0xE6,
-    0x8F, 0x9A, 0xA0, 0x20, 0xF3, 0xD7, 0xA0, 0x19, 0x64, 0x3E, 0x5A, 0x82, 0xF9, 0x7E, 0xE9, 0xD5,
-    0x60, 0x3E, 0x60, 0x69, 0xED, 0x60, 0xCC, 0xA7, 0x5A, 0x1A, 0xBD, 0x91, 0x37, 0x37, 0x88, 0x02,
-    0x26, 0x0B, 0x4D, 0x13, 0xBF, 0xDC, 0xDD, 0x92, 0xC5, 0x56, 0xA2, 0x56, 0x42, 0xDC, 0x51, 0x5E,
-    0x44, 0xD7, 0xA6, 0xF5, 0x20, 0xB3, 0x0B, 0xF8, 0x8A, 0xBC, 0x18, 0x71, 0x1C, 0xBF, 0xE0, 0x60,
-    0xEC, 0xEF, 0xD6, 0xFE, 0xAA, 0x93, 0xE3, 0x61, 0x0F, 0xB7, 0x9F, 0xFF, 0xD5, 0x4C, 0xD5, 0x7C,
-    0x66, 0xD9, 0xBB, 0x6F, 0x99, 0x1C, 0x73, 0x0D, 0x14, 0x45, 0x3F, 0xED, 0xBE, 0x45, 0x09, 0xC1,
-    0xF2, 0x5C, 0x61, 0x1B, 0xA7, 0xE5, 0x44, 0x01, 0x12, 0x31, 0xD1, 0x8B, 0xC5, 0x0C, 0xB3, 0xE9,
-    0xF1, 0xFF, 0xD8, 0xD2, 0xF9, 0x91, 0xB9, 0xE6, 0x9B, 0xDE, 0x6D, 0xC2, 0xE2, 0x28, 0xA1, 0x1A,
-    0x6D, 0xC2, 0x44, 0xC0, 0x79, 0x93, 0xB9, 0x50, 0x4F, 0x72, 0x86, 0x4C, 0xC2, 0xC0, 0xF1, 0x11,
-    0x09, 0xDF, 0xFC, 0x64, 0xF9, 0x3D, 0x63, 0xCA, 0xF9, 0x31, 0x18, 0x32, 0x96, 0x3C, 0x89, 0xB3,
-    0x38, 0x8B, 0xB2, 0x30, 0x73, 0x2C, 0x35, 0x84, 0x88, 0x0E, 0xEB, 0x1C, 0x6C, 0x1C, 0xB0, 0xE0,
-    0x74, 0xE0, 0x77, 0xB8, 0x51, 0x89, 0xDB, 0x19, 0x8C, 0xB9, 0xD1, 0x4A, 0xD0, 0x99, 0xED, 0x8B,
-    0x9B, 0x1B, 0x40, 0xA2, 0xAE, 0x4F, 0x7B, 0x7F, 0xA3, 0x3C, 0x6F, 0xB1, 0x48, 0x51, 0xE8, 0xFF,
-    0x28, 0xC8, 0xDC, 0xA5, 0xF1, 0x75, 0x0F, 0xBC, 0xA8, 0x72, 0x33, 0xAC, 0xBE, 0x89, 0xE7, 0x29,
-    0xAC, 0x59, 0xF6, 0x1B, 0x63, 0x86, 0xD1, 0x67, 0xC6, 0xB4, 0x7E, 0xCE, 0x2A, 0xF2, 0xEA, 0x5D,
-    0x56, 0x6D, 0xEE, 0xA9, 0xFA, 0x4F, 0x56, 0x3D, 0x64, 0xD5, 0x55, 0x56, 0x41, 0x68, 0xB3, 0x9B,
-    0x21, 0xAA, 0x2A, 0x1F, 0x55, 0x99, 0x8C, 0xAA, 0x53, 0x58, 0x8C, 0xEC, 0xA6, 0xC8, 0xA9, 0x11,
-    0x58, 0x73, 0xF3, 0x2B, 0x54, 0xFD, 0x95, 0x53, 0xCE, 0xB9, 0x5D, 0xFA, 0x7B, 0xD8, 0xD1, 0x73,
-    0x6E, 0x09, 0x84, 0x69, 0xE6, 0x7B, 0x62, 0xB6, 0xAC, 0xA4, 0x5D, 0x5A, 0xC9, 0x49, 0xC7, 0xF8,
-    0x26, 0x5E, 0x3D, 0x13, 0x1D, 0x8D, 0xE4, 0x79, 0xFF, 0x8E, 0x59, 0xA9, 0x0B, 0x20, 0x75, 0x72,
-    0xEB, 0xB2, 0x9C, 0xB9, 0x49, 0xA9, 0xA3, 0xE0, 0xDD, 0x54, 0xC1, 0x3B, 0x23, 0x57, 0xA2, 0xB7,
-    0x5B, 0x1F, 0xEB, 0xF6, 0x2F, 0x40, 0x80, 0x23, 0x58, 0x67, 0x88, 0x38, 0xF4, 0x1F, 0xB2, 0x9D,
-    0x03, 0x79, 0xA1, 0xEF, 0xA9, 0xA8, 0xE2, 0x97, 0x62, 0xA0, 0xF8, 0x51, 0x11, 0x27, 0x61, 0x11,
-    0x67, 0x61, 0x19, 0x17, 0xD4, 0x7D, 0x02, 0x81, 0x5F, 0x87, 0x50, 0x10, 0x7C, 0xF0, 0x92, 0xFC,
-    0x93, 0xD5, 0xF9, 0x56, 0xFC, 0x4E, 0x65, 0x10, 0x96, 0x01, 0x15, 0xE1, 0xC7, 0x05, 0x25, 0xE2,
-    0x74, 0xA4, 0x8A, 0x43, 0xBC, 0x6B, 0x65, 0x22, 0x5E, 0xBC, 0xAE, 0xA8, 0xB9, 0x52, 0xBD, 0xEA,
-    0x54, 0x66, 0x51, 0xA4, 0x12, 0x05, 0x05, 0xFE, 0x95, 0x78, 0x75, 0x05, 0x62, 0x23, 0x9D, 0x5B,
-    0x7B, 0x3D, 0x5E, 0x45, 0xB2, 0xD8, 0x48, 0xF0, 0x5E, 0x3B, 0x02, 0xF0, 0xCF, 0x05, 0x45, 0x08,
-    0xD1, 0xC3, 0x07, 0xCD, 0x1A, 0x11, 0xC5, 0xFF, 0x49, 0x43, 0xA9, 0xBF, 0x0C, 0x0C, 0x75, 0x00,
-    0xCA, 0x18, 0x2C, 0x28, 0x22, 0x2C, 0x0B, 0x90, 0x80, 0x6B, 0xE5, 0x56, 0xCE, 0xD2, 0xC5, 0xFB,
-    0x3A, 0x44, 0x94, 0x50, 0x72, 0x51, 0x4F, 0x1A, 0x46, 0x8D, 0x25, 0x0C, 0x0F, 0xA3, 0xB2, 0xEB,
-    0xE3, 0xE1, 0x61, 0xE4, 0x0D, 0x76, 0x20, 0xA7, 0x60, 0x81, 0xD9, 0x06, 0x8F, 0x15, 0xFB, 0x50,
-    0xC4, 0x4E, 0xD8, 0x0C, 0x0F, 0x8B, 0x6D, 0x89, 0x6A, 0x5C, 0x90, 0x84, 0xC9, 0x31, 0x3E, 0x62,
-    0x0F, 0xA3, 0x06, 0xC9, 0x5A, 0x0C, 0x38, 0x08, 0x92, 0xF6, 0x14, 0x9A, 0x04, 0x67, 0x6B, 0x52,
-    0x1A, 0xBC, 0x5A, 0xF2, 0x31, 0xC7, 0x81, 0x6F, 0x59, 0x1D, 0x6D, 0x55, 0x87, 0xC8, 0x00, 0x72,
-    0xAD, 0x54, 0xFF, 0x27, 0xB2, 0x4A, 0xB4, 0xA6, 0x6C, 0xE4, 0x48, 0x61, 0xA6, 0xB4, 0x42, 0x1F,
-    0xE3, 0xB7, 0xCE, 0x93, 0x67, 0x29, 0x30, 0xAF, 0xB5, 0x0F, 0xFB, 0x73, 0x4C, 0x43, 0xD3, 0xE1,
-    0x2A, 0xF6, 0xB6, 0xF2, 0x1B, 0xCF, 0x2A, 0x21, 0xBF, 0x25, 0xDD, 0x60, 0x54, 0x6C, 0x91, 0x81,
-    0x73, 0xF5, 0x2B, 0xAA, 0xB4, 0x0B, 0xC0, 0x21, 0xE1, 0xE8, 0xC3, 0x2B, 0xD5, 0x35, 0xD1, 0x65,
-    0x90, 0x4E, 0xE7, 0x86, 0xEF, 0xDB, 0x11, 0x0D, 0x6F, 0xD1, 0xC9, 0x30, 0x87, 0x26, 0x57, 0xC4,
-    0xFC, 0x78, 0x58, 0xAD, 0x63, 0x79, 0xB7, 0x4A, 0x0D, 0x56, 0xE2, 0x72, 0x2B, 0x97, 0x92, 0x20,
-    0x3B, 0xB3, 0xA8, 0xAB, 0x75, 0x8A, 0x00, 0xEF, 0x95, 0x21, 0x19, 0xE2, 0xD6, 0x98, 0x35, 0x81,
-    0x27, 0xC8, 0xF0, 0xD2, 0x01, 0xB2, 0xA9, 0x83, 0xE4, 0x60, 0x19, 0x48, 0xD0, 0xB1, 0x0B, 0x7D,
-    0xA2, 0xA6, 0x60, 0xD1, 0x72, 0x00, 0x2D, 0xB9, 0x8E, 0x6C, 0x09, 0xFC, 0x73, 0xD4, 0xAD, 0xC0,
-    0x9F, 0xB8, 0x1C, 0xA2, 0xEA, 0xEB, 0xB2, 0xFB, 0x3B, 0x3F, 0xC1, 0xB4, 0xCE, 0x5E, 0xA4, 0xCF,
-    0x07, 0xCD, 0x74, 0x10, 0xB9, 0x78, 0x44, 0x07, 0xFC, 0x49, 0x67, 0x46, 0x7D, 0x41, 0x99, 0xB9,
-    0x32, 0xFD, 0xEC, 0x72, 0x60, 0x56, 0x7B, 0x97, 0xC6, 0x25, 0x35, 0xD7, 0xB4, 0xCB, 0xD1, 0x3B,
-    0xCA, 0x3E, 0xC5, 0x6F, 0xC5, 0x75, 0x7C, 0xC7, 0xD5, 0x24, 0x93, 0xC4, 0x8A, 0x07, 0x7E, 0x47,
-    0x65, 0xDF, 0xCF, 0xBE, 0x0D, 0x94, 0x61, 0xA1, 0xE5, 0x97, 0x7A, 0x7B, 0x8B, 0x7A, 0x5F, 0x53,
-    0xE3, 0xD7, 0x71, 0x60, 0xB8, 0x17, 0x9C, 0x5C, 0x43, 0xA2, 0xC0, 0x98, 0x82, 0x4D, 0xD9, 0x38,
-    0x28, 0x3D, 0x25, 0x95, 0x0E, 0x4E, 0x94, 0x71, 0x26, 0xB1, 0x3A, 0x3C, 0xF9, 0xD2, 0x12, 0xA6,
-    0x41, 0x74, 0x16, 0x47, 0xEF, 0xA3, 0x61, 0x3C, 0xCE, 0x33, 0x7E, 0x16, 0x16, 0x6C, 0x12, 0x94,
-    0xD0, 0x4B, 0x4C, 0x9B, 0x1D, 0x7A, 0x35, 0x69, 0x75, 0x5B, 0x0E, 0x31, 0xEA, 0x52, 0x75, 0xC0,
-    0x74, 0x26, 0xBC, 0x1D, 0xD7, 0x09, 0xC6, 0x3A, 0x19, 0xA3, 0x93, 0x54, 0xDA, 0xEC, 0x22, 0x07,
-    0x5A, 0x3D, 0x27, 0x2F, 0xDE, 0xBC, 0xBE, 0xFD, 0x4B, 0x5D, 0x23, 0xA5, 0x2D, 0x25, 0x55, 0x4E,
-    0x9F, 0xEB, 0xB4, 0x42, 0x45, 0x14, 0x76, 0x35, 0x37, 0xE3, 0xE1, 0xBF, 0x30, 0xF3, 0x7A, 0x1D,
-    0x6E, 0x94, 0x78, 0x26, 0x79, 0x83, 0xCE, 0xEE, 0x1F, 0x39, 0x8A, 0x4F, 0x04, 0x3D, 0xAD, 0x7E,
-    0xEC, 0x82, 0xBC, 0x80, 0x2B, 0x95, 0x38, 0x32, 0x1D, 0xD1, 0xD3, 0xBB, 0x2D, 0xDB, 0x7A, 0x79,
-    0x11, 0x67, 0x34, 0x7F, 0x6D, 0x97, 0xAA, 0x6D, 0xA5, 0x07, 0x71, 0xED, 0xEE, 0x3D, 0x54, 0x27,
-    0x50, 0x21, 0x39, 0x6A, 0xBF, 0xC1, 0xC8, 0x00, 0x47, 0xC5, 0x0C, 0x53, 0x17, 0x95, 0x6A, 0x34,
-    0x79, 0x0E, 0x1A, 0x9D, 0x62, 0x30, 0x8B, 0x0E, 0x6E, 0x6B, 0x9F, 0x76, 0xF1, 0x18, 0x48, 0xDA,
-    0x27, 0xBC, 0x3D, 0x7D, 0x46, 0x99, 0x7D, 0xC6, 0x13, 0x34, 0xC9, 0x25, 0x78, 0xB0, 0xA4, 0x7E,
-    0x57, 0x40, 0xC4, 0x67, 0x84, 0xC0, 0x27, 0x08, 0xD4, 0x7A, 0xFF, 0xF1, 0xD2, 0x6B, 0x6A, 0x27,
-    0x19, 0x4E, 0xB2, 0xF9, 0xE4, 0x19, 0x7F, 0x3A, 0xA6, 0x88, 0xD3, 0xC3, 0xD7, 0x7E, 0x06, 0xFB,
-    0xE4, 0x94, 0x55, 0x68, 0x5A, 0xFB, 0xD4, 0x19, 0x52, 0xC5, 0x2B, 0xDB, 0x85, 0xAA, 0x3B, 0x5D,
-    0xEC, 0xCC, 0x3E, 0x27, 0x42, 0x74, 0x82, 0xD1, 0x1D, 0x3C, 0xB4, 0x86, 0x9C, 0x82, 0xCD, 0x29,
-    0xE5, 0x5F, 0x45, 0xE3, 0x91, 0x3C, 0x9B, 0x98, 0x01, 0x8B, 0xEF, 0xEC, 0x46, 0xBC, 0x66, 0x07,
-    0x16, 0xF3, 0x1D, 0xE4, 0xA7, 0x45, 0xB1, 0x11, 0xFB, 0x4C, 0xA5, 0x7E, 0xA9, 0xCC, 0xB3, 0x88,
-    0xEA, 0x37, 0x3B, 0xB0, 0xAA, 0x8B, 0x0C, 0x2F, 0x0B, 0xB0, 0x13, 0x99, 0xB1, 0x49, 0x18, 0x14,
-    0x97, 0x0C, 0x9A, 0x31, 0x82, 0xF7, 0xDF, 0x1C, 0xA0, 0xDA, 0x69, 0x7B, 0x42, 0x85, 0x5B, 0xE3,
-    0x20, 0x8D, 0x88, 0xB8, 0xDE, 0x23, 0xAA, 0xB9, 0xE4, 0x0C, 0xFD, 0x6E, 0x4C, 0xFA, 0xE4, 0x10,
-    0x74, 0x4F, 0x27, 0x7E, 0xD1, 0xAC, 0xFE, 0x63, 0xAD, 0x7A, 0x5C, 0x83, 0x5E, 0x33, 0xC9, 0x8F,
-    0xE7, 0x5E, 0x4B, 0x4B, 0xE7, 0xF1, 0x5D, 0xA7, 0x17, 0xCB, 0xFF, 0xDF, 0xF7, 0xB6, 0xFF, 0x61,
-    0x7A, 0x59, 0xB0, 0xA5, 0x75, 0x4D, 0x33, 0x9D, 0x00, 0x85, 0xD1, 0x03, 0xC9, 0x33, 0x0A, 0x7C,
-    0xA8, 0xF4, 0xCC, 0x33, 0x03, 0x01, 0x7E, 0xC4, 0xA0, 0x65, 0x88, 0xA1, 0x1B, 0x41, 0xE9, 0x97,
-    0xA3, 0x66, 0x6E, 0xC6, 0x40, 0x1F, 0x2A, 0x3D, 0xE7, 0x1C, 0x38, 0x82, 0x88, 0x9B, 0x5B, 0x1F,
-    0xD1, 0x23, 0x9C, 0xA8, 0x7D, 0xC8, 0x76, 0x98, 0xB4, 0x5C, 0x4A, 0x28, 0x39, 0x83, 0x86, 0x36,
-    0x36, 0x1D, 0x75, 0x6E, 0xE2, 0x18, 0x9A, 0xDB, 0xC6, 0xCC, 0x9B, 0xFB, 0x10, 0x73, 0xA8, 0x10,
-    0xB4, 0x26, 0x95, 0x03, 0x16, 0x4F, 0x6C, 0xC3, 0x83, 0x8B, 0xA8, 0xD1, 0xEF, 0x40, 0x18, 0x34,
-    0x03, 0x20, 0xEB, 0xF4, 0x19, 0x8F, 0xC8, 0x9F, 0x7D, 0x88, 0x4B, 0x58, 0xDC, 0x9A, 0xEB, 0x1B,
-    0x5F, 0x2D, 0xA3, 0xAC, 0x8F, 0x12, 0xFF, 0xC3, 0x9D, 0xC5, 0xC5, 0x27, 0x0C, 0xE0, 0x4F, 0xC0,
-    0x73, 0x4B, 0xD5, 0xCB, 0x43, 0x07, 0x54, 0xDE, 0xAF, 0xF8, 0xC7, 0xF2, 0x7D, 0x10, 0x5E, 0xE4,
-    0xA6, 0x5E, 0x90, 0x7F, 0x68, 0xFC, 0x3B, 0x55, 0xBC, 0x9A, 0xAC, 0x1D, 0x95, 0x64, 0x77, 0xF1,
-    0x1E, 0x19, 0xF3, 0x5E, 0xBE, 0x7D, 0xF0, 0xC9, 0x4C, 0x8B, 0xF3, 0xC3, 0xCB, 0xCA, 0x19, 0xF8,
-    0xB2, 0xE6, 0xBA, 0x28, 0x74, 0x37, 0x16, 0x74, 0x4B, 0x68, 0xB7, 0xB3, 0xDC, 0x6B, 0x76, 0x0B,
-    0x8A, 0x8F, 0x25, 0xF3, 0x3A, 0x9B, 0xE5, 0xC8, 0xA8, 0xF6, 0x7E, 0xCD, 0x17, 0x60, 0x74, 0xAF,
-    0x90, 0xC5, 0x17, 0x1A, 0x84, 0x01, 0x95, 0x7E, 0x3D, 0x8C, 0x33, 0x49, 0x99, 0xC6, 0x42, 0xFC,
-    0x4B, 0x74, 0x65, 0x00, 0xC6, 0x17, 0x9A, 0x7E, 0xCB, 0x67, 0x5A, 0x84, 0x25, 0x5B, 0x04, 0xDA,
-    0x95, 0xD7, 0xEE, 0x8E, 0xE1, 0xF7, 0x84, 0x16, 0x0E, 0x6E, 0x34, 0xC9, 0x82, 0x3B, 0x4D, 0x8C,
-    0x19, 0x68, 0xDB, 0x9C, 0x6B, 0x0C, 0xE3, 0x4C, 0x15, 0xB0, 0xE6, 0x21, 0xE2, 0xEB, 0x0F, 0xE8,
-    0xBA, 0xBF, 0xE1, 0xC0, 0xBB, 0xDE, 0x6F, 0xB4, 0x09, 0x09, 0xEE, 0x43, 0x8E, 0x97, 0xA6, 0x80,
-    0x29, 0x6F, 0x8B, 0x28, 0x9B, 0xA6, 0x1C, 0x67, 0x6B, 0x13, 0x15, 0xE9, 0x0A, 0xBE, 0xF0, 0xB6,
-    0xFE, 0x40, 0x66, 0xAF, 0xC0, 0xA8, 0x7B, 0x5B, 0x15, 0x2A, 0xD2, 0x15, 0x20, 0x2B, 0x8A, 0xA8,
-    0x48, 0x53, 0xF8, 0xDB, 0xDE, 0x56, 0xED, 0x76, 0x2C, 0x06, 0x15, 0x8A, 0xA8, 0x40, 0xD1, 0xED,
-    0x58, 0x0C, 0xAA, 0x18, 0x8B, 0x94, 0x9F, 0x45, 0xD1, 0xED, 0x58, 0x0C, 0xEF, 0xA1, 0x28, 0x39,
-    0x3E, 0x00, 0xE9, 0x2C, 0x86, 0x46, 0xB3, 0xC1, 0x2C, 0xBA, 0x5A, 0x0C, 0x6B, 0xA6, 0x19, 0x14,
-    0xB3, 0xD5, 0x90, 0x59, 0x10, 0xB7, 0xA0, 0x3F, 0xC9, 0x4F, 0xDA, 0xBC, 0x88, 0x38, 0xC9, 0x7E,
-    0xE7, 0x63, 0xD9, 0xDC, 0x57, 0x49, 0xD6, 0xEC, 0x21, 0x75, 0x9B, 0x88, 0x9E, 0xD6, 0x0E, 0x94,
-    0x6A, 0x34, 0x4C, 0x40, 0x99, 0xE1, 0x01, 0x4C, 0x2A, 0xF1, 0x3F, 0x57, 0xFB, 0x11, 0x7E, 0xC4,
-    0x4E, 0xDD, 0x27, 0x3A, 0x8E, 0xB1, 0xD6, 0x62, 0x53, 0xCD, 0xC3, 0x53, 0x35, 0x22, 0x83, 0xB5,
-    0x22, 0x33, 0x2F, 0x02, 0x52, 0x8B, 0x4E, 0x6C, 0x82, 0xD9, 0x76, 0xA5, 0xB6, 0x24, 0xCE, 0x8C,
-    0xD2, 0xCD, 0x39, 0x44, 0xD5, 0x08, 0x0C, 0x07, 0x57, 0x69, 0x4F, 0x6A, 0xA5, 0xAA, 0x52, 0xF1,
-    0xE7, 0x44, 0x9C, 0x49, 0xB2, 0xCC, 0xFA, 0xC1, 0x5E, 0x6B, 0x2D, 0xF5, 0xEE, 0x74, 0xAD, 0x39,
-    0x13, 0x9B, 0x89, 0x7A, 0xD6, 0x6F, 0x7C, 0xD1, 0xE6, 0x39, 0xBA, 0xAE, 0x13, 0x54, 0x4B, 0x6B,
-    0x2D, 0xE5, 0xA8, 0xCB, 0x75, 0x9A, 0xB4, 0x9D, 0x4E, 0xAB, 0xE1, 0xED, 0xD1, 0x67, 0x17, 0xF4,
-    0x45, 0x9B, 0xE7, 0x79, 0xF9, 0x0B, 0xB6, 0xAD, 0x7C, 0xA2, 0x80, 0xF9, 0x05, 0x3A, 0x5A, 0x64,
-    0x62, 0x46, 0x02, 0x26, 0x41, 0xE5, 0x39, 0x1E, 0xB3, 0x93, 0x33, 0x82, 0x65, 0xEA, 0x4A, 0xB7,
-    0x30, 0xA0, 0xC4, 0xFE, 0x80, 0xAE, 0x0B, 0x8F, 0x79, 0x84, 0xD6, 0x25, 0xA5, 0x4C, 0xDA, 0xD0,
-    0xD3, 0x31, 0xCA, 0x35, 0x55, 0x83, 0xF4, 0x35, 0x6A, 0x46, 0xF0, 0x99, 0x52, 0xFD, 0xEC, 0x74,
-    0x9E, 0x33, 0xCF, 0xF8, 0x8E, 0xCE, 0xF3, 0x9E, 0x72, 0xA6, 0xB1, 0x5D, 0xA9, 0x7A, 0x0D, 0x3A,
-    0x46, 0x9E, 0xA4, 0x05, 0x9D, 0x2B, 0xC0, 0x0A, 0x06, 0x97, 0x7C, 0xF8, 0x35, 0xEE, 0x9E, 0xCD,
-    0x01, 0x87, 0xEA, 0x65, 0xCA, 0xDC, 0x39, 0x1B, 0x42, 0x73, 0x89, 0x56, 0x9C, 0x56, 0x5D, 0x2A,
-    0x76, 0xED, 0x55, 0x61, 0xB6, 0xF3, 0xE2, 0x45, 0x9F, 0x20, 0x6D, 0x21, 0xD6, 0xCE, 0xFD, 0x5D,
-    0x03, 0x69, 0xC8, 0x13, 0xB7, 0xF3, 0x1B, 0x34, 0xCF, 0xCF, 0x02, 0xA1, 0xB7, 0x3A, 0x1B, 0xA9,
-    0x32, 0x2F, 0xE6, 0x32, 0x4F, 0x01, 0x33, 0xE0, 0x76, 0x7B, 0xBF, 0x69, 0xF0, 0x6E, 0xFD, 0x2F,
-    0x11, 0x61, 0xEC, 0xCE, 0xFF, 0x25, 0x15, 0xE2, 0xD8, 0x3A, 0xFB, 0x19, 0x85, 0xD8, 0x14, 0x14,
-    0xE2, 0xBC, 0xA2, 0x10, 0x83, 0x1C, 0x43, 0xEE, 0x50, 0x88, 0xDD, 0x2D, 0x0A, 0xB1, 0xDB, 0x50,
-    0x88, 0x47, 0x1D, 0x85, 0xD8, 0xE9, 0x54, 0x88, 0x7B, 0x15, 0xE2, 0x75, 0x9D, 0x7B, 0xAA, 0x73,
-    0x8F, 0x13, 0xCE, 0x1D, 0x9C, 0xC2, 0xDC, 0x61, 0xA4, 0xF0, 0x02, 0x3E, 0x35, 0x84, 0x18, 0x26,
-    0x01, 0x42, 0x4C, 0x95, 0xEA, 0x63, 0x6E, 0x01, 0xE5, 0x1E, 0xF7, 0x80, 0x20, 0xC4, 0xAD, 0x0A,
-    0x71, 0x37, 0x23, 0xC4, 0x46, 0x85, 0x38, 0x57, 0x21, 0x8E, 0x55, 0x88, 0xDD, 0xC4, 0xD9, 0xCD,
-    0xE0, 0x5B, 0x60, 0x1A, 0xF5, 0x3B, 0xAE, 0xB3, 0x05, 0x27, 0xE6, 0x9D, 0x6C, 0x2E, 0x7A, 0x2F,
-    0x28, 0x51, 0x04, 0x3C, 0x2E, 0x8A, 0xA3, 0x6B, 0x92, 0x72, 0x49, 0x42, 0x2E, 0xD5, 0x9F, 0xB1,
-    0x92, 0xB6, 0x21, 0xE2, 0x2A, 0x07, 0xF7, 0xE8, 0xC0, 0x36, 0x39, 0x58, 0xD6, 0x05, 0xAD, 0x78,
-    0xE0, 0xCF, 0x93, 0x55, 0x0D, 0x57, 0x7A, 0x6A, 0x5D, 0xBB, 0xBB, 0x71, 0x32, 0x9E, 0x9A, 0x38,
-    0xEB, 0xEE, 0xEB, 0x44, 0xC2, 0x62, 0x9A, 0x38, 0xD9, 0x8B, 0x36, 0xDF, 0xCC, 0x29, 0x9C, 0xD4,
-    0x4D, 0x08, 0xDD, 0xB0, 0xA0, 0x4C, 0x87, 0xB7, 0x35, 0xA8, 0x5C, 0x27, 0xB9, 0x70, 0xE1, 0x9D,
-    0xBD, 0xCB, 0xF0, 0x8D, 0x9C, 0x82, 0x43, 0xA5, 0xF2, 0x18, 0xCE, 0x3A, 0x9D, 0xA7, 0xC9, 0xE4,
-    0x76, 0x52, 0xB9, 0xEF, 0xB7, 0xF2, 0x35, 0x50, 0xBB, 0xAF, 0xB2, 0x57, 0x28, 0xD0, 0x5D, 0xE6,
-    0xAB, 0xDC, 0x58, 0xFD, 0x2F, 0xCD, 0x35, 0xC6, 0x15, 0xA2, 0x3F, 0xD7, 0x7C, 0x9A, 0x37, 0x74,
-    0xEB, 0x1A, 0xAA, 0x2A, 0xCD, 0xC8, 0xD2, 0xAE, 0x08, 0x71, 0xFB, 0x6A, 0xA2, 0x01, 0xEB, 0x53,
-    0x46, 0x4F, 0xB6, 0xBF, 0x16, 0x9E, 0x49, 0x7E, 0x38, 0xAD, 0x6E, 0x2C, 0xFD, 0x5B, 0x37, 0xF5,
-    0xF7, 0x7A, 0x46, 0xA0, 0x11, 0x33, 0x01, 0xF8, 0x1F, 0xE9, 0xDE, 0xF4, 0xC0, 0x2D, 0x64, 0x6E,
-    0xD3, 0x51, 0x3B, 0x75, 0x93, 0x54, 0x03, 0xE2, 0xBB, 0x4A, 0x34, 0x11, 0xD0, 0x55, 0x23, 0x19,
-    0xAA, 0xFE, 0x69, 0x7C, 0x6D, 0x1D, 0x1F, 0xDD, 0x93, 0x3D, 0x68, 0x31, 0x15, 0x1B, 0x77, 0xEF,
-    0x2B, 0x10, 0x8B, 0x11, 0x73, 0x30, 0xB1, 0x6B, 0x6A, 0xB8, 0xBC, 0xE6, 0x4D, 0xFA, 0x68, 0x8C,
-    0xDF, 0x1F, 0xE2, 0x1B, 0x86, 0x3A, 0xFE, 0xD6, 0xA4, 0xC0, 0x1A, 0xA7, 0xE7, 0xE6, 0x1D, 0x50,
-    0x25, 0x6C, 0xD2, 0x71, 0x3E, 0x28, 0xA2, 0xA7, 0x66, 0x48, 0x9E, 0xD3, 0xF3, 0xB4, 0x20, 0x72,
-    0x1C, 0xB1, 0xB0, 0x4F, 0x70, 0xA1, 0x09, 0x0F, 0xB6, 0x9D, 0x9C, 0x40, 0x97, 0xBE, 0x82, 0x69,
-    0x0F, 0x98, 0xB0, 0x26, 0x36, 0x82, 0x92, 0xEE, 0x2B, 0xD3, 0x0B, 0x60, 0x16, 0x30, 0x31, 0x4E,
-    0xF0, 0xA6, 0x07, 0x9F, 0xDD, 0x86, 0x95, 0xCC, 0x86, 0xC4, 0x49, 0xC8, 0xAA, 0x98, 0x5E, 0x70,
-    0xDC, 0x80, 0xA5, 0x91, 0x36, 0xA4, 0xB9, 0xF6, 0x09, 0x70, 0xC1, 0x26, 0xF7, 0xBC, 0x0D, 0x6D,
-    0x6E, 0xAF, 0x49, 0xF4, 0x05, 0x56, 0xAD, 0x2C, 0x99, 0x18, 0xAE, 0x7B, 0xD3, 0x73, 0xE7, 0xD5,
-    0x0A, 0xE3, 0xC9, 0x6C, 0x12, 0xF3, 0x9B, 0x69, 0xEE, 0xA0, 0x9B, 0x82, 0xC1, 0x34, 0xD5, 0xB8,
-    0xC4, 0x9E, 0x7A, 0x0A, 0x42, 0xE5, 0x3F, 0x38, 0xD1, 0x49, 0xA6, 0x8E, 0x27, 0xB3, 0x09, 0xEA,
-    0x92, 0xC5, 0x8A, 0x20, 0xF3, 0x39, 0x37, 0xA0, 0x4D, 0x17, 0x3D, 0x39, 0x9F, 0x72, 0x77, 0x73,
-    0xA3, 0x12, 0xEF, 0xF3, 0xC6, 0xCA, 0x57, 0x0E, 0xD2, 0xE2, 0x0D, 0x38, 0xC1, 0x8F, 0xCC, 0xD2,
-    0xD0, 0xC1, 0x23, 0x8F, 0x46, 0xA6, 0xF7, 0x0B, 0xE7, 0xDC, 0x34, 0x4F, 0xAD, 0xA0, 0x3A, 0x4C,
-    0xAE, 0x95, 0x49, 0x22, 0x61, 0x27, 0x87, 0xFB, 0xB5, 0x8E, 0x6F, 0x53, 0x13, 0xDC, 0x2D, 0xD0,
-    0x0F, 0x33, 0x59, 0x1F, 0xD1, 0xF5, 0x8A, 0x32, 0x68, 0x63, 0x72, 0x08, 0xE3, 0x7F, 0x0F, 0x96,
-    0x31, 0x6A, 0xDD, 0x22, 0x32, 0xFF, 0x53, 0x07, 0xFF, 0x6E, 0x1A, 0xB7, 0x08, 0xDB, 0x5D, 0xBF,
-    0x81, 0xE6, 0x27, 0xB5, 0x29, 0x9F, 0x2C, 0xFA, 0xD9, 0x72, 0x3D, 0xB2, 0x2C, 0x8A, 0x26, 0x69,
-    0x23, 0x5D, 0xAB, 0x54, 0x8E, 0xC3, 0x80, 0x42, 0x6C, 0xEB, 0xFC, 0x93, 0x1F, 0x74, 0x79, 0xA6,
-    0xDA, 0x12, 0x6E, 0x94, 0xC2, 0x60, 0x63, 0xC4, 0x9D, 0x45, 0x13, 0x17, 0x8E, 0xB9, 0xDD, 0xFF,
-    0xE3, 0xD3, 0x1A, 0xB2, 0x7D, 0xCB, 0x37, 0x4D, 0x24, 0x73, 0x89, 0x2A, 0xEA, 0x39, 0xE8, 0xED,
-    0x0A, 0xA6, 0x12, 0x15, 0x4E, 0x0B, 0xF0, 0x9C, 0x3D, 0x2D, 0xF0, 0x35, 0x8F, 0x2D, 0x5C, 0x76,
-    0x82, 0x4A, 0x73, 0xC5, 0xEE, 0x0D, 0xFE, 0x9D, 0x03, 0x8E, 0x65, 0x90, 0x44, 0xC2, 0x14, 0x73,
-    0x21, 0x3B, 0xB4, 0xC0, 0x0B, 0x01, 0xFE, 0x94, 0x2E, 0x9D, 0xDD, 0xF5, 0x1F, 0xE4, 0xC5, 0xB7,
-    0x2C, 0xEE, 0xE4, 0x13, 0xCB, 0xE5, 0xDA, 0x85, 0xF8, 0x91, 0x31, 0x74, 0x28, 0x7E, 0x6B, 0x7E,
-    0xF5, 0xEA, 0xA3, 0xC1, 0x6E, 0xA4, 0xA6, 0xE0, 0x7B, 0x08, 0x60, 0xF6, 0x3F, 0x6F, 0x74, 0x43,
-    0xD5, 0x33, 0xD1, 0xE3, 0xD7, 0x36, 0xDF, 0x37, 0xE6, 0x0F, 0x75, 0x64, 0xCA, 0x5B, 0xBA, 0x8B,
-    0xC8, 0x59, 0x2E, 0x51, 0x23, 0x7B, 0x07, 0xDD, 0x13, 0x01, 0x52, 0x48, 0x42, 0xFC, 0xD3, 0x74,
-    0xF3, 0xFE, 0x72, 0x05, 0x73, 0x08, 0x04, 0x54, 0x6F, 0x7A, 0xB0, 0x51, 0x08, 0x8C, 0xA6, 0x8E,
-    0xD9, 0xD9, 0xAD, 0x56, 0xFC, 0x09, 0x0D, 0xA5, 0xCB, 0x60, 0x7A, 0x75, 0x64, 0x40, 0xA7, 0x79,
-    0x70, 0x76, 0x18, 0x8F, 0x6F, 0x40, 0x08, 0x14, 0xB5, 0x5A, 0xFD, 0x98, 0xD0, 0x13, 0x5B, 0xCE,
-    0x79, 0xBD, 0xFD, 0x93, 0x70, 0x86, 0xB7, 0x51, 0x5E, 0xC8, 0x42, 0xF4, 0x78, 0xF9, 0xAE, 0xF9,
-    0x55, 0x9E, 0x59, 0xEC, 0x69, 0x21, 0x1E, 0xA0, 0x68, 0xD0, 0x7D, 0x21, 0x12, 0xE8, 0x2C, 0x29,
-    0x07, 0x22, 0x63, 0x5E, 0x31, 0x6F, 0xDD, 0x22, 0xF4, 0x1A, 0x9B, 0xB9, 0xE3, 0x62, 0x0C, 0x93,
-    0x54, 0x62, 0x69, 0xF1, 0x6D, 0xF2, 0x27, 0xC5, 0x93, 0x01, 0x34, 0x07, 0x85, 0x9F, 0x97, 0xE4,
-    0x9F, 0xAC, 0x26, 0x39, 0xBA, 0x5D, 0x06, 0xCF, 0x79, 0x1A, 0xE3, 0x8C, 0xDD, 0x1B, 0xA2, 0xC7,
-    0xC5, 0x9D, 0x27, 0x47, 0x93, 0xAD, 0x12, 0x73, 0xC5, 0xAE, 0x59, 0x88, 0x57, 0x54, 0x88, 0x26,
-    0x89, 0x4B, 0x0B, 0xA0, 0xBA, 0x1D, 0xB8, 0x30, 0x23, 0x1F, 0x1E, 0x7A, 0x1C, 0xD1, 0x40, 0xE4,
-    0x1F, 0xA4, 0x25, 0x86, 0xCB, 0x39, 0xDD, 0x16, 0x40, 0x17, 0xDD, 0x66, 0x3A, 0x82, 0x46, 0x79,
-    0x63, 0x7A, 0x1C, 0x68, 0xE3, 0xC9, 0x78, 0xFC, 0xCE, 0x30, 0x45, 0x99, 0x7C, 0x9A, 0x7B, 0x24,
-    0x81, 0xA4, 0x62, 0xC1, 0x33, 0x6F, 0xE7, 0x49, 0xC8, 0xCE, 0x22, 0xA6, 0x3A, 0xD5, 0xB9, 0xA6,
-    0xCB, 0xA5, 0x5B, 0x58, 0x7B, 0x34, 0x6E, 0x71, 0xD6, 0x53, 0x39, 0x04, 0x32, 0x34, 0x54, 0x23,
-    0x46, 0xD0, 0xE1, 0xF0, 0x1F, 0x75, 0x36, 0x46, 0x5B, 0x11, 0xDD, 0xEF, 0x5F, 0x38, 0x34, 0x32,
-    0x18, 0x4F, 0x50, 0x5D, 0x47, 0x74, 0x1A, 0x58, 0xD8, 0x17, 0x61, 0x1C, 0xD3, 0x08, 0xAB, 0x64,
-    0xFE, 0x39, 0xF1, 0xFB, 0xEF, 0xF4, 0x88, 0x21, 0xFC, 0x1A, 0x8C, 0x8B, 0xDF, 0xAC, 0x6D, 0x6C,
-    0x19, 0xDE, 0x86, 0x7F, 0x64, 0x47, 0x57, 0x32, 0xC6, 0xE3, 0x31, 0x6D, 0xBE, 0xAE, 0xAF, 0x26,
-    0x87, 0x55, 0xD2, 0x3B, 0x9B, 0x70, 0x70, 0x92, 0x74, 0xFB, 0x47, 0x0D, 0x55, 0x8A, 0x89, 0xDF,
-    0x6B, 0xAA, 0x25, 0x27, 0x33, 0x84, 0xE5, 0x39, 0xBF, 0x5D, 0xA7, 0x10, 0x59, 0x05, 0x85, 0x75,
-    0x2A, 0x21, 0x1D, 0xFD, 0x97, 0x2A, 0x40, 0xB2, 0xD2, 0x2C, 0x2E, 0x22, 0xEE, 0x82, 0x17, 0x93,
-    0x35, 0x3C, 0x40, 0xF3, 0xD8, 0x5A, 0x2C, 0xBF, 0xD7, 0x90, 0x39, 0x8D, 0x8A, 0xB0, 0xC8, 0xDD,
-    0xCA, 0xE9, 0x16, 0x76, 0xE5, 0x81, 0x82, 0xCA, 0x23, 0x2C, 0x7F, 0xDA, 0xE3, 0x8B, 0xCE, 0x50,
-    0x71, 0x0A, 0x5F, 0xF9, 0xBF, 0x3A, 0x78, 0x3C, 0xBF, 0xE3, 0x9A, 0xB0, 0xC1, 0x0C, 0x54, 0xFF,
-    0x4A, 0x8A, 0x55, 0x26, 0xDE, 0x00, 0xF4, 0x8C, 0xE8, 0x0B, 0xFC, 0xFD, 0xEE, 0x49, 0x3D, 0x48,
-    0xBB, 0x33, 0x3E, 0x4B, 0x08, 0x7E, 0x58, 0x71, 0x6F, 0xA3, 0xC0, 0xC2, 0x9A, 0xEF, 0x13, 0x42,
-    0x20, 0x54, 0x1E, 0x03, 0xA1, 0x60, 0x93, 0xC7, 0x88, 0x78, 0x56, 0x67, 0x9D, 0xFB, 0xCB, 0x4F,
-    0x69, 0xFA, 0x3F, 0x66, 0xD5, 0x6B, 0x74, 0x2E, 0xB1, 0xF8, 0x41, 0x85, 0x97, 0xB9, 0xE4, 0x0F,
-    0x96, 0x1B, 0x86, 0x36, 0x89, 0x02, 0x80, 0xA8, 0xE9, 0x79, 0x5D, 0xBE, 0x4B, 0xD3, 0x53, 0x7A,
-    0x66, 0xFB, 0x96, 0xB4, 0x91, 0x49, 0x34, 0x24, 0xDF, 0x95, 0x28, 0xC8, 0x5C, 0x17, 0x9A, 0x26,
-    0xB8, 0x0D, 0xE8, 0x19, 0xFA, 0x0B, 0x26, 0xE8, 0xC5, 0x6B, 0x79, 0x28, 0x67, 0x83, 0xD2, 0x6C,
-    0x78, 0x62, 0x05, 0x5D, 0x11, 0x68, 0x0F, 0x7C, 0xCE, 0x05, 0xC6, 0xE3, 0x52, 0x32, 0xDD, 0x67,
-    0x18, 0x9E, 0x73, 0x26, 0x71, 0xEA, 0x7B, 0x00, 0xF9, 0x08, 0x7D, 0x19, 0x85, 0xBA, 0x1C, 0x99,
-    0xB7, 0xF2, 0x12, 0xE8, 0x17, 0x17, 0x68, 0x47, 0xA9, 0x96, 0x9C, 0xF8, 0xC4, 0xFD, 0x1F, 0x44,
-    0x8A, 0x13, 0xA7, 0x47, 0x99, 0x31, 0xB0, 0xEA, 0x09, 0xAB, 0x3E, 0xC2, 0x57, 0x31, 0xB0, 0x11,
-    0xA1, 0x6F, 0xC1, 0xD4, 0x1B, 0xFC, 0x2E, 0x49, 0x1F, 0x2C, 0xD7, 0xF4, 0xF3, 0x12, 0xF4, 0x3A,
-    0x65, 0x86, 0xDD, 0x2F, 0x67, 0x78, 0x3C, 0x09, 0xBD, 0x27, 0x8E, 0xAD, 0x9E, 0x20, 0xD8, 0xF1,
-    0xCC, 0x0F, 0x8D, 0x1C, 0x87, 0xD4, 0xA8, 0x15, 0x64, 0xD8, 0xA0, 0x31, 0xFC, 0x3A, 0x44, 0x93,
-    0x9B, 0x02, 0x44, 0x9C, 0xE4, 0x90, 0xC9, 0xA1, 0x97, 0xE2, 0x9A, 0xEC, 0x34, 0xAA, 0xE0, 0xF7,
-    0x36, 0xA9, 0x49, 0xBC, 0x0C, 0x22, 0x3C, 0x13, 0xB1, 0x2C, 0x29, 0xF8, 0x54, 0x74, 0x6D, 0x1B,
-    0x95, 0x36, 0x20, 0x05, 0xE2, 0x88, 0xC2, 0x7A, 0xF0, 0x04, 0x40, 0x89, 0x19, 0x76, 0x2A, 0x39,
-    0x4F, 0x9B, 0x1D, 0x72, 0xB8, 0xFF, 0x02, 0x3E, 0xBB, 0x8F, 0x29, 0xCC, 0xEF, 0x33, 0x6D, 0xEC,
-    0xF3, 0x3C, 0x27, 0x5D, 0xDC, 0x22, 0xDC, 0xBE, 0xD8, 0x71, 0x4F, 0x8F, 0x9B, 0x4E, 0xED, 0xE4,
-    0x94, 0x04, 0x7D, 0x16, 0x6E, 0x4D, 0x58, 0x6A, 0xA3, 0x64, 0xED, 0x99, 0x3C, 0xCB, 0x61, 0x51,
-    0x22, 0x37, 0xA7, 0x69, 0x4A, 0x8D, 0x85, 0x34, 0x49, 0x33, 0x7B, 0xA6, 0xE3, 0xDB, 0x3C, 0x1D,
-    0xC7, 0xA4, 0x78, 0x6B, 0x6C, 0x5E, 0x6C, 0xCF, 0x4F, 0x33, 0x06, 0xDA, 0x50, 0x83, 0xF1, 0x7E,
-    0x56, 0xE8, 0xA1, 0x79, 0x3E, 0x8C, 0xC9, 0xB0, 0x42, 0x8D, 0xAD, 0xFD, 0xE1, 0x02, 0xC2, 0x8A,
-    0x6C, 0x64, 0x80, 0xCC, 0xE1, 0xC0, 0x23, 0x8A, 0xC0, 0x72, 0xFF, 0xDE, 0xE7, 0x08, 0x55, 0x82,
-    0x3B, 0x95, 0x5B, 0x63, 0x49, 0xE3, 0x64, 0xE8, 0x47, 0xAD, 0xFB, 0xB4, 0x0D, 0x8B, 0xE0, 0xB3,
-    0x0A, 0xEE, 0xCB, 0x32, 0x90, 0xBE, 0x8F, 0x89, 0xD4, 0x80, 0xC9, 0x38, 0x33, 0x89, 0xDB, 0x59,
-    0xF1, 0x60, 0x28, 0xDA, 0xE7, 0x26, 0x73, 0xCA, 0xB9, 0x29, 0xD3, 0x18, 0x01, 0xA8, 0x03, 0xAE,
-    0x1B, 0xD4, 0xF1, 0x94, 0x1A, 0xDD, 0xA2, 0x9B, 0x39, 0x47, 0xA1, 0x61, 0x13, 0x90, 0x91, 0x5E,
-    0xED, 0xC1, 0x0B, 0x74, 0xC1, 0xE8, 0x0B, 0x4A, 0xF8, 0x08, 0x28, 0x02, 0x28, 0xB9, 0xF8, 0xB4,
-    0x46, 0xA8, 0x14, 0x63, 0x86, 0x67, 0x6B, 0x75, 0xC4, 0xAC, 0x02, 0x72, 0x15, 0xA8, 0x7B, 0xEA,
-    0xE1, 0xAD, 0x4C, 0x77, 0x13, 0xCF, 0x1D, 0x1E, 0x19, 0x1A, 0x0F, 0x30, 0xBB, 0x10, 0xC0, 0xE0,
-    0x8F, 0x08, 0x6E, 0x2B, 0x08, 0x08, 0xC2, 0xCC, 0x27, 0x32, 0xCE, 0x1D, 0x1A, 0x19, 0x0B, 0x90,
-    0x6A, 0x4D, 0x23, 0xE6, 0xDC, 0x56, 0x60, 0xE1, 0xC8, 0xFE, 0xB3, 0x3A, 0x5F, 0x79, 0x74, 0x2D,
-    0x30, 0x26, 0x09, 0x3E, 0x87, 0x7D, 0x31, 0xC0, 0xBC, 0xB4, 0x36, 0x1F, 0xE6, 0x39, 0x3C, 0xCF,
-    0x7B, 0xB5, 0xCF, 0x23, 0x75, 0x33, 0x88, 0xA8, 0x5E, 0x60, 0xB0, 0x23, 0xE0, 0x3B, 0x87, 0x5F,
-    0xF7, 0x1E, 0x44, 0xC9, 0x27, 0x9B, 0xF1, 0x08, 0x5F, 0x33, 0xBB, 0x45, 0xAF, 0x71, 0x7E, 0x50,
-    0x82, 0x6D, 0xBA, 0x87, 0x1F, 0x73, 0x3B, 0x3F, 0x4E, 0x30, 0x99, 0x9C, 0x08, 0x3F, 0x10, 0x5C,
-    0x99, 0x3D, 0xD4, 0x53, 0x00, 0x67, 0xE9, 0xC9, 0x12, 0xB0, 0x82, 0xDB, 0xDC, 0xE7, 0x67, 0x2A,
-    0xC5, 0x63, 0x86, 0x82, 0x39, 0x45, 0xEB, 0xA1, 0xEE, 0xDA, 0x08, 0x75, 0x00, 0x55, 0x3A, 0x34,
-    0x08, 0x51, 0xCA, 0x08, 0x73, 0xEF, 0xF2, 0x5B, 0x3D, 0xA2, 0x90, 0xB2, 0xEA, 0x9F, 0xBF, 0xC4,
-    0x11, 0xC9, 0x1E, 0x2E, 0x4D, 0xF0, 0x01, 0xAC, 0x30, 0x14, 0xA2, 0x0B, 0xCC, 0x87, 0xE0, 0x02,
-    0x58, 0x71, 0xB5, 0xC5, 0x54, 0x68, 0xDC, 0xEE, 0xD4, 0x16, 0x29, 0x35, 0x5B, 0xAD, 0xDB, 0x3F,
-    0xB4, 0xD5, 0xE9, 0xC0, 0x42, 0xC5, 0xAD, 0x78, 0x22, 0x07, 0xBE, 0xE9, 0xD5, 0x24, 0xC2, 0xD7,
-    0x6A, 0xCD, 0x70, 0xD1, 0x04, 0x1F, 0xC3, 0x4C, 0xF7, 0xA1, 0xA9, 0x02, 0x6A, 0xD8, 0x97, 0x3A,
-    0xA9, 0x49, 0x48, 0xB3, 0xF9, 0x63, 0x2E, 0xB6, 0x2D, 0x1D, 0x79, 0xF6, 0x64, 0xD6, 0x37, 0x8E,
-    0xC7, 0xFF, 0x0B, 0xD5, 0x5C, 0x3D, 0x90, 0xDC, 0xC6, 0x95, 0x6E, 0x00, 0xDA, 0x45, 0x99, 0x08,
-    0xC0, 0x80, 0x3C, 0xD7, 0x51, 0x55, 0x86, 0x83, 0x0B, 0x64, 0x95, 0x6C, 0xA4, 0x0A, 0x64, 0x02,
-    0x32, 0xAB, 0x4E, 0x81, 0x03, 0xF2, 0xAE, 0x38, 0x52, 0xC0, 0x80, 0x0A, 0x2E, 0xB0, 0xE5, 0xAA,
-    0xDB, 0xC4, 0x81, 0x03, 0x99, 0x0D, 0x99, 0x81, 0x03, 0x07, 0xDC, 0xE0, 0x78, 0xE9, 0x31, 0x50,
-    0xB0, 0x5C, 0x05, 0xBA, 0xE0, 0x02, 0x57, 0x1D, 0x45, 0x40, 0x62, 0xA0, 0x80, 0x01, 0x47, 0x56,
-    0xB1, 0x14, 0x5C, 0x20, 0xD8, 0x22, 0x8B, 0x25, 0x29, 0x58, 0x48, 0x84, 0xBC, 0x58, 0x12, 0x40,
-    0xDF, 0xFB, 0xBE, 0x06, 0x66, 0x67, 0x96, 0x14, 0xFF, 0x97, 0x5A, 0x2D, 0x39, 0x18, 0x0C, 0x06,
-    0xE8, 0x7E, 0xFD, 0xFA, 0xF5, 0x7B, 0xDF, 0xFB, 0xE9, 0x51, 0x4B, 0x93, 0x49, 0xAA, 0x54, 0x60,
-    0xCC, 0x74, 0x3C, 0x3A, 0xBC, 0xB2, 0xF0, 0x17, 0x94, 0x38, 0x86, 0x15, 0x8E, 0x51, 0x8D, 0x63,
-    0xD2, 0xE2, 0x78, 0x98, 0xC7, 0xF7, 0x4E, 0xE1, 0xD8, 0x26, 0x72, 0x70, 0xDA, 0x44, 0x9E, 0xF5,
-    0xEA, 0xA8, 0x90, 0x63, 0x15, 0x16, 0x78, 0x14, 0x0F, 0x87, 0x53, 0x5F, 0x1E, 0x8E, 0x0A, 0x4F,
-    0x1E, 0x8E, 0x33, 0xB7, 0x91, 0x06, 0xE4, 0x5E, 0xA5, 0xF2, 0xC9, 0xA4, 0x53, 0xCA, 0xC8, 0x9F,
-    0x72, 0x78, 0x74, 0xFB, 0xF5, 0xF5, 0x3C, 0xC3, 0x6D, 0x51, 0x81, 0x47, 0xC2, 0x69, 0x28, 0x8F,
-    0x07, 0x15, 0x1A, 0xF4, 0xAB, 0x18, 0xCD, 0x36, 0xE8, 0xC2, 0x6D, 0x35, 0x3A, 0xED, 0x7A, 0x1C,
-    0x7B, 0x35, 0x99, 0x1C, 0x57, 0x89, 0x3C, 0x1E, 0x1A, 0x53, 0x08, 0xFD, 0xC7, 0x2C, 0xD9, 0x07,
-    0x53, 0xE5, 0x1B, 0x93, 0xCA, 0xC5, 0xC6, 0xDD, 0xFA, 0x67, 0xA3, 0x7E, 0xAC, 0xD0, 0x98, 0x0B,
-    0xA2, 0xF1, 0x74, 0xC8, 0x36, 0x9D, 0x77, 0x4D, 0x2B, 0x77, 0x99, 0xA0, 0x3F, 0x1B, 0x5D, 0x6E,
-    0x94, 0x7F, 0xB3, 0x11, 0xCA, 0x84, 0x28, 0x2D, 0xB7, 0xC4, 0x57, 0xA6, 0x2A, 0xBC, 0xD9, 0xAA,
-    0xA8, 0xCD, 0xAF, 0xEA, 0x5C, 0xDA, 0xF9, 0x53, 0x91, 0x9B, 0x5F, 0x54, 0xEA, 0x38, 0x78, 0xA2,
-    0x1C, 0x50, 0x96, 0x79, 0x72, 0xF4, 0xAF, 0xAF, 0x48, 0x5B, 0xAE, 0xF4, 0x25, 0x5F, 0xE4, 0x1D,
-    0xFA, 0x76, 0x94, 0xFA, 0xBE, 0x31, 0xB1, 0x54, 0x2F, 0xA8, 0x97, 0x54, 0xA8, 0x82, 0xEB, 0x2B,
-    0x99, 0x34, 0x57, 0x88, 0x3C, 0x64, 0x4A, 0x3D, 0x33, 0x90, 0xEF, 0xC8, 0xA0, 0xB5, 0xA9, 0xD1,
-    0x4F, 0x16, 0xFF, 0xC7, 0x4A, 0xE5, 0xE2, 0x11, 0x21, 0x84, 0x6D, 0x82, 0x74, 0x72, 0xF5, 0x90,
-    0x3C, 0xA7, 0x8D, 0xA9, 0xF2, 0xCF, 0xFF, 0xA5, 0xCD, 0x33, 0xA5, 0x93, 0x4C, 0x45, 0xC2, 0x44,
-    0x7F, 0xB3, 0x92, 0xDE, 0x40, 0x65, 0x52, 0x38, 0xE6, 0x72, 0xF7, 0xDA, 0xED, 0x4A, 0x26, 0xE5,
-    0x42, 0x60, 0xEA, 0x58, 0x2D, 0xA5, 0xDF, 0x0B, 0xEE, 0xE0, 0x8F, 0x74, 0x79, 0xA4, 0x34, 0x28,
-    0x48, 0x6F, 0xC6, 0x23, 0x47, 0x10, 0xDA, 0x2B, 0x86, 0xF7, 0x98, 0x71, 0xD6, 0x27, 0x8A, 0x32,
-    0xE8, 0x19, 0xD3, 0x2B, 0xB0, 0x4D, 0x65, 0x4A, 0x78, 0x62, 0x85, 0x10, 0x3D, 0x2A, 0x7B, 0x02,
-    0x29, 0x04, 0x79, 0x05, 0x18, 0x17, 0x97, 0x2A, 0xBA, 0xD4, 0xD8, 0x91, 0x46, 0x1F, 0x82, 0x73,
-    0x72, 0x92, 0x5C, 0x82, 0x1C, 0xC6, 0xDF, 0x9C, 0xDC, 0x28, 0xC0, 0x3A, 0xD7, 0x74, 0x42, 0xC2,
-    0x71, 0xD5, 0x80, 0x47, 0x23, 0x3D, 0xCD, 0x48, 0x4C, 0x3B, 0x52, 0x92, 0x54, 0x03, 0x1D, 0x87,
-    0xCE, 0x8D, 0xEC, 0xF5, 0x31, 0x0A, 0x6F, 0x76, 0x70, 0x38, 0xA8, 0xFD, 0x8B, 0xB2, 0xFA, 0xAC,
-    0xD9, 0x12, 0xCE, 0x19, 0x3B, 0xDD, 0x42, 0xD8, 0x54, 0xFD, 0xBB, 0x82, 0x30, 0xA8, 0x1C, 0x07,
-    0x0C, 0x80, 0x13, 0xCF, 0xF5, 0x64, 0x1B, 0x74, 0x38, 0x4F, 0xB9, 0x1A, 0xBF, 0x09, 0xD0, 0x95,
-    0xBB, 0xE3, 0x22, 0xEF, 0xB4, 0xBC, 0x4C, 0x78, 0x13, 0x3F, 0x9B, 0xD9, 0x9C, 0xBB, 0xD2, 0xC7,
-    0x92, 0x8A, 0xCD, 0xBA, 0x49, 0x65, 0x31, 0x49, 0xAF, 0xA2, 0x91, 0xA4, 0x87, 0x25, 0xAC, 0x37,
-    0xB5, 0x4F, 0x46, 0xA0, 0x33, 0x99, 0x1C, 0x36, 0x86, 0xFE, 0xC0, 0xFD, 0x03, 0x83, 0x74, 0x4E,
-    0x30, 0xBB, 0xD3, 0xD8, 0x98, 0x5F, 0x98, 0xB3, 0x17, 0xA2, 0x92, 0xAD, 0xA2, 0x3B, 0xF4, 0xDB,
-    0x2B, 0x3E, 0x15, 0x8A, 0x72, 0xC3, 0xC4, 0x0E, 0x1F, 0x41, 0x61, 0x34, 0xB5, 0x94, 0xE8, 0x42,
-    0xA5, 0xF9, 0xE7, 0xEF, 0xA6, 0xB9, 0xE9, 0xD4, 0x8A, 0x74, 0xE9, 0x1C, 0x1B, 0x3A, 0x54, 0x7E,
-    0xCF, 0xE9, 0x94, 0x06, 0xBD, 0xAD, 0x0E, 0x2C, 0x93, 0x56, 0xDC, 0x5A, 0xC9, 0xE9, 0x31, 0x21,
-    0x75, 0x8F, 0xF3, 0xCC, 0x7D, 0x9B, 0x12, 0xE0, 0x9A, 0x4A, 0xC5, 0x97, 0x4B, 0xA7, 0x0D, 0xCA,
-    0x28, 0xF3, 0xCB, 0xFD, 0xCA, 0x49, 0x77, 0x8B, 0x67, 0x4E, 0xB6, 0x38, 0x2E, 0x8A, 0x38, 0x2F,
-    0xEE, 0xFC, 0x5B, 0x31, 0xD7, 0x14, 0x09, 0x96, 0xA5, 0x61, 0x2A, 0xDF, 0xA4, 0xCE, 0x9F, 0x3D,
-    0x8C, 0xD2, 0xDD, 0x5E, 0x6F, 0x6C, 0x81, 0x8C, 0x43, 0x9F, 0x56, 0xCD, 0xB8, 0xF7, 0xE1, 0x19,
-    0xEF, 0x04, 0xA9, 0x03, 0x8F, 0x62, 0x7E, 0xE6, 0xF7, 0x1A, 0xA7, 0x41, 0x0F, 0x99, 0xC9, 0xFB,
-    0x77, 0x3A, 0x30, 0x4A, 0x14, 0xB6, 0x0C, 0x5F, 0x7A, 0x38, 0x28, 0xC4, 0x3B, 0xAB, 0xC3, 0x78,
-    0xE5, 0x33, 0x74, 0xF8, 0xEA, 0x36, 0xB1, 0x62, 0x11, 0x45, 0xF7, 0xC1, 0x3E, 0xE6, 0xD7, 0x57,
-    0xFC, 0x86, 0x0C, 0x70, 0x3A, 0xDB, 0x3B, 0x6E, 0xEF, 0xED, 0x62, 0x1A, 0x9F, 0xEE, 0x2D, 0x49,
-    0xE0, 0x25, 0x96, 0x5C, 0x54, 0xA9, 0xFD, 0xF1, 0xAD, 0xDF, 0x80, 0xD3, 0xE9, 0xB3, 0x46, 0x9E,
-    0x96, 0xB9, 0xD9, 0x97, 0xAA, 0xB7, 0x95, 0xD3, 0x80, 0x55, 0xD1, 0x07, 0x2D, 0x86, 0x0D, 0x1A,
-    0x63, 0x1C, 0x3C, 0x1A, 0x90, 0x83, 0x7B, 0x7D, 0x45, 0x2E, 0x67, 0x6A, 0x4D, 0x74, 0xA7, 0xFC,
-    0xEB, 0x54, 0xB8, 0x31, 0x55, 0x91, 0xB4, 0x12, 0x57, 0x33, 0xC2, 0x77, 0x41, 0xBA, 0xD6, 0xD4,
-    0xBE, 0x0C, 0xBA, 0x0D, 0x63, 0xE8, 0x20, 0x59, 0x4E, 0x0F, 0x56, 0x81, 0x19, 0xA3, 0xDC, 0x38,
-    0xC7, 0x16, 0xB8, 0x26, 0x14, 0x7C, 0x4E, 0x05, 0x2C, 0xB7, 0x44, 0x06, 0xDC, 0xD3, 0x6A, 0x29,
-    0xAF, 0xC1, 0x9A, 0xB8, 0xA6, 0xBD, 0xA0, 0xDA, 0x8F, 0x4A, 0xA8, 0xFA, 0xF8, 0x7D, 0xDA, 0xB0,
-    0x57, 0xC0, 0xA7, 0x1E, 0x97, 0xAD, 0x05, 0x08, 0xBE, 0xA2, 0x8A, 0xFE, 0x10, 0x97, 0xF5, 0xCE,
-    0xCB, 0xF1, 0x87, 0xB3, 0xBB, 0xFD, 0x1A, 0x97, 0x13, 0x34, 0xE2, 0xF4, 0xB3, 0xB6, 0x5D, 0x93,
-    0x6A, 0xE5, 0x48, 0x97, 0xB0, 0x3D, 0x29, 0x28, 0x29, 0x41, 0xC9, 0xDB, 0x24, 0xCF, 0x5D, 0xFD,
-    0x35, 0xE5, 0xFA, 0x22, 0x8F, 0xED, 0xF6, 0xF1, 0x2B, 0xF0, 0xDE, 0xFF, 0x9A, 0x73, 0xF9, 0x55,
-    0x36, 0xC8, 0xFE, 0xD2, 0x31, 0x1C, 0x73, 0x23, 0x04, 0xCA, 0x9A, 0xB9, 0x51, 0xA9, 0xB0, 0x7B,
-    0x15, 0x2B, 0xBB, 0x54, 0xBA, 0x82, 0x04, 0x08, 0xF3, 0x35, 0x05, 0x2E, 0xE7, 0xB1, 0x27, 0x43,
-    0x7B, 0x3E, 0xDB, 0xCD, 0x1D, 0xFB, 0xF1, 0x18, 0xF0, 0xCE, 0x60, 0x7C, 0x0A, 0xA6, 0x7A, 0x6C,
-    0x2D, 0xEC, 0x4F, 0xDC, 0x66, 0x2F, 0x1F, 0x57, 0xB0, 0xFA, 0x47, 0xAA, 0x81, 0xB3, 0x9E, 0xA5,
-    0x9C, 0x9C, 0x04, 0xE0, 0x12, 0xB6, 0x86, 0x53, 0x67, 0xA5, 0xA3, 0xF4, 0xE7, 0x53, 0xF6, 0xD0,
-    0x72, 0x4A, 0x75, 0x86, 0xC9, 0x0D, 0x2A, 0x7C, 0x21, 0x2B, 0xA5, 0xA3, 0x90, 0xE2, 0x8B, 0xA0,
-    0xC2, 0x17, 0x6E, 0xFB, 0x4E, 0xBF, 0x0E, 0x7C, 0x20, 0x6B, 0x5F, 0x10, 0x82, 0x88, 0x34, 0x2C,
-    0x30, 0xBF, 0xA0, 0x55, 0xCA, 0xE7, 0x9E, 0x88, 0xA6, 0x78, 0x22, 0x64, 0x53, 0xB2, 0xF6, 0x66,
-    0x7D, 0x04, 0x1D, 0x04, 0x08, 0x9D, 0x0B, 0x21, 0xD6, 0xC6, 0x63, 0x65, 0x9A, 0x7E, 0x75, 0x60,
-    0xEE, 0x6C, 0x11, 0xE8, 0x41, 0xDE, 0xC1, 0xFE, 0xCC, 0xE1, 0x1C, 0x1C, 0x9C, 0xE4, 0xC7, 0xAC,
-    0x7E, 0x72, 0xC0, 0xD6, 0xC8, 0x7C, 0xD4, 0xE2, 0x51, 0xAD, 0x92, 0xAD, 0x95, 0x8D, 0x82, 0x5C,
-    0x10, 0x9E, 0x04, 0x2D, 0x24, 0xD6, 0x60, 0xD5, 0x24, 0x05, 0x59, 0x26, 0x5C, 0x72, 0x5A, 0x2C,
-    0x32, 0x0D, 0x89, 0x8D, 0x0A, 0x72, 0x53, 0x2E, 0xBA, 0x2D, 0xA4, 0x37, 0x77, 0x78, 0x27, 0x59,
-    0x19, 0x34, 0x62, 0xAF, 0x95, 0xB9, 0x9E, 0xE7, 0x80, 0xA5, 0x47, 0x8B, 0x81, 0x8F, 0xC7, 0xB9,
-    0x36, 0x26, 0xC7, 0x84, 0xE8, 0x0A, 0xAF, 0x6D, 0xB8, 0x0A, 0x4E, 0x9B, 0x4E, 0x5E, 0x3D, 0x5F,
-    0x03, 0xDD, 0xDF, 0xFA, 0x12, 0xCC, 0x2B, 0xF7, 0xB5, 0x7C, 0xE1, 0xFC, 0x7E, 0xF7, 0xDB, 0xF6,
-    0xFB, 0xF1, 0xC5, 0x7E, 0x81, 0x99, 0x41, 0x84, 0xB0, 0x63, 0xA2, 0x66, 0xA0, 0x59, 0xEE, 0x9B,
-    0x42, 0x2F, 0xA6, 0x41, 0xF7, 0xC3, 0x4E, 0x26, 0x8F, 0xA3, 0x4E, 0xFE, 0x08, 0x20, 0x22, 0x02,
-    0x13, 0x5D, 0x96, 0xD5, 0xD8, 0x42, 0x9C, 0xAF, 0x40, 0x15, 0x99, 0xF5, 0xF5, 0xF5, 0x33, 0xE5,
-    0xA0, 0x44, 0xA8, 0x63, 0x74, 0x3A, 0x68, 0x5C, 0x11, 0x27, 0x27, 0xD5, 0x5B, 0xBF, 0xA1, 0xF0,
-    0x43, 0x7F, 0xAC, 0x5A, 0x3C, 0x94, 0xA9, 0xFF, 0xF6, 0x0A, 0xA7, 0xF2, 0xB6, 0x4E, 0x94, 0xC4,
-    0x99, 0x09, 0x1E, 0xDD, 0xF6, 0x39, 0x9E, 0x26, 0x17, 0xBC, 0x4C, 0xFD, 0x56, 0xFD, 0x5C, 0x40,
-    0x93, 0xBB, 0x75, 0x42, 0xC4, 0xDE, 0x40, 0x31, 0x80, 0x9A, 0x11, 0xF5, 0x3E, 0x05, 0x76, 0xD0,
-    0xEE, 0x60, 0x65, 0x43, 0xD4, 0xBC, 0xCA, 0x7E, 0x9E, 0xFB, 0x7B, 0x9A, 0xEC, 0xB0, 0x46, 0x8F,
-    0x00, 0xBB, 0x19, 0x4E, 0xD4, 0x02, 0x35, 0xBB, 0xCF, 0x8E, 0xA7, 0x3B, 0x5C, 0x17, 0x7C, 0x2F,
-    0x2C, 0x6A, 0x8E, 0x31, 0x62, 0x28, 0x0A, 0xE8, 0x1C, 0x18, 0xF7, 0x6E, 0xE6, 0xF8, 0xF8, 0xA2,
-    0x5F, 0x5C, 0x28, 0xBD, 0xFC, 0x23, 0x3D, 0x15, 0x35, 0x95, 0x0B, 0x7B, 0xBC, 0x06, 0x1E, 0xE2,
-    0x65, 0x19, 0x45, 0x2B, 0xFA, 0x3B, 0xB2, 0xC3, 0xC5, 0xB8, 0x6F, 0xAD, 0xAF, 0xAF, 0xF5, 0xA3,
-    0x29, 0xCE, 0x47, 0x23, 0x0B, 0xA3, 0xE6, 0x88, 0x09, 0x3C, 0xE0, 0x9B, 0xFF, 0xCC, 0xD3, 0x08,
-    0x8D, 0xC5, 0xA0, 0x60, 0xE9, 0x64, 0x36, 0xF8, 0x14, 0x6F, 0x8E, 0x0E, 0x45, 0x33, 0x7A, 0x13,
-    0x79, 0x35, 0x73, 0x25, 0xC4, 0xF2, 0xAD, 0xF9, 0x95, 0xB8, 0xAB, 0xAD, 0xA8, 0x2C, 0x2D, 0xAD,
-    0xC6, 0x42, 0x5D, 0xD8, 0x2C, 0x58, 0xBC, 0xA7, 0xC9, 0x3A, 0x58, 0x7F, 0x91, 0x0F, 0x91, 0x90,
-    0x4E, 0x94, 0xB0, 0x77, 0x1B, 0xEE, 0x14, 0x06, 0x9D, 0x17, 0x73, 0x24, 0xED, 0x26, 0xEB, 0xB6,
-    0x60, 0x10, 0xA1, 0xE6, 0xD7, 0x08, 0x56, 0x2C, 0xE2, 0xC3, 0xDD, 0xE1, 0x27, 0x38, 0x76, 0x1E,
-    0x5D, 0x3B, 0x1C, 0x0F, 0x0C, 0x78, 0x77, 0x1B, 0x15, 0xE4, 0x82, 0x3D, 0x31, 0x1A, 0x43, 0x0C,
-    0xD8, 0x28, 0xF9, 0xE8, 0x17, 0xA1, 0x85, 0x46, 0xD9, 0x0C, 0x2F, 0x12, 0x20, 0x59, 0x6C, 0x64,
-    0x61, 0x12, 0xC1, 0xAC, 0x05, 0x4F, 0x16, 0x47, 0x05, 0xC0, 0xD6, 0xE6, 0x5D, 0x78, 0xCA, 0x3D,
-    0xA6, 0xC4, 0xDC, 0xA2, 0xE3, 0x75, 0x83, 0x44, 0x5B, 0xB1, 0x4F, 0xE8, 0x4F, 0x42, 0xE8, 0xC3,
-    0x12, 0xE1, 0x81, 0xE4, 0x2D, 0x1C, 0x7B, 0xE0, 0x2A, 0xAF, 0x71, 0xCD, 0xAD, 0x75, 0x53, 0x12,
-    0x1A, 0x64, 0x82, 0x72, 0x40, 0x95, 0x33, 0x19, 0xC7, 0xA4, 0xE1, 0xD4, 0xCA, 0xCD, 0xDE, 0x37,
-    0x32, 0xD3, 0x9D, 0x28, 0x88, 0x44, 0x84, 0x42, 0x46, 0x32, 0x78, 0x3C, 0x18, 0xBC, 0xF8, 0xCF,
-    0x89, 0xA8, 0xEF, 0xCF, 0x2A, 0x73, 0x55, 0xE7, 0x02, 0xB1, 0xF4, 0xCD, 0x46, 0x08, 0x82, 0x39,
-    0xBF, 0x0D, 0x63, 0x04, 0x83, 0x05, 0xB4, 0xA6, 0x61, 0x32, 0x01, 0x92, 0x34, 0xAC, 0x15, 0xAF,
-    0xC0, 0xF0, 0x8B, 0x4F, 0x2E, 0xFE, 0xB8, 0x98, 0xAA, 0xAF, 0x7A, 0xB9, 0x1A, 0x76, 0xAF, 0x99,
-    0x8A, 0x16, 0x50, 0x03, 0x61, 0x1C, 0xE4, 0x8C, 0x13, 0x72, 0x03, 0x9D, 0x58, 0x9B, 0xFD, 0xA3,
-    0x54, 0xE5, 0x6F, 0x99, 0xDB, 0xA6, 0x8A, 0xC0, 0x35, 0x42, 0x59, 0x67, 0xAA, 0x5E, 0xC4, 0x12,
-    0xC2, 0x42, 0x0A, 0xAF, 0xE7, 0x58, 0x3A, 0xB8, 0x2C, 0x47, 0xF0, 0xDC, 0x49, 0xEF, 0x40, 0xFD,
-    0x5B, 0x8A, 0x48, 0xAC, 0x00, 0x9C, 0xEC, 0xC5, 0xDA, 0x2A, 0x31, 0x04, 0x16, 0xA9, 0x97, 0x33,
-    0xE8, 0x49, 0x45, 0x61, 0x41, 0xAD, 0xC3, 0x45, 0x48, 0x3A, 0x86, 0x09, 0x99, 0xF1, 0x3F, 0x37,
-    0x5F, 0x2E, 0xF2, 0xDF, 0xBA, 0x68, 0x2A, 0xFC, 0x8C, 0xBA, 0xEB, 0x8C, 0x45, 0x66, 0x53, 0xFA,
-    0xF3, 0x00, 0x10, 0xA5, 0x26, 0x3C, 0xCF, 0x4B, 0x4C, 0x6A, 0xDE, 0xAF, 0xE7, 0x0D, 0x65, 0xA0,
-    0x94, 0x81, 0x80, 0x2A, 0x80, 0x7C, 0x17, 0xA3, 0xF9, 0x99, 0x0A, 0x32, 0xD5, 0x9F, 0xA8, 0xD1,
-    0xEA, 0x30, 0x90, 0xA5, 0x39, 0x77, 0x5E, 0xFA, 0x3D, 0x02, 0x46, 0x25, 0xC2, 0xB1, 0xDB, 0x64,
-    0x1D, 0xB0, 0x17, 0x99, 0x99, 0x0F, 0x0C, 0xCF, 0xFB, 0x91, 0xE1, 0xDD, 0xC8, 0x70, 0x5C, 0xE1,
-    0xA4, 0x60, 0x76, 0x10, 0x63, 0x32, 0x98, 0x2F, 0x4C, 0x9C, 0x21, 0x98, 0xF3, 0x8D, 0xC0, 0x47,
-    0x42, 0x11, 0xBB, 0xD6, 0x18, 0x0F, 0xE9, 0x88, 0x4A, 0xAF, 0xA9, 0xA0, 0x89, 0x4C, 0x6E, 0x1C,
-    0xA2, 0x97, 0x9C, 0xA8, 0x5F, 0xBD, 0xBE, 0xCD, 0x27, 0xCB, 0x16, 0x62, 0x1C, 0x7B, 0xF9, 0x2E,
-    0xBE, 0xD6, 0x9E, 0xE6, 0xBA, 0x52, 0xE7, 0x86, 0x7E, 0xB8, 0xF0, 0xD8, 0xE1, 0xC2, 0x40, 0xF6,
-    0x0C, 0xD7, 0xBF, 0x17, 0xDA, 0x63, 0xF8, 0xDB, 0x47, 0xC3, 0x9D, 0xF0, 0x9C, 0xFD, 0xF9, 0x53,
-    0x35, 0x04, 0x8B, 0x94, 0xAA, 0xB6, 0x63, 0x94, 0xFF, 0x08, 0x92, 0xF1, 0xD5, 0x85, 0xC1, 0xFE,
-    0xB8, 0xF5, 0xF0, 0xDC, 0x4C, 0x8F, 0xEF, 0x11, 0x5D, 0xA3, 0x9E, 0x07, 0x7B, 0x03, 0xEB, 0xF3,
-    0x71, 0xCA, 0x10, 0x76, 0x0D, 0x0B, 0x0D, 0xDC, 0x04, 0xE4, 0xBD, 0x43, 0xD3, 0xDB, 0xB8, 0xA4,
-    0x1E, 0xBD, 0x37, 0xE7, 0xE1, 0x4E, 0x27, 0x93, 0xC9, 0xCA, 0x87, 0x60, 0x2E, 0x6C, 0xA4, 0x31,
-    0x1F, 0x8A, 0x6D, 0x5A, 0x7F, 0xE4, 0xC6, 0xB6, 0x4F, 0xED, 0x20, 0x5C, 0xAA, 0xC7, 0xC8, 0xD0,
-    0x45, 0xC9, 0xD5, 0x30, 0x0A, 0x99, 0x27, 0x4D, 0xA5, 0x79, 0x60, 0x36, 0x86, 0x43, 0x3C, 0x72,
-    0x39, 0xD2, 0x31, 0x22, 0x77, 0x06, 0x64, 0x76, 0xB7, 0xCB, 0x00, 0x68, 0x5D, 0x24, 0x86, 0xD0,
-    0xFB, 0x3B, 0xEC, 0x64, 0xB8, 0x71, 0x7D, 0x45, 0x2C, 0x47, 0x2D, 0x2E, 0x2E, 0xC2, 0x05, 0x71,
-    0x01, 0xE1, 0xD4, 0x8C, 0x4A, 0xB4, 0x58, 0xEA, 0x1E, 0x3D, 0xC1, 0x90, 0x51, 0xD3, 0x84, 0x8D,
-    0xD0, 0xB5, 0xF2, 0xE8, 0x2C, 0x3E, 0xF8, 0x65, 0xBA, 0x59, 0x36, 0xDE, 0x2A, 0xAD, 0x2F, 0xBE,
-    0xBD, 0xDA, 0x09, 0x27, 0xF5, 0x71, 0xB3, 0xF0, 0xC7, 0x8B, 0xF9, 0xE4, 0xAE, 0x0F, 0x38, 0xFC,
-    0xCE, 0x46, 0x6B, 0xCD, 0xEC, 0xAD, 0x17, 0xF6, 0xE7, 0x77, 0xEF, 0xE1, 0x71, 0xDF, 0xCE, 0xCD,
-    0x78, 0x49, 0xB6, 0x5A, 0xF0, 0x61, 0x51, 0x86, 0x80, 0x17, 0x47, 0x9F, 0x9D, 0x0C, 0xFC, 0xB5,
-    0xAC, 0xEE, 0x9C, 0xF5, 0x54, 0x25, 0xBF, 0x14, 0x3D, 0x1A, 0x7E, 0x2A, 0x8A, 0xCC, 0x33, 0xD7,
-    0xFC, 0x4E, 0xC1, 0x8D, 0xC9, 0x44, 0xE1, 0x05, 0x15, 0x79, 0xEB, 0x31, 0xFE, 0x4C, 0xD6, 0x92,
-    0xCB, 0xE4, 0x95, 0x65, 0x1B, 0x39, 0x48, 0xAE, 0xDD, 0xEF, 0xA2, 0x38, 0x02, 0xAF, 0x27, 0x8D,
-    0xF7, 0x81, 0x2C, 0x94, 0xF0, 0x15, 0x53, 0xFF, 0xCE, 0x31, 0xE9, 0x9C, 0x78, 0x8B, 0x33, 0x2B,
-    0x04, 0xB6, 0xB2, 0x34, 0x56, 0x95, 0x0D, 0x7D, 0x53, 0x87, 0x61, 0x50, 0x8F, 0xFB, 0x71, 0xE5,
-    0x9A, 0x88, 0x66, 0x2B, 0x3C, 0xA0, 0xBF, 0xFA, 0x4F, 0x51, 0xE7, 0x96, 0xA6, 0x5F, 0x09, 0xFE,
-    0x60, 0x9A, 0x97, 0x44, 0xC5, 0xCD, 0x87, 0x58, 0xC6, 0x08, 0x4E, 0x37, 0x17, 0x00, 0x7B, 0xB4,
-    0x8F, 0xE2, 0x81, 0x8A, 0x37, 0x2A, 0xFF, 0x67, 0xAE, 0xA8, 0x90, 0x20, 0xE3, 0x5B, 0x16, 0xBD,
-    0xA6, 0xD5, 0xE3, 0xFC, 0x77, 0xF2, 0x55, 0xDB, 0x94, 0xC0, 0x5C, 0x99, 0x50, 0xF9, 0x7F, 0x70,
-    0x72, 0x7C, 0xA0, 0xBF, 0x7B, 0xF4, 0xFF, 0xBF, 0x55, 0x41, 0xA4, 0xFC, 0x4B, 0xE2, 0xC4, 0x6A,
-    0xC4, 0x2F, 0xCB, 0xED, 0x94, 0x8F, 0xF4, 0x26, 0x96, 0x41, 0xAD, 0xF4, 0xA9, 0xC3, 0xD5, 0x06,
-    0xF6, 0xFA, 0x95, 0x7A, 0xC4, 0x0F, 0x42, 0xBE, 0x4C, 0xB5, 0x58, 0x8A, 0xE2, 0x05, 0xE5, 0x1F,
-    0x4D, 0xBD, 0x8F, 0xC4, 0x53, 0x4D, 0x4C, 0x8D, 0xA0, 0xEE, 0x76, 0x92, 0x49, 0xF8, 0x08, 0x18,
-    0x5E, 0x93, 0xB6, 0x47, 0xF8, 0xA0, 0xCD, 0xD7, 0xC6, 0xBC, 0x9F, 0x6F, 0xD9, 0x55, 0x81, 0x80,
-    0x48, 0xF1, 0x90, 0xA7, 0xCB, 0xFD, 0xCB, 0xC6, 0x5C, 0x46, 0x3C, 0xA1, 0x14, 0x4F, 0xCA, 0xA9,
-    0xE0, 0xC1, 0x1C, 0x86, 0x82, 0x70, 0x81, 0x3A, 0xA0, 0xF2, 0xB2, 0x24, 0x33, 0x62, 0xB5, 0xD2,
-    0x41, 0x70, 0x92, 0xB4, 0x43, 0x34, 0xFD, 0xDB, 0xDF, 0x82, 0xEC, 0x82, 0x5F, 0x24, 0xAA, 0xF1,
-    0xAA, 0xC0, 0x04, 0x58, 0xAA, 0xFF, 0x86, 0xCE, 0xE2, 0x29, 0xB8, 0xF3, 0xFA, 0x9C, 0xD3, 0xF3,
-    0xC4, 0x28, 0x57, 0xDD, 0x5D, 0xFE, 0x64, 0x72, 0x5D, 0x51, 0xA5, 0x45, 0xF8, 0x57, 0xE9, 0x23,
-    0xC9, 0xA4, 0xEF, 0x5E, 0x9E, 0xF5, 0x1A, 0x79, 0x3A, 0x2C, 0xA3, 0x62, 0x17, 0x2E, 0x2D, 0xF7,
-    0xA9, 0xB7, 0x85, 0x1E, 0xBF, 0x14, 0x9A, 0x08, 0xC7, 0xFA, 0x51, 0xF7, 0x44, 0x83, 0x27, 0x14,
-    0xDA, 0xF8, 0x9B, 0xB0, 0xD2, 0x94, 0x83, 0xB5, 0x17, 0x6D, 0x21, 0x0A, 0xE9, 0x63, 0xB1, 0x20,
-    0x47, 0x4B, 0xD5, 0xFE, 0x60, 0x31, 0x8A, 0x90, 0xA4, 0x5E, 0xD5, 0xA9, 0xF0, 0x52, 0xAD, 0x12,
-    0x99, 0xF2, 0xF6, 0x71, 0x3E, 0xDA, 0x18, 0x05, 0xDC, 0xD3, 0xC4, 0x02, 0x0B, 0x28, 0x0C, 0x64,
-    0xF5, 0x3A, 0x9A, 0xFB, 0xB0, 0x1B, 0x32, 0x35, 0xA5, 0x78, 0xAE, 0x53, 0x95, 0x9C, 0x9C, 0x22,
-    0x55, 0x07, 0xD7, 0x65, 0x3E, 0x5F, 0x12, 0x65, 0x44, 0x42, 0xC0, 0x41, 0x40, 0x9D, 0xC0, 0x4A,
-    0xBB, 0xF4, 0xD1, 0xC6, 0xF2, 0x45, 0x27, 0x0B, 0x48, 0xF2, 0x04, 0x44, 0x04, 0xFD, 0xA0, 0x42,
-    0x41, 0x64, 0x8E, 0x78, 0xB6, 0x88, 0x40, 0x5C, 0x20, 0xF1, 0x77, 0x58, 0xD8, 0x3B, 0x4F, 0xE4,
-    0x93, 0xD1, 0x6B, 0xDF, 0xF2, 0x51, 0x08, 0x0C, 0x85, 0x5D, 0x89, 0x4C, 0x26, 0xA0, 0x31, 0x94,
-    0x2F, 0x42, 0xDA, 0x36, 0x72, 0x0C, 0xA9, 0x10, 0x4C, 0xAE, 0x71, 0x90, 0x8B, 0x06, 0x3C, 0xA6,
-    0xED, 0xCB, 0x71, 0xA7, 0x38, 0x59, 0x51, 0x21, 0x98, 0xD0, 0xAF, 0xE4, 0x20, 0xD8, 0x42, 0x86,
-    0xA8, 0x93, 0x12, 0x6A, 0x87, 0xD8, 0x4B, 0x3C, 0x70, 0xC7, 0xBC, 0x42, 0x25, 0x22, 0x70, 0x34,
-    0x2A, 0xC2, 0x1A, 0x8F, 0x1B, 0x3C, 0x0E, 0xD8, 0xA6, 0xDC, 0x0E, 0x6D, 0x26, 0xC8, 0x7D, 0x7A,
-    0x2D, 0x95, 0x0D, 0xA4, 0x2E, 0x60, 0x42, 0xD5, 0x30, 0x21, 0x5A, 0xCD, 0x63, 0xEF, 0x43, 0xD9,
-    0x88, 0x8B, 0x3D, 0x5E, 0xA7, 0xA3, 0x0D, 0xA8, 0xA8, 0x7E, 0x4E, 0x68, 0x28, 0xAF, 0x5F, 0x0D,
-    0xCC, 0xC2, 0xD0, 0x28, 0xA6, 0xDD, 0xB7, 0x5C, 0xD0, 0x67, 0x64, 0xF1, 0x9E, 0x16, 0x41, 0xCA,
-    0x3A, 0xC6, 0x76, 0x93, 0x4C, 0x96, 0xBA, 0xA0, 0x09, 0x81, 0xB9, 0x9D, 0xBC, 0x12, 0x81, 0x73,
-    0xE1, 0x46, 0x83, 0x88, 0x64, 0xA6, 0xCC, 0x9F, 0x70, 0x9F, 0x41, 0x7A, 0xB6, 0xF2, 0x6A, 0xA7,
-    0x97, 0x36, 0x62, 0xD1, 0x0B, 0x5E, 0x2B, 0x8D, 0x26, 0x22, 0x8C, 0x7E, 0x23, 0x8D, 0xE6, 0xDB,
-    0xF6, 0xF0, 0xF9, 0x74, 0xC8, 0xE8, 0x97, 0x36, 0xAA, 0x43, 0x42, 0x5F, 0x9A, 0x0B, 0xE5, 0xC9,
-    0x4A, 0xD2, 0x82, 0xAA, 0xF5, 0xE9, 0x86, 0xB1, 0x5C, 0x44, 0x69, 0x93, 0x22, 0x2C, 0xE3, 0xA9,
-    0xD7, 0x88, 0xBB, 0xD2, 0x0B, 0x6F, 0x00, 0xBA, 0xC3, 0x8D, 0x76, 0xE8, 0xFF, 0x13, 0xE9, 0x7F,
-    0x9A, 0xCB, 0xC2, 0x94, 0xFE, 0x1B, 0xE9, 0xBF, 0x47, 0xFF, 0x99, 0x87, 0xE0, 0x6F, 0x72, 0xA9,
-    0x91, 0xFE, 0x7B, 0xF4, 0xEF, 0xAC, 0x5B, 0xC0, 0xEF, 0xCF, 0xCD, 0xF4, 0xEF, 0x77, 0x24, 0x54,
-    0xF5, 0x6E, 0xBF, 0xE6, 0x43, 0x5A, 0xEB, 0x32, 0x9F, 0x49, 0x11, 0x17, 0x61, 0xC1, 0x68, 0x01,
-    0x10, 0x64, 0x28, 0x6B, 0x50, 0xD8, 0x97, 0xA4, 0x8F, 0x76, 0xF2, 0x74, 0xE9, 0x9F, 0xB9, 0x59,
-    0x6F, 0x5B, 0xD9, 0x81, 0xD4, 0xC1, 0x73, 0x09, 0x86, 0x28, 0x9D, 0x4C, 0xE7, 0x21, 0x91, 0x98,
-    0x23, 0x0F, 0xF6, 0x1F, 0x0C, 0x58, 0x0B, 0xDF, 0x6F, 0x62, 0x6F, 0xFA, 0xA6, 0x83, 0xCE, 0x4E,
-    0xC9, 0xAB, 0xD3, 0xD6, 0x2D, 0x68, 0xC4, 0x0C, 0x54, 0xB2, 0x20, 0xA6, 0xBB, 0x31, 0x90, 0x5F,
-    0x2D, 0xFF, 0xD7, 0xB4, 0xEB, 0xC2, 0x2B, 0xD3, 0xA6, 0x8B, 0xC2, 0xBF, 0x94, 0xDD, 0x81, 0x10,
-    0xE9, 0x91, 0x87, 0x3F, 0x3C, 0x24, 0x11, 0xCB, 0xA9, 0x86, 0x76, 0x10, 0x3D, 0x68, 0xDF, 0x97,
-    0x1F, 0x8E, 0xE8, 0x7B, 0x48, 0xC2, 0xBE, 0xE4, 0xE8, 0xC6, 0xC7, 0xB7, 0xEB, 0xBE, 0xFB, 0xC1,
-    0x3D, 0xA4, 0xC5, 0x62, 0x6A, 0x3A, 0x5E, 0xF4, 0x77, 0xB5, 0xBA, 0xEF, 0xA5, 0xDF, 0xC9, 0x25,
-    0x51, 0x39, 0x4E, 0x2F, 0x8B, 0x8E, 0x0E, 0x23, 0x62, 0xAF, 0xF4, 0x8F, 0x34, 0xEE, 0x02, 0x06,
-    0x75, 0x4E, 0xDE, 0xAB, 0x2D, 0x38, 0xE1, 0x4C, 0xAC, 0x45, 0xF4, 0x84, 0xD7, 0x68, 0x95, 0xEE,
-    0xF5, 0x7F, 0xBF, 0xEA, 0x6A, 0x25, 0xF8, 0xD6, 0x94, 0xD2, 0x8D, 0x38, 0xEE, 0x49, 0xAB, 0x7E,
-    0xD6, 0xDE, 0xEF, 0x29, 0xA5, 0xDE, 0xC8, 0xC6, 0x12, 0x0A, 0x67, 0xCE, 0x59, 0x98, 0xCE, 0x6A,
-    0x28, 0x9E, 0x59, 0x88, 0xB9, 0xF8, 0xAC, 0xCC, 0x40, 0xF0, 0xC3, 0xDF, 0x04, 0xFC, 0xD1, 0xBA,
-    0xE1, 0x29, 0x5C, 0xE3, 0x53, 0x48, 0x85, 0x6E, 0xDE, 0x68, 0x70, 0x8A, 0xB4, 0xD4, 0x66, 0x69,
-    0x70, 0x2A, 0x8F, 0xC8, 0xA9, 0x5C, 0xD0, 0xA7, 0xA0, 0xF3, 0x37, 0x2B, 0x51, 0x2A, 0x5A, 0x43,
-    0x55, 0x6F, 0xC2, 0x4D, 0x93, 0x53, 0xBF, 0xC6, 0x69, 0x52, 0xA0, 0x38, 0xA9, 0xF7, 0xE4, 0x34,
-    0xA8, 0x13, 0x39, 0x4D, 0x2E, 0x6D, 0x82, 0x81, 0x38, 0x0D, 0x36, 0xE1, 0x6A, 0x27, 0x70, 0xCC,
-    0x1D, 0x83, 0xD3, 0xC0, 0x30, 0x2D, 0x89, 0x53, 0x20, 0x07, 0x98, 0x3D, 0xA6, 0x4A, 0x01, 0x2C,
-    0xE0, 0xE9, 0x38, 0x63, 0x05, 0xC9, 0xB6, 0xEB, 0x3C, 0x51, 0xE1, 0xFB, 0xC6, 0xA4, 0x6D, 0x6E,
-    0xBA, 0x70, 0xE3, 0xEA, 0x4A, 0x25, 0x34, 0xEB, 0x33, 0xE2, 0xED, 0xB7, 0x06, 0xC1, 0x5A, 0xB8,
-    0x37, 0x70, 0x6C, 0xAE, 0xC8, 0xC3, 0x28, 0xE9, 0x11, 0x11, 0x7F, 0x88, 0x93, 0x02, 0xE6, 0xCA,
-    0xBB, 0xD1, 0x91, 0x23, 0x15, 0x39, 0x02, 0xFB, 0xC5, 0xB0, 0xC1, 0xE6, 0x06, 0xB2, 0x8D, 0xA7,
-    0xE4, 0x0E, 0x7F, 0xF3, 0x6F, 0x30, 0x4C, 0xA7, 0x84, 0xDB, 0xC2, 0x11, 0xB9, 0xA0, 0x4F, 0x89,
-    0xC1, 0x94, 0x53, 0xB9, 0x20, 0x63, 0xD7, 0xA9, 0xB0, 0x41, 0xB4, 0xAE, 0x9C, 0x86, 0x25, 0x38,
-    0xA2, 0x53, 0x39, 0xF5, 0x5A, 0x9C, 0x86, 0x25, 0xD8, 0x90, 0x1F, 0xD9, 0x84, 0x79, 0xC3, 0x69,
-    0xF4, 0xD9, 0x26, 0x23, 0x40, 0x88, 0x12, 0x90, 0x23, 0x11, 0x39, 0x92, 0x6F, 0x32, 0xB8, 0xAE,
-    0x6D, 0x26, 0x62, 0xFE, 0xEF, 0xD7, 0xDB, 0xFE, 0x34, 0xE7, 0x3D, 0x02, 0x63, 0x68, 0x52, 0xAC,
-    0xC9, 0x73, 0x76, 0x9F, 0x49, 0x73, 0x51, 0x9C, 0x6C, 0x98, 0x22, 0x64, 0x25, 0x68, 0x81, 0x91,
-    0x26, 0x08, 0xB2, 0xC1, 0xC4, 0xFC, 0x04, 0x69, 0x4E, 0x5B, 0x46, 0xE0, 0x57, 0x88, 0x23, 0xC4,
-    0x1B, 0x63, 0xE2, 0x60, 0xA8, 0x23, 0x58, 0x4A, 0xF7, 0xBC, 0x54, 0xEE, 0x63, 0x2E, 0x01, 0x78,
-    0xB2, 0x13, 0x4B, 0xEC, 0x33, 0x97, 0xD0, 0x0D, 0xD1, 0xB4, 0xED, 0xF4, 0xC6, 0xAE, 0x32, 0xDC,
-    0x4E, 0xB7, 0x4E, 0x67, 0x29, 0xE3, 0x21, 0x18, 0x9A, 0x6E, 0x47, 0xCF, 0x4A, 0x90, 0x10, 0x1D,
-    0x29, 0x73, 0x93, 0x5D, 0x08, 0xAF, 0x88, 0xCF, 0x91, 0x26, 0xFD, 0x44, 0xD0, 0xA3, 0xFC, 0xCF,
-    0x53, 0x40, 0x80, 0x1E, 0xEB, 0xC9, 0x6D, 0x98, 0x9A, 0xAE, 0xF0, 0x50, 0x5C, 0x60, 0xC2, 0x72,
-    0xCC, 0xA7, 0x48, 0x6F, 0xA2, 0x1E, 0xF1, 0xF2, 0xFD, 0x57, 0x4C, 0xC2, 0x15, 0xD3, 0x6D, 0xAF,
-    0x98, 0x84, 0x2B, 0xA6, 0xDB, 0x5E, 0x31, 0x49, 0x26, 0x53, 0x24, 0x6A, 0x0B, 0x2B, 0xA6, 0xE2,
-    0x6C, 0x65, 0x1A, 0x91, 0x16, 0x9C, 0x06, 0x15, 0x67, 0xEB, 0x34, 0x66, 0xAB, 0xE3, 0x6C, 0xDD,
-    0xBC, 0xD7, 0x6C, 0xE9, 0x19, 0x77, 0xF4, 0xC8, 0x97, 0x21, 0xCE, 0x09, 0xEC, 0x1D, 0x32, 0x50,
-    0x47, 0x3B, 0x1E, 0xF6, 0x77, 0x68, 0x14, 0x6D, 0x7A, 0x44, 0xA4, 0xEA, 0x27, 0xBD, 0x58, 0x5A,
-    0xB5, 0xE3, 0xC4, 0x06, 0xA4, 0x0A, 0x59, 0xE0, 0x70, 0x94, 0x7A, 0x6B, 0x50, 0x86, 0x54, 0x3B,
-    0x8A, 0x0D, 0x58, 0xBD, 0x80, 0xD5, 0x71, 0x67, 0xB1, 0x2B, 0x2B, 0x6D, 0x60, 0x15, 0x6B, 0x46,
-    0x81, 0x84, 0xD9, 0x02, 0xD0, 0xA3, 0x16, 0x15, 0x29, 0x22, 0x91, 0x88, 0xC8, 0x86, 0xAC, 0x54,
-    0x50, 0x3D, 0x6D, 0x41, 0x7C, 0x09, 0x03, 0xF6, 0xBF, 0xE1, 0x62, 0xEB, 0x6D, 0xC9, 0x12, 0xD7,
-    0x60, 0x70, 0x9B, 0x05, 0x37, 0xBD, 0x0D, 0x0C, 0xDB, 0x92, 0x9B, 0xB9, 0x2F, 0xBC, 0x8E, 0x5F,
-    0xF4, 0x14, 0xB1, 0xE4, 0x28, 0x9B, 0xFA, 0x80, 0x81, 0xF4, 0x12, 0x7D, 0x04, 0xB5, 0x0F, 0x17,
-    0xA6, 0x81, 0x8F, 0x22, 0x9D, 0x07, 0xE6, 0x8B, 0xBC, 0x25, 0x55, 0x0D, 0x2D, 0x5E, 0x39, 0x86,
-    0xC5, 0x59, 0xFA, 0xCA, 0x14, 0x3E, 0x6A, 0x5F, 0xE7, 0xF2, 0xF8, 0x4B, 0xCC, 0xBD, 0xF5, 0x1C,
-    0x43, 0x1A, 0xF4, 0xAF, 0x9A, 0x54, 0xE4, 0xC8, 0x50, 0x4E, 0x51, 0x96, 0x82, 0xA0, 0xA3, 0xB7,
-    0x89, 0x1A, 0x9C, 0x4F, 0xA5, 0xAD, 0x04, 0x40, 0x1A, 0xC5, 0x34, 0xDE, 0x6D, 0x5C, 0xFA, 0x12,
-    0x97, 0x60, 0x73, 0x5B, 0xCA, 0x72, 0x0E, 0x6B, 0xD1, 0xC3, 0x5B, 0x30, 0x67, 0x73, 0xF1, 0xF4,
-    0xE0, 0x67, 0x30, 0x20, 0x4E, 0xDD, 0xE2, 0x65, 0xEA, 0x7F, 0x58, 0x1B, 0x09, 0xB0, 0x1D, 0x9F,
-    0xCD, 0x6D, 0x99, 0x08, 0x87, 0x6B, 0xD1, 0xDC, 0xFE, 0x9D, 0xE9, 0x08, 0x27, 0x47, 0xAE, 0xD7,
-    0x67, 0xF9, 0x95, 0x0D, 0xA1, 0x07, 0xBD, 0x0C, 0xAA, 0xB0, 0x23, 0x66, 0xF8, 0xDC, 0x38, 0x96,
-    0x15, 0x0C, 0x1C, 0xB4, 0x74, 0x82, 0xF5, 0x49, 0x30, 0x3D, 0xFC, 0x92, 0xCC, 0xFB, 0x36, 0xAE,
-    0x2E, 0xB0, 0x3B, 0xF9, 0x94, 0x15, 0x51, 0x9F, 0xD9, 0x5A, 0x47, 0xDB, 0x14, 0xEB, 0xC1, 0x7A,
-    0xF6, 0x91, 0xA7, 0x76, 0x4A, 0x83, 0x0E, 0x9D, 0xA3, 0x26, 0xCC, 0x0C, 0x25, 0x22, 0xB0, 0x11,
-    0xFD, 0x18, 0xF8, 0x76, 0xA6, 0xEA, 0x05, 0xE5, 0x17, 0x88, 0x68, 0xA0, 0x30, 0x16, 0x81, 0x31,
-    0x39, 0x64, 0xF3, 0x25, 0x0B, 0x13, 0x66, 0xC5, 0x4B, 0x0C, 0xA6, 0x56, 0xB9, 0xC8, 0xB7, 0xE8,
-    0xCC, 0xB0, 0x92, 0x69, 0x0C, 0xFF, 0xDA, 0xDA, 0x44, 0xA7, 0x4A, 0xB0, 0x8A, 0x51, 0x4B, 0xCA,
-    0x54, 0x29, 0xEA, 0xA5, 0x84, 0xE9, 0x28, 0x15, 0xBB, 0x28, 0x97, 0xBE, 0x41, 0x31, 0xE3, 0x25,
-    0xC8, 0x9B, 0x2C, 0x2C, 0xAF, 0x81, 0x87, 0x51, 0x44, 0x5B, 0x27, 0x5A, 0xE4, 0x6C, 0xE0, 0xA2,
-    0x42, 0xC2, 0x18, 0xB1, 0x7A, 0xFE, 0xAD, 0x35, 0x42, 0x1F, 0x43, 0x0B, 0x65, 0x33, 0x16, 0x09,
-    0x6B, 0x52, 0x69, 0x1E, 0x4A, 0x9A, 0xAA, 0x63, 0xCE, 0x5D, 0x8B, 0xED, 0x08, 0x94, 0xA6, 0xCA,
-    0x66, 0x80, 0x90, 0x41, 0xD0, 0x15, 0x00, 0x81, 0x80, 0x01, 0x16, 0x8A, 0x16, 0x4C, 0xCC, 0x37,
-    0xAC, 0x02, 0xCB, 0x19, 0x02, 0x8D, 0x98, 0x48, 0xF5, 0x98, 0x95, 0x60, 0x96, 0xE5, 0x1E, 0xAC,
-    0xB6, 0x5F, 0x84, 0x9B, 0x9C, 0x9C, 0x86, 0x6B, 0xA1, 0xB3, 0x4D, 0xB1, 0xA2, 0x0C, 0x8E, 0x1C,
-    0x6A, 0xF1, 0x60, 0x69, 0x63, 0xA0, 0x2E, 0x14, 0x19, 0xA1, 0xAA, 0xAC, 0x52, 0xB6, 0x1C, 0x07,
-    0x7C, 0xCF, 0x86, 0x8C, 0x31, 0x52, 0x17, 0xE2, 0x55, 0x19, 0x0F, 0x8E, 0xAB, 0x38, 0xF0, 0xC9,
-    0xCB, 0xAD, 0x72, 0x6B, 0x59, 0xD5, 0x61, 0x7A, 0x01, 0xD2, 0x34, 0xB2, 0x1D, 0xC9, 0x0E, 0x07,
-    0x8F, 0xC5, 0x32, 0x2E, 0x57, 0x44, 0x73, 0x0A, 0x1F, 0x0E, 0xBC, 0x41, 0x35, 0x82, 0xCA, 0xA1,
-    0x8E, 0xC8, 0x71, 0x8A, 0xB9, 0xE5, 0x38, 0xC4, 0x1C, 0x97, 0x6E, 0xE1, 0xD2, 0x27, 0x98, 0x17,
-    0xD4, 0x73, 0xB6, 0x72, 0x6B, 0x08, 0xA5, 0x29, 0x3E, 0x37, 0xE2, 0xE5, 0xDA, 0x16, 0x06, 0x96,
-    0x3B, 0xEA, 0xC9, 0x96, 0x19, 0x8A, 0x9E, 0xDA, 0x88, 0xB4, 0xC9, 0x62, 0xBE, 0xF5, 0xAE, 0x08,
-    0x73, 0x6E, 0x51, 0x04, 0xF3, 0x3A, 0xC6, 0xAA, 0xC7, 0xB1, 0xD4, 0x2D, 0xB1, 0x01, 0x89, 0xF9,
-    0x9A, 0xC0, 0x31, 0x4E, 0x31, 0xC4, 0x2A, 0x50, 0xA2, 0xFC, 0xAF, 0x2D, 0xEB, 0xC7, 0xCD, 0x65,
-    0x6A, 0x5B, 0x63, 0xF8, 0xF5, 0xD5, 0xC9, 0xF1, 0x5C, 0xCD, 0xC2, 0x19, 0xEE, 0x10, 0x6B, 0x09,
-    0x2A, 0x8B, 0x4E, 0xE6, 0x1B, 0xD7, 0xE9, 0x42, 0xDF, 0x98, 0xD7, 0xB8, 0xB0, 0x4A, 0x2F, 0x67,
-    0xB6, 0xE1, 0xD6, 0xBB, 0x60, 0xF3, 0x48, 0x39, 0xF5, 0x1A, 0x24, 0xDC, 0xB2, 0x9B, 0x6F, 0x4B,
-    0xB6, 0xB2, 0xC3, 0xB1, 0xE9, 0xFA, 0x46, 0xB4, 0x89, 0x2C, 0x8C, 0xD7, 0xFA, 0xF8, 0xFA, 0x4A,
-    0x29, 0xDA, 0x4E, 0xE7, 0x42, 0x39, 0xF2, 0x37, 0xAD, 0x2D, 0x7F, 0x13, 0xD4, 0xCC, 0xBC, 0x05,
-    0x66, 0x17, 0x3C, 0xF6, 0xC7, 0x77, 0xB4, 0xDB, 0xCD, 0xBD, 0xDF, 0x5A, 0x5F, 0x3F, 0xDF, 0x0F,
-    0x90, 0x7D, 0xB8, 0x8F, 0x55, 0x67, 0x8D, 0xCD, 0x31, 0x31, 0x6D, 0x86, 0x76, 0xB1, 0xDC, 0x10,
-    0x9E, 0x90, 0x35, 0x71, 0x20, 0xE8, 0xA5, 0xDF, 0xAD, 0x13, 0x8D, 0x90, 0xDB, 0x04, 0x50, 0x0F,
-    0xB1, 0xC8, 0x6D, 0x8E, 0xE9, 0x38, 0xAE, 0xE6, 0x4A, 0x73, 0x51, 0x53, 0x68, 0xE3, 0x63, 0xF9,
-    0x68, 0xB6, 0x59, 0x47, 0xB1, 0x98, 0x74, 0xD6, 0xE6, 0xF3, 0xD4, 0x6A, 0x73, 0xA6, 0xEC, 0xC4,
-    0x23, 0x32, 0x88, 0x77, 0x24, 0xC8, 0xB7, 0x84, 0xE5, 0x78, 0x08, 0x2A, 0x1C, 0x66, 0x1F, 0xB9,
-    0xB6, 0x70, 0x8B, 0x23, 0x6A, 0x13, 0xFA, 0x4E, 0x43, 0x48, 0x35, 0x58, 0xA7, 0x51, 0xA2, 0xA8,
-    0x6D, 0xD9, 0x9C, 0xD7, 0x20, 0x9E, 0xD2, 0xDA, 0x40, 0x0D, 0x62, 0xCD, 0xE9, 0x42, 0xCB, 0x6C,
-    0xD4, 0x6B, 0x19, 0xDB, 0x51, 0xCE, 0x79, 0xC4, 0x09, 0x02, 0xC6, 0x1C, 0x13, 0x46, 0x50, 0x06,
-    0xD1, 0x9A, 0xB4, 0x81, 0x69, 0x93, 0xBE, 0x35, 0xE7, 0x51, 0xDC, 0x29, 0x78, 0x22, 0xC5, 0x34,
-    0xF6, 0xFC, 0x7F, 0xDF, 0x30, 0xF4, 0x5E, 0x19, 0xDD, 0x4E, 0xF8, 0xDC, 0x8D, 0xB8, 0x89, 0xAE,
-    0x11, 0xC1, 0x33, 0x73, 0x8C, 0x56, 0x35, 0x1D, 0x3C, 0x5A, 0xE4, 0x37, 0x2B, 0xD3, 0xC8, 0x98,
-    0x93, 0x0E, 0x32, 0x00, 0xA8, 0x6A, 0x38, 0x99, 0xA2, 0x79, 0x1E, 0x24, 0x70, 0x3D, 0x06, 0x7D,
-    0xE8, 0x07, 0x06, 0x53, 0x22, 0x63, 0xF9, 0xF2, 0xCF, 0xD6, 0x0B, 0x63, 0x71, 0x8A, 0x57, 0xF3,
-    0xF6, 0x70, 0x5C, 0xF7, 0x14, 0x31, 0xC6, 0x91, 0x17, 0x8B, 0x44, 0xF7, 0x08, 0x0B, 0x7F, 0xA2,
-    0x96, 0xFF, 0xD0, 0xB8, 0x4D, 0x50, 0x5E, 0xA4, 0x61, 0x30, 0x15, 0xC3, 0x4A, 0x63, 0x34, 0xF2,
-    0xE0, 0x91, 0x2A, 0x6E, 0x93, 0xD0, 0x9C, 0xBE, 0xD9, 0xBF, 0x9D, 0x74, 0x2C, 0x0A, 0x4A, 0xA6,
-    0xBC, 0x23, 0xB1, 0x25, 0xF1, 0xC8, 0x1D, 0xD5, 0xF7, 0x7D, 0x9B, 0xD5, 0x96, 0x0C, 0xCE, 0xDF,
-    0xF6, 0x5E, 0x18, 0x2C, 0xA3, 0x63, 0x3B, 0x6D, 0xB4, 0xB1, 0xBB, 0x39, 0xDA, 0xB0, 0x51, 0xCF,
-    0xBE, 0xDC, 0x0D, 0x08, 0xCF, 0xA5, 0x37, 0x32, 0xDB, 0xC3, 0x80, 0x15, 0x67, 0x90, 0xA6, 0x86,
-    0x4D, 0x0F, 0xE9, 0xBF, 0xDB, 0x03, 0x37, 0x14, 0xA5, 0x03, 0xCB, 0x2D, 0x60, 0x1A, 0x91, 0x63,
-    0x3E, 0x64, 0xD9, 0x9C, 0xEE, 0x45, 0xE9, 0xFE, 0x92, 0x59, 0xCF, 0xAB, 0x04, 0x55, 0xCD, 0x28,
-    0xF6, 0xB5, 0x55, 0x3D, 0xEA, 0xD0, 0xEA, 0x4C, 0xBB, 0x39, 0x43, 0xCC, 0x19, 0x11, 0xA0, 0xA5,
-    0x6D, 0x74, 0x23, 0xDA, 0xE1, 0x1A, 0xB4, 0x43, 0x7C, 0xFD, 0x1F, 0x2A, 0x19, 0xDA, 0xFE, 0x64,
-    0xC8, 0x5A, 0xE3, 0x29, 0x94, 0x03, 0x31, 0x0B, 0x6D, 0xF3, 0xD2, 0xF0, 0x6E, 0x6A, 0x96, 0x8D,
-    0x5A, 0x35, 0x81, 0xA1, 0xB4, 0x3F, 0x06, 0xB0, 0x38, 0x7B, 0xB2, 0x96, 0x9E, 0xCB, 0x67, 0xA1,
-    0x0C, 0x91, 0x3A, 0x55, 0xE7, 0x87, 0x4D, 0x13, 0x88, 0x0B, 0x13, 0x24, 0x69, 0x19, 0x2F, 0xAA,
-    0xE6, 0xC5, 0xEC, 0x2C, 0xED, 0x19, 0xF6, 0x40, 0xFF, 0xC5, 0xB5, 0xCD, 0xB6, 0x77, 0x9A, 0xBB,
-    0x61, 0x42, 0x71, 0x1F, 0x96, 0xC6, 0x39, 0xDC, 0x35, 0xF6, 0x7C, 0xA7, 0x43, 0x5F, 0xAE, 0x06,
-    0x17, 0x9C, 0x5E, 0x2C, 0xBD, 0x76, 0xC0, 0x1E, 0xAA, 0x18, 0x3D, 0xEC, 0xD2, 0x48, 0xAE, 0xED,
-    0xD2, 0xF0, 0x7F, 0x38, 0xB5, 0x6E, 0x37, 0xA8, 0x5B, 0x6E, 0x87, 0x98, 0x09, 0x5E, 0xEF, 0x49,
-    0x3B, 0x2D, 0x73, 0x09, 0xCE, 0x39, 0x51, 0x48, 0x28, 0x88, 0x57, 0xC9, 0x91, 0xDA, 0xE2, 0x69,
-    0x1F, 0xA8, 0x06, 0x55, 0xF1, 0xEA, 0xF8, 0x9E, 0x59, 0x5C, 0xFB, 0x52, 0xE7, 0x1C, 0xF6, 0x4C,
-    0xB9, 0x8D, 0x74, 0x04, 0x34, 0x84, 0x9D, 0x56, 0xF0, 0x65, 0x46, 0xC3, 0xB9, 0x4B, 0xD2, 0xC3,
-    0x32, 0x8A, 0x15, 0x1C, 0xFE, 0xCF, 0xB0, 0x82, 0xDC, 0xDA, 0x0D, 0x3D, 0x2B, 0x8E, 0x21, 0x48,
-    0x98, 0xAB, 0xD8, 0xDE, 0xDD, 0x8B, 0x30, 0x16, 0x36, 0x43, 0x60, 0x37, 0x89, 0x38, 0xFD, 0x6C,
-    0x5F, 0x97, 0x33, 0x7B, 0x28, 0xA1, 0x1B, 0x82, 0x49, 0x79, 0x8E, 0x05, 0xA2, 0x82, 0x42, 0x3D,
-    0xE2, 0x3C, 0x61, 0xCE, 0x0D, 0xE1, 0xCF, 0xC9, 0x6F, 0x26, 0x2C, 0x8A, 0xE2, 0xEC, 0x05, 0x16,
-    0x01, 0xDE, 0xFD, 0x03, 0x33, 0x2D, 0x62, 0xC5, 0xB6, 0x8E, 0x3B, 0xC2, 0x0F, 0x38, 0x10, 0xDF,
-    0x30, 0x96, 0x23, 0xFA, 0x7B, 0xB9, 0xA3, 0x02, 0x46, 0xC3, 0x0D, 0x64, 0x09, 0x2B, 0x9B, 0x7B,
-    0x1D, 0xA2, 0x02, 0x29, 0xA1, 0x96, 0x5B, 0x14, 0x36, 0x88, 0xE7, 0x40, 0x68, 0x52, 0xDE, 0x61,
-    0xC3, 0xA2, 0x19, 0x57, 0xFF, 0x6E, 0x6C, 0x31, 0x3C, 0x43, 0x19, 0xDF, 0x01, 0x57, 0xED, 0x45,
-    0xB5, 0xBC, 0x3A, 0x48, 0x42, 0x68, 0xF7, 0xA5, 0x3D, 0xA7, 0x22, 0x61, 0xAD, 0x5B, 0x0A, 0x26,
-    0x38, 0xC0, 0x6B, 0xAE, 0x05, 0xBC, 0x2C, 0x06, 0xCB, 0x1C, 0x7D, 0xF5, 0xB8, 0x95, 0xF8, 0x78,
-    0xF8, 0xEA, 0x81, 0x4F, 0x9C, 0xD9, 0x02, 0x30, 0x67, 0xB1, 0xDD, 0xB3, 0x19, 0x9C, 0xB3, 0xA5,
-    0xC7, 0x96, 0x37, 0x8F, 0x8E, 0x89, 0xB1, 0xF8, 0x93, 0x60, 0xF9, 0xF1, 0x38, 0xF3, 0x60, 0x02,
-    0x24, 0x0B, 0x46, 0xA0, 0xF7, 0x07, 0xF9, 0x17, 0xE7, 0xEE, 0x2F, 0x40, 0x07, 0xB9, 0x64, 0x57,
-    0xA5, 0x29, 0xF1, 0xC0, 0x7D, 0xB3, 0x75, 0x41, 0xF0, 0x2F, 0xD6, 0x64, 0x85, 0x00, 0xEF, 0x0E,
-    0xAF, 0x1B, 0x1B, 0x28, 0x29, 0x43, 0xAC, 0x87, 0x73, 0xE8, 0xBB, 0xE9, 0xFC, 0x89, 0x5E, 0x64,
-    0x40, 0x23, 0xD7, 0x63, 0xF5, 0x5A, 0xF4, 0x17, 0x26, 0x5E, 0x45, 0x5A, 0xA3, 0xDA, 0x33, 0x5F,
-    0xE4, 0x35, 0xC6, 0x56, 0x8F, 0xC1, 0x8B, 0x09, 0x2B, 0xCF, 0x96, 0xE1, 0xF9, 0xD7, 0x32, 0x9E,
-    0x15, 0x75, 0x58, 0x34, 0x89, 0x57, 0x88, 0x5F, 0xB0, 0x40, 0xB8, 0xE8, 0x1E, 0xFF, 0x26, 0x0C,
-    0xDD, 0x23, 0x9D, 0xE4, 0x80, 0x8D, 0x37, 0xC5, 0x55, 0x31, 0xA8, 0x1A, 0xA8, 0xCC, 0xD5, 0x3C,
-    0xF7, 0x51, 0xC2, 0x86, 0x5A, 0x36, 0xBB, 0x82, 0x18, 0x2F, 0x09, 0xE1, 0x17, 0x7B, 0x0C, 0xF8,
-    0x6C, 0x57, 0x86, 0x8C, 0xB1, 0xAD, 0x5D, 0x61, 0xD5, 0xDC, 0x45, 0xC4, 0x28, 0x58, 0x1E, 0xE7,
-    0x21, 0xA1, 0xE8, 0x74, 0xD0, 0x45, 0xC6, 0x43, 0x3C, 0x24, 0x4D, 0xFA, 0x77, 0xB8, 0x73, 0x54,
-    0x14, 0xBD, 0x8D, 0x47, 0xD0, 0xF6, 0x23, 0xE0, 0xC3, 0x58, 0x0F, 0xE2, 0x58, 0x0B, 0xF1, 0xAB,
-    0xDD, 0x66, 0xD6, 0x8B, 0xCA, 0x97, 0x5B, 0x52, 0x01, 0xF2, 0xDC, 0x2D, 0x21, 0xF3, 0x59, 0x61,
-    0x11, 0x97, 0x77, 0x6C, 0x77, 0xDE, 0x8B, 0xC2, 0x56, 0xAA, 0x9F, 0xAA, 0x50, 0x79, 0x85, 0xBA,
-    0xF8, 0x6A, 0x6B, 0x03, 0x54, 0xDC, 0xDE, 0xEC, 0x3C, 0x45, 0x61, 0x63, 0x8E, 0x5A, 0x69, 0x86,
-    0xE0, 0x11, 0xA9, 0xF9, 0x11, 0xEC, 0x8C, 0x9F, 0xBD, 0x04, 0x83, 0xF3, 0x33, 0x35, 0xB8, 0x29,
-    0x1E, 0x2B, 0x03, 0x17, 0x72, 0x49, 0x8C, 0xFF, 0xEF, 0x9E, 0x04, 0xF2, 0x22, 0x24, 0xD0, 0x25,
-    0x53, 0x7B, 0xB8, 0xD4, 0xFA, 0x97, 0x70, 0x18, 0x0A, 0xB8, 0x33, 0xD3, 0xD0, 0xAC, 0xCB, 0xFA,
-    0x60, 0xF0, 0xC8, 0x46, 0x69, 0x6C, 0xD4, 0x60, 0x6D, 0x18, 0x4B, 0xF8, 0x8A, 0x20, 0x9F, 0x52,
-    0xE8, 0xFF, 0xA9, 0x53, 0xDA, 0x81, 0x84, 0x68, 0x31, 0xA9, 0x17, 0x43, 0x7F, 0xDE, 0x23, 0x33,
-    0x16, 0x27, 0x01, 0x4E, 0x8C, 0xA0, 0x8F, 0xE8, 0xEB, 0x8E, 0x05, 0xA4, 0x27, 0x6E, 0x57, 0xDA,
-    0xF4, 0x09, 0xCB, 0x82, 0xB9, 0xE5, 0xD0, 0x5D, 0xDB, 0xB7, 0x2A, 0x62, 0x01, 0x1C, 0x83, 0x62,
-    0x79, 0x75, 0x11, 0x1D, 0x1E, 0x46, 0x2D, 0xEB, 0x61, 0x78, 0x86, 0x4B, 0x8B, 0x7A, 0x05, 0x05,
-    0x28, 0xBB, 0x27, 0x9C, 0xF6, 0x22, 0xF7, 0x14, 0x62, 0x79, 0xB3, 0x34, 0xDA, 0xAF, 0x65, 0x76,
-    0x3D, 0xA0, 0x3D, 0x54, 0x0B, 0xDE, 0x7A, 0xB7, 0xC3, 0x22, 0xA6, 0x07, 0xDF, 0x0C, 0xFB, 0x6A,
-    0xD4, 0xBE, 0xD5, 0x37, 0x44, 0xE5, 0x23, 0xFA, 0xF7, 0x72, 0xCB, 0xC0, 0x9E, 0xD3, 0x08, 0x1C,
-    0x39, 0xEC, 0xA0, 0xD0, 0xEB, 0x99, 0xA7, 0xC6, 0xC9, 0xBD, 0xB4, 0x78, 0xC1, 0x9A, 0x09, 0x8B,
-    0x4D, 0xDE, 0x9C, 0xD5, 0x2E, 0xD3, 0x55, 0xB5, 0x9B, 0xF0, 0xDB, 0xD9, 0xEF, 0x04, 0x6C, 0x6F,
-    0xB8, 0xB7, 0xB8, 0x23, 0x42, 0x34, 0x55, 0x0B, 0x12, 0xE7, 0x26, 0x7A, 0xBF, 0x7A, 0xB8, 0x4B,
-    0x39, 0x62, 0x0D, 0x2D, 0x78, 0x54, 0xE5, 0xA9, 0x63, 0x0A, 0xAC, 0x65, 0x50, 0xD3, 0x5A, 0x26,
-    0x2D, 0xA5, 0xF1, 0x18, 0xD4, 0x60, 0xC0, 0xF5, 0xC2, 0x58, 0x1C, 0xC3, 0x2C, 0x52, 0x4C, 0x2C,
-    0x5F, 0xCF, 0x16, 0xEF, 0xDA, 0x58, 0x2A, 0xD9, 0x0E, 0x27, 0x1C, 0xD5, 0xAC, 0x62, 0x5E, 0x0D,
-    0xA2, 0x0A, 0xEC, 0x39, 0x75, 0xED, 0xC9, 0x81, 0xF9, 0xED, 0x70, 0x73, 0x7A, 0x60, 0x88, 0x00,
-    0x32, 0x54, 0x8C, 0xE2, 0x7A, 0x0D, 0x9C, 0x6F, 0x32, 0x1B, 0xC0, 0xF4, 0xCD, 0x10, 0x55, 0x88,
-    0x19, 0x22, 0x81, 0x67, 0x88, 0xDF, 0x10, 0xF0, 0xF0, 0x9B, 0x16, 0x15, 0x7E, 0x24, 0xA1, 0x52,
-    0xF1, 0x99, 0x42, 0xBE, 0x11, 0x48, 0xD2, 0x09, 0xF2, 0x6F, 0x59, 0x15, 0xA6, 0xED, 0x66, 0xD0,
-    0x28, 0x6B, 0xF1, 0xAB, 0x09, 0xAD, 0x7A, 0x8F, 0x69, 0x7C, 0xBF, 0xF2, 0x2A, 0xEC, 0x36, 0x92,
-    0x11, 0xC1, 0xB3, 0x8C, 0x51, 0x9A, 0x76, 0x51, 0xEE, 0x47, 0x3A, 0x41, 0x6E, 0x20, 0xC1, 0x6D,
-    0x58, 0x10, 0x9A, 0x7A, 0xF5, 0x29, 0x19, 0x3D, 0x62, 0x7A, 0x7F, 0xAB, 0x55, 0x80, 0x31, 0x45,
-    0x57, 0x0A, 0xFE, 0xEA, 0x83, 0x4A, 0x12, 0xFB, 0x52, 0x7D, 0x63, 0x5F, 0x00, 0xB0, 0xDC, 0xAE,
-    0x0B, 0x62, 0x39, 0x67, 0xC0, 0xD6, 0x36, 0x08, 0x38, 0x1D, 0x36, 0x23, 0xE4, 0x63, 0x22, 0xCE,
-    0xAA, 0xCB, 0x19, 0xE3, 0x5C, 0x63, 0xD3, 0xB4, 0xDA, 0x56, 0xD6, 0x47, 0xC5, 0x45, 0x6B, 0xA2,
-    0xA9, 0x1D, 0xD5, 0xFE, 0x3B, 0xF7, 0x9A, 0x28, 0x56, 0x38, 0xD9, 0xB9, 0xCD, 0x0B, 0x15, 0x9F,
-    0x6E, 0x50, 0x9D, 0xE6, 0xD5, 0xF2, 0x3C, 0x62, 0x35, 0xA8, 0x87, 0xD2, 0xDC, 0x8E, 0xEA, 0x7D,
-    0x8D, 0x31, 0xF7, 0x2A, 0x89, 0xB2, 0xB0, 0x08, 0x2A, 0xBF, 0x44, 0x59, 0x54, 0xA2, 0xDE, 0x93,
-    0x81, 0x67, 0x5E, 0x1D, 0x16, 0x18, 0x6E, 0xFC, 0x56, 0xE3, 0x57, 0xA8, 0x70, 0x8E, 0xD3, 0x04,
-    0x7C, 0xB9, 0x54, 0xB9, 0xB5, 0x10, 0xD0, 0x1D, 0x56, 0xD1, 0x99, 0xA9, 0x0A, 0x6E, 0x4C, 0x55,
-    0x0B, 0x7C, 0x76, 0x41, 0x85, 0x9F, 0x0A, 0x92, 0x47, 0x51, 0x59, 0x4D, 0x1D, 0x88, 0x41, 0x22,
-    0x1C, 0x9B, 0xD8, 0xC2, 0x2A, 0xBB, 0x4B, 0x99, 0x03, 0xE3, 0xB0, 0xEC, 0xA0, 0x72, 0xA8, 0x5C,
-    0x0E, 0xC8, 0x0E, 0x67, 0xC7, 0x60, 0x02, 0xA6, 0xE9, 0xC1, 0x93, 0xE4, 0x74, 0x3B, 0xEE, 0xA0,
-    0xED, 0x2C, 0x32, 0x14, 0xD2, 0x40, 0x5D, 0x81, 0x4F, 0x3D, 0x80, 0x70, 0x50, 0x31, 0x1C, 0x94,
-    0xB1, 0x9C, 0x17, 0xF2, 0xC1, 0x1C, 0x04, 0x7F, 0x89, 0x43, 0x88, 0xA1, 0xCC, 0x12, 0x06, 0xC3,
-    0xAD, 0x1C, 0x0A, 0x9A, 0x19, 0x18, 0x7A, 0xE8, 0x53, 0xE7, 0xFC, 0xB8, 0xEE, 0x42, 0xB4, 0x15,
-    0x23, 0x7B, 0x77, 0x51, 0x1C, 0x18, 0x19, 0xC0, 0x45, 0xB5, 0x18, 0x2D, 0xB1, 0x21, 0x6C, 0xCD,
-    0xFC, 0x42, 0x66, 0x7F, 0x64, 0x83, 0x83, 0x08, 0xA7, 0x32, 0x34, 0xFE, 0x0A, 0x47, 0x82, 0x1F,
-    0xE4, 0x48, 0x52, 0x97, 0x25, 0x6E, 0x2D, 0x9C, 0xD9, 0x8B, 0x58, 0xDD, 0x9A, 0xBF, 0xE3, 0x01,
-    0x67, 0x3A, 0x46, 0x48, 0x3F, 0xBC, 0x8C, 0x5F, 0xEA, 0x80, 0x4A, 0xF5, 0x37, 0x8A, 0xC1, 0x54,
-    0x3A, 0x66, 0x96, 0x7F, 0xEC, 0x66, 0x61, 0xE0, 0x66, 0x04, 0xDD, 0x4C, 0x64, 0x40, 0x60, 0xFE,
-    0x17, 0xF7, 0xF2, 0xA7, 0x59, 0x74, 0x69, 0x93, 0xF8, 0xCF, 0x80, 0xA9, 0x40, 0x78, 0x71, 0x91,
-    0x8F, 0xA7, 0xCE, 0x8E, 0x22, 0x0E, 0xBB, 0x3C, 0xC1, 0xB3, 0x3F, 0xD6, 0x63, 0x76, 0x84, 0x5B,
-    0x93, 0x85, 0x72, 0xC2, 0x73, 0xFC, 0x30, 0x07, 0xA8, 0x0E, 0x50, 0x78, 0x00, 0xFF, 0x22, 0xB7,
-    0x01, 0x39, 0x5B, 0x54, 0xDD, 0xCF, 0xF6, 0x86, 0xDF, 0x64, 0xBC, 0xDB, 0xCC, 0x76, 0xAB, 0x5B,
-    0x99, 0x7E, 0x34, 0xC6, 0x8F, 0x81, 0xBC, 0xF3, 0x63, 0x39, 0x8A, 0x19, 0x47, 0x9B, 0x8C, 0x8A,
-    0x68, 0xE1, 0x97, 0x29, 0xE0, 0xFC, 0x7C, 0x8C, 0xC3, 0x19, 0x1B, 0xF4, 0xB7, 0x0F, 0xCD, 0xF6,
-    0x61, 0xD2, 0x8B, 0xEA, 0xC6, 0xCB, 0x0B, 0x9B, 0xEE, 0xDC, 0x6D, 0xE7, 0x6A, 0xB6, 0x7D, 0x33,
-    0x9B, 0x7F, 0xAC, 0x5F, 0x78, 0xAC, 0x19, 0x1F, 0x43, 0x67, 0xB7, 0x71, 0xD8, 0x60, 0xED, 0x3E,
-    0xB7, 0x3C, 0xE0, 0x41, 0x63, 0x9B, 0x1C, 0x0B, 0x48, 0xE7, 0xA8, 0x44, 0x84, 0x02, 0xAF, 0x83,
-    0x93, 0xD7, 0x46, 0x25, 0x37, 0xFC, 0x96, 0x42, 0x6E, 0xA9, 0x9B, 0xFD, 0x3E, 0x40, 0x31, 0xFB,
-    0xC9, 0x00, 0x3A, 0x69, 0xB5, 0x9D, 0x63, 0x50, 0xA3, 0xD7, 0xD7, 0xD7, 0x72, 0x69, 0x23, 0x67,
-    0x82, 0xF7, 0xB9, 0x51, 0x0E, 0x48, 0x1F, 0xD3, 0x04, 0x07, 0x76, 0xCE, 0x2C, 0x76, 0xB0, 0xD7,
-    0x20, 0xF1, 0x33, 0x9B, 0x16, 0x19, 0x36, 0xA6, 0x2E, 0x0E, 0xF8, 0x81, 0xF9, 0x54, 0x3E, 0x08,
-    0x9F, 0x30, 0x05, 0x33, 0xF6, 0x14, 0xCA, 0x1D, 0x22, 0x4A, 0xE3, 0xCB, 0x4D, 0x77, 0x12, 0xF8,
-    0x44, 0xD9, 0xE2, 0x9C, 0x53, 0x87, 0x94, 0x5B, 0x8B, 0x99, 0xE1, 0x4A, 0x64, 0xB6, 0xD7, 0xC3,
-    0xC0, 0x11, 0xBD, 0x59, 0x2C, 0x15, 0xF9, 0xAE, 0xA5, 0xE6, 0x90, 0x72, 0xCE, 0x21, 0x96, 0xE6,
-    0xA1, 0x88, 0x8F, 0x51, 0xAA, 0xC6, 0xC6, 0xFC, 0xE6, 0xA8, 0x7C, 0xE2, 0x52, 0xF3, 0xC6, 0x6A,
-    0x64, 0x3E, 0x12, 0x0F, 0xBC, 0x3E, 0xA0, 0x11, 0x8B, 0x01, 0x14, 0x4B, 0x15, 0x7F, 0xDD, 0x00,
-    0x41, 0xBD, 0x87, 0x3D, 0x55, 0xFF, 0x0F, 0x9D, 0x56, 0x4F, 0x68, 0x1C, 0xD7, 0x19, 0xFF, 0xBD,
-    0x79, 0x2B, 0x4D, 0xE4, 0xA9, 0x35, 0x5B, 0x90, 0x8B, 0xEB, 0x6C, 0x34, 0x39, 0xF8, 0xE0, 0x0A,
-    0xCB, 0x43, 0xC1, 0x87, 0x1C, 0x66, 0x35, 0x93, 0x9A, 0x22, 0x68, 0x29, 0xD9, 0x43, 0x36, 0x3D,
-    0xA4, 0x60, 0x5D, 0x65, 0x28, 0xB2, 0xA9, 0x21, 0x5B, 0xBA, 0xDA, 0x99, 0xC4, 0x87, 0x5E, 0x4A,
-    0xAB, 0x42, 0x69, 0x0F, 0xB9, 0xA4, 0x90, 0x83, 0xB2, 0x14, 0xBC, 0x6D, 0x7D, 0x70, 0x89, 0x76,
-    0xE7, 0x29, 0xA2, 0xE8, 0xE0, 0x43, 0xC6, 0x2E, 0x89, 0x0F, 0xA5, 0x30, 0x44, 0x35, 0x09, 0xF8,
-    0xE0, 0x69, 0x3B, 0xA6, 0x43, 0x78, 0xB3, 0xAF, 0xDF, 0x9B, 0x5D, 0x45, 0x76, 0x94, 0x96, 0xD0,
-    0xF7, 0x67, 0xBE, 0x6F, 0xDF, 0xFB, 0xE6, 0xCD, 0xF7, 0xF7, 0xF7, 0xF6, 0x4A, 0x60, 0x67, 0x18,
-    0xC3, 0x4E, 0x20, 0x61, 0x0B, 0xB4, 0xD0, 0x47, 0x18, 0xF9, 0xC2, 0x15, 0x36, 0x75, 0x16, 0x00,
-    0x4B, 0x11, 0xCC, 0x31, 0x98, 0xCA, 0xE1, 0x5F, 0x16, 0x76, 0x12, 0xF2, 0x0C, 0x72, 0x01, 0x2C,
-    0x60, 0x5B, 0x58, 0xF3, 0x0B, 0xFE, 0x9E, 0x1A, 0x6F, 0xD8, 0xAB, 0x2A, 0xEF, 0x32, 0x15, 0x90,
-    0x34, 0x4E, 0xB5, 0x5F, 0x8E, 0xD5, 0x98, 0x06, 0x31, 0x57, 0xFA, 0xFD, 0x77, 0xD4, 0xB4, 0xD1,
-    0x16, 0x06, 0x98, 0xBF, 0x8D, 0x0B, 0xFE, 0x2B, 0xD2, 0x55, 0xB9, 0xA9, 0x12, 0x2C, 0xE0, 0x5C,
-    0xAC, 0x46, 0x0B, 0x35, 0xD4, 0x7D, 0xC8, 0x10, 0x92, 0x9E, 0xC4, 0x8F, 0x2E, 0xA9, 0x3F, 0x6F,
-    0x44, 0x3E, 0x8A, 0x8D, 0xF7, 0x0A, 0x2B, 0x5A, 0x04, 0x7B, 0x1B, 0x2A, 0x73, 0x5F, 0xDD, 0x13,
-    0x9E, 0xC7, 0xF7, 0x12, 0xCF, 0xB9, 0x19, 0xC5, 0x29, 0xEA, 0x60, 0xDB, 0x27, 0xDE, 0xF2, 0x5F,
-    0x97, 0x56, 0xE6, 0x07, 0xD2, 0x4A, 0x49, 0xDC, 0x14, 0x2B, 0xA8, 0x93, 0xC6, 0xDF, 0xC0, 0xEC,
-    0x1B, 0x85, 0x51, 0x58, 0xE9, 0x08, 0x7E, 0x1C, 0xD1, 0xBB, 0xE0, 0x12, 0x98, 0x01, 0xD6, 0x47,
-    0xBA, 0xAD, 0xAF, 0xCF, 0xBE, 0x99, 0x8E, 0x46, 0xD6, 0xC3, 0xE9, 0x63, 0x7D, 0x76, 0xEB, 0xCA,
-    0xB7, 0xB6, 0xA1, 0xCC, 0x1C, 0xA5, 0x99, 0x31, 0x3A, 0x8B, 0x15, 0x96, 0x60, 0x99, 0x25, 0x10,
-    0xD0, 0x4B, 0xE7, 0x80, 0x18, 0x20, 0xF5, 0x47, 0x18, 0x2C, 0x68, 0xF5, 0x7B, 0xBF, 0x3E, 0x52,
-    0x9F, 0xF5, 0x03, 0x5B, 0x65, 0xBE, 0x92, 0x9B, 0xD8, 0xBC, 0x85, 0xC5, 0x3A, 0x6A, 0x46, 0xB2,
-    0x69, 0x09, 0xE9, 0xDE, 0x28, 0xFC, 0xEF, 0x66, 0x6A, 0xA6, 0x65, 0xA7, 0x63, 0xE7, 0x1E, 0xFD,
-    0xCC, 0x7C, 0x33, 0xD9, 0x99, 0x09, 0x46, 0x56, 0x16, 0xF2, 0xDC, 0x7D, 0x5D, 0xDA, 0x62, 0xC8,
-    0xD3, 0x53, 0x16, 0xED, 0xDE, 0xA5, 0xDD, 0x7C, 0xB2, 0x7B, 0x25, 0xF0, 0x85, 0x93, 0x68, 0x1D,
-    0xD0, 0x43, 0x8D, 0xF5, 0xB9, 0x34, 0x73, 0x3B, 0xF1, 0x83, 0x4D, 0xB2, 0x16, 0x4D, 0x34, 0x97,
-    0x86, 0x61, 0xB9, 0x54, 0x6A, 0x0E, 0xE8, 0x52, 0xEF, 0x6D, 0x87, 0x65, 0xB8, 0xAD, 0x39, 0x8A,
-    0x52, 0xFF, 0xB7, 0x4A, 0xED, 0x6B, 0x37, 0x77, 0xC1, 0x32, 0x98, 0x02, 0xCE, 0x94, 0x35, 0x22,
-    0xAC, 0xC3, 0x17, 0x76, 0x6A, 0xE6, 0x5C, 0x5A, 0xD2, 0x96, 0xFC, 0xEF, 0x3A, 0x16, 0xCC, 0xBA,
-    0x73, 0x20, 0x32, 0xCF, 0x4A, 0x77, 0x18, 0xFD, 0xE2, 0x42, 0xF7, 0x57, 0x1F, 0x28, 0x15, 0x8F,
-    0xC9, 0x5A, 0x6A, 0x66, 0x32, 0x59, 0xD3, 0xFD, 0xFB, 0x1F, 0xE8, 0x15, 0xCD, 0x19, 0xD1, 0xA9,
-    0xF6, 0xAA, 0x2A, 0x7D, 0x25, 0xB0, 0xCD, 0x33, 0x5B, 0x50, 0xC4, 0x34, 0x09, 0xE3, 0x4F, 0xD5,
-    0x7E, 0xF1, 0xD4, 0x92, 0x1F, 0xC4, 0x85, 0x4A, 0xE3, 0x60, 0xCE, 0x3E, 0x28, 0xC6, 0x73, 0xF8,
-    0x5C, 0x8C, 0xFF, 0x4B, 0x4C, 0x4F, 0x6C, 0x49, 0xE7, 0x8D, 0x6C, 0xC5, 0x14, 0x75, 0xD2, 0xC8,
-    0x8C, 0xEC, 0x74, 0x56, 0x62, 0x85, 0xFA, 0x28, 0x96, 0x71, 0x82, 0x80, 0xA7, 0xB6, 0x70, 0xAA,
-    0x05, 0x1F, 0x2E, 0x59, 0xF2, 0x59, 0x48, 0xC9, 0x02, 0x4B, 0xE9, 0xAC, 0x53, 0x0F, 0x05, 0x56,
-    0x76, 0xC0, 0xA7, 0x24, 0xA5, 0x8D, 0x73, 0x46, 0x74, 0xCE, 0xE3, 0xC2, 0x73, 0x2F, 0x3F, 0x2E,
-    0x6C, 0xA5, 0x32, 0xF6, 0xF6, 0x99, 0xE0, 0xA9, 0x14, 0x11, 0x4F, 0xA4, 0x88, 0xCE, 0x76, 0xAB,
-    0xFC, 0x82, 0x6C, 0x9F, 0xA4, 0x6E, 0xEF, 0x95, 0xFF, 0x15, 0x7B, 0xAA, 0x88, 0x5F, 0xAA, 0x64,
-    0xD1, 0x57, 0xF7, 0xFF, 0xBA, 0xAB, 0x64, 0x6E, 0xA8, 0x99, 0xE3, 0xF5, 0xD0, 0xFF, 0x0D, 0x79,
-    0xB2, 0x0C, 0xE9, 0x91, 0xE8, 0x28, 0x1C, 0x56, 0x47, 0x9B, 0x1A, 0xA6, 0xED, 0xC9, 0xB5, 0xAA,
-    0xC8, 0x72, 0xBE, 0xA7, 0xCA, 0x9E, 0xB3, 0xAA, 0xB2, 0x5B, 0xD3, 0x22, 0xFB, 0x7C, 0x61, 0xC5,
-    0x15, 0x37, 0x9E, 0x12, 0xFD, 0x19, 0x12, 0x80, 0x56, 0x52, 0xC2, 0x92, 0x08, 0x53, 0x53, 0xC1,
-    0x25, 0x93, 0x22, 0x34, 0x0E, 0xBF, 0xB2, 0x40, 0x93, 0x6C, 0x46, 0x01, 0x18, 0x39, 0x25, 0x40,
-    0x06, 0x98, 0xA4, 0x12, 0x65, 0x3D, 0xEC, 0x08, 0x70, 0xE9, 0x33, 0x3E, 0x6D, 0xF7, 0x68, 0xEE,
-    0x4C, 0xC4, 0xD8, 0xA1, 0x58, 0x3A, 0x15, 0xA3, 0xE9, 0x4C, 0xC5, 0x56, 0xA6, 0x62, 0xF2, 0x48,
-    0x4C, 0x3B, 0xDF, 0x4A, 0x8E, 0x8B, 0xE9, 0xD6, 0xF2, 0xCD, 0xD4, 0xB3, 0xF9, 0x9D, 0x83, 0x54,
-    0x5B, 0xA3, 0x4F, 0x7B, 0x22, 0x68, 0x0F, 0x27, 0x96, 0xE8, 0xD8, 0xF9, 0x4A, 0x49, 0x3D, 0x3D,
-    0xC0, 0x3B, 0x9C, 0xCD, 0x76, 0xBB, 0xAB, 0xD7, 0x96, 0xFA, 0xFD, 0x6D, 0x8A, 0x65, 0xA4, 0x63,
-    0xEA, 0x5A, 0xD9, 0x6D, 0x1D, 0x63, 0x1D, 0x6B, 0xE0, 0xEC, 0xE9, 0x61, 0xCF, 0x97, 0x76, 0xE6,
-    0xE4, 0x61, 0xD9, 0x6D, 0xD6, 0x6B, 0x78, 0xB1, 0xF4, 0x7F, 0x9A, 0x34, 0x0D, 0xCA, 0xCA, 0xAE,
-    0x79, 0x4F, 0x86, 0x0C, 0x5F, 0xC6, 0xF5, 0x1A, 0x07, 0x5D, 0x61, 0x65, 0x46, 0x81, 0x21, 0xA5,
-    0x6F, 0x1F, 0x71, 0xE0, 0x47, 0x7E, 0xE4, 0x46, 0x4E, 0x44, 0x07, 0x7C, 0x61, 0xAC, 0x61, 0x17,
-    0x2A, 0x19, 0x52, 0x2D, 0x3B, 0x87, 0xE7, 0x61, 0xC1, 0xB9, 0x6B, 0x7E, 0x24, 0x65, 0xEC, 0xBF,
-    0x74, 0xFF, 0x20, 0x95, 0xB5, 0x2E, 0x03, 0xBD, 0xDC, 0x33, 0xD3, 0x9E, 0xF9, 0xD8, 0xCF, 0xC6,
-    0x64, 0x43, 0xFF, 0x86, 0xD2, 0x46, 0xF6, 0xFB, 0x37, 0xF7, 0xC8, 0x59, 0x5D, 0x2A, 0x6D, 0xB3,
-    0x62, 0x3C, 0x5D, 0x94, 0x5F, 0x46, 0xCF, 0xE3, 0x70, 0x46, 0xA8, 0x50, 0x2E, 0x0D, 0x2B, 0x9C,
-    0xD0, 0x9D, 0x45, 0xF8, 0x7A, 0x73, 0xCE, 0x51, 0xBB, 0x07, 0xAA, 0xDC, 0xDC, 0xF1, 0xD5, 0xFB,
-    0xAB, 0x8F, 0xB2, 0x16, 0x05, 0x49, 0xBB, 0xE1, 0x04, 0x45, 0x9F, 0x42, 0xEB, 0x46, 0x3A, 0x6C,
-    0xC7, 0x6C, 0x62, 0x74, 0x1D, 0xE8, 0x3D, 0x2D, 0xA2, 0x43, 0xD8, 0xD2, 0xDF, 0x0E, 0xE2, 0xC8,
-    0x73, 0xD5, 0x9B, 0x7B, 0x77, 0x55, 0xEE, 0xB1, 0xB1, 0x5E, 0x21, 0x60, 0xD9, 0xA5, 0x0B, 0x60,
-    0x65, 0x43, 0xDD, 0x10, 0x6E, 0x56, 0xD7, 0x68, 0x45, 0xAD, 0xC1, 0x03, 0xEB, 0x83, 0x1E, 0x27,
-    0xE3, 0x5C, 0xA5, 0xA2, 0x2E, 0x4F, 0x10, 0x3D, 0x3F, 0xD1, 0xDE, 0x88, 0xCC, 0xD4, 0x29, 0x9E,
-    0xFD, 0x84, 0x27, 0x93, 0x1E, 0xE6, 0x5C, 0x09, 0xA7, 0x9C, 0x92, 0x1F, 0xB7, 0xD0, 0xC6, 0xCC,
-    0x0F, 0x3B, 0x95, 0xE8, 0x72, 0xA7, 0xCA, 0x54, 0x22, 0xF3, 0xDE, 0x00, 0xCB, 0xC0, 0xFC, 0xC2,
-    0xA0, 0x82, 0xAB, 0xCA, 0x39, 0x04, 0x6D, 0x34, 0xF0, 0x0C, 0xAD, 0x9C, 0x45, 0xFD, 0x39, 0x22,
-    0x9D, 0x5A, 0xA7, 0x46, 0xA4, 0xBE, 0xDC, 0xD1, 0x4A, 0xD4, 0x96, 0x3B, 0x9E, 0x3E, 0x64, 0xB9,
-    0x73, 0x96, 0xC8, 0xE9, 0xE5, 0xE9, 0x99, 0x67, 0x2B, 0xC9, 0xD3, 0xD0, 0xE4, 0x22, 0xF9, 0x21,
-    0xD0, 0xE3, 0xF0, 0x4C, 0xF6, 0x3D, 0x5C, 0x0B, 0x30, 0xFD, 0x5E, 0xA7, 0xC2, 0xFF, 0xE5, 0x23,
-    0x5D, 0x34, 0x79, 0x5A, 0xDD, 0x3A, 0x0A, 0x63, 0x1C, 0xC4, 0x4C, 0x86, 0x07, 0xF9, 0x1C, 0x98,
-    0x79, 0xFF, 0xA3, 0xF4, 0xD6, 0x05, 0x33, 0xDD, 0x24, 0xEF, 0xB6, 0x09, 0x94, 0x52, 0x57, 0xC9,
-    0xDE, 0x8B, 0xC3, 0xDB, 0x58, 0x5C, 0xDB, 0x9C, 0xD3, 0xD7, 0x08, 0x8D, 0x61, 0x55, 0x7F, 0xF5,
-    0x66, 0xF7, 0x30, 0x49, 0xCF, 0x6B, 0x2D, 0x6B, 0xEC, 0x1F, 0xF1, 0x2F, 0x72, 0x82, 0x4D, 0xBA,
-    0x7B, 0xCD, 0x3A, 0x72, 0x3E, 0x66, 0xAA, 0x3A, 0xF5, 0x24, 0x82, 0xAA, 0x9A, 0xA4, 0x55, 0xF0,
-    0xDC, 0x28, 0x5D, 0x02, 0xF2, 0x7F, 0x8B, 0x78, 0xFF, 0xFD, 0x97, 0xD2, 0xA6, 0xF3, 0x02, 0x32,
-    0xAF, 0xE5, 0x9A, 0x59, 0xD3, 0xBA, 0x74, 0xFF, 0x9F, 0x59, 0x0B, 0x27, 0x26, 0x68, 0x6B, 0x44,
-    0x5C, 0xBC, 0xF6, 0xB7, 0x78, 0x7C, 0xF9, 0xB1, 0x93, 0xAF, 0xEC, 0x3C, 0xF3, 0xFC, 0x6C, 0xE1,
-    0x6E, 0x39, 0x4A, 0xE5, 0x4D, 0x2B, 0xED, 0xEA, 0x3A, 0xD1, 0x53, 0xF3, 0x7A, 0xCD, 0x2C, 0xDC,
-    0xA4, 0x46, 0xAE, 0xF5, 0xE0, 0x97, 0xA1, 0x24, 0xD2, 0xC1, 0xDA, 0x42, 0x65, 0x29, 0xBB, 0x94,
-    0x55, 0x54, 0x3A, 0x55, 0x22, 0xFA, 0x41, 0x48, 0xCE, 0x86, 0x9B, 0x30, 0xF5, 0x00, 0x33, 0x71,
-    0x0E, 0x43, 0xA7, 0xA0, 0x06, 0x06, 0x22, 0xB9, 0x96, 0x38, 0xD3, 0x6F, 0x4D, 0x80, 0xE5, 0xFF,
-    0x7D, 0xF7, 0x94, 0x4E, 0xE8, 0x97, 0x35, 0x3A, 0xAA, 0x52, 0xD7, 0x46, 0x7F, 0xFB, 0xF8, 0x0A,
-    0xCE, 0xFC, 0x4A, 0x9F, 0x1F, 0xD1, 0xDA, 0x16, 0xC1, 0x01, 0x99, 0xA0, 0x3E, 0x6D, 0x6F, 0xDC,
-    0xC8, 0x71, 0x86, 0xB8, 0x4C, 0xDF, 0x85, 0x1B, 0x93, 0x13, 0x27, 0x6D, 0xF6, 0xE6, 0x3B, 0x9A,
-    0x50, 0x0E, 0xAA, 0xA8, 0x02, 0x14, 0x45, 0x77, 0x97, 0x53, 0x06, 0xF8, 0x9A, 0x0A, 0xAC, 0x42,
-    0x67, 0xE3, 0x98, 0x69, 0x1C, 0x04, 0xCF, 0xFD, 0xEA, 0x05, 0x7B, 0x37, 0xF8, 0x0C, 0x20, 0x8F,
-    0x9A, 0x39, 0xD1, 0xAD, 0x3D, 0xB2, 0x26, 0x95, 0x27, 0x27, 0x58, 0xAB, 0x26, 0xB2, 0xA6, 0x98,
-    0x48, 0xAD, 0x1D, 0x8A, 0xB3, 0xD6, 0xE2, 0x0E, 0xE6, 0x31, 0xEF, 0xA8, 0xEB, 0xD6, 0xC0, 0xBE,
-    0xBE, 0xE1, 0x7C, 0xC8, 0x5A, 0xFC, 0x11, 0x8F, 0x7E, 0x9F, 0x34, 0x42, 0xF5, 0x03, 0xF0, 0x00,
-    0x7F, 0x3A, 0x3D, 0x5B, 0xE2, 0xAB, 0xBB, 0xB5, 0x6B, 0xFB, 0x0D, 0x1A, 0xAC, 0x65, 0x3E, 0x5A,
-    0x0D, 0xFE, 0x20, 0x4E, 0x66, 0xFC, 0x77, 0xF8, 0x18, 0xD7, 0xF3, 0x8E, 0x95, 0xD3, 0x2D, 0xD9,
-    0x60, 0xFB, 0xB8, 0x26, 0x1A, 0x57, 0x4D, 0xCD, 0x0C, 0xD2, 0x9D, 0x67, 0x0F, 0xE8, 0xE4, 0xDE,
-    0xC7, 0xC1, 0x79, 0x0C, 0x0C, 0x61, 0xC2, 0xFE, 0x36, 0x49, 0x19, 0x60, 0x02, 0x57, 0x67, 0x1A,
-    0x17, 0xDE, 0x7D, 0x8E, 0xDF, 0xC1, 0x8F, 0xA2, 0x46, 0x6A, 0x9E, 0x37, 0xF6, 0xEE, 0x66, 0xEE,
-    0xCF, 0xD6, 0x08, 0xED, 0x4D, 0xB0, 0xDD, 0xE0, 0x27, 0xA3, 0x45, 0x63, 0x1F, 0xDF, 0x14, 0x5F,
-    0xB9, 0xCA, 0x1B, 0xA8, 0x98, 0x7A, 0x6B, 0x86, 0xBF, 0xFB, 0x70, 0xE8, 0x59, 0xD1, 0xBF, 0xA2,
-    0xAB, 0xD6, 0x45, 0x13, 0x7F, 0x0C, 0x8E, 0x08, 0x27, 0x3B, 0xBE, 0x33, 0xBC, 0x6D, 0x61, 0x50,
-    0x8D, 0xB7, 0x74, 0x79, 0xB1, 0x07, 0xCE, 0x27, 0x27, 0xA9, 0x5A, 0x12, 0x1E, 0x9C, 0xA4, 0x1C,
-    0x71, 0xC9, 0xC4, 0xF3, 0xF8, 0x4B, 0x30, 0x18, 0x5C, 0x6C, 0x34, 0xF8, 0xCF, 0xF1, 0x1A, 0xC1,
-    0x3C, 0x4B, 0x48, 0xE3, 0x79, 0x1E, 0xDD, 0x13, 0x8B, 0xC2, 0xD0, 0x7F, 0x27, 0x0F, 0xA2, 0xEC,
-    0x85, 0xB5, 0x59, 0xFC, 0x07, 0xED, 0x7D, 0x4F, 0xAC, 0x1D, 0xD7, 0x79, 0xDF, 0x99, 0x19, 0x91,
-    0xD7, 0xF1, 0xA0, 0x19, 0x2D, 0x24, 0xA7, 0xB1, 0xD0, 0x4C, 0x16, 0xE9, 0xA2, 0x69, 0xEB, 0xE9,
-    0xC2, 0x8B, 0xA0, 0x48, 0x35, 0x23, 0x0B, 0x88, 0x17, 0x5E, 0x98, 0x01, 0x78, 0x25, 0x24, 0x02,
-    0xCA, 0x2C, 0xB2, 0x68, 0xE5, 0xA4, 0x6F, 0x93, 0x4D, 0x01, 0xFB, 0xCD, 0xC8, 0x42, 0xA1, 0x85,
-    0x17, 0x62, 0x80, 0x28, 0x59, 0x64, 0x61, 0x01, 0x55, 0x00, 0xF9, 0x12, 0x05, 0xB3, 0xC8, 0xC2,
-    0x68, 0xC4, 0x37, 0x23, 0x69, 0xC1, 0x85, 0x16, 0xBC, 0x8A, 0x62, 0x68, 0xE1, 0x85, 0xAE, 0x2D,
-    0x31, 0x84, 0xA8, 0x05, 0x47, 0xE6, 0xD0, 0x9C, 0xF7, 0xDE, 0xCC, 0x9C, 0x7E, 0xBF, 0xDF, 0x77,
-    0x66, 0xEE, 0x7D, 0x7F, 0x28, 0x3E, 0xD2, 0x92, 0x42, 0xB7, 0x7D, 0xE4, 0x9D, 0x7B, 0xEE, 0x99,
-    0x7F, 0xE7, 0xCF, 0x77, 0xBE, 0xFF, 0xDF, 0x77, 0xBC, 0x85, 0x31, 0xA6, 0xCC, 0x8C, 0x49, 0x2A,
-    0x63, 0xC2, 0x95, 0x31, 0x41, 0x2D, 0x15, 0x9D, 0x7C, 0x1E, 0x31, 0xE3, 0x5F, 0x6E, 0x6D, 0x2F,
-    0x9F, 0x81, 0x1F, 0xFC, 0xFE, 0xA4, 0xCF, 0x7C, 0x7E, 0x56, 0xAE, 0xEB, 0xF8, 0x41, 0xF9, 0x6E,
-    0xD7, 0xEB, 0xF3, 0x87, 0xF1, 0x63, 0xFE, 0xE8, 0x74, 0xE6, 0x75, 0xD1, 0xD2, 0x97, 0x8F, 0x7C,
-    0x57, 0xE6, 0x8F, 0xFC, 0xEC, 0x9F, 0xA3, 0x1D, 0xF2, 0xB1, 0xBD, 0x49, 0xE4, 0x68, 0xB3, 0x10,
-    0xC7, 0xA5, 0x31, 0xF1, 0x12, 0xAD, 0xE0, 0x00, 0xE9, 0x10, 0x19, 0x93, 0xF2, 0x28, 0xCD, 0x3C,
-    0x7A, 0xE2, 0x2C, 0x4E, 0x7C, 0x24, 0x0F, 0x31, 0x81, 0xDC, 0xDE, 0x18, 0x63, 0xF7, 0x2E, 0xDA,
-    0xCC, 0xA4, 0x99, 0x49, 0x6A, 0xDC, 0xE1, 0xF7, 0xBC, 0x23, 0x2D, 0x70, 0x47, 0x58, 0xE3, 0x51,
-    0x7E, 0xC7, 0x47, 0x95, 0x3C, 0x21, 0x13, 0x22, 0x27, 0xA2, 0x15, 0x4E, 0xCC, 0x1A, 0x9C, 0x98,
-    0x75, 0x72, 0xE2, 0x8B, 0x17, 0xE5, 0x89, 0xDD, 0x0C, 0xCF, 0x4D, 0x3D, 0xDB, 0xE2, 0x5D, 0xA7,
-    0xCE, 0xC8, 0xE1, 0xCB, 0xE7, 0xA5, 0x82, 0x37, 0x1B, 0xAF, 0xD3, 0xC6, 0x84, 0xF2, 0xD3, 0x33,
-    0x9B, 0xD3, 0xD8, 0x4D, 0x9F, 0x93, 0x0C, 0xC7, 0x2F, 0xF0, 0x71, 0x7F, 0x89, 0xDD, 0x95, 0x16,
-    0x59, 0x5B, 0x7B, 0x32, 0x04, 0x9D, 0x27, 0x83, 0xF8, 0xA7, 0xC6, 0x62, 0x3E, 0x79, 0xC8, 0x0B,
-    0xA3, 0x70, 0x87, 0x5E, 0xB2, 0x93, 0x1C, 0x02, 0xC3, 0x4E, 0x18, 0x0E, 0x7E, 0x8D, 0xB1, 0xEF,
-    0xFC, 0x61, 0xB1, 0x58, 0xB8, 0x4A, 0x5C, 0x3E, 0xE3, 0x48, 0xF7, 0x1C, 0x67, 0xFC, 0x0E, 0x71,
-    0xA7, 0xB1, 0x3C, 0x8F, 0x53, 0x81, 0x2D, 0xCC, 0x69, 0x93, 0xDA, 0x85, 0xAD, 0x7C, 0x3C, 0xC4,
-    0xC8, 0x53, 0xE4, 0x0D, 0xDE, 0x59, 0xD7, 0x2C, 0xAF, 0xB4, 0xE7, 0x8D, 0x9C, 0xA8, 0x30, 0x14,
-    0x51, 0x6B, 0x1E, 0x7B, 0xA2, 0x77, 0x8F, 0xF6, 0x31, 0xA0, 0x49, 0xE1, 0xDA, 0x11, 0xA3, 0x59,
-    0xB6, 0xC2, 0x03, 0x65, 0x74, 0x23, 0x3C, 0x23, 0xD6, 0x83, 0x40, 0x42, 0x88, 0x3E, 0x84, 0xBC,
-    0x0C, 0x70, 0x31, 0x18, 0xCE, 0xA2, 0xB6, 0x1D, 0xFD, 0xF1, 0xFA, 0xDF, 0x91, 0x2E, 0xBE, 0x69,
-    0x17, 0x65, 0x9D, 0xA2, 0xF3, 0x25, 0xA6, 0x0C, 0x53, 0x95, 0xC7, 0x97, 0x3F, 0xEE, 0x3E, 0xE9,
-    0x50, 0xFF, 0xCE, 0x6F, 0xA4, 0x2F, 0xBE, 0xF7, 0xFE, 0x5E, 0x73, 0xE9, 0x91, 0x87, 0xD8, 0xDE,
-    0xB8, 0x9A, 0xD5, 0x32, 0xA9, 0xF9, 0x7D, 0x15, 0xCC, 0x6C, 0x25, 0x6D, 0x92, 0xA6, 0xFD, 0x82,
-    0x87, 0x95, 0x0C, 0x78, 0x7A, 0xC5, 0xB6, 0x76, 0x08, 0x07, 0x2E, 0xC9, 0x19, 0x87, 0x16, 0xDD,
-    0x3E, 0x5A, 0x58, 0xB9, 0x39, 0x0A, 0x97, 0x6E, 0x59, 0x4C, 0x85, 0xE8, 0x13, 0x0A, 0xD5, 0x46,
-    0xE1, 0xD6, 0xDC, 0x15, 0xB0, 0x0E, 0x5D, 0x41, 0x86, 0x1D, 0x85, 0xBD, 0x85, 0x6D, 0xDC, 0xC5,
-    0x32, 0xFE, 0x31, 0x0B, 0x5E, 0xEF, 0x0A, 0x32, 0x11, 0x71, 0xC1, 0x42, 0x89, 0x89, 0x3C, 0x54,
-    0x90, 0xD5, 0xE7, 0x0A, 0xC6, 0x5D, 0x9C, 0xB3, 0x10, 0x74, 0x98, 0x40, 0x29, 0xC4, 0xED, 0xB8,
-    0x62, 0x57, 0x58, 0x5C, 0x28, 0x64, 0x98, 0x72, 0x29, 0x7C, 0x60, 0x1E, 0x9D, 0x96, 0x92, 0x7C,
-    0xB6, 0x1D, 0x20, 0x72, 0xD2, 0x73, 0x37, 0xF1, 0x9F, 0x4A, 0x85, 0xE5, 0xDF, 0x07, 0x58, 0xB0,
-    0xF8, 0x6B, 0x5C, 0x85, 0x5D, 0xE9, 0x15, 0xBE, 0xFD, 0xBA, 0xDE, 0x12, 0x74, 0xEE, 0x96, 0xF8,
-    0x5D, 0xF7, 0x8C, 0xDE, 0x55, 0x44, 0xD7, 0x5C, 0xC5, 0x30, 0x56, 0xB8, 0x2B, 0xBC, 0xF1, 0x96,
-    0xF4, 0xB2, 0x56, 0x24, 0x0D, 0x2B, 0x64, 0x90, 0xD9, 0x0E, 0x74, 0x57, 0x2B, 0x64, 0x8E, 0x7F,
-    0x71, 0x1C, 0xF8, 0xA8, 0xE2, 0xC0, 0xE1, 0x30, 0x0E, 0x2C, 0x8E, 0xC5, 0x81, 0x44, 0x75, 0xB2,
-    0x02, 0x0F, 0xE3, 0xC0, 0x3B, 0x22, 0xC7, 0xE9, 0x84, 0xF1, 0x5F, 0xC5, 0xCB, 0xBB, 0x09, 0x81,
-    0x74, 0x13, 0x82, 0xF8, 0x0E, 0x0E, 0x0F, 0x99, 0xCD, 0x3F, 0x01, 0x14, 0xB3, 0x8D, 0xEE, 0xA6,
-    0x4F, 0x74, 0x78, 0x79, 0x8E, 0xE7, 0x49, 0x65, 0xBC, 0x94, 0xCA, 0x68, 0x25, 0x6B, 0x46, 0x1E,
-    0x9C, 0x03, 0x1F, 0xC5, 0x55, 0xD0, 0xCA, 0x04, 0xC9, 0x33, 0xBD, 0x4E, 0x20, 0x4C, 0xA8, 0xCA,
-    0x80, 0xD5, 0x6F, 0x39, 0x49, 0x95, 0x00, 0xDD, 0xD3, 0x1D, 0xE6, 0x4D, 0x10, 0x59, 0x5C, 0x45,
-    0x35, 0xA6, 0xD2, 0x02, 0xFB, 0xCA, 0x20, 0xE5, 0x68, 0x8D, 0x3C, 0x33, 0x95, 0x45, 0x28, 0x4F,
-    0xC2, 0x3A, 0xB4, 0x98, 0xE1, 0xA8, 0x8E, 0x71, 0x1F, 0xDF, 0xFE, 0x3A, 0xF0, 0x74, 0x6B, 0x4E,
-    0xBF, 0x4A, 0xC4, 0xB5, 0x9C, 0x10, 0x1F, 0x91, 0x90, 0x1B, 0x50, 0x1D, 0xDC, 0x33, 0x9B, 0xCD,
-    0xE7, 0xCA, 0xE2, 0xC4, 0x26, 0x98, 0xE6, 0x19, 0x8B, 0x16, 0xC5, 0x04, 0xC5, 0xD9, 0x6D, 0x14,
-    0xFB, 0x6D, 0xF4, 0xEA, 0x7B, 0x52, 0x0C, 0xEA, 0x1D, 0x29, 0xF6, 0xA1, 0x14, 0xE3, 0x4A, 0x8A,
-    0x41, 0x8D, 0xE2, 0x60, 0x76, 0x80, 0x21, 0xA4, 0x28, 0xC3, 0x29, 0xC5, 0x1D, 0x23, 0x45, 0x69,
-    0xDA, 0x4E, 0x1E, 0x34, 0x28, 0xEE, 0x18, 0x29, 0xCA, 0xEF, 0xF0, 0xDA, 0xCD, 0x06, 0x45, 0xF9,
-    0x1D, 0x5E, 0x03, 0x2A, 0xDC, 0xC9, 0x1B, 0x16, 0x0D, 0x8A, 0xE0, 0x19, 0xAE, 0xA1, 0xB5, 0x72,
-    0xFB, 0x12, 0xF3, 0x32, 0xAB, 0x67, 0x58, 0x2C, 0xBB, 0x5B, 0xE8, 0x8D, 0xB5, 0x44, 0xF0, 0xBB,
-    0x07, 0x06, 0x9F, 0x60, 0xEE, 0xB7, 0x32, 0xE5, 0xD2, 0x77, 0xA0, 0xDC, 0x59, 0x0D, 0x6C, 0x19,
-    0xAD, 0x00, 0xAE, 0x1C, 0x6F, 0x99, 0x11, 0x4C, 0xA2, 0x2C, 0xD5, 0x81, 0x03, 0x52, 0x72, 0x26,
-    0xB5, 0x32, 0xE1, 0x05, 0xD1, 0x4A, 0x17, 0x0D, 0x6E, 0x0C, 0x5A, 0x4C, 0xA7, 0xDF, 0x01, 0x69,
-    0x9B, 0x21, 0x05, 0x66, 0x2A, 0x39, 0x8A, 0x29, 0xA7, 0x3F, 0x21, 0x24, 0x44, 0x24, 0x10, 0x11,
-    0x81, 0x93, 0x48, 0x5D, 0xE9, 0x06, 0xC9, 0x50, 0x00, 0xF0, 0x94, 0x63, 0xCB, 0x23, 0x67, 0xE1,
-    0xEC, 0xD8, 0xCE, 0xF8, 0xFB, 0xEC, 0xA1, 0xDC, 0xE7, 0xEF, 0x76, 0xEC, 0x31, 0x1E, 0xF9, 0xB9,
-    0x54, 0x62, 0xBD, 0x7D, 0x1F, 0x87, 0x6B, 0x38, 0xB4, 0x23, 0xB9, 0xCB, 0x14, 0x61, 0x4A, 0x53,
-    0x9B, 0x35, 0x0D, 0xCC, 0x1C, 0xCE, 0x5D, 0xF7, 0x91, 0x27, 0x53, 0xF6, 0xFD, 0x71, 0x1E, 0x2F,
-    0x6D, 0x73, 0x59, 0x00, 0x9C, 0xBC, 0x0E, 0x37, 0x04, 0x0D, 0xC6, 0x2D, 0xA8, 0x23, 0xF2, 0x7D,
-    0xB8, 0x39, 0x02, 0xF8, 0x63, 0x0A, 0x1A, 0x90, 0x40, 0x00, 0x61, 0x4A, 0x56, 0xA2, 0x9C, 0xCF,
-    0x7B, 0x4C, 0xA6, 0x80, 0xBD, 0xC7, 0x23, 0xC8, 0x71, 0x59, 0xE0, 0x32, 0x90, 0x18, 0xDC, 0x88,
-    0x89, 0x08, 0x01, 0x3E, 0x32, 0x9B, 0x98, 0xD3, 0xA0, 0xC5, 0x2B, 0x7C, 0x22, 0x1B, 0xD3, 0x63,
-    0x7C, 0x0D, 0x39, 0xAA, 0xE7, 0xE4, 0x33, 0x00, 0x9D, 0x71, 0xD2, 0x38, 0xC4, 0x78, 0x83, 0x82,
-    0xF4, 0x71, 0x55, 0x0E, 0x0D, 0xF6, 0xDE, 0xB0, 0x20, 0x86, 0x0A, 0x3B, 0xB9, 0x6A, 0xD6, 0x62,
-    0x21, 0x7D, 0x2C, 0x57, 0xC5, 0xC0, 0x62, 0x00, 0x53, 0xE2, 0xB5, 0x10, 0x55, 0x40, 0x6C, 0x7E,
-    0x2F, 0x55, 0x79, 0x8D, 0x37, 0xA2, 0xC5, 0xAB, 0x19, 0x1E, 0x23, 0xCF, 0xD9, 0x23, 0x4E, 0xEB,
-    0x89, 0xD8, 0xAA, 0x5C, 0xD8, 0x80, 0x15, 0x57, 0x24, 0x16, 0x0D, 0xD0, 0x60, 0x70, 0xF0, 0x10,
-    0xE2, 0x44, 0xBC, 0xCC, 0xE7, 0x4F, 0x09, 0x4E, 0x04, 0xF6, 0xD2, 0x7B, 0xE5, 0xE7, 0x72, 0xBC,
-    0x8D, 0x18, 0x98, 0xEF, 0xF6, 0x88, 0x7A, 0xFB, 0xB1, 0xC4, 0xAE, 0xCF, 0x70, 0x48, 0xD8, 0x8C,
-    0x65, 0x4E, 0xCC, 0xEA, 0xBA, 0xF3, 0xF9, 0xB1, 0x61, 0x1E, 0x51, 0x38, 0xF1, 0x7A, 0xA3, 0x1C,
-    0xD5, 0x12, 0x8B, 0x95, 0x74, 0xB0, 0x21, 0xF8, 0x80, 0xFA, 0x36, 0xAC, 0x00, 0x58, 0xE9, 0xBA,
-    0xC3, 0x4A, 0x76, 0x44, 0xB7, 0x21, 0x0A, 0x3A, 0x72, 0x2A, 0xD6, 0x53, 0x39, 0x4F, 0x11, 0x54,
-    0x32, 0x90, 0x78, 0x2E, 0x54, 0x7D, 0x74, 0xC7, 0x53, 0x58, 0xD4, 0x29, 0x99, 0x5E, 0x39, 0x45,
-    0xBE, 0xB4, 0x21, 0x73, 0x24, 0xA7, 0x4A, 0x42, 0x6E, 0x49, 0xCA, 0x36, 0x28, 0x81, 0xDB, 0xD7,
-    0xAF, 0x1B, 0x05, 0xD7, 0xDF, 0x0E, 0x3B, 0x30, 0x10, 0x19, 0xCE, 0xF6, 0x09, 0xDD, 0xF1, 0xE6,
-    0x29, 0xD3, 0x7D, 0x9E, 0x02, 0x41, 0x92, 0x19, 0x1F, 0x43, 0xF8, 0x5C, 0x47, 0x06, 0x71, 0x56,
-    0x4B, 0xD7, 0xD0, 0xF1, 0x81, 0xD4, 0x4C, 0xFE, 0x57, 0xD2, 0x3D, 0x1F, 0xD4, 0x82, 0x64, 0xB5,
-    0x00, 0xF2, 0x4A, 0xB1, 0x8A, 0x12, 0x40, 0xA7, 0x54, 0x28, 0xCA, 0x92, 0x0A, 0x2C, 0x87, 0xB4,
-    0x48, 0x0A, 0x2C, 0x14, 0xAF, 0xF3, 0x5B, 0xF2, 0xBD, 0xE1, 0xAD, 0xFC, 0x47, 0x5C, 0x27, 0x29,
-    0x60, 0xD3, 0x71, 0x01, 0x5C, 0xB9, 0xF6, 0xE9, 0xFE, 0x5C, 0x4D, 0xF6, 0x34, 0x29, 0x72, 0x2C,
-    0xDC, 0xD6, 0x6F, 0x49, 0xE4, 0xAC, 0x3C, 0x14, 0x63, 0x19, 0x2F, 0xE5, 0xA1, 0x72, 0x46, 0x30,
-    0x63, 0x52, 0x04, 0x24, 0x34, 0x20, 0xA2, 0x2B, 0x90, 0x21, 0x69, 0x47, 0x99, 0x05, 0x6C, 0x98,
-    0x1C, 0x4B, 0x36, 0x3D, 0x5E, 0xC5, 0x3A, 0x67, 0x65, 0xA0, 0x7D, 0x09, 0xBA, 0x52, 0x89, 0x8E,
-    0x12, 0x77, 0xF3, 0x98, 0x10, 0x7F, 0xD0, 0xEB, 0x2A, 0xB2, 0x17, 0x6D, 0xF5, 0x1B, 0x02, 0x44,
-    0x95, 0x13, 0x12, 0xD9, 0x76, 0x60, 0x60, 0xE5, 0xD8, 0x75, 0x91, 0x2B, 0xF1, 0x9A, 0x3F, 0xD3,
-    0x03, 0x95, 0x0A, 0x18, 0xE1, 0xF0, 0xE8, 0xB3, 0xBC, 0x07, 0x04, 0x42, 0x51, 0x6D, 0x3E, 0x62,
-    0x2B, 0xE2, 0x2D, 0x62, 0x30, 0x3C, 0x30, 0xE8, 0xFE, 0x58, 0xCE, 0xFD, 0x83, 0x30, 0xC9, 0x03,
-    0x60, 0x74, 0x39, 0x23, 0x9C, 0x3E, 0x7A, 0x46, 0x6F, 0x20, 0x1B, 0xE3, 0xEB, 0xD4, 0xA2, 0x18,
-    0xA1, 0xE8, 0x93, 0xD4, 0xE5, 0xA0, 0x6F, 0xD1, 0xBB, 0xD7, 0x30, 0x09, 0xC0, 0xA0, 0x29, 0x90,
-    0x67, 0xB4, 0x94, 0xA2, 0xD7, 0xA1, 0x98, 0x02, 0xAF, 0x0A, 0x51, 0xB9, 0x06, 0x16, 0x58, 0x8A,
-    0x29, 0xB0, 0xAB, 0x60, 0xB9, 0x9D, 0x1C, 0xE4, 0xFD, 0x5A, 0x2D, 0x4D, 0xDF, 0xC9, 0xE5, 0x77,
-    0x78, 0x0D, 0x48, 0x63, 0x27, 0x07, 0xFC, 0x5E, 0x03, 0x90, 0xED, 0xE4, 0x1D, 0xE9, 0x5B, 0x86,
-    0x22, 0xA6, 0xEC, 0x9A, 0xE2, 0xE3, 0x82, 0x18, 0x36, 0xCE, 0x22, 0x4C, 0x27, 0x20, 0x39, 0xBA,
-    0x85, 0x0E, 0xA4, 0x60, 0x0E, 0x4D, 0xF9, 0xC1, 0x03, 0x4F, 0xA0, 0x81, 0x99, 0x88, 0x75, 0xC9,
-    0x7B, 0x0C, 0x44, 0xEC, 0x18, 0xE4, 0x3C, 0x03, 0x97, 0x02, 0xE8, 0x24, 0x04, 0x93, 0x75, 0x01,
-    0xEC, 0x54, 0x21, 0xF8, 0x19, 0x81, 0x4D, 0x61, 0x72, 0x5A, 0x2C, 0x85, 0x6E, 0xE4, 0x7C, 0x6E,
-    0x9D, 0x03, 0x1F, 0xE9, 0x0D, 0x98, 0x23, 0x99, 0x5B, 0x21, 0x18, 0x1D, 0xBA, 0x9C, 0x8B, 0xDC,
-    0x0E, 0xF2, 0x93, 0x03, 0x00, 0x47, 0x6E, 0x2A, 0xE0, 0x50, 0xA5, 0x15, 0x51, 0x2C, 0xDE, 0x6E,
-    0x49, 0x30, 0x56, 0x04, 0xEF, 0x86, 0x08, 0x69, 0x05, 0xEE, 0xD3, 0x16, 0xBA, 0x96, 0x20, 0x26,
-    0x08, 0x18, 0x67, 0xB8, 0x84, 0x44, 0x1F, 0xE0, 0x32, 0x10, 0x49, 0xB5, 0x44, 0x44, 0x2B, 0xE2,
-    0xA1, 0x42, 0x79, 0x77, 0x20, 0xA8, 0x03, 0xD5, 0x33, 0xE5, 0xFF, 0x59, 0xBD, 0x8D, 0x6A, 0xA2,
-    0xA6, 0x02, 0xD4, 0x6D, 0x20, 0x62, 0x6A, 0x55, 0xA6, 0x26, 0xFB, 0x55, 0x80, 0x07, 0x19, 0xC8,
-    0xEE, 0xEF, 0x63, 0x16, 0xA3, 0x1B, 0x5C, 0x99, 0xFF, 0x83, 0xD4, 0x34, 0xC7, 0xB4, 0x86, 0x3D,
-    0x20, 0xC0, 0x44, 0x3D, 0x86, 0xD4, 0xC4, 0x3D, 0x40, 0x43, 0xF8, 0x8A, 0x6D, 0xF7, 0x05, 0x2C,
-    0x74, 0x89, 0xF3, 0x68, 0xBA, 0x7E, 0x5B, 0x1E, 0xEF, 0xB5, 0xFD, 0x36, 0xD6, 0x53, 0xD3, 0x6F,
-    0x53, 0x3C, 0x91, 0x2F, 0x41, 0x81, 0xAB, 0x3E, 0x07, 0x5F, 0x59, 0xF5, 0x98, 0xB9, 0x58, 0xBE,
-    0x80, 0x14, 0x32, 0xA1, 0x12, 0x9D, 0x34, 0x5D, 0xBE, 0x7A, 0x69, 0xAA, 0x7C, 0xE1, 0x77, 0x0F,
-    0x40, 0xE5, 0x57, 0xF2, 0xDD, 0x06, 0x5F, 0xF1, 0x9B, 0x35, 0xBE, 0xA2, 0x77, 0x57, 0xF8, 0x0A,
-    0x3F, 0x5A, 0xE2, 0x2B, 0x90, 0x69, 0xE6, 0x57, 0x81, 0x2F, 0xCF, 0x2A, 0xDD, 0x71, 0x5F, 0x97,
-    0x9C, 0x14, 0x10, 0x5D, 0xA6, 0x22, 0xE7, 0xDE, 0x8B, 0xB7, 0xE6, 0xF3, 0xA7, 0x3A, 0xB2, 0x1F,
-    0x97, 0x71, 0xE8, 0x72, 0x91, 0xBD, 0x2F, 0xDE, 0xEF, 0xC3, 0xD6, 0xC5, 0x6A, 0x5C, 0x1D, 0x5B,
-    0x14, 0xC5, 0x31, 0xE5, 0xC6, 0x27, 0x8E, 0xF3, 0x6D, 0xE1, 0x95, 0x15, 0xBA, 0x31, 0xEB, 0x28,
-    0xC4, 0xE7, 0xC4, 0x73, 0x51, 0x0D, 0xC4, 0xE1, 0xF5, 0xC4, 0x15, 0xE9, 0x0B, 0x78, 0x52, 0xF8,
-    0x33, 0xE5, 0xF0, 0xC9, 0xDF, 0xE5, 0x54, 0x05, 0xC4, 0x3F, 0xC6, 0x89, 0xD9, 0xCF, 0x71, 0xC2,
-    0xEB, 0x37, 0x4F, 0xF0, 0xDD, 0x61, 0x4D, 0x9C, 0xD3, 0x12, 0x07, 0xF5, 0xC4, 0xB4, 0xA5, 0x7B,
-    0x07, 0xF8, 0xC0, 0xBC, 0xF2, 0x65, 0xA1, 0x97, 0x82, 0x27, 0x87, 0x0B, 0x42, 0x19, 0x3D, 0xC5,
-    0xBD, 0xA1, 0xA5, 0x80, 0x4B, 0xB5, 0xCA, 0x9A, 0x0F, 0xBB, 0x8D, 0x43, 0x8F, 0xF7, 0x94, 0x64,
-    0x0D, 0xDF, 0x03, 0xB7, 0x73, 0xBB, 0xC6, 0x6B, 0x51, 0x99, 0x7F, 0x0E, 0x95, 0x32, 0x2D, 0x1F,
-    0x72, 0xE5, 0x80, 0x93, 0x18, 0x44, 0xBA, 0xCF, 0xC1, 0xA7, 0xE4, 0x97, 0x6B, 0x65, 0x3A, 0x88,
-    0x2E, 0x2D, 0x38, 0x97, 0xDB, 0x4E, 0xF4, 0x83, 0xD8, 0x47, 0x56, 0xA4, 0x7C, 0xE1, 0xD6, 0x53,
-    0x25, 0x38, 0x91, 0x76, 0x46, 0x26, 0x66, 0xF1, 0x17, 0x8A, 0xA5, 0xF2, 0x11, 0x5D, 0xDD, 0xA5,
-    0x70, 0x58, 0xA1, 0xD3, 0x4C, 0x0A, 0x9D, 0xFF, 0x76, 0x0F, 0x0A, 0x9D, 0x6A, 0xD4, 0x91, 0x1C,
-    0xAE, 0x54, 0x65, 0xC1, 0x70, 0x4F, 0x0A, 0x9D, 0x0F, 0x54, 0xA1, 0xC3, 0x09, 0xDA, 0xC2, 0xE1,
-    0xC7, 0x14, 0x96, 0xA1, 0x09, 0x18, 0x1B, 0x1D, 0x4F, 0xCF, 0x26, 0x4B, 0xF9, 0x39, 0x54, 0xFE,
-    0xB2, 0x08, 0x37, 0x07, 0xC5, 0xB1, 0xC3, 0x5F, 0xCF, 0x0A, 0x98, 0x4D, 0x4C, 0x63, 0xAE, 0x3C,
-    0xBF, 0x3D, 0x9F, 0x9F, 0x12, 0xFA, 0x4C, 0xC5, 0x52, 0x4D, 0x34, 0xCF, 0xC6, 0xE5, 0x68, 0x1D,
-    0xBE, 0x4C, 0x2F, 0xBD, 0xCE, 0xB5, 0x95, 0xEB, 0xAF, 0x9D, 0xF1, 0x97, 0x9E, 0x73, 0x57, 0x92,
-    0xC8, 0xF8, 0x1D, 0x9F, 0x32, 0x6B, 0xDD, 0x33, 0x7D, 0x61, 0x92, 0x4F, 0xCB, 0xF2, 0xD3, 0xF7,
-    0x8D, 0x6F, 0x37, 0xDF, 0x62, 0x5B, 0x8E, 0x6F, 0x27, 0xF5, 0x0B, 0x18, 0x9B, 0xF8, 0x39, 0x60,
-    0xF1, 0x26, 0xAA, 0x1D, 0x3F, 0x16, 0x83, 0x94, 0x81, 0xD5, 0xAC, 0xA9, 0xEB, 0x00, 0x89, 0xF3,
-    0x3B, 0x90, 0x92, 0x68, 0x45, 0xB6, 0xF3, 0x9B, 0x18, 0x55, 0x0E, 0x4A, 0x44, 0x20, 0xCB, 0x29,
-    0x51, 0x71, 0x4C, 0xAD, 0xCA, 0x1D, 0x98, 0xC1, 0x5B, 0xA4, 0xFC, 0x3A, 0x75, 0xE4, 0x6A, 0x7D,
-    0x12, 0x4D, 0x52, 0x47, 0x21, 0x77, 0x32, 0x59, 0x3E, 0x79, 0xAA, 0x68, 0x05, 0x1C, 0x95, 0x3F,
-    0xD9, 0x3A, 0x81, 0x40, 0x66, 0x81, 0xC7, 0x22, 0xA6, 0x6C, 0x85, 0xE9, 0xF4, 0x5B, 0x42, 0xCB,
-    0x0E, 0x1B, 0x9E, 0xFC, 0xB3, 0x9D, 0x20, 0x7B, 0x7D, 0x8E, 0xC7, 0x77, 0x55, 0xB7, 0x64, 0x26,
-    0x29, 0xD2, 0x89, 0x91, 0x91, 0x2A, 0x78, 0x0E, 0x9E, 0x80, 0xD8, 0x78, 0x29, 0x25, 0x0C, 0x9E,
-    0xF4, 0x90, 0xE9, 0xAC, 0xCB, 0x9C, 0xCB, 0x03, 0x07, 0x28, 0x59, 0x29, 0xF8, 0x0D, 0x40, 0x1C,
-    0x83, 0xB0, 0x98, 0xE7, 0x87, 0x69, 0xC9, 0x9F, 0xF8, 0xA0, 0xBA, 0x3A, 0x93, 0x52, 0xE0, 0x73,
-    0xE4, 0x05, 0x75, 0x14, 0x05, 0x2B, 0xA5, 0x34, 0xB3, 0x07, 0xFF, 0x02, 0xA7, 0xCE, 0x8B, 0xDD,
-    0xF7, 0x65, 0xF7, 0x0D, 0x81, 0x12, 0x9C, 0xCA, 0x25, 0xE3, 0x0A, 0xFD, 0xFF, 0x2D, 0x05, 0xD7,
-    0xC1, 0xEE, 0x68, 0x61, 0xC4, 0x42, 0xF7, 0x56, 0xC8, 0x95, 0xE9, 0xE6, 0x52, 0x2D, 0x9D, 0xC6,
-    0xB9, 0x9E, 0x38, 0xEF, 0xBB, 0x1D, 0xA9, 0x59, 0x16, 0x58, 0xDC, 0x55, 0x21, 0xAB, 0x32, 0xB3,
-    0xBD, 0x85, 0xA5, 0xF2, 0x2E, 0x24, 0x23, 0xEB, 0xF3, 0x28, 0x20, 0xB7, 0x3E, 0x96, 0x87, 0x6B,
-    0x84, 0xC8, 0x90, 0xBB, 0xC5, 0x31, 0x69, 0xF8, 0x1C, 0xE5, 0x69, 0x33, 0x43, 0x65, 0x03, 0xF1,
-    0x93, 0xB2, 0x3F, 0xCA, 0xFF, 0xDC, 0xF3, 0x8F, 0xF9, 0x19, 0xFC, 0x60, 0x2B, 0x29, 0xB3, 0xCA,
-    0x0F, 0x36, 0x93, 0xD4, 0xBC, 0x8A, 0xA8, 0xE5, 0xE0, 0x0F, 0xC1, 0x3E, 0x97, 0xD9, 0x2C, 0xAA,
-    0x40, 0x6A, 0xFE, 0x28, 0x37, 0xCE, 0x78, 0x7A, 0x59, 0xCA, 0x7B, 0xA4, 0xAD, 0x1D, 0xCD, 0x6C,
-    0x78, 0xB4, 0x34, 0x56, 0x7E, 0x40, 0x64, 0xAB, 0x4E, 0xCA, 0x07, 0x68, 0x41, 0xDA, 0xC6, 0xF1,
-    0x43, 0xBB, 0x38, 0x78, 0x68, 0x13, 0x5B, 0x74, 0x84, 0x0B, 0x29, 0xC7, 0x1A, 0x9C, 0x82, 0x6E,
-    0x26, 0x6E, 0x72, 0xA7, 0x03, 0xCA, 0x72, 0xE5, 0xB3, 0x94, 0x29, 0xDC, 0xA5, 0xE8, 0xDB, 0x53,
-    0x51, 0xDC, 0x9A, 0xDF, 0xC8, 0xBC, 0x72, 0x45, 0xFD, 0x45, 0x31, 0x2A, 0x76, 0x1D, 0x6D, 0x23,
-    0xF9, 0x9B, 0xA9, 0x7E, 0x6B, 0x7D, 0x2E, 0xA9, 0x68, 0x28, 0xA2, 0x28, 0x51, 0x9D, 0x5E, 0x2C,
-    0x2E, 0x74, 0x13, 0x6F, 0xA1, 0xBC, 0x86, 0x5E, 0xDB, 0x4C, 0x4F, 0x20, 0x83, 0xA2, 0xF7, 0xDA,
-    0xE2, 0xB7, 0xA4, 0xB2, 0x0E, 0x86, 0x85, 0xBC, 0x98, 0x6D, 0x50, 0x5B, 0x8D, 0x32, 0x80, 0x9B,
-    0x4A, 0xE3, 0x44, 0x66, 0x96, 0xE0, 0x20, 0x2F, 0x91, 0xB5, 0xAD, 0xCA, 0x15, 0xB0, 0xDE, 0x60,
-    0x60, 0xE5, 0x02, 0xCC, 0x7E, 0x27, 0x17, 0x40, 0x30, 0xCC, 0x9F, 0xEB, 0xF8, 0x52, 0xE8, 0x89,
-    0x62, 0x32, 0xB2, 0x14, 0xA9, 0xC8, 0xCA, 0x52, 0x82, 0x86, 0xB6, 0xAA, 0x67, 0xFB, 0xF2, 0x39,
-    0x65, 0xEB, 0x3C, 0xA6, 0x76, 0x46, 0x38, 0x57, 0xB5, 0xA2, 0xCC, 0x3E, 0x1E, 0x16, 0x64, 0x6B,
-    0x65, 0xFA, 0x52, 0xBD, 0xA0, 0x22, 0x76, 0x4E, 0x2E, 0xAF, 0x9F, 0x50, 0x92, 0xBD, 0x5D, 0xBF,
-    0x82, 0x27, 0xCA, 0x19, 0xE9, 0x1E, 0xDB, 0x00, 0x9A, 0x98, 0x43, 0xD9, 0x45, 0x46, 0x17, 0x72,
-    0x19, 0x58, 0x5D, 0x80, 0x30, 0xE4, 0x6D, 0xDA, 0x87, 0xAC, 0xD5, 0x69, 0xF0, 0xD8, 0x5F, 0xEF,
-    0x82, 0x8C, 0x63, 0x82, 0x9E, 0xA1, 0x7B, 0x81, 0x3D, 0x23, 0xA2, 0x29, 0xD4, 0x8F, 0x18, 0x31,
-    0x50, 0x6E, 0xD3, 0x53, 0x8A, 0xE4, 0x01, 0xCD, 0xD1, 0x13, 0xE0, 0xD8, 0xFA, 0x40, 0xE6, 0x53,
-    0x6F, 0xD3, 0x07, 0xD0, 0x76, 0x23, 0x2D, 0xEA, 0xD1, 0x8A, 0x1E, 0xB2, 0x65, 0x8F, 0x31, 0xE9,
-    0xC9, 0xF5, 0x80, 0x4F, 0xEB, 0x31, 0x03, 0x3D, 0x2D, 0x17, 0x98, 0xDD, 0x1E, 0x8C, 0x4B, 0x5F,
-    0xAA, 0xB2, 0x68, 0x0E, 0xD6, 0xA3, 0xE5, 0x58, 0xC7, 0x57, 0x9F, 0xE9, 0x7C, 0x88, 0xAA, 0x3A,
-    0x6F, 0x9C, 0x51, 0x12, 0xB9, 0xEA, 0xB4, 0x0C, 0x95, 0xBC, 0xAA, 0x4B, 0x86, 0x79, 0x99, 0x08,
-    0x5D, 0xBE, 0x22, 0xAB, 0xF0, 0x26, 0x00, 0x11, 0x6A, 0x10, 0xF0, 0x1E, 0x52, 0x91, 0xFF, 0xCC,
-    0xCE, 0xFB, 0x2E, 0xB5, 0x7D, 0x2A, 0x24, 0x3F, 0xAC, 0xDC, 0xAC, 0x7E, 0xE9, 0x6F, 0x31, 0x9F,
-    0x35, 0x7A, 0x2F, 0xCB, 0xC2, 0x7E, 0x28, 0xA3, 0x03, 0xB9, 0x64, 0x18, 0xC1, 0x84, 0xEA, 0x54,
-    0x4A, 0x2D, 0x51, 0xF5, 0xEC, 0x79, 0x13, 0x7F, 0x4F, 0x16, 0x4D, 0x22, 0xA0, 0x5B, 0xA5, 0x83,
-    0xC9, 0xEB, 0x54, 0x64, 0xF0, 0x26, 0x15, 0xA9, 0xB4, 0x4B, 0x81, 0xE6, 0xD9, 0x6E, 0x52, 0xBB,
-    0xF5, 0x21, 0x29, 0x94, 0xE1, 0xE1, 0x50, 0xC1, 0xA4, 0x2D, 0x17, 0x43, 0xA6, 0x6E, 0x60, 0x18,
-    0xA8, 0x3D, 0xFB, 0x92, 0xF2, 0x3A, 0xE0, 0x74, 0x1A, 0xC7, 0xCA, 0xA8, 0xFA, 0x67, 0x19, 0xC9,
-    0x08, 0x3E, 0x39, 0x2C, 0x4A, 0x91, 0x5D, 0x3C, 0x10, 0xD2, 0xE4, 0x8A, 0x48, 0x91, 0x22, 0xE5,
-    0x07, 0x6D, 0x2F, 0x7D, 0x97, 0x2B, 0x5A, 0xB9, 0xA2, 0xA5, 0x8D, 0x4A, 0x2A, 0x70, 0x45, 0x2C,
-    0x57, 0x04, 0xB7, 0x31, 0x05, 0x30, 0x52, 0xE4, 0xE8, 0xF7, 0xDE, 0x05, 0xFB, 0x0E, 0x66, 0xD8,
-    0xBA, 0x45, 0x26, 0xB7, 0xDD, 0xB0, 0x76, 0x7F, 0x58, 0xFC, 0xA0, 0x1F, 0xB5, 0x7D, 0x4E, 0x03,
-    0x78, 0xC2, 0x1F, 0xE3, 0x5F, 0x4A, 0x26, 0x9B, 0x9A, 0x44, 0x59, 0xFB, 0x32, 0x59, 0x31, 0x66,
-    0x54, 0x64, 0x58, 0xB9, 0xCE, 0x6B, 0xA9, 0xF4, 0x5B, 0xD2, 0xCA, 0x0D, 0x58, 0x10, 0x62, 0x26,
-    0xD5, 0x01, 0x54, 0x33, 0x18, 0x4C, 0xA8, 0x02, 0x9D, 0x26, 0x10, 0x5A, 0x8C, 0x15, 0xAA, 0xA9,
-    0x1E, 0x04, 0x1C, 0xF6, 0xFA, 0x32, 0xB5, 0x76, 0x91, 0xA3, 0xEF, 0xA9, 0x1D, 0xFC, 0x39, 0xF9,
-    0xB4, 0x1F, 0x53, 0xE1, 0xB4, 0x85, 0x65, 0xDC, 0x43, 0xF0, 0x0E, 0xB4, 0xFA, 0x6D, 0x4A, 0x6A,
-    0xF2, 0x99, 0x03, 0x59, 0x0C, 0xD0, 0x53, 0x0B, 0x8C, 0x7D, 0xB0, 0x55, 0x0B, 0x40, 0xA6, 0x95,
-    0xBC, 0xA9, 0x97, 0x29, 0x88, 0xDE, 0x87, 0xB6, 0x0B, 0x2A, 0x9E, 0x9B, 0x78, 0x20, 0x54, 0x6C,
-    0x37, 0xF7, 0x44, 0xAC, 0x55, 0x3D, 0xB8, 0xC3, 0x0E, 0x84, 0x2A, 0x72, 0xD1, 0x65, 0x61, 0xBE,
-    0xE0, 0xDB, 0xBF, 0xB9, 0x08, 0x9C, 0xD2, 0xA9, 0x34, 0x38, 0x99, 0x8E, 0x1D, 0xF7, 0x97, 0x66,
-    0x24, 0x00, 0x69, 0x41, 0x4E, 0x93, 0x8C, 0x7B, 0xAE, 0x1D, 0x94, 0x35, 0x0A, 0xE3, 0x27, 0xFE,
-    0x51, 0xCD, 0x12, 0x50, 0x41, 0x9E, 0x63, 0x5D, 0x7A, 0x43, 0x79, 0xBD, 0x33, 0x0E, 0xCF, 0x51,
-    0x9B, 0x02, 0x69, 0x33, 0x5A, 0xE5, 0xB3, 0x56, 0xD5, 0xE7, 0xD4, 0x92, 0xCC, 0xC0, 0x5D, 0x07,
-    0x60, 0xD9, 0x06, 0xB4, 0x29, 0x87, 0x5E, 0xA6, 0x57, 0x2D, 0x0B, 0x49, 0x4F, 0x9A, 0x95, 0x86,
-    0x26, 0xAA, 0x3C, 0x53, 0x5D, 0x8B, 0x11, 0x74, 0x9C, 0xA8, 0x4C, 0xB8, 0x4A, 0x5F, 0xDA, 0x6A,
-    0x1E, 0xA6, 0x86, 0x8E, 0x56, 0x31, 0x35, 0x30, 0x41, 0xED, 0x28, 0xE2, 0x76, 0x20, 0x6F, 0xF5,
-    0x89, 0x62, 0xB0, 0x9E, 0xC9, 0x12, 0xF6, 0x8E, 0xB5, 0xEA, 0x85, 0xBB, 0xED, 0x76, 0x5E, 0xDA,
-    0x6A, 0x65, 0xC0, 0x57, 0x5B, 0x54, 0xE0, 0x29, 0x4A, 0x90, 0x19, 0x99, 0x75, 0xD0, 0xFE, 0x0B,
-    0x80, 0x25, 0x1D, 0x56, 0xB4, 0x14, 0x2E, 0x49, 0x21, 0xBE, 0x72, 0x65, 0x19, 0xD4, 0x52, 0xD8,
-    0x8E, 0xAE, 0x2C, 0xA3, 0xAA, 0xEB, 0xFD, 0x46, 0x0A, 0xA9, 0xE9, 0x04, 0x27, 0x44, 0x57, 0xDE,
-    0x6E, 0xA5, 0x90, 0x9A, 0xE8, 0x8A, 0xCC, 0x5A, 0x27, 0x6B, 0x31, 0xBA, 0x02, 0x5A, 0x23, 0x24,
-    0x32, 0xBA, 0x22, 0xAF, 0xED, 0x04, 0xA9, 0x47, 0x55, 0xB0, 0xF2, 0x64, 0x8A, 0x68, 0x63, 0x08,
-    0x21, 0xD0, 0x41, 0x00, 0x1A, 0x0E, 0xD9, 0xEA, 0x00, 0xCD, 0xF2, 0xC2, 0xA8, 0x43, 0xCB, 0xA5,
-    0x90, 0x4A, 0x21, 0x7C, 0xEF, 0x8A, 0xA0, 0x2D, 0x29, 0xA4, 0xF2, 0xC2, 0xD9, 0x4A, 0x0A, 0x9D,
-    0x14, 0x92, 0xAC, 0xEB, 0x83, 0x5A, 0x0A, 0xF2, 0xB3, 0x8F, 0x8B, 0xE8, 0xCA, 0x3B, 0x42, 0x2A,
-    0x05, 0x50, 0xA2, 0x2B, 0x22, 0x3E, 0x77, 0xB0, 0x17, 0x5F, 0x19, 0xF0, 0x66, 0x01, 0x86, 0x2B,
-    0xAD, 0xE3, 0x25, 0x00, 0xA4, 0x2F, 0x2E, 0x4D, 0xFC, 0xA6, 0x9C, 0x95, 0xFB, 0xA2, 0x55, 0x9A,
-    0x09, 0xFD, 0x5C, 0x06, 0x8D, 0xFC, 0x13, 0xA4, 0x25, 0xA3, 0x97, 0xCA, 0x7C, 0x45, 0x02, 0x55,
-    0x01, 0x66, 0x6A, 0x90, 0x19, 0x10, 0x56, 0xB8, 0x88, 0x96, 0x61, 0x2D, 0x50, 0x63, 0x8D, 0xDE,
-    0x02, 0x4F, 0x15, 0x93, 0xBE, 0xA9, 0xCB, 0x93, 0x38, 0x8A, 0x44, 0x45, 0xD0, 0x8A, 0xEA, 0x50,
-    0xAF, 0x2F, 0xAC, 0x1A, 0x52, 0xC0, 0x2C, 0xC0, 0xC2, 0x5C, 0x45, 0x90, 0x82, 0x50, 0xE5, 0xB5,
-    0x6A, 0x30, 0x8B, 0xAB, 0x18, 0xF2, 0xD1, 0x36, 0xD4, 0xC1, 0x0D, 0x54, 0xCB, 0x4B, 0x48, 0x1C,
-    0x86, 0x2A, 0x21, 0x8E, 0x0E, 0x51, 0x74, 0x8C, 0x21, 0xCA, 0x65, 0xEC, 0xBC, 0x6E, 0x3D, 0x42,
-    0x01, 0xE4, 0x97, 0xF4, 0x46, 0x0F, 0xE8, 0x2F, 0xC1, 0x6E, 0x0E, 0xA0, 0x1D, 0xF9, 0xFE, 0xFE,
-    0xCA, 0x04, 0xFB, 0x37, 0xA4, 0xEF, 0xD1, 0x7B, 0xE5, 0x56, 0x66, 0x2E, 0x6D, 0xCB, 0x74, 0x04,
-    0x1F, 0xEF, 0x37, 0x32, 0x73, 0x2F, 0xDC, 0xC0, 0xF4, 0xC4, 0xE5, 0x93, 0xF2, 0xEA, 0xED, 0x3E,
-    0x5C, 0x26, 0x4F, 0xEC, 0x37, 0x32, 0x83, 0xB3, 0x1B, 0xCB, 0xF4, 0x1B, 0xCB, 0xB8, 0xCC, 0xB6,
-    0x53, 0xB3, 0xDD, 0x9B, 0xA1, 0xF5, 0xF6, 0x1B, 0xDF, 0x56, 0x52, 0x1D, 0x0C, 0x46, 0xAA, 0x65,
-    0x41, 0x6D, 0x03, 0x0E, 0xBD, 0xD6, 0x8D, 0xDD, 0x8C, 0x1A, 0x13, 0x48, 0x88, 0x30, 0x08, 0xD8,
-    0x23, 0x15, 0xD7, 0x17, 0x17, 0xED, 0xF8, 0x37, 0x1C, 0x7B, 0xC5, 0xE1, 0x8A, 0x8A, 0xCB, 0x58,
-    0x4E, 0xB4, 0x1C, 0x40, 0xE9, 0xDC, 0xBC, 0xAC, 0xE4, 0xBD, 0x31, 0x84, 0xE1, 0x59, 0x23, 0x2B,
-    0x59, 0xF0, 0x6D, 0xE1, 0x0C, 0x58, 0xFD, 0xB1, 0x87, 0x42, 0xA9, 0x88, 0x07, 0x3B, 0x51, 0xD0,
-    0xF1, 0x36, 0x59, 0x5D, 0x90, 0x2E, 0x81, 0x6F, 0xCB, 0xE3, 0xF0, 0x2D, 0xF0, 0x22, 0x10, 0xE3,
-    0x62, 0x00, 0xCA, 0x13, 0x84, 0x16, 0xDD, 0x10, 0x3C, 0xB4, 0x0F, 0xC5, 0xE3, 0x7D, 0x56, 0x14,
-    0xE8, 0x47, 0xF4, 0xBA, 0xF4, 0xBA, 0x2B, 0x6D, 0x17, 0xDD, 0xF8, 0x51, 0x5E, 0x4B, 0x3F, 0xCB,
-    0x17, 0x1B, 0x59, 0x91, 0xD2, 0x80, 0xE8, 0x3D, 0xE8, 0x23, 0x07, 0xB4, 0x44, 0x0A, 0x65, 0x0F,
-    0x12, 0x0C, 0x65, 0xD4, 0x54, 0x83, 0x6B, 0x6E, 0x80, 0x73, 0x93, 0xC9, 0x4E, 0x05, 0x6E, 0xC3,
-    0xD6, 0x0E, 0xCF, 0xD8, 0xE8, 0xC7, 0x02, 0x4E, 0x7D, 0x6C, 0x45, 0xDA, 0x3C, 0x45, 0xDC, 0xAA,
-    0xB2, 0xDA, 0x27, 0x14, 0xA4, 0x19, 0x00, 0x9B, 0x1E, 0xE6, 0x7C, 0x19, 0x80, 0xEF, 0xCC, 0x5A,
-    0x25, 0xA0, 0x18, 0x68, 0x34, 0x12, 0x43, 0xC6, 0x8F, 0x33, 0x34, 0x4F, 0xBF, 0x0B, 0xE5, 0x9D,
-    0x68, 0xD6, 0xA3, 0x17, 0xC4, 0x4B, 0xFF, 0xCB, 0x80, 0x27, 0xC2, 0xB3, 0xDC, 0xC8, 0xC5, 0x4E,
-    0x25, 0xD6, 0x2F, 0x2E, 0xEE, 0x2D, 0x14, 0x8B, 0xF6, 0xEE, 0x11, 0x78, 0xF7, 0xFD, 0x56, 0x38,
-    0xBD, 0x0F, 0x95, 0x56, 0x41, 0x93, 0x16, 0x6A, 0x50, 0xA4, 0x84, 0x4D, 0x33, 0x23, 0x2D, 0x8E,
-    0x54, 0x0B, 0xA7, 0x4E, 0xFA, 0x26, 0x17, 0x45, 0x7D, 0x76, 0x4E, 0x6D, 0xEF, 0x93, 0xB0, 0xD2,
-    0x40, 0x5D, 0x18, 0xBD, 0x05, 0xD5, 0x0B, 0xB5, 0x67, 0x37, 0xE8, 0xC3, 0x03, 0x6B, 0x85, 0x9D,
-    0xA4, 0xC9, 0x7E, 0x54, 0xE1, 0x90, 0x65, 0x22, 0x63, 0x4B, 0xA6, 0x10, 0x3A, 0xF3, 0x12, 0xD7,
-    0x62, 0x62, 0x54, 0x0F, 0x2C, 0x17, 0xBE, 0x7C, 0x32, 0x41, 0x79, 0x7D, 0xE2, 0xD7, 0x76, 0xD5,
-    0xFC, 0xE6, 0x7C, 0x1F, 0x64, 0xA5, 0xDB, 0xEF, 0xFF, 0x93, 0xAD, 0x02, 0x41, 0x94, 0x61, 0x27,
-    0x98, 0xE4, 0x92, 0x29, 0x9F, 0x10, 0x36, 0x29, 0x8B, 0xEA, 0x52, 0x08, 0xA6, 0x27, 0x90, 0x2B,
-    0x4B, 0x3F, 0x15, 0x74, 0x74, 0x49, 0xC8, 0x55, 0x23, 0x27, 0x7C, 0xE0, 0xBA, 0x25, 0xC8, 0x16,
-    0x4E, 0x08, 0x1F, 0x23, 0x27, 0x7E, 0x2A, 0xB4, 0x26, 0x0B, 0x9A, 0x3C, 0x0B, 0xE1, 0x20, 0x57,
-    0xFB, 0x8D, 0x27, 0xF2, 0x74, 0x76, 0x49, 0x7A, 0x15, 0xF7, 0xF9, 0x5F, 0x8F, 0xF6, 0x59, 0x33,
-    0x53, 0x02, 0x73, 0x6A, 0x38, 0x73, 0xE2, 0xE6, 0x1E, 0x38, 0xA1, 0x73, 0x90, 0x54, 0x83, 0x80,
-    0x20, 0xDC, 0x2E, 0x56, 0xB4, 0x1D, 0x05, 0x2D, 0x5D, 0x19, 0x64, 0x4E, 0xA8, 0x87, 0x8D, 0x40,
-    0xBC, 0x62, 0x3A, 0x4E, 0x8D, 0x6E, 0x52, 0x21, 0x0E, 0x79, 0x5E, 0x90, 0x23, 0x15, 0xF2, 0x4B,
-    0x42, 0x05, 0xED, 0xBD, 0x10, 0x30, 0x2B, 0xD3, 0xA5, 0x3E, 0x2B, 0x99, 0x63, 0xDF, 0xD5, 0x42,
-    0xF6, 0x69, 0x1F, 0x30, 0x02, 0x1F, 0x4E, 0x36, 0x45, 0xCE, 0xF4, 0xCE, 0x9D, 0x0E, 0x8F, 0x38,
-    0xC9, 0x00, 0xCB, 0x8F, 0xBE, 0x74, 0xF9, 0xA0, 0xBA, 0x1F, 0x56, 0xC0, 0xF2, 0x08, 0xB3, 0x4A,
-    0x2C, 0xD0, 0x33, 0xBB, 0xD9, 0x41, 0xEF, 0xBC, 0x77, 0xD1, 0x42, 0xCE, 0xA8, 0xB6, 0xEC, 0x5F,
-    0xD5, 0x0E, 0x7A, 0x72, 0x27, 0x1B, 0xCC, 0x0E, 0x57, 0x8C, 0xE3, 0xD9, 0x2B, 0x57, 0xF6, 0xB9,
-    0x7E, 0x29, 0xD2, 0x3D, 0xF4, 0x35, 0x52, 0x8C, 0x46, 0x59, 0x32, 0xAE, 0x28, 0xA1, 0xC3, 0x6A,
-    0x9E, 0x4D, 0x5D, 0x53, 0xBB, 0xCF, 0xE7, 0xB4, 0x36, 0x69, 0x2F, 0x3D, 0xD0, 0x42, 0xA7, 0x8D,
-    0x1A, 0x71, 0x97, 0x83, 0xCF, 0x09, 0x28, 0x83, 0x43, 0xA7, 0x4F, 0x39, 0x6B, 0x1B, 0x7B, 0x96,
-    0x83, 0xAF, 0x39, 0xBD, 0xE8, 0xD7, 0x17, 0x1C, 0x29, 0xEE, 0x2D, 0x32, 0x92, 0x15, 0x61, 0x3E,
-    0x28, 0xFB, 0xF6, 0xE6, 0xB1, 0x0E, 0x17, 0x50, 0x2C, 0x51, 0x23, 0x13, 0x9D, 0xDC, 0xB4, 0x18,
-    0xA1, 0x76, 0x26, 0x17, 0xD0, 0x63, 0x49, 0x7D, 0xCF, 0x2C, 0xDC, 0x00, 0xA7, 0xA6, 0x44, 0xEF,
-    0xD1, 0x32, 0x41, 0x8A, 0xDF, 0xD3, 0xCC, 0x70, 0xFB, 0x48, 0xB5, 0xB5, 0xAF, 0x48, 0x35, 0x5E,
-    0x17, 0xBD, 0x87, 0xA3, 0x54, 0x7B, 0x16, 0x57, 0x7B, 0x3D, 0xAE, 0x0E, 0x5A, 0x5C, 0x2D, 0x5C,
-    0x44, 0x0E, 0xA7, 0xA8, 0xA9, 0x5A, 0xE8, 0x9D, 0xBB, 0x1A, 0x63, 0xD2, 0x43, 0xD4, 0x5E, 0xBB,
-    0x7B, 0xDC, 0xE9, 0x63, 0x17, 0xAF, 0xD0, 0xA7, 0x11, 0xE3, 0x28, 0x24, 0xA3, 0xC3, 0xC3, 0x7A,
-    0x25, 0x48, 0x3B, 0xEE, 0xBB, 0x47, 0x8F, 0xEC, 0xC2, 0x36, 0x2A, 0x18, 0xEC, 0x92, 0x3E, 0x24,
-    0x2A, 0xF5, 0x66, 0x8F, 0xCF, 0xCB, 0xA5, 0x32, 0xC0, 0xC1, 0x01, 0xF6, 0x50, 0xA4, 0x69, 0x88,
-    0xEB, 0xFC, 0xB8, 0x85, 0x33, 0xE8, 0x39, 0xCF, 0xB1, 0x97, 0x71, 0xBD, 0xFD, 0x14, 0x3D, 0x1C,
-    0x32, 0x3C, 0x8B, 0x24, 0x9C, 0xC2, 0x33, 0xC6, 0x16, 0xED, 0x87, 0x2E, 0x57, 0x20, 0xC2, 0x07,
-    0x35, 0xA7, 0x00, 0x38, 0x80, 0x85, 0x92, 0x15, 0xD3, 0x53, 0xC8, 0x78, 0x71, 0x49, 0xF5, 0x2C,
-    0x30, 0x8D, 0xB0, 0x95, 0x7B, 0x25, 0xA8, 0x37, 0x3D, 0x5E, 0xE2, 0x2B, 0x96, 0xDC, 0xCE, 0xA0,
-    0x67, 0x96, 0x94, 0xA3, 0x7A, 0xBC, 0x55, 0x24, 0x22, 0xCA, 0x0A, 0x94, 0x24, 0x73, 0x61, 0xD9,
-    0x84, 0xC4, 0x8B, 0x2C, 0x14, 0xEF, 0x9E, 0x03, 0x33, 0x06, 0xA9, 0xAA, 0x77, 0x48, 0x7C, 0x22,
-    0xF4, 0x46, 0x44, 0xC5, 0x1E, 0xC6, 0x83, 0x65, 0xB9, 0xB7, 0x80, 0xCC, 0x1A, 0xFD, 0x03, 0x64,
-    0x0E, 0x10, 0x97, 0xA9, 0xB0, 0x1C, 0x20, 0x8D, 0x0E, 0x2F, 0x9D, 0x5B, 0x52, 0x7C, 0xDD, 0x82,
-    0x80, 0xDC, 0x53, 0x66, 0x15, 0xDA, 0x53, 0x93, 0x23, 0x14, 0x56, 0x5E, 0x20, 0x47, 0x7E, 0xE8,
-    0x5D, 0x39, 0x25, 0xA4, 0xDF, 0x2E, 0x9C, 0xE4, 0x48, 0xC4, 0xC6, 0xC5, 0x0F, 0x77, 0x1B, 0xBF,
-    0x5E, 0x43, 0xE9, 0xE7, 0x25, 0xA0, 0xC8, 0xDA, 0x12, 0x56, 0x92, 0x2A, 0x2C, 0x69, 0xC7, 0xAF,
-    0x9B, 0x97, 0x37, 0xB8, 0x69, 0x48, 0xBE, 0xF0, 0x5F, 0x15, 0x38, 0x16, 0x9E, 0xEE, 0xF7, 0x2C,
-    0x5D, 0x03, 0x30, 0x49, 0xE8, 0x0A, 0x84, 0x56, 0x08, 0x99, 0xD2, 0x0C, 0xBC, 0x9D, 0xCD, 0x90,
-    0x16, 0xFC, 0xCF, 0xC6, 0x2D, 0x44, 0x52, 0x49, 0x2A, 0x54, 0x40, 0x42, 0xC1, 0x15, 0x14, 0xC9,
-    0xDE, 0x1F, 0x52, 0xE3, 0x02, 0xBE, 0xEA, 0x03, 0x03, 0x91, 0xC1, 0x7B, 0x65, 0xC2, 0xAD, 0x10,
-    0x7F, 0xBD, 0x73, 0x57, 0xE7, 0x5C, 0x72, 0x2B, 0x40, 0x58, 0x6B, 0x4E, 0xE5, 0x2F, 0x9D, 0x75,
-    0x92, 0xB5, 0xFA, 0xB8, 0xED, 0x78, 0xB2, 0x26, 0x13, 0x88, 0xD6, 0xE1, 0x47, 0x72, 0x95, 0x6F,
-    0x3F, 0x98, 0xF5, 0x30, 0xC7, 0xA5, 0x45, 0xB2, 0x52, 0x17, 0x0B, 0xD3, 0xD1, 0x5C, 0x82, 0x67,
-    0x46, 0x15, 0xDD, 0x38, 0x71, 0x7B, 0xA7, 0xDE, 0x49, 0x27, 0xAF, 0x1C, 0x65, 0x79, 0xF5, 0x4F,
-    0xEC, 0x26, 0xCF, 0x3A, 0xCE, 0x15, 0x54, 0x0F, 0x11, 0xD8, 0xE6, 0x80, 0x18, 0x88, 0xCA, 0xC5,
-    0x05, 0xFD, 0x13, 0x14, 0x7D, 0xC9, 0xC3, 0x64, 0x50, 0xBD, 0x6C, 0x2D, 0x00, 0xFF, 0xC2, 0x92,
-    0xF4, 0x1F, 0x4C, 0x7C, 0x99, 0xF0, 0x56, 0x7F, 0x12, 0x1E, 0xC7, 0x97, 0x5D, 0x5F, 0xBC, 0x2C,
-    0x6F, 0xAA, 0xF9, 0x31, 0x27, 0xE4, 0xCB, 0x4E, 0x9D, 0xC5, 0x5A, 0x03, 0x0D, 0x8C, 0x76, 0x9F,
-    0xA2, 0x5B, 0x52, 0xAB, 0x94, 0x09, 0x77, 0x24, 0x8D, 0x4A, 0x58, 0xF0, 0x5E, 0x3E, 0x8D, 0xEE,
-    0x96, 0xB5, 0xD2, 0x6E, 0x3C, 0x92, 0x8E, 0x4B, 0xD2, 0xCF, 0x8F, 0x76, 0x9F, 0xB2, 0x02, 0xFC,
-    0x4D, 0x0C, 0x50, 0x95, 0xC9, 0xFB, 0x62, 0xF4, 0x7E, 0x37, 0xFC, 0x0A, 0xBB, 0xFD, 0xCD, 0x77,
-    0x9A, 0xFE, 0xB8, 0xC3, 0xAF, 0x7F, 0x31, 0xBA, 0xFC, 0xFE, 0xCF, 0xBB, 0x6E, 0xFB, 0x57, 0x4E,
-    0xAD, 0x49, 0x8C, 0xC0, 0x78, 0x06, 0x51, 0xEA, 0xEE, 0x05, 0xE3, 0xC3, 0x57, 0x26, 0x82, 0xC7,
-    0xC3, 0xDA, 0xD5, 0x9F, 0xD8, 0xF7, 0xBE, 0x0F, 0x50, 0x92, 0x3C, 0x6F, 0xEB, 0xA4, 0x5D, 0xC3,
-    0xBE, 0x7A, 0x3E, 0xA9, 0x3F, 0x2F, 0x9E, 0x7F, 0x5D, 0x49, 0x45, 0xEA, 0x10, 0x6B, 0xE7, 0x9C,
-    0xEA, 0x6A, 0xE7, 0x61, 0x57, 0x99, 0xF1, 0xB4, 0xDD, 0x3B, 0x4F, 0xB5, 0x06, 0x56, 0xDA, 0x8C,
-    0x70, 0xDC, 0xA9, 0xC6, 0x23, 0xEC, 0x54, 0xE7, 0x31, 0x6B, 0xFC, 0x46, 0x09, 0x86, 0xEA, 0x3D,
-    0xD2, 0x22, 0x75, 0x74, 0xBF, 0xD3, 0xD3, 0x21, 0xB5, 0x1F, 0x39, 0x44, 0xE0, 0xF4, 0x7A, 0xD9,
-    0xC1, 0x2B, 0x8F, 0x78, 0xBA, 0x50, 0xA7, 0xE2, 0x43, 0x7F, 0x32, 0xC7, 0x6A, 0x32, 0xE4, 0x8A,
-    0x0B, 0x5A, 0xC5, 0xB6, 0x83, 0x03, 0x8C, 0x4F, 0x3C, 0xA9, 0x6E, 0xC3, 0x8E, 0xB6, 0xBE, 0x29,
-    0x02, 0x8D, 0x5D, 0x5C, 0xEC, 0xF4, 0x64, 0x99, 0xF3, 0xCE, 0xE8, 0x06, 0xEF, 0xF4, 0xF7, 0xF5,
-    0xCE, 0x41, 0x4F, 0xA6, 0x7A, 0x12, 0xBA, 0xB2, 0x60, 0xB8, 0x60, 0xDF, 0x51, 0xE9, 0x0B, 0xC8,
-    0x30, 0x25, 0x6A, 0x39, 0xBA, 0xA8, 0x49, 0x10, 0x1B, 0x55, 0x64, 0xC8, 0xA2, 0x9E, 0x1F, 0xB3,
-    0xA8, 0x5F, 0x70, 0x8B, 0xBA, 0x5E, 0x2F, 0xEA, 0xEA, 0xB8, 0x45, 0xBD, 0xA4, 0xC3, 0x04, 0x0D,
-    0x05, 0xEA, 0x47, 0x76, 0xF2, 0x4A, 0x81, 0xCE, 0x97, 0x15, 0x23, 0xE2, 0x99, 0x81, 0xFB, 0x78,
-    0x98, 0xD0, 0x87, 0x37, 0x06, 0xF4, 0xB3, 0x91, 0xF2, 0x17, 0x23, 0xBA, 0x27, 0x4E, 0x84, 0xB6,
-    0xD5, 0xA7, 0xDA, 0xB0, 0x3A, 0x10, 0x3A, 0xF3, 0x59, 0x2A, 0x50, 0xCC, 0x0F, 0xE1, 0xDC, 0x4C,
-    0x1A, 0x9A, 0xD3, 0x7C, 0x8C, 0x35, 0x3D, 0xA3, 0xDF, 0xD5, 0xC3, 0x9B, 0x10, 0xF5, 0x00, 0x8A,
-    0x53, 0x8A, 0x10, 0x7F, 0x51, 0x31, 0x9B, 0x15, 0xCE, 0x6D, 0x90, 0xDC, 0x3E, 0xDD, 0xC8, 0x89,
-    0xD8, 0xA3, 0xEA, 0x60, 0x24, 0x93, 0x73, 0x4A, 0x8C, 0xDE, 0x69, 0x75, 0xAD, 0x40, 0x51, 0x40,
-    0x63, 0xFB, 0x54, 0x91, 0x54, 0x24, 0xB0, 0x24, 0xEB, 0x89, 0x53, 0x20, 0x78, 0x34, 0xD9, 0xA9,
-    0x93, 0xA4, 0x07, 0x65, 0x02, 0x88, 0x3C, 0xC4, 0x22, 0x78, 0x25, 0xF8, 0x2D, 0xC4, 0x19, 0xEB,
-    0x1C, 0xC8, 0x73, 0x70, 0xB6, 0xB0, 0x38, 0x5B, 0x68, 0x72, 0xC0, 0xE3, 0x40, 0x45, 0x27, 0x4F,
-    0x84, 0x67, 0x2F, 0x18, 0x4A, 0x30, 0x2B, 0xF2, 0x98, 0xC1, 0xE4, 0x61, 0x4D, 0xF5, 0x5D, 0xB8,
-    0xCA, 0xB1, 0x9E, 0xD2, 0xAC, 0x0B, 0x5A, 0x30, 0xC5, 0x6D, 0x5C, 0x25, 0xD0, 0x00, 0xC6, 0x6F,
-    0x08, 0x66, 0xA4, 0xC7, 0x52, 0x2A, 0x57, 0x75, 0xEA, 0xFB, 0x91, 0x6E, 0x55, 0x34, 0xFA, 0xFB,
-    0xA0, 0x50, 0x3E, 0xB4, 0x58, 0x18, 0xF9, 0x08, 0x5C, 0x03, 0xF0, 0x96, 0x7A, 0xFF, 0x1D, 0xFE,
-    0x83, 0xB2, 0xBF, 0x32, 0xE1, 0xFB, 0xB4, 0x6D, 0xF9, 0x6D, 0xC7, 0xFE, 0xF4, 0xAA, 0x83, 0x4D,
-    0xBF, 0xA9, 0x1C, 0xFA, 0x1B, 0x2D, 0x91, 0x14, 0x2C, 0x38, 0x3B, 0x86, 0x01, 0x57, 0xD2, 0xF9,
-    0x1D, 0x35, 0x9D, 0x63, 0xD9, 0xCD, 0xA0, 0xF2, 0x89, 0xAB, 0xC0, 0x16, 0xE1, 0x2A, 0x68, 0xBC,
-    0x7D, 0xAC, 0x89, 0x1D, 0x43, 0x2E, 0x2C, 0xAA, 0xBE, 0x13, 0x57, 0x97, 0xE0, 0xEE, 0x10, 0x80,
-    0x42, 0xA5, 0x71, 0xB6, 0x23, 0xFD, 0x09, 0xDF, 0xAB, 0x08, 0x24, 0x56, 0xF8, 0xBD, 0x25, 0x07,
-    0x2A, 0xAD, 0x49, 0x11, 0x68, 0xFC, 0x08, 0x97, 0x6B, 0xAE, 0x7C, 0xE3, 0x48, 0xB3, 0xCD, 0x81,
-    0xE3, 0xD1, 0x6B, 0xC6, 0xE3, 0x55, 0x06, 0x86, 0x90, 0x7B, 0x8D, 0x94, 0x9B, 0xA7, 0x5D, 0x0C,
-    0x9D, 0xA1, 0xF6, 0x39, 0xE8, 0x74, 0xBA, 0x78, 0x7D, 0xBF, 0x3E, 0x7A, 0x3C, 0x92, 0x85, 0x33,
-    0x33, 0x5E, 0x89, 0x18, 0x84, 0x91, 0xB1, 0xB7, 0x70, 0x5C, 0x9C, 0xB0, 0xB1, 0x5A, 0x0A, 0xF3,
-    0x83, 0x45, 0x06, 0x47, 0xD0, 0xF9, 0xC5, 0x9C, 0xBE, 0xB0, 0xB7, 0x38, 0x7A, 0xC1, 0x81, 0xA2,
-    0x85, 0xDF, 0x02, 0x4D, 0x6D, 0xF4, 0x77, 0xA6, 0xAB, 0xDD, 0x72, 0x36, 0x86, 0x9C, 0x84, 0x54,
-    0x0F, 0xD3, 0x54, 0x4F, 0x7F, 0x0F, 0x28, 0x7A, 0x17, 0x17, 0x6C, 0xA1, 0x86, 0xC4, 0x9C, 0xE1,
-    0x4A, 0x2E, 0x56, 0x89, 0x11, 0x46, 0x76, 0x77, 0x0C, 0xCF, 0x00, 0x58, 0x5A, 0x75, 0x1D, 0x16,
-    0xE1, 0xFB, 0xF4, 0x4F, 0x3A, 0x75, 0xF4, 0x80, 0x87, 0x99, 0x63, 0x3E, 0xE9, 0x85, 0x93, 0xAB,
-    0x71, 0x0B, 0xC3, 0xB0, 0xD2, 0x96, 0x39, 0x47, 0x15, 0x35, 0x87, 0xE5, 0xF3, 0x73, 0xB7, 0xE6,
-    0xF3, 0x33, 0x9E, 0xD2, 0x8A, 0xA5, 0x8B, 0x30, 0xC9, 0xE2, 0xEB, 0x17, 0xFA, 0xF9, 0xFC, 0x2C,
-    0x74, 0xD9, 0xCE, 0xC3, 0x65, 0x74, 0xCF, 0x29, 0xF5, 0xEE, 0xD1, 0xB9, 0x66, 0x7C, 0x38, 0x1D,
-    0x75, 0xF0, 0x6E, 0xE7, 0xC0, 0x9D, 0x38, 0x43, 0x61, 0x2A, 0xD0, 0xF8, 0xFB, 0xC0, 0xF1, 0x22,
-    0x6D, 0x20, 0x5A, 0x05, 0xFC, 0x34, 0x1D, 0x12, 0xC6, 0x9E, 0xCD, 0x33, 0xF7, 0xD5, 0xE3, 0x24,
-    0x31, 0xA4, 0x25, 0x7A, 0x7C, 0xE9, 0xB5, 0x9E, 0x3D, 0xA1, 0xB9, 0x48, 0xED, 0x45, 0x64, 0x14,
-    0x78, 0xA4, 0x98, 0x63, 0x17, 0x8B, 0xF3, 0x1A, 0x0F, 0xA3, 0x47, 0x0E, 0xA8, 0x3B, 0x3B, 0x5D,
-    0x59, 0xAC, 0x9F, 0x20, 0x4F, 0x7B, 0x08, 0x4F, 0xFE, 0xCB, 0x4B, 0x7C, 0x4B, 0xDF, 0x3B, 0x0D,
-    0xA3, 0x4A, 0x2A, 0xBE, 0x4A, 0x95, 0xF4, 0x54, 0x35, 0x91, 0x72, 0x67, 0x6A, 0x52, 0x4E, 0xD8,
-    0xE7, 0xE0, 0x67, 0xBC, 0x34, 0x27, 0xA7, 0x08, 0x02, 0x82, 0x7E, 0x73, 0xA2, 0x93, 0x42, 0xD9,
-    0x73, 0x52, 0xBD, 0x72, 0x8E, 0x15, 0x1A, 0x51, 0x46, 0xF2, 0x34, 0x0C, 0x2A, 0xFD, 0x68, 0x28,
-    0x81, 0x76, 0xD2, 0xAF, 0xC1, 0x6D, 0x84, 0xFE, 0xF6, 0xD1, 0x32, 0xCD, 0x06, 0xB9, 0x3F, 0x68,
-    0x88, 0x76, 0x85, 0xCE, 0x64, 0xB3, 0x9A, 0x7E, 0x25, 0x25, 0x79, 0x21, 0xB2, 0x45, 0x10, 0x77,
-    0x50, 0xAF, 0x68, 0xF9, 0x05, 0xAC, 0x43, 0x5F, 0xC8, 0x78, 0xD0, 0x4C, 0x92, 0xAF, 0x86, 0x9D,
-    0x19, 0xB5, 0x16, 0xD2, 0x02, 0x78, 0x93, 0xE3, 0x1E, 0xC3, 0x49, 0x75, 0x89, 0x73, 0x1D, 0x10,
-    0x48, 0x02, 0x4E, 0x24, 0xD8, 0xBB, 0xA0, 0x4E, 0x3C, 0x95, 0xF2, 0x30, 0x5E, 0x97, 0x7E, 0x63,
-    0x65, 0x92, 0xE7, 0x6B, 0x38, 0x9A, 0xA6, 0x82, 0x35, 0xCA, 0xA0, 0x86, 0x5D, 0x51, 0x64, 0x74,
-    0x18, 0x2B, 0xC2, 0x1A, 0xFC, 0x8B, 0xAC, 0xE8, 0xA0, 0xF6, 0xDB, 0x1D, 0x19, 0x53, 0x5A, 0x25,
-    0x48, 0xF8, 0x73, 0xE7, 0x59, 0xC4, 0xF8, 0xA0, 0x95, 0x7E, 0x5B, 0x75, 0x6E, 0xF0, 0xF6, 0xD4,
-    0x19, 0x9C, 0x2E, 0x33, 0xF4, 0xD2, 0xE8, 0x8D, 0xDA, 0xFF, 0x77, 0x9C, 0x93, 0x78, 0xCE, 0xEF,
-    0xB8, 0x52, 0x47, 0xA0, 0x14, 0xCE, 0xCF, 0xF9, 0x7C, 0x5E, 0xBE, 0xB4, 0xB5, 0x74, 0xEE, 0x01,
-    0xF5, 0xFA, 0x7B, 0x71, 0x61, 0x28, 0x3F, 0x6A, 0xD5, 0xC3, 0xE8, 0xBB, 0xB0, 0x80, 0x88, 0x2C,
-    0x53, 0xF4, 0xF4, 0x4B, 0x8D, 0x0B, 0x38, 0xAD, 0x46, 0xCB, 0xB8, 0xC8, 0x33, 0x58, 0x46, 0xE2,
-    0x02, 0xD8, 0x37, 0xCD, 0xE0, 0x6B, 0x03, 0x17, 0xCA, 0xB8, 0x88, 0x04, 0xAD, 0x22, 0x04, 0x2C,
-    0xAC, 0x73, 0x98, 0x4D, 0x8A, 0x59, 0x03, 0xE2, 0x18, 0x17, 0x41, 0x47, 0xF7, 0xCB, 0xC2, 0xEB,
-    0x04, 0x01, 0x83, 0x83, 0x1B, 0xD6, 0xA2, 0x3C, 0xC6, 0x66, 0xA9, 0xB8, 0x5C, 0x98, 0x85, 0x1D,
-    0xD5, 0x55, 0x28, 0xF7, 0xF6, 0x53, 0x8E, 0x7A, 0x4A, 0xC6, 0x90, 0x46, 0xBC, 0x9E, 0x6F, 0x0F,
-    0x86, 0x45, 0xB9, 0x28, 0x89, 0x38, 0x64, 0xC6, 0x53, 0xF5, 0x65, 0x10, 0x2E, 0x27, 0x7A, 0x13,
-    0x6C, 0x45, 0x93, 0xCE, 0x84, 0xC3, 0x88, 0xAB, 0x8E, 0xF3, 0x1D, 0xD4, 0x49, 0x01, 0xDB, 0x44,
-    0x95, 0x06, 0x0D, 0xA6, 0x64, 0x00, 0x14, 0x75, 0x32, 0x0F, 0x5F, 0x97, 0x41, 0x16, 0xB2, 0x20,
-    0x13, 0x5F, 0x85, 0x34, 0x16, 0x40, 0x4D, 0xA0, 0xAA, 0x9A, 0x54, 0xD5, 0x21, 0x32, 0x44, 0x73,
-    0x81, 0xCC, 0x52, 0x85, 0x3F, 0xAB, 0xCC, 0xC6, 0x30, 0x0A, 0xE7, 0x00, 0x07, 0xE9, 0xE3, 0x40,
-    0x90, 0xE4, 0x32, 0x77, 0xAE, 0x91, 0x2A, 0xC7, 0xF8, 0xCA, 0xEB, 0xE6, 0x44, 0x92, 0xB3, 0xE1,
-    0xDC, 0x55, 0x68, 0x93, 0x2B, 0x9A, 0x8F, 0xC0, 0x34, 0x08, 0x7B, 0x26, 0x6F, 0xF7, 0x3A, 0x4A,
-    0xB7, 0x5A, 0xC8, 0xE8, 0xA8, 0xD6, 0xCB, 0x5B, 0x1C, 0x4B, 0xA0, 0x24, 0x2B, 0x54, 0x10, 0x4C,
-    0xC1, 0x14, 0x43, 0x68, 0x07, 0x24, 0xBE, 0x4B, 0x8C, 0x4B, 0xBF, 0xB4, 0x31, 0x64, 0x4D, 0xB1,
-    0xC8, 0x52, 0xA3, 0x43, 0xD0, 0xAA, 0x1D, 0xE7, 0x01, 0x6F, 0x28, 0xEE, 0xBB, 0x88, 0x13, 0xF5,
-    0x4E, 0xF5, 0xD9, 0xB4, 0x84, 0x62, 0x7E, 0x79, 0x63, 0x1F, 0x8A, 0x46, 0xA1, 0x87, 0x59, 0xD0,
-    0x86, 0xAB, 0x44, 0x58, 0x92, 0x70, 0x25, 0x43, 0xB2, 0xC2, 0x3F, 0xB9, 0x75, 0x05, 0x51, 0x16,
-    0xD4, 0x47, 0x18, 0xB7, 0x95, 0x50, 0x1B, 0xF0, 0x9A, 0xDD, 0x0E, 0x8E, 0x43, 0x4E, 0x35, 0xB4,
-    0x95, 0xF5, 0xA8, 0x98, 0xAC, 0x5A, 0x57, 0x20, 0x6C, 0x65, 0x9E, 0x17, 0x8A, 0xAA, 0x88, 0x63,
-    0x65, 0x84, 0x68, 0x4F, 0xC3, 0x24, 0x97, 0xCE, 0x89, 0x83, 0x1E, 0x6C, 0x1C, 0x08, 0x22, 0x6F,
-    0xD2, 0xF6, 0xDC, 0xA8, 0x34, 0x3C, 0x13, 0x0C, 0xF9, 0x0C, 0x01, 0xDC, 0x5A, 0xA7, 0xC1, 0x75,
-    0x5A, 0xAA, 0x5C, 0x58, 0xEB, 0xBF, 0xBE, 0x55, 0x2E, 0xB9, 0x88, 0x73, 0xFA, 0x51, 0xC3, 0xDE,
-    0xC7, 0x55, 0x3D, 0xD0, 0x62, 0x97, 0x6B, 0x34, 0x4D, 0xE7, 0x42, 0x31, 0x01, 0xFF, 0xF4, 0x4E,
-    0xDE, 0xC1, 0x55, 0xBC, 0x3C, 0xE7, 0xD1, 0x08, 0x10, 0x30, 0xD8, 0xCC, 0x6F, 0x73, 0x8E, 0x2E,
-    0xFC, 0x56, 0xB5, 0x51, 0xBD, 0x4A, 0xF1, 0x8A, 0xBF, 0x95, 0x65, 0x42, 0x43, 0x04, 0xA6, 0xD8,
-    0x45, 0x01, 0x33, 0x0E, 0x34, 0x71, 0x1D, 0x50, 0x89, 0x3C, 0x37, 0x29, 0x68, 0x4F, 0x4D, 0x2A,
-    0xEA, 0xD9, 0x12, 0x0A, 0x31, 0xE0, 0x1C, 0x52, 0x98, 0x62, 0x3E, 0x50, 0x68, 0xB5, 0x2B, 0x40,
-    0x1A, 0x86, 0x5C, 0x56, 0xD4, 0xD7, 0x1A, 0x78, 0xB6, 0xA5, 0xD9, 0x25, 0xBF, 0x05, 0xBC, 0x26,
-    0x99, 0x80, 0xA8, 0xC0, 0x80, 0x70, 0x86, 0x02, 0xB0, 0xBE, 0xC0, 0x04, 0x70, 0xD7, 0x25, 0x30,
-    0x0B, 0x50, 0x55, 0x87, 0xEF, 0x37, 0x39, 0x74, 0xD5, 0x5D, 0x9F, 0x50, 0x59, 0x9D, 0x05, 0x2B,
-    0xB8, 0xC1, 0xD5, 0xE1, 0x80, 0xF8, 0x99, 0xCC, 0xCC, 0xF6, 0xC9, 0x80, 0x32, 0xBE, 0xB6, 0x00,
-    0xA1, 0x5C, 0x45, 0xF6, 0xBA, 0x48, 0xAF, 0xE7, 0x4D, 0xBA, 0xFA, 0xCD, 0x31, 0x0E, 0x20, 0xDB,
-    0x8C, 0x03, 0x20, 0x40, 0x00, 0x7E, 0xE3, 0xDA, 0xCC, 0x9F, 0x19, 0x28, 0xBC, 0x0A, 0x54, 0x88,
-    0xD0, 0xF1, 0xEC, 0x05, 0x62, 0x37, 0x3A, 0xE6, 0x91, 0x06, 0xD1, 0x81, 0xA3, 0x1C, 0xFD, 0x39,
-    0xD4, 0x93, 0x02, 0x4A, 0x91, 0x5E, 0x7D, 0x44, 0x9F, 0xBA, 0x68, 0x49, 0x36, 0x43, 0xD2, 0xDA,
-    0xAB, 0x99, 0x52, 0x28, 0x8D, 0x52, 0xE0, 0x7B, 0xAF, 0x5F, 0xB4, 0xE7, 0xAD, 0x8B, 0xF9, 0xB5,
-    0x70, 0x75, 0xF8, 0x97, 0x0A, 0xB9, 0xE7, 0x05, 0x4C, 0x2F, 0x09, 0x06, 0x88, 0x56, 0xC3, 0x19,
-    0xB2, 0x95, 0xF1, 0x00, 0x04, 0x4E, 0x07, 0xD7, 0x02, 0xE6, 0xD4, 0x31, 0xA4, 0xD7, 0x71, 0x94,
-    0xBE, 0xDA, 0x56, 0x23, 0x79, 0x4D, 0xA0, 0x76, 0xAA, 0xD1, 0x6D, 0x00, 0xCB, 0xD1, 0x6F, 0x9D,
-    0xA8, 0xE4, 0x44, 0xF5, 0xA7, 0xCA, 0x95, 0xCC, 0x16, 0x3E, 0x45, 0x74, 0xEB, 0x0C, 0x04, 0x48,
-    0xBD, 0x84, 0xAE, 0x0C, 0xA3, 0xB6, 0xEE, 0xF4, 0xE2, 0x07, 0x7F, 0xCA, 0xC6, 0x6C, 0x53, 0x00,
-    0xDD, 0x82, 0x49, 0x39, 0xFA, 0x31, 0x5D, 0x2C, 0x7F, 0xCE, 0x20, 0xC2, 0x9E, 0xE0, 0x7A, 0xB2,
-    0x13, 0xB7, 0x3A, 0x7A, 0x3F, 0x82, 0x80, 0x08, 0x3A, 0x42, 0x30, 0x63, 0x4A, 0x1C, 0x1A, 0x2F,
-    0xD3, 0x0A, 0x41, 0x8A, 0xB3, 0x5E, 0x44, 0x00, 0x45, 0xB6, 0x8D, 0xC6, 0xB9, 0x8A, 0x18, 0xA5,
-    0x3E, 0x02, 0xCA, 0xBE, 0x38, 0xEB, 0x62, 0x3E, 0x79, 0xBD, 0x1C, 0x7B, 0xE2, 0xF4, 0xF9, 0x75,
-    0xCC, 0xD9, 0x49, 0x8F, 0x58, 0xB9, 0xB2, 0x8A, 0xCD, 0xB8, 0x8A, 0xA5, 0x95, 0x5C, 0xCB, 0x1B,
-    0xC7, 0xFE, 0xC8, 0xF1, 0xD2, 0xC6, 0xB1, 0x07, 0x06, 0x70, 0xC7, 0x0E, 0x6E, 0xFD, 0x5E, 0x97,
-    0x00, 0x33, 0xB4, 0x11, 0x70, 0x45, 0x1D, 0x02, 0x7B, 0x08, 0x78, 0x5F, 0xDC, 0x17, 0x28, 0x52,
-    0xE5, 0xFF, 0x63, 0xCA, 0x6F, 0xC4, 0xAB, 0x7B, 0x6F, 0xED, 0xDA, 0x5F, 0xFD, 0x03, 0xE3, 0xFC,
-    0x1D, 0x7C, 0x3E, 0xD4, 0x07, 0x8B, 0x5F, 0xC3, 0x5F, 0xDD, 0x1F, 0xA8, 0x0C, 0x4B, 0x2B, 0x8D,
-    0xCB, 0x21, 0xA0, 0x95, 0x84, 0xB9, 0xF8, 0x5D, 0xC0, 0x4D, 0xB0, 0xA7, 0x74, 0x5A, 0x1D, 0x9D,
-    0x6F, 0x6C, 0xC4, 0x38, 0xB9, 0x80, 0x27, 0x77, 0x82, 0xAC, 0xC5, 0x6D, 0x3A, 0x3A, 0xB7, 0xE4,
-    0x40, 0x7A, 0x7D, 0x54, 0xA8, 0xAA, 0x3F, 0xCB, 0x08, 0x9B, 0x98, 0xDA, 0x1A, 0xF8, 0xAB, 0x0B,
-    0x43, 0x9D, 0x0C, 0xE0, 0x79, 0x3D, 0x9D, 0xBE, 0x99, 0x06, 0x5A, 0xAA, 0x0A, 0xD0, 0xA3, 0x9E,
-    0x91, 0xCB, 0x08, 0x2C, 0xF8, 0x4B, 0xE5, 0x52, 0x3A, 0x9F, 0x02, 0xAF, 0xD1, 0x87, 0x9E, 0xCE,
-    0xF1, 0x88, 0xC8, 0x0B, 0x6E, 0x0B, 0xFA, 0xB8, 0xC8, 0x36, 0x81, 0xE3, 0x86, 0x2A, 0x20, 0xD8,
-    0x03, 0xAE, 0x86, 0x43, 0x3D, 0x1C, 0x64, 0x89, 0xF0, 0x45, 0xF4, 0x2D, 0x10, 0xB8, 0x7A, 0x75,
-    0x8B, 0xE1, 0x6F, 0xD0, 0x16, 0xAF, 0xD4, 0x51, 0x88, 0xFA, 0x80, 0xF2, 0x22, 0x15, 0x82, 0x37,
-    0xA9, 0x36, 0x83, 0xAA, 0x41, 0xC3, 0x49, 0x0C, 0x31, 0x90, 0x0B, 0xF2, 0x02, 0x4E, 0xAB, 0x18,
-    0x80, 0xA4, 0xDA, 0xAF, 0xD2, 0x71, 0x02, 0x8C, 0x3C, 0x22, 0x1F, 0xEE, 0xDC, 0xEB, 0xA0, 0xB7,
-    0x31, 0xEA, 0x2E, 0xE4, 0x22, 0xB4, 0x21, 0xF3, 0x33, 0x9A, 0x50, 0x25, 0x49, 0x0A, 0x74, 0xD1,
-    0xDB, 0x8C, 0x01, 0x68, 0xF9, 0xFE, 0x5C, 0x35, 0x7B, 0x1C, 0x40, 0x5F, 0x39, 0xCB, 0x5C, 0xBD,
-    0xA1, 0x39, 0xF0, 0xBE, 0xA3, 0xF1, 0xE6, 0x21, 0x2C, 0x47, 0xF8, 0xC9, 0xCB, 0xD8, 0x81, 0xE1,
-    0xFC, 0x47, 0xA8, 0xF4, 0x18, 0x99, 0x0B, 0x72, 0x27, 0xB8, 0x8C, 0xF1, 0xC4, 0x01, 0x99, 0xE4,
-    0x01, 0x9E, 0x2B, 0x34, 0xD2, 0x07, 0xCA, 0xA4, 0x33, 0x32, 0xAA, 0xEA, 0x5C, 0x54, 0xA0, 0x81,
-    0x90, 0x23, 0x62, 0x38, 0x0C, 0x96, 0x9C, 0xB2, 0xBC, 0x1D, 0x19, 0x47, 0x4A, 0xC3, 0xDE, 0xAB,
-    0x50, 0x4A, 0x70, 0xD1, 0xA1, 0xEF, 0x44, 0x5B, 0x3B, 0xEA, 0x51, 0xB4, 0x64, 0x6B, 0x5F, 0x0B,
-    0xE8, 0xD8, 0x76, 0x50, 0x46, 0x57, 0x0E, 0xCB, 0x24, 0x1F, 0x11, 0xAF, 0x75, 0x34, 0x8B, 0x5A,
-    0xDC, 0xCB, 0x28, 0x1A, 0x43, 0xAA, 0x8C, 0x01, 0xD4, 0x60, 0x32, 0x95, 0x1D, 0x9C, 0x5E, 0x31,
-    0xA1, 0x94, 0x07, 0xEF, 0x45, 0x46, 0xB9, 0x30, 0x7A, 0xB3, 0x72, 0xA1, 0x76, 0xA5, 0x71, 0x81,
-    0x2F, 0x52, 0x45, 0x04, 0xD6, 0x10, 0x71, 0x0E, 0x14, 0x16, 0xD9, 0x27, 0xD7, 0x29, 0xED, 0x95,
-    0x89, 0xAF, 0x50, 0x49, 0xBA, 0xCF, 0xF5, 0x5E, 0x92, 0xF1, 0xA5, 0x85, 0x4F, 0xDD, 0x0C, 0xA8,
-    0x78, 0x36, 0x5F, 0x2E, 0x16, 0xA3, 0x77, 0x3B, 0x35, 0x04, 0xB3, 0x15, 0x9E, 0x7F, 0x49, 0x13,
-    0x4E, 0x3C, 0x0E, 0xE5, 0xC3, 0x46, 0xCE, 0x89, 0xCF, 0x73, 0xE4, 0x37, 0xFF, 0xFC, 0xB5, 0x6B,
-    0x61, 0xE2, 0x72, 0x12, 0xA8, 0x12, 0x70, 0xB4, 0x25, 0xD9, 0x6C, 0xBC, 0x07, 0x8A, 0x54, 0xE5,
-    0xFE, 0x29, 0xC5, 0xB8, 0x18, 0x38, 0xAA, 0x59, 0xF5, 0xBE, 0x94, 0xD6, 0xBD, 0xC9, 0xC7, 0x20,
-    0x68, 0xE9, 0x82, 0x90, 0x1B, 0xE7, 0x9E, 0x1F, 0xB4, 0x4A, 0x95, 0x98, 0xC6, 0x40, 0x8B, 0xF0,
-    0x67, 0x71, 0x45, 0xBA, 0x3E, 0x95, 0xC4, 0x9E, 0x00, 0xF6, 0x4A, 0x6B, 0x19, 0x10, 0xE8, 0x88,
-    0x59, 0x4F, 0x8F, 0x1E, 0xA3, 0xEA, 0x97, 0x9C, 0xE8, 0x15, 0x2A, 0x28, 0x99, 0x60, 0xA7, 0x76,
-    0x4F, 0x0B, 0xF5, 0x24, 0x44, 0x3C, 0xFA, 0xEB, 0x2A, 0x91, 0x41, 0xA5, 0xF8, 0x0F, 0x1A, 0x49,
-    0x29, 0xED, 0x85, 0x84, 0x8F, 0x5E, 0x48, 0x43, 0x83, 0xDB, 0xD0, 0xE1, 0xD1, 0xD9, 0x2F, 0xD8,
-    0x5F, 0x32, 0xDE, 0x9E, 0xAE, 0x21, 0x95, 0xF3, 0xDB, 0x82, 0xAF, 0x22, 0x4D, 0x21, 0xD9, 0xE8,
-    0x08, 0xA9, 0xEE, 0x70, 0xE5, 0x01, 0x9F, 0x9B, 0x4D, 0xD1, 0xD3, 0x8D, 0x67, 0x7B, 0x30, 0xBA,
-    0xCD, 0x29, 0x18, 0x26, 0x34, 0xF9, 0x1F, 0x6D, 0xB5, 0xF6, 0x0F, 0x5B, 0xAB, 0xDE, 0x9A, 0x11,
-    0x23, 0x8D, 0x19, 0x48, 0x56, 0xA0, 0xF6, 0x7E, 0xE7, 0x3B, 0xC7, 0x49, 0x81, 0xC7, 0xE1, 0x29,
-    0x9B, 0xC1, 0x99, 0xA4, 0x26, 0x9A, 0xA2, 0x72, 0x2A, 0x9D, 0x34, 0x54, 0xB9, 0x0B, 0x84, 0x48,
-    0x30, 0x6E, 0x4E, 0x68, 0x02, 0xA2, 0x6A, 0xC8, 0x9D, 0x0E, 0x0C, 0x86, 0xC4, 0xB0, 0xF5, 0x46,
-    0x43, 0xBB, 0x7A, 0x57, 0x1A, 0x3C, 0xCD, 0xE7, 0xD0, 0x12, 0x44, 0x77, 0xB8, 0x16, 0xA0, 0xC9,
-    0x52, 0x07, 0xF2, 0x84, 0x32, 0x15, 0x07, 0xF1, 0x2D, 0x3C, 0x9B, 0x9A, 0xD1, 0x2B, 0xFC, 0x92,
-    0x57, 0x43, 0xBB, 0x35, 0x93, 0x56, 0xA9, 0x8A, 0xCB, 0x23, 0xC8, 0x10, 0x56, 0x88, 0xFA, 0x54,
-    0x6C, 0x38, 0x7B, 0x60, 0xA0, 0xD6, 0xE3, 0xB4, 0x56, 0xC2, 0xAC, 0x47, 0x69, 0xE2, 0xDF, 0x5C,
-    0x58, 0x86, 0xFC, 0xFD, 0xBD, 0x1D, 0x81, 0xB3, 0x9C, 0x1E, 0x52, 0xAE, 0x36, 0x9F, 0xA5, 0xF8,
-    0xEB, 0x34, 0xA1, 0xD8, 0x57, 0xDD, 0x75, 0xEA, 0x7C, 0x8C, 0xBF, 0xD9, 0xE5, 0xD2, 0xFC, 0xD5,
-    0x17, 0xB3, 0xA4, 0x56, 0xE6, 0x67, 0x19, 0x2B, 0x97, 0xA3, 0xC1, 0x4F, 0x4F, 0xB2, 0x09, 0x96,
-    0x60, 0xEC, 0x02, 0xB0, 0x35, 0x3A, 0x4A, 0x31, 0xBB, 0x32, 0x84, 0x68, 0xBD, 0x4A, 0x0A, 0xEE,
-    0xD4, 0xBB, 0xAA, 0xB9, 0x38, 0xA7, 0x77, 0x11, 0x69, 0x45, 0xB5, 0x46, 0x9A, 0x3C, 0x37, 0x28,
-    0x20, 0xD3, 0x65, 0x6D, 0x25, 0x5F, 0x67, 0x84, 0xF4, 0xCD, 0x86, 0xA8, 0xCD, 0x6B, 0xE5, 0x88,
-    0xCD, 0xC8, 0x46, 0x08, 0xDB, 0xD7, 0xAE, 0x1B, 0xEF, 0x32, 0x1A, 0x1C, 0x4E, 0xBC, 0x40, 0xA5,
-    0x95, 0x30, 0x87, 0xEA, 0x43, 0x58, 0x79, 0x42, 0x7D, 0x3A, 0x63, 0x67, 0xAB, 0xBC, 0xB2, 0x54,
-    0x51, 0x42, 0x53, 0xC8, 0xC5, 0x07, 0x75, 0x63, 0x70, 0x1B, 0x17, 0x0F, 0x44, 0x87, 0x70, 0x0B,
-    0x85, 0xFE, 0x5A, 0xC9, 0x94, 0x8A, 0x11, 0x39, 0xA8, 0x47, 0xF2, 0x06, 0xD4, 0x74, 0xCB, 0xF4,
-    0xF5, 0x2E, 0xA6, 0x14, 0x55, 0x63, 0xA8, 0x60, 0xD0, 0x87, 0xB5, 0x36, 0x18, 0x36, 0xC2, 0x45,
-    0x9E, 0x9D, 0xC4, 0x95, 0x66, 0x32, 0xE5, 0xD0, 0x40, 0xE6, 0x35, 0xA7, 0x35, 0x38, 0x66, 0xF6,
-    0xFA, 0xCB, 0xDF, 0x3A, 0x34, 0x6D, 0xC9, 0x38, 0x6B, 0xF1, 0xD8, 0x8D, 0xBF, 0x1B, 0x2B, 0xC6,
-    0x59, 0xFC, 0xA3, 0x83, 0xDD, 0x84, 0x53, 0x13, 0x5D, 0xD9, 0x34, 0x7F, 0x4D, 0x21, 0x2C, 0x65,
-    0x59, 0xC5, 0x1F, 0x81, 0x29, 0xC9, 0x7E, 0xC5, 0x7C, 0x55, 0xB0, 0xA8, 0x7A, 0xAB, 0x63, 0xBD,
-    0xEB, 0x23, 0x06, 0xD5, 0xCA, 0x8C, 0x62, 0xDC, 0x38, 0x10, 0x68, 0xC6, 0x4F, 0x1C, 0x70, 0x25,
-    0x6F, 0x39, 0x88, 0xCA, 0x5D, 0x83, 0xBC, 0xCE, 0x2D, 0x5A, 0xA7, 0xA1, 0xC0, 0x90, 0xC9, 0x25,
-    0xA7, 0x32, 0x77, 0x49, 0xEE, 0x2E, 0xA1, 0x8B, 0x2F, 0x82, 0x0F, 0x28, 0xE0, 0xBC, 0xD9, 0xE8,
-    0x34, 0x0C, 0x91, 0x4A, 0xF0, 0x14, 0x13, 0x68, 0x52, 0xAD, 0xA8, 0x1D, 0x06, 0x2B, 0x5B, 0x16,
-    0x5C, 0x14, 0xB5, 0xE0, 0x0A, 0xDF, 0x2E, 0x3D, 0x5B, 0x78, 0x76, 0xCF, 0xDA, 0x3D, 0xA1, 0x07,
-    0x9E, 0x06, 0x43, 0x17, 0x98, 0xC0, 0xF3, 0xBA, 0x1E, 0xE4, 0x7D, 0xDE, 0x81, 0xF4, 0x14, 0xE5,
-    0xD2, 0x0D, 0x2D, 0x95, 0x69, 0xB3, 0xAB, 0x25, 0xF1, 0xC1, 0x6B, 0x86, 0xA1, 0x94, 0xA7, 0x9F,
-    0xAC, 0xD5, 0x1E, 0x9B, 0xEB, 0x54, 0x78, 0xAE, 0xE9, 0xA1, 0xFB, 0xE9, 0xFA, 0xF8, 0x43, 0x47,
-    0x3C, 0x0E, 0x0C, 0xEB, 0x1F, 0xC8, 0xED, 0x67, 0xE8, 0x1D, 0x15, 0xD3, 0xA0, 0x08, 0x99, 0xAF,
-    0x8A, 0x76, 0xFF, 0xB3, 0xF9, 0xD5, 0xA7, 0x06, 0xD5, 0x4B, 0xD1, 0x39, 0x45, 0x1D, 0xA4, 0x37,
-    0x47, 0xC8, 0x01, 0x3E, 0xCD, 0x1D, 0x78, 0x17, 0x80, 0x08, 0x1C, 0xCC, 0x40, 0xAA, 0x8B, 0x9F,
-    0x0C, 0x3E, 0xD5, 0xE8, 0xE8, 0xE8, 0x9A, 0xC6, 0x75, 0xF7, 0x6A, 0xF8, 0x4B, 0xDE, 0xEC, 0xB0,
-    0xAA, 0x05, 0xD3, 0xD7, 0x58, 0xA2, 0xD6, 0x94, 0xD2, 0xA1, 0xAB, 0xA5, 0xF0, 0x61, 0xB6, 0x56,
-    0x99, 0xB0, 0xF5, 0x81, 0x21, 0x30, 0x06, 0x07, 0x23, 0xAB, 0xC6, 0xF0, 0x86, 0xD0, 0x2A, 0x7B,
-    0x66, 0xBE, 0x3A, 0x33, 0x7F, 0x4B, 0x5C, 0x6A, 0x7E, 0xD3, 0x33, 0x47, 0xFF, 0x5C, 0x14, 0xFE,
-    0x31, 0xAA, 0xE9, 0xB1, 0xC2, 0xA9, 0xA6, 0x27, 0x5D, 0x35, 0xA8, 0x81, 0x19, 0x9D, 0x8B, 0x35,
-    0x2A, 0x7F, 0x20, 0x52, 0xF6, 0x01, 0x46, 0xC0, 0x59, 0x24, 0x32, 0x69, 0xED, 0x5C, 0x77, 0x98,
-    0x7D, 0x4A, 0x5E, 0x81, 0x66, 0xC3, 0x83, 0x1C, 0x7C, 0x53, 0x29, 0x4F, 0x44, 0xCA, 0x09, 0xC6,
-    0xDB, 0x42, 0x29, 0xDC, 0x53, 0x58, 0x2E, 0xF1, 0xDC, 0x12, 0xE2, 0x2A, 0x19, 0xB7, 0xA8, 0x82,
-    0x84, 0x29, 0xB8, 0xA0, 0xF3, 0x21, 0x5A, 0x0B, 0xDB, 0x9D, 0x45, 0x4B, 0xD8, 0x64, 0xDE, 0x87,
-    0x90, 0x41, 0xA7, 0x1F, 0x45, 0x25, 0x88, 0x31, 0x4B, 0x28, 0xDA, 0x77, 0x4E, 0x8D, 0x26, 0x7D,
-    0x0F, 0x7B, 0x67, 0x2B, 0x49, 0x8B, 0x8D, 0xFE, 0x7A, 0x22, 0x9F, 0x9F, 0x59, 0x8F, 0x53, 0xFC,
-    0xF4, 0x55, 0xA4, 0x6A, 0x09, 0xB2, 0xFF, 0x30, 0x33, 0xC7, 0xFF, 0x79, 0xAA, 0xC0, 0xDE, 0xA1,
-    0x63, 0xA4, 0x49, 0x5E, 0x24, 0xDF, 0x13, 0xBD, 0x43, 0xF7, 0x62, 0x68, 0xD7, 0xA9, 0xB5, 0xA1,
-    0x46, 0xDD, 0xE4, 0xCA, 0x0E, 0x81, 0x77, 0x90, 0x81, 0x0A, 0xC1, 0xA1, 0x58, 0xB5, 0x1D, 0xE5,
-    0x4B, 0x46, 0x6F, 0xA7, 0x2D, 0xE9, 0x6B, 0x0C, 0xB5, 0x5B, 0xB8, 0x8A, 0xE8, 0x5B, 0xD0, 0xCD,
-    0xDE, 0xEE, 0xC2, 0x25, 0x54, 0x63, 0x50, 0xF7, 0x04, 0x1F, 0x37, 0xE1, 0x4F, 0x65, 0xD4, 0x2F,
-    0x09, 0x55, 0xE9, 0xC8, 0x66, 0x24, 0x4A, 0x08, 0xD4, 0xE3, 0x32, 0xDB, 0x20, 0x99, 0x44, 0xD3,
-    0x40, 0x85, 0x85, 0x7A, 0x7A, 0x09, 0x74, 0xC6, 0x82, 0xA1, 0x1D, 0x6F, 0x31, 0xC6, 0x31, 0x56,
-    0x13, 0x7D, 0xC8, 0xD7, 0xC2, 0x56, 0xB9, 0x8E, 0x5D, 0x39, 0xBE, 0xC8, 0x6B, 0xF5, 0x36, 0x92,
-    0x0F, 0xBF, 0x5F, 0x07, 0xFB, 0x51, 0x38, 0xF6, 0x09, 0x5C, 0xA1, 0xDD, 0xFB, 0x21, 0x7D, 0xF2,
-    0x8A, 0x51, 0xB9, 0xE9, 0x71, 0x85, 0xB9, 0x3B, 0x4F, 0x52, 0x04, 0x99, 0xDE, 0x02, 0x34, 0xDB,
-    0x4E, 0x88, 0x72, 0x0B, 0xA2, 0x42, 0x6D, 0x5F, 0x66, 0x1C, 0x1B, 0x39, 0xF9, 0x7D, 0x4C, 0x6E,
-    0xC3, 0x83, 0x6B, 0xEB, 0xA8, 0x19, 0xC4, 0x3D, 0xE1, 0xF0, 0x97, 0x88, 0xD1, 0xAC, 0xE4, 0x59,
-    0x52, 0x73, 0xAE, 0x52, 0xC9, 0xF9, 0x93, 0x3E, 0x0E, 0xFC, 0xA9, 0xA6, 0x16, 0xB0, 0x45, 0x5D,
-    0xB8, 0x14, 0x4E, 0x30, 0x14, 0x01, 0x50, 0x30, 0x0E, 0x81, 0xA3, 0x33, 0xCE, 0xE2, 0x34, 0x03,
-    0x50, 0x45, 0x97, 0xB1, 0x74, 0xB3, 0xEF, 0xFC, 0x0B, 0x61, 0x02, 0x1E, 0x4A, 0xC1, 0x20, 0xC6,
-    0xBB, 0xF0, 0x59, 0x21, 0xC0, 0x25, 0xCD, 0x18, 0xD6, 0x97, 0x80, 0xA6, 0x6E, 0x87, 0x74, 0xF7,
-    0xFD, 0x5B, 0x45, 0x35, 0x6A, 0xFF, 0xDF, 0x20, 0x4C, 0x1E, 0x8C, 0x5A, 0x70, 0x94, 0xFF, 0xA6,
-    0xCC, 0x1C, 0xF8, 0xF3, 0x3F, 0x1E, 0x03, 0x0B, 0x13, 0xFB, 0xC4, 0x96, 0xB5, 0x91, 0x2D, 0xBE,
-    0x93, 0x9E, 0x37, 0x8A, 0xA6, 0xE2, 0x2B, 0x37, 0x9B, 0x1F, 0x46, 0xD9, 0x0F, 0xD1, 0x82, 0x66,
-    0x3B, 0xFA, 0xC6, 0x8B, 0x99, 0xE6, 0xD8, 0x38, 0x0F, 0x6C, 0x17, 0xFE, 0x93, 0x1D, 0x5A, 0x53,
-    0xFE, 0x3C, 0x73, 0x1E, 0x27, 0x0F, 0x6F, 0xD0, 0x83, 0x09, 0xEE, 0xA3, 0xB5, 0x62, 0xFF, 0x2B,
-    0xDE, 0xC4, 0x22, 0xFC, 0xAE, 0xF9, 0x33, 0x73, 0xE7, 0xBF, 0xD9, 0x30, 0xF1, 0xDE, 0x09, 0xD9,
-    0xAC, 0x00, 0xFD, 0xFC, 0x4F, 0x4F, 0xA3, 0x17, 0xE1, 0x4B, 0xD2, 0x98, 0x3F, 0x33, 0x78, 0xE8,
-    0xAF, 0xCA, 0x63, 0xDC, 0x4B, 0x1F, 0x3A, 0x84, 0x39, 0xEF, 0xE5, 0x6F, 0xC4, 0xE5, 0xA7, 0x04,
-    0xA6, 0xDC, 0x10, 0xD9, 0x55, 0xE2, 0xD8, 0xBB, 0xC0, 0xB6, 0xBF, 0xEB, 0x6B, 0x0F, 0xC2, 0xEC,
-    0xDB, 0x7F, 0x66, 0xB4, 0x07, 0x91, 0xF9, 0x57, 0xE6, 0x53, 0xF8, 0x3B, 0x33, 0x85, 0x74, 0xEA,
-    0x9B, 0xD5, 0x7E, 0xE4, 0x92, 0x61, 0xC8, 0xA4, 0xEA, 0x9B, 0xA3, 0xEC, 0xDB, 0xEB, 0x1E, 0xFF,
-    0xBB, 0x4F, 0x78, 0x5C, 0x60, 0xB3, 0xFB, 0x1A, 0xF5, 0x7F, 0xBF, 0x7E, 0xC2, 0x04, 0x9C, 0x42,
-    0xBE, 0xA6, 0x67, 0x4D, 0x73, 0xE9, 0x39, 0x26, 0xE2, 0x11, 0xC0, 0xE2, 0x78, 0x83, 0x4B, 0x80,
-    0x65, 0x1E, 0xD7, 0x55, 0xF1, 0x77, 0x93, 0x81, 0xA1, 0x9C, 0xA0, 0x9D, 0x9C, 0x9E, 0x8A, 0xAF,
-    0xF5, 0x08, 0x92, 0xCA, 0x5F, 0x7F, 0x05, 0x07, 0x3A, 0x5B, 0x98, 0xEC, 0xBE, 0x27, 0xEE, 0x21,
-    0x13, 0xEE, 0x4E, 0xAC, 0x7C, 0xEE, 0xE6, 0x30, 0x1A, 0xB2, 0xDC, 0xB5, 0xCC, 0x0E, 0x66, 0xCB,
-    0x9D, 0x7F, 0x6C, 0x65, 0x3E, 0x95, 0xBF, 0xAF, 0x12, 0x20, 0xD6, 0x4E, 0x36, 0x53, 0xF6, 0x2D,
-    0xDF, 0x8E, 0x21, 0xDF, 0x9E, 0xF2, 0x57, 0xF4, 0x62, 0x51, 0x62, 0x85, 0x1E, 0x17, 0xBC, 0x23,
-    0xAC, 0x26, 0x5E, 0xE0, 0x77, 0x1D, 0xB3, 0x33, 0x75, 0xDF, 0x5F, 0x4B, 0x1B, 0x8F, 0x1F, 0x37,
-    0x31, 0xBF, 0xA5, 0x5F, 0xFF, 0x95, 0x5E, 0x0A, 0xF0, 0xCF, 0xA0, 0x3B, 0x33, 0xA3, 0x5E, 0xFB,
-    0xDF, 0x1B, 0xD4, 0x52, 0x48, 0xC9, 0x76, 0x74, 0xDD, 0x9B, 0xFE, 0xB6, 0xCD, 0x68, 0x86, 0xF3,
-    0xAC, 0x62, 0x30, 0xFE, 0x88, 0xF8, 0x43, 0x50, 0x09, 0x83, 0x38, 0x2F, 0xD2, 0x7A, 0x71, 0xB3,
-    0xA6, 0xB6, 0x38, 0xA5, 0xF2, 0xF8, 0xF9, 0x9A, 0xF6, 0x2E, 0xFC, 0xF0, 0x7A, 0x0A, 0xAA, 0xB0,
-    0x98, 0xE4, 0x50, 0x22, 0xCB, 0x0F, 0x0F, 0x76, 0xA8, 0x9C, 0x19, 0x2A, 0xE8, 0xEA, 0x20, 0x3F,
-    0x3C, 0x24, 0x39, 0x9B, 0x41, 0x91, 0x92, 0x0A, 0x36, 0x42, 0xBE, 0x8F, 0xD9, 0x4F, 0x20, 0xBA,
-    0x9B, 0x6D, 0x10, 0xF6, 0x7A, 0x06, 0x99, 0x3F, 0xA5, 0x03, 0xBC, 0xFC, 0x40, 0x63, 0x53, 0x02,
-    0x46, 0x60, 0xAF, 0x91, 0xEF, 0xED, 0x81, 0xC8, 0x03, 0xB7, 0x00, 0x95, 0x19, 0x8C, 0x8B, 0x0D,
-    0x7F, 0x48, 0xE5, 0x6D, 0x1D, 0x47, 0x39, 0x1C, 0x64, 0x59, 0x3D, 0x22, 0xA3, 0x6D, 0x17, 0x83,
-    0x83, 0xD6, 0x53, 0x58, 0x20, 0xC5, 0xF5, 0x55, 0x16, 0x3E, 0xC0, 0xBB, 0xD1, 0x42, 0x4A, 0xE7,
-    0xB9, 0x94, 0x2E, 0x9C, 0x28, 0x7A, 0xF0, 0xDD, 0x33, 0x29, 0xD4, 0xD3, 0xE1, 0x3B, 0x35, 0xB2,
-    0x72, 0xC2, 0x2E, 0x90, 0xC2, 0xC7, 0x53, 0x08, 0xAB, 0x5A, 0x8D, 0x60, 0xE7, 0x48, 0x61, 0xB5,
-    0x46, 0x91, 0x69, 0x2D, 0xD2, 0x4C, 0x8A, 0x97, 0x91, 0xD1, 0xAD, 0xEF, 0xE8, 0xF0, 0x09, 0xAB,
-    0xB3, 0x85, 0xC1, 0x1C, 0x0E, 0x0C, 0x69, 0x47, 0xEF, 0x97, 0x6A, 0xE2, 0x00, 0x39, 0xE1, 0xC1,
-    0xDA, 0x7C, 0xAA, 0x0A, 0x38, 0xA5, 0x75, 0x95, 0xCA, 0x44, 0x14, 0x1E, 0x58, 0xF4, 0xB6, 0x7E,
-    0x74, 0x96, 0xBC, 0x3B, 0x93, 0x02, 0x4A, 0xCD, 0x6F, 0x0F, 0x8B, 0x62, 0xF3, 0x82, 0x03, 0xC5,
-    0x1F, 0xCD, 0xC7, 0x74, 0x13, 0xD0, 0x9B, 0x17, 0xDE, 0xB0, 0xB8, 0xC8, 0x14, 0x21, 0x31, 0x93,
-    0xB2, 0x21, 0x82, 0x47, 0x05, 0x72, 0xDA, 0xB9, 0x5D, 0x6E, 0x17, 0xA6, 0x83, 0xD3, 0xDC, 0x25,
-    0x65, 0xC1, 0x5C, 0x52, 0xB4, 0xB9, 0xE2, 0x09, 0xD4, 0x0E, 0xEF, 0x8E, 0x1E, 0xE1, 0x87, 0x93,
-    0x72, 0xB5, 0xAA, 0x70, 0xA8, 0xE8, 0xF2, 0x08, 0x57, 0x99, 0xB3, 0x47, 0x33, 0x75, 0x1D, 0x9B,
-    0xBE, 0x6B, 0xA3, 0x52, 0xDE, 0x71, 0x9E, 0xD2, 0x1E, 0x8D, 0x41, 0xB0, 0x17, 0xE8, 0x94, 0xB8,
-    0x20, 0x74, 0xE6, 0x62, 0xD2, 0xE4, 0x4B, 0x30, 0xB2, 0x15, 0xE9, 0xF5, 0x0B, 0xC8, 0xD4, 0x23,
-    0x2F, 0x0D, 0xAC, 0x66, 0xED, 0xFB, 0x30, 0xF3, 0x46, 0x73, 0x4C, 0x1D, 0x57, 0x9A, 0xE5, 0x2A,
-    0x85, 0xDA, 0x8C, 0x1A, 0xC0, 0x92, 0x1D, 0xCE, 0x9D, 0x50, 0x20, 0xAC, 0xF2, 0xAC, 0x18, 0xE4,
-    0xD1, 0x2F, 0x34, 0x02, 0xB5, 0xE5, 0xEB, 0xFD, 0xBC, 0xEC, 0x18, 0x15, 0x1B, 0xBB, 0x3C, 0x11,
-    0x1D, 0xD9, 0x2E, 0x98, 0xA8, 0x57, 0x18, 0x9E, 0xBB, 0xE7, 0xEC, 0x32, 0xEB, 0xE0, 0x87, 0x7C,
-    0x1D, 0xFC, 0x90, 0xBF, 0xD8, 0x8E, 0xC1, 0x0F, 0xF5, 0x46, 0xF0, 0x43, 0xBE, 0x19, 0xFC, 0x30,
-    0x73, 0xC1, 0x0F, 0x5F, 0x88, 0x6E, 0xD4, 0xC1, 0xAA, 0xB7, 0x45, 0x72, 0xF1, 0xCA, 0x60, 0xEC,
-    0x81, 0xE0, 0x87, 0x3E, 0x5A, 0x9E, 0x7A, 0x12, 0x9A, 0xA4, 0xF8, 0x45, 0x19, 0x87, 0x97, 0x3F,
-    0x31, 0xF8, 0x41, 0xD3, 0x0F, 0x6E, 0x7A, 0x82, 0x50, 0xA7, 0x88, 0xC8, 0xD7, 0x8F, 0xC7, 0x28,
-    0xE4, 0x63, 0x5D, 0xB7, 0x3F, 0xF5, 0x0A, 0xD5, 0xEF, 0x85, 0x2A, 0x68, 0xEC, 0x38, 0xB1, 0x83,
-    0xBA, 0xE0, 0x61, 0x98, 0xCF, 0xEF, 0xC7, 0x87, 0x10, 0x40, 0xE3, 0x72, 0x70, 0x4C, 0x87, 0x6E,
-    0x5A, 0x20, 0x77, 0x3F, 0xFC, 0xDB, 0x61, 0xF1, 0xAA, 0x3A, 0x65, 0xF2, 0xE0, 0xDF, 0xCB, 0xBD,
-    0x87, 0x0E, 0x4A, 0x6C, 0x11, 0x2A, 0x2A, 0x9F, 0x61, 0xF1, 0x03, 0xB4, 0xF0, 0xF0, 0xE7, 0xD7,
-    0x76, 0xE7, 0xF4, 0x14, 0xC5, 0x07, 0xE5, 0xE3, 0xAE, 0xD9, 0xFC, 0xD0, 0x48, 0xC3, 0x00, 0x39,
-    0x42, 0xF1, 0x3D, 0x27, 0xE5, 0x78, 0xF6, 0x07, 0xE4, 0x86, 0x7B, 0x8D, 0xCC, 0xF6, 0x7A, 0x61,
-    0xE5, 0xE8, 0x81, 0x01, 0xDB, 0x5A, 0xB0, 0xCE, 0xBE, 0xC8, 0xB4, 0x6F, 0x66, 0xA0, 0xCA, 0x9A,
-    0x09, 0x31, 0xB1, 0x24, 0x54, 0xB7, 0x97, 0xAF, 0x2B, 0xEB, 0x89, 0xA6, 0x0D, 0x13, 0x4B, 0x4E,
-    0x66, 0x3C, 0x59, 0x09, 0xC3, 0x05, 0x2F, 0x92, 0xEB, 0xC4, 0x6C, 0xF4, 0xA9, 0x24, 0x9D, 0x9B,
-    0xAF, 0x65, 0xC0, 0x82, 0x9F, 0xC5, 0x22, 0x3B, 0xCE, 0x67, 0x7B, 0x58, 0x9C, 0xC1, 0x72, 0xA7,
-    0x3F, 0xE0, 0xF0, 0x04, 0x02, 0x3E, 0xC3, 0x56, 0xA8, 0x45, 0xE7, 0x5C, 0xF9, 0xA1, 0xF8, 0x28,
-    0x37, 0x3F, 0x8E, 0xDF, 0x76, 0x3E, 0xD8, 0x10, 0x7A, 0x05, 0x49, 0x65, 0x61, 0xE3, 0x0F, 0x96,
-    0x21, 0x7E, 0xA3, 0x3E, 0x09, 0x0A, 0x35, 0xF8, 0xC0, 0x60, 0x5A, 0x69, 0x85, 0x8D, 0x28, 0x0F,
-    0xC1, 0xA7, 0xA7, 0x90, 0x0A, 0x54, 0x0F, 0xA8, 0x28, 0x29, 0x97, 0xED, 0x50, 0xE9, 0xA9, 0x96,
-    0x14, 0x8A, 0x2B, 0x3B, 0x14, 0x59, 0xD4, 0x18, 0xCB, 0xE5, 0xB4, 0xE3, 0x3C, 0x5B, 0xBE, 0xF1,
-    0x13, 0x3E, 0xDF, 0xEF, 0x76, 0x54, 0x94, 0x8B, 0xF6, 0x6F, 0xD4, 0x4E, 0xB3, 0xA7, 0x2F, 0x8E,
-    0x3E, 0xA2, 0x06, 0x1B, 0xD1, 0x84, 0xAA, 0xED, 0x2A, 0xC3, 0x95, 0x8A, 0x3F, 0xCB, 0x1D, 0x75,
-    0x0C, 0x13, 0x21, 0xCC, 0xE5, 0xCB, 0xDD, 0xD1, 0x14, 0x70, 0x78, 0xAD, 0xE6, 0xF2, 0xDC, 0x81,
-    0x14, 0x2A, 0x9D, 0x82, 0x98, 0x96, 0xB9, 0x96, 0x32, 0x74, 0x18, 0x4D, 0xB7, 0x6F, 0xBA, 0xBE,
-    0x74, 0x65, 0x86, 0x0A, 0x6F, 0xD2, 0x38, 0x8E, 0x30, 0x18, 0xDD, 0x7B, 0xC5, 0x5A, 0xBF, 0x09,
-    0x29, 0x11, 0x4A, 0xF2, 0x15, 0x12, 0x6D, 0xD5, 0x46, 0x8D, 0x4B, 0x98, 0xA4, 0x1D, 0xB4, 0x85,
-    0x16, 0x69, 0x8E, 0x91, 0xF6, 0x42, 0x7A, 0xA5, 0x99, 0xD0, 0x76, 0x74, 0x80, 0x3E, 0xBA, 0xA6,
-    0xAA, 0x35, 0x1D, 0x85, 0x70, 0xFF, 0xC6, 0x6A, 0x63, 0x94, 0xF2, 0x70, 0x45, 0xDD, 0x99, 0x8C,
-    0x22, 0xA1, 0x3B, 0x5C, 0x51, 0x01, 0xA3, 0xFD, 0xC7, 0x8B, 0x7C, 0x46, 0x69, 0x4B, 0xEF, 0xF7,
-    0xBE, 0xCB, 0x66, 0xA4, 0xD0, 0xCD, 0xED, 0x38, 0xFF, 0x8E, 0xB5, 0xA2, 0x31, 0x3A, 0xD1, 0xCF,
-    0xEE, 0xC1, 0x48, 0xE1, 0xF6, 0xA5, 0x66, 0x64, 0xDE, 0x28, 0xD8, 0x91, 0xC5, 0x4B, 0xC6, 0xF6,
-    0x69, 0x42, 0xDD, 0xC9, 0x31, 0xFE, 0x33, 0x08, 0x5F, 0x05, 0x87, 0x34, 0x5B, 0xBA, 0x16, 0xB4,
-    0xFA, 0x01, 0xA7, 0x01, 0xC6, 0x2A, 0x5F, 0x8E, 0x7C, 0x93, 0x3A, 0xF2, 0xC0, 0x49, 0x40, 0x44,
-    0x57, 0xE4, 0x73, 0x68, 0x35, 0xA2, 0x16, 0x3C, 0x5D, 0xA5, 0x4E, 0x50, 0xB3, 0x3A, 0xA0, 0x4B,
-    0x4B, 0x09, 0x20, 0x80, 0x46, 0x33, 0x87, 0x51, 0x6E, 0xF6, 0x31, 0x6D, 0x5D, 0xE0, 0xCC, 0x54,
-    0x97, 0x98, 0xAB, 0x91, 0x80, 0x99, 0xA5, 0x66, 0xD4, 0xB5, 0xC5, 0xB5, 0xCB, 0x0C, 0x3B, 0xAB,
-    0x7D, 0x3A, 0x15, 0x84, 0x74, 0x31, 0x48, 0x97, 0xD3, 0x2B, 0x02, 0x3A, 0x23, 0x44, 0x4C, 0x0C,
-    0x97, 0x0E, 0x64, 0x3A, 0x57, 0x93, 0xA7, 0x6D, 0x78, 0xB7, 0xE2, 0x34, 0xEB, 0x70, 0x50, 0x9C,
-    0x35, 0xF4, 0x4C, 0x51, 0x87, 0x6A, 0xA8, 0x72, 0x68, 0x58, 0x2B, 0x5D, 0x58, 0x03, 0xD4, 0x5F,
-    0x4C, 0xA2, 0x8C, 0xC5, 0x0A, 0xD3, 0xA2, 0x06, 0x3A, 0xD0, 0x09, 0x2E, 0x86, 0xDE, 0x27, 0x97,
-    0xBB, 0xFC, 0x9E, 0x81, 0x1A, 0xEF, 0x2D, 0x4D, 0x02, 0xD4, 0x63, 0xEF, 0x12, 0x5A, 0xC8, 0x4C,
-    0x97, 0xF4, 0x91, 0x1C, 0xA8, 0x34, 0xF4, 0x88, 0x52, 0xF2, 0xD3, 0x99, 0xA0, 0xED, 0x37, 0x56,
-    0xE8, 0xDF, 0x0F, 0x91, 0x0A, 0xF7, 0x2B, 0x16, 0x23, 0x86, 0xE0, 0xD5, 0x37, 0x10, 0xED, 0x59,
-    0x43, 0xA3, 0xDE, 0x61, 0xD8, 0x72, 0xC0, 0x15, 0x93, 0x69, 0x23, 0xB4, 0xCA, 0x85, 0xD0, 0xE7,
-    0xF0, 0x6B, 0x92, 0x2B, 0x61, 0xCE, 0x82, 0xB6, 0xB1, 0xFB, 0x8A, 0x08, 0xBD, 0x79, 0xF8, 0xBD,
-    0x46, 0x2A, 0x97, 0x36, 0x23, 0xDF, 0x7D, 0x30, 0x93, 0xAE, 0xE6, 0x93, 0x73, 0x59, 0x8F, 0x32,
-    0xE8, 0x83, 0x5F, 0xCE, 0x9F, 0x6C, 0xBE, 0x9D, 0x66, 0x7D, 0x2C, 0x1C, 0xE9, 0xD7, 0x6D, 0x11,
-    0xBD, 0x2D, 0x90, 0xD3, 0xC8, 0xCB, 0x30, 0x12, 0x50, 0x7D, 0xC3, 0xD1, 0x3F, 0xD8, 0xEF, 0x74,
-    0x20, 0xD2, 0xAF, 0xCB, 0x18, 0xE8, 0x15, 0x8D, 0xE9, 0xE3, 0x5C, 0x6E, 0x79, 0xAB, 0x89, 0xDE,
-    0xAE, 0xCB, 0xA0, 0x79, 0x84, 0xA9, 0xC3, 0xAC, 0xAA, 0x4F, 0x89, 0x0B, 0xA2, 0xA5, 0x32, 0x8C,
-    0xDF, 0x1A, 0x5E, 0x91, 0x95, 0x5B, 0xDA, 0xD6, 0x83, 0x03, 0x7F, 0x2B, 0x43, 0xFD, 0xA5, 0xFE,
-    0x0C, 0x73, 0x2B, 0x03, 0x8F, 0xD2, 0xA1, 0x06, 0x47, 0xAA, 0x5E, 0x81, 0xA2, 0x35, 0x81, 0x9E,
-    0x47, 0xF2, 0xE0, 0x8E, 0xCC, 0x1B, 0xAC, 0x39, 0xF4, 0x3C, 0xE6, 0x3C, 0xC3, 0x5D, 0xD5, 0xFA,
-    0x09, 0x11, 0x9F, 0x16, 0x50, 0xE1, 0xE5, 0x69, 0xE2, 0x4C, 0x6D, 0x49, 0x4A, 0x66, 0x38, 0x66,
-    0x4B, 0x74, 0x2C, 0x82, 0x96, 0x9C, 0x28, 0xD7, 0xA4, 0x1E, 0x54, 0xBF, 0x8E, 0x80, 0x53, 0x1C,
-    0x84, 0xDA, 0x66, 0x9B, 0x67, 0x01, 0x85, 0x70, 0x84, 0x82, 0xA7, 0x19, 0x9D, 0x46, 0xE0, 0xCF,
-    0x13, 0x50, 0xC9, 0xB7, 0x52, 0x6D, 0x70, 0xD0, 0x94, 0x66, 0xD4, 0xE6, 0x01, 0x61, 0xED, 0xD3,
-    0x00, 0x67, 0x9D, 0x03, 0x71, 0xD0, 0xC4, 0xB8, 0x6E, 0x06, 0x0F, 0x13, 0x8F, 0xBE, 0x40, 0x25,
-    0x5D, 0x4F, 0x2A, 0xBA, 0x78, 0x42, 0xD0, 0xE8, 0x4A, 0x4C, 0x6B, 0xF2, 0x3D, 0xC6, 0xDA, 0x36,
-    0xC8, 0xCF, 0xE2, 0x39, 0xB3, 0x2F, 0x6D, 0x2E, 0x98, 0xAC, 0xD2, 0xAD, 0x6B, 0xD2, 0x99, 0x92,
-    0xE8, 0x25, 0xAC, 0x35, 0xB4, 0x25, 0x50, 0xF7, 0x0E, 0xA2, 0xAA, 0x92, 0x26, 0x84, 0x70, 0x5F,
-    0xD3, 0x76, 0x10, 0x61, 0x84, 0xB7, 0x35, 0x75, 0x58, 0xAC, 0xD9, 0xDD, 0xA8, 0xE4, 0x2A, 0x7D,
-    0x4D, 0xBE, 0x1E, 0xAA, 0xAF, 0x06, 0xE4, 0xCB, 0xE9, 0xD1, 0x8E, 0xB4, 0x44, 0xB5, 0xB6, 0xA0,
-    0x62, 0x12, 0x6C, 0x4D, 0xBD, 0x25, 0xF0, 0x1F, 0xBA, 0x08, 0x08, 0x25, 0x61, 0xE8, 0x00, 0x8E,
-    0x71, 0xF5, 0xDB, 0x17, 0xD4, 0x56, 0xD4, 0x90, 0xC4, 0x36, 0xCA, 0x95, 0x30, 0x21, 0x17, 0x35,
-    0xCC, 0x41, 0x33, 0x4C, 0xB6, 0x13, 0x2A, 0x63, 0x9C, 0xA1, 0xC2, 0xD5, 0x37, 0xB9, 0xE6, 0xD7,
-    0x65, 0x4C, 0xAB, 0xE2, 0x7C, 0x7F, 0xB2, 0xC7, 0x62, 0xD8, 0x2B, 0x97, 0x9B, 0x8A, 0x6E, 0xBF,
-    0x9A, 0x1D, 0x4F, 0x93, 0xF1, 0x92, 0xCC, 0x2A, 0x23, 0x97, 0x9A, 0x7B, 0x39, 0xD1, 0xCF, 0xE7,
-    0xF3, 0x52, 0x1D, 0x95, 0x2A, 0xBA, 0x07, 0xD5, 0x33, 0xC4, 0x0F, 0xDD, 0xCF, 0xA3, 0x36, 0x4E,
-    0xD8, 0x73, 0x74, 0xF4, 0xA6, 0x71, 0xE8, 0xA4, 0xA9, 0xA2, 0x36, 0x69, 0xD1, 0x58, 0x05, 0xEF,
-    0x22, 0x67, 0x05, 0x4F, 0x0A, 0xA4, 0xA3, 0x5D, 0x1D, 0x5F, 0x79, 0x7D, 0x71, 0x01, 0xA9, 0x2D,
-    0x10, 0x14, 0x03, 0xAE, 0x69, 0xB8, 0xF3, 0x95, 0x63, 0x65, 0xB9, 0xCF, 0xA0, 0x16, 0xA6, 0xB8,
-    0x2D, 0xCC, 0xC1, 0x30, 0x84, 0xC9, 0xAA, 0xBE, 0x59, 0xA9, 0xFD, 0xD2, 0x2C, 0x5D, 0xB6, 0xDF,
-    0xFC, 0x5A, 0x8E, 0xAC, 0xFB, 0x3D, 0x7C, 0xC9, 0xA8, 0x6F, 0xB9, 0x8C, 0x65, 0xEB, 0x2F, 0xE4,
-    0x4B, 0xAC, 0xEE, 0xE3, 0x61, 0x77, 0xFF, 0x5A, 0x0F, 0xA8, 0x45, 0x18, 0x81, 0x2C, 0x09, 0x78,
-    0x5E, 0x24, 0xD7, 0x5F, 0xED, 0x35, 0x7B, 0x7A, 0xC6, 0xC4, 0xAF, 0xCC, 0xF0, 0xAB, 0x83, 0x65,
-    0xDC, 0x09, 0x0C, 0x2C, 0xFD, 0x8D, 0x18, 0xE4, 0x00, 0x46, 0x71, 0xB8, 0xCB, 0x1D, 0x77, 0x3A,
-    0xC1, 0x5E, 0x0E, 0x66, 0xCC, 0x8C, 0x78, 0xB0, 0x40, 0x20, 0xDC, 0xC8, 0x64, 0xFF, 0xA9, 0x14,
-    0x16, 0xAF, 0xB8, 0x02, 0xB0, 0x99, 0x2B, 0x74, 0x5A, 0x98, 0x3F, 0x63, 0xC7, 0x8B, 0xCB, 0xCA,
-    0x15, 0x12, 0x97, 0x25, 0x5F, 0xD3, 0x37, 0x73, 0xC5, 0xB5, 0x63, 0x61, 0x4C, 0x7E, 0xEF, 0x8F,
-    0x05, 0xEF, 0x44, 0x85, 0x35, 0x8F, 0xE8, 0x84, 0x9D, 0xEE, 0xB0, 0xB9, 0x37, 0xAC, 0x0F, 0x5A,
-    0xC4, 0x33, 0xAA, 0xFB, 0xC0, 0x9D, 0x5C, 0x74, 0x5A, 0xC8, 0xC9, 0xF3, 0xA0, 0x1C, 0x75, 0x91,
-    0xEB, 0x94, 0x22, 0x14, 0xF6, 0x97, 0xEA, 0x10, 0x06, 0x6C, 0x31, 0x2C, 0x16, 0x4E, 0x40, 0x70,
-    0x01, 0xF9, 0x98, 0x07, 0x27, 0xFA, 0x8D, 0x21, 0x64, 0x1B, 0x27, 0xAF, 0xBF, 0xA2, 0xDE, 0xAB,
-    0x76, 0x45, 0x5F, 0x56, 0x61, 0xA5, 0x70, 0xF2, 0xCF, 0xB7, 0x6A, 0xDE, 0xE9, 0x59, 0xBD, 0x33,
-    0x7E, 0x87, 0x77, 0xD2, 0xC1, 0x08, 0x94, 0x52, 0x1F, 0xCB, 0xC4, 0x31, 0x82, 0x85, 0x6E, 0x36,
-    0x53, 0xFC, 0xB0, 0x4B, 0xD7, 0xBC, 0x66, 0x97, 0x9D, 0x54, 0x3F, 0x8E, 0xC3, 0xB0, 0x11, 0x9C,
-    0x7B, 0x4A, 0x39, 0x43, 0x6F, 0x50, 0x56, 0x35, 0xD7, 0xAF, 0xD0, 0x16, 0x47, 0x2C, 0xBF, 0xEC,
-    0x75, 0x42, 0x38, 0x89, 0xD8, 0x59, 0xA7, 0x9E, 0xD5, 0x71, 0x02, 0xBD, 0xFB, 0xDF, 0x99, 0x4F,
-    0xFF, 0x6C, 0x3C, 0x32, 0xB5, 0xD0, 0x70, 0x84, 0x2D, 0x27, 0x73, 0x10, 0x76, 0xBB, 0x66, 0x5E,
-    0xF2, 0x12, 0x73, 0x90, 0x7E, 0xAF, 0xA6, 0x5B, 0x29, 0x69, 0x08, 0xAC, 0xA2, 0x48, 0x9E, 0xB8,
-    0xF9, 0xA3, 0xCD, 0x79, 0xD9, 0xF3, 0x4C, 0xDF, 0xDF, 0xD0, 0x6B, 0xB5, 0xA4, 0x1C, 0x11, 0xAD,
-    0x90, 0x71, 0xF0, 0x6B, 0x02, 0x3C, 0x95, 0x10, 0xA9, 0xC2, 0xB7, 0x59, 0xCC, 0x54, 0x92, 0xD7,
-    0x5D, 0x6E, 0x5B, 0x7B, 0xF5, 0x3C, 0x33, 0xD2, 0x0E, 0xF0, 0x8A, 0x08, 0x75, 0x9E, 0x4E, 0xFD,
-    0x85, 0x4E, 0x54, 0xAC, 0x2E, 0x14, 0x20, 0x6C, 0x57, 0xCF, 0x38, 0x2F, 0x11, 0x38, 0x26, 0x80,
-    0x6D, 0xCC, 0x2D, 0x9E, 0x79, 0xA3, 0xDE, 0x81, 0x77, 0x82, 0xC8, 0x5A, 0x95, 0x8C, 0xAA, 0x10,
-    0xD9, 0x9B, 0x50, 0x30, 0x75, 0xF0, 0x07, 0x4D, 0x91, 0x8D, 0x2F, 0x7E, 0xAB, 0x06, 0xEF, 0xDF,
-    0x01, 0x91, 0xA5, 0x55, 0xFC, 0x4E, 0x17, 0xB4, 0x3E, 0x00, 0xF9, 0x6A, 0xD9, 0x51, 0x4A, 0x5D,
-    0xF0, 0xDD, 0x85, 0x79, 0xD4, 0x2B, 0x0F, 0xA8, 0x65, 0x1F, 0x1B, 0x53, 0x6E, 0x9A, 0x8D, 0x94,
-    0x9B, 0x85, 0x33, 0x08, 0xA8, 0x11, 0xE7, 0x50, 0xCA, 0x4D, 0xEF, 0x44, 0x29, 0x37, 0x9B, 0x3B,
-    0xA6, 0xDC, 0x8C, 0x1B, 0x67, 0x57, 0x3A, 0x25, 0x4D, 0x5A, 0xC0, 0x53, 0x06, 0x33, 0xA6, 0xAE,
-    0xFB, 0xD1, 0x3F, 0x1A, 0xC7, 0x51, 0xAB, 0xF9, 0x9B, 0xDC, 0xBD, 0x99, 0x24, 0x71, 0x9D, 0xD5,
-    0xF5, 0xFC, 0x7B, 0x73, 0xB0, 0x3C, 0x08, 0xA7, 0xFD, 0x9A, 0x7D, 0xE9, 0x35, 0xEA, 0x1E, 0xF5,
-    0xD5, 0xEA, 0xC8, 0xAC, 0x76, 0xCD, 0xA5, 0x42, 0xD3, 0x30, 0x72, 0xFB, 0x3A, 0xBC, 0x64, 0x08,
-    0x2B, 0x93, 0x95, 0x1F, 0x5E, 0xCC, 0x4A, 0x46, 0xE3, 0xAE, 0x74, 0x21, 0x14, 0xFA, 0xEA, 0xC7,
-    0xF5, 0xBD, 0x60, 0xA4, 0x11, 0xBC, 0xD1, 0xBA, 0xD5, 0x75, 0x30, 0x1B, 0xE8, 0x7C, 0xDE, 0xCF,
-    0xCF, 0x7E, 0x9E, 0xD9, 0x40, 0x35, 0xB1, 0x4F, 0xA6, 0x4E, 0x00, 0x27, 0xD4, 0xFD, 0x99, 0xB5,
-    0x13, 0x35, 0x75, 0x52, 0x6F, 0x2C, 0xCA, 0xEB, 0xAF, 0x2A, 0x72, 0xD1, 0x4C, 0xA2, 0xF7, 0x55,
-    0x18, 0xCE, 0x6B, 0x9A, 0xD0, 0xE0, 0x6E, 0xAC, 0xFC, 0x25, 0x92, 0xCA, 0xF8, 0x85, 0x66, 0xF4,
-    0x61, 0x2C, 0x35, 0x2F, 0x7C, 0xC8, 0xB0, 0x14, 0xA2, 0x03, 0x9F, 0x5B, 0x62, 0x44, 0x2B, 0x65,
-    0xE4, 0x68, 0x8F, 0xD6, 0xBD, 0x02, 0x86, 0x51, 0x7D, 0x32, 0xBB, 0xD9, 0x8E, 0xBE, 0x3F, 0xAA,
-    0xEA, 0x8F, 0xBA, 0xA9, 0x7F, 0xDA, 0xDF, 0x7B, 0x2E, 0x3A, 0xF8, 0x1C, 0x63, 0xD7, 0xB2, 0x29,
-    0x76, 0xAD, 0xD2, 0xD8, 0xB5, 0x84, 0xB1, 0x6B, 0x19, 0xFD, 0xA9, 0xE9, 0xE5, 0xE3, 0x6D, 0xC4,
-    0xAE, 0x31, 0xD5, 0x2A, 0x77, 0x0A, 0x79, 0x61, 0xC5, 0xE0, 0x71, 0x43, 0x17, 0x1F, 0xC5, 0x4D,
-    0x94, 0x3D, 0xD5, 0x5B, 0xAF, 0x9F, 0xC0, 0xF7, 0x64, 0x87, 0xCF, 0x76, 0xA8, 0x4E, 0x3D, 0xBD,
-    0x3B, 0x37, 0x9A, 0xE1, 0x36, 0xA1, 0x9B, 0xF2, 0xA2, 0x5C, 0xBC, 0xFC, 0x29, 0x0C, 0x55, 0x3C,
-    0x0D, 0x55, 0xBA, 0x39, 0x54, 0xFD, 0x3A, 0xCC, 0x4F, 0x87, 0xAA, 0xBE, 0xCB, 0x50, 0x01, 0x44,
-    0xF5, 0xE0, 0x2F, 0x86, 0xC5, 0x5D, 0x86, 0x8A, 0x89, 0x59, 0x0B, 0x2E, 0xE5, 0x4C, 0x33, 0xB3,
-    0x06, 0x90, 0xE9, 0x30, 0x52, 0x24, 0x54, 0x6E, 0x73, 0x00, 0xF5, 0x17, 0x65, 0x12, 0x18, 0x26,
-    0x67, 0x9D, 0x35, 0x74, 0xF0, 0x54, 0x57, 0x22, 0x75, 0xDD, 0x53, 0xF7, 0x3C, 0x3D, 0xB2, 0x46,
-    0xCF, 0x32, 0xA5, 0xA6, 0xDC, 0x65, 0x8D, 0x53, 0x8E, 0xD3, 0xF7, 0xDD, 0x38, 0x3D, 0x52, 0x07,
-    0x3C, 0xA3, 0x39, 0x5A, 0x43, 0x4D, 0x0B, 0x0E, 0x8E, 0x89, 0xBE, 0x4D, 0x29, 0x1D, 0x43, 0xE2,
-    0x6E, 0x43, 0x61, 0x72, 0x92, 0xE3, 0x44, 0xEB, 0x99, 0xCE, 0x04, 0x51, 0x7D, 0xD0, 0xA0, 0xC1,
-    0xC1, 0x3F, 0x53, 0xF7, 0x19, 0xE7, 0x15, 0x79, 0x8E, 0x83, 0xB7, 0x1C, 0x43, 0xC9, 0x55, 0x54,
-    0xA1, 0x0F, 0x04, 0xF7, 0x92, 0xDA, 0xEB, 0x9C, 0x8F, 0x95, 0xD7, 0xCD, 0x48, 0x76, 0x4B, 0x0C,
-    0x86, 0x3E, 0xCB, 0x22, 0xAB, 0x57, 0x82, 0x93, 0xAA, 0x1F, 0x39, 0x36, 0x68, 0x7D, 0xB3, 0xB2,
-    0xD4, 0x00, 0x14, 0x45, 0x7C, 0xD0, 0x53, 0xB8, 0xEF, 0x47, 0xE7, 0xC3, 0x7C, 0xEE, 0x02, 0xA3,
-    0xCC, 0x03, 0xFD, 0x3D, 0x26, 0x27, 0x39, 0xFC, 0xCD, 0xBF, 0x4B, 0xF7, 0xF9, 0x3D, 0x92, 0x1F,
-    0xA6, 0x30, 0x64, 0x4A, 0xB9, 0x26, 0x5A, 0x7E, 0xF1, 0xC2, 0xB0, 0x28, 0xB8, 0x38, 0x8E, 0xEE,
-    0x61, 0xE1, 0x69, 0x52, 0xE6, 0x4F, 0xE5, 0x14, 0x32, 0x9B, 0xD0, 0x04, 0xE3, 0xF4, 0xCF, 0x4E,
-    0x74, 0x72, 0x52, 0x91, 0x5B, 0xB0, 0xFD, 0x66, 0x4E, 0x93, 0x83, 0xA7, 0x10, 0xA7, 0x66, 0x2E,
-    0x91, 0xDB, 0xA3, 0x90, 0x13, 0xAD, 0x34, 0xF8, 0x9F, 0xEA, 0xAE, 0x13, 0x57, 0x13, 0xDF, 0x80,
-    0xA5, 0x7A, 0xAC, 0x0D, 0x86, 0xF9, 0x16, 0x77, 0x41, 0xB1, 0x8C, 0x30, 0x6C, 0xE5, 0xD4, 0xB3,
-    0xAF, 0x28, 0xF3, 0xAA, 0xFE, 0x66, 0xAA, 0xCD, 0x1D, 0xD6, 0x3C, 0xED, 0x66, 0xB5, 0x5D, 0x8B,
-    0xB9, 0x91, 0x2A, 0x5D, 0xF3, 0x35, 0x3F, 0xA8, 0xCC, 0x61, 0x7C, 0x7C, 0xF5, 0x5A, 0xED, 0x4A,
-    0x47, 0x58, 0xA4, 0x25, 0xE5, 0x5A, 0xA7, 0xB4, 0x7F, 0x6C, 0x25, 0x02, 0x34, 0x91, 0x55, 0x95,
-    0x2E, 0xE7, 0x16, 0xF9, 0x2D, 0x3E, 0x02, 0x7F, 0x05, 0x67, 0xEA, 0xB3, 0x77, 0xE0, 0x68, 0xD4,
-    0xE4, 0x66, 0x5C, 0xF6, 0xA1, 0xE3, 0x99, 0x9D, 0x8D, 0xCA, 0xED, 0x7E, 0x1C, 0xE1, 0xE1, 0x6E,
-    0x87, 0x3F, 0xC6, 0xE1, 0xDB, 0x9B, 0x07, 0x8B, 0x43, 0x99, 0x7D, 0xDB, 0x1F, 0xD2, 0x5B, 0x3B,
-    0xE5, 0x10, 0x3B, 0x59, 0x75, 0x77, 0x30, 0x5F, 0x66, 0x1C, 0xD6, 0xB7, 0xEF, 0x74, 0x38, 0x3E,
-    0xA1, 0x31, 0x77, 0x31, 0x48, 0xD5, 0x8D, 0x6A, 0xB3, 0xE0, 0xBD, 0x2C, 0x85, 0x18, 0x85, 0x3A,
-    0x7A, 0xBF, 0x41, 0xE1, 0xB9, 0xBA, 0xFC, 0xA9, 0xDD, 0x2A, 0x07, 0xE1, 0x9D, 0xDF, 0x5B, 0x25,
-    0x88, 0x79, 0xFC, 0x12, 0xFC, 0x62, 0x63, 0x04, 0x83, 0x8D, 0x05, 0xF3, 0x72, 0x34, 0x3A, 0xA8,
-    0x46, 0xAB, 0x7B, 0xE6, 0x63, 0x84, 0x53, 0x9B, 0x7D, 0x0C, 0xA5, 0x96, 0xD5, 0xED, 0x6A, 0x3E,
-    0xBC, 0xD8, 0xC5, 0xC2, 0x78, 0xE6, 0x2F, 0x1C, 0x34, 0x8B, 0x20, 0xAD, 0xB1, 0x26, 0xA9, 0x55,
-    0xEC, 0x7B, 0xA2, 0xCA, 0xFA, 0xBF, 0x9C, 0x20, 0x59, 0x59, 0x0F, 0xB3, 0xE1, 0xDB, 0x90, 0x5E,
-    0x84, 0xDB, 0x8B, 0x6E, 0x5C, 0xDD, 0x3A, 0x60, 0x36, 0x8C, 0xAF, 0x20, 0x6D, 0xC0, 0x00, 0xD2,
-    0x84, 0xAC, 0x1E, 0xBD, 0x73, 0x04, 0x3F, 0x71, 0xA1, 0xDA, 0x40, 0xE0, 0x76, 0x77, 0xC3, 0x2F,
-    0x3C, 0x55, 0xE1, 0x35, 0xFD, 0xC0, 0x6C, 0xD5, 0xF4, 0x4D, 0x80, 0x76, 0x48, 0xED, 0x21, 0x46,
-    0x53, 0xB0, 0xEB, 0x60, 0x95, 0x89, 0x6E, 0x09, 0x78, 0x85, 0x84, 0x3C, 0xB8, 0x4D, 0x87, 0x70,
-    0xD3, 0x0F, 0x94, 0x04, 0x52, 0x97, 0xE9, 0xEE, 0x7D, 0xFD, 0x6A, 0x1F, 0x73, 0x49, 0xEF, 0x9C,
-    0xCC, 0x3E, 0x66, 0x2E, 0x1A, 0x0E, 0xF8, 0x01, 0x8F, 0x42, 0xA3, 0xAB, 0x75, 0xEE, 0xB2, 0x81,
-    0x43, 0x7D, 0xF9, 0x07, 0xC6, 0xFC, 0x09, 0x48, 0xC6, 0xF5, 0x8B, 0xD6, 0x4C, 0xDB, 0xC2, 0x78,
-    0xA5, 0x73, 0x6C, 0x77, 0xF1, 0xB3, 0x4C, 0xD3, 0x38, 0xB3, 0xCA, 0x50, 0x80, 0xED, 0xB4, 0x2F,
-    0x95, 0x74, 0x0E, 0x8C, 0xEA, 0xAF, 0x30, 0x08, 0xEC, 0x71, 0x38, 0x1C, 0xB4, 0x8F, 0x33, 0xF6,
-    0x0D, 0xEE, 0x7D, 0x5E, 0xC7, 0xFD, 0xDC, 0xBA, 0x48, 0x43, 0x16, 0xB7, 0xAE, 0x2F, 0x16, 0xAF,
-    0x1E, 0x8C, 0xAF, 0x5E, 0xAD, 0xD7, 0xAF, 0xE2, 0x02, 0x68, 0xD7, 0x7E, 0x53, 0x06, 0xE0, 0xC3,
-    0x6F, 0xD5, 0xE3, 0xA8, 0xF9, 0x9A, 0x09, 0xE9, 0x40, 0x82, 0x5C, 0x37, 0xAC, 0xA9, 0x0E, 0x6B,
-    0x3E, 0x0D, 0x6B, 0xB2, 0x1E, 0xD6, 0xE4, 0x81, 0x1F, 0xD6, 0xFE, 0x40, 0xE6, 0x29, 0x87, 0x96,
-    0xC7, 0xF7, 0x1C, 0x7B, 0xD2, 0xFD, 0xDD, 0x7D, 0x22, 0x66, 0xF7, 0x35, 0x11, 0xE1, 0xD1, 0x89,
-    0xB0, 0x1B, 0x13, 0x71, 0x5A, 0x27, 0xC2, 0xB9, 0xBD, 0x7E, 0xF2, 0x11, 0xAE, 0x01, 0x3F, 0xB3,
-    0xF6, 0xF5, 0x72, 0x17, 0xAE, 0x2B, 0x9D, 0x0B, 0xCC, 0xB9, 0xB7, 0xE2, 0xE9, 0xE1, 0x09, 0x6B,
-    0xDF, 0xE2, 0xD4, 0xFA, 0xB5, 0x73, 0xDE, 0x4D, 0x0A, 0x17, 0x06, 0x3A, 0x3C, 0x53, 0x6F, 0x64,
-    0xE4, 0x42, 0xE3, 0x87, 0xE3, 0xBC, 0x85, 0xB8, 0x8D, 0x12, 0xF4, 0x4B, 0x1A, 0x16, 0x04, 0xA6,
-    0x45, 0x3D, 0x6F, 0x61, 0x7E, 0xF4, 0xC9, 0xB0, 0x69, 0x74, 0x50, 0xCE, 0xDD, 0x0E, 0x5B, 0x97,
-    0xEE, 0x24, 0xE1, 0x1E, 0x09, 0x71, 0xE5, 0xB7, 0x4E, 0xE7, 0xA3, 0xBB, 0x1F, 0x4D, 0xDB, 0x21,
-    0xC5, 0x6E, 0x7F, 0x24, 0x53, 0x3E, 0xDD, 0x9F, 0x5B, 0xB9, 0x5C, 0x2F, 0xDD, 0xA8, 0xA0, 0xA2,
-    0x84, 0x7C, 0x2B, 0xFF, 0x11, 0x5B, 0x3E, 0x6E, 0xBA, 0x34, 0xEE, 0xC2, 0x14, 0xB9, 0x6D, 0x99,
-    0x84, 0xAF, 0x4B, 0x0A, 0x75, 0x54, 0x95, 0x8A, 0x94, 0x3E, 0xD0, 0xDC, 0xC9, 0x49, 0x4E, 0x48,
-    0x05, 0x33, 0x36, 0x31, 0x67, 0x43, 0xA5, 0x9B, 0x3F, 0x79, 0xF4, 0x3B, 0x86, 0x31, 0x1F, 0x7B,
-    0x95, 0x90, 0x8F, 0x86, 0x0B, 0xB6, 0x54, 0xA0, 0xFE, 0x3B, 0xEA, 0xCF, 0x45, 0xB7, 0x92, 0x91,
-    0x38, 0x8F, 0x1B, 0x06, 0x49, 0xE3, 0x9C, 0xBF, 0xFF, 0xD1, 0xF1, 0xD1, 0x10, 0xE9, 0x9E, 0x9B,
-    0xC5, 0x30, 0x9C, 0x94, 0xE1, 0xF7, 0x1A, 0xCA, 0xA7, 0x79, 0xD5, 0xB9, 0xC3, 0x01, 0x9F, 0x0B,
-    0xE1, 0x02, 0xB8, 0x2D, 0x7D, 0x82, 0x9E, 0xE3, 0xB3, 0x3D, 0x7B, 0xA1, 0x56, 0x9E, 0xAA, 0xD9,
-    0x58, 0x84, 0xCF, 0x75, 0x31, 0xD3, 0xFC, 0xE4, 0x6A, 0x3C, 0x10, 0x5E, 0xB9, 0xA2, 0x97, 0x6F,
-    0x00, 0x0D, 0x38, 0x4D, 0x15, 0xB3, 0x86, 0xE6, 0x2E, 0xE4, 0xD1, 0xAA, 0x98, 0x13, 0x05, 0x79,
-    0xCD, 0x5F, 0xD7, 0x44, 0xBD, 0xC0, 0xE6, 0x7E, 0x7F, 0xD0, 0x52, 0x36, 0x6B, 0x35, 0x60, 0xE7,
-    0x38, 0x4B, 0xD9, 0xB8, 0x09, 0x9C, 0xB3, 0x94, 0xF5, 0x6B, 0x4B, 0xD9, 0xB8, 0xA9, 0x64, 0x36,
-    0x83, 0xB5, 0x10, 0x4F, 0xD8, 0xA2, 0x70, 0x94, 0x2F, 0xC9, 0x08, 0xA2, 0xA8, 0x16, 0x79, 0x3A,
-    0xAA, 0xA8, 0x96, 0x8E, 0xFB, 0xB8, 0x78, 0x47, 0x8A, 0xC7, 0x66, 0xF6, 0x56, 0x4B, 0xF3, 0x0A,
-    0x2E, 0x70, 0x9D, 0x4C, 0x0E, 0x56, 0x78, 0xCC, 0xA9, 0x57, 0xAB, 0xBC, 0xCB, 0x69, 0x4B, 0xF5,
-    0x97, 0xAC, 0xC0, 0xFC, 0xC9, 0x86, 0x79, 0x7C, 0xE1, 0x13, 0x8D, 0x18, 0x68, 0xC4, 0x3C, 0x23,
-    0x3B, 0x35, 0x1C, 0xB5, 0x68, 0x28, 0xD2, 0x50, 0xD9, 0x4C, 0xDA, 0x2A, 0x22, 0x15, 0xF5, 0x68,
-    0xD1, 0xCD, 0x06, 0x29, 0xC8, 0x34, 0xBD, 0x1B, 0x92, 0x91, 0xF8, 0xD0, 0x3F, 0xEF, 0x28, 0x10,
-    0xE8, 0xF6, 0xC9, 0xED, 0x06, 0x6B, 0x9B, 0x16, 0x0F, 0xC9, 0xF0, 0x04, 0x7B, 0xF2, 0x76, 0xD5,
-    0xA0, 0x8C, 0x7A, 0x91, 0xD2, 0x8E, 0x9B, 0x8B, 0xD6, 0x2E, 0x0E, 0x94, 0xAC, 0x7D, 0x39, 0x39,
-    0x39, 0x6B, 0x80, 0x14, 0x77, 0xEB, 0xA2, 0x40, 0xA3, 0xD6, 0x08, 0xDD, 0x50, 0xA0, 0xD2, 0xFD,
-    0x05, 0x9C, 0xEB, 0x37, 0x4F, 0xD1, 0x27, 0xDB, 0xED, 0x4B, 0xC6, 0xCB, 0x37, 0xB8, 0x54, 0xBD,
-    0x28, 0x9D, 0x2E, 0x42, 0x4A, 0x10, 0xF5, 0xFD, 0xC7, 0x8E, 0x45, 0xDD, 0xA8, 0x44, 0x51, 0x21,
-    0x95, 0xA3, 0x99, 0x9B, 0xBF, 0x02, 0xBD, 0xB7, 0xB7, 0x35, 0xB8, 0xF0, 0x0A, 0x03, 0x74, 0x2D,
-    0x02, 0x0B, 0x46, 0x7F, 0xFD, 0xD0, 0xF1, 0xAB, 0x9B, 0x7A, 0x51, 0x17, 0xB9, 0xA0, 0x11, 0x0D,
-    0xC1, 0x61, 0x0B, 0x7B, 0xE9, 0x32, 0x6C, 0x20, 0x77, 0x0B, 0x92, 0x46, 0x47, 0x95, 0x6E, 0x12,
-    0x97, 0xBA, 0x22, 0xC3, 0xCF, 0x11, 0xA6, 0xDF, 0x60, 0x1D, 0x31, 0x7D, 0xB4, 0x26, 0x0B, 0x64,
-    0xBA, 0x12, 0x0D, 0xCF, 0xC6, 0x9E, 0x5D, 0x2E, 0x0D, 0x02, 0x33, 0x46, 0xE3, 0x2C, 0xDC, 0xBD,
-    0xCF, 0x41, 0x05, 0xF4, 0x11, 0x22, 0x1C, 0x99, 0x70, 0x41, 0x95, 0x90, 0xAF, 0x4D, 0x92, 0xD2,
-    0x9D, 0x3C, 0xCC, 0x1E, 0xA8, 0x5D, 0x92, 0x36, 0xC0, 0x5A, 0xD9, 0xB2, 0xE4, 0x50, 0xC2, 0xFA,
-    0xD8, 0x81, 0xB5, 0xAA, 0x94, 0x55, 0x87, 0xAA, 0xBA, 0xE4, 0x11, 0xAC, 0xA9, 0xAD, 0x87, 0x96,
-    0xFE, 0xC6, 0x27, 0x14, 0xF6, 0x16, 0x0B, 0xC6, 0x9E, 0xDE, 0x70, 0x31, 0x9F, 0x9F, 0x78, 0xF1,
-    0x58, 0x18, 0x1D, 0x56, 0x39, 0xC5, 0xBD, 0x1B, 0x57, 0x99, 0xF6, 0x2F, 0xC0, 0x2C, 0x3E, 0x94,
-    0x48, 0xA3, 0xD2, 0x39, 0xDD, 0x97, 0x1B, 0xDE, 0x07, 0xD5, 0xA0, 0xF5, 0xFD, 0x0D, 0x83, 0xD6,
-    0xE6, 0x56, 0xB5, 0x3B, 0x1B, 0x94, 0x5D, 0xB9, 0x0B, 0x05, 0x67, 0x9D, 0x00, 0xBF, 0x3B, 0xE4,
-    0x23, 0x29, 0xD7, 0x73, 0x5C, 0xEE, 0x5E, 0xC4, 0x78, 0x53, 0xA4, 0x5D, 0xA9, 0xF9, 0x65, 0x38,
-    0xC9, 0x6D, 0x6A, 0xDC, 0xE9, 0x26, 0xAB, 0x96, 0x7A, 0x1A, 0xA7, 0x66, 0x82, 0xE0, 0xED, 0x35,
-    0x9B, 0xE0, 0xFC, 0x1D, 0x4F, 0x2E, 0xD5, 0x1C, 0x3D, 0x50, 0x52, 0x94, 0x99, 0x3C, 0x3D, 0xA4,
-    0x57, 0x9F, 0xB2, 0x2A, 0xD5, 0xA8, 0x98, 0xF8, 0xE5, 0x1F, 0x9C, 0x60, 0x5F, 0x96, 0xF4, 0xD0,
-    0x21, 0xBB, 0xEB, 0x61, 0x4C, 0x55, 0x88, 0x64, 0x83, 0xD2, 0xC7, 0x9B, 0x9F, 0x50, 0x60, 0x42,
-    0x42, 0xA1, 0x30, 0x1F, 0x0B, 0x3F, 0x65, 0x29, 0x0E, 0xC6, 0x76, 0x55, 0x9A, 0x53, 0xD9, 0xB4,
-    0xD7, 0xF6, 0x58, 0xA0, 0xF7, 0x7F, 0x6C, 0xC7, 0x42, 0x35, 0xA6, 0xCE, 0x39, 0xA6, 0xE0, 0x36,
-    0x77, 0x33, 0x6E, 0x77, 0x37, 0xE3, 0xB6, 0x77, 0x33, 0x6E, 0x7F, 0x37, 0xB3, 0x3D, 0x7E, 0xEB,
-    0x0E, 0x6F, 0xC6, 0x6D, 0xF1, 0x66, 0xDC, 0x1E, 0x6F, 0x66, 0x1B, 0x01, 0x38, 0x0D, 0x52, 0x77,
-    0x71, 0x97, 0x37, 0x93, 0x0B, 0xB0, 0xC0, 0xC9, 0xC7, 0xED, 0xF3, 0x66, 0xDC, 0x46, 0x6F, 0xC6,
-    0xED, 0xF4, 0x66, 0xDC, 0x56, 0x6F, 0xC6, 0xED, 0xF5, 0x66, 0xDC, 0x66, 0x6F, 0xC6, 0xED, 0xF6,
-    0x66, 0xDC, 0x76, 0x6F, 0xC6, 0xED, 0xF7, 0x66, 0xDC, 0x86, 0x6F, 0xC6, 0xED, 0xF8, 0x66, 0xDC,
-    0x96, 0x6F, 0xC6, 0xED, 0xF9, 0x66, 0x74, 0xD3, 0x37, 0x5A, 0x31, 0xF1, 0xDD, 0xEA, 0xB6, 0x6F,
-    0x63, 0x50, 0xDB, 0xE8, 0x82, 0x3E, 0xCA, 0xE0, 0x63, 0x30, 0xFB, 0xC8, 0xB0, 0x8E, 0xDE, 0xC1,
-    0x63, 0x34, 0x4E, 0x7E, 0xC8, 0xD7, 0x3C, 0xA2, 0xE5, 0x9F, 0x09, 0x7D, 0xF3, 0x3A, 0xA2, 0xA7,
-    0x26, 0x17, 0x8B, 0xAD, 0xA3, 0x1B, 0x19, 0xF2, 0xCD, 0xC0, 0xA3, 0xF7, 0x76, 0x0D, 0x1D, 0x61,
-    0x2E, 0xED, 0xDF, 0xA6, 0x5B, 0xB0, 0xB4, 0xBB, 0x93, 0x1F, 0x49, 0x16, 0x3F, 0x2F, 0x0C, 0x49,
-    0x8B, 0x8C, 0x50, 0x5D, 0x54, 0xE5, 0x48, 0x7B, 0xB2, 0x8D, 0xC0, 0x67, 0x11, 0xF5, 0xE1, 0x27,
-    0x5C, 0x25, 0xE7, 0x0A, 0xF4, 0x79, 0xBF, 0xC6, 0x8F, 0x68, 0xE0, 0x00, 0xE4, 0xCB, 0xC0, 0x5E,
-    0x41, 0x7E, 0xFB, 0xB4, 0x43, 0x5C, 0x6C, 0xA0, 0x64, 0xD2, 0xB9, 0xD7, 0xA7, 0x9B, 0x7D, 0xDA,
-    0xDE, 0xEC, 0x88, 0xF3, 0x85, 0xAE, 0x3E, 0x4D, 0xAE, 0x36, 0xAA, 0x90, 0xA2, 0x41, 0xD7, 0x62,
-    0xB0, 0x8B, 0x48, 0x49, 0x4F, 0x63, 0x65, 0x93, 0x23, 0xE9, 0xB5, 0x1E, 0xF4, 0xFD, 0x76, 0x99,
-    0x1E, 0x2E, 0xC9, 0x92, 0x8C, 0x99, 0x40, 0xC1, 0x01, 0x51, 0xFD, 0x38, 0x46, 0x86, 0xE8, 0xDE,
-    0x69, 0x34, 0x2A, 0x15, 0xC9, 0x5F, 0x6C, 0xD5, 0xBE, 0x2E, 0xE6, 0xC4, 0xB9, 0xAE, 0x1A, 0x75,
-    0x5D, 0xFD, 0xB2, 0x26, 0xCC, 0xA8, 0xCB, 0x0F, 0x7F, 0xBF, 0x83, 0x2F, 0x0E, 0x38, 0x4F, 0x41,
-    0x4E, 0x48, 0x49, 0xE6, 0x33, 0x69, 0x53, 0x5A, 0x79, 0xF6, 0xAD, 0xFE, 0xE9, 0x7D, 0x04, 0xC3,
-    0xBD, 0x16, 0xDA, 0x26, 0x61, 0x00, 0xA2, 0x31, 0x99, 0x67, 0xC6, 0xDE, 0xF2, 0xFD, 0xAE, 0xAC,
-    0xF5, 0xC7, 0xFC, 0x3D, 0xF0, 0xA3, 0xF9, 0x88, 0x39, 0x23, 0xCF, 0x15, 0x60, 0x5F, 0x25, 0x95,
-    0xD7, 0x00, 0x4A, 0x36, 0x23, 0xF8, 0x3F, 0xE3, 0xD1, 0xA4, 0x75, 0x72, 0x70, 0xF2, 0xAA, 0xDD,
-    0xB0, 0xB9, 0xAB, 0x9C, 0xAC, 0x89, 0xDB, 0x54, 0xC8, 0x70, 0x09, 0x3B, 0x22, 0x47, 0xC4, 0xF4,
-    0x9B, 0x41, 0xF5, 0x64, 0x2A, 0xC6, 0x5D, 0xC5, 0x5D, 0x28, 0x0A, 0xD2, 0xA9, 0x9D, 0x65, 0x2E,
-    0x21, 0xEE, 0xC4, 0xD8, 0xE9, 0x37, 0x78, 0x2C, 0xD4, 0x87, 0xB7, 0xE6, 0xE7, 0x2A, 0x33, 0x71,
-    0xA8, 0xB4, 0x49, 0xD0, 0x1D, 0xF0, 0xFA, 0xA2, 0x74, 0x1E, 0x81, 0x91, 0xCB, 0xE0, 0x12, 0x39,
-    0xEC, 0x4A, 0x77, 0xEB, 0x56, 0xBF, 0x39, 0xBA, 0x2E, 0x5D, 0x69, 0xE4, 0x7C, 0xAD, 0xF1, 0xCD,
-    0x6D, 0x71, 0x38, 0x21, 0x67, 0xE9, 0x2A, 0x1B, 0xDA, 0xDE, 0xD3, 0x3C, 0x69, 0x2D, 0xB6, 0x19,
-    0x4D, 0xFF, 0x3C, 0xBF, 0xF1, 0xC1, 0xD6, 0xCA, 0xCB, 0x4C, 0xD9, 0x10, 0x39, 0x05, 0x83, 0x52,
-    0x60, 0x6E, 0x36, 0xAA, 0xBC, 0x65, 0xAF, 0x3F, 0xA3, 0xA5, 0x47, 0x85, 0x37, 0x13, 0xFB, 0x32,
-    0xA9, 0xF1, 0xD5, 0x27, 0x65, 0x7A, 0x7F, 0x20, 0x32, 0x80, 0x33, 0x86, 0x91, 0x11, 0x05, 0x0F,
-    0xA9, 0xED, 0x99, 0xB9, 0x84, 0xF3, 0x56, 0xD3, 0x1C, 0x27, 0xD2, 0x8D, 0x47, 0x92, 0x5B, 0x5B,
-    0x3F, 0xB1, 0x7F, 0x53, 0x16, 0xBA, 0x39, 0x22, 0xC3, 0x39, 0x43, 0x0C, 0xF6, 0x59, 0x4E, 0x6B,
-    0xB0, 0xF2, 0x6B, 0x66, 0xC3, 0x82, 0x50, 0x89, 0xEE, 0xC7, 0xEB, 0x00, 0xF9, 0xCF, 0x73, 0xFF,
-    0x61, 0xBF, 0x36, 0x0D, 0x97, 0x33, 0x37, 0x70, 0xA5, 0x88, 0x4D, 0x3B, 0xE3, 0xA9, 0x4D, 0x0D,
-    0x44, 0xCE, 0xF0, 0x4B, 0x9B, 0x85, 0xFD, 0xAF, 0x61, 0x7F, 0x1D, 0x24, 0xF3, 0xA2, 0x2C, 0xC5,
-    0xBC, 0x50, 0xF1, 0x5B, 0x2B, 0x66, 0x56, 0xB6, 0xF6, 0x0A, 0x38, 0x56, 0x2B, 0xEC, 0xD4, 0x8B,
-    0xA3, 0xC2, 0x90, 0x44, 0x94, 0x63, 0xDD, 0xA9, 0xC5, 0xC2, 0xCB, 0xF2, 0xDD, 0x6F, 0x31, 0x09,
-    0x4E, 0xA6, 0xCA, 0x9E, 0x29, 0x88, 0x5F, 0x46, 0xDC, 0xA5, 0xDE, 0x63, 0x26, 0x61, 0xEC, 0x4C,
-    0x75, 0x9E, 0x59, 0x7F, 0x26, 0x6B, 0xBE, 0xAA, 0x5C, 0x74, 0x2D, 0xAB, 0x99, 0xD9, 0xE9, 0x2F,
-    0xBA, 0xB5, 0x82, 0xD8, 0xEB, 0x17, 0xF8, 0xEB, 0x37, 0xF2, 0x7F, 0xF7, 0xC8, 0xD8, 0x34, 0xEF,
-    0xCB, 0x29, 0x72, 0x57, 0x79, 0x62, 0xBF, 0x9B, 0xB2, 0x2E, 0xB8, 0x55, 0x1A, 0xAF, 0x74, 0x53,
-    0xA3, 0x19, 0x1C, 0x42, 0x45, 0x30, 0xBB, 0x0E, 0xAF, 0x67, 0xA6, 0xCA, 0x86, 0x91, 0x3A, 0x1B,
-    0x59, 0xE2, 0x47, 0xCF, 0x62, 0x88, 0x06, 0xE6, 0x2A, 0x2D, 0x82, 0xDD, 0xA7, 0xAC, 0x48, 0x63,
-    0xEA, 0x02, 0x6B, 0x27, 0x4F, 0xD6, 0x76, 0xEC, 0x7B, 0xFC, 0x86, 0xB4, 0xC6, 0xB2, 0x3F, 0x58,
-    0x63, 0x8C, 0x30, 0x78, 0xB3, 0xD5, 0xED, 0xFF, 0x88, 0x6C, 0x12, 0x11, 0x9A, 0x11, 0xDC, 0x73,
-    0x35, 0x47, 0x7E, 0x3E, 0x28, 0xB3, 0xC0, 0x81, 0x33, 0xF4, 0xD9, 0x23, 0x52, 0x8D, 0x2A, 0xCD,
-    0x58, 0x42, 0x4B, 0x16, 0xCB, 0xDE, 0xF1, 0x61, 0x78, 0xBF, 0x34, 0x03, 0xF8, 0xB0, 0x81, 0xE7,
-    0x60, 0x88, 0x44, 0x0C, 0xD8, 0xE3, 0x1A, 0x3C, 0xC6, 0xC3, 0x07, 0x02, 0xD3, 0x4E, 0xCD, 0x29,
-    0xD5, 0x9F, 0xD7, 0x80, 0xFB, 0x61, 0x5E, 0xAE, 0x3C, 0xD7, 0x78, 0xEA, 0xE2, 0xD2, 0xD1, 0xDD,
-    0xD8, 0xD7, 0xE0, 0x10, 0x69, 0x6E, 0xF9, 0x26, 0x1A, 0xAA, 0xC3, 0x0C, 0xBB, 0x09, 0xC6, 0x11,
-    0xCA, 0x7D, 0xEE, 0xED, 0xCE, 0x6D, 0x25, 0xB3, 0x68, 0xF7, 0x5C, 0xAB, 0x91, 0xAC, 0xBA, 0x51,
-    0xC7, 0x59, 0x17, 0x4D, 0x39, 0xFA, 0xA4, 0xA4, 0xCE, 0x1B, 0xC5, 0xB1, 0x37, 0x63, 0xC5, 0xA1,
-    0xA6, 0x1D, 0xF9, 0xFB, 0x7F, 0x65, 0xFF, 0xEE, 0x87, 0x94, 0x2C, 0x29, 0x1C, 0xBA, 0x70, 0x21,
-    0x24, 0xDC, 0xAD, 0x35, 0x36, 0xF0, 0xE1, 0x3B, 0x8D, 0xCF, 0x03, 0xA7, 0x75, 0x12, 0x7A, 0x2B,
-    0x10, 0xB2, 0x8A, 0x0B, 0xCD, 0xFE, 0xB1, 0x0D, 0x31, 0xFE, 0xE8, 0x1C, 0x53, 0x01, 0xAA, 0x9B,
-    0xED, 0x7C, 0x24, 0x32, 0x62, 0xA1, 0x3C, 0xBD, 0xC2, 0x60, 0x71, 0xC0, 0xDB, 0x7D, 0x39, 0xCA,
-    0x0B, 0x8D, 0x79, 0xF4, 0x29, 0xA6, 0xF4, 0x3F, 0x0F, 0x0D, 0xCC, 0x79, 0x73, 0xEA, 0x0F, 0xCB,
-    0x7A, 0x34, 0xD3, 0x46, 0x53, 0x50, 0x53, 0x7A, 0x20, 0x51, 0x19, 0x1F, 0x68, 0x7F, 0x1D, 0xBC,
-    0x49, 0x79, 0xFD, 0xA2, 0xFD, 0xAE, 0xD5, 0x0C, 0x61, 0x3D, 0x53, 0x6E, 0x93, 0xAB, 0xC1, 0x88,
-    0x80, 0xD3, 0x09, 0x40, 0x72, 0x37, 0xB9, 0x9C, 0xCF, 0x68, 0x77, 0xA6, 0x64, 0x4C, 0x80, 0xF9,
-    0xBC, 0x63, 0x0D, 0xD8, 0x7E, 0x3B, 0xF6, 0xE1, 0x0E, 0x85, 0xC6, 0x79, 0x69, 0x79, 0x50, 0x40,
-    0x79, 0x7F, 0x58, 0x4E, 0xC1, 0xD5, 0x74, 0xFF, 0x59, 0xA7, 0x4B, 0x2B, 0x47, 0x1D, 0x0E, 0xAB,
-    0xCA, 0x7F, 0x83, 0xB4, 0x1D, 0xE5, 0xD5, 0x67, 0xEC, 0x1B, 0x50, 0xC3, 0x43, 0x5B, 0xEE, 0x3A,
-    0xEE, 0xD4, 0xAC, 0x0D, 0xA0, 0xFE, 0x6B, 0x8B, 0xC5, 0xC5, 0xDA, 0xB9, 0x54, 0xA8, 0x39, 0xDF,
-    0x0D, 0xFD, 0xC8, 0x09, 0x85, 0xF5, 0xB8, 0x77, 0xDB, 0x79, 0x20, 0x9A, 0x56, 0xD3, 0x80, 0x08,
-    0x3E, 0x5C, 0xBA, 0xE6, 0x05, 0xA3, 0x9C, 0x76, 0xD4, 0x3C, 0xE4, 0x39, 0x06, 0x40, 0x1A, 0xFA,
-    0xDF, 0xCD, 0x4C, 0xC4, 0xD3, 0x1B, 0xB6, 0xC8, 0x31, 0x5C, 0x5B, 0x20, 0x4E, 0xA7, 0xE6, 0x73,
-    0xA6, 0x6A, 0xE9, 0x46, 0x85, 0x9F, 0xA6, 0x16, 0x58, 0x13, 0x6A, 0xF3, 0x00, 0x6E, 0x26, 0xEF,
-    0xA1, 0x91, 0x29, 0xB7, 0x39, 0x12, 0x76, 0xE4, 0xD1, 0xF9, 0xFC, 0x40, 0x0E, 0x9E, 0xCF, 0x6A,
-    0xDF, 0x2B, 0x25, 0x4A, 0x6E, 0x5B, 0x32, 0x4C, 0x13, 0x51, 0xC3, 0xB1, 0xA4, 0xEA, 0x81, 0x1C,
-    0x35, 0xE2, 0x80, 0x58, 0x18, 0x71, 0xA6, 0x59, 0x42, 0xE1, 0x28, 0x56, 0xF8, 0x2C, 0xB7, 0x0D,
-    0xD3, 0x97, 0x11, 0x1B, 0x29, 0x62, 0x52, 0x1C, 0x75, 0x67, 0xFA, 0x23, 0xAB, 0xE5, 0xBC, 0x71,
-    0x7B, 0x83, 0x86, 0xCC, 0x0F, 0x11, 0x22, 0x86, 0xB4, 0x42, 0x98, 0x48, 0xD8, 0x12, 0xE4, 0x2D,
-    0xD7, 0x8C, 0x3A, 0xB2, 0xB8, 0xEC, 0x3B, 0x9A, 0x8A, 0x27, 0x62, 0x34, 0x55, 0x30, 0xA8, 0x39,
-    0x7B, 0x23, 0x5B, 0x5C, 0xC8, 0x14, 0x5D, 0xFE, 0xE6, 0x89, 0xF4, 0x3D, 0xB2, 0xEA, 0xEF, 0xAB,
-    0x97, 0xBF, 0x3E, 0x8A, 0x68, 0x6B, 0xE0, 0x3B, 0xCA, 0x8C, 0x99, 0xB8, 0x8B, 0xB0, 0x67, 0x30,
-    0x50, 0x39, 0x5C, 0x40, 0x98, 0x85, 0x75, 0x19, 0x23, 0x86, 0x29, 0x15, 0x14, 0xBA, 0xE1, 0x93,
-    0xE8, 0x23, 0x62, 0x39, 0xC9, 0x8E, 0x10, 0x7D, 0x9A, 0x1E, 0x91, 0xC9, 0x29, 0x04, 0xBA, 0x2F,
-    0xAF, 0x6E, 0x61, 0x83, 0x2D, 0x6E, 0xD6, 0xCE, 0x5C, 0x35, 0xCC, 0x53, 0x83, 0x8C, 0xF2, 0x9A,
-    0x65, 0x0E, 0xFA, 0x71, 0x28, 0xCA, 0x4D, 0x0A, 0x77, 0xC5, 0x61, 0xC7, 0xE5, 0x88, 0x8D, 0x90,
-    0x87, 0xA6, 0xA4, 0x6D, 0x92, 0x59, 0x97, 0xE2, 0xDD, 0x67, 0x18, 0x5D, 0xBB, 0x54, 0xBC, 0xB0,
-    0x99, 0x4A, 0xE5, 0xFF, 0xE7, 0xDF, 0x3B, 0x36, 0xFF, 0xDE, 0x3D, 0x41, 0xA2, 0x26, 0x92, 0x62,
-    0x40, 0xA4, 0x12, 0x0E, 0xE8, 0x33, 0x84, 0xE5, 0xD4, 0x3E, 0x71, 0xCF, 0x97, 0x4E, 0x2D, 0x62,
-    0xCF, 0x6B, 0xF8, 0x05, 0x73, 0xCA, 0xF6, 0x1A, 0xE9, 0xC8, 0x1C, 0x7F, 0x91, 0x03, 0x38, 0x37,
-    0x6E, 0x76, 0xD4, 0x21, 0xCB, 0x80, 0x6E, 0x40, 0xA2, 0xA5, 0xC8, 0x8C, 0x5D, 0xAC, 0x90, 0x55,
-    0x63, 0x1D, 0xC9, 0x21, 0xB3, 0xCC, 0x88, 0x7C, 0x37, 0x69, 0x09, 0x32, 0x4F, 0xCA, 0x3C, 0x5E,
-    0x77, 0x16, 0x1A, 0x06, 0x53, 0xA9, 0xC3, 0xD7, 0xC4, 0x78, 0xDE, 0x17, 0x0C, 0x16, 0x0A, 0x83,
-    0xF1, 0x1A, 0x06, 0x45, 0xCA, 0xB9, 0xB0, 0x3F, 0x35, 0x76, 0x82, 0x41, 0x84, 0x6E, 0x44, 0xEF,
-    0x40, 0xCB, 0x18, 0x6D, 0xC2, 0x60, 0x7F, 0x18, 0x06, 0xC1, 0x83, 0x28, 0x92, 0x21, 0xBA, 0xD1,
-    0xE2, 0xF1, 0x4B, 0xFD, 0xB4, 0x63, 0x28, 0xE4, 0xFE, 0x94, 0x81, 0xE6, 0x1F, 0x98, 0xC7, 0xB8,
-    0xAC, 0xE2, 0x75, 0xF6, 0x16, 0xE6, 0x09, 0xBD, 0x53, 0x66, 0x17, 0xB7, 0x7B, 0xAD, 0x6E, 0x64,
-    0xFB, 0xEC, 0x42, 0x45, 0x6C, 0xBF, 0x3B, 0x94, 0x3C, 0x86, 0x7C, 0x89, 0x3E, 0x61, 0xED, 0xBC,
-    0x1B, 0xB5, 0x3E, 0x90, 0x8B, 0x08, 0xE6, 0x17, 0x35, 0x09, 0xCD, 0x12, 0x99, 0x2F, 0xC7, 0x48,
-    0x54, 0x20, 0x77, 0xB0, 0xC9, 0xD8, 0x8E, 0x09, 0xDF, 0x07, 0x90, 0xFD, 0x67, 0xB5, 0x03, 0x10,
-    0x49, 0x32, 0xE4, 0x9B, 0x6A, 0x3C, 0x6A, 0xCD, 0x21, 0xFA, 0xE2, 0xB7, 0x2A, 0xA8, 0xAB, 0xA6,
-    0x44, 0x37, 0xB7, 0xD0, 0x1D, 0xD7, 0xE9, 0xC1, 0x49, 0x9B, 0xAF, 0x74, 0x59, 0x23, 0x76, 0x4A,
-    0xF5, 0x7B, 0x67, 0x25, 0xF7, 0xDC, 0xD4, 0xC4, 0xBE, 0x9A, 0x23, 0x4E, 0xB3, 0xF1, 0x01, 0xE9,
-    0x91, 0xEF, 0xE3, 0x38, 0x39, 0xCC, 0xC8, 0x35, 0x9D, 0x68, 0xA6, 0xB3, 0x66, 0x43, 0xCF, 0xB4,
-    0x5A, 0xBB, 0x0D, 0x80, 0xD8, 0x04, 0xEC, 0x5E, 0xA0, 0xBE, 0x85, 0x6A, 0x45, 0x52, 0x3C, 0x84,
-    0x94, 0xE8, 0x9A, 0x34, 0x81, 0x07, 0xFE, 0x5C, 0xE7, 0x79, 0x7A, 0xF0, 0xB6, 0x57, 0x20, 0xFB,
-    0xA9, 0xC8, 0x20, 0xA4, 0x46, 0xCB, 0x21, 0x86, 0xE3, 0x95, 0x6F, 0xBF, 0x34, 0xD3, 0x00, 0x15,
-    0x9C, 0xE2, 0xBB, 0x12, 0xAF, 0x66, 0xE9, 0x18, 0x89, 0xE6, 0x01, 0x9C, 0x90, 0xD3, 0xAF, 0x60,
-    0x8B, 0xA8, 0x88, 0xCE, 0x2D, 0x71, 0xC5, 0xFC, 0xC0, 0x4F, 0x74, 0xC6, 0x65, 0xCD, 0x34, 0x4D,
-    0x78, 0x9C, 0x66, 0xF4, 0x97, 0x66, 0x5A, 0xCC, 0xE2, 0xF4, 0xCB, 0xD0, 0x40, 0x3A, 0x45, 0x09,
-    0x92, 0x82, 0x98, 0xA8, 0x10, 0x9C, 0xFD, 0x38, 0x54, 0xF8, 0x8F, 0x1C, 0xC0, 0x95, 0x63, 0xF0,
-    0x0D, 0xB5, 0x11, 0x9C, 0x9B, 0x50, 0xF7, 0x8A, 0x0B, 0x0F, 0xCC, 0x4D, 0x36, 0xCE, 0x0D, 0xB3,
-    0x88, 0xDF, 0x61, 0x6E, 0xC2, 0x83, 0x73, 0xE3, 0xDD, 0x7D, 0x6E, 0x30, 0x8C, 0x7F, 0x7F, 0x68,
-    0x6E, 0x08, 0x40, 0xB0, 0x42, 0xD0, 0x17, 0x40, 0x4A, 0xAF, 0x1D, 0x0B, 0x54, 0x50, 0x32, 0x5C,
-    0x4A, 0x8D, 0xBA, 0xE9, 0x9D, 0xEC, 0x90, 0x4D, 0x3B, 0x41, 0x2F, 0x91, 0x6F, 0xAF, 0x15, 0x72,
-    0x00, 0x7E, 0x6B, 0xF0, 0xC8, 0xC5, 0x3C, 0x66, 0xCF, 0xDF, 0xDD, 0xB4, 0x76, 0xF4, 0x70, 0xC6,
-    0xCB, 0x08, 0xF8, 0x20, 0xF8, 0x5C, 0xD5, 0x87, 0x69, 0xD1, 0xE6, 0x0E, 0x86, 0x07, 0xB6, 0x34,
-    0xDC, 0x1F, 0xB7, 0x34, 0x2C, 0xD5, 0x9B, 0x2E, 0xFC, 0x99, 0xBD, 0x5E, 0xD2, 0x09, 0xC9, 0x2B,
-    0x87, 0x73, 0x9F, 0x9C, 0xC2, 0x82, 0x99, 0x32, 0x9C, 0xAD, 0xFB, 0xE3, 0xCF, 0x2E, 0x53, 0x46,
-    0xA7, 0x06, 0x3C, 0x75, 0x93, 0x3E, 0x90, 0xB3, 0xE3, 0x70, 0xC5, 0x3A, 0x70, 0xEA, 0x3D, 0x6B,
-    0x6F, 0xDF, 0xF3, 0x56, 0x5C, 0x7B, 0x19, 0x20, 0xD8, 0xDE, 0xF1, 0xD2, 0x91, 0xC4, 0x3B, 0x3D,
-    0x9E, 0xEA, 0x9A, 0x9C, 0xA6, 0xE9, 0x4E, 0x7C, 0x3E, 0x59, 0x1F, 0x35, 0xEB, 0xAB, 0x5D, 0xFF,
-    0x9E, 0x7F, 0x40, 0x66, 0x45, 0x76, 0x92, 0x5D, 0xFC, 0xA0, 0x5E, 0xF0, 0x32, 0xB7, 0x36, 0xC1,
-    0x65, 0x65, 0x85, 0xCB, 0xFC, 0x9E, 0x3F, 0x04, 0x9F, 0x5D, 0xA6, 0x4B, 0x7B, 0xA7, 0x09, 0x52,
-    0x2F, 0xAB, 0x1B, 0xED, 0x74, 0xC6, 0xD3, 0xCB, 0x52, 0xDE, 0x23, 0xCC, 0x56, 0xC7, 0x7D, 0x48,
-    0x98, 0xF8, 0x24, 0xC3, 0x0F, 0x84, 0xF8, 0x57, 0x8E, 0x0D, 0x48, 0x35, 0x31, 0x05, 0xFD, 0x87,
-    0x6B, 0x20, 0xA2, 0xE3, 0xB5, 0x96, 0x77, 0xD8, 0xDF, 0xF0, 0x68, 0x35, 0xB6, 0x3D, 0x81, 0x3A,
-    0x72, 0xC9, 0x6D, 0x0F, 0x97, 0xA8, 0xCE, 0x2B, 0x5C, 0x9D, 0x67, 0x4C, 0x69, 0x71, 0x78, 0xDB,
-    0x43, 0x56, 0xCF, 0xBA, 0xF1, 0x6A, 0x6E, 0x7E, 0xC0, 0x16, 0xF6, 0xFF, 0x6C, 0xE9, 0x4D, 0x34,
-    0x50, 0x7B, 0x3C, 0x28, 0xE0, 0x1D, 0x3C, 0x78, 0x70, 0x30, 0x63, 0x7E, 0x32, 0x9F, 0xEA, 0xD2,
-    0xB3, 0x9F, 0x66, 0x1A, 0x94, 0xA1, 0x20, 0x7E, 0x25, 0x8E, 0x0D, 0x37, 0x3E, 0x70, 0x8E, 0xDE,
-    0xAA, 0x98, 0x4D, 0x8E, 0xDA, 0xE2, 0x33, 0x63, 0x88, 0x05, 0xA6, 0x82, 0x11, 0x09, 0x11, 0xD3,
-    0xEB, 0xE6, 0x2E, 0xC2, 0x22, 0x60, 0xAE, 0x60, 0xEE, 0xEC, 0xA0, 0x58, 0xD6, 0x05, 0x58, 0xC4,
-    0xEF, 0x50, 0x45, 0x46, 0x99, 0x45, 0x8D, 0x6C, 0x8C, 0xAC, 0x50, 0xFC, 0xC9, 0xC4, 0x79, 0x22,
-    0x1D, 0x4E, 0xE1, 0x15, 0x94, 0x08, 0xBC, 0x4E, 0xF3, 0x79, 0x87, 0xB5, 0x8B, 0xAE, 0x80, 0xE5,
-    0x74, 0x49, 0xCD, 0x29, 0x37, 0x94, 0x49, 0x0B, 0x0D, 0xAE, 0x60, 0xD2, 0xD3, 0xFD, 0xDA, 0x8C,
-    0xD9, 0x39, 0xD2, 0xB5, 0xA1, 0x36, 0x58, 0x3B, 0x8A, 0xFF, 0xEB, 0x61, 0x0A, 0xE4, 0xD0, 0x78,
-    0xB1, 0x31, 0x81, 0xE8, 0xA7, 0x1A, 0x5A, 0x51, 0x1F, 0x0A, 0xAD, 0x18, 0x5E, 0xBE, 0x7B, 0x68,
-    0xC5, 0x29, 0x8C, 0x04, 0xE7, 0x55, 0xB3, 0xB4, 0x9D, 0x62, 0x0E, 0x50, 0x93, 0x3C, 0xC7, 0x30,
-    0x70, 0x0D, 0x62, 0xA1, 0x1A, 0x54, 0x47, 0x98, 0x0F, 0xD6, 0x10, 0x16, 0x5F, 0x47, 0x88, 0x03,
-    0x9C, 0x7F, 0xB3, 0x72, 0x21, 0x2A, 0xCF, 0x5E, 0xB4, 0x8B, 0xF3, 0x21, 0xF1, 0x7D, 0xC9, 0x44,
-    0x34, 0x73, 0x7B, 0xEB, 0xAC, 0x1B, 0x7B, 0x1D, 0xDE, 0x81, 0x39, 0xA7, 0x35, 0xB3, 0x93, 0xA6,
-    0x65, 0xD1, 0x0D, 0xE6, 0xB1, 0x17, 0x86, 0xE3, 0x50, 0x22, 0x26, 0x4C, 0x29, 0xB9, 0xE3, 0x9B,
-    0x06, 0xAE, 0xAC, 0x46, 0x3B, 0xFE, 0x0C, 0x6D, 0xA2, 0xDF, 0x24, 0xD5, 0xD7, 0x74, 0x98, 0x1C,
-    0x5C, 0xF2, 0xF1, 0xF8, 0xDD, 0x5A, 0xC7, 0xEA, 0x8B, 0x17, 0xEC, 0xF5, 0xF3, 0x4C, 0x25, 0x15,
-    0xB9, 0x14, 0xC2, 0x95, 0xD3, 0x2C, 0x24, 0xB0, 0x70, 0xE4, 0x9A, 0xE7, 0x84, 0xA1, 0xF2, 0x29,
-    0x32, 0xD3, 0xC6, 0x4B, 0xE4, 0x94, 0x86, 0x30, 0x15, 0x74, 0xFF, 0x07, 0xBD, 0x58, 0x3F, 0x6C,
-    0x26, 0xC5, 0x15, 0x7F, 0xBB, 0x6B, 0xDF, 0x8A, 0x5B, 0xC1, 0x50, 0x60, 0x89, 0x3F, 0x12, 0xDB,
-    0xD0, 0x80, 0x74, 0xDE, 0x36, 0x85, 0xED, 0x99, 0x3B, 0x94, 0x5C, 0x91, 0x02, 0x17, 0x98, 0x14,
-    0x14, 0xA1, 0xA0, 0x88, 0x2E, 0x52, 0x8E, 0x26, 0xD2, 0x45, 0xB2, 0xBD, 0x8B, 0x5C, 0xA4, 0x48,
-    0xC1, 0x49, 0x09, 0x55, 0x1A, 0x0A, 0x22, 0x1D, 0x9F, 0x04, 0x6E, 0x28, 0x4C, 0xF2, 0x7D, 0xB7,
-    0x0B, 0x56, 0x44, 0x41, 0xB3, 0xF8, 0x0A, 0x8A, 0x14, 0x6C, 0x0E, 0x14, 0x94, 0x9C, 0x94, 0x4C,
-    0x92, 0x25, 0x2C, 0xE7, 0xDD, 0x6F, 0xF2, 0x7B, 0x33, 0xBB, 0x9F, 0xFD, 0x99, 0x70, 0xB9, 0xF8,
-    0x08, 0x6B, 0x7F, 0x33, 0x3B, 0x6F, 0xE6, 0xBD, 0x79, 0xEF, 0xCD, 0x9B, 0xF7, 0x67, 0x69, 0x9D,
-    0xCE, 0x91, 0xFF, 0xE1, 0x68, 0x62, 0xCC, 0x38, 0x7C, 0x25, 0xDC, 0x79, 0x2F, 0xD3, 0xB4, 0x42,
-    0x82, 0x82, 0x82, 0xEE, 0xF6, 0xE5, 0x2C, 0x91, 0xA7, 0xBC, 0x0A, 0x7F, 0xB7, 0xDF, 0xC8, 0xCD,
-    0x07, 0x4A, 0xBF, 0xBD, 0x72, 0xF6, 0x7F, 0x22, 0xD0, 0xBF, 0x7C, 0xE7, 0xD2, 0xE8, 0xD7, 0x66,
-    0x9A, 0x9B, 0x3F, 0x6E, 0x3C, 0x7B, 0xF4, 0x96, 0x1A, 0x63, 0x6E, 0xE3, 0x67, 0xBE, 0xE0, 0xA6,
-    0xB8, 0x34, 0x1A, 0x8D, 0x12, 0xBC, 0xFC, 0x01, 0xBF, 0x7A, 0x63, 0x83, 0x57, 0xF6, 0x8F, 0xE9,
-    0x9F, 0xC3, 0xE1, 0xE5, 0xF7, 0x1B, 0xFD, 0x73, 0x17, 0x4B, 0x9E, 0xA4, 0x47, 0xD6, 0x48, 0x7E,
-    0x9B, 0xFF, 0xE4, 0x1E, 0x01, 0x2E, 0x6E, 0x0C, 0xB2, 0xF4, 0x30, 0x0A, 0x18, 0x80, 0x5F, 0xB7,
-    0x04, 0x28, 0x79, 0x5A, 0x14, 0xDB, 0x7E, 0x2D, 0x8A, 0x34, 0x68, 0x44, 0x95, 0xAA, 0x67, 0x29,
-    0xD2, 0xB2, 0x98, 0x06, 0x3A, 0x2E, 0xAE, 0x07, 0x5A, 0x64, 0x5B, 0xB4, 0x4E, 0xA2, 0x9A, 0xC6,
-    0x07, 0x6D, 0xB2, 0xA3, 0x65, 0x58, 0x8E, 0x17, 0x55, 0x7A, 0xBE, 0x0B, 0x9A, 0x08, 0x0B, 0xA4,
-    0x9A, 0x50, 0xE3, 0x6B, 0x1C, 0x8F, 0x0E, 0x33, 0x49, 0x4D, 0x58, 0xC5, 0x6A, 0x12, 0x80, 0x96,
-    0xF4, 0x5A, 0x50, 0xC9, 0xA6, 0x41, 0x13, 0x97, 0xE9, 0x85, 0xCE, 0x5B, 0x5F, 0x54, 0x91, 0x4E,
-    0x32, 0x13, 0xB4, 0xA2, 0x92, 0xE7, 0xDB, 0x10, 0xB8, 0x39, 0xF6, 0x2C, 0x25, 0xB5, 0x41, 0x25,
-    0xB2, 0x4D, 0x0F, 0x34, 0x96, 0xB0, 0x8D, 0xDC, 0x69, 0xE2, 0x0F, 0xBB, 0x50, 0xE7, 0x7E, 0x0B,
-    0x6C, 0xD0, 0x01, 0x1B, 0x2F, 0xD7, 0xD8, 0xD4, 0xD7, 0x4B, 0xE0, 0x23, 0xF5, 0xDA, 0xB0, 0x8E,
-    0x4B, 0x4C, 0xF9, 0x20, 0x14, 0x17, 0x29, 0xD0, 0x75, 0x54, 0x26, 0x6A, 0xCD, 0x03, 0x1B, 0xA2,
-    0x58, 0xA4, 0x87, 0xE8, 0x6C, 0x46, 0x94, 0x42, 0xCA, 0x16, 0x82, 0x6A, 0x68, 0xA0, 0x20, 0x5A,
-    0xC3, 0x70, 0x8F, 0x16, 0xFC, 0x72, 0x31, 0x37, 0x66, 0x0A, 0xC9, 0xFF, 0xF5, 0x9B, 0x77, 0x2E,
-    0x65, 0x7E, 0x49, 0x14, 0x61, 0xF1, 0xB2, 0x9D, 0xA5, 0xA0, 0xC2, 0x62, 0x0C, 0xE5, 0x3C, 0xEE,
-    0x89, 0x21, 0x28, 0x7B, 0x18, 0x86, 0x35, 0x51, 0x0C, 0x7C, 0xDE, 0x4C, 0xAA, 0xB9, 0x15, 0x89,
-    0x25, 0x27, 0x6F, 0x59, 0xAB, 0x82, 0x95, 0xED, 0x6A, 0x4B, 0xFD, 0x18, 0xB9, 0x6E, 0x7E, 0xB8,
-    0x47, 0x4B, 0x17, 0xAA, 0xE7, 0x7A, 0x93, 0xF9, 0x7C, 0x7D, 0x6F, 0x29, 0xF3, 0xAB, 0xAF, 0xEC,
-    0xCD, 0x9B, 0xAD, 0x53, 0x5E, 0xC5, 0x66, 0xC7, 0xB4, 0xD2, 0xEC, 0xF7, 0x4D, 0x6C, 0x54, 0x82,
-    0x19, 0xAF, 0xA4, 0x50, 0x53, 0xDC, 0x50, 0x3A, 0xF5, 0x8C, 0xB9, 0x68, 0xBA, 0xD8, 0x64, 0x69,
-    0xE5, 0x75, 0x14, 0x2A, 0x3E, 0xF0, 0x47, 0x92, 0x8F, 0x0F, 0xA7, 0xF9, 0xF7, 0x68, 0x11, 0x34,
-    0x64, 0x11, 0xB4, 0x69, 0x19, 0x74, 0x92, 0x7F, 0x78, 0x67, 0x18, 0xFF, 0xE8, 0x11, 0xA1, 0xC9,
-    0x50, 0xFC, 0x59, 0x47, 0x69, 0x11, 0xB5, 0x46, 0xC5, 0xDA, 0x37, 0xBC, 0x80, 0xD2, 0x97, 0x15,
-    0xD4, 0x7A, 0x46, 0x2D, 0x02, 0xF1, 0x06, 0x70, 0xD6, 0x2F, 0x8D, 0xA0, 0xC6, 0x53, 0x5C, 0x40,
-    0x7E, 0xF1, 0x0B, 0x1A, 0x8D, 0x52, 0x73, 0x0A, 0xCC, 0xFE, 0xE5, 0x81, 0xD4, 0x7C, 0x64, 0xBA,
-    0x13, 0x0D, 0x66, 0x04, 0x9D, 0xAA, 0x01, 0xFA, 0xE8, 0xDA, 0x4B, 0x14, 0x12, 0xD9, 0xE6, 0xA7,
-    0x1B, 0x17, 0xEF, 0x8D, 0xDA, 0xC1, 0xE8, 0x4D, 0xA2, 0x92, 0xEE, 0xB7, 0xCD, 0xD2, 0xC6, 0x3D,
-    0xF1, 0x76, 0xEC, 0xC1, 0xD1, 0x52, 0x54, 0xF0, 0x5B, 0x08, 0xDD, 0x51, 0x63, 0x81, 0x5D, 0x52,
-    0x58, 0x6B, 0xC3, 0xB4, 0x1A, 0x53, 0x58, 0xD9, 0xBB, 0xAD, 0x61, 0xC7, 0xAD, 0x05, 0x4A, 0xD8,
-    0x7D, 0x9C, 0x59, 0x60, 0x05, 0xB0, 0xA3, 0xC7, 0xAE, 0x61, 0x8B, 0x06, 0xA0, 0x28, 0x06, 0xA0,
-    0x5F, 0xCF, 0x80, 0x6B, 0xDE, 0x3A, 0xD1, 0xB3, 0x8C, 0x1E, 0xBD, 0x6B, 0x2A, 0x4A, 0x71, 0xB3,
-    0xC2, 0xB2, 0x49, 0x4D, 0x16, 0x1B, 0x5C, 0xD5, 0x56, 0x8A, 0xB2, 0x0B, 0x6A, 0xA9, 0xF2, 0xFC,
-    0xE7, 0x55, 0x13, 0x54, 0x6B, 0xD4, 0x04, 0xA6, 0x6A, 0x63, 0x05, 0xD7, 0x20, 0x8A, 0x33, 0xAF,
-    0xC5, 0x17, 0xB4, 0xAF, 0xC7, 0x34, 0x66, 0x56, 0x12, 0x8A, 0xBF, 0x5F, 0x84, 0xD8, 0x63, 0x12,
-    0x68, 0xAF, 0x6E, 0x79, 0x63, 0x5C, 0x69, 0x8A, 0x9F, 0x29, 0xC2, 0x92, 0x7C, 0xAC, 0xF3, 0xEA,
-    0x31, 0x6D, 0xF2, 0xFE, 0x09, 0x25, 0x51, 0x01, 0x01, 0x45, 0xE1, 0xD5, 0x81, 0xDE, 0x82, 0x04,
-    0x5E, 0x83, 0xDB, 0xB8, 0xC6, 0xCE, 0x81, 0xAF, 0xC1, 0x44, 0x94, 0xC9, 0xD3, 0x35, 0x01, 0x2D,
-    0x30, 0x0D, 0x99, 0xA9, 0xBD, 0x17, 0x62, 0x8A, 0x91, 0x15, 0x90, 0x2D, 0xDB, 0x53, 0x34, 0xFF,
-    0x78, 0x3C, 0xB7, 0x35, 0x8C, 0x22, 0xD6, 0x5B, 0x3B, 0x8C, 0xC4, 0x9F, 0xB0, 0x43, 0x3D, 0x8C,
-    0x12, 0xB8, 0xB1, 0x60, 0xA6, 0x6F, 0xD6, 0x5B, 0x54, 0x1E, 0x8D, 0xA4, 0x75, 0x0B, 0x34, 0x53,
-    0x5F, 0x32, 0xDB, 0x61, 0xDB, 0xAE, 0x3D, 0x3E, 0x6A, 0x8F, 0x8F, 0x8E, 0x36, 0x60, 0xBC, 0x40,
-    0x2F, 0x2A, 0x1A, 0x54, 0x0B, 0x65, 0xE5, 0x35, 0x25, 0x1D, 0xD8, 0x52, 0x09, 0x6D, 0x8B, 0x7D,
-    0xD8, 0x49, 0x8E, 0x57, 0x53, 0xC6, 0x45, 0x9B, 0x5C, 0xD4, 0xB9, 0xD7, 0xC1, 0xBB, 0x5E, 0xD4,
-    0xC2, 0x34, 0x6B, 0xA2, 0x48, 0x2E, 0xD4, 0x51, 0x39, 0xF1, 0x58, 0xD1, 0x63, 0x51, 0xC4, 0x3B,
-    0x38, 0xE3, 0x16, 0x5B, 0x5D, 0x52, 0x4D, 0x9C, 0x89, 0x7D, 0x1C, 0x59, 0xEB, 0xDC, 0x04, 0x46,
-    0xEF, 0x0F, 0xA3, 0xB0, 0x8C, 0x95, 0x1D, 0x35, 0x7C, 0x16, 0xC0, 0x3A, 0x36, 0x8A, 0xD5, 0x71,
-    0x3C, 0x96, 0xEF, 0x68, 0x34, 0xA1, 0x63, 0x3B, 0xC0, 0xD0, 0x8E, 0x76, 0xC7, 0x89, 0xC1, 0xCB,
-    0xE4, 0xE4, 0x38, 0x63, 0x7F, 0xE9, 0x3B, 0xAE, 0x61, 0x17, 0xD6, 0x5D, 0x39, 0x89, 0x42, 0xA3,
-    0x66, 0x47, 0x62, 0xA5, 0x85, 0x7A, 0xE3, 0x42, 0x94, 0x61, 0xC5, 0x46, 0x00, 0xA2, 0x9B, 0x6C,
-    0x97, 0x56, 0xEB, 0xF0, 0x57, 0x41, 0x4D, 0x70, 0xF7, 0x5E, 0x23, 0x0A, 0x66, 0x3F, 0x2C, 0x13,
-    0x50, 0x5A, 0xC5, 0xF4, 0x1E, 0x16, 0x69, 0xDA, 0x64, 0x1F, 0x8D, 0x75, 0x51, 0x19, 0xEA, 0x44,
-    0xB5, 0xD4, 0xC1, 0xA6, 0xC0, 0xFB, 0x98, 0xCD, 0x59, 0x64, 0x63, 0xDA, 0x82, 0xD3, 0xCF, 0x80,
-    0x00, 0x4B, 0xD2, 0x51, 0xB6, 0xCA, 0x38, 0x51, 0x16, 0x16, 0xE7, 0x80, 0xCA, 0x72, 0xF8, 0x0D,
-    0x84, 0xC3, 0xBD, 0x18, 0x43, 0x42, 0x4F, 0x63, 0x36, 0x28, 0x26, 0x18, 0xB6, 0x3C, 0x13, 0x67,
-    0x81, 0xE6, 0x49, 0x9C, 0x75, 0xC1, 0xF3, 0x0D, 0xC5, 0xBC, 0x04, 0xAE, 0x77, 0xC5, 0xAE, 0xDA,
-    0x06, 0xBE, 0x5B, 0xF8, 0x72, 0xC3, 0x87, 0x97, 0xF0, 0x5A, 0xC8, 0x3C, 0xEE, 0x97, 0x33, 0xC5,
-    0x1E, 0x63, 0x19, 0x74, 0x81, 0x64, 0xA5, 0x5E, 0x76, 0x2E, 0x3B, 0xC2, 0x0D, 0x5D, 0xD5, 0xE4,
-    0xDF, 0x84, 0x66, 0x30, 0xB3, 0x17, 0xA9, 0xA0, 0x10, 0x98, 0x64, 0xCE, 0x56, 0x10, 0x74, 0xEA,
-    0x55, 0xC4, 0x5D, 0x56, 0x11, 0x68, 0x2B, 0x51, 0xF9, 0x2D, 0xE5, 0x14, 0x17, 0x50, 0x46, 0xAA,
-    0xF0, 0x1E, 0x69, 0x92, 0x19, 0xC1, 0xBA, 0x6B, 0x00, 0xE9, 0xEA, 0x02, 0xEB, 0x1A, 0x80, 0xAE,
-    0x07, 0xE4, 0x04, 0xAF, 0x9C, 0x14, 0x50, 0x5B, 0x37, 0x60, 0x23, 0x2C, 0xCD, 0x6C, 0x94, 0x14,
-    0x9F, 0x86, 0x47, 0xB8, 0x2E, 0x0D, 0x05, 0xA5, 0x54, 0x1E, 0x28, 0x35, 0x40, 0x95, 0xE8, 0x80,
-    0xE0, 0x71, 0x87, 0x21, 0x77, 0x1C, 0xBC, 0xB8, 0xC3, 0x90, 0x3B, 0x6C, 0x6F, 0xBB, 0xB0, 0xB6,
-    0x1D, 0xA5, 0x4F, 0x37, 0x7C, 0x90, 0xE1, 0x17, 0x0D, 0x2D, 0x08, 0x76, 0x05, 0x14, 0xEF, 0xB7,
-    0x4C, 0x36, 0xAA, 0x11, 0x00, 0x8C, 0x82, 0x95, 0xAA, 0xE0, 0xB0, 0x66, 0xA9, 0x83, 0x26, 0xE5,
-    0x73, 0x0F, 0x1A, 0x0E, 0x8D, 0x4C, 0x2C, 0x75, 0x1D, 0xE2, 0x92, 0x25, 0x9D, 0xBA, 0x0E, 0x43,
-    0xB7, 0x11, 0x77, 0xCB, 0x18, 0xA2, 0x43, 0x6C, 0x4B, 0x61, 0x5E, 0x20, 0x1B, 0x56, 0x0F, 0xDB,
-    0xF0, 0xF8, 0x02, 0x07, 0x2D, 0x7B, 0x33, 0x8B, 0xF8, 0x93, 0xD6, 0x9B, 0xCA, 0x42, 0x7C, 0xD2,
-    0x12, 0x77, 0x07, 0x30, 0x82, 0x24, 0x13, 0x07, 0xCD, 0xD0, 0xB5, 0x30, 0xE5, 0x77, 0x61, 0x56,
-    0xB1, 0x8A, 0xD0, 0x8D, 0xD1, 0x15, 0xE8, 0x04, 0x3A, 0x8D, 0x8E, 0xC2, 0x62, 0x1D, 0xC1, 0x8B,
-    0x7A, 0x8B, 0x3C, 0xF3, 0x34, 0x88, 0xA5, 0x65, 0xF2, 0xCF, 0x8E, 0x63, 0x5B, 0x5C, 0xAD, 0xD3,
-    0x13, 0xCE, 0x53, 0x4C, 0x09, 0x59, 0x5F, 0x29, 0xCD, 0x0F, 0xEB, 0x05, 0x09, 0x75, 0x4A, 0x30,
-    0xC1, 0x7E, 0xD2, 0xFD, 0x26, 0xF8, 0x8D, 0xED, 0xE5, 0x96, 0xAC, 0x45, 0x28, 0x42, 0x42, 0x56,
-    0x98, 0x3A, 0x25, 0x9A, 0x59, 0xC4, 0x2F, 0x63, 0x33, 0x75, 0xBF, 0xC5, 0x13, 0x6E, 0x88, 0x61,
-    0x92, 0x33, 0x07, 0x0E, 0xE8, 0x99, 0x9D, 0x97, 0x1C, 0xE9, 0x6D, 0xF3, 0x14, 0xD2, 0xC6, 0x37,
-    0x1E, 0xE6, 0x65, 0xBF, 0x64, 0xFB, 0x79, 0x5C, 0xB0, 0xD2, 0x60, 0x60, 0x44, 0x35, 0x7B, 0xE4,
-    0x6D, 0x28, 0x9A, 0xD2, 0x8C, 0x62, 0x30, 0x47, 0xF4, 0x98, 0xB9, 0x8A, 0x89, 0x4B, 0xAF, 0xA3,
-    0xC9, 0x0D, 0xAB, 0xF4, 0xD5, 0xE7, 0x35, 0x7B, 0x78, 0xDC, 0x0E, 0xCC, 0xC6, 0x36, 0x62, 0x6C,
-    0x9E, 0x43, 0xE3, 0xDF, 0x64, 0x62, 0x0F, 0x1C, 0xE7, 0x62, 0xC5, 0xC5, 0x0F, 0x4E, 0x5B, 0xB0,
-    0x03, 0x96, 0x6F, 0xBA, 0xE4, 0x47, 0x5B, 0x93, 0xED, 0x01, 0x42, 0xB1, 0x55, 0xB2, 0xBF, 0x65,
-    0xF3, 0xC8, 0xE1, 0x8E, 0x57, 0xC9, 0xFF, 0xBB, 0xA6, 0x55, 0xD6, 0xE3, 0x1E, 0xD5, 0x41, 0x11,
-    0xD3, 0xB9, 0xA0, 0xF2, 0xF4, 0x0A, 0x2F, 0x65, 0xC5, 0xBD, 0x3E, 0xDB, 0x40, 0xCE, 0xEC, 0xCF,
-    0x6F, 0xE6, 0x64, 0xEF, 0x9D, 0xF1, 0x91, 0x2F, 0x8C, 0x67, 0x2E, 0xF2, 0xBC, 0x7E, 0xAC, 0xEC,
-    0x9D, 0xF3, 0xEE, 0xE5, 0xCE, 0x01, 0x91, 0x5A, 0x98, 0xCA, 0xBD, 0x3E, 0x97, 0xFF, 0x79, 0x7D,
-    0xF0, 0xDE, 0xDD, 0x8C, 0xD0, 0xE1, 0x91, 0xA3, 0x8E, 0x8B, 0xC1, 0x9D, 0x57, 0xD3, 0x61, 0xF3,
-    0x2E, 0x1C, 0x76, 0x92, 0x85, 0x1C, 0xE6, 0xDF, 0xF6, 0x1C, 0xC9, 0x47, 0x2D, 0x93, 0x4F, 0x91,
-    0x4B, 0xE2, 0x5C, 0x66, 0x45, 0x8E, 0x8A, 0xCD, 0x98, 0x8F, 0x80, 0xCE, 0xE5, 0x03, 0xF8, 0xA0,
-    0x0B, 0xB6, 0x00, 0x06, 0x9F, 0x8A, 0xF3, 0xD7, 0xB1, 0xD5, 0xB2, 0xD7, 0xCA, 0xE9, 0x6D, 0x84,
-    0x13, 0x73, 0x78, 0x68, 0xDE, 0xE7, 0x53, 0xB4, 0x69, 0x76, 0xEB, 0x3D, 0x3F, 0x85, 0xB3, 0x5B,
-    0xBC, 0xCC, 0x6D, 0x6A, 0x99, 0x34, 0xA0, 0x2C, 0x3E, 0x66, 0x4A, 0x12, 0xE6, 0xEF, 0xD7, 0x2C,
-    0x44, 0x74, 0x93, 0x4F, 0x8E, 0x6F, 0x85, 0xD7, 0x8A, 0x92, 0x53, 0x5E, 0xB6, 0x8B, 0x22, 0x27,
-    0xBF, 0xC5, 0x75, 0x76, 0x37, 0x2F, 0xCC, 0xF8, 0xEC, 0x22, 0x5A, 0x3D, 0x7E, 0x82, 0x47, 0x35,
-    0x8B, 0x0B, 0x28, 0x78, 0xD8, 0x4E, 0x2C, 0x7B, 0x96, 0x65, 0x36, 0x02, 0xEB, 0x87, 0x5D, 0x84,
-    0xDA, 0x1E, 0x04, 0xB2, 0xAA, 0xE7, 0xEC, 0xD6, 0x65, 0x10, 0x36, 0x25, 0xB0, 0xD2, 0x4E, 0x06,
-    0x74, 0xFF, 0x3F, 0xA0, 0xAF, 0xCD, 0xA3, 0xEB, 0x01, 0x5D, 0xCC, 0xD0, 0x87, 0x2C, 0x54, 0xB3,
-    0x63, 0xF9, 0xDA, 0xE6, 0xF6, 0x35, 0xB7, 0xEE, 0x0E, 0x4B, 0xD0, 0x8C, 0x6C, 0x56, 0x5B, 0x48,
-    0x14, 0x2B, 0x9D, 0x84, 0xAD, 0x77, 0x24, 0xBE, 0xB6, 0xB1, 0x4B, 0xD0, 0xDC, 0x61, 0x09, 0x9A,
-    0x19, 0xA9, 0xC1, 0x30, 0x70, 0xC7, 0xCF, 0x00, 0x09, 0xD7, 0xAE, 0x44, 0xD1, 0x57, 0xC8, 0xA9,
-    0xD1, 0x29, 0x7E, 0xF0, 0x41, 0xCD, 0x2A, 0x5F, 0x33, 0x6B, 0x12, 0x7E, 0xDB, 0x4B, 0xDD, 0xBA,
-    0x3C, 0x9D, 0x8E, 0x8D, 0xBD, 0xFE, 0xD7, 0xFB, 0x4B, 0x12, 0xDA, 0xFD, 0xDC, 0x01, 0xE2, 0xB4,
-    0xD9, 0x91, 0x10, 0xFB, 0x66, 0x76, 0x65, 0x6E, 0xBA, 0x72, 0xE6, 0x35, 0xF8, 0x07, 0xD9, 0x6B,
-    0x57, 0xF6, 0x3F, 0x56, 0xF2, 0x52, 0xFF, 0x3B, 0xF9, 0xDC, 0xD7, 0xFB, 0xC0, 0x94, 0xEB, 0x19,
-    0x65, 0xAF, 0x23, 0x71, 0x46, 0x33, 0xF4, 0x03, 0x7C, 0x58, 0xD7, 0x5F, 0x24, 0xB8, 0x53, 0x14,
-    0x7C, 0x88, 0xCB, 0xCF, 0x98, 0x1C, 0x16, 0xC5, 0xE2, 0xF1, 0x8D, 0xE0, 0x8A, 0x8B, 0x8F, 0x97,
-    0xBD, 0x32, 0x0A, 0x30, 0x96, 0x88, 0xCF, 0x34, 0xB4, 0x29, 0xA0, 0xCC, 0xA4, 0xE5, 0x9B, 0x93,
-    0x81, 0x82, 0x2D, 0xBD, 0x65, 0x43, 0x80, 0x4C, 0xD2, 0x4A, 0xD3, 0xB0, 0x0C, 0x30, 0xA0, 0x09,
-    0x9F, 0x3E, 0xDB, 0xCA, 0x9A, 0xB5, 0x93, 0x3D, 0x66, 0x7B, 0x3E, 0xEB, 0xF2, 0x31, 0x7A, 0x91,
-    0x39, 0x8B, 0x6A, 0x1F, 0xAA, 0x90, 0x55, 0xD4, 0x32, 0xB3, 0x31, 0x52, 0x85, 0x8E, 0x19, 0xF5,
-    0xAE, 0xF6, 0x97, 0x1C, 0xBE, 0xAC, 0x0A, 0xDA, 0x08, 0x75, 0xA8, 0xD0, 0x38, 0x91, 0x5A, 0x16,
-    0x3F, 0x83, 0xC2, 0x0C, 0xDB, 0xD7, 0x01, 0x33, 0x97, 0xFC, 0x82, 0xED, 0xF5, 0x3A, 0xEB, 0xCD,
-    0x6F, 0xAE, 0x5B, 0x30, 0x1B, 0x6A, 0xCE, 0x49, 0x6E, 0x54, 0xC7, 0xAC, 0x0E, 0xB5, 0xC5, 0xAF,
-    0x6C, 0x9D, 0xB9, 0x0A, 0x6D, 0xFD, 0x03, 0x9F, 0x04, 0x39, 0x56, 0x39, 0x75, 0x84, 0x5F, 0xE3,
-    0x5C, 0xB1, 0x60, 0x67, 0x03, 0x87, 0xFB, 0xD0, 0x7C, 0x62, 0xA8, 0xAC, 0x13, 0x2E, 0x70, 0x62,
-    0x9E, 0x51, 0x21, 0xC2, 0x6A, 0x47, 0xB1, 0xE6, 0x03, 0x03, 0xEC, 0x68, 0xB5, 0x6F, 0xFA, 0x0F,
-    0x01, 0xE6, 0xBB, 0x1B, 0x1B, 0xCF, 0x31, 0x57, 0xA2, 0x24, 0x57, 0x5B, 0xDA, 0xEB, 0xC0, 0xCC,
-    0x79, 0x33, 0x70, 0x3E, 0x80, 0xE5, 0x1C, 0x98, 0x79, 0x0F, 0x07, 0xB0, 0x3F, 0x03, 0xB3, 0xBB,
-    0x7A, 0x6A, 0xF4, 0x86, 0x42, 0xC5, 0x80, 0xB3, 0xDA, 0xDE, 0x35, 0x26, 0xBB, 0x12, 0xC2, 0xF1,
-    0x71, 0xA3, 0xB9, 0xA9, 0xB9, 0x69, 0xB8, 0x69, 0xEF, 0xD8, 0x34, 0xB3, 0xC5, 0x16, 0xAD, 0xE4,
-    0x46, 0xA1, 0x69, 0xE8, 0x4A, 0x88, 0x1D, 0xBF, 0x99, 0xA6, 0x4F, 0xA7, 0xC1, 0x1F, 0x7F, 0x2E,
-    0xD9, 0x41, 0x95, 0xBA, 0x8D, 0x43, 0xCB, 0xDE, 0x41, 0x79, 0xEB, 0xDF, 0x02, 0x0F, 0x11, 0x9C,
-    0x76, 0xB5, 0x8C, 0xA9, 0xEC, 0x77, 0x0C, 0xFA, 0xDB, 0x1C, 0xE8, 0xB7, 0x0C, 0xFA, 0x8C, 0x41,
-    0xAF, 0x30, 0x08, 0x71, 0x36, 0xDB, 0xE3, 0xD8, 0x57, 0xF1, 0x77, 0x96, 0x6C, 0x11, 0xF1, 0x6F,
-    0x50, 0x76, 0x19, 0xF1, 0x87, 0x89, 0xE5, 0x1F, 0x40, 0x96, 0x3D, 0xBC, 0xFE, 0x83, 0x57, 0x7C,
-    0x90, 0x81, 0xD0, 0x5B, 0x98, 0x9D, 0x32, 0x68, 0xCA, 0xA0, 0x43, 0x06, 0xFD, 0x95, 0x11, 0x66,
-    0xA0, 0x5B, 0x0C, 0xFA, 0x09, 0x40, 0x2D, 0x83, 0x6E, 0xF2, 0x99, 0x31, 0xAD, 0xEA, 0xD1, 0xD1,
-    0xE8, 0x57, 0xE0, 0xFC, 0xDA, 0x70, 0x08, 0xD6, 0xD5, 0xA7, 0x33, 0xAF, 0x59, 0xB1, 0x4F, 0x57,
-    0xDB, 0xC2, 0x6C, 0xE7, 0x2D, 0x4B, 0xA6, 0x97, 0x76, 0x6F, 0x6F, 0x38, 0xE7, 0x1D, 0x7C, 0x01,
-    0x4B, 0x4B, 0x9E, 0x29, 0x71, 0x94, 0x40, 0xB2, 0x5E, 0xDA, 0xC0, 0xD0, 0xE8, 0xCA, 0x50, 0x97,
-    0x9D, 0x25, 0x13, 0x76, 0xB1, 0x96, 0xC5, 0x43, 0x5F, 0xBD, 0xBA, 0x4B, 0xCA, 0xF8, 0x6D, 0x50,
-    0x8B, 0x2A, 0xC1, 0xC5, 0x1A, 0xA3, 0xA2, 0xA9, 0x4E, 0x1B, 0xB6, 0xBF, 0xFD, 0xC7, 0xE3, 0xF3,
-    0xBE, 0x6F, 0x85, 0xDF, 0x2A, 0xE6, 0x6C, 0x85, 0xBD, 0xBE, 0x50, 0xF0, 0x5E, 0xB8, 0x7B, 0xB8,
-    0x69, 0x0D, 0x1B, 0x02, 0x3C, 0xA3, 0x97, 0x7F, 0x49, 0xFF, 0x27, 0xD5, 0xF6, 0xF1, 0x6E, 0x88,
-    0xD2, 0x47, 0xE4, 0xD7, 0x7A, 0xF2, 0x5F, 0x06, 0x65, 0xBC, 0x63, 0x3E, 0xDE, 0x35, 0x31, 0xC7,
-    0xDD, 0xC5, 0x1F, 0x4F, 0x5F, 0x55, 0x14, 0x5B, 0x8F, 0xCD, 0x65, 0xF2, 0x8D, 0xDA, 0x05, 0xD8,
-    0xA0, 0xB1, 0x37, 0x3A, 0x29, 0xE9, 0x71, 0x4E, 0x7F, 0x86, 0x8F, 0x5F, 0x9A, 0xB6, 0xF2, 0x2C,
-    0xFA, 0x00, 0x99, 0x63, 0xAA, 0xE2, 0xF3, 0x8A, 0xEF, 0xEC, 0xB6, 0x8B, 0x6D, 0x2D, 0x57, 0x46,
-    0xF6, 0x12, 0x63, 0x23, 0xAE, 0x00, 0xEF, 0x0E, 0x80, 0xE2, 0x49, 0xFB, 0x53, 0xD4, 0xB0, 0xB7,
-    0x4A, 0x8E, 0xE0, 0x1E, 0x84, 0x9B, 0xB2, 0x9F, 0x0B, 0x55, 0x6E, 0xD3, 0xB6, 0xA0, 0xCC, 0x47,
-    0xC6, 0x7C, 0x0A, 0x34, 0xEC, 0x73, 0xD9, 0xDC, 0xDE, 0xD5, 0x5C, 0x24, 0x5C, 0x66, 0xDF, 0x67,
-    0x73, 0x12, 0x73, 0x75, 0x96, 0x2E, 0x71, 0xE6, 0x93, 0x4C, 0xB9, 0x9C, 0xAA, 0x90, 0x57, 0xB2,
-    0xD9, 0x48, 0xFE, 0x78, 0x44, 0x7B, 0x8F, 0x33, 0xE7, 0xFB, 0x36, 0xFE, 0x2E, 0xB8, 0x14, 0xDF,
-    0x05, 0x7F, 0x34, 0x3E, 0x8D, 0x7D, 0xAE, 0x61, 0xB8, 0x82, 0x1A, 0x23, 0x9D, 0x6F, 0xC7, 0x1D,
-    0xC7, 0x66, 0x0E, 0x50, 0xD8, 0x7D, 0xB4, 0x6B, 0xFE, 0x72, 0x8D, 0xEF, 0x43, 0xCB, 0x89, 0x55,
-    0x6B, 0x61, 0x6E, 0xB6, 0x1B, 0x73, 0x3D, 0x31, 0x96, 0x90, 0x83, 0x71, 0xD5, 0x38, 0x38, 0x46,
-    0x74, 0x78, 0x16, 0x7A, 0xD5, 0x0B, 0x2E, 0x17, 0xBA, 0xE1, 0x84, 0xBF, 0xFE, 0xE1, 0xE4, 0x37,
-    0xD2, 0xFD, 0x5A, 0x33, 0x64, 0x1B, 0xFF, 0xED, 0xE1, 0x73, 0x95, 0xA5, 0xDB, 0xC5, 0xFA, 0x48,
-    0xC4, 0xB3, 0xE4, 0x3C, 0x6A, 0xC2, 0x09, 0x17, 0x88, 0x49, 0x86, 0x9C, 0x3F, 0xAC, 0xA4, 0x5F,
-    0x73, 0x99, 0x38, 0xE1, 0x4F, 0x14, 0x31, 0x4A, 0xC2, 0x22, 0x2C, 0xA5, 0x2B, 0xFF, 0x36, 0x83,
-    0x2A, 0xC1, 0x3D, 0x02, 0x08, 0x15, 0xA0, 0xA7, 0x85, 0xDA, 0xA3, 0xCD, 0xA0, 0x5C, 0x76, 0xE6,
-    0xB4, 0x30, 0x44, 0x1C, 0xFB, 0xF4, 0xB5, 0x69, 0xDF, 0xA5, 0xA7, 0xB9, 0x20, 0x2E, 0xBF, 0x7F,
-    0xC2, 0xE5, 0x96, 0x53, 0xDB, 0x79, 0xC6, 0x75, 0xD3, 0x58, 0x9D, 0xD0, 0xDF, 0xDD, 0x3F, 0xDB,
-    0x3D, 0x83, 0x73, 0x7C, 0xF6, 0x5C, 0x73, 0x81, 0xE0, 0xD9, 0xB7, 0x07, 0x23, 0x2B, 0x94, 0xDC,
-    0xB1, 0xF9, 0xB0, 0x8B, 0x98, 0x88, 0xD1, 0x4E, 0xCB, 0xD7, 0x4F, 0x77, 0xE3, 0x97, 0x7B, 0xE3,
-    0x73, 0xA9, 0x92, 0x70, 0xE9, 0xB3, 0xDF, 0x7F, 0xC9, 0x78, 0xF2, 0x74, 0x34, 0x9D, 0x22, 0xF6,
-    0x84, 0xE5, 0x36, 0x75, 0xDC, 0x26, 0x95, 0xE5, 0x36, 0x6C, 0xCE, 0xDA, 0x25, 0x2F, 0x42, 0xA6,
-    0x46, 0xEE, 0x77, 0x49, 0xB1, 0x7E, 0x07, 0x42, 0xC9, 0x7E, 0x2B, 0x0F, 0xDA, 0x59, 0x4D, 0xE5,
-    0x35, 0x2E, 0xB3, 0x27, 0x97, 0x67, 0xF5, 0xAF, 0xB6, 0x5E, 0xBC, 0x3B, 0xEF, 0xC6, 0xF8, 0x2D,
-    0x23, 0x25, 0x37, 0xF8, 0x33, 0xEC, 0xD4, 0x56, 0x6F, 0xE5, 0x0B, 0x8E, 0x9F, 0xBB, 0x7B, 0xFC,
-    0xF6, 0x04, 0x0F, 0x89, 0xE5, 0xC1, 0x49, 0xF1, 0x23, 0xB7, 0x66, 0x72, 0xAC, 0x7B, 0x10, 0xDD,
-    0x02, 0xC1, 0x35, 0xC0, 0x9A, 0xC9, 0x9F, 0xA2, 0x33, 0xAA, 0xEF, 0xC8, 0x01, 0xFB, 0x25, 0x27,
-    0xF0, 0xE6, 0xBA, 0xD4, 0x7E, 0x1D, 0xEE, 0xF2, 0xB9, 0xEE, 0x4E, 0x08, 0x43, 0xD7, 0xA2, 0xBB,
-    0xDE, 0x6F, 0x3B, 0x74, 0x96, 0x17, 0xC3, 0x22, 0x4F, 0x5C, 0xB2, 0x33, 0x8F, 0xB7, 0xE5, 0xAA,
-    0x38, 0xF9, 0x7E, 0x27, 0xDF, 0x3D, 0x2A, 0xDB, 0x70, 0x54, 0xE9, 0x8D, 0xF6, 0xD1, 0x21, 0xDF,
-    0x9B, 0x7D, 0x0D, 0x3E, 0xBE, 0xF2, 0xEC, 0x0C, 0x08, 0xAD, 0xEC, 0xE0, 0xBD, 0xB5, 0x86, 0xF0,
-    0x1A, 0x2F, 0xB8, 0x81, 0x53, 0x4C, 0xCD, 0xC1, 0xEE, 0xB5, 0xA3, 0x6F, 0x9C, 0x4B, 0x9F, 0x5F,
-    0xBC, 0xD7, 0x6F, 0xB7, 0x6F, 0xBE, 0x44, 0x1F, 0xD1, 0xFD, 0xB6, 0xF9, 0xE9, 0xBD, 0x7D, 0x6D,
-    0x95, 0xE6, 0x3D, 0xD3, 0x08, 0x44, 0xA2, 0x8A, 0xBF, 0xAE, 0x64, 0xA7, 0x27, 0x34, 0x7C, 0xBB,
-    0x15, 0x5C, 0x3A, 0xC9, 0x02, 0xF9, 0xA5, 0xD1, 0x09, 0x7F, 0xB6, 0xBF, 0x07, 0x6A, 0xEB, 0xE0,
-    0x28, 0x7A, 0xCB, 0x2F, 0xAF, 0xAC, 0x04, 0xC5, 0xE7, 0x9A, 0xF3, 0xF3, 0x7B, 0xE0, 0x2D, 0xAD,
-    0xFC, 0x5D, 0xFA, 0xC6, 0x4E, 0xE1, 0xDF, 0xED, 0x54, 0x31, 0x6C, 0x1C, 0x45, 0x14, 0x7D, 0xB3,
-    0x6B, 0x7B, 0x11, 0x5B, 0x4C, 0x0A, 0xDC, 0x10, 0x89, 0x6D, 0x8C, 0x14, 0x45, 0xE2, 0xB6, 0x47,
-    0xB7, 0xB7, 0x03, 0x14, 0x29, 0x28, 0x6C, 0xA1, 0xB8, 0x8F, 0x04, 0xD5, 0x35, 0x6E, 0x28, 0x28,
-    0xCE, 0xBE, 0xED, 0x28, 0x73, 0x34, 0xB4, 0xB8, 0xA0, 0xC0, 0x4B, 0xE1, 0x86, 0xE2, 0xA2, 0x5C,
-    0x6E, 0x27, 0xB8, 0xA0, 0xCC, 0x88, 0x48, 0x34, 0x96, 0x60, 0x23, 0x11, 0x24, 0x92, 0x82, 0x21,
-    0x1E, 0xC8, 0x5A, 0xD9, 0xDB, 0xCF, 0x9F, 0xB3, 0x23, 0x8C, 0x14, 0x24, 0x44, 0x89, 0x98, 0x1D,
-    0x69, 0xFF, 0xFE, 0x3F, 0xF3, 0xFF, 0x9F, 0xF7, 0xDE, 0x2C, 0xAA, 0x42, 0xD0, 0x02, 0xDD, 0x8E,
-    0xBE, 0x23, 0x9A, 0x1C, 0xB9, 0x2C, 0xE2, 0xA3, 0x5A, 0xFC, 0xE6, 0xB0, 0xBB, 0x8B, 0x64, 0x53,
-    0x45, 0xF7, 0x6B, 0xE1, 0x1A, 0xCC, 0x38, 0x12, 0xD5, 0x69, 0x41, 0x95, 0x96, 0xA4, 0x31, 0x54,
-    0x58, 0xC9, 0x32, 0xA0, 0x7F, 0x61, 0x00, 0xC2, 0x01, 0x1D, 0x40, 0x05, 0xAA, 0x1A, 0x59, 0x83,
-    0x6C, 0x0F, 0x69, 0x52, 0x24, 0x51, 0x2D, 0xDF, 0x6A, 0xE2, 0x62, 0x2F, 0x7A, 0xB8, 0xF3, 0x29,
-    0x11, 0x55, 0xC4, 0x0B, 0xF6, 0x80, 0xA4, 0x40, 0x54, 0x03, 0x5B, 0xB8, 0x5A, 0xEE, 0x13, 0x1D,
-    0x3D, 0xDC, 0x96, 0x9C, 0x0F, 0xC2, 0x22, 0x7A, 0x34, 0x49, 0xC8, 0xBD, 0xB9, 0x63, 0x7D, 0x5C,
-    0x6A, 0xA4, 0xC0, 0x02, 0xD1, 0x2F, 0x3F, 0x55, 0x39, 0xD9, 0x57, 0x0F, 0x80, 0xCB, 0x2D, 0xC6,
-    0x84, 0xF1, 0x44, 0xE5, 0x9C, 0x04, 0x90, 0x05, 0xC2, 0x6F, 0x3B, 0x3C, 0x23, 0x9B, 0x9B, 0xB1,
-    0xD4, 0xD1, 0x7D, 0x03, 0xE7, 0x90, 0x0D, 0x90, 0x5C, 0x33, 0x52, 0x77, 0x3B, 0x26, 0xA6, 0xDA,
-    0x37, 0x5C, 0x96, 0x5F, 0x10, 0xB5, 0x65, 0xD9, 0x02, 0x0D, 0x02, 0x8B, 0xB0, 0x46, 0xA4, 0xFD,
-    0xEE, 0x44, 0x81, 0x33, 0xED, 0x02, 0x1C, 0x71, 0xE7, 0x91, 0x58, 0x63, 0x55, 0x01, 0xD5, 0x44,
-    0x50, 0x87, 0x45, 0x6C, 0x66, 0x68, 0x52, 0x0C, 0xA2, 0x3A, 0x51, 0x5D, 0x5A, 0x48, 0x2A, 0x42,
-    0xB2, 0xA1, 0xAB, 0xDE, 0xB6, 0xA1, 0x65, 0x6C, 0xB8, 0x94, 0xD4, 0xF2, 0x2E, 0x97, 0x4A, 0xCF,
-    0x4A, 0xF9, 0x31, 0xAE, 0x51, 0x91, 0x9A, 0x47, 0x76, 0x80, 0x41, 0xA2, 0xA2, 0x6F, 0xB4, 0xF8,
-    0x95, 0x31, 0x65, 0x18, 0xDF, 0x3D, 0xAD, 0x4C, 0xB5, 0xB0, 0xC1, 0xE7, 0x23, 0xF8, 0xA3, 0x49,
-    0xC5, 0x67, 0x7C, 0xFD, 0xD0, 0xC3, 0x1A, 0x94, 0xF0, 0x78, 0x04, 0x06, 0xB1, 0xC2, 0x1B, 0x58,
-    0xBF, 0xF5, 0x1E, 0xD1, 0x77, 0x87, 0x8F, 0xD8, 0xC4, 0x57, 0xE7, 0xDE, 0xF5, 0x6D, 0xEF, 0x2B,
-    0xCB, 0x3F, 0x0D, 0x3F, 0x02, 0xA2, 0x63, 0x22, 0xAE, 0x1B, 0xEB, 0x51, 0x58, 0x27, 0x68, 0x42,
-    0x93, 0x60, 0x16, 0xD4, 0x71, 0xD1, 0xC3, 0x34, 0xB0, 0x91, 0x96, 0x6A, 0x80, 0x11, 0x9C, 0xB0,
-    0x7C, 0x3A, 0xE6, 0x89, 0x5F, 0xA1, 0x89, 0x97, 0xDE, 0x99, 0xF0, 0x61, 0xF4, 0xFD, 0x2B, 0x3D,
-    0xDB, 0xE8, 0x38, 0xCB, 0x32, 0x2D, 0x1E, 0x90, 0x79, 0xF6, 0xD8, 0x2D, 0x30, 0x6B, 0xD0, 0x77,
-    0xE8, 0xDB, 0x17, 0x4D, 0xBF, 0xEE, 0x5F, 0x4A, 0x08, 0x57, 0x05, 0xC5, 0x94, 0x1F, 0x66, 0xE9,
-    0xA5, 0x14, 0x2F, 0x7A, 0xD6, 0x05, 0x79, 0x29, 0xA4, 0x9F, 0xB4, 0x2F, 0x79, 0x7E, 0x06, 0x4B,
-    0x96, 0x66, 0x10, 0x0D, 0x42, 0xEB, 0x95, 0x91, 0x7B, 0xCE, 0xBC, 0x59, 0x20, 0xA7, 0x05, 0xCF,
-    0xF5, 0xED, 0xEB, 0x01, 0x4D, 0x62, 0x5A, 0x84, 0x2E, 0xD1, 0x97, 0xBC, 0x1E, 0x79, 0x0F, 0xF3,
-    0x9B, 0xE8, 0x25, 0x67, 0x2C, 0xB7, 0xB1, 0xF2, 0x1B, 0x38, 0x09, 0xF2, 0x15, 0x24, 0x1F, 0xFF,
-    0xBC, 0x73, 0x97, 0xC8, 0xAC, 0x95, 0xEA, 0x7F, 0xF5, 0xFE, 0xB7, 0xD4, 0x2B, 0x4A, 0x95, 0x53,
-    0x31, 0x61, 0x74, 0x7A, 0xC0, 0x47, 0xAB, 0x5F, 0x3E, 0x20, 0xFA, 0x4C, 0xBD, 0xD6, 0xE0, 0xB6,
-    0x09, 0x1F, 0xEB, 0xF4, 0x26, 0x7D, 0x1F, 0xFF, 0xB8, 0x81, 0x21, 0x22, 0x62, 0x50, 0x9A, 0x3E,
-    0xFA, 0x23, 0x64, 0xF3, 0xF2, 0x4E, 0x45, 0x8B, 0x29, 0xB8, 0x16, 0xF8, 0xDF, 0x96, 0xAA, 0x95,
-    0x98, 0x5A, 0x1C, 0xEE, 0x33, 0x26, 0x01, 0x2D, 0x04, 0x27, 0x76, 0x98, 0x8D, 0x20, 0x7B, 0x08,
-    0x8F, 0x0B, 0xFC, 0xCE, 0x22, 0xE1, 0x0F, 0x89, 0xE8, 0x6B, 0x1B, 0x31, 0x74, 0x06, 0xF3, 0x02,
-    0xAF, 0x60, 0xD5, 0x37, 0xC6, 0x7A, 0x91, 0xD7, 0xB4, 0x78, 0xCA, 0xEC, 0x1B, 0x2F, 0xB7, 0xA0,
-    0x83, 0x38, 0x31, 0xB0, 0x23, 0xDF, 0xDD, 0x14, 0xCD, 0x15, 0xBC, 0x8C, 0xB5, 0x03, 0xD6, 0xAC,
-    0xDE, 0x08, 0xCE, 0xC4, 0xC8, 0xD7, 0x28, 0xE3, 0xE2, 0xE4, 0xEB, 0x73, 0x2F, 0xA3, 0x81, 0x70,
-    0x92, 0x8C, 0x98, 0xE3, 0x06, 0x60, 0x2F, 0xCE, 0xA1, 0x7A, 0x4A, 0xB6, 0x13, 0x4D, 0x8B, 0x91,
-    0xFB, 0x9B, 0x4B, 0xB9, 0x8F, 0x2B, 0x37, 0x10, 0xB2, 0x38, 0x96, 0x69, 0x59, 0x10, 0x5A, 0x6C,
-    0x22, 0xEB, 0x87, 0xC6, 0x66, 0xE1, 0x91, 0x91, 0xBB, 0xC8, 0x5B, 0xB4, 0x4D, 0xA8, 0x9D, 0x14,
-    0x8E, 0x91, 0xB3, 0xC1, 0x93, 0x22, 0x98, 0xBC, 0x7F, 0xAF, 0x7F, 0xF2, 0x7C, 0x3E, 0x29, 0xB6,
-    0x86, 0x18, 0xBE, 0xF3, 0x03, 0xDD, 0xA4, 0x7B, 0x75, 0x6A, 0x93, 0x31, 0x2B, 0xAC, 0xE7, 0x30,
-    0xC5, 0x58, 0x07, 0xB5, 0x20, 0x66, 0x32, 0x6A, 0x99, 0xD6, 0xC4, 0x32, 0xB1, 0xEC, 0x32, 0x17,
-    0x5C, 0xFB, 0xF8, 0x00, 0x1B, 0x5B, 0x43, 0x75, 0xF2, 0x0F, 0x9A, 0x5C, 0x2E, 0xAB, 0x9F, 0x2F,
-    0xCB, 0x2C, 0x7A, 0x67, 0x93, 0xED, 0x16, 0xFD, 0x0E, 0x0D, 0x5F, 0x0A, 0x3B, 0x57, 0xF6, 0xAF,
-    0x08, 0xAC, 0x1D, 0x84, 0xD4, 0x4E, 0xC5, 0xA6, 0x62, 0xD8, 0xC2, 0x53, 0x44, 0x1D, 0x02, 0xFE,
-    0x07, 0x18, 0xF4, 0xB6, 0xC2, 0x63, 0x6A, 0x2E, 0x9F, 0x7A, 0x45, 0x19, 0x7C, 0x88, 0xBD, 0xEB,
-    0x15, 0xB1, 0x9B, 0x93, 0xB1, 0x48, 0xCF, 0x8D, 0x58, 0x31, 0xDC, 0xB9, 0x0B, 0x9A, 0x3F, 0x00,
-    0xAD, 0x58, 0x3D, 0x8C, 0x1D, 0xD5, 0x15, 0x3E, 0x33, 0xC3, 0x32, 0x52, 0x46, 0xC9, 0xA4, 0x80,
-    0x14, 0xD9, 0x62, 0xEA, 0x10, 0x91, 0x49, 0x49, 0x81, 0xF7, 0x0E, 0x10, 0xC9, 0xA5, 0x57, 0xCA,
-    0x3E, 0x90, 0x42, 0xE1, 0x26, 0x45, 0x02, 0x8A, 0xB6, 0x4D, 0xB1, 0x30, 0x03, 0x96, 0x42, 0x41,
-    0x61, 0x4B, 0x89, 0xA3, 0x74, 0x50, 0xB8, 0x70, 0xD6, 0xC5, 0x36, 0x14, 0x14, 0xEB, 0x9D, 0x21,
-    0x96, 0x92, 0x82, 0xC2, 0x93, 0x58, 0x8E, 0x0B, 0x8A, 0x0C, 0x0A, 0xC8, 0x91, 0x29, 0x3C, 0xE0,
-    0x31, 0x1E, 0x3F, 0xCF, 0xCC, 0xCD, 0xF7, 0x9D, 0x3B, 0x6F, 0xBD, 0xEB, 0x90, 0x20, 0x45, 0x3C,
-    0xE9, 0x9D, 0x77, 0xFF, 0xEF, 0xF9, 0xFD, 0xCE, 0xB9, 0x4F, 0x84, 0x9F, 0xED, 0x29, 0x13, 0xDF,
-    0xDA, 0x4A, 0xA2, 0xF1, 0xE5, 0x42, 0x92, 0x06, 0x43, 0xA6, 0x20, 0xE1, 0x64, 0x4E, 0x72, 0xE0,
-    0xC8, 0x53, 0xBB, 0x17, 0x0F, 0xC4, 0xD8, 0x41, 0x49, 0x29, 0x26, 0xC3, 0x2C, 0x88, 0xC9, 0x40,
-    0xD2, 0x0A, 0x24, 0xEE, 0x40, 0x42, 0x6B, 0x6D, 0x2F, 0x25, 0xC9, 0x5A, 0xB9, 0x7B, 0x41, 0xB8,
-    0xE4, 0xBF, 0x90, 0xDD, 0x8B, 0xC2, 0xA3, 0x66, 0xB2, 0x96, 0x6D, 0x8A, 0xC4, 0xCF, 0xB7, 0x20,
-    0x01, 0x98, 0x48, 0x5E, 0xAA, 0xC5, 0xB3, 0xB6, 0x93, 0xC4, 0xDA, 0x49, 0xCA, 0xE9, 0xF4, 0xE0,
-    0xD9, 0xFD, 0xF8, 0x0F, 0xC1, 0xB0, 0x13, 0x67, 0x51, 0xBB, 0x1F, 0x4B, 0x5C, 0xF7, 0x09, 0xEE,
-    0xED, 0x52, 0xB0, 0xDB, 0x6E, 0x88, 0x79, 0xAE, 0x3D, 0x21, 0xE6, 0xF9, 0xE6, 0x59, 0x31, 0x41,
-    0xB3, 0x03, 0x52, 0xEF, 0x8B, 0x39, 0x59, 0xF5, 0x24, 0x9D, 0xA4, 0x6F, 0x17, 0xAD, 0x24, 0x57,
-    0xDF, 0x68, 0x25, 0xBE, 0x8D, 0x2B, 0x22, 0x8B, 0x2B, 0x02, 0x1B, 0xF0, 0x8A, 0x1B, 0xD5, 0x2F,
-    0x24, 0x27, 0xBB, 0x86, 0x64, 0x87, 0xEA, 0xC0, 0x15, 0x22, 0xEF, 0xC7, 0xE0, 0xB1, 0x4B, 0xE4,
-    0xE8, 0x27, 0xB2, 0xF7, 0xA9, 0x2B, 0x2B, 0x66, 0xDA, 0xEB, 0x83, 0x49, 0xFC, 0x2A, 0xA5, 0xBE,
-    0x26, 0x4E, 0xB5, 0xB3, 0x5C, 0xDE, 0xB0, 0xEA, 0xA5, 0xC5, 0x9A, 0x7F, 0x61, 0x92, 0xFD, 0xF2,
-    0x9F, 0x9D, 0xFF, 0xC0, 0x9E, 0xAD, 0xA3, 0xE9, 0x27, 0x26, 0xC3, 0x86, 0x51, 0x4A, 0xF1, 0x7B,
-    0xBF, 0xC7, 0xAA, 0xA8, 0x96, 0xA4, 0x4A, 0xA9, 0xC4, 0xCB, 0x22, 0xD6, 0xEF, 0xC4, 0x1B, 0x31,
-    0x14, 0x0C, 0x18, 0x0A, 0xC7, 0xCB, 0x92, 0x45, 0x76, 0x59, 0x52, 0xA5, 0x03, 0xAF, 0xC5, 0x55,
-    0x4F, 0xE2, 0x02, 0xDC, 0xDF, 0x05, 0x20, 0x75, 0x0C, 0x92, 0xA9, 0x2A, 0x79, 0x65, 0xC0, 0x2B,
-    0xE3, 0x6A, 0x65, 0xB9, 0xAF, 0x18, 0x1A, 0x17, 0x8B, 0x4D, 0x6E, 0x2C, 0x62, 0xAA, 0xD4, 0xEC,
-    0xC2, 0x3A, 0xC7, 0x56, 0xAD, 0xE5, 0x8B, 0x4D, 0xAA, 0xA2, 0xF2, 0x28, 0x22, 0x14, 0xFC, 0xD5,
-    0x67, 0xB9, 0x8F, 0x57, 0x42, 0x51, 0x91, 0xB5, 0xAD, 0xA4, 0x53, 0xD9, 0xC0, 0x06, 0xDE, 0x39,
-    0x88, 0x35, 0x2B, 0x03, 0x22, 0xFE, 0x07, 0x59, 0x4C, 0x8B, 0x2D, 0xFA, 0xC5, 0xE0, 0xC8, 0x23,
-    0xB3, 0x0F, 0x27, 0x74, 0x9D, 0x5E, 0xA9, 0xC4, 0xD7, 0xCB, 0x3B, 0x99, 0xF9, 0xC1, 0x12, 0x3B,
-    0xD8, 0x43, 0xC2, 0x55, 0xE1, 0xCC, 0x54, 0xEF, 0x7E, 0x92, 0x4C, 0x7F, 0x94, 0x5F, 0x59, 0xC8,
-    0x6B, 0x0B, 0x89, 0x3F, 0xB0, 0x13, 0x44, 0xCE, 0x86, 0xD2, 0xF6, 0x90, 0x3C, 0xBE, 0x7D, 0xBE,
-    0xB4, 0x9F, 0x6E, 0xB7, 0xB6, 0x16, 0x70, 0x9F, 0x9F, 0xED, 0x24, 0x84, 0x7A, 0x07, 0xAB, 0x7E,
-    0x9F, 0x5C, 0x6D, 0x79, 0x9B, 0x37, 0x4C, 0x6A, 0xCD, 0xF8, 0x6A, 0x23, 0x21, 0x4E, 0x1A, 0xC0,
-    0x23, 0x55, 0x72, 0x15, 0xF6, 0x72, 0xDD, 0x60, 0xEE, 0xE6, 0xAE, 0x1B, 0xBB, 0xAE, 0x77, 0xCF,
-    0x75, 0x53, 0xA3, 0xDD, 0xE0, 0x9A, 0xEB, 0xEE, 0xBB, 0x6E, 0xFC, 0x82, 0x76, 0xFD, 0xD6, 0xA8,
-    0x2A, 0x37, 0x66, 0xA7, 0x7A, 0x84, 0xFF, 0x63, 0x1E, 0xE7, 0x8F, 0xE2, 0x43, 0xC5, 0x50, 0x30,
-    0x3C, 0x80, 0x42, 0xA5, 0x9D, 0x36, 0x2B, 0x36, 0xF7, 0xD9, 0xBC, 0xD7, 0xB0, 0x69, 0xD8, 0xFC,
-    0xA2, 0x0B, 0xDA, 0xC7, 0xCB, 0xBD, 0x5B, 0xE5, 0x45, 0xAA, 0xC9, 0x7E, 0xA8, 0x2A, 0xC2, 0x6D,
-    0x5C, 0x10, 0xE0, 0x52, 0xBF, 0x4D, 0xCE, 0xB4, 0x91, 0x8E, 0xEA, 0x82, 0x0F, 0xF2, 0xF3, 0x65,
-    0xBE, 0xE5, 0xB7, 0xC1, 0x1D, 0x2C, 0x90, 0x74, 0x9B, 0x57, 0x4D, 0x6C, 0x42, 0x1A, 0x34, 0x73,
-    0x36, 0x03, 0x6D, 0xA6, 0x6C, 0x7A, 0xDA, 0x8C, 0x5B, 0x78, 0xFF, 0x39, 0x6A, 0x98, 0xC6, 0x67,
-    0xF0, 0x42, 0x91, 0xE0, 0x2C, 0xB4, 0xEA, 0x2E, 0x61, 0xAF, 0xBA, 0x4F, 0x2B, 0x76, 0x18, 0x0B,
-    0xE8, 0xC4, 0xF5, 0x13, 0x74, 0xA4, 0x31, 0x20, 0xD7, 0x71, 0xB5, 0xA3, 0x33, 0x11, 0x3B, 0xE6,
-    0xCD, 0x69, 0xCB, 0x48, 0xFC, 0xA5, 0xB5, 0xD7, 0xEE, 0xBE, 0x3A, 0x19, 0x3B, 0x1A, 0xBA, 0x67,
-    0x85, 0xA3, 0xCF, 0xC1, 0xFA, 0xE6, 0x8F, 0xB0, 0x40, 0xA5, 0x96, 0x1C, 0xD4, 0x13, 0xBF, 0xB6,
-    0x33, 0x6A, 0x27, 0xBA, 0xFB, 0x53, 0xC7, 0x19, 0x3B, 0x1E, 0xE3, 0x06, 0x3F, 0x9B, 0xE5, 0x32,
-    0x73, 0x5C, 0xB3, 0x1F, 0xCF, 0xCC, 0x67, 0xDB, 0x8D, 0x6E, 0x23, 0xBF, 0xB0, 0x3B, 0xA3, 0x09,
-    0x7E, 0x36, 0xC9, 0xDA, 0xA6, 0xC9, 0xFC, 0x3E, 0xB0, 0xFD, 0x28, 0x51, 0x63, 0xEC, 0x3D, 0x4C,
-    0x9D, 0x19, 0xD7, 0x61, 0xEF, 0x11, 0x86, 0x33, 0x40, 0xA0, 0x9C, 0xBB, 0xCA, 0xE7, 0x06, 0x1E,
-    0xD8, 0x07, 0x3D, 0x0F, 0x2C, 0xE2, 0x5E, 0xA1, 0x2C, 0x1E, 0x21, 0x6A, 0x87, 0x91, 0xA0, 0x8B,
-    0x88, 0x35, 0x71, 0x8D, 0x3D, 0xBE, 0x05, 0x50, 0x16, 0xB0, 0xE7, 0x48, 0x50, 0xF5, 0x1F, 0x74,
-    0x0C, 0x94, 0xF0, 0x76, 0x4D, 0xFF, 0x4E, 0xCB, 0x2C, 0xE8, 0x36, 0x05, 0x53, 0xD1, 0x17, 0xF7,
-    0x4F, 0xDF, 0xC1, 0xD6, 0x8F, 0xAC, 0x3D, 0x55, 0x8B, 0x79, 0xDB, 0x76, 0xEA, 0x05, 0x5B, 0xF0,
-    0x15, 0x9C, 0x98, 0x9C, 0xAA, 0xBC, 0x49, 0xA2, 0x2B, 0xAD, 0x94, 0x10, 0x77, 0xA0, 0x55, 0x80,
-    0x14, 0xF1, 0x20, 0x1B, 0x61, 0x13, 0xFC, 0x23, 0x4B, 0x8A, 0xDE, 0xBB, 0xD3, 0x84, 0xB5, 0x91,
-    0x9D, 0xDE, 0x6F, 0xE3, 0x2A, 0x4D, 0x05, 0xD6, 0x8F, 0xDF, 0xAA, 0x8C, 0x5C, 0x0E, 0x3E, 0xEE,
-    0xE2, 0x2A, 0xC9, 0xBA, 0x13, 0x41, 0xA3, 0xA6, 0xB7, 0x7B, 0x4A, 0xBF, 0x84, 0xB7, 0x4C, 0xE5,
-    0x85, 0xE8, 0x4A, 0x93, 0xC4, 0x95, 0xDF, 0xF6, 0xC1, 0xB5, 0x46, 0x5E, 0x3B, 0x21, 0x1D, 0xE4,
-    0x39, 0x2D, 0x1B, 0x27, 0x24, 0xB8, 0x59, 0x45, 0xEF, 0x64, 0xB2, 0x6C, 0xFD, 0x7B, 0x95, 0xA4,
-    0xEF, 0xCB, 0xEB, 0xAD, 0x84, 0x93, 0xE0, 0x46, 0xCF, 0x66, 0x01, 0x43, 0xA4, 0x12, 0x9B, 0xD1,
-    0x25, 0xD2, 0x9A, 0x91, 0x8A, 0x50, 0x29, 0x01, 0x91, 0xB2, 0x61, 0xA9, 0x65, 0xA3, 0x11, 0x6A,
-    0x10, 0x5C, 0x13, 0x29, 0xD3, 0x05, 0xC1, 0x3E, 0x23, 0x4D, 0x0A, 0x33, 0x04, 0xE0, 0xF1, 0x9B,
-    0xA4, 0x22, 0xAF, 0x2B, 0x3D, 0x20, 0xF5, 0x06, 0xD2, 0xB0, 0x1F, 0x82, 0xE5, 0x6E, 0xD9, 0x0E,
-    0xC4, 0xBD, 0x8A, 0xF4, 0xBE, 0x46, 0x15, 0xFD, 0x57, 0x81, 0xDA, 0x65, 0x38, 0x58, 0x9F, 0x79,
-    0xAB, 0xF0, 0x94, 0xEF, 0x27, 0x17, 0xE5, 0x26, 0x03, 0xB1, 0x82, 0xD3, 0x40, 0xA2, 0xC4, 0xFE,
-    0x15, 0x52, 0xD8, 0x09, 0xEC, 0xDF, 0xDF, 0xBE, 0x4D, 0xC4, 0xCF, 0x5B, 0x48, 0x1C, 0x0D, 0x61,
-    0x47, 0xCC, 0xA6, 0x48, 0xD5, 0x44, 0xC8, 0x87, 0x79, 0xBD, 0x21, 0x86, 0x3F, 0xE5, 0xF0, 0x07,
-    0x6C, 0xA7, 0x81, 0x39, 0xE8, 0x0F, 0x4C, 0x07, 0xA5, 0xA7, 0x2B, 0x89, 0x31, 0x6D, 0xD4, 0x4B,
-    0x32, 0x88, 0xFD, 0xB4, 0x2C, 0xE9, 0x37, 0xA7, 0x2A, 0xA0, 0x2E, 0xA1, 0x61, 0xEB, 0x58, 0xE8,
-    0x3F, 0xBE, 0xBB, 0xBB, 0x7B, 0x91, 0xD9, 0xC6, 0x2A, 0xEA, 0xAD, 0xA0, 0xD7, 0xB3, 0xC0, 0xA2,
-    0x90, 0xB9, 0x2A, 0x22, 0x8C, 0x47, 0x23, 0x10, 0x83, 0x41, 0x87, 0xAC, 0xC1, 0x59, 0x45, 0x54,
-    0x05, 0x62, 0xCD, 0xE2, 0x0A, 0x9A, 0xD8, 0x3D, 0xAA, 0x35, 0xB2, 0xB5, 0x72, 0xB1, 0xC8, 0x28,
-    0x99, 0x28, 0xAC, 0xC9, 0x0F, 0x27, 0x24, 0x61, 0xE6, 0x11, 0x51, 0x05, 0x39, 0xA0, 0x75, 0x09,
-    0x5F, 0x17, 0x05, 0x0A, 0x4A, 0xB9, 0x9E, 0xD4, 0x8B, 0x8F, 0xA3, 0x96, 0x7B, 0xD5, 0x1C, 0x3C,
-    0xB9, 0xFD, 0x44, 0x11, 0x56, 0x71, 0x3A, 0x45, 0xD4, 0x32, 0xEB, 0x0D, 0x54, 0x2B, 0x9A, 0x79,
-    0x86, 0x26, 0x74, 0x81, 0xB8, 0xEC, 0xB9, 0xA0, 0x64, 0x88, 0xF2, 0xC8, 0x81, 0x57, 0xC4, 0xD4,
-    0x8D, 0x0C, 0xE4, 0x30, 0xFE, 0x50, 0x8F, 0x82, 0xA7, 0xD0, 0x02, 0xB6, 0xFA, 0x9E, 0xB5, 0xD7,
-    0xB7, 0xE0, 0x51, 0x94, 0x63, 0xA4, 0xDE, 0x62, 0xAA, 0x0C, 0x27, 0x8C, 0x6C, 0x2A, 0x16, 0xD3,
-    0xEB, 0x70, 0xC5, 0xC4, 0x26, 0x6C, 0x80, 0x26, 0xEC, 0x37, 0x30, 0xF3, 0xA0, 0x89, 0x01, 0xB2,
-    0x53, 0x51, 0x5C, 0xFB, 0x0E, 0xC9, 0xBD, 0x39, 0x53, 0x68, 0x62, 0xD2, 0x74, 0xA9, 0x4A, 0x09,
-    0xBA, 0xC7, 0x78, 0x45, 0x8C, 0xC3, 0xCD, 0xE9, 0x86, 0x88, 0x40, 0x18, 0xA3, 0x9A, 0x3D, 0x8B,
-    0x31, 0x1F, 0x7E, 0x0D, 0x35, 0xD7, 0x3F, 0x96, 0xE8, 0x41, 0x97, 0xE3, 0xD8, 0xA9, 0xCC, 0x04,
-    0x48, 0xC0, 0xED, 0x9A, 0xEF, 0xA9, 0xED, 0x84, 0x5C, 0xA6, 0x5C, 0x69, 0x00, 0x0D, 0x12, 0x9F,
-    0x81, 0x6C, 0x5E, 0x36, 0x3E, 0x7A, 0xD1, 0x51, 0xA3, 0x12, 0xD9, 0xC4, 0xC1, 0xA6, 0x32, 0x84,
-    0xF4, 0xB9, 0xE7, 0x6C, 0xFB, 0x6D, 0xD1, 0x64, 0xE2, 0x72, 0xC2, 0xE0, 0x56, 0x9F, 0xF3, 0xDC,
-    0x22, 0x1C, 0x54, 0xBA, 0x46, 0xE5, 0x4E, 0xA6, 0x79, 0xD4, 0xC0, 0xD0, 0xBC, 0x82, 0x97, 0xDE,
-    0x98, 0xB8, 0x86, 0x3C, 0x6C, 0xB8, 0xA9, 0x7C, 0xD5, 0x38, 0xE0, 0x7A, 0x6F, 0x4B, 0x73, 0xAE,
-    0x29, 0x12, 0x08, 0xCA, 0xB8, 0xCC, 0x4A, 0xDB, 0xD2, 0x3B, 0x4B, 0x6F, 0x3A, 0xD9, 0xB3, 0x31,
-    0x05, 0x9D, 0x3F, 0xA0, 0x40, 0xF1, 0x87, 0x10, 0x13, 0x10, 0x20, 0xEC, 0xC1, 0x01, 0x03, 0x2A,
-    0x41, 0xAC, 0x79, 0x03, 0xE3, 0xBC, 0xA2, 0x69, 0xA3, 0x66, 0xDD, 0xE2, 0xB2, 0xA8, 0x8D, 0xE9,
-    0x90, 0xE9, 0xDD, 0xED, 0x86, 0x38, 0x28, 0x8A, 0xE2, 0x74, 0x0F, 0x93, 0x8F, 0x4E, 0xA0, 0x7C,
-    0xCD, 0xA5, 0x65, 0x79, 0x7D, 0xA5, 0x89, 0x83, 0x55, 0x63, 0x5C, 0x35, 0x86, 0x95, 0x87, 0xAF,
-    0x1A, 0xFE, 0x9C, 0x12, 0x1F, 0xAA, 0x30, 0x68, 0x1F, 0xAA, 0x52, 0xCD, 0x14, 0xD1, 0x13, 0x93,
-    0x9B, 0x58, 0x98, 0x66, 0x8C, 0x2F, 0x51, 0x32, 0x1E, 0xB6, 0x14, 0x70, 0xE8, 0x10, 0x6F, 0x30,
-    0x24, 0xFF, 0x44, 0xDF, 0xBB, 0x42, 0xA7, 0xBA, 0x51, 0xD3, 0xBA, 0x04, 0x7D, 0x67, 0xEC, 0x99,
-    0x91, 0xEF, 0x92, 0x3C, 0xC3, 0xDC, 0xBE, 0x13, 0xC2, 0xAC, 0xA8, 0x15, 0x0A, 0xDF, 0x6E, 0x9F,
-    0x62, 0x42, 0x8A, 0xEA, 0xE8, 0x06, 0x04, 0x8F, 0xAF, 0xF4, 0x41, 0x9B, 0x3E, 0xD7, 0xFA, 0x7D,
-    0x2E, 0xEF, 0x7A, 0x87, 0x65, 0x8A, 0x23, 0x97, 0x0F, 0xC9, 0x30, 0xCB, 0x11, 0x5C, 0x62, 0x3E,
-    0x64, 0xCA, 0x09, 0x6C, 0xE6, 0xD9, 0x25, 0x2E, 0x4B, 0x98, 0x30, 0x89, 0x34, 0xB4, 0x17, 0xC2,
-    0x97, 0x01, 0xD3, 0xAE, 0x6D, 0x5F, 0x5F, 0x94, 0xBF, 0x53, 0x68, 0xFE, 0xF3, 0xDE, 0xAD, 0xDD,
-    0xF2, 0x5F, 0x18, 0x85, 0xF8, 0xB0, 0x23, 0xEC, 0xC5, 0xE6, 0x91, 0xB4, 0xCD, 0x38, 0xB2, 0xDC,
-    0x86, 0x38, 0x48, 0x6E, 0x95, 0x1D, 0x0F, 0x1B, 0x79, 0xEE, 0xC8, 0xF8, 0xCF, 0x56, 0xB1, 0xEB,
-    0x98, 0xFB, 0xDA, 0x26, 0x3E, 0x9B, 0xAA, 0xDA, 0x7A, 0xE5, 0x9E, 0x9E, 0xC6, 0x4B, 0x4A, 0x2C,
-    0x0C, 0xEC, 0x6F, 0xEB, 0x44, 0x4C, 0x8B, 0x82, 0x18, 0x20, 0x7E, 0x42, 0x08, 0xF5, 0x1D, 0xF1,
-    0x05, 0xAB, 0x99, 0xF4, 0x20, 0x42, 0xCD, 0x61, 0x38, 0x58, 0xC7, 0x04, 0x80, 0x61, 0xC4, 0x6C,
-    0xCC, 0x07, 0x01, 0x21, 0xB3, 0x24, 0xF6, 0x2C, 0x35, 0x47, 0x7E, 0xC6, 0x61, 0xF3, 0x0E, 0x57,
-    0x4F, 0x70, 0xDC, 0x2E, 0xE8, 0x81, 0x39, 0x75, 0xFC, 0xF1, 0xC8, 0xE1, 0x33, 0x23, 0x87, 0xC3,
-    0x91, 0xC3, 0xD1, 0x84, 0xE1, 0x26, 0xB2, 0xB7, 0x2F, 0xD9, 0x82, 0x90, 0x30, 0xA1, 0xD4, 0xD4,
-    0xA0, 0x09, 0x3F, 0xD1, 0x00, 0x50, 0x3F, 0x3A, 0x71, 0x28, 0x84, 0xD0, 0x7E, 0x5A, 0x8D, 0xC1,
-    0xC8, 0xEA, 0x4A, 0x13, 0xBD, 0x26, 0xBC, 0xA3, 0x15, 0xF8, 0x59, 0x0A, 0x35, 0x22, 0x44, 0x00,
-    0x77, 0xB9, 0x06, 0xCB, 0xA8, 0x48, 0x6F, 0xED, 0x36, 0xC9, 0xF8, 0x4A, 0x79, 0x6B, 0x6F, 0x79,
-    0xC1, 0xE5, 0x7F, 0x30, 0x6E, 0xB2, 0xB5, 0xFC, 0xFC, 0x62, 0xDA, 0x52, 0x35, 0x7F, 0xA9, 0xEB,
-    0x6A, 0x30, 0x1B, 0x6B, 0x74, 0xD0, 0xCD, 0xC5, 0x3D, 0x77, 0x1C, 0x98, 0x7B, 0x8A, 0xEB, 0x41,
-    0xCF, 0x81, 0xE8, 0x73, 0xC5, 0x83, 0xAB, 0x87, 0xCF, 0x27, 0x55, 0xE6, 0x44, 0x74, 0x70, 0x48,
-    0x8D, 0xE4, 0xD2, 0x69, 0xED, 0x28, 0x2E, 0xA4, 0x75, 0x51, 0xD4, 0x1C, 0x62, 0xEC, 0xA8, 0x06,
-    0xFE, 0x42, 0xB9, 0x5A, 0x2C, 0x5E, 0xB6, 0xD7, 0x45, 0xD6, 0x09, 0x2C, 0x0C, 0x20, 0x2D, 0x61,
-    0x5E, 0xB5, 0xB7, 0x76, 0x77, 0x69, 0x14, 0xFB, 0x77, 0x8B, 0xCC, 0xF0, 0xAE, 0x03, 0x98, 0xEA,
-    0x30, 0x28, 0x1C, 0xEA, 0x54, 0x33, 0x78, 0xFC, 0x1A, 0x48, 0x7D, 0x69, 0x52, 0x68, 0x2F, 0x00,
-    0xAF, 0xA8, 0xD5, 0xF5, 0xED, 0xC0, 0x3A, 0x88, 0x74, 0xDF, 0xB1, 0x97, 0x91, 0x3D, 0x97, 0x1A,
-    0xC4, 0x74, 0xFB, 0xEB, 0x85, 0x69, 0x52, 0xB0, 0xDC, 0xA0, 0x24, 0x8D, 0x5B, 0xD4, 0x7A, 0x90,
-    0x6F, 0x9F, 0xFC, 0xA5, 0xCC, 0x2B, 0x18, 0xCC, 0xB5, 0x16, 0xAC, 0x30, 0x18, 0xB1, 0x20, 0x84,
-    0xC1, 0x31, 0x58, 0x1E, 0x1F, 0x74, 0x2B, 0x4D, 0xE1, 0x4A, 0xC5, 0x7D, 0x56, 0xB0, 0x29, 0x19,
-    0xC3, 0x60, 0x88, 0x72, 0x04, 0xBA, 0x6B, 0xF6, 0x3D, 0x3C, 0x6C, 0xEC, 0x5E, 0x4D, 0xDC, 0xEF,
-    0xF8, 0xB2, 0xE9, 0x57, 0x61, 0x93, 0xAE, 0x0A, 0xE2, 0x67, 0xE4, 0x3B, 0xE0, 0xB5, 0x95, 0x1D,
-    0x76, 0xB9, 0xCB, 0xA8, 0xAC, 0x03, 0x3D, 0x4D, 0x4D, 0x77, 0x86, 0x64, 0x5A, 0x2B, 0x7F, 0xB6,
-    0x77, 0x7D, 0xCB, 0xD3, 0xE1, 0x70, 0xB6, 0x12, 0x73, 0x44, 0xAE, 0xD9, 0xFB, 0xFF, 0x1A, 0xA6,
-    0x22, 0x93, 0x2A, 0x98, 0x5E, 0x44, 0x37, 0xB4, 0x03, 0x86, 0x43, 0x2D, 0x15, 0x8F, 0x66, 0x67,
-    0x4F, 0x15, 0xEA, 0xA9, 0x72, 0x25, 0x9F, 0xC8, 0x7F, 0xDC, 0xC9, 0xFA, 0xFC, 0x5A, 0x99, 0xC1,
-    0x7F, 0x85, 0x5A, 0x73, 0xC7, 0x61, 0x59, 0x5A, 0xCB, 0xA1, 0xD3, 0xC2, 0x2D, 0xF4, 0x27, 0x71,
-    0x29, 0x21, 0xB5, 0xB5, 0xFB, 0xD1, 0xC1, 0x75, 0xEB, 0xF0, 0x7E, 0xDE, 0x56, 0xFD, 0xFC, 0x5B,
-    0xC5, 0x2F, 0x65, 0x34, 0x37, 0x6D, 0xDA, 0x47, 0xD7, 0xCE, 0xD6, 0xF6, 0x64, 0x75, 0xF9, 0x99,
-    0x3E, 0xAC, 0x9F, 0x8E, 0xAF, 0x5D, 0xCD, 0x9E, 0xF5, 0xEB, 0x21, 0xE9, 0x82, 0xEA, 0x69, 0x53,
-    0xE4, 0x9F, 0x3C, 0xEB, 0xC3, 0x5B, 0xAC, 0xBE, 0xC2, 0xE3, 0x3D, 0x55, 0x6D, 0x17, 0x5E, 0xFF,
-    0x15, 0x03, 0x07, 0xCB, 0x44, 0xDE, 0xC3, 0x32, 0x97, 0x70, 0x27, 0x12, 0xAB, 0x44, 0x8E, 0x7F,
-    0x1E, 0x4E, 0xCC, 0xB3, 0xF9, 0x61, 0xA5, 0xF4, 0xCD, 0x12, 0x3A, 0xDE, 0x29, 0x7C, 0xFF, 0xB6,
-    0x67, 0xF1, 0x18, 0x35, 0xF5, 0xAC, 0x40, 0x93, 0x79, 0x8B, 0xD3, 0x9F, 0x6E, 0x32, 0x14, 0xB4,
-    0x6A, 0xD1, 0x60, 0x61, 0x2E, 0x85, 0x43, 0xC9, 0x36, 0x2B, 0xEB, 0x0E, 0x11, 0x5F, 0xBB, 0x3A,
-    0x87, 0x05, 0x97, 0x22, 0x19, 0x17, 0xA9, 0xCA, 0x57, 0xA3, 0xFE, 0x6A, 0x94, 0x85, 0x9A, 0xD8,
-    0x79, 0xD4, 0xC8, 0xF1, 0xB8, 0x19, 0xE4, 0x09, 0x0C, 0x7A, 0x48, 0x47, 0xA8, 0xBA, 0x0B, 0x9C,
-    0x7B, 0x9F, 0xCA, 0xAF, 0xC9, 0x1C, 0x6D, 0x73, 0xBB, 0x5A, 0x2F, 0xFC, 0xE0, 0x73, 0x3C, 0x71,
-    0x45, 0x1F, 0x3A, 0xE5, 0x48, 0xBB, 0x35, 0xA2, 0x5E, 0x11, 0xDC, 0x6D, 0x86, 0xF9, 0xD1, 0xA1,
-    0xFE, 0x99, 0xF0, 0x15, 0xA2, 0x55, 0x10, 0xDF, 0x12, 0x73, 0x29, 0x34, 0xF1, 0x22, 0x9C, 0x35,
-    0x30, 0xCB, 0x98, 0x3D, 0xD6, 0xCB, 0x04, 0x86, 0xC0, 0xF6, 0x8F, 0xA8, 0xBD, 0x2C, 0x9C, 0x6F,
-    0x39, 0x1F, 0x1A, 0x52, 0xED, 0xEE, 0xF8, 0xAD, 0x7B, 0x15, 0xBE, 0xE6, 0xDE, 0xBA, 0xEE, 0x79,
-    0x3B, 0x04, 0x8D, 0xF3, 0x15, 0x7C, 0x96, 0x5A, 0xBB, 0xD1, 0xD2, 0xEB, 0xFA, 0x8B, 0x2A, 0x0E,
-    0x93, 0x8F, 0xF7, 0xEE, 0x45, 0x89, 0x88, 0xDA, 0x70, 0xE8, 0x1E, 0x17, 0x19, 0x51, 0x3A, 0x68,
-    0xDE, 0x8F, 0xE4, 0x47, 0x98, 0xB4, 0x67, 0x09, 0xEB, 0x54, 0x70, 0x80, 0x70, 0x1F, 0xD2, 0x6B,
-    0x14, 0x68, 0x08, 0x6A, 0xBC, 0x2A, 0x54, 0x73, 0x9B, 0xAE, 0x06, 0xC2, 0xDE, 0x07, 0x2E, 0xEB,
-    0xBE, 0x37, 0xA7, 0xEC, 0xB8, 0x99, 0x83, 0xE0, 0xD6, 0x9E, 0x73, 0x5F, 0x57, 0xBF, 0x94, 0xEE,
-    0xA1, 0x25, 0x4F, 0xBA, 0xD9, 0xD9, 0x71, 0x8B, 0x23, 0x89, 0xFC, 0xEB, 0x3A, 0xAF, 0xF2, 0x5D,
-    0xC9, 0xA8, 0xEA, 0xB4, 0x66, 0x05, 0x3F, 0xE6, 0x7E, 0xFA, 0x1B, 0x5B, 0xC5, 0xBD, 0xDF, 0xFB,
-    0x16, 0xC0, 0x92, 0x16, 0x61, 0x67, 0x2A, 0xEC, 0x31, 0x57, 0x3A, 0x4D, 0x8C, 0x39, 0x0F, 0x88,
-    0x3F, 0x6A, 0x79, 0xC0, 0xC1, 0x01, 0x3B, 0xD1, 0x83, 0x86, 0x9D, 0x7C, 0x22, 0x07, 0xA1, 0x63,
-    0x29, 0x57, 0xC4, 0xFD, 0x1F, 0x9D, 0x16, 0x97, 0x5E, 0x50, 0xBF, 0x6F, 0x28, 0x8E, 0xCD, 0x42,
-    0xBE, 0x7E, 0x3D, 0x7D, 0xB9, 0x68, 0xED, 0x04, 0x7C, 0x08, 0x5B, 0x42, 0xC5, 0xA8, 0x55, 0x7C,
-    0x96, 0x13, 0x23, 0x12, 0xE6, 0x8C, 0x90, 0x8F, 0x0C, 0x0C, 0x46, 0xC3, 0xF7, 0xED, 0xD2, 0x2A,
-    0x8A, 0x0F, 0xBE, 0x3E, 0x23, 0x5C, 0x29, 0x9E, 0xAF, 0x32, 0x95, 0x77, 0x69, 0xB9, 0xAB, 0xFF,
-    0x5F, 0x54, 0x34, 0x5B, 0x2B, 0x47, 0xAA, 0xF0, 0x23, 0x2F, 0x11, 0x97, 0xD3, 0xDC, 0x3F, 0x50,
-    0x92, 0xA8, 0x95, 0xC3, 0xEB, 0x9A, 0xD0, 0x14, 0x6B, 0x12, 0xCD, 0xF4, 0xA9, 0x7D, 0x09, 0xE7,
-    0xA7, 0x37, 0xAB, 0xE5, 0x24, 0xC9, 0xC7, 0xED, 0x46, 0x82, 0x84, 0xB9, 0x13, 0xBF, 0x89, 0x74,
-    0x84, 0x1D, 0xE6, 0x4C, 0x1F, 0x56, 0x7D, 0xD4, 0x8E, 0x5E, 0xBB, 0x41, 0x05, 0xED, 0xC4, 0x85,
-    0x39, 0x5D, 0x61, 0x22, 0xFE, 0xAC, 0xC5, 0x44, 0xB0, 0x1C, 0xBC, 0x16, 0xC9, 0xD6, 0x95, 0x93,
-    0xEE, 0xBA, 0xB9, 0xAA, 0x1A, 0x67, 0xA8, 0x39, 0x82, 0x5D, 0xE5, 0x51, 0x83, 0x1F, 0x45, 0xA4,
-    0x57, 0xD4, 0xD3, 0xB4, 0xC8, 0x66, 0xED, 0xA7, 0x05, 0xF6, 0x85, 0x1F, 0x60, 0xF6, 0x05, 0xAC,
-    0xED, 0x36, 0x5C, 0x23, 0xB7, 0x07, 0xE4, 0x7B, 0xA2, 0x62, 0x59, 0x49, 0x96, 0x0D, 0x64, 0xB4,
-    0xD4, 0x18, 0x93, 0xB1, 0x39, 0xC9, 0xBF, 0x5A, 0xD0, 0xC8, 0x43, 0x06, 0x4D, 0x0E, 0x85, 0x85,
-    0x77, 0x5F, 0xB4, 0x19, 0x16, 0x17, 0x6E, 0xD7, 0x62, 0x7B, 0x0C, 0x99, 0x45, 0xB8, 0xF8, 0x2D,
-    0x7A, 0x25, 0x6D, 0xF1, 0x97, 0x23, 0x8D, 0x80, 0x8D, 0xF2, 0x2D, 0xFE, 0x3F, 0x81, 0x5D, 0x23,
-    0x33, 0x3B, 0xB7, 0x67, 0xC7, 0xD9, 0x50, 0xC6, 0xF0, 0x52, 0x41, 0xB1, 0x02, 0x36, 0xC1, 0x4A,
-    0x60, 0x7F, 0xBF, 0x1F, 0xF5, 0x4E, 0x2E, 0xFD, 0xA3, 0xA2, 0x70, 0x28, 0xAD, 0xDF, 0xF9, 0x4F,
-    0xAF, 0xC3, 0x7E, 0xE1, 0xD6, 0x70, 0x2D, 0xF6, 0x3C, 0xC6, 0xBD, 0x3C, 0x03, 0x67, 0xF5, 0xEE,
-    0xF5, 0x23, 0xAB, 0x7A, 0x9E, 0x60, 0x35, 0x3E, 0x85, 0x47, 0xDB, 0xBF, 0x01, 0xD3, 0x5A, 0xB5,
-    0x6A, 0xD5, 0x92, 0xFF, 0x40, 0xF0, 0x18, 0x44, 0x34, 0x30, 0x00, 0x01, 0x00, 0x45, 0xD0, 0xB1,
-    0x0D, 0x02, 0x31, 0x0C, 0x05, 0x50, 0xDB, 0x57, 0x50, 0x66, 0x84, 0x8C, 0xC0, 0x08, 0xC7, 0x3C,
-    0x34, 0x8C, 0x10, 0x36, 0x63, 0x05, 0x36, 0x20, 0xA2, 0xA4, 0x72, 0x41, 0x03, 0x8A, 0x62, 0xBE,
-    0x13, 0x47, 0x44, 0x72, 0xEE, 0xE5, 0xCB, 0x76, 0x71, 0x44, 0xFF, 0xC3, 0x35, 0x90, 0x03, 0x6C,
-    0x81, 0x1C, 0x60, 0x0B, 0xE4, 0x00, 0xDB, 0x77, 0x02, 0x23, 0x47, 0x07, 0x37, 0xA2, 0xE4, 0xC8,
-    0x3A, 0xF7, 0xB0, 0xDD, 0xCF, 0xB4, 0x57, 0x1F, 0x79, 0x74, 0x42, 0x33, 0x76, 0x58, 0xDB, 0x00,
-    0xEC, 0xB0, 0x9A, 0xAC, 0x7A, 0x60, 0x54, 0xAC, 0x8E, 0x60, 0x43, 0xE1, 0xDB, 0x69, 0x37, 0x7B,
-    0x02, 0x7A, 0xC0, 0x25, 0xA8, 0x53, 0xC1, 0x43, 0xC6, 0x2C, 0xDA, 0x01, 0x4D, 0x28, 0xC7, 0xEB,
-    0x86, 0xC0, 0xE1, 0xED, 0x0B, 0xE4, 0x78, 0x27, 0x0F, 0x80, 0x6B, 0xF6, 0x80, 0xA4, 0x53, 0xD1,
-    0x81, 0x26, 0x23, 0x20, 0xF9, 0x5C, 0x74, 0xC2, 0x66, 0x00, 0xE8, 0x42, 0xFC, 0x0E, 0xD1, 0x85,
-    0x71, 0xFF, 0x00,
+static const uint8_t notosans_18_regularBitmaps[37937] = {
+    0xD5, 0x9C, 0x3D, 0x8C, 0x1E, 0xC7, 0x99, 0xA0, 0x9F, 0xEE, 0xD2, 0xA8, 0x61, 0x75, 0x50, 0x0A,
+    0xC8, 0xFB, 0x31, 0x81, 0x6B, 0x07, 0x1B, 0xEC, 0xE9, 0x00, 0x77, 0xBA, 0x89, 0xA6, 0x4A, 0x36,
+    0xEE, 0x0C, 0x9C, 0x03, 0xCD, 0x2D, 0xF8, 0xC9, 0x81, 0x02, 0x6D, 0x70, 0xC1, 0x42, 0x06, 0x8E,
+    0xC9, 0x05, 0x1B, 0x98, 0x53, 0x2D, 0x39, 0x50, 0xE0, 0x40, 0x04, 0x76, 0xBD, 0xC9, 0x05, 0xA7,
+    0xC0, 0x0B, 0xD0, 0xE3, 0x40, 0xF1, 0xE1, 0xA8, 0xE9, 0xF2, 0x11, 0x07, 0x07, 0x0C, 0xD8, 0xB6,
+    0x8E, 0xE7, 0xC0, 0x81, 0xDA, 0x27, 0x09, 0x84, 0xEC, 0x80, 0x65, 0xA9, 0xB5, 0xD3, 0x24, 0xAB,
+    0xFA, 0xBD, 0xA0, 0xFA, 0xFB, 0x38, 0x24, 0xF5, 0x63, 0xD9, 0x12, 0x21, 0x15, 0xE6, 0xEB, 0xAE,
+    0xAE, 0xAE, 0xEA, 0xAA, 0x7A, 0xEB, 0xAD, 0xF7, 0xBF, 0xA6, 0xBD, 0x1A, 0xCD, 0xD5, 0x68, 0xFE,
+    0x57, 0x6C, 0x5F, 0x9E, 0xDB, 0x97, 0xE7, 0xE6, 0xA5, 0xA9, 0x79, 0x66, 0x6A, 0xEC, 0xA4, 0x6D,
+    0xD0, 0x1C, 0x00, 0x7B, 0x2A, 0xBA, 0x37, 0x93, 0xF1, 0x07, 0xAE, 0xBC, 0x1D, 0xEB, 0x93, 0xD0,
+    0xFE, 0xF7, 0xEE, 0x70, 0xBF, 0x98, 0xE7, 0xEA, 0xCD, 0x51, 0x3F, 0x6B, 0x9F, 0x7E, 0x9A, 0x30,
+    0x29, 0x0F, 0xDF, 0xE4, 0x9B, 0x80, 0x61, 0x1F, 0xD8, 0x67, 0x1F, 0xB8, 0xC8, 0xD3, 0xC0, 0x15,
+    0x7E, 0x00, 0x5C, 0xE1, 0x0A, 0x10, 0x89, 0xC0, 0xCC, 0x4C, 0x2D, 0x22, 0x12, 0x6B, 0x11, 0x91,
+    0xF4, 0xF8, 0xCF, 0xEE, 0xFC, 0xEC, 0xCE, 0x65, 0x54, 0x50, 0x01, 0xD4, 0xA8, 0x46, 0x50, 0x83,
+    0x1A, 0xA0, 0xF2, 0xD5, 0x00, 0xB5, 0xAF, 0x3D, 0x67, 0x5F, 0xB8, 0xF1, 0xC2, 0x8D, 0x03, 0x23,
+    0x22, 0x12, 0xF2, 0x95, 0xD6, 0x36, 0x16, 0x5A, 0x5A, 0xC0, 0x60, 0x76, 0xDD, 0xEE, 0xF3, 0x34,
+    0x70, 0x91, 0x8B, 0xC0, 0x0F, 0xB8, 0xB2, 0xEB, 0x9C, 0x03, 0xA0, 0x05, 0xCA, 0xB0, 0x66, 0x7A,
+    0x99, 0xE9, 0x45, 0xA6, 0x56, 0xEE, 0x8A, 0x9A, 0xDB, 0xE2, 0xB5, 0xBE, 0x0C, 0xD4, 0x63, 0x0B,
+    0xC7, 0x65, 0xA0, 0x0A, 0x2D, 0x98, 0x5F, 0x05, 0x4A, 0x11, 0xA8, 0xE5, 0x36, 0xD4, 0xB2, 0x40,
+    0x25, 0x09, 0xDA, 0x7E, 0xA2, 0x0C, 0xCE, 0xD3, 0x12, 0x29, 0x83, 0x1E, 0x68, 0x49, 0x94, 0xA1,
+    0xB9, 0x66, 0xDB, 0x7A, 0xEE, 0x45, 0xA4, 0x16, 0x91, 0xEE, 0x9C, 0x48, 0xF7, 0x40, 0xA7, 0x65,
+    0xE0, 0xBE, 0xE4, 0x46, 0x68, 0xC1, 0x09, 0xE8, 0x0E, 0xF3, 0xDD, 0x40, 0xED, 0x69, 0xEC, 0x15,
+    0xAA, 0x11, 0xED, 0x75, 0xA7, 0x02, 0x2A, 0xA8, 0xB1, 0x98, 0x61, 0xCE, 0x00, 0xDC, 0xC7, 0x70,
+    0x11, 0x74, 0xA7, 0xBD, 0x01, 0x35, 0xAA, 0xD0, 0x5A, 0x98, 0x89, 0xBA, 0x3B, 0x8F, 0x61, 0xBF,
+    0xFE, 0xB9, 0x8C, 0xB5, 0x6F, 0xBE, 0xFD, 0x5B, 0x59, 0x98, 0xF5, 0xD5, 0x90, 0xF4, 0xD0, 0xDE,
+    0xFA, 0xED, 0xBC, 0xCF, 0xAC, 0x64, 0x8C, 0x8D, 0x35, 0x7C, 0xBD, 0xBB, 0x58, 0xFB, 0xDA, 0x83,
+    0x29, 0x43, 0x31, 0x41, 0x6B, 0x23, 0x17, 0x41, 0x7B, 0x43, 0x63, 0xA9, 0x7D, 0xED, 0xAB, 0x01,
+    0x35, 0x96, 0xA1, 0x0C, 0xA8, 0xC0, 0x45, 0x22, 0xC5, 0x8C, 0xEE, 0xF6, 0x21, 0x52, 0x4E, 0xC6,
+    0x72, 0x11, 0x8C, 0x74, 0x18, 0x50, 0xD2, 0x01, 0xB0, 0x77, 0x6F, 0x4A, 0x8D, 0x74, 0x40, 0x29,
+    0x32, 0x00, 0xED, 0x9D, 0xDE, 0x03, 0x0B, 0xA6, 0x83, 0x2A, 0xD0, 0x03, 0x4D, 0x57, 0x44, 0xC0,
+    0x51, 0x05, 0x20, 0x62, 0x3A, 0x50, 0x73, 0x19, 0x81, 0x6A, 0x6A, 0x07, 0xA0, 0xBE, 0x9B, 0x00,
+    0xB4, 0x0C, 0x00, 0x6D, 0x04, 0xA8, 0x64, 0xA2, 0x38, 0x4F, 0xFF, 0xD6, 0x8C, 0x1E, 0xEA, 0xA8,
+    0x67, 0x0C, 0xA6, 0xD3, 0x73, 0x19, 0xCB, 0x88, 0x9E, 0xF5, 0xA0, 0x47, 0xF4, 0xEC, 0x30, 0x16,
+    0x7D, 0x77, 0x22, 0x41, 0x2D, 0x5E, 0xCD, 0xA0, 0x23, 0x75, 0x00, 0x37, 0xD3, 0x4C, 0x34, 0x32,
+    0xD3, 0x2E, 0x3F, 0x93, 0x6B, 0x91, 0x56, 0x64, 0xAA, 0x23, 0xE7, 0x24, 0x51, 0x47, 0x38, 0x0F,
+    0xE0, 0x9C, 0x3B, 0xDC, 0xDF, 0xDF, 0x7F, 0xFA, 0xE9, 0xA7, 0xD1, 0x9D, 0x0A, 0x1C, 0xD3, 0x78,
+    0x35, 0xE3, 0xA8, 0x47, 0x12, 0x8D, 0x2F, 0x23, 0xA6, 0x53, 0x13, 0x86, 0x2A, 0xE4, 0x09, 0x9C,
+    0xBE, 0xA8, 0x09, 0x63, 0xCB, 0x99, 0xC6, 0x93, 0xD0, 0x63, 0x2E, 0x69, 0x3C, 0x0B, 0x2A, 0xD0,
+    0x74, 0x17, 0xD1, 0xBE, 0x88, 0x98, 0xAE, 0x0A, 0x2C, 0x34, 0x5E, 0x4D, 0x2C, 0xB4, 0xBE, 0x0A,
+    0x24, 0x8C, 0xD5, 0x63, 0x39, 0x73, 0x4C, 0xDB, 0xD5, 0x39, 0x63, 0x3A, 0x3D, 0xA8, 0x50, 0x44,
+    0x8E, 0x31, 0xB6, 0xF1, 0x7A, 0x54, 0xA1, 0x9C, 0x8B, 0x48, 0xE2, 0x10, 0x28, 0x2E, 0x43, 0x86,
+    0x5F, 0xE3, 0x01, 0x07, 0x30, 0x03, 0x6A, 0x44, 0xBD, 0xA3, 0xED, 0xA1, 0x96, 0xC3, 0x3E, 0x3A,
+    0x11, 0x09, 0x67, 0x5F, 0xBF, 0xB3, 0x01, 0x17, 0x40, 0x9D, 0x8C, 0xD0, 0x3E, 0x3B, 0x50, 0xC4,
+    0xC6, 0xA3, 0x47, 0xE3, 0x11, 0x7A, 0xCB, 0xDF, 0xB1, 0x43, 0xCA, 0x33, 0x5B, 0x14, 0xAD, 0xFD,
+    0x8A, 0xB0, 0x5C, 0x79, 0xB0, 0xE8, 0xA9, 0xA3, 0xE5, 0xE8, 0x27, 0x22, 0x22, 0x6F, 0x8B, 0x88,
+    0x74, 0x1F, 0x53, 0xEB, 0x81, 0xA2, 0xE2, 0xA0, 0xF5, 0xA2, 0xA6, 0xC6, 0xBB, 0x72, 0xD2, 0x7E,
+    0xBF, 0x08, 0xBC, 0x78, 0xF4, 0xDF, 0x64, 0xE9, 0xE5, 0xB7, 0x9B, 0xF3, 0x3B, 0x12, 0x03, 0xF5,
+    0x00, 0x11, 0xDA, 0x0E, 0x35, 0x81, 0x83, 0x7A, 0x84, 0x08, 0x8D, 0xA7, 0x9C, 0xC0, 0xE4, 0x39,
+    0x27, 0xD0, 0x9E, 0x72, 0x06, 0x63, 0xA9, 0x02, 0x1C, 0x83, 0xF6, 0x14, 0x11, 0x8C, 0x45, 0xAD,
+    0x05, 0x03, 0xC5, 0xFA, 0xA9, 0xB0, 0x02, 0x08, 0x80, 0x76, 0xB1, 0x54, 0x22, 0x1D, 0xEE, 0x8E,
+    0x74, 0x2A, 0xE2, 0x6C, 0xEB, 0xE9, 0x49, 0x90, 0xAA, 0x40, 0x39, 0xB7, 0x1D, 0x55, 0x48, 0xA0,
+    0xAF, 0x4E, 0x60, 0x9E, 0x1D, 0x20, 0x19, 0x50, 0x73, 0x84, 0xFA, 0xED, 0x00, 0xED, 0xAB, 0x1E,
+    0x8E, 0xB7, 0x45, 0xFA, 0xCD, 0x5D, 0xAD, 0xB6, 0x43, 0x05, 0x07, 0x8D, 0x4F, 0xB0, 0x94, 0x91,
+    0x2A, 0xA8, 0x19, 0xD7, 0x55, 0xCB, 0xF7, 0x23, 0xB5, 0x88, 0xA7, 0x92, 0x99, 0x8C, 0x68, 0x65,
+    0xC0, 0x0C, 0x95, 0xD8, 0x3E, 0xE9, 0x93, 0x0F, 0xE5, 0xD9, 0x37, 0x83, 0xF9, 0x0F, 0x24, 0xD4,
+    0x84, 0x1E, 0x30, 0xF6, 0x33, 0x65, 0x01, 0xE8, 0x17, 0x4B, 0x2B, 0xE2, 0x2B, 0xF9, 0xBD, 0xF8,
+    0x76, 0xA4, 0xEF, 0xFE, 0x12, 0x7A, 0x80, 0x04, 0xA8, 0x09, 0xD0, 0x03, 0x60, 0x2C, 0x14, 0x91,
+    0x0C, 0x57, 0x0C, 0xA0, 0x66, 0xA0, 0xF5, 0x50, 0x46, 0xA0, 0x1D, 0xA0, 0x4C, 0xA7, 0x33, 0xCD,
+    0x00, 0xC5, 0x43, 0x19, 0x76, 0xEB, 0xFF, 0xAA, 0x88, 0x2C, 0x00, 0x14, 0xBD, 0x58, 0x9C, 0x88,
+    0xD7, 0xF2, 0x3B, 0xF1, 0xED, 0x25, 0x7A, 0xFF, 0x17, 0x1F, 0x3D, 0x08, 0x40, 0xC5, 0xB5, 0xDB,
+    0xE7, 0x13, 0x88, 0x58, 0x94, 0x2C, 0x96, 0x27, 0x7E, 0x26, 0x1E, 0xE8, 0x3D, 0x60, 0xBA, 0x2D,
+    0x5E, 0xEF, 0x5A, 0x37, 0x9E, 0xFC, 0x41, 0x35, 0xFF, 0x57, 0x70, 0x3F, 0x97, 0x7F, 0xBA, 0x90,
+    0x2A, 0x11, 0x19, 0x1E, 0x17, 0x99, 0x61, 0xEF, 0x00, 0xB6, 0x0D, 0xDB, 0x00, 0x34, 0x11, 0xD0,
+    0x02, 0xD4, 0x6F, 0x79, 0xA8, 0x6E, 0x06, 0x50, 0x7F, 0x88, 0xA0, 0x26, 0x07, 0xE5, 0xDC, 0x78,
+    0x88, 0x55, 0x80, 0x54, 0x44, 0x38, 0xC6, 0x81, 0xA3, 0xF1, 0x79, 0x77, 0xB7, 0xB6, 0x88, 0x34,
+    0x1D, 0x0E, 0xED, 0x69, 0xBC, 0x1E, 0xA8, 0x82, 0x12, 0x11, 0x99, 0x45, 0x44, 0x16, 0x93, 0x91,
+    0x3F, 0xEF, 0xC1, 0x22, 0xB2, 0x1D, 0x6C, 0xE3, 0xB9, 0x57, 0xA8, 0x45, 0x12, 0x22, 0x32, 0x68,
+    0x91, 0x54, 0x44, 0xA0, 0xE9, 0xA0, 0x98, 0xD7, 0x4C, 0x39, 0x01, 0xAD, 0x5D, 0x33, 0xE6, 0xDF,
+    0x1F, 0xA0, 0x44, 0x6E, 0x63, 0x44, 0x66, 0xDE, 0x7B, 0x4E, 0x46, 0x40, 0xEC, 0x0A, 0xAB, 0xC6,
+    0xAF, 0x90, 0xD0, 0xC3, 0x9A, 0x69, 0xB6, 0x8B, 0xE6, 0xFE, 0x23, 0x34, 0xA1, 0xFF, 0xA7, 0xD7,
+    0x63, 0x2D, 0x22, 0x34, 0x22, 0x96, 0xE2, 0xFC, 0x16, 0xDF, 0xCF, 0xC9, 0x48, 0x23, 0x0B, 0xB5,
+    0x1C, 0xBD, 0x56, 0x0A, 0xE0, 0x3A, 0xD0, 0xE3, 0x3A, 0x68, 0x63, 0x41, 0x85, 0x75, 0xF0, 0xF5,
+    0x78, 0xEE, 0x27, 0x1C, 0xB7, 0x32, 0xE9, 0xDF, 0x88, 0x8C, 0x32, 0x21, 0xCF, 0x46, 0xCA, 0x28,
+    0xA0, 0xDF, 0x1A, 0x61, 0x49, 0x50, 0xFF, 0x7E, 0x80, 0xE3, 0x63, 0xA8, 0x6F, 0x06, 0x58, 0x8C,
+    0x45, 0xFF, 0x2A, 0x52, 0x46, 0x1D, 0xE8, 0xAD, 0x7B, 0xB7, 0x1F, 0x0B, 0x91, 0x99, 0x52, 0x52,
+    0x46, 0x74, 0x27, 0x22, 0x1F, 0x8A, 0x88, 0xDC, 0x5C, 0xC1, 0x55, 0x24, 0xA0, 0x0E, 0xA7, 0x51,
+    0x51, 0x0F, 0x6B, 0xF7, 0x6A, 0xDE, 0xCE, 0xF3, 0x98, 0x75, 0x54, 0xED, 0x76, 0xD6, 0xBB, 0x26,
+    0x65, 0x24, 0x0F, 0xFF, 0x81, 0x26, 0x02, 0x54, 0x13, 0x60, 0xEE, 0x6B, 0x92, 0xD3, 0x05, 0xE9,
+    0xD0, 0x22, 0x03, 0xF2, 0x3B, 0x19, 0xEA, 0x09, 0xE3, 0x8D, 0xC5, 0x3C, 0x13, 0xE1, 0xB8, 0x0A,
+    0x94, 0xB3, 0xF6, 0xD4, 0xA3, 0xB1, 0x18, 0xEB, 0xAC, 0x9A, 0xE9, 0x3B, 0xE7, 0xE9, 0x6F, 0xCD,
+    0xE0, 0xC4, 0x52, 0xCA, 0x02, 0xE6, 0xF7, 0x62, 0xAB, 0x58, 0x48, 0x67, 0x3A, 0xFA, 0x6F, 0x45,
+    0xE8, 0xF5, 0x4A, 0x19, 0xCA, 0x1D, 0x65, 0x30, 0xCF, 0x8E, 0x14, 0xB1, 0x19, 0x69, 0x82, 0xB9,
+    0xFD, 0x9C, 0xD0, 0x8A, 0x04, 0xCE, 0x49, 0x02, 0x36, 0xBB, 0x91, 0x2C, 0xA0, 0x45, 0x3A, 0xE4,
+    0x77, 0xD2, 0xD5, 0x13, 0xBD, 0x75, 0x96, 0xBE, 0x8C, 0x90, 0xF4, 0x40, 0x11, 0x0D, 0xA8, 0x10,
+    0x41, 0xBF, 0x19, 0x76, 0xD4, 0xA7, 0xA3, 0x9A, 0x7A, 0x30, 0x83, 0x50, 0xC9, 0x33, 0xF2, 0xBB,
+    0x94, 0x0A, 0x91, 0x37, 0x27, 0xDC, 0xAC, 0xB7, 0xB4, 0xBF, 0x98, 0x1F, 0x02, 0x64, 0xEB, 0x41,
+    0x25, 0xBE, 0xF6, 0x9C, 0x0C, 0x18, 0x59, 0x77, 0x19, 0x1B, 0xE0, 0x89, 0x7B, 0xF4, 0xF6, 0xBE,
+    0xB4, 0xA3, 0xC3, 0x65, 0x67, 0x7E, 0x2E, 0xDF, 0x89, 0x3A, 0xEC, 0xF1, 0x50, 0xDA, 0xB3, 0xA6,
+    0x4B, 0x55, 0x68, 0x7D, 0x52, 0xA1, 0xE9, 0xAE, 0x94, 0xE3, 0x8E, 0x6F, 0x54, 0x23, 0x14, 0xD2,
+    0x81, 0x9B, 0xA1, 0x59, 0xA0, 0x92, 0x8E, 0x42, 0x06, 0x70, 0x13, 0x34, 0x69, 0x8B, 0xCD, 0x8B,
+    0x85, 0x52, 0x06, 0x72, 0x45, 0x1A, 0xB1, 0x50, 0xCA, 0x08, 0xF4, 0x33, 0xD0, 0xCC, 0xEB, 0xB7,
+    0xC0, 0x9E, 0xDD, 0x6C, 0x36, 0xCF, 0x8A, 0x48, 0x12, 0x11, 0xB9, 0xB1, 0xD9, 0x6C, 0xCE, 0x3F,
+    0x3C, 0xA0, 0x5E, 0x44, 0xAE, 0x6F, 0xEB, 0xF8, 0x27, 0x01, 0x26, 0x40, 0x25, 0xA0, 0x12, 0x4B,
+    0x1E, 0xC2, 0xDA, 0xD7, 0x02, 0x94, 0xD2, 0x01, 0xFD, 0x08, 0xB4, 0x63, 0x7E, 0x2C, 0xFA, 0x29,
+    0xD7, 0x68, 0x97, 0x3C, 0xA0, 0x5A, 0x2E, 0x81, 0x19, 0x57, 0xA6, 0x5A, 0xEC, 0x3A, 0x2B, 0x65,
+    0xC1, 0x88, 0x0C, 0x66, 0x91, 0xF0, 0x4D, 0xAA, 0x79, 0x45, 0xE1, 0xB8, 0xA2, 0x5C, 0xCC, 0xCF,
+    0x6A, 0x06, 0x1D, 0x32, 0x2A, 0x4A, 0xDE, 0xBF, 0x3A, 0x64, 0x3C, 0x6D, 0x2D, 0xAB, 0xC8, 0x0A,
+    0x67, 0x4F, 0xCD, 0xE2, 0x6B, 0xEB, 0xC6, 0xEC, 0x7D, 0xFE, 0xB9, 0x2E, 0x97, 0xC1, 0xF7, 0xDF,
+    0xCB, 0x1D, 0x4B, 0x86, 0xD3, 0xD2, 0x0B, 0x20, 0x97, 0xA8, 0x52, 0xAE, 0x55, 0x4D, 0x79, 0xE1,
+    0x1B, 0xAF, 0xA6, 0x4C, 0x85, 0x8E, 0x29, 0x36, 0xB6, 0x9C, 0xB4, 0x2F, 0x44, 0xBC, 0x7E, 0x79,
+    0xA2, 0x97, 0xC4, 0x15, 0x43, 0x3B, 0xD4, 0x43, 0x75, 0x75, 0xAC, 0x02, 0x57, 0x78, 0xFA, 0x22,
+    0x6F, 0x50, 0x7B, 0xF5, 0x1B, 0xAF, 0x3D, 0x57, 0xD8, 0xBF, 0xC2, 0x8C, 0xF6, 0xEA, 0x96, 0x6F,
+    0x3A, 0x22, 0x4F, 0xC7, 0x62, 0x46, 0xFB, 0xEA, 0xBA, 0xD7, 0x1D, 0x91, 0x2B, 0x57, 0x88, 0xB4,
+    0x5E, 0xFF, 0xC8, 0xD7, 0x63, 0x95, 0xCA, 0x70, 0x11, 0xF3, 0x7F, 0xFF, 0xF9, 0xF6, 0xA2, 0xC6,
+    0x42, 0x92, 0x96, 0xCE, 0x50, 0x2E, 0xB4, 0x97, 0x8A, 0x39, 0x4F, 0x45, 0x0F, 0xF9, 0xBE, 0xF2,
+    0xA6, 0x42, 0x80, 0x27, 0x41, 0xC9, 0xA5, 0xBD, 0xDE, 0x42, 0x2D, 0x22, 0x13, 0x50, 0x89, 0xBC,
+    0x03, 0xF7, 0xF6, 0x46, 0x3D, 0x42, 0x86, 0x13, 0x34, 0x13, 0x80, 0x89, 0x00, 0xFB, 0x11, 0xE0,
+    0x8D, 0x43, 0x80, 0x68, 0x80, 0x22, 0x1A, 0x0B, 0x6A, 0x6A, 0x3C, 0xA8, 0xA0, 0x3D, 0xD4, 0x63,
+    0x3D, 0x82, 0x1E, 0xAA, 0xB0, 0x05, 0x43, 0xDB, 0x95, 0x33, 0x18, 0x8A, 0x08, 0xFD, 0x66, 0x93,
+    0x32, 0xC3, 0xA2, 0x10, 0x11, 0xA1, 0x5C, 0x8E, 0x8E, 0xFA, 0x4E, 0x4D, 0xD0, 0xF8, 0x2A, 0x80,
+    0x1E, 0xF4, 0x08, 0x75, 0x68, 0x3C, 0x54, 0xA1, 0xF5, 0xA0, 0xE6, 0x4C, 0x6A, 0x32, 0xFB, 0x59,
+    0x00, 0x16, 0x27, 0x77, 0x2C, 0x4E, 0x24, 0xE1, 0x44, 0xC4, 0x3B, 0x8A, 0x7E, 0x74, 0xA0, 0x83,
+    0x83, 0x6A, 0x72, 0x2B, 0x53, 0xB9, 0x77, 0xA9, 0x83, 0x83, 0x66, 0x70, 0x9B, 0xE7, 0xC4, 0x3A,
+    0x91, 0x69, 0x6D, 0xBB, 0x79, 0x4E, 0x86, 0x6D, 0x33, 0x15, 0xDD, 0xDA, 0x4B, 0x91, 0xEE, 0xBB,
+    0xA8, 0xE8, 0xA0, 0x8A, 0x0E, 0xDA, 0xE0, 0x44, 0x64, 0x70, 0x22, 0x62, 0xDD, 0x16, 0x62, 0xC0,
+    0x39, 0xB9, 0x0D, 0xBD, 0xC8, 0x84, 0x88, 0xC4, 0x42, 0x06, 0xFE, 0x0B, 0x19, 0xAF, 0xBB, 0x1D,
+    0x0B, 0xF4, 0x5B, 0x4A, 0x59, 0x4D, 0x3B, 0x1E, 0xD5, 0xB3, 0x7D, 0x53, 0x07, 0x56, 0x6A, 0x7A,
+    0xAA, 0xB0, 0x9A, 0x00, 0x16, 0xB6, 0x74, 0xB4, 0x9E, 0x58, 0x69, 0x6B, 0x5E, 0x93, 0x52, 0x3A,
+    0xF6, 0x68, 0xE5, 0x48, 0x6C, 0x29, 0x22, 0x03, 0xB5, 0xC8, 0x08, 0x7B, 0xE7, 0xC1, 0xC9, 0x1D,
+    0x4B, 0x21, 0x22, 0x13, 0x95, 0x88, 0x24, 0x1A, 0x5F, 0x5C, 0x48, 0x38, 0xA8, 0x53, 0x11, 0xA1,
+    0x8A, 0x55, 0x80, 0x6A, 0x6E, 0xFC, 0x0A, 0x1B, 0x9A, 0x5F, 0x46, 0xC0, 0xBC, 0x12, 0x80, 0x3E,
+    0x73, 0x33, 0x07, 0x54, 0x7F, 0x88, 0x40, 0xF3, 0x8B, 0x07, 0x8A, 0xEB, 0x3F, 0xEC, 0x6A, 0x17,
+    0xA9, 0xF1, 0x2B, 0x08, 0x71, 0x2F, 0xED, 0xBE, 0xDD, 0x0F, 0x8D, 0xE7, 0x42, 0x5E, 0x9F, 0xA1,
+    0x10, 0x91, 0x99, 0x4A, 0xE4, 0x3D, 0xC0, 0x89, 0x24, 0x27, 0xB2, 0x38, 0x91, 0xC5, 0xAD, 0x44,
+    0xF2, 0x63, 0x7F, 0x9B, 0xCD, 0x79, 0x27, 0x12, 0x9D, 0x48, 0x74, 0x9B, 0xCD, 0xF9, 0x4F, 0xAD,
+    0x9F, 0xBF, 0xBF, 0x9C, 0xFA, 0xFD, 0xF1, 0x7D, 0x3D, 0xD8, 0xDF, 0xD1, 0xD1, 0xE5, 0x3F, 0xAA,
+    0x0D, 0xA7, 0x25, 0x5A, 0x8A, 0x5E, 0xDE, 0xC9, 0xBC, 0x96, 0x5A, 0x44, 0x66, 0xE4, 0x1D, 0x2A,
+    0xAF, 0xF3, 0xDA, 0x76, 0x5B, 0x69, 0x2B, 0xAF, 0x70, 0x5E, 0xDC, 0xBC, 0xCE, 0x8D, 0xDF, 0xAD,
+    0x7E, 0x46, 0x84, 0x3A, 0x50, 0x8A, 0xBC, 0xEE, 0xA9, 0x65, 0xE9, 0xA1, 0x95, 0x3B, 0x11, 0xD0,
+    0x37, 0x27, 0xC0, 0xBC, 0x3A, 0x02, 0x8B, 0xF1, 0xA0, 0x66, 0x67, 0x41, 0x8F, 0x62, 0xC1, 0xBC,
+    0x24, 0x16, 0x96, 0x52, 0x3A, 0xD4, 0x5C, 0xCA, 0x9D, 0x23, 0x19, 0x8B, 0xCC, 0xEB, 0x2F, 0x88,
+    0xBC, 0x03, 0xC5, 0x26, 0x0F, 0x55, 0xFF, 0x22, 0x40, 0x11, 0xDD, 0x76, 0x69, 0xFF, 0xE8, 0xEC,
+    0x87, 0x9B, 0xCD, 0x73, 0xD1, 0x89, 0x88, 0xFC, 0x42, 0x24, 0xC3, 0xE8, 0xE8, 0xF5, 0x3F, 0xF5,
+    0x63, 0xF7, 0xB2, 0xDE, 0xC9, 0xFB, 0x22, 0x3F, 0xEF, 0x6F, 0xE3, 0x28, 0x22, 0x55, 0xA0, 0xF1,
+    0x9F, 0x31, 0xFB, 0xF8, 0xF2, 0x8C, 0xC8, 0x35, 0x11, 0xA8, 0x46, 0x7A, 0xEA, 0xF0, 0xE7, 0x5E,
+    0x46, 0x12, 0xE6, 0xBA, 0xCC, 0xB2, 0xD4, 0x8B, 0xCD, 0x4B, 0x5C, 0xA4, 0xC6, 0x53, 0x2C, 0x55,
+    0x80, 0xA5, 0x88, 0x20, 0x38, 0x10, 0x1A, 0x8F, 0x64, 0x75, 0xBA, 0x88, 0xF4, 0xE0, 0xE8, 0x2D,
+    0x8D, 0x77, 0x96, 0x2A, 0x38, 0x4B, 0x11, 0x5D, 0x07, 0xCE, 0x8C, 0xD0, 0x48, 0x82, 0x4A, 0x7A,
+    0x4F, 0x21, 0xDF, 0x89, 0xE0, 0xE8, 0x3B, 0x1A, 0xAF, 0x27, 0xAA, 0x80, 0x50, 0x44, 0x9A, 0x11,
+    0x47, 0x99, 0x68, 0x3C, 0xC6, 0x57, 0x01, 0x15, 0x8B, 0x08, 0xAE, 0x73, 0x50, 0x4F, 0x8D, 0x07,
+    0xA9, 0xC2, 0x6E, 0xB7, 0x7D, 0x91, 0xBF, 0xD3, 0x9B, 0x68, 0x04, 0xEA, 0xE4, 0x02, 0xA0, 0x93,
+    0x9B, 0x80, 0x26, 0xB9, 0x08, 0x98, 0x74, 0xB8, 0xDE, 0x8E, 0x81, 0x37, 0xD2, 0xA1, 0x03, 0x62,
+    0x3A, 0x34, 0x96, 0x62, 0x4E, 0x87, 0x6D, 0x87, 0x9A, 0xD2, 0xA1, 0xF6, 0xA8, 0x90, 0x0E, 0xF5,
+    0x40, 0x3D, 0x26, 0x57, 0x05, 0xB4, 0x4F, 0x4E, 0x4D, 0x34, 0x3E, 0xB9, 0x72, 0xA6, 0xB5, 0xC9,
+    0x11, 0x31, 0x24, 0x47, 0xE2, 0x90, 0xE4, 0x70, 0x44, 0x92, 0xC3, 0xE4, 0x5B, 0xFB, 0xF2, 0x44,
+    0x72, 0x34, 0x57, 0x03, 0xC9, 0xA1, 0x7F, 0x3D, 0x92, 0x1C, 0xF5, 0xEF, 0x07, 0x92, 0x43, 0x89,
+    0xCF, 0xB7, 0x8E, 0xE4, 0x28, 0x04, 0x92, 0x83, 0xF5, 0xF6, 0x06, 0x24, 0xD7, 0x81, 0xBA, 0x99,
+    0x00, 0xE7, 0x02, 0x54, 0x27, 0xD2, 0x81, 0x73, 0x09, 0xAA, 0x93, 0x5B, 0x01, 0xDC, 0xA1, 0xEB,
+    0xA8, 0x4E, 0xFE, 0x5F, 0x04, 0x77, 0xA8, 0x03, 0xD5, 0xC9, 0xE8, 0x3A, 0xDC, 0x61, 0x19, 0xA9,
+    0x4E, 0x46, 0x1D, 0x70, 0x0E, 0x67, 0xAB, 0x93, 0xA0, 0x22, 0xCE, 0xA1, 0xC7, 0xEA, 0x24, 0xE0,
+    0xAC, 0x73, 0xA8, 0x58, 0x9D, 0x04, 0xF4, 0x68, 0x1C, 0xF4, 0xDF, 0x3E, 0x09, 0xA8, 0x68, 0x1C,
+    0x34, 0x6F, 0x9F, 0x04, 0xE8, 0x9D, 0x03, 0x25, 0x27, 0x01, 0x1A, 0x71, 0x40, 0x7F, 0x12, 0x40,
+    0x89, 0x03, 0x9A, 0x70, 0x4F, 0x14, 0x7E, 0x07, 0x0A, 0x11, 0x19, 0x28, 0x45, 0x64, 0xA1, 0x94,
+    0x0E, 0x17, 0x0A, 0x81, 0x72, 0x41, 0x00, 0xE3, 0x9D, 0x05, 0x35, 0x1B, 0x0F, 0xF4, 0x7A, 0x04,
+    0x9A, 0x5F, 0x4F, 0x80, 0xBA, 0x13, 0x01, 0x24, 0xB3, 0x8B, 0x5B, 0x1E, 0xA8, 0xEF, 0x06, 0xA0,
+    0x5C, 0x32, 0xA9, 0x39, 0xF5, 0x42, 0x9F, 0x04, 0x40, 0xCD, 0x09, 0x20, 0xE5, 0x4F, 0xD5, 0x13,
+    0x60, 0x3A, 0x01, 0xDA, 0xA1, 0x09, 0xD0, 0x8E, 0xA5, 0x58, 0x5C, 0xA0, 0x95, 0x23, 0x09, 0x14,
+    0x22, 0x32, 0x92, 0x95, 0x73, 0xB2, 0x06, 0xE3, 0xE4, 0x3D, 0xAA, 0x95, 0xF7, 0x2D, 0x55, 0x28,
+    0xDC, 0xE4, 0xC0, 0xFD, 0x22, 0x64, 0x36, 0xA9, 0x6F, 0x06, 0x10, 0x07, 0xF5, 0x49, 0x80, 0xC5,
+    0x81, 0xFE, 0x75, 0xC8, 0xEC, 0xA2, 0x7F, 0xE5, 0xC3, 0xE7, 0xFA, 0xE0, 0x44, 0xE6, 0x4A, 0x24,
+    0xE1, 0x8E, 0xFE, 0x21, 0x2B, 0x65, 0x6E, 0xAB, 0x9D, 0x7D, 0x4A, 0x86, 0xAF, 0x1E, 0xBC, 0x5E,
+    0x08, 0x3B, 0x71, 0x6B, 0xD5, 0x7F, 0x29, 0xF3, 0x83, 0x09, 0x00, 0x2A, 0xAB, 0xE9, 0x67, 0xAD,
+    0x93, 0xF7, 0x2C, 0x5B, 0x91, 0x44, 0x70, 0x3C, 0x2E, 0x9D, 0x03, 0xE3, 0x1D, 0xE8, 0x71, 0x7B,
+    0xA9, 0x83, 0x83, 0x7A, 0xF7, 0xA8, 0x87, 0xB5, 0x4A, 0x21, 0x76, 0x2B, 0x05, 0x8D, 0x38, 0x91,
+    0x0E, 0x47, 0x33, 0xE0, 0xA8, 0x03, 0x0E, 0x35, 0xE3, 0x28, 0x63, 0xA6, 0x52, 0x0E, 0x9C, 0xBD,
+    0xEF, 0xCB, 0xF5, 0x4E, 0xEC, 0x29, 0xD2, 0x96, 0x75, 0x5D, 0x42, 0x44, 0xBC, 0x13, 0x89, 0x7A,
+    0xE6, 0xDC, 0x33, 0x69, 0x6B, 0x8F, 0x98, 0x81, 0xB6, 0x5B, 0x59, 0x53, 0x33, 0x02, 0xE2, 0x41,
+    0xC9, 0x25, 0xD0, 0x32, 0x42, 0x93, 0x2F, 0x03, 0xD4, 0x62, 0xA1, 0x8E, 0x5B, 0xDB, 0xC4, 0xB2,
+    0x95, 0x6E, 0xFA, 0x55, 0x00, 0x2A, 0xD2, 0x5F, 0x81, 0xBB, 0x2A, 0x47, 0x7D, 0x30, 0x22, 0xB1,
+    0xE8, 0x25, 0x65, 0x6B, 0x81, 0x13, 0x11, 0xB9, 0x20, 0x22, 0xF2, 0x1B, 0x11, 0x91, 0x69, 0x1D,
+    0xD5, 0xC3, 0x8A, 0xFC, 0x23, 0x29, 0x3C, 0x04, 0x9A, 0x5B, 0x1E, 0xAA, 0xBB, 0x01, 0x8A, 0x25,
+    0x02, 0xAE, 0xFF, 0x5C, 0x0B, 0x53, 0x04, 0x7A, 0xB7, 0x65, 0xE7, 0xCD, 0xAF, 0x12, 0xE8, 0x60,
+    0x46, 0x9A, 0x49, 0xC9, 0xEF, 0xFA, 0x09, 0x23, 0x32, 0x51, 0x88, 0x8C, 0x59, 0x30, 0x3F, 0x06,
+    0xD4, 0x3F, 0x47, 0xA0, 0xBD, 0x3A, 0x01, 0x8B, 0x1E, 0xB7, 0xA2, 0x77, 0xEB, 0x8D, 0x85, 0x85,
+    0x05, 0xAA, 0xA9, 0x88, 0xD0, 0x7A, 0x35, 0xC1, 0x42, 0x1D, 0x56, 0x0E, 0xD9, 0xFA, 0x6C, 0xAA,
+    0xA2, 0xA7, 0x0A, 0x14, 0x91, 0xD6, 0xA3, 0x66, 0x12, 0xD4, 0xA1, 0x0A, 0xA0, 0xBD, 0xE9, 0xC0,
+    0x74, 0x09, 0x70, 0x55, 0x20, 0xEB, 0xBA, 0xEB, 0x26, 0xA8, 0x4E, 0x02, 0xA0, 0x6F, 0x75, 0x3B,
+    0x03, 0xB0, 0x0B, 0xAC, 0x2A, 0xE4, 0x6A, 0xF6, 0x58, 0x95, 0xAD, 0x90, 0x40, 0x4F, 0xD0, 0x5C,
+    0x9D, 0xB3, 0xCE, 0xD6, 0xD7, 0x81, 0x42, 0x3C, 0x6A, 0x6E, 0x3C, 0xB5, 0x58, 0xF4, 0x60, 0x2C,
+    0xE6, 0x10, 0x1C, 0x0B, 0x45, 0x8C, 0x94, 0x73, 0x19, 0xA9, 0xDF, 0x0E, 0x59, 0x67, 0x30, 0xDF,
+    0x1D, 0x31, 0xE8, 0x81, 0xD8, 0xAC, 0xF6, 0xD9, 0xD1, 0x50, 0x8F, 0xF4, 0xB4, 0x36, 0x61, 0x6C,
+    0x11, 0x89, 0x45, 0x2C, 0x22, 0x6A, 0xAA, 0x82, 0x0A, 0x75, 0x40, 0x8F, 0x6D, 0xA7, 0x07, 0xD3,
+    0xD1, 0xFA, 0x44, 0xDB, 0x25, 0x30, 0x2A, 0xE4, 0x39, 0xA4, 0xA6, 0x23, 0xB6, 0x9E, 0x72, 0x7E,
+    0x83, 0x72, 0x5E, 0xA0, 0xFA, 0x20, 0x50, 0x7D, 0x30, 0x81, 0xBE, 0xEE, 0xD1, 0xD7, 0x3D, 0x98,
+    0xE3, 0xFC, 0xA3, 0x9F, 0xB2, 0x6E, 0x5C, 0x88, 0x5F, 0x91, 0x7B, 0x01, 0x25, 0xE4, 0xF9, 0xD4,
+    0x5B, 0x2D, 0xBE, 0x19, 0xF2, 0x46, 0x68, 0x5E, 0x4A, 0xA0, 0x26, 0x1D, 0x56, 0x7B, 0x7A, 0xE3,
+    0xCB, 0x88, 0x9A, 0xD0, 0x81, 0x1E, 0x8C, 0x6D, 0x3C, 0x65, 0x54, 0x13, 0xE8, 0xB1, 0x07, 0xDC,
+    0xB3, 0x1E, 0x4A, 0x99, 0xB7, 0x36, 0x30, 0x9C, 0x07, 0xAA, 0x04, 0x20, 0x01, 0x68, 0xA5, 0x5B,
+    0xED, 0x61, 0x2C, 0x59, 0x3F, 0x35, 0x16, 0x35, 0x95, 0x11, 0x8E, 0xD1, 0x23, 0x8D, 0xC7, 0x59,
+    0x35, 0x53, 0x46, 0x7A, 0xD0, 0x63, 0x33, 0x40, 0xAF, 0x66, 0x50, 0xB1, 0x07, 0x9A, 0xF1, 0x18,
+    0x68, 0x5E, 0x99, 0xB6, 0xC4, 0xAF, 0x27, 0x81, 0x1E, 0xEA, 0x40, 0x19, 0x31, 0x16, 0x63, 0xCB,
+    0x48, 0x1D, 0xD0, 0x63, 0x91, 0xA0, 0xC7, 0x74, 0xA8, 0x39, 0xEB, 0x68, 0x0B, 0xB0, 0x34, 0x1E,
+    0xAA, 0x0F, 0x66, 0xC0, 0x08, 0x5B, 0x3D, 0x3D, 0x4B, 0xAD, 0xC6, 0x6E, 0x6D, 0x7E, 0x9F, 0x39,
+    0x6B, 0x44, 0x64, 0x3A, 0x65, 0x9E, 0x5E, 0xCD, 0x67, 0xC3, 0xAA, 0xC7, 0xD4, 0x01, 0x70, 0xF6,
+    0x94, 0x05, 0xB2, 0x48, 0x5B, 0xBD, 0xB3, 0x3F, 0x6D, 0x43, 0x3A, 0x45, 0x76, 0x76, 0xCD, 0xBA,
+    0xD3, 0xCD, 0x96, 0x5D, 0x33, 0x11, 0x59, 0x44, 0x44, 0xEE, 0x8A, 0x88, 0x78, 0x11, 0x27, 0x6F,
+    0xC9, 0x49, 0x20, 0x62, 0xD0, 0x5E, 0xFD, 0x29, 0x19, 0x39, 0x91, 0x24, 0x62, 0x0F, 0xB3, 0x19,
+    0xCC, 0x58, 0x8A, 0x08, 0xDA, 0xC3, 0x71, 0x26, 0x15, 0xC6, 0x52, 0xCE, 0xB9, 0x24, 0xAD, 0x25,
+    0x99, 0x62, 0x36, 0xB9, 0xA4, 0x1E, 0xC1, 0x64, 0xA8, 0x34, 0x1E, 0x62, 0x2E, 0x71, 0xB9, 0xA4,
+    0xED, 0x20, 0x82, 0x1E, 0x8C, 0xBC, 0x29, 0xC9, 0xC8, 0x40, 0x42, 0xFF, 0x99, 0x97, 0xDD, 0xA7,
+    0xD8, 0xE9, 0x9A, 0x6A, 0x01, 0x2A, 0x01, 0xEA, 0xEB, 0x1D, 0xE8, 0xEF, 0x7A, 0x68, 0xD5, 0x08,
+    0xFB, 0x65, 0x80, 0x2B, 0xCC, 0x30, 0x73, 0x85, 0x32, 0xB0, 0x8F, 0x0A, 0xB4, 0x54, 0x03, 0xBA,
+    0xD3, 0x9E, 0xDA, 0x37, 0x16, 0x35, 0x1A, 0x28, 0xA7, 0x43, 0x20, 0x3E, 0x75, 0x74, 0x74, 0xF4,
+    0xF7, 0x5B, 0xA3, 0xEB, 0xF8, 0xA2, 0xD5, 0x81, 0x05, 0x3D, 0x10, 0xD1, 0x9E, 0x03, 0xD8, 0x64,
+    0x31, 0xD7, 0x88, 0x8C, 0xF5, 0xBB, 0xE7, 0x22, 0x1D, 0xA6, 0xCB, 0x4B, 0x96, 0x6D, 0x9C, 0x40,
+    0xE3, 0x1F, 0xEF, 0x25, 0x34, 0x22, 0xB1, 0xBD, 0x73, 0xDE, 0xB5, 0x23, 0xCD, 0xF5, 0x91, 0xEA,
+    0x83, 0x29, 0x93, 0xC4, 0xDE, 0x58, 0xCC, 0xF5, 0x80, 0x7B, 0x5F, 0x36, 0x4B, 0x34, 0xB2, 0xB4,
+    0xA5, 0xA4, 0xDA, 0x17, 0x07, 0xF0, 0xB7, 0xA7, 0x4D, 0xAE, 0x1F, 0x9B, 0xD9, 0xA0, 0x7F, 0x29,
+    0x0B, 0xA9, 0x97, 0xA8, 0xE5, 0x86, 0x0B, 0x32, 0xE0, 0x5E, 0x9D, 0xB6, 0xB6, 0xD3, 0x00, 0xCB,
+    0x02, 0xB5, 0x8C, 0xE0, 0x12, 0x54, 0x32, 0x80, 0x5B, 0xA0, 0x92, 0x11, 0x7A, 0x01, 0x7D, 0x2B,
+    0x40, 0x92, 0x8E, 0xF6, 0x7A, 0xA2, 0x9E, 0x97, 0xE5, 0x79, 0xD1, 0xD7, 0x44, 0xFC, 0xDC, 0xC8,
+    0x08, 0x7B, 0x16, 0x8A, 0x0D, 0x85, 0xC8, 0xD0, 0x8A, 0x7C, 0x4B, 0x7E, 0x7C, 0xA5, 0x19, 0x41,
+    0x32, 0xB2, 0xB6, 0x1E, 0x96, 0xD5, 0xE6, 0x34, 0xE4, 0x2D, 0xB0, 0x3E, 0xD6, 0x21, 0xE3, 0xBD,
+    0xF1, 0xE0, 0x3C, 0xB6, 0x7F, 0xEF, 0x75, 0xDB, 0x4B, 0xE2, 0x82, 0x8C, 0x14, 0x07, 0x00, 0xE5,
+    0xA5, 0x4F, 0x93, 0x84, 0xF6, 0x0E, 0xAA, 0x50, 0xCB, 0xE4, 0x94, 0xC8, 0xCD, 0x20, 0x37, 0x2E,
+    0x48, 0x3B, 0xE2, 0x3E, 0x98, 0x29, 0xC5, 0x81, 0xBE, 0x1B, 0x40, 0x3E, 0x61, 0x66, 0xFD, 0x2A,
+    0x9A, 0x89, 0xE9, 0x68, 0xDE, 0x5F, 0xA8, 0x44, 0x2F, 0xCF, 0xDF, 0x0D, 0x46, 0x92, 0xC1, 0xC9,
+    0xB7, 0x03, 0x67, 0x57, 0x41, 0xAF, 0x92, 0x44, 0x29, 0x32, 0xD1, 0xFF, 0xD2, 0x0D, 0xCD, 0x40,
+    0xAF, 0x66, 0xD4, 0xEC, 0xA0, 0xBD, 0x16, 0x28, 0xE2, 0x31, 0x34, 0xD7, 0x45, 0x24, 0x8A, 0x88,
+    0x5C, 0xBF, 0x73, 0x74, 0x74, 0x79, 0xD9, 0xDA, 0x36, 0xEE, 0xDB, 0xB3, 0x85, 0xC0, 0x99, 0x4A,
+    0xFE, 0xB1, 0xB7, 0x8D, 0xC8, 0x44, 0x2B, 0xB7, 0x57, 0xAF, 0xC0, 0x8B, 0x97, 0x68, 0x65, 0x28,
+    0x45, 0xD0, 0xE1, 0x0C, 0x7D, 0xDE, 0x2B, 0x5B, 0x70, 0x25, 0xB8, 0x20, 0xA9, 0x12, 0x99, 0xF6,
+    0xDC, 0x8F, 0x2D, 0x29, 0xEF, 0x92, 0x53, 0x6F, 0x3F, 0xD3, 0x23, 0x7B, 0x07, 0x50, 0xCB, 0x64,
+    0x94, 0xC8, 0xDB, 0x41, 0x6E, 0xB8, 0xBE, 0x79, 0x10, 0x64, 0xFD, 0xC7, 0x83, 0xCC, 0xDD, 0x07,
+    0xB2, 0x3F, 0x2C, 0x54, 0xA2, 0xD3, 0xF7, 0x24, 0x18, 0x59, 0x1C, 0x4E, 0xBE, 0x13, 0x38, 0x7B,
+    0x6F, 0x79, 0x8E, 0x57, 0x04, 0x2C, 0xE3, 0xBF, 0xB1, 0xF4, 0x2F, 0xC9, 0x5D, 0x09, 0x8D, 0xC8,
+    0xCC, 0x39, 0x99, 0x3F, 0x0B, 0xDE, 0x8A, 0x4D, 0xBD, 0x24, 0x7D, 0xEB, 0xDD, 0x0B, 0x19, 0x6F,
+    0xE7, 0x8C, 0xB7, 0xCD, 0xF5, 0x00, 0x71, 0x01, 0x7D, 0x7D, 0x84, 0x98, 0x40, 0x5F, 0x1F, 0x3E,
+    0x43, 0xC6, 0x3F, 0xA1, 0xDF, 0x8E, 0xCB, 0xD7, 0x00, 0xCC, 0xB3, 0x6F, 0x4E, 0xE9, 0xA3, 0x2E,
+    0x94, 0x1D, 0x0B, 0x3A, 0xB0, 0x50, 0xDA, 0xAD, 0xC8, 0xFD, 0xE7, 0xD1, 0xA2, 0x32, 0x1A, 0xF9,
+    0xA1, 0x84, 0x36, 0x83, 0xC0, 0xD8, 0x3C, 0x57, 0x35, 0xAD, 0x13, 0xFF, 0xA8, 0x02, 0xF7, 0xEA,
+    0x80, 0xFB, 0xE1, 0x84, 0xE9, 0x12, 0xA6, 0x33, 0xD6, 0x74, 0x7A, 0x30, 0x5E, 0x4D, 0xC6, 0x93,
+    0x8C, 0xC7, 0x5C, 0xF0, 0xE8, 0x5B, 0x33, 0x4A, 0xA4, 0x43, 0x7E, 0x34, 0x61, 0x3A, 0x41, 0x0F,
+    0x3A, 0xA8, 0xA9, 0x58, 0x48, 0xB4, 0x83, 0xB1, 0x2A, 0xEA, 0x01, 0x73, 0x75, 0xA2, 0x9A, 0x13,
+    0xF4, 0xF6, 0x6F, 0xD3, 0x27, 0x24, 0xD8, 0xC0, 0x06, 0xFD, 0x73, 0x59, 0xE8, 0xC5, 0xC6, 0x5E,
+    0x66, 0x23, 0x8B, 0xBE, 0xF5, 0xE3, 0xFE, 0xAD, 0xBC, 0x06, 0x12, 0x70, 0xAF, 0x4E, 0x54, 0xAB,
+    0xF7, 0xC5, 0x74, 0x34, 0xD7, 0x03, 0x6A, 0xA2, 0x88, 0x0B, 0x18, 0x8B, 0xBE, 0x3E, 0xA2, 0x42,
+    0x06, 0xB4, 0xC9, 0x40, 0xFF, 0xBC, 0x1E, 0xFD, 0x3A, 0x34, 0xB1, 0xB1, 0x97, 0xA4, 0x6F, 0xDD,
+    0xF8, 0x9C, 0xB1, 0x82, 0x62, 0x03, 0x85, 0x48, 0x47, 0x2B, 0x32, 0x94, 0xF2, 0xE3, 0x7E, 0x68,
+    0x46, 0x8C, 0x97, 0xD5, 0xB8, 0xD7, 0xB7, 0x3E, 0xDB, 0x5C, 0xD5, 0xC9, 0x0C, 0xFA, 0xD6, 0x00,
+    0xA6, 0xB7, 0x99, 0x82, 0xAA, 0x3B, 0x73, 0xD6, 0xF1, 0x30, 0x7A, 0xA0, 0x8C, 0xAD, 0x47, 0x8F,
+    0xA6, 0x43, 0x70, 0xEF, 0x5E, 0x08, 0x38, 0x11, 0x4B, 0x2B, 0x23, 0x2B, 0x79, 0x5B, 0x41, 0x1C,
+    0x7B, 0x89, 0xFA, 0xD6, 0x96, 0x2A, 0xCF, 0x1F, 0x4F, 0x95, 0xC7, 0xBC, 0x11, 0xEB, 0xD3, 0x54,
+    0xB9, 0x48, 0xD2, 0x61, 0xAE, 0x2F, 0xD4, 0xB3, 0x2C, 0xCF, 0x8B, 0xFE, 0x8D, 0x88, 0x4F, 0x8D,
+    0x8C, 0x7A, 0xD8, 0xB3, 0x9F, 0xBC, 0xB7, 0xB6, 0x96, 0xF0, 0x87, 0xE8, 0xC1, 0xE7, 0x44, 0x42,
+    0x1F, 0xA6, 0x07, 0x9F, 0x9C, 0xD9, 0xC4, 0x5A, 0xA2, 0x59, 0xA2, 0xFC, 0x54, 0x26, 0xC4, 0x23,
+    0x16, 0x81, 0x05, 0x16, 0x48, 0x9F, 0xF6, 0xC7, 0xDE, 0x79, 0x0A, 0x91, 0x77, 0x6A, 0x91, 0xB9,
+    0x7D, 0xF7, 0x5F, 0x04, 0x63, 0x79, 0xD2, 0xAC, 0xBC, 0xD5, 0xF8, 0xEC, 0xB5, 0xA9, 0x64, 0xD8,
+    0xD2, 0xB6, 0xD5, 0xE9, 0x53, 0xAD, 0x0E, 0x91, 0xEC, 0x1C, 0xF9, 0x06, 0x65, 0x34, 0x3F, 0x7E,
+    0x61, 0x32, 0x22, 0xE3, 0x39, 0x59, 0xE0, 0xAC, 0x85, 0xBF, 0x84, 0x16, 0xB4, 0x47, 0x05, 0xCA,
+    0x48, 0x2D, 0x72, 0x53, 0x64, 0x7E, 0xE1, 0xC3, 0x4D, 0x19, 0xA1, 0x87, 0xD6, 0x93, 0x05, 0xCA,
+    0x8F, 0x79, 0x28, 0x22, 0x38, 0x8B, 0xBE, 0x7D, 0xBE, 0x90, 0x85, 0x46, 0xBA, 0xD5, 0xAD, 0xA2,
+    0x26, 0x70, 0xC6, 0x66, 0xD1, 0xFB, 0x33, 0x67, 0xEA, 0x0F, 0x26, 0x10, 0xE3, 0x69, 0xDE, 0x4F,
+    0x54, 0xA2, 0xD3, 0xF3, 0x77, 0x83, 0x93, 0xC5, 0xD0, 0x6F, 0xB9, 0xD6, 0x6A, 0x4A, 0x2D, 0xA3,
+    0x03, 0x35, 0x19, 0x9B, 0x3D, 0x07, 0x7A, 0x6C, 0x7C, 0xF6, 0x27, 0x34, 0xBE, 0x0E, 0xDB, 0x58,
+    0x11, 0x35, 0x67, 0x43, 0x5D, 0xDA, 0x7A, 0x9A, 0xCB, 0x19, 0x8C, 0x9A, 0xC0, 0x7C, 0x27, 0x40,
+    0xF3, 0xA3, 0x31, 0x6B, 0x07, 0xD4, 0xB7, 0xBA, 0xD5, 0x69, 0xA5, 0x04, 0x28, 0x97, 0x9D, 0x19,
+    0xA2, 0x0A, 0xA8, 0x98, 0x5D, 0x1F, 0xBD, 0xA7, 0xFD, 0xE1, 0x8C, 0x4E, 0xA8, 0xA9, 0xF5, 0xC8,
+    0x88, 0x2B, 0x22, 0x8D, 0xA3, 0x0E, 0x7A, 0x50, 0xEF, 0x4F, 0x24, 0x16, 0x4C, 0xD3, 0x69, 0x5F,
+    0x87, 0x6A, 0x8C, 0x45, 0xC4, 0xF0, 0x86, 0xF6, 0x6D, 0xA7, 0x26, 0xED, 0x8F, 0xD5, 0x44, 0xFB,
+    0xD2, 0x5C, 0x05, 0x43, 0x11, 0x5B, 0x6B, 0xAA, 0x80, 0xBE, 0x1A, 0xCA, 0xE9, 0x18, 0xD2, 0x3E,
+    0xCD, 0xAB, 0x03, 0xF5, 0xCD, 0x81, 0x18, 0xC1, 0x5D, 0x41, 0xBF, 0xD5, 0xA1, 0xC4, 0xE3, 0x26,
+    0x30, 0x13, 0x4A, 0x32, 0x87, 0x35, 0x01, 0x74, 0xB8, 0x37, 0xBA, 0xD6, 0x53, 0x4D, 0x3A, 0xA0,
+    0x47, 0x35, 0xD3, 0xFA, 0x22, 0xE2, 0x2C, 0x3D, 0x0B, 0x98, 0x97, 0x23, 0x34, 0xBF, 0x0E, 0x2B,
+    0x4A, 0x28, 0xE9, 0x56, 0x03, 0x45, 0x29, 0x16, 0x2A, 0xF1, 0xA0, 0x7F, 0x1F, 0xA0, 0xBD, 0x3A,
+    0x83, 0x2B, 0x12, 0x24, 0x7A, 0x54, 0xC4, 0x74, 0x75, 0xA0, 0x19, 0x9A, 0x81, 0x3A, 0x98, 0x6E,
+    0xB5, 0x5F, 0xD3, 0x6F, 0xE1, 0x3D, 0x9B, 0x2E, 0xC3, 0xBB, 0x0E, 0x7A, 0x40, 0x0F, 0xF5, 0x98,
+    0x5D, 0x39, 0x19, 0xDE, 0x36, 0x2B, 0x2C, 0x91, 0x05, 0x8E, 0x89, 0xE0, 0xCA, 0x19, 0xCC, 0xB7,
+    0x27, 0x68, 0x5F, 0x09, 0xA0, 0xAF, 0x8D, 0xDB, 0x88, 0x80, 0x5B, 0x1E, 0x54, 0x76, 0x12, 0xEE,
+    0x6C, 0xE3, 0x69, 0x27, 0xC0, 0xCE, 0xDB, 0xDD, 0xA3, 0xC7, 0x55, 0xE8, 0xFF, 0x9F, 0x62, 0xA1,
+    0x4F, 0x6B, 0xE0, 0x56, 0x36, 0xAE, 0x88, 0x44, 0x23, 0x12, 0xCF, 0x6E, 0xBE, 0x17, 0x73, 0x75,
+    0x3D, 0x64, 0x0F, 0x4C, 0x9F, 0x75, 0x8B, 0x9D, 0x28, 0xE6, 0x77, 0xD2, 0x59, 0x11, 0x57, 0xB1,
+    0x61, 0xCC, 0x9F, 0x75, 0x47, 0x47, 0x97, 0x7B, 0x91, 0xD8, 0x8B, 0x44, 0xF8, 0x77, 0x20, 0x1E,
+    0x09, 0x48, 0x87, 0xB1, 0x34, 0x7E, 0x55, 0x9F, 0x71, 0xDC, 0xFF, 0x60, 0x3A, 0x5A, 0xAF, 0x64,
+    0x40, 0x2C, 0x26, 0x82, 0xF3, 0xA8, 0xF9, 0xE1, 0x6A, 0xF7, 0x1E, 0x8C, 0x45, 0x4F, 0x14, 0x12,
+    0x68, 0x22, 0x5C, 0xE0, 0xDF, 0xEE, 0xFF, 0x31, 0x89, 0x9F, 0x82, 0x99, 0xA8, 0xC5, 0xD2, 0xE4,
+    0xE8, 0x9B, 0xB6, 0xA3, 0x1E, 0x29, 0x67, 0x38, 0x7E, 0xE0, 0xA1, 0xF1, 0xA8, 0x04, 0x26, 0x52,
+    0x08, 0xA5, 0x78, 0x95, 0xC8, 0xB1, 0x15, 0x1F, 0xD7, 0x26, 0x81, 0x50, 0x4B, 0xA7, 0xC4, 0xF2,
+    0x3F, 0x80, 0xE2, 0xA7, 0x80, 0x93, 0x81, 0xB7, 0x45, 0xEE, 0x5C, 0x78, 0xD5, 0x3A, 0x49, 0xDF,
+    0xA0, 0x5E, 0xA3, 0xCC, 0xD8, 0xE3, 0x31, 0xD4, 0x58, 0x0F, 0x6A, 0xAA, 0x83, 0x9A, 0xAB, 0x50,
+    0x46, 0x35, 0x95, 0x51, 0xCD, 0x45, 0x54, 0x33, 0xA9, 0x8C, 0x38, 0xBB, 0x50, 0x07, 0x3D, 0xD2,
+    0x17, 0x29, 0xEF, 0xC6, 0xA5, 0x8C, 0xE8, 0xA1, 0xF5, 0x45, 0x54, 0x13, 0x7F, 0xC1, 0x37, 0x1E,
+    0xE3, 0x31, 0x74, 0xD7, 0x66, 0x55, 0xD4, 0xD8, 0x1E, 0x35, 0xE9, 0x11, 0xC7, 0x92, 0x91, 0x49,
+    0x8A, 0x44, 0xEB, 0x8D, 0x6D, 0xBC, 0xE9, 0x9A, 0xC1, 0x78, 0x3D, 0xB4, 0x5E, 0x8F, 0x8D, 0xAF,
+    0x43, 0x33, 0x54, 0x41, 0x0F, 0x7C, 0x83, 0xBF, 0x81, 0xF2, 0x32, 0xAC, 0x2A, 0x60, 0xD6, 0x26,
+    0xB7, 0xDE, 0x95, 0xEC, 0xC5, 0x2C, 0x27, 0xC8, 0x5E, 0xCF, 0xFB, 0xD3, 0x97, 0xDD, 0xC7, 0x09,
+    0x7C, 0xFD, 0xD2, 0xCE, 0xF9, 0x97, 0xFD, 0x7E, 0xD9, 0x52, 0xA5, 0x02, 0x64, 0xE1, 0xE0, 0xBE,
+    0x58, 0xBF, 0xAF, 0xCC, 0xBC, 0x9E, 0x78, 0x0D, 0xA0, 0xCD, 0x1E, 0xF2, 0x08, 0x14, 0xA9, 0x07,
+    0x54, 0x68, 0x3C, 0x68, 0x5F, 0x05, 0xD8, 0xCB, 0x31, 0xA2, 0x5F, 0xAD, 0x79, 0xD9, 0x82, 0x6D,
+    0x8F, 0x55, 0xD0, 0xBB, 0xDE, 0x73, 0xF9, 0x47, 0xA4, 0xAF, 0x00, 0x06, 0x7E, 0xF9, 0xDC, 0xDB,
+    0xD5, 0xFF, 0x01, 0x8A, 0x71, 0xD7, 0xF6, 0x5C, 0x00, 0xD8, 0x07, 0xD0, 0xDD, 0x0A, 0xD4, 0x52,
+    0x02, 0xD0, 0x0F, 0x2B, 0x05, 0x93, 0xB5, 0x0B, 0x3D, 0xAC, 0x7B, 0x27, 0xAE, 0x51, 0x32, 0x6B,
+    0xD8, 0xEF, 0x23, 0x74, 0x48, 0x67, 0xE4, 0x6F, 0x87, 0x6C, 0xBF, 0x5A, 0xB2, 0xEE, 0x5B, 0x8D,
+    0xA7, 0xC3, 0x5A, 0x1E, 0xED, 0x78, 0x1E, 0x7F, 0x2D, 0x9B, 0xF9, 0xCC, 0x02, 0x8B, 0xE9, 0xCA,
+    0x59, 0x0F, 0xF5, 0x50, 0x4E, 0x7B, 0xA7, 0x08, 0xE6, 0x23, 0x1D, 0xCF, 0x41, 0x61, 0xCB, 0xA9,
+    0x1E, 0xD4, 0x5C, 0x8F, 0xE5, 0x54, 0x0D, 0x0F, 0xEE, 0x9D, 0x47, 0x39, 0x96, 0x17, 0xB7, 0x32,
+    0x79, 0x82, 0x08, 0x71, 0x4B, 0x92, 0x0A, 0x91, 0x6B, 0x22, 0x8F, 0xCB, 0x3B, 0x7F, 0xA2, 0xAB,
+    0xBA, 0x88, 0x9C, 0xBB, 0x5D, 0x89, 0xB4, 0x12, 0x29, 0x2F, 0xD3, 0x0E, 0x45, 0x42, 0x8F, 0x1C,
+    0x53, 0x0D, 0x3C, 0xC6, 0xE7, 0xDE, 0xC5, 0x8B, 0x60, 0x02, 0x66, 0xC1, 0xBC, 0x3A, 0xB4, 0x5D,
+    0x6A, 0x6D, 0x7D, 0x63, 0xB7, 0xB8, 0x95, 0x48, 0x29, 0xE2, 0xCF, 0xC9, 0xA5, 0x4F, 0x10, 0x54,
+    0xFE, 0xF8, 0x87, 0x0B, 0xEF, 0x14, 0x22, 0xBE, 0x97, 0x70, 0x86, 0xBF, 0x9E, 0xEA, 0xB7, 0x46,
+    0xF3, 0xBA, 0x7D, 0xE3, 0x49, 0xEC, 0xBD, 0xC5, 0xFB, 0xFC, 0xBC, 0xFC, 0xC5, 0x25, 0xFE, 0x06,
+    0x64, 0xD4, 0x60, 0xE4, 0xE6, 0x88, 0xFA, 0xA5, 0x44, 0xF8, 0xBB, 0x42, 0x2C, 0x0F, 0x52, 0xDB,
+    0x2F, 0xA9, 0x0B, 0xF8, 0x28, 0xCB, 0xEB, 0xC3, 0xBD, 0x88, 0x8F, 0x4C, 0x4B, 0x57, 0xF3, 0x79,
+    0x8E, 0xDB, 0xA6, 0xB0, 0x0F, 0x72, 0x8D, 0xAF, 0x96, 0xD3, 0x98, 0x2D, 0xBB, 0xAF, 0x66, 0xB6,
+    0x62, 0xFC, 0x3A, 0xDD, 0xCC, 0x25, 0x98, 0x77, 0x41, 0x8B, 0x5F, 0xED, 0x79, 0x96, 0x3F, 0x81,
+    0x55, 0x57, 0x5C, 0x19, 0x50, 0x19, 0x7B, 0xA0, 0x88, 0xF5, 0x08, 0xC5, 0xCC, 0x21, 0xF0, 0xE4,
+    0xC3, 0x0B, 0xFA, 0x55, 0x9B, 0x67, 0xDE, 0xD0, 0x87, 0x45, 0xF6, 0x88, 0xF5, 0x40, 0x35, 0x36,
+    0xDD, 0xEE, 0xC5, 0xC3, 0xA9, 0xE8, 0xE5, 0x12, 0x39, 0x72, 0x60, 0x0D, 0x89, 0xAA, 0x17, 0x0A,
+    0xF1, 0x55, 0x84, 0x7A, 0x56, 0x11, 0x90, 0xEC, 0xF7, 0x19, 0x05, 0x28, 0x63, 0x8E, 0x36, 0x7F,
+    0x61, 0x60, 0xD5, 0x48, 0x51, 0x0F, 0x4F, 0xE7, 0x23, 0xE6, 0x69, 0xDE, 0xF2, 0x80, 0x7E, 0x7B,
+    0x02, 0xD4, 0x94, 0x3F, 0xD5, 0x0E, 0xC0, 0xA2, 0x22, 0xD0, 0x5B, 0xE7, 0xA1, 0xEF, 0xEA, 0x44,
+    0x21, 0x9E, 0x7E, 0xF9, 0x99, 0x78, 0xAA, 0xEC, 0x96, 0x6A, 0x72, 0xD8, 0xFC, 0xDE, 0xC1, 0x16,
+    0x5D, 0xCB, 0xB4, 0x93, 0x53, 0x32, 0xCA, 0xB6, 0x76, 0x77, 0x60, 0xE8, 0x3E, 0x54, 0x6D, 0xBA,
+    0x2F, 0xD2, 0x45, 0x9C, 0x0B, 0x1D, 0xD0, 0xBE, 0xE5, 0x41, 0xBF, 0x3D, 0x43, 0x35, 0xF5, 0x16,
+    0x15, 0xF5, 0x4C, 0x95, 0x90, 0x3B, 0xAF, 0xA7, 0x1C, 0xD9, 0x8E, 0x93, 0x99, 0x6C, 0xC6, 0x61,
+    0x25, 0x2E, 0xAE, 0xDB, 0xCA, 0x56, 0xAD, 0xDF, 0xFA, 0xB6, 0xB5, 0x7F, 0x88, 0xA8, 0x7C, 0x39,
+    0xA7, 0xF0, 0x94, 0xDD, 0x06, 0x4B, 0xB4, 0x02, 0x34, 0xD7, 0x02, 0x34, 0xFE, 0x18, 0x9A, 0xAE,
+    0x1A, 0x29, 0xEE, 0x5F, 0x86, 0x2F, 0xE5, 0x14, 0x0A, 0x1E, 0x83, 0x2A, 0x34, 0x9E, 0x22, 0xE6,
+    0x90, 0x82, 0x79, 0x2D, 0x7C, 0x20, 0x7D, 0x09, 0x63, 0x0D, 0x78, 0xAA, 0x5B, 0x25, 0x72, 0xD9,
+    0x4A, 0xF6, 0x71, 0x8B, 0x3D, 0x5B, 0xC5, 0xEC, 0x8B, 0xF4, 0xF4, 0x65, 0xAD, 0xBE, 0x4C, 0xAB,
+    0x94, 0xBF, 0xAC, 0x50, 0xDA, 0x3F, 0xAD, 0xF1, 0x7E, 0xA1, 0xFD, 0x67, 0xC5, 0xC1, 0x83, 0x44,
+    0xE8, 0x4D, 0xC7, 0x71, 0x39, 0x73, 0x48, 0xDB, 0x3D, 0xC6, 0x96, 0xCC, 0x7D, 0xA1, 0xFD, 0x9F,
+    0xE1, 0x80, 0xA6, 0x3B, 0xA4, 0x0E, 0xAD, 0x2F, 0xE6, 0x6A, 0xE4, 0xB1, 0xD3, 0x16, 0x8C, 0xE2,
+    0x3C, 0xB8, 0xAC, 0x90, 0x75, 0xED, 0x3F, 0x5C, 0x08, 0x65, 0x06, 0x51, 0xEB, 0xD9, 0x9E, 0xE3,
+    0x03, 0xC7, 0xD7, 0x73, 0x28, 0x4F, 0xE8, 0xDF, 0xFB, 0x4F, 0xB1, 0xEF, 0x70, 0xA6, 0xA3, 0xB9,
+    0x3E, 0x50, 0x9D, 0x04, 0xCA, 0x98, 0x40, 0x8C, 0x2F, 0xE4, 0x5A, 0xFA, 0xDE, 0xDD, 0x20, 0x32,
+    0x5F, 0xA9, 0x65, 0x6A, 0xD9, 0xB3, 0x7C, 0xEE, 0xEE, 0xCD, 0x7A, 0x80, 0xA7, 0xB3, 0x81, 0xA6,
+    0x90, 0x7C, 0x16, 0xAD, 0xC8, 0xBE, 0x70, 0x93, 0x40, 0x2E, 0x65, 0x6A, 0x55, 0x4F, 0x5B, 0x3A,
+    0xB5, 0x6C, 0x65, 0xA0, 0xDA, 0x9F, 0xA2, 0xB6, 0x8F, 0xC2, 0x33, 0xF9, 0xC4, 0x6B, 0xAB, 0x1D,
+    0xE9, 0xBE, 0x85, 0xDC, 0x3F, 0x4D, 0x31, 0x1F, 0xC1, 0x30, 0xCA, 0x9F, 0xAC, 0xA8, 0xD7, 0x0A,
+    0xD4, 0xEF, 0xC7, 0x2C, 0x41, 0x1C, 0xD2, 0x74, 0xF7, 0xA8, 0xDE, 0x23, 0x18, 0xC6, 0x93, 0x58,
+    0x9A, 0xEE, 0x90, 0x32, 0x56, 0x81, 0xA6, 0x3B, 0x7C, 0x90, 0xC1, 0x9F, 0xB5, 0xD9, 0x36, 0xD8,
+    0x8A, 0xD8, 0x3A, 0xFD, 0xCB, 0x54, 0xA4, 0x6C, 0x1F, 0x36, 0xAF, 0x84, 0x2C, 0xF9, 0x34, 0xD7,
+    0x46, 0x8A, 0xDC, 0xBB, 0x88, 0x44, 0x39, 0x3A, 0x3A, 0xCA, 0x61, 0xCB, 0x0F, 0x45, 0x7E, 0x34,
+    0x81, 0xC2, 0xBA, 0xDB, 0xDF, 0x9F, 0x0A, 0x11, 0xB1, 0xA5, 0xC8, 0x25, 0xD8, 0xC0, 0x53, 0x5D,
+    0x35, 0xE7, 0x78, 0xDC, 0x63, 0xEA, 0x61, 0xC5, 0x7F, 0x63, 0xF5, 0xA0, 0xA6, 0x7C, 0x4A, 0xF3,
+    0x53, 0x33, 0x1C, 0xE1, 0x3A, 0xE3, 0x5B, 0xAF, 0xBD, 0xF6, 0xEB, 0x1A, 0x7E, 0x86, 0xE6, 0xC6,
+    0xC2, 0x53, 0x1D, 0x75, 0xA2, 0x94, 0x80, 0x6B, 0x7D, 0xE3, 0x7B, 0x35, 0x16, 0xF1, 0xCC, 0x3D,
+    0x7C, 0x50, 0x53, 0x3E, 0xE7, 0xF8, 0xE7, 0xDD, 0x1E, 0xE3, 0x49, 0x43, 0x74, 0x45, 0x34, 0xC4,
+    0xFB, 0x36, 0x7A, 0xFA, 0x33, 0xFE, 0xFE, 0x33, 0xFF, 0x8A, 0x76, 0x56, 0x43, 0x25, 0xB7, 0xAF,
+    0x30, 0xB7, 0x62, 0x35, 0xED, 0x78, 0x6A, 0x09, 0xF7, 0x0E, 0x88, 0x8D, 0x4C, 0xFA, 0x9A, 0xC8,
+    0xB0, 0xA4, 0xE7, 0x44, 0x27, 0xAA, 0x59, 0x3A, 0xDA, 0xEB, 0x81, 0x22, 0xCA, 0xD6, 0xAB, 0xB8,
+    0x7C, 0x56, 0xAF, 0xE2, 0xF5, 0x01, 0x22, 0x2F, 0xDA, 0xAD, 0x35, 0x67, 0x67, 0xC8, 0x27, 0xEE,
+    0x2E, 0x5B, 0x1E, 0xF2, 0xE8, 0xFC, 0x8F, 0xE5, 0xE5, 0x55, 0xDB, 0x5A, 0x45, 0xCD, 0xD5, 0x65,
+    0x5F, 0x0D, 0x70, 0x8F, 0x25, 0x3F, 0xB2, 0xE1, 0x14, 0x97, 0xB7, 0xE1, 0x55, 0x32, 0xAF, 0x32,
+    0xEB, 0xB1, 0x9A, 0xA8, 0x87, 0x72, 0xE2, 0xCC, 0x8E, 0xC3, 0x3C, 0xB2, 0xE1, 0x9C, 0xE1, 0x80,
+    0x72, 0xAA, 0x87, 0x5C, 0xA7, 0xB5, 0x6F, 0x3C, 0x24, 0xCD, 0x6F, 0x2C, 0x38, 0x19, 0xA9, 0x45,
+    0x26, 0xFA, 0x77, 0x2F, 0x4C, 0xD5, 0x8C, 0x0E, 0xC6, 0xA3, 0x7F, 0x1B, 0x33, 0xC5, 0xC1, 0xB8,
+    0x6E, 0x1D, 0xCE, 0xDD, 0x69, 0x37, 0x9C, 0x0E, 0x96, 0x63, 0x50, 0x1F, 0xC6, 0xF5, 0x14, 0x6F,
+    0x5F, 0x07, 0xD4, 0xAC, 0x47, 0x8C, 0x6F, 0x6E, 0x3F, 0x1F, 0x69, 0xB2, 0x69, 0x6F, 0x7B, 0x18,
+    0xF7, 0xA9, 0x6E, 0x65, 0xFB, 0x3A, 0x6C, 0x15, 0xE2, 0xB4, 0x35, 0x79, 0x9F, 0xB2, 0x75, 0x7F,
+    0xE1, 0x1E, 0xC5, 0xF2, 0xF2, 0x6A, 0xE0, 0xD4, 0xE3, 0xAA, 0x02, 0x1C, 0x6E, 0x2D, 0x8C, 0x07,
+    0x8F, 0x6E, 0x18, 0xC5, 0x4F, 0x57, 0x21, 0x58, 0x8B, 0xA7, 0x8C, 0x0B, 0x1C, 0x96, 0x33, 0x4D,
+    0x57, 0x8F, 0xD8, 0x53, 0xE0, 0xF8, 0xA2, 0x87, 0x71, 0x86, 0x27, 0xB3, 0x92, 0xD7, 0x97, 0x31,
+    0x67, 0x1E, 0x7B, 0xD0, 0x9F, 0xF2, 0x27, 0xF7, 0x5E, 0x7D, 0x30, 0x65, 0x49, 0x48, 0x7F, 0x10,
+    0x29, 0xA4, 0x1D, 0x70, 0x41, 0x6E, 0xF4, 0x7D, 0x25, 0xF2, 0x76, 0xA8, 0x65, 0x32, 0xEB, 0xFE,
+    0x5D, 0xD3, 0xE3, 0x22, 0xDB, 0x13, 0x45, 0x22, 0xD2, 0xB5, 0x22, 0x22, 0xB2, 0x94, 0x72, 0x29,
+    0xFF, 0x37, 0x83, 0xEC, 0x90, 0x46, 0x32, 0x87, 0xD9, 0xCA, 0x2C, 0x39, 0x20, 0x72, 0xF5, 0x11,
+    0xE7, 0xE2, 0x3A, 0xE4, 0x57, 0xED, 0xFA, 0xAA, 0xDF, 0x6C, 0xFE, 0x3A, 0xE6, 0xA3, 0x7D, 0xD7,
+    0x42, 0x3E, 0x18, 0xD7, 0x7A, 0x68, 0x6F, 0x6C, 0xCE, 0xF7, 0x5B, 0x6F, 0xE7, 0xDA, 0x3A, 0xE4,
+    0xD6, 0x7A, 0xB8, 0xFF, 0xE3, 0xCE, 0xDE, 0xD7, 0x77, 0x21, 0x6B, 0xE8, 0xB4, 0x58, 0x7A, 0xA0,
+    0x94, 0x3B, 0xAF, 0x8B, 0xAC, 0x07, 0x72, 0x44, 0x3A, 0x7A, 0xC9, 0xA7, 0xB5, 0x57, 0xB5, 0xBA,
+    0x38, 0x9F, 0x63, 0xCB, 0x9C, 0x0C, 0x45, 0x66, 0xEC, 0xB3, 0x16, 0xE9, 0xEA, 0xF4, 0xBD, 0xA5,
+    0x7D, 0xF7, 0xC2, 0xD8, 0x0C, 0xB8, 0x9E, 0x6A, 0x32, 0x1D, 0x4D, 0xCC, 0x76, 0x7A, 0x1D, 0x29,
+    0x62, 0x9F, 0x25, 0xA7, 0xB4, 0xE4, 0x69, 0xA5, 0x25, 0x6B, 0xDA, 0x4B, 0x3A, 0x75, 0xBF, 0x73,
+    0x74, 0xF4, 0xD3, 0x65, 0x95, 0x0C, 0xD7, 0x7A, 0xF4, 0x6B, 0x4C, 0xAB, 0x59, 0xC9, 0x90, 0xE9,
+    0xF2, 0x81, 0xCC, 0x66, 0xC4, 0xF5, 0x1D, 0x67, 0xEA, 0xE5, 0x7B, 0x4B, 0x7B, 0xFB, 0xF9, 0xB9,
+    0x10, 0x99, 0x6B, 0x91, 0x99, 0x56, 0x06, 0x7A, 0x19, 0xE1, 0x3C, 0x14, 0x07, 0xBC, 0x78, 0x74,
+    0x74, 0xD4, 0xAE, 0xB1, 0xDA, 0xD3, 0x66, 0xB3, 0x39, 0xFF, 0xE2, 0xD1, 0x9A, 0x64, 0x4D, 0x77,
+    0xB7, 0x99, 0xFF, 0xBD, 0x59, 0x53, 0x11, 0xB4, 0x3F, 0x2C, 0x27, 0xED, 0x9D, 0x9A, 0xF5, 0xE8,
+    0xEC, 0x79, 0xEA, 0x60, 0xFC, 0xA2, 0x42, 0xE3, 0x8F, 0x55, 0xD0, 0xDD, 0x45, 0x0E, 0x28, 0x42,
+    0xD5, 0x19, 0xE6, 0x6A, 0x6C, 0xEC, 0x1B, 0x6A, 0xD2, 0xDE, 0x14, 0xB1, 0x0E, 0xA6, 0x5B, 0xD4,
+    0xDC, 0x0C, 0xEE, 0x5B, 0xA9, 0x38, 0xD8, 0xB3, 0x75, 0x68, 0x3B, 0x51, 0x51, 0x8F, 0xE6, 0x99,
+    0x58, 0x85, 0xC6, 0xF7, 0xE5, 0xA4, 0x07, 0x43, 0x54, 0xA3, 0xEE, 0x7E, 0x50, 0x84, 0xC2, 0x9E,
+    0xCD, 0xEE, 0xA3, 0x7F, 0xAD, 0x03, 0x42, 0x73, 0x33, 0xE1, 0x7C, 0x1D, 0xC5, 0x36, 0xA1, 0x14,
+    0xE3, 0x55, 0xC4, 0xBD, 0x64, 0x39, 0xC3, 0xE3, 0xF6, 0xFF, 0x03, 0xDD, 0x99, 0x3D, 0xAF, 0xE6,
+    0xC6, 0x75, 0xC7, 0x7F, 0x24, 0xB3, 0xCB, 0x00, 0x2C, 0x26, 0x45, 0x94, 0x20, 0x10, 0x60, 0x36,
+    0xE9, 0xF9, 0x0D, 0x3C, 0x34, 0x0C, 0xA4, 0x49, 0x91, 0x2D, 0x74, 0x65, 0x20, 0x2E, 0xE4, 0x22,
+    0x95, 0x03, 0x64, 0x3F, 0x41, 0xEE, 0x50, 0x01, 0x02, 0x15, 0x2E, 0xA4, 0x22, 0x42, 0x8A, 0x14,
+    0x36, 0x10, 0xA7, 0xC8, 0x23, 0x04, 0xCA, 0x17, 0xD8, 0x87, 0x13, 0xB8, 0xB8, 0x45, 0x8A, 0x87,
+    0xB6, 0x61, 0xA8, 0x50, 0xB1, 0x44, 0xBC, 0xC9, 0x85, 0x94, 0x62, 0x47, 0x16, 0x65, 0x71, 0xEF,
+    0xCE, 0xF0, 0x9F, 0x62, 0xF8, 0xDC, 0x5D, 0xBD, 0xD8, 0x96, 0x9D, 0x40, 0x09, 0x32, 0xC0, 0xBC,
+    0xF0, 0x9C, 0x99, 0xE1, 0xBC, 0x9E, 0xF3, 0x3F, 0x67, 0xF8, 0xD6, 0xDD, 0xBE, 0x88, 0x66, 0x2A,
+    0xA3, 0x99, 0x8A, 0x68, 0x3C, 0xDF, 0x2A, 0x7B, 0xF6, 0xE0, 0xA4, 0xE4, 0xA4, 0xCD, 0x49, 0x9B,
+    0x03, 0x7E, 0x69, 0xBC, 0xB8, 0x78, 0xC9, 0x49, 0xD1, 0x49, 0xD1, 0x5D, 0x5C, 0xBC, 0xF4, 0x2B,
+    0xEB, 0xE7, 0xFE, 0xB7, 0x73, 0x84, 0x66, 0x06, 0x30, 0x01, 0xA0, 0x5D, 0x00, 0x6C, 0x04, 0xF8,
+    0x6A, 0x04, 0x78, 0x70, 0x09, 0x10, 0x2D, 0x50, 0x44, 0xDB, 0x43, 0xB5, 0xB4, 0x1E, 0xAA, 0x60,
+    0x3C, 0x34, 0x73, 0x33, 0x83, 0x99, 0xEA, 0x00, 0xAD, 0xAF, 0x16, 0xE8, 0x86, 0x72, 0x05, 0x4B,
+    0x11, 0x61, 0xBC, 0xB8, 0x48, 0x20, 0x49, 0x14, 0x92, 0x44, 0xB9, 0x1D, 0x0E, 0xE3, 0x50, 0x2D,
+    0xD0, 0xFA, 0x3A, 0x80, 0x99, 0xCC, 0x0C, 0x4D, 0x68, 0x3D, 0xD4, 0xA1, 0xF3, 0x50, 0xAD, 0xB6,
+    0x87, 0x32, 0x3A, 0x80, 0xB4, 0x01, 0x6C, 0x4E, 0xD2, 0xAB, 0x92, 0xB6, 0x5A, 0xD2, 0xDA, 0xFA,
+    0x7D, 0x12, 0x45, 0x04, 0xEA, 0x00, 0x7C, 0x1E, 0x49, 0x7A, 0x84, 0x93, 0x52, 0xB1, 0x1D, 0x94,
+    0xEA, 0x40, 0x13, 0x5B, 0x4F, 0xBD, 0x3A, 0x30, 0x1F, 0x44, 0x68, 0xAF, 0x02, 0xB8, 0xD6, 0x53,
+    0x44, 0x07, 0xCD, 0x07, 0x11, 0xEC, 0x55, 0xA0, 0x4C, 0xAD, 0xC7, 0x05, 0x27, 0xA9, 0x90, 0x34,
+    0xD7, 0xD2, 0x23, 0x70, 0xBA, 0xE9, 0x71, 0x52, 0xC2, 0x49, 0xF2, 0x8E, 0x62, 0x9C, 0x1D, 0x98,
+    0xE0, 0xA0, 0x5E, 0x1C, 0x54, 0x9F, 0x4C, 0x9A, 0xE0, 0xA0, 0x9D, 0xDC, 0xC5, 0xCB, 0xEA, 0x9D,
+    0xB4, 0xEC, 0x6D, 0x2F, 0x5E, 0xD6, 0x74, 0x6E, 0x56, 0x45, 0x47, 0xFE, 0x77, 0x91, 0x1C, 0x90,
+    0xCE, 0xA5, 0x32, 0x3A, 0xA8, 0xA3, 0x83, 0x2E, 0x38, 0x49, 0x93, 0x93, 0xD4, 0xBB, 0x7D, 0x3A,
+    0xF1, 0x36, 0x7E, 0x91, 0x5D, 0xFE, 0x6F, 0x44, 0x0A, 0x49, 0x09, 0x1A, 0x49, 0x0B, 0x74, 0x92,
+    0x26, 0x38, 0x82, 0xED, 0xA9, 0x16, 0x48, 0x60, 0x26, 0xAA, 0x05, 0x6C, 0x8F, 0x99, 0x20, 0x66,
+    0x56, 0xC8, 0x2C, 0x9F, 0x59, 0x7C, 0x96, 0xD5, 0x66, 0x96, 0x03, 0x33, 0x51, 0xAE, 0x60, 0x7B,
+    0x9A, 0x09, 0xD2, 0x6D, 0xD7, 0x11, 0xCC, 0x44, 0x13, 0xC0, 0xF6, 0xD8, 0x1E, 0x12, 0x45, 0x84,
+    0x6A, 0xC1, 0xCC, 0x60, 0x26, 0x46, 0xC0, 0xF6, 0xA3, 0x24, 0x69, 0x93, 0x24, 0xE9, 0x69, 0xCE,
+    0x1E, 0x0F, 0x00, 0xEE, 0x08, 0x50, 0x6C, 0x2B, 0x40, 0xFD, 0x74, 0x06, 0x68, 0x9F, 0x67, 0x11,
+    0xBF, 0xCC, 0x0B, 0xD6, 0xF5, 0x94, 0x0B, 0x74, 0xAF, 0x46, 0xE8, 0x06, 0xEA, 0xD0, 0x04, 0xCA,
+    0x15, 0x36, 0xEC, 0x40, 0x37, 0xD0, 0xF9, 0x22, 0x52, 0xAE, 0xD4, 0x81, 0x26, 0xD0, 0x0D, 0x6C,
+    0x60, 0x87, 0x72, 0xA5, 0xF3, 0x14, 0x91, 0x6E, 0xA8, 0x03, 0x34, 0xA1, 0x5C, 0xD9, 0x00, 0x3B,
+    0x74, 0x43, 0xE7, 0xA1, 0x88, 0xE5, 0x5A, 0x2F, 0x40, 0xF3, 0x91, 0xFB, 0xC9, 0x06, 0x60, 0x25,
+    0x79, 0xA0, 0x96, 0x14, 0x01, 0xF4, 0x8D, 0xF4, 0x4A, 0x00, 0x3A, 0xDF, 0x0D, 0xAE, 0x87, 0x6A,
+    0x2D, 0xD7, 0x32, 0x02, 0xA2, 0x1B, 0xCC, 0x0C, 0xED, 0x54, 0xAE, 0xB8, 0x9E, 0x6A, 0xA5, 0x1B,
+    0xAA, 0x08, 0xA2, 0x5C, 0x31, 0x33, 0xED, 0x44, 0x37, 0x30, 0xF6, 0x55, 0xA4, 0x5C, 0xA9, 0x22,
+    0x23, 0x74, 0x03, 0xED, 0xDC, 0xE6, 0x3D, 0x1B, 0xAB, 0x3C, 0x97, 0x2A, 0x8E, 0x50, 0xAE, 0xD0,
+    0x4E, 0x00, 0xBC, 0xA8, 0xAD, 0xAF, 0x24, 0x79, 0xA3, 0xB7, 0xE5, 0xBF, 0x42, 0x21, 0x0F, 0x8C,
+    0x3D, 0xB0, 0x01, 0xD5, 0x0A, 0x98, 0x19, 0xC8, 0x97, 0x1C, 0xE8, 0x26, 0x2E, 0xBE, 0x99, 0xA8,
+    0xB4, 0xF5, 0x18, 0x6D, 0x3D, 0x2F, 0x7C, 0x5B, 0x1E, 0x70, 0x1E, 0xB0, 0xE7, 0x7B, 0x4D, 0x02,
+    0xAA, 0x85, 0x7C, 0x9E, 0x18, 0x7B, 0xA8, 0xE2, 0x9F, 0x81, 0xFB, 0x91, 0x0E, 0xE3, 0xD6, 0x48,
+    0x9A, 0x6A, 0x69, 0x81, 0x17, 0xEE, 0xE5, 0x06, 0xE6, 0x3A, 0x40, 0x99, 0xB7, 0xF6, 0x3A, 0x80,
+    0xD9, 0x1C, 0x94, 0xBA, 0x0E, 0xE0, 0x2E, 0x1D, 0x98, 0x77, 0xAE, 0x03, 0xE5, 0x7A, 0x74, 0x60,
+    0x9B, 0xEB, 0x80, 0x99, 0x8E, 0x8E, 0x22, 0x36, 0xD7, 0x01, 0xCB, 0xD1, 0x61, 0xE6, 0xE6, 0x3A,
+    0x14, 0x91, 0xA3, 0xC3, 0xD2, 0x5C, 0x87, 0x66, 0xE6, 0xE8, 0x8A, 0x48, 0x73, 0x1D, 0x6C, 0xCF,
+    0xD1, 0x35, 0x33, 0xCD, 0xF5, 0x07, 0x11, 0x8E, 0xCE, 0xF6, 0x34, 0xD7, 0x4F, 0x67, 0x38, 0xBA,
+    0x08, 0xCD, 0xB5, 0x7A, 0x38, 0xBA, 0x00, 0xCD, 0x75, 0x04, 0x8E, 0x6E, 0x80, 0x66, 0xA6, 0xED,
+    0x8D, 0xA7, 0x88, 0x45, 0x04, 0xF3, 0xD1, 0xD8, 0x83, 0xD5, 0x0C, 0x8C, 0x8F, 0x78, 0x2E, 0xD4,
+    0x01, 0xD8, 0x1C, 0xD0, 0x5D, 0x07, 0xA8, 0x37, 0x07, 0xE8, 0x3A, 0x40, 0xB7, 0x39, 0xA8, 0x3F,
+    0xBE, 0x0E, 0x90, 0x2E, 0x1D, 0x74, 0xDF, 0xB9, 0x0E, 0x54, 0xE1, 0xE8, 0x20, 0x35, 0xD7, 0x81,
+    0xD6, 0x1F, 0x1D, 0x55, 0x68, 0xAE, 0x03, 0x1B, 0x47, 0x47, 0xEB, 0x9B, 0xEB, 0x50, 0x05, 0x8E,
+    0x8E, 0x23, 0xCD, 0x75, 0x68, 0x3D, 0x47, 0x57, 0x2D, 0x34, 0xD7, 0xE1, 0x08, 0x47, 0xD7, 0x7A,
+    0x9A, 0xEB, 0x0F, 0x17, 0x38, 0xBA, 0x23, 0x34, 0xD7, 0xF2, 0x70, 0x74, 0x0B, 0x34, 0xD7, 0x02,
+    0x8E, 0xCE, 0x43, 0x73, 0xBD, 0x02, 0x47, 0x07, 0xC5, 0xDA, 0x7A, 0x48, 0x75, 0x80, 0xAD, 0x88,
+    0x30, 0xE2, 0xC0, 0xF5, 0xAD, 0xC7, 0x0E, 0x75, 0xC8, 0x27, 0xB8, 0x9D, 0x70, 0x98, 0x99, 0xD6,
+    0x37, 0x81, 0x3A, 0xD4, 0x0B, 0x45, 0xFA, 0xC6, 0x0A, 0x4E, 0x11, 0x5A, 0x09, 0xEA, 0x8F, 0x5E,
+    0x09, 0x14, 0xB1, 0xD8, 0xC0, 0x61, 0x3D, 0xAD, 0xAF, 0x22, 0x75, 0xC0, 0xF5, 0x45, 0xC4, 0x04,
+    0x1C, 0x88, 0xD6, 0xD3, 0x4E, 0x75, 0xA0, 0x8A, 0x45, 0x04, 0xEB, 0x1D, 0xD4, 0x4B, 0xEB, 0x41,
+    0x75, 0x00, 0x33, 0x53, 0x4B, 0x5A, 0xE8, 0x24, 0xCD, 0x8C, 0x92, 0x86, 0x7C, 0x97, 0x9A, 0x89,
+    0x6A, 0xA5, 0xEB, 0x31, 0x33, 0x09, 0xEC, 0x50, 0x2D, 0xB0, 0x61, 0x26, 0xAA, 0x15, 0x0B, 0x66,
+    0x26, 0x82, 0x1D, 0xAA, 0x00, 0x1B, 0xC6, 0x7F, 0x8A, 0x5C, 0x07, 0xD8, 0x68, 0x3D, 0xD5, 0xCA,
+    0x25, 0x98, 0xB9, 0x5C, 0xC1, 0x0E, 0xCD, 0x0C, 0x1B, 0xB6, 0xA7, 0x5A, 0x89, 0x60, 0xE6, 0x3A,
+    0x80, 0x1D, 0xEC, 0x00, 0x9B, 0x12, 0x54, 0x4F, 0x35, 0x83, 0x79, 0xBC, 0x01, 0xF6, 0xAF, 0x7B,
+    0x00, 0x37, 0x03, 0x4D, 0x72, 0x01, 0x30, 0xC9, 0x2D, 0x40, 0x9B, 0x5C, 0x04, 0x6C, 0xBA, 0xDC,
+    0xB3, 0x23, 0xF0, 0x20, 0x5D, 0x3A, 0x20, 0xA6, 0x4B, 0xDB, 0x53, 0xAC, 0xE9, 0xB2, 0x1B, 0xA8,
+    0x96, 0x74, 0x69, 0x3C, 0x55, 0x48, 0x97, 0x66, 0xA2, 0x99, 0x93, 0xAB, 0x03, 0xC6, 0x27, 0x57,
+    0x2D, 0xB4, 0x3E, 0xB9, 0x72, 0xA5, 0xEB, 0x93, 0x23, 0x62, 0x49, 0x8E, 0xC4, 0x25, 0xC9, 0xE1,
+    0x88, 0x24, 0x87, 0xCD, 0x59, 0xF7, 0x57, 0x0B, 0xC9, 0xD1, 0xFE, 0x20, 0x90, 0x1C, 0xE6, 0x9D,
+    0x99, 0xE4, 0x68, 0xFE, 0x73, 0x22, 0x39, 0x2A, 0xF9, 0x9C, 0x0D, 0x24, 0x47, 0xA1, 0xAC, 0x77,
+    0xF6, 0xEC, 0x41, 0xCE, 0x30, 0x57, 0x01, 0x88, 0xBF, 0x7E, 0xF1, 0xA3, 0x8B, 0x8B, 0x97, 0xA3,
+    0x93, 0xA4, 0x2B, 0x49, 0x8A, 0xEE, 0x70, 0x38, 0xBC, 0xFD, 0x9B, 0x76, 0xF6, 0xAC, 0xE8, 0xCF,
+    0xB7, 0xE3, 0xBE, 0xE6, 0xAC, 0x97, 0x06, 0x4A, 0x49, 0x91, 0x52, 0x43, 0x31, 0xFA, 0x42, 0x50,
+    0x47, 0x04, 0xB8, 0xC1, 0xF5, 0x60, 0x82, 0xF5, 0x50, 0x24, 0x33, 0x01, 0xF6, 0xB5, 0x00, 0x34,
+    0x3F, 0x8B, 0x40, 0x19, 0x47, 0x00, 0xD7, 0x79, 0xA0, 0x7D, 0x37, 0x00, 0xF5, 0xCF, 0x23, 0x50,
+    0xA4, 0xE7, 0x19, 0x57, 0x01, 0x68, 0x42, 0x02, 0xAA, 0xD5, 0x7A, 0x20, 0xD5, 0x0B, 0x30, 0xEE,
+    0xFF, 0x68, 0x67, 0x70, 0xBE, 0x54, 0xCF, 0x38, 0xD1, 0x6D, 0x6F, 0x69, 0xA2, 0xC8, 0xB2, 0xB7,
+    0xD1, 0xD6, 0x03, 0x77, 0xEE, 0x65, 0x15, 0x20, 0x7D, 0x57, 0x92, 0x3E, 0x96, 0xA4, 0x14, 0x81,
+    0xD1, 0x01, 0xED, 0x43, 0x0F, 0xF5, 0xC7, 0x01, 0x8A, 0x14, 0x01, 0xF7, 0x25, 0x10, 0xA3, 0xD3,
+    0x7B, 0xD4, 0x3B, 0x92, 0xD8, 0xEA, 0x50, 0xB8, 0xC5, 0x81, 0xBB, 0x0A, 0x19, 0x74, 0x98, 0xEB,
+    0x00, 0x72, 0xD0, 0x7C, 0x1C, 0xB2, 0x00, 0x32, 0xEF, 0x84, 0x0C, 0x45, 0xC6, 0xD7, 0x3E, 0x7A,
+    0x79, 0x0C, 0x4E, 0x5A, 0x6B, 0x29, 0xE1, 0x0E, 0x7F, 0x93, 0xA5, 0x94, 0x3B, 0x8B, 0xAB, 0x5F,
+    0x51, 0x38, 0x87, 0x4E, 0x4F, 0x60, 0x94, 0x96, 0x42, 0x52, 0x2C, 0x34, 0xF1, 0x17, 0xA8, 0x87,
+    0x9C, 0xB8, 0x01, 0xE8, 0xFC, 0x59, 0x3D, 0xD4, 0x0B, 0xBB, 0x7E, 0x60, 0xE4, 0xCC, 0x69, 0xC2,
+    0xE7, 0x10, 0xEB, 0xC0, 0xAE, 0x5C, 0xB2, 0xB6, 0x68, 0x16, 0x00, 0x01, 0x74, 0x01, 0xA8, 0x34,
+    0x70, 0x17, 0xAB, 0x83, 0x7C, 0x29, 0x29, 0xD0, 0x48, 0x8F, 0xA0, 0x78, 0x69, 0xDF, 0xA0, 0xFB,
+    0x92, 0xF4, 0xAE, 0x24, 0x2D, 0x14, 0x89, 0xF3, 0xA0, 0xDB, 0xDB, 0xBE, 0x8B, 0xF8, 0xE5, 0x10,
+    0x1D, 0x50, 0xAE, 0x76, 0x80, 0x6A, 0xED, 0x3C, 0xD4, 0xC1, 0xCC, 0x60, 0xE6, 0x26, 0x23, 0xEB,
+    0x15, 0xEC, 0x50, 0x66, 0x24, 0xB5, 0xC1, 0x08, 0x63, 0xC6, 0x4C, 0x43, 0x19, 0xA1, 0xF3, 0xD5,
+    0x7A, 0x96, 0x4E, 0x4D, 0x30, 0x33, 0x54, 0x6B, 0xEB, 0xA1, 0x8C, 0xDD, 0x00, 0x6C, 0xB6, 0x07,
+    0xC6, 0x11, 0xC0, 0x26, 0x80, 0x2E, 0x02, 0x98, 0xE5, 0x39, 0xE0, 0x3F, 0xDF, 0xAE, 0x21, 0xEA,
+    0xA1, 0xD2, 0x06, 0x54, 0x5A, 0x81, 0x4A, 0x13, 0xC0, 0x4B, 0x7C, 0x22, 0xB8, 0xCF, 0xC9, 0xBE,
+    0xAD, 0xF7, 0xB8, 0x05, 0x8D, 0x2E, 0x63, 0x7E, 0xBD, 0xE1, 0xEE, 0x68, 0xAA, 0x23, 0x8E, 0x36,
+    0x98, 0x80, 0xCB, 0x83, 0x73, 0x94, 0xB1, 0xF3, 0x38, 0x48, 0x76, 0xC0, 0xE5, 0x51, 0x3E, 0xCB,
+    0x8E, 0xE7, 0xAF, 0xCC, 0xDB, 0x6B, 0xB6, 0x13, 0x8E, 0x32, 0x9A, 0x80, 0xA3, 0x5E, 0xF7, 0x3E,
+    0x4B, 0x4D, 0xEE, 0xAE, 0xFC, 0xFE, 0xBF, 0xF3, 0xDF, 0xF9, 0x73, 0xBD, 0xF7, 0x0B, 0xC7, 0xC9,
+    0x0B, 0x40, 0x37, 0x40, 0xFB, 0x6A, 0x82, 0x6A, 0x31, 0x61, 0xC7, 0x63, 0xAD, 0x2F, 0x22, 0xD5,
+    0x82, 0x09, 0x8C, 0x60, 0xFB, 0xD6, 0x53, 0xC6, 0x6A, 0x01, 0x33, 0x8F, 0x80, 0xFD, 0x13, 0x0F,
+    0xA5, 0x56, 0xC0, 0x08, 0xC0, 0x4D, 0x40, 0x95, 0x00, 0x94, 0xED, 0x8E, 0x01, 0xAA, 0x8F, 0x22,
+    0x70, 0xCC, 0x5B, 0x67, 0x7B, 0xAA, 0xA5, 0x8C, 0x30, 0x66, 0xED, 0x88, 0xEB, 0xAB, 0x95, 0x32,
+    0x32, 0x82, 0x99, 0xCD, 0x04, 0xEE, 0xEB, 0xEB, 0x6E, 0x10, 0xD0, 0xCE, 0x0E, 0x68, 0x87, 0xD6,
+    0x43, 0x33, 0xD7, 0x01, 0xCA, 0xB5, 0x88, 0xC0, 0x11, 0x07, 0x74, 0xFF, 0x6B, 0x0C, 0x49, 0xD2,
+    0x2B, 0x92, 0xA4, 0x77, 0xA4, 0x7D, 0x85, 0x33, 0x2E, 0xCB, 0x68, 0x6E, 0x87, 0x66, 0x19, 0xA5,
+    0x3D, 0x63, 0x58, 0xE0, 0x81, 0x05, 0xB6, 0x2F, 0x9C, 0xF4, 0x79, 0xD7, 0xD9, 0xBA, 0x09, 0x36,
+    0xB3, 0xF2, 0xE2, 0x56, 0x4B, 0xDA, 0x0A, 0x49, 0x1B, 0x2F, 0xEA, 0x8D, 0xED, 0xF6, 0xCA, 0x7F,
+    0xE1, 0xC4, 0x41, 0x15, 0xC0, 0xB6, 0x9E, 0x22, 0xEE, 0xEA, 0xC5, 0x41, 0xF5, 0x41, 0xCC, 0x57,
+    0x30, 0xBA, 0x7C, 0x0B, 0xFF, 0x8F, 0x57, 0xC8, 0x56, 0x8E, 0xDA, 0x3D, 0xBF, 0xDA, 0xF3, 0xE0,
+    0xB2, 0x11, 0xFF, 0x80, 0xBD, 0x90, 0xFE, 0xBF, 0x14, 0xF6, 0x09, 0xC6, 0xCF, 0x16, 0xCE, 0x52,
+    0xE8, 0xD7, 0x2B, 0xB8, 0x0C, 0xBA, 0x15, 0x6E, 0xD3, 0xAC, 0x56, 0x76, 0x3D, 0xF2, 0x2B, 0xD2,
+    0x8F, 0x2E, 0xB2, 0x79, 0xF5, 0x24, 0x1B, 0x59, 0x9E, 0xFA, 0xE6, 0xA0, 0x40, 0x1D, 0x68, 0x22,
+    0x75, 0xA0, 0x8C, 0x64, 0x1C, 0xF9, 0x2C, 0x1D, 0x3F, 0x4D, 0x29, 0x12, 0x75, 0x20, 0x03, 0xDF,
+    0x6E, 0xA1, 0x96, 0x94, 0x31, 0x6D, 0x4F, 0x2D, 0x3D, 0xCA, 0xF2, 0x29, 0xC3, 0x9F, 0x8C, 0x7F,
+    0x7E, 0xED, 0x8F, 0x8B, 0x7B, 0x60, 0xAE, 0xA4, 0x27, 0xF9, 0xC4, 0x44, 0xCC, 0xD5, 0xCD, 0x41,
+    0x81, 0xE8, 0x60, 0xF4, 0xE6, 0x2A, 0x50, 0x26, 0xA2, 0x03, 0x33, 0x9B, 0xAB, 0x00, 0x1B, 0xD1,
+    0x41, 0x13, 0xCC, 0x55, 0x80, 0xF1, 0x39, 0x4E, 0x91, 0xAB, 0x59, 0x6F, 0xAE, 0x02, 0xDD, 0x42,
+    0x74, 0xD2, 0x86, 0xB9, 0x92, 0xD4, 0x13, 0x9D, 0xB6, 0x1E, 0xE3, 0xBF, 0x28, 0x0E, 0xC8, 0x85,
+    0x8B, 0x7B, 0x79, 0xFD, 0x9C, 0x14, 0xEB, 0x9B, 0x83, 0x82, 0x83, 0xF1, 0x2A, 0x50, 0x7E, 0x16,
+    0x85, 0x8C, 0x67, 0x4A, 0x72, 0xD9, 0x37, 0xD3, 0x2E, 0x6E, 0xF7, 0x01, 0xF5, 0x2E, 0xE3, 0xAC,
+    0x0C, 0x0A, 0x9F, 0x80, 0x95, 0x12, 0x95, 0xA4, 0x95, 0xAF, 0xF4, 0xC5, 0x38, 0x03, 0x85, 0x06,
+    0xA0, 0x8A, 0xCF, 0x74, 0xDB, 0xC8, 0x19, 0x59, 0x60, 0x9F, 0xF1, 0x3A, 0xDF, 0x48, 0x8A, 0x8C,
+    0x92, 0xFC, 0xDD, 0xC3, 0xE1, 0xAD, 0x78, 0x8B, 0x2D, 0x32, 0xD6, 0xC8, 0x75, 0x97, 0xDB, 0x1E,
+    0xCC, 0x7C, 0xDB, 0x56, 0xC3, 0x1F, 0xC2, 0x18, 0xAA, 0xED, 0xA0, 0x35, 0x8F, 0xA1, 0x18, 0x95,
+    0xCE, 0x00, 0xF0, 0x1C, 0x5A, 0x0F, 0x9D, 0x1E, 0xE5, 0xE3, 0x20, 0xF9, 0x22, 0xEE, 0xCE, 0x15,
+    0x07, 0x1A, 0x8A, 0xD1, 0xB7, 0x1E, 0xF5, 0xD4, 0xB1, 0x0E, 0x8C, 0x3D, 0xB8, 0x57, 0x23, 0x76,
+    0xC8, 0x7E, 0xA2, 0xD6, 0x43, 0x91, 0x5A, 0xDF, 0x84, 0x0C, 0x65, 0xAB, 0x95, 0xEC, 0xAD, 0x4A,
+    0x40, 0x19, 0xDD, 0xC5, 0xD8, 0x03, 0xAE, 0x95, 0x26, 0xA0, 0xBD, 0x92, 0x02, 0x50, 0x7F, 0xB0,
+    0x1D, 0x22, 0xD9, 0xBF, 0x64, 0x73, 0x05, 0x6F, 0x26, 0xA0, 0xBB, 0x7A, 0xD6, 0xC3, 0x08, 0x54,
+    0xEB, 0xB3, 0x5F, 0x54, 0x2B, 0x30, 0xD6, 0x81, 0x91, 0x3C, 0x06, 0x13, 0xC0, 0x79, 0x47, 0xA1,
+    0x9E, 0x71, 0x6A, 0x3D, 0xED, 0xF6, 0x96, 0xA6, 0x3A, 0x50, 0x48, 0x9A, 0x8A, 0x08, 0xB5, 0x94,
+    0xB7, 0xA1, 0xB8, 0x07, 0x50, 0xBC, 0xA5, 0x48, 0x27, 0x25, 0x24, 0xA5, 0x4A, 0xF7, 0x48, 0xCD,
+    0x0A, 0xC9, 0xCC, 0x59, 0x73, 0x93, 0x5A, 0x7F, 0x4E, 0xCC, 0x74, 0x66, 0x34, 0x0B, 0xA4, 0x6A,
+    0xEB, 0xC9, 0xCD, 0x72, 0x07, 0x95, 0x94, 0xA8, 0x56, 0x12, 0x26, 0x90, 0x68, 0x27, 0x12, 0x76,
+    0x20, 0x31, 0x42, 0x2A, 0x12, 0xA4, 0x2A, 0x42, 0x6A, 0x02, 0xA4, 0x76, 0x86, 0x64, 0x3D, 0xA4,
+    0x31, 0x3B, 0x8B, 0x2E, 0xC0, 0x69, 0x65, 0x94, 0x7C, 0xFB, 0xEF, 0xDF, 0x8C, 0x25, 0xB8, 0x3E,
+    0xEF, 0x5B, 0x19, 0xF7, 0xD3, 0xD8, 0xF9, 0xBB, 0x52, 0xE8, 0xA4, 0xD8, 0x6D, 0x17, 0x63, 0x37,
+    0xD3, 0x9E, 0x66, 0xEA, 0x0F, 0x03, 0x65, 0x8A, 0x20, 0xDB, 0xE3, 0x4E, 0x33, 0xEE, 0x67, 0xBA,
+    0x48, 0xD1, 0x2A, 0xD9, 0x52, 0x6B, 0xE3, 0xF7, 0x5D, 0xFD, 0xBD, 0x7F, 0x86, 0x4E, 0x81, 0x5A,
+    0x0A, 0x74, 0x7A, 0xAF, 0x67, 0x9C, 0xA1, 0xD8, 0xCE, 0xC7, 0xA4, 0x99, 0xCF, 0x56, 0x8B, 0xF1,
+    0xDF, 0x7E, 0x83, 0xF6, 0x3B, 0xDA, 0xE8, 0x9C, 0xE4, 0xED, 0x86, 0x0B, 0x76, 0xA1, 0x59, 0xEC,
+    0x44, 0x15, 0xAD, 0xA7, 0x88, 0xD6, 0x67, 0xFC, 0xB3, 0xAB, 0xBC, 0xAC, 0xF7, 0x86, 0x0C, 0x78,
+    0x48, 0xAD, 0xA7, 0x88, 0x66, 0xA2, 0x8A, 0x4D, 0xA0, 0x5E, 0xAA, 0x48, 0x1B, 0x0A, 0xBD, 0x99,
+    0xB1, 0x0E, 0x34, 0x5A, 0x76, 0x28, 0x93, 0xDD, 0x3F, 0x93, 0x91, 0xF4, 0xF5, 0xED, 0x30, 0x86,
+    0x44, 0xB1, 0xD9, 0x9E, 0xEE, 0x34, 0xD1, 0x7C, 0xB8, 0x50, 0xAD, 0x89, 0x32, 0x5A, 0x69, 0x35,
+    0xD2, 0x5A, 0x49, 0x9A, 0x13, 0xE5, 0x66, 0x7B, 0xDA, 0xD3, 0x44, 0xF5, 0xF1, 0x02, 0x29, 0x81,
+    0x73, 0x3D, 0xEE, 0x74, 0xF3, 0x96, 0x7E, 0x2C, 0x69, 0xD2, 0x7E, 0xC9, 0xAC, 0xF4, 0x58, 0x7A,
+    0xBA, 0x1D, 0xFE, 0x31, 0x9D, 0xBD, 0x7D, 0xBB, 0x07, 0xF0, 0x0B, 0x7E, 0x9C, 0x83, 0x95, 0x96,
+    0x7C, 0x78, 0xA8, 0x6F, 0x0E, 0x63, 0x4F, 0x3B, 0x90, 0xE0, 0x92, 0x6A, 0xA1, 0x58, 0x31, 0x13,
+    0xCD, 0x84, 0xED, 0xE9, 0x7A, 0x12, 0x3C, 0xA0, 0x5A, 0xA8, 0x02, 0x66, 0xC2, 0x78, 0x6C, 0x8F,
+    0xDD, 0x3D, 0x81, 0xD5, 0x42, 0x33, 0x63, 0xA6, 0xEC, 0x1E, 0x2C, 0x22, 0xA4, 0xFC, 0xB3, 0x5A,
+    0xB7, 0x88, 0x3E, 0x8D, 0x92, 0xF4, 0xF3, 0x15, 0x30, 0xEF, 0xCE, 0x80, 0xBD, 0x3F, 0x00, 0xE9,
+    0x08, 0x54, 0x99, 0xFC, 0xC3, 0x1E, 0xB8, 0x03, 0x5C, 0x40, 0xA1, 0x0D, 0xA4, 0x84, 0x7D, 0x74,
+    0x3F, 0x34, 0x0B, 0xD6, 0x27, 0x8A, 0xD4, 0x79, 0xCC, 0x4F, 0x57, 0x18, 0x6D, 0x4F, 0xF3, 0xA1,
+    0x24, 0x59, 0x49, 0x1F, 0xDE, 0x1C, 0x0E, 0x87, 0xEC, 0x07, 0xDF, 0xA5, 0x43, 0x19, 0xCF, 0x28,
+    0x7A, 0x1C, 0xF8, 0xED, 0x52, 0xFF, 0xF0, 0xB6, 0x6F, 0xA4, 0x98, 0xAD, 0xC1, 0xE2, 0x16, 0x35,
+    0x67, 0xF4, 0x67, 0xFB, 0x44, 0x1D, 0xB0, 0x43, 0xEB, 0x8B, 0x98, 0x81, 0xBB, 0xCB, 0x13, 0x6C,
+    0xBD, 0x99, 0xA9, 0x43, 0x1D, 0x76, 0x37, 0x4B, 0x15, 0xC0, 0x4C, 0xAE, 0x5A, 0xA1, 0xD8, 0xC6,
+    0xF7, 0x23, 0xBB, 0x9C, 0x83, 0x36, 0x5B, 0x9B, 0x66, 0x76, 0xF5, 0x9A, 0xDD, 0xE7, 0x0E, 0xEA,
+    0xA5, 0x0E, 0x26, 0x50, 0xAD, 0x45, 0x64, 0xA3, 0x8C, 0x38, 0x3A, 0x5F, 0xA4, 0xEC, 0x65, 0xD9,
+    0xA8, 0x03, 0xB6, 0x1F, 0x29, 0x22, 0x4D, 0x70, 0x7D, 0xF6, 0xB5, 0x70, 0x71, 0x8F, 0x2E, 0xDB,
+    0x84, 0xB3, 0x7D, 0xF3, 0xFE, 0xF2, 0x3B, 0x54, 0x6B, 0x9E, 0x4E, 0x19, 0xB3, 0xB7, 0xAE, 0x09,
+    0xA5, 0x34, 0x54, 0x4A, 0x94, 0xD2, 0x04, 0xCD, 0xBA, 0x5B, 0x2F, 0x69, 0x87, 0x56, 0xA9, 0xA7,
+    0x8A, 0xC7, 0x37, 0xEF, 0xAF, 0xA3, 0x34, 0xDF, 0xD7, 0xD6, 0xF3, 0x42, 0x16, 0x09, 0x66, 0xA2,
+    0x8E, 0x09, 0x74, 0x9A, 0xE8, 0x62, 0xA2, 0xD2, 0x69, 0xE2, 0x41, 0x4C, 0xB4, 0xA7, 0xD3, 0x54,
+    0x85, 0x98, 0xB8, 0x34, 0xA7, 0xC9, 0xF8, 0x98, 0xCA, 0xC5, 0x9C, 0x26, 0x4B, 0x4C, 0x66, 0x32,
+    0xA7, 0x1F, 0xAE, 0xC4, 0x64, 0x31, 0xA7, 0x77, 0x67, 0x62, 0x8A, 0x98, 0x93, 0x7A, 0xA2, 0x66,
+    0xCC, 0x29, 0x42, 0xD4, 0x80, 0xF1, 0xD5, 0x5C, 0x2C, 0x58, 0x2C, 0x45, 0x6C, 0x02, 0x8D, 0x22,
+    0x74, 0x1B, 0xF0, 0x5B, 0xCF, 0x09, 0xDD, 0x04, 0xEE, 0x34, 0x61, 0x62, 0xA2, 0xD4, 0x69, 0xC2,
+    0xC6, 0x44, 0xF3, 0xF0, 0x34, 0x15, 0x31, 0x26, 0xAC, 0x39, 0x4D, 0xF5, 0x1C, 0x13, 0xD1, 0x9C,
+    0xA6, 0xAE, 0x8F, 0xA9, 0x0A, 0xE6, 0x34, 0x25, 0x62, 0x6A, 0x07, 0x73, 0xFA, 0x71, 0x20, 0xA6,
+    0x23, 0xE6, 0xF4, 0xD0, 0x13, 0xB5, 0x60, 0x4E, 0x1B, 0x44, 0x79, 0xCC, 0x69, 0xDD, 0xB1, 0x84,
+    0xED, 0xE9, 0x5E, 0x9F, 0x68, 0x7F, 0xB0, 0x60, 0xA6, 0x84, 0x99, 0x6D, 0xDF, 0x04, 0x33, 0x55,
+    0x4B, 0xB5, 0x54, 0x2B, 0xA9, 0x8C, 0xD8, 0xF7, 0x23, 0x46, 0x1B, 0x95, 0xE4, 0xD9, 0xAA, 0x88,
+    0xED, 0xED, 0x60, 0xA6, 0x26, 0x54, 0x0B, 0x22, 0x37, 0x29, 0xA3, 0x99, 0xB0, 0x3F, 0xC8, 0xD7,
+    0x13, 0xB7, 0x6B, 0x34, 0x49, 0x21, 0xFB, 0x50, 0xDF, 0x3F, 0x28, 0x3F, 0xA4, 0x44, 0xEA, 0x50,
+    0x05, 0x5A, 0x6F, 0x3C, 0x0E, 0x4B, 0x11, 0x8B, 0x95, 0x3A, 0xD4, 0x33, 0xAD, 0x6F, 0x07, 0x1C,
+    0x97, 0x14, 0xB1, 0x5C, 0xA8, 0x43, 0x33, 0xD1, 0x7A, 0x0B, 0x8E, 0x98, 0x57, 0xA7, 0x96, 0x7A,
+    0x5A, 0x45, 0x70, 0x1A, 0x76, 0xC3, 0x33, 0x87, 0x4A, 0x80, 0x7D, 0x9C, 0xA0, 0xD0, 0x18, 0xC1,
+    0x6C, 0x0A, 0xE0, 0x9E, 0x3E, 0x9D, 0xA9, 0x9E, 0x3E, 0x7E, 0xE8, 0x31, 0x0F, 0xC7, 0xFB, 0x3D,
+    0x0F, 0x2E, 0x93, 0xA5, 0xFA, 0xE0, 0xE9, 0x92, 0x68, 0x5F, 0x7B, 0xFC, 0xC3, 0x95, 0xD8, 0x8E,
+    0x5F, 0x0F, 0xF5, 0x7C, 0x99, 0x9A, 0xA9, 0xFB, 0xDA, 0xD3, 0xC5, 0xF8, 0x58, 0x3F, 0x9E, 0xEC,
+    0x1F, 0x4F, 0xED, 0xD8, 0x5F, 0x5A, 0x2E, 0x13, 0xDB, 0x5A, 0x3C, 0x5D, 0x4A, 0xF9, 0xFA, 0xF1,
+    0x54, 0x6D, 0xB4, 0x63, 0xDF, 0x2C, 0x5C, 0x26, 0x5A, 0x5F, 0xAC, 0xFB, 0xDA, 0xD5, 0x9A, 0x28,
+    0xB4, 0x80, 0x4B, 0xD0, 0xEA, 0x33, 0x84, 0xF7, 0x0F, 0x6F, 0xEB, 0x1C, 0xB6, 0xCF, 0xAD, 0xF1,
+    0x69, 0x82, 0x87, 0x0B, 0xA0, 0xD5, 0x0A, 0x92, 0xA8, 0x74, 0x31, 0xFA, 0x66, 0xA1, 0x0D, 0x66,
+    0xA6, 0x5E, 0x3A, 0x4F, 0x15, 0xED, 0xB0, 0x3F, 0x60, 0xA5, 0xCF, 0x4D, 0x86, 0xAC, 0x45, 0x8A,
+    0xD8, 0x7A, 0xAA, 0x68, 0x66, 0xEA, 0xA5, 0x5E, 0x69, 0x43, 0xA9, 0x37, 0xE5, 0x19, 0x3F, 0x4F,
+    0xDE, 0xEA, 0xB1, 0xA4, 0xA7, 0xDB, 0xE1, 0xB0, 0x25, 0xB0, 0x63, 0x8F, 0x79, 0x3C, 0x51, 0x3D,
+    0x5D, 0xE0, 0x37, 0x25, 0x0C, 0x70, 0x81, 0xF9, 0x17, 0x6D, 0xC4, 0x51, 0xD1, 0x3C, 0xFE, 0x89,
+    0x0B, 0x9A, 0x18, 0x5F, 0x5F, 0x28, 0xA3, 0xC0, 0x3C, 0x9C, 0x61, 0xDB, 0xA0, 0xD1, 0x0C, 0x63,
+    0x82, 0x5A, 0x33, 0xB8, 0x5B, 0x8A, 0xC0, 0x3C, 0x0E, 0x14, 0x49, 0x03, 0xF6, 0xB4, 0xD1, 0xAC,
+    0xDA, 0xBE, 0x29, 0xF3, 0xAE, 0xE4, 0x53, 0xAB, 0xD9, 0x4C, 0x77, 0x7A, 0xD2, 0xD9, 0x56, 0xFB,
+    0x25, 0x05, 0xB8, 0xE8, 0x69, 0x95, 0x18, 0xB5, 0x95, 0x7A, 0xF3, 0x2F, 0xEB, 0x35, 0x2B, 0xD0,
+    0xD6, 0xE7, 0x41, 0xDA, 0x7E, 0x8F, 0xEC, 0xF1, 0xFC, 0x3D, 0x64, 0xEC, 0x64, 0xE6, 0x2C, 0x2B,
+    0x2A, 0xBD, 0xF9, 0x4F, 0x8C, 0x4A, 0xB4, 0x4A, 0xE7, 0x95, 0x6B, 0x77, 0x97, 0x58, 0x3A, 0xBC,
+    0x7D, 0x73, 0xC8, 0x52, 0x34, 0xED, 0x5D, 0x98, 0x89, 0xDF, 0x98, 0xB0, 0xFB, 0x7D, 0xCA, 0xE8,
+    0xA0, 0x5A, 0xEC, 0x90, 0x1F, 0x14, 0xCD, 0x6C, 0xA6, 0xFC, 0xCC, 0xD8, 0xFA, 0x3A, 0x64, 0xB7,
+    0xB0, 0xDD, 0xAD, 0xEF, 0x48, 0xDA, 0xFD, 0xD9, 0xAE, 0x5C, 0xC1, 0x7E, 0x7D, 0x81, 0xEE, 0xB5,
+    0x00, 0xE6, 0x5F, 0x67, 0x30, 0x0F, 0x3D, 0xD4, 0x8F, 0x3D, 0x54, 0xEA, 0xA1, 0xD4, 0xAD, 0x35,
+    0x99, 0xCE, 0x2E, 0x9C, 0x6A, 0x3D, 0x03, 0x5B, 0x33, 0xEF, 0x6F, 0x16, 0xA3, 0xFA, 0xBC, 0x31,
+    0xD9, 0x0F, 0x0C, 0xC5, 0xF7, 0xBE, 0x98, 0xA1, 0xFC, 0x8C, 0xF1, 0xFB, 0x4F, 0xF2, 0xF3, 0xDB,
+    0xC6, 0x0E, 0x69, 0x6B, 0x7D, 0xF7, 0x3F, 0xE4, 0xAB, 0x54, 0x2E, 0x4D, 0xAC, 0x22, 0x0F, 0x18,
+    0xBF, 0x96, 0xE8, 0x7A, 0x13, 0x46, 0x9A, 0xA9, 0x48, 0x76, 0x28, 0x17, 0xEC, 0xEB, 0x13, 0x0F,
+    0x30, 0x3F, 0x5D, 0xE8, 0xFA, 0x32, 0x26, 0x9A, 0x89, 0xD1, 0xF6, 0xE5, 0x82, 0x3D, 0xCD, 0x3C,
+    0xC0, 0xFC, 0x5B, 0xA4, 0xEB, 0xAB, 0xC5, 0xF5, 0xCD, 0x54, 0x46, 0x13, 0xCA, 0xA5, 0xD8, 0x0A,
+    0xF5, 0x0F, 0x4A, 0xD1, 0x26, 0xF7, 0x77, 0xE7, 0xF7, 0x59, 0xEA, 0xAC, 0x60, 0xEE, 0x6C, 0xF7,
+    0xBE, 0xF0, 0x70, 0x3F, 0xC1, 0xC8, 0x7B, 0xD0, 0xF9, 0x8D, 0x22, 0x95, 0x11, 0x33, 0x57, 0x91,
+    0x91, 0x6A, 0xAD, 0x03, 0xF5, 0x62, 0x87, 0xEC, 0x87, 0x35, 0xF2, 0xD0, 0x26, 0xA0, 0x9B, 0x81,
+    0xEC, 0x38, 0xF5, 0xE0, 0xDC, 0x40, 0xB5, 0x3A, 0xB0, 0x7E, 0xA4, 0x88, 0x6C, 0x98, 0xA9, 0x48,
+    0x88, 0x32, 0x36, 0x81, 0x2A, 0xBA, 0x7E, 0x87, 0xEF, 0xF9, 0x85, 0xEC, 0x7F, 0x3A, 0x91, 0xA4,
+    0xF7, 0x6E, 0xDF, 0x14, 0x37, 0x80, 0xE3, 0x2F, 0x4A, 0x7E, 0x77, 0xB7, 0x0C, 0x6A, 0xCD, 0x14,
+    0x5A, 0xF3, 0x15, 0x6C, 0xB5, 0x13, 0xB6, 0x35, 0xBF, 0x34, 0xB6, 0x8F, 0x3D, 0xF5, 0x87, 0x91,
+    0x32, 0x8E, 0x37, 0x6F, 0xAB, 0x91, 0xE4, 0xEF, 0xEB, 0x6F, 0xC3, 0x7E, 0x7A, 0xDC, 0x6E, 0x1B,
+    0xD4, 0x9F, 0x26, 0x9C, 0xD7, 0x33, 0x65, 0x54, 0xF6, 0xA5, 0x66, 0x59, 0xE8, 0x7E, 0x2A, 0x3B,
+    0x6B, 0x8C, 0x25, 0x43, 0x32, 0x33, 0x65, 0x50, 0x96, 0x9F, 0x67, 0xED, 0x3E, 0xD4, 0xF8, 0xE5,
+    0xB0, 0xF3, 0x90, 0x6E, 0xEC, 0x27, 0x46, 0xB8, 0x7B, 0xA3, 0xCE, 0xB2, 0x6B, 0x3F, 0x9F, 0xB7,
+    0x87, 0xB2, 0xFA, 0x14, 0xFB, 0xCE, 0xFE, 0xDA, 0xA6, 0x04, 0x38, 0x4D, 0x70, 0xF7, 0x90, 0x9E,
+    0x55, 0xF8, 0x4C, 0xF1, 0xE6, 0xD0, 0x83, 0xA4, 0x01, 0x23, 0xA9, 0x27, 0xF1, 0x62, 0xC4, 0x4C,
+    0xD9, 0x2C, 0xC9, 0x8F, 0x4C, 0xCD, 0x7C, 0x5B, 0x34, 0x13, 0x89, 0x3A, 0x62, 0x6E, 0xDE, 0x56,
+    0x8F, 0xA4, 0x09, 0x23, 0xBD, 0xF1, 0xDC, 0x50, 0xCC, 0xC3, 0x09, 0xB0, 0xAE, 0x27, 0x2F, 0x7C,
+    0x46, 0xE0, 0x9F, 0x24, 0x4B, 0xDF, 0xA7, 0xFA, 0x58, 0x52, 0x6F, 0x1E, 0x4A, 0xEA, 0xAD, 0xEB,
+    0x0B, 0x91, 0x12, 0x45, 0xAA, 0x3E, 0x5E, 0xA8, 0x56, 0xF3, 0x70, 0xC2, 0xCC, 0xD6, 0xF5, 0xD8,
+    0xE1, 0x96, 0xDC, 0x86, 0x73, 0x6D, 0x69, 0x21, 0x49, 0x4F, 0xF6, 0xC9, 0xA7, 0x5F, 0x12, 0x75,
+    0xF8, 0x3E, 0x92, 0xBC, 0xA4, 0x65, 0xA3, 0x89, 0x89, 0x22, 0xA5, 0xAC, 0x90, 0x8E, 0x7B, 0x9E,
+    0x12, 0x75, 0xD4, 0x41, 0x4B, 0x36, 0x0C, 0x9E, 0xC0, 0x45, 0x4F, 0x97, 0xAD, 0xDE, 0xFE, 0xAB,
+    0x17, 0xE3, 0x94, 0x01, 0x70, 0xF5, 0x09, 0x78, 0x78, 0xF7, 0x70, 0xD8, 0xEA, 0x6C, 0xB2, 0x6F,
+    0xFB, 0xC5, 0xD9, 0x32, 0xAF, 0xD8, 0xE1, 0x65, 0x1B, 0x2E, 0x5F, 0xD6, 0xE4, 0xA4, 0xBE, 0xD3,
+    0x9A, 0x55, 0x38, 0xDC, 0xB9, 0x87, 0x99, 0x68, 0xB5, 0x90, 0x68, 0xA4, 0x60, 0xA6, 0x52, 0x17,
+    0xA3, 0x4F, 0xD8, 0x81, 0xCD, 0x4C, 0x4D, 0xA0, 0x0E, 0x89, 0x04, 0xF6, 0xF5, 0xA9, 0xF5, 0x94,
+    0x31, 0x95, 0x11, 0xDA, 0xD3, 0xCD, 0xE8, 0x29, 0xA2, 0xB4, 0x42, 0x7B, 0x92, 0x06, 0x8A, 0xB8,
+    0x65, 0xCE, 0xD4, 0x7A, 0x8A, 0x98, 0x8A, 0x08, 0xDD, 0x69, 0x32, 0x13, 0xD5, 0x92, 0x18, 0xC1,
+    0x99, 0xA9, 0x5A, 0x69, 0xE7, 0x44, 0xFB, 0xE4, 0x95, 0x68, 0x26, 0x9C, 0x44, 0xDA, 0x85, 0xF8,
+    0xAD, 0xA2, 0xE7, 0xAE, 0x94, 0x4A, 0x49, 0xD3, 0x78, 0x73, 0x48, 0x66, 0xC6, 0xFC, 0x28, 0x42,
+    0xEA, 0xFC, 0x73, 0x85, 0x69, 0x83, 0xD4, 0x6C, 0x6F, 0xBE, 0x32, 0x75, 0x52, 0xE2, 0xBE, 0x34,
+    0x15, 0x89, 0x84, 0x1D, 0xCC, 0x64, 0x02, 0xA9, 0x8C, 0x98, 0xC9, 0xF5, 0x24, 0x13, 0xF6, 0x56,
+    0xAE, 0x3F, 0x1F, 0xC7, 0x2A, 0x98, 0x01, 0x57, 0x46, 0xEA, 0xD0, 0x7A, 0xFE, 0x80, 0xEF, 0x3D,
+    0x07, 0x63, 0xEF, 0xDC, 0x83, 0x56, 0x33, 0x46, 0x9A, 0xAA, 0xED, 0x8F, 0xC4, 0xD8, 0x57, 0xD1,
+    0x4C, 0xB4, 0x3F, 0x8A, 0xD9, 0x5A, 0x6C, 0x3E, 0x5C, 0x60, 0xB4, 0x92, 0xB2, 0x81, 0x72, 0x38,
+    0x1C, 0xFE, 0x7E, 0xD9, 0x6F, 0x40, 0xB5, 0x9E, 0x3D, 0x19, 0x22, 0xAB, 0xE3, 0xA1, 0xBB, 0xF9,
+    0xD3, 0xC8, 0x28, 0x79, 0x46, 0x3D, 0x82, 0x17, 0x7A, 0xFE, 0x0B, 0xD5, 0xBD, 0x4F, 0xAC, 0x1D,
+    0xD7, 0x9D, 0xE7, 0xF7, 0xA9, 0x3A, 0x22, 0xCB, 0x66, 0x75, 0xFB, 0x30, 0x00, 0x39, 0xDD, 0x2D,
+    0xAB, 0x5D, 0x5E, 0x78, 0xE1, 0x51, 0x2C, 0x55, 0x06, 0xF0, 0xC2, 0x08, 0x28, 0x9E, 0x92, 0x85,
+    0x8C, 0x80, 0x34, 0x02, 0xB1, 0x01, 0x5E, 0x19, 0x33, 0x0A, 0x22, 0x2F, 0x7A, 0x31, 0x56, 0x67,
+    0xF2, 0xBA, 0x11, 0x03, 0xA3, 0x20, 0x24, 0x4F, 0xD9, 0x02, 0xE2, 0x45, 0x07, 0x11, 0x07, 0x68,
+    0xF5, 0x2C, 0x7A, 0xD1, 0x0A, 0xA0, 0x06, 0xA8, 0xEB, 0x0C, 0xA8, 0x24, 0x5E, 0xA8, 0xD3, 0xE4,
+    0xAB, 0x23, 0x13, 0x01, 0x17, 0x5A, 0xB0, 0x64, 0x45, 0xD1, 0xC2, 0x08, 0x54, 0xB6, 0xC4, 0xE1,
+    0x58, 0x5A, 0xF0, 0xD8, 0x2A, 0x99, 0x45, 0xF2, 0x54, 0xFD, 0xB2, 0x38, 0x55, 0xF7, 0xBD, 0x47,
+    0x52, 0xB2, 0x24, 0x5B, 0x6E, 0xF5, 0x7D, 0xEF, 0x56, 0xD5, 0x3D, 0xB7, 0xAA, 0xEE, 0x39, 0xBF,
+    0x3A, 0x7F, 0x7E, 0x7F, 0xBF, 0xBF, 0x7D, 0x2A, 0x98, 0xD7, 0x47, 0xE3, 0x9E, 0x05, 0xF6, 0xE1,
+    0x35, 0xBE, 0x78, 0xB0, 0x2F, 0x1E, 0xEC, 0x8B, 0xAF, 0x0F, 0xE5, 0x77, 0x87, 0xF2, 0xBB, 0x83,
+    0xB9, 0x10, 0xE2, 0x3F, 0x00, 0x89, 0x9F, 0xDF, 0x3D, 0x7C, 0x5E, 0xDE, 0x42, 0x24, 0x64, 0x72,
+    0x75, 0xD0, 0x03, 0x07, 0xCB, 0x16, 0x4C, 0x0D, 0xA6, 0x02, 0x0B, 0x34, 0xB7, 0xBC, 0xED, 0xFC,
+    0x36, 0x15, 0x18, 0x07, 0x45, 0x07, 0x7A, 0x4C, 0x4E, 0x28, 0x91, 0x40, 0x23, 0x03, 0xFB, 0xA7,
+    0x6A, 0xE7, 0xFE, 0x1E, 0x38, 0xC6, 0xFC, 0x6A, 0xA6, 0x8A, 0x5C, 0xC4, 0x53, 0xDE, 0x68, 0x3A,
+    0x6C, 0x9D, 0x38, 0x1A, 0x80, 0x71, 0xB3, 0x09, 0xEF, 0xB3, 0x79, 0x74, 0x5A, 0x1D, 0xA7, 0x89,
+    0xBF, 0x20, 0xE1, 0xFD, 0xCF, 0x23, 0x00, 0x69, 0x00, 0x54, 0x0F, 0x14, 0x2D, 0xD0, 0x88, 0x48,
+    0x90, 0xCD, 0xE6, 0x2E, 0x48, 0x54, 0xFB, 0x2F, 0xAB, 0xC1, 0x5A, 0x69, 0xBE, 0x23, 0x22, 0x3E,
+    0xEF, 0xD3, 0x40, 0x20, 0x6F, 0x75, 0xC5, 0xD1, 0xD4, 0x93, 0xFA, 0x12, 0x8A, 0xD4, 0x93, 0xF8,
+    0x02, 0x4A, 0x06, 0xB2, 0x2E, 0xEF, 0x92, 0x80, 0x5C, 0x6E, 0x5A, 0x23, 0x22, 0x0F, 0xFF, 0xA4,
+    0xF9, 0x49, 0xF8, 0x32, 0x64, 0x00, 0x18, 0xA0, 0x7C, 0xA4, 0x83, 0xE2, 0xA5, 0x00, 0xBA, 0x2B,
+    0x6B, 0x32, 0xAF, 0x3C, 0x6A, 0x60, 0x9B, 0x24, 0xA0, 0x1D, 0x23, 0xE9, 0x80, 0x05, 0x83, 0xA9,
+    0xC8, 0xBB, 0xC2, 0xC1, 0xA8, 0x5B, 0x28, 0x2E, 0x7A, 0x50, 0xD7, 0x7A, 0xC0, 0x0E, 0x70, 0xF7,
+    0x59, 0x59, 0x93, 0x8B, 0x88, 0x4B, 0xD6, 0xCD, 0xDB, 0xCF, 0x82, 0x6E, 0x97, 0x96, 0x30, 0x42,
+    0x2A, 0x22, 0x7E, 0x26, 0xC0, 0xA6, 0x30, 0x3E, 0x88, 0x9D, 0x33, 0xFF, 0xE9, 0xD1, 0x3D, 0xAF,
+    0x85, 0xF4, 0x87, 0x6E, 0x2D, 0xFE, 0x97, 0xCF, 0x53, 0x88, 0x7C, 0x47, 0x44, 0x74, 0xC7, 0x93,
+    0x16, 0x92, 0xF9, 0xAE, 0xF9, 0x00, 0x5A, 0x2A, 0xB4, 0x74, 0x48, 0xD3, 0xEB, 0xB6, 0x18, 0x8E,
+    0x92, 0xBF, 0xD7, 0x93, 0x5F, 0x69, 0xD1, 0x6F, 0x38, 0x8E, 0x1A, 0x97, 0xF4, 0xB6, 0xD3, 0xCE,
+    0x4C, 0x23, 0x85, 0xB4, 0xA4, 0xD2, 0x42, 0xE3, 0x62, 0xB7, 0xD9, 0x86, 0xF4, 0x46, 0x85, 0x7E,
+    0xE3, 0x67, 0x8F, 0x8A, 0x11, 0xF1, 0x85, 0x5C, 0x07, 0xE0, 0x2E, 0x0E, 0x1A, 0x82, 0x4D, 0x82,
+    0x21, 0xDC, 0xC5, 0xC1, 0xA5, 0x5E, 0xEC, 0x97, 0xA9, 0x02, 0x0A, 0x91, 0x11, 0x28, 0x3B, 0x8A,
+    0x6E, 0xD3, 0xF7, 0x0C, 0xA0, 0x3C, 0x25, 0xFB, 0x9F, 0xC7, 0x50, 0xA0, 0x65, 0x50, 0xAD, 0xAE,
+    0xF4, 0x34, 0x72, 0x22, 0x73, 0xBA, 0x4B, 0xD0, 0x5F, 0xEF, 0x32, 0x0F, 0x89, 0xEF, 0x95, 0x07,
+    0x8E, 0x1C, 0x21, 0x00, 0x5A, 0xC7, 0x4B, 0x5F, 0x75, 0xBA, 0x06, 0x7A, 0xAF, 0x3A, 0xE0, 0x81,
+    0xE5, 0xCB, 0xCA, 0x00, 0xEA, 0x87, 0x5D, 0xDE, 0x42, 0xE2, 0x4F, 0x30, 0x02, 0x83, 0xAE, 0xCA,
+    0xCB, 0xFF, 0x9E, 0x13, 0x89, 0x4F, 0x45, 0xAA, 0xA3, 0x18, 0xF2, 0xA9, 0x2A, 0x51, 0x1E, 0x28,
+    0x2B, 0x6C, 0x05, 0xA6, 0x42, 0x5D, 0x27, 0x69, 0x2A, 0x28, 0xA7, 0xB3, 0x13, 0x40, 0x23, 0x03,
+    0x00, 0x87, 0xAB, 0xD8, 0x98, 0x72, 0x52, 0x22, 0xFB, 0x39, 0x09, 0x03, 0xAA, 0xDB, 0x92, 0xA7,
+    0x6F, 0x6C, 0x9F, 0xE7, 0x66, 0xA7, 0xAE, 0xD6, 0xC5, 0xD9, 0xBF, 0x9A, 0xCC, 0xF4, 0xE4, 0xDD,
+    0x55, 0x75, 0xEF, 0x7A, 0xBD, 0x7E, 0x4E, 0x44, 0xE4, 0x4D, 0x11, 0x91, 0x1A, 0x38, 0x05, 0x30,
+    0x00, 0xAA, 0x03, 0x74, 0x0D, 0x1C, 0xDD, 0x53, 0x04, 0x4F, 0xAC, 0xFF, 0x5A, 0xA6, 0x46, 0x7E,
+    0xB2, 0x3A, 0xFE, 0x91, 0x08, 0x97, 0xAC, 0x9F, 0xC3, 0x50, 0xD0, 0x48, 0xA7, 0x5A, 0x5D, 0x95,
+    0x32, 0x72, 0x22, 0x73, 0x79, 0x5B, 0x38, 0xFD, 0xF5, 0x2E, 0xED, 0x95, 0x4F, 0x7C, 0xCF, 0x79,
+    0xCE, 0x71, 0xE4, 0x08, 0x65, 0x65, 0xD0, 0x9A, 0xBC, 0x35, 0xB5, 0x7A, 0xD5, 0xA5, 0x22, 0x8E,
+    0xDE, 0xD3, 0x48, 0xCD, 0x03, 0x47, 0x28, 0xFF, 0x9D, 0x47, 0xEB, 0x2A, 0x6F, 0xCF, 0xA3, 0x7E,
+    0xD8, 0xA5, 0xBD, 0x76, 0x89, 0x3F, 0xC1, 0xF9, 0x74, 0x60, 0xD0, 0x55, 0x59, 0x19, 0x4E, 0x24,
+    0x3E, 0x6F, 0x33, 0x7F, 0x14, 0x93, 0xF4, 0x9C, 0xFF, 0x68, 0x84, 0x33, 0x22, 0x22, 0x46, 0x44,
+    0xE4, 0xDE, 0xF5, 0x7A, 0xFD, 0x3C, 0x90, 0x4A, 0x5D, 0x48, 0x6F, 0x1E, 0x0C, 0xE7, 0x38, 0x3A,
+    0x50, 0x0E, 0x14, 0x03, 0xE5, 0x39, 0x8E, 0x1E, 0xE5, 0x7C, 0x29, 0x43, 0x26, 0x2D, 0x87, 0x80,
+    0xE3, 0x40, 0xEA, 0x81, 0xDC, 0x01, 0x25, 0xC0, 0xB9, 0x5B, 0x8B, 0xEE, 0x5D, 0x4F, 0x7B, 0xA8,
+    0x7D, 0xE7, 0xB3, 0x76, 0x15, 0xED, 0xAF, 0x23, 0x79, 0x6F, 0x79, 0x4C, 0x89, 0x9C, 0x2E, 0xA4,
+    0x2F, 0xFF, 0x6D, 0xF8, 0x0C, 0x27, 0xE1, 0x28, 0x9C, 0x84, 0x73, 0x24, 0x03, 0xCA, 0xA3, 0x1D,
+    0x06, 0x02, 0xCA, 0xA3, 0x6B, 0x8C, 0x8C, 0x46, 0xC6, 0xC3, 0xAB, 0xE3, 0xA9, 0x9C, 0xCE, 0x65,
+    0x54, 0x7D, 0xE1, 0x0E, 0x26, 0x3D, 0x1C, 0x85, 0xA2, 0xA2, 0x70, 0x5A, 0x6A, 0x25, 0x1D, 0xD8,
+    0x0A, 0xE5, 0xE1, 0x1C, 0x98, 0xBB, 0x28, 0xBE, 0xF7, 0xB3, 0xAD, 0x97, 0x44, 0xDA, 0xFD, 0xEB,
+    0x0A, 0xD6, 0x34, 0x95, 0xA9, 0x4D, 0x5D, 0xD6, 0x45, 0x9D, 0xC4, 0xDA, 0xE8, 0x16, 0xC2, 0x08,
+    0xFA, 0xD2, 0x47, 0x3C, 0x48, 0xC2, 0x04, 0xC5, 0xA5, 0x0E, 0x15, 0x04, 0xEC, 0xA5, 0x01, 0x1D,
+    0xE4, 0xFA, 0x63, 0x57, 0x2F, 0x89, 0x84, 0x30, 0xDA, 0x31, 0xBF, 0xD4, 0x1E, 0x8F, 0xF3, 0x88,
+    0x6E, 0xF9, 0xC0, 0x03, 0xF6, 0x3D, 0xB1, 0x7E, 0x2E, 0x13, 0x91, 0xAE, 0x91, 0xE9, 0xEC, 0xF7,
+    0x44, 0xBA, 0xFB, 0x8D, 0x48, 0xFD, 0x77, 0x22, 0x53, 0xFA, 0x8E, 0xC8, 0x90, 0x37, 0x22, 0xDD,
+    0xFD, 0x22, 0x52, 0xFF, 0xBD, 0xC8, 0x94, 0x5E, 0xDD, 0x53, 0xF4, 0x7F, 0x89, 0x4C, 0xE9, 0x15,
+    0x91, 0x21, 0x7F, 0x5A, 0xA4, 0xBB, 0xBF, 0x10, 0xA9, 0x5F, 0x2C, 0x64, 0x4A, 0xBB, 0x5C, 0x86,
+    0xBC, 0x26, 0xED, 0xEE, 0x87, 0xBC, 0x7E, 0x11, 0xEE, 0x4F, 0x3B, 0x78, 0xF1, 0x63, 0x14, 0xFD,
+    0x61, 0xD2, 0xEE, 0x53, 0xC1, 0xBE, 0x3A, 0x1A, 0x77, 0x4C, 0xB5, 0x99, 0xD3, 0xFD, 0xFE, 0x11,
+    0x83, 0xE1, 0x94, 0x0D, 0xB6, 0xE3, 0xDE, 0x44, 0x72, 0x31, 0x67, 0x1F, 0x28, 0x0F, 0x96, 0xDC,
+    0xE9, 0xEF, 0x70, 0xEC, 0x75, 0x5A, 0x7A, 0xC3, 0xB9, 0x13, 0x3C, 0xF0, 0x22, 0x65, 0xEC, 0x78,
+    0x2F, 0x52, 0x9E, 0xE3, 0xE8, 0x03, 0x9C, 0x2C, 0xFF, 0x6A, 0xC8, 0xA5, 0xE3, 0x5B, 0x71, 0xBC,
+    0x0E, 0xE4, 0x01, 0x72, 0x87, 0x78, 0x38, 0x45, 0xF1, 0x63, 0x87, 0xF2, 0x1C, 0x29, 0xA1, 0xAC,
+    0x20, 0xC0, 0xC0, 0xDC, 0x35, 0xD0, 0x8E, 0x93, 0x80, 0x89, 0x63, 0x22, 0x50, 0xC6, 0xC1, 0x39,
+    0x00, 0xDA, 0x69, 0xA7, 0x5B, 0x0C, 0x27, 0x69, 0x2A, 0x82, 0xF2, 0xD9, 0x88, 0xF2, 0x25, 0x47,
+    0x7B, 0xF4, 0x4B, 0x43, 0x7A, 0xA5, 0x65, 0x9F, 0x76, 0x45, 0x51, 0xC1, 0x49, 0xFA, 0xF3, 0xA0,
+    0xBA, 0xFC, 0xBB, 0x3D, 0x94, 0x9C, 0xC8, 0x5B, 0x92, 0x41, 0xB5, 0x65, 0x85, 0x76, 0xA5, 0x48,
+    0xC7, 0x79, 0x44, 0xA4, 0x56, 0x5D, 0xB2, 0x7A, 0xEC, 0x2D, 0x4A, 0xA0, 0xAC, 0x92, 0x1E, 0x38,
+    0x8F, 0x76, 0x90, 0xF6, 0xB1, 0x62, 0x3D, 0x48, 0x85, 0xF2, 0xE4, 0x52, 0x91, 0xB5, 0x98, 0x4B,
+    0x15, 0xDA, 0x71, 0xBF, 0xAE, 0x28, 0x01, 0x5D, 0x71, 0x2A, 0xEE, 0x02, 0xA0, 0xAB, 0xB4, 0x07,
+    0x74, 0x15, 0xE7, 0xA5, 0x2A, 0x77, 0x80, 0xAE, 0x8A, 0xEA, 0x30, 0xE8, 0xCA, 0x64, 0xD2, 0xA1,
+    0xAB, 0xF3, 0x46, 0x06, 0x74, 0x35, 0xDC, 0x4F, 0x40, 0x3F, 0xE4, 0xE1, 0x24, 0xFA, 0xE1, 0x16,
+    0x4E, 0xB2, 0x4F, 0x3B, 0x38, 0x17, 0xC7, 0xD7, 0x00, 0x47, 0x41, 0x79, 0x08, 0x90, 0xB7, 0x24,
+    0xB1, 0x3E, 0xCA, 0xC3, 0x79, 0xC8, 0x1D, 0x69, 0x0F, 0x45, 0x8D, 0x76, 0x60, 0xC0, 0x3C, 0x73,
+    0x9C, 0x93, 0x60, 0x65, 0x64, 0x88, 0xBB, 0xF8, 0x4A, 0xA4, 0x87, 0xC4, 0x2B, 0x91, 0x1A, 0x06,
+    0xFE, 0x2E, 0x8B, 0x03, 0x88, 0x93, 0xF1, 0xA1, 0x14, 0x15, 0x26, 0x8E, 0xEA, 0xB2, 0x82, 0xBC,
+    0x43, 0xD7, 0x28, 0x69, 0xC9, 0x1D, 0xC8, 0x48, 0xD6, 0x02, 0x45, 0xAB, 0x3C, 0x40, 0x48, 0xFB,
+    0xB8, 0x78, 0x0F, 0xE9, 0x00, 0xDA, 0x05, 0xA6, 0x7D, 0xE4, 0xDD, 0x49, 0xE4, 0x3B, 0xD3, 0x59,
+    0x6F, 0xF8, 0xFB, 0xCE, 0x8A, 0x2F, 0x39, 0x31, 0xF0, 0x44, 0xA5, 0xEB, 0x07, 0x8E, 0x02, 0xDA,
+    0xDD, 0xAF, 0x6B, 0xC8, 0xDA, 0x42, 0x75, 0xA0, 0xBC, 0xAE, 0x06, 0x48, 0xBD, 0xAE, 0x8F, 0x42,
+    0x32, 0x64, 0x91, 0x31, 0x49, 0x44, 0x04, 0x4E, 0x72, 0xF8, 0xD1, 0xB1, 0xE2, 0x68, 0x9C, 0xCA,
+    0xCB, 0x38, 0xAD, 0x17, 0x55, 0x9C, 0xCF, 0x0F, 0x41, 0x32, 0x42, 0x2A, 0xA0, 0x04, 0x92, 0x09,
+    0xF8, 0x13, 0x76, 0x5E, 0xC7, 0xE7, 0xF9, 0x28, 0xC4, 0x77, 0x3A, 0x40, 0xEE, 0xA1, 0x6C, 0xE3,
+    0xC3, 0x1B, 0x41, 0x7B, 0x28, 0xDC, 0xCC, 0x83, 0xB1, 0xEB, 0x5D, 0x43, 0xD9, 0x72, 0x42, 0xCB,
+    0xD9, 0x51, 0x89, 0x8C, 0x58, 0x39, 0x1D, 0xEF, 0xF9, 0x27, 0x7C, 0x09, 0x32, 0xA9, 0x9E, 0x04,
+    0x2D, 0xBF, 0xEC, 0xA1, 0xCC, 0xC5, 0xC3, 0x11, 0x1A, 0x07, 0x87, 0xB8, 0xED, 0x95, 0x77, 0x10,
+    0x7F, 0x07, 0x8A, 0x48, 0xA9, 0x00, 0x70, 0x34, 0x00, 0x9C, 0x3F, 0x05, 0x10, 0x0C, 0x90, 0x04,
+    0x53, 0x81, 0xEA, 0x0B, 0x07, 0xCA, 0x6B, 0x07, 0x79, 0x97, 0x77, 0xA0, 0xDB, 0xCC, 0x43, 0xE1,
+    0x54, 0x0F, 0x65, 0x9D, 0x0E, 0x60, 0x48, 0x02, 0x34, 0xAB, 0xD5, 0x08, 0x22, 0x22, 0x24, 0x22,
+    0x22, 0xA4, 0xD3, 0x7A, 0xDD, 0xD4, 0xAA, 0x87, 0xC2, 0x65, 0x1E, 0x74, 0xAB, 0x3B, 0xC8, 0x7D,
+    0xE1, 0x20, 0xF3, 0xA5, 0x03, 0x35, 0x98, 0x0A, 0xD2, 0x60, 0x01, 0xC6, 0x09, 0x60, 0x82, 0xFD,
+    0xA7, 0x77, 0x6A, 0x75, 0xFD, 0x14, 0x80, 0xD7, 0xBB, 0xB6, 0x05, 0x40, 0x33, 0x02, 0x94, 0xC3,
+    0xA7, 0xB7, 0x15, 0x14, 0x22, 0x32, 0x2D, 0x8B, 0x20, 0x60, 0xE7, 0xFD, 0x54, 0xB4, 0x00, 0x49,
+    0xD0, 0x0E, 0x40, 0x0D, 0x71, 0x9F, 0xF9, 0xB8, 0xD7, 0x5D, 0xDC, 0x17, 0x2E, 0xEE, 0xCB, 0x3A,
+    0xEE, 0x0D, 0x71, 0xDF, 0xA0, 0x2F, 0xAF, 0x8E, 0xC3, 0x88, 0x16, 0x09, 0xA4, 0x21, 0xEE, 0x55,
+    0x1F, 0xCB, 0xF3, 0xF7, 0x56, 0x8F, 0x3B, 0x40, 0x8B, 0x88, 0x03, 0xCA, 0x79, 0x6F, 0xDE, 0x5E,
+    0x37, 0x2E, 0x32, 0xF8, 0xDA, 0xC5, 0x1A, 0x6A, 0x17, 0x79, 0x43, 0xED, 0x40, 0x0D, 0x71, 0x9F,
+    0xF9, 0xB8, 0xD7, 0x5D, 0xBC, 0x45, 0xE1, 0xE2, 0xDE, 0xD4, 0x71, 0xAF, 0x44, 0x9E, 0x03, 0x44,
+    0xA4, 0x8F, 0x2D, 0x6B, 0xD1, 0x6D, 0xB2, 0x35, 0xA2, 0x7A, 0x68, 0x5A, 0x46, 0xC8, 0x42, 0x64,
+    0x56, 0x6A, 0xDD, 0x42, 0xEE, 0x55, 0x0F, 0xC9, 0xC8, 0x08, 0x98, 0xDA, 0x54, 0x90, 0x7B, 0xDD,
+    0x42, 0x1A, 0xBE, 0x3F, 0xAD, 0x6B, 0xAC, 0x11, 0xF1, 0x14, 0x97, 0x44, 0x02, 0xB9, 0x2F, 0x5A,
+    0x48, 0x83, 0xEA, 0x81, 0x66, 0xD7, 0x15, 0x45, 0xAB, 0x5B, 0xD0, 0x5E, 0xF5, 0x90, 0x0D, 0x3B,
+    0xBF, 0x91, 0x8F, 0xE8, 0x96, 0xAD, 0x11, 0x25, 0x22, 0xF1, 0xA9, 0x0D, 0x60, 0x64, 0x3A, 0x1D,
+    0x07, 0xDB, 0x67, 0x81, 0xA6, 0xCB, 0x2B, 0xB0, 0xF2, 0xD7, 0x0E, 0x8E, 0xE6, 0xD2, 0x81, 0xA6,
+    0xEC, 0x20, 0xB9, 0x7D, 0x64, 0x24, 0x8D, 0x9C, 0x86, 0x4C, 0x44, 0x2A, 0x72, 0x11, 0x19, 0xC8,
+    0x27, 0x12, 0x71, 0x59, 0x80, 0x7C, 0x50, 0x01, 0x90, 0x64, 0x04, 0x74, 0x27, 0x40, 0x1A, 0x4C,
+    0x0D, 0xD8, 0xC7, 0x5B, 0x40, 0xBF, 0xE3, 0x01, 0x35, 0x05, 0x80, 0xA6, 0x01, 0x28, 0xAF, 0x3A,
+    0x20, 0xBF, 0xE9, 0x81, 0x74, 0xF7, 0x17, 0xE6, 0x0D, 0x07, 0xE8, 0x37, 0x7B, 0x40, 0xF5, 0xF1,
+    0x56, 0x65, 0x0B, 0x4C, 0x2A, 0x00, 0x4D, 0x65, 0x1D, 0x34, 0x75, 0x3E, 0x92, 0x88, 0xA3, 0x99,
+    0xBE, 0x2F, 0x8E, 0x2C, 0x72, 0x94, 0x85, 0x4C, 0x00, 0xFB, 0x8E, 0xC1, 0x5D, 0x40, 0x5E, 0xA1,
+    0x2E, 0xF6, 0xA8, 0xA1, 0xA9, 0x54, 0xC8, 0x7B, 0x15, 0x68, 0x1E, 0x0A, 0xE4, 0xD7, 0x02, 0xD8,
+    0x00, 0x79, 0x00, 0x25, 0x15, 0x4A, 0x7A, 0x54, 0xD8, 0x7B, 0x4E, 0x1F, 0x60, 0xFB, 0x77, 0x60,
+    0xFF, 0x4E, 0xFB, 0xBF, 0x08, 0x5B, 0xF2, 0x96, 0x89, 0xFD, 0xBE, 0x4E, 0x45, 0x44, 0x5C, 0x2A,
+    0x35, 0x4D, 0x97, 0x08, 0xE4, 0x23, 0x02, 0x99, 0x38, 0x5B, 0xA1, 0xAE, 0x0D, 0xC6, 0xA1, 0xFA,
+    0x46, 0x77, 0xA4, 0xA1, 0x78, 0xBD, 0x27, 0x09, 0xEA, 0x46, 0x80, 0x11, 0x69, 0x60, 0x9B, 0xF2,
+    0xAA, 0xC3, 0x92, 0xDF, 0xF4, 0x98, 0x2A, 0x9D, 0x02, 0xA6, 0xA6, 0x69, 0x28, 0x1C, 0xE5, 0x55,
+    0xA7, 0x1D, 0xFA, 0x9A, 0xD7, 0x2D, 0x6A, 0x18, 0xF3, 0x0E, 0x46, 0x73, 0xD1, 0x43, 0x93, 0x5D,
+    0xEB, 0xC1, 0xD4, 0x32, 0x40, 0xD9, 0x16, 0x01, 0xCA, 0x2E, 0x95, 0x0A, 0xEB, 0x11, 0x59, 0x47,
+    0xE9, 0x48, 0x3A, 0x4C, 0x26, 0x52, 0xA3, 0xAA, 0xE4, 0xF8, 0xEE, 0x27, 0xB7, 0x86, 0x28, 0xAE,
+    0xA2, 0x06, 0x80, 0x6D, 0x80, 0xA2, 0xDE, 0x70, 0xD9, 0x87, 0x6E, 0x9B, 0x01, 0x93, 0xC1, 0x56,
+    0x60, 0x9E, 0x0A, 0x4B, 0x7F, 0x1C, 0x69, 0xA0, 0x74, 0xAA, 0x47, 0xF5, 0x94, 0x8E, 0x06, 0x26,
+    0x8A, 0x96, 0xDC, 0xAB, 0x01, 0x4C, 0x6D, 0x21, 0x09, 0xBA, 0x03, 0xFD, 0x93, 0x00, 0x58, 0x53,
+    0x83, 0x12, 0x0F, 0x14, 0x23, 0x80, 0xB8, 0x8D, 0x40, 0x67, 0xAA, 0x8F, 0x71, 0x68, 0x89, 0x83,
+    0xEF, 0x96, 0x03, 0x91, 0x01, 0x2B, 0x32, 0x64, 0x22, 0xE2, 0x2D, 0x89, 0x7C, 0xCF, 0xA3, 0x82,
+    0x05, 0x7D, 0xC5, 0xC3, 0x64, 0x21, 0xBF, 0x36, 0x1F, 0xE8, 0x2B, 0x9E, 0x64, 0xB4, 0x60, 0x2E,
+    0x7A, 0x8A, 0xDE, 0xAE, 0x9B, 0x29, 0x13, 0x91, 0xCA, 0xCA, 0x54, 0xDD, 0xE1, 0xCE, 0xCB, 0x01,
+    0xDC, 0xFD, 0x3C, 0xE4, 0x22, 0x35, 0x22, 0xD2, 0xEA, 0xEB, 0x49, 0xE3, 0x6C, 0x85, 0xFD, 0xFA,
+    0x00, 0x93, 0xEE, 0xE2, 0xEC, 0xA6, 0xDB, 0x11, 0x44, 0xF5, 0x68, 0xAF, 0xDB, 0x44, 0x30, 0x95,
+    0xEE, 0x18, 0xD9, 0x46, 0xF5, 0xAA, 0x8F, 0x53, 0xA2, 0xA9, 0x8A, 0x8E, 0x11, 0xE3, 0x55, 0x8F,
+    0xE9, 0x75, 0x4B, 0x39, 0x98, 0x0A, 0x3D, 0x8C, 0x90, 0x5F, 0xEB, 0x41, 0x5F, 0x6D, 0xA1, 0x90,
+    0x0A, 0xEC, 0x08, 0x89, 0xF4, 0x87, 0xD0, 0x57, 0xDB, 0x53, 0x2B, 0x31, 0x0F, 0x8A, 0xF4, 0x63,
+    0x2A, 0x52, 0x45, 0xA9, 0xE1, 0x0F, 0xD8, 0x4F, 0x39, 0x28, 0x57, 0xCA, 0x7F, 0xF0, 0xFA, 0x7F,
+    0x92, 0x5E, 0xB9, 0x62, 0xA0, 0xDA, 0x0C, 0xD2, 0xE3, 0x60, 0xA5, 0x47, 0x44, 0xEA, 0xF2, 0x2F,
+    0xB7, 0x7C, 0x1A, 0x27, 0xDB, 0x72, 0x9E, 0xBB, 0x08, 0x80, 0xE5, 0x6E, 0x11, 0x67, 0x45, 0x7C,
+    0xF3, 0xB3, 0x3F, 0x0E, 0x4D, 0x8D, 0x35, 0x35, 0xC5, 0xA5, 0x96, 0xEC, 0x9A, 0x27, 0x0D, 0x23,
+    0x88, 0x71, 0x89, 0xBC, 0x3C, 0x7E, 0xE3, 0xA6, 0x17, 0x19, 0xCE, 0xE5, 0xD2, 0x97, 0xEC, 0xAB,
+    0x00, 0xCE, 0x40, 0x2A, 0x1D, 0xF4, 0x27, 0x23, 0x1B, 0x7A, 0x5F, 0xD2, 0x91, 0xD5, 0x3D, 0x4C,
+    0x01, 0x74, 0x80, 0x8D, 0x80, 0xBB, 0xEF, 0x18, 0x89, 0x48, 0xAB, 0x44, 0x26, 0xB6, 0xFF, 0xB8,
+    0x71, 0x9F, 0x89, 0x7D, 0xAF, 0x21, 0x2E, 0xE0, 0xCA, 0x43, 0x12, 0xF8, 0x53, 0x91, 0x44, 0x44,
+    0x7E, 0x28, 0x7F, 0xFB, 0xF0, 0x2F, 0xA6, 0xC8, 0xB3, 0x5B, 0x53, 0x51, 0xBC, 0xE1, 0xC8, 0xDF,
+    0xED, 0x51, 0x41, 0xC8, 0xA4, 0x7C, 0xEF, 0xF1, 0xAB, 0x17, 0x44, 0x7E, 0xEA, 0x4B, 0x69, 0xCF,
+    0x71, 0x78, 0x6E, 0xE5, 0x0A, 0x72, 0x19, 0x13, 0x99, 0xC8, 0x44, 0x06, 0x2B, 0x01, 0xF3, 0x6F,
+    0xED, 0xD5, 0xB7, 0xB6, 0xBA, 0xA4, 0xA2, 0xE9, 0xB1, 0x15, 0xA8, 0x29, 0xAA, 0x44, 0x8C, 0x8B,
+    0xBF, 0x19, 0x22, 0x57, 0x6F, 0x1C, 0xBA, 0x4D, 0x1A, 0x11, 0x91, 0x31, 0x15, 0x11, 0x11, 0x69,
+    0xE5, 0xF2, 0x43, 0xD3, 0x7A, 0xFD, 0x7C, 0xD9, 0x61, 0x6A, 0x50, 0x03, 0x2A, 0xC4, 0xEE, 0x67,
+    0x22, 0xE5, 0xB2, 0x31, 0x7E, 0x14, 0x0F, 0x6A, 0xA0, 0x6C, 0x1C, 0x87, 0xCA, 0xF7, 0xB6, 0x7E,
+    0x22, 0x7F, 0xDB, 0xD4, 0xB1, 0xFF, 0x0D, 0xA9, 0x8C, 0xE4, 0x32, 0xC1, 0xF1, 0x58, 0xC1, 0xBB,
+    0x00, 0xCE, 0x73, 0x0E, 0x25, 0x45, 0x4F, 0x2A, 0x13, 0x24, 0xD2, 0x42, 0x29, 0x35, 0xD9, 0xD4,
+    0xD4, 0x94, 0xCE, 0x56, 0x7C, 0x75, 0x47, 0x13, 0x94, 0x04, 0x92, 0xF5, 0x43, 0x3D, 0x22, 0x57,
+    0xBA, 0x42, 0x44, 0x9C, 0x54, 0xB9, 0x3C, 0xE2, 0xC9, 0x46, 0x0B, 0xD9, 0x8D, 0x00, 0xFA, 0x6A,
+    0x07, 0xA6, 0xA9, 0x60, 0x7B, 0x84, 0xF4, 0x66, 0x0F, 0xFA, 0xC7, 0x1D, 0x98, 0xC7, 0x1D, 0x49,
+    0x30, 0x35, 0xBA, 0x6B, 0x2A, 0x1A, 0x9A, 0xCB, 0x5B, 0x3D, 0x8D, 0x48, 0xC5, 0x96, 0x74, 0x90,
+    0x1C, 0x23, 0xF6, 0x1B, 0x25, 0xF5, 0x11, 0x4A, 0xB9, 0xE2, 0xE9, 0xAD, 0x54, 0x59, 0x5D, 0xF4,
+    0xB1, 0x96, 0xF1, 0xB5, 0xAA, 0xC0, 0x4A, 0x47, 0x2E, 0xD2, 0xD3, 0x5C, 0xDE, 0xEA, 0xB3, 0x01,
+    0xED, 0x8D, 0x8B, 0x63, 0xBA, 0x7C, 0xD9, 0x83, 0xB1, 0x75, 0x5C, 0xC3, 0xD5, 0xCD, 0xA5, 0xCF,
+    0x9A, 0xA6, 0x86, 0x69, 0x1B, 0xD4, 0x7B, 0x01, 0xF4, 0x85, 0x1E, 0x9A, 0xDC, 0xA3, 0x06, 0xDD,
+    0x61, 0x5C, 0x71, 0xFD, 0xB1, 0x40, 0x21, 0xD2, 0x92, 0xCB, 0x30, 0xB3, 0x78, 0xBC, 0x08, 0x64,
+    0xC3, 0x32, 0x27, 0x99, 0xFA, 0x16, 0x36, 0xF0, 0xC0, 0x7A, 0xBD, 0x7E, 0xDE, 0x88, 0xC8, 0x20,
+    0x22, 0xD2, 0xDD, 0xB2, 0x0C, 0xA5, 0x7E, 0xB9, 0xD0, 0xD6, 0x8B, 0x26, 0x68, 0xA3, 0x68, 0xDB,
+    0x77, 0x2C, 0x27, 0x93, 0xE9, 0x14, 0x8D, 0x88, 0xCF, 0xA7, 0x47, 0xA5, 0xB2, 0x75, 0x2A, 0x2A,
+    0x50, 0x4C, 0x85, 0x63, 0x0A, 0x0D, 0xF9, 0x9B, 0xEF, 0x0E, 0x58, 0xFD, 0x46, 0xA7, 0xBC, 0x69,
+    0x2A, 0x53, 0x4D, 0x63, 0x3A, 0xA8, 0x9B, 0x43, 0xE1, 0xF4, 0x3B, 0x5D, 0xC0, 0x6C, 0xBD, 0xDC,
+    0x31, 0x9A, 0x86, 0xDC, 0x8B, 0xC7, 0xD4, 0x52, 0xA9, 0x90, 0xCA, 0x33, 0x4D, 0x5B, 0x88, 0x8C,
+    0x8C, 0x8D, 0xD4, 0x49, 0xBB, 0x6F, 0x33, 0xD8, 0xD2, 0x33, 0x40, 0xDE, 0x13, 0xF9, 0x81, 0xD8,
+    0x90, 0x8D, 0x4E, 0x63, 0xA7, 0x52, 0x91, 0x2D, 0x89, 0x1C, 0x90, 0x1A, 0x4C, 0x1D, 0xF9, 0xA2,
+    0xDC, 0xEB, 0x16, 0xDD, 0xE6, 0x5D, 0x64, 0x9C, 0x4C, 0xAD, 0x7A, 0x4C, 0x95, 0x06, 0x1A, 0x08,
+    0x4C, 0xB0, 0x4D, 0x00, 0x9B, 0x0E, 0x60, 0x1E, 0xEA, 0xA1, 0xFC, 0x9E, 0x07, 0xFD, 0x72, 0x07,
+    0xF9, 0x1B, 0x0E, 0xB2, 0xAB, 0x2E, 0xAE, 0x5E, 0x24, 0xB2, 0xB0, 0x54, 0x4B, 0x2F, 0x9A, 0xE7,
+    0xF9, 0xCC, 0x2F, 0x35, 0x2B, 0x1D, 0xFC, 0xBD, 0x54, 0x33, 0x5F, 0x68, 0x3B, 0xE0, 0x5F, 0x7D,
+    0x08, 0xC9, 0x77, 0x64, 0x85, 0x7E, 0x45, 0x26, 0xC6, 0x46, 0x82, 0x96, 0xD7, 0xAC, 0x97, 0x16,
+    0xFB, 0xF4, 0x40, 0x1A, 0x04, 0xF4, 0x1B, 0x1E, 0xA6, 0x09, 0x72, 0xE9, 0xE2, 0xAC, 0x95, 0x49,
+    0x0B, 0x76, 0x82, 0x4C, 0x3A, 0x68, 0x04, 0xF4, 0x55, 0x0F, 0xA3, 0xD4, 0x94, 0x97, 0x46, 0xF2,
+    0x41, 0xA6, 0xC7, 0x44, 0xFF, 0x58, 0xC4, 0x8D, 0x85, 0x74, 0xBA, 0xDD, 0x57, 0x7D, 0x38, 0x01,
+    0xFC, 0x10, 0xC7, 0xE0, 0x54, 0x32, 0x40, 0x93, 0x86, 0xF9, 0x68, 0xB7, 0x2A, 0xED, 0xD3, 0x4A,
+    0x63, 0xF6, 0xAD, 0x56, 0x15, 0xE4, 0x22, 0xED, 0xB2, 0x4D, 0x56, 0xAB, 0xEA, 0x1F, 0x9B, 0xC4,
+    0xB1, 0x5A, 0x1D, 0xC7, 0x88, 0xA0, 0x45, 0x5C, 0xB2, 0x5A, 0xCD, 0xFD, 0xFA, 0x70, 0x45, 0x26,
+    0x52, 0x69, 0x91, 0x21, 0xBD, 0xFE, 0xCF, 0x85, 0x2F, 0xA2, 0xBB, 0x59, 0x05, 0x6D, 0x59, 0xB8,
+    0xE5, 0xE4, 0xAC, 0x84, 0x4C, 0x44, 0xF2, 0xE9, 0x99, 0xE2, 0xE5, 0x81, 0xEC, 0xDD, 0x81, 0x24,
+    0x8C, 0x60, 0x2D, 0x94, 0x97, 0x5A, 0xF4, 0xBB, 0x81, 0x22, 0x34, 0xAF, 0xD9, 0x46, 0x8B, 0xFC,
+    0x85, 0x6B, 0xE4, 0xEB, 0x9E, 0xE3, 0x40, 0x4E, 0xD2, 0x41, 0x5E, 0xAB, 0x0E, 0xB2, 0xCB, 0x5B,
+    0x0E, 0xE2, 0x02, 0x38, 0x0B, 0x36, 0xC9, 0x3F, 0x3E, 0xB1, 0xAD, 0xE3, 0x2B, 0x1C, 0x41, 0x93,
+    0x5F, 0xDE, 0xAA, 0x11, 0x71, 0xE4, 0x52, 0xB3, 0x99, 0x7D, 0x3F, 0xE1, 0x65, 0xFB, 0xD3, 0x2F,
+    0xD4, 0x02, 0x3D, 0x1B, 0x86, 0x34, 0x8F, 0xA2, 0x5E, 0x4D, 0xD4, 0xC9, 0xCC, 0xDD, 0x09, 0xB4,
+    0x40, 0xD4, 0x1D, 0xCC, 0x2B, 0x16, 0x64, 0x22, 0x95, 0x12, 0x99, 0x28, 0xFF, 0x72, 0xCB, 0x53,
+    0x63, 0xEA, 0xB9, 0x13, 0x16, 0x6E, 0xA6, 0x5B, 0xE1, 0x92, 0xB3, 0x12, 0x12, 0x11, 0x71, 0xCD,
+    0xCF, 0xFE, 0x38, 0x94, 0x1D, 0xC5, 0x85, 0x21, 0xB6, 0xB4, 0xB8, 0xE8, 0x49, 0x83, 0xA9, 0x30,
+    0x17, 0x02, 0x45, 0x28, 0xDF, 0x7B, 0xFC, 0xAA, 0x13, 0x19, 0xCE, 0xA5, 0x32, 0xE6, 0x8E, 0xE3,
+    0x0C, 0xB3, 0x46, 0x3A, 0x77, 0xF3, 0xA4, 0xAE, 0xAB, 0xF9, 0xA6, 0x5A, 0x00, 0xE3, 0xE7, 0x7A,
+    0xDC, 0xFD, 0xEC, 0x42, 0xDE, 0xAC, 0x5F, 0x78, 0x57, 0xD5, 0x13, 0xCD, 0x4C, 0xDC, 0x3A, 0x53,
+    0x7D, 0x5E, 0xAE, 0x43, 0x23, 0xF1, 0x71, 0x87, 0x44, 0x5A, 0xFE, 0x3B, 0xA4, 0x06, 0x9A, 0x7A,
+    0x59, 0x45, 0x4A, 0xB7, 0x4C, 0x2B, 0x59, 0xBF, 0xCC, 0x37, 0x91, 0x51, 0x28, 0x1D, 0x51, 0x2B,
+    0x12, 0x5B, 0xB9, 0xAB, 0x30, 0xEB, 0x37, 0xB4, 0x34, 0x6E, 0x59, 0x98, 0x90, 0xCD, 0x33, 0x4F,
+    0xA5, 0x66, 0x1F, 0xA5, 0xAC, 0xA5, 0x4A, 0x25, 0xAE, 0xC8, 0xD2, 0xC1, 0xBE, 0xE3, 0x00, 0x07,
+    0x9E, 0x05, 0x5B, 0xA3, 0x06, 0x28, 0x5D, 0x14, 0x7B, 0xEB, 0x8D, 0x60, 0x90, 0xAC, 0x48, 0x44,
+    0xDA, 0x52, 0xE4, 0xEB, 0xF2, 0xCC, 0xB9, 0xA2, 0x03, 0x89, 0x3F, 0x57, 0x3A, 0x98, 0x66, 0xE9,
+    0xB8, 0x8D, 0xDC, 0xFA, 0xFC, 0x31, 0xF7, 0xD1, 0x08, 0x65, 0x1C, 0x58, 0x47, 0xD5, 0xFC, 0xEC,
+    0x6C, 0xD5, 0xC8, 0xC8, 0x96, 0x74, 0x91, 0x1D, 0x39, 0xF0, 0x2C, 0x90, 0x4D, 0x80, 0x92, 0x0E,
+    0xD4, 0xF5, 0x11, 0x54, 0xAF, 0x5B, 0xD2, 0x9E, 0x11, 0x8E, 0xB1, 0xEF, 0xD3, 0x4E, 0xB3, 0xF4,
+    0x39, 0x30, 0x9E, 0x54, 0x3C, 0xE5, 0xCB, 0x5D, 0x12, 0xF2, 0xAE, 0xA8, 0xB3, 0xEE, 0x20, 0x49,
+    0xF5, 0x49, 0xD1, 0x2C, 0xA9, 0xF7, 0xB6, 0xAB, 0x70, 0x4B, 0xE1, 0xAD, 0xAF, 0x2D, 0x79, 0x8B,
+    0x54, 0x22, 0xFF, 0x2D, 0x3E, 0x93, 0x2A, 0x79, 0x51, 0x4D, 0x40, 0xBA, 0x33, 0xDE, 0xA2, 0xAC,
+    0x5D, 0x2F, 0xC6, 0xC2, 0xEC, 0x4E, 0xE4, 0xB9, 0x95, 0x66, 0x45, 0xBB, 0x91, 0x21, 0x05, 0xA2,
+    0x66, 0x2E, 0x72, 0xCA, 0xD8, 0x16, 0xC8, 0x27, 0x38, 0x44, 0x33, 0x7D, 0x7F, 0x24, 0x17, 0x91,
+    0x8A, 0x52, 0xA4, 0x86, 0xC3, 0xC7, 0x20, 0x39, 0x3D, 0xB7, 0xB7, 0x8E, 0x4B, 0xE8, 0xE9, 0x3D,
+    0x7C, 0xA7, 0x95, 0x3E, 0x17, 0x69, 0x9B, 0xCB, 0x5B, 0xD9, 0x00, 0xC6, 0x91, 0x8C, 0xF1, 0xD7,
+    0x4D, 0x1D, 0xC9, 0xD3, 0xEF, 0x5C, 0x3D, 0xC5, 0x2A, 0x65, 0xFD, 0xAC, 0x0E, 0xF4, 0x1C, 0x2C,
+    0x6F, 0xFC, 0x69, 0x5B, 0x8A, 0x54, 0x9F, 0x97, 0x01, 0x8E, 0xC3, 0x81, 0x8A, 0xE7, 0x48, 0x86,
+    0x24, 0x40, 0xF1, 0xC3, 0xB0, 0xE8, 0x17, 0xCA, 0x00, 0xA8, 0x11, 0xE0, 0xF0, 0xA7, 0x7D, 0x44,
+    0xEE, 0xAF, 0x39, 0xA3, 0x5B, 0xDD, 0xEA, 0x76, 0x44, 0x5F, 0x6D, 0x29, 0x26, 0x28, 0xFD, 0xA6,
+    0xE2, 0x9F, 0x40, 0xEF, 0x3A, 0xC3, 0x81, 0x1A, 0x02, 0x01, 0x18, 0x0B, 0x07, 0xC9, 0x34, 0x32,
+    0x8B, 0x2C, 0x73, 0xBF, 0x49, 0x8E, 0xED, 0x55, 0x08, 0x89, 0xFC, 0x2C, 0x2A, 0x84, 0x5A, 0x0A,
+    0x11, 0xE9, 0xB1, 0xEC, 0x6B, 0xFA, 0x24, 0x40, 0xD9, 0x67, 0x1E, 0x0A, 0x5F, 0x38, 0x28, 0x3A,
+    0x0B, 0x94, 0x2F, 0x05, 0xC0, 0x3E, 0xEC, 0x81, 0xA9, 0x70, 0xCB, 0x0A, 0x90, 0xFF, 0x3C, 0x30,
+    0x9B, 0x83, 0xB1, 0xB7, 0x16, 0x97, 0x17, 0x37, 0x67, 0x67, 0xBD, 0x05, 0xCC, 0x4B, 0x01, 0x92,
+    0x69, 0x73, 0xEF, 0x54, 0x2A, 0x4B, 0xD2, 0xF4, 0x89, 0x88, 0x48, 0x95, 0x89, 0x48, 0x47, 0x11,
+    0x55, 0x70, 0x90, 0x9E, 0xFE, 0x16, 0x90, 0xF9, 0x6D, 0x20, 0xF3, 0x61, 0x67, 0xFB, 0xF3, 0x1E,
+    0xC8, 0x7E, 0xD1, 0x01, 0xD9, 0xCF, 0xEB, 0xB9, 0xEF, 0xEF, 0x3B, 0x96, 0x79, 0x68, 0xE4, 0x61,
+    0x8F, 0x12, 0xB9, 0xE2, 0xD1, 0xE3, 0xA3, 0xE2, 0x29, 0x3B, 0xAC, 0xC7, 0xD4, 0x94, 0x1E, 0x0B,
+    0xDA, 0xD3, 0x80, 0xF6, 0x4C, 0x90, 0x7B, 0x26, 0xC8, 0x3C, 0xE3, 0xAE, 0xED, 0xB4, 0x6C, 0x73,
+    0x4F, 0x03, 0xF9, 0x72, 0x95, 0xA9, 0x29, 0x96, 0xBB, 0xE9, 0xE9, 0xB1, 0x9B, 0x1E, 0x25, 0xF2,
+    0xAA, 0x07, 0x2B, 0x0F, 0xF9, 0x99, 0xB2, 0xFF, 0x88, 0x94, 0x87, 0xA4, 0xA7, 0x37, 0x83, 0xC0,
+    0xCE, 0xFD, 0x3D, 0x8B, 0xE6, 0x42, 0x91, 0x8E, 0xC3, 0xAB, 0xE6, 0x58, 0x9C, 0x9F, 0x92, 0x63,
+    0x99, 0xA7, 0x90, 0x57, 0x02, 0x46, 0x26, 0x8B, 0xB9, 0xBE, 0x75, 0xD5, 0x95, 0x1D, 0xD6, 0x6B,
+    0x4F, 0x1E, 0xB2, 0x1E, 0x24, 0x0D, 0x60, 0xDC, 0x04, 0xB9, 0x37, 0xF5, 0xAC, 0x45, 0xB2, 0x6A,
+    0x80, 0xC2, 0x4D, 0x90, 0x79, 0x53, 0x93, 0x86, 0xDC, 0x43, 0x93, 0x04, 0x30, 0xCE, 0xD4, 0x14,
+    0x3E, 0x1F, 0x28, 0x02, 0x72, 0xB9, 0x69, 0xD0, 0x22, 0x8F, 0xB8, 0x99, 0x8E, 0xC7, 0x81, 0x64,
+    0xB5, 0x3A, 0xA6, 0x44, 0xBC, 0x12, 0xF1, 0x3B, 0xEC, 0x2A, 0x58, 0x91, 0xD1, 0x8A, 0x4C, 0x56,
+    0x64, 0xB2, 0xBB, 0xFC, 0x39, 0xEE, 0xF8, 0x5E, 0xAD, 0x8E, 0x5B, 0x91, 0x60, 0x45, 0x82, 0x5D,
+    0xAD, 0x8E, 0xFF, 0xCA, 0xF3, 0xE3, 0xFD, 0xA7, 0xE5, 0x9D, 0xAC, 0x56, 0xC7, 0x30, 0x22, 0x28,
+    0x11, 0xCF, 0xE1, 0xD5, 0x8A, 0x0D, 0xD3, 0x8C, 0x95, 0x96, 0x52, 0xA4, 0xCA, 0xC7, 0xDF, 0x1B,
+    0x93, 0x31, 0xB6, 0xDA, 0x7C, 0xCF, 0x93, 0x86, 0x06, 0x8A, 0x97, 0x3B, 0x92, 0x20, 0x22, 0x72,
+    0x49, 0x44, 0x82, 0xAC, 0xD7, 0xEB, 0xA7, 0xBB, 0x79, 0x12, 0xC9, 0x3D, 0x44, 0xBD, 0x46, 0x00,
+    0x0A, 0x4F, 0x52, 0xD9, 0xEB, 0x7F, 0xDA, 0x27, 0x22, 0x52, 0xA5, 0x22, 0xA7, 0x23, 0x3F, 0x54,
+    0xF3, 0x82, 0x72, 0x89, 0x57, 0xD7, 0x1F, 0xEB, 0x10, 0x71, 0x98, 0x09, 0x76, 0xF4, 0x43, 0xBF,
+    0x55, 0x2A, 0xA8, 0x9A, 0x6F, 0xF3, 0x00, 0xBA, 0x4A, 0xAF, 0x3F, 0xE6, 0xD1, 0x12, 0xA0, 0x9C,
+    0xD8, 0xE1, 0x7A, 0x7F, 0x0B, 0xE4, 0x20, 0x39, 0x1D, 0xC7, 0x77, 0xD6, 0xCF, 0x4A, 0xA7, 0xD3,
+    0x7B, 0xE6, 0xB0, 0xDF, 0x26, 0x39, 0xE2, 0xA2, 0x67, 0xAA, 0x79, 0x09, 0x35, 0xD5, 0xDE, 0x65,
+    0xF0, 0xB7, 0x41, 0x8E, 0xDF, 0x6E, 0x73, 0x53, 0x0F, 0x99, 0x8B, 0x5C, 0x73, 0xB9, 0x38, 0x0C,
+    0x55, 0x51, 0x25, 0x9C, 0x8F, 0x1B, 0xC1, 0x27, 0x93, 0x91, 0x54, 0xA4, 0xA7, 0x79, 0xC5, 0xB6,
+    0x45, 0x4B, 0xA3, 0x06, 0xD4, 0x60, 0xA3, 0xCA, 0x29, 0x09, 0xDB, 0x50, 0x5C, 0x5A, 0xBC, 0x98,
+    0x2E, 0xDD, 0x58, 0xAF, 0xCF, 0x4C, 0xCB, 0x52, 0xDC, 0x2C, 0x8B, 0xAC, 0x71, 0x51, 0x46, 0x3F,
+    0x94, 0xC9, 0x5F, 0x35, 0x55, 0x21, 0xD2, 0x53, 0xCA, 0x04, 0xFB, 0x1E, 0xAF, 0x67, 0x99, 0xE2,
+    0xC4, 0x22, 0x50, 0x0C, 0x8B, 0x34, 0xD1, 0xF8, 0x8D, 0x28, 0x71, 0xA0, 0xE6, 0x4C, 0xE6, 0x33,
+    0x9F, 0x84, 0xC2, 0x61, 0x1B, 0x28, 0x47, 0xD0, 0xC3, 0x9E, 0x15, 0xEF, 0xB7, 0x49, 0xBA, 0xFD,
+    0x35, 0x67, 0x30, 0x95, 0xA9, 0x18, 0x75, 0x1B, 0x75, 0x6D, 0xC5, 0x44, 0xF4, 0x35, 0xDA, 0x54,
+    0xE9, 0x93, 0x24, 0xDD, 0xF5, 0x68, 0x44, 0x89, 0x1A, 0x2E, 0x8A, 0xC8, 0xF1, 0xF5, 0x80, 0x7E,
+    0xBD, 0x07, 0x46, 0xE5, 0x41, 0xB7, 0xCA, 0xC3, 0xA1, 0x99, 0xDF, 0xDD, 0x6D, 0x26, 0x7A, 0x2B,
+    0x5A, 0xF3, 0x66, 0x2B, 0x91, 0xBC, 0x45, 0xE6, 0x74, 0x64, 0x8D, 0xEA, 0x0D, 0xBF, 0x58, 0xBA,
+    0x0D, 0x6F, 0x14, 0xD9, 0xA4, 0xC2, 0x6D, 0x98, 0xA7, 0xC8, 0x47, 0xE5, 0x9E, 0x54, 0xE4, 0xAC,
+    0x23, 0x97, 0xA9, 0x81, 0x52, 0x6E, 0x04, 0x40, 0x5F, 0xE9, 0x01, 0x13, 0xBB, 0xBD, 0x71, 0xA0,
+    0x06, 0x5B, 0x81, 0xEE, 0xA4, 0x02, 0xF3, 0x1D, 0xA9, 0x60, 0x4A, 0xA5, 0x46, 0x0D, 0xA9, 0xDC,
+    0x58, 0x4B, 0x17, 0xAD, 0x35, 0x6C, 0x89, 0xBC, 0x05, 0xC9, 0x6A, 0x69, 0x93, 0xED, 0xA2, 0xB3,
+    0x97, 0x7A, 0x6F, 0x84, 0x31, 0xF3, 0x18, 0xB4, 0x4B, 0xAA, 0x45, 0xE2, 0xD9, 0x77, 0x0C, 0x72,
+    0xE9, 0x8D, 0x12, 0x79, 0xD3, 0xCB, 0x6B, 0xB6, 0x29, 0x3A, 0xEC, 0xBB, 0x03, 0xA9, 0x58, 0xD0,
+    0x37, 0x3D, 0x34, 0xEF, 0xAF, 0xF8, 0xB2, 0xCD, 0x6C, 0x76, 0x10, 0x53, 0x53, 0xFC, 0x7C, 0x22,
+    0x13, 0x3D, 0x7E, 0x43, 0xBC, 0x91, 0xC9, 0x62, 0xE5, 0x61, 0xCF, 0xE1, 0x1D, 0x1B, 0xC3, 0xF6,
+    0xAC, 0xE5, 0x4A, 0xC3, 0x17, 0x2A, 0x9A, 0xEF, 0xC8, 0x4D, 0xF1, 0x85, 0xC8, 0xC0, 0xE7, 0x65,
+    0x80, 0xA4, 0xE5, 0x6B, 0x90, 0xB9, 0xD4, 0x83, 0xBE, 0xDC, 0x54, 0x50, 0xC8, 0xC0, 0x6C, 0x27,
+    0xB8, 0x95, 0xF0, 0xB0, 0x25, 0xD7, 0xA3, 0x5D, 0xD5, 0xA5, 0x22, 0x32, 0x61, 0xAE, 0x93, 0xF8,
+    0xD8, 0xC5, 0xCB, 0x6E, 0xC3, 0x7A, 0xE6, 0x7E, 0xC3, 0xF9, 0x27, 0x23, 0x4B, 0x3D, 0xE6, 0x07,
+    0xB2, 0xA1, 0x7F, 0x23, 0xEF, 0xEC, 0xA5, 0x7F, 0x14, 0xD1, 0xD0, 0x6F, 0x0E, 0x80, 0x79, 0xDA,
+    0x2F, 0xA6, 0x5A, 0x35, 0x98, 0x16, 0x74, 0x67, 0x5B, 0x30, 0x75, 0xD3, 0xC1, 0x44, 0x33, 0xAD,
+    0x9B, 0x01, 0x2B, 0x22, 0x1D, 0x9F, 0x17, 0xB9, 0x1E, 0x99, 0xFC, 0xB4, 0xE5, 0x6B, 0xDC, 0x4F,
+    0x5E, 0x33, 0x3D, 0xD6, 0x47, 0x55, 0x79, 0x21, 0x15, 0x3B, 0x92, 0xDE, 0x0A, 0x68, 0xE4, 0x21,
+    0x6F, 0x64, 0x32, 0x7A, 0xFC, 0xC6, 0xCD, 0x9F, 0x4F, 0x64, 0x62, 0x6A, 0xCA, 0x6B, 0x1E, 0xA4,
+    0x99, 0x09, 0xDE, 0x4C, 0x0B, 0xC1, 0xC7, 0x85, 0xE0, 0x13, 0x64, 0x37, 0x3D, 0x34, 0x16, 0xF4,
+    0xBB, 0x03, 0x89, 0x14, 0x1D, 0xD6, 0xCB, 0x6B, 0x56, 0x94, 0xC8, 0x15, 0x9F, 0x49, 0x6F, 0x23,
+    0x2B, 0x12, 0xC7, 0x5A, 0xDE, 0xCD, 0x8A, 0xBC, 0xF2, 0xA5, 0xB7, 0xC8, 0x87, 0x42, 0x1A, 0x49,
+    0x44, 0xA4, 0x4E, 0x1A, 0xA9, 0x01, 0xBE, 0xB9, 0x43, 0xA7, 0x48, 0x96, 0x68, 0x09, 0xFA, 0x26,
+    0xDC, 0x51, 0xD6, 0xFA, 0x54, 0x53, 0x1D, 0x9E, 0x9D, 0x7F, 0x47, 0x85, 0xE5, 0x07, 0xF7, 0x34,
+    0xE4, 0x53, 0x43, 0xF5, 0x7F, 0x14, 0xB3, 0xC7, 0x62, 0xA3, 0x38, 0xBD, 0x78, 0xC0, 0xCE, 0xFE,
+    0xB7, 0x59, 0xCB, 0xE2, 0xBE, 0x88, 0xDF, 0xD1, 0x51, 0xFE, 0x01, 0xA0, 0xDA, 0xD9, 0xAF, 0x45,
+    0xD7, 0xD1, 0x21, 0x09, 0xB3, 0x5B, 0x98, 0xFA, 0x94, 0xCC, 0x35, 0xDC, 0x5B, 0x33, 0x2F, 0xCB,
+    0x89, 0x78, 0xC0, 0x6E, 0x39, 0xD0, 0xCE, 0x82, 0xF2, 0x49, 0xB8, 0x6D, 0xA6, 0x8F, 0x7A, 0x49,
+    0xBB, 0x48, 0x6F, 0xC9, 0x47, 0x3B, 0x5C, 0xAD, 0x56, 0x5B, 0x17, 0x45, 0xE2, 0x1A, 0x29, 0x72,
+    0xF1, 0xC6, 0x7A, 0xBD, 0xFE, 0xD8, 0x37, 0xDB, 0x39, 0x8C, 0x8D, 0x48, 0x25, 0x3A, 0x88, 0x02,
+    0x49, 0x68, 0x98, 0x5B, 0x41, 0xC0, 0xC2, 0xCE, 0x1C, 0x0F, 0xDC, 0xCD, 0xC6, 0x99, 0x38, 0xDA,
+    0x9B, 0xA3, 0xBD, 0xC1, 0x54, 0xEF, 0x53, 0x7C, 0xB8, 0x82, 0xB1, 0x90, 0x1E, 0xF5, 0x4B, 0x91,
+    0x1E, 0x7D, 0xF5, 0xF2, 0x96, 0xC7, 0xF4, 0x14, 0x1D, 0x52, 0x53, 0x3A, 0x15, 0xC0, 0xA2, 0x3D,
+    0x04, 0x4C, 0x8D, 0xF2, 0xD1, 0x8F, 0x44, 0xF5, 0x60, 0xA2, 0x2B, 0x23, 0xA6, 0x42, 0x79, 0xC6,
+    0x8F, 0x52, 0x9C, 0x04, 0x16, 0x7D, 0x2B, 0xF6, 0x96, 0xDD, 0xA3, 0xE3, 0x6A, 0xB5, 0xB2, 0xC7,
+    0x65, 0xCF, 0xEB, 0xD1, 0x71, 0xB5, 0x5A, 0x35, 0xAB, 0x3B, 0x5E, 0x90, 0x8C, 0xAB, 0xD5, 0xAA,
+    0x89, 0xDA, 0x5A, 0xD9, 0xEC, 0xA6, 0xF5, 0x7A, 0xDD, 0xDC, 0xF9, 0x17, 0x7E, 0xDD, 0xDD, 0xB3,
+    0xB7, 0xF8, 0x6B, 0x77, 0xCC, 0xAA, 0x96, 0x52, 0x64, 0x24, 0xB1, 0xCF, 0xAC, 0xF6, 0xBA, 0x7B,
+    0x27, 0xEB, 0x0A, 0xF3, 0x47, 0x32, 0xA1, 0xDF, 0x10, 0xE9, 0x94, 0xBC, 0x95, 0x8D, 0x88, 0xC3,
+    0xD4, 0xA6, 0x25, 0xF7, 0xDA, 0x43, 0x50, 0x03, 0x98, 0x48, 0x5A, 0x53, 0xA3, 0xBC, 0x6E, 0x21,
+    0x44, 0xB2, 0x8D, 0xA0, 0x9D, 0xA9, 0x3E, 0x44, 0x61, 0x72, 0x9A, 0x6F, 0x9A, 0x41, 0xFD, 0x50,
+    0x26, 0xAB, 0x1F, 0x96, 0xFE, 0xC9, 0x44, 0xAA, 0x5D, 0xDD, 0x3B, 0x13, 0xA1, 0x94, 0xC0, 0xE7,
+    0xE5, 0x34, 0xD9, 0xEC, 0x74, 0x36, 0xFB, 0x8A, 0xFF, 0xBA, 0x1F, 0xB7, 0xDE, 0xA2, 0x90, 0x40,
+    0x23, 0x1E, 0x8E, 0xF3, 0xA5, 0x62, 0x4C, 0x3B, 0x99, 0xB6, 0xF2, 0xEF, 0xCA, 0x70, 0x84, 0xA6,
+    0xDE, 0xAD, 0x62, 0x59, 0x34, 0x38, 0xE3, 0x2E, 0x05, 0xD8, 0xC7, 0xFB, 0x78, 0x78, 0xB5, 0x32,
+    0x22, 0x46, 0x64, 0x23, 0x8A, 0x16, 0x12, 0x4A, 0x09, 0xFB, 0xE5, 0x2D, 0x2C, 0xBF, 0xCE, 0x7F,
+    0xD2, 0x9C, 0x8E, 0xB7, 0x5A, 0xAD, 0x8E, 0x8B, 0x8C, 0x22, 0xE3, 0xE1, 0x8D, 0xAF, 0xF6, 0xF8,
+    0xF1, 0xFF, 0xBF, 0x4D, 0x5E, 0x90, 0x5D, 0xB8, 0xFE, 0x58, 0x67, 0xC5, 0x67, 0xD2, 0xED, 0x98,
+    0x7C, 0x0A, 0x09, 0xB9, 0x08, 0x5B, 0x53, 0x95, 0x04, 0xB0, 0x50, 0x38, 0x32, 0xCF, 0xC7, 0xFC,
+    0x90, 0x34, 0xA7, 0x33, 0x91, 0x54, 0xC4, 0x7D, 0x85, 0xEC, 0x91, 0x4A, 0xBD, 0x72, 0xFD, 0x31,
+    0x6F, 0xA4, 0x4F, 0xC5, 0xEF, 0x32, 0x32, 0x99, 0x0A, 0xDD, 0xA2, 0x7A, 0x18, 0x3F, 0xD6, 0x07,
+    0x2B, 0xBF, 0x10, 0x79, 0xA9, 0xB9, 0x1E, 0x47, 0x45, 0xE6, 0x29, 0xDC, 0x47, 0x3C, 0xDC, 0x3F,
+    0x3D, 0x28, 0xF2, 0xB2, 0x08, 0xAA, 0xA3, 0x24, 0xF1, 0x68, 0xC7, 0x51, 0x08, 0xA4, 0xE2, 0x52,
+    0x01, 0xD2, 0xDA, 0xD4, 0xA2, 0x86, 0xB4, 0x9A, 0x3B, 0x8E, 0xA9, 0x46, 0xD5, 0x7F, 0xD0, 0x2E,
+    0xAF, 0xCF, 0x65, 0xCE, 0x30, 0x28, 0x9F, 0x4B, 0x1E, 0x80, 0x3F, 0x21, 0xF3, 0x94, 0x2D, 0x76,
+    0x37, 0x7B, 0xF0, 0x1B, 0xAC, 0x39, 0xE3, 0x1D, 0x5E, 0x56, 0x7C, 0xFA, 0x4B, 0x11, 0xA7, 0x7F,
+    0xD2, 0x5C, 0x8F, 0x5E, 0x44, 0x53, 0x12, 0x50, 0x43, 0xE6, 0xD1, 0x5D, 0xE1, 0x3E, 0x81, 0xA2,
+    0xFD, 0x53, 0xA5, 0xAE, 0x8B, 0x38, 0xFD, 0x8E, 0x48, 0x64, 0xC7, 0xA6, 0x4D, 0xD0, 0xCC, 0x2C,
+    0x09, 0xE9, 0xA8, 0x7F, 0xAB, 0x60, 0x71, 0x3E, 0x38, 0x40, 0x72, 0x7A, 0x42, 0xBF, 0x1A, 0xB0,
+    0x8F, 0x74, 0x84, 0xCF, 0xEE, 0xD5, 0x22, 0x98, 0x4A, 0xF9, 0x11, 0x7D, 0xA1, 0xC7, 0xE8, 0x96,
+    0xF0, 0xEB, 0x7C, 0x8C, 0x3A, 0x8A, 0xD9, 0x19, 0x98, 0x79, 0xC2, 0x30, 0x2E, 0x91, 0x91, 0x4C,
+    0x3A, 0xF4, 0x38, 0x5B, 0x6A, 0x3A, 0x94, 0xB4, 0x98, 0xC7, 0x5B, 0xD5, 0x17, 0xCE, 0xA0, 0xDD,
+    0x6E, 0x7B, 0x49, 0x51, 0xCF, 0xB6, 0xF0, 0xD9, 0x7D, 0xD6, 0x7D, 0x62, 0x1F, 0xA3, 0x2E, 0x5F,
+    0x7B, 0x44, 0x6A, 0x25, 0x03, 0xF9, 0x34, 0x4F, 0xA1, 0x07, 0x9E, 0x85, 0xA6, 0x25, 0x17, 0x87,
+    0x2D, 0x5D, 0xE6, 0x4B, 0x77, 0x94, 0x62, 0x4F, 0x25, 0x7F, 0x33, 0xF3, 0xDA, 0xFB, 0x7C, 0x4C,
+    0x03, 0x5A, 0x3A, 0x8C, 0x40, 0xD3, 0xC5, 0xC9, 0x77, 0x2C, 0xDC, 0xAC, 0x39, 0x9E, 0x92, 0x00,
+    0x82, 0x05, 0xA1, 0x70, 0x08, 0x99, 0xA7, 0x21, 0x09, 0x34, 0x60, 0x69, 0x2A, 0x0A, 0x67, 0x2B,
+    0x32, 0x6F, 0x2B, 0x92, 0x60, 0x6B, 0xB0, 0xA6, 0x83, 0x42, 0x46, 0xC8, 0xA4, 0x71, 0x24, 0xF2,
+    0x70, 0x00, 0x4B, 0x53, 0x53, 0x38, 0xDD, 0x93, 0x79, 0x84, 0x24, 0x50, 0x74, 0x58, 0xD2, 0x91,
+    0xC2, 0x61, 0x5C, 0xE6, 0x51, 0x21, 0x09, 0x60, 0x6B, 0x0B, 0x79, 0x5F, 0x38, 0x90, 0xCC, 0x2F,
+    0x46, 0xD8, 0x0D, 0x03, 0x52, 0x2F, 0x7C, 0x71, 0x74, 0xCE, 0x1E, 0x96, 0x90, 0x0C, 0x1E, 0x80,
+    0x28, 0x19, 0xFD, 0xAB, 0x99, 0x58, 0xBA, 0x9D, 0xBB, 0xE9, 0xF8, 0x3E, 0x05, 0xF6, 0xE9, 0x16,
+    0xFB, 0x54, 0x8F, 0xA9, 0x47, 0x4C, 0x6D, 0x2A, 0x53, 0xEB, 0xD6, 0x38, 0xD5, 0x1B, 0xC7, 0x68,
+    0x1C, 0x66, 0xCB, 0xA1, 0xAF, 0x0E, 0x28, 0x91, 0x1A, 0xF9, 0x8B, 0x1E, 0x53, 0x0B, 0xBA, 0xD5,
+    0x5E, 0xF5, 0xC9, 0xC4, 0x48, 0xD9, 0x9A, 0x4A, 0x05, 0xDD, 0x62, 0x2E, 0xF4, 0x64, 0xC3, 0x08,
+    0xCD, 0xCE, 0x7A, 0x78, 0x6F, 0x35, 0x5B, 0xF4, 0xBB, 0xD9, 0x01, 0x67, 0x00, 0x8E, 0xEC, 0x52,
+    0xE5, 0x99, 0x1A, 0xFB, 0x74, 0x87, 0x7D, 0x6A, 0xC0, 0xB8, 0x09, 0xE3, 0x4C, 0x6D, 0x9C, 0xEE,
+    0xCA, 0x56, 0x0D, 0x45, 0xCB, 0x54, 0x74, 0x98, 0xA7, 0x3B, 0xF4, 0xD5, 0x30, 0xFF, 0xFE, 0xEB,
+    0x3D, 0xA6, 0x6D, 0xD0, 0x9D, 0xF6, 0x6A, 0x48, 0x26, 0x26, 0xCA, 0xD6, 0xD4, 0x2A, 0xE8, 0x0E,
+    0x73, 0x61, 0x20, 0x1B, 0x26, 0x68, 0xAA, 0x64, 0x1D, 0x19, 0xFE, 0x6C, 0xD7, 0x93, 0x3E, 0x79,
+    0x8B, 0x41, 0xD5, 0x7E, 0xD2, 0xEF, 0xDD, 0x2A, 0xAD, 0x35, 0xB6, 0x36, 0xAE, 0x74, 0xDA, 0x69,
+    0x97, 0x54, 0xC0, 0xDD, 0xE8, 0x56, 0xF5, 0x8C, 0x98, 0xEA, 0xE3, 0x1D, 0xFC, 0x76, 0xEB, 0xBF,
+    0x11, 0xB3, 0x9E, 0x8B, 0x7D, 0x47, 0xF9, 0x28, 0xB9, 0xE4, 0xB3, 0x96, 0xEE, 0x2E, 0xB8, 0x5B,
+    0xF5, 0xE6, 0xA1, 0x0F, 0xF7, 0x5F, 0x01, 0x67, 0xF4, 0x4B, 0x43, 0xA9, 0xDA, 0x13, 0x09, 0x16,
+    0x4E, 0x59, 0x18, 0x6D, 0x14, 0x0B, 0x06, 0x4B, 0xE2, 0x2D, 0x69, 0xFB, 0x49, 0x34, 0xE4, 0x5F,
+    0xED, 0xFF, 0x9B, 0x76, 0x1C, 0xF5, 0xA5, 0x76, 0x18, 0x0B, 0xFD, 0xA3, 0x6E, 0x3C, 0xA4, 0x5B,
+    0x46, 0x3E, 0xFA, 0xE6, 0x23, 0x56, 0x62, 0x7F, 0x65, 0x29, 0x9C, 0xA5, 0x74, 0x71, 0xBF, 0xFF,
+    0xA3, 0x55, 0xFA, 0x03, 0x7A, 0xC2, 0x01, 0xF3, 0xC8, 0xD5, 0x57, 0x6F, 0xF6, 0xD3, 0xF8, 0xD9,
+    0x0F, 0xE8, 0x2D, 0x91, 0xA7, 0xCE, 0xFC, 0x22, 0xEF, 0x5A, 0x7E, 0x65, 0xD1, 0x93, 0x60, 0xB5,
+    0x27, 0x99, 0xA4, 0x8E, 0x02, 0x63, 0x31, 0xCE, 0xF2, 0x91, 0x0D, 0x80, 0x78, 0x48, 0x1E, 0xFF,
+    0xA0, 0x7B, 0xC9, 0xEC, 0x5D, 0xDB, 0x15, 0x22, 0x52, 0x73, 0x06, 0xC2, 0x07, 0xFF, 0x1F, 0x64,
+    0xEC, 0x91, 0x80, 0x74, 0xA9, 0x54, 0x3A, 0x60, 0x02, 0xF7, 0x87, 0x5F, 0x75, 0x15, 0x3C, 0x51,
+    0x2F, 0x2E, 0x14, 0xC9, 0x2D, 0xC1, 0x9D, 0xD1, 0x87, 0xE2, 0xAE, 0x3D, 0x3A, 0x97, 0x6C, 0x00,
+    0x8E, 0xDA, 0x16, 0xB2, 0x6B, 0x02, 0x58, 0x3B, 0x40, 0x76, 0x4D, 0x5A, 0xB0, 0xA7, 0x04, 0xB2,
+    0x6B, 0x57, 0x06, 0xB0, 0xA7, 0x4A, 0x47, 0x76, 0xAD, 0x13, 0xB0, 0xA7, 0xB2, 0x81, 0xEC, 0x5A,
+    0x57, 0x3A, 0xEC, 0x29, 0x84, 0xEC, 0x9A, 0xCF, 0x7A, 0xAC, 0xC5, 0xB8, 0xEC, 0x9A, 0x67, 0xC2,
+    0x5A, 0xB2, 0x3E, 0xBB, 0xE6, 0x31, 0xCE, 0x5A, 0x98, 0xD4, 0x35, 0x4F, 0xDE, 0x1B, 0x0B, 0xE6,
+    0xC2, 0x35, 0x4F, 0x32, 0x19, 0x0B, 0xF9, 0xB5, 0x6B, 0x1E, 0x8C, 0x58, 0x48, 0xE4, 0x9A, 0x87,
+    0x5C, 0x2C, 0x60, 0xAE, 0xF9, 0xC8, 0x39, 0x1C, 0x78, 0x76, 0x36, 0x95, 0x9A, 0x3A, 0x4A, 0x3A,
+    0xC9, 0xE2, 0x41, 0xB2, 0x23, 0x3A, 0xAF, 0xD0, 0x2F, 0x89, 0x54, 0xA1, 0x91, 0x51, 0x5F, 0x7D,
+    0x6D, 0x6B, 0x8F, 0x4B, 0x5D, 0x71, 0xC9, 0x43, 0x98, 0x40, 0x5F, 0xEA, 0x3E, 0x4E, 0xDC, 0x9B,
+    0xB3, 0x35, 0xA8, 0x2B, 0x23, 0x60, 0xAD, 0x87, 0xEC, 0x9A, 0xD4, 0x60, 0xED, 0x08, 0xD9, 0xB5,
+    0xAB, 0x1E, 0xEC, 0x29, 0x5B, 0x93, 0x5D, 0xFB, 0x69, 0x00, 0x7B, 0x4A, 0x7B, 0xB2, 0x6B, 0x9D,
+    0xAD, 0xB1, 0xA7, 0xD2, 0x40, 0x76, 0xAD, 0xD3, 0x1E, 0x6B, 0xB1, 0x55, 0x76, 0xCD, 0xAB, 0x80,
+    0xB5, 0xE8, 0x2E, 0xBB, 0xE6, 0xB1, 0x95, 0xB5, 0xA8, 0x90, 0x5D, 0xF3, 0xE8, 0xCE, 0x58, 0x68,
+    0x1E, 0xBA, 0xE6, 0x51, 0xC1, 0x58, 0x28, 0xDE, 0xBC, 0xE6, 0xA1, 0xB1, 0x16, 0x94, 0x5C, 0xF3,
+    0x50, 0x88, 0x05, 0x9A, 0x6B, 0x1E, 0x94, 0xD8, 0x68, 0x89, 0xD8, 0xFD, 0xFA, 0xD6, 0x8E, 0x3C,
+    0x1D, 0x88, 0xA1, 0x4B, 0xF3, 0x92, 0x12, 0x97, 0xBC, 0xE4, 0x93, 0x27, 0xD2, 0x2E, 0x2D, 0x4E,
+    0x3D, 0x3F, 0xA2, 0xB2, 0x9A, 0x57, 0xE0, 0x13, 0x40, 0x5E, 0xCF, 0x4B, 0xCC, 0x3F, 0x25, 0x3D,
+    0x3D, 0xBB, 0x11, 0x64, 0xBE, 0xD9, 0xC4, 0x2C, 0x34, 0x7E, 0xE3, 0x47, 0xB0, 0xAF, 0xFA, 0xD4,
+    0xF7, 0xCA, 0x03, 0x35, 0x67, 0x30, 0x18, 0x18, 0x8B, 0x96, 0xEC, 0x66, 0x3F, 0xBB, 0xE4, 0x37,
+    0xF5, 0x6E, 0xF3, 0xC6, 0x27, 0x4A, 0xF0, 0xF8, 0xB8, 0x6D, 0xB5, 0x31, 0x19, 0xCF, 0xCA, 0xD0,
+    0x6A, 0x47, 0x7B, 0xD6, 0xC1, 0x8A, 0xE2, 0xA1, 0xAE, 0x91, 0xFA, 0x9C, 0xBE, 0x24, 0xF2, 0x52,
+    0x65, 0xA6, 0x95, 0x38, 0xC4, 0xD1, 0x54, 0x2A, 0xC0, 0x84, 0xEE, 0x48, 0x07, 0x4C, 0x45, 0xEE,
+    0x09, 0x50, 0x3A, 0xE5, 0xA1, 0x41, 0x3B, 0xD2, 0x80, 0xE1, 0x63, 0x16, 0xFF, 0xEA, 0x11, 0x63,
+    0x6A, 0xB2, 0x6B, 0x3F, 0x1D, 0x77, 0x46, 0x8C, 0xA9, 0xB1, 0xA7, 0xD2, 0x71, 0x67, 0xC4, 0x98,
+    0x3A, 0xBB, 0xE6, 0x93, 0x11, 0x6B, 0xD1, 0x3E, 0xBB, 0xE6, 0x31, 0xB5, 0xB5, 0x24, 0x63, 0x76,
+    0xCD, 0x93, 0x7B, 0x63, 0xC1, 0x3C, 0x75, 0xCD, 0x93, 0x8C, 0xC6, 0x42, 0xFE, 0xEE, 0x07, 0x3D,
+    0x2D, 0xBB, 0xA1, 0x8E, 0x5D, 0xE8, 0x32, 0xEB, 0x39, 0x4B, 0x07, 0x5A, 0x06, 0x40, 0x26, 0x40,
+    0x4F, 0xB7, 0xCD, 0x28, 0x56, 0x26, 0x7D, 0xF5, 0xF2, 0x56, 0xFF, 0x9B, 0x1E, 0x2C, 0x81, 0x5B,
+    0x0E, 0x92, 0xD9, 0xA9, 0x5E, 0x49, 0x0F, 0x66, 0x8A, 0x0B, 0xCA, 0x6C, 0x6A, 0x17, 0x09, 0x31,
+    0xA8, 0x6B, 0xE3, 0xFE, 0x7A, 0xBB, 0xA7, 0x0D, 0x56, 0xA4, 0x8F, 0xF8, 0x04, 0x35, 0x4D, 0x47,
+    0x11, 0x88, 0x31, 0x3D, 0xC6, 0x81, 0xF6, 0x45, 0x0B, 0x4C, 0xDA, 0x03, 0xE5, 0x85, 0x01, 0xC8,
+    0xDE, 0x1B, 0x01, 0xA6, 0xE8, 0xB2, 0xF4, 0x7E, 0x71, 0x43, 0xBB, 0x03, 0x8A, 0xD4, 0x18, 0x00,
+    0x26, 0x53, 0x01, 0xE6, 0x11, 0x0F, 0x94, 0x3F, 0x8C, 0xB1, 0x49, 0xC6, 0x41, 0xDE, 0xC7, 0xA0,
+    0x25, 0x9A, 0x96, 0x22, 0x90, 0xCB, 0xDB, 0x4D, 0x00, 0x2B, 0x32, 0x40, 0x32, 0xBB, 0x9C, 0xAF,
+    0x00, 0x56, 0xAB, 0xE3, 0xD1, 0x84, 0xAF, 0x45, 0xDC, 0x2E, 0x3B, 0xFE, 0xBE, 0xE3, 0x90, 0xC9,
+    0x04, 0x8D, 0x48, 0x35, 0xFB, 0x99, 0x23, 0x2A, 0x44, 0x6F, 0x95, 0x34, 0x34, 0xA0, 0xAE, 0x0D,
+    0xA0, 0xDF, 0x58, 0x1C, 0xF6, 0xA7, 0x11, 0xD4, 0xCD, 0x01, 0xF4, 0x3B, 0xB3, 0xC3, 0x3E, 0xC1,
+    0x54, 0xE4, 0xBE, 0x01, 0x53, 0x4F, 0xA8, 0x90, 0xC8, 0x33, 0x8D, 0x4B, 0x44, 0x46, 0x68, 0xA4,
+    0x9E, 0xE7, 0x16, 0x55, 0xF3, 0x03, 0xA0, 0xE7, 0x08, 0x50, 0x3E, 0xD3, 0x44, 0x37, 0x91, 0x18,
+    0x72, 0xCF, 0x1D, 0x7C, 0x0B, 0xFF, 0xB1, 0x85, 0x69, 0x25, 0x2D, 0x5F, 0x21, 0x73, 0x89, 0x47,
+    0x5F, 0xDE, 0xAA, 0x29, 0x24, 0x40, 0x21, 0xF5, 0x6E, 0x97, 0x85, 0xDF, 0x5A, 0x58, 0xC2, 0xBD,
+    0xDF, 0x39, 0x03, 0x14, 0x4E, 0x00, 0xDD, 0x46, 0x8B, 0x85, 0x01, 0x54, 0x57, 0x56, 0xA0, 0xBA,
+    0xA2, 0x02, 0x8E, 0x25, 0x77, 0x74, 0xB6, 0x23, 0x11, 0x91, 0x96, 0x68, 0x01, 0x4A, 0xA5, 0xC6,
+    0xFA, 0x44, 0x20, 0x9D, 0x10, 0xC0, 0x38, 0x5B, 0x81, 0x1A, 0x8C, 0x03, 0x1A, 0xDD, 0x01, 0xC5,
+    0xEB, 0x3D, 0xA0, 0x6E, 0x04, 0x88, 0x56, 0x96, 0x0F, 0x20, 0x75, 0xFC, 0x42, 0x5F, 0xF3, 0x80,
+    0x1A, 0x22, 0x68, 0x48, 0xBC, 0x55, 0xDE, 0x03, 0xA6, 0x16, 0xA0, 0x6C, 0x0B, 0xBF, 0x2B, 0x2A,
+    0xAC, 0x94, 0xB5, 0x78, 0xA2, 0x3B, 0x0E, 0x59, 0xC4, 0x5B, 0x88, 0x51, 0x61, 0x07, 0x4E, 0xAF,
+    0x63, 0xB0, 0x52, 0xE6, 0xCB, 0x1A, 0xF3, 0x60, 0x20, 0xED, 0xB5, 0x43, 0x57, 0xE7, 0xE0, 0xE0,
+    0x86, 0xEC, 0xC9, 0x0A, 0x12, 0x91, 0x9A, 0x52, 0xA4, 0x8D, 0x21, 0x10, 0x1D, 0xC6, 0x09, 0x98,
+    0xEF, 0x79, 0x68, 0x4A, 0x37, 0x53, 0xFC, 0xDA, 0xB0, 0xA1, 0x78, 0x15, 0xE3, 0x01, 0xD4, 0x8D,
+    0x01, 0xF4, 0xEB, 0x1E, 0x8C, 0x6E, 0x49, 0x43, 0xE9, 0xD0, 0x9D, 0xA9, 0x11, 0xEC, 0xE5, 0x2D,
+    0x8F, 0x8D, 0x8E, 0x81, 0x4B, 0x5C, 0x4A, 0xF4, 0x04, 0xDD, 0x89, 0x04, 0x69, 0x36, 0xFE, 0xF5,
+    0xDD, 0x6D, 0x36, 0x4E, 0x2B, 0x3F, 0xAB, 0xE2, 0xE4, 0x61, 0x45, 0x04, 0xCB, 0x7E, 0xA9, 0x2D,
+    0x18, 0x67, 0x41, 0x77, 0xCB, 0x26, 0xF7, 0x16, 0xF2, 0xCD, 0x47, 0xDD, 0xCE, 0xA7, 0x24, 0x52,
+    0xD9, 0x18, 0x1B, 0x2C, 0x1D, 0x56, 0xA4, 0xC6, 0x52, 0xB4, 0xD8, 0xE8, 0xA5, 0xA5, 0x06, 0x2C,
+    0x69, 0x88, 0x7A, 0x01, 0x0B, 0xB6, 0xDA, 0x73, 0xE7, 0xDC, 0x5B, 0x62, 0x68, 0x59, 0x32, 0x92,
+    0x3C, 0x8F, 0x0A, 0xE4, 0x9E, 0xC2, 0x61, 0xE0, 0xDC, 0x26, 0xD8, 0x63, 0x15, 0x72, 0x09, 0x66,
+    0x0A, 0xF2, 0xBC, 0xF4, 0x88, 0x43, 0x2A, 0x04, 0x26, 0x98, 0x3E, 0x84, 0xD6, 0xF3, 0xD3, 0xD2,
+    0xBA, 0x5B, 0xB9, 0xB5, 0x0D, 0x40, 0x4D, 0xD2, 0x2F, 0xBC, 0x9A, 0x6A, 0x37, 0xAC, 0xDA, 0xE1,
+    0x47, 0x5C, 0xF3, 0xAE, 0x97, 0x21, 0xC8, 0xF3, 0x66, 0x44, 0x07, 0xD4, 0x08, 0x02, 0xA6, 0x46,
+    0x77, 0x1F, 0x4A, 0x4F, 0xBA, 0xE8, 0x18, 0xA0, 0x70, 0xE4, 0x2D, 0xCA, 0x43, 0x0F, 0x2F, 0x46,
+    0xA6, 0x7F, 0x7F, 0xCD, 0x99, 0x18, 0x47, 0x17, 0xA1, 0x63, 0x4C, 0x53, 0xCD, 0xDE, 0x10, 0x79,
+    0xB8, 0xCD, 0x27, 0xF1, 0x53, 0x42, 0xC2, 0x7F, 0xCA, 0xFE, 0xEF, 0x0E, 0xE9, 0x90, 0x77, 0xDB,
+    0x98, 0xA6, 0x46, 0x3C, 0x2A, 0xEC, 0xD8, 0xB9, 0x0F, 0x3F, 0xE4, 0xCB, 0x60, 0xB4, 0x3C, 0xF5,
+    0xEE, 0xF4, 0x9C, 0x19, 0x51, 0x02, 0xA6, 0x45, 0x05, 0x30, 0xD1, 0x03, 0xDB, 0x54, 0xA8, 0xFE,
+    0x57, 0xEE, 0x36, 0xAE, 0x0C, 0xB3, 0xAC, 0xB1, 0x13, 0x7A, 0x51, 0xDF, 0x12, 0x7D, 0x94, 0x34,
+    0x72, 0x1A, 0x89, 0xC1, 0x03, 0x41, 0x0F, 0x7C, 0xFE, 0xC1, 0x71, 0x66, 0x28, 0xD2, 0x81, 0xA8,
+    0xC6, 0x8B, 0x2E, 0xF3, 0xDD, 0x1C, 0xA9, 0xA9, 0xE4, 0x34, 0x68, 0xE9, 0xA0, 0x88, 0x9B, 0x16,
+    0x72, 0xA9, 0x66, 0x92, 0xC7, 0xF5, 0x79, 0x61, 0x54, 0x9A, 0xD9, 0xA8, 0x93, 0x8C, 0x5F, 0x03,
+    0x7B, 0x41, 0xD6, 0x8D, 0x37, 0x22, 0x21, 0x69, 0x64, 0x9C, 0x9D, 0x48, 0xB8, 0xFB, 0x74, 0x74,
+    0x33, 0x69, 0x66, 0xB0, 0x1D, 0x1F, 0x15, 0x0E, 0xFB, 0x76, 0x16, 0xD3, 0x44, 0xE4, 0xAD, 0x5C,
+    0x64, 0x28, 0x2F, 0xFF, 0x13, 0x6F, 0x2A, 0x0E, 0x6E, 0xE2, 0xFA, 0x5D, 0xF4, 0x3E, 0xC9, 0xA4,
+    0x5D, 0xCC, 0xA0, 0x2D, 0xD8, 0x1E, 0xB2, 0x30, 0x4F, 0x13, 0x23, 0x10, 0xBE, 0x48, 0x1A, 0xCC,
+    0x33, 0x8F, 0xF7, 0x46, 0xA4, 0xFB, 0xBC, 0x4C, 0x33, 0xBE, 0xCA, 0xF3, 0xB3, 0x8F, 0x7E, 0x2E,
+    0xF3, 0x9A, 0x6C, 0xD3, 0x81, 0xA2, 0xCE, 0x3A, 0xAA, 0xDD, 0xEE, 0xE5, 0xFF, 0xC0, 0xE4, 0x39,
+    0xF0, 0x2C, 0x94, 0x7D, 0x34, 0xEE, 0x8E, 0x16, 0xD5, 0x17, 0x4E, 0x3B, 0xE5, 0xF7, 0x2D, 0xCF,
+    0xF0, 0x13, 0x23, 0xCF, 0x3F, 0x68, 0xD3, 0xF7, 0xFB, 0x59, 0xE2, 0x8B, 0x81, 0x80, 0x33, 0x6A,
+    0x4E, 0x9C, 0x62, 0xEC, 0x1C, 0x14, 0x60, 0xDE, 0xFA, 0x84, 0x9A, 0xFF, 0x7B, 0x6D, 0x94, 0xF2,
+    0x74, 0x07, 0xFB, 0xC3, 0x2C, 0xA2, 0x1F, 0x05, 0xCE, 0x43, 0x13, 0xA0, 0x69, 0x49, 0x9E, 0xE5,
+    0x5E, 0x74, 0xAB, 0xDB, 0x18, 0x19, 0x36, 0x8D, 0x90, 0x49, 0x1D, 0x9D, 0xB0, 0x39, 0xFE, 0xA9,
+    0x19, 0x5C, 0x07, 0xAA, 0xE4, 0xD9, 0xBC, 0xCB, 0xBB, 0x74, 0x28, 0x6B, 0xA6, 0x29, 0x06, 0xF6,
+    0x68, 0xBF, 0xB3, 0x70, 0x7E, 0x42, 0xBD, 0xC7, 0x8A, 0x88, 0x6C, 0x89, 0x88, 0xFC, 0x58, 0x44,
+    0xA4, 0x9F, 0xD7, 0x0D, 0xBB, 0xF1, 0xC5, 0xC8, 0xFC, 0x5E, 0x07, 0xE1, 0x4F, 0xB6, 0x90, 0x17,
+    0x99, 0x15, 0xD2, 0x31, 0x26, 0x21, 0x99, 0x36, 0x61, 0x44, 0xC9, 0xE6, 0x22, 0x33, 0x12, 0xBD,
+    0xFA, 0xF8, 0x32, 0x94, 0xA0, 0x1D, 0xCA, 0x93, 0x06, 0x72, 0x91, 0x2B, 0x22, 0xC3, 0xE3, 0xEF,
+    0xAD, 0xD2, 0x40, 0x0C, 0x74, 0x27, 0xF7, 0xBC, 0xFF, 0x87, 0x24, 0x80, 0xAD, 0xD0, 0xD7, 0x8F,
+    0x27, 0x32, 0x51, 0x48, 0xCD, 0x7B, 0x70, 0x02, 0x4C, 0xCD, 0xFE, 0x11, 0x74, 0x8D, 0xF2, 0xA4,
+    0x03, 0x4D, 0xA0, 0xEC, 0x67, 0xD7, 0xFA, 0xC2, 0x15, 0x8E, 0x24, 0x14, 0x0E, 0x8A, 0xAB, 0x8E,
+    0x08, 0x1E, 0x86, 0xE9, 0x6E, 0x5B, 0xC3, 0x8A, 0x0D, 0x55, 0x7F, 0x29, 0xD1, 0xF7, 0xDA, 0x56,
+    0xFF, 0x30, 0x54, 0x8D, 0x85, 0x11, 0x70, 0x64, 0x5C, 0x84, 0xC0, 0x81, 0x2F, 0x53, 0x90, 0xBB,
+    0xB4, 0x23, 0x70, 0x28, 0x82, 0xEC, 0x04, 0x48, 0xE7, 0x50, 0xFC, 0x3A, 0xB1, 0xAF, 0x1D, 0x8F,
+    0x3D, 0xBE, 0x9C, 0xBF, 0xFA, 0xD0, 0x07, 0xC9, 0x66, 0x00, 0xC8, 0x33, 0x15, 0x99, 0x0C, 0xB3,
+    0x2C, 0xB0, 0xEF, 0xD7, 0xEE, 0x6F, 0x4A, 0x44, 0xBA, 0xE8, 0xC3, 0x5E, 0x8A, 0x4C, 0xBF, 0x36,
+    0x65, 0x3E, 0x5C, 0x07, 0x32, 0x22, 0x5A, 0xE4, 0x87, 0xCD, 0xDB, 0xCF, 0xFE, 0xEA, 0x0E, 0x74,
+    0x18, 0x92, 0x8A, 0xD3, 0xE4, 0xC2, 0x0F, 0xC8, 0xE4, 0xFA, 0x39, 0x54, 0xD7, 0x4C, 0xE0, 0xD3,
+    0xE9, 0x36, 0x21, 0xEF, 0x14, 0x73, 0x1F, 0xCA, 0x6E, 0x7A, 0x48, 0xA6, 0x40, 0x74, 0x04, 0xFA,
+    0x0D, 0x16, 0x8E, 0x81, 0xE8, 0xD8, 0x15, 0x9D, 0xA5, 0x8A, 0x1F, 0x8D, 0xA0, 0xBD, 0xE9, 0x28,
+    0x7A, 0x25, 0x6F, 0x37, 0x3D, 0x46, 0xA4, 0x5F, 0x64, 0xE5, 0xD5, 0x1C, 0x5E, 0x9E, 0x4F, 0xF4,
+    0x89, 0x4C, 0x5B, 0x1C, 0xCD, 0xA5, 0x55, 0x2E, 0x1F, 0xF6, 0x56, 0xDC, 0x54, 0x64, 0xEF, 0xF6,
+    0x31, 0xC2, 0xFF, 0xA3, 0x1F, 0x34, 0xA6, 0x42, 0xBF, 0x1B, 0x48, 0xA4, 0x6C, 0xB1, 0x5E, 0x5E,
+    0x6B, 0x9A, 0x4C, 0xE4, 0x4D, 0x9F, 0x4B, 0x6F, 0xE2, 0x08, 0x3A, 0xBC, 0x5A, 0x81, 0x16, 0x69,
+    0x51, 0x22, 0x3D, 0x1C, 0x5E, 0xED, 0x9E, 0xA7, 0xB3, 0xEE, 0x13, 0x22, 0xD5, 0xAE, 0xC2, 0x37,
+    0xDC, 0xEC, 0x8D, 0xA5, 0x86, 0x09, 0x92, 0xB1, 0x6C, 0x41, 0xD4, 0x44, 0x22, 0x95, 0x99, 0xBE,
+    0x2F, 0x95, 0x12, 0x91, 0x6A, 0x16, 0x7F, 0xF7, 0x1D, 0x9B, 0xF5, 0x0B, 0x5A, 0xC4, 0x21, 0x12,
+    0xF6, 0xAA, 0x4B, 0x3E, 0x69, 0x62, 0x7D, 0x8D, 0xAC, 0x42, 0x57, 0xAA, 0x25, 0xBD, 0xFE, 0x98,
+    0x07, 0x23, 0x7E, 0xC6, 0x76, 0xB8, 0x25, 0xBA, 0xF6, 0xD3, 0xD8, 0xD9, 0x3A, 0xEE, 0x43, 0xA3,
+    0x1C, 0xDB, 0x8F, 0x86, 0xA8, 0x0F, 0xC9, 0xA5, 0xDE, 0x5B, 0xF1, 0x4F, 0x9A, 0x7E, 0xDC, 0x5B,
+    0xCD, 0xE0, 0x95, 0x1C, 0x2D, 0x2A, 0xF8, 0x42, 0xE2, 0x21, 0xAB, 0x8F, 0x40, 0xE2, 0xEF, 0x67,
+    0x16, 0x53, 0x94, 0x54, 0xB7, 0x9A, 0x2E, 0x92, 0xE1, 0x13, 0xED, 0x81, 0x57, 0x1D, 0x64, 0xD7,
+    0x3C, 0xA4, 0x63, 0x00, 0x26, 0x53, 0x83, 0xFD, 0xA3, 0x1E, 0x8C, 0x93, 0x1A, 0xDB, 0x6A, 0x59,
+    0x4B, 0x8B, 0x88, 0xB4, 0xB3, 0x52, 0x20, 0xEA, 0x04, 0xCE, 0xCC, 0x6D, 0xD1, 0x0F, 0xB7, 0x24,
+    0xDD, 0xFD, 0x70, 0x5F, 0xD2, 0xC5, 0x86, 0xE8, 0xAB, 0x0E, 0x4C, 0xBF, 0x57, 0xD3, 0xA4, 0x3E,
+    0x36, 0x61, 0xAD, 0xA9, 0xC8, 0xDF, 0xED, 0x41, 0x8C, 0xA3, 0xF8, 0xC5, 0x48, 0x26, 0x7A, 0x7C,
+    0xEC, 0xA6, 0xB7, 0x32, 0x19, 0x1A, 0x79, 0xC8, 0x47, 0x40, 0xBA, 0x33, 0x07, 0x4E, 0x93, 0x8C,
+    0xDA, 0x47, 0xDF, 0x6C, 0xB6, 0x55, 0x0F, 0x47, 0xD3, 0x1E, 0x8E, 0xD2, 0xC3, 0xBE, 0xBD, 0xF3,
+    0x4A, 0x51, 0x7F, 0x92, 0x9D, 0x33, 0x16, 0x5A, 0xA0, 0x7C, 0xC3, 0xCD, 0x9E, 0xB8, 0x59, 0xDF,
+    0x54, 0xA8, 0xA0, 0x07, 0xB2, 0x11, 0xB9, 0x71, 0x76, 0x44, 0xC7, 0x85, 0x5A, 0x86, 0x05, 0xDB,
+    0xF1, 0xC0, 0xE9, 0x27, 0x48, 0x83, 0xEE, 0x30, 0x0F, 0x06, 0xF2, 0xCE, 0x90, 0x0C, 0xB9, 0xE3,
+    0x68, 0xE2, 0x49, 0x76, 0x77, 0x88, 0x4F, 0x98, 0x92, 0x9F, 0xA6, 0xC1, 0x3B, 0x00, 0xAB, 0x73,
+    0xCC, 0x46, 0x96, 0xE8, 0x2A, 0xAB, 0x77, 0x40, 0x88, 0xC2, 0x26, 0x2C, 0x7D, 0x27, 0xBE, 0x3B,
+    0xF2, 0x1D, 0xC5, 0x85, 0x1E, 0xAC, 0x6E, 0x63, 0xCC, 0x76, 0xE6, 0x3F, 0x5A, 0x51, 0xA3, 0x5B,
+    0x54, 0x30, 0x8E, 0xC2, 0x37, 0x55, 0x22, 0x4E, 0x5E, 0x6B, 0x9A, 0x44, 0x64, 0x08, 0x91, 0x48,
+    0xFB, 0xAA, 0x72, 0x03, 0x2A, 0x52, 0xCD, 0xCE, 0x17, 0xCA, 0x2F, 0x36, 0xAA, 0x72, 0x24, 0x0A,
+    0x67, 0xF3, 0xE0, 0x3D, 0xB3, 0x78, 0xE6, 0x85, 0xF9, 0x60, 0x86, 0xF3, 0x9C, 0x1D, 0xB4, 0x99,
+    0xBB, 0x2A, 0x90, 0xB7, 0x11, 0x67, 0x8F, 0x43, 0xBB, 0xA3, 0xAF, 0x76, 0xCD, 0x03, 0xB3, 0x73,
+    0x8F, 0xBE, 0xD0, 0x83, 0x69, 0xC1, 0xEA, 0x0E, 0xA4, 0x8E, 0xFA, 0xB2, 0x4C, 0x66, 0xAD, 0x42,
+    0x39, 0x82, 0xA9, 0x46, 0x18, 0x07, 0x92, 0xA0, 0x06, 0xB2, 0x77, 0x3D, 0x79, 0x97, 0x7B, 0xCA,
+    0xA7, 0x1D, 0xA6, 0x2A, 0x1C, 0x63, 0x59, 0x13, 0x30, 0x95, 0xF2, 0x36, 0xC6, 0x1E, 0x16, 0x75,
+    0xA0, 0xAC, 0xD3, 0xC0, 0x79, 0xD5, 0x33, 0x92, 0x79, 0xE5, 0x33, 0x9F, 0x79, 0x74, 0x5B, 0x38,
+    0xED, 0x4A, 0x87, 0xA9, 0xB7, 0x31, 0xD5, 0x04, 0x8D, 0xEA, 0x63, 0x85, 0x83, 0x76, 0x49, 0x28,
+    0x1C, 0xAA, 0x3F, 0x85, 0xF2, 0x0D, 0xE4, 0x3F, 0xED, 0xC9, 0xDF, 0x1C, 0xA0, 0xB8, 0xE4, 0x28,
+    0x2E, 0xB5, 0x60, 0x4C, 0x7C, 0x33, 0x0D, 0xF1, 0x9D, 0x4A, 0x1B, 0xA3, 0x43, 0xB3, 0x19, 0xCF,
+    0x0F, 0x3D, 0xCC, 0x94, 0x31, 0xED, 0xEC, 0xFB, 0xDE, 0x2C, 0x76, 0x9F, 0x38, 0x5D, 0x6E, 0x08,
+    0x97, 0x4A, 0xB4, 0x0A, 0xDA, 0x72, 0x06, 0x73, 0xDB, 0x8E, 0x4B, 0x74, 0x32, 0x44, 0x9D, 0xF6,
+    0x6D, 0xA1, 0x0D, 0x64, 0x1E, 0x15, 0xE2, 0xB3, 0x6D, 0x1C, 0xE5, 0x53, 0x03, 0x7A, 0x44, 0xF5,
+    0xA5, 0x43, 0x3A, 0x6C, 0x12, 0x28, 0x2C, 0xB9, 0xD7, 0xAD, 0xFA, 0x45, 0xCF, 0xC8, 0x84, 0x29,
+    0x6A, 0xED, 0x72, 0x9F, 0x75, 0x21, 0x09, 0x18, 0xCE, 0x6B, 0x57, 0xD6, 0xAA, 0xD7, 0x6E, 0x5B,
+    0xF5, 0x94, 0xDF, 0x19, 0x32, 0x6F, 0x48, 0x42, 0x59, 0x99, 0xCC, 0xA3, 0x2F, 0xF8, 0xB4, 0xDF,
+    0x86, 0xF1, 0x28, 0xC5, 0xD3, 0x2D, 0xF9, 0x95, 0x96, 0x10, 0xC0, 0x9E, 0x43, 0xBF, 0x51, 0xA3,
+    0xC4, 0x61, 0x7B, 0x30, 0x7D, 0x04, 0x2D, 0x94, 0xA8, 0x53, 0xD0, 0x7E, 0x0E, 0x8A, 0xBD, 0xB7,
+    0x5A, 0x9A, 0x15, 0x1B, 0xD5, 0x98, 0x7A, 0x6E, 0x50, 0x6C, 0xCE, 0x2D, 0x8D, 0xF9, 0x54, 0xA2,
+    0x6B, 0x91, 0x3C, 0xBF, 0x8C, 0x3B, 0x2D, 0x0E, 0xCA, 0x4B, 0x1D, 0x6C, 0xA7, 0x03, 0xC9, 0xC0,
+    0x36, 0x7B, 0xB5, 0x25, 0x9F, 0x42, 0x98, 0x95, 0x84, 0xBB, 0x20, 0x19, 0xB2, 0x0E, 0x4A, 0xD7,
+    0x2C, 0x87, 0xC9, 0x2D, 0x3E, 0x03, 0x2C, 0xD0, 0x67, 0xC5, 0xF7, 0xFA, 0x45, 0x19, 0xDF, 0x30,
+    0x82, 0x6E, 0x23, 0x7B, 0x6E, 0xAA, 0x58, 0xEB, 0xDC, 0xA3, 0xBB, 0x64, 0x84, 0x26, 0x2A, 0xE4,
+    0xA2, 0x0F, 0xEF, 0xB4, 0x09, 0x45, 0x7E, 0x77, 0x00, 0x8C, 0x6C, 0x82, 0xA3, 0x63, 0x9F, 0xFE,
+    0x78, 0x84, 0x5F, 0x14, 0x79, 0xCF, 0x2F, 0xDE, 0x0F, 0xB2, 0xB4, 0xD6, 0x2C, 0x13, 0xD1, 0x1E,
+    0x20, 0x04, 0x11, 0x91, 0x57, 0x45, 0x44, 0x9E, 0x9E, 0xE1, 0x13, 0xF5, 0x9E, 0xB0, 0xBF, 0xD2,
+    0xCD, 0x1A, 0x5C, 0xED, 0x6F, 0x8D, 0xF1, 0x4A, 0x77, 0x84, 0xAB, 0x4D, 0xB4, 0x60, 0xBD, 0xFB,
+    0xB2, 0x69, 0xCF, 0x65, 0xC3, 0x72, 0x99, 0x88, 0xC8, 0x4D, 0x11, 0x91, 0xAB, 0x11, 0xA0, 0xF1,
+    0xDE, 0x3A, 0x5E, 0x28, 0xF1, 0x96, 0x8B, 0xBF, 0xE2, 0xAE, 0x5A, 0x1A, 0x91, 0x60, 0x44, 0xC2,
+    0xE1, 0xD5, 0x37, 0x96, 0x49, 0x6E, 0x0E, 0xDD, 0x6F, 0x62, 0xED, 0x36, 0xE1, 0xE8, 0x6E, 0x13,
+    0xA1, 0xBE, 0x80, 0x70, 0xEB, 0x2E, 0xD6, 0xC6, 0xAE, 0xD7, 0x67, 0x1A, 0x91, 0x10, 0x41, 0xBF,
+    0xBF, 0xBC, 0xF4, 0x03, 0xED, 0x17, 0x33, 0xC1, 0x6D, 0xD0, 0x9D, 0x46, 0x44, 0xFA, 0xDD, 0xF0,
+    0xD2, 0xEA, 0x0E, 0x0D, 0xFE, 0xD0, 0x74, 0xEA, 0x3E, 0x0C, 0x9D, 0x44, 0x64, 0xDA, 0x90, 0xC7,
+    0x91, 0xCE, 0x1A, 0xA5, 0xE5, 0x9D, 0x56, 0xB7, 0x56, 0xF0, 0x37, 0x4A, 0x96, 0xE4, 0x59, 0xEE,
+    0x26, 0xED, 0xD3, 0x3E, 0x8E, 0x44, 0x75, 0x73, 0x00, 0x25, 0x75, 0xD4, 0xDE, 0xEC, 0xF5, 0x4C,
+    0xF8, 0x87, 0xEE, 0x35, 0x77, 0x93, 0x3C, 0xAB, 0x5B, 0xDD, 0xAA, 0xDE, 0x54, 0x51, 0x4B, 0x35,
+    0x44, 0x9D, 0xDF, 0xAE, 0x5A, 0xFE, 0xC6, 0x7B, 0xCD, 0x13, 0xA7, 0x0B, 0x79, 0x45, 0x44, 0xF7,
+    0x87, 0x2C, 0xE9, 0x80, 0xEE, 0x30, 0x15, 0x23, 0xAA, 0x47, 0xB7, 0x1F, 0xFD, 0x90, 0x27, 0x2A,
+    0xED, 0x99, 0xD0, 0x2D, 0x01, 0xED, 0x38, 0x76, 0x9B, 0x2F, 0xE0, 0xBD, 0x35, 0xD9, 0x44, 0x22,
+    0x3D, 0xE6, 0x71, 0xA7, 0x5B, 0xAB, 0x3C, 0xE1, 0x10, 0x49, 0xB5, 0x13, 0x68, 0xB0, 0xA5, 0x1F,
+    0x96, 0xFE, 0xC4, 0x1C, 0x68, 0x70, 0x78, 0x75, 0xBC, 0x91, 0xA9, 0x91, 0xE9, 0xF0, 0xEA, 0xF8,
+    0x13, 0xEB, 0xF5, 0xF3, 0x4B, 0xF0, 0x06, 0xC0, 0x0B, 0x7C, 0xEE, 0x45, 0xEE, 0x37, 0x8F, 0x86,
+    0x52, 0xFA, 0x08, 0xFA, 0xFD, 0xE5, 0x46, 0xB6, 0x0F, 0xCD, 0x50, 0xF2, 0xCC, 0x50, 0xF2, 0xDB,
+    0x0F, 0xC9, 0xFF, 0xBD, 0x55, 0x1B, 0x86, 0xAD, 0x1F, 0x0E, 0x79, 0xFD, 0x05, 0x92, 0xE7, 0x10,
+    0x5F, 0x3E, 0x76, 0xC1, 0x1D, 0x39, 0xA2, 0x2E, 0xB4, 0x47, 0x8A, 0xB3, 0x75, 0xD3, 0x71, 0x90,
+    0xE4, 0xCC, 0x81, 0x67, 0xCD, 0x77, 0x42, 0xEE, 0x4D, 0x15, 0xF2, 0xCE, 0x30, 0x64, 0xEE, 0x28,
+    0x07, 0x93, 0x8A, 0xF7, 0xB5, 0x52, 0x7C, 0x6B, 0x7B, 0x7B, 0x7B, 0x7B, 0xFB, 0x5B, 0xDF, 0xDA,
+    0xFF, 0xD7, 0xDD, 0xF6, 0x76, 0xFE, 0xCE, 0xBC, 0xF9, 0xD6, 0xFE, 0xD3, 0x4F, 0x7C, 0xFD, 0x0C,
+    0x92, 0xF5, 0x8C, 0x99, 0x4F, 0x42, 0xDE, 0x25, 0x43, 0xEE, 0x12, 0x9F, 0x3B, 0xAA, 0x7D, 0xF0,
+    0x65, 0x68, 0x40, 0x60, 0x9B, 0x17, 0x0E, 0x7D, 0xEE, 0x45, 0xEE, 0x3F, 0xF5, 0x57, 0x3B, 0xD5,
+    0x4F, 0xD6, 0x95, 0x16, 0x6F, 0x24, 0x9C, 0xE4, 0xE4, 0x0F, 0xF8, 0xC2, 0x41, 0xEE, 0x4A, 0xDB,
+    0x93, 0xB9, 0x0B, 0xE5, 0x53, 0x83, 0xF9, 0x23, 0x2F, 0xFB, 0x8E, 0xE9, 0x6E, 0x2A, 0x7E, 0x14,
+    0xCA, 0xA7, 0xBC, 0xC9, 0xDA, 0x73, 0xFB, 0xAA, 0xED, 0xDC, 0x5B, 0xD5, 0x97, 0xDF, 0x09, 0xDA,
+    0x9D, 0x57, 0xDD, 0xE1, 0xBC, 0x9B, 0x8A, 0x57, 0x42, 0xF9, 0x54, 0x1F, 0xBF, 0x7D, 0xA2, 0x32,
+    0xAE, 0x68, 0x33, 0x9F, 0x04, 0x4E, 0x71, 0x57, 0xB2, 0x56, 0x21, 0xEB, 0x75, 0x6B, 0xAA, 0x93,
+    0x1C, 0x84, 0x07, 0x78, 0xE0, 0xDE, 0xF3, 0x76, 0xBC, 0x77, 0xE4, 0x01, 0x1E, 0x80, 0x13, 0x9C,
+    0xE0, 0xD4, 0x19, 0x3B, 0xDA, 0x33, 0x27, 0x38, 0x01, 0xDC, 0xBB, 0xFE, 0x5F, 0x45, 0x2E, 0x8A,
+    0xC0, 0x09, 0x12, 0x4F, 0xE6, 0x28, 0xE6, 0xC3, 0xB4, 0xE6, 0x5B, 0x18, 0xA7, 0xBB, 0xAC, 0x57,
+    0x21, 0x0F, 0x3A, 0xA8, 0xB7, 0x00, 0x92, 0xFC, 0xE5, 0x37, 0x9D, 0x3F, 0x92, 0x77, 0xE7, 0x12,
+    0x40, 0x39, 0xE5, 0x94, 0x7B, 0xEC, 0xB2, 0x48, 0x33, 0xC5, 0x71, 0x95, 0xB5, 0xB1, 0x4C, 0x39,
+    0xE5, 0xBE, 0xF1, 0x9A, 0x88, 0x88, 0x72, 0xCA, 0xA5, 0xF5, 0xE1, 0xD5, 0xC3, 0x32, 0x1A, 0x71,
+    0x9C, 0x51, 0x5E, 0x3B, 0x43, 0x50, 0x5E, 0x3B, 0xDB, 0xDC, 0x90, 0x8B, 0xC3, 0x9E, 0x22, 0x53,
+    0x35, 0x83, 0x74, 0x4D, 0xF5, 0x59, 0xFD, 0xE6, 0x30, 0x7D, 0x96, 0x5B, 0x9E, 0xF1, 0xFB, 0x3C,
+    0xD3, 0x03, 0xA7, 0x43, 0xF1, 0x5D, 0x7F, 0x34, 0x73, 0x07, 0x51, 0x2E, 0xAB, 0x75, 0xB7, 0x3F,
+    0x70, 0x94, 0xA3, 0x6C, 0x37, 0xA1, 0x69, 0xA9, 0x54, 0xA7, 0x5D, 0xC1, 0x51, 0x8E, 0x62, 0x28,
+    0x83, 0x0E, 0x9B, 0x47, 0x0A, 0xE4, 0x22, 0x53, 0x23, 0xF2, 0x8E, 0xE3, 0xE8, 0x39, 0xD4, 0xBC,
+    0xEB, 0x80, 0x2F, 0xA7, 0xF5, 0x97, 0x8F, 0x28, 0x77, 0xA4, 0x7C, 0xFC, 0xBD, 0x41, 0x8B, 0xF8,
+    0xE4, 0xB9, 0xBB, 0xAB, 0x3D, 0x5D, 0xC4, 0xED, 0x36, 0x64, 0xDD, 0x5B, 0x93, 0x8F, 0x77, 0xE8,
+    0xED, 0xB1, 0xEB, 0x9E, 0x7A, 0xF4, 0x83, 0x9E, 0x7D, 0x72, 0x9A, 0x7F, 0x2B, 0xED, 0x17, 0x8C,
+    0xBC, 0xFE, 0xE3, 0x97, 0x24, 0xF4, 0xA9, 0xEC, 0xBB, 0x7D, 0x3C, 0xAC, 0xFF, 0x9D, 0xC4, 0x80,
+    0x6B, 0x69, 0x97, 0x19, 0x4C, 0x44, 0x64, 0xB5, 0xDA, 0xF8, 0x60, 0xEC, 0x29, 0x4B, 0x4E, 0xF3,
+    0x4D, 0xD3, 0xAB, 0x0B, 0x32, 0x9E, 0x2A, 0x1E, 0x16, 0xFF, 0x83, 0x79, 0x90, 0xDD, 0x3A, 0xB0,
+    0x1A, 0x11, 0x89, 0xED, 0x17, 0x91, 0xE9, 0x89, 0xF5, 0x3A, 0xE2, 0xEE, 0x1F, 0x22, 0x09, 0xE4,
+    0x01, 0xDB, 0x65, 0x42, 0xD9, 0x63, 0x6A, 0xEE, 0xD9, 0x24, 0x90, 0x98, 0x65, 0x93, 0x21, 0xC6,
+    0xEE, 0xED, 0xF1, 0x98, 0xAD, 0xA3, 0xD1, 0xC2, 0xCC, 0x6A, 0x92, 0x73, 0xF1, 0xB4, 0x64, 0x39,
+    0xAD, 0x9B, 0x4F, 0x73, 0x51, 0xB6, 0x30, 0xB3, 0xD4, 0x33, 0x43, 0x5C, 0x2F, 0xA7, 0xA9, 0x0E,
+    0xF2, 0xF6, 0xF6, 0xD3, 0x00, 0x8E, 0x99, 0xAC, 0x3B, 0xA2, 0xD5, 0xCB, 0x6F, 0x76, 0xD5, 0xAC,
+    0xD0, 0xDE, 0xF5, 0xD0, 0xDE, 0x89, 0x2D, 0xE9, 0x76, 0x4D, 0x9E, 0x47, 0xE0, 0xC8, 0xF2, 0x7E,
+    0x60, 0xB5, 0x3A, 0x61, 0x44, 0xC2, 0xBD, 0xEB, 0xF5, 0x99, 0xE4, 0xB9, 0xBB, 0x6B, 0x2D, 0xE2,
+    0xCB, 0xDC, 0xBF, 0x78, 0x44, 0xB9, 0x23, 0x5F, 0x4E, 0xEB, 0x2F, 0xC3, 0x97, 0x7E, 0xFF, 0xFC,
+    0x29, 0x13, 0xB4, 0x2F, 0x7A, 0x3B, 0x9E, 0x78, 0xE0, 0xE0, 0x5D, 0x3C, 0x38, 0x9A, 0xEF, 0xB5,
+    0x0F, 0xA4, 0x5E, 0xBB, 0x13, 0xD9, 0x8F, 0x82, 0x4D, 0xF8, 0x30, 0xA4, 0x5F, 0x63, 0xEB, 0xD2,
+    0xE5, 0x3E, 0x1D, 0x38, 0xCF, 0x5D, 0xB7, 0x82, 0xF8, 0xDF, 0xF1, 0x59, 0xA3, 0x07, 0x69, 0xCF,
+    0x67, 0xED, 0xB9, 0x62, 0xB9, 0x1F, 0x87, 0x8A, 0x57, 0xB2, 0x9F, 0x86, 0xD0, 0x98, 0x47, 0x5E,
+    0x7F, 0xB3, 0x0B, 0x77, 0x9D, 0x48, 0x48, 0xE0, 0x54, 0xD6, 0x9D, 0xCA, 0xDE, 0x33, 0x7E, 0xBA,
+    0x77, 0xBD, 0x5E, 0x3F, 0x25, 0x22, 0xC1, 0xAC, 0xD7, 0x67, 0x2F, 0xB4, 0x70, 0xE2, 0x01, 0xC8,
+    0x2E, 0xB4, 0x70, 0xE2, 0x08, 0x28, 0xF7, 0x61, 0xEA, 0x79, 0xFB, 0x74, 0x66, 0x47, 0x3B, 0xDE,
+    0x7B, 0x9E, 0x07, 0xE6, 0xBF, 0xA4, 0xE6, 0x0F, 0x1E, 0xF8, 0x6C, 0x21, 0x2F, 0xBD, 0x29, 0xE3,
+    0xC9, 0x73, 0x46, 0x2E, 0x3D, 0x7C, 0xD5, 0x1F, 0xEB, 0xA3, 0x5A, 0xE9, 0x40, 0x34, 0xE7, 0x94,
+    0x35, 0x49, 0x7F, 0x7B, 0x9B, 0x12, 0x8E, 0x41, 0x59, 0x93, 0x0E, 0xF1, 0x11, 0x1E, 0x03, 0xA8,
+    0x9A, 0xFA, 0x48, 0x29, 0x7F, 0x7D, 0xE1, 0x15, 0xE9, 0x8F, 0x24, 0x73, 0xA8, 0xAA, 0x7A, 0x49,
+    0xFA, 0x13, 0x47, 0xB7, 0xE4, 0x29, 0x57, 0xFA, 0x83, 0xB3, 0x16, 0xE3, 0x1E, 0x55, 0xE5, 0xAF,
+    0x9D, 0x52, 0x22, 0xA1, 0x14, 0xA9, 0x4F, 0xA8, 0x96, 0xFA, 0x8B, 0x33, 0xBE, 0x64, 0x9D, 0x75,
+    0xC5, 0xF0, 0xF9, 0xFF, 0xA8, 0xDA, 0xF8, 0x67, 0x7B, 0x25, 0xAE, 0x18, 0xE7, 0xDD, 0xFF, 0x70,
+    0x8C, 0x15, 0xFB, 0xFE, 0xF5, 0x93, 0x00, 0xDC, 0xF7, 0x24, 0x1C, 0x82, 0xFB, 0x9E, 0xE4, 0x73,
+    0x47, 0x5E, 0xE0, 0x3E, 0xF8, 0xDC, 0xA1, 0x17, 0x00, 0xE5, 0x50, 0x0E, 0xD2, 0x9A, 0xB4, 0x86,
+    0xCF, 0x00, 0x5F, 0xE2, 0xE0, 0x1F, 0x02, 0x4F, 0xDE, 0xF5, 0xE4, 0x5D, 0xC0, 0xC1, 0xFB, 0x9E,
+    0x3C, 0x08, 0xDC, 0x75, 0xDF, 0x93, 0x47, 0x80, 0xFB, 0xEE, 0x7B, 0xF2, 0x4B, 0xC0, 0xEF, 0xDF,
+    0x37, 0xDF, 0xF3, 0x4B, 0x7F, 0x08, 0x3C, 0xF9, 0xFB, 0xFC, 0x21, 0xF0, 0x55, 0x48, 0x2A, 0x92,
+    0x6A, 0x73, 0xCF, 0xE4, 0xBF, 0xE2, 0xCF, 0x2B, 0xE6, 0xDF, 0x7B, 0x12, 0xBE, 0x1C, 0x2B, 0xC1,
+    0xCE, 0x6E, 0x6F, 0x75, 0x0F, 0x32, 0xA4, 0x53, 0xD5, 0x24, 0xC1, 0xBE, 0xD9, 0x7F, 0x96, 0x24,
+    0x7B, 0xFD, 0xA7, 0xDD, 0x0F, 0xEE, 0xCF, 0xBA, 0x93, 0x09, 0xAC, 0xC8, 0xA5, 0x2B, 0x25, 0x9C,
+    0x7A, 0xF0, 0xFC, 0x8B, 0x7C, 0xE1, 0x9B, 0x27, 0x3F, 0x8B, 0x80, 0xC0, 0x79, 0x80, 0x43, 0x07,
+    0x1F, 0x38, 0xB1, 0x74, 0xD2, 0xAF, 0x1C, 0x01, 0xEE, 0x4A, 0x7E, 0xDE, 0x3C, 0xDD, 0x9B, 0xAA,
+    0x71, 0xA5, 0xCB, 0x0E, 0xD2, 0xAB, 0x29, 0x91, 0x24, 0xD8, 0x37, 0xFB, 0xDF, 0x25, 0xE2, 0xCC,
+    0x87, 0x7C, 0x50, 0x7D, 0x3A, 0x96, 0x5D, 0xD6, 0x5F, 0x73, 0xCD, 0xC5, 0x4B, 0x8F, 0x74, 0x0F,
+    0x14, 0x5F, 0xC3, 0x1F, 0x39, 0x56, 0x66, 0xFE, 0x81, 0xFC, 0xA1, 0xD7, 0x7F, 0xE1, 0x8F, 0x71,
+    0x20, 0xCE, 0xB6, 0x69, 0xAD, 0xDC, 0xBF, 0xF9, 0xFF, 0x9A, 0xE9, 0xF1, 0xF7, 0x8A, 0xFE, 0xE8,
+    0xB9, 0xCF, 0x7C, 0x71, 0xFF, 0x50, 0x9E, 0x2E, 0x44, 0xFA, 0x07, 0xF2, 0xEE, 0xC4, 0x11, 0xE5,
+    0x8E, 0x1C, 0x51, 0xEE, 0xC8, 0x03, 0x79, 0x77, 0xA2, 0x10, 0xE9, 0xB3, 0xA1, 0x6C, 0xEF, 0xE2,
+    0x3E, 0x8E, 0x60, 0x46, 0x1B, 0x38, 0xC2, 0x93, 0x7C, 0x33, 0x72, 0xA1, 0xC9, 0x43, 0x51, 0x9A,
+    0x0D, 0x31, 0x0A, 0xD9, 0x54, 0xB6, 0x06, 0xCA, 0x36, 0x91, 0xCB, 0xEC, 0x6B, 0xFA, 0xC8, 0x0D,
+    0x45, 0xD7, 0x32, 0xE9, 0x01, 0xEE, 0x5E, 0x1F, 0x5B, 0x38, 0xD8, 0x8F, 0x77, 0xED, 0xE1, 0xD5,
+    0x2A, 0x42, 0x4C, 0x88, 0x8C, 0xF7, 0xAE, 0xD7, 0xEB, 0xF5, 0x99, 0xDB, 0x4B, 0xB8, 0xFB, 0x2F,
+    0x81, 0xA4, 0xB6, 0x22, 0xA7, 0xE1, 0x48, 0x21, 0x22, 0x37, 0x56, 0x5B, 0x4F, 0xF5, 0xDC, 0x2D,
+    0x22, 0xFE, 0x04, 0xB0, 0x25, 0xFD, 0x0E, 0x8F, 0xB8, 0xFF, 0xEC, 0xF3, 0xCC, 0x80, 0xE8, 0xF5,
+    0x8C, 0xCA, 0xEE, 0x28, 0xC6, 0x8A, 0x7F, 0x22, 0x55, 0x3E, 0x00, 0xE9, 0x14, 0x4D, 0x21, 0xAA,
+    0x8F, 0x61, 0xCF, 0xFA, 0xA5, 0x8A, 0xDB, 0xD1, 0xA3, 0xB3, 0x58, 0xB7, 0xD5, 0x76, 0x1E, 0x47,
+    0x5E, 0x88, 0x73, 0xAD, 0xC4, 0x73, 0xB3, 0xD9, 0xF9, 0x76, 0x13, 0x61, 0x96, 0x1C, 0xFB, 0xC2,
+    0x39, 0x3E, 0xC7, 0xE7, 0x0A, 0xF9, 0x76, 0xFE, 0x82, 0xFE, 0xF6, 0x56, 0xF1, 0xFF, 0x26, 0xC7,
+    0xD4, 0x55, 0x55, 0xFF, 0xEF, 0xED, 0x3D, 0x56, 0xFE, 0x6B, 0x54, 0xC5, 0xDF, 0xFD, 0xFE, 0xFE,
+    0x91, 0xFF, 0xE4, 0xA5, 0xBB, 0xFE, 0xFC, 0xE2, 0x3D, 0x7F, 0x7E, 0xF1, 0x9E, 0xE4, 0x58, 0x76,
+    0xF5, 0xE1, 0xEA, 0xFF, 0x70, 0xBF, 0xEB, 0xD5, 0xFF, 0xC6, 0x15, 0xBE, 0xDD, 0x3F, 0x99, 0xF7,
+    0x1C, 0x4C, 0xEE, 0x49, 0x2E, 0xF2, 0xE7, 0xEE, 0x9E, 0x3F, 0xCB, 0xEE, 0x49, 0x2E, 0xF2, 0x42,
+    0x77, 0xEE, 0xF3, 0x6F, 0x92, 0x1C, 0x3B, 0x75, 0xA5, 0xFA, 0x0A, 0x2F, 0xA4, 0x2E, 0x43, 0xFF,
+    0x17, 0x79, 0x4F, 0x4A, 0xE2, 0xF8, 0xB3, 0x7D, 0xF7, 0xDC, 0xFF, 0xF7, 0x7F, 0xA8, 0x5E, 0xE6,
+    0xBF, 0xAF, 0xEF, 0xE9, 0xB2, 0xAF, 0xA4, 0x17, 0x5E, 0xF1, 0xE5, 0xFF, 0xFC, 0x4D, 0xEE, 0x21,
+    0x23, 0x79, 0xA9, 0xFA, 0x1F, 0xB7, 0xBF, 0x90, 0x5E, 0xE4, 0x9F, 0xB9, 0xDF, 0xF9, 0x33, 0x75,
+    0x0F, 0x17, 0xF9, 0x67, 0xEE, 0x77, 0x0E, 0x1E, 0xDB, 0xA7, 0xFE, 0xFE, 0x9D, 0xF3, 0x47, 0xF2,
+    0xFA, 0xDD, 0xFA, 0xCF, 0xF2, 0xAF, 0x66, 0xFC, 0x9F, 0xD5, 0xCE, 0x4E, 0xF1, 0x4D, 0xFE, 0xCB,
+    0xF3, 0x2F, 0xE6, 0xBC, 0x90, 0xF3, 0x42, 0xCE, 0xB3, 0xC0, 0x97, 0x92, 0xCB, 0xC5, 0x7F, 0xFC,
+    0x5D, 0xBE, 0x4A, 0xAB, 0xAA, 0xDF, 0xE5, 0x08, 0x25, 0x24, 0x5F, 0xE1, 0xD5, 0xEA, 0x85, 0x17,
+    0xBE, 0x7A, 0xCF, 0x3D, 0xEA, 0x7F, 0xE1, 0xDF, 0xA0, 0x5D, 0xD2, 0x72, 0x30, 0xF9, 0x9C, 0xAA,
+    0x7F, 0xE4, 0xBE, 0xE0, 0xD2, 0x96, 0xC0, 0x9B, 0xB5, 0xFF, 0xDA, 0x37, 0xF7, 0x93, 0xAC, 0x89,
+    0x41, 0x37, 0xA5, 0x8B, 0x7A, 0x02, 0xB5, 0x40, 0x3F, 0x1E, 0xFA, 0x07, 0x41, 0x21, 0xB1, 0x22,
+    0x32, 0x52, 0x8A, 0x88, 0x54, 0xB9, 0xC4, 0x95, 0x38, 0x82, 0xF3, 0x2B, 0xBF, 0x13, 0xF8, 0x3E,
+    0x07, 0xC1, 0xCF, 0x68, 0xFD, 0x7B, 0xBF, 0x38, 0x0E, 0xE8, 0x77, 0x64, 0x8C, 0x06, 0xB8, 0x1E,
+    0xE4, 0xC6, 0x59, 0xA9, 0x30, 0x15, 0xA5, 0x47, 0x3B, 0xD2, 0x11, 0x15, 0x41, 0xDE, 0x62, 0x44,
+    0x99, 0x81, 0x34, 0xA0, 0x1D, 0x34, 0xA8, 0x18, 0x6F, 0x16, 0x40, 0x77, 0x18, 0xC8, 0x7A, 0xB4,
+    0x23, 0x0B, 0x28, 0x7F, 0xE0, 0xEC, 0x08, 0x21, 0x93, 0x11, 0x4C, 0x12, 0x35, 0x70, 0xFB, 0x8E,
+    0xBD, 0xBF, 0x9F, 0x49, 0xB2, 0x07, 0xEE, 0x27, 0x6C, 0xDE, 0x9F, 0x70, 0xE0, 0xCD, 0xFC, 0x2A,
+    0x67, 0x6C, 0x39, 0x9F, 0x2C, 0xD8, 0x72, 0xFF, 0x1A, 0xA9, 0x20, 0x6E, 0xEC, 0x1D, 0xB0, 0xE5,
+    0x76, 0xC3, 0xC8, 0x89, 0x88, 0xCF, 0x45, 0x24, 0xA4, 0xD3, 0x7A, 0xBD, 0xDE, 0x8D, 0x2D, 0xE7,
+    0x77, 0xE2, 0xAA, 0x6F, 0xC1, 0x96, 0x2B, 0x3D, 0x51, 0x12, 0xDC, 0x8F, 0x91, 0x75, 0x84, 0xA5,
+    0xF0, 0x33, 0xB6, 0xDC, 0x06, 0x18, 0xFE, 0x1F, 0xD6, 0x6D, 0xC1, 0x16, 0x17, 0x7F, 0x1E, 0x3E,
+    0x68, 0xE3, 0xBF, 0xF6, 0x05, 0xF3, 0xF4, 0x1B, 0x6F, 0xDE, 0xE8, 0xCF, 0x1F, 0x8A, 0x5A, 0x9C,
+    0xC2, 0x65, 0x3E, 0x09, 0xD8, 0x8F, 0x75, 0x40, 0xD6, 0xD1, 0x44, 0x48, 0xB6, 0x5F, 0x6B, 0xD3,
+    0x31, 0x62, 0x2E, 0xC9, 0x20, 0xD3, 0x1C, 0xE9, 0x98, 0x89, 0x44, 0x4D, 0x66, 0x7E, 0xFB, 0x41,
+    0x37, 0x3F, 0xA3, 0xD9, 0xA3, 0x6D, 0xD7, 0x81, 0xFE, 0x80, 0x03, 0xB7, 0xEB, 0xE0, 0xBD, 0xD5,
+    0x7C, 0x20, 0x32, 0x2E, 0x07, 0xD2, 0xA2, 0x1D, 0xEA, 0xC6, 0x5A, 0xFA, 0xF9, 0xE4, 0x3C, 0x50,
+    0x38, 0x94, 0x27, 0x19, 0xE7, 0x03, 0x26, 0x8A, 0x9A, 0xE8, 0xF0, 0x5E, 0xDE, 0x76, 0x10, 0xA1,
+    0x06, 0x68, 0x30, 0xCC, 0x27, 0x5B, 0x50, 0x1E, 0x15, 0x98, 0x40, 0x79, 0x8A, 0x61, 0x19, 0xB1,
+    0x9D, 0x0C, 0xF1, 0xA0, 0x92, 0x0E, 0x94, 0xC8, 0x5B, 0x3B, 0xC8, 0x89, 0x76, 0x66, 0x7A, 0x33,
+    0xBF, 0xE8, 0x05, 0x16, 0x25, 0xC0, 0x6F, 0xA2, 0x20, 0x2E, 0x1A, 0x6F, 0x45, 0xBB, 0xBF, 0x48,
+    0x3F, 0x17, 0x48, 0x17, 0xCF, 0x48, 0xE5, 0xE1, 0x78, 0x89, 0x0A, 0xF3, 0x25, 0xC5, 0xEB, 0xF3,
+    0x3D, 0xC6, 0xB9, 0x40, 0x5F, 0x99, 0x0B, 0xA6, 0xA5, 0x60, 0x3E, 0x23, 0x59, 0x2E, 0x31, 0x17,
+    0x63, 0x41, 0xD9, 0xDB, 0x28, 0x1A, 0x8C, 0x99, 0x8F, 0x0F, 0xB0, 0x8A, 0x05, 0x53, 0xF4, 0x3B,
+    0xF8, 0xF5, 0xE6, 0xC0, 0xC3, 0x71, 0x0E, 0x9C, 0x6E, 0x9D, 0x03, 0xEB, 0x3B, 0xCE, 0x81, 0x1D,
+    0x06, 0xD2, 0xE1, 0xB6, 0x39, 0xF0, 0x7D, 0x27, 0xC7, 0xCD, 0x17, 0xD1, 0x19, 0x50, 0x6D, 0xF2,
+    0x00, 0xC6, 0x0A, 0x8C, 0x10, 0x43, 0x26, 0x6F, 0x51, 0x86, 0x16, 0x0E, 0x4E, 0x65, 0x1E, 0xCC,
+    0x83, 0x61, 0xD6, 0x30, 0x97, 0xAE, 0x70, 0x14, 0x6D, 0xE6, 0xD1, 0x5D, 0x12, 0xA2, 0xCF, 0x63,
+    0xD6, 0x53, 0x38, 0x35, 0x90, 0xF9, 0x34, 0x90, 0x84, 0x64, 0x04, 0xBB, 0x9A, 0xA0, 0x10, 0x81,
+    0x4C, 0xC4, 0x91, 0x8C, 0xDF, 0x08, 0x60, 0xB1, 0x35, 0x85, 0xD3, 0x7E, 0x27, 0x1A, 0xB6, 0xC5,
+    0xA2, 0xC2, 0x26, 0x1A, 0x36, 0xEB, 0x37, 0x61, 0xB7, 0xDA, 0x17, 0x8E, 0x64, 0xCC, 0xFC, 0x0C,
+    0xE8, 0xA8, 0x06, 0xF6, 0x9F, 0xD9, 0xB8, 0xEE, 0xCC, 0x20, 0x2E, 0xC3, 0x0E, 0x41, 0x23, 0x71,
+    0x8F, 0x71, 0x2B, 0xF8, 0xC8, 0x64, 0x81, 0xF2, 0x8A, 0x87, 0x6C, 0xB2, 0x80, 0x5C, 0xF1, 0x50,
+    0x4E, 0x16, 0xB2, 0x6B, 0x57, 0x3C, 0x8C, 0xA7, 0x2C, 0x94, 0x7F, 0x71, 0xC5, 0xA3, 0xFC, 0xB6,
+    0x85, 0x31, 0xBF, 0xE2, 0x29, 0xDC, 0xB6, 0x45, 0xF9, 0xFC, 0x8A, 0x67, 0x62, 0xDB, 0x52, 0xB8,
+    0xFC, 0x8A, 0x57, 0x9E, 0x6D, 0xCB, 0x36, 0xF9, 0x15, 0x5F, 0x38, 0xB6, 0xAD, 0xEA, 0xC9, 0xAF,
+    0xF8, 0x6D, 0xD8, 0xB6, 0x85, 0x23, 0xBF, 0xF2, 0x6E, 0x0F, 0xDB, 0x76, 0x1B, 0xF2, 0x2B, 0xE2,
+    0x60, 0xDB, 0xF6, 0x90, 0x5F, 0x11, 0x60, 0xDB, 0x3A, 0xC8, 0xAF, 0x0C, 0xC0, 0x36, 0x79, 0xAB,
+    0x3C, 0x64, 0x3E, 0xEB, 0x40, 0x5D, 0xDF, 0x6A, 0x81, 0xE8, 0x78, 0x5D, 0x5E, 0xDF, 0xAB, 0xAB,
+    0xB4, 0x40, 0x3A, 0xC4, 0x4C, 0x03, 0x11, 0xE3, 0x39, 0xEA, 0x0C, 0xA3, 0x7A, 0x2B, 0xEA, 0xFC,
+    0xD3, 0x00, 0xA6, 0x62, 0x82, 0x06, 0x9A, 0xE8, 0x2B, 0x5B, 0xA7, 0x31, 0x94, 0x65, 0x00, 0xDD,
+    0xC5, 0x41, 0xA3, 0x3B, 0x50, 0x43, 0x44, 0xCE, 0x2C, 0xEB, 0x4D, 0xCC, 0xC3, 0xEC, 0xA3, 0x1F,
+    0xD3, 0x00, 0x05, 0x00, 0xDD, 0xEF, 0xC2, 0x80, 0xEE, 0x36, 0xEB, 0x06, 0x52, 0x81, 0x92, 0x08,
+    0xC4, 0x3B, 0x00, 0x2A, 0x0A, 0xDC, 0xC7, 0x97, 0x7A, 0x16, 0x7F, 0xE3, 0x20, 0xBF, 0xE2, 0x21,
+    0xBD, 0x1E, 0x80, 0x6D, 0x0B, 0x94, 0xBF, 0x95, 0x42, 0x11, 0x91, 0xBF, 0x11, 0x11, 0xB9, 0x32,
+    0x33, 0xC1, 0x77, 0x48, 0xFB, 0xB8, 0xBB, 0xF0, 0xDE, 0x7A, 0x56, 0x48, 0x66, 0x4B, 0x38, 0x3F,
+    0xA7, 0x16, 0xE3, 0xDE, 0x6E, 0x90, 0xA9, 0x44, 0x26, 0x10, 0x19, 0x31, 0x6F, 0x6D, 0xF9, 0xBC,
+    0xC7, 0xB8, 0x91, 0x64, 0x2C, 0x5D, 0xB4, 0xE2, 0x35, 0xA6, 0x22, 0x7F, 0x77, 0x49, 0xCD, 0xF7,
+    0xEE, 0x8D, 0xF5, 0x7A, 0x1D, 0x41, 0xB1, 0x67, 0xD5, 0x73, 0x1A, 0x36, 0x2A, 0xCF, 0x9A, 0xCF,
+    0xA4, 0xF2, 0xB7, 0x67, 0x5D, 0x2E, 0x12, 0xC8, 0x65, 0xAA, 0x48, 0x8E, 0x93, 0x3C, 0xB7, 0x18,
+    0x1A, 0x28, 0x6B, 0x48, 0x1E, 0xBF, 0xBC, 0x82, 0x98, 0x9D, 0x45, 0x64, 0x60, 0x9F, 0x7D, 0xE6,
+    0xF8, 0x1C, 0xF3, 0x1D, 0x3B, 0xF9, 0x76, 0xB2, 0xAE, 0x28, 0xFF, 0x42, 0x26, 0xF2, 0x77, 0x44,
+    0xBA, 0x54, 0xDE, 0xCA, 0x46, 0x9A, 0x16, 0x53, 0x97, 0x1D, 0x99, 0xCF, 0x3D, 0x84, 0x34, 0x80,
+    0x61, 0x1B, 0xB4, 0x2B, 0x6B, 0x94, 0xCF, 0x3B, 0x08, 0x11, 0x86, 0xFB, 0xC3, 0x17, 0x2E, 0x03,
+    0x6A, 0xCE, 0x03, 0xB6, 0x19, 0x5A, 0x85, 0x9B, 0xBB, 0x84, 0x16, 0x4F, 0x0C, 0xEA, 0x89, 0xC8,
+    0x07, 0x6B, 0x68, 0xAA, 0x68, 0x16, 0xA1, 0xAC, 0xD1, 0xF5, 0x8E, 0x29, 0xCB, 0x88, 0x5C, 0x15,
+    0xB9, 0x39, 0xAD, 0x9F, 0xFF, 0x78, 0x90, 0x18, 0x00, 0xFF, 0xA2, 0xA2, 0x90, 0x91, 0x46, 0x26,
+    0x25, 0xCF, 0xFC, 0xB7, 0xF9, 0x10, 0x79, 0x86, 0xC2, 0xED, 0xA4, 0x61, 0x35, 0x6F, 0xAF, 0x9F,
+    0x35, 0x22, 0xDE, 0x88, 0x78, 0x33, 0x3F, 0x65, 0x53, 0xCF, 0xB1, 0x50, 0x5D, 0x4C, 0xD9, 0xA9,
+    0xE4, 0x99, 0x7F, 0x4F, 0x23, 0x63, 0x8C, 0xD0, 0x3F, 0x0C, 0xFB, 0x8E, 0x93, 0x8B, 0xD4, 0x22,
+    0xA2, 0xAF, 0x3F, 0x1A, 0x6C, 0x74, 0xB9, 0xC8, 0xFC, 0xAC, 0x25, 0xEE, 0x63, 0xE4, 0x4C, 0x21,
+    0x2D, 0xFB, 0xC5, 0xC7, 0x60, 0xBE, 0x72, 0x51, 0x1F, 0x43, 0x32, 0xD6, 0xE8, 0x77, 0xAE, 0x3F,
+    0x2A, 0xA5, 0x48, 0x5F, 0xC8, 0x04, 0x2B, 0x38, 0xA0, 0xDF, 0x0C, 0xD3, 0x67, 0x01, 0xCC, 0x23,
+    0xAF, 0xF6, 0xE3, 0x9D, 0x36, 0x7F, 0x70, 0x40, 0x5F, 0x7C, 0xF3, 0x97, 0x21, 0x9C, 0xFA, 0xEC,
+    0xBE, 0x1D, 0xCB, 0xFE, 0x87, 0x0F, 0x06, 0x27, 0xAD, 0x99, 0x22, 0xAE, 0xEC, 0x8E, 0xD5, 0xE0,
+    0x63, 0xC6, 0x34, 0xCF, 0x9B, 0x34, 0x18, 0x79, 0x4A, 0x7C, 0x39, 0xEC, 0x31, 0x03, 0xB4, 0xCC,
+    0x0B, 0x3A, 0xA0, 0xDF, 0x5E, 0xC7, 0xB1, 0x33, 0x0F, 0xA4, 0x30, 0x8F, 0x2A, 0x3F, 0x0F, 0x31,
+    0xC7, 0xF2, 0xB5, 0xDC, 0x38, 0x4D, 0x32, 0xC4, 0x4C, 0x5A, 0x59, 0x87, 0x11, 0x09, 0x14, 0x35,
+    0x23, 0x79, 0xE0, 0x14, 0xAA, 0x27, 0xEB, 0xD3, 0x9E, 0x68, 0x04, 0x6C, 0x31, 0x15, 0xA6, 0x36,
+    0x73, 0x54, 0x43, 0x88, 0x5F, 0xE7, 0x1E, 0xDD, 0x62, 0x2F, 0x49, 0x85, 0x79, 0xBB, 0x09, 0x26,
+    0x80, 0x88, 0x38, 0xA9, 0x23, 0x57, 0x71, 0xAB, 0x2D, 0xA7, 0x5E, 0x8C, 0x28, 0x6A, 0x88, 0x8A,
+    0xFF, 0x29, 0xB2, 0x97, 0xA6, 0xFE, 0x55, 0x5F, 0x46, 0xBE, 0x41, 0x47, 0x6E, 0xE1, 0xC2, 0xB4,
+    0x5E, 0xCB, 0xFA, 0x6C, 0x88, 0x5F, 0x36, 0xB6, 0x46, 0x77, 0xE8, 0xAB, 0x1D, 0x6A, 0x20, 0xBD,
+    0x19, 0xAF, 0x9C, 0xE2, 0x97, 0x26, 0x7E, 0x69, 0x2F, 0x75, 0xA8, 0xE9, 0xFB, 0xF2, 0xEA, 0x10,
+    0xC9, 0x35, 0x81, 0x91, 0xA9, 0xBA, 0xD3, 0xA0, 0xAE, 0x22, 0x52, 0xAF, 0x11, 0x19, 0xD9, 0x67,
+    0x9F, 0x59, 0xDD, 0x61, 0x50, 0x7F, 0x6F, 0x1E, 0xD4, 0x7E, 0x67, 0x50, 0xBB, 0x3B, 0x0D, 0xEA,
+    0xB6, 0xAC, 0x51, 0x7D, 0xDE, 0xC1, 0x98, 0x0E, 0x60, 0xAA, 0x0F, 0x5F, 0x18, 0xFD, 0xC7, 0xF5,
+    0xCC, 0xEB, 0xA8, 0xF9, 0x9D, 0xDC, 0xE2, 0xB0, 0x63, 0x2A, 0xCA, 0xA7, 0x5B, 0x8A, 0x0B, 0x3D,
+    0xBA, 0x1D, 0xD1, 0x9D, 0xA9, 0x72, 0xAF, 0x5B, 0xD5, 0xAB, 0x5E, 0x0D, 0x8C, 0x69, 0xC0, 0xBC,
+    0x1D, 0xD0, 0x32, 0xA1, 0x44, 0x1C, 0x93, 0x0A, 0x44, 0x00, 0x89, 0xDC, 0xAB, 0x1E, 0x21, 0x5E,
+    0x92, 0x2E, 0xF0, 0x10, 0x6A, 0x88, 0x5E, 0xA9, 0xEB, 0x65, 0xAE, 0x2D, 0xDD, 0xBC, 0x70, 0xA7,
+    0xFD, 0xE2, 0x77, 0x7B, 0x68, 0x0F, 0x8E, 0x51, 0x16, 0x46, 0x90, 0x4B, 0x2D, 0x65, 0x18, 0x51,
+    0x72, 0xA9, 0xE5, 0x7C, 0x18, 0x29, 0x2E, 0x5D, 0x6A, 0x95, 0x0F, 0x23, 0xA7, 0xF4, 0xA5, 0x56,
+    0xBB, 0x30, 0xA6, 0xBD, 0xBE, 0xD4, 0x1A, 0xC2, 0xA8, 0x5B, 0x7D, 0xE9, 0x95, 0x81, 0x30, 0x1A,
+    0xF4, 0xA5, 0x1F, 0x77, 0x84, 0x31, 0xA0, 0x2F, 0x49, 0x45, 0x90, 0x0E, 0x7D, 0x29, 0x40, 0x90,
+    0x1A, 0xED, 0x78, 0x91, 0x93, 0x30, 0x32, 0x82, 0x4D, 0x03, 0x94, 0xE2, 0x21, 0x13, 0x77, 0x6B,
+    0x64, 0x9C, 0x2C, 0x46, 0xEB, 0x7E, 0x31, 0x5A, 0xEB, 0x4E, 0xB7, 0x31, 0x3D, 0xC1, 0x2E, 0xA3,
+    0x35, 0x8B, 0xD1, 0x7A, 0x9C, 0x71, 0x42, 0xEE, 0x64, 0xB4, 0xD6, 0x7B, 0x8D, 0xD6, 0xE9, 0xAF,
+    0x36, 0x5A, 0x5B, 0x07, 0xCD, 0x2D, 0x46, 0xEB, 0x19, 0x57, 0xE8, 0xEA, 0x8C, 0xEF, 0x39, 0x8D,
+    0xD1, 0x67, 0xEC, 0x63, 0x15, 0xCC, 0xC6, 0xB6, 0x29, 0x5A, 0x3E, 0xC3, 0x3C, 0xB1, 0x6B, 0xB7,
+    0x57, 0x85, 0x30, 0x87, 0x8E, 0xE8, 0x57, 0x87, 0x19, 0x86, 0x7D, 0x0E, 0x37, 0xD9, 0x29, 0x28,
+    0x1D, 0x69, 0x00, 0xFD, 0xA3, 0x30, 0xA7, 0x01, 0x28, 0x62, 0x2E, 0x80, 0xC2, 0x8D, 0xA0, 0xDB,
+    0xE8, 0x84, 0x90, 0x4C, 0x50, 0xBA, 0x88, 0x47, 0x9E, 0x0E, 0xB9, 0x8F, 0x01, 0x2C, 0xB5, 0x05,
+    0xDB, 0xCF, 0x09, 0xAF, 0xA4, 0xC6, 0x62, 0x6A, 0xA6, 0x40, 0xEE, 0xD3, 0x40, 0xF9, 0x37, 0x8E,
+    0x09, 0xDD, 0xAA, 0x7E, 0x44, 0xB7, 0x4C, 0xD8, 0xDC, 0x27, 0x81, 0xDC, 0xE7, 0x9D, 0xA5, 0xAC,
+    0x31, 0x55, 0x50, 0x83, 0xEA, 0x51, 0x43, 0xE1, 0x4A, 0x67, 0xA1, 0xF8, 0x61, 0xCF, 0x98, 0x77,
+    0x30, 0x19, 0x72, 0x1F, 0xA2, 0x4F, 0x9B, 0xD9, 0x72, 0x60, 0x46, 0x52, 0xE9, 0x21, 0x15, 0x17,
+    0x93, 0x30, 0xE8, 0x01, 0x9A, 0x36, 0x9A, 0x33, 0xD5, 0x70, 0x9B, 0xC1, 0xBF, 0x70, 0x14, 0x8E,
+    0xFC, 0x4D, 0x4F, 0xE6, 0x49, 0x87, 0x40, 0x12, 0x60, 0x34, 0x15, 0x06, 0xCC, 0x23, 0x2D, 0xBA,
+    0x45, 0xFF, 0x70, 0x40, 0xF5, 0x64, 0xDE, 0xC2, 0x76, 0x4C, 0x3C, 0x58, 0x3A, 0xB6, 0x55, 0x8F,
+    0xF6, 0x98, 0x6A, 0x9B, 0x6C, 0xA4, 0x70, 0x85, 0x53, 0x52, 0xE7, 0x9D, 0xEA, 0x93, 0x9B, 0x5E,
+    0xF5, 0x6C, 0x13, 0xC6, 0x24, 0xA0, 0xDD, 0xC9, 0xC2, 0x9D, 0x27, 0x1D, 0x8C, 0xF2, 0x06, 0x4C,
+    0x51, 0x6D, 0x97, 0x35, 0xF9, 0x1B, 0x4E, 0xBF, 0xE1, 0x40, 0xDA, 0x54, 0x5A, 0x28, 0x3D, 0xC6,
+    0x83, 0xEA, 0xA3, 0x90, 0x93, 0xB7, 0x3B, 0x31, 0xF0, 0xBB, 0xB6, 0x8D, 0x88, 0xB8, 0x3D, 0xDB,
+    0xDB, 0xCF, 0x59, 0xB6, 0x97, 0x57, 0x80, 0x16, 0xB9, 0x1E, 0xD3, 0x0E, 0xD6, 0xE8, 0x1B, 0x6B,
+    0xF1, 0xE8, 0x16, 0x3D, 0xA0, 0x5B, 0x54, 0x88, 0x8F, 0x8B, 0xE8, 0x5D, 0xB2, 0xD9, 0x26, 0x23,
+    0xBA, 0x25, 0x0D, 0xE8, 0x96, 0x6C, 0x40, 0xB7, 0x94, 0x1E, 0x1D, 0xA5, 0x4A, 0x11, 0xA9, 0xD0,
+    0x3B, 0xB3, 0x71, 0xB6, 0x2B, 0x0C, 0x79, 0x73, 0x18, 0x61, 0xFD, 0x1B, 0x91, 0x9E, 0xFD, 0xDF,
+    0xBF, 0xB1, 0xBE, 0xFD, 0x84, 0x3D, 0x87, 0x22, 0x3F, 0x8B, 0x2A, 0x25, 0x32, 0x11, 0x19, 0xB0,
+    0x60, 0xDB, 0x6C, 0x91, 0x39, 0x73, 0x9F, 0x79, 0xD8, 0xC6, 0xCE, 0xDC, 0x6C, 0x1A, 0xB0, 0xEB,
+    0xEF, 0x4B, 0x1D, 0x71, 0xDC, 0xED, 0xAE, 0xD4, 0x4F, 0xD1, 0x31, 0x5C, 0xAE, 0x2F, 0xF2, 0x59,
+    0xE1, 0x48, 0x24, 0xAA, 0x70, 0x8A, 0x91, 0xFD, 0x3F, 0x09, 0x91, 0x8D, 0xCD, 0x7C, 0xE4, 0x72,
+    0x0B, 0x17, 0xF5, 0x2A, 0x36, 0x8A, 0x43, 0x49, 0x98, 0x95, 0x2B, 0x7E, 0x71, 0xE3, 0x8E, 0x02,
+    0x92, 0x5D, 0x3D, 0xFE, 0xDE, 0x6A, 0x75, 0x2C, 0x99, 0x53, 0x80, 0xCD, 0x22, 0x66, 0x55, 0xBC,
+    0xFD, 0xFD, 0x71, 0xB5, 0x3A, 0x3E, 0x03, 0xF9, 0x91, 0x84, 0x8D, 0xC2, 0x65, 0x4E, 0xBA, 0xB0,
+    0xB8, 0x9E, 0x2F, 0x37, 0xCF, 0xFB, 0xF8, 0xB5, 0x9E, 0x91, 0x33, 0xCA, 0x59, 0x92, 0x35, 0x03,
+    0xFC, 0x71, 0x00, 0x23, 0x6B, 0x79, 0xD8, 0x43, 0x29, 0x32, 0x16, 0x8E, 0x59, 0x13, 0xB3, 0xA0,
+    0x73, 0xC2, 0xAA, 0x1A, 0xA1, 0x94, 0x30, 0x82, 0x48, 0x18, 0x51, 0xF2, 0xCC, 0xB9, 0x11, 0xDD,
+    0xC3, 0x48, 0xD1, 0xC2, 0x38, 0x27, 0x4D, 0x88, 0x38, 0x47, 0x06, 0x90, 0xB5, 0xAC, 0xD7, 0xA7,
+    0xA3, 0x40, 0x1C, 0xB7, 0x13, 0x96, 0xE5, 0xDB, 0xCD, 0x99, 0xF5, 0xCE, 0x1D, 0x74, 0xCF, 0x5D,
+    0x23, 0x4A, 0xFE, 0xEA, 0xFC, 0x08, 0x22, 0xE3, 0xB8, 0x40, 0xC9, 0xB2, 0x5A, 0x66, 0xED, 0x38,
+    0x4D, 0x81, 0x8E, 0xDC, 0x59, 0xD4, 0x62, 0x94, 0x0D, 0x80, 0xFA, 0xC5, 0xC0, 0x02, 0xD0, 0x1F,
+    0x93, 0xDD, 0x91, 0x84, 0xCC, 0x03, 0x65, 0x1D, 0x79, 0xE3, 0x74, 0x00, 0x9A, 0xD5, 0x96, 0x03,
+    0x1D, 0x1D, 0xEC, 0xA3, 0x1E, 0xC4, 0xBC, 0x33, 0x35, 0x15, 0xAA, 0x37, 0x5F, 0x0F, 0xD0, 0xA8,
+    0xBE, 0x70, 0xE8, 0xD6, 0x54, 0x13, 0x49, 0x50, 0x7D, 0xE6, 0x23, 0x50, 0x51, 0x95, 0x79, 0xD5,
+    0xA7, 0x81, 0x06, 0x53, 0x45, 0x37, 0x01, 0xA6, 0x34, 0x60, 0xAA, 0xCC, 0xC7, 0x69, 0xF9, 0x7B,
+    0x1E, 0x53, 0xA5, 0x61, 0x9A, 0x0D, 0xF2, 0xB3, 0x27, 0x55, 0x0C, 0x9D, 0x6D, 0x81, 0xA2, 0x01,
+    0xD4, 0xBB, 0x31, 0x89, 0x40, 0x0D, 0x79, 0x1B, 0x80, 0x90, 0x77, 0x50, 0xD6, 0x06, 0xD4, 0x8D,
+    0xEF, 0xF7, 0x60, 0x45, 0x5C, 0xE4, 0x61, 0x92, 0x60, 0xFE, 0xA8, 0xA3, 0x7C, 0xCA, 0x5B, 0x94,
+    0x37, 0x6A, 0xA0, 0x51, 0xBE, 0x70, 0xBA, 0x35, 0x8C, 0x49, 0x50, 0x3E, 0xF7, 0xA6, 0x36, 0x18,
+    0xE5, 0x95, 0x4F, 0x87, 0x6D, 0x0C, 0x85, 0xB3, 0xF3, 0xC2, 0x6F, 0x67, 0xB9, 0xC9, 0xB2, 0x81,
+    0x96, 0x42, 0x7C, 0x64, 0x1D, 0x6F, 0xC4, 0x3C, 0x85, 0xEA, 0xBD, 0x88, 0x31, 0xA7, 0x7C, 0xC4,
+    0x97, 0xC9, 0xBB, 0xED, 0x98, 0x57, 0xB4, 0xB5, 0x33, 0xF6, 0x9C, 0xA9, 0xB1, 0x60, 0xEA, 0xD2,
+    0x61, 0x57, 0xAB, 0xE6, 0x99, 0xAD, 0x76, 0xD6, 0x73, 0xF8, 0x9D, 0xFD, 0xFA, 0xFB, 0x53, 0xF3,
+    0xCE, 0x80, 0x45, 0x0D, 0xC5, 0x77, 0x03, 0x96, 0xCC, 0x17, 0xF5, 0x88, 0x45, 0x77, 0x45, 0xDD,
+    0x60, 0xD1, 0x6D, 0x51, 0xDB, 0xCA, 0x52, 0xBA, 0xA2, 0x36, 0xB5, 0xC5, 0x54, 0x45, 0x5D, 0x38,
+    0x8B, 0xA5, 0xA8, 0x75, 0x67, 0x99, 0x28, 0xEA, 0xDC, 0xDB, 0x64, 0xA4, 0xA8, 0xB3, 0xDE, 0xA6,
+    0x81, 0xA2, 0x56, 0xC1, 0xAA, 0x9E, 0xA2, 0x4E, 0x82, 0xCD, 0x3D, 0x45, 0x3D, 0x67, 0xDE, 0x41,
+    0xF5, 0x20, 0x0E, 0xDD, 0xC6, 0xB9, 0xBC, 0xA2, 0xDC, 0x86, 0x11, 0x42, 0xE4, 0xDE, 0x7E, 0x1A,
+    0xDD, 0x20, 0x94, 0xC7, 0x54, 0x49, 0x98, 0xF9, 0xCB, 0xA2, 0x56, 0xD3, 0xBA, 0x59, 0x37, 0x68,
+    0x89, 0xB0, 0xB7, 0x22, 0x22, 0x81, 0x91, 0x46, 0x5F, 0xE8, 0x55, 0xAF, 0x7A, 0x93, 0x79, 0xDD,
+    0x16, 0x2E, 0xE8, 0xD6, 0x54, 0x93, 0xF2, 0x65, 0x3D, 0x2A, 0xAF, 0x9D, 0x51, 0x7D, 0x59, 0x1B,
+    0x26, 0xDD, 0x8E, 0x84, 0x24, 0x98, 0x87, 0xBD, 0xF2, 0xAA, 0x1F, 0x4D, 0xA5, 0x5D, 0xEE, 0x55,
+    0x1C, 0x81, 0x3A, 0xC6, 0xBD, 0x98, 0x18, 0xE9, 0x61, 0x57, 0xAB, 0x95, 0x75, 0x0B, 0xEE, 0x98,
+    0x2C, 0x39, 0x2E, 0xE6, 0xF8, 0x24, 0xDD, 0x42, 0x32, 0x32, 0xB1, 0xB8, 0xC8, 0xC5, 0x48, 0xBF,
+    0x45, 0x8E, 0x49, 0x23, 0xAF, 0x6B, 0x45, 0xA4, 0x26, 0x9B, 0x1E, 0xBF, 0x2C, 0x35, 0xC6, 0x99,
+    0xAA, 0x89, 0x79, 0x13, 0x26, 0x72, 0xAF, 0xFA, 0x24, 0x60, 0x6A, 0xDD, 0xC6, 0x83, 0x4A, 0x77,
+    0xB9, 0x67, 0xA4, 0x74, 0x33, 0x4B, 0x10, 0x97, 0xAC, 0x3C, 0x76, 0x41, 0xE3, 0x18, 0xC9, 0x7C,
+    0x74, 0x0D, 0x79, 0xDD, 0xA3, 0x5B, 0xCA, 0x7A, 0x03, 0x19, 0xB9, 0xCC, 0x22, 0x6D, 0x4C, 0x83,
+    0x14, 0x5D, 0xDF, 0x30, 0x75, 0x3A, 0xCC, 0x5E, 0x66, 0x73, 0x6A, 0xA5, 0xA8, 0xA4, 0x8A, 0x29,
+    0xAD, 0x4A, 0x91, 0x01, 0x9A, 0xAB, 0x37, 0x27, 0x92, 0x31, 0xEF, 0x6C, 0xA5, 0x86, 0xBC, 0x2B,
+    0x5D, 0xE6, 0xF3, 0x4E, 0xBB, 0xBC, 0xCB, 0xBB, 0xBC, 0xD3, 0x6D, 0xDE, 0x65, 0xBE, 0x70, 0x79,
+    0xA7, 0x7A, 0x53, 0xE5, 0x5D, 0x3A, 0x18, 0xF2, 0x8E, 0xB0, 0x4D, 0xDE, 0x31, 0xD9, 0x18, 0x31,
+    0x14, 0x32, 0x1F, 0x67, 0x32, 0xB7, 0x53, 0x40, 0xB3, 0x5A, 0xAD, 0x6C, 0x1D, 0xA7, 0x2A, 0xDD,
+    0x65, 0x1E, 0xDD, 0xCD, 0x21, 0xAC, 0xA6, 0xA2, 0x21, 0x5B, 0x94, 0x86, 0x76, 0xCE, 0x26, 0x91,
+    0xF9, 0x79, 0x6D, 0xB7, 0xB3, 0xF3, 0x78, 0xF6, 0xDE, 0x6A, 0xF5, 0x98, 0xF8, 0x39, 0x3D, 0xAF,
+    0x0C, 0x8B, 0x66, 0xAE, 0xC7, 0xAE, 0xD7, 0xF2, 0xD7, 0xEF, 0x35, 0x6D, 0xE6, 0x31, 0xB5, 0xA5,
+    0xC1, 0x92, 0xF9, 0xCC, 0xAB, 0x3E, 0xF3, 0x4C, 0x44, 0x8C, 0x24, 0xDD, 0x66, 0x9E, 0x30, 0xEB,
+    0x62, 0x75, 0x6B, 0x31, 0x75, 0xE6, 0xD9, 0xCE, 0xBC, 0xEA, 0xB1, 0x64, 0xDE, 0x62, 0xC9, 0x3C,
+    0xE6, 0x61, 0x9F, 0x7B, 0x2C, 0xE9, 0x60, 0x19, 0xC9, 0x3C, 0xC5, 0x45, 0x1F, 0x2B, 0x35, 0xDA,
+    0x34, 0x10, 0xAB, 0xBD, 0xB0, 0x4C, 0x56, 0x44, 0x82, 0x6E, 0x0B, 0x11, 0x11, 0xD5, 0xAB, 0x69,
+    0xBD, 0x6E, 0xEA, 0x11, 0x53, 0x63, 0x6A, 0x53, 0xA9, 0x9E, 0xB2, 0xD6, 0x2D, 0xA6, 0x9A, 0xBD,
+    0x29, 0x4B, 0xC7, 0x08, 0x66, 0xCB, 0x61, 0xDE, 0x5E, 0x9F, 0x95, 0xB7, 0x62, 0x6F, 0x95, 0x4E,
+    0x89, 0xC8, 0xD5, 0x9B, 0x13, 0x23, 0xF6, 0xEB, 0x7D, 0xE1, 0x4C, 0x65, 0xAA, 0xF3, 0xE9, 0xA0,
+    0xDB, 0xC2, 0x95, 0x95, 0x51, 0xBD, 0xEE, 0xF2, 0x56, 0x77, 0xA3, 0xF2, 0x69, 0x9F, 0x04, 0xF3,
+    0xF5, 0xC0, 0x79, 0xCC, 0x23, 0xED, 0x48, 0x59, 0xE5, 0x6F, 0xF6, 0x96, 0xBC, 0x4D, 0xC2, 0x58,
+    0xD6, 0x69, 0x8F, 0xA9, 0x54, 0x87, 0xAD, 0x94, 0xCF, 0x27, 0xB2, 0xDE, 0x56, 0xD1, 0x29, 0x3A,
+    0x13, 0x48, 0x1A, 0xA9, 0x69, 0x44, 0x3A, 0x2D, 0x6F, 0x8B, 0x37, 0xA7, 0x31, 0xDD, 0x17, 0x67,
+    0x9D, 0x8B, 0xAD, 0x66, 0x5E, 0x71, 0x03, 0x3B, 0x18, 0x33, 0x22, 0x7B, 0x56, 0x8F, 0x4D, 0x31,
+    0xD7, 0x68, 0x29, 0x53, 0xC5, 0x13, 0xDF, 0x97, 0x76, 0x49, 0xAD, 0x53, 0xBA, 0xDD, 0x01, 0xF2,
+    0x69, 0x58, 0x54, 0xED, 0xA6, 0x86, 0x74, 0x8C, 0x5A, 0xFF, 0x47, 0xCF, 0x0A, 0x56, 0xA4, 0xCB,
+    0x45, 0x06, 0xEC, 0xE5, 0x2A, 0xAE, 0x50, 0x31, 0x37, 0xA1, 0x03, 0xEC, 0xDB, 0x67, 0xE5, 0xB4,
+    0xCC, 0x4A, 0x7F, 0x21, 0x39, 0xC6, 0xEF, 0xC7, 0x9E, 0x7B, 0x9A, 0x6D, 0xCE, 0x23, 0x4E, 0x77,
+    0xD3, 0x31, 0xA6, 0x11, 0x8A, 0x89, 0x44, 0xA4, 0x4F, 0x44, 0xA4, 0x36, 0xCF, 0x6C, 0xF5, 0x8B,
+    0x4E, 0x7F, 0xE6, 0x28, 0xD3, 0x21, 0xEA, 0x22, 0x65, 0x88, 0x4A, 0xA3, 0x68, 0x5A, 0x98, 0x16,
+    0x78, 0xE1, 0x61, 0x16, 0x95, 0x66, 0x51, 0xFD, 0xD1, 0xA6, 0x2B, 0x22, 0x80, 0x54, 0xAD, 0xDF,
+    0x3B, 0x16, 0x31, 0xE4, 0x86, 0x99, 0x0C, 0x5A, 0x44, 0x9C, 0x88, 0xF4, 0xFB, 0xD7, 0xCF, 0xFF,
+    0xEB, 0x39, 0xDE, 0x44, 0x79, 0xCC, 0x96, 0x4B, 0x02, 0xFA, 0xC7, 0x1E, 0x8B, 0xFA, 0x65, 0xA0,
+    0x70, 0x8C, 0x0D, 0xD9, 0x87, 0xFD, 0xE2, 0xBD, 0x40, 0xE1, 0x92, 0x60, 0xAA, 0xCC, 0xD3, 0xE8,
+    0x2E, 0x09, 0x98, 0xEF, 0x06, 0x2C, 0x45, 0x6B, 0x5C, 0xE1, 0xB4, 0xCF, 0xC6, 0xCC, 0x97, 0x71,
+    0xB2, 0xED, 0xE7, 0xD8, 0x30, 0x0E, 0xC8, 0x54, 0x6D, 0xD8, 0x97, 0x39, 0xF2, 0xCD, 0xB2, 0x83,
+    0x2D, 0x7D, 0x87, 0x2F, 0x62, 0x26, 0xEE, 0x98, 0x5C, 0xED, 0xC3, 0x6E, 0x0D, 0x79, 0xA7, 0x7A,
+    0xC3, 0x32, 0x8A, 0x93, 0x10, 0xC7, 0xF2, 0xAE, 0xED, 0x78, 0xDB, 0xF6, 0xFC, 0xAE, 0xED, 0x68,
+    0xAA, 0xCD, 0x36, 0x98, 0x3A, 0xEF, 0x92, 0x50, 0xBA, 0xBC, 0x53, 0x83, 0xEE, 0xF2, 0x2E, 0xF7,
+    0xF9, 0x90, 0x77, 0x65, 0xA7, 0xE4, 0xEC, 0xCD, 0x98, 0xB1, 0x76, 0x82, 0xCF, 0x47, 0x7E, 0xA3,
+    0xE8, 0x3E, 0x7A, 0x6D, 0x7F, 0xF3, 0x10, 0x17, 0xB2, 0xF1, 0x0C, 0x8C, 0xE2, 0x8A, 0xC8, 0xC7,
+    0x83, 0xB8, 0x30, 0x9E, 0x72, 0x7A, 0x3F, 0x88, 0x8B, 0xF7, 0x01, 0xAF, 0x98, 0x66, 0xF0, 0x0A,
+    0xBB, 0x03, 0x5E, 0x31, 0xAD, 0xD7, 0x67, 0xAF, 0x8A, 0x88, 0x34, 0x22, 0xB2, 0x03, 0x5E, 0xF1,
+    0x63, 0x0F, 0xE6, 0x11, 0x47, 0x1A, 0xCC, 0x6E, 0xF0, 0x8A, 0xFE, 0x16, 0xF0, 0x8A, 0x6D, 0x80,
+    0xE6, 0xAC, 0x03, 0xE4, 0xDD, 0x1E, 0x90, 0x30, 0x01, 0xB6, 0x2A, 0xDC, 0xEC, 0xCF, 0x8D, 0x6E,
+    0x69, 0x98, 0xD1, 0x50, 0xD3, 0x61, 0xD1, 0x7E, 0x35, 0x0B, 0x0A, 0x6D, 0x59, 0xA3, 0x06, 0x74,
+    0x4B, 0x9C, 0x8D, 0xD1, 0x6D, 0x1A, 0x35, 0xE2, 0x23, 0xB3, 0x89, 0x06, 0xDD, 0xC6, 0xB4, 0x79,
+    0x51, 0x92, 0x8C, 0xB1, 0x09, 0xAF, 0x04, 0x20, 0x1D, 0xB6, 0x01, 0x6C, 0xD4, 0xEC, 0x5D, 0x75,
+    0x2C, 0x01, 0x5C, 0xD8, 0x7E, 0xC7, 0xD7, 0x3E, 0x5D, 0x50, 0xFF, 0xEE, 0x32, 0x35, 0xD8, 0x8B,
+    0x1E, 0x8C, 0x1F, 0xA1, 0xFC, 0x7F, 0xCA, 0x1A, 0xED, 0x32, 0x1F, 0x93, 0x17, 0xA5, 0x7D, 0x34,
+    0x28, 0x28, 0x8F, 0x85, 0x89, 0xB2, 0x8A, 0x29, 0xD6, 0x55, 0x64, 0xD2, 0xD3, 0x01, 0x0A, 0x17,
+    0x40, 0xF5, 0x16, 0xD8, 0x2E, 0xEB, 0x19, 0x25, 0x48, 0x5D, 0xF3, 0x4B, 0x1C, 0x94, 0x1E, 0x99,
+    0xA5, 0xE1, 0xE4, 0xCC, 0x81, 0x67, 0x01, 0xF3, 0xDD, 0x08, 0x28, 0x67, 0xEA, 0x4D, 0x60, 0x44,
+    0xDE, 0x1A, 0x80, 0x73, 0x11, 0xDC, 0xE3, 0xD6, 0xC0, 0xC6, 0xB2, 0x06, 0xCA, 0x77, 0x3C, 0x60,
+    0xC2, 0x08, 0x18, 0x31, 0x35, 0xD1, 0x28, 0x41, 0xEE, 0x67, 0x94, 0xCF, 0x98, 0xA0, 0x2E, 0xCA,
+    0x0E, 0xB3, 0x5E, 0xB1, 0x74, 0x33, 0xA4, 0x6F, 0xDE, 0xC1, 0x84, 0xEA, 0xA1, 0x74, 0xB3, 0x77,
+    0x68, 0x03, 0x4C, 0x98, 0x0A, 0x4A, 0xA7, 0x1D, 0xA8, 0x3E, 0xF7, 0xC0, 0xA4, 0x06, 0xE6, 0x36,
+    0xCD, 0x8D, 0x8A, 0xAD, 0xA2, 0xB8, 0xE4, 0x00, 0x75, 0xD3, 0x03, 0x34, 0x03, 0x1B, 0x2F, 0xFB,
+    0x39, 0x2E, 0xA5, 0xA9, 0xE1, 0xEE, 0x7A, 0xBD, 0xE8, 0xEE, 0x6D, 0x3A, 0x40, 0xD6, 0x99, 0x0A,
+    0xCE, 0x47, 0x8B, 0xF3, 0x51, 0xE0, 0xE0, 0xEE, 0x58, 0xB4, 0xDF, 0x22, 0xE5, 0x77, 0xBF, 0x52,
+    0xD9, 0x60, 0x44, 0x95, 0xB3, 0x51, 0x32, 0x2A, 0x01, 0x67, 0x88, 0x0F, 0x25, 0xD5, 0x72, 0x4D,
+    0x3E, 0x2C, 0xDC, 0x7F, 0xCC, 0xA9, 0x16, 0x79, 0xEC, 0xD2, 0x6D, 0xF0, 0x4A, 0x63, 0x1A, 0x64,
+    0x53, 0x45, 0xD9, 0x39, 0x7A, 0x1C, 0x47, 0x43, 0x9A, 0x1A, 0x0A, 0x87, 0x1A, 0xE2, 0xAA, 0xA4,
+    0xDB, 0x18, 0x3E, 0x12, 0x33, 0x36, 0xE5, 0xF3, 0xA1, 0xF2, 0xE8, 0x36, 0xE2, 0xBA, 0xA8, 0x01,
+    0xED, 0x62, 0x69, 0x12, 0x28, 0xEB, 0x79, 0x31, 0x1B, 0x31, 0xD5, 0x7C, 0xD8, 0x60, 0xB1, 0xD1,
+    0x92, 0x65, 0xD8, 0x5E, 0xD2, 0xE5, 0x98, 0x3A, 0x60, 0x6A, 0xC8, 0x7A, 0x8A, 0x97, 0xA2, 0x44,
+    0x96, 0x7B, 0xF4, 0x8F, 0xFA, 0xA8, 0x33, 0x6E, 0xC9, 0xDF, 0xF4, 0xE4, 0x31, 0x77, 0x9C, 0xBA,
+    0xD6, 0x11, 0x83, 0x2E, 0x51, 0x37, 0x5B, 0x62, 0x80, 0x16, 0x89, 0x38, 0x62, 0x2C, 0x12, 0x48,
+    0x0D, 0xFB, 0xE7, 0x84, 0xA2, 0x1B, 0xEF, 0x81, 0x78, 0xC8, 0x0E, 0x24, 0x3C, 0xBB, 0x26, 0xFC,
+    0x1D, 0x9B, 0xD4, 0x2E, 0xD9, 0x98, 0x1D, 0x5B, 0x0A, 0xC0, 0x7F, 0x2E, 0x6E, 0xC7, 0x99, 0x79,
+    0x47, 0xF5, 0xD6, 0x2F, 0x33, 0xD2, 0xE2, 0x82, 0xD0, 0xC5, 0x14, 0x76, 0xA9, 0xC8, 0x88, 0x05,
+    0xD5, 0xE7, 0xD3, 0xA3, 0x52, 0x99, 0x8A, 0xCC, 0x17, 0x1D, 0xC6, 0x45, 0xBC, 0x9C, 0x8D, 0x86,
+    0xCA, 0xCE, 0x66, 0x9E, 0xD2, 0x35, 0x30, 0x0B, 0x4D, 0x13, 0x51, 0xD3, 0x62, 0x62, 0x76, 0xB7,
+    0x34, 0xC4, 0x48, 0x06, 0x35, 0x10, 0xA2, 0x32, 0x4C, 0x0D, 0x4C, 0x49, 0x98, 0x73, 0xBF, 0xD9,
+    0x74, 0x60, 0x1B, 0x54, 0x8F, 0x79, 0xA8, 0x9F, 0xAD, 0xBD, 0xE5, 0xF7, 0xFC, 0x8C, 0xA5, 0xA6,
+    0x5F, 0xEE, 0x28, 0x1D, 0xBA, 0x43, 0x5F, 0x72, 0xE8, 0x0E, 0xE3, 0xC8, 0xAE, 0x3A, 0xB2, 0xE9,
+    0x51, 0x89, 0x2A, 0xAE, 0x08, 0x4A, 0x95, 0x0A, 0xC4, 0xA9, 0x2F, 0x8A, 0x0D, 0xC7, 0xF7, 0x10,
+    0x6A, 0x87, 0x4E, 0x3B, 0x4A, 0x98, 0x1D, 0x2A, 0x6D, 0xF8, 0xB7, 0xD9, 0xE8, 0xC4, 0x1C, 0xC4,
+    0x11, 0x07, 0xD4, 0xE6, 0x26, 0x4D, 0xB7, 0xFB, 0x5E, 0x71, 0xFE, 0xDA, 0x2F, 0x53, 0x15, 0xF9,
+    0xF8, 0x36, 0xAA, 0x77, 0x3B, 0x32, 0x79, 0x24, 0x58, 0x8F, 0xE9, 0x0E, 0x54, 0xA5, 0x8F, 0xCC,
+    0x4F, 0x1B, 0x01, 0x84, 0x5C, 0x03, 0x60, 0x1F, 0x8A, 0x09, 0x6B, 0x8A, 0x96, 0x4D, 0xA6, 0xD1,
+    0xEC, 0x97, 0xD1, 0x0A, 0xF6, 0xE3, 0x08, 0x3D, 0xB7, 0xE5, 0x00, 0xC6, 0x28, 0x29, 0xCC, 0x5F,
+    0xBD, 0x1E, 0x35, 0x17, 0x8F, 0xB7, 0x3B, 0xB0, 0x58, 0xDA, 0x47, 0x3B, 0xDA, 0x77, 0xA6, 0xD8,
+    0x91, 0x47, 0xA0, 0xE8, 0xD4, 0xC8, 0xB1, 0x44, 0xC8, 0x26, 0x3D, 0x58, 0x1F, 0x39, 0xE2, 0x25,
+    0xC4, 0x9C, 0xA4, 0x89, 0x62, 0xF5, 0x1C, 0xE8, 0x54, 0xB6, 0x77, 0x50, 0x48, 0xCD, 0x28, 0x04,
+    0x4D, 0x8C, 0x8B, 0x13, 0x97, 0x48, 0x23, 0x01, 0xC9, 0x3A, 0xEB, 0x04, 0x54, 0x6F, 0xAA, 0x19,
+    0x60, 0x49, 0xBF, 0xDC, 0xCD, 0x08, 0x4B, 0x4C, 0xE3, 0x12, 0x54, 0xAA, 0xAF, 0x76, 0xF3, 0x32,
+    0x15, 0xC5, 0x08, 0xAB, 0x5B, 0x28, 0x7F, 0x18, 0xA0, 0x68, 0xCD, 0x4B, 0xA1, 0xF0, 0x4A, 0x44,
+    0x3C, 0x46, 0xA4, 0x23, 0x11, 0x39, 0x0D, 0x6A, 0xDA, 0xE1, 0x59, 0x22, 0xD0, 0x26, 0x90, 0x2D,
+    0xCE, 0x5F, 0x46, 0xE4, 0x59, 0x80, 0xA4, 0xDF, 0x1F, 0x4D, 0x7F, 0xD9, 0x4B, 0xCF, 0xFE, 0xE9,
+    0x2D, 0x8F, 0xAD, 0x5C, 0x9E, 0xDA, 0xE2, 0xB0, 0xC9, 0x0F, 0x96, 0x82, 0xE5, 0x29, 0xDE, 0x92,
+    0x1C, 0x25, 0x93, 0x36, 0x42, 0x94, 0x45, 0x07, 0x96, 0x9A, 0x62, 0x6A, 0x5C, 0xF1, 0x8E, 0xD4,
+    0x48, 0xF5, 0x59, 0xBE, 0x4A, 0x53, 0x47, 0x98, 0x3B, 0x9A, 0x39, 0x40, 0x8C, 0x29, 0x6A, 0x65,
+    0x16, 0x31, 0x6E, 0x21, 0x04, 0x4B, 0xD4, 0x13, 0x33, 0xD8, 0xD7, 0xAE, 0xB8, 0xB1, 0x39, 0xBD,
+    0xC3, 0x8E, 0x86, 0x02, 0xF4, 0xCB, 0x73, 0x58, 0x81, 0x5D, 0x2C, 0x3A, 0x61, 0x76, 0x07, 0xCA,
+    0x7E, 0x3E, 0xC7, 0x15, 0x94, 0x17, 0xFA, 0xF8, 0x18, 0x26, 0x1D, 0x25, 0x78, 0xD5, 0xCF, 0x39,
+    0x4F, 0x4B, 0x67, 0x6A, 0x32, 0x4F, 0x32, 0xD1, 0xD4, 0x94, 0x0E, 0xED, 0x91, 0x3A, 0x95, 0x36,
+    0x91, 0x3A, 0x91, 0x1B, 0x22, 0x37, 0x9A, 0x81, 0x24, 0xBA, 0x46, 0xD5, 0xD0, 0xC8, 0xE9, 0x38,
+    0x1E, 0xF6, 0x55, 0xB7, 0x60, 0x38, 0x34, 0xED, 0x4C, 0xDA, 0xB7, 0x00, 0xB2, 0xCB, 0x8D, 0x44,
+    0x60, 0x67, 0xEB, 0x81, 0xFD, 0x0F, 0xF9, 0xE8, 0x45, 0x61, 0xEB, 0x9D, 0x90, 0xE0, 0x05, 0x77,
+    0x72, 0x06, 0xAC, 0x58, 0x20, 0x2D, 0x6E, 0xB5, 0xDB, 0xFF, 0x0B, 0xD8, 0x7F, 0x0C, 0x1A, 0xA1,
+    0x90, 0x0E, 0x23, 0x3E, 0x11, 0x71, 0xFA, 0xFA, 0x7F, 0xC3, 0xE7, 0x1E, 0x9D, 0xE6, 0xBC, 0x32,
+    0xBD, 0xA9, 0x61, 0x49, 0x9E, 0xB8, 0xA1, 0xD0, 0xDC, 0xF1, 0x99, 0x22, 0x3B, 0x90, 0x5F, 0xED,
+    0xE0, 0x18, 0x6C, 0x4F, 0x50, 0xD6, 0xE4, 0x57, 0x3B, 0xD2, 0x21, 0x42, 0xEC, 0x95, 0x35, 0xFA,
+    0x8A, 0x27, 0x1D, 0xE2, 0x5C, 0x5F, 0xD6, 0x94, 0x17, 0x02, 0x6A, 0x40, 0x0D, 0x85, 0xA7, 0xE9,
+    0x10, 0x9A, 0xCB, 0x8D, 0x5C, 0x6E, 0xBA, 0x54, 0xC4, 0x47, 0x99, 0x70, 0x48, 0x65, 0x8C, 0x2C,
+    0xD1, 0x71, 0x6E, 0x09, 0x57, 0x0A, 0x8B, 0x57, 0x4C, 0x0D, 0xF0, 0xD5, 0x8C, 0x17, 0x00, 0x52,
+    0xBE, 0x98, 0xDC, 0x21, 0x2A, 0x72, 0x81, 0x36, 0xBA, 0x5D, 0x35, 0xBD, 0x14, 0xCC, 0xAA, 0xE9,
+    0x8D, 0xAE, 0xBA, 0x78, 0x29, 0xC4, 0x44, 0x83, 0x21, 0x2A, 0x39, 0x63, 0xA4, 0x56, 0xD1, 0xC5,
+    0xE0, 0xDB, 0x54, 0x88, 0x8B, 0x8C, 0xF1, 0x31, 0x90, 0x2B, 0x93, 0x2A, 0x26, 0xD6, 0x92, 0x81,
+    0xCC, 0xAB, 0x01, 0x7D, 0xD5, 0xD1, 0x50, 0xBA, 0xF4, 0x7A, 0x40, 0x77, 0x8C, 0x98, 0x47, 0x5A,
+    0x46, 0x74, 0x97, 0xF9, 0x86, 0xC2, 0xD1, 0xB0, 0x9D, 0xF9, 0x74, 0x40, 0xF5, 0xDA, 0x99, 0xDA,
+    0x54, 0x98, 0xEF, 0x84, 0x34, 0x64, 0x9E, 0x24, 0x94, 0x95, 0x6E, 0xB7, 0x41, 0xBF, 0xE9, 0x69,
+    0xB4, 0x03, 0x1B, 0x45, 0x12, 0x94, 0xB4, 0x94, 0x52, 0x45, 0xC3, 0xBB, 0xF8, 0xB8, 0xDE, 0xE4,
+    0xE3, 0x6C, 0x2B, 0x31, 0xF5, 0xEE, 0x28, 0xD0, 0xD5, 0x82, 0x9A, 0x28, 0x01, 0x28, 0xBE, 0x71,
+    0xF9, 0x24, 0xA0, 0xAA, 0xFF, 0x2C, 0xE3, 0xCE, 0xAF, 0x24, 0x2A, 0xB0, 0xB7, 0x0D, 0x58, 0x28,
+    0x9F, 0x76, 0x14, 0x0E, 0xFD, 0x6A, 0x8F, 0xF2, 0xA8, 0x3E, 0xE2, 0x88, 0x85, 0xB2, 0xC6, 0x54,
+    0xD8, 0xC8, 0x0E, 0x15, 0x2E, 0x90, 0x06, 0xF2, 0xCE, 0x54, 0x48, 0xB4, 0x1D, 0xD9, 0x36, 0x09,
+    0x49, 0xC0, 0x0C, 0x6C, 0x63, 0xAA, 0xA2, 0xC1, 0x54, 0x79, 0xA7, 0x2F, 0xB5, 0x85, 0x23, 0x64,
+    0xAF, 0x84, 0xBC, 0xA5, 0x7C, 0xCA, 0x1B, 0xE5, 0x51, 0x3F, 0xEF, 0xF3, 0x9F, 0x0E, 0x70, 0x3E,
+    0x30, 0x06, 0xD0, 0x23, 0x65, 0x5C, 0x08, 0x94, 0x30, 0xAB, 0x10, 0x36, 0xEE, 0xA3, 0x32, 0x55,
+    0x11, 0xDF, 0x4F, 0xC5, 0xBC, 0x3D, 0x1D, 0x45, 0x44, 0x37, 0xC9, 0x77, 0xE5, 0x8B, 0x75, 0x9B,
+    0xF5, 0xC1, 0xEE, 0x08, 0x5B, 0xCD, 0x0E, 0x24, 0xE8, 0x9D, 0x0F, 0x6D, 0xB5, 0xB9, 0xCC, 0x38,
+    0x66, 0x79, 0x77, 0xE6, 0x4C, 0x6C, 0x4B, 0x4C, 0xA4, 0x0A, 0xB9, 0xDC, 0x78, 0x11, 0x8A, 0x19,
+    0x62, 0x70, 0x00, 0x12, 0x5B, 0xEF, 0x5C, 0xF9, 0x61, 0x0E, 0x93, 0x15, 0x6C, 0xC9, 0x90, 0x8A,
+    0x84, 0x7C, 0x7A, 0x74, 0x28, 0xBA, 0x59, 0xDB, 0x57, 0x31, 0xB3, 0x91, 0xF1, 0x3D, 0xCE, 0xEF,
+    0xE5, 0x73, 0xC3, 0x8E, 0x66, 0xB0, 0xE8, 0x20, 0x9F, 0xFE, 0xCA, 0xA5, 0x22, 0x8E, 0x2D, 0x71,
+    0xF0, 0xF8, 0x1C, 0x03, 0xF0, 0x41, 0xEF, 0xB9, 0xFB, 0x77, 0x11, 0xA8, 0x22, 0x45, 0x3B, 0xF2,
+    0xB6, 0xAC, 0xC8, 0x47, 0x03, 0x49, 0xEC, 0x1C, 0x31, 0x36, 0xBA, 0x82, 0x4C, 0x3C, 0xE8, 0x8B,
+    0x13, 0x94, 0xD5, 0xC9, 0xDF, 0xC5, 0x70, 0x97, 0x71, 0x01, 0x8A, 0xEB, 0xC3, 0x92, 0xBB, 0xA7,
+    0xEC, 0x99, 0x73, 0x54, 0x97, 0x4D, 0x07, 0xA7, 0xF2, 0x01, 0x02, 0x2F, 0xC4, 0xA9, 0x26, 0xDA,
+    0xFF, 0x77, 0x2D, 0x4C, 0x49, 0x07, 0xFA, 0x55, 0x11, 0x79, 0x44, 0x64, 0x30, 0xC0, 0x9F, 0x44,
+    0x9C, 0x32, 0x28, 0xE5, 0xC1, 0x2D, 0x11, 0x2D, 0xF5, 0x49, 0x73, 0x3A, 0x82, 0xD3, 0x53, 0x5C,
+    0x7A, 0xB7, 0x7F, 0x51, 0x57, 0x2F, 0x82, 0xBE, 0xD8, 0x9F, 0xD2, 0x7F, 0xF4, 0x74, 0x05, 0x90,
+    0xC8, 0x69, 0x8C, 0xBC, 0x95, 0xFF, 0x07, 0x99, 0x06, 0x9A, 0x5F, 0x56, 0xB3, 0x9F, 0xD8, 0xC1,
+    0x5D, 0xEB, 0xC1, 0xA6, 0xDF, 0xEB, 0x1D, 0xC5, 0xFE, 0xFD, 0xC9, 0x86, 0x45, 0x38, 0xC2, 0xB7,
+    0x79, 0xFF, 0x57, 0x36, 0x6D, 0x78, 0xEF, 0x32, 0x46, 0xBB, 0x8A, 0x87, 0x07, 0xBE, 0xD1, 0x02,
+    0xF9, 0x33, 0x2F, 0xC2, 0xB7, 0xE9, 0x80, 0xCF, 0x71, 0x64, 0xF9, 0xD1, 0xBB, 0xEE, 0x14, 0xFE,
+    0xF9, 0x21, 0x5F, 0xCB, 0x5C, 0xBE, 0x8F, 0x7C, 0x66, 0xE4, 0x12, 0xE9, 0xCA, 0x99, 0xBD, 0x53,
+    0x32, 0x1C, 0x49, 0x63, 0x0B, 0xF2, 0xEA, 0xC4, 0xB7, 0x63, 0xB6, 0x27, 0x34, 0x7F, 0xC8, 0x6F,
+    0xE0, 0x75, 0x6C, 0xA1, 0xFC, 0xFC, 0xCB, 0xD1, 0x7E, 0x24, 0x6E, 0x59, 0xB0, 0xE3, 0x2F, 0xEB,
+    0xEA, 0xC4, 0x4E, 0x8B, 0xBF, 0xF2, 0x01, 0xB7, 0x53, 0x52, 0x7D, 0x2C, 0xAA, 0xDF, 0xB7, 0x73,
+    0x87, 0x1D, 0xB8, 0xE4, 0x73, 0x3B, 0x06, 0xDD, 0xCD, 0xB3, 0x4C, 0xFA, 0x4D, 0x94, 0x4C, 0x59,
+    0x2D, 0x17, 0xCC, 0x1E, 0x70, 0x1C, 0x8D, 0xA3, 0xE2, 0x07, 0x1B, 0x03, 0x43, 0xB3, 0xE9, 0xED,
+    0x4D, 0xB7, 0x98, 0xD3, 0xAD, 0x5F, 0xBA, 0x64, 0xE4, 0xAF, 0xEF, 0x07, 0xF8, 0x2C, 0x70, 0xE7,
+    0xB8, 0xF9, 0x0F, 0xF7, 0xE0, 0xEE, 0x22, 0xBF, 0xBE, 0x61, 0xE5, 0xED, 0xFC, 0x0C, 0xF5, 0x54,
+    0xD9, 0xB9, 0x66, 0x32, 0xB1, 0xB5, 0x20, 0xD2, 0x76, 0xFC, 0x46, 0x5E, 0x5F, 0x05, 0xC8, 0x77,
+    0x9C, 0x6C, 0x36, 0xEE, 0x77, 0xA9, 0xB8, 0x79, 0x26, 0x8B, 0xE1, 0xC2, 0xD1, 0x8B, 0x25, 0x2E,
+    0x56, 0x03, 0x50, 0x83, 0x76, 0x73, 0xCA, 0x7B, 0x92, 0x61, 0x86, 0xB1, 0xDA, 0xD0, 0x73, 0x71,
+    0x60, 0xDA, 0x90, 0xF4, 0xF6, 0x07, 0xF3, 0xA5, 0x05, 0xAC, 0x31, 0x79, 0x0E, 0xB2, 0x2E, 0xFE,
+    0x00, 0x99, 0x87, 0x74, 0xFC, 0xE7, 0x53, 0xB4, 0x14, 0xD6, 0x40, 0x21, 0xA7, 0xB9, 0x1D, 0x49,
+    0x28, 0x9A, 0xE1, 0x12, 0x89, 0x33, 0x98, 0xCF, 0x3C, 0x68, 0xC1, 0x42, 0x22, 0x3E, 0xF3, 0x60,
+    0xCE, 0x62, 0x41, 0xBF, 0xEB, 0x33, 0x4F, 0x32, 0x1A, 0x2C, 0x98, 0xA7, 0x7C, 0xE6, 0xD1, 0xDE,
+    0x60, 0x49, 0x46, 0xE5, 0xA3, 0x21, 0x07, 0x4B, 0xEE, 0x95, 0xCF, 0x7C, 0x32, 0x62, 0xB0, 0x98,
+    0x5A, 0xF9, 0xCC, 0xE7, 0x1E, 0x83, 0x4D, 0x46, 0x94, 0xCF, 0x3A, 0x53, 0x63, 0x38, 0x95, 0x7B,
+    0x94, 0xCF, 0x7E, 0x32, 0x82, 0xE1, 0x94, 0xA9, 0x51, 0x3E, 0x7B, 0xC7, 0x83, 0xC1, 0x8E, 0xA0,
+    0x7C, 0x26, 0x35, 0x18, 0xAC, 0x07, 0x25, 0x57, 0x46, 0xC0, 0x8C, 0xB6, 0x06, 0x35, 0x0F, 0xC0,
+    0xB0, 0x41, 0xFD, 0x58, 0x5C, 0xC0, 0x66, 0xDE, 0x76, 0xE6, 0x28, 0xA7, 0xBD, 0x2C, 0x6B, 0x52,
+    0x45, 0x24, 0x0C, 0xD5, 0xCF, 0x22, 0xB6, 0x69, 0x8B, 0x6E, 0x06, 0x2A, 0x4E, 0xA3, 0x2C, 0xBC,
+    0x87, 0x77, 0x43, 0xB7, 0xA4, 0xC2, 0x08, 0xC6, 0xEB, 0x16, 0x2D, 0x8C, 0x24, 0xE2, 0x75, 0x8B,
+    0xB1, 0x8C, 0xE4, 0xAF, 0x7A, 0xDD, 0x26, 0xC1, 0x30, 0x62, 0x94, 0xD7, 0x6D, 0xDE, 0xCD, 0x56,
+    0x23, 0xDD, 0x9A, 0xCA, 0x30, 0xE6, 0x9D, 0xF2, 0xBA, 0x0D, 0x18, 0x46, 0x53, 0x29, 0xAF, 0x2F,
+    0x76, 0x18, 0xC6, 0x80, 0xF2, 0x5A, 0x2A, 0x0C, 0xE2, 0x51, 0x72, 0x29, 0x80, 0x09, 0x52, 0xCF,
+    0x6D, 0x8A, 0x1C, 0x60, 0x59, 0x6D, 0x26, 0x67, 0xBB, 0xA3, 0x80, 0x8B, 0x6B, 0x9D, 0x8B, 0x32,
+    0x51, 0xCC, 0xF8, 0x1E, 0x80, 0x64, 0xEB, 0xB5, 0xE3, 0x60, 0x44, 0x1C, 0x4A, 0x24, 0xC0, 0xBD,
+    0xD3, 0xBA, 0xDE, 0x7D, 0xC2, 0x9E, 0xC3, 0xD7, 0xA2, 0x42, 0x4C, 0x6A, 0x0A, 0x11, 0xA9, 0x93,
+    0x69, 0x7D, 0x76, 0xA2, 0x70, 0x14, 0x7D, 0x12, 0xC0, 0xD4, 0x85, 0x8B, 0x02, 0xF9, 0x82, 0x52,
+    0x16, 0x99, 0xE1, 0xC2, 0xCD, 0x49, 0x4C, 0x9A, 0xBA, 0x70, 0xD8, 0xE8, 0xC1, 0x4E, 0x21, 0x32,
+    0x91, 0x88, 0x5C, 0xE7, 0xF6, 0xE4, 0x5E, 0xED, 0xB2, 0x9A, 0x96, 0x22, 0x8E, 0x5C, 0xC4, 0x93,
+    0x3C, 0x7E, 0xF9, 0xF8, 0xED, 0xAE, 0x7A, 0x77, 0xF4, 0xDF, 0xDB, 0x55, 0x28, 0x32, 0x9D, 0xC6,
+    0x2C, 0xC6, 0x20, 0xAF, 0xFA, 0xF9, 0x91, 0x14, 0xCE, 0x54, 0xA8, 0x7E, 0x93, 0xC7, 0xCB, 0x32,
+    0x82, 0xAD, 0xCD, 0xDB, 0xDF, 0x17, 0xA7, 0x45, 0xC4, 0x29, 0x89, 0x6E, 0xBB, 0x3F, 0xAB, 0x92,
+    0xC5, 0x1C, 0xE3, 0x0B, 0x97, 0x34, 0x9D, 0x05, 0xF3, 0x4A, 0x58, 0xE0, 0x6B, 0x0B, 0x17, 0x05,
+    0xC3, 0xEC, 0xE7, 0x01, 0xCA, 0x8B, 0x3E, 0xAB, 0xA7, 0xC2, 0x99, 0xEF, 0xF5, 0x16, 0xD3, 0xBC,
+    0x34, 0xAE, 0x9A, 0x90, 0x89, 0x88, 0x2B, 0x44, 0x46, 0xEC, 0xFA, 0x2F, 0x43, 0x12, 0xA2, 0xC1,
+    0x33, 0xED, 0x0A, 0x47, 0xF2, 0xAB, 0x13, 0x2F, 0x30, 0xA3, 0x72, 0x4F, 0x04, 0x2B, 0x41, 0x5F,
+    0x7D, 0xCD, 0xEE, 0x41, 0x54, 0xD7, 0x6F, 0xF8, 0xC8, 0x89, 0xEF, 0xCA, 0xEA, 0xD7, 0xED, 0xCA,
+    0xEA, 0xD7, 0x08, 0x9F, 0xD1, 0x57, 0xBD, 0xEA, 0x46, 0xA9, 0xCB, 0xB3, 0x97, 0x26, 0x64, 0x90,
+    0xE9, 0x31, 0xD1, 0x3F, 0x16, 0x71, 0x63, 0x21, 0xA3, 0x6E, 0xF7, 0x3D, 0xE4, 0x47, 0x28, 0x9E,
+    0x6E, 0xE1, 0xD9, 0x71, 0x21, 0xDD, 0xED, 0x07, 0xF3, 0x5A, 0xB2, 0xC7, 0x13, 0xC4, 0x00, 0xFA,
+    0xA2, 0x88, 0xFC, 0x7C, 0x49, 0xBF, 0x57, 0xB8, 0x58, 0xED, 0x64, 0x41, 0x10, 0xFD, 0x44, 0x0A,
+    0xA2, 0x7E, 0x2F, 0x8F, 0x82, 0xC6, 0xF6, 0x2C, 0x76, 0x88, 0xDC, 0x14, 0x99, 0xA6, 0xD5, 0xEA,
+    0x63, 0xE6, 0xD8, 0x62, 0x8E, 0xAA, 0xD8, 0x6C, 0xC2, 0x66, 0x80, 0xFC, 0xEA, 0xCD, 0x7F, 0x3A,
+    0xAD, 0xCF, 0x44, 0xA7, 0x4C, 0x23, 0x32, 0x44, 0xA3, 0x4A, 0xF2, 0xF1, 0x36, 0x71, 0xB1, 0x95,
+    0x51, 0x89, 0x8C, 0x6A, 0x5A, 0x3F, 0xAF, 0xFA, 0x39, 0xC1, 0xCA, 0xAE, 0xF7, 0xEF, 0x5D, 0x5F,
+    0xD1, 0x88, 0xB8, 0x46, 0xC4, 0xFD, 0xDE, 0xF5, 0x15, 0x77, 0x3A, 0x67, 0xF7, 0xDB, 0x8A, 0x48,
+    0x4C, 0x2C, 0x9A, 0x89, 0x88, 0xFF, 0xC8, 0x90, 0x75, 0x4F, 0x3C, 0x0F, 0x85, 0xC8, 0x48, 0x26,
+    0x22, 0x5D, 0x32, 0x3E, 0xB8, 0x15, 0x71, 0x6B, 0x7D, 0xE1, 0x50, 0x3B, 0xEE, 0xD7, 0x59, 0x6F,
+    0x17, 0x68, 0x8B, 0xF2, 0xA2, 0x87, 0xFC, 0xE7, 0x61, 0xC9, 0xAA, 0x68, 0x77, 0x0A, 0xFD, 0x66,
+    0x4D, 0x9B, 0x36, 0x2C, 0xB9, 0x71, 0x40, 0xD9, 0x71, 0x90, 0xD2, 0xA3, 0xDF, 0x16, 0x1F, 0xB1,
+    0xD2, 0x69, 0xA4, 0x9D, 0x1D, 0x0B, 0x66, 0x19, 0xB0, 0x16, 0x91, 0x5A, 0xD6, 0xEB, 0x6A, 0xDC,
+    0xC5, 0x3C, 0x6F, 0x98, 0xE8, 0xF5, 0x31, 0x44, 0x26, 0x44, 0xC4, 0x4D, 0x0F, 0x36, 0x7E, 0x24,
+    0x1F, 0x46, 0x54, 0x18, 0x61, 0x1C, 0xA3, 0xE2, 0xA3, 0xD9, 0xFD, 0x9E, 0xF9, 0xED, 0xED, 0x58,
+    0x95, 0x64, 0x04, 0x15, 0x92, 0x2A, 0xEF, 0xD3, 0x49, 0x7C, 0x2A, 0x52, 0x2F, 0xFA, 0xA4, 0xFF,
+    0x1F, 0xED, 0xBD, 0x4F, 0xAC, 0xDF, 0xC6, 0x9D, 0xE0, 0xF9, 0x21, 0xCB, 0x4F, 0x9C, 0x36, 0xD1,
+    0x5D, 0x3E, 0x58, 0xFD, 0xC7, 0x02, 0x9A, 0x7B, 0xC8, 0x00, 0xD3, 0x1E, 0x58, 0xDC, 0x63, 0x63,
+    0x21, 0xBD, 0x2A, 0xDB, 0xBB, 0xED, 0x43, 0x1F, 0xFC, 0x7A, 0x46, 0xBF, 0x18, 0x98, 0x1C, 0xD4,
+    0xC0, 0xE4, 0xD0, 0xAB, 0xEC, 0xCE, 0xEB, 0xC3, 0x0E, 0xE0, 0x01, 0x64, 0x91, 0x89, 0x81, 0xCD,
+    0x21, 0x07, 0xAB, 0x31, 0xED, 0xDE, 0x05, 0xF6, 0x10, 0x1F, 0x3C, 0x80, 0xFD, 0x33, 0x66, 0x74,
+    0xC9, 0x41, 0x3D, 0xFD, 0xF4, 0x58, 0xB1, 0xB0, 0xEB, 0x83, 0x0F, 0x62, 0xAC, 0x4D, 0xFB, 0x10,
+    0x60, 0xCD, 0x24, 0xF6, 0x78, 0x23, 0x03, 0xAB, 0x72, 0x4C, 0xC7, 0x94, 0x54, 0xE4, 0x77, 0x0F,
+    0x45, 0xFE, 0xDE, 0x7B, 0xB2, 0xFC, 0x37, 0x49, 0x23, 0xBD, 0x58, 0x4A, 0xAF, 0x58, 0x2C, 0xF2,
+    0x47, 0x56, 0x7D, 0xAB, 0xEA, 0x5B, 0xDF, 0xFF, 0x65, 0x2C, 0x59, 0x4B, 0x12, 0xD2, 0x00, 0xFB,
+    0x60, 0x6A, 0xED, 0xC9, 0x3B, 0xB4, 0xC7, 0xD4, 0xEC, 0x93, 0x06, 0x98, 0xC8, 0x3B, 0x1A, 0xC8,
+    0x7A, 0xF6, 0x29, 0x5A, 0x28, 0x5D, 0xDE, 0xA9, 0x01, 0x10, 0xF6, 0x11, 0x40, 0x0D, 0x79, 0x57,
+    0x3A, 0x40, 0xB7, 0xFB, 0x99, 0x07, 0xA8, 0xFE, 0xF4, 0xC7, 0x23, 0x40, 0x1A, 0xF6, 0x4D, 0x0D,
+    0xA0, 0xEF, 0xDC, 0xF4, 0x00, 0x54, 0x32, 0x02, 0xA0, 0xDF, 0x7B, 0xCF, 0x03, 0xA8, 0xB0, 0x6F,
+    0x1C, 0x40, 0x93, 0x77, 0x02, 0x50, 0xB6, 0xFB, 0x6A, 0x00, 0xB2, 0x3E, 0xEF, 0x8A, 0x16, 0x98,
+    0xD8, 0xA7, 0x01, 0x8C, 0xCB, 0x3B, 0x15, 0x20, 0xF7, 0xEC, 0xA3, 0x3B, 0x92, 0x91, 0xBC, 0xA3,
+    0xB2, 0x73, 0x4D, 0x47, 0xE6, 0xAA, 0xCB, 0xD5, 0xB9, 0x2D, 0xA1, 0xB1, 0xE4, 0x1D, 0x89, 0x38,
+    0xE2, 0x11, 0xE6, 0xB3, 0xFE, 0xE2, 0x05, 0x9B, 0x23, 0x0D, 0xE4, 0x1D, 0xA5, 0xD3, 0x1D, 0xFB,
+    0xE4, 0x1E, 0x53, 0xE7, 0x5D, 0x12, 0x60, 0x64, 0x9F, 0xCA, 0x92, 0xF9, 0xBC, 0xD3, 0x2D, 0x94,
+    0x2E, 0xB6, 0xA2, 0xC9, 0xBB, 0x09, 0x50, 0xC3, 0x7E, 0x04, 0xD0, 0x7B, 0xEF, 0x7A, 0x00, 0x13,
+    0xA1, 0x90, 0xDF, 0xB9, 0xD9, 0x1D, 0x82, 0x52, 0x95, 0x77, 0x23, 0x50, 0xB4, 0xFB, 0x59, 0x0F,
+    0xAA, 0xCF, 0xBB, 0xC2, 0x6D, 0xDA, 0x6F, 0xEA, 0xBC, 0x4B, 0x03, 0xDA, 0xB3, 0x8F, 0xBE, 0xFD,
+    0xAD, 0x40, 0xDE, 0x61, 0xC6, 0x06, 0xF6, 0x41, 0xDA, 0x58, 0xB9, 0x71, 0xAE, 0xFD, 0xE7, 0xBA,
+    0x8C, 0x4D, 0x3B, 0x21, 0x93, 0x55, 0x22, 0xE2, 0xB4, 0x5C, 0x12, 0xF7, 0x87, 0x33, 0xB4, 0x1A,
+    0x0B, 0xC4, 0x8A, 0x03, 0xBA, 0x03, 0x8C, 0x85, 0x34, 0x00, 0x65, 0xCB, 0xEA, 0x6B, 0x23, 0x4A,
+    0x26, 0x8B, 0x96, 0xC9, 0x72, 0xFC, 0x9C, 0x38, 0xA0, 0x72, 0x80, 0x71, 0x40, 0xB5, 0x7C, 0x4D,
+    0xF5, 0xCB, 0xF7, 0x1A, 0x0B, 0x2A, 0x7C, 0x1D, 0xAA, 0x37, 0x64, 0xDD, 0x4C, 0xB9, 0x88, 0xB4,
+    0x99, 0x48, 0x0F, 0xBF, 0xDB, 0x03, 0xA9, 0x07, 0x54, 0x07, 0xE4, 0x0E, 0x28, 0x97, 0xFA, 0x49,
+    0x07, 0x4A, 0x16, 0xD8, 0xAF, 0x76, 0x28, 0x45, 0x6C, 0x25, 0xD2, 0x99, 0xE7, 0x77, 0xFB, 0x07,
+    0x50, 0x43, 0xAC, 0x53, 0x1A, 0x62, 0x4D, 0x73, 0x9F, 0x8A, 0xD4, 0x4A, 0x46, 0x52, 0x91, 0x16,
+    0xF2, 0x01, 0x92, 0x30, 0x57, 0x66, 0x02, 0x46, 0x8B, 0x0A, 0xFB, 0xCF, 0xEF, 0x0E, 0x8D, 0x48,
+    0xB7, 0x2B, 0x93, 0xA5, 0xA8, 0x21, 0x6B, 0xE7, 0x1A, 0x0C, 0xF1, 0x2F, 0x19, 0xA0, 0xF2, 0x50,
+    0x45, 0x48, 0x55, 0x90, 0x84, 0xCC, 0x43, 0x55, 0x57, 0x50, 0x74, 0x99, 0x47, 0x0D, 0x54, 0x20,
+    0x64, 0x1E, 0xE3, 0xA8, 0xD0, 0x9E, 0xCC, 0xAB, 0x00, 0x15, 0x8D, 0x25, 0xF3, 0x65, 0x0B, 0x55,
+    0xDE, 0x43, 0xF6, 0xFE, 0x04, 0x54, 0x55, 0x0D, 0x99, 0xF4, 0x40, 0x65, 0x1C, 0x64, 0x5E, 0x80,
+    0x2A, 0x0B, 0x90, 0xF9, 0xC2, 0x43, 0x45, 0x55, 0x93, 0xF9, 0x74, 0x82, 0x8A, 0xBC, 0x27, 0xF3,
+    0x98, 0x76, 0xF3, 0x09, 0x15, 0xA8, 0x40, 0xCB, 0xBB, 0x1E, 0xCC, 0x54, 0x41, 0x22, 0x1D, 0xC0,
+    0x3E, 0x40, 0xFE, 0x59, 0xD9, 0x4D, 0xAF, 0x17, 0x6E, 0x24, 0xEB, 0x75, 0xCB, 0xC8, 0x88, 0xB1,
+    0xBA, 0xD5, 0x1D, 0xA3, 0x1A, 0xD0, 0x6D, 0x03, 0x63, 0xE9, 0xD0, 0x3F, 0xF2, 0x20, 0x23, 0xE8,
+    0x9B, 0x1E, 0x46, 0xE3, 0xD0, 0xED, 0x04, 0x63, 0x36, 0xA0, 0xDB, 0xA2, 0x63, 0xA4, 0xB2, 0xBA,
+    0x4D, 0x47, 0x46, 0x72, 0x79, 0xAB, 0xA5, 0x1C, 0xC7, 0x79, 0xEC, 0x8D, 0x4B, 0x3F, 0xDF, 0x23,
+    0x53, 0x41, 0x12, 0x0A, 0x47, 0x32, 0x65, 0x9E, 0x64, 0x4A, 0x02, 0x4C, 0x54, 0xC7, 0xAC, 0x50,
+    0xBC, 0xDA, 0x09, 0x99, 0xBF, 0x2C, 0x24, 0xE1, 0xA4, 0x40, 0x95, 0x8B, 0xA5, 0x78, 0x55, 0x2C,
+    0x99, 0x17, 0x4B, 0x12, 0xAA, 0x1A, 0xAA, 0xCA, 0x41, 0x21, 0x1D, 0x64, 0x1F, 0x04, 0x48, 0x82,
+    0x71, 0x50, 0xE5, 0x01, 0x8A, 0x57, 0xC5, 0x91, 0xF9, 0x66, 0x20, 0x09, 0x27, 0x9B, 0x9A, 0x2A,
+    0xFF, 0x4E, 0x4F, 0xF1, 0x6A, 0x2B, 0x36, 0xF3, 0x68, 0x9F, 0x04, 0x10, 0x2A, 0xD0, 0xBE, 0x70,
+    0x20, 0x99, 0x87, 0xA2, 0x23, 0x0E, 0xE5, 0x4A, 0xB7, 0x2F, 0x54, 0x8F, 0xF7, 0xE7, 0x8D, 0x1D,
+    0x0B, 0x63, 0xCD, 0x13, 0x52, 0xEB, 0x1F, 0x48, 0xAD, 0xFA, 0xCA, 0x31, 0x96, 0x0E, 0xB3, 0xEB,
+    0xD0, 0xE2, 0x51, 0x77, 0x42, 0x04, 0x84, 0x79, 0x62, 0x60, 0x7E, 0xA2, 0x67, 0x2C, 0x2A, 0x6B,
+    0x9E, 0x78, 0xBD, 0xD7, 0x3F, 0xF0, 0x8D, 0xEA, 0x1F, 0xCC, 0xFD, 0x08, 0x42, 0x12, 0x20, 0xEB,
+    0x92, 0x00, 0xBA, 0x4D, 0x02, 0x98, 0xFA, 0x1B, 0xD3, 0x8B, 0x34, 0x34, 0x32, 0x24, 0x23, 0x8D,
+    0x0C, 0x6A, 0xE0, 0x77, 0xC7, 0x9D, 0xDC, 0x93, 0x04, 0x8A, 0x96, 0x24, 0x60, 0x6A, 0x92, 0x40,
+    0x03, 0x49, 0x48, 0x46, 0x48, 0xC6, 0xA7, 0x06, 0x48, 0x44, 0xFC, 0x26, 0x1D, 0x9F, 0x0A, 0x90,
+    0x84, 0x64, 0x82, 0x24, 0x20, 0x90, 0x04, 0x8C, 0x3B, 0x78, 0x83, 0xF6, 0x24, 0x01, 0x15, 0x48,
+    0x02, 0xC9, 0x48, 0x6C, 0x73, 0x12, 0xC0, 0xB8, 0x24, 0x40, 0xD1, 0x26, 0x81, 0x19, 0x16, 0x6A,
+    0x48, 0x5E, 0x58, 0xE6, 0x64, 0x4C, 0x06, 0xA0, 0x11, 0x69, 0x63, 0xF2, 0x7B, 0xB7, 0x56, 0xF6,
+    0xF0, 0xDD, 0x9E, 0xCC, 0xAB, 0x9E, 0xA2, 0x55, 0x3D, 0xC6, 0xAA, 0x9E, 0x11, 0xD5, 0xAB, 0x01,
+    0xD5, 0xEB, 0x0E, 0xD5, 0x97, 0x0E, 0xD5, 0x37, 0xA0, 0x7E, 0x11, 0x40, 0x49, 0x4F, 0x04, 0x96,
+    0xEA, 0x05, 0x54, 0x6F, 0x6A, 0x54, 0x5F, 0x74, 0xA8, 0x3E, 0xEB, 0x51, 0x7D, 0x32, 0xA2, 0x7A,
+    0x1A, 0xAB, 0x7A, 0x4A, 0xA7, 0x7A, 0x72, 0xAF, 0x7A, 0x54, 0x68, 0xA4, 0x83, 0xF2, 0x3B, 0x22,
+    0x90, 0xF7, 0x8D, 0x78, 0x92, 0x11, 0x1A, 0xA8, 0x2C, 0xB9, 0xA7, 0xE8, 0xA0, 0x99, 0xE7, 0x35,
+    0x02, 0x34, 0x18, 0x07, 0xB9, 0xD7, 0x1E, 0x68, 0x54, 0x00, 0x72, 0xDF, 0x58, 0xA0, 0x29, 0x5B,
+    0x20, 0xBF, 0xD3, 0x03, 0x34, 0x02, 0x90, 0x7F, 0x14, 0x00, 0x9A, 0xC2, 0x03, 0xB9, 0xAF, 0x6A,
+    0xA0, 0x49, 0x27, 0x20, 0xF7, 0x79, 0x1F, 0xDF, 0xD6, 0x1E, 0x7A, 0xF5, 0xBC, 0xB4, 0x68, 0x1F,
+    0x6B, 0xE0, 0xC8, 0x3D, 0xC9, 0x04, 0x0D, 0x64, 0x03, 0xB9, 0x87, 0xB2, 0x63, 0x5E, 0xC2, 0x7A,
+    0x72, 0x5F, 0x49, 0x4F, 0xE1, 0x1E, 0x7E, 0xA5, 0xA7, 0x22, 0xB6, 0x10, 0xD5, 0xAB, 0x9E, 0x08,
+    0x9F, 0x08, 0x02, 0x54, 0x3F, 0x31, 0x83, 0x08, 0x25, 0x1E, 0x50, 0x1F, 0x0D, 0x6C, 0xCA, 0xFB,
+    0xCA, 0x82, 0xEA, 0x8B, 0x96, 0x08, 0x28, 0x54, 0x9F, 0x06, 0x50, 0x3D, 0x0D, 0xA8, 0x1E, 0xE3,
+    0x50, 0x3D, 0xDA, 0xA3, 0x7A, 0xD4, 0x50, 0x01, 0xDA, 0x15, 0x0E, 0x94, 0xCF, 0x3C, 0x10, 0x92,
+    0x00, 0x18, 0xBE, 0xC8, 0x8D, 0x71, 0xB5, 0x5A, 0x35, 0x54, 0x22, 0x22, 0xAE, 0x10, 0x11, 0xF1,
+    0xD9, 0xED, 0xF5, 0x7A, 0xFD, 0x65, 0x5E, 0x75, 0xE8, 0x86, 0x9C, 0x75, 0xA0, 0xE4, 0x4D, 0x0F,
+    0x48, 0x7F, 0x68, 0xB5, 0x31, 0xF6, 0x60, 0xC9, 0x51, 0x9F, 0x74, 0x63, 0x3E, 0x8C, 0x25, 0x1D,
+    0x74, 0x0B, 0xFB, 0xAA, 0x87, 0xB2, 0x1E, 0x21, 0xEF, 0xEE, 0x5D, 0x78, 0x63, 0xFD, 0xCA, 0xA0,
+    0x45, 0x64, 0x52, 0x22, 0x22, 0xF5, 0xF4, 0xC9, 0x4F, 0x2E, 0x85, 0xCD, 0x9D, 0x1E, 0xCA, 0x69,
+    0x84, 0x5C, 0xEA, 0x05, 0x41, 0xA6, 0xC3, 0x06, 0x4B, 0x96, 0x77, 0x17, 0xC6, 0x76, 0x85, 0x0A,
+    0x28, 0x64, 0x3C, 0x7C, 0x6A, 0xA9, 0x80, 0xC2, 0x7D, 0x91, 0xD3, 0x6A, 0xB5, 0xDA, 0x75, 0x33,
+    0xD8, 0x37, 0xA7, 0xF5, 0x7A, 0x7D, 0xC9, 0x7D, 0x89, 0x97, 0x7D, 0xF6, 0xE9, 0x00, 0xA0, 0x22,
+    0xD7, 0x5A, 0x68, 0xE4, 0x83, 0x1E, 0xCA, 0x1B, 0x2F, 0x8D, 0x90, 0x77, 0x11, 0xD2, 0xE8, 0x16,
+    0xF6, 0x89, 0xC0, 0x62, 0xBE, 0x71, 0x63, 0xFD, 0xCA, 0x80, 0x16, 0x91, 0x89, 0x08, 0x5A, 0xA6,
+    0xCF, 0xF8, 0xC5, 0x27, 0xDD, 0xA0, 0x12, 0x91, 0x29, 0xCE, 0x17, 0x11, 0x39, 0x9A, 0x59, 0xAD,
+    0x56, 0xCD, 0xBC, 0xB4, 0xF2, 0x2B, 0xCB, 0xAC, 0x5F, 0x9C, 0x33, 0x22, 0xED, 0x92, 0x09, 0x31,
+    0xB3, 0xFA, 0x9A, 0x2C, 0x0F, 0x37, 0x6E, 0xCE, 0x94, 0xDD, 0x9C, 0xC9, 0xFD, 0x9C, 0x89, 0x53,
+    0xAC, 0x01, 0x15, 0xE6, 0x4C, 0xBA, 0x64, 0x92, 0xCF, 0x95, 0x39, 0xA0, 0x11, 0xE3, 0xA1, 0x36,
+    0x99, 0x61, 0xCE, 0xE4, 0x7E, 0xCE, 0xC4, 0x95, 0x08, 0x4B, 0x13, 0x7B, 0x6B, 0xBA, 0x24, 0x16,
+    0x00, 0x99, 0x09, 0x64, 0x1A, 0x99, 0xF1, 0x4D, 0x72, 0xE6, 0x60, 0x8A, 0x88, 0x48, 0x0B, 0x5A,
+    0x44, 0x7A, 0x50, 0xD3, 0x7A, 0x3D, 0xC6, 0x19, 0x65, 0x2C, 0x18, 0x8B, 0x6E, 0x41, 0xB7, 0x44,
+    0x34, 0x14, 0xA7, 0xDA, 0xA1, 0x9B, 0x37, 0x5E, 0x44, 0xB7, 0x28, 0x91, 0x4E, 0xF5, 0x20, 0x22,
+    0x76, 0x04, 0xF3, 0x57, 0xBB, 0xDE, 0x58, 0x74, 0x9B, 0x48, 0xFC, 0x65, 0x71, 0xBD, 0x87, 0x11,
+    0x35, 0xC4, 0x5F, 0x56, 0xF1, 0xB5, 0xC5, 0xB5, 0x16, 0xD5, 0xA3, 0x3E, 0x88, 0xAF, 0x1D, 0xE3,
+    0xCD, 0x38, 0x8B, 0x17, 0x72, 0x39, 0xD2, 0xFE, 0x1B, 0x38, 0x4C, 0x1C, 0xCC, 0xF4, 0xAD, 0x48,
+    0x19, 0x26, 0x53, 0x24, 0x55, 0xAB, 0x78, 0x8A, 0x53, 0xF1, 0xC8, 0x51, 0x48, 0x07, 0x94, 0x22,
+    0x80, 0x16, 0x69, 0x41, 0x45, 0xC0, 0x44, 0x38, 0x69, 0x4F, 0xF2, 0x9F, 0x6D, 0x3A, 0x82, 0x08,
+    0xC6, 0x61, 0x24, 0xA8, 0x9E, 0x7C, 0x28, 0xBB, 0x0A, 0x26, 0x9A, 0xDC, 0x53, 0x38, 0xD5, 0x37,
+    0xA4, 0x01, 0xF3, 0x1D, 0x8F, 0xA9, 0xD3, 0xA1, 0x41, 0x0D, 0x94, 0xAF, 0x7B, 0x4C, 0x9D, 0x86,
+    0xC3, 0x17, 0x43, 0x45, 0x1A, 0x30, 0xCF, 0xF6, 0x14, 0x4E, 0xF5, 0xC6, 0x31, 0xD2, 0xA4, 0x23,
+    0xDA, 0xEB, 0x4E, 0x7B, 0xAA, 0xC7, 0x02, 0x95, 0x53, 0xA1, 0xA9, 0x53, 0xB1, 0x85, 0x78, 0x72,
+    0xB9, 0x21, 0x01, 0x0A, 0x11, 0x79, 0xE7, 0x22, 0x65, 0x1C, 0xDE, 0x5B, 0x3B, 0x79, 0xEC, 0xA7,
+    0xAD, 0xBF, 0x8E, 0x1D, 0x55, 0x88, 0x03, 0x23, 0x1D, 0x94, 0xEF, 0xEC, 0x40, 0xD1, 0x46, 0x02,
+    0xBA, 0xEC, 0x32, 0x4F, 0x25, 0x8F, 0x05, 0xAA, 0x9B, 0x7E, 0x1F, 0x53, 0x4F, 0xA6, 0xD6, 0xAE,
+    0xB8, 0xD6, 0x66, 0x5E, 0x7D, 0xD0, 0x27, 0x81, 0x30, 0x51, 0x61, 0xCA, 0xBA, 0x70, 0xC5, 0xEB,
+    0x5E, 0xF5, 0x79, 0x17, 0xD8, 0x57, 0xBD, 0x71, 0xC5, 0xF5, 0xA0, 0x86, 0x54, 0x02, 0xD5, 0x3B,
+    0x4D, 0x20, 0x13, 0x91, 0x35, 0xA5, 0x88, 0xD4, 0x1C, 0x4F, 0x9A, 0xEE, 0x30, 0xE8, 0x4E, 0xC8,
+    0x2D, 0x68, 0x44, 0x7A, 0x44, 0x24, 0x24, 0xD2, 0xF2, 0x6F, 0x90, 0x1A, 0x68, 0x6A, 0xC0, 0xD4,
+    0x40, 0x64, 0x42, 0x3A, 0x20, 0xEB, 0x37, 0x3D, 0xD5, 0xB0, 0xDC, 0xC9, 0xFD, 0x66, 0xF4, 0x1E,
+    0x14, 0x66, 0xFD, 0xA6, 0x33, 0x8D, 0x03, 0xF2, 0x1E, 0x40, 0x00, 0x8A, 0x1E, 0x48, 0xA5, 0x66,
+    0x8B, 0x52, 0xD6, 0x62, 0x53, 0x11, 0x69, 0xC9, 0x45, 0x3A, 0xD0, 0xFF, 0x27, 0x33, 0x45, 0x4D,
+    0x61, 0x17, 0xEA, 0x3E, 0x32, 0x1D, 0x15, 0x4B, 0xAF, 0x1E, 0xF4, 0x7F, 0xB2, 0x22, 0x11, 0x69,
+    0x4B, 0x91, 0xC7, 0xE4, 0xF9, 0xBD, 0xA2, 0x03, 0x89, 0x9F, 0x2E, 0x1D, 0x4C, 0x71, 0x06, 0xE9,
+    0x36, 0x8E, 0xA6, 0x69, 0xA1, 0xF6, 0x23, 0x78, 0x8D, 0x83, 0xCA, 0x61, 0x9B, 0x9F, 0x5D, 0xB2,
+    0x8D, 0x8C, 0xEC, 0x4A, 0x17, 0x27, 0x42, 0x1D, 0x3F, 0xBD, 0x1D, 0xBF, 0x9B, 0x79, 0x94, 0x58,
+    0xF4, 0x30, 0xCF, 0x2E, 0x11, 0xD9, 0x15, 0x11, 0xF9, 0x91, 0x88, 0x48, 0xBF, 0x5A, 0x8D, 0xAB,
+    0x33, 0x33, 0xEB, 0x52, 0xB8, 0x65, 0x30, 0x27, 0x9B, 0xFA, 0xFE, 0xCA, 0x0B, 0x47, 0xA0, 0x10,
+    0x0B, 0x99, 0xB4, 0x9B, 0xC5, 0x71, 0xDC, 0x4C, 0x18, 0x7D, 0xAF, 0xC2, 0xF9, 0xC8, 0x44, 0x24,
+    0x54, 0x22, 0xF2, 0xEA, 0xBA, 0xB9, 0xF1, 0x52, 0x44, 0x2E, 0xA6, 0xE6, 0xCB, 0x66, 0xA6, 0x8B,
+    0x60, 0x46, 0x50, 0x9F, 0x45, 0xCA, 0x5F, 0x61, 0x1F, 0x28, 0xBE, 0xDD, 0x83, 0x1A, 0x8C, 0x83,
+    0x86, 0x11, 0x74, 0x9B, 0x7B, 0xD2, 0x10, 0xD1, 0x41, 0x1A, 0xC8, 0x3D, 0xBA, 0x8B, 0x84, 0x9C,
+    0xA9, 0x51, 0x43, 0xE6, 0xA1, 0x70, 0x13, 0x30, 0x15, 0x0E, 0xB2, 0x0F, 0x06, 0xC0, 0x08, 0x90,
+    0x48, 0x0B, 0xE8, 0xB0, 0x69, 0x5F, 0x6C, 0xEF, 0x17, 0xCE, 0xCE, 0xE3, 0x33, 0x0D, 0x15, 0xA8,
+    0xDE, 0x58, 0x32, 0x5F, 0x3A, 0x74, 0xA7, 0x1D, 0xBA, 0xD5, 0x1D, 0xA5, 0xCB, 0x7C, 0x24, 0x61,
+    0x2B, 0xD2, 0x81, 0x7D, 0x92, 0xC0, 0x08, 0x53, 0x12, 0xA0, 0x52, 0x03, 0x18, 0xE5, 0xA1, 0xFC,
+    0x76, 0x07, 0xC5, 0xB5, 0x16, 0xF4, 0x35, 0x37, 0xE3, 0x26, 0x25, 0x40, 0x2A, 0x40, 0x32, 0x6E,
+    0x86, 0xEF, 0xE7, 0x4B, 0x7E, 0xBD, 0xA0, 0xDA, 0x7A, 0xEA, 0xD6, 0x8A, 0x54, 0x44, 0x3C, 0xA5,
+    0x88, 0x90, 0xAC, 0x9B, 0xF5, 0x0B, 0xBF, 0x02, 0x50, 0x15, 0x1B, 0x50, 0x99, 0xC3, 0xA0, 0x1A,
+    0x93, 0x00, 0x55, 0x7A, 0x00, 0x2A, 0xFF, 0x19, 0xA0, 0xCA, 0x44, 0x24, 0x26, 0xE9, 0x7A, 0x5A,
+    0x7F, 0x06, 0xA8, 0xCA, 0x1A, 0x8A, 0xBA, 0x68, 0xC1, 0x58, 0xED, 0x61, 0x42, 0x0D, 0x24, 0x81,
+    0x34, 0xA0, 0x7A, 0x10, 0x72, 0x0F, 0xC6, 0x16, 0x0E, 0x4A, 0x67, 0x2C, 0xE8, 0xAE, 0x01, 0xB2,
+    0x3E, 0x00, 0xA9, 0x0C, 0x00, 0x12, 0xE5, 0x4E, 0xEE, 0x20, 0x15, 0xBF, 0xB9, 0xAB, 0xDE, 0x0F,
+    0x80, 0xEE, 0x04, 0x28, 0x5C, 0x5C, 0x0E, 0x4B, 0xC7, 0x2C, 0x47, 0x0A, 0x64, 0x3D, 0x6A, 0x20,
+    0x76, 0x08, 0x13, 0x45, 0x0B, 0x4D, 0x30, 0x35, 0x98, 0xD0, 0x00, 0x45, 0x38, 0x24, 0x30, 0xF9,
+    0x3C, 0xE9, 0x66, 0xAD, 0x4F, 0x46, 0x04, 0x26, 0x74, 0x47, 0x43, 0x12, 0xA8, 0x2C, 0xA5, 0x33,
+    0x35, 0x6A, 0x28, 0x1D, 0x54, 0x67, 0x1D, 0xE4, 0xD2, 0xCE, 0x82, 0x0E, 0x22, 0xAB, 0x32, 0x02,
+    0x99, 0x38, 0x50, 0xB7, 0x03, 0xA4, 0xC1, 0xD4, 0x24, 0x21, 0xEB, 0x61, 0xA4, 0x01, 0x99, 0xDF,
+    0x25, 0xBE, 0xB2, 0x94, 0xC1, 0xD4, 0xB3, 0x7C, 0x44, 0x3B, 0x40, 0xF9, 0x4D, 0x1D, 0xCC, 0xDD,
+    0x85, 0x8D, 0x88, 0x4C, 0x98, 0x88, 0xF8, 0xA8, 0x36, 0xE7, 0xE3, 0xAB, 0x69, 0xB5, 0xA2, 0x9A,
+    0xE7, 0xF9, 0x6F, 0xF2, 0x59, 0x44, 0x44, 0xC6, 0x8F, 0x9F, 0x01, 0xB8, 0xF2, 0x25, 0xCF, 0xCB,
+    0xF2, 0x23, 0x22, 0xA3, 0xEA, 0x33, 0x11, 0xE9, 0x75, 0x7B, 0xFF, 0x2B, 0xD3, 0xBA, 0x36, 0x96,
+    0xCC, 0xC3, 0x08, 0x85, 0x43, 0xF5, 0x50, 0x81, 0x6E, 0x23, 0x73, 0xFD, 0x2B, 0xBA, 0x25, 0x22,
+    0xB7, 0x6D, 0x12, 0x9B, 0x91, 0x49, 0x24, 0xEA, 0x0E, 0xB8, 0xA2, 0x79, 0xC2, 0xC6, 0x16, 0xAA,
+    0x7B, 0xDD, 0xBA, 0x32, 0x02, 0x57, 0x54, 0x0F, 0x6A, 0xD0, 0x2D, 0xE8, 0xCE, 0x58, 0x30, 0xF5,
+    0x08, 0x4C, 0x9F, 0xBB, 0x78, 0x02, 0xA6, 0x74, 0x84, 0x13, 0x83, 0x9A, 0x56, 0xBB, 0xD2, 0x65,
+    0x22, 0x22, 0x75, 0x26, 0x32, 0x4C, 0x70, 0xEE, 0xC5, 0x48, 0xBC, 0xEA, 0x28, 0x3A, 0xA9, 0x37,
+    0xC4, 0xC0, 0xC7, 0x8B, 0xE5, 0x80, 0xCD, 0xD5, 0x51, 0xE8, 0x5A, 0x1D, 0xD0, 0x83, 0x91, 0x38,
+    0x2C, 0xEE, 0x5D, 0x7C, 0x20, 0x76, 0x4D, 0x83, 0xF2, 0xD0, 0x10, 0xA0, 0x74, 0x06, 0x72, 0x7F,
+    0xEF, 0xC2, 0x96, 0x34, 0xA8, 0x40, 0x26, 0x54, 0xEF, 0xEC, 0x8A, 0xCB, 0x45, 0xDE, 0xF3, 0x54,
+    0xF2, 0xAD, 0x00, 0x67, 0x3E, 0x81, 0xA2, 0x19, 0x80, 0x52, 0x80, 0x5C, 0x3E, 0x91, 0xD8, 0x39,
+    0x54, 0x78, 0x61, 0x5C, 0x20, 0x3C, 0x7D, 0x56, 0xF2, 0x75, 0xA6, 0x91, 0xF3, 0x87, 0x13, 0xE1,
+    0x3C, 0x53, 0x63, 0xCF, 0xA7, 0x93, 0xF9, 0x70, 0xBF, 0x99, 0x8A, 0x99, 0x57, 0xBD, 0x35, 0xF1,
+    0xD0, 0xC8, 0x04, 0xE7, 0x3F, 0x29, 0xE1, 0x9E, 0x89, 0xF2, 0x30, 0x19, 0xD0, 0x3F, 0x3D, 0x9A,
+    0x49, 0x5E, 0xD0, 0x3F, 0xF5, 0x05, 0x93, 0x49, 0xBC, 0xFE, 0x69, 0x5F, 0x30, 0x99, 0x6F, 0xFA,
+    0xE6, 0x27, 0xB2, 0xDB, 0x4C, 0x5A, 0xE4, 0xAD, 0xAE, 0x94, 0x6E, 0xE2, 0x77, 0xBD, 0xEE, 0x28,
+    0x98, 0x48, 0x96, 0x0C, 0x2F, 0xE8, 0x6E, 0x7E, 0xB3, 0xEE, 0xBE, 0x30, 0x1D, 0x93, 0xAC, 0xC8,
+    0xDE, 0x6F, 0x64, 0x48, 0x44, 0x44, 0xDA, 0x4A, 0x7E, 0x76, 0x29, 0x14, 0xB7, 0xA0, 0xFA, 0xB6,
+    0x87, 0xFC, 0xFD, 0xB0, 0x30, 0x44, 0xA6, 0x70, 0xA0, 0x5F, 0xF3, 0x0B, 0xF6, 0xFD, 0x5C, 0x85,
+    0xFE, 0x2F, 0x3E, 0x45, 0x90, 0x78, 0x90, 0x59, 0xA1, 0x7F, 0x20, 0x62, 0xC7, 0x46, 0x46, 0x7D,
+    0xF3, 0x9D, 0x5D, 0x2F, 0x2D, 0xD5, 0x73, 0x03, 0x69, 0x10, 0x28, 0xAE, 0x79, 0x08, 0x13, 0xE8,
+    0x6B, 0x1D, 0x84, 0x11, 0xF4, 0xB5, 0xF6, 0x0B, 0x64, 0xDC, 0x21, 0x04, 0x2E, 0xB7, 0x88, 0xCC,
+    0x88, 0x9F, 0x79, 0x2F, 0xC0, 0xBC, 0xCD, 0xAE, 0x07, 0xD3, 0x92, 0x4C, 0xCC, 0xFA, 0x10, 0x74,
+    0x07, 0x6A, 0x88, 0xC0, 0x6A, 0xCA, 0x34, 0x00, 0xC5, 0x35, 0x37, 0x01, 0xEA, 0x23, 0x6F, 0x2C,
+    0x30, 0x4E, 0x45, 0x0B, 0x98, 0x4B, 0x22, 0x22, 0x22, 0x3F, 0x8D, 0xA7, 0xE1, 0x84, 0x88, 0x88,
+    0x4C, 0x0B, 0xCF, 0x3E, 0xCF, 0xF2, 0x0D, 0xEB, 0xE4, 0x8E, 0x30, 0x8D, 0x73, 0x69, 0x19, 0x71,
+    0x80, 0x9A, 0x51, 0x5F, 0xF5, 0x36, 0xFC, 0x0F, 0x90, 0xC9, 0x8D, 0x4B, 0x32, 0x57, 0xD3, 0x41,
+    0xD2, 0xC8, 0x64, 0x01, 0x56, 0x11, 0x55, 0x1C, 0xB7, 0x40, 0x26, 0x91, 0xA0, 0x10, 0x0B, 0xF2,
+    0x7C, 0xE3, 0x48, 0x03, 0xDA, 0x9F, 0x54, 0x3D, 0xAA, 0xDF, 0xCE, 0x3D, 0x6A, 0xD8, 0xD6, 0x1D,
+    0x69, 0x30, 0x4F, 0xB6, 0x24, 0xA1, 0x14, 0x11, 0x09, 0x5A, 0x44, 0x24, 0xB0, 0x7B, 0x63, 0xBD,
+    0x7E, 0x69, 0x46, 0x3F, 0x73, 0xDA, 0x1D, 0xCC, 0xDF, 0x88, 0x0B, 0xD2, 0x09, 0xFE, 0x2B, 0x68,
+    0x7E, 0xF6, 0x0D, 0xBF, 0x40, 0x2D, 0x15, 0xB9, 0x08, 0x6C, 0xED, 0xF0, 0x31, 0xB0, 0x9A, 0x08,
+    0xD6, 0x6A, 0x03, 0xD6, 0xF2, 0x00, 0xAC, 0xE5, 0x6F, 0x3C, 0x58, 0x47, 0x0E, 0x23, 0xE2, 0x19,
+    0x2D, 0x2F, 0xDF, 0xB9, 0xE7, 0xCD, 0xF9, 0xF8, 0xEC, 0x8E, 0xC8, 0xBE, 0x54, 0x47, 0xE4, 0x1F,
+    0xEF, 0x08, 0x39, 0xD4, 0x11, 0xC7, 0x62, 0x47, 0x44, 0x44, 0x5D, 0x7E, 0x7A, 0x6A, 0xA9, 0xE4,
+    0xE7, 0x22, 0xDF, 0x6F, 0x6E, 0x51, 0x91, 0x04, 0x32, 0x1F, 0x45, 0x4B, 0x5F, 0x24, 0x7B, 0x6C,
+    0x7A, 0x54, 0xE4, 0x75, 0x11, 0x20, 0xF5, 0x49, 0xE4, 0xB9, 0xCA, 0x3A, 0x7E, 0x80, 0xE9, 0x6B,
+    0x7E, 0x66, 0x64, 0x66, 0x48, 0xE5, 0x13, 0xF7, 0x38, 0xD2, 0x1E, 0x4A, 0x4B, 0x3A, 0x14, 0x8E,
+    0x74, 0x80, 0x8A, 0x06, 0xCA, 0x1A, 0xDD, 0xA9, 0x81, 0x74, 0x20, 0x0D, 0x14, 0x8E, 0xB2, 0xA6,
+    0x82, 0x86, 0x74, 0x40, 0x77, 0xA8, 0x81, 0xB2, 0x4E, 0x03, 0x14, 0x2E, 0x1D, 0x66, 0x99, 0x4F,
+    0x59, 0xC7, 0x81, 0x94, 0x0E, 0x71, 0x08, 0xB9, 0xB2, 0xAE, 0x2C, 0xD0, 0x3C, 0x35, 0x9E, 0xED,
+    0x00, 0x25, 0x22, 0x61, 0x11, 0x50, 0x39, 0x40, 0x7F, 0x58, 0xFD, 0x50, 0x80, 0x34, 0xA4, 0x43,
+    0xD6, 0x03, 0xA6, 0x2E, 0xEB, 0xD2, 0x81, 0xF6, 0xE9, 0xC0, 0x04, 0xC9, 0x48, 0x59, 0x67, 0x3D,
+    0x98, 0x3A, 0x1D, 0x30, 0x0E, 0xED, 0x29, 0x6B, 0x26, 0x92, 0x91, 0x74, 0x20, 0xEF, 0x31, 0x8E,
+    0xB2, 0xC6, 0xB8, 0xDC, 0x93, 0x0E, 0x24, 0x53, 0x32, 0x42, 0x59, 0x93, 0x7B, 0x13, 0xDB, 0x62,
+    0x5E, 0xF7, 0x50, 0xD6, 0x24, 0x23, 0x3C, 0xC3, 0xC9, 0x88, 0x5A, 0x0B, 0xC7, 0xB2, 0x38, 0xCF,
+    0x32, 0x04, 0x50, 0xB3, 0x18, 0x28, 0xF9, 0x38, 0x7C, 0x4C, 0x4D, 0x05, 0xA3, 0xEA, 0x29, 0x1C,
+    0x13, 0x15, 0x99, 0xA7, 0x41, 0x77, 0x49, 0xC0, 0xC0, 0x48, 0x85, 0xA9, 0x29, 0x5C, 0xE1, 0x0A,
+    0x87, 0x1A, 0x32, 0xAF, 0x1D, 0x98, 0x47, 0x83, 0xEE, 0x20, 0xBB, 0x2D, 0xAF, 0xF8, 0x48, 0x53,
+    0xF5, 0x87, 0x26, 0xE1, 0x37, 0x43, 0xD1, 0x41, 0xE9, 0xAA, 0xA8, 0x3C, 0x28, 0x9C, 0x71, 0xE8,
+    0x2E, 0xF3, 0x6A, 0x20, 0xF7, 0x49, 0xA0, 0x21, 0xEB, 0xA9, 0xD0, 0x5E, 0x0D, 0x14, 0x8E, 0x31,
+    0x0D, 0x64, 0x9E, 0xF2, 0xFB, 0x63, 0xD4, 0x42, 0x54, 0x90, 0x8E, 0x47, 0x35, 0x65, 0xD9, 0x40,
+    0x05, 0xD3, 0x3D, 0x35, 0x65, 0x44, 0xEE, 0x63, 0xD1, 0x94, 0x8D, 0x07, 0x9A, 0x32, 0x99, 0x2C,
+    0x95, 0x88, 0xD8, 0x4C, 0xD6, 0xCD, 0x44, 0x05, 0xBB, 0x43, 0xE6, 0xA1, 0x6A, 0x2B, 0x66, 0x55,
+    0x4E, 0xD6, 0x57, 0x80, 0xF9, 0xB6, 0x5F, 0xA4, 0x74, 0xC5, 0x6B, 0x7E, 0x59, 0x7B, 0x0E, 0x67,
+    0xDD, 0x66, 0x41, 0x37, 0xF5, 0x66, 0x8A, 0x46, 0x4D, 0x73, 0xC7, 0x7D, 0xE4, 0x81, 0x64, 0xBA,
+    0x24, 0x50, 0x88, 0x38, 0x68, 0xA4, 0x5D, 0xE6, 0xE8, 0xAC, 0x28, 0x7A, 0xB2, 0xA5, 0x7A, 0xBC,
+    0xC7, 0xD8, 0x11, 0x63, 0x8D, 0x35, 0xB5, 0x6E, 0x4D, 0xAD, 0x7A, 0x53, 0x33, 0x9A, 0x7A, 0x56,
+    0x14, 0x49, 0xA7, 0x44, 0xC4, 0xCA, 0xBA, 0xE9, 0x8D, 0x4D, 0x44, 0xB7, 0xE8, 0x0F, 0x7A, 0x92,
+    0x30, 0x82, 0xA9, 0x2C, 0xFA, 0x66, 0x4B, 0x7A, 0xA7, 0x87, 0xFD, 0x38, 0x08, 0xC8, 0xBB, 0x79,
+    0xA6, 0x2E, 0xA4, 0xAD, 0xA9, 0xEF, 0xC3, 0x38, 0x75, 0x5B, 0x5A, 0xA2, 0x04, 0x65, 0x91, 0x8B,
+    0x34, 0x22, 0x43, 0x1C, 0xA0, 0x3E, 0x8A, 0xFD, 0x1C, 0x98, 0x45, 0xDA, 0x98, 0x44, 0xA9, 0x46,
+    0x16, 0x47, 0x52, 0xE1, 0x60, 0x9F, 0xA8, 0x8D, 0x20, 0x09, 0xA0, 0x1D, 0x99, 0x07, 0x03, 0x85,
+    0x23, 0x09, 0x50, 0x41, 0xE6, 0x49, 0x22, 0xC7, 0x95, 0x79, 0xD8, 0x3F, 0x42, 0xA5, 0xC6, 0x87,
+    0xCC, 0xE6, 0xA1, 0xC2, 0x45, 0x39, 0x2E, 0x18, 0x4B, 0x12, 0x16, 0x21, 0x4A, 0x64, 0x52, 0x31,
+    0x35, 0x54, 0xFC, 0x2F, 0x01, 0x12, 0xF9, 0x48, 0x3A, 0xC8, 0xE4, 0xDA, 0x04, 0x14, 0xB2, 0x65,
+    0x89, 0x3A, 0x54, 0x20, 0x9F, 0xE9, 0xD5, 0xC3, 0x72, 0xD1, 0x88, 0xAF, 0xA8, 0xEC, 0x11, 0x11,
+    0x29, 0x07, 0x2D, 0xB6, 0x68, 0x91, 0x1E, 0xA6, 0x75, 0x63, 0xD1, 0x4E, 0xF5, 0x10, 0x30, 0x73,
+    0x36, 0x09, 0x18, 0x4B, 0x51, 0xAB, 0x9E, 0x74, 0xC0, 0x58, 0x4A, 0xAB, 0x7A, 0x54, 0x8F, 0xB1,
+    0x98, 0xA8, 0xB5, 0xC2, 0xD8, 0x28, 0x8D, 0xD6, 0x2D, 0xC6, 0x26, 0x01, 0xD5, 0x63, 0x6A, 0x8C,
+    0x3D, 0xEB, 0x51, 0xF2, 0xDE, 0x04, 0x66, 0x6A, 0xEC, 0x2C, 0xEF, 0x60, 0x6F, 0xC3, 0x29, 0xC5,
+    0x3A, 0x97, 0x76, 0xC3, 0x34, 0x55, 0x51, 0x95, 0x5A, 0x31, 0xD3, 0x27, 0x91, 0x5E, 0xF9, 0x62,
+    0xD9, 0x0F, 0x57, 0xAB, 0xAF, 0x86, 0x4A, 0x44, 0xE4, 0x35, 0x11, 0x91, 0x50, 0xAD, 0xD7, 0xEB,
+    0x4B, 0x5F, 0xF6, 0x65, 0x47, 0x87, 0x75, 0x24, 0xCB, 0xCA, 0x83, 0x61, 0xDD, 0xCC, 0x92, 0xE5,
+    0xFB, 0xC8, 0xC3, 0x2C, 0x52, 0x8E, 0x32, 0xD4, 0x28, 0x4B, 0x5E, 0x86, 0xB5, 0x6E, 0xE3, 0x50,
+    0xCC, 0x6F, 0x7E, 0x4A, 0xE6, 0xF6, 0x7A, 0x3D, 0x89, 0x88, 0xDC, 0x14, 0x91, 0x69, 0xFA, 0x8C,
+    0x87, 0x97, 0x4C, 0x37, 0xAB, 0x53, 0x74, 0xB7, 0x10, 0x6C, 0x0E, 0xD2, 0xC0, 0x3F, 0xA1, 0xB1,
+    0x4C, 0x8D, 0x47, 0x4B, 0x98, 0x65, 0x5F, 0x33, 0x78, 0x7F, 0x53, 0x15, 0x5A, 0xDF, 0x3D, 0xA4,
+    0xD0, 0xF2, 0x87, 0x58, 0xFB, 0xFD, 0x43, 0x2B, 0x7B, 0xA4, 0x2E, 0xE2, 0x70, 0x8E, 0x1D, 0x90,
+    0x1E, 0x19, 0xCD, 0x51, 0x2B, 0x32, 0x42, 0xB4, 0x09, 0xF9, 0xF4, 0xEC, 0xED, 0xF5, 0x7A, 0x42,
+    0x44, 0xA4, 0x8B, 0xEA, 0x97, 0xE9, 0xF3, 0xFC, 0x2C, 0x2A, 0x77, 0xC2, 0x46, 0xAB, 0x95, 0xF4,
+    0x9B, 0xD9, 0x16, 0x47, 0xF0, 0x85, 0x03, 0x32, 0x21, 0xC4, 0x2A, 0x7F, 0x7E, 0xAE, 0xE6, 0xE3,
+    0xC9, 0x04, 0x4C, 0x8D, 0xE5, 0xD8, 0x64, 0xDE, 0xF9, 0xAA, 0x44, 0xAE, 0x26, 0xB2, 0x89, 0x0F,
+    0xBD, 0xFC, 0xC9, 0xCC, 0xCB, 0x26, 0x31, 0x77, 0x25, 0xF6, 0x33, 0x93, 0x59, 0x7B, 0xE2, 0xA1,
+    0x31, 0x90, 0x7F, 0xF0, 0x29, 0x99, 0x1E, 0x1A, 0xE3, 0xA8, 0xDE, 0x97, 0xE7, 0x1B, 0xC9, 0x45,
+    0xDE, 0xF3, 0x85, 0x74, 0x0D, 0x5B, 0x36, 0xF7, 0xF3, 0xCC, 0x58, 0x32, 0x89, 0x78, 0x28, 0x64,
+    0xC9, 0xB8, 0x79, 0x22, 0xDD, 0x2B, 0x53, 0x75, 0x51, 0x22, 0x53, 0x79, 0x40, 0x8F, 0x54, 0x3D,
+    0x50, 0x8C, 0x54, 0x01, 0x30, 0x23, 0x17, 0x96, 0xF3, 0x7E, 0x84, 0xEA, 0x85, 0x0A, 0x08, 0x23,
+    0x17, 0x8C, 0x25, 0x19, 0x46, 0x2E, 0x94, 0x8E, 0xB4, 0x1F, 0xB9, 0xA0, 0x1D, 0xCA, 0x8F, 0x54,
+    0xBA, 0x23, 0xEF, 0x46, 0xAA, 0xCC, 0xA3, 0xDD, 0x48, 0xA5, 0x7A, 0x0A, 0x37, 0x52, 0xA5, 0x03,
+    0xA5, 0x1D, 0xA9, 0x08, 0x18, 0x46, 0x2A, 0x46, 0x2E, 0x30, 0x52, 0x51, 0x11, 0xE2, 0x4A, 0x3E,
+    0x9F, 0xCB, 0x6F, 0xF5, 0x8C, 0x54, 0x14, 0x57, 0x3D, 0x23, 0x15, 0xFA, 0xCD, 0x8E, 0x91, 0x8A,
+    0xFC, 0xBD, 0x96, 0x91, 0x0A, 0x25, 0x6E, 0x3E, 0xD7, 0x8C, 0x54, 0x24, 0x02, 0x12, 0x2A, 0x10,
+    0x90, 0xA1, 0x82, 0x2B, 0x1B, 0x0D, 0xED, 0x3C, 0x44, 0x0E, 0x78, 0xF0, 0xBC, 0x3B, 0x6A, 0x21,
+    0x54, 0xBA, 0x0D, 0x9D, 0x71, 0x08, 0x63, 0x1F, 0x1A, 0xDF, 0x01, 0x94, 0x20, 0x0E, 0x2A, 0xAF,
+    0x27, 0xC8, 0x05, 0xF1, 0x20, 0x5E, 0xDF, 0xB4, 0x14, 0x0D, 0x63, 0x40, 0x7D, 0xE4, 0xF5, 0x35,
+    0x47, 0x65, 0x08, 0x17, 0xC8, 0xAF, 0x7B, 0x7D, 0xD5, 0x13, 0x0C, 0xA1, 0xB4, 0xC5, 0xB3, 0x5E,
+    0xBB, 0x41, 0x79, 0x43, 0xD0, 0xAE, 0x52, 0x5E, 0xBB, 0x0B, 0x79, 0x6B, 0x08, 0xCA, 0x07, 0xE5,
+    0xB5, 0x2B, 0xCF, 0xD6, 0x86, 0xC0, 0x1D, 0xAF, 0xBC, 0x76, 0x7A, 0xC2, 0x10, 0xA8, 0x5A, 0x25,
+    0xD7, 0x9C, 0x0A, 0x98, 0x10, 0x28, 0x6B, 0x15, 0x97, 0xC9, 0x38, 0xE8, 0xE7, 0x35, 0x66, 0x6E,
+    0xD3, 0x85, 0xC3, 0x0D, 0x89, 0x93, 0xB2, 0x70, 0xBF, 0x4A, 0xAA, 0x56, 0xBB, 0xAC, 0x5B, 0xE6,
+    0xA2, 0xBA, 0xB5, 0xEB, 0x20, 0x11, 0xB1, 0x40, 0x39, 0xDC, 0x4D, 0xA6, 0x45, 0xB0, 0x6A, 0xBF,
+    0xD1, 0x98, 0x60, 0x02, 0xC0, 0x76, 0x00, 0xB8, 0x72, 0x01, 0x20, 0x18, 0x20, 0x09, 0x26, 0xDA,
+    0x03, 0x38, 0x50, 0x5E, 0x3B, 0xC8, 0xBB, 0xBC, 0x03, 0xDD, 0xC6, 0x35, 0x37, 0xEA, 0x57, 0xD3,
+    0x01, 0x0C, 0x49, 0x80, 0x66, 0xB5, 0x9A, 0xC5, 0x60, 0x24, 0x22, 0x22, 0xA4, 0xD3, 0x7A, 0xDD,
+    0xD4, 0xAA, 0x27, 0xCA, 0x71, 0xA3, 0x48, 0x97, 0xDC, 0x17, 0x6E, 0x21, 0xB5, 0xD4, 0x10, 0xED,
+    0xB8, 0xA2, 0x89, 0xD6, 0x3C, 0x33, 0x2F, 0xF3, 0x0C, 0xA5, 0x2D, 0x6D, 0xE6, 0x0B, 0x47, 0x23,
+    0x6D, 0x14, 0x3F, 0xDE, 0xC7, 0x81, 0xFA, 0xB1, 0x8A, 0x4A, 0xA5, 0xBA, 0xFC, 0xEB, 0x5D, 0x9F,
+    0xC6, 0xC9, 0x5C, 0xBA, 0x79, 0xE0, 0x04, 0xA0, 0xE2, 0x21, 0x11, 0x57, 0x89, 0xF8, 0xE6, 0x67,
+    0x7F, 0x16, 0x9A, 0x9A, 0xCA, 0xD4, 0x14, 0xD7, 0x5A, 0xB2, 0x8F, 0x3C, 0x69, 0x18, 0x41, 0x8C,
+    0x4B, 0xE4, 0xF5, 0xF1, 0xA9, 0x3B, 0x5E, 0x64, 0xD8, 0xCB, 0xA5, 0x2F, 0xD9, 0xB2, 0x00, 0x36,
+    0x61, 0x69, 0x6D, 0xE6, 0x0F, 0x5A, 0x1E, 0xCB, 0xEF, 0x71, 0xFC, 0xC6, 0x43, 0xF3, 0x41, 0x76,
+    0x28, 0xEB, 0x0B, 0xE4, 0x5D, 0xE9, 0x92, 0x3E, 0xEB, 0x80, 0x07, 0x0E, 0x09, 0x1A, 0x7F, 0xBD,
+    0xD0, 0xA4, 0x98, 0xB5, 0xEE, 0x66, 0xD6, 0xB5, 0x2F, 0x3A, 0xF7, 0xC8, 0x27, 0x93, 0x84, 0x28,
+    0xE0, 0x50, 0x43, 0x3C, 0x47, 0xA6, 0x80, 0xA8, 0x01, 0x00, 0x0A, 0x17, 0xCF, 0x65, 0x1D, 0xCF,
+    0x66, 0x16, 0x88, 0x34, 0xE8, 0x77, 0x56, 0x67, 0x60, 0x44, 0x8B, 0x04, 0xD2, 0x10, 0xCF, 0xAA,
+    0x8F, 0xE5, 0xF9, 0x87, 0xAB, 0xB3, 0x8E, 0x0D, 0x85, 0x4A, 0x39, 0x9F, 0xCD, 0x8D, 0x75, 0x33,
+    0x5B, 0x04, 0x6A, 0x17, 0x57, 0x01, 0x3D, 0x63, 0x57, 0xED, 0x66, 0xA5, 0xDE, 0xDC, 0x72, 0xED,
+    0xE2, 0x52, 0xAA, 0x45, 0xA4, 0x70, 0xF1, 0x6C, 0xEA, 0x78, 0x26, 0x39, 0x03, 0x2B, 0xC8, 0x65,
+    0x4C, 0x64, 0x22, 0x13, 0x19, 0x2A, 0x09, 0x98, 0xBF, 0xAA, 0x6E, 0xBE, 0xBD, 0xDB, 0x25, 0x96,
+    0xA6, 0xA7, 0xB2, 0xA0, 0xA6, 0xB8, 0x02, 0x1B, 0x47, 0xE1, 0x22, 0x6D, 0x39, 0xC6, 0x4B, 0xDD,
+    0x26, 0x8D, 0x88, 0xC8, 0x98, 0x46, 0x09, 0x41, 0x2B, 0xEF, 0x3C, 0x3E, 0xAD, 0xD7, 0x2F, 0x97,
+    0xDD, 0xA2, 0x0C, 0x53, 0x21, 0x2E, 0x3A, 0xD1, 0x3E, 0x8F, 0x6C, 0x8C, 0x97, 0xE2, 0x41, 0x0D,
+    0x94, 0x8D, 0xE3, 0xC1, 0xF2, 0xC3, 0xDD, 0x1F, 0xCB, 0x7F, 0x68, 0x6A, 0x91, 0x21, 0x13, 0x19,
+    0x52, 0x19, 0xC9, 0x65, 0x82, 0x33, 0x90, 0x9C, 0x41, 0x75, 0xA9, 0x57, 0x5E, 0xF9, 0x74, 0x3C,
+    0xDB, 0x21, 0xE2, 0x28, 0xC6, 0x4D, 0xAF, 0x57, 0x22, 0x63, 0x25, 0x32, 0x55, 0x22, 0x53, 0x35,
+    0x53, 0x3E, 0x9F, 0xF8, 0xB7, 0x5A, 0x9D, 0xA9, 0xA2, 0x82, 0x2F, 0x54, 0xAB, 0xD5, 0x99, 0xCF,
+    0x7C, 0x3E, 0xBE, 0x7F, 0x5A, 0xFE, 0x52, 0x4F, 0x4F, 0x69, 0x4B, 0xCB, 0x98, 0xF9, 0xC8, 0x62,
+    0x17, 0x62, 0x61, 0xEB, 0xB0, 0x04, 0xA2, 0x92, 0x96, 0x52, 0xC4, 0xE6, 0xE3, 0xEF, 0x8D, 0xC9,
+    0x48, 0xEE, 0x4D, 0x8D, 0xF9, 0xB6, 0x27, 0x0D, 0x0D, 0x14, 0xAF, 0x77, 0x24, 0x41, 0x44, 0xE4,
+    0x9A, 0x88, 0x04, 0x59, 0xAF, 0xD7, 0xCF, 0x2D, 0x02, 0xC3, 0xDC, 0xCF, 0x0B, 0x81, 0x0A, 0x51,
+    0x63, 0x91, 0xD8, 0xEA, 0xD6, 0x37, 0xFA, 0x44, 0x44, 0x6C, 0x14, 0xF6, 0xAC, 0x36, 0x43, 0xBD,
+    0x91, 0x5B, 0xB1, 0xFF, 0x3A, 0xB4, 0x88, 0x04, 0xF4, 0x45, 0xB2, 0x68, 0xCD, 0x19, 0xB5, 0xF9,
+    0x51, 0xE4, 0x12, 0xE7, 0x72, 0x54, 0x33, 0xCF, 0xF2, 0x8B, 0x70, 0x20, 0x20, 0x4E, 0xC6, 0xF5,
+    0x7A, 0xBD, 0x5E, 0x8F, 0x51, 0xDA, 0x1F, 0xD3, 0x66, 0xB5, 0x5A, 0xAD, 0xC6, 0x06, 0x48, 0x42,
+    0x4C, 0x2B, 0x20, 0x8D, 0x13, 0x7E, 0x30, 0xF5, 0x32, 0x4B, 0x8B, 0x4E, 0x7B, 0xA8, 0x5C, 0x36,
+    0x92, 0x8A, 0x4D, 0xE4, 0x46, 0x33, 0x42, 0x25, 0xD2, 0x43, 0x1E, 0xB1, 0xF5, 0x71, 0x0B, 0x1C,
+    0x3F, 0x03, 0x85, 0x4C, 0x16, 0x11, 0xA9, 0xD5, 0xAD, 0xAF, 0x4A, 0x7D, 0xDF, 0x6C, 0x02, 0x2B,
+    0x1B, 0x4B, 0xD6, 0x61, 0x69, 0x7B, 0xF1, 0xEA, 0x7A, 0xBD, 0x16, 0x2D, 0x22, 0xC1, 0x88, 0x88,
+    0x1F, 0xA1, 0xB8, 0x3A, 0xC0, 0x7E, 0xEE, 0x23, 0xB2, 0x29, 0x9D, 0x71, 0xC9, 0x88, 0x79, 0xA7,
+    0xEA, 0xA8, 0x64, 0x82, 0x52, 0x5A, 0x48, 0x76, 0x80, 0x84, 0xFB, 0x00, 0xED, 0x0C, 0xA0, 0x5B,
+    0x63, 0x97, 0x7C, 0xB2, 0x41, 0xB6, 0x47, 0x95, 0x12, 0xFF, 0x58, 0x00, 0xF8, 0x00, 0x16, 0xD5,
+    0xE7, 0x2D, 0xBA, 0x35, 0x35, 0x25, 0x57, 0x62, 0xD1, 0xC1, 0xB1, 0xB5, 0x82, 0x4C, 0xE4, 0x22,
+    0x46, 0xA4, 0x63, 0x5A, 0x35, 0x5D, 0x32, 0x57, 0xDE, 0xB8, 0x85, 0xD6, 0x9B, 0x96, 0x7A, 0x67,
+    0x7E, 0xBD, 0x5E, 0x37, 0x57, 0x45, 0x64, 0x06, 0xB3, 0x25, 0xF3, 0x13, 0x94, 0xDF, 0x0A, 0x30,
+    0x66, 0x3E, 0x5A, 0x00, 0x56, 0x56, 0xDF, 0x3A, 0x3B, 0x50, 0x88, 0xD4, 0xE4, 0xD2, 0x03, 0xD1,
+    0x4C, 0x66, 0xF9, 0x70, 0x84, 0xEC, 0x62, 0xBA, 0x7B, 0xA8, 0xE0, 0xAE, 0xAA, 0x7D, 0xEC, 0x28,
+    0x6D, 0x14, 0x3C, 0x7D, 0x73, 0xE1, 0x93, 0xA3, 0x08, 0x87, 0x09, 0x53, 0x53, 0xD6, 0x94, 0x2E,
+    0x09, 0xA4, 0x03, 0x99, 0x27, 0x9F, 0xA5, 0x3E, 0x51, 0x0C, 0x54, 0x3A, 0x92, 0x40, 0x59, 0x67,
+    0x1E, 0xF2, 0x59, 0x50, 0xB4, 0x91, 0x1C, 0x25, 0x8B, 0x28, 0x29, 0xFF, 0xB0, 0xFA, 0xE1, 0xC4,
+    0x81, 0x44, 0x31, 0x6A, 0xF3, 0x01, 0xE4, 0xA9, 0xF1, 0xAC, 0x07, 0xCA, 0x59, 0x3E, 0xB5, 0x11,
+    0x58, 0xC9, 0x2C, 0xC1, 0x2A, 0xDA, 0x74, 0xA0, 0xB2, 0x51, 0xC6, 0xA5, 0x02, 0xC8, 0x2C, 0xF4,
+    0x2A, 0x5A, 0xCA, 0x9A, 0xC6, 0xAA, 0x40, 0x3A, 0xA0, 0xC2, 0x2C, 0x27, 0x2B, 0xBA, 0xA2, 0x25,
+    0x1D, 0x66, 0x5B, 0xC9, 0xB2, 0x46, 0x85, 0x26, 0xDA, 0xB7, 0x15, 0x2D, 0xDC, 0x17, 0x97, 0xA5,
+    0x38, 0x0E, 0x51, 0xFD, 0xCC, 0x25, 0xA4, 0x1E, 0x36, 0x37, 0xEF, 0x75, 0xFC, 0xC6, 0x49, 0x9D,
+    0xD8, 0xC1, 0x92, 0x75, 0x45, 0x4D, 0xE9, 0x1A, 0xB8, 0x90, 0x0C, 0xF7, 0xEA, 0xE3, 0x63, 0x22,
+    0x17, 0x11, 0x11, 0xAF, 0xE4, 0x3D, 0xF1, 0x59, 0x1D, 0x69, 0xFA, 0x38, 0x06, 0xEB, 0x23, 0xD6,
+    0xEE, 0xED, 0xC2, 0x2F, 0xF4, 0x1C, 0xFF, 0xAA, 0x58, 0x44, 0x2E, 0xA2, 0x44, 0x2E, 0xB2, 0xF5,
+    0xAF, 0x1A, 0xBF, 0xA8, 0x69, 0xB5, 0x5F, 0x18, 0xC0, 0x28, 0x87, 0x5E, 0x58, 0xC0, 0xB2, 0x05,
+    0xE4, 0x0F, 0xA0, 0xE8, 0x9B, 0x1B, 0x97, 0xE4, 0x5B, 0x22, 0xD2, 0x27, 0x22, 0x23, 0x6C, 0x9D,
+    0x89, 0x54, 0x4D, 0xE6, 0xB5, 0xCB, 0x7C, 0xE1, 0x54, 0xA7, 0xDD, 0x11, 0x2A, 0xE7, 0xD7, 0x61,
+    0xDE, 0x7E, 0xDC, 0x52, 0x8A, 0x48, 0x27, 0x22, 0xF2, 0xEC, 0x4C, 0x1A, 0x14, 0x7E, 0xC6, 0x6C,
+    0xFA, 0x53, 0x32, 0xFD, 0x6C, 0xA5, 0x95, 0x88, 0x0C, 0x24, 0xFF, 0xAA, 0x09, 0x8B, 0x1E, 0x3C,
+    0xEF, 0x37, 0x1E, 0x01, 0x6E, 0x06, 0x94, 0x0A, 0x4B, 0x51, 0xF3, 0x47, 0xA0, 0x87, 0xE6, 0x9D,
+    0xAF, 0xC9, 0xAB, 0x22, 0x32, 0x24, 0x8D, 0x4C, 0x73, 0xC3, 0x67, 0x31, 0x6B, 0x6F, 0x44, 0xE4,
+    0xB1, 0xF5, 0xFA, 0x92, 0x9F, 0x4D, 0x2A, 0xA2, 0x3A, 0x7F, 0x06, 0xFD, 0x42, 0x09, 0xE5, 0x7E,
+    0x46, 0x05, 0xD5, 0x45, 0xC8, 0x65, 0x80, 0x46, 0x7A, 0x48, 0x9A, 0x76, 0xAE, 0x9E, 0x5A, 0xF8,
+    0xB4, 0x8F, 0xAB, 0x87, 0x92, 0x99, 0x00, 0x20, 0xEF, 0xFF, 0x1D, 0xD9, 0x94, 0xC9, 0x4D, 0xA9,
+    0x2B, 0x91, 0x96, 0x5D, 0xB9, 0x08, 0x5B, 0xAB, 0x95, 0x25, 0x91, 0xD9, 0x8E, 0xCB, 0xC1, 0x6A,
+    0x75, 0x58, 0x35, 0x11, 0x99, 0xFF, 0x77, 0x3D, 0xA4, 0x71, 0x9D, 0x7E, 0xD7, 0x83, 0x9E, 0x2A,
+    0x48, 0xE5, 0x5D, 0x0F, 0xD5, 0x85, 0x0A, 0xF4, 0x9B, 0xEF, 0x7A, 0xD2, 0x61, 0xBF, 0x02, 0x93,
+    0xBF, 0xEB, 0xD1, 0xED, 0x7E, 0x45, 0x12, 0xF2, 0x77, 0x3D, 0x86, 0xFD, 0x0A, 0xDD, 0xE5, 0xEF,
+    0xFA, 0x24, 0xB0, 0x5F, 0x61, 0xC8, 0xDF, 0xF5, 0x79, 0xC7, 0x7E, 0x95, 0x04, 0xF2, 0x77, 0xBD,
+    0xB1, 0xEC, 0x57, 0x79, 0x47, 0xFE, 0xEE, 0xFB, 0x01, 0xF6, 0x2B, 0x63, 0xC9, 0xDF, 0xBD, 0xD3,
+    0xC1, 0x7E, 0x15, 0x20, 0x7F, 0x57, 0x2C, 0xEC, 0x57, 0x1E, 0xF2, 0x77, 0x03, 0xB0, 0x5F, 0xD5,
+    0x90, 0x77, 0xC9, 0x6A, 0xB5, 0x83, 0x11, 0x41, 0x89, 0x78, 0x8E, 0xAF, 0x56, 0x07, 0xF5, 0x1D,
+    0xA1, 0xBA, 0xD6, 0xA2, 0xC3, 0x48, 0x2A, 0xD7, 0x5A, 0x4C, 0x18, 0xC9, 0xDF, 0xBA, 0xD6, 0x26,
+    0x21, 0x8C, 0x18, 0x7D, 0xAD, 0xCD, 0xBA, 0x30, 0x12, 0xF4, 0xB5, 0xB6, 0xB4, 0x61, 0x54, 0x5E,
+    0x5F, 0x6B, 0x47, 0xC2, 0x58, 0xD4, 0xFA, 0xDA, 0x75, 0x4F, 0x18, 0xF7, 0xD1, 0xD7, 0xDE, 0x72,
+    0x04, 0xE9, 0xD1, 0xD7, 0x26, 0x08, 0xE2, 0xD0, 0xD7, 0x06, 0x08, 0xF3, 0xA2, 0x14, 0x94, 0x5F,
+    0x70, 0x44, 0x48, 0xFD, 0x27, 0x2C, 0x55, 0xBF, 0x91, 0x50, 0xE3, 0x01, 0x2C, 0x45, 0x7D, 0x81,
+    0x34, 0xE4, 0x9E, 0xA2, 0xBE, 0x70, 0x0F, 0xAC, 0xF0, 0x6B, 0x04, 0xDF, 0xFC, 0xB1, 0x0B, 0xC9,
+    0x00, 0x11, 0x31, 0x45, 0x1C, 0xF5, 0xC9, 0xEB, 0x4F, 0xD2, 0xC8, 0xC5, 0xB8, 0x1C, 0x58, 0x72,
+    0x11, 0x19, 0xC8, 0x27, 0x12, 0x71, 0x59, 0x80, 0x7C, 0x50, 0x01, 0x90, 0x64, 0xDC, 0x18, 0xB2,
+    0xA4, 0x21, 0x3A, 0x0D, 0x9D, 0x6D, 0x01, 0xFD, 0x9E, 0x07, 0xD4, 0x14, 0xD5, 0xD9, 0x51, 0x9F,
+    0x7D, 0xD3, 0x01, 0xF9, 0x1D, 0x0F, 0xA4, 0x87, 0x6F, 0x98, 0xB7, 0x1C, 0xA0, 0x7F, 0x1A, 0xAD,
+    0xFC, 0xE3, 0xAB, 0xCA, 0x16, 0x98, 0x54, 0x00, 0x1A, 0x5B, 0x39, 0x68, 0xEA, 0x7C, 0x24, 0x11,
+    0x47, 0x33, 0xBD, 0x22, 0x8E, 0x4C, 0x44, 0x6A, 0x28, 0xA2, 0x45, 0xEF, 0xD6, 0xCE, 0xDC, 0x8C,
+    0xB4, 0xCF, 0x5B, 0x74, 0x67, 0x6A, 0x4A, 0xFB, 0xB1, 0x45, 0x9F, 0x95, 0x85, 0x4A, 0x3A, 0x72,
+    0x91, 0x9E, 0xE6, 0x9D, 0xDD, 0x3E, 0x1B, 0xD0, 0xDE, 0x38, 0xF4, 0x8F, 0x03, 0x94, 0xAF, 0x7B,
+    0x30, 0x55, 0x1D, 0x39, 0x27, 0x75, 0xA7, 0x07, 0x7D, 0xB3, 0x05, 0xD3, 0xD4, 0x30, 0xED, 0x83,
+    0xFA, 0x30, 0x80, 0xBE, 0xDA, 0x43, 0x93, 0x7B, 0xD4, 0xA0, 0x3B, 0x8C, 0x2B, 0x6E, 0x7D, 0x2D,
+    0x50, 0x44, 0x21, 0xF9, 0xB0, 0x59, 0xF4, 0x01, 0xD8, 0x95, 0xB7, 0xA3, 0x21, 0x47, 0x4B, 0x2A,
+    0x22, 0x13, 0xA9, 0xD4, 0x54, 0x3E, 0x11, 0x48, 0x27, 0x04, 0x30, 0x2E, 0xAE, 0xAB, 0x11, 0x73,
+    0xE9, 0x0E, 0x28, 0xDE, 0xEC, 0x99, 0x4D, 0x6D, 0x40, 0x66, 0xC0, 0x89, 0x88, 0xC8, 0x9D, 0xA8,
+    0x43, 0x8C, 0xFC, 0xC2, 0x21, 0x88, 0xEA, 0x8F, 0x3C, 0x44, 0xF3, 0xD8, 0xE8, 0x1B, 0x02, 0x4D,
+    0x1E, 0x95, 0x44, 0x02, 0x94, 0x6D, 0xE1, 0xA1, 0xEC, 0x52, 0xB1, 0x18, 0x4F, 0x39, 0xAD, 0xC5,
+    0x93, 0x88, 0x44, 0x11, 0x79, 0x94, 0xD2, 0x9D, 0x99, 0x2D, 0x1E, 0x49, 0x44, 0x6A, 0x4A, 0x91,
+    0x36, 0x95, 0xE7, 0x9B, 0xB6, 0xE8, 0x30, 0x6E, 0x9A, 0x95, 0x1A, 0x55, 0xE9, 0x66, 0xC8, 0x7C,
+    0x34, 0xAD, 0xD7, 0x97, 0x6E, 0x8A, 0x88, 0x34, 0xB3, 0x2C, 0x56, 0xDD, 0x1E, 0x88, 0xDE, 0x3A,
+    0xE6, 0x49, 0x47, 0x1A, 0x8C, 0x8B, 0x9D, 0x20, 0x54, 0xEF, 0xEC, 0xF6, 0x54, 0x22, 0x96, 0x52,
+    0xBA, 0x99, 0xEA, 0xFC, 0x22, 0x23, 0xF1, 0x98, 0x4C, 0x16, 0x0A, 0x91, 0x31, 0x32, 0x71, 0x1D,
+    0xE5, 0x40, 0x26, 0xC4, 0x36, 0x69, 0x0F, 0x2A, 0x44, 0x8D, 0xD8, 0xB3, 0xD1, 0xFD, 0x62, 0x02,
+    0x92, 0xB1, 0xB2, 0x80, 0xB9, 0xE4, 0x00, 0x3D, 0x0F, 0xB8, 0x19, 0x6E, 0xB2, 0xC8, 0x90, 0x45,
+    0x0E, 0x8F, 0x44, 0xA9, 0x00, 0xCC, 0x73, 0x2D, 0xA0, 0xAF, 0x1F, 0x78, 0x72, 0xA8, 0x41, 0x7B,
+    0x48, 0xC7, 0xB9, 0xD3, 0xCA, 0x1E, 0x25, 0xA4, 0x51, 0x07, 0x5B, 0xC4, 0xE5, 0xAB, 0x8A, 0x06,
+    0x5F, 0x1B, 0xC2, 0xF3, 0x4B, 0x8D, 0xC1, 0x3A, 0x8E, 0xC1, 0xE2, 0x60, 0x0C, 0xCA, 0x7A, 0xFD,
+    0xCA, 0x9D, 0x4D, 0x65, 0x37, 0x63, 0xF0, 0x17, 0x01, 0xF4, 0x75, 0x0F, 0x8D, 0x3E, 0x3C, 0x06,
+    0xC7, 0xBB, 0xC7, 0xE0, 0x0E, 0x96, 0x88, 0x64, 0xD2, 0x90, 0xFB, 0x39, 0x7B, 0xEF, 0xA9, 0x7E,
+    0x6C, 0x26, 0x28, 0xA4, 0xC5, 0x88, 0x48, 0x9D, 0xBC, 0xCD, 0x89, 0x09, 0xA0, 0x18, 0x36, 0xDA,
+    0xE9, 0x64, 0x3A, 0xD0, 0xE9, 0x56, 0x76, 0x43, 0xD7, 0x9B, 0x59, 0x9B, 0xD5, 0x88, 0x88, 0xCB,
+    0x45, 0x24, 0x70, 0x6E, 0x1D, 0x59, 0xEC, 0x48, 0xF2, 0x97, 0xEE, 0xE0, 0x59, 0xBB, 0x79, 0xC3,
+    0x81, 0xF1, 0xAE, 0x1E, 0x52, 0x4B, 0x2E, 0x98, 0x1B, 0x97, 0xA4, 0x8E, 0x75, 0x38, 0x21, 0xD2,
+    0x12, 0xD9, 0xB6, 0x84, 0xFB, 0xD0, 0xCE, 0xA0, 0x9D, 0xB1, 0xDA, 0x99, 0xA3, 0xC8, 0x7E, 0x65,
+    0x29, 0x65, 0xC0, 0x88, 0xD8, 0xED, 0x55, 0xD3, 0x46, 0x62, 0x41, 0x1D, 0x21, 0x41, 0x8E, 0xAD,
+    0xD7, 0x53, 0x16, 0x65, 0xC2, 0xD3, 0x2C, 0x2B, 0x9F, 0xE2, 0xBD, 0x64, 0x26, 0x61, 0x0A, 0x7F,
+    0xE1, 0xAB, 0xD2, 0x56, 0x22, 0xB6, 0x94, 0x21, 0x7E, 0x74, 0x6B, 0xB5, 0xB2, 0xA0, 0x45, 0xDC,
+    0x92, 0xC6, 0x92, 0xBB, 0xD6, 0x97, 0x74, 0x88, 0x8C, 0x7A, 0x94, 0x94, 0xE8, 0x0E, 0x74, 0x97,
+    0x47, 0x41, 0xCE, 0x00, 0xA6, 0x4E, 0xA3, 0x85, 0x55, 0xF4, 0xD8, 0x69, 0xA2, 0xDD, 0x7B, 0x9D,
+    0x06, 0x28, 0x9D, 0x1A, 0x40, 0x77, 0x91, 0x2C, 0x8F, 0xB4, 0x46, 0xE1, 0x20, 0x0D, 0x65, 0x0D,
+    0x4C, 0xC6, 0x1E, 0x60, 0xC6, 0x11, 0xA0, 0x0C, 0x2C, 0x14, 0xD0, 0x22, 0x67, 0xEA, 0x0E, 0xCC,
+    0x06, 0xC4, 0x82, 0x92, 0x09, 0x50, 0xD1, 0xB6, 0x30, 0x6A, 0x91, 0x22, 0x1E, 0x5A, 0xAD, 0xCE,
+    0x80, 0x48, 0x98, 0x93, 0xD5, 0xEA, 0x10, 0x7A, 0x42, 0x0E, 0xEC, 0x2E, 0xEB, 0x8D, 0xDD, 0x65,
+    0x7B, 0xD8, 0xEE, 0xB2, 0x8E, 0x76, 0x97, 0x81, 0x06, 0x0E, 0x99, 0xA8, 0xA6, 0x03, 0x98, 0xC7,
+    0xFB, 0xD9, 0xEE, 0x52, 0xBF, 0xDE, 0x81, 0x7E, 0xCB, 0x41, 0x76, 0xD3, 0xCD, 0x86, 0xD4, 0xA9,
+    0x6C, 0xBA, 0x79, 0x5C, 0x18, 0xBF, 0xE8, 0x45, 0xEB, 0x17, 0xD2, 0xAC, 0x72, 0xD0, 0x88, 0x85,
+    0x66, 0x04, 0xAA, 0xD9, 0xFD, 0x20, 0xD9, 0x20, 0x83, 0xDC, 0x97, 0x6E, 0x83, 0x18, 0xEE, 0x2D,
+    0x7C, 0xFB, 0x47, 0xD3, 0x0D, 0x0F, 0xB2, 0x33, 0xE3, 0xBB, 0x26, 0x0D, 0x73, 0xEE, 0x1E, 0x1C,
+    0xCD, 0x6F, 0x60, 0x87, 0x1C, 0x7B, 0xF1, 0xE1, 0x1A, 0xB4, 0x37, 0x16, 0x0A, 0xB7, 0x0F, 0x98,
+    0x47, 0x03, 0x70, 0x45, 0x79, 0xA0, 0xCF, 0xEF, 0x25, 0x19, 0xFD, 0x47, 0xD3, 0x2D, 0xAC, 0x8F,
+    0xBD, 0x40, 0x12, 0xF4, 0x2C, 0x28, 0xC9, 0x3B, 0x03, 0xBA, 0xBE, 0x02, 0xDB, 0x49, 0x0F, 0x0F,
+    0x1E, 0xC1, 0x95, 0x8B, 0xF3, 0x8D, 0x1A, 0x96, 0xBE, 0xC9, 0xBD, 0x6E, 0xD1, 0x6D, 0x7E, 0xA4,
+    0x6F, 0xEC, 0xD2, 0x37, 0x13, 0xEC, 0xF3, 0x09, 0x7D, 0x93, 0x1F, 0xED, 0x9B, 0xE4, 0xB3, 0xFB,
+    0xA6, 0x74, 0xF0, 0x77, 0x77, 0xF5, 0xCD, 0x7D, 0x3C, 0x00, 0x86, 0x00, 0xC6, 0x8E, 0x60, 0xD8,
+    0xBB, 0xE7, 0xA0, 0x32, 0xC0, 0x15, 0x43, 0x34, 0xD3, 0xFB, 0x7C, 0x89, 0x85, 0xC9, 0xD4, 0x30,
+    0x95, 0x2D, 0x4C, 0x7A, 0xE0, 0xC4, 0x94, 0x89, 0xC8, 0x94, 0x88, 0xC8, 0xC4, 0x09, 0xB9, 0xF8,
+    0xD9, 0xAA, 0xB5, 0x8F, 0x27, 0x3B, 0x89, 0xE5, 0x42, 0x32, 0x50, 0xBA, 0x26, 0xCE, 0xEA, 0xBB,
+    0xD7, 0xA2, 0x09, 0x0A, 0xA9, 0xC9, 0xA4, 0x23, 0x91, 0x01, 0xAA, 0xA5, 0xE0, 0x4E, 0x47, 0x32,
+    0x0D, 0x50, 0x35, 0xD1, 0x9A, 0x2E, 0xFF, 0xB9, 0xDC, 0x68, 0x42, 0x29, 0x22, 0x49, 0x33, 0x9D,
+    0x9D, 0xC5, 0xB5, 0x49, 0x98, 0x47, 0x5E, 0x71, 0xA4, 0xA0, 0x12, 0x91, 0x62, 0xD6, 0x75, 0xBF,
+    0x7F, 0xEF, 0x47, 0x7E, 0x15, 0x05, 0x21, 0x2A, 0xF0, 0xA2, 0x99, 0xF4, 0x22, 0x36, 0x37, 0xB3,
+    0xBE, 0xF9, 0x48, 0xC1, 0x81, 0xE3, 0xD4, 0x5B, 0x22, 0x1F, 0x4D, 0xEB, 0x97, 0xC7, 0xC5, 0x51,
+    0x6A, 0x76, 0x90, 0xFA, 0xF4, 0x8B, 0xDB, 0x56, 0x49, 0x8B, 0x7C, 0xE2, 0xA3, 0xCB, 0x12, 0x3F,
+    0xCB, 0xF1, 0xA2, 0xAC, 0x69, 0x96, 0x34, 0x7D, 0x12, 0x9D, 0x5F, 0xB1, 0x51, 0xEB, 0x47, 0xBD,
+    0xFE, 0x17, 0xBE, 0x58, 0xED, 0x80, 0x7E, 0x4D, 0xE4, 0x16, 0x84, 0x4A, 0x24, 0xA0, 0x5F, 0xBB,
+    0xBD, 0x16, 0x4F, 0xA8, 0xA0, 0x71, 0xFA, 0x35, 0x4F, 0x3A, 0x12, 0x2A, 0xD0, 0x9D, 0x7E, 0xCD,
+    0xC3, 0x44, 0xA8, 0x20, 0xF7, 0xFA, 0xB5, 0x68, 0x46, 0xBB, 0xB9, 0x93, 0xC4, 0xC7, 0x8C, 0xD3,
+    0xAF, 0x79, 0xCA, 0x9E, 0x50, 0x89, 0x4C, 0xE8, 0xD7, 0x44, 0xC4, 0x12, 0x2A, 0x99, 0x2C, 0xDA,
+    0xCD, 0x64, 0x80, 0xB1, 0x23, 0x51, 0xEE, 0x83, 0xF2, 0xB9, 0xFB, 0x24, 0xA9, 0xE5, 0x08, 0xA8,
+    0x8F, 0x7A, 0x40, 0xBF, 0xD5, 0x12, 0x0D, 0x60, 0xA2, 0xBF, 0xD8, 0x5D, 0xC5, 0xF2, 0x33, 0x18,
+    0x45, 0xA4, 0x55, 0x1F, 0x89, 0x48, 0xAB, 0xDF, 0x6A, 0xA9, 0x9C, 0xA9, 0x2C, 0x95, 0x1D, 0x47,
+    0x98, 0xD4, 0x47, 0x3D, 0x6A, 0xD0, 0x6F, 0xB5, 0xE8, 0x6E, 0x53, 0x9C, 0x85, 0xE5, 0x69, 0x91,
+    0x11, 0x53, 0xC9, 0x64, 0x19, 0x93, 0xE8, 0xEF, 0xB4, 0x49, 0xC2, 0x32, 0xAB, 0x3F, 0x47, 0xF2,
+    0xCF, 0xA7, 0xF5, 0x4B, 0x18, 0x89, 0x84, 0xCD, 0x10, 0xA9, 0xA8, 0xCF, 0xFD, 0x82, 0xE8, 0xA8,
+    0xBD, 0x24, 0x71, 0xE0, 0x1D, 0x4D, 0x92, 0xB3, 0x1D, 0xA4, 0xD2, 0x42, 0x2A, 0xF6, 0x10, 0xBB,
+    0xA2, 0x44, 0x46, 0x25, 0x32, 0xAA, 0x69, 0xFD, 0xF2, 0xE2, 0xAD, 0x77, 0xF8, 0xEF, 0xF7, 0x6E,
+    0xAD, 0x68, 0x44, 0x5C, 0x23, 0xE2, 0x7E, 0xEF, 0xD6, 0x8A, 0x7B, 0x3D, 0xA3, 0xA6, 0x1A, 0x25,
+    0x6D, 0xC4, 0xB1, 0xF9, 0xA1, 0x3F, 0xDD, 0x92, 0xEE, 0x3A, 0x32, 0xA9, 0xA3, 0xB4, 0x78, 0x67,
+    0x71, 0xB1, 0xA8, 0x2C, 0x8C, 0x08, 0xE8, 0x8E, 0x09, 0xAA, 0xD9, 0xC3, 0x42, 0x05, 0x4A, 0x87,
+    0xEA, 0x93, 0x30, 0x9B, 0x56, 0xCF, 0x0E, 0x16, 0xC5, 0x75, 0x0F, 0x94, 0x52, 0x6F, 0x94, 0x6C,
+    0x95, 0x63, 0xC1, 0x9F, 0x5A, 0x00, 0x9A, 0x69, 0xE3, 0x5E, 0x61, 0x9E, 0x0D, 0x90, 0x04, 0xD5,
+    0xCF, 0x7E, 0x2E, 0xD1, 0xBB, 0x22, 0xF3, 0x14, 0x2D, 0xA6, 0xA6, 0x74, 0x69, 0x00, 0x53, 0x47,
+    0xE7, 0x8A, 0x09, 0x90, 0x3B, 0x9E, 0x25, 0x3A, 0x87, 0x39, 0x50, 0xD4, 0xAA, 0x03, 0x43, 0xF1,
+    0x7F, 0x3A, 0x6D, 0x1C, 0x39, 0xA2, 0xBF, 0x58, 0xB2, 0xF3, 0x6B, 0x70, 0xAD, 0xF0, 0x77, 0xB9,
+    0x56, 0x4C, 0x2F, 0x7C, 0xB6, 0x6B, 0xC5, 0x56, 0xE5, 0xE6, 0x7E, 0xA5, 0xE9, 0x80, 0x2D, 0x4B,
+    0x59, 0x43, 0xF9, 0xCD, 0x11, 0x54, 0x1F, 0x9D, 0x58, 0x4C, 0x4D, 0xE1, 0x22, 0x84, 0x75, 0x47,
+    0x33, 0xBB, 0xB0, 0xA4, 0x11, 0x42, 0x5D, 0x03, 0x54, 0x4F, 0xBA, 0xD9, 0x45, 0xE5, 0xDC, 0x25,
+    0x59, 0x5F, 0xCC, 0x45, 0x64, 0xA2, 0x11, 0x91, 0x2E, 0x59, 0xC9, 0x87, 0x67, 0x66, 0xD8, 0x47,
+    0xF0, 0x4E, 0xDA, 0xCF, 0xCE, 0x2B, 0xD1, 0x49, 0x7C, 0x42, 0x77, 0x14, 0x8E, 0xCA, 0x46, 0xD7,
+    0x95, 0x06, 0x74, 0x57, 0xB4, 0xD0, 0xA8, 0x81, 0x28, 0xE9, 0x5D, 0x9C, 0x4C, 0x4B, 0x47, 0xD6,
+    0x6B, 0x1F, 0xED, 0x26, 0x4B, 0x97, 0x84, 0x68, 0x30, 0x39, 0x81, 0xF9, 0x56, 0x80, 0xE2, 0x4D,
+    0x1F, 0x61, 0x75, 0xFF, 0x2B, 0x72, 0xE3, 0xA2, 0x16, 0x11, 0x1F, 0x75, 0x0E, 0x99, 0xB8, 0x59,
+    0xB2, 0x50, 0x5E, 0x1D, 0xA0, 0x8A, 0x71, 0x4E, 0x1A, 0x54, 0xC0, 0xD4, 0xB9, 0xA7, 0x68, 0x8B,
+    0x36, 0xAA, 0x8E, 0x54, 0x60, 0x87, 0x47, 0x48, 0x7F, 0xB0, 0xBE, 0x22, 0xB2, 0x97, 0x3D, 0x97,
+    0x3D, 0xFB, 0x6A, 0xED, 0x39, 0x85, 0x46, 0x39, 0x3E, 0x6F, 0xE6, 0x7E, 0x48, 0x6C, 0xD2, 0x25,
+    0x5D, 0x72, 0xFB, 0xE5, 0x46, 0x5E, 0xB7, 0xFE, 0x7B, 0xA7, 0xEE, 0xFF, 0x42, 0x2F, 0x98, 0x33,
+    0x7F, 0x7C, 0x6E, 0xFD, 0xBF, 0xC9, 0xD4, 0xC8, 0x8F, 0x57, 0x67, 0x0E, 0x72, 0x95, 0x88, 0xDC,
+    0x16, 0x11, 0xF9, 0x48, 0x44, 0xC4, 0x9D, 0x5B, 0xCF, 0x87, 0xCC, 0xC7, 0x9D, 0x25, 0xF3, 0xBF,
+    0xAF, 0xE6, 0xE3, 0x8F, 0xF8, 0x83, 0x6D, 0xCC, 0x3F, 0xE4, 0xFF, 0xC5, 0xAC, 0x42, 0x44, 0xAE,
+    0x47, 0x9F, 0xC4, 0x03, 0xFE, 0x41, 0x89, 0x48, 0x2F, 0x22, 0xE3, 0xF1, 0xD5, 0x6A, 0x85, 0xEE,
+    0xA6, 0xE2, 0x8D, 0x50, 0x3E, 0xEB, 0x4D, 0xD6, 0xEE, 0x6D, 0xD9, 0xEA, 0xD1, 0x51, 0x0D, 0xB9,
+    0x2F, 0x9C, 0xB1, 0x57, 0x18, 0x52, 0x9F, 0x58, 0xDD, 0x99, 0x67, 0x87, 0xE2, 0x07, 0x63, 0xE6,
+    0x9B, 0x34, 0x98, 0x7A, 0xD2, 0xCE, 0x28, 0x5F, 0x7C, 0xB3, 0xCF, 0xDA, 0xBD, 0xD4, 0x1F, 0x67,
+    0x87, 0x2A, 0x09, 0x59, 0x5F, 0xB4, 0xA6, 0x9E, 0xD2, 0xA0, 0xBB, 0xC2, 0x55, 0x04, 0xE5, 0xF3,
+    0xB6, 0xB4, 0xDB, 0xC9, 0x90, 0x7A, 0xED, 0xB6, 0x78, 0x90, 0xFB, 0xEB, 0xB8, 0x58, 0x85, 0x38,
+    0xFC, 0xB5, 0x8B, 0xBE, 0x94, 0x97, 0xB9, 0x2F, 0x6D, 0xB7, 0x9A, 0x28, 0x1B, 0xF9, 0xC5, 0x7F,
+    0xF8, 0xDB, 0x73, 0x75, 0xDA, 0x42, 0x5E, 0xC3, 0x49, 0xE0, 0x72, 0x74, 0xF5, 0xD4, 0x75, 0x9C,
+    0x28, 0x87, 0x7E, 0x7B, 0xD7, 0x65, 0x15, 0xB1, 0x68, 0xD6, 0x47, 0x75, 0xC4, 0xFD, 0x75, 0x64,
+    0x59, 0x0F, 0x3D, 0x51, 0x02, 0x97, 0x31, 0xEF, 0xDD, 0x8E, 0x92, 0x98, 0xE6, 0x92, 0xE7, 0xF2,
+    0xD1, 0xD7, 0x8D, 0x47, 0x2F, 0x2F, 0x73, 0xFC, 0xB1, 0xEE, 0xAB, 0x73, 0x47, 0x7E, 0xB8, 0x73,
+    0xF9, 0x78, 0x9D, 0x76, 0x1F, 0xFB, 0x76, 0xD1, 0xC2, 0x0E, 0x4D, 0x57, 0xC8, 0xB3, 0x12, 0x8C,
+    0x5C, 0x9D, 0x93, 0x42, 0x6C, 0xD9, 0x42, 0xD2, 0x92, 0x79, 0x8A, 0x81, 0x6A, 0x4A, 0x44, 0x9E,
+    0x90, 0xB1, 0x90, 0xBA, 0xEA, 0x92, 0x91, 0xCC, 0x02, 0xFC, 0x41, 0xF9, 0xD6, 0x9D, 0xA9, 0xF9,
+    0x13, 0xB6, 0x60, 0xC7, 0x38, 0x15, 0xAA, 0x56, 0x8D, 0xA6, 0x55, 0xA3, 0x71, 0x2A, 0x6C, 0xC1,
+    0xCE, 0x96, 0x0A, 0xD5, 0xF5, 0xD1, 0xB8, 0x9D, 0x73, 0xEB, 0x46, 0xE4, 0x4B, 0x0C, 0xDE, 0x53,
+    0x68, 0x52, 0xC7, 0x7A, 0x5D, 0xC9, 0x97, 0xF8, 0xE5, 0x9C, 0xF9, 0x9D, 0x4A, 0xDE, 0x94, 0xF1,
+    0xAE, 0x04, 0x8F, 0xE6, 0x4B, 0x25, 0x95, 0xBC, 0xB9, 0x7E, 0xE9, 0x2F, 0xC9, 0xE0, 0x2F, 0xC9,
+    0xE0, 0xDF, 0xAE, 0x9E, 0xF8, 0xE5, 0xDE, 0xF6, 0xC6, 0xFA, 0x3F, 0x42, 0xCB, 0x6F, 0x43, 0xCB,
+    0x6F, 0x1F, 0x5F, 0xFD, 0x52, 0x75, 0x3B, 0xEC, 0x3A, 0x3E, 0xCC, 0xE1, 0x83, 0xC8, 0xC4, 0xCF,
+    0xAE, 0xC7, 0x8C, 0xA5, 0x8B, 0xE1, 0x84, 0x28, 0xEC, 0x1E, 0x59, 0xB4, 0xD5, 0xF3, 0xAA, 0x9B,
+    0x8D, 0x82, 0x0C, 0xDB, 0x14, 0x35, 0x80, 0xEA, 0x94, 0x9F, 0x8D, 0x87, 0xB6, 0x31, 0x3C, 0xC3,
+    0x52, 0x38, 0x7B, 0x84, 0x6C, 0x63, 0xD2, 0x7E, 0x53, 0xB8, 0x9D, 0xEC, 0xC0, 0x19, 0x0C, 0xDB,
+    0xF9, 0xF7, 0xA5, 0xA3, 0x1A, 0x52, 0x9F, 0xB5, 0x43, 0x25, 0x75, 0x21, 0x9D, 0xAE, 0x83, 0xD1,
+    0xED, 0xA8, 0x7A, 0x63, 0x9B, 0xE6, 0xDB, 0xDD, 0xA0, 0xBA, 0x6D, 0x06, 0x25, 0x5D, 0x28, 0xAC,
+    0xC9, 0x5A, 0xED, 0x8E, 0xBD, 0x50, 0x3C, 0xE6, 0x53, 0xBF, 0xC7, 0x1E, 0x28, 0x5F, 0x52, 0xFC,
+    0xA9, 0xCB, 0x1C, 0x5C, 0x51, 0x3E, 0xE9, 0x03, 0xCF, 0x44, 0xFA, 0xB1, 0x78, 0xD2, 0x65, 0x2D,
+    0xA9, 0x4F, 0x7D, 0xD2, 0xEF, 0x71, 0x1E, 0xB6, 0x29, 0x29, 0x73, 0x97, 0x3B, 0xB4, 0x4B, 0x7A,
+    0xE5, 0x9F, 0x21, 0x90, 0x0C, 0xE8, 0x7A, 0x5B, 0x75, 0xBA, 0xC6, 0xC0, 0x15, 0xDD, 0x96, 0x8F,
+    0xF7, 0x64, 0x2D, 0x4A, 0x06, 0x64, 0x82, 0x00, 0x7A, 0x62, 0x36, 0x93, 0x62, 0x0B, 0x92, 0xBB,
+    0x29, 0xD2, 0x44, 0x6A, 0xE6, 0xB6, 0x02, 0xB9, 0xF8, 0x43, 0x2E, 0x8C, 0xFA, 0xBF, 0x84, 0xC5,
+    0xB6, 0x0A, 0x28, 0xED, 0x95, 0x8D, 0xC1, 0x58, 0x84, 0x5B, 0xDE, 0x1E, 0x5C, 0x19, 0xF4, 0xC6,
+    0x95, 0x7B, 0x1B, 0x33, 0x83, 0x3C, 0x5A, 0x62, 0x19, 0xB6, 0x8F, 0x5C, 0x85, 0xC3, 0x57, 0x07,
+    0x1F, 0x60, 0x1B, 0xA3, 0xFC, 0x96, 0x65, 0x01, 0xAD, 0xC9, 0xDA, 0xA6, 0xA7, 0x1C, 0xC9, 0xC5,
+    0x96, 0x5C, 0xD0, 0x57, 0x65, 0xA4, 0x11, 0x5B, 0x4A, 0x5B, 0xB8, 0x50, 0x3E, 0xE1, 0x9B, 0x64,
+    0x2C, 0x9C, 0x79, 0xC2, 0x6B, 0x19, 0xB6, 0xB5, 0x2B, 0x1F, 0xEB, 0xF3, 0xF6, 0x4A, 0x32, 0x28,
+    0xE9, 0xF6, 0xB4, 0x2B, 0x9E, 0xF5, 0xAA, 0x0B, 0x04, 0xCE, 0xD9, 0xA1, 0xA8, 0xF5, 0xD5, 0x4E,
+    0xF9, 0x10, 0x11, 0x40, 0x51, 0xEB, 0xD7, 0x96, 0xAB, 0xAC, 0x2D, 0xAC, 0x7E, 0xAD, 0x53, 0x7E,
+    0x60, 0x0F, 0xB4, 0x3B, 0x7C, 0x55, 0xD8, 0xC3, 0xBF, 0x33, 0xE8, 0x43, 0x57, 0x57, 0x38, 0xF4,
+    0x05, 0x06, 0x0E, 0xBE, 0x4E, 0xEA, 0xC9, 0x7C, 0x43, 0xAC, 0x19, 0xAA, 0x23, 0x8D, 0xB5, 0x2E,
+    0xA4, 0x43, 0x3B, 0x88, 0x2D, 0xCA, 0xE6, 0x60, 0x0F, 0x5B, 0xCC, 0xAD, 0xA5, 0xB4, 0x85, 0xD3,
+    0x6D, 0xD6, 0x29, 0x9F, 0xF4, 0x04, 0xCE, 0xB3, 0x4D, 0x01, 0x94, 0x76, 0xA0, 0x52, 0x3D, 0x63,
+    0xE6, 0x93, 0x41, 0x3B, 0xE5, 0x8B, 0x3A, 0x6B, 0x4B, 0xB4, 0x3B, 0x4D, 0xC1, 0x65, 0xB6, 0xF1,
+    0x9C, 0x4F, 0x5B, 0x28, 0xED, 0x90, 0xB7, 0x99, 0x2F, 0x6D, 0x60, 0x54, 0xBE, 0xB4, 0x45, 0xBD,
+    0xA7, 0xBC, 0xF2, 0xBA, 0xDE, 0xE3, 0x99, 0xD4, 0xEB, 0x5A, 0xBB, 0xD3, 0xA9, 0x4F, 0x7C, 0x5E,
+    0x9F, 0x66, 0x1B, 0x9F, 0xD7, 0x99, 0x7B, 0x04, 0xCF, 0x15, 0xB4, 0x4B, 0x07, 0x0C, 0x59, 0xC7,
+    0x1E, 0xBA, 0x4E, 0x3C, 0xDB, 0x28, 0x77, 0x25, 0xEB, 0x08, 0xDA, 0xA5, 0x43, 0x51, 0x2B, 0x6F,
+    0xC8, 0xBA, 0x6D, 0x72, 0xB7, 0x87, 0xAE, 0x07, 0x8A, 0xC4, 0xB3, 0x9D, 0x76, 0x9C, 0x52, 0xEE,
+    0x4A, 0xD6, 0x5D, 0x40, 0xBB, 0xF8, 0xE0, 0x37, 0x07, 0x8C, 0xF2, 0x25, 0x59, 0xB7, 0xAD, 0x3A,
+    0xF6, 0xE6, 0xC7, 0x75, 0x9D, 0xF8, 0xF9, 0x17, 0x27, 0x51, 0xEE, 0x94, 0x8A, 0x53, 0xE9, 0x64,
+    0x44, 0xC6, 0xF9, 0x00, 0xA7, 0x3D, 0xE9, 0x4F, 0x3A, 0xB4, 0x72, 0x5C, 0xCE, 0xAD, 0x72, 0x9A,
+    0x93, 0x3C, 0x82, 0xE7, 0x54, 0x5E, 0xD3, 0x9F, 0x26, 0xF1, 0x6C, 0xC1, 0x80, 0xB1, 0xBA, 0x4B,
+    0x03, 0x4D, 0x34, 0xDB, 0xAA, 0x66, 0xDF, 0x69, 0x53, 0x33, 0x11, 0xF5, 0xD0, 0x17, 0xEF, 0x43,
+    0x75, 0x98, 0x9A, 0x71, 0x2E, 0x68, 0x22, 0x55, 0x9B, 0xF9, 0x64, 0x5C, 0x7E, 0x5D, 0xC1, 0x41,
+    0xB8, 0x89, 0x99, 0xB1, 0xE9, 0xC9, 0x06, 0x54, 0x6B, 0x6C, 0x32, 0xA1, 0x06, 0xD5, 0x63, 0x50,
+    0x03, 0xC6, 0x26, 0xA8, 0x21, 0x12, 0xD9, 0x03, 0x18, 0x8B, 0x1A, 0x88, 0x41, 0x78, 0x20, 0x52,
+    0x5C, 0x90, 0xF5, 0x51, 0xCE, 0x5A, 0x3D, 0x3E, 0xC0, 0x16, 0xD9, 0x47, 0x03, 0xF7, 0xE9, 0x8E,
+    0x6A, 0xA0, 0xB8, 0x1A, 0xC8, 0x06, 0xF2, 0x5E, 0x50, 0x62, 0x93, 0xB1, 0xB0, 0xEA, 0x4E, 0xCF,
+    0x49, 0x50, 0xC3, 0x2C, 0xCB, 0xCD, 0xE6, 0xF8, 0x4B, 0x15, 0x1B, 0x07, 0x27, 0x35, 0x44, 0xDB,
+    0xFD, 0x21, 0x46, 0x2A, 0x18, 0x80, 0x0A, 0x35, 0x70, 0x92, 0xCC, 0xAB, 0x81, 0xA2, 0xA5, 0x4A,
+    0x06, 0xB2, 0x81, 0xAC, 0xFB, 0x7D, 0x18, 0xE1, 0xCF, 0x81, 0x3F, 0x88, 0xE4, 0x5D, 0xF1, 0xD3,
+    0x90, 0x4C, 0xC6, 0xE9, 0x9F, 0x06, 0x26, 0xE3, 0xF4, 0x1B, 0x81, 0xB1, 0xAC, 0xF5, 0x1B, 0xC3,
+    0x72, 0x0A, 0x45, 0xAD, 0xBF, 0xDF, 0x13, 0x0A, 0x9B, 0x7F, 0xBF, 0x67, 0xAF, 0xB0, 0xB9, 0xEB,
+    0xD9, 0xD3, 0x36, 0x77, 0x9E, 0x3D, 0x4D, 0xE6, 0x76, 0x78, 0x70, 0xB1, 0xD4, 0xE0, 0xD8, 0xE3,
+    0x21, 0x99, 0xAA, 0xB6, 0xFC, 0x60, 0x4C, 0xC5, 0xB8, 0xA2, 0xDB, 0xE1, 0x2B, 0x11, 0x53, 0x4C,
+    0x94, 0x22, 0xAD, 0x91, 0xB3, 0xFD, 0x7D, 0x26, 0x8D, 0x76, 0xAA, 0x86, 0x67, 0xE6, 0xBF, 0x2B,
+    0x18, 0xF6, 0x30, 0x04, 0x8C, 0xEA, 0x31, 0xBA, 0xC3, 0x54, 0x96, 0x72, 0x84, 0xD2, 0x47, 0x79,
+    0x4A, 0x59, 0x47, 0xDB, 0xFA, 0xF2, 0xB0, 0x2D, 0xD2, 0x81, 0xCD, 0xC5, 0x12, 0xC6, 0x01, 0x53,
+    0xC3, 0xD6, 0x6C, 0xC0, 0x66, 0x44, 0x44, 0x1E, 0x5E, 0xAF, 0xD7, 0x2F, 0xFF, 0x3E, 0xC0, 0xBF,
+    0x77, 0xC0, 0x1F, 0x6A, 0x40, 0xB9, 0x3D, 0xA0, 0x4F, 0x7B, 0xB8, 0x40, 0xDE, 0x53, 0xD5, 0x51,
+    0x20, 0xCF, 0x09, 0xB9, 0x08, 0x9C, 0x7B, 0x11, 0x68, 0x64, 0x80, 0xEA, 0xF9, 0xAF, 0x79, 0x8A,
+    0x9A, 0xBC, 0xCD, 0x5A, 0x28, 0xF0, 0xC0, 0xF9, 0x47, 0x80, 0xF4, 0x27, 0x0E, 0xF8, 0x9D, 0xC3,
+    0xB5, 0x38, 0x15, 0xD7, 0x8F, 0x1E, 0x0A, 0x50, 0x2D, 0x9C, 0x8F, 0x64, 0x8D, 0x87, 0x93, 0x9B,
+    0x02, 0x6D, 0x49, 0xA2, 0x57, 0x85, 0xEA, 0xA1, 0x71, 0xE8, 0xD3, 0xA4, 0xEF, 0x7B, 0x4E, 0x6B,
+    0x32, 0x77, 0x99, 0x5E, 0xB9, 0x82, 0x47, 0x54, 0x97, 0xF8, 0x53, 0x68, 0x0B, 0x90, 0xBC, 0x78,
+    0xD8, 0x74, 0x62, 0x71, 0x6D, 0x1A, 0x8E, 0xB4, 0x7D, 0x46, 0xC6, 0x07, 0xB8, 0xB0, 0xD8, 0xA0,
+    0xC8, 0x47, 0xFD, 0x89, 0x76, 0x46, 0xCE, 0x97, 0x76, 0x37, 0xA1, 0x61, 0x64, 0x09, 0x0E, 0xF3,
+    0xD5, 0xE6, 0x67, 0x8B, 0x02, 0x3B, 0xDF, 0xD8, 0x9B, 0x25, 0x77, 0x0E, 0x10, 0xF5, 0x26, 0x1A,
+    0x90, 0xEE, 0x16, 0x27, 0xAB, 0x74, 0xCC, 0x96, 0x2F, 0x19, 0x67, 0x96, 0xFB, 0xDF, 0x4B, 0xE2,
+    0x2B, 0x1F, 0xAA, 0x01, 0x1E, 0xDE, 0xD8, 0x0F, 0xA9, 0x8D, 0xA5, 0x43, 0xA4, 0x50, 0x0F, 0x0A,
+    0x23, 0xCA, 0x37, 0xF0, 0x40, 0x5C, 0x6C, 0x95, 0x47, 0xBD, 0xAD, 0x1F, 0xDD, 0x47, 0x77, 0x27,
+    0x93, 0x60, 0xA6, 0xDB, 0xE2, 0x91, 0x3B, 0x77, 0xA2, 0xE3, 0x43, 0xB4, 0x60, 0x4A, 0xBE, 0x36,
+    0x9D, 0x81, 0xAD, 0xDD, 0xE9, 0x4C, 0x0C, 0xB1, 0x07, 0xE2, 0x40, 0xBF, 0x55, 0x03, 0xA6, 0x82,
+    0xB4, 0x1F, 0x81, 0xFC, 0x27, 0x03, 0x54, 0x51, 0xDC, 0xA3, 0x5B, 0x74, 0x67, 0x1C, 0x18, 0xD7,
+    0x90, 0x86, 0x64, 0x9C, 0x67, 0x5E, 0x56, 0xFF, 0x0E, 0x90, 0x73, 0xFA, 0x70, 0x0F, 0x1E, 0xD0,
+    0xFB, 0x71, 0x41, 0x59, 0xDC, 0x3B, 0x86, 0xA5, 0xCA, 0x59, 0xBB, 0x30, 0x74, 0xE5, 0xC6, 0x4C,
+    0x38, 0x2C, 0xA0, 0x3F, 0x08, 0x40, 0x58, 0xD4, 0x4B, 0x6B, 0xAF, 0x2C, 0x3F, 0x4F, 0xEF, 0xF1,
+    0xF3, 0xED, 0xA3, 0x3F, 0xF7, 0xCB, 0xCF, 0xF5, 0xE6, 0xE7, 0x0B, 0x7D, 0xE9, 0x31, 0xA8, 0x4F,
+    0x4C, 0x6E, 0xBF, 0x14, 0x9F, 0xFB, 0x94, 0x47, 0x3C, 0x66, 0xFD, 0xAC, 0x04, 0x23, 0xCE, 0xC8,
+    0x75, 0x19, 0x8D, 0xB4, 0x8C, 0xE8, 0x4F, 0x4C, 0xAE, 0xCB, 0x68, 0xE4, 0xBA, 0x7C, 0xDA, 0x23,
+    0x2D, 0xE3, 0xE6, 0x55, 0xCB, 0xC0, 0x90, 0x89, 0x63, 0x32, 0x62, 0x44, 0xDA, 0x4A, 0xC4, 0x99,
+    0x49, 0x7C, 0x35, 0x89, 0x3F, 0x49, 0x36, 0x9C, 0x26, 0xEF, 0xE3, 0x90, 0x48, 0xC3, 0xDC, 0xEA,
+    0x45, 0xEF, 0x73, 0xE8, 0x3A, 0x09, 0x07, 0xBA, 0x1E, 0xD5, 0x47, 0x09, 0xB1, 0xF6, 0x71, 0x72,
+    0x1B, 0x07, 0x12, 0xC5, 0x07, 0x2A, 0x40, 0x36, 0xCC, 0xB7, 0xBB, 0x38, 0xBC, 0x16, 0xFC, 0x60,
+    0x66, 0xE8, 0x9A, 0xF9, 0x6F, 0x1B, 0x38, 0x3E, 0xFF, 0xDD, 0x7D, 0xFC, 0xD6, 0x8C, 0x03, 0xAB,
+    0x3A, 0xAA, 0xC9, 0x1A, 0x17, 0x63, 0xCA, 0x2C, 0xE7, 0xA5, 0x7C, 0x79, 0x6E, 0x9E, 0x48, 0x03,
+    0xC5, 0x75, 0x91, 0x91, 0xE6, 0x49, 0x69, 0x42, 0x32, 0x9E, 0x24, 0x1B, 0xB2, 0x7E, 0xB1, 0x3F,
+    0xD6, 0xAE, 0xDA, 0x88, 0xDD, 0x83, 0xF2, 0x8B, 0x8D, 0xAC, 0xA9, 0x0D, 0xA8, 0x48, 0x0C, 0x38,
+    0xE5, 0x51, 0x01, 0xED, 0x30, 0x0E, 0x83, 0x0A, 0x30, 0x50, 0x38, 0x54, 0xC7, 0x15, 0xD0, 0x75,
+    0xEA, 0x61, 0x1B, 0xED, 0xE0, 0x32, 0xC7, 0xEF, 0xA6, 0xBA, 0x52, 0x0B, 0x5F, 0xA7, 0xAA, 0xC9,
+    0xFB, 0x54, 0xC0, 0x74, 0x79, 0x00, 0xA9, 0x8B, 0x8E, 0x74, 0xE4, 0xB7, 0x20, 0xB9, 0xB8, 0x48,
+    0xC0, 0x4F, 0x48, 0xA7, 0x42, 0x2E, 0xD2, 0x6B, 0x6F, 0x44, 0x7A, 0xE3, 0xFE, 0x1D, 0xDA, 0x0B,
+    0xA0, 0xDF, 0x08, 0x40, 0xF9, 0x9D, 0x0E, 0xD8, 0x2F, 0x6B, 0x48, 0x87, 0x7D, 0x40, 0xBF, 0x31,
+    0x00, 0x4D, 0xD6, 0x41, 0xDE, 0x17, 0x16, 0x1A, 0xFB, 0x0C, 0xE4, 0x7D, 0xD2, 0x43, 0x63, 0xB3,
+    0x96, 0xCC, 0xA3, 0x2D, 0x06, 0x4E, 0x93, 0x0C, 0xE0, 0xC9, 0x5A, 0x94, 0xA3, 0x80, 0x2D, 0x36,
+    0x2B, 0xC0, 0x8C, 0x42, 0x2C, 0x5B, 0x60, 0x1C, 0x42, 0x22, 0x36, 0x1B, 0x51, 0x23, 0x85, 0x47,
+    0x7B, 0x8C, 0x3B, 0xF4, 0x74, 0xBA, 0x89, 0xA0, 0xF3, 0xDF, 0xAD, 0x56, 0x5F, 0x0D, 0x8B, 0x31,
+    0x4E, 0xB5, 0x4C, 0x87, 0xB2, 0x9E, 0xD1, 0xC8, 0xC6, 0xAA, 0x4A, 0xF9, 0x19, 0x11, 0x1E, 0x14,
+    0xEF, 0x2F, 0xB2, 0x77, 0x53, 0xCF, 0xA3, 0x4B, 0xB7, 0xB3, 0x20, 0xFB, 0xE1, 0xF5, 0xCB, 0x96,
+    0x4A, 0x64, 0xE4, 0xC2, 0x25, 0x91, 0xFA, 0xE9, 0x4C, 0xA4, 0x7B, 0x3A, 0x13, 0xF1, 0x4F, 0x67,
+    0x22, 0xFD, 0xD3, 0x99, 0xC8, 0xF0, 0x74, 0x26, 0x12, 0x3E, 0x35, 0x19, 0x36, 0x0F, 0xFB, 0xA7,
+    0x33, 0x91, 0xF6, 0xE9, 0x4C, 0xC4, 0x3E, 0x9D, 0xC9, 0xC0, 0xD3, 0x59, 0xCD, 0xAF, 0x28, 0xD9,
+    0x84, 0x91, 0xE8, 0xAA, 0x68, 0x6B, 0xF5, 0xE1, 0x05, 0x23, 0x52, 0xFF, 0xAD, 0xC8, 0x94, 0xBE,
+    0x27, 0x32, 0xE4, 0x8D, 0x48, 0x77, 0x52, 0x44, 0xEA, 0xBF, 0x13, 0x99, 0xD2, 0x9B, 0x47, 0x8A,
+    0xFE, 0xB3, 0xC8, 0x94, 0xBE, 0x2B, 0x32, 0xE4, 0xCF, 0x89, 0x74, 0x27, 0x4B, 0x91, 0xFA, 0xB2,
+    0x11, 0x91, 0xAE, 0x14, 0x91, 0x7A, 0x6B, 0xBD, 0x7E, 0x79, 0x01, 0x76, 0x9B, 0x8B, 0x48, 0x7F,
+    0xF2, 0x29, 0x11, 0x7F, 0x39, 0x17, 0xF9, 0x79, 0x57, 0x8A, 0xBC, 0x5E, 0x37, 0x22, 0xFF, 0x29,
+    0x15, 0x99, 0x2E, 0xE7, 0x22, 0x53, 0x57, 0x8A, 0xDC, 0xA9, 0x1B, 0x91, 0xFF, 0x27, 0x15, 0x91,
+    0x4D, 0xD1, 0x7B, 0x75, 0x23, 0xF2, 0x6F, 0x52, 0x91, 0x70, 0x39, 0x17, 0xF9, 0x89, 0x88, 0x48,
+    0x2E, 0x22, 0xDD, 0x43, 0xEB, 0xF5, 0x5F, 0x43, 0xF2, 0xD2, 0xD2, 0x09, 0xC5, 0x26, 0x84, 0xEB,
+    0x10, 0x71, 0xA2, 0x7A, 0x5B, 0xDB, 0x0B, 0x5A, 0x2E, 0x34, 0xA1, 0x12, 0x11, 0x7F, 0xFC, 0xD2,
+    0xED, 0x55, 0x44, 0xDE, 0xEA, 0xA3, 0x0E, 0xCA, 0x27, 0xDB, 0x18, 0xDF, 0x53, 0x77, 0xC6, 0x21,
+    0x34, 0x96, 0xA7, 0x17, 0xBE, 0xEC, 0x7E, 0x24, 0x1B, 0x0B, 0x6F, 0xDC, 0x83, 0x1F, 0x9F, 0xBA,
+    0xC7, 0xAD, 0xA4, 0x41, 0xF5, 0xBA, 0x2B, 0x6B, 0xC3, 0x5E, 0xD2, 0xAB, 0xEE, 0xCB, 0x2E, 0xDB,
+    0xFF, 0xF0, 0x47, 0x52, 0x03, 0xBF, 0x75, 0x0A, 0x48, 0x3A, 0x0F, 0x9C, 0xCA, 0x1D, 0x68, 0x5B,
+    0x5A, 0xB2, 0x8E, 0xC6, 0x66, 0x03, 0xD1, 0xE4, 0x2F, 0x69, 0x6E, 0xF1, 0x6B, 0x02, 0xED, 0xBC,
+    0xDE, 0x2D, 0xAB, 0xF4, 0xC1, 0xEB, 0xB7, 0xE7, 0xD7, 0xDF, 0x52, 0x6D, 0xF1, 0xAC, 0xBC, 0x75,
+    0x49, 0x0A, 0x11, 0x09, 0x5B, 0xDF, 0x98, 0x9E, 0xB7, 0xD1, 0x80, 0x6F, 0x1C, 0x20, 0xBF, 0xDE,
+    0xC7, 0x05, 0x56, 0x0D, 0xDA, 0x63, 0x5C, 0xD9, 0xF2, 0x87, 0x9C, 0x3A, 0xEC, 0x70, 0xF5, 0x4C,
+    0x53, 0xE7, 0xAF, 0x0F, 0x84, 0xCA, 0x16, 0x8F, 0x5A, 0xE5, 0xE1, 0x42, 0x5C, 0xDB, 0x02, 0x14,
+    0x16, 0xE5, 0x61, 0x3B, 0x0A, 0x9B, 0x3F, 0x5F, 0x41, 0xAD, 0xAF, 0xFA, 0x74, 0xDA, 0xA6, 0x7C,
+    0xAF, 0x4D, 0x46, 0x48, 0xA0, 0x9C, 0x2E, 0x02, 0x99, 0x6D, 0x62, 0x90, 0xB7, 0xB6, 0x59, 0x8B,
+    0xBC, 0x8D, 0xF2, 0x17, 0x60, 0x57, 0x6E, 0x5F, 0xF2, 0x27, 0x81, 0x5D, 0x91, 0x5E, 0x03, 0x3C,
+    0x24, 0x17, 0x37, 0xE4, 0x92, 0x74, 0x50, 0x4E, 0xD2, 0xA1, 0x3B, 0x4A, 0xA7, 0x3A, 0x30, 0x5C,
+    0x06, 0x2E, 0xFF, 0x21, 0xA0, 0xAE, 0x3A, 0x40, 0xDF, 0x17, 0x49, 0xFC, 0xB8, 0xF8, 0xEF, 0x41,
+    0xCA, 0x5E, 0x4A, 0xEE, 0xF6, 0xB4, 0x53, 0x7E, 0xCF, 0x58, 0xC2, 0xDE, 0x08, 0x46, 0x7A, 0xD0,
+    0xD2, 0xB2, 0xBE, 0x24, 0x37, 0x5E, 0x12, 0x11, 0x09, 0x4D, 0xB4, 0xB2, 0x96, 0x76, 0xBE, 0x3B,
+    0xEE, 0x8D, 0xA8, 0x7E, 0xCF, 0x90, 0xB7, 0x7B, 0xDA, 0x29, 0xBB, 0xA7, 0x0E, 0xBD, 0x74, 0x39,
+    0xEE, 0x9B, 0x41, 0xAF, 0xFB, 0x39, 0x7A, 0x40, 0xF5, 0xE9, 0xA3, 0x67, 0x6B, 0xB6, 0xCB, 0x50,
+    0xE3, 0x6C, 0xCD, 0x58, 0xD4, 0x9F, 0x63, 0xCC, 0x6D, 0x03, 0xA6, 0x8D, 0x5F, 0x49, 0x43, 0x5C,
+    0xCF, 0xCA, 0x47, 0x07, 0xED, 0xAE, 0x50, 0xA9, 0xBE, 0xAC, 0x03, 0x63, 0xD6, 0x99, 0xB4, 0x4F,
+    0x06, 0xED, 0xAE, 0xA8, 0x4E, 0xF9, 0xC2, 0x0E, 0xB9, 0xCB, 0x5A, 0x13, 0xD9, 0xBF, 0xF3, 0xAA,
+    0x2B, 0x29, 0x18, 0x72, 0x77, 0x9A, 0xED, 0xC4, 0x6B, 0x7B, 0x99, 0xF3, 0xAA, 0x3D, 0x89, 0x5F,
+    0x5A, 0xB0, 0xB8, 0x8F, 0x46, 0x1D, 0xEE, 0xC1, 0xA9, 0xFA, 0x32, 0x13, 0x24, 0xD2, 0xF7, 0x5F,
+    0x89, 0xB4, 0xE5, 0x14, 0x2D, 0x5A, 0x64, 0x36, 0x6C, 0x29, 0xEC, 0x5D, 0xF0, 0xFB, 0xFC, 0xC7,
+    0x85, 0x8D, 0xDE, 0xFE, 0x50, 0x05, 0xE7, 0x5A, 0xFF, 0xFE, 0xC6, 0x47, 0xFE, 0x81, 0x68, 0xF4,
+    0x62, 0x9E, 0x1D, 0xA3, 0x8E, 0x5A, 0xA2, 0x9F, 0x71, 0x84, 0xF2, 0xFE, 0x97, 0x9B, 0xF1, 0x27,
+    0x8F, 0xC4, 0x88, 0x88, 0xDA, 0xEF, 0x8D, 0xB7, 0xE7, 0x1F, 0x7D, 0xB9, 0x77, 0x46, 0x40, 0x5C,
+    0x8E, 0x4A, 0xF4, 0x2A, 0xD6, 0xB6, 0x8C, 0x41, 0xD0, 0xB3, 0xE1, 0x7E, 0x00, 0xBE, 0x0E, 0xC9,
+    0x60, 0xAE, 0x8E, 0xA5, 0xDB, 0xF9, 0x34, 0x8B, 0xF5, 0xAB, 0xC1, 0xBC, 0x11, 0x36, 0x3C, 0x55,
+    0x72, 0x60, 0x2A, 0x14, 0xBD, 0xAB, 0x63, 0x37, 0xFC, 0xF9, 0xE7, 0xC6, 0x6E, 0x03, 0x10, 0x8C,
+    0x83, 0xF2, 0xFA, 0x08, 0x6A, 0x2A, 0x1D, 0x94, 0xED, 0x9F, 0xC7, 0xFA, 0x7C, 0xBE, 0x23, 0x0D,
+    0x77, 0xD5, 0x21, 0xFA, 0x12, 0xC6, 0x56, 0xFC, 0xC5, 0x91, 0x10, 0x4C, 0x57, 0xA2, 0xAE, 0xF4,
+    0x0A, 0xF7, 0x91, 0x8C, 0x5C, 0xA1, 0x22, 0x9D, 0xB8, 0x82, 0xD8, 0xF9, 0x44, 0x2C, 0x9C, 0x1F,
+    0xB9, 0xEB, 0x77, 0x47, 0x4E, 0xD5, 0xEC, 0xDC, 0x70, 0xE4, 0xF4, 0x69, 0x3F, 0x58, 0x4E, 0x81,
+    0x2B, 0xEC, 0xCF, 0x9F, 0x5D, 0x4E, 0xC9, 0xC8, 0x15, 0x04, 0xBE, 0xCE, 0x95, 0x48, 0xEC, 0x1C,
+    0xFD, 0xDD, 0x33, 0x91, 0x8B, 0x33, 0xAF, 0x8D, 0xE6, 0xFB, 0x07, 0x6C, 0x9B, 0xB9, 0x3A, 0x56,
+    0xD7, 0xC3, 0x43, 0x0B, 0xBD, 0xB7, 0x91, 0x06, 0x1F, 0x7E, 0xF2, 0xFE, 0x4D, 0x21, 0x94, 0xCF,
+    0x86, 0xEA, 0x7A, 0x28, 0x2C, 0xF0, 0x82, 0x79, 0x6D, 0x34, 0xD7, 0xC3, 0x16, 0x95, 0xBC, 0x71,
+    0xE9, 0xA5, 0x03, 0x19, 0xE7, 0xF1, 0x0F, 0x9F, 0xF8, 0x65, 0x65, 0xB7, 0xFF, 0xF1, 0x2F, 0x79,
+    0x93, 0xDF, 0xFE, 0x4B, 0xDE, 0xE4, 0xB7, 0xFF, 0xED, 0x2F, 0x27, 0x6D, 0x35, 0xF2, 0xAA, 0x0C,
+    0x5A, 0x68, 0x3A, 0x15, 0x28, 0xEB, 0x2F, 0xFF, 0xA2, 0x45, 0x76, 0xAB, 0x49, 0x7A, 0x8C, 0xCB,
+    0x46, 0xC4, 0x97, 0xF2, 0xAC, 0x84, 0x5F, 0xE2, 0x6D, 0x3B, 0x94, 0x75, 0xFE, 0x9F, 0xD2, 0xF6,
+    0xE9, 0x53, 0xCA, 0x7D, 0xE8, 0x55, 0xF8, 0xA5, 0xEA, 0x56, 0x75, 0xE9, 0x25, 0x7E, 0x65, 0xBD,
+    0x40, 0x53, 0x27, 0x32, 0x32, 0xED, 0xBA, 0x2B, 0xC9, 0x60, 0x30, 0xBA, 0xCE, 0xAF, 0x76, 0xC9,
+    0x87, 0x3D, 0xCF, 0x3C, 0x43, 0xF1, 0xA4, 0xCD, 0xAE, 0x77, 0x49, 0x3F, 0xB0, 0x67, 0x30, 0x59,
+    0x57, 0xD6, 0xD2, 0x38, 0x2D, 0x8E, 0x73, 0x96, 0xFB, 0x4E, 0x9F, 0x86, 0x53, 0x87, 0x8E, 0xC8,
+    0x6A, 0x4E, 0x20, 0x35, 0x4D, 0xC7, 0xE9, 0x81, 0xD3, 0x17, 0x28, 0x8B, 0xBA, 0xC8, 0x3A, 0xFD,
+    0xE8, 0x90, 0xD7, 0x17, 0xB2, 0x77, 0x76, 0xFF, 0x26, 0xDA, 0x5D, 0xD6, 0x5C, 0x80, 0xA2, 0x26,
+    0xEB, 0x60, 0x87, 0x87, 0xD7, 0x2F, 0x88, 0x5C, 0x7D, 0x67, 0xA5, 0xE1, 0x14, 0x89, 0x27, 0xBB,
+    0x71, 0xB1, 0x90, 0xFE, 0xBF, 0xD9, 0xF5, 0x64, 0x1D, 0xDA, 0x51, 0xC2, 0x48, 0x76, 0xF3, 0xBF,
+    0x34, 0x46, 0xFC, 0x43, 0x2F, 0xC3, 0x89, 0x40, 0x25, 0x54, 0x17, 0xAD, 0x81, 0x02, 0x74, 0x8D,
+    0x7A, 0x63, 0xE2, 0x8E, 0x78, 0xD3, 0x56, 0xDA, 0x65, 0xD7, 0x5B, 0xFA, 0x9E, 0xD3, 0xDB, 0x14,
+    0x4F, 0xB4, 0xDA, 0x4D, 0xBB, 0x6D, 0x2E, 0x1D, 0xE7, 0x2C, 0xEB, 0xF5, 0x4B, 0x22, 0x61, 0xBD,
+    0x0E, 0x30, 0x90, 0x7A, 0x54, 0x47, 0xE6, 0xD0, 0x35, 0x85, 0xC5, 0xC0, 0x33, 0x10, 0xA0, 0x9F,
+    0xEF, 0xE4, 0x8E, 0x2D, 0x0B, 0xCD, 0xC5, 0x44, 0x26, 0xC6, 0xBC, 0xDD, 0x63, 0x28, 0xD9, 0xCE,
+    0xBA, 0xC2, 0x4E, 0x65, 0xAD, 0xA5, 0x56, 0xE2, 0x55, 0xDF, 0x3C, 0xE6, 0x95, 0x1F, 0xD8, 0xDB,
+    0xA6, 0xD0, 0x4E, 0x7F, 0x7F, 0xDA, 0x6D, 0xCB, 0xF8, 0x29, 0xA2, 0x65, 0x4E, 0x23, 0x76, 0x3F,
+    0xF3, 0xDB, 0x6C, 0x17, 0x36, 0x7B, 0xCD, 0x25, 0xEF, 0xF7, 0x3C, 0x63, 0x30, 0x7F, 0x7A, 0xAB,
+    0x69, 0x9B, 0xD1, 0xA7, 0x2F, 0x9E, 0x87, 0x12, 0xB4, 0x45, 0xBB, 0x7F, 0x7A, 0xC9, 0x69, 0x71,
+    0xE9, 0x1A, 0xD8, 0x21, 0x6D, 0xC9, 0x2D, 0x8F, 0x70, 0xFC, 0x6F, 0xFF, 0x85, 0xC8, 0xDF, 0x5F,
+    0xBA, 0xC1, 0x23, 0xF0, 0xBD, 0xB9, 0xF4, 0xF8, 0xEA, 0x5F, 0x88, 0xFC, 0xFD, 0x7A, 0x7D, 0x90,
+    0x99, 0xA9, 0xEF, 0x1F, 0x89, 0x58, 0xC8, 0xDD, 0x79, 0xD5, 0x15, 0x0C, 0xAA, 0x2D, 0xD8, 0x4B,
+    0xBB, 0xBC, 0x3E, 0xC9, 0xE5, 0xD4, 0x67, 0x4E, 0xDB, 0x6D, 0xCE, 0xD3, 0x27, 0x3E, 0xF5, 0x40,
+    0xE2, 0x53, 0xAF, 0xDA, 0xDC, 0x69, 0xBB, 0xCD, 0x5E, 0xE2, 0x33, 0xA7, 0x39, 0x95, 0xF8, 0xCC,
+    0x95, 0xF1, 0x87, 0x7D, 0xEE, 0xCE, 0x47, 0x24, 0xF1, 0x63, 0x69, 0xEF, 0xBC, 0xD7, 0x8F, 0xEC,
+    0x0D, 0x9C, 0xEA, 0x39, 0xE5, 0xEF, 0xF5, 0x1F, 0xBE, 0xF4, 0x10, 0xE2, 0xE1, 0x44, 0x72, 0x31,
+    0x97, 0x4E, 0x97, 0x0F, 0x94, 0xDC, 0xEB, 0xDF, 0xF1, 0x44, 0x2E, 0x16, 0xD2, 0x97, 0x7F, 0x15,
+    0xFE, 0x09, 0xCF, 0xC0, 0x36, 0x3C, 0x03, 0x7B, 0x24, 0x03, 0xCA, 0xA3, 0x1D, 0x06, 0x02, 0xCA,
+    0xA3, 0x6B, 0x8C, 0x8C, 0x46, 0xC6, 0xE3, 0xAB, 0x33, 0xA9, 0x5C, 0xCC, 0x65, 0x54, 0x7D, 0xE1,
+    0x1E, 0x48, 0x7A, 0xD8, 0x86, 0xC2, 0x52, 0x38, 0x2D, 0xB5, 0x92, 0x0E, 0xAA, 0x48, 0xFF, 0xED,
+    0x81, 0xB9, 0x8F, 0xE2, 0xDB, 0x3F, 0xDB, 0xFD, 0xBE, 0x48, 0x7B, 0x6C, 0x6D, 0xFF, 0xFF, 0xD1,
+    0xFB, 0xFF, 0xAD, 0xD1, 0x9B, 0xAC, 0xAD, 0x91, 0xFA, 0x62, 0x61, 0x39, 0x09, 0x4F, 0x6F, 0xBD,
+    0xF2, 0x63, 0x91, 0xEF, 0xDA, 0x3F, 0x1C, 0xF8, 0xBB, 0x56, 0xBD, 0xE7, 0xCA, 0xE7, 0xE4, 0xFF,
+    0xCA, 0xDF, 0xFE, 0x0A, 0xE7, 0xC8, 0xA4, 0x2B, 0xEC, 0x70, 0x8A, 0x53, 0xE7, 0x39, 0xBD, 0xBF,
+    0xBE, 0xD2, 0xC8, 0x78, 0x19, 0xCE, 0xC3, 0x69, 0x28, 0xED, 0x7D, 0xB9, 0x04, 0x2E, 0xBD, 0xC0,
+    0x39, 0x9B, 0xCA, 0x98, 0xF4, 0xB9, 0xEB, 0xD9, 0x3B, 0x8F, 0x3E, 0x89, 0xFA, 0x51, 0xCD, 0x2F,
+    0x3A, 0x4E, 0x9F, 0x47, 0x6B, 0xB2, 0x57, 0x7D, 0xD6, 0x96, 0xD2, 0xB2, 0x5F, 0xF3, 0x20, 0x5B,
+    0xB9, 0xD3, 0x76, 0xC8, 0x6B, 0xFD, 0x84, 0x4B, 0x3E, 0x72, 0x94, 0x2D, 0xCA, 0x93, 0x4E, 0x24,
+    0x1F, 0xB4, 0xF8, 0xF3, 0xF4, 0xB9, 0xBB, 0xCC, 0xF0, 0xCF, 0xB8, 0x9F, 0x63, 0x2F, 0x63, 0xC4,
+    0x7D, 0x25, 0x8D, 0x83, 0xF1, 0x14, 0x9C, 0x6E, 0x64, 0x14, 0x19, 0x2F, 0x73, 0xEA, 0x3C, 0xE7,
+    0xB7, 0x93, 0x5E, 0x4B, 0x9B, 0xEC, 0xF3, 0xE7, 0xE0, 0x0F, 0xFF, 0x3F, 0x67, 0x3F, 0x12, 0x3F,
+    0x25, 0x43, 0xE0, 0x7C, 0xFF, 0x09, 0x93, 0xF2, 0x05, 0xFE, 0xD9, 0x9F, 0xA3, 0x1C, 0x1A, 0x4E,
+    0x81, 0x47, 0xB9, 0xE4, 0x49, 0x4E, 0x9F, 0x52, 0xAD, 0x3F, 0xAD, 0xAE, 0xB6, 0xFA, 0x19, 0x4C,
+    0x20, 0x0C, 0xCA, 0xF5, 0x3A, 0xE9, 0x4F, 0x25, 0xDE, 0xA7, 0x3F, 0xAF, 0xD3, 0x8B, 0xFF, 0xFA,
+    0xDA, 0xA9, 0x0F, 0x96, 0xFF, 0x3F, 0xAF, 0x77, 0xCE, 0x71, 0xEE, 0xF1, 0xB7, 0xE4, 0x39, 0xB9,
+    0xD6, 0x95, 0xBE, 0xA8, 0x30, 0x9C, 0xEC, 0xB9, 0x4C, 0xE5, 0xD2, 0x2E, 0x11, 0x72, 0x9B, 0x05,
+    0x1E, 0xA1, 0xF0, 0x7C, 0x8F, 0xCA, 0xA5, 0xED, 0xA1, 0xA2, 0x17, 0xF8, 0x3A, 0x5F, 0xD9, 0x39,
+    0x67, 0x3F, 0xF8, 0x1C, 0x95, 0xDC, 0x39, 0x67, 0x3F, 0x90, 0x6E, 0x79, 0xEC, 0xB4, 0xE7, 0x64,
+    0xFC, 0xDF, 0x73, 0x3A, 0x70, 0x6A, 0x62, 0xB8, 0x23, 0xDE, 0xEF, 0x5B, 0x7F, 0x14, 0x02, 0xC7,
+    0x5E, 0x56, 0x12, 0x2E, 0x27, 0x4F, 0x5A, 0xF6, 0x50, 0xB7, 0xC8, 0x26, 0xD2, 0x80, 0x6A, 0x39,
+    0xB9, 0xA3, 0x7E, 0x24, 0xC3, 0x89, 0x5B, 0x00, 0x2D, 0xFF, 0x13, 0x17, 0xCE, 0x34, 0xA2, 0x5A,
+    0x7A, 0x4E, 0xA3, 0xED, 0x9C, 0xC9, 0x6D, 0xEA, 0x31, 0xFD, 0x22, 0xE1, 0xDE, 0x9D, 0x2C, 0xA9,
+    0x88, 0x23, 0x1F, 0xBF, 0x56, 0x47, 0x8B, 0x14, 0xB3, 0x11, 0x8F, 0x56, 0x1B, 0x92, 0x7C, 0x9F,
+    0x87, 0xD7, 0x2F, 0xED, 0x63, 0x24, 0xEC, 0x63, 0x24, 0x34, 0x18, 0x4B, 0x15, 0x03, 0xE5, 0x1A,
+    0x1B, 0xC3, 0xBE, 0xEA, 0xDE, 0x58, 0x32, 0x11, 0x19, 0x62, 0x58, 0xA4, 0xAD, 0x66, 0xFD, 0xE2,
+    0xA7, 0x05, 0x10, 0x59, 0xBF, 0x04, 0x46, 0xC2, 0x9C, 0x6C, 0xD9, 0x1D, 0xD0, 0x8F, 0x79, 0xD0,
+    0xAA, 0x83, 0xE2, 0xA9, 0x96, 0x44, 0xA4, 0x8F, 0x5E, 0x05, 0xCD, 0x74, 0x36, 0x24, 0xB2, 0xA7,
+    0xFF, 0x57, 0x15, 0xCE, 0x6B, 0x9B, 0xFB, 0x3D, 0x8D, 0x6E, 0x87, 0x82, 0xD2, 0xF5, 0x25, 0xA6,
+    0xF6, 0xDB, 0x98, 0x47, 0xFD, 0x69, 0xCC, 0x63, 0xDD, 0x29, 0x8C, 0xEA, 0xCE, 0x63, 0x54, 0xBB,
+    0x87, 0x79, 0xC2, 0x0D, 0x98, 0x27, 0x5C, 0x4F, 0xF9, 0x9D, 0xDA, 0x53, 0x5C, 0xFB, 0xA6, 0x47,
+    0xDF, 0x7C, 0xCC, 0x93, 0x8B, 0xEA, 0x50, 0xA2, 0x5A, 0x12, 0x79, 0xD3, 0xFD, 0x05, 0xD5, 0xC6,
+    0xBE, 0xEC, 0xFC, 0xEE, 0x64, 0x39, 0xAF, 0x2D, 0x5C, 0xD6, 0x40, 0x5F, 0x1C, 0x8D, 0x6D, 0x20,
+    0xB7, 0x48, 0x45, 0x04, 0x33, 0x5D, 0x1A, 0xD4, 0x44, 0xEA, 0xCA, 0x23, 0x7E, 0xD7, 0xC6, 0xCE,
+    0xEC, 0x7E, 0x1E, 0x65, 0x6B, 0x5B, 0xE9, 0x8B, 0x13, 0x7B, 0xCD, 0x4F, 0xFB, 0xF4, 0x8E, 0x3C,
+    0xD7, 0xE6, 0xD3, 0x7F, 0x6B, 0x6C, 0xD9, 0x31, 0xD2, 0x90, 0x0E, 0xE9, 0x40, 0xEE, 0xF3, 0x96,
+    0xC2, 0x95, 0x16, 0x63, 0xAF, 0x80, 0xA4, 0x3D, 0xC9, 0x98, 0xB7, 0xA8, 0x50, 0x5A, 0xB2, 0xF1,
+    0x0A, 0x36, 0x97, 0xDB, 0x0D, 0x99, 0x48, 0x20, 0x15, 0xE9, 0xA2, 0x53, 0x85, 0x88, 0xF4, 0x4A,
+    0x44, 0x5A, 0x2D, 0x22, 0xD6, 0xD8, 0x59, 0xB8, 0x1B, 0x25, 0xFE, 0xEE, 0xB0, 0x16, 0xE0, 0xAE,
+    0xA2, 0x71, 0xB5, 0xDA, 0x51, 0x22, 0x52, 0x6B, 0x91, 0x09, 0xB3, 0x5E, 0xBF, 0x78, 0xF4, 0xA9,
+    0xAD, 0x6A, 0xB5, 0x43, 0x25, 0xE2, 0x12, 0x11, 0x99, 0x65, 0x7C, 0xF7, 0x78, 0xD7, 0xE2, 0x0C,
+    0x35, 0x59, 0x72, 0x11, 0x4F, 0x39, 0x35, 0x1D, 0xA6, 0x4E, 0x2E, 0x46, 0x4E, 0x6F, 0x63, 0xB7,
+    0x7B, 0x57, 0xB2, 0x9A, 0x56, 0x67, 0x62, 0xC4, 0xFF, 0x46, 0x24, 0xDC, 0x7D, 0xF7, 0xE0, 0xC6,
+    0x6A, 0x5A, 0x9D, 0x39, 0x14, 0x7F, 0x38, 0x0D, 0x1C, 0xD9, 0xA7, 0x48, 0x44, 0x82, 0x6C, 0x12,
+    0x80, 0x6C, 0xAE, 0xD4, 0x70, 0x98, 0x6B, 0x9B, 0x55, 0xE1, 0x2B, 0x9E, 0x59, 0xA1, 0xBF, 0x2F,
+    0x93, 0x16, 0xB1, 0xA1, 0x91, 0x41, 0x64, 0xD2, 0x37, 0x9F, 0x6F, 0x24, 0x06, 0xA5, 0x14, 0x4F,
+    0xF5, 0x5C, 0x4F, 0x16, 0x62, 0x68, 0x4A, 0x53, 0x53, 0x5C, 0xF3, 0x31, 0x3C, 0xD7, 0x14, 0x2D,
+    0x48, 0xAF, 0x75, 0x64, 0x3E, 0x46, 0x9E, 0x94, 0x18, 0x85, 0xB2, 0x88, 0x97, 0x6A, 0xBE, 0xAC,
+    0xE2, 0xA5, 0x8E, 0x97, 0xC9, 0x47, 0xF1, 0xB2, 0x34, 0xA0, 0xAF, 0xB5, 0xEA, 0x7A, 0xBC, 0xDC,
+    0x8B, 0x97, 0xFA, 0x71, 0x0F, 0x61, 0x4C, 0xBD, 0x01, 0xED, 0x16, 0xAD, 0x7B, 0x7E, 0x57, 0xFD,
+    0x8F, 0xF2, 0x69, 0x23, 0xA9, 0xA7, 0xEC, 0x30, 0xA4, 0x82, 0xF2, 0x94, 0x3D, 0x86, 0x54, 0x9C,
+    0xF2, 0x94, 0x7B, 0x18, 0xD2, 0x8F, 0x3A, 0xE5, 0x29, 0x0D, 0x86, 0xF4, 0xE7, 0xBD, 0xF2, 0xC7,
+    0x9A, 0x4B, 0x37, 0x9A, 0x97, 0x1A, 0x11, 0x91, 0xD7, 0x45, 0x44, 0x42, 0xEA, 0x8D, 0xF2, 0x94,
+    0xCA, 0x1B, 0x52, 0x5F, 0x3C, 0xEB, 0xF3, 0x8D, 0x20, 0x45, 0xBE, 0x5F, 0x3D, 0xDF, 0x54, 0x67,
+    0x52, 0xAF, 0x3E, 0xF0, 0x94, 0x94, 0xBB, 0xA4, 0x9E, 0xC9, 0x53, 0xA2, 0x85, 0xD4, 0x53, 0x79,
+    0x4A, 0x94, 0x90, 0x7A, 0x4A, 0x4F, 0x49, 0x22, 0xA4, 0x51, 0xC2, 0x3C, 0x5D, 0x8C, 0x16, 0x4F,
+    0x73, 0xD8, 0xCD, 0x16, 0x94, 0xCF, 0x04, 0x30, 0x64, 0x03, 0x28, 0x4F, 0xE9, 0x96, 0xB0, 0x1D,
+    0xCA, 0xA3, 0xDB, 0x07, 0x31, 0x30, 0x2A, 0xA7, 0x3C, 0xDA, 0x9D, 0xC7, 0x90, 0x84, 0xDC, 0x29,
+    0x8F, 0xF9, 0xD6, 0x74, 0xC6, 0xA0, 0x7F, 0x21, 0x72, 0xFD, 0xC3, 0x6F, 0x4C, 0x46, 0x46, 0x23,
+    0x52, 0x6B, 0xA7, 0x44, 0x2E, 0x12, 0x30, 0x2F, 0x5B, 0xB4, 0x9B, 0xCD, 0x85, 0xA3, 0xF5, 0xF0,
+    0x67, 0x5C, 0x8C, 0x18, 0x20, 0xFF, 0xF0, 0x5F, 0xC6, 0x9A, 0x19, 0x36, 0x7B, 0x31, 0x25, 0x3B,
+    0xCD, 0x6D, 0x1B, 0x6B, 0xDD, 0x45, 0x1B, 0xAE, 0x38, 0x61, 0x77, 0x63, 0x24, 0xAC, 0xD2, 0x31,
+    0xC7, 0x28, 0x43, 0xB7, 0x4C, 0x6C, 0xED, 0x18, 0x9B, 0x0E, 0x4A, 0x86, 0x91, 0xBC, 0x33, 0xF2,
+    0x51, 0x8F, 0x79, 0x76, 0x3C, 0x71, 0xAD, 0x65, 0xD4, 0x0E, 0x63, 0x73, 0x5F, 0xC1, 0x48, 0xF3,
+    0x68, 0x40, 0x89, 0x0C, 0x6A, 0x40, 0x8B, 0xD4, 0x7A, 0xC0, 0x48, 0x40, 0x8F, 0x8C, 0xAA, 0x47,
+    0x8B, 0xEA, 0x73, 0x4F, 0x2E, 0xBA, 0xD5, 0x8E, 0x54, 0x8C, 0x35, 0x35, 0xE9, 0x38, 0x52, 0x41,
+    0x7A, 0xA7, 0x67, 0x82, 0xEC, 0x66, 0x9B, 0x06, 0x28, 0x1B, 0xAB, 0xFA, 0x1D, 0xC6, 0x91, 0xFC,
+    0xE7, 0xB7, 0xCE, 0x7E, 0xD0, 0xA3, 0x7F, 0x24, 0xF2, 0x64, 0x8B, 0xF9, 0xCE, 0x1C, 0x09, 0xE8,
+    0x0C, 0xDB, 0xA8, 0x9E, 0xE2, 0x49, 0x97, 0x4C, 0xE4, 0x57, 0x3D, 0x8D, 0x53, 0x3E, 0x50, 0x7A,
+    0x42, 0x69, 0x75, 0x60, 0x3B, 0xEB, 0xD4, 0x5B, 0xB6, 0xA8, 0x87, 0xE4, 0x83, 0x2E, 0x6B, 0x0D,
+    0xE7, 0x87, 0xD4, 0x6B, 0x57, 0x96, 0x84, 0xD4, 0xEB, 0x6F, 0x3B, 0xC3, 0x15, 0xF5, 0xE3, 0x5E,
+    0xBB, 0xC2, 0xF6, 0xA7, 0x55, 0x17, 0xF9, 0xEE, 0x18, 0x90, 0xF3, 0x17, 0xCD, 0xA5, 0x1B, 0x53,
+    0xF3, 0x62, 0x7E, 0xB5, 0x2B, 0xB4, 0x4B, 0xFD, 0xA0, 0xAE, 0x77, 0x3C, 0x73, 0x9A, 0x7E, 0x40,
+    0x9F, 0x65, 0xFB, 0x34, 0xEA, 0x5D, 0x97, 0x7F, 0xD7, 0x72, 0xDB, 0xA7, 0x1F, 0x39, 0xCA, 0xCB,
+    0x5C, 0xF0, 0x64, 0x13, 0x3A, 0x90, 0x88, 0x55, 0x53, 0xD4, 0x3F, 0x58, 0xB4, 0xA7, 0x6C, 0x89,
+    0x5E, 0xDF, 0x8D, 0xDC, 0x82, 0x6D, 0x11, 0xE9, 0x30, 0x22, 0x12, 0x30, 0x81, 0x74, 0xC2, 0x04,
+    0xA8, 0x30, 0x01, 0x8C, 0x35, 0x01, 0x8A, 0xDA, 0x04, 0xE5, 0xB5, 0xFB, 0x55, 0xA6, 0x70, 0x21,
+    0x28, 0x0F, 0xFB, 0x41, 0x79, 0x92, 0x10, 0x94, 0x27, 0x1B, 0x82, 0xBA, 0xBD, 0x6E, 0x7C, 0x50,
+    0x22, 0xE2, 0x82, 0x92, 0x18, 0xDA, 0x34, 0xBD, 0x78, 0x34, 0x68, 0x6E, 0x39, 0x3B, 0x50, 0x46,
+    0x37, 0xC0, 0xE3, 0xAB, 0x66, 0x27, 0x8A, 0x0C, 0x93, 0x9D, 0xCC, 0x53, 0xC8, 0x0F, 0x02, 0x46,
+    0xA6, 0x0A, 0x73, 0x6B, 0xF7, 0xA6, 0x2B, 0x3B, 0x2A, 0xAF, 0x3D, 0x79, 0xC8, 0x7A, 0x90, 0x34,
+    0x10, 0x9D, 0x02, 0x73, 0x6F, 0x6A, 0x92, 0xA0, 0xBB, 0x39, 0x66, 0x7D, 0xE1, 0x26, 0xC8, 0xBC,
+    0xA9, 0x67, 0x87, 0xB3, 0x26, 0xEE, 0xFA, 0x64, 0x6A, 0x0A, 0x9F, 0x0F, 0x14, 0x01, 0x79, 0xA7,
+    0x69, 0xD0, 0x22, 0x4F, 0x3A, 0x2A, 0x79, 0xDC, 0x1F, 0xF1, 0x95, 0x04, 0x8E, 0xAD, 0xD7, 0xEB,
+    0x97, 0x52, 0x11, 0x91, 0xE8, 0x4E, 0xB6, 0x51, 0x61, 0xC4, 0xF0, 0xED, 0x03, 0xB9, 0xC8, 0x44,
+    0x3E, 0x52, 0x90, 0x0D, 0x8B, 0x1C, 0x27, 0x86, 0xC1, 0x6F, 0x36, 0xCA, 0x6C, 0xDD, 0x46, 0x77,
+    0xFE, 0x11, 0x23, 0x22, 0x76, 0xAB, 0x59, 0xAD, 0xEC, 0xA1, 0xC0, 0xC1, 0xFF, 0x7C, 0x5A, 0xBF,
+    0x14, 0x23, 0xB8, 0x28, 0x11, 0x71, 0x73, 0x94, 0xB4, 0xFD, 0x8D, 0x81, 0xEF, 0x6C, 0x41, 0x51,
+    0x03, 0x7A, 0x20, 0x05, 0xB9, 0x7D, 0xC9, 0xCD, 0x93, 0xA7, 0x92, 0xB7, 0x67, 0xB7, 0xB4, 0x30,
+    0xC7, 0xA3, 0xC9, 0x3D, 0x81, 0x24, 0xA0, 0x1D, 0x95, 0x25, 0xA0, 0x3B, 0xB4, 0x53, 0x03, 0x44,
+    0xEB, 0x57, 0x57, 0x38, 0x88, 0xD6, 0xB5, 0x6E, 0x02, 0x82, 0xA9, 0x41, 0xBF, 0xEE, 0xA3, 0x60,
+    0x28, 0x64, 0x22, 0x22, 0xEE, 0x77, 0x45, 0x7E, 0x78, 0x06, 0xED, 0x47, 0x60, 0xCC, 0x3D, 0x68,
+    0x67, 0xEA, 0xD9, 0xB9, 0x47, 0xBB, 0xCC, 0x43, 0xC0, 0x38, 0xB4, 0x63, 0x82, 0x40, 0xD6, 0xA3,
+    0x1D, 0xA5, 0x23, 0x5A, 0xDC, 0x3A, 0xB2, 0x7E, 0x8E, 0x42, 0x2D, 0x22, 0xF2, 0xDD, 0x8D, 0x41,
+    0x69, 0x58, 0x9C, 0xEC, 0x2C, 0x9B, 0xBD, 0x1B, 0xEE, 0x03, 0x46, 0x5D, 0x83, 0x39, 0xDB, 0x45,
+    0x41, 0x33, 0x4A, 0xDC, 0x6C, 0x73, 0x95, 0xCE, 0x5B, 0x3F, 0xFC, 0xD7, 0xE4, 0x77, 0xFA, 0x8A,
+    0xAC, 0x9F, 0x1A, 0x4B, 0x67, 0x04, 0xD0, 0x13, 0x90, 0x87, 0x18, 0x69, 0x0C, 0x4A, 0xB1, 0x60,
+    0xAE, 0xB5, 0xA0, 0x9F, 0xED, 0x21, 0xB1, 0xF7, 0xDC, 0x24, 0xE2, 0xB0, 0x6F, 0xE1, 0xEC, 0xF0,
+    0x10, 0xD5, 0xFD, 0xE5, 0x74, 0x29, 0xF6, 0xED, 0x6F, 0x2F, 0x1A, 0xF7, 0xE5, 0xED, 0x70, 0xEC,
+    0x62, 0xF4, 0x33, 0x44, 0xB7, 0xB3, 0x18, 0x55, 0xBB, 0x83, 0xD8, 0x76, 0x9B, 0x58, 0xB1, 0x51,
+    0x76, 0x67, 0xEC, 0x81, 0x15, 0xC0, 0x26, 0x13, 0x6F, 0x55, 0x4B, 0x66, 0x1F, 0xCA, 0x3A, 0x39,
+    0x33, 0xFB, 0x17, 0x15, 0x52, 0x13, 0xA0, 0xB2, 0x8D, 0xF8, 0x24, 0x40, 0x93, 0x4C, 0x4F, 0x0C,
+    0x49, 0x80, 0x49, 0xF5, 0x69, 0x48, 0x07, 0xD2, 0x90, 0xF9, 0x24, 0xA8, 0x9E, 0x6C, 0xD0, 0x2D,
+    0x41, 0x79, 0x0A, 0xAF, 0x5D, 0x12, 0x32, 0x4F, 0xE3, 0xB4, 0x53, 0x43, 0xDE, 0x9D, 0x10, 0x0A,
+    0x97, 0x7B, 0x2D, 0x32, 0x50, 0x7E, 0xB8, 0xDB, 0x69, 0x91, 0x1A, 0x23, 0x52, 0x6B, 0x79, 0x1B,
+    0xCC, 0x26, 0x94, 0xE0, 0x1C, 0xFE, 0x68, 0x11, 0x11, 0x1F, 0x12, 0xF4, 0x6E, 0xAC, 0x22, 0x16,
+    0xBB, 0xB3, 0x83, 0x7D, 0x7A, 0x16, 0x23, 0x8C, 0x0D, 0x08, 0x95, 0xBF, 0xCB, 0x34, 0x2E, 0x17,
+    0x0F, 0xC5, 0xBB, 0x03, 0x94, 0x36, 0x2C, 0xEE, 0x3F, 0x8C, 0x9B, 0x5C, 0x00, 0x63, 0x03, 0x94,
+    0xDF, 0x1C, 0xA0, 0x78, 0xB5, 0x07, 0x7D, 0xD5, 0x83, 0x7E, 0xB3, 0x5D, 0x2C, 0xCD, 0x63, 0x67,
+    0xCF, 0x15, 0x79, 0x80, 0x11, 0xFE, 0x58, 0x09, 0x9C, 0xCF, 0xC4, 0x32, 0xE9, 0x9B, 0x75, 0x2A,
+    0xBB, 0x4F, 0x3A, 0x25, 0x92, 0xB7, 0xF9, 0x9B, 0x21, 0xF3, 0xFA, 0xEA, 0xA0, 0x7C, 0xF9, 0xA8,
+    0x4F, 0x87, 0x8A, 0x17, 0x92, 0xBB, 0xF6, 0x4A, 0xB8, 0x72, 0x48, 0x62, 0x39, 0xEB, 0xD9, 0x5F,
+    0x19, 0xE6, 0x10, 0xB1, 0x4A, 0x6C, 0x22, 0xB7, 0x6B, 0xA2, 0x1D, 0x4C, 0x22, 0x22, 0x96, 0xC2,
+    0xE5, 0x63, 0xDC, 0x25, 0x6E, 0x6B, 0xF7, 0x87, 0xAB, 0xE6, 0xAF, 0x1B, 0x11, 0x91, 0xFF, 0xE3,
+    0xD2, 0x8D, 0x75, 0xF3, 0x7F, 0xC7, 0x18, 0x26, 0x85, 0xA3, 0xAC, 0x93, 0x40, 0x3A, 0x1C, 0x5A,
+    0xB6, 0x5D, 0xE1, 0xE2, 0x26, 0x72, 0xC6, 0x51, 0xDC, 0x68, 0xFA, 0x59, 0x99, 0x55, 0xC8, 0x08,
+    0xC9, 0x68, 0x8F, 0x46, 0x9F, 0xFC, 0xCC, 0xEC, 0x22, 0xF5, 0x55, 0xED, 0x32, 0x3C, 0x13, 0x11,
+    0x09, 0xD1, 0xBB, 0x58, 0xC9, 0xBF, 0x6F, 0x0B, 0x8C, 0xD7, 0x96, 0x74, 0xE2, 0x34, 0x68, 0x4F,
+    0x0F, 0x0D, 0xAA, 0x45, 0x0D, 0x68, 0x4B, 0xD1, 0x72, 0x1A, 0x2A, 0xE8, 0x67, 0x16, 0x24, 0xF7,
+    0x68, 0x4B, 0xE9, 0x30, 0x32, 0x35, 0x20, 0x72, 0x3B, 0xA0, 0x44, 0xDE, 0xF3, 0x68, 0x6B, 0xBE,
+    0xDB, 0x72, 0x9A, 0xC9, 0xD4, 0xF4, 0x6A, 0x10, 0x54, 0xAB, 0x7F, 0x3C, 0xA2, 0xAD, 0x79, 0x76,
+    0xE4, 0x34, 0x53, 0x36, 0xD2, 0xAB, 0x21, 0x9F, 0x54, 0xAB, 0xBB, 0x5C, 0x6E, 0xBE, 0x22, 0x75,
+    0x26, 0x22, 0x13, 0x49, 0x23, 0x72, 0x11, 0xB2, 0xB7, 0x81, 0xD9, 0x66, 0xE7, 0xF4, 0x41, 0x78,
+    0x47, 0xA9, 0x59, 0xF6, 0xA0, 0x2C, 0x47, 0x80, 0x69, 0x00, 0xB2, 0x0F, 0x3C, 0x50, 0x3E, 0xD7,
+    0x02, 0x63, 0x59, 0x43, 0xE6, 0x2B, 0xE2, 0xAE, 0x63, 0x99, 0x6C, 0xB6, 0x96, 0x19, 0xCF, 0x35,
+    0x37, 0x2E, 0xDD, 0x7E, 0x31, 0xAE, 0xFF, 0xB9, 0xC7, 0xD8, 0xAD, 0xEA, 0xF9, 0xD5, 0x74, 0xA6,
+    0x11, 0x11, 0xF9, 0x45, 0x0C, 0x44, 0x65, 0xEA, 0x79, 0x7F, 0xBE, 0xC2, 0xC5, 0x6D, 0x2E, 0x8C,
+    0x9D, 0x91, 0x79, 0x12, 0x72, 0xBF, 0xC4, 0x18, 0xCB, 0xDF, 0x8F, 0xC1, 0xAF, 0xBB, 0x43, 0x56,
+    0x44, 0xC7, 0x62, 0x70, 0xA1, 0x88, 0xA9, 0xA5, 0x4E, 0xFA, 0xE8, 0xE5, 0x10, 0xA7, 0xB4, 0xA9,
+    0x97, 0x58, 0x69, 0x11, 0xC7, 0x8E, 0xB9, 0x88, 0xC8, 0xCF, 0x45, 0x44, 0xC6, 0xD5, 0xEA, 0x6B,
+    0xF2, 0x43, 0x38, 0x21, 0x36, 0xC6, 0xE2, 0x4C, 0xA4, 0x83, 0x6F, 0xC8, 0x8D, 0xF5, 0xBA, 0x14,
+    0x11, 0xF9, 0x7B, 0x59, 0xAF, 0xD7, 0x2F, 0x44, 0x04, 0x73, 0xE0, 0xFA, 0x30, 0x6E, 0x04, 0xFA,
+    0x79, 0x80, 0xA7, 0x91, 0xDB, 0xAF, 0x4C, 0x68, 0x11, 0xA9, 0xA9, 0x64, 0xB2, 0x4B, 0x74, 0xD1,
+    0xE8, 0xA1, 0xB1, 0xB7, 0xB8, 0x92, 0x97, 0xCB, 0xD2, 0x80, 0xE9, 0xF7, 0x4E, 0xD4, 0xA6, 0x2B,
+    0xA1, 0xEC, 0x72, 0x87, 0xF6, 0xA9, 0x27, 0xF7, 0xEC, 0xA1, 0x06, 0x4A, 0x92, 0x91, 0xDC, 0x51,
+    0x91, 0x7A, 0x4A, 0xC7, 0x1E, 0xB9, 0xA7, 0x24, 0x0D, 0xE4, 0x8E, 0xE6, 0x68, 0x61, 0x7C, 0xD2,
+    0xD4, 0x91, 0x54, 0xDC, 0x23, 0x1D, 0x29, 0xC1, 0xB8, 0xDC, 0x91, 0x85, 0xD4, 0x43, 0xD3, 0xED,
+    0x25, 0x36, 0x17, 0xB9, 0xD4, 0xC6, 0x48, 0x45, 0xA9, 0xC8, 0xB0, 0x4C, 0x9B, 0x72, 0x21, 0x88,
+    0xFF, 0x98, 0xDF, 0x81, 0xC4, 0x73, 0x1E, 0x72, 0x97, 0xFA, 0x25, 0xD0, 0x59, 0xA0, 0x82, 0xDD,
+    0x25, 0x58, 0x8A, 0x4C, 0x5B, 0xCD, 0xBF, 0xBA, 0xF4, 0xC3, 0x33, 0xD1, 0x61, 0x22, 0x9B, 0x7B,
+    0x29, 0xF3, 0x50, 0xCD, 0x21, 0x75, 0xBF, 0x44, 0x71, 0xDC, 0xFF, 0x41, 0x4D, 0x5F, 0xA5, 0x22,
+    0x93, 0x90, 0x84, 0x68, 0xAD, 0x7C, 0x64, 0x75, 0x4E, 0x64, 0xB2, 0xD1, 0x98, 0xA0, 0x86, 0x6A,
+    0x92, 0x01, 0x74, 0xCF, 0x89, 0x8D, 0xC6, 0x29, 0xA2, 0xE8, 0x19, 0x6B, 0xCD, 0x17, 0xC3, 0x61,
+    0x05, 0x55, 0xB4, 0xF8, 0x9D, 0xC3, 0x08, 0x17, 0x71, 0x49, 0x28, 0xA3, 0x9D, 0x4F, 0x74, 0xE7,
+    0xE1, 0x44, 0x54, 0xA2, 0xCD, 0xBB, 0x21, 0x95, 0xEE, 0xEB, 0xF7, 0xD7, 0xFF, 0x3D, 0xA3, 0x79,
+    0x57, 0xCA, 0x21, 0xBF, 0xFE, 0x5C, 0x2B, 0x4F, 0xB8, 0x2B, 0x7F, 0x3C, 0x64, 0xED, 0x23, 0xFA,
+    0xFA, 0x35, 0x7B, 0x2A, 0x6D, 0x43, 0xD1, 0x2B, 0xF7, 0x88, 0xA9, 0xAB, 0xB7, 0x4F, 0xA5, 0xD2,
+    0x21, 0x22, 0x32, 0xA0, 0x2F, 0x89, 0x0C, 0xD0, 0x67, 0x3F, 0xFC, 0x1F, 0x41, 0xDB, 0x53, 0x69,
+    0x0B, 0xDF, 0x53, 0xEE, 0x91, 0x79, 0xEF, 0xB7, 0x4A, 0x44, 0x64, 0xB3, 0xE7, 0xDB, 0x61, 0x07,
+    0xB8, 0xCD, 0x8D, 0xF9, 0x6E, 0xB5, 0xA1, 0x94, 0x7E, 0xB5, 0x89, 0x11, 0x91, 0x27, 0x45, 0xE4,
+    0x8D, 0x4B, 0xB2, 0x7E, 0x11, 0xD3, 0xCE, 0x00, 0x34, 0x36, 0x59, 0x9D, 0x7D, 0x67, 0x47, 0x44,
+    0x46, 0x23, 0x22, 0x16, 0x53, 0xC7, 0xB5, 0x54, 0x7B, 0xD8, 0xED, 0xD1, 0xD2, 0x47, 0xA7, 0xAA,
+    0x66, 0xF6, 0x07, 0x8D, 0x31, 0x65, 0xEA, 0x19, 0xE4, 0x4B, 0x69, 0xBA, 0x94, 0x66, 0xFD, 0x12,
+    0x35, 0xA7, 0xBB, 0xC7, 0xC6, 0x2B, 0x3C, 0x08, 0x26, 0xD9, 0x07, 0xFD, 0x23, 0xA9, 0x51, 0x72,
+    0x0B, 0x4E, 0x44, 0x05, 0x33, 0x50, 0xDC, 0x74, 0x27, 0xEA, 0x54, 0xBD, 0xDF, 0x74, 0x10, 0x23,
+    0xF5, 0x8E, 0x90, 0xC7, 0x58, 0x11, 0x1E, 0xF5, 0x61, 0x17, 0x66, 0xA6, 0xC3, 0xA0, 0x1D, 0x85,
+    0x53, 0x3E, 0x52, 0x41, 0xAA, 0x8F, 0xEC, 0x8F, 0x76, 0x4C, 0x28, 0x8F, 0x40, 0x48, 0x05, 0x4C,
+    0x8C, 0xF9, 0x3B, 0x2D, 0xFE, 0xB7, 0x47, 0x22, 0x2B, 0xC7, 0x68, 0x99, 0x32, 0xEF, 0x54, 0x13,
+    0x63, 0xB1, 0x9F, 0x8F, 0xF1, 0x9E, 0x8A, 0xA8, 0xD0, 0xCA, 0x5C, 0x64, 0x6F, 0x43, 0xDC, 0xAD,
+    0xAB, 0x14, 0x11, 0xB9, 0x1D, 0x77, 0x02, 0x94, 0x81, 0x18, 0x55, 0xDF, 0xA1, 0x3A, 0x38, 0x36,
+    0x44, 0x8E, 0xB2, 0x8C, 0x9A, 0x69, 0xD5, 0xA2, 0x6B, 0x0B, 0x3D, 0xAA, 0xBB, 0x9C, 0x73, 0x12,
+    0x06, 0x79, 0xCE, 0x6B, 0x8B, 0x11, 0x11, 0xE5, 0xD0, 0xA1, 0xBC, 0x2E, 0x1E, 0x15, 0x54, 0x5B,
+    0xFA, 0x08, 0xB9, 0x9D, 0xD9, 0x25, 0x0E, 0x35, 0x5B, 0x2B, 0x7E, 0x6F, 0x7F, 0x31, 0x54, 0x9C,
+    0x27, 0xC1, 0x8D, 0x4B, 0x73, 0x44, 0xC3, 0x18, 0x82, 0x70, 0x36, 0x79, 0x3C, 0x7E, 0x48, 0xC9,
+    0x39, 0x47, 0xAC, 0x4F, 0x3F, 0xDF, 0xC5, 0x37, 0xA6, 0x8B, 0x71, 0x56, 0xC5, 0xDD, 0xEF, 0xC4,
+    0x63, 0x6E, 0x95, 0xFF, 0xB3, 0x38, 0x3D, 0xA4, 0x43, 0x2A, 0x73, 0x4C, 0x77, 0xE3, 0xD2, 0x01,
+    0x73, 0xB5, 0xA7, 0xAC, 0x93, 0x50, 0x91, 0x0E, 0xE8, 0x1F, 0x79, 0xCA, 0x9A, 0xFD, 0x7D, 0xD2,
+    0x81, 0xFC, 0x4E, 0x47, 0x59, 0x53, 0x4D, 0x24, 0x03, 0x59, 0xAC, 0x52, 0x35, 0x45, 0xA7, 0x83,
+    0x4F, 0xBC, 0xF0, 0x89, 0xC8, 0x8B, 0x50, 0x89, 0x74, 0x14, 0x22, 0x62, 0x33, 0x4F, 0xE5, 0x93,
+    0x40, 0x3A, 0x45, 0xDA, 0xA9, 0x70, 0x64, 0x3E, 0xF3, 0xF3, 0x46, 0x4B, 0xC6, 0x56, 0x73, 0x34,
+    0xF8, 0xDC, 0x67, 0x9E, 0x6C, 0x48, 0x02, 0x79, 0x78, 0x48, 0x6E, 0xCB, 0x98, 0x8B, 0x48, 0x48,
+    0x45, 0xA4, 0x9B, 0x49, 0xF1, 0xCD, 0x4E, 0x1D, 0xC9, 0x2B, 0xB7, 0xD7, 0xD0, 0x88, 0xB8, 0x39,
+    0xE2, 0xFF, 0x27, 0xEF, 0xE9, 0x41, 0x94, 0x40, 0x51, 0xA8, 0x0E, 0xC8, 0x7E, 0x38, 0xB0, 0x84,
+    0x26, 0x59, 0x02, 0x7F, 0x3C, 0x25, 0x1D, 0xE5, 0xBB, 0xEE, 0xF6, 0x44, 0xF1, 0x63, 0xBF, 0x5D,
+    0xB4, 0xBA, 0x3B, 0xAF, 0xBF, 0x15, 0x72, 0x5F, 0xA8, 0xCE, 0x3C, 0x3B, 0x64, 0x6E, 0xC8, 0xFD,
+    0x98, 0xF8, 0xED, 0x24, 0x54, 0x9C, 0xD7, 0xB5, 0x39, 0xEB, 0x0A, 0xD5, 0xE9, 0xF7, 0x7C, 0xE6,
+    0x06, 0x75, 0x3B, 0x24, 0xFE, 0x34, 0x53, 0xC3, 0xC1, 0xE7, 0x66, 0xAA, 0x6A, 0x3C, 0x14, 0x54,
+    0x76, 0xC6, 0x5D, 0xCD, 0xE1, 0x0E, 0x3F, 0x8C, 0x91, 0xCE, 0x89, 0x88, 0x44, 0x22, 0xDB, 0xCF,
+    0x1B, 0x1F, 0xF0, 0xE2, 0x1F, 0x81, 0x7E, 0xBC, 0x83, 0x7E, 0x3B, 0x66, 0x2A, 0xD9, 0x27, 0x13,
+    0x99, 0xA8, 0x44, 0x42, 0xE6, 0x93, 0xA6, 0xAB, 0x62, 0x70, 0xF8, 0xCC, 0x57, 0x60, 0x9E, 0xF0,
+    0xA8, 0xBE, 0x8A, 0x76, 0x2E, 0xB9, 0xAF, 0x48, 0xC6, 0xEC, 0xC3, 0xAF, 0x8A, 0xAD, 0xE2, 0xDE,
+    0x36, 0x13, 0xD5, 0x6A, 0x77, 0xCC, 0x3C, 0xDA, 0x57, 0xCC, 0xB1, 0x0F, 0x2B, 0x28, 0x5F, 0x3B,
+    0x94, 0x51, 0xA1, 0x82, 0xE6, 0xDB, 0x9E, 0xD2, 0x57, 0x22, 0x63, 0x26, 0x31, 0x3C, 0x97, 0x3D,
+    0x5A, 0x0D, 0x5E, 0xFC, 0xA3, 0x39, 0x3E, 0x46, 0x21, 0x01, 0x91, 0xA0, 0xE4, 0x6F, 0xF6, 0xF2,
+    0x21, 0xB6, 0xAB, 0x9C, 0x2D, 0x9A, 0xE7, 0x3D, 0x18, 0x37, 0x56, 0x8D, 0x9B, 0xEB, 0x3A, 0x3E,
+    0xA3, 0x3B, 0xC8, 0x07, 0xEE, 0x53, 0xF2, 0x37, 0x7B, 0x88, 0x04, 0x8A, 0x25, 0x3E, 0xC6, 0xC6,
+    0x81, 0x79, 0x34, 0x22, 0xE3, 0xC3, 0xEB, 0xF5, 0x4B, 0x0F, 0xAF, 0xD7, 0xEB, 0x17, 0x37, 0xDB,
+    0x5D, 0xCC, 0xD4, 0xC0, 0xB9, 0x8B, 0x3C, 0xF4, 0x22, 0xB9, 0xF4, 0xA9, 0x8C, 0x94, 0xE2, 0x73,
+    0x09, 0x18, 0xB7, 0xA3, 0xBB, 0x07, 0x69, 0xE2, 0x27, 0xF6, 0xE3, 0xD7, 0xE6, 0x0D, 0x21, 0x8F,
+    0x9C, 0x4E, 0x88, 0xFC, 0x49, 0xB4, 0xF9, 0xDC, 0x15, 0x69, 0x8F, 0x4F, 0xAB, 0xAD, 0xEA, 0x79,
+    0x7B, 0xCF, 0x27, 0xFF, 0x01, 0x4E, 0x9C, 0xBB, 0x08, 0xB9, 0xF4, 0x5F, 0xA1, 0x14, 0x3F, 0x62,
+    0xDC, 0xCE, 0x14, 0x43, 0x16, 0xEC, 0xC3, 0x57, 0xEE, 0x92, 0xEB, 0x9D, 0x10, 0xB1, 0x63, 0x25,
+    0x62, 0xC7, 0xE3, 0xD3, 0x8A, 0x91, 0x91, 0x5F, 0x43, 0xC2, 0xB9, 0x8B, 0x7F, 0x41, 0x2E, 0xFD,
+    0xB8, 0xA9, 0xD0, 0xB8, 0xA9, 0xD0, 0xDD, 0x0F, 0xFF, 0x43, 0x55, 0x88, 0x87, 0x5E, 0x64, 0xF6,
+    0x2D, 0xF9, 0x13, 0x9B, 0x8A, 0xD0, 0xC8, 0xD5, 0x1E, 0x49, 0xAC, 0xA9, 0xFF, 0x6C, 0x9A, 0x7B,
+    0xDC, 0xD8, 0xB2, 0x46, 0x77, 0xA4, 0x76, 0x76, 0x5B, 0xDF, 0x6C, 0x0A, 0xBA, 0x80, 0xFA, 0x98,
+    0xC8, 0x0F, 0x1A, 0xE9, 0xF5, 0x9B, 0x22, 0xBF, 0x10, 0x19, 0x55, 0xFF, 0xD4, 0xAD, 0x33, 0x9B,
+    0x7A, 0x2F, 0xC2, 0xF7, 0x18, 0x12, 0x23, 0x6E, 0xFF, 0xD9, 0xCF, 0x6F, 0xF8, 0x07, 0x7D, 0x60,
+    0x6E, 0xEF, 0xC3, 0x73, 0x7B, 0x9F, 0x6C, 0x8F, 0xB6, 0x37, 0xF6, 0xC6, 0xA1, 0xF6, 0x7E, 0xF2,
+    0xAB, 0xFE, 0xE4, 0x1F, 0x47, 0x7B, 0x1F, 0x7A, 0x11, 0x30, 0x32, 0xCC, 0x72, 0x44, 0x35, 0x26,
+    0x8D, 0xA3, 0xB2, 0xC9, 0x48, 0xEE, 0xA3, 0xFC, 0x30, 0x1A, 0x70, 0xEB, 0x96, 0x11, 0x26, 0x74,
+    0x4B, 0x23, 0xE3, 0x48, 0x29, 0xF2, 0x56, 0x9B, 0x9C, 0x7D, 0xE7, 0xCC, 0x78, 0xE4, 0x81, 0x2F,
+    0x99, 0x9D, 0xD0, 0x2D, 0xB9, 0x67, 0x04, 0xF3, 0xCE, 0x77, 0x5B, 0x52, 0x19, 0xC7, 0x65, 0xBB,
+    0xCA, 0x64, 0x07, 0x48, 0x5F, 0x9E, 0x5D, 0x53, 0x23, 0x66, 0x8F, 0x74, 0x36, 0x65, 0x5B, 0xB5,
+    0x11, 0xE9, 0x47, 0x46, 0x24, 0x72, 0x21, 0x59, 0x17, 0x39, 0xF2, 0x78, 0xB9, 0xF5, 0x94, 0x67,
+    0x1F, 0x0A, 0x91, 0xBA, 0x91, 0x29, 0x17, 0x19, 0x0A, 0x91, 0x9F, 0x4C, 0x7F, 0xB6, 0xCB, 0xD9,
+    0x0F, 0xCF, 0x18, 0xCB, 0x03, 0xEC, 0xCF, 0xE6, 0xF4, 0x5D, 0x24, 0xA8, 0xF6, 0xA3, 0xF8, 0x29,
+    0xEF, 0x62, 0x90, 0xA4, 0xFD, 0xC8, 0xB8, 0xE4, 0x5D, 0xF4, 0x40, 0xDF, 0x07, 0x9A, 0x31, 0x7E,
+    0xA8, 0xEA, 0xE3, 0x87, 0x2A, 0x97, 0x77, 0x71, 0xED, 0xDB, 0x8F, 0x12, 0x8E, 0x18, 0x38, 0x3A,
+    0xD0, 0x90, 0x42, 0xE9, 0xB2, 0x1E, 0xF3, 0xFC, 0xD9, 0x1E, 0xF3, 0xCE, 0xBF, 0x14, 0x99, 0x48,
+    0x64, 0x3A, 0x21, 0x13, 0x64, 0xD2, 0x25, 0x67, 0x0E, 0x79, 0x9A, 0xCF, 0x04, 0x79, 0xB7, 0xD8,
+    0x6C, 0x75, 0x0B, 0x85, 0x3E, 0x67, 0x8A, 0x65, 0x7B, 0x96, 0xC5, 0x23, 0xA3, 0x98, 0x33, 0x89,
+    0xDC, 0x8E, 0x99, 0xA2, 0x8B, 0x3B, 0x87, 0x27, 0x61, 0x5E, 0xE9, 0x0A, 0x1F, 0xDF, 0x93, 0x48,
+    0x7B, 0x0E, 0xD3, 0x41, 0x21, 0x6F, 0x4D, 0x48, 0x17, 0x19, 0x63, 0x35, 0xD3, 0x08, 0x9D, 0x96,
+    0x2E, 0xC6, 0xA1, 0xAE, 0xA4, 0x2B, 0x22, 0xB3, 0x2C, 0x5D, 0xDC, 0xC4, 0x2F, 0x9A, 0xEF, 0xFA,
+    0x4C, 0x44, 0xD2, 0x79, 0x4D, 0xF2, 0xA9, 0x48, 0x50, 0x22, 0x42, 0x1A, 0x97, 0x4C, 0x4F, 0x2A,
+    0x72, 0xA3, 0x11, 0x99, 0x8D, 0xB4, 0xE7, 0xDD, 0x98, 0x22, 0x35, 0x9E, 0x4A, 0xAF, 0xE7, 0xFD,
+    0x11, 0xEB, 0x42, 0x00, 0xD2, 0x69, 0x96, 0x0E, 0xA5, 0x21, 0x4A, 0x2B, 0x48, 0x6F, 0xED, 0xFA,
+    0x45, 0x75, 0xBC, 0x18, 0x7B, 0xFB, 0x25, 0xB3, 0x48, 0x50, 0x16, 0x79, 0x49, 0x0A, 0xC0, 0xFF,
+    0x0B,
 };
 
 static const EpdGlyph notosans_18_regularGlyphs[] = {
@@ -2453,7 +2481,7 @@ static const EpdGlyph notosans_18_regularGlyphs[] = {
     { 4, 39, 21, 8, 29, 39, 10238 }, // |
     { 13, 33, 14, 1, 27, 108, 10277 }, // }
     { 19, 6, 21, 1, 16, 29, 10385 }, // ~
-    { 0, 0, 10, 0, 0, 0, 0 }, //  
+    { 0, 0, 10, 0, 0, 0, 10414 }, //  
     { 6, 28, 10, 2, 21, 42, 0 }, // ¡
     { 16, 29, 21, 3, 28, 116, 42 }, // ¢
     { 20, 28, 21, 1, 28, 140, 158 }, // £
@@ -2464,775 +2492,782 @@ static const EpdGlyph notosans_18_regularGlyphs[] = {
     { 12, 5, 22, 5, 28, 15, 673 }, // ¨
     { 29, 29, 31, 1, 28, 211, 688 }, // ©
     { 11, 14, 13, 1, 28, 39, 899 }, // ª
-    { 17, 16, 19, 1, 18, 68, 938 }, // «
-    { 19, 11, 21, 1, 15, 53, 1006 }, // ¬
-    { 10, 4, 12, 1, 12, 10, 1059 }, // ­
-    { 29, 29, 31, 1, 28, 211, 1069 }, // ®
-    { 20, 3, 19, -1, 31, 15, 1280 }, // ¯
-    { 12, 13, 16, 2, 28, 39, 1295 }, // °
-    { 19, 23, 21, 1, 23, 110, 1334 }, // ±
-    { 12, 17, 13, 0, 32, 51, 1444 }, // ²
-    { 13, 17, 13, 0, 32, 56, 1495 }, // ³
-    { 9, 7, 11, 1, 29, 16, 1551 }, // ´
-    { 18, 30, 23, 3, 21, 135, 1567 }, // µ
-    { 19, 34, 25, 2, 29, 162, 1702 }, // ¶
-    { 6, 6, 10, 2, 16, 9, 1864 }, // ·
-    { 8, 9, 8, 0, 0, 18, 1873 }, // ¸
-    { 8, 17, 13, 1, 32, 34, 1891 }, // ¹
-    { 12, 14, 14, 1, 28, 42, 1925 }, // º
-    { 17, 16, 19, 1, 18, 68, 1967 }, // »
-    { 27, 27, 28, 1, 27, 183, 2035 }, // ¼
-    { 28, 27, 29, 0, 27, 189, 2218 }, // ½
-    { 29, 28, 29, 0, 28, 203, 2407 }, // ¾
-    { 16, 29, 16, 0, 21, 116, 2610 }, // ¿
-    { 24, 36, 24, 0, 36, 216, 2726 }, // À
-    { 24, 36, 24, 0, 36, 216, 2942 }, // Á
-    { 24, 36, 24, 0, 36, 216, 3158 }, // Â
-    { 24, 35, 24, 0, 35, 210, 3374 }, // Ã
-    { 24, 35, 24, 0, 35, 210, 3584 }, // Ä
-    { 24, 33, 24, 0, 33, 198, 3794 }, // Å
-    { 32, 27, 33, -1, 27, 216, 3992 }, // Æ
-    { 21, 37, 24, 2, 28, 195, 4208 }, // Ç
-    { 16, 36, 21, 3, 36, 144, 4403 }, // È
-    { 16, 36, 21, 3, 36, 144, 4547 }, // É
-    { 16, 36, 21, 3, 36, 144, 4691 }, // Ê
-    { 16, 35, 21, 3, 35, 140, 4835 }, // Ë
-    { 11, 36, 13, 1, 36, 99, 4975 }, // Ì
-    { 11, 36, 13, 1, 36, 99, 5074 }, // Í
-    { 13, 36, 13, 0, 36, 117, 5173 }, // Î
-    { 11, 35, 13, 1, 35, 97, 5290 }, // Ï
-    { 25, 27, 27, 1, 27, 169, 5387 }, // Ð
-    { 22, 35, 29, 3, 35, 193, 5556 }, // Ñ
-    { 25, 37, 29, 2, 36, 232, 5749 }, // Ò
-    { 25, 37, 29, 2, 36, 232, 5981 }, // Ó
-    { 25, 37, 29, 2, 36, 232, 6213 }, // Ô
-    { 25, 36, 29, 2, 35, 225, 6445 }, // Õ
-    { 25, 36, 29, 2, 35, 225, 6670 }, // Ö
-    { 17, 18, 21, 2, 22, 77, 6895 }, // ×
-    { 25, 30, 29, 2, 28, 188, 6972 }, // Ø
-    { 21, 37, 27, 3, 36, 195, 7160 }, // Ù
-    { 21, 37, 27, 3, 36, 195, 7355 }, // Ú
-    { 21, 37, 27, 3, 36, 195, 7550 }, // Û
-    { 21, 36, 27, 3, 35, 189, 7745 }, // Ü
-    { 22, 36, 21, 0, 36, 198, 7934 }, // Ý
-    { 18, 27, 23, 3, 27, 122, 8132 }, // Þ
-    { 19, 30, 24, 3, 29, 143, 8254 }, // ß
-    { 17, 30, 21, 1, 29, 128, 8397 }, // à
-    { 17, 30, 21, 1, 29, 128, 8525 }, // á
-    { 17, 30, 21, 1, 29, 128, 8653 }, // â
-    { 17, 29, 21, 1, 28, 124, 8781 }, // ã
-    { 17, 29, 21, 1, 28, 124, 8905 }, // ä
-    { 17, 32, 21, 1, 31, 136, 9029 }, // å
-    { 30, 22, 32, 1, 21, 165, 9165 }, // æ
-    { 15, 30, 18, 2, 21, 113, 9330 }, // ç
-    { 18, 30, 21, 2, 29, 135, 9443 }, // è
-    { 18, 30, 21, 2, 29, 135, 9578 }, // é
-    { 18, 30, 21, 2, 29, 135, 9713 }, // ê
-    { 18, 29, 21, 2, 28, 131, 9848 }, // ë
-    { 9, 29, 10, -1, 29, 66, 9979 }, // ì
-    { 9, 29, 10, 2, 29, 66, 10045 }, // í
-    { 14, 29, 10, -2, 29, 102, 10111 }, // î
-    { 12, 28, 10, -1, 28, 84, 10213 }, // ï
-    { 19, 30, 23, 2, 29, 143, 10297 }, // ð
-    { 18, 28, 23, 3, 28, 126, 10440 }, // ñ
-    { 19, 30, 23, 2, 29, 143, 10566 }, // ò
-    { 19, 30, 23, 2, 29, 143, 10709 }, // ó
-    { 19, 30, 23, 2, 29, 143, 10852 }, // ô
-    { 19, 29, 23, 2, 28, 138, 10995 }, // õ
-    { 19, 29, 23, 2, 28, 138, 11133 }, // ö
-    { 19, 18, 21, 1, 22, 86, 11271 }, // ÷
-    { 19, 24, 23, 2, 22, 114, 11357 }, // ø
-    { 18, 30, 23, 2, 29, 135, 11471 }, // ù
-    { 18, 30, 23, 2, 29, 135, 11606 }, // ú
-    { 18, 30, 23, 2, 29, 135, 11741 }, // û
-    { 18, 29, 23, 2, 28, 131, 11876 }, // ü
-    { 20, 38, 19, 0, 29, 190, 12007 }, // ý
-    { 18, 38, 23, 3, 29, 171, 12197 }, // þ
-    { 20, 37, 19, 0, 28, 185, 12368 }, // ÿ
-    { 24, 33, 24, 0, 33, 198, 0 }, // Ā
-    { 17, 27, 21, 1, 26, 115, 198 }, // ā
-    { 24, 35, 24, 0, 35, 210, 313 }, // Ă
-    { 17, 29, 21, 1, 28, 124, 523 }, // ă
-    { 24, 36, 24, 0, 27, 216, 647 }, // Ą
-    { 18, 30, 21, 1, 21, 135, 863 }, // ą
-    { 21, 37, 24, 2, 36, 195, 998 }, // Ć
-    { 15, 30, 18, 2, 29, 113, 1193 }, // ć
-    { 21, 37, 24, 2, 36, 195, 1306 }, // Ĉ
-    { 15, 30, 18, 2, 29, 113, 1501 }, // ĉ
-    { 21, 36, 24, 2, 35, 189, 1614 }, // Ċ
-    { 15, 29, 18, 2, 28, 109, 1803 }, // ċ
-    { 21, 37, 24, 2, 36, 195, 1912 }, // Č
-    { 15, 30, 18, 2, 29, 113, 2107 }, // č
-    { 23, 36, 27, 3, 36, 207, 2220 }, // Ď
-    { 24, 30, 23, 2, 29, 180, 2427 }, // ď
-    { 25, 27, 27, 1, 27, 169, 2607 }, // Đ
-    { 21, 30, 23, 2, 29, 158, 2776 }, // đ
-    { 16, 33, 21, 3, 33, 132, 2934 }, // Ē
-    { 18, 27, 21, 2, 26, 122, 3066 }, // ē
-    { 16, 35, 21, 3, 35, 140, 3188 }, // Ĕ
-    { 18, 29, 21, 2, 28, 131, 3328 }, // ĕ
-    { 16, 35, 21, 3, 35, 140, 3459 }, // Ė
-    { 18, 29, 21, 2, 28, 131, 3599 }, // ė
-    { 16, 36, 21, 3, 27, 144, 3730 }, // Ę
-    { 18, 30, 21, 2, 21, 135, 3874 }, // ę
-    { 16, 36, 21, 3, 36, 144, 4009 }, // Ě
-    { 18, 30, 21, 2, 29, 135, 4153 }, // ě
-    { 23, 37, 27, 2, 36, 213, 4288 }, // Ĝ
-    { 18, 38, 23, 2, 29, 171, 4501 }, // ĝ
-    { 23, 36, 27, 2, 35, 207, 4672 }, // Ğ
-    { 18, 37, 23, 2, 28, 167, 4879 }, // ğ
-    { 23, 36, 27, 2, 35, 207, 5046 }, // Ġ
-    { 18, 37, 23, 2, 28, 167, 5253 }, // ġ
-    { 23, 37, 27, 2, 28, 213, 5420 }, // Ģ
-    { 18, 38, 23, 2, 29, 171, 5633 }, // ģ
-    { 22, 36, 28, 3, 36, 198, 5804 }, // Ĥ
-    { 23, 37, 23, -2, 37, 213, 6002 }, // ĥ
-    { 28, 27, 28, 0, 27, 189, 6215 }, // Ħ
-    { 21, 29, 23, 0, 29, 153, 6404 }, // ħ
-    { 15, 35, 13, -1, 35, 132, 6557 }, // Ĩ
-    { 15, 28, 10, -3, 28, 105, 6689 }, // ĩ
-    { 12, 33, 13, 0, 33, 99, 6794 }, // Ī
-    { 12, 26, 10, -1, 26, 78, 6893 }, // ī
-    { 13, 35, 13, 0, 35, 114, 6971 }, // Ĭ
-    { 13, 28, 10, -2, 28, 91, 7085 }, // ĭ
-    { 11, 36, 13, 1, 27, 99, 7176 }, // Į
-    { 7, 37, 10, 1, 28, 65, 7275 }, // į
-    { 11, 35, 13, 1, 35, 97, 7340 }, // İ
-    { 4, 21, 10, 3, 21, 21, 7437 }, // ı
-    { 19, 35, 23, 1, 27, 167, 7458 }, // Ĳ
-    { 15, 37, 19, 2, 28, 139, 7625 }, // ĳ
-    { 15, 44, 10, -3, 36, 165, 7764 }, // Ĵ
-    { 15, 38, 10, -3, 29, 143, 7929 }, // ĵ
-    { 21, 36, 23, 3, 27, 189, 8072 }, // Ķ
-    { 17, 38, 20, 3, 29, 162, 8261 }, // ķ
-    { 17, 21, 20, 3, 21, 90, 8423 }, // ĸ
-    { 16, 36, 20, 3, 36, 144, 8513 }, // Ĺ
-    { 9, 37, 10, 2, 37, 84, 8657 }, // ĺ
-    { 16, 36, 20, 3, 27, 144, 8741 }, // Ļ
-    { 6, 38, 10, 2, 29, 57, 8885 }, // ļ
-    { 16, 27, 20, 3, 27, 108, 8942 }, // Ľ
-    { 10, 29, 10, 3, 29, 73, 9050 }, // ľ
-    { 16, 27, 20, 3, 27, 108, 9123 }, // Ŀ
-    { 9, 29, 10, 3, 29, 66, 9231 }, // ŀ
-    { 19, 27, 20, 0, 27, 129, 9297 }, // Ł
-    { 12, 29, 10, -1, 29, 87, 9426 }, // ł
-    { 22, 36, 29, 3, 36, 198, 9513 }, // Ń
-    { 18, 29, 23, 3, 29, 131, 9711 }, // ń
-    { 22, 36, 29, 3, 27, 198, 9842 }, // Ņ
-    { 18, 30, 23, 3, 21, 135, 10040 }, // ņ
-    { 22, 36, 29, 3, 36, 198, 10175 }, // Ň
-    { 18, 29, 23, 3, 29, 131, 10373 }, // ň
-    { 23, 27, 26, 0, 27, 156, 10504 }, // ŉ
-    { 22, 35, 29, 3, 27, 193, 10660 }, // Ŋ
-    { 18, 30, 23, 3, 21, 135, 10853 }, // ŋ
-    { 25, 34, 29, 2, 33, 213, 10988 }, // Ō
-    { 19, 27, 23, 2, 26, 129, 11201 }, // ō
-    { 25, 36, 29, 2, 35, 225, 11330 }, // Ŏ
-    { 19, 29, 23, 2, 28, 138, 11555 }, // ŏ
-    { 25, 37, 29, 2, 36, 232, 11693 }, // Ő
-    { 19, 30, 23, 2, 29, 143, 11925 }, // ő
-    { 31, 29, 35, 2, 28, 225, 12068 }, // Œ
-    { 32, 22, 35, 2, 21, 176, 12293 }, // œ
-    { 20, 36, 23, 3, 36, 180, 12469 }, // Ŕ
-    { 12, 29, 15, 3, 29, 87, 12649 }, // ŕ
-    { 20, 36, 23, 3, 27, 180, 12736 }, // Ŗ
-    { 13, 30, 15, 2, 21, 98, 12916 }, // ŗ
-    { 20, 36, 23, 3, 36, 180, 13014 }, // Ř
-    { 14, 29, 15, 2, 29, 102, 13194 }, // ř
-    { 18, 37, 21, 1, 36, 167, 13296 }, // Ś
-    { 16, 30, 18, 1, 29, 120, 13463 }, // ś
-    { 18, 37, 21, 1, 36, 167, 13583 }, // Ŝ
-    { 16, 30, 18, 1, 29, 120, 13750 }, // ŝ
-    { 18, 37, 21, 1, 28, 167, 13870 }, // Ş
-    { 16, 30, 18, 1, 21, 120, 14037 }, // ş
-    { 18, 37, 21, 1, 36, 167, 14157 }, // Š
-    { 16, 30, 18, 1, 29, 120, 14324 }, // š
-    { 21, 36, 21, 0, 27, 189, 14444 }, // Ţ
-    { 13, 34, 14, 0, 25, 111, 14633 }, // ţ
-    { 21, 36, 21, 0, 36, 189, 14744 }, // Ť
-    { 18, 30, 14, 0, 29, 135, 14933 }, // ť
-    { 21, 27, 21, 0, 27, 142, 15068 }, // Ŧ
-    { 13, 26, 14, 0, 25, 85, 15210 }, // ŧ
-    { 21, 36, 27, 3, 35, 189, 15295 }, // Ũ
-    { 18, 29, 23, 2, 28, 131, 15484 }, // ũ
-    { 21, 34, 27, 3, 33, 179, 15615 }, // Ū
-    { 18, 27, 23, 2, 26, 122, 15794 }, // ū
-    { 21, 36, 27, 3, 35, 189, 15916 }, // Ŭ
-    { 18, 29, 23, 2, 28, 131, 16105 }, // ŭ
-    { 21, 39, 27, 3, 38, 205, 16236 }, // Ů
-    { 18, 32, 23, 2, 31, 144, 16441 }, // ů
-    { 21, 37, 27, 3, 36, 195, 16585 }, // Ű
-    { 18, 30, 23, 2, 29, 135, 16780 }, // ű
-    { 21, 36, 27, 3, 27, 189, 16915 }, // Ų
-    { 19, 30, 23, 2, 21, 143, 17104 }, // ų
-    { 35, 36, 35, 0, 36, 315, 17247 }, // Ŵ
-    { 30, 29, 29, 0, 29, 218, 17562 }, // ŵ
-    { 22, 36, 21, 0, 36, 198, 17780 }, // Ŷ
-    { 20, 38, 19, 0, 29, 190, 17978 }, // ŷ
-    { 22, 35, 21, 0, 35, 193, 18168 }, // Ÿ
-    { 19, 36, 21, 1, 36, 171, 18361 }, // Ź
-    { 16, 29, 18, 1, 29, 116, 18532 }, // ź
-    { 19, 35, 21, 1, 35, 167, 18648 }, // Ż
-    { 16, 28, 18, 1, 28, 112, 18815 }, // ż
-    { 19, 36, 21, 1, 36, 171, 18927 }, // Ž
-    { 16, 29, 18, 1, 29, 116, 19098 }, // ž
-    { 11, 29, 12, 3, 29, 80, 19214 }, // ſ
-    { 9, 7, 0, -19, 29, 16, 0 }, // ̀
-    { 9, 7, 0, -13, 29, 16, 16 }, // ́
-    { 14, 7, 0, -7, 29, 25, 32 }, // ̂
-    { 15, 6, 0, -19, 28, 23, 57 }, // ̃
-    { 12, 4, 0, -6, 26, 12, 80 }, // ̄
-    { 16, 4, 0, -8, 32, 16, 92 }, // ̅
-    { 12, 6, 0, -6, 28, 18, 108 }, // ̆
-    { 4, 5, 0, -2, 28, 5, 126 }, // ̇
-    { 12, 5, 0, -6, 28, 15, 131 }, // ̈
-    { 7, 9, 0, -14, 31, 16, 146 }, // ̉
-    { 10, 9, 0, -5, 31, 23, 162 }, // ̊
-    { 14, 7, 0, -5, 29, 25, 185 }, // ̋
-    { 14, 7, 0, -7, 29, 25, 210 }, // ̌
-    { 4, 7, 0, -2, 29, 7, 235 }, // ̍
-    { 10, 7, 0, -5, 29, 18, 242 }, // ̎
-    { 15, 7, 0, -20, 29, 27, 260 }, // ̏
-    { 12, 10, 0, -6, 32, 30, 287 }, // ̐
-    { 12, 6, 0, -6, 28, 18, 317 }, // ̑
-    { 6, 10, 0, -3, 27, 15, 335 }, // ̒
-    { 6, 10, 0, -3, 27, 15, 350 }, // ̓
-    { 6, 10, 0, -3, 27, 15, 365 }, // ̔
-    { 6, 10, 0, -3, 27, 15, 380 }, // ̕
-    { 8, 7, 0, -4, -1, 14, 395 }, // ̖
-    { 8, 7, 0, -4, -1, 14, 409 }, // ̗
-    { 8, 8, 0, -4, -1, 16, 423 }, // ̘
-    { 8, 8, 0, -4, -1, 16, 439 }, // ̙
-    { 11, 10, 12, 0, 29, 28, 455 }, // ̚
-    { 9, 9, 0, -4, 29, 21, 483 }, // ̛
-    { 5, 9, 0, -2, 0, 12, 504 }, // ̜
-    { 8, 7, 0, -4, -1, 14, 516 }, // ̝
-    { 8, 7, 0, -4, -1, 14, 530 }, // ̞
-    { 8, 8, 0, -4, -1, 16, 544 }, // ̟
-    { 10, 3, 0, -5, -3, 8, 560 }, // ̠
-    { 7, 11, 0, -7, 2, 20, 568 }, // ̡
-    { 7, 11, 0, 0, 2, 20, 588 }, // ̢
-    { 5, 5, 0, -14, -2, 7, 608 }, // ̣
-    { 12, 5, 0, -6, -2, 15, 615 }, // ̤
-    { 10, 9, 0, -5, 0, 23, 630 }, // ̥
-    { 6, 7, 0, -3, -2, 11, 653 }, // ̦
-    { 8, 9, 0, -4, 0, 18, 664 }, // ̧
-    { 8, 10, 0, -4, 1, 20, 682 }, // ̨
-    { 4, 7, 0, -2, -1, 7, 702 }, // ̩
-    { 14, 8, 0, -7, -1, 28, 709 }, // ̪
-    { 16, 5, 0, -8, -2, 20, 737 }, // ̫
-    { 14, 7, 0, -7, -1, 25, 757 }, // ̬
-    { 14, 7, 0, -7, -1, 25, 782 }, // ̭
-    { 12, 6, 0, -6, -2, 18, 807 }, // ̮
-    { 12, 6, 0, -6, -2, 18, 825 }, // ̯
-    { 14, 6, 0, -7, -2, 21, 843 }, // ̰
-    { 12, 4, 0, -6, -2, 12, 864 }, // ̱
-    { 18, 3, 0, -9, -3, 14, 876 }, // ̲
-    { 16, 9, 0, -8, 0, 36, 890 }, // ̳
-    { 15, 6, 0, -7, 13, 23, 926 }, // ̴
-    { 16, 4, 0, -8, 13, 16, 949 }, // ̵
-    { 28, 3, 0, -14, 12, 21, 965 }, // ̶
-    { 12, 9, 0, -6, 15, 27, 986 }, // ̷
-    { 16, 32, 0, -8, 29, 128, 1013 }, // ̸
-    { 5, 9, 0, -2, 0, 12, 1141 }, // ̹
-    { 14, 8, 0, -7, -1, 28, 1153 }, // ̺
-    { 16, 8, 0, -8, -1, 32, 1181 }, // ̻
-    { 16, 5, 0, -8, -2, 20, 1213 }, // ̼
-    { 8, 9, 0, -4, 30, 18, 1233 }, // ̽
-    { 6, 12, 0, -3, 33, 18, 1251 }, // ̾
-    { 16, 9, 0, -8, 37, 36, 1269 }, // ̿
-    { 8, 7, 0, -6, 29, 14, 1305 }, // ̀
-    { 9, 7, 0, -2, 29, 16, 1319 }, // ́
-    { 14, 6, 0, -7, 28, 21, 1335 }, // ͂
-    { 6, 8, 0, -3, 30, 12, 1356 }, // ̓
-    { 14, 8, 0, -6, 30, 28, 1368 }, // ̈́
-    { 6, 6, 0, -2, -3, 9, 1396 }, // ͅ
-    { 18, 7, 0, -9, 29, 32, 1405 }, // ͆
-    { 16, 9, 0, -8, 0, 36, 1437 }, // ͇
-    { 10, 7, 0, -5, -1, 18, 1473 }, // ͈
-    { 8, 7, 0, -4, -2, 14, 1491 }, // ͉
-    { 14, 8, 0, -7, 29, 28, 1505 }, // ͊
-    { 14, 14, 0, -7, 35, 49, 1533 }, // ͋
-    { 14, 11, 0, -7, 33, 39, 1582 }, // ͌
-    { 14, 8, 0, -7, -1, 28, 1621 }, // ͍
-    { 8, 9, 0, -4, 0, 18, 1649 }, // ͎
-    { 28, 27, 0, -14, 27, 189, 1667 }, // ͏
-    { 7, 8, 0, -4, 30, 14, 1856 }, // ͐
-    { 5, 9, 0, -2, 31, 12, 1870 }, // ͑
-    { 12, 10, 0, -6, 32, 30, 1882 }, // ͒
-    { 8, 8, 0, -4, -1, 16, 1912 }, // ͓
-    { 7, 8, 0, -4, -1, 14, 1928 }, // ͔
-    { 7, 8, 0, -4, -1, 14, 1942 }, // ͕
-    { 15, 8, 0, -7, -1, 30, 1956 }, // ͖
-    { 5, 9, 0, -2, 31, 12, 1986 }, // ͗
-    { 5, 5, 0, 4, 28, 7, 1998 }, // ͘
-    { 8, 8, 0, -4, -1, 16, 2005 }, // ͙
-    { 16, 8, 0, -8, -1, 32, 2021 }, // ͚
-    { 8, 8, 0, -4, 30, 16, 2053 }, // ͛
-    { 30, 8, 0, -15, -1, 60, 2069 }, // ͜
-    { 30, 8, 0, -15, 30, 60, 2129 }, // ͝
-    { 24, 3, 0, -12, 26, 18, 2189 }, // ͞
-    { 24, 3, 0, -12, -2, 18, 2207 }, // ͟
-    { 30, 6, 0, -15, 28, 45, 2225 }, // ͠
-    { 30, 8, 0, -15, 32, 60, 2270 }, // ͡
-    { 30, 8, 0, -14, -1, 60, 2330 }, // ͢
-    { 8, 9, 0, -4, 32, 18, 2390 }, // ͣ
-    { 9, 9, 0, -4, 32, 21, 2408 }, // ͤ
-    { 3, 12, 0, -1, 35, 9, 2429 }, // ͥ
-    { 9, 9, 0, -4, 32, 21, 2438 }, // ͦ
-    { 9, 9, 0, -4, 32, 21, 2459 }, // ͧ
-    { 7, 9, 0, -3, 32, 16, 2480 }, // ͨ
-    { 9, 12, 0, -4, 35, 27, 2496 }, // ͩ
-    { 9, 12, 0, -4, 35, 27, 2523 }, // ͪ
-    { 14, 9, 0, -7, 32, 32, 2550 }, // ͫ
-    { 6, 9, 0, -2, 32, 14, 2582 }, // ͬ
-    { 7, 11, 0, -3, 34, 20, 2596 }, // ͭ
-    { 9, 9, 0, -4, 32, 21, 2616 }, // ͮ
-    { 9, 9, 0, -4, 32, 21, 2637 }, // ͯ
-    { 16, 36, 21, 3, 36, 144, 0 }, // Ѐ
-    { 16, 34, 21, 3, 34, 136, 144 }, // Ё
-    { 25, 28, 27, 0, 27, 175, 280 }, // Ђ
-    { 16, 36, 19, 3, 36, 144, 455 }, // Ѓ
-    { 21, 29, 24, 2, 28, 153, 599 }, // Є
-    { 18, 29, 21, 1, 28, 131, 752 }, // Ѕ
-    { 5, 27, 11, 3, 27, 34, 883 }, // І
-    { 9, 34, 11, 1, 34, 77, 917 }, // Ї
-    { 10, 35, 10, -3, 27, 88, 994 }, // Ј
-    { 36, 28, 38, 0, 27, 252, 1082 }, // Љ
-    { 34, 27, 39, 3, 27, 230, 1334 }, // Њ
-    { 25, 27, 27, 0, 27, 169, 1564 }, // Ћ
-    { 21, 36, 23, 3, 36, 189, 1733 }, // Ќ
-    { 22, 36, 28, 3, 36, 198, 1922 }, // Ѝ
-    { 24, 35, 23, 0, 34, 210, 2120 }, // Ў
-    { 21, 33, 27, 3, 27, 174, 2330 }, // Џ
-    { 24, 27, 24, 0, 27, 162, 2504 }, // А
-    { 19, 27, 23, 3, 27, 129, 2666 }, // Б
-    { 20, 27, 24, 3, 27, 135, 2795 }, // В
-    { 16, 27, 19, 3, 27, 108, 2930 }, // Г
-    { 27, 33, 27, 0, 27, 223, 3038 }, // Д
-    { 16, 27, 21, 3, 27, 108, 3261 }, // Е
-    { 34, 27, 34, 0, 27, 230, 3369 }, // Ж
-    { 19, 29, 22, 1, 28, 138, 3599 }, // З
-    { 22, 27, 28, 3, 27, 149, 3737 }, // И
-    { 22, 34, 28, 3, 34, 187, 3886 }, // Й
-    { 21, 27, 23, 3, 27, 142, 4073 }, // К
-    { 23, 28, 26, 0, 27, 161, 4215 }, // Л
-    { 28, 27, 34, 3, 27, 189, 4376 }, // М
-    { 22, 27, 28, 3, 27, 149, 4565 }, // Н
-    { 25, 29, 29, 2, 28, 182, 4714 }, // О
-    { 21, 27, 27, 3, 27, 142, 4896 }, // П
-    { 18, 27, 23, 3, 27, 122, 5038 }, // Р
-    { 21, 29, 24, 2, 28, 153, 5160 }, // С
-    { 21, 27, 21, 0, 27, 142, 5313 }, // Т
-    { 24, 28, 23, 0, 27, 168, 5455 }, // У
-    { 28, 29, 31, 1, 28, 203, 5623 }, // Ф
-    { 22, 27, 22, 0, 27, 149, 5826 }, // Х
-    { 25, 33, 28, 3, 27, 207, 5975 }, // Ц
-    { 20, 27, 25, 2, 27, 135, 6182 }, // Ч
-    { 33, 27, 39, 3, 27, 223, 6317 }, // Ш
-    { 36, 33, 38, 3, 27, 297, 6540 }, // Щ
-    { 24, 27, 26, 0, 27, 162, 6837 }, // Ъ
-    { 26, 27, 32, 3, 27, 176, 6999 }, // Ы
-    { 18, 27, 23, 3, 27, 122, 7175 }, // Ь
-    { 22, 29, 24, 1, 28, 160, 7297 }, // Э
-    { 33, 29, 37, 3, 28, 240, 7457 }, // Ю
-    { 20, 27, 24, 1, 27, 135, 7697 }, // Я
-    { 17, 22, 21, 1, 21, 94, 7832 }, // а
-    { 20, 30, 22, 1, 29, 150, 7926 }, // б
-    { 17, 21, 21, 3, 21, 90, 8076 }, // в
-    { 13, 21, 16, 3, 21, 69, 8166 }, // г
-    { 23, 27, 23, 0, 21, 156, 8235 }, // д
-    { 18, 22, 21, 1, 21, 99, 8391 }, // е
-    { 29, 21, 28, 0, 21, 153, 8490 }, // ж
-    { 16, 22, 18, 1, 21, 88, 8643 }, // з
-    { 18, 21, 23, 3, 21, 95, 8731 }, // и
-    { 18, 28, 23, 3, 28, 126, 8826 }, // й
-    { 17, 21, 20, 3, 21, 90, 8952 }, // к
-    { 19, 22, 22, 0, 21, 105, 9042 }, // л
-    { 23, 21, 29, 3, 21, 121, 9147 }, // м
-    { 17, 21, 23, 3, 21, 90, 9268 }, // н
-    { 20, 22, 22, 1, 21, 110, 9358 }, // о
-    { 17, 21, 23, 3, 21, 90, 9468 }, // п
-    { 18, 30, 23, 3, 21, 135, 9558 }, // р
-    { 16, 22, 18, 1, 21, 88, 9693 }, // с
-    { 17, 21, 17, 0, 21, 90, 9781 }, // т
-    { 20, 30, 19, 0, 21, 150, 9871 }, // у
-    { 25, 38, 28, 1, 29, 238, 10021 }, // ф
-    { 19, 21, 19, 0, 21, 100, 10259 }, // х
-    { 20, 27, 23, 3, 21, 135, 10359 }, // ц
-    { 17, 21, 22, 2, 21, 90, 10494 }, // ч
-    { 28, 21, 34, 3, 21, 147, 10584 }, // ш
-    { 31, 27, 34, 3, 21, 210, 10731 }, // щ
-    { 22, 21, 23, 0, 21, 116, 10941 }, // ъ
-    { 23, 21, 28, 3, 21, 121, 11057 }, // ы
-    { 16, 21, 20, 3, 21, 84, 11178 }, // ь
-    { 16, 22, 19, 1, 21, 88, 11262 }, // э
-    { 26, 22, 30, 3, 21, 143, 11350 }, // ю
-    { 18, 21, 22, 1, 21, 95, 11493 }, // я
-    { 18, 30, 21, 1, 29, 135, 11588 }, // ѐ
-    { 18, 29, 21, 1, 28, 131, 11723 }, // ё
-    { 21, 38, 23, 0, 29, 200, 11854 }, // ђ
-    { 13, 29, 16, 3, 29, 95, 12054 }, // ѓ
-    { 16, 22, 18, 1, 21, 88, 12149 }, // є
-    { 15, 22, 18, 1, 21, 83, 12237 }, // ѕ
-    { 5, 28, 10, 2, 28, 35, 12320 }, // і
-    { 9, 28, 10, 0, 28, 63, 12355 }, // ї
-    { 10, 37, 10, -3, 28, 93, 12418 }, // ј
-    { 31, 22, 32, 0, 21, 171, 12511 }, // љ
-    { 29, 21, 33, 3, 21, 153, 12682 }, // њ
-    { 21, 29, 23, 0, 29, 153, 12835 }, // ћ
-    { 17, 29, 20, 3, 29, 124, 12988 }, // ќ
-    { 18, 29, 23, 3, 29, 131, 13112 }, // ѝ
-    { 20, 37, 19, 0, 28, 185, 13243 }, // ў
-    { 17, 27, 23, 3, 21, 115, 13428 }, // џ
-    { 34, 28, 34, 0, 27, 238, 13543 }, // Ѡ
-    { 29, 21, 30, 0, 21, 153, 13781 }, // ѡ
-    { 24, 27, 25, 0, 27, 162, 13934 }, // Ѣ
-    { 22, 25, 24, 0, 25, 138, 14096 }, // ѣ
-    { 31, 29, 35, 3, 28, 225, 14234 }, // Ѥ
-    { 24, 22, 28, 3, 21, 132, 14459 }, // ѥ
-    { 26, 27, 26, 0, 27, 176, 14591 }, // Ѧ
-    { 22, 21, 21, 0, 21, 116, 14767 }, // ѧ
-    { 32, 27, 35, 3, 27, 216, 14883 }, // Ѩ
-    { 27, 21, 29, 3, 21, 142, 15099 }, // ѩ
-    { 27, 27, 27, 0, 27, 183, 15241 }, // Ѫ
-    { 24, 21, 24, 0, 21, 126, 15424 }, // ѫ
-    { 34, 27, 37, 3, 27, 230, 15550 }, // Ѭ
-    { 29, 21, 32, 3, 21, 153, 15780 }, // ѭ
-    { 19, 41, 22, 1, 32, 195, 15933 }, // Ѯ
-    { 17, 33, 18, 0, 25, 141, 16128 }, // ѯ
-    { 25, 27, 30, 3, 27, 169, 16269 }, // Ѱ
-    { 24, 38, 29, 2, 29, 228, 16438 }, // ѱ
-    { 25, 29, 29, 2, 28, 182, 16666 }, // Ѳ
-    { 19, 22, 23, 2, 21, 105, 16848 }, // ѳ
-    { 25, 27, 24, 0, 27, 169, 16953 }, // Ѵ
-    { 21, 21, 19, 0, 21, 111, 17122 }, // ѵ
-    { 25, 36, 24, 0, 36, 225, 17233 }, // Ѷ
-    { 21, 29, 19, 0, 29, 153, 17458 }, // ѷ
-    { 44, 37, 46, 2, 28, 407, 17611 }, // Ѹ
-    { 40, 30, 41, 2, 21, 300, 18018 }, // ѹ
-    { 27, 32, 31, 2, 29, 216, 18318 }, // Ѻ
-    { 21, 25, 25, 2, 23, 132, 18534 }, // ѻ
-    { 35, 40, 38, 2, 39, 350, 18666 }, // Ѽ
-    { 30, 35, 34, 2, 34, 263, 19016 }, // ѽ
-    { 34, 35, 34, 0, 34, 298, 19279 }, // Ѿ
-    { 29, 27, 30, 0, 27, 196, 19577 }, // ѿ
-    { 22, 37, 24, 2, 28, 204, 19773 }, // Ҁ
-    { 16, 30, 18, 2, 21, 120, 19977 }, // ҁ
-    { 20, 25, 23, 1, 24, 125, 20097 }, // ҂
-    { 15, 6, 0, -18, 27, 23, 20222 }, // ҃
-    { 15, 6, 0, -18, 28, 23, 20245 }, // ҄
-    { 5, 8, 0, -13, 30, 10, 20268 }, // ҅
-    { 5, 8, 0, -13, 30, 10, 20278 }, // ҆
-    { 14, 6, 0, -7, 34, 21, 20288 }, // ҇
-    { 44, 40, 0, -22, 30, 440, 20309 }, // ҈
-    { 42, 42, 0, -21, 31, 441, 20749 }, // ҉
-    { 26, 43, 29, 3, 35, 280, 21190 }, // Ҋ
-    { 22, 36, 25, 3, 29, 198, 21470 }, // ҋ
-    { 22, 27, 23, 0, 27, 149, 21668 }, // Ҍ
-    { 21, 29, 22, 0, 29, 153, 21817 }, // ҍ
-    { 19, 27, 23, 3, 27, 129, 21970 }, // Ҏ
-    { 18, 30, 23, 3, 21, 135, 22099 }, // ҏ
-    { 17, 33, 20, 3, 33, 141, 22234 }, // Ґ
-    { 13, 26, 16, 3, 26, 85, 22375 }, // ґ
-    { 20, 27, 20, 0, 27, 135, 22460 }, // Ғ
-    { 16, 21, 16, 0, 21, 84, 22595 }, // ғ
-    { 21, 37, 24, 3, 27, 195, 22679 }, // Ҕ
-    { 16, 31, 20, 3, 21, 124, 22874 }, // ҕ
-    { 34, 35, 34, 0, 27, 298, 22998 }, // Җ
-    { 30, 28, 30, 0, 21, 210, 23296 }, // җ
-    { 19, 37, 22, 1, 28, 176, 23506 }, // Ҙ
-    { 16, 30, 18, 1, 21, 120, 23682 }, // ҙ
-    { 22, 35, 25, 3, 27, 193, 23802 }, // Қ
-    { 18, 28, 21, 3, 21, 126, 23995 }, // қ
-    { 21, 27, 23, 3, 27, 142, 24121 }, // Ҝ
-    { 17, 21, 20, 3, 21, 90, 24263 }, // ҝ
-    { 24, 27, 23, 0, 27, 162, 24353 }, // Ҟ
-    { 20, 29, 20, 0, 29, 145, 24515 }, // ҟ
-    { 26, 27, 26, 0, 27, 176, 24660 }, // Ҡ
-    { 24, 21, 23, 0, 21, 126, 24836 }, // ҡ
-    { 25, 35, 28, 3, 27, 219, 24962 }, // Ң
-    { 21, 28, 25, 3, 21, 147, 25181 }, // ң
-    { 28, 27, 31, 3, 27, 189, 25328 }, // Ҥ
-    { 25, 21, 28, 3, 21, 132, 25517 }, // ҥ
-    { 36, 37, 40, 3, 27, 333, 25649 }, // Ҧ
-    { 29, 31, 32, 3, 21, 225, 25982 }, // ҧ
-    { 26, 30, 29, 2, 28, 195, 26207 }, // Ҩ
-    { 21, 23, 24, 2, 21, 121, 26402 }, // ҩ
-    { 21, 37, 24, 2, 28, 195, 26523 }, // Ҫ
-    { 15, 30, 18, 2, 21, 113, 26718 }, // ҫ
-    { 21, 35, 21, 0, 27, 184, 26831 }, // Ҭ
-    { 18, 28, 18, 0, 21, 126, 27015 }, // ҭ
-    { 22, 27, 21, 0, 27, 149, 27141 }, // Ү
-    { 20, 30, 19, 0, 21, 150, 27290 }, // ү
-    { 22, 27, 21, 0, 27, 149, 27440 }, // Ұ
-    { 20, 30, 19, 0, 21, 150, 27589 }, // ұ
-    { 24, 35, 24, 0, 27, 210, 27739 }, // Ҳ
-    { 21, 28, 21, 0, 21, 147, 27949 }, // ҳ
-    { 32, 35, 32, 0, 27, 280, 28096 }, // Ҵ
-    { 27, 28, 27, 0, 21, 189, 28376 }, // ҵ
-    { 23, 35, 26, 3, 27, 202, 28565 }, // Ҷ
-    { 21, 28, 23, 2, 21, 147, 28767 }, // ҷ
-    { 20, 27, 26, 3, 27, 135, 28914 }, // Ҹ
-    { 18, 21, 23, 2, 21, 95, 29049 }, // ҹ
-    { 21, 27, 26, 3, 27, 142, 29144 }, // Һ
-    { 18, 29, 23, 3, 29, 131, 29286 }, // һ
-    { 29, 29, 32, 1, 28, 211, 29417 }, // Ҽ
-    { 24, 22, 25, 0, 21, 132, 29628 }, // ҽ
-    { 29, 36, 32, 1, 28, 261, 29760 }, // Ҿ
-    { 24, 28, 25, 0, 21, 168, 30021 }, // ҿ
-    { 11, 27, 13, 1, 27, 75, 30189 }, // Ӏ
-    { 34, 34, 34, 0, 34, 289, 30264 }, // Ӂ
-    { 29, 28, 28, 0, 28, 203, 30553 }, // ӂ
-    { 22, 37, 26, 3, 27, 204, 30756 }, // Ӄ
-    { 17, 31, 21, 3, 21, 132, 30960 }, // ӄ
-    { 27, 35, 27, 0, 27, 237, 31092 }, // Ӆ
-    { 22, 28, 22, 0, 21, 154, 31329 }, // ӆ
-    { 22, 37, 27, 3, 27, 204, 31483 }, // Ӈ
-    { 18, 31, 23, 3, 21, 140, 31687 }, // ӈ
-    { 25, 35, 28, 3, 27, 219, 31827 }, // Ӊ
-    { 22, 28, 25, 3, 21, 154, 32046 }, // ӊ
-    { 20, 35, 26, 3, 27, 175, 32200 }, // Ӌ
-    { 18, 28, 23, 2, 21, 126, 32375 }, // ӌ
-    { 32, 35, 34, 3, 27, 280, 32501 }, // Ӎ
-    { 26, 28, 28, 3, 21, 182, 32781 }, // ӎ
-    { 11, 27, 13, 1, 27, 75, 32963 }, // ӏ
-    { 24, 34, 24, 0, 34, 204, 33038 }, // Ӑ
-    { 17, 29, 21, 1, 28, 124, 33242 }, // ӑ
-    { 24, 35, 24, 0, 35, 210, 33366 }, // Ӓ
-    { 17, 29, 21, 1, 28, 124, 33576 }, // ӓ
-    { 32, 27, 33, -1, 27, 216, 33700 }, // Ӕ
-    { 30, 22, 32, 1, 21, 165, 33916 }, // ӕ
-    { 16, 34, 21, 3, 34, 136, 34081 }, // Ӗ
-    { 18, 29, 21, 2, 28, 131, 34217 }, // ӗ
-    { 24, 29, 28, 2, 28, 174, 34348 }, // Ә
-    { 19, 22, 21, 1, 21, 105, 34522 }, // ә
-    { 24, 36, 28, 2, 35, 216, 34627 }, // Ӛ
-    { 19, 29, 21, 1, 28, 138, 34843 }, // ӛ
-    { 34, 35, 34, 0, 35, 298, 34981 }, // Ӝ
-    { 29, 28, 28, 0, 28, 203, 35279 }, // ӝ
-    { 19, 36, 22, 1, 35, 171, 35482 }, // Ӟ
-    { 16, 29, 18, 1, 28, 116, 35653 }, // ӟ
-    { 19, 28, 22, 1, 27, 133, 35769 }, // Ӡ
-    { 18, 30, 19, 0, 21, 135, 35902 }, // ӡ
-    { 22, 33, 28, 3, 33, 182, 36037 }, // Ӣ
-    { 18, 26, 23, 3, 26, 117, 36219 }, // ӣ
-    { 22, 35, 28, 3, 35, 193, 36336 }, // Ӥ
-    { 18, 28, 23, 3, 28, 126, 36529 }, // ӥ
-    { 25, 36, 29, 2, 35, 225, 36655 }, // Ӧ
-    { 19, 29, 23, 2, 28, 138, 36880 }, // ӧ
-    { 25, 29, 29, 2, 28, 182, 37018 }, // Ө
-    { 19, 22, 23, 2, 21, 105, 37200 }, // ө
-    { 25, 35, 29, 2, 34, 219, 37305 }, // Ӫ
-    { 19, 29, 23, 2, 28, 138, 37524 }, // ӫ
-    { 22, 36, 24, 1, 35, 198, 37662 }, // Ӭ
-    { 16, 29, 19, 1, 28, 116, 37860 }, // ӭ
-    { 24, 34, 23, 0, 33, 204, 37976 }, // Ӯ
-    { 20, 35, 19, 0, 26, 175, 38180 }, // ӯ
-    { 24, 36, 23, 0, 35, 216, 38355 }, // Ӱ
-    { 20, 37, 19, 0, 28, 185, 38571 }, // ӱ
-    { 24, 37, 23, 0, 36, 222, 38756 }, // Ӳ
-    { 20, 38, 19, 0, 29, 190, 38978 }, // ӳ
-    { 20, 35, 25, 2, 35, 175, 39168 }, // Ӵ
-    { 17, 28, 22, 2, 28, 119, 39343 }, // ӵ
-    { 17, 35, 20, 3, 27, 149, 39462 }, // Ӷ
-    { 13, 28, 16, 3, 21, 91, 39611 }, // ӷ
-    { 26, 35, 32, 3, 35, 228, 39702 }, // Ӹ
-    { 23, 28, 28, 3, 28, 161, 39930 }, // ӹ
-    { 20, 35, 20, 0, 27, 175, 40091 }, // Ӻ
-    { 16, 29, 16, 0, 21, 116, 40266 }, // ӻ
-    { 23, 35, 24, 0, 27, 202, 40382 }, // Ӽ
-    { 21, 29, 21, 0, 21, 153, 40584 }, // ӽ
-    { 22, 27, 22, 0, 27, 149, 40737 }, // Ӿ
-    { 20, 21, 20, 0, 21, 105, 40886 }, // ӿ
-    { 0, 0, 19, 0, 0, 0, 0 }, //  
-    { 0, 0, 38, 0, 0, 0, 0 }, //  
-    { 0, 0, 19, 0, 0, 0, 0 }, //  
-    { 0, 0, 38, 0, 0, 0, 0 }, //  
-    { 0, 0, 12, 0, 0, 0, 0 }, //  
-    { 0, 0, 9, 0, 0, 0, 0 }, //  
-    { 0, 0, 6, 0, 0, 0, 0 }, //  
-    { 0, 0, 21, 0, 0, 0, 0 }, //  
-    { 0, 0, 10, 0, 0, 0, 0 }, //  
-    { 0, 0, 6, 0, 0, 0, 0 }, //  
-    { 0, 0, 4, 0, 0, 0, 0 }, //  
-    { 0, 0, 0, 0, 0, 0, 0 }, // ​
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‍
-    { 9, 31, 0, -1, 26, 70, 0 }, // ‎
-    { 9, 31, 0, -8, 26, 70, 70 }, // ‏
-    { 10, 4, 12, 1, 12, 10, 140 }, // ‐
-    { 10, 4, 12, 1, 12, 10, 150 }, // ‑
-    { 19, 3, 21, 1, 15, 15, 160 }, // ‒
-    { 17, 4, 19, 1, 12, 17, 175 }, // –
-    { 35, 4, 38, 1, 12, 35, 192 }, // —
-    { 35, 4, 38, 1, 12, 35, 227 }, // ―
-    { 12, 39, 21, 4, 29, 117, 262 }, // ‖
-    { 17, 9, 15, -1, 0, 39, 379 }, // ‗
-    { 7, 10, 7, 0, 27, 18, 418 }, // ‘
-    { 7, 10, 7, 0, 27, 18, 436 }, // ’
-    { 6, 10, 9, 1, 5, 15, 454 }, // ‚
-    { 7, 10, 7, 0, 27, 18, 469 }, // ‛
-    { 14, 10, 13, 0, 27, 35, 487 }, // “
-    { 14, 10, 13, 0, 27, 35, 522 }, // ”
-    { 13, 10, 16, 1, 5, 33, 557 }, // „
-    { 14, 10, 13, 0, 27, 35, 590 }, // ‟
-    { 15, 29, 19, 2, 29, 109, 625 }, // †
-    { 15, 29, 19, 2, 29, 109, 734 }, // ‡
-    { 10, 10, 14, 2, 19, 25, 843 }, // •
-    { 11, 12, 14, 2, 20, 33, 868 }, // ‣
-    { 5, 6, 19, 7, 5, 8, 901 }, // ․
-    { 16, 6, 20, 2, 5, 24, 909 }, // ‥
-    { 25, 6, 30, 2, 5, 38, 933 }, // …
-    { 6, 6, 10, 2, 12, 9, 971 }, // ‧
-    { 0, 0, 23, 0, 0, 0, 980 }, //  
-    { 0, 0, 23, 0, 0, 0, 980 }, //  
-    { 9, 28, 0, -1, 23, 63, 980 }, // ‪
-    { 9, 28, 0, -8, 23, 63, 1043 }, // ‫
-    { 10, 31, 0, -5, 26, 78, 1106 }, // ‬
-    { 10, 31, 0, -5, 26, 78, 1184 }, // ‭
-    { 10, 31, 0, -5, 26, 78, 1262 }, // ‮
-    { 0, 0, 6, 0, 0, 0, 1340 }, //  
-    { 42, 29, 44, 1, 28, 305, 1340 }, // ‰
-    { 56, 29, 58, 1, 28, 406, 1645 }, // ‱
-    { 9, 10, 9, 1, 27, 23, 2051 }, // ′
-    { 16, 10, 15, 1, 27, 40, 2074 }, // ″
-    { 22, 10, 22, 1, 27, 55, 2114 }, // ‴
-    { 9, 10, 9, -1, 27, 23, 2169 }, // ‵
-    { 15, 10, 17, -1, 27, 38, 2192 }, // ‶
-    { 21, 10, 23, -1, 27, 53, 2230 }, // ‷
-    { 15, 13, 15, 0, 4, 49, 2283 }, // ‸
-    { 10, 16, 12, 1, 18, 40, 2332 }, // ‹
-    { 10, 16, 12, 1, 18, 40, 2372 }, // ›
-    { 29, 29, 31, 1, 28, 211, 2412 }, // ※
-    { 14, 28, 19, 2, 27, 98, 2623 }, // ‼
-    { 16, 29, 17, 0, 28, 116, 2721 }, // ‽
-    { 20, 3, 19, -1, 31, 15, 2837 }, // ‾
-    { 22, 8, 23, 0, -1, 44, 2852 }, // ‿
-    { 22, 9, 23, 0, 30, 50, 2896 }, // ⁀
-    { 14, 25, 14, 0, 16, 88, 2946 }, // ⁁
-    { 42, 35, 42, 0, 29, 368, 3034 }, // ⁂
-    { 10, 4, 12, 1, 12, 10, 3402 }, // ⁃
-    { 20, 27, 5, -8, 27, 135, 3412 }, // ⁄
-    { 10, 33, 12, 2, 27, 83, 3547 }, // ⁅
-    { 10, 33, 12, 0, 27, 83, 3630 }, // ⁆
-    { 32, 29, 32, 0, 28, 232, 3713 }, // ⁇
-    { 23, 29, 25, 0, 28, 167, 3945 }, // ⁈
-    { 23, 29, 26, 2, 28, 167, 4112 }, // ⁉
-    { 19, 21, 21, 1, 21, 100, 4279 }, // ⁊
-    { 20, 34, 25, 3, 29, 170, 4379 }, // ⁋
-    { 19, 20, 24, 2, 21, 95, 4549 }, // ⁌
-    { 19, 20, 24, 3, 21, 95, 4644 }, // ⁍
-    { 19, 18, 21, 1, 10, 86, 4739 }, // ⁎
-    { 7, 26, 9, 1, 21, 46, 4825 }, // ⁏
-    { 22, 39, 23, 0, 30, 215, 4871 }, // ⁐
-    { 19, 37, 21, 1, 29, 176, 5086 }, // ⁑
-    { 14, 29, 14, 0, 28, 102, 5262 }, // ⁒
-    { 33, 6, 38, 2, 14, 50, 5364 }, // ⁓
-    { 22, 9, 23, 0, 0, 50, 5414 }, // ⁔
-    { 20, 20, 21, 1, 19, 100, 5464 }, // ⁕
-    { 17, 29, 19, 1, 28, 124, 5564 }, // ⁖
-    { 28, 10, 28, 1, 27, 70, 5688 }, // ⁗
-    { 28, 29, 31, 1, 28, 203, 5758 }, // ⁘
-    { 29, 29, 31, 1, 28, 211, 5961 }, // ⁙
-    { 6, 29, 8, 1, 28, 44, 6172 }, // ⁚
-    { 22, 30, 25, 1, 29, 165, 6216 }, // ⁛
-    { 28, 29, 30, 1, 28, 203, 6381 }, // ⁜
-    { 6, 28, 10, 2, 27, 42, 6584 }, // ⁝
-    { 6, 29, 10, 2, 28, 44, 6626 }, // ⁞
-    { 0, 0, 8, 0, 0, 0, 6670 }, //  
-    { 0, 0, 23, 0, 0, 0, 6670 }, // ⁠
-    { 0, 0, 23, 0, 0, 0, 6670 }, // ⁡
-    { 0, 0, 23, 0, 0, 0, 6670 }, // ⁢
-    { 0, 0, 23, 0, 0, 0, 6670 }, // ⁣
-    { 0, 0, 23, 0, 0, 0, 6670 }, // ⁤
-    { 0, 0, 0, 0, 0, 0, 6670 }, // ⁦
-    { 0, 0, 0, 0, 0, 0, 6670 }, // ⁧
-    { 0, 0, 0, 0, 0, 0, 6670 }, // ⁨
-    { 0, 0, 0, 0, 0, 0, 6670 }, // ⁩
-    { 10, 31, 0, -5, 26, 78, 6670 }, // ⁪
-    { 10, 31, 0, -5, 26, 78, 6748 }, // ⁫
-    { 10, 31, 0, -5, 26, 78, 6826 }, // ⁬
-    { 10, 31, 0, -5, 26, 78, 6904 }, // ⁭
-    { 10, 31, 0, -5, 26, 78, 6982 }, // ⁮
-    { 10, 31, 0, -5, 26, 78, 7060 }, // ⁯
-    { 13, 17, 13, 0, 32, 56, 0 }, // ⁰
-    { 4, 18, 6, 1, 28, 18, 56 }, // ⁱ
-    { 13, 17, 13, 0, 32, 56, 74 }, // ⁴
-    { 11, 17, 13, 1, 32, 47, 130 }, // ⁵
-    { 13, 17, 13, 0, 32, 56, 177 }, // ⁶
-    { 12, 17, 13, 1, 32, 51, 233 }, // ⁷
-    { 13, 17, 13, 0, 32, 56, 284 }, // ⁸
-    { 13, 18, 13, 0, 33, 59, 340 }, // ⁹
-    { 11, 11, 13, 1, 28, 31, 399 }, // ⁺
-    { 11, 3, 13, 1, 24, 9, 430 }, // ⁻
-    { 11, 7, 13, 1, 26, 20, 439 }, // ⁼
-    { 7, 22, 8, 2, 35, 39, 459 }, // ⁽
-    { 7, 22, 8, 0, 35, 39, 498 }, // ⁾
-    { 12, 14, 15, 2, 24, 42, 537 }, // ⁿ
-    { 13, 17, 13, 0, 12, 56, 579 }, // ₀
-    { 8, 17, 13, 1, 12, 34, 635 }, // ₁
-    { 12, 17, 13, 0, 12, 51, 669 }, // ₂
-    { 13, 17, 13, 0, 12, 56, 720 }, // ₃
-    { 13, 17, 13, 0, 12, 56, 776 }, // ₄
-    { 11, 17, 13, 1, 12, 47, 832 }, // ₅
-    { 13, 17, 13, 0, 12, 56, 879 }, // ₆
-    { 12, 17, 13, 1, 12, 51, 935 }, // ₇
-    { 13, 17, 13, 0, 12, 56, 986 }, // ₈
-    { 13, 18, 13, 0, 13, 59, 1042 }, // ₉
-    { 11, 11, 13, 1, 8, 31, 1101 }, // ₊
-    { 11, 3, 13, 1, 4, 9, 1132 }, // ₋
-    { 11, 7, 13, 1, 6, 20, 1141 }, // ₌
-    { 7, 22, 8, 2, 14, 39, 1161 }, // ₍
-    { 7, 22, 8, 0, 14, 39, 1200 }, // ₎
-    { 11, 13, 14, 1, 9, 36, 1239 }, // ₐ
-    { 12, 13, 14, 1, 9, 39, 1275 }, // ₑ
-    { 13, 13, 15, 1, 9, 43, 1314 }, // ₒ
-    { 13, 13, 13, 0, 9, 43, 1357 }, // ₓ
-    { 12, 13, 14, 1, 9, 39, 1400 }, // ₔ
-    { 12, 18, 15, 2, 14, 54, 1439 }, // ₕ
-    { 11, 18, 13, 2, 14, 50, 1493 }, // ₖ
-    { 3, 18, 6, 2, 14, 14, 1543 }, // ₗ
-    { 19, 13, 23, 2, 9, 62, 1557 }, // ₘ
-    { 12, 13, 15, 2, 9, 39, 1619 }, // ₙ
-    { 12, 18, 15, 2, 9, 54, 1658 }, // ₚ
-    { 10, 13, 12, 1, 9, 33, 1712 }, // ₛ
-    { 9, 16, 9, 0, 12, 36, 1745 }, // ₜ
-    { 20, 28, 21, 1, 28, 140, 0 }, // ₠
-    { 20, 32, 21, 1, 29, 160, 140 }, // ₡
-    { 19, 29, 21, 2, 28, 138, 300 }, // ₢
-    { 19, 27, 21, 1, 27, 129, 438 }, // ₣
-    { 20, 28, 21, 1, 28, 140, 567 }, // ₤
-    { 30, 30, 35, 3, 25, 225, 707 }, // ₥
-    { 22, 27, 21, 0, 27, 149, 932 }, // ₦
-    { 26, 28, 29, 2, 27, 182, 1081 }, // ₧
-    { 27, 28, 31, 3, 27, 189, 1263 }, // ₨
-    { 25, 27, 25, 0, 27, 169, 1452 }, // ₩
-    { 24, 27, 30, 3, 27, 162, 1621 }, // ₪
-    { 21, 35, 23, 2, 29, 184, 1783 }, // ₫
-    { 21, 29, 21, 0, 28, 153, 1967 }, // €
-    { 22, 27, 21, 0, 27, 149, 2120 }, // ₭
-    { 21, 27, 21, 0, 27, 142, 2269 }, // ₮
-    { 36, 37, 36, 0, 28, 333, 2411 }, // ₯
-    { 20, 37, 21, 0, 28, 185, 2744 }, // ₰
-    { 22, 27, 21, 0, 27, 149, 2929 }, // ₱
-    { 23, 32, 27, 2, 29, 184, 3078 }, // ₲
-    { 23, 27, 23, 0, 27, 156, 3262 }, // ₳
-    { 21, 29, 21, 0, 28, 153, 3418 }, // ₴
-    { 21, 32, 24, 2, 29, 168, 3571 }, // ₵
-    { 23, 26, 23, 0, 25, 150, 3739 }, // ₶
-    { 26, 31, 27, 0, 28, 202, 3889 }, // ₷
-    { 20, 27, 20, 0, 27, 135, 4091 }, // ₸
-    { 17, 27, 21, 2, 27, 115, 4226 }, // ₹
-    { 21, 28, 21, 0, 27, 147, 4341 }, // ₺
-    { 29, 29, 29, 0, 28, 211, 4488 }, // ₻
-    { 26, 27, 30, 2, 27, 176, 4699 }, // ₼
-    { 21, 27, 22, 0, 27, 142, 4875 }, // ₽
-    { 25, 29, 29, 2, 29, 182, 5017 }, // ₾
-    { 18, 35, 21, 3, 31, 158, 5199 }, // ₿
-    { 16, 27, 18, 1, 21, 108, 5357 }, // ⃀
-    { 19, 4, 21, 1, 15, 19, 0 }, // −
-    { 35, 35, 38, 1, 29, 307, 0 }, // �
+    { 17, 16, 19, 1, 18, 68, 10414 }, // «
+    { 19, 11, 21, 1, 15, 53, 938 }, // ¬
+    { 10, 4, 12, 1, 12, 10, 991 }, // ­
+    { 29, 29, 31, 1, 28, 211, 1001 }, // ®
+    { 20, 3, 19, -1, 31, 15, 1212 }, // ¯
+    { 12, 13, 16, 2, 28, 39, 1227 }, // °
+    { 19, 23, 21, 1, 23, 110, 1266 }, // ±
+    { 12, 17, 13, 0, 32, 51, 1376 }, // ²
+    { 13, 17, 13, 0, 32, 56, 1427 }, // ³
+    { 9, 7, 11, 1, 29, 16, 1483 }, // ´
+    { 18, 30, 23, 3, 21, 135, 1499 }, // µ
+    { 19, 34, 25, 2, 29, 162, 1634 }, // ¶
+    { 6, 6, 10, 2, 16, 9, 1796 }, // ·
+    { 8, 9, 8, 0, 0, 18, 1805 }, // ¸
+    { 8, 17, 13, 1, 32, 34, 1823 }, // ¹
+    { 12, 14, 14, 1, 28, 42, 1857 }, // º
+    { 17, 16, 19, 1, 18, 68, 10482 }, // »
+    { 27, 27, 28, 1, 27, 183, 1899 }, // ¼
+    { 28, 27, 29, 0, 27, 189, 2082 }, // ½
+    { 29, 28, 29, 0, 28, 203, 2271 }, // ¾
+    { 16, 29, 16, 0, 21, 116, 2474 }, // ¿
+    { 24, 36, 24, 0, 36, 216, 10550 }, // À
+    { 24, 36, 24, 0, 36, 216, 10766 }, // Á
+    { 24, 36, 24, 0, 36, 216, 10982 }, // Â
+    { 24, 35, 24, 0, 35, 210, 2590 }, // Ã
+    { 24, 35, 24, 0, 35, 210, 11198 }, // Ä
+    { 24, 33, 24, 0, 33, 198, 2800 }, // Å
+    { 32, 27, 33, -1, 27, 216, 2998 }, // Æ
+    { 21, 37, 24, 2, 28, 195, 11408 }, // Ç
+    { 16, 36, 21, 3, 36, 144, 11603 }, // È
+    { 16, 36, 21, 3, 36, 144, 11747 }, // É
+    { 16, 36, 21, 3, 36, 144, 11891 }, // Ê
+    { 16, 35, 21, 3, 35, 140, 12035 }, // Ë
+    { 11, 36, 13, 1, 36, 99, 12175 }, // Ì
+    { 11, 36, 13, 1, 36, 99, 12274 }, // Í
+    { 13, 36, 13, 0, 36, 117, 12373 }, // Î
+    { 11, 35, 13, 1, 35, 97, 12490 }, // Ï
+    { 25, 27, 27, 1, 27, 169, 3214 }, // Ð
+    { 22, 35, 29, 3, 35, 193, 12587 }, // Ñ
+    { 25, 37, 29, 2, 36, 232, 12780 }, // Ò
+    { 25, 37, 29, 2, 36, 232, 13012 }, // Ó
+    { 25, 37, 29, 2, 36, 232, 13244 }, // Ô
+    { 25, 36, 29, 2, 35, 225, 3383 }, // Õ
+    { 25, 36, 29, 2, 35, 225, 13476 }, // Ö
+    { 17, 18, 21, 2, 22, 77, 3608 }, // ×
+    { 25, 30, 29, 2, 28, 188, 3685 }, // Ø
+    { 21, 37, 27, 3, 36, 195, 13701 }, // Ù
+    { 21, 37, 27, 3, 36, 195, 13896 }, // Ú
+    { 21, 37, 27, 3, 36, 195, 14091 }, // Û
+    { 21, 36, 27, 3, 35, 189, 14286 }, // Ü
+    { 22, 36, 21, 0, 36, 198, 3873 }, // Ý
+    { 18, 27, 23, 3, 27, 122, 4071 }, // Þ
+    { 19, 30, 24, 3, 29, 143, 4193 }, // ß
+    { 17, 30, 21, 1, 29, 128, 14475 }, // à
+    { 17, 30, 21, 1, 29, 128, 14603 }, // á
+    { 17, 30, 21, 1, 29, 128, 14731 }, // â
+    { 17, 29, 21, 1, 28, 124, 4336 }, // ã
+    { 17, 29, 21, 1, 28, 124, 14859 }, // ä
+    { 17, 32, 21, 1, 31, 136, 4460 }, // å
+    { 30, 22, 32, 1, 21, 165, 4596 }, // æ
+    { 15, 30, 18, 2, 21, 113, 14983 }, // ç
+    { 18, 30, 21, 2, 29, 135, 15096 }, // è
+    { 18, 30, 21, 2, 29, 135, 15231 }, // é
+    { 18, 30, 21, 2, 29, 135, 15366 }, // ê
+    { 18, 29, 21, 2, 28, 131, 15501 }, // ë
+    { 9, 29, 10, -1, 29, 66, 15632 }, // ì
+    { 9, 29, 10, 2, 29, 66, 15698 }, // í
+    { 14, 29, 10, -2, 29, 102, 15764 }, // î
+    { 12, 28, 10, -1, 28, 84, 15866 }, // ï
+    { 19, 30, 23, 2, 29, 143, 4761 }, // ð
+    { 18, 28, 23, 3, 28, 126, 15950 }, // ñ
+    { 19, 30, 23, 2, 29, 143, 16076 }, // ò
+    { 19, 30, 23, 2, 29, 143, 16219 }, // ó
+    { 19, 30, 23, 2, 29, 143, 16362 }, // ô
+    { 19, 29, 23, 2, 28, 138, 4904 }, // õ
+    { 19, 29, 23, 2, 28, 138, 16505 }, // ö
+    { 19, 18, 21, 1, 22, 86, 5042 }, // ÷
+    { 19, 24, 23, 2, 22, 114, 5128 }, // ø
+    { 18, 30, 23, 2, 29, 135, 16643 }, // ù
+    { 18, 30, 23, 2, 29, 135, 16778 }, // ú
+    { 18, 30, 23, 2, 29, 135, 16913 }, // û
+    { 18, 29, 23, 2, 28, 131, 17048 }, // ü
+    { 20, 38, 19, 0, 29, 190, 5242 }, // ý
+    { 18, 38, 23, 3, 29, 171, 5432 }, // þ
+    { 20, 37, 19, 0, 28, 185, 5603 }, // ÿ
+    { 24, 33, 24, 0, 33, 198, 5788 }, // Ā
+    { 17, 27, 21, 1, 26, 115, 5986 }, // ā
+    { 24, 35, 24, 0, 35, 210, 6101 }, // Ă
+    { 17, 29, 21, 1, 28, 124, 6311 }, // ă
+    { 24, 36, 24, 0, 27, 216, 6435 }, // Ą
+    { 18, 30, 21, 1, 21, 135, 6651 }, // ą
+    { 21, 37, 24, 2, 36, 195, 6786 }, // Ć
+    { 15, 30, 18, 2, 29, 113, 6981 }, // ć
+    { 21, 37, 24, 2, 36, 195, 7094 }, // Ĉ
+    { 15, 30, 18, 2, 29, 113, 7289 }, // ĉ
+    { 21, 36, 24, 2, 35, 189, 7402 }, // Ċ
+    { 15, 29, 18, 2, 28, 109, 7591 }, // ċ
+    { 21, 37, 24, 2, 36, 195, 7700 }, // Č
+    { 15, 30, 18, 2, 29, 113, 7895 }, // č
+    { 23, 36, 27, 3, 36, 207, 8008 }, // Ď
+    { 24, 30, 23, 2, 29, 180, 8215 }, // ď
+    { 25, 27, 27, 1, 27, 169, 8395 }, // Đ
+    { 21, 30, 23, 2, 29, 158, 8564 }, // đ
+    { 16, 33, 21, 3, 33, 132, 8722 }, // Ē
+    { 18, 27, 21, 2, 26, 122, 8854 }, // ē
+    { 16, 35, 21, 3, 35, 140, 8976 }, // Ĕ
+    { 18, 29, 21, 2, 28, 131, 9116 }, // ĕ
+    { 16, 35, 21, 3, 35, 140, 9247 }, // Ė
+    { 18, 29, 21, 2, 28, 131, 9387 }, // ė
+    { 16, 36, 21, 3, 27, 144, 9518 }, // Ę
+    { 18, 30, 21, 2, 21, 135, 9662 }, // ę
+    { 16, 36, 21, 3, 36, 144, 9797 }, // Ě
+    { 18, 30, 21, 2, 29, 135, 9941 }, // ě
+    { 23, 37, 27, 2, 36, 213, 10076 }, // Ĝ
+    { 18, 38, 23, 2, 29, 171, 10289 }, // ĝ
+    { 23, 36, 27, 2, 35, 207, 10460 }, // Ğ
+    { 18, 37, 23, 2, 28, 167, 10667 }, // ğ
+    { 23, 36, 27, 2, 35, 207, 10834 }, // Ġ
+    { 18, 37, 23, 2, 28, 167, 11041 }, // ġ
+    { 23, 37, 27, 2, 28, 213, 11208 }, // Ģ
+    { 18, 38, 23, 2, 29, 171, 11421 }, // ģ
+    { 22, 36, 28, 3, 36, 198, 11592 }, // Ĥ
+    { 23, 37, 23, -2, 37, 213, 11790 }, // ĥ
+    { 28, 27, 28, 0, 27, 189, 12003 }, // Ħ
+    { 21, 29, 23, 0, 29, 153, 12192 }, // ħ
+    { 15, 35, 13, -1, 35, 132, 12345 }, // Ĩ
+    { 15, 28, 10, -3, 28, 105, 12477 }, // ĩ
+    { 12, 33, 13, 0, 33, 99, 12582 }, // Ī
+    { 12, 26, 10, -1, 26, 78, 12681 }, // ī
+    { 13, 35, 13, 0, 35, 114, 12759 }, // Ĭ
+    { 13, 28, 10, -2, 28, 91, 12873 }, // ĭ
+    { 11, 36, 13, 1, 27, 99, 12964 }, // Į
+    { 7, 37, 10, 1, 28, 65, 13063 }, // į
+    { 11, 35, 13, 1, 35, 97, 13128 }, // İ
+    { 4, 21, 10, 3, 21, 21, 13225 }, // ı
+    { 19, 35, 23, 1, 27, 167, 13246 }, // Ĳ
+    { 15, 37, 19, 2, 28, 139, 13413 }, // ĳ
+    { 15, 44, 10, -3, 36, 165, 13552 }, // Ĵ
+    { 15, 38, 10, -3, 29, 143, 13717 }, // ĵ
+    { 21, 36, 23, 3, 27, 189, 13860 }, // Ķ
+    { 17, 38, 20, 3, 29, 162, 14049 }, // ķ
+    { 17, 21, 20, 3, 21, 90, 14211 }, // ĸ
+    { 16, 36, 20, 3, 36, 144, 14301 }, // Ĺ
+    { 9, 37, 10, 2, 37, 84, 14445 }, // ĺ
+    { 16, 36, 20, 3, 27, 144, 14529 }, // Ļ
+    { 6, 38, 10, 2, 29, 57, 14673 }, // ļ
+    { 16, 27, 20, 3, 27, 108, 14730 }, // Ľ
+    { 10, 29, 10, 3, 29, 73, 14838 }, // ľ
+    { 16, 27, 20, 3, 27, 108, 14911 }, // Ŀ
+    { 9, 29, 10, 3, 29, 66, 15019 }, // ŀ
+    { 19, 27, 20, 0, 27, 129, 15085 }, // Ł
+    { 12, 29, 10, -1, 29, 87, 15214 }, // ł
+    { 22, 36, 29, 3, 36, 198, 15301 }, // Ń
+    { 18, 29, 23, 3, 29, 131, 15499 }, // ń
+    { 22, 36, 29, 3, 27, 198, 15630 }, // Ņ
+    { 18, 30, 23, 3, 21, 135, 15828 }, // ņ
+    { 22, 36, 29, 3, 36, 198, 15963 }, // Ň
+    { 18, 29, 23, 3, 29, 131, 16161 }, // ň
+    { 23, 27, 26, 0, 27, 156, 16292 }, // ŉ
+    { 22, 35, 29, 3, 27, 193, 16448 }, // Ŋ
+    { 18, 30, 23, 3, 21, 135, 16641 }, // ŋ
+    { 25, 34, 29, 2, 33, 213, 16776 }, // Ō
+    { 19, 27, 23, 2, 26, 129, 16989 }, // ō
+    { 25, 36, 29, 2, 35, 225, 17118 }, // Ŏ
+    { 19, 29, 23, 2, 28, 138, 17343 }, // ŏ
+    { 25, 37, 29, 2, 36, 232, 17481 }, // Ő
+    { 19, 30, 23, 2, 29, 143, 17713 }, // ő
+    { 31, 29, 35, 2, 28, 225, 17179 }, // Œ
+    { 32, 22, 35, 2, 21, 176, 17404 }, // œ
+    { 20, 36, 23, 3, 36, 180, 17856 }, // Ŕ
+    { 12, 29, 15, 3, 29, 87, 18036 }, // ŕ
+    { 20, 36, 23, 3, 27, 180, 18123 }, // Ŗ
+    { 13, 30, 15, 2, 21, 98, 18303 }, // ŗ
+    { 20, 36, 23, 3, 36, 180, 18401 }, // Ř
+    { 14, 29, 15, 2, 29, 102, 18581 }, // ř
+    { 18, 37, 21, 1, 36, 167, 18683 }, // Ś
+    { 16, 30, 18, 1, 29, 120, 18850 }, // ś
+    { 18, 37, 21, 1, 36, 167, 18970 }, // Ŝ
+    { 16, 30, 18, 1, 29, 120, 19137 }, // ŝ
+    { 18, 37, 21, 1, 28, 167, 19257 }, // Ş
+    { 16, 30, 18, 1, 21, 120, 19424 }, // ş
+    { 18, 37, 21, 1, 36, 167, 19544 }, // Š
+    { 16, 30, 18, 1, 29, 120, 19711 }, // š
+    { 21, 36, 21, 0, 27, 189, 19831 }, // Ţ
+    { 13, 34, 14, 0, 25, 111, 20020 }, // ţ
+    { 21, 36, 21, 0, 36, 189, 20131 }, // Ť
+    { 18, 30, 14, 0, 29, 135, 20320 }, // ť
+    { 21, 27, 21, 0, 27, 142, 20455 }, // Ŧ
+    { 13, 26, 14, 0, 25, 85, 20597 }, // ŧ
+    { 21, 36, 27, 3, 35, 189, 20682 }, // Ũ
+    { 18, 29, 23, 2, 28, 131, 20871 }, // ũ
+    { 21, 34, 27, 3, 33, 179, 21002 }, // Ū
+    { 18, 27, 23, 2, 26, 122, 21181 }, // ū
+    { 21, 36, 27, 3, 35, 189, 21303 }, // Ŭ
+    { 18, 29, 23, 2, 28, 131, 21492 }, // ŭ
+    { 21, 39, 27, 3, 38, 205, 21623 }, // Ů
+    { 18, 32, 23, 2, 31, 144, 21828 }, // ů
+    { 21, 37, 27, 3, 36, 195, 21972 }, // Ű
+    { 18, 30, 23, 2, 29, 135, 22167 }, // ű
+    { 21, 36, 27, 3, 27, 189, 22302 }, // Ų
+    { 19, 30, 23, 2, 21, 143, 22491 }, // ų
+    { 35, 36, 35, 0, 36, 315, 22634 }, // Ŵ
+    { 30, 29, 29, 0, 29, 218, 22949 }, // ŵ
+    { 22, 36, 21, 0, 36, 198, 23167 }, // Ŷ
+    { 20, 38, 19, 0, 29, 190, 23365 }, // ŷ
+    { 22, 35, 21, 0, 35, 193, 23555 }, // Ÿ
+    { 19, 36, 21, 1, 36, 171, 23748 }, // Ź
+    { 16, 29, 18, 1, 29, 116, 23919 }, // ź
+    { 19, 35, 21, 1, 35, 167, 24035 }, // Ż
+    { 16, 28, 18, 1, 28, 112, 24202 }, // ż
+    { 19, 36, 21, 1, 36, 171, 24314 }, // Ž
+    { 16, 29, 18, 1, 29, 116, 24485 }, // ž
+    { 11, 29, 12, 3, 29, 80, 24601 }, // ſ
+    { 9, 7, 0, -19, 29, 16, 24681 }, // ̀
+    { 9, 7, 0, -13, 29, 16, 24697 }, // ́
+    { 14, 7, 0, -7, 29, 25, 24713 }, // ̂
+    { 15, 6, 0, -19, 28, 23, 24738 }, // ̃
+    { 12, 4, 0, -6, 26, 12, 24761 }, // ̄
+    { 16, 4, 0, -8, 32, 16, 24773 }, // ̅
+    { 12, 6, 0, -6, 28, 18, 24789 }, // ̆
+    { 4, 5, 0, -2, 28, 5, 24807 }, // ̇
+    { 12, 5, 0, -6, 28, 15, 24812 }, // ̈
+    { 7, 9, 0, -14, 31, 16, 24827 }, // ̉
+    { 10, 9, 0, -5, 31, 23, 24843 }, // ̊
+    { 14, 7, 0, -5, 29, 25, 24866 }, // ̋
+    { 14, 7, 0, -7, 29, 25, 24891 }, // ̌
+    { 4, 7, 0, -2, 29, 7, 24916 }, // ̍
+    { 10, 7, 0, -5, 29, 18, 24923 }, // ̎
+    { 15, 7, 0, -20, 29, 27, 24941 }, // ̏
+    { 12, 10, 0, -6, 32, 30, 24968 }, // ̐
+    { 12, 6, 0, -6, 28, 18, 24998 }, // ̑
+    { 6, 10, 0, -3, 27, 15, 25016 }, // ̒
+    { 6, 10, 0, -3, 27, 15, 25031 }, // ̓
+    { 6, 10, 0, -3, 27, 15, 25046 }, // ̔
+    { 6, 10, 0, -3, 27, 15, 25061 }, // ̕
+    { 8, 7, 0, -4, -1, 14, 25076 }, // ̖
+    { 8, 7, 0, -4, -1, 14, 25090 }, // ̗
+    { 8, 8, 0, -4, -1, 16, 25104 }, // ̘
+    { 8, 8, 0, -4, -1, 16, 25120 }, // ̙
+    { 11, 10, 12, 0, 29, 28, 25136 }, // ̚
+    { 9, 9, 0, -4, 29, 21, 25164 }, // ̛
+    { 5, 9, 0, -2, 0, 12, 25185 }, // ̜
+    { 8, 7, 0, -4, -1, 14, 25197 }, // ̝
+    { 8, 7, 0, -4, -1, 14, 25211 }, // ̞
+    { 8, 8, 0, -4, -1, 16, 25225 }, // ̟
+    { 10, 3, 0, -5, -3, 8, 25241 }, // ̠
+    { 7, 11, 0, -7, 2, 20, 25249 }, // ̡
+    { 7, 11, 0, 0, 2, 20, 25269 }, // ̢
+    { 5, 5, 0, -14, -2, 7, 25289 }, // ̣
+    { 12, 5, 0, -6, -2, 15, 25296 }, // ̤
+    { 10, 9, 0, -5, 0, 23, 25311 }, // ̥
+    { 6, 7, 0, -3, -2, 11, 25334 }, // ̦
+    { 8, 9, 0, -4, 0, 18, 25345 }, // ̧
+    { 8, 10, 0, -4, 1, 20, 25363 }, // ̨
+    { 4, 7, 0, -2, -1, 7, 25383 }, // ̩
+    { 14, 8, 0, -7, -1, 28, 25390 }, // ̪
+    { 16, 5, 0, -8, -2, 20, 25418 }, // ̫
+    { 14, 7, 0, -7, -1, 25, 25438 }, // ̬
+    { 14, 7, 0, -7, -1, 25, 25463 }, // ̭
+    { 12, 6, 0, -6, -2, 18, 25488 }, // ̮
+    { 12, 6, 0, -6, -2, 18, 25506 }, // ̯
+    { 14, 6, 0, -7, -2, 21, 25524 }, // ̰
+    { 12, 4, 0, -6, -2, 12, 25545 }, // ̱
+    { 18, 3, 0, -9, -3, 14, 25557 }, // ̲
+    { 16, 9, 0, -8, 0, 36, 25571 }, // ̳
+    { 15, 6, 0, -7, 13, 23, 25607 }, // ̴
+    { 16, 4, 0, -8, 13, 16, 25630 }, // ̵
+    { 28, 3, 0, -14, 12, 21, 25646 }, // ̶
+    { 12, 9, 0, -6, 15, 27, 25667 }, // ̷
+    { 16, 32, 0, -8, 29, 128, 25694 }, // ̸
+    { 5, 9, 0, -2, 0, 12, 25822 }, // ̹
+    { 14, 8, 0, -7, -1, 28, 25834 }, // ̺
+    { 16, 8, 0, -8, -1, 32, 25862 }, // ̻
+    { 16, 5, 0, -8, -2, 20, 25894 }, // ̼
+    { 8, 9, 0, -4, 30, 18, 25914 }, // ̽
+    { 6, 12, 0, -3, 33, 18, 25932 }, // ̾
+    { 16, 9, 0, -8, 37, 36, 25950 }, // ̿
+    { 8, 7, 0, -6, 29, 14, 25986 }, // ̀
+    { 9, 7, 0, -2, 29, 16, 26000 }, // ́
+    { 14, 6, 0, -7, 28, 21, 26016 }, // ͂
+    { 6, 8, 0, -3, 30, 12, 26037 }, // ̓
+    { 14, 8, 0, -6, 30, 28, 26049 }, // ̈́
+    { 6, 6, 0, -2, -3, 9, 26077 }, // ͅ
+    { 18, 7, 0, -9, 29, 32, 26086 }, // ͆
+    { 16, 9, 0, -8, 0, 36, 26118 }, // ͇
+    { 10, 7, 0, -5, -1, 18, 26154 }, // ͈
+    { 8, 7, 0, -4, -2, 14, 26172 }, // ͉
+    { 14, 8, 0, -7, 29, 28, 26186 }, // ͊
+    { 14, 14, 0, -7, 35, 49, 26214 }, // ͋
+    { 14, 11, 0, -7, 33, 39, 26263 }, // ͌
+    { 14, 8, 0, -7, -1, 28, 26302 }, // ͍
+    { 8, 9, 0, -4, 0, 18, 26330 }, // ͎
+    { 28, 27, 0, -14, 27, 189, 26348 }, // ͏
+    { 7, 8, 0, -4, 30, 14, 26537 }, // ͐
+    { 5, 9, 0, -2, 31, 12, 26551 }, // ͑
+    { 12, 10, 0, -6, 32, 30, 26563 }, // ͒
+    { 8, 8, 0, -4, -1, 16, 26593 }, // ͓
+    { 7, 8, 0, -4, -1, 14, 26609 }, // ͔
+    { 7, 8, 0, -4, -1, 14, 26623 }, // ͕
+    { 15, 8, 0, -7, -1, 30, 26637 }, // ͖
+    { 5, 9, 0, -2, 31, 12, 26667 }, // ͗
+    { 5, 5, 0, 4, 28, 7, 26679 }, // ͘
+    { 8, 8, 0, -4, -1, 16, 26686 }, // ͙
+    { 16, 8, 0, -8, -1, 32, 26702 }, // ͚
+    { 8, 8, 0, -4, 30, 16, 26734 }, // ͛
+    { 30, 8, 0, -15, -1, 60, 26750 }, // ͜
+    { 30, 8, 0, -15, 30, 60, 26810 }, // ͝
+    { 24, 3, 0, -12, 26, 18, 26870 }, // ͞
+    { 24, 3, 0, -12, -2, 18, 26888 }, // ͟
+    { 30, 6, 0, -15, 28, 45, 26906 }, // ͠
+    { 30, 8, 0, -15, 32, 60, 26951 }, // ͡
+    { 30, 8, 0, -14, -1, 60, 27011 }, // ͢
+    { 8, 9, 0, -4, 32, 18, 27071 }, // ͣ
+    { 9, 9, 0, -4, 32, 21, 27089 }, // ͤ
+    { 3, 12, 0, -1, 35, 9, 27110 }, // ͥ
+    { 9, 9, 0, -4, 32, 21, 27119 }, // ͦ
+    { 9, 9, 0, -4, 32, 21, 27140 }, // ͧ
+    { 7, 9, 0, -3, 32, 16, 27161 }, // ͨ
+    { 9, 12, 0, -4, 35, 27, 27177 }, // ͩ
+    { 9, 12, 0, -4, 35, 27, 27204 }, // ͪ
+    { 14, 9, 0, -7, 32, 32, 27231 }, // ͫ
+    { 6, 9, 0, -2, 32, 14, 27263 }, // ͬ
+    { 7, 11, 0, -3, 34, 20, 27277 }, // ͭ
+    { 9, 9, 0, -4, 32, 21, 27297 }, // ͮ
+    { 9, 9, 0, -4, 32, 21, 27318 }, // ͯ
+    { 16, 36, 21, 3, 36, 144, 27339 }, // Ѐ
+    { 16, 34, 21, 3, 34, 136, 0 }, // Ё
+    { 25, 28, 27, 0, 27, 175, 27483 }, // Ђ
+    { 16, 36, 19, 3, 36, 144, 27658 }, // Ѓ
+    { 21, 29, 24, 2, 28, 153, 27802 }, // Є
+    { 18, 29, 21, 1, 28, 131, 27955 }, // Ѕ
+    { 5, 27, 11, 3, 27, 34, 28086 }, // І
+    { 9, 34, 11, 1, 34, 77, 28120 }, // Ї
+    { 10, 35, 10, -3, 27, 88, 28197 }, // Ј
+    { 36, 28, 38, 0, 27, 252, 28285 }, // Љ
+    { 34, 27, 39, 3, 27, 230, 28537 }, // Њ
+    { 25, 27, 27, 0, 27, 169, 28767 }, // Ћ
+    { 21, 36, 23, 3, 36, 189, 28936 }, // Ќ
+    { 22, 36, 28, 3, 36, 198, 29125 }, // Ѝ
+    { 24, 35, 23, 0, 34, 210, 29323 }, // Ў
+    { 21, 33, 27, 3, 27, 174, 29533 }, // Џ
+    { 24, 27, 24, 0, 27, 162, 136 }, // А
+    { 19, 27, 23, 3, 27, 129, 298 }, // Б
+    { 20, 27, 24, 3, 27, 135, 427 }, // В
+    { 16, 27, 19, 3, 27, 108, 562 }, // Г
+    { 27, 33, 27, 0, 27, 223, 670 }, // Д
+    { 16, 27, 21, 3, 27, 108, 893 }, // Е
+    { 34, 27, 34, 0, 27, 230, 1001 }, // Ж
+    { 19, 29, 22, 1, 28, 138, 1231 }, // З
+    { 22, 27, 28, 3, 27, 149, 1369 }, // И
+    { 22, 34, 28, 3, 34, 187, 1518 }, // Й
+    { 21, 27, 23, 3, 27, 142, 1705 }, // К
+    { 23, 28, 26, 0, 27, 161, 1847 }, // Л
+    { 28, 27, 34, 3, 27, 189, 2008 }, // М
+    { 22, 27, 28, 3, 27, 149, 2197 }, // Н
+    { 25, 29, 29, 2, 28, 182, 2346 }, // О
+    { 21, 27, 27, 3, 27, 142, 2528 }, // П
+    { 18, 27, 23, 3, 27, 122, 2670 }, // Р
+    { 21, 29, 24, 2, 28, 153, 2792 }, // С
+    { 21, 27, 21, 0, 27, 142, 2945 }, // Т
+    { 24, 28, 23, 0, 27, 168, 3087 }, // У
+    { 28, 29, 31, 1, 28, 203, 3255 }, // Ф
+    { 22, 27, 22, 0, 27, 149, 3458 }, // Х
+    { 25, 33, 28, 3, 27, 207, 3607 }, // Ц
+    { 20, 27, 25, 2, 27, 135, 3814 }, // Ч
+    { 33, 27, 39, 3, 27, 223, 3949 }, // Ш
+    { 36, 33, 38, 3, 27, 297, 4172 }, // Щ
+    { 24, 27, 26, 0, 27, 162, 4469 }, // Ъ
+    { 26, 27, 32, 3, 27, 176, 4631 }, // Ы
+    { 18, 27, 23, 3, 27, 122, 4807 }, // Ь
+    { 22, 29, 24, 1, 28, 160, 4929 }, // Э
+    { 33, 29, 37, 3, 28, 240, 5089 }, // Ю
+    { 20, 27, 24, 1, 27, 135, 5329 }, // Я
+    { 17, 22, 21, 1, 21, 94, 5464 }, // а
+    { 20, 30, 22, 1, 29, 150, 5558 }, // б
+    { 17, 21, 21, 3, 21, 90, 5708 }, // в
+    { 13, 21, 16, 3, 21, 69, 5798 }, // г
+    { 23, 27, 23, 0, 21, 156, 5867 }, // д
+    { 18, 22, 21, 1, 21, 99, 6023 }, // е
+    { 29, 21, 28, 0, 21, 153, 6122 }, // ж
+    { 16, 22, 18, 1, 21, 88, 6275 }, // з
+    { 18, 21, 23, 3, 21, 95, 6363 }, // и
+    { 18, 28, 23, 3, 28, 126, 6458 }, // й
+    { 17, 21, 20, 3, 21, 90, 6584 }, // к
+    { 19, 22, 22, 0, 21, 105, 6674 }, // л
+    { 23, 21, 29, 3, 21, 121, 6779 }, // м
+    { 17, 21, 23, 3, 21, 90, 6900 }, // н
+    { 20, 22, 22, 1, 21, 110, 6990 }, // о
+    { 17, 21, 23, 3, 21, 90, 7100 }, // п
+    { 18, 30, 23, 3, 21, 135, 7190 }, // р
+    { 16, 22, 18, 1, 21, 88, 7325 }, // с
+    { 17, 21, 17, 0, 21, 90, 7413 }, // т
+    { 20, 30, 19, 0, 21, 150, 7503 }, // у
+    { 25, 38, 28, 1, 29, 238, 7653 }, // ф
+    { 19, 21, 19, 0, 21, 100, 7891 }, // х
+    { 20, 27, 23, 3, 21, 135, 7991 }, // ц
+    { 17, 21, 22, 2, 21, 90, 8126 }, // ч
+    { 28, 21, 34, 3, 21, 147, 8216 }, // ш
+    { 31, 27, 34, 3, 21, 210, 8363 }, // щ
+    { 22, 21, 23, 0, 21, 116, 8573 }, // ъ
+    { 23, 21, 28, 3, 21, 121, 8689 }, // ы
+    { 16, 21, 20, 3, 21, 84, 8810 }, // ь
+    { 16, 22, 19, 1, 21, 88, 8894 }, // э
+    { 26, 22, 30, 3, 21, 143, 8982 }, // ю
+    { 18, 21, 22, 1, 21, 95, 9125 }, // я
+    { 18, 30, 21, 1, 29, 135, 29707 }, // ѐ
+    { 18, 29, 21, 1, 28, 131, 9220 }, // ё
+    { 21, 38, 23, 0, 29, 200, 29842 }, // ђ
+    { 13, 29, 16, 3, 29, 95, 30042 }, // ѓ
+    { 16, 22, 18, 1, 21, 88, 30137 }, // є
+    { 15, 22, 18, 1, 21, 83, 30225 }, // ѕ
+    { 5, 28, 10, 2, 28, 35, 30308 }, // і
+    { 9, 28, 10, 0, 28, 63, 30343 }, // ї
+    { 10, 37, 10, -3, 28, 93, 30406 }, // ј
+    { 31, 22, 32, 0, 21, 171, 30499 }, // љ
+    { 29, 21, 33, 3, 21, 153, 30670 }, // њ
+    { 21, 29, 23, 0, 29, 153, 30823 }, // ћ
+    { 17, 29, 20, 3, 29, 124, 30976 }, // ќ
+    { 18, 29, 23, 3, 29, 131, 31100 }, // ѝ
+    { 20, 37, 19, 0, 28, 185, 31231 }, // ў
+    { 17, 27, 23, 3, 21, 115, 31416 }, // џ
+    { 34, 28, 34, 0, 27, 238, 31531 }, // Ѡ
+    { 29, 21, 30, 0, 21, 153, 31769 }, // ѡ
+    { 24, 27, 25, 0, 27, 162, 31922 }, // Ѣ
+    { 22, 25, 24, 0, 25, 138, 32084 }, // ѣ
+    { 31, 29, 35, 3, 28, 225, 32222 }, // Ѥ
+    { 24, 22, 28, 3, 21, 132, 32447 }, // ѥ
+    { 26, 27, 26, 0, 27, 176, 32579 }, // Ѧ
+    { 22, 21, 21, 0, 21, 116, 32755 }, // ѧ
+    { 32, 27, 35, 3, 27, 216, 32871 }, // Ѩ
+    { 27, 21, 29, 3, 21, 142, 33087 }, // ѩ
+    { 27, 27, 27, 0, 27, 183, 33229 }, // Ѫ
+    { 24, 21, 24, 0, 21, 126, 33412 }, // ѫ
+    { 34, 27, 37, 3, 27, 230, 33538 }, // Ѭ
+    { 29, 21, 32, 3, 21, 153, 33768 }, // ѭ
+    { 19, 41, 22, 1, 32, 195, 33921 }, // Ѯ
+    { 17, 33, 18, 0, 25, 141, 34116 }, // ѯ
+    { 25, 27, 30, 3, 27, 169, 34257 }, // Ѱ
+    { 24, 38, 29, 2, 29, 228, 34426 }, // ѱ
+    { 25, 29, 29, 2, 28, 182, 34654 }, // Ѳ
+    { 19, 22, 23, 2, 21, 105, 34836 }, // ѳ
+    { 25, 27, 24, 0, 27, 169, 34941 }, // Ѵ
+    { 21, 21, 19, 0, 21, 111, 35110 }, // ѵ
+    { 25, 36, 24, 0, 36, 225, 35221 }, // Ѷ
+    { 21, 29, 19, 0, 29, 153, 35446 }, // ѷ
+    { 44, 37, 46, 2, 28, 407, 35599 }, // Ѹ
+    { 40, 30, 41, 2, 21, 300, 36006 }, // ѹ
+    { 27, 32, 31, 2, 29, 216, 36306 }, // Ѻ
+    { 21, 25, 25, 2, 23, 132, 36522 }, // ѻ
+    { 35, 40, 38, 2, 39, 350, 36654 }, // Ѽ
+    { 30, 35, 34, 2, 34, 263, 37004 }, // ѽ
+    { 34, 35, 34, 0, 34, 298, 37267 }, // Ѿ
+    { 29, 27, 30, 0, 27, 196, 37565 }, // ѿ
+    { 22, 37, 24, 2, 28, 204, 37761 }, // Ҁ
+    { 16, 30, 18, 2, 21, 120, 37965 }, // ҁ
+    { 20, 25, 23, 1, 24, 125, 38085 }, // ҂
+    { 15, 6, 0, -18, 27, 23, 38210 }, // ҃
+    { 15, 6, 0, -18, 28, 23, 38233 }, // ҄
+    { 5, 8, 0, -13, 30, 10, 38256 }, // ҅
+    { 5, 8, 0, -13, 30, 10, 38266 }, // ҆
+    { 14, 6, 0, -7, 34, 21, 38276 }, // ҇
+    { 44, 40, 0, -22, 30, 440, 38297 }, // ҈
+    { 42, 42, 0, -21, 31, 441, 38737 }, // ҉
+    { 26, 43, 29, 3, 35, 280, 39178 }, // Ҋ
+    { 22, 36, 25, 3, 29, 198, 39458 }, // ҋ
+    { 22, 27, 23, 0, 27, 149, 39656 }, // Ҍ
+    { 21, 29, 22, 0, 29, 153, 39805 }, // ҍ
+    { 19, 27, 23, 3, 27, 129, 39958 }, // Ҏ
+    { 18, 30, 23, 3, 21, 135, 40087 }, // ҏ
+    { 17, 33, 20, 3, 33, 141, 40222 }, // Ґ
+    { 13, 26, 16, 3, 26, 85, 40363 }, // ґ
+    { 20, 27, 20, 0, 27, 135, 40448 }, // Ғ
+    { 16, 21, 16, 0, 21, 84, 40583 }, // ғ
+    { 21, 37, 24, 3, 27, 195, 40667 }, // Ҕ
+    { 16, 31, 20, 3, 21, 124, 40862 }, // ҕ
+    { 34, 35, 34, 0, 27, 298, 0 }, // Җ
+    { 30, 28, 30, 0, 21, 210, 298 }, // җ
+    { 19, 37, 22, 1, 28, 176, 508 }, // Ҙ
+    { 16, 30, 18, 1, 21, 120, 684 }, // ҙ
+    { 22, 35, 25, 3, 27, 193, 804 }, // Қ
+    { 18, 28, 21, 3, 21, 126, 997 }, // қ
+    { 21, 27, 23, 3, 27, 142, 1123 }, // Ҝ
+    { 17, 21, 20, 3, 21, 90, 1265 }, // ҝ
+    { 24, 27, 23, 0, 27, 162, 1355 }, // Ҟ
+    { 20, 29, 20, 0, 29, 145, 1517 }, // ҟ
+    { 26, 27, 26, 0, 27, 176, 1662 }, // Ҡ
+    { 24, 21, 23, 0, 21, 126, 1838 }, // ҡ
+    { 25, 35, 28, 3, 27, 219, 1964 }, // Ң
+    { 21, 28, 25, 3, 21, 147, 2183 }, // ң
+    { 28, 27, 31, 3, 27, 189, 2330 }, // Ҥ
+    { 25, 21, 28, 3, 21, 132, 2519 }, // ҥ
+    { 36, 37, 40, 3, 27, 333, 2651 }, // Ҧ
+    { 29, 31, 32, 3, 21, 225, 2984 }, // ҧ
+    { 26, 30, 29, 2, 28, 195, 3209 }, // Ҩ
+    { 21, 23, 24, 2, 21, 121, 3404 }, // ҩ
+    { 21, 37, 24, 2, 28, 195, 3525 }, // Ҫ
+    { 15, 30, 18, 2, 21, 113, 3720 }, // ҫ
+    { 21, 35, 21, 0, 27, 184, 3833 }, // Ҭ
+    { 18, 28, 18, 0, 21, 126, 4017 }, // ҭ
+    { 22, 27, 21, 0, 27, 149, 4143 }, // Ү
+    { 20, 30, 19, 0, 21, 150, 4292 }, // ү
+    { 22, 27, 21, 0, 27, 149, 4442 }, // Ұ
+    { 20, 30, 19, 0, 21, 150, 4591 }, // ұ
+    { 24, 35, 24, 0, 27, 210, 4741 }, // Ҳ
+    { 21, 28, 21, 0, 21, 147, 4951 }, // ҳ
+    { 32, 35, 32, 0, 27, 280, 5098 }, // Ҵ
+    { 27, 28, 27, 0, 21, 189, 5378 }, // ҵ
+    { 23, 35, 26, 3, 27, 202, 5567 }, // Ҷ
+    { 21, 28, 23, 2, 21, 147, 5769 }, // ҷ
+    { 20, 27, 26, 3, 27, 135, 5916 }, // Ҹ
+    { 18, 21, 23, 2, 21, 95, 6051 }, // ҹ
+    { 21, 27, 26, 3, 27, 142, 6146 }, // Һ
+    { 18, 29, 23, 3, 29, 131, 6288 }, // һ
+    { 29, 29, 32, 1, 28, 211, 6419 }, // Ҽ
+    { 24, 22, 25, 0, 21, 132, 6630 }, // ҽ
+    { 29, 36, 32, 1, 28, 261, 6762 }, // Ҿ
+    { 24, 28, 25, 0, 21, 168, 7023 }, // ҿ
+    { 11, 27, 13, 1, 27, 75, 7191 }, // Ӏ
+    { 34, 34, 34, 0, 34, 289, 7266 }, // Ӂ
+    { 29, 28, 28, 0, 28, 203, 7555 }, // ӂ
+    { 22, 37, 26, 3, 27, 204, 7758 }, // Ӄ
+    { 17, 31, 21, 3, 21, 132, 7962 }, // ӄ
+    { 27, 35, 27, 0, 27, 237, 8094 }, // Ӆ
+    { 22, 28, 22, 0, 21, 154, 8331 }, // ӆ
+    { 22, 37, 27, 3, 27, 204, 8485 }, // Ӈ
+    { 18, 31, 23, 3, 21, 140, 8689 }, // ӈ
+    { 25, 35, 28, 3, 27, 219, 8829 }, // Ӊ
+    { 22, 28, 25, 3, 21, 154, 9048 }, // ӊ
+    { 20, 35, 26, 3, 27, 175, 9202 }, // Ӌ
+    { 18, 28, 23, 2, 21, 126, 9377 }, // ӌ
+    { 32, 35, 34, 3, 27, 280, 9503 }, // Ӎ
+    { 26, 28, 28, 3, 21, 182, 9783 }, // ӎ
+    { 11, 27, 13, 1, 27, 75, 9965 }, // ӏ
+    { 24, 34, 24, 0, 34, 204, 10040 }, // Ӑ
+    { 17, 29, 21, 1, 28, 124, 10244 }, // ӑ
+    { 24, 35, 24, 0, 35, 210, 10368 }, // Ӓ
+    { 17, 29, 21, 1, 28, 124, 10578 }, // ӓ
+    { 32, 27, 33, -1, 27, 216, 10702 }, // Ӕ
+    { 30, 22, 32, 1, 21, 165, 10918 }, // ӕ
+    { 16, 34, 21, 3, 34, 136, 11083 }, // Ӗ
+    { 18, 29, 21, 2, 28, 131, 11219 }, // ӗ
+    { 24, 29, 28, 2, 28, 174, 11350 }, // Ә
+    { 19, 22, 21, 1, 21, 105, 11524 }, // ә
+    { 24, 36, 28, 2, 35, 216, 11629 }, // Ӛ
+    { 19, 29, 21, 1, 28, 138, 11845 }, // ӛ
+    { 34, 35, 34, 0, 35, 298, 11983 }, // Ӝ
+    { 29, 28, 28, 0, 28, 203, 12281 }, // ӝ
+    { 19, 36, 22, 1, 35, 171, 12484 }, // Ӟ
+    { 16, 29, 18, 1, 28, 116, 12655 }, // ӟ
+    { 19, 28, 22, 1, 27, 133, 12771 }, // Ӡ
+    { 18, 30, 19, 0, 21, 135, 12904 }, // ӡ
+    { 22, 33, 28, 3, 33, 182, 13039 }, // Ӣ
+    { 18, 26, 23, 3, 26, 117, 13221 }, // ӣ
+    { 22, 35, 28, 3, 35, 193, 13338 }, // Ӥ
+    { 18, 28, 23, 3, 28, 126, 13531 }, // ӥ
+    { 25, 36, 29, 2, 35, 225, 13657 }, // Ӧ
+    { 19, 29, 23, 2, 28, 138, 13882 }, // ӧ
+    { 25, 29, 29, 2, 28, 182, 14020 }, // Ө
+    { 19, 22, 23, 2, 21, 105, 14202 }, // ө
+    { 25, 35, 29, 2, 34, 219, 14307 }, // Ӫ
+    { 19, 29, 23, 2, 28, 138, 14526 }, // ӫ
+    { 22, 36, 24, 1, 35, 198, 14664 }, // Ӭ
+    { 16, 29, 19, 1, 28, 116, 14862 }, // ӭ
+    { 24, 34, 23, 0, 33, 204, 14978 }, // Ӯ
+    { 20, 35, 19, 0, 26, 175, 15182 }, // ӯ
+    { 24, 36, 23, 0, 35, 216, 15357 }, // Ӱ
+    { 20, 37, 19, 0, 28, 185, 15573 }, // ӱ
+    { 24, 37, 23, 0, 36, 222, 15758 }, // Ӳ
+    { 20, 38, 19, 0, 29, 190, 15980 }, // ӳ
+    { 20, 35, 25, 2, 35, 175, 16170 }, // Ӵ
+    { 17, 28, 22, 2, 28, 119, 16345 }, // ӵ
+    { 17, 35, 20, 3, 27, 149, 16464 }, // Ӷ
+    { 13, 28, 16, 3, 21, 91, 16613 }, // ӷ
+    { 26, 35, 32, 3, 35, 228, 16704 }, // Ӹ
+    { 23, 28, 28, 3, 28, 161, 16932 }, // ӹ
+    { 20, 35, 20, 0, 27, 175, 17093 }, // Ӻ
+    { 16, 29, 16, 0, 21, 116, 17268 }, // ӻ
+    { 23, 35, 24, 0, 27, 202, 17384 }, // Ӽ
+    { 21, 29, 21, 0, 21, 153, 17586 }, // ӽ
+    { 22, 27, 22, 0, 27, 149, 17739 }, // Ӿ
+    { 20, 21, 20, 0, 21, 105, 17888 }, // ӿ
+    { 0, 0, 19, 0, 0, 0, 17993 }, //  
+    { 0, 0, 38, 0, 0, 0, 17993 }, //  
+    { 0, 0, 19, 0, 0, 0, 17993 }, //  
+    { 0, 0, 38, 0, 0, 0, 17993 }, //  
+    { 0, 0, 12, 0, 0, 0, 17993 }, //  
+    { 0, 0, 9, 0, 0, 0, 17993 }, //  
+    { 0, 0, 6, 0, 0, 0, 17993 }, //  
+    { 0, 0, 21, 0, 0, 0, 17993 }, //  
+    { 0, 0, 10, 0, 0, 0, 17993 }, //  
+    { 0, 0, 6, 0, 0, 0, 17993 }, //  
+    { 0, 0, 4, 0, 0, 0, 17993 }, //  
+    { 0, 0, 0, 0, 0, 0, 17993 }, // ​
+    { 0, 0, 0, 0, 0, 0, 17993 }, // ‌
+    { 0, 0, 0, 0, 0, 0, 17993 }, // ‍
+    { 9, 31, 0, -1, 26, 70, 17993 }, // ‎
+    { 9, 31, 0, -8, 26, 70, 18063 }, // ‏
+    { 10, 4, 12, 1, 12, 10, 18133 }, // ‐
+    { 10, 4, 12, 1, 12, 10, 18143 }, // ‑
+    { 19, 3, 21, 1, 15, 15, 18153 }, // ‒
+    { 17, 4, 19, 1, 12, 17, 17580 }, // –
+    { 35, 4, 38, 1, 12, 35, 17597 }, // —
+    { 35, 4, 38, 1, 12, 35, 18168 }, // ―
+    { 12, 39, 21, 4, 29, 117, 18203 }, // ‖
+    { 17, 9, 15, -1, 0, 39, 18320 }, // ‗
+    { 7, 10, 7, 0, 27, 18, 17632 }, // ‘
+    { 7, 10, 7, 0, 27, 18, 17650 }, // ’
+    { 6, 10, 9, 1, 5, 15, 18359 }, // ‚
+    { 7, 10, 7, 0, 27, 18, 18374 }, // ‛
+    { 14, 10, 13, 0, 27, 35, 17668 }, // “
+    { 14, 10, 13, 0, 27, 35, 17703 }, // ”
+    { 13, 10, 16, 1, 5, 33, 18392 }, // „
+    { 14, 10, 13, 0, 27, 35, 18425 }, // ‟
+    { 15, 29, 19, 2, 29, 109, 18460 }, // †
+    { 15, 29, 19, 2, 29, 109, 18569 }, // ‡
+    { 10, 10, 14, 2, 19, 25, 18678 }, // •
+    { 11, 12, 14, 2, 20, 33, 18703 }, // ‣
+    { 5, 6, 19, 7, 5, 8, 18736 }, // ․
+    { 16, 6, 20, 2, 5, 24, 18744 }, // ‥
+    { 25, 6, 30, 2, 5, 38, 17738 }, // …
+    { 6, 6, 10, 2, 12, 9, 18768 }, // ‧
+    { 0, 0, 23, 0, 0, 0, 18777 }, //  
+    { 0, 0, 23, 0, 0, 0, 18777 }, //  
+    { 9, 28, 0, -1, 23, 63, 18777 }, // ‪
+    { 9, 28, 0, -8, 23, 63, 18840 }, // ‫
+    { 10, 31, 0, -5, 26, 78, 18903 }, // ‬
+    { 10, 31, 0, -5, 26, 78, 18981 }, // ‭
+    { 10, 31, 0, -5, 26, 78, 19059 }, // ‮
+    { 0, 0, 6, 0, 0, 0, 19137 }, //  
+    { 42, 29, 44, 1, 28, 305, 19137 }, // ‰
+    { 56, 29, 58, 1, 28, 406, 19442 }, // ‱
+    { 9, 10, 9, 1, 27, 23, 19848 }, // ′
+    { 16, 10, 15, 1, 27, 40, 19871 }, // ″
+    { 22, 10, 22, 1, 27, 55, 19911 }, // ‴
+    { 9, 10, 9, -1, 27, 23, 19966 }, // ‵
+    { 15, 10, 17, -1, 27, 38, 19989 }, // ‶
+    { 21, 10, 23, -1, 27, 53, 20027 }, // ‷
+    { 15, 13, 15, 0, 4, 49, 20080 }, // ‸
+    { 10, 16, 12, 1, 18, 40, 20129 }, // ‹
+    { 10, 16, 12, 1, 18, 40, 20169 }, // ›
+    { 29, 29, 31, 1, 28, 211, 20209 }, // ※
+    { 14, 28, 19, 2, 27, 98, 20420 }, // ‼
+    { 16, 29, 17, 0, 28, 116, 20518 }, // ‽
+    { 20, 3, 19, -1, 31, 15, 20634 }, // ‾
+    { 22, 8, 23, 0, -1, 44, 20649 }, // ‿
+    { 22, 9, 23, 0, 30, 50, 20693 }, // ⁀
+    { 14, 25, 14, 0, 16, 88, 20743 }, // ⁁
+    { 42, 35, 42, 0, 29, 368, 20831 }, // ⁂
+    { 10, 4, 12, 1, 12, 10, 21199 }, // ⁃
+    { 20, 27, 5, -8, 27, 135, 21209 }, // ⁄
+    { 10, 33, 12, 2, 27, 83, 21344 }, // ⁅
+    { 10, 33, 12, 0, 27, 83, 21427 }, // ⁆
+    { 32, 29, 32, 0, 28, 232, 21510 }, // ⁇
+    { 23, 29, 25, 0, 28, 167, 21742 }, // ⁈
+    { 23, 29, 26, 2, 28, 167, 21909 }, // ⁉
+    { 19, 21, 21, 1, 21, 100, 22076 }, // ⁊
+    { 20, 34, 25, 3, 29, 170, 22176 }, // ⁋
+    { 19, 20, 24, 2, 21, 95, 22346 }, // ⁌
+    { 19, 20, 24, 3, 21, 95, 22441 }, // ⁍
+    { 19, 18, 21, 1, 10, 86, 22536 }, // ⁎
+    { 7, 26, 9, 1, 21, 46, 22622 }, // ⁏
+    { 22, 39, 23, 0, 30, 215, 22668 }, // ⁐
+    { 19, 37, 21, 1, 29, 176, 22883 }, // ⁑
+    { 14, 29, 14, 0, 28, 102, 23059 }, // ⁒
+    { 33, 6, 38, 2, 14, 50, 23161 }, // ⁓
+    { 22, 9, 23, 0, 0, 50, 23211 }, // ⁔
+    { 20, 20, 21, 1, 19, 100, 23261 }, // ⁕
+    { 17, 29, 19, 1, 28, 124, 23361 }, // ⁖
+    { 28, 10, 28, 1, 27, 70, 23485 }, // ⁗
+    { 28, 29, 31, 1, 28, 203, 23555 }, // ⁘
+    { 29, 29, 31, 1, 28, 211, 23758 }, // ⁙
+    { 6, 29, 8, 1, 28, 44, 23969 }, // ⁚
+    { 22, 30, 25, 1, 29, 165, 24013 }, // ⁛
+    { 28, 29, 30, 1, 28, 203, 24178 }, // ⁜
+    { 6, 28, 10, 2, 27, 42, 24381 }, // ⁝
+    { 6, 29, 10, 2, 28, 44, 24423 }, // ⁞
+    { 0, 0, 8, 0, 0, 0, 24467 }, //  
+    { 0, 0, 23, 0, 0, 0, 24467 }, // ⁠
+    { 0, 0, 23, 0, 0, 0, 24467 }, // ⁡
+    { 0, 0, 23, 0, 0, 0, 24467 }, // ⁢
+    { 0, 0, 23, 0, 0, 0, 24467 }, // ⁣
+    { 0, 0, 23, 0, 0, 0, 24467 }, // ⁤
+    { 0, 0, 0, 0, 0, 0, 24467 }, // ⁦
+    { 0, 0, 0, 0, 0, 0, 24467 }, // ⁧
+    { 0, 0, 0, 0, 0, 0, 24467 }, // ⁨
+    { 0, 0, 0, 0, 0, 0, 24467 }, // ⁩
+    { 10, 31, 0, -5, 26, 78, 24467 }, // ⁪
+    { 10, 31, 0, -5, 26, 78, 24545 }, // ⁫
+    { 10, 31, 0, -5, 26, 78, 24623 }, // ⁬
+    { 10, 31, 0, -5, 26, 78, 24701 }, // ⁭
+    { 10, 31, 0, -5, 26, 78, 24779 }, // ⁮
+    { 10, 31, 0, -5, 26, 78, 24857 }, // ⁯
+    { 13, 17, 13, 0, 32, 56, 24935 }, // ⁰
+    { 4, 18, 6, 1, 28, 18, 24991 }, // ⁱ
+    { 13, 17, 13, 0, 32, 56, 25009 }, // ⁴
+    { 11, 17, 13, 1, 32, 47, 25065 }, // ⁵
+    { 13, 17, 13, 0, 32, 56, 25112 }, // ⁶
+    { 12, 17, 13, 1, 32, 51, 25168 }, // ⁷
+    { 13, 17, 13, 0, 32, 56, 25219 }, // ⁸
+    { 13, 18, 13, 0, 33, 59, 25275 }, // ⁹
+    { 11, 11, 13, 1, 28, 31, 25334 }, // ⁺
+    { 11, 3, 13, 1, 24, 9, 25365 }, // ⁻
+    { 11, 7, 13, 1, 26, 20, 25374 }, // ⁼
+    { 7, 22, 8, 2, 35, 39, 25394 }, // ⁽
+    { 7, 22, 8, 0, 35, 39, 25433 }, // ⁾
+    { 12, 14, 15, 2, 24, 42, 25472 }, // ⁿ
+    { 13, 17, 13, 0, 12, 56, 25514 }, // ₀
+    { 8, 17, 13, 1, 12, 34, 25570 }, // ₁
+    { 12, 17, 13, 0, 12, 51, 25604 }, // ₂
+    { 13, 17, 13, 0, 12, 56, 25655 }, // ₃
+    { 13, 17, 13, 0, 12, 56, 25711 }, // ₄
+    { 11, 17, 13, 1, 12, 47, 25767 }, // ₅
+    { 13, 17, 13, 0, 12, 56, 25814 }, // ₆
+    { 12, 17, 13, 1, 12, 51, 25870 }, // ₇
+    { 13, 17, 13, 0, 12, 56, 25921 }, // ₈
+    { 13, 18, 13, 0, 13, 59, 25977 }, // ₉
+    { 11, 11, 13, 1, 8, 31, 26036 }, // ₊
+    { 11, 3, 13, 1, 4, 9, 26067 }, // ₋
+    { 11, 7, 13, 1, 6, 20, 26076 }, // ₌
+    { 7, 22, 8, 2, 14, 39, 26096 }, // ₍
+    { 7, 22, 8, 0, 14, 39, 26135 }, // ₎
+    { 11, 13, 14, 1, 9, 36, 26174 }, // ₐ
+    { 12, 13, 14, 1, 9, 39, 26210 }, // ₑ
+    { 13, 13, 15, 1, 9, 43, 26249 }, // ₒ
+    { 13, 13, 13, 0, 9, 43, 26292 }, // ₓ
+    { 12, 13, 14, 1, 9, 39, 26335 }, // ₔ
+    { 12, 18, 15, 2, 14, 54, 26374 }, // ₕ
+    { 11, 18, 13, 2, 14, 50, 26428 }, // ₖ
+    { 3, 18, 6, 2, 14, 14, 26478 }, // ₗ
+    { 19, 13, 23, 2, 9, 62, 26492 }, // ₘ
+    { 12, 13, 15, 2, 9, 39, 26554 }, // ₙ
+    { 12, 18, 15, 2, 9, 54, 26593 }, // ₚ
+    { 10, 13, 12, 1, 9, 33, 26647 }, // ₛ
+    { 9, 16, 9, 0, 12, 36, 26680 }, // ₜ
+    { 20, 28, 21, 1, 28, 140, 26716 }, // ₠
+    { 20, 32, 21, 1, 29, 160, 26856 }, // ₡
+    { 19, 29, 21, 2, 28, 138, 27016 }, // ₢
+    { 19, 27, 21, 1, 27, 129, 27154 }, // ₣
+    { 20, 28, 21, 1, 28, 140, 27283 }, // ₤
+    { 30, 30, 35, 3, 25, 225, 27423 }, // ₥
+    { 22, 27, 21, 0, 27, 149, 27648 }, // ₦
+    { 26, 28, 29, 2, 27, 182, 27797 }, // ₧
+    { 27, 28, 31, 3, 27, 189, 27979 }, // ₨
+    { 25, 27, 25, 0, 27, 169, 28168 }, // ₩
+    { 24, 27, 30, 3, 27, 162, 28337 }, // ₪
+    { 21, 35, 23, 2, 29, 184, 28499 }, // ₫
+    { 21, 29, 21, 0, 28, 153, 28683 }, // €
+    { 22, 27, 21, 0, 27, 149, 28836 }, // ₭
+    { 21, 27, 21, 0, 27, 142, 28985 }, // ₮
+    { 36, 37, 36, 0, 28, 333, 29127 }, // ₯
+    { 20, 37, 21, 0, 28, 185, 29460 }, // ₰
+    { 22, 27, 21, 0, 27, 149, 29645 }, // ₱
+    { 23, 32, 27, 2, 29, 184, 29794 }, // ₲
+    { 23, 27, 23, 0, 27, 156, 29978 }, // ₳
+    { 21, 29, 21, 0, 28, 153, 30134 }, // ₴
+    { 21, 32, 24, 2, 29, 168, 30287 }, // ₵
+    { 23, 26, 23, 0, 25, 150, 30455 }, // ₶
+    { 26, 31, 27, 0, 28, 202, 30605 }, // ₷
+    { 20, 27, 20, 0, 27, 135, 30807 }, // ₸
+    { 17, 27, 21, 2, 27, 115, 30942 }, // ₹
+    { 21, 28, 21, 0, 27, 147, 31057 }, // ₺
+    { 29, 29, 29, 0, 28, 211, 31204 }, // ₻
+    { 26, 27, 30, 2, 27, 176, 31415 }, // ₼
+    { 21, 27, 22, 0, 27, 142, 31591 }, // ₽
+    { 25, 29, 29, 2, 29, 182, 31733 }, // ₾
+    { 18, 35, 21, 3, 31, 158, 31915 }, // ₿
+    { 16, 27, 18, 1, 21, 108, 32073 }, // ⃀
+    { 19, 4, 21, 1, 15, 19, 32181 }, // −
+    { 28, 29, 26, 0, 29, 203, 32200 }, // ﬀ
+    { 20, 29, 23, 0, 29, 145, 32403 }, // ﬁ
+    { 20, 29, 23, 0, 29, 145, 32548 }, // ﬂ
+    { 33, 29, 35, 0, 29, 240, 32693 }, // ﬃ
+    { 33, 29, 35, 0, 29, 240, 32933 }, // ﬄ
+    { 22, 30, 25, 3, 29, 165, 33173 }, // ﬅ
+    { 30, 30, 32, 1, 29, 225, 33338 }, // ﬆ
+    { 35, 35, 38, 1, 29, 307, 33563 }, // �
 };
 
 static const EpdUnicodeInterval notosans_18_regularIntervals[] = {
@@ -3250,31 +3285,297 @@ static const EpdUnicodeInterval notosans_18_regularIntervals[] = {
     { 0x2090, 0x209C, 0x33D },
     { 0x20A0, 0x20C0, 0x34A },
     { 0x2212, 0x2212, 0x36B },
-    { 0xFFFD, 0xFFFD, 0x36C },
+    { 0xFB00, 0xFB06, 0x36C },
+    { 0xFFFD, 0xFFFD, 0x373 },
 };
 
 static const EpdFontGroup notosans_18_regularGroups[] = {
-    { 0, 4510, 10414, 97, 0 },
-    { 4510, 4453, 12553, 96, 97 },
-    { 8963, 6052, 19294, 128, 193 },
-    { 15015, 1598, 2658, 112, 321 },
-    { 16613, 14247, 40991, 256, 433 },
-    { 30860, 2891, 7138, 111, 689 },
-    { 33751, 841, 1781, 42, 800 },
-    { 34592, 2733, 5465, 33, 842 },
-    { 37325, 16, 19, 1, 875 },
-    { 37341, 150, 307, 1, 876 },
+    { 0, 6027, 17776, 151, 2 },
+    { 6027, 3792, 9351, 66, 434 },
+    { 9819, 14982, 40986, 373, 0 },
+    { 24801, 13136, 33870, 294, 583 },
+};
+
+static const uint8_t notosans_18_regularGlyphGroups[884] = {
+    2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2,
+    2, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 2, 2,
+    2, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 0, 0, 3, 3, 3, 0, 0, 3, 3, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+};
+
+static const uint8_t notosans_18_regularKernLeftClasses[884] = {
+    0, 0, 0, 0, 2, 0, 0, 0, 66, 2, 26, 0, 0, 0, 7, 30,
+    7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 0, 0, 0,
+    0, 0, 0, 12, 0, 41, 17, 36, 62, 0, 0, 0, 0, 41, 22, 0,
+    0, 17, 39, 17, 0, 0, 11, 48, 37, 37, 41, 15, 68, 26, 0, 0,
+    0, 69, 0, 0, 35, 63, 0, 35, 50, 0, 0, 0, 0, 0, 0, 0,
+    0, 35, 35, 0, 23, 0, 63, 0, 27, 27, 72, 27, 0, 26, 0, 0,
+    0, 0, 67, 0, 0, 0, 0, 0, 0, 0, 0, 0, 60, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 0, 0, 0,
+    52, 12, 12, 12, 12, 12, 12, 36, 41, 36, 36, 36, 36, 0, 0, 0,
+    0, 17, 0, 17, 17, 17, 17, 17, 0, 17, 48, 48, 48, 48, 15, 39,
+    0, 0, 0, 0, 0, 0, 0, 35, 0, 35, 35, 35, 35, 0, 0, 61,
+    61, 35, 0, 35, 35, 35, 35, 35, 0, 35, 0, 0, 0, 0, 27, 35,
+    27, 12, 0, 12, 0, 45, 0, 41, 0, 41, 0, 41, 0, 41, 0, 17,
+    29, 17, 0, 36, 35, 36, 35, 36, 35, 36, 35, 36, 35, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 57, 0, 61, 0, 0, 36,
+    0, 0, 0, 0, 0, 0, 0, 41, 0, 72, 22, 0, 22, 0, 22, 29,
+    22, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 35, 17,
+    35, 17, 35, 36, 35, 0, 23, 0, 23, 0, 23, 0, 0, 0, 0, 0,
+    0, 0, 0, 11, 63, 11, 43, 11, 63, 48, 0, 48, 0, 48, 0, 48,
+    0, 48, 0, 48, 0, 37, 27, 15, 27, 15, 68, 0, 68, 0, 68, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 51, 51, 28, 16, 31, 48, 0, 0, 0, 20, 20, 28, 13, 0, 1,
+    0, 10, 0, 65, 16, 5, 51, 13, 65, 0, 0, 13, 0, 0, 0, 9,
+    0, 21, 31, 16, 1, 44, 13, 5, 0, 0, 5, 20, 0, 20, 9, 9,
+    0, 46, 59, 55, 25, 4, 3, 19, 55, 40, 40, 19, 40, 40, 40, 3,
+    40, 3, 54, 25, 14, 3, 19, 4, 40, 40, 4, 8, 40, 8, 3, 3,
+    40, 3, 3, 53, 25, 54, 70, 0, 71, 73, 8, 8, 56, 19, 40, 14,
+    40, 9, 47, 42, 8, 31, 54, 10, 38, 10, 38, 0, 0, 0, 0, 49,
+    0, 0, 3, 9, 3, 1, 47, 1, 47, 14, 14, 9, 3, 9, 3, 9,
+    47, 31, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 4, 42, 8, 21,
+    3, 6, 32, 18, 58, 0, 0, 34, 0, 49, 55, 34, 0, 13, 19, 13,
+    19, 13, 19, 5, 4, 18, 32, 0, 0, 0, 3, 31, 54, 6, 32, 24,
+    49, 24, 49, 34, 0, 5, 4, 5, 4, 0, 0, 0, 0, 40, 64, 40,
+    64, 0, 13, 19, 0, 0, 5, 4, 0, 0, 5, 4, 0, 0, 5, 4,
+    0, 10, 46, 10, 46, 51, 64, 51, 64, 9, 3, 9, 3, 13, 19, 49,
+    55, 0, 0, 0, 40, 0, 40, 9, 3, 9, 3, 9, 3, 9, 3, 1,
+    14, 1, 14, 1, 14, 0, 40, 6, 32, 0, 40, 18, 58, 34, 0, 13,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 30, 30, 30, 0, 0, 2, 2, 7, 0, 2, 2, 7,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 60, 33, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 0, 0, 0,
+    0, 0, 0, 0,
+};
+
+static const uint8_t notosans_18_regularKernRightClasses[884] = {
+    0, 0, 0, 65, 6, 0, 0, 0, 64, 6, 0, 42, 0, 0, 1, 27,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 43, 43, 0, 0,
+    0, 56, 0, 7, 0, 3, 0, 0, 0, 3, 0, 0, 44, 0, 0, 0,
+    0, 3, 0, 3, 0, 0, 18, 50, 31, 31, 62, 24, 0, 0, 0, 42,
+    0, 0, 0, 14, 60, 2, 2, 2, 0, 32, 60, 0, 68, 60, 60, 16,
+    16, 2, 16, 2, 16, 45, 0, 16, 22, 22, 22, 22, 49, 0, 0, 42,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 52, 0, 0, 0,
+    0, 7, 7, 7, 7, 7, 7, 61, 3, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 3, 3, 3, 3, 3, 0, 3, 50, 50, 50, 50, 24, 0,
+    0, 2, 14, 14, 14, 14, 14, 14, 2, 2, 2, 2, 2, 0, 0, 0,
+    0, 0, 0, 2, 2, 2, 2, 2, 0, 2, 16, 16, 16, 16, 22, 60,
+    22, 7, 14, 7, 14, 7, 14, 3, 2, 3, 2, 3, 2, 3, 2, 0,
+    2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 3, 32, 3,
+    32, 3, 32, 3, 32, 0, 60, 0, 69, 0, 59, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 60, 16, 0, 60, 0, 60, 0, 60,
+    0, 60, 0, 0, 0, 16, 0, 16, 0, 0, 0, 0, 16, 3, 2, 3,
+    2, 3, 2, 3, 2, 0, 16, 0, 16, 0, 0, 0, 45, 0, 0, 0,
+    45, 0, 0, 18, 0, 18, 0, 18, 0, 50, 16, 50, 16, 50, 16, 50,
+    16, 50, 16, 50, 16, 31, 22, 24, 22, 24, 0, 49, 0, 49, 0, 49,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4, 0, 28, 66, 0, 0, 34, 29, 0, 4, 0, 0, 8,
+    0, 11, 0, 0, 0, 40, 0, 19, 70, 0, 0, 0, 29, 0, 0, 28,
+    0, 0, 28, 4, 8, 46, 19, 0, 12, 0, 0, 4, 0, 0, 70, 0,
+    54, 5, 58, 43, 43, 15, 21, 9, 39, 43, 43, 43, 25, 43, 43, 21,
+    43, 43, 21, 20, 17, 21, 9, 43, 10, 43, 43, 20, 43, 43, 39, 43,
+    53, 21, 21, 36, 43, 21, 63, 0, 67, 48, 25, 43, 36, 43, 43, 17,
+    43, 13, 51, 57, 0, 0, 23, 11, 15, 0, 23, 0, 0, 0, 23, 70,
+    0, 12, 0, 13, 5, 37, 51, 37, 51, 13, 5, 13, 5, 13, 5, 13,
+    51, 13, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 23, 57, 36, 0,
+    23, 0, 23, 57, 0, 0, 23, 19, 9, 70, 39, 0, 23, 0, 23, 0,
+    36, 35, 20, 0, 23, 0, 23, 0, 23, 13, 5, 13, 5, 4, 20, 37,
+    55, 37, 55, 19, 9, 35, 20, 12, 10, 12, 10, 0, 23, 30, 41, 30,
+    41, 0, 19, 9, 0, 23, 47, 15, 0, 23, 0, 23, 12, 10, 0, 23,
+    0, 11, 38, 11, 38, 11, 38, 0, 5, 0, 38, 0, 38, 19, 9, 70,
+    39, 0, 0, 0, 43, 0, 43, 13, 5, 13, 5, 13, 5, 70, 39, 8,
+    17, 8, 17, 8, 17, 12, 10, 0, 23, 0, 43, 57, 0, 19, 9, 19,
+    9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 27, 27, 27, 0, 0, 33, 6, 1, 0, 33, 6, 1,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 52, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0,
+};
+
+static const int8_t notosans_18_regularKernMatrix[5254] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -3, 0, 0, 0, -2, 1, 0, 0, -1, -1, -4, 0, 0, 0, -4, 0, 0, 0, 0, 0, -2, 0, 0, 0, -2, -2, -1, -2, -3, -1, 0, 0, 0, 0, 0, 2, 0, 0, -1, -4, -1, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, -1, -2, -1, 0, 0, 0, -2, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0,
+    0, 0, -2, 0, 1, -2, 0, -3, 1, 0, 0, -3, 0, 0, -2, -3, -1, 1, 1, 1, 1, 0, 0, 0, 0, -2, 0, 0, 0, -1, 0, 1, -1, 0, 0, 1, 1, 0, -1, 1, -2, 0, 0, 0, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, -3, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, -2, 0, 0, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, 0, 1, -3, 0, 0, 0, -1, -2, -3, 0, -1, 0, -2, 0, -2, 0, 0, -2, 0, 0, -2, 0, 0, -2, -2, -1, -2, -2, 0, 0, 0, 0, 0, 0, 0, -3, -1, -2, -3, 0, 0, 0, 0, -1, -2, 0, 0, 0, -1, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, -2, 0, 0, 0, -1, 0, -2, 0, -3, -2, 0, 0, 0, 0, -3, 0, -2, 0, 0, 0, -2, 0, 0, 0, 0, 0, -2, -2, 0, 0, 2, -3, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, 0, -3, 0, -1, -1, -2, 0, -3, 0, 0, 0, 0, -2, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, 0, -1, 0, 0, 0, -2, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -3, 0, -3, 0, -1, 0, -1, 0, -2, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, 0, -2, 2, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, -3, -1, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, -3, 0, -2, 0, 1, 0, 0, 0, -1, 0, 0, 0, -2, -2, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -2, 0, 0, -1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, 0, 0, 0, 1, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, -2, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, 0, 1, -2, 1, 0, 0, 0, -1, -3, 0, 0, 0, -2, 0, -1, 0, 0, 0, -2, 0, 0, 0, -1, 0, -2, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, -1, -2, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, 0, 1, -2, 0, 0, 0, -1, -2, -2, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 1, 1, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, 0, -3, 0, -1, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -5, 0, 0, 0, -1, 0, 0, -1, 0, 0, -2, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, -2, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -6, -1, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, 0, 0, -2, 0, 0, 0, 0, -2, -2, 0, -1, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -2, 0, 0, -2, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, 0, 0, 0, 1, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, -1, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0,
+    0, -2, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, 0, -3, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -2, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 1, 0, 0, 0, 0, 2, 0, 0, 0, 3, 0,
+    0, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -2, -1, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, -1, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -1, -3, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -5, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, 0, -2, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0,
+    0, -2, 0, 0, -1, 0, 0, 0, -1, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1,
+    0, 0, 0, -1, 0, 0, -3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -3, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, 0, 0, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, -2, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const EpdLigaturePair notosans_18_regularLigatures[] = {
+    { 0x66, 0x66, 0xFB00 },
+    { 0x66, 0x69, 0xFB01 },
+    { 0x66, 0x6C, 0xFB02 },
+    { 0xFB00, 0x69, 0xFB03 },
+    { 0xFB00, 0x6C, 0xFB04 },
+};
+
+static const uint16_t notosans_18_regularGlyphLookup[368] = {
+    0x0000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0001, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F, 0x0010, 0x0011,
+    0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, 0x0020, 0x0021,
+    0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, 0x0030, 0x0031,
+    0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, 0x0040, 0x0041,
+    0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051,
+    0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, 0x0060, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070,
+    0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, 0x0080,
+    0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F, 0x0090,
+    0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F, 0x00A0,
+    0x00A1, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF, 0x00B0,
+    0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF, 0x00C0,
+    0x02B1, 0x02B2, 0x02B3, 0x02B4, 0x02B5, 0x02B6, 0x02B7, 0x02B8, 0x02B9, 0x02BA, 0x02BB, 0x02BC, 0x02BD, 0x02BE, 0x02BF, 0x02C0,
+    0x02C1, 0x02C2, 0x02C3, 0x02C4, 0x02C5, 0x02C6, 0x02C7, 0x02C8, 0x02C9, 0x02CA, 0x02CB, 0x02CC, 0x02CD, 0x02CE, 0x02CF, 0x02D0,
+    0x02D1, 0x02D2, 0x02D3, 0x02D4, 0x02D5, 0x02D6, 0x02D7, 0x02D8, 0x02D9, 0x02DA, 0x02DB, 0x02DC, 0x02DD, 0x02DE, 0x02DF, 0x02E0,
+    0x02E1, 0x02E2, 0x02E3, 0x02E4, 0x02E5, 0x02E6, 0x02E7, 0x02E8, 0x02E9, 0x02EA, 0x02EB, 0x02EC, 0x02ED, 0x02EE, 0x02EF, 0x02F0,
+    0x02F1, 0x02F2, 0x02F3, 0x02F4, 0x02F5, 0x02F6, 0x02F7, 0x02F8, 0x02F9, 0x02FA, 0x02FB, 0x02FC, 0x02FD, 0x02FE, 0x02FF, 0x0300,
+    0x0301, 0x0302, 0x0303, 0x0304, 0x0305, 0x0306, 0x0307, 0x0308, 0x0309, 0x030A, 0x030B, 0x030C, 0x030D, 0x030E, 0x030F, 0x0310,
+    0x0311, 0x0312, 0x0313, 0x0314, 0x0315, 0xFFFF, 0x0316, 0x0317, 0x0318, 0x0319, 0x031A, 0x031B, 0x031C, 0x031D, 0x031E, 0x031F,
 };
 
 static const EpdFontData notosans_18_regular = {
     notosans_18_regularBitmaps,
     notosans_18_regularGlyphs,
     notosans_18_regularIntervals,
-    15,
+    16,
     51,
     41,
     -11,
     true,
     notosans_18_regularGroups,
-    10,
+    4,
+    notosans_18_regularKernLeftClasses,
+    notosans_18_regularKernRightClasses,
+    notosans_18_regularKernMatrix,
+    71,
+    notosans_18_regularLigatures,
+    5,
+    0x4000000001ull,
+    notosans_18_regularGlyphLookup,
+    notosans_18_regularGlyphGroups,
+    false,
+    nullptr,
 };
@@ -3,1359 +3,1342 @@
  * name: opendyslexic_10_bold
  * size: 10
  * mode: 2-bit  compressed: true
- * Command used: fontconvert.py opendyslexic_10_bold 10 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Bold.otf --2bit --compress
+ * Command used: fontconvert.py opendyslexic_10_bold 10 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Bold.otf --2bit --compress --no-kerning --frequency-corpus ../../../test/hyphenation_eval/resources/english_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/french_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/german_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/italian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/russian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/spanish_hyphenation_tests.txt
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t opendyslexic_10_boldBitmaps[21544] = {
-    0x9D, 0x58, 0x31, 0x6C, 0xDE, 0xC6, 0x15, 0x7E, 0x24, 0x63, 0x11, 0x0D, 0x81, 0x32, 0x43, 0x52,
-    0x04, 0x32, 0x52, 0x76, 0xE8, 0xE4, 0x22, 0xE1, 0xD2, 0xA1, 0x83, 0xAC, 0xA3, 0x93, 0x16, 0x1E,
-    0x32, 0xC8, 0x05, 0xE2, 0x16, 0x9D, 0xDC, 0x21, 0x43, 0xEB, 0xC5, 0x4B, 0x87, 0x0E, 0x95, 0x8E,
-    0x89, 0x0B, 0x78, 0xC8, 0x60, 0x17, 0x48, 0xA7, 0x02, 0xB5, 0x07, 0x17, 0xB0, 0x95, 0x16, 0xCE,
-    0x50, 0xA0, 0x1E, 0x24, 0x1D, 0x1D, 0x01, 0xCD, 0xA0, 0xC1, 0x94, 0x3D, 0x78, 0x08, 0x50, 0x33,
-    0x95, 0x51, 0x23, 0xF6, 0xE0, 0x8B, 0x4D, 0xD7, 0x27, 0xE7, 0xC8, 0xD7, 0xEF, 0x1D, 0x7F, 0xAB,
-    0x4A, 0xD2, 0xA9, 0x24, 0x8F, 0xFC, 0x49, 0x1E, 0xEF, 0xDE, 0xBD, 0xF7, 0xBD, 0xEF, 0xBD, 0xF7,
-    0x13, 0xBD, 0x48, 0xBF, 0x8A, 0x6C, 0xD6, 0x94, 0xB4, 0x96, 0xD8, 0xBC, 0x51, 0xE4, 0x13, 0x5B,
-    0x34, 0x9A, 0x3C, 0x7D, 0x48, 0x15, 0x4D, 0xDB, 0xC9, 0x64, 0xC8, 0x9D, 0xFA, 0x94, 0xB7, 0x58,
-    0xEE, 0x72, 0xAF, 0x77, 0x86, 0xA2, 0xE7, 0xD4, 0xAB, 0x6B, 0x9C, 0x5B, 0xBD, 0xE9, 0x0B, 0x8B,
-    0x1B, 0x8A, 0xFA, 0xBC, 0x26, 0xCA, 0xDA, 0x15, 0xF4, 0x29, 0x8F, 0x38, 0x9C, 0x87, 0xAC, 0x23,
-    0x4A, 0x6C, 0x59, 0x91, 0x62, 0x6C, 0x9D, 0x9C, 0xF8, 0xA8, 0x9C, 0x3C, 0x65, 0x56, 0x49, 0xBF,
-    0x6B, 0x1E, 0xE7, 0x31, 0xB5, 0xE8, 0xE7, 0xCA, 0x86, 0x72, 0x79, 0x69, 0x8D, 0x9C, 0x4F, 0xCB,
-    0x69, 0x90, 0x7E, 0x10, 0xA3, 0x6C, 0x06, 0xF4, 0xE3, 0xB4, 0x47, 0x3F, 0x8F, 0x7E, 0xFB, 0x37,
-    0x99, 0x95, 0xDC, 0xEC, 0xC7, 0x41, 0xBE, 0x23, 0x83, 0x50, 0x82, 0xE9, 0x48, 0xDF, 0xFE, 0x2D,
-    0xBE, 0xC7, 0x2B, 0xB3, 0x54, 0x51, 0x3A, 0xE2, 0x63, 0x85, 0xD7, 0xC4, 0xDC, 0x53, 0x64, 0xD8,
-    0x52, 0xC4, 0x5C, 0x53, 0xB1, 0xE4, 0xE3, 0xDF, 0xF5, 0xAA, 0x35, 0x7C, 0xC2, 0x17, 0xB3, 0x79,
-    0xDB, 0x39, 0xC3, 0xE7, 0x88, 0x0A, 0x0C, 0x1A, 0x41, 0xB4, 0xF0, 0x83, 0x8E, 0x85, 0xD9, 0x0E,
-    0x84, 0x67, 0xD1, 0x31, 0x5A, 0x24, 0xAE, 0xB3, 0xE6, 0xD5, 0x57, 0x23, 0x97, 0x34, 0x9D, 0xA2,
-    0x85, 0x3C, 0x6B, 0x93, 0xED, 0xCE, 0x53, 0x39, 0x94, 0x98, 0xE2, 0x4C, 0x47, 0xD1, 0x31, 0xAF,
-    0x2B, 0x2A, 0xCF, 0xAF, 0x53, 0xF2, 0xB0, 0xB1, 0x34, 0x2C, 0xE4, 0x54, 0x6C, 0x6E, 0xDB, 0xA4,
-    0x2F, 0x47, 0xDA, 0x20, 0x6E, 0x8A, 0x06, 0xA3, 0xC8, 0xA0, 0xF1, 0x88, 0x19, 0x1E, 0xB4, 0x74,
-    0x18, 0x73, 0x2D, 0x50, 0x4F, 0x87, 0xD1, 0x54, 0x6C, 0xF1, 0xAC, 0xA3, 0x94, 0x2B, 0xCA, 0xB0,
-    0xF6, 0x92, 0x2B, 0xA7, 0xDE, 0xEC, 0xBC, 0x8E, 0x46, 0xA7, 0x6B, 0x6D, 0xF5, 0x53, 0xEE, 0xA0,
-    0x54, 0x97, 0xF3, 0x60, 0x63, 0x91, 0x35, 0xF7, 0x7C, 0xBD, 0xE7, 0x25, 0x39, 0x44, 0x15, 0x4D,
-    0xD6, 0xA6, 0x98, 0x2A, 0xF2, 0x34, 0x90, 0xA2, 0xB2, 0xCE, 0xDB, 0xC4, 0xE2, 0x46, 0xE3, 0x67,
-    0xD6, 0xC5, 0x8E, 0x0C, 0x15, 0x0D, 0xB4, 0x8E, 0x97, 0x75, 0x66, 0x23, 0x5C, 0x1A, 0x5C, 0x98,
-    0x54, 0x0B, 0x43, 0x9A, 0x5A, 0x06, 0x88, 0x1C, 0xA9, 0x2A, 0x74, 0x29, 0x9A, 0xA4, 0x87, 0xC4,
-    0xB8, 0xC8, 0x5D, 0x59, 0x85, 0x01, 0x36, 0x64, 0xD0, 0x0E, 0x2F, 0x64, 0x50, 0xD5, 0xE4, 0x6D,
-    0x66, 0x13, 0x1F, 0x0F, 0x18, 0x83, 0x2B, 0x5D, 0x07, 0x55, 0x65, 0x35, 0x25, 0xDD, 0xB1, 0x05,
-    0xE7, 0x14, 0x8F, 0x73, 0x30, 0x65, 0x31, 0x62, 0x19, 0xAE, 0x64, 0x93, 0x6C, 0x7D, 0x4C, 0x58,
-    0x1F, 0xBD, 0x2D, 0xBD, 0xF0, 0x23, 0x6B, 0x08, 0x3A, 0x5B, 0x4B, 0x02, 0x3E, 0xEE, 0x99, 0x55,
-    0x5A, 0x9B, 0x3D, 0x9D, 0xC7, 0x7B, 0x73, 0x03, 0xE0, 0x2A, 0x5B, 0x81, 0x5B, 0xF7, 0xD2, 0xF1,
-    0x9F, 0x30, 0x7F, 0xC1, 0xDC, 0xCC, 0xE7, 0x3B, 0xBB, 0xAC, 0x67, 0x38, 0x78, 0x85, 0xA4, 0x2F,
-    0x04, 0x11, 0x04, 0x44, 0x62, 0x65, 0x41, 0x1D, 0xD1, 0x8A, 0xA0, 0x31, 0x3C, 0x2F, 0x6A, 0x8A,
-    0xBF, 0xF4, 0x3C, 0x9F, 0x3D, 0x6F, 0x08, 0x4B, 0xC1, 0x3A, 0x49, 0x10, 0xB8, 0xB1, 0xFF, 0x79,
-    0xF2, 0xDF, 0xE7, 0x06, 0xCF, 0x61, 0x4E, 0x2F, 0x30, 0xC4, 0x8A, 0x88, 0xBE, 0x4F, 0xF4, 0x9C,
-    0x4C, 0x0C, 0x45, 0x61, 0x59, 0x43, 0xDE, 0xAC, 0x44, 0xAE, 0xFC, 0xA1, 0xCA, 0xB7, 0xAE, 0x6F,
-    0x3E, 0x7A, 0x68, 0xBD, 0x1F, 0x94, 0x52, 0x4B, 0xB7, 0xCE, 0xDE, 0x74, 0xA9, 0xE5, 0xA3, 0xBE,
-    0x64, 0xC6, 0xCA, 0x6A, 0x48, 0x9D, 0x73, 0x4B, 0xA2, 0x9B, 0x3F, 0x53, 0x09, 0x65, 0x37, 0x29,
-    0xD3, 0x8B, 0x5E, 0x24, 0xCA, 0x1B, 0x11, 0x2D, 0xFC, 0xC4, 0xCC, 0x9A, 0xBE, 0x35, 0xBE, 0xC5,
-    0xBC, 0xC3, 0x7C, 0x56, 0xF4, 0x56, 0x65, 0xEC, 0xF1, 0x7D, 0xD3, 0xA7, 0xFD, 0x0B, 0x22, 0x62,
-    0x59, 0x8B, 0x94, 0x19, 0xF4, 0xE3, 0x60, 0x74, 0x2A, 0x60, 0x91, 0x91, 0x0A, 0xBE, 0x9C, 0x31,
-    0x6F, 0xC2, 0x77, 0xC4, 0xB7, 0x8E, 0x03, 0xFE, 0x4E, 0xC0, 0x7D, 0x51, 0x56, 0xBD, 0x18, 0xF4,
-    0x02, 0x3C, 0x70, 0x17, 0x03, 0xF9, 0x57, 0x80, 0xA8, 0x1C, 0xD8, 0xF7, 0xDF, 0xFC, 0x11, 0xA7,
-    0xCC, 0x1F, 0x05, 0xBF, 0xB4, 0x07, 0x05, 0x43, 0xA2, 0x3B, 0x60, 0xCD, 0x54, 0xA4, 0x5B, 0x5A,
-    0xEC, 0x69, 0x71, 0x85, 0xCA, 0xA2, 0x2E, 0x8E, 0x76, 0xF9, 0xBB, 0x00, 0x9A, 0x48, 0xE4, 0x98,
-    0x47, 0x4A, 0xD0, 0x07, 0x4C, 0xA0, 0x1A, 0x19, 0x07, 0xDB, 0xFC, 0xEA, 0xC5, 0x92, 0xBD, 0x1C,
-    0x44, 0xD3, 0xA1, 0x3E, 0xAB, 0x94, 0xE0, 0xD3, 0xBF, 0x00, 0x68, 0x11, 0xE0, 0xCD, 0xDF, 0xFE,
-    0xE9, 0x58, 0xF2, 0x80, 0x27, 0x8A, 0x6D, 0x36, 0xC2, 0x2D, 0x06, 0x32, 0x5C, 0x19, 0x6E, 0xB1,
-    0x70, 0xF0, 0x43, 0xFE, 0xF7, 0x73, 0x58, 0x63, 0x05, 0xCF, 0x54, 0x2D, 0xE7, 0x5D, 0xBE, 0xD9,
-    0x27, 0xFD, 0x48, 0x83, 0xDA, 0x16, 0x11, 0x6B, 0xC3, 0x0D, 0xF4, 0x70, 0x68, 0xF5, 0x4F, 0x00,
-    0x92, 0x82, 0xC6, 0x45, 0x48, 0x2F, 0x06, 0x49, 0xBC, 0xD8, 0x29, 0x75, 0x94, 0xF5, 0x22, 0x0B,
-    0x8E, 0xD2, 0x92, 0xEA, 0xE4, 0xC0, 0x0A, 0x4C, 0x0B, 0x57, 0xA7, 0xA1, 0xE8, 0x56, 0xC8, 0x17,
-    0xB5, 0x4A, 0x6D, 0xD9, 0xC0, 0xB5, 0x53, 0x39, 0x86, 0xAC, 0x2F, 0x31, 0x87, 0xF3, 0xB4, 0x01,
-    0xCF, 0x3F, 0xCB, 0xBC, 0x0D, 0x1D, 0x14, 0xA0, 0x8C, 0x9F, 0x55, 0xC1, 0xC5, 0x8D, 0xC3, 0xA7,
-    0xF5, 0x7A, 0xDA, 0x2F, 0xD2, 0x62, 0x4E, 0xF9, 0x66, 0x13, 0xDB, 0x1E, 0xE2, 0x54, 0x06, 0xEC,
-    0x05, 0xA6, 0xE8, 0xE7, 0xA0, 0x65, 0x52, 0x73, 0xC7, 0x4A, 0xA8, 0xAF, 0x85, 0x06, 0x4B, 0x58,
-    0x16, 0x9B, 0x3A, 0xED, 0xD5, 0xC7, 0xDE, 0x84, 0xDF, 0x90, 0x4C, 0x6D, 0x7A, 0xBD, 0x35, 0xE4,
-    0x9D, 0x7A, 0x87, 0x33, 0x5F, 0xDA, 0x19, 0x5F, 0xBD, 0xF4, 0x63, 0x3E, 0xED, 0x73, 0x6B, 0x4E,
-    0x0F, 0xB9, 0x3D, 0x59, 0xCF, 0x1E, 0xA6, 0xF8, 0x51, 0x02, 0x64, 0x98, 0x18, 0x76, 0x82, 0x9F,
-    0xD4, 0x64, 0xA0, 0x37, 0x05, 0x14, 0xE6, 0xE0, 0x2C, 0x68, 0xE1, 0x0E, 0xCD, 0x41, 0x46, 0x12,
-    0x47, 0xA2, 0x18, 0x36, 0xA4, 0xE8, 0xDC, 0x81, 0x93, 0x97, 0x0A, 0xD1, 0xE8, 0xF8, 0x62, 0x18,
-    0xE3, 0x79, 0x31, 0x02, 0x74, 0x7C, 0x59, 0x6E, 0x7E, 0x20, 0xE2, 0x40, 0x10, 0x85, 0xEE, 0x32,
-    0x22, 0x69, 0x68, 0x3D, 0x85, 0xFD, 0x49, 0x3B, 0x0C, 0xE2, 0x30, 0x98, 0x37, 0x3C, 0x42, 0xE5,
-    0x15, 0x89, 0xED, 0xEF, 0xCC, 0x04, 0x89, 0x2E, 0x02, 0x3C, 0x3D, 0xC0, 0xD3, 0x42, 0x31, 0xD4,
-    0x8A, 0x7B, 0x14, 0x33, 0xE7, 0x6A, 0x28, 0x9A, 0x9C, 0xA2, 0xB0, 0x02, 0xBB, 0x04, 0x5F, 0x02,
-    0x03, 0x89, 0x0F, 0x50, 0x10, 0x7F, 0xF9, 0xEE, 0x97, 0x78, 0x19, 0x96, 0x15, 0xBE, 0x06, 0x07,
-    0x02, 0xA9, 0x74, 0xF2, 0x59, 0x30, 0xA1, 0xF2, 0x8E, 0x2C, 0x80, 0xC5, 0xA9, 0x30, 0xF2, 0x22,
-    0xC5, 0x9D, 0x8C, 0x6E, 0x23, 0xBB, 0xD8, 0xFE, 0x3A, 0xE9, 0x9E, 0x74, 0x0B, 0x49, 0xDB, 0x74,
-    0x0B, 0xE9, 0x76, 0x38, 0x5D, 0xB3, 0x7F, 0x85, 0x13, 0x7D, 0x0E, 0x2A, 0xD3, 0xDC, 0x62, 0xAA,
-    0xD7, 0x40, 0xDA, 0xF5, 0x1C, 0x0C, 0x24, 0x03, 0x14, 0x22, 0x7C, 0x2C, 0x24, 0x4E, 0x73, 0xEF,
-    0x63, 0x50, 0x89, 0x25, 0x10, 0x05, 0x54, 0x2F, 0xCE, 0x69, 0x45, 0x75, 0x15, 0x45, 0xBB, 0x22,
-    0xF4, 0x52, 0x03, 0x57, 0xC6, 0x63, 0x03, 0x87, 0xCE, 0x5B, 0x55, 0x45, 0x1E, 0x02, 0x83, 0x40,
-    0x9B, 0x44, 0x82, 0x0C, 0x46, 0xB3, 0x12, 0x7A, 0xA2, 0x11, 0x60, 0x82, 0xD6, 0x10, 0xD3, 0x80,
-    0x72, 0xC4, 0x80, 0x4C, 0xD0, 0xF7, 0xC1, 0x90, 0xD9, 0xD4, 0x1A, 0x52, 0xA0, 0x38, 0x5C, 0x0C,
-    0x1E, 0x36, 0x06, 0x10, 0x02, 0x5A, 0x0D, 0xE9, 0x2D, 0xD0, 0x27, 0xD8, 0xF4, 0xFE, 0xD3, 0x0F,
-    0xF0, 0x01, 0x7F, 0x12, 0xD4, 0xCA, 0x6F, 0x06, 0xA1, 0x44, 0x9D, 0x30, 0x28, 0x6C, 0x84, 0x19,
-    0x3C, 0x04, 0x75, 0xA2, 0xB3, 0x4C, 0x74, 0x09, 0xC5, 0x40, 0x8B, 0xA1, 0x95, 0xCF, 0x9A, 0x3C,
-    0x1B, 0xAB, 0x5F, 0x40, 0x10, 0x87, 0xB1, 0xC5, 0xE9, 0x7D, 0x24, 0xEE, 0x5C, 0xCA, 0x90, 0x77,
-    0x44, 0x48, 0x38, 0x0C, 0xE0, 0xB7, 0x8A, 0x08, 0x49, 0xB9, 0x33, 0x50, 0x3D, 0xA8, 0x69, 0xF8,
-    0x7A, 0x8B, 0xD1, 0x4E, 0x89, 0x18, 0xD2, 0x9C, 0x99, 0x22, 0x2A, 0x44, 0xDE, 0xA5, 0x43, 0x86,
-    0x97, 0x02, 0x4F, 0x74, 0x43, 0xB0, 0x24, 0x98, 0x04, 0x14, 0x8E, 0x59, 0x1A, 0x2D, 0xF8, 0xF7,
-    0xE9, 0x2E, 0x89, 0xC7, 0xC2, 0x66, 0xC5, 0xBD, 0x55, 0x2C, 0xE2, 0xE1, 0x34, 0xC6, 0x29, 0x7C,
-    0x30, 0xCF, 0xC3, 0xCC, 0x83, 0x6B, 0xF9, 0x52, 0x0E, 0xB6, 0xB3, 0x63, 0xF5, 0x02, 0x6E, 0xF5,
-    0xBE, 0x03, 0xCC, 0x38, 0x1D, 0x14, 0x1D, 0x17, 0xFC, 0x05, 0x3D, 0x7B, 0xF8, 0x14, 0x37, 0xF0,
-    0xFC, 0x97, 0x13, 0x31, 0x90, 0xD0, 0x77, 0x2A, 0x71, 0x5B, 0x28, 0x31, 0x73, 0xD1, 0x67, 0x95,
-    0xA9, 0x0B, 0xDE, 0x82, 0xE7, 0x0D, 0xBA, 0x39, 0x60, 0x76, 0x40, 0x34, 0xBD, 0x1A, 0x8F, 0x73,
-    0x24, 0x29, 0x01, 0x14, 0xC2, 0x55, 0x29, 0x41, 0x5D, 0x98, 0x4A, 0x55, 0x89, 0xDF, 0x6B, 0x75,
-    0xE2, 0xF5, 0xFF, 0x6A, 0x0D, 0x1A, 0x26, 0x9D, 0x35, 0x31, 0xCE, 0x60, 0xEE, 0xC1, 0x48, 0x4D,
-    0xBA, 0xD7, 0xF4, 0x89, 0x5B, 0x8F, 0xBD, 0xCA, 0x37, 0x2D, 0x4E, 0x37, 0xFB, 0x41, 0x9D, 0xB8,
-    0xBB, 0x3B, 0x9A, 0x07, 0x76, 0x52, 0x40, 0x2B, 0xAC, 0x22, 0x98, 0xDA, 0xE3, 0x3A, 0xC1, 0xB8,
-    0x38, 0x65, 0x2D, 0x2F, 0xD3, 0xE9, 0xA5, 0x09, 0x51, 0x41, 0x5E, 0xFA, 0x6F, 0xC4, 0xE3, 0x44,
-    0x62, 0x50, 0x66, 0x5B, 0x4C, 0x8C, 0x90, 0x77, 0xBA, 0xC9, 0x3B, 0xAE, 0xF2, 0x6D, 0xA6, 0xFC,
-    0xA6, 0xA7, 0x1C, 0xEB, 0x2B, 0x6E, 0xDB, 0x10, 0xEF, 0x4B, 0x46, 0xDC, 0xC3, 0xE0, 0xE5, 0x38,
-    0xB9, 0xA9, 0x12, 0x87, 0xC2, 0x67, 0x8A, 0x1D, 0xE9, 0xF3, 0x23, 0xE9, 0xF7, 0xB8, 0xD6, 0xA7,
-    0x61, 0xBC, 0x1A, 0x8E, 0x0D, 0x06, 0xEF, 0xF6, 0x09, 0x90, 0x7F, 0xF5, 0xA6, 0xDF, 0x33, 0x5C,
-    0x2B, 0xFA, 0xFE, 0xF7, 0xB4, 0xE2, 0x53, 0xE2, 0xC7, 0xE0, 0xC3, 0x4D, 0x06, 0xEC, 0x54, 0x4F,
-    0x30, 0x7D, 0x5D, 0x0C, 0x0A, 0xD8, 0xBA, 0x09, 0x7E, 0x86, 0x35, 0x33, 0xBE, 0xC5, 0x3D, 0x14,
-    0x6E, 0xCE, 0x3F, 0xB8, 0xF5, 0x84, 0x87, 0x51, 0x9F, 0xE2, 0xDB, 0x77, 0x1F, 0xF3, 0xEE, 0xA8,
-    0x97, 0xB8, 0xBC, 0xEB, 0xCC, 0xC3, 0xD1, 0x9C, 0x19, 0xD5, 0x7D, 0xA7, 0x6E, 0xB2, 0xF9, 0xC8,
-    0xAB, 0x2F, 0xE0, 0x17, 0x92, 0x04, 0x22, 0xE5, 0x43, 0x43, 0x7A, 0x51, 0xB8, 0xC8, 0x97, 0x1E,
-    0x6D, 0x8C, 0x41, 0x3E, 0x31, 0xC8, 0xE8, 0x5D, 0xAF, 0x1E, 0xA0, 0xE7, 0xF5, 0x1D, 0xA7, 0xB6,
-    0x1E, 0xE1, 0xBB, 0x27, 0x4E, 0xDD, 0x60, 0xA7, 0xB7, 0xB9, 0xD7, 0xAD, 0x34, 0xDD, 0x9B, 0x56,
-    0xF5, 0xA6, 0x03, 0xDC, 0x0F, 0x8E, 0xE2, 0xA2, 0xA3, 0xC8, 0x0B, 0x6C, 0xD4, 0xBA, 0x2B, 0xC1,
-    0xD8, 0x6F, 0x78, 0xA0, 0x02, 0xEB, 0x50, 0x5B, 0x16, 0x0A, 0x86, 0x7A, 0x8B, 0x2D, 0x89, 0x56,
-    0xA2, 0x67, 0xE8, 0x0E, 0x36, 0x7D, 0x3C, 0x27, 0x00, 0x96, 0x44, 0x22, 0x28, 0x9B, 0x6D, 0x80,
-    0xD6, 0x1C, 0xD0, 0x1D, 0xB6, 0xF9, 0xCB, 0x88, 0x98, 0x03, 0x9C, 0xAD, 0x1D, 0x22, 0x00, 0xA4,
-    0x5C, 0x6A, 0xB3, 0x9D, 0x3E, 0x45, 0xE0, 0xC2, 0x6A, 0x19, 0xBE, 0xF5, 0x06, 0xDC, 0x9C, 0xDF,
-    0x17, 0xD0, 0x15, 0x48, 0xAF, 0x10, 0x46, 0xB0, 0x1E, 0xD3, 0xD0, 0x1E, 0x3D, 0x93, 0x16, 0x3F,
-    0x04, 0x29, 0x44, 0xC2, 0x0C, 0x45, 0x0F, 0x77, 0xE5, 0x2A, 0x75, 0x40, 0x6A, 0x8E, 0x00, 0x02,
-    0xF5, 0x0A, 0x1C, 0x20, 0x24, 0x8D, 0x01, 0x11, 0x82, 0x0C, 0x10, 0xE5, 0x05, 0x7D, 0x04, 0x51,
-    0x5E, 0x7C, 0x96, 0x3B, 0xC1, 0xAA, 0x24, 0xA1, 0x4E, 0x4E, 0xAD, 0xD0, 0x36, 0xA0, 0x90, 0x4D,
-    0x27, 0x60, 0xFE, 0xF9, 0xD5, 0x1A, 0xF4, 0x2E, 0xB4, 0x55, 0x1E, 0xF7, 0xB1, 0x4D, 0x90, 0x3C,
-    0xAA, 0x04, 0xCC, 0x22, 0x97, 0xC7, 0x27, 0x24, 0x6A, 0x0A, 0x8A, 0xE4, 0x82, 0xD0, 0xA5, 0x1B,
-    0x93, 0xFA, 0xAC, 0xC7, 0xE5, 0x8C, 0xCF, 0xBC, 0x69, 0xCC, 0x2D, 0x9F, 0x8D, 0xF4, 0xBD, 0xB1,
-    0x8E, 0x26, 0x9F, 0xAA, 0x32, 0x37, 0x27, 0xF6, 0x9F, 0x5A, 0x2F, 0x53, 0x9C, 0x93, 0xE4, 0x17,
-    0xA4, 0x8E, 0x60, 0x91, 0x49, 0x98, 0x42, 0xDA, 0x85, 0x14, 0x33, 0x3D, 0x17, 0x73, 0x3E, 0xFE,
-    0x01, 0xF1, 0x33, 0xB8, 0x83, 0x9D, 0xE3, 0xA7, 0x53, 0x6E, 0xBF, 0xBA, 0x7A, 0x19, 0x40, 0x19,
-    0x9F, 0xB5, 0x10, 0xD3, 0xFF, 0x8F, 0x06, 0x77, 0xF2, 0xFB, 0x9B, 0xAE, 0xBF, 0xDA, 0x82, 0x5B,
-    0xBA, 0xA9, 0x81, 0x65, 0x9B, 0x0C, 0x79, 0x21, 0xE2, 0x3D, 0x5A, 0x39, 0xD1, 0x6F, 0x1B, 0x8B,
-    0xDC, 0x62, 0x01, 0xD8, 0x7A, 0xD3, 0x4D, 0xCA, 0xD5, 0xAF, 0x0F, 0x18, 0xBE, 0xE8, 0x24, 0xB1,
-    0xA4, 0xB2, 0xCD, 0x1C, 0x82, 0x00, 0xB4, 0xD1, 0xA0, 0x24, 0xE9, 0xA9, 0xFC, 0x94, 0x61, 0x26,
-    0x65, 0x03, 0x8A, 0xB0, 0x62, 0x90, 0x7C, 0x08, 0xCC, 0x20, 0xDF, 0x84, 0x85, 0x52, 0x05, 0xAB,
-    0xE0, 0x0C, 0x09, 0x3E, 0xF1, 0x25, 0x21, 0x1C, 0xF0, 0x85, 0xD0, 0x8E, 0x97, 0xD0, 0x08, 0x01,
-    0x82, 0xD2, 0x4A, 0x9B, 0xB5, 0x98, 0xC2, 0x86, 0xD6, 0x97, 0x7D, 0xD9, 0xE5, 0xBD, 0x42, 0x8F,
-    0xCC, 0x99, 0x41, 0x61, 0x29, 0x8C, 0x4C, 0x13, 0x10, 0x65, 0x53, 0x27, 0xA2, 0xA3, 0x2A, 0x91,
-    0x98, 0x8B, 0xB8, 0x23, 0xE7, 0x88, 0x7B, 0xD1, 0x2F, 0xE4, 0x97, 0xA4, 0xA8, 0x43, 0x42, 0x06,
-    0x8C, 0x68, 0x89, 0x2D, 0x95, 0xAE, 0x90, 0x16, 0xDB, 0xA2, 0x8D, 0x90, 0xD0, 0x50, 0x09, 0x9F,
-    0x4F, 0x24, 0xFA, 0x1A, 0x61, 0xFF, 0x10, 0xC2, 0xC1, 0x8D, 0x22, 0xE3, 0x33, 0xC9, 0xF5, 0x6D,
-    0x4F, 0xA8, 0xB1, 0x6A, 0x65, 0x15, 0x64, 0x48, 0xB8, 0x40, 0xD0, 0xE8, 0xE0, 0x07, 0x28, 0xB1,
-    0x48, 0x1F, 0x91, 0x0C, 0x5D, 0x35, 0x58, 0x7F, 0x8F, 0x5B, 0x06, 0x31, 0x95, 0x20, 0x93, 0x64,
-    0x94, 0x88, 0x16, 0x02, 0xA1, 0x2C, 0x18, 0x0B, 0xD3, 0x33, 0x14, 0x24, 0xA1, 0x5C, 0xAA, 0xA6,
-    0x14, 0xA0, 0xC0, 0x83, 0x74, 0x08, 0xE1, 0x52, 0x32, 0x51, 0xA1, 0xA7, 0xA0, 0x6F, 0x49, 0x68,
-    0x87, 0x89, 0x7E, 0xA4, 0x15, 0xFC, 0xAC, 0x55, 0x61, 0xC0, 0xA9, 0x49, 0x4D, 0x76, 0x4F, 0x92,
-    0x4B, 0xC9, 0x14, 0x43, 0x20, 0x19, 0xC4, 0xF1, 0x9A, 0xF9, 0xCB, 0xE5, 0x88, 0xBD, 0x2A, 0x2B,
-    0x55, 0x01, 0xB9, 0x5F, 0xD9, 0x35, 0xF6, 0x95, 0xB0, 0x6F, 0x84, 0x7D, 0x3D, 0xEC, 0x7C, 0x89,
-    0xBD, 0xEC, 0x53, 0x35, 0xF5, 0x21, 0x76, 0x87, 0xD0, 0xBF, 0x8C, 0x1C, 0x00, 0x25, 0x4A, 0x55,
-    0x34, 0xA8, 0x5A, 0x3A, 0xA9, 0x5A, 0x62, 0x17, 0xEA, 0x96, 0x11, 0x9F, 0x2C, 0x20, 0x91, 0xF9,
-    0x0E, 0xD1, 0xEA, 0x05, 0xB0, 0x54, 0x1F, 0xCB, 0x9B, 0x67, 0x3B, 0x48, 0x87, 0xBE, 0xBE, 0x23,
-    0x1D, 0x9F, 0x4D, 0xB6, 0x71, 0x68, 0x54, 0x61, 0x9F, 0xBC, 0xFA, 0xB0, 0x50, 0x75, 0x8C, 0x1C,
-    0xFC, 0x2E, 0x1C, 0x6D, 0x2D, 0xE4, 0x27, 0x2C, 0x16, 0x9C, 0x5A, 0xB8, 0xAF, 0xC4, 0x6C, 0x75,
-    0x74, 0x49, 0x8A, 0x92, 0xDD, 0x3E, 0x07, 0x36, 0xAF, 0xB8, 0xC3, 0xB1, 0x5B, 0x8B, 0xFC, 0x55,
-    0xF2, 0x28, 0x74, 0xAE, 0x82, 0x85, 0xA4, 0xBB, 0xC4, 0xC1, 0xB9, 0x61, 0xE5, 0x72, 0xC8, 0x5C,
-    0x51, 0x61, 0x48, 0x92, 0xBD, 0x0E, 0xBD, 0x21, 0xBF, 0xFA, 0xC4, 0x4D, 0xB1, 0xD4, 0xE5, 0x7D,
-    0x91, 0xB8, 0x04, 0x51, 0x76, 0x0D, 0x14, 0x84, 0x44, 0x67, 0x93, 0xAF, 0x40, 0x77, 0x7D, 0x21,
-    0x69, 0x40, 0x4F, 0x07, 0x02, 0xCC, 0xE7, 0x46, 0x62, 0x78, 0xB3, 0xD5, 0x52, 0x84, 0x60, 0x1C,
-    0xC4, 0xD0, 0x0D, 0xB0, 0xF8, 0x73, 0x48, 0xDE, 0x53, 0x76, 0xB1, 0x44, 0x4F, 0x15, 0xD2, 0x2E,
-    0x29, 0x5A, 0xFC, 0xEC, 0xA6, 0xD8, 0xB1, 0x21, 0xD9, 0xE6, 0xBC, 0xE1, 0x33, 0x4D, 0xF1, 0x4F,
-    0x2B, 0x49, 0x2C, 0xEC, 0x60, 0xCE, 0x84, 0x44, 0xDE, 0x89, 0x27, 0x98, 0xF3, 0x4D, 0xB4, 0x01,
-    0x16, 0xEC, 0xCA, 0x77, 0x9C, 0x3A, 0xBE, 0xA6, 0x25, 0x14, 0x0C, 0x43, 0x28, 0x70, 0xF4, 0xBD,
-    0xBF, 0x60, 0x01, 0xA8, 0x1A, 0x23, 0x03, 0x97, 0x42, 0x11, 0xC2, 0x17, 0x14, 0xCA, 0x03, 0xC5,
-    0xD7, 0xF9, 0x11, 0xFB, 0x5C, 0x4A, 0x3C, 0x29, 0xE8, 0x50, 0x1C, 0xF6, 0x88, 0x27, 0xBA, 0x42,
-    0x34, 0x89, 0x87, 0x15, 0x0C, 0xAA, 0xAE, 0x8C, 0xCB, 0xC9, 0x78, 0x35, 0x1E, 0xAF, 0x46, 0x03,
-    0x5E, 0xE1, 0xBC, 0x8E, 0xF8, 0x29, 0xA4, 0x8A, 0xD1, 0x7C, 0x3C, 0x42, 0x3E, 0xFF, 0x32, 0xDC,
-    0x5A, 0x12, 0x82, 0x56, 0x03, 0x3A, 0x6F, 0xED, 0xD3, 0xCE, 0xB0, 0xB7, 0x92, 0x27, 0x03, 0xC0,
-    0xDE, 0x21, 0x8E, 0x40, 0x27, 0x47, 0x6D, 0xF2, 0xA9, 0x27, 0x87, 0xF2, 0xB1, 0x6C, 0xF2, 0x2D,
-    0x9B, 0x3E, 0xF4, 0xE0, 0xFB, 0xCA, 0xA8, 0x16, 0x40, 0x3F, 0x2D, 0xC9, 0xF3, 0x21, 0xC9, 0x1F,
-    0x2E, 0x14, 0x47, 0x7A, 0x39, 0x5E, 0xEF, 0x4B, 0x1C, 0xA7, 0x85, 0x13, 0xDE, 0x12, 0xDC, 0x44,
-    0x7E, 0xC6, 0xD7, 0x72, 0x87, 0x1D, 0x90, 0xE8, 0x67, 0xBB, 0x8D, 0xB1, 0x27, 0xC8, 0xD9, 0x50,
-    0x27, 0x77, 0xE0, 0xF6, 0x99, 0x24, 0xFB, 0xD5, 0x38, 0xDD, 0x6C, 0xD0, 0xA2, 0x11, 0xCC, 0xA3,
-    0xCA, 0x46, 0x5A, 0x29, 0xCC, 0x0F, 0x66, 0xCE, 0xA0, 0xFB, 0x5D, 0xA4, 0x7D, 0xA5, 0x47, 0xD8,
-    0x9C, 0xFE, 0x10, 0xC9, 0x6B, 0x54, 0x78, 0x69, 0x57, 0x54, 0xEB, 0x71, 0x9F, 0xB5, 0xA5, 0x5C,
-    0x90, 0x44, 0x3A, 0xA8, 0x6C, 0x2A, 0x41, 0x8B, 0x2B, 0xAD, 0x46, 0x76, 0xB2, 0x0B, 0x8D, 0x3F,
-    0xE5, 0xFB, 0xBD, 0x6A, 0x74, 0x8D, 0xBC, 0x44, 0x55, 0x5E, 0x7C, 0x03, 0x27, 0x4D, 0x5E, 0x57,
-    0x06, 0x27, 0x1A, 0x25, 0x92, 0x8D, 0x92, 0x31, 0x0E, 0xD1, 0xC0, 0xD1, 0x10, 0x8B, 0xA3, 0x2E,
-    0x6A, 0x18, 0xA0, 0x87, 0x52, 0x54, 0xB5, 0xA6, 0x69, 0x79, 0x85, 0x96, 0x35, 0x6D, 0xE0, 0x40,
-    0x4F, 0x43, 0x6C, 0xA4, 0x8A, 0x61, 0x18, 0x34, 0x87, 0x6E, 0xEF, 0x43, 0x5D, 0x03, 0xC0, 0x3D,
-    0xD0, 0x0A, 0xCE, 0xE6, 0x08, 0x4C, 0x00, 0x30, 0xC0, 0xEA, 0x16, 0x1D, 0x28, 0xAA, 0xA2, 0xA7,
-    0x08, 0xF0, 0xD2, 0xFF, 0x1A, 0x88, 0x22, 0x6D, 0x98, 0x16, 0x72, 0x9B, 0xE0, 0x72, 0x38, 0xDC,
-    0xFD, 0x4B, 0xFE, 0xE1, 0x78, 0x07, 0x6E, 0x0C, 0x08, 0x25, 0xEE, 0x97, 0x92, 0x3B, 0x24, 0x7D,
-    0xE0, 0xDB, 0x6C, 0xAA, 0x7F, 0xA7, 0xBA, 0xBD, 0x97, 0xEA, 0xA7, 0xCB, 0xEE, 0x73, 0xFD, 0x9B,
-    0x64, 0x88, 0x6D, 0xDA, 0x67, 0x75, 0xD1, 0x8A, 0x93, 0xC2, 0x03, 0x62, 0x19, 0x37, 0xD4, 0xB2,
-    0x12, 0xE3, 0x3C, 0x65, 0x5F, 0x7C, 0x2E, 0x14, 0x01, 0xB5, 0xFA, 0x40, 0xB5, 0xC9, 0x9D, 0x50,
-    0x1C, 0x97, 0x57, 0xDE, 0x44, 0xBD, 0xE8, 0x10, 0xC7, 0xE4, 0xAF, 0x87, 0x5E, 0xFE, 0x68, 0xA8,
-    0x8A, 0x2E, 0xF3, 0x71, 0xF8, 0x0B, 0x29, 0x06, 0x53, 0x82, 0x82, 0xAA, 0x63, 0x39, 0x0C, 0xB3,
-    0x8B, 0x5B, 0x4B, 0x07, 0x43, 0x44, 0xFD, 0xBD, 0xD4, 0x77, 0x86, 0xDD, 0xF3, 0xB3, 0xF4, 0x99,
-    0xA2, 0x4E, 0x8C, 0xB7, 0x2E, 0x28, 0x62, 0x06, 0xC4, 0xE7, 0xC7, 0x4B, 0x18, 0x6D, 0x5F, 0xC1,
-    0x8C, 0x0C, 0x56, 0x89, 0x1F, 0xC9, 0x18, 0xF2, 0xC8, 0xAF, 0xD1, 0xB0, 0x77, 0x2C, 0x87, 0x43,
-    0x47, 0x83, 0xBA, 0x8B, 0x81, 0xC7, 0x82, 0xC7, 0x74, 0x1C, 0x37, 0xF0, 0x19, 0x68, 0xFA, 0x5D,
-    0x27, 0x96, 0xCD, 0x3A, 0x94, 0x67, 0x55, 0x71, 0x03, 0xDC, 0x7B, 0x1D, 0x79, 0x3F, 0xA4, 0x43,
-    0xD8, 0x8E, 0x43, 0x20, 0x91, 0xFF, 0x54, 0x44, 0x27, 0xC5, 0x6D, 0x2C, 0x70, 0xC7, 0x1E, 0x48,
-    0xFA, 0x21, 0xBF, 0xE6, 0xCB, 0xF7, 0xDC, 0x46, 0xFA, 0x88, 0x95, 0x64, 0x1E, 0x8D, 0x9A, 0x32,
-    0x53, 0x38, 0xFD, 0x03, 0x2C, 0xF0, 0x11, 0x34, 0x82, 0x48, 0x1D, 0x5D, 0x9C, 0x3B, 0x07, 0xB1,
-    0xE0, 0xAA, 0x2D, 0x6A, 0xF3, 0xEB, 0xC8, 0xBE, 0x78, 0x4A, 0x2A, 0x4C, 0x1D, 0x92, 0x27, 0xDC,
-    0x0A, 0x71, 0x97, 0x3B, 0x48, 0x52, 0x12, 0x24, 0x52, 0x08, 0xEB, 0xA8, 0x30, 0x41, 0x6D, 0x65,
-    0xA3, 0xAA, 0x01, 0x22, 0xD9, 0x15, 0x52, 0x67, 0xDB, 0x78, 0x40, 0xB6, 0x28, 0x65, 0x60, 0x3F,
-    0x7D, 0x65, 0x43, 0x82, 0x57, 0x84, 0x82, 0x6B, 0x5E, 0xF2, 0x07, 0x2B, 0xEC, 0x1D, 0x87, 0x14,
-    0x4A, 0x68, 0xBD, 0x39, 0x69, 0x3A, 0x49, 0x69, 0xA4, 0x38, 0x0B, 0x75, 0xF0, 0x74, 0xC0, 0xE0,
-    0x90, 0xF0, 0x86, 0x70, 0x5C, 0xE1, 0x62, 0x6E, 0xF3, 0xA7, 0x24, 0xD5, 0x8F, 0xFC, 0xB1, 0x81,
-    0xB1, 0x8C, 0x54, 0x98, 0x92, 0x48, 0xD0, 0x81, 0x51, 0x12, 0x4A, 0x44, 0x2A, 0x60, 0x62, 0x94,
-    0x39, 0x32, 0xAE, 0x10, 0xD9, 0x0A, 0x49, 0xD0, 0x17, 0x65, 0x3B, 0x2C, 0xDB, 0xF2, 0xF2, 0xF2,
-    0x6F, 0xC2, 0x86, 0xC8, 0x69, 0x6C, 0x74, 0xA5, 0x93, 0x70, 0x67, 0x68, 0x6F, 0x3C, 0x8C, 0xA6,
-    0xC0, 0x2B, 0x35, 0x62, 0x10, 0xD8, 0x6C, 0x10, 0x74, 0xC9, 0x90, 0x15, 0xD2, 0x5B, 0xC9, 0xD3,
-    0xC4, 0xA2, 0xAF, 0xBD, 0xA2, 0xFF, 0xF8, 0xB7, 0x7F, 0x7C, 0xEE, 0x7F, 0xFE, 0xF6, 0x7F, 0x00,
-    0xB5, 0x59, 0x4F, 0x6C, 0xDF, 0x76, 0x15, 0x7F, 0xB6, 0xDB, 0x18, 0x62, 0x86, 0x27, 0xD4, 0x5E,
-    0x32, 0x81, 0x77, 0xE0, 0x00, 0x13, 0x9B, 0x77, 0xE0, 0xB0, 0x43, 0x9B, 0xAF, 0x4B, 0x0F, 0x93,
-    0xA8, 0x50, 0x2A, 0x58, 0xC5, 0x69, 0x2A, 0x47, 0x16, 0x09, 0xE5, 0x32, 0x0D, 0x90, 0x96, 0xDA,
-    0x6D, 0x24, 0x90, 0x40, 0x62, 0x3D, 0x00, 0x17, 0x0E, 0xED, 0xA4, 0x20, 0xD1, 0x4C, 0x5B, 0x38,
-    0x54, 0x53, 0x85, 0x7E, 0x89, 0xDD, 0x45, 0xA2, 0x87, 0x1C, 0xE2, 0xAE, 0x43, 0x39, 0xF4, 0x50,
-    0xF7, 0x8F, 0xA8, 0xB4, 0x22, 0xFA, 0x5D, 0xE7, 0xB6, 0x4E, 0xFB, 0xB5, 0x1F, 0x9F, 0xF7, 0xF5,
-    0x2F, 0x4D, 0xB6, 0xB5, 0x23, 0x9D, 0x16, 0xEB, 0x6B, 0xE7, 0xE7, 0xAF, 0xBF, 0x7E, 0xEF, 0xFB,
-    0xFE, 0x7D, 0xDE, 0x7B, 0x4E, 0xAA, 0x79, 0x89, 0x03, 0x13, 0x57, 0x93, 0x09, 0xF5, 0xC7, 0x0E,
-    0xFA, 0x7B, 0x50, 0xAA, 0xA4, 0xF5, 0xEA, 0xB0, 0x8C, 0x93, 0x05, 0xB7, 0xF6, 0xCB, 0x28, 0x99,
-    0xA6, 0xDA, 0xCB, 0xBE, 0x22, 0x8F, 0x77, 0x11, 0x69, 0xF2, 0x0A, 0x0A, 0xC9, 0xE1, 0x4C, 0xB1,
-    0xC7, 0xFF, 0x89, 0x56, 0x68, 0x71, 0x8F, 0x5B, 0x57, 0xE1, 0x85, 0x2C, 0xFE, 0x03, 0xE5, 0xBF,
-    0x26, 0xEE, 0x1C, 0xEE, 0x28, 0xBF, 0x46, 0x2F, 0x10, 0x55, 0xE4, 0x67, 0x43, 0xC2, 0x23, 0x1D,
-    0xB9, 0xDC, 0x52, 0xFE, 0x17, 0x1D, 0x14, 0x5F, 0xA5, 0x33, 0x44, 0x7E, 0x41, 0xB4, 0x97, 0xC8,
-    0xAB, 0x88, 0x62, 0x22, 0xC5, 0xAD, 0xC7, 0x5C, 0xD2, 0x80, 0x28, 0x28, 0xC8, 0x31, 0xA0, 0x5F,
-    0x60, 0xF2, 0x1E, 0x26, 0x1B, 0x25, 0x0F, 0xB0, 0xB3, 0xEF, 0x7B, 0x65, 0xC8, 0xEC, 0x30, 0x6B,
-    0x1F, 0x94, 0x16, 0xC3, 0x32, 0x28, 0x17, 0x29, 0x0F, 0xAB, 0x80, 0x5B, 0x4C, 0xD6, 0x58, 0x56,
-    0xAC, 0xFD, 0x59, 0x3B, 0x58, 0xB9, 0x9B, 0xE8, 0xA5, 0xB8, 0xF0, 0x9A, 0x50, 0x87, 0xDA, 0x33,
-    0xAA, 0xC0, 0xE3, 0x84, 0xF2, 0x0E, 0x6C, 0x0C, 0x51, 0x08, 0x09, 0x98, 0xC9, 0x67, 0xCE, 0x46,
-    0xE7, 0xBB, 0x8C, 0x42, 0xEC, 0x20, 0xBC, 0x27, 0x73, 0x09, 0xE6, 0x8A, 0xD1, 0x79, 0xDC, 0x47,
-    0xC3, 0x13, 0xC7, 0xF7, 0x3E, 0xBE, 0x34, 0x7D, 0x27, 0x21, 0xEF, 0x9D, 0x7F, 0xDC, 0x78, 0xFB,
-    0xDD, 0xD2, 0x4E, 0x71, 0xE1, 0x71, 0xED, 0x17, 0xA7, 0x83, 0xE2, 0x69, 0xBF, 0x4B, 0x3C, 0xD6,
-    0x21, 0x37, 0x61, 0x62, 0xA2, 0x3F, 0x99, 0x90, 0x4D, 0xC0, 0xB5, 0xC3, 0x9A, 0x7C, 0xB3, 0x83,
-    0x4C, 0xF4, 0x6F, 0xA3, 0xB8, 0x7E, 0x8A, 0x45, 0x09, 0x6A, 0xBF, 0xEE, 0xA2, 0xA5, 0x26, 0x3F,
-    0x7C, 0xAB, 0x9B, 0xFC, 0xCD, 0xAC, 0xDB, 0x60, 0xD1, 0x5E, 0xFF, 0xDC, 0x89, 0x67, 0x7F, 0xB9,
-    0x6F, 0xF5, 0xC4, 0xB3, 0x7B, 0xFD, 0xB3, 0x5C, 0xBB, 0x0D, 0x96, 0x3D, 0xF7, 0xDE, 0xC5, 0x1F,
-    0x3D, 0xF1, 0xFC, 0x0B, 0x5C, 0x75, 0x56, 0x73, 0xDF, 0xFE, 0x1A, 0x9D, 0xDE, 0xE3, 0x7D, 0x64,
-    0xA2, 0x8B, 0x3A, 0x8D, 0xB3, 0x45, 0x95, 0xA4, 0xF3, 0x65, 0x74, 0xA3, 0xF6, 0x6F, 0x35, 0x54,
-    0x9D, 0xA6, 0x27, 0x9F, 0xEC, 0xFE, 0xBA, 0x9F, 0xF9, 0x12, 0xB6, 0xEE, 0xB4, 0xE4, 0x35, 0x22,
-    0x4B, 0x8C, 0xF7, 0x0E, 0x1D, 0xFA, 0xC9, 0x70, 0x76, 0x96, 0x58, 0xAB, 0x1B, 0xE7, 0xDE, 0xFC,
-    0xC5, 0x6B, 0xB7, 0x57, 0xE7, 0x5E, 0x56, 0xF3, 0xEB, 0x6C, 0x88, 0x4D, 0x2C, 0x5A, 0xA5, 0x83,
-    0x94, 0x57, 0x31, 0xCF, 0x68, 0x73, 0xC4, 0x5F, 0xD5, 0xAD, 0x62, 0x2C, 0xF0, 0x5B, 0x59, 0xB0,
-    0xD3, 0xDA, 0xC5, 0x0E, 0x68, 0x16, 0x83, 0xE2, 0x64, 0x38, 0x33, 0x46, 0xB4, 0xFB, 0xA5, 0x88,
-    0x21, 0x9B, 0xAC, 0x8C, 0x67, 0x5E, 0xA6, 0xEA, 0x09, 0xFF, 0x6C, 0xAD, 0x6E, 0x9D, 0x8A, 0x8B,
-    0x1F, 0x17, 0x81, 0x57, 0xEF, 0xD4, 0x3F, 0x80, 0x5F, 0x41, 0x45, 0x4D, 0xB4, 0x5F, 0xEF, 0x22,
-    0x45, 0x2A, 0x2C, 0xC2, 0x55, 0xED, 0xDD, 0x36, 0xD4, 0xA6, 0xA4, 0x0E, 0x97, 0xE1, 0x6A, 0xED,
-    0xDD, 0x66, 0xA7, 0xCD, 0xD7, 0x78, 0x9E, 0xF9, 0x06, 0xF3, 0xBD, 0xBB, 0x5D, 0x37, 0xB0, 0xC4,
-    0x1D, 0x90, 0x0C, 0x9A, 0x46, 0x35, 0x26, 0x6F, 0x0C, 0xD7, 0x32, 0xF2, 0xDA, 0x28, 0x6D, 0x42,
-    0x6D, 0x02, 0x7B, 0xB5, 0x63, 0x10, 0xE9, 0x41, 0x5C, 0x0D, 0xD4, 0xFA, 0x48, 0xCB, 0x81, 0x9A,
-    0xB8, 0xBA, 0xC6, 0x93, 0xD9, 0x28, 0x55, 0xF1, 0xCC, 0xA2, 0x73, 0xA5, 0x55, 0x59, 0xE0, 0xEA,
-    0x00, 0x0E, 0x4D, 0x5A, 0x5D, 0x39, 0x15, 0x54, 0xEF, 0x5E, 0x9D, 0x59, 0x09, 0xE3, 0x46, 0xF5,
-    0x2E, 0x79, 0xFC, 0x79, 0x68, 0x96, 0xA0, 0xD1, 0x78, 0xA5, 0x84, 0x3A, 0xB1, 0xB7, 0xF0, 0x7E,
-    0xA3, 0x6E, 0x56, 0x50, 0xF3, 0x9E, 0x6F, 0xD2, 0xD3, 0x3B, 0xC8, 0x91, 0x98, 0xC8, 0xE1, 0xF3,
-    0x1E, 0xBC, 0x11, 0x22, 0x51, 0x98, 0xC1, 0x67, 0x07, 0x14, 0x89, 0xCF, 0xBE, 0x0E, 0xA1, 0x1C,
-    0xED, 0xD4, 0xF4, 0xD4, 0x07, 0xE1, 0xD9, 0xA3, 0xAC, 0x17, 0xC2, 0x17, 0xF9, 0x9C, 0x86, 0x3A,
-    0x54, 0x70, 0x9A, 0x9C, 0xE6, 0xB5, 0x92, 0xC2, 0xA5, 0xE5, 0x84, 0x16, 0x9F, 0xCB, 0x33, 0x5F,
-    0x43, 0x77, 0x6A, 0xDF, 0x4F, 0x6B, 0xD7, 0x80, 0x44, 0x58, 0xD2, 0x38, 0xBD, 0x02, 0xCA, 0x96,
-    0x7C, 0xA0, 0xF1, 0xD7, 0xD2, 0xA7, 0xC3, 0x44, 0x0D, 0x59, 0x06, 0x8E, 0xC6, 0x12, 0xCB, 0x01,
-    0xBC, 0xA2, 0x44, 0x58, 0xFC, 0xB3, 0x89, 0x38, 0x58, 0xE5, 0x73, 0x7C, 0xEE, 0x72, 0x59, 0x93,
-    0xA7, 0xE9, 0x5B, 0x04, 0x33, 0x06, 0x19, 0x19, 0xF2, 0x4B, 0x6A, 0x85, 0x4E, 0x2A, 0x8E, 0xAD,
-    0x92, 0x70, 0x2D, 0x89, 0x33, 0x71, 0x49, 0x38, 0xBD, 0x71, 0x0E, 0x82, 0x47, 0x54, 0xE3, 0x72,
-    0xBF, 0xA6, 0xEF, 0x22, 0x1E, 0x5D, 0xF8, 0x7E, 0x16, 0x25, 0xBE, 0xC1, 0x8B, 0x4A, 0x07, 0x25,
-    0xB9, 0x7A, 0x9C, 0x76, 0xFA, 0x4B, 0x78, 0x93, 0xA3, 0x99, 0x02, 0xBA, 0x8E, 0xF7, 0x2D, 0x1E,
-    0x38, 0x0F, 0x39, 0xD2, 0xAF, 0x9F, 0x06, 0x9F, 0x5B, 0x25, 0xC5, 0xBF, 0x3F, 0x71, 0x9C, 0x60,
-    0xEA, 0x22, 0x2C, 0x27, 0x3B, 0x70, 0xF1, 0x2A, 0xAF, 0x86, 0x1C, 0x63, 0x16, 0x31, 0x54, 0x45,
-    0x41, 0x4D, 0x10, 0x0C, 0x0F, 0x68, 0x74, 0x1D, 0x44, 0xE4, 0x80, 0x24, 0x12, 0x68, 0xF0, 0x35,
-    0x84, 0x5D, 0x9E, 0x11, 0x9C, 0x8D, 0x8F, 0x8B, 0x3A, 0x55, 0x42, 0x61, 0x21, 0x22, 0x60, 0x0B,
-    0x10, 0x71, 0x67, 0xA0, 0xFD, 0x92, 0xF3, 0x26, 0xE4, 0x9A, 0xA6, 0xFA, 0xF0, 0x9A, 0xC4, 0x29,
-    0x24, 0x85, 0xF4, 0x83, 0x30, 0xEC, 0x0F, 0x3B, 0xAD, 0x80, 0x1C, 0x7E, 0x27, 0xC6, 0x01, 0x91,
-    0x10, 0x91, 0xED, 0xAC, 0x81, 0x8D, 0x9A, 0x28, 0xC8, 0xD7, 0xC2, 0xCC, 0x87, 0xA9, 0x80, 0x61,
-    0x8E, 0x01, 0x77, 0x01, 0x05, 0x44, 0x36, 0x80, 0x87, 0x25, 0x4C, 0x01, 0x1F, 0x1D, 0xF9, 0x8D,
-    0x2A, 0x29, 0x5D, 0x32, 0xE4, 0xB5, 0x02, 0x2B, 0xC0, 0x20, 0xE1, 0xFB, 0x3A, 0xCE, 0x10, 0xAE,
-    0xE1, 0xD4, 0xF4, 0xA8, 0xE3, 0xCB, 0xE7, 0x2E, 0x07, 0xF0, 0x8E, 0x1C, 0x21, 0x98, 0x82, 0x4E,
-    0xB4, 0x0C, 0xCC, 0x2C, 0xA3, 0x6C, 0xBB, 0x99, 0x0E, 0x80, 0xCE, 0xD1, 0xC7, 0x05, 0xB9, 0x17,
-    0x41, 0xE7, 0xD9, 0x78, 0xB3, 0x94, 0x31, 0x78, 0x79, 0xC2, 0x34, 0x85, 0xE6, 0x03, 0x16, 0xAC,
-    0x80, 0x4A, 0xA2, 0x13, 0x19, 0x79, 0xB5, 0x18, 0x1A, 0x18, 0x13, 0x68, 0x98, 0x1B, 0x39, 0x82,
-    0xA2, 0x42, 0xC1, 0xD9, 0xD8, 0x08, 0xD3, 0x32, 0x00, 0x2F, 0xC2, 0xA9, 0x61, 0xB2, 0x74, 0xA6,
-    0x05, 0x04, 0x62, 0xDB, 0xE0, 0xAB, 0xB0, 0x3B, 0x5F, 0xC3, 0xF4, 0xF9, 0x84, 0x46, 0x68, 0x83,
-    0xE2, 0xE4, 0x0F, 0x4F, 0x6E, 0x27, 0x43, 0x47, 0x10, 0x0E, 0x7F, 0xC9, 0xFB, 0xEF, 0xF0, 0x87,
-    0x9D, 0xD9, 0x3E, 0x86, 0x34, 0xF2, 0xBB, 0x79, 0x38, 0xB8, 0xD3, 0xC9, 0x42, 0x59, 0x09, 0xC4,
-    0xF7, 0x2D, 0x38, 0x62, 0x75, 0x21, 0x1C, 0xE7, 0x85, 0x9D, 0x77, 0xCB, 0xDE, 0x2C, 0x46, 0x32,
-    0x19, 0x16, 0xB2, 0xD8, 0x85, 0xE3, 0xE3, 0x26, 0x25, 0xFE, 0x40, 0x0C, 0x2B, 0xAF, 0x23, 0x59,
-    0xC9, 0x32, 0x50, 0xE9, 0xE6, 0x66, 0x91, 0x91, 0xE4, 0x96, 0x25, 0x3D, 0x21, 0x4F, 0xCB, 0xEC,
-    0x05, 0x23, 0x37, 0xDD, 0x66, 0x81, 0x9C, 0xBC, 0x21, 0xE0, 0x31, 0x2C, 0x6E, 0xF0, 0x76, 0xE3,
-    0xC1, 0x41, 0x02, 0xC9, 0x74, 0x22, 0x95, 0xEE, 0xCF, 0x78, 0xFD, 0x94, 0xB9, 0x2E, 0xF9, 0x39,
-    0x78, 0x35, 0x10, 0xC7, 0x08, 0x5D, 0x47, 0xF8, 0xC6, 0xC2, 0xFB, 0x55, 0xD9, 0x1E, 0xCE, 0x9B,
-    0x70, 0x40, 0x10, 0xA1, 0x9E, 0xCB, 0x68, 0x46, 0x48, 0x2F, 0x36, 0x12, 0x79, 0x13, 0xD7, 0x39,
-    0x46, 0xBE, 0x60, 0x10, 0x9A, 0x01, 0xCD, 0xB6, 0x8F, 0xEC, 0x52, 0xF2, 0x2A, 0xE8, 0x15, 0x29,
-    0x94, 0x74, 0x8D, 0xFC, 0xDA, 0xBE, 0x99, 0xCE, 0x9D, 0x8A, 0x99, 0x97, 0x99, 0x6F, 0xC1, 0x2F,
-    0x73, 0xAB, 0x9D, 0x42, 0xA2, 0xCE, 0xE9, 0x51, 0x60, 0xD7, 0x67, 0x23, 0xED, 0x2D, 0xAE, 0x59,
-    0x12, 0x4C, 0x07, 0x8A, 0xDE, 0x03, 0xF2, 0x90, 0x71, 0x9D, 0xFC, 0x71, 0x8A, 0x4A, 0x4B, 0x1E,
-    0x4A, 0x02, 0xC5, 0x9E, 0xFC, 0x1D, 0xD1, 0x4B, 0x48, 0x92, 0x06, 0x43, 0xFC, 0xB8, 0x51, 0x85,
-    0xC5, 0x91, 0x0D, 0xA2, 0xCF, 0xE4, 0x3C, 0xC1, 0x28, 0x78, 0xB8, 0x7A, 0xB0, 0x59, 0x90, 0x5E,
-    0xDF, 0x2C, 0x48, 0xAF, 0xF5, 0x9B, 0x05, 0x9F, 0x0F, 0xE7, 0x0E, 0xD8, 0xCD, 0x1A, 0x90, 0x9E,
-    0xC2, 0x0B, 0x61, 0x89, 0xC8, 0x4A, 0xA9, 0x8B, 0xCB, 0x74, 0xB9, 0x19, 0x7B, 0xF3, 0xD4, 0x97,
-    0x42, 0xF4, 0x19, 0xD9, 0x7F, 0x9A, 0xF9, 0x1B, 0xBE, 0x89, 0x95, 0x69, 0x12, 0x95, 0x88, 0x17,
-    0xF8, 0x1B, 0x3C, 0xC4, 0xB3, 0x3F, 0x92, 0xB0, 0x04, 0x49, 0x3C, 0xCA, 0xA2, 0xCA, 0x6F, 0x5C,
-    0xA6, 0xBC, 0xF0, 0x97, 0xCE, 0x6B, 0xB3, 0xEB, 0xC1, 0x5B, 0xE9, 0xE1, 0x55, 0x6D, 0x54, 0xB8,
-    0x84, 0xCB, 0xC4, 0x85, 0xBA, 0x4D, 0x4F, 0x5C, 0xBF, 0xC7, 0x79, 0x41, 0x7B, 0xC4, 0x80, 0x1E,
-    0x67, 0x50, 0x84, 0xFA, 0x64, 0x04, 0x80, 0xD1, 0x70, 0x18, 0x6B, 0x81, 0xCD, 0xA3, 0xDD, 0x18,
-    0x40, 0x8E, 0x7E, 0x80, 0x29, 0xC6, 0x98, 0x7B, 0xB2, 0x45, 0x09, 0x93, 0x1E, 0xBE, 0xD2, 0xE6,
-    0x2B, 0x9B, 0xE9, 0x41, 0x0E, 0x58, 0x23, 0x05, 0xFE, 0x08, 0xB0, 0x03, 0xDE, 0x95, 0x50, 0x92,
-    0x9F, 0xA5, 0xE8, 0xA4, 0x15, 0x95, 0x48, 0xC8, 0x64, 0x20, 0x05, 0xC7, 0x14, 0x3F, 0xCC, 0xF9,
-    0x9A, 0x5C, 0xA4, 0x2E, 0x93, 0xF2, 0x2E, 0x9F, 0x43, 0xCD, 0x94, 0x03, 0x1D, 0x70, 0x01, 0xE2,
-    0xE5, 0xC2, 0x5D, 0x2E, 0x52, 0x62, 0xF4, 0x97, 0xDD, 0xFC, 0x47, 0x3B, 0xE7, 0xC9, 0x65, 0x4A,
-    0x7C, 0xDD, 0x3A, 0x3C, 0x37, 0x16, 0xE7, 0xE4, 0x52, 0xE0, 0xB2, 0xD6, 0x6F, 0x28, 0x3A, 0x00,
-    0x63, 0x5C, 0x44, 0x81, 0x09, 0x7F, 0xDD, 0x73, 0x64, 0xB3, 0xE4, 0x06, 0xC1, 0x60, 0xA2, 0xDA,
-    0x31, 0x51, 0xE3, 0x98, 0xD8, 0xE0, 0xEC, 0x5C, 0x94, 0x42, 0x2E, 0x7C, 0xED, 0x98, 0x51, 0x37,
-    0xDF, 0x33, 0x6A, 0xE5, 0x6A, 0xA3, 0x96, 0x3F, 0x6E, 0xD4, 0x85, 0xBB, 0x8D, 0x7A, 0x9F, 0x9B,
-    0xF4, 0x3C, 0xD7, 0x69, 0x29, 0x67, 0x5A, 0xE7, 0xA5, 0xAA, 0x51, 0x2E, 0xD5, 0x36, 0x81, 0x4B,
-    0x6E, 0x93, 0x1C, 0x87, 0x98, 0x2A, 0x37, 0x31, 0x78, 0xAA, 0x93, 0x40, 0xEE, 0x24, 0x0E, 0x0C,
-    0x71, 0x96, 0x56, 0x78, 0xCA, 0xFB, 0x91, 0xA7, 0x1B, 0xF8, 0x80, 0x5A, 0xD6, 0x10, 0x2F, 0x17,
-    0x9C, 0x47, 0xE6, 0x97, 0x1F, 0xF1, 0x72, 0x03, 0x2C, 0x4A, 0x6F, 0x8F, 0x88, 0x0F, 0x71, 0x03,
-    0x3F, 0xE6, 0x44, 0x10, 0xC6, 0x62, 0xCE, 0xC8, 0xBA, 0x3C, 0x24, 0xB6, 0xB4, 0x99, 0x82, 0x24,
-    0x3D, 0x09, 0x5E, 0xDB, 0xDC, 0xFE, 0x99, 0xC3, 0xC9, 0x25, 0x48, 0x19, 0xBA, 0x86, 0x3E, 0xC2,
-    0xC6, 0xEF, 0xDC, 0x16, 0x30, 0x00, 0x94, 0x4A, 0x7F, 0x8B, 0xBA, 0xA1, 0x67, 0x38, 0xE4, 0x1C,
-    0xF5, 0x7B, 0xC9, 0x48, 0x9D, 0xE3, 0x83, 0x53, 0x46, 0x50, 0xEB, 0x18, 0xCE, 0x5A, 0x52, 0x86,
-    0x4D, 0x22, 0x34, 0x85, 0x8C, 0xBD, 0x71, 0x84, 0xC9, 0x30, 0x19, 0x49, 0x0E, 0x8A, 0x4F, 0x14,
-    0xD8, 0x4E, 0xBC, 0xFD, 0x72, 0xCB, 0xD1, 0x00, 0x96, 0xE2, 0xEB, 0xA8, 0xC1, 0x57, 0x20, 0xFC,
-    0x1E, 0xB5, 0xED, 0xE2, 0xA2, 0xB5, 0x40, 0x02, 0x80, 0x3C, 0x2C, 0x40, 0xF2, 0x11, 0x7C, 0x68,
-    0x6E, 0xEC, 0xE4, 0x36, 0x33, 0x8D, 0x8F, 0xD5, 0x5E, 0x67, 0xA4, 0x41, 0x81, 0x83, 0x7B, 0x5C,
-    0x7A, 0xDC, 0xFA, 0xAD, 0x5A, 0xAF, 0x7D, 0xFA, 0xCA, 0x6A, 0x1D, 0x29, 0x86, 0x20, 0x3C, 0x74,
-    0x3B, 0x9B, 0xC9, 0xA8, 0xC7, 0xEB, 0x8D, 0x7A, 0x69, 0x7D, 0x36, 0xEF, 0x4B, 0x09, 0x49, 0x01,
-    0x32, 0xDB, 0x6E, 0x9A, 0x75, 0xF2, 0x79, 0xDD, 0xA7, 0x28, 0x0B, 0xF3, 0x69, 0x9F, 0xAA, 0xC2,
-    0x26, 0x94, 0x5B, 0xB7, 0x75, 0x25, 0x29, 0xA2, 0xF2, 0x48, 0xA5, 0x7D, 0xF1, 0xEB, 0xF0, 0xBE,
-    0xB5, 0xBD, 0xCB, 0x92, 0x3D, 0x03, 0xAD, 0xCE, 0xDB, 0xDB, 0xB0, 0x89, 0xE4, 0xF6, 0x23, 0xEE,
-    0x3D, 0x83, 0x4B, 0x5B, 0xA9, 0xB0, 0x99, 0xB2, 0x55, 0x8B, 0x4D, 0x84, 0x40, 0x0E, 0xB6, 0xA4,
-    0xAC, 0xD0, 0x96, 0x9F, 0x65, 0x84, 0xA7, 0x22, 0xBA, 0x3F, 0xDC, 0x92, 0x9D, 0xEB, 0xF3, 0x93,
-    0x6C, 0xB4, 0xFB, 0xC4, 0x6C, 0xD4, 0x4B, 0xEE, 0x0D, 0x25, 0xCF, 0x7B, 0xC9, 0xC3, 0xE1, 0xDA,
-    0x6B, 0xFD, 0xEC, 0xCF, 0xD6, 0x93, 0x47, 0xD3, 0x17, 0xEE, 0x56, 0x41, 0x23, 0xB3, 0x9F, 0x88,
-    0x0F, 0x40, 0xA7, 0xD9, 0x7C, 0x02, 0x7E, 0x3F, 0x75, 0x7A, 0x72, 0x36, 0xFD, 0x89, 0xB2, 0xA9,
-    0x08, 0xA4, 0xFF, 0x94, 0xE6, 0xB2, 0x8E, 0xFB, 0x7A, 0xAA, 0x74, 0x79, 0xA8, 0x6A, 0x34, 0x4F,
-    0x36, 0x85, 0x49, 0x0F, 0x8B, 0x32, 0x5C, 0x80, 0xEF, 0x51, 0xC7, 0x97, 0xCB, 0x77, 0x58, 0xB3,
-    0x06, 0x12, 0x88, 0x50, 0x74, 0x87, 0xAA, 0x5C, 0x07, 0xC5, 0x76, 0xF1, 0x73, 0x66, 0xC7, 0xE0,
-    0xC4, 0x0A, 0x7D, 0x8A, 0xEA, 0xDF, 0x02, 0xC5, 0xED, 0x95, 0xAF, 0x1E, 0xD6, 0xE3, 0xE3, 0x62,
-    0x7A, 0xCC, 0xED, 0x4C, 0xE8, 0xF3, 0x0F, 0x40, 0x0C, 0x03, 0x8A, 0xD3, 0x7D, 0x2D, 0x1C, 0x56,
-    0x15, 0x71, 0x19, 0xD4, 0xB8, 0x45, 0x0B, 0x4A, 0xB1, 0x94, 0x4B, 0x9D, 0xD4, 0xC8, 0xF0, 0x9D,
-    0x08, 0xEE, 0xE8, 0x89, 0x4B, 0x49, 0xE1, 0x27, 0xDE, 0x63, 0xE3, 0x41, 0xB8, 0x4A, 0x11, 0x27,
-    0x8D, 0x92, 0x78, 0xE3, 0x4B, 0xD2, 0x07, 0xA0, 0x97, 0xBE, 0x46, 0x68, 0xEB, 0x59, 0xB7, 0xE9,
-    0x4A, 0xD6, 0x36, 0xC1, 0xA5, 0xA3, 0xA6, 0xE3, 0x37, 0xB8, 0x42, 0xF0, 0x96, 0xF2, 0x54, 0x96,
-    0x90, 0x2B, 0xED, 0x7F, 0xE3, 0xAE, 0x4D, 0x91, 0xF1, 0xAA, 0x71, 0xB7, 0x89, 0x66, 0x5A, 0xFF,
-    0x8A, 0x76, 0x9A, 0x33, 0x74, 0x24, 0xCA, 0xE2, 0xA5, 0x16, 0x71, 0xF2, 0xBE, 0x11, 0x00, 0x50,
-    0x10, 0x74, 0x05, 0xB5, 0x9B, 0xC0, 0xC6, 0xEE, 0x84, 0xD0, 0x3D, 0x01, 0x5A, 0x24, 0x46, 0xF3,
-    0x0D, 0xD1, 0xDC, 0x35, 0xE0, 0x42, 0xAD, 0xE6, 0x9B, 0xBD, 0x6E, 0x33, 0x70, 0xCC, 0x19, 0x32,
-    0x35, 0x99, 0x33, 0xC0, 0x11, 0xDB, 0x69, 0xC7, 0xDC, 0x8E, 0xB4, 0x47, 0xA4, 0xBA, 0x89, 0xAD,
-    0x62, 0xA6, 0x65, 0xA3, 0x9F, 0x2E, 0x9B, 0xB6, 0x42, 0xE1, 0x39, 0x69, 0xD6, 0x1C, 0x2E, 0xFC,
-    0xBB, 0x3A, 0x4A, 0x06, 0x8F, 0xF5, 0xAE, 0x7B, 0xB9, 0xF4, 0xD7, 0xAA, 0x20, 0x2D, 0xC3, 0x4D,
-    0xAE, 0xBE, 0x95, 0x17, 0xA3, 0xF7, 0x9A, 0x78, 0xA9, 0x51, 0x4B, 0x46, 0xAD, 0x9A, 0x67, 0x8E,
-    0xFD, 0xED, 0xF1, 0x36, 0x3C, 0x2D, 0x88, 0xE7, 0xDC, 0x48, 0x04, 0xF7, 0xA6, 0x1F, 0x53, 0xD8,
-    0xE1, 0xC2, 0x3C, 0x13, 0xF0, 0xD1, 0x6A, 0x9E, 0xCF, 0x63, 0x39, 0x1F, 0x5A, 0x18, 0xA0, 0x42,
-    0xEB, 0xCE, 0x08, 0xF4, 0xD5, 0x52, 0xE4, 0x9E, 0x71, 0xD8, 0x56, 0x23, 0xF7, 0xDE, 0x11, 0xCC,
-    0xEA, 0x24, 0x1B, 0x75, 0x23, 0x6D, 0x2A, 0x35, 0x8A, 0x7C, 0xB9, 0x62, 0x13, 0x74, 0x68, 0x08,
-    0xA4, 0xE5, 0xB6, 0x05, 0xCD, 0x22, 0xE0, 0x71, 0x07, 0x0C, 0xEF, 0xC3, 0xF6, 0x9C, 0x39, 0xD7,
-    0xC4, 0x97, 0xBE, 0x51, 0xC1, 0x91, 0x50, 0x13, 0xC0, 0xB4, 0x41, 0x65, 0x13, 0x65, 0xFE, 0x69,
-    0xAF, 0x75, 0x16, 0x93, 0x80, 0xAB, 0xF8, 0x68, 0xA3, 0x0E, 0x0D, 0x52, 0x29, 0x84, 0xDB, 0xD6,
-    0x96, 0xDB, 0xE9, 0x87, 0x6F, 0x63, 0xC7, 0x21, 0xB7, 0x92, 0x59, 0x90, 0x66, 0xA3, 0x75, 0x03,
-    0xEF, 0x7A, 0xB8, 0xB7, 0x6F, 0x89, 0x8E, 0x98, 0x39, 0xB1, 0x66, 0xAE, 0xA3, 0x6C, 0xE1, 0x0B,
-    0x50, 0x18, 0x3D, 0x3A, 0x6B, 0xCD, 0x66, 0xD4, 0x05, 0x31, 0xDB, 0x17, 0xA0, 0xF0, 0x8A, 0x38,
-    0x39, 0xF7, 0x6D, 0xBC, 0x7C, 0x35, 0xF2, 0x4B, 0x34, 0xD7, 0xD3, 0x88, 0x68, 0xBF, 0x74, 0x6B,
-    0x5A, 0xA0, 0x38, 0x09, 0x2A, 0x68, 0x8C, 0x29, 0x0C, 0x96, 0xAE, 0xE8, 0xDE, 0x9B, 0x47, 0xFD,
-    0xF3, 0xF5, 0x74, 0xF4, 0xE2, 0xFB, 0xF5, 0x42, 0x7C, 0xE0, 0xAA, 0xF4, 0x8A, 0x7B, 0x1F, 0xE6,
-    0xAE, 0xDF, 0xB1, 0xEA, 0xD9, 0x3C, 0x16, 0xD6, 0xC7, 0xA2, 0xED, 0x5A, 0x90, 0x5D, 0xA5, 0x1C,
-    0x4E, 0xA3, 0xE5, 0x3B, 0x7D, 0x7E, 0x71, 0x4E, 0x82, 0x2F, 0xD8, 0x0F, 0x2F, 0xE0, 0x1F, 0xDB,
-    0x4B, 0x26, 0x1D, 0xF3, 0xD0, 0x99, 0x05, 0x6E, 0xA4, 0x36, 0x85, 0xC5, 0x69, 0xE7, 0xD4, 0xBF,
-    0xC8, 0x7E, 0x91, 0xB4, 0xB9, 0x6B, 0x1C, 0xF2, 0x4E, 0x64, 0x2E, 0xDF, 0x17, 0x90, 0xD2, 0x68,
-    0x0C, 0xA5, 0x3E, 0xCF, 0xD1, 0x1C, 0x46, 0x78, 0x3F, 0x94, 0x45, 0x1A, 0xE0, 0x22, 0x75, 0x3F,
-    0x40, 0x61, 0x74, 0x98, 0x8F, 0x9A, 0x5F, 0xB9, 0xDD, 0xAB, 0xA8, 0x59, 0xBC, 0xA5, 0x8D, 0x4F,
-    0x18, 0xE3, 0x69, 0xA6, 0xE0, 0xB4, 0xF7, 0x01, 0xA7, 0x83, 0x94, 0xA6, 0xE1, 0xDC, 0x29, 0x2D,
-    0x62, 0xE4, 0xD4, 0xE5, 0xC4, 0x18, 0xE8, 0x2F, 0x7B, 0x70, 0xD8, 0xEC, 0x41, 0x50, 0x76, 0x28,
-    0xDF, 0xF1, 0xD0, 0x82, 0xB4, 0x0B, 0xB4, 0xD8, 0xD2, 0x11, 0x5C, 0xF3, 0x7D, 0x70, 0x50, 0x94,
-    0xAE, 0x82, 0x51, 0x58, 0x20, 0x1F, 0xEC, 0x1E, 0x80, 0xC3, 0xE0, 0x21, 0x2E, 0xF3, 0xFF, 0x29,
-    0xF4, 0x2A, 0xC8, 0x13, 0x17, 0x9D, 0xEE, 0xF5, 0x3A, 0x4E, 0x16, 0x1E, 0xEB, 0x5D, 0xEF, 0x72,
-    0x15, 0xAC, 0x55, 0x21, 0xC0, 0x61, 0xA2, 0xD8, 0xFA, 0x8B, 0x0F, 0x45, 0x86, 0x2D, 0x71, 0x1C,
-    0x39, 0x4E, 0xFD, 0xB7, 0x5B, 0xDD, 0x9F, 0xC3, 0x12, 0x67, 0xE7, 0xE4, 0x5B, 0x52, 0x5E, 0x61,
-    0x61, 0xDF, 0x80, 0x3F, 0x62, 0xDD, 0x41, 0x9B, 0x61, 0x04, 0xC6, 0x60, 0xB1, 0x38, 0xB1, 0x1F,
-    0xA4, 0x54, 0x9F, 0xC6, 0x07, 0x76, 0xDE, 0xE9, 0xE7, 0xA7, 0xE4, 0xD3, 0x58, 0x21, 0xDF, 0x9D,
-    0x0D, 0x32, 0xD5, 0xC4, 0xCD, 0x99, 0x3B, 0x6B, 0x8D, 0x4A, 0x0F, 0x1F, 0xE3, 0xBB, 0x4D, 0x64,
-    0x4B, 0xD6, 0xCA, 0x43, 0xC1, 0x1A, 0xAD, 0xD9, 0xAA, 0x03, 0xD0, 0xE0, 0x6B, 0x5B, 0x7B, 0x08,
-    0x43, 0x63, 0xBF, 0x34, 0x48, 0x9B, 0x00, 0xAD, 0xFA, 0x49, 0x5F, 0xC5, 0xA1, 0x5C, 0xB2, 0x5D,
-    0x2B, 0xD1, 0xE4, 0xF0, 0x23, 0x8F, 0x21, 0x33, 0xA0, 0xF6, 0xC1, 0x98, 0xB6, 0x23, 0x75, 0x5A,
-    0x75, 0xBD, 0x43, 0xFF, 0x1B, 0x71, 0xE7, 0x23, 0x7D, 0x7D, 0xAE, 0x71, 0xB7, 0x44, 0xE1, 0x11,
-    0xC6, 0xDD, 0xCA, 0xBB, 0xA3, 0xFB, 0x66, 0xD1, 0xF6, 0x7D, 0x16, 0x09, 0xB6, 0xC6, 0x37, 0xB1,
-    0x31, 0x1C, 0x3C, 0xD0, 0xF4, 0xE7, 0x1C, 0x28, 0x68, 0x10, 0x18, 0xF1, 0x31, 0x23, 0xFF, 0x7E,
-    0x40, 0x80, 0xF9, 0x80, 0x87, 0x96, 0xE2, 0x4B, 0x05, 0x32, 0x31, 0x05, 0xC8, 0xD3, 0x4A, 0xDB,
-    0x1A, 0x10, 0xCD, 0xA6, 0x34, 0xAE, 0xAA, 0x70, 0xE6, 0x1B, 0x8A, 0xA5, 0x37, 0x2D, 0x29, 0xB6,
-    0x1A, 0x87, 0xE1, 0x8C, 0x74, 0x9D, 0x52, 0x62, 0x57, 0x6D, 0x3E, 0x71, 0xD6, 0x18, 0xFF, 0x52,
-    0x31, 0x3E, 0xF0, 0x2F, 0x16, 0x66, 0x10, 0x2F, 0x5F, 0xD4, 0x79, 0x0B, 0x3A, 0xC0, 0xAE, 0x12,
-    0x58, 0x61, 0x2F, 0x23, 0x19, 0x6C, 0xB6, 0x48, 0x69, 0xA8, 0x83, 0x1A, 0xC1, 0x37, 0xA1, 0x47,
-    0x67, 0xE7, 0x1E, 0x52, 0xBF, 0x51, 0xB8, 0x54, 0xBB, 0x4D, 0x5C, 0xC8, 0xFF, 0x46, 0x74, 0xA0,
-    0x8F, 0x90, 0x7A, 0xA3, 0x74, 0x5B, 0xF0, 0x42, 0x49, 0x91, 0xD7, 0x76, 0x57, 0xD8, 0x9C, 0xFD,
-    0x4C, 0x52, 0x48, 0x62, 0x1F, 0x63, 0xC0, 0x85, 0xA6, 0xB8, 0x45, 0x8D, 0x40, 0xF4, 0x3F, 0xBD,
-    0x5A, 0x31, 0x8F, 0xDC, 0x46, 0x96, 0x7E, 0x24, 0x4F, 0x43, 0x40, 0x04, 0xAE, 0x1C, 0x9C, 0x17,
-    0x0B, 0xE9, 0x6E, 0x99, 0x6B, 0x71, 0xCB, 0x3F, 0xB0, 0x9A, 0xA2, 0xD6, 0xC1, 0x06, 0x0E, 0x3C,
-    0x81, 0xC6, 0xC9, 0x05, 0xDA, 0xD0, 0xD6, 0x05, 0x93, 0x5E, 0xE0, 0x19, 0x72, 0xED, 0xC0, 0x81,
-    0x83, 0x9D, 0xC0, 0x1B, 0x1D, 0xEE, 0xAC, 0x40, 0x07, 0xAC, 0xC6, 0x38, 0x28, 0xD9, 0x40, 0x07,
-    0xCC, 0x0C, 0x69, 0x0D, 0x70, 0x0E, 0x14, 0x88, 0xB2, 0x02, 0x1D, 0xE0, 0x40, 0x5C, 0xCB, 0x07,
-    0xE3, 0xEC, 0x40, 0x5C, 0x2F, 0x65, 0x71, 0xA4, 0x22, 0x6B, 0xBF, 0xAF, 0xC8, 0x9E, 0xE9, 0x1E,
-    0xC9, 0x67, 0xC9, 0x1E, 0x79, 0x86, 0xD5, 0xCD, 0x66, 0x77, 0x57, 0x7D, 0xF5, 0xEA, 0xD5, 0xF7,
-    0xBE, 0xF7, 0xD8, 0xE2, 0xBD, 0xBE, 0x29, 0x91, 0xB5, 0x22, 0xD6, 0x36, 0x72, 0x62, 0x55, 0x8E,
-    0xFE, 0x25, 0xA5, 0x48, 0x60, 0x70, 0x92, 0xD5, 0x82, 0x0F, 0xE2, 0xC4, 0xB6, 0x22, 0xF1, 0x07,
-    0xB9, 0x04, 0x2D, 0x2E, 0x67, 0xAA, 0x96, 0xA8, 0xC9, 0x44, 0xFA, 0xA0, 0x95, 0xB8, 0xD4, 0x79,
-    0x60, 0xAD, 0x11, 0x6D, 0x6D, 0x85, 0x4E, 0x2D, 0x3A, 0xB5, 0x4D, 0x5C, 0x4B, 0xF6, 0x4E, 0x2F,
-    0xA1, 0xD1, 0xA5, 0xE8, 0x4A, 0xE4, 0xA5, 0xC4, 0xB6, 0x99, 0x35, 0xBB, 0x5B, 0xEF, 0xCF, 0x8F,
-    0xE3, 0xEF, 0xB7, 0xCA, 0xB6, 0xFA, 0x6A, 0x77, 0xD6, 0xEF, 0xB6, 0x3D, 0x73, 0x4D, 0x4C, 0x2B,
-    0xE6, 0x9A, 0x67, 0x0A, 0x6B, 0xB4, 0xED, 0x13, 0xDB, 0x2F, 0xF5, 0x1B, 0xEE, 0x83, 0x61, 0xA5,
-    0x31, 0xAC, 0xAD, 0x25, 0xC0, 0x40, 0x12, 0x0D, 0x47, 0x01, 0xFB, 0x04, 0x8B, 0xA1, 0x24, 0xE4,
-    0x5B, 0x45, 0x23, 0xA2, 0x6C, 0x2A, 0xDE, 0x7E, 0x87, 0xAB, 0xAF, 0x95, 0x12, 0x36, 0xB8, 0x5C,
-    0x84, 0x8D, 0xA8, 0x4A, 0xA7, 0x9E, 0x09, 0x3A, 0x82, 0x2D, 0x81, 0xBA, 0x97, 0x02, 0x60, 0x15,
-    0x10, 0x7B, 0x83, 0x84, 0x1D, 0x90, 0x66, 0x7B, 0x46, 0x82, 0x9E, 0x36, 0x38, 0xD7, 0x01, 0xB3,
-    0xB2, 0xB5, 0x8F, 0x9E, 0x9E, 0x0B, 0xF0, 0x0B, 0x00, 0x83, 0xD9, 0x4B, 0x54, 0x72, 0x1D, 0xAA,
-    0xA9, 0xDB, 0xD3, 0xD5, 0x0C, 0xD3, 0xEE, 0x3A, 0x2C, 0x9E, 0x0E, 0x45, 0x0D, 0x4C, 0x89, 0x64,
-    0x51, 0xAE, 0xF6, 0xAA, 0xA0, 0x01, 0xA8, 0xC4, 0x5A, 0xF4, 0x5A, 0x15, 0xB6, 0x5D, 0xEA, 0xB1,
-    0x58, 0x71, 0x2E, 0x2A, 0x67, 0x2F, 0xBE, 0xCD, 0x45, 0xD7, 0xE2, 0xFD, 0x51, 0xE4, 0x97, 0xF8,
-    0xFE, 0x36, 0x1A, 0x56, 0xD7, 0x07, 0x4E, 0x6F, 0xE5, 0xD0, 0xA4, 0x5E, 0xD1, 0x49, 0x0C, 0x6B,
-    0x63, 0x6A, 0xBE, 0xB5, 0x5D, 0x80, 0x29, 0x44, 0x98, 0x98, 0xA2, 0x23, 0x34, 0x63, 0x4B, 0x66,
-    0x8D, 0xD7, 0x86, 0xF4, 0x0D, 0x40, 0xEF, 0xE0, 0x01, 0x86, 0xEE, 0xE0, 0xD1, 0x25, 0x12, 0xB4,
-    0x5F, 0x88, 0x34, 0x1C, 0x75, 0x59, 0xC4, 0xF5, 0x1E, 0xA3, 0xAB, 0x26, 0x79, 0xFC, 0x91, 0x91,
-    0xA8, 0x96, 0x24, 0x95, 0x5E, 0xFC, 0x4E, 0xC2, 0xF6, 0x25, 0x58, 0x3A, 0xB6, 0xF5, 0xC9, 0x69,
-    0x69, 0xBD, 0x66, 0xF4, 0x40, 0x05, 0xE7, 0xD3, 0x6B, 0xA5, 0x74, 0x41, 0xB3, 0xB0, 0xE0, 0xC7,
-    0x85, 0xEE, 0x2C, 0xDC, 0x4A, 0x3C, 0x5B, 0x86, 0x0F, 0x9B, 0x38, 0xDD, 0x9E, 0x3A, 0x5F, 0xAB,
-    0x01, 0x31, 0x1A, 0x9A, 0xB8, 0x94, 0x24, 0x27, 0x46, 0x9D, 0xF2, 0x24, 0xAE, 0x52, 0x80, 0x0C,
-    0x6D, 0x27, 0x57, 0x61, 0x3D, 0x33, 0x7A, 0x5D, 0x30, 0x35, 0xFF, 0x0F, 0xC7, 0x0F, 0x0E, 0x8B,
-    0x8F, 0xFD, 0x55, 0x49, 0x91, 0x7B, 0x57, 0xD8, 0xEF, 0xE9, 0xEF, 0x34, 0xDD, 0x65, 0xEF, 0x92,
-    0x6C, 0xE0, 0xCD, 0x18, 0x4B, 0x1C, 0xC2, 0x71, 0x3C, 0xF8, 0x9C, 0x5C, 0x92, 0x17, 0x62, 0x3A,
-    0x91, 0x0D, 0xBF, 0x8D, 0xEF, 0x56, 0xA1, 0x4D, 0x3D, 0x0C, 0x75, 0xED, 0xA0, 0xFB, 0x5C, 0xD9,
-    0x32, 0x79, 0x5C, 0xC2, 0xE5, 0x76, 0x45, 0x76, 0xC0, 0x12, 0xEE, 0x24, 0x3B, 0x07, 0x3F, 0xCF,
-    0x81, 0xD3, 0x2F, 0x72, 0x7E, 0x2E, 0xAA, 0x12, 0x6C, 0x27, 0x33, 0x6E, 0x10, 0x12, 0x8E, 0x4A,
-    0x17, 0x60, 0x16, 0xF6, 0x73, 0xEE, 0x87, 0xB4, 0xA0, 0x0B, 0x6F, 0xD9, 0xA6, 0x10, 0xD5, 0x15,
-    0x30, 0x75, 0x81, 0x0E, 0x9F, 0x6C, 0x3E, 0xDA, 0x1A, 0xB6, 0xA1, 0x65, 0xEB, 0xB8, 0x8F, 0xD0,
-    0xCA, 0xC2, 0xEE, 0x4F, 0x9B, 0x47, 0xFD, 0x37, 0xB8, 0xEB, 0x6B, 0x8C, 0x64, 0x30, 0xA2, 0xC6,
-    0x15, 0x75, 0xB3, 0x8C, 0xEF, 0x3D, 0x6C, 0x12, 0x37, 0x19, 0x2B, 0xAA, 0xB4, 0x79, 0x58, 0xC6,
-    0xB5, 0xDF, 0x60, 0x3F, 0x1A, 0x19, 0x60, 0xDE, 0x22, 0x0F, 0x2D, 0x18, 0x07, 0xDD, 0xC1, 0x0B,
-    0xB9, 0x65, 0x3F, 0x28, 0x47, 0x54, 0x0E, 0x16, 0x1F, 0xB0, 0x32, 0x00, 0x26, 0x85, 0x44, 0x1D,
-    0x1E, 0xE0, 0x0D, 0xC4, 0xE2, 0x1E, 0x40, 0x06, 0xD3, 0xC3, 0xCB, 0xF6, 0x7D, 0x77, 0x2D, 0xE0,
-    0xC3, 0x1A, 0xAD, 0xEE, 0x4C, 0x8F, 0x4E, 0x09, 0x92, 0x0F, 0xA5, 0x1C, 0xC2, 0x44, 0xE3, 0xB7,
-    0xD8, 0xCE, 0x14, 0x57, 0xF8, 0xDA, 0x1B, 0xB4, 0xA3, 0x6A, 0x82, 0xD4, 0xC1, 0x20, 0x6F, 0x81,
-    0x1B, 0xB6, 0x81, 0x8F, 0x18, 0x77, 0xFC, 0x01, 0xA4, 0x38, 0xE0, 0xE3, 0x83, 0x83, 0xE8, 0x0F,
-    0xB0, 0xB9, 0x9C, 0x07, 0x6C, 0x2C, 0x6C, 0xB5, 0xF5, 0xFB, 0x95, 0x05, 0x83, 0x9E, 0x29, 0xEC,
-    0x6B, 0xD6, 0xEE, 0x61, 0x4E, 0x58, 0x10, 0x78, 0xB4, 0xAA, 0xE8, 0x5E, 0x58, 0xCE, 0x32, 0x03,
-    0x5F, 0x5B, 0x13, 0xEE, 0x0B, 0xD7, 0x31, 0x4B, 0x25, 0xFE, 0x72, 0xEB, 0x55, 0x6B, 0xBF, 0x1E,
-    0x8D, 0xB9, 0x46, 0x23, 0xC8, 0x4A, 0x62, 0x3B, 0x6D, 0xCD, 0xC5, 0xAD, 0xF3, 0x4F, 0x04, 0x0B,
-    0xF1, 0x76, 0xD3, 0xC8, 0xD6, 0xC9, 0x6F, 0x3B, 0xBD, 0xBA, 0x9D, 0xD9, 0xBE, 0xB0, 0xFD, 0xB4,
-    0xE2, 0x5F, 0xFE, 0x27, 0x26, 0xA2, 0x6C, 0xEF, 0x15, 0xE8, 0x41, 0x82, 0x26, 0x81, 0x31, 0xCB,
-    0xD8, 0x96, 0xDE, 0xE8, 0x01, 0xC7, 0x00, 0x8B, 0x2C, 0x1D, 0x3F, 0xC1, 0xD2, 0xCF, 0x01, 0x0B,
-    0x06, 0xC7, 0x06, 0x0B, 0x5B, 0xD8, 0x4E, 0xE4, 0x62, 0x7A, 0x3C, 0xB0, 0x30, 0x08, 0x9C, 0xC0,
-    0xBA, 0x63, 0xEB, 0xFB, 0x58, 0xEB, 0x07, 0x0C, 0x4E, 0x8A, 0x87, 0xAB, 0x63, 0xE4, 0xAC, 0x24,
-    0x9F, 0x3F, 0xE3, 0xE2, 0xC8, 0xDF, 0x0A, 0x19, 0x1A, 0x74, 0xF1, 0x28, 0x15, 0x90, 0x47, 0x32,
-    0xAD, 0x50, 0x58, 0x27, 0x69, 0x96, 0xA5, 0xD8, 0xE3, 0x1C, 0x2D, 0xCA, 0x17, 0xA3, 0xEE, 0x87,
-    0xB6, 0xB5, 0x8C, 0x7C, 0xC3, 0x08, 0x50, 0x46, 0xB4, 0x04, 0x88, 0x18, 0x46, 0xB4, 0x9B, 0x93,
-    0x75, 0xBD, 0x61, 0xEB, 0x32, 0x00, 0xC2, 0x89, 0x6F, 0x58, 0xFB, 0x8D, 0xE5, 0x76, 0x82, 0xE9,
-    0x8D, 0xFA, 0xAA, 0x09, 0xE0, 0xFF, 0x76, 0x0C, 0x44, 0xDF, 0xD3, 0xAF, 0xC8, 0x25, 0xC0, 0x45,
-    0x83, 0x48, 0x06, 0x10, 0xC9, 0x07, 0x15, 0xC8, 0x25, 0x4E, 0x9F, 0xD6, 0x23, 0xA4, 0x4E, 0x38,
-    0x06, 0x5B, 0x43, 0x99, 0x52, 0x26, 0xBD, 0xFC, 0x34, 0x20, 0x98, 0x8C, 0xE1, 0x9A, 0x64, 0x99,
-    0xA1, 0xAB, 0xA8, 0xF3, 0xFE, 0x0F, 0xDB, 0x3F, 0xB6, 0x37, 0x3A, 0xB1, 0x7D, 0x56, 0x9E, 0x28,
-    0xEE, 0x0D, 0x98, 0x9F, 0x1E, 0x56, 0x39, 0x2B, 0x84, 0x06, 0x3C, 0xA4, 0x09, 0x57, 0xFA, 0xB4,
-    0xDD, 0x84, 0x03, 0x81, 0x4D, 0x6A, 0x51, 0xBD, 0xA8, 0xBB, 0x95, 0xCA, 0x37, 0x16, 0x87, 0x2C,
-    0x2E, 0xE4, 0xF8, 0xE0, 0x50, 0x74, 0xEB, 0xC1, 0xF0, 0x0B, 0x29, 0xDE, 0xCB, 0xE3, 0xDB, 0x55,
-    0xD8, 0x5E, 0xF3, 0xFA, 0xE4, 0x9C, 0xFD, 0x35, 0x76, 0xA9, 0xA5, 0xF7, 0x82, 0x11, 0xE0, 0x30,
-    0xAA, 0xFC, 0x4D, 0x5C, 0x6B, 0x2A, 0x80, 0x96, 0x41, 0x66, 0x16, 0x8C, 0xB1, 0x6F, 0x10, 0x81,
-    0xC0, 0x15, 0x1E, 0x58, 0x41, 0x42, 0xFB, 0xB4, 0x89, 0xC9, 0xCB, 0x2B, 0xD4, 0x47, 0x4E, 0x84,
-    0x95, 0x60, 0x6B, 0x30, 0x7B, 0xE5, 0xE5, 0x08, 0xF2, 0x50, 0x60, 0xD3, 0xA4, 0xDC, 0xEC, 0x8A,
-    0xFC, 0x67, 0xEF, 0x63, 0x76, 0xF0, 0x16, 0x90, 0xF4, 0x1D, 0x23, 0xFF, 0x34, 0xE0, 0x33, 0xFA,
-    0x15, 0xFB, 0xBF, 0x17, 0xE0, 0x56, 0x60, 0x18, 0xAC, 0x51, 0xEB, 0x73, 0x79, 0xBC, 0x62, 0x7F,
-    0x24, 0xE9, 0x8D, 0xC8, 0xF6, 0x01, 0xD9, 0xAA, 0x3A, 0x5C, 0xF6, 0x7E, 0x03, 0x6C, 0xA3, 0xAF,
-    0x0E, 0x98, 0xD2, 0x35, 0x7F, 0xC0, 0x5C, 0x5A, 0xAF, 0xC7, 0xE3, 0x4E, 0xD8, 0x63, 0x99, 0xDC,
-    0xD2, 0x18, 0x7F, 0xC0, 0xB8, 0xE6, 0xA7, 0x50, 0x31, 0xB6, 0xD1, 0xB6, 0xCA, 0xE0, 0x52, 0x64,
-    0x8E, 0x37, 0x48, 0xC5, 0xEC, 0x89, 0x36, 0x87, 0x46, 0x84, 0x16, 0x91, 0x1F, 0x6D, 0x3A, 0xF0,
-    0x69, 0x9D, 0x53, 0x98, 0xE1, 0x38, 0x93, 0x1F, 0xC3, 0x74, 0xB8, 0xCB, 0xA8, 0xA4, 0x26, 0x8D,
-    0x56, 0xD2, 0x73, 0xA8, 0xD1, 0xD2, 0x31, 0x8A, 0x7E, 0xCB, 0xDF, 0x8B, 0x71, 0xC2, 0x8B, 0x9B,
-    0x92, 0x55, 0xEC, 0x01, 0x47, 0x81, 0x2D, 0x0C, 0x6F, 0x71, 0x23, 0xFD, 0x90, 0xF9, 0x85, 0xA5,
-    0xF3, 0x6C, 0xD1, 0xC0, 0xD4, 0xEF, 0xC2, 0x11, 0xE3, 0x85, 0xFD, 0xAF, 0xD3, 0xC0, 0x1C, 0xB4,
-    0x3C, 0x30, 0xD9, 0xD3, 0x5A, 0x89, 0x86, 0x89, 0x4E, 0x0D, 0x9B, 0x18, 0xED, 0xCB, 0x0F, 0xFB,
-    0xA2, 0x0C, 0x0F, 0x9A, 0xEB, 0xEC, 0x2D, 0x71, 0x74, 0x49, 0x3A, 0x50, 0x9F, 0x36, 0xE0, 0x22,
-    0x73, 0x38, 0xD0, 0xCE, 0x5C, 0xE3, 0xA7, 0xCD, 0xD4, 0x7A, 0x58, 0xDA, 0x85, 0xE8, 0xFB, 0x8D,
-    0x0C, 0x5E, 0x0B, 0x49, 0xD6, 0x4D, 0xCD, 0xF8, 0xAE, 0x79, 0x68, 0xF8, 0xEF, 0x7D, 0x13, 0xF4,
-    0x81, 0x81, 0xE3, 0x59, 0x7C, 0x5F, 0x35, 0xEE, 0x04, 0x21, 0x93, 0x59, 0x8A, 0xC5, 0x52, 0xC0,
-    0xBC, 0x78, 0xF8, 0x14, 0xCD, 0xF0, 0x0A, 0x2C, 0xA7, 0x9C, 0xFF, 0x38, 0x3B, 0xF3, 0xE4, 0x57,
-    0x68, 0x6D, 0xF2, 0x68, 0x0B, 0x27, 0x12, 0xB7, 0x49, 0xE3, 0x8D, 0x27, 0x33, 0x50, 0x3F, 0x01,
-    0x06, 0x26, 0x27, 0x1B, 0xFD, 0x77, 0x03, 0xF3, 0x9E, 0x02, 0x2C, 0x7E, 0x4D, 0x7D, 0xB3, 0x77,
-    0xF7, 0xCF, 0x7F, 0xEE, 0xE6, 0xBD, 0xA4, 0x07, 0xE1, 0xC6, 0x15, 0xD2, 0x04, 0xEC, 0x02, 0x50,
-    0x43, 0xE0, 0x4E, 0x52, 0x55, 0x81, 0x67, 0xF1, 0x56, 0x1E, 0xD7, 0x61, 0x87, 0xCD, 0x53, 0x60,
-    0x89, 0x96, 0xFF, 0xA1, 0xF8, 0xF7, 0x87, 0xFD, 0x1F, 0x27, 0x01, 0xB6, 0xB4, 0x19, 0x56, 0xB3,
-    0xFF, 0x68, 0xFC, 0xAF, 0x55, 0xAD, 0xE8, 0x8F, 0x58, 0x68, 0xA4, 0x28, 0xCB, 0x5B, 0xFF, 0x71,
-    0xD4, 0x25, 0xB3, 0x74, 0x76, 0x8C, 0x12, 0x64, 0xFE, 0x48, 0x0F, 0x0F, 0xB8, 0xE5, 0x78, 0x60,
-    0x54, 0x1C, 0xAB, 0x97, 0xB4, 0x4B, 0xEA, 0x56, 0xE7, 0x35, 0xC1, 0x9B, 0x22, 0xEB, 0x8B, 0xC7,
-    0xCE, 0xEC, 0xD8, 0x75, 0xDB, 0x1E, 0x86, 0xBB, 0xD5, 0xC7, 0xB7, 0x8C, 0x2A, 0xC7, 0xA3, 0x57,
-    0x55, 0xAF, 0x6E, 0x0D, 0xF1, 0x9F, 0x86, 0xE4, 0x6B, 0xAB, 0xC3, 0xB2, 0xD8, 0x33, 0x5E, 0x9A,
-    0xBC, 0xD3, 0xE9, 0x3D, 0xC3, 0x4D, 0xEA, 0x5D, 0x8A, 0xCF, 0xB5, 0x3C, 0x7E, 0xD5, 0x26, 0x38,
-    0x70, 0xFD, 0xA3, 0x76, 0x39, 0x2A, 0xED, 0x9D, 0x61, 0xA9, 0x3A, 0xA3, 0x3E, 0xFE, 0xA6, 0xB7,
-    0xCE, 0x27, 0xE3, 0x3B, 0x0F, 0xFA, 0x4C, 0xED, 0x35, 0x46, 0xAB, 0xBD, 0xB6, 0xD7, 0xAF, 0xDD,
-    0xD9, 0x1F, 0xB2, 0xAB, 0x8F, 0xCD, 0x9B, 0xEB, 0xFC, 0xDB, 0xD9, 0xD9, 0xD9, 0x1D, 0x2C, 0x37,
-    0xFE, 0xEF, 0x90, 0x75, 0xDD, 0x33, 0xD8, 0x64, 0x05, 0x0C, 0x0C, 0xD1, 0x99, 0xBD, 0xDA, 0x48,
-    0xF2, 0x09, 0xF4, 0x74, 0x43, 0xFD, 0x86, 0x0B, 0x36, 0x6A, 0x44, 0x5F, 0x37, 0x70, 0x00, 0x48,
-    0xB6, 0x0E, 0x17, 0x06, 0x5E, 0x78, 0xC7, 0x20, 0x8E, 0xD9, 0x34, 0x6C, 0x75, 0xE5, 0x19, 0x08,
-    0xE5, 0x62, 0xCC, 0x91, 0x57, 0xB0, 0xCB, 0x29, 0x20, 0x11, 0x8A, 0xE0, 0xB8, 0x2E, 0x9D, 0x4E,
-    0xE5, 0xE7, 0x53, 0x06, 0x73, 0x2A, 0x4D, 0x60, 0xF6, 0x3D, 0x13, 0xB4, 0x56, 0xCE, 0x73, 0x67,
-    0x8F, 0x7F, 0x7F, 0x27, 0x26, 0x4E, 0x75, 0x58, 0xA9, 0x8F, 0xDA, 0xA0, 0x59, 0xE7, 0x8B, 0xE5,
-    0xA8, 0x52, 0x6F, 0xB7, 0x41, 0xBD, 0x23, 0x5D, 0x92, 0x9F, 0x55, 0x75, 0xFC, 0x8A, 0x09, 0x11,
-    0x4E, 0x81, 0xD4, 0x90, 0x61, 0xBC, 0x91, 0xF0, 0x83, 0xCA, 0x89, 0x8A, 0x18, 0xE0, 0x1F, 0x36,
-    0x7E, 0xAB, 0xCA, 0x23, 0xEB, 0x87, 0x20, 0xCB, 0x7D, 0x0F, 0xB4, 0xDC, 0x46, 0x6A, 0x7A, 0xAA,
-    0x9D, 0xC9, 0xF1, 0xC4, 0xE8, 0x88, 0x50, 0xCC, 0x8C, 0x05, 0xC0, 0xF9, 0x04, 0x73, 0x04, 0xC6,
-    0x07, 0xC3, 0x60, 0x11, 0x09, 0x3E, 0xB3, 0x50, 0xF2, 0xED, 0x41, 0x97, 0x67, 0x39, 0x9C, 0x0F,
-    0xF6, 0xFD, 0xA2, 0xD1, 0xB2, 0x3D, 0xC7, 0xCC, 0x4E, 0x27, 0x8C, 0xC7, 0xC6, 0xE2, 0x42, 0xBF,
-    0xE5, 0x72, 0xC9, 0x6D, 0x6E, 0x01, 0x78, 0x39, 0x90, 0xC6, 0x9D, 0xCB, 0x22, 0x66, 0x74, 0x41,
-    0x26, 0xA9, 0x46, 0x9E, 0xA4, 0x3D, 0x28, 0x02, 0x99, 0x17, 0x1F, 0x89, 0x00, 0xAA, 0xCE, 0x4A,
-    0x55, 0xDB, 0x54, 0xDD, 0xC2, 0x36, 0xBC, 0x0D, 0xE3, 0x82, 0xFF, 0xE2, 0xBB, 0x8D, 0xC4, 0xF7,
-    0x2B, 0x18, 0x1B, 0x19, 0x19, 0x3E, 0x9F, 0x60, 0x52, 0x9A, 0x62, 0xC3, 0x32, 0x32, 0x56, 0x68,
-    0x9D, 0x64, 0x1F, 0x40, 0x0C, 0xBF, 0x67, 0xF3, 0xEC, 0x1D, 0x68, 0xFF, 0x1C, 0x9E, 0x0E, 0x63,
-    0x38, 0x33, 0x72, 0x47, 0x52, 0xF0, 0x97, 0xE3, 0x8B, 0x5D, 0x59, 0x2E, 0x20, 0x51, 0x18, 0x48,
-    0x3D, 0xF8, 0x0E, 0x14, 0x43, 0x62, 0xF3, 0xC8, 0x76, 0xFE, 0xBE, 0xCD, 0x8B, 0xC4, 0xE8, 0x3D,
-    0x3B, 0x67, 0xDA, 0xAD, 0x94, 0xAC, 0x8A, 0x65, 0x46, 0xDC, 0xF1, 0x9D, 0xF3, 0x12, 0xFA, 0xA9,
-    0x4D, 0xB7, 0x22, 0xB7, 0x9B, 0xB3, 0x6F, 0x05, 0x37, 0xF3, 0xE5, 0x06, 0xF4, 0x9F, 0x95, 0x20,
-    0xEE, 0xA2, 0x8E, 0x6C, 0x7E, 0xCD, 0xAA, 0x77, 0x0D, 0x98, 0x33, 0xA8, 0x5D, 0x5A, 0xBD, 0xED,
-    0x4C, 0x46, 0x1A, 0xEE, 0xDC, 0x0E, 0x40, 0x04, 0xC2, 0x72, 0x20, 0xC9, 0xE0, 0xC2, 0x2C, 0xBE,
-    0x48, 0x67, 0x62, 0x89, 0xD2, 0xCE, 0xA9, 0xB9, 0x4F, 0x9D, 0x58, 0xEA, 0x83, 0x32, 0x91, 0x36,
-    0x2A, 0x5F, 0x9E, 0xA1, 0x32, 0x41, 0xA3, 0xCA, 0x65, 0xAF, 0x0B, 0xEB, 0x38, 0x5F, 0xF7, 0x5B,
-    0x64, 0x52, 0xE9, 0x0E, 0x9F, 0x74, 0x6A, 0xEF, 0xD9, 0x9B, 0xD6, 0xA5, 0x73, 0x9A, 0x1E, 0x90,
-    0xBB, 0xC8, 0x44, 0x67, 0x28, 0xC6, 0xD3, 0x13, 0x73, 0x29, 0x01, 0x25, 0x1E, 0x00, 0x71, 0x74,
-    0x47, 0xF2, 0xB9, 0x43, 0x71, 0xF4, 0x65, 0xEB, 0xFC, 0x86, 0x1E, 0xE6, 0x39, 0xF5, 0x01, 0x1E,
-    0x74, 0x35, 0x05, 0x72, 0x62, 0x1F, 0x4C, 0xEC, 0x94, 0x87, 0x35, 0x32, 0xCD, 0x0D, 0x89, 0xD3,
-    0xA8, 0xF2, 0x49, 0x8B, 0xC9, 0x78, 0x82, 0x4C, 0xA6, 0x53, 0x36, 0x98, 0xB3, 0xA8, 0x2D, 0x75,
-    0xA3, 0xDA, 0x00, 0x59, 0x24, 0x20, 0xC1, 0x1B, 0x00, 0x22, 0x9A, 0x2C, 0xE0, 0x5D, 0xD2, 0xF9,
-    0xB6, 0xAA, 0x75, 0xD0, 0xA9, 0x72, 0x08, 0x1A, 0x9D, 0x1B, 0xDA, 0xA6, 0x3D, 0x50, 0xBA, 0x15,
-    0x47, 0xFF, 0x66, 0x8C, 0x21, 0x6B, 0x4C, 0xBE, 0xB0, 0xBC, 0xDB, 0x32, 0xED, 0xF9, 0xE6, 0xFC,
-    0x32, 0xB4, 0x2A, 0x20, 0xE0, 0x61, 0x9D, 0xEF, 0xEC, 0xCC, 0x3D, 0x90, 0xEF, 0x6B, 0x65, 0x05,
-    0x1A, 0x6A, 0x36, 0xDE, 0x52, 0x3E, 0x04, 0x9D, 0xCE, 0x07, 0x78, 0xDB, 0x5E, 0x17, 0x37, 0x87,
-    0x6B, 0xF1, 0xED, 0xE3, 0x69, 0xFA, 0x8F, 0xE6, 0xBA, 0x6E, 0xC4, 0x1F, 0x7F, 0x66, 0x36, 0xF4,
-    0xC7, 0xB7, 0xCD, 0xCE, 0x99, 0xF7, 0xE6, 0x87, 0x42, 0x70, 0x19, 0x84, 0x02, 0x6E, 0x9C, 0xEC,
-    0x4B, 0x8E, 0x99, 0xDC, 0xE4, 0x5D, 0x34, 0x8B, 0x9C, 0x5C, 0xD5, 0x33, 0x6F, 0x18, 0xDF, 0xF3,
-    0x3B, 0x46, 0x8D, 0xE8, 0x2B, 0x6E, 0x14, 0xED, 0xBE, 0x68, 0xF9, 0xDE, 0x68, 0x34, 0xE5, 0x82,
-    0xA3, 0x76, 0x9B, 0xC8, 0xF1, 0x40, 0x30, 0x7E, 0xAF, 0x3E, 0xB8, 0x10, 0xB9, 0x4F, 0x50, 0xF7,
-    0xE2, 0x2B, 0x54, 0x56, 0x8C, 0x57, 0x8C, 0x3E, 0xE0, 0xA4, 0xE8, 0x31, 0x96, 0x4B, 0xB2, 0xAB,
-    0x00, 0xEF, 0xAA, 0x79, 0x92, 0x38, 0x11, 0xE7, 0x06, 0x71, 0x01, 0x81, 0xF3, 0x1C, 0xA9, 0xE5,
-    0xF0, 0x8F, 0xF5, 0x8C, 0xC6, 0x6D, 0x17, 0x6E, 0x71, 0x16, 0x10, 0x60, 0x52, 0x16, 0x8F, 0xB8,
-    0xDD, 0xFD, 0xC7, 0xAD, 0xAB, 0x07, 0x72, 0x53, 0xF4, 0xB0, 0x4F, 0xEB, 0x59, 0x18, 0xE0, 0x25,
-    0xB8, 0xAE, 0xB8, 0xE2, 0x5C, 0xE9, 0x0A, 0x36, 0xAE, 0x16, 0x30, 0x95, 0x94, 0xB8, 0x0D, 0xBC,
-    0x05, 0xC9, 0x6A, 0xB0, 0x9D, 0x4C, 0x8C, 0xA0, 0x18, 0x23, 0x20, 0x26, 0x08, 0x85, 0xC9, 0x00,
-    0xEA, 0xB5, 0x3E, 0xF2, 0x88, 0xB7, 0x8D, 0xBE, 0x7F, 0xDD, 0xE8, 0x9B, 0xF7, 0x3A, 0x7D, 0xE3,
-    0x2F, 0x9D, 0xBE, 0xFD, 0xB0, 0xD3, 0x9F, 0xD8, 0x2E, 0xBB, 0x85, 0x30, 0x53, 0xB1, 0x65, 0x6D,
-    0x51, 0xE9, 0xB6, 0xA8, 0x93, 0x96, 0xDA, 0x04, 0xA9, 0x0E, 0x54, 0xBE, 0x26, 0xA7, 0x1E, 0xFC,
-    0x2D, 0x67, 0xE4, 0x33, 0xFD, 0x18, 0xA2, 0x64, 0x3B, 0x93, 0xF5, 0x0D, 0x59, 0xCF, 0x64, 0x17,
-    0x47, 0x21, 0x43, 0x21, 0x16, 0x87, 0x75, 0xD3, 0x3F, 0x1E, 0x0C, 0xCE, 0xA4, 0xF3, 0x65, 0x93,
-    0x89, 0xE1, 0x66, 0xEC, 0xF6, 0x5C, 0x90, 0x84, 0x89, 0xD0, 0x24, 0xDC, 0x40, 0x35, 0x01, 0x8B,
-    0xA7, 0x88, 0x7E, 0xFE, 0x25, 0xD9, 0x8D, 0x47, 0xD6, 0x8B, 0xA6, 0xA5, 0x91, 0x95, 0xA3, 0xF1,
-    0xFB, 0x58, 0xA6, 0x73, 0x32, 0x3D, 0xE3, 0x75, 0x19, 0xA9, 0x91, 0x94, 0x0C, 0xFA, 0x5C, 0x5C,
-    0x36, 0x09, 0xBE, 0x80, 0x10, 0xC5, 0x36, 0x78, 0x0C, 0x21, 0x95, 0x84, 0x4D, 0x78, 0xAB, 0xF3,
-    0xDA, 0x8C, 0xE0, 0x92, 0xF7, 0x1A, 0xF5, 0x99, 0x61, 0x65, 0x06, 0x31, 0x56, 0xB3, 0xC0, 0x49,
-    0xC7, 0xCE, 0x52, 0x57, 0xC5, 0x5C, 0xE8, 0xE2, 0xC7, 0x5D, 0x1D, 0xF4, 0x12, 0x60, 0xCB, 0x87,
-    0xF0, 0xCC, 0xC8, 0xE6, 0xCF, 0x05, 0xC1, 0xD2, 0x8F, 0xA1, 0xCB, 0x13, 0x87, 0xDF, 0x7B, 0x3D,
-    0x77, 0x31, 0xDE, 0x67, 0xC5, 0xE6, 0xE5, 0x27, 0xCA, 0xE5, 0x2E, 0x0D, 0xB5, 0x4E, 0x03, 0x22,
-    0x5E, 0x76, 0xE1, 0xE0, 0x83, 0x07, 0x5A, 0x18, 0x22, 0x7B, 0xB7, 0x1D, 0x0B, 0x56, 0xC9, 0x0D,
-    0x64, 0x6F, 0x3C, 0x89, 0x71, 0xE2, 0x23, 0x5B, 0x11, 0xFD, 0xB1, 0x5D, 0x59, 0xC3, 0x7C, 0xAC,
-    0x7D, 0xDB, 0xBA, 0x14, 0x90, 0xE5, 0x1D, 0xD6, 0x82, 0xD6, 0xEC, 0xE6, 0xD8, 0xE9, 0xEB, 0x50,
-    0x57, 0x1D, 0xD5, 0xD5, 0xCA, 0x42, 0x46, 0xAC, 0x20, 0xD0, 0xBF, 0xC2, 0x32, 0xF5, 0x3B, 0xB2,
-    0xDB, 0xCB, 0x06, 0x1E, 0x8B, 0x73, 0x90, 0xAF, 0x30, 0x0F, 0x98, 0xB6, 0xC1, 0x07, 0xC6, 0x20,
-    0x5A, 0xAE, 0xB3, 0x4C, 0x85, 0x28, 0x44, 0x32, 0x89, 0xFB, 0xA3, 0x90, 0x4F, 0x53, 0x15, 0x20,
-    0x2F, 0x0A, 0x5D, 0x0E, 0x92, 0x67, 0x35, 0x98, 0xC1, 0xBE, 0x42, 0x61, 0x04, 0x46, 0xD0, 0x23,
-    0xC8, 0x11, 0xAD, 0x37, 0xE2, 0xEF, 0x30, 0x91, 0xEC, 0xC1, 0x12, 0x6B, 0x12, 0xB6, 0x4B, 0x48,
-    0x31, 0xD4, 0xC6, 0x2E, 0x85, 0x59, 0x72, 0xD5, 0xAB, 0x29, 0xA6, 0x3C, 0xAD, 0x68, 0xFE, 0x4C,
-    0xA8, 0xE3, 0x32, 0x68, 0x21, 0x4B, 0xB2, 0x54, 0x97, 0x51, 0xE3, 0x5F, 0x96, 0x2B, 0x47, 0x0D,
-    0xCC, 0x18, 0xEF, 0xE0, 0xEA, 0x3A, 0xEE, 0x9C, 0x85, 0x41, 0x61, 0x71, 0x4D, 0xBC, 0xD7, 0x59,
-    0x45, 0x8C, 0x88, 0x35, 0xA1, 0xF7, 0x11, 0xF0, 0x75, 0x06, 0xEB, 0x90, 0x36, 0xA6, 0x69, 0x6B,
-    0x87, 0x58, 0x4F, 0x77, 0x29, 0x4A, 0x64, 0x4C, 0x9F, 0xCF, 0x94, 0x13, 0x82, 0x43, 0x52, 0x86,
-    0xE8, 0x0B, 0x62, 0xFC, 0x32, 0xE3, 0xFD, 0xA1, 0x8D, 0x3E, 0xA7, 0x8D, 0xE0, 0x43, 0x03, 0xD6,
-    0x0B, 0xD0, 0x85, 0x4A, 0x1A, 0x4F, 0x1B, 0xE3, 0x09, 0x26, 0xE0, 0xD2, 0x38, 0x6C, 0xCD, 0x8E,
-    0xCB, 0xEF, 0xE6, 0x39, 0xFB, 0xEE, 0x92, 0xFD, 0x70, 0xCC, 0x5C, 0x2D, 0x4B, 0xB3, 0x6E, 0x85,
-    0x3B, 0x66, 0x8B, 0x51, 0x4B, 0x82, 0x00, 0x19, 0x63, 0x2F, 0x7B, 0xBD, 0xCB, 0x7E, 0x0B, 0x2E,
-    0x14, 0x30, 0xA0, 0x9F, 0x16, 0x73, 0x40, 0xBA, 0x0D, 0x33, 0xD0, 0x7C, 0x18, 0x15, 0xBD, 0x63,
-    0xED, 0x32, 0xFA, 0x31, 0xB2, 0xD8, 0xAD, 0xCD, 0x82, 0x5D, 0x75, 0xAE, 0x5B, 0x77, 0x9B, 0x05,
-    0x63, 0x2C, 0xB9, 0xDE, 0x67, 0x76, 0x4A, 0xD7, 0xF2, 0xC0, 0xF6, 0x08, 0xCC, 0x43, 0xD1, 0x47,
-    0x1F, 0x99, 0x60, 0x58, 0xED, 0x76, 0x98, 0x05, 0xEB, 0x14, 0x28, 0x6E, 0x54, 0x18, 0xDE, 0xEF,
-    0xC3, 0x51, 0x5E, 0x3C, 0xBA, 0x1A, 0xB9, 0x0E, 0xEC, 0x90, 0xD9, 0x66, 0x69, 0xDF, 0x2F, 0x36,
-    0xE5, 0xC4, 0x58, 0x77, 0x5F, 0xE6, 0xFD, 0x16, 0x39, 0x4C, 0xC0, 0x7C, 0x4C, 0x10, 0x93, 0xF4,
-    0x1F, 0x5C, 0x80, 0x0E, 0x59, 0x0E, 0x1A, 0xC4, 0x66, 0xD1, 0xEE, 0x69, 0x75, 0x00, 0xB0, 0x72,
-    0x14, 0x90, 0xA5, 0xBE, 0x35, 0x84, 0x26, 0x6A, 0xB2, 0xB2, 0xF8, 0xB5, 0x89, 0x3A, 0x3C, 0xDD,
-    0x30, 0x11, 0xF2, 0x56, 0xAC, 0xDD, 0x0A, 0x02, 0xC2, 0x59, 0x49, 0x48, 0xD8, 0xE2, 0x3F, 0x6A,
-    0x8B, 0x41, 0xDB, 0xDF, 0xB5, 0x88, 0x64, 0xFD, 0x94, 0xD0, 0x80, 0x28, 0x8A, 0x72, 0x52, 0x8A,
-    0x78, 0xA2, 0x55, 0x40, 0xA5, 0xD4, 0x2B, 0xD8, 0x44, 0x4C, 0xA9, 0x17, 0x6A, 0x1E, 0x3F, 0x18,
-    0x0E, 0xA9, 0x56, 0x81, 0xCB, 0x52, 0x2C, 0xFA, 0x80, 0xF5, 0x08, 0xA6, 0x99, 0x46, 0x5F, 0x55,
-    0xC5, 0x00, 0xDF, 0xC5, 0x1B, 0x5C, 0x67, 0xE5, 0xE2, 0x79, 0x05, 0x70, 0x49, 0x03, 0x48, 0x54,
-    0xC1, 0x7D, 0x36, 0xC6, 0xB8, 0xC6, 0xE9, 0xE3, 0x39, 0x29, 0x65, 0x73, 0x70, 0x43, 0x9E, 0xAC,
-    0x1A, 0xBF, 0x09, 0xEA, 0x19, 0x1C, 0x3C, 0x3D, 0xB8, 0x50, 0x6B, 0x57, 0x36, 0x4F, 0xF9, 0xD4,
-    0xC3, 0x5D, 0xCB, 0x02, 0xA8, 0x5A, 0x3C, 0xBD, 0x6B, 0x22, 0x53, 0x94, 0xC5, 0x1D, 0x13, 0x0D,
-    0x1B, 0xD2, 0xC5, 0x37, 0xEA, 0xD0, 0xE6, 0x18, 0xCB, 0x25, 0xC2, 0x6E, 0x9A, 0x8F, 0x5A, 0x9F,
-    0xD5, 0xF9, 0x0E, 0x76, 0x80, 0xAD, 0x20, 0x4C, 0x0E, 0x0E, 0xB0, 0x6A, 0xE4, 0x5C, 0xC8, 0x85,
-    0x02, 0x6F, 0x8A, 0xB2, 0x5C, 0xB3, 0xF9, 0xB4, 0xE0, 0xE7, 0x43, 0xEE, 0x8D, 0x65, 0x86, 0x34,
-    0xEA, 0x96, 0x9C, 0xA8, 0x73, 0xAD, 0xE5, 0x2D, 0xBD, 0x4D, 0xBA, 0x54, 0xEA, 0xEE, 0xFF, 0x45,
-    0xAC, 0xE5, 0xC7, 0x18, 0xD9, 0x1F, 0xC2, 0x4D, 0xDF, 0xAA, 0xE1, 0x5F, 0x07, 0x3D, 0x66, 0xEB,
-    0xCD, 0x92, 0x7D, 0x34, 0x79, 0x96, 0x2B, 0xCF, 0x27, 0xCE, 0x37, 0x76, 0xC6, 0x45, 0x80, 0xA0,
-    0x6A, 0x54, 0xBA, 0x82, 0xCB, 0xD1, 0x3E, 0x5E, 0x36, 0x72, 0x1A, 0xDD, 0x0C, 0xEA, 0xF7, 0xF8,
-    0x32, 0x14, 0x53, 0x77, 0x72, 0x64, 0xDC, 0x60, 0xAE, 0x84, 0x30, 0x3C, 0x59, 0x42, 0x38, 0x56,
-    0x90, 0xB3, 0x94, 0x05, 0x5A, 0x2A, 0x49, 0xCD, 0xCC, 0x59, 0x9E, 0x0D, 0xE7, 0x31, 0xE0, 0x88,
-    0x88, 0xE3, 0xBF, 0x26, 0x5D, 0xF6, 0xEA, 0x98, 0xDC, 0x48, 0xFF, 0x5D, 0x28, 0x12, 0x87, 0x02,
-    0x0E, 0x14, 0xE4, 0x14, 0x5A, 0x27, 0x3B, 0x3A, 0xBC, 0x72, 0xFA, 0x2E, 0xA8, 0xA3, 0x52, 0x7A,
-    0xA6, 0xDE, 0x66, 0xD4, 0x6B, 0x14, 0x6A, 0xF3, 0x41, 0xF9, 0x38, 0x8D, 0x47, 0x89, 0x67, 0x90,
-    0x5A, 0x7A, 0xF0, 0xEF, 0x4C, 0xE4, 0x1F, 0xE5, 0xB9, 0xEC, 0x77, 0x71, 0x6B, 0xEB, 0x0A, 0x68,
-    0x66, 0x98, 0x35, 0x07, 0xF7, 0xFB, 0xB4, 0x80, 0xA5, 0xBD, 0xCD, 0x71, 0x0E, 0x7F, 0x73, 0x6D,
-    0x7C, 0x1E, 0xAD, 0xE1, 0xB9, 0x5B, 0x5E, 0x3B, 0x82, 0xB4, 0xC2, 0xDA, 0x77, 0xAD, 0x3D, 0x35,
-    0xFC, 0x01, 0x5B, 0x01, 0x0E, 0xAF, 0x49, 0x55, 0x4C, 0x97, 0x91, 0x07, 0x42, 0x7D, 0x63, 0xB7,
-    0x35, 0xCA, 0xC9, 0xF9, 0xAB, 0x24, 0x5A, 0xC8, 0x78, 0xD8, 0x31, 0xF7, 0x0C, 0x26, 0x95, 0x4D,
-    0x76, 0x0C, 0x17, 0xED, 0x78, 0x6C, 0xE0, 0xC5, 0xCF, 0x5D, 0x22, 0x1C, 0x39, 0xF6, 0xFC, 0x17,
-    0x55, 0xC2, 0x0D, 0xFD, 0xD6, 0x69, 0x29, 0xCD, 0x1B, 0x87, 0x56, 0xFE, 0xF9, 0xD1, 0x25, 0xE6,
-    0x79, 0x54, 0x71, 0x5A, 0x0E, 0x9E, 0xF0, 0x11, 0x20, 0xA7, 0x56, 0x49, 0xEC, 0x33, 0x21, 0xF2,
-    0x2E, 0x3C, 0x48, 0x19, 0x7B, 0x5C, 0xFC, 0xF9, 0x7F, 0x11, 0x89, 0xFC, 0xEC, 0xB0, 0x02, 0xA3,
-    0x6C, 0x17, 0x5B, 0x03, 0xC3, 0xF1, 0x8E, 0x14, 0xEF, 0x18, 0x98, 0xD5, 0xE1, 0x3C, 0x79, 0xBE,
-    0x77, 0x49, 0x07, 0xCB, 0xD0, 0x6E, 0xDB, 0x2C, 0xFF, 0x3D, 0x76, 0xD2, 0xBF, 0x89, 0xFC, 0x05,
-    0xD7, 0x1B, 0xF3, 0xD4, 0x22, 0x66, 0x51, 0x86, 0x66, 0xBE, 0x65, 0xF9, 0xD1, 0xE6, 0xEA, 0x7F,
-    0xDD, 0xD8, 0xC2, 0x0E, 0x51, 0xBD, 0x83, 0xCF, 0xB5, 0x7A, 0x4C, 0x20, 0x79, 0x97, 0xBB, 0xF2,
-    0xED, 0xC8, 0xEB, 0xFE, 0x9F, 0xAA, 0xB0, 0xAB, 0xA3, 0xF5, 0x5A, 0xAD, 0x55, 0xD1, 0xAB, 0xF9,
-    0x5C, 0x26, 0x62, 0x40, 0xB9, 0x07, 0xC7, 0xBA, 0x3B, 0x32, 0xAF, 0xD7, 0x5F, 0xC0, 0xF7, 0x86,
-    0xD8, 0x0E, 0xE1, 0x30, 0x4C, 0xB7, 0x21, 0x18, 0x89, 0x91, 0xC4, 0x0F, 0xF9, 0x8B, 0xC6, 0xFA,
-    0x93, 0x0F, 0xDB, 0x51, 0x96, 0x2D, 0xA6, 0x4C, 0xCF, 0x06, 0x34, 0x68, 0x93, 0xD4, 0x77, 0x75,
-    0x22, 0x18, 0x36, 0xF9, 0xFC, 0x85, 0x02, 0xFD, 0xB6, 0x7B, 0x63, 0xCF, 0x84, 0x95, 0xF7, 0x53,
-    0x98, 0xCC, 0xFC, 0xB2, 0x19, 0x93, 0xCF, 0xC5, 0x6A, 0xD3, 0x8B, 0xC1, 0xFB, 0x86, 0x4B, 0x7C,
-    0xEE, 0xBA, 0xE8, 0xBF, 0xA8, 0x57, 0x9F, 0x09, 0xF2, 0x19, 0x39, 0xB9, 0x19, 0x57, 0x41, 0x17,
-    0x41, 0x4D, 0x40, 0x1D, 0x16, 0xF9, 0xD3, 0xE1, 0x22, 0x68, 0x22, 0xF6, 0xCE, 0x4E, 0x08, 0x12,
-    0xC1, 0x74, 0xE1, 0x24, 0xE0, 0x89, 0xCE, 0x89, 0x99, 0x57, 0x72, 0x82, 0x0E, 0x26, 0xF9, 0xC8,
-    0x9B, 0x09, 0x4C, 0x0D, 0x2C, 0x4B, 0x51, 0xB3, 0x5A, 0xD9, 0x19, 0x59, 0xDA, 0x54, 0xB5, 0xCF,
-    0xAF, 0x71, 0xE4, 0xEC, 0xC8, 0xC8, 0xBC, 0x8D, 0x1F, 0x95, 0x8A, 0xB5, 0x8A, 0xFE, 0xF0, 0x24,
-    0xAC, 0x70, 0xB2, 0xCE, 0x93, 0x06, 0x0C, 0x85, 0x99, 0x90, 0xAD, 0x79, 0xDF, 0x1E, 0x8E, 0x92,
-    0xDD, 0xAF, 0x8F, 0xD1, 0xB4, 0x66, 0x54, 0x08, 0xAE, 0xCC, 0xC6, 0xD7, 0x27, 0x16, 0xEC, 0xB9,
-    0xE3, 0x8C, 0xB9, 0x01, 0x7B, 0xFA, 0x3D, 0x8C, 0x79, 0x68, 0x4F, 0xAF, 0x25, 0x4D, 0x46, 0xFF,
-    0xE3, 0xB2, 0xD0, 0xD1, 0xDB, 0xC7, 0x3A, 0x41, 0xE4, 0x68, 0x25, 0x71, 0x97, 0x76, 0x59, 0x08,
-    0x3D, 0x5A, 0x8C, 0x9C, 0x29, 0x6B, 0x8A, 0x3D, 0x93, 0xB9, 0x5F, 0x12, 0xB9, 0x1F, 0xC3, 0xF0,
-    0x07, 0x2D, 0x10, 0xC0, 0x89, 0x8B, 0x50, 0x49, 0x13, 0xD5, 0xAA, 0x89, 0x1B, 0xD7, 0xDA, 0x04,
-    0x57, 0x91, 0x31, 0x19, 0x5D, 0x45, 0x5D, 0xD1, 0x6B, 0xCC, 0xD7, 0xDA, 0x8C, 0xEC, 0x86, 0x5D,
-    0x1D, 0x90, 0x02, 0xD3, 0x80, 0xB7, 0x19, 0xE1, 0x1B, 0x7C, 0xF4, 0x6C, 0xCB, 0x60, 0x86, 0x49,
-    0x92, 0xB7, 0x6A, 0x45, 0x28, 0xCD, 0x74, 0x4F, 0x89, 0x37, 0x85, 0xA1, 0x33, 0xC4, 0x84, 0xF5,
-    0x93, 0xBF, 0x6A, 0xCA, 0x59, 0x3B, 0x85, 0x98, 0x32, 0x5E, 0xDA, 0xEB, 0x57, 0x9A, 0x2C, 0xFA,
-    0x6C, 0x48, 0x7E, 0x6B, 0xEC, 0xCD, 0x4A, 0x8F, 0x16, 0x33, 0xEE, 0x5E, 0x51, 0xF6, 0x18, 0x02,
-    0xD0, 0x20, 0xAC, 0xF6, 0x48, 0x20, 0xDF, 0xF4, 0x2E, 0x63, 0x1A, 0xAC, 0x61, 0xD0, 0x8E, 0x60,
-    0x5B, 0xAF, 0x87, 0x3D, 0xBA, 0xA8, 0x7A, 0xEA, 0x86, 0x08, 0x11, 0x90, 0x1A, 0x90, 0x51, 0x0B,
-    0x4F, 0x44, 0x42, 0x4C, 0x3F, 0x4C, 0x79, 0x33, 0xA1, 0x48, 0x61, 0x5D, 0x44, 0xAA, 0xFB, 0xCC,
-    0x44, 0x79, 0x23, 0x8F, 0x3F, 0x05, 0x32, 0xD3, 0x2F, 0x79, 0xB8, 0x28, 0x34, 0x0D, 0x43, 0x1D,
-    0x35, 0xAF, 0x2B, 0xF8, 0x66, 0xD3, 0x00, 0xD7, 0xC6, 0xFB, 0xD3, 0x36, 0xF5, 0xF7, 0x7B, 0xD9,
-    0xF1, 0xDA, 0x27, 0x86, 0xC4, 0x72, 0x20, 0x95, 0x4D, 0xDE, 0x36, 0x41, 0xAB, 0x2A, 0x2D, 0x45,
-    0x58, 0x07, 0x1D, 0xF2, 0xD6, 0xBB, 0x25, 0x19, 0x3D, 0x62, 0x7D, 0xB4, 0x71, 0xF7, 0xA9, 0xD0,
-    0x8B, 0xE7, 0xAA, 0xBE, 0xDE, 0x55, 0xCA, 0x67, 0x98, 0xB2, 0x72, 0x5B, 0x1C, 0x39, 0x53, 0x2E,
-    0x05, 0x42, 0x6C, 0xB2, 0x67, 0x00, 0x01, 0x6F, 0x5C, 0x39, 0x93, 0xFF, 0x18, 0x93, 0x6B, 0xA7,
-    0x9F, 0x1E, 0x2D, 0x53, 0x7A, 0xD0, 0x2F, 0x47, 0x1A, 0x70, 0xF7, 0x5C, 0xA8, 0x4E, 0xC2, 0x29,
-    0xC7, 0x29, 0x1D, 0x54, 0xE8, 0x10, 0xD7, 0x3C, 0x37, 0x02, 0x5B, 0xEB, 0x46, 0x1A, 0x1B, 0x46,
-    0x9B, 0xD2, 0x23, 0xFE, 0xE8, 0xC9, 0x32, 0xB1, 0xF9, 0x84, 0x77, 0x73, 0x18, 0xE5, 0xFD, 0x83,
-    0x3A, 0xEC, 0xF2, 0x7C, 0x95, 0xD9, 0xFD, 0x36, 0xAA, 0xBC, 0x88, 0x74, 0x20, 0xAE, 0x59, 0x29,
-    0x60, 0x29, 0x7F, 0x76, 0xC4, 0xAE, 0x8B, 0x4F, 0xD8, 0x41, 0xD8, 0x4C, 0x3F, 0x2E, 0xA3, 0xA7,
-    0x73, 0x22, 0x27, 0x2F, 0xBD, 0x00, 0x98, 0xA7, 0xDC, 0x5D, 0x51, 0xA8, 0x7C, 0x26, 0x00, 0x45,
-    0xF9, 0xDC, 0x30, 0xFD, 0x4D, 0x28, 0x8F, 0x0C, 0x49, 0x29, 0x6B, 0x1D, 0xAE, 0xD0, 0x4E, 0xDC,
-    0xF2, 0x9B, 0xC3, 0x8E, 0x98, 0x84, 0x92, 0xC5, 0xCA, 0x6C, 0x72, 0x75, 0x61, 0x79, 0xC3, 0x15,
-    0xD2, 0xD9, 0x62, 0x3B, 0x6B, 0xA9, 0xFB, 0xED, 0xD0, 0xD8, 0x58, 0xCD, 0xFB, 0xF2, 0x0A, 0x61,
-    0x5E, 0xB7, 0xE3, 0x2F, 0x6A, 0x7A, 0xE2, 0x2E, 0xE3, 0x7C, 0xC3, 0x33, 0xBB, 0x54, 0x94, 0xC4,
-    0x9B, 0x2C, 0xBA, 0x09, 0xF1, 0xE2, 0xC3, 0xA7, 0xE0, 0x66, 0x60, 0x44, 0xB0, 0x47, 0x68, 0xA6,
-    0x6C, 0x05, 0x47, 0xE8, 0xBA, 0x6A, 0xD1, 0x93, 0x84, 0xFB, 0xF1, 0xA0, 0x07, 0x9D, 0x23, 0x4D,
-    0xC2, 0xFF, 0x32, 0x44, 0xE7, 0xC2, 0x7F, 0x5A, 0xA4, 0x7F, 0x05, 0x5D, 0x52, 0xBF, 0x4F, 0x14,
-    0x41, 0x14, 0x7E, 0x7B, 0xA7, 0xB7, 0xE7, 0x6D, 0xC2, 0x50, 0x68, 0x42, 0x48, 0xCC, 0x5A, 0x1A,
-    0x73, 0x30, 0x16, 0x16, 0x9A, 0x00, 0xB3, 0xE6, 0x0A, 0x0B, 0x0A, 0xAE, 0xF0, 0x68, 0xA1, 0xB0,
-    0x22, 0x31, 0x58, 0x52, 0xC8, 0xEE, 0x26, 0x18, 0x29, 0x2C, 0xE0, 0x1F, 0x50, 0x28, 0x34, 0x01,
-    0x8D, 0xC1, 0x82, 0x44, 0x63, 0x0E, 0x6F, 0xCD, 0x15, 0x16, 0x14, 0x6C, 0x24, 0x86, 0x82, 0x44,
-    0x16, 0x89, 0xA1, 0xA0, 0x70, 0xCE, 0xAC, 0xB0, 0x84, 0x99, 0x7D, 0xBE, 0x3D, 0x44, 0xC4, 0x49,
-    0xF6, 0xED, 0xCC, 0xBC, 0x5F, 0xDF, 0xF7, 0xE6, 0x13, 0x4E, 0x3E, 0x01, 0xE1, 0x1B, 0x0B, 0x66,
-    0x90, 0xD8, 0x15, 0x79, 0x11, 0xE0, 0x21, 0x40, 0x0A, 0x79, 0xF4, 0xD9, 0x66, 0x24, 0x8C, 0x04,
-    0x00, 0x7A, 0x2F, 0x7B, 0xCF, 0xDE, 0x7E, 0x6D, 0xA9, 0xD1, 0x7B, 0x74, 0x28, 0x35, 0x94, 0x8D,
-    0x5A, 0xE0, 0x22, 0x40, 0xAD, 0xEA, 0x21, 0x36, 0x11, 0xF1, 0x11, 0xB4, 0x97, 0xB2, 0xD6, 0x11,
-    0x4D, 0x8C, 0x4D, 0x74, 0xE8, 0x24, 0xEC, 0xCD, 0xFD, 0x74, 0xCC, 0x11, 0xAC, 0x29, 0x95, 0x67,
-    0xAF, 0xEE, 0xEB, 0x4E, 0x16, 0x3C, 0x98, 0xB8, 0x0A, 0xBD, 0xFC, 0x87, 0x9B, 0xF6, 0x92, 0xDF,
-    0xB1, 0x22, 0x33, 0xA6, 0x56, 0x0D, 0xC7, 0x8E, 0x4A, 0xCF, 0x8D, 0xC5, 0xAC, 0x04, 0x35, 0xA4,
-    0xB6, 0xD4, 0x9C, 0xEE, 0x09, 0x88, 0x07, 0x2C, 0x34, 0x34, 0xC1, 0x23, 0x8C, 0x08, 0x85, 0x79,
-    0x63, 0x01, 0x72, 0x68, 0x2A, 0x26, 0x45, 0xD8, 0xF0, 0x31, 0xAF, 0x99, 0x62, 0x09, 0x8B, 0x99,
-    0xE4, 0x91, 0x08, 0x45, 0x40, 0xE9, 0x52, 0x44, 0x3C, 0xB2, 0x25, 0x93, 0x2C, 0x31, 0x15, 0x81,
-    0xCD, 0x6F, 0x1D, 0x68, 0x56, 0x09, 0x47, 0xFB, 0xD9, 0x81, 0x4E, 0x7A, 0x20, 0x5D, 0x1C, 0x42,
-    0x35, 0xB6, 0x14, 0x40, 0x1D, 0x2C, 0x32, 0x1D, 0xF9, 0x30, 0x56, 0xEE, 0x05, 0x80, 0x72, 0x3D,
-    0xAE, 0x97, 0xC1, 0x36, 0x24, 0x6E, 0xE9, 0x9A, 0x43, 0x66, 0xFC, 0xB6, 0x04, 0x28, 0xE6, 0x07,
-    0xD5, 0x8D, 0x73, 0x19, 0xAC, 0x12, 0x2A, 0xDE, 0x26, 0xDD, 0x5D, 0x49, 0xC4, 0x94, 0xF2, 0x82,
-    0x53, 0x56, 0x27, 0x74, 0xA0, 0xF1, 0x99, 0x90, 0xF1, 0x90, 0x8C, 0x88, 0x4A, 0x10, 0xF1, 0xA9,
-    0x0F, 0xC6, 0x37, 0x2D, 0x7C, 0x80, 0x3A, 0x9F, 0x8E, 0xEA, 0x56, 0x2A, 0xA2, 0xFB, 0x7C, 0x70,
-    0x3D, 0xD6, 0x62, 0x68, 0x3D, 0xF6, 0x70, 0x0E, 0x77, 0x8F, 0x0E, 0x13, 0xD7, 0xB5, 0x7D, 0x01,
-    0x9C, 0x8A, 0xFA, 0x02, 0xFD, 0x8C, 0x36, 0x25, 0x98, 0x44, 0xC4, 0x06, 0x60, 0x11, 0x30, 0x0D,
-    0x0C, 0x43, 0xB6, 0xAD, 0x59, 0x68, 0x85, 0xFC, 0xCE, 0x5C, 0x6B, 0x0F, 0xDF, 0xEF, 0xE8, 0x89,
-    0x81, 0xF6, 0xB4, 0xF3, 0xA8, 0x3D, 0xFC, 0x7E, 0x17, 0xBA, 0x97, 0x24, 0xE2, 0x06, 0x66, 0x33,
-    0x3F, 0x1B, 0x72, 0xA9, 0x36, 0x8C, 0x78, 0x84, 0x18, 0x40, 0x47, 0x5E, 0xF6, 0x71, 0xD6, 0x0C,
-    0xA0, 0x4A, 0xF3, 0x54, 0x9A, 0xAD, 0xA1, 0x42, 0x24, 0x43, 0x41, 0x1E, 0x8E, 0xE0, 0xC6, 0x97,
-    0x5F, 0xB2, 0x7F, 0x72, 0x84, 0x36, 0x18, 0x5B, 0xAF, 0x2D, 0x6C, 0xAE, 0x2D, 0xEF, 0x3C, 0xBD,
-    0xB9, 0x4B, 0xDE, 0xE2, 0x15, 0xEE, 0xF4, 0xE5, 0xE2, 0xF2, 0x9B, 0x7F, 0x24, 0xB0, 0xAC, 0xDC,
-    0x7A, 0x15, 0xFA, 0xB2, 0x01, 0xC6, 0xC0, 0xC1, 0xA8, 0xC2, 0xD9, 0x65, 0x6E, 0x27, 0xAE, 0xFD,
-    0xE4, 0xA7, 0x42, 0x11, 0xFC, 0xA5, 0x39, 0x69, 0xFB, 0x85, 0x57, 0xC7, 0xBA, 0xD1, 0xC7, 0x51,
-    0xAC, 0x3D, 0xD1, 0x81, 0x97, 0x2F, 0x08, 0xB5, 0xB9, 0xF9, 0x71, 0x5F, 0xAE, 0x28, 0xEE, 0x59,
-    0x5B, 0xCD, 0x18, 0xF7, 0x48, 0x50, 0x81, 0x67, 0xA8, 0xC2, 0x7C, 0x16, 0x57, 0x36, 0x12, 0x64,
-    0x58, 0x77, 0xB1, 0xD5, 0xC2, 0xE9, 0x4F, 0x09, 0xF5, 0x05, 0x09, 0xA6, 0x0F, 0x3D, 0xA7, 0xFF,
-    0xE8, 0xB8, 0xE2, 0xBB, 0x6C, 0x26, 0x32, 0x2B, 0x1D, 0x64, 0xBC, 0x9C, 0xFF, 0x60, 0xC1, 0x98,
-    0x73, 0xBE, 0x6A, 0x23, 0x89, 0x03, 0x31, 0xF6, 0x56, 0x95, 0xC0, 0x54, 0x48, 0x8E, 0xF2, 0xDA,
-    0xCC, 0xE3, 0x43, 0x12, 0x4E, 0x5B, 0xBF, 0xF4, 0xFD, 0xA1, 0xC3, 0xA3, 0x5B, 0x9E, 0x1A, 0x58,
-    0x71, 0x5D, 0xCD, 0x35, 0x90, 0x4A, 0x4F, 0x6E, 0xB4, 0xA7, 0x57, 0x6C, 0x75, 0x12, 0xE5, 0xFB,
-    0xF6, 0x4C, 0x50, 0x6C, 0x2B, 0x04, 0x8A, 0x96, 0x1F, 0x74, 0xB6, 0x77, 0x99, 0xAF, 0x49, 0xA0,
-    0x58, 0x25, 0x86, 0x42, 0x92, 0xC3, 0xEC, 0x69, 0xC6, 0x71, 0x16, 0xA0, 0x3B, 0x9D, 0x05, 0x0B,
-    0x69, 0x02, 0xA9, 0x93, 0x4B, 0x19, 0x29, 0x63, 0xB2, 0x8B, 0x42, 0xAF, 0x9F, 0x85, 0xD9, 0x05,
-    0xB5, 0x5A, 0x6D, 0xF8, 0x90, 0x51, 0x5A, 0xF6, 0x4A, 0xED, 0x6C, 0xD2, 0x43, 0x66, 0x0C, 0x07,
-    0x7E, 0x03, 0xC5, 0x5B, 0x4D, 0x6C, 0xDD, 0x56, 0x76, 0xBE, 0x24, 0x47, 0x66, 0x6B, 0xA2, 0x61,
-    0x16, 0x49, 0x16, 0x76, 0x67, 0xD8, 0x45, 0x37, 0x75, 0x93, 0x70, 0xD3, 0xC5, 0x00, 0x95, 0x74,
-    0xE9, 0x78, 0xE1, 0x85, 0x17, 0xD2, 0xC2, 0x9A, 0x02, 0xCD, 0xC2, 0x5D, 0x74, 0x91, 0x49, 0xD1,
-    0x6A, 0x93, 0x45, 0x16, 0x4F, 0x22, 0x13, 0xB7, 0x30, 0xD0, 0x2C, 0xAC, 0x45, 0x06, 0x2D, 0x30,
-    0x0B, 0xBB, 0x80, 0x07, 0xB0, 0x95, 0xB6, 0x72, 0x81, 0x2C, 0xDC, 0x81, 0xF4, 0x48, 0x5B, 0x28,
-    0x0C, 0x54, 0x0B, 0xD3, 0x71, 0x07, 0x5E, 0x04, 0xAD, 0x99, 0x38, 0x9D, 0x14, 0x36, 0x0A, 0x5D,
-    0xDB, 0xD4, 0x84, 0xB2, 0x2E, 0x79, 0xFB, 0x7D, 0x97, 0x4F, 0x3F, 0xFE, 0x9B, 0xC9, 0x2F, 0x2A,
-    0x91, 0xF7, 0xBD, 0xC7, 0xF7, 0x78, 0xDF, 0xB9, 0xE7, 0x9E, 0xFB, 0x9D, 0xEF, 0x9C, 0x73, 0x5F,
-    0x58, 0x0A, 0xD1, 0x09, 0x11, 0x2A, 0x21, 0xDE, 0x14, 0x8F, 0xFC, 0x49, 0x63, 0x42, 0x63, 0x8E,
-    0x98, 0xEE, 0x1D, 0x2D, 0x44, 0x2A, 0x44, 0x54, 0x08, 0x5F, 0x09, 0xC7, 0x98, 0x24, 0x35, 0x65,
-    0x64, 0xEA, 0x40, 0x09, 0x17, 0xEF, 0xE4, 0x33, 0xC7, 0x63, 0x63, 0x8E, 0x19, 0xF3, 0xA9, 0x31,
-    0x3A, 0x37, 0x46, 0x84, 0xA5, 0xF6, 0x9A, 0x54, 0x74, 0x71, 0x99, 0xAE, 0x35, 0x07, 0xFE, 0xE1,
-    0xC2, 0x6E, 0x8F, 0x87, 0x72, 0x33, 0x65, 0xCC, 0xAA, 0x31, 0x55, 0x8B, 0xEE, 0x13, 0x7C, 0x52,
-    0x78, 0x35, 0x7B, 0x2C, 0x52, 0xA3, 0x22, 0xA3, 0xFD, 0x4D, 0xE1, 0xE0, 0x9D, 0x34, 0x11, 0xD1,
-    0x9D, 0x45, 0xF4, 0x78, 0xBF, 0xEF, 0x71, 0x16, 0x37, 0xD8, 0xFB, 0x8D, 0xE1, 0xC7, 0x8C, 0x79,
-    0x77, 0xD1, 0x2C, 0x9E, 0xE3, 0xDD, 0x42, 0xE0, 0xE3, 0x22, 0xE4, 0xBB, 0x1D, 0x9F, 0x98, 0x86,
-    0x1F, 0xAA, 0xF1, 0x24, 0x2F, 0x84, 0xC1, 0xB5, 0xB0, 0xF4, 0x2B, 0x7C, 0x46, 0xE2, 0x89, 0xA7,
-    0xF0, 0x24, 0xC7, 0x13, 0x74, 0xD6, 0x85, 0x1A, 0x77, 0x75, 0xBD, 0x54, 0x63, 0xB8, 0x51, 0x88,
-    0x58, 0x88, 0x49, 0x21, 0x96, 0x77, 0x85, 0x4D, 0x4D, 0x9B, 0xF3, 0xE8, 0x86, 0x18, 0xE3, 0x9E,
-    0xC3, 0x3C, 0x79, 0x24, 0x3C, 0x66, 0x70, 0xCF, 0xEC, 0xFF, 0x08, 0x17, 0xFA, 0x09, 0xBB, 0xBC,
-    0x8C, 0xCA, 0x40, 0xC9, 0x84, 0x8A, 0x70, 0xCE, 0x43, 0x45, 0x02, 0x7D, 0x41, 0xB4, 0x56, 0xA0,
-    0x37, 0xF6, 0x22, 0xF2, 0x32, 0xD0, 0x29, 0xC6, 0x07, 0x2D, 0x37, 0xD0, 0x9F, 0x0A, 0x8C, 0x29,
-    0x45, 0x3E, 0x12, 0xE9, 0x0F, 0xBB, 0x8C, 0x5A, 0xF1, 0xD0, 0x57, 0xD0, 0xEC, 0xB3, 0x03, 0xB4,
-    0x67, 0x2D, 0x44, 0x60, 0x16, 0x04, 0xAF, 0xA3, 0x33, 0x85, 0x17, 0x98, 0x80, 0x08, 0x37, 0xB9,
-    0x9D, 0xBF, 0xE0, 0x9A, 0xB0, 0xFB, 0x69, 0x87, 0xFE, 0xD8, 0xAF, 0xDA, 0x67, 0x1E, 0xF6, 0xC3,
-    0x38, 0x71, 0x73, 0x43, 0xCB, 0x70, 0x55, 0xA1, 0xB9, 0x51, 0xB7, 0xF2, 0xC4, 0xE7, 0x9B, 0x5D,
-    0xBE, 0xAE, 0xA2, 0xA3, 0x1F, 0x35, 0x43, 0x79, 0xFA, 0xB6, 0x36, 0xBB, 0x23, 0x86, 0xEE, 0xA3,
-    0x92, 0x4D, 0x21, 0xA0, 0x9E, 0xDD, 0xA6, 0x84, 0xE2, 0x6C, 0x13, 0x55, 0x4E, 0x87, 0xC6, 0x35,
-    0x22, 0x56, 0xFD, 0x34, 0x95, 0x22, 0xA8, 0xAD, 0x15, 0xA0, 0x1B, 0x59, 0xD0, 0x8A, 0xBC, 0xC6,
-    0xCE, 0x85, 0xCC, 0xF8, 0xA6, 0xDF, 0xBF, 0x89, 0xF1, 0xC6, 0xFD, 0x9B, 0xFA, 0xB7, 0xDD, 0x8E,
-    0xD2, 0xDB, 0x29, 0x87, 0x11, 0x71, 0x0A, 0x85, 0xBB, 0xB8, 0x24, 0x84, 0x0F, 0xCB, 0x19, 0x35,
-    0x65, 0xB8, 0xDB, 0x24, 0x6C, 0x7E, 0xC2, 0xC6, 0xD4, 0x7E, 0x11, 0x1A, 0x1D, 0x14, 0x51, 0xD2,
-    0xB1, 0x49, 0xD9, 0xC8, 0x10, 0x4D, 0x8E, 0xC6, 0x74, 0x29, 0x1A, 0x9D, 0x67, 0xE8, 0xB3, 0xDB,
-    0x19, 0xD1, 0x5C, 0xDF, 0xBC, 0xBA, 0xD3, 0x4C, 0xEE, 0x6D, 0xD2, 0xC5, 0x9C, 0xD3, 0x0C, 0xC5,
-    0xB3, 0xA9, 0xE7, 0x84, 0x74, 0x35, 0x1A, 0x61, 0x9B, 0x16, 0x8D, 0xC3, 0x67, 0xC6, 0x36, 0x7C,
-    0xD7, 0x64, 0x3F, 0x66, 0x7F, 0xB0, 0xC8, 0x0E, 0xB3, 0x6C, 0x1A, 0x4C, 0x99, 0xA9, 0x30, 0x77,
-    0x26, 0xB3, 0xCB, 0x87, 0x0A, 0xB0, 0x8A, 0x10, 0x9E, 0xB5, 0xCA, 0xCD, 0x9F, 0x71, 0x0D, 0x75,
-    0xC2, 0x4E, 0xBB, 0x67, 0x0E, 0x43, 0x93, 0x35, 0x8C, 0x50, 0x16, 0x21, 0x6D, 0x53, 0x42, 0x19,
-    0xD4, 0xAB, 0xC2, 0x0A, 0xC0, 0xA5, 0x12, 0x26, 0x04, 0x9D, 0x39, 0xE8, 0xC7, 0x83, 0x52, 0x7C,
-    0x74, 0x85, 0x8F, 0xD1, 0x36, 0x85, 0xB5, 0xF0, 0xB4, 0x08, 0x2B, 0x18, 0xD6, 0x75, 0x2C, 0xAF,
-    0x1B, 0xE8, 0x68, 0xAD, 0x11, 0xD1, 0x2D, 0x25, 0xA2, 0xF5, 0x52, 0xC4, 0xA6, 0xC0, 0x09, 0x0D,
-    0x53, 0xEB, 0x5C, 0x57, 0xB0, 0x0D, 0x09, 0xC5, 0x4A, 0x2C, 0x86, 0xF4, 0x4C, 0x27, 0xD2, 0xF7,
-    0x4C, 0x96, 0x9E, 0x34, 0x2A, 0xCF, 0x8C, 0xDE, 0xB7, 0x00, 0x6D, 0x37, 0x23, 0x0B, 0x8C, 0x4B,
-    0xF1, 0xB4, 0xBF, 0xDE, 0x40, 0x43, 0x95, 0x63, 0x92, 0x53, 0x21, 0x71, 0xE6, 0x38, 0x8D, 0x4A,
-    0x5D, 0x53, 0xA7, 0x9E, 0xA9, 0xE5, 0xB1, 0xAD, 0x5A, 0x4E, 0xDD, 0x6D, 0xE4, 0x89, 0xB5, 0x46,
-    0xE6, 0xEF, 0x35, 0xD2, 0x4C, 0xE1, 0x0C, 0xB5, 0x6C, 0x71, 0x6A, 0x9C, 0x4D, 0xA8, 0x63, 0x85,
-    0x05, 0x46, 0x8D, 0xB8, 0x0A, 0xB3, 0x2D, 0x38, 0xCF, 0xB3, 0xD5, 0xA3, 0x5F, 0xE3, 0x9E, 0x15,
-    0xE7, 0x65, 0x16, 0x5E, 0xD6, 0x8E, 0x0E, 0xAB, 0x38, 0x49, 0x8F, 0x28, 0x4F, 0xA7, 0x22, 0xFA,
-    0x18, 0x8A, 0xD0, 0xB0, 0x83, 0x42, 0xC8, 0x06, 0xC8, 0xD0, 0x03, 0x53, 0x67, 0xC1, 0x67, 0x49,
-    0xA3, 0xA3, 0xC4, 0xC1, 0xF2, 0x8D, 0x3E, 0x13, 0xE2, 0x0D, 0x71, 0x20, 0x4D, 0x82, 0xF5, 0xD2,
-    0xDD, 0xAA, 0xC5, 0xB0, 0x15, 0x71, 0xFE, 0xEC, 0x17, 0xC6, 0xAC, 0x1B, 0xB3, 0x85, 0x59, 0x83,
-    0xD2, 0xA9, 0x55, 0x4C, 0x82, 0xD0, 0x23, 0x29, 0xF4, 0x68, 0xDE, 0x7C, 0x1A, 0x4D, 0xAE, 0x88,
-    0x21, 0x89, 0x70, 0x36, 0xA1, 0x23, 0x39, 0x45, 0xBC, 0xC3, 0xE5, 0x1C, 0xA8, 0x17, 0x96, 0x32,
-    0x71, 0x00, 0x6B, 0x04, 0x45, 0x2E, 0xCB, 0x96, 0x56, 0xA0, 0x00, 0x8F, 0x06, 0x2B, 0xC2, 0x6F,
-    0x64, 0x29, 0xD2, 0x55, 0x6D, 0xE7, 0x1D, 0xEB, 0xF6, 0xA6, 0xE9, 0xF0, 0x2D, 0x92, 0x5F, 0xE2,
-    0x3D, 0xCC, 0x42, 0xA3, 0xA4, 0x51, 0xDA, 0xBF, 0xAD, 0x82, 0x6B, 0x45, 0x2C, 0x7F, 0xA4, 0x8D,
-    0xB9, 0x4D, 0x64, 0x55, 0x63, 0xD3, 0x3D, 0xCC, 0x24, 0xF3, 0x1F, 0xA8, 0x81, 0x68, 0x06, 0x62,
-    0x19, 0x2D, 0x80, 0x30, 0xC5, 0x7C, 0x99, 0x6A, 0xE0, 0xE8, 0x81, 0x98, 0x18, 0x88, 0xC9, 0x81,
-    0xD3, 0x01, 0x8A, 0x52, 0xAE, 0xEA, 0xEA, 0x6B, 0xC2, 0x52, 0x0A, 0x48, 0x8C, 0x20, 0x33, 0x96,
-    0x57, 0xE2, 0x34, 0xB0, 0xB5, 0x79, 0x18, 0x5D, 0x9C, 0xB5, 0x22, 0xC0, 0xB0, 0xDC, 0x1A, 0xD0,
-    0xB2, 0x82, 0xA1, 0xC5, 0x09, 0xF1, 0x52, 0x66, 0x81, 0x0A, 0xAB, 0x83, 0xED, 0x9F, 0xB4, 0x1C,
-    0xDD, 0x15, 0x42, 0x2E, 0x61, 0x0A, 0x37, 0x75, 0xB4, 0xD4, 0x64, 0x34, 0x7D, 0xA1, 0xC5, 0xF1,
-    0xD2, 0x98, 0xB3, 0xBB, 0x9E, 0x81, 0x6E, 0xC2, 0x7A, 0x06, 0xDF, 0xB4, 0xDB, 0xCB, 0xFE, 0x17,
-    0x33, 0x58, 0x25, 0x1F, 0x61, 0xB1, 0x40, 0x5F, 0x31, 0x75, 0xA7, 0xC3, 0xCE, 0xC7, 0x44, 0xAA,
-    0xBC, 0xA2, 0x7C, 0xC7, 0xDA, 0xA8, 0x12, 0xBE, 0x4E, 0x61, 0xD3, 0x22, 0xBE, 0x89, 0xE5, 0x0B,
-    0xB1, 0x53, 0x18, 0xB6, 0x08, 0xB6, 0xBA, 0xB6, 0xF7, 0x41, 0x85, 0xD5, 0x29, 0xD7, 0x57, 0x60,
-    0xBA, 0x5E, 0x63, 0x34, 0xDC, 0x88, 0x18, 0x88, 0x4B, 0x18, 0x96, 0xB0, 0xAB, 0x11, 0xDF, 0xB7,
-    0xD5, 0x41, 0x45, 0xB2, 0x4B, 0xD7, 0x0C, 0xB4, 0x7E, 0xAA, 0x95, 0xC6, 0x83, 0xD9, 0x97, 0x46,
-    0x3B, 0x7F, 0x2E, 0x0C, 0x60, 0xA7, 0x1B, 0xC3, 0x8C, 0xB8, 0x58, 0x35, 0x45, 0xDA, 0x3A, 0xA6,
-    0x74, 0x60, 0x92, 0x18, 0x56, 0xFC, 0xBE, 0xE8, 0xD2, 0xA5, 0x0D, 0x63, 0xAE, 0x9A, 0x76, 0x9F,
-    0xC9, 0xBE, 0x4D, 0xF3, 0x0F, 0xB3, 0x65, 0x28, 0x4A, 0x43, 0x4A, 0x7A, 0xB9, 0xEC, 0x3B, 0x5D,
-    0x6E, 0xDF, 0x16, 0x44, 0x40, 0xD7, 0x98, 0xC2, 0xD6, 0x3E, 0x94, 0x2D, 0x16, 0x67, 0x19, 0x15,
-    0x98, 0xCD, 0xB0, 0x8C, 0x47, 0x0F, 0x59, 0xEB, 0x35, 0x34, 0x13, 0x3C, 0x44, 0xA5, 0x3C, 0xDC,
-    0xC6, 0x75, 0x74, 0xC3, 0x38, 0xAD, 0xCC, 0x0E, 0x2C, 0x70, 0x28, 0x99, 0xA7, 0x73, 0xCC, 0x32,
-    0xDC, 0x5B, 0x9B, 0xAB, 0xB0, 0xCD, 0xEB, 0xB8, 0xCD, 0x1B, 0xD9, 0xE6, 0x3A, 0x6D, 0x87, 0x5D,
-    0xD7, 0x76, 0x79, 0xDB, 0x76, 0xA9, 0x6E, 0x3B, 0xD9, 0xB4, 0x5D, 0x5C, 0xB7, 0x5D, 0xA4, 0x5A,
-    0x13, 0x56, 0x2D, 0xA4, 0xEB, 0x78, 0xC2, 0x5C, 0x8F, 0xC3, 0x6D, 0xEA, 0x9D, 0x13, 0xFD, 0xA5,
-    0x4F, 0x3B, 0xF1, 0x1D, 0x69, 0xEF, 0xEA, 0x78, 0x62, 0x41, 0xE0, 0xBC, 0xF3, 0x41, 0x9B, 0x17,
-    0xFE, 0xCE, 0x29, 0x0E, 0x92, 0xD8, 0xC0, 0x68, 0x60, 0xF7, 0x5A, 0x60, 0x88, 0x15, 0x20, 0xCF,
-    0x1C, 0x01, 0xBC, 0x34, 0xF0, 0x5D, 0x72, 0x8D, 0xFC, 0x05, 0x36, 0x1A, 0xAD, 0xD1, 0x76, 0x69,
-    0xAC, 0x50, 0x19, 0x7A, 0xDD, 0xD8, 0x47, 0xD3, 0xB6, 0x5E, 0x99, 0x8E, 0xCA, 0x10, 0xC2, 0xB4,
-    0xD8, 0x67, 0x36, 0xC5, 0x88, 0x84, 0xD0, 0xC7, 0x5E, 0x33, 0xE6, 0x41, 0xED, 0x68, 0xE8, 0x4E,
-    0x66, 0xD1, 0xB5, 0xCA, 0x7F, 0xD0, 0x3C, 0xF1, 0x22, 0x97, 0x59, 0x7C, 0xAD, 0x0A, 0x1E, 0x34,
-    0xAE, 0x9E, 0x11, 0x2F, 0x8A, 0x03, 0x17, 0x92, 0x00, 0xEB, 0x02, 0x7A, 0x85, 0x56, 0x65, 0x12,
-    0x4F, 0x95, 0xC1, 0xED, 0xDA, 0x6F, 0x20, 0xF7, 0x36, 0xD1, 0x32, 0x8E, 0x79, 0x5F, 0xA4, 0x70,
-    0x9C, 0x5C, 0x12, 0x16, 0xFC, 0xC0, 0x62, 0xE8, 0x69, 0x7B, 0xEF, 0x9C, 0x63, 0x42, 0x21, 0x48,
-    0x6E, 0x34, 0x3A, 0x69, 0x3C, 0xCC, 0x61, 0xA0, 0x7B, 0x4E, 0x10, 0xA9, 0xFE, 0x8C, 0xB7, 0x4F,
-    0x5E, 0xEB, 0x92, 0x37, 0xC2, 0xDE, 0x49, 0x69, 0x0E, 0xC0, 0xE1, 0x20, 0x62, 0xA3, 0xDF, 0x5C,
-    0x5C, 0xBC, 0x40, 0x0F, 0xB6, 0x7D, 0x5A, 0x80, 0xFD, 0x1A, 0xE7, 0x21, 0xB1, 0xFF, 0x64, 0x23,
-    0x74, 0x54, 0x44, 0x45, 0xE7, 0xD6, 0x7E, 0x2D, 0x85, 0xBC, 0xAA, 0x9C, 0x76, 0x05, 0x0A, 0x2F,
-    0x44, 0x0A, 0xE4, 0x83, 0xBD, 0x53, 0x26, 0x63, 0xA9, 0x0B, 0xB0, 0x61, 0xBF, 0x29, 0x1C, 0xE2,
-    0x50, 0x27, 0x9C, 0xAE, 0x47, 0x11, 0x0C, 0x63, 0x01, 0xCB, 0xB8, 0x9E, 0x08, 0xAB, 0xC1, 0x78,
-    0x58, 0x4D, 0x0C, 0x70, 0xCA, 0x13, 0x1B, 0xD4, 0x87, 0x86, 0xE8, 0xB5, 0x47, 0x4A, 0xF4, 0x8C,
-    0xAF, 0x07, 0x9F, 0x48, 0x09, 0xC7, 0x49, 0x9A, 0xC0, 0x7B, 0x2A, 0xF0, 0x16, 0x58, 0x91, 0x88,
-    0x61, 0xF0, 0x58, 0x33, 0x50, 0x1C, 0x35, 0x63, 0x91, 0x81, 0xE8, 0x41, 0x31, 0xAC, 0x1F, 0xC6,
-    0x4D, 0xB7, 0xB4, 0x90, 0x9F, 0x98, 0x4C, 0x2A, 0x59, 0xC7, 0xF8, 0x86, 0x08, 0x0A, 0xAD, 0x96,
-    0xC5, 0x72, 0x9C, 0xC4, 0x41, 0x19, 0x5C, 0xA9, 0x5D, 0xD5, 0x0A, 0xCC, 0x8E, 0x0C, 0xCB, 0x70,
-    0x15, 0xDE, 0xBA, 0x7F, 0x31, 0x55, 0x82, 0x3A, 0x79, 0x75, 0x27, 0x28, 0x9A, 0xE9, 0x7D, 0xC9,
-    0xCC, 0x4C, 0xDA, 0x13, 0x58, 0x74, 0x7E, 0x5C, 0x90, 0x3C, 0x2E, 0x4F, 0xD8, 0x63, 0x9C, 0x07,
-    0xB0, 0x5B, 0x03, 0xC1, 0xE5, 0x51, 0xF0, 0x3B, 0x1D, 0x99, 0x15, 0x7F, 0x73, 0xCE, 0xB2, 0x91,
-    0xD1, 0xB1, 0x32, 0x76, 0x78, 0xAB, 0x91, 0x47, 0xD7, 0xAB, 0x36, 0xCA, 0x8F, 0xD4, 0xF3, 0x6D,
-    0x78, 0x1D, 0x8B, 0xFC, 0xE8, 0x7A, 0x89, 0x97, 0xAF, 0xE1, 0x65, 0x50, 0x6E, 0xD5, 0xF1, 0x91,
-    0xF5, 0x72, 0x25, 0xC4, 0xCB, 0x49, 0xBE, 0x34, 0xD6, 0x87, 0x19, 0x4C, 0x98, 0x99, 0x99, 0x99,
-    0x39, 0x7E, 0x41, 0x38, 0xE7, 0xE4, 0xC9, 0x7A, 0x1E, 0x0B, 0x27, 0x3A, 0x89, 0x3B, 0x2B, 0xF4,
-    0xD0, 0x48, 0xF4, 0x14, 0x96, 0xBC, 0x10, 0xE3, 0x42, 0x80, 0x0B, 0xB8, 0x39, 0x2C, 0x56, 0xC2,
-    0x93, 0x2A, 0x3E, 0x52, 0xE9, 0xA0, 0x6C, 0x28, 0xFD, 0xAD, 0x5E, 0x7E, 0xD3, 0x2E, 0x2E, 0x2E,
-    0xE6, 0x89, 0xC5, 0x6E, 0x01, 0x26, 0x0F, 0x5A, 0xF0, 0xE2, 0x5F, 0x92, 0xDB, 0xF4, 0x27, 0xE9,
-    0xD1, 0xCE, 0x29, 0x67, 0x08, 0x19, 0x95, 0x85, 0x0B, 0x50, 0x24, 0x32, 0x24, 0x12, 0x24, 0xF2,
-    0x23, 0xD2, 0x23, 0xB2, 0x23, 0x92, 0xA3, 0x9E, 0x41, 0xB2, 0x99, 0x66, 0xD3, 0x8C, 0x1A, 0xF1,
-    0x58, 0xA3, 0x5B, 0xA8, 0x4B, 0x93, 0x34, 0xB5, 0xE4, 0xF5, 0xAD, 0xC6, 0xB7, 0xB7, 0x1A, 0x6A,
-    0xEC, 0xB4, 0x57, 0x3B, 0x9D, 0xF6, 0x95, 0xD3, 0x61, 0xD1, 0xB1, 0x29, 0x5D, 0x1A, 0xA8, 0x6B,
-    0xA6, 0x85, 0x07, 0xA8, 0xCE, 0x28, 0x4C, 0x63, 0x9F, 0xFE, 0x22, 0x81, 0x3C, 0xF0, 0xA3, 0x2A,
-    0xBE, 0x56, 0x48, 0x88, 0xA2, 0xFD, 0x07, 0x5C, 0x92, 0x2D, 0xA5, 0x98, 0xAD, 0x2D, 0x3F, 0x0E,
-    0x3B, 0x53, 0xD0, 0x32, 0xC0, 0xB3, 0xEA, 0x37, 0xE9, 0xE7, 0x67, 0x7E, 0x04, 0x0C, 0x30, 0xFD,
-    0x69, 0x7D, 0x95, 0xAB, 0x0D, 0x38, 0x38, 0x54, 0x0A, 0xA7, 0x0B, 0x9C, 0xED, 0xFD, 0x79, 0xE1,
-    0xE4, 0xFD, 0x3A, 0x7F, 0x41, 0xCC, 0x66, 0xD1, 0x61, 0xD3, 0xFA, 0x85, 0x31, 0x97, 0x55, 0xFE,
-    0x5A, 0x33, 0x80, 0x85, 0x47, 0x51, 0x16, 0xDC, 0x84, 0xE7, 0xD8, 0xC0, 0x88, 0x27, 0x52, 0xB0,
-    0xB7, 0x29, 0x93, 0xF8, 0x37, 0x3E, 0x56, 0x6E, 0xAD, 0x8C, 0xAB, 0xC7, 0xB9, 0x90, 0xB1, 0xDE,
-    0x8E, 0x14, 0xB9, 0xC9, 0xD4, 0x3E, 0x58, 0x79, 0x6C, 0xC0, 0x47, 0x1B, 0x6F, 0xE3, 0x44, 0xB1,
-    0x22, 0xC0, 0x5C, 0xC3, 0x42, 0xE3, 0xA1, 0x0C, 0x8B, 0x74, 0x86, 0x6B, 0x12, 0x74, 0xB6, 0xA5,
-    0x8D, 0xA7, 0x47, 0x5B, 0xC8, 0x79, 0xBD, 0xF3, 0xBA, 0x58, 0xC9, 0xDB, 0xC6, 0xEB, 0x60, 0x9C,
-    0x9F, 0xE3, 0x15, 0x97, 0xC8, 0x66, 0x0D, 0xE2, 0x2B, 0x97, 0x9A, 0x09, 0xB7, 0x59, 0x76, 0xF4,
-    0x25, 0xA1, 0x6B, 0xA1, 0x2F, 0x01, 0xAD, 0x18, 0x38, 0xB4, 0x31, 0x3C, 0x56, 0x3B, 0xDF, 0xC3,
-    0x03, 0xB8, 0x63, 0xE5, 0xE4, 0xCA, 0x47, 0x14, 0x85, 0x5E, 0x1B, 0x3B, 0xC2, 0x2E, 0x5F, 0x00,
-    0x01, 0x0D, 0x49, 0x38, 0x7C, 0x10, 0xFD, 0x7C, 0xB6, 0x88, 0x3E, 0x56, 0xFE, 0x06, 0x1C, 0x30,
-    0x24, 0x25, 0xD7, 0x06, 0xF9, 0x70, 0xFF, 0x55, 0xD0, 0x1B, 0x76, 0x7E, 0x31, 0x88, 0x84, 0x1A,
-    0x04, 0x97, 0x31, 0x64, 0xD3, 0x46, 0x30, 0x5F, 0xD7, 0xFA, 0x44, 0x13, 0x99, 0x2A, 0x37, 0x54,
-    0xEF, 0xC3, 0x45, 0x10, 0xD4, 0x8E, 0xB4, 0x35, 0x24, 0x8B, 0xC5, 0xCA, 0xDE, 0x79, 0xBA, 0x68,
-    0x5D, 0x35, 0x2E, 0xE1, 0xDA, 0x16, 0xBC, 0xFB, 0x7B, 0x4A, 0xCC, 0x47, 0x85, 0x5B, 0xA7, 0x22,
-    0xBC, 0xAE, 0x45, 0xEA, 0x2B, 0xF8, 0x0A, 0xE8, 0x91, 0x01, 0x9D, 0x39, 0x05, 0xDB, 0x0B, 0x0B,
-    0x0F, 0x13, 0x43, 0x82, 0x8B, 0xA9, 0x18, 0x02, 0x17, 0xAB, 0xF8, 0x9D, 0x46, 0xCE, 0x2C, 0xF7,
-    0xE4, 0xA6, 0xB5, 0x5E, 0x31, 0xBD, 0xF3, 0x4F, 0x18, 0x22, 0x54, 0xE4, 0xE4, 0x95, 0xDF, 0x44,
-    0x75, 0x5C, 0x78, 0x6D, 0xA4, 0x00, 0x8F, 0x26, 0x54, 0xB0, 0xD0, 0xF4, 0xF4, 0x7D, 0x7C, 0x2E,
-    0xBE, 0xF6, 0x45, 0x63, 0xC9, 0x88, 0xB2, 0xC1, 0x43, 0x61, 0x41, 0x25, 0xB3, 0x28, 0x2D, 0xB6,
-    0x9F, 0xF7, 0xEF, 0xD2, 0x49, 0xE0, 0xC2, 0xFA, 0x16, 0x4C, 0xC3, 0xCC, 0x6E, 0x98, 0x4A, 0xB6,
-    0x71, 0x93, 0xEB, 0xB8, 0x9C, 0x6F, 0xC4, 0xCB, 0x62, 0x3C, 0xAC, 0x01, 0xA4, 0x83, 0xE7, 0xC7,
-    0x53, 0x9D, 0x37, 0x7F, 0xB1, 0x00, 0x66, 0xAE, 0x5D, 0x98, 0x62, 0x07, 0xB6, 0xA2, 0xE3, 0x4E,
-    0xA7, 0xF3, 0xBA, 0x9B, 0xEF, 0xF4, 0xBC, 0xA9, 0xE7, 0x4D, 0x95, 0x1A, 0xCC, 0x6F, 0x92, 0x2F,
-    0x32, 0x5E, 0x06, 0x9B, 0x5A, 0x35, 0x5D, 0x60, 0x94, 0xBF, 0x1B, 0x74, 0x4C, 0x88, 0xE9, 0x0F,
-    0xC3, 0x2B, 0x55, 0x1A, 0x9C, 0x6C, 0x5F, 0x0D, 0xEB, 0xE5, 0xFC, 0xFA, 0x83, 0x5B, 0xA7, 0xD6,
-    0x27, 0xA3, 0x8D, 0x26, 0xBD, 0x7A, 0xAF, 0x8B, 0x56, 0x55, 0x8A, 0x05, 0xE9, 0xDD, 0xAE, 0x9D,
-    0x0D, 0x2D, 0xE6, 0x00, 0xC9, 0x60, 0x61, 0x9D, 0xC5, 0x29, 0xCB, 0x5D, 0x44, 0xB8, 0xAE, 0xBC,
-    0xFB, 0x08, 0x16, 0xE2, 0xC6, 0xC7, 0x57, 0x75, 0xDE, 0x8D, 0x6A, 0x30, 0xE9, 0xAF, 0xF6, 0xCD,
-    0xF2, 0x64, 0xB0, 0x5A, 0x5D, 0x9A, 0x94, 0x27, 0x6F, 0xAB, 0x17, 0xA8, 0x71, 0x11, 0x1D, 0x69,
-    0xBC, 0x46, 0x16, 0xE9, 0xC9, 0x36, 0x6C, 0xD2, 0x0A, 0xAA, 0x8D, 0x9B, 0xF9, 0x2D, 0x73, 0xF5,
-    0x56, 0xAB, 0xE7, 0xF2, 0x5B, 0x57, 0x6F, 0x6A, 0x3D, 0x2F, 0xCF, 0xAC, 0x7D, 0xBA, 0xA1, 0x87,
-    0x63, 0x51, 0x31, 0x29, 0xE2, 0xB0, 0x40, 0x1C, 0xE8, 0x29, 0x18, 0x21, 0x6C, 0x19, 0x2F, 0x6E,
-    0x20, 0xF8, 0xE8, 0xFD, 0x0F, 0xC2, 0xF2, 0x9B, 0xB5, 0xBF, 0xD9, 0x82, 0x0A, 0x21, 0x0C, 0xC1,
-    0x94, 0x90, 0xB5, 0xDE, 0x45, 0xF0, 0x0A, 0x40, 0x07, 0x87, 0x9E, 0x47, 0x9B, 0x1F, 0x26, 0x09,
-    0x8D, 0x4D, 0x83, 0xB7, 0xF0, 0x01, 0xDC, 0x87, 0xA3, 0x9B, 0xC1, 0x6C, 0xAD, 0xB4, 0xFC, 0x0C,
-    0x8E, 0xAE, 0x7B, 0xF4, 0xB8, 0x20, 0x00, 0x54, 0x89, 0xF3, 0x90, 0xAB, 0xC0, 0x08, 0x73, 0xB9,
-    0x0E, 0x15, 0x96, 0x13, 0x94, 0xAD, 0x3C, 0x3C, 0x4C, 0xD8, 0x57, 0xBF, 0x04, 0x3C, 0x9A, 0x77,
-    0x30, 0x45, 0xF0, 0x4D, 0x5E, 0xF3, 0x63, 0x06, 0x8E, 0xE0, 0x99, 0xCC, 0x37, 0x10, 0x95, 0x86,
-    0xBD, 0x4A, 0xF7, 0x75, 0x88, 0x0A, 0x82, 0x0E, 0xC4, 0x08, 0xD1, 0x4B, 0x50, 0x92, 0x86, 0x0E,
-    0x81, 0x2E, 0xDF, 0xF3, 0x0C, 0xB4, 0xD4, 0xB8, 0xE0, 0x2D, 0xC6, 0xD0, 0x29, 0x7F, 0xF0, 0xF0,
-    0xA2, 0x03, 0x7B, 0xC0, 0x92, 0x88, 0x32, 0xB1, 0x9D, 0x9F, 0xB0, 0xC1, 0xE7, 0xE8, 0xC5, 0x9B,
-    0x96, 0x6C, 0xAD, 0xD6, 0x6E, 0x13, 0x17, 0x32, 0x69, 0x3D, 0x15, 0xA8, 0x79, 0x21, 0x4F, 0x97,
-    0x6E, 0x0B, 0x53, 0x86, 0xB1, 0xE4, 0x04, 0x0F, 0x68, 0x56, 0x59, 0x28, 0x03, 0x36, 0xC2, 0xC4,
-    0x0F, 0x98, 0xCC, 0x85, 0x05, 0x61, 0xA2, 0x5C, 0x3B, 0xC9, 0x10, 0xEB, 0x20, 0x03, 0x73, 0x92,
-    0x7F, 0x1D, 0x1D, 0x6D, 0xA4, 0x53, 0x43, 0xAD, 0x51, 0xA2, 0x77, 0x9E, 0xC4, 0xEF, 0xD4, 0xF1,
-    0x65, 0x86, 0x94, 0x01, 0xF1, 0x0B, 0xB4, 0x15, 0x21, 0x45, 0x4D, 0xCE, 0x0A, 0xBC, 0x75, 0xF9,
-    0x24, 0xA6, 0x03, 0x9C, 0xE6, 0x17, 0x90, 0x49, 0x0D, 0x85, 0x04, 0x7D, 0x4E, 0x31, 0x28, 0x42,
-    0x13, 0x8C, 0x98, 0xDF, 0x13, 0xF1, 0x29, 0x84, 0xFA, 0x02, 0x88, 0x75, 0xAC, 0x09, 0x9A, 0xB0,
-    0x3E, 0x94, 0xED, 0x3F, 0xFB, 0x88, 0x73, 0x02, 0xA6, 0xC4, 0x89, 0x04, 0x9E, 0x5C, 0x19, 0xBD,
-    0x30, 0xE6, 0xAE, 0x31, 0x9B, 0x96, 0x12, 0x33, 0xBB, 0x42, 0x56, 0xFE, 0xFC, 0xF7, 0x2E, 0xBE,
-    0x7C, 0xF1, 0xE5, 0xEA, 0xE5, 0x6A, 0xA2, 0x9E, 0xCB, 0x5B, 0xF9, 0xBF, 0xE2, 0xFB, 0xF8, 0x7F,
-    0xA5, 0xDB, 0xF7, 0xCE, 0x8E, 0xFF, 0x39, 0x39, 0xF2, 0x3F, 0xF1, 0xD1, 0x67, 0x38, 0x1C, 0x8E,
-    0x19, 0x37, 0x34, 0x3B, 0x0E, 0xA7, 0xD9, 0x76, 0x38, 0xAF, 0xD1, 0xE1, 0xC0, 0xBF, 0xC0, 0x59,
-    0xC1, 0xE1, 0x94, 0x7A, 0xDB, 0xBF, 0x7C, 0x61, 0x2C, 0xC8, 0xF6, 0x51, 0x66, 0xD1, 0xFB, 0x6C,
-    0xF7, 0x1C, 0xA2, 0x2B, 0x06, 0x58, 0x95, 0x3D, 0x94, 0xB5, 0x77, 0x7C, 0x4A, 0xCD, 0x09, 0x35,
-    0x29, 0xEE, 0xAD, 0xF0, 0xB9, 0x0D, 0x70, 0x68, 0xD9, 0xCB, 0xCF, 0xE3, 0xFC, 0xA1, 0x10, 0x83,
-    0xBD, 0x27, 0x02, 0xC2, 0x81, 0x34, 0x62, 0x30, 0x1E, 0x25, 0x73, 0xE3, 0x21, 0xCE, 0x38, 0x59,
-    0xC1, 0xEB, 0x21, 0xAE, 0x0F, 0x5F, 0x10, 0xCF, 0x09, 0x2F, 0x43, 0xAF, 0xE3, 0x22, 0x04, 0xD3,
-    0x57, 0x0A, 0x9F, 0x38, 0x7D, 0xF0, 0xB6, 0x51, 0xA6, 0x72, 0xDE, 0x17, 0x00, 0xC4, 0x64, 0x85,
-    0xC9, 0x1D, 0xA7, 0xDE, 0xFF, 0x41, 0x45, 0x27, 0x31, 0xFF, 0xBC, 0x57, 0x3F, 0xCC, 0x4F, 0x21,
-    0x22, 0xEE, 0x92, 0x0F, 0x83, 0x3A, 0x38, 0x6A, 0xAA, 0x0F, 0xDB, 0xD9, 0x63, 0x53, 0xE2, 0xD2,
-    0xCF, 0x95, 0xBF, 0xD6, 0x89, 0xF1, 0xBC, 0xF2, 0xD6, 0x96, 0xC4, 0xE0, 0x5F, 0xDA, 0xD9, 0xF7,
-    0x00, 0xC0, 0x17, 0xD3, 0x2E, 0x70, 0xE0, 0x2D, 0x01, 0xF9, 0xF9, 0x52, 0x32, 0xF0, 0xCA, 0x58,
-    0x34, 0x41, 0x31, 0xE9, 0x74, 0x27, 0xB2, 0xD8, 0x54, 0x01, 0x30, 0x57, 0x19, 0x0F, 0x08, 0xD5,
-    0x06, 0x2A, 0x3F, 0xA2, 0x65, 0x65, 0xC4, 0xFE, 0xDE, 0x8C, 0xBB, 0x51, 0x56, 0xE0, 0xB1, 0xBF,
-    0x2F, 0x83, 0x79, 0x30, 0x25, 0x1E, 0x37, 0xEA, 0xE8, 0x66, 0xFD, 0x35, 0x6E, 0x17, 0x18, 0x30,
-    0xCF, 0x97, 0xA0, 0x54, 0x46, 0x8E, 0xF3, 0x74, 0xCD, 0x9C, 0x94, 0xD6, 0xE6, 0x8E, 0xA0, 0xFB,
-    0xBB, 0x70, 0xB9, 0x0E, 0x38, 0xAC, 0x68, 0x46, 0xA7, 0xE6, 0xE9, 0xA2, 0x75, 0xB5, 0xDB, 0xBA,
-    0x70, 0x03, 0x5E, 0xCB, 0x88, 0x21, 0x66, 0x6C, 0x86, 0x99, 0x79, 0x11, 0x73, 0x40, 0xEF, 0x1B,
-    0xB1, 0x1F, 0x27, 0x71, 0x2D, 0x09, 0x96, 0x77, 0xCE, 0x77, 0xCC, 0xF9, 0x3C, 0xE1, 0x12, 0x8C,
-    0x70, 0xCF, 0x93, 0xB4, 0x52, 0xD2, 0xE8, 0x70, 0x33, 0x29, 0xDE, 0x90, 0x8B, 0xF0, 0xDA, 0xD9,
-    0x04, 0x71, 0xEB, 0xBC, 0x65, 0x45, 0x58, 0xBB, 0xCA, 0xC6, 0xA7, 0x80, 0xBF, 0x0A, 0xA8, 0x12,
-    0x26, 0xD3, 0x21, 0x48, 0xED, 0xA6, 0xE0, 0x72, 0x3B, 0x48, 0xFF, 0x15, 0xFE, 0x04, 0x5C, 0x1B,
-    0xE3, 0x6B, 0xF6, 0x5B, 0x50, 0x8F, 0x61, 0x7A, 0xAB, 0xFA, 0x10, 0x9E, 0x3A, 0x67, 0xA3, 0xC3,
-    0x35, 0x8F, 0xD7, 0xEA, 0x18, 0x07, 0xAE, 0x17, 0x36, 0xC7, 0x95, 0x46, 0x6B, 0xBF, 0x6A, 0x7B,
-    0x1D, 0x9D, 0xC5, 0x72, 0xC3, 0xAA, 0x1B, 0x35, 0x58, 0x76, 0xB1, 0x6D, 0x32, 0xB2, 0xC6, 0x02,
-    0x94, 0xAD, 0xB1, 0xE3, 0xED, 0xFF, 0xF8, 0x0A, 0xFF, 0x4E, 0x03, 0x7D, 0xF4, 0xFF, 0xCA, 0xC5,
-    0xBF, 0xA7, 0x7C, 0x95, 0xAA, 0xB4, 0xCA, 0xC9, 0x91, 0x98, 0x92, 0xC0, 0x5A, 0x50, 0xE3, 0xC2,
-    0x2B, 0x94, 0x08, 0xBD, 0x3B, 0xC0, 0x31, 0x93, 0xA8, 0xF1, 0x18, 0x2F, 0xC7, 0x43, 0xEF, 0x0A,
-    0x1A, 0x73, 0xAA, 0x92, 0x4D, 0xB4, 0x3B, 0x4F, 0x7E, 0xF6, 0x7B, 0xE2, 0x6D, 0x1F, 0x0F, 0x6F,
-    0xE1, 0x21, 0x81, 0x5B, 0x9D, 0x86, 0x17, 0x3A, 0x95, 0xBD, 0x35, 0xF7, 0xB6, 0xFF, 0xDA, 0xE7,
-    0xD9, 0x5B, 0x93, 0x6F, 0xFB, 0xE6, 0x6A, 0x96, 0xD6, 0xBF, 0x79, 0xAA, 0xD6, 0x7F, 0xDD, 0x54,
-    0x71, 0xB2, 0xB4, 0xD7, 0x52, 0xF3, 0x10, 0xB3, 0xE0, 0x14, 0xB9, 0x23, 0x52, 0x0A, 0xBE, 0x24,
-    0xC5, 0xA4, 0x4C, 0xA2, 0x13, 0x85, 0x7F, 0xAB, 0x70, 0x99, 0x61, 0xAC, 0x18, 0x21, 0x84, 0x98,
-    0x33, 0xA6, 0x41, 0x8D, 0x90, 0x08, 0xDF, 0xAE, 0x20, 0x5C, 0x2E, 0x6D, 0xE2, 0x0E, 0xE3, 0x3B,
-    0xB0, 0x1B, 0xA6, 0x7E, 0x69, 0x2F, 0x08, 0xE9, 0xFD, 0x0A, 0xC3, 0xB3, 0x2C, 0x30, 0x7F, 0x4A,
-    0x5A, 0xE9, 0x1B, 0x62, 0xEE, 0x1B, 0xCE, 0xDF, 0x15, 0xAF, 0x0E, 0xDC, 0xCF, 0x1F, 0x6B, 0x7E,
-    0x31, 0x9F, 0x9A, 0xCF, 0x01, 0xB0, 0x8A, 0x03, 0xEF, 0x47, 0x0C, 0x1C, 0x25, 0x0D, 0xA0, 0xBB,
-    0x79, 0x09, 0x3C, 0xD3, 0xAF, 0x7A, 0x82, 0x9B, 0x1A, 0x9B, 0x4F, 0xF5, 0x37, 0x4F, 0x20, 0x5C,
-    0x89, 0xE1, 0x5C, 0x06, 0xA2, 0x7B, 0x5D, 0xF5, 0x14, 0x8C, 0xE9, 0x29, 0x46, 0x56, 0xFD, 0xB8,
-    0xA7, 0x6D, 0x1F, 0x74, 0x1F, 0xF4, 0x22, 0x87, 0xBA, 0x73, 0x76, 0x02, 0x6C, 0x1F, 0xEF, 0x33,
-    0x0F, 0x91, 0xA1, 0xFB, 0x0C, 0x71, 0xAF, 0x48, 0x13, 0xF4, 0xE1, 0xEF, 0xF4, 0x11, 0xEF, 0xE9,
-    0x43, 0xD8, 0x5C, 0x45, 0x9F, 0xD3, 0x1D, 0x35, 0x18, 0x20, 0xE9, 0xD1, 0x2A, 0xC7, 0x79, 0x97,
-    0xB1, 0x09, 0x29, 0x49, 0x64, 0x23, 0x15, 0x0C, 0xC0, 0x69, 0x87, 0x29, 0xE0, 0x62, 0x18, 0x17,
-    0xBE, 0x1A, 0x86, 0x45, 0x80, 0xA6, 0x0A, 0xAB, 0x61, 0xA0, 0xE2, 0x72, 0x88, 0xC8, 0xAA, 0xE8,
-    0x3C, 0xED, 0x58, 0x4E, 0xC3, 0xB0, 0xA8, 0x00, 0x9D, 0x72, 0x34, 0x73, 0x64, 0x90, 0xA7, 0x11,
-    0x13, 0x5B, 0x55, 0x70, 0x7A, 0x4A, 0xD4, 0x75, 0x13, 0x85, 0xC7, 0x56, 0x55, 0x8D, 0xF0, 0xC2,
-    0x39, 0xE7, 0x76, 0x08, 0xDC, 0x4D, 0xD1, 0x46, 0xE6, 0x9E, 0x8E, 0xD7, 0xC0, 0x15, 0xAF, 0x18,
-    0xAC, 0x10, 0x53, 0xED, 0xEF, 0x83, 0xE1, 0x0C, 0xDD, 0x94, 0x52, 0xC5, 0x2A, 0x2D, 0xC2, 0x3A,
-    0x4F, 0x10, 0x84, 0x42, 0xE7, 0x3B, 0x67, 0x06, 0x52, 0xFC, 0xDF, 0xB3, 0x0C, 0x16, 0xE0, 0x93,
-    0xB9, 0x30, 0x6D, 0xC6, 0x4B, 0x90, 0x58, 0x3B, 0x89, 0xF0, 0xBA, 0xF0, 0x8A, 0x79, 0xA0, 0x40,
-    0x93, 0x64, 0xD0, 0x06, 0x10, 0x00, 0xE1, 0x82, 0x59, 0x82, 0x67, 0x6E, 0x11, 0x42, 0x9D, 0x2E,
-    0xFD, 0x4F, 0x31, 0xCF, 0xA0, 0x0A, 0x98, 0x01, 0xB2, 0x2F, 0x90, 0x42, 0x80, 0xD5, 0xAE, 0x21,
-    0xD0, 0xD2, 0x7D, 0x9B, 0x1D, 0xD5, 0xF0, 0xF0, 0x71, 0x03, 0x6F, 0x8F, 0x95, 0x8B, 0xB0, 0x2C,
-    0x61, 0x68, 0xCE, 0x04, 0xB3, 0x01, 0x7E, 0xB8, 0xE0, 0x44, 0x0D, 0xAC, 0xC0, 0xD7, 0x01, 0x93,
-    0x6A, 0x61, 0x03, 0x2B, 0x88, 0x58, 0x7A, 0x90, 0x74, 0x1B, 0xF4, 0x12, 0x96, 0xEA, 0xA5, 0x6C,
-    0x6C, 0xE0, 0xC1, 0x84, 0x86, 0xCD, 0x70, 0xD0, 0xB2, 0x47, 0x7F, 0xAF, 0xE2, 0xC5, 0xE7, 0x85,
-    0xDB, 0x4C, 0x88, 0x49, 0x98, 0x5C, 0x19, 0x27, 0x58, 0x39, 0x51, 0x06, 0x3B, 0x14, 0x54, 0x36,
-    0xC9, 0x16, 0xF9, 0x60, 0x21, 0xA2, 0xC6, 0xA6, 0xCA, 0xC4, 0x01, 0xAC, 0x1D, 0x30, 0x2F, 0x50,
-    0x6B, 0x3C, 0xC1, 0x02, 0x82, 0x35, 0xFD, 0x18, 0x46, 0x90, 0x32, 0x4C, 0xEE, 0xBE, 0x5A, 0xBE,
-    0x0D, 0xD8, 0x03, 0x92, 0x12, 0xCF, 0x92, 0x22, 0x7D, 0xD1, 0x2D, 0x9E, 0xAE, 0xC8, 0x6A, 0xCC,
-    0x93, 0xCC, 0x19, 0x48, 0x86, 0xD9, 0x28, 0x81, 0xDF, 0x30, 0x92, 0x6A, 0x68, 0x29, 0xCF, 0x98,
-    0x99, 0x39, 0x6E, 0x2C, 0xB4, 0xEA, 0x70, 0x14, 0x3E, 0x3F, 0xFA, 0x50, 0xDB, 0x6F, 0xDA, 0x7F,
-    0x96, 0x46, 0x54, 0x82, 0xDD, 0x0B, 0x51, 0x63, 0x0E, 0xAE, 0x76, 0xE7, 0x81, 0x9D, 0x0D, 0xA3,
-    0xA4, 0xC6, 0x5A, 0xAF, 0x60, 0x14, 0xC4, 0xA8, 0xE6, 0x48, 0x3B, 0x33, 0x1D, 0x67, 0x96, 0xFD,
-    0xC0, 0x17, 0xDB, 0x87, 0xF5, 0xCF, 0x5C, 0x66, 0xAE, 0x3B, 0xF3, 0x1A, 0x90, 0x23, 0x2E, 0xC2,
-    0x2B, 0x0D, 0x02, 0xE0, 0x0C, 0x0F, 0x8E, 0x8E, 0xDF, 0x35, 0x57, 0x74, 0x5C, 0xC7, 0x57, 0x1A,
-    0x9B, 0xEB, 0x28, 0x4D, 0xF1, 0xA1, 0xF8, 0x50, 0xFC, 0x7C, 0xC1, 0xE8, 0x66, 0xA2, 0xFE, 0x01,
-    0xFE, 0xDB, 0x1A, 0xEF, 0x78, 0xB4, 0x2E, 0x84, 0x3E, 0xA0, 0x1C, 0x01, 0xBE, 0xB3, 0xCE, 0x35,
-    0x46, 0x15, 0xDD, 0x37, 0x9F, 0x92, 0x92, 0xDF, 0x34, 0x67, 0x20, 0xAA, 0xBC, 0x45, 0xF4, 0x12,
-    0x79, 0xBE, 0xD5, 0xF4, 0x95, 0x9B, 0x3E, 0x8F, 0xD7, 0xF5, 0xB4, 0x9C, 0x49, 0x0D, 0xBF, 0x67,
-    0xEA, 0xA9, 0x7D, 0x08, 0x6C, 0x1A, 0x9D, 0x59, 0x55, 0x7C, 0x30, 0x30, 0xB3, 0x0F, 0xB8, 0x5C,
-    0xEA, 0xFC, 0x2A, 0x57, 0xD7, 0xBB, 0x06, 0xE0, 0x0B, 0xFE, 0xA7, 0x83, 0xBE, 0x5E, 0xE0, 0xF5,
-    0x29, 0x91, 0x3E, 0x7C, 0x60, 0x9E, 0xB5, 0x87, 0xF0, 0xE0, 0x23, 0x03, 0x4E, 0xBB, 0xA6, 0x57,
-    0x44, 0x74, 0xE6, 0x01, 0x60, 0x2E, 0x5D, 0x12, 0x36, 0x34, 0xED, 0xED, 0x84, 0xA4, 0xC8, 0x67,
-    0x96, 0x30, 0x65, 0x42, 0x6E, 0x0B, 0xB4, 0x2A, 0x3F, 0x7D, 0x93, 0xF9, 0xB3, 0x63, 0x34, 0x47,
-    0x8F, 0x92, 0x3C, 0xC7, 0x7E, 0x9E, 0x17, 0xBF, 0x3E, 0x5B, 0xF8, 0xF7, 0xA0, 0xC8, 0xF9, 0x4E,
-    0xB6, 0x10, 0xBE, 0xC5, 0x2F, 0xC9, 0xEB, 0x1E, 0x8D, 0x23, 0xC4, 0xB8, 0xD4, 0xB9, 0xCE, 0xAB,
-    0x1F, 0x60, 0x2A, 0xFE, 0xB8, 0x72, 0xAA, 0x18, 0x2C, 0x8F, 0x09, 0x3A, 0x8F, 0x99, 0x62, 0x44,
-    0x31, 0x42, 0x4E, 0x01, 0xB4, 0x3E, 0x6E, 0x84, 0x0F, 0x39, 0x1C, 0x66, 0x3A, 0x19, 0x74, 0xD3,
-    0x80, 0x03, 0x68, 0xC1, 0xE3, 0x30, 0x2D, 0x89, 0x63, 0xFE, 0x03, 0x2A, 0xF3, 0x36, 0x41, 0x63,
-    0x3A, 0xF8, 0xE2, 0xF4, 0xA4, 0xD9, 0x88, 0x2B, 0x69, 0x75, 0x49, 0x25, 0x0C, 0x48, 0x2A, 0x7B,
-    0x65, 0x4C, 0x15, 0x61, 0x94, 0x45, 0x08, 0x09, 0xE6, 0xB0, 0xAC, 0x88, 0xF1, 0xB2, 0x22, 0xA4,
-    0x4A, 0x2D, 0x26, 0x4D, 0x32, 0x29, 0xCB, 0x79, 0x96, 0x89, 0x9E, 0x1B, 0x0D, 0x72, 0xA4, 0x3E,
-    0x89, 0x50, 0x54, 0xA4, 0x99, 0xAD, 0x47, 0x84, 0x05, 0x90, 0x36, 0xBA, 0x76, 0x14, 0xD1, 0xDB,
-    0xB5, 0x29, 0x78, 0xCC, 0x6B, 0xB3, 0x80, 0xDF, 0x6B, 0x39, 0x93, 0x87, 0x10, 0xC9, 0x36, 0x92,
-    0xF9, 0x18, 0x79, 0x26, 0x85, 0x03, 0x3D, 0x33, 0xD5, 0x09, 0xF9, 0x37, 0x3E, 0x16, 0x38, 0x80,
-    0xB5, 0x82, 0x75, 0xE7, 0xCD, 0xA1, 0x44, 0x1C, 0x62, 0xAD, 0xCF, 0x2B, 0xFC, 0x72, 0x5C, 0x68,
-    0xAF, 0x88, 0x93, 0xF1, 0x9B, 0x95, 0xFF, 0x5F, 0x9A, 0x51, 0xA6, 0x8F, 0x79, 0x58, 0x59, 0xAF,
-    0x82, 0xFF, 0x4C, 0xB3, 0x65, 0xA7, 0x03, 0xC4, 0xD9, 0x7C, 0x65, 0x54, 0x9B, 0x24, 0x45, 0xA0,
-    0xF0, 0x4D, 0xF2, 0x95, 0xF0, 0xE9, 0xB0, 0xA7, 0xBE, 0x12, 0xA6, 0x7B, 0xDB, 0xA0, 0x61, 0xD0,
-    0x2A, 0x34, 0x34, 0x07, 0x92, 0x13, 0x31, 0x5A, 0xEC, 0x13, 0xB0, 0xBE, 0xB1, 0x31, 0x39, 0xB4,
-    0x9D, 0xB9, 0x9B, 0x00, 0xBA, 0xFB, 0xA6, 0x90, 0xAB, 0xB0, 0x2D, 0x04, 0x20, 0x98, 0xF0, 0xB0,
-    0x1E, 0x7B, 0xBD, 0x4E, 0x0B, 0x2B, 0x0E, 0x1C, 0x63, 0x05, 0x5C, 0x66, 0x39, 0x6A, 0xAB, 0x16,
-    0x56, 0x22, 0x9B, 0x54, 0x22, 0x70, 0xD8, 0x1A, 0x41, 0x8F, 0x39, 0x4C, 0x42, 0x7B, 0xD4, 0x4D,
-    0xF4, 0x39, 0x1A, 0xCA, 0x85, 0xD1, 0x99, 0x02, 0x74, 0x1D, 0xBD, 0x2A, 0x7D, 0x48, 0x2F, 0x8B,
-    0x57, 0xE7, 0x45, 0x98, 0x0B, 0xA6, 0xEB, 0xC8, 0x20, 0xD0, 0x3B, 0x66, 0x1D, 0x1F, 0x43, 0xDC,
-    0xBA, 0x9C, 0x16, 0x71, 0x60, 0xB3, 0x9C, 0x2C, 0xFF, 0x58, 0x5E, 0xC2, 0x74, 0x1C, 0x53, 0x9E,
-    0x11, 0x9C, 0xBE, 0x8F, 0x0B, 0x97, 0x79, 0x81, 0xF9, 0x4E, 0xD8, 0x0C, 0x23, 0x76, 0x63, 0xC3,
-    0x0A, 0xC6, 0xB2, 0xAC, 0x83, 0x1E, 0xEB, 0x16, 0xF3, 0x8F, 0x80, 0x9A, 0x75, 0x5E, 0xF8, 0x66,
-    0x56, 0x39, 0xB4, 0x1B, 0x1B, 0x68, 0xB0, 0xEE, 0xB5, 0x3F, 0x19, 0x38, 0x6A, 0xE0, 0xD4, 0xFD,
-    0xB1, 0xEC, 0xD4, 0x2B, 0x4E, 0x9D, 0x63, 0x49, 0x31, 0x15, 0xDF, 0x0C, 0xDD, 0x66, 0xC5, 0xD5,
-    0x43, 0x00, 0xAD, 0x78, 0x05, 0x07, 0x64, 0x30, 0xA6, 0x69, 0x19, 0x2A, 0xDF, 0xC6, 0xB7, 0xFE,
-    0x62, 0x66, 0xAA, 0x22, 0xD6, 0xF0, 0x8B, 0x61, 0x9E, 0x84, 0x1E, 0xDF, 0xB2, 0xA6, 0x68, 0xCF,
-    0x65, 0xB3, 0xB8, 0x64, 0x9D, 0x2D, 0x21, 0xD4, 0x46, 0x09, 0xA3, 0x08, 0x9B, 0xF5, 0x57, 0xC0,
-    0x76, 0x8A, 0x69, 0x84, 0x44, 0x89, 0xB0, 0x99, 0x58, 0x97, 0x52, 0xD2, 0x5E, 0x4D, 0x37, 0x70,
-    0xBA, 0x0B, 0x10, 0x48, 0xF0, 0x9C, 0x1B, 0x9D, 0x10, 0x0D, 0x73, 0xD2, 0xEC, 0x9C, 0x2B, 0x08,
-    0xF3, 0x86, 0xB6, 0x50, 0x25, 0x2C, 0x6A, 0xA0, 0x1B, 0xDF, 0x62, 0x47, 0x64, 0x13, 0xFD, 0x29,
-    0x8D, 0xDB, 0x61, 0x4A, 0x17, 0xCE, 0xDA, 0xB3, 0xD5, 0xA1, 0xD0, 0xD6, 0xA8, 0xE5, 0xD6, 0x26,
-    0x2F, 0x9B, 0x96, 0x8E, 0x79, 0x4B, 0xF3, 0xB2, 0xAB, 0xF9, 0x69, 0xEF, 0x1E, 0x3F, 0x1D, 0x5E,
-    0xE5, 0xA7, 0x25, 0x2E, 0x03, 0xE9, 0x78, 0x39, 0xE7, 0xE5, 0x2B, 0xE6, 0x28, 0x3E, 0x1D, 0xEC,
-    0xAD, 0x4F, 0x99, 0x3E, 0x5D, 0x88, 0xA6, 0x23, 0xFF, 0xE8, 0x9C, 0xA7, 0x34, 0xEE, 0x6E, 0x83,
-    0x00, 0x8F, 0x15, 0xC1, 0x6A, 0xC6, 0x35, 0xEB, 0x30, 0x47, 0x16, 0x3F, 0x70, 0x68, 0x06, 0xAB,
-    0xCB, 0xDB, 0x8D, 0xC3, 0x6B, 0x91, 0x6D, 0x58, 0x14, 0x8D, 0x16, 0xF6, 0xF2, 0xF9, 0xB3, 0x64,
-    0x0C, 0xAC, 0xCE, 0x85, 0x26, 0x62, 0x7E, 0x82, 0xA1, 0x63, 0x1B, 0x95, 0x43, 0x58, 0x46, 0x11,
-    0x5E, 0xD6, 0x9E, 0xF2, 0xAA, 0xD4, 0x69, 0x5C, 0x44, 0x18, 0xF3, 0x8E, 0x0E, 0x54, 0x74, 0xB9,
-    0x73, 0x5A, 0x7F, 0xD3, 0x5C, 0x94, 0x25, 0x93, 0x29, 0x8C, 0xD2, 0x98, 0x5D, 0x61, 0xE2, 0x9E,
-    0xAA, 0x9A, 0xFD, 0x6C, 0xBB, 0x63, 0xF2, 0x16, 0x79, 0xAF, 0x13, 0xF1, 0x96, 0x51, 0xD1, 0x95,
-    0x7A, 0x2E, 0x28, 0xEA, 0xF0, 0x88, 0x1A, 0x78, 0x45, 0x13, 0xB9, 0x6A, 0xD2, 0xFF, 0xA8, 0x09,
-    0x2F, 0x77, 0xE6, 0xDD, 0x56, 0xB2, 0x44, 0xC5, 0xC4, 0x91, 0xF9, 0x4C, 0x1C, 0x5C, 0xF8, 0x7A,
-    0xF9, 0xE6, 0x70, 0x94, 0x6F, 0xF6, 0x47, 0xF9, 0x66, 0xDE, 0xC7, 0x7C, 0xB3, 0x65, 0x66, 0xF6,
-    0xC3, 0xC5, 0x9E, 0x48, 0xFE, 0xE2, 0x4E, 0x24, 0x8F, 0xC5, 0x08, 0x13, 0xFB, 0x2D, 0x8F, 0x5F,
-    0xDF, 0x80, 0xF6, 0xA5, 0x85, 0x4D, 0x22, 0x12, 0x6C, 0x98, 0x15, 0xB7, 0xA9, 0x78, 0xB5, 0xB8,
-    0x74, 0xE7, 0x3C, 0x8B, 0xC9, 0x7D, 0x82, 0x31, 0x65, 0xDA, 0x92, 0x45, 0xD2, 0x47, 0x2E, 0x60,
-    0xFE, 0xE0, 0x8B, 0xFA, 0x18, 0x9D, 0x75, 0x24, 0x86, 0x2C, 0x44, 0x53, 0xD7, 0x46, 0x95, 0xCD,
-    0x28, 0x97, 0xB9, 0x3F, 0x11, 0xB6, 0x94, 0xA6, 0xFF, 0x60, 0xE5, 0x0D, 0xC2, 0xE7, 0xCE, 0xB1,
-    0x6C, 0xC9, 0xC9, 0x8A, 0x8D, 0xA3, 0x70, 0xBB, 0xC7, 0x03, 0xFD, 0x1A, 0xD8, 0x7E, 0x7A, 0xB8,
-    0xB5, 0x2C, 0x25, 0x2E, 0x83, 0x1A, 0x2F, 0x4D, 0x80, 0x30, 0x02, 0x10, 0xE1, 0x75, 0x5D, 0x8F,
-    0xDB, 0x91, 0xC5, 0x6C, 0x12, 0x92, 0x51, 0x8D, 0xDE, 0xD6, 0x7F, 0x2D, 0x46, 0x40, 0x4A, 0xDA,
-    0xBD, 0xDF, 0xC7, 0x24, 0x61, 0x19, 0xDC, 0xD7, 0x5E, 0x2D, 0x59, 0xF2, 0x1C, 0xB2, 0x08, 0x20,
-    0x4F, 0x14, 0xE1, 0xDD, 0x8A, 0x69, 0x71, 0xE0, 0x74, 0xD0, 0xD9, 0x9C, 0xFF, 0xA8, 0x8C, 0xBE,
-    0x53, 0x53, 0xDF, 0x16, 0xE2, 0xB5, 0x5E, 0x88, 0x68, 0x24, 0x04, 0x16, 0xE4, 0x8E, 0x10, 0xA6,
-    0x17, 0xC2, 0x2E, 0x14, 0xAC, 0xC2, 0x72, 0xEC, 0xC4, 0xE6, 0xF4, 0xD3, 0x85, 0x78, 0x51, 0x8C,
-    0x1D, 0x69, 0xDC, 0x26, 0x22, 0x11, 0xF7, 0x55, 0x50, 0x01, 0x4B, 0xC3, 0xC2, 0xDB, 0xC0, 0x4C,
-    0xE5, 0x19, 0xF3, 0xE4, 0xA1, 0xB1, 0x3B, 0x13, 0xFA, 0x7D, 0x17, 0xFF, 0xF6, 0x3A, 0x28, 0xB4,
-    0xB4, 0x7C, 0x9C, 0x54, 0x05, 0xCF, 0x72, 0xA8, 0x3C, 0xC5, 0x84, 0xC1, 0x9B, 0x29, 0x59, 0xB8,
-    0x30, 0x51, 0xF8, 0x79, 0xA2, 0x00, 0xB9, 0x09, 0x13, 0x71, 0x16, 0x21, 0x6D, 0x3C, 0x87, 0xB1,
-    0xE8, 0x9E, 0xA7, 0x99, 0x5B, 0x40, 0xED, 0x8F, 0x4C, 0x22, 0x2B, 0xA9, 0xA4, 0x0A, 0xBB, 0xB8,
-    0xB1, 0x0E, 0x6E, 0x7B, 0x46, 0xC0, 0x58, 0x26, 0xC4, 0x72, 0xE4, 0x20, 0xDA, 0xAD, 0xFC, 0x75,
-    0x04, 0x29, 0x09, 0xA3, 0x66, 0xA6, 0xC4, 0xE0, 0x35, 0xE0, 0xCF, 0x2B, 0x79, 0xB2, 0xCE, 0x21,
-    0x82, 0x9D, 0x11, 0x6E, 0x98, 0x80, 0x75, 0x29, 0xBD, 0x7F, 0xE9, 0xE1, 0x49, 0x38, 0x28, 0xFA,
-    0xAE, 0x21, 0xC0, 0x1E, 0xC6, 0x04, 0x05, 0x56, 0xDE, 0xB3, 0x2F, 0x61, 0x3C, 0x35, 0xC1, 0x89,
-    0x83, 0x33, 0x49, 0x6C, 0x93, 0x24, 0x36, 0x44, 0xEF, 0xF7, 0x91, 0xD8, 0xC2, 0xE6, 0x71, 0x69,
-    0xD6, 0x20, 0xF2, 0xB8, 0x08, 0x13, 0x25, 0x26, 0xBC, 0x42, 0xD4, 0xA1, 0xF0, 0xCA, 0xDD, 0x97,
-    0x7D, 0x2D, 0xC8, 0xF2, 0x7D, 0x6B, 0x33, 0xF4, 0xC1, 0x2E, 0x99, 0x43, 0x80, 0x98, 0x26, 0x17,
-    0x69, 0x80, 0x78, 0x11, 0xA1, 0x8D, 0x8F, 0x2F, 0xC5, 0x83, 0x57, 0xF9, 0x4A, 0x1E, 0x26, 0x0D,
-    0x66, 0x62, 0x59, 0x1C, 0xF8, 0xA9, 0xB2, 0x69, 0x2D, 0x7F, 0xF7, 0x41, 0xAA, 0xED, 0xC8, 0xA7,
-    0xBF, 0x72, 0x29, 0x78, 0xAF, 0x68, 0xD0, 0x64, 0x97, 0xDE, 0x0E, 0x4F, 0x5D, 0x06, 0x03, 0xCF,
-    0x86, 0x23, 0x46, 0x17, 0x70, 0x99, 0x80, 0x1D, 0x46, 0xBD, 0xDF, 0x7F, 0xA4, 0xD8, 0x70, 0x56,
-    0x0F, 0x6A, 0x3D, 0xD8, 0xD0, 0x72, 0x6B, 0xBB, 0xD8, 0xD0, 0xCE, 0x89, 0xDA, 0x1E, 0xD3, 0x2C,
-    0x36, 0xFC, 0x99, 0x4D, 0x01, 0xFD, 0xF2, 0x95, 0xBB, 0x13, 0xC6, 0xA6, 0x80, 0xC2, 0xEF, 0x07,
-    0x4C, 0x02, 0xD9, 0x2C, 0x14, 0x56, 0x20, 0x13, 0x52, 0xB0, 0x79, 0x50, 0x44, 0x40, 0xA0, 0x6B,
-    0x37, 0xD0, 0x94, 0x36, 0x6B, 0x9C, 0xAF, 0xC2, 0xB9, 0x76, 0x62, 0x0E, 0xE1, 0x23, 0x78, 0xFD,
-    0x6D, 0x98, 0x4D, 0x5F, 0xD3, 0xFA, 0xF7, 0xB3, 0xFB, 0xCF, 0xEE, 0xDE, 0xDA, 0x8A, 0xED, 0xAA,
-    0xFA, 0x17, 0xDC, 0xE0, 0x52, 0x41, 0x8A, 0xB0, 0x8A, 0x80, 0xA8, 0x9F, 0x80, 0x6F, 0x03, 0x63,
-    0x41, 0x2F, 0xD7, 0x94, 0x7F, 0x1F, 0x38, 0x9C, 0x27, 0xB9, 0x2C, 0x6D, 0x36, 0xE4, 0xA5, 0xC4,
-    0xD2, 0x3F, 0x35, 0x2A, 0x4D, 0xC3, 0x54, 0xA9, 0xBE, 0xB8, 0x08, 0x3E, 0xD5, 0xA2, 0x7B, 0x71,
-    0x76, 0xCD, 0x16, 0x59, 0xB8, 0xF8, 0x7B, 0x37, 0x87, 0x8F, 0x78, 0xAC, 0x29, 0xF4, 0xBB, 0x2C,
-    0x44, 0xBC, 0x29, 0x7E, 0xD7, 0xE2, 0x83, 0xB2, 0x7C, 0xB1, 0xB0, 0x2D, 0xAF, 0xDB, 0x85, 0xEE,
-    0xB0, 0xEF, 0x18, 0x20, 0x26, 0x3B, 0x27, 0x91, 0xFE, 0x15, 0x15, 0x25, 0x97, 0xF2, 0x51, 0x77,
-    0x85, 0xD3, 0x1D, 0xEF, 0xA9, 0x41, 0xB0, 0xE1, 0xDB, 0x7D, 0x47, 0x58, 0x36, 0xEC, 0x85, 0x37,
-    0xBE, 0xB4, 0x60, 0x85, 0xAA, 0xED, 0x0E, 0x0F, 0xBB, 0x5C, 0x28, 0x94, 0x2C, 0x82, 0x4F, 0xAC,
-    0x38, 0x57, 0x6D, 0x7B, 0xD4, 0x0A, 0x05, 0x1D, 0xFD, 0x24, 0x19, 0x6D, 0x1E, 0xB0, 0xA0, 0x68,
-    0xCB, 0x6D, 0xAF, 0x58, 0xA1, 0x6A, 0xD1, 0xF3, 0x24, 0xB6, 0x09, 0x33, 0x85, 0x04, 0x63, 0xDF,
-    0xF2, 0xD6, 0x9E, 0xA9, 0x0D, 0xB6, 0xE3, 0x4C, 0xAA, 0x5C, 0xA4, 0xED, 0x18, 0xA4, 0x5C, 0x55,
-    0xB1, 0x60, 0x85, 0xDC, 0x44, 0x56, 0xCA, 0x87, 0x33, 0xA3, 0xA5, 0x51, 0xFB, 0x74, 0xA8, 0x24,
-    0x43, 0x88, 0x7E, 0x28, 0x65, 0xC0, 0xAF, 0x2D, 0xED, 0xFD, 0xCF, 0xD8, 0xD8, 0xB3, 0x4B, 0xEF,
-    0xE6, 0xFA, 0xCD, 0x2A, 0x85, 0x18, 0x11, 0x5F, 0x08, 0xD0, 0x8A, 0xDF, 0xFC, 0xF7, 0xFF, 0x52,
-    0xA1, 0xDF, 0xDE, 0x14, 0x52, 0x33, 0x74, 0x71, 0xEC, 0x8D, 0xA2, 0xEF, 0x2B, 0xAE, 0x9F, 0x2D,
-    0xAA, 0x73, 0x7C, 0x6C, 0xFA, 0x45, 0xD0, 0xA7, 0x08, 0xAC, 0xCD, 0x31, 0x11, 0xCB, 0x02, 0xF9,
-    0x14, 0xCB, 0x02, 0xF2, 0xDA, 0x03, 0xA2, 0xD1, 0xFA, 0x7A, 0x5F, 0x16, 0x28, 0x45, 0x4F, 0xD2,
-    0x1E, 0x2F, 0x0B, 0x54, 0x96, 0xB4, 0xE8, 0xDD, 0xB2, 0xC0, 0xAF, 0xB6, 0xCB, 0x02, 0xD1, 0x3B,
-    0x9D, 0x5F, 0x19, 0xA7, 0xC9, 0x93, 0x21, 0x2C, 0x7E, 0xA9, 0x08, 0xD6, 0x2B, 0x48, 0x2A, 0x08,
-    0xD4, 0x64, 0x49, 0xDA, 0x7B, 0x68, 0xAE, 0xB7, 0xD0, 0x4A, 0x92, 0x9E, 0x28, 0xC3, 0xBB, 0x60,
-    0x15, 0x34, 0x5C, 0x10, 0x23, 0x97, 0xFB, 0xCE, 0x2A, 0xD2, 0x93, 0x70, 0xDB, 0x8F, 0xDE, 0xAB,
-    0x23, 0xE9, 0x7C, 0x51, 0x44, 0x0D, 0xB7, 0x4D, 0x55, 0x40, 0xC6, 0xC9, 0xF8, 0x64, 0x35, 0x98,
-    0xF4, 0x6E, 0x54, 0x13, 0xF0, 0xCF, 0x80, 0xF1, 0xB9, 0x9E, 0xE3, 0x94, 0x3B, 0x67, 0x1B, 0x96,
-    0xAC, 0xBB, 0xF3, 0x74, 0xF7, 0x9E, 0x4D, 0x58, 0x7A, 0x3B, 0x67, 0x54, 0x7A, 0x75, 0xD4, 0xC4,
-    0x75, 0xA4, 0xA5, 0x8A, 0x10, 0x47, 0x13, 0xE1, 0xB9, 0x3E, 0xE8, 0xF6, 0x88, 0xF8, 0x2F, 0x02,
-    0x3D, 0x2B, 0x38, 0x85, 0x89, 0x49, 0x47, 0x35, 0xFE, 0x6A, 0x15, 0x85, 0xD9, 0x60, 0xD2, 0x55,
-    0x4D, 0xB0, 0x5A, 0xBD, 0x1A, 0xDE, 0x6E, 0xE4, 0x54, 0xA1, 0x85, 0xC5, 0xC6, 0x1D, 0xFE, 0x59,
-    0x8F, 0xF8, 0x67, 0xFA, 0x9B, 0xF8, 0x27, 0x37, 0x84, 0xB4, 0xF1, 0x1E, 0xFE, 0xD9, 0xEC, 0xE1,
-    0x9F, 0xF4, 0x7F, 0x79, 0xDB, 0x07, 0x33, 0xCC, 0xEE, 0xB8, 0x7D, 0xB1, 0x77, 0x20, 0xEA, 0x1D,
-    0x2E, 0x3A, 0x67, 0x8F, 0x15, 0xA7, 0xE9, 0xB9, 0x28, 0x8E, 0x6D, 0x2E, 0xDA, 0xB2, 0xF0, 0x0D,
-    0x2F, 0x8E, 0x95, 0xFB, 0xCD, 0xA5, 0x22, 0x2B, 0x6E, 0xC9, 0x41, 0xE9, 0x95, 0x9B, 0x6D, 0xAF,
-    0x4C, 0xF3, 0x2C, 0x7A, 0x15, 0x51, 0x5D, 0xCE, 0x71, 0x2B, 0x9A, 0xD8, 0x2B, 0x5A, 0xB3, 0x57,
-    0x34, 0xD0, 0x50, 0x2B, 0xDA, 0xD0, 0x52, 0x04, 0xF0, 0x5E, 0x48, 0x37, 0x6D, 0x3B, 0xCA, 0x01,
-    0x87, 0x43, 0x1E, 0xE9, 0x8A, 0x48, 0xE7, 0x44, 0x3A, 0x0F, 0x74, 0x74, 0x4C, 0x5F, 0xCC, 0x77,
-    0x2E, 0x98, 0x3D, 0xB9, 0x82, 0x79, 0x92, 0x68, 0x1E, 0x9B, 0x3D, 0x7C, 0xBF, 0x30, 0x16, 0x7A,
-    0xAB, 0x99, 0x2A, 0xC7, 0xFF, 0x28, 0x7C, 0x2E, 0x58, 0x05, 0xF9, 0xFA, 0x47, 0x60, 0x03, 0x6C,
-    0x41, 0xE1, 0xDD, 0x01, 0x9E, 0x32, 0x74, 0x2B, 0xE0, 0x15, 0xF2, 0x42, 0xD6, 0x88, 0x1A, 0x64,
-    0x03, 0xCD, 0x4A, 0xB0, 0xAA, 0x52, 0x76, 0x6C, 0x10, 0x0E, 0x97, 0xA9, 0x99, 0x42, 0x93, 0x9F,
-    0x59, 0x2F, 0xD3, 0xD4, 0xDC, 0xAA, 0xD2, 0x59, 0x36, 0x27, 0xCC, 0x99, 0x2A, 0x9D, 0x32, 0x71,
-    0x85, 0x40, 0x24, 0xAE, 0xF2, 0x53, 0x1D, 0x18, 0xEE, 0xC9, 0x56, 0xAA, 0xFC, 0x0A, 0x8C, 0x04,
-    0x96, 0x29, 0x6D, 0xD8, 0xDD, 0x6D, 0xEF, 0x50, 0xA3, 0x5F, 0xA7, 0xC2, 0x7B, 0xE2, 0xD4, 0xA3,
-    0x6B, 0xD4, 0x03, 0x48, 0x2A, 0xE6, 0xFD, 0x3A, 0x80, 0x8E, 0x8D, 0x0F, 0x25, 0xA7, 0xB7, 0xA1,
-    0xE5, 0x54, 0x0D, 0xCD, 0x7A, 0x70, 0xED, 0xA1, 0x5A, 0x36, 0x69, 0x70, 0xF5, 0x81, 0x5A, 0x99,
-    0x94, 0xC1, 0xF5, 0x23, 0xAA, 0xF7, 0x9F, 0xDA, 0xBA, 0x00, 0xD6, 0x5E, 0xE2, 0x64, 0x18, 0xBF,
-    0xF7, 0xA9, 0xCE, 0xA3, 0xAB, 0xF7, 0x74, 0x6A, 0x1B, 0x40, 0xD4, 0xF9, 0x3E, 0x1D, 0x5A, 0xCD,
-    0xF7, 0xD8, 0xE0, 0x71, 0xC1, 0x07, 0x8F, 0x80, 0x11, 0xD9, 0xA1, 0x95, 0x27, 0xB5, 0xB4, 0x8D,
-    0x0A, 0x26, 0xD1, 0x3C, 0xC3, 0x34, 0x3A, 0xA9, 0x7D, 0x58, 0xC1, 0xFD, 0xC1, 0x49, 0xB6, 0x30,
-    0x08, 0xB0, 0x97, 0xCC, 0x52, 0x4C, 0x39, 0x72, 0xE7, 0xFD, 0xC6, 0xD0, 0x0A, 0xE1, 0x31, 0x0D,
-    0x48, 0x16, 0x76, 0x76, 0x99, 0x93, 0x4C, 0xA9, 0xAD, 0x62, 0xEF, 0x37, 0x7D, 0xA9, 0x82, 0x6A,
-    0xCC, 0x2C, 0x6A, 0x4D, 0x1C, 0x99, 0x2A, 0x85, 0xBF, 0xD9, 0xED, 0xDD, 0xB6, 0xF6, 0x2D, 0x6F,
-    0x18, 0xDB, 0xFF, 0xCE, 0x39, 0x5F, 0x0D, 0x5D, 0x08, 0x6D, 0xA6, 0x94, 0xBC, 0xA9, 0xF7, 0xEE,
-    0x0C, 0x9A, 0x63, 0x78, 0xD9, 0xE5, 0x15, 0x44, 0x8D, 0x41, 0x2E, 0xB2, 0x70, 0xB5, 0xF4, 0x14,
-    0x64, 0x85, 0x91, 0x7B, 0x36, 0x6D, 0x54, 0xDB, 0xEA, 0xEF, 0xBE, 0xBF, 0x5D, 0x82, 0x4E, 0x59,
-    0x2F, 0xD7, 0x3D, 0x6D, 0x66, 0x9C, 0xDB, 0xF6, 0x61, 0x0C, 0xC1, 0x3F, 0x5E, 0x62, 0xAF, 0xDE,
-    0x7D, 0xFB, 0x62, 0x18, 0xF1, 0x62, 0x58, 0x58, 0xD8, 0x6B, 0x42, 0xBB, 0x25, 0x42, 0x98, 0xFF,
-    0xB0, 0x70, 0xA8, 0xFB, 0x58, 0xCB, 0x26, 0xD5, 0x4C, 0xB7, 0x78, 0xCE, 0xB7, 0x2E, 0xAF, 0x30,
-    0x04, 0x4F, 0x1D, 0xB3, 0xFE, 0x6F, 0xC8, 0x38, 0xFB, 0x24, 0xCE, 0x5E, 0x8D, 0xE6, 0x4C, 0x28,
-    0xC2, 0x8C, 0x97, 0xCC, 0x75, 0xE8, 0xD5, 0xCC, 0xAC, 0x2C, 0x33, 0xD3, 0x73, 0x89, 0x11, 0x54,
-    0x4D, 0x32, 0x77, 0xC9, 0xEE, 0x65, 0x31, 0xE6, 0xE1, 0x3F, 0x53, 0xBC, 0x8E, 0x8B, 0xB4, 0xDB,
-    0xD7, 0xA6, 0xD6, 0x35, 0x06, 0xC5, 0x1C, 0xB7, 0xCC, 0x4A, 0x26, 0x7C, 0x93, 0x47, 0xD0, 0xFD,
-    0xEB, 0x6E, 0x31, 0xE3, 0x90, 0x0F, 0x37, 0xF8, 0x4C, 0x68, 0xAA, 0xC7, 0xFB, 0xFC, 0x92, 0xB5,
-    0x13, 0xFC, 0x1D, 0xEC, 0x18, 0x13, 0x03, 0x41, 0x2D, 0xB0, 0x7C, 0xB2, 0xF1, 0x3A, 0x3A, 0x66,
-    0x38, 0xCB, 0xD8, 0x0F, 0xE8, 0x6F, 0x4B, 0x6D, 0xE6, 0x04, 0xF9, 0xE8, 0xCC, 0x09, 0x05, 0x18,
-    0x10, 0x66, 0xA9, 0x11, 0xD4, 0xFD, 0xF6, 0x46, 0xC7, 0x69, 0x31, 0x6B, 0xB2, 0x1C, 0xEE, 0xCD,
-    0x34, 0x0B, 0x5C, 0x64, 0x2B, 0xCE, 0xCC, 0x8A, 0xDD, 0xA8, 0xA4, 0xE7, 0x66, 0xB4, 0x3C, 0x0A,
-    0x5B, 0x28, 0xFB, 0x7A, 0xA2, 0x5B, 0xAF, 0x08, 0x78, 0x70, 0x21, 0x4F, 0x57, 0xA2, 0x93, 0x7B,
-    0x77, 0x89, 0x39, 0xF9, 0x67, 0xDC, 0x41, 0xCA, 0x49, 0x61, 0xF8, 0x1B, 0xCD, 0x30, 0x03, 0x41,
-    0xA0, 0x67, 0xB0, 0x03, 0x6D, 0xDB, 0x1D, 0x3C, 0x1B, 0x0C, 0x92, 0x36, 0x66, 0x10, 0xC0, 0x06,
-    0x2A, 0x7C, 0x48, 0xBF, 0xDA, 0x30, 0xCA, 0xFA, 0x0A, 0x32, 0x44, 0xA7, 0x2A, 0x1C, 0xF1, 0x9A,
-    0x92, 0xD7, 0x60, 0xCF, 0xF3, 0xAC, 0x52, 0x8A, 0xE0, 0xD3, 0x3E, 0x01, 0x68, 0xF9, 0x5A, 0xF8,
-    0x40, 0x7F, 0x09, 0xE2, 0x90, 0x16, 0xB0, 0xC9, 0xCC, 0xEB, 0xC2, 0x16, 0x48, 0x12, 0x2A, 0xB3,
-    0xCA, 0xB4, 0xD6, 0x69, 0x9D, 0x32, 0x80, 0xC8, 0xAF, 0x51, 0xEA, 0xBB, 0x2D, 0xE5, 0x32, 0x96,
-    0x93, 0x78, 0x96, 0x2A, 0x31, 0xB1, 0xD4, 0x5B, 0x6A, 0x69, 0x67, 0x5C, 0xEF, 0xA6, 0x07, 0x77,
-    0x2C, 0x11, 0x4A, 0x07, 0x19, 0x5D, 0xE7, 0x1E, 0xDA, 0x35, 0x6D, 0x6A, 0x44, 0x4B, 0xB0, 0x8B,
-    0x2A, 0xED, 0x42, 0x6D, 0x13, 0xEE, 0xDA, 0x26, 0x00, 0xFB, 0xB6, 0x25, 0x8D, 0x77, 0xDA, 0x34,
-    0x79, 0xA6, 0x90, 0xFB, 0xCE, 0x1D, 0x38, 0x7B, 0xC8, 0x7A, 0x0E, 0xEE, 0x24, 0x88, 0x76, 0x77,
-    0x12, 0xC8, 0xAF, 0xB9, 0x93, 0x60, 0x87, 0x32, 0xC8, 0xB0, 0x40, 0x6C, 0x52, 0xB7, 0x4F, 0x94,
-    0xEB, 0xC6, 0x16, 0x3C, 0x16, 0xCD, 0x9B, 0x17, 0xE0, 0x6E, 0x01, 0x2C, 0xA9, 0x43, 0xEB, 0x4D,
-    0xC6, 0xC0, 0xA4, 0x58, 0xC6, 0x9E, 0xF6, 0x40, 0xDB, 0x6E, 0x92, 0xF9, 0xD5, 0x07, 0x3B, 0xD1,
-    0xF3, 0xB9, 0xA9, 0x9B, 0x16, 0x73, 0xE2, 0xD2, 0x5F, 0xCF, 0xC4, 0xCB, 0xC2, 0x2B, 0xE0, 0x54,
-    0xA1, 0x85, 0x81, 0xE3, 0x15, 0xA9, 0x46, 0x4C, 0xFB, 0x17, 0x0B, 0x56, 0xA2, 0xC0, 0xB4, 0x07,
-    0x3E, 0x40, 0x2C, 0x5A, 0x70, 0x4F, 0x0E, 0x08, 0x10, 0x3C, 0x7E, 0x36, 0xC6, 0x9D, 0x6D, 0x50,
-    0xC7, 0x73, 0xC1, 0x3D, 0x9B, 0xA3, 0x04, 0x09, 0x70, 0x7E, 0x26, 0xBE, 0xD2, 0xC7, 0xCF, 0x89,
-    0xB1, 0x3F, 0x3D, 0x6F, 0x43, 0x7F, 0x2C, 0x08, 0x56, 0xFD, 0xBE, 0xDB, 0x6D, 0xC2, 0x33, 0x67,
-    0x25, 0x77, 0xE0, 0xE8, 0x99, 0xE3, 0xE2, 0xAB, 0x56, 0x9E, 0xFC, 0xEB, 0xB5, 0x35, 0x54, 0xF0,
-    0x99, 0xA7, 0xDA, 0xE8, 0xB7, 0xB6, 0xB7, 0xD2, 0x96, 0x62, 0xA3, 0xAB, 0x2A, 0xFE, 0xB8, 0xFE,
-    0x6A, 0xA5, 0x31, 0xC9, 0x22, 0xFC, 0x3D, 0xA2, 0x16, 0x00, 0x0C, 0xC1, 0xFF, 0x1E, 0xE1, 0xBE,
-    0x93, 0xCD, 0x89, 0xDC, 0xD5, 0x71, 0x55, 0xE1, 0x1B, 0xED, 0xCD, 0x8F, 0xFF, 0x1D, 0x24, 0x9C,
-    0x14, 0xF2, 0x2E, 0xE3, 0xFF, 0x63, 0xDC, 0x7E, 0x08, 0xAA, 0x23, 0x86, 0x71, 0x99, 0x22, 0xAC,
-    0x81, 0xC8, 0xAC, 0xC1, 0x8A, 0xD9, 0x05, 0xB1, 0xB3, 0x85, 0x0A, 0x57, 0xE3, 0x8D, 0x14, 0x91,
-    0x7E, 0x58, 0xA7, 0x99, 0x0F, 0x32, 0xEC, 0x6B, 0x56, 0xF6, 0xED, 0x79, 0xE7, 0xA7, 0x88, 0x05,
-    0x02, 0x9D, 0x6E, 0xDA, 0x4A, 0x51, 0x1D, 0x8F, 0xB6, 0x4F, 0xD9, 0x9F, 0x26, 0xB0, 0x52, 0x64,
-    0xB7, 0x90, 0xC4, 0xDC, 0x42, 0xA2, 0x57, 0xC4, 0x4A, 0x6E, 0x3A, 0xA2, 0xD5, 0x61, 0x6E, 0x65,
-    0x96, 0xDB, 0x5B, 0x48, 0x9C, 0x06, 0xC4, 0x08, 0x27, 0x65, 0xF5, 0xF6, 0xFE, 0x10, 0xE1, 0x5B,
-    0xF8, 0xFE, 0x27, 0xA7, 0xEC, 0xCB, 0x48, 0x64, 0x61, 0x04, 0x27, 0xB3, 0x83, 0x4E, 0x9B, 0x3F,
-    0x1D, 0x46, 0xBE, 0xA5, 0x0D, 0x66, 0x32, 0xBC, 0xAC, 0x53, 0x9F, 0xF5, 0x39, 0xA2, 0xDD, 0xBE,
-    0x69, 0xD8, 0xE3, 0xEF, 0x30, 0x99, 0xAD, 0x10, 0x2D, 0x1E, 0x5A, 0xCA, 0x58, 0x16, 0x6C, 0x92,
-    0xF0, 0xC6, 0x9D, 0x0E, 0x21, 0xEA, 0xC1, 0x4D, 0xFB, 0x3B, 0x15, 0x69, 0xAB, 0x89, 0xC9, 0x9D,
-    0xC5, 0xE3, 0x4F, 0x08, 0xF5, 0x4D, 0xB7, 0xD3, 0x8B, 0x99, 0x0B, 0xA2, 0x77, 0x77, 0x7D, 0x45,
-    0x5E, 0x7C, 0xEB, 0x45, 0x5C, 0xCE, 0x34, 0xDC, 0x0C, 0x27, 0xDB, 0xFA, 0x99, 0x47, 0x7E, 0x6A,
-    0x24, 0x82, 0x1B, 0xFD, 0x66, 0xD2, 0xCC, 0xEC, 0x6E, 0x26, 0xED, 0xBE, 0xEC, 0x66, 0x52, 0x6E,
-    0x69, 0x82, 0xE5, 0x93, 0xB2, 0x21, 0x1E, 0x7B, 0x42, 0xF0, 0x40, 0x71, 0xD7, 0x4C, 0xFC, 0xAE,
-    0xF6, 0x6A, 0xD0, 0x32, 0xD0, 0xB3, 0xCA, 0x6B, 0x5A, 0x11, 0xDF, 0x2A, 0x98, 0xB3, 0x0A, 0x58,
-    0x5B, 0xE8, 0xF3, 0x30, 0x51, 0x69, 0xA7, 0x0D, 0xD8, 0x08, 0x57, 0x8E, 0xF8, 0x85, 0xF5, 0x72,
-    0x86, 0x53, 0xDC, 0xEB, 0x9A, 0x45, 0xE8, 0x3E, 0x50, 0x0E, 0xCB, 0xEC, 0x4F, 0xB3, 0x8B, 0x43,
-    0x62, 0x5F, 0x06, 0x6A, 0x0A, 0x9D, 0x16, 0x18, 0x7C, 0x87, 0x89, 0xF4, 0x61, 0x19, 0x1C, 0x06,
-    0xAB, 0xBB, 0xC2, 0x0E, 0x84, 0x23, 0xB1, 0x43, 0xE9, 0x59, 0xB6, 0x19, 0xFD, 0x74, 0x89, 0xDF,
-    0xB9, 0xDF, 0xB2, 0x8B, 0xBA, 0xFF, 0x31, 0x4F, 0xBF, 0x3F, 0x56, 0x26, 0x41, 0xE5, 0xD7, 0xF6,
-    0x37, 0x4B, 0x51, 0xB9, 0x7F, 0xC1, 0xB9, 0xF0, 0x4C, 0x9F, 0x96, 0x93, 0x7B, 0xF3, 0x97, 0x45,
-    0x2E, 0x46, 0x08, 0x6B, 0x0C, 0xB9, 0xDD, 0x09, 0xC4, 0x30, 0xBC, 0xCD, 0xCA, 0xC5, 0x2D, 0x7A,
-    0x51, 0x4B, 0x56, 0xB9, 0x10, 0x7A, 0xD7, 0x2B, 0xFA, 0xE4, 0xA9, 0xCD, 0x0F, 0x53, 0x0E, 0x0E,
-    0xD8, 0xEE, 0x70, 0xE0, 0x64, 0xF5, 0xE9, 0xD3, 0xC7, 0x57, 0xD0, 0x2B, 0x62, 0xF0, 0xEC, 0xFD,
-    0xAD, 0xCB, 0x8F, 0xED, 0x6F, 0x9D, 0x0C, 0x4F, 0xDD, 0xD3, 0x79, 0x7C, 0x8D, 0x98, 0xEC, 0x16,
-    0x17, 0x5F, 0x0E, 0xBC, 0xEC, 0xE2, 0x0F, 0xC3, 0x23, 0x97, 0xB1, 0x4C, 0x13, 0xF3, 0xA1, 0xF0,
-    0x13, 0xF1, 0x96, 0x08, 0x92, 0xAF, 0xF6, 0x53, 0x86, 0x92, 0x87, 0x67, 0x0F, 0x69, 0x4E, 0x9B,
-    0xDB, 0xA5, 0xA8, 0xC5, 0x84, 0x08, 0x13, 0xBC, 0x6E, 0xC4, 0x24, 0x54, 0x80, 0x11, 0x7D, 0x9F,
-    0x5D, 0x8B, 0xE5, 0x78, 0x9B, 0x0A, 0x58, 0x3A, 0xF5, 0x28, 0xA7, 0x7A, 0x4A, 0x16, 0xE1, 0xBB,
-    0xD9, 0xB4, 0x8A, 0x08, 0x17, 0x0C, 0x7B, 0x28, 0xBC, 0xA6, 0x7B, 0x14, 0xDD, 0x76, 0xFF, 0xDE,
-    0xE0, 0x56, 0xA7, 0xDF, 0xFF, 0x8A, 0x5B, 0x9D, 0xB8, 0xF3, 0x59, 0x48, 0x1A, 0x1B, 0xB7, 0x3E,
-    0x0B, 0x43, 0xF1, 0xB9, 0xF7, 0xD9, 0x65, 0xB1, 0xCA, 0x6E, 0x7E, 0xE6, 0x72, 0xB7, 0xBB, 0x9F,
-    0x6D, 0x72, 0xDE, 0x6E, 0x7F, 0x0E, 0xFB, 0xA2, 0x39, 0xA2, 0x99, 0x96, 0x58, 0xF0, 0x89, 0xF9,
-    0x6B, 0xCF, 0xB8, 0x20, 0xF5, 0xB5, 0x67, 0x36, 0x11, 0x20, 0xF1, 0xDD, 0xA0, 0x87, 0xA5, 0x49,
-    0xC6, 0xC3, 0x61, 0x12, 0xAC, 0x2A, 0x21, 0x97, 0x6D, 0xD1, 0x8C, 0x90, 0x41, 0x4F, 0xD4, 0xD8,
-    0xC2, 0x64, 0x9B, 0x8A, 0x78, 0xD5, 0x1C, 0xB5, 0xBF, 0x70, 0xF8, 0x2B, 0xDE, 0xF0, 0x7F, 0x85,
-    0x54, 0xBF, 0x6F, 0xDF, 0x44, 0x14, 0x7F, 0xB6, 0x4B, 0x8C, 0x72, 0x54, 0xD7, 0xA5, 0x08, 0x05,
-    0x21, 0x4B, 0x88, 0xA1, 0x54, 0xA2, 0x66, 0xCC, 0x92, 0xDC, 0xB5, 0x19, 0x22, 0xC1, 0x40, 0x07,
-    0xC2, 0xDF, 0x50, 0x75, 0x61, 0x61, 0xE8, 0x90, 0x6F, 0xED, 0x92, 0x01, 0x24, 0x86, 0x7E, 0xFF,
-    0x03, 0x32, 0x64, 0x88, 0xB2, 0x30, 0x20, 0xB6, 0x24, 0xF6, 0x37, 0x11, 0xCA, 0xC0, 0x80, 0x0B,
-    0x43, 0x91, 0x00, 0xD5, 0xA8, 0x0B, 0x12, 0x45, 0x1C, 0xC1, 0x83, 0xA5, 0x9C, 0xFD, 0xF8, 0x3C,
-    0x7F, 0x93, 0x26, 0x34, 0xAD, 0xB0, 0x7C, 0xCF, 0x77, 0xEF, 0x7C, 0xEF, 0x3E, 0xEF, 0xF3, 0x7E,
-    0x5C, 0x5E, 0xF9, 0x88, 0xF9, 0x88, 0xB9, 0xBC, 0x7C, 0x3A, 0x59, 0x59, 0xF9, 0x80, 0x99, 0x1F,
-    0x63, 0xB4, 0x44, 0x14, 0xE2, 0xFB, 0x08, 0x23, 0x63, 0xEE, 0xE8, 0xE4, 0x51, 0x50, 0x70, 0x27,
-    0x62, 0xD8, 0x63, 0x4F, 0xF4, 0x7F, 0x7B, 0x8B, 0xD1, 0xE3, 0x7A, 0xF1, 0x44, 0x54, 0x0B, 0x0B,
-    0xD1, 0x8F, 0xC7, 0x62, 0x14, 0x3D, 0xAC, 0x46, 0xA3, 0xF8, 0x61, 0x39, 0x5A, 0x8D, 0x0F, 0xCA,
-    0xD5, 0x63, 0x51, 0x02, 0xC6, 0xCA, 0xFB, 0x72, 0xBC, 0x80, 0x28, 0xCF, 0x1A, 0x1F, 0x34, 0xDF,
-    0x62, 0xFB, 0x43, 0x80, 0x5B, 0xEE, 0xB4, 0x4B, 0xAB, 0xAC, 0xE4, 0xA8, 0x27, 0xCA, 0x7E, 0xE3,
-    0x65, 0x9F, 0xD4, 0xBC, 0xE4, 0x53, 0x47, 0x54, 0xFC, 0xC0, 0xB1, 0x4F, 0x2B, 0x08, 0x53, 0x3F,
-    0xFB, 0x27, 0xA9, 0xCE, 0xB8, 0xEC, 0x01, 0x47, 0x5E, 0x94, 0x7C, 0x9D, 0x55, 0xAB, 0x1D, 0xF6,
-    0xD6, 0xC4, 0xC7, 0x80, 0xBF, 0xE8, 0x92, 0x26, 0x9B, 0xE0, 0x64, 0x52, 0x17, 0x6B, 0x38, 0x67,
-    0x26, 0xAC, 0x7C, 0x5A, 0x3F, 0x63, 0x53, 0xAC, 0xA4, 0x2F, 0xB0, 0x12, 0x60, 0xB3, 0xA4, 0x08,
-    0x30, 0xE0, 0xBF, 0x21, 0xD2, 0xA7, 0x8B, 0x2E, 0x66, 0xDE, 0x67, 0xFE, 0x9B, 0xCF, 0xED, 0x4C,
-    0x17, 0x30, 0x0C, 0xE2, 0x17, 0x89, 0x92, 0x9C, 0xE2, 0x9A, 0x82, 0xE9, 0x42, 0xE5, 0x44, 0xD8,
-    0x79, 0x8D, 0xC4, 0xB4, 0x3C, 0x73, 0x44, 0x71, 0x45, 0x61, 0x43, 0xB4, 0x43, 0x94, 0x5A, 0x52,
-    0xD3, 0xC5, 0x36, 0x38, 0xEA, 0xD5, 0x70, 0x43, 0x83, 0xC5, 0x7F, 0x6E, 0x98, 0x2D, 0x76, 0x70,
-    0xF7, 0x1A, 0xB3, 0x3B, 0x87, 0x2A, 0x41, 0xA4, 0xC1, 0xF2, 0xBB, 0x44, 0x17, 0x06, 0xEB, 0xE1,
-    0xD6, 0xD6, 0x3A, 0x49, 0xF0, 0x0C, 0xB3, 0x4D, 0x98, 0x2B, 0x1C, 0x6C, 0x91, 0x0B, 0x3D, 0x49,
-    0x38, 0xA0, 0x74, 0x1A, 0xBB, 0x50, 0xF2, 0x0D, 0x8C, 0x4A, 0x92, 0x05, 0xCA, 0x1E, 0x4A, 0x3E,
-    0xC0, 0x38, 0x1C, 0x02, 0x1F, 0xD4, 0xAA, 0x49, 0x7D, 0x71, 0xD8, 0xC7, 0x00, 0x3F, 0x7B, 0xCF,
-    0xA7, 0xFB, 0x9D, 0xA9, 0x4E, 0xBE, 0x73, 0xF4, 0x76, 0xB0, 0x61, 0xF2, 0x22, 0x6C, 0x4D, 0x0E,
-    0x06, 0x25, 0x30, 0x22, 0x96, 0xFD, 0xAB, 0x47, 0x12, 0xEE, 0x9B, 0x04, 0x26, 0x54, 0xAE, 0xCA,
-    0x8B, 0x63, 0x6D, 0x5F, 0x5F, 0x37, 0xF4, 0xC6, 0xFA, 0x88, 0x74, 0xE5, 0x49, 0x7D, 0x0A, 0x2F,
-    0xC1, 0x8B, 0x80, 0x17, 0x8A, 0xC4, 0x0F, 0xA1, 0x20, 0xF0, 0xB7, 0x6E, 0x45, 0xCD, 0x2F, 0x3F,
-    0xC5, 0xEE, 0xC9, 0xEF, 0xBA, 0x7C, 0xF2, 0x24, 0xCD, 0xEF, 0xDC, 0xB9, 0x3A, 0xF8, 0xA2, 0xBD,
-    0x6E, 0x75, 0xA3, 0x5D, 0xE2, 0xD2, 0xDA, 0x54, 0xA2, 0x31, 0x8E, 0x11, 0xA5, 0x3E, 0xEA, 0x44,
-    0x6D, 0xCA, 0x6C, 0xAF, 0x0F, 0x7B, 0x4C, 0x9B, 0x6C, 0x9A, 0x68, 0xF5, 0x3B, 0xB1, 0xDD, 0xD5,
-    0xFB, 0xCE, 0xA8, 0x07, 0x6D, 0xBA, 0x54, 0x7B, 0x7D, 0xC3, 0xAD, 0x4E, 0x49, 0x0F, 0x6A, 0x13,
-    0xB4, 0xAA, 0x5C, 0x1C, 0x28, 0xDA, 0xAB, 0x76, 0x4D, 0x74, 0xD8, 0xE8, 0xFB, 0xE5, 0xEA, 0xC2,
-    0x71, 0x7E, 0xC6, 0x61, 0x75, 0x25, 0x76, 0x3E, 0xB5, 0x5D, 0xFA, 0x99, 0x83, 0x85, 0xBB, 0x41,
-    0xB3, 0xA0, 0xA6, 0x46, 0xAF, 0x10, 0x75, 0x14, 0xB1, 0xD5, 0x7F, 0xD5, 0xD9, 0x81, 0x14, 0xC5,
-    0x4D, 0x65, 0x3B, 0x38, 0xA4, 0xEA, 0xA4, 0xD6, 0x4E, 0x97, 0x1A, 0xCC, 0x87, 0xA4, 0x6C, 0x9A,
-    0xA7, 0x79, 0x52, 0x9A, 0x25, 0x6F, 0x26, 0x6D, 0x94, 0xBF, 0x8C, 0x1F, 0x67, 0xAD, 0xDC, 0x3C,
-    0xD4, 0x51, 0x2A, 0xB6, 0x22, 0x89, 0x57, 0x63, 0x2A, 0xB6, 0x45, 0x49, 0xA6, 0x8A, 0x98, 0x74,
-    0x0B, 0x27, 0xF1, 0xA5, 0xAC, 0x86, 0x2A, 0xE4, 0xAF, 0x1A, 0x32, 0x1A, 0xD1, 0x78, 0xD8, 0x18,
-    0x2E, 0xFB, 0xEC, 0x3A, 0xBB, 0xE4, 0x8F, 0x56, 0x73, 0xC0, 0xB7, 0x97, 0xD8, 0xCF, 0x8D, 0x49,
-    0x32, 0x40, 0x22, 0x9B, 0x23, 0x59, 0x3E, 0xEE, 0x71, 0xA0, 0x46, 0xB2, 0x64, 0xB0, 0x50, 0x25,
-    0x4C, 0x09, 0xC7, 0x5C, 0x51, 0x71, 0x52, 0xD3, 0x33, 0x63, 0x91, 0xC5, 0x40, 0xA4, 0x13, 0xC9,
-    0xA7, 0x53, 0xAB, 0x68, 0x5B, 0x97, 0x5E, 0xDE, 0x89, 0x4F, 0x26, 0x3E, 0xDD, 0x6B, 0x93, 0x7C,
-    0x9E, 0xEC, 0x34, 0x85, 0x36, 0xCD, 0x41, 0x97, 0xFD, 0xDC, 0x73, 0x4D, 0x97, 0xE0, 0x04, 0x14,
-    0xD5, 0x49, 0x9A, 0x17, 0x75, 0x30, 0x24, 0x8E, 0x5B, 0x30, 0xBB, 0x17, 0xF4, 0xF7, 0x65, 0xFC,
-    0x8F, 0x0B, 0x7C, 0x47, 0x77, 0x0D, 0xA5, 0x5F, 0x96, 0x8A, 0xEB, 0x10, 0xF8, 0x0A, 0x47, 0xA8,
-    0x38, 0xD5, 0x50, 0x88, 0x9A, 0x2C, 0x2C, 0x2D, 0x9C, 0xE9, 0x31, 0x74, 0xD5, 0x0A, 0x02, 0x10,
-    0x11, 0x00, 0x4D, 0x51, 0x51, 0xDA, 0x90, 0x86, 0x1F, 0x5B, 0x96, 0x9E, 0x36, 0xB2, 0x6B, 0x41,
-    0xC3, 0x3C, 0xE1, 0x2E, 0x28, 0xC6, 0xF4, 0x12, 0xF8, 0x9B, 0xCF, 0xE9, 0x1A, 0x5B, 0xCA, 0x90,
-    0x3D, 0x59, 0x45, 0x31, 0x50, 0xBD, 0x72, 0x78, 0x89, 0xBE, 0x5E, 0xFB, 0xFC, 0xCD, 0xEF, 0x1E,
-    0x7D, 0x83, 0x13, 0x96, 0x97, 0x7B, 0x34, 0x9C, 0x3F, 0x17, 0x7F, 0xBD, 0x4F, 0x4A, 0x10, 0x0F,
-    0x4F, 0x34, 0xC5, 0x9C, 0xD8, 0xA1, 0x2E, 0xB7, 0x87, 0x8C, 0x93, 0x92, 0x19, 0x0D, 0xF9, 0x27,
-    0x05, 0x97, 0x4D, 0x67, 0xED, 0xB4, 0xA0, 0xEA, 0x21, 0x50, 0xC6, 0xD2, 0xCC, 0xFA, 0x53, 0xB0,
-    0x60, 0x30, 0xD8, 0xA0, 0xC1, 0xAD, 0x06, 0x15, 0x73, 0x8F, 0xB9, 0x2E, 0xAE, 0x77, 0xE8, 0x45,
-    0x37, 0xF2, 0xD8, 0xD5, 0x41, 0xFB, 0xFC, 0x36, 0xE0, 0x06, 0x4B, 0xE0, 0xDD, 0xE4, 0x94, 0x56,
-    0x94, 0x38, 0x32, 0x2D, 0x25, 0x1D, 0x29, 0x89, 0x97, 0x15, 0x46, 0x4C, 0x29, 0xF4, 0x48, 0x36,
-    0x4C, 0x17, 0xB8, 0x3C, 0x82, 0x31, 0xC4, 0xEB, 0x2D, 0x7A, 0xEE, 0xD3, 0x0D, 0xC8, 0xE4, 0x37,
-    0xE0, 0x96, 0x7E, 0x99, 0x8B, 0x59, 0xD5, 0x52, 0xB0, 0x45, 0x74, 0xDB, 0x9E, 0x09, 0xB8, 0x05,
-    0x5A, 0xBA, 0x18, 0x4B, 0x86, 0x34, 0xC0, 0x4A, 0x89, 0x40, 0x0D, 0x1A, 0x01, 0x27, 0x54, 0xB8,
-    0x70, 0x98, 0xA6, 0x32, 0x15, 0x5B, 0x85, 0xD8, 0x4D, 0x2B, 0x4C, 0xD3, 0x16, 0x7A, 0x40, 0x04,
-    0x7C, 0x01, 0x25, 0x00, 0xC9, 0x11, 0xF0, 0x86, 0xC7, 0x29, 0x53, 0xBF, 0x08, 0x59, 0x91, 0x03,
-    0x18, 0xB0, 0x00, 0x17, 0x97, 0x80, 0xA5, 0xBD, 0xA0, 0x1A, 0x5A, 0xFF, 0xDC, 0xE6, 0xF0, 0x93,
-    0x9D, 0x1D, 0xD3, 0x7C, 0x86, 0x0A, 0x42, 0x6B, 0x8B, 0x78, 0x5C, 0x04, 0x47, 0x56, 0x57, 0x23,
-    0x34, 0x48, 0x40, 0xCA, 0xD0, 0xFE, 0x92, 0xBD, 0x86, 0x54, 0xBD, 0x03, 0xEF, 0x8C, 0x8D, 0xBD,
-    0xAE, 0x52, 0x1F, 0x35, 0xDA, 0x53, 0x07, 0x86, 0x94, 0x45, 0x9E, 0x8C, 0x8D, 0x74, 0x0C, 0x04,
-    0x74, 0xC6, 0x3E, 0xBD, 0x38, 0xDC, 0x40, 0x6A, 0xF4, 0x31, 0xD0, 0x4E, 0xD0, 0xEB, 0x5C, 0x61,
-    0xB5, 0x97, 0x8A, 0x7A, 0x6F, 0xE3, 0x64, 0xBF, 0x3C, 0x6D, 0x34, 0x70, 0x77, 0x68, 0x36, 0x52,
-    0xFD, 0x23, 0xF4, 0xDF, 0x6D, 0x78, 0x8D, 0x43, 0xF7, 0x5A, 0xCA, 0xD0, 0x93, 0x8A, 0x7D, 0xF8,
-    0x27, 0x21, 0x54, 0xD2, 0x9B, 0xAA, 0xF3, 0xC7, 0x90, 0x28, 0xB4, 0x0B, 0x8A, 0x3A, 0x04, 0xC9,
-    0x47, 0x6D, 0xE8, 0x63, 0xC8, 0x99, 0x4D, 0xE1, 0x2F, 0x3E, 0x73, 0x2C, 0x29, 0xA7, 0x65, 0x8E,
-    0xB0, 0x0F, 0x37, 0x7D, 0x22, 0x9E, 0x63, 0xFC, 0x0B, 0x25, 0x90, 0x31, 0x4B, 0x1C, 0x41, 0x18,
-    0x86, 0xDF, 0xDD, 0x01, 0x17, 0x1C, 0xBD, 0xA9, 0x6C, 0x82, 0xBA, 0x7F, 0xE0, 0x74, 0x9B, 0x14,
-    0x01, 0xCD, 0xCD, 0x90, 0x2B, 0x2C, 0x12, 0x3C, 0x3B, 0x0B, 0x7F, 0x80, 0x4D, 0x8A, 0x14, 0x16,
-    0x06, 0x72, 0xD9, 0x91, 0x2B, 0x84, 0xA4, 0x88, 0x10, 0xC8, 0xAF, 0x48, 0x13, 0x39, 0xC4, 0xE2,
-    0xB8, 0x1D, 0xDC, 0xE2, 0xCA, 0x0C, 0xDA, 0x46, 0x18, 0x15, 0xD2, 0xA4, 0x19, 0x65, 0x8B, 0x05,
-    0xE7, 0x6E, 0x32, 0xAB, 0xC3, 0x07, 0xEF, 0xBC, 0xBC, 0xF3, 0x3D, 0x1F, 0xDF, 0x50, 0x79, 0x3A,
-    0xD8, 0x6D, 0xFD, 0xD9, 0xF8, 0x70, 0x5B, 0x7A, 0x52, 0x01, 0x10, 0x89, 0x78, 0x4D, 0x0E, 0xDA,
-    0xC6, 0xEB, 0x55, 0xBC, 0x8A, 0x84, 0x2F, 0x65, 0x4B, 0x70, 0x13, 0x5F, 0xF4, 0x98, 0xCB, 0x64,
-    0xB4, 0xC3, 0x2F, 0xD4, 0x62, 0xF0, 0xF7, 0x57, 0x93, 0xB7, 0x6E, 0x4E, 0x2C, 0xED, 0x78, 0x9D,
-    0x88, 0x36, 0x2C, 0x51, 0xEB, 0xA8, 0x89, 0x06, 0xB2, 0x37, 0x13, 0xBA, 0xCC, 0xCC, 0x59, 0x39,
-    0xF8, 0x36, 0x4D, 0x0D, 0x90, 0x77, 0x8F, 0x17, 0x16, 0x5F, 0x1E, 0x16, 0x66, 0xFF, 0xCB, 0x88,
-    0x87, 0x3C, 0x9C, 0x4E, 0x2E, 0xB9, 0xAF, 0xF8, 0xA3, 0xE3, 0x62, 0x94, 0xA3, 0xFF, 0x19, 0xFD,
-    0x1C, 0xE3, 0x50, 0x05, 0x66, 0x05, 0x7C, 0x28, 0x0F, 0x4F, 0xE5, 0x69, 0xF9, 0x7D, 0xFB, 0x7A,
-    0xE3, 0xE0, 0xE1, 0xCA, 0x93, 0x3A, 0x42, 0x84, 0x7E, 0x3C, 0x8C, 0xC2, 0xAC, 0x35, 0x0C, 0x99,
-    0xE3, 0x36, 0xD5, 0xFF, 0x54, 0x22, 0x56, 0x60, 0xD9, 0x91, 0x63, 0x33, 0x5E, 0xA5, 0xFA, 0x87,
-    0x22, 0xE2, 0x3D, 0x33, 0xF1, 0xA5, 0xEF, 0xD5, 0x61, 0xC8, 0x49, 0x22, 0x3B, 0xE4, 0x53, 0xDB,
-    0x7A, 0xCB, 0xB0, 0x09, 0xF8, 0x81, 0x60, 0x76, 0xC9, 0x76, 0x4B, 0x4F, 0x2D, 0x90, 0xD8, 0x8F,
-    0x5D, 0xC9, 0xAA, 0xCE, 0xD0, 0xDE, 0x4D, 0xBE, 0xBA, 0x39, 0x19, 0xF2, 0x9B, 0xBD, 0xE7, 0x35,
-    0x52, 0x9C, 0x37, 0x6B, 0x50, 0xF3, 0xEB, 0xB2, 0xDC, 0xFA, 0xC9, 0xEC, 0xFD, 0x5D, 0xF9, 0x7B,
-    0x36, 0x7F, 0x42, 0xF5, 0xDF, 0x92, 0xBC, 0x6B, 0x75, 0xEA, 0xCC, 0x90, 0x9E, 0x7B, 0x11, 0x3A,
-    0xC0, 0x14, 0xD5, 0x89, 0x25, 0x55, 0xE4, 0x30, 0x05, 0x47, 0x26, 0x99, 0x26, 0x36, 0x98, 0x3C,
-    0x5C, 0xA9, 0x89, 0x6B, 0x14, 0x48, 0x55, 0x62, 0x9B, 0x50, 0x52, 0x1B, 0x05, 0x51, 0x41, 0x3C,
-    0xB8, 0x4E, 0x1C, 0x0A, 0xD9, 0x00, 0xA2, 0x1A, 0x5C, 0x3C, 0x3D, 0x49, 0x55, 0xF8, 0xFC, 0x71,
-    0x23, 0x8D, 0xCB, 0xC4, 0x13, 0x60, 0xDC, 0x40, 0x4D, 0x08, 0x1A, 0x28, 0x57, 0x4C, 0x53, 0x4B,
-    0x5C, 0x3C, 0x0D, 0x0C, 0x2F, 0x72, 0x89, 0xFF, 0x95, 0x54, 0xBF, 0x6F, 0xDD, 0x54, 0x18, 0x3D,
-    0xB6, 0x95, 0x7A, 0xB0, 0xC4, 0x65, 0x69, 0x2B, 0x91, 0xC1, 0x8C, 0x50, 0x89, 0xDE, 0x7F, 0x20,
-    0xC9, 0xB5, 0x14, 0x04, 0x63, 0xDF, 0x90, 0xCE, 0xED, 0xC0, 0x80, 0x58, 0xFA, 0x0F, 0xA4, 0xD8,
-    0xB0, 0x32, 0x24, 0x43, 0x24, 0x46, 0x18, 0x60, 0x68, 0x8A, 0xD4, 0x85, 0x21, 0x43, 0x12, 0xBB,
-    0x74, 0xE8, 0xD0, 0x21, 0x96, 0x2A, 0x58, 0x18, 0x6A, 0xF4, 0xA8, 0x10, 0xCA, 0x10, 0x4B, 0xCF,
-    0x4F, 0x71, 0xF3, 0x6C, 0x7F, 0x9C, 0xCF, 0xAF, 0x0D, 0x74, 0xE4, 0xCA, 0xC7, 0xEF, 0xBE, 0xEB,
-    0xEF, 0x7E, 0x3F, 0xCE, 0x77, 0xEE, 0x05, 0x3E, 0x5A, 0x03, 0xD6, 0x89, 0xB5, 0x6D, 0x60, 0xFB,
-    0x00, 0x38, 0x68, 0xE0, 0x49, 0x87, 0x98, 0xC8, 0xA5, 0xF3, 0x44, 0xDA, 0x40, 0xA6, 0x55, 0x24,
-    0xD3, 0xD2, 0x9C, 0x3F, 0x2F, 0xCC, 0xEC, 0x69, 0x11, 0x9F, 0x3F, 0xCB, 0xAC, 0x62, 0xB1, 0x93,
-    0x58, 0xB9, 0x45, 0xD3, 0x3B, 0x9F, 0x1B, 0xDA, 0x45, 0x22, 0x5D, 0x40, 0x40, 0xE1, 0x08, 0x75,
-    0xF7, 0xDA, 0x25, 0x7E, 0xAE, 0x31, 0x0E, 0x2F, 0x6F, 0xDF, 0xF6, 0x9D, 0x20, 0xEA, 0x00, 0x43,
-    0x13, 0x43, 0x93, 0xB8, 0xDE, 0x38, 0xB0, 0xB5, 0x6B, 0x89, 0x8F, 0x6D, 0xB3, 0x81, 0x78, 0xF8,
-    0xF2, 0x2D, 0xDF, 0x9E, 0xFA, 0xB6, 0x84, 0x8E, 0x77, 0x81, 0xBC, 0x61, 0xA4, 0x2A, 0xAA, 0xD2,
-    0xE4, 0x10, 0xEA, 0x93, 0x76, 0xC5, 0xF5, 0xF9, 0x16, 0x1C, 0xB8, 0xDE, 0x73, 0x47, 0x09, 0x7E,
-    0x88, 0x0A, 0x78, 0x1D, 0xCB, 0x2A, 0xB8, 0x78, 0xC1, 0xC5, 0xD6, 0xE9, 0x07, 0x0E, 0xFA, 0x49,
-    0x8B, 0xA0, 0xE6, 0x27, 0xC4, 0x05, 0xC2, 0x01, 0x29, 0x60, 0x3B, 0xDA, 0x22, 0x6F, 0xC3, 0x1A,
-    0xBE, 0xD4, 0xB6, 0x40, 0x24, 0x65, 0x4E, 0x77, 0x67, 0xBF, 0x68, 0x65, 0x1C, 0xD3, 0xF1, 0x9D,
-    0x99, 0xA6, 0x1F, 0xB8, 0xFC, 0x5C, 0x5A, 0x6E, 0xFF, 0x54, 0x2A, 0x84, 0xBD, 0x61, 0x35, 0x71,
-    0x13, 0xF7, 0xDC, 0x5E, 0xBA, 0x86, 0xDB, 0xB3, 0x9C, 0x61, 0xBE, 0x78, 0x00, 0x4E, 0xB5, 0x50,
-    0x7D, 0xB9, 0x24, 0x67, 0x16, 0x22, 0xF5, 0xC3, 0xE1, 0xE1, 0x90, 0x99, 0x32, 0xAE, 0xF4, 0x6F,
-    0x32, 0x92, 0x36, 0xE6, 0x6B, 0xB4, 0xBA, 0xF4, 0x25, 0xA9, 0xA2, 0x7B, 0x84, 0x2D, 0x94, 0x15,
-    0x68, 0xA2, 0xEA, 0x86, 0x13, 0xE5, 0x0B, 0x1A, 0x84, 0x61, 0xD4, 0xC4, 0x9F, 0x1F, 0xEA, 0x6A,
-    0x46, 0xA6, 0x71, 0xD3, 0xAF, 0xF8, 0x3E, 0x08, 0x69, 0x1B, 0x54, 0x16, 0x51, 0x6B, 0x7E, 0x6B,
-    0x21, 0xB5, 0x93, 0x32, 0xC8, 0x12, 0x19, 0xF0, 0x0E, 0x63, 0xB0, 0x39, 0xBB, 0xE6, 0x8F, 0x16,
-    0xAE, 0x72, 0x9B, 0x35, 0x56, 0xAB, 0xDE, 0xB0, 0xC6, 0x27, 0x8D, 0xCB, 0xD6, 0x53, 0x53, 0x0A,
-    0xBF, 0xA7, 0x9B, 0x9D, 0x91, 0xF2, 0xF6, 0xCA, 0x24, 0x6A, 0x97, 0x4D, 0x43, 0x94, 0xE0, 0x26,
-    0xC9, 0x0A, 0x2A, 0x32, 0xB9, 0x41, 0x46, 0x83, 0x92, 0x11, 0xD6, 0x70, 0xDF, 0x84, 0x85, 0x72,
-    0xF1, 0x82, 0xE8, 0xAF, 0x9F, 0xF7, 0x7D, 0xE2, 0xDC, 0x49, 0xE6, 0x2F, 0xFA, 0x86, 0x3D, 0x12,
-    0xD2, 0x72, 0x56, 0x23, 0x7E, 0xC5, 0x9C, 0xE5, 0x56, 0xCD, 0xF6, 0x32, 0x59, 0x31, 0x15, 0x4C,
-    0x75, 0x84, 0x1F, 0x13, 0xCE, 0x25, 0x59, 0x11, 0xA9, 0xAC, 0x7C, 0xDB, 0xD8, 0x0E, 0x9D, 0x6D,
-    0xB1, 0x6D, 0xDB, 0x1F, 0x88, 0xEE, 0x0D, 0xD6, 0x5C, 0x7B, 0x08, 0xD7, 0x1E, 0x13, 0xE9, 0x6E,
-    0xDE, 0xD2, 0xE7, 0x67, 0x21, 0xFD, 0xE2, 0x1A, 0xFB, 0xE1, 0x67, 0x24, 0xA7, 0x20, 0x23, 0xC3,
-    0x08, 0xED, 0x71, 0x74, 0xAA, 0x0D, 0xCE, 0xD0, 0xE7, 0x19, 0x6A, 0x9B, 0x79, 0x55, 0xBC, 0x04,
-    0x4B, 0x63, 0xB0, 0x0C, 0x29, 0xB1, 0x7A, 0x9A, 0x69, 0x41, 0xA4, 0xBC, 0x50, 0x8C, 0xD5, 0x5D,
-    0x21, 0xEB, 0x4C, 0x26, 0x92, 0x1E, 0xEE, 0xE5, 0x5D, 0xAF, 0x67, 0xE2, 0x52, 0x68, 0xB3, 0x6E,
-    0xC8, 0xDF, 0xF0, 0xC9, 0x41, 0x74, 0x91, 0x69, 0x5C, 0xCB, 0x38, 0xFB, 0xE4, 0x3D, 0x20, 0x0C,
-    0x8D, 0xAD, 0xA8, 0xFA, 0x4A, 0xAC, 0xB2, 0x7D, 0x6C, 0xF3, 0xFE, 0xFE, 0x83, 0x5C, 0x64, 0x78,
-    0x03, 0xD6, 0x99, 0xD0, 0x2C, 0x1B, 0x91, 0x4B, 0x42, 0x31, 0x61, 0xC4, 0xCE, 0x62, 0xB9, 0x76,
-    0x4F, 0x32, 0x9F, 0xE2, 0x19, 0xD7, 0x48, 0xD4, 0xA8, 0x7F, 0xC5, 0x7B, 0xFB, 0x74, 0xA7, 0xC9,
-    0xA8, 0x1E, 0x2A, 0x5F, 0x09, 0x66, 0x62, 0x89, 0xE5, 0x61, 0xE3, 0x28, 0x83, 0x46, 0x35, 0xA1,
-    0x6B, 0x5A, 0x85, 0x66, 0xC2, 0xF0, 0x81, 0xCE, 0x3C, 0xD9, 0x53, 0x9D, 0x68, 0x81, 0xB1, 0xCA,
-    0x20, 0x54, 0xA1, 0x78, 0x32, 0x0A, 0x45, 0x2B, 0xB5, 0xCB, 0x33, 0x38, 0x21, 0x8C, 0x1A, 0xB5,
-    0xFF, 0x99, 0x90, 0x43, 0x66, 0x33, 0x1E, 0x4C, 0x29, 0x62, 0xB9, 0xF8, 0x29, 0x10, 0x43, 0xB1,
-    0x96, 0x0D, 0xBD, 0x70, 0x92, 0x66, 0x8D, 0x8A, 0x69, 0x0F, 0xF9, 0x57, 0x22, 0xCF, 0xDA, 0x58,
-    0xFA, 0xF4, 0xF1, 0x45, 0x3E, 0x1D, 0xE2, 0xCD, 0xC6, 0x0D, 0xF3, 0xDC, 0x53, 0x41, 0x93, 0x31,
-    0x49, 0x62, 0x4E, 0x48, 0xC8, 0x2E, 0x53, 0x50, 0x69, 0x6A, 0x44, 0xFB, 0x5A, 0x44, 0x58, 0xD9,
-    0xD2, 0xCC, 0x78, 0x52, 0x96, 0xE9, 0xE2, 0x7D, 0xAB, 0x59, 0xFA, 0xA3, 0xC8, 0x52, 0xAD, 0x43,
-    0x64, 0xA1, 0xAF, 0xE1, 0xF6, 0xE5, 0xB8, 0xF3, 0xEF, 0x22, 0xA9, 0xB9, 0x0B, 0x7F, 0xF8, 0x44,
-    0xC6, 0xBA, 0x79, 0xDC, 0x34, 0x5B, 0x86, 0xFA, 0x13, 0x97, 0x83, 0xE1, 0x28, 0x83, 0xBC, 0x32,
-    0x52, 0xC8, 0x22, 0x5C, 0x14, 0xF6, 0x3B, 0x1C, 0x6D, 0x07, 0xF3, 0x3A, 0xFA, 0xAB, 0xB0, 0x67,
-    0x09, 0xA5, 0x41, 0x05, 0xD8, 0x57, 0x60, 0x3D, 0x1F, 0x50, 0x0C, 0x22, 0x8F, 0x19, 0x61, 0xEB,
-    0x72, 0xB7, 0xD2, 0xFB, 0x35, 0xA1, 0x3A, 0x63, 0x7B, 0x9C, 0x9E, 0x21, 0x65, 0xF0, 0xFF, 0x4C,
-    0x78, 0xE9, 0xF0, 0xB9, 0x9A, 0x6F, 0xB1, 0xEA, 0xE5, 0xFC, 0x9A, 0xEC, 0x39, 0x81, 0xE3, 0xA1,
-    0xEB, 0xF1, 0xA1, 0xE6, 0x9E, 0xA8, 0xB1, 0x3E, 0x25, 0x4F, 0x20, 0x6E, 0x7C, 0x1F, 0x96, 0xF0,
-    0x79, 0xFB, 0x1D, 0xDF, 0x67, 0x02, 0xA4, 0xAF, 0x74, 0xC3, 0xC4, 0x0C, 0x47, 0xC1, 0x23, 0x61,
-    0xBF, 0x7F, 0x75, 0x43, 0x74, 0x32, 0x84, 0xB3, 0x9D, 0x6F, 0x9A, 0x80, 0x62, 0x63, 0xD5, 0x2E,
-    0x19, 0x73, 0x65, 0x09, 0x58, 0xE7, 0x6F, 0x33, 0xDE, 0x04, 0x3E, 0xC5, 0x60, 0xC6, 0xDE, 0x35,
-    0xC1, 0xE2, 0xB4, 0x32, 0x27, 0x3B, 0x85, 0xDB, 0x70, 0xE8, 0xDA, 0x2E, 0x98, 0x4D, 0xEB, 0xCB,
-    0xBF, 0x5D, 0x1B, 0xCC, 0x66, 0x95, 0xF9, 0xFD, 0x45, 0x86, 0x2B, 0xFB, 0x13, 0xBD, 0x2F, 0xCB,
-    0xE5, 0x9D, 0xD4, 0xF3, 0xC6, 0x33, 0x65, 0x54, 0xA2, 0xC7, 0x31, 0xF4, 0x4A, 0x22, 0xC1, 0x7A,
-    0x79, 0x8E, 0x67, 0xA4, 0x19, 0xEF, 0x74, 0xD5, 0xD6, 0xD5, 0x7B, 0xF3, 0x09, 0x59, 0x17, 0xE5,
-    0xAE, 0x5E, 0x0A, 0x4B, 0x25, 0xA5, 0x97, 0xD2, 0x3F, 0x7D, 0x53, 0x3D, 0x8F, 0xD3, 0x40, 0x14,
-    0x1C, 0xDB, 0x08, 0x73, 0x2C, 0xBA, 0xBD, 0x02, 0x51, 0xD0, 0x98, 0xE2, 0x2A, 0x10, 0xE7, 0x8A,
-    0xEE, 0xC8, 0x5A, 0x34, 0x48, 0x54, 0xFC, 0x03, 0xB7, 0xFC, 0x01, 0xBA, 0xE4, 0x6C, 0x89, 0x82,
-    0x12, 0xFE, 0x01, 0x29, 0xA8, 0x82, 0x04, 0x6D, 0x8A, 0x70, 0x5E, 0xDD, 0x15, 0x14, 0x34, 0x06,
-    0x8A, 0x6B, 0xDD, 0x21, 0xD1, 0xC4, 0x5C, 0x6C, 0x58, 0x81, 0x93, 0xC7, 0x38, 0x49, 0x81, 0x00,
-    0xB1, 0xF6, 0x68, 0x77, 0xBD, 0xEF, 0x63, 0x67, 0xDE, 0x33, 0x76, 0x00, 0xBC, 0x05, 0x54, 0x0D,
-    0x14, 0xDB, 0xE9, 0xCB, 0xE4, 0xA9, 0x88, 0x68, 0x91, 0x4E, 0x57, 0x80, 0x2E, 0x81, 0xA8, 0x87,
-    0x05, 0x0E, 0x68, 0xBC, 0x87, 0xCD, 0xF0, 0xB9, 0xD7, 0x34, 0x37, 0x1D, 0x20, 0x92, 0x84, 0x22,
-    0x65, 0xF4, 0xF9, 0xCC, 0xC5, 0xF7, 0x3F, 0x34, 0x3B, 0x61, 0xB9, 0x87, 0x90, 0x3E, 0x7F, 0xC2,
-    0xCF, 0x81, 0x80, 0xBE, 0xDD, 0x26, 0x53, 0xCC, 0x10, 0xC5, 0xE5, 0xC9, 0x2B, 0xC7, 0x74, 0x73,
-    0xA6, 0x03, 0xB2, 0xA4, 0xCF, 0x17, 0x38, 0x60, 0x45, 0x8F, 0x7C, 0x9D, 0xED, 0x5F, 0x81, 0x88,
-    0xDD, 0xB0, 0x1C, 0x9B, 0x77, 0x1F, 0x9D, 0xFE, 0x39, 0xAF, 0x7D, 0x11, 0x8B, 0x82, 0x2E, 0x91,
-    0xDB, 0x9C, 0x7B, 0x09, 0x70, 0xC3, 0xE7, 0xDE, 0xAF, 0x11, 0xE5, 0x03, 0xE8, 0x3C, 0xAC, 0xB4,
-    0xC5, 0x88, 0xA4, 0xE4, 0x13, 0xE1, 0x8E, 0xE0, 0x39, 0x1A, 0x76, 0xE4, 0xDE, 0x41, 0xDB, 0x21,
-    0x90, 0xEF, 0xAC, 0x69, 0xA9, 0x1C, 0xCA, 0x41, 0x8B, 0xD5, 0xA4, 0xFF, 0xFE, 0xC5, 0xC9, 0x49,
-    0x55, 0x62, 0xBA, 0x66, 0xCE, 0x93, 0x7B, 0x55, 0xD2, 0x4C, 0xA7, 0xF1, 0xEB, 0x63, 0x5F, 0x56,
-    0x88, 0x96, 0xF0, 0x96, 0xC0, 0x95, 0xB5, 0xDB, 0x2D, 0x71, 0x86, 0xEF, 0x8F, 0xE7, 0xA6, 0x81,
-    0x59, 0xE2, 0x6E, 0x91, 0x8C, 0xE2, 0x72, 0xA4, 0x9A, 0xA1, 0xBF, 0x7C, 0xD4, 0xEB, 0xBB, 0x7F,
-    0x81, 0xCC, 0x65, 0x95, 0x88, 0x54, 0xD7, 0xDE, 0x38, 0x28, 0xE1, 0x6B, 0xD5, 0xB7, 0x5A, 0x35,
-    0x33, 0xD5, 0xC4, 0xAA, 0x51, 0x27, 0x8D, 0x37, 0xDE, 0x07, 0x78, 0x09, 0x65, 0xE1, 0x77, 0x7E,
-    0x6D, 0xEC, 0x2C, 0x70, 0x06, 0xE6, 0x59, 0x1E, 0x7E, 0xAF, 0x90, 0x35, 0x50, 0xCB, 0x40, 0xC4,
-    0x23, 0xD3, 0x9B, 0x93, 0x31, 0xD9, 0x51, 0xC5, 0x2E, 0xE8, 0x3A, 0x55, 0xCF, 0x22, 0x3B, 0xCC,
-    0x92, 0xA3, 0x15, 0x8C, 0x83, 0xA9, 0x61, 0xA4, 0xE1, 0x4D, 0xAE, 0x4F, 0x5E, 0xAE, 0xEF, 0x75,
-    0x48, 0x1C, 0x53, 0x0F, 0x6A, 0x1B, 0x50, 0xF1, 0x9E, 0xBF, 0x21, 0x32, 0x4A, 0x1B, 0x71, 0x56,
-    0x84, 0xCF, 0xB3, 0x5E, 0x6E, 0x50, 0x04, 0x5C, 0xC5, 0xB6, 0xC4, 0x8F, 0xFB, 0x92, 0xA7, 0x09,
-    0xC2, 0x96, 0x34, 0x25, 0x6D, 0x90, 0xB5, 0x2C, 0xF0, 0x3C, 0xCD, 0x9E, 0xB8, 0xF6, 0xEB, 0x72,
-    0xA0, 0xD3, 0xD0, 0xE6, 0x6D, 0xBD, 0x07, 0x9D, 0xD2, 0xB8, 0xED, 0x43, 0xFF, 0xB5, 0xB8, 0xF8,
-    0x60, 0xDB, 0x2A, 0xB8, 0x4D, 0x18, 0x22, 0xCE, 0xFB, 0x7E, 0x2A, 0x44, 0x1A, 0x82, 0xDA, 0x79,
-    0x2B, 0xCE, 0x1D, 0xB1, 0x6D, 0x06, 0xC3, 0xB2, 0x0D, 0x68, 0x77, 0x09, 0xFF, 0x8B, 0xCB, 0x85,
-    0x67, 0xDB, 0x7A, 0x3F, 0xD3, 0xA9, 0x3A, 0xED, 0xDA, 0xF3, 0x4E, 0x4B, 0x5A, 0xC0, 0xB4, 0xEC,
-    0x01, 0x49, 0x6B, 0x04, 0x6D, 0xB7, 0x35, 0xBE, 0x63, 0xF1, 0xDB, 0xA8, 0x03, 0x96, 0xB6, 0x8A,
-    0x13, 0x64, 0x7C, 0x28, 0x46, 0x86, 0x5E, 0x09, 0x6A, 0x2A, 0x12, 0x55, 0x94, 0xBC, 0xD7, 0xA3,
-    0x8C, 0xFB, 0x7B, 0xC5, 0x96, 0x1F, 0x4C, 0xCE, 0xFF, 0x61, 0xE8, 0x31, 0xDF, 0xC3, 0xBE, 0x9B,
-    0x76, 0x29, 0x60, 0xDF, 0xE9, 0xF4, 0x2B, 0xCA, 0x78, 0x21, 0x67, 0x32, 0x90, 0x83, 0xC5, 0xA9,
-    0xD5, 0x54, 0x78, 0x61, 0xB1, 0x99, 0x7C, 0x39, 0x1C, 0x65, 0x8B, 0xF9, 0xB9, 0x18, 0x17, 0x30,
-    0x8E, 0xA6, 0xAA, 0x86, 0x94, 0xC7, 0xF8, 0x05, 0x8D, 0x93, 0xBF, 0x6E, 0xD4, 0x40, 0x10, 0xC6,
-    0x3F, 0xDB, 0x28, 0x96, 0x6E, 0x8B, 0xA5, 0x49, 0x75, 0x85, 0x1F, 0x61, 0x1B, 0x1A, 0x24, 0x60,
-    0x4D, 0x43, 0x7D, 0x05, 0x41, 0x88, 0x1A, 0x1A, 0x9A, 0xBC, 0x41, 0x6C, 0x89, 0x07, 0x20, 0x0F,
-    0x91, 0x22, 0x1C, 0x45, 0x78, 0x00, 0x0E, 0x1B, 0x1A, 0x5A, 0xC3, 0x0B, 0xC4, 0x22, 0x48, 0x89,
-    0xD2, 0xB0, 0x42, 0x46, 0x98, 0x68, 0xF7, 0x3E, 0x66, 0xCF, 0xE1, 0x24, 0xBA, 0xAC, 0x6E, 0xD6,
-    0xBE, 0xF1, 0xFC, 0xF9, 0xCD, 0xEC, 0x2C, 0x20, 0x6B, 0x05, 0xD8, 0x1E, 0x33, 0x0F, 0x18, 0x40,
-    0xB5, 0x48, 0xDC, 0xCE, 0xD1, 0x7B, 0xCD, 0x13, 0x4D, 0x7E, 0x1E, 0xEC, 0xB7, 0x31, 0x1F, 0x03,
-    0x82, 0x2D, 0xAD, 0x1A, 0xCC, 0x47, 0xB2, 0xB3, 0x74, 0x19, 0x1D, 0xE6, 0x87, 0xD1, 0x17, 0xB7,
-    0x80, 0xFD, 0x8B, 0xBC, 0x05, 0x79, 0x3E, 0x24, 0x24, 0x07, 0xB0, 0xB6, 0x03, 0x9A, 0x52, 0x79,
-    0xD8, 0x56, 0xB1, 0x2E, 0x3A, 0x45, 0xA7, 0x9C, 0xFA, 0xE9, 0x53, 0xAF, 0x5D, 0x85, 0x46, 0xBB,
-    0xA2, 0x35, 0xA7, 0xBD, 0x72, 0x39, 0xFB, 0xCC, 0x27, 0x1C, 0xE6, 0x84, 0x15, 0xCF, 0xBA, 0x90,
-    0xAD, 0x8B, 0x9B, 0x2B, 0x7E, 0xC8, 0x96, 0x77, 0xFB, 0x3C, 0xC4, 0x02, 0xFF, 0x96, 0x76, 0x40,
-    0x31, 0x0A, 0xAB, 0x80, 0x56, 0x01, 0x60, 0x83, 0x24, 0x54, 0x65, 0xE6, 0x6D, 0x9B, 0x8F, 0xA6,
-    0xD3, 0x4E, 0x02, 0xF7, 0xDA, 0xD9, 0x2E, 0x1F, 0xAB, 0x36, 0xF3, 0x4D, 0x9D, 0xAE, 0xF9, 0xFF,
-    0x3A, 0x25, 0xC3, 0xC9, 0x25, 0x6B, 0xAF, 0x3A, 0xDD, 0xAE, 0x70, 0x83, 0xC7, 0xF1, 0x6C, 0x53,
-    0xE5, 0xCD, 0x1D, 0xE4, 0x71, 0x9D, 0x68, 0xB9, 0x5C, 0xD6, 0xE4, 0x6F, 0xF9, 0x73, 0xB5, 0xD4,
-    0x3D, 0x8A, 0x6E, 0xF3, 0x6B, 0x61, 0x6A, 0xDC, 0x47, 0xDE, 0xA3, 0x41, 0xE1, 0x30, 0x19, 0x90,
-    0x7B, 0x7B, 0x8F, 0x25, 0xCD, 0x8C, 0xDE, 0x30, 0x58, 0xBE, 0x01, 0x76, 0xF7, 0x4A, 0x64, 0x8C,
-    0x95, 0xB2, 0x84, 0xEA, 0x22, 0x83, 0x48, 0x51, 0x03, 0xE9, 0x20, 0x2F, 0xB6, 0x04, 0x72, 0xE9,
-    0x87, 0x44, 0x91, 0xC6, 0xF4, 0x90, 0x4E, 0x00, 0xB7, 0x4D, 0x8B, 0xFC, 0x95, 0xD8, 0xD9, 0xA6,
-    0x46, 0x2A, 0x27, 0x01, 0xCD, 0x68, 0x22, 0x76, 0xD9, 0xFA, 0xBA, 0x89, 0x49, 0xF3, 0x30, 0xA4,
-    0xBC, 0x62, 0x2F, 0x94, 0xFE, 0x43, 0x1A, 0x74, 0x83, 0x7B, 0x29, 0x5B, 0x85, 0xCA, 0x65, 0xBF,
-    0xAA, 0x46, 0xB4, 0xAF, 0x45, 0x3E, 0x45, 0x8B, 0xF9, 0xF7, 0xA2, 0x9B, 0x0E, 0x18, 0x95, 0x64,
-    0xA8, 0x62, 0xE0, 0x47, 0x12, 0xB3, 0x45, 0xC4, 0x47, 0x3A, 0x4E, 0xA3, 0x03, 0x8B, 0x49, 0x99,
-    0x49, 0x9E, 0x24, 0x52, 0x1E, 0x88, 0x18, 0x01, 0xD4, 0xDD, 0xA4, 0x8C, 0xE8, 0xCF, 0x09, 0x99,
-    0x8E, 0x1A, 0x0D, 0x5B, 0xA1, 0xEA, 0xA7, 0x90, 0x71, 0x15, 0x5F, 0x82, 0x39, 0x5B, 0x5B, 0x37,
-    0xD1, 0x85, 0xE2, 0xEB, 0xDA, 0x9E, 0x45, 0x6A, 0xD3, 0xDF, 0xAD, 0xFC, 0x83, 0xD5, 0xC1, 0x41,
-    0x30, 0x01, 0xF9, 0xB0, 0xD5, 0x84, 0x2A, 0xAC, 0x0A, 0x8F, 0xE4, 0x7A, 0x2E, 0x92, 0x61, 0xCA,
-    0x21, 0x63, 0x0B, 0x5D, 0x47, 0x98, 0xD9, 0x5B, 0x3A, 0x19, 0xA7, 0xB1, 0x22, 0x2F, 0x36, 0x9F,
-    0x04, 0x43, 0x86, 0x2A, 0xEA, 0xFC, 0x4B, 0xAE, 0x8F, 0x23, 0x62, 0x26, 0x5E, 0xCA, 0x4D, 0xD8,
-    0xBB, 0xE5, 0x76, 0xC2, 0x76, 0x62, 0x69, 0xD2, 0x48, 0x25, 0x90, 0x8A, 0xD1, 0x6D, 0x92, 0x54,
-    0x04, 0x66, 0xF3, 0xC2, 0x3F, 0xD2, 0x50, 0x0A, 0xE0, 0x5C, 0xAE, 0x00, 0x76, 0x88, 0x17, 0xC0,
-    0x3B, 0xC5, 0xAB, 0x85, 0x1C, 0x25, 0x47, 0x3C, 0x89, 0xF5, 0x01, 0x4F, 0x37, 0xE1, 0xEE, 0x88,
-    0x64, 0xB1, 0x4B, 0x76, 0x8C, 0x8D, 0x0F, 0xF1, 0x2C, 0xD6, 0xDB, 0xCD, 0xC7, 0x18, 0x75, 0xD2,
-    0xD0, 0xE7, 0xF1, 0xD6, 0x34, 0x32, 0xEB, 0x2A, 0x9A, 0x1C, 0xC5, 0xDA, 0x9E, 0x91, 0x9B, 0xCB,
-    0x64, 0x78, 0xB9, 0x48, 0x63, 0xA9, 0x7F, 0x01,
+static const uint8_t opendyslexic_10_boldBitmaps[21273] = {
+    0xB5, 0x99, 0x3F, 0xAC, 0x1F, 0xC7, 0x75, 0xEF, 0x3F, 0xBB, 0x63, 0xDD, 0xC5, 0xD3, 0x06, 0x19,
+    0x23, 0x50, 0x1E, 0x02, 0x0A, 0xCE, 0xA6, 0x48, 0x91, 0xA7, 0x20, 0x9E, 0x14, 0x29, 0x52, 0x90,
+    0x77, 0x56, 0x76, 0x02, 0x02, 0x51, 0x41, 0x06, 0x90, 0x12, 0xA4, 0xD2, 0x2B, 0x52, 0x3C, 0xAB,
+    0x51, 0xE3, 0x22, 0x85, 0xC8, 0x5D, 0x8B, 0x0F, 0x50, 0xE1, 0xC2, 0x0C, 0x90, 0x54, 0x01, 0x22,
+    0x06, 0x60, 0x00, 0x91, 0x4A, 0x40, 0x17, 0x06, 0xA2, 0x82, 0xF7, 0xEE, 0x4A, 0x17, 0x88, 0x8B,
+    0x5B, 0x70, 0x29, 0x16, 0x2A, 0x0C, 0x3C, 0xAD, 0x4C, 0x22, 0x42, 0xA4, 0x82, 0x23, 0x69, 0x65,
+    0x0D, 0xA5, 0x99, 0xFD, 0xA6, 0xF8, 0xFD, 0x2E, 0x75, 0x25, 0xCB, 0x2F, 0x8C, 0x23, 0xED, 0x9E,
+    0xB3, 0xD8, 0x9D, 0xC5, 0x9C, 0x99, 0x33, 0x33, 0xE7, 0xCF, 0x77, 0x06, 0x1E, 0xE1, 0xBB, 0x45,
+    0xA8, 0x47, 0xC7, 0x75, 0x13, 0xEC, 0xE8, 0x49, 0x26, 0x34, 0x63, 0x47, 0xE2, 0x87, 0xB4, 0x6C,
+    0xAE, 0x67, 0x4C, 0xB6, 0xD1, 0xBF, 0xA5, 0x43, 0x01, 0xD8, 0xD4, 0xDD, 0xCE, 0xCD, 0xA2, 0x2A,
+    0xF9, 0x57, 0x65, 0x43, 0x77, 0x90, 0x9A, 0xA0, 0x2A, 0x51, 0x2C, 0xB6, 0x87, 0x7A, 0x3A, 0x0F,
+    0xB8, 0xC7, 0x23, 0x90, 0xEB, 0x19, 0x4C, 0x70, 0x2D, 0x5E, 0x92, 0x66, 0x49, 0xD2, 0x69, 0x49,
+    0x4A, 0xD4, 0xC1, 0x03, 0xEE, 0xD5, 0x04, 0xAC, 0x55, 0x00, 0x13, 0xDD, 0x88, 0x95, 0xA4, 0x30,
+    0x48, 0xD2, 0x05, 0x49, 0xCA, 0xD4, 0xC1, 0xB7, 0xE0, 0xC6, 0x0C, 0xA8, 0x5A, 0xC0, 0x24, 0x37,
+    0x72, 0xFC, 0xB2, 0x3D, 0x10, 0xB7, 0x2F, 0x8F, 0xEA, 0x0E, 0x56, 0xC2, 0x48, 0x33, 0xDD, 0x9B,
+    0xFF, 0x97, 0x3A, 0x44, 0x18, 0xCE, 0xB4, 0x54, 0xEB, 0x02, 0x5E, 0x77, 0x40, 0x5A, 0x28, 0x06,
+    0x05, 0x0A, 0xA9, 0xA7, 0x39, 0x93, 0xCA, 0xBF, 0x5E, 0xFC, 0x34, 0xE8, 0xE9, 0xD4, 0x6C, 0xDB,
+    0x9D, 0x76, 0x06, 0x5D, 0x84, 0x06, 0x28, 0x02, 0x9B, 0x17, 0xCE, 0x02, 0xF0, 0x10, 0x50, 0x84,
+    0xE2, 0x2C, 0xBB, 0xA8, 0xAF, 0xC7, 0xDF, 0xFB, 0xBD, 0x22, 0x9A, 0x71, 0xF6, 0x9C, 0xB4, 0xF5,
+    0x64, 0x6E, 0xCE, 0x09, 0x97, 0x1D, 0xE8, 0x85, 0x99, 0xE2, 0x6C, 0xEA, 0x5A, 0xDC, 0x8B, 0x7B,
+    0x98, 0xF7, 0xC7, 0x40, 0x3E, 0x69, 0x69, 0x0E, 0x6E, 0x06, 0xB3, 0xB8, 0x95, 0x7D, 0x34, 0x36,
+    0x63, 0x71, 0x96, 0xB3, 0x40, 0xB9, 0x42, 0x73, 0x77, 0xE2, 0x54, 0x11, 0x38, 0xC9, 0xC2, 0x29,
+    0x16, 0x7C, 0x19, 0x68, 0xEE, 0xCE, 0x54, 0x6A, 0xA9, 0x33, 0x38, 0xB5, 0xD1, 0x3F, 0x31, 0xA7,
+    0xAE, 0x58, 0x63, 0xD7, 0x77, 0xA1, 0xFB, 0x58, 0xB3, 0x97, 0xA2, 0x55, 0x0E, 0xA5, 0x2E, 0x82,
+    0x4D, 0xBA, 0xB1, 0xE8, 0xCC, 0xA2, 0x33, 0x0B, 0x60, 0xC7, 0x7A, 0xAA, 0x82, 0x59, 0x8A, 0x44,
+    0xC6, 0xE3, 0x7A, 0x3B, 0x99, 0x50, 0x24, 0x3A, 0x5C, 0x5F, 0xCF, 0x65, 0x64, 0xA0, 0x19, 0xAB,
+    0x40, 0xC6, 0xF7, 0x75, 0x28, 0x32, 0x7E, 0xAC, 0x43, 0x21, 0xFC, 0x54, 0x25, 0x86, 0x1E, 0xEC,
+    0x58, 0x44, 0x7C, 0x5B, 0x05, 0x32, 0xCD, 0x68, 0x16, 0xF6, 0x69, 0x46, 0x13, 0xC8, 0xB8, 0xB6,
+    0x9E, 0xCB, 0xC8, 0x3E, 0xAE, 0xB7, 0xB3, 0x59, 0x48, 0x74, 0xF8, 0xD1, 0x4E, 0x75, 0x30, 0xA9,
+    0xCC, 0x85, 0x50, 0xDB, 0xF5, 0x00, 0xD4, 0x3D, 0x66, 0x3E, 0x7B, 0x32, 0x46, 0xAF, 0x75, 0x47,
+    0x99, 0x66, 0xC5, 0x29, 0x3A, 0x0D, 0xE6, 0xF0, 0xC7, 0x94, 0x01, 0xFE, 0x12, 0xA0, 0x0C, 0xD4,
+    0x23, 0x0E, 0xAE, 0x1B, 0x49, 0xD2, 0x3B, 0xC3, 0x55, 0xAE, 0x6F, 0x4B, 0x4F, 0x00, 0xC3, 0xEB,
+    0xAA, 0x92, 0x9B, 0x54, 0x25, 0x3F, 0xFF, 0xFA, 0x53, 0x7F, 0x26, 0x7D, 0x22, 0x8D, 0x27, 0xEC,
+    0xED, 0x7B, 0xEA, 0xB6, 0xEB, 0xE0, 0x1B, 0x50, 0x8F, 0x90, 0xC0, 0xF6, 0x14, 0x0B, 0x78, 0x30,
+    0x01, 0xCE, 0x43, 0x3D, 0x41, 0x82, 0xA6, 0xA7, 0xFC, 0x4C, 0xB9, 0xDD, 0x96, 0x8F, 0x94, 0x11,
+    0x7C, 0x4B, 0x15, 0x60, 0xFF, 0x78, 0xB9, 0xF9, 0xB4, 0x7C, 0x00, 0x3B, 0x53, 0x24, 0x70, 0x23,
+    0x66, 0x86, 0x3F, 0x80, 0xAF, 0x01, 0x0C, 0x3D, 0xCA, 0x64, 0x3B, 0x9E, 0x2F, 0xA2, 0xFB, 0x23,
+    0x6F, 0x0F, 0x6F, 0x1C, 0x7C, 0xF0, 0x7E, 0x48, 0x29, 0x7B, 0xEF, 0xCF, 0xBC, 0xF1, 0x83, 0x5B,
+    0xB1, 0x0A, 0x3A, 0x9D, 0x9C, 0x64, 0xA4, 0x5E, 0x1A, 0xAD, 0x26, 0xBA, 0x1E, 0xFE, 0x09, 0x17,
+    0x0A, 0x8D, 0x95, 0x78, 0x24, 0x61, 0x02, 0x76, 0xC4, 0x43, 0xC2, 0x04, 0x9A, 0x91, 0x8E, 0xFF,
+    0xB9, 0x3E, 0x29, 0xDD, 0x96, 0x7E, 0xA0, 0x75, 0x47, 0x6D, 0xAD, 0x64, 0xA4, 0x71, 0xA9, 0x96,
+    0xAF, 0xB3, 0x0F, 0xAE, 0xC7, 0x4E, 0xD4, 0x81, 0x3A, 0x62, 0x13, 0x4D, 0xC6, 0xAD, 0x34, 0xBA,
+    0x52, 0x4B, 0x07, 0x52, 0x90, 0x12, 0x4F, 0x61, 0x14, 0x0B, 0xA9, 0xBF, 0x5C, 0x2E, 0xB0, 0x0B,
+    0xB6, 0xA7, 0x9E, 0x2A, 0xCD, 0xA5, 0x16, 0xAE, 0xA9, 0xC5, 0x06, 0x8A, 0xF4, 0xAB, 0x7F, 0xAC,
+    0x4A, 0x7A, 0x4D, 0x9A, 0xA5, 0xF0, 0xA8, 0x2E, 0x42, 0xB1, 0x40, 0x86, 0xA1, 0xA5, 0x9B, 0xD8,
+    0x5D, 0xD8, 0x3D, 0x8F, 0x6B, 0xFA, 0xE6, 0xF4, 0x6C, 0x9F, 0x8F, 0x56, 0xBA, 0x2D, 0x45, 0x69,
+    0xC5, 0x64, 0x10, 0xF8, 0x11, 0x1B, 0x00, 0x4E, 0x5C, 0xBD, 0xEC, 0x94, 0x9C, 0x92, 0x83, 0x0D,
+    0xF9, 0x7F, 0x6F, 0xBD, 0x66, 0xAF, 0xF4, 0xF5, 0x22, 0xC3, 0x0A, 0xFA, 0xCD, 0x3F, 0x5F, 0x9D,
+    0xB2, 0x57, 0xF2, 0x0A, 0xF5, 0xDA, 0xE2, 0x32, 0x83, 0xDA, 0x41, 0x93, 0x07, 0xD7, 0x62, 0xFF,
+    0xF5, 0xA2, 0x91, 0x5A, 0x69, 0xF1, 0x93, 0xEC, 0x6C, 0x0F, 0x16, 0xB3, 0xAC, 0x64, 0x7F, 0x53,
+    0x95, 0xD4, 0x0F, 0x1A, 0x77, 0xD4, 0x3E, 0x76, 0xF5, 0x1F, 0xBD, 0x56, 0xAF, 0x0C, 0x19, 0x12,
+    0x45, 0xC2, 0x24, 0x4C, 0xA4, 0x8A, 0xD4, 0x0B, 0x36, 0x60, 0x03, 0x2E, 0xE0, 0x67, 0xFC, 0x4C,
+    0x37, 0x31, 0x4C, 0x48, 0xE4, 0x66, 0x3E, 0x4F, 0x6A, 0x7A, 0x5F, 0x05, 0x37, 0x4A, 0x53, 0xA5,
+    0xA9, 0x52, 0xAE, 0x17, 0x77, 0xB0, 0x98, 0x98, 0xD8, 0xF7, 0xD3, 0xF0, 0x03, 0xE9, 0xA6, 0x14,
+    0x1A, 0xCD, 0xFC, 0x45, 0x0B, 0x0F, 0xC1, 0x10, 0x91, 0xFA, 0xBD, 0x6A, 0xD9, 0x65, 0xD7, 0x62,
+    0x0F, 0xC6, 0x32, 0x2C, 0x64, 0xDF, 0x0E, 0xA7, 0xA5, 0x69, 0xD0, 0xB2, 0xA3, 0x04, 0x7E, 0xE7,
+    0xAC, 0x7B, 0x4D, 0x9A, 0xA4, 0xD9, 0x69, 0x02, 0xF0, 0x17, 0x92, 0xFF, 0x71, 0x1A, 0x26, 0x00,
+    0x4C, 0xF4, 0x07, 0xA9, 0x3B, 0xCC, 0x76, 0xF6, 0xDF, 0x53, 0x9D, 0x5C, 0xD8, 0xFA, 0xAB, 0x5F,
+    0xFF, 0x53, 0x5D, 0x48, 0x36, 0x0C, 0x17, 0xB2, 0x0D, 0xCF, 0xF4, 0xDB, 0xC2, 0xAA, 0x07, 0x37,
+    0x53, 0x0C, 0x91, 0x4A, 0x33, 0x4E, 0x3D, 0xC3, 0x0A, 0x3E, 0x82, 0xD5, 0x1D, 0x2A, 0xE9, 0x0E,
+    0x3B, 0x52, 0x60, 0x47, 0x19, 0x4A, 0xB5, 0x50, 0x5C, 0x7C, 0xE8, 0x99, 0x97, 0x1A, 0x25, 0xAF,
+    0xF5, 0x11, 0x00, 0x1E, 0x56, 0x72, 0xCA, 0x5E, 0x57, 0x00, 0xFE, 0x10, 0xF0, 0x13, 0xF8, 0x0C,
+    0x95, 0x66, 0xE8, 0xD6, 0x96, 0x4A, 0x0B, 0x74, 0x91, 0x1D, 0xC5, 0x1D, 0x29, 0x0D, 0x5A, 0x5B,
+    0xA9, 0x45, 0x17, 0xE1, 0xCE, 0xB6, 0x23, 0xC5, 0x65, 0x8C, 0x96, 0x42, 0x9A, 0xFC, 0x34, 0x30,
+    0x95, 0x11, 0x9A, 0xAD, 0x71, 0x8D, 0x14, 0x1B, 0xA3, 0x68, 0x02, 0x4D, 0xC6, 0xA8, 0xC5, 0x8F,
+    0x98, 0x04, 0x7E, 0x63, 0x2F, 0xBF, 0xFD, 0x19, 0xBF, 0xEC, 0xA1, 0x5A, 0xA0, 0x6B, 0xA9, 0x23,
+    0x3C, 0x73, 0x14, 0x4C, 0x70, 0x77, 0xA0, 0x94, 0xC0, 0xCE, 0xCD, 0xC8, 0x2E, 0xE5, 0x4C, 0x82,
+    0x50, 0x84, 0xDD, 0xE9, 0xAF, 0xCC, 0xFC, 0xD1, 0x7C, 0xD2, 0x4C, 0xE3, 0x7C, 0xB2, 0xBA, 0x39,
+    0xCE, 0x27, 0xAB, 0x9B, 0xAF, 0x86, 0x1F, 0x55, 0x41, 0xEF, 0x05, 0xB3, 0x74, 0x9A, 0x4C, 0xE2,
+    0x9B, 0x14, 0xEA, 0x77, 0x60, 0x90, 0xA0, 0x91, 0x5A, 0x4A, 0xA9, 0x87, 0x9D, 0xBF, 0x81, 0x32,
+    0x01, 0x7E, 0x84, 0x6A, 0x05, 0x86, 0x00, 0x56, 0x2D, 0xC5, 0xBD, 0x08, 0xFE, 0xCC, 0x48, 0x15,
+    0x56, 0x18, 0xAA, 0x80, 0x9D, 0x7C, 0x5B, 0x24, 0x13, 0xF1, 0xD2, 0x68, 0xA4, 0xCC, 0x20, 0x05,
+    0x2B, 0xA9, 0x58, 0xA9, 0xA2, 0x9F, 0xE8, 0x0E, 0x12, 0x26, 0x0F, 0xBA, 0x58, 0x4B, 0xFD, 0xF0,
+    0x72, 0xAE, 0x43, 0x15, 0x06, 0x7C, 0x1D, 0x4C, 0x18, 0x18, 0x6A, 0x69, 0x1C, 0x94, 0x6B, 0x69,
+    0x19, 0xE8, 0x0E, 0x43, 0x91, 0x07, 0x9A, 0x77, 0x3F, 0x7E, 0x39, 0x0F, 0xD2, 0x4F, 0xA4, 0x34,
+    0x48, 0x4F, 0x48, 0x9B, 0x99, 0x2D, 0x86, 0x48, 0xA3, 0xC4, 0xA0, 0x54, 0x4A, 0xD1, 0xA8, 0xA5,
+    0x4E, 0x60, 0x17, 0x68, 0xC2, 0x86, 0xDD, 0x11, 0x2F, 0xD0, 0xAC, 0xED, 0xFF, 0xB1, 0x52, 0xAC,
+    0xA5, 0x64, 0xA4, 0x54, 0x48, 0x09, 0xA7, 0x34, 0xE8, 0x0E, 0x83, 0xD4, 0x0E, 0xD2, 0x34, 0x5C,
+    0x55, 0x18, 0xB0, 0x71, 0xC0, 0xA4, 0x01, 0xF2, 0xCF, 0x73, 0x99, 0x07, 0x9E, 0x4D, 0xC3, 0xA6,
+    0x2B, 0x71, 0xD8, 0x44, 0xD4, 0x71, 0xD0, 0x3D, 0x1E, 0x1B, 0x74, 0x46, 0x3A, 0x90, 0xE6, 0x0C,
+    0xBE, 0xC5, 0x4E, 0x98, 0x85, 0x42, 0x1A, 0x3B, 0x85, 0x46, 0xA9, 0xBA, 0x47, 0x91, 0xA1, 0x6B,
+    0x69, 0xDE, 0xB9, 0xFA, 0x84, 0xF4, 0xFE, 0x46, 0xC6, 0xB3, 0xD2, 0x7C, 0x42, 0x79, 0x6B, 0xC1,
+    0x3D, 0xBE, 0xC5, 0xB7, 0x78, 0x85, 0x2D, 0x5D, 0xBD, 0xE4, 0x5B, 0xBA, 0x63, 0x34, 0xF4, 0x5B,
+    0xA2, 0x78, 0x0A, 0xAA, 0xCD, 0x38, 0x27, 0x24, 0x8D, 0x2E, 0xF3, 0x1B, 0x66, 0x05, 0xBA, 0x11,
+    0xAA, 0x08, 0x74, 0x3D, 0xD4, 0xB1, 0xF8, 0xF7, 0x76, 0xE8, 0x1B, 0x1D, 0x46, 0x94, 0xBB, 0xF1,
+    0xA1, 0xE1, 0xF6, 0x8A, 0x59, 0xFC, 0xFA, 0x94, 0x0A, 0x49, 0xA1, 0x96, 0xD4, 0x3A, 0x69, 0xE6,
+    0x51, 0x5D, 0xC4, 0xB7, 0x26, 0xDD, 0xE7, 0xDE, 0xA4, 0xEE, 0x8B, 0x78, 0x34, 0xA9, 0x93, 0x8E,
+    0x38, 0x0F, 0x52, 0x1E, 0xDE, 0x79, 0x39, 0x0F, 0x63, 0x75, 0x9F, 0xBB, 0xA7, 0xDF, 0xF8, 0x30,
+    0x79, 0x7B, 0x10, 0x92, 0xB7, 0xB7, 0x96, 0xEC, 0x9F, 0x7E, 0xFB, 0xDE, 0x3A, 0xDC, 0x0D, 0x9B,
+    0x01, 0x98, 0xA8, 0x17, 0xCA, 0x74, 0xCC, 0xD7, 0x99, 0x08, 0x2B, 0xF8, 0x9E, 0x66, 0xA2, 0xDA,
+    0xFC, 0x1C, 0xC0, 0x6D, 0x7E, 0xA6, 0xFF, 0x51, 0xAE, 0x1B, 0x27, 0x36, 0x76, 0x9A, 0x9A, 0x8D,
+    0x47, 0xB0, 0x73, 0x37, 0xDA, 0x59, 0xAD, 0xBD, 0x29, 0xEC, 0xAD, 0x84, 0x3D, 0x8C, 0x34, 0x6F,
+    0x06, 0x9A, 0xBB, 0x13, 0x4E, 0x23, 0x4E, 0xE0, 0xD6, 0x8D, 0x99, 0x7A, 0xB5, 0x78, 0x4D, 0x78,
+    0x45, 0xBA, 0x17, 0x57, 0xBA, 0xEF, 0xAB, 0xEF, 0x2E, 0x28, 0x0C, 0xBD, 0x92, 0xEB, 0xA9, 0xE7,
+    0x63, 0x1D, 0xB0, 0x9F, 0xFF, 0x58, 0xEE, 0x4F, 0xDC, 0x44, 0x25, 0xFD, 0x6C, 0xA3, 0xF1, 0xB3,
+    0xD2, 0xE4, 0x67, 0xFC, 0x81, 0xA8, 0x93, 0x5F, 0xD0, 0x81, 0xFA, 0x26, 0xFB, 0x64, 0x74, 0x4B,
+    0xB3, 0xCF, 0x5E, 0xB5, 0xDE, 0xD0, 0xA2, 0xDC, 0x0D, 0x2F, 0xDE, 0x7D, 0xE3, 0x23, 0xE5, 0xB5,
+    0x7B, 0x56, 0x6F, 0xBE, 0xFD, 0xA1, 0xEE, 0xAD, 0xDD, 0x19, 0xB9, 0xB7, 0xE3, 0xF0, 0xFE, 0x3A,
+    0xBC, 0xB0, 0xFA, 0x77, 0xA3, 0xBF, 0xA5, 0xE1, 0xB5, 0xE4, 0x3F, 0x49, 0x18, 0x01, 0xA9, 0x09,
+    0xA4, 0x66, 0x29, 0x52, 0x13, 0x8B, 0xE4, 0x52, 0x91, 0xDC, 0x5A, 0x26, 0xA7, 0x32, 0x79, 0x3D,
+    0x9F, 0xFC, 0xDD, 0xD7, 0x92, 0xBF, 0x71, 0x3B, 0xFA, 0xC3, 0x0F, 0xA2, 0xBF, 0xF5, 0x51, 0xF4,
+    0xAF, 0x2B, 0x76, 0x37, 0xB5, 0x74, 0x93, 0x96, 0x6E, 0xEA, 0x96, 0x61, 0xF2, 0xCB, 0x30, 0xBB,
+    0x85, 0x47, 0x57, 0xB0, 0x5A, 0xA9, 0xA4, 0x84, 0xFA, 0x6E, 0x76, 0x13, 0xFA, 0x76, 0xA2, 0x8A,
+    0x5D, 0x8B, 0x3F, 0x0C, 0x94, 0x69, 0x80, 0xE6, 0x30, 0x50, 0xA4, 0x01, 0xDC, 0x61, 0xC4, 0xA4,
+    0xEE, 0xC3, 0x1D, 0x1D, 0x48, 0x8A, 0x4E, 0x52, 0x2B, 0x29, 0x18, 0x29, 0xB1, 0xA3, 0x7B, 0x1B,
+    0xF7, 0x72, 0xE2, 0x4A, 0x5B, 0x2B, 0x97, 0xD2, 0x94, 0x8B, 0xE4, 0x5B, 0x77, 0x66, 0xAA, 0x6F,
+    0x2F, 0x55, 0x94, 0xB2, 0x97, 0xAC, 0xF4, 0x6D, 0xA9, 0xD0, 0xDF, 0xD0, 0xF5, 0x34, 0x33, 0x55,
+    0xA2, 0x10, 0x0C, 0x23, 0xF7, 0xDD, 0x33, 0xDD, 0x02, 0x8D, 0x32, 0x85, 0x94, 0x69, 0x96, 0x3A,
+    0xA1, 0xB6, 0x8A, 0x55, 0xC4, 0x06, 0x37, 0xD2, 0x4C, 0x02, 0xFF, 0xED, 0x04, 0xAB, 0x0D, 0x98,
+    0xE8, 0x47, 0xEC, 0x34, 0x70, 0xA9, 0x7B, 0x5C, 0x46, 0xC9, 0x48, 0x9A, 0x6B, 0x49, 0x58, 0x29,
+    0x62, 0xA5, 0x89, 0x1D, 0x69, 0x82, 0x7A, 0xF3, 0x18, 0xE1, 0xE1, 0xAB, 0xBD, 0x53, 0x5F, 0x4A,
+    0xBD, 0x7B, 0x2A, 0x95, 0xC1, 0xCC, 0x1E, 0x6F, 0x82, 0x09, 0x1E, 0x6F, 0x3E, 0x7C, 0x7A, 0xF6,
+    0x4A, 0x46, 0x6A, 0xBD, 0x92, 0xC9, 0xCD, 0xDC, 0x8D, 0x43, 0x95, 0xEA, 0xA5, 0x1B, 0x87, 0x17,
+    0x52, 0x9D, 0x86, 0x71, 0x78, 0x23, 0xD5, 0x2B, 0xBF, 0xBB, 0xF6, 0xC5, 0xC6, 0xA6, 0xDA, 0x3A,
+    0xEE, 0x60, 0x67, 0x36, 0xBC, 0x40, 0xAD, 0x8B, 0x18, 0xA9, 0x45, 0x0A, 0xD4, 0x4A, 0xD0, 0xAC,
+    0x50, 0xAE, 0xD5, 0xC5, 0x52, 0x76, 0xFD, 0xBB, 0xD5, 0x6F, 0xCC, 0x21, 0xEC, 0xE8, 0xE3, 0x4D,
+    0x6E, 0x7F, 0xF5, 0xEA, 0x95, 0x41, 0x5A, 0x8F, 0x18, 0x1B, 0xF8, 0x65, 0x78, 0x18, 0xAB, 0x74,
+    0x9C, 0xBB, 0xFE, 0xF3, 0x6C, 0x52, 0xD7, 0x9B, 0xB8, 0xE1, 0x2A, 0xFA, 0xB1, 0x8E, 0x5E, 0x5A,
+    0xBC, 0xB4, 0xB8, 0x8D, 0xFB, 0x9D, 0x4A, 0xA9, 0x05, 0xE8, 0xC0, 0x1D, 0xC4, 0xCD, 0xE0, 0x76,
+    0xDF, 0xCA, 0xD8, 0xD0, 0xCC, 0x85, 0x10, 0x6E, 0xAA, 0xA3, 0x49, 0x74, 0xE3, 0x30, 0x9A, 0x6C,
+    0x17, 0xDC, 0x5B, 0xA2, 0x90, 0x0F, 0x58, 0xAD, 0x20, 0x8D, 0x54, 0x4A, 0xE0, 0xD5, 0x63, 0x14,
+    0xC0, 0x09, 0xD0, 0xCC, 0x33, 0x2D, 0x94, 0x2F, 0x75, 0x23, 0x98, 0xE4, 0x47, 0xA8, 0x92, 0x9F,
+    0xA0, 0x8E, 0x7E, 0x06, 0xBB, 0xB8, 0x50, 0x4F, 0x36, 0x34, 0xC1, 0x86, 0x26, 0xD8, 0xC5, 0x2D,
+    0x6E, 0xB6, 0x8B, 0x4F, 0x7E, 0xAA, 0xE3, 0x90, 0xFD, 0x58, 0x25, 0xA9, 0x1B, 0x2B, 0x49, 0x43,
+    0x6F, 0xB4, 0x0E, 0x6A, 0x8D, 0x92, 0x17, 0xA5, 0x92, 0x17, 0x85, 0x96, 0x66, 0x05, 0x05, 0x9B,
+    0x41, 0xB3, 0x4D, 0xB8, 0x91, 0xCE, 0x44, 0x7C, 0xDB, 0xB5, 0x7E, 0xB4, 0xA1, 0x99, 0x0A, 0xD9,
+    0x19, 0xF7, 0x66, 0xC0, 0x68, 0x81, 0x21, 0x81, 0xCD, 0x50, 0x0A, 0x0A, 0x05, 0x38, 0xEA, 0x79,
+    0xF7, 0x66, 0xC2, 0xBF, 0xA5, 0xDE, 0x07, 0xBF, 0xB8, 0xC5, 0xA8, 0x49, 0x0C, 0x73, 0xD7, 0x22,
+    0x1B, 0xE8, 0x1E, 0xCF, 0xF8, 0xD1, 0x8F, 0x6E, 0xAA, 0x17, 0x1B, 0x50, 0xBD, 0xE0, 0x6E, 0x25,
+    0xCC, 0xBA, 0xC2, 0x20, 0x68, 0xD4, 0x63, 0x34, 0x42, 0xB7, 0x5D, 0x05, 0x26, 0x03, 0x6A, 0x37,
+    0x29, 0x40, 0xB3, 0x40, 0x95, 0xA1, 0x91, 0x64, 0x24, 0x8D, 0xDD, 0x66, 0xBC, 0x13, 0xB8, 0xBC,
+    0x71, 0x3F, 0x6E, 0x85, 0x46, 0x47, 0xDC, 0xD2, 0xA8, 0xDF, 0xF2, 0x88, 0xD5, 0x3B, 0x57, 0x6A,
+    0x49, 0xAF, 0x6D, 0xA1, 0x59, 0x76, 0x92, 0xC6, 0x13, 0x57, 0xDC, 0xEA, 0x56, 0xD7, 0xBA, 0xD6,
+    0xB7, 0x9E, 0xCF, 0xDF, 0x1D, 0x1D, 0xE7, 0x39, 0xCF, 0x79, 0xF6, 0xD9, 0x67, 0x9F, 0x3D, 0xF6,
+    0xD8, 0x43, 0x2F, 0x29, 0x29, 0x29, 0x6D, 0xD0, 0xD4, 0x0F, 0xF9, 0x21, 0x91, 0xC4, 0x39, 0x76,
+    0xF1, 0xB8, 0xB6, 0x19, 0xED, 0x58, 0xCF, 0x55, 0x30, 0x4B, 0x19, 0x8B, 0x44, 0x66, 0x65, 0x8F,
+    0x93, 0xFC, 0x21, 0xBF, 0x05, 0x57, 0x2F, 0x69, 0xD1, 0x52, 0x2E, 0x65, 0x2C, 0x8E, 0xEE, 0x54,
+    0x24, 0x7E, 0xFE, 0xCE, 0xE4, 0x6D, 0x63, 0xFB, 0x8F, 0xAD, 0x7E, 0xF5, 0xAB, 0x5F, 0x37, 0x56,
+    0x7D, 0x0A, 0x06, 0x4A, 0x8D, 0xF6, 0xED, 0xE0, 0xB9, 0x0E, 0xE0, 0xA5, 0x74, 0xC4, 0x00, 0xBE,
+    0x35, 0x11, 0xDF, 0x17, 0x2F, 0x01, 0xE5, 0xBD, 0xC5, 0x6A, 0xF1, 0xD7, 0xE2, 0xA9, 0x32, 0x5E,
+    0x2F, 0xD2, 0x2B, 0xA4, 0x85, 0xF4, 0x4A, 0x91, 0x06, 0x25, 0xAF, 0xEC, 0x94, 0x77, 0xF2, 0xF9,
+    0x2B, 0xE0, 0x5A, 0xEA, 0x89, 0x72, 0x81, 0x3D, 0x68, 0x5A, 0xAA, 0x9F, 0xC4, 0x4D, 0x2C, 0x8D,
+    0x76, 0x69, 0x4C, 0x34, 0x73, 0xE6, 0xBA, 0x6F, 0x9D, 0x9D, 0x9B, 0x03, 0x5D, 0x0B, 0x83, 0x96,
+    0x46, 0xA9, 0xD4, 0xC2, 0x43, 0x2D, 0xC0, 0xCE, 0x8A, 0x52, 0xBD, 0x86, 0x8E, 0x32, 0x52, 0x4F,
+    0xF8, 0x96, 0x7D, 0x8A, 0xFC, 0x35, 0xA3, 0x58, 0x29, 0x96, 0x43, 0x0F, 0x1E, 0xEC, 0x88, 0x09,
+    0x90, 0xB6, 0x1F, 0xCD, 0xED, 0xE0, 0x94, 0x9C, 0x64, 0x47, 0xBD, 0x30, 0x36, 0x3F, 0x0D, 0x26,
+    0x26, 0x56, 0xD7, 0x0E, 0x2F, 0x48, 0xB3, 0x14, 0xAD, 0x56, 0x86, 0x17, 0xC7, 0x62, 0xBF, 0xAD,
+    0x35, 0xBB, 0xEF, 0x45, 0xFF, 0xD4, 0xF5, 0x4E, 0x79, 0x50, 0xCE, 0xB0, 0x0F, 0xDD, 0x3B, 0xFF,
+    0xEC, 0x95, 0xAD, 0x72, 0x31, 0xCC, 0x85, 0x0A, 0x8D, 0xBA, 0xE4, 0xB1, 0xBD, 0xD7, 0x0D, 0x7D,
+    0xA0, 0x64, 0x47, 0x13, 0x48, 0x74, 0x34, 0x63, 0xB5, 0x14, 0x99, 0xAE, 0x6D, 0x26, 0xCA, 0x7C,
+    0xDE, 0x6A, 0xF5, 0xD7, 0xD6, 0x73, 0x66, 0x7D, 0xA5, 0x5C, 0x5F, 0x29, 0xF2, 0x52, 0xE4, 0x57,
+    0x8A, 0xBC, 0x57, 0xE5, 0x4E, 0xD9, 0x2B, 0x5B, 0xA5, 0x72, 0x4D, 0x90, 0x7E, 0xA3, 0x8A, 0x5E,
+    0xC1, 0x6B, 0xEA, 0xD4, 0xF3, 0xE4, 0xB1, 0xD1, 0xC9, 0xF7, 0x35, 0xF9, 0x28, 0x23, 0xCD, 0xFE,
+    0x93, 0x64, 0xE7, 0xE6, 0x74, 0x30, 0x6F, 0x25, 0x62, 0x87, 0x77, 0xA3, 0x3D, 0x0C, 0xD5, 0xFB,
+    0xA9, 0x4C, 0x43, 0x3B, 0xF8, 0xC9, 0x8F, 0xEE, 0x42, 0xF4, 0x07, 0xE9, 0xB1, 0x1E, 0x8A, 0x4B,
+    0xCD, 0xE3, 0x4B, 0xF3, 0xF8, 0xD2, 0x7C, 0x6B, 0x71, 0xDF, 0x5A, 0xDC, 0x85, 0xE8, 0x47, 0x9E,
+    0x24, 0x92, 0x8A, 0xB4, 0xF5, 0xD7, 0x4F, 0x12, 0x89, 0xC4, 0x22, 0x16, 0xCB, 0xF6, 0x0E, 0x65,
+    0x28, 0x83, 0x09, 0x55, 0xE8, 0x42, 0x37, 0x0F, 0xE3, 0xD1, 0x3C, 0x1D, 0x1F, 0xC6, 0xCD, 0xC7,
+    0x3E, 0xBB, 0x03, 0x8D, 0xA8, 0xD4, 0x16, 0xEA, 0xE9, 0x16, 0x9C, 0xFA, 0x5A, 0xB1, 0xBC, 0xA7,
+    0x7E, 0x70, 0xC9, 0x1F, 0x68, 0xB3, 0x21, 0x62, 0xFB, 0xF3, 0x45, 0xAC, 0xE6, 0xA6, 0xDD, 0x2B,
+    0x97, 0x7A, 0x72, 0xED, 0x5E, 0xB9, 0xD8, 0xC9, 0x47, 0x7D, 0xA0, 0x0D, 0x04, 0x6D, 0xAE, 0x4D,
+    0x5D, 0xEB, 0x74, 0x4F, 0xB3, 0xFB, 0x58, 0xEF, 0x2E, 0x7E, 0xEC, 0xFA, 0xE4, 0x7B, 0xDF, 0x26,
+    0xDF, 0x7A, 0x92, 0x6F, 0x3B, 0x52, 0xD7, 0x0E, 0xA4, 0x8E, 0xB5, 0x48, 0x03, 0x6B, 0x91, 0x07,
+    0x72, 0x91, 0x55, 0xE4, 0x32, 0x03, 0xBB, 0x5D, 0xEF, 0xB5, 0xF8, 0x4F, 0x92, 0x6F, 0xAF, 0x77,
+    0x9C, 0x3B, 0xCF, 0xB9, 0x8E, 0xFD, 0x8E, 0xFD, 0x81, 0x75, 0x40, 0x03, 0x12, 0x2A, 0xF6, 0x5B,
+    0xAB, 0xE0, 0xDF, 0x8D, 0x1D, 0x79, 0x8F, 0xFD, 0xCC, 0xF9, 0x3D, 0xF6, 0x87, 0xC7, 0x73, 0xA7,
+    0xE4, 0x14, 0xAD, 0x42, 0xB1, 0xDF, 0x52, 0xB4, 0xC5, 0xC7, 0xEA, 0x1B, 0x09, 0xBD, 0xBA, 0xD8,
+    0x50, 0x8D, 0xE2, 0xA4, 0x0D, 0x66, 0x14, 0xA7, 0x6C, 0xA8, 0x46, 0xFD, 0x5B, 0x6A, 0xA4, 0xEF,
+    0x49, 0xC1, 0x29, 0x99, 0xF8, 0x1D, 0x7C, 0x8F, 0x59, 0xA0, 0x83, 0x7A, 0x83, 0x7F, 0x37, 0xB8,
+    0x7D, 0x89, 0x48, 0x73, 0xFD, 0xAE, 0xFA, 0xE7, 0x4C, 0x2E, 0x43, 0xB5, 0xD4, 0x7D, 0x33, 0xED,
+    0xE2, 0x79, 0xA5, 0x48, 0xE5, 0x62, 0x43, 0x25, 0x8D, 0x56, 0xC2, 0x2A, 0x51, 0x7F, 0xF2, 0xDE,
+    0x88, 0x15, 0xF8, 0x04, 0x9A, 0x31, 0x77, 0xE0, 0x6B, 0xE0, 0xAE, 0x3D, 0xA1, 0xDB, 0x8A, 0x6A,
+    0x7D, 0x6F, 0x27, 0xB3, 0x90, 0xF1, 0x6D, 0x33, 0xD7, 0xA9, 0x14, 0x40, 0xA9, 0xD9, 0x2A, 0xD8,
+    0xF6, 0xAC, 0x6D, 0xA9, 0xEF, 0x51, 0x2A, 0xF0, 0x68, 0x82, 0xD5, 0xFE, 0xED, 0xEA, 0x95, 0x07,
+    0xC5, 0x87, 0xB7, 0xE9, 0x33, 0xC5, 0x8C, 0x6B, 0xD9, 0xA3, 0x5C, 0x90, 0x5E, 0x90, 0x4E, 0xAC,
+    0x2F, 0x99, 0xE5, 0x38, 0x60, 0xB6, 0x13, 0x7E, 0x45, 0xA9, 0x54, 0x00, 0x12, 0xE9, 0x3A, 0xF9,
+    0x3E, 0x9D, 0x23, 0x9F, 0x23, 0x77, 0x45, 0xF6, 0x6F, 0xAF, 0x5E, 0x6B, 0xA3, 0xB5, 0x5A, 0xD7,
+    0x7D, 0x4C, 0x48, 0xB8, 0xE7, 0x23, 0xC9, 0x84, 0x7A, 0xB6, 0xB3, 0x6F, 0x9B, 0xD7, 0x13, 0xFE,
+    0xC6, 0x44, 0x27, 0x50, 0xA4, 0xD4, 0x48, 0x25, 0xB0, 0x89, 0x7D, 0x68, 0xDE, 0x1C, 0xB1, 0xB7,
+    0xC3, 0x43, 0x66, 0xC9, 0xF6, 0xD5, 0xE4, 0xBE, 0x1F, 0xF7, 0xAB, 0x0F, 0xE4, 0x5B, 0x49, 0xA3,
+    0xDF, 0x64, 0xA6, 0xB1, 0xD0, 0xDD, 0x8C, 0xFF, 0x40, 0xD8, 0xA5, 0x1B, 0x8B, 0xCB, 0x3B, 0x17,
+    0xB1, 0x93, 0x1D, 0x9B, 0x29, 0xE3, 0x6E, 0xCC, 0x78, 0x6D, 0x92, 0x8A, 0xA1, 0xC7, 0x08, 0xBC,
+    0x30, 0xEB, 0x8A, 0xBB, 0x9D, 0x4B, 0x99, 0xD4, 0x84, 0x3A, 0x0D, 0xD8, 0x83, 0xA5, 0x8C, 0x6E,
+    0xF4, 0x6D, 0x36, 0xA1, 0x0E, 0xE7, 0xF1, 0x3F, 0x98, 0xCA, 0x9C, 0xB0, 0xEA, 0x19, 0x96, 0x4D,
+    0xAD, 0x40, 0x91, 0x37, 0x3B, 0x13, 0x89, 0x13, 0xEA, 0x4B, 0x05, 0x5C, 0xA6, 0x5C, 0xC1, 0x4A,
+    0x46, 0x1A, 0x9F, 0x19, 0x66, 0x9A, 0x99, 0x26, 0xD0, 0x04, 0xDC, 0x11, 0x35, 0x52, 0x2D, 0xBD,
+    0x2E, 0x25, 0x9A, 0x58, 0x6A, 0xB2, 0x1F, 0xE3, 0xDB, 0x22, 0x51, 0x05, 0x9A, 0x91, 0x01, 0x1F,
+    0xD1, 0x68, 0xC4, 0x43, 0x2B, 0x26, 0x62, 0x67, 0x7C, 0xCF, 0x8A, 0x49, 0xD4, 0x6A, 0x9B, 0x95,
+    0x26, 0x02, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xA7, 0x4E, 0x9D, 0x3A, 0x75, 0xEA, 0xDC, 0xB9, 0x73,
+    0xCF, 0x3D, 0xF7, 0xDC, 0x73, 0xCF, 0x3D, 0xE7, 0x67, 0x86, 0x50, 0x5C, 0x9B, 0x71, 0x23, 0x03,
+    0xF7, 0xE5, 0xF9, 0x88, 0x9F, 0x0B, 0xF5, 0x76, 0xC1, 0xB7, 0x64, 0xCC, 0x82, 0x9D, 0xF1, 0xAD,
+    0xCF, 0x28, 0x18, 0x01, 0x7C, 0xF3, 0x1B, 0xDD, 0xDF, 0xFF, 0xCB, 0xFF, 0x7B, 0x2F, 0xFD, 0xEF,
+    0xBF, 0x04, 0xF8, 0xED, 0x5F, 0xE1, 0x47, 0x27, 0xCD, 0x7B, 0xA9, 0xF9, 0x49, 0xE8, 0x5C, 0xBF,
+    0xEF, 0xDB, 0xEE, 0xDA, 0xD4, 0xBC, 0xBB, 0x54, 0xEF, 0x47, 0xE6, 0x1F, 0xF1, 0xF5, 0xAF, 0x03,
+    0x17, 0x7F, 0x9F, 0x1F, 0x9D, 0x64, 0xDF, 0xB7, 0xEE, 0xC6, 0x54, 0xBD, 0x1F, 0xCD, 0x87, 0xC9,
+    0x7E, 0x12, 0xFD, 0xDD, 0xB9, 0x73, 0xFD, 0xC9, 0x6F, 0xF0, 0x5B, 0x5F, 0x83, 0x67, 0xD8, 0x82,
+    0xBF, 0x7A, 0x01, 0x9A, 0xF9, 0x18, 0x08, 0xFD, 0xB2, 0x31, 0xE1, 0x66, 0xE7, 0xC7, 0x4C, 0xC0,
+    0x73, 0xDB, 0x2D, 0xC7, 0x62, 0xE1, 0x17, 0x5D, 0x5F, 0x7E, 0xEB, 0xB0, 0xD9, 0xEC, 0x2A, 0x56,
+    0xA0, 0x8B, 0xD0, 0x1C, 0xCE, 0x54, 0x53, 0xD3, 0x7F, 0x85, 0x8D, 0xFA, 0x2A, 0x50, 0x85, 0x01,
+    0x86, 0x33, 0x81, 0x3A, 0x0A, 0x9E, 0xF9, 0x93, 0x4B, 0xC7, 0xB4, 0x74, 0x23, 0x98, 0xC4, 0x26,
+    0xFB, 0xA8, 0x05, 0x68, 0x81, 0xE6, 0xC5, 0x1E, 0xB3, 0x24, 0xE8, 0xEC, 0x4C, 0x1D, 0x3A, 0xC8,
+    0x66, 0xA1, 0x19, 0x7D, 0x6F, 0xA4, 0x84, 0x97, 0xA6, 0x5A, 0x12, 0x92, 0x42, 0x33, 0xD3, 0x5D,
+    0xC8, 0x54, 0xC9, 0x8F, 0xF8, 0xE9, 0xF3, 0xC0, 0xB9, 0xF8, 0x6F, 0x00, 0x67, 0xF8, 0x2E, 0x1B,
+    0xCF, 0x76, 0xB7, 0xDF, 0x64, 0x44, 0x9B, 0x7C, 0xE0, 0xE1, 0x7E, 0x63, 0x4E, 0x33, 0xE8, 0x98,
+    0x2A, 0x57, 0x8F, 0x50, 0xC2, 0x85, 0x6D, 0xD4, 0x6A, 0xB1, 0x13, 0x95, 0x74, 0x04, 0x91, 0xEF,
+    0x50, 0x6D, 0x91, 0xD6, 0xD5, 0x2B, 0x4E, 0x3A, 0x94, 0xDE, 0xDF, 0x20, 0xAD, 0x9E, 0x6A, 0xC4,
+    0x4C, 0x14, 0x9B, 0x20, 0xF3, 0xC8, 0xCF, 0xAF, 0x85, 0x97, 0xB5, 0x48, 0xC9, 0x6B, 0xDD, 0x80,
+    0xEE, 0xAD, 0xF8, 0x46, 0xE9, 0x48, 0xFC, 0xC5, 0x2D, 0xAC, 0x2C, 0xD6, 0xAB, 0x97, 0x07, 0x69,
+    0x23, 0xFE, 0x67, 0xD2, 0x8A, 0x05, 0x3B, 0x63, 0x57, 0xEC, 0xBB, 0xB3, 0x1D, 0xCF, 0x7F, 0x2A,
+    0xF4, 0xBF, 0x81, 0xE7, 0xED, 0x94, 0x4C, 0xEC, 0x58, 0xDD, 0xD4, 0x1D, 0xC6, 0x13, 0xFF, 0x70,
+    0xE5, 0x4B, 0x11, 0xFA, 0x18, 0xD5, 0x42, 0xD7, 0x57, 0xF1, 0xBE, 0xB0, 0x6D, 0x16, 0x51, 0x05,
+    0x12, 0x9E, 0x6D, 0x82, 0xE1, 0xDB, 0x6D, 0x50, 0xE8, 0xFA, 0x66, 0xAE, 0x62, 0x29, 0x86, 0xB1,
+    0x3A, 0xB8, 0x19, 0xD2, 0x23, 0xF7, 0x6B, 0x75, 0x4F, 0xBF, 0x11, 0xB6, 0xD0, 0xFC, 0xCC, 0xAD,
+    0x25, 0x77, 0x2F, 0xBE, 0xFD, 0xB1, 0x86, 0x91, 0x93, 0xB0, 0x62, 0xD4, 0xDB, 0x77, 0x67, 0x5F,
+    0xC4, 0xE3, 0xE3, 0x5B, 0xE4, 0x23, 0x4A, 0xF0, 0x39, 0xCA, 0x9F, 0x52, 0xB1, 0x6E, 0xA9, 0x14,
+    0xA5, 0x38, 0x51, 0x5E, 0xCA, 0xCD, 0x41, 0xEC, 0x9E, 0xFE, 0x69, 0x1E, 0x6E, 0x1C, 0x97, 0x57,
+    0x2D, 0x34, 0x13, 0x5D, 0x5B, 0x7C, 0x7E, 0x87, 0xD6, 0x4E, 0xF7, 0x5D, 0x5B, 0x33, 0xD3, 0xF5,
+    0xC5, 0x4A, 0x9D, 0xEE, 0xC3, 0xC7, 0xE6, 0x09, 0xF0, 0x3F, 0x81, 0x53, 0x82, 0x93, 0xE7, 0x8F,
+    0xF7, 0xEF, 0xCB, 0x81, 0xCC, 0xDF, 0x01, 0x4C, 0x64, 0x03, 0xBB, 0x70, 0xD3, 0xB1, 0x06, 0xBE,
+    0x12, 0x34, 0x0D, 0x27, 0xB7, 0x1E, 0x87, 0x05, 0x70, 0x40, 0x71, 0xF6, 0x8B, 0x5C, 0x5D, 0x31,
+    0xCC, 0x20, 0xCD, 0x74, 0xD2, 0x68, 0x63, 0xB5, 0x96, 0x19, 0xBB, 0xF8, 0x91, 0xEE, 0x85, 0x65,
+    0xB3, 0x51, 0xE5, 0x8E, 0x5A, 0x6E, 0x36, 0x7D, 0xE9, 0xF1, 0x3F, 0xD6, 0xD9, 0x67, 0x93, 0x97,
+    0xF4, 0xBC, 0xA4, 0xC5, 0x4A, 0xC2, 0x4B, 0x23, 0xCF, 0xEA, 0xE2, 0xF1, 0x03, 0x9E, 0x76, 0xEB,
+    0xD4, 0x86, 0x00, 0xEE, 0xC5, 0x91, 0x7A, 0x74, 0x5F, 0xB9, 0xDE, 0xFB, 0x76, 0xA2, 0x0E, 0x2B,
+    0xC8, 0xCE, 0xD8, 0xF7, 0x04, 0x57, 0x4F, 0x5C, 0xFA, 0x8A, 0xD5, 0x2D, 0x23, 0x30, 0x6C, 0xE7,
+    0x75, 0xE7, 0xF2, 0x67, 0xC6, 0xF7, 0xCB, 0xC4, 0xD7, 0x70, 0x76, 0x73, 0xB0, 0x65, 0x66, 0xA8,
+    0x26, 0xB0, 0xE3, 0x2F, 0x0C, 0x61, 0x5F, 0x6E, 0xBB, 0xDB, 0xD8, 0x59, 0x07, 0x70, 0x09, 0xD6,
+    0x0E, 0x13, 0xEA, 0xF1, 0xAB, 0x6A, 0xAF, 0xB8, 0x7C, 0x82, 0xF2, 0x33, 0x9B, 0x84, 0xC3, 0xF8,
+    0x55, 0xEA, 0x77, 0xA2, 0xC5, 0xCE, 0x98, 0x04, 0xC3, 0xA7, 0xFA, 0x3E, 0x08, 0x94, 0xC4, 0x82,
+    0x83, 0x5D, 0x38, 0x07, 0x4F, 0xFE, 0x5C, 0xE4, 0x78, 0x10, 0x09, 0xDF, 0x84, 0x8E, 0x42, 0x63,
+    0xF5, 0x51, 0x68, 0xDA, 0xEB, 0xFF, 0xA5, 0xBA, 0xCD, 0x6B, 0xD1, 0x1D, 0x44, 0x7F, 0x90, 0xFC,
+    0x1B, 0xE9, 0xB1, 0xE7, 0x5F, 0xFA, 0xAF, 0xB5, 0xFB, 0x0B, 0x60, 0x6C, 0x79, 0x1F, 0xC6, 0xAA,
+    0x2F, 0xEE, 0x60, 0x17, 0x7E, 0x6D, 0x46, 0xAD, 0x89, 0x9C, 0x68, 0xA9, 0xE7, 0xCD, 0xD6, 0x69,
+    0xFB, 0x79, 0x1F, 0xF2, 0x00, 0xA0, 0x15, 0xDB, 0xD2, 0x1C, 0x0D, 0xD5, 0x23, 0x5F, 0xBC, 0x66,
+    0x1F, 0x48, 0xCE, 0x37, 0xA1, 0x6B, 0x0B, 0x8D, 0xD5, 0x47, 0x4B, 0xD3, 0xEF, 0xFD, 0x12, 0x12,
+    0x1E, 0xFE, 0xDE, 0xE5, 0xE6, 0xB5, 0xE8, 0x0E, 0x92, 0xBF, 0x95, 0xFC, 0x1B, 0xE9, 0x97, 0x90,
+    0xF0, 0x1D, 0xEC, 0x8C, 0x36, 0x59, 0x2B, 0x9C, 0xA0, 0x9A, 0x8A, 0x85, 0x73, 0x34, 0x6D, 0x35,
+    0x95, 0x0B, 0x7B, 0xB8, 0xB6, 0x9E, 0x4D, 0x44, 0xD8, 0xFA, 0xE0, 0xA7, 0x61, 0xB3, 0x2E, 0x1E,
+    0xAE, 0x6E, 0x2E, 0xE7, 0x9A, 0xD3, 0xAF, 0x2F, 0x7B, 0xEE, 0x89, 0xDB, 0x51, 0x70, 0xEA, 0x8B,
+    0x26, 0xFE, 0x77, 0xE0, 0xDC, 0x67, 0x69, 0xEF, 0x88, 0xF6, 0x37, 0x07, 0x72, 0x78, 0x7B, 0x10,
+    0x52, 0xD7, 0x1C, 0xFE, 0x6C, 0x93, 0x55, 0x16, 0x97, 0x68, 0xDA, 0x62, 0x39, 0x7A, 0x94, 0x0B,
+    0xAE, 0x2D, 0x17, 0x5C, 0x6F, 0x22, 0x7E, 0x04, 0x88, 0x7F, 0x55, 0xAE, 0xDF, 0x35, 0x37, 0x16,
+    0x73, 0xF0, 0x69, 0x82, 0xFD, 0x20, 0xC8, 0x75, 0x63, 0x15, 0xC7, 0x27, 0xFC, 0x81, 0xB0, 0xEC,
+    0x43, 0x7C, 0x6A, 0x15, 0xD7, 0xBF, 0x60, 0x86, 0xFF, 0x73, 0x09, 0xC0, 0x2E, 0x0C, 0x6D, 0xA9,
+    0xA9, 0x7E, 0x7B, 0x71, 0xED, 0xDE, 0x83, 0xD7, 0xFD, 0x42, 0x93, 0x78, 0xA0, 0x8A, 0xE3, 0x26,
+    0x83, 0x83, 0xA3, 0xA3, 0xBD, 0x07, 0x81, 0xA4, 0xFF, 0x7F, 0x65, 0x1F, 0x48, 0xC2, 0x2F, 0x50,
+    0xF6, 0x41, 0xEA, 0x3E, 0xFC, 0xF8, 0xE5, 0xE6, 0xE0, 0x0B, 0x16, 0xF2, 0x83, 0xB6, 0x0B, 0xEC,
+    0xE8, 0xE5, 0xCD, 0x9E, 0x80, 0x34, 0x37, 0x92, 0xB4, 0xD8, 0x68, 0x04, 0xF5, 0x82, 0x9F, 0x30,
+    0x89, 0x3A, 0x51, 0x64, 0x4A, 0xC1, 0x00, 0x83, 0x26, 0x37, 0xE2, 0xB4, 0xD4, 0x81, 0x5A, 0xB9,
+    0x4C, 0x94, 0x6A, 0x19, 0x7A, 0x34, 0xD2, 0x64, 0xBA, 0x80, 0x91, 0xB4, 0x5E, 0xBD, 0x38, 0x48,
+    0x52, 0xB4, 0xD2, 0x16, 0x28, 0x48, 0xE3, 0x8E, 0x24, 0x2D, 0x47, 0x41, 0xB8, 0x7D, 0xB6, 0x37,
+    0xCA, 0xCA, 0x66, 0x1D, 0x72, 0xFD, 0x6A, 0x32, 0xEB, 0x53, 0x71, 0x8F, 0x41, 0xF2, 0x6D, 0x23,
+    0x1D, 0x4E, 0xF5, 0x42, 0x99, 0xAB, 0x0C, 0x9D, 0xF4, 0xF1, 0xB5, 0x5A, 0x92, 0x46, 0xAD, 0x9D,
+    0xC2, 0xCE, 0xBD, 0x72, 0xB8, 0x08, 0x94, 0x92, 0xDE, 0x94, 0xD4, 0x49, 0xF9, 0xBE, 0xDE, 0xB5,
+    0x24, 0x65, 0x69, 0xFB, 0x4F, 0x47, 0x23, 0x52, 0xEA, 0x74, 0xB6, 0xC1, 0x4D, 0xDD, 0x28, 0xB3,
+    0x42, 0xF7, 0x96, 0x4E, 0xA7, 0x66, 0xD6, 0xB7, 0x37, 0x47, 0xBB, 0x75, 0xF6, 0xA1, 0xBB, 0x29,
+    0x93, 0x6C, 0x70, 0x93, 0x1E, 0x57, 0x1D, 0x6D, 0xE8, 0x46, 0x5D, 0xC8, 0x40, 0xA1, 0xEF, 0xE7,
+    0x66, 0xE9, 0x5E, 0x55, 0x95, 0x9A, 0x79, 0xB8, 0x90, 0x6D, 0xF0, 0xAF, 0xAA, 0x4E, 0x6E, 0x3E,
+    0xC1, 0xFF, 0x2A, 0x2E, 0xFB, 0x7E, 0x28, 0xA3, 0xEF, 0x65, 0x52, 0x37, 0x6E, 0x1E, 0xA7, 0xD3,
+    0x7F, 0x00, 0xAD, 0x97, 0xBF, 0x8F, 0x1D, 0xC7, 0x91, 0xC7, 0xBF, 0x3D, 0x2D, 0xED, 0x00, 0x1A,
+    0xC0, 0xAD, 0x40, 0x4E, 0x24, 0x18, 0x93, 0x0B, 0x3A, 0x4F, 0x7A, 0xC1, 0xEE, 0xF6, 0x90, 0x1B,
+    0x6C, 0xC0, 0x60, 0x19, 0x68, 0x7D, 0xA1, 0x12, 0x07, 0xB6, 0x0E, 0x06, 0xFF, 0x81, 0xC7, 0xD7,
+    0x43, 0x6C, 0xC0, 0x40, 0x81, 0x14, 0x28, 0xB7, 0x0D, 0x38, 0xE1, 0x0A, 0x07, 0xC9, 0x80, 0x02,
+    0xF9, 0xB0, 0xFB, 0x7A, 0xA4, 0x0D, 0x18, 0x6C, 0xB0, 0x43, 0x13, 0x06, 0x03, 0x05, 0x1C, 0xDF,
+    0x02, 0x77, 0x80, 0x84, 0x03, 0x5B, 0x62, 0x2F, 0xD4, 0xE4, 0x56, 0xF7, 0xF7, 0x82, 0x47, 0xD2,
+    0x92, 0x7F, 0x00, 0x87, 0xC3, 0x35, 0xEA, 0x5B, 0x53, 0x85, 0x0E, 0x7A, 0x50, 0x33, 0x53, 0x9F,
+    0x1A, 0x33, 0x89, 0x4E, 0x0E, 0xA5, 0x9B, 0xDC, 0x69, 0x7A, 0xFD, 0xB7, 0x77, 0xF0, 0x62, 0xBD,
+    0xE9, 0xB9, 0x47, 0x9E, 0x90, 0x73, 0x06, 0x6C, 0x0F, 0x33, 0x41, 0x47, 0x28, 0x72, 0x74, 0x0C,
+    0x2D, 0xA5, 0x7E, 0x02, 0x95, 0x01, 0xD7, 0xA3, 0xFD, 0xEA, 0xF0, 0x1A, 0xF9, 0x2D, 0x29, 0x9E,
+    0xBC, 0x41, 0xCE, 0xA8, 0x04, 0x80, 0x1D, 0x81, 0xBA, 0x00, 0xF0, 0x01, 0x30, 0xEC, 0xA1, 0x9E,
+    0x24, 0xC0, 0xEE, 0x8D, 0xA8, 0x43, 0x01, 0x7C, 0x1D, 0x60, 0x26, 0xDB, 0x2B, 0xD1, 0x09, 0x96,
+    0x1C, 0x35, 0x99, 0xE1, 0xC9, 0x60, 0x48, 0xAA, 0x82, 0x3A, 0xD9, 0x09, 0xEE, 0x44, 0xA0, 0x33,
+    0xA0, 0xC8, 0x07, 0x2C, 0x66, 0x84, 0x05, 0x04, 0xFA, 0xE9, 0x60, 0x18, 0x2C, 0x83, 0xD4, 0xE7,
+    0xA1, 0x39, 0x1B, 0x3B, 0xFB, 0x33, 0x21, 0xCF, 0x49, 0xC3, 0xF0, 0xF2, 0x75, 0x00, 0x70, 0xEC,
+    0x97, 0x1F, 0x85, 0x05, 0xD2, 0x02, 0x47, 0x0B, 0x24, 0xC7, 0xE0, 0x38, 0x38, 0xCE, 0x0B, 0x25,
+    0x0B, 0x6C, 0x2D, 0xB0, 0xBD, 0x50, 0xC5, 0x31, 0x3B, 0x8A, 0xE3, 0x0C, 0xC0, 0x31, 0x7B, 0x66,
+    0xCF, 0xB2, 0x02, 0xFC, 0xF7, 0x8C, 0x7F, 0x6B, 0x3D, 0xD8, 0x63, 0x1F, 0x80, 0x63, 0x44, 0xCB,
+    0x8C, 0x9A, 0xEC, 0x55, 0x32, 0x13, 0x96, 0x3A, 0xA2, 0x1B, 0x32, 0x9A, 0xC9, 0xF6, 0x55, 0x34,
+    0x33, 0x8E, 0x75, 0x42, 0xD7, 0x17, 0x98, 0xC9, 0x0E, 0x4D, 0x30, 0xF3, 0x1B, 0xF9, 0x5F, 0xB2,
+    0x21, 0xF9, 0x05, 0xC9, 0xE0, 0x48, 0x31, 0x13, 0x8A, 0x8E, 0xB0, 0xFD, 0xB3, 0xA2, 0x1B, 0xF2,
+    0x84, 0x9C, 0xC8, 0xDF, 0x38, 0xA0, 0x1D, 0x51, 0x07, 0x28, 0x01, 0x1C, 0xA7, 0x96, 0xB1, 0x66,
+    0xAE, 0x04, 0xF0, 0x40, 0xF7, 0xA7, 0xFD, 0x86, 0xFC, 0x23, 0x99, 0x3C, 0xD9, 0x91, 0xA3, 0x16,
+    0x53, 0x6A, 0x41, 0x1B, 0xFC, 0xCC, 0x1E, 0xBC, 0x96, 0xDB, 0x19, 0xB5, 0xB8, 0xFB, 0x02, 0x74,
+    0x0F, 0xC4, 0x0F, 0x00, 0xDD, 0xC3, 0x00, 0x34, 0x97, 0x25, 0x03, 0xB0, 0xE4, 0x08, 0x28, 0x32,
+    0x00, 0x68, 0x58, 0xD6, 0x15, 0x9B, 0x00, 0xB4, 0x64, 0x0F, 0x34, 0x64, 0x06, 0x2A, 0x92, 0x09,
+    0xF0, 0x97, 0x85, 0x33, 0x6C, 0x71, 0xA7, 0x1C, 0x0C, 0x6F, 0x67, 0x4B, 0xCD, 0xE0, 0x27, 0x8A,
+    0xFA, 0x39, 0x58, 0x34, 0xCB, 0xCB, 0x10, 0x54, 0x01, 0xED, 0xE8, 0xB2, 0xE2, 0xA4, 0x6E, 0xCC,
+    0x30, 0x13, 0xBA, 0x0F, 0x51, 0xDC, 0xC7, 0x17, 0xE4, 0x5D, 0xE6, 0x0D, 0x0E, 0x2B, 0x00, 0x1E,
+    0x26, 0x78, 0x74, 0xC1, 0xC1, 0x06, 0x07, 0x1F, 0x1C, 0x18, 0x5C, 0xC5, 0xE8, 0x34, 0xA3, 0xBD,
+    0x76, 0x19, 0xED, 0xDE, 0xD7, 0xC9, 0xBE, 0x73, 0x9A, 0xAC, 0x7F, 0x2F, 0x59, 0xEE, 0x25, 0x4B,
+    0x23, 0x36, 0x1B, 0xB1, 0x62, 0xC4, 0x26, 0x23, 0x5D, 0x30, 0x02, 0x00, 0x66, 0x38, 0x82, 0xA1,
+    0xA0, 0x61, 0x84, 0xE2, 0x80, 0xBF, 0xB7, 0xFE, 0xBF, 0xCE, 0x33, 0xB3, 0x1B, 0xCD, 0xCC, 0xDE,
+    0xDC, 0x23, 0xCC, 0x7D, 0x81, 0x39, 0x4D, 0x68, 0x1F, 0x06, 0xB4, 0x8F, 0x26, 0x74, 0x1C, 0xD1,
+    0x11, 0xE8, 0x0A, 0x60, 0x33, 0x60, 0xD9, 0xC3, 0x72, 0x82, 0x65, 0x82, 0xFB, 0x75, 0x81, 0x7B,
+    0x8F, 0x83, 0x3B, 0x60, 0xF0, 0x03, 0x45, 0x91, 0x53, 0xCB, 0xAC, 0xC8, 0xA9, 0x9D, 0xB2, 0x12,
+    0x33, 0xB5, 0x63, 0xAE, 0xC4, 0x4C, 0xDD, 0xB3, 0xCB, 0x90, 0x75, 0x32, 0x93, 0x1D, 0xB2, 0x4E,
+    0xED, 0x64, 0xAF, 0xE4, 0x2E, 0xB6, 0xF7, 0xA9, 0xB2, 0x1D, 0x5E, 0xFF, 0x00, 0x80, 0x1F, 0xB4,
+    0xF8, 0x51, 0x8B, 0x9F, 0x9A, 0xEC, 0x83, 0xC9, 0x3E, 0x76, 0xD9, 0x27, 0x9B, 0xBD, 0xB8, 0xBC,
+    0x2A, 0x25, 0x17, 0x9F, 0x73, 0x71, 0x92, 0x8B, 0x4D, 0xB9, 0x74, 0x31, 0x97, 0x36, 0x64, 0x9A,
+    0x39, 0x13, 0x28, 0x04, 0xCA, 0x3E, 0xF0, 0xB6, 0xED, 0xB5, 0xBC, 0xD0, 0xA0, 0xC5, 0xFD, 0x3D,
+    0x8D, 0x5A, 0x1C, 0xF9, 0x5C, 0xD9, 0x93, 0xD9, 0x7F, 0xF5, 0x51, 0xF6, 0x63, 0xFD, 0x42, 0x78,
+    0xA3, 0x00, 0x86, 0x05, 0x35, 0x29, 0xE0, 0xE0, 0xE6, 0x6E, 0x02, 0x77, 0x04, 0x75, 0x72, 0x3D,
+    0xEC, 0x69, 0x40, 0x25, 0x1E, 0x68, 0x4F, 0x03, 0x94, 0x78, 0xA0, 0x3B, 0x4D, 0xD0, 0xE2, 0x2E,
+    0x36, 0x78, 0x42, 0x32, 0x75, 0x24, 0x7B, 0x92, 0x41, 0x93, 0x82, 0x0D, 0x3E, 0x59, 0x3F, 0x30,
+    0xB2, 0x58, 0xF2, 0x8C, 0x7C, 0x1C, 0x95, 0x14, 0x38, 0x3B, 0xB4, 0x67, 0x73, 0xFD, 0x38, 0xFD,
+    0x4D, 0xE2, 0xED, 0xD0, 0x9D, 0xCD, 0xCD, 0xE3, 0x54, 0xC9, 0x3E, 0x7E, 0x8C, 0xD7, 0xEF, 0xF4,
+    0x0D, 0x73, 0x45, 0x4E, 0x59, 0x89, 0xED, 0xBB, 0xBD, 0xA9, 0x39, 0x8F, 0x75, 0x22, 0xB3, 0x25,
+    0x0D, 0xB9, 0x43, 0x2A, 0x7E, 0x08, 0x37, 0xA0, 0x9D, 0x51, 0x0B, 0x14, 0x01, 0x3F, 0xA2, 0x0B,
+    0xCF, 0x5E, 0x14, 0xE5, 0x13, 0x5A, 0x0A, 0x3C, 0xA5, 0x22, 0x93, 0x66, 0x8F, 0x46, 0x00, 0x13,
+    0x81, 0x36, 0xAC, 0xD5, 0x3D, 0x57, 0x04, 0xDA, 0xD2, 0xFF, 0xC2, 0x90, 0xA9, 0x21, 0x45, 0x93,
+    0xA2, 0x48, 0x41, 0x47, 0x79, 0xF7, 0xF0, 0xF0, 0x8E, 0x27, 0xCB, 0x73, 0xC1, 0x04, 0xFC, 0x5F,
+    0xF4, 0x26, 0x5E, 0x39, 0x48, 0x90, 0x76, 0x6C, 0xC7, 0x52, 0xC5, 0x3A, 0x5A, 0xD8, 0xBB, 0x41,
+    0xE5, 0x63, 0x18, 0x8E, 0x70, 0x02, 0xCD, 0x01, 0x6D, 0x00, 0x08, 0x98, 0x19, 0x4A, 0xF0, 0x0A,
+    0x47, 0xC5, 0x88, 0xB6, 0x40, 0x95, 0x75, 0x17, 0xA9, 0xC8, 0x0F, 0x5A, 0x32, 0x6E, 0x99, 0x79,
+    0xB1, 0x69, 0xE6, 0xAD, 0x85, 0x99, 0xB7, 0xEC, 0x3B, 0x17, 0xD9, 0x92, 0x62, 0xC8, 0xA8, 0xC9,
+    0xE9, 0x1F, 0x1D, 0xDF, 0x8D, 0x70, 0x3A, 0xC1, 0xF6, 0xAE, 0xB7, 0xA3, 0x09, 0xED, 0xA4, 0x68,
+    0x66, 0x74, 0x0F, 0x03, 0x34, 0x23, 0xE0, 0x05, 0x30, 0x19, 0xA8, 0x08, 0x28, 0x06, 0x80, 0x05,
+    0x20, 0x47, 0xB8, 0x87, 0x02, 0xFB, 0x67, 0x0E, 0x36, 0xD8, 0xD8, 0x45, 0xCD, 0x56, 0xE0, 0xE7,
+    0x23, 0x1C, 0x75, 0x7D, 0xD7, 0x4C, 0xCD, 0x17, 0xB1, 0x0A, 0x19, 0x62, 0x7B, 0x6B, 0x26, 0x73,
+    0x12, 0xF5, 0xB3, 0x64, 0x6F, 0x32, 0xF7, 0xA3, 0x8E, 0x05, 0xD9, 0x92, 0x24, 0x2F, 0xC9, 0xB2,
+    0xBF, 0xEF, 0xD6, 0xA8, 0x09, 0xC0, 0xDB, 0x00, 0xB6, 0x71, 0xB4, 0x85, 0xA3, 0x2D, 0x1C, 0x6D,
+    0xE2, 0x68, 0x13, 0xB2, 0x80, 0x2C, 0x94, 0xD8, 0x5D, 0xB1, 0x94, 0x96, 0xC7, 0xF5, 0x93, 0x9B,
+    0xC0, 0x5F, 0xEC, 0xF8, 0xE5, 0x2B, 0x97, 0xC9, 0xEE, 0x3E, 0x9A, 0x73, 0xEB, 0x77, 0xE2, 0x32,
+    0x9B, 0x7B, 0x97, 0xD1, 0xEE, 0x3E, 0x9A, 0x72, 0xEB, 0xAF, 0xC6, 0x65, 0x6E, 0xA6, 0xCB, 0xD8,
+    0xED, 0x3C, 0x9A, 0x8E, 0x8D, 0xBF, 0x1A, 0xB7, 0x73, 0x33, 0x5D, 0x92, 0x7C, 0x44, 0xD2, 0x93,
+    0xDC, 0xDF, 0xDF, 0x7F, 0xFB, 0x0E, 0xD4, 0xEF, 0xEC, 0x41, 0x5C, 0x9A, 0x39, 0xB7, 0x07, 0xD1,
+    0xEE, 0xCE, 0xD9, 0xDC, 0x4B, 0x76, 0x27, 0x2E, 0xCD, 0x94, 0xDB, 0x83, 0xD8, 0xED, 0xCE, 0xB9,
+    0xB9, 0x97, 0xEC, 0xD5, 0xB8, 0x6D, 0xC6, 0x63, 0x73, 0x10, 0xBA, 0x9D, 0x59, 0x9A, 0x29, 0x59,
+    0x92, 0x0F, 0xD7, 0xF7, 0xCF, 0x7C, 0x78, 0x78, 0xE8, 0x7B, 0xA0, 0x1D, 0x81, 0x26, 0x00, 0x55,
+    0xFA, 0xF1, 0xAF, 0x00, 0xCF, 0xB5, 0xB0, 0xFD, 0x3D, 0xD9, 0x7D, 0xC0, 0x72, 0x86, 0x65, 0x82,
+    0xAD, 0x04, 0x16, 0x02, 0x8B, 0x0C, 0xAB, 0x04, 0x96, 0x02, 0xCB, 0x08, 0xCB, 0x01, 0x80, 0xCA,
+    0x00, 0x54, 0xBE, 0x0E, 0xA8, 0x9C, 0x9E, 0x39, 0xFC, 0x95, 0x93, 0xFC, 0x36, 0x20, 0xE4, 0x80,
+    0x4C, 0xCE, 0xC8, 0xD2, 0x04, 0x64, 0xD1, 0x01, 0x45, 0x74, 0x54, 0x45, 0xEA, 0xA0, 0x0A, 0x19,
+    0x54, 0x21, 0xA7, 0x8A, 0x2C, 0xA8, 0x78, 0x1D, 0x7A, 0x86, 0x19, 0xB0, 0x0D, 0x24, 0xE8, 0x19,
+    0xE6, 0x4F, 0xBD, 0xE5, 0x4C, 0x9E, 0x87, 0xEE, 0x6C, 0xB4, 0x16, 0x59, 0xEA, 0xC7, 0xE4, 0x19,
+    0xB3, 0xE5, 0x80, 0x1B, 0x11, 0x9A, 0xEC, 0x4D, 0xE1, 0x68, 0x47, 0x13, 0x2C, 0x74, 0x7C, 0x17,
+    0x95, 0x60, 0xFF, 0x67, 0x02, 0x72, 0x2D, 0x28, 0x01, 0x2A, 0xE1, 0xD4, 0x88, 0x27, 0x93, 0x23,
+    0xA3, 0x5D, 0xF3, 0x7C, 0x54, 0x7E, 0xFD, 0x9D, 0xBF, 0x86, 0x1B, 0x43, 0x7B, 0x85, 0xB9, 0x1E,
+    0xC9, 0xCF, 0x83, 0xBF, 0x9A, 0x16, 0x16, 0xB6, 0x6D, 0x87, 0xE6, 0x01, 0x27, 0x75, 0xC1, 0x88,
+    0x2D, 0x97, 0x61, 0xF6, 0xD8, 0xD7, 0xF7, 0xBF, 0x0C, 0x55, 0x0C, 0xAC, 0x64, 0xD3, 0x92, 0xA6,
+    0x21, 0x77, 0x46, 0xCF, 0x21, 0x6C, 0x94, 0x1E, 0x1D, 0x87, 0x96, 0x49, 0x5F, 0xBC, 0x33, 0x1E,
+    0x43, 0x9A, 0xD1, 0x8C, 0x02, 0x69, 0x26, 0x33, 0xBA, 0x7D, 0xD1, 0xE4, 0x68, 0x98, 0x35, 0x39,
+    0xB9, 0xDD, 0x6C, 0x82, 0xBD, 0x57, 0x74, 0xE9, 0x82, 0x3D, 0xA7, 0x2E, 0x36, 0xD8, 0xFF, 0x2A,
+    0xBA, 0x00, 0xA8, 0x9E, 0x44, 0xC3, 0x68, 0x3F, 0x4E, 0x5B, 0x55, 0x3A, 0x52, 0xF2, 0x19, 0x24,
+    0x42, 0x3E, 0x53, 0xE2, 0x29, 0x96, 0xB9, 0x63, 0xDE, 0xC8, 0xCB, 0x75, 0x7B, 0x18, 0xA0, 0x66,
+    0xE5, 0x43, 0x4D, 0xA9, 0x99, 0x75, 0x82, 0x12, 0xA0, 0xF8, 0x0F, 0x2C, 0x8B, 0x21, 0xCF, 0x59,
+    0x0B, 0xE1, 0x6F, 0x8C, 0xED, 0x97, 0xA1, 0xBE, 0x28, 0xB5, 0x58, 0xB2, 0x26, 0xE1, 0xD8, 0x57,
+    0x7F, 0x80, 0xCB, 0x8A, 0xA5, 0x1E, 0x17, 0x2D, 0xC2, 0xA2, 0xF9, 0x9C, 0xB9, 0x66, 0x6E, 0x21,
+    0x8B, 0xEA, 0x82, 0xBC, 0x4B, 0xB6, 0x9C, 0x3D, 0x1F, 0x93, 0x67, 0x4F, 0x0F, 0xED, 0x80, 0x02,
+    0x2D, 0x30, 0x01, 0x76, 0x04, 0xFF, 0x12, 0x1E, 0x02, 0xB0, 0x1C, 0x41, 0x42, 0x5F, 0x0A, 0xDA,
+    0xF7, 0x02, 0x96, 0xED, 0x58, 0x45, 0x07, 0x73, 0x4F, 0xE0, 0xEA, 0xA0, 0x53, 0x3B, 0x92, 0xFC,
+    0x96, 0xE4, 0x6D, 0x32, 0x9B, 0x51, 0x07, 0x0B, 0x33, 0x02, 0x80, 0x5A, 0xF5, 0x0D, 0xE7, 0xEE,
+    0x56, 0xB2, 0xFB, 0x47, 0xEB, 0xE1, 0x26, 0x03, 0x2B, 0xC0, 0x7D, 0xF5, 0x6F, 0x96, 0xD9, 0x30,
+    0x2B, 0x3F, 0xD7, 0xA9, 0x8D, 0xDD, 0xA8, 0x73, 0x1B, 0xDC, 0x00, 0x9A, 0x40, 0xC0, 0xBD, 0xFF,
+    0x6D, 0x06, 0xBA, 0xB3, 0xEF, 0x12, 0x60, 0xC8, 0x00, 0xD4, 0xE4, 0x08, 0x54, 0xE4, 0x00, 0x80,
+    0xC4, 0xF3, 0x78, 0xBD, 0xEB, 0xC8, 0x8C, 0x8A, 0x8F, 0x2E, 0xD9, 0x1B, 0xDE, 0xB8, 0xE0, 0x6C,
+    0x73, 0x97, 0xBC, 0x74, 0xD3, 0x32, 0xE1, 0x2D, 0x6C, 0x9A, 0x68, 0x22, 0x16, 0xAF, 0x6E, 0x3A,
+    0xF1, 0xE9, 0x5F, 0x3F, 0x10, 0x64, 0xA9, 0x8A, 0xD4, 0x45, 0x4C, 0x91, 0xAE, 0x88, 0x5B, 0x4A,
+    0x59, 0x16, 0x59, 0x32, 0x2E, 0x39, 0x3B, 0x8E, 0x9E, 0xBD, 0x3F, 0xC4, 0xBB, 0x80, 0x4A, 0xE6,
+    0x84, 0xA5, 0x61, 0xA8, 0xCB, 0x0B, 0xA2, 0x6F, 0xE1, 0xFA, 0xA7, 0xE6, 0x8B, 0xD9, 0x35, 0x07,
+    0xF9, 0xA7, 0x26, 0x1E, 0xF9, 0x7B, 0x8F, 0x1F, 0xDE, 0x7E, 0xB4, 0xDD, 0x5E, 0x24, 0x77, 0xF7,
+    0x9B, 0xD2, 0x9E, 0x04, 0x67, 0x0E, 0x82, 0x3E, 0x8F, 0xEA, 0x42, 0x70, 0x53, 0xD0, 0x65, 0x34,
+    0x05, 0x15, 0x01, 0xCE, 0xB0, 0x05, 0xE6, 0x51, 0xD0, 0xDF, 0xF2, 0x8A, 0x74, 0xA9, 0xE6, 0xEC,
+    0x8A, 0xBE, 0x3F, 0x2F, 0xB6, 0xEB, 0x93, 0xB5, 0x3B, 0xDA, 0x6E, 0x4E, 0xE6, 0xCF, 0xB6, 0xED,
+    0xC1, 0x79, 0x78, 0x0D, 0x80, 0x45, 0xBB, 0x93, 0x74, 0xB2, 0xA3, 0x3B, 0xC8, 0x26, 0xB9, 0x99,
+    0xB7, 0xD9, 0xA5, 0xE5, 0x25, 0xEF, 0x3E, 0xCC, 0x72, 0xD3, 0x3F, 0xBC, 0xFB, 0x40, 0x64, 0x69,
+    0x7F, 0x7D, 0xFA, 0x1F, 0x17, 0xB2, 0x7A, 0xB9, 0x1D, 0xB7, 0xD1, 0x99, 0xD1, 0x9C, 0x04, 0x1D,
+    0x04, 0x62, 0x61, 0xCD, 0x68, 0xEE, 0x07, 0x1D, 0xD7, 0xFC, 0xD9, 0x23, 0x1F, 0xC4, 0xFA, 0x49,
+    0x46, 0x71, 0xBD, 0x1D, 0xD4, 0xAA, 0x37, 0x0C, 0xF6, 0xEB, 0xE4, 0x90, 0x8F, 0xB1, 0xCA, 0x58,
+    0x1E, 0x63, 0xE5, 0xAF, 0x64, 0x47, 0xE9, 0x98, 0x0C, 0x83, 0x5A, 0xF5, 0x64, 0x26, 0x73, 0xD9,
+    0xCF, 0x19, 0xC7, 0x19, 0xAB, 0x8C, 0x55, 0x46, 0x29, 0x3F, 0xB4, 0x3B, 0xB8, 0x03, 0xD5, 0xAB,
+    0xA7, 0x1C, 0x5A, 0x12, 0xFC, 0x3C, 0x9A, 0x50, 0x8F, 0xC4, 0xA6, 0x09, 0x7A, 0x24, 0xB6, 0x4C,
+    0xA8, 0x47, 0xFE, 0xA7, 0xB4, 0xE4, 0x2D, 0x32, 0x74, 0x14, 0x9D, 0x7E, 0x09, 0x3B, 0x40, 0x47,
+    0xC0, 0xAD, 0xBB, 0xD2, 0x6A, 0x5D, 0xD2, 0x8D, 0x02, 0x4A, 0x53, 0x82, 0x43, 0x95, 0xD0, 0x4C,
+    0xB0, 0x3D, 0x56, 0x50, 0xF9, 0x25, 0xCD, 0x54, 0x33, 0x55, 0x7E, 0x20, 0x69, 0xC9, 0xB3, 0x8F,
+    0x9E, 0x7E, 0xA2, 0x12, 0xB0, 0x04, 0xDA, 0x01, 0x4D, 0xC0, 0xF3, 0x29, 0x74, 0x7C, 0x9E, 0xBC,
+    0x0B, 0x78, 0x98, 0x93, 0x58, 0xA5, 0x6E, 0xB4, 0x7D, 0xD6, 0xA1, 0x09, 0x4B, 0xD8, 0xF7, 0xA7,
+    0x2A, 0x0B, 0x0C, 0x07, 0xF8, 0x08, 0x4D, 0xC0, 0x06, 0xA8, 0x0C, 0xB4, 0x23, 0xB4, 0xE0, 0x75,
+    0x0E, 0x15, 0x03, 0xBA, 0x8C, 0xAA, 0x00, 0x40, 0x00, 0xDE, 0x20, 0xFB, 0x86, 0xA4, 0x92, 0x76,
+    0x37, 0x59, 0x15, 0xCD, 0x49, 0x68, 0x7B, 0x79, 0x11, 0x74, 0xB7, 0x62, 0xF7, 0x39, 0xC9, 0xD8,
+    0x90, 0x05, 0x0D, 0x4B, 0x0F, 0x15, 0x01, 0xB4, 0x3D, 0x50, 0x45, 0x00, 0x5D, 0x0F, 0xE0, 0x3A,
+    0xD0, 0x8E, 0x66, 0xB2, 0xC3, 0x0A, 0xB6, 0x0E, 0x70, 0xB6, 0x07, 0x05, 0xE0, 0x88, 0xAA, 0x00,
+    0xAD, 0x00, 0x14, 0x98, 0xEF, 0x04, 0xBC, 0x96, 0x9A, 0x64, 0xE2, 0x9B, 0xC3, 0x2B, 0xBF, 0xF9,
+    0x01, 0x9C, 0x8E, 0x21, 0x5D, 0x6F, 0x9B, 0xC9, 0x7C, 0xF1, 0x2C, 0x21, 0xBF, 0x26, 0x9F, 0x90,
+    0xCF, 0xFE, 0x83, 0x46, 0xD4, 0xE1, 0xD5, 0x97, 0x3E, 0x79, 0xEB, 0x93, 0xB7, 0xE6, 0xB7, 0xE6,
+    0xAD, 0x78, 0xD3, 0x67, 0xFB, 0xDF, 0xF8, 0x09, 0x7E, 0x82, 0x7F, 0x2A, 0x1B, 0xB7, 0x5E, 0xF0,
+    0xE7, 0xE0, 0x19, 0x7F, 0xBA, 0xDD, 0x7F, 0x00, 0x1C, 0x00, 0x28, 0x1B, 0xB7, 0xD2, 0x0B, 0xE0,
+    0xA4, 0xE7, 0xC0, 0xB9, 0x1A, 0x97, 0x66, 0x3A, 0x36, 0x07, 0xB1, 0xDB, 0x99, 0x73, 0x33, 0xC9,
+    0x73, 0xBE, 0x7C, 0x47, 0x52, 0x00, 0x78, 0x00, 0xDD, 0xB8, 0x66, 0x76, 0xF5, 0x3B, 0x1F, 0xE0,
+    0x03, 0x30, 0x03, 0x33, 0x10, 0x00, 0xCE, 0xA0, 0x20, 0xDC, 0x44, 0xD8, 0xC6, 0x37, 0xC7, 0xA0,
+    0x80, 0x33, 0x80, 0xD7, 0x00, 0x1C, 0xBD, 0x0A, 0x1C, 0xFD, 0x33, 0xB0, 0xF8, 0xBE, 0x6C, 0xC2,
+    0xC2, 0x12, 0x8B, 0xCD, 0xB6, 0xBF, 0xB9, 0x69, 0xFA, 0x9B, 0x9B, 0x5D, 0x7F, 0x6C, 0x89, 0x95,
+    0x4D, 0x58, 0xBD, 0x86, 0x1F, 0x41, 0x0F, 0x08, 0xD8, 0x84, 0x29, 0x9A, 0x21, 0xDC, 0xDC, 0x34,
+    0xEF, 0xBF, 0x71, 0xCE, 0xC0, 0x59, 0x7D, 0x08, 0x66, 0xDD, 0x1F, 0x03, 0x47, 0x50, 0xF1, 0x95,
+    0x8F, 0x66, 0xCB, 0x01, 0xCB, 0x57, 0x75, 0x7C, 0xEA, 0x6F, 0x53, 0x36, 0x4A, 0xFF, 0x69, 0x13,
+    0x9B, 0x5D, 0xCE, 0x9F, 0xE6, 0x1B, 0xD7, 0xF6, 0xF0, 0xD9, 0xBF, 0x87, 0xFA, 0xB4, 0x60, 0xD3,
+    0xCF, 0xFA, 0xF4, 0x63, 0x2C, 0x7E, 0x9F, 0x6F, 0xBC, 0x67, 0x18, 0x3F, 0x71, 0xA5, 0x51, 0xBE,
+    0x87, 0xCB, 0xF0, 0x1F, 0xF7, 0x0B, 0x3D, 0x75, 0x48, 0xCD, 0xB8, 0xAD, 0xCA, 0x3B, 0x43, 0xC7,
+    0xB9, 0xA1, 0xD4, 0x81, 0x3A, 0x76, 0x63, 0x6E, 0x82, 0xDF, 0x11, 0x3B, 0x13, 0xE6, 0x24, 0x98,
+    0x93, 0x60, 0xEE, 0xC7, 0xF6, 0x41, 0xFC, 0xAB, 0x89, 0xFF, 0x7F, 0xD3, 0xF0, 0xFE, 0x07, 0xC5,
+    0x9B, 0x4D, 0x8C, 0x1E, 0x47, 0x7A, 0xDF, 0x7F, 0xDD, 0x25, 0xB2, 0xD7, 0x6C, 0x78, 0x4B, 0x87,
+    0x95, 0xB1, 0xA0, 0xE2, 0x6D, 0x1F, 0x13, 0x79, 0xA5, 0xF6, 0xC1, 0x87, 0x0D, 0x20, 0x4E, 0x35,
+    0xC5, 0xC3, 0x1E, 0x84, 0x80, 0x44, 0x22, 0x6E, 0x0E, 0x81, 0xC1, 0x3D, 0xE4, 0xB0, 0x4B, 0xC3,
+    0x60, 0x0E, 0x81, 0xB3, 0x01, 0x34, 0xD3, 0xBD, 0x62, 0x60, 0x01, 0x11, 0x10, 0xF1, 0xB0, 0x9B,
+    0x8B, 0x61, 0x8B, 0x01, 0x64, 0x60, 0xC5, 0xC5, 0x9A, 0x3E, 0x08, 0x0E, 0x63, 0xCC, 0x4C, 0x97,
+    0x34, 0x80, 0x75, 0xE0, 0x81, 0x2D, 0x71, 0x0D, 0x06, 0x10, 0x10, 0xB6, 0x3E, 0x1C, 0x21, 0xAB,
+    0x20, 0x2A, 0x69, 0x5B, 0x52, 0x53, 0xAC, 0xEE, 0x7F, 0x0E, 0xFD, 0xCE, 0x70, 0x46, 0x1F, 0x59,
+    0xC9, 0xA6, 0x9C, 0x7E, 0xEB, 0x99, 0xB7, 0xDF, 0x9A, 0x7E, 0xAB, 0xFE, 0xF5, 0x54, 0xD5, 0x53,
+    0xCF, 0xD7, 0x5B, 0x07, 0xED, 0x28, 0x8F, 0x65, 0x7F, 0xB6, 0x62, 0xB9, 0xEE, 0xE1, 0x2F, 0xF2,
+    0xCE, 0x55, 0x93, 0x19, 0x6C, 0x57, 0x56, 0x5B, 0xE9, 0x90, 0x75, 0x45, 0xB5, 0xCE, 0x60, 0x9A,
+    0xAF, 0x00, 0x7C, 0x0D, 0x02, 0xC6, 0x63, 0x49, 0xD4, 0x38, 0x19, 0xFD, 0xEF, 0xE2, 0x1A, 0xDB,
+    0x0F, 0xA7, 0x43, 0x6F, 0xAF, 0x37, 0xE5, 0x7F, 0xA2, 0xFD, 0xF7, 0x68, 0x4E, 0x34, 0xD3, 0xBE,
+    0xC9, 0xB7, 0xA0, 0x27, 0x6B, 0x56, 0x0D, 0x1F, 0x9E, 0x49, 0x35, 0xD1, 0xFE, 0x71, 0xC8, 0xFD,
+    0xAF, 0x71, 0x05, 0x32, 0x0F, 0xC7, 0xC0, 0xF4, 0x50, 0x82, 0xD3, 0x64, 0xA4, 0x8E, 0x4D, 0xC8,
+    0x3D, 0x49, 0x24, 0x91, 0xC7, 0xE9, 0x23, 0x23, 0x8D, 0x4E, 0xEA, 0xE0, 0x1E, 0x7E, 0xD7, 0x74,
+    0x56, 0x4A, 0xA4, 0x90, 0x69, 0x62, 0xDB, 0x76, 0x79, 0xB7, 0x4D, 0x6B, 0xFB, 0x5C, 0x53, 0x22,
+    0x0D, 0x4E, 0xF2, 0xB7, 0xFE, 0x73, 0x48, 0xB8, 0x87, 0xFB, 0xE0, 0xB1, 0xD2, 0x9B, 0xD1, 0x06,
+    0x1B, 0x4C, 0x74, 0x3E, 0x91, 0x2A, 0xDA, 0x19, 0x5C, 0x04, 0x1B, 0x30, 0x12, 0x99, 0xD4, 0x1C,
+    0xB9, 0x3C, 0x37, 0xD8, 0x1E, 0xEC, 0x47, 0x18, 0xA9, 0xCA, 0x24, 0x7F, 0xE4, 0x72, 0x0F, 0xC5,
+    0x8A, 0x80, 0x6F, 0xFE, 0xF2, 0xE6, 0xFA, 0x07, 0x15, 0xE6, 0xCF, 0xFF, 0xEA, 0xED, 0x9F, 0xFD,
+    0x65, 0x07, 0x80, 0xBC, 0xD1, 0x90, 0xF9, 0xE7, 0x73, 0xFF, 0x5B, 0xD9, 0x5C, 0x19, 0x05, 0xAB,
+    0xD1, 0x56, 0xB1, 0xF8, 0x71, 0xB4, 0x8A, 0xB9, 0x86, 0x44, 0x81, 0x2C, 0xDE, 0x43, 0x2C, 0xFE,
+    0x67, 0x74, 0x1A, 0xEE, 0x57, 0x03, 0xB8, 0x13, 0x61, 0x2E, 0x76, 0xC6, 0xF6, 0xCC, 0x7B, 0xF3,
+    0xD9, 0x3F, 0x7A, 0x36, 0x1D, 0x13, 0x85, 0x63, 0xD9, 0x4B, 0xCF, 0x3C, 0xF8, 0xEF, 0x8E, 0xDF,
+    0x78, 0xE6, 0xC1, 0x63, 0xD9, 0x0B, 0x1A, 0xD2, 0x11, 0x78, 0xE8, 0xC5, 0x57, 0xFF, 0xD9, 0xAF,
+    0xFF, 0xCE, 0xB7, 0xD4, 0xCF, 0xCD, 0xFC, 0x67, 0x27, 0xA4, 0x9B, 0x52, 0x95, 0x4C, 0x98, 0x11,
+    0xDB, 0x53, 0x36, 0x70, 0xFA, 0xF4, 0xBF, 0x58, 0xD5, 0x3E, 0x8B, 0x82, 0x7B, 0xFB, 0xA5, 0xFF,
+    0xF2, 0x07, 0x7F, 0xF8, 0xFE, 0x8D, 0x4B, 0xBF, 0xE7, 0x2E, 0xEF, 0x36, 0x81, 0x62, 0xA9, 0x0E,
+    0x38, 0x45, 0xDB, 0x97, 0x3A, 0x1F, 0xE2, 0x46, 0x76, 0x23, 0x4C, 0x4E, 0x2F, 0x68, 0xC8, 0x26,
+    0x80, 0x43, 0x50, 0xAE, 0x8A, 0x93, 0x9C, 0x44, 0x59, 0xAD, 0x6A, 0x8E, 0xC2, 0x7D, 0x8F, 0x15,
+    0x8A, 0x4E, 0x13, 0x50, 0x9E, 0xFF, 0x3D, 0xFA, 0x5F, 0xCF, 0x5E, 0x18, 0xDC, 0x7B, 0xCF, 0x95,
+    0xFE, 0x9F, 0xFB, 0xDC, 0x0C, 0x87, 0xC2, 0x23, 0x3B, 0xCA, 0x87, 0xCC, 0x8F, 0xC5, 0x89, 0xF0,
+    0x35, 0x1C, 0xCE, 0x7A, 0x7B, 0x23, 0x98, 0xF7, 0x23, 0x53, 0x8D, 0x3B, 0xD3, 0xD9, 0x1B, 0x83,
+    0x79, 0x5F, 0xC9, 0xD4, 0xDE, 0xD2, 0x65, 0xE9, 0x6D, 0xE9, 0xA3, 0x0F, 0xE7, 0x79, 0x13, 0x4A,
+    0x48, 0x80, 0x7C, 0x1C, 0xDD, 0x18, 0xDB, 0x31, 0x6A, 0x88, 0x1A, 0x62, 0x3B, 0x44, 0x17, 0xA2,
+    0x0D, 0x31, 0x0F, 0xD1, 0xAE, 0xCA, 0x66, 0x11, 0x36, 0xCB, 0x7E, 0xD3, 0xED, 0x96, 0xBA, 0xDB,
+    0x74, 0x27, 0xDF, 0xB8, 0xA5, 0xB3, 0xCD, 0x11, 0xFA, 0xF2, 0xFC, 0x76, 0xF2, 0xFA, 0xE4, 0x9A,
+    0x3C, 0x0D, 0x39, 0x7F, 0x91, 0x13, 0xDC, 0xEB, 0xCF, 0xE5, 0xFD, 0x5F, 0xBE, 0x71, 0xFE, 0x9A,
+    0x2D, 0x47, 0xD7, 0x40, 0x52, 0x01, 0x2D, 0x7C, 0xCD, 0x44, 0x92, 0xE1, 0x50, 0xC0, 0x36, 0x99,
+    0x67, 0x93, 0x02, 0xD3, 0xF3, 0x38, 0x8E, 0x24, 0x24, 0x03, 0xF7, 0xFF, 0xDC, 0xBE, 0xF0, 0x43,
+    0x85, 0x2D, 0xFB, 0x6D, 0xBD, 0x14, 0x26, 0x70, 0xF9, 0xF3, 0x24, 0xE3, 0x1F, 0x76, 0xD8, 0x9D,
+    0xAB, 0x15, 0xDB, 0x0F, 0xB5, 0x4D, 0x16, 0x24, 0xDC, 0xF1, 0x7F, 0x39, 0xA4, 0x11, 0xDB, 0xD8,
+    0x8E, 0x35, 0xBE, 0xCF, 0xAA, 0xF9, 0x3C, 0x90, 0x54, 0x26, 0x92, 0x0C, 0x9C, 0x81, 0x91, 0xCC,
+    0xB3, 0x49, 0x12, 0x58, 0x83, 0xC7, 0x71, 0x50, 0x50, 0x54, 0xDC, 0xFF, 0x73, 0xFB, 0xD7, 0x63,
+    0xA1, 0xFC, 0x86, 0x5E, 0xD2, 0x4B, 0xAF, 0x75, 0x03, 0x26, 0xF0, 0x0D, 0xD2, 0x91, 0xBC, 0x21,
+    0x92, 0x75, 0x4C, 0xE4, 0x81, 0x1A, 0x1B, 0x70, 0x95, 0xBD, 0x55, 0x95, 0x8D, 0x51, 0xB0, 0x3E,
+    0x51, 0x4C, 0x4E, 0x01, 0xC5, 0x00, 0xDC, 0x1E, 0xF8, 0x27, 0xD0, 0xA7, 0x01, 0xD3, 0x14, 0x55,
+    0x16, 0x89, 0xB8, 0x90, 0x77, 0xA4, 0x61, 0x8D, 0x43, 0xD9, 0x4E, 0xC0, 0xA9, 0x38, 0xEF, 0x35,
+    0xC4, 0xF2, 0xF8, 0xF6, 0xA3, 0x2F, 0x4F, 0x50, 0x7F, 0xF5, 0x79, 0x4C, 0x78, 0xAF, 0xA3, 0x7C,
+    0xEA, 0x99, 0x0B, 0x44, 0x27, 0x6F, 0xBB, 0xB3, 0x33, 0x35, 0xA6, 0x37, 0x03, 0xB6, 0x39, 0x5A,
+    0x01, 0xB8, 0x9E, 0x7C, 0x20, 0x8D, 0x50, 0xC3, 0x91, 0xDD, 0xCD, 0x0F, 0x90, 0x79, 0x6C, 0xC0,
+    0x8C, 0x30, 0x43, 0xDB, 0xA0, 0x0E, 0x5D, 0xA0, 0x05, 0x57, 0x61, 0x3D, 0x26, 0x40, 0x04, 0xC7,
+    0xA1, 0x3C, 0x64, 0x9D, 0xDA, 0xD1, 0x6A, 0xE0, 0x5C, 0x77, 0xE7, 0xFB, 0x9B, 0xDF, 0x82, 0xE2,
+    0x97, 0x9E, 0xF4, 0xD5, 0x11, 0x1E, 0x2C, 0xF7, 0xB5, 0x4C, 0xE9, 0xC1, 0x44, 0xA0, 0xEE, 0x21,
+    0x17, 0xA0, 0x01, 0x8A, 0x67, 0x1A, 0xCC, 0x10, 0xA1, 0xB6, 0x3D, 0x79, 0xA8, 0x61, 0x32, 0x03,
+    0x85, 0x77, 0x8D, 0x91, 0x22, 0x4E, 0xEA, 0x72, 0x49, 0x48, 0x0A, 0x45, 0x4F, 0x7D, 0x7E, 0x22,
+    0x8B, 0xCE, 0xE3, 0x3A, 0x92, 0x11, 0x70, 0x1D, 0x98, 0xFF, 0xB3, 0xBA, 0x49, 0xC6, 0x2F, 0xB5,
+    0x43, 0x0E, 0xFF, 0xC7, 0xCB, 0xEA, 0x48, 0x66, 0x29, 0x82, 0x93, 0xD4, 0x90, 0x69, 0x02, 0x90,
+    0x3C, 0x50, 0x5E, 0x8E, 0x80, 0x79, 0x4F, 0x1E, 0xD8, 0x2E, 0x24, 0x8F, 0xF5, 0x52, 0x24, 0x1D,
+    0xAD, 0xE4, 0xA9, 0xD1, 0xCF, 0xC1, 0x4A, 0x11, 0x12, 0x49, 0x1E, 0x9C, 0x34, 0x5F, 0x7A, 0x36,
+    0x93, 0x24, 0x79, 0x61, 0xA4, 0x58, 0xF6, 0x38, 0xE9, 0x7A, 0xC4, 0x48, 0xF3, 0xEE, 0x60, 0x5A,
+    0xBD, 0x09, 0xAD, 0x54, 0xD1, 0x4A, 0x1D, 0xED, 0x25, 0x05, 0x5A, 0xF2, 0x91, 0x96, 0x34, 0xD2,
+    0xC2, 0x44, 0x0B, 0x93, 0xD3, 0xB4, 0xFA, 0x73, 0x9F, 0x7E, 0xC4, 0x44, 0x8B, 0x99, 0x68, 0x39,
+    0x17, 0x69, 0xA5, 0x48, 0x2B, 0x8D, 0xB4, 0x52, 0xA0, 0x95, 0x3C, 0xAD, 0x6E, 0xAD, 0x9A, 0x1F,
+    0xFF, 0x2D, 0x94, 0x6F, 0x55, 0x98, 0x6B, 0x03, 0x3C, 0xEC, 0xF6, 0x71, 0x31, 0x69, 0x7B, 0x90,
+    0x7A, 0x6A, 0xC9, 0xDB, 0x31, 0x9B, 0xD3, 0x09, 0x3B, 0x38, 0x4F, 0xFD, 0xE4, 0x80, 0x89, 0x2D,
+    0x94, 0x57, 0x03, 0x49, 0x6C, 0xA1, 0xB8, 0x1A, 0x48, 0x63, 0xDB, 0xE0, 0x5E, 0xD2, 0xA9, 0x73,
+    0xD1, 0x49, 0x7A, 0x42, 0xD2, 0x60, 0x25, 0xE1, 0x24, 0xCF, 0x39, 0x5D, 0x58, 0xA6, 0xE6, 0x89,
+    0xC1, 0xCC, 0x11, 0x17, 0x31, 0x13, 0x46, 0x9D, 0xD1, 0x94, 0x4D, 0xAE, 0x5F, 0x75, 0xB9, 0x2C,
+    0xC8, 0x6C, 0x35, 0x99, 0x5A, 0xCD, 0xE6, 0xB2, 0xCA, 0x4C, 0x5C, 0xD5, 0x2E, 0x0F, 0xAD, 0xA4,
+    0xF4, 0x6E, 0x6D, 0xBB, 0x9C, 0x37, 0x45, 0x58, 0x6A, 0xA7, 0x7D, 0xB5, 0x49, 0x7B, 0x39, 0x2C,
+    0x33, 0x35, 0x03, 0xD4, 0xCB, 0x8C, 0xD9, 0xD1, 0xCE, 0x40, 0x3A, 0xA5, 0x1A, 0x00, 0xE7, 0x6B,
+    0x35, 0x90, 0x0D, 0xF6, 0x76, 0x04, 0xDA, 0x54, 0xA5, 0x87, 0x3C, 0xB8, 0x97, 0x23, 0xD0, 0xDA,
+    0xB1, 0xF0, 0x90, 0xBF, 0xAB, 0x34, 0x02, 0xAD, 0x3A, 0xE7, 0x21, 0x53, 0x3C, 0x17, 0xD9, 0x5D,
+    0x0F, 0xA4, 0x92, 0x06, 0xC0, 0x4A, 0x5A, 0xFA, 0x93, 0x5F, 0xFE, 0x7B, 0x01, 0xC8, 0x56, 0x90,
+    0xE4, 0x97, 0x41, 0x0D, 0x0B, 0xD0, 0xF9, 0x40, 0x6D, 0xB1, 0x8C, 0xDC, 0xAC, 0x46, 0xDE, 0x2E,
+    0x23, 0xB7, 0xAB, 0x67, 0xDF, 0x5C, 0x6A, 0xBF, 0xBB, 0x37, 0x43, 0x03, 0xF0, 0x38, 0xB0, 0x06,
+    0x14, 0x15, 0x1C, 0xDA, 0xBF, 0xA1, 0x3F, 0xED, 0xAA, 0x2B, 0x64, 0x03, 0xF5, 0xF1, 0x09, 0xE7,
+    0x9D, 0x2F, 0xBB, 0x7C, 0xB0, 0x01, 0xE5, 0x03, 0xE5, 0xF5, 0x88, 0x99, 0x67, 0x68, 0x05, 0x85,
+    0x1A, 0x8C, 0xFC, 0xB2, 0x7F, 0xEC, 0xB0, 0xE2, 0xA7, 0xAA, 0x65, 0xAF, 0x15, 0xC3, 0x32, 0x9A,
+    0xC7, 0xB0, 0x0D, 0x23, 0xF6, 0x4D, 0x34, 0x5A, 0x85, 0xA9, 0xBE, 0xD6, 0x4C, 0x63, 0x7E, 0xF3,
+    0x87, 0x71, 0xD6, 0xD3, 0xEA, 0x35, 0xD8, 0x8E, 0x71, 0x79, 0x84, 0x74, 0xAE, 0x8C, 0xC6, 0xF4,
+    0xD6, 0x39, 0xA2, 0xE9, 0xD7, 0xD2, 0xB1, 0x38, 0x3F, 0x65, 0xAF, 0x87, 0x64, 0xBC, 0xC2, 0x46,
+    0xD1, 0x94, 0x3B, 0x53, 0x1E, 0xDC, 0x2B, 0x31, 0x8D, 0x6D, 0xE3, 0x9C, 0x74, 0x4D, 0xBA, 0x2E,
+    0xF5, 0xDC, 0x57, 0x91, 0xBE, 0xD6, 0x65, 0xB7, 0xFA, 0xBC, 0xEE, 0xAC, 0xF5, 0x7B, 0x83, 0x48,
+    0x6F, 0x0D, 0x56, 0x83, 0xBB, 0x3C, 0x1E, 0x4B, 0xC7, 0xCD, 0x24, 0x5E, 0x21, 0x0E, 0xC4, 0x2B,
+    0x49, 0x6C, 0x15, 0x9D, 0xA6, 0x52, 0xD3, 0xE1, 0x69, 0x83, 0x75, 0x10, 0xC9, 0xDB, 0x15, 0x82,
+    0x75, 0xBE, 0xD8, 0x77, 0x57, 0x0F, 0xB6, 0x8D, 0x95, 0x14, 0xDC, 0x65, 0xBD, 0x3C, 0x1E, 0x4B,
+    0x75, 0x7A, 0x6B, 0x33, 0x91, 0xE6, 0x2B, 0x48, 0xF3, 0xC0, 0x0C, 0x57, 0x12, 0x41, 0x2B, 0x7D,
+    0xF4, 0xE7, 0x4E, 0xD2, 0x5C, 0x4A, 0x9A, 0x0F, 0x4F, 0xB5, 0x56, 0xD3, 0xB4, 0x06, 0x94, 0x01,
+    0x0E, 0xCF, 0x70, 0xE8, 0xDC, 0xDF, 0x60, 0xA4, 0x0E, 0x69, 0x80, 0x35, 0x92, 0xED, 0x93, 0x4D,
+    0xAA, 0xDB, 0x5D, 0x2A, 0x05, 0x26, 0x13, 0x71, 0xB4, 0x14, 0xBE, 0x68, 0xCC, 0x68, 0x3B, 0xA4,
+    0x40, 0xA1, 0x81, 0x44, 0x23, 0x1C, 0x59, 0x9A, 0x33, 0xAF, 0xF5, 0xF9, 0xAD, 0xDE, 0xD6, 0x9D,
+    0x3D, 0xB9, 0xE2, 0x44, 0xB2, 0x5D, 0x59, 0x05, 0xF7, 0xF6, 0x58, 0x33, 0x6D, 0xB1, 0x3D, 0xB1,
+    0xB1, 0xC5, 0x76, 0x7B, 0x7C, 0xAA, 0x15, 0x4B, 0x8D, 0x56, 0x21, 0xD9, 0xAE, 0x38, 0x7C, 0x81,
+    0x45, 0xCF, 0x09, 0x0B, 0xAD, 0xF6, 0xC7, 0xA1, 0xB3, 0x3F, 0x1D, 0xAC, 0x14, 0x4B, 0x2D, 0x42,
+    0xEC, 0x33, 0x9E, 0x3B, 0x05, 0x8F, 0x83, 0xF5, 0x30, 0x42, 0x59, 0x61, 0x02, 0x38, 0xC8, 0x3A,
+    0xD8, 0x04, 0xEB, 0x49, 0x96, 0xFA, 0x73, 0x01, 0x27, 0x6F, 0xA5, 0x24, 0x6A, 0x28, 0x4F, 0xBE,
+    0x73, 0xFE, 0x83, 0x5B, 0xA3, 0xAB, 0xCF, 0x3C, 0xA1, 0x0F, 0xC7, 0x42, 0xAA, 0xA4, 0xDE, 0x28,
+    0x52, 0xDC, 0x22, 0x1D, 0xC1, 0x55, 0x64, 0x01, 0xDA, 0xA5, 0xC3, 0x08, 0xA5, 0xC7, 0x8C, 0xB0,
+    0x06, 0x59, 0xB5, 0x2B, 0x02, 0x2A, 0x38, 0x06, 0xF9, 0x5E, 0xCF, 0xFF, 0x8F, 0x2B, 0x0F, 0x44,
+    0x57, 0x95, 0x4F, 0x44, 0x33, 0xD8, 0xCE, 0xD1, 0x66, 0xBD, 0x19, 0x27, 0xCA, 0x9B, 0x1E, 0x8D,
+    0xE4, 0xAA, 0x70, 0x01, 0x23, 0x28, 0x3A, 0x92, 0x08, 0xCE, 0x27, 0x97, 0x47, 0x4A, 0x91, 0xAA,
+    0xA3, 0xEC, 0x21, 0x62, 0x3D, 0x11, 0xDB, 0xA1, 0xC1, 0xAA, 0x9F, 0xDA, 0x93, 0x2F, 0xC4, 0x98,
+    0xDD, 0xF4, 0x6B, 0x9B, 0xD9, 0xAB, 0x3E, 0x6E, 0x96, 0x57, 0x5F, 0x0D, 0xED, 0x94, 0xAB, 0xDA,
+    0xAE, 0xF2, 0x8E, 0x2D, 0xF2, 0x8E, 0x2D, 0x0E, 0x37, 0x64, 0x61, 0x9B, 0xDA, 0x86, 0x7C, 0x10,
+    0x3A, 0x19, 0x8E, 0x3C, 0x7B, 0xE9, 0x93, 0xC8, 0x5A, 0xEC, 0xCE, 0x90, 0x8E, 0xA5, 0x77, 0xD5,
+    0x64, 0x42, 0x1E, 0x36, 0x70, 0x4F, 0x77, 0xE9, 0x14, 0xB1, 0x6A, 0x68, 0x07, 0x8C, 0xC0, 0x05,
+    0x92, 0x09, 0x0A, 0x8F, 0x89, 0x1C, 0x55, 0x93, 0x2A, 0x50, 0x4E, 0xA4, 0x33, 0x90, 0x7C, 0xE7,
+    0x02, 0xB9, 0x04, 0x52, 0xE0, 0xD0, 0xE9, 0x4F, 0xB4, 0x7F, 0xF7, 0x8F, 0xB9, 0x7B, 0x4B, 0x0D,
+    0xB5, 0xE2, 0xF6, 0xA5, 0x1F, 0xED, 0xEF, 0xE7, 0x73, 0x6F, 0x9A, 0xAC, 0x73, 0x50, 0xAB, 0xC7,
+    0x28, 0x42, 0x3E, 0x7F, 0x1C, 0x70, 0x1A, 0x01, 0xE7, 0x21, 0x9B, 0x81, 0x36, 0x80, 0x55, 0x45,
+    0x72, 0x6B, 0x04, 0x77, 0xD2, 0x93, 0x85, 0x19, 0xDA, 0x2C, 0x60, 0x3B, 0x57, 0x25, 0xD1, 0x8C,
+    0x38, 0xC9, 0x1B, 0x69, 0xA2, 0x95, 0x82, 0x95, 0x94, 0xCC, 0x64, 0xA3, 0xEB, 0xA8, 0x77, 0xE2,
+    0x22, 0x94, 0xCA, 0xE3, 0x63, 0xA9, 0xC1, 0xAA, 0x4F, 0x55, 0x7D, 0x31, 0xC0, 0x5F, 0x02, 0x18,
+    0xC7, 0xB2, 0x66, 0x51, 0xB7, 0x6A, 0xF6, 0xFE, 0x3D, 0x0D, 0x69, 0x7B, 0x1D, 0xA9, 0x9A, 0xDB,
+    0xFE, 0x58, 0x3A, 0x96, 0xD4, 0x79, 0x63, 0x77, 0x3A, 0x13, 0xAE, 0x24, 0xB1, 0x94, 0x8C, 0xD4,
+    0xB5, 0x1A, 0x0E, 0x4F, 0x35, 0x14, 0x0D, 0xB6, 0x21, 0xF7, 0xA4, 0x6A, 0x70, 0x3D, 0xC9, 0xF3,
+    0xF0, 0x30, 0xB0, 0xB9, 0xC8, 0xFB, 0x34, 0x40, 0x72, 0x6A, 0xFF, 0x21, 0x3D, 0x52, 0x28, 0xD2,
+    0x2A, 0xA6, 0xD2, 0x68, 0x54, 0x91, 0xC7, 0x45, 0x68, 0x17, 0xAB, 0x7D, 0x5C, 0xEE, 0xD2, 0x00,
+    0xC5, 0x5C, 0x7D, 0xCF, 0x4A, 0x63, 0x2E, 0x45, 0x23, 0xC5, 0x44, 0x8A, 0x94, 0x8A, 0x3C, 0x04,
+    0x81, 0xDC, 0xB3, 0x06, 0xA7, 0x96, 0x93, 0xC8, 0x28, 0x94, 0xB7, 0x5F, 0x88, 0xE4, 0x3D, 0x65,
+    0xC5, 0x44, 0x3A, 0x92, 0x0D, 0xF7, 0x5A, 0xF5, 0x85, 0xFA, 0x23, 0xAB, 0xA9, 0x4D, 0xC2, 0xB2,
+    0x02, 0xAD, 0xC0, 0x9D, 0xF3, 0x8C, 0x26, 0x1C, 0x98, 0xF0, 0xBB, 0x85, 0xEE, 0x18, 0xD4, 0x24,
+    0xF2, 0xD9, 0x87, 0xA1, 0xA8, 0x36, 0x57, 0x8D, 0x9F, 0xEB, 0x8D, 0x42, 0x3E, 0x87, 0xC2, 0x53,
+    0x36, 0x94, 0x15, 0xAE, 0xA2, 0x6C, 0x28, 0xBA, 0xCA, 0xAA, 0xCF, 0x34, 0x72, 0xB9, 0x27, 0x89,
+    0xCB, 0xAA, 0x33, 0x2B, 0x4A, 0x7F, 0x72, 0xF7, 0xC1, 0x45, 0xCC, 0x40, 0xD1, 0xD1, 0x36, 0xC9,
+    0x73, 0x00, 0xF7, 0xFF, 0x4A, 0xD6, 0x3D, 0x9B, 0x5C, 0x64, 0x23, 0xEF, 0x29, 0xD4, 0x90, 0x4D,
+    0x2B, 0xED, 0xF5, 0x22, 0x5F, 0x0A, 0xEB, 0x60, 0x23, 0x1D, 0x8A, 0x9B, 0x5D, 0xA6, 0x2A, 0x99,
+    0xE0, 0xCA, 0x5E, 0xF3, 0x8D, 0x95, 0x2F, 0x6F, 0xFB, 0x1A, 0xB6, 0x61, 0x0B, 0x26, 0xD8, 0x86,
+    0xFA, 0x38, 0x4E, 0x4D, 0xA1, 0x3E, 0x5D, 0x34, 0xAA, 0xBC, 0x2B, 0x49, 0x6F, 0xC5, 0x65, 0x83,
+    0x94, 0x1E, 0xEC, 0x41, 0x61, 0xDC, 0xEA, 0x4D, 0x5A, 0xA9, 0x6A, 0xA5, 0xAE, 0xBD, 0xA4, 0xD0,
+    0x62, 0xC7, 0x76, 0xD1, 0x0E, 0xA7, 0x4F, 0x52, 0x3A, 0xB5, 0x9C, 0x8B, 0xAD, 0x14, 0x5B, 0x69,
+    0x6C, 0xA5, 0xD0, 0x4A, 0x7E, 0x51, 0x46, 0x1D, 0x60, 0xFF, 0xBA, 0xC1, 0xBC, 0x17, 0x20, 0x46,
+    0x70, 0x0E, 0xEC, 0x35, 0x5F, 0xBC, 0xF1, 0x61, 0x28, 0x15, 0x29, 0x25, 0xAC, 0x57, 0x93, 0xF9,
+    0xA2, 0x4F, 0x83, 0x19, 0x89, 0xCC, 0x94, 0x55, 0xDB, 0x64, 0x52, 0x8F, 0x34, 0x62, 0x35, 0x43,
+    0xFB, 0x8C, 0xFF, 0x52, 0x75, 0x66, 0xB7, 0x90, 0xD3, 0x84, 0xD3, 0xC4, 0x03, 0xED, 0x73, 0xE0,
+    0x48, 0x66, 0x47, 0x2E, 0x51, 0x4A, 0x38, 0x33, 0xF3, 0x78, 0x32, 0xB3, 0xC9, 0x4C, 0x64, 0x66,
+    0x2B, 0x9D, 0xA9, 0x35, 0xE3, 0x34, 0x63, 0x35, 0x93, 0xCE, 0x35, 0xF0, 0x58, 0x26, 0xA5, 0x52,
+    0x77, 0xE9, 0xC7, 0xA7, 0x0E, 0x30, 0xF4, 0x81, 0x56, 0x27, 0xA5, 0x1D, 0xA9, 0x9F, 0x16, 0xDB,
+    0xAB, 0xC3, 0x0C, 0x24, 0x92, 0xAF, 0x15, 0x0A, 0xC5, 0xEC, 0x16, 0xC9, 0x04, 0x75, 0x45, 0xF1,
+    0x8B, 0x4B, 0x8F, 0x4A, 0xEF, 0x2D, 0xCC, 0x3C, 0x27, 0xF5, 0x70, 0xAA, 0xD4, 0xE8, 0x14, 0xCF,
+    0x5E, 0x7A, 0xEC, 0x93, 0xA7, 0x51, 0xB2, 0x5D, 0xE5, 0xEA, 0xCB, 0x1F, 0x8E, 0xEE, 0xF4, 0x66,
+    0xAD, 0xA9, 0xD5, 0xB4, 0x9A, 0xF1, 0x5F, 0xFC, 0xCC, 0x69, 0xB2, 0x9A, 0x92, 0xB6, 0x07, 0x4C,
+    0x28, 0x91, 0x7C, 0x21, 0x9F, 0xB4, 0xCD, 0x5D, 0x82, 0x45, 0x79, 0x7C, 0x2C, 0x3E, 0x21, 0xA5,
+    0xBF, 0x00, 0x2C, 0x07, 0x45, 0x47, 0x36, 0x90, 0xCE, 0x70, 0xB6, 0xBA, 0x3B, 0xB0, 0xB6, 0xA1,
+    0x05, 0x81, 0xE0, 0xD2, 0xDF, 0x85, 0x5B, 0x7F, 0x8F, 0xCE, 0x6D, 0x43, 0xDE, 0x60, 0x04, 0xB5,
+    0x27, 0x39, 0xF5, 0x79, 0x27, 0x87, 0xAF, 0xC2, 0x1A, 0x8C, 0xF0, 0x51, 0x85, 0x1A, 0xCA, 0xD5,
+    0x0C, 0x65, 0x7D, 0x59, 0xD5, 0x75, 0x95, 0xA9, 0xA2, 0xAE, 0xC8, 0x9B, 0x83, 0xA7, 0xEE, 0x4F,
+    0x35, 0x48, 0xD1, 0x69, 0x5E, 0x00, 0xB2, 0xA0, 0x2D, 0x14, 0x33, 0x29, 0x91, 0x7C, 0x7D, 0x61,
+    0xC5, 0xDD, 0x64, 0xBE, 0xF4, 0x6C, 0x2B, 0x95, 0xD2, 0x55, 0xE9, 0x83, 0xC5, 0x5E, 0x72, 0x44,
+    0xFB, 0x76, 0x30, 0xF2, 0x68, 0x39, 0x88, 0xFE, 0x8E, 0xEB, 0x0A, 0xC8, 0x1B, 0x48, 0x26, 0xA0,
+    0x1E, 0xA0, 0x7C, 0xA6, 0x23, 0xEF, 0x8A, 0x4F, 0x53, 0xED, 0x92, 0xD3, 0x90, 0x2D, 0x87, 0x6D,
+    0x44, 0x92, 0x2F, 0x27, 0xBE, 0x6E, 0x66, 0xA0, 0xF6, 0x2B, 0xEB, 0xB0, 0x6E, 0x20, 0x1F, 0x93,
+    0xFF, 0x55, 0xB5, 0x4D, 0xA1, 0xAB, 0x23, 0x9A, 0x6A, 0x7F, 0xA8, 0x7D, 0x63, 0xC6, 0x0C, 0x6E,
+    0x3E, 0xAD, 0x44, 0x52, 0xC8, 0x25, 0x55, 0xA5, 0xD4, 0x73, 0xBF, 0x2E, 0x40, 0x01, 0xB6, 0xC7,
+    0x4E, 0xD8, 0x9B, 0x9D, 0x6D, 0x36, 0x3E, 0xA6, 0xAA, 0x9D, 0x69, 0xA4, 0x7E, 0x6E, 0xC7, 0x75,
+    0x33, 0x3F, 0x44, 0xFB, 0x54, 0x53, 0x5C, 0xEF, 0xB2, 0xE1, 0x4A, 0x32, 0x95, 0xC7, 0xF5, 0x6D,
+    0xA9, 0x93, 0x06, 0xAB, 0x48, 0xDB, 0x82, 0xF5, 0xDF, 0x2D, 0x7A, 0xA7, 0x60, 0x35, 0x64, 0x1A,
+    0xF7, 0x0E, 0x63, 0x13, 0xCA, 0x0A, 0xA7, 0x40, 0xA2, 0x09, 0x32, 0x7D, 0xAA, 0xCE, 0x7A, 0xDF,
+    0x29, 0xA8, 0x17, 0x25, 0xCC, 0x5B, 0x29, 0xA6, 0xEA, 0x92, 0xC6, 0xF5, 0x90, 0xC5, 0xD5, 0xA0,
+    0xB2, 0x11, 0x68, 0x9B, 0x6F, 0xFC, 0x28, 0x1F, 0x13, 0xC5, 0xB6, 0xB1, 0xBA, 0x11, 0xF9, 0x57,
+    0xB3, 0xEB, 0x71, 0x27, 0xF4, 0xB7, 0x67, 0x42, 0x21, 0x89, 0x56, 0x1A, 0x52, 0x69, 0x26, 0x69,
+    0x6F, 0x2D, 0x42, 0x7A, 0x23, 0xD7, 0x64, 0x34, 0xEE, 0x5A, 0x8C, 0x00, 0xE9, 0xB4, 0x61, 0x35,
+    0xBB, 0xCB, 0xF3, 0xBA, 0x99, 0xAF, 0xA4, 0xF3, 0x95, 0x64, 0x1A, 0x92, 0xE9, 0x4A, 0x32, 0x6D,
+    0x65, 0x53, 0xAD, 0xC9, 0x69, 0xB2, 0x8A, 0xE9, 0x1C, 0x21, 0x7E, 0x3D, 0x1B, 0x9D, 0x82, 0x53,
+    0x57, 0xAB, 0xE1, 0x31, 0xE0, 0x7B, 0x80, 0xED, 0x80, 0x79, 0x65, 0x68, 0xA7, 0xE2, 0x1F, 0x6C,
+    0x38, 0x65, 0x83, 0x6B, 0x70, 0x1E, 0xE7, 0x79, 0xA0, 0xB9, 0x0B, 0xC3, 0x31, 0x5A, 0x1C, 0x5F,
+    0x2B, 0x1D, 0xCD, 0x43, 0x3E, 0xAE, 0xCC, 0xD9, 0x22, 0x7C, 0xA6, 0x59, 0xF1, 0xE5, 0x2C, 0xC2,
+    0xB3, 0x17, 0xA8, 0x3B, 0x6A, 0x4F, 0xED, 0x69, 0x2B, 0x44, 0x22, 0x92, 0xD3, 0x7F, 0xBF, 0xF1,
+    0x65, 0x7E, 0x31, 0xA5, 0xDC, 0x08, 0xD3, 0x36, 0x26, 0x14, 0x07, 0xF6, 0xBF, 0xAB, 0x4C, 0xDC,
+    0xA3, 0xC6, 0xC4, 0xFA, 0xD3, 0xC8, 0x9B, 0x58, 0x4B, 0xBB, 0x34, 0xB5, 0xD2, 0xD4, 0xFE, 0xE2,
+    0xA7, 0x53, 0xEB, 0xB3, 0x3D, 0x82, 0x95, 0xB7, 0x41, 0x60, 0xE4, 0xB1, 0xAF, 0x06, 0xD6, 0x88,
+    0x77, 0x3A, 0xDA, 0xDA, 0x47, 0x13, 0x10, 0x57, 0x34, 0xA9, 0x42, 0xEA, 0xD1, 0x3B, 0x81, 0x39,
+    0x19, 0x92, 0xC8, 0xB8, 0xA2, 0x98, 0x46, 0x62, 0x1A, 0x93, 0x98, 0xC6, 0x34, 0xA6, 0x53, 0x1A,
+    0xCD, 0x64, 0xA2, 0xED, 0x10, 0x13, 0x36, 0xD8, 0x0E, 0x31, 0x63, 0x43, 0xD1, 0xA3, 0x4C, 0xD2,
+    0x54, 0x4B, 0x7A, 0x55, 0x52, 0x2C, 0x7A, 0x94, 0x08, 0x1B, 0x0A, 0x69, 0xE1, 0x73, 0x21, 0xE9,
+    0x11, 0x49, 0x43, 0xF9, 0xD1, 0x25, 0x3D, 0x22, 0x8A, 0xA1, 0x0C, 0xC9, 0x72, 0xB3, 0x0B, 0xEA,
+    0x37, 0xD4, 0x53, 0xAB, 0x67, 0x63, 0xFA, 0xD5, 0xC0, 0x92, 0x4F, 0x01, 0x56, 0x9C, 0xB4, 0x1F,
+    0xEC, 0xDC, 0x7C, 0xF7, 0xDD, 0xFD, 0xAE, 0xC6, 0x64, 0xA2, 0xAE, 0x8A, 0x2E, 0x0B, 0x44, 0x1C,
+    0xD6, 0x9B, 0x40, 0xC4, 0x55, 0xB6, 0x33, 0x03, 0x13, 0x75, 0x53, 0xF4, 0xD9, 0x98, 0x8A, 0xD6,
+    0xC3, 0xDA, 0x6F, 0xB6, 0x7F, 0xFA, 0xE1, 0xF4, 0xFC, 0x4A, 0x01, 0x3B, 0x7C, 0x21, 0xEB, 0x76,
+    0x5F, 0xF9, 0xF2, 0xEA, 0x6D, 0x6F, 0x03, 0x60, 0x15, 0x4B, 0x4D, 0x6B, 0x97, 0xFE, 0xEC, 0x53,
+    0xBC, 0x37, 0xAB, 0xB2, 0xA8, 0x20, 0xFB, 0x4B, 0x75, 0xA7, 0xD4, 0xCD, 0xAA, 0xB4, 0x9E, 0xD6,
+    0x73, 0xFA, 0xA2, 0xD3, 0x50, 0x2B, 0x9E, 0xDE, 0xAF, 0x13, 0x7C, 0x1F, 0xD6, 0x0F, 0x96, 0xAD,
+    0xDD, 0xB2, 0x0D, 0x33, 0x88, 0xE2, 0xE5, 0xA9, 0x78, 0x39, 0x5A, 0xBF, 0x94, 0xC9, 0x76, 0x93,
+    0x7D, 0x79, 0x2E, 0x5E, 0x9B, 0xCB, 0xF7, 0xE4, 0x32, 0xDF, 0xEE, 0xC4, 0xA4, 0x2A, 0xCF, 0x8F,
+    0x6E, 0x27, 0x3E, 0xD0, 0x40, 0x72, 0xB1, 0x38, 0x3E, 0x14, 0xC7, 0x87, 0xE2, 0x91, 0xA1, 0x7C,
+    0x64, 0x28, 0xCF, 0x8F, 0xEE, 0x85, 0x61, 0x2D, 0xF7, 0xBA, 0x31, 0x1F, 0xEE, 0x1E, 0xB0, 0x2F,
+    0x7D, 0x30, 0xA9, 0x01, 0x28, 0x6E, 0xBC, 0x3F, 0xD5, 0x76, 0x27, 0x44, 0x67, 0x77, 0x86, 0xC9,
+    0x9D, 0xBC, 0x71, 0x6B, 0xAE, 0x2F, 0xDF, 0x8E, 0xDF, 0x5F, 0x5F, 0x5F, 0x5F, 0x5F, 0xDF, 0xDA,
+    0xDA, 0xDA, 0x9E, 0xE5, 0x3C, 0xEE, 0xE9, 0x80, 0x7D, 0x23, 0x92, 0x8D, 0x2D, 0xC9, 0x54, 0x7A,
+    0xEA, 0x47, 0x03, 0xE5, 0x2B, 0x91, 0x3C, 0xB4, 0xA4, 0xB1, 0xF4, 0x28, 0x0F, 0xB8, 0x17, 0x23,
+    0x36, 0xB4, 0x98, 0xB1, 0xF4, 0xCC, 0x79, 0xC0, 0x9D, 0x8F, 0x14, 0x9D, 0xAA, 0x6C, 0x70, 0x5D,
+    0x12, 0xED, 0x40, 0xBB, 0xD8, 0xC8, 0xA7, 0x8A, 0x40, 0xA9, 0x88, 0xD5, 0x84, 0x59, 0xCC, 0xE9,
+    0x8A, 0xDF, 0x5E, 0x59, 0x30, 0x47, 0xAB, 0xD2, 0xF6, 0x76, 0x27, 0x9A, 0x41, 0x3C, 0x56, 0xEF,
+    0x39, 0x99, 0xBE, 0x46, 0x2C, 0x2A, 0x97, 0x75, 0xF6, 0x85, 0xC1, 0x84, 0x75, 0x62, 0x51, 0xAD,
+    0xE5, 0x9D, 0x7D, 0x62, 0x30, 0xFD, 0x16, 0x63, 0xD9, 0x1C, 0xB3, 0x7D, 0x71, 0x22, 0x66, 0x1D,
+    0x26, 0x60, 0x23, 0x46, 0x24, 0x8B, 0xC0, 0x37, 0x1D, 0xB4, 0x50, 0x44, 0xB2, 0x0F, 0x43, 0x3A,
+    0xEC, 0xF3, 0x5A, 0x2D, 0xF3, 0x97, 0x0D, 0xD0, 0x56, 0xE4, 0x01, 0xB4, 0x78, 0x5A, 0xB4, 0x6C,
+    0xDE, 0x19, 0x6C, 0xBF, 0xB8, 0x02, 0x3A, 0xD2, 0xC5, 0x2B, 0x92, 0x46, 0x70, 0x1E, 0x13, 0xD3,
+    0xAA, 0x6D, 0x9C, 0x06, 0x23, 0x51, 0xAB, 0xCB, 0x34, 0xEC, 0x35, 0x79, 0x0C, 0x5A, 0x52, 0x79,
+    0xFB, 0x56, 0x70, 0x6C, 0xEE, 0x93, 0xCC, 0xB0, 0xB6, 0x5B, 0x36, 0x0E, 0x4E, 0xF4, 0xE3, 0xB0,
+    0x09, 0x9B, 0x10, 0x49, 0x22, 0x45, 0xA4, 0x18, 0x29, 0xEF, 0xC8, 0x41, 0xD7, 0x2F, 0x5E, 0x3E,
+    0xE7, 0x17, 0x49, 0xD7, 0x36, 0xA0, 0x8A, 0xE4, 0x63, 0x27, 0x80, 0xED, 0x6B, 0x6F, 0x7B, 0x55,
+    0xF6, 0x65, 0x61, 0xAF, 0x47, 0xEC, 0xD5, 0x91, 0xE2, 0x66, 0xA0, 0x78, 0xA7, 0xA3, 0x94, 0xA7,
+    0x14, 0x94, 0x33, 0xB8, 0x09, 0x9C, 0x2A, 0x9C, 0x3A, 0x9C, 0x46, 0xEA, 0x67, 0x66, 0xEA, 0xA7,
+    0xD4, 0xD4, 0xE7, 0x15, 0xDA, 0x46, 0xB1, 0xAC, 0xC8, 0xBB, 0x3B, 0xD1, 0x85, 0xBD, 0x50, 0xC3,
+    0x36, 0x6B, 0x2D, 0x85, 0xC8, 0x54, 0x25, 0x6A, 0xA8, 0x07, 0x4A, 0x35, 0xB9, 0xC6, 0xF4, 0x96,
+    0x9A, 0xB6, 0x8C, 0x6E, 0x47, 0xFB, 0x58, 0x7B, 0xA9, 0xA2, 0xEE, 0x28, 0x02, 0x59, 0x24, 0x9D,
+    0x61, 0x51, 0xAB, 0x8E, 0x5E, 0x00, 0x30, 0xD7, 0xC3, 0xB1, 0xC7, 0xCD, 0xB5, 0x66, 0x2D, 0x98,
+    0x89, 0xDA, 0x67, 0x23, 0x6D, 0x9F, 0xAB, 0xB9, 0x22, 0xFB, 0x64, 0xCC, 0x3C, 0xA6, 0x87, 0x01,
+    0x36, 0xE1, 0xBE, 0xE5, 0x98, 0x19, 0x61, 0x1B, 0x5C, 0x83, 0xED, 0x77, 0xA3, 0x21, 0x07, 0x3F,
+    0x54, 0xBB, 0xCA, 0xD2, 0x04, 0xB5, 0x74, 0x4E, 0x7A, 0x55, 0xFA, 0x40, 0x9A, 0x8C, 0x2F, 0x19,
+    0x72, 0x7F, 0xDF, 0x2E, 0xAA, 0x68, 0x82, 0xF5, 0x6B, 0xC9, 0x98, 0xF5, 0x45, 0xB3, 0x9E, 0x0E,
+    0xF9, 0x12, 0x57, 0xCD, 0x3B, 0x57, 0xE9, 0x0D, 0x5D, 0x13, 0x79, 0x04, 0x17, 0x40, 0x0D, 0x66,
+    0x5A, 0x16, 0x43, 0xBB, 0xDC, 0x1E, 0xDA, 0x67, 0x12, 0x94, 0x0D, 0x6C, 0x83, 0x19, 0x57, 0x42,
+    0xBE, 0x81, 0xF9, 0x93, 0x1F, 0x07, 0x28, 0x3A, 0xA8, 0x2B, 0x92, 0x09, 0x32, 0x69, 0x28, 0xA5,
+    0xAE, 0x95, 0x1E, 0x91, 0x26, 0xB3, 0x92, 0x4E, 0x4D, 0xD6, 0x27, 0x23, 0x1B, 0x14, 0x55, 0xDE,
+    0xA5, 0x03, 0x5B, 0x94, 0xCB, 0xCD, 0x84, 0x1B, 0xAD, 0xCC, 0x3E, 0x8E, 0xCA, 0xBB, 0x60, 0x07,
+    0x13, 0x13, 0xD1, 0x36, 0xAE, 0xA3, 0x6C, 0xC8, 0x57, 0x1C, 0x48, 0x2E, 0xBA, 0x66, 0xD3, 0xF6,
+    0xCE, 0x8C, 0xD6, 0xCF, 0x26, 0xB8, 0x26, 0xDA, 0x1E, 0x33, 0xEC, 0x69, 0xBA, 0x1D, 0xD9, 0xC2,
+    0x8E, 0x45, 0xD3, 0xED, 0xC8, 0x3B, 0x36, 0x59, 0xED, 0xF9, 0xF0, 0xD8, 0x1A, 0x59, 0xCF, 0x06,
+    0x59, 0xCF, 0x3A, 0x77, 0xFC, 0x69, 0x79, 0xC7, 0x16, 0xB6, 0x43, 0xBD, 0x15, 0x0A, 0x7B, 0xFD,
+    0x1D, 0x6E, 0x66, 0x33, 0xBA, 0x66, 0xB6, 0x7D, 0xBD, 0x33, 0x16, 0xE1, 0xCE, 0x5C, 0x7C, 0x76,
+    0x7F, 0x0E, 0x13, 0x70, 0x98, 0x9E, 0x8D, 0xE2, 0xA5, 0xD7, 0xE3, 0x86, 0x7B, 0xE9, 0x7A, 0xDC,
+    0x7A, 0xE0, 0xA9, 0xFD, 0x5D, 0x4D, 0xD8, 0x19, 0x05, 0xBB, 0x5A, 0xD2, 0xF7, 0x02, 0x14, 0x9E,
+    0xD5, 0xA9, 0x40, 0xDE, 0xB3, 0xB2, 0xF3, 0x58, 0xC2, 0xAA, 0x85, 0x87, 0x74, 0x9C, 0x80, 0xFC,
+    0xED, 0x00, 0xB8, 0xC5, 0xBD, 0x3F, 0xB2, 0x1C, 0x84, 0x60, 0x27, 0x58, 0xE6, 0x72, 0x15, 0x9E,
+    0x30, 0xE3, 0x9D, 0x10, 0x85, 0x2A, 0x20, 0x9F, 0x58, 0xE9, 0xBD, 0x18, 0x75, 0x40, 0x21, 0xA9,
+    0x42, 0xD2, 0x44, 0x7E, 0x5B, 0x1A, 0xA8, 0x2F, 0x4B, 0xDD, 0x12, 0xCD, 0x58, 0x02, 0x1E, 0x82,
+    0x65, 0x51, 0x40, 0x5D, 0xAD, 0x44, 0xCB, 0x9D, 0x2B, 0x82, 0x09, 0x8B, 0x6F, 0x76, 0x6D, 0x71,
+    0x20, 0x64, 0x3D, 0x14, 0x0D, 0x6C, 0x40, 0x7A, 0x7B, 0x20, 0x17, 0xD4, 0x1D, 0xC5, 0x44, 0xA6,
+    0x21, 0xD1, 0x53, 0x1D, 0xF7, 0xBA, 0x0A, 0xD4, 0x2F, 0x87, 0xB7, 0x58, 0x7C, 0x01, 0x2B, 0x97,
+    0x92, 0xE9, 0x57, 0x01, 0xCE, 0x3B, 0x1D, 0x14, 0x81, 0x58, 0x0C, 0x49, 0x2C, 0xC6, 0x24, 0x96,
+    0x31, 0x89, 0xE5, 0x9C, 0xC6, 0x52, 0x69, 0x74, 0x7A, 0x22, 0xBA, 0x77, 0x5E, 0x8C, 0xEE, 0xDA,
+    0x1B, 0xA3, 0xBB, 0xFA, 0xCB, 0xD1, 0x5D, 0xFF, 0x70, 0x74, 0xAF, 0x68, 0xAC, 0x5F, 0xD6, 0x50,
+    0x77, 0x1A, 0xEA, 0xAE, 0x1E, 0xDA, 0xCE, 0x0D, 0x6D, 0x5F, 0x0E, 0x64, 0x1E, 0xDB, 0x50, 0x54,
+    0x38, 0xF8, 0xDA, 0x9D, 0xC6, 0xD7, 0xEA, 0xC6, 0x69, 0x70, 0xB7, 0xA3, 0xAB, 0x36, 0x6B, 0xD6,
+    0x37, 0x58, 0xAF, 0xD9, 0xAE, 0xD9, 0x6E, 0x99, 0x5B, 0xD4, 0x22, 0xA1, 0xBB, 0x86, 0x61, 0x37,
+    0xDC, 0xB2, 0xE7, 0x36, 0x59, 0x49, 0xB8, 0x5D, 0xE9, 0xF6, 0x85, 0x20, 0x21, 0x8F, 0x56, 0x8A,
+    0x5B, 0x3A, 0x63, 0x26, 0xB2, 0x48, 0x72, 0x31, 0xBD, 0xC8, 0x76, 0xB1, 0x48, 0xBD, 0x7C, 0x35,
+    0x35, 0x9C, 0xFA, 0xF8, 0xF9, 0x7D, 0x57, 0x86, 0x73, 0xA4, 0x7A, 0x20, 0x19, 0x6B, 0x0A, 0x91,
+    0x08, 0xCA, 0xEA, 0x63, 0xD3, 0x86, 0x79, 0x6B, 0x44, 0xEA, 0xDC, 0xED, 0x68, 0xBB, 0x32, 0x0B,
+    0xD9, 0xCB, 0x63, 0x32, 0xD4, 0x6C, 0x17, 0xBE, 0x7C, 0x2A, 0xD8, 0xD7, 0xA3, 0x89, 0x2D, 0x72,
+    0xDE, 0x79, 0xB2, 0x40, 0xE1, 0xA9, 0xAB, 0x64, 0xDE, 0x0B, 0xB8, 0xFD, 0x7F, 0x99, 0x9D, 0x22,
+    0x60, 0x14, 0xC8, 0xD4, 0x93, 0xAB, 0xF9, 0x42, 0x10, 0x84, 0x15, 0xE5, 0x44, 0x39, 0x02, 0x24,
+    0xDF, 0x69, 0xB0, 0x9A, 0x48, 0xA5, 0xC0, 0x7D, 0x9F, 0x70, 0x97, 0x7F, 0x29, 0xE1, 0xCC, 0xE4,
+    0x3B, 0x17, 0x9D, 0xC6, 0x5A, 0xF1, 0xF4, 0xA9, 0x03, 0x16, 0xF1, 0xAF, 0x8E, 0xCC, 0x00, 0x58,
+    0xBF, 0x0E, 0xAD, 0x3C, 0x46, 0x23, 0x14, 0xD3, 0xC7, 0x21, 0xDF, 0x3F, 0x83, 0xD5, 0x4C, 0x26,
+    0x45, 0xD4, 0xD4, 0x7D, 0xD9, 0xA1, 0x13, 0x91, 0x6C, 0xAC, 0x2B, 0xDC, 0x02, 0x72, 0x41, 0x9B,
+    0x2C, 0xF8, 0x47, 0x4C, 0xAC, 0xDF, 0x3F, 0xAC, 0x1D, 0x49, 0x63, 0x29, 0xA9, 0x92, 0x14, 0x8C,
+    0x14, 0x39, 0xBC, 0x17, 0xF1, 0xFD, 0x0C, 0xA7, 0xF9, 0xE7, 0x42, 0x5D, 0x78, 0x33, 0xA4, 0x91,
+    0xBA, 0x72, 0x3E, 0x0F, 0xE9, 0xB3, 0x3C, 0xF7, 0x71, 0x06, 0x3B, 0x8D, 0x0B, 0x5C, 0xD7, 0x17,
+    0x63, 0x3A, 0x61, 0x07, 0x1B, 0x28, 0xFA, 0xBA, 0xC2, 0xBD, 0x18, 0xA1, 0xCD, 0x03, 0x49, 0x2C,
+    0x3D, 0x59, 0x68, 0xA1, 0x7C, 0x71, 0x06, 0x65, 0x3A, 0x75, 0x2E, 0x5A, 0x49, 0x7D, 0x29, 0xA9,
+    0x72, 0xAB, 0x28, 0x85, 0xE7, 0xFE, 0xDD, 0x50, 0x1A, 0x35, 0xB6, 0x2B, 0x7D, 0x36, 0xD8, 0x90,
+    0x4E, 0xE9, 0xB3, 0x5C, 0xDA, 0xB7, 0xE4, 0xEF, 0x7F, 0x13, 0xAC, 0x02, 0x66, 0x6E, 0x1B, 0x6A,
+    0x26, 0xF2, 0x2E, 0xEF, 0x99, 0xD8, 0x58, 0x6E, 0xDA, 0xE3, 0x13, 0x99, 0xE4, 0x29, 0x35, 0x82,
+    0x04, 0xC9, 0x76, 0x05, 0x87, 0x16, 0xDF, 0xF5, 0xDA, 0x12, 0xCC, 0xDA, 0x33, 0x62, 0x52, 0x8D,
+    0x94, 0x1A, 0xD3, 0xF7, 0xCF, 0xF8, 0x92, 0x35, 0x13, 0x4C, 0x70, 0x38, 0x13, 0x4C, 0x70, 0xA7,
+    0x67, 0x23, 0xF9, 0x45, 0x09, 0xF3, 0xEE, 0xE5, 0x39, 0x8B, 0x79, 0xA8, 0x7D, 0xFB, 0xED, 0x98,
+    0x8F, 0xB5, 0x6F, 0xAF, 0xC6, 0x7C, 0xAA, 0x7D, 0xDB, 0x73, 0x8A, 0x2B, 0x1C, 0xA3, 0xC4, 0x36,
+    0x90, 0x7E, 0x34, 0xB4, 0xB3, 0xD3, 0xD3, 0x83, 0x19, 0x99, 0x56, 0x46, 0x41, 0x32, 0xD3, 0xFA,
+    0x95, 0xB6, 0x55, 0x06, 0x52, 0x41, 0xD9, 0x63, 0x26, 0x70, 0x9E, 0x7C, 0xDC, 0x8B, 0x6E, 0xDF,
+    0x25, 0x38, 0x20, 0x6F, 0x47, 0x54, 0xD9, 0x90, 0xCE, 0xB8, 0x6E, 0x37, 0x5A, 0x9E, 0xBF, 0xDD,
+    0xB5, 0xB3, 0x55, 0xAF, 0xCA, 0xF6, 0x4C, 0xD8, 0x8E, 0x09, 0xDB, 0x25, 0x33, 0x65, 0x48, 0x85,
+    0x63, 0x93, 0xA9, 0x5E, 0xCE, 0x89, 0x00, 0xC7, 0x0E, 0xC4, 0x9C, 0xD4, 0xA4, 0x52, 0x53, 0x9E,
+    0x8E, 0x69, 0x30, 0xFD, 0x2E, 0x1C, 0x9C, 0x79, 0xFF, 0x4C, 0xEF, 0x14, 0x8D, 0x54, 0x39, 0x45,
+    0x33, 0x15, 0x7D, 0xED, 0xDB, 0x2C, 0xE6, 0x43, 0xED, 0xDB, 0x27, 0x63, 0x1E, 0x5B, 0xDF, 0xDE,
+    0x88, 0xF9, 0xBC, 0xC1, 0x58, 0x5C, 0xED, 0x33, 0x35, 0xC9, 0xBC, 0x18, 0x93, 0x00, 0xE9, 0x47,
+    0x43, 0xAA, 0xD1, 0x68, 0x34, 0x13, 0x66, 0xC4, 0x0C, 0x77, 0x4A, 0x36, 0x92, 0x47, 0xF2, 0xB8,
+    0x88, 0xD3, 0x64, 0x75, 0x52, 0x65, 0xDD, 0x72, 0xF2, 0xED, 0x5E, 0xBF, 0x3D, 0x37, 0xC9, 0x62,
+    0xAA, 0x57, 0xF9, 0x78, 0x78, 0x09, 0x64, 0xAE, 0x22, 0xD7, 0xB9, 0x2E, 0x60, 0x96, 0xA3, 0x36,
+    0x90, 0x2B, 0x42, 0x31, 0x43, 0x3A, 0x67, 0x17, 0x52, 0xD9, 0xF9, 0x8F, 0x67, 0xB7, 0x58, 0xBC,
+    0xE1, 0xB0, 0x3E, 0x5A, 0xAD, 0x62, 0xB0, 0x15, 0x25, 0xAC, 0x2D, 0x96, 0x2C, 0xA9, 0x7A, 0xAB,
+    0x60, 0xAB, 0x53, 0xB6, 0x22, 0xBF, 0x45, 0xAA, 0xC0, 0xFD, 0x11, 0x66, 0xFB, 0xE3, 0xD9, 0x69,
+    0x6A, 0x35, 0x1E, 0x59, 0xA4, 0x96, 0xD9, 0x67, 0x86, 0xCF, 0x9F, 0x34, 0xC3, 0xEF, 0x2A, 0xC8,
+    0x5D, 0xB5, 0x3F, 0x7F, 0x3B, 0x94, 0x55, 0xDC, 0x5D, 0x2C, 0x9F, 0x0F, 0xE7, 0x5D, 0xC0, 0x91,
+    0xEB, 0x23, 0xF8, 0x6F, 0x2B, 0xDD, 0xE6, 0xD1, 0xC5, 0x40, 0x60, 0xFA, 0x55, 0x28, 0x4A, 0x4D,
+    0xAD, 0xC6, 0x52, 0x8D, 0x69, 0xC8, 0x7A, 0x8E, 0x8C, 0xE4, 0x23, 0xB6, 0x07, 0x30, 0x7D, 0xEE,
+    0x99, 0x5C, 0xB5, 0x9B, 0xA7, 0x87, 0xE9, 0x0E, 0xEA, 0x23, 0x77, 0x93, 0x79, 0x50, 0x34, 0x31,
+    0xFB, 0x30, 0x24, 0xF2, 0xD4, 0xF0, 0x20, 0x5F, 0x88, 0x7F, 0x67, 0x2F, 0x5D, 0x7A, 0xAE, 0x95,
+    0xE6, 0x5D, 0xDA, 0x0B, 0x99, 0x7F, 0x51, 0x32, 0x0D, 0x64, 0x17, 0x96, 0x31, 0xDC, 0x73, 0x65,
+    0x79, 0x5F, 0xB8, 0x91, 0xF4, 0x94, 0x15, 0x5B, 0xA4, 0x03, 0xD2, 0x93, 0xD2, 0xD1, 0xF9, 0x27,
+    0x66, 0xC0, 0x7A, 0x1C, 0x44, 0x4C, 0xC0, 0x76, 0xB8, 0x19, 0x45, 0xA3, 0x60, 0xC1, 0x35, 0x5C,
+    0xC6, 0x44, 0x8A, 0x0E, 0xD3, 0xE7, 0x4D, 0x12, 0x6B, 0xA8, 0x57, 0x7C, 0xCC, 0x0E, 0xF2, 0xF1,
+    0xAE, 0x81, 0x27, 0x6D, 0x60, 0x1D, 0xF2, 0x0E, 0x22, 0x3F, 0xB0, 0xBE, 0xAC, 0x62, 0x3A, 0x40,
+    0x59, 0xE1, 0xD4, 0x67, 0x12, 0xBF, 0xFF, 0xD1, 0x45, 0xDC, 0x5E, 0xCA, 0xC0, 0xEE, 0xDB, 0x00,
+    0x6E, 0xC6, 0x28, 0x50, 0xEA, 0x73, 0x21, 0x4A, 0xCE, 0xBC, 0x5F, 0x65, 0x92, 0xCF, 0xB4, 0x92,
+    0x46, 0x9F, 0x89, 0x08, 0xBE, 0x71, 0xC7, 0x8B, 0x61, 0x35, 0x16, 0x8A, 0x47, 0xE7, 0x9F, 0x30,
+    0xD1, 0x2A, 0xB6, 0x8A, 0xA7, 0xE7, 0xC7, 0x88, 0x30, 0x81, 0x46, 0x14, 0x69, 0x23, 0xC0, 0xDA,
+    0x3F, 0x82, 0xF6, 0x4F, 0xE0, 0x97, 0x13, 0x84, 0xF8, 0xA9, 0x8E, 0xC0, 0xD6, 0x67, 0x71, 0x3F,
+    0xD5, 0xCD, 0xC7, 0xC9, 0xC4, 0xBA, 0x31, 0xE3, 0x42, 0xD9, 0xE8, 0x7C, 0x3E, 0xBA, 0x25, 0x2D,
+    0x75, 0x28, 0x97, 0x48, 0x71, 0x97, 0x6A, 0x91, 0xEB, 0xE9, 0x6B, 0x5D, 0x36, 0xF6, 0xF9, 0x7A,
+    0x6F, 0xCF, 0x75, 0xF9, 0xA3, 0xCD, 0x3E, 0x6D, 0x3E, 0x6E, 0x32, 0xED, 0x95, 0x75, 0xA6, 0x75,
+    0xA6, 0x3A, 0x99, 0xDC, 0x5B, 0xB3, 0xD3, 0x5C, 0x68, 0xCE, 0xE6, 0x79, 0xE5, 0xCA, 0x27, 0x93,
+    0x9A, 0x5C, 0x73, 0xF3, 0x65, 0x63, 0xFD, 0x8D, 0x9F, 0x0E, 0x8B, 0x6A, 0x73, 0xD0, 0xEC, 0xF8,
+    0x7C, 0x40, 0xCD, 0x50, 0x56, 0xA9, 0x04, 0x9A, 0xA0, 0x7C, 0xF3, 0x4B, 0x05, 0xFA, 0x59, 0xF1,
+    0xA5, 0xCF, 0x85, 0x35, 0x6F, 0x16, 0x83, 0xE0, 0xE1, 0xB0, 0x18, 0x70, 0x07, 0x3D, 0x36, 0x5F,
+    0x0E, 0xDE, 0xEF, 0x91, 0x88, 0xF4, 0x26, 0xA9, 0x76, 0xA5, 0xE6, 0x17, 0x82, 0xFC, 0x00, 0x47,
+    0x2E, 0x14, 0x9D, 0x19, 0xF3, 0x21, 0x99, 0xD3, 0x89, 0xB6, 0xF9, 0x74, 0xB8, 0x79, 0xA4, 0xF6,
+    0x7B, 0x37, 0x75, 0x93, 0xC5, 0x6C, 0x3C, 0x78, 0x63, 0x62, 0x36, 0xE2, 0x9A, 0xBA, 0x31, 0x63,
+    0x36, 0x52, 0x37, 0xCE, 0xE7, 0xA3, 0x59, 0xA9, 0x60, 0x43, 0x2A, 0x09, 0x2B, 0x75, 0x94, 0x7B,
+    0xFE, 0xA6, 0x07, 0x38, 0x7C, 0xC1, 0xF6, 0x69, 0xCC, 0x46, 0xE6, 0x74, 0xA2, 0xFE, 0x58, 0xCF,
+    0x91, 0x48, 0xEE, 0x6D, 0xC7, 0x26, 0xD3, 0x9D, 0x9B, 0xAC, 0xB3, 0x1D, 0xEB, 0x4C, 0x64, 0xA1,
+    0xE8, 0x70, 0x6F, 0xCD, 0x18, 0xA9, 0xA7, 0xD0, 0x0C, 0xF5, 0x3B, 0xFD, 0x5D, 0x64, 0x6D, 0x5C,
+    0x34, 0x84, 0x44, 0xAB, 0x93, 0xE9, 0xD0, 0x01, 0x7E, 0x6E, 0x31, 0xAD, 0x33, 0x6D, 0x30, 0xD5,
+    0xE9, 0xE4, 0xB4, 0x8F, 0x9F, 0xC9, 0x40, 0xD6, 0x91, 0xFF, 0x77, 0xB2, 0x48, 0xB2, 0xAC, 0xF6,
+    0xC5, 0xD6, 0xCE, 0x03, 0x40, 0x19, 0x01, 0xB6, 0x5B, 0xE0, 0xE3, 0x0E, 0xBD, 0x5D, 0xED, 0xB4,
+    0x81, 0x34, 0xD6, 0x1E, 0x4C, 0x74, 0x9E, 0x25, 0x29, 0x84, 0x7C, 0x28, 0x7B, 0xB0, 0x43, 0x19,
+    0xF2, 0xDE, 0x86, 0x22, 0xD8, 0x50, 0x04, 0x3B, 0x94, 0x43, 0xD9, 0xDB, 0xC1, 0x45, 0xD7, 0xE5,
+    0x63, 0x3B, 0x39, 0x9F, 0x45, 0xA9, 0xF6, 0x99, 0x24, 0x35, 0x46, 0x73, 0xAB, 0xCA, 0x28, 0x3A,
+    0x91, 0x2A, 0x3A, 0x91, 0x68, 0x28, 0x66, 0x50, 0xB0, 0x13, 0xA8, 0xB7, 0x11, 0x08, 0xAB, 0xB8,
+    0x8C, 0x7A, 0x98, 0xB7, 0x21, 0x66, 0xFD, 0x27, 0x33, 0x83, 0x1A, 0xB2, 0x0F, 0x03, 0x66, 0x8C,
+    0x49, 0x35, 0xB9, 0x13, 0xA1, 0xCE, 0x5F, 0x9F, 0xCB, 0x1F, 0x46, 0x5D, 0xEB, 0xDC, 0xC2, 0xB1,
+    0x98, 0x4A, 0x33, 0xF5, 0x6D, 0x55, 0x36, 0xCA, 0x9B, 0xA9, 0x08, 0x7C, 0x3F, 0x79, 0x16, 0xD2,
+    0x1E, 0x92, 0x08, 0x89, 0x3C, 0xC9, 0x14, 0x49, 0xC6, 0xBC, 0xFB, 0xD4, 0x0D, 0x91, 0x0D, 0xD8,
+    0x20, 0xB2, 0xA1, 0xE8, 0x4C, 0x34, 0x31, 0x9D, 0x68, 0x2B, 0x61, 0x43, 0x5B, 0xA5, 0x93, 0xF3,
+    0xB8, 0x77, 0x7A, 0x72, 0x85, 0x25, 0x85, 0xCD, 0xC5, 0x55, 0x36, 0xCC, 0x6E, 0x06, 0xE1, 0x6E,
+    0x4A, 0x61, 0xA2, 0x0A, 0xEA, 0x55, 0x07, 0x57, 0x96, 0x18, 0xAF, 0xAA, 0xF4, 0xD6, 0xC4, 0x56,
+    0x32, 0xDC, 0xF5, 0x44, 0xAF, 0x24, 0x96, 0x0D, 0xAD, 0xED, 0x29, 0x77, 0x22, 0x76, 0x10, 0xE9,
+    0x73, 0x0F, 0x34, 0xFF, 0x10, 0x83, 0x1B, 0x56, 0xE9, 0x3B, 0x1F, 0x4B, 0xD3, 0x4C, 0x24, 0x05,
+    0x27, 0xC5, 0x6C, 0x95, 0x8E, 0xE5, 0x49, 0xD5, 0x91, 0xAA, 0x27, 0x55, 0x4F, 0xA2, 0xB0, 0xA2,
+    0x25, 0x13, 0x70, 0xA1, 0x08, 0x9A, 0x2F, 0x5D, 0x68, 0x97, 0xE4, 0x3D, 0xE5, 0x92, 0x5E, 0x91,
+    0x14, 0x49, 0x2A, 0xD2, 0x3D, 0x5F, 0xE6, 0xDA, 0x7E, 0x4F, 0xAD, 0x64, 0x24, 0x7F, 0xB6, 0xED,
+    0x29, 0x7A, 0x8A, 0x40, 0x11, 0x28, 0x77, 0x4B, 0x21, 0xE5, 0xD2, 0x2B, 0x52, 0x24, 0x0B, 0xAB,
+    0x04, 0xAD, 0x76, 0x95, 0x53, 0x7D, 0xE4, 0xE2, 0x97, 0x00, 0xF3, 0x28, 0xD8, 0x0E, 0x33, 0x92,
+    0xCC, 0xD0, 0xFA, 0x2F, 0x0C, 0x33, 0xBD, 0x90, 0x36, 0xD4, 0x79, 0x4F, 0xA6, 0x7E, 0x71, 0x56,
+    0x67, 0xE1, 0x40, 0x4E, 0x2C, 0x85, 0x24, 0x23, 0xC9, 0xD7, 0xAB, 0xA5, 0x0E, 0xE5, 0xB4, 0x38,
+    0xA3, 0xCB, 0x19, 0x0A, 0xED, 0x52, 0x45, 0xA1, 0x66, 0x45, 0x1E, 0xAB, 0x5F, 0x3C, 0x97, 0x4B,
+    0x7A, 0x51, 0x4B, 0x56, 0xCA, 0x54, 0x4A, 0xF2, 0x45, 0xB3, 0x91, 0xC4, 0x6D, 0x8A, 0x99, 0x64,
+    0x86, 0xF2, 0xE0, 0x32, 0x31, 0x92, 0x97, 0xC2, 0xD1, 0xCB, 0x23, 0xD9, 0x48, 0x16, 0xC9, 0xE2,
+    0xCA, 0x5A, 0xC9, 0x23, 0x99, 0xF4, 0xA2, 0x34, 0xB4, 0x12, 0xD9, 0xAD, 0x62, 0x76, 0xB3, 0x6B,
+    0x1C, 0x0E, 0xC7, 0x1A, 0xF5, 0xC1, 0x57, 0xD5, 0x56, 0xAE, 0x32, 0x23, 0xAE, 0x49, 0x7E, 0xB2,
+    0xFB, 0xEB, 0x0A, 0x1E, 0x87, 0x19, 0xA3, 0xC6, 0xBE, 0xDA, 0xBB, 0x64, 0x04, 0x1E, 0xFA, 0xCD,
+    0xFA, 0x4F, 0xFF, 0xEB, 0xFF, 0x78, 0x37, 0x7E, 0xF7, 0x5F, 0x03, 0x47, 0xDA, 0x58, 0x68, 0x72,
+    0x7A, 0x0E, 0x4E, 0x9F, 0xAA, 0xA5, 0x1D, 0x49, 0xFF, 0x61, 0x25, 0x84, 0xF3, 0xEB, 0x52, 0xA6,
+    0x61, 0x89, 0x40, 0xBB, 0xE2, 0xD5, 0x0F, 0xE6, 0xB3, 0x95, 0xB3, 0x3B, 0x21, 0xD6, 0xC5, 0xD5,
+    0x0F, 0xA6, 0x7B, 0xAD, 0xFF, 0x37, 0x3F, 0xF8, 0xC7, 0x3C, 0x54, 0xBE, 0xB3, 0x31, 0x3F, 0x04,
+    0xAE, 0xCA, 0xFB, 0x6C, 0x60, 0xA6, 0xAD, 0x8A, 0xFE, 0xC8, 0xB3, 0x4B, 0x02, 0x93, 0x4B, 0x46,
+    0xFB, 0x6A, 0x6F, 0xD4, 0x30, 0xC3, 0xE3, 0xD4, 0xD8, 0x2E, 0x99, 0x70, 0x8D, 0x19, 0x11, 0x87,
+    0x2F, 0x26, 0x3F, 0x21, 0x55, 0x16, 0x6D, 0x70, 0x5D, 0xDB, 0xC8, 0x4C, 0x36, 0xDA, 0xD1, 0x0E,
+    0x36, 0x94, 0xBD, 0xEB, 0x9C, 0x07, 0x17, 0x5C, 0x5F, 0xF6, 0x45, 0xB0, 0xC1, 0x8E, 0x59, 0x84,
+    0x23, 0xE6, 0xE6, 0x87, 0x93, 0x3D, 0xD1, 0x7D, 0xF7, 0x98, 0xFD, 0x70, 0x1A, 0x1F, 0x64, 0x7E,
+    0xEE, 0xA4, 0xE2, 0xD9, 0xCB, 0x9E, 0x4D, 0x72, 0xCF, 0xE6, 0x57, 0x4D, 0x37, 0xC4, 0x8D, 0x5F,
+    0x83, 0x6F, 0x6E, 0x0E, 0x9B, 0xDF, 0xA4, 0x48, 0x82, 0x6E, 0x4E, 0xA7, 0x2B, 0xDD, 0x9C, 0xCE,
+    0x1D, 0x0F, 0xF0, 0x15, 0xF3, 0x68, 0xFC, 0xDD, 0x7B, 0x00, 0x8E, 0x28, 0x96, 0x9A, 0x9C, 0x9E,
+    0x3B, 0x7A, 0x62, 0x74, 0xE7, 0x63, 0xED, 0xEF, 0x8C, 0x6A, 0x77, 0x38, 0xB4, 0xAF, 0x28, 0x8B,
+    0x65, 0xA7, 0x2C, 0xBA, 0x7E, 0xDF, 0x6F, 0x46, 0x60, 0xB3, 0x7C, 0xB2, 0xDF, 0xCC, 0x67, 0xD7,
+    0xFF, 0x41, 0xF9, 0xE8, 0xF5, 0x61, 0x72, 0x27, 0xAF, 0x0F, 0xB5, 0x9E, 0xD1, 0x5B, 0xB7, 0x6F,
+    0x8D, 0x1B, 0x1B, 0x45, 0xE3, 0x28, 0x4F, 0x8C, 0xAE, 0x71, 0x6A, 0x8C, 0x1A, 0x5C, 0x43, 0xE6,
+    0xF7, 0x67, 0x0C, 0xA8, 0xB3, 0xAF, 0x4D, 0xB6, 0xCB, 0xBB, 0xF2, 0xDB, 0xCF, 0xBC, 0xFB, 0xB6,
+    0xFE, 0xEA, 0x8D, 0xE9, 0x07, 0x6B, 0xAB, 0x25, 0x30, 0xD5, 0xFA, 0xDB, 0xC7, 0x38, 0x7A, 0x39,
+    0x48, 0x37, 0xA4, 0x0A, 0x0E, 0x3E, 0x72, 0xDF, 0xE9, 0xEF, 0x48, 0xB7, 0x25, 0xCF, 0x57, 0x4D,
+    0x78, 0xB8, 0xB4, 0x3B, 0x9E, 0x53, 0xD8, 0x2E, 0x4E, 0xF6, 0x9A, 0xA2, 0x74, 0x4D, 0x11, 0xA8,
+    0x75, 0x46, 0x37, 0xFE, 0xE6, 0xFD, 0x70, 0x6C, 0xFD, 0xCC, 0x19, 0xDD, 0xD0, 0x90, 0xFF, 0x2C,
+    0xD7, 0xCE, 0xB5, 0xE7, 0xDF, 0xF8, 0x93, 0x6F, 0xBD, 0x05, 0x7C, 0xE5, 0xB7, 0xCA, 0xEA, 0xE1,
+    0x74, 0xF8, 0xE6, 0x5F, 0xEC, 0x5B, 0x02, 0xCF, 0xC7, 0x8D, 0xCD, 0x53, 0x3C, 0x4C, 0xEE, 0x19,
+    0x28, 0x0F, 0x64, 0x04, 0x2E, 0x12, 0xEC, 0xB5, 0x71, 0xA3, 0x78, 0xEA, 0xBD, 0x28, 0xE7, 0xF7,
+    0x86, 0xB9, 0x5E, 0x34, 0x87, 0x7F, 0xBA, 0xAC, 0x9B, 0x69, 0x77, 0xCF, 0xED, 0x45, 0x1A, 0xCB,
+    0xEC, 0xD5, 0x17, 0x3E, 0x08, 0x5B, 0xB1, 0xAC, 0xF3, 0x9B, 0x3B, 0x83, 0xDE, 0x96, 0xE4, 0xEB,
+    0x24, 0x1E, 0xBE, 0x08, 0xF0, 0xCD, 0x64, 0x94, 0xD5, 0xE6, 0x86, 0xDE, 0x7D, 0x57, 0x4F, 0xBE,
+    0x34, 0xF2, 0x30, 0x04, 0xB2, 0x86, 0x07, 0xEF, 0xBC, 0xF7, 0x7B, 0x42, 0x7C, 0x71, 0x7E, 0x5A,
+    0xBF, 0xEB, 0xB7, 0x3E, 0x70, 0x9D, 0xAD, 0x0E, 0x9D, 0x2A, 0xD4, 0x17, 0x41, 0x1A, 0xEA, 0xAB,
+    0xD1, 0x69, 0x76, 0xA1, 0x54, 0x78, 0xE0, 0xE9, 0x3F, 0xBA, 0xB5, 0x72, 0xB9, 0x47, 0xF6, 0x12,
+    0x1C, 0xCB, 0xFE, 0x9F, 0xD6, 0x71, 0x6D, 0x6B, 0x63, 0x63, 0x2A, 0x27, 0xB2, 0x61, 0xAF, 0x66,
+    0xAA, 0xA7, 0xAD, 0x22, 0xEE, 0x3E, 0xD5, 0x34, 0xC5, 0xD3, 0xFE, 0x2B, 0xF7, 0x00, 0xF0, 0x95,
+    0xBC, 0xF1, 0xF7, 0xB2, 0x4A, 0x5D, 0x66, 0xA7, 0x07, 0x7B, 0x62, 0xE0, 0xF0, 0x98, 0x4A, 0xAA,
+    0x16, 0xA7, 0xDD, 0xD1, 0xF9, 0x02, 0xB9, 0x34, 0x31, 0x57, 0xE9, 0x6C, 0x1B, 0x58, 0xFF, 0x3A,
+    0xF0, 0x3B, 0x07, 0x61, 0x7E, 0x9D, 0xD3, 0xA7, 0x4F, 0x7F, 0xE7, 0x96, 0x95, 0xA4, 0x28, 0x69,
+    0xD1, 0xDC, 0x8A, 0x6A, 0xF9, 0x19, 0x90, 0xED, 0x96, 0x78, 0x5D, 0x80, 0xB3, 0x07, 0xBF, 0xE7,
+    0x24, 0x2B, 0x9D, 0xD0, 0xFC, 0xC3, 0xE5, 0x17, 0x36, 0x85, 0x27, 0x0B, 0x24, 0x52, 0x55, 0xAB,
+    0x2B, 0x34, 0xE4, 0x81, 0x34, 0x42, 0x7B, 0xFA, 0xB1, 0x52, 0x7A, 0x54, 0x7A, 0x7D, 0xC9, 0x08,
+    0x5A, 0x05, 0x5D, 0x56, 0x61, 0xEC, 0x27, 0x2E, 0xE9, 0xD2, 0xB3, 0x4B, 0xFE, 0xC5, 0xC4, 0xCA,
+    0x26, 0x9C, 0x01, 0xBB, 0x78, 0xB0, 0x06, 0xAC, 0x5A, 0xBF, 0x84, 0xC6, 0xBB, 0xAC, 0x67, 0xC2,
+    0x61, 0x3B, 0x13, 0x98, 0x68, 0xB1, 0x9D, 0x7A, 0x66, 0x1B, 0xB1, 0xFD, 0x2A, 0xC0, 0x79, 0x08,
+    0x2C, 0x2B, 0x7F, 0xC6, 0xBE, 0x00, 0xE1, 0x92, 0xA9, 0xD3, 0x6A, 0x5E, 0xB2, 0xA0, 0xF6, 0x8A,
+    0x3E, 0x59, 0x2A, 0x54, 0x71, 0x1A, 0xFE, 0x2F, 0xAD, 0x9B, 0x4F, 0xAC, 0x1F, 0xD7, 0x75, 0xDF,
+    0x3F, 0x33, 0xD7, 0xE4, 0x24, 0x9C, 0x58, 0xD7, 0x8B, 0xC8, 0x29, 0xA4, 0xD8, 0x13, 0x14, 0x59,
+    0x38, 0xAA, 0xA4, 0xE9, 0x22, 0x0B, 0x03, 0x21, 0xDF, 0x1D, 0x89, 0x45, 0x05, 0x54, 0x45, 0xC9,
+    0x05, 0x5F, 0x0A, 0xD4, 0x0B, 0x65, 0x11, 0xA0, 0x8A, 0x5B, 0x94, 0x5D, 0x78, 0xA1, 0x02, 0xEF,
+    0xBD, 0x19, 0x99, 0x2D, 0x54, 0x44, 0x0B, 0x12, 0xA8, 0xD3, 0x14, 0xC8, 0x42, 0x5C, 0x28, 0x80,
+    0x4C, 0xA7, 0xA5, 0x9B, 0xBA, 0x05, 0x51, 0xBC, 0xF7, 0xE6, 0x92, 0x0F, 0x01, 0x81, 0x72, 0xC1,
+    0x91, 0x58, 0x57, 0x05, 0x9C, 0x54, 0x63, 0x53, 0x89, 0x52, 0x31, 0x01, 0x2F, 0xA5, 0x61, 0x34,
+    0x14, 0xEF, 0xCC, 0xB7, 0x8B, 0xF9, 0x3D, 0x92, 0xFA, 0xD7, 0xD8, 0x88, 0xE7, 0xCD, 0x3D, 0xBF,
+    0xF9, 0xF3, 0x7E, 0x77, 0xCE, 0xCC, 0xBD, 0x73, 0xCE, 0xF7, 0x7C, 0xCF, 0xF9, 0x71, 0xF2, 0xCF,
+    0x49, 0xA5, 0xCA, 0xCE, 0x6D, 0x57, 0x74, 0x79, 0x70, 0x95, 0x19, 0x6B, 0x92, 0xD7, 0xDA, 0xF5,
+    0x13, 0xB4, 0x9A, 0x90, 0x26, 0x76, 0x81, 0x16, 0x68, 0xBB, 0x3C, 0xD6, 0x52, 0x74, 0xD2, 0x58,
+    0x4A, 0x21, 0x97, 0x3A, 0xDA, 0x19, 0x00, 0xFE, 0xCE, 0xDC, 0x24, 0x92, 0x37, 0x52, 0x95, 0x8F,
+    0x07, 0xB1, 0x3D, 0x4B, 0x1B, 0x20, 0xD7, 0x19, 0x8C, 0x54, 0x21, 0x05, 0x72, 0x45, 0x28, 0x66,
+    0x48, 0xE7, 0xEC, 0x4C, 0x2A, 0x3B, 0xFF, 0xDE, 0xEC, 0xA4, 0x58, 0x4B, 0xE1, 0xA0, 0x3E, 0x04,
+    0xA0, 0x7E, 0xEE, 0xCD, 0xDB, 0xD1, 0xD9, 0xBD, 0x10, 0x9D, 0xBD, 0x36, 0x4C, 0xEE, 0xB9, 0x77,
+    0xEE, 0xCC, 0xED, 0xCD, 0x50, 0x3C, 0xF3, 0xC6, 0xB8, 0xEB, 0x4E, 0x5F, 0x8F, 0xE2, 0xDE, 0x92,
+    0x4C, 0x14, 0x5D, 0x32, 0x51, 0x78, 0x22, 0xF6, 0xBE, 0xE8, 0x98, 0x16, 0x51, 0xF4, 0xC9, 0x4C,
+    0xD1, 0xA7, 0xA2, 0x0C, 0x50, 0x57, 0x14, 0x1D, 0xF9, 0x40, 0x1A, 0x41, 0xE0, 0x3C, 0x36, 0x60,
+    0x46, 0x98, 0xC1, 0x35, 0x14, 0x1D, 0xD9, 0x72, 0xB2, 0x85, 0x72, 0x39, 0x19, 0x7F, 0x36, 0x9D,
+    0x8D, 0x54, 0x49, 0xBE, 0x56, 0x57, 0xA8, 0x03, 0x48, 0xCF, 0x9D, 0x87, 0x4C, 0xDA, 0x17, 0x9D,
+    0xBD, 0x2F, 0x2A, 0xB2, 0xCE, 0xFE, 0x0E, 0x59, 0x67, 0x35, 0x64, 0xDE, 0x2A, 0xE6, 0xBE, 0xA8,
+    0xE6, 0xDC, 0x17, 0x55, 0x9D, 0xFB, 0xA2, 0x72, 0xD6, 0x17, 0x55, 0x6B, 0x7D, 0xA1, 0xB9, 0xF6,
+    0x85, 0x62, 0xDB, 0x14, 0xEA, 0xE6, 0x7B, 0x77, 0xB4, 0xB9, 0x88, 0x27, 0xEF, 0x89, 0xB5, 0x07,
+    0x45, 0x7D, 0xAE, 0x85, 0x5A, 0x52, 0x57, 0x4B, 0x1A, 0x36, 0x71, 0x69, 0xDC, 0xC4, 0x11, 0x37,
+    0x71, 0x4C, 0x9B, 0xB8, 0x24, 0x6E, 0xE2, 0x14, 0x37, 0x71, 0x1A, 0x36, 0x71, 0x6A, 0x7E, 0x0B,
+    0xA0, 0x95, 0xE6, 0x54, 0xD2, 0x98, 0x4B, 0xEA, 0x4B, 0x49, 0x0D, 0x36, 0x00, 0xCE, 0x03, 0x02,
+    0xCC, 0x04, 0xD8, 0x3B, 0xBF, 0x0F, 0x4E, 0x33, 0x48, 0x13, 0x46, 0x4F, 0x45, 0xEC, 0x60, 0x02,
+    0xCE, 0x5B, 0x8F, 0x70, 0x98, 0xC8, 0x84, 0x0D, 0x66, 0xC0, 0x79, 0xDB, 0xA1, 0xCA, 0x35, 0x24,
+    0x01, 0x4C, 0x07, 0x99, 0x07, 0xEB, 0xE1, 0xC0, 0x72, 0x1F, 0xB6, 0xAF, 0xBD, 0xED, 0x55, 0xD9,
+    0xD7, 0x85, 0xBD, 0x16, 0xB1, 0x57, 0x46, 0x8A, 0xB7, 0x02, 0xC5, 0xCD, 0x8E, 0x52, 0x9E, 0x52,
+    0x50, 0xCE, 0xE0, 0x26, 0x70, 0xAA, 0x70, 0xEA, 0x70, 0x1A, 0xA9, 0x5F, 0x99, 0xA9, 0x5F, 0x56,
+    0x53, 0x9F, 0x52, 0x68, 0x1B, 0xC5, 0x83, 0x67, 0x20, 0x1D, 0x57, 0x33, 0xB0, 0xEC, 0xF8, 0xB4,
+    0x65, 0x99, 0xA0, 0x36, 0xB4, 0x94, 0xA1, 0xC6, 0x85, 0x9A, 0x36, 0xD4, 0x28, 0xD4, 0xA9, 0x86,
+    0xDA, 0x68, 0x70, 0xCF, 0xDE, 0x1D, 0xDC, 0xB1, 0x1B, 0xA3, 0x7B, 0xEE, 0xCA, 0xE8, 0xDA, 0x97,
+    0x47, 0xA7, 0x63, 0xA3, 0x93, 0x8D, 0x6E, 0xB2, 0xD1, 0x45, 0x1B, 0xDD, 0x68, 0x63, 0x19, 0x6C,
+    0x04, 0x70, 0x69, 0x30, 0x12, 0x85, 0x3A, 0x4E, 0xF6, 0x1F, 0xBD, 0x4C, 0x7A, 0x96, 0xD7, 0x5C,
+    0x63, 0x2F, 0xC6, 0x24, 0xDA, 0xBE, 0xAC, 0xEA, 0xA3, 0xC1, 0xC4, 0x9A, 0xE2, 0x07, 0x1D, 0x8A,
+    0x64, 0xF2, 0xB8, 0x91, 0x44, 0x60, 0x03, 0xCC, 0x50, 0x78, 0xCE, 0x47, 0x0A, 0x55, 0x89, 0x7A,
+    0x8A, 0xB7, 0xE1, 0x79, 0x1E, 0xA9, 0xAB, 0xFC, 0x66, 0x97, 0xDE, 0x1D, 0xD8, 0x9D, 0x28, 0xDB,
+    0xCF, 0xDE, 0x91, 0x6E, 0x4A, 0x77, 0xA5, 0x19, 0x07, 0xD6, 0x63, 0x02, 0x44, 0x00, 0x0E, 0x35,
+    0x98, 0x61, 0x99, 0xAF, 0xFE, 0x93, 0x4F, 0x22, 0xD9, 0xAD, 0x72, 0xF5, 0xE5, 0x8B, 0xA3, 0x5B,
+    0xDF, 0xAE, 0x35, 0xB5, 0x9A, 0x26, 0xD8, 0x85, 0xFA, 0xDD, 0xFF, 0xE8, 0x34, 0x59, 0x4D, 0x49,
+    0xDB, 0xB3, 0x03, 0xEC, 0xC0, 0x17, 0xD5, 0x53, 0xAB, 0x67, 0x6B, 0x62, 0xE9, 0x7C, 0x52, 0x85,
+    0xD4, 0xA3, 0x1B, 0x81, 0x39, 0x19, 0x92, 0xC8, 0xB8, 0x6A, 0x31, 0x89, 0xC4, 0x34, 0x26, 0x31,
+    0x8D, 0xE9, 0x94, 0x4E, 0x99, 0xCC, 0x54, 0xCE, 0x50, 0x46, 0x28, 0x7B, 0x78, 0x18, 0x36, 0x30,
+    0x3D, 0x05, 0x44, 0x92, 0x2A, 0x95, 0xAE, 0x4A, 0xEE, 0xDD, 0xD7, 0x66, 0xCC, 0x88, 0x0D, 0x38,
+    0x8F, 0x30, 0xF1, 0xDE, 0x66, 0xFA, 0x1A, 0x24, 0x6D, 0x95, 0xAB, 0x2F, 0x9E, 0x1A, 0xD7, 0x78,
+    0xDE, 0x9D, 0xAB, 0x9C, 0x9A, 0x23, 0xE0, 0x78, 0xCD, 0x29, 0x16, 0x1A, 0x33, 0x05, 0xD6, 0x01,
+    0x52, 0xF5, 0x56, 0xC1, 0x56, 0xC7, 0x6D, 0x45, 0x7E, 0x87, 0x54, 0x81, 0x47, 0x23, 0xCC, 0xF6,
+    0x77, 0x66, 0xA7, 0xA9, 0xD5, 0x78, 0x48, 0x0D, 0x50, 0x9E, 0x1A, 0xDD, 0x5E, 0x7C, 0xAC, 0x81,
+    0xE4, 0x6C, 0xF1, 0xD4, 0x50, 0x3C, 0x35, 0x14, 0x4F, 0x0F, 0xE5, 0xD3, 0x43, 0x79, 0x6A, 0x74,
+    0xDE, 0xD9, 0xBD, 0x10, 0xEB, 0xE2, 0xCA, 0x5F, 0x4D, 0xCB, 0x33, 0x3A, 0x4B, 0x51, 0x25, 0xC3,
+    0xBE, 0x48, 0x07, 0xCA, 0x2A, 0x1D, 0x28, 0x1B, 0x33, 0xE2, 0x3C, 0x27, 0x18, 0x89, 0x49, 0x5C,
+    0x3D, 0xD0, 0x13, 0x8C, 0x8C, 0x8C, 0xC9, 0x98, 0x0C, 0xAB, 0xBF, 0x90, 0x86, 0x34, 0x98, 0x90,
+    0x85, 0x3A, 0xD4, 0x7D, 0xEB, 0x21, 0x97, 0xC7, 0x09, 0xC2, 0x61, 0x8C, 0x0F, 0x58, 0xF3, 0x2E,
+    0x87, 0xAD, 0xAA, 0x70, 0xB8, 0x34, 0x3E, 0x1C, 0xB6, 0xE6, 0x52, 0x38, 0x6C, 0xF5, 0x52, 0xEF,
+    0xC6, 0xE2, 0xFE, 0x38, 0x65, 0xCD, 0x2F, 0xF1, 0x42, 0x46, 0xD6, 0x7C, 0x83, 0x17, 0xB2, 0x2A,
+    0xD3, 0x74, 0xBC, 0x96, 0x5E, 0x6A, 0xBE, 0xB1, 0xF9, 0x42, 0xF6, 0xF4, 0x3B, 0xCD, 0x37, 0xD6,
+    0x5E, 0xC8, 0x74, 0xB9, 0xA9, 0x87, 0xBF, 0x7E, 0xA8, 0x6E, 0xFE, 0xFF, 0x86, 0x2A, 0xA6, 0x53,
+    0x1A, 0xCD, 0x64, 0x22, 0x16, 0x72, 0x8F, 0xE9, 0x49, 0x03, 0x9C, 0x00, 0x60, 0x74, 0xAC, 0xB9,
+    0xAA, 0x78, 0xCE, 0x67, 0x6F, 0xF9, 0x54, 0x1D, 0x6D, 0x4F, 0x19, 0xB0, 0x33, 0x46, 0x3D, 0xB3,
+    0x70, 0xE5, 0x50, 0x5C, 0x52, 0x63, 0x3B, 0xCC, 0x08, 0x82, 0x47, 0x9A, 0x7B, 0xEA, 0x47, 0xA6,
+    0x98, 0xCE, 0x31, 0x9B, 0xA3, 0x9D, 0x63, 0x39, 0xC7, 0x7A, 0x2B, 0xCE, 0x5B, 0x73, 0xDC, 0xD2,
+    0xB0, 0xA5, 0xBE, 0x96, 0x6F, 0x55, 0xB5, 0xE7, 0xF8, 0x3A, 0xC0, 0x4E, 0xD6, 0x67, 0x9A, 0x70,
+    0x6A, 0x68, 0x3F, 0xE5, 0xED, 0x6D, 0xB1, 0x7B, 0x43, 0x3A, 0x96, 0xDE, 0x55, 0x93, 0x09, 0x79,
+    0xD8, 0xC2, 0x9D, 0xEE, 0xD2, 0x29, 0x62, 0xD5, 0xD0, 0x0E, 0x18, 0x81, 0x0B, 0x24, 0x13, 0x14,
+    0x1E, 0x13, 0x79, 0x44, 0x4D, 0xAA, 0x40, 0x39, 0x91, 0xCE, 0xF0, 0x7C, 0xF2, 0xBB, 0xFE, 0xC9,
+    0x8D, 0xF4, 0x9D, 0x8F, 0x89, 0xEF, 0x6F, 0xD5, 0x7A, 0x47, 0x33, 0x01, 0x0B, 0xCB, 0x1D, 0x67,
+    0x81, 0x4C, 0xF2, 0x85, 0xC4, 0x17, 0xA7, 0x13, 0x64, 0x3D, 0x14, 0x1E, 0x6A, 0x35, 0x89, 0xE4,
+    0xB3, 0x3B, 0xCF, 0xF9, 0xC2, 0x97, 0xD4, 0x6C, 0x30, 0x7F, 0x2D, 0x18, 0xC9, 0x5B, 0x89, 0x42,
+    0x23, 0x85, 0x96, 0xFB, 0x3E, 0x0E, 0x59, 0x80, 0xA2, 0x81, 0x2D, 0x78, 0x6C, 0x7E, 0x15, 0xA9,
+    0x5F, 0xFA, 0xF8, 0x16, 0x89, 0xD4, 0x64, 0x52, 0x53, 0x74, 0x8E, 0xBA, 0xDA, 0x60, 0xCE, 0xEE,
+    0xF5, 0x51, 0x3E, 0xD0, 0x07, 0x40, 0xAE, 0xC5, 0x75, 0xAE, 0x84, 0x11, 0xF2, 0x68, 0x4F, 0xE0,
+    0x6E, 0x44, 0xB0, 0x0A, 0x50, 0x68, 0x80, 0x56, 0x33, 0xC9, 0xB4, 0x5B, 0x63, 0x86, 0xDD, 0xD2,
+    0x67, 0x61, 0xD7, 0xFA, 0x3C, 0xEC, 0xDA, 0xDE, 0xF6, 0xBB, 0x79, 0x28, 0xBB, 0xDD, 0x6C, 0x70,
+    0x7E, 0x36, 0x31, 0x01, 0xA4, 0x68, 0x25, 0x5F, 0x67, 0x21, 0x89, 0x91, 0x4C, 0x24, 0x1A, 0x39,
+    0x72, 0xB7, 0xCF, 0x4F, 0x1F, 0x63, 0x18, 0xC6, 0xC2, 0x3E, 0xBB, 0x17, 0x86, 0x4D, 0x48, 0x5E,
+    0x4D, 0xE7, 0x24, 0x5A, 0xF9, 0xA9, 0xD0, 0xAD, 0x58, 0x5E, 0x51, 0x74, 0x97, 0x34, 0x3A, 0xAF,
+    0xFE, 0x90, 0x66, 0x32, 0xA9, 0xB1, 0x52, 0xE7, 0x42, 0x19, 0x6A, 0x6F, 0x87, 0xB6, 0xCA, 0x46,
+    0x61, 0xE2, 0xBD, 0xD6, 0xE4, 0xB1, 0xFD, 0xD3, 0x93, 0xA3, 0x93, 0x42, 0x29, 0xF5, 0x76, 0xF1,
+    0xF7, 0x70, 0x72, 0x20, 0xA9, 0x30, 0xB3, 0xBD, 0xA4, 0xF7, 0x43, 0x6C, 0x47, 0x97, 0x4F, 0xB9,
+    0x46, 0x5A, 0xA1, 0xF3, 0xA1, 0x66, 0x2A, 0xAB, 0xF2, 0x74, 0x97, 0xFD, 0x68, 0x48, 0xC7, 0xF6,
+    0xA9, 0xA9, 0x90, 0x52, 0xA9, 0x71, 0xF2, 0xC9, 0x6E, 0x75, 0x7F, 0x22, 0xEC, 0x00, 0xD9, 0x04,
+    0xD8, 0x58, 0x43, 0x39, 0xBA, 0x06, 0xE7, 0x9D, 0xA7, 0xAE, 0xCA, 0x0E, 0x51, 0xF4, 0x89, 0xB0,
+    0x21, 0x9D, 0xC8, 0x47, 0x13, 0xC9, 0x62, 0x1E, 0x31, 0x93, 0x1D, 0x49, 0xE7, 0x22, 0x90, 0xC8,
+    0x05, 0x90, 0x7A, 0x90, 0x3C, 0xD4, 0xF2, 0xE0, 0xD4, 0x2C, 0xAE, 0x85, 0x52, 0x80, 0xBD, 0xE7,
+    0x63, 0x9F, 0x04, 0xFB, 0x8E, 0x4F, 0xC7, 0x23, 0xAC, 0x99, 0x90, 0x77, 0x65, 0x15, 0x19, 0x8B,
+    0xC6, 0xEE, 0x0D, 0xEC, 0xD6, 0x18, 0xF5, 0xB8, 0x89, 0x54, 0x9E, 0x62, 0x04, 0x55, 0xF0, 0x08,
+    0xB9, 0x37, 0xEF, 0x29, 0xB6, 0x22, 0xF7, 0x69, 0xE0, 0x04, 0xFC, 0x16, 0x6C, 0xD5, 0x9A, 0x5B,
+    0xCD, 0xAD, 0xE6, 0x5D, 0x68, 0x1F, 0x58, 0xF5, 0xC9, 0xB5, 0x42, 0x15, 0xEB, 0x8B, 0xED, 0xC9,
+    0x3B, 0xCA, 0x93, 0x9A, 0xA4, 0x0F, 0xE6, 0x73, 0xA7, 0x7B, 0x5C, 0xF3, 0x51, 0xDB, 0xB8, 0x6C,
+    0x3E, 0xD6, 0x90, 0x49, 0x5D, 0xAB, 0x29, 0x97, 0xFA, 0x5D, 0xC8, 0x03, 0x07, 0xB4, 0x7E, 0x42,
+    0xD2, 0x55, 0x29, 0xDA, 0x00, 0x2B, 0x47, 0xF3, 0xC0, 0xC7, 0x00, 0xAA, 0x38, 0x74, 0x16, 0xAC,
+    0x3A, 0xCD, 0x16, 0x06, 0x5A, 0x5D, 0x9E, 0x5F, 0xB3, 0x15, 0x23, 0xB6, 0x61, 0xA4, 0x68, 0x00,
+    0x8C, 0x34, 0x38, 0xE9, 0xE8, 0xB4, 0x7E, 0xBC, 0x6C, 0x48, 0x23, 0x94, 0x7E, 0xF9, 0xB8, 0xF9,
+    0x76, 0x2A, 0xF5, 0xE5, 0xAC, 0xA7, 0xA7, 0x34, 0x96, 0xDE, 0x5E, 0x1A, 0xD9, 0x2E, 0x1B, 0x7B,
+    0x69, 0x4C, 0x62, 0xF9, 0x4D, 0x5D, 0x8A, 0xE5, 0x50, 0x5E, 0x1A, 0x01, 0xD4, 0xC9, 0x7F, 0x8F,
+    0xEF, 0xF1, 0xDF, 0xCF, 0x28, 0x8E, 0x47, 0x86, 0x2F, 0x0F, 0x5F, 0x1E, 0xA6, 0x61, 0x04, 0x13,
+    0xAD, 0xBC, 0xAA, 0x2C, 0x96, 0xCA, 0x47, 0xEC, 0xD0, 0x46, 0xE7, 0x29, 0xDE, 0xD3, 0x8F, 0x26,
+    0x28, 0xDF, 0xD4, 0x2B, 0x01, 0xDC, 0x5B, 0x93, 0x2A, 0x68, 0xDB, 0xBB, 0x23, 0x20, 0xC9, 0x43,
+    0x22, 0xCD, 0x40, 0x2A, 0x05, 0x20, 0x93, 0x1A, 0xA0, 0x96, 0x9A, 0xE5, 0x7D, 0x69, 0xA0, 0x95,
+    0xE4, 0xC9, 0x75, 0xF2, 0x7D, 0x79, 0x34, 0xB4, 0x97, 0xE5, 0xAD, 0xBE, 0xA9, 0x5C, 0x5E, 0x31,
+    0x8F, 0xF9, 0x02, 0xCB, 0x4C, 0x58, 0xB0, 0xC7, 0xE2, 0x19, 0xDD, 0xBE, 0x09, 0xCF, 0xDF, 0x90,
+    0xF5, 0xF6, 0x4A, 0xDC, 0xA1, 0x78, 0xE5, 0xFD, 0x9E, 0xB2, 0x3E, 0x0F, 0x4E, 0xC3, 0x6A, 0x9E,
+    0x68, 0x82, 0x4C, 0x23, 0xD4, 0x8A, 0xE4, 0x77, 0x3F, 0x88, 0xB4, 0xA7, 0xDF, 0x8C, 0x36, 0xBA,
+    0x67, 0x27, 0xC0, 0x34, 0xC0, 0x43, 0x00, 0x5F, 0x20, 0xF9, 0x4D, 0x34, 0x1B, 0xCD, 0x07, 0x88,
+    0xA4, 0x81, 0xC2, 0xD7, 0x53, 0xA2, 0x2E, 0x39, 0xD9, 0x63, 0x3B, 0xCA, 0xFF, 0xC0, 0x5C, 0xB7,
+    0xB7, 0xA5, 0xCB, 0x9A, 0x0E, 0xAA, 0x49, 0x06, 0xB2, 0x8E, 0xA2, 0xA2, 0xEC, 0xB6, 0x46, 0x1E,
+    0xE7, 0xB0, 0x1D, 0xEC, 0xC0, 0x06, 0x87, 0x5D, 0x6C, 0x63, 0xDB, 0x7F, 0x99, 0xA2, 0xF9, 0xB5,
+    0x3E, 0xE9, 0xCB, 0xCE, 0x35, 0xB6, 0xAF, 0xBD, 0x19, 0x5D, 0xC7, 0x54, 0x04, 0xDC, 0xB1, 0x80,
+    0xFD, 0xC1, 0x48, 0xF6, 0x41, 0x24, 0x99, 0x27, 0x68, 0xB5, 0x4C, 0xE0, 0x5C, 0x0D, 0x46, 0xDD,
+    0xA2, 0xAF, 0x53, 0x87, 0xD5, 0x8C, 0xB9, 0xA3, 0x3E, 0x99, 0xCB, 0x99, 0xFA, 0x94, 0x6E, 0x97,
+    0xBD, 0x93, 0x87, 0x24, 0x00, 0x1B, 0xC0, 0xE2, 0x6F, 0xEC, 0x31, 0x6F, 0x8B, 0xA6, 0x70, 0x14,
+    0x9B, 0x94, 0x23, 0x65, 0xC0, 0xF5, 0xB8, 0x80, 0x8B, 0xAC, 0xA9, 0x5A, 0x73, 0xDD, 0x56, 0x31,
+    0xC3, 0x43, 0xAB, 0x9B, 0x5C, 0x3D, 0x3E, 0xD7, 0x59, 0x4F, 0xDD, 0x58, 0x8F, 0xB0, 0x3E, 0x9D,
+    0x29, 0xAE, 0x3E, 0x13, 0x29, 0xAE, 0x1E, 0x1B, 0x28, 0xAE, 0x9E, 0x0C, 0x94, 0x57, 0xDB, 0x8E,
+    0x52, 0x6A, 0x16, 0xE1, 0xA4, 0x0E, 0xF7, 0x4A, 0x3D, 0xE2, 0x5E, 0x39, 0x36, 0xE3, 0xFE, 0x4D,
+    0xA6, 0xC6, 0x35, 0x89, 0x7A, 0xD7, 0xD0, 0x8E, 0x8F, 0x55, 0x3C, 0xF6, 0x6D, 0xC0, 0xF8, 0xAC,
+    0x3B, 0x4C, 0x34, 0xBE, 0xAC, 0x0E, 0xBF, 0xD9, 0x67, 0xFF, 0x27, 0x52, 0xAB, 0xCA, 0x34, 0xB0,
+    0x73, 0xB3, 0xCF, 0xFF, 0xA4, 0x6E, 0xB6, 0x93, 0xD9, 0xFA, 0x3C, 0xDA, 0xBE, 0xF6, 0xC5, 0xA0,
+    0xAA, 0x9E, 0xE7, 0xBF, 0x11, 0x72, 0x4C, 0x07, 0x52, 0x69, 0x09, 0x38, 0xE2, 0x32, 0x37, 0xAC,
+    0x5F, 0x66, 0x45, 0x9C, 0x31, 0x37, 0x02, 0x85, 0xA0, 0x1E, 0x48, 0xD4, 0x90, 0xA9, 0xA2, 0x54,
+    0x43, 0xAB, 0x26, 0xBD, 0xA3, 0x26, 0x7F, 0x4F, 0xDE, 0xED, 0xC9, 0x4B, 0x2F, 0xCA, 0x68, 0xB6,
+    0xC3, 0x81, 0xAF, 0x0D, 0xB5, 0xC7, 0x5E, 0x8B, 0xE0, 0xCA, 0x9E, 0x64, 0x12, 0x64, 0x77, 0x07,
+    0x28, 0xE5, 0xA1, 0x8D, 0x60, 0xD4, 0x83, 0x55, 0xB5, 0xB2, 0x39, 0x52, 0x85, 0x91, 0x1A, 0x8A,
+    0x77, 0xD4, 0x50, 0xBF, 0xAC, 0x26, 0x99, 0xAD, 0x7C, 0x3E, 0x5A, 0x79, 0x85, 0xF8, 0x58, 0xDC,
+    0xE6, 0xC9, 0x2D, 0x6C, 0x8B, 0x51, 0x85, 0x3C, 0xCE, 0x63, 0x47, 0x32, 0x35, 0xC9, 0x07, 0x23,
+    0xDB, 0xB5, 0x2F, 0xF3, 0xE8, 0x2A, 0x13, 0x6D, 0x87, 0xCC, 0x88, 0xF3, 0x33, 0x36, 0xB8, 0xC6,
+    0xC4, 0xA2, 0x47, 0xD9, 0x88, 0xBB, 0x38, 0x63, 0x43, 0xDD, 0x98, 0x58, 0x04, 0x94, 0x49, 0xBA,
+    0x28, 0x69, 0xA8, 0xA5, 0xA9, 0x90, 0xF4, 0xEC, 0x7C, 0xAE, 0x7D, 0x43, 0x14, 0x43, 0xEB, 0x33,
+    0x9D, 0x0C, 0x89, 0x3A, 0x48, 0x86, 0x55, 0x78, 0x71, 0xA8, 0xDA, 0x48, 0xC2, 0x46, 0x32, 0x2C,
+    0xEB, 0x76, 0x32, 0xEC, 0x24, 0x43, 0xAB, 0xA1, 0xD5, 0xD8, 0x6A, 0xDC, 0x4D, 0xC7, 0x9D, 0x34,
+    0xEE, 0xA6, 0x13, 0x3C, 0x01, 0x4F, 0xB8, 0xCA, 0x48, 0xE3, 0x84, 0x95, 0xAE, 0x8F, 0xB8, 0xEF,
+    0xAF, 0x1F, 0xEB, 0x11, 0xD4, 0x8D, 0x89, 0x24, 0x33, 0x36, 0x90, 0x8D, 0x38, 0x4F, 0xF1, 0xC0,
+    0x61, 0x9D, 0x3B, 0x1F, 0xC8, 0x24, 0x79, 0x0A, 0x49, 0x50, 0x4B, 0x13, 0xA9, 0xA4, 0x81, 0x3C,
+    0x52, 0x77, 0x94, 0x21, 0x51, 0x45, 0xEB, 0xB3, 0x89, 0x54, 0x14, 0x03, 0x6C, 0xA0, 0x79, 0x23,
+    0x99, 0xBF, 0xBD, 0x91, 0x0C, 0x6C, 0x24, 0x03, 0x9B, 0xAB, 0xB6, 0x93, 0x0C, 0xB4, 0x1A, 0xEF,
+    0xB5, 0x9D, 0x74, 0x64, 0x37, 0x1D, 0x57, 0x68, 0x57, 0x52, 0x45, 0x26, 0xCD, 0x50, 0x48, 0x23,
+    0xD4, 0xB8, 0x9E, 0x24, 0xA2, 0x86, 0x2C, 0x98, 0x19, 0x0A, 0x6F, 0x23, 0xD4, 0xB8, 0xBB, 0x77,
+    0x92, 0x88, 0x34, 0x65, 0xC1, 0xE8, 0x6E, 0x2C, 0xBC, 0x8D, 0x69, 0xAC, 0x71, 0xBD, 0xB9, 0x15,
+    0x51, 0x63, 0x2F, 0x07, 0x33, 0xE3, 0x0A, 0x6F, 0xC7, 0x24, 0xD6, 0xB8, 0xBE, 0xBD, 0x15, 0xD1,
+    0x25, 0x3D, 0x13, 0x8C, 0xF2, 0x07, 0xC3, 0x00, 0x2D, 0xD1, 0xD1, 0x0C, 0x73, 0x3A, 0xC3, 0x9C,
+    0x7C, 0x8A, 0x48, 0xEF, 0x0B, 0xCD, 0xD5, 0x9C, 0x4A, 0xFD, 0x7A, 0xAA, 0x9B, 0x03, 0xE9, 0x94,
+    0x46, 0xD2, 0x48, 0x24, 0x1D, 0xD9, 0xDE, 0x17, 0x49, 0x24, 0x8D, 0x45, 0x24, 0x8D, 0xC5, 0x40,
+    0x1A, 0x8B, 0x33, 0x0F, 0xE2, 0xF9, 0xB3, 0x40, 0x1E, 0x0F, 0x9E, 0xC1, 0xAA, 0x50, 0x65, 0x25,
+    0x0D, 0xF9, 0x54, 0x74, 0xBB, 0x26, 0x5A, 0x6F, 0x2F, 0x46, 0x13, 0x4C, 0x5F, 0x27, 0x63, 0x3A,
+    0x94, 0x7E, 0x2B, 0x89, 0x79, 0x28, 0x2E, 0xCE, 0xC9, 0x94, 0xDD, 0xD1, 0x77, 0x5D, 0x27, 0x4D,
+    0x56, 0xAD, 0xE4, 0x25, 0xA9, 0x2B, 0x24, 0x55, 0x9C, 0x7C, 0x7B, 0xBF, 0xE3, 0xC2, 0x83, 0xBB,
+    0x35, 0x53, 0xDE, 0x55, 0x28, 0x2E, 0x0D, 0x9B, 0xB9, 0x1F, 0xEC, 0xD1, 0xB0, 0x61, 0xFC, 0x58,
+    0xA4, 0x61, 0x2D, 0x7B, 0x63, 0xB4, 0x17, 0x67, 0x7D, 0x73, 0x72, 0x0A, 0x4E, 0x8A, 0x99, 0xF4,
+    0x36, 0x8F, 0xEE, 0x2B, 0x96, 0xB4, 0x23, 0x85, 0x22, 0xAD, 0x62, 0x2A, 0x8D, 0x46, 0x15, 0x79,
+    0x5C, 0xFC, 0x4F, 0x11, 0x96, 0x56, 0xEE, 0xB7, 0x01, 0xEC, 0x5C, 0x3D, 0x6F, 0xA5, 0x31, 0x93,
+    0xA2, 0xD1, 0xF2, 0x3D, 0x4A, 0x45, 0xD8, 0xFF, 0x67, 0x0F, 0x70, 0x70, 0x46, 0x31, 0x9F, 0xBF,
+    0x5B, 0x93, 0x8E, 0xE4, 0x1D, 0xAE, 0xA1, 0x25, 0x99, 0x7F, 0xC6, 0x28, 0x66, 0x1A, 0x1F, 0x51,
+    0x53, 0xFB, 0x64, 0x02, 0x70, 0x92, 0xAC, 0xA4, 0x3D, 0x49, 0xE1, 0xDC, 0xF9, 0x77, 0x5F, 0x23,
+    0x1B, 0x20, 0x99, 0x80, 0xBA, 0x82, 0xA2, 0xE3, 0x63, 0x07, 0x7A, 0xC8, 0x47, 0x48, 0x67, 0xA0,
+    0x6D, 0x96, 0x90, 0x25, 0x57, 0x43, 0xAA, 0x1E, 0x18, 0x81, 0x35, 0xE0, 0x50, 0x45, 0xAD, 0x58,
+    0x2B, 0xFE, 0xCA, 0xCE, 0xF3, 0x6C, 0x70, 0x7F, 0xDD, 0x86, 0x1D, 0xD8, 0x81, 0x5D, 0x68, 0x1B,
+    0x4C, 0x83, 0x69, 0xEA, 0x0A, 0xD9, 0x40, 0xFD, 0xD4, 0x84, 0xF3, 0xCE, 0x97, 0x5D, 0x3E, 0xD8,
+    0x80, 0xF2, 0x81, 0xF2, 0x5A, 0xC4, 0xCC, 0xF3, 0x62, 0xB7, 0x0B, 0x35, 0x18, 0x79, 0xA8, 0x57,
+    0x54, 0x88, 0x99, 0x58, 0x30, 0x85, 0xEB, 0xA0, 0x18, 0x56, 0x90, 0x07, 0x6C, 0x97, 0xBF, 0x17,
+    0xCD, 0xE0, 0x92, 0x68, 0xFB, 0xDD, 0x24, 0xBA, 0xCA, 0x3D, 0xE7, 0xED, 0x8D, 0x3E, 0xD1, 0x80,
+    0x8B, 0xE4, 0x33, 0xC9, 0x7D, 0xB6, 0xE2, 0x1E, 0x75, 0xB1, 0xAF, 0xC4, 0xD3, 0x8B, 0x12, 0xC5,
+    0x4A, 0x89, 0x6C, 0xBC, 0xAF, 0x84, 0x16, 0x25, 0x12, 0x49, 0x55, 0x2D, 0x75, 0x07, 0x9E, 0xBB,
+    0x73, 0xFC, 0xD3, 0x95, 0x78, 0x98, 0x03, 0x47, 0xC7, 0x74, 0x2C, 0xBC, 0xAB, 0xA6, 0x2C, 0xE4,
+    0xFD, 0x4C, 0x6D, 0xBD, 0xB9, 0x1D, 0x29, 0xDB, 0x26, 0x51, 0xC0, 0x0A, 0xDA, 0x2E, 0x97, 0x62,
+    0x2B, 0xFD, 0xD1, 0xD7, 0xA6, 0x13, 0x38, 0x8F, 0x89, 0xF0, 0x58, 0x83, 0xF3, 0xB4, 0xD9, 0x40,
+    0x4D, 0x8B, 0x6B, 0x6C, 0x70, 0x3E, 0x9D, 0x8A, 0x0E, 0xF7, 0x56, 0x20, 0x53, 0x00, 0x8D, 0x60,
+    0x23, 0x18, 0x41, 0xAA, 0x9E, 0x44, 0x71, 0xC1, 0x69, 0x7A, 0x6B, 0xA4, 0x7E, 0x43, 0x95, 0xEB,
+    0x5D, 0x70, 0xC1, 0xCE, 0xE5, 0x68, 0xD4, 0xDD, 0x1F, 0x11, 0xDB, 0x70, 0x84, 0xED, 0x22, 0x09,
+    0x76, 0xAF, 0xCF, 0x6E, 0xFA, 0x54, 0x15, 0x33, 0xCC, 0xA4, 0xAA, 0x32, 0x79, 0x7B, 0xA5, 0x77,
+    0xA7, 0x86, 0xD6, 0xC4, 0x65, 0x44, 0xA4, 0xE8, 0x8C, 0x14, 0xE2, 0xA1, 0xF3, 0x1F, 0x9E, 0x0A,
+    0x94, 0x8D, 0xF5, 0xEC, 0xE2, 0x48, 0x47, 0x22, 0x79, 0x6F, 0x3E, 0xFB, 0x50, 0x2B, 0x0D, 0xA9,
+    0xA4, 0x2E, 0x97, 0x54, 0x95, 0xD2, 0x04, 0x98, 0x01, 0xB0, 0x1D, 0xE0, 0x2A, 0xE0, 0x84, 0xD3,
+    0x15, 0xA4, 0xC3, 0xD8, 0x2A, 0x70, 0xC4, 0x78, 0x06, 0x8B, 0xE9, 0xEE, 0xEF, 0x4A, 0xF7, 0xF0,
+    0x3E, 0x6C, 0x2C, 0x3E, 0x38, 0x6D, 0x80, 0x3C, 0xE4, 0xA1, 0xA5, 0xCE, 0x43, 0x16, 0xB6, 0x70,
+    0x59, 0x6F, 0xC2, 0x16, 0xCE, 0xF4, 0x59, 0x70, 0x4F, 0x29, 0x95, 0x82, 0x95, 0x78, 0xE4, 0xF7,
+    0x02, 0xD4, 0x4B, 0x78, 0xB1, 0xFA, 0x70, 0x61, 0x3F, 0xF2, 0x59, 0x8E, 0x5C, 0xC8, 0x5F, 0xF6,
+    0xE3, 0x85, 0xFC, 0xE5, 0xE6, 0xC2, 0x0B, 0xF6, 0xA5, 0x8B, 0xA3, 0x53, 0xB3, 0xBB, 0x42, 0x74,
+    0x79, 0x43, 0x4B, 0x1E, 0x28, 0x16, 0xBF, 0xBF, 0xC6, 0xF6, 0x11, 0xB6, 0x8F, 0xB0, 0x7D, 0x98,
+    0xED, 0xC3, 0x67, 0xE3, 0xC6, 0x10, 0x37, 0x6E, 0x47, 0x77, 0x37, 0x3A, 0xC5, 0x42, 0x3B, 0xD9,
+    0xB4, 0xC9, 0xB0, 0xC9, 0xB0, 0xC9, 0xF1, 0x4D, 0xD8, 0xFC, 0x8D, 0xCF, 0x7D, 0xF7, 0xF1, 0xEF,
+    0x3E, 0xFE, 0x67, 0x4F, 0xDC, 0x38, 0xA2, 0xCD, 0x76, 0x72, 0x7F, 0x69, 0xBF, 0x94, 0x7F, 0x89,
+    0x2F, 0x01, 0x65, 0x45, 0xDE, 0x91, 0x0E, 0xB0, 0x0B, 0x65, 0x43, 0xDE, 0x93, 0x8E, 0x20, 0x75,
+    0x4E, 0xB3, 0x55, 0xBB, 0x17, 0xD3, 0x61, 0x66, 0xD3, 0x55, 0xC5, 0xE9, 0x2E, 0xBB, 0x3E, 0xA6,
+    0xE3, 0x4C, 0xEB, 0x9A, 0xF2, 0x7F, 0x9C, 0x3D, 0x74, 0xF6, 0xFE, 0x57, 0x27, 0xF6, 0xC9, 0x8B,
+    0x0F, 0x26, 0xA4, 0xDE, 0xDD, 0x8D, 0xB6, 0x2F, 0x9E, 0x09, 0xE6, 0x87, 0x91, 0xB1, 0xC6, 0x95,
+    0xDE, 0x5E, 0x09, 0xD9, 0x7B, 0x31, 0x8D, 0x6D, 0xD5, 0xBA, 0xCE, 0x79, 0xE0, 0x8B, 0x15, 0x2C,
+    0x93, 0x86, 0x5A, 0x03, 0x98, 0x29, 0x0F, 0x2D, 0xA5, 0xCF, 0x7F, 0x14, 0x99, 0x1F, 0x3E, 0x79,
+    0x45, 0x5A, 0xBD, 0xFC, 0x8B, 0x9B, 0xD3, 0x80, 0x99, 0x8E, 0xB3, 0x40, 0x60, 0x28, 0xEF, 0xF0,
+    0x8B, 0xE0, 0xA4, 0x00, 0xAD, 0xE4, 0xA1, 0x95, 0x80, 0x52, 0x3D, 0x90, 0x54, 0x40, 0x79, 0x06,
+    0xDC, 0x9C, 0x54, 0x2E, 0xBB, 0x14, 0x8A, 0xEA, 0x42, 0xBB, 0xEA, 0xCE, 0x27, 0xF3, 0x89, 0x05,
+    0x1A, 0xE4, 0xB7, 0x33, 0x92, 0xC5, 0x75, 0x05, 0x68, 0x7B, 0xE0, 0x8B, 0x67, 0x80, 0x4C, 0x03,
+    0xD0, 0x6A, 0x80, 0x6C, 0xCA, 0x43, 0x8B, 0xF3, 0xF9, 0x0F, 0x25, 0x49, 0x97, 0x25, 0x49, 0xCF,
+    0x48, 0xD2, 0x04, 0xFA, 0x9D, 0x0A, 0xD2, 0x08, 0x90, 0x47, 0x80, 0x62, 0xAE, 0x9E, 0x00, 0x27,
+    0x0D, 0x2C, 0x38, 0x09, 0x27, 0x55, 0xF0, 0xA8, 0xDE, 0x06, 0xB2, 0x8E, 0x7B, 0x48, 0x6D, 0x63,
+    0x3F, 0xCE, 0xA4, 0x6C, 0xA0, 0x9E, 0x0E, 0x54, 0x2E, 0xDB, 0x0B, 0x25, 0x63, 0x2B, 0xA9, 0x90,
+    0xE4, 0x93, 0x0F, 0xD7, 0x57, 0xAF, 0xC6, 0x90, 0x91, 0x4A, 0x9E, 0x52, 0x81, 0xA4, 0xED, 0x21,
+    0xAF, 0x20, 0xED, 0x80, 0xE3, 0x9F, 0xC5, 0x9F, 0xDE, 0x87, 0x77, 0x9B, 0x0B, 0x27, 0xE8, 0x59,
+    0x01, 0x5F, 0x28, 0x26, 0xFE, 0xFA, 0xC5, 0x44, 0x3B, 0x67, 0x91, 0x22, 0xB4, 0xBD, 0x2A, 0xF4,
+    0xEC, 0x54, 0xF4, 0x64, 0xB1, 0xBE, 0x16, 0xA1, 0x7C, 0x33, 0xB6, 0x0D, 0xA8, 0x7E, 0x2B, 0x40,
+    0x7E, 0x77, 0x9E, 0x16, 0x3B, 0xBD, 0x20, 0xFB, 0x00, 0xE4, 0x9A, 0x01, 0x6A, 0x75, 0x40, 0x21,
+    0x55, 0x90, 0x4B, 0x13, 0xA4, 0x92, 0x46, 0x68, 0xEF, 0xCE, 0xEA, 0x71, 0x73, 0x7D, 0x45, 0x8D,
+    0xD5, 0x4B, 0x93, 0x93, 0x51, 0x68, 0x3B, 0xED, 0xF3, 0x30, 0xE9, 0x50, 0x34, 0x90, 0x48, 0x15,
+    0xB0, 0xF4, 0x55, 0x0E, 0x9F, 0xAD, 0x6A, 0x72, 0xE2, 0xC0, 0xF1, 0x87, 0x2B, 0x13, 0x8B, 0xA1,
+    0xF6, 0x89, 0x8A, 0x20, 0x68, 0x8F, 0xBD, 0x37, 0x81, 0xBB, 0xFA, 0xFE, 0x08, 0xF6, 0xE6, 0xCD,
+    0x00, 0x99, 0xD4, 0xB1, 0x80, 0xB4, 0xC5, 0x52, 0x92, 0x4A, 0x0D, 0x58, 0xA9, 0x87, 0x5A, 0x8A,
+    0xA4, 0xBA, 0x79, 0x57, 0x95, 0xD5, 0xC9, 0xBF, 0x52, 0xEF, 0xA6, 0x72, 0x6C, 0x63, 0xF1, 0xE2,
+    0x9C, 0xF5, 0x4A, 0xC6, 0xB6, 0xDA, 0x75, 0x4D, 0x79, 0xDE, 0xE7, 0x37, 0x7B, 0xA3, 0x80, 0x06,
+    0xDC, 0x84, 0x55, 0x34, 0x1F, 0xEA, 0xF5, 0x29, 0x8B, 0x75, 0x55, 0x3F, 0xD7, 0xD9, 0x1B, 0xC1,
+    0xCC, 0x91, 0xF9, 0x61, 0xEA, 0x26, 0x6D, 0x3D, 0xEA, 0x71, 0x3D, 0x76, 0xDF, 0x8F, 0xDE, 0x1A,
+    0x0A, 0x97, 0x7C, 0xE0, 0x8B, 0x31, 0x15, 0x65, 0x9F, 0xAA, 0x5F, 0x2B, 0x4F, 0xF5, 0x1B, 0x6B,
+    0xE6, 0x5A, 0x7F, 0x84, 0xC2, 0x67, 0x23, 0x9B, 0x0B, 0xC6, 0xE9, 0xEE, 0xB5, 0xC9, 0x76, 0x49,
+    0x5C, 0x5A, 0xFA, 0x60, 0x1B, 0x6D, 0x67, 0xEE, 0xB5, 0xA2, 0x33, 0x43, 0x31, 0x96, 0x43, 0x11,
+    0x5D, 0x28, 0x46, 0xD7, 0x14, 0xC3, 0xF2, 0x7E, 0x94, 0xFD, 0x62, 0xF1, 0x1F, 0xAE, 0x32, 0xF5,
+    0x85, 0x9A, 0x23, 0x6B, 0x49, 0x18, 0xB3, 0xBD, 0xBE, 0xB0, 0xCD, 0xC6, 0x5A, 0x1A, 0xC6, 0x7C,
+    0xAF, 0x7F, 0xD2, 0x5E, 0x1F, 0xDD, 0x31, 0x1F, 0x31, 0x81, 0xB2, 0xB9, 0x87, 0x3F, 0x87, 0x15,
+    0xFE, 0xAC, 0xFF, 0x3A, 0xFC, 0x19, 0x6A, 0x69, 0x2A, 0x1F, 0xC0, 0x9F, 0xE3, 0x03, 0xF8, 0xD3,
+    0x0E, 0xD0, 0x4E, 0x4B, 0x30, 0x63, 0xD5, 0x90, 0xCE, 0xD5, 0x32, 0xEB, 0x87, 0x7B, 0x58, 0x74,
+    0x33, 0x19, 0x36, 0x93, 0x61, 0x27, 0x19, 0x17, 0x2C, 0xDA, 0xEA, 0x1E, 0x16, 0x9D, 0xC8, 0x22,
+    0xF9, 0x48, 0x52, 0xFD, 0x14, 0xB4, 0x1A, 0x5A, 0x9F, 0x4D, 0x65, 0x48, 0xD4, 0x83, 0x1D, 0xF7,
+    0xBD, 0x32, 0x50, 0xFB, 0xE5, 0x11, 0xD9, 0x00, 0xC9, 0x09, 0x36, 0x18, 0xEE, 0x69, 0xB7, 0x99,
+    0x0C, 0x9B, 0xC9, 0xF8, 0xA0, 0x6A, 0xBB, 0xE9, 0xB8, 0x9B, 0x2E, 0xF4, 0xEA, 0x36, 0x44, 0x92,
+    0x91, 0xE4, 0x38, 0x20, 0xDA, 0x99, 0x76, 0x97, 0x76, 0x97, 0x7A, 0x87, 0x7A, 0x93, 0x7A, 0x8B,
+    0xD6, 0x25, 0x72, 0x92, 0x95, 0x92, 0x6F, 0xEB, 0x01, 0xAE, 0x60, 0x8B, 0x64, 0x26, 0x99, 0x49,
+    0xEE, 0x2C, 0xE6, 0xFB, 0xE7, 0x0F, 0x58, 0xB3, 0xD7, 0x84, 0xEE, 0xF0, 0xAF, 0xDA, 0x87, 0xF2,
+    0x3D, 0x05, 0xF7, 0x07, 0x14, 0x14, 0x3E, 0x0B, 0x49, 0x60, 0x83, 0x02, 0xD7, 0xE3, 0xBC, 0x0B,
+    0xB4, 0xDE, 0x0D, 0xC8, 0xBB, 0x31, 0x51, 0xE7, 0xA2, 0x51, 0xE7, 0x66, 0xA3, 0xCE, 0x29, 0x57,
+    0x57, 0xEB, 0x98, 0xBA, 0xBA, 0x7D, 0xE5, 0x66, 0x57, 0xD7, 0x7A, 0xAB, 0xAF, 0x4F, 0xEA, 0xAD,
+    0xBE, 0x7E, 0x4E, 0xAF, 0xF4, 0xF5, 0x31, 0x95, 0x7D, 0xFD, 0xB2, 0xCA, 0xBE, 0x7D, 0x69, 0x76,
+    0x7D, 0x7B, 0x6A, 0x72, 0xA1, 0xBD, 0x14, 0x5D, 0x68, 0x3D, 0x2E, 0x00, 0xD9, 0xBC, 0x9F, 0x08,
+    0x30, 0x11, 0xC8, 0x22, 0x0B, 0x70, 0x5A, 0xAC, 0x6B, 0xB1, 0x18, 0x90, 0x9A, 0xAD, 0x6C, 0xC8,
+    0x43, 0xDD, 0x28, 0x8B, 0x45, 0xA8, 0xAF, 0x2B, 0x53, 0x1D, 0x76, 0x75, 0x33, 0xBF, 0xFA, 0x61,
+    0xD8, 0x56, 0x9D, 0x5F, 0x7E, 0x3F, 0xEC, 0xAC, 0xB9, 0xFC, 0xF5, 0xA3, 0x61, 0xF1, 0x9F, 0x11,
+    0xAC, 0x27, 0x19, 0xA1, 0xAC, 0x76, 0xCB, 0x97, 0x7F, 0x14, 0xDB, 0xE2, 0xF2, 0xAD, 0x58, 0x17,
+    0x97, 0x6F, 0xC5, 0xDA, 0xEE, 0x85, 0xD7, 0x16, 0x3A, 0xB4, 0xDF, 0x5A, 0x6C, 0x83, 0x51, 0x84,
+    0xFC, 0x23, 0xC6, 0xA8, 0xF4, 0x2B, 0x7D, 0xEA, 0x1E, 0x72, 0x01, 0x1A, 0xA0, 0x78, 0xA5, 0xC1,
+    0x0C, 0x11, 0x6A, 0xDB, 0x93, 0x87, 0x1A, 0x26, 0x33, 0x50, 0x78, 0xD7, 0x18, 0x29, 0xE2, 0x56,
+    0xEE, 0x1C, 0x49, 0xA1, 0xE8, 0xA9, 0x4F, 0x4D, 0x64, 0xD1, 0x79, 0x5C, 0xB7, 0x70, 0x92, 0xB5,
+    0x3A, 0x27, 0xFF, 0xE0, 0x95, 0xD2, 0x3B, 0x83, 0xD5, 0xE0, 0xCE, 0x8F, 0x47, 0xD2, 0x71, 0x3B,
+    0x89, 0x17, 0x88, 0x03, 0xF1, 0x42, 0x12, 0x5B, 0x45, 0xA7, 0xA9, 0xD4, 0x74, 0x70, 0xDA, 0xA2,
+    0xCC, 0x3D, 0x66, 0x98, 0xC0, 0x1D, 0xEB, 0xC8, 0xEE, 0xCC, 0x0F, 0x66, 0x07, 0xE2, 0x2A, 0x9F,
+    0x92, 0xCD, 0x40, 0x1B, 0x96, 0x60, 0x30, 0xB9, 0x33, 0x82, 0x3B, 0xE6, 0xC9, 0xC2, 0x0C, 0x6D,
+    0x16, 0xB0, 0x9D, 0xAB, 0x92, 0x68, 0x46, 0xDC, 0x42, 0x9F, 0x4D, 0xB4, 0x0B, 0x0E, 0x50, 0x32,
+    0x93, 0x8D, 0xAE, 0xA3, 0xDE, 0x8B, 0x98, 0xE9, 0xD0, 0x8B, 0xAF, 0x66, 0x61, 0x37, 0x8D, 0xCE,
+    0xEB, 0x58, 0x70, 0x6F, 0xC6, 0x07, 0xF3, 0x1D, 0x9B, 0x48, 0xD5, 0xDC, 0xF6, 0x47, 0xD2, 0xB1,
+    0xA4, 0xCE, 0x1B, 0xBB, 0xD7, 0x99, 0x70, 0x21, 0x89, 0xA5, 0x64, 0xA4, 0xAE, 0xD5, 0x70, 0x70,
+    0xDA, 0x82, 0x83, 0xBF, 0x7D, 0x5E, 0x1D, 0xC9, 0x2C, 0xC5, 0x05, 0x36, 0x37, 0x64, 0x9A, 0x96,
+    0x30, 0xC6, 0x03, 0xE5, 0xF9, 0x08, 0x98, 0xF7, 0xE4, 0x81, 0xDD, 0x42, 0xF2, 0x58, 0x2F, 0x45,
+    0xD2, 0xD1, 0x4A, 0x9E, 0x1A, 0xFD, 0x4F, 0xB0, 0x52, 0x5C, 0x62, 0x2D, 0x0F, 0x4E, 0x9A, 0xCF,
+    0xBD, 0x9A, 0x49, 0x92, 0xBC, 0x30, 0x52, 0x2C, 0x7B, 0x9C, 0x74, 0x2D, 0x62, 0x16, 0x12, 0xE7,
+    0xC1, 0x27, 0xDA, 0x36, 0x56, 0x52, 0x70, 0xE7, 0xF5, 0xFA, 0x78, 0x24, 0xD5, 0xFA, 0xCE, 0x76,
+    0x22, 0xCD, 0x17, 0x90, 0xE6, 0x81, 0x19, 0x2E, 0x24, 0x82, 0x56, 0xFA, 0xF0, 0x3F, 0x39, 0x49,
+    0x73, 0x29, 0x69, 0x3E, 0x38, 0xD5, 0x7A, 0x1B, 0xC8, 0xFD, 0x66, 0x2A, 0x55, 0x4E, 0x4D, 0xAA,
+    0xEA, 0x23, 0xD6, 0xDD, 0x4A, 0x7B, 0x52, 0x27, 0x9D, 0xAD, 0xA1, 0xF0, 0x64, 0x81, 0x24, 0x42,
+    0xAD, 0xAE, 0xD0, 0x90, 0x69, 0xDA, 0x4F, 0xE0, 0x7D, 0x7F, 0x3D, 0x97, 0xDE, 0x90, 0xC6, 0x56,
+    0x2A, 0x57, 0xB7, 0xFC, 0xD4, 0x58, 0x68, 0xB0, 0xEA, 0x3F, 0xDE, 0xE7, 0x8F, 0x99, 0x3B, 0x01,
+    0x1E, 0x9D, 0x2B, 0x23, 0xF5, 0xC5, 0x62, 0x58, 0x7E, 0x78, 0xFB, 0x6B, 0xF2, 0x24, 0xAA, 0x48,
+    0x66, 0x30, 0x1F, 0x4A, 0xBA, 0x21, 0xE9, 0x39, 0x29, 0xBA, 0xF5, 0xE7, 0xC2, 0x2E, 0x2D, 0x3A,
+    0x3F, 0x22, 0x35, 0xF7, 0xF2, 0x49, 0xC7, 0x39, 0xA9, 0xA6, 0x55, 0x68, 0x35, 0x9E, 0xC9, 0x22,
+    0xEC, 0x24, 0xEB, 0x3B, 0xD2, 0xD4, 0x2A, 0x6E, 0xAE, 0x47, 0xF7, 0x4C, 0xB0, 0xEA, 0xD2, 0x79,
+    0x71, 0x7A, 0x3B, 0xD8, 0x6B, 0x03, 0xEE, 0x74, 0xCF, 0xEC, 0x9A, 0x07, 0x75, 0x6D, 0xDF, 0xC6,
+    0x69, 0x4E, 0x24, 0x65, 0xD2, 0x5C, 0xAC, 0xB7, 0x71, 0x81, 0xF2, 0x45, 0x0F, 0xEE, 0xBC, 0x34,
+    0xB7, 0xD2, 0x6D, 0x49, 0x7B, 0xB7, 0xD7, 0x95, 0xF7, 0x79, 0xB0, 0x1F, 0xAA, 0xB1, 0x1A, 0x39,
+    0x38, 0xFF, 0x24, 0x3A, 0x14, 0x2F, 0xF5, 0xC5, 0x4B, 0x7D, 0x79, 0x25, 0xB8, 0xAB, 0x01, 0xB6,
+    0x8A, 0x0A, 0xC8, 0x7F, 0xB4, 0x10, 0x80, 0xCE, 0x03, 0xF6, 0xFD, 0xF8, 0x63, 0x00, 0x87, 0xDA,
+    0xAB, 0x6B, 0x1B, 0x33, 0xDB, 0xC9, 0x06, 0x6C, 0xD0, 0xDE, 0x04, 0xED, 0xE9, 0x58, 0x7B, 0x4C,
+    0x6C, 0xAF, 0x0E, 0x50, 0xDC, 0x98, 0x66, 0x40, 0xAD, 0xFC, 0xC2, 0x4E, 0x02, 0xA5, 0xB4, 0xCC,
+    0xD4, 0x0E, 0xB0, 0x8A, 0xF7, 0xE9, 0xC1, 0x7B, 0x33, 0x51, 0x15, 0x56, 0xED, 0xCD, 0x09, 0xA3,
+    0x2B, 0x51, 0x43, 0xA2, 0x41, 0x7B, 0xEA, 0xEB, 0xD9, 0xC6, 0x42, 0x0D, 0x44, 0x07, 0xFB, 0x72,
+    0x72, 0x15, 0x24, 0x53, 0x5D, 0x7D, 0xA6, 0x92, 0x07, 0x5F, 0x7D, 0xE4, 0xEC, 0x63, 0x8D, 0x89,
+    0x45, 0xA8, 0x1B, 0x16, 0xC8, 0x50, 0x9F, 0x5E, 0x20, 0xC3, 0x07, 0x23, 0x58, 0x69, 0x81, 0x0C,
+    0x7E, 0x1F, 0x26, 0x7C, 0x0C, 0x32, 0x84, 0x7B, 0x3C, 0xC7, 0xC7, 0x21, 0x83, 0xB3, 0x3E, 0x3A,
+    0x33, 0x4C, 0xC5, 0x9B, 0x1F, 0x43, 0x2C, 0x07, 0xCE, 0x18, 0x8D, 0x56, 0xE3, 0xCF, 0x9B, 0x40,
+    0xEE, 0xA9, 0x13, 0x0D, 0x99, 0xAA, 0x03, 0x6D, 0x83, 0xAB, 0xD8, 0x3D, 0x6E, 0xEE, 0xCC, 0xED,
+    0x9B, 0x52, 0xA1, 0xE1, 0xD1, 0x99, 0x05, 0xCF, 0x1D, 0x7B, 0xF3, 0xCE, 0x0C, 0x94, 0x5D, 0x76,
+    0xB3, 0xE1, 0x71, 0x8C, 0xB7, 0x03, 0xAA, 0xD8, 0x48, 0x8C, 0xAF, 0x63, 0xAE, 0xE6, 0x9F, 0x9D,
+    0x81, 0x54, 0xCA, 0x35, 0x3D, 0xF2, 0x9D, 0x81, 0xD2, 0xA7, 0x11, 0xE7, 0x13, 0x55, 0x99, 0x9A,
+    0x03, 0x75, 0x85, 0x83, 0xF8, 0x50, 0x7E, 0x4B, 0xBA, 0xAC, 0x29, 0x53, 0x9F, 0xFC, 0x3E, 0x3F,
+    0xD1, 0xBF, 0xBF, 0xCA, 0x81, 0x7F, 0xF2, 0x1A, 0x85, 0x22, 0x4E, 0x13, 0x0F, 0x7F, 0xC6, 0x83,
+    0xFC, 0xA9, 0x65, 0x63, 0xD7, 0xCF, 0x3A, 0x8D, 0xB5, 0xE2, 0xFA, 0x09, 0x7E, 0xD2, 0xCC, 0x53,
+    0xF6, 0xFA, 0x40, 0xFE, 0xA3, 0x11, 0x7B, 0x7D, 0xFC, 0xD4, 0x39, 0xFA, 0xD3, 0xD2, 0xD1, 0xEE,
+    0x05, 0xBB, 0x17, 0x8A, 0xCB, 0xA1, 0xFC, 0xC1, 0xF0, 0x93, 0xA5, 0xC6, 0x9C, 0xF5, 0x64, 0xB7,
+    0x22, 0xD4, 0x85, 0x27, 0x7F, 0xEF, 0x41, 0x15, 0x1F, 0x9D, 0xC1, 0x2E, 0xF9, 0x98, 0x88, 0x9A,
+    0xBA, 0x2F, 0x3B, 0x74, 0x34, 0x92, 0x8D, 0x75, 0x85, 0xBB, 0x12, 0x48, 0x63, 0x0B, 0xC5, 0x95,
+    0x40, 0x12, 0x5B, 0x28, 0xAF, 0x8C, 0x98, 0x58, 0xDF, 0x3E, 0xA8, 0x3D, 0x2D, 0x95, 0x19, 0xAA,
+    0x96, 0xCC, 0x92, 0x22, 0x07, 0x75, 0x67, 0xE9, 0xD4, 0x59, 0x6F, 0x2F, 0x87, 0xEC, 0x56, 0x4C,
+    0x63, 0xFB, 0xC9, 0x31, 0x7B, 0xF4, 0x6D, 0x9C, 0xBC, 0xBB, 0x31, 0x16, 0xDE, 0x3D, 0xDB, 0xE5,
+    0xD7, 0x87, 0x64, 0xDC, 0x61, 0xB7, 0xEC, 0xEA, 0x67, 0x24, 0xDF, 0xAA, 0xB7, 0x0A, 0x9C, 0x3C,
+    0x03, 0x27, 0x07, 0x8C, 0x54, 0x59, 0xC9, 0x97, 0xB7, 0xEB, 0xE0, 0xBC, 0x1D, 0xEA, 0x26, 0x1B,
+    0xDB, 0x2A, 0x8B, 0x92, 0x96, 0xF6, 0xEE, 0xEF, 0xC5, 0xB6, 0xC9, 0x63, 0x7D, 0xE7, 0xE4, 0xE8,
+    0xA4, 0xA1, 0x5C, 0xBC, 0x9B, 0x37, 0x52, 0xC5, 0xC9, 0x81, 0x64, 0xB7, 0xB2, 0x0A, 0xE5, 0x8D,
+    0xB1, 0x26, 0xEE, 0xB0, 0xD3, 0x6A, 0x96, 0xE6, 0xF6, 0xA9, 0xB9, 0xD6, 0xE4, 0x34, 0x5A, 0x85,
+    0x64, 0xB7, 0x4A, 0xC6, 0x2D, 0x92, 0x71, 0x8B, 0x34, 0xB6, 0x98, 0x07, 0xEB, 0x3D, 0x7E, 0x0A,
+    0xD7, 0xFF, 0xE4, 0x90, 0xFD, 0x38, 0x1A, 0x11, 0x1D, 0x44, 0x47, 0x12, 0x6B, 0x92, 0xA9, 0xFD,
+    0x74, 0x33, 0xB2, 0xAF, 0xDD, 0x2C, 0xEF, 0xBC, 0x0D, 0x0E, 0x33, 0x7C, 0x9D, 0x34, 0xB2, 0xFE,
+    0xEB, 0x11, 0x69, 0x69, 0x24, 0x11, 0xD2, 0xA8, 0x2E, 0x8F, 0xAD, 0x34, 0xD6, 0x4B, 0x2A, 0x26,
+    0x58, 0xC9, 0x27, 0xED, 0x9D, 0xD5, 0x50, 0x5D, 0x8C, 0x75, 0x76, 0x2B, 0x96, 0x57, 0x02, 0x70,
+    0xF0, 0xB8, 0xD1, 0xF0, 0xF9, 0x74, 0x20, 0x0D, 0x64, 0xDD, 0x63, 0xE7, 0x1B, 0xCD, 0x24, 0x63,
+    0x65, 0xAF, 0xBD, 0x3B, 0x17, 0x0A, 0x8F, 0xDE, 0x01, 0x0E, 0xE0, 0x14, 0x72, 0xA9, 0x7A, 0xF7,
+    0xDC, 0x89, 0x4F, 0x28, 0xF5, 0x37, 0xAD, 0x5A, 0x60, 0xFD, 0xDB, 0x2C, 0xEE, 0x6E, 0xC9, 0xC8,
+    0xF3, 0x53, 0x4F, 0xE2, 0x26, 0xE3, 0x16, 0xC5, 0x4B, 0x7D, 0x1A, 0x5B, 0xDC, 0xD5, 0xF0, 0xD1,
+    0xAE, 0x1D, 0xF9, 0xB5, 0x91, 0x58, 0xF8, 0xA2, 0x51, 0x3A, 0x64, 0x83, 0xC3, 0x5D, 0x0E, 0xC9,
+    0xBC, 0x83, 0x95, 0xA7, 0x8E, 0x18, 0x35, 0x14, 0xAB, 0xFC, 0x57, 0x4F, 0x12, 0x39, 0x24, 0x9F,
+    0x68, 0xA0, 0x98, 0x49, 0xE6, 0x0A, 0x13, 0x22, 0xCE, 0x7A, 0x33, 0x4C, 0xD4, 0xCF, 0x7D, 0x32,
+    0xFD, 0x9C, 0x07, 0xA2, 0xAB, 0xCA, 0x6F, 0x46, 0x33, 0xD8, 0xCE, 0xD1, 0x66, 0xBD, 0x19, 0x27,
+    0xCA, 0xB7, 0x3C, 0x1A, 0xC9, 0x55, 0xED, 0xF3, 0x30, 0x45, 0x47, 0x12, 0xC1, 0xF9, 0xE4, 0xFC,
+    0x48, 0x29, 0x52, 0x75, 0x94, 0x3D, 0xF0, 0x18, 0x87, 0x9A, 0xC2, 0x9B, 0x21, 0x0F, 0xC9, 0x64,
+    0x22, 0x9F, 0x36, 0x2F, 0x1E, 0xE3, 0x60, 0x63, 0x06, 0x22, 0x85, 0x2F, 0x3C, 0x73, 0x3A, 0x90,
+    0x05, 0x07, 0xEE, 0x72, 0x20, 0x99, 0x76, 0xC1, 0xCA, 0x43, 0x1D, 0xC1, 0xA8, 0x59, 0xA1, 0x6C,
+    0xB1, 0x14, 0x4F, 0x25, 0x11, 0x0E, 0xC9, 0x93, 0x68, 0x58, 0x6A, 0xA6, 0x92, 0xB9, 0x02, 0x5C,
+    0x95, 0xF7, 0xD9, 0xC0, 0x44, 0x4B, 0xD1, 0x1D, 0x3A, 0x93, 0x7C, 0xFB, 0x33, 0x7D, 0x5A, 0x8B,
+    0xF5, 0x4C, 0xEC, 0x92, 0x46, 0x33, 0x60, 0x06, 0xEB, 0xC9, 0xC3, 0x16, 0xD8, 0xEB, 0x03, 0x94,
+    0x6F, 0x79, 0x70, 0x33, 0xD0, 0x0E, 0xC0, 0xE2, 0x7A, 0x59, 0xC8, 0x53, 0x8A, 0x55, 0x61, 0x50,
+    0x72, 0x7E, 0x5C, 0x2A, 0x1C, 0x28, 0xA7, 0x15, 0x7D, 0xFA, 0xF1, 0x37, 0xE8, 0x09, 0x36, 0xEE,
+    0x53, 0x4E, 0xC4, 0x0D, 0xE2, 0x46, 0x12, 0xDD, 0x33, 0x0B, 0xE5, 0xB4, 0x9D, 0xDD, 0xD9, 0x84,
+    0xFB, 0xEB, 0x9A, 0x7D, 0xE9, 0x56, 0x6C, 0xCB, 0xAB, 0xEF, 0x47, 0x48, 0xFD, 0x77, 0x1F, 0xCF,
+    0x4D, 0xF3, 0xDD, 0xAF, 0xDA, 0xA3, 0x17, 0x87, 0x52, 0x95, 0xBE, 0x47, 0x56, 0xF1, 0x0D, 0xF2,
+    0x6A, 0x81, 0x5F, 0x3F, 0x6E, 0x6A, 0xB5, 0x43, 0x1D, 0xA6, 0xC3, 0x74, 0x38, 0x9D, 0xD6, 0xF5,
+    0x8E, 0x81, 0x23, 0xD8, 0xCA, 0x74, 0x8C, 0xAC, 0x61, 0x7D, 0x36, 0xF0, 0x25, 0xB2, 0x0A, 0xB6,
+    0xCB, 0x7D, 0x28, 0x30, 0xBB, 0x86, 0x8F, 0x61, 0xAA, 0x4F, 0x61, 0x11, 0x26, 0x20, 0x99, 0x8E,
+    0x43, 0x32, 0x8D, 0x2B, 0xC1, 0xC7, 0x44, 0x9C, 0x4E, 0x40, 0x94, 0x1A, 0x26, 0xA9, 0x67, 0x8A,
+    0x79, 0x60, 0x8A, 0x26, 0x30, 0x47, 0x33, 0x24, 0x73, 0xCC, 0x42, 0x32, 0x4B, 0x21, 0x99, 0xA5,
+    0x2E, 0x95, 0x66, 0x52, 0x25, 0xC3, 0x0E, 0xE9, 0xB8, 0x8B, 0x19, 0xE7, 0x8F, 0x5A, 0xB7, 0xFB,
+    0xCB, 0xF3, 0xC0, 0xF6, 0x2F, 0xC3, 0xF6, 0x57, 0x61, 0xE3, 0xC1, 0xE6, 0x46, 0x36, 0x9C, 0xD8,
+    0x38, 0x5C, 0x54, 0x9B, 0x87, 0x6D, 0xB5, 0x79, 0xB8, 0xAC, 0x76, 0x9C, 0xD8, 0x75, 0x23, 0xBB,
+    0xA5, 0xA7, 0xC6, 0x35, 0x66, 0xA0, 0xAE, 0x9C, 0x47, 0xC9, 0x04, 0xB2, 0x3D, 0xE9, 0x24, 0x30,
+    0x1A, 0x20, 0x93, 0x07, 0x3B, 0xB1, 0x90, 0xF3, 0x89, 0x02, 0xD8, 0x25, 0x69, 0xDE, 0x91, 0x4D,
+    0xF2, 0xB8, 0x1F, 0xEA, 0x5F, 0x1B, 0xA5, 0x8A, 0xE5, 0x60, 0x74, 0x47, 0x3E, 0x57, 0x0F, 0xF9,
+    0x62, 0x96, 0xD6, 0xD8, 0x60, 0xB0, 0x55, 0xBE, 0x17, 0x70, 0xDB, 0x24, 0xAB, 0x12, 0xB2, 0x16,
+    0x8A, 0x11, 0xA3, 0x8E, 0xA9, 0xA6, 0xDC, 0xD3, 0x33, 0xC1, 0x46, 0xF8, 0x17, 0x00, 0x0F, 0xAF,
+    0xFF, 0xBA, 0x74, 0x57, 0xF2, 0x0F, 0x6C, 0xAC, 0xAF, 0x1F, 0x93, 0x74, 0x7D, 0x21, 0x7D, 0x56,
+    0xD5, 0x10, 0x9A, 0x24, 0x49, 0x6F, 0x49, 0xDA, 0xE7, 0x7B, 0xD6, 0xCC, 0xF5, 0x7E, 0x6D, 0x5F,
+    0x74, 0x47, 0x8E, 0x98, 0x6B, 0x2B, 0xB1, 0x69, 0xDE, 0xEC, 0x36, 0x37, 0xB3, 0x37, 0xFD, 0xE6,
+    0x46, 0x76, 0xD9, 0x6F, 0xAC, 0x84, 0x5F, 0x5F, 0x5F, 0x5F, 0x7F, 0x56, 0x0B, 0x39, 0x2D, 0xFF,
+    0x60, 0xA9, 0x45, 0x6C, 0x25, 0xFD, 0xD1, 0xFA, 0xFA, 0xFA, 0x09, 0x68, 0xDF, 0x50, 0x16, 0xCB,
+    0x4E, 0x59, 0x74, 0x3D, 0xA9, 0x9E, 0x99, 0x6C, 0x28, 0xBB, 0xDA, 0xCB, 0xCC, 0x1F, 0x3B, 0x07,
+    0xF9, 0x54, 0x86, 0xFA, 0x75, 0x99, 0x68, 0x43, 0xD9, 0xE9, 0x29, 0xE5, 0xA3, 0x0D, 0xB5, 0xD7,
+    0xA9, 0x89, 0x64, 0x29, 0xA5, 0x59, 0x0A, 0xB2, 0x3E, 0x52, 0x9D, 0xE5, 0xA6, 0x4C, 0xDA, 0x93,
+    0x6E, 0xE9, 0x13, 0x67, 0x96, 0x9D, 0x1E, 0x46, 0x58, 0x83, 0xA2, 0x21, 0xEB, 0x49, 0x96, 0x9D,
+    0xBC, 0x81, 0x1E, 0xFE, 0x16, 0x24, 0x8B, 0xDA, 0x8F, 0x40, 0xB6, 0x50, 0xA8, 0x3B, 0x0F, 0x52,
+    0xB1, 0xDB, 0xE4, 0x9A, 0x73, 0x69, 0x4F, 0x1A, 0xD8, 0xFE, 0xE8, 0x15, 0x0E, 0xB5, 0x3B, 0x99,
+    0x74, 0x4A, 0x0A, 0x9F, 0xD0, 0xAA, 0x80, 0xD4, 0xC3, 0xDF, 0x85, 0xCF, 0x2D, 0xFE, 0xE0, 0xDC,
+    0xB9, 0xB3, 0xAC, 0x62, 0xE4, 0xAA, 0x90, 0xBA, 0x4C, 0x1A, 0x53, 0x69, 0x46, 0x92, 0x5F, 0xF9,
+    0xA2, 0x98, 0x49, 0x7A, 0x5A, 0x52, 0x27, 0x69, 0x74, 0xD2, 0x6C, 0x57, 0x4C, 0xE7, 0x7B, 0x92,
+    0x22, 0x49, 0x9F, 0x0F, 0x65, 0x6C, 0xDF, 0x9B, 0xB3, 0x06, 0x0E, 0xBD, 0x18, 0xCB, 0xBD, 0xC9,
+    0x75, 0xFB, 0x9F, 0x5F, 0xBC, 0xEB, 0x17, 0x1E, 0xD3, 0xF4, 0x79, 0x93, 0xFB, 0xCF, 0x9F, 0xB1,
+    0xD5, 0xA3, 0x67, 0x1D, 0x5F, 0x3A, 0xBB, 0x89, 0xED, 0x22, 0xF9, 0x37, 0x07, 0xC8, 0xFA, 0x25,
+    0x1B, 0x5B, 0x34, 0x0B, 0xED, 0xBA, 0x03, 0x49, 0x7C, 0xFE, 0x79, 0x33, 0xFC, 0xF1, 0xFF, 0xCE,
+    0xC2, 0x5F, 0xFC, 0xB9, 0xF5, 0x7F, 0xF1, 0x17, 0x65, 0xF3, 0xC2, 0x0B, 0x8F, 0x2D, 0xF1, 0x5E,
+    0xB4, 0xA3, 0x1D, 0x6C, 0x28, 0x42, 0xD9, 0xBB, 0x0E, 0xC0, 0x05, 0x79, 0x9D, 0x9A, 0xCD, 0x64,
+    0x07, 0x1B, 0x9C, 0xAF, 0x2F, 0xCD, 0xE9, 0x6C, 0x07, 0x3B, 0xD4, 0xCB, 0xD8, 0xF7, 0x4F, 0x64,
+    0xD5, 0xAE, 0xDD, 0x0B, 0x2E, 0x7F, 0x7D, 0x2C, 0x8F, 0xF6, 0xD1, 0x3E, 0x1D, 0x36, 0x56, 0xAF,
+    0x74, 0xEF, 0x92, 0x31, 0xF7, 0x6B, 0x00, 0xE9, 0xA5, 0x6E, 0xD7, 0x99, 0xF7, 0x06, 0x7B, 0xDA,
+    0x6F, 0x1C, 0xD9, 0x2F, 0xCC, 0x4A, 0xBB, 0xAF, 0x64, 0x21, 0x96, 0xD5, 0x54, 0xBE, 0x14, 0xEC,
+    0x5E, 0xD8, 0x4A, 0x86, 0x23, 0xF9, 0xD2, 0xE9, 0x57, 0x60, 0xC2, 0xA8, 0xB2, 0x37, 0xFB, 0xFA,
+    0x72, 0x04, 0x8E, 0xE7, 0xD5, 0x64, 0xBB, 0x98, 0xF7, 0x45, 0x6F, 0x83, 0xF5, 0x96, 0xCF, 0x91,
+    0x92, 0x57, 0x65, 0x53, 0x36, 0x85, 0x77, 0x47, 0xA3, 0xBB, 0x38, 0x9A, 0xE6, 0x67, 0x96, 0xD4,
+    0xD2, 0x62, 0xCC, 0x57, 0xB9, 0x2E, 0x13, 0xA1, 0x18, 0x5C, 0xA7, 0xAA, 0xF5, 0xB8, 0xCE, 0x08,
+    0x3B, 0x62, 0xA3, 0x11, 0xD4, 0x7D, 0xEB, 0x49, 0x75, 0x7E, 0xC0, 0x59, 0xCD, 0xF6, 0xCD, 0xC1,
+    0xC9, 0xCF, 0xF5, 0x53, 0x0A, 0xC5, 0x8D, 0xD1, 0x2A, 0xD1, 0xD7, 0x8F, 0x2A, 0x3E, 0x72, 0x06,
+    0x29, 0x80, 0x93, 0x1A, 0x72, 0x9D, 0x9C, 0x49, 0xD5, 0x6B, 0xA0, 0x8E, 0x46, 0x5D, 0x21, 0x0A,
+    0x65, 0xEA, 0x68, 0xF7, 0x21, 0xE5, 0xC1, 0x33, 0xAC, 0xCA, 0x27, 0x57, 0x34, 0xB9, 0xEE, 0x6F,
+    0x56, 0x39, 0xDB, 0xD6, 0x47, 0xEB, 0xA3, 0xBD, 0x18, 0x8B, 0x8B, 0xB1, 0xBC, 0x34, 0x16, 0xCD,
+    0x57, 0x59, 0xDC, 0x58, 0xFA, 0x9A, 0xBB, 0x3C, 0xD5, 0x3F, 0x98, 0xD5, 0xF3, 0x05, 0x38, 0xB4,
+    0xF0, 0xCB, 0xCB, 0xF4, 0x6A, 0xFB, 0x44, 0x7A, 0x5A, 0x0A, 0x47, 0xDC, 0xEE, 0xE7, 0xEC, 0x55,
+    0x9F, 0xBD, 0x1F, 0x92, 0x38, 0xB1, 0xE5, 0x28, 0x5F, 0xF1, 0xB9, 0xFA, 0x54, 0x81, 0x36, 0x50,
+    0xF6, 0xE4, 0x03, 0xE9, 0x04, 0x6D, 0xC5, 0x91, 0x8F, 0x78, 0xC5, 0x6A, 0x95, 0xCB, 0x4A, 0x04,
+    0x6D, 0x47, 0x39, 0x60, 0x67, 0xD2, 0x73, 0xD5, 0x7D, 0xAB, 0xF1, 0x64, 0x32, 0x48, 0x17, 0x35,
+    0x25, 0xED, 0x19, 0x0E, 0x40, 0xF2, 0xD5, 0x86, 0x27, 0x55, 0x51, 0x0F, 0x50, 0x77, 0x64, 0xEA,
+    0xF9, 0xB9, 0xF7, 0xBE, 0xC0, 0x7F, 0x39, 0xF5, 0x6F, 0xFF, 0xF6, 0x95, 0xB7, 0xFE, 0xAB, 0xEE,
+    0xAA, 0xD2, 0x33, 0xF3, 0xB3, 0xD2, 0x5F, 0xAE, 0xFD, 0xC9, 0x69, 0x72, 0xBE, 0xB0, 0x4F, 0x5A,
+    0x2F, 0x3A, 0x17, 0x15, 0xA6, 0x87, 0x6D, 0x28, 0x1A, 0x4C, 0x80, 0x4D, 0xB0, 0x9E, 0x74, 0x80,
+    0x7A, 0xD9, 0x1A, 0x97, 0xF7, 0xA6, 0x5F, 0x3C, 0x7D, 0xC5, 0xC1, 0xB3, 0xF7, 0x43, 0xC3, 0x33,
+    0x24, 0xAF, 0x92, 0xAB, 0x4F, 0x35, 0x64, 0xD2, 0x8B, 0x52, 0xDF, 0x3E, 0x35, 0x95, 0x5D, 0xFD,
+    0x74, 0x93, 0x85, 0x3E, 0x19, 0x3F, 0xFD, 0x6D, 0x5F, 0x48, 0x89, 0x16, 0x5C, 0x43, 0xD9, 0x51,
+    0x04, 0xDC, 0x48, 0x31, 0x91, 0xCF, 0xA4, 0xAA, 0x68, 0x2B, 0x9C, 0x27, 0x1F, 0x30, 0x91, 0xD5,
+    0x8E, 0xED, 0x31, 0x23, 0x9C, 0x81, 0x5F, 0xFE, 0x74, 0x87, 0x34, 0x81, 0xAB, 0xB0, 0xFD, 0x7E,
+    0x09, 0x68, 0xDD, 0x50, 0x04, 0xF2, 0x91, 0xE4, 0x1C, 0x7C, 0xBD, 0x7A, 0x60, 0xC0, 0xAB, 0x5C,
+    0x3D, 0x9F, 0xCF, 0xA4, 0x86, 0xA1, 0x7D, 0x6A, 0xA2, 0x78, 0xBA, 0xC9, 0x42, 0x32, 0x80, 0xA3,
+    0xA8, 0x30, 0x21, 0x1D, 0xC0, 0x51, 0x56, 0x98, 0x60, 0x06, 0x68, 0x71, 0x15, 0x65, 0x67, 0x06,
+    0xCA, 0x11, 0x47, 0x3E, 0x63, 0x02, 0x6D, 0x85, 0x23, 0x1F, 0x20, 0xA0, 0x8A, 0x74, 0x35, 0x65,
+    0xFA, 0xCF, 0xD2, 0xAC, 0x6D, 0x6C, 0x4F, 0x3E, 0x32, 0x83, 0x7C, 0x11, 0xB0, 0x31, 0x39, 0xB7,
+    0xC0, 0x0A, 0x1E, 0x59, 0x68, 0xBE, 0xEA, 0xD0, 0x19, 0xBE, 0x5A, 0xAB, 0xB2, 0xD2, 0x60, 0x74,
+    0xA6, 0x4D, 0xEE, 0x56, 0xB6, 0xDB, 0x24, 0x19, 0x8B, 0x8A, 0x3A, 0xEF, 0x28, 0x2E, 0x0D, 0xE4,
+    0xFD, 0x0E, 0x66, 0x70, 0x55, 0x16, 0x6D, 0x57, 0x46, 0x33, 0xD8, 0xC8, 0x64, 0x22, 0x79, 0x25,
+    0x38, 0xE3, 0xFC, 0x92, 0xDF, 0x3D, 0x78, 0x1F, 0x67, 0xA5, 0xAF, 0x42, 0x32, 0x67, 0x81, 0xF6,
+    0x62, 0xC4, 0x85, 0xB6, 0xB2, 0xD1, 0x75, 0x46, 0xFF, 0xE0, 0xD5, 0xFD, 0xF3, 0xFE, 0xBE, 0xA1,
+    0x29, 0xAB, 0xC5, 0xD8, 0xAC, 0x01, 0x9B, 0x3C, 0xC2, 0x36, 0xAE, 0x8A, 0xB8, 0x17, 0x47, 0xEA,
+    0x6F, 0x0E, 0xB4, 0x7B, 0x61, 0xA9, 0x12, 0xC9, 0xFB, 0x85, 0xBA, 0xFC, 0xF8, 0xD7, 0x6A, 0x60,
+    0xD7, 0x0C, 0x4C, 0x66, 0x24, 0x9A, 0x31, 0x8D, 0x59, 0x34, 0xE3, 0xC1, 0xD7, 0xCC, 0xB0, 0xE4,
+    0xEC, 0xF6, 0xBF, 0x56, 0xF8, 0xE5, 0x35, 0x77, 0xCD, 0x72, 0xA5, 0x6F, 0x00, 0x15, 0x90, 0x37,
+    0x7F, 0x78, 0xEA, 0x1F, 0x3F, 0xF4, 0xC7, 0xBF, 0xF6, 0x2F, 0x7F, 0xB4, 0x27, 0x33, 0x00, 0x55,
+    0x56, 0x1D, 0x31, 0xDF, 0x78, 0xBC, 0x57, 0xF7, 0x65, 0xBE, 0x9A, 0x54, 0xDA, 0x6B, 0x1E, 0xAA,
+    0x5C, 0x9F, 0x5E, 0x3A, 0x66, 0x63, 0xD9, 0x24, 0xC7, 0xDD, 0x25, 0xFF, 0xF9, 0xCA, 0xF5, 0xB7,
+    0xAE, 0x5D, 0x7E, 0x36, 0x1E, 0xAC, 0x1E, 0x3E, 0xAE, 0x2E, 0xAB, 0x1E, 0x27, 0x18, 0xFF, 0x24,
+    0xA3, 0xE9, 0xA0, 0x7C, 0xFA, 0x72, 0xFE, 0x8B, 0xB6, 0xFF, 0x6F, 0x7B, 0xA7, 0x4E, 0x4F, 0x45,
+    0x0F, 0xF5, 0xD1, 0x97, 0x7E, 0xEE, 0xF3, 0xBF, 0xFA, 0x42, 0xDB, 0xFF, 0xD3, 0xDF, 0xDE, 0x5E,
+    0xAC, 0x24, 0x6B, 0x75, 0xE3, 0x34, 0xB8, 0xBB, 0xD1, 0x55, 0xDB, 0x35, 0x9B, 0x5B, 0x6C, 0xD6,
+    0xEC, 0xD6, 0xEC, 0xB6, 0xCC, 0x2D, 0x6A, 0x91, 0x50, 0xDE, 0xFC, 0xE1, 0xDE, 0xBF, 0xFB, 0x47,
+    0x7F, 0xF2, 0x6B, 0xDF, 0x78, 0xEF, 0x9A, 0xCC, 0x98, 0x90, 0xB0, 0x99, 0x7E, 0x2F, 0xE9, 0xB2,
+    0xEA, 0x09, 0xBE, 0x67, 0xA3, 0x0B, 0x45, 0x77, 0xC3, 0x67, 0xD5, 0x97, 0x08, 0xF6, 0xC5, 0x68,
+    0x67, 0x37, 0x14, 0xDD, 0xBF, 0xF7, 0xA6, 0xFA, 0xE7, 0xB6, 0x4F, 0xDF, 0xD0, 0xB1, 0x11, 0x38,
+    0x93, 0x35, 0x6B, 0x66, 0xE3, 0xF1, 0xA0, 0x60, 0x39, 0x0C, 0x3A, 0x55, 0xD9, 0xF0, 0x70, 0x38,
+    0xBA, 0xA7, 0x3C, 0x40, 0x16, 0xFE, 0xD5, 0xD1, 0xC6, 0x0E, 0x6B, 0xDF, 0x0B, 0xD7, 0x2F, 0xBF,
+    0x1C, 0x0F, 0x36, 0xA0, 0x1F, 0x7E, 0x6D, 0xB9, 0x8D, 0x82, 0x0B, 0xA6, 0x83, 0xBC, 0xFF, 0xCF,
+    0x6F, 0xEC, 0x3D, 0xF3, 0x07, 0x36, 0xDC, 0xBA, 0xBE, 0x77, 0x75, 0x3E, 0x74, 0x26, 0xEF, 0xFE,
+    0x6C, 0xCF, 0xFC, 0xC3, 0x87, 0xD6, 0xC6, 0xB2, 0x37, 0xC7, 0xE2, 0x23, 0x0D, 0x60, 0x7D, 0xDE,
+    0x65, 0xC1, 0x0C, 0x49, 0x64, 0xC2, 0x51, 0x36, 0xB6, 0x33, 0x21, 0x89, 0xD4, 0x94, 0x4D, 0xDE,
+    0xA7, 0x23, 0x2D, 0x85, 0xCF, 0x02, 0x13, 0xAE, 0xC9, 0x43, 0x32, 0xE1, 0x7C, 0x1E, 0x12, 0xE1,
+    0xBA, 0x2C, 0xD2, 0x36, 0x60, 0x7D, 0x32, 0xE2, 0xAA, 0x2C, 0x30, 0x51, 0x78, 0x33, 0xB0, 0x4B,
+    0xE1, 0x4D, 0x60, 0xA2, 0xAC, 0xF2, 0x3E, 0x1D, 0xD9, 0xA5, 0x6C, 0x6C, 0x6F, 0x06, 0x22, 0x35,
+    0xCE, 0xDB, 0x2E, 0x0F, 0x26, 0xA6, 0x53, 0x22, 0x54, 0xD5, 0x0D, 0xF0, 0xC4, 0x61, 0x38, 0x72,
+    0x18, 0x0E, 0x6F, 0xC0, 0xC6, 0x05, 0xB8, 0x30, 0x90, 0x28, 0xEE, 0x97, 0x41, 0x24, 0xD2, 0x68,
+    0x74, 0xBD, 0xCF, 0x75, 0xBD, 0xB3, 0x1F, 0x5C, 0xF3, 0xF6, 0xFD, 0xCB, 0xBE, 0xF8, 0xE0, 0x4A,
+    0x53, 0x7E, 0x70, 0xA5, 0x29, 0xEF, 0x9E, 0xAE, 0x4A, 0x1D, 0xA3, 0xD0, 0x73, 0xCF, 0xDB, 0xA5,
+    0x04, 0x7F, 0x29, 0x83, 0x58, 0x7C, 0x70, 0x64, 0xE3, 0xC2, 0xBD, 0x2E, 0xF9, 0x5E, 0xF8, 0x44,
+    0x89, 0x45, 0xF2, 0xB1, 0x12, 0x0B, 0x1B, 0xA0, 0x08, 0x6B, 0x17, 0xCA, 0xE0, 0xC6, 0x32, 0xB8,
+    0xBF, 0x57, 0x0E, 0x6B, 0x14, 0xF3, 0xD6, 0x47, 0xFA, 0x4E, 0xB4, 0x5F, 0x62, 0x01, 0x7C, 0x01,
+    0xDA, 0x01, 0xA7, 0x3E, 0xEF, 0xEB, 0x6A, 0x1B, 0x5A, 0xC5, 0x5C, 0xF2, 0xBF, 0x70, 0xFB, 0x04,
+    0x0E, 0x9C, 0x26, 0x23, 0x75, 0x6C, 0x43, 0xEE, 0x49, 0x22, 0x89, 0x3C, 0x4E, 0x1F, 0x9A, 0xC5,
+    0xEF, 0x77, 0x0B, 0xA7, 0x41, 0xED, 0x4D, 0x20, 0x11, 0x85, 0x27, 0x9B, 0xA9, 0xA1, 0x8C, 0x49,
+    0x84, 0x76, 0xCC, 0x02, 0xA9, 0x42, 0xE9, 0xC9, 0xD5, 0xB5, 0xE0, 0x6E, 0x5E, 0x8A, 0x48, 0x2B,
+    0x8C, 0x27, 0x35, 0x76, 0x98, 0x66, 0x70, 0xD7, 0x34, 0x92, 0xE8, 0x19, 0xF5, 0x64, 0x93, 0x55,
+    0x45, 0x31, 0x14, 0x13, 0xB4, 0x9D, 0x1B, 0x48, 0xD5, 0xB4, 0x1D, 0x7C, 0xFD, 0xDB, 0x90, 0x4A,
+    0x15, 0xB9, 0x54, 0xE1, 0xAA, 0x16, 0x27, 0x29, 0x7C, 0x67, 0xFE, 0xCE, 0xDC, 0xD8, 0xAE, 0xE8,
+    0x97, 0xB4, 0xA9, 0x14, 0x31, 0x52, 0xB7, 0x30, 0x82, 0xF5, 0x9F, 0x42, 0x32, 0x03, 0xD9, 0xB8,
+    0x9F, 0xA1, 0xA8, 0x3D, 0xA4, 0xDA, 0xCF, 0xBE, 0x2E, 0x79, 0xCD, 0x76, 0x06, 0xD2, 0xDB, 0xDB,
+    0x40, 0xDE, 0x5C, 0x00, 0x9E, 0x4C, 0x7B, 0xE0, 0x42, 0xE6, 0xC1, 0xF4, 0x25, 0xF9, 0x68, 0xFF,
+    0xD7, 0x88, 0x82, 0x53, 0x67, 0x9A, 0x4A, 0x33, 0x0F, 0x61, 0x14, 0x71, 0x67, 0xEC, 0x0F, 0x47,
+    0x5C, 0xEF, 0x8E, 0x06, 0x1E, 0xED, 0x27, 0xEB, 0xC9, 0xF7, 0x06, 0xD7, 0x1C, 0xA9, 0x6D, 0x27,
+    0xA3, 0x58, 0x1F, 0x8D, 0x56, 0xDD, 0xFA, 0x81, 0xE3, 0xF9, 0xB8, 0x8F, 0x37, 0x2B, 0x9E, 0x24,
+    0x62, 0xFA, 0xDC, 0xB3, 0xC6, 0x36, 0xA6, 0xCB, 0x3C, 0x87, 0xD9, 0xB4, 0x99, 0xDF, 0x07, 0xB8,
+    0xD3, 0x2F, 0x7C, 0x30, 0x4D, 0x95, 0x73, 0x57, 0x9B, 0xF4, 0xEE, 0x34, 0x50, 0x4A, 0x24, 0xBA,
+    0x19, 0x28, 0xEE, 0x08, 0x74, 0x2C, 0x60, 0xC3, 0xBC, 0xA0, 0x76, 0xDB, 0xEF, 0xF0, 0xFB, 0x4B,
+    0x21, 0xD9, 0x01, 0xA9, 0x2F, 0xF5, 0xBB, 0x43, 0x19, 0x89, 0xE5, 0xC8, 0x46, 0x39, 0xBE, 0xBA,
+    0x51, 0x8E, 0x71, 0xBF, 0x1D, 0x76, 0xE3, 0x36, 0x6E, 0xDC, 0xC5, 0x8D, 0xF5, 0x99, 0x76, 0x2C,
+    0xA5, 0xDF, 0xCC, 0x24, 0xF8, 0x62, 0xBB, 0x14, 0x21, 0x64, 0x9E, 0x54, 0x33, 0xA9, 0x66, 0xC8,
+    0x3D, 0xF9, 0x0D, 0x8F, 0x53, 0xC3, 0xD4, 0x36, 0x84, 0xB2, 0x49, 0xFA, 0x62, 0x69, 0x83, 0x6B,
+    0x90, 0x1A, 0x6A, 0x35, 0x3C, 0x7A, 0xA3, 0x59, 0x95, 0xDA, 0x78, 0xB7, 0x0F, 0xA8, 0x0F, 0xAA,
+    0x43, 0xAA, 0x72, 0x4D, 0xB8, 0x3F, 0xFD, 0x8D, 0x64, 0x22, 0x91, 0x7C, 0x2E, 0x55, 0x8F, 0xE9,
+    0xFF, 0x92, 0x8E, 0x90, 0x7F, 0xD8, 0x64, 0x12, 0xA5, 0x66, 0xCE, 0x4D, 0x4B, 0x26, 0xC9, 0x6A,
+    0xA2, 0xD4, 0x80, 0x53, 0xC7, 0xA3, 0xAA, 0x80, 0xAF, 0x9F, 0x3B, 0xF7, 0xED, 0x76, 0xE1, 0xA7,
+    0xE7, 0x56, 0x9A, 0xB1, 0x7D, 0x85, 0x55, 0xB3, 0x70, 0x05, 0xAA, 0x52, 0x05, 0x52, 0x05, 0xD2,
+    0xD3, 0x77, 0x97, 0x63, 0x27, 0xD5, 0xA4, 0x1A, 0x97, 0x63, 0x37, 0xC3, 0x32, 0xFF, 0x6D, 0x80,
+    0x47, 0xCE, 0x55, 0x90, 0x6B, 0x02, 0x23, 0xF5, 0xE9, 0x92, 0x7E, 0x77, 0x55, 0x59, 0x95, 0x92,
+    0xD4, 0x99, 0x21, 0x1B, 0x97, 0xDF, 0xB1, 0xE0, 0x24, 0xB0, 0xAB, 0x82, 0x3C, 0x48, 0xF4, 0x2D,
+    0xA0, 0x6E, 0x58, 0xD8, 0xF2, 0x25, 0xCF, 0x95, 0x08, 0xA0, 0xF5, 0xAB, 0xD0, 0x68, 0x95, 0x87,
+    0xB7, 0xCD, 0xAA, 0x40, 0x68, 0x7F, 0x23, 0xD5, 0xDC, 0xA4, 0x4B, 0x0D, 0x93, 0x7C, 0xA1, 0x0F,
+    0xFF, 0xC0, 0xC8, 0x56, 0xB8, 0x6E, 0x20, 0x8B, 0xB6, 0xA2, 0x6E, 0x06, 0xF2, 0xD1, 0x7E, 0x8B,
+    0xF6, 0x45, 0xE9, 0xCA, 0x58, 0x68, 0xAA, 0x2F, 0x7E, 0xD8, 0x5E, 0x9F, 0x8B, 0xA3, 0x83, 0x9B,
+    0x6F, 0xB7, 0xC9, 0x7E, 0xD5, 0x77, 0x55, 0x48, 0x81, 0x47, 0x75, 0x66, 0x49, 0xFD, 0xA7, 0x01,
+    0x28, 0xEF, 0xB1, 0xC2, 0x27, 0x80, 0x42, 0x3D, 0x8B, 0xBA, 0xFC, 0x52, 0xD9, 0xB3, 0xFA, 0x0D,
+    0x0C, 0x35, 0x56, 0x92, 0xEE, 0x4A, 0xD2, 0xBC, 0x7E, 0x6F, 0x79, 0xEE, 0xFE, 0x41, 0x1B, 0xF8,
+    0x0D, 0xD2, 0xF9, 0xEF, 0x0B, 0x9C, 0xD4, 0x2F, 0x24, 0xE2, 0xAA, 0xD8, 0x60, 0xDF, 0x25, 0x06,
+    0x72, 0x4F, 0xDB, 0x5B, 0x79, 0xDD, 0xCD, 0xEE, 0xFA, 0xF2, 0x15, 0x76, 0x36, 0xCC, 0xED, 0x90,
+    0xBF, 0xE3, 0xCB, 0x9B, 0x95, 0x53, 0x53, 0xAB, 0x29, 0xEF, 0x60, 0x2B, 0xBE, 0x42, 0x2D, 0xE9,
+    0xE2, 0x12, 0x3D, 0xED, 0xE7, 0xE3, 0x24, 0x7D, 0x73, 0x9F, 0x68, 0x6C, 0x70, 0xFB, 0xE9, 0xB9,
+    0x9F, 0x64, 0xC3, 0x69, 0x72, 0x9A, 0x1E, 0x6E, 0x4F, 0x50, 0xAE, 0xB6, 0xBF, 0xA8, 0x6F, 0x39,
+    0xE1, 0x22, 0x6E, 0xE2, 0x57, 0x04, 0xAE, 0xC2, 0x79, 0x96, 0x84, 0x9D, 0xEB, 0x79, 0xEC, 0xEC,
+    0x2A, 0x22, 0xDA, 0xDD, 0xA4, 0x54, 0x55, 0xA8, 0x73, 0xF3, 0x71, 0x3B, 0xEF, 0x98, 0xF3, 0xAA,
+    0x4A, 0x7D, 0xDF, 0xCD, 0xF9, 0xD5, 0x39, 0x7B, 0xFF, 0xF4, 0xCB, 0x83, 0xD1, 0x80, 0xFA, 0xA5,
+    0x68, 0x07, 0x6C, 0x05, 0x47, 0x80, 0x01, 0x8A, 0x89, 0x54, 0x13, 0x56, 0x91, 0x56, 0x83, 0xB9,
+    0x7B, 0xA3, 0xB7, 0x57, 0x4F, 0x7B, 0xB7, 0xE6, 0x88, 0x63, 0x34, 0xEF, 0x5F, 0x0F, 0xF7, 0x76,
+    0xE3, 0x68, 0xDE, 0x7F, 0xBF, 0xB7, 0x3F, 0x78, 0xAB, 0xE1, 0xE0, 0xB9, 0xE3, 0xD0, 0xAA, 0x5B,
+    0x6C, 0xD2, 0x94, 0x44, 0x6C, 0x97, 0x77, 0x4C, 0xEC, 0x62, 0xBB, 0xA2, 0x77, 0xD2, 0x64, 0x56,
+    0x51, 0xD3, 0x60, 0xA4, 0x48, 0xA2, 0x6F, 0xF1, 0xF0, 0xC9, 0xDB, 0xC7, 0x33, 0x49, 0xD4, 0x52,
+    0x58, 0x26, 0x56, 0x19, 0x56, 0x46, 0xE9, 0x67, 0x97, 0x50, 0x27, 0x5F, 0x02, 0xE7, 0x3C, 0x40,
+    0xFB, 0xEE, 0xB9, 0x97, 0x96, 0x22, 0x94, 0x68, 0xF7, 0x01, 0xC4, 0x0A, 0x44, 0x3C, 0xB9, 0x18,
+    0xEF, 0xFB, 0x30, 0x26, 0x80, 0x8B, 0x20, 0x55, 0x99, 0xD4, 0x15, 0xEF, 0xBC, 0x39, 0x96, 0xCF,
+    0xBC, 0x3E, 0xFC, 0x6C, 0xD6, 0x7D, 0x81, 0xAC, 0xE3, 0x13, 0x2D, 0x6D, 0xC0, 0x2C, 0xE6, 0x3B,
+    0x5F, 0x95, 0xD9, 0xB5, 0x87, 0xCE, 0x7D, 0x67, 0x94, 0x74, 0x53, 0x8A, 0x50, 0x57, 0xAC, 0x7E,
+    0xDE, 0x31, 0x43, 0xD6, 0xC0, 0x17, 0xF8, 0x7F, 0x8D, 0x94, 0xB1, 0x8F, 0x18, 0x47, 0x15, 0xC6,
+    0x7F, 0xBB, 0x1B, 0x79, 0x89, 0x07, 0x65, 0x5C, 0x90, 0x14, 0xBE, 0x62, 0x52, 0xB8, 0x02, 0x91,
+    0x6D, 0xA0, 0x40, 0x72, 0x6E, 0xD6, 0x14, 0x14, 0xA9, 0xAE, 0x88, 0x11, 0xA2, 0xB9, 0x06, 0x24,
+    0x44, 0xE3, 0x06, 0xBA, 0xF3, 0xED, 0x2A, 0x96, 0x68, 0x73, 0xFF, 0x41, 0xAE, 0xB8, 0xC2, 0x39,
+    0x24, 0x9C, 0xD2, 0xC5, 0xDD, 0xED, 0xF8, 0x5C, 0xB8, 0xA0, 0x59, 0x42, 0x41, 0xE9, 0x15, 0x01,
+    0x61, 0xA5, 0xB9, 0xC1, 0xDE, 0x4B, 0x96, 0xCB, 0xEC, 0x7E, 0x14, 0x7B, 0x9C, 0x40, 0x8A, 0x50,
+    0x9E, 0x34, 0xDF, 0xCC, 0xBC, 0x79, 0xF3, 0xDE, 0xD3, 0xBC, 0xEF, 0x0D, 0x65, 0x0F, 0x5F, 0x33,
+    0xDE, 0x28, 0xFB, 0x7D, 0xFF, 0xEC, 0xD3, 0xC9, 0x7E, 0x75, 0x16, 0x73, 0x29, 0xD0, 0x2D, 0xE0,
+    0xA6, 0xF5, 0x3C, 0xAB, 0xE1, 0xED, 0x1C, 0x5C, 0x1E, 0x71, 0xED, 0x26, 0xB6, 0x2D, 0x07, 0x1B,
+    0xB8, 0x6F, 0x25, 0xFD, 0x59, 0xD2, 0xB4, 0x4B, 0x36, 0x95, 0x3D, 0x89, 0x63, 0x12, 0x36, 0xEC,
+    0x40, 0xFB, 0x3A, 0x00, 0xA6, 0xC5, 0x4C, 0x58, 0x05, 0xAB, 0x64, 0xFF, 0xF8, 0xD1, 0xE9, 0xE9,
+    0xD0, 0xF3, 0x18, 0xDE, 0x01, 0xD3, 0xF2, 0xE3, 0xA1, 0x1E, 0x1F, 0x3F, 0xAE, 0xFE, 0x70, 0x92,
+    0x6B, 0xC1, 0xCD, 0x64, 0x33, 0x7C, 0x1B, 0x80, 0xEF, 0x69, 0xF2, 0x9A, 0xFC, 0xC5, 0x9E, 0x1F,
+    0xF1, 0x33, 0xEF, 0x76, 0xF5, 0xFD, 0xAA, 0xBF, 0x6F, 0xC6, 0x9D, 0x7C, 0xFE, 0x15, 0xC7, 0x70,
+    0xEB, 0x35, 0x28, 0xB4, 0xD4, 0xD2, 0xF0, 0xD6, 0xA3, 0x09, 0x23, 0x8C, 0x82, 0xF9, 0x22, 0x9A,
+    0xF1, 0xC8, 0x8C, 0x95, 0x19, 0xCD, 0xE9, 0x98, 0xED, 0xDF, 0x82, 0xD7, 0xC1, 0x04, 0xF2, 0x94,
+    0x47, 0x1F, 0x8E, 0x8A, 0xC9, 0xE3, 0x3F, 0x6C, 0xCB, 0x2F, 0x07, 0x9A, 0x11, 0x33, 0x17, 0x52,
+    0x26, 0x85, 0xEF, 0x1E, 0xEE, 0xC3, 0xDB, 0x90, 0x52, 0x91, 0x92, 0x89, 0x47, 0x2E, 0xEC, 0x34,
+    0xF5, 0xEE, 0x82, 0x9F, 0xF0, 0x11, 0xAF, 0xD1, 0x6B, 0xBA, 0x79, 0x78, 0x00, 0xC0, 0x6D, 0xE0,
+    0x04, 0xB2, 0x04, 0x45, 0x04, 0x2B, 0xC9, 0x4B, 0x6A, 0x5A, 0x70, 0x92, 0x8C, 0xA4, 0x3C, 0x01,
+    0x0B, 0xB0, 0x03, 0x7C, 0x07, 0xE0, 0x06, 0xF0, 0xDB, 0x1E, 0xDC, 0x76, 0x4D, 0x79, 0x3E, 0x93,
+    0x69, 0x7B, 0xA4, 0x39, 0x57, 0xEF, 0xCE, 0xB6, 0x9B, 0x07, 0xD3, 0xF9, 0x3F, 0xE7, 0x4D, 0xBB,
+    0x5D, 0x86, 0xF6, 0x3C, 0xDE, 0xC0, 0x6E, 0x03, 0xE7, 0x91, 0xAF, 0x59, 0x5C, 0x7B, 0x8F, 0x4B,
+    0xF9, 0x3E, 0xE0, 0x81, 0xAA, 0x05, 0xDB, 0x77, 0xD2, 0xD8, 0x49, 0x33, 0x64, 0x4B, 0x27, 0xA5,
+    0x4E, 0x8A, 0x50, 0x05, 0xF0, 0x35, 0x6C, 0x02, 0xDF, 0xE2, 0xFF, 0xF9, 0xB5, 0xDB, 0x64, 0xE1,
+    0x3C, 0xDE, 0x6A, 0xEC, 0xB6, 0x79, 0x9A, 0xCE, 0x5F, 0x26, 0xAB, 0xED, 0x0E, 0x7F, 0xAE, 0x80,
+    0xB6, 0x23, 0xC5, 0x79, 0xBA, 0x34, 0xFE, 0x61, 0xE0, 0xBF, 0x24, 0x16, 0x2D, 0x66, 0xA8, 0x6A,
+    0x1A, 0x1A, 0x8A, 0x48, 0x83, 0x97, 0x54, 0x48, 0x92, 0x1B, 0xC8, 0x93, 0x93, 0xD4, 0x57, 0xD2,
+    0x4C, 0x15, 0xDC, 0x80, 0x6F, 0x3B, 0xD8, 0xC9, 0x22, 0x6C, 0x65, 0x35, 0xBC, 0x01, 0x45, 0x02,
+    0x45, 0x9A, 0xAE, 0xAF, 0x5E, 0xE9, 0x2F, 0xDA, 0xD4, 0x3B, 0xAF, 0x9E, 0x06, 0x7B, 0x1B, 0x5E,
+    0x05, 0xD6, 0x29, 0xD7, 0xED, 0xFB, 0xCD, 0xAB, 0xB3, 0x97, 0xF2, 0x53, 0xA1, 0x19, 0xBB, 0x80,
+    0x6F, 0x61, 0x7F, 0x4D, 0xE0, 0x18, 0xFC, 0xC0, 0xF5, 0x04, 0x15, 0x98, 0x40, 0x16, 0xAF, 0x1D,
+    0x1C, 0x59, 0x3D, 0xB2, 0xD2, 0xB3, 0xD1, 0xFF, 0x75, 0x2A, 0xA7, 0x99, 0xD9, 0xD7, 0xDE, 0x8C,
+    0xD5, 0x13, 0xA9, 0xF7, 0x8A, 0x85, 0x22, 0x1B, 0x7B, 0x00, 0xBC, 0x06, 0xF7, 0x5E, 0x94, 0x01,
+    0xE9, 0x1F, 0x63, 0x26, 0x69, 0x44, 0xAD, 0x1F, 0xE9, 0x6A, 0x93, 0xF0, 0xC1, 0xA8, 0x75, 0xBD,
+    0x51, 0x34, 0xD1, 0xBC, 0x4C, 0x79, 0xB2, 0xB1, 0xA1, 0xB3, 0xD1, 0x85, 0xEA, 0xF9, 0x60, 0x62,
+    0xA9, 0xA1, 0x48, 0x99, 0xC6, 0x0D, 0xE1, 0x25, 0xB5, 0x4E, 0x52, 0xEF, 0x24, 0x45, 0x77, 0x26,
+    0xC5, 0xB2, 0xBF, 0xA7, 0x3D, 0xB6, 0xAE, 0xDE, 0xC9, 0xC6, 0xB5, 0x8F, 0x7C, 0x82, 0x66, 0x06,
+    0x75, 0x64, 0x73, 0x53, 0x17, 0xC9, 0x87, 0x72, 0xAA, 0x7A, 0x1B, 0x6D, 0x74, 0x83, 0x8D, 0xBE,
+    0x2F, 0xA7, 0x26, 0x14, 0xA9, 0x6B, 0xF3, 0x45, 0xFF, 0x2B, 0xCF, 0xA5, 0xF9, 0xD1, 0xE7, 0x6A,
+    0x93, 0xE9, 0x6D, 0x38, 0xE6, 0x1B, 0x4C, 0x0F, 0xAF, 0xEF, 0x01, 0x7C, 0xF3, 0x0B, 0xC9, 0xF4,
+    0x97, 0x81, 0x0E, 0x0F, 0x0F, 0x5B, 0xE9, 0x4B, 0xE9, 0xF9, 0xC5, 0xA1, 0x1D, 0x70, 0x3D, 0xAE,
+    0xC7, 0x05, 0xAA, 0x96, 0x77, 0x29, 0x07, 0x3A, 0x5C, 0x64, 0x35, 0x90, 0xEE, 0xDE, 0x7D, 0x1F,
+    0xB8, 0xAE, 0x54, 0x69, 0xF6, 0xFA, 0x18, 0xDE, 0xBC, 0x5B, 0x53, 0x28, 0x41, 0xA3, 0x1A, 0xD3,
+    0x03, 0x09, 0x70, 0x2D, 0xE4, 0x23, 0x2B, 0x21, 0xCB, 0x08, 0x74, 0x80, 0x1D, 0x20, 0x9B, 0xE1,
+    0x46, 0x15, 0x28, 0x1F, 0x24, 0xF0, 0x5D, 0x4B, 0xAE, 0x11, 0xAC, 0x80, 0x2E, 0x42, 0xB1, 0x5C,
+    0x3E, 0x62, 0xD6, 0xDD, 0x99, 0x73, 0x5D, 0x68, 0x90, 0x94, 0x4E, 0xF2, 0xD9, 0x76, 0xDC, 0xCE,
+    0x15, 0x0C, 0x4D, 0x2C, 0xCE, 0x9B, 0x4E, 0xD2, 0x87, 0x92, 0x4E, 0x75, 0xA1, 0x61, 0xE3, 0x6F,
+    0xAE, 0x5F, 0x0B, 0x4C, 0x33, 0x40, 0x93, 0xC0, 0xFF, 0x04, 0x6C, 0x80, 0x72, 0x80, 0x7C, 0x5A,
+    0xA9, 0x83, 0x67, 0x55, 0x16, 0x71, 0xED, 0x67, 0x76, 0x81, 0xAA, 0x06, 0xDB, 0xAF, 0x4A, 0x12,
+    0xFC, 0x42, 0x64, 0x52, 0x4B, 0xA7, 0x80, 0xD5, 0xB0, 0xBA, 0x04, 0x70, 0x7F, 0x9A, 0xAB, 0xCF,
+    0x16, 0x1F, 0xD7, 0xEC, 0x66, 0xF7, 0xE9, 0xE2, 0x3F, 0x13, 0x50, 0x0D, 0x3F, 0x6A, 0xD2, 0xE6,
+    0xF1, 0xEE, 0xEE, 0x5C, 0xCD, 0x94, 0xE3, 0x95, 0x66, 0x6E, 0xE6, 0x63, 0x97, 0xC8, 0x2E, 0x79,
+    0x91, 0x8D, 0x6B, 0x0C, 0x13, 0xC0, 0xB6, 0xE0, 0xB9, 0xFE, 0x7B, 0x45, 0x2F, 0x4D, 0x8D, 0xF4,
+    0x62, 0xFD, 0x5B, 0x7A, 0x9C, 0x14, 0xBD, 0x94, 0x7E, 0xAD, 0xE5, 0x61, 0x96, 0xA0, 0x18, 0xC1,
+    0xC4, 0x35, 0xED, 0x37, 0xEB, 0x2B, 0x86, 0x5D, 0x0B, 0x50, 0xCE, 0x60, 0x14, 0x30, 0xEA, 0x71,
+    0x97, 0x23, 0x57, 0x0F, 0x95, 0x7A, 0x72, 0xE9, 0x5F, 0xD0, 0x49, 0xB0, 0xA1, 0x08, 0xD7, 0xC4,
+    0x2F, 0xE1, 0x13, 0xA3, 0x8B, 0x2D, 0x24, 0x4D, 0xFC, 0xB4, 0x53, 0x00, 0x7E, 0x06, 0xC0, 0x0F,
+    0x80, 0x62, 0x02, 0xFC, 0x04, 0x59, 0x37, 0x03, 0xDD, 0x72, 0x05, 0x09, 0x36, 0xD4, 0x66, 0x9D,
+    0x52, 0x29, 0x8D, 0x74, 0xDA, 0xC3, 0xCC, 0xC0, 0x01, 0xD9, 0x16, 0x3F, 0x97, 0x32, 0x49, 0x63,
+    0xA5, 0xCF, 0xB7, 0xF2, 0x2D, 0x20, 0x13, 0xDD, 0x1D, 0x05, 0xF5, 0xCB, 0x7E, 0x73, 0xB0, 0x89,
+    0xAB, 0x6D, 0x6B, 0x82, 0x97, 0x74, 0x26, 0xE9, 0x2B, 0x49, 0x8B, 0x0D, 0x66, 0x28, 0x63, 0x3E,
+    0x65, 0x89, 0x13, 0x1A, 0x7C, 0xEB, 0x82, 0x8D, 0x65, 0x2C, 0x52, 0x36, 0x23, 0x9A, 0xDA, 0x87,
+    0xAA, 0xB7, 0x91, 0xB5, 0x2C, 0xBE, 0x75, 0x71, 0xC9, 0xF4, 0x2C, 0xD9, 0x8B, 0x9B, 0xFB, 0x9B,
+    0xC0, 0x04, 0x5E, 0x4F, 0xF6, 0x25, 0xF3, 0x54, 0xA9, 0x22, 0x71, 0x54, 0xC6, 0x3C, 0xBA, 0x60,
+    0x42, 0x43, 0x95, 0x25, 0x8E, 0xCB, 0x58, 0x8C, 0xAE, 0xB7, 0x7D, 0x53, 0xFB, 0x0F, 0x66, 0x04,
+    0x64, 0x5B, 0x34, 0xE1, 0x88, 0x26, 0x7A, 0xFC, 0x0B, 0x1B, 0x6C, 0x5B, 0xC4, 0x62, 0x20, 0x59,
+    0x45, 0x5F, 0x28, 0xD9, 0x20, 0x15, 0xB1, 0x88, 0xD9, 0x94, 0x25, 0x76, 0x69, 0x70, 0xAD, 0x0B,
+    0xE5, 0x50, 0x5E, 0x29, 0xEA, 0x2A, 0xB9, 0xDE, 0xC8, 0x8C, 0xB9, 0x7A, 0xB8, 0xE4, 0x35, 0xC5,
+    0x44, 0x57, 0x37, 0x4F, 0xA7, 0x42, 0x77, 0xF4, 0x2C, 0x95, 0x17, 0xC5, 0xF2, 0xBB, 0x87, 0x26,
+    0xAC, 0x15, 0x2E, 0x06, 0x68, 0x24, 0x3D, 0xD9, 0x6F, 0x24, 0x9D, 0x8E, 0x2B, 0xDA, 0xA1, 0x88,
+    0xF9, 0x8A, 0xD1, 0x0E, 0xE5, 0x7F, 0x70, 0xBC, 0xC2, 0x71, 0xC5, 0x62, 0xBA, 0xC4, 0x58, 0x8E,
+    0x45, 0x02, 0xE0, 0x7D, 0x5C, 0x34, 0xA3, 0x0D, 0xA5, 0x0A, 0xD5, 0x13, 0xCB, 0x7E, 0x73, 0xE0,
+    0x5A, 0xDB, 0x96, 0x7D, 0x36, 0x31, 0x71, 0x84, 0xAB, 0x25, 0xE9, 0x83, 0xD1, 0x4A, 0x9A, 0xAA,
+    0xCB, 0x0D, 0x89, 0x13, 0xAA, 0xDA, 0x05, 0x33, 0xE4, 0x63, 0x96, 0x38, 0xC1, 0xE3, 0x82, 0x1D,
+    0x8A, 0x98, 0x25, 0xB4, 0x6E, 0x62, 0x11, 0xB3, 0x19, 0xE1, 0x27, 0xD7, 0xDB, 0x58, 0xE8, 0x74,
+    0x46, 0xF8, 0x74, 0x45, 0xB4, 0xDF, 0x70, 0xD9, 0xD0, 0x78, 0xD6, 0xEE, 0xE9, 0x26, 0xAF, 0x5E,
+    0xAA, 0x34, 0xDD, 0xCF, 0xDE, 0xEB, 0x3E, 0xB6, 0x35, 0x36, 0xE4, 0x4B, 0x5D, 0x44, 0xAA, 0x85,
+    0x04, 0xF7, 0xA2, 0x07, 0x16, 0x1B, 0x8A, 0xBF, 0x77, 0x0F, 0x62, 0x21, 0xF5, 0xFA, 0x42, 0xEA,
+    0xFD, 0x72, 0x53, 0xAD, 0x55, 0x0B, 0xC0, 0xBF, 0x01,
 };
 
 static const EpdGlyph opendyslexic_10_boldGlyphs[] = {
@@ -1454,7 +1437,7 @@ static const EpdGlyph opendyslexic_10_boldGlyphs[] = {
     { 4, 19, 8, 2, 15, 19, 5157 }, // |
     { 11, 21, 12, 0, 16, 58, 5176 }, // }
     { 8, 5, 10, 1, 16, 10, 5234 }, // ~
-    { 0, 0, 18, 0, 0, 0, 0 }, //  
+    { 0, 0, 18, 0, 0, 0, 5244 }, //  
     { 7, 27, 16, 4, 23, 48, 0 }, // ¡
     { 11, 20, 16, 3, 16, 55, 48 }, // ¢
     { 14, 19, 14, 0, 18, 67, 103 }, // £
@@ -1465,625 +1448,631 @@ static const EpdGlyph opendyslexic_10_boldGlyphs[] = {
     { 11, 5, 11, 0, 17, 14, 364 }, // ¨
     { 10, 9, 14, 2, 20, 23, 378 }, // ©
     { 7, 7, 14, 4, 16, 13, 401 }, // ª
-    { 12, 12, 11, 0, 12, 36, 414 }, // «
-    { 11, 8, 13, 1, 8, 22, 450 }, // ¬
-    { 11, 3, 13, 1, 8, 9, 472 }, // ­
-    { 10, 9, 14, 2, 23, 23, 481 }, // ®
-    { 10, 4, 11, 0, 16, 10, 504 }, // ¯
-    { 10, 10, 14, 2, 16, 25, 514 }, // °
-    { 12, 14, 13, 0, 12, 42, 539 }, // ±
-    { 6, 8, 7, 0, 17, 12, 581 }, // ²
-    { 7, 8, 7, 0, 17, 14, 593 }, // ³
-    { 6, 5, 6, 0, 16, 8, 607 }, // ´
-    { 13, 15, 18, 2, 12, 49, 615 }, // µ
-    { 12, 18, 16, 2, 15, 54, 664 }, // ¶
-    { 5, 5, 5, 0, 10, 7, 718 }, // ·
-    { 6, 7, 7, 0, 1, 11, 725 }, // ¸
-    { 6, 8, 6, 0, 17, 12, 736 }, // ¹
-    { 7, 7, 14, 4, 15, 13, 748 }, // º
-    { 12, 12, 16, 2, 12, 36, 761 }, // »
-    { 19, 20, 26, 3, 18, 95, 797 }, // ¼
-    { 21, 20, 26, 3, 18, 105, 892 }, // ½
-    { 19, 19, 26, 3, 17, 91, 997 }, // ¾
-    { 13, 26, 14, 0, 15, 85, 1088 }, // ¿
-    { 18, 24, 20, 1, 24, 108, 1173 }, // À
-    { 18, 28, 20, 1, 28, 126, 1281 }, // Á
-    { 18, 26, 20, 1, 26, 117, 1407 }, // Â
-    { 18, 25, 20, 1, 25, 113, 1524 }, // Ã
-    { 18, 25, 20, 1, 25, 113, 1637 }, // Ä
-    { 18, 25, 20, 1, 25, 113, 1750 }, // Å
-    { 26, 19, 28, 1, 18, 124, 1863 }, // Æ
-    { 16, 25, 21, 2, 19, 100, 1987 }, // Ç
-    { 13, 25, 19, 3, 25, 82, 2087 }, // È
-    { 13, 28, 19, 3, 28, 91, 2169 }, // É
-    { 13, 26, 19, 3, 26, 85, 2260 }, // Ê
-    { 13, 26, 19, 3, 26, 85, 2345 }, // Ë
-    { 9, 26, 11, 0, 26, 59, 2430 }, // Ì
-    { 5, 29, 11, 3, 29, 37, 2489 }, // Í
-    { 12, 27, 11, 0, 27, 81, 2526 }, // Î
-    { 11, 27, 11, 0, 27, 75, 2607 }, // Ï
-    { 20, 18, 22, -1, 18, 90, 2682 }, // Ð
-    { 16, 25, 22, 3, 25, 100, 2772 }, // Ñ
-    { 18, 25, 24, 3, 24, 113, 2872 }, // Ò
-    { 18, 28, 24, 3, 27, 126, 2985 }, // Ó
-    { 18, 27, 24, 3, 26, 122, 3111 }, // Ô
-    { 18, 26, 24, 3, 25, 117, 3233 }, // Õ
-    { 18, 26, 24, 3, 25, 117, 3350 }, // Ö
-    { 13, 7, 12, 0, 9, 23, 3467 }, // ×
-    { 30, 41, 24, -3, 30, 308, 3490 }, // Ø
-    { 16, 26, 22, 3, 25, 104, 3798 }, // Ù
-    { 16, 30, 22, 3, 29, 120, 3902 }, // Ú
-    { 16, 28, 22, 3, 27, 112, 4022 }, // Û
-    { 16, 28, 22, 3, 27, 112, 4134 }, // Ü
-    { 17, 30, 22, 3, 30, 128, 4246 }, // Ý
-    { 10, 17, 12, 1, 17, 43, 4374 }, // Þ
-    { 13, 17, 14, 1, 16, 56, 4417 }, // ß
-    { 12, 19, 18, 3, 19, 57, 4473 }, // à
-    { 12, 22, 18, 3, 22, 66, 4530 }, // á
-    { 12, 20, 18, 3, 20, 60, 4596 }, // â
-    { 12, 19, 18, 3, 19, 57, 4656 }, // ã
-    { 12, 20, 18, 3, 20, 60, 4713 }, // ä
-    { 12, 20, 18, 3, 20, 60, 4773 }, // å
-    { 20, 13, 26, 3, 13, 65, 4833 }, // æ
-    { 11, 18, 16, 3, 13, 50, 4898 }, // ç
-    { 12, 21, 18, 3, 21, 63, 4948 }, // è
-    { 12, 24, 18, 3, 24, 72, 5011 }, // é
-    { 12, 22, 18, 3, 22, 66, 5083 }, // ê
-    { 12, 22, 18, 3, 22, 66, 5149 }, // ë
-    { 9, 18, 10, 0, 18, 41, 5215 }, // ì
-    { 5, 21, 10, 3, 21, 27, 5256 }, // í
-    { 12, 19, 10, -1, 19, 57, 5283 }, // î
-    { 10, 18, 10, 0, 18, 45, 5340 }, // ï
-    { 17, 19, 14, -1, 18, 81, 5385 }, // ð
-    { 12, 20, 18, 3, 20, 60, 5466 }, // ñ
-    { 12, 18, 18, 3, 18, 54, 5526 }, // ò
-    { 12, 22, 18, 3, 22, 66, 5580 }, // ó
-    { 12, 20, 18, 3, 20, 60, 5646 }, // ô
-    { 12, 19, 18, 3, 19, 57, 5706 }, // õ
-    { 12, 19, 18, 3, 19, 57, 5763 }, // ö
-    { 16, 15, 19, 1, 15, 60, 5820 }, // ÷
-    { 14, 35, 18, 2, 24, 123, 5880 }, // ø
-    { 12, 18, 18, 3, 18, 54, 6003 }, // ù
-    { 12, 22, 18, 3, 22, 66, 6057 }, // ú
-    { 12, 20, 18, 3, 20, 60, 6123 }, // û
-    { 12, 20, 18, 3, 20, 60, 6183 }, // ü
-    { 14, 31, 19, 3, 25, 109, 6243 }, // ý
-    { 10, 22, 12, 1, 17, 55, 6352 }, // þ
-    { 14, 28, 19, 3, 22, 98, 6407 }, // ÿ
-    { 18, 25, 20, 1, 25, 113, 0 }, // Ā
-    { 12, 20, 18, 3, 20, 60, 113 }, // ā
-    { 18, 26, 20, 1, 26, 117, 173 }, // Ă
-    { 12, 20, 18, 3, 20, 60, 290 }, // ă
-    { 18, 24, 20, 1, 18, 108, 350 }, // Ą
-    { 13, 19, 18, 3, 13, 62, 458 }, // ą
-    { 16, 25, 21, 2, 25, 100, 520 }, // Ć
-    { 11, 18, 16, 3, 18, 50, 620 }, // ć
-    { 16, 27, 21, 2, 27, 108, 670 }, // Ĉ
-    { 12, 19, 16, 2, 19, 57, 778 }, // ĉ
-    { 16, 25, 21, 2, 25, 100, 835 }, // Ċ
-    { 11, 18, 16, 3, 18, 50, 935 }, // ċ
-    { 16, 27, 21, 2, 27, 108, 985 }, // Č
-    { 12, 20, 16, 3, 20, 60, 1093 }, // č
-    { 16, 27, 22, 3, 27, 108, 1153 }, // Ď
-    { 17, 18, 18, 3, 18, 77, 1261 }, // ď
-    { 20, 18, 22, -1, 18, 90, 1338 }, // Đ
-    { 16, 18, 18, 3, 18, 72, 1428 }, // đ
-    { 13, 26, 19, 3, 26, 85, 1500 }, // Ē
-    { 12, 22, 18, 3, 22, 66, 1585 }, // ē
-    { 13, 26, 19, 3, 26, 85, 1651 }, // Ĕ
-    { 12, 22, 18, 3, 22, 66, 1736 }, // ĕ
-    { 13, 26, 19, 3, 26, 85, 1802 }, // Ė
-    { 12, 22, 18, 3, 22, 66, 1887 }, // ė
-    { 13, 23, 19, 3, 18, 75, 1953 }, // Ę
-    { 12, 20, 18, 3, 12, 60, 2028 }, // ę
-    { 13, 28, 19, 3, 28, 91, 2088 }, // Ě
-    { 12, 24, 18, 3, 24, 72, 2179 }, // ě
-    { 18, 29, 24, 3, 29, 131, 2251 }, // Ĝ
-    { 13, 28, 18, 3, 21, 91, 2382 }, // ĝ
-    { 18, 28, 24, 3, 28, 126, 2473 }, // Ğ
-    { 12, 27, 18, 3, 20, 81, 2599 }, // ğ
-    { 18, 28, 24, 3, 28, 126, 2680 }, // Ġ
-    { 12, 27, 18, 3, 20, 81, 2806 }, // ġ
-    { 18, 31, 24, 3, 31, 140, 2887 }, // Ģ
-    { 12, 28, 18, 3, 21, 84, 3027 }, // ģ
-    { 16, 26, 22, 3, 26, 104, 3111 }, // Ĥ
-    { 16, 26, 18, 0, 26, 104, 3215 }, // ĥ
-    { 18, 18, 22, 2, 18, 81, 3319 }, // Ħ
-    { 16, 18, 18, 0, 18, 72, 3400 }, // ħ
-    { 9, 27, 11, 1, 27, 61, 3472 }, // Ĩ
-    { 8, 20, 10, 1, 20, 40, 3533 }, // ĩ
-    { 12, 27, 11, -1, 27, 81, 3573 }, // Ī
-    { 12, 19, 10, -1, 19, 57, 3654 }, // ī
-    { 6, 23, 11, 2, 18, 35, 3711 }, // Į
-    { 6, 25, 10, 2, 19, 38, 3746 }, // į
-    { 5, 27, 11, 3, 27, 34, 3784 }, // İ
-    { 4, 12, 10, 3, 12, 12, 3818 }, // ı
-    { 17, 26, 33, 7, 18, 111, 3830 }, // Ĳ
-    { 13, 24, 10, 2, 19, 78, 3941 }, // ĳ
-    { 14, 31, 19, 3, 26, 109, 4019 }, // Ĵ
-    { 12, 27, 13, 2, 21, 81, 4128 }, // ĵ
-    { 16, 29, 22, 3, 29, 116, 4209 }, // Ķ
-    { 13, 29, 19, 3, 18, 95, 4325 }, // ķ
-    { 10, 12, 14, 2, 12, 30, 4420 }, // ĸ
-    { 13, 24, 19, 3, 24, 78, 4450 }, // Ĺ
-    { 7, 27, 12, 3, 27, 48, 4528 }, // ĺ
-    { 15, 28, 19, 1, 28, 105, 4576 }, // Ļ
-    { 9, 29, 12, 1, 18, 66, 4681 }, // ļ
-    { 13, 18, 19, 3, 18, 59, 4747 }, // Ľ
-    { 10, 21, 12, 3, 21, 53, 4806 }, // ľ
-    { 13, 18, 19, 3, 18, 59, 4859 }, // Ŀ
-    { 10, 18, 12, 3, 18, 45, 4918 }, // ŀ
-    { 23, 32, 19, -6, 25, 184, 4963 }, // Ł
-    { 15, 18, 12, -4, 18, 68, 5147 }, // ł
-    { 16, 25, 22, 3, 25, 100, 5215 }, // Ń
-    { 12, 20, 18, 3, 20, 60, 5315 }, // ń
-    { 16, 27, 22, 3, 18, 108, 5375 }, // Ņ
-    { 12, 21, 18, 3, 13, 63, 5483 }, // ņ
-    { 16, 27, 22, 3, 27, 108, 5546 }, // Ň
-    { 13, 22, 18, 3, 22, 72, 5654 }, // ň
-    { 12, 21, 18, 3, 21, 63, 5726 }, // ŉ
-    { 16, 23, 22, 3, 18, 92, 5789 }, // Ŋ
-    { 12, 18, 18, 3, 13, 54, 5881 }, // ŋ
-    { 18, 26, 24, 3, 25, 117, 5935 }, // Ō
-    { 12, 19, 18, 3, 19, 57, 6052 }, // ō
-    { 18, 27, 24, 3, 26, 122, 6109 }, // Ŏ
-    { 12, 20, 18, 3, 20, 60, 6231 }, // ŏ
-    { 19, 25, 24, 3, 24, 119, 6291 }, // Ő
-    { 18, 18, 18, 1, 18, 81, 6410 }, // ő
-    { 25, 20, 25, 3, 19, 125, 6491 }, // Œ
-    { 21, 12, 22, 3, 12, 63, 6616 }, // œ
-    { 14, 25, 20, 3, 25, 88, 6679 }, // Ŕ
-    { 9, 18, 15, 3, 18, 41, 6767 }, // ŕ
-    { 14, 29, 20, 3, 29, 102, 6808 }, // Ŗ
-    { 10, 22, 15, 2, 22, 55, 6910 }, // ŗ
-    { 14, 26, 20, 3, 26, 91, 6965 }, // Ř
-    { 12, 19, 15, 1, 19, 57, 7056 }, // ř
-    { 16, 26, 22, 3, 25, 104, 7113 }, // Ś
-    { 12, 19, 18, 3, 18, 57, 7217 }, // ś
-    { 16, 27, 22, 3, 26, 108, 7274 }, // Ŝ
-    { 12, 20, 18, 3, 19, 60, 7382 }, // ŝ
-    { 16, 23, 22, 3, 18, 92, 7442 }, // Ş
-    { 12, 19, 18, 3, 13, 57, 7534 }, // ş
-    { 16, 27, 22, 3, 26, 108, 7591 }, // Š
-    { 12, 21, 18, 3, 20, 63, 7699 }, // š
-    { 16, 24, 22, 3, 18, 96, 7762 }, // Ţ
-    { 11, 22, 16, 3, 17, 61, 7858 }, // ţ
-    { 16, 26, 22, 3, 26, 104, 7919 }, // Ť
-    { 14, 21, 16, 3, 20, 74, 8023 }, // ť
-    { 16, 18, 22, 3, 18, 72, 8097 }, // Ŧ
-    { 12, 18, 16, 2, 17, 54, 8169 }, // ŧ
-    { 16, 28, 22, 3, 27, 112, 8223 }, // Ũ
-    { 12, 20, 18, 3, 20, 60, 8335 }, // ũ
-    { 16, 28, 22, 3, 27, 112, 8395 }, // Ū
-    { 12, 19, 18, 3, 19, 57, 8507 }, // ū
-    { 16, 28, 22, 3, 27, 112, 8564 }, // Ŭ
-    { 12, 20, 18, 3, 20, 60, 8676 }, // ŭ
-    { 16, 29, 22, 3, 28, 116, 8736 }, // Ů
-    { 12, 21, 18, 3, 21, 63, 8852 }, // ů
-    { 18, 27, 22, 3, 26, 122, 8915 }, // Ű
-    { 18, 19, 18, 1, 19, 86, 9037 }, // ű
-    { 16, 23, 22, 3, 18, 92, 9123 }, // Ų
-    { 12, 18, 18, 3, 12, 54, 9215 }, // ų
-    { 24, 26, 30, 3, 26, 156, 9269 }, // Ŵ
-    { 17, 22, 23, 3, 21, 94, 9425 }, // ŵ
-    { 17, 28, 22, 3, 28, 119, 9519 }, // Ŷ
-    { 14, 29, 19, 3, 23, 102, 9638 }, // ŷ
-    { 17, 28, 22, 3, 28, 119, 9740 }, // Ÿ
-    { 17, 24, 23, 3, 24, 102, 9859 }, // Ź
-    { 13, 20, 18, 3, 20, 65, 9961 }, // ź
-    { 17, 24, 23, 3, 24, 102, 10026 }, // Ż
-    { 13, 20, 18, 3, 20, 65, 10128 }, // ż
-    { 17, 26, 23, 3, 26, 111, 10193 }, // Ž
-    { 13, 21, 18, 3, 21, 69, 10304 }, // ž
-    { 8, 17, 13, 2, 17, 34, 10373 }, // ſ
-    { 9, 4, 0, 0, 16, 9, 0 }, // ̀
-    { 6, 5, 0, 0, 16, 8, 9 }, // ́
-    { 12, 6, 0, 0, 1, 18, 17 }, // ̂
-    { 8, 5, 0, 1, 16, 10, 35 }, // ̃
-    { 12, 4, 0, 0, 15, 12, 45 }, // ̄
-    { 15, 4, 0, 0, 19, 15, 57 }, // ̅
-    { 11, 6, 0, 0, 16, 17, 72 }, // ̆
-    { 5, 5, 0, 3, 17, 7, 89 }, // ̇
-    { 10, 4, 0, 0, 15, 10, 96 }, // ̈
-    { 5, 5, 0, 4, 14, 7, 106 }, // ̉
-    { 5, 5, 0, 1, 16, 7, 113 }, // ̊
-    { 19, 4, 0, 0, 16, 19, 120 }, // ̋
-    { 12, 6, 0, 0, 17, 18, 139 }, // ̌
-    { 18, 4, 0, -5, 16, 18, 157 }, // ̏
-    { 7, 8, 0, 0, 17, 14, 175 }, // ̒
-    { 8, 8, 0, 0, 16, 16, 189 }, // ̓
-    { 8, 8, 0, -1, 16, 16, 205 }, // ̔
-    { 5, 6, 0, 1, 0, 8, 221 }, // ̘
-    { 5, 6, 0, 1, 0, 8, 229 }, // ̙
-    { 10, 6, 0, 1, 17, 15, 237 }, // ̚
-    { 5, 6, 0, 0, 14, 8, 252 }, // ̛
-    { 4, 7, 0, 1, 0, 7, 260 }, // ̜
-    { 6, 5, 0, 1, 3, 8, 267 }, // ̝
-    { 6, 5, 0, 1, 0, 8, 275 }, // ̞
-    { 5, 5, 0, 1, -2, 7, 283 }, // ̟
-    { 12, 4, 0, 0, -2, 12, 290 }, // ̠
-    { 6, 5, 0, 0, 2, 8, 302 }, // ̣
-    { 10, 4, 0, 0, -1, 10, 310 }, // ̤
-    { 5, 5, 0, 1, 16, 7, 320 }, // ̥
-    { 7, 8, 0, 0, 4, 14, 327 }, // ̦
-    { 6, 7, 0, 0, 1, 11, 341 }, // ̧
-    { 6, 8, 0, 1, 2, 12, 352 }, // ̨
-    { 5, 7, 0, 0, -1, 9, 364 }, // ̩
-    { 9, 5, 0, 0, 0, 12, 373 }, // ̪
-    { 13, 6, 0, -1, 1, 20, 385 }, // ̬
-    { 13, 6, 0, -1, 1, 20, 405 }, // ̭
-    { 9, 6, 0, 1, 18, 14, 425 }, // ̰
-    { 10, 4, 0, 1, 18, 10, 439 }, // ̱
-    { 11, 4, 0, 0, -1, 11, 449 }, // ̲
-    { 9, 6, 0, 1, 18, 14, 460 }, // ̴
-    { 11, 3, 0, 0, 8, 9, 474 }, // ̵
-    { 5, 8, 0, 0, 1, 10, 483 }, // ̹
-    { 10, 7, 0, 0, 1, 18, 493 }, // ̺
-    { 9, 7, 0, 0, 1, 16, 511 }, // ̻
-    { 9, 6, 0, 0, 1, 14, 527 }, // ̼
-    { 7, 5, 0, 1, 16, 9, 541 }, // ̽
-    { 8, 5, 0, 1, 16, 10, 550 }, // ͂
-    { 4, 6, 0, 5, 19, 6, 560 }, // ̓
-    { 10, 15, 0, 1, 26, 38, 566 }, // ̈́
-    { 9, 5, 0, 0, 17, 12, 604 }, // ͆
-    { 12, 8, 0, 0, 0, 24, 616 }, // ͇
-    { 9, 7, 0, 1, 1, 16, 640 }, // ͈
-    { 7, 6, 0, 1, -1, 11, 656 }, // ͉
-    { 11, 16, 0, 1, 22, 44, 667 }, // ͊
-    { 19, 16, 0, 1, 24, 76, 711 }, // ͋
-    { 12, 12, 0, 9, 12, 36, 787 }, // ͌
-    { 11, 6, 0, 1, -2, 17, 823 }, // ͍
-    { 5, 4, 0, 0, 3, 5, 840 }, // ͎
-    { 19, 6, 0, 0, 2, 29, 845 }, // ͜
-    { 19, 6, 0, 0, 17, 29, 874 }, // ͡
-    { 22, 7, 0, 1, 0, 39, 903 }, // ͢
-    { 13, 25, 19, 3, 25, 82, 0 }, // Ѐ
-    { 13, 26, 19, 3, 26, 85, 82 }, // Ё
-    { 18, 20, 14, -3, 18, 90, 167 }, // Ђ
-    { 12, 25, 14, 1, 24, 75, 257 }, // Ѓ
-    { 16, 18, 17, 1, 16, 72, 332 }, // Є
-    { 16, 19, 22, 3, 18, 76, 404 }, // Ѕ
-    { 5, 18, 11, 3, 18, 23, 480 }, // І
-    { 10, 26, 11, 0, 26, 65, 503 }, // Ї
-    { 13, 23, 19, 3, 18, 75, 568 }, // Ј
-    { 20, 18, 24, 2, 16, 90, 643 }, // Љ
-    { 20, 17, 13, -4, 16, 85, 733 }, // Њ
-    { 19, 19, 22, 3, 19, 91, 818 }, // Ћ
-    { 16, 24, 22, 3, 24, 96, 909 }, // Ќ
-    { 16, 27, 22, 3, 27, 108, 1005 }, // Ѝ
-    { 14, 27, 17, 1, 25, 95, 1113 }, // Ў
-    { 13, 21, 17, 2, 16, 69, 1208 }, // Џ
-    { 18, 18, 20, 1, 18, 81, 1277 }, // А
-    { 11, 17, 14, 1, 16, 47, 1358 }, // Б
-    { 12, 17, 14, 1, 16, 51, 1405 }, // В
-    { 12, 17, 14, 1, 16, 51, 1456 }, // Г
-    { 17, 19, 17, 0, 16, 81, 1507 }, // Д
-    { 13, 18, 19, 3, 18, 59, 1588 }, // Е
-    { 26, 18, 23, -1, 18, 117, 1647 }, // Ж
-    { 11, 16, 13, 1, 16, 44, 1764 }, // З
-    { 16, 18, 22, 3, 18, 72, 1808 }, // И
-    { 16, 28, 22, 3, 28, 112, 1880 }, // Й
-    { 16, 18, 22, 3, 18, 72, 1992 }, // К
-    { 14, 18, 13, -1, 16, 63, 2064 }, // Л
-    { 16, 17, 18, 1, 16, 68, 2127 }, // М
-    { 16, 18, 22, 3, 18, 72, 2195 }, // Н
-    { 18, 19, 24, 3, 18, 86, 2267 }, // О
-    { 13, 17, 14, 1, 16, 56, 2353 }, // П
-    { 13, 18, 19, 3, 18, 59, 2409 }, // Р
-    { 16, 19, 21, 2, 19, 76, 2468 }, // С
-    { 16, 18, 22, 3, 18, 72, 2544 }, // Т
-    { 14, 18, 17, 1, 16, 63, 2616 }, // У
-    { 16, 16, 18, 1, 16, 64, 2679 }, // Ф
-    { 17, 18, 23, 3, 18, 77, 2743 }, // Х
-    { 13, 20, 15, 1, 16, 65, 2820 }, // Ц
-    { 12, 16, 14, 1, 16, 48, 2885 }, // Ч
-    { 15, 17, 17, 1, 16, 64, 2933 }, // Ш
-    { 17, 20, 19, 1, 16, 85, 2997 }, // Щ
-    { 16, 16, 13, -4, 16, 64, 3082 }, // Ъ
-    { 20, 18, 24, 1, 18, 90, 3146 }, // Ы
-    { 11, 16, 13, 1, 16, 44, 3236 }, // Ь
-    { 16, 18, 17, 1, 16, 72, 3280 }, // Э
-    { 17, 16, 19, 1, 16, 68, 3352 }, // Ю
-    { 14, 18, 20, 3, 18, 63, 3420 }, // Я
-    { 12, 13, 18, 3, 13, 39, 3483 }, // а
-    { 13, 20, 14, 1, 19, 65, 3522 }, // б
-    { 11, 12, 15, 2, 12, 33, 3587 }, // в
-    { 11, 13, 12, 1, 12, 36, 3620 }, // г
-    { 15, 15, 16, 0, 12, 57, 3656 }, // д
-    { 12, 12, 18, 3, 12, 36, 3713 }, // е
-    { 24, 15, 30, 3, 15, 90, 3749 }, // ж
-    { 8, 11, 9, 1, 11, 22, 3839 }, // з
-    { 12, 13, 14, 1, 12, 39, 3861 }, // и
-    { 11, 20, 14, 1, 20, 55, 3900 }, // й
-    { 13, 12, 17, 2, 12, 39, 3955 }, // к
-    { 10, 13, 9, -1, 11, 33, 3994 }, // л
-    { 14, 13, 18, 2, 13, 46, 4027 }, // м
-    { 13, 13, 17, 2, 13, 43, 4073 }, // н
-    { 12, 12, 18, 3, 12, 36, 4116 }, // о
-    { 12, 13, 14, 1, 12, 39, 4152 }, // п
-    { 14, 19, 20, 3, 13, 67, 4191 }, // р
-    { 11, 13, 16, 3, 13, 36, 4258 }, // с
-    { 13, 13, 14, 1, 12, 43, 4294 }, // т
-    { 14, 18, 19, 3, 12, 63, 4337 }, // у
-    { 18, 17, 18, 0, 12, 77, 4400 }, // ф
-    { 15, 13, 15, 0, 12, 49, 4477 }, // х
-    { 13, 15, 15, 1, 12, 49, 4526 }, // ц
-    { 8, 11, 9, 1, 11, 22, 4575 }, // ч
-    { 15, 13, 17, 1, 12, 49, 4597 }, // ш
-    { 17, 16, 19, 1, 12, 68, 4646 }, // щ
-    { 12, 12, 10, -3, 12, 36, 4714 }, // ъ
-    { 16, 14, 18, 0, 14, 56, 4750 }, // ы
-    { 9, 12, 10, 0, 12, 27, 4806 }, // ь
-    { 11, 12, 13, 1, 12, 33, 4833 }, // э
-    { 14, 12, 15, 1, 12, 42, 4866 }, // ю
-    { 13, 13, 17, 2, 13, 43, 4908 }, // я
-    { 12, 22, 18, 3, 22, 66, 4951 }, // ѐ
-    { 12, 21, 18, 3, 21, 63, 5017 }, // ё
-    { 16, 21, 18, 0, 18, 84, 5080 }, // ђ
-    { 11, 18, 12, 1, 17, 50, 5164 }, // ѓ
-    { 12, 12, 12, 0, 11, 36, 5214 }, // є
-    { 12, 14, 18, 3, 13, 42, 5250 }, // ѕ
-    { 6, 19, 10, 2, 19, 29, 5292 }, // і
-    { 10, 18, 10, 0, 18, 45, 5321 }, // ї
-    { 8, 25, 13, 3, 19, 50, 5366 }, // ј
-    { 15, 13, 17, 1, 11, 49, 5416 }, // љ
-    { 14, 12, 9, -3, 12, 42, 5465 }, // њ
-    { 16, 18, 18, 0, 18, 72, 5507 }, // ћ
-    { 13, 18, 17, 2, 18, 59, 5579 }, // ќ
-    { 12, 20, 14, 1, 19, 60, 5638 }, // ѝ
-    { 14, 28, 19, 3, 22, 98, 5698 }, // ў
-    { 10, 15, 12, 1, 12, 38, 5796 }, // џ
-    { 15, 18, 16, 0, 16, 68, 5834 }, // Ѣ
-    { 15, 18, 14, -1, 16, 68, 5902 }, // ѣ
-    { 20, 17, 18, -1, 16, 85, 5970 }, // Ѫ
-    { 14, 12, 13, -1, 12, 42, 6055 }, // ѫ
-    { 16, 23, 23, 4, 23, 92, 6097 }, // Ѳ
-    { 13, 17, 18, 3, 17, 56, 6189 }, // ѳ
-    { 20, 22, 24, 3, 22, 110, 6245 }, // Ѵ
-    { 14, 15, 18, 2, 15, 53, 6355 }, // ѵ
-    { 9, 8, 0, 2, 20, 18, 6408 }, // ҆
-    { 12, 19, 14, 1, 18, 57, 6426 }, // Ґ
-    { 11, 16, 12, 1, 15, 44, 6483 }, // ґ
-    { 14, 17, 14, -1, 16, 60, 6527 }, // Ғ
-    { 10, 11, 9, -1, 11, 28, 6587 }, // ғ
-    { 14, 20, 13, -1, 18, 70, 6615 }, // Ҕ
-    { 8, 12, 8, 0, 11, 24, 6685 }, // ҕ
-    { 27, 22, 30, 2, 18, 149, 6709 }, // Җ
-    { 19, 15, 21, 1, 12, 72, 6858 }, // җ
-    { 11, 19, 13, 1, 16, 53, 6930 }, // Ҙ
-    { 8, 17, 9, 1, 11, 34, 6983 }, // ҙ
-    { 17, 22, 15, 2, 18, 94, 7017 }, // Қ
-    { 12, 15, 10, 1, 12, 45, 7111 }, // қ
-    { 20, 18, 23, 1, 17, 90, 7156 }, // Ҝ
-    { 14, 12, 16, 1, 12, 42, 7246 }, // ҝ
-    { 16, 18, 22, 3, 18, 72, 7288 }, // Ҟ
-    { 15, 18, 19, 1, 18, 68, 7360 }, // ҟ
-    { 19, 18, 22, 0, 18, 86, 7428 }, // Ҡ
-    { 13, 12, 15, 0, 12, 39, 7514 }, // ҡ
-    { 17, 21, 16, 0, 18, 90, 7553 }, // Ң
-    { 12, 14, 11, 0, 12, 42, 7643 }, // ң
-    { 23, 18, 22, 3, 18, 104, 7685 }, // Ҥ
-    { 16, 12, 15, 2, 12, 48, 7789 }, // ҥ
-    { 23, 20, 27, 2, 18, 115, 7837 }, // Ҧ
-    { 20, 22, 26, 3, 15, 110, 7952 }, // ҧ
-    { 21, 17, 14, -3, 16, 90, 8062 }, // Ҩ
-    { 17, 14, 11, -3, 13, 60, 8152 }, // ҩ
-    { 16, 22, 21, 2, 19, 88, 8212 }, // Ҫ
-    { 11, 16, 16, 3, 13, 44, 8300 }, // ҫ
-    { 17, 21, 16, 0, 18, 90, 8344 }, // Ҭ
-    { 12, 14, 11, 0, 12, 42, 8434 }, // ҭ
-    { 17, 18, 22, 3, 18, 77, 8476 }, // Ү
-    { 13, 17, 16, 1, 12, 56, 8553 }, // ү
-    { 17, 18, 22, 3, 18, 77, 8609 }, // Ұ
-    { 14, 17, 16, 1, 12, 60, 8686 }, // ұ
-    { 17, 21, 16, 3, 18, 90, 8746 }, // Ҳ
-    { 12, 14, 11, 2, 12, 42, 8836 }, // ҳ
-    { 19, 20, 13, -3, 15, 95, 8878 }, // Ҵ
-    { 15, 14, 9, -3, 11, 53, 8973 }, // ҵ
-    { 14, 21, 14, 0, 16, 74, 9026 }, // Ҷ
-    { 10, 15, 10, 0, 11, 38, 9100 }, // ҷ
-    { 12, 16, 14, 1, 16, 48, 9138 }, // Ҹ
-    { 8, 11, 9, 1, 11, 22, 9186 }, // ҹ
-    { 13, 19, 14, 1, 18, 62, 9208 }, // Һ
-    { 13, 18, 18, 3, 18, 59, 9270 }, // һ
-    { 23, 17, 20, -4, 16, 98, 9329 }, // Ҽ
-    { 17, 12, 15, -3, 12, 51, 9427 }, // ҽ
-    { 23, 20, 19, -3, 16, 115, 9478 }, // Ҿ
-    { 17, 15, 13, -2, 12, 64, 9593 }, // ҿ
-    { 5, 18, 11, 3, 18, 23, 9657 }, // Ӏ
-    { 26, 28, 23, -1, 28, 182, 9680 }, // Ӂ
-    { 24, 24, 30, 3, 24, 144, 9862 }, // ӂ
-    { 13, 22, 15, 1, 16, 72, 10006 }, // Ӄ
-    { 10, 16, 10, 0, 12, 40, 10078 }, // ӄ
-    { 16, 21, 13, -1, 16, 84, 10118 }, // Ӆ
-    { 11, 14, 9, -1, 11, 39, 10202 }, // ӆ
-    { 17, 24, 22, 3, 18, 102, 10241 }, // Ӈ
-    { 12, 16, 15, 2, 12, 48, 10343 }, // ӈ
-    { 17, 25, 22, 3, 18, 107, 10391 }, // Ӊ
-    { 12, 17, 15, 2, 12, 51, 10498 }, // ӊ
-    { 12, 21, 14, 1, 16, 63, 10549 }, // Ӌ
-    { 9, 14, 13, 2, 11, 32, 10612 }, // ӌ
-    { 20, 26, 24, 3, 18, 130, 10644 }, // Ӎ
-    { 14, 17, 17, 2, 12, 60, 10774 }, // ӎ
-    { 5, 16, 13, 4, 15, 20, 10834 }, // ӏ
-    { 18, 25, 20, 1, 25, 113, 10854 }, // Ӑ
-    { 12, 20, 18, 3, 20, 60, 10967 }, // ӑ
-    { 18, 24, 20, 1, 24, 108, 11027 }, // Ӓ
-    { 13, 20, 18, 2, 20, 65, 11135 }, // ӓ
-    { 26, 19, 28, 1, 18, 124, 11200 }, // Ӕ
-    { 20, 13, 26, 3, 13, 65, 11324 }, // ӕ
-    { 13, 26, 19, 3, 26, 85, 11389 }, // Ӗ
-    { 12, 22, 18, 3, 22, 66, 11474 }, // ӗ
-    { 15, 18, 22, 4, 17, 68, 11540 }, // Ә
-    { 12, 14, 18, 4, 13, 42, 11608 }, // ә
-    { 15, 24, 22, 4, 23, 90, 11650 }, // Ӛ
-    { 12, 17, 18, 4, 13, 51, 11740 }, // ӛ
-    { 26, 27, 29, 2, 27, 176, 11791 }, // Ӝ
-    { 24, 23, 30, 3, 23, 138, 11967 }, // ӝ
-    { 11, 25, 13, 1, 25, 69, 12105 }, // Ӟ
-    { 10, 16, 9, -1, 16, 40, 12174 }, // ӟ
-    { 11, 17, 14, 2, 16, 47, 12214 }, // Ӡ
-    { 11, 17, 14, 2, 12, 47, 12261 }, // ӡ
-    { 16, 27, 22, 3, 27, 108, 12308 }, // Ӣ
-    { 12, 20, 14, 1, 19, 60, 12416 }, // ӣ
-    { 16, 26, 22, 3, 26, 104, 12476 }, // Ӥ
-    { 12, 19, 14, 1, 18, 57, 12580 }, // ӥ
-    { 18, 25, 24, 3, 24, 113, 12637 }, // Ӧ
-    { 13, 21, 18, 2, 21, 69, 12750 }, // ӧ
-    { 16, 17, 23, 4, 17, 68, 12819 }, // Ө
-    { 12, 12, 18, 3, 12, 36, 12887 }, // ө
-    { 16, 23, 23, 4, 23, 92, 12923 }, // Ӫ
-    { 12, 18, 18, 3, 18, 54, 13015 }, // ӫ
-    { 16, 27, 17, 1, 25, 108, 13069 }, // Ӭ
-    { 11, 17, 13, 1, 17, 47, 13177 }, // ӭ
-    { 14, 27, 17, 1, 25, 95, 13224 }, // Ӯ
-    { 14, 28, 19, 3, 22, 98, 13319 }, // ӯ
-    { 14, 26, 17, 1, 24, 91, 13417 }, // Ӱ
-    { 14, 27, 19, 3, 21, 95, 13508 }, // ӱ
-    { 18, 26, 17, 1, 24, 117, 13603 }, // Ӳ
-    { 19, 27, 19, 2, 21, 129, 13720 }, // ӳ
-    { 12, 20, 14, 1, 20, 60, 13849 }, // Ӵ
-    { 10, 15, 9, 0, 15, 38, 13909 }, // ӵ
-    { 12, 19, 14, 1, 16, 57, 13947 }, // Ӷ
-    { 9, 13, 9, 0, 11, 30, 14004 }, // ӷ
-    { 20, 27, 24, 1, 27, 135, 14034 }, // Ӹ
-    { 16, 22, 18, 0, 22, 88, 14169 }, // ӹ
-    { 19, 20, 23, 3, 18, 95, 14257 }, // Ӽ
-    { 14, 14, 16, 2, 12, 49, 14352 }, // ӽ
-    { 0, 0, 14, 0, 0, 0, 0 }, //  
-    { 0, 0, 24, 0, 0, 0, 0 }, //  
-    { 0, 0, 14, 0, 0, 0, 0 }, //  
-    { 0, 0, 24, 0, 0, 0, 0 }, //  
-    { 0, 0, 10, 0, 0, 0, 0 }, //  
-    { 0, 0, 9, 0, 0, 0, 0 }, //  
-    { 0, 0, 7, 0, 0, 0, 0 }, //  
-    { 0, 0, 15, 0, 0, 0, 0 }, //  
-    { 0, 0, 5, 0, 0, 0, 0 }, //  
-    { 0, 0, 8, 0, 0, 0, 0 }, //  
-    { 0, 0, 6, 0, 0, 0, 0 }, //  
-    { 0, 0, 3, 0, 0, 0, 0 }, // ​
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‍
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‎
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‏
-    { 11, 3, 11, 0, 8, 9, 0 }, // ‐
-    { 11, 3, 11, 0, 8, 9, 9 }, // ‑
-    { 17, 3, 11, -3, 8, 13, 18 }, // ‒
-    { 15, 5, 17, 1, 9, 19, 31 }, // –
-    { 22, 5, 24, 1, 9, 28, 50 }, // —
-    { 22, 5, 24, 1, 9, 28, 78 }, // ―
-    { 10, 19, 11, 2, 15, 48, 106 }, // ‖
-    { 18, 8, 11, -3, -1, 36, 154 }, // ‗
-    { 7, 8, 9, 1, 19, 14, 190 }, // ‘
-    { 7, 8, 9, 1, 19, 14, 204 }, // ’
-    { 7, 8, 7, 0, 4, 14, 218 }, // ‚
-    { 7, 8, 9, 1, 19, 14, 232 }, // ‛
-    { 14, 8, 16, 1, 19, 28, 246 }, // “
-    { 14, 8, 16, 1, 19, 28, 274 }, // ”
-    { 7, 8, 7, 0, 4, 14, 302 }, // „
-    { 14, 8, 16, 1, 19, 28, 316 }, // ‟
-    { 13, 30, 17, 2, 22, 98, 344 }, // †
-    { 13, 29, 18, 3, 21, 95, 442 }, // ‡
-    { 17, 16, 11, -3, 19, 68, 537 }, // •
-    { 7, 8, 13, 3, 10, 14, 605 }, // ‣
-    { 6, 5, 13, 3, 5, 8, 619 }, // ․
-    { 6, 5, 13, 3, 5, 8, 627 }, // ‥
-    { 20, 5, 20, 0, 5, 25, 635 }, // …
-    { 3, 3, 11, 4, 8, 3, 660 }, // ‧
-    { 0, 0, 23, 0, 0, 0, 663 }, //  
-    { 16, 19, 24, 4, 17, 76, 663 }, // ‰
-    { 8, 8, 11, 3, 19, 16, 739 }, // ′
-    { 15, 8, 16, 3, 19, 30, 755 }, // ″
-    { 17, 7, 9, 1, 18, 30, 785 }, // ‴
-    { 6, 7, 9, 1, 18, 11, 815 }, // ‵
-    { 10, 7, 9, 0, 18, 18, 826 }, // ‶
-    { 17, 7, 9, -4, 18, 30, 844 }, // ‷
-    { 12, 5, 14, 1, 18, 15, 874 }, // ‸
-    { 7, 12, 9, 1, 12, 21, 889 }, // ‹
-    { 7, 12, 9, 1, 12, 21, 910 }, // ›
-    { 22, 28, 28, 4, 22, 154, 931 }, // ※
-    { 6, 27, 13, 3, 24, 41, 1085 }, // ‼
-    { 13, 33, 18, 2, 28, 108, 1126 }, // ‽
-    { 11, 3, 11, 0, 18, 9, 1234 }, // ‾
-    { 11, 4, 12, 0, 14, 11, 1243 }, // ‿
-    { 15, 15, 13, -1, 19, 57, 1254 }, // ⁂
-    { 14, 18, 26, 6, 16, 63, 1311 }, // ⁄
-    { 26, 27, 31, 3, 24, 176, 1374 }, // ⁇
-    { 22, 28, 25, 2, 24, 154, 1550 }, // ⁈
-    { 17, 27, 16, -1, 24, 115, 1704 }, // ⁉
-    { 16, 36, 19, 2, 25, 144, 1819 }, // ⁒
-    { 0, 0, 97, 0, 0, 0, 1963 }, //  
-    { 7, 9, 7, 0, 18, 16, 0 }, // ⁰
-    { 7, 8, 7, 0, 18, 14, 16 }, // ⁴
-    { 7, 9, 7, 0, 18, 16, 30 }, // ⁵
-    { 7, 9, 7, 0, 18, 16, 46 }, // ⁶
-    { 7, 9, 8, 0, 18, 16, 62 }, // ⁷
-    { 7, 9, 8, 0, 18, 16, 78 }, // ⁸
-    { 7, 10, 8, 0, 18, 18, 94 }, // ⁹
-    { 12, 13, 18, 3, 13, 39, 112 }, // ⁿ
-    { 7, 9, 7, 0, 5, 16, 151 }, // ₀
-    { 7, 9, 7, 0, 5, 16, 167 }, // ₁
-    { 7, 9, 8, 0, 5, 16, 183 }, // ₂
-    { 7, 9, 7, 0, 5, 16, 199 }, // ₃
-    { 7, 8, 8, 0, 5, 14, 215 }, // ₄
-    { 7, 9, 7, 0, 5, 16, 229 }, // ₅
-    { 7, 9, 8, 0, 5, 16, 245 }, // ₆
-    { 7, 10, 8, 0, 6, 18, 261 }, // ₇
-    { 7, 9, 8, 0, 5, 16, 279 }, // ₈
-    { 7, 9, 8, 0, 5, 16, 295 }, // ₉
-    { 9, 29, 10, 1, 22, 66, 311 }, // ₍
-    { 9, 29, 9, -1, 22, 66, 377 }, // ₎
-    { 16, 27, 21, 2, 23, 108, 0 }, // ₡
-    { 16, 19, 21, 2, 19, 76, 108 }, // ₢
-    { 14, 19, 14, 0, 18, 67, 184 }, // ₤
-    { 23, 18, 22, -1, 18, 104, 251 }, // ₦
-    { 19, 18, 19, 0, 18, 86, 355 }, // ₧
-    { 23, 19, 27, 2, 18, 110, 441 }, // ₨
-    { 18, 18, 18, 0, 18, 81, 551 }, // ₩
-    { 16, 16, 22, 3, 16, 64, 632 }, // ₪
-    { 16, 18, 11, -2, 17, 72, 696 }, // ₫
-    { 15, 20, 16, 0, 17, 75, 768 }, // €
-    { 16, 18, 22, 3, 18, 72, 843 }, // ₮
-    { 21, 18, 13, -1, 18, 95, 915 }, // ₱
-    { 18, 27, 24, 3, 23, 122, 1010 }, // ₲
-    { 21, 18, 22, 4, 17, 95, 1132 }, // ₴
-    { 11, 17, 12, 3, 15, 47, 1227 }, // ₵
-    { 18, 19, 22, 2, 19, 86, 1274 }, // ₸
-    { 12, 17, 14, 1, 16, 51, 1360 }, // ₹
-    { 13, 16, 14, 1, 14, 52, 1411 }, // ₺
-    { 15, 17, 17, 1, 17, 64, 1463 }, // ₼
-    { 18, 18, 19, -2, 18, 81, 1527 }, // ₽
-    { 15, 14, 15, 0, 12, 53, 0 }, // ←
-    { 16, 15, 16, 0, 14, 60, 53 }, // ↑
-    { 14, 14, 16, 1, 12, 49, 113 }, // →
-    { 16, 14, 16, 0, 13, 56, 162 }, // ↓
-    { 17, 12, 21, 2, 12, 51, 218 }, // ↔
-    { 13, 17, 17, 2, 19, 56, 269 }, // ↕
-    { 12, 12, 16, 2, 12, 36, 325 }, // ↖
-    { 13, 12, 13, 0, 12, 39, 361 }, // ↗
-    { 13, 12, 13, 0, 12, 39, 400 }, // ↘
-    { 12, 12, 13, 1, 12, 36, 439 }, // ↙
-    { 16, 14, 20, 2, 13, 56, 475 }, // ⇐
-    { 18, 17, 22, 2, 16, 77, 531 }, // ⇑
-    { 16, 14, 20, 2, 13, 56, 608 }, // ⇒
-    { 18, 17, 22, 2, 15, 77, 664 }, // ⇓
-    { 19, 14, 23, 2, 13, 67, 741 }, // ⇔
-    { 14, 18, 19, 2, 10, 63, 808 }, // ⇕
-    { 13, 19, 14, 1, 18, 62, 0 }, // ∂
-    { 21, 20, 24, 1, 19, 105, 62 }, // ∅
-    { 16, 17, 18, 1, 16, 68, 167 }, // ∆
-    { 14, 16, 15, 1, 15, 56, 235 }, // ∏
-    { 14, 17, 15, 1, 16, 60, 291 }, // ∐
-    { 11, 16, 12, 1, 15, 44, 351 }, // ∑
-    { 12, 4, 13, 0, 8, 12, 395 }, // −
-    { 18, 19, 20, 1, 18, 86, 407 }, // √
-    { 17, 12, 19, 1, 14, 51, 493 }, // ∞
-    { 17, 23, 18, 0, 17, 98, 544 }, // ∫
-    { 6, 14, 7, 0, 14, 21, 642 }, // ∶
-    { 12, 12, 30, 9, 12, 36, 663 }, // ≈
-    { 16, 19, 26, 5, 17, 76, 699 }, // ≠
-    { 18, 18, 17, -1, 16, 81, 775 }, // ≤
-    { 18, 18, 18, 0, 16, 81, 856 }, // ≥
+    { 12, 12, 11, 0, 12, 36, 5244 }, // «
+    { 11, 8, 13, 1, 8, 22, 414 }, // ¬
+    { 11, 3, 13, 1, 8, 9, 436 }, // ­
+    { 10, 9, 14, 2, 23, 23, 445 }, // ®
+    { 10, 4, 11, 0, 16, 10, 468 }, // ¯
+    { 10, 10, 14, 2, 16, 25, 478 }, // °
+    { 12, 14, 13, 0, 12, 42, 503 }, // ±
+    { 6, 8, 7, 0, 17, 12, 545 }, // ²
+    { 7, 8, 7, 0, 17, 14, 557 }, // ³
+    { 6, 5, 6, 0, 16, 8, 571 }, // ´
+    { 13, 15, 18, 2, 12, 49, 579 }, // µ
+    { 12, 18, 16, 2, 15, 54, 628 }, // ¶
+    { 5, 5, 5, 0, 10, 7, 682 }, // ·
+    { 6, 7, 7, 0, 1, 11, 689 }, // ¸
+    { 6, 8, 6, 0, 17, 12, 700 }, // ¹
+    { 7, 7, 14, 4, 15, 13, 712 }, // º
+    { 12, 12, 16, 2, 12, 36, 5280 }, // »
+    { 19, 20, 26, 3, 18, 95, 725 }, // ¼
+    { 21, 20, 26, 3, 18, 105, 820 }, // ½
+    { 19, 19, 26, 3, 17, 91, 925 }, // ¾
+    { 13, 26, 14, 0, 15, 85, 1016 }, // ¿
+    { 18, 24, 20, 1, 24, 108, 5316 }, // À
+    { 18, 28, 20, 1, 28, 126, 5424 }, // Á
+    { 18, 26, 20, 1, 26, 117, 5550 }, // Â
+    { 18, 25, 20, 1, 25, 113, 1101 }, // Ã
+    { 18, 25, 20, 1, 25, 113, 5667 }, // Ä
+    { 18, 25, 20, 1, 25, 113, 1214 }, // Å
+    { 26, 19, 28, 1, 18, 124, 1327 }, // Æ
+    { 16, 25, 21, 2, 19, 100, 5780 }, // Ç
+    { 13, 25, 19, 3, 25, 82, 5880 }, // È
+    { 13, 28, 19, 3, 28, 91, 5962 }, // É
+    { 13, 26, 19, 3, 26, 85, 6053 }, // Ê
+    { 13, 26, 19, 3, 26, 85, 6138 }, // Ë
+    { 9, 26, 11, 0, 26, 59, 6223 }, // Ì
+    { 5, 29, 11, 3, 29, 37, 6282 }, // Í
+    { 12, 27, 11, 0, 27, 81, 6319 }, // Î
+    { 11, 27, 11, 0, 27, 75, 6400 }, // Ï
+    { 20, 18, 22, -1, 18, 90, 1451 }, // Ð
+    { 16, 25, 22, 3, 25, 100, 6475 }, // Ñ
+    { 18, 25, 24, 3, 24, 113, 6575 }, // Ò
+    { 18, 28, 24, 3, 27, 126, 6688 }, // Ó
+    { 18, 27, 24, 3, 26, 122, 6814 }, // Ô
+    { 18, 26, 24, 3, 25, 117, 1541 }, // Õ
+    { 18, 26, 24, 3, 25, 117, 6936 }, // Ö
+    { 13, 7, 12, 0, 9, 23, 1658 }, // ×
+    { 30, 41, 24, -3, 30, 308, 1681 }, // Ø
+    { 16, 26, 22, 3, 25, 104, 7053 }, // Ù
+    { 16, 30, 22, 3, 29, 120, 7157 }, // Ú
+    { 16, 28, 22, 3, 27, 112, 7277 }, // Û
+    { 16, 28, 22, 3, 27, 112, 7389 }, // Ü
+    { 17, 30, 22, 3, 30, 128, 1989 }, // Ý
+    { 10, 17, 12, 1, 17, 43, 2117 }, // Þ
+    { 13, 17, 14, 1, 16, 56, 2160 }, // ß
+    { 12, 19, 18, 3, 19, 57, 7501 }, // à
+    { 12, 22, 18, 3, 22, 66, 7558 }, // á
+    { 12, 20, 18, 3, 20, 60, 7624 }, // â
+    { 12, 19, 18, 3, 19, 57, 2216 }, // ã
+    { 12, 20, 18, 3, 20, 60, 7684 }, // ä
+    { 12, 20, 18, 3, 20, 60, 2273 }, // å
+    { 20, 13, 26, 3, 13, 65, 2333 }, // æ
+    { 11, 18, 16, 3, 13, 50, 7744 }, // ç
+    { 12, 21, 18, 3, 21, 63, 7794 }, // è
+    { 12, 24, 18, 3, 24, 72, 7857 }, // é
+    { 12, 22, 18, 3, 22, 66, 7929 }, // ê
+    { 12, 22, 18, 3, 22, 66, 7995 }, // ë
+    { 9, 18, 10, 0, 18, 41, 8061 }, // ì
+    { 5, 21, 10, 3, 21, 27, 8102 }, // í
+    { 12, 19, 10, -1, 19, 57, 8129 }, // î
+    { 10, 18, 10, 0, 18, 45, 8186 }, // ï
+    { 17, 19, 14, -1, 18, 81, 2398 }, // ð
+    { 12, 20, 18, 3, 20, 60, 8231 }, // ñ
+    { 12, 18, 18, 3, 18, 54, 8291 }, // ò
+    { 12, 22, 18, 3, 22, 66, 8345 }, // ó
+    { 12, 20, 18, 3, 20, 60, 8411 }, // ô
+    { 12, 19, 18, 3, 19, 57, 2479 }, // õ
+    { 12, 19, 18, 3, 19, 57, 8471 }, // ö
+    { 16, 15, 19, 1, 15, 60, 2536 }, // ÷
+    { 14, 35, 18, 2, 24, 123, 2596 }, // ø
+    { 12, 18, 18, 3, 18, 54, 8528 }, // ù
+    { 12, 22, 18, 3, 22, 66, 8582 }, // ú
+    { 12, 20, 18, 3, 20, 60, 8648 }, // û
+    { 12, 20, 18, 3, 20, 60, 8708 }, // ü
+    { 14, 31, 19, 3, 25, 109, 2719 }, // ý
+    { 10, 22, 12, 1, 17, 55, 2828 }, // þ
+    { 14, 28, 19, 3, 22, 98, 2883 }, // ÿ
+    { 18, 25, 20, 1, 25, 113, 2981 }, // Ā
+    { 12, 20, 18, 3, 20, 60, 3094 }, // ā
+    { 18, 26, 20, 1, 26, 117, 3154 }, // Ă
+    { 12, 20, 18, 3, 20, 60, 3271 }, // ă
+    { 18, 24, 20, 1, 18, 108, 3331 }, // Ą
+    { 13, 19, 18, 3, 13, 62, 3439 }, // ą
+    { 16, 25, 21, 2, 25, 100, 3501 }, // Ć
+    { 11, 18, 16, 3, 18, 50, 3601 }, // ć
+    { 16, 27, 21, 2, 27, 108, 3651 }, // Ĉ
+    { 12, 19, 16, 2, 19, 57, 3759 }, // ĉ
+    { 16, 25, 21, 2, 25, 100, 3816 }, // Ċ
+    { 11, 18, 16, 3, 18, 50, 3916 }, // ċ
+    { 16, 27, 21, 2, 27, 108, 3966 }, // Č
+    { 12, 20, 16, 3, 20, 60, 4074 }, // č
+    { 16, 27, 22, 3, 27, 108, 4134 }, // Ď
+    { 17, 18, 18, 3, 18, 77, 4242 }, // ď
+    { 20, 18, 22, -1, 18, 90, 4319 }, // Đ
+    { 16, 18, 18, 3, 18, 72, 4409 }, // đ
+    { 13, 26, 19, 3, 26, 85, 4481 }, // Ē
+    { 12, 22, 18, 3, 22, 66, 4566 }, // ē
+    { 13, 26, 19, 3, 26, 85, 4632 }, // Ĕ
+    { 12, 22, 18, 3, 22, 66, 4717 }, // ĕ
+    { 13, 26, 19, 3, 26, 85, 4783 }, // Ė
+    { 12, 22, 18, 3, 22, 66, 4868 }, // ė
+    { 13, 23, 19, 3, 18, 75, 4934 }, // Ę
+    { 12, 20, 18, 3, 12, 60, 5009 }, // ę
+    { 13, 28, 19, 3, 28, 91, 5069 }, // Ě
+    { 12, 24, 18, 3, 24, 72, 5160 }, // ě
+    { 18, 29, 24, 3, 29, 131, 5232 }, // Ĝ
+    { 13, 28, 18, 3, 21, 91, 5363 }, // ĝ
+    { 18, 28, 24, 3, 28, 126, 5454 }, // Ğ
+    { 12, 27, 18, 3, 20, 81, 5580 }, // ğ
+    { 18, 28, 24, 3, 28, 126, 5661 }, // Ġ
+    { 12, 27, 18, 3, 20, 81, 5787 }, // ġ
+    { 18, 31, 24, 3, 31, 140, 5868 }, // Ģ
+    { 12, 28, 18, 3, 21, 84, 6008 }, // ģ
+    { 16, 26, 22, 3, 26, 104, 6092 }, // Ĥ
+    { 16, 26, 18, 0, 26, 104, 6196 }, // ĥ
+    { 18, 18, 22, 2, 18, 81, 6300 }, // Ħ
+    { 16, 18, 18, 0, 18, 72, 6381 }, // ħ
+    { 9, 27, 11, 1, 27, 61, 6453 }, // Ĩ
+    { 8, 20, 10, 1, 20, 40, 6514 }, // ĩ
+    { 12, 27, 11, -1, 27, 81, 6554 }, // Ī
+    { 12, 19, 10, -1, 19, 57, 6635 }, // ī
+    { 6, 23, 11, 2, 18, 35, 6692 }, // Į
+    { 6, 25, 10, 2, 19, 38, 6727 }, // į
+    { 5, 27, 11, 3, 27, 34, 6765 }, // İ
+    { 4, 12, 10, 3, 12, 12, 6799 }, // ı
+    { 17, 26, 33, 7, 18, 111, 6811 }, // Ĳ
+    { 13, 24, 10, 2, 19, 78, 6922 }, // ĳ
+    { 14, 31, 19, 3, 26, 109, 7000 }, // Ĵ
+    { 12, 27, 13, 2, 21, 81, 7109 }, // ĵ
+    { 16, 29, 22, 3, 29, 116, 7190 }, // Ķ
+    { 13, 29, 19, 3, 18, 95, 7306 }, // ķ
+    { 10, 12, 14, 2, 12, 30, 7401 }, // ĸ
+    { 13, 24, 19, 3, 24, 78, 7431 }, // Ĺ
+    { 7, 27, 12, 3, 27, 48, 7509 }, // ĺ
+    { 15, 28, 19, 1, 28, 105, 7557 }, // Ļ
+    { 9, 29, 12, 1, 18, 66, 7662 }, // ļ
+    { 13, 18, 19, 3, 18, 59, 7728 }, // Ľ
+    { 10, 21, 12, 3, 21, 53, 7787 }, // ľ
+    { 13, 18, 19, 3, 18, 59, 7840 }, // Ŀ
+    { 10, 18, 12, 3, 18, 45, 7899 }, // ŀ
+    { 23, 32, 19, -6, 25, 184, 7944 }, // Ł
+    { 15, 18, 12, -4, 18, 68, 8128 }, // ł
+    { 16, 25, 22, 3, 25, 100, 8196 }, // Ń
+    { 12, 20, 18, 3, 20, 60, 8296 }, // ń
+    { 16, 27, 22, 3, 18, 108, 8356 }, // Ņ
+    { 12, 21, 18, 3, 13, 63, 8464 }, // ņ
+    { 16, 27, 22, 3, 27, 108, 8527 }, // Ň
+    { 13, 22, 18, 3, 22, 72, 8635 }, // ň
+    { 12, 21, 18, 3, 21, 63, 8707 }, // ŉ
+    { 16, 23, 22, 3, 18, 92, 8770 }, // Ŋ
+    { 12, 18, 18, 3, 13, 54, 8862 }, // ŋ
+    { 18, 26, 24, 3, 25, 117, 8916 }, // Ō
+    { 12, 19, 18, 3, 19, 57, 9033 }, // ō
+    { 18, 27, 24, 3, 26, 122, 9090 }, // Ŏ
+    { 12, 20, 18, 3, 20, 60, 9212 }, // ŏ
+    { 19, 25, 24, 3, 24, 119, 9272 }, // Ő
+    { 18, 18, 18, 1, 18, 81, 9391 }, // ő
+    { 25, 20, 25, 3, 19, 125, 8768 }, // Œ
+    { 21, 12, 22, 3, 12, 63, 8893 }, // œ
+    { 14, 25, 20, 3, 25, 88, 9472 }, // Ŕ
+    { 9, 18, 15, 3, 18, 41, 9560 }, // ŕ
+    { 14, 29, 20, 3, 29, 102, 9601 }, // Ŗ
+    { 10, 22, 15, 2, 22, 55, 9703 }, // ŗ
+    { 14, 26, 20, 3, 26, 91, 9758 }, // Ř
+    { 12, 19, 15, 1, 19, 57, 9849 }, // ř
+    { 16, 26, 22, 3, 25, 104, 9906 }, // Ś
+    { 12, 19, 18, 3, 18, 57, 10010 }, // ś
+    { 16, 27, 22, 3, 26, 108, 10067 }, // Ŝ
+    { 12, 20, 18, 3, 19, 60, 10175 }, // ŝ
+    { 16, 23, 22, 3, 18, 92, 10235 }, // Ş
+    { 12, 19, 18, 3, 13, 57, 10327 }, // ş
+    { 16, 27, 22, 3, 26, 108, 10384 }, // Š
+    { 12, 21, 18, 3, 20, 63, 10492 }, // š
+    { 16, 24, 22, 3, 18, 96, 10555 }, // Ţ
+    { 11, 22, 16, 3, 17, 61, 10651 }, // ţ
+    { 16, 26, 22, 3, 26, 104, 10712 }, // Ť
+    { 14, 21, 16, 3, 20, 74, 10816 }, // ť
+    { 16, 18, 22, 3, 18, 72, 10890 }, // Ŧ
+    { 12, 18, 16, 2, 17, 54, 10962 }, // ŧ
+    { 16, 28, 22, 3, 27, 112, 11016 }, // Ũ
+    { 12, 20, 18, 3, 20, 60, 11128 }, // ũ
+    { 16, 28, 22, 3, 27, 112, 11188 }, // Ū
+    { 12, 19, 18, 3, 19, 57, 11300 }, // ū
+    { 16, 28, 22, 3, 27, 112, 11357 }, // Ŭ
+    { 12, 20, 18, 3, 20, 60, 11469 }, // ŭ
+    { 16, 29, 22, 3, 28, 116, 11529 }, // Ů
+    { 12, 21, 18, 3, 21, 63, 11645 }, // ů
+    { 18, 27, 22, 3, 26, 122, 11708 }, // Ű
+    { 18, 19, 18, 1, 19, 86, 11830 }, // ű
+    { 16, 23, 22, 3, 18, 92, 11916 }, // Ų
+    { 12, 18, 18, 3, 12, 54, 12008 }, // ų
+    { 24, 26, 30, 3, 26, 156, 12062 }, // Ŵ
+    { 17, 22, 23, 3, 21, 94, 12218 }, // ŵ
+    { 17, 28, 22, 3, 28, 119, 12312 }, // Ŷ
+    { 14, 29, 19, 3, 23, 102, 12431 }, // ŷ
+    { 17, 28, 22, 3, 28, 119, 12533 }, // Ÿ
+    { 17, 24, 23, 3, 24, 102, 12652 }, // Ź
+    { 13, 20, 18, 3, 20, 65, 12754 }, // ź
+    { 17, 24, 23, 3, 24, 102, 12819 }, // Ż
+    { 13, 20, 18, 3, 20, 65, 12921 }, // ż
+    { 17, 26, 23, 3, 26, 111, 12986 }, // Ž
+    { 13, 21, 18, 3, 21, 69, 13097 }, // ž
+    { 8, 17, 13, 2, 17, 34, 13166 }, // ſ
+    { 9, 4, 0, 0, 16, 9, 13200 }, // ̀
+    { 6, 5, 0, 0, 16, 8, 13209 }, // ́
+    { 12, 6, 0, 0, 1, 18, 13217 }, // ̂
+    { 8, 5, 0, 1, 16, 10, 13235 }, // ̃
+    { 12, 4, 0, 0, 15, 12, 13245 }, // ̄
+    { 15, 4, 0, 0, 19, 15, 13257 }, // ̅
+    { 11, 6, 0, 0, 16, 17, 13272 }, // ̆
+    { 5, 5, 0, 3, 17, 7, 13289 }, // ̇
+    { 10, 4, 0, 0, 15, 10, 13296 }, // ̈
+    { 5, 5, 0, 4, 14, 7, 13306 }, // ̉
+    { 5, 5, 0, 1, 16, 7, 13313 }, // ̊
+    { 19, 4, 0, 0, 16, 19, 13320 }, // ̋
+    { 12, 6, 0, 0, 17, 18, 13339 }, // ̌
+    { 18, 4, 0, -5, 16, 18, 13357 }, // ̏
+    { 7, 8, 0, 0, 17, 14, 13375 }, // ̒
+    { 8, 8, 0, 0, 16, 16, 13389 }, // ̓
+    { 8, 8, 0, -1, 16, 16, 13405 }, // ̔
+    { 5, 6, 0, 1, 0, 8, 13421 }, // ̘
+    { 5, 6, 0, 1, 0, 8, 13429 }, // ̙
+    { 10, 6, 0, 1, 17, 15, 13437 }, // ̚
+    { 5, 6, 0, 0, 14, 8, 13452 }, // ̛
+    { 4, 7, 0, 1, 0, 7, 13460 }, // ̜
+    { 6, 5, 0, 1, 3, 8, 13467 }, // ̝
+    { 6, 5, 0, 1, 0, 8, 13475 }, // ̞
+    { 5, 5, 0, 1, -2, 7, 13483 }, // ̟
+    { 12, 4, 0, 0, -2, 12, 13490 }, // ̠
+    { 6, 5, 0, 0, 2, 8, 13502 }, // ̣
+    { 10, 4, 0, 0, -1, 10, 13510 }, // ̤
+    { 5, 5, 0, 1, 16, 7, 13520 }, // ̥
+    { 7, 8, 0, 0, 4, 14, 13527 }, // ̦
+    { 6, 7, 0, 0, 1, 11, 13541 }, // ̧
+    { 6, 8, 0, 1, 2, 12, 13552 }, // ̨
+    { 5, 7, 0, 0, -1, 9, 13564 }, // ̩
+    { 9, 5, 0, 0, 0, 12, 13573 }, // ̪
+    { 13, 6, 0, -1, 1, 20, 13585 }, // ̬
+    { 13, 6, 0, -1, 1, 20, 13605 }, // ̭
+    { 9, 6, 0, 1, 18, 14, 13625 }, // ̰
+    { 10, 4, 0, 1, 18, 10, 13639 }, // ̱
+    { 11, 4, 0, 0, -1, 11, 13649 }, // ̲
+    { 9, 6, 0, 1, 18, 14, 13660 }, // ̴
+    { 11, 3, 0, 0, 8, 9, 13674 }, // ̵
+    { 5, 8, 0, 0, 1, 10, 13683 }, // ̹
+    { 10, 7, 0, 0, 1, 18, 13693 }, // ̺
+    { 9, 7, 0, 0, 1, 16, 13711 }, // ̻
+    { 9, 6, 0, 0, 1, 14, 13727 }, // ̼
+    { 7, 5, 0, 1, 16, 9, 13741 }, // ̽
+    { 8, 5, 0, 1, 16, 10, 13750 }, // ͂
+    { 4, 6, 0, 5, 19, 6, 13760 }, // ̓
+    { 10, 15, 0, 1, 26, 38, 13766 }, // ̈́
+    { 9, 5, 0, 0, 17, 12, 13804 }, // ͆
+    { 12, 8, 0, 0, 0, 24, 13816 }, // ͇
+    { 9, 7, 0, 1, 1, 16, 13840 }, // ͈
+    { 7, 6, 0, 1, -1, 11, 13856 }, // ͉
+    { 11, 16, 0, 1, 22, 44, 13867 }, // ͊
+    { 19, 16, 0, 1, 24, 76, 13911 }, // ͋
+    { 12, 12, 0, 9, 12, 36, 13987 }, // ͌
+    { 11, 6, 0, 1, -2, 17, 14023 }, // ͍
+    { 5, 4, 0, 0, 3, 5, 14040 }, // ͎
+    { 19, 6, 0, 0, 2, 29, 14045 }, // ͜
+    { 19, 6, 0, 0, 17, 29, 14074 }, // ͡
+    { 22, 7, 0, 1, 0, 39, 14103 }, // ͢
+    { 13, 25, 19, 3, 25, 82, 14142 }, // Ѐ
+    { 13, 26, 19, 3, 26, 85, 0 }, // Ё
+    { 18, 20, 14, -3, 18, 90, 14224 }, // Ђ
+    { 12, 25, 14, 1, 24, 75, 14314 }, // Ѓ
+    { 16, 18, 17, 1, 16, 72, 0 }, // Є
+    { 16, 19, 22, 3, 18, 76, 72 }, // Ѕ
+    { 5, 18, 11, 3, 18, 23, 148 }, // І
+    { 10, 26, 11, 0, 26, 65, 171 }, // Ї
+    { 13, 23, 19, 3, 18, 75, 236 }, // Ј
+    { 20, 18, 24, 2, 16, 90, 311 }, // Љ
+    { 20, 17, 13, -4, 16, 85, 401 }, // Њ
+    { 19, 19, 22, 3, 19, 91, 486 }, // Ћ
+    { 16, 24, 22, 3, 24, 96, 577 }, // Ќ
+    { 16, 27, 22, 3, 27, 108, 673 }, // Ѝ
+    { 14, 27, 17, 1, 25, 95, 781 }, // Ў
+    { 13, 21, 17, 2, 16, 69, 876 }, // Џ
+    { 18, 18, 20, 1, 18, 81, 85 }, // А
+    { 11, 17, 14, 1, 16, 47, 166 }, // Б
+    { 12, 17, 14, 1, 16, 51, 213 }, // В
+    { 12, 17, 14, 1, 16, 51, 264 }, // Г
+    { 17, 19, 17, 0, 16, 81, 315 }, // Д
+    { 13, 18, 19, 3, 18, 59, 396 }, // Е
+    { 26, 18, 23, -1, 18, 117, 455 }, // Ж
+    { 11, 16, 13, 1, 16, 44, 572 }, // З
+    { 16, 18, 22, 3, 18, 72, 616 }, // И
+    { 16, 28, 22, 3, 28, 112, 688 }, // Й
+    { 16, 18, 22, 3, 18, 72, 800 }, // К
+    { 14, 18, 13, -1, 16, 63, 872 }, // Л
+    { 16, 17, 18, 1, 16, 68, 935 }, // М
+    { 16, 18, 22, 3, 18, 72, 1003 }, // Н
+    { 18, 19, 24, 3, 18, 86, 1075 }, // О
+    { 13, 17, 14, 1, 16, 56, 1161 }, // П
+    { 13, 18, 19, 3, 18, 59, 1217 }, // Р
+    { 16, 19, 21, 2, 19, 76, 1276 }, // С
+    { 16, 18, 22, 3, 18, 72, 1352 }, // Т
+    { 14, 18, 17, 1, 16, 63, 1424 }, // У
+    { 16, 16, 18, 1, 16, 64, 1487 }, // Ф
+    { 17, 18, 23, 3, 18, 77, 1551 }, // Х
+    { 13, 20, 15, 1, 16, 65, 1628 }, // Ц
+    { 12, 16, 14, 1, 16, 48, 1693 }, // Ч
+    { 15, 17, 17, 1, 16, 64, 1741 }, // Ш
+    { 17, 20, 19, 1, 16, 85, 1805 }, // Щ
+    { 16, 16, 13, -4, 16, 64, 1890 }, // Ъ
+    { 20, 18, 24, 1, 18, 90, 1954 }, // Ы
+    { 11, 16, 13, 1, 16, 44, 2044 }, // Ь
+    { 16, 18, 17, 1, 16, 72, 2088 }, // Э
+    { 17, 16, 19, 1, 16, 68, 2160 }, // Ю
+    { 14, 18, 20, 3, 18, 63, 2228 }, // Я
+    { 12, 13, 18, 3, 13, 39, 2291 }, // а
+    { 13, 20, 14, 1, 19, 65, 2330 }, // б
+    { 11, 12, 15, 2, 12, 33, 2395 }, // в
+    { 11, 13, 12, 1, 12, 36, 2428 }, // г
+    { 15, 15, 16, 0, 12, 57, 2464 }, // д
+    { 12, 12, 18, 3, 12, 36, 2521 }, // е
+    { 24, 15, 30, 3, 15, 90, 2557 }, // ж
+    { 8, 11, 9, 1, 11, 22, 2647 }, // з
+    { 12, 13, 14, 1, 12, 39, 2669 }, // и
+    { 11, 20, 14, 1, 20, 55, 2708 }, // й
+    { 13, 12, 17, 2, 12, 39, 2763 }, // к
+    { 10, 13, 9, -1, 11, 33, 2802 }, // л
+    { 14, 13, 18, 2, 13, 46, 2835 }, // м
+    { 13, 13, 17, 2, 13, 43, 2881 }, // н
+    { 12, 12, 18, 3, 12, 36, 2924 }, // о
+    { 12, 13, 14, 1, 12, 39, 2960 }, // п
+    { 14, 19, 20, 3, 13, 67, 2999 }, // р
+    { 11, 13, 16, 3, 13, 36, 3066 }, // с
+    { 13, 13, 14, 1, 12, 43, 3102 }, // т
+    { 14, 18, 19, 3, 12, 63, 3145 }, // у
+    { 18, 17, 18, 0, 12, 77, 3208 }, // ф
+    { 15, 13, 15, 0, 12, 49, 3285 }, // х
+    { 13, 15, 15, 1, 12, 49, 3334 }, // ц
+    { 8, 11, 9, 1, 11, 22, 3383 }, // ч
+    { 15, 13, 17, 1, 12, 49, 3405 }, // ш
+    { 17, 16, 19, 1, 12, 68, 3454 }, // щ
+    { 12, 12, 10, -3, 12, 36, 3522 }, // ъ
+    { 16, 14, 18, 0, 14, 56, 3558 }, // ы
+    { 9, 12, 10, 0, 12, 27, 3614 }, // ь
+    { 11, 12, 13, 1, 12, 33, 3641 }, // э
+    { 14, 12, 15, 1, 12, 42, 3674 }, // ю
+    { 13, 13, 17, 2, 13, 43, 3716 }, // я
+    { 12, 22, 18, 3, 22, 66, 945 }, // ѐ
+    { 12, 21, 18, 3, 21, 63, 3759 }, // ё
+    { 16, 21, 18, 0, 18, 84, 1011 }, // ђ
+    { 11, 18, 12, 1, 17, 50, 1095 }, // ѓ
+    { 12, 12, 12, 0, 11, 36, 1145 }, // є
+    { 12, 14, 18, 3, 13, 42, 1181 }, // ѕ
+    { 6, 19, 10, 2, 19, 29, 1223 }, // і
+    { 10, 18, 10, 0, 18, 45, 1252 }, // ї
+    { 8, 25, 13, 3, 19, 50, 1297 }, // ј
+    { 15, 13, 17, 1, 11, 49, 1347 }, // љ
+    { 14, 12, 9, -3, 12, 42, 1396 }, // њ
+    { 16, 18, 18, 0, 18, 72, 1438 }, // ћ
+    { 13, 18, 17, 2, 18, 59, 1510 }, // ќ
+    { 12, 20, 14, 1, 19, 60, 1569 }, // ѝ
+    { 14, 28, 19, 3, 22, 98, 1629 }, // ў
+    { 10, 15, 12, 1, 12, 38, 1727 }, // џ
+    { 15, 18, 16, 0, 16, 68, 1765 }, // Ѣ
+    { 15, 18, 14, -1, 16, 68, 1833 }, // ѣ
+    { 20, 17, 18, -1, 16, 85, 1901 }, // Ѫ
+    { 14, 12, 13, -1, 12, 42, 1986 }, // ѫ
+    { 16, 23, 23, 4, 23, 92, 2028 }, // Ѳ
+    { 13, 17, 18, 3, 17, 56, 2120 }, // ѳ
+    { 20, 22, 24, 3, 22, 110, 2176 }, // Ѵ
+    { 14, 15, 18, 2, 15, 53, 2286 }, // ѵ
+    { 9, 8, 0, 2, 20, 18, 2339 }, // ҆
+    { 12, 19, 14, 1, 18, 57, 2357 }, // Ґ
+    { 11, 16, 12, 1, 15, 44, 2414 }, // ґ
+    { 14, 17, 14, -1, 16, 60, 2458 }, // Ғ
+    { 10, 11, 9, -1, 11, 28, 2518 }, // ғ
+    { 14, 20, 13, -1, 18, 70, 2546 }, // Ҕ
+    { 8, 12, 8, 0, 11, 24, 2616 }, // ҕ
+    { 27, 22, 30, 2, 18, 149, 2640 }, // Җ
+    { 19, 15, 21, 1, 12, 72, 2789 }, // җ
+    { 11, 19, 13, 1, 16, 53, 2861 }, // Ҙ
+    { 8, 17, 9, 1, 11, 34, 2914 }, // ҙ
+    { 17, 22, 15, 2, 18, 94, 2948 }, // Қ
+    { 12, 15, 10, 1, 12, 45, 3042 }, // қ
+    { 20, 18, 23, 1, 17, 90, 3087 }, // Ҝ
+    { 14, 12, 16, 1, 12, 42, 3177 }, // ҝ
+    { 16, 18, 22, 3, 18, 72, 3219 }, // Ҟ
+    { 15, 18, 19, 1, 18, 68, 3291 }, // ҟ
+    { 19, 18, 22, 0, 18, 86, 3359 }, // Ҡ
+    { 13, 12, 15, 0, 12, 39, 3445 }, // ҡ
+    { 17, 21, 16, 0, 18, 90, 3484 }, // Ң
+    { 12, 14, 11, 0, 12, 42, 3574 }, // ң
+    { 23, 18, 22, 3, 18, 104, 3616 }, // Ҥ
+    { 16, 12, 15, 2, 12, 48, 3720 }, // ҥ
+    { 23, 20, 27, 2, 18, 115, 3768 }, // Ҧ
+    { 20, 22, 26, 3, 15, 110, 3883 }, // ҧ
+    { 21, 17, 14, -3, 16, 90, 3993 }, // Ҩ
+    { 17, 14, 11, -3, 13, 60, 4083 }, // ҩ
+    { 16, 22, 21, 2, 19, 88, 4143 }, // Ҫ
+    { 11, 16, 16, 3, 13, 44, 4231 }, // ҫ
+    { 17, 21, 16, 0, 18, 90, 4275 }, // Ҭ
+    { 12, 14, 11, 0, 12, 42, 4365 }, // ҭ
+    { 17, 18, 22, 3, 18, 77, 4407 }, // Ү
+    { 13, 17, 16, 1, 12, 56, 4484 }, // ү
+    { 17, 18, 22, 3, 18, 77, 4540 }, // Ұ
+    { 14, 17, 16, 1, 12, 60, 4617 }, // ұ
+    { 17, 21, 16, 3, 18, 90, 4677 }, // Ҳ
+    { 12, 14, 11, 2, 12, 42, 4767 }, // ҳ
+    { 19, 20, 13, -3, 15, 95, 4809 }, // Ҵ
+    { 15, 14, 9, -3, 11, 53, 4904 }, // ҵ
+    { 14, 21, 14, 0, 16, 74, 4957 }, // Ҷ
+    { 10, 15, 10, 0, 11, 38, 5031 }, // ҷ
+    { 12, 16, 14, 1, 16, 48, 5069 }, // Ҹ
+    { 8, 11, 9, 1, 11, 22, 5117 }, // ҹ
+    { 13, 19, 14, 1, 18, 62, 5139 }, // Һ
+    { 13, 18, 18, 3, 18, 59, 5201 }, // һ
+    { 23, 17, 20, -4, 16, 98, 5260 }, // Ҽ
+    { 17, 12, 15, -3, 12, 51, 5358 }, // ҽ
+    { 23, 20, 19, -3, 16, 115, 5409 }, // Ҿ
+    { 17, 15, 13, -2, 12, 64, 5524 }, // ҿ
+    { 5, 18, 11, 3, 18, 23, 5588 }, // Ӏ
+    { 26, 28, 23, -1, 28, 182, 5611 }, // Ӂ
+    { 24, 24, 30, 3, 24, 144, 5793 }, // ӂ
+    { 13, 22, 15, 1, 16, 72, 5937 }, // Ӄ
+    { 10, 16, 10, 0, 12, 40, 6009 }, // ӄ
+    { 16, 21, 13, -1, 16, 84, 6049 }, // Ӆ
+    { 11, 14, 9, -1, 11, 39, 6133 }, // ӆ
+    { 17, 24, 22, 3, 18, 102, 6172 }, // Ӈ
+    { 12, 16, 15, 2, 12, 48, 6274 }, // ӈ
+    { 17, 25, 22, 3, 18, 107, 6322 }, // Ӊ
+    { 12, 17, 15, 2, 12, 51, 6429 }, // ӊ
+    { 12, 21, 14, 1, 16, 63, 6480 }, // Ӌ
+    { 9, 14, 13, 2, 11, 32, 6543 }, // ӌ
+    { 20, 26, 24, 3, 18, 130, 6575 }, // Ӎ
+    { 14, 17, 17, 2, 12, 60, 6705 }, // ӎ
+    { 5, 16, 13, 4, 15, 20, 6765 }, // ӏ
+    { 18, 25, 20, 1, 25, 113, 6785 }, // Ӑ
+    { 12, 20, 18, 3, 20, 60, 6898 }, // ӑ
+    { 18, 24, 20, 1, 24, 108, 6958 }, // Ӓ
+    { 13, 20, 18, 2, 20, 65, 7066 }, // ӓ
+    { 26, 19, 28, 1, 18, 124, 7131 }, // Ӕ
+    { 20, 13, 26, 3, 13, 65, 7255 }, // ӕ
+    { 13, 26, 19, 3, 26, 85, 7320 }, // Ӗ
+    { 12, 22, 18, 3, 22, 66, 7405 }, // ӗ
+    { 15, 18, 22, 4, 17, 68, 7471 }, // Ә
+    { 12, 14, 18, 4, 13, 42, 7539 }, // ә
+    { 15, 24, 22, 4, 23, 90, 7581 }, // Ӛ
+    { 12, 17, 18, 4, 13, 51, 7671 }, // ӛ
+    { 26, 27, 29, 2, 27, 176, 7722 }, // Ӝ
+    { 24, 23, 30, 3, 23, 138, 7898 }, // ӝ
+    { 11, 25, 13, 1, 25, 69, 8036 }, // Ӟ
+    { 10, 16, 9, -1, 16, 40, 8105 }, // ӟ
+    { 11, 17, 14, 2, 16, 47, 8145 }, // Ӡ
+    { 11, 17, 14, 2, 12, 47, 8192 }, // ӡ
+    { 16, 27, 22, 3, 27, 108, 8239 }, // Ӣ
+    { 12, 20, 14, 1, 19, 60, 8347 }, // ӣ
+    { 16, 26, 22, 3, 26, 104, 8407 }, // Ӥ
+    { 12, 19, 14, 1, 18, 57, 8511 }, // ӥ
+    { 18, 25, 24, 3, 24, 113, 8568 }, // Ӧ
+    { 13, 21, 18, 2, 21, 69, 8681 }, // ӧ
+    { 16, 17, 23, 4, 17, 68, 8750 }, // Ө
+    { 12, 12, 18, 3, 12, 36, 8818 }, // ө
+    { 16, 23, 23, 4, 23, 92, 8854 }, // Ӫ
+    { 12, 18, 18, 3, 18, 54, 8946 }, // ӫ
+    { 16, 27, 17, 1, 25, 108, 9000 }, // Ӭ
+    { 11, 17, 13, 1, 17, 47, 9108 }, // ӭ
+    { 14, 27, 17, 1, 25, 95, 9155 }, // Ӯ
+    { 14, 28, 19, 3, 22, 98, 9250 }, // ӯ
+    { 14, 26, 17, 1, 24, 91, 9348 }, // Ӱ
+    { 14, 27, 19, 3, 21, 95, 9439 }, // ӱ
+    { 18, 26, 17, 1, 24, 117, 9534 }, // Ӳ
+    { 19, 27, 19, 2, 21, 129, 9651 }, // ӳ
+    { 12, 20, 14, 1, 20, 60, 9780 }, // Ӵ
+    { 10, 15, 9, 0, 15, 38, 9840 }, // ӵ
+    { 12, 19, 14, 1, 16, 57, 9878 }, // Ӷ
+    { 9, 13, 9, 0, 11, 30, 9935 }, // ӷ
+    { 20, 27, 24, 1, 27, 135, 9965 }, // Ӹ
+    { 16, 22, 18, 0, 22, 88, 10100 }, // ӹ
+    { 19, 20, 23, 3, 18, 95, 10188 }, // Ӽ
+    { 14, 14, 16, 2, 12, 49, 10283 }, // ӽ
+    { 0, 0, 14, 0, 0, 0, 10332 }, //  
+    { 0, 0, 24, 0, 0, 0, 10332 }, //  
+    { 0, 0, 14, 0, 0, 0, 10332 }, //  
+    { 0, 0, 24, 0, 0, 0, 10332 }, //  
+    { 0, 0, 10, 0, 0, 0, 10332 }, //  
+    { 0, 0, 9, 0, 0, 0, 10332 }, //  
+    { 0, 0, 7, 0, 0, 0, 10332 }, //  
+    { 0, 0, 15, 0, 0, 0, 10332 }, //  
+    { 0, 0, 5, 0, 0, 0, 10332 }, //  
+    { 0, 0, 8, 0, 0, 0, 10332 }, //  
+    { 0, 0, 6, 0, 0, 0, 10332 }, //  
+    { 0, 0, 3, 0, 0, 0, 10332 }, // ​
+    { 0, 0, 0, 0, 0, 0, 10332 }, // ‌
+    { 0, 0, 0, 0, 0, 0, 10332 }, // ‍
+    { 0, 0, 0, 0, 0, 0, 10332 }, // ‎
+    { 0, 0, 0, 0, 0, 0, 10332 }, // ‏
+    { 11, 3, 11, 0, 8, 9, 10332 }, // ‐
+    { 11, 3, 11, 0, 8, 9, 10341 }, // ‑
+    { 17, 3, 11, -3, 8, 13, 10350 }, // ‒
+    { 15, 5, 17, 1, 9, 19, 8956 }, // –
+    { 22, 5, 24, 1, 9, 28, 8975 }, // —
+    { 22, 5, 24, 1, 9, 28, 10363 }, // ―
+    { 10, 19, 11, 2, 15, 48, 10391 }, // ‖
+    { 18, 8, 11, -3, -1, 36, 10439 }, // ‗
+    { 7, 8, 9, 1, 19, 14, 9003 }, // ‘
+    { 7, 8, 9, 1, 19, 14, 9017 }, // ’
+    { 7, 8, 7, 0, 4, 14, 10475 }, // ‚
+    { 7, 8, 9, 1, 19, 14, 10489 }, // ‛
+    { 14, 8, 16, 1, 19, 28, 9031 }, // “
+    { 14, 8, 16, 1, 19, 28, 9059 }, // ”
+    { 7, 8, 7, 0, 4, 14, 10503 }, // „
+    { 14, 8, 16, 1, 19, 28, 10517 }, // ‟
+    { 13, 30, 17, 2, 22, 98, 10545 }, // †
+    { 13, 29, 18, 3, 21, 95, 10643 }, // ‡
+    { 17, 16, 11, -3, 19, 68, 10738 }, // •
+    { 7, 8, 13, 3, 10, 14, 10806 }, // ‣
+    { 6, 5, 13, 3, 5, 8, 10820 }, // ․
+    { 6, 5, 13, 3, 5, 8, 10828 }, // ‥
+    { 20, 5, 20, 0, 5, 25, 9087 }, // …
+    { 3, 3, 11, 4, 8, 3, 10836 }, // ‧
+    { 0, 0, 23, 0, 0, 0, 10839 }, //  
+    { 16, 19, 24, 4, 17, 76, 10839 }, // ‰
+    { 8, 8, 11, 3, 19, 16, 10915 }, // ′
+    { 15, 8, 16, 3, 19, 30, 10931 }, // ″
+    { 17, 7, 9, 1, 18, 30, 10961 }, // ‴
+    { 6, 7, 9, 1, 18, 11, 10991 }, // ‵
+    { 10, 7, 9, 0, 18, 18, 11002 }, // ‶
+    { 17, 7, 9, -4, 18, 30, 11020 }, // ‷
+    { 12, 5, 14, 1, 18, 15, 11050 }, // ‸
+    { 7, 12, 9, 1, 12, 21, 11065 }, // ‹
+    { 7, 12, 9, 1, 12, 21, 11086 }, // ›
+    { 22, 28, 28, 4, 22, 154, 11107 }, // ※
+    { 6, 27, 13, 3, 24, 41, 11261 }, // ‼
+    { 13, 33, 18, 2, 28, 108, 11302 }, // ‽
+    { 11, 3, 11, 0, 18, 9, 11410 }, // ‾
+    { 11, 4, 12, 0, 14, 11, 11419 }, // ‿
+    { 15, 15, 13, -1, 19, 57, 11430 }, // ⁂
+    { 14, 18, 26, 6, 16, 63, 11487 }, // ⁄
+    { 26, 27, 31, 3, 24, 176, 11550 }, // ⁇
+    { 22, 28, 25, 2, 24, 154, 11726 }, // ⁈
+    { 17, 27, 16, -1, 24, 115, 11880 }, // ⁉
+    { 16, 36, 19, 2, 25, 144, 11995 }, // ⁒
+    { 0, 0, 97, 0, 0, 0, 12139 }, //  
+    { 7, 9, 7, 0, 18, 16, 12139 }, // ⁰
+    { 7, 8, 7, 0, 18, 14, 12155 }, // ⁴
+    { 7, 9, 7, 0, 18, 16, 12169 }, // ⁵
+    { 7, 9, 7, 0, 18, 16, 12185 }, // ⁶
+    { 7, 9, 8, 0, 18, 16, 12201 }, // ⁷
+    { 7, 9, 8, 0, 18, 16, 12217 }, // ⁸
+    { 7, 10, 8, 0, 18, 18, 12233 }, // ⁹
+    { 12, 13, 18, 3, 13, 39, 12251 }, // ⁿ
+    { 7, 9, 7, 0, 5, 16, 12290 }, // ₀
+    { 7, 9, 7, 0, 5, 16, 12306 }, // ₁
+    { 7, 9, 8, 0, 5, 16, 12322 }, // ₂
+    { 7, 9, 7, 0, 5, 16, 12338 }, // ₃
+    { 7, 8, 8, 0, 5, 14, 12354 }, // ₄
+    { 7, 9, 7, 0, 5, 16, 12368 }, // ₅
+    { 7, 9, 8, 0, 5, 16, 12384 }, // ₆
+    { 7, 10, 8, 0, 6, 18, 12400 }, // ₇
+    { 7, 9, 8, 0, 5, 16, 12418 }, // ₈
+    { 7, 9, 8, 0, 5, 16, 12434 }, // ₉
+    { 9, 29, 10, 1, 22, 66, 12450 }, // ₍
+    { 9, 29, 9, -1, 22, 66, 12516 }, // ₎
+    { 16, 27, 21, 2, 23, 108, 12582 }, // ₡
+    { 16, 19, 21, 2, 19, 76, 12690 }, // ₢
+    { 14, 19, 14, 0, 18, 67, 12766 }, // ₤
+    { 23, 18, 22, -1, 18, 104, 12833 }, // ₦
+    { 19, 18, 19, 0, 18, 86, 12937 }, // ₧
+    { 23, 19, 27, 2, 18, 110, 13023 }, // ₨
+    { 18, 18, 18, 0, 18, 81, 13133 }, // ₩
+    { 16, 16, 22, 3, 16, 64, 13214 }, // ₪
+    { 16, 18, 11, -2, 17, 72, 13278 }, // ₫
+    { 15, 20, 16, 0, 17, 75, 13350 }, // €
+    { 16, 18, 22, 3, 18, 72, 13425 }, // ₮
+    { 21, 18, 13, -1, 18, 95, 13497 }, // ₱
+    { 18, 27, 24, 3, 23, 122, 13592 }, // ₲
+    { 21, 18, 22, 4, 17, 95, 13714 }, // ₴
+    { 11, 17, 12, 3, 15, 47, 13809 }, // ₵
+    { 18, 19, 22, 2, 19, 86, 13856 }, // ₸
+    { 12, 17, 14, 1, 16, 51, 13942 }, // ₹
+    { 13, 16, 14, 1, 14, 52, 13993 }, // ₺
+    { 15, 17, 17, 1, 17, 64, 14045 }, // ₼
+    { 18, 18, 19, -2, 18, 81, 14109 }, // ₽
+    { 15, 14, 15, 0, 12, 53, 14190 }, // ←
+    { 16, 15, 16, 0, 14, 60, 14243 }, // ↑
+    { 14, 14, 16, 1, 12, 49, 14303 }, // →
+    { 16, 14, 16, 0, 13, 56, 0 }, // ↓
+    { 17, 12, 21, 2, 12, 51, 56 }, // ↔
+    { 13, 17, 17, 2, 19, 56, 107 }, // ↕
+    { 12, 12, 16, 2, 12, 36, 163 }, // ↖
+    { 13, 12, 13, 0, 12, 39, 199 }, // ↗
+    { 13, 12, 13, 0, 12, 39, 238 }, // ↘
+    { 12, 12, 13, 1, 12, 36, 277 }, // ↙
+    { 16, 14, 20, 2, 13, 56, 313 }, // ⇐
+    { 18, 17, 22, 2, 16, 77, 369 }, // ⇑
+    { 16, 14, 20, 2, 13, 56, 446 }, // ⇒
+    { 18, 17, 22, 2, 15, 77, 502 }, // ⇓
+    { 19, 14, 23, 2, 13, 67, 579 }, // ⇔
+    { 14, 18, 19, 2, 10, 63, 646 }, // ⇕
+    { 13, 19, 14, 1, 18, 62, 709 }, // ∂
+    { 21, 20, 24, 1, 19, 105, 771 }, // ∅
+    { 16, 17, 18, 1, 16, 68, 876 }, // ∆
+    { 14, 16, 15, 1, 15, 56, 944 }, // ∏
+    { 14, 17, 15, 1, 16, 60, 1000 }, // ∐
+    { 11, 16, 12, 1, 15, 44, 1060 }, // ∑
+    { 12, 4, 13, 0, 8, 12, 1104 }, // −
+    { 18, 19, 20, 1, 18, 86, 1116 }, // √
+    { 17, 12, 19, 1, 14, 51, 1202 }, // ∞
+    { 17, 23, 18, 0, 17, 98, 1253 }, // ∫
+    { 6, 14, 7, 0, 14, 21, 1351 }, // ∶
+    { 12, 12, 30, 9, 12, 36, 1372 }, // ≈
+    { 16, 19, 26, 5, 17, 76, 1408 }, // ≠
+    { 18, 18, 17, -1, 16, 81, 1484 }, // ≤
+    { 18, 18, 18, 0, 16, 81, 1565 }, // ≥
+    { 17, 17, 23, 3, 17, 73, 1646 }, // ﬀ
+    { 15, 19, 20, 3, 19, 72, 1719 }, // ﬁ
+    { 17, 18, 23, 3, 18, 77, 1791 }, // ﬂ
+    { 24, 19, 28, 3, 19, 114, 1868 }, // ﬃ
+    { 26, 18, 31, 3, 18, 117, 1982 }, // ﬄ
+    { 21, 18, 25, 2, 17, 95, 2099 }, // ﬆ
 };
 
 static const EpdUnicodeInterval opendyslexic_10_boldIntervals[] = {
@@ -2143,30 +2132,90 @@ static const EpdUnicodeInterval opendyslexic_10_boldIntervals[] = {
     { 0x2248, 0x2248, 0x2D1 },
     { 0x2260, 0x2260, 0x2D2 },
     { 0x2264, 0x2265, 0x2D3 },
+    { 0xFB00, 0xFB04, 0x2D5 },
+    { 0xFB06, 0xFB06, 0x2DA },
 };
 
 static const EpdFontGroup opendyslexic_10_boldGroups[] = {
-    { 0, 3120, 5244, 95, 0 },
-    { 3120, 2879, 6505, 96, 95 },
-    { 5999, 4172, 10407, 126, 191 },
-    { 10171, 679, 942, 61, 317 },
-    { 10850, 7085, 14401, 213, 378 },
-    { 17935, 1130, 1963, 63, 591 },
-    { 19065, 383, 443, 20, 654 },
-    { 19448, 977, 1608, 20, 674 },
-    { 20425, 559, 871, 16, 694 },
-    { 20984, 560, 937, 15, 710 },
+    { 0, 4146, 9112, 151, 0 },
+    { 4146, 2253, 3822, 66, 379 },
+    { 6399, 6057, 14389, 237, 96 },
+    { 12456, 7552, 14352, 243, 382 },
+    { 20008, 1265, 2194, 34, 697 },
+};
+
+static const uint8_t opendyslexic_10_boldGlyphGroups[731] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 0,
+    0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 2, 2, 2, 0,
+    0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 2, 2, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 3, 1, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 0, 0, 3, 3, 3, 0, 0, 3, 3, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+};
+
+static const uint16_t opendyslexic_10_boldGlyphLookup[368] = {
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x005F, 0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E,
+    0x006F, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E,
+    0x007F, 0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E,
+    0x008F, 0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E,
+    0x009F, 0x00A0, 0x00A1, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE,
+    0x00AF, 0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE,
+    0x024F, 0x0250, 0x0251, 0x0252, 0x0253, 0x0254, 0x0255, 0x0256, 0x0257, 0x0258, 0x0259, 0x025A, 0x025B, 0x025C, 0x025D, 0x025E,
+    0x025F, 0x0260, 0x0261, 0x0262, 0x0263, 0x0264, 0x0265, 0x0266, 0x0267, 0x0268, 0x0269, 0x026A, 0x026B, 0x026C, 0x026D, 0x026E,
+    0x026F, 0x0270, 0x0271, 0x0272, 0x0273, 0x0274, 0x0275, 0x0276, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0277,
+    0x0278, 0xFFFF, 0x0279, 0x027A, 0x027B, 0x027C, 0x027D, 0x027E, 0x027F, 0x0280, 0x0281, 0x0282, 0x0283, 0x0284, 0x0285, 0x0286,
+    0xFFFF, 0xFFFF, 0x0287, 0xFFFF, 0x0288, 0xFFFF, 0xFFFF, 0x0289, 0x028A, 0x028B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x028C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x028D,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
 };
 
 static const EpdFontData opendyslexic_10_bold = {
     opendyslexic_10_boldBitmaps,
     opendyslexic_10_boldGlyphs,
     opendyslexic_10_boldIntervals,
-    56,
+    58,
     38,
     28,
     -11,
     true,
     opendyslexic_10_boldGroups,
-    10,
+    5,
+    nullptr,
+    nullptr,
+    nullptr,
+    0,
+    nullptr,
+    0,
+    0,
+    opendyslexic_10_boldGlyphLookup,
+    opendyslexic_10_boldGlyphGroups,
+    false,
+    nullptr,
 };
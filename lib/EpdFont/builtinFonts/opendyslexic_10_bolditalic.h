@@ -3,1640 +3,1611 @@
  * name: opendyslexic_10_bolditalic
  * size: 10
  * mode: 2-bit  compressed: true
- * Command used: fontconvert.py opendyslexic_10_bolditalic 10 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-BoldItalic.otf --2bit --compress
+ * Command used: fontconvert.py opendyslexic_10_bolditalic 10 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-BoldItalic.otf --2bit --compress --no-kerning --frequency-corpus ../../../test/hyphenation_eval/resources/english_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/french_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/german_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/italian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/russian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/spanish_hyphenation_tests.txt
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t opendyslexic_10_bolditalicBitmaps[26035] = {
-    0x6D, 0x58, 0x31, 0xAC, 0xDE, 0xD4, 0x15, 0x3E, 0xB6, 0x9B, 0x58, 0x8A, 0xA5, 0x5C, 0x06, 0xA8,
-    0x68, 0x82, 0x64, 0xA9, 0xEA, 0x50, 0x52, 0x84, 0x17, 0x96, 0x4A, 0x4D, 0xAE, 0x9B, 0xA8, 0x62,
-    0xA0, 0x52, 0x52, 0x89, 0xB0, 0x30, 0xB0, 0x74, 0xA8, 0x50, 0xA5, 0xD7, 0xA1, 0x4B, 0x25, 0x88,
-    0x0D, 0x19, 0x18, 0x79, 0x43, 0x99, 0xCB, 0xD0, 0x4A, 0xE1, 0xA5, 0x6D, 0xE8, 0x86, 0xD4, 0xE4,
-    0xD9, 0x21, 0x03, 0x03, 0x03, 0xA6, 0x19, 0x90, 0xCA, 0x50, 0xB7, 0x81, 0x42, 0xC9, 0x90, 0x0B,
-    0x71, 0x1B, 0x27, 0xB1, 0x7D, 0xFB, 0x7D, 0xE7, 0xFA, 0x4F, 0x1E, 0x69, 0x7F, 0xE5, 0xFD, 0xF9,
-    0xED, 0x7B, 0xEF, 0xB9, 0xE7, 0x9E, 0xF3, 0x9D, 0xEF, 0x9C, 0x73, 0x45, 0xF0, 0x79, 0x58, 0xE4,
-    0x09, 0x91, 0x63, 0x22, 0x2F, 0x8B, 0x4C, 0x22, 0xA3, 0xC4, 0x83, 0x24, 0x8E, 0xFF, 0xB2, 0x5E,
-    0x4C, 0x27, 0x79, 0x2B, 0x45, 0x2D, 0x45, 0x29, 0x99, 0x48, 0x24, 0x7B, 0x3F, 0xF1, 0x39, 0xC9,
-    0x46, 0x31, 0xA3, 0xE4, 0x83, 0xD8, 0x41, 0x2A, 0xC7, 0x97, 0x66, 0xB2, 0xAE, 0x79, 0xD7, 0xA7,
-    0x53, 0xEE, 0x6C, 0xEB, 0x93, 0xD9, 0xB8, 0xA2, 0xF7, 0xAF, 0xF8, 0x0C, 0xA2, 0x63, 0x07, 0x29,
-    0xD8, 0x2A, 0xE1, 0xC4, 0xAC, 0x3B, 0xC3, 0xE9, 0x13, 0x76, 0x10, 0xC9, 0x6B, 0x0C, 0x67, 0x1E,
-    0x9F, 0x49, 0xF8, 0xED, 0xA5, 0xE0, 0x77, 0x2F, 0x32, 0x1B, 0x7C, 0x49, 0xD1, 0x62, 0x5C, 0x92,
-    0xB1, 0x68, 0xF1, 0x5F, 0x95, 0x0C, 0xD8, 0x86, 0xE3, 0x43, 0x1C, 0x26, 0x5B, 0x7E, 0x77, 0x92,
-    0x4C, 0x61, 0xFC, 0xC4, 0x48, 0x3D, 0x5C, 0x85, 0xCD, 0xA2, 0x25, 0x73, 0xF2, 0xE0, 0x27, 0xE7,
-    0xD7, 0x45, 0x0A, 0xEC, 0xB9, 0xEB, 0x27, 0x92, 0x78, 0xDF, 0x42, 0xC8, 0x8C, 0x1F, 0x27, 0x6B,
-    0xC9, 0xFB, 0xA3, 0x22, 0x4D, 0x04, 0x13, 0xF8, 0x67, 0x5A, 0x6A, 0xA5, 0xBB, 0x95, 0x92, 0xF2,
-    0x4B, 0x2A, 0x3C, 0x0A, 0xD4, 0xDC, 0x4E, 0xBC, 0x33, 0xB7, 0x5F, 0xC0, 0xD1, 0xA0, 0x34, 0xB5,
-    0x29, 0xF7, 0x37, 0x9E, 0x67, 0xC1, 0x62, 0x89, 0xF4, 0x84, 0x54, 0xE6, 0x91, 0xB0, 0xE5, 0xB3,
-    0x7C, 0x39, 0xC0, 0xD6, 0x69, 0x17, 0xF9, 0xD2, 0xD4, 0xE9, 0x95, 0xDA, 0x8A, 0x49, 0x70, 0xAC,
-    0x83, 0xC9, 0x59, 0x27, 0x07, 0xCD, 0x33, 0x1D, 0x36, 0xA1, 0x91, 0x27, 0x98, 0x25, 0xFA, 0xC9,
-    0xB8, 0x0B, 0xED, 0x6E, 0x5E, 0xAF, 0xC5, 0xBC, 0x7F, 0x16, 0xAA, 0x9D, 0x4C, 0x5A, 0x58, 0x22,
-    0xAB, 0xE3, 0xD1, 0x78, 0xB8, 0x05, 0xC6, 0xCC, 0xDB, 0xE8, 0xD4, 0x2A, 0x1C, 0x3E, 0x90, 0xFC,
-    0x3A, 0xD6, 0x97, 0x2F, 0x49, 0x56, 0x1B, 0x49, 0x3A, 0xEC, 0x7C, 0x31, 0xC7, 0x8B, 0xA6, 0x97,
-    0x18, 0x3A, 0xC5, 0xBE, 0xC6, 0x9F, 0x33, 0xAF, 0x4E, 0x36, 0xED, 0xE7, 0xE4, 0x96, 0xB3, 0xB5,
-    0x1D, 0xF2, 0xA5, 0x19, 0x13, 0x1A, 0xAF, 0xF2, 0x77, 0xCB, 0xFD, 0xCB, 0x76, 0xB9, 0x1A, 0xC7,
-    0x5F, 0x59, 0xB2, 0x51, 0x7D, 0x77, 0x7C, 0x81, 0xCB, 0xF0, 0xDA, 0x62, 0xF5, 0x48, 0x1F, 0x48,
-    0x04, 0x2F, 0xD0, 0x5F, 0x18, 0xA0, 0x59, 0x6D, 0xA9, 0x03, 0x06, 0xE7, 0xA4, 0xBA, 0xF0, 0x4A,
-    0x7E, 0xFF, 0x27, 0xDF, 0x5A, 0xD1, 0x25, 0xA9, 0x0B, 0x23, 0xD5, 0xFA, 0x38, 0x04, 0x29, 0x90,
-    0x2B, 0x30, 0x66, 0x34, 0x63, 0x9B, 0x77, 0x44, 0x1E, 0x0D, 0x42, 0xE9, 0xC2, 0x85, 0xBE, 0x0E,
-    0x6B, 0x9A, 0xF0, 0x73, 0xB3, 0x07, 0x27, 0xD4, 0x8A, 0x53, 0x4A, 0x38, 0x13, 0x64, 0xDB, 0xB0,
-    0x23, 0xD4, 0xE1, 0x54, 0x88, 0xDD, 0x3C, 0xE1, 0x3F, 0x80, 0x80, 0x52, 0xB1, 0x4F, 0x0E, 0x63,
-    0x7C, 0x1E, 0x70, 0x8B, 0x17, 0xE3, 0x77, 0x9E, 0x3C, 0xFA, 0x12, 0x40, 0x16, 0xC3, 0xEB, 0xF9,
-    0x0C, 0x23, 0x0C, 0x76, 0x99, 0x4C, 0xF1, 0x18, 0x77, 0x8A, 0x83, 0x2D, 0xF0, 0xCB, 0x00, 0x0D,
-    0xA5, 0x14, 0xC0, 0xC6, 0x52, 0xF9, 0xF9, 0x45, 0x7F, 0x8E, 0xB0, 0x99, 0x24, 0x1A, 0x25, 0x7A,
-    0x53, 0x8D, 0xD5, 0xDA, 0x3E, 0x77, 0x66, 0x48, 0xA7, 0x64, 0x8E, 0x17, 0x79, 0xE4, 0xF4, 0x69,
-    0xCC, 0x04, 0x90, 0xF6, 0x6F, 0xCF, 0xF9, 0xD5, 0xA9, 0x6A, 0xF7, 0x80, 0xEE, 0xE7, 0x9B, 0x9D,
-    0x03, 0xEC, 0x56, 0x78, 0x00, 0xF9, 0xFC, 0xB6, 0x3A, 0x45, 0x03, 0x82, 0x67, 0x13, 0xC6, 0xA0,
-    0x84, 0xE3, 0x32, 0x52, 0x56, 0x6D, 0x44, 0x4F, 0xF5, 0xC0, 0xC4, 0x71, 0xCF, 0xC4, 0xFE, 0xC1,
-    0x89, 0x95, 0x4E, 0x9C, 0xF9, 0x15, 0xE9, 0xF4, 0x64, 0x78, 0x70, 0x62, 0x51, 0xDF, 0x9F, 0xB8,
-    0xFC, 0xCF, 0xC4, 0x10, 0xD2, 0x3A, 0xE5, 0xBB, 0x3A, 0xE5, 0xA1, 0x35, 0xF4, 0x31, 0x35, 0x67,
-    0xD0, 0x9C, 0x70, 0x32, 0xC5, 0x2E, 0x1E, 0x8F, 0xBB, 0xE4, 0xE6, 0x4D, 0x97, 0xDE, 0xBA, 0xE9,
-    0xB2, 0xEB, 0x9F, 0x39, 0xF3, 0xF1, 0xC7, 0xBD, 0xB9, 0xF2, 0x7A, 0x9B, 0xB7, 0xB6, 0x45, 0xF8,
-    0x97, 0x30, 0x34, 0xA6, 0xCF, 0x80, 0xF8, 0x88, 0x80, 0xEA, 0x25, 0xDA, 0xA5, 0x7A, 0x7F, 0x90,
-    0x6C, 0x96, 0x62, 0x12, 0x3B, 0xCA, 0xB7, 0x95, 0x73, 0xD2, 0xBD, 0x9C, 0x03, 0xE1, 0xF5, 0xBE,
-    0xE6, 0x0D, 0x2C, 0x2B, 0xFC, 0x64, 0x11, 0x71, 0xFB, 0x11, 0x7E, 0xD6, 0x3B, 0xFC, 0x8D, 0xF2,
-    0xAB, 0x78, 0x92, 0x92, 0x9A, 0xF2, 0xFC, 0x04, 0x14, 0xBC, 0x2B, 0x4D, 0x8B, 0x18, 0xC5, 0xD1,
-    0xE1, 0x20, 0x4C, 0x4B, 0xFD, 0xA7, 0x25, 0xE2, 0xB2, 0xCE, 0x11, 0x9A, 0x96, 0xA1, 0x1B, 0x21,
-    0x08, 0xA1, 0x43, 0x86, 0xBF, 0xC7, 0x65, 0x0A, 0xCE, 0xC0, 0xD1, 0x20, 0xC5, 0x20, 0x48, 0xAA,
-    0x59, 0xE2, 0x66, 0x5A, 0xB1, 0xDB, 0x1D, 0xFC, 0x91, 0x97, 0xC6, 0x4F, 0x08, 0x90, 0xAE, 0x20,
-    0x42, 0x3C, 0x4D, 0x10, 0xF7, 0x6A, 0x4B, 0x0B, 0x5C, 0x4C, 0x92, 0xDC, 0xA8, 0xE5, 0xF6, 0x28,
-    0xC7, 0x6C, 0x69, 0xAE, 0xB8, 0xC4, 0x55, 0xE0, 0xAD, 0x05, 0xC7, 0xBC, 0x4A, 0x0A, 0x8B, 0xC3,
-    0xAC, 0x14, 0xBA, 0x35, 0x01, 0x4B, 0x07, 0x76, 0xCE, 0x41, 0x5E, 0x0F, 0x79, 0x25, 0xAD, 0x79,
-    0x31, 0xB8, 0xCC, 0x7C, 0x51, 0x02, 0x79, 0x2D, 0x58, 0xAC, 0xDD, 0xA7, 0x2E, 0x20, 0x0B, 0xBA,
-    0xEC, 0x0D, 0x5F, 0xE3, 0xBC, 0x11, 0xF6, 0x36, 0xD8, 0xFB, 0xF0, 0x42, 0x11, 0xCD, 0x08, 0x4A,
-    0xEC, 0xB8, 0x1E, 0x0E, 0x8B, 0x18, 0x11, 0x7F, 0xDD, 0xC6, 0x5A, 0x4A, 0xEC, 0x0D, 0x78, 0xB1,
-    0xAA, 0x6D, 0x3C, 0x45, 0x13, 0xB8, 0xA1, 0x2F, 0x3E, 0x64, 0x50, 0x8F, 0x50, 0xA8, 0x16, 0x30,
-    0xC0, 0x91, 0x9D, 0xDF, 0xC1, 0x0C, 0xAF, 0x91, 0xE2, 0xE0, 0x4E, 0x1C, 0x0F, 0xA6, 0xA3, 0xA7,
-    0x1B, 0x0D, 0x15, 0x98, 0x39, 0x77, 0x62, 0x06, 0x49, 0x71, 0xA4, 0x05, 0x34, 0x01, 0x1B, 0x41,
-    0xC1, 0xD8, 0x53, 0xB3, 0x3A, 0x1D, 0x2C, 0x90, 0x74, 0x51, 0xA6, 0xC4, 0xA5, 0xAE, 0x68, 0x0D,
-    0xCE, 0x96, 0xF9, 0x3A, 0xA2, 0x16, 0x5D, 0x03, 0xC3, 0x4D, 0xA6, 0x4F, 0x41, 0x15, 0x4D, 0xED,
-    0xFD, 0x8C, 0x53, 0x74, 0x8C, 0x26, 0x39, 0xBD, 0x66, 0x15, 0xCC, 0x84, 0xAF, 0x7A, 0x99, 0x53,
-    0x07, 0x84, 0xB8, 0xA4, 0x8B, 0x5D, 0xDA, 0x42, 0x50, 0x9B, 0xBA, 0xAC, 0x2B, 0xFA, 0x54, 0xE7,
-    0x43, 0x2B, 0x58, 0x00, 0x30, 0x2C, 0xBF, 0x15, 0x35, 0xCA, 0xC1, 0xD6, 0x0F, 0xB2, 0xA5, 0xF6,
-    0x26, 0x2E, 0x4B, 0xEC, 0xEA, 0x32, 0x38, 0xE2, 0x7E, 0xD6, 0x41, 0x8A, 0x90, 0xA6, 0xB6, 0x1D,
-    0xB2, 0x0E, 0x4F, 0x64, 0x5B, 0x80, 0x11, 0x49, 0xA8, 0xEA, 0xF6, 0x44, 0x5B, 0x74, 0x5A, 0x0A,
-    0x87, 0x93, 0x24, 0x93, 0x14, 0x7D, 0xE4, 0x79, 0xC0, 0x17, 0xEB, 0xCD, 0xE0, 0x13, 0x84, 0x3D,
-    0x7C, 0x59, 0xC0, 0x0A, 0x05, 0x0E, 0x5A, 0x60, 0x37, 0xFE, 0x25, 0xAA, 0x88, 0xDF, 0xC6, 0xE9,
-    0xFD, 0x6D, 0x81, 0x12, 0x18, 0x3B, 0x0C, 0x43, 0x4A, 0xD4, 0x30, 0x54, 0x1E, 0x93, 0xE7, 0xCE,
-    0xD3, 0x29, 0xC8, 0x3B, 0x0F, 0x07, 0x4D, 0x2E, 0x80, 0x3E, 0xFC, 0x65, 0x7F, 0x47, 0xB9, 0x40,
-    0x89, 0x1F, 0xFB, 0x00, 0x78, 0x5D, 0x90, 0x1B, 0xD1, 0x1A, 0x29, 0x8E, 0x23, 0xC5, 0x0C, 0x19,
-    0x9E, 0x12, 0xAF, 0x52, 0xB4, 0x87, 0x4B, 0x2B, 0x28, 0xF0, 0xF8, 0x7D, 0x85, 0x9F, 0xE5, 0x12,
-    0x5A, 0xB6, 0x8F, 0x61, 0x2F, 0xE9, 0x48, 0x00, 0xFC, 0x23, 0x1C, 0x09, 0x15, 0x86, 0x2C, 0xA2,
-    0x02, 0xC9, 0x83, 0x74, 0xC5, 0x74, 0x2B, 0x55, 0x1D, 0xE0, 0x45, 0x0E, 0x5D, 0xA9, 0x7A, 0xEF,
-    0x87, 0x2B, 0x48, 0x92, 0x45, 0xA7, 0x60, 0x94, 0x23, 0xF5, 0xFD, 0xB1, 0xEF, 0x7D, 0x82, 0x35,
-    0xC4, 0x47, 0xBC, 0x00, 0x4B, 0x88, 0x21, 0xC3, 0xCD, 0x22, 0x78, 0xE8, 0xCF, 0xF5, 0x53, 0x32,
-    0xDC, 0xEA, 0x0E, 0xCA, 0xF4, 0xF6, 0x2F, 0xD2, 0xF2, 0xD8, 0x53, 0x8F, 0x25, 0x6D, 0xFE, 0xE3,
-    0x3C, 0xEE, 0xB3, 0xAB, 0xFE, 0x0A, 0xC2, 0x7C, 0x17, 0x81, 0xD5, 0x20, 0x89, 0x31, 0xE5, 0x9F,
-    0x62, 0xDE, 0x24, 0xE1, 0x7A, 0xEE, 0x4E, 0x69, 0x34, 0xFB, 0x86, 0x70, 0xB8, 0x6D, 0x4A, 0x42,
-    0x61, 0x16, 0x2F, 0x00, 0xB6, 0xF4, 0x16, 0x8E, 0x31, 0x83, 0xE9, 0x8A, 0xB3, 0xAC, 0x2E, 0x40,
-    0x50, 0x0B, 0x0E, 0x57, 0xB4, 0xB6, 0x56, 0x31, 0x48, 0x45, 0x2D, 0xE2, 0x87, 0x21, 0xE7, 0x5B,
-    0x8F, 0x5C, 0x8E, 0x88, 0xB6, 0x57, 0x01, 0xCA, 0x59, 0x41, 0x04, 0x08, 0x4B, 0x7A, 0xA7, 0xE9,
-    0xE1, 0xFD, 0x09, 0xE8, 0x25, 0x2C, 0xF3, 0x32, 0x6F, 0x8B, 0x16, 0xF9, 0x99, 0x61, 0xD1, 0x33,
-    0xFE, 0x10, 0x43, 0x45, 0x5B, 0x00, 0xB5, 0xA6, 0x8B, 0xA7, 0xF4, 0xCE, 0x79, 0xBA, 0xC7, 0xD7,
-    0x14, 0x08, 0x02, 0x68, 0x73, 0xBF, 0x6C, 0x4C, 0x14, 0x5D, 0x80, 0x66, 0x5C, 0x54, 0x01, 0xD1,
-    0xD8, 0xB5, 0x4D, 0x99, 0xDA, 0x79, 0x02, 0x0B, 0x6D, 0x53, 0x32, 0x20, 0x1F, 0xE8, 0xCD, 0x88,
-    0xC8, 0x2B, 0xE8, 0x0D, 0xDF, 0x1D, 0xE6, 0x5C, 0x17, 0x31, 0x6B, 0x9A, 0xB0, 0x7A, 0xA1, 0x19,
-    0x69, 0x60, 0x54, 0x11, 0xA2, 0x2C, 0x53, 0xF1, 0xB9, 0xD9, 0x81, 0x9D, 0x14, 0x75, 0x0B, 0x3C,
-    0x88, 0x0C, 0x97, 0x0C, 0x50, 0x3C, 0x19, 0x00, 0xC7, 0xC4, 0x21, 0x49, 0xA5, 0x0E, 0x9C, 0x65,
-    0x7A, 0xA2, 0xB7, 0x33, 0xEE, 0x9B, 0xD4, 0xCD, 0x2B, 0x4B, 0x6A, 0x2D, 0x33, 0xF1, 0x8B, 0xD2,
-    0xEF, 0x90, 0x39, 0x2E, 0x28, 0x41, 0x8C, 0x7C, 0x17, 0x58, 0xB9, 0xDA, 0x10, 0x33, 0xAD, 0x9B,
-    0x93, 0x6E, 0xBC, 0x46, 0x1A, 0x28, 0xF4, 0xB6, 0x68, 0x5C, 0xA3, 0xF8, 0xE1, 0x09, 0xC0, 0x39,
-    0x90, 0xCB, 0xD5, 0x2A, 0x11, 0x87, 0xC4, 0x0F, 0x39, 0x00, 0x20, 0xB2, 0xE0, 0x51, 0xC5, 0x97,
-    0x35, 0xF9, 0x30, 0xD5, 0x1A, 0x2D, 0x80, 0x3C, 0x4F, 0xD4, 0xE2, 0x04, 0xDB, 0x9A, 0x43, 0x38,
-    0xC0, 0xCD, 0xA0, 0xB9, 0xA2, 0x4C, 0x11, 0x47, 0x38, 0xE5, 0x6E, 0x13, 0x68, 0xDC, 0xBF, 0x07,
-    0xBB, 0x79, 0xD2, 0xED, 0x2C, 0xD0, 0xE3, 0x94, 0x3A, 0x9E, 0xA6, 0x24, 0x38, 0x25, 0xA3, 0xD6,
-    0xB6, 0x3D, 0xF0, 0x6B, 0xE1, 0xF1, 0x5E, 0x43, 0xFC, 0xCE, 0x85, 0x8B, 0xB6, 0x06, 0x44, 0xD5,
-    0x6E, 0xE4, 0x3F, 0x7D, 0x41, 0xEB, 0x90, 0x2E, 0x5B, 0xCD, 0x3A, 0x82, 0xE8, 0xFF, 0x15, 0x54,
-    0x5A, 0xE0, 0x4E, 0x18, 0x0F, 0x11, 0x8E, 0x03, 0x30, 0x96, 0x9B, 0x12, 0xC6, 0xF3, 0x24, 0x7C,
-    0x94, 0x41, 0x03, 0xF4, 0x31, 0x0E, 0x5C, 0x9B, 0x3B, 0x80, 0x44, 0x09, 0x25, 0x48, 0x69, 0xCD,
-    0xE6, 0xAB, 0xCE, 0xEF, 0xEC, 0xC0, 0xAE, 0x70, 0x59, 0x69, 0x7B, 0x70, 0x5B, 0xD5, 0x91, 0x48,
-    0x0A, 0x8A, 0x82, 0x3C, 0x94, 0xAC, 0x8C, 0x12, 0xA4, 0xA5, 0x36, 0xDA, 0xBC, 0x28, 0x33, 0x3A,
-    0x2E, 0xEF, 0xC1, 0x29, 0xB6, 0x8B, 0x35, 0x15, 0xAE, 0xEA, 0xAF, 0xE7, 0x57, 0xCB, 0xEB, 0xD3,
-    0x7C, 0xEF, 0xA9, 0x5E, 0x9F, 0xCC, 0xE6, 0x29, 0xFE, 0xFA, 0xD3, 0xB4, 0x79, 0x42, 0x35, 0xF2,
-    0x28, 0x2B, 0x61, 0x1A, 0x2C, 0x65, 0x61, 0xC9, 0x7C, 0x26, 0x7E, 0xB9, 0x17, 0x98, 0x28, 0x71,
-    0x7B, 0xC9, 0x2F, 0x63, 0x64, 0xD7, 0x90, 0xAC, 0x59, 0xB7, 0x7C, 0x80, 0xFD, 0x17, 0x98, 0x3D,
-    0xB9, 0x3B, 0x2A, 0x49, 0x68, 0xF9, 0x89, 0xE5, 0x6D, 0x60, 0x30, 0x09, 0x2C, 0x33, 0x51, 0x18,
-    0x99, 0xBD, 0x42, 0x8A, 0x1D, 0x88, 0x97, 0xD6, 0x0F, 0x11, 0x22, 0x80, 0xF9, 0xAC, 0xD7, 0xD4,
-    0x02, 0xAE, 0xD7, 0x02, 0xA9, 0xD4, 0xAA, 0xC9, 0xEB, 0xFB, 0xE8, 0xFE, 0xFB, 0x3D, 0xA5, 0x92,
-    0xF7, 0x7F, 0xF1, 0x4C, 0xBA, 0xFE, 0x3D, 0xFA, 0x03, 0x30, 0x86, 0xB7, 0xC1, 0xAF, 0xE0, 0x53,
-    0x5F, 0x67, 0x4C, 0xE3, 0x52, 0xC1, 0x56, 0x88, 0x55, 0x80, 0xCB, 0x15, 0x74, 0xDB, 0x65, 0xCC,
-    0xAB, 0xFC, 0x49, 0x50, 0xFA, 0x32, 0x37, 0x8D, 0x98, 0xEB, 0xFE, 0x2E, 0x4C, 0xBA, 0xE5, 0xFF,
-    0x06, 0x3E, 0xAB, 0xE6, 0xA6, 0x34, 0x5F, 0xFA, 0x9B, 0xF0, 0xE4, 0x7B, 0xFE, 0x05, 0x17, 0x2D,
-    0x66, 0x6A, 0xDA, 0x6C, 0xB4, 0x57, 0x68, 0xE3, 0x25, 0x1F, 0x18, 0x62, 0x4D, 0xA8, 0x95, 0x2A,
-    0xC6, 0x3B, 0x32, 0x9C, 0xAF, 0x41, 0x5D, 0x15, 0x92, 0x0B, 0xB2, 0x39, 0xE9, 0xC9, 0xC3, 0x4B,
-    0xE0, 0x55, 0x0C, 0xFB, 0x91, 0xC3, 0x0D, 0x86, 0x9B, 0x0B, 0xEF, 0x61, 0xF8, 0xA3, 0xAF, 0x90,
-    0xBF, 0xDD, 0x8C, 0xBC, 0x0E, 0x7D, 0x91, 0xC2, 0x0C, 0x91, 0x7D, 0x82, 0x80, 0xEC, 0x1A, 0x0C,
-    0xBB, 0x1C, 0xB5, 0xF2, 0xA4, 0x78, 0x54, 0xE2, 0x04, 0x4E, 0x79, 0x46, 0xAF, 0x79, 0x0E, 0xB6,
-    0xF6, 0xA5, 0xC2, 0x0A, 0x51, 0xA3, 0xC9, 0x30, 0x67, 0x92, 0xA4, 0xE5, 0x27, 0x86, 0xDA, 0x42,
-    0xAF, 0x36, 0x25, 0x86, 0xAB, 0xB6, 0xB8, 0xBD, 0xCF, 0xF7, 0x44, 0x97, 0x23, 0xA9, 0x0C, 0x0C,
-    0xA8, 0x91, 0x3E, 0x1C, 0x43, 0xCA, 0x58, 0x3F, 0x07, 0x76, 0xE0, 0xA7, 0x0D, 0x2B, 0xEC, 0x12,
-    0x55, 0xA8, 0x1E, 0xF3, 0xD6, 0xB4, 0x19, 0xEA, 0x44, 0xC0, 0x1C, 0x67, 0x85, 0x93, 0x1A, 0x0D,
-    0x48, 0x58, 0xF5, 0x4E, 0xA9, 0xE8, 0xD2, 0xE0, 0x62, 0xA4, 0x34, 0x2B, 0x03, 0xE5, 0xC3, 0x9E,
-    0x6E, 0x65, 0xD6, 0x08, 0x6B, 0x19, 0x1B, 0x38, 0xD0, 0x80, 0xB1, 0xA6, 0x4E, 0x46, 0x00, 0x14,
-    0x4A, 0x82, 0x4F, 0x26, 0x48, 0x48, 0x46, 0xEA, 0x3C, 0xC2, 0x9F, 0xE9, 0x80, 0xC2, 0x3F, 0x73,
-    0x79, 0xF7, 0xB0, 0xE9, 0xF3, 0xDE, 0x36, 0x81, 0x59, 0xCC, 0x1A, 0x5B, 0x13, 0x03, 0x9C, 0xA9,
-    0x83, 0x48, 0x11, 0x4B, 0xAB, 0x14, 0x7E, 0x55, 0x3B, 0x63, 0x07, 0xC5, 0xF0, 0xBF, 0xFD, 0x7C,
-    0x87, 0x02, 0x05, 0x00, 0x42, 0x53, 0x98, 0xD7, 0x45, 0x99, 0x75, 0xA6, 0x4D, 0xFE, 0xBD, 0x85,
-    0x34, 0x4A, 0xF2, 0x87, 0x65, 0x89, 0xB3, 0x7C, 0xB0, 0x65, 0x86, 0x0D, 0x93, 0x39, 0x19, 0x89,
-    0x32, 0x38, 0x90, 0xC5, 0xB0, 0x75, 0x07, 0x7E, 0x7B, 0xE8, 0x1C, 0x24, 0x1E, 0x86, 0x4D, 0x56,
-    0x42, 0x81, 0xBB, 0xBA, 0x87, 0xB4, 0x40, 0xD3, 0x40, 0x60, 0x81, 0x1F, 0x93, 0x2E, 0x73, 0xDA,
-    0xAE, 0xA2, 0x3B, 0xB6, 0x88, 0xE5, 0x5C, 0x55, 0x6A, 0x0F, 0x96, 0x28, 0xA6, 0xFD, 0x79, 0xA5,
-    0xED, 0xBE, 0xA0, 0x7D, 0x0F, 0x63, 0xF2, 0x91, 0x9D, 0x9D, 0x9D, 0x93, 0x5E, 0xF1, 0xE8, 0xBF,
-    0xF2, 0x0A, 0xCA, 0x3E, 0x14, 0x7E, 0x2A, 0xD3, 0xAF, 0x91, 0x86, 0xB3, 0x6B, 0xA0, 0xFD, 0x5F,
-    0xB6, 0x62, 0x9F, 0x94, 0x68, 0x2D, 0xAC, 0x5C, 0x00, 0x54, 0xA3, 0xC0, 0x99, 0x18, 0xE6, 0x9E,
-    0xE3, 0x0D, 0xCE, 0x83, 0xB9, 0x98, 0x61, 0x48, 0x01, 0x28, 0xDE, 0xAA, 0x16, 0x71, 0x8C, 0x3C,
-    0xE6, 0xF9, 0x46, 0xF9, 0x27, 0xEF, 0x20, 0x35, 0xC3, 0x81, 0xE9, 0x11, 0x28, 0xAD, 0x6D, 0xA7,
-    0xF5, 0x5A, 0x6D, 0xF2, 0x20, 0xB4, 0x4E, 0xF8, 0xB0, 0xBA, 0x7A, 0x1F, 0xAF, 0x07, 0xFC, 0x58,
-    0xE0, 0x21, 0x14, 0x49, 0x90, 0x9F, 0x72, 0x69, 0xD5, 0xDA, 0x2E, 0x9D, 0x40, 0x03, 0x15, 0xE2,
-    0x3C, 0x9D, 0xE0, 0x6F, 0xFB, 0xB1, 0x3A, 0x26, 0x94, 0xB7, 0x09, 0xE3, 0xD9, 0x6A, 0x39, 0xE2,
-    0x82, 0x8F, 0xB4, 0x2E, 0x39, 0x44, 0x8C, 0xED, 0x18, 0x4D, 0x00, 0x67, 0x67, 0x35, 0x15, 0x73,
-    0x56, 0xD1, 0x5B, 0x3D, 0xB3, 0x19, 0x12, 0x97, 0x8D, 0xF0, 0x06, 0x31, 0xE1, 0x8F, 0xB3, 0x79,
-    0xB3, 0x97, 0x7D, 0x4F, 0xD5, 0xFD, 0xD4, 0xE0, 0x9C, 0xDE, 0x5B, 0x52, 0xBE, 0xBF, 0xC1, 0xC4,
-    0xF2, 0x01, 0x44, 0xE7, 0xFE, 0x9A, 0x56, 0xE3, 0xAE, 0x61, 0x06, 0x71, 0x05, 0xA1, 0x3E, 0x66,
-    0xA4, 0xC7, 0x89, 0x55, 0x86, 0x1A, 0x12, 0xBE, 0x52, 0x46, 0x84, 0x8F, 0xC9, 0x2F, 0x2D, 0x28,
-    0x22, 0x5E, 0xD4, 0xC8, 0xB7, 0xD8, 0x77, 0x28, 0x71, 0x65, 0xD4, 0x0E, 0x81, 0x26, 0x6B, 0xBE,
-    0x17, 0xAF, 0xBC, 0x47, 0x11, 0xAC, 0x17, 0x11, 0x92, 0x0D, 0x16, 0xF8, 0xF7, 0x16, 0x4E, 0xC2,
-    0x34, 0x33, 0xC5, 0xE4, 0x11, 0xFA, 0x9B, 0xB6, 0xA9, 0x10, 0x80, 0xB6, 0xCE, 0x50, 0x45, 0xE6,
-    0x1D, 0x36, 0xA8, 0x8B, 0x0E, 0x43, 0xD7, 0x10, 0xD3, 0x77, 0x91, 0x21, 0x21, 0xCA, 0xB0, 0x6E,
-    0x65, 0xF7, 0xBD, 0x84, 0xC4, 0x4C, 0x2F, 0xD2, 0x0A, 0xF4, 0x68, 0xE1, 0x36, 0x1B, 0xFB, 0x50,
-    0x48, 0x06, 0x80, 0xAB, 0x21, 0x83, 0x16, 0xCA, 0xBC, 0x5E, 0x56, 0xBA, 0x8C, 0xF5, 0x65, 0x73,
-    0x0F, 0xFB, 0x86, 0x64, 0x9A, 0xD2, 0x67, 0x31, 0xB1, 0x08, 0xF7, 0xED, 0xBC, 0xA9, 0x37, 0x0F,
-    0x2A, 0xC5, 0xE9, 0xBD, 0x82, 0xCA, 0xE6, 0xB2, 0x43, 0x6F, 0x61, 0xD5, 0x1C, 0x64, 0xEE, 0xAE,
-    0x45, 0x0E, 0x61, 0x36, 0xDE, 0x2F, 0xD2, 0xD2, 0x3E, 0x74, 0x6B, 0xEC, 0xAC, 0xD8, 0xD8, 0xF1,
-    0xBA, 0xC3, 0xAE, 0x19, 0xFB, 0xD2, 0xDA, 0xB1, 0xAD, 0x3D, 0x0B, 0xA7, 0x6F, 0x96, 0x98, 0x3D,
-    0x4B, 0xEC, 0x17, 0x41, 0xB7, 0x6A, 0x5E, 0x15, 0xD5, 0x42, 0x53, 0xDA, 0xB7, 0x7F, 0x90, 0x3F,
-    0xFD, 0xE1, 0x70, 0x26, 0x3F, 0xEB, 0x26, 0x8B, 0x86, 0x63, 0xB6, 0x27, 0xAF, 0x8E, 0xF3, 0x31,
-    0x93, 0x48, 0xF9, 0xE2, 0x9B, 0xDA, 0x1D, 0x80, 0x8E, 0x57, 0xA5, 0xCE, 0xAC, 0x39, 0xDD, 0xAE,
-    0xDD, 0x1D, 0x45, 0xF3, 0x8F, 0x05, 0x61, 0xBA, 0x6E, 0xCB, 0xD2, 0x32, 0x5A, 0xD5, 0x51, 0xD5,
-    0x36, 0x8B, 0xA8, 0x72, 0xBE, 0x59, 0xD4, 0x05, 0xFD, 0x36, 0xBA, 0x9E, 0x1F, 0x43, 0xEA, 0xA1,
-    0x5E, 0x76, 0xDE, 0xE8, 0xD6, 0x33, 0x79, 0xC0, 0xC6, 0xC5, 0x6F, 0xBA, 0x97, 0x23, 0xED, 0x46,
-    0x41, 0x39, 0x68, 0x82, 0xFD, 0xAC, 0xA5, 0x8C, 0xF6, 0xA2, 0xA6, 0x4B, 0x87, 0xE8, 0xAD, 0x10,
-    0x18, 0x67, 0x58, 0xCF, 0x99, 0xEB, 0x73, 0xEC, 0x4C, 0xFB, 0xB2, 0x4C, 0x59, 0x6D, 0x5A, 0xF4,
-    0x90, 0x46, 0x8A, 0x57, 0x40, 0x4D, 0xBC, 0x68, 0x21, 0xC5, 0x2E, 0x95, 0xAA, 0x38, 0xA9, 0x52,
-    0xD0, 0x07, 0x56, 0x65, 0xBB, 0x36, 0x2F, 0x0C, 0x11, 0xB4, 0x84, 0xD9, 0x9C, 0xBD, 0x3B, 0x45,
-    0x6E, 0x91, 0x8B, 0x60, 0x29, 0x74, 0x99, 0x4F, 0x2F, 0xCD, 0xBB, 0xE0, 0x0B, 0x34, 0x44, 0xEC,
-    0xE5, 0x42, 0x79, 0x2E, 0x87, 0x47, 0xA8, 0x9A, 0xF8, 0xDF, 0xB3, 0xA7, 0xD4, 0x4B, 0x2C, 0x64,
-    0x3E, 0x88, 0xB3, 0xAF, 0x42, 0x08, 0x78, 0xB1, 0xDB, 0xAF, 0x5D, 0x86, 0x5D, 0x5B, 0x61, 0x9E,
-    0x54, 0xFB, 0xF3, 0x49, 0xCD, 0x11, 0xED, 0x6E, 0x95, 0x71, 0xA8, 0x9E, 0xFA, 0x78, 0x04, 0xE9,
-    0x8E, 0x08, 0xAC, 0x8B, 0xE0, 0x82, 0x63, 0x08, 0x09, 0xD3, 0x56, 0x6D, 0x42, 0x58, 0x90, 0x89,
-    0x72, 0x86, 0x81, 0xDF, 0x2A, 0x15, 0x9B, 0x88, 0xA7, 0xF8, 0x76, 0x5E, 0xEE, 0x3E, 0x37, 0xE2,
-    0x28, 0xAF, 0x62, 0xD8, 0x9E, 0x56, 0xDB, 0xD9, 0x2F, 0xFE, 0x98, 0x68, 0x43, 0x87, 0x7A, 0xF3,
-    0xB6, 0xF6, 0xCF, 0x06, 0xDC, 0xF2, 0x39, 0x77, 0x7F, 0x19, 0x10, 0x43, 0xE0, 0x39, 0xA0, 0x1D,
-    0xC8, 0x80, 0x31, 0x01, 0x27, 0x76, 0xC2, 0x8E, 0x1C, 0x87, 0x60, 0x63, 0x27, 0xCC, 0x7A, 0x63,
-    0xD7, 0x6A, 0xDD, 0x96, 0xDC, 0x81, 0x42, 0x0E, 0x0A, 0xB1, 0x9A, 0x7C, 0x07, 0x35, 0xD2, 0x51,
-    0x2A, 0x44, 0xE6, 0xEA, 0xB7, 0xA8, 0xD0, 0xA0, 0xFC, 0xAC, 0xD5, 0xC5, 0x96, 0x06, 0x61, 0x2B,
-    0xDB, 0x90, 0x52, 0x29, 0x9E, 0x19, 0xF6, 0x38, 0xE7, 0xBE, 0x72, 0xBD, 0x57, 0xB0, 0x6B, 0xD3,
-    0xD9, 0xDD, 0xBB, 0xAC, 0xC9, 0xAE, 0xB3, 0xD4, 0x04, 0x4F, 0x5D, 0x77, 0xD9, 0x90, 0xA1, 0x3A,
-    0x2F, 0xD8, 0xE7, 0x65, 0x2E, 0xED, 0xF1, 0xF3, 0x87, 0x33, 0x7F, 0x32, 0x58, 0x41, 0x2E, 0x51,
-    0xB8, 0xE9, 0x41, 0xCA, 0x64, 0xB9, 0x1E, 0x08, 0x0A, 0x9F, 0x27, 0x29, 0x31, 0xE9, 0x79, 0x71,
-    0x72, 0x91, 0x47, 0x87, 0xF7, 0x2E, 0xE9, 0xFF, 0x28, 0x2A, 0xD7, 0xEB, 0x8A, 0xA8, 0xD4, 0xDB,
-    0x46, 0xEE, 0x3A, 0x7D, 0xED, 0x42, 0x71, 0x5B, 0x81, 0xC8, 0x9B, 0x91, 0x49, 0xDD, 0x1E, 0xAF,
-    0xB7, 0x3B, 0x50, 0xF9, 0xA5, 0xE0, 0x25, 0xA6, 0xDB, 0x80, 0x46, 0x1A, 0xBD, 0x25, 0x8B, 0xB0,
-    0xA4, 0xDB, 0xB7, 0x5E, 0x94, 0x60, 0x80, 0x18, 0xBC, 0x74, 0x0F, 0x37, 0x28, 0x6D, 0xBE, 0x9A,
-    0xA2, 0x3B, 0x13, 0x43, 0xC4, 0x8E, 0x9C, 0x0E, 0x32, 0x49, 0xB4, 0x88, 0x97, 0xA6, 0x72, 0xF6,
-    0xF5, 0x25, 0xFF, 0x10, 0x88, 0x31, 0x35, 0x96, 0x15, 0x25, 0x96, 0x9F, 0xA1, 0x18, 0x30, 0x7D,
-    0x0D, 0xFC, 0x59, 0xFA, 0xE1, 0x12, 0xF7, 0xE5, 0x0B, 0xD4, 0x3E, 0x16, 0xA5, 0xEA, 0xDA, 0x46,
-    0xA1, 0x1A, 0xCB, 0x49, 0xA5, 0x77, 0x51, 0x11, 0x2D, 0x0D, 0x36, 0xF0, 0x68, 0xDC, 0x3A, 0xB4,
-    0x33, 0xED, 0xA5, 0x64, 0x4C, 0x06, 0x20, 0xA4, 0x6C, 0x68, 0x2C, 0x83, 0x77, 0x4B, 0x3C, 0x25,
-    0x23, 0x50, 0x5A, 0x57, 0x27, 0x26, 0x34, 0xBF, 0xAE, 0x2A, 0xBD, 0x84, 0x86, 0x36, 0xFA, 0xCF,
-    0xAC, 0x69, 0xD2, 0xDE, 0x1D, 0xE3, 0x39, 0xC1, 0x64, 0x53, 0x5B, 0x39, 0x13, 0x8F, 0x31, 0x5A,
-    0x18, 0xD3, 0xDA, 0xB2, 0xC2, 0xCA, 0x09, 0xEC, 0xDE, 0x57, 0x35, 0x52, 0xD9, 0x61, 0xC5, 0x17,
-    0x08, 0xB5, 0x86, 0x68, 0xD3, 0x9A, 0x77, 0x07, 0x99, 0x50, 0x60, 0x9C, 0xE5, 0x7D, 0x9D, 0x5F,
-    0x62, 0x2D, 0x7A, 0x7B, 0x29, 0x3E, 0xA1, 0xE4, 0x53, 0xB0, 0xD7, 0x8D, 0x4D, 0x51, 0xE8, 0x3B,
-    0xA4, 0xA2, 0x29, 0x06, 0x96, 0xBA, 0xAC, 0xC4, 0xD6, 0x47, 0x09, 0x33, 0xB8, 0xA4, 0x87, 0x7D,
-    0xFC, 0x3F, 0x35, 0x4B, 0x3B, 0x12, 0x1F, 0x2B, 0x23, 0x22, 0xEF, 0xA7, 0x6B, 0x51, 0xBB, 0xB7,
-    0x70, 0x5D, 0x7D, 0xA7, 0x9F, 0xAD, 0xD7, 0xB1, 0x53, 0x03, 0xF2, 0x26, 0x42, 0xDA, 0xA3, 0xB2,
-    0xA0, 0xBD, 0x1F, 0x0C, 0xFA, 0xB1, 0xA3, 0xA0, 0xC6, 0x31, 0x1B, 0x12, 0x55, 0x65, 0x01, 0xD8,
-    0x06, 0x39, 0xFC, 0xD1, 0x8D, 0x40, 0x9A, 0x50, 0x2D, 0x83, 0xD3, 0xBE, 0xBF, 0xCA, 0xB0, 0x0D,
-    0xEF, 0x52, 0xB1, 0xA7, 0xE7, 0x45, 0x0E, 0x91, 0x1F, 0x30, 0x4F, 0xB5, 0x58, 0x04, 0x15, 0x6B,
-    0x3F, 0x5F, 0x11, 0x8F, 0x6D, 0xDA, 0x7D, 0x83, 0x10, 0x60, 0x87, 0x93, 0x2F, 0x1A, 0xDA, 0x88,
-    0x8B, 0x63, 0xCF, 0xF3, 0xE6, 0xF5, 0x84, 0x67, 0x28, 0x6F, 0xDF, 0xBF, 0x68, 0x43, 0x24, 0x83,
-    0xC6, 0x58, 0x66, 0xA1, 0x5C, 0x38, 0xB4, 0x9C, 0x83, 0x13, 0xF5, 0xF9, 0x1E, 0x18, 0xC9, 0x12,
-    0x35, 0x58, 0x36, 0xED, 0xD2, 0xFE, 0xA2, 0x5C, 0xCA, 0x50, 0x9F, 0x4D, 0xD1, 0x64, 0xEA, 0xE2,
-    0x95, 0x01, 0x05, 0x78, 0x59, 0x1D, 0x47, 0x09, 0x68, 0x3F, 0xF3, 0x89, 0x56, 0x20, 0xB3, 0x34,
-    0x37, 0x5A, 0x0B, 0x05, 0xD1, 0x68, 0x5C, 0x19, 0x83, 0x4B, 0xF3, 0x76, 0x57, 0xEC, 0xD3, 0x4E,
-    0x16, 0x86, 0xE4, 0xA8, 0x29, 0xB0, 0x20, 0x31, 0x3A, 0xBD, 0x38, 0x01, 0xF4, 0x40, 0xD1, 0x58,
-    0x51, 0x45, 0xA5, 0x4D, 0xDD, 0x19, 0x78, 0xCF, 0x7C, 0x39, 0xA5, 0x37, 0x7D, 0x55, 0x23, 0x45,
-    0xB9, 0x54, 0x3B, 0x55, 0xED, 0xC7, 0x1A, 0x54, 0xD1, 0xD7, 0xB4, 0x08, 0xE8, 0xE4, 0x48, 0x74,
-    0x4E, 0xAB, 0x23, 0xF0, 0x14, 0x2F, 0xBD, 0xCD, 0x4D, 0x72, 0xBA, 0x66, 0xFF, 0x3A, 0x5C, 0x57,
-    0xF0, 0x6E, 0x2B, 0x62, 0xF5, 0xD6, 0xA0, 0x58, 0x2E, 0xAE, 0xA1, 0xE2, 0x85, 0xDF, 0x93, 0x05,
-    0xF6, 0xC3, 0xD9, 0x6C, 0x89, 0x86, 0x18, 0x69, 0x94, 0xAD, 0x0C, 0xF8, 0x8E, 0xF7, 0x72, 0xE6,
-    0x1F, 0x28, 0x0C, 0x67, 0xAA, 0x35, 0x93, 0x93, 0x45, 0x03, 0x45, 0xFB, 0x5A, 0x96, 0x60, 0xAC,
-    0x9F, 0x60, 0xEB, 0x18, 0x2A, 0x44, 0x4C, 0x7E, 0x4C, 0x21, 0xDA, 0xB1, 0x69, 0x4B, 0x59, 0xE0,
-    0xEF, 0xD0, 0x85, 0x31, 0xB4, 0xF1, 0xCC, 0xBE, 0x53, 0xD0, 0x81, 0x3F, 0x67, 0xBD, 0x0F, 0x57,
-    0xB8, 0x84, 0x7B, 0x35, 0xA8, 0xD3, 0xB0, 0x98, 0xD5, 0xB2, 0x6B, 0xED, 0x2E, 0x16, 0x2D, 0xC6,
-    0xAC, 0x5E, 0x2A, 0xB1, 0x75, 0x60, 0x35, 0x66, 0xC2, 0xFD, 0x19, 0x88, 0x80, 0x45, 0x9B, 0x0D,
-    0x17, 0x2E, 0x8A, 0x8C, 0x35, 0xA6, 0x4C, 0x9D, 0x76, 0x08, 0xF9, 0x11, 0xF8, 0x2C, 0x10, 0x75,
-    0x49, 0x17, 0x39, 0x70, 0x08, 0xAA, 0xD0, 0x32, 0x03, 0xBB, 0xC9, 0x00, 0x04, 0x58, 0x31, 0x65,
-    0xDA, 0x86, 0x52, 0xA3, 0x61, 0xAB, 0x18, 0x6E, 0x7B, 0xAB, 0xD0, 0x8A, 0x2D, 0x9A, 0xB4, 0x22,
-    0x06, 0x34, 0x2F, 0x01, 0xC1, 0xF8, 0xA7, 0xF4, 0xFD, 0x9E, 0x5D, 0x4B, 0xD6, 0x27, 0x79, 0xD0,
-    0x4B, 0x3F, 0xFB, 0x4F, 0xFC, 0xFD, 0xDA, 0xFC, 0xA7, 0x9B, 0xD3, 0x2F, 0x7F, 0x26, 0xFF, 0x05,
-    0xBD, 0x59, 0x3D, 0x8C, 0xDD, 0xD6, 0x95, 0x3E, 0x24, 0x3D, 0x22, 0x20, 0x62, 0x4D, 0x17, 0x16,
-    0xBC, 0x50, 0x62, 0x73, 0x8B, 0x34, 0xD1, 0xCA, 0x66, 0x13, 0x60, 0x5D, 0x48, 0xBA, 0x94, 0x5D,
-    0x04, 0x48, 0xB1, 0x56, 0xE1, 0x2C, 0x82, 0xA4, 0x48, 0x8A, 0x14, 0x49, 0x16, 0x1B, 0x37, 0x2E,
-    0x82, 0x40, 0x33, 0xA4, 0x65, 0x60, 0x53, 0xB8, 0xC8, 0x04, 0xE9, 0x13, 0x05, 0x70, 0x61, 0x0D,
-    0x82, 0x8C, 0x8B, 0x2D, 0x14, 0x60, 0xE6, 0x91, 0x6B, 0x17, 0x2E, 0x54, 0x84, 0xF9, 0x2F, 0x52,
-    0x88, 0x96, 0x15, 0x68, 0x11, 0x07, 0xD0, 0x8D, 0xCD, 0xD8, 0x94, 0xCC, 0xC7, 0xBB, 0xDF, 0x77,
-    0x2E, 0xDF, 0x1B, 0x8D, 0x2C, 0x25, 0x71, 0x80, 0xF8, 0x0D, 0xDE, 0xBC, 0x1F, 0x5E, 0xDE, 0xF3,
-    0xF7, 0x9D, 0xEF, 0x9C, 0x73, 0x9F, 0x98, 0x41, 0x5C, 0x13, 0x39, 0x49, 0x7B, 0x29, 0x1B, 0xB9,
-    0x24, 0x77, 0x3E, 0x0A, 0x79, 0x50, 0xC2, 0x5E, 0xD2, 0x56, 0x4A, 0x09, 0x46, 0x49, 0x3A, 0x31,
-    0x85, 0x8C, 0x12, 0x59, 0xC9, 0x2A, 0xD9, 0x94, 0xD0, 0x4A, 0xDA, 0xC8, 0x29, 0x91, 0x6A, 0x5E,
-    0x7F, 0x4E, 0xA4, 0x93, 0xA0, 0x95, 0xB0, 0x91, 0x4F, 0x0C, 0x52, 0x8F, 0x91, 0xFB, 0x63, 0xF2,
-    0x76, 0x91, 0x5E, 0x91, 0xFC, 0xBB, 0x62, 0xFE, 0x5D, 0xCC, 0xA3, 0x62, 0xBE, 0x29, 0xC6, 0x55,
-    0x99, 0x6B, 0x8F, 0xB8, 0x4A, 0x9E, 0x17, 0x79, 0x55, 0xC4, 0x1E, 0x12, 0x29, 0x47, 0x26, 0x91,
-    0xD4, 0x61, 0xE7, 0x5B, 0xB5, 0x44, 0xDD, 0x46, 0xA1, 0xD7, 0x21, 0x43, 0x52, 0x3C, 0xA3, 0x46,
-    0x24, 0xE8, 0xB9, 0xC0, 0x55, 0x91, 0x73, 0x2D, 0x56, 0xE0, 0x8B, 0x01, 0xCF, 0xA5, 0x48, 0xE2,
-    0x44, 0x62, 0xE7, 0xB6, 0x43, 0xE7, 0x46, 0x71, 0xCE, 0x15, 0x6A, 0xC1, 0xAB, 0x49, 0x85, 0xD5,
-    0x45, 0xC9, 0xEF, 0xEA, 0x26, 0xB6, 0x5B, 0x92, 0x9F, 0x1D, 0x64, 0x91, 0xB5, 0xB8, 0x1F, 0xBA,
-    0x2C, 0xF1, 0x32, 0xC6, 0xBF, 0xF9, 0x61, 0xF5, 0x80, 0x3C, 0x20, 0xC1, 0x39, 0xD9, 0x28, 0xF2,
-    0x26, 0x1A, 0x64, 0x0A, 0x26, 0x49, 0xFA, 0xBA, 0x92, 0xF2, 0x66, 0x27, 0x91, 0x83, 0x84, 0x0C,
-    0x7A, 0x09, 0x94, 0x8E, 0xB8, 0x71, 0xED, 0x7A, 0x39, 0x5A, 0xDF, 0x2E, 0x24, 0x1A, 0xF1, 0x6D,
-    0xF9, 0x7F, 0x12, 0x38, 0xD7, 0x60, 0xB7, 0x51, 0x8E, 0xEC, 0x76, 0x5E, 0x1B, 0xC9, 0x9B, 0x95,
-    0x49, 0x47, 0xE5, 0x09, 0x58, 0x70, 0x4A, 0xBE, 0x25, 0xBD, 0x6C, 0xFB, 0xAF, 0xC2, 0x06, 0x6A,
-    0x15, 0xA9, 0x3C, 0x26, 0x8F, 0xEB, 0x85, 0xD5, 0xA3, 0xB4, 0xD8, 0x0A, 0x1E, 0xEE, 0x4E, 0xC1,
-    0xD6, 0x87, 0x24, 0x82, 0xD0, 0x1C, 0x66, 0xD6, 0xCE, 0x06, 0x43, 0x68, 0x61, 0xAD, 0x8D, 0xA6,
-    0xDD, 0x2E, 0xA4, 0xB4, 0x1A, 0xD7, 0xC2, 0x25, 0xB4, 0xDE, 0x97, 0xEC, 0x37, 0xA3, 0x94, 0xF0,
-    0x59, 0x3E, 0x15, 0x12, 0xDB, 0x45, 0x6A, 0x97, 0xE9, 0xB5, 0x65, 0xFE, 0xD6, 0x78, 0xE2, 0xC2,
-    0x2B, 0xB2, 0x90, 0xCC, 0x05, 0xFD, 0xE3, 0xE9, 0xDE, 0x93, 0xA5, 0xBC, 0x79, 0xF3, 0x99, 0xA8,
-    0x19, 0x12, 0x57, 0x25, 0xD7, 0xA9, 0xC3, 0x1F, 0x1F, 0x3C, 0xFF, 0xC9, 0x93, 0x9F, 0x39, 0x65,
-    0x86, 0xEC, 0x7F, 0x54, 0xF8, 0x3F, 0x4B, 0x15, 0xB6, 0x8F, 0x89, 0x89, 0x6C, 0x62, 0x4B, 0x59,
-    0xA6, 0x1D, 0x5F, 0xB2, 0x37, 0x27, 0xC9, 0x7F, 0xB1, 0x14, 0xF3, 0x74, 0x2F, 0xA7, 0xE0, 0xFF,
-    0x73, 0x1B, 0x62, 0x2E, 0x9D, 0x83, 0xA9, 0xF4, 0x68, 0x3C, 0x48, 0xD4, 0x13, 0x0F, 0x31, 0xA3,
-    0x74, 0xEC, 0xF3, 0xCF, 0xE2, 0xFB, 0x1A, 0xDF, 0x1F, 0x2F, 0x20, 0xA4, 0x7E, 0x26, 0x7A, 0xE7,
-    0xD1, 0x27, 0xC6, 0xE7, 0x17, 0xDF, 0x7F, 0xED, 0x3D, 0xB8, 0xB9, 0x0D, 0xE1, 0x45, 0x5A, 0x67,
-    0x1C, 0x3D, 0xB3, 0x01, 0x6F, 0xB6, 0xB1, 0xB3, 0xE9, 0xCF, 0xFB, 0xEC, 0x6C, 0x9F, 0x7F, 0xC7,
-    0xE6, 0xAE, 0x4B, 0x5D, 0x15, 0x2F, 0xBD, 0x23, 0x36, 0xE8, 0x41, 0x3C, 0x0D, 0x9E, 0x5B, 0x58,
-    0xAA, 0x21, 0x1D, 0x34, 0xD6, 0x40, 0x24, 0x45, 0x4A, 0xB8, 0x7D, 0x80, 0x9A, 0x63, 0x5F, 0x80,
-    0x99, 0x74, 0xC2, 0xA8, 0x1F, 0xE3, 0xFE, 0xE8, 0x79, 0x39, 0x29, 0xCF, 0x87, 0x5D, 0x56, 0x19,
-    0x7B, 0x62, 0x3B, 0xEE, 0x37, 0x4E, 0xCA, 0xC9, 0xD8, 0x06, 0xAF, 0xCA, 0xAB, 0xC6, 0x9A, 0x2A,
-    0xB0, 0x69, 0xB1, 0x97, 0x34, 0xC7, 0x10, 0xD6, 0x26, 0xAB, 0x92, 0x36, 0x69, 0xE1, 0x5C, 0x2B,
-    0x23, 0x40, 0xBE, 0x05, 0x8F, 0xE5, 0x85, 0xA9, 0xD2, 0x36, 0x6B, 0x63, 0x9B, 0xDA, 0xC8, 0xFD,
-    0x70, 0x44, 0x74, 0x27, 0xC4, 0xC0, 0x15, 0xA7, 0xEB, 0x9B, 0x4D, 0x46, 0x2C, 0x56, 0x2B, 0xF1,
-    0xE1, 0x74, 0x46, 0xB2, 0x71, 0x53, 0xCA, 0x71, 0x4F, 0xDC, 0x00, 0x25, 0x2D, 0xF2, 0xE9, 0x4F,
-    0xBD, 0xD4, 0xD7, 0xAC, 0x98, 0xD7, 0xF9, 0xEC, 0xA4, 0xFC, 0x6C, 0x2B, 0x2E, 0x69, 0x02, 0x97,
-    0x36, 0xD1, 0x32, 0xAD, 0xA2, 0x31, 0x2B, 0x92, 0x31, 0x47, 0xC6, 0x19, 0xC9, 0xED, 0x19, 0x31,
-    0xDD, 0x69, 0xF8, 0xCF, 0x34, 0x53, 0x32, 0x9C, 0xA8, 0xC2, 0xEA, 0x31, 0x59, 0xC6, 0x7B, 0x81,
-    0x75, 0x2F, 0xF6, 0x12, 0x74, 0xA7, 0x83, 0xE6, 0x64, 0x54, 0x3D, 0x6F, 0xAE, 0x5D, 0x0A, 0x87,
-    0xF4, 0xBF, 0x3E, 0xF9, 0xE8, 0xC9, 0x53, 0xF9, 0x90, 0x76, 0x1E, 0x42, 0xC5, 0xC3, 0x12, 0x57,
-    0x4F, 0x22, 0x3B, 0x97, 0xC8, 0xCC, 0x05, 0xB6, 0x28, 0x25, 0xB1, 0xB5, 0x94, 0xDF, 0x19, 0xA2,
-    0xD1, 0x34, 0x69, 0x33, 0xCA, 0xE3, 0x61, 0x2B, 0xFF, 0x12, 0x32, 0xB0, 0x33, 0x1E, 0x1F, 0x8E,
-    0x88, 0xE4, 0x22, 0x29, 0x98, 0x38, 0x70, 0xE1, 0x20, 0x19, 0x5D, 0x1C, 0x76, 0x4C, 0xE4, 0xD3,
-    0x4C, 0xE8, 0x47, 0x7E, 0x25, 0xFB, 0x1B, 0x89, 0x6B, 0xB2, 0x0B, 0x1D, 0xF2, 0xA2, 0xDB, 0xC7,
-    0x8D, 0x23, 0xEF, 0x34, 0xC9, 0x79, 0x98, 0xFD, 0x8B, 0x37, 0x1A, 0x04, 0xFC, 0xA7, 0x88, 0xD1,
-    0x22, 0x73, 0x9D, 0xE4, 0xD5, 0x7F, 0x0C, 0x0C, 0x7D, 0x4E, 0x76, 0xC0, 0x8E, 0x27, 0x0A, 0x0F,
-    0x23, 0x3C, 0x12, 0x4D, 0x6B, 0x53, 0x51, 0xC6, 0xE3, 0xEA, 0x30, 0x7C, 0x01, 0xC0, 0x34, 0x94,
-    0xF4, 0x84, 0xC8, 0x9E, 0x20, 0x19, 0x92, 0x96, 0xF2, 0x36, 0x9F, 0xBB, 0xE0, 0x6C, 0xFC, 0x96,
-    0xFB, 0x99, 0x6B, 0xB6, 0x1E, 0x4D, 0x0B, 0xC6, 0xF6, 0x34, 0xB5, 0x0A, 0xFA, 0x99, 0x69, 0x4C,
-    0x11, 0x8E, 0x02, 0xF4, 0x80, 0x9F, 0xF2, 0x2A, 0x59, 0xF2, 0x93, 0x71, 0x88, 0x5C, 0x88, 0x68,
-    0x3F, 0xEB, 0x83, 0xC0, 0xFF, 0x5B, 0xD8, 0xF3, 0xAB, 0xE4, 0x1E, 0xE0, 0xE6, 0xBC, 0xC4, 0x6D,
-    0xE8, 0xB8, 0x85, 0xB1, 0xC4, 0x4F, 0x0A, 0x0D, 0x82, 0xB3, 0x8C, 0x31, 0xEE, 0x1C, 0x1F, 0x84,
-    0x81, 0x26, 0xEA, 0xFE, 0x73, 0x3B, 0x6D, 0x96, 0xC4, 0xD3, 0xBF, 0xC1, 0xC0, 0xFD, 0x7F, 0x02,
-    0xC9, 0xE4, 0x2F, 0xBE, 0x54, 0xC1, 0x99, 0x88, 0x76, 0x30, 0x82, 0xA4, 0x40, 0x7B, 0x70, 0x49,
-    0xD6, 0xC8, 0x19, 0x09, 0x5E, 0xF6, 0x40, 0x8B, 0x70, 0x03, 0x93, 0x3E, 0x06, 0x08, 0x09, 0xFA,
-    0x23, 0xDB, 0x87, 0xE9, 0xEB, 0x13, 0xB0, 0x98, 0xCC, 0x03, 0x2E, 0x02, 0x85, 0x08, 0xE1, 0x9C,
-    0x8F, 0x84, 0xBA, 0xDE, 0xC9, 0x3B, 0xC0, 0xA6, 0xF4, 0x01, 0x0D, 0xC3, 0x33, 0xC0, 0xFB, 0xAC,
-    0x48, 0x3F, 0x20, 0x9F, 0x61, 0x41, 0xBD, 0xDA, 0x2E, 0xBC, 0xB8, 0xA2, 0x10, 0x27, 0x5E, 0xE2,
-    0xC1, 0x43, 0xD9, 0x05, 0xBB, 0xC4, 0x4A, 0x49, 0x40, 0x43, 0x5E, 0xE3, 0xC3, 0xFB, 0xD8, 0x7B,
-    0x69, 0x68, 0x83, 0x85, 0xDF, 0x40, 0xD4, 0x13, 0x52, 0x33, 0x6F, 0x0C, 0x89, 0x72, 0x20, 0x1F,
-    0x36, 0x39, 0xB2, 0x28, 0xE2, 0x1B, 0x87, 0x0D, 0x33, 0x90, 0xF9, 0x2F, 0x47, 0xD5, 0x4A, 0xE4,
-    0x21, 0xCA, 0xC0, 0x8E, 0x30, 0x54, 0x68, 0x32, 0x41, 0x22, 0xF7, 0x7D, 0xD0, 0x02, 0xA9, 0x8B,
-    0x59, 0x01, 0xC3, 0x94, 0xFC, 0x00, 0xF7, 0x64, 0x57, 0x1B, 0xAF, 0x41, 0xD2, 0x41, 0x5D, 0x43,
-    0x62, 0x18, 0xB0, 0x94, 0x2A, 0x08, 0x13, 0x28, 0x65, 0x12, 0x23, 0x8B, 0xAC, 0xEA, 0x60, 0x1A,
-    0x71, 0xF0, 0x10, 0x12, 0xC2, 0xB2, 0xF6, 0xCC, 0x3B, 0x17, 0xAB, 0x9D, 0xC1, 0xB4, 0x62, 0x9E,
-    0x03, 0xDD, 0xDA, 0x64, 0xC5, 0xA3, 0x30, 0x89, 0x84, 0x07, 0x41, 0xC3, 0x6C, 0x77, 0x72, 0x13,
-    0xD7, 0xCA, 0x12, 0xBA, 0xF7, 0xA3, 0x37, 0x5C, 0x46, 0x48, 0x4C, 0x3B, 0x2C, 0xAD, 0x65, 0x12,
-    0xB5, 0xDC, 0x40, 0x62, 0x48, 0x89, 0x90, 0xEF, 0x84, 0xA6, 0x83, 0xB5, 0x90, 0x7B, 0xE0, 0xEB,
-    0x76, 0xE5, 0x6C, 0x8B, 0x3B, 0xF3, 0x1B, 0x10, 0xF9, 0x2E, 0xC3, 0xFB, 0x46, 0x77, 0xA7, 0xB5,
-    0xFF, 0x10, 0xB1, 0xD1, 0x40, 0x62, 0x5B, 0x32, 0xC0, 0x35, 0x1C, 0x20, 0xE6, 0x0D, 0xEC, 0x74,
-    0xFC, 0x47, 0x87, 0xCB, 0x6F, 0x44, 0xB7, 0xA8, 0xE8, 0x80, 0xEE, 0x50, 0xD9, 0xB2, 0xD0, 0x8A,
-    0x53, 0x52, 0xB1, 0x67, 0x9A, 0x59, 0xBA, 0xC2, 0x58, 0xC5, 0x27, 0x36, 0xED, 0xBC, 0x7C, 0x3A,
-    0x59, 0x54, 0x01, 0xC6, 0xDE, 0xAA, 0x06, 0x52, 0x22, 0x12, 0xC5, 0xDA, 0xF2, 0xA4, 0xF2, 0x78,
-    0x96, 0xAD, 0x76, 0x86, 0x58, 0x7E, 0x77, 0x98, 0x55, 0x7A, 0x09, 0xB9, 0xE9, 0x34, 0x47, 0x99,
-    0xA2, 0xD3, 0x5F, 0x5A, 0xE4, 0xA3, 0xF1, 0x41, 0xA6, 0xDC, 0x70, 0x8C, 0xD4, 0x62, 0x96, 0xDA,
-    0x51, 0x85, 0xE2, 0xC3, 0x08, 0xC3, 0xCC, 0xFF, 0x32, 0xC4, 0x2B, 0x89, 0xE1, 0x4E, 0xAD, 0x68,
-    0xC6, 0x82, 0xCA, 0xBF, 0xC0, 0x82, 0xD0, 0x69, 0xF4, 0x03, 0x4F, 0xDD, 0xC1, 0x52, 0x73, 0x59,
-    0xC6, 0x5A, 0x01, 0xB8, 0xCC, 0xF5, 0xEB, 0x45, 0xC2, 0xE4, 0x90, 0x9A, 0x35, 0x1B, 0x2A, 0x04,
-    0x13, 0x2F, 0x1A, 0xDD, 0x85, 0x2F, 0x9D, 0x7F, 0x99, 0x76, 0x2A, 0x54, 0x4B, 0xB5, 0x36, 0xEB,
-    0x58, 0xD7, 0x25, 0xB3, 0x34, 0x5E, 0x7B, 0x1B, 0x95, 0x75, 0xE7, 0x23, 0xD8, 0xBD, 0xCD, 0xBA,
-    0xD2, 0x69, 0xD1, 0xC0, 0x6D, 0x4D, 0xAC, 0x79, 0x4B, 0xDC, 0x61, 0xBF, 0x78, 0xF4, 0xE5, 0x5E,
-    0xB1, 0x19, 0x50, 0x6A, 0xDE, 0x53, 0xD7, 0xF6, 0x11, 0xAE, 0xB5, 0x81, 0x6E, 0xEB, 0xEF, 0x9E,
-    0x58, 0xFD, 0x61, 0xDE, 0x93, 0xB3, 0xCF, 0x82, 0x5D, 0xAE, 0xEE, 0x18, 0xE4, 0xB5, 0xB0, 0xAF,
-    0xCB, 0xFC, 0x51, 0xC9, 0xBB, 0xAC, 0xEE, 0xCA, 0xA8, 0x1D, 0xAF, 0x02, 0x53, 0xD5, 0x2A, 0xE0,
-    0xB4, 0x9E, 0xD6, 0xF3, 0x7A, 0x6D, 0x2E, 0x72, 0x1F, 0xD3, 0x42, 0xCC, 0xF6, 0xCC, 0xAE, 0x54,
-    0x2A, 0xBD, 0xBD, 0x53, 0x05, 0x6E, 0x36, 0x40, 0x4D, 0x5E, 0x19, 0xCA, 0x54, 0x0A, 0x29, 0xEC,
-    0xFC, 0x5C, 0xAF, 0xD0, 0xDC, 0xDC, 0xE7, 0x71, 0x74, 0xD7, 0x81, 0x4B, 0x3D, 0x66, 0x3D, 0xE8,
-    0xCA, 0x15, 0x83, 0x33, 0x18, 0x2C, 0xAC, 0x21, 0x7D, 0x6D, 0x10, 0xA9, 0xE8, 0xD6, 0x4A, 0x31,
-    0x55, 0x61, 0xE7, 0x15, 0x5C, 0xD6, 0xBB, 0xC9, 0xC9, 0xF4, 0xA1, 0x5B, 0x51, 0x55, 0xBC, 0x22,
-    0xAF, 0x9C, 0xC4, 0xF7, 0x1E, 0x8C, 0x1F, 0x23, 0xFB, 0x8F, 0x14, 0x6A, 0x9E, 0x46, 0xF3, 0xC4,
-    0x62, 0x95, 0x5A, 0x88, 0x2D, 0xAF, 0xA0, 0x5B, 0xB8, 0x74, 0x62, 0xFB, 0x1E, 0xB6, 0x82, 0x84,
-    0x34, 0x49, 0xAD, 0x67, 0x32, 0xCA, 0x0D, 0xC7, 0x75, 0x6C, 0xF0, 0xB5, 0x0A, 0x4E, 0x09, 0x39,
-    0x3A, 0xDB, 0x5F, 0xA3, 0x64, 0xF3, 0x87, 0x1D, 0x51, 0x6F, 0x27, 0x1A, 0x27, 0x88, 0x56, 0x1C,
-    0x68, 0x97, 0x92, 0xB5, 0x68, 0x18, 0x25, 0x78, 0xE5, 0x40, 0x54, 0x0E, 0xE5, 0x1B, 0x96, 0x40,
-    0x04, 0x14, 0x32, 0x16, 0x4A, 0xDC, 0xA3, 0x96, 0x4A, 0x6D, 0x9B, 0x50, 0x42, 0x60, 0x6E, 0x4A,
-    0xB0, 0x12, 0x2E, 0xA6, 0xF5, 0x7C, 0x1F, 0x28, 0x15, 0xA3, 0x9A, 0x82, 0x87, 0x83, 0xFE, 0x9E,
-    0x01, 0xC3, 0x56, 0xD8, 0x99, 0x99, 0xDE, 0x73, 0x3B, 0xFD, 0x5C, 0xB0, 0xA8, 0x00, 0x36, 0x44,
-    0x19, 0xE4, 0x94, 0x85, 0xA8, 0x27, 0xD8, 0xA2, 0xB1, 0x3C, 0xBA, 0xC2, 0xEF, 0x7E, 0x4A, 0xAB,
-    0x4A, 0xBA, 0x94, 0xF4, 0x77, 0x5D, 0xD2, 0x96, 0x72, 0x48, 0xDD, 0xF4, 0xE0, 0x76, 0xFF, 0xB9,
-    0x65, 0x05, 0xA6, 0x84, 0x49, 0x25, 0xD0, 0x46, 0x4B, 0xA6, 0x60, 0x69, 0x43, 0x73, 0x6C, 0x5A,
-    0x1F, 0xB0, 0xE3, 0x4F, 0x5D, 0x94, 0x65, 0xD6, 0xC4, 0x3D, 0x3A, 0xEA, 0xD7, 0xD1, 0x2D, 0xE5,
-    0xDD, 0x3D, 0x34, 0x26, 0xC1, 0xD0, 0xC3, 0xD8, 0x87, 0x3B, 0x26, 0xFE, 0xAD, 0x8C, 0x1E, 0xEC,
-    0xEC, 0x14, 0x96, 0xBE, 0xAC, 0x52, 0x4F, 0xB6, 0xF2, 0x83, 0xCF, 0x22, 0x68, 0xAE, 0x11, 0x40,
-    0x40, 0x6E, 0x29, 0x69, 0xF4, 0x8C, 0x01, 0x9B, 0xF0, 0x1D, 0x06, 0x01, 0x2D, 0x15, 0xB7, 0x35,
-    0x45, 0xCC, 0x41, 0x05, 0x2B, 0xA3, 0x9E, 0x09, 0x3D, 0x22, 0x21, 0xA4, 0xDC, 0x28, 0x7F, 0xCF,
-    0x56, 0x4E, 0x97, 0x8D, 0x1B, 0x3E, 0x6D, 0x7B, 0xD6, 0x20, 0x85, 0xDD, 0xC8, 0x0C, 0x1E, 0x38,
-    0x33, 0x5C, 0x3C, 0xD0, 0xF4, 0xCC, 0x63, 0x8C, 0xE7, 0xEF, 0x98, 0xF9, 0xF0, 0xB1, 0xC4, 0x2F,
-    0xB5, 0x77, 0xD1, 0xC6, 0x48, 0x4A, 0x58, 0xB0, 0x35, 0x37, 0x05, 0x78, 0x19, 0xDD, 0x81, 0xB3,
-    0x9C, 0x8C, 0x46, 0x04, 0x23, 0x73, 0x67, 0xB9, 0x69, 0xC7, 0xCB, 0x23, 0x68, 0x71, 0xAA, 0x79,
-    0xF9, 0xCB, 0x57, 0xD8, 0x07, 0xBE, 0x8F, 0x6A, 0x6C, 0x29, 0x73, 0x40, 0x0B, 0x12, 0x2F, 0xD1,
-    0xEB, 0x86, 0xEE, 0x29, 0xB2, 0x73, 0x83, 0xA6, 0xBF, 0xB4, 0x5A, 0x5D, 0xE4, 0x28, 0x99, 0x41,
-    0x1B, 0x65, 0x46, 0xF8, 0xEE, 0xC2, 0x0F, 0xC3, 0x5B, 0xCE, 0x39, 0x4E, 0x27, 0x20, 0x60, 0x67,
-    0x40, 0x68, 0xA1, 0x8D, 0x69, 0x12, 0x62, 0x09, 0xB1, 0x0B, 0xD9, 0xC2, 0x22, 0x55, 0x1C, 0xEF,
-    0x27, 0x26, 0x3A, 0xC5, 0x25, 0x2E, 0xC7, 0xE0, 0xE5, 0xED, 0x2F, 0x6B, 0x1B, 0xEB, 0x94, 0x25,
-    0x0B, 0x4F, 0xC3, 0x25, 0xFF, 0x85, 0x74, 0xED, 0x41, 0xDD, 0x69, 0x57, 0x5D, 0x40, 0xA0, 0x09,
-    0xAB, 0xEA, 0x3C, 0x7C, 0x3F, 0xF6, 0x50, 0xDA, 0x54, 0x9A, 0x36, 0x3A, 0x04, 0x75, 0xC9, 0x40,
-    0x60, 0x38, 0xB6, 0x28, 0x79, 0x83, 0xD0, 0x24, 0x16, 0x01, 0x46, 0x85, 0x60, 0x1B, 0xC4, 0x18,
-    0x9B, 0x8A, 0xE0, 0x6C, 0x71, 0x39, 0xB3, 0xC9, 0x74, 0xB6, 0x1C, 0x58, 0x30, 0xB4, 0x33, 0x58,
-    0xD2, 0x2C, 0xA5, 0xD3, 0x89, 0x66, 0x5E, 0x3F, 0x2C, 0xC8, 0xAB, 0xE5, 0xCB, 0x21, 0x01, 0xB6,
-    0x5C, 0xB0, 0x4E, 0x84, 0x6B, 0x4E, 0x29, 0x95, 0xA0, 0xA1, 0x82, 0xF2, 0x20, 0xE2, 0x53, 0x57,
-    0xC4, 0x86, 0xC5, 0x2D, 0x80, 0x05, 0x11, 0xAB, 0xB0, 0x66, 0xE7, 0x91, 0x5A, 0x42, 0x7B, 0x00,
-    0x64, 0xC2, 0x25, 0x2E, 0x83, 0xDF, 0xEB, 0xEB, 0x8F, 0xB8, 0x8A, 0x6E, 0x69, 0xE0, 0x5E, 0x78,
-    0xD9, 0x91, 0xDB, 0x33, 0x2D, 0x2D, 0xF5, 0x74, 0x77, 0x2F, 0xB4, 0x47, 0xAA, 0xAF, 0x7F, 0xC0,
-    0x74, 0xA2, 0xF1, 0x69, 0x76, 0x98, 0xCF, 0x3F, 0x0E, 0x45, 0xD2, 0x56, 0x9B, 0xD0, 0x9A, 0xF4,
-    0x44, 0xA4, 0x38, 0x90, 0x88, 0x7C, 0xE3, 0xBF, 0x5F, 0xFE, 0x98, 0x15, 0x09, 0xC7, 0x1C, 0x35,
-    0x1F, 0x55, 0x70, 0xD0, 0x59, 0xD5, 0xB1, 0xD0, 0xB6, 0xF9, 0x9F, 0xDC, 0x81, 0x0E, 0xC7, 0xD7,
-    0x3A, 0xBB, 0xBF, 0xFC, 0xAE, 0xFA, 0xDB, 0xDE, 0xD5, 0x07, 0xEF, 0xE6, 0x82, 0x9E, 0x2D, 0x57,
-    0xEF, 0xEA, 0x75, 0x91, 0x77, 0x07, 0xEF, 0xAA, 0xBA, 0x5B, 0xC9, 0xAA, 0xE7, 0x6C, 0xAA, 0x8B,
-    0x7A, 0xD6, 0xD0, 0x54, 0xF5, 0x4D, 0xBF, 0x30, 0x6B, 0xEA, 0x2B, 0x1E, 0x4A, 0xA9, 0xAD, 0x5F,
-    0x1F, 0xE7, 0x06, 0xAC, 0x6E, 0x7C, 0x3B, 0x12, 0x40, 0x86, 0xEF, 0x48, 0x20, 0xA4, 0x2D, 0xFD,
-    0x2D, 0xB9, 0xFB, 0xB5, 0xF3, 0x7B, 0x27, 0xDA, 0x74, 0xA8, 0x43, 0x94, 0x61, 0x56, 0xDA, 0x0C,
-    0xF7, 0x78, 0x37, 0x57, 0xA4, 0x7A, 0x8D, 0xDB, 0xBF, 0xE3, 0xDD, 0x9A, 0x5F, 0x17, 0x6B, 0xFF,
-    0x7D, 0xE5, 0x43, 0x1D, 0xBA, 0xCE, 0x09, 0x2C, 0x2E, 0x50, 0xFF, 0xD2, 0x87, 0xF3, 0xD6, 0x55,
-    0x09, 0xCA, 0x67, 0x8B, 0xB0, 0xB1, 0x4B, 0xC2, 0x44, 0x8A, 0xF9, 0x0A, 0x91, 0x07, 0xE5, 0x3A,
-    0xCF, 0x29, 0x48, 0xD8, 0xAC, 0x03, 0x10, 0x40, 0x1E, 0x75, 0x81, 0x0F, 0x40, 0xC9, 0xC4, 0x12,
-    0x51, 0x16, 0xA0, 0xE6, 0xBC, 0x8B, 0xB5, 0x0C, 0x3A, 0x6D, 0xE3, 0x0A, 0xEF, 0x70, 0x56, 0x65,
-    0x5F, 0x3C, 0x0F, 0x1E, 0xE7, 0xD6, 0x0C, 0xB2, 0xC7, 0x7F, 0x9B, 0x32, 0x4F, 0x19, 0x7F, 0xE5,
-    0xF1, 0xB1, 0x68, 0xA7, 0xE3, 0x06, 0x4B, 0x0E, 0x96, 0x71, 0xA2, 0xBF, 0x3D, 0xF2, 0x78, 0x29,
-    0x69, 0x3E, 0xA4, 0x8D, 0xE9, 0x42, 0x15, 0xEB, 0xAA, 0x98, 0x5A, 0xE1, 0x03, 0xB4, 0xAA, 0x0B,
-    0x32, 0x9D, 0xD6, 0x1F, 0xB6, 0xD7, 0xF1, 0x30, 0xAB, 0x48, 0xEE, 0x63, 0xC9, 0xA9, 0xA8, 0x62,
-    0xCB, 0x83, 0xA4, 0x21, 0xB8, 0xA3, 0x15, 0x6F, 0x75, 0x34, 0x60, 0xD5, 0xB1, 0xC4, 0xC3, 0x41,
-    0xA9, 0x0C, 0xB7, 0xBF, 0x4E, 0xEE, 0x67, 0x51, 0x9C, 0x74, 0x30, 0x78, 0x86, 0x75, 0xF1, 0xB7,
-    0xE3, 0x7D, 0x86, 0xB0, 0x01, 0x09, 0x00, 0xD9, 0x86, 0x4E, 0x80, 0x6A, 0x75, 0x03, 0xD5, 0xF2,
-    0x36, 0x54, 0x27, 0x38, 0xEF, 0x91, 0x60, 0x9A, 0xF5, 0x9C, 0x1D, 0x96, 0xD2, 0x7B, 0xB0, 0xB7,
-    0xAC, 0xB0, 0xAC, 0x6C, 0x74, 0x18, 0xA3, 0x36, 0xBD, 0x9F, 0xCD, 0xB4, 0xB5, 0xD1, 0x46, 0xF3,
-    0x4E, 0xCA, 0xA5, 0x3B, 0xB2, 0x39, 0x68, 0x0F, 0xFF, 0xC5, 0x98, 0x81, 0x8C, 0xA6, 0x12, 0x92,
-    0x4D, 0x95, 0x58, 0xD3, 0x64, 0xAD, 0x69, 0xCA, 0x2A, 0x6F, 0xE1, 0xAB, 0xB7, 0x20, 0xFA, 0x83,
-    0xDE, 0x1F, 0xEB, 0xC1, 0x09, 0x09, 0x22, 0xC2, 0xD1, 0x91, 0x3D, 0x36, 0x5C, 0xA8, 0x2D, 0x76,
-    0xC6, 0x09, 0x8C, 0xF6, 0x12, 0xE4, 0x5F, 0xD3, 0x8E, 0x0A, 0x4D, 0x6B, 0x7C, 0x0B, 0x7E, 0x63,
-    0x0F, 0x2F, 0x67, 0x92, 0x2E, 0x93, 0x31, 0x69, 0x16, 0x51, 0x87, 0xEA, 0xC6, 0xF3, 0x3C, 0xF6,
-    0x95, 0x5C, 0xD2, 0x6A, 0xA9, 0xBA, 0x7C, 0x50, 0x22, 0x3B, 0xF8, 0x76, 0x80, 0xE7, 0xF7, 0x50,
-    0xA0, 0xF7, 0x70, 0xE3, 0x28, 0xFB, 0xF9, 0x75, 0x19, 0x4F, 0xA3, 0x58, 0x9C, 0x07, 0x61, 0x6D,
-    0x71, 0xF8, 0xAA, 0xA2, 0x1E, 0x18, 0xB1, 0x09, 0x0F, 0x78, 0x6C, 0x3A, 0xED, 0x76, 0x00, 0x47,
-    0x0B, 0x4F, 0x14, 0xC7, 0xBE, 0x34, 0xF8, 0xA1, 0x9E, 0x0D, 0xC9, 0xE4, 0xBB, 0x90, 0x3B, 0x2C,
-    0xDC, 0x82, 0xBB, 0xBA, 0xF4, 0xED, 0x65, 0x68, 0xD3, 0x66, 0x13, 0xFA, 0x54, 0x69, 0x63, 0x31,
-    0xFC, 0x49, 0xFE, 0x02, 0xBC, 0xC8, 0x73, 0x46, 0x4E, 0x7D, 0x93, 0xB6, 0x55, 0xBD, 0x1F, 0xB0,
-    0x80, 0x7A, 0xA8, 0x28, 0xC7, 0xEE, 0xED, 0xB1, 0x2D, 0x38, 0x64, 0x90, 0xA9, 0x6E, 0x93, 0xC6,
-    0x20, 0x37, 0xC6, 0xB0, 0x83, 0x3A, 0xE8, 0xE4, 0x4E, 0xC9, 0x02, 0xD1, 0xE8, 0x79, 0xC6, 0x89,
-    0x5D, 0x25, 0xB9, 0x35, 0xFA, 0x86, 0x1A, 0xB8, 0x08, 0xE0, 0xC1, 0xF4, 0x6A, 0x2B, 0x63, 0xBC,
-    0x86, 0x4E, 0xB8, 0x64, 0x3F, 0xD3, 0x45, 0xB7, 0x5D, 0x91, 0xCB, 0x18, 0xF4, 0x18, 0x9A, 0x2B,
-    0xEE, 0x61, 0xC4, 0x86, 0x43, 0xEC, 0xF7, 0x28, 0x78, 0x3A, 0x99, 0xDF, 0xA0, 0x7B, 0x2F, 0x7F,
-    0x4A, 0x92, 0xF7, 0x3A, 0xD4, 0x2E, 0x09, 0xAE, 0x1D, 0x32, 0xEF, 0xA3, 0xED, 0x13, 0x5C, 0x3C,
-    0xE1, 0x0F, 0x87, 0x38, 0xC1, 0x9A, 0x37, 0x90, 0x75, 0xEF, 0x4E, 0x87, 0xCD, 0x4B, 0xDE, 0xEF,
-    0xD4, 0x3E, 0x38, 0x4C, 0x68, 0x60, 0xDC, 0xA6, 0x0D, 0x2D, 0x14, 0xF8, 0x0C, 0x9D, 0x28, 0x8F,
-    0x26, 0xB5, 0x0D, 0x61, 0x71, 0xB1, 0xDE, 0x48, 0x86, 0x94, 0x9D, 0xC2, 0xB7, 0x5B, 0x85, 0x87,
-    0x29, 0x0E, 0x6F, 0x17, 0xA1, 0x33, 0x80, 0xB7, 0xA0, 0x1D, 0xF7, 0xBA, 0x4C, 0xD7, 0x23, 0x02,
-    0xE1, 0x90, 0xA9, 0xEB, 0x19, 0x81, 0xD9, 0x46, 0xE5, 0xE7, 0xAB, 0x2F, 0xF9, 0x39, 0x18, 0xB9,
-    0xB0, 0xEB, 0x7E, 0x3E, 0x20, 0x68, 0xCB, 0x2F, 0xDA, 0xAC, 0x60, 0x9F, 0x72, 0x99, 0xA9, 0x18,
-    0x35, 0xD1, 0x9F, 0xCF, 0x49, 0xCA, 0x94, 0x05, 0xA0, 0xDC, 0xAD, 0x5D, 0x7E, 0xE9, 0x06, 0xDE,
-    0xE2, 0x90, 0x49, 0x65, 0xE9, 0xBD, 0x33, 0x9F, 0x65, 0xFF, 0x38, 0xD1, 0x63, 0xB2, 0x5C, 0x1B,
-    0x7A, 0x0E, 0xBF, 0x17, 0xE0, 0xAC, 0x26, 0xE3, 0x29, 0x66, 0x05, 0x86, 0x0B, 0xF7, 0x45, 0x4E,
-    0x53, 0x69, 0x76, 0xB6, 0x8A, 0xA0, 0xC2, 0x1F, 0x4B, 0xDF, 0xAB, 0x87, 0x47, 0x15, 0x43, 0x09,
-    0xCA, 0xBF, 0xD7, 0x27, 0xBF, 0x7F, 0xAE, 0x82, 0x48, 0xD4, 0xD9, 0x17, 0xA1, 0x0A, 0x76, 0x8D,
-    0xA6, 0x9D, 0xCE, 0xA0, 0x13, 0xD2, 0x01, 0x47, 0x6B, 0x85, 0xF5, 0x44, 0x05, 0x20, 0x25, 0xF7,
-    0x05, 0xD2, 0xCA, 0x43, 0x50, 0x83, 0xE1, 0xF9, 0x5E, 0x1F, 0xDE, 0xFA, 0x52, 0xC7, 0x53, 0x72,
-    0x8C, 0x3A, 0x6A, 0x23, 0x8F, 0xF0, 0xFE, 0xF0, 0x13, 0x61, 0xAE, 0xEB, 0xE1, 0x31, 0x7A, 0xAB,
-    0xB8, 0x52, 0x94, 0x87, 0xA4, 0x46, 0xE0, 0x69, 0x48, 0xDA, 0xBB, 0xB7, 0x03, 0xDB, 0x26, 0x08,
-    0xCC, 0xE2, 0xB3, 0x2D, 0xD5, 0x34, 0x6E, 0xE2, 0xC0, 0x96, 0xFE, 0x5A, 0xAD, 0xC7, 0x18, 0x76,
-    0x99, 0xA1, 0x8B, 0xF4, 0x98, 0x81, 0x63, 0xD2, 0xC5, 0x4F, 0xA3, 0x93, 0x27, 0xFD, 0x80, 0x75,
-    0xAE, 0x81, 0x98, 0xDE, 0x5A, 0xDE, 0x4F, 0x47, 0xDA, 0x1E, 0xDE, 0xCA, 0x0A, 0xEE, 0x4A, 0x25,
-    0x39, 0xFA, 0x9A, 0xCF, 0xFB, 0xC3, 0x5E, 0x6A, 0x69, 0xB4, 0x13, 0x1C, 0x75, 0x5F, 0x76, 0xD5,
-    0x2D, 0x38, 0x6C, 0x35, 0x59, 0x5D, 0xA6, 0x2D, 0x48, 0xEF, 0x02, 0x59, 0x0F, 0x44, 0x75, 0xB2,
-    0x8F, 0x2F, 0xD0, 0xF4, 0xE6, 0x8D, 0xB6, 0xCD, 0x0F, 0x91, 0xB3, 0x72, 0x36, 0xAE, 0x77, 0x35,
-    0x65, 0x4C, 0x46, 0xC3, 0x4A, 0x14, 0xF3, 0x3A, 0x8F, 0x22, 0x31, 0x75, 0xF1, 0xD7, 0x0C, 0x9E,
-    0x5F, 0x36, 0x1C, 0x50, 0x7C, 0xD2, 0x82, 0xC1, 0x11, 0xCF, 0xF4, 0xB7, 0xD6, 0x08, 0x0F, 0x3F,
-    0x79, 0x56, 0x69, 0x94, 0xFC, 0x36, 0x35, 0x04, 0x23, 0x8F, 0xA0, 0xC3, 0xD5, 0x99, 0x37, 0xA6,
-    0x9F, 0x84, 0x83, 0xDA, 0x5E, 0x64, 0xC7, 0xE4, 0x9D, 0x31, 0x7D, 0x77, 0x45, 0xD6, 0x97, 0x75,
-    0xB0, 0x19, 0x38, 0xC0, 0x85, 0x56, 0x17, 0x77, 0x8C, 0x1E, 0x54, 0xC7, 0x40, 0x90, 0x2B, 0x88,
-    0x56, 0x39, 0xC7, 0x2C, 0xD6, 0xD3, 0x86, 0x23, 0xF4, 0xD7, 0xB1, 0xC5, 0xB3, 0x74, 0x0F, 0x7B,
-    0x65, 0xE5, 0x61, 0xCE, 0x43, 0x6F, 0xEA, 0x44, 0xCA, 0x58, 0x20, 0x53, 0x52, 0xD0, 0x2A, 0x6E,
-    0x57, 0x08, 0x12, 0x84, 0x67, 0xD9, 0x51, 0x73, 0xA9, 0x61, 0x3D, 0x49, 0xF5, 0x44, 0xE5, 0xA7,
-    0xAB, 0xDF, 0x1D, 0x24, 0x4F, 0x7D, 0xA3, 0x4A, 0xC5, 0xEC, 0x61, 0x20, 0x6E, 0xD6, 0xAC, 0x8B,
-    0x48, 0xBD, 0x9B, 0x5D, 0xB8, 0x8C, 0x6C, 0xD4, 0x47, 0xC8, 0xCC, 0xB8, 0x4B, 0x30, 0x16, 0xA6,
-    0xC8, 0xAD, 0xB4, 0xCD, 0x1A, 0x76, 0x86, 0xF8, 0xAB, 0xCA, 0x0A, 0x6B, 0x8F, 0x7B, 0x42, 0xD4,
-    0x13, 0xE4, 0x35, 0xF3, 0x20, 0x35, 0x80, 0x90, 0x68, 0xAA, 0xAB, 0x1A, 0xB9, 0xD8, 0xA4, 0xAF,
-    0xF5, 0x32, 0x1A, 0xC9, 0x5F, 0x1C, 0x32, 0xEB, 0xE1, 0xD2, 0xB0, 0x3B, 0xCC, 0xAF, 0xFB, 0x5F,
-    0x93, 0x38, 0x7D, 0x22, 0xBF, 0xC9, 0xD7, 0x9B, 0xF7, 0x40, 0xC6, 0x47, 0xD9, 0x4C, 0x47, 0x13,
-    0xA3, 0xB5, 0x24, 0xC0, 0x20, 0x60, 0x7C, 0x77, 0x11, 0xF8, 0xBC, 0x32, 0x6F, 0x0F, 0x60, 0xF6,
-    0x86, 0x53, 0x60, 0x91, 0xBE, 0x0E, 0x7A, 0x30, 0x2F, 0x38, 0xE0, 0xB4, 0xE3, 0x94, 0x02, 0x02,
-    0x09, 0x57, 0xED, 0x6B, 0xFE, 0x20, 0x48, 0xA7, 0xA3, 0x73, 0xB2, 0x35, 0x5A, 0x3E, 0xC2, 0x16,
-    0xEC, 0xC1, 0xB3, 0xD7, 0x46, 0xCE, 0xBC, 0x62, 0xAE, 0x0C, 0xF2, 0x8D, 0xCF, 0xBD, 0x7C, 0xA7,
-    0x2D, 0xDC, 0x86, 0xC6, 0x70, 0x1F, 0xFE, 0x61, 0x23, 0x70, 0x20, 0x42, 0xF7, 0x02, 0x7F, 0x78,
-    0x9A, 0x74, 0x66, 0xA2, 0x41, 0x5E, 0x9D, 0xAF, 0xF9, 0x86, 0x8D, 0xA3, 0x2E, 0xF9, 0x2F, 0xF1,
-    0x48, 0x0A, 0xBE, 0xB8, 0xB3, 0x44, 0xD8, 0xA7, 0x5C, 0x47, 0xA2, 0xB9, 0x9D, 0x66, 0x69, 0x2A,
-    0x8B, 0xF5, 0x39, 0xB3, 0x3E, 0x1E, 0x58, 0xC1, 0x6E, 0x9E, 0xDC, 0xF4, 0x97, 0x31, 0x5F, 0xBC,
-    0x65, 0x4E, 0x05, 0x23, 0xEB, 0x06, 0x4C, 0x74, 0xF7, 0x50, 0x01, 0xE1, 0x0F, 0x65, 0x34, 0xF9,
-    0x8F, 0xCC, 0x07, 0x6A, 0x7A, 0x72, 0xC3, 0xCE, 0x24, 0x1C, 0x08, 0xAA, 0xE8, 0x1D, 0x9E, 0x2D,
-    0x27, 0x37, 0xDE, 0x25, 0xC0, 0xAE, 0x5E, 0xE1, 0x69, 0xA0, 0x63, 0xD7, 0x9C, 0x6A, 0x2F, 0xA5,
-    0xE3, 0xA8, 0xFF, 0x8D, 0x0C, 0xFF, 0xB7, 0xD7, 0x67, 0xFF, 0x69, 0x33, 0x9F, 0x2A, 0xAC, 0x45,
-    0x4F, 0xF3, 0xFC, 0xBC, 0x3A, 0x0B, 0xF3, 0xA7, 0x5C, 0x7A, 0x38, 0x25, 0x72, 0x52, 0x56, 0x07,
-    0xD1, 0xDA, 0x8C, 0x6B, 0x37, 0x41, 0x47, 0x1C, 0x59, 0xCD, 0xE6, 0x71, 0x1B, 0x77, 0x7B, 0xB2,
-    0x9F, 0xF0, 0x97, 0x8D, 0x60, 0x4C, 0xAB, 0xFC, 0x85, 0x3E, 0x1A, 0xF2, 0xA2, 0x7C, 0x0A, 0x35,
-    0xDC, 0xDC, 0x98, 0x83, 0xB3, 0x14, 0xDF, 0xCF, 0x17, 0x7A, 0xEE, 0x05, 0xDA, 0xA4, 0x33, 0xF6,
-    0xEF, 0x31, 0xB4, 0xFE, 0xED, 0x9B, 0x65, 0x3E, 0x28, 0x18, 0xD2, 0x51, 0x75, 0x23, 0xBB, 0x06,
-    0xCA, 0xA6, 0x6C, 0x25, 0x4D, 0x82, 0x2E, 0x03, 0x50, 0xCD, 0x9A, 0x01, 0x35, 0xA8, 0x30, 0x17,
-    0xFA, 0xB8, 0xCF, 0xC5, 0x45, 0x53, 0x39, 0x23, 0xB6, 0x4D, 0x26, 0xDA, 0x50, 0xBD, 0x22, 0x29,
-    0x80, 0x92, 0x13, 0x28, 0x28, 0x94, 0xF5, 0xCF, 0x86, 0xBB, 0x95, 0xE1, 0x56, 0x89, 0xC2, 0x24,
-    0x6B, 0xA0, 0x4E, 0x85, 0xCD, 0x2A, 0xE8, 0x83, 0x3A, 0x0C, 0xB0, 0xDC, 0x58, 0x01, 0x06, 0x65,
-    0x74, 0x1A, 0x57, 0x3F, 0x8F, 0xB1, 0x1F, 0x60, 0x83, 0xC6, 0x48, 0x87, 0xF6, 0xAF, 0xB7, 0xD4,
-    0x88, 0x02, 0x12, 0x1B, 0xB2, 0x42, 0x1E, 0xC4, 0x95, 0xA0, 0x4B, 0x02, 0x38, 0x1A, 0xE0, 0x1E,
-    0xC7, 0x31, 0x90, 0x5D, 0x19, 0x43, 0xCF, 0x27, 0x8F, 0x40, 0x19, 0x46, 0xC6, 0x89, 0x51, 0xD8,
-    0xE5, 0x99, 0x10, 0x7F, 0x8C, 0x9C, 0xB4, 0xF3, 0xF4, 0x98, 0x22, 0x7E, 0x8C, 0x3F, 0xA6, 0xC6,
-    0xA4, 0x99, 0x00, 0x30, 0xCB, 0x1A, 0x76, 0x0E, 0xC1, 0x00, 0x0B, 0x8A, 0x21, 0xB2, 0xB9, 0x98,
-    0xB8, 0x8B, 0xDF, 0x1C, 0x65, 0xE1, 0x8A, 0x94, 0x54, 0xD3, 0x91, 0xCB, 0x57, 0xB7, 0x79, 0x16,
-    0x38, 0xE2, 0x01, 0x42, 0x26, 0xB5, 0x9C, 0x20, 0xB1, 0x20, 0x47, 0xE5, 0x08, 0x2E, 0x9D, 0xA8,
-    0xEE, 0x63, 0x06, 0x7C, 0x58, 0xD0, 0x0C, 0x20, 0x84, 0xEC, 0xCD, 0x7A, 0xFC, 0xB4, 0xF5, 0x76,
-    0x98, 0xAB, 0x8D, 0x3F, 0x4F, 0xCE, 0x88, 0x49, 0x1A, 0xA2, 0xCA, 0xAE, 0x0E, 0x52, 0x69, 0xC9,
-    0xBF, 0xAA, 0x99, 0x1C, 0x62, 0x87, 0xF9, 0xEA, 0xFF, 0x03, 0xC5, 0x5B, 0xBF, 0x8F, 0xDD, 0x56,
-    0x76, 0xBE, 0x24, 0x3D, 0x22, 0x20, 0x02, 0xE1, 0x16, 0xF6, 0x26, 0xD6, 0x14, 0x4C, 0x91, 0x66,
-    0x95, 0x40, 0xAC, 0x17, 0xB0, 0x44, 0x7A, 0x0D, 0x64, 0x4B, 0xAB, 0x58, 0x6D, 0x11, 0x17, 0xDE,
-    0x72, 0x63, 0x27, 0x98, 0x7F, 0xC0, 0x1A, 0xD2, 0x76, 0x61, 0x20, 0x4D, 0xA6, 0x58, 0xA7, 0x8D,
-    0x0A, 0x2F, 0xE0, 0x7D, 0x0E, 0xA2, 0x2D, 0x5D, 0x48, 0x43, 0x1A, 0x2E, 0xB6, 0x70, 0x91, 0x17,
-    0x19, 0x8B, 0x14, 0x0B, 0xC4, 0x04, 0x6C, 0xC7, 0x88, 0x55, 0x88, 0xD9, 0xD0, 0x2B, 0x8E, 0xC4,
-    0xC7, 0xBB, 0xDF, 0xF7, 0x5D, 0xF2, 0xBD, 0x37, 0x3F, 0x24, 0x6F, 0x6C, 0xC7, 0xFB, 0xEC, 0x79,
-    0xF3, 0xE6, 0x91, 0xBC, 0xF7, 0xFC, 0x3E, 0xDF, 0x39, 0xE7, 0xCA, 0x18, 0xB3, 0xF3, 0x37, 0xC6,
-    0x78, 0xD6, 0xD6, 0xC6, 0x58, 0xDB, 0x19, 0xF3, 0xD4, 0x8F, 0xCC, 0xE9, 0x57, 0x80, 0x0B, 0xC6,
-    0x5F, 0x19, 0xDE, 0x59, 0xE2, 0xDD, 0x36, 0x78, 0x3B, 0x1C, 0xF0, 0x56, 0x14, 0x78, 0xCB, 0x9E,
-    0xC7, 0xD3, 0xE9, 0xEB, 0xAD, 0x31, 0x71, 0x8D, 0x9B, 0xE2, 0x26, 0xCB, 0x4D, 0xD4, 0xC6, 0x8D,
-    0x09, 0xAC, 0xED, 0xF9, 0x66, 0x8D, 0x6F, 0xB9, 0x05, 0xDE, 0x5A, 0x63, 0x4D, 0x30, 0x98, 0xA2,
-    0x34, 0x36, 0xCF, 0x6A, 0x93, 0x2D, 0xB9, 0xBE, 0xC7, 0xCD, 0x79, 0xB9, 0x35, 0xFB, 0x8B, 0x9F,
-    0x9D, 0xDE, 0x3F, 0xBA, 0xDF, 0x98, 0x18, 0x4B, 0xC5, 0x77, 0x57, 0x26, 0xAA, 0x33, 0x13, 0x2E,
-    0xE3, 0xDA, 0x6F, 0x82, 0xD6, 0xB4, 0x66, 0x30, 0xCF, 0x98, 0x43, 0x93, 0x58, 0x9B, 0x63, 0x9F,
-    0xA5, 0x96, 0x88, 0x8E, 0x86, 0xF5, 0x93, 0xB7, 0x42, 0x90, 0x9A, 0x92, 0xB1, 0x10, 0xCF, 0x83,
-    0xDE, 0x4F, 0xCE, 0x60, 0x8F, 0x8C, 0x99, 0x2A, 0xE7, 0x65, 0x32, 0x96, 0xF1, 0xC6, 0xB4, 0xC2,
-    0x5B, 0xF2, 0x11, 0x18, 0x8B, 0x3F, 0x04, 0x63, 0x51, 0x83, 0x35, 0x83, 0x16, 0x8C, 0x05, 0x7D,
-    0xBC, 0x34, 0xFE, 0x10, 0xF4, 0xA4, 0x79, 0xE4, 0x1B, 0x28, 0xAF, 0xB8, 0x6F, 0x66, 0xED, 0x60,
-    0xC0, 0x93, 0x35, 0x49, 0x03, 0xC6, 0xE2, 0xD6, 0xC4, 0xDD, 0x16, 0x19, 0x19, 0x6E, 0x09, 0x49,
-    0x89, 0x36, 0xF9, 0xBA, 0xDC, 0x91, 0xE6, 0x14, 0xC2, 0x0B, 0xC7, 0x49, 0x1F, 0x24, 0x38, 0xBC,
-    0x0F, 0x52, 0x57, 0x99, 0x53, 0x86, 0xA8, 0x1D, 0xA1, 0xBA, 0xB4, 0xCE, 0x4A, 0x69, 0x82, 0xA4,
-    0xA6, 0x20, 0x92, 0x1A, 0xA9, 0xA9, 0x06, 0xD2, 0xF9, 0xE1, 0x60, 0x02, 0x2E, 0x46, 0x45, 0xC6,
-    0xF5, 0xA4, 0xE1, 0x58, 0x22, 0xC8, 0xD7, 0x24, 0x56, 0xFB, 0x20, 0xBF, 0x01, 0x81, 0x7E, 0x1B,
-    0xD7, 0xD7, 0xCD, 0x10, 0x95, 0x71, 0x0D, 0xEA, 0x62, 0x93, 0xBE, 0x0A, 0xAB, 0x89, 0x41, 0x1F,
-    0x48, 0xF3, 0xC7, 0xC2, 0x99, 0x0A, 0x96, 0x4B, 0xF1, 0xC9, 0xE2, 0x17, 0xE8, 0x79, 0x89, 0x0B,
-    0x24, 0xB4, 0x22, 0xAC, 0x6E, 0xB4, 0x30, 0x55, 0x9E, 0x6F, 0x49, 0xC0, 0xBB, 0x29, 0x41, 0x36,
-    0xA6, 0x80, 0x04, 0x41, 0x61, 0x1D, 0x5A, 0x5C, 0x26, 0x21, 0x19, 0x38, 0x0B, 0xC9, 0xB0, 0xA8,
-    0xEA, 0x48, 0x1E, 0x17, 0xC0, 0x07, 0xDF, 0x2E, 0x77, 0x79, 0x6F, 0xEB, 0xD1, 0xBE, 0x62, 0xF7,
-    0xF4, 0x48, 0x53, 0xA6, 0x49, 0x5D, 0x32, 0xE6, 0x15, 0xE3, 0x75, 0x10, 0xC2, 0xB4, 0xD3, 0x2E,
-    0xD8, 0x07, 0xE3, 0xFF, 0x12, 0x35, 0xE4, 0x32, 0x2D, 0x0D, 0x84, 0x03, 0x41, 0x65, 0xAF, 0x81,
-    0xB1, 0x3A, 0xB1, 0xCB, 0x73, 0x32, 0x6C, 0xBE, 0x62, 0x19, 0x42, 0x4E, 0x06, 0x48, 0xC0, 0x8B,
-    0xB5, 0xF1, 0xDB, 0x68, 0x79, 0xD2, 0x66, 0x5E, 0xC6, 0xC5, 0xD8, 0xED, 0xD7, 0x8A, 0x64, 0x8F,
-    0xFB, 0x4A, 0x6E, 0x7C, 0x4C, 0x34, 0x93, 0x78, 0x43, 0x4E, 0xF4, 0x17, 0x89, 0x36, 0x55, 0x77,
-    0xAE, 0xA6, 0x2F, 0xC0, 0x12, 0xC0, 0xAA, 0xA8, 0x86, 0x76, 0x4B, 0xBC, 0xAD, 0x26, 0x09, 0xA5,
-    0xB5, 0xE1, 0x52, 0xF1, 0x47, 0x4B, 0x33, 0x84, 0x6B, 0x4B, 0x39, 0x07, 0x01, 0x55, 0x78, 0x60,
-    0xFC, 0x25, 0xEC, 0x81, 0x5C, 0x91, 0x05, 0x0A, 0x9A, 0x1F, 0xE3, 0xA6, 0x24, 0x17, 0xE0, 0x3F,
-    0x37, 0x7B, 0xBD, 0xEE, 0xE7, 0x55, 0x79, 0x2D, 0xCD, 0x1A, 0x96, 0x68, 0xCC, 0xE2, 0xFF, 0x55,
-    0xDE, 0x90, 0x66, 0x52, 0x73, 0x23, 0x3C, 0xEC, 0xFD, 0x42, 0x7B, 0x54, 0xA5, 0x6F, 0x5B, 0x48,
-    0xDC, 0x07, 0x45, 0x58, 0xF1, 0x50, 0x37, 0x41, 0xF6, 0x41, 0xFF, 0xE7, 0xD8, 0x1B, 0x1C, 0x2F,
-    0xBD, 0x8A, 0xFC, 0x3D, 0x6D, 0xBE, 0x07, 0xFB, 0x78, 0x0D, 0x77, 0x45, 0x5C, 0x8A, 0x66, 0xA3,
-    0x07, 0x8C, 0xB9, 0x71, 0xDA, 0x55, 0x2F, 0xD0, 0xD4, 0xB9, 0x77, 0x48, 0xB7, 0x23, 0xE9, 0xA6,
-    0xE8, 0x26, 0x72, 0x03, 0xBA, 0x82, 0x88, 0x97, 0x1A, 0xE4, 0x7C, 0x49, 0x3B, 0x4B, 0x3E, 0x5D,
-    0x79, 0xBF, 0x14, 0xFD, 0x14, 0x78, 0xEB, 0x18, 0x08, 0xF9, 0x36, 0x71, 0x40, 0x26, 0xBC, 0x5E,
-    0x72, 0xA7, 0x34, 0x7C, 0xAE, 0xD3, 0x6E, 0x36, 0x86, 0xFD, 0x50, 0x01, 0xE0, 0x07, 0xB1, 0xC0,
-    0x79, 0x0A, 0x65, 0x0C, 0x96, 0x68, 0x46, 0xB4, 0x23, 0xA9, 0x00, 0x5C, 0x99, 0x8D, 0x29, 0xE1,
-    0xD2, 0x2D, 0xDC, 0xFB, 0x1B, 0x0A, 0x95, 0x12, 0x56, 0x08, 0x35, 0xDD, 0x29, 0xAE, 0x32, 0xFB,
-    0x09, 0xDF, 0x70, 0x4B, 0x41, 0x62, 0xAA, 0x85, 0xC2, 0x24, 0x18, 0x18, 0xA1, 0x44, 0x6F, 0x85,
-    0x37, 0x90, 0x13, 0x74, 0x88, 0x9B, 0x41, 0x8B, 0xC0, 0x13, 0xB6, 0x61, 0x07, 0xA5, 0x47, 0xAD,
-    0xA2, 0xCC, 0x77, 0x69, 0xBF, 0x78, 0x36, 0xA5, 0x5E, 0x5C, 0x0C, 0x72, 0xCA, 0x79, 0x30, 0x91,
-    0xC0, 0xB7, 0xA7, 0xF1, 0xB6, 0x7F, 0x85, 0x91, 0xE8, 0x36, 0xA5, 0x0B, 0xE6, 0xBC, 0xA3, 0xDE,
-    0xEC, 0xFE, 0xD7, 0xFD, 0x0E, 0xB1, 0xAB, 0x65, 0x78, 0x6E, 0xC0, 0x57, 0x01, 0xBB, 0x2B, 0x11,
-    0xC1, 0x52, 0x86, 0xB1, 0x2B, 0x74, 0x82, 0x8C, 0xFA, 0xC7, 0x7A, 0x7C, 0x83, 0x78, 0x13, 0xBE,
-    0x05, 0x2B, 0xAE, 0x11, 0xDB, 0x23, 0x2A, 0x0B, 0x01, 0x8D, 0x06, 0x91, 0x3B, 0xA2, 0xB3, 0x1A,
-    0xB1, 0x04, 0x81, 0x3F, 0xCB, 0x49, 0xE1, 0x52, 0x54, 0xD3, 0xC6, 0x06, 0x10, 0x67, 0x8A, 0x9D,
-    0xE2, 0xD3, 0x3C, 0x2B, 0x63, 0xDD, 0x36, 0xEC, 0x38, 0x4B, 0xE2, 0xFE, 0x08, 0x4D, 0xD9, 0xE4,
-    0x0E, 0x3D, 0x75, 0x72, 0x63, 0x8B, 0x70, 0x9A, 0x30, 0x2E, 0x19, 0x5E, 0x32, 0x8B, 0x11, 0x97,
-    0xA0, 0x24, 0x10, 0xDE, 0x99, 0x47, 0x10, 0x5E, 0x7E, 0x19, 0xE1, 0x58, 0xE1, 0xAA, 0xCB, 0x78,
-    0x31, 0x2F, 0xBF, 0xF4, 0xF3, 0xB3, 0x32, 0x9E, 0x39, 0x7F, 0x53, 0x61, 0x7D, 0x24, 0x8B, 0xB0,
-    0x96, 0xE5, 0x14, 0x21, 0x65, 0x16, 0x31, 0xCD, 0xB6, 0x70, 0xBB, 0x33, 0x0A, 0x40, 0xAB, 0xD9,
-    0xC1, 0x7C, 0x8D, 0x36, 0x93, 0x7D, 0xBE, 0xE0, 0x0E, 0x03, 0x2C, 0xDA, 0xE5, 0x85, 0x5A, 0x4E,
-    0xC3, 0xD7, 0x13, 0x64, 0x50, 0x3B, 0x5F, 0x5C, 0x5C, 0x33, 0x8F, 0x7A, 0x45, 0xB4, 0x36, 0x64,
-    0xCD, 0xA3, 0x24, 0x8F, 0x3E, 0xDD, 0x2B, 0x71, 0x7B, 0x09, 0x09, 0x96, 0xD9, 0xB5, 0xC9, 0xDA,
-    0x3E, 0xFF, 0x57, 0xAC, 0x0A, 0x49, 0x63, 0x0B, 0xDF, 0x1E, 0x6C, 0x27, 0xBB, 0x80, 0xFB, 0x28,
-    0xCD, 0x28, 0x33, 0x7C, 0x2B, 0x3C, 0x31, 0xAC, 0x23, 0x42, 0x32, 0xC1, 0x45, 0xF8, 0x31, 0xD5,
-    0xF2, 0x11, 0x6C, 0x55, 0x25, 0x96, 0x1F, 0xC4, 0x96, 0x7F, 0xF4, 0x42, 0x23, 0xA5, 0x92, 0x1E,
-    0xF2, 0x45, 0x8F, 0x0A, 0xC6, 0x45, 0x23, 0x18, 0x42, 0xC6, 0x4C, 0xF5, 0xC9, 0xDA, 0x0E, 0x22,
-    0x52, 0xC0, 0xCD, 0x90, 0xB1, 0xA6, 0xF8, 0x72, 0x82, 0x2F, 0x7F, 0xB2, 0x22, 0x17, 0xF5, 0x8A,
-    0xF9, 0x19, 0xCA, 0x20, 0x91, 0x94, 0x2C, 0x63, 0x24, 0x12, 0xC2, 0x11, 0xE9, 0x98, 0x99, 0xB2,
-    0x8B, 0xB7, 0x19, 0x0E, 0xF8, 0xB4, 0xDC, 0xA6, 0x56, 0x58, 0x86, 0xEC, 0x5A, 0x3D, 0x8A, 0xDD,
-    0xE8, 0xB2, 0x17, 0xCB, 0x33, 0x35, 0x04, 0x5E, 0xC9, 0xC9, 0xE1, 0x8F, 0x7B, 0xE8, 0xE7, 0x35,
-    0xEC, 0x0F, 0x36, 0x18, 0x8E, 0xA1, 0x1D, 0x66, 0x6B, 0xF2, 0x90, 0x1E, 0x7D, 0xF3, 0xD4, 0xD1,
-    0xFE, 0xCD, 0x95, 0x39, 0xD4, 0x65, 0x4C, 0xAA, 0x4F, 0xFE, 0xDF, 0x28, 0xE2, 0xB3, 0xD0, 0x04,
-    0x48, 0x81, 0x3F, 0xC4, 0x07, 0xCA, 0x51, 0x7E, 0x7B, 0x2C, 0x20, 0x71, 0x93, 0x04, 0xA1, 0x10,
-    0x4B, 0x32, 0x2F, 0x71, 0x4B, 0xAF, 0x3D, 0x5B, 0xA9, 0xB2, 0xAA, 0xD4, 0x71, 0x60, 0x5D, 0x44,
-    0x14, 0x87, 0xE2, 0x43, 0x2C, 0xCA, 0xD9, 0xC4, 0x63, 0xC0, 0x48, 0x21, 0x26, 0xC5, 0xBF, 0xB8,
-    0x8C, 0x1F, 0x2C, 0x4A, 0xB1, 0xE9, 0xC2, 0x79, 0xA6, 0x98, 0x2E, 0x40, 0xAA, 0xD7, 0x3E, 0xE8,
-    0xF4, 0x89, 0x79, 0x62, 0x2E, 0x05, 0xF7, 0x36, 0x7E, 0x63, 0x1E, 0xF7, 0x8A, 0x94, 0x49, 0x5A,
-    0x59, 0x99, 0x81, 0x28, 0xE8, 0x6C, 0xA5, 0x53, 0xC0, 0x35, 0x97, 0x2F, 0xE5, 0x3F, 0x02, 0x54,
-    0xB2, 0xB3, 0x49, 0x24, 0x2E, 0xF9, 0x53, 0xD5, 0x21, 0xD9, 0x55, 0xF6, 0x0F, 0xBE, 0xC0, 0x75,
-    0xBF, 0x8B, 0x1E, 0x65, 0xD0, 0x4F, 0x5D, 0x35, 0x53, 0x08, 0x72, 0x56, 0x2B, 0x9F, 0xCC, 0x77,
-    0x9C, 0xEF, 0x29, 0x1F, 0xC9, 0x6A, 0x1D, 0xB8, 0xCC, 0xEA, 0xF3, 0x3F, 0x03, 0xCB, 0x81, 0xED,
-    0xA1, 0x39, 0xBB, 0xF2, 0xAD, 0xF9, 0xAE, 0xCD, 0xAB, 0x9A, 0x00, 0x6F, 0xBC, 0x66, 0x09, 0xD1,
-    0x18, 0xFB, 0xA7, 0xE4, 0x04, 0x12, 0xF6, 0x46, 0x79, 0x76, 0x48, 0x49, 0xA4, 0x42, 0x66, 0x44,
-    0xA3, 0x54, 0xCA, 0x16, 0x30, 0xD8, 0x7E, 0x9D, 0xEB, 0x15, 0x28, 0xF1, 0xFC, 0x5D, 0x10, 0x7F,
-    0x2B, 0x44, 0xE2, 0x20, 0x0A, 0xBD, 0x44, 0xA9, 0x29, 0x8D, 0xD4, 0xC4, 0xA4, 0xAF, 0x56, 0xB5,
-    0x82, 0x87, 0xEE, 0x94, 0x6A, 0xBC, 0x4A, 0xE0, 0x03, 0x22, 0xCB, 0x11, 0x39, 0x13, 0x17, 0x6E,
-    0xEB, 0x09, 0x31, 0x3F, 0xB5, 0xB5, 0x41, 0x9C, 0xDF, 0x22, 0x47, 0xC2, 0x06, 0x76, 0x9D, 0x59,
-    0x1F, 0x2D, 0x1A, 0x70, 0xA3, 0x40, 0x06, 0xA5, 0x67, 0x4E, 0x40, 0x90, 0x8D, 0x2B, 0x21, 0x84,
-    0x8D, 0x82, 0x61, 0x2D, 0x9C, 0xB8, 0xF5, 0x7F, 0x4E, 0x61, 0x65, 0xB6, 0x4C, 0x20, 0xA2, 0xCE,
-    0x49, 0x07, 0xF8, 0x31, 0x2D, 0x3D, 0xFB, 0xE9, 0x8B, 0xD2, 0x22, 0xB3, 0x0C, 0x89, 0x0E, 0x04,
-    0xBC, 0xCF, 0xD9, 0xFF, 0x3E, 0x06, 0xF3, 0xFD, 0xC7, 0x44, 0x3E, 0xEF, 0x90, 0x58, 0x0F, 0x8C,
-    0x05, 0x0F, 0xA0, 0xAC, 0xD4, 0xC3, 0x4A, 0xCC, 0xA6, 0x80, 0xB1, 0x8D, 0xB9, 0xCC, 0x74, 0xD1,
-    0x32, 0xB7, 0x36, 0x7B, 0x12, 0x7D, 0xAE, 0x3B, 0x15, 0x0C, 0xCD, 0x1E, 0xD3, 0x36, 0xD1, 0xC8,
-    0x41, 0xB2, 0x54, 0xE4, 0x56, 0x94, 0xF3, 0xB8, 0xBF, 0xD9, 0x99, 0x20, 0xAC, 0xF7, 0xD6, 0x3A,
-    0x7E, 0xCE, 0x39, 0x3E, 0x3E, 0xDB, 0x57, 0x76, 0x7E, 0x44, 0xD3, 0x94, 0x35, 0xAE, 0x24, 0x91,
-    0x00, 0x20, 0x28, 0x4F, 0x66, 0xD0, 0x28, 0x71, 0x10, 0xD4, 0x43, 0x0E, 0x17, 0xAF, 0xE2, 0x2F,
-    0x3B, 0x4A, 0x16, 0x55, 0xBD, 0x53, 0xDD, 0x41, 0x36, 0xE8, 0x43, 0xFB, 0x66, 0xD1, 0xC4, 0x53,
-    0xB2, 0x9F, 0xF2, 0xFC, 0xAE, 0x7D, 0x6B, 0x8E, 0x92, 0x49, 0xED, 0x76, 0x66, 0x60, 0x38, 0x19,
-    0x24, 0x29, 0x01, 0xC8, 0xAD, 0xA6, 0x00, 0xFC, 0x36, 0xE9, 0xC4, 0xFF, 0xBB, 0x70, 0x4F, 0xB2,
-    0x1F, 0x33, 0x23, 0x93, 0x7B, 0x2A, 0x89, 0xCC, 0x8B, 0x53, 0xF1, 0x8E, 0xB0, 0x4C, 0xD6, 0x0B,
-    0xC5, 0x7C, 0x62, 0xA7, 0x66, 0xCD, 0x78, 0xBC, 0x86, 0x5A, 0x0E, 0x65, 0x29, 0x9F, 0xD4, 0x13,
-    0xE4, 0xF5, 0xED, 0xE3, 0x7C, 0xD4, 0xBB, 0x36, 0x19, 0x47, 0xE4, 0x76, 0xC4, 0x1B, 0xFE, 0xBF,
-    0xEA, 0xAD, 0x61, 0x9C, 0x44, 0x11, 0x75, 0xB3, 0x61, 0xC8, 0x6B, 0x24, 0x8B, 0xB4, 0xF5, 0xF6,
-    0x3A, 0x99, 0x85, 0x9C, 0x46, 0xC2, 0x88, 0x98, 0x88, 0x9C, 0x51, 0x38, 0x9F, 0xF1, 0x16, 0xA0,
-    0x00, 0x66, 0xAE, 0xF2, 0x92, 0x12, 0x21, 0x16, 0xA4, 0x54, 0xB4, 0xEC, 0x9C, 0x76, 0xF7, 0xFE,
-    0xD1, 0x95, 0x9C, 0x63, 0xD5, 0xCB, 0x59, 0x2E, 0x43, 0xEC, 0xF4, 0x95, 0x38, 0x4F, 0x96, 0x72,
-    0x95, 0x7E, 0x77, 0x98, 0xD2, 0xAC, 0x75, 0x8E, 0xB2, 0x2B, 0x80, 0xDA, 0x9A, 0xBF, 0x00, 0xBA,
-    0x49, 0x04, 0x58, 0x06, 0xE7, 0x25, 0xDE, 0x55, 0xAD, 0xD8, 0xCE, 0xD9, 0x54, 0x68, 0x4F, 0xB8,
-    0x2F, 0x7B, 0xB6, 0x3F, 0xC9, 0x3C, 0xD4, 0x34, 0xC2, 0xA1, 0xE1, 0x90, 0x59, 0x8D, 0xBB, 0x51,
-    0x9C, 0x0D, 0xF0, 0x01, 0xC4, 0x58, 0x54, 0x05, 0x90, 0x03, 0xD8, 0xF6, 0x46, 0xB2, 0xBD, 0x82,
-    0x5C, 0x01, 0xA7, 0xD2, 0x26, 0x64, 0x64, 0x20, 0x93, 0x75, 0x3C, 0xBF, 0x95, 0xC9, 0x83, 0x05,
-    0xDD, 0x03, 0x96, 0x9C, 0x35, 0x90, 0x75, 0xB1, 0x0C, 0xEC, 0xA6, 0x7C, 0x81, 0x47, 0x85, 0x8C,
-    0xC7, 0x7B, 0x65, 0xD0, 0x46, 0xF5, 0x3A, 0x30, 0x2E, 0x9D, 0x99, 0x0C, 0xEB, 0x8F, 0x1E, 0x3F,
-    0xDE, 0x65, 0x66, 0xEA, 0x3D, 0x7B, 0xB7, 0x8D, 0x3A, 0x94, 0x9F, 0x65, 0x8A, 0x6F, 0x87, 0xA8,
-    0x0D, 0x1B, 0x7C, 0x7C, 0x76, 0xC5, 0x8F, 0x51, 0x9B, 0xD5, 0xD9, 0x7B, 0xD6, 0x3B, 0x9C, 0x68,
-    0x47, 0xEC, 0x2E, 0x72, 0x10, 0x9D, 0xF2, 0x8F, 0x78, 0xFA, 0xC3, 0x92, 0x34, 0x68, 0xD2, 0x36,
-    0x44, 0xA3, 0x9D, 0xA8, 0x87, 0x25, 0x44, 0xCA, 0x7B, 0x2B, 0x93, 0x4E, 0x55, 0x03, 0x2C, 0x90,
-    0xF7, 0x78, 0x76, 0x71, 0x13, 0xD0, 0xAF, 0x86, 0xD8, 0x45, 0x3F, 0x0C, 0x92, 0xD1, 0x6D, 0xA6,
-    0x4B, 0xB0, 0x10, 0x77, 0xBE, 0x29, 0x6A, 0x43, 0x47, 0xA2, 0xD9, 0x90, 0x68, 0x1E, 0x43, 0x62,
-    0x78, 0xA7, 0x34, 0xF6, 0x19, 0x73, 0xA9, 0x2A, 0x83, 0x0F, 0xCF, 0x70, 0x43, 0x96, 0x23, 0x59,
-    0xAD, 0x94, 0x86, 0x54, 0xC5, 0x44, 0x8F, 0x67, 0x88, 0x85, 0x06, 0x71, 0x37, 0x7F, 0xDF, 0x29,
-    0x7F, 0x81, 0x39, 0xE8, 0x02, 0x2A, 0x50, 0x8D, 0x9C, 0x4A, 0x94, 0x7F, 0x66, 0xAE, 0xFF, 0x95,
-    0xB1, 0xAF, 0xF8, 0x9F, 0xF5, 0xFE, 0x9D, 0xAD, 0x30, 0xFC, 0xAE, 0x56, 0xE8, 0x59, 0x74, 0xFA,
-    0x2C, 0xBE, 0x0D, 0x42, 0x12, 0xD8, 0x81, 0xFF, 0x60, 0xD5, 0x54, 0x25, 0xA7, 0x5E, 0xEF, 0xD8,
-    0x1A, 0xAA, 0xCC, 0x0B, 0xFB, 0xF6, 0x59, 0x8E, 0x71, 0xE8, 0x6C, 0x94, 0xD1, 0x04, 0x54, 0x48,
-    0x3F, 0xEE, 0xA3, 0xE4, 0xD0, 0xBA, 0x04, 0x08, 0x52, 0x48, 0x1F, 0xC9, 0xB1, 0x2E, 0x5B, 0xA5,
-    0x8D, 0x4B, 0xE2, 0x8A, 0xA7, 0xD7, 0x16, 0x2C, 0x69, 0xA0, 0x83, 0x27, 0x8F, 0xF1, 0xDD, 0x68,
-    0x0D, 0x00, 0x07, 0xA4, 0x45, 0x18, 0x05, 0x2B, 0xE3, 0x5E, 0x08, 0x20, 0x13, 0xE3, 0x50, 0x2A,
-    0x45, 0xC3, 0x37, 0xC6, 0xC2, 0x9E, 0x50, 0x05, 0x1B, 0xB2, 0x5E, 0x9E, 0xB9, 0xC8, 0x54, 0x35,
-    0x23, 0xC8, 0x55, 0xDC, 0x18, 0x82, 0xF1, 0x47, 0xCA, 0x05, 0x8E, 0x15, 0xB3, 0x5C, 0x60, 0x4C,
-    0x47, 0x10, 0x50, 0xBD, 0xBD, 0xAE, 0x07, 0x83, 0x61, 0x2B, 0x14, 0x5D, 0x52, 0x3C, 0x09, 0x1A,
-    0x0A, 0x89, 0x95, 0x11, 0x77, 0x2E, 0x29, 0x25, 0x12, 0x33, 0x48, 0xE2, 0xD8, 0x03, 0x92, 0x4A,
-    0x73, 0x46, 0x17, 0xC6, 0x90, 0x74, 0x36, 0xDF, 0x0B, 0x7A, 0x36, 0xD2, 0x8A, 0x27, 0x83, 0x0B,
-    0x88, 0xA4, 0xD4, 0xC6, 0x79, 0x5F, 0xFE, 0xDD, 0x89, 0xDD, 0x42, 0x2B, 0x82, 0x03, 0x08, 0x8C,
-    0xD2, 0xC1, 0x83, 0x45, 0x49, 0x71, 0xC5, 0xEE, 0x6F, 0xA8, 0x6D, 0x30, 0xBD, 0xD7, 0xF9, 0x6D,
-    0x00, 0x73, 0x8A, 0x96, 0x71, 0x9D, 0xD4, 0x69, 0x0D, 0x0A, 0xAE, 0x90, 0x4B, 0x3C, 0x97, 0xD5,
-    0x10, 0x42, 0xD2, 0xE0, 0x5E, 0x6C, 0x3D, 0x72, 0x9B, 0x2C, 0x07, 0xE7, 0xD8, 0xA4, 0xE2, 0x37,
-    0x88, 0x9B, 0x3D, 0xB5, 0xB5, 0x92, 0x53, 0xE8, 0xB2, 0x9C, 0x02, 0xF5, 0x17, 0x4B, 0x20, 0x38,
-    0xB8, 0xEA, 0x21, 0x79, 0x76, 0x81, 0xAA, 0xC7, 0xEC, 0x36, 0x82, 0x44, 0x74, 0x51, 0x8F, 0xC9,
-    0x5F, 0xC5, 0xAC, 0xCB, 0x35, 0x04, 0x80, 0x6A, 0x04, 0x19, 0xBF, 0xDA, 0x18, 0x96, 0x77, 0xC3,
-    0xEC, 0x50, 0xE5, 0x11, 0x77, 0x0C, 0x5A, 0x17, 0x33, 0x92, 0xE3, 0x86, 0x0D, 0xDD, 0xE2, 0x32,
-    0xAB, 0x43, 0xAA, 0xA1, 0xA7, 0x86, 0x6F, 0xF1, 0x9B, 0x8C, 0xDF, 0xC4, 0x25, 0xF4, 0x8C, 0x3F,
-    0x6E, 0xEB, 0x69, 0x96, 0x9F, 0x20, 0xFE, 0x96, 0x88, 0xA7, 0xB2, 0xD5, 0xE5, 0x61, 0xE6, 0x30,
-    0x85, 0xA0, 0x51, 0x37, 0x07, 0x75, 0x73, 0x75, 0xD6, 0xD9, 0xD4, 0x4A, 0x70, 0x6D, 0xBF, 0xF4,
-    0x26, 0xEE, 0x0D, 0x9B, 0x34, 0x3F, 0x0B, 0x7A, 0x75, 0x6B, 0xC4, 0x43, 0xA0, 0x3E, 0xD9, 0xA3,
-    0x20, 0x6A, 0xD8, 0xAD, 0x21, 0xA1, 0x52, 0xA5, 0xB7, 0x5A, 0x5F, 0x12, 0xBA, 0x9C, 0x51, 0xC0,
-    0x8C, 0x19, 0x9D, 0xE2, 0x1D, 0x40, 0x60, 0x5A, 0xFD, 0x09, 0x5B, 0x49, 0x6C, 0xB8, 0x4C, 0xCD,
-    0x4A, 0x26, 0x23, 0xC4, 0xFC, 0x93, 0xC1, 0x55, 0x20, 0x95, 0xAB, 0x46, 0x70, 0x07, 0x6F, 0x75,
-    0x48, 0x83, 0x1F, 0x4E, 0xDE, 0x23, 0x58, 0x39, 0x05, 0x44, 0x5D, 0x25, 0xEA, 0x23, 0x1C, 0x56,
-    0x78, 0x0C, 0x48, 0xDE, 0xF5, 0xA9, 0x1B, 0x66, 0xE6, 0x46, 0x58, 0x30, 0xE3, 0x75, 0x6E, 0x9E,
-    0x0C, 0x53, 0x9F, 0x62, 0x67, 0x5B, 0x09, 0x76, 0x96, 0x1C, 0xF7, 0xF7, 0xC7, 0x39, 0x2F, 0xAE,
-    0x1B, 0x40, 0xC7, 0x5F, 0x63, 0xC4, 0x42, 0x1E, 0xF9, 0x32, 0x7D, 0x7D, 0x60, 0xD3, 0x0E, 0x78,
-    0xEB, 0x7F, 0x59, 0x74, 0xDD, 0x04, 0x51, 0xE3, 0x48, 0x06, 0xE8, 0xF8, 0x96, 0xFC, 0xB2, 0xFF,
-    0xA8, 0xE6, 0x0C, 0x79, 0x62, 0x66, 0x56, 0xE1, 0x9A, 0xFD, 0x33, 0x1C, 0x70, 0x95, 0x31, 0x02,
-    0x67, 0x2B, 0x18, 0x97, 0x40, 0xDC, 0x6D, 0x47, 0x29, 0xBC, 0x6A, 0xFB, 0x23, 0x5C, 0x2D, 0xF8,
-    0x2D, 0xAC, 0x06, 0xAA, 0xAB, 0x7A, 0x21, 0x5B, 0x72, 0x50, 0xA1, 0xDE, 0x50, 0x4A, 0x6F, 0x4D,
-    0x55, 0xB4, 0x41, 0x8F, 0xC8, 0xFD, 0xEF, 0x76, 0x1B, 0xE9, 0xFA, 0x0B, 0xC7, 0x10, 0x88, 0x24,
-    0xAA, 0x21, 0x37, 0xA0, 0x20, 0x1A, 0x36, 0x15, 0xD1, 0xBB, 0xB7, 0xCC, 0x17, 0xAD, 0x77, 0x7F,
-    0xE9, 0xDF, 0xCB, 0x91, 0xB6, 0x11, 0x89, 0x08, 0x30, 0xD9, 0x52, 0x32, 0x57, 0x8A, 0xF2, 0x3A,
-    0xA3, 0xD2, 0x65, 0x43, 0xDB, 0xA3, 0x5A, 0xAE, 0xAC, 0x9B, 0x7E, 0xB1, 0x0B, 0x45, 0xE9, 0xB1,
-    0x28, 0x6C, 0xF5, 0xBD, 0xB7, 0xF9, 0xBE, 0xC8, 0x55, 0x24, 0x58, 0x96, 0x48, 0xF6, 0x0E, 0xF0,
-    0x0E, 0xF2, 0xC8, 0xAF, 0x04, 0x8C, 0x3D, 0x75, 0xCA, 0xA0, 0x27, 0x04, 0x5A, 0xEF, 0x04, 0x02,
-    0x65, 0x70, 0xD9, 0x84, 0xB5, 0x75, 0x70, 0x39, 0x16, 0xE9, 0xF4, 0x15, 0x29, 0xD8, 0x57, 0xB3,
-    0x37, 0x1E, 0x1D, 0xD8, 0xFF, 0xBA, 0x64, 0x6D, 0x9A, 0x54, 0x37, 0x64, 0x1D, 0x00, 0x1F, 0xD4,
-    0x3B, 0x44, 0x96, 0x2A, 0x6A, 0x99, 0x6B, 0x62, 0xFF, 0xCA, 0xD9, 0x74, 0x6D, 0xC7, 0x41, 0xF7,
-    0x15, 0xEC, 0x4F, 0x05, 0x7D, 0x49, 0xC7, 0xCB, 0x4E, 0x58, 0x3A, 0x40, 0x63, 0xA4, 0xCE, 0x2D,
-    0xFB, 0x1C, 0x04, 0xC6, 0xA5, 0x73, 0xA6, 0x78, 0x6E, 0x4E, 0xD1, 0x47, 0xCA, 0x9F, 0x82, 0x8D,
-    0xC1, 0x14, 0xD8, 0xC6, 0x62, 0xE9, 0x31, 0x68, 0xBD, 0x21, 0x62, 0x2C, 0x13, 0x27, 0x74, 0x49,
-    0xB2, 0x42, 0xA7, 0x03, 0x2F, 0xCB, 0xD4, 0x25, 0xF0, 0xBA, 0x10, 0xC0, 0xA7, 0xD1, 0x50, 0x1C,
-    0x10, 0x70, 0xFC, 0x3A, 0xAC, 0xE4, 0x0D, 0x60, 0xAE, 0xBF, 0x3E, 0x90, 0x87, 0xEC, 0x3B, 0x43,
-    0xD3, 0xD5, 0xDE, 0x79, 0x0E, 0x05, 0x4A, 0x71, 0xD1, 0xA5, 0xB8, 0x3D, 0x7F, 0x68, 0x79, 0x24,
-    0x7B, 0xFE, 0xD9, 0xA2, 0xED, 0x6F, 0x41, 0x1B, 0x32, 0x3F, 0x72, 0x77, 0x41, 0xE8, 0x00, 0x31,
-    0x8D, 0x0E, 0x8D, 0xFC, 0x41, 0xB4, 0xC1, 0x5D, 0x89, 0xF7, 0x5D, 0x84, 0xDF, 0x4F, 0xCB, 0xF4,
-    0xF9, 0x26, 0xFE, 0xA0, 0x0B, 0x3F, 0x1E, 0xFC, 0x6E, 0x31, 0xA9, 0x35, 0x75, 0xAD, 0x46, 0x27,
-    0x61, 0x27, 0xBE, 0xF8, 0x54, 0x55, 0xE0, 0x4F, 0x5E, 0x19, 0x4D, 0xD1, 0x74, 0xCE, 0x35, 0xD5,
-    0x14, 0x27, 0xDC, 0xE5, 0xEC, 0x0D, 0x77, 0x39, 0x4B, 0xDC, 0xE5, 0xAA, 0x70, 0x56, 0xAC, 0x8E,
-    0x2D, 0x7F, 0x3B, 0x0B, 0xF4, 0x26, 0xD7, 0x09, 0xA6, 0xEE, 0x5F, 0x30, 0x6D, 0x17, 0x4E, 0x8A,
-    0x9B, 0x4B, 0x82, 0xB9, 0xFB, 0xBF, 0xBE, 0xDD, 0xAD, 0x1A, 0x4F, 0xBF, 0x33, 0x95, 0x39, 0x1A,
-    0x2B, 0xA8, 0xF2, 0x1E, 0xDC, 0xEF, 0xF8, 0x0B, 0xC1, 0xDB, 0x69, 0x5E, 0xE2, 0x82, 0x0A, 0x2F,
-    0x4F, 0x34, 0xCC, 0x83, 0x86, 0xEF, 0x9F, 0x8E, 0xC9, 0xAA, 0x68, 0xD5, 0x33, 0x70, 0xA1, 0x5E,
-    0x81, 0x4C, 0x2A, 0x74, 0xF1, 0xCF, 0x85, 0x47, 0xEA, 0xCA, 0x85, 0x40, 0xD7, 0x77, 0x0B, 0x1F,
-    0xD8, 0xD2, 0x7B, 0xD9, 0x1E, 0xE5, 0x89, 0xBD, 0x57, 0x33, 0xCE, 0x6D, 0xEE, 0x72, 0x0C, 0x66,
-    0xFD, 0x86, 0xD7, 0x60, 0x39, 0xE1, 0x8B, 0xA9, 0x47, 0xA0, 0xCD, 0x4E, 0x76, 0xD5, 0x20, 0x4D,
-    0x50, 0x79, 0x48, 0xB9, 0x20, 0x83, 0x02, 0xC0, 0x02, 0x7C, 0xB7, 0x48, 0xD4, 0xD9, 0x10, 0x10,
-    0x4C, 0x3F, 0x4B, 0x34, 0xDD, 0xF0, 0xF2, 0x90, 0xE5, 0xFE, 0x58, 0xF1, 0xF2, 0x8B, 0x1F, 0x20,
-    0x47, 0xBD, 0x7F, 0xBF, 0x83, 0xFF, 0x10, 0x6C, 0xF7, 0x88, 0x86, 0xE1, 0x2A, 0x66, 0xF9, 0xF4,
-    0x03, 0x4E, 0x8B, 0x6A, 0x24, 0xAC, 0xA2, 0x4D, 0xFA, 0x19, 0x7E, 0xB1, 0x50, 0xBE, 0xEE, 0x18,
-    0xDC, 0x39, 0xB6, 0xF5, 0xF5, 0x8A, 0xE3, 0x93, 0x3C, 0x46, 0x58, 0xAD, 0x72, 0x6C, 0x17, 0x34,
-    0x48, 0xF3, 0xE5, 0xA1, 0xB9, 0x8D, 0x8F, 0x6D, 0xBC, 0x4C, 0xEA, 0x0A, 0xEE, 0x31, 0x04, 0x7D,
-    0xD2, 0xA8, 0x86, 0x61, 0x1E, 0x5F, 0x11, 0x85, 0xA0, 0xBC, 0x40, 0xE5, 0xD3, 0xC0, 0xAE, 0xB3,
-    0xC1, 0x67, 0x05, 0x8A, 0x34, 0x1C, 0xDA, 0x65, 0xC1, 0xBC, 0xC3, 0xCB, 0x15, 0x2E, 0x57, 0x37,
-    0x7F, 0x85, 0xCB, 0xFF, 0x81, 0xE8, 0x1A, 0xB7, 0x2B, 0x64, 0x69, 0x84, 0x03, 0xF0, 0x10, 0xB3,
-    0x3B, 0xF6, 0x1C, 0xEC, 0xAE, 0x5A, 0x56, 0xB8, 0xDC, 0x22, 0xDC, 0x26, 0xC3, 0xA6, 0x2C, 0x95,
-    0xAE, 0x55, 0x01, 0xCB, 0x2A, 0xD8, 0xB1, 0x70, 0x29, 0x42, 0xFA, 0x3C, 0x81, 0x6E, 0xBC, 0xDF,
-    0xAD, 0xD4, 0x8F, 0xCB, 0x1E, 0xF6, 0xFE, 0x8A, 0xF4, 0xC6, 0x65, 0x66, 0xF6, 0xFD, 0xDE, 0xEF,
-    0xF0, 0xB1, 0xCE, 0xF2, 0xC2, 0x1F, 0x82, 0x21, 0x6E, 0xE3, 0xA6, 0x28, 0x95, 0x43, 0xD7, 0x21,
-    0x7B, 0x74, 0xCB, 0x23, 0x32, 0x70, 0x6D, 0x67, 0x39, 0xE7, 0x0E, 0xCE, 0x43, 0x65, 0xE9, 0x0F,
-    0x9B, 0xD9, 0x70, 0x9D, 0x05, 0xA5, 0xDA, 0x29, 0x3F, 0xB3, 0x56, 0x0B, 0x5B, 0xA7, 0x38, 0x27,
-    0x8E, 0xA4, 0xF7, 0xD8, 0x05, 0x27, 0x44, 0x92, 0xE6, 0x24, 0x0F, 0x14, 0xAA, 0xC4, 0x89, 0x0F,
-    0xDB, 0x95, 0x71, 0xAA, 0x93, 0x40, 0x82, 0x21, 0x23, 0x56, 0x7C, 0x9F, 0x0D, 0x09, 0xEA, 0xCE,
-    0x49, 0x24, 0xED, 0x52, 0x2E, 0xC0, 0x66, 0xC6, 0xAC, 0xBC, 0xB7, 0x80, 0x71, 0xBC, 0xBE, 0x20,
-    0xE7, 0xCD, 0x44, 0x51, 0xB8, 0x34, 0x27, 0xB5, 0xB8, 0xA6, 0xE7, 0x37, 0xDD, 0x84, 0x95, 0xEC,
-    0x3D, 0xE0, 0x9E, 0x0E, 0x7E, 0x9E, 0xE5, 0x08, 0xAA, 0x03, 0x61, 0x4E, 0xC3, 0x3E, 0x64, 0x0E,
-    0x13, 0x5E, 0x79, 0x44, 0x6C, 0xEA, 0x35, 0x67, 0xA5, 0x37, 0xAA, 0x2A, 0x3F, 0xDC, 0x76, 0x6B,
-    0x07, 0x48, 0x66, 0xB7, 0xCC, 0x0E, 0xCC, 0x1F, 0xF2, 0x4A, 0xF6, 0x96, 0xCE, 0x49, 0x9D, 0xA7,
-    0x3C, 0x9C, 0x90, 0xCB, 0x34, 0x91, 0xD3, 0x5F, 0x83, 0xE7, 0x50, 0xB4, 0x9C, 0x89, 0x06, 0xA6,
-    0x5F, 0xA1, 0xF4, 0xDC, 0xBA, 0x86, 0x57, 0x2B, 0x04, 0xF4, 0x6D, 0x58, 0x9B, 0x4C, 0x29, 0x51,
-    0xDF, 0x88, 0xF1, 0x26, 0xB4, 0x07, 0x5F, 0xD9, 0xB0, 0x08, 0xE4, 0xD5, 0x9A, 0x82, 0xB5, 0xA8,
-    0x41, 0xFF, 0xD4, 0x4F, 0x8D, 0xEB, 0x13, 0xA8, 0x93, 0xE6, 0x5D, 0xBB, 0x7A, 0x86, 0xBC, 0x0A,
-    0x0D, 0x8E, 0xB0, 0x7F, 0xC0, 0x7E, 0x05, 0x5C, 0x1F, 0x45, 0xD9, 0xCA, 0xD5, 0xB6, 0xBE, 0x62,
-    0x7E, 0x45, 0x84, 0x9E, 0xD6, 0x19, 0x6B, 0x05, 0xF0, 0x17, 0xF4, 0xC4, 0xE9, 0x2B, 0x5F, 0x69,
-    0xAD, 0xFA, 0xE4, 0x4F, 0xD5, 0xF6, 0x56, 0xC1, 0xA4, 0xE9, 0xA7, 0x9B, 0x96, 0x41, 0x78, 0xD5,
-    0xB8, 0xB1, 0xD5, 0x6B, 0x6F, 0xAB, 0x16, 0x67, 0xDB, 0xE2, 0x24, 0x0D, 0xBB, 0xAE, 0x8D, 0x1E,
-    0x8C, 0x55, 0x09, 0xD9, 0xD7, 0xFC, 0x2F, 0xCD, 0xC1, 0x1A, 0xC4, 0x9D, 0xBD, 0x6A, 0x35, 0x19,
-    0x48, 0x55, 0xC6, 0x23, 0x9B, 0x6C, 0x56, 0xF4, 0x5B, 0xC6, 0xB9, 0x8A, 0x02, 0x53, 0xBB, 0xC3,
-    0xB3, 0x67, 0x18, 0x47, 0xB2, 0x32, 0x6E, 0x02, 0x61, 0x14, 0xA0, 0x41, 0x28, 0x50, 0x7E, 0xAE,
-    0x4A, 0x1E, 0x4C, 0xB1, 0x8A, 0xA9, 0x55, 0x54, 0xA9, 0x04, 0x22, 0x7C, 0x1E, 0x89, 0x78, 0xAB,
-    0x1C, 0x97, 0x8B, 0x3A, 0x3D, 0xDA, 0xB1, 0x0D, 0x99, 0x6A, 0x7D, 0x3B, 0x35, 0x40, 0x34, 0xF8,
-    0x60, 0x25, 0x77, 0x7C, 0xB3, 0xA8, 0xDE, 0x9F, 0xBA, 0x0C, 0xDD, 0xD4, 0x38, 0xFB, 0x1A, 0xDC,
-    0x25, 0x35, 0x7B, 0x7C, 0x03, 0x21, 0x4C, 0xBA, 0x44, 0x5E, 0x42, 0x61, 0x76, 0xF1, 0xB8, 0xCF,
-    0xBB, 0x24, 0x26, 0xB6, 0x62, 0x2B, 0xE6, 0x4A, 0x57, 0x2B, 0x41, 0x41, 0x62, 0x0C, 0xB9, 0x99,
-    0xE5, 0x87, 0x0A, 0x31, 0x42, 0x9C, 0x5A, 0xAC, 0x99, 0x64, 0x49, 0xEC, 0x2F, 0xDE, 0x7C, 0x7B,
-    0xF0, 0xE2, 0x68, 0xC4, 0x9C, 0x8A, 0xFE, 0xDC, 0x71, 0x67, 0x1C, 0xAA, 0xD8, 0x66, 0x2F, 0x45,
-    0x69, 0x25, 0x6A, 0x48, 0xCC, 0x09, 0x5A, 0xBC, 0x4A, 0x37, 0xD7, 0xE2, 0x8E, 0x06, 0xC2, 0x3C,
-    0x05, 0x8F, 0x5E, 0xAA, 0x86, 0x81, 0x3B, 0x8C, 0x21, 0xA3, 0x88, 0xEB, 0xBC, 0x1A, 0xF1, 0x68,
-    0xA2, 0xA3, 0x63, 0x0A, 0x1A, 0x6F, 0x42, 0x00, 0x94, 0xAF, 0x9B, 0x2C, 0xA9, 0x01, 0xDC, 0x44,
-    0x9A, 0x6D, 0x52, 0x4F, 0x84, 0xB4, 0x81, 0x43, 0x1B, 0xA1, 0xAB, 0xAD, 0x23, 0xB6, 0x7A, 0x5A,
-    0x89, 0x9B, 0x81, 0x0E, 0xBF, 0xC0, 0x16, 0x3B, 0x9C, 0xF0, 0xD3, 0x8C, 0x13, 0xD7, 0x4E, 0x03,
-    0x4B, 0x32, 0xF5, 0xF9, 0x2F, 0xF4, 0x0B, 0x1B, 0xC4, 0xEE, 0x57, 0xE8, 0x7E, 0xB1, 0x3F, 0x69,
-    0xC7, 0x2D, 0x0D, 0x9D, 0x3B, 0xC2, 0xB2, 0xBF, 0xB3, 0x1D, 0xD8, 0x18, 0x23, 0xE6, 0x99, 0x6B,
-    0xB7, 0x63, 0x36, 0x70, 0xEE, 0x74, 0x00, 0xF2, 0xAB, 0xCC, 0x64, 0x6F, 0x82, 0x00, 0x46, 0x41,
-    0x08, 0xE9, 0xC1, 0x4D, 0x51, 0xDB, 0xC6, 0xF6, 0x2E, 0x78, 0x4A, 0x9B, 0x5D, 0x29, 0x8D, 0x45,
-    0xFC, 0xE5, 0x29, 0x44, 0x27, 0x73, 0x3E, 0x9F, 0x25, 0x08, 0xE9, 0xCA, 0x3A, 0x3E, 0xDD, 0xCB,
-    0x51, 0xC1, 0x36, 0xAC, 0x65, 0x91, 0xDA, 0x6F, 0x23, 0xD3, 0x67, 0x26, 0xFE, 0x75, 0x55, 0x86,
-    0x6E, 0x7A, 0x50, 0xAA, 0xCF, 0x55, 0x2C, 0xD9, 0x4C, 0xCA, 0xCA, 0xB8, 0x8B, 0x9B, 0x70, 0x88,
-    0x06, 0xDF, 0x02, 0xA5, 0xDA, 0xD2, 0xD6, 0x17, 0x0F, 0x5E, 0xBA, 0xA1, 0x14, 0x8A, 0xF4, 0x1D,
-    0x68, 0x3E, 0x8E, 0xC8, 0x9B, 0xC1, 0x35, 0x2D, 0x07, 0xB5, 0x36, 0x47, 0xC4, 0x64, 0x57, 0xA0,
-    0xA5, 0xD2, 0xE3, 0x56, 0xA7, 0x1B, 0x1A, 0xD7, 0xEE, 0x33, 0xF3, 0x91, 0x10, 0xF6, 0xFD, 0x08,
-    0xF7, 0x8F, 0x35, 0xDB, 0x56, 0x27, 0x7C, 0xE6, 0x9B, 0x25, 0xD7, 0xE5, 0x51, 0x16, 0x50, 0x0D,
-    0xB7, 0x8D, 0xA4, 0xC7, 0xCD, 0x9E, 0xC1, 0xC3, 0xD6, 0xB3, 0x6C, 0x4B, 0x31, 0xF3, 0x4D, 0x3D,
-    0x81, 0x76, 0xAB, 0x07, 0x90, 0x35, 0x53, 0xB9, 0x3A, 0xB0, 0x8A, 0x18, 0x0E, 0x35, 0xE1, 0xDE,
-    0xCE, 0x3E, 0xC7, 0x2B, 0x5B, 0x5E, 0x53, 0xEB, 0xF7, 0xE8, 0x05, 0xD8, 0x7A, 0x0D, 0x2D, 0x64,
-    0x40, 0xF2, 0x1E, 0xC3, 0x3C, 0xBB, 0x06, 0x26, 0xFB, 0xF1, 0x74, 0x16, 0x20, 0xA2, 0xFE, 0x19,
-    0x8C, 0x10, 0x92, 0x71, 0xAD, 0xE7, 0x34, 0x74, 0x89, 0x14, 0x64, 0x11, 0x8B, 0xA3, 0x01, 0xC5,
-    0x51, 0xD6, 0xC0, 0x98, 0x16, 0xCF, 0x2E, 0x4A, 0xB7, 0xF5, 0xAA, 0xC0, 0x9D, 0x6E, 0xCE, 0x14,
-    0x6C, 0xB6, 0x8D, 0xEF, 0x71, 0x08, 0x02, 0x0B, 0x17, 0x6A, 0x62, 0x90, 0x64, 0x73, 0x86, 0xE0,
-    0xB9, 0x72, 0x55, 0x31, 0xEB, 0x6B, 0x08, 0xCA, 0x5F, 0x6D, 0xD5, 0xB4, 0xDD, 0x34, 0x18, 0x62,
-    0xCB, 0xCF, 0xDB, 0xAE, 0x17, 0xBC, 0xEA, 0x88, 0x71, 0x6A, 0xA9, 0x2E, 0x5A, 0xBC, 0xF2, 0xD4,
-    0xD4, 0x12, 0xDC, 0x15, 0x04, 0x4E, 0x47, 0xD5, 0x95, 0xA5, 0x0B, 0xE7, 0xE7, 0xD8, 0xFC, 0xD6,
-    0xAC, 0x01, 0xFB, 0x7C, 0x02, 0x01, 0x67, 0x0F, 0x2A, 0xCE, 0x93, 0x46, 0x5A, 0x67, 0xE9, 0xB9,
-    0xD0, 0xCB, 0x4A, 0xEE, 0x15, 0x35, 0x1B, 0x99, 0xE0, 0x6E, 0xB9, 0x8C, 0xCA, 0x19, 0xC6, 0x00,
-    0x08, 0x96, 0x13, 0x89, 0x21, 0xA3, 0x92, 0x2F, 0x3A, 0x32, 0xF2, 0xC8, 0xA7, 0x55, 0x8D, 0x40,
-    0xC7, 0x66, 0xEA, 0xDE, 0xD1, 0x76, 0xA9, 0x3E, 0x75, 0x4B, 0xCD, 0x34, 0xD8, 0xC8, 0xBC, 0x53,
-    0xDD, 0x52, 0xB3, 0xCB, 0x90, 0x41, 0xE2, 0x03, 0x61, 0x7F, 0x50, 0xEF, 0x9A, 0x0B, 0x69, 0xBD,
-    0x7E, 0x23, 0x49, 0x09, 0x83, 0x8C, 0x18, 0x30, 0x7B, 0x76, 0x9E, 0x96, 0x30, 0x6E, 0x91, 0x85,
-    0xC0, 0xBE, 0xA3, 0x5E, 0x31, 0x23, 0x22, 0xEE, 0x9B, 0x98, 0x78, 0x77, 0x1A, 0x28, 0xA5, 0xBD,
-    0x3B, 0xEA, 0x93, 0x94, 0xB7, 0xB7, 0xE3, 0xC7, 0x34, 0xD1, 0xCF, 0xBF, 0xE3, 0x46, 0x30, 0xDA,
-    0x84, 0x72, 0xDB, 0x6B, 0x44, 0x77, 0xFC, 0x4F, 0x6A, 0x68, 0xE6, 0x9A, 0x18, 0xAC, 0xB9, 0x12,
-    0xB9, 0xCC, 0xAA, 0xA2, 0xD6, 0x2E, 0xBF, 0x23, 0x62, 0x9D, 0x98, 0x29, 0x6F, 0x4E, 0xFA, 0x13,
-    0x17, 0x0F, 0xDB, 0x89, 0xD2, 0xC4, 0xCD, 0xF1, 0xFE, 0x24, 0x0F, 0x07, 0xD1, 0xC9, 0x3C, 0x27,
-    0x32, 0xF7, 0x78, 0xF3, 0xBB, 0x13, 0x48, 0xF1, 0x5E, 0x9C, 0x30, 0x63, 0xB0, 0x16, 0x51, 0xC1,
-    0xB6, 0x68, 0x1D, 0x2E, 0x9F, 0xA0, 0x2A, 0x38, 0x55, 0x23, 0x79, 0xCC, 0x0A, 0x69, 0x7D, 0xE9,
-    0x85, 0x01, 0x81, 0xF1, 0x39, 0xF5, 0x8D, 0x0F, 0xCC, 0x33, 0x0E, 0xEB, 0xDF, 0xD3, 0x81, 0x9C,
-    0xCD, 0xF3, 0x71, 0x79, 0x89, 0x86, 0xB2, 0x2F, 0x11, 0xAE, 0xB1, 0xE0, 0x75, 0x37, 0xA6, 0x3E,
-    0xAD, 0x03, 0xA1, 0x1E, 0x5A, 0x90, 0xC9, 0xBA, 0x27, 0x26, 0x25, 0x44, 0x6B, 0x25, 0x1A, 0xDA,
-    0x98, 0x63, 0xCD, 0x75, 0x68, 0xCE, 0xD9, 0xB5, 0x6E, 0xA9, 0x86, 0xEF, 0xB3, 0x7F, 0x40, 0x53,
-    0x72, 0xF9, 0x20, 0x75, 0x23, 0xAE, 0x4D, 0x3A, 0xE0, 0x9C, 0xCF, 0x5B, 0xB1, 0xE1, 0x79, 0xE6,
-    0x9C, 0x2F, 0xD4, 0xF4, 0x70, 0x20, 0x79, 0xB9, 0xD3, 0x07, 0x21, 0x9B, 0xA7, 0xFC, 0xCC, 0x5C,
-    0xC1, 0xA3, 0x06, 0x30, 0xB2, 0x69, 0x82, 0x01, 0x46, 0xD6, 0x1A, 0xB9, 0xB8, 0x58, 0x2C, 0x9E,
-    0xB7, 0x2A, 0xD2, 0xED, 0x6F, 0x95, 0x06, 0x08, 0xBF, 0x08, 0xFF, 0x44, 0xB7, 0x9D, 0x76, 0x4B,
-    0xA6, 0x51, 0x01, 0x9D, 0x4B, 0xEE, 0x41, 0x30, 0xCD, 0x92, 0x9A, 0x6D, 0x0F, 0x22, 0x74, 0x49,
-    0xE7, 0x99, 0xA9, 0x23, 0xC6, 0x25, 0x76, 0x5E, 0x99, 0xBE, 0x5C, 0xC7, 0x9C, 0xBF, 0xDB, 0xAA,
-    0x3D, 0x2B, 0x16, 0xAB, 0xED, 0x85, 0xF1, 0x6D, 0x21, 0x9C, 0xED, 0x72, 0x94, 0xD5, 0x3D, 0x13,
-    0x07, 0xBC, 0xA5, 0xF1, 0x97, 0xEA, 0x2A, 0xBD, 0x5C, 0x53, 0xB5, 0x9A, 0xC8, 0x53, 0x29, 0x02,
-    0xC3, 0xE9, 0x38, 0x2D, 0x7F, 0xFD, 0x38, 0x14, 0xFE, 0x46, 0xF9, 0xC1, 0xEB, 0x7B, 0x53, 0xD4,
-    0x70, 0x15, 0xFD, 0x2E, 0x28, 0xDC, 0x47, 0x52, 0x9F, 0xEA, 0xFB, 0x94, 0x81, 0x18, 0x3F, 0x2F,
-    0x3F, 0xB8, 0x71, 0x66, 0x7D, 0xCF, 0x92, 0x32, 0x1B, 0x37, 0x3F, 0x5F, 0x4E, 0xDC, 0x53, 0xD5,
-    0xAF, 0x35, 0x91, 0x15, 0x6A, 0xFC, 0x52, 0xE2, 0x1E, 0x25, 0xD3, 0x8C, 0x6B, 0xFC, 0xD0, 0xDA,
-    0xF7, 0x5E, 0xF8, 0xE2, 0xEA, 0x49, 0x99, 0xAA, 0x04, 0xFD, 0x09, 0x77, 0xFB, 0x7B, 0x4A, 0x8F,
-    0x02, 0xB9, 0x94, 0xE6, 0x8F, 0x41, 0xF5, 0x28, 0x98, 0x2A, 0x1E, 0x5C, 0xC9, 0x1A, 0x4F, 0xA7,
-    0x6E, 0xAA, 0x1A, 0x99, 0x24, 0x5D, 0xFA, 0x1A, 0x6E, 0x08, 0x2C, 0x64, 0x35, 0x7B, 0xBE, 0x2D,
-    0xC8, 0x8C, 0x3A, 0x9D, 0x5E, 0xD9, 0x34, 0x75, 0x4B, 0xDC, 0x56, 0x6C, 0x4E, 0x00, 0x6A, 0x0A,
-    0x3C, 0xB8, 0x93, 0x12, 0x90, 0x5E, 0xBF, 0x01, 0x95, 0x37, 0x4C, 0xF2, 0x71, 0x6D, 0xEE, 0xFF,
-    0xA7, 0x09, 0x3E, 0xC0, 0x4D, 0xDB, 0x69, 0x1C, 0xF9, 0x26, 0x6C, 0x52, 0xF0, 0x78, 0xCB, 0x0C,
-    0x41, 0x1B, 0xB6, 0x71, 0x99, 0x96, 0xD7, 0xCD, 0xE8, 0x77, 0x21, 0xA7, 0x1D, 0x75, 0xF6, 0x19,
-    0xF3, 0x70, 0x8F, 0xF0, 0xBB, 0xF4, 0x6D, 0xB5, 0x8E, 0xE9, 0xEF, 0xB8, 0x6E, 0xA0, 0xCE, 0x43,
-    0xBD, 0xF5, 0x47, 0xE6, 0x6E, 0x67, 0x31, 0x08, 0x6B, 0x16, 0xF6, 0x54, 0xA3, 0x93, 0xBC, 0x45,
-    0x75, 0xB4, 0x8C, 0x04, 0x50, 0x93, 0x9A, 0xCC, 0x25, 0x79, 0x56, 0xA6, 0x39, 0x80, 0x1F, 0x07,
-    0xBE, 0x9F, 0xCD, 0x50, 0x15, 0xF5, 0xCC, 0xB8, 0x7E, 0xDC, 0xEB, 0xD8, 0x6E, 0x29, 0xC8, 0x9E,
-    0xC0, 0x9D, 0xA9, 0x0E, 0xFE, 0x78, 0xEC, 0x7D, 0x09, 0x12, 0xFF, 0x0A, 0x2C, 0xAA, 0xE0, 0x4E,
-    0x55, 0x0D, 0x3E, 0xB3, 0x6E, 0x16, 0x1D, 0x3E, 0xAE, 0xF4, 0xC4, 0x2D, 0x29, 0x19, 0x02, 0xBF,
-    0x05, 0xF9, 0xE5, 0xEC, 0x4F, 0xA0, 0x9B, 0xE3, 0x43, 0x40, 0x1C, 0xAB, 0x49, 0x5C, 0xE9, 0x98,
-    0x17, 0x90, 0xB5, 0x0C, 0xF5, 0x19, 0xE7, 0x8C, 0x08, 0xD5, 0x55, 0x99, 0x08, 0x8F, 0x0F, 0xEE,
-    0x94, 0x82, 0x0E, 0xE5, 0x12, 0x93, 0x1B, 0x07, 0x58, 0xE6, 0xD7, 0xD3, 0x6E, 0xE6, 0x75, 0x37,
-    0x97, 0x27, 0x9E, 0x04, 0x70, 0xD7, 0xCD, 0x3E, 0xF9, 0x84, 0x99, 0x92, 0xCD, 0xDE, 0xEF, 0xC1,
-    0xE5, 0x6B, 0xB0, 0x52, 0x30, 0x19, 0x8C, 0x45, 0x9B, 0x09, 0x23, 0x2C, 0x1D, 0x8B, 0xE7, 0x4B,
-    0xCE, 0xC5, 0x0F, 0x99, 0xF5, 0x54, 0xEF, 0x81, 0x9C, 0xF4, 0x51, 0xC7, 0x28, 0xDC, 0x0C, 0xD0,
-    0x31, 0x17, 0x8A, 0x1B, 0x71, 0x47, 0x8D, 0x69, 0x1A, 0x85, 0x2F, 0xC4, 0x8F, 0xE3, 0x0F, 0x8B,
-    0xA5, 0xF3, 0x17, 0x1A, 0x9E, 0x3A, 0x0E, 0xA3, 0x9E, 0x8F, 0x88, 0x45, 0x63, 0x27, 0xBC, 0xA0,
-    0x13, 0x01, 0xAE, 0x7F, 0xBE, 0xC5, 0xE4, 0xF9, 0xD2, 0xBF, 0xC1, 0xE9, 0x6B, 0x99, 0x34, 0xC1,
-    0x00, 0xDB, 0xC8, 0xEA, 0x13, 0xAD, 0xAA, 0x4E, 0x13, 0x13, 0xC4, 0xBA, 0x94, 0xDD, 0xB0, 0x81,
-    0x1D, 0x8F, 0x06, 0xF8, 0x91, 0x3A, 0x35, 0xB7, 0xF1, 0xA4, 0xCF, 0xB2, 0x2E, 0x3E, 0xD2, 0x69,
-    0x15, 0x81, 0x7E, 0x4E, 0x0B, 0xEF, 0xD5, 0x33, 0x23, 0xB0, 0x42, 0x5B, 0x8A, 0x0F, 0x4E, 0x36,
-    0x5B, 0xC7, 0x86, 0x3B, 0x1A, 0x47, 0xA2, 0x43, 0x6A, 0xD0, 0x31, 0x21, 0xA5, 0x89, 0x87, 0x64,
-    0x09, 0x42, 0xC4, 0xC2, 0xFA, 0xA8, 0xF4, 0xD2, 0x1D, 0x57, 0x74, 0x0C, 0x54, 0x72, 0x02, 0x8D,
-    0x24, 0x34, 0xD1, 0x75, 0x16, 0x53, 0xCC, 0x58, 0x8C, 0x26, 0x78, 0xCB, 0xB0, 0xB6, 0xA8, 0x41,
-    0x2E, 0x0C, 0xF0, 0xD5, 0x2E, 0xE8, 0x53, 0x53, 0x3C, 0xD7, 0xC5, 0x50, 0x8B, 0x0D, 0x04, 0x29,
-    0x56, 0x0C, 0xA0, 0x04, 0xC2, 0xEC, 0x4D, 0x5C, 0xC9, 0x15, 0x64, 0xA3, 0x63, 0xBC, 0x3B, 0x04,
-    0xEA, 0x40, 0xA5, 0xE7, 0x22, 0xE9, 0xAA, 0x98, 0x41, 0xF2, 0xB1, 0xD7, 0x45, 0xBA, 0xE3, 0x42,
-    0x7D, 0xC7, 0xEA, 0xF5, 0x95, 0x52, 0x3C, 0x7B, 0x92, 0x00, 0xEC, 0xCA, 0x3B, 0x71, 0x17, 0xB4,
-    0x51, 0x1F, 0xAC, 0x50, 0xFB, 0x02, 0x83, 0xFB, 0xF6, 0x07, 0x90, 0xF2, 0x7B, 0xB6, 0x01, 0xBF,
-    0xFF, 0x63, 0x07, 0x00, 0xFD, 0xC1, 0xDA, 0x4C, 0x07, 0xC8, 0x74, 0x52, 0xF1, 0xDF, 0x34, 0x86,
-    0xF8, 0x18, 0x62, 0x8C, 0x6C, 0x5B, 0x71, 0xBE, 0xD7, 0xA6, 0xAC, 0x96, 0x7B, 0x9E, 0x3E, 0x4A,
-    0x07, 0xCF, 0xAE, 0xA3, 0xF7, 0x2B, 0x13, 0x1A, 0x12, 0x56, 0x2F, 0xF6, 0xD8, 0x0B, 0xCE, 0x4E,
-    0xF8, 0x09, 0x5B, 0xFB, 0x3C, 0x02, 0xFD, 0x46, 0xFB, 0x64, 0xD0, 0x16, 0x61, 0x33, 0x86, 0xAD,
-    0x4D, 0xEA, 0x22, 0xBB, 0xDF, 0xB3, 0x48, 0xA3, 0xCD, 0x37, 0x3A, 0x47, 0x55, 0x3C, 0xB4, 0x79,
-    0x38, 0x02, 0x8B, 0x17, 0xEF, 0x43, 0xA3, 0x37, 0x2E, 0x4C, 0x2E, 0x9D, 0xE4, 0xEE, 0x28, 0x03,
-    0x5B, 0x17, 0xAB, 0x43, 0xB3, 0x3D, 0x40, 0x5F, 0x1F, 0x63, 0x43, 0xCE, 0xE6, 0xCC, 0x3B, 0x2B,
-    0x39, 0x76, 0x4E, 0x96, 0x59, 0x5D, 0x94, 0xE9, 0x12, 0xAA, 0xFE, 0x18, 0xDE, 0xF5, 0xB0, 0xD3,
-    0xD9, 0x18, 0xF6, 0x73, 0x39, 0x83, 0x62, 0x1B, 0x86, 0xC5, 0x10, 0x93, 0x1A, 0xA5, 0x45, 0xB7,
-    0xA2, 0xDF, 0x67, 0x6B, 0x79, 0xA6, 0x13, 0x4B, 0xEC, 0xAC, 0x44, 0x9F, 0x75, 0x26, 0x6C, 0x92,
-    0xD3, 0xE7, 0xCD, 0x62, 0x14, 0xDA, 0x01, 0xCD, 0xB2, 0x32, 0x2C, 0xBF, 0x41, 0x57, 0x07, 0x1E,
-    0x47, 0xA4, 0xB5, 0xEC, 0xA3, 0x5A, 0xD5, 0x89, 0xC6, 0x44, 0x5C, 0x95, 0xED, 0x3F, 0x25, 0xDB,
-    0xD1, 0x25, 0xDC, 0xBF, 0xB4, 0x3C, 0xD3, 0x53, 0x6A, 0x84, 0xE4, 0xAC, 0x26, 0x5E, 0x62, 0x8D,
-    0x3B, 0xB0, 0xCF, 0xF7, 0xF1, 0xF3, 0x41, 0x6F, 0x5E, 0xFA, 0x87, 0x33, 0xF3, 0xC7, 0x37, 0xC8,
-    0x66, 0x54, 0xAE, 0x9B, 0xC3, 0x97, 0xCD, 0x6C, 0xC7, 0xE6, 0xEA, 0x06, 0xDC, 0x4D, 0x87, 0xBE,
-    0x54, 0xD3, 0xBB, 0x96, 0x81, 0x06, 0x79, 0x1A, 0xCE, 0x59, 0xDD, 0x21, 0xF0, 0xCC, 0x2F, 0x2B,
-    0xC1, 0xE5, 0x51, 0x57, 0x78, 0xD2, 0x9A, 0x66, 0xEA, 0x2B, 0x56, 0x57, 0x76, 0x71, 0xC3, 0x1D,
-    0x34, 0x08, 0xEC, 0x14, 0xD1, 0x75, 0xD0, 0x5A, 0x8F, 0x71, 0x37, 0x52, 0x10, 0x4C, 0x08, 0x26,
-    0x3D, 0xD1, 0xCF, 0xB1, 0x2E, 0x83, 0x5D, 0xB8, 0xD9, 0x3B, 0xFD, 0x93, 0xA9, 0x61, 0x3D, 0x59,
-    0x0F, 0x57, 0x6E, 0xEA, 0x96, 0xBA, 0x33, 0xB6, 0x9A, 0x55, 0x2E, 0x4F, 0x8C, 0x31, 0x15, 0xD8,
-    0x5F, 0x2A, 0xBF, 0x4D, 0x9E, 0xDE, 0xDE, 0x9A, 0x98, 0xF4, 0x9B, 0x31, 0xC0, 0x57, 0xE5, 0xE9,
-    0x7C, 0x7E, 0x81, 0x69, 0x28, 0xD2, 0x31, 0xEC, 0x76, 0x3D, 0x08, 0xD6, 0xB0, 0xC0, 0x3F, 0x6E,
-    0x94, 0xDF, 0x02, 0x7B, 0x5E, 0xC7, 0x29, 0xCF, 0xD1, 0x6A, 0x1A, 0x92, 0xA8, 0x6E, 0x39, 0xED,
-    0x8C, 0xAE, 0x12, 0x72, 0x07, 0x57, 0x6B, 0x73, 0xEE, 0x9D, 0x71, 0x3A, 0x8A, 0xE4, 0xFE, 0x51,
-    0x43, 0x3D, 0x75, 0xD7, 0xC9, 0x5D, 0xA2, 0x83, 0xE2, 0x2A, 0xD1, 0xDD, 0x39, 0x43, 0xC6, 0xCD,
-    0x23, 0x16, 0x4D, 0x9C, 0x9F, 0xE6, 0xF4, 0x17, 0x9D, 0xAE, 0xF4, 0xF5, 0xCF, 0x06, 0x42, 0xD7,
-    0xEE, 0x10, 0x2A, 0x67, 0x47, 0x5B, 0xC7, 0x1F, 0x70, 0xD7, 0xEF, 0x01, 0x95, 0x53, 0xBF, 0x6F,
-    0x15, 0x39, 0x10, 0x1E, 0xEF, 0x92, 0x67, 0xC2, 0x16, 0x4E, 0x91, 0x48, 0x08, 0x04, 0xA6, 0xB8,
-    0x0A, 0x21, 0xB6, 0xB9, 0x22, 0x05, 0x89, 0x17, 0x51, 0xA4, 0x78, 0x05, 0x29, 0x78, 0xBA, 0x92,
-    0xE6, 0x0A, 0x94, 0xE2, 0x48, 0x41, 0x49, 0x78, 0xFB, 0x00, 0x89, 0x92, 0xF7, 0x27, 0x5C, 0x99,
-    0x1C, 0x05, 0x20, 0x51, 0x44, 0x22, 0xC9, 0x9A, 0xF7, 0x0A, 0x0A, 0x0A, 0x36, 0xA4, 0xBC, 0xE2,
-    0x1C, 0x52, 0x44, 0xBA, 0x2B, 0x30, 0x62, 0x75, 0x5A, 0x5D, 0x6C, 0xCF, 0x8D, 0xF3, 0xA3, 0x80,
-    0xBB, 0x86, 0x91, 0xBC, 0xBB, 0x1E, 0xCF, 0x37, 0xFB, 0xCD, 0x37, 0x63, 0x55, 0x88, 0x9A, 0x37,
-    0x6C, 0x8D, 0x59, 0x51, 0x6C, 0x64, 0x7A, 0x06, 0xC0, 0x02, 0x73, 0x90, 0x62, 0x21, 0xFE, 0x32,
-    0xF9, 0x75, 0x07, 0x64, 0x9D, 0x1B, 0xBB, 0x7B, 0xFE, 0xE5, 0x17, 0x77, 0xEF, 0xCE, 0xE1, 0xAE,
-    0xF2, 0x12, 0x83, 0x0A, 0x6B, 0x00, 0x33, 0x8B, 0x0A, 0x71, 0x0F, 0x11, 0x1F, 0xC3, 0xA1, 0x6D,
-    0xF0, 0x8F, 0x88, 0x0B, 0xD8, 0xF2, 0x50, 0xD0, 0x4E, 0x6C, 0x7B, 0x35, 0x76, 0x4B, 0xA5, 0x78,
-    0xF2, 0xB1, 0xDD, 0x54, 0x37, 0x7F, 0xFF, 0xDB, 0x4D, 0x0B, 0xBD, 0xBC, 0xFE, 0x23, 0x40, 0xF6,
-    0x28, 0xCC, 0xEF, 0xB9, 0xBC, 0xA0, 0x1F, 0xA9, 0xEB, 0x1E, 0xD4, 0x20, 0xAE, 0x35, 0xB8, 0x1C,
-    0x51, 0x8A, 0xB5, 0xE2, 0x8F, 0x9A, 0x63, 0x91, 0xB8, 0xC8, 0x45, 0x15, 0x99, 0x81, 0x00, 0x4A,
-    0xF3, 0x16, 0x10, 0xCE, 0x0D, 0x93, 0x55, 0x20, 0x72, 0x20, 0x2D, 0x60, 0xC1, 0x09, 0x5E, 0x93,
-    0x37, 0xA3, 0x23, 0x2D, 0x1A, 0x86, 0xB4, 0x3D, 0x0C, 0xCB, 0x0D, 0x25, 0xEA, 0x9B, 0xCC, 0x1D,
-    0x7E, 0xA7, 0x0E, 0x2A, 0x3A, 0x06, 0x48, 0xCA, 0xFB, 0xD5, 0xD3, 0x46, 0x32, 0xF3, 0x73, 0xA6,
-    0xFB, 0x63, 0x7F, 0x95, 0x99, 0xFE, 0x5A, 0x17, 0xDD, 0xD2, 0x73, 0x0D, 0x0E, 0x64, 0xC9, 0x1A,
-    0x60, 0x66, 0x7D, 0xAE, 0x52, 0x1D, 0x00, 0xB6, 0xDB, 0x34, 0x79, 0x5A, 0xC2, 0x24, 0xB3, 0x28,
-    0xFC, 0xF9, 0x1A, 0xEE, 0xF1, 0x90, 0xDB, 0x7F, 0xB2, 0x02, 0x26, 0x92, 0x6E, 0xBB, 0x3C, 0x1D,
-    0xAB, 0x3D, 0x53, 0xB9, 0x1C, 0x5D, 0x3F, 0xAC, 0x76, 0x86, 0x41, 0xEE, 0x78, 0xA5, 0xB3, 0x91,
-    0x55, 0x62, 0xE4, 0x2A, 0xF1, 0xC5, 0x9D, 0x54, 0x18, 0x65, 0x20, 0x16, 0x85, 0xB4, 0xA9, 0x87,
-    0xAA, 0x14, 0x36, 0x0D, 0x44, 0xE3, 0x22, 0x78, 0xBE, 0x41, 0x99, 0x1F, 0x11, 0x29, 0xC8, 0xB4,
-    0x17, 0xBA, 0x6F, 0xB0, 0xDC, 0xA4, 0xCA, 0xAC, 0xD4, 0x5B, 0x69, 0x23, 0x75, 0x95, 0x36, 0x90,
-    0xE3, 0x0E, 0x3A, 0xF5, 0xFC, 0xED, 0x6E, 0xBB, 0x99, 0x17, 0x0A, 0xE4, 0xC0, 0xCB, 0x3A, 0x43,
-    0xF2, 0x93, 0x30, 0x21, 0xE2, 0x00, 0x5E, 0x91, 0x5E, 0x05, 0xA8, 0x18, 0x5B, 0xCA, 0x0F, 0x4E,
-    0x68, 0x51, 0x67, 0xA3, 0x9D, 0x30, 0xF7, 0xE0, 0xE0, 0xDD, 0xD3, 0x76, 0x7D, 0xFE, 0xA8, 0x2B,
-    0x7D, 0x1C, 0x23, 0x4E, 0x2C, 0x42, 0xE7, 0x59, 0x53, 0xE1, 0x3E, 0x22, 0x91, 0xE2, 0xC6, 0xAA,
-    0xF1, 0xE8, 0x20, 0x88, 0x9B, 0x76, 0x4E, 0x46, 0x92, 0x33, 0xBD, 0x9E, 0xA2, 0xA6, 0xA2, 0x87,
-    0x8B, 0xDC, 0xDC, 0x17, 0xDD, 0x6D, 0x3B, 0x75, 0xE7, 0xCC, 0xC3, 0x56, 0x2D, 0xD8, 0x2D, 0x41,
-    0x24, 0xD0, 0x56, 0x58, 0x53, 0x98, 0xC4, 0x0F, 0xE8, 0xE6, 0x6F, 0x8F, 0xEB, 0x76, 0xE5, 0x76,
-    0x17, 0x2D, 0x22, 0x24, 0x9F, 0x0A, 0x74, 0x17, 0x5E, 0x8F, 0xDE, 0xCF, 0xCE, 0xEE, 0x53, 0xC0,
-    0xE4, 0x0F, 0xB2, 0xBC, 0x96, 0xDA, 0x59, 0xF3, 0xD5, 0xD0, 0xA4, 0x83, 0xE6, 0x81, 0x9A, 0x8C,
-    0x78, 0x92, 0xA3, 0x00, 0x51, 0x46, 0xF2, 0x6C, 0x11, 0xFE, 0xC7, 0xF2, 0x6E, 0x2D, 0xC6, 0x96,
-    0x7F, 0x76, 0xA9, 0x43, 0x10, 0x68, 0x15, 0x0E, 0x82, 0x17, 0x51, 0x58, 0x0D, 0x4B, 0x95, 0x56,
-    0xE8, 0x32, 0xC4, 0xF2, 0x38, 0xB8, 0x42, 0x43, 0xA3, 0x98, 0xFE, 0xF9, 0x5B, 0x4C, 0x95, 0xF3,
-    0xDA, 0x29, 0x6E, 0xDA, 0x7C, 0x21, 0xBE, 0x2D, 0x75, 0x34, 0x64, 0x54, 0xB9, 0x4D, 0x5A, 0xF0,
-    0x70, 0xF9, 0x18, 0x31, 0x41, 0x6B, 0x19, 0xD8, 0xC1, 0x2F, 0x20, 0x1D, 0x4D, 0x0A, 0xD6, 0xFC,
-    0x13, 0x0D, 0xD3, 0xBE, 0x89, 0xCC, 0x80, 0x26, 0x33, 0x25, 0x51, 0xAF, 0x50, 0xFB, 0xA9, 0x58,
-    0x41, 0x9E, 0x17, 0x24, 0x15, 0xC9, 0x33, 0x75, 0x04, 0x16, 0x51, 0xA9, 0x2C, 0xEA, 0x90, 0x5A,
-    0x7A, 0x30, 0xF7, 0x5F, 0xFA, 0x33, 0x05, 0xBB, 0x05, 0x18, 0x00, 0x07, 0x88, 0xB6, 0xAF, 0xA3,
-    0xF2, 0x06, 0xEB, 0x3E, 0x9A, 0xDC, 0x26, 0x38, 0x8C, 0x2D, 0x3B, 0xC6, 0xAE, 0x9E, 0x20, 0x92,
-    0x90, 0x94, 0xCA, 0xCB, 0x87, 0xAD, 0x77, 0x62, 0x1B, 0xCD, 0x04, 0x0B, 0xD1, 0xCB, 0x30, 0xF9,
-    0x55, 0xA2, 0xD0, 0x6E, 0x65, 0x8B, 0x5B, 0x24, 0xC4, 0xD6, 0x49, 0xFC, 0x2D, 0xE0, 0x35, 0x9C,
-    0x86, 0xEF, 0x36, 0xA6, 0x21, 0xA7, 0x4A, 0xA6, 0x45, 0xA1, 0xA7, 0xE2, 0xF8, 0x5E, 0xA2, 0xA4,
-    0xFC, 0x4D, 0x0B, 0x1D, 0xCF, 0x30, 0x2A, 0x7A, 0x17, 0x87, 0x00, 0xE7, 0xC2, 0x10, 0x48, 0xDF,
-    0xA8, 0x58, 0xC7, 0x67, 0x24, 0xF3, 0xCA, 0xD9, 0x18, 0xFA, 0x4D, 0xAA, 0x9A, 0xF5, 0x7A, 0xBD,
-    0x9F, 0x1A, 0x41, 0xB8, 0x38, 0x1B, 0x78, 0xD4, 0x90, 0x34, 0x5E, 0x3A, 0x38, 0x05, 0xF0, 0x2F,
-    0xCD, 0x5B, 0x3D, 0x8C, 0xDE, 0xD6, 0x95, 0x7D, 0x24, 0x3D, 0x43, 0x40, 0x04, 0xF2, 0xB6, 0xB0,
-    0x76, 0x17, 0x12, 0x12, 0x56, 0x0B, 0x04, 0x4A, 0x1C, 0x36, 0x01, 0xD6, 0xC5, 0x68, 0x1E, 0x65,
-    0x15, 0x2E, 0x54, 0x48, 0x85, 0x27, 0xC1, 0x3A, 0x85, 0xB6, 0xC8, 0x02, 0x49, 0x8A, 0xCC, 0x16,
-    0x2E, 0x8C, 0xC5, 0x68, 0x48, 0x5B, 0x85, 0x0B, 0x17, 0x1A, 0x2C, 0x36, 0xD9, 0x62, 0x8B, 0xA8,
-    0x70, 0xE1, 0x8C, 0x17, 0x99, 0x14, 0x2E, 0x54, 0xCC, 0x0C, 0x29, 0x0D, 0xB0, 0x2A, 0x5C, 0x88,
-    0xB2, 0x91, 0x04, 0x58, 0x03, 0x2B, 0x3A, 0xB6, 0xE3, 0xC4, 0x02, 0x56, 0xB4, 0x4C, 0xAD, 0x38,
-    0x12, 0xC9, 0xB7, 0xE7, 0xDC, 0xC7, 0x6F, 0x66, 0x64, 0x4B, 0xB6, 0x93, 0x75, 0x80, 0x1D, 0x68,
-    0x46, 0x33, 0xDF, 0xF7, 0xF1, 0xF1, 0xBE, 0xFB, 0xEE, 0x3D, 0xF7, 0xDC, 0x1F, 0x2A, 0x15, 0x36,
-    0x4A, 0xA9, 0xA4, 0xC4, 0x0F, 0x8B, 0x6F, 0xEF, 0x55, 0xF5, 0xE9, 0xAF, 0xD8, 0xDA, 0x34, 0xB0,
-    0xB6, 0x51, 0xC6, 0xFE, 0xC1, 0x7D, 0x7E, 0x1B, 0xDF, 0xBA, 0xC2, 0xC7, 0x7B, 0x5E, 0x6C, 0x5B,
-    0x85, 0xB7, 0x95, 0xCA, 0x6C, 0xAD, 0xA2, 0x66, 0x5A, 0x49, 0xDF, 0x59, 0x4A, 0x3D, 0x6B, 0x3B,
-    0x5C, 0x64, 0xF3, 0x80, 0xBF, 0x64, 0x58, 0x06, 0x6F, 0x98, 0x93, 0x0D, 0xAE, 0xC3, 0x1D, 0x75,
-    0xC3, 0x6B, 0xDE, 0xE8, 0x94, 0xF7, 0xF3, 0x63, 0x6B, 0x9F, 0xB8, 0xE5, 0xA1, 0x0D, 0x5B, 0xAA,
-    0xC2, 0x8E, 0x4A, 0xEE, 0xCB, 0x5B, 0xA9, 0x0C, 0xDF, 0x3E, 0xEF, 0xA7, 0x6B, 0xFE, 0x85, 0x97,
-    0x7D, 0xAC, 0xAC, 0xB4, 0x1D, 0xB0, 0xE6, 0xDA, 0xEC, 0x3D, 0xDE, 0xDE, 0x7C, 0xB8, 0xAE, 0x70,
-    0xEB, 0x5E, 0x45, 0x4E, 0x68, 0x5B, 0xE2, 0x2F, 0x3B, 0xAD, 0x8C, 0x8B, 0x6C, 0x9D, 0xE0, 0xC7,
-    0x0B, 0x76, 0x5C, 0xFF, 0xB9, 0x32, 0x6A, 0xDA, 0x45, 0xC4, 0x55, 0x0D, 0x04, 0xF4, 0xEC, 0x98,
-    0xF2, 0xCA, 0x54, 0x99, 0xD1, 0x72, 0x2F, 0x03, 0xF6, 0x1C, 0xB4, 0x2A, 0xC9, 0x75, 0x89, 0xDF,
-    0x8D, 0x0A, 0x9A, 0xA0, 0x53, 0xC9, 0x65, 0x08, 0x38, 0x46, 0x83, 0x0A, 0xBA, 0x24, 0xDF, 0x13,
-    0xFB, 0x31, 0x8A, 0xC0, 0x6F, 0xBC, 0x14, 0x41, 0xA7, 0x61, 0xF5, 0x69, 0x4D, 0x62, 0xE9, 0x8A,
-    0xBB, 0x92, 0xBB, 0x16, 0xBC, 0x69, 0xEE, 0x94, 0x49, 0xCD, 0x06, 0xFD, 0xA4, 0xBE, 0x0C, 0x2F,
-    0x26, 0x95, 0xDB, 0x10, 0x5F, 0xF4, 0x46, 0xBE, 0x01, 0xF1, 0x0E, 0xA7, 0xB2, 0xD2, 0xF2, 0x7B,
-    0xB8, 0x10, 0xBB, 0x8B, 0xC7, 0xA2, 0x84, 0x38, 0x83, 0x1A, 0xB1, 0x03, 0x28, 0xF5, 0x58, 0xB0,
-    0xBB, 0x74, 0x06, 0xDA, 0x19, 0xA1, 0x18, 0x5B, 0xE1, 0xF5, 0xE9, 0xA0, 0x6C, 0xBA, 0xDC, 0xC6,
-    0xD4, 0x02, 0xB7, 0xAF, 0xDD, 0x71, 0x60, 0xC9, 0x62, 0x9C, 0x89, 0x76, 0xD4, 0xAE, 0x89, 0x2E,
-    0x03, 0x2A, 0xD5, 0x56, 0x7F, 0xA1, 0xE2, 0x7A, 0xD2, 0x29, 0x8D, 0xC3, 0xB7, 0xEF, 0x51, 0xFA,
-    0xCE, 0x29, 0x5E, 0x2D, 0x63, 0xF3, 0x2A, 0xE6, 0x9B, 0xA6, 0xFC, 0x4A, 0x1A, 0xF6, 0x81, 0x7D,
-    0xCD, 0xE6, 0x93, 0x62, 0x3B, 0x2C, 0x85, 0x0F, 0x27, 0x39, 0xC4, 0x36, 0x39, 0x14, 0x97, 0x51,
-    0xB7, 0x83, 0xD2, 0xA5, 0x37, 0x7B, 0x21, 0x85, 0x95, 0x58, 0xDC, 0xC0, 0x1F, 0x95, 0xA9, 0x78,
-    0x8F, 0x24, 0x2A, 0x83, 0xA6, 0x57, 0x45, 0x52, 0xEA, 0x8F, 0xBB, 0x4F, 0x98, 0x02, 0xD4, 0x4B,
-    0x05, 0x40, 0x4B, 0xB8, 0x94, 0x56, 0xC0, 0x93, 0xC2, 0xBE, 0x70, 0x1A, 0xDE, 0x81, 0xD7, 0x53,
-    0x31, 0x3D, 0xA8, 0x0E, 0x72, 0x63, 0x5D, 0x2C, 0xEC, 0xA4, 0xC7, 0xE7, 0x5B, 0x91, 0x73, 0xD2,
-    0xA1, 0x18, 0xA8, 0xFC, 0x35, 0xEC, 0xFD, 0x95, 0x4F, 0x7F, 0xE9, 0xD9, 0x5F, 0xFE, 0x83, 0x7F,
-    0xED, 0x59, 0x16, 0xEE, 0xF2, 0xD7, 0x11, 0xFE, 0xC2, 0x4E, 0x55, 0x48, 0x93, 0xE2, 0x11, 0x28,
-    0x3B, 0xEE, 0x4B, 0xBB, 0xFE, 0x1A, 0x8F, 0x5D, 0xAC, 0xCD, 0x58, 0x5E, 0xD7, 0x07, 0x10, 0x37,
-    0xA8, 0x35, 0x8E, 0x2D, 0x56, 0x2B, 0x7C, 0xC1, 0xBF, 0x93, 0xF2, 0x05, 0x1E, 0x9E, 0x5C, 0xDF,
-    0xFB, 0x8D, 0x2E, 0xF1, 0x42, 0x69, 0x54, 0xA2, 0x16, 0x55, 0xAF, 0x7A, 0xAF, 0x8D, 0x9B, 0xB0,
-    0xA6, 0x0D, 0xDA, 0xD4, 0xD8, 0x2E, 0xEC, 0x79, 0x0B, 0x93, 0x1F, 0x50, 0xCA, 0x71, 0xD1, 0x4C,
-    0x8A, 0x55, 0x71, 0x69, 0x09, 0x93, 0xF4, 0xE0, 0x54, 0x9D, 0xDA, 0x54, 0x6A, 0x0B, 0x4B, 0x28,
-    0xB3, 0x5E, 0x94, 0x34, 0x00, 0x5B, 0x43, 0x14, 0x6B, 0xFD, 0x46, 0x75, 0x51, 0xDD, 0xAB, 0x73,
-    0x5E, 0xB7, 0x88, 0x7B, 0x6C, 0xE3, 0xC2, 0xCB, 0x05, 0x2E, 0xB4, 0x76, 0xA7, 0x81, 0x6B, 0x5C,
-    0xEE, 0xB0, 0xA1, 0xF4, 0x07, 0xB2, 0x30, 0xBC, 0xC5, 0x9E, 0xC6, 0xF7, 0x55, 0x7C, 0xDF, 0xB6,
-    0x3C, 0x4D, 0x6E, 0x3C, 0xEC, 0x26, 0x9D, 0xC8, 0xBE, 0xFE, 0x73, 0x8D, 0x86, 0xAC, 0x9C, 0x21,
-    0x9F, 0xC0, 0xC5, 0xB8, 0x65, 0x91, 0xC7, 0xA9, 0xA9, 0xA2, 0x4A, 0x37, 0x41, 0x13, 0xF6, 0x5E,
-    0x8F, 0x23, 0x80, 0xAD, 0xA5, 0xE2, 0x1B, 0x1E, 0x55, 0x47, 0x05, 0x28, 0x9E, 0x2D, 0xFD, 0x42,
-    0x1D, 0x9E, 0xF6, 0x61, 0x5E, 0x1C, 0x71, 0x8A, 0x71, 0x83, 0x43, 0xA5, 0x36, 0x4F, 0x13, 0x1A,
-    0x60, 0xE5, 0xFA, 0x26, 0xCE, 0xCC, 0x14, 0x39, 0xEC, 0x0E, 0x97, 0x68, 0x5A, 0x5B, 0xD6, 0xD3,
-    0x0A, 0x6B, 0xFE, 0x55, 0xD1, 0x0A, 0x4B, 0x5A, 0x2A, 0x36, 0xF9, 0x01, 0xCC, 0xB5, 0x38, 0x0D,
-    0x88, 0xE9, 0xB5, 0x4D, 0xE3, 0x26, 0xA1, 0x8F, 0x08, 0x9C, 0xC9, 0x0F, 0x1E, 0xB4, 0x3A, 0x32,
-    0x69, 0x4E, 0x10, 0x04, 0x86, 0x9F, 0xEB, 0x2A, 0x18, 0xF0, 0x97, 0x69, 0x7C, 0x58, 0x6E, 0xA9,
-    0xEB, 0x04, 0xDA, 0x3D, 0x61, 0x5B, 0x08, 0x62, 0xCB, 0xA8, 0x86, 0xD7, 0x9B, 0xD3, 0x37, 0x3B,
-    0xAF, 0x2F, 0xB0, 0xA1, 0xFB, 0x1F, 0xE1, 0x2F, 0x7B, 0x0A, 0x27, 0xD0, 0x19, 0x28, 0xF3, 0x32,
-    0xB6, 0xD4, 0x6B, 0xFC, 0x55, 0x99, 0x26, 0x1C, 0x7D, 0x3B, 0x3B, 0x93, 0xF8, 0x44, 0x4F, 0x64,
-    0x81, 0xE4, 0x14, 0x31, 0x79, 0xEF, 0x21, 0x28, 0x7A, 0x68, 0x4D, 0xBD, 0x0A, 0x7F, 0x37, 0x69,
-    0xD8, 0xC0, 0xD3, 0x4D, 0xDA, 0xC3, 0xAC, 0xA1, 0x9E, 0x64, 0x07, 0x7B, 0x1E, 0xB6, 0xA6, 0x5D,
-    0x02, 0x4A, 0x55, 0x44, 0x73, 0xCA, 0x4A, 0xA7, 0x75, 0x41, 0x08, 0x00, 0x81, 0xB7, 0x41, 0x5B,
-    0x87, 0x8E, 0x02, 0x51, 0x86, 0xE0, 0xCA, 0x11, 0x35, 0xBF, 0x16, 0x34, 0x8A, 0x5B, 0xD1, 0x90,
-    0x1B, 0xDE, 0x30, 0x08, 0x4A, 0x05, 0x2D, 0x3D, 0x0D, 0xBF, 0x46, 0xC4, 0xAD, 0xD1, 0xBD, 0xDD,
-    0x1C, 0x7C, 0x9B, 0x40, 0x00, 0x57, 0x6D, 0xA0, 0x42, 0xDC, 0x2C, 0xA6, 0x8D, 0x8B, 0xB1, 0x2B,
-    0x9A, 0xEA, 0xBE, 0xC8, 0x83, 0xBB, 0xB7, 0x0A, 0x05, 0x7C, 0xB8, 0x31, 0x48, 0x13, 0xDE, 0xC5,
-    0x47, 0x07, 0x7C, 0x34, 0x39, 0xDF, 0xC0, 0xF0, 0x00, 0x99, 0x23, 0xD1, 0xB1, 0x34, 0x0E, 0xE5,
-    0xB1, 0x74, 0x89, 0xA5, 0xA1, 0x58, 0xFC, 0x62, 0xB1, 0x47, 0xF8, 0xA3, 0x79, 0x0B, 0x9B, 0xE5,
-    0x62, 0xF4, 0x8C, 0x94, 0xF1, 0x02, 0x7F, 0x40, 0x72, 0x15, 0x63, 0x2F, 0xC5, 0x2B, 0xD8, 0xD3,
-    0x28, 0xD8, 0x63, 0xC2, 0xCE, 0xEB, 0x02, 0x58, 0x11, 0x1C, 0x63, 0x09, 0x4A, 0xB6, 0x55, 0x88,
-    0x57, 0x13, 0x68, 0x59, 0xEC, 0x25, 0x1B, 0x53, 0xFF, 0xDE, 0x06, 0x8C, 0x3E, 0x56, 0x0B, 0x6A,
-    0xC5, 0x6F, 0xC2, 0x4A, 0xD3, 0x2F, 0x6C, 0x8E, 0xFD, 0xE4, 0x51, 0xAE, 0xD3, 0xE3, 0x30, 0x6E,
-    0xF8, 0x53, 0x58, 0x2E, 0x13, 0x88, 0x70, 0x7D, 0x17, 0x10, 0xCC, 0xBF, 0x5C, 0xE4, 0x25, 0xAC,
-    0x26, 0x70, 0x6D, 0x31, 0x3F, 0x03, 0x7B, 0x8A, 0x6A, 0xE8, 0x60, 0xC0, 0x76, 0x74, 0x99, 0xC1,
-    0x09, 0x01, 0x4F, 0x26, 0x05, 0x8E, 0x36, 0xD8, 0xDC, 0x36, 0xA0, 0x23, 0x2E, 0x4D, 0x79, 0x74,
-    0xF8, 0xEE, 0x40, 0x4F, 0x6C, 0x10, 0x03, 0xE5, 0x17, 0x7C, 0x32, 0x68, 0x71, 0xDB, 0xE2, 0x80,
-    0x81, 0x84, 0x93, 0x78, 0xB8, 0xC3, 0x2B, 0x62, 0xAB, 0xC9, 0x01, 0xF1, 0xC4, 0xB8, 0x78, 0x47,
-    0x06, 0x59, 0x9A, 0xB6, 0x88, 0x37, 0x2C, 0x9D, 0xF1, 0x9C, 0xD2, 0x47, 0x89, 0xB3, 0x31, 0x85,
-    0x83, 0x88, 0x81, 0x6D, 0x60, 0xF9, 0xBA, 0x33, 0x83, 0x26, 0x36, 0xEE, 0xD8, 0x1D, 0x2A, 0xBC,
-    0x37, 0x5D, 0xC1, 0xCD, 0xFD, 0xC6, 0x9E, 0xAD, 0x19, 0x12, 0x8A, 0xBB, 0x02, 0x6C, 0xF7, 0x5D,
-    0x6C, 0x2C, 0xB8, 0xBA, 0x48, 0xD1, 0x3A, 0x20, 0x90, 0x03, 0x0B, 0xDC, 0xAB, 0x9E, 0x75, 0x20,
-    0x57, 0xB8, 0x77, 0x89, 0x12, 0xB8, 0x51, 0x3C, 0x66, 0xD7, 0x70, 0x6D, 0x64, 0x5F, 0xEA, 0x32,
-    0x2A, 0xA4, 0x2E, 0x4E, 0x42, 0xBB, 0xB6, 0xD3, 0x4D, 0x8C, 0x33, 0xF3, 0x9E, 0xC1, 0x4B, 0x2D,
-    0x3E, 0x5B, 0x7A, 0x40, 0x25, 0x15, 0x55, 0x6A, 0xBE, 0xA7, 0x09, 0x07, 0xD8, 0xC9, 0x91, 0x2D,
-    0x67, 0x00, 0x99, 0x97, 0xC6, 0x75, 0xB2, 0x31, 0x60, 0x7B, 0x25, 0xB0, 0xD0, 0x2B, 0x26, 0xCF,
-    0xA1, 0x61, 0x80, 0x65, 0xC4, 0x35, 0x4C, 0x0B, 0x6E, 0x5D, 0xC2, 0xE5, 0x0A, 0x05, 0x7B, 0xED,
-    0x22, 0x0B, 0xEF, 0xCD, 0x60, 0xF2, 0xA1, 0x6D, 0xFC, 0xCE, 0x14, 0xA5, 0x7E, 0xEB, 0x1E, 0x2C,
-    0x3C, 0xB9, 0xD6, 0xFA, 0x63, 0x9F, 0x95, 0xDA, 0xBE, 0x09, 0x7F, 0x1D, 0x75, 0xE7, 0x41, 0xD7,
-    0x55, 0x04, 0x45, 0x28, 0xD3, 0xEA, 0xDE, 0xB3, 0x79, 0xB1, 0x67, 0xD7, 0x97, 0xC2, 0xDA, 0xF1,
-    0x95, 0x88, 0x7B, 0x09, 0x27, 0xF0, 0x9E, 0x48, 0x00, 0x4E, 0xDB, 0xA4, 0x9A, 0x0E, 0x04, 0x28,
-    0x68, 0x34, 0x2E, 0xCF, 0x0B, 0x84, 0xD7, 0x10, 0xA6, 0x88, 0xC3, 0x83, 0xCD, 0xDF, 0x87, 0x1B,
-    0x99, 0x8D, 0x3A, 0xBC, 0x0D, 0x9C, 0x4A, 0x6E, 0x5D, 0xC5, 0xE7, 0x86, 0x04, 0x7E, 0x54, 0x53,
-    0xF9, 0xE1, 0xA0, 0x8A, 0xC6, 0xE0, 0xAF, 0xD4, 0x96, 0x71, 0x47, 0x3F, 0x06, 0x3B, 0xA8, 0x55,
-    0x7C, 0x19, 0x37, 0xDB, 0xC6, 0x81, 0x05, 0x2D, 0xE3, 0xD3, 0x35, 0xDC, 0x75, 0x2C, 0x10, 0x03,
-    0xEE, 0x77, 0x4A, 0x8C, 0x5B, 0x31, 0x50, 0x84, 0xD4, 0x73, 0x22, 0xB6, 0x36, 0xF0, 0xAF, 0x7E,
-    0x0A, 0x20, 0x63, 0x06, 0x0B, 0x6B, 0xC9, 0xA3, 0x4A, 0x20, 0x94, 0xF5, 0x29, 0xB3, 0xC7, 0xF8,
-    0x93, 0xB8, 0x60, 0x0D, 0x1B, 0x7C, 0xB1, 0x87, 0x89, 0xC0, 0x96, 0x2D, 0x0C, 0x45, 0xD7, 0x05,
-    0xB6, 0xA2, 0x69, 0x23, 0x78, 0xBB, 0x85, 0xA5, 0x64, 0x30, 0x62, 0x5D, 0xE3, 0xED, 0x21, 0x6C,
-    0xD5, 0x72, 0x59, 0xA8, 0x18, 0xE7, 0x13, 0x58, 0x6C, 0xF4, 0x58, 0x3E, 0x43, 0x46, 0xF8, 0x68,
-    0x91, 0x42, 0xC7, 0x59, 0x49, 0x85, 0xE1, 0x08, 0x4B, 0xD3, 0xA9, 0xA2, 0x4D, 0xE0, 0x92, 0x43,
-    0x6C, 0xE1, 0x9B, 0x17, 0xA0, 0x0D, 0x7B, 0xDF, 0xD6, 0xC1, 0x3D, 0x7B, 0x17, 0xDE, 0x5B, 0xEC,
-    0xE2, 0xB3, 0x49, 0x5F, 0xA8, 0xE4, 0x8D, 0xC1, 0xE4, 0xFA, 0x1D, 0xAB, 0xAB, 0xB0, 0xCD, 0x22,
-    0xE0, 0x29, 0x5D, 0x06, 0x9B, 0x1C, 0xE9, 0xB1, 0x87, 0xDD, 0x41, 0x8E, 0x90, 0x05, 0xE1, 0xD5,
-    0x94, 0xBE, 0xC4, 0x7F, 0x9C, 0x64, 0x1A, 0x30, 0x68, 0x40, 0x1C, 0x04, 0x91, 0x16, 0x82, 0xE8,
-    0x06, 0xC1, 0x25, 0x6E, 0x00, 0x11, 0x89, 0x04, 0x2C, 0x1C, 0x1C, 0x36, 0xA6, 0x67, 0x3F, 0xF2,
-    0xF8, 0xDE, 0x3A, 0x94, 0x0D, 0xB1, 0x52, 0x53, 0xFB, 0x16, 0xE8, 0x17, 0xD0, 0x62, 0xE3, 0x41,
-    0x0C, 0x92, 0x01, 0x98, 0xA7, 0x69, 0x73, 0xA8, 0x1A, 0x44, 0x95, 0xEB, 0x13, 0x67, 0x01, 0xAD,
-    0x25, 0xEE, 0x8E, 0x43, 0x84, 0xE2, 0x7B, 0x72, 0x84, 0x91, 0x41, 0xBE, 0x48, 0xF1, 0x76, 0x56,
-    0x26, 0xBB, 0x73, 0x96, 0x11, 0x16, 0x56, 0x64, 0xAD, 0x58, 0x29, 0x54, 0x1C, 0xF2, 0x07, 0x14,
-    0xBB, 0xC7, 0x46, 0x81, 0x22, 0xB9, 0x76, 0x51, 0xB4, 0x85, 0xF4, 0xBD, 0x80, 0xA9, 0x41, 0x54,
-    0x83, 0x45, 0x56, 0x40, 0x57, 0x18, 0xA4, 0xC0, 0xEA, 0xF4, 0x32, 0xEE, 0xA7, 0xEB, 0xA8, 0x09,
-    0xDB, 0xA0, 0xF3, 0xF9, 0x32, 0x44, 0x85, 0x12, 0xE6, 0x80, 0x1B, 0x87, 0xD6, 0x53, 0x41, 0x39,
-    0x8F, 0x7E, 0xB3, 0xED, 0xE0, 0x19, 0xBA, 0x21, 0x6C, 0xC7, 0x44, 0xE1, 0x56, 0xF8, 0x6A, 0x61,
-    0xE9, 0x20, 0xAD, 0x8A, 0xEF, 0xA5, 0xC2, 0x5A, 0x04, 0x7E, 0xB8, 0x55, 0xBA, 0xAD, 0x81, 0x01,
-    0xC7, 0xED, 0x1E, 0x5A, 0x78, 0x1B, 0xA3, 0xE3, 0x21, 0x19, 0x2E, 0x82, 0x9C, 0x65, 0x48, 0x8C,
-    0xB2, 0xD3, 0x07, 0x43, 0x41, 0x33, 0xE2, 0x47, 0x3B, 0x2D, 0x91, 0xB4, 0x04, 0x91, 0xEA, 0xA8,
-    0xE0, 0xBE, 0x04, 0x00, 0xED, 0xAE, 0x9E, 0x84, 0x3A, 0xB6, 0xBE, 0xBE, 0xFE, 0x89, 0xC0, 0xCF,
-    0x75, 0xDA, 0x89, 0xFE, 0xD8, 0x09, 0x2E, 0xE3, 0x4F, 0x22, 0x23, 0xB4, 0x29, 0x51, 0x16, 0x31,
-    0x5C, 0x45, 0x9D, 0x9A, 0x70, 0xFE, 0xE7, 0xEA, 0x90, 0x8B, 0x3E, 0x99, 0x22, 0xD2, 0x69, 0x5A,
-    0x69, 0x87, 0x95, 0x10, 0x36, 0xE2, 0xB7, 0x2B, 0x67, 0xF1, 0x9A, 0x02, 0x17, 0x33, 0x61, 0x09,
-    0xBB, 0x64, 0x63, 0x3C, 0xA3, 0x23, 0x12, 0xDD, 0xF1, 0x87, 0xA1, 0x63, 0x0C, 0xB3, 0x1D, 0x17,
-    0xC2, 0x5C, 0xFB, 0xE4, 0xE9, 0xE6, 0xF8, 0x82, 0x6E, 0x8E, 0x3F, 0xAF, 0xEB, 0xCD, 0xAD, 0xE5,
-    0x9B, 0x3D, 0x30, 0xB5, 0xC5, 0xF1, 0xD5, 0x84, 0x78, 0x11, 0xC7, 0x3A, 0x79, 0x29, 0x9E, 0x3F,
-    0x4C, 0xC8, 0x0E, 0x99, 0xE9, 0x0B, 0x64, 0x9E, 0x72, 0x66, 0x90, 0x19, 0x64, 0xCE, 0x1F, 0x65,
-    0x3F, 0x77, 0x19, 0x68, 0x05, 0xE0, 0x22, 0x41, 0x3B, 0xC3, 0x60, 0xE8, 0x80, 0xC1, 0x4A, 0x5C,
-    0xA4, 0xA4, 0x9A, 0x32, 0x07, 0x63, 0x41, 0xE9, 0xAF, 0x92, 0x60, 0xC2, 0xD3, 0x95, 0xEE, 0x7D,
-    0x66, 0x37, 0xC2, 0x85, 0x63, 0xC4, 0x25, 0x8D, 0x23, 0x85, 0x55, 0xD4, 0x5E, 0xE7, 0xB5, 0x00,
-    0xBD, 0x4D, 0x9C, 0xB3, 0xC1, 0x39, 0xC7, 0x79, 0x54, 0x47, 0x55, 0xD0, 0x02, 0xF2, 0x68, 0x45,
-    0x19, 0xEC, 0x33, 0xC9, 0xE1, 0x38, 0x95, 0x26, 0xE2, 0x8F, 0xDE, 0x44, 0xCC, 0xF3, 0xC3, 0x4B,
-    0x67, 0x67, 0xE1, 0x88, 0x27, 0xFD, 0x8C, 0xEC, 0x7B, 0x51, 0x6D, 0x86, 0xA5, 0xCE, 0x2F, 0x79,
-    0xAD, 0x56, 0x89, 0x07, 0xA3, 0x7B, 0x42, 0xAD, 0x06, 0xB0, 0xBF, 0xC5, 0xA3, 0x0C, 0xB2, 0x08,
-    0xB6, 0x70, 0xD5, 0x0B, 0xA9, 0xC2, 0x0D, 0x61, 0x53, 0x82, 0xAA, 0xAB, 0x80, 0x9B, 0xB9, 0x13,
-    0x5D, 0xD0, 0x9A, 0x53, 0x75, 0x7C, 0x19, 0x4A, 0x2F, 0xC0, 0xFE, 0x82, 0xCE, 0x3C, 0x5D, 0xEB,
-    0xAA, 0x4F, 0xD2, 0x2C, 0x6C, 0x7A, 0xBF, 0x43, 0xF8, 0xD6, 0xD5, 0x56, 0x9C, 0x9B, 0xA0, 0xD9,
-    0x02, 0x62, 0xEC, 0x34, 0x51, 0x7D, 0x0E, 0x1C, 0xF4, 0xA9, 0x66, 0x91, 0xA2, 0xB4, 0xE1, 0x14,
-    0xC8, 0xAD, 0x5A, 0x5A, 0x5A, 0x82, 0x20, 0x3F, 0x54, 0xEA, 0x95, 0xBD, 0x05, 0xD3, 0x22, 0x6A,
-    0xB0, 0x20, 0x4E, 0x42, 0x97, 0x20, 0x31, 0x59, 0xD0, 0x0C, 0x7E, 0x17, 0xCB, 0x82, 0x9A, 0x0B,
-    0x82, 0x68, 0xEA, 0x2B, 0x4D, 0x54, 0xAD, 0x62, 0x41, 0xBF, 0x95, 0x05, 0xC7, 0xA7, 0x2D, 0xCF,
-    0x8E, 0x9C, 0x14, 0x96, 0x56, 0x38, 0x2A, 0x26, 0x2C, 0x9E, 0x40, 0x7F, 0xF8, 0x59, 0x38, 0x1F,
-    0xAC, 0xC5, 0x3A, 0xB6, 0x08, 0x0A, 0x1B, 0x40, 0x11, 0xAB, 0xCF, 0x08, 0x46, 0xC3, 0x3C, 0x75,
-    0xBA, 0xED, 0xB5, 0x61, 0x9D, 0x30, 0xCE, 0x2E, 0x97, 0x99, 0x45, 0x1C, 0xA0, 0xC6, 0xD2, 0x99,
-    0x37, 0x48, 0xF6, 0x86, 0x33, 0xF5, 0x14, 0xB1, 0xE7, 0xB8, 0xE8, 0x4F, 0xF8, 0x45, 0x48, 0x86,
-    0x21, 0xEB, 0xB5, 0xAA, 0xE5, 0xED, 0xC2, 0xF7, 0xE1, 0xFE, 0x70, 0x82, 0x8A, 0x18, 0x84, 0x85,
-    0xEB, 0xA0, 0xC2, 0x06, 0xD2, 0x38, 0x5D, 0x85, 0x9D, 0x6F, 0xC2, 0x54, 0x1B, 0xB9, 0x03, 0xD0,
-    0x7C, 0x04, 0x87, 0x05, 0xBC, 0xE8, 0x36, 0x20, 0x09, 0x29, 0x67, 0xB7, 0x3A, 0xA3, 0xB8, 0x50,
-    0x43, 0x39, 0xC1, 0x95, 0x20, 0x26, 0x56, 0x84, 0x94, 0xE0, 0x2F, 0x10, 0x12, 0xCB, 0x40, 0x46,
-    0x33, 0x0F, 0xA3, 0xEC, 0x70, 0xED, 0x4C, 0xC2, 0xE5, 0x96, 0x0C, 0xA4, 0x87, 0xA7, 0x6D, 0x20,
-    0x75, 0x2C, 0x35, 0x29, 0x48, 0x5C, 0x1D, 0xCA, 0x99, 0x70, 0x2E, 0x7D, 0x67, 0x70, 0x59, 0x6E,
-    0xEC, 0x42, 0x2D, 0x73, 0xEB, 0xB0, 0x45, 0x66, 0x59, 0x20, 0x22, 0xE2, 0xCE, 0x33, 0x8C, 0x22,
-    0x3A, 0xD5, 0x8E, 0x10, 0xBB, 0xAF, 0xC7, 0xD5, 0x2F, 0x52, 0xB5, 0x12, 0x31, 0x83, 0xA0, 0x0D,
-    0x74, 0xC5, 0x0B, 0xBD, 0xD7, 0x0C, 0x6A, 0xD3, 0xBF, 0x8D, 0x44, 0x80, 0xEE, 0x83, 0x1F, 0xB5,
-    0xEA, 0x10, 0xBA, 0xBC, 0x16, 0x76, 0x8D, 0x2C, 0xE3, 0x42, 0x19, 0x36, 0x5A, 0x37, 0xCB, 0x55,
-    0x0C, 0x3F, 0x2A, 0xBF, 0x45, 0x1D, 0x1E, 0xE7, 0xE6, 0x16, 0x54, 0x71, 0x71, 0x4F, 0x93, 0x4C,
-    0xE2, 0xF1, 0x9A, 0xB7, 0xFB, 0xBD, 0x4A, 0x9D, 0x83, 0xB1, 0x46, 0x30, 0x69, 0xA4, 0x24, 0x1D,
-    0x94, 0x99, 0x80, 0x69, 0x7D, 0xB7, 0x25, 0x70, 0x38, 0xE0, 0x8D, 0x99, 0xA0, 0xB7, 0x59, 0x0D,
-    0x06, 0x08, 0x0D, 0x55, 0xA6, 0x0C, 0x7A, 0xF8, 0x72, 0x51, 0x32, 0xFA, 0xE9, 0xCE, 0x5F, 0x3F,
-    0xB1, 0xEE, 0xB6, 0x5F, 0xAC, 0xC2, 0x85, 0x6A, 0x7D, 0x73, 0x60, 0xA6, 0x83, 0x35, 0xC1, 0xD5,
-    0x4A, 0x48, 0x0D, 0x73, 0x7E, 0xC1, 0x52, 0x73, 0x88, 0x97, 0xD8, 0xE3, 0x98, 0xED, 0x61, 0x1B,
-    0x2E, 0x3B, 0x0A, 0xE8, 0x16, 0xA6, 0x55, 0x4B, 0x92, 0x84, 0x74, 0xCE, 0xD1, 0x9E, 0x5B, 0x02,
-    0xD3, 0xA5, 0x2F, 0xB4, 0xE7, 0x3A, 0xA2, 0x15, 0xE8, 0x55, 0x8C, 0xB4, 0x03, 0xAC, 0xBA, 0xF3,
-    0x86, 0x90, 0x00, 0x8A, 0x54, 0x98, 0xCE, 0xCC, 0x38, 0x3A, 0x4F, 0x3E, 0x21, 0x86, 0x95, 0xC3,
-    0x75, 0x74, 0xFE, 0x7C, 0x58, 0x9D, 0xF3, 0x45, 0xA9, 0xE5, 0x71, 0x64, 0x59, 0x6A, 0xC0, 0xCD,
-    0xA1, 0xFC, 0x13, 0x92, 0x0B, 0x0B, 0x1F, 0x2E, 0xF5, 0x87, 0xEB, 0x64, 0x5F, 0x41, 0xE7, 0x2A,
-    0x0D, 0x44, 0x89, 0xDE, 0x61, 0x1E, 0x60, 0x8E, 0x98, 0x42, 0x64, 0x3E, 0x96, 0x0B, 0x37, 0x22,
-    0xE9, 0x41, 0x78, 0x46, 0xB6, 0x02, 0xFF, 0x51, 0xF1, 0x4B, 0x90, 0x13, 0x96, 0x98, 0xE9, 0xCA,
-    0x1B, 0x60, 0x69, 0x6D, 0x5C, 0x12, 0x9B, 0x32, 0xC7, 0xFB, 0xAA, 0x0C, 0x1A, 0x5C, 0x45, 0xD2,
-    0xE6, 0xD4, 0x8C, 0xCB, 0xB0, 0xE7, 0xDD, 0x38, 0xDD, 0xFE, 0x4E, 0x07, 0x21, 0x5E, 0xC4, 0x7E,
-    0xCC, 0x92, 0x78, 0xAF, 0xF9, 0xF0, 0x17, 0x01, 0x2D, 0x93, 0xB8, 0xBE, 0x0B, 0xE9, 0x7D, 0x18,
-    0x7E, 0x96, 0x47, 0x9D, 0xC9, 0x07, 0x80, 0xAC, 0x79, 0xB3, 0x8F, 0xAF, 0x32, 0x05, 0x4D, 0x76,
-    0x3A, 0x1C, 0x43, 0xB8, 0xDB, 0x1B, 0xE6, 0x0A, 0xC9, 0xAD, 0x37, 0x04, 0xAA, 0x6C, 0x2F, 0x59,
-    0x67, 0x68, 0x6F, 0xD9, 0x29, 0x80, 0x95, 0x72, 0xA8, 0xC2, 0xE6, 0x02, 0x09, 0x75, 0xB0, 0xC2,
-    0x5B, 0x23, 0xE9, 0x5B, 0xD1, 0xD9, 0x37, 0xA4, 0xCC, 0x41, 0xA2, 0x88, 0xC3, 0xCC, 0xA1, 0x87,
-    0x96, 0x88, 0xFE, 0x2D, 0xB0, 0xB3, 0x4A, 0x7D, 0x93, 0x21, 0x15, 0x99, 0x59, 0x9E, 0xB6, 0x31,
-    0x94, 0x54, 0x1D, 0x85, 0x2E, 0x19, 0x01, 0xFB, 0x60, 0x80, 0x7B, 0xF7, 0x7E, 0x9B, 0xF4, 0x41,
-    0x53, 0x74, 0xC1, 0xED, 0xB1, 0x0D, 0x6F, 0x7E, 0xDC, 0x44, 0xB7, 0x76, 0xC0, 0x97, 0x00, 0x31,
-    0x83, 0xAE, 0x62, 0x20, 0x7E, 0x52, 0xC7, 0xE5, 0x1E, 0xC3, 0x00, 0xE7, 0x0A, 0x24, 0x65, 0x6C,
-    0x67, 0x84, 0x2B, 0x86, 0x23, 0x5D, 0x02, 0x26, 0x42, 0x2D, 0x1A, 0xA7, 0xB6, 0x82, 0xC8, 0xFE,
-    0xAE, 0x4D, 0xF5, 0x8F, 0x37, 0xD5, 0xEA, 0xC7, 0xB0, 0xF7, 0x38, 0xD7, 0x2D, 0x38, 0xC3, 0xF9,
-    0x46, 0x4A, 0x45, 0x2A, 0x3E, 0x55, 0xAB, 0x7E, 0x55, 0x85, 0xBF, 0x01, 0xB1, 0xC9, 0x04, 0x95,
-    0x23, 0x2B, 0x38, 0xED, 0x31, 0x07, 0xC4, 0xF7, 0x62, 0x51, 0xFA, 0x2D, 0x0E, 0x8F, 0x65, 0x99,
-    0x84, 0xB1, 0xAD, 0x0C, 0xDE, 0xAC, 0xBD, 0xA6, 0x55, 0x97, 0x56, 0xD4, 0x71, 0x84, 0x5A, 0x9D,
-    0xEB, 0xF3, 0x55, 0xF0, 0x26, 0xCC, 0x04, 0x54, 0x60, 0x51, 0x9D, 0x99, 0x63, 0xA6, 0xBC, 0xCA,
-    0xD0, 0xED, 0x8D, 0xFE, 0x10, 0x58, 0xD6, 0x30, 0x74, 0x1F, 0xDA, 0x04, 0xC8, 0xB2, 0xDA, 0xEA,
-    0x8D, 0xB1, 0x89, 0x97, 0xEF, 0x36, 0x49, 0xF2, 0x41, 0x6D, 0xE2, 0x6B, 0x95, 0x89, 0x2F, 0x54,
-    0xDB, 0x73, 0x60, 0x13, 0x8B, 0x84, 0xF3, 0x54, 0xE7, 0x51, 0x09, 0xD1, 0x81, 0x14, 0x70, 0x8B,
-    0x1E, 0x0B, 0x6D, 0x13, 0xE7, 0x53, 0x3A, 0x70, 0xE4, 0xB2, 0x2A, 0x98, 0x22, 0x02, 0x59, 0x21,
-    0x3C, 0x84, 0xD1, 0xF1, 0xA8, 0x1C, 0x37, 0xA2, 0x47, 0x5E, 0xC0, 0xEE, 0x4B, 0x7D, 0xA5, 0x55,
-    0x80, 0xE5, 0xE4, 0x7C, 0x17, 0x37, 0xB0, 0x57, 0x5F, 0x88, 0x4E, 0x2D, 0x79, 0x23, 0x89, 0x36,
-    0x4E, 0xCB, 0x1B, 0xBE, 0x03, 0x8C, 0xF6, 0x20, 0xAC, 0xDF, 0xE1, 0x46, 0x2D, 0x93, 0x46, 0xC4,
-    0x10, 0x20, 0xAC, 0xAE, 0x71, 0x7D, 0x85, 0x98, 0x02, 0x77, 0x34, 0xE5, 0xB1, 0xF4, 0x58, 0xEA,
-    0x40, 0x49, 0xDF, 0x9A, 0x51, 0x46, 0x5B, 0x35, 0x88, 0xA9, 0x3E, 0x9C, 0xA7, 0x8A, 0x90, 0x34,
-    0x00, 0x0E, 0x61, 0xCC, 0x30, 0xCF, 0x1A, 0xA9, 0xB7, 0xFD, 0xDD, 0x84, 0x36, 0x89, 0x70, 0x26,
-    0x2A, 0xB2, 0xF9, 0xFE, 0x54, 0x02, 0x39, 0x58, 0xE6, 0x70, 0xE8, 0xEC, 0x2A, 0x43, 0x88, 0x2F,
-    0xD0, 0xCE, 0xBF, 0xC3, 0xB2, 0x81, 0x04, 0x89, 0x80, 0x96, 0x61, 0xEA, 0x4E, 0x6A, 0x1F, 0xDB,
-    0x6A, 0xDE, 0xE6, 0x00, 0xAA, 0x1D, 0xA0, 0xFB, 0x3F, 0x65, 0xAF, 0xE5, 0x53, 0xFC, 0x01, 0xDB,
-    0x67, 0x92, 0x07, 0x95, 0xF9, 0xAE, 0x48, 0x43, 0x26, 0x01, 0xD4, 0x3F, 0x44, 0xA0, 0x81, 0x93,
-    0xA6, 0x50, 0x17, 0x18, 0x02, 0x8B, 0x42, 0x4C, 0x98, 0x4E, 0x22, 0x94, 0xFE, 0xB6, 0x05, 0x79,
-    0xC0, 0x87, 0x0B, 0x5E, 0x27, 0x99, 0xEE, 0xC4, 0x61, 0xC4, 0xEF, 0x6B, 0x91, 0xCD, 0x2F, 0x5A,
-    0x1C, 0x79, 0x47, 0xDB, 0x75, 0x44, 0x07, 0x5F, 0x0B, 0x62, 0xDF, 0x39, 0x03, 0x96, 0x67, 0xCF,
-    0xFE, 0xB4, 0x33, 0x2F, 0xB4, 0xFA, 0x2A, 0x42, 0x45, 0xBF, 0x89, 0x1C, 0xEC, 0xE5, 0x72, 0x35,
-    0x68, 0xB7, 0xA2, 0xCA, 0x0A, 0xAF, 0x34, 0xB4, 0xFF, 0x65, 0x21, 0x79, 0xCA, 0x85, 0x4A, 0xC9,
-    0x79, 0xC3, 0x5A, 0xE0, 0x54, 0x4A, 0x04, 0x49, 0xAA, 0x11, 0x10, 0x7C, 0x56, 0xF5, 0x8C, 0x61,
-    0x79, 0x31, 0x17, 0x1B, 0x13, 0x8E, 0x63, 0x98, 0x4C, 0xB1, 0x68, 0xB9, 0x51, 0x21, 0xA9, 0x12,
-    0xA4, 0xCB, 0x8F, 0xE5, 0xD8, 0x52, 0x80, 0x33, 0xD2, 0x88, 0xF2, 0x99, 0xDA, 0xE2, 0x71, 0xE1,
-    0x90, 0x4A, 0x03, 0x2D, 0xC0, 0x47, 0x90, 0xA3, 0x96, 0x09, 0x6E, 0x82, 0xBB, 0x9F, 0x84, 0x86,
-    0x62, 0x62, 0x38, 0xE1, 0x85, 0xEA, 0x45, 0x6E, 0x37, 0xE7, 0x9D, 0xCC, 0xDF, 0x29, 0x9F, 0xAB,
-    0x17, 0xBE, 0x1D, 0x7F, 0x35, 0x7E, 0xC9, 0x56, 0xF6, 0x97, 0xD8, 0xCE, 0x57, 0x54, 0x98, 0x07,
-    0xDD, 0x11, 0x70, 0xFA, 0x93, 0xCD, 0x16, 0xD2, 0x0E, 0x5D, 0x6E, 0x23, 0x7E, 0xEB, 0x6A, 0x88,
-    0xF3, 0x1E, 0x96, 0xC3, 0x00, 0x0C, 0xF9, 0x4E, 0x36, 0xC6, 0x6F, 0x56, 0xE9, 0xD2, 0x15, 0xB2,
-    0xB2, 0x5E, 0xD8, 0xB2, 0xE8, 0xE3, 0x8F, 0xB9, 0xB4, 0xC7, 0xA5, 0x20, 0xF7, 0xD6, 0xEE, 0x95,
-    0x6D, 0xAB, 0x89, 0xF0, 0x1D, 0x4B, 0x8B, 0x86, 0xB5, 0x86, 0xAF, 0x28, 0xF5, 0x9C, 0xF2, 0xE1,
-    0x64, 0xE0, 0xB8, 0xA3, 0x5F, 0xAF, 0xE8, 0xA7, 0x9A, 0xE3, 0xCB, 0x2F, 0xD8, 0x3E, 0x9A, 0xD5,
-    0x3E, 0xE6, 0xA4, 0x68, 0xF0, 0x38, 0xE2, 0xA1, 0x56, 0x08, 0x39, 0xB9, 0x5A, 0xF4, 0x2A, 0xA5,
-    0x53, 0x98, 0x20, 0x92, 0x08, 0x9F, 0x99, 0x60, 0x17, 0x3D, 0xD5, 0x9C, 0x0B, 0xCA, 0x4B, 0x49,
-    0xFA, 0xD1, 0x16, 0x72, 0x64, 0xA4, 0x29, 0xC9, 0xE8, 0x75, 0x33, 0xA4, 0x5F, 0x50, 0x41, 0xA9,
-    0x9E, 0x57, 0xB4, 0x54, 0xD0, 0xBB, 0xCB, 0xF5, 0xCA, 0xF1, 0x70, 0xE7, 0xD7, 0x5D, 0x66, 0xA7,
-    0x1B, 0xFC, 0x1D, 0xB0, 0xAC, 0x8E, 0x52, 0x7C, 0x7C, 0x85, 0x65, 0xAF, 0x1F, 0x6D, 0xF9, 0x34,
-    0x71, 0x64, 0x3C, 0xED, 0x3F, 0x15, 0x35, 0x8E, 0x3D, 0xD9, 0xB3, 0xD3, 0x00, 0x51, 0x3B, 0xB8,
-    0x62, 0x9B, 0xF0, 0xE5, 0x3B, 0x6D, 0x74, 0x3A, 0x7D, 0x5E, 0x6F, 0xAB, 0xE7, 0x91, 0xD3, 0xBC,
-    0x0E, 0x6E, 0xD6, 0x3C, 0x01, 0x5B, 0x58, 0xD8, 0x3E, 0x5B, 0x3D, 0x59, 0xD8, 0xF2, 0x39, 0xE4,
-    0xA0, 0xBF, 0x8C, 0xA6, 0xCB, 0x0A, 0xE4, 0x1F, 0xDB, 0xAA, 0x8D, 0xF2, 0x05, 0xC4, 0xA6, 0x7C,
-    0x33, 0xB8, 0x57, 0xD0, 0xAA, 0xB5, 0x6D, 0xA3, 0xEB, 0x63, 0xD0, 0x98, 0x17, 0x7A, 0xDD, 0xD8,
-    0x93, 0xBD, 0xA9, 0xA0, 0x1B, 0xFF, 0x15, 0xC7, 0x87, 0xF9, 0x1D, 0xB5, 0xEA, 0x11, 0x5F, 0xA0,
-    0xEA, 0x09, 0xC2, 0x13, 0x80, 0x3D, 0xF9, 0xC9, 0x36, 0x4B, 0x10, 0xB0, 0xCD, 0x1A, 0xC8, 0xAE,
-    0x84, 0x3D, 0xAE, 0x93, 0xC1, 0xA6, 0x84, 0xF6, 0x88, 0x85, 0x89, 0xA0, 0x06, 0x1D, 0x78, 0xB9,
-    0x06, 0x63, 0x48, 0xA3, 0xFF, 0x19, 0x1E, 0xB6, 0x5C, 0xC2, 0x68, 0xDC, 0xA8, 0xED, 0xA7, 0xAB,
-    0xE8, 0xFD, 0xE5, 0xDC, 0x61, 0x45, 0xA7, 0x7F, 0x25, 0x1E, 0xA8, 0xEC, 0xFA, 0xA5, 0xC0, 0x15,
-    0x0D, 0xC0, 0x0B, 0xD6, 0x9C, 0xD3, 0x19, 0xE2, 0x7B, 0x8B, 0x60, 0x86, 0x54, 0xEE, 0x27, 0x72,
-    0xD7, 0xF0, 0x26, 0x8B, 0xF0, 0x88, 0x96, 0x37, 0x9B, 0xA8, 0x8D, 0x4A, 0x93, 0x27, 0x24, 0xA1,
-    0x48, 0x53, 0x90, 0x14, 0x26, 0x27, 0x06, 0xFE, 0x1A, 0x35, 0x08, 0xA3, 0x2F, 0x58, 0x3D, 0x8A,
-    0x63, 0x05, 0x42, 0x01, 0xB0, 0xCE, 0x99, 0x49, 0x08, 0xD6, 0xEE, 0x36, 0xB1, 0x50, 0x29, 0xCC,
-    0x0C, 0x60, 0xE3, 0x00, 0x0B, 0xC1, 0x77, 0xFD, 0x55, 0xA2, 0x06, 0x9D, 0x13, 0xBE, 0x42, 0xEA,
-    0x1E, 0xB9, 0x38, 0x49, 0x5B, 0x62, 0xF9, 0x8A, 0x85, 0x94, 0x75, 0x01, 0x11, 0x86, 0x71, 0xB5,
-    0xE8, 0x83, 0x5D, 0x7E, 0x3D, 0xFE, 0x30, 0x27, 0x18, 0xE2, 0xAD, 0x6E, 0xFE, 0x22, 0x24, 0x83,
-    0x3A, 0x3C, 0xC4, 0xA7, 0xB9, 0xE9, 0x76, 0x19, 0xC5, 0x2D, 0xC3, 0xEA, 0x31, 0x9E, 0x78, 0xB0,
-    0xCB, 0x32, 0x83, 0x80, 0x10, 0x70, 0x60, 0xF1, 0x7B, 0xB4, 0x73, 0x38, 0x12, 0x40, 0xC7, 0x25,
-    0x69, 0xA0, 0x75, 0xC0, 0x18, 0xD6, 0x99, 0xD4, 0x91, 0x29, 0x6D, 0xFB, 0x16, 0x77, 0x0D, 0x6A,
-    0x16, 0xA7, 0x10, 0x1A, 0x3E, 0x1E, 0xE7, 0x40, 0x68, 0xFE, 0x5F, 0x02, 0x80, 0xE8, 0x77, 0x7E,
-    0x03, 0x6B, 0xE8, 0xA3, 0xDB, 0xBD, 0xFE, 0xB8, 0x9F, 0xD5, 0x04, 0x44, 0x53, 0x1D, 0x49, 0xB4,
-    0xCF, 0xAA, 0x16, 0x21, 0x01, 0xDA, 0x04, 0xDE, 0xE1, 0xAA, 0x44, 0x50, 0xCF, 0xD1, 0x92, 0x73,
-    0x4E, 0xCB, 0xFD, 0xC1, 0x33, 0xF2, 0xD7, 0x1C, 0xE4, 0x95, 0xF2, 0x3A, 0x6E, 0xC7, 0x62, 0x9A,
-    0x71, 0xA5, 0xB4, 0x15, 0x47, 0x71, 0xBB, 0x3D, 0x6E, 0x4E, 0x62, 0x52, 0x32, 0x5F, 0x20, 0xBC,
-    0xCD, 0x09, 0x6B, 0xC5, 0x4B, 0x19, 0x54, 0xF7, 0xFA, 0x37, 0x41, 0x2B, 0x9F, 0x54, 0xAA, 0x5E,
-    0x5C, 0xF3, 0xAA, 0xAC, 0x0B, 0xCA, 0x66, 0x25, 0xC8, 0x9B, 0x95, 0xE8, 0xC4, 0x3B, 0x5D, 0xEC,
-    0xDB, 0x66, 0x31, 0xB0, 0xF9, 0x0F, 0x66, 0x24, 0x2D, 0xFD, 0x7B, 0xB5, 0x00, 0xB7, 0x69, 0x08,
-    0x15, 0xCF, 0xC1, 0xE0, 0xEE, 0x10, 0x60, 0xC2, 0xFC, 0xC9, 0x27, 0x9E, 0xF0, 0xAB, 0xD7, 0x1B,
-    0x1D, 0xED, 0x94, 0x66, 0xFC, 0x9A, 0x67, 0x1D, 0x40, 0xFE, 0xDF, 0xCC, 0xE2, 0xB2, 0xF5, 0x48,
-    0x49, 0xA5, 0x76, 0xDD, 0xB8, 0x4D, 0x71, 0xA7, 0x73, 0x53, 0xE5, 0x00, 0x81, 0xD9, 0x60, 0xCB,
-    0xE7, 0xA0, 0x80, 0xAD, 0x5E, 0x22, 0xB3, 0x2F, 0xD9, 0x1B, 0x39, 0x88, 0x2B, 0x6A, 0xEA, 0x0D,
-    0x44, 0x9B, 0xD3, 0xC0, 0x7C, 0xBE, 0x20, 0x35, 0x45, 0xB6, 0x59, 0x98, 0x78, 0xCD, 0xBF, 0xF2,
-    0x80, 0xAD, 0xFF, 0xA9, 0xE4, 0x02, 0xEA, 0x8D, 0x4A, 0x49, 0xAF, 0x15, 0xAB, 0xEA, 0x2A, 0x1A,
-    0x1E, 0xE5, 0x9C, 0xAC, 0x96, 0xB7, 0x8C, 0xD4, 0x39, 0x4C, 0x01, 0x74, 0x9C, 0xB1, 0x07, 0x49,
-    0x8D, 0x92, 0xE0, 0xA3, 0xCC, 0x8D, 0xD2, 0x45, 0x1F, 0x8F, 0xAB, 0x48, 0xF8, 0xD1, 0xDD, 0xAC,
-    0x92, 0x3C, 0x4E, 0xC1, 0xF1, 0x1B, 0x60, 0x4C, 0x12, 0x81, 0xA2, 0x59, 0xAE, 0xAD, 0xD4, 0xC5,
-    0xF9, 0x74, 0xC5, 0xAF, 0x17, 0x55, 0xAB, 0xD3, 0x85, 0xB0, 0x4C, 0x88, 0x24, 0x5D, 0x50, 0x1D,
-    0xF7, 0x9A, 0x58, 0x6D, 0x46, 0xBF, 0x22, 0xD0, 0xA6, 0x04, 0xE7, 0x46, 0x62, 0xD5, 0xD7, 0x70,
-    0xC1, 0xDF, 0x48, 0xCC, 0x49, 0x84, 0x7B, 0x56, 0x7F, 0x39, 0x3C, 0x43, 0x56, 0xC8, 0x8C, 0xCF,
-    0x48, 0x18, 0x53, 0xC5, 0x4F, 0x5B, 0x44, 0xF9, 0x74, 0x40, 0xC6, 0xF7, 0x7E, 0xC1, 0x20, 0xAD,
-    0x1D, 0x65, 0x0D, 0xA6, 0x03, 0x3D, 0xEC, 0x42, 0xD6, 0x96, 0xD8, 0xD6, 0x91, 0xF1, 0x55, 0xD2,
-    0x56, 0xB9, 0xFC, 0x5F, 0x14, 0x0B, 0xA6, 0x4C, 0x5A, 0x1A, 0x5C, 0x0E, 0x79, 0xAE, 0x17, 0xC8,
-    0x2D, 0x81, 0xC1, 0x72, 0xF9, 0xBC, 0xAD, 0x0F, 0x22, 0x8B, 0x04, 0x0C, 0x66, 0x66, 0x24, 0xD4,
-    0xA4, 0xB1, 0x03, 0x2B, 0x73, 0xBA, 0xE7, 0x9E, 0xF4, 0x5D, 0xA9, 0xFD, 0x5A, 0xD7, 0xCC, 0xC8,
-    0x19, 0xF6, 0x90, 0x59, 0x87, 0x77, 0xC0, 0xC1, 0x94, 0x79, 0xB9, 0x61, 0x99, 0x87, 0x31, 0x3B,
-    0xAE, 0x40, 0x66, 0x58, 0x77, 0x62, 0xCD, 0x2C, 0xCB, 0xA1, 0xA3, 0x74, 0xAF, 0x0F, 0xC6, 0xCA,
-    0x42, 0xC1, 0xA2, 0xEE, 0x49, 0xB8, 0x28, 0x34, 0xCB, 0x72, 0x18, 0x98, 0x99, 0xBA, 0x7F, 0x33,
-    0x0F, 0xDE, 0x7D, 0xAB, 0x0C, 0x77, 0x76, 0x4A, 0xFD, 0x32, 0xEC, 0x54, 0xBF, 0x54, 0x3D, 0x08,
-    0x78, 0x5A, 0x92, 0x7F, 0x70, 0x10, 0x63, 0xDF, 0xC2, 0x19, 0x8D, 0x48, 0x1D, 0xA0, 0x79, 0xD6,
-    0xBE, 0x91, 0xB3, 0x37, 0x3C, 0xA1, 0xC7, 0x95, 0xA4, 0x1E, 0xAE, 0xC9, 0xA7, 0xF4, 0x2E, 0xC1,
-    0xDC, 0xE6, 0x38, 0x9D, 0x90, 0x65, 0x32, 0xFE, 0x93, 0xC6, 0x1D, 0xFE, 0xE2, 0x0B, 0xE0, 0x41,
-    0xAC, 0x1A, 0xA9, 0xE2, 0xFD, 0xAC, 0x95, 0xF6, 0x5F, 0xC9, 0x3D, 0x49, 0x01, 0x82, 0x2C, 0x58,
-    0x1A, 0x88, 0x0E, 0x8E, 0x99, 0x72, 0xC3, 0xC9, 0x4D, 0xB3, 0x85, 0xD3, 0xBD, 0x00, 0x6A, 0x02,
-    0xAD, 0xC4, 0xE7, 0x59, 0xB1, 0xFC, 0x29, 0x7B, 0x99, 0xD8, 0xD3, 0x4D, 0xF6, 0x43, 0xA4, 0x93,
-    0xD5, 0x93, 0x29, 0x20, 0xD7, 0x07, 0xA0, 0x00, 0x39, 0xC9, 0xA9, 0x6A, 0x29, 0x0B, 0x4B, 0x1D,
-    0xC1, 0x1F, 0xD3, 0x03, 0x5B, 0x3A, 0x2A, 0xED, 0x08, 0x21, 0x1B, 0x1D, 0x28, 0x90, 0xF9, 0x7D,
-    0x42, 0x58, 0x89, 0x58, 0xAC, 0xF3, 0x07, 0x1A, 0x55, 0x91, 0x22, 0x9E, 0xC4, 0x35, 0x68, 0x30,
-    0x68, 0x28, 0x52, 0x2F, 0xCB, 0x06, 0x56, 0xC6, 0xAA, 0x61, 0xDC, 0x40, 0xF9, 0xC1, 0x50, 0x94,
-    0xAE, 0xEE, 0xEC, 0xFA, 0x4D, 0xDA, 0x99, 0xA7, 0x14, 0x2D, 0xFA, 0x09, 0x40, 0xF0, 0xE2, 0xFE,
-    0x0D, 0xE9, 0xF0, 0x36, 0x51, 0xD1, 0x7B, 0x9B, 0x6A, 0xC5, 0x6B, 0x83, 0x3A, 0xAC, 0xC0, 0x5A,
-    0x5F, 0x6C, 0xD5, 0x6A, 0x0C, 0xC9, 0x7B, 0x06, 0x54, 0xF9, 0x38, 0xE9, 0x8C, 0x75, 0xDD, 0x35,
-    0xF8, 0x62, 0x8E, 0x2D, 0xE9, 0x1D, 0xA6, 0xAD, 0x29, 0x70, 0x6A, 0xD1, 0xA1, 0xFF, 0xA1, 0x5C,
-    0xFC, 0x12, 0xB4, 0x25, 0xF7, 0xA7, 0x32, 0x99, 0xEB, 0x00, 0x17, 0xB3, 0x46, 0xEC, 0x30, 0x55,
-    0x6B, 0x83, 0x7E, 0x6A, 0xB7, 0xB8, 0xAE, 0x45, 0x3A, 0x51, 0x49, 0xEB, 0xAA, 0x8B, 0xAE, 0x2C,
-    0x34, 0x55, 0xD0, 0xD5, 0x0F, 0x64, 0x51, 0x36, 0xAC, 0x0A, 0x49, 0xEF, 0x1B, 0x35, 0xAE, 0x5F,
-    0x64, 0x20, 0x61, 0xD2, 0xC5, 0x6F, 0x09, 0xB1, 0x8D, 0x5B, 0x82, 0xDF, 0x5C, 0x81, 0xA1, 0x44,
-    0xD2, 0xAE, 0x87, 0x95, 0xF2, 0xBD, 0xEC, 0x57, 0x4B, 0xAC, 0xA2, 0xA4, 0xAC, 0x62, 0xFB, 0x9F,
-    0x5B, 0xCA, 0x97, 0x75, 0x3C, 0xDB, 0x83, 0x4B, 0x20, 0x0C, 0xE1, 0x1F, 0xF4, 0x9A, 0x7C, 0xB8,
-    0xA6, 0x73, 0x86, 0xBA, 0x44, 0xD0, 0x72, 0x71, 0xDF, 0x4D, 0x18, 0xEA, 0x6A, 0xE9, 0xAB, 0x0E,
-    0x13, 0x61, 0xE4, 0x86, 0x59, 0x72, 0x98, 0x4A, 0x7A, 0xB5, 0x2A, 0xEE, 0xB3, 0xC0, 0xC9, 0x8A,
-    0x4E, 0x58, 0x87, 0x8D, 0x07, 0xD2, 0xAE, 0x58, 0x00, 0x04, 0x99, 0x80, 0x4F, 0xC5, 0x97, 0x69,
-    0x9C, 0x99, 0xDB, 0xBC, 0x47, 0x46, 0x50, 0x2D, 0x10, 0x4B, 0xC3, 0x3F, 0xF0, 0xE8, 0x3A, 0x40,
-    0x46, 0xF3, 0x04, 0xBE, 0x87, 0xE0, 0xAA, 0xF3, 0x04, 0x29, 0xDF, 0x57, 0x2C, 0xDF, 0x5B, 0x5A,
-    0x76, 0xB6, 0x63, 0xDF, 0x1C, 0xA5, 0x7C, 0xDF, 0x4B, 0xA6, 0xF7, 0x1B, 0x7B, 0x81, 0x75, 0xB2,
-    0x71, 0xBF, 0x7C, 0x9F, 0xBA, 0xCA, 0x7C, 0xE5, 0xCA, 0xF7, 0x9D, 0x2B, 0xDF, 0x8F, 0x0F, 0x96,
-    0xEF, 0x67, 0x35, 0xFE, 0x6E, 0x2A, 0xDF, 0xD7, 0x52, 0xBE, 0x7F, 0xDB, 0xB2, 0xD7, 0xFD, 0x52,
-    0x6F, 0x06, 0x29, 0xDF, 0x5F, 0x41, 0xE2, 0x82, 0x78, 0xDC, 0xE9, 0x89, 0x4A, 0x4A, 0x57, 0x68,
-    0xDA, 0xF3, 0x81, 0xDE, 0x10, 0xFC, 0x2F, 0x39, 0x85, 0xFC, 0x25, 0x78, 0x77, 0x84, 0xB2, 0x7A,
-    0xBB, 0x9C, 0xAA, 0x38, 0xBB, 0x91, 0xBA, 0xDE, 0xB1, 0x92, 0x1F, 0x31, 0x57, 0x10, 0x43, 0x15,
-    0x4F, 0x4D, 0x6E, 0xDD, 0x42, 0x5E, 0x7C, 0xF5, 0x5D, 0x40, 0xC2, 0x95, 0xD6, 0x75, 0xAF, 0x64,
-    0xE9, 0x27, 0x27, 0xB4, 0xF8, 0xE2, 0xBD, 0x82, 0x5B, 0x07, 0x7B, 0x05, 0x07, 0x02, 0xED, 0xA3,
-    0xD2, 0xD6, 0xFA, 0x68, 0x4F, 0xE2, 0x82, 0xED, 0x37, 0xFE, 0xAC, 0x89, 0x1A, 0x74, 0xF8, 0x80,
-    0x54, 0xE5, 0x8B, 0x47, 0x55, 0xE5, 0xCB, 0xCF, 0xAB, 0xCA, 0x93, 0x81, 0x4E, 0x55, 0xF9, 0x33,
-    0xD6, 0xB7, 0x77, 0x2B, 0xC9, 0x69, 0x95, 0x10, 0xA5, 0x3D, 0x45, 0x2D, 0x20, 0xC7, 0x4B, 0x94,
-    0x5E, 0x4E, 0xC3, 0x1B, 0x69, 0xC0, 0xBE, 0x7A, 0x4E, 0x7E, 0x68, 0x58, 0x39, 0x51, 0xD1, 0xAD,
-    0x1A, 0xFA, 0xF3, 0xDA, 0xEC, 0xBF, 0xB0, 0x70, 0x4A, 0x8A, 0x7D, 0x20, 0x10, 0x12, 0x17, 0x40,
-    0x57, 0x52, 0xD8, 0x51, 0xC2, 0x7E, 0x12, 0xA0, 0x21, 0xB8, 0x2B, 0x6D, 0x84, 0x4B, 0xB0, 0x01,
-    0x7D, 0xE3, 0x02, 0xD2, 0xA0, 0xFE, 0xFE, 0xE8, 0x2A, 0xD4, 0xD4, 0xBB, 0x64, 0x26, 0x10, 0x36,
-    0xFA, 0x98, 0x27, 0x3D, 0x2E, 0x1A, 0x20, 0xD7, 0xF5, 0xA7, 0x2C, 0xBB, 0xEB, 0xD2, 0xC4, 0x50,
-    0x59, 0x8F, 0x68, 0xEB, 0xAF, 0xAF, 0xA9, 0xD7, 0x41, 0x46, 0x98, 0xB9, 0x02, 0xC6, 0xFC, 0xFF,
-    0xC6, 0x19, 0xFE, 0xD7, 0x20, 0xA5, 0x37, 0x9E, 0x95, 0xC6, 0xAE, 0x92, 0x05, 0xD7, 0xCE, 0x3D,
-    0x47, 0xE0, 0x94, 0xF6, 0xC5, 0xF2, 0x3B, 0x3C, 0x87, 0x1B, 0x7F, 0x6A, 0xFB, 0xA2, 0xFF, 0x54,
-    0xFB, 0x02, 0xA7, 0x0B, 0xA9, 0x33, 0x37, 0x9E, 0x60, 0x84, 0x31, 0x31, 0x7E, 0xDF, 0xEE, 0xBD,
-    0x7B, 0x3D, 0xF9, 0x27, 0x65, 0xE7, 0xF0, 0x06, 0x54, 0xC6, 0x4A, 0xB5, 0xDA, 0xCE, 0x1A, 0x73,
-    0x61, 0x8C, 0xAF, 0xB3, 0x26, 0x02, 0x81, 0x32, 0x0B, 0x4A, 0xB2, 0x64, 0xF5, 0x97, 0x26, 0x90,
-    0xE9, 0x56, 0x8F, 0x6C, 0x2D, 0xAA, 0xD8, 0x28, 0x5D, 0x30, 0xEC, 0x33, 0x58, 0xC0, 0xEE, 0x60,
-    0xA6, 0x09, 0x8E, 0xA1, 0x28, 0xC3, 0xAB, 0xE0, 0x22, 0xB6, 0x7C, 0x68, 0x2F, 0x23, 0xFB, 0xAC,
-    0x5E, 0x46, 0xF0, 0xB9, 0xBD, 0x8C, 0x9E, 0xBD, 0x0C, 0xBA, 0x24, 0xAB, 0xB7, 0xCE, 0xDD, 0xFC,
-    0x8B, 0x7E, 0x13, 0x96, 0x8B, 0x48, 0xA5, 0x2A, 0x9D, 0x03, 0xBE, 0x23, 0xE4, 0x8F, 0xC8, 0x29,
-    0x63, 0xA1, 0xFE, 0xB5, 0xB1, 0x03, 0x3B, 0x8B, 0xDB, 0x3E, 0x88, 0x90, 0x21, 0x0B, 0x49, 0xE9,
-    0x49, 0xA4, 0xC0, 0x52, 0xA4, 0x94, 0x88, 0x08, 0xE9, 0xC6, 0xA5, 0x67, 0x9C, 0x7C, 0xCA, 0x75,
-    0x5B, 0x94, 0x88, 0x27, 0xFF, 0x69, 0x01, 0x0F, 0xF9, 0x4F, 0x24, 0x95, 0xB4, 0x44, 0xCA, 0xF0,
-    0xAE, 0xA9, 0x17, 0xB9, 0x44, 0x52, 0xEF, 0xFF, 0x97, 0x4B, 0x75, 0x5F, 0x1A, 0xEB, 0x8D, 0xCF,
-    0xFF, 0x4C, 0x2D, 0xE4, 0x68, 0xEA, 0xC3, 0x78, 0x0D, 0xEC, 0x07, 0x94, 0x6C, 0x3D, 0x5F, 0x14,
-    0x06, 0x0D, 0x38, 0xA5, 0xCC, 0x38, 0x59, 0x44, 0xEF, 0x2E, 0xA8, 0xA7, 0x61, 0x1A, 0x1E, 0x03,
-    0xA1, 0x3E, 0x04, 0x75, 0x83, 0x45, 0x6F, 0x1F, 0x1C, 0x8A, 0xE9, 0xE5, 0xB6, 0xA3, 0xAB, 0x50,
-    0xA5, 0x74, 0x00, 0x46, 0xBC, 0x4C, 0x0A, 0xF1, 0x09, 0x9B, 0x7F, 0x88, 0x35, 0xAC, 0x1B, 0x05,
-    0x2D, 0x74, 0x50, 0xB1, 0x39, 0x47, 0x72, 0x81, 0x35, 0x0B, 0x60, 0x6E, 0xDC, 0x07, 0xAD, 0xAE,
-    0x40, 0xFA, 0xB6, 0xC2, 0x16, 0x02, 0x25, 0x27, 0x7A, 0x92, 0x81, 0xB2, 0x80, 0x7C, 0x20, 0xB0,
-    0xC0, 0x02, 0x83, 0xB7, 0x75, 0x1F, 0x77, 0x21, 0x12, 0xDA, 0xE8, 0xC1, 0xD6, 0xBC, 0x75, 0x52,
-    0xC1, 0xE1, 0xFA, 0x08, 0x2E, 0xD6, 0x01, 0x6F, 0xB1, 0x58, 0x8B, 0x18, 0x27, 0x33, 0x09, 0x09,
-    0x67, 0x8F, 0xC0, 0x87, 0xE2, 0x92, 0x2C, 0x02, 0xA9, 0xEB, 0x9A, 0xC9, 0x11, 0xB2, 0x0E, 0x2B,
-    0x7B, 0x9F, 0x91, 0x5E, 0x28, 0x24, 0xBD, 0x95, 0x68, 0x0F, 0x02, 0xC6, 0x3E, 0x1C, 0xC2, 0x5F,
-    0xD4, 0x64, 0xD2, 0x88, 0x03, 0x84, 0xD7, 0x7B, 0xA3, 0x21, 0xC2, 0x97, 0xB9, 0x2B, 0xB0, 0xF2,
-    0x02, 0xC1, 0xF4, 0x1E, 0x93, 0x9E, 0x7F, 0x85, 0xDD, 0xDA, 0xA0, 0x0B, 0x2B, 0xEB, 0x23, 0x55,
-    0xCE, 0x54, 0xEF, 0xF5, 0x49, 0xBE, 0xAD, 0x78, 0xB6, 0x27, 0x46, 0x08, 0x72, 0xDD, 0xA6, 0x23,
-    0xC3, 0x1C, 0xF2, 0x4F, 0x97, 0xE1, 0xDB, 0x13, 0xD6, 0xBA, 0x3E, 0x2F, 0x16, 0x3E, 0xB2, 0xD7,
-    0xA7, 0x62, 0x18, 0x0C, 0xC7, 0xA4, 0x0A, 0x47, 0x98, 0x47, 0xBB, 0xAA, 0x4F, 0x36, 0xC7, 0x83,
-    0xAA, 0x4D, 0xBC, 0x66, 0x53, 0x9F, 0x68, 0x4D, 0x70, 0xBD, 0xD3, 0x97, 0xEF, 0xD9, 0x93, 0x88,
-    0x27, 0x35, 0x23, 0x80, 0xF0, 0x9E, 0x1F, 0xA7, 0xFB, 0x9D, 0xA4, 0x7B, 0xAE, 0x93, 0x54, 0x4C,
-    0x9D, 0xA4, 0xE8, 0x0B, 0x75, 0x92, 0xFE, 0xEA, 0x13, 0x9D, 0x24, 0x89, 0x38, 0x62, 0x41, 0xD2,
-    0xAE, 0x9E, 0xFA, 0x45, 0x0F, 0x2F, 0x20, 0x89, 0xDB, 0x9B, 0x2B, 0xC4, 0xFB, 0xC4, 0x56, 0xDF,
-    0xB0, 0xAC, 0x91, 0xB9, 0xF8, 0xC8, 0x19, 0xA5, 0x2B, 0xA4, 0xA3, 0x8C, 0x51, 0x4F, 0xAD, 0x17,
-    0xEB, 0x17, 0x0F, 0x8C, 0x94, 0xD5, 0xD3, 0x9C, 0x4E, 0x32, 0xE3, 0x1B, 0xD2, 0x34, 0x6A, 0x67,
-    0x6F, 0x37, 0x53, 0x84, 0x67, 0xAD, 0x38, 0x18, 0x80, 0xC3, 0xD9, 0xB5, 0x7C, 0xF2, 0x2C, 0x96,
-    0x7B, 0xBC, 0x8B, 0x02, 0x97, 0x2C, 0xB6, 0xFE, 0xDB, 0xEF, 0xD6, 0xD8, 0x66, 0xD8, 0x94, 0x30,
-    0x8F, 0x3C, 0x91, 0xF0, 0xD3, 0x48, 0x96, 0x76, 0xEE, 0x8C, 0x32, 0x2B, 0x42, 0xD2, 0x23, 0x76,
-    0x11, 0x01, 0x17, 0x29, 0x02, 0x6F, 0xCE, 0x4C, 0x28, 0xAE, 0xC0, 0x3F, 0xF3, 0xA4, 0xB2, 0x2A,
-    0x7E, 0x17, 0xA8, 0x7A, 0x7F, 0xC2, 0x4C, 0x82, 0x2E, 0x14, 0x46, 0xF3, 0xA4, 0xAE, 0x18, 0xB1,
-    0xA9, 0x2A, 0x3A, 0x16, 0x39, 0x9F, 0x69, 0xA6, 0x3C, 0xD5, 0xEF, 0x4C, 0x9A, 0x05, 0x1D, 0x8E,
-    0xF6, 0xC5, 0x1E, 0xBF, 0xAB, 0xE4, 0x1A, 0xD8, 0x1F, 0xA9, 0x55, 0xCA, 0x3C, 0x8D, 0x0D, 0x24,
-    0xB2, 0xEF, 0x46, 0xB6, 0x00, 0xD2, 0x32, 0xCD, 0x3C, 0x29, 0xA1, 0x89, 0x14, 0x02, 0x5E, 0x0C,
-    0x8B, 0x87, 0x14, 0xF2, 0x2B, 0xC5, 0xF0, 0x70, 0xE2, 0x2A, 0x66, 0xF3, 0xCA, 0x4E, 0xA9, 0x16,
-    0xDB, 0x60, 0x52, 0xEB, 0x5D, 0x2A, 0x7E, 0x95, 0x8A, 0x28, 0xE2, 0xB6, 0xF1, 0xDE, 0x89, 0x34,
-    0x92, 0x3D, 0xCC, 0xA5, 0x41, 0x2B, 0x79, 0x10, 0xE0, 0xAE, 0x63, 0x6F, 0xEE, 0x7C, 0x07, 0x1B,
-    0xCE, 0x70, 0xDF, 0x6B, 0x15, 0x56, 0xED, 0x5C, 0xFD, 0xCD, 0x13, 0x76, 0xDC, 0x0B, 0x79, 0x48,
-    0x0D, 0xCF, 0xFA, 0xBB, 0xE3, 0xD2, 0x01, 0xE5, 0x4B, 0xE1, 0x11, 0x67, 0x62, 0xDC, 0xA4, 0x17,
-    0x0E, 0x90, 0x33, 0x07, 0x0D, 0xDE, 0x0F, 0xA4, 0x66, 0x5B, 0x6C, 0x54, 0xD3, 0xB4, 0x8E, 0xCB,
-    0x5B, 0xA4, 0x03, 0x9F, 0xC8, 0x69, 0x8C, 0x6A, 0x62, 0x08, 0x32, 0x52, 0x16, 0xDF, 0x25, 0x8C,
-    0xB7, 0xF0, 0x97, 0xB8, 0x83, 0x1E, 0xE2, 0xCE, 0x35, 0xD4, 0xE4, 0xF3, 0x9C, 0xA4, 0x93, 0xC2,
-    0x83, 0x03, 0xC7, 0xE3, 0xC8, 0xD4, 0x0D, 0x7E, 0x8B, 0x4F, 0x31, 0xAF, 0x14, 0xF1, 0xF6, 0xC8,
-    0x22, 0x97, 0x2E, 0xE8, 0x8C, 0x03, 0xFE, 0x24, 0x50, 0x67, 0x13, 0xC1, 0x78, 0x6E, 0x36, 0xD9,
-    0xA4, 0x2F, 0x58, 0x7B, 0xF5, 0xD7, 0x1B, 0xF7, 0xFE, 0xB9, 0x99, 0x9A, 0xB9, 0x8B, 0xCC, 0x05,
-    0x53, 0x70, 0xF1, 0xD2, 0x35, 0x73, 0x15, 0x1D, 0xF9, 0x1C, 0x81, 0x47, 0x26, 0x65, 0xE8, 0x71,
-    0x44, 0xA4, 0xCB, 0xE4, 0x4B, 0xD3, 0xE8, 0x43, 0x3F, 0x0D, 0x12, 0xF1, 0x6C, 0xE6, 0xD2, 0xCC,
-    0x5E, 0x48, 0xEC, 0x6F, 0xCA, 0x45, 0xBF, 0xD2, 0x29, 0x50, 0x7B, 0xC1, 0x6F, 0xBE, 0x86, 0x64,
-    0x34, 0x45, 0x6E, 0x8E, 0x9C, 0x2B, 0x92, 0x52, 0x45, 0x29, 0x92, 0x63, 0x9B, 0x5F, 0x77, 0x62,
-    0x94, 0x49, 0x09, 0xEC, 0xE2, 0xDD, 0xD8, 0xFF, 0x5D, 0x55, 0x99, 0x8F, 0x1C, 0x22, 0x2A, 0x61,
-    0x17, 0xF0, 0xAE, 0x82, 0xA8, 0x00, 0x6D, 0xFD, 0x08, 0xDE, 0x40, 0xA7, 0x26, 0xC9, 0x34, 0xE9,
-    0x54, 0x3C, 0x72, 0xFD, 0x5F, 0x62, 0x88, 0x91, 0x02, 0xE2, 0xB1, 0xE0, 0xDD, 0xFA, 0xF8, 0x42,
-    0x78, 0xB5, 0xDC, 0x7C, 0x5E, 0xBF, 0xFC, 0x62, 0x9B, 0x59, 0xFF, 0x7E, 0xC3, 0x62, 0x6F, 0x89,
-    0x5C, 0x1D, 0x0A, 0x19, 0x49, 0x6C, 0x17, 0x1E, 0xD2, 0x42, 0xBC, 0x7D, 0xB2, 0x79, 0x62, 0x73,
-    0x35, 0xB8, 0x76, 0xA1, 0x5A, 0xB4, 0x07, 0x5B, 0x88, 0xC1, 0xF5, 0x56, 0xAD, 0x24, 0x6A, 0xFE,
-    0xBC, 0x94, 0x70, 0xA7, 0xD2, 0xE4, 0xFB, 0xDF, 0xFC, 0xDB, 0x9F, 0x7D, 0xCD, 0x5E, 0xC5, 0xFE,
-    0x5F, 0xFF, 0xCA, 0x42, 0x70, 0x5A, 0x85, 0xF9, 0x8C, 0x11, 0x7A, 0xAE, 0x84, 0x29, 0xBF, 0x1E,
-    0x10, 0x95, 0xB3, 0x38, 0xF8, 0x36, 0x23, 0x32, 0x57, 0xDC, 0x16, 0x7A, 0x85, 0x2A, 0xF3, 0x41,
-    0x6D, 0x73, 0x8A, 0x92, 0x2D, 0x72, 0xEC, 0x52, 0x9D, 0x39, 0x50, 0x97, 0xE0, 0xE6, 0xA2, 0x03,
-    0xEB, 0xB8, 0xBA, 0x84, 0xB7, 0x5F, 0x97, 0xF0, 0x1E, 0x5D, 0x97, 0x00, 0x13, 0xF5, 0xBE, 0x4F,
-    0xE8, 0x00, 0x63, 0x03, 0x18, 0x10, 0x2A, 0xC7, 0x93, 0xA3, 0xCF, 0x51, 0xC7, 0x56, 0x75, 0x1E,
-    0xAB, 0x9B, 0x3D, 0x1B, 0xC7, 0x8C, 0x30, 0x99, 0xFC, 0xB4, 0xF6, 0xC3, 0x67, 0x5C, 0x36, 0xEF,
-    0x50, 0x83, 0xE5, 0xF2, 0xF9, 0x4A, 0x66, 0x08, 0xAA, 0x89, 0x43, 0x4D, 0x5D, 0x93, 0xD0, 0x4D,
-    0xC0, 0x3C, 0xCE, 0x7C, 0x65, 0xBE, 0x8D, 0x53, 0x6D, 0x5F, 0x1A, 0xCF, 0x56, 0x4D, 0x66, 0xDF,
-    0xDF, 0x52, 0xCB, 0x6E, 0x24, 0xB6, 0x52, 0xE3, 0x4F, 0xA4, 0xF6, 0xA3, 0xE2, 0xF7, 0xBE, 0xCA,
-    0xE0, 0x95, 0xCA, 0x64, 0x9A, 0x6F, 0x73, 0x0A, 0xF6, 0x03, 0x0A, 0x06, 0x33, 0x37, 0x0F, 0x0A,
-    0xD6, 0xED, 0x09, 0x36, 0x77, 0x50, 0xB0, 0x82, 0x63, 0x3F, 0xCA, 0x35, 0x0C, 0x27, 0xC1, 0xD6,
-    0xE6, 0xEB, 0x47, 0x0A, 0x16, 0x96, 0x87, 0x67, 0xC3, 0x74, 0xCE, 0x49, 0x88, 0x63, 0x4A, 0xBD,
-    0xAA, 0xE6, 0xDF, 0x4B, 0x70, 0xD3, 0x49, 0xD4, 0xDF, 0xED, 0x8B, 0xEA, 0xED, 0x9E, 0x79, 0x40,
-    0x54, 0x19, 0xA2, 0xF3, 0x7E, 0x0D, 0x68, 0xFF, 0xA5, 0x2B, 0xA2, 0xCF, 0xC6, 0x2D, 0xFF, 0x88,
-    0xB9, 0xCD, 0xFD, 0xAF, 0xD6, 0x49, 0x12, 0x4F, 0xED, 0xC9, 0x69, 0x24, 0xF2, 0xC1, 0x3C, 0xF8,
-    0xB3, 0xBF, 0xFE, 0x7F, 0x0C, 0x2D, 0x1D, 0xF8, 0x5A, 0x74, 0xD9, 0x4F, 0x30, 0xED, 0xC5, 0x4C,
-    0x39, 0x51, 0x51, 0x7D, 0xCE, 0x46, 0xE6, 0xCE, 0x1C, 0x4E, 0x0F, 0x23, 0xA1, 0x29, 0xCE, 0x77,
-    0xBA, 0xB6, 0x32, 0xE5, 0xD7, 0x63, 0x63, 0xF1, 0xED, 0x3E, 0x61, 0xE2, 0x56, 0xFC, 0x6C, 0xE7,
-    0xAE, 0xB8, 0x73, 0x5F, 0x48, 0xD4, 0xB2, 0xD7, 0x64, 0xE1, 0x6C, 0x94, 0x1A, 0x7C, 0x20, 0xB6,
-    0x20, 0xE7, 0x5D, 0x4D, 0x45, 0x1A, 0x02, 0xF8, 0x68, 0x6F, 0xB1, 0xB8, 0x6A, 0x2F, 0xF4, 0x05,
-    0x87, 0xAD, 0x6B, 0xBB, 0x83, 0x03, 0x85, 0xCC, 0xB0, 0x27, 0x04, 0x8D, 0xCB, 0x23, 0x1C, 0x08,
-    0xEE, 0xDE, 0x58, 0x8E, 0x4F, 0x22, 0x49, 0x60, 0x95, 0xA1, 0xE0, 0x69, 0xA4, 0x12, 0x9B, 0x02,
-    0xAC, 0xE5, 0xC9, 0x00, 0xD9, 0x06, 0x51, 0xDF, 0x72, 0x22, 0x81, 0x93, 0x9A, 0x2D, 0x47, 0x21,
-    0x7C, 0x0E, 0xEC, 0x2C, 0x31, 0x63, 0x9F, 0x97, 0xC2, 0x5D, 0x29, 0x05, 0x4A, 0xB5, 0x7A, 0xE0,
-    0xE4, 0x2E, 0x6D, 0xAA, 0x8F, 0x1A, 0x75, 0xB7, 0x02, 0xF9, 0x03, 0xAF, 0x0D, 0xC9, 0xCD, 0x73,
-    0x7D, 0xAA, 0x8A, 0x83, 0x3A, 0x09, 0x6A, 0x30, 0x0D, 0xB5, 0x2C, 0x09, 0xD6, 0x54, 0xD2, 0x7F,
-    0xF8, 0x70, 0x52, 0x01, 0x98, 0x7E, 0x70, 0x38, 0x09, 0xF8, 0x07, 0xF0, 0xC3, 0x62, 0x7C, 0x7B,
-    0x0C, 0x39, 0x43, 0xC8, 0x21, 0x24, 0x6D, 0x9F, 0xB2, 0x29, 0x29, 0x4F, 0xD2, 0x4F, 0x93, 0x2F,
-    0x92, 0xBE, 0xCF, 0x86, 0x22, 0x91, 0x14, 0x66, 0xA3, 0xDA, 0x3C, 0xAE, 0xBA, 0x15, 0xD5, 0x5E,
-    0xF2, 0x9B, 0x36, 0x78, 0xA7, 0x09, 0xAE, 0x34, 0xD1, 0x4E, 0x9D, 0x9C, 0xEC, 0x33, 0xF2, 0xB7,
-    0x66, 0xBF, 0x72, 0xFB, 0xE5, 0x8C, 0x1E, 0xE5, 0x7B, 0x74, 0xBD, 0x24, 0xE5, 0x2D, 0x67, 0x6D,
-    0x29, 0xA1, 0xC2, 0x32, 0x9E, 0x43, 0xAB, 0x5B, 0x9E, 0x8A, 0x99, 0xA0, 0xC3, 0xA5, 0x01, 0x7B,
-    0xAF, 0x35, 0x72, 0x28, 0x61, 0xEF, 0xC8, 0x1E, 0xE2, 0xDC, 0xCC, 0xD8, 0x3B, 0x56, 0x5E, 0x85,
-    0x12, 0xAA, 0xC4, 0x95, 0x91, 0x99, 0x57, 0x20, 0x99, 0xFB, 0xF9, 0x9F, 0x6F, 0x54, 0x2A, 0x9F,
-    0xE4, 0x15, 0xF2, 0xC6, 0xCA, 0xD2, 0x34, 0x11, 0xC3, 0xE3, 0x8A, 0x85, 0x10, 0x00, 0x18, 0x3A,
-    0x8E, 0x28, 0x1F, 0xE7, 0x4C, 0xA5, 0x93, 0xBD, 0x3C, 0x87, 0x38, 0x56, 0x25, 0xA9, 0x54, 0x0F,
-    0xAD, 0xC8, 0x9E, 0x0E, 0x61, 0x43, 0x0A, 0xB6, 0xED, 0x66, 0xAF, 0x3B, 0x87, 0xD8, 0xAE, 0x68,
-    0xCF, 0x2E, 0xE7, 0x80, 0x43, 0x24, 0xC4, 0xE7, 0x71, 0xB9, 0xA5, 0xB6, 0xD9, 0xB4, 0xD4, 0xF8,
-    0x95, 0x51, 0x8D, 0xFD, 0x50, 0x22, 0xD0, 0x0F, 0x8B, 0xBD, 0xC6, 0xD7, 0x0C, 0xED, 0x93, 0x5A,
-    0xD0, 0x2E, 0x78, 0x6F, 0xCA, 0x9E, 0x95, 0x7A, 0xCC, 0x0B, 0x4F, 0xBC, 0x59, 0xFE, 0xB2, 0x5A,
-    0xF8, 0xC7, 0x6F, 0x7D, 0x33, 0x3E, 0x65, 0xCB, 0xB1, 0x01, 0x38, 0x01, 0x7D, 0x4B, 0x4E, 0x31,
-    0x73, 0xB4, 0x03, 0xE8, 0x00, 0xB1, 0x91, 0x9D, 0x71, 0xF2, 0x26, 0x07, 0xEF, 0x47, 0x82, 0x9B,
-    0x01, 0x9D, 0x38, 0xCB, 0xEB, 0xDB, 0x46, 0xBA, 0xBF, 0x97, 0x65, 0xC0, 0xFD, 0x34, 0xF2, 0xDF,
-    0x71, 0x28, 0x0A, 0xA5, 0x6F, 0x92, 0xB0, 0x9B, 0x65, 0x7B, 0x03, 0x9C, 0x2B, 0x1B, 0x60, 0x66,
-    0x1F, 0xD9, 0x8F, 0xA1, 0xE7, 0xAB, 0xF6, 0x6C, 0xE3, 0x8D, 0xBA, 0x2F, 0xCA, 0xA8, 0x33, 0x3B,
-    0x44, 0xB5, 0x31, 0x6E, 0xA9, 0xA7, 0x42, 0x7C, 0x5D, 0xE8, 0x92, 0xA8, 0xCD, 0x71, 0x29, 0x37,
-    0x4E, 0x2C, 0x2A, 0x74, 0x9A, 0x53, 0xFB, 0x13, 0x28, 0x03, 0x0B, 0x3E, 0x7E, 0xEF, 0x8F, 0x61,
-    0x17, 0x8C, 0x9C, 0x19, 0x49, 0x90, 0x16, 0x99, 0x46, 0x17, 0xF7, 0x6B, 0xBD, 0x71, 0xB7, 0x8E,
-    0x97, 0x6F, 0x56, 0x49, 0x7C, 0xAD, 0x34, 0xF1, 0xD9, 0x32, 0x9B, 0x93, 0xC9, 0xCE, 0xDA, 0xB5,
-    0x06, 0x08, 0xDB, 0x8C, 0x82, 0xE7, 0xA8, 0xD9, 0x81, 0x29, 0x80, 0xDF, 0x71, 0x52, 0x88, 0xFD,
-    0x5E, 0x36, 0x12, 0xA5, 0xCF, 0x9B, 0x9A, 0xF4, 0xD8, 0x9E, 0x3B, 0x6E, 0xB2, 0xF8, 0x2B, 0x95,
-    0xC0, 0x50, 0x80, 0x2D, 0xAB, 0x1F, 0xC0, 0x1F, 0x19, 0x1D, 0x92, 0x69, 0x6D, 0xCF, 0x9D, 0x3D,
-    0xDF, 0xDE, 0x16, 0xDE, 0x22, 0xC4, 0xE5, 0x74, 0xE9, 0x66, 0x77, 0x71, 0x77, 0x8E, 0xD1, 0x73,
-    0x7A, 0x35, 0xE2, 0xC1, 0xCA, 0xF8, 0x2E, 0xE9, 0xCE, 0x54, 0x24, 0x95, 0xAE, 0xA0, 0x74, 0x56,
-    0x18, 0x59, 0x49, 0xEE, 0x4C, 0xB5, 0xD7, 0x10, 0xDA, 0xA4, 0x9F, 0xE7, 0xAE, 0xC2, 0x93, 0x7C,
-    0xB2, 0x19, 0x16, 0xDD, 0xAD, 0x1D, 0x6C, 0x72, 0x5A, 0x8A, 0x6D, 0x05, 0x76, 0x41, 0xC1, 0xDC,
-    0xC0, 0x9A, 0xB9, 0x65, 0xD6, 0x4C, 0x63, 0x37, 0xCF, 0x3A, 0x0D, 0x93, 0x24, 0x1F, 0x08, 0xF6,
-    0x35, 0xFD, 0xF4, 0x23, 0xBA, 0xCD, 0x94, 0xEF, 0xDD, 0x07, 0x1F, 0x05, 0x18, 0x66, 0xDB, 0x92,
-    0x09, 0x02, 0xF6, 0xAA, 0x64, 0x1E, 0xD9, 0xED, 0x6A, 0x10, 0x4A, 0xC4, 0x5A, 0x10, 0x27, 0x92,
-    0x65, 0x53, 0x1C, 0x49, 0x96, 0xA9, 0x58, 0x99, 0x49, 0x96, 0x3D, 0xC9, 0x50, 0x32, 0xE0, 0x04,
-    0x34, 0x1A, 0xBC, 0xB5, 0x9A, 0xB6, 0xF4, 0xEA, 0x11, 0x50, 0x7D, 0x12, 0xD9, 0xAB, 0xB0, 0xAC,
-    0x77, 0x61, 0x4F, 0x9D, 0xFD, 0xF4, 0x7E, 0x34, 0x27, 0xE2, 0x6E, 0x82, 0x5A, 0xC2, 0xB9, 0xB9,
-    0x1D, 0xBF, 0x06, 0xD0, 0x70, 0x9C, 0x6B, 0x81, 0x73, 0xAA, 0x33, 0x3A, 0x20, 0x0D, 0xF5, 0x5D,
-    0x41, 0x70, 0x7F, 0x5D, 0xF0, 0x3D, 0x70, 0x09, 0x74, 0xE0, 0xD2, 0x69, 0xDF, 0xC5, 0x29, 0xCF,
-    0x81, 0xBC, 0x37, 0xB8, 0xD0, 0xD2, 0x17, 0x62, 0x46, 0x83, 0xD4, 0x8F, 0xD5, 0x76, 0x24, 0x51,
-    0xAC, 0x90, 0x18, 0xAD, 0x32, 0x4F, 0x62, 0xA8, 0xEC, 0x43, 0xFE, 0xAB, 0xDD, 0x7F, 0xE3, 0x7A,
-    0x2E, 0xD1, 0x81, 0x63, 0x38, 0xB5, 0x44, 0x0D, 0xE6, 0xE8, 0x4C, 0xC6, 0xDA, 0x89, 0x2C, 0x3C,
-    0xD8, 0x47, 0xBC, 0xF1, 0xB2, 0x3B, 0x5C, 0xB8, 0xC1, 0x86, 0xBD, 0x8E, 0x6C, 0x53, 0x0F, 0xCF,
-    0x36, 0x31, 0x79, 0x7D, 0x79, 0x89, 0xD7, 0x05, 0x65, 0x70, 0xE7, 0x0C, 0xCE, 0x07, 0xB0, 0x04,
-    0x56, 0x6B, 0x77, 0x37, 0xF8, 0x22, 0x07, 0xA8, 0x09, 0x32, 0xFE, 0x98, 0x65, 0x7B, 0x87, 0x11,
-    0x81, 0xB4, 0xBA, 0x69, 0xB8, 0xC8, 0x4D, 0x93, 0xE4, 0x0F, 0x0D, 0x83, 0xB1, 0xCB, 0xFA, 0xE5,
-    0x21, 0x89, 0x3F, 0x38, 0xCE, 0x2C, 0xB3, 0x4D, 0x72, 0x8E, 0x52, 0xB7, 0x95, 0x99, 0x66, 0xD9,
-    0x65, 0x48, 0x63, 0x91, 0x3C, 0x4F, 0x8A, 0xC6, 0x7C, 0x76, 0x48, 0x6A, 0xCE, 0x6E, 0xDB, 0xF2,
-    0x23, 0xDB, 0x9F, 0xF6, 0x62, 0xB7, 0x47, 0x9A, 0x02, 0x34, 0xBE, 0x47, 0x86, 0x63, 0x79, 0x7A,
-    0x00, 0xE9, 0xC0, 0x6E, 0x9C, 0xFA, 0xBB, 0xDF, 0xAB, 0x09, 0x42, 0xF2, 0x44, 0x11, 0x7B, 0xB1,
-    0xF4, 0x3B, 0x36, 0x63, 0x27, 0x0B, 0x24, 0xFB, 0x7A, 0x6F, 0x6F, 0xCA, 0x50, 0x9A, 0x04, 0x52,
-    0xEA, 0x2E, 0x65, 0x3E, 0xFE, 0xDC, 0x77, 0x78, 0x1F, 0xCF, 0xA5, 0x98, 0x87, 0xD7, 0x5F, 0x1B,
-    0x83, 0x69, 0x94, 0x40, 0x66, 0xDC, 0x53, 0x43, 0x4C, 0x6E, 0x43, 0xA0, 0xF2, 0xFD, 0x89, 0xFE,
-    0x79, 0xC5, 0x2C, 0x31, 0x9F, 0x23, 0x31, 0xAD, 0x38, 0xF4, 0x9E, 0xD9, 0xFE, 0x50, 0xBA, 0xCC,
-    0x0E, 0xE1, 0xDC, 0xB3, 0x1B, 0x48, 0x70, 0x3B, 0x9C, 0x9D, 0x7F, 0x07, 0x31, 0xF4, 0xE9, 0x8E,
-    0x64, 0xC9, 0x9F, 0xEA, 0x04, 0x1C, 0x23, 0xF2, 0x7A, 0x66, 0x62, 0x6F, 0x70, 0x50, 0x71, 0xFC,
-    0xC4, 0x9E, 0xBE, 0x54, 0xE1, 0x3C, 0xF6, 0x71, 0x39, 0xF7, 0x33, 0x70, 0x86, 0xD4, 0x5F, 0x8B,
-    0x05, 0x12, 0x0E, 0x3F, 0x5B, 0xF8, 0xAE, 0x6B, 0x5D, 0x26, 0xCF, 0x6C, 0xAB, 0x73, 0xB4, 0x2A,
-    0xB6, 0x85, 0xD7, 0x94, 0x21, 0x13, 0x5C, 0x15, 0xB7, 0xCC, 0x7E, 0x26, 0x5A, 0x4F, 0x4E, 0xC9,
-    0x7F, 0xE2, 0xB2, 0x34, 0x55, 0x37, 0x24, 0xB7, 0xDF, 0x55, 0xFD, 0xFC, 0xAF, 0x18, 0xB4, 0x58,
-    0x1E, 0xA8, 0xE1, 0xA3, 0x15, 0x44, 0xD9, 0x8C, 0x54, 0x49, 0x65, 0x6F, 0xD8, 0xD3, 0x32, 0xFF,
-    0x5A, 0x7C, 0x2C, 0xF9, 0xFE, 0x8D, 0xB1, 0x90, 0x00, 0x66, 0x6F, 0x49, 0x4E, 0x38, 0x71, 0xA4,
-    0xC2, 0x71, 0xC0, 0x70, 0xB2, 0xF6, 0xCC, 0x71, 0xCF, 0xC4, 0x31, 0x27, 0xED, 0x4A, 0xDE, 0xA1,
-    0x98, 0x3C, 0x36, 0xFA, 0xF6, 0xAE, 0x4C, 0x0A, 0xB7, 0xF6, 0x14, 0x8D, 0x69, 0xD0, 0x8D, 0xE1,
-    0x93, 0x05, 0x27, 0xEC, 0xE4, 0x91, 0xD2, 0x8A, 0x17, 0x13, 0x75, 0x8F, 0x73, 0xE9, 0xB7, 0xE4,
-    0x65, 0x7F, 0x28, 0x3E, 0x8F, 0xC1, 0xAE, 0xFB, 0xAF, 0xCC, 0x5F, 0x3C, 0x96, 0xCA, 0x7C, 0x16,
-    0xA1, 0xE5, 0xCD, 0x2E, 0xDE, 0x91, 0xF9, 0xAC, 0x2B, 0x84, 0x91, 0x68, 0x9A, 0xCF, 0x32, 0x0F,
-    0x9F, 0xCF, 0x32, 0x5F, 0x6C, 0x3E, 0xAB, 0x3F, 0x38, 0x9F, 0xE5, 0xB7, 0x5B, 0xA2, 0xF2, 0xF0,
-    0xA3, 0xFE, 0x91, 0xBA, 0x06, 0xFD, 0x94, 0xA9, 0x55, 0x92, 0xD6, 0xBF, 0x60, 0x72, 0xC5, 0xEF,
-    0xE5, 0x52, 0xE8, 0x0A, 0xDB, 0x3E, 0xAC, 0xA9, 0x4B, 0xD4, 0xC9, 0xD4, 0xE3, 0x60, 0x15, 0xC9,
-    0xC6, 0x20, 0xCD, 0x2B, 0x06, 0x95, 0xA3, 0x33, 0xCE, 0x4E, 0x5B, 0xC4, 0x99, 0xFB, 0x7D, 0x31,
-    0x83, 0x62, 0xA2, 0x2F, 0x8B, 0xEC, 0xEA, 0xDB, 0x8A, 0xF5, 0x6A, 0x72, 0x32, 0x96, 0x38, 0xFC,
-    0x5A, 0x3D, 0xA6, 0x53, 0x25, 0x6C, 0xBA, 0x52, 0xF3, 0xBB, 0xD3, 0xE5, 0x96, 0x65, 0xBA, 0xF2,
-    0xD0, 0x6B, 0xBD, 0xB4, 0x83, 0xC8, 0x80, 0x6B, 0x69, 0x03, 0x01, 0x49, 0xBC, 0xB3, 0xE5, 0xD4,
-    0xBE, 0x0C, 0xCF, 0xF7, 0x7C, 0x8C, 0x2F, 0xC1, 0x8D, 0x91, 0xBB, 0xAB, 0x7F, 0x98, 0xFA, 0x0D,
-    0x6C, 0x79, 0xF6, 0xFE, 0x3A, 0x0D, 0x2F, 0x85, 0x71, 0xFB, 0x6C, 0xB3, 0xA4, 0x8C, 0xF2, 0x73,
-    0x85, 0x78, 0x2F, 0xC2, 0xE3, 0xC9, 0x3E, 0x12, 0x36, 0x25, 0xD5, 0x84, 0xEF, 0xEF, 0x1F, 0x87,
-    0xD4, 0x63, 0x24, 0xBB, 0xF9, 0xFD, 0x01, 0x7D, 0xFC, 0x59, 0xA6, 0xFB, 0xD5, 0xDC, 0xB3, 0xE9,
-    0x54, 0x39, 0xEB, 0xD4, 0xE1, 0xA5, 0x07, 0x8F, 0x40, 0xEA, 0x09, 0x6C, 0xE7, 0xAD, 0xB2, 0x28,
-    0xF9, 0x14, 0xE2, 0xCE, 0x15, 0x5B, 0xB3, 0x9F, 0xED, 0xDD, 0xEB, 0x7B, 0xC4, 0x63, 0xC3, 0xD9,
-    0xFA, 0x9C, 0x0D, 0xED, 0x70, 0x08, 0x1A, 0x7F, 0x84, 0x50, 0xEB, 0xEA, 0x47, 0xDC, 0xBC, 0x3C,
-    0xD9, 0x96, 0x4D, 0x01, 0x30, 0xFB, 0x59, 0xFD, 0xE7, 0x7C, 0x7A, 0xC9, 0x6B, 0xCF, 0x81, 0x30,
-    0x0C, 0x9F, 0x32, 0xA6, 0x3F, 0xA9, 0x17, 0x4F, 0x8B, 0x91, 0x95, 0x14, 0x8D, 0x06, 0xE1, 0xFF,
-    0x81, 0x67, 0xD6, 0x5C, 0x41, 0x29, 0x72, 0xB5, 0x2A, 0x56, 0xCE, 0x3A, 0x1C, 0x2B, 0xA2, 0x95,
-    0x29, 0xA3, 0x16, 0xE0, 0x1F, 0x70, 0x3E, 0x9C, 0xE7, 0xC4, 0xBA, 0x01, 0x9B, 0x69, 0x0C, 0xE3,
-    0x71, 0x05, 0xDA, 0x8B, 0xB7, 0x43, 0x58, 0xC9, 0xDA, 0x59, 0x36, 0x94, 0xDD, 0x93, 0x4B, 0x12,
-    0x6E, 0x5D, 0x54, 0x20, 0xCC, 0xEF, 0xEE, 0x87, 0xEA, 0x2B, 0xFB, 0x46, 0xFB, 0x70, 0xDF, 0x58,
-    0x76, 0x13, 0x35, 0x76, 0x83, 0xD3, 0x74, 0x08, 0xE6, 0xC6, 0x6F, 0x39, 0x92, 0x17, 0xD5, 0x6C,
-    0xE3, 0x02, 0xF9, 0x7C, 0x81, 0xD6, 0xCE, 0xE5, 0xAE, 0x5E, 0x51, 0xBB, 0xA2, 0x26, 0x03, 0x99,
-    0x1E, 0xCF, 0xE2, 0x5D, 0x99, 0x38, 0x0D, 0xFA, 0x88, 0x82, 0x5B, 0x37, 0xD2, 0x65, 0x5F, 0xB4,
-    0xEB, 0xCB, 0x2D, 0xBB, 0xCC, 0xBE, 0xFD, 0xA9, 0xAD, 0xF8, 0xF8, 0xD3, 0xAC, 0x2E, 0x5A, 0x39,
-    0xA2, 0x26, 0xE1, 0xE5, 0x53, 0x43, 0x80, 0xF8, 0x1C, 0xD6, 0x3D, 0xDF, 0x1D, 0xFD, 0xE4, 0x10,
-    0x20, 0xB6, 0x90, 0xAB, 0xE8, 0xB7, 0x1D, 0x79, 0x0D, 0x22, 0xE1, 0xDB, 0xED, 0xC1, 0x10, 0xF0,
-    0x25, 0x4A, 0xC4, 0x03, 0xCB, 0xE2, 0x92, 0x81, 0x46, 0x7F, 0xD0, 0xED, 0xDF, 0x42, 0x66, 0x98,
-    0x28, 0x28, 0x38, 0x94, 0x4C, 0x85, 0xB0, 0x7E, 0x01, 0x55, 0x8F, 0xF3, 0x0C, 0x2B, 0x2C, 0x31,
-    0xCA, 0x83, 0x6E, 0xD1, 0xEE, 0x9E, 0xAD, 0x3B, 0x55, 0xC7, 0x57, 0x9D, 0xB1, 0x4E, 0x07, 0x1F,
-    0xEE, 0x0E, 0x5F, 0x34, 0x10, 0x78, 0x53, 0x1C, 0x97, 0xC7, 0x4B, 0x49, 0xF1, 0xDC, 0xF3, 0x3A,
-    0x85, 0xA3, 0xDC, 0x61, 0xE3, 0xCA, 0xC3, 0xC7, 0x1C, 0x7B, 0x50, 0xDE, 0xD2, 0xF7, 0x5A, 0x87,
-    0x31, 0x33, 0xE8, 0x9F, 0x18, 0xDB, 0x6C, 0x6A, 0x31, 0x96, 0xE4, 0xB9, 0x95, 0xA2, 0xA7, 0x72,
-    0xA8, 0x3A, 0xA3, 0x60, 0xB4, 0xC0, 0x7E, 0x22, 0x28, 0xF9, 0x6C, 0xE2, 0xF9, 0xC1, 0x39, 0x14,
-    0x43, 0xA5, 0x98, 0x6B, 0xF5, 0x04, 0x7B, 0x7F, 0x99, 0x32, 0xE5, 0x7C, 0x62, 0x36, 0xCE, 0x93,
-    0xCE, 0xBF, 0x56, 0xD1, 0x82, 0x58, 0xFD, 0x1F, 0x42, 0x46, 0x5C, 0x00, 0xE8, 0xBE, 0xF2, 0xDC,
-    0x03, 0xD1, 0x32, 0x35, 0xF1, 0xE1, 0xFA, 0x33, 0x8F, 0xD8, 0xEE, 0x43, 0x1E, 0x06, 0xEC, 0xBE,
-    0xE0, 0xC3, 0x80, 0xF1, 0xC3, 0x1F, 0x06, 0x04, 0x16, 0x5D, 0x14, 0xE7, 0xE2, 0xC0, 0x87, 0xA4,
-    0x74, 0x9F, 0xF1, 0xC5, 0x01, 0x4C, 0xB6, 0xAA, 0x65, 0x0A, 0x26, 0x6C, 0x58, 0x92, 0x3F, 0x49,
-    0xBE, 0xB1, 0xE5, 0x86, 0x60, 0x24, 0x26, 0xC6, 0x32, 0x7E, 0x59, 0x4E, 0x89, 0xE2, 0xAC, 0xDF,
-    0xCF, 0xD4, 0x91, 0x23, 0x30, 0x9C, 0x21, 0x90, 0x21, 0x4C, 0x79, 0x17, 0x30, 0xB2, 0xE5, 0x32,
-    0x0B, 0xF1, 0x7E, 0x6B, 0xCA, 0x87, 0xDC, 0x74, 0x4B, 0xC5, 0xB3, 0x67, 0x42, 0x56, 0xA7, 0x67,
-    0x42, 0xAE, 0xCC, 0x9E, 0x09, 0xB9, 0xF1, 0x99, 0xCF, 0x84, 0xF8, 0x8F, 0x78, 0x26, 0x64, 0x11,
-    0x5E, 0xC2, 0xF1, 0x39, 0x06, 0xEB, 0x47, 0xCC, 0xCF, 0x31, 0xCA, 0xF1, 0x31, 0x8B, 0xB0, 0x06,
-    0x5A, 0xC2, 0x8A, 0x60, 0x20, 0xBA, 0xEA, 0xDD, 0x56, 0x6D, 0xE6, 0x92, 0xF8, 0x70, 0x56, 0xF3,
-    0x60, 0xBF, 0x83, 0xF7, 0x93, 0x31, 0x04, 0xDC, 0x66, 0x83, 0xD1, 0x6A, 0x74, 0xF5, 0x6A, 0xB7,
-    0x4F, 0xFF, 0xA2, 0xFA, 0x21, 0xC7, 0x36, 0xD8, 0x64, 0x93, 0x62, 0x58, 0xF2, 0x70, 0xFA, 0xF9,
-    0x43, 0x75, 0x88, 0xED, 0x83, 0x24, 0x95, 0x07, 0x60, 0xE4, 0x81, 0x40, 0x65, 0x5E, 0x60, 0x7F,
-    0x92, 0x10, 0x19, 0xBF, 0x5D, 0x4F, 0x47, 0x2C, 0xFB, 0x95, 0x33, 0x96, 0x0D, 0xCB, 0x21, 0x0B,
-    0x0F, 0xA6, 0x01, 0x1F, 0xB1, 0xE5, 0x54, 0x60, 0x30, 0xA2, 0x0D, 0x77, 0x2B, 0xD6, 0x08, 0x14,
-    0x3B, 0x12, 0xAE, 0x16, 0xE0, 0xBF, 0xA2, 0x7E, 0xF4, 0x99, 0x14, 0x45, 0x46, 0x9E, 0xE0, 0x36,
-    0x9C, 0x50, 0x6B, 0x48, 0x7C, 0xA9, 0x03, 0x37, 0xF5, 0xA4, 0xCC, 0xCB, 0xD2, 0x2A, 0x71, 0x4F,
-    0xF1, 0xA7, 0xD3, 0xE0, 0x93, 0x14, 0xD5, 0x5D, 0xC9, 0xC0, 0xC9, 0xE2, 0xAA, 0xA5, 0x3C, 0x53,
-    0x8E, 0xDF, 0x3A, 0x95, 0xB8, 0xF1, 0x27, 0x35, 0x71, 0x7F, 0x20, 0x2E, 0x0F, 0x9E, 0xCF, 0x6F,
-    0x3B, 0x97, 0x79, 0x42, 0xAD, 0x04, 0xA5, 0x2E, 0x37, 0x55, 0xA7, 0xD3, 0xE4, 0x84, 0x3C, 0xB3,
-    0x92, 0xE1, 0x85, 0x7A, 0xF1, 0xE8, 0xE0, 0x0A, 0xCE, 0xF8, 0xF0, 0x85, 0xFC, 0xC1, 0x67, 0x56,
-    0xC2, 0xEB, 0xAD, 0x39, 0x7D, 0xBD, 0xCF, 0x1C, 0x6E, 0x3F, 0xA9, 0xBD, 0xF2, 0x79, 0xED, 0x57,
-    0xDF, 0x8E, 0xBD, 0xEB, 0x3D, 0xAC, 0x4D, 0xDF, 0xE7, 0xA8, 0x28, 0xA7, 0x26, 0xF2, 0x2F, 0xF0,
-    0x34, 0xE7, 0xA3, 0x47, 0x40, 0xEC, 0xD4, 0x89, 0x90, 0xDC, 0x7E, 0x45, 0x4D, 0x83, 0x1E, 0x76,
-    0xE0, 0x28, 0x88, 0x7B, 0x9C, 0xA3, 0x64, 0x55, 0x15, 0x96, 0x15, 0xBB, 0x51, 0x90, 0x94, 0xFF,
-    0x22, 0xF7, 0x5C, 0xFF, 0x04, 0x74, 0xF1, 0x55, 0x19, 0x81, 0x91, 0x4E, 0xC8, 0xA7, 0x38, 0xFA,
-    0xC3, 0x86, 0x38, 0x73, 0x57, 0xD4, 0x7D, 0x4C, 0x4C, 0x8B, 0x8F, 0xA1, 0x54, 0x81, 0xF4, 0x37,
-    0x63, 0x91, 0x54, 0x2A, 0x22, 0x81, 0xD4, 0x44, 0xE2, 0x9F, 0x90, 0xAA, 0x14, 0x36, 0xD5, 0xCC,
-    0xE9, 0x52, 0x93, 0xF3, 0xC1, 0x97, 0x81, 0x0F, 0x6E, 0x47, 0x0D, 0x52, 0x36, 0x64, 0xAC, 0xFA,
-    0x72, 0x01, 0x16, 0xC3, 0x27, 0x60, 0x24, 0x52, 0x99, 0x4A, 0x73, 0xAC, 0x6F, 0xFF, 0xB4, 0x61,
-    0x5F, 0x7E, 0x87, 0x3C, 0xCB, 0x5C, 0xA8, 0x55, 0x78, 0xE7, 0xE1, 0x3E, 0x71, 0x88, 0x47, 0xDD,
-    0x7A, 0xD8, 0x22, 0x54, 0xEA, 0x37, 0x9C, 0xD9, 0x55, 0xAF, 0x63, 0xEF, 0x9A, 0x1A, 0x01, 0xBC,
-    0x97, 0x1C, 0xDA, 0xF5, 0xAB, 0xCD, 0x38, 0x5D, 0x88, 0x5E, 0x6C, 0x83, 0xFF, 0x80, 0xAD, 0x70,
-    0x6A, 0x17, 0x47, 0xBE, 0x3A, 0xBB, 0xCD, 0x1F, 0xFD, 0x38, 0x55, 0xF0, 0x88, 0xC7, 0xA9, 0xCA,
-    0xFD, 0xC7, 0xA9, 0xEE, 0xC8, 0xE3, 0x54, 0x0D, 0xBB, 0x3F, 0x92, 0xEB, 0x09, 0x9F, 0xF7, 0xF7,
-    0xB6, 0xD0, 0x79, 0x50, 0x41, 0xA2, 0xC2, 0x37, 0x61, 0xF9, 0xB7, 0x1C, 0xF3, 0x9C, 0x1E, 0xCE,
-    0x00, 0xFA, 0xFA, 0x1C, 0x69, 0xBF, 0x56, 0x7B, 0x7D, 0xD2, 0xC4, 0x25, 0x3D, 0xC5, 0xF5, 0x97,
-    0xFF, 0x17, 0x85, 0x55, 0xBD, 0x8F, 0xDD, 0x44, 0x10, 0x1F, 0x7B, 0xB9, 0x67, 0x38, 0x8B, 0xEC,
-    0x15, 0xB9, 0x02, 0x04, 0x98, 0x22, 0x45, 0x72, 0x02, 0x4C, 0x7F, 0xB9, 0x5B, 0xEB, 0x4E, 0x22,
-    0x05, 0x05, 0x11, 0xCA, 0xAB, 0xE1, 0x3F, 0xA0, 0x49, 0x41, 0x71, 0x77, 0xB6, 0x52, 0x50, 0xA2,
-    0x34, 0x48, 0x48, 0x34, 0x4F, 0x22, 0x45, 0x74, 0x15, 0x42, 0x29, 0x90, 0x38, 0xB0, 0xB9, 0x14,
-    0x11, 0x42, 0x48, 0x0E, 0x91, 0x10, 0x15, 0x32, 0x1F, 0x35, 0xDA, 0x80, 0x25, 0x2C, 0x6E, 0xFD,
-    0x96, 0xDF, 0x8C, 0x9F, 0xEF, 0x43, 0xBA, 0x28, 0x2B, 0xDB, 0x6F, 0xDF, 0xEE, 0xEC, 0x7C, 0xFC,
-    0xE6, 0x37, 0xB3, 0xAB, 0xD3, 0xA9, 0xF1, 0x73, 0xE3, 0xFB, 0xD5, 0x71, 0xB2, 0x34, 0x9D, 0x4E,
-    0xDF, 0xF5, 0xDE, 0xF7, 0x06, 0x9F, 0x8A, 0x30, 0xCC, 0xF0, 0xC7, 0x95, 0xDE, 0x77, 0x74, 0x3C,
-    0x3C, 0x8F, 0xFB, 0xF2, 0x4D, 0xF9, 0x73, 0x6A, 0xEB, 0xC9, 0x9B, 0xBA, 0xE8, 0x68, 0x37, 0xAA,
-    0x43, 0x9B, 0xCA, 0x74, 0x43, 0x61, 0x9A, 0x90, 0xAE, 0x1C, 0x4F, 0x03, 0x4C, 0xE3, 0xEA, 0x80,
-    0x36, 0x55, 0x13, 0xB4, 0x49, 0xB6, 0x98, 0x52, 0xAB, 0xB3, 0xA8, 0xDA, 0x21, 0xA3, 0x2C, 0xA6,
-    0x05, 0x4F, 0x29, 0x80, 0x8F, 0xD3, 0x88, 0x9D, 0x8C, 0xF1, 0x71, 0x27, 0x76, 0x13, 0xFC, 0x6D,
-    0xD9, 0xA2, 0x45, 0x3C, 0xD3, 0xEB, 0x58, 0xE8, 0x94, 0x27, 0x53, 0xC5, 0x1D, 0x79, 0x4A, 0xAD,
-    0xEA, 0x21, 0x53, 0xD6, 0xC6, 0x6A, 0x1B, 0x77, 0xCA, 0xA9, 0x79, 0xE0, 0xC5, 0xDB, 0xCA, 0x34,
-    0x89, 0xD5, 0x6D, 0xE4, 0x54, 0x1F, 0xCE, 0xE9, 0xDC, 0x53, 0x94, 0xFF, 0xE6, 0x33, 0x63, 0x7D,
-    0xA1, 0x6D, 0x8E, 0x0D, 0x53, 0x2B, 0xA7, 0x6D, 0xE8, 0x59, 0x64, 0x5B, 0xF6, 0x43, 0xFF, 0x8E,
-    0x53, 0x5E, 0x77, 0xBC, 0x1E, 0x77, 0x69, 0xCD, 0x72, 0xA6, 0xF1, 0x59, 0x7E, 0x78, 0xBE, 0x8D,
-    0xA7, 0x69, 0xBC, 0x43, 0xB4, 0x47, 0x94, 0x02, 0xB3, 0x8A, 0x80, 0x42, 0xD0, 0x12, 0x1D, 0x20,
-    0x17, 0x1C, 0xA3, 0xF2, 0xFE, 0xD0, 0xFB, 0xC7, 0x8C, 0xEA, 0xEE, 0x28, 0x12, 0x35, 0x14, 0x42,
-    0x04, 0x58, 0x6C, 0x42, 0x24, 0x93, 0x53, 0x96, 0x02, 0x88, 0x7C, 0x23, 0xA7, 0xE2, 0x82, 0xA8,
-    0x26, 0x7A, 0x93, 0xE8, 0x99, 0x11, 0xAC, 0xE5, 0x42, 0x84, 0x59, 0x33, 0xA4, 0x59, 0x88, 0xC5,
-    0xE3, 0x61, 0x5A, 0x7A, 0x0B, 0x80, 0x6B, 0xE4, 0x3D, 0x63, 0xA5, 0x51, 0x2D, 0xAB, 0x32, 0x6D,
-    0x68, 0xB9, 0xFC, 0x0B, 0x02, 0x1D, 0x04, 0x2C, 0xA5, 0x99, 0xAC, 0xC2, 0x18, 0x25, 0x85, 0xF8,
-    0x18, 0x60, 0xAA, 0x30, 0x7D, 0x0E, 0xF2, 0x2B, 0x0B, 0x5B, 0xE1, 0xFE, 0xFE, 0x8C, 0x72, 0xEF,
-    0x49, 0x7B, 0xDF, 0x80, 0x1E, 0x73, 0x42, 0x96, 0x6A, 0x04, 0xD2, 0x43, 0x91, 0xAF, 0xB0, 0xEA,
-    0x02, 0xE6, 0x1B, 0xEC, 0xB1, 0x5A, 0x5F, 0x70, 0x22, 0x39, 0x9B, 0x5B, 0x9C, 0x4C, 0xA6, 0x22,
-    0x67, 0x1A, 0x8A, 0x3F, 0x54, 0xBD, 0xEE, 0xF3, 0xFF, 0xFC, 0xDB, 0x30, 0x10, 0xCE, 0x92, 0xCA,
-    0x47, 0x9D, 0x69, 0x8E, 0x27, 0x93, 0xDB, 0xCB, 0xD9, 0x15, 0x5D, 0xA7, 0xD5, 0x3C, 0xA9, 0x4D,
-    0x31, 0x37, 0x55, 0x79, 0xAB, 0xCF, 0x2B, 0xE0, 0x79, 0x71, 0x63, 0x83, 0xDD, 0xB8, 0x2E, 0x1C,
-    0xA4, 0x0D, 0x78, 0xAC, 0x7E, 0x41, 0xA4, 0xC9, 0xFB, 0x40, 0xE7, 0xF3, 0x6B, 0x35, 0x85, 0x0E,
-    0x60, 0x47, 0xF7, 0x2D, 0x0D, 0x61, 0x72, 0x34, 0x12, 0x19, 0x63, 0x2A, 0x71, 0x05, 0xEE, 0xF2,
-    0x15, 0xD2, 0x87, 0x9F, 0x7C, 0x4A, 0xEE, 0xC2, 0xAF, 0xB5, 0xAE, 0xD7, 0xD7, 0x69, 0x4E, 0xF7,
-    0xEE, 0x4D, 0x66, 0x23, 0xB3, 0xE1, 0x3F, 0xA5, 0x8D, 0x72, 0x54, 0x16, 0xC9, 0x82, 0x32, 0xC8,
-    0xFA, 0x03, 0x50, 0x2C, 0x76, 0xE1, 0x5C, 0xB7, 0x03, 0x2F, 0x4C, 0x9D, 0xD8, 0xB2, 0x32, 0x35,
-    0x50, 0xC5, 0xB8, 0x10, 0xD6, 0x37, 0xD3, 0x6D, 0xEB, 0x4C, 0x54, 0x77, 0x9B, 0xF1, 0x77, 0x76,
-    0x47, 0x6F, 0x35, 0x72, 0x2E, 0x68, 0x4C, 0x00, 0xB2, 0xEF, 0xF0, 0x3C, 0x8E, 0xAE, 0xFD, 0x61,
-    0xDD, 0x41, 0xA2, 0xB7, 0x7F, 0x1A, 0x36, 0xE9, 0xE5, 0xA8, 0xF8, 0x62, 0x53, 0x1F, 0xB6, 0x26,
-    0xAE, 0xBA, 0x64, 0xBB, 0x3E, 0x88, 0x6F, 0x35, 0x57, 0x65, 0x63, 0x92, 0xB1, 0xAF, 0x65, 0x1D,
-    0x1D, 0xB5, 0xE9, 0x23, 0x71, 0xA1, 0x08, 0x6C, 0xD8, 0xA9, 0x36, 0x6A, 0x10, 0x11, 0xC0, 0xB7,
-    0xC8, 0xF0, 0x6B, 0x14, 0x62, 0xE3, 0x12, 0xA7, 0xA8, 0xA7, 0xB8, 0xA1, 0x9C, 0x62, 0x1B, 0x81,
-    0xB6, 0xC0, 0xE4, 0x75, 0xD9, 0x82, 0x9E, 0x62, 0x88, 0xA9, 0x96, 0x9F, 0x54, 0xBA, 0x00, 0xEA,
-    0x41, 0x68, 0x9C, 0xFF, 0x80, 0x6C, 0xE7, 0x35, 0x62, 0xC5, 0x12, 0x94, 0x42, 0x34, 0x6D, 0xA3,
-    0x5E, 0x20, 0x48, 0x18, 0x2D, 0xDD, 0x97, 0x38, 0xA7, 0x8E, 0x90, 0x6C, 0xE8, 0xFF, 0x07, 0x89,
-    0x75, 0xA4, 0xFF, 0xF6, 0x16, 0x16, 0x92, 0xDF, 0x3D, 0x23, 0xF4, 0xE2, 0x67, 0xDE, 0x4E, 0xEE,
-    0x70, 0x63, 0xE1, 0xBE, 0x10, 0x0C, 0x15, 0x1C, 0xFB, 0xF7, 0xB8, 0x50, 0xD2, 0x5E, 0x33, 0x36,
-    0xBE, 0x8D, 0xD1, 0x7C, 0x22, 0x5F, 0xE3, 0x01, 0xE3, 0x49, 0x71, 0xEE, 0xC7, 0x11, 0x0E, 0xA0,
-    0x47, 0xC3, 0x92, 0x3E, 0xF3, 0x93, 0x36, 0xA3, 0xD4, 0xAB, 0x44, 0x57, 0xA5, 0x40, 0x0E, 0x98,
-    0xA0, 0x60, 0x39, 0x20, 0xC0, 0x03, 0xFA, 0x22, 0x2E, 0x10, 0x3E, 0x2D, 0xC8, 0x64, 0x9C, 0x6D,
-    0x0D, 0x1F, 0x4E, 0x37, 0x2F, 0x82, 0x6F, 0xBA, 0xE5, 0x27, 0xB5, 0x1C, 0x62, 0xC9, 0x9A, 0xB9,
-    0x6A, 0x54, 0x36, 0x90, 0x9B, 0x35, 0x0A, 0x4D, 0x3E, 0x68, 0xB9, 0xD5, 0x55, 0xE4, 0x8F, 0x5A,
-    0x7A, 0xC3, 0x61, 0x65, 0x8F, 0xF5, 0x6E, 0x5B, 0xD2, 0x0F, 0x3B, 0xD8, 0xEA, 0xC1, 0x9A, 0x9C,
-    0xE8, 0xDB, 0x12, 0x66, 0x10, 0x54, 0x82, 0x57, 0x71, 0xE9, 0x73, 0x9C, 0x39, 0x70, 0x33, 0xC0,
-    0x49, 0x67, 0x74, 0x76, 0xAC, 0xD1, 0x62, 0x03, 0x86, 0x62, 0x2E, 0x2C, 0x2F, 0xB0, 0x93, 0xB8,
-    0xB1, 0x76, 0x17, 0x7F, 0x56, 0xA7, 0x37, 0xD0, 0xA7, 0x73, 0xEF, 0x5E, 0xA1, 0xAF, 0x4A, 0xFF,
-    0xD0, 0x83, 0x62, 0x50, 0x76, 0x11, 0x3B, 0x37, 0x0B, 0xD2, 0x5F, 0xE3, 0x85, 0x11, 0xCE, 0x88,
-    0xC1, 0xD1, 0xD5, 0x9F, 0x0B, 0xFA, 0xF2, 0xD1, 0xF7, 0xCF, 0xFF, 0xEB, 0x5D, 0xEA, 0xCB, 0x26,
-    0xEE, 0xF2, 0x3F, 0x51, 0x79, 0xED, 0xFA, 0x8F, 0x1F, 0xAF, 0xA8, 0xE2, 0xD9, 0x63, 0xAB, 0xDD,
-    0x48, 0x7A, 0xEE, 0x04, 0xDC, 0x52, 0xA4, 0x6F, 0x48, 0x6F, 0x60, 0xC4, 0x16, 0xEB, 0x1C, 0x33,
-    0x17, 0x3B, 0x29, 0x5E, 0x8F, 0x99, 0x1E, 0x29, 0x53, 0x65, 0x8F, 0x45, 0xDD, 0x98, 0x12, 0xA1,
-    0xCD, 0xDA, 0x99, 0xB8, 0x56, 0x89, 0x96, 0x32, 0x64, 0xDA, 0x51, 0x3E, 0x47, 0xA7, 0xF4, 0x15,
-    0x6A, 0x39, 0x98, 0x6F, 0xB5, 0x79, 0xD1, 0xD3, 0x65, 0xDA, 0x5B, 0x96, 0x12, 0xC3, 0xCB, 0xA6,
-    0xE2, 0xA1, 0x93, 0xA9, 0xA1, 0x9B, 0xB1, 0x5A, 0x60, 0x08, 0x2A, 0x51, 0x9E, 0x11, 0x3A, 0x67,
-    0x50, 0x16, 0x94, 0xCC, 0x41, 0x0D, 0xC4, 0xD9, 0x03, 0x1D, 0x60, 0x8A, 0xEC, 0x22, 0x62, 0x7E,
-    0x4B, 0xA6, 0x4E, 0x26, 0x54, 0x35, 0x10, 0x83, 0xB6, 0x17, 0xA4, 0x2A, 0x9E, 0x30, 0xF2, 0xC1,
-    0x7F, 0x88, 0x6A, 0x88, 0x42, 0x3C, 0xE2, 0x5E, 0x08, 0xA6, 0xC0, 0x5A, 0x08, 0xA8, 0xF7, 0x4F,
-    0xC9, 0xDE, 0x60, 0x0E, 0x24, 0x48, 0xC4, 0x4B, 0xC4, 0x8D, 0x68, 0x93, 0xDD, 0x47, 0xFB, 0x9C,
-    0xA1, 0xA2, 0x76, 0xA5, 0x73, 0xC2, 0xD1, 0x50, 0xBE, 0xAA, 0x65, 0xFF, 0x23, 0xCB, 0x78, 0x6A,
-    0x2E, 0x3C, 0x2A, 0x2B, 0x04, 0x15, 0x7B, 0x46, 0xC6, 0x74, 0x94, 0x54, 0xEC, 0x20, 0x0C, 0x83,
-    0x03, 0x48, 0x3F, 0x7C, 0x0E, 0x07, 0x4E, 0xA0, 0xEC, 0xCF, 0xF7, 0x13, 0xB0, 0x22, 0x48, 0xF8,
-    0x18, 0x39, 0xF6, 0x52, 0x77, 0xCC, 0x90, 0xA4, 0xA3, 0x35, 0x50, 0xB8, 0x15, 0xD2, 0xCC, 0x8E,
-    0x65, 0x57, 0x96, 0xD0, 0xE4, 0x82, 0x43, 0x2E, 0xAD, 0x58, 0x2E, 0x5E, 0xD3, 0xE3, 0x78, 0x70,
-    0x84, 0xFB, 0x94, 0x7B, 0x7B, 0x2A, 0x94, 0x77, 0xEC, 0x30, 0x3C, 0x83, 0x43, 0x5C, 0x06, 0x68,
-    0x7F, 0xBC, 0x80, 0xAA, 0x46, 0xEF, 0x64, 0xE2, 0x04, 0x88, 0x33, 0x70, 0xB8, 0x8A, 0x28, 0x6C,
-    0x18, 0xCC, 0x30, 0x13, 0xFF, 0x62, 0x31, 0x76, 0xE9, 0xAC, 0x73, 0xCB, 0xB3, 0xA1, 0x3B, 0x30,
-    0x66, 0x5E, 0x00, 0x74, 0x7C, 0xA4, 0x6C, 0x3C, 0x93, 0xF7, 0xA3, 0xBB, 0xA3, 0x9C, 0xDC, 0x3B,
-    0xA1, 0xB4, 0x14, 0xE1, 0x91, 0xB4, 0x56, 0xEE, 0xC6, 0x8B, 0x82, 0xE2, 0x5B, 0x6E, 0xD8, 0x9B,
-    0xDC, 0xE6, 0x8B, 0xC8, 0x64, 0xE0, 0x1C, 0x1C, 0xDB, 0xE5, 0x5A, 0x60, 0x14, 0xF3, 0x2A, 0xCD,
-    0x46, 0x02, 0x0E, 0xE4, 0x13, 0x66, 0x0C, 0xBC, 0x15, 0x06, 0x8D, 0x7B, 0xCD, 0x89, 0x91, 0x8E,
-    0x57, 0x92, 0x07, 0x2C, 0xD2, 0xB3, 0x5B, 0xD1, 0x63, 0x8E, 0xC4, 0xBC, 0x85, 0xF6, 0x13, 0xBA,
-    0x93, 0x26, 0x57, 0x9E, 0x28, 0x32, 0xC5, 0xC8, 0x66, 0x61, 0x85, 0xB4, 0x90, 0xE1, 0x42, 0x1B,
-    0xAF, 0xB3, 0xFF, 0x01, 0x45, 0x51, 0x3D, 0x6F, 0xD4, 0x40, 0x10, 0x7D, 0xDE, 0x81, 0x9C, 0x14,
-    0x73, 0x5E, 0x9A, 0xA0, 0x14, 0xE1, 0xCC, 0x0F, 0x70, 0x30, 0x05, 0x12, 0x27, 0xE2, 0x68, 0xF7,
-    0x0F, 0x10, 0x05, 0x29, 0x6D, 0x94, 0x36, 0x45, 0x84, 0x28, 0x4E, 0xC2, 0x05, 0xC4, 0xEE, 0x69,
-    0xF8, 0x09, 0x94, 0x34, 0x14, 0x48, 0x57, 0x5C, 0x43, 0x6E, 0x03, 0x05, 0xED, 0x09, 0x0A, 0x2A,
-    0x24, 0x13, 0x29, 0x12, 0xE5, 0x16, 0x16, 0x5A, 0x29, 0xF6, 0x99, 0xD9, 0x73, 0x22, 0x1A, 0xEF,
-    0xEC, 0xCC, 0x9B, 0xF7, 0xB1, 0x16, 0xD5, 0xF8, 0xFB, 0xD7, 0xBD, 0x5F, 0x4F, 0x3E, 0xFD, 0xF8,
-    0xD6, 0xCA, 0x05, 0x80, 0xBB, 0xC2, 0xA4, 0xE2, 0x43, 0xF2, 0xBB, 0x33, 0xBB, 0xB0, 0x38, 0xA0,
-    0xE5, 0x00, 0xA1, 0x96, 0x35, 0xB2, 0xCD, 0x99, 0xB2, 0x69, 0x89, 0x8D, 0x60, 0x49, 0x7A, 0x5D,
-    0x4B, 0x37, 0x4A, 0x92, 0x2C, 0xB6, 0x6B, 0x7A, 0xE3, 0x79, 0x67, 0x24, 0x26, 0x64, 0x1E, 0xC2,
-    0x86, 0x65, 0xC6, 0x14, 0x41, 0x43, 0xCF, 0x06, 0xF7, 0xC9, 0x45, 0x79, 0x92, 0x29, 0x17, 0x57,
-    0x80, 0x68, 0xA2, 0xE1, 0x9D, 0xE1, 0x56, 0x22, 0x9B, 0x60, 0xF6, 0xD4, 0x2A, 0xAF, 0xE3, 0x71,
-    0x7F, 0x5B, 0xC8, 0xAE, 0x85, 0xBA, 0x72, 0xA2, 0x25, 0x2B, 0x17, 0xB2, 0x54, 0x38, 0x15, 0x4E,
-    0xD4, 0x5C, 0x1A, 0xA5, 0x0B, 0xD1, 0x50, 0x23, 0xAD, 0xAC, 0x8A, 0x72, 0xAE, 0x45, 0x15, 0x3D,
-    0xDE, 0x3E, 0xDE, 0x99, 0xBE, 0x9A, 0x4E, 0x6C, 0xB1, 0x50, 0xE5, 0x2D, 0x60, 0x5F, 0x9A, 0x17,
-    0x98, 0x08, 0x56, 0xCF, 0x65, 0x53, 0x54, 0xC2, 0x85, 0x1F, 0x11, 0x61, 0x1B, 0x33, 0xB2, 0xB1,
-    0x51, 0x75, 0x61, 0x85, 0x5B, 0x3B, 0xC4, 0x30, 0x38, 0x21, 0xB6, 0x9F, 0xD6, 0x8A, 0x8D, 0xE0,
-    0x01, 0x19, 0x45, 0xF9, 0xF8, 0xA2, 0x3B, 0x7F, 0xC3, 0xF1, 0x40, 0x6D, 0x08, 0x59, 0xDD, 0xCE,
-    0x91, 0xA7, 0x56, 0x95, 0x3C, 0x9F, 0xD3, 0x25, 0x77, 0xEA, 0xF8, 0x35, 0xA7, 0xCB, 0x52, 0x8E,
-    0x87, 0xA0, 0x3B, 0x3F, 0xF2, 0xF1, 0x46, 0x3E, 0xDE, 0xAE, 0xF7, 0xDD, 0xE2, 0xC2, 0xBC, 0xB4,
-    0xA3, 0x29, 0x39, 0x7A, 0x2B, 0xBE, 0x98, 0x79, 0xB5, 0xFE, 0x8E, 0x33, 0x07, 0x3F, 0xCB, 0xC5,
-    0xFB, 0x47, 0xE3, 0xE8, 0x73, 0xD0, 0x81, 0xCA, 0xCE, 0xDC, 0xD3, 0x0C, 0x15, 0xFC, 0x61, 0x5E,
-    0xE1, 0x80, 0xD4, 0x30, 0x08, 0xF0, 0x8F, 0xBC, 0x04, 0x42, 0x16, 0x57, 0x7A, 0x35, 0x90, 0x06,
-    0x38, 0x63, 0x2B, 0x35, 0x10, 0xFF, 0x2F, 0x7D, 0x57, 0x61, 0xB5, 0x32, 0xB0, 0xFD, 0xA4, 0xB8,
-    0xBE, 0xD6, 0x3D, 0x8B, 0xF7, 0xDB, 0x71, 0xAB, 0x65, 0x99, 0x19, 0xB0, 0xD9, 0x93, 0xB2, 0x8C,
-    0xE7, 0x27, 0xD7, 0xEF, 0xCC, 0xFB, 0xF2, 0x46, 0xC3, 0x03, 0x78, 0xED, 0xDA, 0xC7, 0x69, 0xCF,
-    0xAD, 0x7A, 0x45, 0xB6, 0xE3, 0xA1, 0x4C, 0x7B, 0x73, 0xE3, 0xA3, 0xD0, 0x2B, 0x56, 0xD6, 0xE1,
-    0xFF, 0x28, 0xFE, 0xE0, 0x1F, 0x45, 0x55, 0x3D, 0x6F, 0xDC, 0x46, 0x10, 0x1D, 0xEE, 0x5A, 0x22,
-    0x20, 0x16, 0xDB, 0xE4, 0xA3, 0x30, 0x10, 0xB6, 0x81, 0x81, 0x64, 0xFF, 0x80, 0xEF, 0xB8, 0x50,
-    0x8A, 0x94, 0xBA, 0x22, 0x4E, 0x93, 0x42, 0x5D, 0x80, 0x54, 0xFA, 0x03, 0x12, 0x48, 0x24, 0x45,
-    0x4A, 0xA9, 0x49, 0x2D, 0x17, 0x6E, 0xA2, 0x46, 0x29, 0x5C, 0xA8, 0x90, 0x4C, 0x5A, 0x02, 0xA2,
-    0xC2, 0x85, 0x18, 0x04, 0xB6, 0x0A, 0x37, 0x14, 0x82, 0xC0, 0x88, 0x11, 0xC0, 0x8C, 0xC1, 0xC0,
-    0x3C, 0x69, 0x8F, 0x93, 0x37, 0xCB, 0x93, 0x43, 0xE0, 0x9E, 0x8E, 0x7B, 0x3B, 0x5F, 0x6F, 0xDE,
-    0x8C, 0x88, 0xE8, 0x93, 0xCF, 0x88, 0xE8, 0xFE, 0x36, 0x60, 0xFB, 0x08, 0xD0, 0xB5, 0x44, 0xD1,
-    0xDB, 0x86, 0x28, 0x61, 0x00, 0x03, 0x62, 0xE6, 0x8A, 0x52, 0x81, 0x7C, 0x98, 0xE0, 0xC8, 0x6F,
-    0x93, 0x1E, 0x8E, 0x3A, 0x8A, 0xFD, 0x3F, 0x2D, 0x99, 0xEB, 0x3F, 0x6A, 0x32, 0xEF, 0xCE, 0x71,
-    0xE3, 0xE6, 0x59, 0x41, 0x96, 0x37, 0x08, 0x60, 0x7F, 0x01, 0x70, 0x2B, 0x56, 0xB8, 0xB2, 0x74,
-    0xD2, 0x90, 0x66, 0xAE, 0x49, 0xE3, 0x2E, 0x25, 0xBB, 0x8E, 0xC8, 0xA4, 0xB4, 0x0C, 0x3F, 0x3E,
-    0xD1, 0xE1, 0xF5, 0x18, 0x31, 0x67, 0x2F, 0xF6, 0x55, 0xCC, 0xB8, 0xC5, 0x05, 0x51, 0x86, 0x54,
-    0x62, 0x4F, 0xF2, 0x72, 0x53, 0x99, 0x2E, 0xF5, 0x11, 0xAB, 0xB9, 0xB3, 0xED, 0x94, 0x14, 0x5F,
-    0x5E, 0x86, 0x58, 0x11, 0x33, 0x8F, 0xA1, 0x72, 0x1E, 0x28, 0x92, 0x48, 0xCB, 0x67, 0x26, 0xB5,
-    0x38, 0xE4, 0xD2, 0x91, 0x69, 0x72, 0xD2, 0xF8, 0x01, 0x79, 0xE1, 0x8C, 0xAB, 0x68, 0xEB, 0xA7,
-    0x19, 0xC5, 0x38, 0xC8, 0x60, 0x03, 0x63, 0x47, 0x06, 0xD1, 0x62, 0x89, 0xD6, 0xA1, 0x0E, 0x2F,
-    0x37, 0x07, 0x87, 0x9B, 0x2D, 0x52, 0x5F, 0x04, 0x6F, 0x31, 0xF8, 0x29, 0x5D, 0x22, 0xDC, 0x14,
-    0xA6, 0x46, 0xA0, 0x22, 0xAD, 0x90, 0x45, 0x65, 0x0B, 0x94, 0x57, 0x65, 0x0E, 0x95, 0xD6, 0x79,
-    0x60, 0xAF, 0x44, 0x85, 0xDC, 0x0C, 0x12, 0x0C, 0xC6, 0x99, 0x60, 0x4F, 0xD9, 0xF9, 0xBB, 0x9E,
-    0x28, 0x3F, 0x03, 0x2F, 0xC4, 0x23, 0xFE, 0x80, 0x9C, 0x15, 0xAF, 0x83, 0x5F, 0xCD, 0x11, 0x30,
-    0x06, 0x22, 0x8B, 0xB5, 0x03, 0xA1, 0x08, 0x26, 0x70, 0x80, 0xD0, 0xB6, 0xC8, 0x25, 0x43, 0xF6,
-    0xF7, 0xF8, 0xA0, 0x7C, 0x44, 0x4F, 0x22, 0x16, 0xAE, 0x42, 0xA5, 0x1E, 0xE6, 0xF0, 0xA4, 0x25,
-    0xFF, 0x78, 0xD8, 0x43, 0x70, 0x24, 0x4F, 0x06, 0xBE, 0x29, 0x15, 0xB0, 0x48, 0x36, 0x50, 0x48,
-    0x79, 0x20, 0xC5, 0xF6, 0x82, 0x06, 0xA1, 0x88, 0xF4, 0x73, 0x79, 0x89, 0x5A, 0x69, 0x05, 0x1D,
-    0xC5, 0x72, 0x34, 0x51, 0x72, 0xD5, 0x50, 0x47, 0x69, 0x17, 0xBF, 0xF0, 0x94, 0x0E, 0x0A, 0x71,
-    0x12, 0x47, 0x40, 0x05, 0x11, 0x20, 0xB9, 0x27, 0x64, 0x7F, 0x47, 0x63, 0x7B, 0xD3, 0x1C, 0x13,
-    0x6D, 0x7D, 0xD1, 0xA1, 0x6C, 0x7D, 0xB5, 0x30, 0xB5, 0x7A, 0xD1, 0x97, 0x71, 0xA7, 0xD8, 0x67,
-    0xA7, 0x0B, 0xE2, 0xC5, 0xCA, 0xEC, 0x01, 0x25, 0xFD, 0xB2, 0x0D, 0xF0, 0x1A, 0x17, 0x1A, 0x56,
-    0x85, 0x6E, 0xC8, 0x38, 0x40, 0x4A, 0x80, 0xCF, 0x01, 0x8F, 0x27, 0x81, 0x24, 0x2F, 0x1C, 0x75,
-    0x1F, 0xBF, 0x5A, 0xCC, 0x67, 0xFA, 0xD5, 0x02, 0x05, 0xBD, 0x19, 0x42, 0x55, 0x22, 0x1C, 0x64,
-    0xAE, 0x87, 0x1C, 0x14, 0xF9, 0xBC, 0x80, 0x14, 0x72, 0x54, 0xDA, 0x65, 0xD2, 0x0D, 0x00, 0x7D,
-    0xE7, 0x44, 0x1A, 0x03, 0xDD, 0x01, 0x23, 0xD5, 0x34, 0xE2, 0x6F, 0x9A, 0x89, 0xEA, 0x54, 0x7B,
-    0xAC, 0x9B, 0xA8, 0xF1, 0xFA, 0xD7, 0xEF, 0x9B, 0x3E, 0x7E, 0x76, 0xF6, 0x5B, 0x6B, 0x76, 0xCF,
-    0x4E, 0x5B, 0xB3, 0xF1, 0xE3, 0x59, 0x93, 0x1A, 0x17, 0xD7, 0x36, 0x2D, 0x4C, 0x35, 0x35, 0x8D,
-    0xAD, 0x26, 0x20, 0xB6, 0xF8, 0x54, 0x09, 0x7F, 0xF4, 0xD1, 0xA1, 0x24, 0xBB, 0x26, 0x70, 0x2C,
-    0x5E, 0x41, 0x73, 0xCC, 0x22, 0x3D, 0x4C, 0x48, 0x7C, 0x03, 0x66, 0x4A, 0xDC, 0x4A, 0x2E, 0x71,
-    0x72, 0x1F, 0x22, 0x50, 0xB5, 0x85, 0x66, 0x08, 0x6F, 0x93, 0xBB, 0xD2, 0x4B, 0x70, 0xA3, 0xA4,
-    0x5B, 0x6A, 0x68, 0xC7, 0xAA, 0x53, 0x49, 0x5F, 0xA4, 0xB9, 0x7C, 0xA0, 0x0E, 0x30, 0x0F, 0x25,
-    0xC2, 0x67, 0x32, 0x5F, 0xA1, 0x38, 0xF4, 0xD7, 0x4B, 0x6B, 0x69, 0xB5, 0xBC, 0xC6, 0x04, 0xA1,
-    0xF5, 0xE6, 0xF5, 0x43, 0x68, 0xDA, 0x07, 0x99, 0xAE, 0x95, 0xE2, 0x45, 0x14, 0x39, 0x36, 0x5B,
-    0x66, 0x0C, 0xB2, 0x2B, 0x47, 0xFF, 0xF7, 0x0E, 0x0E, 0x0E, 0x36, 0xE0, 0xFE, 0x1C, 0x9F, 0xB7,
-    0x41, 0x60, 0xE6, 0x4A, 0x24, 0x28, 0x92, 0x6C, 0x21, 0xC2, 0x2E, 0xB4, 0x59, 0x8B, 0xC5, 0xEE,
-    0x8D, 0x7C, 0x91, 0x49, 0x94, 0xC3, 0xBD, 0xF1, 0xD2, 0x21, 0xDC, 0x48, 0x87, 0x74, 0x10, 0xB7,
-    0x3A, 0xD8, 0xA3, 0xA5, 0xE6, 0xD0, 0xE6, 0x5E, 0xB8, 0x0F, 0x2E, 0x2B, 0x23, 0x6D, 0xC7, 0xE3,
-    0x54, 0x2F, 0x63, 0x68, 0xC2, 0x74, 0xE5, 0x52, 0x55, 0x50, 0x1E, 0x0E, 0xC4, 0x3E, 0xFF, 0x4B,
-    0x7C, 0x04, 0x4F, 0x41, 0x7C, 0x94, 0x8B, 0x9C, 0xD4, 0x10, 0x0E, 0x82, 0x0C, 0xF2, 0xDB, 0xA1,
-    0xFC, 0x40, 0xA4, 0x17, 0x64, 0x86, 0x72, 0x69, 0x47, 0xAE, 0x89, 0xC5, 0x21, 0xF2, 0x82, 0x08,
-    0x8A, 0x58, 0xA6, 0x2D, 0xE7, 0xD7, 0x8F, 0x35, 0x5B, 0xE8, 0xB5, 0x45, 0x4C, 0xC6, 0xF5, 0xA4,
-    0x4F, 0x1D, 0x65, 0xF5, 0x09, 0xA4, 0x88, 0xB8, 0x5F, 0x7A, 0x84, 0xB5, 0xCD, 0xB4, 0xEC, 0xCA,
-    0xA7, 0x6D, 0xB9, 0xCE, 0x2F, 0x5F, 0xF6, 0xB0, 0xE3, 0xDA, 0x2C, 0x37, 0x41, 0x4F, 0xAB, 0x3C,
-    0x87, 0x53, 0xFF, 0x3E, 0x96, 0x7B, 0xBF, 0x6A, 0xBE, 0x76, 0xA1, 0x17, 0x92, 0x94, 0x66, 0x49,
-    0x50, 0xB9, 0xB1, 0x45, 0xF9, 0x2D, 0x8A, 0x2B, 0xF6, 0x26, 0x30, 0xB0, 0xF2, 0x00, 0xCF, 0x6C,
-    0x44, 0x2B, 0x27, 0x6D, 0x98, 0xE6, 0xDA, 0x56, 0x11, 0x2A, 0xCC, 0xAE, 0xB6, 0x1A, 0x1A, 0xF7,
-    0x9D, 0x2C, 0x15, 0xF8, 0x8C, 0xCA, 0xA1, 0x78, 0x1F, 0x0A, 0xFB, 0x27, 0x6A, 0xA5, 0xBC, 0xBB,
-    0x1E, 0xBB, 0x53, 0xF3, 0xDF, 0x09, 0x16, 0xC7, 0x85, 0xB3, 0xFB, 0x94, 0x6D, 0x51, 0x36, 0xA5,
-    0xAC, 0x44, 0xC9, 0x45, 0xCA, 0xB5, 0x42, 0x6F, 0x3B, 0x8A, 0x1E, 0x06, 0xDA, 0x17, 0x91, 0x04,
-    0xFB, 0xDF, 0x89, 0x04, 0x74, 0x02, 0xD0, 0x9F, 0x24, 0x6C, 0xA4, 0xA0, 0x54, 0xE8, 0xB4, 0x42,
-    0x72, 0x26, 0xF1, 0xF2, 0x30, 0x06, 0xB4, 0x84, 0x48, 0xCA, 0x0A, 0x7D, 0xD5, 0xC2, 0x40, 0x22,
-    0x60, 0xBA, 0x50, 0x30, 0xD7, 0x19, 0xFB, 0x68, 0xF3, 0x4F, 0x47, 0x93, 0xB0, 0xF5, 0x90, 0xFA,
-    0x2A, 0x3F, 0x17, 0xC5, 0x64, 0x3E, 0xE8, 0xE2, 0x5B, 0x98, 0xC9, 0x8A, 0x1B, 0x82, 0xF4, 0x14,
-    0xDC, 0x65, 0x28, 0xE1, 0x67, 0xF1, 0x80, 0x68, 0xFE, 0x0E, 0xA5, 0xFB, 0x85, 0x92, 0x9D, 0x3B,
-    0x50, 0x39, 0x9F, 0x19, 0x3E, 0xA1, 0x7D, 0xAE, 0x12, 0xFE, 0x77, 0x9D, 0x9B, 0x9D, 0xAC, 0xB7,
-    0xA7, 0x9B, 0x5B, 0xAD, 0x92, 0x65, 0x37, 0x27, 0xFD, 0x68, 0x59, 0x80, 0xFC, 0xED, 0x64, 0xD3,
-    0x80, 0xDA, 0x85, 0x88, 0xC7, 0xC9, 0xB0, 0xEA, 0xB0, 0xE5, 0x2F, 0xAA, 0xE4, 0xCD, 0x45, 0x65,
-    0x2E, 0x76, 0x0B, 0xB3, 0xBF, 0xE9, 0x52, 0x6B, 0xC9, 0xDA, 0x0C, 0xDC, 0x4C, 0x69, 0x3A, 0xD9,
-    0xA1, 0x9D, 0x6D, 0x4F, 0x27, 0xC7, 0x1E, 0xD3, 0x1D, 0x26, 0x53, 0xD6, 0x62, 0xE8, 0xD9, 0xB8,
-    0xE3, 0x87, 0x08, 0x85, 0x65, 0x04, 0x99, 0xA4, 0x22, 0x53, 0xD3, 0xA4, 0x08, 0x8D, 0x35, 0x22,
-    0x3C, 0x85, 0xFF, 0x22, 0x61, 0xB6, 0x10, 0x39, 0xBD, 0x76, 0xF4, 0xE1, 0xE6, 0xFC, 0x2B, 0x79,
-    0x5D, 0x04, 0x8E, 0xE1, 0xAD, 0x2C, 0x6E, 0x57, 0x63, 0x2A, 0xD4, 0xFC, 0x07, 0x45, 0x53, 0x31,
-    0x6F, 0xD4, 0x30, 0x18, 0x7D, 0xB1, 0x69, 0x83, 0x6A, 0x09, 0x77, 0x40, 0x55, 0xB7, 0x2C, 0xAC,
-    0x34, 0x0C, 0x8C, 0xF4, 0x62, 0xCA, 0xC8, 0x1F, 0x60, 0x60, 0x64, 0x62, 0x61, 0x2D, 0xD2, 0x95,
-    0x18, 0x21, 0xC1, 0xC0, 0xD0, 0x0E, 0x95, 0xD8, 0x5A, 0x46, 0xB6, 0x2E, 0x0C, 0x87, 0x74, 0x34,
-    0x41, 0x95, 0xE8, 0xD0, 0xA1, 0x01, 0x24, 0xD6, 0xA6, 0x6A, 0xA5, 0x5B, 0xAD, 0x23, 0x85, 0xAB,
-    0x48, 0xF2, 0xF1, 0x39, 0x41, 0x10, 0xC5, 0x51, 0x1C, 0xDB, 0xEF, 0xBD, 0xEF, 0xBD, 0x2F, 0x10,
-    0x00, 0x12, 0x40, 0x38, 0x20, 0xB2, 0x40, 0x1D, 0x8C, 0xD4, 0x67, 0x2A, 0x53, 0xA2, 0x7B, 0xD4,
-    0x9A, 0xE4, 0x12, 0xC8, 0x72, 0x20, 0x2D, 0xFA, 0x91, 0x18, 0xE0, 0x36, 0xFE, 0x5F, 0x01, 0xAF,
-    0xC5, 0x39, 0x42, 0xCA, 0x91, 0x51, 0xAE, 0x89, 0x9E, 0xB7, 0x1B, 0xE9, 0xE6, 0x57, 0x37, 0x5E,
-    0xD6, 0xB9, 0xC1, 0x80, 0x37, 0x54, 0x80, 0xCA, 0x3B, 0x06, 0xCC, 0x98, 0x85, 0x19, 0x20, 0x18,
-    0x24, 0xEE, 0x59, 0xF1, 0x0C, 0x4F, 0xF1, 0x31, 0xA0, 0xF3, 0x5A, 0x12, 0xCD, 0xF0, 0x84, 0x2A,
-    0x04, 0x19, 0x2B, 0x21, 0x0B, 0xCD, 0xDB, 0xC9, 0x40, 0x32, 0x40, 0x68, 0x7A, 0xB6, 0x77, 0x80,
-    0x74, 0x3D, 0x9E, 0x36, 0xFD, 0xF9, 0x31, 0xE4, 0xDD, 0xEA, 0x7A, 0xFC, 0xE2, 0x74, 0x96, 0x9C,
-    0x1C, 0xBB, 0x88, 0x08, 0x9A, 0x1C, 0x14, 0x1F, 0x0C, 0xAB, 0x9E, 0xC9, 0x5F, 0xCB, 0xC0, 0x0D,
-    0x60, 0x15, 0x18, 0x02, 0x23, 0x4F, 0x1E, 0xB8, 0xF9, 0x2D, 0x6D, 0xE4, 0x77, 0xA2, 0x37, 0xAC,
-    0xBA, 0xCD, 0xC8, 0x45, 0xAD, 0x09, 0xB2, 0x59, 0xC2, 0x35, 0xCA, 0x5A, 0x33, 0x89, 0x76, 0xA2,
-    0x66, 0x0A, 0xCB, 0x0C, 0xBE, 0x8E, 0x45, 0xE0, 0x0A, 0x57, 0x63, 0x21, 0x66, 0x5C, 0xAD, 0x51,
-    0x54, 0xE9, 0x93, 0x54, 0x1F, 0x1E, 0xE6, 0x6B, 0xA5, 0x01, 0x33, 0xDD, 0x61, 0xF7, 0x58, 0x99,
-    0x85, 0x2C, 0x3A, 0x0A, 0x9E, 0xF4, 0x6F, 0x37, 0xA3, 0x6B, 0x6A, 0x72, 0x54, 0xA4, 0x54, 0x0A,
-    0x16, 0x16, 0x31, 0xB2, 0xEB, 0x35, 0x3D, 0xC6, 0x12, 0xF9, 0xAA, 0xB7, 0x74, 0xCB, 0x3C, 0x04,
-    0xB4, 0x64, 0xA5, 0xCB, 0x0A, 0x9D, 0xA7, 0x55, 0x62, 0xA2, 0x72, 0x84, 0x05, 0xC8, 0x6D, 0xBF,
-    0xB4, 0x2D, 0x32, 0x7F, 0x94, 0x98, 0xB8, 0x94, 0xB4, 0x2F, 0xE8, 0xD5, 0x29, 0xD9, 0xFD, 0xA4,
-    0x50, 0x45, 0x81, 0x8D, 0xB9, 0x8E, 0x2B, 0x32, 0xD0, 0xF9, 0x30, 0x2C, 0x46, 0xD2, 0x55, 0xA2,
-    0x72, 0x68, 0x1C, 0xB2, 0x72, 0x31, 0x29, 0x12, 0xCA, 0x53, 0x7F, 0x5B, 0x2C, 0x19, 0xAF, 0x5E,
-    0x5B, 0x0C, 0x56, 0x84, 0x1B, 0x6A, 0xEB, 0xC6, 0xF2, 0x9B, 0x53, 0x7B, 0x26, 0xAA, 0xC1, 0x45,
-    0x13, 0xAD, 0x51, 0x1B, 0xD2, 0x6C, 0xC1, 0xF4, 0x9E, 0x55, 0x5D, 0x34, 0xBD, 0xC5, 0xBE, 0x2B,
-    0x38, 0x59, 0x52, 0x3C, 0x0E, 0x6A, 0xFF, 0x91, 0xA8, 0x15, 0x3C, 0xC9, 0xE3, 0x92, 0x2D, 0xF6,
-    0x5F, 0x62, 0xFC, 0xF3, 0x9A, 0x9F, 0xEA, 0x21, 0xCF, 0xA6, 0x3E, 0x45, 0xB6, 0x2F, 0x9D, 0xB4,
-    0x88, 0x9A, 0xAC, 0x52, 0xBF, 0x8F, 0xF7, 0x0E, 0xEA, 0x61, 0xD5, 0x0E, 0xF4, 0x6E, 0xF8, 0xC9,
-    0x4E, 0xDD, 0x22, 0x22, 0xF6, 0x55, 0x9C, 0xB1, 0x4B, 0xAB, 0x1C, 0x8B, 0x3C, 0xE2, 0x54, 0x87,
-    0x9C, 0xB9, 0xDA, 0x64, 0x94, 0x47, 0x6F, 0x3B, 0x30, 0xFB, 0x57, 0x4A, 0xCA, 0x43, 0xF3, 0x7A,
-    0x30, 0xF3, 0x22, 0xD8, 0x34, 0xF6, 0x03, 0xA2, 0xE1, 0x26, 0x6D, 0x62, 0x22, 0x56, 0x10, 0xD6,
-    0x3E, 0x37, 0x74, 0x01, 0xE3, 0x2A, 0x8F, 0x0B, 0xDF, 0x27, 0x9B, 0xA6, 0x87, 0xEC, 0xB0, 0x3D,
-    0x89, 0xF8, 0xC1, 0x6C, 0x7A, 0x00, 0x91, 0xFF, 0x74, 0xB7, 0x92, 0xFB, 0xBB, 0xEA, 0x4B, 0x33,
-    0xBC, 0x68, 0x42, 0x3A, 0x22, 0xAB, 0x9B, 0xD4, 0x21, 0x3E, 0x63, 0x8C, 0x8C, 0x9B, 0x3C, 0x98,
-    0x72, 0x69, 0xF2, 0x41, 0x9F, 0x94, 0xAF, 0x6C, 0xCB, 0xEB, 0x18, 0x7B, 0x4F, 0x12, 0x6F, 0x4A,
-    0x58, 0x76, 0xFF, 0x8A, 0xB7, 0x85, 0x5E, 0xFB, 0xC7, 0x2F, 0x3E, 0x18, 0xB4, 0x89, 0x7F, 0xF5,
-    0xD6, 0xB4, 0x88, 0x4B, 0xD9, 0xB0, 0x39, 0x41, 0xE3, 0xDD, 0x59, 0xF5, 0x20, 0x9C, 0x14, 0x14,
-    0x43, 0xA5, 0xDC, 0x24, 0x74, 0x8E, 0x24, 0x6B, 0xE4, 0x25, 0xB9, 0x64, 0xF2, 0x52, 0xD2, 0x0E,
-    0x54, 0xBB, 0x0E, 0x7C, 0x28, 0x21, 0x26, 0x16, 0x6A, 0x07, 0x58, 0x59, 0xC7, 0x1C, 0x4F, 0x69,
-    0x62, 0xFD, 0xAA, 0x68, 0xD7, 0xDF, 0x8B, 0x86, 0x2A, 0xAE, 0x3C, 0x97, 0x54, 0x74, 0x3F, 0xC5,
-    0x3C, 0xF0, 0x07, 0x6D, 0x53, 0xBB, 0x6E, 0xD4, 0x40, 0x14, 0x3D, 0x9E, 0x21, 0xAC, 0x14, 0x17,
-    0xA6, 0x09, 0x05, 0x14, 0xFE, 0x04, 0x7F, 0xC2, 0x18, 0x22, 0x2A, 0x1A, 0x0A, 0x42, 0x4F, 0x4D,
-    0x91, 0x96, 0x26, 0xD8, 0xA1, 0xA5, 0x59, 0x1A, 0xEA, 0x14, 0x44, 0x8A, 0x96, 0x82, 0x1F, 0x80,
-    0xF5, 0x48, 0xF9, 0x81, 0x05, 0x7E, 0x60, 0x0A, 0x1A, 0x2A, 0xA6, 0x48, 0x61, 0xA2, 0xB1, 0x2F,
-    0xE7, 0xCE, 0x92, 0x10, 0x24, 0x46, 0xBA, 0xD6, 0x9D, 0xF1, 0x7D, 0x9C, 0x73, 0x1F, 0x40, 0x3E,
-    0x47, 0x14, 0x17, 0x80, 0xDD, 0xA4, 0x0A, 0xA5, 0xEA, 0x81, 0x85, 0xC7, 0xBD, 0xFD, 0x88, 0x61,
-    0xBA, 0xC0, 0x20, 0x09, 0xC3, 0xFE, 0x0C, 0xD7, 0x76, 0x6D, 0xED, 0x6B, 0x5F, 0x86, 0x72, 0x63,
-    0x52, 0xC9, 0x9F, 0x12, 0x51, 0xCB, 0x05, 0x0C, 0x05, 0xF7, 0x4F, 0xB6, 0xD1, 0x8A, 0x96, 0xCE,
-    0x72, 0xD8, 0xF3, 0x95, 0x7E, 0x70, 0x22, 0x1E, 0x76, 0x36, 0xD2, 0xC3, 0x6D, 0x1A, 0x81, 0x99,
-    0xEC, 0x9C, 0x50, 0x05, 0xF7, 0x26, 0xA2, 0xB3, 0x63, 0xE3, 0x6D, 0x72, 0xBD, 0xA0, 0xFA, 0x36,
-    0xDA, 0x11, 0xDD, 0xD0, 0x36, 0x1B, 0x46, 0x2B, 0x04, 0xA5, 0x1C, 0x77, 0x23, 0x1A, 0x51, 0xF7,
-    0x41, 0x64, 0x62, 0x4C, 0x91, 0xA0, 0xEA, 0x0C, 0x1B, 0xBB, 0xB9, 0x85, 0xC1, 0x8D, 0xE3, 0x3C,
-    0x50, 0x32, 0x5D, 0x21, 0x1B, 0x5E, 0x66, 0x72, 0xF8, 0x19, 0x61, 0xD2, 0x00, 0x74, 0x8F, 0x09,
-    0x32, 0x74, 0xAD, 0x4D, 0x8B, 0x11, 0x43, 0xEB, 0x7C, 0x13, 0xA8, 0x26, 0x7A, 0x48, 0x6B, 0xA7,
-    0x9A, 0x51, 0xBF, 0x52, 0x12, 0x71, 0x4A, 0x6F, 0xF9, 0x81, 0xA6, 0x3C, 0xBC, 0x94, 0xA5, 0x8D,
-    0x4D, 0x8F, 0x54, 0x6D, 0xB0, 0xB6, 0x11, 0xEE, 0x01, 0x41, 0xFB, 0x35, 0x16, 0xD1, 0xC1, 0x8C,
-    0x95, 0xC7, 0xB4, 0x08, 0x70, 0xF6, 0x02, 0xB5, 0x4F, 0x28, 0x43, 0x07, 0x7B, 0x41, 0xEB, 0xB3,
-    0xDD, 0x65, 0x46, 0x53, 0xF9, 0x69, 0xFB, 0xB0, 0x5E, 0xC4, 0x6C, 0x61, 0xA3, 0x6B, 0xB3, 0x4B,
-    0xD3, 0xA7, 0x1C, 0x03, 0xA9, 0x0C, 0x39, 0x68, 0x19, 0xF4, 0xC2, 0x2C, 0xCE, 0x8C, 0xCA, 0x2E,
-    0x10, 0x51, 0x32, 0xAB, 0xD5, 0x4A, 0x4B, 0x37, 0x51, 0x12, 0xBA, 0xD5, 0x7B, 0x38, 0xB6, 0xA4,
-    0x26, 0xB5, 0x2A, 0x82, 0x91, 0x01, 0x43, 0x29, 0xA8, 0xD3, 0x11, 0x24, 0x49, 0x6A, 0xEC, 0x84,
-    0xB0, 0x5E, 0x73, 0x76, 0xDB, 0x3B, 0x78, 0xAA, 0x38, 0x6E, 0x0F, 0x52, 0x89, 0x34, 0xC2, 0x60,
-    0x7C, 0x62, 0x63, 0x4A, 0xED, 0x14, 0x68, 0xC4, 0xE8, 0xBC, 0x82, 0x88, 0x78, 0xB4, 0xEF, 0x44,
-    0xC6, 0x0F, 0x99, 0xF2, 0xE8, 0x6F, 0xC2, 0xD6, 0xFB, 0xA8, 0x2A, 0x13, 0xE0, 0x4E, 0x45, 0x53,
-    0x7B, 0xAE, 0xA6, 0xDD, 0x40, 0x53, 0x2B, 0x6A, 0xAA, 0x95, 0x66, 0xA3, 0xD5, 0xB4, 0x1E, 0xFF,
-    0x76, 0x63, 0x38, 0x9E, 0x08, 0xE5, 0xE3, 0x54, 0x68, 0x65, 0xAB, 0x8D, 0x7B, 0x1B, 0x3F, 0xE3,
-    0xA5, 0x3D, 0x8F, 0xC6, 0x37, 0x55, 0xDF, 0xBC, 0x1B, 0xB5, 0xD8, 0x9E, 0x42, 0x83, 0x4B, 0x09,
-    0xC5, 0xFA, 0xE1, 0xAF, 0xEC, 0x76, 0x4B, 0x3F, 0x9D, 0x42, 0x1A, 0x34, 0x58, 0xF7, 0xE8, 0x0A,
-    0x66, 0xC6, 0xA2, 0x54, 0xB7, 0x00, 0xCD, 0x78, 0x8D, 0xFA, 0x15, 0xFE, 0xB1, 0x29, 0xFF, 0x63,
-    0xF3, 0x5C, 0x14, 0xA2, 0x28, 0x6F, 0x0E, 0x21, 0x71, 0x79, 0x1D, 0x93, 0xFE, 0x1A, 0x6C, 0xE3,
-    0xAB, 0x50, 0x8E, 0x96, 0x58, 0xDA, 0xEB, 0xB7, 0x29, 0x4F, 0x4A, 0x1D, 0xAB, 0x9C, 0x04, 0x66,
-    0x36, 0xBD, 0x9B, 0xEA, 0xD7, 0xE3, 0x94, 0xAA, 0x2F, 0x12, 0x76, 0x8A, 0x5C, 0xA1, 0x42, 0xCC,
-    0x49, 0x2D, 0x95, 0x4F, 0x47, 0x6C, 0xB3, 0x96, 0x63, 0x7D, 0x73, 0x22, 0x51, 0x68, 0xA9, 0x6D,
-    0xF8, 0xB3, 0x4F, 0x79, 0xB1, 0xF0, 0x89, 0x3D, 0xF9, 0xC0, 0x96, 0x36, 0xBA, 0x1B, 0xEC, 0xF6,
-    0x19, 0x59, 0xAA, 0xA9, 0xA6, 0xE1, 0xD5, 0x13, 0xA7, 0x6C, 0xD8, 0xB5, 0xD5, 0x32, 0x37, 0xC1,
-    0xE8, 0x7B, 0x19, 0xAF, 0xD8, 0xED, 0xDD, 0x88, 0x6E, 0x94, 0x69, 0x13, 0x94, 0x5A, 0x54, 0x52,
-    0xDC, 0x07, 0x19, 0x55, 0x61, 0x2E, 0xA7, 0x6E, 0xB5, 0x7C, 0xCF, 0x33, 0xC1, 0x89, 0x3C, 0x14,
-    0xA5, 0x76, 0x98, 0x89, 0x0F, 0x1E, 0xA7, 0x28, 0x96, 0xAC, 0xC5, 0xA9, 0x16, 0x84, 0xF3, 0xB0,
-    0xF3, 0x42, 0x32, 0xCB, 0x83, 0x6D, 0x60, 0x9B, 0xE7, 0x42, 0xB1, 0x97, 0xEA, 0x95, 0x77, 0x9B,
-    0x33, 0x95, 0xB7, 0x5A, 0xD5, 0x4E, 0xB7, 0x6C, 0x48, 0x94, 0x4C, 0x61, 0x6E, 0x0D, 0x85, 0x1B,
-    0x4E, 0x03, 0xBB, 0xC4, 0x5D, 0xE0, 0xD9, 0x20, 0x2D, 0xA7, 0x4E, 0x5A, 0x27, 0x3F, 0x9E, 0x6C,
-    0xA3, 0xFE, 0x06,
+static const uint8_t opendyslexic_10_bolditalicBitmaps[25569] = {
+    0xBD, 0x9A, 0x4D, 0xAC, 0x26, 0xC7, 0x75, 0x9E, 0x9F, 0xEE, 0x0A, 0xA7, 0x01, 0x16, 0xC0, 0xD2,
+    0x82, 0xB2, 0x15, 0x52, 0x70, 0x07, 0x41, 0x16, 0x11, 0xE3, 0xB8, 0x37, 0x5E, 0x38, 0x00, 0x39,
+    0xD5, 0xE2, 0x20, 0x10, 0x10, 0x07, 0x20, 0x03, 0x88, 0xDE, 0x68, 0xC1, 0x4D, 0x16, 0xB1, 0x60,
+    0x60, 0xB2, 0xC8, 0xC6, 0x00, 0x67, 0xBA, 0x49, 0x02, 0xD1, 0x22, 0x0B, 0x8D, 0x81, 0x68, 0x9B,
+    0x30, 0x80, 0x02, 0x90, 0xA3, 0x44, 0x74, 0x76, 0x04, 0x32, 0x73, 0xBB, 0xC8, 0x59, 0x70, 0xC1,
+    0x85, 0x5A, 0x22, 0x02, 0x01, 0xE1, 0x82, 0x2D, 0x93, 0xB4, 0x1C, 0xCE, 0x82, 0x65, 0x4D, 0x4B,
+    0xAC, 0x19, 0x56, 0xF7, 0x9B, 0x45, 0xF5, 0xBD, 0x33, 0xC3, 0x9F, 0x44, 0x0E, 0x1C, 0x15, 0x70,
+    0xEF, 0xFD, 0xEA, 0x7E, 0xDD, 0xE7, 0x9C, 0x3A, 0x75, 0xEA, 0xFC, 0xBC, 0xA7, 0x00, 0x78, 0x18,
+    0x7E, 0x17, 0xCE, 0xC3, 0x25, 0xC8, 0x90, 0xA8, 0x57, 0x4C, 0xC4, 0x44, 0xEC, 0x82, 0x9B, 0x69,
+    0x03, 0xDD, 0x48, 0xD7, 0x63, 0xA1, 0xE2, 0xDE, 0x51, 0xBF, 0x8C, 0x4D, 0xB8, 0x44, 0xBB, 0xE2,
+    0x57, 0x86, 0x08, 0xE0, 0xB2, 0x8F, 0xD3, 0x1B, 0x6A, 0x72, 0x1B, 0x7D, 0x90, 0xD9, 0x5C, 0xEC,
+    0x16, 0x3D, 0x2F, 0x9B, 0xA1, 0x8E, 0x5D, 0x0F, 0x9C, 0x37, 0x11, 0xB0, 0xF3, 0x65, 0x80, 0xEC,
+    0x66, 0xA0, 0x1D, 0x33, 0x58, 0x49, 0xCA, 0x48, 0x92, 0xE8, 0x24, 0x69, 0x81, 0xCD, 0x2D, 0x40,
+    0x17, 0x32, 0x60, 0x52, 0x17, 0x80, 0xC1, 0xAC, 0xE0, 0x24, 0x69, 0xAD, 0xCB, 0xC3, 0x5E, 0x92,
+    0x66, 0x4C, 0x2E, 0xDF, 0x5F, 0x48, 0x80, 0x8B, 0x43, 0x0F, 0xD5, 0x6E, 0x23, 0x9F, 0x1E, 0x2D,
+    0xC0, 0x35, 0xC0, 0x2C, 0x60, 0xF5, 0x3E, 0x46, 0x0A, 0x78, 0x6D, 0x18, 0x3D, 0x35, 0xD2, 0x2E,
+    0x4F, 0xC0, 0x54, 0x45, 0x8C, 0xFE, 0x30, 0x60, 0x25, 0x70, 0x52, 0x4F, 0x23, 0xF5, 0x30, 0x08,
+    0x50, 0xE6, 0x8A, 0x51, 0x74, 0xB7, 0x9F, 0xD5, 0xF3, 0x92, 0xB2, 0x93, 0xD4, 0x9F, 0x9B, 0x34,
+    0x03, 0x4F, 0x00, 0x55, 0x04, 0x6C, 0x00, 0xBE, 0x5C, 0x58, 0x7E, 0x13, 0xA8, 0x56, 0x1E, 0xA6,
+    0x99, 0x2B, 0xF5, 0x6E, 0x6C, 0x6E, 0x8C, 0x1E, 0x67, 0x42, 0xE6, 0x21, 0xF3, 0x62, 0xE4, 0x21,
+    0xF7, 0x87, 0x33, 0x4E, 0x5D, 0x8F, 0xCD, 0x97, 0xA1, 0xFA, 0x17, 0xE9, 0x04, 0xCC, 0xAD, 0x9B,
+    0x23, 0xEE, 0xAD, 0x17, 0x03, 0xFE, 0x29, 0x13, 0xD8, 0x9C, 0x1D, 0xEB, 0xE4, 0x84, 0x5D, 0x6C,
+    0xA6, 0x0D, 0xD5, 0xD3, 0x07, 0x71, 0x9B, 0xA0, 0xBD, 0x39, 0xE3, 0xFA, 0xE7, 0xB0, 0xA3, 0xC3,
+    0xCC, 0x36, 0x70, 0xAD, 0x9D, 0x71, 0xD3, 0x42, 0xAD, 0x99, 0x5A, 0x23, 0xB5, 0xA2, 0x7B, 0x21,
+    0xFB, 0x66, 0xD9, 0xCC, 0xC7, 0xD1, 0x8F, 0x7E, 0x6D, 0xF7, 0x29, 0x19, 0x49, 0x0C, 0xFA, 0xA4,
+    0x3F, 0xB7, 0x5F, 0xE9, 0x0F, 0xE5, 0xE8, 0xC6, 0x6E, 0x53, 0x1B, 0x7D, 0xD0, 0x93, 0x3B, 0xD4,
+    0x3D, 0xF8, 0x91, 0x3A, 0x41, 0x17, 0xA8, 0x32, 0xB8, 0x19, 0x76, 0xB0, 0x11, 0x7C, 0x4F, 0x9D,
+    0xC0, 0x05, 0x38, 0x01, 0xB3, 0x42, 0x7B, 0xF7, 0xA3, 0x0B, 0xE0, 0xA1, 0xCA, 0xD0, 0xC4, 0xF2,
+    0xCD, 0x70, 0x4C, 0xD7, 0x42, 0xC5, 0x8F, 0x20, 0xA8, 0x36, 0xA8, 0x5F, 0x83, 0xAF, 0x14, 0xA2,
+    0x5D, 0x80, 0x1D, 0x4C, 0x2A, 0xEF, 0x4C, 0xE5, 0xE3, 0x29, 0x8F, 0x08, 0xDD, 0x08, 0x87, 0x1C,
+    0x97, 0x0B, 0x6D, 0x5F, 0x38, 0xFA, 0x1E, 0x93, 0xC0, 0x8F, 0x67, 0xB3, 0x15, 0x86, 0x1E, 0x1B,
+    0x41, 0xD0, 0x2E, 0xD4, 0x7F, 0x55, 0xEC, 0x36, 0x42, 0xFA, 0x07, 0xBF, 0xF7, 0xC4, 0x73, 0x9D,
+    0x54, 0x6B, 0xA3, 0xDD, 0x18, 0xB4, 0xFA, 0x3D, 0xBB, 0xEE, 0xAB, 0xB8, 0x40, 0x5D, 0x74, 0xE1,
+    0x02, 0x6E, 0xA4, 0xED, 0xE9, 0xF0, 0xDA, 0x07, 0x6D, 0xDF, 0xD6, 0xCB, 0x5C, 0x83, 0x4C, 0x95,
+    0xA8, 0x5E, 0x02, 0x50, 0xF0, 0x4B, 0x1B, 0xDD, 0xDA, 0x64, 0xB3, 0xD5, 0x3B, 0x5F, 0x7E, 0xE6,
+    0x19, 0xAF, 0xDD, 0x6B, 0x3B, 0x77, 0x65, 0x6B, 0xDF, 0xCE, 0x43, 0xB8, 0xC7, 0xE8, 0xFE, 0xE4,
+    0x94, 0x73, 0x31, 0xBB, 0xC3, 0x3C, 0x68, 0x47, 0x00, 0x0F, 0xC0, 0x65, 0x00, 0x32, 0x40, 0xBD,
+    0x42, 0x59, 0x2E, 0xD8, 0xF9, 0x90, 0x06, 0xF0, 0xFD, 0xA7, 0x1F, 0x4C, 0xF7, 0x3C, 0xB8, 0x7C,
+    0xFA, 0xC1, 0x01, 0x80, 0x0D, 0x8A, 0xE6, 0x8B, 0x9E, 0xEE, 0x7F, 0xB0, 0x1B, 0xEF, 0x3E, 0xB8,
+    0x7F, 0xE6, 0xC1, 0x72, 0xA4, 0x47, 0x80, 0x7F, 0x08, 0xC0, 0x97, 0x8E, 0xA3, 0xBF, 0x43, 0xAB,
+    0x80, 0xBF, 0x10, 0xC9, 0x75, 0xAC, 0xD3, 0x93, 0xD1, 0xDC, 0xBA, 0x15, 0x9B, 0x8F, 0x6F, 0x45,
+    0x7B, 0xF3, 0xE7, 0xD1, 0xBD, 0xF3, 0xCE, 0xE2, 0x6E, 0x7C, 0x37, 0xB4, 0xC1, 0x87, 0x6E, 0x51,
+    0xDF, 0x49, 0xB4, 0xDA, 0x70, 0x4A, 0x58, 0x2D, 0x54, 0x27, 0x3D, 0xF0, 0x5F, 0xB1, 0x1B, 0x5D,
+    0xC6, 0x27, 0xFE, 0xFE, 0x8A, 0x89, 0x34, 0xF7, 0xFA, 0x9C, 0x80, 0x1F, 0x1F, 0x98, 0xBE, 0xD7,
+    0x6A, 0xEB, 0x94, 0xBD, 0x32, 0xE7, 0xD4, 0xE3, 0x15, 0xF1, 0x4A, 0xFC, 0x69, 0x9D, 0xE9, 0xAB,
+    0x5C, 0xD6, 0xDF, 0xAC, 0xD0, 0x2E, 0x30, 0x05, 0x1A, 0x81, 0xCF, 0x54, 0x8A, 0x34, 0xFA, 0xA0,
+    0x77, 0xD2, 0xD8, 0x4A, 0xBD, 0x97, 0x7A, 0xAA, 0x6F, 0x82, 0x36, 0xAC, 0x36, 0xBE, 0x46, 0x2E,
+    0x9B, 0xE1, 0x46, 0xAA, 0x8C, 0xD3, 0xCC, 0xB0, 0x51, 0x4F, 0xF9, 0xB0, 0xDD, 0xF9, 0xA1, 0x7F,
+    0x2A, 0x26, 0x65, 0x23, 0xCD, 0x9D, 0x36, 0x5A, 0x8D, 0x40, 0xBD, 0xC0, 0x06, 0x3E, 0xE0, 0x32,
+    0xE6, 0xA3, 0x91, 0xDB, 0x89, 0xF3, 0xBE, 0x77, 0x37, 0xA2, 0x89, 0x03, 0xD2, 0xDE, 0x49, 0x6F,
+    0x4B, 0x99, 0xBA, 0x3C, 0xD5, 0x24, 0x98, 0x8A, 0x2D, 0x3D, 0x78, 0xF5, 0x65, 0x26, 0x2D, 0x46,
+    0xEA, 0xDD, 0x08, 0xD7, 0xCA, 0x96, 0xB9, 0x0F, 0x7B, 0x06, 0x85, 0x5A, 0x0A, 0x0F, 0x30, 0x94,
+    0x2D, 0xB5, 0xD1, 0x7E, 0x4F, 0xA3, 0x57, 0xAE, 0xA4, 0xD9, 0x69, 0xE3, 0xD1, 0xBD, 0x07, 0xA6,
+    0x44, 0xA7, 0xD9, 0x48, 0x7D, 0x37, 0x52, 0x25, 0x70, 0xFF, 0xF3, 0x0A, 0x83, 0x16, 0x23, 0x2D,
+    0x2E, 0x75, 0x61, 0x18, 0x7D, 0x9D, 0xAB, 0x6C, 0x17, 0xBB, 0x74, 0x3F, 0x16, 0x83, 0x12, 0xD2,
+    0xC8, 0xB4, 0xF0, 0xD8, 0xD5, 0xFF, 0xEC, 0xA4, 0xEF, 0x48, 0x01, 0x1B, 0x31, 0x2B, 0x75, 0x86,
+    0x1D, 0x26, 0xF0, 0x23, 0x5D, 0xA0, 0x8D, 0xB8, 0x95, 0x26, 0x63, 0x76, 0x6A, 0x81, 0x46, 0xA8,
+    0xD5, 0x33, 0x68, 0x6C, 0x56, 0x8F, 0xEF, 0xAF, 0x91, 0x4D, 0x6C, 0x62, 0x17, 0x9C, 0x32, 0x56,
+    0x63, 0x25, 0xF5, 0xDD, 0x3C, 0x55, 0x99, 0xEC, 0x96, 0x26, 0xFA, 0x30, 0x8D, 0xD2, 0x56, 0x4B,
+    0x73, 0xAD, 0x0D, 0x9E, 0x39, 0xA2, 0x8A, 0xD5, 0x88, 0xD7, 0xC2, 0xD6, 0xC4, 0x3A, 0xD6, 0xD1,
+    0xCC, 0x75, 0x6C, 0x82, 0x89, 0x4D, 0x68, 0xA2, 0x9D, 0xBB, 0xA5, 0x91, 0xE6, 0x5A, 0x0A, 0x0C,
+    0x0A, 0xD0, 0xF5, 0x7F, 0xB7, 0x9A, 0xF0, 0xDA, 0xF0, 0x5A, 0xB9, 0xA8, 0xB1, 0xD8, 0xD9, 0xD0,
+    0x77, 0xC1, 0x45, 0x9B, 0x8D, 0xEE, 0x46, 0x9D, 0x8C, 0x98, 0x46, 0x3F, 0xB7, 0x2B, 0xD8, 0x88,
+    0x0F, 0xF5, 0x8E, 0x4B, 0x0C, 0xF3, 0x3D, 0xA7, 0xAD, 0x7A, 0x86, 0x2E, 0xA2, 0xD1, 0x64, 0xBA,
+    0xA5, 0x12, 0x6E, 0xE5, 0xDB, 0xE3, 0xE9, 0x97, 0xBF, 0x0B, 0x74, 0x0B, 0x74, 0x3B, 0x74, 0xEA,
+    0xE9, 0x34, 0xD2, 0x69, 0xC4, 0x28, 0x40, 0xA7, 0x2B, 0xD4, 0xD2, 0x6D, 0xB8, 0x28, 0xF5, 0x3C,
+    0xAA, 0x04, 0xD5, 0x14, 0x80, 0xAF, 0xF2, 0x47, 0x3F, 0xA8, 0xA4, 0x59, 0x5A, 0x1F, 0x2E, 0x92,
+    0xBC, 0xAA, 0x5A, 0x7A, 0x5D, 0x77, 0x5E, 0x82, 0xC3, 0xF1, 0xBB, 0x15, 0x1A, 0xCD, 0x85, 0x6E,
+    0xA5, 0x0D, 0x1A, 0xAD, 0xD0, 0x6D, 0x54, 0x93, 0xB8, 0x28, 0xBD, 0x2D, 0xDD, 0x46, 0x7B, 0xCF,
+    0xB0, 0xC0, 0xD7, 0xEE, 0x0A, 0xFC, 0x4D, 0xE8, 0x34, 0x56, 0xD2, 0x52, 0x6F, 0x4D, 0x64, 0xAE,
+    0xD7, 0xE2, 0x04, 0xCC, 0x5A, 0x4C, 0xC5, 0x2E, 0xD0, 0x06, 0x2A, 0xF5, 0xB4, 0x1B, 0xF8, 0x15,
+    0x86, 0xB1, 0x98, 0x97, 0xA0, 0x3A, 0x5C, 0xF5, 0xBD, 0xC3, 0x2E, 0xC5, 0x49, 0x76, 0x33, 0xF8,
+    0x00, 0x8F, 0x8D, 0x77, 0xBF, 0xFB, 0x47, 0xEF, 0x43, 0x25, 0x8D, 0xD4, 0x7B, 0x95, 0xA8, 0x13,
+    0x8E, 0x7A, 0xA5, 0x9A, 0xEB, 0xF8, 0xDF, 0xC7, 0xDF, 0x67, 0xFD, 0x78, 0x7E, 0x88, 0xFC, 0xE7,
+    0xFF, 0xBA, 0xE9, 0xCF, 0xFF, 0xFE, 0x57, 0x4D, 0x68, 0xFF, 0x79, 0x5B, 0x2F, 0xF6, 0x6D, 0xDD,
+    0x88, 0x75, 0x3A, 0x51, 0x64, 0xA2, 0x99, 0x69, 0x57, 0x9E, 0xC6, 0x48, 0x09, 0xBC, 0x76, 0xA8,
+    0xA5, 0x11, 0xAA, 0x67, 0xCE, 0x1C, 0x4E, 0x37, 0x43, 0xB3, 0x03, 0x5A, 0xA0, 0x9B, 0xA0, 0xF9,
+    0x38, 0xC2, 0xE6, 0xA1, 0x7B, 0x31, 0x62, 0xA2, 0xEF, 0xD9, 0xCD, 0x4A, 0x17, 0xFC, 0x68, 0xA4,
+    0x84, 0xA4, 0xD0, 0x49, 0xD9, 0x48, 0x0A, 0xC2, 0xE4, 0x76, 0xC1, 0xBF, 0x9D, 0x31, 0x1B, 0x5E,
+    0x0B, 0x4E, 0xA2, 0xB9, 0x33, 0x2D, 0x75, 0x26, 0xB3, 0xE3, 0xF1, 0x7D, 0xDB, 0xB7, 0xA1, 0x0B,
+    0x56, 0x9A, 0x8D, 0xB4, 0x20, 0xED, 0x0C, 0x74, 0xA1, 0x1B, 0x9B, 0xD5, 0xCD, 0x75, 0x6E, 0xEE,
+    0xFC, 0x40, 0xB5, 0xA4, 0x51, 0x52, 0xF0, 0x52, 0x68, 0xB5, 0x9F, 0xAA, 0xA8, 0x7A, 0x75, 0x07,
+    0x69, 0x61, 0x50, 0xA6, 0x93, 0x42, 0xA3, 0xBE, 0x18, 0xBE, 0x5F, 0xA0, 0xC9, 0x94, 0x89, 0x5B,
+    0xA1, 0x12, 0xD0, 0xAD, 0x50, 0x6B, 0x7E, 0x94, 0x4E, 0x8A, 0x95, 0x24, 0x5C, 0x79, 0x7B, 0xA7,
+    0x92, 0x66, 0xF0, 0x7A, 0x1F, 0xBC, 0xD4, 0x33, 0x48, 0x33, 0xD3, 0x55, 0x45, 0x84, 0x5B, 0xD9,
+    0x31, 0x6B, 0xB5, 0x61, 0xD6, 0x3A, 0x63, 0x56, 0x93, 0x31, 0xD1, 0x24, 0x9A, 0xD8, 0xAC, 0xB8,
+    0xC5, 0x46, 0xFC, 0xEC, 0xE2, 0x6F, 0x29, 0xB4, 0x92, 0xFA, 0xEE, 0xC8, 0x65, 0x32, 0xBE, 0x50,
+    0xBF, 0x03, 0x3C, 0xF8, 0xAA, 0x42, 0x2D, 0x25, 0xBC, 0x54, 0xBC, 0xF2, 0x70, 0xEA, 0x98, 0x77,
+    0xA0, 0x55, 0x2E, 0xBA, 0xF7, 0x5A, 0x31, 0xB7, 0x81, 0x09, 0x70, 0x11, 0xD0, 0xD5, 0x97, 0x69,
+    0xA5, 0x50, 0x1F, 0x14, 0x43, 0x23, 0x65, 0x78, 0x70, 0x12, 0x46, 0x0A, 0x95, 0x34, 0xB3, 0x1F,
+    0xC1, 0xA7, 0x0D, 0xE0, 0xB4, 0x61, 0x24, 0x2A, 0x29, 0x30, 0x5D, 0xBD, 0x82, 0xEF, 0xCB, 0x17,
+    0x36, 0x82, 0xC9, 0xC5, 0xCA, 0x98, 0xFA, 0x62, 0x4E, 0x6D, 0x3C, 0x3D, 0x68, 0xD4, 0xD2, 0xC2,
+    0x24, 0xF5, 0x4E, 0xDA, 0xD0, 0xCA, 0xD3, 0xCD, 0x4E, 0x51, 0x25, 0x02, 0xEC, 0x0A, 0xF8, 0xF0,
+    0xE0, 0xBF, 0x47, 0x78, 0x7D, 0x27, 0xA3, 0xAD, 0x8B, 0xD5, 0xC5, 0x75, 0x0A, 0x9C, 0x54, 0xFA,
+    0xE0, 0xD9, 0x64, 0x24, 0xCD, 0xF6, 0x50, 0x6B, 0xE2, 0x9C, 0xFE, 0x57, 0x11, 0x69, 0xA7, 0x0B,
+    0xD5, 0x86, 0x0F, 0x75, 0xC6, 0x8F, 0x26, 0x33, 0xF5, 0x26, 0x21, 0x9A, 0x15, 0x61, 0xD7, 0x6A,
+    0xC7, 0xC5, 0x7A, 0xA3, 0x8D, 0x66, 0xA3, 0x5B, 0x9A, 0x53, 0x2A, 0xC1, 0x9D, 0xFE, 0x1A, 0xDB,
+    0x3B, 0x57, 0xD5, 0x77, 0xB1, 0x52, 0xEF, 0x97, 0x5A, 0x0C, 0xB3, 0x11, 0x74, 0xA3, 0xC9, 0xF8,
+    0xD1, 0xAC, 0x0C, 0xD8, 0x85, 0x0D, 0x17, 0xAA, 0xD3, 0x7F, 0xF4, 0x36, 0x22, 0xDA, 0xA5, 0xDE,
+    0xF1, 0x73, 0x9D, 0xB9, 0x2B, 0xFE, 0xB1, 0x7E, 0x1B, 0x4F, 0x67, 0xDB, 0xD9, 0x6C, 0x3C, 0x66,
+    0xEE, 0x74, 0x56, 0xDF, 0x3F, 0xCB, 0xA7, 0xB3, 0xA1, 0xE7, 0x2B, 0x36, 0x17, 0xD3, 0x6B, 0x24,
+    0xF0, 0x8A, 0xA0, 0xFD, 0xEC, 0x60, 0x9A, 0xD4, 0x2D, 0xB4, 0xAF, 0x0B, 0x4E, 0x5C, 0xC4, 0xAC,
+    0x82, 0xF6, 0x47, 0x2B, 0xEC, 0x53, 0x8F, 0xF9, 0x24, 0x41, 0xA7, 0x11, 0x94, 0xA1, 0x51, 0x28,
+    0x1E, 0x8C, 0xE2, 0x65, 0x32, 0x78, 0x65, 0xD8, 0x87, 0x84, 0x5D, 0x95, 0xF0, 0x41, 0x6B, 0xA5,
+    0x5A, 0x2B, 0xB8, 0x05, 0x32, 0x74, 0xA1, 0x24, 0x48, 0x3D, 0x4D, 0x49, 0x89, 0xDC, 0x42, 0x75,
+    0xF7, 0xFF, 0xF7, 0xA4, 0x4A, 0xD2, 0x4F, 0xA4, 0xEC, 0xA5, 0x37, 0xA5, 0x84, 0x5B, 0x69, 0x23,
+    0xC3, 0x8C, 0x46, 0xA3, 0xD1, 0x6E, 0x38, 0x31, 0xAC, 0x0C, 0xD9, 0x28, 0xD4, 0x8A, 0x9D, 0x70,
+    0x7A, 0x5D, 0x89, 0x41, 0x4F, 0x69, 0xAE, 0xF7, 0x6D, 0x9A, 0x70, 0x37, 0xF5, 0x49, 0xC6, 0x5F,
+    0xD4, 0xBB, 0x4B, 0xBD, 0x0D, 0xDB, 0xD4, 0xBB, 0xBF, 0xD6, 0xAD, 0x0D, 0xFF, 0xA6, 0x9E, 0x8D,
+    0xD5, 0xEE, 0xF2, 0x14, 0x6C, 0xF2, 0x37, 0x76, 0xFC, 0xBC, 0xB7, 0x6B, 0x25, 0x98, 0x4A, 0xAE,
+    0x34, 0x60, 0x36, 0xBA, 0x11, 0x8D, 0x6E, 0x66, 0x58, 0x9A, 0x88, 0xCF, 0x75, 0xC2, 0x89, 0x8D,
+    0x46, 0xF3, 0x80, 0x51, 0xEA, 0x46, 0x34, 0xB9, 0x99, 0xE9, 0xD5, 0x37, 0x23, 0xFE, 0xA7, 0xBF,
+    0xC8, 0xB8, 0xB8, 0x6D, 0xD8, 0xEC, 0x85, 0xD9, 0x9D, 0x42, 0xA5, 0x0B, 0x5A, 0x98, 0xE6, 0x29,
+    0xE2, 0x63, 0x9B, 0x69, 0x73, 0xB3, 0x03, 0xB4, 0x1B, 0x30, 0x29, 0x82, 0x24, 0xD0, 0xD8, 0x2D,
+    0xA8, 0x37, 0x99, 0xA9, 0x67, 0x2A, 0xC1, 0xB0, 0x0D, 0xD8, 0xE8, 0x22, 0x26, 0x9B, 0x15, 0xF6,
+    0x6A, 0x83, 0xA9, 0x9F, 0x7A, 0x86, 0xD0, 0xDD, 0x7E, 0x40, 0x8B, 0x95, 0x14, 0x6B, 0x49, 0x2B,
+    0x5E, 0x4A, 0x34, 0x52, 0x2A, 0x21, 0xE3, 0x18, 0x0F, 0x5E, 0xED, 0x31, 0xA7, 0x5E, 0xE1, 0xA4,
+    0xCA, 0x78, 0x3A, 0xDA, 0xE0, 0x82, 0x5D, 0xDA, 0x68, 0xA4, 0xB5, 0x92, 0x32, 0x93, 0x32, 0x5E,
+    0x2B, 0xED, 0x9D, 0x1E, 0xBB, 0x1E, 0x87, 0x4B, 0xC0, 0x74, 0x78, 0xA0, 0x76, 0xBD, 0xA7, 0x5A,
+    0xD9, 0xA0, 0x96, 0x02, 0x4E, 0x8A, 0xF8, 0xB5, 0x5D, 0x99, 0x46, 0x93, 0xEA, 0x1D, 0x93, 0x4D,
+    0xC6, 0x64, 0xBB, 0x62, 0x92, 0x8B, 0x98, 0xE4, 0x16, 0x9A, 0xB5, 0x9D, 0xB1, 0xB1, 0x9D, 0x1F,
+    0x76, 0x4B, 0xBB, 0xF8, 0xA9, 0x78, 0x16, 0x77, 0x9C, 0xAD, 0x8C, 0x91, 0x56, 0x18, 0x94, 0x01,
+    0xBF, 0x03, 0x9D, 0x0E, 0xB1, 0xAD, 0xE6, 0x72, 0xFC, 0x6F, 0x7F, 0x6B, 0xE6, 0x1A, 0x09, 0xCF,
+    0x79, 0xDA, 0xB1, 0xEB, 0xED, 0xEC, 0x82, 0xF9, 0xE5, 0xC5, 0xA5, 0x92, 0x22, 0x93, 0x16, 0xBC,
+    0x32, 0xED, 0xEA, 0x7B, 0x9B, 0xDC, 0x62, 0x36, 0x93, 0x2A, 0xD5, 0x62, 0x0A, 0x0A, 0x7E, 0xF1,
+    0xF1, 0xC1, 0xEF, 0x3F, 0xF2, 0x32, 0xF0, 0xA8, 0xAE, 0x9C, 0x3A, 0x94, 0x11, 0xCD, 0x5F, 0xA2,
+    0x5D, 0x8E, 0x83, 0xD0, 0x05, 0xA8, 0xF5, 0x3E, 0xB4, 0x4A, 0x30, 0x28, 0xC2, 0x45, 0x05, 0x68,
+    0x33, 0xE0, 0xC3, 0x43, 0x7D, 0x93, 0x8D, 0x7E, 0xA0, 0x51, 0xD2, 0xD2, 0x49, 0x89, 0x47, 0xF5,
+    0x3E, 0x8F, 0x5D, 0xBD, 0x7A, 0xF5, 0x29, 0x49, 0x6F, 0x4A, 0xFA, 0x85, 0xA4, 0x84, 0x5B, 0x4A,
+    0xE2, 0x57, 0xE7, 0xC3, 0xCB, 0xF8, 0x11, 0xDA, 0xB9, 0x1C, 0xB4, 0xCF, 0xF5, 0x56, 0x36, 0x81,
+    0xD9, 0x00, 0xFC, 0x52, 0x0B, 0xB7, 0xA2, 0xB1, 0xC9, 0xF8, 0xB9, 0x16, 0x6D, 0x64, 0xEA, 0x6D,
+    0xC2, 0x07, 0xB3, 0xE1, 0x22, 0xA2, 0x49, 0x0C, 0xA1, 0xDE, 0xE8, 0x66, 0x84, 0x8B, 0xC5, 0xFF,
+    0xB4, 0x73, 0xB5, 0x63, 0x53, 0x25, 0x6A, 0x49, 0x01, 0x49, 0x33, 0x5E, 0x8A, 0x34, 0x52, 0x84,
+    0x49, 0xCB, 0xB1, 0x6B, 0x13, 0xF8, 0xB7, 0x22, 0xCD, 0x3A, 0xC1, 0x6E, 0x57, 0x7C, 0x98, 0x7A,
+    0x9B, 0x9A, 0x54, 0x89, 0x21, 0xF8, 0xB9, 0xC9, 0x36, 0x33, 0xBC, 0x2E, 0x9A, 0xEC, 0x17, 0xFC,
+    0x3B, 0x19, 0xA3, 0x23, 0xBD, 0x35, 0xDA, 0xC0, 0x6B, 0xC4, 0x28, 0x96, 0x3D, 0x32, 0x0A, 0xF0,
+    0xC8, 0x15, 0xE0, 0xAA, 0x5B, 0x81, 0xE1, 0xC5, 0x0D, 0xF0, 0x41, 0x3D, 0x74, 0x8B, 0x9F, 0xC1,
+    0x45, 0xB7, 0x9A, 0x68, 0x93, 0xD9, 0x4C, 0x36, 0x19, 0x3D, 0xA9, 0x27, 0x77, 0xFC, 0xEB, 0x5A,
+    0x84, 0x8B, 0xCA, 0xD3, 0xD8, 0x64, 0xC9, 0x87, 0x4A, 0xD2, 0x47, 0x0B, 0x83, 0x7E, 0xA4, 0x48,
+    0xAB, 0xF7, 0x94, 0xB0, 0x8A, 0x53, 0xA6, 0x56, 0xEC, 0x36, 0x98, 0x92, 0x15, 0x74, 0xB9, 0x52,
+    0x5F, 0x3C, 0x56, 0x17, 0x8A, 0x47, 0x34, 0xA9, 0xCA, 0xE0, 0xC3, 0xD0, 0x53, 0xEF, 0xED, 0x0C,
+    0xEE, 0xE3, 0xC4, 0xE1, 0xB8, 0xAC, 0x02, 0xE0, 0x23, 0x47, 0xBC, 0x47, 0x11, 0xF0, 0xEA, 0xC1,
+    0x29, 0x83, 0xD9, 0xA7, 0x19, 0xF4, 0xE6, 0x0E, 0x3E, 0xFA, 0x88, 0xCB, 0xB5, 0x46, 0x23, 0xDA,
+    0xCC, 0x04, 0xFB, 0xD0, 0x9B, 0xEC, 0x47, 0x1B, 0x7D, 0x68, 0x67, 0x1F, 0x86, 0xB1, 0x9B, 0x45,
+    0xFB, 0x5E, 0xC6, 0x7D, 0xB2, 0xE2, 0x14, 0x71, 0x0A, 0x58, 0xF5, 0x34, 0x7B, 0x09, 0xCC, 0x36,
+    0x95, 0xB8, 0xDC, 0x46, 0xE8, 0xE2, 0x29, 0x63, 0x95, 0x44, 0xB2, 0x18, 0xB8, 0xFA, 0xB2, 0x27,
+    0xE0, 0x33, 0xE0, 0xC4, 0xE1, 0x2E, 0x6B, 0x45, 0x60, 0x3A, 0xB3, 0x7D, 0xA7, 0x11, 0x1A, 0x2D,
+    0x50, 0x2B, 0x01, 0x93, 0xAE, 0xBE, 0x44, 0x27, 0x09, 0x23, 0x29, 0xE2, 0x25, 0xD1, 0xA8, 0xD0,
+    0x7A, 0xE4, 0x15, 0xF0, 0x5B, 0xA1, 0x79, 0x72, 0x24, 0x39, 0x19, 0xAA, 0x74, 0x37, 0x49, 0x6B,
+    0x96, 0x52, 0xAD, 0xB9, 0x50, 0x0A, 0xBB, 0xAE, 0x2F, 0xD1, 0x75, 0x00, 0xAE, 0x1F, 0x15, 0xDB,
+    0x51, 0xB3, 0x98, 0x78, 0xF7, 0x15, 0x77, 0xCF, 0x2B, 0xFE, 0xC3, 0x22, 0xDB, 0xB0, 0x1D, 0x82,
+    0x02, 0xD4, 0x84, 0x3F, 0x7F, 0xBC, 0xFD, 0xC6, 0x8F, 0xD7, 0xCB, 0xED, 0x8B, 0x31, 0x7B, 0x77,
+    0x23, 0x6E, 0xFE, 0xA9, 0xB7, 0xD3, 0x76, 0xDE, 0x19, 0xFA, 0x6F, 0xBF, 0x04, 0x53, 0x82, 0x21,
+    0x1F, 0x42, 0x5D, 0x3E, 0x62, 0xBA, 0x3F, 0xAA, 0x3B, 0x17, 0xCA, 0x8F, 0x5D, 0x4A, 0xB9, 0x6C,
+    0x62, 0x49, 0x2D, 0xAB, 0x43, 0x1C, 0xAE, 0xDF, 0xF3, 0x52, 0xD7, 0x17, 0x39, 0x5C, 0x28, 0x72,
+    0x35, 0xCB, 0x5D, 0x59, 0x7F, 0x90, 0x4A, 0xE8, 0x99, 0x72, 0xD1, 0x44, 0x91, 0x6D, 0xC1, 0x24,
+    0x9C, 0xE8, 0xFE, 0xE3, 0x7C, 0xA9, 0x4A, 0x00, 0xAD, 0xB4, 0x7B, 0x69, 0xF3, 0x52, 0x2E, 0xB5,
+    0xA8, 0x9B, 0x9B, 0xB5, 0x7A, 0xA5, 0x1C, 0x8C, 0xCB, 0x78, 0x2D, 0xEE, 0xE6, 0x56, 0x47, 0x17,
+    0x2E, 0x91, 0xED, 0xE8, 0x42, 0x24, 0x3B, 0xBA, 0xE7, 0xA5, 0xD5, 0x49, 0xBD, 0x14, 0xEB, 0x7D,
+    0xA0, 0x5E, 0x21, 0x83, 0x87, 0x76, 0xC4, 0xCE, 0xD4, 0x11, 0xB6, 0x1D, 0xAF, 0xD8, 0x6A, 0xB3,
+    0x9B, 0x7D, 0x23, 0x57, 0x71, 0xE7, 0x9A, 0xE7, 0x7C, 0x1B, 0xFC, 0x37, 0xF6, 0xE9, 0x0D, 0x69,
+    0x19, 0xB4, 0x38, 0xCD, 0x94, 0xF4, 0x9C, 0x47, 0x13, 0x53, 0x36, 0xFA, 0x2F, 0x76, 0xC1, 0x05,
+    0xBA, 0x11, 0xDF, 0xE3, 0xC1, 0xBF, 0x80, 0x57, 0x68, 0x35, 0x9F, 0xD3, 0x78, 0xAC, 0xDA, 0x85,
+    0xB2, 0xD2, 0x3A, 0x1E, 0x2A, 0xB9, 0x4C, 0x75, 0x72, 0xB1, 0xAF, 0x4B, 0xF6, 0xB4, 0xD4, 0xA9,
+    0x5D, 0x49, 0x26, 0x73, 0x0D, 0x71, 0x9E, 0xA1, 0x77, 0x61, 0x08, 0x46, 0x8A, 0x48, 0x89, 0x56,
+    0x3B, 0xE8, 0x62, 0x0F, 0x36, 0x61, 0x15, 0xEB, 0xDB, 0x6D, 0x7F, 0xF2, 0x47, 0xC9, 0x49, 0x2F,
+    0x48, 0xC9, 0x3F, 0x83, 0x89, 0xE0, 0x3F, 0xFC, 0xA1, 0x91, 0x66, 0xA7, 0x4C, 0x77, 0x1B, 0xEA,
+    0x1D, 0xB7, 0xD1, 0xFD, 0x15, 0x1E, 0x2E, 0xD1, 0x28, 0x59, 0x45, 0xA7, 0x58, 0x27, 0x4C, 0xC2,
+    0xAC, 0x34, 0x11, 0x1B, 0x71, 0x0B, 0xED, 0x4C, 0x17, 0x4A, 0xBE, 0x71, 0xE2, 0x31, 0x52, 0x30,
+    0x77, 0xB4, 0xD4, 0xB1, 0x5D, 0x59, 0x4D, 0xE6, 0x35, 0x76, 0x9E, 0x60, 0xE8, 0x1D, 0x3E, 0x98,
+    0xE5, 0x62, 0xA4, 0x84, 0xA6, 0x5C, 0xB2, 0x8B, 0x8B, 0xEA, 0xC1, 0x05, 0xAE, 0xB4, 0x33, 0x83,
+    0x22, 0x5E, 0x91, 0x56, 0x0B, 0x3C, 0xD0, 0x1F, 0xB8, 0x82, 0x3F, 0x8A, 0xCE, 0xF9, 0x0C, 0xAC,
+    0xB1, 0x37, 0x13, 0x5E, 0xA9, 0xD2, 0xCD, 0x68, 0x57, 0x1B, 0xFC, 0xD8, 0x55, 0x99, 0x6C, 0x63,
+    0xB3, 0xF8, 0xB1, 0xFB, 0xFA, 0x46, 0xB6, 0xD1, 0x46, 0x1F, 0xFC, 0xEB, 0xAA, 0x0A, 0xD2, 0xD3,
+    0x06, 0x84, 0xC9, 0xC5, 0x41, 0x01, 0xBF, 0x07, 0x19, 0xB3, 0xD0, 0xF6, 0x5C, 0xC3, 0x44, 0xDA,
+    0x91, 0xEB, 0x98, 0x48, 0x1B, 0x98, 0x0E, 0xB8, 0xA2, 0xEA, 0xE1, 0x52, 0xE1, 0x9A, 0xEF, 0x03,
+    0x14, 0xAF, 0xC0, 0xE5, 0x82, 0x8C, 0x64, 0x68, 0x47, 0xEA, 0x03, 0xDD, 0x59, 0xE0, 0xB9, 0xB2,
+    0x4B, 0x09, 0xBA, 0x62, 0x8D, 0x3B, 0x28, 0xD0, 0x66, 0x8C, 0xE0, 0x81, 0x03, 0x28, 0x31, 0x91,
+    0x2A, 0xC1, 0xF5, 0x33, 0xBB, 0x09, 0x98, 0x5F, 0xE4, 0xEA, 0x4E, 0x66, 0x4A, 0xF8, 0x44, 0x9B,
+    0xB1, 0xEA, 0x8D, 0x62, 0x25, 0x31, 0x0D, 0xD1, 0x7F, 0x77, 0x6F, 0x7F, 0xAC, 0x19, 0x37, 0x56,
+    0x89, 0xAE, 0x37, 0x91, 0xCB, 0xD8, 0x99, 0x4C, 0x3B, 0xD6, 0x2B, 0x9E, 0x26, 0x72, 0x1D, 0x17,
+    0xC8, 0xB4, 0xA3, 0xD1, 0xE8, 0x93, 0x39, 0xAD, 0x4C, 0xCD, 0x27, 0xA9, 0x5D, 0x18, 0xF4, 0x89,
+    0x46, 0xBB, 0x4F, 0x77, 0x32, 0xAA, 0xB7, 0x66, 0xEE, 0x82, 0x0F, 0xD7, 0x4D, 0x32, 0xAB, 0x0B,
+    0x43, 0x3F, 0x91, 0x6D, 0x74, 0x73, 0x17, 0xF6, 0x3A, 0x9B, 0xD4, 0x06, 0x3F, 0x0E, 0x17, 0x72,
+    0x13, 0x6D, 0x1C, 0x7A, 0x51, 0x0A, 0xDA, 0xEA, 0x57, 0x1B, 0x4E, 0x1B, 0xFE, 0x93, 0x54, 0x6F,
+    0x26, 0xBA, 0xD9, 0x8D, 0x9E, 0xCB, 0x75, 0xAA, 0x57, 0x37, 0xBB, 0xE0, 0xFB, 0xA1, 0xCE, 0x26,
+    0xBB, 0xE8, 0x96, 0x61, 0x9C, 0x7A, 0x1E, 0x4D, 0x58, 0x45, 0xB3, 0x4F, 0xE3, 0x44, 0x76, 0xC1,
+    0xBD, 0xB1, 0x92, 0x3D, 0xDD, 0x8B, 0xA9, 0x8D, 0x5E, 0x7B, 0x2D, 0x05, 0xA7, 0x85, 0xEE, 0x7D,
+    0x80, 0xA7, 0xC1, 0x7D, 0x74, 0x9A, 0x14, 0x6A, 0x8E, 0x34, 0xB9, 0x9E, 0xE9, 0x66, 0xDB, 0x23,
+    0x9E, 0xC0, 0x24, 0x22, 0xED, 0x62, 0x03, 0xFA, 0xCB, 0x0D, 0x23, 0x45, 0x3A, 0x09, 0xA4, 0x88,
+    0x8D, 0xFF, 0xF2, 0x48, 0x6A, 0xEF, 0x4D, 0x5C, 0x8F, 0xBD, 0x03, 0xE0, 0xE2, 0x77, 0x83, 0xD3,
+    0xC4, 0x3E, 0xAC, 0x36, 0xF8, 0xF0, 0x04, 0x7B, 0x1D, 0xCD, 0xEA, 0xFA, 0x36, 0x3C, 0xC1, 0x09,
+    0xC9, 0xAE, 0x46, 0x0A, 0x4E, 0x3B, 0xAD, 0x56, 0x1E, 0xFD, 0xE9, 0x47, 0xC5, 0x69, 0x6A, 0xC1,
+    0xEE, 0xF0, 0x4F, 0x0E, 0x1A, 0x7E, 0x62, 0x10, 0x12, 0xEA, 0xAB, 0x4C, 0x9D, 0x30, 0xC5, 0xE6,
+    0x23, 0xED, 0x82, 0x5F, 0xE8, 0x8E, 0x7A, 0x7E, 0x48, 0x78, 0x85, 0x66, 0xFE, 0x3B, 0x3C, 0x07,
+    0xE6, 0x36, 0xB4, 0x3B, 0x3C, 0x9A, 0xA0, 0x0B, 0xE7, 0xBF, 0x95, 0x9D, 0x74, 0x41, 0x9A, 0xCF,
+    0xDD, 0x4D, 0xC1, 0xFE, 0x84, 0x66, 0xA1, 0xEB, 0xC9, 0x4C, 0x7A, 0x53, 0x7A, 0x64, 0x7F, 0xB9,
+    0x89, 0x65, 0x7E, 0x66, 0x8C, 0x5A, 0x9C, 0x46, 0xBF, 0xD3, 0xCC, 0xCD, 0x72, 0x8D, 0xEB, 0x36,
+    0xB8, 0x90, 0xAB, 0xEC, 0xC6, 0xEE, 0xF9, 0xD5, 0xA4, 0xAE, 0x1F, 0x9E, 0x8C, 0x2E, 0xFA, 0x9F,
+    0xCB, 0x48, 0x4B, 0xA7, 0x8D, 0xE9, 0xA3, 0xE0, 0xA9, 0xD3, 0x46, 0x7B, 0x23, 0x95, 0x2D, 0x6D,
+    0xC3, 0x09, 0xFE, 0x1B, 0x91, 0xDD, 0x63, 0x94, 0xB0, 0x0A, 0x74, 0x19, 0xA6, 0x48, 0xAD, 0x1E,
+    0x0F, 0xEE, 0x46, 0xA4, 0x4E, 0x43, 0xD5, 0xFB, 0x26, 0x5E, 0x76, 0xCB, 0xE0, 0xFE, 0x3A, 0x37,
+    0xB7, 0x34, 0x8C, 0x83, 0x14, 0x1B, 0x69, 0x67, 0x90, 0x42, 0xA3, 0x69, 0x65, 0x78, 0x4F, 0x34,
+    0xD9, 0xCF, 0x3C, 0x56, 0xBD, 0x0C, 0x74, 0xA1, 0x1B, 0xD9, 0xDC, 0x82, 0xBB, 0x95, 0x60, 0xD8,
+    0xC1, 0x68, 0x2C, 0x70, 0x45, 0x23, 0xA8, 0xB4, 0xC2, 0x34, 0x05, 0xBA, 0xF7, 0x36, 0x6C, 0x6A,
+    0xA3, 0xD9, 0x51, 0x4F, 0xC6, 0xF7, 0xBE, 0x6F, 0x47, 0x1B, 0x5D, 0xA8, 0xB2, 0x5D, 0xF0, 0x17,
+    0x22, 0xEE, 0x2F, 0x56, 0xCC, 0x96, 0x61, 0xDA, 0xA0, 0x15, 0x18, 0x1D, 0x75, 0x6D, 0x17, 0x4A,
+    0x4D, 0xE0, 0x22, 0xF5, 0xB4, 0x52, 0x29, 0x95, 0x10, 0xE2, 0x17, 0x8E, 0x92, 0xB2, 0x53, 0xE6,
+    0x91, 0x57, 0x53, 0x29, 0xE3, 0xD5, 0xD3, 0xE4, 0x22, 0x83, 0x7A, 0x9A, 0x0D, 0x5C, 0x41, 0xE8,
+    0x4B, 0xC5, 0x5B, 0x4D, 0x81, 0x69, 0xA5, 0xBD, 0x83, 0xC9, 0x67, 0xD5, 0xC5, 0x0E, 0xED, 0x8C,
+    0xCF, 0x98, 0x1D, 0x86, 0x99, 0x6A, 0x2F, 0x2C, 0x37, 0x68, 0x03, 0x75, 0x2E, 0x38, 0xAD, 0x42,
+    0xB1, 0x8C, 0xE3, 0x4C, 0xB9, 0xB1, 0x99, 0xEB, 0x48, 0xE2, 0x09, 0x3A, 0x5C, 0x30, 0x73, 0x15,
+    0xB9, 0xC6, 0x79, 0xDA, 0xDE, 0x06, 0xB3, 0xB0, 0xF2, 0x1C, 0x1E, 0xD7, 0x37, 0xA1, 0xA4, 0x1A,
+    0x53, 0xE2, 0x9C, 0x0A, 0xDA, 0x3B, 0x94, 0x52, 0x6C, 0x07, 0x37, 0x53, 0x69, 0xC6, 0x65, 0x2A,
+    0x8D, 0xF8, 0xA7, 0xB1, 0xF1, 0x3E, 0xAE, 0x3D, 0x8A, 0xB4, 0x45, 0x2E, 0x00, 0xCE, 0x5D, 0xF8,
+    0xD9, 0x7B, 0xDB, 0x7F, 0xBB, 0x95, 0xFF, 0xCD, 0xBF, 0x2A, 0xF3, 0xAF, 0x30, 0xD6, 0xF3, 0xEF,
+    0xE0, 0x4D, 0xB4, 0x71, 0x60, 0x73, 0x8B, 0x8D, 0x03, 0xED, 0xCF, 0x76, 0xBA, 0x9F, 0x6C, 0xF8,
+    0x0B, 0x2B, 0x8F, 0x9B, 0xC0, 0xD3, 0x0F, 0x00, 0xD4, 0xFD, 0xC3, 0x34, 0xE3, 0x1F, 0xE0, 0xE6,
+    0x0D, 0xBB, 0x9C, 0xD0, 0xC4, 0x01, 0x1B, 0x27, 0x86, 0xEF, 0x24, 0x93, 0x7D, 0x70, 0x21, 0xF3,
+    0x8F, 0xEB, 0x99, 0xBF, 0x57, 0x03, 0xF5, 0x4B, 0x47, 0xEE, 0x8B, 0x28, 0x09, 0xEA, 0xDD, 0xF1,
+    0xB7, 0x8C, 0x97, 0x1C, 0x30, 0xAD, 0x99, 0x81, 0xF3, 0xA7, 0xA8, 0x73, 0xDB, 0xF3, 0x85, 0xC3,
+    0xCD, 0x47, 0xAA, 0x5C, 0xEA, 0xF6, 0x04, 0xF5, 0x27, 0x11, 0xDA, 0x77, 0x43, 0x91, 0xC0, 0x2E,
+    0x19, 0xBC, 0x59, 0x31, 0xC9, 0xCD, 0x74, 0xC1, 0x8F, 0x48, 0x7B, 0x29, 0x28, 0x26, 0x29, 0x1A,
+    0x49, 0xC1, 0x07, 0x54, 0xED, 0x98, 0xCD, 0x45, 0xDC, 0x69, 0xFD, 0xE2, 0xFA, 0x53, 0xCA, 0x1A,
+    0xC1, 0x5F, 0x1C, 0x31, 0xD1, 0x9E, 0xC2, 0xE2, 0xBE, 0x3F, 0x2A, 0xE5, 0x36, 0x1D, 0xEB, 0xB6,
+    0x1F, 0x05, 0x18, 0x06, 0x30, 0x6B, 0x2E, 0x0B, 0x27, 0xBB, 0x19, 0xB7, 0xF8, 0x9E, 0x89, 0xBD,
+    0x00, 0x4E, 0xFE, 0xA8, 0xC1, 0x82, 0x93, 0x84, 0x30, 0xB9, 0x49, 0xB8, 0xD5, 0x07, 0xFC, 0x0C,
+    0x26, 0x79, 0x60, 0xEB, 0x02, 0x4C, 0x2E, 0x82, 0x7F, 0x33, 0xC3, 0x23, 0xFF, 0xE9, 0x95, 0xFB,
+    0x16, 0x6C, 0x56, 0x0E, 0xD6, 0x95, 0xC6, 0x83, 0x37, 0x27, 0x99, 0xC2, 0x1C, 0xFF, 0x54, 0x38,
+    0xB8, 0xBB, 0xB0, 0x51, 0xD8, 0xDB, 0xE8, 0x96, 0xC2, 0xDF, 0x48, 0xF7, 0xE4, 0xFF, 0xB1, 0x44,
+    0xBF, 0x61, 0x44, 0xFD, 0x21, 0xC2, 0x01, 0x31, 0xDD, 0xF9, 0x7F, 0x81, 0x98, 0x7E, 0xFB, 0x0B,
+    0x21, 0xA6, 0x3F, 0x38, 0x36, 0xAA, 0x7A, 0xF5, 0x80, 0x2F, 0xCD, 0x5D, 0x7F, 0xFC, 0xC7, 0x1C,
+    0x53, 0xB7, 0x50, 0x80, 0xC1, 0xFB, 0xC6, 0xD5, 0x22, 0xC2, 0x68, 0xA4, 0x88, 0xEF, 0x4B, 0x1A,
+    0x58, 0x80, 0xA2, 0x85, 0x82, 0xF7, 0x74, 0x65, 0x61, 0x3D, 0xFE, 0xCA, 0x81, 0x6A, 0x08, 0x70,
+    0x77, 0xAE, 0x8E, 0x95, 0x8E, 0x05, 0x18, 0x29, 0x33, 0x48, 0xE1, 0x74, 0x63, 0xEB, 0x05, 0x78,
+    0xEE, 0x68, 0x10, 0x54, 0x4F, 0x7F, 0x91, 0x75, 0xFD, 0xAD, 0x23, 0x58, 0x00, 0x34, 0xA7, 0x47,
+    0xA9, 0xDB, 0xA0, 0xF9, 0x55, 0x82, 0x6C, 0xE2, 0xFF, 0x4F, 0xA6, 0xFE, 0x42, 0xA4, 0xCA, 0x5D,
+    0xC0, 0x45, 0xC1, 0xF0, 0x56, 0xA2, 0x7A, 0xE5, 0xB1, 0x2B, 0x9F, 0xB3, 0x56, 0x26, 0xED, 0x25,
+    0xA2, 0xBA, 0xF9, 0xE0, 0x5B, 0x10, 0xA0, 0x85, 0x52, 0xEF, 0xD6, 0xD2, 0x88, 0xD3, 0x06, 0xFE,
+    0xCA, 0xBD, 0xE8, 0x90, 0xFF, 0xF0, 0x2A, 0x95, 0x94, 0xB1, 0x47, 0xF1, 0x11, 0x2A, 0x49, 0x25,
+    0x45, 0x6D, 0x67, 0xEC, 0x4A, 0xF5, 0xF2, 0x5D, 0x56, 0xDD, 0x88, 0x0F, 0xF8, 0x11, 0xDF, 0x33,
+    0xC0, 0x09, 0x6C, 0x90, 0xA9, 0xF2, 0x69, 0x0A, 0xB9, 0xDE, 0x0D, 0xA7, 0xDD, 0x82, 0x9F, 0x8B,
+    0xF7, 0xA9, 0xC0, 0xCC, 0x98, 0x85, 0x3A, 0x52, 0xAD, 0x9F, 0xBB, 0x61, 0x27, 0xA5, 0xC7, 0xB1,
+    0x60, 0x56, 0xAA, 0x52, 0xED, 0xF8, 0x1E, 0x17, 0x68, 0x22, 0x26, 0xC1, 0x06, 0x43, 0x4F, 0x17,
+    0x70, 0x91, 0x26, 0x51, 0xEF, 0xA0, 0xBE, 0x50, 0x7F, 0x1C, 0xBA, 0x80, 0xDB, 0x70, 0xEF, 0x2C,
+    0x76, 0x1E, 0xB8, 0x4F, 0x5C, 0x77, 0xF7, 0xF5, 0x32, 0x2F, 0xF9, 0x5A, 0x69, 0x47, 0xF8, 0x9E,
+    0x76, 0xC6, 0x46, 0x4C, 0xA6, 0xDA, 0x61, 0x1A, 0xF1, 0x73, 0xD9, 0xB0, 0x47, 0x9E, 0x7C, 0x89,
+    0xAD, 0x0D, 0xCD, 0x2A, 0xFC, 0x8D, 0x5C, 0xA9, 0x5B, 0x3E, 0x47, 0x62, 0x93, 0x8B, 0x86, 0x7D,
+    0x5F, 0xD2, 0xD8, 0xF2, 0x91, 0xA3, 0xFD, 0xE8, 0x47, 0xD8, 0x0A, 0x60, 0xD0, 0x05, 0x10, 0x34,
+    0xE9, 0x2C, 0xA2, 0xD5, 0xF7, 0x3A, 0xE3, 0xF3, 0xBF, 0x03, 0xF8, 0x77, 0x46, 0x70, 0x3E, 0x40,
+    0xF3, 0xEF, 0xE6, 0xFB, 0x59, 0x55, 0x19, 0xB7, 0x72, 0x82, 0xD9, 0xF1, 0x7D, 0xA5, 0xB1, 0x0D,
+    0x28, 0xDA, 0x05, 0x9F, 0xCD, 0x4A, 0xAB, 0xAF, 0x67, 0x9C, 0x96, 0x13, 0xCC, 0x9E, 0x7D, 0x5F,
+    0xEF, 0x53, 0x1B, 0xD0, 0xB3, 0x6F, 0x45, 0xFC, 0x8D, 0x8F, 0x57, 0xBA, 0xA8, 0x8C, 0x4B, 0x5E,
+    0x34, 0x9B, 0xD3, 0x58, 0xEB, 0x49, 0x05, 0x14, 0x86, 0xC8, 0x10, 0xDB, 0x04, 0xF0, 0xE0, 0x78,
+    0xD6, 0xD3, 0xF3, 0xE1, 0x33, 0x71, 0x82, 0x4A, 0x33, 0x67, 0x1D, 0xE9, 0x88, 0x4B, 0xF5, 0x8E,
+    0x5B, 0xF1, 0xC1, 0xAE, 0xD8, 0x68, 0x12, 0x75, 0xAE, 0x32, 0x4C, 0x08, 0x7C, 0xF0, 0x3D, 0x6E,
+    0x69, 0x67, 0xEC, 0x6A, 0x57, 0x9A, 0x5C, 0xEB, 0xCA, 0xB3, 0x3B, 0xD3, 0x69, 0x77, 0xBD, 0x37,
+    0x92, 0x46, 0x06, 0x69, 0xA4, 0xD6, 0xED, 0x7B, 0xBD, 0xE3, 0x7C, 0x1A, 0x34, 0xAA, 0x08, 0x90,
+    0x8E, 0x86, 0xCE, 0xE7, 0x8F, 0x46, 0x3D, 0x74, 0x05, 0x7F, 0x54, 0xC0, 0x2F, 0x36, 0xE1, 0x67,
+    0x44, 0x37, 0xD3, 0x05, 0xB7, 0x60, 0x63, 0x13, 0xA9, 0xB3, 0xC9, 0x20, 0x36, 0xF0, 0xE3, 0xD0,
+    0xD3, 0xCD, 0xDD, 0x4C, 0x1B, 0xED, 0xFE, 0xF5, 0x21, 0xD5, 0x3A, 0x02, 0xC9, 0x86, 0x53, 0xF1,
+    0x77, 0x7B, 0x69, 0xCC, 0xDF, 0xEF, 0xB4, 0xE7, 0xBB, 0x4E, 0x7B, 0x01, 0xB6, 0x13, 0x20, 0xD7,
+    0x67, 0x87, 0x7E, 0x58, 0x0F, 0xA0, 0xCC, 0x48, 0x19, 0xB3, 0x33, 0x8D, 0x66, 0x2B, 0x08, 0x71,
+    0x9D, 0x4B, 0xC7, 0x6B, 0x80, 0x2E, 0xF8, 0x80, 0x8B, 0x6E, 0xC6, 0xA4, 0x66, 0xA5, 0xDE, 0xEA,
+    0x8D, 0x4A, 0x4C, 0xEF, 0xFF, 0xB6, 0xC6, 0x4E, 0x52, 0xB0, 0x92, 0x66, 0x24, 0x2D, 0xB4, 0xD2,
+    0x02, 0xD3, 0xDE, 0xDF, 0x13, 0x29, 0x33, 0x05, 0xD4, 0xA9, 0xB3, 0x0F, 0xA0, 0x76, 0x81, 0x6F,
+    0xFF, 0xDB, 0xEF, 0xDF, 0x27, 0xE8, 0x6F, 0x46, 0x90, 0xB3, 0xCE, 0x6E, 0xBB, 0x00, 0xD5, 0x2B,
+    0x9F, 0xDD, 0x19, 0x8D, 0x36, 0xE3, 0x67, 0xB3, 0xD3, 0x46, 0xD4, 0xDB, 0x7C, 0x20, 0x5A, 0x4B,
+    0x69, 0x4D, 0xF8, 0x60, 0x32, 0xED, 0x52, 0x09, 0xBB, 0x32, 0xF5, 0x26, 0xE3, 0x03, 0x3B, 0x2E,
+    0x32, 0xF4, 0x4D, 0xA2, 0x5B, 0x9A, 0x8C, 0x3D, 0x05, 0x43, 0x7A, 0x24, 0x05, 0x5A, 0x29, 0x1C,
+    0xBD, 0x9E, 0xB3, 0xF1, 0xF4, 0x99, 0x8D, 0x5C, 0x03, 0xB8, 0xC4, 0x91, 0x76, 0xFC, 0x5F, 0xC6,
+    0x6F, 0x44, 0x3A, 0xD7, 0x53, 0x4E, 0x7D, 0x49, 0xA3, 0xEB, 0x3B, 0x19, 0xAA, 0xD5, 0x86, 0xCF,
+    0x48, 0xF3, 0x1B, 0x80, 0x04, 0xA1, 0xBE, 0xF2, 0xC7, 0x50, 0x27, 0xDF, 0xC3, 0xDE, 0x05, 0x98,
+    0x9E, 0x8A, 0xE0, 0x7F, 0x9A, 0xBF, 0x20, 0x2B, 0x4B, 0x4C, 0xC1, 0x6C, 0xF8, 0xA3, 0x81, 0x39,
+    0x85, 0x26, 0xD3, 0xCD, 0xF5, 0x8E, 0x8B, 0x05, 0xB7, 0xF6, 0xA1, 0xDA, 0x0F, 0x39, 0x0F, 0x85,
+    0xB9, 0xA5, 0xB4, 0x47, 0x86, 0xB1, 0xDE, 0x19, 0x02, 0xD3, 0x11, 0x49, 0xD6, 0x92, 0xAC, 0x55,
+    0x52, 0x86, 0x4E, 0x67, 0x99, 0xC3, 0xB9, 0x2B, 0xC5, 0x37, 0xEE, 0xC5, 0x21, 0xDE, 0x1D, 0xBF,
+    0x36, 0x4C, 0x03, 0xAC, 0x60, 0x4B, 0x53, 0xBB, 0x99, 0xCF, 0x6E, 0xBC, 0x7C, 0x6A, 0x4C, 0x97,
+    0x71, 0x4A, 0xEC, 0xD3, 0x6C, 0x83, 0xE7, 0x12, 0xB9, 0x5E, 0x4C, 0x74, 0xB8, 0xF0, 0x38, 0x27,
+    0x95, 0xB4, 0x16, 0x70, 0x44, 0xD8, 0xDB, 0xB9, 0xC4, 0xF6, 0x2E, 0x50, 0x29, 0xE0, 0xDE, 0x9D,
+    0xC9, 0xCD, 0x99, 0x0A, 0xEB, 0x2D, 0xE1, 0xB5, 0x98, 0x3B, 0xEA, 0x3B, 0x72, 0xB5, 0x9A, 0x68,
+    0x47, 0x17, 0x1E, 0xC7, 0x13, 0xEB, 0xD4, 0x14, 0x1A, 0xBD, 0x57, 0xA6, 0xFB, 0x79, 0x84, 0xEA,
+    0xA5, 0xC7, 0x20, 0x77, 0x81, 0xC9, 0x45, 0xFC, 0x9B, 0x89, 0xEE, 0xD6, 0xFE, 0xA9, 0x26, 0xE9,
+    0xC7, 0x0B, 0x4E, 0x09, 0x77, 0x73, 0xC3, 0x06, 0x4F, 0x33, 0xBB, 0x50, 0x2F, 0x26, 0x12, 0xC9,
+    0x3C, 0xCE, 0x09, 0x6D, 0x71, 0x94, 0x73, 0x29, 0x8C, 0x6F, 0xE7, 0x5F, 0x0B, 0x58, 0x6A, 0x34,
+    0x92, 0xA8, 0xAF, 0xC3, 0x13, 0x34, 0x19, 0xBB, 0x1C, 0x8A, 0xEE, 0xA9, 0xB6, 0xA3, 0x9F, 0xF4,
+    0x19, 0xFD, 0x8C, 0x4C, 0xA2, 0xFB, 0xB3, 0xD5, 0x7E, 0x70, 0x71, 0x94, 0x52, 0x27, 0xBD, 0xF8,
+    0xCB, 0xA7, 0xF1, 0x60, 0xF6, 0xAB, 0x8B, 0xD7, 0x86, 0x14, 0xEA, 0x52, 0xE5, 0xC6, 0x62, 0xD7,
+    0xD7, 0x0A, 0x82, 0xF2, 0xE5, 0xFF, 0xD3, 0x21, 0xB3, 0x89, 0x5A, 0x99, 0xEE, 0xCF, 0xD6, 0xFA,
+    0xF6, 0xB7, 0x16, 0x27, 0x8D, 0x93, 0x76, 0xF3, 0xCB, 0xA7, 0xCB, 0xF5, 0x9C, 0x0F, 0x7F, 0x88,
+    0xB4, 0x22, 0x05, 0xA6, 0xF7, 0xA1, 0x19, 0xCB, 0x65, 0x1F, 0x05, 0xDA, 0x77, 0x67, 0x92, 0x9D,
+    0x3F, 0x4D, 0xAE, 0x5B, 0xB0, 0x8A, 0x9C, 0x7C, 0x63, 0xB6, 0x1F, 0x5C, 0x1C, 0x0B, 0xE6, 0x90,
+    0xDC, 0xFF, 0xE8, 0xF1, 0x80, 0xAE, 0xBE, 0x66, 0x4A, 0x33, 0x96, 0x5A, 0x57, 0xA0, 0x7E, 0xE9,
+    0x6B, 0x34, 0x71, 0xC7, 0xC5, 0x9D, 0xF6, 0x2F, 0x36, 0xFC, 0x7B, 0xDB, 0x17, 0xC9, 0xC8, 0x24,
+    0xEA, 0xDB, 0x6D, 0x6F, 0x3F, 0xB8, 0x38, 0x3A, 0x69, 0xEC, 0xA4, 0xD1, 0x3F, 0x73, 0xC0, 0x98,
+    0x1F, 0xFE, 0x10, 0xAF, 0x0D, 0xA7, 0x4C, 0xAD, 0x2B, 0x98, 0x95, 0x76, 0x66, 0xEA, 0x4F, 0x73,
+    0xA1, 0xD7, 0x70, 0x81, 0x44, 0xDB, 0xD7, 0x11, 0x4F, 0xB3, 0x70, 0xBD, 0xF4, 0xF3, 0xBA, 0x50,
+    0x27, 0xE0, 0x4B, 0x98, 0x99, 0x8E, 0x2A, 0x1E, 0x57, 0x6D, 0xEE, 0xE1, 0x3B, 0xE2, 0x21, 0xD1,
+    0xCC, 0x74, 0x90, 0xCF, 0x60, 0x83, 0x26, 0xD2, 0x05, 0x4E, 0xCA, 0x43, 0x2B, 0xF5, 0x46, 0xA3,
+    0xD1, 0xFD, 0x34, 0x7A, 0xAE, 0x1F, 0xF8, 0x96, 0x3F, 0xBD, 0x2F, 0x77, 0x7A, 0x1B, 0xA8, 0x3E,
+    0xBB, 0xBE, 0x12, 0xB1, 0x0B, 0x75, 0xBC, 0x66, 0x62, 0xB6, 0xBF, 0xC8, 0xEE, 0xD6, 0xE9, 0xD9,
+    0x7E, 0xED, 0xB8, 0x5C, 0x57, 0xAD, 0xD4, 0x11, 0x13, 0x69, 0x16, 0xEC, 0x8C, 0x0B, 0xC7, 0x5D,
+    0x97, 0x72, 0x0D, 0xE7, 0x41, 0xE8, 0x1C, 0x4C, 0xFF, 0x01, 0x6E, 0x65, 0x88, 0xF7, 0x5B, 0xCA,
+    0xA5, 0xA9, 0x47, 0x9A, 0xD1, 0x47, 0x4B, 0xBD, 0x99, 0x68, 0x56, 0xB3, 0x98, 0xD8, 0x2C, 0x76,
+    0xB1, 0xB3, 0x9B, 0x5D, 0x70, 0x73, 0x1B, 0xBA, 0xE0, 0x83, 0x0F, 0x7E, 0x1C, 0xC6, 0xA9, 0xE7,
+    0x91, 0xF1, 0xEE, 0x55, 0xAA, 0xB3, 0x13, 0xF4, 0x37, 0xC1, 0x90, 0x7A, 0x78, 0x1C, 0x5C, 0xC1,
+    0xE1, 0x2E, 0x7D, 0xCE, 0xD6, 0xFD, 0x4D, 0x88, 0x51, 0x45, 0xF0, 0x01, 0xAB, 0xBE, 0xDA, 0x4E,
+    0xF0, 0x25, 0x5A, 0x54, 0xC5, 0xF0, 0xFD, 0xCD, 0x64, 0xA3, 0x0B, 0x99, 0xDC, 0xF5, 0xEE, 0x46,
+    0xAC, 0x93, 0x7F, 0xFE, 0x80, 0x5F, 0x32, 0xDA, 0xA9, 0xF7, 0xBE, 0xC4, 0xDE, 0xF6, 0x8D, 0x8C,
+    0xBF, 0x91, 0xF1, 0x6F, 0x25, 0xBE, 0xFD, 0xCF, 0xBE, 0x7F, 0xAF, 0x20, 0x4C, 0xC2, 0xEC, 0xD3,
+    0x68, 0xA3, 0x0B, 0x2E, 0xB8, 0xD0, 0xF5, 0x2E, 0x78, 0xBA, 0xD1, 0x3F, 0x2F, 0xBC, 0x76, 0x3A,
+    0x65, 0x9C, 0x96, 0x42, 0xEB, 0xF4, 0x6A, 0x59, 0x86, 0x73, 0x2F, 0x9D, 0x26, 0x32, 0xBF, 0x36,
+    0x1A, 0x54, 0x54, 0xF3, 0x1C, 0xB8, 0x9E, 0x3A, 0x16, 0x00, 0xFD, 0xD3, 0x59, 0xD1, 0xAF, 0x4F,
+    0xAC, 0x2D, 0x35, 0xC0, 0x10, 0x71, 0xEF, 0xCE, 0x26, 0x9E, 0x99, 0xE9, 0x25, 0x2E, 0xDB, 0x60,
+    0xE7, 0x6B, 0x64, 0x17, 0xDA, 0x90, 0xEA, 0xD4, 0xF6, 0xFE, 0x85, 0xB5, 0x59, 0x3B, 0x64, 0xF6,
+    0xE1, 0x50, 0xF0, 0x6C, 0xF7, 0x0C, 0xE7, 0xC6, 0x97, 0x71, 0x6F, 0x64, 0xBA, 0x1B, 0x19, 0xFF,
+    0x66, 0x62, 0xFA, 0x51, 0xFA, 0xB4, 0x30, 0x36, 0xD8, 0xD9, 0x06, 0x17, 0x5C, 0x68, 0x83, 0x1B,
+    0xBB, 0xB1, 0xED, 0xFD, 0xD8, 0xF5, 0x43, 0xDF, 0x21, 0xFC, 0xCF, 0x4F, 0x55, 0xB4, 0x61, 0xF7,
+    0x7B, 0xC2, 0x51, 0xBB, 0xBF, 0xAA, 0x9D, 0xBA, 0x5C, 0xCC, 0x74, 0x92, 0x94, 0xF0, 0x8B, 0xCD,
+    0x50, 0x02, 0x10, 0xF5, 0x86, 0xC9, 0x60, 0x12, 0x4D, 0xC9, 0xB4, 0xAD, 0x36, 0x5C, 0xC4, 0x29,
+    0xE3, 0x66, 0x5A, 0x65, 0xDA, 0x99, 0x6E, 0x85, 0x6E, 0xC6, 0x47, 0xE8, 0xD6, 0x6A, 0x5A, 0xA0,
+    0x93, 0xF4, 0xE1, 0x2B, 0xE5, 0x96, 0xE7, 0x5E, 0x28, 0xEF, 0x34, 0xE5, 0x0F, 0x53, 0xF9, 0x73,
+    0xB6, 0xB5, 0xE7, 0x6E, 0x63, 0xF5, 0x2B, 0xAD, 0x66, 0x9F, 0x76, 0x1B, 0x26, 0xF4, 0xCC, 0x75,
+    0x17, 0x9C, 0xF4, 0x93, 0xB5, 0x92, 0x36, 0x8F, 0xFF, 0x1E, 0x26, 0xB5, 0x09, 0xBC, 0x74, 0xE7,
+    0xD5, 0x5A, 0x92, 0xA2, 0xD3, 0x4D, 0x89, 0x6E, 0x29, 0xB7, 0xA7, 0x38, 0x6D, 0x47, 0x4C, 0xD2,
+    0x3D, 0x9A, 0x91, 0x24, 0xDD, 0x90, 0x24, 0x75, 0x65, 0x71, 0xA7, 0xEB, 0x4E, 0x46, 0xF8, 0x60,
+    0x13, 0xA2, 0x8B, 0x66, 0x03, 0xA6, 0xD9, 0x47, 0x17, 0x6D, 0x32, 0xD9, 0xEC, 0x55, 0x01, 0x6F,
+    0x87, 0x9F, 0xA9, 0xF7, 0x51, 0xA3, 0x8B, 0x43, 0xB0, 0xC9, 0xCF, 0x26, 0xBB, 0x58, 0xCB, 0x26,
+    0x74, 0x61, 0x03, 0xA8, 0xF5, 0x54, 0x36, 0x72, 0xC9, 0x64, 0x17, 0x6D, 0xEA, 0x66, 0x17, 0x87,
+    0xE0, 0x17, 0xF5, 0xC3, 0x1B, 0xE2, 0xDC, 0x95, 0x07, 0xFB, 0xAF, 0xB9, 0xB9, 0x0B, 0x7B, 0x3B,
+    0xFB, 0x71, 0xF7, 0x61, 0x7A, 0x61, 0x1B, 0x82, 0x2E, 0x6C, 0xFF, 0x1B, 0x95, 0x97, 0x2F, 0xCC,
+    0x1F, 0x47, 0x7A, 0xC7, 0x3F, 0xBB, 0x23, 0x67, 0x25, 0xAF, 0x74, 0x43, 0x62, 0x12, 0xAB, 0x1A,
+    0x6E, 0xF5, 0x6E, 0x48, 0x41, 0x81, 0xED, 0xD9, 0x9C, 0x41, 0xC0, 0x81, 0x0B, 0x88, 0x73, 0x6A,
+    0x0B, 0x42, 0x4A, 0x5A, 0x50, 0x93, 0x80, 0xE8, 0x64, 0xBF, 0xBB, 0x89, 0x41, 0x40, 0x40, 0x82,
+    0x8A, 0x03, 0x42, 0xEE, 0x6D, 0x75, 0x3E, 0x50, 0x60, 0xE0, 0xF7, 0xDD, 0x49, 0x0C, 0x02, 0x02,
+    0xB2, 0x97, 0x53, 0x7B, 0xA0, 0x64, 0xAF, 0x4D, 0x5A, 0x29, 0x01, 0x9E, 0xE6, 0xA6, 0xCD, 0xD8,
+    0x99, 0xDD, 0x6F, 0xC1, 0xEF, 0xF7, 0x5A, 0xD7, 0xAA, 0xA4, 0x0B, 0x56, 0xDA, 0x3F, 0x33, 0xF3,
+    0x9D, 0x67, 0x9E, 0xF9, 0x3C, 0xDF, 0x81, 0x70, 0x2B, 0xD1, 0x54, 0x1F, 0xB1, 0x49, 0x30, 0x7E,
+    0x56, 0x68, 0x7E, 0x71, 0xED, 0x03, 0xFE, 0xE7, 0x75, 0xF9, 0x81, 0x22, 0xB3, 0x76, 0x8C, 0x94,
+    0xB0, 0x0B, 0x30, 0x02, 0x6D, 0x05, 0xEC, 0x0A, 0x8C, 0x4A, 0xB4, 0xD2, 0x84, 0xD5, 0x06, 0xE1,
+    0x83, 0x8B, 0x6F, 0x09, 0x08, 0x5F, 0x9F, 0xD2, 0x48, 0x95, 0x5E, 0x4A, 0x04, 0x29, 0x36, 0x92,
+    0x00, 0xD8, 0x00, 0xBF, 0x40, 0xB7, 0x03, 0x5A, 0xC1, 0xCF, 0xD0, 0x7D, 0x97, 0x60, 0x0B, 0xE0,
+    0xEF, 0x27, 0x4C, 0x0A, 0x03, 0xBB, 0xC9, 0xF8, 0x18, 0x26, 0x23, 0x15, 0x24, 0x45, 0x2F, 0x55,
+    0x23, 0x29, 0x0A, 0x53, 0xDD, 0x4A, 0xF8, 0x4D, 0xC5, 0x6C, 0x00, 0x9D, 0x34, 0x78, 0x65, 0x36,
+    0x30, 0x09, 0x5C, 0x84, 0xF9, 0x23, 0x8C, 0x76, 0xAC, 0x36, 0x42, 0x57, 0x9A, 0x62, 0x96, 0x7E,
+    0x71, 0x84, 0xDB, 0x15, 0x69, 0xE9, 0xB4, 0xE1, 0x35, 0x71, 0x05, 0x60, 0xDC, 0x87, 0xF6, 0xD9,
+    0x83, 0xC1, 0x0E, 0x8E, 0xEB, 0xDC, 0x6D, 0x53, 0xB7, 0x58, 0xED, 0x04, 0x4D, 0x8D, 0x34, 0xF5,
+    0x93, 0x1D, 0x6E, 0xE0, 0x49, 0xD4, 0x2E, 0xDE, 0x59, 0xBD, 0x84, 0x54, 0x8C, 0xF6, 0x01, 0x00,
+    0x27, 0x0D, 0xBD, 0xB4, 0x18, 0x29, 0x35, 0x15, 0x98, 0x81, 0x30, 0x81, 0x5D, 0xA0, 0x4B, 0x60,
+    0x2A, 0x20, 0x60, 0x9C, 0x0E, 0x93, 0xB6, 0xC7, 0x97, 0xCD, 0x0E, 0x68, 0x80, 0x2B, 0x87, 0x9E,
+    0xA4, 0x05, 0xAF, 0x8A, 0x91, 0x22, 0xA1, 0x2D, 0xF4, 0x6B, 0x18, 0xD8, 0x4C, 0xC2, 0xC6, 0x91,
+    0xA6, 0xF4, 0x2B, 0x61, 0xD8, 0x30, 0xC9, 0x45, 0xCE, 0xDB, 0x8A, 0x8B, 0x21, 0x5E, 0xDD, 0x7E,
+    0xB6, 0x75, 0x92, 0xD2, 0x28, 0x6D, 0x9D, 0xA4, 0x38, 0x62, 0x72, 0x97, 0x98, 0xFF, 0x60, 0x15,
+    0xBB, 0xA3, 0x3C, 0xA4, 0x8F, 0x18, 0x01, 0xFF, 0x07, 0xF2, 0x5A, 0x69, 0x40, 0x8A, 0x8C, 0x5A,
+    0xF1, 0xF1, 0x28, 0x6F, 0xBB, 0xFD, 0x6A, 0x73, 0x08, 0xFA, 0x4E, 0x90, 0x26, 0x27, 0x2D, 0x80,
+    0x8C, 0x52, 0x88, 0xD8, 0x12, 0x36, 0x9B, 0x61, 0x7C, 0xAC, 0xC7, 0x1B, 0x98, 0x1A, 0xCA, 0x3C,
+    0x81, 0xFF, 0xAD, 0xDE, 0x58, 0xA1, 0xD1, 0xFC, 0x5D, 0x05, 0xEC, 0xF7, 0x87, 0xD5, 0x9E, 0xA5,
+    0x78, 0x50, 0x91, 0x01, 0x82, 0x36, 0xE0, 0x30, 0x4B, 0x68, 0xA4, 0xFD, 0xF8, 0x53, 0x06, 0x82,
+    0xA4, 0x05, 0xDC, 0x3E, 0x7E, 0x2E, 0xE8, 0xF5, 0x6E, 0x19, 0x2B, 0x46, 0xEB, 0x7C, 0x4B, 0xA9,
+    0x51, 0xB1, 0xC9, 0x69, 0xA2, 0x79, 0x0D, 0xA3, 0x4C, 0x50, 0x6C, 0x38, 0x83, 0x7E, 0xE1, 0x85,
+    0x4A, 0x10, 0x46, 0x03, 0x2F, 0x9D, 0x1D, 0x12, 0x60, 0x6C, 0x06, 0xB7, 0xFA, 0x07, 0x5B, 0x2B,
+    0xC5, 0xA0, 0xD4, 0xCC, 0x5F, 0x1E, 0x62, 0xE1, 0x22, 0x70, 0x8E, 0x5B, 0x4D, 0x46, 0x83, 0x8B,
+    0xB6, 0x32, 0xA3, 0x64, 0x4A, 0xAF, 0xC9, 0x2E, 0xE3, 0xC6, 0xD8, 0x29, 0xB5, 0x25, 0xCC, 0xD1,
+    0xFE, 0xE6, 0xD9, 0xCE, 0xE8, 0x3F, 0xCF, 0xED, 0x5E, 0xC7, 0x68, 0xF5, 0x85, 0x08, 0xBB, 0x2D,
+    0x8D, 0xD2, 0xB8, 0xF4, 0x32, 0x22, 0x64, 0x5B, 0x1B, 0x4D, 0xF3, 0x7A, 0x11, 0xE7, 0x87, 0xDD,
+    0x8A, 0x91, 0xA0, 0x57, 0x3E, 0xE6, 0x36, 0xD0, 0x54, 0xA0, 0x5F, 0x9B, 0x9D, 0x30, 0xD8, 0xDC,
+    0x54, 0x14, 0xFB, 0x64, 0x45, 0x98, 0xE6, 0xC2, 0xD6, 0x69, 0xE9, 0xD2, 0x28, 0xFC, 0xFD, 0xEF,
+    0x2B, 0x5B, 0x78, 0xB0, 0x76, 0xDF, 0x56, 0x0D, 0xFE, 0xC9, 0xA7, 0x15, 0x6D, 0x3E, 0x19, 0xAD,
+    0x9A, 0x9C, 0xBA, 0x8D, 0x39, 0x85, 0x64, 0x34, 0x28, 0xBA, 0xD2, 0xEF, 0x60, 0x8A, 0x5F, 0x71,
+    0x1F, 0x0B, 0xCE, 0x6D, 0xC2, 0x64, 0x81, 0xFB, 0x3C, 0xC3, 0x3E, 0x0F, 0x98, 0xEF, 0x0B, 0x78,
+    0x4D, 0xA0, 0x0A, 0x9D, 0x22, 0xF8, 0x1D, 0xD0, 0x06, 0x9D, 0x2A, 0x04, 0x55, 0xD8, 0xC7, 0x42,
+    0x9F, 0x55, 0x08, 0x51, 0xB9, 0x51, 0xAB, 0x0C, 0x8D, 0xB4, 0xE2, 0xB5, 0x1D, 0x73, 0xF0, 0x9D,
+    0x4A, 0x97, 0xC2, 0x84, 0xBA, 0x84, 0x5D, 0x67, 0x9A, 0x6A, 0x57, 0x7C, 0xDC, 0x30, 0xD9, 0x47,
+    0x46, 0x53, 0xB1, 0x6B, 0x98, 0xD8, 0xBA, 0xCC, 0x9D, 0x38, 0xE3, 0x8A, 0x4D, 0x46, 0xCD, 0xCE,
+    0xB5, 0xE9, 0xA5, 0xE9, 0x18, 0xEE, 0x95, 0x79, 0xB0, 0x95, 0x31, 0x1A, 0x11, 0x52, 0xA3, 0x18,
+    0x0A, 0x73, 0xF6, 0x1B, 0x61, 0x73, 0xC2, 0xEA, 0x7D, 0xC5, 0x5E, 0xDF, 0x6B, 0x35, 0xCF, 0xF4,
+    0x5D, 0x66, 0x9B, 0x9F, 0x56, 0x46, 0x5F, 0x67, 0xFC, 0x67, 0x5B, 0x98, 0xEC, 0xEF, 0x64, 0x97,
+    0x2E, 0x8F, 0x7D, 0x6A, 0x2B, 0xA6, 0x22, 0xD8, 0xB9, 0x02, 0x57, 0x0E, 0x0B, 0xB9, 0xE3, 0x63,
+    0xB3, 0x11, 0x62, 0x5B, 0x09, 0x93, 0xA9, 0xCC, 0x83, 0x29, 0x88, 0x2E, 0x23, 0xFA, 0xDC, 0xEC,
+    0xD8, 0xD4, 0x6E, 0xB8, 0x64, 0x36, 0xFC, 0xDA, 0x49, 0x5A, 0x7A, 0x49, 0xD1, 0x5E, 0xDC, 0x26,
+    0xF7, 0xEC, 0x54, 0x83, 0x4F, 0x8D, 0x86, 0xB0, 0xB6, 0x62, 0x5C, 0x8C, 0x00, 0xB7, 0x01, 0xB3,
+    0x12, 0x48, 0x02, 0x4D, 0x7E, 0x45, 0x83, 0xA9, 0xCC, 0x03, 0x33, 0x61, 0xC2, 0x47, 0x17, 0xE9,
+    0x93, 0x4D, 0x98, 0x6A, 0x32, 0xEC, 0xCD, 0x06, 0xF3, 0x30, 0x0F, 0x8C, 0xD1, 0x3F, 0xBD, 0xA4,
+    0xB5, 0x97, 0x94, 0x5A, 0x49, 0x99, 0x20, 0x15, 0x3A, 0xA9, 0x80, 0xD7, 0x73, 0xBE, 0x7A, 0x69,
+    0xB2, 0xD2, 0xDA, 0x49, 0xB9, 0xAD, 0x54, 0x76, 0x46, 0xC2, 0xE0, 0x27, 0x17, 0xED, 0xD2, 0x27,
+    0x93, 0x4C, 0x69, 0x2A, 0xDB, 0xC5, 0xEB, 0xE8, 0xA2, 0x5D, 0xFB, 0xD4, 0x65, 0x53, 0xDA, 0xCA,
+    0x86, 0x18, 0xB9, 0xC2, 0xA5, 0x01, 0x2E, 0x9F, 0x0E, 0x18, 0xED, 0x34, 0xD2, 0xC2, 0x79, 0x53,
+    0x09, 0x78, 0x5C, 0xB4, 0xB1, 0x5F, 0x5D, 0x32, 0x52, 0x6E, 0xA4, 0xCA, 0xAC, 0x4A, 0x50, 0xC6,
+    0x3D, 0x1B, 0xE8, 0xF3, 0x11, 0x3F, 0x02, 0xE6, 0x09, 0xC2, 0x0A, 0x2E, 0x3F, 0xA7, 0x45, 0xF3,
+    0x60, 0x07, 0x69, 0x65, 0x54, 0xC5, 0x4B, 0xB1, 0xD3, 0x00, 0x3A, 0xFE, 0xD8, 0x55, 0x0E, 0x0F,
+    0x36, 0x1F, 0xBB, 0xF0, 0x19, 0x5A, 0x2D, 0x57, 0xF1, 0x52, 0x6A, 0x24, 0x61, 0x0F, 0xAD, 0x8F,
+    0xA2, 0xAE, 0x9D, 0x9E, 0x9E, 0xFE, 0x54, 0xD2, 0xA7, 0x92, 0xBE, 0x95, 0x54, 0xB0, 0x2B, 0x74,
+    0xF9, 0x58, 0x2A, 0x74, 0xC4, 0xA5, 0xFB, 0xDF, 0x64, 0x9C, 0x07, 0x08, 0x11, 0x5C, 0x82, 0xBE,
+    0x70, 0xE4, 0xFC, 0x2F, 0xB8, 0x3C, 0xF5, 0xC9, 0x64, 0x46, 0x46, 0x4C, 0xB6, 0x91, 0xF0, 0x4E,
+    0xA1, 0xAD, 0x01, 0xDC, 0x3F, 0x2F, 0x87, 0x8C, 0xB7, 0x1A, 0x60, 0xBE, 0x10, 0x3B, 0x4E, 0xD0,
+    0x27, 0x68, 0x36, 0x78, 0x49, 0x11, 0xA3, 0x04, 0xA1, 0x42, 0xB7, 0x5D, 0xCC, 0x78, 0xD6, 0x6A,
+    0xA5, 0xEA, 0x5F, 0x49, 0x37, 0xAE, 0xDB, 0x74, 0xE3, 0x2D, 0xBB, 0x3E, 0x3A, 0xBB, 0xF3, 0x4D,
+    0x1D, 0xA5, 0x1C, 0xA4, 0xD5, 0x49, 0x03, 0xF3, 0x70, 0xD0, 0xAA, 0x83, 0xBC, 0x76, 0x3B, 0x92,
+    0xDD, 0x26, 0x7C, 0x64, 0x1C, 0xFA, 0x84, 0x29, 0x4D, 0x85, 0x10, 0xC7, 0x81, 0x76, 0x77, 0x0B,
+    0xD8, 0xEF, 0x0A, 0xA0, 0x1D, 0xE8, 0x15, 0x81, 0x90, 0xB8, 0x00, 0x83, 0x12, 0x10, 0x34, 0x80,
+    0x55, 0x05, 0xB3, 0xCF, 0x0B, 0xE8, 0xD3, 0x1D, 0x42, 0x0A, 0x09, 0x5B, 0x5B, 0x4D, 0x46, 0xB8,
+    0x0A, 0x6E, 0x70, 0xD8, 0x68, 0xA3, 0x49, 0x66, 0x6D, 0x4A, 0x93, 0x39, 0xE3, 0x11, 0x81, 0x80,
+    0x8B, 0x6E, 0xEA, 0xD7, 0x7E, 0x31, 0xD9, 0x24, 0x2A, 0x95, 0x91, 0x19, 0x3F, 0x85, 0xC9, 0x2E,
+    0x76, 0x31, 0xD2, 0xDE, 0x48, 0x42, 0xD2, 0x74, 0xE5, 0xF6, 0x1B, 0x17, 0xE5, 0x28, 0x03, 0xAF,
+    0x01, 0x70, 0x93, 0x47, 0x5D, 0xB4, 0xD3, 0xC3, 0x26, 0x5B, 0x7C, 0x93, 0x4C, 0xFA, 0x21, 0x27,
+    0x26, 0xDA, 0xE5, 0xE6, 0xD5, 0x6A, 0xA4, 0xE8, 0x55, 0x98, 0xDF, 0x1F, 0x68, 0x32, 0xF8, 0x03,
+    0x55, 0x4F, 0xE0, 0xFC, 0xD2, 0xCB, 0xC5, 0xE4, 0xF0, 0x93, 0xD5, 0x7D, 0x5C, 0x03, 0x73, 0xBF,
+    0x56, 0x53, 0xC2, 0x2B, 0xAB, 0x5D, 0xAA, 0x1F, 0xC6, 0x2E, 0xD5, 0xB6, 0xF8, 0xFB, 0xC9, 0x2E,
+    0x67, 0x6E, 0x0A, 0x26, 0x9D, 0x35, 0xD5, 0x3E, 0x4E, 0xFD, 0x7A, 0xCF, 0xC6, 0xF0, 0xE3, 0x74,
+    0x13, 0x49, 0xB9, 0x3B, 0x16, 0x72, 0x71, 0xFB, 0xF6, 0xED, 0xD7, 0xE0, 0xAF, 0xE0, 0xA3, 0xE7,
+    0x1D, 0x0E, 0x73, 0x9F, 0xAA, 0x29, 0xFE, 0x95, 0x64, 0x63, 0xF5, 0xD3, 0x68, 0xD2, 0xD6, 0x16,
+    0x77, 0x3F, 0xD9, 0xE5, 0xCC, 0x4E, 0xC1, 0xA4, 0x7B, 0x4D, 0xB1, 0x9F, 0xA4, 0x7E, 0x39, 0xB1,
+    0x31, 0xB4, 0xF9, 0x26, 0x92, 0xF6, 0x57, 0x24, 0x55, 0x2F, 0x69, 0x3D, 0x3D, 0x3D, 0x9D, 0x81,
+    0xB6, 0x00, 0xF6, 0x00, 0xFA, 0x2B, 0x7F, 0x4E, 0xA7, 0xCC, 0x28, 0x68, 0x12, 0xDC, 0x04, 0xB3,
+    0xC0, 0xC9, 0x6B, 0xF4, 0xCA, 0x48, 0x8B, 0x1D, 0xCE, 0x9B, 0xDC, 0xAD, 0x9E, 0xCD, 0xA4, 0x3B,
+    0x71, 0x54, 0xE9, 0x25, 0xA4, 0xE1, 0x62, 0x37, 0xF4, 0x2B, 0x40, 0x88, 0x0D, 0xB0, 0x73, 0x03,
+    0x4C, 0x26, 0x81, 0x8B, 0x5D, 0x84, 0x99, 0x9B, 0x60, 0x32, 0x19, 0x6C, 0xEC, 0xBE, 0x1A, 0x18,
+    0xF1, 0x5A, 0x4C, 0x41, 0x5A, 0xEC, 0x6A, 0x16, 0x3F, 0x8D, 0x83, 0x1B, 0x4E, 0xDA, 0xCA, 0x23,
+    0x93, 0x6D, 0x32, 0xE9, 0x4E, 0x1C, 0x27, 0xA7, 0xBD, 0xDD, 0x99, 0x95, 0x6C, 0x36, 0xDA, 0xF0,
+    0xF1, 0x62, 0xA8, 0x57, 0x21, 0x43, 0xA2, 0x49, 0x98, 0x15, 0xB3, 0xD0, 0x7D, 0x35, 0xF4, 0xCA,
+    0x56, 0x9B, 0x1D, 0xCE, 0xDD, 0x70, 0xE2, 0xD9, 0xC2, 0x0B, 0x75, 0x54, 0x99, 0x95, 0x2E, 0x14,
+    0xDE, 0xC9, 0xE0, 0x54, 0x69, 0xF4, 0xA0, 0xE0, 0xA3, 0x4D, 0x4D, 0xC5, 0x2D, 0x97, 0x27, 0xC2,
+    0xC0, 0xED, 0xD7, 0xB7, 0x83, 0x6F, 0x73, 0x87, 0x52, 0x7B, 0x0E, 0x74, 0xB9, 0xDF, 0x98, 0x63,
+    0x90, 0x36, 0x2E, 0x18, 0x45, 0x27, 0xAD, 0xB4, 0x2A, 0x17, 0x42, 0x5E, 0xE4, 0x97, 0x03, 0x77,
+    0x7B, 0x25, 0xAA, 0x57, 0xA1, 0xCC, 0x6F, 0xD7, 0x26, 0x6D, 0x3C, 0x6A, 0xBF, 0x2D, 0x3C, 0x32,
+    0x4A, 0x3C, 0x32, 0x5A, 0x29, 0x9D, 0x96, 0x26, 0xF7, 0x8A, 0x6D, 0xB2, 0xEF, 0xC7, 0x2E, 0x59,
+    0x9B, 0xEE, 0x2C, 0xCE, 0x4A, 0xF1, 0x47, 0xBD, 0xC4, 0x0D, 0xA3, 0x8D, 0xEB, 0xCC, 0x1F, 0x3E,
+    0x8F, 0xA4, 0x56, 0x7A, 0x6D, 0x34, 0x4F, 0xFF, 0x62, 0xE1, 0x1E, 0x95, 0x3E, 0xDA, 0x48, 0x6D,
+    0x0A, 0x2E, 0xFA, 0xA9, 0xD1, 0xCF, 0x32, 0x56, 0x3A, 0x80, 0xD7, 0x69, 0xC7, 0xE4, 0x71, 0x65,
+    0x37, 0x1B, 0x7E, 0x09, 0xD1, 0xD4, 0xAE, 0x32, 0x47, 0x45, 0x57, 0x6C, 0x69, 0x4F, 0x5F, 0x3E,
+    0x3D, 0x4C, 0x7F, 0x3E, 0x21, 0x68, 0xB5, 0xDF, 0x6C, 0x6D, 0xB2, 0xF1, 0x1E, 0xB5, 0x9F, 0x6C,
+    0x4C, 0x54, 0x8B, 0x7F, 0x5B, 0xCA, 0x56, 0x1A, 0xA4, 0xD4, 0xEE, 0xE3, 0x73, 0xB6, 0x0D, 0x70,
+    0x35, 0xD2, 0x6B, 0xC1, 0x6B, 0x25, 0x28, 0x11, 0x16, 0x0E, 0xB6, 0xE7, 0x49, 0xA1, 0x93, 0x62,
+    0x2B, 0x15, 0xF4, 0x6B, 0x11, 0x62, 0x88, 0x6E, 0xB1, 0xA9, 0x4B, 0x5D, 0x69, 0xB6, 0xAE, 0x12,
+    0xB4, 0xD3, 0x6B, 0x3F, 0xD4, 0xD1, 0x17, 0xBE, 0x04, 0x94, 0x19, 0x35, 0xF9, 0x26, 0xD9, 0xE9,
+    0xAD, 0x6E, 0xB9, 0xD7, 0x6A, 0x43, 0x8A, 0x37, 0x9A, 0xEC, 0xD8, 0xAC, 0x64, 0xA4, 0x97, 0xB5,
+    0xC3, 0xAC, 0x64, 0xA4, 0x68, 0xBF, 0x3E, 0x65, 0x04, 0x53, 0x0E, 0xDE, 0x79, 0x1C, 0x68, 0xEB,
+    0x81, 0x79, 0x21, 0xD2, 0xEC, 0xD0, 0x67, 0xB8, 0x36, 0x01, 0x46, 0x15, 0xA3, 0x42, 0xFF, 0x4D,
+    0xC6, 0x3E, 0x4E, 0xB8, 0x77, 0x13, 0xA1, 0x5F, 0x19, 0xED, 0xD2, 0x6C, 0x36, 0x76, 0xD9, 0xC5,
+    0x51, 0xCA, 0xE3, 0xC1, 0xF7, 0x2D, 0x23, 0x2E, 0x9E, 0xE0, 0x0F, 0x21, 0xE9, 0x0B, 0xBD, 0x52,
+    0xFB, 0xD4, 0x0D, 0xE7, 0xAF, 0x17, 0x2B, 0xBD, 0x23, 0x95, 0x70, 0x1B, 0x93, 0x20, 0x7C, 0xFD,
+    0x4B, 0x23, 0x2D, 0x56, 0x15, 0xFF, 0x14, 0xD4, 0xE6, 0x6E, 0x1D, 0xA7, 0xBE, 0x84, 0x69, 0x73,
+    0x89, 0xF0, 0x45, 0x75, 0x9F, 0x56, 0x90, 0x7F, 0x5C, 0x04, 0xDD, 0xD3, 0x1A, 0xC6, 0x08, 0xFE,
+    0xC9, 0x67, 0x4A, 0x80, 0xAA, 0x2A, 0xD0, 0xE9, 0x89, 0x8E, 0x05, 0x2C, 0x02, 0xBD, 0xB4, 0x1D,
+    0xCC, 0xDC, 0xC1, 0x3E, 0x3C, 0xD9, 0xB5, 0xC0, 0x5C, 0xF4, 0x99, 0x06, 0xC2, 0x6E, 0x4B, 0xD8,
+    0x70, 0x9A, 0xF4, 0xB2, 0x32, 0xCC, 0xC3, 0x8F, 0xCE, 0x60, 0xE1, 0x8F, 0xD1, 0xE4, 0x13, 0xFD,
+    0x34, 0x64, 0x27, 0xA3, 0xE5, 0xEA, 0x97, 0x50, 0xD9, 0xA9, 0x66, 0x6B, 0x8A, 0xAD, 0x6D, 0xF6,
+    0xD5, 0xA4, 0xB9, 0x98, 0x6F, 0xF7, 0xDC, 0x7D, 0xF3, 0xFB, 0xD4, 0x3F, 0x79, 0x9C, 0xAC, 0x5E,
+    0x59, 0xED, 0x66, 0x17, 0x97, 0x6D, 0xF4, 0xAB, 0x8B, 0xCF, 0x1D, 0xC6, 0xC3, 0x6E, 0x35, 0x12,
+    0xBD, 0xF2, 0x85, 0xE1, 0x72, 0xBC, 0xCA, 0xC3, 0x7E, 0x31, 0xCB, 0x88, 0xED, 0x2A, 0x77, 0xC3,
+    0xDA, 0xFE, 0xAB, 0x06, 0xFB, 0x37, 0x8F, 0x38, 0xF9, 0x7D, 0x6A, 0xE5, 0x26, 0x9B, 0x37, 0xC2,
+    0xFD, 0xD4, 0x54, 0x1F, 0xC1, 0xFD, 0x64, 0xA5, 0x9E, 0xD0, 0xFD, 0x76, 0xC5, 0x8F, 0xA0, 0x44,
+    0x2F, 0x08, 0x89, 0x46, 0x11, 0xAB, 0xC8, 0xCD, 0x39, 0xB6, 0x59, 0xD1, 0x7E, 0xAC, 0x88, 0x17,
+    0x56, 0xD1, 0x7C, 0xB1, 0x36, 0x29, 0xF3, 0xF0, 0x2E, 0x37, 0x3C, 0xCE, 0x4E, 0xF6, 0xFE, 0x62,
+    0xBE, 0x48, 0x5D, 0xAA, 0x26, 0xDF, 0xE4, 0xD5, 0x4B, 0x70, 0xC6, 0x09, 0x1B, 0x7B, 0xB3, 0xB7,
+    0x9B, 0x51, 0x57, 0x8D, 0x6C, 0xED, 0xE4, 0x4B, 0xAF, 0x93, 0x6C, 0x1F, 0xEC, 0xC9, 0xDD, 0xF9,
+    0x2E, 0x79, 0xFF, 0xEF, 0x6B, 0x70, 0x9F, 0x2F, 0xC1, 0xBD, 0xBF, 0x9C, 0x5F, 0x72, 0x91, 0x9B,
+    0x04, 0xDC, 0x60, 0xA7, 0x3E, 0xF6, 0x8B, 0x49, 0x26, 0x35, 0x85, 0xCA, 0x19, 0xE7, 0x04, 0xC2,
+    0xE0, 0xA4, 0xD8, 0x4B, 0xC9, 0x48, 0xA5, 0xD9, 0x9A, 0x8D, 0x99, 0x99, 0x30, 0x85, 0x08, 0x57,
+    0x0B, 0xBD, 0x92, 0xD9, 0xE7, 0x69, 0xA6, 0xDA, 0x68, 0x3F, 0xC9, 0xD4, 0x80, 0xBF, 0x5F, 0x5C,
+    0x0A, 0xDA, 0x5B, 0x29, 0x5A, 0xAD, 0xF8, 0x2F, 0x41, 0xDA, 0x91, 0xB6, 0x66, 0x7B, 0xBD, 0xB6,
+    0xA5, 0xA9, 0x26, 0xB7, 0xC5, 0x24, 0x93, 0xBB, 0xD4, 0xA5, 0x7E, 0xED, 0x93, 0x5D, 0xEC, 0x6A,
+    0xA3, 0x5D, 0x5C, 0x74, 0xD1, 0x4F, 0x21, 0x5E, 0x1B, 0xAE, 0x0D, 0x07, 0x28, 0xD9, 0x27, 0x17,
+    0x96, 0x51, 0x4B, 0xA2, 0xAB, 0xED, 0x82, 0x5F, 0xFA, 0x01, 0x71, 0x03, 0x53, 0x48, 0xB8, 0xB5,
+    0x8F, 0xE8, 0xDF, 0x8E, 0xB4, 0xF1, 0x12, 0x48, 0x89, 0x3E, 0xFD, 0xE5, 0xA1, 0xB4, 0x37, 0xCF,
+    0x8F, 0x84, 0xE3, 0x70, 0xA4, 0x33, 0x00, 0x57, 0x0B, 0x73, 0x35, 0xFA, 0xFB, 0x7E, 0xC5, 0x46,
+    0xFC, 0x44, 0x18, 0x08, 0x10, 0xDE, 0x21, 0x28, 0x3A, 0x2D, 0x2F, 0x68, 0x0A, 0xD2, 0x63, 0xA9,
+    0xFE, 0x7C, 0xFC, 0xBB, 0xE9, 0x58, 0x7F, 0xFA, 0x05, 0x36, 0x70, 0x91, 0xB6, 0x42, 0x98, 0xE8,
+    0x32, 0xCC, 0x70, 0xF9, 0x43, 0xA0, 0x12, 0x86, 0x30, 0xB8, 0xA9, 0x4F, 0x36, 0x36, 0xB5, 0x5F,
+    0x09, 0xB7, 0x12, 0xF6, 0x5F, 0x32, 0x66, 0xAB, 0x30, 0x6F, 0xE0, 0x04, 0x46, 0x47, 0x0F, 0xE3,
+    0xE3, 0x61, 0x2B, 0xDA, 0x44, 0x3B, 0x67, 0x1A, 0x15, 0x98, 0xCB, 0xC1, 0xE8, 0x00, 0xD7, 0xA1,
+    0x97, 0xA6, 0x4E, 0x52, 0xA3, 0x37, 0xFE, 0xB6, 0x84, 0xB7, 0xB3, 0xFD, 0x74, 0xF5, 0xD4, 0x47,
+    0x26, 0xB9, 0xF7, 0xE2, 0x89, 0xC9, 0x67, 0xFD, 0xA2, 0x4E, 0xD2, 0x12, 0xA4, 0xCC, 0x1D, 0x15,
+    0xF0, 0x1C, 0x4A, 0x25, 0x01, 0xE8, 0x56, 0xE0, 0x45, 0x80, 0x11, 0x3F, 0xD8, 0xC5, 0x4F, 0x6D,
+    0xF1, 0x13, 0x21, 0x4C, 0x58, 0x4D, 0x34, 0x8A, 0x07, 0x8F, 0x13, 0x32, 0x8C, 0x82, 0xF1, 0xC1,
+    0xC2, 0xF8, 0xB8, 0x32, 0x47, 0x4D, 0xD7, 0xA6, 0xCB, 0x1F, 0x62, 0x8A, 0x49, 0x36, 0xBA, 0x69,
+    0xE4, 0xAC, 0x2D, 0x26, 0xD9, 0xC5, 0xC6, 0xC0, 0x09, 0xB5, 0xCD, 0xDD, 0x62, 0xA3, 0x27, 0x20,
+    0xE9, 0x96, 0x54, 0x9D, 0xB4, 0xC2, 0x78, 0x08, 0xAF, 0x5D, 0xB8, 0xD4, 0xDC, 0x9A, 0x7E, 0x17,
+    0xDF, 0x5C, 0xAF, 0xFF, 0x89, 0xFB, 0x23, 0xF7, 0xAE, 0x16, 0xFD, 0x8A, 0xEB, 0xFC, 0x80, 0x6E,
+    0x32, 0xE5, 0xA5, 0x2E, 0x85, 0x5B, 0xE9, 0xAC, 0x4B, 0xA3, 0x8D, 0xE7, 0xFD, 0x5A, 0xED, 0xB2,
+    0xB9, 0xA9, 0xDA, 0x4F, 0xB2, 0xFB, 0xB8, 0x86, 0xB6, 0xF8, 0x5B, 0x29, 0xB4, 0xE9, 0xC4, 0x48,
+    0x5A, 0x66, 0xA9, 0x5A, 0x1D, 0xB6, 0x3A, 0xFC, 0x7F, 0x9A, 0xD6, 0x59, 0xD2, 0xFB, 0xD2, 0x81,
+    0x1D, 0x1C, 0xCE, 0x9B, 0x6D, 0x05, 0xAE, 0x0D, 0x73, 0x32, 0x8A, 0xFC, 0x00, 0xDE, 0xA4, 0x8D,
+    0xD8, 0x9D, 0x71, 0x6F, 0xD7, 0xBB, 0xF6, 0xC7, 0xE9, 0xC6, 0x9D, 0xB7, 0x55, 0x7B, 0x1D, 0xCF,
+    0x0E, 0x97, 0x00, 0xB3, 0xBE, 0x48, 0x93, 0x2C, 0x3C, 0x32, 0x13, 0x37, 0x9B, 0x05, 0x3B, 0x24,
+    0xBA, 0x18, 0x4A, 0x9B, 0x9C, 0xA6, 0xD2, 0xFF, 0x38, 0xDD, 0x33, 0xF1, 0xA1, 0x1F, 0xFE, 0xE3,
+    0xCC, 0xC6, 0x51, 0x5D, 0xF2, 0x7B, 0x53, 0x2E, 0x48, 0x7F, 0x1D, 0x13, 0x79, 0x8B, 0x7E, 0x40,
+    0xAB, 0xD5, 0xC7, 0xEB, 0xDD, 0x1B, 0xDD, 0xE3, 0x7F, 0x2A, 0xA3, 0x8E, 0x03, 0xFC, 0x19, 0x9D,
+    0xD6, 0x7E, 0x28, 0x70, 0x17, 0x6E, 0xF0, 0xD7, 0x67, 0xAD, 0x2A, 0x54, 0xBA, 0xFC, 0xF3, 0x79,
+    0x95, 0x26, 0xFF, 0x3C, 0x4F, 0x4D, 0x1C, 0x27, 0xF3, 0x89, 0x52, 0xF7, 0xDE, 0x7F, 0xE6, 0xFE,
+    0xA7, 0xC3, 0x5B, 0xF6, 0x9C, 0xB7, 0x6C, 0xE5, 0x1F, 0x5C, 0x25, 0xFD, 0xF0, 0x91, 0x49, 0xD7,
+    0xCF, 0xDF, 0x58, 0xFE, 0x74, 0x56, 0x7C, 0x33, 0x88, 0x5F, 0xF5, 0xC7, 0x66, 0x73, 0x6E, 0xF6,
+    0x73, 0x72, 0x3F, 0x5D, 0x6F, 0x93, 0x9D, 0x1E, 0x99, 0x67, 0x33, 0x41, 0xD1, 0x2A, 0xF7, 0xBF,
+    0xDE, 0x4D, 0x0A, 0x6F, 0x57, 0x9B, 0x74, 0xAB, 0x86, 0x45, 0x60, 0xD6, 0x82, 0x7F, 0x6F, 0x65,
+    0x0B, 0x43, 0xFF, 0x5F, 0x1B, 0xFF, 0xC7, 0xE5, 0x57, 0x7A, 0x25, 0xCE, 0x5F, 0x59, 0xFA, 0xAF,
+    0xEE, 0x4C, 0x87, 0x8D, 0x5D, 0xEC, 0x3F, 0x0E, 0x04, 0x40, 0xA7, 0x0F, 0xCD, 0xE1, 0x84, 0x4F,
+    0xAB, 0x0F, 0xF8, 0x6F, 0xC5, 0x9B, 0x4F, 0xAC, 0x25, 0xC7, 0x75, 0xDE, 0x7F, 0xDD, 0xA5, 0x99,
+    0x86, 0xD9, 0x88, 0x4A, 0x0B, 0xD1, 0xB2, 0x39, 0x96, 0x3B, 0x0B, 0x6F, 0xCC, 0xD0, 0xD3, 0x1B,
+    0x03, 0x91, 0x81, 0x99, 0xA9, 0xA6, 0x05, 0x44, 0x0B, 0x01, 0xE1, 0x2C, 0x34, 0x42, 0x60, 0x2D,
+    0xE8, 0x85, 0x17, 0x32, 0x15, 0x67, 0xBC, 0xD0, 0xC2, 0x08, 0x66, 0x5E, 0x37, 0xC9, 0x00, 0x02,
+    0xE2, 0x85, 0x1E, 0x10, 0x3B, 0xCB, 0x68, 0x16, 0x34, 0x40, 0x3E, 0x09, 0x1E, 0x05, 0xF0, 0x62,
+    0x8C, 0xCC, 0xBC, 0x2E, 0x71, 0x16, 0x5A, 0x70, 0xE1, 0x16, 0xE5, 0x3F, 0x0B, 0x01, 0x61, 0x4B,
+    0xA4, 0xCC, 0x44, 0x34, 0xC0, 0x92, 0xD4, 0x12, 0x7B, 0xC8, 0xEA, 0xFE, 0xB2, 0xA8, 0xBE, 0xEF,
+    0xCF, 0x70, 0x48, 0x09, 0xB2, 0xAC, 0x34, 0xF0, 0xDE, 0xEB, 0x77, 0x6F, 0xDF, 0x5B, 0xE7, 0x54,
+    0x9D, 0x3A, 0xE7, 0x3B, 0xDF, 0x39, 0x85, 0x9B, 0x91, 0x37, 0xC2, 0x4E, 0xB4, 0x9E, 0x17, 0x38,
+    0x79, 0x35, 0x7C, 0x90, 0x7C, 0xC2, 0x0E, 0xB4, 0x64, 0x91, 0x72, 0xC4, 0x35, 0x44, 0x4C, 0xA0,
+    0xEA, 0xB8, 0x4E, 0x1E, 0xB0, 0x9E, 0x0B, 0xD0, 0x6D, 0xCF, 0x5F, 0x86, 0x91, 0x6C, 0x20, 0xF7,
+    0x9C, 0x9B, 0xE9, 0xA3, 0xD1, 0x3F, 0x95, 0x6F, 0x34, 0xF6, 0x25, 0xEA, 0x2F, 0xE2, 0xFE, 0x3D,
+    0xEE, 0xA3, 0xB8, 0xFF, 0x84, 0x53, 0x57, 0x69, 0x38, 0xAB, 0x8E, 0xCF, 0xC3, 0x57, 0x21, 0x9C,
+    0x1A, 0x92, 0xB3, 0x2B, 0x58, 0x05, 0xEC, 0xBD, 0x1E, 0x33, 0x9E, 0x69, 0x08, 0xC0, 0x05, 0xC0,
+    0x02, 0xC6, 0x43, 0x36, 0x81, 0x95, 0x3A, 0x23, 0x0D, 0x98, 0x11, 0xB2, 0x19, 0xB2, 0x05, 0x4A,
+    0x41, 0x21, 0xED, 0xE7, 0x52, 0x44, 0x52, 0x03, 0x34, 0x7C, 0xB5, 0xEC, 0xAC, 0xD4, 0xB4, 0x8A,
+    0xA8, 0xF7, 0x45, 0xD8, 0xA3, 0x7E, 0x7C, 0xE6, 0xB0, 0x1A, 0x8C, 0x84, 0xD3, 0x62, 0xA4, 0x58,
+    0xFC, 0xFD, 0x97, 0xBA, 0x0F, 0xF0, 0x01, 0xB2, 0xCB, 0x9C, 0x69, 0x6A, 0x6F, 0x66, 0xD6, 0x6C,
+    0xA5, 0x9C, 0xFA, 0x8E, 0xF6, 0xCD, 0x11, 0xA3, 0x19, 0xAA, 0x15, 0x50, 0x87, 0x91, 0x1A, 0x7A,
+    0x4D, 0x3C, 0xD4, 0xBF, 0xDD, 0x60, 0x22, 0xD0, 0xFE, 0x1F, 0x32, 0xC9, 0xE3, 0x14, 0x39, 0x7B,
+    0x73, 0x4C, 0xD2, 0x50, 0xFB, 0x9D, 0x4A, 0x0F, 0x71, 0x9E, 0x0B, 0x5C, 0xE0, 0x4F, 0x98, 0xD8,
+    0x4F, 0x2F, 0xE5, 0xBE, 0xEC, 0x6C, 0x63, 0xF9, 0x75, 0x7E, 0x8B, 0x0B, 0xFC, 0xC9, 0x91, 0xF6,
+    0x6D, 0x20, 0x53, 0xC4, 0x8C, 0x17, 0x30, 0xFE, 0x43, 0x98, 0x15, 0x6A, 0x0D, 0xF4, 0x0A, 0xD9,
+    0x9C, 0x07, 0x33, 0x12, 0xCC, 0x7A, 0x73, 0xCC, 0x25, 0x4F, 0xBF, 0x42, 0xBE, 0xF0, 0x01, 0xEE,
+    0x50, 0xFD, 0x7D, 0xA4, 0x55, 0xA0, 0x5E, 0x1B, 0x8A, 0x70, 0x68, 0xC3, 0x62, 0xBF, 0xB3, 0xD4,
+    0xAF, 0xC6, 0x47, 0x9F, 0x79, 0x9E, 0x43, 0x2A, 0x65, 0xD3, 0x6F, 0xD9, 0xDB, 0x1F, 0x6B, 0xF9,
+    0xF6, 0x9B, 0x4F, 0x18, 0x3F, 0x97, 0xEA, 0xCA, 0xD7, 0x80, 0xFC, 0x9F, 0x3E, 0x78, 0xED, 0xD7,
+    0x1E, 0xFB, 0xED, 0x0B, 0x6E, 0xAE, 0xFE, 0xCA, 0xBD, 0x70, 0xD9, 0x29, 0xB6, 0x8A, 0x14, 0x33,
+    0x66, 0xC2, 0x04, 0x8A, 0x00, 0x3C, 0x7C, 0xE5, 0x53, 0x4E, 0xB1, 0x57, 0xE4, 0x91, 0xA6, 0x54,
+    0xD7, 0x3F, 0x61, 0x7E, 0xF0, 0xD1, 0xF3, 0xF1, 0xF3, 0x87, 0xFF, 0xED, 0xC5, 0x1F, 0x2F, 0x46,
+    0x43, 0x3E, 0x03, 0x99, 0xA2, 0x93, 0x07, 0xCE, 0x80, 0x86, 0x42, 0xC1, 0x7E, 0x63, 0xAA, 0x1E,
+    0x9F, 0xEA, 0x2F, 0x84, 0x5A, 0xA3, 0x55, 0x57, 0x2C, 0x49, 0xB7, 0x33, 0x40, 0x0D, 0x38, 0x60,
+    0x0F, 0xD2, 0x2A, 0xCD, 0x64, 0x33, 0xE4, 0x13, 0x98, 0x00, 0xF9, 0xFE, 0xB1, 0x21, 0x3C, 0xFC,
+    0x1F, 0xA8, 0x14, 0x69, 0x15, 0x01, 0x28, 0xA6, 0x87, 0xAE, 0xF1, 0x18, 0x9F, 0xCF, 0xC7, 0xAA,
+    0x73, 0xE1, 0xD1, 0xFD, 0x62, 0x3A, 0xF3, 0x18, 0x8F, 0x15, 0x21, 0xFB, 0x2A, 0x5F, 0x75, 0xC1,
+    0x75, 0x59, 0xB0, 0xCD, 0xED, 0xD2, 0x3F, 0x0C, 0x95, 0xAF, 0xBA, 0x72, 0x28, 0x87, 0x3C, 0x98,
+    0x40, 0xCC, 0x22, 0x7B, 0x1C, 0x52, 0x37, 0xAE, 0xB3, 0x43, 0x35, 0x14, 0xC1, 0x06, 0xA3, 0x2F,
+    0xC5, 0x4C, 0x5A, 0xE9, 0xA5, 0xE6, 0x62, 0xFF, 0xA6, 0xAF, 0x00, 0xDB, 0xED, 0x86, 0xCF, 0xD7,
+    0x4B, 0x54, 0xF1, 0x3A, 0x6D, 0xBC, 0x8D, 0xE6, 0x88, 0xC2, 0x8C, 0xBE, 0x3F, 0xD1, 0x7F, 0x27,
+    0xE0, 0xEE, 0x06, 0xDC, 0xDD, 0x91, 0xF6, 0x13, 0x03, 0x2A, 0x7D, 0x26, 0xEB, 0xCD, 0x62, 0x3B,
+    0x13, 0xAB, 0xA6, 0x8C, 0x35, 0x76, 0x72, 0xD4, 0xE1, 0x12, 0x6E, 0xBC, 0x48, 0x11, 0x9C, 0x5F,
+    0xCB, 0xF9, 0xD1, 0x2E, 0xEF, 0x7E, 0x9D, 0xA5, 0xB8, 0x9D, 0x05, 0x3D, 0x3B, 0x91, 0x8D, 0x17,
+    0x33, 0xFF, 0x98, 0xE9, 0x3E, 0xEF, 0xBE, 0xF3, 0x42, 0x3E, 0xDB, 0x3F, 0xFA, 0xB5, 0x8F, 0x3E,
+    0x76, 0xA1, 0x9E, 0xED, 0x08, 0xFC, 0x0A, 0x9B, 0xD5, 0x7C, 0xD8, 0xCC, 0x50, 0x35, 0x65, 0x83,
+    0x19, 0x09, 0x30, 0x53, 0x81, 0x23, 0x1F, 0xB1, 0x9E, 0x8B, 0xE4, 0x81, 0x8F, 0xFC, 0x2D, 0x77,
+    0xCE, 0x94, 0xF2, 0xD5, 0x33, 0xA3, 0x62, 0x31, 0xDE, 0x01, 0x62, 0xED, 0xC1, 0x95, 0xD7, 0xC0,
+    0xBE, 0xFC, 0x75, 0x8F, 0x99, 0xFE, 0x7A, 0x81, 0xC3, 0x4A, 0x23, 0x75, 0xF7, 0xE9, 0x99, 0x22,
+    0x50, 0x93, 0x45, 0xCC, 0xC8, 0xA3, 0x0D, 0xBB, 0xD1, 0xCA, 0x00, 0xE0, 0x3A, 0x98, 0xF9, 0x2D,
+    0xB0, 0x1D, 0x01, 0x22, 0x85, 0xC7, 0x7A, 0xCE, 0xC3, 0x6D, 0x98, 0x28, 0x07, 0x3E, 0xF2, 0xB7,
+    0x5C, 0xBF, 0xFA, 0x8C, 0x42, 0xF1, 0xAA, 0xFE, 0x46, 0x7E, 0xEF, 0xA3, 0xB6, 0xC1, 0x04, 0x2E,
+    0x82, 0x23, 0x9B, 0x36, 0x7F, 0xE0, 0x9A, 0x3C, 0x92, 0xCF, 0xB4, 0x9E, 0xBA, 0x2B, 0x97, 0x26,
+    0x8F, 0x38, 0x51, 0xF9, 0x5C, 0x91, 0x4F, 0xA5, 0x79, 0x05, 0xD8, 0xBB, 0x0D, 0x7F, 0x40, 0xEE,
+    0xA9, 0xE1, 0x1A, 0xC5, 0x90, 0x8B, 0x6C, 0xC2, 0x05, 0xF6, 0xC0, 0x62, 0xBB, 0xEC, 0xF1, 0x60,
+    0x02, 0x4E, 0xC4, 0x0F, 0x96, 0xF2, 0xCE, 0x8C, 0x9F, 0xDB, 0xB7, 0x7E, 0x81, 0x7C, 0xFA, 0xB7,
+    0x1E, 0xEE, 0xFC, 0xAB, 0x0B, 0x50, 0x3F, 0xFB, 0xA7, 0x1D, 0xE5, 0xA8, 0x95, 0x2C, 0x56, 0x1A,
+    0x68, 0xC9, 0x03, 0x95, 0xE7, 0x12, 0xD9, 0x73, 0xC9, 0x76, 0xCC, 0x02, 0x26, 0x42, 0x31, 0x41,
+    0x11, 0xE0, 0xEC, 0xFE, 0x69, 0x27, 0x73, 0xAE, 0x03, 0x35, 0x20, 0xC8, 0x56, 0x28, 0x16, 0xA8,
+    0x23, 0x68, 0xC0, 0x2C, 0xE9, 0x13, 0x76, 0x00, 0xEB, 0xA1, 0xEA, 0xA0, 0xEA, 0x32, 0xAC, 0xAF,
+    0x1A, 0xFB, 0x8E, 0x3A, 0xA3, 0x05, 0xFA, 0x53, 0x5F, 0x97, 0x87, 0x00, 0xF5, 0xEB, 0x1D, 0xFC,
+    0x70, 0x01, 0xF3, 0xF5, 0xF1, 0xE4, 0x9B, 0xAE, 0x81, 0x7C, 0x01, 0xAA, 0x19, 0xD0, 0x08, 0xE5,
+    0x9B, 0x1E, 0xDA, 0x16, 0xCC, 0x14, 0xA1, 0x7E, 0x36, 0x40, 0xB4, 0x03, 0x76, 0x74, 0x0D, 0x3D,
+    0x2B, 0x46, 0x9A, 0x71, 0x52, 0xC8, 0x25, 0x79, 0x2B, 0x09, 0x61, 0x62, 0x31, 0x63, 0x27, 0xE7,
+    0x71, 0x03, 0x50, 0x76, 0x49, 0x47, 0xF6, 0x86, 0xA4, 0x28, 0xF5, 0xC9, 0x41, 0xED, 0xB0, 0x0D,
+    0xDA, 0x8E, 0x60, 0x57, 0xC8, 0xDF, 0x09, 0x69, 0x4C, 0xFB, 0xCD, 0x40, 0x3E, 0x3B, 0x70, 0x66,
+    0xC2, 0x8E, 0xAE, 0xC9, 0xA3, 0x99, 0x71, 0x52, 0x67, 0xA5, 0x98, 0x4B, 0xF2, 0x4E, 0x8A, 0x36,
+    0xE0, 0xBE, 0xB6, 0x62, 0x96, 0xDD, 0x80, 0xF9, 0x41, 0x2F, 0xC0, 0x48, 0xEA, 0xD2, 0x1F, 0x0F,
+    0xB9, 0x26, 0xD2, 0xFE, 0x07, 0xC8, 0x96, 0x15, 0x80, 0xD8, 0x37, 0x00, 0x4B, 0xAD, 0x08, 0x1C,
+    0x96, 0x5A, 0x80, 0xDE, 0x48, 0x40, 0x9B, 0xAD, 0x0D, 0xE0, 0xA4, 0x2E, 0xFD, 0x19, 0xD3, 0x9F,
+    0xF5, 0xA0, 0xA3, 0x96, 0xA4, 0x40, 0x35, 0x1A, 0x29, 0x52, 0x05, 0xA4, 0x14, 0x95, 0x24, 0x7F,
+    0xAC, 0x99, 0xEE, 0x81, 0x91, 0x26, 0x32, 0x49, 0x0D, 0xFD, 0x81, 0x02, 0xCE, 0x9B, 0x05, 0x3B,
+    0xE2, 0x9A, 0x62, 0xC2, 0x0E, 0x79, 0xC4, 0x4C, 0xAD, 0x22, 0xB1, 0x96, 0x68, 0xCF, 0xB4, 0xDF,
+    0x6D, 0x5C, 0x67, 0x03, 0xCE, 0x9B, 0x78, 0x46, 0x21, 0x93, 0x34, 0xD1, 0x6F, 0xB3, 0x1C, 0xB1,
+    0xD2, 0x4C, 0x21, 0xDD, 0x38, 0x9E, 0xBF, 0xDB, 0x1F, 0x03, 0xFA, 0xFF, 0x01, 0x5C, 0x50, 0x03,
+    0xB6, 0xEA, 0x4E, 0x59, 0x4F, 0x3B, 0x41, 0x2E, 0x79, 0x8C, 0x14, 0x31, 0x2B, 0x7D, 0x67, 0x16,
+    0x6C, 0xC8, 0x17, 0xF2, 0xC8, 0x0A, 0x3D, 0x2D, 0xD4, 0xDE, 0x79, 0x6C, 0xB0, 0x03, 0x66, 0x2E,
+    0x26, 0xF2, 0x25, 0x5F, 0xC8, 0x44, 0xFF, 0xDA, 0x47, 0xD4, 0xD5, 0x92, 0x7C, 0x29, 0x69, 0x40,
+    0xD2, 0x48, 0x25, 0x8D, 0xD0, 0xAF, 0xCD, 0xCE, 0xA4, 0x62, 0xDD, 0x59, 0x8D, 0xB4, 0x33, 0x66,
+    0x05, 0x4D, 0xB4, 0x1A, 0xEA, 0xEF, 0xEB, 0x58, 0x86, 0x47, 0x76, 0x8F, 0xA2, 0xF7, 0xBF, 0xEB,
+    0x7E, 0xBA, 0xBB, 0xFE, 0xF8, 0x6E, 0x9B, 0xED, 0x6A, 0xD9, 0xDD, 0xF5, 0x47, 0x2B, 0xA0, 0xE3,
+    0xBB, 0xAE, 0x1F, 0x77, 0x63, 0xF5, 0x71, 0x7B, 0xAE, 0xE9, 0x37, 0x09, 0x5D, 0xD7, 0xBF, 0x99,
+    0x1E, 0xAC, 0x7C, 0xFF, 0x52, 0x8A, 0xF0, 0x36, 0xF4, 0x77, 0xD3, 0x83, 0x66, 0xEA, 0x7D, 0xB2,
+    0x95, 0x6C, 0xE9, 0x7D, 0x32, 0x17, 0x7A, 0x0D, 0x6D, 0xFA, 0x48, 0xAD, 0xBF, 0x53, 0xFA, 0xEE,
+    0x52, 0x52, 0xFA, 0x70, 0x2E, 0x25, 0x63, 0x23, 0xAD, 0xDC, 0xBB, 0xEF, 0xB6, 0x2D, 0xD9, 0x1F,
+    0xC1, 0x89, 0x9F, 0xE1, 0xEE, 0x68, 0xE7, 0x1E, 0x1E, 0xCD, 0xDF, 0xEF, 0x9F, 0x5C, 0x78, 0x33,
+    0x40, 0xE9, 0xA1, 0x02, 0x2E, 0x01, 0x1F, 0xE6, 0xFD, 0xAE, 0x1E, 0xD6, 0xB6, 0x31, 0xD1, 0x75,
+    0x65, 0x70, 0xBE, 0x1A, 0x9C, 0x6F, 0xBB, 0x7A, 0x10, 0xD5, 0xAB, 0x11, 0xFB, 0xCE, 0x94, 0x50,
+    0x8E, 0x3C, 0xA5, 0x1A, 0x8A, 0x15, 0x8A, 0x08, 0xE5, 0x0C, 0x76, 0x82, 0x2A, 0x40, 0x1D, 0xC0,
+    0x05, 0xE0, 0xB3, 0xE0, 0xC0, 0x76, 0x14, 0xF7, 0xC8, 0x15, 0x90, 0xB8, 0x54, 0x8E, 0x15, 0xB1,
+    0xF4, 0x87, 0x66, 0xEC, 0x91, 0x9A, 0x56, 0xD4, 0x0B, 0xB6, 0xA3, 0x18, 0xC8, 0x03, 0xDC, 0xDA,
+    0x09, 0x91, 0x69, 0xA4, 0xD0, 0x4C, 0x35, 0xDC, 0xC6, 0x35, 0xB7, 0xB9, 0x54, 0x46, 0xEE, 0xD4,
+    0xAF, 0x11, 0x2F, 0x42, 0xBC, 0x46, 0x1E, 0xF7, 0x30, 0xB3, 0xEB, 0xCC, 0x54, 0x8F, 0x45, 0x28,
+    0x83, 0x0D, 0x26, 0xD8, 0xF5, 0xE6, 0x58, 0x49, 0x83, 0x93, 0x9A, 0x87, 0x3F, 0x33, 0x03, 0xB7,
+    0x7E, 0x83, 0xF2, 0xC7, 0x23, 0x17, 0x44, 0xF6, 0x9D, 0xF9, 0x94, 0xEB, 0x5B, 0x66, 0x9C, 0x46,
+    0xF3, 0xB6, 0x9A, 0x9A, 0x98, 0x4D, 0x26, 0x94, 0x9D, 0xF5, 0x17, 0x70, 0x84, 0x7C, 0x2E, 0xA4,
+    0xC1, 0x4A, 0x8D, 0x53, 0xA4, 0x7E, 0x3D, 0xA4, 0x18, 0x6B, 0x22, 0xFC, 0xE7, 0x81, 0x22, 0x26,
+    0xD7, 0x78, 0x74, 0x95, 0x6F, 0x8D, 0x46, 0x2B, 0x6B, 0x3F, 0xD4, 0xC4, 0x62, 0xB0, 0xFE, 0x16,
+    0xD1, 0x62, 0x7D, 0xC8, 0xE7, 0x4A, 0x6A, 0xA4, 0xC9, 0x4A, 0xDB, 0xD7, 0x00, 0xD4, 0xAF, 0xFC,
+    0xE9, 0x8C, 0x91, 0x14, 0x71, 0x37, 0xF5, 0x8D, 0x39, 0x0F, 0x76, 0xF9, 0xBD, 0x50, 0x35, 0x4E,
+    0xF2, 0xB7, 0x90, 0x64, 0xBC, 0xF9, 0xD1, 0x65, 0x2C, 0xF5, 0x40, 0xD3, 0x4A, 0xF7, 0x6E, 0x22,
+    0x49, 0xB3, 0x91, 0xA4, 0x21, 0x5F, 0xDB, 0xF6, 0x48, 0x91, 0x7C, 0x24, 0x4D, 0x3E, 0x67, 0x17,
+    0xE0, 0xE1, 0xC3, 0x4F, 0x41, 0xAF, 0x08, 0xC9, 0xBC, 0x26, 0xA8, 0xBF, 0x1D, 0xC8, 0xA5, 0x91,
+    0x52, 0x1A, 0xB0, 0x83, 0xF3, 0xD4, 0x9D, 0x6B, 0x70, 0x38, 0x70, 0x8F, 0x2F, 0xE0, 0x34, 0x83,
+    0x53, 0x00, 0x2B, 0x0F, 0xF9, 0x5F, 0xEF, 0xBE, 0xBC, 0xFE, 0x20, 0xE5, 0xBD, 0x91, 0x1F, 0x46,
+    0xAA, 0x23, 0x2F, 0x92, 0xF5, 0x1D, 0xBD, 0x70, 0x6F, 0xCC, 0x65, 0xB0, 0x3E, 0x12, 0xEB, 0xC6,
+    0xDE, 0x0D, 0xF9, 0xEC, 0x9E, 0x96, 0x91, 0xC6, 0x5A, 0x11, 0xAD, 0xE4, 0x6B, 0x93, 0xD6, 0x9E,
+    0x05, 0xF2, 0x98, 0xFC, 0x7C, 0x99, 0x76, 0x50, 0xF6, 0x7B, 0x07, 0x4B, 0x29, 0xAD, 0xB5, 0xB4,
+    0x1E, 0xB9, 0x03, 0xD7, 0x41, 0xDB, 0x1C, 0x05, 0x36, 0x00, 0x3E, 0x00, 0x6C, 0xD6, 0x90, 0x07,
+    0x00, 0x33, 0x42, 0x32, 0xE2, 0x14, 0xDB, 0x12, 0x1C, 0x83, 0xEB, 0xC9, 0x77, 0x43, 0x02, 0x63,
+    0x09, 0x8E, 0x41, 0x39, 0x00, 0x67, 0x37, 0x6F, 0xED, 0x01, 0x69, 0x84, 0x7C, 0x56, 0x00, 0xF3,
+    0x83, 0xB7, 0x02, 0x94, 0xAF, 0xFF, 0x30, 0x80, 0x7D, 0xE5, 0xA5, 0x11, 0xAC, 0xDE, 0xF4, 0x09,
+    0x9C, 0x43, 0xA9, 0x14, 0x30, 0x66, 0xC0, 0x68, 0xFF, 0x08, 0x6C, 0x58, 0x0F, 0x50, 0x9F, 0x18,
+    0x7A, 0x05, 0xC8, 0x22, 0x80, 0x99, 0x21, 0xC5, 0xDF, 0x04, 0xC8, 0xE0, 0x31, 0x00, 0x3E, 0xB4,
+    0x9B, 0xCE, 0x33, 0x40, 0xE1, 0xD3, 0x4E, 0x34, 0xE3, 0x4E, 0xA9, 0x9F, 0x70, 0x39, 0xEC, 0x60,
+    0x87, 0x62, 0xCC, 0xA3, 0x09, 0xB4, 0xF9, 0x8C, 0x1D, 0x22, 0x66, 0xBE, 0x03, 0x6A, 0xA1, 0x56,
+    0x43, 0x21, 0x0F, 0xF2, 0xE0, 0xC6, 0x24, 0xA7, 0x99, 0xD3, 0x7C, 0xDF, 0x5C, 0xA0, 0x5D, 0xA1,
+    0x5E, 0xC1, 0xCE, 0xDB, 0xA4, 0xE5, 0x13, 0x38, 0x30, 0x13, 0xB4, 0x13, 0xA5, 0x46, 0x96, 0x1E,
+    0xFB, 0xE2, 0x9C, 0xCD, 0xB6, 0xAB, 0x9B, 0xD9, 0x84, 0x1A, 0x57, 0x8C, 0xC5, 0xB7, 0x23, 0x87,
+    0x6A, 0xAC, 0x06, 0x34, 0x52, 0x0D, 0x47, 0x1F, 0x0B, 0x70, 0x1D, 0xCE, 0xA6, 0x19, 0x28, 0x03,
+    0x65, 0x58, 0x41, 0xD5, 0x40, 0xFD, 0xEA, 0x42, 0xF6, 0xC2, 0xA3, 0xDD, 0x7B, 0xA8, 0x11, 0x71,
+    0x8D, 0x1D, 0x8A, 0x91, 0x9E, 0x48, 0x11, 0xEA, 0x0E, 0xF7, 0xF1, 0x90, 0xF4, 0x70, 0xAF, 0xF8,
+    0x14, 0x8D, 0x2B, 0x91, 0x14, 0xB1, 0x73, 0xF2, 0x40, 0xD8, 0x31, 0x69, 0xF2, 0x6F, 0xD4, 0x50,
+    0x68, 0x84, 0x7E, 0xDE, 0xA9, 0x02, 0x67, 0x7E, 0x8F, 0x94, 0xBA, 0x20, 0x4D, 0xF0, 0xF0, 0xA7,
+    0x1E, 0x30, 0xAC, 0x99, 0xD8, 0xD0, 0x44, 0xA6, 0x6E, 0xC3, 0x30, 0x1C, 0x46, 0x12, 0xA0, 0xC0,
+    0x3D, 0xE1, 0x37, 0x14, 0x63, 0xFD, 0x42, 0x82, 0x31, 0x65, 0xB0, 0x63, 0xC2, 0x31, 0x46, 0x12,
+    0xB9, 0x24, 0x8F, 0xA4, 0x80, 0x30, 0x91, 0xB6, 0x43, 0xCD, 0x0E, 0x59, 0x90, 0x41, 0x7A, 0x3B,
+    0xB0, 0x77, 0xF0, 0x67, 0xEF, 0x1E, 0xBF, 0x7C, 0x6B, 0xC4, 0x6A, 0xC6, 0xBE, 0xB1, 0x50, 0x7A,
+    0x47, 0x31, 0x58, 0x9F, 0x8F, 0x26, 0x10, 0x88, 0x5C, 0xE0, 0x90, 0x4A, 0x6A, 0x4C, 0x0A, 0xA5,
+    0x81, 0xF2, 0x5E, 0x3C, 0x0E, 0xE3, 0xC5, 0x08, 0xB5, 0x26, 0x28, 0x34, 0x03, 0xED, 0x6B, 0x0F,
+    0x50, 0x6F, 0x49, 0x91, 0x6B, 0x03, 0x4B, 0xB8, 0x19, 0xA8, 0x7B, 0xA0, 0x7A, 0xC5, 0x27, 0xBC,
+    0x44, 0x39, 0x46, 0x30, 0xC1, 0x35, 0x98, 0xD9, 0x0E, 0xE4, 0xD1, 0xCC, 0x20, 0xAD, 0x5B, 0x3C,
+    0xEC, 0xA5, 0x90, 0xA0, 0x84, 0xF3, 0x88, 0x6A, 0xC4, 0x0D, 0x36, 0x60, 0xA7, 0x13, 0x62, 0x38,
+    0x05, 0x0A, 0x4D, 0xDB, 0x20, 0xFF, 0x5C, 0xED, 0x16, 0xA0, 0x1E, 0xA0, 0x58, 0xB7, 0xF5, 0xA8,
+    0x7B, 0x28, 0xDE, 0x0A, 0xB0, 0xB8, 0xB4, 0x18, 0x26, 0xB8, 0x86, 0xD5, 0x4C, 0xD4, 0xDE, 0x75,
+    0x46, 0x9A, 0x91, 0xE4, 0x6B, 0x29, 0x1A, 0x49, 0x5E, 0x98, 0x58, 0x8D, 0xB8, 0x6F, 0xC6, 0x04,
+    0x23, 0xDB, 0x6D, 0x63, 0x66, 0xEA, 0x36, 0xE3, 0xA8, 0x8F, 0x9D, 0x73, 0xBF, 0x87, 0xD3, 0x68,
+    0xDF, 0x58, 0xF2, 0x60, 0xFD, 0x75, 0x62, 0xD9, 0x59, 0x1F, 0x88, 0x96, 0xFA, 0xE9, 0xE4, 0x96,
+    0x1B, 0x29, 0xE4, 0x6B, 0x9B, 0x4C, 0x65, 0x81, 0x1A, 0x8C, 0x52, 0xFC, 0x7A, 0x0A, 0x52, 0xB8,
+    0x34, 0x1E, 0x98, 0x37, 0xA0, 0x9A, 0x9D, 0xF4, 0xFC, 0xD9, 0xCD, 0x35, 0xB9, 0x95, 0x56, 0x91,
+    0x5A, 0xF2, 0x85, 0x9A, 0x84, 0x4C, 0xDC, 0xB8, 0xF9, 0x65, 0x75, 0x29, 0x2A, 0x66, 0x02, 0xEA,
+    0x09, 0x72, 0x0D, 0xE7, 0xA8, 0x95, 0xC0, 0x1C, 0x36, 0x7D, 0x7A, 0x25, 0x93, 0x06, 0xE0, 0x3C,
+    0x5C, 0xDB, 0xF2, 0x92, 0x34, 0xD2, 0xB9, 0x19, 0x45, 0xA3, 0xAF, 0x94, 0x23, 0xD6, 0x53, 0x77,
+    0xB8, 0x06, 0x07, 0xEE, 0x19, 0x9C, 0xFC, 0x46, 0x46, 0x6C, 0xF8, 0xB2, 0x21, 0x39, 0x51, 0xA3,
+    0x0E, 0xDC, 0x93, 0x9E, 0x3C, 0x94, 0xC3, 0xFD, 0x36, 0xF3, 0x39, 0x75, 0xD8, 0x34, 0x5E, 0xA0,
+    0x96, 0x7C, 0xA6, 0x61, 0x9B, 0x37, 0x75, 0x9B, 0xCC, 0x6E, 0xDC, 0x70, 0x58, 0x11, 0x37, 0xA1,
+    0xE9, 0xA7, 0xB3, 0x3E, 0x97, 0x44, 0xB1, 0xE1, 0xCE, 0x91, 0x4A, 0xEA, 0xA8, 0xB4, 0x6C, 0x33,
+    0x54, 0x7B, 0x32, 0x0D, 0xD8, 0x57, 0x06, 0x62, 0x31, 0x9E, 0xA4, 0x44, 0xFA, 0x88, 0x5D, 0xBF,
+    0xCA, 0x61, 0xF2, 0x1F, 0x75, 0x07, 0x4B, 0xBA, 0xB5, 0x63, 0x87, 0x93, 0xA7, 0x55, 0xC3, 0xD5,
+    0xB4, 0xAD, 0xEB, 0x6E, 0xDB, 0xB5, 0x7D, 0x03, 0x36, 0x00, 0x07, 0xFF, 0xA2, 0xF3, 0xED, 0x1A,
+    0x2A, 0x8F, 0x0D, 0x14, 0x91, 0xEC, 0x85, 0x2D, 0xC2, 0xE5, 0x0A, 0x46, 0x5F, 0xC9, 0x67, 0x88,
+    0x70, 0x08, 0xAE, 0xC1, 0x7A, 0xCC, 0xFC, 0xAF, 0x91, 0xA8, 0x34, 0x64, 0xFD, 0x08, 0xFC, 0x2A,
+    0xBF, 0x09, 0xD5, 0x33, 0x33, 0x94, 0x1A, 0x92, 0xD9, 0x6C, 0x51, 0xE8, 0xC6, 0xBB, 0xB7, 0xEA,
+    0x23, 0x1A, 0x93, 0xE4, 0x85, 0xE4, 0xA9, 0x25, 0x4F, 0x3B, 0x6D, 0xE2, 0x9A, 0x75, 0x17, 0xC4,
+    0xED, 0x4C, 0x92, 0x9E, 0x2A, 0xEC, 0x66, 0xBE, 0x5E, 0xB2, 0xAF, 0x52, 0x4B, 0x81, 0x4A, 0x0A,
+    0x49, 0x81, 0x42, 0x1A, 0x77, 0x1A, 0x00, 0x2E, 0x9B, 0xB1, 0xAF, 0x0C, 0x14, 0x6A, 0xC8, 0x23,
+    0xA7, 0x78, 0xA9, 0x73, 0x33, 0xF4, 0x11, 0xA3, 0xAF, 0x50, 0x8E, 0x69, 0xA7, 0xD4, 0x5D, 0x02,
+    0x30, 0x0E, 0x70, 0xCF, 0xA4, 0xE8, 0x58, 0x69, 0xE0, 0xD8, 0x94, 0x70, 0xDC, 0x06, 0xFB, 0xAD,
+    0x11, 0x0A, 0xED, 0xB2, 0x40, 0xA6, 0x77, 0x47, 0x27, 0xBD, 0x06, 0x4E, 0x6A, 0x68, 0xA5, 0x21,
+    0x65, 0x34, 0xC2, 0x4E, 0xAC, 0x98, 0x29, 0x5B, 0x30, 0x53, 0x1E, 0x31, 0x93, 0x89, 0x98, 0x60,
+    0x66, 0x8A, 0x50, 0x4C, 0xD8, 0xB1, 0x0C, 0xB8, 0xC1, 0x86, 0x5F, 0x96, 0xAF, 0x24, 0x35, 0xB5,
+    0xA4, 0xCD, 0x07, 0xA5, 0xC5, 0x79, 0x9B, 0xA3, 0x00, 0xEB, 0x7E, 0x15, 0xD8, 0xBB, 0x04, 0xDC,
+    0xBE, 0x03, 0xC4, 0x08, 0xD9, 0xBD, 0x99, 0x73, 0xFF, 0xF8, 0xD6, 0x44, 0xAF, 0x1D, 0xB2, 0x19,
+    0xDB, 0x01, 0xDB, 0x39, 0x4F, 0x8D, 0xF3, 0x5C, 0xA2, 0x6D, 0x70, 0x99, 0xC0, 0x49, 0xE0, 0xB4,
+    0x42, 0xA5, 0x15, 0xCC, 0x72, 0xE7, 0x17, 0x91, 0x86, 0xB9, 0xDD, 0xAF, 0x63, 0x20, 0x76, 0xB0,
+    0xDE, 0x48, 0x5C, 0xDF, 0xB9, 0x7F, 0x9C, 0x78, 0x0F, 0xC1, 0xBB, 0x9F, 0x24, 0x38, 0x64, 0x97,
+    0x53, 0xC4, 0xB3, 0x12, 0x3C, 0xF5, 0x17, 0x0F, 0x8A, 0x78, 0x3C, 0x74, 0x53, 0x9E, 0x5E, 0x2B,
+    0x46, 0x0A, 0xD8, 0x61, 0xF3, 0x90, 0x79, 0xDC, 0xE2, 0x29, 0x6D, 0x1A, 0xBD, 0xC3, 0x6A, 0x01,
+    0xB7, 0xBF, 0x7B, 0x2F, 0x00, 0xEE, 0x7B, 0x07, 0x64, 0x52, 0xA4, 0xDC, 0xE2, 0x82, 0xCF, 0x24,
+    0x6D, 0x68, 0xAC, 0x48, 0xDB, 0x87, 0x47, 0x0F, 0xAE, 0xBC, 0x27, 0x5C, 0x29, 0x67, 0xE8, 0x45,
+    0x7E, 0xAF, 0x6A, 0xCA, 0xEF, 0x5E, 0xED, 0xAC, 0xD4, 0xD5, 0x52, 0xE7, 0xAE, 0x6C, 0xD6, 0xF6,
+    0xBD, 0xBF, 0xC4, 0x69, 0xC1, 0x2A, 0x92, 0x6B, 0xFF, 0x64, 0xB0, 0x33, 0x12, 0x29, 0xCC, 0x14,
+    0xEB, 0x2F, 0x4A, 0x27, 0x60, 0x2E, 0x07, 0x9C, 0x02, 0xA5, 0x02, 0xF4, 0xC3, 0x7B, 0xA5, 0x43,
+    0x1D, 0xB9, 0x22, 0xF9, 0xBD, 0xAA, 0xC9, 0xEF, 0x7D, 0x66, 0x44, 0x9A, 0xE9, 0xB5, 0xE2, 0xAE,
+    0xA4, 0x1D, 0x65, 0xD6, 0x83, 0x11, 0x69, 0xC2, 0x2A, 0x42, 0xFF, 0xDA, 0x91, 0x1D, 0x94, 0x81,
+    0x04, 0x68, 0xAB, 0x91, 0xCD, 0xBF, 0xDC, 0xA7, 0x57, 0xBE, 0x59, 0x51, 0xF2, 0x7A, 0xED, 0xEE,
+    0x33, 0x2B, 0x50, 0x29, 0x26, 0xAD, 0x9C, 0x26, 0xCC, 0xBD, 0x1D, 0x28, 0x0A, 0x80, 0x0E, 0x9E,
+    0xA7, 0x92, 0x7C, 0xBE, 0x6D, 0x1B, 0x5F, 0x48, 0x71, 0x83, 0x9F, 0x2B, 0x54, 0x23, 0xF9, 0x02,
+    0x0F, 0x82, 0x63, 0xE5, 0x4C, 0xA9, 0x90, 0xDF, 0xAB, 0x9A, 0xC3, 0x4F, 0xCF, 0x56, 0x7A, 0x46,
+    0x9A, 0xDD, 0x15, 0x4C, 0x00, 0xF7, 0xBD, 0xBF, 0x34, 0xD2, 0x60, 0x15, 0xA9, 0xEF, 0xFD, 0xFC,
+    0xA5, 0xCB, 0xE6, 0x2D, 0xF5, 0x4C, 0x31, 0xC6, 0xEF, 0x92, 0xD0, 0x9F, 0x5E, 0x22, 0xA0, 0x48,
+    0x10, 0xF6, 0x0E, 0xD8, 0x7D, 0x50, 0x73, 0x1F, 0x8A, 0x76, 0xD9, 0x0C, 0xD5, 0x2B, 0x43, 0x62,
+    0xD4, 0x13, 0x26, 0xCF, 0xDE, 0x03, 0x67, 0x3F, 0x74, 0x33, 0x79, 0xE2, 0x6E, 0xDB, 0x6E, 0xCD,
+    0xA6, 0x21, 0xFD, 0x0E, 0xD9, 0x67, 0x92, 0x4F, 0x3A, 0x1A, 0xA9, 0x49, 0x4A, 0x96, 0x61, 0xA7,
+    0xA5, 0x7D, 0xFB, 0xA0, 0xA3, 0x3A, 0x72, 0xE7, 0x4E, 0xF2, 0x27, 0x09, 0x9F, 0xBD, 0x7C, 0x22,
+    0xBF, 0x17, 0x13, 0x89, 0x85, 0xEB, 0xB6, 0x64, 0x8D, 0xF7, 0xDD, 0x3B, 0xA5, 0x02, 0xF9, 0xBD,
+    0xAA, 0xE1, 0xF0, 0xD3, 0x33, 0x56, 0xEA, 0xD2, 0x02, 0x5C, 0xD9, 0x72, 0x1A, 0xF7, 0xBD, 0xBF,
+    0xC4, 0x48, 0x43, 0xB2, 0xB3, 0x6D, 0x4A, 0x38, 0xCA, 0x38, 0x8A, 0x94, 0xB0, 0x74, 0x60, 0x7E,
+    0x14, 0x21, 0x9F, 0xCA, 0xF7, 0x32, 0xE8, 0x87, 0x2F, 0x73, 0x94, 0x15, 0x4E, 0x58, 0x69, 0xC1,
+    0xAA, 0x39, 0x93, 0xF6, 0x9E, 0x59, 0xD9, 0xAC, 0x36, 0x81, 0x4B, 0xE7, 0x1F, 0xFA, 0x33, 0x6C,
+    0x30, 0x9A, 0x8B, 0x88, 0x96, 0x5C, 0xFC, 0xB2, 0x9A, 0xDE, 0x73, 0x48, 0xB5, 0x5E, 0x51, 0x67,
+    0x24, 0x0D, 0x09, 0x49, 0x5A, 0x69, 0x86, 0xAB, 0xEB, 0x3E, 0x5B, 0xAE, 0x43, 0xED, 0x21, 0x93,
+    0x07, 0xFB, 0xCA, 0xC0, 0x49, 0x60, 0x70, 0xAA, 0x6E, 0x32, 0x47, 0x90, 0x02, 0xF6, 0x0D, 0x75,
+    0xDC, 0x2E, 0x16, 0xCC, 0x60, 0x03, 0xE7, 0x71, 0x1D, 0x53, 0xB6, 0x60, 0xBC, 0x0D, 0xD8, 0xA7,
+    0x7B, 0x8F, 0xD3, 0x92, 0x9E, 0xCC, 0x24, 0x4F, 0xD6, 0x2F, 0x29, 0xDB, 0xCB, 0x9B, 0xB6, 0xA1,
+    0x4A, 0xEE, 0xD6, 0x6F, 0x88, 0xF9, 0xE1, 0x93, 0xA4, 0x62, 0x73, 0x1B, 0x90, 0xBA, 0x54, 0x9F,
+    0xD9, 0x22, 0xEB, 0x7B, 0x4F, 0x0D, 0xBD, 0x66, 0xE8, 0xA5, 0x06, 0x97, 0x26, 0xA8, 0x39, 0xB3,
+    0xA5, 0x10, 0x6E, 0x64, 0xA3, 0x2D, 0xD3, 0xE4, 0xD8, 0x90, 0xFF, 0x05, 0x08, 0xA7, 0xAE, 0x0A,
+    0x46, 0x53, 0x9A, 0x9D, 0x3A, 0x50, 0x77, 0x99, 0xBE, 0xFB, 0xE4, 0x8C, 0x4D, 0x51, 0x46, 0x0A,
+    0x18, 0x69, 0x85, 0xB3, 0xFA, 0xBF, 0xA7, 0x60, 0x7E, 0xFE, 0x3E, 0x9E, 0x2F, 0x3B, 0x74, 0xE0,
+    0x14, 0x31, 0x6F, 0x6B, 0xA4, 0xCE, 0xD4, 0x30, 0x99, 0x48, 0xD9, 0xD9, 0x91, 0x8B, 0xB4, 0x0D,
+    0xC1, 0x44, 0xCC, 0x78, 0x35, 0x60, 0x93, 0xB0, 0x31, 0x39, 0x43, 0xAE, 0xAA, 0x49, 0x68, 0x64,
+    0xBF, 0x1A, 0x28, 0x52, 0x38, 0x09, 0x64, 0x5A, 0x81, 0x33, 0x1B, 0x84, 0xCD, 0x9E, 0x3B, 0xF2,
+    0x9F, 0xBB, 0x18, 0x6F, 0x1F, 0xBC, 0x57, 0xCE, 0x7C, 0x0A, 0xCA, 0x64, 0x8D, 0x0B, 0x4E, 0x9A,
+    0x8C, 0x86, 0xAC, 0xA9, 0x76, 0xA0, 0x31, 0xB1, 0xB8, 0x03, 0x20, 0x1E, 0xBD, 0x6C, 0x22, 0x5A,
+    0xAB, 0x60, 0x34, 0xF5, 0xFE, 0x4C, 0xFF, 0xB2, 0xC8, 0xE7, 0x42, 0x7F, 0xDE, 0x8E, 0x76, 0x0B,
+    0xF6, 0x5B, 0x9C, 0x3F, 0xA7, 0xE7, 0x76, 0x5E, 0xB2, 0xF2, 0x69, 0xE4, 0x22, 0xBE, 0xDB, 0x49,
+    0x66, 0x87, 0x0E, 0x23, 0x79, 0xF3, 0xB6, 0xC6, 0x3C, 0x54, 0x13, 0x93, 0x89, 0xDC, 0x62, 0xE5,
+    0x22, 0x6D, 0x63, 0x71, 0xDE, 0x8C, 0x57, 0x03, 0xD2, 0x84, 0x53, 0x4C, 0x9A, 0x5E, 0x55, 0x03,
+    0xD6, 0xB3, 0x5F, 0x0D, 0xB4, 0x0A, 0x38, 0x05, 0x2A, 0x8D, 0x47, 0x8A, 0xDB, 0x23, 0xA8, 0x95,
+    0x50, 0xD6, 0x00, 0xB4, 0x7E, 0x83, 0xBC, 0xB9, 0xDE, 0x6F, 0x8F, 0x66, 0x57, 0x36, 0xE3, 0x28,
+    0xD3, 0x88, 0x9A, 0xD0, 0xC4, 0xE5, 0xEC, 0x08, 0xC6, 0x99, 0x08, 0x94, 0xD3, 0xCE, 0x30, 0x6C,
+    0x30, 0x9A, 0xAB, 0x60, 0x34, 0xD5, 0x21, 0xBB, 0x3A, 0xD5, 0x81, 0xBA, 0xAB, 0xD6, 0x2B, 0xEA,
+    0xAC, 0xA4, 0xA6, 0x94, 0xB4, 0x19, 0x45, 0xDA, 0x33, 0xD9, 0x41, 0x93, 0x48, 0x4C, 0x37, 0xA4,
+    0x19, 0xB1, 0x53, 0x9A, 0x15, 0x13, 0x81, 0x5D, 0xD8, 0xBD, 0xFA, 0xC5, 0x94, 0x72, 0xAE, 0xFD,
+    0xCC, 0xED, 0x62, 0xE1, 0x22, 0xE2, 0x3C, 0xAE, 0xB3, 0x4D, 0x35, 0x18, 0x6F, 0x03, 0xF3, 0xB9,
+    0xB8, 0x85, 0x59, 0xA5, 0x8D, 0x72, 0x4E, 0x03, 0x98, 0xC0, 0x6F, 0x14, 0x13, 0x95, 0x22, 0x56,
+    0x31, 0xED, 0x92, 0xEC, 0x32, 0x6C, 0x78, 0x31, 0x8F, 0x6C, 0x68, 0xCF, 0x7E, 0x6B, 0x04, 0xF7,
+    0xF8, 0x7C, 0xBF, 0xF2, 0x95, 0x67, 0xA5, 0xF6, 0xD9, 0x82, 0xF3, 0x79, 0xC4, 0x75, 0x26, 0xD2,
+    0x37, 0x66, 0x46, 0x14, 0x13, 0xA2, 0x9C, 0xB2, 0x35, 0x51, 0xC9, 0x55, 0x30, 0x0B, 0xF5, 0x58,
+    0x48, 0x1A, 0xCA, 0x5D, 0x29, 0xC0, 0x5B, 0x49, 0x5D, 0xF5, 0xF6, 0x81, 0x9A, 0x3A, 0x64, 0x6A,
+    0xDC, 0x98, 0x8B, 0x76, 0x30, 0x3A, 0x4E, 0x5F, 0xFA, 0x86, 0x42, 0x1D, 0xEE, 0x6A, 0x67, 0x42,
+    0x79, 0xC4, 0x9C, 0x97, 0x43, 0x32, 0x93, 0x78, 0x74, 0x9B, 0x45, 0x28, 0xDF, 0x98, 0x71, 0x9A,
+    0x33, 0xBD, 0x11, 0xCA, 0xA9, 0xF4, 0xAE, 0xAB, 0xB3, 0x48, 0x2C, 0x43, 0x31, 0xBA, 0xAE, 0x7E,
+    0x7C, 0x21, 0x96, 0xA1, 0x0C, 0xCE, 0xBB, 0xAF, 0x29, 0x3B, 0xDC, 0x64, 0x2F, 0x03, 0x6D, 0x63,
+    0x22, 0xB5, 0x67, 0xC5, 0x6E, 0xFF, 0x68, 0x2B, 0x1C, 0x68, 0xAC, 0x24, 0x4D, 0xF9, 0x42, 0x15,
+    0x50, 0x53, 0xCE, 0x38, 0x69, 0xA1, 0xDE, 0xB2, 0x06, 0x79, 0x23, 0x69, 0xCC, 0x74, 0x70, 0x73,
+    0xA2, 0xF7, 0xC5, 0x82, 0x1B, 0x73, 0x51, 0x4D, 0xC8, 0x1F, 0xCB, 0xA5, 0x89, 0x5E, 0xDE, 0xE8,
+    0xCF, 0x21, 0x42, 0x91, 0x44, 0xE4, 0x58, 0x44, 0xDE, 0x47, 0xC4, 0xE2, 0xE5, 0x0E, 0x5D, 0xE0,
+    0x7C, 0xDF, 0x99, 0x6F, 0x3E, 0x60, 0x1B, 0xE6, 0x33, 0x38, 0x8F, 0x99, 0xC1, 0x35, 0x14, 0x01,
+    0x0E, 0x53, 0xB5, 0x24, 0x42, 0x75, 0xFC, 0xFA, 0x04, 0x3D, 0xD8, 0x40, 0xB6, 0x42, 0x3D, 0x62,
+    0x96, 0x5D, 0x39, 0xF7, 0x57, 0xB8, 0xFE, 0x18, 0xBA, 0x96, 0xBF, 0x3E, 0xE7, 0x2F, 0x9F, 0x70,
+    0xC3, 0xB7, 0x20, 0xC2, 0x4C, 0x36, 0x91, 0x07, 0x4C, 0xA0, 0x18, 0x29, 0x07, 0xAC, 0xA7, 0xF2,
+    0xD4, 0x7E, 0xA3, 0xBB, 0xE0, 0xCB, 0xF2, 0xA5, 0xD4, 0xB4, 0x7A, 0xFE, 0x41, 0x1B, 0xE3, 0x30,
+    0xD9, 0xA8, 0x1D, 0xC1, 0x35, 0x69, 0x7D, 0xD2, 0x2D, 0x31, 0xA1, 0x12, 0x97, 0xD2, 0xBE, 0x62,
+    0x4A, 0xE2, 0x28, 0x45, 0xAB, 0x7A, 0x4C, 0x41, 0x3C, 0x02, 0x5C, 0x39, 0xC8, 0xA4, 0x41, 0x9A,
+    0x4E, 0x71, 0xD3, 0xF9, 0x08, 0x11, 0x2E, 0x41, 0xD5, 0x50, 0x7A, 0x4C, 0x20, 0x9B, 0xE1, 0x0E,
+    0x38, 0xA8, 0x3C, 0x65, 0x20, 0x9F, 0xD3, 0xFC, 0x98, 0x88, 0x99, 0x31, 0x13, 0x45, 0xA0, 0x1C,
+    0xB1, 0x3B, 0x2D, 0x5C, 0x87, 0x6B, 0x68, 0x1B, 0x7A, 0x10, 0xD9, 0x4A, 0xBE, 0x62, 0x16, 0x8A,
+    0x88, 0xF5, 0x5C, 0x02, 0x37, 0x52, 0x0F, 0x29, 0xDF, 0x3E, 0xCA, 0x07, 0x4D, 0x3C, 0xE1, 0x8A,
+    0xCE, 0x83, 0xF5, 0x98, 0x91, 0x6C, 0x82, 0xDB, 0x69, 0xE4, 0x8E, 0x72, 0xC0, 0x04, 0xB2, 0x08,
+    0x3D, 0xB8, 0x8E, 0xBA, 0xA3, 0x6E, 0xB0, 0x91, 0x5C, 0x27, 0x4A, 0xE8, 0x8F, 0x80, 0xF5, 0x94,
+    0x01, 0x13, 0xDF, 0xE5, 0x5C, 0xCA, 0x11, 0x13, 0x61, 0xDD, 0x8D, 0x5B, 0x8E, 0x98, 0x09, 0x22,
+    0xB4, 0xE0, 0x3A, 0xEC, 0x40, 0x31, 0x91, 0x47, 0x10, 0xB4, 0x1D, 0xF5, 0x88, 0x4D, 0xFF, 0x73,
+    0x8B, 0xC8, 0x9C, 0x4D, 0x79, 0x30, 0xA1, 0x18, 0xCB, 0xC1, 0xFA, 0xCA, 0xD7, 0xBE, 0xEE, 0xB8,
+    0xD4, 0xD0, 0x63, 0x07, 0x9C, 0x2F, 0x02, 0xD5, 0x98, 0x47, 0xCA, 0xC0, 0x8A, 0x89, 0xB8, 0x26,
+    0x5B, 0xA9, 0x3C, 0x3D, 0x65, 0xC0, 0x79, 0x33, 0x63, 0x47, 0x16, 0xCA, 0x40, 0x8B, 0x89, 0x38,
+    0xCF, 0x8A, 0x1D, 0x69, 0x9B, 0x62, 0xC2, 0xF9, 0x7C, 0xC1, 0x8E, 0x69, 0x67, 0xB7, 0xDE, 0x44,
+    0xCE, 0x8D, 0x89, 0xEC, 0xEC, 0x1B, 0xB2, 0xA6, 0xF7, 0x1B, 0x9B, 0xDA, 0x2A, 0x80, 0xD3, 0x04,
+    0x56, 0x33, 0xE4, 0xC7, 0x65, 0x08, 0xB2, 0x1B, 0x9C, 0x81, 0x85, 0xD2, 0xD3, 0x63, 0x42, 0xF2,
+    0x19, 0xD5, 0x69, 0xC3, 0xCE, 0x47, 0x4A, 0x9F, 0xBA, 0x32, 0x2E, 0xC1, 0x4C, 0xD5, 0x70, 0x9B,
+    0xD2, 0xE3, 0x30, 0x01, 0xDB, 0x65, 0x33, 0xA5, 0xE7, 0x0E, 0x26, 0xE0, 0x60, 0xA2, 0xF2, 0xDC,
+    0xA6, 0x0C, 0x38, 0xF2, 0x39, 0xB1, 0x3C, 0x95, 0x4F, 0x8D, 0x07, 0xE0, 0xA6, 0x9D, 0x53, 0xE7,
+    0xF2, 0x6E, 0xCD, 0x36, 0x2A, 0x21, 0xD1, 0x7E, 0xF5, 0x4D, 0x0F, 0xC5, 0x58, 0x37, 0x0F, 0x82,
+    0x5E, 0xD3, 0x11, 0xE2, 0xA9, 0xC6, 0x9D, 0x2F, 0x4C, 0x10, 0xB5, 0x98, 0x8E, 0x20, 0xA1, 0x1D,
+    0xD9, 0xFA, 0x23, 0xD2, 0x5B, 0x89, 0xF1, 0xDD, 0x50, 0xC0, 0x11, 0x1B, 0x5C, 0xFB, 0x23, 0x80,
+    0xD0, 0x36, 0xF0, 0xFB, 0x75, 0x00, 0xAB, 0x75, 0x47, 0x56, 0x3A, 0x85, 0x1D, 0xB5, 0x7C, 0x2A,
+    0xB0, 0x84, 0xED, 0x5B, 0x4B, 0x35, 0x64, 0xCB, 0x21, 0x5C, 0x22, 0xDE, 0xFF, 0x0C, 0xA9, 0xFB,
+    0x20, 0x31, 0xDB, 0x71, 0x57, 0xF8, 0x9F, 0xB6, 0x28, 0x6A, 0xC6, 0x8D, 0x0B, 0xB7, 0x47, 0x7C,
+    0x55, 0xB3, 0xE1, 0xC6, 0x75, 0x63, 0x56, 0xAB, 0xB8, 0xF1, 0x14, 0x67, 0x4E, 0x2E, 0x82, 0x76,
+    0x33, 0xE7, 0xFC, 0x56, 0xE9, 0xAE, 0xC2, 0x49, 0x02, 0xE8, 0xF4, 0xB5, 0x96, 0x33, 0x45, 0x68,
+    0x3D, 0xF5, 0xB3, 0x11, 0x16, 0xE7, 0x29, 0x7E, 0xB8, 0x80, 0xBB, 0x39, 0xC0, 0xBA, 0x42, 0xA9,
+    0x11, 0x9C, 0x20, 0x53, 0x80, 0x52, 0x1D, 0x38, 0x35, 0x64, 0x12, 0x29, 0x71, 0x75, 0x5F, 0x5A,
+    0xC9, 0x17, 0xB7, 0x62, 0x83, 0x5B, 0x68, 0x7D, 0xBF, 0x00, 0x77, 0x92, 0xA4, 0x55, 0x77, 0xEA,
+    0xF6, 0x36, 0x98, 0x1F, 0x44, 0xAA, 0x9B, 0x9E, 0x7E, 0xC6, 0xA8, 0xA3, 0x8A, 0xD0, 0x4F, 0x18,
+    0x05, 0x2A, 0x05, 0xFA, 0x36, 0x98, 0x59, 0x63, 0xF5, 0x0D, 0x9D, 0x44, 0xBA, 0xF9, 0x41, 0x52,
+    0xA8, 0xF5, 0xE4, 0x4B, 0xD2, 0x46, 0x0D, 0x65, 0x3C, 0xCE, 0x88, 0x6E, 0xDD, 0xE6, 0x47, 0x21,
+    0x7B, 0x6B, 0xC8, 0xDF, 0x6C, 0xCC, 0x4A, 0x31, 0x63, 0x03, 0x36, 0x52, 0x8B, 0x4B, 0x6D, 0x77,
+    0xBD, 0x1E, 0xE1, 0x22, 0x94, 0x9E, 0x2C, 0xC0, 0xA5, 0x23, 0xD2, 0xCF, 0x26, 0x57, 0x54, 0x9F,
+    0xF2, 0xC2, 0x02, 0x3B, 0x92, 0x1D, 0xBF, 0xDE, 0x36, 0x94, 0xE9, 0xF5, 0x4A, 0x7A, 0x59, 0x8A,
+    0x4E, 0xFA, 0xBA, 0x34, 0x43, 0x06, 0xC6, 0x63, 0x46, 0xF2, 0x40, 0x76, 0x1F, 0x02, 0x35, 0xE3,
+    0x49, 0xB7, 0x76, 0xE4, 0x5C, 0x4E, 0x79, 0xBA, 0x01, 0x13, 0x20, 0xC2, 0x1E, 0xB8, 0x19, 0xBB,
+    0x26, 0xB0, 0xFF, 0xCF, 0x15, 0xEB, 0x98, 0xA4, 0xBA, 0x81, 0x11, 0xB8, 0x54, 0xE3, 0x52, 0x43,
+    0x1D, 0x30, 0x11, 0xAE, 0x34, 0xA4, 0xD4, 0xED, 0x41, 0x72, 0x9D, 0xF4, 0x83, 0xE9, 0x25, 0xEB,
+    0x29, 0x46, 0x8C, 0x3A, 0x34, 0x26, 0x52, 0xFA, 0x24, 0x88, 0x98, 0x29, 0x23, 0x66, 0x21, 0x13,
+    0xA8, 0xA1, 0xEF, 0xD2, 0x66, 0xB2, 0x3B, 0x72, 0xCA, 0x83, 0xEB, 0x3E, 0x8B, 0x6B, 0x22, 0x6D,
+    0x36, 0x23, 0x13, 0x58, 0x4D, 0xC8, 0x62, 0x39, 0xE6, 0x31, 0xED, 0xB9, 0x62, 0x4A, 0x69, 0x98,
+    0x0D, 0x50, 0x49, 0x43, 0x9D, 0x02, 0xB8, 0x6F, 0x53, 0x69, 0xFE, 0x76, 0xDA, 0x1C, 0xD9, 0x84,
+    0x7D, 0x36, 0x50, 0x7D, 0x21, 0x50, 0xFF, 0xBB, 0xFD, 0x5D, 0xE7, 0x0E, 0x77, 0xB6, 0x77, 0x4F,
+    0x74, 0xEE, 0x14, 0x21, 0x6D, 0x29, 0xEB, 0x8F, 0xFB, 0x26, 0xDC, 0x7C, 0xFC, 0x73, 0x42, 0xB6,
+    0x3F, 0xC4, 0x75, 0x0B, 0xEE, 0xF1, 0x85, 0xD6, 0x44, 0x54, 0x44, 0xD6, 0x84, 0x46, 0x7E, 0x2A,
+    0xD9, 0x6C, 0x47, 0x31, 0x92, 0x27, 0x0F, 0xBF, 0x57, 0x77, 0xF5, 0x13, 0xA3, 0x7D, 0x69, 0x2A,
+    0x5E, 0x8D, 0xF9, 0x74, 0xB0, 0x2D, 0x6B, 0x9D, 0xA8, 0xC6, 0x34, 0xC3, 0x69, 0xFA, 0xEC, 0xBB,
+    0xB2, 0x82, 0x7C, 0xDB, 0x95, 0xE5, 0xE6, 0x4D, 0x77, 0xB1, 0xA6, 0xDF, 0xFC, 0x44, 0x7A, 0xDB,
+    0x7D, 0x21, 0xBD, 0xED, 0xAA, 0xF4, 0x76, 0xDF, 0x26, 0x2B, 0xD6, 0xD6, 0xD3, 0xB4, 0x15, 0xA5,
+    0xB3, 0x6D, 0xEB, 0x98, 0x8D, 0xFD, 0x33, 0xDB, 0x70, 0xC5, 0xB6, 0x70, 0xBB, 0x94, 0x60, 0xC7,
+    0xFE, 0x1F, 0x3D, 0xEE, 0xB7, 0xAE, 0x06, 0xBF, 0x51, 0x81, 0xA9, 0x6B, 0x4D, 0x89, 0x5C, 0x31,
+    0x31, 0xFD, 0xB5, 0x3F, 0x4A, 0x65, 0x3E, 0x37, 0x9C, 0xAA, 0xEE, 0x9B, 0x4D, 0x86, 0x5D, 0xA1,
+    0xE1, 0x77, 0xDE, 0xED, 0x93, 0x6D, 0x47, 0x5A, 0xA6, 0x8D, 0xD0, 0x4F, 0x45, 0xBD, 0xBD, 0xA3,
+    0xCA, 0x5E, 0x72, 0x8F, 0x55, 0x77, 0x54, 0xF5, 0x73, 0x00, 0xC5, 0xDB, 0xEA, 0xB2, 0xCF, 0xE9,
+    0x5E, 0x53, 0xE9, 0x4D, 0x0F, 0x67, 0x4E, 0x3C, 0x95, 0x14, 0x74, 0xF3, 0xB1, 0xAE, 0x66, 0xD8,
+    0x95, 0x50, 0x13, 0x47, 0x30, 0x03, 0xDC, 0xCF, 0xAA, 0x65, 0x11, 0x3B, 0x71, 0x88, 0x59, 0x71,
+    0x4D, 0xA6, 0xAE, 0xF2, 0x28, 0x94, 0x23, 0x2E, 0x9A, 0x89, 0x4A, 0x8F, 0x47, 0xAC, 0xC6, 0x43,
+    0xCC, 0x1A, 0x5D, 0x93, 0xAF, 0x7D, 0xE5, 0xD1, 0x93, 0x2F, 0x05, 0xDC, 0xDD, 0xB7, 0x26, 0xEA,
+    0xA0, 0x88, 0x9D, 0x9D, 0x28, 0x16, 0xAB, 0x2E, 0xD7, 0xEF, 0xCA, 0x23, 0xDF, 0x06, 0xDA, 0x50,
+    0xCD, 0x3B, 0xF8, 0x55, 0x78, 0xB8, 0x9E, 0x14, 0x3C, 0x73, 0x6A, 0xE8, 0xEB, 0x7D, 0x63, 0xA4,
+    0xC6, 0xAE, 0x2B, 0x7D, 0x13, 0xCD, 0x64, 0x46, 0xEB, 0xAB, 0xEE, 0x90, 0x3B, 0x66, 0x32, 0xC1,
+    0x0E, 0x95, 0xEF, 0x91, 0x89, 0x66, 0xAE, 0xC6, 0x7A, 0x00, 0x68, 0x31, 0x0B, 0x75, 0x87, 0x3A,
+    0x3B, 0xD0, 0x8E, 0x45, 0xC0, 0xC5, 0x7C, 0xC6, 0x8A, 0x85, 0x42, 0x43, 0x8B, 0xD1, 0x5C, 0x77,
+    0xA8, 0xB7, 0x03, 0xFD, 0xCD, 0xAF, 0x07, 0xDC, 0x3F, 0xFC, 0x20, 0x62, 0xC3, 0xB2, 0x50, 0x46,
+    0x27, 0xCC, 0x6A, 0xE5, 0x33, 0x7D, 0x5C, 0x23, 0xFD, 0xD0, 0x07, 0x5C, 0xA8, 0x22, 0x55, 0x3C,
+    0x4E, 0x4B, 0xE5, 0x77, 0x19, 0xB0, 0x0D, 0x1B, 0x63, 0x91, 0x42, 0x84, 0x59, 0x78, 0x57, 0xEA,
+    0x94, 0xFD, 0x78, 0xC1, 0x6A, 0xC1, 0xBD, 0x33, 0xE7, 0x8B, 0x09, 0x76, 0xB0, 0x9D, 0x63, 0x2F,
+    0x9F, 0xF3, 0xC9, 0x0E, 0xD6, 0xBB, 0xA6, 0xCD, 0xA3, 0x89, 0x36, 0xD8, 0xB1, 0xED, 0x52, 0x1F,
+    0xC5, 0xCE, 0x65, 0xAF, 0xE9, 0xEB, 0xFB, 0x2E, 0x95, 0xDA, 0x07, 0x80, 0xB3, 0xFB, 0x0F, 0x75,
+    0x50, 0x7F, 0x62, 0xDC, 0x19, 0x6E, 0xB2, 0xA0, 0x7A, 0xEB, 0xF5, 0x7C, 0xD0, 0x55, 0x84, 0xB4,
+    0x70, 0x69, 0x3A, 0xAA, 0x39, 0x8B, 0x18, 0xF9, 0xBA, 0x4B, 0x2B, 0x57, 0x68, 0x68, 0x41, 0x6B,
+    0x39, 0x62, 0xDF, 0x09, 0x0B, 0x69, 0xE9, 0xDC, 0x3F, 0xFC, 0x20, 0x62, 0xA2, 0x6B, 0x1B, 0xFA,
+    0xBB, 0x0A, 0x69, 0xED, 0xD2, 0x8C, 0xD4, 0x53, 0x1D, 0x31, 0xCA, 0xE4, 0x8F, 0x16, 0xEF, 0xB9,
+    0xEC, 0x06, 0xD9, 0xDC, 0x42, 0xAE, 0x71, 0x93, 0xA8, 0x18, 0xB8, 0x7F, 0x15, 0x8F, 0xE4, 0xF9,
+    0xD6, 0xB4, 0x61, 0x25, 0xBD, 0x39, 0x52, 0x4E, 0xD6, 0xE3, 0x9A, 0x4B, 0x10, 0xB3, 0x99, 0x72,
+    0x2C, 0x07, 0x5C, 0xE3, 0x60, 0xC9, 0x22, 0x65, 0xB0, 0x01, 0xE7, 0x5D, 0x97, 0xAD, 0xF9, 0x92,
+    0xC0, 0xF5, 0xF1, 0xB6, 0x4E, 0x80, 0x64, 0xB7, 0x2D, 0xDD, 0x3E, 0x3F, 0xCD, 0x55, 0x5D, 0x1D,
+    0xD2, 0x26, 0x4D, 0x3B, 0xE5, 0x9D, 0x0D, 0xB9, 0x6C, 0x15, 0xB9, 0x19, 0x92, 0x18, 0x90, 0xCF,
+    0xF9, 0x04, 0x98, 0xC9, 0x04, 0xC0, 0x4C, 0x45, 0x80, 0x24, 0x0F, 0xD8, 0x60, 0x47, 0xE0, 0x17,
+    0x61, 0x6D, 0xB9, 0x80, 0x4A, 0x1E, 0xAC, 0x06, 0x28, 0xB4, 0xFF, 0x33, 0x1B, 0x96, 0x89, 0x64,
+    0x0A, 0x58, 0x41, 0x7D, 0x03, 0xE0, 0xE1, 0xCF, 0x92, 0x78, 0x02, 0x23, 0x0D, 0x64, 0x57, 0x2E,
+    0x3F, 0x60, 0xBE, 0xFE, 0xE5, 0xDB, 0xA4, 0xE0, 0xCA, 0xF3, 0x54, 0x8A, 0x38, 0x45, 0xEE, 0x97,
+    0xE1, 0x5C, 0xA2, 0xD1, 0xCD, 0xDA, 0x77, 0x65, 0xB0, 0xDE, 0x7A, 0xEB, 0xEB, 0xC6, 0x7A, 0x47,
+    0xDD, 0xB9, 0xA7, 0x85, 0xD3, 0x4A, 0xAD, 0x88, 0xD5, 0xB8, 0xB5, 0x5A, 0x6C, 0xCD, 0x7C, 0x55,
+    0x07, 0xBD, 0x06, 0x12, 0xDD, 0x91, 0xE9, 0x01, 0xC6, 0x51, 0x2D, 0xA4, 0x0A, 0x04, 0x92, 0x40,
+    0x5D, 0x3D, 0xA2, 0xC6, 0x44, 0xFA, 0x86, 0x1E, 0xD7, 0x51, 0xFB, 0xCA, 0xA7, 0x15, 0x37, 0xD1,
+    0x4C, 0xB0, 0x66, 0x0B, 0xF4, 0x4D, 0xDF, 0xD0, 0xFA, 0xFA, 0xDE, 0x19, 0x8D, 0xA5, 0xB6, 0x06,
+    0xBF, 0x09, 0xB7, 0x15, 0x3E, 0x66, 0xA8, 0x4F, 0x0F, 0x56, 0xFA, 0xBD, 0x8D, 0x65, 0x98, 0x36,
+    0xE2, 0xEC, 0x9F, 0xA1, 0x5D, 0xE5, 0x4D, 0x20, 0x8F, 0xB4, 0x0D, 0xF5, 0x50, 0xCC, 0x64, 0x2F,
+    0x6C, 0x8D, 0xA0, 0xC7, 0x26, 0xA1, 0x61, 0xA7, 0x96, 0x95, 0xC2, 0xA6, 0x97, 0x9D, 0x70, 0x3E,
+    0x29, 0x66, 0x66, 0xF2, 0xB8, 0xA5, 0x8B, 0x02, 0xE7, 0xCD, 0x04, 0x2B, 0xD5, 0x40, 0x39, 0xD1,
+    0x37, 0xB4, 0x3E, 0xD7, 0xFE, 0x93, 0xEB, 0xD6, 0xB6, 0x55, 0x6B, 0xA3, 0xFE, 0x66, 0x48, 0xA8,
+    0xE2, 0xA4, 0x7A, 0xB5, 0x2F, 0x42, 0x1E, 0x69, 0x9B, 0x7A, 0x28, 0xE6, 0xFB, 0x64, 0xC9, 0xFA,
+    0x0E, 0x6A, 0x79, 0xCC, 0xDA, 0x77, 0xD4, 0xDE, 0x41, 0x24, 0x52, 0x0E, 0x26, 0xE0, 0xA8, 0x3B,
+    0xD6, 0x22, 0x62, 0x36, 0xE6, 0x15, 0xAC, 0x46, 0x28, 0x37, 0x1E, 0xF7, 0xC3, 0xC0, 0xC5, 0xCD,
+    0xA9, 0x55, 0x47, 0x5D, 0x24, 0xDB, 0x98, 0x6A, 0xD2, 0x7C, 0x7E, 0xF7, 0x6A, 0x93, 0x07, 0x33,
+    0x12, 0x99, 0xD9, 0xE3, 0x0E, 0x75, 0xE3, 0xB0, 0x7F, 0xD7, 0x77, 0x45, 0xE2, 0xDB, 0x3B, 0xA4,
+    0x40, 0x3B, 0x2C, 0xD4, 0xA3, 0xEB, 0xEC, 0x64, 0xC7, 0x22, 0x96, 0x31, 0x97, 0x11, 0xEA, 0xE4,
+    0x1F, 0xDD, 0x7F, 0xEA, 0x06, 0x70, 0x8B, 0x2C, 0x60, 0x46, 0xAC, 0xE7, 0x0C, 0xB8, 0x9E, 0x56,
+    0x48, 0xA8, 0xC9, 0x22, 0xF9, 0x8C, 0x09, 0x94, 0x01, 0x1B, 0xA8, 0xC6, 0x2D, 0x37, 0xDE, 0xCD,
+    0x72, 0x97, 0x98, 0xB2, 0x7A, 0xBC, 0x8F, 0x9E, 0x5A, 0xEE, 0xB3, 0xB2, 0x9F, 0xAF, 0xB8, 0x29,
+    0xF2, 0xB4, 0x9E, 0x7A, 0xC4, 0x06, 0xCA, 0x99, 0x22, 0x9E, 0x18, 0xD3, 0xBC, 0x13, 0x32, 0x45,
+    0x24, 0xDC, 0xB0, 0xCB, 0xA2, 0xC3, 0x89, 0xAC, 0xD9, 0x8D, 0x5B, 0x82, 0x17, 0xF3, 0x40, 0x16,
+    0x0F, 0x21, 0xD7, 0x70, 0xD2, 0x5F, 0x9F, 0xCE, 0x05, 0x35, 0x6C, 0x64, 0xE9, 0xBD, 0xCF, 0x0C,
+    0x94, 0xDE, 0x76, 0x38, 0x2E, 0x91, 0xCD, 0xF9, 0x44, 0x39, 0x58, 0x8F, 0xFB, 0xF4, 0x56, 0x3D,
+    0x2F, 0xB5, 0x26, 0x72, 0x36, 0xD3, 0xC7, 0x27, 0xCA, 0xD9, 0x8E, 0xB8, 0xC1, 0x75, 0x99, 0x72,
+    0x51, 0x46, 0x1B, 0x71, 0xA3, 0x0B, 0x1C, 0x3C, 0x7E, 0xD0, 0xA5, 0xA1, 0x97, 0x96, 0x4C, 0xA9,
+    0x32, 0x63, 0x8E, 0x87, 0xB5, 0x6F, 0x7A, 0x5A, 0x61, 0x14, 0xB1, 0x13, 0xB4, 0x89, 0xE9, 0xB1,
+    0x1E, 0xFA, 0x94, 0x47, 0x56, 0x23, 0xA8, 0xDB, 0x6A, 0xB0, 0x5B, 0x16, 0x38, 0x6D, 0xA5, 0x94,
+    0xD2, 0xEF, 0x30, 0xD2, 0x91, 0xFD, 0xDD, 0x03, 0x69, 0xC0, 0x69, 0xC6, 0x2E, 0x19, 0xD9, 0xBA,
+    0x01, 0xC4, 0x3C, 0x02, 0xF5, 0xDA, 0x90, 0x49, 0x5D, 0x72, 0x80, 0x67, 0x15, 0x37, 0x76, 0xDE,
+    0x44, 0x5E, 0xA3, 0xF5, 0xEE, 0xED, 0x7E, 0xB6, 0xD2, 0x9A, 0x4B, 0xEA, 0xB2, 0xE4, 0xAC, 0xB2,
+    0x06, 0xAE, 0x41, 0x6A, 0x9B, 0xE6, 0x76, 0x8A, 0x41, 0xEA, 0x8C, 0x22, 0xD7, 0x69, 0x0A, 0x0F,
+    0x6E, 0x9F, 0x4C, 0x23, 0x59, 0xDF, 0x91, 0x47, 0xF3, 0xDD, 0xDE, 0x4B, 0x93, 0xD3, 0xC2, 0xD5,
+    0x7B, 0x27, 0x93, 0xDB, 0x8D, 0x5F, 0x64, 0x2B, 0x05, 0xB8, 0xEC, 0x5D, 0xFC, 0x22, 0xE7, 0xB4,
+    0x9F, 0x84, 0x37, 0x52, 0x87, 0x5D, 0xB2, 0x2D, 0x1D, 0xAF, 0xFD, 0xD1, 0xAF, 0xB5, 0x81, 0x4A,
+    0xF3, 0xE6, 0xC1, 0xB9, 0xAA, 0x5D, 0x7D, 0x01, 0xE7, 0x79, 0x8D, 0xD6, 0x1B, 0x7D, 0x59, 0x9D,
+    0x95, 0x56, 0x6A, 0x69, 0x66, 0x53, 0xE2, 0xD6, 0x56, 0x82, 0xA9, 0xE7, 0xD4, 0x1C, 0x53, 0x75,
+    0x77, 0x4E, 0xB8, 0xC4, 0x75, 0xAB, 0x81, 0x37, 0x1F, 0x4A, 0x45, 0x8B, 0xB5, 0xD9, 0xCE, 0x4C,
+    0x5C, 0x1D, 0x21, 0x8F, 0xD8, 0xFF, 0x2E, 0xAC, 0xD4, 0x58, 0xA9, 0x39, 0xD6, 0x8A, 0x73, 0xDA,
+    0xC7, 0x6A, 0x49, 0xD2, 0x6A, 0xF8, 0x10, 0xD5, 0xB8, 0x9B, 0x66, 0x0F, 0xB9, 0x5E, 0xDB, 0x44,
+    0xDD, 0x08, 0xF9, 0x2D, 0xFF, 0xC6, 0xF9, 0x0F, 0x36, 0x45, 0x34, 0xFA, 0xB2, 0x3A, 0x49, 0x63,
+    0x2D, 0xCD, 0x5C, 0xD5, 0x6B, 0x49, 0x48, 0x1B, 0x20, 0x7B, 0x72, 0x43, 0x59, 0xE6, 0x68, 0x8A,
+    0xDA, 0x19, 0x27, 0x5F, 0x0C, 0x1F, 0xE0, 0x1A, 0x98, 0x7B, 0x49, 0xBC, 0x73, 0x33, 0xD4, 0xFE,
+    0xFC, 0x67, 0x62, 0x29, 0x7D, 0x5C, 0x1A, 0x4A, 0xED, 0x73, 0x21, 0xA1, 0xE3, 0x37, 0xA1, 0x0E,
+    0x27, 0x3E, 0x6F, 0xBB, 0xF3, 0x90, 0xCD, 0x7B, 0xA4, 0x76, 0xB0, 0x6D, 0xF3, 0x5C, 0x3F, 0x6E,
+    0xB3, 0x3B, 0xBD, 0x06, 0x4E, 0xD3, 0xAE, 0x2F, 0x70, 0xFA, 0xC0, 0xB6, 0x08, 0xE5, 0xD1, 0x22,
+    0xD2, 0xDF, 0x63, 0x53, 0x2D, 0x71, 0x1A, 0x67, 0x75, 0xB4, 0xB6, 0x38, 0xCF, 0xEF, 0x50, 0x05,
+    0xDC, 0xDB, 0xFD, 0x9C, 0x3C, 0x68, 0x9D, 0x8A, 0x42, 0xC7, 0x0E, 0x74, 0x2F, 0x9F, 0xC8, 0x96,
+    0x08, 0xE5, 0x03, 0x2B, 0x63, 0x85, 0x3A, 0x8C, 0x22, 0x5C, 0xA7, 0x49, 0xEB, 0xE1, 0xF6, 0x53,
+    0x33, 0x68, 0xF2, 0xAE, 0x79, 0xC4, 0x7C, 0xB7, 0xF7, 0x1B, 0xE7, 0xBF, 0x70, 0xBC, 0x22, 0x8F,
+    0x1E, 0x1C, 0x1C, 0x3C, 0x21, 0xE9, 0xEB, 0x92, 0x7E, 0x20, 0x69, 0xC6, 0x8E, 0x09, 0x30, 0xE5,
+    0x71, 0xE3, 0x77, 0x5C, 0x07, 0xD5, 0x46, 0xAE, 0x9B, 0x98, 0x5A, 0xE8, 0xE9, 0x9B, 0xC4, 0x7D,
+    0x54, 0x21, 0x61, 0x5A, 0xB3, 0x6C, 0xE7, 0x76, 0xCE, 0x6F, 0xC9, 0xDF, 0x99, 0x6B, 0xDB, 0x8B,
+    0x47, 0x3E, 0xE7, 0x3F, 0x9E, 0xC8, 0xD6, 0x7A, 0xF9, 0x56, 0xE1, 0x91, 0xF5, 0x79, 0xDA, 0xFB,
+    0x12, 0xB8, 0x3B, 0xE0, 0x56, 0xAC, 0x3A, 0xA3, 0x31, 0x1F, 0x60, 0x85, 0xCF, 0x79, 0xDC, 0x98,
+    0x6A, 0xD8, 0xB6, 0x3B, 0x9F, 0xE0, 0x63, 0xBD, 0x6E, 0x5F, 0x7F, 0xFD, 0x34, 0x78, 0xFC, 0xB9,
+    0xEA, 0x03, 0xFC, 0xE6, 0xE6, 0x35, 0x52, 0x0E, 0x7C, 0x2E, 0x9B, 0xD9, 0x33, 0xD3, 0x2E, 0x23,
+    0xAE, 0x15, 0x68, 0x15, 0xF8, 0xDC, 0xDB, 0x37, 0x1E, 0x98, 0x11, 0xD7, 0x0D, 0xB8, 0xF5, 0xF8,
+    0xE7, 0x27, 0x0B, 0xF7, 0x70, 0xFF, 0x77, 0x27, 0x4E, 0x3B, 0xFD, 0x24, 0xE1, 0xDE, 0x6B, 0x4E,
+    0x1D, 0x56, 0xFA, 0x84, 0xF4, 0xB5, 0xCF, 0xFC, 0xE8, 0xF2, 0xFD, 0x73, 0x0A, 0x30, 0xFF, 0x3E,
+    0xA0, 0x3F, 0x02, 0xAE, 0x0B, 0x38, 0x5F, 0x37, 0xEF, 0x83, 0x83, 0xED, 0x4C, 0xEF, 0xCD, 0x82,
+    0x1B, 0x33, 0x61, 0x27, 0x7A, 0x5F, 0x44, 0xEA, 0x21, 0x5F, 0xB1, 0x21, 0xC1, 0x20, 0xE7, 0xB3,
+    0x95, 0x2A, 0xD0, 0x37, 0xE5, 0x84, 0xF3, 0x26, 0x1E, 0xD3, 0xA0, 0x5D, 0xBE, 0xD2, 0x1E, 0xF7,
+    0xCC, 0x4D, 0x58, 0x29, 0xA6, 0xDE, 0x02, 0xEA, 0x63, 0x22, 0x25, 0x0F, 0x37, 0xA8, 0x5E, 0xF5,
+    0xBC, 0xF5, 0xBF, 0x31, 0x2F, 0x4D, 0xD8, 0x93, 0x61, 0x9C, 0x62, 0x28, 0xC6, 0x9A, 0xBA, 0xB9,
+    0x4D, 0x34, 0xA1, 0x08, 0xB6, 0xAB, 0xBB, 0xEB, 0xAC, 0xF9, 0x54, 0x4C, 0xA5, 0x77, 0xDE, 0xBD,
+    0x2E, 0xA4, 0x39, 0x97, 0x86, 0x5C, 0xFD, 0x91, 0x4F, 0xFF, 0x72, 0xE2, 0xCF, 0x46, 0x90, 0x9E,
+    0xFB, 0xFF, 0xAC, 0xDD, 0x99, 0x83, 0x48, 0x7D, 0xE2, 0x6C, 0xD3, 0x7D, 0xBA, 0x95, 0xBE, 0x1C,
+    0x4A, 0x6F, 0xBD, 0xF5, 0x95, 0xB7, 0x5D, 0xDD, 0x55, 0x8D, 0xEB, 0xEA, 0xA6, 0x6D, 0x6A, 0x84,
+    0x7B, 0x7D, 0x07, 0xEE, 0x16, 0xCA, 0xF5, 0xE8, 0xE3, 0xD9, 0x54, 0x79, 0x68, 0x35, 0x6E, 0x70,
+    0xE8, 0xBE, 0x23, 0x2A, 0xBF, 0x58, 0xF5, 0x7E, 0x02, 0x76, 0xFD, 0x19, 0x54, 0xAC, 0x21, 0xF5,
+    0x13, 0x62, 0x2F, 0x1C, 0xD1, 0x2B, 0x87, 0xEF, 0x97, 0xAC, 0x99, 0x95, 0x3A, 0xA0, 0xC6, 0xCE,
+    0xB4, 0xDE, 0x2C, 0xD4, 0x21, 0x13, 0xE5, 0x44, 0xDF, 0x99, 0x88, 0x1B, 0x10, 0x36, 0xD0, 0x76,
+    0x49, 0xF9, 0x05, 0x1B, 0x10, 0x66, 0xC6, 0xF9, 0x6C, 0xA1, 0x1A, 0xE9, 0xBB, 0x2A, 0x50, 0x6F,
+    0x7D, 0x49, 0x4B, 0x6A, 0x63, 0xA5, 0x95, 0x48, 0x80, 0x65, 0x77, 0xFD, 0x6A, 0xAA, 0x12, 0xBD,
+    0xD1, 0x50, 0x85, 0x13, 0x8E, 0x6D, 0x47, 0x3D, 0xB0, 0x57, 0xFA, 0x72, 0xB8, 0x4D, 0xB4, 0xBE,
+    0xF2, 0x73, 0x3E, 0x57, 0x8D, 0x7B, 0x66, 0x2A, 0xA6, 0x1A, 0x99, 0xB5, 0x0D, 0x4E, 0x6B, 0x2E,
+    0x0D, 0x49, 0xC5, 0x87, 0xBA, 0xEC, 0x39, 0x38, 0xA4, 0xF6, 0x29, 0x43, 0x42, 0xC7, 0x90, 0xF1,
+    0xDD, 0x2D, 0x63, 0x63, 0x2E, 0x92, 0x72, 0x45, 0xC4, 0x0D, 0x49, 0x3B, 0xFA, 0xA6, 0x9C, 0x49,
+    0xEA, 0xD9, 0x90, 0x70, 0x5B, 0x11, 0xC9, 0x17, 0xEA, 0xDD, 0x0B, 0xAE, 0x33, 0x91, 0xA4, 0x61,
+    0x39, 0x67, 0x22, 0xA9, 0x88, 0x36, 0xBC, 0x90, 0x0E, 0x50, 0x86, 0xFB, 0x94, 0x7C, 0xA8, 0xCB,
+    0x6F, 0x64, 0x0B, 0xAE, 0xAB, 0x46, 0x13, 0xB3, 0x35, 0x51, 0x8D, 0x27, 0xE1, 0xD2, 0x94, 0xCD,
+    0x94, 0xBE, 0x1C, 0xA8, 0x71, 0x10, 0xB3, 0x88, 0x19, 0xCB, 0x91, 0xAA, 0x71, 0x1D, 0x77, 0xB2,
+    0x85, 0x3C, 0xD8, 0x80, 0xBD, 0x27, 0x9F, 0xDA, 0xB1, 0x7A, 0x4D, 0x90, 0xCE, 0x87, 0xB8, 0x31,
+    0x17, 0x76, 0x42, 0x5D, 0x11, 0x71, 0x43, 0xAE, 0xCD, 0xF0, 0xE6, 0xAD, 0x99, 0x2C, 0x20, 0x8A,
+    0x99, 0xD6, 0x27, 0x25, 0x84, 0x0D, 0x49, 0x87, 0x6A, 0xC8, 0xD6, 0xA4, 0xC2, 0x51, 0x73, 0xF1,
+    0x90, 0x1A, 0xFC, 0x92, 0x02, 0xBD, 0xC6, 0x1D, 0x89, 0x5F, 0xFA, 0x23, 0x8B, 0x69, 0x77, 0x58,
+    0xAC, 0x18, 0x8A, 0xF1, 0x36, 0x77, 0xAC, 0xB7, 0x3E, 0x66, 0xD1, 0x76, 0xF5, 0xD3, 0x93, 0x99,
+    0x6B, 0xDA, 0x8F, 0x4F, 0x36, 0x38, 0x6D, 0x5D, 0xF8, 0x0B, 0xBD, 0x3C, 0x65, 0x22, 0x1B, 0x2F,
+    0x35, 0x98, 0x65, 0xD7, 0x38, 0x7F, 0xF2, 0x3C, 0xC8, 0xAE, 0xB1, 0x2F, 0x4B, 0x9E, 0x74, 0x69,
+    0x77, 0x20, 0xF9, 0xD4, 0xF5, 0xE8, 0x3E, 0x70, 0x60, 0x27, 0xA0, 0x7F, 0x76, 0x01, 0x9C, 0x57,
+    0x03, 0xF5, 0x98, 0x8A, 0xD4, 0x76, 0x32, 0xA1, 0x9C, 0xCD, 0x62, 0xA2, 0x89, 0x28, 0xD7, 0xEF,
+    0xAE, 0xB8, 0xAF, 0x69, 0x14, 0xF6, 0xFB, 0x8A, 0x7D, 0x57, 0x44, 0xC9, 0xF9, 0x4C, 0x4A, 0xBD,
+    0x7D, 0x7F, 0xA3, 0x40, 0xA5, 0x57, 0x35, 0x51, 0x2A, 0xF4, 0x91, 0x5C, 0xA1, 0x5E, 0xA0, 0x9F,
+    0x4B, 0x41, 0x1D, 0xB3, 0xE3, 0xD3, 0x3F, 0xD7, 0x36, 0x34, 0x94, 0x6B, 0x80, 0xF6, 0x6A, 0x87,
+    0xED, 0xDC, 0x7D, 0xFB, 0x24, 0x40, 0x74, 0x50, 0x7F, 0x21, 0x7C, 0xD8, 0x84, 0xB6, 0x18, 0xD7,
+    0x22, 0xA8, 0xF2, 0xAD, 0x7B, 0x6B, 0x2E, 0x24, 0xD1, 0x4A, 0x63, 0x21, 0x45, 0xDA, 0x77, 0xD4,
+    0x14, 0xAB, 0x0B, 0xB4, 0x77, 0x17, 0xF2, 0x1B, 0x8F, 0x6C, 0x5B, 0xBA, 0x6A, 0x52, 0xF1, 0xBF,
+    0x9D, 0x60, 0x39, 0xE4, 0x64, 0xC9, 0xF9, 0xE7, 0x7E, 0x0E, 0x86, 0x9D, 0x2B, 0xB0, 0x01, 0xAC,
+    0xA0, 0x7C, 0x7D, 0xA2, 0x18, 0xAB, 0x77, 0x77, 0x68, 0x59, 0x6F, 0x26, 0x33, 0x65, 0x33, 0x3D,
+    0x91, 0xCA, 0x1F, 0x62, 0x26, 0x07, 0x6B, 0xDD, 0xE0, 0x5E, 0xF1, 0x94, 0x1A, 0x52, 0x61, 0xC5,
+    0x85, 0x44, 0x98, 0xE5, 0x71, 0x57, 0xDF, 0x49, 0x7D, 0xF2, 0x95, 0x3A, 0x4A, 0x75, 0x9B, 0xD5,
+    0xD8, 0x21, 0x52, 0xBD, 0x1C, 0x71, 0x77, 0x23, 0xEE, 0xA5, 0x99, 0xA7, 0xFE, 0xEB, 0x73, 0xFF,
+    0xA2, 0xC7, 0x7D, 0xD2, 0xF1, 0xBE, 0x8D, 0x4E, 0xBD, 0x78, 0x7C, 0x66, 0xE2, 0xF2, 0x31, 0xB8,
+    0xDB, 0xDA, 0xA4, 0x22, 0x66, 0x97, 0x64, 0x07, 0xC0, 0x45, 0xD2, 0xBC, 0xA4, 0xF3, 0x0C, 0xB9,
+    0x02, 0xD0, 0x47, 0x12, 0xD6, 0xC0, 0xAA, 0x23, 0x1D, 0x01, 0xC8, 0x35, 0x03, 0xBD, 0x0E, 0x6E,
+    0xA4, 0xD2, 0xBC, 0xD1, 0xE6, 0xD1, 0x45, 0xB1, 0x3B, 0x72, 0x75, 0x39, 0x49, 0x60, 0x36, 0x04,
+    0x53, 0xDF, 0xC7, 0x80, 0x28, 0x45, 0xB0, 0x47, 0x6E, 0xCE, 0x69, 0xFD, 0xD5, 0x50, 0xC4, 0xA3,
+    0x5A, 0x74, 0xB1, 0xA4, 0x3A, 0x55, 0x9D, 0xBA, 0x52, 0x9B, 0xED, 0x4C, 0xE2, 0xA9, 0xC2, 0x5F,
+    0x04, 0x78, 0xAA, 0xFB, 0x45, 0xEA, 0xF4, 0xFC, 0x89, 0x1A, 0xC3, 0x7C, 0x4C, 0x9C, 0xFF, 0xAC,
+    0x3A, 0x3D, 0xD4, 0x3C, 0x02, 0x1C, 0x96, 0x03, 0x18, 0x85, 0xA3, 0xD2, 0xE9, 0x1E, 0x40, 0x7E,
+    0xDA, 0x28, 0x7F, 0x01, 0xEA, 0x65, 0x53, 0x31, 0x92, 0xDF, 0x5B, 0xB6, 0xB2, 0x82, 0x99, 0xB9,
+    0xDF, 0x5D, 0x1D, 0x33, 0x73, 0xA9, 0xD5, 0xD3, 0x73, 0xF6, 0xCB, 0xEB, 0xD6, 0xBC, 0x93, 0x8E,
+    0x01, 0xF8, 0x8D, 0x8F, 0x56, 0x03, 0xD5, 0x44, 0x6A, 0x13, 0x2B, 0xB7, 0xCE, 0xBC, 0x06, 0x8A,
+    0x7B, 0x54, 0x2B, 0x6E, 0xA1, 0x6D, 0x58, 0x21, 0x92, 0xCD, 0xE4, 0xBB, 0xD3, 0xE2, 0x65, 0xC0,
+    0x8E, 0xD8, 0x81, 0xCA, 0xE3, 0x3C, 0xAE, 0xA3, 0x6D, 0xD2, 0x91, 0x95, 0x29, 0x7B, 0xE1, 0xF8,
+    0x78, 0x76, 0x20, 0x8B, 0x18, 0x35, 0xF6, 0x8D, 0xB1, 0x7E, 0x3C, 0x02, 0x9C, 0xFD, 0xF8, 0xB7,
+    0x5F, 0x5D, 0xFE, 0xE7, 0x0F, 0xE3, 0xE7, 0x3F, 0x0B, 0x70, 0xB6, 0x5F, 0x2A, 0xAD, 0x6E, 0x7D,
+    0x01, 0x1E, 0xBE, 0xEC, 0xA4, 0x57, 0x25, 0xFD, 0x97, 0x5D, 0xA7, 0xD7, 0x77, 0xA4, 0x4F, 0x68,
+    0x2E, 0xD6, 0x06, 0xB0, 0xDF, 0x58, 0xDC, 0xDD, 0xF8, 0x54, 0x67, 0xBF, 0xF0, 0x9D, 0xF9, 0x8E,
+    0x7B, 0xE2, 0x5B, 0x3F, 0x8E, 0x1F, 0xB6, 0xFE, 0x8F, 0x6F, 0xFD, 0x36, 0x94, 0xCF, 0xAE, 0x97,
+    0x5E, 0x8D, 0x75, 0x93, 0x45, 0xDC, 0xE3, 0x0B, 0xEE, 0xE9, 0x05, 0xF7, 0xF4, 0xC6, 0x31, 0xB9,
+    0x6C, 0xB6, 0xAF, 0x0C, 0x85, 0x9A, 0x3C, 0x42, 0xC0, 0x35, 0xE5, 0xC8, 0x8A, 0xF3, 0xC5, 0x8C,
+    0x78, 0x64, 0x3F, 0x7F, 0x1E, 0x8C, 0x52, 0xFB, 0x4A, 0xB1, 0x21, 0x85, 0x72, 0x46, 0xDE, 0x4E,
+    0x99, 0x70, 0x43, 0x31, 0x23, 0xEA, 0x11, 0x68, 0xC7, 0x32, 0x22, 0xEA, 0xD1, 0x44, 0x7A, 0x6F,
+    0x27, 0xC8, 0xBB, 0x6B, 0xFD, 0x17, 0xA7, 0x2A, 0x1B, 0xFF, 0xA0, 0xF4, 0xED, 0xDD, 0xE5, 0x7C,
+    0x36, 0xB6, 0x2F, 0x7C, 0x52, 0xF1, 0xA9, 0x9B, 0x9E, 0x48, 0xD5, 0x65, 0x13, 0xD9, 0x78, 0xEB,
+    0x62, 0xEF, 0xCE, 0x42, 0xF6, 0xED, 0x69, 0xAA, 0x4D, 0xC7, 0x2F, 0x65, 0x41, 0x76, 0x39, 0x37,
+    0xF0, 0xF9, 0x62, 0xAD, 0xC3, 0xDB, 0x65, 0xC3, 0x99, 0xFC, 0x93, 0xF3, 0x1F, 0x7F, 0x18, 0xE0,
+    0xA1, 0x3E, 0xD6, 0x8A, 0xED, 0xFA, 0xFC, 0xD9, 0xFD, 0xB5, 0xFA, 0xE6, 0xE2, 0x7C, 0xF9, 0x62,
+    0x70, 0xF6, 0xC5, 0xD8, 0xDB, 0x1F, 0xC6, 0x9D, 0x86, 0xA9, 0x13, 0x4B, 0x4D, 0x15, 0xCC, 0x42,
+    0xDF, 0xD9, 0x60, 0x56, 0x4E, 0x9D, 0x37, 0x87, 0xD2, 0x2F, 0xD6, 0xB7, 0xA3, 0xBA, 0x3B, 0x60,
+    0x42, 0xE5, 0x0F, 0xCD, 0x54, 0xF9, 0xDE, 0x4C, 0xD4, 0xFA, 0xA6, 0xA2, 0xBB, 0xF9, 0xF5, 0x6F,
+    0xCF, 0x77, 0xEA, 0xC6, 0x51, 0x3D, 0xBD, 0x54, 0x43, 0xA9, 0x89, 0x3A, 0x75, 0x53, 0x94, 0x1E,
+    0xFE, 0x0A, 0x5C, 0x83, 0x9B, 0xA8, 0xD5, 0x55, 0x2F, 0x47, 0xEB, 0xED, 0x50, 0xBE, 0xF8, 0xCD,
+    0xF5, 0xE2, 0xDE, 0x3B, 0x2F, 0x7D, 0x71, 0xBE, 0x75, 0x69, 0x67, 0x4D, 0x77, 0xA5, 0x33, 0x97,
+    0x39, 0xFB, 0xE5, 0xA9, 0xD7, 0xEB, 0xC9, 0x4E, 0xC6, 0xE0, 0xEE, 0xBE, 0xF8, 0xCE, 0x6A, 0x9F,
+    0x08, 0x17, 0xAB, 0x06, 0x78, 0xF8, 0xCA, 0x15, 0xA7, 0xD5, 0x69, 0xE1, 0xD7, 0x8B, 0xF1, 0x9A,
+    0xFD, 0xE4, 0x37, 0xC2, 0x87, 0x3E, 0xFB, 0xD0, 0x33, 0xB3, 0xFB, 0x44, 0x38, 0xB4, 0x8A, 0x4E,
+    0xA1, 0xD7, 0x00, 0x54, 0x7A, 0x59, 0xF1, 0xD2, 0x93, 0x77, 0x87, 0xF9, 0xFA, 0x93, 0x9F, 0x54,
+    0x90, 0xC8, 0xDF, 0x6C, 0x14, 0x3F, 0xFA, 0xBF, 0x5E, 0xFC, 0x9B, 0x8F, 0x7D, 0xEC, 0x75, 0xE0,
+    0x97, 0x7E, 0xA3, 0xEA, 0x2E, 0x98, 0xF0, 0xB1, 0xF1, 0x94, 0xD1, 0x98, 0xA7, 0xA7, 0x3D, 0xF7,
+    0x4B, 0xFC, 0x3F, 0xB5, 0x9B, 0x4F, 0xCC, 0x1E, 0xD7, 0x75, 0xDE, 0x7F, 0x33, 0x57, 0xE4, 0xB4,
+    0x9A, 0x5A, 0xD7, 0x0B, 0xD1, 0x71, 0xA5, 0x44, 0xE3, 0x45, 0x0A, 0xB8, 0x8C, 0xE4, 0xC9, 0x22,
+    0x40, 0x8C, 0x9A, 0xFC, 0xEE, 0x48, 0x04, 0xEA, 0x85, 0xD0, 0x8A, 0x2D, 0xC4, 0x06, 0xB0, 0x51,
+    0x28, 0x8B, 0x14, 0xB0, 0x8D, 0x22, 0xCC, 0x42, 0x40, 0xB5, 0x20, 0x39, 0x63, 0x09, 0xA8, 0x17,
+    0x06, 0x2A, 0xA2, 0xA8, 0xD3, 0x02, 0x59, 0x98, 0x40, 0xB5, 0x50, 0xE8, 0x16, 0x74, 0x0B, 0x2D,
+    0x04, 0x94, 0xE4, 0x5C, 0x92, 0x40, 0x88, 0xC2, 0x28, 0x34, 0xB2, 0x60, 0xBB, 0xA8, 0xD1, 0x68,
+    0x6C, 0xC9, 0x71, 0x6C, 0x01, 0xD1, 0x95, 0x3C, 0x8E, 0x86, 0xE2, 0x9D, 0x79, 0xBA, 0xB8, 0xF3,
+    0x7E, 0x24, 0x65, 0xC9, 0x76, 0x5A, 0xF7, 0x05, 0xBE, 0xEF, 0xFD, 0xFF, 0xCE, 0xFD, 0x73, 0xEE,
+    0x39, 0xCF, 0x79, 0xCE, 0x73, 0xA0, 0x02, 0xDB, 0x60, 0x3B, 0x4A, 0x4F, 0x76, 0x9C, 0xF7, 0xB9,
+    0xD5, 0x8F, 0x0E, 0xF6, 0x5A, 0x28, 0xDE, 0x8A, 0x26, 0x0A, 0xAB, 0xE0, 0xF4, 0xC5, 0x75, 0xB1,
+    0x57, 0x83, 0xB3, 0x9E, 0x2F, 0xF4, 0xDE, 0x29, 0x96, 0x52, 0xB7, 0x7D, 0xB8, 0xD7, 0x58, 0x69,
+    0x35, 0x3F, 0x3E, 0x7F, 0x1C, 0xA8, 0x8B, 0x21, 0xBA, 0x62, 0x9C, 0xEB, 0x4F, 0x0F, 0xD1, 0x15,
+    0x21, 0x52, 0xAD, 0xA5, 0xAE, 0x29, 0xE4, 0x33, 0x0B, 0x87, 0xB7, 0x6F, 0x1C, 0x00, 0xFE, 0x88,
+    0xEC, 0xE6, 0x1F, 0x52, 0xC5, 0x19, 0x69, 0x28, 0xDE, 0x14, 0xD5, 0x0F, 0x47, 0x2A, 0xE0, 0x77,
+    0xC0, 0x78, 0x78, 0x10, 0xB2, 0x01, 0x2C, 0xF0, 0x75, 0x28, 0x1A, 0xF8, 0x70, 0xFA, 0xB2, 0x6D,
+    0x80, 0x72, 0x00, 0x4C, 0x00, 0xB2, 0xF8, 0xB3, 0xC3, 0x3F, 0xD4, 0x64, 0x8F, 0xA3, 0x15, 0x7D,
+    0x51, 0x0A, 0xAD, 0xD7, 0x35, 0x69, 0xD4, 0xD0, 0x6A, 0xAC, 0x43, 0xAE, 0xB3, 0xA5, 0xDF, 0xFF,
+    0xEE, 0xF3, 0xBB, 0x6F, 0xE4, 0x6B, 0xDE, 0xB9, 0xA5, 0x7A, 0x7A, 0x5E, 0xA2, 0x7D, 0x59, 0xE3,
+    0x81, 0x6C, 0x05, 0xC8, 0x94, 0x9F, 0xAB, 0x64, 0x7D, 0x3C, 0x7D, 0xB9, 0x08, 0x0A, 0x70, 0x79,
+    0xF7, 0xF9, 0xC7, 0x29, 0x06, 0xFE, 0x16, 0x7F, 0xE3, 0x5B, 0xE6, 0xA9, 0xE1, 0xC3, 0xF7, 0xDA,
+    0xC6, 0x7F, 0xF8, 0x5E, 0xE0, 0x63, 0x01, 0x8A, 0x2B, 0x33, 0x07, 0x97, 0x4C, 0x52, 0xC7, 0x49,
+    0x9D, 0x85, 0xFB, 0xD6, 0xB3, 0x94, 0xD2, 0xCC, 0xC2, 0xC1, 0xA5, 0xEC, 0xE0, 0xF4, 0x47, 0x81,
+    0x8F, 0xBD, 0xE7, 0xA7, 0x86, 0xEC, 0xC4, 0x89, 0x13, 0xBF, 0x37, 0x59, 0x49, 0x8A, 0x4E, 0x4A,
+    0x1B, 0x62, 0x46, 0x80, 0xBB, 0x00, 0x8A, 0x00, 0xD4, 0x1E, 0xD0, 0x1D, 0x73, 0xBD, 0xED, 0x56,
+    0x49, 0x8D, 0x91, 0x02, 0x4E, 0x3F, 0x4A, 0x9F, 0xBF, 0x0C, 0xD8, 0x61, 0x5B, 0xD6, 0x5A, 0x13,
+    0x46, 0x82, 0x56, 0x23, 0x65, 0xD8, 0x7E, 0xC9, 0xFE, 0xF4, 0x44, 0x93, 0x49, 0x33, 0x4E, 0xEA,
+    0x8C, 0x34, 0xD3, 0x4A, 0xCD, 0xB6, 0x8E, 0x92, 0xC6, 0x5A, 0xD2, 0x17, 0xB5, 0x9E, 0xFF, 0x53,
+    0xDC, 0x6E, 0x83, 0xCA, 0x11, 0x70, 0x0D, 0x64, 0x5A, 0x1B, 0x4A, 0xA9, 0xC1, 0xAD, 0x02, 0xB1,
+    0x50, 0x04, 0x33, 0x51, 0x77, 0xD6, 0xB3, 0xE0, 0x30, 0xC1, 0xCC, 0xD4, 0x57, 0xE4, 0x59, 0xCB,
+    0x05, 0x33, 0xD7, 0xDD, 0xFE, 0x68, 0xEF, 0x22, 0xD9, 0x83, 0xED, 0xA0, 0xF4, 0x50, 0x0C, 0x3F,
+    0x3B, 0x9B, 0x52, 0x1A, 0x8C, 0x14, 0xB2, 0x08, 0xF4, 0x80, 0xEB, 0xD2, 0x84, 0x8A, 0x00, 0x26,
+    0x6E, 0x53, 0x68, 0x3B, 0xA8, 0x07, 0xB0, 0xDB, 0x8B, 0xD9, 0x0A, 0xA8, 0x81, 0x43, 0x69, 0x1E,
+    0x27, 0x5F, 0x07, 0xA7, 0x40, 0xB5, 0xF6, 0xDE, 0xCC, 0x2C, 0xAC, 0x94, 0x63, 0xED, 0x39, 0x6C,
+    0x6E, 0x9C, 0x38, 0x4E, 0xAB, 0x15, 0x2B, 0x0D, 0x2C, 0xBB, 0xC5, 0x52, 0x73, 0x72, 0xAA, 0x24,
+    0x21, 0x69, 0xB4, 0x69, 0x49, 0x56, 0xE8, 0xD7, 0xDD, 0xD0, 0xEE, 0xD7, 0x59, 0xAC, 0x16, 0x8C,
+    0xD4, 0xA1, 0xE1, 0xC3, 0x54, 0x23, 0xE4, 0x71, 0xDB, 0xA0, 0x5C, 0xAF, 0x43, 0xA5, 0x19, 0x5A,
+    0x05, 0x38, 0x29, 0x0F, 0x55, 0x04, 0x9C, 0xBF, 0xA7, 0x29, 0xA2, 0xD1, 0xD7, 0xD4, 0x6D, 0x0B,
+    0x3B, 0x73, 0xBF, 0x5E, 0x87, 0xBA, 0x33, 0x11, 0xD7, 0x99, 0x89, 0x96, 0x72, 0x64, 0xC1, 0xFA,
+    0x6C, 0xF7, 0x42, 0x53, 0x06, 0x44, 0x35, 0xE6, 0x2B, 0x6E, 0xC8, 0x23, 0xD4, 0xA5, 0x37, 0x21,
+    0xD2, 0xD7, 0xDE, 0xFE, 0x64, 0x7E, 0xEF, 0x49, 0xEF, 0x30, 0x11, 0x5C, 0x87, 0x99, 0xA0, 0x4D,
+    0x3B, 0xB5, 0x80, 0xF5, 0x64, 0xB7, 0xBD, 0xDE, 0x50, 0x06, 0x10, 0x54, 0x23, 0xF9, 0x0A, 0x6E,
+    0x48, 0xA3, 0x87, 0x72, 0x02, 0x9C, 0xDF, 0xD6, 0xB0, 0x0C, 0xBB, 0x67, 0xCB, 0xFE, 0xB3, 0x6E,
+    0x7B, 0x66, 0x77, 0xCF, 0xF2, 0x3B, 0x9F, 0xC5, 0xDD, 0xB3, 0xB6, 0xE1, 0xA3, 0x65, 0x04, 0x69,
+    0xA4, 0x90, 0xD2, 0x16, 0xA0, 0xF5, 0xD6, 0x68, 0xCF, 0x7F, 0xCD, 0x93, 0xDE, 0xC2, 0x29, 0x02,
+    0xD1, 0x8C, 0x60, 0x46, 0xDB, 0x40, 0xC5, 0x29, 0x20, 0xE6, 0x3F, 0x6D, 0x30, 0xA3, 0x55, 0xA0,
+    0xC2, 0x29, 0x10, 0xF3, 0x60, 0xBD, 0x19, 0xAD, 0x77, 0xD4, 0xEC, 0x11, 0x89, 0xD9, 0x54, 0x85,
+    0x62, 0x2C, 0xA5, 0x46, 0x8D, 0xD3, 0x5C, 0x44, 0xB4, 0xE2, 0xBA, 0xDB, 0x16, 0xE5, 0x28, 0x40,
+    0xDD, 0xD8, 0x06, 0xEB, 0x8D, 0xC7, 0x84, 0x2C, 0x90, 0xCD, 0x5C, 0x84, 0x4B, 0xEC, 0x81, 0x3B,
+    0xDF, 0x7B, 0xAC, 0xA4, 0xB1, 0x90, 0xA4, 0x3C, 0x30, 0x97, 0x63, 0xE4, 0x74, 0x36, 0xEF, 0x51,
+    0x73, 0xB9, 0x6E, 0xEC, 0x95, 0xDE, 0x7A, 0x23, 0x5D, 0x0B, 0x99, 0x74, 0x65, 0x46, 0x6A, 0x3E,
+    0x07, 0x80, 0x93, 0xF4, 0x98, 0xA4, 0xEB, 0x92, 0xDE, 0x96, 0x34, 0x63, 0x03, 0x14, 0xF3, 0xB6,
+    0x26, 0x02, 0xDC, 0xFF, 0x3A, 0x4B, 0x25, 0x91, 0x0C, 0xF9, 0xE1, 0x19, 0xB1, 0x47, 0xDF, 0x55,
+    0x8D, 0x1B, 0xCA, 0xC1, 0x06, 0x13, 0x8A, 0x98, 0xC5, 0x7C, 0x45, 0xA8, 0xA9, 0x3B, 0x20, 0x0B,
+    0x3B, 0xA7, 0x38, 0x93, 0xCE, 0x05, 0x87, 0xB6, 0x79, 0xB8, 0xA7, 0x57, 0xB2, 0x58, 0x05, 0xCA,
+    0x51, 0xE0, 0x1E, 0x0B, 0x64, 0x51, 0x0D, 0xF6, 0x8D, 0x09, 0x5C, 0xDF, 0x91, 0x6B, 0x06, 0x2B,
+    0x0F, 0x6D, 0x84, 0x5C, 0x23, 0x58, 0x0D, 0xD0, 0xCA, 0x63, 0x24, 0x8F, 0xFD, 0xA1, 0x3A, 0xFA,
+    0xC7, 0xD4, 0x99, 0x68, 0xD5, 0x54, 0xA1, 0x56, 0xB3, 0xB9, 0x94, 0xDA, 0x6F, 0x1B, 0xCD, 0x7D,
+    0xDB, 0xCA, 0xB5, 0x40, 0x3E, 0xD3, 0x76, 0x76, 0x30, 0x0B, 0x2D, 0x2E, 0xE4, 0xD1, 0xC8, 0xDB,
+    0xB1, 0x5E, 0x71, 0x0F, 0x6B, 0xCA, 0x62, 0x25, 0x5F, 0x8E, 0xAB, 0x70, 0x8F, 0xBD, 0x31, 0x67,
+    0xB1, 0x77, 0x43, 0x79, 0xF3, 0x2D, 0xE1, 0xF4, 0x68, 0x44, 0xB3, 0x1B, 0x0B, 0x5D, 0x51, 0x53,
+    0x47, 0x1B, 0xD1, 0xE0, 0x42, 0xB1, 0xE6, 0xFB, 0x11, 0xA6, 0x7A, 0x38, 0x92, 0x4B, 0x0D, 0x56,
+    0x23, 0xD4, 0xAF, 0xBF, 0x8F, 0x27, 0xBB, 0xFB, 0x2C, 0xCF, 0xD3, 0xE3, 0x9A, 0x22, 0x14, 0x01,
+    0xD7, 0x44, 0x4C, 0xAC, 0x3B, 0xEA, 0x6B, 0x81, 0x6C, 0xB9, 0xB4, 0xCD, 0x52, 0x13, 0x94, 0x2B,
+    0xD0, 0xFA, 0xB4, 0xEA, 0xF4, 0x40, 0x3D, 0x90, 0x5D, 0x88, 0xE0, 0x04, 0x46, 0x1E, 0xDA, 0x01,
+    0xE0, 0x3E, 0x0E, 0x9E, 0x35, 0x81, 0x85, 0x16, 0xEB, 0xCB, 0x31, 0x8B, 0x2C, 0xD4, 0x9D, 0xF5,
+    0x66, 0xCA, 0x22, 0x8E, 0xBA, 0x2B, 0x83, 0x99, 0x58, 0xD3, 0xDB, 0xE1, 0xF6, 0xB7, 0x25, 0x51,
+    0x4B, 0xC1, 0x48, 0x2B, 0x54, 0x1D, 0xE4, 0x01, 0x70, 0xFB, 0xEE, 0x19, 0x20, 0x7F, 0x0E, 0x8A,
+    0x29, 0xFD, 0x95, 0xD3, 0x07, 0xC5, 0x8B, 0xBE, 0xA3, 0x96, 0xCF, 0x6F, 0x54, 0x4D, 0xFD, 0x95,
+    0xCB, 0x48, 0x73, 0x29, 0x8D, 0xEE, 0x04, 0x44, 0x30, 0xEB, 0xF9, 0xD1, 0x4A, 0x8D, 0x55, 0xA4,
+    0x5C, 0x9B, 0x14, 0x14, 0x1D, 0x64, 0x9A, 0xE8, 0xE5, 0x8D, 0xBE, 0x02, 0x11, 0x8A, 0x37, 0x66,
+    0x9C, 0x66, 0xF4, 0x46, 0x28, 0xA7, 0xD2, 0xBB, 0xAE, 0x26, 0x12, 0xCB, 0x50, 0x8C, 0xAE, 0xAB,
+    0x1F, 0x5E, 0x88, 0x65, 0x28, 0x83, 0xF3, 0xEE, 0x8B, 0xB2, 0x2B, 0xF4, 0x33, 0x46, 0x23, 0xA5,
+    0xB8, 0x05, 0x0D, 0x6C, 0x03, 0x17, 0xA1, 0xF0, 0xB0, 0x07, 0x1C, 0x27, 0x97, 0xBC, 0x95, 0x70,
+    0xE7, 0x9F, 0xCF, 0x22, 0xD8, 0x11, 0x5C, 0x47, 0xB6, 0xA4, 0x13, 0xEF, 0x3C, 0x28, 0xAD, 0x6F,
+    0x3D, 0xC0, 0x79, 0x80, 0xFB, 0x47, 0x9C, 0xD8, 0xCB, 0xC3, 0x1E, 0x1F, 0xAF, 0x7E, 0xDC, 0x95,
+    0x0A, 0x66, 0x80, 0xF9, 0xE0, 0x39, 0xA7, 0xD9, 0x2A, 0x66, 0x5A, 0x38, 0xB0, 0x5D, 0xAE, 0x9D,
+    0x71, 0xF2, 0xC5, 0x70, 0x17, 0xA7, 0xC0, 0xDC, 0x80, 0x6A, 0x85, 0xFB, 0x67, 0xA8, 0xFD, 0xDE,
+    0x67, 0xA3, 0x95, 0x8E, 0x49, 0xC3, 0x41, 0x9D, 0x05, 0xC0, 0x4C, 0x54, 0x1E, 0x61, 0x22, 0xF7,
+    0xA5, 0x57, 0xF8, 0x04, 0x44, 0xCC, 0x48, 0xD5, 0x70, 0x11, 0x13, 0xA8, 0x3A, 0x2E, 0x61, 0x02,
+    0x95, 0xA7, 0x27, 0x9F, 0x21, 0x0F, 0x17, 0x4D, 0x88, 0xE5, 0xDB, 0xD1, 0xFE, 0x64, 0x87, 0x1D,
+    0x5E, 0x84, 0x08, 0x33, 0xD9, 0x44, 0x1E, 0x30, 0x81, 0x62, 0xA4, 0x1C, 0xB0, 0x9E, 0xCA, 0x53,
+    0x7B, 0xD2, 0x41, 0x6B, 0xE0, 0x74, 0x5A, 0xE5, 0x3B, 0x30, 0x47, 0x7E, 0x16, 0xCE, 0xA4, 0x93,
+    0x17, 0xA1, 0xEA, 0xC8, 0x03, 0xB8, 0xB4, 0xD7, 0xA7, 0xC0, 0x7A, 0x98, 0xA1, 0x4E, 0x98, 0x63,
+    0x05, 0x79, 0xAA, 0x88, 0x51, 0xC2, 0x41, 0xB8, 0x15, 0xDA, 0x05, 0x5E, 0x78, 0x10, 0xC2, 0x27,
+    0x61, 0xDC, 0x3B, 0x9B, 0x0D, 0xED, 0x6C, 0x7C, 0x38, 0x65, 0xBA, 0x70, 0xAA, 0x7C, 0xF8, 0x7B,
+    0x73, 0x95, 0x2B, 0xEC, 0x19, 0x75, 0x9F, 0xDB, 0xAE, 0x58, 0x36, 0xBF, 0xCF, 0x11, 0xE3, 0x09,
+    0xF7, 0x50, 0x74, 0x4F, 0x52, 0xEB, 0xA7, 0x48, 0x2A, 0xBA, 0x4F, 0x3E, 0xF4, 0x50, 0x3E, 0xBC,
+    0x10, 0x6C, 0x79, 0xCD, 0xBB, 0xF5, 0x81, 0x4C, 0xC9, 0xD8, 0xFE, 0xDF, 0xCC, 0xE2, 0x8A, 0xB2,
+    0xCB, 0x00, 0xA7, 0x80, 0x90, 0x26, 0x55, 0xFA, 0x6D, 0xE8, 0x50, 0x3D, 0x3A, 0xE2, 0xAA, 0x8E,
+    0xD3, 0x67, 0xE0, 0x52, 0x04, 0x05, 0x72, 0x79, 0x8C, 0xA0, 0x50, 0x3A, 0x75, 0xF6, 0x42, 0xA0,
+    0x7E, 0x2C, 0xE2, 0x0A, 0x01, 0xCB, 0x86, 0x03, 0xAA, 0x01, 0x0E, 0x3E, 0x77, 0x87, 0xAD, 0x47,
+    0x56, 0xA2, 0x59, 0xB2, 0xD9, 0xC6, 0x7C, 0xAA, 0xA3, 0x09, 0xFD, 0x6C, 0xDE, 0x5E, 0xA7, 0xE2,
+    0x8D, 0x9F, 0x84, 0xF2, 0xCD, 0x6B, 0xC1, 0xEA, 0xD3, 0xA3, 0x5D, 0xEC, 0x50, 0x4D, 0xD6, 0xD7,
+    0x63, 0xE5, 0x0F, 0x77, 0x3B, 0xCF, 0xC3, 0x5C, 0x7A, 0x8C, 0x56, 0xB0, 0x0A, 0x50, 0x2E, 0x1F,
+    0x08, 0xBF, 0xAC, 0x37, 0x13, 0xAE, 0xA9, 0x3A, 0x7A, 0x22, 0x59, 0x2C, 0x47, 0xCC, 0xE4, 0xC0,
+    0x7E, 0x7F, 0x02, 0xF7, 0xAA, 0x87, 0x7E, 0x81, 0x4C, 0x01, 0x8C, 0x00, 0x3B, 0xEF, 0x5C, 0xDD,
+    0xBA, 0x05, 0xA9, 0xDF, 0x52, 0x43, 0xA6, 0x19, 0x4A, 0x75, 0xE0, 0x46, 0x80, 0x73, 0x07, 0x9B,
+    0x53, 0xF9, 0xB8, 0xC7, 0x64, 0x9B, 0x23, 0x85, 0xAF, 0xF3, 0x60, 0xBB, 0xD9, 0x0C, 0x47, 0xB3,
+    0x50, 0x71, 0xB1, 0xFC, 0xD6, 0x19, 0x23, 0x35, 0x92, 0x27, 0xC0, 0x11, 0x78, 0x00, 0xF8, 0x7B,
+    0x50, 0x8C, 0xD4, 0x92, 0x91, 0x86, 0x8F, 0x2C, 0x8F, 0x53, 0x37, 0x98, 0x09, 0x9C, 0xBA, 0x42,
+    0xA2, 0xFF, 0xE3, 0xC9, 0x8E, 0xB6, 0x59, 0xB2, 0xC9, 0xFE, 0xA0, 0x47, 0x0A, 0x56, 0x0B, 0x92,
+    0x37, 0xDB, 0x86, 0x1E, 0x82, 0x62, 0x84, 0x4B, 0x60, 0x3D, 0xF7, 0xAD, 0xCF, 0x1B, 0xC9, 0x9B,
+    0x09, 0xDC, 0xBF, 0xA3, 0xD0, 0x42, 0xAF, 0x60, 0x83, 0x6D, 0x16, 0x26, 0xFB, 0x72, 0x9F, 0x49,
+    0xA1, 0x4A, 0x5F, 0x3F, 0xA8, 0xF1, 0xF6, 0xC0, 0x2F, 0xC9, 0x23, 0x69, 0xA5, 0x90, 0x34, 0x53,
+    0x2E, 0x46, 0x0D, 0x36, 0xBA, 0x11, 0xEC, 0x3B, 0x0B, 0x50, 0x2B, 0x45, 0xDB, 0x0E, 0x5A, 0xF5,
+    0x0D, 0xC5, 0x4F, 0xE3, 0x19, 0x70, 0x5F, 0x0E, 0x11, 0x13, 0xDD, 0xB1, 0x40, 0x35, 0x44, 0xEB,
+    0x51, 0x11, 0x5C, 0x63, 0xA7, 0xB6, 0x5B, 0xA1, 0xD9, 0x07, 0x6A, 0xAD, 0x56, 0x7A, 0x2D, 0xB8,
+    0x63, 0x13, 0xD5, 0xAB, 0x9E, 0x72, 0x85, 0x5A, 0x70, 0xF3, 0x8D, 0xCE, 0xBC, 0xF6, 0x8A, 0x2F,
+    0xAE, 0x5D, 0xF3, 0xF6, 0xCB, 0xD7, 0xBC, 0xB3, 0x5F, 0xBA, 0x03, 0xC5, 0xD5, 0xA3, 0xF5, 0x18,
+    0x85, 0xB6, 0xC1, 0xE9, 0x95, 0x48, 0xB6, 0x3A, 0x8D, 0xD8, 0xE0, 0x04, 0xCE, 0xB7, 0x01, 0xFA,
+    0xE5, 0x5E, 0xA8, 0xB4, 0x42, 0x26, 0x45, 0xB0, 0x37, 0xCA, 0x19, 0xD4, 0xD9, 0x40, 0x31, 0xE3,
+    0x3C, 0xCE, 0x23, 0x10, 0xC5, 0x4C, 0x31, 0xE3, 0x06, 0xEA, 0x31, 0x17, 0xF4, 0x3F, 0x68, 0x27,
+    0x72, 0x49, 0x9E, 0x22, 0x7D, 0x51, 0x1A, 0xC0, 0x6A, 0x81, 0xE4, 0x3F, 0x81, 0xC7, 0xB3, 0x06,
+    0x17, 0x2E, 0x51, 0xEA, 0x59, 0x9F, 0x45, 0xCD, 0x54, 0xCF, 0x08, 0xA3, 0x3F, 0x6E, 0x32, 0x09,
+    0xDA, 0x37, 0x66, 0x6C, 0xB0, 0x3E, 0x8B, 0x44, 0xEA, 0xC6, 0x7A, 0x13, 0xF2, 0x19, 0xF7, 0x45,
+    0x61, 0xA4, 0x91, 0x5A, 0x31, 0xC1, 0x95, 0x7C, 0xFB, 0xB5, 0x0D, 0xFB, 0x79, 0xA0, 0x0E, 0x80,
+    0x9B, 0x7B, 0x70, 0x7F, 0x59, 0x7B, 0x2A, 0x5F, 0x06, 0xEC, 0x98, 0x2F, 0xD8, 0x40, 0xDF, 0x94,
+    0x13, 0xD5, 0x58, 0x44, 0x8A, 0x68, 0x16, 0x32, 0xE5, 0x2B, 0xB4, 0x57, 0x04, 0x55, 0x50, 0x87,
+    0x59, 0x7A, 0x0F, 0xD2, 0xB0, 0x01, 0x22, 0x9B, 0xCC, 0x73, 0x06, 0x14, 0x37, 0x07, 0x82, 0xD5,
+    0xAD, 0x0B, 0x96, 0x03, 0xA8, 0xA6, 0x7C, 0xFD, 0x22, 0xA7, 0xB2, 0xC9, 0x8C, 0xC5, 0xE0, 0xA8,
+    0x9E, 0x9E, 0x38, 0x53, 0xF9, 0x2C, 0x46, 0x0A, 0x8D, 0x58, 0x81, 0x9B, 0x40, 0x09, 0xFE, 0xC1,
+    0xC1, 0x8E, 0x88, 0xBD, 0xA6, 0xB9, 0x57, 0x63, 0x02, 0x7B, 0xC9, 0xFB, 0xDF, 0xDD, 0x01, 0x91,
+    0x4A, 0xEA, 0x72, 0x69, 0xC2, 0x49, 0x29, 0x4D, 0xE8, 0x49, 0x6E, 0x9F, 0x05, 0xA8, 0xFC, 0x06,
+    0xAD, 0xDD, 0x7E, 0x58, 0x6D, 0x36, 0x48, 0x27, 0xA0, 0x1A, 0xC1, 0x2C, 0xEC, 0x83, 0x6B, 0x3E,
+    0x07, 0x44, 0xC8, 0x66, 0x7A, 0x4D, 0x48, 0x81, 0xF5, 0xFC, 0xB9, 0x2C, 0x82, 0x99, 0xD3, 0x5F,
+    0x31, 0xA5, 0x48, 0x62, 0xB7, 0xBF, 0x6A, 0x4C, 0xA1, 0xE4, 0x70, 0xF7, 0x01, 0x28, 0x3F, 0x6B,
+    0xBF, 0x75, 0x22, 0x93, 0xD4, 0xF4, 0x92, 0xCF, 0x7F, 0x21, 0xCA, 0x3F, 0xDC, 0x01, 0x99, 0x62,
+    0xAE, 0x68, 0x06, 0xCC, 0x80, 0x53, 0xA8, 0x7F, 0x7C, 0xD6, 0x76, 0xD8, 0x86, 0x1A, 0x5C, 0x0A,
+    0x74, 0xDB, 0x31, 0xF1, 0x56, 0x1A, 0xCD, 0x8D, 0x13, 0xC7, 0x93, 0xF3, 0xDA, 0x26, 0x5C, 0x8E,
+    0x60, 0xB4, 0x92, 0x49, 0x23, 0xFD, 0xCD, 0x05, 0xE7, 0x5D, 0x67, 0x87, 0x62, 0x2C, 0x42, 0x36,
+    0xE5, 0x33, 0x91, 0x85, 0x1E, 0x67, 0xD4, 0x54, 0x57, 0xD4, 0xD9, 0xD0, 0xA6, 0xC9, 0x67, 0x9A,
+    0x4B, 0x0D, 0x47, 0x20, 0x50, 0xFC, 0x08, 0xB7, 0x32, 0x1F, 0x29, 0x7C, 0x78, 0xA8, 0xF0, 0x61,
+    0x31, 0xD7, 0xD3, 0x49, 0x90, 0x51, 0x70, 0x03, 0x76, 0x76, 0x2A, 0x67, 0x68, 0xAF, 0xE9, 0x9B,
+    0x2B, 0x98, 0xE8, 0x62, 0xEB, 0xA1, 0xFE, 0x8E, 0x9E, 0x0D, 0x90, 0xAD, 0xFD, 0x3B, 0x11, 0xB0,
+    0x37, 0x53, 0xEE, 0xD5, 0x4B, 0x03, 0x50, 0x48, 0x73, 0x02, 0x9A, 0x2B, 0x90, 0x40, 0x1C, 0x64,
+    0x92, 0x52, 0xA6, 0xAE, 0x79, 0x43, 0xA1, 0x23, 0x54, 0x6B, 0xFB, 0x5D, 0x35, 0x94, 0xFA, 0x52,
+    0x74, 0x0B, 0x46, 0x63, 0x7F, 0x55, 0x73, 0xA6, 0xD9, 0xCE, 0x56, 0x3E, 0x45, 0xB6, 0xB0, 0xE1,
+    0xC8, 0x74, 0xB7, 0x03, 0x2F, 0xF7, 0x42, 0xFD, 0x68, 0x74, 0x98, 0xD7, 0xD6, 0x1A, 0xA2, 0x4E,
+    0x36, 0x54, 0xED, 0xAB, 0x4D, 0x4A, 0x6E, 0x90, 0x3A, 0xA8, 0xE4, 0x37, 0x43, 0xAD, 0xB4, 0x42,
+    0xFD, 0xE6, 0x9B, 0x23, 0xED, 0xF5, 0xD7, 0x56, 0xFA, 0xAB, 0x53, 0x82, 0x57, 0x01, 0xE0, 0x93,
+    0x9B, 0xB7, 0xC8, 0x1E, 0xC7, 0x68, 0xC2, 0xC9, 0x67, 0x5C, 0x82, 0x72, 0xE0, 0x60, 0xC4, 0x09,
+    0xA3, 0x86, 0xFB, 0x2E, 0xA5, 0xC8, 0xD9, 0x66, 0x4D, 0x35, 0xD6, 0x6F, 0x2E, 0xB9, 0xE4, 0x9D,
+    0x42, 0xD6, 0xBF, 0x7E, 0x7B, 0xA0, 0xA5, 0x6F, 0x3E, 0x71, 0x09, 0x06, 0x1E, 0x44, 0x5D, 0x1D,
+    0x28, 0xBB, 0x66, 0xAA, 0x64, 0x34, 0xDE, 0x1F, 0x29, 0x3C, 0x82, 0x90, 0xEF, 0x50, 0xBE, 0x99,
+    0xEB, 0x40, 0x75, 0x45, 0xD0, 0xDB, 0x80, 0x99, 0x04, 0xD5, 0x4B, 0x13, 0xAC, 0x7D, 0x83, 0xB9,
+    0x39, 0x6F, 0x8E, 0x4F, 0x11, 0x0A, 0x79, 0xA8, 0x57, 0x40, 0x0B, 0x14, 0x8A, 0x5B, 0xDE, 0xB1,
+    0xB6, 0x91, 0x62, 0xD2, 0x8C, 0xF3, 0x9A, 0x8E, 0x2B, 0xD7, 0x3B, 0x03, 0x50, 0x01, 0x5C, 0xBC,
+    0x6D, 0xA1, 0x8E, 0x38, 0xEA, 0x1A, 0x7B, 0xB2, 0x29, 0x5E, 0x6D, 0x8C, 0x3A, 0xD4, 0xD1, 0x77,
+    0xB8, 0x40, 0x25, 0xCA, 0x37, 0x47, 0xF3, 0xDA, 0x9A, 0x4D, 0xED, 0x9F, 0x43, 0xD1, 0x90, 0xFB,
+    0xDB, 0x03, 0x61, 0xBE, 0x60, 0x3D, 0x7D, 0x93, 0xCF, 0xD4, 0x23, 0xAE, 0x29, 0x22, 0xE6, 0x9D,
+    0x2B, 0x82, 0xCB, 0x2F, 0xB6, 0x1E, 0xFB, 0xEA, 0xB3, 0x13, 0x59, 0xBC, 0xB9, 0x42, 0x2D, 0x75,
+    0x18, 0x69, 0x82, 0x56, 0xF2, 0x94, 0x3F, 0x91, 0x60, 0xDD, 0x73, 0x33, 0xD5, 0xCB, 0x8F, 0x68,
+    0xC8, 0x23, 0x56, 0xB8, 0x8E, 0x36, 0x1E, 0x7C, 0x8E, 0xFC, 0xFC, 0x59, 0x5E, 0x60, 0x26, 0x98,
+    0x90, 0x05, 0xEB, 0xF3, 0xBF, 0x72, 0x98, 0x3F, 0x5F, 0x28, 0x34, 0x61, 0x15, 0xB0, 0x6D, 0xA4,
+    0x3E, 0x92, 0xF2, 0x8D, 0xD3, 0xB8, 0x01, 0x33, 0xD7, 0x23, 0x27, 0xBF, 0x27, 0x8C, 0x5E, 0xFD,
+    0x80, 0x85, 0xEA, 0x7E, 0xF1, 0x42, 0x95, 0xBB, 0x85, 0xCA, 0x94, 0x6B, 0x82, 0x72, 0x40, 0xEA,
+    0xDA, 0x94, 0x3F, 0x3B, 0xA8, 0x3A, 0x4A, 0x8F, 0x79, 0x3B, 0x66, 0xEF, 0x46, 0xFA, 0x19, 0x37,
+    0x53, 0x45, 0x4A, 0x35, 0x46, 0x21, 0x93, 0xB8, 0xDC, 0x06, 0xF7, 0xEC, 0x5A, 0xBD, 0xAC, 0xC1,
+    0x6A, 0xAE, 0xC7, 0x56, 0x57, 0x94, 0x9D, 0x90, 0xFD, 0x95, 0x0D, 0xC8, 0xCD, 0x67, 0xEE, 0xBB,
+    0xB4, 0x47, 0xE5, 0xB0, 0x3D, 0x46, 0xE4, 0x02, 0x35, 0xB4, 0x03, 0xF5, 0x82, 0xED, 0x7D, 0x71,
+    0x3D, 0x9A, 0x20, 0x4F, 0xE5, 0x59, 0xA9, 0x7D, 0xB6, 0xE0, 0x7C, 0x1E, 0x71, 0x9D, 0x89, 0xB4,
+    0x8D, 0x99, 0x11, 0xC5, 0x84, 0x28, 0xA7, 0x6C, 0xC5, 0x86, 0x7C, 0xA1, 0x0A, 0x66, 0xA1, 0x1E,
+    0x8D, 0xA4, 0xA1, 0x54, 0xF2, 0x20, 0xE9, 0x5F, 0x57, 0xBD, 0x7B, 0x5E, 0x4D, 0x1D, 0x32, 0x35,
+    0x6E, 0xCC, 0x15, 0xDB, 0x21, 0x39, 0xF2, 0x6C, 0xDA, 0x1D, 0xB7, 0xFC, 0x5C, 0x1E, 0x0A, 0xBF,
+    0xC7, 0x45, 0x33, 0xD8, 0xEE, 0x54, 0x36, 0x95, 0xBE, 0x66, 0x36, 0xA1, 0xD2, 0x9A, 0x4B, 0xA3,
+    0xD3, 0x62, 0x42, 0xE5, 0x2F, 0xE7, 0x8B, 0x1D, 0xDC, 0x0C, 0x65, 0x03, 0x81, 0xCA, 0x23, 0x2D,
+    0xD4, 0x3E, 0x93, 0x22, 0xCE, 0xE7, 0xEB, 0x89, 0xC7, 0xD3, 0xF8, 0xA0, 0x6F, 0xCC, 0x0C, 0x28,
+    0x25, 0x19, 0xC2, 0x06, 0xC8, 0x56, 0x6C, 0x80, 0x7C, 0xA1, 0x0A, 0x60, 0xD6, 0xF3, 0xFD, 0x08,
+    0x85, 0xA4, 0x01, 0x4A, 0x29, 0x9D, 0xDD, 0xFD, 0xBB, 0x0E, 0xAA, 0x80, 0x1A, 0xA8, 0x43, 0xAE,
+    0x06, 0xDC, 0x68, 0x04, 0xB4, 0x83, 0x11, 0x90, 0x85, 0x42, 0x93, 0xF5, 0xF5, 0xF9, 0x6E, 0x8F,
+    0x99, 0x6C, 0x32, 0x03, 0xA5, 0xAF, 0xC1, 0x11, 0xC9, 0x66, 0x33, 0x6E, 0x6C, 0x8F, 0x16, 0x90,
+    0x02, 0xC5, 0x58, 0x79, 0x5C, 0x73, 0xF9, 0x76, 0xD6, 0x26, 0x42, 0x29, 0xAD, 0x60, 0x24, 0x35,
+    0x10, 0xE9, 0x3D, 0xB4, 0xB8, 0x00, 0xB5, 0xB7, 0x11, 0xEC, 0x58, 0xAC, 0x60, 0xA6, 0x5C, 0x1A,
+    0xB2, 0x88, 0xB4, 0xD2, 0xE3, 0xD4, 0x7B, 0xD7, 0x55, 0xD1, 0x4C, 0x76, 0x28, 0x17, 0x2E, 0x15,
+    0x93, 0x11, 0xF5, 0xC3, 0x11, 0x75, 0xD6, 0xF7, 0xB4, 0x43, 0x19, 0x5C, 0x57, 0x07, 0x37, 0xD9,
+    0xC1, 0xC6, 0x6A, 0x2E, 0x82, 0x51, 0x79, 0x67, 0xEE, 0xA8, 0x34, 0xAA, 0x48, 0x1E, 0xCB, 0x88,
+    0x99, 0xCB, 0x19, 0x33, 0xD9, 0x89, 0x22, 0x54, 0x81, 0x72, 0xAC, 0x03, 0x76, 0x70, 0x23, 0x95,
+    0x77, 0x03, 0xB5, 0x6F, 0x75, 0xD6, 0x75, 0xBD, 0xA6, 0x43, 0xE8, 0x66, 0x04, 0x11, 0xC9, 0x22,
+    0x91, 0x7C, 0x26, 0x62, 0x26, 0x22, 0x45, 0x28, 0x66, 0xCA, 0xD0, 0x06, 0xEC, 0xD8, 0x0F, 0xD8,
+    0x71, 0x9F, 0xBB, 0x38, 0x00, 0xD0, 0x7B, 0xC8, 0x34, 0xF6, 0x5D, 0xAE, 0x77, 0x15, 0x33, 0xFD,
+    0xFB, 0xB5, 0x6F, 0x64, 0xE6, 0x62, 0x50, 0x3E, 0xE7, 0xA1, 0x25, 0x66, 0xB1, 0xEE, 0x2E, 0xB3,
+    0xD8, 0xC1, 0x3D, 0xBC, 0x9A, 0xC9, 0xBE, 0xAC, 0x66, 0x35, 0x52, 0x70, 0x83, 0x14, 0xAD, 0x24,
+    0x3D, 0x2C, 0x49, 0x5D, 0x25, 0xAD, 0xEC, 0x27, 0x3C, 0x89, 0x62, 0x2B, 0xD6, 0x7A, 0x28, 0x56,
+    0x2D, 0x66, 0x3A, 0x63, 0x8F, 0x85, 0xA3, 0x66, 0x98, 0xEA, 0x2C, 0x5C, 0xB4, 0x0F, 0x4F, 0xCE,
+    0xBC, 0x3C, 0xDB, 0x2B, 0xEF, 0xEA, 0xD8, 0xEC, 0x34, 0xF6, 0xD2, 0x6C, 0xA5, 0x81, 0x3F, 0xDC,
+    0x47, 0x28, 0xD9, 0x85, 0x77, 0x13, 0xE5, 0xD2, 0x2B, 0x52, 0x4B, 0xBE, 0x54, 0x03, 0x3B, 0x74,
+    0x5B, 0x44, 0xD2, 0x13, 0x3B, 0x41, 0x26, 0xA0, 0x9E, 0x20, 0xD7, 0xF0, 0x6B, 0xD4, 0x52, 0xC8,
+    0x24, 0x61, 0xA5, 0x31, 0x45, 0x1C, 0x69, 0x80, 0x00, 0xB9, 0x36, 0x72, 0x07, 0xE0, 0xFE, 0x99,
+    0x3E, 0x1A, 0xFD, 0xA7, 0x72, 0xC4, 0x7A, 0xEA, 0x0E, 0x07, 0x0E, 0xDC, 0x55, 0x9C, 0x7C, 0xAD,
+    0xE1, 0xB7, 0xD4, 0x39, 0x4F, 0x8A, 0x8F, 0x95, 0xA4, 0xAB, 0x92, 0x66, 0x27, 0xE9, 0x91, 0xF3,
+    0xFD, 0xF9, 0x73, 0xB7, 0xF1, 0x8E, 0xE3, 0x46, 0x24, 0xD5, 0x3B, 0xBC, 0xD1, 0x76, 0xEC, 0xCC,
+    0x9A, 0x9D, 0x61, 0x83, 0x1B, 0xC0, 0x2C, 0x17, 0xA1, 0x7D, 0xA9, 0xDB, 0x4E, 0x56, 0x0D, 0x64,
+    0xE7, 0xA0, 0x96, 0xAC, 0xF4, 0xF4, 0x9F, 0xFC, 0xC5, 0xD9, 0x2C, 0xC0, 0x45, 0xD8, 0x83, 0xAA,
+    0xA1, 0xF4, 0x98, 0x00, 0x33, 0x9C, 0x3E, 0x8E, 0x3B, 0x05, 0x0F, 0x40, 0xD9, 0xD0, 0xC3, 0xDA,
+    0x36, 0x26, 0xBA, 0xAE, 0x0C, 0xCE, 0x57, 0x83, 0xF3, 0x6D, 0x57, 0x0F, 0xA2, 0x7A, 0x2D, 0x62,
+    0x6F, 0x6E, 0x3E, 0x53, 0x9E, 0x52, 0x0D, 0xC5, 0x9A, 0xD6, 0xAA, 0x9C, 0xD3, 0x52, 0x55, 0x21,
+    0x61, 0x3E, 0x17, 0xB6, 0x3C, 0x35, 0x9F, 0x5D, 0xD3, 0x9A, 0xD9, 0x0E, 0xEE, 0xE9, 0x98, 0xCF,
+    0x8E, 0xFA, 0xA5, 0x31, 0x5F, 0x22, 0x95, 0x9A, 0x4C, 0x23, 0x55, 0x04, 0x35, 0xD8, 0x40, 0xB6,
+    0x42, 0x3D, 0xEC, 0x48, 0x39, 0xCA, 0x80, 0x1D, 0xDB, 0xC6, 0x44, 0x33, 0xD3, 0xE3, 0x7C, 0x35,
+    0x98, 0x68, 0x66, 0xEA, 0x41, 0x64, 0x6B, 0x3D, 0x50, 0xBD, 0x33, 0x83, 0xB6, 0x54, 0xCB, 0x49,
+    0x63, 0x29, 0x2D, 0x9C, 0xE8, 0xBF, 0xD5, 0x50, 0xCE, 0x1B, 0xDC, 0xA9, 0xF6, 0x77, 0x24, 0x00,
+    0x87, 0x38, 0xD0, 0x98, 0xC9, 0x4C, 0xB8, 0xA6, 0xC7, 0xCC, 0xD6, 0xE3, 0x9E, 0x99, 0xC9, 0xE7,
+    0x16, 0xEA, 0x97, 0x06, 0xB2, 0x75, 0x86, 0x4A, 0x90, 0x69, 0x00, 0x1B, 0xC9, 0x24, 0x35, 0x4E,
+    0x0A, 0xD9, 0xEF, 0xAD, 0x27, 0x6E, 0x5B, 0xFC, 0xC3, 0x4D, 0xDA, 0x13, 0x97, 0xA8, 0x48, 0xDA,
+    0xC6, 0x79, 0x6C, 0xA8, 0x3D, 0x26, 0xD6, 0x1E, 0xFA, 0x0B, 0xC3, 0x46, 0x27, 0xA5, 0xBC, 0xA5,
+    0x1F, 0x37, 0xE3, 0x49, 0x6E, 0xB9, 0x92, 0xDF, 0x38, 0xCF, 0xEA, 0x1D, 0x41, 0x35, 0xF5, 0x03,
+    0xD5, 0x5C, 0x45, 0xAA, 0xD9, 0x88, 0x2A, 0xA6, 0xCF, 0xDB, 0x8E, 0x44, 0x3C, 0x24, 0xE7, 0x78,
+    0x94, 0x17, 0x71, 0x79, 0xA0, 0x7A, 0xD4, 0x63, 0x2F, 0x80, 0x8D, 0xB7, 0xC0, 0x62, 0x3D, 0x41,
+    0x1F, 0xC9, 0xE7, 0x85, 0x32, 0xAC, 0xD4, 0xBE, 0xDD, 0x00, 0xC6, 0x93, 0x3B, 0xEA, 0xCD, 0x3E,
+    0x2B, 0x5D, 0xFF, 0xF6, 0x85, 0x77, 0xFF, 0x6D, 0xC8, 0x23, 0x91, 0x95, 0x3D, 0x5C, 0x53, 0x35,
+    0x95, 0x2F, 0x7D, 0x19, 0x4C, 0x30, 0x33, 0x33, 0x91, 0xD3, 0xB4, 0x38, 0xEA, 0xCE, 0x7A, 0x2B,
+    0xC9, 0x48, 0xBA, 0x22, 0x69, 0xEC, 0xA5, 0x29, 0xE1, 0x56, 0xDA, 0xCD, 0xB8, 0x0F, 0x34, 0xAD,
+    0x9E, 0xAD, 0xF5, 0x1D, 0xBF, 0x97, 0x0F, 0xB6, 0x09, 0x85, 0x3F, 0x92, 0x87, 0x07, 0x98, 0xCB,
+    0xE6, 0x88, 0xF1, 0x95, 0x96, 0x52, 0x3A, 0x26, 0x79, 0xF2, 0x64, 0x5A, 0x1F, 0x4F, 0xC3, 0xF0,
+    0xB5, 0x5F, 0xE9, 0x4D, 0x30, 0x73, 0xE5, 0xAD, 0x3F, 0x43, 0x9B, 0x87, 0x7C, 0x2E, 0xBD, 0x1D,
+    0x5C, 0x26, 0x7A, 0xC5, 0x4C, 0x1A, 0xF9, 0x42, 0xDB, 0x90, 0xC5, 0x04, 0x32, 0x5D, 0xB3, 0xB1,
+    0x3D, 0x50, 0x4D, 0xC9, 0x87, 0x38, 0xC8, 0x67, 0x0E, 0x9B, 0xD7, 0xC6, 0xA3, 0x47, 0x8A, 0xEB,
+    0xFE, 0xE2, 0x53, 0xF6, 0xCB, 0x4F, 0x4F, 0xAD, 0xF2, 0x9B, 0x81, 0xA3, 0x18, 0xCF, 0x29, 0xCA,
+    0xC0, 0x8A, 0x19, 0x38, 0x02, 0xC0, 0x1E, 0x17, 0x0B, 0x6F, 0xBB, 0x17, 0xB3, 0xC9, 0x52, 0x67,
+    0x6F, 0x1F, 0x0B, 0x0F, 0x5D, 0x3C, 0x63, 0x5E, 0x7A, 0x76, 0xD8, 0x53, 0x34, 0x92, 0xAF, 0x35,
+    0xD3, 0x3F, 0xDB, 0x98, 0x97, 0x27, 0x4E, 0xD5, 0x1C, 0x7C, 0x26, 0xC0, 0x19, 0x0E, 0x64, 0xC7,
+    0xBA, 0xEF, 0xF9, 0x27, 0x7F, 0xF0, 0xE0, 0xEF, 0x7E, 0xF5, 0x01, 0x5D, 0xD7, 0xD8, 0xBF, 0x70,
+    0xCF, 0x11, 0xF3, 0x18, 0x45, 0xB7, 0x43, 0x84, 0xD9, 0x9C, 0xC8, 0x6F, 0xC7, 0x1D, 0x43, 0x95,
+    0xBA, 0x52, 0xEA, 0xDC, 0xDA, 0x23, 0x2E, 0x16, 0xC1, 0x84, 0xBA, 0xB3, 0xDD, 0xC2, 0xE5, 0x22,
+    0x98, 0xA9, 0xF6, 0x95, 0x17, 0x3D, 0xC7, 0x6F, 0xE3, 0x25, 0x88, 0xB7, 0x28, 0x8A, 0x08, 0x65,
+    0xE2, 0x25, 0xB2, 0x5B, 0xBC, 0x44, 0xF6, 0xC1, 0xBC, 0xC4, 0xBD, 0x90, 0xFD, 0x01, 0x6D, 0x43,
+    0x2D, 0xDF, 0x76, 0x48, 0xC1, 0xAD, 0xC7, 0xD6, 0x7C, 0xAA, 0xA4, 0x89, 0x39, 0xEB, 0x25, 0x45,
+    0xB2, 0x5E, 0x8A, 0xD0, 0x4A, 0x11, 0xA4, 0x1F, 0x3F, 0x9E, 0xB2, 0xF9, 0xE4, 0x35, 0x40, 0xC3,
+    0xC1, 0x01, 0x52, 0xF0, 0x6B, 0x25, 0x9F, 0x30, 0x3F, 0x14, 0x5A, 0x36, 0xB0, 0xFB, 0x39, 0x0E,
+    0x4E, 0x55, 0x63, 0xF5, 0xA5, 0xF5, 0x89, 0x21, 0xB4, 0xFA, 0xC1, 0x25, 0x4E, 0xA6, 0xBA, 0xC9,
+    0xC0, 0xFA, 0x15, 0x38, 0x03, 0x54, 0xAF, 0xFF, 0x06, 0x46, 0x6A, 0x68, 0xE5, 0xC9, 0xD5, 0xDD,
+    0x0B, 0xD9, 0xE7, 0x68, 0x1B, 0x2A, 0x79, 0x77, 0xE7, 0xC0, 0xE6, 0xFD, 0x81, 0x1D, 0xB8, 0x7D,
+    0x60, 0xBD, 0xF4, 0x5C, 0x3A, 0xAE, 0xFB, 0x03, 0x3B, 0x7B, 0x70, 0xFC, 0xC0, 0x81, 0x15, 0xFE,
+    0xD0, 0x8E, 0xED, 0x4D, 0x87, 0x84, 0xAA, 0x01, 0x9E, 0xE7, 0xE0, 0xEB, 0x35, 0xD5, 0x6E, 0xA8,
+    0x7F, 0x71, 0x6B, 0xA8, 0xD9, 0x8D, 0xE3, 0x77, 0x0C, 0x15, 0x5A, 0xF9, 0xEC, 0xDB, 0xEA, 0xF8,
+    0x3A, 0x6C, 0x76, 0xC2, 0xDF, 0xB0, 0xB0, 0x70, 0xEB, 0x36, 0xA5, 0x91, 0x54, 0x29, 0xFB, 0xD8,
+    0x71, 0xF6, 0x77, 0xE6, 0xC1, 0x3F, 0xFF, 0x26, 0xA3, 0xE0, 0x3C, 0x76, 0x76, 0x8B, 0x9D, 0xA0,
+    0xBD, 0xA6, 0x6B, 0x0B, 0x98, 0xE8, 0xE6, 0xBE, 0x83, 0xFA, 0x3B, 0x7A, 0x62, 0x84, 0x4C, 0xB7,
+    0xB2, 0x9E, 0x2D, 0xA1, 0xF1, 0x29, 0xEB, 0x99, 0xD2, 0x19, 0x5F, 0xEE, 0xCC, 0x7A, 0xD6, 0xED,
+    0x43, 0xD3, 0x96, 0xF5, 0x0C, 0x50, 0xAD, 0xED, 0x4B, 0x82, 0x52, 0x5F, 0x9A, 0xDB, 0x88, 0xD1,
+    0xD8, 0x1F, 0x53, 0xC8, 0x34, 0xDB, 0x50, 0xE9, 0xF6, 0x1A, 0x00, 0x7B, 0x29, 0xFB, 0x31, 0xDB,
+    0x5C, 0xDC, 0x96, 0x13, 0xF5, 0xC3, 0x2F, 0x98, 0xC8, 0x81, 0xE3, 0x87, 0x9A, 0x43, 0xD9, 0xE3,
+    0xF4, 0xCF, 0xCC, 0x76, 0x14, 0x26, 0xD6, 0x5D, 0x74, 0x9E, 0xEA, 0xED, 0x58, 0x3F, 0x1B, 0xA0,
+    0xFF, 0xEA, 0xB5, 0x77, 0x22, 0x98, 0x35, 0xF6, 0x02, 0xAC, 0x5E, 0x92, 0x07, 0xDA, 0x55, 0x21,
+    0x0D, 0x3D, 0x02, 0xB4, 0x29, 0x9D, 0xAB, 0x13, 0x1E, 0xAA, 0x56, 0xBD, 0xB9, 0x40, 0xA9, 0x67,
+    0x63, 0x3F, 0x61, 0x34, 0xEA, 0x9A, 0x86, 0x4C, 0xB3, 0x9D, 0x2A, 0x35, 0xD8, 0x2B, 0x2B, 0xE5,
+    0xB0, 0x62, 0x82, 0xC8, 0xA2, 0xE0, 0x72, 0x0F, 0xAE, 0x87, 0x4A, 0x0D, 0xA5, 0x1A, 0x8C, 0x06,
+    0x32, 0xA9, 0x41, 0x17, 0x26, 0x5C, 0x23, 0x2A, 0x5F, 0x0D, 0x36, 0x98, 0xC9, 0xCC, 0x59, 0xCC,
+    0x23, 0xE2, 0x04, 0x7D, 0xC3, 0x41, 0xF9, 0xC4, 0x7F, 0xCB, 0xC3, 0x99, 0xDB, 0x76, 0xEE, 0xC5,
+    0x8B, 0xBC, 0x15, 0x78, 0x67, 0xC8, 0xD5, 0x98, 0x85, 0x22, 0x52, 0xAA, 0xB3, 0x8F, 0x0E, 0x95,
+    0x19, 0x6B, 0x33, 0x1E, 0x35, 0x03, 0x27, 0x3D, 0x4A, 0xE5, 0x07, 0x52, 0x3E, 0x5C, 0xA7, 0x52,
+    0x97, 0xC7, 0x3D, 0x1D, 0x29, 0x82, 0xEB, 0xE8, 0x8B, 0x09, 0x3B, 0xF6, 0x64, 0xD1, 0x8E, 0xD4,
+    0x7E, 0xC1, 0xCC, 0x95, 0xA7, 0xCD, 0x23, 0x65, 0x70, 0x1D, 0x6B, 0x31, 0x51, 0xFB, 0xBE, 0xB1,
+    0xD1, 0xEA, 0x11, 0x35, 0x0A, 0x6E, 0xA8, 0x63, 0xE2, 0xBF, 0x53, 0xFA, 0xBE, 0x63, 0xED, 0x9D,
+    0x68, 0x57, 0x2E, 0x1E, 0x65, 0x3E, 0xC5, 0xF4, 0x62, 0x1E, 0x26, 0xF3, 0xBD, 0x60, 0xAE, 0x86,
+    0xF2, 0xDA, 0x58, 0x1F, 0x8B, 0x6D, 0x39, 0x63, 0xC2, 0x2D, 0xE6, 0xF6, 0x67, 0xE0, 0x7A, 0xFF,
+    0xF3, 0xE0, 0x7A, 0xF1, 0x01, 0x70, 0xBD, 0xDB, 0x87, 0xEB, 0xBE, 0x1D, 0x8C, 0xFC, 0x06, 0x88,
+    0x6A, 0x35, 0xA9, 0x66, 0x40, 0xBF, 0x00, 0x27, 0x37, 0x32, 0x33, 0x0B, 0x85, 0x77, 0x5C, 0x34,
+    0xA3, 0xED, 0x4E, 0x33, 0x95, 0xBE, 0x26, 0x9A, 0x50, 0x75, 0x6E, 0x87, 0xDE, 0x25, 0x7F, 0x26,
+    0x8B, 0x76, 0xA8, 0x13, 0x8D, 0x2C, 0x4F, 0x35, 0x91, 0xFD, 0x29, 0xBF, 0xBA, 0xF1, 0xDE, 0x4A,
+    0x2F, 0x68, 0x07, 0xA3, 0x6E, 0x1B, 0x6F, 0x26, 0x20, 0x5F, 0xD9, 0xC2, 0xB7, 0x9D, 0x49, 0xC8,
+    0x80, 0x43, 0xC7, 0x61, 0x36, 0xA3, 0x6D, 0x8E, 0xE6, 0xA1, 0x18, 0xD2, 0xD8, 0xFD, 0x69, 0xE6,
+    0x72, 0xA8, 0x1B, 0x29, 0x54, 0x52, 0x2E, 0x8D, 0xAE, 0x59, 0x8A, 0x60, 0x47, 0xB8, 0x9C, 0x8A,
+    0x83, 0x73, 0xF2, 0xD8, 0x89, 0xB4, 0x77, 0x9D, 0xF3, 0x0B, 0x6B, 0x11, 0xCC, 0x54, 0x77, 0x95,
+    0xBF, 0xC4, 0x65, 0x13, 0xCC, 0x64, 0xBB, 0xCA, 0xBB, 0x4C, 0x48, 0x73, 0x26, 0x0D, 0xD9, 0xE7,
+    0x7B, 0xC8, 0xEF, 0x8C, 0x1A, 0xF5, 0x08, 0x02, 0xF3, 0xFA, 0x96, 0x3D, 0xC3, 0x5D, 0x59, 0xF1,
+    0xF0, 0x37, 0xFD, 0xD7, 0x87, 0x23, 0x7F, 0xF4, 0x89, 0x07, 0xAB, 0x47, 0xE5, 0xD7, 0xC0, 0x11,
+    0xAA, 0xC6, 0xFA, 0x3C, 0x30, 0x73, 0x14, 0xEC, 0x44, 0x15, 0x68, 0x07, 0xD4, 0x19, 0x75, 0xE5,
+    0x82, 0x15, 0xED, 0x44, 0x1B, 0x8D, 0x7C, 0xAE, 0x50, 0x0B, 0xAB, 0x2B, 0x9A, 0x69, 0xF5, 0x98,
+    0x86, 0x7C, 0x5D, 0xFA, 0x1E, 0xFB, 0x86, 0x6E, 0x46, 0xDC, 0x49, 0xBD, 0x3A, 0xE6, 0x4B, 0xBB,
+    0xF4, 0x8D, 0x7D, 0x4B, 0x3F, 0x59, 0x70, 0xD7, 0xF5, 0x44, 0xC8, 0x56, 0x1B, 0x7B, 0x5F, 0xCE,
+    0xEE, 0xDA, 0x8A, 0x1B, 0xD6, 0x6A, 0xCA, 0x94, 0x82, 0xEC, 0x06, 0x97, 0x32, 0x41, 0x82, 0x75,
+    0x5B, 0xBD, 0x2B, 0x5F, 0xD9, 0xAD, 0x1C, 0xDA, 0x3F, 0x25, 0x0B, 0x91, 0x25, 0x8F, 0xF9, 0x5A,
+    0xCC, 0x66, 0xB5, 0x93, 0x51, 0x1D, 0x0A, 0xB9, 0x60, 0xFB, 0x9B, 0xA3, 0xBD, 0xF0, 0xCE, 0x58,
+    0x9D, 0x7C, 0x63, 0xA8, 0xAB, 0x97, 0xBC, 0xAB, 0x9E, 0xF0, 0xED, 0x81, 0xBA, 0x4B, 0x68, 0xD6,
+    0xFA, 0xE4, 0xB6, 0x1D, 0x70, 0x1A, 0x2E, 0xB3, 0x10, 0xB3, 0x98, 0xCF, 0x66, 0x32, 0xA1, 0x08,
+    0xE5, 0x68, 0x07, 0xEB, 0x2B, 0x5F, 0x77, 0xAE, 0x71, 0xCD, 0xE1, 0xFD, 0xE3, 0x78, 0xB1, 0x18,
+    0x37, 0x26, 0xB0, 0xD0, 0x04, 0xB4, 0xE3, 0x1D, 0xFE, 0xC7, 0x4C, 0x6C, 0xE5, 0xC4, 0x2C, 0xED,
+    0xFD, 0x08, 0x5C, 0x8E, 0x40, 0xDB, 0x02, 0xEE, 0x31, 0x0F, 0xF5, 0x33, 0x01, 0xAC, 0x5F, 0xC0,
+    0x8E, 0xAE, 0xA1, 0x0C, 0x76, 0xC4, 0x48, 0x33, 0x46, 0xD2, 0x46, 0x92, 0x4A, 0x0A, 0xA9, 0xB2,
+    0xD2, 0x76, 0xA8, 0x71, 0x1E, 0x37, 0xEC, 0x17, 0x84, 0x2E, 0x92, 0x49, 0x5D, 0x62, 0x78, 0xEA,
+    0xF7, 0x56, 0xAF, 0xCA, 0x77, 0xC6, 0xE4, 0x36, 0xD7, 0x7E, 0xA0, 0x26, 0x52, 0x0C, 0xD6, 0xF3,
+    0x22, 0x11, 0x8B, 0xF5, 0x84, 0x7C, 0xA6, 0x92, 0x1A, 0xA4, 0x09, 0x2B, 0x41, 0xFD, 0xC3, 0x00,
+    0x98, 0x10, 0xB7, 0x7F, 0xE5, 0xDB, 0x11, 0xEC, 0x6B, 0x77, 0xD6, 0xAA, 0x97, 0xDD, 0xB4, 0x8A,
+    0x15, 0xB0, 0x2B, 0x50, 0xF7, 0xBB, 0x59, 0x2D, 0x0E, 0xF2, 0xD9, 0x81, 0x09, 0xAE, 0x49, 0x93,
+    0xAA, 0xBD, 0xEB, 0x70, 0x52, 0x87, 0x24, 0x9F, 0x4B, 0xF2, 0x46, 0x92, 0xB7, 0x01, 0xE7, 0xAB,
+    0x11, 0x37, 0x6C, 0x53, 0x7A, 0xFE, 0xBE, 0x86, 0xDE, 0x8E, 0xB8, 0xEB, 0x13, 0xD5, 0x6B, 0x0B,
+    0x76, 0xD6, 0xCF, 0xCE, 0xC7, 0x6A, 0xC6, 0xBE, 0xB1, 0x50, 0x7A, 0x47, 0x31, 0x58, 0x9F, 0x8F,
+    0x26, 0x10, 0x88, 0x1C, 0xE1, 0xF2, 0x4E, 0x46, 0x31, 0x20, 0x05, 0xCA, 0x1B, 0x11, 0x20, 0x3F,
+    0xDF, 0x2B, 0x39, 0x74, 0x75, 0xE9, 0xCE, 0x43, 0x9E, 0xE2, 0x54, 0x96, 0x9C, 0x7C, 0xB6, 0xA4,
+    0xD0, 0x12, 0xFB, 0x06, 0x60, 0xA9, 0x15, 0x81, 0xCB, 0xA5, 0x16, 0xA0, 0x37, 0x12, 0xD0, 0x66,
+    0x6B, 0x93, 0x82, 0x57, 0x97, 0xEE, 0xC6, 0x74, 0xB7, 0x9E, 0xEF, 0xA8, 0x25, 0x29, 0x50, 0x8D,
+    0x46, 0x8A, 0x54, 0x01, 0x49, 0xD8, 0x69, 0x03, 0x0B, 0x77, 0x96, 0xF9, 0x5F, 0xFD, 0x72, 0xDA,
+    0xDC, 0x88, 0xBB, 0xA0, 0x97, 0xE7, 0x3C, 0xD8, 0xE5, 0x33, 0xA1, 0x6A, 0x9C, 0xE4, 0x5F, 0x44,
+    0x92, 0xF1, 0xE6, 0xA7, 0xC7, 0xB1, 0xD4, 0x03, 0x4D, 0x2B, 0xDD, 0xB8, 0x80, 0x24, 0xCD, 0x46,
+    0x92, 0x86, 0x7C, 0x6D, 0xDB, 0xFD, 0xCD, 0x28, 0xFD, 0x19, 0xB0, 0x29, 0x67, 0x9F, 0x76, 0x46,
+    0xF6, 0xFE, 0xD2, 0x12, 0x5C, 0xAA, 0xE2, 0xFF, 0x28, 0x61, 0xE6, 0x24, 0x9F, 0x59, 0x76, 0x9A,
+    0x90, 0x5C, 0x6A, 0x12, 0x12, 0x29, 0xB4, 0x6E, 0x62, 0x01, 0x1B, 0x36, 0x81, 0x09, 0x95, 0xB4,
+    0x6D, 0x9F, 0x93, 0xBA, 0xDB, 0x24, 0x26, 0xCC, 0xA5, 0xC7, 0x69, 0x4C, 0xC6, 0xF7, 0x81, 0xE1,
+    0xB8, 0xEF, 0xC8, 0x15, 0xC9, 0x6F, 0x54, 0x4D, 0x7E, 0xE3, 0xB3, 0x23, 0xD2, 0x4C, 0xAF, 0x15,
+    0x77, 0x22, 0x9D, 0x3B, 0xB3, 0x9E, 0x1F, 0x37, 0x0B, 0x8C, 0xD0, 0xEF, 0x78, 0x81, 0xAC, 0x9F,
+    0xD8, 0x51, 0xDD, 0xDE, 0x48, 0x2B, 0xA7, 0xFF, 0x99, 0xC2, 0xE6, 0x06, 0x6C, 0x38, 0x74, 0xFE,
+    0x6B, 0xAB, 0x91, 0x34, 0x38, 0x29, 0x1A, 0x49, 0x8D, 0xC3, 0x86, 0x7C, 0x2A, 0x16, 0xAA, 0x9B,
+    0x1B, 0xFC, 0xCB, 0xFA, 0x5D, 0x62, 0x7E, 0xA0, 0xA1, 0xD6, 0x50, 0x48, 0x4D, 0xAB, 0x78, 0x77,
+    0x73, 0xD2, 0x43, 0x3C, 0xF0, 0x99, 0x0B, 0x57, 0xA5, 0xB9, 0x96, 0xF2, 0x9F, 0x3E, 0x3A, 0x54,
+    0x9F, 0x9E, 0xD1, 0xBA, 0xF9, 0x14, 0xB0, 0xD7, 0x02, 0x59, 0x6C, 0xA1, 0xFE, 0x46, 0xC0, 0xCC,
+    0xEB, 0x7B, 0xD5, 0x43, 0xBF, 0xCA, 0xC1, 0x65, 0xC7, 0xC9, 0xB5, 0x50, 0x69, 0xA1, 0x55, 0xCC,
+    0xCF, 0x56, 0x01, 0xAC, 0x3F, 0xF4, 0x99, 0x3E, 0x4F, 0x65, 0x66, 0x5F, 0x3F, 0x7E, 0x99, 0xD3,
+    0x55, 0x40, 0x2B, 0xF4, 0x67, 0x71, 0xD6, 0x67, 0xF1, 0x0C, 0xF6, 0xB5, 0x99, 0xF6, 0xAB, 0xC3,
+    0xA6, 0x12, 0x63, 0x77, 0x6E, 0x81, 0xB6, 0x4E, 0x68, 0xF4, 0x27, 0xF1, 0x97, 0x06, 0x7D, 0x55,
+    0x70, 0x6B, 0x19, 0x41, 0x85, 0xAE, 0x08, 0xCA, 0xB9, 0x8D, 0xCE, 0x43, 0xFB, 0x0D, 0x3D, 0x36,
+    0x81, 0x89, 0xFD, 0x4F, 0x16, 0xA0, 0x7E, 0x75, 0xED, 0x3B, 0xC8, 0xA4, 0x37, 0x47, 0xC0, 0x6E,
+    0x18, 0xA9, 0x4F, 0x18, 0xB0, 0xD8, 0xAC, 0xBD, 0x4D, 0xD8, 0xB3, 0x4E, 0xC8, 0xC9, 0x26, 0xCA,
+    0xBB, 0x90, 0x14, 0x21, 0xD7, 0x77, 0x6F, 0x28, 0x80, 0x26, 0x3D, 0xAA, 0x8E, 0x76, 0xB1, 0xC1,
+    0x2D, 0xD4, 0x7A, 0x58, 0xDB, 0x89, 0xC4, 0x8C, 0xC9, 0xC0, 0x2F, 0x27, 0xBD, 0x91, 0x7D, 0x65,
+    0x02, 0xC8, 0x97, 0xFE, 0x17, 0x21, 0xD8, 0xF3, 0xF9, 0x73, 0x07, 0xCF, 0x1D, 0x6E, 0xCA, 0xD9,
+    0x75, 0x8B, 0x0D, 0xB8, 0x6F, 0xCE, 0xD5, 0xB5, 0x08, 0xAA, 0xAF, 0xCE, 0x82, 0xF2, 0x46, 0x74,
+    0xAD, 0x07, 0xF7, 0xE6, 0x37, 0x14, 0x00, 0x45, 0x45, 0xA0, 0xD0, 0x9B, 0xDA, 0x92, 0x52, 0x0F,
+    0x94, 0xD2, 0xB2, 0xF9, 0x8A, 0x09, 0x32, 0xBD, 0xB9, 0x6A, 0x80, 0x7E, 0xD6, 0x37, 0xD4, 0xE0,
+    0x56, 0x1B, 0xDD, 0x42, 0xA5, 0x4E, 0x0F, 0x6B, 0x82, 0x7C, 0xBA, 0x84, 0x09, 0x91, 0xE2, 0xAD,
+    0xF8, 0x81, 0x6B, 0x9D, 0x3D, 0x0E, 0x4E, 0x0D, 0x4E, 0x9E, 0x0F, 0x97, 0x43, 0x4A, 0xB0, 0x4E,
+    0x7A, 0xDC, 0x56, 0xF6, 0xB9, 0xEF, 0xD2, 0xC6, 0xEA, 0xB7, 0xDC, 0x9B, 0xAD, 0xD4, 0x17, 0x16,
+    0x6A, 0x45, 0x9C, 0x02, 0xF7, 0xEF, 0x30, 0xBB, 0xBD, 0x16, 0x70, 0xD6, 0xE7, 0xB1, 0xDF, 0xB9,
+    0xE2, 0x7C, 0x81, 0x4F, 0x5C, 0x4A, 0x12, 0xBD, 0xDC, 0x63, 0xD6, 0x44, 0x71, 0xE4, 0x23, 0x77,
+    0xD9, 0x86, 0x36, 0x62, 0x34, 0x70, 0xF0, 0xC6, 0xF6, 0x75, 0x45, 0x24, 0x7F, 0xF7, 0xD7, 0x22,
+    0xF4, 0x0D, 0xCE, 0x53, 0x8D, 0x98, 0x05, 0xDA, 0x99, 0xEC, 0x09, 0xBF, 0x95, 0x2F, 0x8B, 0x67,
+    0x62, 0x2E, 0x75, 0xB5, 0x02, 0x7D, 0x84, 0x7F, 0xB1, 0xD5, 0x1B, 0x14, 0xAC, 0x62, 0x7E, 0x7E,
+    0x85, 0xBE, 0xC9, 0x44, 0xBE, 0x92, 0xA9, 0xA1, 0x9D, 0x38, 0xD0, 0x83, 0xF5, 0x98, 0x50, 0x1C,
+    0x8B, 0xA5, 0x16, 0x23, 0x51, 0xAF, 0xF0, 0x07, 0xB7, 0xB6, 0x43, 0x9E, 0x32, 0x65, 0x37, 0x7F,
+    0x79, 0xDB, 0x7A, 0x24, 0x0D, 0x5A, 0xB6, 0xE2, 0x1A, 0x3B, 0x65, 0x11, 0xF9, 0x32, 0x58, 0xE1,
+    0xBA, 0x7E, 0x66, 0x29, 0x34, 0x14, 0xA1, 0x15, 0xF5, 0x33, 0x37, 0x23, 0x8B, 0xBB, 0x30, 0x16,
+    0x6F, 0x47, 0x35, 0xF5, 0x9B, 0xD7, 0x23, 0x5A, 0xEA, 0x60, 0x34, 0xAA, 0xAB, 0x54, 0x2C, 0xF4,
+    0xC1, 0x05, 0xA3, 0x46, 0xBE, 0x9A, 0xCB, 0x15, 0x38, 0xF0, 0x99, 0x66, 0x63, 0xCE, 0x66, 0x0E,
+    0x9D, 0xB8, 0x73, 0x0B, 0x4C, 0x30, 0x33, 0xD1, 0x2C, 0x9C, 0x31, 0xA2, 0x7E, 0x44, 0xDE, 0x5E,
+    0xD5, 0x68, 0xDE, 0x5E, 0xA7, 0xEC, 0xDD, 0x18, 0xB9, 0x1C, 0x1D, 0x6E, 0xA9, 0x3A, 0xBB, 0xD8,
+    0xA1, 0x58, 0x4C, 0xC8, 0xD7, 0x2C, 0x72, 0x9E, 0x2F, 0x00, 0xCE, 0xFA, 0xE4, 0x03, 0xEC, 0x6B,
+    0x33, 0xB4, 0x5F, 0x1D, 0xFF, 0x7F, 0xCA, 0x6B, 0xB2, 0xE9, 0x34, 0x66, 0x5A, 0x7E, 0xC6, 0x98,
+    0xFE, 0xAF, 0x6A, 0xF1, 0xF6, 0x5A, 0x80, 0xE2, 0xAD, 0x08, 0x79, 0xEC, 0x81, 0xF5, 0x0E, 0x51,
+    0x55, 0x22, 0x94, 0xCA, 0xC4, 0x55, 0x29, 0x60, 0xE7, 0x7C, 0xC5, 0x4E, 0x38, 0x5F, 0x4E, 0x94,
+    0xC1, 0xCC, 0xE4, 0x31, 0x8B, 0xD0, 0x23, 0x70, 0xDE, 0x35, 0xD8, 0xB1, 0x1A, 0x28, 0xA7, 0x72,
+    0xA2, 0x88, 0xB9, 0xCE, 0x3E, 0xB1, 0xD2, 0x6F, 0xD2, 0x1A, 0x35, 0x29, 0xAE, 0xB6, 0x52, 0x47,
+    0xAE, 0x1B, 0xB7, 0x42, 0xF5, 0xD5, 0x5B, 0x46, 0xFB, 0xFE, 0x67, 0xE3, 0xE4, 0x48, 0xA9, 0x80,
+    0x2E, 0x8C, 0x65, 0xB0, 0xDE, 0xE1, 0xF2, 0x89, 0x68, 0x7D, 0x39, 0xBA, 0x2F, 0x0A, 0x69, 0xCE,
+    0x25, 0x6F, 0x34, 0xA7, 0xDC, 0x35, 0xEB, 0xC7, 0x44, 0x6A, 0x3A, 0x09, 0xBB, 0x3E, 0x31, 0xE7,
+    0xC2, 0x79, 0xE7, 0x4D, 0x2C, 0x27, 0x9C, 0x97, 0x14, 0x2B, 0x49, 0x4F, 0xEB, 0xFC, 0xC9, 0xA9,
+    0x1E, 0x73, 0xE5, 0xFA, 0x63, 0x0D, 0xB5, 0x14, 0x77, 0xBC, 0xE8, 0x90, 0x80, 0x5A, 0xFF, 0x7A,
+    0xE2, 0x41, 0x4B, 0x05, 0xB3, 0xF6, 0x5D, 0x4F, 0xB4, 0xDE, 0x5E, 0x4D, 0xBA, 0xCD, 0x67, 0xE6,
+    0xFB, 0x83, 0xD3, 0x9A, 0x34, 0x35, 0x63, 0x52, 0x37, 0x39, 0xDB, 0x51, 0x7E, 0x7F, 0x86, 0xC5,
+    0x35, 0x54, 0xDF, 0x9D, 0x6E, 0x0F, 0x01, 0xBF, 0xC2, 0x11, 0xD9, 0x6B, 0x81, 0xB6, 0xF2, 0x66,
+    0x5E, 0xB1, 0x3F, 0x9C, 0x6F, 0x5D, 0xA2, 0xA3, 0x96, 0x37, 0x6B, 0xDF, 0xD5, 0xDE, 0x11, 0x89,
+    0xA5, 0x14, 0x9C, 0xD4, 0xAD, 0x07, 0xA3, 0x49, 0x14, 0x23, 0x56, 0x23, 0xE5, 0x8D, 0x7D, 0x5B,
+    0x4F, 0x4B, 0x5D, 0x5D, 0x4F, 0xC6, 0xBA, 0x6D, 0x7C, 0x71, 0x63, 0xF9, 0xA5, 0x75, 0xB1, 0x5B,
+    0x1C, 0x6F, 0x15, 0x00, 0x8A, 0xB5, 0x1F, 0x01, 0xFA, 0x04, 0xB9, 0x8B, 0x90, 0xE8, 0xE1, 0xC3,
+    0x09, 0x3D, 0x90, 0x9D, 0xF8, 0xEC, 0x94, 0x7C, 0xCC, 0xCE, 0xF5, 0x6F, 0x88, 0x2D, 0xDF, 0x26,
+    0x51, 0x0D, 0x40, 0x3D, 0xE5, 0x4A, 0x24, 0xBF, 0x26, 0xF6, 0x21, 0x18, 0xE5, 0x16, 0x3E, 0xAA,
+    0x4D, 0xC1, 0x5C, 0xEA, 0x4E, 0xFC, 0x4C, 0x74, 0xB4, 0x95, 0x77, 0x2F, 0x8D, 0x9B, 0xDB, 0xFB,
+    0x48, 0x43, 0xBB, 0xF2, 0xD0, 0x4E, 0xCE, 0xD3, 0x1C, 0xFC, 0xDA, 0x50, 0x2A, 0x40, 0x24, 0x5B,
+    0x8A, 0xAF, 0xAD, 0x46, 0x2B, 0xF5, 0xAD, 0xC5, 0x4B, 0xAA, 0xD9, 0x42, 0xEA, 0xF8, 0xF1, 0xF9,
+    0xC7, 0x3F, 0x60, 0xBA, 0xEF, 0xA3, 0x56, 0x9B, 0x7F, 0x49, 0xB5, 0x5A, 0xF5, 0xFE, 0x6A, 0x35,
+    0x0E, 0x7C, 0xE6, 0x1C, 0xA5, 0x44, 0x26, 0x05, 0x0E, 0x1D, 0xFF, 0xB9, 0xAB, 0x1D, 0x71, 0x8D,
+    0x1D, 0x8A, 0x91, 0x9E, 0x48, 0x11, 0xEA, 0x0E, 0x77, 0x2C, 0x60, 0xE6, 0x4B, 0x49, 0x04, 0x93,
+    0x6B, 0x4A, 0x14, 0x30, 0xF2, 0x5B, 0xA2, 0xB8, 0xAB, 0xF7, 0x9B, 0x98, 0x24, 0x30, 0x85, 0x46,
+    0xE8, 0xE7, 0xED, 0x5D, 0xB2, 0xE9, 0x52, 0xCA, 0x2C, 0x8A, 0xB7, 0x22, 0xC8, 0xF9, 0xF7, 0xB9,
+    0xE8, 0x25, 0xAA, 0x24, 0x99, 0x6B, 0x39, 0x83, 0x99, 0xAC, 0xC7, 0x5D, 0x9D, 0xC9, 0xA3, 0x83,
+    0xEA, 0xD5, 0x21, 0x55, 0xED, 0xAC, 0x9A, 0x44, 0x14, 0x17, 0xFB, 0xF4, 0x7E, 0xAA, 0x53, 0x71,
+    0x9F, 0x3C, 0x46, 0x01, 0x5C, 0x84, 0x22, 0xD9, 0xD5, 0x9E, 0xED, 0xA8, 0xBF, 0x3C, 0x62, 0x5F,
+    0x99, 0x28, 0xFF, 0xFA, 0x03, 0x6C, 0xCD, 0x61, 0x07, 0x3B, 0x14, 0x63, 0x1E, 0x4D, 0xA0, 0xCD,
+    0x67, 0xEC, 0x10, 0xD3, 0x54, 0xD5, 0xA6, 0x24, 0xBE, 0xD8, 0x71, 0x1E, 0x6E, 0x4C, 0xD7, 0x33,
+    0x73, 0x9A, 0xE8, 0x85, 0x05, 0xDA, 0x35, 0xF1, 0xD5, 0x69, 0x9E, 0xF9, 0x39, 0x3E, 0x8F, 0x1D,
+    0xF3, 0x88, 0xF3, 0x65, 0x40, 0xD4, 0xEF, 0x0F, 0x3F, 0x3F, 0xCF, 0xDD, 0x0D, 0x3D, 0x75, 0x43,
+    0x4B, 0x0B, 0xAE, 0x59, 0xC0, 0x7D, 0x71, 0x86, 0xFA, 0x5A, 0x80, 0xEA, 0xBB, 0xE3, 0xB6, 0xC5,
+    0x56, 0xCD, 0xB6, 0xC7, 0x45, 0x64, 0xDB, 0xE4, 0x32, 0x6C, 0x06, 0x7C, 0x9F, 0xFC, 0x46, 0x30,
+    0xB8, 0xC8, 0xFE, 0x3E, 0xAF, 0xD4, 0x1E, 0xD7, 0x95, 0x21, 0x71, 0x01, 0xF9, 0x73, 0x7C, 0xE1,
+    0xE7, 0x42, 0x14, 0xEB, 0xCD, 0x04, 0x0B, 0x67, 0xA0, 0x0C, 0xD6, 0x43, 0x9B, 0xCF, 0x24, 0xD5,
+    0x13, 0xEE, 0xCB, 0x03, 0x98, 0x25, 0x49, 0xBD, 0x9B, 0x4D, 0xF8, 0x84, 0x8D, 0x6C, 0x94, 0x41,
+    0x1A, 0x4B, 0x62, 0x4B, 0x9D, 0x87, 0xBC, 0x9F, 0x48, 0x4B, 0x92, 0xE4, 0x4F, 0x6C, 0xD8, 0xDF,
+    0x59, 0x5F, 0xBC, 0x95, 0x04, 0xC6, 0xE9, 0xC8, 0x3C, 0xC4, 0x29, 0xE3, 0xAD, 0xBF, 0xC8, 0x6C,
+    0x9B, 0xFA, 0xE1, 0x60, 0xC2, 0x43, 0xB4, 0xC6, 0xDB, 0x71, 0xEF, 0xFE, 0x25, 0x11, 0xCE, 0x91,
+    0xFE, 0xD9, 0x8E, 0x6C, 0xDA, 0xD7, 0xC5, 0x9D, 0xA1, 0x78, 0x79, 0x72, 0x8F, 0xBD, 0x1C, 0xDB,
+    0xE4, 0xB7, 0x3F, 0x69, 0x33, 0xFF, 0x94, 0xCD, 0x87, 0xDF, 0xA9, 0xB2, 0x97, 0x63, 0xA1, 0xD1,
+    0xDE, 0x6C, 0x48, 0xAA, 0x89, 0xEE, 0x97, 0x10, 0x7A, 0x7F, 0xB0, 0x04, 0x44, 0x5B, 0x25, 0xC2,
+    0x85, 0x4D, 0xD3, 0xB6, 0x07, 0xA0, 0x25, 0x57, 0x34, 0x23, 0x66, 0xA0, 0xF0, 0x94, 0x1E, 0xDB,
+    0x51, 0x25, 0x29, 0x48, 0x83, 0x6B, 0x28, 0x93, 0xF0, 0x7C, 0x73, 0x74, 0xD5, 0xF5, 0x00, 0xF4,
+    0xB5, 0xE7, 0x7D, 0x30, 0xFA, 0xFB, 0x75, 0x53, 0x74, 0x89, 0xD4, 0xBD, 0x0B, 0xCC, 0xCC, 0x04,
+    0x76, 0x30, 0x1E, 0x5A, 0x2A, 0xC8, 0x23, 0x33, 0xD8, 0xC1, 0x0C, 0xE0, 0xA8, 0xBE, 0x42, 0x16,
+    0xE9, 0xD5, 0xD8, 0xD1, 0x48, 0x8D, 0xEB, 0x6C, 0x73, 0x39, 0x5B, 0x38, 0x9D, 0xCD, 0x65, 0xC8,
+    0x83, 0x1D, 0x9C, 0xB7, 0x57, 0xFA, 0x6C, 0xA5, 0xD5, 0x5C, 0xCE, 0xB9, 0xE4, 0xDD, 0x60, 0x35,
+    0xD1, 0xDF, 0xDA, 0xED, 0x6B, 0x81, 0x7C, 0xBE, 0x0C, 0xEE, 0xD9, 0x91, 0xE2, 0xA7, 0xEF, 0x7F,
+    0x26, 0xEE, 0x6E, 0x20, 0x9B, 0xB2, 0x8E, 0x8A, 0x23, 0xE4, 0xC1, 0x74, 0xEC, 0xF1, 0x02, 0x66,
+    0xB0, 0x70, 0x0A, 0x8D, 0xA5, 0xAF, 0xD4, 0xCD, 0xF9, 0x70, 0xB1, 0x6A, 0x8E, 0x94, 0x4F, 0x4F,
+    0xE6, 0xCF, 0x26, 0x47, 0xAB, 0x22, 0x94, 0xEA, 0xCE, 0xEC, 0x2E, 0x13, 0xA8, 0x7D, 0x22, 0x84,
+    0xCD, 0x9C, 0x45, 0x70, 0xBE, 0x6D, 0xC8, 0xD7, 0x6A, 0x00, 0xFB, 0xCE, 0xBC, 0x63, 0x80, 0x4B,
+    0xF9, 0x1D, 0x8D, 0x62, 0x56, 0x00, 0x05, 0x12, 0x30, 0x4D, 0x59, 0x97, 0x59, 0x7B, 0x0F, 0xBA,
+    0xBE, 0x82, 0x0B, 0xEE, 0xA7, 0xD8, 0x98, 0x2B, 0x18, 0x51, 0xA9, 0x01, 0x34, 0xEF, 0x32, 0xFE,
+    0x94, 0xF6, 0x65, 0x21, 0x0F, 0x35, 0xC5, 0x37, 0x03, 0xF6, 0xCD, 0x84, 0x3C, 0xDB, 0x86, 0x3C,
+    0x42, 0x3D, 0x93, 0x2B, 0x50, 0xBF, 0x34, 0x66, 0xB1, 0x0E, 0x95, 0x6F, 0x87, 0x5D, 0xA7, 0xC6,
+    0xA1, 0x13, 0x27, 0x9C, 0x56, 0xA7, 0x65, 0xFF, 0xC1, 0x81, 0x13, 0x27, 0x4E, 0xFC, 0x53, 0x49,
+    0x8B, 0xD3, 0x7E, 0x96, 0x2C, 0x49, 0xBA, 0x26, 0x49, 0xAA, 0xA5, 0x4D, 0x41, 0x03, 0xD8, 0x6E,
+    0xE6, 0x74, 0x31, 0xE4, 0xA1, 0xC6, 0x76, 0x33, 0x47, 0xCD, 0x90, 0x87, 0x0A, 0xEB, 0x23, 0x47,
+    0xCD, 0x90, 0x85, 0x8A, 0xD2, 0x5F, 0x64, 0xCF, 0x8C, 0xD9, 0x54, 0x35, 0xDB, 0x43, 0x26, 0xDB,
+    0x14, 0xFE, 0x14, 0xCE, 0x04, 0x26, 0xDB, 0x15, 0xFE, 0x14, 0x64, 0x27, 0x4E, 0x9C, 0x38, 0x51,
+    0x48, 0x5A, 0x4A, 0x6D, 0xB1, 0x67, 0x3F, 0x45, 0xD6, 0x54, 0x4B, 0x0A, 0x87, 0x4E, 0x9C, 0x38,
+    0x71, 0x1C, 0x90, 0x77, 0x63, 0x15, 0xEC, 0x54, 0x44, 0xB3, 0xE4, 0x2B, 0xA4, 0x62, 0x98, 0xF3,
+    0xE5, 0x8C, 0xA8, 0x83, 0x59, 0xDE, 0xEF, 0x33, 0xD0, 0x7E, 0x4F, 0x8D, 0x0B, 0xEA, 0x6C, 0x68,
+    0x7D, 0x39, 0xBB, 0xC1, 0x44, 0x1B, 0x72, 0x95, 0x33, 0x3A, 0xB6, 0xC0, 0x73, 0x70, 0x06, 0xEA,
+    0x04, 0x9C, 0x47, 0xB2, 0x09, 0x2E, 0x26, 0xE1, 0x85, 0x8C, 0x74, 0x55, 0x7A, 0x4B, 0x33, 0x9C,
+    0xDE, 0x7D, 0xA4, 0x18, 0xC9, 0x27, 0x88, 0xBB, 0xE2, 0xA8, 0xF5, 0x98, 0x40, 0x36, 0xC3, 0x25,
+    0x70, 0x50, 0x76, 0x30, 0xC0, 0x6F, 0x6F, 0x5D, 0x26, 0x6C, 0x32, 0xB1, 0xBD, 0x54, 0x6A, 0xB5,
+    0x7E, 0xBF, 0x38, 0x54, 0xA6, 0x87, 0xBD, 0x42, 0x91, 0x72, 0xD2, 0x86, 0x98, 0x9A, 0x36, 0xB6,
+    0xAA, 0x4F, 0x31, 0x72, 0x77, 0xFF, 0x57, 0xF4, 0x9A, 0x0B, 0x29, 0x50, 0x6F, 0x85, 0xAE, 0x90,
+    0x34, 0xD3, 0x17, 0x93, 0xB4, 0xDD, 0x74, 0xF0, 0xB7, 0xD9, 0xEF, 0xFE, 0x21, 0x3F, 0x7F, 0xFE,
+    0x1C, 0xED, 0xAE, 0xEA, 0x2C, 0xAD, 0xD4, 0xC9, 0x13, 0x2C, 0xF4, 0x89, 0x05, 0x8D, 0x99, 0x24,
+    0xEF, 0xA4, 0xB9, 0x90, 0xD4, 0x49, 0x9A, 0x2A, 0x49, 0x8F, 0x28, 0xA1, 0x18, 0x95, 0x92, 0x02,
+    0x3C, 0x65, 0x16, 0xBB, 0xB4, 0xEF, 0xEA, 0xD1, 0x0E, 0xF2, 0x73, 0x95, 0x57, 0x31, 0xBB, 0x71,
+    0xFF, 0xC1, 0xBD, 0x47, 0x8F, 0x02, 0x1C, 0x4F, 0xE5, 0x95, 0xA3, 0x44, 0xCC, 0xFF, 0x2C, 0x3D,
+    0xD5, 0xEF, 0x5F, 0x82, 0xFF, 0xF8, 0xE9, 0x81, 0x3C, 0x9E, 0x81, 0xE2, 0xDA, 0xBE, 0xAE, 0x3B,
+    0x00, 0x75, 0x03, 0xF9, 0x44, 0x1A, 0x7E, 0x16, 0x3F, 0xFE, 0xF7, 0xB1, 0x57, 0xBF, 0xF2, 0x1F,
+    0x88, 0xF7, 0xFC, 0xF9, 0x60, 0x87, 0x4F, 0x7D, 0x8A, 0x95, 0x17, 0x5E, 0x38, 0x78, 0x6E, 0x67,
+    0x5C, 0x31, 0x13, 0xF5, 0x68, 0x22, 0x7D, 0x57, 0xA5, 0x9D, 0x05, 0x74, 0x7D, 0xCD, 0x54, 0xC6,
+    0x7C, 0xB5, 0x93, 0x89, 0x36, 0x94, 0xB3, 0x1B, 0xAA, 0xD0, 0x7B, 0x37, 0x24, 0xF6, 0xE3, 0x9E,
+    0x7C, 0x78, 0xB2, 0x3E, 0x16, 0xA2, 0x2B, 0x86, 0x79, 0xAF, 0xBC, 0x12, 0x4E, 0xD9, 0x47, 0x12,
+    0x78, 0xC9, 0x46, 0x97, 0x4D, 0xB6, 0x3B, 0x05, 0x50, 0x16, 0x9F, 0x7E, 0x2D, 0xC4, 0x8B, 0x95,
+    0x3D, 0xF6, 0xCD, 0x0D, 0xD9, 0xFC, 0x46, 0xD1, 0x7D, 0x7D, 0xCF, 0x5E, 0x9D, 0x5C, 0xE9, 0xE7,
+    0xEA, 0xD8, 0x70, 0xB1, 0x7C, 0x7A, 0x4C, 0x05, 0x9F, 0x83, 0x0D, 0x55, 0x47, 0x3F, 0x14, 0x37,
+    0xA7, 0xFA, 0x95, 0x05, 0xA0, 0xCB, 0x42, 0x3E, 0x9B, 0xA9, 0x18, 0x4D, 0x40, 0xD8, 0x90, 0xCD,
+    0x3C, 0x48, 0x0E, 0xFC, 0x26, 0xA6, 0x63, 0xA1, 0x1C, 0x69, 0x29, 0x43, 0x31, 0x9B, 0x48, 0xE4,
+    0x21, 0x72, 0x36, 0xF5, 0x20, 0x5B, 0x2F, 0xCC, 0x4E, 0x30, 0xBB, 0xB1, 0xA5, 0xF2, 0xED, 0x37,
+    0x22, 0xB4, 0x03, 0x75, 0xF2, 0xBA, 0xEA, 0xA0, 0x9E, 0x8A, 0x05, 0xB0, 0xB1, 0x9A, 0x00, 0xBB,
+    0xF4, 0x03, 0x98, 0x9B, 0x12, 0x0B, 0xE5, 0x4F, 0x14, 0xB3, 0x88, 0x7D, 0x5B, 0xC1, 0x44, 0xAA,
+    0xEF, 0x6B, 0x34, 0x91, 0xFB, 0xFE, 0x44, 0xE1, 0xE0, 0x73, 0xE0, 0x92, 0x56, 0x26, 0x1D, 0xA2,
+    0x52, 0x4F, 0x08, 0xA8, 0x17, 0xAB, 0x06, 0x34, 0x95, 0xF2, 0x14, 0x1A, 0x0A, 0x0D, 0x54, 0x4A,
+    0x58, 0x61, 0x5F, 0xA1, 0x9D, 0x16, 0xBD, 0x08, 0x3B, 0xE7, 0x75, 0xDB, 0x5D, 0xBD, 0x8F, 0xFE,
+    0x3E, 0x06, 0x47, 0xE0, 0x34, 0x5C, 0x84, 0x48, 0x36, 0x61, 0x76, 0x52, 0x70, 0x3B, 0xEC, 0x94,
+    0x0B, 0x0D, 0x0E, 0x2C, 0x64, 0x77, 0x38, 0xD4, 0x83, 0xCF, 0x61, 0x27, 0xEC, 0x44, 0x1D, 0x70,
+    0x81, 0x3E, 0x6C, 0x1A, 0x58, 0xD3, 0x6C, 0xED, 0x19, 0x17, 0x37, 0x33, 0x39, 0x39, 0x81, 0xE4,
+    0xD1, 0xCD, 0x89, 0x4F, 0x44, 0x07, 0x67, 0xAC, 0xA7, 0x3E, 0x16, 0xB0, 0x2F, 0xCF, 0x98, 0xB0,
+    0xA4, 0xC4, 0xEF, 0x72, 0xDF, 0xE0, 0xD4, 0x50, 0xA9, 0x49, 0x7E, 0x73, 0x17, 0xC9, 0xDC, 0xB0,
+    0x75, 0x7A, 0xDC, 0x7E, 0x3B, 0xBC, 0x49, 0x1E, 0x6C, 0x80, 0x32, 0x6E, 0xC2, 0x65, 0x79, 0xE8,
+    0x03, 0x1C, 0x7E, 0x1E, 0x38, 0x74, 0xE2, 0x71, 0xA7, 0xA5, 0x55, 0x7C, 0x80, 0x17, 0x7B, 0xBD,
+    0xAC, 0x35, 0x53, 0x07, 0xF7, 0x02, 0x4F, 0x76, 0xD8, 0xFF, 0xD6, 0x61, 0xD7, 0x84, 0xA9, 0x9C,
+    0xE0, 0xD0, 0xB7, 0x3B, 0xFE, 0xEB, 0x2B, 0xFF, 0xFD, 0x43, 0xEF, 0x28, 0xD6, 0xEA, 0xC7, 0x72,
+    0x6E, 0x5F, 0xAF, 0xA5, 0xE9, 0x53, 0xFF, 0xE3, 0xDF, 0x7C, 0xD8, 0x74, 0xB7, 0x3A, 0xDE, 0xE6,
+    0x9D, 0xD1, 0x5B, 0xBF, 0xE9, 0x2B, 0xB8, 0xB4, 0xD3, 0x31, 0x15, 0xE3, 0xEE, 0x75, 0xC7, 0x56,
+    0x32, 0x37, 0xD3, 0xAE, 0x69, 0xAF, 0xEE, 0x48, 0x75, 0xC8, 0x2C, 0xEE, 0xB6, 0xC4, 0x0E, 0x3B,
+    0x39, 0xC1, 0xAD, 0x0E, 0x3E, 0x38, 0xD0, 0x90, 0x29, 0xD2, 0xAE, 0xE4, 0x92, 0x97, 0x42, 0xB6,
+    0x3E, 0x32, 0xB5, 0xDD, 0xC2, 0xC7, 0x39, 0x73, 0x37, 0x55, 0x07, 0x55, 0x47, 0x31, 0x42, 0x99,
+    0x1C, 0x96, 0x49, 0x4E, 0x2B, 0x8B, 0x29, 0x57, 0x5E, 0x52, 0x78, 0x58, 0xC9, 0xFA, 0x8E, 0x6A,
+    0xA5, 0x50, 0x87, 0x5D, 0x30, 0x6A, 0x30, 0x91, 0x6C, 0x4D, 0x62, 0x91, 0xBE, 0x01, 0x35, 0x38,
+    0x0F, 0xAE, 0xA3, 0x1A, 0xE1, 0xEF, 0xC2, 0xC1, 0x0F, 0x04, 0x54, 0x6D, 0x1A, 0xBF, 0xEB, 0xB0,
+    0x23, 0x54, 0x23, 0xC5, 0x04, 0x76, 0xC2, 0x2C, 0x90, 0x3F, 0xBF, 0xF5, 0x3A, 0xEC, 0xB7, 0x08,
+    0x72, 0x17, 0x95, 0x3C, 0xBF, 0x8E, 0x14, 0xD8, 0xCB, 0xD6, 0x47, 0x26, 0xF6, 0x38, 0x97, 0xCD,
+    0x9C, 0x86, 0x6C, 0x26, 0x92, 0x94, 0x43, 0x98, 0x29, 0x9F, 0xA0, 0x08, 0x26, 0x80, 0x1D, 0x4D,
+    0x80, 0xDE, 0x97, 0x23, 0xA5, 0xB0, 0x03, 0x6E, 0xA6, 0xF2, 0x38, 0x4F, 0xDD, 0xD1, 0x76, 0xD8,
+    0x86, 0xBE, 0x21, 0xDF, 0x6A, 0xC4, 0xD9, 0xF8, 0xFE, 0xE3, 0x2C, 0x02, 0x26, 0x62, 0x47, 0x8A,
+    0x48, 0x35, 0x62, 0x67, 0xDC, 0x40, 0x35, 0x73, 0xB8, 0xC3, 0x4D, 0x00, 0x87, 0xCF, 0xED, 0x7F,
+    0xF6, 0xC3, 0x07, 0x8E, 0x43, 0x76, 0x35, 0x69, 0xDA, 0x35, 0x83, 0x5B, 0x8A, 0x40, 0x76, 0xB3,
+    0x29, 0x3D, 0xA5, 0xA7, 0x6E, 0x70, 0x10, 0xC9, 0x66, 0x4C, 0xC0, 0x0E, 0x49, 0xC0, 0x93, 0x47,
+    0xB2, 0x99, 0x76, 0xC0, 0x0E, 0xF5, 0x02, 0x2E, 0x93, 0x27, 0x8B, 0xE5, 0x0C, 0xF9, 0xE8, 0x3C,
+    0xE4, 0x8D, 0xF6, 0x9B, 0xC3, 0xF8, 0xCD, 0xF7, 0xC0, 0x8F, 0x73, 0xC9, 0x3B, 0x2C, 0x90, 0xAB,
+    0x98, 0xC0, 0x46, 0xE7, 0xA1, 0x1F, 0x05, 0x46, 0xFF, 0xFA, 0xF9, 0xDB, 0xDB, 0xFD, 0xC8, 0x87,
+    0x7D, 0x01, 0x6A, 0x3E, 0xDD, 0x2A, 0x76, 0x5F, 0xBC, 0xA5, 0x47, 0x75, 0x70, 0xF0, 0x6C, 0x36,
+    0x83, 0x6B, 0xAC, 0x27, 0x8F, 0x9C, 0x06, 0x1B, 0x4C, 0x80, 0xD6, 0xD7, 0xCD, 0xCE, 0x00, 0x93,
+    0xF1, 0x25, 0x1A, 0xDA, 0x04, 0x36, 0x27, 0xBD, 0x7B, 0x6F, 0xBC, 0x75, 0x91, 0xF9, 0x16, 0xC2,
+    0x5B, 0x9C, 0x87, 0xE2, 0x2D, 0x01, 0xEE, 0x1F, 0x3E, 0xB7, 0xA1, 0xCA, 0xCD, 0xC9, 0xF5, 0xB7,
+    0x7E, 0xC8, 0x75, 0xFB, 0x6D, 0xA8, 0x76, 0x24, 0x95, 0x72, 0x52, 0xDC, 0xDA, 0x45, 0xAD, 0x7C,
+    0xFC, 0xE4, 0x37, 0xAF, 0xFD, 0xE3, 0xFF, 0xFD, 0xBB, 0xFF, 0xE5, 0x95, 0xEB, 0x8B, 0x1D, 0x80,
+    0x0F, 0xE7, 0xBE, 0xCE, 0x9F, 0x7F, 0xF0, 0x7B, 0xF2, 0x47, 0x09, 0x3C, 0x6E, 0xD6, 0x82, 0xB2,
+    0xB1, 0x13, 0x47, 0x3E, 0xFA, 0xA2, 0x0B, 0x75, 0xC7, 0xA1, 0x6C, 0x35, 0xCD, 0xDD, 0x8D, 0x9D,
+    0x1F, 0x78, 0xF0, 0xC1, 0x23, 0x55, 0x38, 0xD8, 0x1C, 0xFA, 0x27, 0xF2, 0x96, 0x27, 0x8D, 0xFF,
+    0x04, 0xA1, 0xEC, 0x8E, 0x00, 0x59, 0x34, 0xFF, 0xA8, 0xF8, 0x0D, 0x33, 0xDF, 0xF3, 0xD4, 0x83,
+    0x47, 0xDC, 0x9C, 0xDA, 0x09, 0xEF, 0xF9, 0xD0, 0xDF, 0xF9, 0xD0, 0xAF, 0x3F, 0x68, 0x63, 0xF6,
+    0xE2, 0x3F, 0x08, 0xBB, 0x62, 0x4D, 0xF6, 0xD7, 0x0B, 0x56, 0x0B, 0xEE, 0xE6, 0x9C, 0x2F, 0x26,
+    0xD8, 0xC1, 0x76, 0x8E, 0x33, 0xF9, 0x9C, 0x4F, 0x76, 0xB0, 0xDE, 0x35, 0x6D, 0x1E, 0x4D, 0xB4,
+    0xC1, 0x8E, 0x6D, 0xD7, 0x37, 0xF9, 0x78, 0xCF, 0xEF, 0x3C, 0xF4, 0xB9, 0x4F, 0xBD, 0xF0, 0xAF,
+    0x5E, 0x78, 0x32, 0xB4, 0x83, 0xEB, 0xEE, 0x82, 0xE3, 0xD6, 0xFF, 0x21, 0x4F, 0xE6, 0xDE, 0xF2,
+    0x94, 0x8D, 0xED, 0x98, 0xCF, 0xE5, 0x7F, 0xE6, 0x1E, 0x1E, 0xE2, 0x45, 0x13, 0x2A, 0xEF, 0xA6,
+    0x36, 0xE4, 0xF3, 0xC1, 0x7F, 0xCE, 0x87, 0xB2, 0x7F, 0x69, 0x26, 0x8E, 0xD4, 0x93, 0x1B, 0x81,
+    0x8F, 0x19, 0xEF, 0xCC, 0x53, 0x9F, 0xFC, 0xBE, 0xAE, 0x9C, 0x26, 0x80, 0x59, 0x4A, 0xEC, 0x78,
+    0xE0, 0x29, 0x9E, 0xAA, 0x83, 0xEB, 0x80, 0xDE, 0xFC, 0xA0, 0xC4, 0x4E, 0xD5, 0xA9, 0x07, 0x1F,
+    0x3C, 0x72, 0xA4, 0x0E, 0x07, 0x1B, 0x32, 0x5D, 0x79, 0x82, 0x27, 0x8D, 0x7F, 0x80, 0x50, 0x76,
+    0x47, 0x53, 0x99, 0xE0, 0xFB, 0xFE, 0x8F, 0xC2, 0x03, 0x2F, 0x98, 0xD9, 0x7C, 0x39, 0xBF, 0xEA,
+    0xFB, 0xF1, 0xEE, 0xB3, 0x64, 0x31, 0xFB, 0x4E, 0x37, 0x9C, 0xFB, 0xED, 0x4F, 0xDE, 0x73, 0x29,
+    0x13, 0xA6, 0x93, 0xFF, 0x48, 0x03, 0xE4, 0x0D, 0xB8, 0x8E, 0x7C, 0x86, 0x3A, 0xB5, 0x2D, 0xDA,
+    0x01, 0xB6, 0x92, 0x82, 0x6B, 0x52, 0xCD, 0xD1, 0xC3, 0xE5, 0xE4, 0x24, 0xAA, 0x5B, 0x0F, 0x77,
+    0x68, 0x25, 0x26, 0x4F, 0x54, 0x79, 0x68, 0xB7, 0xA7, 0xD3, 0x56, 0xA7, 0xEC, 0x40, 0x49, 0x77,
+    0x96, 0xBF, 0x08, 0x1F, 0xDD, 0xB4, 0x46, 0x1E, 0xD6, 0x94, 0x28, 0x56, 0x1E, 0xFA, 0xF4, 0x70,
+    0x77, 0x8D, 0x90, 0xBC, 0xC4, 0x36, 0x8E, 0x33, 0xE9, 0xB7, 0x5D, 0xBA, 0xA2, 0x6B, 0x30, 0xF3,
+    0x7E, 0x5F, 0xA5, 0x6B, 0xDE, 0xA7, 0xBD, 0xF2, 0x2F, 0x01, 0x1E, 0x78, 0x08, 0x38, 0x72, 0x0A,
+    0x38, 0xF5, 0x22, 0x30, 0x05, 0xC8, 0xDE, 0x1E, 0x37, 0xB6, 0x62, 0x6B, 0x90, 0xF4, 0x54, 0x92,
+    0xA7, 0x5D, 0x8F, 0x82, 0xE2, 0x29, 0xCC, 0xFA, 0xE2, 0x44, 0x11, 0xDF, 0x0A, 0xD8, 0x77, 0x5F,
+    0x1B, 0xB0, 0xEF, 0x5C, 0xF7, 0x54, 0x37, 0xBF, 0xD1, 0x51, 0xEB, 0x31, 0xA8, 0x55, 0x7F, 0x9D,
+    0x5A, 0x0A, 0x54, 0x52, 0x48, 0xF0, 0xA9, 0x90, 0x46, 0x8C, 0x34, 0x60, 0xAE, 0x7B, 0x28, 0x9F,
+    0x6D, 0xC0, 0x56, 0xBB, 0xCB, 0xBF, 0x47, 0x1F, 0xD8, 0x6E, 0xFA, 0xC0, 0xE2, 0x7D, 0xF4, 0x81,
+    0x37, 0xBD, 0x9D, 0xAA, 0x98, 0x29, 0xBF, 0xD1, 0xD4, 0x61, 0x8F, 0x5C, 0xDF, 0xF9, 0xCE, 0x7B,
+    0xF4, 0x81, 0x6D, 0xD2, 0xCA, 0xEF, 0xE7, 0xCB, 0xC7, 0xA1, 0x54, 0x43, 0xA5, 0x09, 0x3B, 0xB6,
+    0x98, 0x81, 0x5D, 0xDB, 0xA3, 0xCF, 0x4E, 0x7E, 0xE5, 0x78, 0xC2, 0x89, 0xA9, 0xD1, 0xB6, 0xC1,
+    0x76, 0x29, 0xAA, 0x14, 0x13, 0xD4, 0x11, 0x2A, 0xAD, 0x4D, 0x99, 0x3A, 0xEC, 0x96, 0xFD, 0xD0,
+    0xDE, 0x37, 0xE5, 0x08, 0xEA, 0xEC, 0x40, 0xA6, 0xAE, 0xF2, 0xE4, 0xF2, 0x75, 0x87, 0x91, 0x77,
+    0x0D, 0x85, 0x86, 0x16, 0x4A, 0x8D, 0x3D, 0x58, 0x8D, 0x2B, 0x95, 0x76, 0x59, 0x80, 0x66, 0xDC,
+    0xF5, 0x77, 0x92, 0xD2, 0x3E, 0x80, 0xD2, 0xFF, 0x67, 0x34, 0x92, 0xEB, 0x11, 0x79, 0x8C, 0x32,
+    0x79, 0x0A, 0x65, 0xEA, 0xE0, 0xEE, 0xF3, 0x0D, 0x58, 0xCD, 0x50, 0x69, 0x81, 0xBA, 0x6B, 0xB1,
+    0x92, 0xE2, 0x61, 0x9D, 0xEF, 0x9F, 0xE3, 0x72, 0x26, 0x50, 0x9A, 0x69, 0x24, 0x97, 0x42, 0x52,
+    0x05, 0x15, 0xEB, 0xD9, 0xCD, 0x19, 0xDA, 0xB0, 0x2B, 0x1E, 0xD7, 0x23, 0x5B, 0x03, 0x51, 0xCA,
+    0xEC, 0x13, 0x87, 0x94, 0xA4, 0xF7, 0xE6, 0x5B, 0x33, 0x90, 0x85, 0x0A, 0xE0, 0xC5, 0xC2, 0x03,
+    0x47, 0xF3, 0x11, 0xB0, 0x4C, 0x54, 0x53, 0xF1, 0xED, 0x48, 0xB5, 0xE6, 0x5A, 0x29, 0x1B, 0xB4,
+    0x92, 0x7B, 0x5A, 0x75, 0x5C, 0xA6, 0x7E, 0x25, 0x60, 0x67, 0x3B, 0x5E, 0x84, 0x93, 0xC7, 0x26,
+    0xD7, 0x60, 0xBE, 0xB7, 0xD8, 0x21, 0xFF, 0xF6, 0xDC, 0x17, 0x53, 0xAE, 0xE8, 0xAE, 0x2E, 0x68,
+    0x39, 0x70, 0xFC, 0xC4, 0x56, 0xCF, 0x06, 0xF2, 0x91, 0xA2, 0x33, 0x01, 0xDB, 0x99, 0x11, 0xDB,
+    0x98, 0x91, 0x0A, 0x33, 0xF2, 0x09, 0xCC, 0xF8, 0xC2, 0x51, 0xAA, 0x5D, 0x6F, 0xF9, 0xF4, 0x6B,
+    0x3F, 0x5C, 0x6E, 0x1C, 0x37, 0x3F, 0x5C, 0x02, 0xE6, 0xCD, 0x35, 0xA4, 0x7E, 0x17, 0xA3, 0x76,
+    0xC0, 0xAC, 0xAD, 0xC7, 0xC4, 0xB6, 0xA3, 0x88, 0x6D, 0x43, 0x31, 0x39, 0x28, 0x82, 0x03, 0x3E,
+    0xDF, 0xA4, 0x3C, 0xF0, 0x2E, 0x24, 0xBF, 0x97, 0xE9, 0xB3, 0xE3, 0xD1, 0x7C, 0xCA, 0xC3, 0x45,
+    0x33, 0x66, 0x63, 0x34, 0x7F, 0xF6, 0xF4, 0x38, 0x17, 0xDF, 0xB8, 0xF6, 0x72, 0xB0, 0xCF, 0x5E,
+    0xBB, 0x1A, 0xEC, 0x63, 0x5F, 0xBA, 0x36, 0x56, 0xB6, 0x29, 0x86, 0xBA, 0xEA, 0xAC, 0xDF, 0xB3,
+    0x63, 0xED, 0x8F, 0x5A, 0xA9, 0xFB, 0x78, 0x2E, 0x35, 0xF0, 0x91, 0x0B, 0x00, 0x77, 0xEF, 0x5C,
+    0x7F, 0x2A, 0x1A, 0xC6, 0x94, 0xC2, 0x17, 0x37, 0x47, 0xE8, 0xD5, 0x50, 0x7E, 0x27, 0xC2, 0x91,
+    0x72, 0x24, 0x1F, 0xEA, 0x06, 0x4B, 0x84, 0xA3, 0xF7, 0x87, 0xD4, 0x91, 0x90, 0x6B, 0x81, 0x7C,
+    0x0D, 0xFB, 0x99, 0xD7, 0x88, 0xB4, 0x5F, 0xE7, 0x2D, 0x34, 0x60, 0xB7, 0x5A, 0x60, 0x79, 0xE3,
+    0x00, 0xC5, 0x0C, 0x95, 0x22, 0x56, 0xE2, 0x60, 0xFF, 0x6E, 0x47, 0xDD, 0x81, 0xFD, 0xF1, 0x39,
+    0x6A, 0x45, 0x2A, 0x89, 0xBB, 0xFB, 0xAD, 0xB1, 0xA5, 0x48, 0x9B, 0xDD, 0x51, 0x6B, 0x20, 0xEB,
+    0xD3, 0xEF, 0x1F, 0x3E, 0x7F, 0xFE, 0xFC, 0x7B, 0xDA, 0x7C, 0xBF, 0x97, 0x78, 0xA6, 0x5C, 0x81,
+    0x52, 0x13, 0x56, 0x3E, 0xC9, 0x72, 0x9E, 0xBD, 0xE9, 0x31, 0x1A, 0x37, 0x0D, 0xFE, 0xD9, 0xF4,
+    0xA1, 0x0B, 0x21, 0x29, 0x0E, 0x52, 0x56, 0x90, 0x9F, 0x3F, 0xCB, 0x66, 0x73, 0xB4, 0x5B, 0x8D,
+    0x5E, 0x33, 0xD6, 0x5B, 0x4F, 0x2B, 0x49, 0x4D, 0x3E, 0x17, 0xFB, 0xFD, 0x4C, 0xAD, 0x44, 0xB2,
+    0xBC, 0xAD, 0xB5, 0xA9, 0xFD, 0xD1, 0x7E, 0x1A, 0x9D, 0x20, 0x6F, 0x7B, 0x4B, 0xC5, 0x90, 0x58,
+    0xAD, 0x76, 0x77, 0x28, 0xEF, 0xDD, 0x05, 0x55, 0xDB, 0x6D, 0x61, 0x2C, 0x0F, 0xC0, 0x05, 0x9D,
+    0xC5, 0x49, 0x5D, 0x21, 0x2D, 0xB4, 0xFA, 0xF1, 0x0B, 0x46, 0x35, 0xD4, 0x21, 0x82, 0xCC, 0x48,
+    0x39, 0x57, 0x0D, 0x6E, 0xB8, 0xD4, 0xA0, 0x5C, 0xFA, 0x74, 0xB4, 0x5A, 0xEA, 0x71, 0xAF, 0x9F,
+    0xFA, 0x2B, 0xA1, 0x7F, 0x44, 0xDF, 0xFD, 0xEE, 0x5C, 0x48, 0x1A, 0xEC, 0xE6, 0x09, 0x66, 0x0E,
+    0xEA, 0xC6, 0x0E, 0x15, 0x8E, 0xDC, 0x06, 0x68, 0xFF, 0x0F, 0x6D, 0x96, 0x3F, 0xC8, 0xDF, 0xC6,
+    0x1D, 0xC6, 0x3F, 0xBA, 0x8B, 0xAD, 0x62, 0x41, 0x2F, 0x43, 0x13, 0x42, 0x32, 0x68, 0xE9, 0xDA,
+    0xA8, 0x43, 0xC7, 0xFA, 0xBD, 0xB3, 0x43, 0xE9, 0x90, 0xC5, 0x43, 0xDE, 0xD0, 0xA1, 0x10, 0x0A,
+    0xA5, 0x43, 0x3B, 0x78, 0x75, 0xE1, 0x7D, 0x2D, 0x25, 0x81, 0x76, 0xC8, 0xE0, 0xB7, 0x10, 0xDA,
+    0x2D, 0xF6, 0x90, 0x40, 0xF2, 0x76, 0xC8, 0xD2, 0xC1, 0x01, 0xDB, 0xBA, 0xD6, 0xD0, 0x0C, 0x1E,
+    0xAC, 0x24, 0xB4, 0x6B, 0x14, 0xE2, 0xE0, 0x06, 0x0A, 0x39, 0x52, 0xA5, 0x91, 0xDD, 0x93, 0x9E,
+    0x0E, 0xFA, 0xD9, 0x4E, 0xA1, 0x02, 0x1D, 0xE2, 0x38, 0x7D, 0xFF, 0x3D, 0xF7, 0x3C, 0xDF, 0x2F,
+    0xBC, 0x18, 0x80, 0x52, 0x33, 0x60, 0xB5, 0x02, 0x26, 0x08, 0x80, 0xF6, 0xC1, 0x5A, 0x4A, 0x52,
+    0x76, 0x92, 0x34, 0x9F, 0xD8, 0xDF, 0xDF, 0xDF, 0x3F, 0xB7, 0xAD, 0x8D, 0x24, 0x25, 0x2F, 0x49,
+    0x43, 0x13, 0x8B, 0x08, 0xFE, 0x93, 0xF3, 0x23, 0x34, 0x52, 0x82, 0x4A, 0x9A, 0xA1, 0xE8, 0xD7,
+    0x8E, 0x87, 0xCF, 0x39, 0x8A, 0x84, 0x49, 0x3C, 0x93, 0x51, 0xB6, 0xFA, 0x67, 0xA5, 0xCE, 0xDD,
+    0x0E, 0xCD, 0x65, 0xFC, 0x79, 0xFC, 0x1E, 0xBE, 0xC7, 0xAB, 0xAB, 0x35, 0x18, 0x75, 0x4C, 0x14,
+    0x57, 0xB0, 0x92, 0x96, 0x62, 0x7F, 0x7F, 0xFF, 0xDC, 0x23, 0x23, 0x5E, 0x52, 0xF0, 0x92, 0xE8,
+    0xA5, 0x15, 0xDC, 0x08, 0xD4, 0x03, 0xD0, 0x44, 0xC0, 0x77, 0x40, 0x1B, 0x00, 0xB1, 0x5B, 0x8A,
+    0x15, 0xB0, 0x0B, 0x60, 0x33, 0x50, 0x65, 0xC0, 0x4D, 0x80, 0x95, 0x06, 0xAF, 0x5C, 0xBC, 0xF4,
+    0x59, 0xE0, 0x34, 0x4E, 0x0A, 0x52, 0x3A, 0xA9, 0xBF, 0x19, 0x25, 0x7C, 0xA6, 0x54, 0xE4, 0x17,
+    0x0B, 0x54, 0x23, 0xAC, 0x50, 0x8F, 0x18, 0x81, 0x4F, 0x98, 0x77, 0x00, 0x17, 0x21, 0x3F, 0x46,
+    0x7D, 0xB9, 0x33, 0x4A, 0x85, 0x56, 0xFA, 0x7B, 0xE7, 0x9C, 0xAE, 0x73, 0x59, 0xB1, 0xD2, 0x57,
+    0x67, 0x35, 0x1E, 0xFA, 0xB9, 0xF9, 0xCB, 0x4B, 0xE7, 0x93, 0xD1, 0x8C, 0xBF, 0x87, 0x7D, 0x73,
+    0x97, 0xC0, 0x9B, 0xC0, 0x04, 0x45, 0x82, 0x72, 0x81, 0x56, 0x01, 0x29, 0x5A, 0x29, 0x96, 0xBA,
+    0x1D, 0xAB, 0x2F, 0x6E, 0x47, 0x77, 0xFB, 0x52, 0xE7, 0x2E, 0xBF, 0x14, 0xEA, 0xA6, 0xA1, 0x69,
+    0x3C, 0x7E, 0x6F, 0x8F, 0xBD, 0xD3, 0x87, 0x1C, 0x1E, 0x64, 0xAE, 0x5F, 0xCB, 0x3C, 0x06, 0xC0,
+    0xA9, 0xE3, 0xB0, 0xC3, 0xAC, 0x90, 0x06, 0x58, 0x8B, 0x0C, 0x9E, 0x06, 0xEA, 0xE8, 0x22, 0x6E,
+    0xAC, 0x93, 0x91, 0x34, 0xD1, 0x4B, 0x99, 0x46, 0xCA, 0x38, 0x69, 0x82, 0xFA, 0x7E, 0xE0, 0x89,
+    0x97, 0xEE, 0xBD, 0x80, 0x93, 0x16, 0xAC, 0x24, 0xA0, 0xEF, 0x00, 0x3F, 0x02, 0xF5, 0x04, 0x60,
+    0x00, 0x0F, 0x26, 0x41, 0xDD, 0x41, 0x2E, 0xAE, 0x56, 0x7F, 0xD5, 0xD8, 0x4A, 0xCF, 0x69, 0x0D,
+    0xFE, 0x1E, 0xF4, 0x11, 0xDA, 0x61, 0x7B, 0x7D, 0x80, 0x1F, 0x3C, 0x82, 0x88, 0x22, 0x42, 0x13,
+    0x29, 0x15, 0xE9, 0x15, 0x9D, 0xF4, 0xF2, 0x7A, 0xD8, 0x5E, 0xFA, 0x30, 0x5D, 0x7B, 0xCA, 0xC5,
+    0xC0, 0x1E, 0x14, 0x13, 0x54, 0x11, 0x3C, 0x30, 0x83, 0xE9, 0x00, 0x13, 0xA0, 0xD9, 0xBC, 0x72,
+    0x91, 0x5F, 0x73, 0xBD, 0xD0, 0x9D, 0x6C, 0xA5, 0x99, 0xF3, 0x9A, 0x28, 0xFA, 0x04, 0xEA, 0x70,
+    0x33, 0x28, 0x60, 0x27, 0x28, 0xC3, 0xE6, 0xED, 0x6D, 0xB0, 0x69, 0xB3, 0xE7, 0xC2, 0xF6, 0xFF,
+    0x35, 0xEC, 0x99, 0xE9, 0x3B, 0xCD, 0xAB, 0x9F, 0xCC, 0xFE, 0xE3, 0xDB, 0xA9, 0x96, 0x70, 0x4A,
+    0x54, 0x0A, 0x94, 0xD3, 0xE6, 0x09, 0xE0, 0x29, 0xF8, 0x2E, 0x9C, 0x86, 0x03, 0xB8, 0x0A, 0x0D,
+    0x45, 0x3A, 0x79, 0xE4, 0x82, 0xFD, 0xBB, 0xF4, 0x87, 0xE8, 0xB4, 0xF6, 0x4A, 0xF5, 0x1A, 0x8A,
+    0x7E, 0xF6, 0x03, 0xD8, 0xEC, 0x12, 0xB8, 0x64, 0x32, 0xF8, 0x8E, 0x6B, 0xB0, 0x07, 0x8F, 0xC3,
+    0x63, 0x50, 0x74, 0x98, 0x99, 0x52, 0xA1, 0xD2, 0xE4, 0x3E, 0x6E, 0xDD, 0xFB, 0xEF, 0xC7, 0xB3,
+    0x63, 0x60, 0x82, 0x1F, 0x42, 0x0D, 0x55, 0x87, 0x1D, 0xE0, 0x2A, 0xD4, 0xEC, 0xBE, 0xBE, 0x57,
+    0x7F, 0xBB, 0xBA, 0x7B, 0x6B, 0x68, 0x35, 0x1A, 0x25, 0xEA, 0x04, 0x69, 0x8B, 0xE9, 0x97, 0x3C,
+    0xA9, 0x6C, 0xA5, 0x23, 0xB7, 0x82, 0x17, 0xAC, 0xEA, 0x6C, 0xEA, 0x07, 0x17, 0xDB, 0xC9, 0x87,
+    0x7A, 0xBC, 0xCA, 0x29, 0xEC, 0xEB, 0xE0, 0xF5, 0xBA, 0xE9, 0x95, 0xA8, 0x45, 0xA9, 0xD1, 0xEA,
+    0x86, 0xD1, 0x6F, 0x3F, 0x51, 0x77, 0xC3, 0x0F, 0xD5, 0x30, 0x70, 0x78, 0x02, 0x6A, 0xA8, 0x03,
+    0x2E, 0x1E, 0x94, 0xC3, 0x55, 0x9B, 0x26, 0x33, 0x25, 0x96, 0x44, 0x3F, 0x3E, 0xEE, 0x07, 0xAF,
+    0xD8, 0x2A, 0xB6, 0xEA, 0x78, 0x32, 0x50, 0x74, 0xB8, 0x8E, 0xBD, 0x67, 0x4D, 0x3A, 0x70, 0x5D,
+    0xBA, 0x66, 0x3F, 0x4A, 0xD5, 0xBB, 0xA1, 0xCE, 0xF8, 0x01, 0xE9, 0xAC, 0xD6, 0x52, 0xF3, 0xA9,
+    0xB0, 0xD5, 0x6C, 0x02, 0x2E, 0xEE, 0x20, 0xAA, 0x3B, 0x70, 0x92, 0x2A, 0x49, 0x37, 0xF3, 0x46,
+    0xCC, 0xD5, 0x48, 0x8A, 0xCD, 0x08, 0x26, 0xB3, 0xA1, 0xB9, 0xAB, 0x75, 0x80, 0xEA, 0xA7, 0x60,
+    0xBE, 0x4C, 0x20, 0xDF, 0xD1, 0xDE, 0x5D, 0xA9, 0x97, 0x7E, 0xAA, 0xFE, 0x73, 0xFB, 0xDD, 0x9B,
+    0xF9, 0x60, 0x5A, 0xF7, 0xDC, 0xE5, 0xF2, 0xCF, 0xDD, 0x97, 0xE9, 0x71, 0xEA, 0x3D, 0x30, 0x9F,
+    0x0E, 0x70, 0xFA, 0x00, 0xEC, 0xAD, 0x08, 0x07, 0x33, 0x54, 0x97, 0x80, 0x9F, 0x5F, 0x01, 0xA0,
+    0xDB, 0x85, 0xD2, 0xEE, 0x68, 0x58, 0xCC, 0x95, 0x24, 0x2B, 0x29, 0x81, 0x59, 0x5A, 0x69, 0x69,
+    0xA4, 0x0C, 0x65, 0xDE, 0x71, 0xFE, 0x00, 0xF8, 0x16, 0xF0, 0x55, 0x82, 0xEA, 0x52, 0xD8, 0x4C,
+    0xDA, 0x5B, 0x71, 0x73, 0x62, 0xFE, 0x35, 0x80, 0xDB, 0xC3, 0xC4, 0x7F, 0xA7, 0xEF, 0xFB, 0xE7,
+    0x2F, 0x57, 0x1F, 0x2C, 0x07, 0x5F, 0x2D, 0xA5, 0x6E, 0xA9, 0x73, 0x4B, 0x9B, 0x68, 0x3E, 0xCD,
+    0xD0, 0xFB, 0x40, 0xF1, 0xE5, 0x08, 0xF6, 0x27, 0x1B, 0x52, 0x26, 0xC0, 0x11, 0x13, 0x5C, 0xE3,
+    0x22, 0x78, 0x3C, 0x94, 0x63, 0xDD, 0xC1, 0xA6, 0x95, 0xAF, 0x49, 0xD2, 0xD7, 0x19, 0x8A, 0xD5,
+    0x4B, 0x92, 0x91, 0xB4, 0xD2, 0x8C, 0x76, 0xC1, 0xE4, 0x62, 0x81, 0x86, 0xD3, 0x60, 0xC2, 0x09,
+    0xA0, 0x0A, 0xD0, 0x76, 0x58, 0xDD, 0xC1, 0xF7, 0x8B, 0xBD, 0xA7, 0xE4, 0xEF, 0xFE, 0xC6, 0xEA,
+    0x0D, 0xAA, 0xF5, 0x02, 0xBC, 0x37, 0x62, 0xEE, 0x76, 0x54, 0x6F, 0xC0, 0xB3, 0x17, 0x38, 0xF1,
+    0xDE, 0x88, 0xEE, 0x76, 0x56, 0x6F, 0x60, 0xD6, 0x0B, 0x7F, 0x32, 0x8B, 0x26, 0x2B, 0x45, 0xAB,
+    0x01, 0x3B, 0xC1, 0xC9, 0x87, 0x24, 0x3C, 0xDC, 0x11, 0xFA, 0x54, 0xDE, 0x21, 0xE6, 0x3A, 0x28,
+    0x23, 0x4F, 0x3F, 0x97, 0xE8, 0x97, 0x89, 0x5E, 0x99, 0xFE, 0xB9, 0x15, 0x1F, 0xDA, 0x50, 0xC7,
+    0x3A, 0x56, 0x63, 0x35, 0x98, 0x5C, 0x25, 0xB6, 0x6B, 0x35, 0x61, 0x34, 0xC1, 0x33, 0x57, 0x76,
+    0x94, 0x0E, 0x50, 0xEA, 0x7C, 0x87, 0x91, 0x32, 0x78, 0x29, 0x62, 0x57, 0xA3, 0x0E, 0x3F, 0x34,
+    0xC2, 0x2C, 0x76, 0xCD, 0xB8, 0xD1, 0xBF, 0x96, 0x68, 0xED, 0xDC, 0x44, 0x9B, 0x7D, 0x27, 0xDC,
+    0x47, 0xB3, 0x9D, 0x69, 0xFB, 0xD0, 0x0C, 0x46, 0x53, 0x21, 0x2A, 0xBD, 0xDC, 0xCE, 0x34, 0x92,
+    0x22, 0xBD, 0xB4, 0x50, 0x4A, 0x1A, 0x37, 0x29, 0xB7, 0xA9, 0x5D, 0x03, 0xE6, 0x1B, 0x3A, 0x82,
+    0x8F, 0x9B, 0x5E, 0x17, 0x1A, 0xC0, 0xAF, 0xE0, 0xBE, 0x48, 0x98, 0xDC, 0x43, 0xFB, 0x7C, 0xA2,
+    0x1E, 0xDB, 0x60, 0x73, 0x39, 0xD3, 0x07, 0x1F, 0x9B, 0xD1, 0xE6, 0x32, 0xE3, 0xA3, 0x82, 0x5D,
+    0x6A, 0x49, 0x1F, 0x4A, 0xCA, 0x5E, 0x52, 0x67, 0x25, 0x21, 0x29, 0x9E, 0xBF, 0xAF, 0x23, 0x9B,
+    0x9A, 0x8E, 0xEC, 0x06, 0x6E, 0xD8, 0x84, 0x3F, 0x93, 0x71, 0xF1, 0x06, 0x65, 0xF2, 0x98, 0xD9,
+    0x45, 0x96, 0x72, 0xC4, 0xDB, 0x89, 0x3A, 0x66, 0xAA, 0xB1, 0xC5, 0x4E, 0x4D, 0xC7, 0xDB, 0xA7,
+    0x8E, 0x00, 0x70, 0x71, 0xD9, 0x36, 0x6E, 0x94, 0x89, 0x3A, 0x66, 0x6C, 0xF2, 0x81, 0xA5, 0x1C,
+    0x69, 0xBA, 0x4C, 0x99, 0x3C, 0xE4, 0x6A, 0xC4, 0x9F, 0xC9, 0x54, 0xA3, 0x87, 0xEC, 0x06, 0xBC,
+    0x99, 0xE9, 0xA5, 0xB1, 0x96, 0xB2, 0x39, 0x3E, 0x3E, 0x06, 0xAF, 0x05, 0xAF, 0x4C, 0x7B, 0xFC,
+    0x26, 0xBE, 0xDB, 0x7A, 0x97, 0x4B, 0x60, 0x27, 0x30, 0xBB, 0xC6, 0xE0, 0x06, 0xE8, 0xA1, 0x9C,
+    0xA1, 0x96, 0x68, 0xB4, 0xE2, 0xB5, 0xF0, 0xC4, 0xFE, 0x0B, 0x00, 0x27, 0x7B, 0x39, 0xA9, 0xD1,
+    0x31, 0xF0, 0xC4, 0x7E, 0x80, 0x4A, 0x13, 0xA0, 0x95, 0x4D, 0x8A, 0x29, 0x47, 0x80, 0x0C, 0xD0,
+    0x74, 0x6C, 0xF2, 0x08, 0x2B, 0x40, 0x1D, 0x01, 0x3B, 0x03, 0xF4, 0xC0, 0xE3, 0x6E, 0x04, 0x7B,
+    0x33, 0x03, 0x6D, 0xDF, 0x81, 0x55, 0x62, 0xAB, 0x34, 0x46, 0x11, 0xA8, 0xE7, 0x47, 0x68, 0xF4,
+    0x2F, 0x2F, 0x34, 0x7A, 0x77, 0x29, 0x24, 0x65, 0x37, 0xF8, 0xDF, 0xA5, 0xEB, 0x5C, 0xB0, 0x37,
+    0x93, 0x89, 0x8D, 0xEB, 0x9A, 0xDF, 0xCF, 0x5E, 0x52, 0x94, 0xB4, 0x14, 0xBA, 0xAF, 0xB1, 0xB8,
+    0x71, 0xF6, 0x1E, 0xC0, 0xD6, 0xAE, 0xDA, 0x11, 0xE8, 0x67, 0xA0, 0xFD, 0xD1, 0x83, 0x30, 0xEB,
+    0xC8, 0x96, 0xEA, 0x16, 0xA0, 0x99, 0x1F, 0x46, 0x7D, 0x91, 0xFF, 0x39, 0x53, 0xFD, 0x9F, 0x33,
+    0x3F, 0x13, 0x18, 0x09, 0x90, 0x3A, 0x68, 0x14, 0xA1, 0xD0, 0xA3, 0x69, 0xA3, 0x89, 0x6E, 0xAC,
+    0x66, 0xBB, 0x14, 0x0A, 0x0F, 0xF7, 0x16, 0xFA, 0xE0, 0x63, 0x9D, 0x5C, 0xDE, 0x18, 0xBC, 0x9A,
+    0xCE, 0x2F, 0xF5, 0x2B, 0xF3, 0x92, 0xDD, 0x07, 0x1A, 0x4F, 0x14, 0x2B, 0x40, 0x21, 0x73, 0xA5,
+    0x96, 0x8B, 0xF9, 0xF0, 0x46, 0x99, 0x94, 0xE0, 0xC6, 0x37, 0x6F, 0x24, 0xC5, 0x04, 0xD8, 0x71,
+    0xC7, 0x27, 0x3C, 0xC0, 0x35, 0x38, 0xF9, 0xC7, 0x07, 0x4D, 0xB6, 0x97, 0xDE, 0xDE, 0xB4, 0xA9,
+    0xC8, 0x40, 0x2F, 0x45, 0x23, 0x69, 0x38, 0xD9, 0xEB, 0xF8, 0x88, 0x95, 0x9D, 0x38, 0x56, 0xE9,
+    0x41, 0x76, 0x4F, 0x7C, 0xC3, 0xBA, 0x19, 0x80, 0x66, 0x04, 0xA3, 0x04, 0x8D, 0x02, 0x46, 0x33,
+    0x34, 0xEA, 0xC0, 0x67, 0xA0, 0xD6, 0x1D, 0xA8, 0xA5, 0x23, 0x38, 0x2F, 0x05, 0x38, 0xAF, 0x08,
+    0x45, 0x1F, 0x79, 0x8B, 0xE2, 0x08, 0xE9, 0x2D, 0x90, 0x34, 0x71, 0xE2, 0x57, 0xCA, 0x00, 0xFB,
+    0x9B, 0x61, 0x1B, 0x80, 0x72, 0x02, 0x2A, 0x05, 0x36, 0x6E, 0xE3, 0x15, 0xA0, 0xD4, 0x04, 0xB4,
+    0x19, 0x8A, 0x3E, 0x53, 0xF4, 0xCA, 0xF4, 0x5A, 0x83, 0xD1, 0x1A, 0xB0, 0x6B, 0x00, 0x7B, 0xC4,
+    0x93, 0xF0, 0x62, 0xAF, 0xE0, 0xB6, 0xD9, 0xEB, 0xF3, 0x73, 0x3B, 0xAB, 0x66, 0x2D, 0x84, 0xD5,
+    0x19, 0x45, 0xB3, 0x76, 0xEB, 0x11, 0x99, 0x43, 0x38, 0xC4, 0x53, 0x68, 0x37, 0xA0, 0xA9, 0xF3,
+    0x92, 0x06, 0x33, 0xB3, 0xC0, 0x42, 0x0B, 0x9E, 0x26, 0xD2, 0x44, 0x37, 0xE2, 0x92, 0x9D, 0xB0,
+    0xB3, 0xC9, 0x14, 0x0B, 0x82, 0x1E, 0xDF, 0xE1, 0x63, 0x3D, 0x6C, 0x01, 0xEF, 0xEA, 0xD3, 0x8C,
+    0xC2, 0xEA, 0xC7, 0x99, 0xE6, 0x1F, 0x4F, 0x5F, 0x21, 0x03, 0xE5, 0x00, 0x85, 0x96, 0x67, 0xA9,
+    0x94, 0x32, 0x5E, 0xEF, 0x8F, 0x34, 0x5D, 0x03, 0x0B, 0x19, 0x9B, 0xEC, 0x48, 0x13, 0xEB, 0x80,
+    0xC8, 0xD8, 0xD9, 0x26, 0xEA, 0xA1, 0x8E, 0xF4, 0xAC, 0xD8, 0xBC, 0xDD, 0x1E, 0xCC, 0x48, 0x35,
+    0xBB, 0x88, 0x86, 0x8B, 0x54, 0xF7, 0xCD, 0x84, 0xC7, 0xC5, 0x62, 0xE2, 0x22, 0xAD, 0xCE, 0x4E,
+    0x46, 0xD9, 0x45, 0xA7, 0x74, 0x91, 0x6A, 0x34, 0x13, 0x3E, 0xB8, 0x48, 0xA6, 0xA5, 0x4A, 0x66,
+    0xC2, 0x47, 0x17, 0x59, 0xF1, 0x94, 0x53, 0xB1, 0xC6, 0x26, 0x3A, 0xA1, 0x0D, 0x98, 0x07, 0x5C,
+    0xC3, 0x8D, 0xB4, 0xB1, 0xB9, 0x3B, 0xD1, 0x27, 0xFF, 0xF5, 0x82, 0x7F, 0xB3, 0xF9, 0xFC, 0x98,
+    0x26, 0xB8, 0x08, 0x2E, 0x96, 0xC3, 0x36, 0xC1, 0x6E, 0xB5, 0x54, 0xAC, 0x24, 0x29, 0xE1, 0x69,
+    0xBA, 0x99, 0x3A, 0xBA, 0xE1, 0x90, 0x6A, 0xB4, 0x53, 0x83, 0x9D, 0x8A, 0xEC, 0x62, 0x91, 0x51,
+    0x39, 0xD2, 0xE3, 0x5F, 0x99, 0xF0, 0x5D, 0x3D, 0x2C, 0xD4, 0x63, 0x95, 0x5A, 0xAA, 0xC9, 0xE6,
+    0x3A, 0xEE, 0x2E, 0xCD, 0x1D, 0xAA, 0xB9, 0xCC, 0xE5, 0x88, 0x86, 0x36, 0x79, 0xAA, 0xFB, 0xF6,
+    0x7E, 0xC8, 0x78, 0xEA, 0x50, 0x8E, 0xC5, 0x44, 0xC6, 0xD3, 0x4A, 0x8A, 0xD9, 0x48, 0x5A, 0xCB,
+    0xD1, 0x49, 0x9A, 0x3C, 0xD5, 0x68, 0x27, 0x32, 0x3E, 0xD4, 0xB1, 0x1C, 0xC9, 0xF4, 0x34, 0xA1,
+    0x4A, 0x76, 0x26, 0xE3, 0xA3, 0x1B, 0xCA, 0x91, 0x95, 0x9E, 0x26, 0x94, 0x93, 0xCD, 0x68, 0x6C,
+    0xA2, 0x1B, 0xAD, 0x3A, 0xD1, 0x86, 0x7A, 0xF9, 0x26, 0x21, 0x46, 0x1E, 0xD0, 0x18, 0x17, 0xD9,
+    0x46, 0x83, 0x4A, 0xAF, 0x6A, 0xC5, 0xEB, 0x96, 0x56, 0x0E, 0x8A, 0x53, 0xFD, 0x3B, 0x5C, 0x85,
+    0xEB, 0xD0, 0x1E, 0x91, 0xA1, 0x5E, 0xC9, 0x50, 0xF4, 0xAF, 0x4C, 0x40, 0x73, 0x33, 0x61, 0x3F,
+    0xEB, 0x6F, 0x26, 0x9C, 0x54, 0x2A, 0x7A, 0x2D, 0x95, 0xE2, 0x49, 0x1D, 0x95, 0xDA, 0x25, 0xF8,
+    0x5F,
 };
 
 static const EpdGlyph opendyslexic_10_bolditalicGlyphs[] = {
@@ -1735,7 +1706,7 @@ static const EpdGlyph opendyslexic_10_bolditalicGlyphs[] = {
     { 9, 19, 8, 1, 15, 43, 6287 }, // |
     { 14, 21, 15, -1, 16, 74, 6330 }, // }
     { 9, 5, 10, 4, 16, 12, 6404 }, // ~
-    { 0, 0, 18, 0, 0, 0, 0 }, //  
+    { 0, 0, 18, 0, 0, 0, 6416 }, //  
     { 11, 27, 11, 2, 23, 75, 0 }, // ¡
     { 12, 20, 16, 2, 16, 60, 75 }, // ¢
     { 17, 20, 14, 0, 19, 85, 135 }, // £
@@ -1746,625 +1717,631 @@ static const EpdGlyph opendyslexic_10_bolditalicGlyphs[] = {
     { 12, 5, 11, 3, 17, 15, 465 }, // ¨
     { 11, 9, 14, 6, 20, 25, 480 }, // ©
     { 8, 7, 14, 6, 16, 14, 505 }, // ª
-    { 15, 12, 17, 2, 12, 45, 519 }, // «
-    { 12, 8, 13, 2, 8, 24, 564 }, // ¬
-    { 12, 3, 13, 2, 8, 9, 588 }, // ­
-    { 11, 9, 14, 6, 23, 25, 597 }, // ®
-    { 10, 4, 11, 4, 16, 10, 622 }, // ¯
-    { 12, 10, 14, 4, 16, 30, 632 }, // °
-    { 16, 16, 17, 0, 12, 64, 662 }, // ±
-    { 8, 8, 7, 7, 17, 16, 726 }, // ²
-    { 8, 8, 7, 7, 17, 16, 742 }, // ³
-    { 7, 5, 6, 3, 16, 9, 758 }, // ´
-    { 17, 15, 18, -1, 12, 64, 767 }, // µ
-    { 16, 18, 16, 1, 15, 72, 831 }, // ¶
-    { 7, 5, 5, 1, 10, 9, 903 }, // ·
-    { 7, 7, 7, -1, 1, 13, 912 }, // ¸
-    { 6, 8, 6, 7, 17, 12, 925 }, // ¹
-    { 8, 7, 14, 6, 15, 14, 937 }, // º
-    { 15, 12, 16, -3, 12, 45, 951 }, // »
-    { 22, 20, 27, 2, 18, 110, 996 }, // ¼
-    { 23, 20, 27, 2, 18, 115, 1106 }, // ½
-    { 22, 19, 27, 2, 17, 105, 1221 }, // ¾
-    { 16, 26, 14, -2, 15, 104, 1326 }, // ¿
-    { 18, 24, 23, 1, 24, 108, 1430 }, // À
-    { 19, 28, 23, 1, 28, 133, 1538 }, // Á
-    { 19, 25, 23, 1, 25, 119, 1671 }, // Â
-    { 19, 25, 23, 1, 25, 119, 1790 }, // Ã
-    { 21, 25, 23, 1, 25, 132, 1909 }, // Ä
-    { 18, 25, 23, 1, 25, 113, 2041 }, // Å
-    { 29, 19, 28, 1, 18, 138, 2154 }, // Æ
-    { 18, 25, 20, 2, 19, 113, 2292 }, // Ç
-    { 18, 25, 19, 1, 25, 113, 2405 }, // È
-    { 18, 28, 19, 1, 28, 126, 2518 }, // É
-    { 18, 26, 19, 1, 26, 117, 2644 }, // Ê
-    { 19, 26, 19, 1, 26, 124, 2761 }, // Ë
-    { 12, 25, 11, 1, 25, 75, 2885 }, // Ì
-    { 13, 29, 11, 1, 29, 95, 2960 }, // Í
-    { 13, 26, 11, 1, 26, 85, 3055 }, // Î
-    { 15, 27, 11, 1, 27, 102, 3140 }, // Ï
-    { 21, 18, 21, 0, 18, 95, 3242 }, // Ð
-    { 21, 25, 21, 1, 25, 132, 3337 }, // Ñ
-    { 21, 25, 23, 2, 24, 132, 3469 }, // Ò
-    { 21, 28, 23, 2, 27, 147, 3601 }, // Ó
-    { 21, 26, 23, 2, 25, 137, 3748 }, // Ô
-    { 21, 26, 23, 2, 25, 137, 3885 }, // Õ
-    { 21, 26, 23, 2, 25, 137, 4022 }, // Ö
-    { 14, 7, 12, 0, 9, 25, 4159 }, // ×
-    { 41, 37, 23, -8, 28, 380, 4184 }, // Ø
-    { 21, 26, 21, 1, 25, 137, 4564 }, // Ù
-    { 21, 30, 21, 1, 29, 158, 4701 }, // Ú
-    { 21, 27, 21, 1, 26, 142, 4859 }, // Û
-    { 21, 28, 21, 1, 27, 147, 5001 }, // Ü
-    { 16, 30, 22, 6, 30, 120, 5148 }, // Ý
-    { 13, 17, 12, 1, 17, 56, 5268 }, // Þ
-    { 16, 18, 14, 0, 17, 72, 5324 }, // ß
-    { 14, 19, 18, 1, 19, 67, 5396 }, // à
-    { 15, 22, 18, 1, 22, 83, 5463 }, // á
-    { 15, 19, 18, 1, 19, 72, 5546 }, // â
-    { 15, 19, 18, 1, 19, 72, 5618 }, // ã
-    { 17, 20, 18, 1, 20, 85, 5690 }, // ä
-    { 14, 20, 18, 1, 20, 70, 5775 }, // å
-    { 23, 13, 26, 1, 13, 75, 5845 }, // æ
-    { 12, 18, 16, 2, 13, 54, 5920 }, // ç
-    { 14, 21, 18, 2, 21, 74, 5974 }, // è
-    { 15, 24, 18, 2, 24, 90, 6048 }, // é
-    { 15, 21, 18, 2, 21, 79, 6138 }, // ê
-    { 16, 22, 18, 2, 22, 88, 6217 }, // ë
-    { 10, 18, 9, 0, 18, 45, 6305 }, // ì
-    { 11, 22, 9, 0, 22, 61, 6350 }, // í
-    { 12, 19, 9, -1, 19, 57, 6411 }, // î
-    { 12, 18, 9, 0, 18, 54, 6468 }, // ï
-    { 20, 19, 14, 0, 18, 95, 6522 }, // ð
-    { 16, 20, 18, 1, 20, 80, 6617 }, // ñ
-    { 14, 18, 18, 2, 18, 63, 6697 }, // ò
-    { 14, 22, 18, 2, 22, 77, 6760 }, // ó
-    { 14, 19, 18, 2, 19, 67, 6837 }, // ô
-    { 14, 19, 18, 2, 19, 67, 6904 }, // õ
-    { 16, 19, 18, 2, 19, 76, 6971 }, // ö
-    { 16, 15, 19, 3, 15, 60, 7047 }, // ÷
-    { 24, 35, 18, -3, 24, 210, 7107 }, // ø
-    { 14, 18, 18, 2, 18, 63, 7317 }, // ù
-    { 14, 22, 18, 2, 22, 77, 7380 }, // ú
-    { 14, 19, 18, 2, 19, 67, 7457 }, // û
-    { 16, 20, 18, 2, 20, 80, 7524 }, // ü
-    { 17, 31, 19, 1, 25, 132, 7604 }, // ý
-    { 14, 22, 12, 0, 17, 77, 7736 }, // þ
-    { 18, 28, 19, 1, 22, 126, 7813 }, // ÿ
-    { 21, 25, 23, 1, 25, 132, 0 }, // Ā
-    { 17, 20, 18, 1, 20, 85, 132 }, // ā
-    { 21, 26, 23, 1, 26, 137, 217 }, // Ă
-    { 17, 20, 18, 1, 20, 85, 354 }, // ă
-    { 18, 24, 23, 1, 18, 108, 439 }, // Ą
-    { 14, 19, 18, 1, 13, 67, 547 }, // ą
-    { 18, 25, 20, 2, 25, 113, 614 }, // Ć
-    { 12, 18, 16, 2, 18, 54, 727 }, // ć
-    { 19, 27, 20, 2, 27, 129, 781 }, // Ĉ
-    { 15, 19, 16, 2, 19, 72, 910 }, // ĉ
-    { 18, 25, 20, 2, 25, 113, 982 }, // Ċ
-    { 13, 18, 16, 2, 18, 59, 1095 }, // ċ
-    { 20, 27, 20, 2, 27, 135, 1154 }, // Č
-    { 16, 20, 16, 2, 20, 80, 1289 }, // č
-    { 20, 27, 21, 1, 27, 135, 1369 }, // Ď
-    { 20, 18, 18, 2, 18, 90, 1504 }, // ď
-    { 21, 18, 21, 0, 18, 95, 1594 }, // Đ
-    { 20, 18, 18, 2, 18, 90, 1689 }, // đ
-    { 19, 26, 19, 1, 26, 124, 1779 }, // Ē
-    { 16, 22, 18, 2, 22, 88, 1903 }, // ē
-    { 19, 26, 19, 1, 26, 124, 1991 }, // Ĕ
-    { 17, 22, 18, 2, 22, 94, 2115 }, // ĕ
-    { 18, 26, 19, 1, 26, 117, 2209 }, // Ė
-    { 14, 22, 18, 2, 22, 77, 2326 }, // ė
-    { 18, 23, 19, 1, 18, 104, 2403 }, // Ę
-    { 14, 20, 18, 2, 12, 70, 2507 }, // ę
-    { 20, 28, 19, 1, 28, 140, 2577 }, // Ě
-    { 18, 24, 18, 2, 24, 108, 2717 }, // ě
-    { 21, 29, 24, 2, 29, 153, 2825 }, // Ĝ
-    { 19, 28, 18, 0, 21, 133, 2978 }, // ĝ
-    { 22, 28, 24, 2, 28, 154, 3111 }, // Ğ
-    { 19, 27, 18, 0, 20, 129, 3265 }, // ğ
-    { 19, 28, 24, 2, 28, 133, 3394 }, // Ġ
-    { 17, 27, 18, 0, 20, 115, 3527 }, // ġ
-    { 20, 31, 24, 2, 31, 155, 3642 }, // Ģ
-    { 17, 28, 18, 0, 21, 119, 3797 }, // ģ
-    { 20, 26, 21, 1, 26, 130, 3916 }, // Ĥ
-    { 15, 26, 18, 1, 26, 98, 4046 }, // ĥ
-    { 21, 18, 21, 1, 18, 95, 4144 }, // Ħ
-    { 15, 18, 18, 1, 18, 68, 4239 }, // ħ
-    { 14, 27, 11, 1, 27, 95, 4307 }, // Ĩ
-    { 12, 20, 9, 0, 20, 60, 4402 }, // ĩ
-    { 15, 27, 11, 1, 27, 102, 4462 }, // Ī
-    { 13, 19, 9, 0, 19, 62, 4564 }, // ī
-    { 12, 23, 11, -1, 18, 69, 4626 }, // Į
-    { 13, 25, 9, -2, 19, 82, 4695 }, // į
-    { 13, 27, 11, 1, 27, 88, 4777 }, // İ
-    { 8, 12, 9, 0, 12, 24, 4865 }, // ı
-    { 21, 26, 33, 6, 18, 137, 4889 }, // Ĳ
-    { 21, 24, 9, 0, 19, 126, 5026 }, // ĳ
-    { 22, 31, 18, 0, 26, 171, 5152 }, // Ĵ
-    { 18, 27, 13, 1, 21, 122, 5323 }, // ĵ
-    { 19, 29, 21, 1, 29, 138, 5445 }, // Ķ
-    { 15, 29, 19, -1, 18, 109, 5583 }, // ķ
-    { 12, 12, 14, -2, 12, 36, 5692 }, // ĸ
-    { 14, 24, 18, 1, 24, 84, 5728 }, // Ĺ
-    { 13, 27, 12, 1, 27, 88, 5812 }, // ĺ
-    { 14, 29, 18, 1, 18, 102, 5900 }, // Ļ
-    { 13, 29, 12, -2, 18, 95, 6002 }, // ļ
-    { 16, 18, 18, 1, 18, 72, 6097 }, // Ľ
-    { 16, 21, 12, 1, 21, 84, 6169 }, // ľ
-    { 16, 18, 18, 1, 18, 72, 6253 }, // Ŀ
-    { 13, 18, 12, 1, 18, 59, 6325 }, // ŀ
-    { 32, 30, 18, -10, 24, 240, 6384 }, // Ł
-    { 22, 18, 12, -7, 18, 99, 6624 }, // ł
-    { 21, 25, 21, 1, 25, 132, 6723 }, // Ń
-    { 15, 20, 18, 1, 20, 75, 6855 }, // ń
-    { 21, 27, 21, 1, 18, 142, 6930 }, // Ņ
-    { 15, 21, 18, 1, 13, 79, 7072 }, // ņ
-    { 22, 27, 21, 1, 27, 149, 7151 }, // Ň
-    { 19, 22, 18, 1, 22, 105, 7300 }, // ň
-    { 28, 21, 18, -12, 21, 147, 7405 }, // ŉ
-    { 21, 23, 21, 1, 18, 121, 7552 }, // Ŋ
-    { 15, 17, 18, 1, 13, 64, 7673 }, // ŋ
-    { 21, 26, 23, 2, 25, 137, 7737 }, // Ō
-    { 16, 19, 18, 2, 19, 76, 7874 }, // ō
-    { 21, 27, 23, 2, 26, 142, 7950 }, // Ŏ
-    { 16, 20, 18, 2, 20, 80, 8092 }, // ŏ
-    { 23, 25, 23, 2, 24, 144, 8172 }, // Ő
-    { 19, 18, 18, 2, 18, 86, 8316 }, // ő
-    { 28, 20, 25, 2, 19, 140, 8402 }, // Œ
-    { 22, 12, 22, 2, 12, 66, 8542 }, // œ
-    { 17, 25, 20, 1, 25, 107, 8608 }, // Ŕ
-    { 12, 17, 15, 1, 17, 51, 8715 }, // ŕ
-    { 17, 29, 20, 1, 29, 124, 8766 }, // Ŗ
-    { 13, 22, 15, 1, 22, 72, 8890 }, // ŗ
-    { 19, 26, 20, 1, 26, 124, 8962 }, // Ř
-    { 15, 19, 15, 1, 19, 72, 9086 }, // ř
-    { 18, 25, 22, 1, 25, 113, 9158 }, // Ś
-    { 14, 19, 18, 1, 18, 67, 9271 }, // ś
-    { 20, 26, 22, 1, 26, 130, 9338 }, // Ŝ
-    { 17, 20, 18, 1, 19, 85, 9468 }, // ŝ
-    { 18, 23, 22, 1, 18, 104, 9553 }, // Ş
-    { 14, 19, 18, 1, 13, 67, 9657 }, // ş
-    { 21, 26, 22, 1, 26, 137, 9724 }, // Š
-    { 18, 21, 18, 1, 20, 95, 9861 }, // š
-    { 17, 24, 21, 5, 18, 102, 9956 }, // Ţ
-    { 13, 22, 16, 2, 17, 72, 10058 }, // ţ
-    { 17, 26, 21, 5, 26, 111, 10130 }, // Ť
-    { 16, 20, 16, 4, 20, 80, 10241 }, // ť
-    { 17, 18, 21, 5, 18, 77, 10321 }, // Ŧ
-    { 13, 17, 16, 2, 17, 56, 10398 }, // ŧ
-    { 21, 28, 21, 1, 27, 147, 10454 }, // Ũ
-    { 15, 20, 18, 2, 20, 75, 10601 }, // ũ
-    { 21, 28, 21, 1, 27, 147, 10676 }, // Ū
-    { 16, 19, 18, 2, 19, 76, 10823 }, // ū
-    { 21, 28, 21, 1, 27, 147, 10899 }, // Ŭ
-    { 16, 20, 18, 2, 20, 80, 11046 }, // ŭ
-    { 21, 29, 21, 1, 28, 153, 11126 }, // Ů
-    { 14, 21, 18, 2, 21, 74, 11279 }, // ů
-    { 23, 27, 21, 1, 26, 156, 11353 }, // Ű
-    { 19, 19, 18, 2, 19, 91, 11509 }, // ű
-    { 21, 23, 21, 1, 18, 121, 11600 }, // Ų
-    { 14, 18, 18, 2, 12, 63, 11721 }, // ų
-    { 25, 26, 29, 5, 26, 163, 11784 }, // Ŵ
-    { 18, 22, 23, 4, 21, 99, 11947 }, // ŵ
-    { 16, 28, 22, 6, 28, 112, 12046 }, // Ŷ
-    { 17, 28, 19, 1, 22, 119, 12158 }, // ŷ
-    { 16, 28, 22, 6, 28, 112, 12277 }, // Ÿ
-    { 22, 24, 22, 1, 24, 132, 12389 }, // Ź
-    { 16, 20, 18, 1, 20, 80, 12521 }, // ź
-    { 22, 24, 22, 1, 24, 132, 12601 }, // Ż
-    { 16, 20, 18, 1, 20, 80, 12733 }, // ż
-    { 22, 26, 22, 1, 26, 143, 12813 }, // Ž
-    { 19, 21, 18, 1, 21, 100, 12956 }, // ž
-    { 12, 17, 13, 2, 17, 51, 13056 }, // ſ
-    { 8, 4, 0, 4, 16, 8, 0 }, // ̀
-    { 7, 5, 0, 3, 16, 9, 8 }, // ́
-    { 12, 6, 0, -1, 1, 18, 17 }, // ̂
-    { 9, 5, 0, 4, 16, 12, 35 }, // ̃
-    { 12, 4, 0, 4, 15, 12, 47 }, // ̄
-    { 15, 4, 0, 5, 19, 15, 59 }, // ̅
-    { 11, 6, 0, 4, 16, 17, 74 }, // ̆
-    { 6, 5, 0, 4, 17, 8, 91 }, // ̇
-    { 10, 4, 0, 3, 15, 10, 99 }, // ̈
-    { 5, 6, 0, 7, 14, 8, 109 }, // ̉
-    { 6, 5, 0, 4, 16, 8, 117 }, // ̊
-    { 17, 4, 0, 4, 16, 17, 125 }, // ̋
-    { 12, 6, 0, 4, 17, 18, 142 }, // ̌
-    { 18, 4, 0, -8, 16, 18, 160 }, // ̏
-    { 10, 8, 0, 2, 17, 20, 178 }, // ̒
-    { 10, 8, 0, 2, 16, 20, 198 }, // ̓
-    { 9, 8, 0, -5, 16, 18, 218 }, // ̔
-    { 6, 6, 0, 0, 0, 9, 236 }, // ̘
-    { 6, 6, 0, 1, 0, 9, 245 }, // ̙
-    { 10, 6, 0, 5, 17, 15, 254 }, // ̚
-    { 5, 7, 0, 3, 15, 9, 269 }, // ̛
-    { 5, 7, 0, -1, 0, 9, 278 }, // ̜
-    { 6, 6, 0, 2, 4, 9, 287 }, // ̝
-    { 6, 6, 0, -1, 0, 9, 296 }, // ̞
-    { 5, 5, 0, 0, -2, 7, 305 }, // ̟
-    { 12, 4, 0, -1, -2, 12, 312 }, // ̠
-    { 6, 5, 0, -3, 2, 8, 324 }, // ̣
-    { 11, 4, 0, -2, -1, 11, 332 }, // ̤
-    { 6, 5, 0, 4, 16, 8, 343 }, // ̥
-    { 10, 8, 0, -1, 4, 20, 351 }, // ̦
-    { 7, 7, 0, -1, 1, 13, 371 }, // ̧
-    { 7, 8, 0, 0, 2, 14, 384 }, // ̨
-    { 7, 7, 0, -2, -1, 13, 398 }, // ̩
-    { 10, 5, 0, -1, 0, 13, 411 }, // ̪
-    { 14, 6, 0, -1, 1, 21, 424 }, // ̬
-    { 13, 6, 0, -1, 1, 20, 445 }, // ̭
-    { 10, 6, 0, 5, 18, 15, 465 }, // ̰
-    { 11, 4, 0, 5, 18, 11, 480 }, // ̱
-    { 11, 4, 0, -1, -1, 11, 491 }, // ̲
-    { 11, 6, 0, 5, 18, 17, 502 }, // ̴
-    { 12, 3, 0, 1, 8, 9, 519 }, // ̵
-    { 5, 8, 0, 1, 1, 10, 528 }, // ̹
-    { 11, 7, 0, -3, 1, 20, 538 }, // ̺
-    { 10, 7, 0, -1, 1, 18, 558 }, // ̻
-    { 10, 6, 0, -1, 1, 15, 576 }, // ̼
-    { 7, 5, 0, 4, 16, 9, 591 }, // ̽
-    { 9, 5, 0, 4, 16, 12, 600 }, // ͂
-    { 5, 6, 0, 8, 19, 8, 612 }, // ̓
-    { 13, 15, 0, 3, 26, 49, 620 }, // ̈́
-    { 11, 5, 0, 3, 17, 14, 669 }, // ͆
-    { 14, 8, 0, -2, 0, 28, 683 }, // ͇
-    { 11, 7, 0, -1, 1, 20, 711 }, // ͈
-    { 9, 6, 0, -1, -1, 14, 731 }, // ͉
-    { 15, 17, 0, 3, 23, 64, 745 }, // ͊
-    { 21, 16, 0, 7, 24, 84, 809 }, // ͋
-    { 15, 13, 0, 11, 12, 49, 893 }, // ͌
-    { 11, 24, 0, 1, 8, 66, 942 }, // ͍
-    { 5, 4, 0, 10, 3, 5, 1008 }, // ͎
-    { 19, 5, 0, 0, 1, 24, 1013 }, // ͜
-    { 19, 6, 0, 3, 17, 29, 1037 }, // ͡
-    { 23, 7, 0, -1, 0, 41, 1066 }, // ͢
-    { 18, 25, 18, 1, 25, 113, 0 }, // Ѐ
-    { 19, 26, 19, 1, 26, 124, 113 }, // Ё
-    { 19, 20, 14, 2, 18, 95, 237 }, // Ђ
-    { 17, 25, 14, 0, 24, 107, 332 }, // Ѓ
-    { 18, 18, 17, 1, 16, 81, 439 }, // Є
-    { 18, 18, 22, 1, 18, 81, 520 }, // Ѕ
-    { 10, 18, 11, 1, 18, 45, 601 }, // І
-    { 14, 26, 11, 1, 26, 91, 646 }, // Ї
-    { 19, 23, 18, 0, 18, 110, 737 }, // Ј
-    { 23, 18, 24, 1, 16, 104, 847 }, // Љ
-    { 21, 17, 13, -4, 16, 90, 951 }, // Њ
-    { 17, 19, 21, 5, 19, 81, 1041 }, // Ћ
-    { 19, 24, 21, 1, 24, 114, 1122 }, // Ќ
-    { 19, 23, 20, 1, 23, 110, 1236 }, // Ѝ
-    { 18, 27, 17, 0, 25, 122, 1346 }, // Ў
-    { 18, 21, 17, 1, 16, 95, 1468 }, // Џ
-    { 18, 18, 23, 1, 18, 81, 1563 }, // А
-    { 15, 17, 14, 2, 16, 64, 1644 }, // Б
-    { 15, 16, 14, 1, 15, 60, 1708 }, // В
-    { 17, 17, 14, 0, 16, 73, 1768 }, // Г
-    { 18, 19, 17, 1, 16, 86, 1841 }, // Д
-    { 17, 18, 18, 1, 18, 77, 1927 }, // Е
-    { 30, 18, 31, 0, 18, 135, 2004 }, // Ж
-    { 14, 17, 13, 1, 16, 60, 2139 }, // З
-    { 19, 18, 20, 1, 18, 86, 2199 }, // И
-    { 19, 24, 20, 1, 24, 114, 2285 }, // Й
-    { 19, 18, 21, 1, 18, 86, 2399 }, // К
-    { 18, 18, 13, -1, 16, 81, 2485 }, // Л
-    { 21, 17, 18, 0, 16, 90, 2566 }, // М
-    { 20, 18, 21, 1, 18, 90, 2656 }, // Н
-    { 21, 19, 23, 2, 18, 100, 2746 }, // О
-    { 17, 17, 14, 0, 16, 73, 2846 }, // П
-    { 17, 18, 19, 1, 18, 77, 2919 }, // Р
-    { 18, 19, 20, 2, 19, 86, 2996 }, // С
-    { 17, 18, 21, 5, 18, 77, 3082 }, // Т
-    { 18, 18, 17, 0, 16, 81, 3159 }, // У
-    { 16, 16, 18, 4, 16, 64, 3240 }, // Ф
-    { 22, 18, 23, 1, 18, 99, 3304 }, // Х
-    { 17, 20, 15, 0, 16, 85, 3403 }, // Ц
-    { 14, 16, 14, 3, 16, 56, 3488 }, // Ч
-    { 19, 17, 17, 1, 16, 81, 3544 }, // Ш
-    { 19, 20, 19, 1, 16, 95, 3625 }, // Щ
-    { 14, 17, 13, -1, 16, 60, 3720 }, // Ъ
-    { 23, 19, 24, 1, 18, 110, 3780 }, // Ы
-    { 12, 17, 13, 1, 16, 51, 3890 }, // Ь
-    { 19, 18, 20, 1, 16, 86, 3941 }, // Э
-    { 20, 17, 19, 1, 16, 85, 4027 }, // Ю
-    { 18, 18, 18, 0, 18, 81, 4112 }, // Я
-    { 14, 13, 18, 1, 13, 46, 4193 }, // а
-    { 17, 20, 14, 2, 19, 85, 4239 }, // б
-    { 13, 12, 15, -1, 12, 39, 4324 }, // в
-    { 15, 13, 12, 0, 12, 49, 4363 }, // г
-    { 16, 15, 16, 1, 12, 60, 4412 }, // д
-    { 14, 12, 18, 2, 12, 42, 4472 }, // е
-    { 30, 15, 31, 0, 15, 113, 4514 }, // ж
-    { 10, 11, 9, -2, 11, 28, 4627 }, // з
-    { 16, 13, 14, 0, 12, 52, 4655 }, // и
-    { 15, 18, 13, 0, 18, 68, 4707 }, // й
-    { 15, 12, 17, -1, 12, 45, 4775 }, // к
-    { 13, 12, 9, -3, 11, 39, 4820 }, // л
-    { 16, 13, 18, -1, 13, 52, 4859 }, // м
-    { 17, 13, 17, -1, 13, 56, 4911 }, // н
-    { 14, 12, 18, 2, 12, 42, 4967 }, // о
-    { 16, 13, 14, 0, 12, 52, 5009 }, // п
-    { 19, 19, 20, -1, 13, 91, 5061 }, // р
-    { 12, 13, 16, 2, 13, 39, 5152 }, // с
-    { 14, 13, 14, 3, 12, 46, 5191 }, // т
-    { 17, 18, 19, 1, 12, 77, 5237 }, // у
-    { 18, 17, 18, 2, 12, 77, 5314 }, // ф
-    { 17, 13, 15, 0, 12, 56, 5391 }, // х
-    { 15, 15, 15, 1, 12, 57, 5447 }, // ц
-    { 9, 11, 9, 0, 11, 25, 5504 }, // ч
-    { 18, 13, 17, 1, 12, 59, 5529 }, // ш
-    { 18, 16, 19, 1, 12, 72, 5588 }, // щ
-    { 11, 13, 10, -2, 12, 36, 5660 }, // ъ
-    { 17, 15, 18, -1, 14, 64, 5696 }, // ы
-    { 10, 13, 10, -1, 12, 33, 5760 }, // ь
-    { 12, 13, 13, 2, 12, 39, 5793 }, // э
-    { 16, 14, 15, 0, 13, 56, 5832 }, // ю
-    { 13, 13, 17, 1, 13, 43, 5888 }, // я
-    { 15, 22, 18, 2, 22, 83, 5931 }, // ѐ
-    { 15, 21, 18, 2, 21, 79, 6014 }, // ё
-    { 15, 23, 18, 1, 18, 87, 6093 }, // ђ
-    { 15, 18, 12, 0, 17, 68, 6180 }, // ѓ
-    { 13, 12, 12, -1, 11, 39, 6248 }, // є
-    { 14, 14, 18, 1, 13, 49, 6287 }, // ѕ
-    { 11, 19, 9, 0, 19, 53, 6336 }, // і
-    { 12, 18, 9, 0, 18, 54, 6389 }, // ї
-    { 14, 25, 13, 1, 19, 88, 6443 }, // ј
-    { 16, 12, 17, -1, 11, 48, 6531 }, // љ
-    { 15, 13, 9, -5, 12, 49, 6579 }, // њ
-    { 15, 18, 18, 1, 18, 68, 6628 }, // ћ
-    { 16, 18, 17, -1, 18, 72, 6696 }, // ќ
-    { 16, 20, 14, 0, 19, 80, 6768 }, // ѝ
-    { 19, 28, 19, 1, 22, 133, 6848 }, // ў
-    { 13, 15, 12, -1, 12, 49, 6981 }, // џ
-    { 14, 18, 16, 3, 16, 63, 7030 }, // Ѣ
-    { 14, 18, 14, 2, 16, 63, 7093 }, // ѣ
-    { 23, 17, 18, -1, 16, 98, 7156 }, // Ѫ
-    { 16, 13, 13, -3, 12, 52, 7254 }, // ѫ
-    { 23, 23, 24, 2, 23, 133, 7306 }, // Ѳ
-    { 18, 17, 18, 2, 17, 77, 7439 }, // ѳ
-    { 21, 22, 23, 6, 22, 116, 7516 }, // Ѵ
-    { 15, 15, 18, 4, 15, 57, 7632 }, // ѵ
-    { 10, 8, 0, 6, 20, 20, 7689 }, // ҆
-    { 18, 19, 14, 0, 18, 86, 7709 }, // Ґ
-    { 16, 16, 12, 0, 15, 64, 7795 }, // ґ
-    { 17, 17, 14, 0, 16, 73, 7859 }, // Ғ
-    { 12, 11, 9, -2, 11, 33, 7932 }, // ғ
-    { 17, 20, 13, 0, 18, 85, 7965 }, // Ҕ
-    { 11, 12, 8, -3, 11, 33, 8050 }, // ҕ
-    { 30, 22, 31, 0, 18, 165, 8083 }, // Җ
-    { 21, 15, 21, -2, 12, 79, 8248 }, // җ
-    { 14, 19, 13, 1, 16, 67, 8327 }, // Ҙ
-    { 10, 17, 9, -2, 11, 43, 8394 }, // ҙ
-    { 19, 22, 15, 0, 18, 105, 8437 }, // Қ
-    { 13, 15, 10, -2, 12, 49, 8542 }, // қ
-    { 22, 18, 23, 1, 17, 99, 8591 }, // Ҝ
-    { 16, 11, 16, 0, 11, 44, 8690 }, // ҝ
-    { 19, 18, 21, 1, 18, 86, 8734 }, // Ҟ
-    { 13, 18, 19, 1, 18, 59, 8820 }, // ҟ
-    { 19, 18, 21, 1, 18, 86, 8879 }, // Ҡ
-    { 13, 12, 15, -1, 12, 39, 8965 }, // ҡ
-    { 20, 21, 16, -2, 18, 105, 9004 }, // Ң
-    { 14, 14, 11, -3, 12, 49, 9109 }, // ң
-    { 28, 18, 21, 1, 18, 126, 9158 }, // Ҥ
-    { 19, 12, 15, -1, 12, 57, 9284 }, // ҥ
-    { 25, 20, 27, 2, 18, 125, 9341 }, // Ҧ
-    { 20, 22, 26, 3, 15, 110, 9466 }, // ҧ
-    { 21, 17, 14, -2, 16, 90, 9576 }, // Ҩ
-    { 17, 14, 21, 1, 13, 60, 9666 }, // ҩ
-    { 18, 22, 20, 2, 19, 99, 9726 }, // Ҫ
-    { 12, 16, 16, 2, 13, 48, 9825 }, // ҫ
-    { 18, 21, 16, 2, 18, 95, 9873 }, // Ҭ
-    { 13, 14, 11, -1, 12, 46, 9968 }, // ҭ
-    { 16, 18, 22, 6, 18, 72, 10014 }, // Ү
-    { 14, 17, 16, 4, 12, 60, 10086 }, // ү
-    { 18, 18, 22, 4, 18, 81, 10146 }, // Ұ
-    { 18, 17, 16, 0, 12, 77, 10227 }, // ұ
-    { 21, 21, 16, 1, 18, 111, 10304 }, // Ҳ
-    { 16, 15, 16, 0, 12, 60, 10415 }, // ҳ
-    { 17, 20, 13, 0, 15, 85, 10475 }, // Ҵ
-    { 13, 14, 18, 3, 11, 46, 10560 }, // ҵ
-    { 15, 21, 14, 2, 16, 79, 10606 }, // Ҷ
-    { 10, 15, 10, 0, 11, 38, 10685 }, // ҷ
-    { 14, 16, 14, 3, 16, 56, 10723 }, // Ҹ
-    { 9, 11, 9, 0, 11, 25, 10779 }, // ҹ
-    { 15, 19, 14, 0, 18, 72, 10804 }, // Һ
-    { 15, 18, 18, 1, 18, 68, 10876 }, // һ
-    { 24, 17, 29, 4, 16, 102, 10944 }, // Ҽ
-    { 17, 12, 15, 1, 12, 51, 11046 }, // ҽ
-    { 24, 20, 19, 5, 16, 120, 11097 }, // Ҿ
-    { 17, 15, 13, 2, 12, 64, 11217 }, // ҿ
-    { 10, 18, 11, 1, 18, 45, 11281 }, // Ӏ
-    { 30, 28, 31, 0, 28, 210, 11326 }, // Ӂ
-    { 30, 24, 31, 0, 24, 180, 11536 }, // ӂ
-    { 17, 22, 15, 1, 16, 94, 11716 }, // Ӄ
-    { 12, 16, 10, -2, 12, 48, 11810 }, // ӄ
-    { 18, 21, 13, -1, 16, 95, 11858 }, // Ӆ
-    { 12, 14, 9, -1, 11, 42, 11953 }, // ӆ
-    { 20, 24, 21, 1, 18, 120, 11995 }, // Ӈ
-    { 14, 16, 15, -1, 12, 56, 12115 }, // ӈ
-    { 20, 25, 21, 1, 18, 125, 12171 }, // Ӊ
-    { 14, 17, 15, 0, 12, 60, 12296 }, // ӊ
-    { 15, 21, 14, 3, 16, 79, 12356 }, // Ӌ
-    { 9, 14, 13, 2, 11, 32, 12435 }, // ӌ
-    { 23, 26, 24, 1, 18, 150, 12467 }, // Ӎ
-    { 16, 17, 17, 0, 12, 68, 12617 }, // ӎ
-    { 8, 16, 13, 4, 15, 32, 12685 }, // ӏ
-    { 21, 25, 23, 1, 25, 132, 12717 }, // Ӑ
-    { 18, 20, 18, 1, 20, 90, 12849 }, // ӑ
-    { 20, 24, 23, 1, 24, 120, 12939 }, // Ӓ
-    { 17, 20, 18, 1, 20, 85, 13059 }, // ӓ
-    { 29, 19, 28, 1, 18, 138, 13144 }, // Ӕ
-    { 23, 13, 26, 1, 13, 75, 13282 }, // ӕ
-    { 20, 26, 18, 1, 26, 130, 13357 }, // Ӗ
-    { 17, 22, 18, 2, 22, 94, 13487 }, // ӗ
-    { 18, 18, 22, 7, 17, 81, 13581 }, // Ә
-    { 14, 14, 18, 6, 13, 49, 13662 }, // ә
-    { 18, 24, 22, 7, 23, 108, 13711 }, // Ӛ
-    { 15, 17, 18, 5, 13, 64, 13819 }, // ӛ
-    { 30, 27, 29, 3, 27, 203, 13883 }, // Ӝ
-    { 30, 23, 31, 0, 23, 173, 14086 }, // ӝ
-    { 16, 26, 13, 1, 25, 104, 14259 }, // Ӟ
-    { 15, 16, 9, -2, 16, 60, 14363 }, // ӟ
-    { 14, 17, 14, 2, 16, 60, 14423 }, // Ӡ
-    { 13, 17, 14, 1, 12, 56, 14483 }, // ӡ
-    { 19, 24, 19, 1, 24, 114, 14539 }, // Ӣ
-    { 17, 20, 14, 0, 19, 85, 14653 }, // ӣ
-    { 19, 23, 20, 1, 23, 110, 14738 }, // Ӥ
-    { 16, 19, 14, 0, 18, 76, 14848 }, // ӥ
-    { 21, 25, 23, 2, 24, 132, 14924 }, // Ӧ
-    { 15, 21, 18, 2, 21, 79, 15056 }, // ӧ
-    { 18, 17, 23, 3, 17, 77, 15135 }, // Ө
-    { 14, 12, 18, 2, 12, 42, 15212 }, // ө
-    { 18, 23, 23, 3, 23, 104, 15254 }, // Ӫ
-    { 15, 18, 18, 2, 18, 68, 15358 }, // ӫ
-    { 31, 27, 20, 1, 25, 210, 15426 }, // Ӭ
-    { 13, 18, 13, 2, 17, 59, 15636 }, // ӭ
-    { 18, 27, 17, 0, 25, 122, 15695 }, // Ӯ
-    { 18, 28, 19, 1, 22, 126, 15817 }, // ӯ
-    { 18, 26, 17, 0, 24, 117, 15943 }, // Ӱ
-    { 17, 27, 19, 1, 21, 115, 16060 }, // ӱ
-    { 20, 26, 17, 0, 24, 130, 16175 }, // Ӳ
-    { 22, 27, 19, 1, 21, 149, 16305 }, // ӳ
-    { 14, 20, 14, 3, 20, 70, 16454 }, // Ӵ
-    { 11, 15, 9, 0, 15, 42, 16524 }, // ӵ
-    { 17, 19, 14, 0, 16, 81, 16566 }, // Ӷ
-    { 12, 13, 9, -2, 11, 39, 16647 }, // ӷ
-    { 23, 28, 24, 1, 27, 161, 16686 }, // Ӹ
-    { 18, 23, 18, -1, 22, 104, 16847 }, // ӹ
-    { 22, 21, 23, 1, 18, 116, 16951 }, // Ӽ
-    { 15, 14, 16, -1, 12, 53, 17067 }, // ӽ
-    { 0, 0, 14, 0, 0, 0, 0 }, //  
-    { 0, 0, 24, 0, 0, 0, 0 }, //  
-    { 0, 0, 14, 0, 0, 0, 0 }, //  
-    { 0, 0, 24, 0, 0, 0, 0 }, //  
-    { 0, 0, 10, 0, 0, 0, 0 }, //  
-    { 0, 0, 9, 0, 0, 0, 0 }, //  
-    { 0, 0, 7, 0, 0, 0, 0 }, //  
-    { 0, 0, 15, 0, 0, 0, 0 }, //  
-    { 0, 0, 5, 0, 0, 0, 0 }, //  
-    { 0, 0, 8, 0, 0, 0, 0 }, //  
-    { 0, 0, 6, 0, 0, 0, 0 }, //  
-    { 0, 0, 3, 0, 0, 0, 0 }, // ​
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‍
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‎
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‏
-    { 12, 3, 11, 1, 8, 9, 0 }, // ‐
-    { 12, 3, 11, 1, 8, 9, 9 }, // ‑
-    { 18, 3, 11, -1, 8, 14, 18 }, // ‒
-    { 16, 5, 17, 2, 9, 20, 32 }, // –
-    { 23, 5, 24, 2, 9, 29, 52 }, // —
-    { 23, 5, 24, 2, 9, 29, 81 }, // ―
-    { 15, 19, 11, 1, 15, 72, 110 }, // ‖
-    { 20, 8, 11, -5, -1, 40, 182 }, // ‗
-    { 9, 8, 9, 4, 19, 18, 222 }, // ‘
-    { 9, 8, 9, 4, 19, 18, 240 }, // ’
-    { 9, 8, 7, -1, 4, 18, 258 }, // ‚
-    { 9, 8, 9, 4, 19, 18, 276 }, // ‛
-    { 16, 8, 16, 4, 19, 32, 294 }, // “
-    { 16, 8, 16, 4, 19, 32, 326 }, // ”
-    { 9, 8, 7, -1, 4, 18, 358 }, // „
-    { 16, 8, 16, 4, 19, 32, 376 }, // ‟
-    { 13, 30, 17, 5, 22, 98, 408 }, // †
-    { 15, 29, 18, 4, 21, 109, 506 }, // ‡
-    { 18, 16, 11, -2, 19, 72, 615 }, // •
-    { 7, 8, 13, 4, 10, 14, 687 }, // ‣
-    { 7, 5, 13, 3, 5, 9, 701 }, // ․
-    { 7, 5, 13, 3, 5, 9, 710 }, // ‥
-    { 20, 5, 20, 0, 5, 25, 719 }, // …
-    { 4, 3, 11, 4, 8, 3, 744 }, // ‧
-    { 0, 0, 23, 0, 0, 0, 747 }, //  
-    { 19, 19, 24, 3, 17, 91, 747 }, // ‰
-    { 10, 8, 11, 6, 19, 20, 838 }, // ′
-    { 16, 8, 16, 6, 19, 32, 858 }, // ″
-    { 16, 7, 9, -2, 18, 28, 890 }, // ‴
-    { 6, 7, 9, 5, 18, 11, 918 }, // ‵
-    { 9, 7, 9, 4, 18, 16, 929 }, // ‶
-    { 16, 7, 9, 0, 18, 28, 945 }, // ‷
-    { 12, 5, 14, 4, 18, 15, 973 }, // ‸
-    { 9, 12, 9, 2, 12, 27, 988 }, // ‹
-    { 9, 12, 9, -2, 12, 27, 1015 }, // ›
-    { 28, 28, 28, 1, 22, 196, 1042 }, // ※
-    { 12, 27, 13, 2, 24, 81, 1238 }, // ‼
-    { 17, 33, 18, 3, 28, 141, 1319 }, // ‽
-    { 12, 3, 11, 4, 18, 9, 1460 }, // ‾
-    { 11, 4, 16, 4, 14, 11, 1469 }, // ‿
-    { 16, 15, 13, 1, 19, 60, 1480 }, // ⁂
-    { 20, 18, 27, 4, 16, 90, 1540 }, // ⁄
-    { 29, 27, 31, 5, 24, 196, 1630 }, // ⁇
-    { 24, 28, 25, 4, 24, 168, 1826 }, // ⁈
-    { 23, 27, 16, -2, 24, 156, 1994 }, // ⁉
-    { 23, 36, 19, -1, 25, 207, 2150 }, // ⁒
-    { 0, 0, 97, 0, 0, 0, 2357 }, //  
-    { 7, 9, 7, 8, 18, 16, 0 }, // ⁰
-    { 7, 8, 7, 8, 18, 14, 16 }, // ⁴
-    { 8, 9, 7, 7, 18, 18, 30 }, // ⁵
-    { 8, 9, 7, 7, 18, 18, 48 }, // ⁶
-    { 7, 9, 8, 9, 18, 16, 66 }, // ⁷
-    { 8, 9, 8, 7, 18, 18, 82 }, // ⁸
-    { 8, 10, 8, 7, 18, 20, 100 }, // ⁹
-    { 15, 13, 18, 1, 13, 49, 120 }, // ⁿ
-    { 8, 9, 7, -6, 5, 18, 169 }, // ₀
-    { 7, 9, 7, -7, 5, 16, 187 }, // ₁
-    { 8, 9, 8, -7, 5, 18, 203 }, // ₂
-    { 8, 9, 7, -7, 5, 18, 221 }, // ₃
-    { 7, 8, 8, -6, 5, 14, 239 }, // ₄
-    { 8, 9, 7, -7, 5, 18, 253 }, // ₅
-    { 8, 9, 8, -7, 5, 18, 271 }, // ₆
-    { 7, 10, 8, -5, 6, 18, 289 }, // ₇
-    { 9, 9, 8, -7, 5, 21, 307 }, // ₈
-    { 9, 9, 8, -7, 5, 21, 328 }, // ₉
-    { 15, 29, 10, 1, 22, 109, 349 }, // ₍
-    { 14, 29, 9, -6, 22, 102, 458 }, // ₎
-    { 20, 27, 20, 2, 23, 135, 0 }, // ₡
-    { 18, 19, 20, 2, 19, 86, 135 }, // ₢
-    { 17, 19, 14, 0, 18, 81, 221 }, // ₤
-    { 24, 18, 21, -1, 18, 108, 302 }, // ₦
-    { 20, 18, 19, 1, 18, 90, 410 }, // ₧
-    { 25, 19, 27, -1, 18, 119, 500 }, // ₨
-    { 20, 18, 18, -2, 18, 90, 619 }, // ₩
-    { 20, 16, 22, 3, 16, 80, 709 }, // ₪
-    { 19, 18, 11, -2, 17, 86, 789 }, // ₫
-    { 17, 20, 17, 1, 17, 85, 875 }, // €
-    { 17, 18, 21, 5, 18, 77, 960 }, // ₮
-    { 23, 18, 13, 0, 18, 104, 1037 }, // ₱
-    { 19, 27, 24, 2, 23, 129, 1141 }, // ₲
-    { 24, 18, 22, 6, 17, 108, 1270 }, // ₴
-    { 12, 17, 12, 2, 15, 51, 1378 }, // ₵
-    { 20, 19, 21, 5, 19, 95, 1429 }, // ₸
-    { 14, 17, 14, 3, 16, 60, 1524 }, // ₹
-    { 14, 16, 14, 1, 14, 56, 1584 }, // ₺
-    { 16, 18, 17, 3, 17, 72, 1640 }, // ₼
-    { 21, 18, 19, -3, 18, 95, 1712 }, // ₽
-    { 15, 15, 15, -4, 11, 57, 0 }, // ←
-    { 15, 15, 16, 2, 14, 57, 57 }, // ↑
-    { 15, 15, 16, 4, 11, 57, 114 }, // →
-    { 15, 15, 16, 6, 14, 57, 171 }, // ↓
-    { 24, 12, 21, -1, 10, 72, 228 }, // ↔
-    { 13, 23, 17, 3, 22, 75, 300 }, // ↕
-    { 15, 10, 16, -2, 10, 38, 375 }, // ↖
-    { 14, 10, 13, 2, 10, 35, 413 }, // ↗
-    { 12, 14, 13, 4, 12, 42, 448 }, // ↘
-    { 11, 14, 13, -2, 12, 39, 490 }, // ↙
-    { 17, 14, 20, 1, 13, 60, 529 }, // ⇐
-    { 18, 17, 22, 4, 16, 77, 589 }, // ⇑
-    { 17, 14, 20, 3, 13, 60, 666 }, // ⇒
-    { 18, 17, 22, 8, 15, 77, 726 }, // ⇓
-    { 21, 14, 23, 1, 13, 74, 803 }, // ⇔
-    { 15, 21, 19, 5, 12, 79, 877 }, // ⇕
-    { 17, 19, 14, 1, 18, 81, 0 }, // ∂
-    { 23, 20, 23, 0, 19, 115, 81 }, // ∅
-    { 18, 17, 18, 0, 16, 77, 196 }, // ∆
-    { 17, 16, 15, 2, 15, 68, 273 }, // ∏
-    { 17, 17, 15, 6, 16, 73, 341 }, // ∐
-    { 16, 16, 12, 0, 15, 64, 414 }, // ∑
-    { 12, 4, 13, 1, 8, 12, 478 }, // −
-    { 22, 19, 20, 2, 18, 105, 490 }, // √
-    { 19, 12, 19, 2, 14, 57, 595 }, // ∞
-    { 21, 23, 18, 0, 17, 121, 652 }, // ∫
-    { 9, 14, 7, 0, 14, 32, 773 }, // ∶
-    { 15, 13, 30, 11, 12, 49, 805 }, // ≈
-    { 20, 19, 27, 4, 17, 95, 854 }, // ≠
-    { 20, 18, 17, -3, 16, 90, 949 }, // ≤
-    { 20, 18, 18, 0, 16, 90, 1039 }, // ≥
+    { 15, 12, 17, 2, 12, 45, 6416 }, // «
+    { 12, 8, 13, 2, 8, 24, 519 }, // ¬
+    { 12, 3, 13, 2, 8, 9, 543 }, // ­
+    { 11, 9, 14, 6, 23, 25, 552 }, // ®
+    { 10, 4, 11, 4, 16, 10, 577 }, // ¯
+    { 12, 10, 14, 4, 16, 30, 587 }, // °
+    { 16, 16, 17, 0, 12, 64, 617 }, // ±
+    { 8, 8, 7, 7, 17, 16, 681 }, // ²
+    { 8, 8, 7, 7, 17, 16, 697 }, // ³
+    { 7, 5, 6, 3, 16, 9, 713 }, // ´
+    { 17, 15, 18, -1, 12, 64, 722 }, // µ
+    { 16, 18, 16, 1, 15, 72, 786 }, // ¶
+    { 7, 5, 5, 1, 10, 9, 858 }, // ·
+    { 7, 7, 7, -1, 1, 13, 867 }, // ¸
+    { 6, 8, 6, 7, 17, 12, 880 }, // ¹
+    { 8, 7, 14, 6, 15, 14, 892 }, // º
+    { 15, 12, 16, -3, 12, 45, 6461 }, // »
+    { 22, 20, 27, 2, 18, 110, 906 }, // ¼
+    { 23, 20, 27, 2, 18, 115, 1016 }, // ½
+    { 22, 19, 27, 2, 17, 105, 1131 }, // ¾
+    { 16, 26, 14, -2, 15, 104, 1236 }, // ¿
+    { 18, 24, 23, 1, 24, 108, 6506 }, // À
+    { 19, 28, 23, 1, 28, 133, 6614 }, // Á
+    { 19, 25, 23, 1, 25, 119, 6747 }, // Â
+    { 19, 25, 23, 1, 25, 119, 1340 }, // Ã
+    { 21, 25, 23, 1, 25, 132, 6866 }, // Ä
+    { 18, 25, 23, 1, 25, 113, 1459 }, // Å
+    { 29, 19, 28, 1, 18, 138, 1572 }, // Æ
+    { 18, 25, 20, 2, 19, 113, 6998 }, // Ç
+    { 18, 25, 19, 1, 25, 113, 7111 }, // È
+    { 18, 28, 19, 1, 28, 126, 7224 }, // É
+    { 18, 26, 19, 1, 26, 117, 7350 }, // Ê
+    { 19, 26, 19, 1, 26, 124, 7467 }, // Ë
+    { 12, 25, 11, 1, 25, 75, 7591 }, // Ì
+    { 13, 29, 11, 1, 29, 95, 7666 }, // Í
+    { 13, 26, 11, 1, 26, 85, 7761 }, // Î
+    { 15, 27, 11, 1, 27, 102, 7846 }, // Ï
+    { 21, 18, 21, 0, 18, 95, 1710 }, // Ð
+    { 21, 25, 21, 1, 25, 132, 7948 }, // Ñ
+    { 21, 25, 23, 2, 24, 132, 8080 }, // Ò
+    { 21, 28, 23, 2, 27, 147, 8212 }, // Ó
+    { 21, 26, 23, 2, 25, 137, 8359 }, // Ô
+    { 21, 26, 23, 2, 25, 137, 1805 }, // Õ
+    { 21, 26, 23, 2, 25, 137, 8496 }, // Ö
+    { 14, 7, 12, 0, 9, 25, 1942 }, // ×
+    { 41, 37, 23, -8, 28, 380, 1967 }, // Ø
+    { 21, 26, 21, 1, 25, 137, 8633 }, // Ù
+    { 21, 30, 21, 1, 29, 158, 8770 }, // Ú
+    { 21, 27, 21, 1, 26, 142, 8928 }, // Û
+    { 21, 28, 21, 1, 27, 147, 9070 }, // Ü
+    { 16, 30, 22, 6, 30, 120, 2347 }, // Ý
+    { 13, 17, 12, 1, 17, 56, 2467 }, // Þ
+    { 16, 18, 14, 0, 17, 72, 2523 }, // ß
+    { 14, 19, 18, 1, 19, 67, 9217 }, // à
+    { 15, 22, 18, 1, 22, 83, 9284 }, // á
+    { 15, 19, 18, 1, 19, 72, 9367 }, // â
+    { 15, 19, 18, 1, 19, 72, 2595 }, // ã
+    { 17, 20, 18, 1, 20, 85, 9439 }, // ä
+    { 14, 20, 18, 1, 20, 70, 2667 }, // å
+    { 23, 13, 26, 1, 13, 75, 2737 }, // æ
+    { 12, 18, 16, 2, 13, 54, 9524 }, // ç
+    { 14, 21, 18, 2, 21, 74, 9578 }, // è
+    { 15, 24, 18, 2, 24, 90, 9652 }, // é
+    { 15, 21, 18, 2, 21, 79, 9742 }, // ê
+    { 16, 22, 18, 2, 22, 88, 9821 }, // ë
+    { 10, 18, 9, 0, 18, 45, 9909 }, // ì
+    { 11, 22, 9, 0, 22, 61, 9954 }, // í
+    { 12, 19, 9, -1, 19, 57, 10015 }, // î
+    { 12, 18, 9, 0, 18, 54, 10072 }, // ï
+    { 20, 19, 14, 0, 18, 95, 2812 }, // ð
+    { 16, 20, 18, 1, 20, 80, 10126 }, // ñ
+    { 14, 18, 18, 2, 18, 63, 10206 }, // ò
+    { 14, 22, 18, 2, 22, 77, 10269 }, // ó
+    { 14, 19, 18, 2, 19, 67, 10346 }, // ô
+    { 14, 19, 18, 2, 19, 67, 2907 }, // õ
+    { 16, 19, 18, 2, 19, 76, 10413 }, // ö
+    { 16, 15, 19, 3, 15, 60, 2974 }, // ÷
+    { 24, 35, 18, -3, 24, 210, 3034 }, // ø
+    { 14, 18, 18, 2, 18, 63, 10489 }, // ù
+    { 14, 22, 18, 2, 22, 77, 10552 }, // ú
+    { 14, 19, 18, 2, 19, 67, 10629 }, // û
+    { 16, 20, 18, 2, 20, 80, 10696 }, // ü
+    { 17, 31, 19, 1, 25, 132, 3244 }, // ý
+    { 14, 22, 12, 0, 17, 77, 3376 }, // þ
+    { 18, 28, 19, 1, 22, 126, 3453 }, // ÿ
+    { 21, 25, 23, 1, 25, 132, 3579 }, // Ā
+    { 17, 20, 18, 1, 20, 85, 3711 }, // ā
+    { 21, 26, 23, 1, 26, 137, 3796 }, // Ă
+    { 17, 20, 18, 1, 20, 85, 3933 }, // ă
+    { 18, 24, 23, 1, 18, 108, 4018 }, // Ą
+    { 14, 19, 18, 1, 13, 67, 4126 }, // ą
+    { 18, 25, 20, 2, 25, 113, 4193 }, // Ć
+    { 12, 18, 16, 2, 18, 54, 4306 }, // ć
+    { 19, 27, 20, 2, 27, 129, 4360 }, // Ĉ
+    { 15, 19, 16, 2, 19, 72, 4489 }, // ĉ
+    { 18, 25, 20, 2, 25, 113, 4561 }, // Ċ
+    { 13, 18, 16, 2, 18, 59, 4674 }, // ċ
+    { 20, 27, 20, 2, 27, 135, 4733 }, // Č
+    { 16, 20, 16, 2, 20, 80, 4868 }, // č
+    { 20, 27, 21, 1, 27, 135, 4948 }, // Ď
+    { 20, 18, 18, 2, 18, 90, 5083 }, // ď
+    { 21, 18, 21, 0, 18, 95, 5173 }, // Đ
+    { 20, 18, 18, 2, 18, 90, 5268 }, // đ
+    { 19, 26, 19, 1, 26, 124, 5358 }, // Ē
+    { 16, 22, 18, 2, 22, 88, 5482 }, // ē
+    { 19, 26, 19, 1, 26, 124, 5570 }, // Ĕ
+    { 17, 22, 18, 2, 22, 94, 5694 }, // ĕ
+    { 18, 26, 19, 1, 26, 117, 5788 }, // Ė
+    { 14, 22, 18, 2, 22, 77, 5905 }, // ė
+    { 18, 23, 19, 1, 18, 104, 5982 }, // Ę
+    { 14, 20, 18, 2, 12, 70, 6086 }, // ę
+    { 20, 28, 19, 1, 28, 140, 6156 }, // Ě
+    { 18, 24, 18, 2, 24, 108, 6296 }, // ě
+    { 21, 29, 24, 2, 29, 153, 6404 }, // Ĝ
+    { 19, 28, 18, 0, 21, 133, 6557 }, // ĝ
+    { 22, 28, 24, 2, 28, 154, 6690 }, // Ğ
+    { 19, 27, 18, 0, 20, 129, 6844 }, // ğ
+    { 19, 28, 24, 2, 28, 133, 6973 }, // Ġ
+    { 17, 27, 18, 0, 20, 115, 7106 }, // ġ
+    { 20, 31, 24, 2, 31, 155, 7221 }, // Ģ
+    { 17, 28, 18, 0, 21, 119, 7376 }, // ģ
+    { 20, 26, 21, 1, 26, 130, 7495 }, // Ĥ
+    { 15, 26, 18, 1, 26, 98, 7625 }, // ĥ
+    { 21, 18, 21, 1, 18, 95, 7723 }, // Ħ
+    { 15, 18, 18, 1, 18, 68, 7818 }, // ħ
+    { 14, 27, 11, 1, 27, 95, 7886 }, // Ĩ
+    { 12, 20, 9, 0, 20, 60, 7981 }, // ĩ
+    { 15, 27, 11, 1, 27, 102, 8041 }, // Ī
+    { 13, 19, 9, 0, 19, 62, 8143 }, // ī
+    { 12, 23, 11, -1, 18, 69, 8205 }, // Į
+    { 13, 25, 9, -2, 19, 82, 8274 }, // į
+    { 13, 27, 11, 1, 27, 88, 8356 }, // İ
+    { 8, 12, 9, 0, 12, 24, 8444 }, // ı
+    { 21, 26, 33, 6, 18, 137, 8468 }, // Ĳ
+    { 21, 24, 9, 0, 19, 126, 8605 }, // ĳ
+    { 22, 31, 18, 0, 26, 171, 8731 }, // Ĵ
+    { 18, 27, 13, 1, 21, 122, 8902 }, // ĵ
+    { 19, 29, 21, 1, 29, 138, 9024 }, // Ķ
+    { 15, 29, 19, -1, 18, 109, 9162 }, // ķ
+    { 12, 12, 14, -2, 12, 36, 9271 }, // ĸ
+    { 14, 24, 18, 1, 24, 84, 9307 }, // Ĺ
+    { 13, 27, 12, 1, 27, 88, 9391 }, // ĺ
+    { 14, 29, 18, 1, 18, 102, 9479 }, // Ļ
+    { 13, 29, 12, -2, 18, 95, 9581 }, // ļ
+    { 16, 18, 18, 1, 18, 72, 9676 }, // Ľ
+    { 16, 21, 12, 1, 21, 84, 9748 }, // ľ
+    { 16, 18, 18, 1, 18, 72, 9832 }, // Ŀ
+    { 13, 18, 12, 1, 18, 59, 9904 }, // ŀ
+    { 32, 30, 18, -10, 24, 240, 9963 }, // Ł
+    { 22, 18, 12, -7, 18, 99, 10203 }, // ł
+    { 21, 25, 21, 1, 25, 132, 10302 }, // Ń
+    { 15, 20, 18, 1, 20, 75, 10434 }, // ń
+    { 21, 27, 21, 1, 18, 142, 10509 }, // Ņ
+    { 15, 21, 18, 1, 13, 79, 10651 }, // ņ
+    { 22, 27, 21, 1, 27, 149, 10730 }, // Ň
+    { 19, 22, 18, 1, 22, 105, 10879 }, // ň
+    { 28, 21, 18, -12, 21, 147, 10984 }, // ŉ
+    { 21, 23, 21, 1, 18, 121, 11131 }, // Ŋ
+    { 15, 17, 18, 1, 13, 64, 11252 }, // ŋ
+    { 21, 26, 23, 2, 25, 137, 11316 }, // Ō
+    { 16, 19, 18, 2, 19, 76, 11453 }, // ō
+    { 21, 27, 23, 2, 26, 142, 11529 }, // Ŏ
+    { 16, 20, 18, 2, 20, 80, 11671 }, // ŏ
+    { 23, 25, 23, 2, 24, 144, 11751 }, // Ő
+    { 19, 18, 18, 2, 18, 86, 11895 }, // ő
+    { 28, 20, 25, 2, 19, 140, 10776 }, // Œ
+    { 22, 12, 22, 2, 12, 66, 10916 }, // œ
+    { 17, 25, 20, 1, 25, 107, 11981 }, // Ŕ
+    { 12, 17, 15, 1, 17, 51, 12088 }, // ŕ
+    { 17, 29, 20, 1, 29, 124, 12139 }, // Ŗ
+    { 13, 22, 15, 1, 22, 72, 12263 }, // ŗ
+    { 19, 26, 20, 1, 26, 124, 12335 }, // Ř
+    { 15, 19, 15, 1, 19, 72, 12459 }, // ř
+    { 18, 25, 22, 1, 25, 113, 12531 }, // Ś
+    { 14, 19, 18, 1, 18, 67, 12644 }, // ś
+    { 20, 26, 22, 1, 26, 130, 12711 }, // Ŝ
+    { 17, 20, 18, 1, 19, 85, 12841 }, // ŝ
+    { 18, 23, 22, 1, 18, 104, 12926 }, // Ş
+    { 14, 19, 18, 1, 13, 67, 13030 }, // ş
+    { 21, 26, 22, 1, 26, 137, 13097 }, // Š
+    { 18, 21, 18, 1, 20, 95, 13234 }, // š
+    { 17, 24, 21, 5, 18, 102, 13329 }, // Ţ
+    { 13, 22, 16, 2, 17, 72, 13431 }, // ţ
+    { 17, 26, 21, 5, 26, 111, 13503 }, // Ť
+    { 16, 20, 16, 4, 20, 80, 13614 }, // ť
+    { 17, 18, 21, 5, 18, 77, 13694 }, // Ŧ
+    { 13, 17, 16, 2, 17, 56, 13771 }, // ŧ
+    { 21, 28, 21, 1, 27, 147, 13827 }, // Ũ
+    { 15, 20, 18, 2, 20, 75, 13974 }, // ũ
+    { 21, 28, 21, 1, 27, 147, 14049 }, // Ū
+    { 16, 19, 18, 2, 19, 76, 14196 }, // ū
+    { 21, 28, 21, 1, 27, 147, 14272 }, // Ŭ
+    { 16, 20, 18, 2, 20, 80, 14419 }, // ŭ
+    { 21, 29, 21, 1, 28, 153, 14499 }, // Ů
+    { 14, 21, 18, 2, 21, 74, 14652 }, // ů
+    { 23, 27, 21, 1, 26, 156, 14726 }, // Ű
+    { 19, 19, 18, 2, 19, 91, 14882 }, // ű
+    { 21, 23, 21, 1, 18, 121, 14973 }, // Ų
+    { 14, 18, 18, 2, 12, 63, 15094 }, // ų
+    { 25, 26, 29, 5, 26, 163, 15157 }, // Ŵ
+    { 18, 22, 23, 4, 21, 99, 15320 }, // ŵ
+    { 16, 28, 22, 6, 28, 112, 15419 }, // Ŷ
+    { 17, 28, 19, 1, 22, 119, 15531 }, // ŷ
+    { 16, 28, 22, 6, 28, 112, 15650 }, // Ÿ
+    { 22, 24, 22, 1, 24, 132, 15762 }, // Ź
+    { 16, 20, 18, 1, 20, 80, 15894 }, // ź
+    { 22, 24, 22, 1, 24, 132, 15974 }, // Ż
+    { 16, 20, 18, 1, 20, 80, 16106 }, // ż
+    { 22, 26, 22, 1, 26, 143, 16186 }, // Ž
+    { 19, 21, 18, 1, 21, 100, 16329 }, // ž
+    { 12, 17, 13, 2, 17, 51, 16429 }, // ſ
+    { 8, 4, 0, 4, 16, 8, 16480 }, // ̀
+    { 7, 5, 0, 3, 16, 9, 16488 }, // ́
+    { 12, 6, 0, -1, 1, 18, 16497 }, // ̂
+    { 9, 5, 0, 4, 16, 12, 16515 }, // ̃
+    { 12, 4, 0, 4, 15, 12, 16527 }, // ̄
+    { 15, 4, 0, 5, 19, 15, 16539 }, // ̅
+    { 11, 6, 0, 4, 16, 17, 16554 }, // ̆
+    { 6, 5, 0, 4, 17, 8, 16571 }, // ̇
+    { 10, 4, 0, 3, 15, 10, 16579 }, // ̈
+    { 5, 6, 0, 7, 14, 8, 16589 }, // ̉
+    { 6, 5, 0, 4, 16, 8, 16597 }, // ̊
+    { 17, 4, 0, 4, 16, 17, 16605 }, // ̋
+    { 12, 6, 0, 4, 17, 18, 16622 }, // ̌
+    { 18, 4, 0, -8, 16, 18, 16640 }, // ̏
+    { 10, 8, 0, 2, 17, 20, 16658 }, // ̒
+    { 10, 8, 0, 2, 16, 20, 16678 }, // ̓
+    { 9, 8, 0, -5, 16, 18, 16698 }, // ̔
+    { 6, 6, 0, 0, 0, 9, 16716 }, // ̘
+    { 6, 6, 0, 1, 0, 9, 16725 }, // ̙
+    { 10, 6, 0, 5, 17, 15, 16734 }, // ̚
+    { 5, 7, 0, 3, 15, 9, 16749 }, // ̛
+    { 5, 7, 0, -1, 0, 9, 16758 }, // ̜
+    { 6, 6, 0, 2, 4, 9, 16767 }, // ̝
+    { 6, 6, 0, -1, 0, 9, 16776 }, // ̞
+    { 5, 5, 0, 0, -2, 7, 16785 }, // ̟
+    { 12, 4, 0, -1, -2, 12, 16792 }, // ̠
+    { 6, 5, 0, -3, 2, 8, 16804 }, // ̣
+    { 11, 4, 0, -2, -1, 11, 16812 }, // ̤
+    { 6, 5, 0, 4, 16, 8, 16823 }, // ̥
+    { 10, 8, 0, -1, 4, 20, 16831 }, // ̦
+    { 7, 7, 0, -1, 1, 13, 16851 }, // ̧
+    { 7, 8, 0, 0, 2, 14, 16864 }, // ̨
+    { 7, 7, 0, -2, -1, 13, 16878 }, // ̩
+    { 10, 5, 0, -1, 0, 13, 16891 }, // ̪
+    { 14, 6, 0, -1, 1, 21, 16904 }, // ̬
+    { 13, 6, 0, -1, 1, 20, 16925 }, // ̭
+    { 10, 6, 0, 5, 18, 15, 16945 }, // ̰
+    { 11, 4, 0, 5, 18, 11, 16960 }, // ̱
+    { 11, 4, 0, -1, -1, 11, 16971 }, // ̲
+    { 11, 6, 0, 5, 18, 17, 16982 }, // ̴
+    { 12, 3, 0, 1, 8, 9, 16999 }, // ̵
+    { 5, 8, 0, 1, 1, 10, 17008 }, // ̹
+    { 11, 7, 0, -3, 1, 20, 17018 }, // ̺
+    { 10, 7, 0, -1, 1, 18, 17038 }, // ̻
+    { 10, 6, 0, -1, 1, 15, 17056 }, // ̼
+    { 7, 5, 0, 4, 16, 9, 17071 }, // ̽
+    { 9, 5, 0, 4, 16, 12, 17080 }, // ͂
+    { 5, 6, 0, 8, 19, 8, 17092 }, // ̓
+    { 13, 15, 0, 3, 26, 49, 0 }, // ̈́
+    { 11, 5, 0, 3, 17, 14, 49 }, // ͆
+    { 14, 8, 0, -2, 0, 28, 63 }, // ͇
+    { 11, 7, 0, -1, 1, 20, 91 }, // ͈
+    { 9, 6, 0, -1, -1, 14, 111 }, // ͉
+    { 15, 17, 0, 3, 23, 64, 125 }, // ͊
+    { 21, 16, 0, 7, 24, 84, 189 }, // ͋
+    { 15, 13, 0, 11, 12, 49, 273 }, // ͌
+    { 11, 24, 0, 1, 8, 66, 322 }, // ͍
+    { 5, 4, 0, 10, 3, 5, 388 }, // ͎
+    { 19, 5, 0, 0, 1, 24, 393 }, // ͜
+    { 19, 6, 0, 3, 17, 29, 417 }, // ͡
+    { 23, 7, 0, -1, 0, 41, 446 }, // ͢
+    { 18, 25, 18, 1, 25, 113, 487 }, // Ѐ
+    { 19, 26, 19, 1, 26, 124, 0 }, // Ё
+    { 19, 20, 14, 2, 18, 95, 600 }, // Ђ
+    { 17, 25, 14, 0, 24, 107, 695 }, // Ѓ
+    { 18, 18, 17, 1, 16, 81, 802 }, // Є
+    { 18, 18, 22, 1, 18, 81, 883 }, // Ѕ
+    { 10, 18, 11, 1, 18, 45, 964 }, // І
+    { 14, 26, 11, 1, 26, 91, 1009 }, // Ї
+    { 19, 23, 18, 0, 18, 110, 1100 }, // Ј
+    { 23, 18, 24, 1, 16, 104, 1210 }, // Љ
+    { 21, 17, 13, -4, 16, 90, 1314 }, // Њ
+    { 17, 19, 21, 5, 19, 81, 1404 }, // Ћ
+    { 19, 24, 21, 1, 24, 114, 1485 }, // Ќ
+    { 19, 23, 20, 1, 23, 110, 1599 }, // Ѝ
+    { 18, 27, 17, 0, 25, 122, 1709 }, // Ў
+    { 18, 21, 17, 1, 16, 95, 1831 }, // Џ
+    { 18, 18, 23, 1, 18, 81, 124 }, // А
+    { 15, 17, 14, 2, 16, 64, 205 }, // Б
+    { 15, 16, 14, 1, 15, 60, 269 }, // В
+    { 17, 17, 14, 0, 16, 73, 329 }, // Г
+    { 18, 19, 17, 1, 16, 86, 402 }, // Д
+    { 17, 18, 18, 1, 18, 77, 488 }, // Е
+    { 30, 18, 31, 0, 18, 135, 565 }, // Ж
+    { 14, 17, 13, 1, 16, 60, 700 }, // З
+    { 19, 18, 20, 1, 18, 86, 760 }, // И
+    { 19, 24, 20, 1, 24, 114, 846 }, // Й
+    { 19, 18, 21, 1, 18, 86, 960 }, // К
+    { 18, 18, 13, -1, 16, 81, 1046 }, // Л
+    { 21, 17, 18, 0, 16, 90, 1127 }, // М
+    { 20, 18, 21, 1, 18, 90, 1217 }, // Н
+    { 21, 19, 23, 2, 18, 100, 1307 }, // О
+    { 17, 17, 14, 0, 16, 73, 1407 }, // П
+    { 17, 18, 19, 1, 18, 77, 1480 }, // Р
+    { 18, 19, 20, 2, 19, 86, 1557 }, // С
+    { 17, 18, 21, 5, 18, 77, 1643 }, // Т
+    { 18, 18, 17, 0, 16, 81, 1720 }, // У
+    { 16, 16, 18, 4, 16, 64, 1801 }, // Ф
+    { 22, 18, 23, 1, 18, 99, 1865 }, // Х
+    { 17, 20, 15, 0, 16, 85, 1964 }, // Ц
+    { 14, 16, 14, 3, 16, 56, 2049 }, // Ч
+    { 19, 17, 17, 1, 16, 81, 2105 }, // Ш
+    { 19, 20, 19, 1, 16, 95, 2186 }, // Щ
+    { 14, 17, 13, -1, 16, 60, 2281 }, // Ъ
+    { 23, 19, 24, 1, 18, 110, 2341 }, // Ы
+    { 12, 17, 13, 1, 16, 51, 2451 }, // Ь
+    { 19, 18, 20, 1, 16, 86, 2502 }, // Э
+    { 20, 17, 19, 1, 16, 85, 2588 }, // Ю
+    { 18, 18, 18, 0, 18, 81, 2673 }, // Я
+    { 14, 13, 18, 1, 13, 46, 2754 }, // а
+    { 17, 20, 14, 2, 19, 85, 2800 }, // б
+    { 13, 12, 15, -1, 12, 39, 2885 }, // в
+    { 15, 13, 12, 0, 12, 49, 2924 }, // г
+    { 16, 15, 16, 1, 12, 60, 2973 }, // д
+    { 14, 12, 18, 2, 12, 42, 3033 }, // е
+    { 30, 15, 31, 0, 15, 113, 3075 }, // ж
+    { 10, 11, 9, -2, 11, 28, 3188 }, // з
+    { 16, 13, 14, 0, 12, 52, 3216 }, // и
+    { 15, 18, 13, 0, 18, 68, 3268 }, // й
+    { 15, 12, 17, -1, 12, 45, 3336 }, // к
+    { 13, 12, 9, -3, 11, 39, 3381 }, // л
+    { 16, 13, 18, -1, 13, 52, 3420 }, // м
+    { 17, 13, 17, -1, 13, 56, 3472 }, // н
+    { 14, 12, 18, 2, 12, 42, 3528 }, // о
+    { 16, 13, 14, 0, 12, 52, 3570 }, // п
+    { 19, 19, 20, -1, 13, 91, 3622 }, // р
+    { 12, 13, 16, 2, 13, 39, 3713 }, // с
+    { 14, 13, 14, 3, 12, 46, 3752 }, // т
+    { 17, 18, 19, 1, 12, 77, 3798 }, // у
+    { 18, 17, 18, 2, 12, 77, 3875 }, // ф
+    { 17, 13, 15, 0, 12, 56, 3952 }, // х
+    { 15, 15, 15, 1, 12, 57, 4008 }, // ц
+    { 9, 11, 9, 0, 11, 25, 4065 }, // ч
+    { 18, 13, 17, 1, 12, 59, 4090 }, // ш
+    { 18, 16, 19, 1, 12, 72, 4149 }, // щ
+    { 11, 13, 10, -2, 12, 36, 4221 }, // ъ
+    { 17, 15, 18, -1, 14, 64, 4257 }, // ы
+    { 10, 13, 10, -1, 12, 33, 4321 }, // ь
+    { 12, 13, 13, 2, 12, 39, 4354 }, // э
+    { 16, 14, 15, 0, 13, 56, 4393 }, // ю
+    { 13, 13, 17, 1, 13, 43, 4449 }, // я
+    { 15, 22, 18, 2, 22, 83, 1926 }, // ѐ
+    { 15, 21, 18, 2, 21, 79, 4492 }, // ё
+    { 15, 23, 18, 1, 18, 87, 2009 }, // ђ
+    { 15, 18, 12, 0, 17, 68, 2096 }, // ѓ
+    { 13, 12, 12, -1, 11, 39, 2164 }, // є
+    { 14, 14, 18, 1, 13, 49, 2203 }, // ѕ
+    { 11, 19, 9, 0, 19, 53, 2252 }, // і
+    { 12, 18, 9, 0, 18, 54, 2305 }, // ї
+    { 14, 25, 13, 1, 19, 88, 2359 }, // ј
+    { 16, 12, 17, -1, 11, 48, 2447 }, // љ
+    { 15, 13, 9, -5, 12, 49, 2495 }, // њ
+    { 15, 18, 18, 1, 18, 68, 2544 }, // ћ
+    { 16, 18, 17, -1, 18, 72, 2612 }, // ќ
+    { 16, 20, 14, 0, 19, 80, 2684 }, // ѝ
+    { 19, 28, 19, 1, 22, 133, 2764 }, // ў
+    { 13, 15, 12, -1, 12, 49, 2897 }, // џ
+    { 14, 18, 16, 3, 16, 63, 2946 }, // Ѣ
+    { 14, 18, 14, 2, 16, 63, 3009 }, // ѣ
+    { 23, 17, 18, -1, 16, 98, 3072 }, // Ѫ
+    { 16, 13, 13, -3, 12, 52, 3170 }, // ѫ
+    { 23, 23, 24, 2, 23, 133, 3222 }, // Ѳ
+    { 18, 17, 18, 2, 17, 77, 3355 }, // ѳ
+    { 21, 22, 23, 6, 22, 116, 3432 }, // Ѵ
+    { 15, 15, 18, 4, 15, 57, 3548 }, // ѵ
+    { 10, 8, 0, 6, 20, 20, 3605 }, // ҆
+    { 18, 19, 14, 0, 18, 86, 3625 }, // Ґ
+    { 16, 16, 12, 0, 15, 64, 3711 }, // ґ
+    { 17, 17, 14, 0, 16, 73, 3775 }, // Ғ
+    { 12, 11, 9, -2, 11, 33, 3848 }, // ғ
+    { 17, 20, 13, 0, 18, 85, 3881 }, // Ҕ
+    { 11, 12, 8, -3, 11, 33, 3966 }, // ҕ
+    { 30, 22, 31, 0, 18, 165, 3999 }, // Җ
+    { 21, 15, 21, -2, 12, 79, 4164 }, // җ
+    { 14, 19, 13, 1, 16, 67, 4243 }, // Ҙ
+    { 10, 17, 9, -2, 11, 43, 4310 }, // ҙ
+    { 19, 22, 15, 0, 18, 105, 4353 }, // Қ
+    { 13, 15, 10, -2, 12, 49, 4458 }, // қ
+    { 22, 18, 23, 1, 17, 99, 4507 }, // Ҝ
+    { 16, 11, 16, 0, 11, 44, 4606 }, // ҝ
+    { 19, 18, 21, 1, 18, 86, 4650 }, // Ҟ
+    { 13, 18, 19, 1, 18, 59, 4736 }, // ҟ
+    { 19, 18, 21, 1, 18, 86, 4795 }, // Ҡ
+    { 13, 12, 15, -1, 12, 39, 4881 }, // ҡ
+    { 20, 21, 16, -2, 18, 105, 4920 }, // Ң
+    { 14, 14, 11, -3, 12, 49, 5025 }, // ң
+    { 28, 18, 21, 1, 18, 126, 5074 }, // Ҥ
+    { 19, 12, 15, -1, 12, 57, 5200 }, // ҥ
+    { 25, 20, 27, 2, 18, 125, 5257 }, // Ҧ
+    { 20, 22, 26, 3, 15, 110, 5382 }, // ҧ
+    { 21, 17, 14, -2, 16, 90, 5492 }, // Ҩ
+    { 17, 14, 21, 1, 13, 60, 5582 }, // ҩ
+    { 18, 22, 20, 2, 19, 99, 5642 }, // Ҫ
+    { 12, 16, 16, 2, 13, 48, 5741 }, // ҫ
+    { 18, 21, 16, 2, 18, 95, 5789 }, // Ҭ
+    { 13, 14, 11, -1, 12, 46, 5884 }, // ҭ
+    { 16, 18, 22, 6, 18, 72, 5930 }, // Ү
+    { 14, 17, 16, 4, 12, 60, 6002 }, // ү
+    { 18, 18, 22, 4, 18, 81, 6062 }, // Ұ
+    { 18, 17, 16, 0, 12, 77, 6143 }, // ұ
+    { 21, 21, 16, 1, 18, 111, 6220 }, // Ҳ
+    { 16, 15, 16, 0, 12, 60, 6331 }, // ҳ
+    { 17, 20, 13, 0, 15, 85, 6391 }, // Ҵ
+    { 13, 14, 18, 3, 11, 46, 6476 }, // ҵ
+    { 15, 21, 14, 2, 16, 79, 6522 }, // Ҷ
+    { 10, 15, 10, 0, 11, 38, 6601 }, // ҷ
+    { 14, 16, 14, 3, 16, 56, 6639 }, // Ҹ
+    { 9, 11, 9, 0, 11, 25, 6695 }, // ҹ
+    { 15, 19, 14, 0, 18, 72, 6720 }, // Һ
+    { 15, 18, 18, 1, 18, 68, 6792 }, // һ
+    { 24, 17, 29, 4, 16, 102, 6860 }, // Ҽ
+    { 17, 12, 15, 1, 12, 51, 6962 }, // ҽ
+    { 24, 20, 19, 5, 16, 120, 7013 }, // Ҿ
+    { 17, 15, 13, 2, 12, 64, 7133 }, // ҿ
+    { 10, 18, 11, 1, 18, 45, 7197 }, // Ӏ
+    { 30, 28, 31, 0, 28, 210, 7242 }, // Ӂ
+    { 30, 24, 31, 0, 24, 180, 7452 }, // ӂ
+    { 17, 22, 15, 1, 16, 94, 7632 }, // Ӄ
+    { 12, 16, 10, -2, 12, 48, 7726 }, // ӄ
+    { 18, 21, 13, -1, 16, 95, 7774 }, // Ӆ
+    { 12, 14, 9, -1, 11, 42, 7869 }, // ӆ
+    { 20, 24, 21, 1, 18, 120, 7911 }, // Ӈ
+    { 14, 16, 15, -1, 12, 56, 8031 }, // ӈ
+    { 20, 25, 21, 1, 18, 125, 8087 }, // Ӊ
+    { 14, 17, 15, 0, 12, 60, 8212 }, // ӊ
+    { 15, 21, 14, 3, 16, 79, 8272 }, // Ӌ
+    { 9, 14, 13, 2, 11, 32, 8351 }, // ӌ
+    { 23, 26, 24, 1, 18, 150, 8383 }, // Ӎ
+    { 16, 17, 17, 0, 12, 68, 8533 }, // ӎ
+    { 8, 16, 13, 4, 15, 32, 8601 }, // ӏ
+    { 21, 25, 23, 1, 25, 132, 8633 }, // Ӑ
+    { 18, 20, 18, 1, 20, 90, 8765 }, // ӑ
+    { 20, 24, 23, 1, 24, 120, 8855 }, // Ӓ
+    { 17, 20, 18, 1, 20, 85, 8975 }, // ӓ
+    { 29, 19, 28, 1, 18, 138, 9060 }, // Ӕ
+    { 23, 13, 26, 1, 13, 75, 9198 }, // ӕ
+    { 20, 26, 18, 1, 26, 130, 9273 }, // Ӗ
+    { 17, 22, 18, 2, 22, 94, 9403 }, // ӗ
+    { 18, 18, 22, 7, 17, 81, 9497 }, // Ә
+    { 14, 14, 18, 6, 13, 49, 9578 }, // ә
+    { 18, 24, 22, 7, 23, 108, 9627 }, // Ӛ
+    { 15, 17, 18, 5, 13, 64, 9735 }, // ӛ
+    { 30, 27, 29, 3, 27, 203, 9799 }, // Ӝ
+    { 30, 23, 31, 0, 23, 173, 10002 }, // ӝ
+    { 16, 26, 13, 1, 25, 104, 10175 }, // Ӟ
+    { 15, 16, 9, -2, 16, 60, 10279 }, // ӟ
+    { 14, 17, 14, 2, 16, 60, 10339 }, // Ӡ
+    { 13, 17, 14, 1, 12, 56, 10399 }, // ӡ
+    { 19, 24, 19, 1, 24, 114, 10455 }, // Ӣ
+    { 17, 20, 14, 0, 19, 85, 10569 }, // ӣ
+    { 19, 23, 20, 1, 23, 110, 10654 }, // Ӥ
+    { 16, 19, 14, 0, 18, 76, 10764 }, // ӥ
+    { 21, 25, 23, 2, 24, 132, 10840 }, // Ӧ
+    { 15, 21, 18, 2, 21, 79, 10972 }, // ӧ
+    { 18, 17, 23, 3, 17, 77, 11051 }, // Ө
+    { 14, 12, 18, 2, 12, 42, 11128 }, // ө
+    { 18, 23, 23, 3, 23, 104, 11170 }, // Ӫ
+    { 15, 18, 18, 2, 18, 68, 11274 }, // ӫ
+    { 31, 27, 20, 1, 25, 210, 11342 }, // Ӭ
+    { 13, 18, 13, 2, 17, 59, 11552 }, // ӭ
+    { 18, 27, 17, 0, 25, 122, 11611 }, // Ӯ
+    { 18, 28, 19, 1, 22, 126, 11733 }, // ӯ
+    { 18, 26, 17, 0, 24, 117, 11859 }, // Ӱ
+    { 17, 27, 19, 1, 21, 115, 11976 }, // ӱ
+    { 20, 26, 17, 0, 24, 130, 12091 }, // Ӳ
+    { 22, 27, 19, 1, 21, 149, 12221 }, // ӳ
+    { 14, 20, 14, 3, 20, 70, 12370 }, // Ӵ
+    { 11, 15, 9, 0, 15, 42, 12440 }, // ӵ
+    { 17, 19, 14, 0, 16, 81, 12482 }, // Ӷ
+    { 12, 13, 9, -2, 11, 39, 12563 }, // ӷ
+    { 23, 28, 24, 1, 27, 161, 12602 }, // Ӹ
+    { 18, 23, 18, -1, 22, 104, 12763 }, // ӹ
+    { 22, 21, 23, 1, 18, 116, 12867 }, // Ӽ
+    { 15, 14, 16, -1, 12, 53, 12983 }, // ӽ
+    { 0, 0, 14, 0, 0, 0, 13036 }, //  
+    { 0, 0, 24, 0, 0, 0, 13036 }, //  
+    { 0, 0, 14, 0, 0, 0, 13036 }, //  
+    { 0, 0, 24, 0, 0, 0, 13036 }, //  
+    { 0, 0, 10, 0, 0, 0, 13036 }, //  
+    { 0, 0, 9, 0, 0, 0, 13036 }, //  
+    { 0, 0, 7, 0, 0, 0, 13036 }, //  
+    { 0, 0, 15, 0, 0, 0, 13036 }, //  
+    { 0, 0, 5, 0, 0, 0, 13036 }, //  
+    { 0, 0, 8, 0, 0, 0, 13036 }, //  
+    { 0, 0, 6, 0, 0, 0, 13036 }, //  
+    { 0, 0, 3, 0, 0, 0, 13036 }, // ​
+    { 0, 0, 0, 0, 0, 0, 13036 }, // ‌
+    { 0, 0, 0, 0, 0, 0, 13036 }, // ‍
+    { 0, 0, 0, 0, 0, 0, 13036 }, // ‎
+    { 0, 0, 0, 0, 0, 0, 13036 }, // ‏
+    { 12, 3, 11, 1, 8, 9, 13036 }, // ‐
+    { 12, 3, 11, 1, 8, 9, 13045 }, // ‑
+    { 18, 3, 11, -1, 8, 14, 13054 }, // ‒
+    { 16, 5, 17, 2, 9, 20, 10982 }, // –
+    { 23, 5, 24, 2, 9, 29, 11002 }, // —
+    { 23, 5, 24, 2, 9, 29, 13068 }, // ―
+    { 15, 19, 11, 1, 15, 72, 13097 }, // ‖
+    { 20, 8, 11, -5, -1, 40, 13169 }, // ‗
+    { 9, 8, 9, 4, 19, 18, 11031 }, // ‘
+    { 9, 8, 9, 4, 19, 18, 11049 }, // ’
+    { 9, 8, 7, -1, 4, 18, 13209 }, // ‚
+    { 9, 8, 9, 4, 19, 18, 13227 }, // ‛
+    { 16, 8, 16, 4, 19, 32, 11067 }, // “
+    { 16, 8, 16, 4, 19, 32, 11099 }, // ”
+    { 9, 8, 7, -1, 4, 18, 13245 }, // „
+    { 16, 8, 16, 4, 19, 32, 13263 }, // ‟
+    { 13, 30, 17, 5, 22, 98, 13295 }, // †
+    { 15, 29, 18, 4, 21, 109, 13393 }, // ‡
+    { 18, 16, 11, -2, 19, 72, 13502 }, // •
+    { 7, 8, 13, 4, 10, 14, 13574 }, // ‣
+    { 7, 5, 13, 3, 5, 9, 13588 }, // ․
+    { 7, 5, 13, 3, 5, 9, 13597 }, // ‥
+    { 20, 5, 20, 0, 5, 25, 11131 }, // …
+    { 4, 3, 11, 4, 8, 3, 13606 }, // ‧
+    { 0, 0, 23, 0, 0, 0, 13609 }, //  
+    { 19, 19, 24, 3, 17, 91, 13609 }, // ‰
+    { 10, 8, 11, 6, 19, 20, 13700 }, // ′
+    { 16, 8, 16, 6, 19, 32, 13720 }, // ″
+    { 16, 7, 9, -2, 18, 28, 13752 }, // ‴
+    { 6, 7, 9, 5, 18, 11, 13780 }, // ‵
+    { 9, 7, 9, 4, 18, 16, 13791 }, // ‶
+    { 16, 7, 9, 0, 18, 28, 13807 }, // ‷
+    { 12, 5, 14, 4, 18, 15, 13835 }, // ‸
+    { 9, 12, 9, 2, 12, 27, 13850 }, // ‹
+    { 9, 12, 9, -2, 12, 27, 13877 }, // ›
+    { 28, 28, 28, 1, 22, 196, 13904 }, // ※
+    { 12, 27, 13, 2, 24, 81, 14100 }, // ‼
+    { 17, 33, 18, 3, 28, 141, 14181 }, // ‽
+    { 12, 3, 11, 4, 18, 9, 14322 }, // ‾
+    { 11, 4, 16, 4, 14, 11, 14331 }, // ‿
+    { 16, 15, 13, 1, 19, 60, 14342 }, // ⁂
+    { 20, 18, 27, 4, 16, 90, 14402 }, // ⁄
+    { 29, 27, 31, 5, 24, 196, 14492 }, // ⁇
+    { 24, 28, 25, 4, 24, 168, 14688 }, // ⁈
+    { 23, 27, 16, -2, 24, 156, 14856 }, // ⁉
+    { 23, 36, 19, -1, 25, 207, 15012 }, // ⁒
+    { 0, 0, 97, 0, 0, 0, 15219 }, //  
+    { 7, 9, 7, 8, 18, 16, 15219 }, // ⁰
+    { 7, 8, 7, 8, 18, 14, 15235 }, // ⁴
+    { 8, 9, 7, 7, 18, 18, 15249 }, // ⁵
+    { 8, 9, 7, 7, 18, 18, 15267 }, // ⁶
+    { 7, 9, 8, 9, 18, 16, 15285 }, // ⁷
+    { 8, 9, 8, 7, 18, 18, 15301 }, // ⁸
+    { 8, 10, 8, 7, 18, 20, 15319 }, // ⁹
+    { 15, 13, 18, 1, 13, 49, 15339 }, // ⁿ
+    { 8, 9, 7, -6, 5, 18, 15388 }, // ₀
+    { 7, 9, 7, -7, 5, 16, 15406 }, // ₁
+    { 8, 9, 8, -7, 5, 18, 15422 }, // ₂
+    { 8, 9, 7, -7, 5, 18, 15440 }, // ₃
+    { 7, 8, 8, -6, 5, 14, 15458 }, // ₄
+    { 8, 9, 7, -7, 5, 18, 15472 }, // ₅
+    { 8, 9, 8, -7, 5, 18, 15490 }, // ₆
+    { 7, 10, 8, -5, 6, 18, 15508 }, // ₇
+    { 9, 9, 8, -7, 5, 21, 15526 }, // ₈
+    { 9, 9, 8, -7, 5, 21, 15547 }, // ₉
+    { 15, 29, 10, 1, 22, 109, 15568 }, // ₍
+    { 14, 29, 9, -6, 22, 102, 15677 }, // ₎
+    { 20, 27, 20, 2, 23, 135, 15779 }, // ₡
+    { 18, 19, 20, 2, 19, 86, 15914 }, // ₢
+    { 17, 19, 14, 0, 18, 81, 16000 }, // ₤
+    { 24, 18, 21, -1, 18, 108, 16081 }, // ₦
+    { 20, 18, 19, 1, 18, 90, 16189 }, // ₧
+    { 25, 19, 27, -1, 18, 119, 16279 }, // ₨
+    { 20, 18, 18, -2, 18, 90, 16398 }, // ₩
+    { 20, 16, 22, 3, 16, 80, 16488 }, // ₪
+    { 19, 18, 11, -2, 17, 86, 16568 }, // ₫
+    { 17, 20, 17, 1, 17, 85, 16654 }, // €
+    { 17, 18, 21, 5, 18, 77, 16739 }, // ₮
+    { 23, 18, 13, 0, 18, 104, 16816 }, // ₱
+    { 19, 27, 24, 2, 23, 129, 16920 }, // ₲
+    { 24, 18, 22, 6, 17, 108, 0 }, // ₴
+    { 12, 17, 12, 2, 15, 51, 108 }, // ₵
+    { 20, 19, 21, 5, 19, 95, 159 }, // ₸
+    { 14, 17, 14, 3, 16, 60, 254 }, // ₹
+    { 14, 16, 14, 1, 14, 56, 314 }, // ₺
+    { 16, 18, 17, 3, 17, 72, 370 }, // ₼
+    { 21, 18, 19, -3, 18, 95, 442 }, // ₽
+    { 15, 15, 15, -4, 11, 57, 537 }, // ←
+    { 15, 15, 16, 2, 14, 57, 594 }, // ↑
+    { 15, 15, 16, 4, 11, 57, 651 }, // →
+    { 15, 15, 16, 6, 14, 57, 708 }, // ↓
+    { 24, 12, 21, -1, 10, 72, 765 }, // ↔
+    { 13, 23, 17, 3, 22, 75, 837 }, // ↕
+    { 15, 10, 16, -2, 10, 38, 912 }, // ↖
+    { 14, 10, 13, 2, 10, 35, 950 }, // ↗
+    { 12, 14, 13, 4, 12, 42, 985 }, // ↘
+    { 11, 14, 13, -2, 12, 39, 1027 }, // ↙
+    { 17, 14, 20, 1, 13, 60, 1066 }, // ⇐
+    { 18, 17, 22, 4, 16, 77, 1126 }, // ⇑
+    { 17, 14, 20, 3, 13, 60, 1203 }, // ⇒
+    { 18, 17, 22, 8, 15, 77, 1263 }, // ⇓
+    { 21, 14, 23, 1, 13, 74, 1340 }, // ⇔
+    { 15, 21, 19, 5, 12, 79, 1414 }, // ⇕
+    { 17, 19, 14, 1, 18, 81, 1493 }, // ∂
+    { 23, 20, 23, 0, 19, 115, 1574 }, // ∅
+    { 18, 17, 18, 0, 16, 77, 1689 }, // ∆
+    { 17, 16, 15, 2, 15, 68, 1766 }, // ∏
+    { 17, 17, 15, 6, 16, 73, 1834 }, // ∐
+    { 16, 16, 12, 0, 15, 64, 1907 }, // ∑
+    { 12, 4, 13, 1, 8, 12, 1971 }, // −
+    { 22, 19, 20, 2, 18, 105, 1983 }, // √
+    { 19, 12, 19, 2, 14, 57, 2088 }, // ∞
+    { 21, 23, 18, 0, 17, 121, 2145 }, // ∫
+    { 9, 14, 7, 0, 14, 32, 2266 }, // ∶
+    { 15, 13, 30, 11, 12, 49, 2298 }, // ≈
+    { 20, 19, 27, 4, 17, 95, 2347 }, // ≠
+    { 20, 18, 17, -3, 16, 90, 2442 }, // ≤
+    { 20, 18, 18, 0, 16, 90, 2532 }, // ≥
+    { 21, 17, 23, 2, 17, 90, 2622 }, // ﬀ
+    { 19, 19, 20, 2, 19, 91, 2712 }, // ﬁ
+    { 19, 18, 23, 2, 18, 86, 2803 }, // ﬂ
+    { 25, 19, 28, 3, 19, 119, 2889 }, // ﬃ
+    { 27, 18, 31, 2, 18, 122, 3008 }, // ﬄ
+    { 24, 18, 25, 0, 17, 108, 3130 }, // ﬆ
 };
 
 static const EpdUnicodeInterval opendyslexic_10_bolditalicIntervals[] = {
@@ -2424,30 +2401,98 @@ static const EpdUnicodeInterval opendyslexic_10_bolditalicIntervals[] = {
     { 0x2248, 0x2248, 0x2D1 },
     { 0x2260, 0x2260, 0x2D2 },
     { 0x2264, 0x2265, 0x2D3 },
+    { 0xFB00, 0xFB04, 0x2D5 },
+    { 0xFB06, 0xFB06, 0x2DA },
 };
 
 static const EpdFontGroup opendyslexic_10_bolditalicGroups[] = {
-    { 0, 3552, 6416, 95, 0 },
-    { 3552, 3754, 7939, 96, 95 },
-    { 7306, 5410, 13107, 126, 191 },
-    { 12716, 756, 1107, 61, 317 },
-    { 13472, 8466, 17120, 213, 378 },
-    { 21938, 1282, 2357, 63, 591 },
-    { 23220, 417, 560, 20, 654 },
-    { 23637, 1096, 1807, 20, 674 },
-    { 24733, 646, 956, 16, 694 },
-    { 25379, 656, 1129, 15, 710 },
+    { 0, 5292, 11156, 151, 0 },
+    { 5292, 2648, 4571, 66, 379 },
+    { 7940, 7311, 17100, 221, 96 },
+    { 15251, 8471, 17049, 249, 365 },
+    { 23722, 1847, 3238, 44, 687 },
+};
+
+static const uint8_t opendyslexic_10_bolditalicGlyphGroups[731] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 0,
+    0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 2, 2, 2, 0,
+    0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 1, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 3, 1, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 0, 0, 3, 3, 3, 0, 0, 3, 3, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+};
+
+static const EpdLigaturePair opendyslexic_10_bolditalicLigatures[] = {
+    { 0x66, 0x66, 0xFB00 },
+    { 0x66, 0x69, 0xFB01 },
+    { 0x66, 0x6C, 0xFB02 },
+    { 0xFB00, 0x69, 0xFB03 },
+    { 0xFB00, 0x6C, 0xFB04 },
+};
+
+static const uint16_t opendyslexic_10_bolditalicGlyphLookup[368] = {
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x005F, 0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E,
+    0x006F, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E,
+    0x007F, 0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E,
+    0x008F, 0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E,
+    0x009F, 0x00A0, 0x00A1, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE,
+    0x00AF, 0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE,
+    0x024F, 0x0250, 0x0251, 0x0252, 0x0253, 0x0254, 0x0255, 0x0256, 0x0257, 0x0258, 0x0259, 0x025A, 0x025B, 0x025C, 0x025D, 0x025E,
+    0x025F, 0x0260, 0x0261, 0x0262, 0x0263, 0x0264, 0x0265, 0x0266, 0x0267, 0x0268, 0x0269, 0x026A, 0x026B, 0x026C, 0x026D, 0x026E,
+    0x026F, 0x0270, 0x0271, 0x0272, 0x0273, 0x0274, 0x0275, 0x0276, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0277,
+    0x0278, 0xFFFF, 0x0279, 0x027A, 0x027B, 0x027C, 0x027D, 0x027E, 0x027F, 0x0280, 0x0281, 0x0282, 0x0283, 0x0284, 0x0285, 0x0286,
+    0xFFFF, 0xFFFF, 0x0287, 0xFFFF, 0x0288, 0xFFFF, 0xFFFF, 0x0289, 0x028A, 0x028B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x028C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x028D,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
 };
 
 static const EpdFontData opendyslexic_10_bolditalic = {
     opendyslexic_10_bolditalicBitmaps,
     opendyslexic_10_bolditalicGlyphs,
     opendyslexic_10_bolditalicIntervals,
-    56,
+    58,
     38,
     28,
     -11,
     true,
     opendyslexic_10_bolditalicGroups,
-    10,
+    5,
+    nullptr,
+    nullptr,
+    nullptr,
+    0,
+    opendyslexic_10_bolditalicLigatures,
+    5,
+    0x4000000001ull,
+    opendyslexic_10_bolditalicGlyphLookup,
+    opendyslexic_10_bolditalicGlyphGroups,
+    false,
+    nullptr,
 };
@@ -3,1482 +3,1452 @@
  * name: opendyslexic_10_italic
  * size: 10
  * mode: 2-bit  compressed: true
- * Command used: fontconvert.py opendyslexic_10_italic 10 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Italic.otf --2bit --compress
+ * Command used: fontconvert.py opendyslexic_10_italic 10 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Italic.otf --2bit --compress --no-kerning --frequency-corpus ../../../test/hyphenation_eval/resources/english_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/french_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/german_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/italian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/russian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/spanish_hyphenation_tests.txt
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t opendyslexic_10_italicBitmaps[23517] = {
-    0x75, 0x58, 0x31, 0x8C, 0xDC, 0xC6, 0x15, 0xFD, 0xE4, 0x58, 0x47, 0x47, 0xF4, 0x69, 0x54, 0x48,
-    0x81, 0x61, 0x45, 0x62, 0x4A, 0x39, 0xD0, 0x1D, 0x5D, 0xA8, 0x38, 0x23, 0x7B, 0x4B, 0xCA, 0x2A,
-    0x5C, 0xB8, 0x88, 0x0A, 0x5D, 0x0A, 0x07, 0x88, 0x55, 0x38, 0x40, 0xA2, 0x22, 0xA7, 0xC2, 0xC5,
-    0x15, 0x7B, 0xB7, 0x94, 0x05, 0x04, 0x08, 0x54, 0xF8, 0x52, 0xD8, 0xAD, 0x0F, 0x41, 0x0A, 0xF9,
-    0x02, 0x44, 0x2A, 0x16, 0xC8, 0x21, 0x59, 0x69, 0xE7, 0xA2, 0x22, 0x4D, 0x82, 0x30, 0x30, 0x10,
-    0x17, 0x2E, 0x4C, 0x27, 0x4A, 0x82, 0x44, 0x80, 0xC5, 0x00, 0x14, 0x44, 0xC9, 0x5C, 0x4E, 0xDE,
-    0x1B, 0xEE, 0x9E, 0x64, 0x20, 0xA1, 0x76, 0xE7, 0x56, 0xC3, 0xE1, 0x9F, 0x3F, 0xFF, 0xBF, 0xFF,
-    0xFE, 0xFF, 0x14, 0x39, 0x2A, 0xBE, 0x11, 0x2D, 0xB2, 0x21, 0x7E, 0xCE, 0xBF, 0x03, 0xF1, 0x0B,
-    0xD1, 0xE9, 0xB3, 0x7F, 0x4B, 0xD1, 0x99, 0x3C, 0x27, 0xB8, 0xA2, 0x4C, 0xA6, 0x12, 0x54, 0x92,
-    0x18, 0x19, 0xEA, 0xBC, 0x49, 0xAE, 0x95, 0x77, 0xF4, 0x7E, 0x1D, 0x5F, 0x2B, 0xF1, 0x3F, 0x91,
-    0x20, 0x5D, 0xC1, 0x1A, 0x2D, 0x23, 0x8C, 0xA7, 0xA4, 0xC4, 0xB8, 0xE4, 0x15, 0x18, 0x7B, 0xCA,
-    0x88, 0x67, 0x71, 0x35, 0x3E, 0xC7, 0x4A, 0xBC, 0x12, 0x1B, 0x41, 0x7E, 0x84, 0x51, 0x99, 0x55,
-    0x8C, 0xA1, 0xE9, 0xF1, 0xD1, 0x6C, 0x4F, 0x24, 0xE6, 0x9A, 0x34, 0xE1, 0x28, 0xB2, 0xAA, 0x28,
-    0x60, 0xAC, 0x20, 0x5D, 0xEA, 0xD0, 0x88, 0x78, 0x15, 0x74, 0xF9, 0xEA, 0xB5, 0xC8, 0x5D, 0xAF,
-    0x70, 0x7F, 0x3B, 0x15, 0xB1, 0x16, 0xEA, 0xB6, 0x0F, 0x33, 0x69, 0xEF, 0xA6, 0x12, 0x7C, 0xFA,
-    0x02, 0x04, 0x9E, 0xBE, 0x22, 0x32, 0xF9, 0xAB, 0xE1, 0x3D, 0xAC, 0x9C, 0x58, 0xFC, 0xFA, 0xB5,
-    0xCD, 0x45, 0x5D, 0xC7, 0xAF, 0xC5, 0x6F, 0xDB, 0x54, 0xAE, 0xD8, 0x46, 0x61, 0xBB, 0x02, 0x9B,
-    0xB6, 0xFC, 0x91, 0x2F, 0x58, 0x7B, 0x0F, 0xF2, 0x16, 0xB1, 0xFC, 0xCC, 0x95, 0xA7, 0x3B, 0x29,
-    0x7E, 0xD3, 0x38, 0x53, 0xE9, 0xCA, 0x59, 0x95, 0xBD, 0xB8, 0xE0, 0x9B, 0x45, 0xFF, 0x5D, 0xA3,
-    0xCE, 0xED, 0x1B, 0xB1, 0x9F, 0xC3, 0x7A, 0x7F, 0xA6, 0xB2, 0x16, 0xFA, 0x55, 0xAF, 0xE0, 0xBB,
-    0x48, 0xC5, 0x45, 0x7E, 0x0B, 0xFB, 0x8E, 0xB0, 0xD3, 0x06, 0x8C, 0xB7, 0x72, 0x20, 0xCA, 0x9B,
-    0x64, 0xA2, 0x9E, 0x8C, 0x45, 0xE5, 0x1A, 0xE6, 0x80, 0x81, 0x06, 0x01, 0xCC, 0x7D, 0x1D, 0x02,
-    0xA0, 0x99, 0x0C, 0x21, 0x03, 0xE7, 0x90, 0x36, 0x92, 0x4B, 0x77, 0xBC, 0x72, 0x90, 0xC8, 0xF2,
-    0x96, 0x36, 0xBE, 0x55, 0xB5, 0x67, 0x71, 0x0A, 0x6B, 0x22, 0x3B, 0x7D, 0x45, 0x26, 0xF7, 0x3A,
-    0x59, 0xC9, 0xF9, 0x3A, 0xBE, 0x5A, 0x6B, 0xD3, 0x88, 0x9C, 0xA4, 0x23, 0x61, 0x7A, 0x08, 0x0C,
-    0x33, 0xBA, 0xB3, 0x37, 0x9B, 0x80, 0x23, 0x30, 0xC7, 0xE9, 0x94, 0xD3, 0x9A, 0x1E, 0xE2, 0xEA,
-    0x25, 0xF7, 0xE9, 0xCD, 0x3F, 0xAB, 0xEE, 0x83, 0x99, 0x65, 0x38, 0xDB, 0x7D, 0x70, 0x9D, 0x75,
-    0x33, 0x9A, 0xBE, 0xA2, 0x1C, 0xFA, 0xB7, 0x37, 0x9F, 0x82, 0x38, 0xCC, 0x02, 0x3A, 0xBC, 0x51,
-    0xBA, 0xCF, 0xC8, 0x6D, 0xB9, 0xF1, 0x8C, 0xD4, 0xEE, 0x33, 0x70, 0x1F, 0x78, 0xB8, 0x86, 0x71,
-    0x28, 0x17, 0x90, 0xBA, 0x22, 0xAF, 0xED, 0x5F, 0xFF, 0xE3, 0x20, 0x68, 0x25, 0x28, 0xBD, 0x2F,
-    0x6F, 0x2F, 0xAF, 0xBC, 0x73, 0x34, 0x97, 0x00, 0xF7, 0x9E, 0x27, 0x2C, 0x7B, 0xA2, 0xB2, 0xCB,
-    0xBF, 0xF9, 0xD0, 0xB6, 0x10, 0x7B, 0x44, 0xBC, 0x5C, 0xCE, 0x88, 0xAA, 0x62, 0xD3, 0x04, 0x45,
-    0xE2, 0xD7, 0x44, 0x8D, 0x6D, 0xE1, 0xAC, 0x43, 0xFD, 0xAD, 0x3B, 0x4F, 0x7D, 0xB4, 0xCD, 0x81,
-    0xD8, 0x93, 0x77, 0x38, 0x10, 0x56, 0x78, 0x0C, 0xD7, 0x11, 0x0E, 0xA1, 0x73, 0x63, 0xE6, 0x70,
-    0x47, 0x2F, 0xE4, 0xFF, 0x63, 0xF5, 0x92, 0x38, 0x14, 0xCF, 0x87, 0xE0, 0xE9, 0xEA, 0xE2, 0x60,
-    0xF5, 0xE8, 0x60, 0xF5, 0xAA, 0x8B, 0x0B, 0xB7, 0x3A, 0xE5, 0x6A, 0x33, 0x5F, 0xED, 0x3F, 0x5D,
-    0xBD, 0x77, 0xB0, 0xC1, 0xD1, 0x99, 0xF7, 0x6F, 0xC0, 0x64, 0xB7, 0x64, 0xA4, 0xD2, 0x53, 0xB2,
-    0xA2, 0x8C, 0xCA, 0x36, 0xCE, 0xAE, 0xE8, 0x37, 0x5E, 0x4F, 0xCB, 0x72, 0x14, 0x1D, 0xD6, 0x7E,
-    0xE9, 0x17, 0xB1, 0x6C, 0xAA, 0x32, 0x32, 0xB1, 0xAD, 0x7C, 0x1C, 0x5F, 0x03, 0x54, 0xB1, 0x3B,
-    0x99, 0x44, 0x46, 0xB5, 0xF2, 0xFC, 0x88, 0x7B, 0x44, 0x94, 0xAC, 0x5C, 0xF4, 0xE2, 0xAF, 0x8B,
-    0xDE, 0x31, 0xE0, 0x7D, 0xD7, 0x5A, 0x6D, 0x6B, 0x59, 0xB8, 0x01, 0x0C, 0xB5, 0x12, 0x6E, 0x0F,
-    0x3A, 0x7D, 0xE1, 0x23, 0x77, 0xA0, 0x86, 0xD1, 0x06, 0x68, 0x41, 0x54, 0x21, 0x3E, 0xFE, 0x4C,
-    0x72, 0x09, 0x31, 0x39, 0xB4, 0x25, 0xC2, 0xD3, 0x68, 0x3C, 0x23, 0x27, 0xF0, 0xFD, 0xD7, 0x3A,
-    0x63, 0xAB, 0x73, 0xBF, 0x67, 0x1C, 0x5E, 0x7E, 0x59, 0x48, 0x88, 0x10, 0x93, 0x2D, 0x71, 0xAE,
-    0xE4, 0xE1, 0xC2, 0xEC, 0x39, 0xEF, 0xB6, 0x24, 0xB6, 0xA0, 0x9A, 0x0B, 0xB6, 0x8B, 0x4D, 0x8F,
-    0xBA, 0x79, 0x8D, 0x9C, 0x2A, 0xBC, 0x47, 0x69, 0xB4, 0xE4, 0x95, 0x65, 0xA4, 0xF6, 0x1F, 0xAE,
-    0xBF, 0x65, 0xED, 0xEE, 0xCD, 0xC7, 0x12, 0x53, 0x07, 0x55, 0x4A, 0x9C, 0xC9, 0xF1, 0xB5, 0x54,
-    0xD9, 0x86, 0xA6, 0x09, 0x3B, 0x71, 0x70, 0x92, 0xF7, 0x24, 0x85, 0x3C, 0xE3, 0x11, 0x82, 0x1E,
-    0xA6, 0xB0, 0x5C, 0x15, 0x8B, 0x0B, 0x8D, 0xE7, 0x58, 0x21, 0xF7, 0x2C, 0xED, 0x7A, 0x39, 0x93,
-    0x49, 0x23, 0xFD, 0x39, 0x2A, 0x65, 0xE3, 0x07, 0xC2, 0x33, 0xB7, 0x41, 0x1E, 0x65, 0xCB, 0x7E,
-    0xE9, 0x15, 0x4B, 0xB2, 0xA4, 0x72, 0x65, 0x96, 0xA5, 0xF6, 0x5A, 0x8B, 0x7B, 0x46, 0x62, 0x3E,
-    0x07, 0x21, 0xFB, 0x6F, 0xDE, 0xA4, 0x3D, 0xF0, 0xD4, 0x32, 0xB7, 0x04, 0x9D, 0x6C, 0x52, 0x9B,
-    0x28, 0x85, 0x56, 0x61, 0x21, 0x89, 0xF8, 0x8D, 0x90, 0xCD, 0xBC, 0x36, 0x95, 0xD5, 0x20, 0x55,
-    0x46, 0x43, 0xAB, 0x1E, 0x74, 0x2C, 0xFC, 0x5C, 0xA7, 0xC1, 0x7E, 0x0D, 0xD8, 0x65, 0xB2, 0x3E,
-    0x95, 0x30, 0xDF, 0x84, 0xBD, 0xF7, 0x54, 0x4E, 0x22, 0x8B, 0xD2, 0x2D, 0x3C, 0x07, 0xFB, 0xC9,
-    0x10, 0x51, 0x19, 0xD6, 0x12, 0xFC, 0xA3, 0x94, 0x32, 0xCC, 0x7A, 0x58, 0x90, 0x85, 0xD9, 0x48,
-    0xF6, 0x42, 0x6C, 0x35, 0xF2, 0xAA, 0xD0, 0x0C, 0x71, 0xBC, 0x52, 0x26, 0x6D, 0xA7, 0xF9, 0x9E,
-    0xFF, 0xC4, 0x62, 0x22, 0x57, 0x3C, 0xD7, 0xCB, 0xD0, 0x65, 0x0A, 0xC3, 0x1D, 0x5C, 0x0B, 0x99,
-    0x36, 0x91, 0x01, 0xDD, 0x7E, 0x0B, 0x8A, 0xDD, 0xA1, 0xD3, 0x0E, 0xB8, 0xA8, 0x0A, 0x4B, 0xDC,
-    0xCB, 0x38, 0x0D, 0xE7, 0xE2, 0x1B, 0xA7, 0xCE, 0x9D, 0x38, 0xA7, 0x0F, 0x4E, 0x8B, 0x11, 0x62,
-    0x09, 0xDC, 0x11, 0x3F, 0x86, 0x14, 0xEB, 0x06, 0x84, 0x8C, 0x73, 0xDF, 0x4B, 0xDE, 0x9B, 0x37,
-    0x12, 0x67, 0x46, 0x77, 0x4D, 0xEC, 0x4F, 0x76, 0x2F, 0x8A, 0x5C, 0xC0, 0xCF, 0xDB, 0x64, 0x13,
-    0x32, 0x29, 0x97, 0x0D, 0xE7, 0x3F, 0x08, 0x88, 0xA9, 0x9C, 0xB0, 0xF9, 0x09, 0xB0, 0x62, 0x8C,
-    0xE3, 0xBD, 0xFA, 0x0C, 0x89, 0x81, 0x53, 0x97, 0xBC, 0xBA, 0x03, 0xFE, 0x80, 0x78, 0x70, 0xC1,
-    0x1D, 0xBB, 0x09, 0x1F, 0x54, 0x4F, 0x4A, 0x76, 0x89, 0x03, 0x69, 0x04, 0x67, 0x10, 0xD0, 0x9C,
-    0xBC, 0xDD, 0x3D, 0x7E, 0xC1, 0xC5, 0x8C, 0x5F, 0xB9, 0x79, 0x5E, 0x87, 0x18, 0x41, 0x11, 0x41,
-    0x14, 0x6D, 0x47, 0x2E, 0xF2, 0xCE, 0x32, 0x8C, 0x00, 0xA7, 0x8D, 0x3B, 0xE9, 0x0B, 0xA2, 0x4F,
-    0x9F, 0xF5, 0x8C, 0xFF, 0x17, 0x25, 0xA7, 0xA5, 0x97, 0x5D, 0x51, 0x69, 0xF8, 0x87, 0x48, 0x6E,
-    0x49, 0x63, 0x8B, 0x9E, 0xE8, 0xDF, 0xBD, 0x3F, 0x11, 0xE4, 0xA6, 0x85, 0x54, 0x42, 0x17, 0x72,
-    0x49, 0xFE, 0x75, 0x58, 0x85, 0xC9, 0x00, 0xEE, 0xB2, 0x8E, 0x2B, 0x76, 0x9E, 0x1A, 0x8F, 0xE4,
-    0x31, 0xE1, 0x2A, 0x28, 0xDD, 0xC7, 0x92, 0x08, 0xA1, 0xAC, 0xA1, 0x4B, 0x78, 0x0D, 0xEC, 0x63,
-    0x2A, 0x04, 0x53, 0x1F, 0xFA, 0xEA, 0xCC, 0x2B, 0xA1, 0x75, 0xCD, 0xA8, 0xDA, 0x9D, 0xC0, 0x49,
-    0xD6, 0xE0, 0x5B, 0x01, 0x29, 0xB7, 0x35, 0xF0, 0xF4, 0x5E, 0x4E, 0xBC, 0x44, 0xED, 0x36, 0x52,
-    0x56, 0x0D, 0x1E, 0xD8, 0x04, 0x4A, 0x96, 0x60, 0x83, 0x25, 0x44, 0x63, 0x4F, 0x2A, 0x0F, 0x5C,
-    0x6D, 0x73, 0xA8, 0x90, 0xAB, 0xC2, 0xAB, 0x11, 0x9E, 0x03, 0x58, 0x64, 0x0C, 0xFB, 0xD4, 0x3A,
-    0xF5, 0x6B, 0xFD, 0xFE, 0x7A, 0x19, 0x21, 0xE5, 0x20, 0xDB, 0x65, 0x09, 0xDD, 0xD3, 0x5D, 0xEB,
-    0x35, 0x03, 0x11, 0xC2, 0xFF, 0xFE, 0x43, 0xD1, 0x05, 0xBD, 0x2C, 0x3C, 0x96, 0x10, 0x9E, 0x44,
-    0xA9, 0x60, 0x17, 0xA8, 0x6A, 0xBA, 0x38, 0x06, 0x19, 0x10, 0xD2, 0xA9, 0x07, 0xA3, 0xED, 0x96,
-    0xD8, 0x8E, 0x4C, 0x81, 0xFC, 0x31, 0x44, 0x4C, 0x01, 0x60, 0xB3, 0x44, 0x49, 0x0D, 0xE1, 0x64,
-    0x9C, 0x8A, 0xB9, 0x57, 0x4B, 0x54, 0x42, 0xC9, 0x10, 0x5A, 0x01, 0x90, 0x38, 0x73, 0x42, 0xB7,
-    0x35, 0x38, 0xA7, 0xC2, 0x81, 0x21, 0x1A, 0x84, 0xB6, 0x85, 0xB8, 0x03, 0xBE, 0x80, 0x65, 0x93,
-    0x7C, 0xF7, 0xE6, 0x94, 0x19, 0xA7, 0x08, 0x28, 0x3D, 0xA6, 0x74, 0x6B, 0x1D, 0x13, 0x79, 0x6B,
-    0x14, 0x68, 0xB0, 0x6B, 0xE1, 0x08, 0x6E, 0x75, 0xC6, 0x83, 0x24, 0x17, 0x05, 0xF5, 0x5D, 0xB6,
-    0x1D, 0xC2, 0x99, 0xFD, 0x19, 0x37, 0x12, 0x21, 0x04, 0x81, 0xB4, 0xBB, 0x3B, 0xB8, 0x31, 0xA5,
-    0xB4, 0xD4, 0xE9, 0x2B, 0x0B, 0x93, 0x29, 0x34, 0x6F, 0xDC, 0x32, 0x40, 0xC7, 0x3D, 0x42, 0x79,
-    0x5B, 0xBB, 0x29, 0xC4, 0x10, 0x64, 0xA9, 0x57, 0x75, 0x4F, 0xD3, 0x08, 0xC4, 0x50, 0x98, 0x77,
-    0x76, 0xA0, 0x09, 0xC0, 0x24, 0x92, 0xA4, 0x07, 0x31, 0x03, 0x61, 0xD0, 0xB6, 0xF0, 0x5B, 0x18,
-    0x66, 0x98, 0x76, 0xCB, 0x5C, 0xBE, 0x20, 0xCC, 0xF8, 0xAC, 0xC3, 0xB9, 0x36, 0xEA, 0xC9, 0x85,
-    0x46, 0xE2, 0x16, 0xB7, 0xF5, 0xCF, 0x1A, 0x70, 0x0D, 0xF8, 0xB0, 0xCF, 0xB3, 0xE6, 0x50, 0xAA,
-    0x71, 0xEE, 0x96, 0x75, 0x82, 0xF1, 0x90, 0xC8, 0xB1, 0xAE, 0x14, 0x8A, 0xC8, 0xB0, 0x31, 0xF1,
-    0xD3, 0x47, 0x25, 0x02, 0x5F, 0x40, 0xA3, 0x31, 0x55, 0x02, 0xA1, 0x15, 0x18, 0x82, 0x02, 0xFB,
-    0xE8, 0x9C, 0x35, 0x84, 0x71, 0x03, 0xF4, 0xB0, 0x59, 0xC8, 0x82, 0x06, 0x94, 0x32, 0xA4, 0xB2,
-    0x13, 0x89, 0x0D, 0x22, 0x2A, 0xC9, 0x18, 0x19, 0x51, 0x16, 0xE4, 0x3E, 0x9F, 0xEE, 0xC3, 0xC1,
-    0xA1, 0x51, 0x04, 0xDB, 0x26, 0x36, 0xD0, 0xC6, 0x49, 0x9A, 0xE2, 0x91, 0xD8, 0x84, 0xF3, 0x48,
-    0xE5, 0x91, 0x93, 0xCE, 0xF3, 0x41, 0xDE, 0x19, 0xAA, 0xE9, 0x0E, 0x34, 0xFB, 0xC9, 0x62, 0x09,
-    0x2C, 0x30, 0xFF, 0x49, 0xCC, 0x8C, 0x9F, 0xFE, 0x6C, 0x1C, 0xE3, 0x47, 0xF0, 0xCA, 0x84, 0x58,
-    0x48, 0xE5, 0x30, 0x43, 0x5E, 0x15, 0x71, 0x8A, 0xA3, 0x67, 0x32, 0xC6, 0xB7, 0x0F, 0x5B, 0x44,
-    0xF8, 0x86, 0x7F, 0x42, 0xAD, 0x70, 0x1F, 0x49, 0x9D, 0xCE, 0x21, 0x53, 0x24, 0x0C, 0x12, 0x08,
-    0x20, 0x91, 0xAA, 0xFB, 0x35, 0x82, 0x16, 0x62, 0x1A, 0xCC, 0xF6, 0x91, 0xBA, 0xE3, 0x14, 0x26,
-    0x33, 0xBC, 0xBD, 0x90, 0xB9, 0xDD, 0x2A, 0xB7, 0x6F, 0xDF, 0xB9, 0x1D, 0x5E, 0xA7, 0xCB, 0x6A,
-    0xC7, 0x0E, 0x31, 0x6B, 0x3C, 0x2A, 0x4F, 0x4F, 0x36, 0x6B, 0x6F, 0x0F, 0x6D, 0x0B, 0x10, 0x7C,
-    0x87, 0x96, 0x5E, 0xD8, 0x11, 0x7F, 0x87, 0xE4, 0x83, 0x98, 0xB4, 0x29, 0x88, 0x0C, 0x82, 0x75,
-    0x2D, 0x71, 0xCD, 0x82, 0xC8, 0x96, 0xA1, 0x95, 0xE0, 0x81, 0x49, 0x60, 0xFD, 0xA1, 0x7A, 0x04,
-    0x33, 0x4D, 0xA3, 0x0F, 0xB3, 0xE0, 0xE3, 0xAA, 0xB9, 0x2D, 0xB1, 0x7E, 0xF0, 0x31, 0x4C, 0x98,
-    0xB4, 0x91, 0x09, 0xCA, 0x49, 0x69, 0x25, 0xBE, 0x6A, 0xCF, 0xC3, 0x76, 0x41, 0x13, 0xE5, 0x01,
-    0x28, 0xD2, 0xA6, 0xB1, 0x79, 0x59, 0x35, 0x8E, 0x85, 0x1C, 0x35, 0xC8, 0x4B, 0xCC, 0x4D, 0x9A,
-    0xAE, 0x50, 0xDC, 0x0E, 0xBA, 0x44, 0x15, 0xC9, 0xBF, 0x85, 0xCA, 0xEA, 0x81, 0x89, 0xC5, 0x7B,
-    0x84, 0xE7, 0xA4, 0xB9, 0x0D, 0xD3, 0x26, 0xD1, 0x6B, 0xB8, 0x7D, 0xAD, 0x60, 0x4E, 0x68, 0xB6,
-    0x70, 0x94, 0x38, 0x4E, 0xFD, 0x26, 0xFC, 0x0C, 0x3E, 0x64, 0x26, 0x4A, 0xD2, 0xA4, 0x82, 0x8B,
-    0x34, 0x6E, 0x97, 0xBE, 0x63, 0xE7, 0xB8, 0x95, 0x2E, 0xDA, 0xA4, 0x4D, 0x27, 0xE4, 0x4E, 0x38,
-    0x7E, 0x2A, 0x60, 0xC8, 0x2D, 0x5A, 0x24, 0x91, 0x2E, 0xE8, 0x54, 0xCE, 0x30, 0xA9, 0x68, 0xAC,
-    0x31, 0x6D, 0xD3, 0xA7, 0xB5, 0xE2, 0x94, 0xB4, 0x82, 0xFC, 0xFE, 0xC1, 0x24, 0x77, 0x31, 0xC7,
-    0x08, 0x29, 0x19, 0x65, 0x58, 0x76, 0xC2, 0x1E, 0xD4, 0xBD, 0x21, 0x68, 0x18, 0x93, 0xA9, 0x90,
-    0x9D, 0x06, 0xE0, 0x9A, 0x3E, 0xA2, 0x5A, 0xA7, 0x61, 0x16, 0x98, 0x13, 0x24, 0x9C, 0x42, 0x1C,
-    0x09, 0x7C, 0xD4, 0xE1, 0x82, 0xE8, 0x27, 0x46, 0x5C, 0x04, 0x38, 0x5E, 0xA7, 0x96, 0x98, 0xD4,
-    0x1D, 0xAE, 0x40, 0xED, 0x4C, 0x8B, 0x70, 0x7A, 0x15, 0x30, 0x29, 0x3B, 0x5C, 0x43, 0x27, 0x2C,
-    0xAF, 0xE9, 0xA6, 0x9A, 0x4A, 0xD6, 0x0C, 0x5E, 0x32, 0x82, 0x47, 0x92, 0x20, 0x35, 0xB2, 0x72,
-    0xCD, 0x9E, 0xD7, 0x46, 0xE7, 0x89, 0x8B, 0x62, 0x47, 0x3D, 0x0D, 0xF5, 0xC2, 0x33, 0x37, 0x39,
-    0xD0, 0x77, 0xD8, 0x85, 0x5B, 0x2E, 0xEC, 0xB2, 0x3A, 0xDF, 0x86, 0xE6, 0x15, 0x92, 0xE9, 0x00,
-    0x85, 0x67, 0x0F, 0x45, 0x59, 0xCF, 0xFD, 0xDB, 0xC0, 0x4E, 0x23, 0xF4, 0x14, 0x96, 0xB9, 0xDD,
-    0x92, 0xB3, 0x33, 0x72, 0x4F, 0x50, 0x06, 0x40, 0x7E, 0x90, 0x6B, 0xFC, 0x8B, 0xB0, 0x4B, 0x6C,
-    0xA2, 0x3C, 0xC9, 0x98, 0x9C, 0x62, 0x10, 0x1B, 0x19, 0x37, 0x6C, 0x77, 0x53, 0x06, 0x91, 0x3B,
-    0xA5, 0xEB, 0x10, 0x48, 0x1B, 0x8A, 0xEC, 0x14, 0xD1, 0x62, 0x91, 0x63, 0x16, 0x72, 0xBF, 0xAE,
-    0x5D, 0x5D, 0x7E, 0x4C, 0x86, 0x15, 0x63, 0x91, 0x5D, 0x88, 0x19, 0xC2, 0x4E, 0xDE, 0xA4, 0xDD,
-    0x9E, 0x65, 0x9E, 0xB5, 0xB5, 0x35, 0xDE, 0xBA, 0x4B, 0xB3, 0xA7, 0x5F, 0x61, 0xAB, 0x7A, 0x46,
-    0xBA, 0x5F, 0xB1, 0x65, 0x35, 0x23, 0x60, 0x86, 0x23, 0xD9, 0x87, 0x05, 0x03, 0x61, 0xDE, 0xE5,
-    0xEE, 0xCB, 0xE2, 0xFF, 0xC2, 0x11, 0x81, 0x0B, 0x7A, 0x54, 0x14, 0x35, 0x01, 0x97, 0x23, 0x7E,
-    0x13, 0xFC, 0xC3, 0x6F, 0x30, 0x45, 0x0E, 0x39, 0x71, 0x57, 0x75, 0x8C, 0xF1, 0x3F, 0xD6, 0x43,
-    0x8C, 0x8D, 0x86, 0x2C, 0x41, 0x43, 0x58, 0x72, 0x58, 0x4D, 0xA3, 0x22, 0x24, 0x99, 0xBA, 0xDD,
-    0x75, 0x5A, 0xE4, 0xF0, 0x5B, 0xC8, 0x53, 0x77, 0x51, 0xCE, 0x17, 0x35, 0xB6, 0x44, 0x9E, 0xAA,
-    0xB4, 0xF1, 0x1A, 0xC7, 0x41, 0x0D, 0x6A, 0x81, 0x04, 0x02, 0xE0, 0x93, 0x94, 0x85, 0xB2, 0x4C,
-    0x41, 0x38, 0xC9, 0x7B, 0xA8, 0xDA, 0xE0, 0x0F, 0x9F, 0x98, 0x44, 0xD1, 0x24, 0x31, 0x2B, 0xC0,
-    0x76, 0x96, 0x53, 0x10, 0xF6, 0x1C, 0x6B, 0x8E, 0x7E, 0x49, 0xF2, 0x00, 0x21, 0x38, 0x16, 0xA7,
-    0x72, 0x3A, 0x8B, 0x09, 0x71, 0xA8, 0x66, 0xB3, 0x2D, 0x49, 0x7C, 0x8B, 0x1E, 0x23, 0x09, 0x2C,
-    0x6A, 0xA0, 0x44, 0x7F, 0x86, 0xA8, 0x4B, 0x92, 0xEB, 0x9F, 0x20, 0x08, 0x26, 0xE1, 0x03, 0xEC,
-    0x33, 0x0D, 0x00, 0xD1, 0xA4, 0x0E, 0x2C, 0xE9, 0x02, 0xD1, 0x8B, 0x60, 0x46, 0xD8, 0x81, 0xE9,
-    0x14, 0xB5, 0xF7, 0x33, 0x39, 0x9C, 0x82, 0x19, 0x90, 0x00, 0x63, 0xE6, 0x88, 0xC0, 0x45, 0x80,
-    0xEB, 0xE9, 0x62, 0x0E, 0xC1, 0x7D, 0x7A, 0x90, 0x2E, 0x93, 0x98, 0x83, 0x4B, 0xE3, 0xAE, 0x5C,
-    0x09, 0xD9, 0xB0, 0x85, 0x8F, 0x98, 0xC9, 0xCB, 0x96, 0x03, 0x0E, 0x16, 0x96, 0x10, 0x1A, 0x02,
-    0x34, 0x1C, 0xA2, 0x9C, 0xC9, 0xA2, 0x82, 0xB1, 0xAE, 0x81, 0x8E, 0x43, 0x13, 0xA2, 0x08, 0x84,
-    0xB6, 0x34, 0x49, 0x22, 0xEA, 0x51, 0xE5, 0x0A, 0x36, 0xD2, 0x13, 0xD3, 0x3D, 0x24, 0x06, 0x65,
-    0xE7, 0xB4, 0x69, 0xB7, 0x0B, 0x66, 0xBB, 0xD0, 0xA5, 0xD5, 0x33, 0x64, 0x26, 0x28, 0xA1, 0x1D,
-    0x8C, 0x25, 0x70, 0x5D, 0x86, 0x83, 0x71, 0x35, 0x1F, 0x22, 0x0E, 0x71, 0x39, 0x1F, 0xC8, 0x8C,
-    0x32, 0x2C, 0xE6, 0xC3, 0xC4, 0xB5, 0x80, 0x0F, 0xD7, 0x2E, 0x50, 0x8E, 0x4B, 0x71, 0x2E, 0x3A,
-    0xDC, 0xB9, 0xA8, 0x02, 0x63, 0x62, 0x75, 0x56, 0x3E, 0x33, 0x6B, 0x56, 0x5D, 0xDD, 0xEB, 0x32,
-    0x5B, 0xDE, 0x55, 0x84, 0x44, 0x1E, 0x9B, 0x5C, 0x3D, 0x4B, 0xA8, 0xFD, 0x59, 0xAB, 0xF1, 0xCC,
-    0x23, 0xAC, 0x8B, 0xD9, 0x5F, 0xF0, 0x11, 0x2E, 0x67, 0xD5, 0x45, 0xD0, 0x72, 0x39, 0xDD, 0x9B,
-    0x60, 0x97, 0xE3, 0x60, 0xF7, 0xA3, 0x97, 0x76, 0x8A, 0x5B, 0xBC, 0x46, 0xA3, 0xBD, 0x8D, 0x01,
-    0xAE, 0x77, 0x2E, 0x39, 0x85, 0xA9, 0x0E, 0x9F, 0x89, 0x66, 0x79, 0x76, 0xAF, 0x13, 0xA9, 0xFE,
-    0xCF, 0xF4, 0x4C, 0xA1, 0x68, 0xA6, 0x48, 0xF5, 0xCC, 0xF4, 0x2C, 0x61, 0xCF, 0xA6, 0xA9, 0x13,
-    0x09, 0x1F, 0xDC, 0xA4, 0x61, 0xD2, 0xE3, 0x17, 0x51, 0x3F, 0x57, 0xFE, 0x27, 0xE7, 0xCC, 0x69,
-    0x5A, 0x0A, 0x36, 0x65, 0xE4, 0xD1, 0xD4, 0x03, 0xAF, 0x0C, 0xCD, 0xAC, 0xE4, 0xF9, 0x29, 0xAC,
-    0x94, 0x87, 0xD9, 0xD8, 0x2B, 0x94, 0xE9, 0xA1, 0x4A, 0x4A, 0x83, 0xEC, 0x16, 0x8A, 0x24, 0xD0,
-    0x61, 0x1D, 0x95, 0xB0, 0x9D, 0x0C, 0xDB, 0xD2, 0x6B, 0xBF, 0x2F, 0xDE, 0x3D, 0x97, 0x56, 0x1C,
-    0x85, 0x52, 0x55, 0xEA, 0x30, 0x3E, 0x2E, 0xFD, 0x49, 0xA1, 0x1F, 0xFF, 0x58, 0x55, 0x6A, 0xBF,
-    0x92, 0x72, 0x2C, 0x3D, 0xA4, 0x52, 0x50, 0xEC, 0xF9, 0x32, 0xDA, 0x77, 0xF5, 0x9A, 0x21, 0x2A,
-    0x9F, 0x9B, 0x6D, 0x85, 0xCC, 0x9E, 0x36, 0x44, 0x5F, 0x8F, 0x4F, 0xE3, 0xA8, 0xCB, 0x0C, 0x63,
-    0xBF, 0xDD, 0x51, 0x6C, 0x60, 0x66, 0x04, 0xCB, 0x46, 0xF1, 0xE4, 0xEC, 0x4C, 0xBD, 0x59, 0xE3,
-    0x86, 0xC5, 0x55, 0x29, 0xC3, 0x69, 0xE1, 0x55, 0x31, 0xDA, 0x0A, 0xD0, 0x1E, 0x94, 0x38, 0x85,
-    0x08, 0x59, 0xC2, 0xF1, 0x57, 0x19, 0xE4, 0x1F, 0xB0, 0x3A, 0xEA, 0xAA, 0x18, 0xBF, 0xED, 0xCD,
-    0xC2, 0x15, 0xE9, 0x0F, 0x08, 0xDD, 0xBE, 0x15, 0xA6, 0x8B, 0x41, 0xF6, 0xBD, 0xF3, 0xD6, 0x7E,
-    0xDE, 0x7E, 0x74, 0x61, 0xE4, 0x8C, 0x1B, 0xE6, 0x1E, 0x59, 0x37, 0x26, 0x0B, 0x81, 0x84, 0xBC,
-    0x6D, 0xAF, 0xC5, 0x6E, 0xA1, 0xB8, 0x56, 0x57, 0xDB, 0xAB, 0xB6, 0xE2, 0x4B, 0x01, 0xEA, 0x08,
-    0x80, 0x13, 0x1F, 0x7D, 0x9E, 0x79, 0x4C, 0x50, 0x56, 0x3B, 0x62, 0xBF, 0x34, 0xFA, 0xDD, 0x16,
-    0x0D, 0x64, 0x45, 0x65, 0x4E, 0xC2, 0x28, 0xB7, 0xBC, 0xCA, 0xC7, 0xCF, 0x70, 0xCD, 0x3A, 0xBA,
-    0x48, 0x58, 0x44, 0x7E, 0xC8, 0xF7, 0x25, 0x82, 0xFC, 0xC7, 0x26, 0x0B, 0x46, 0x96, 0xA8, 0x9E,
-    0xB5, 0xBF, 0xA3, 0x0E, 0x5E, 0x85, 0xEB, 0x8D, 0xE9, 0xC8, 0x57, 0xD1, 0x29, 0x62, 0x51, 0xFB,
-    0xBA, 0xD1, 0xD9, 0x19, 0x34, 0xA0, 0x28, 0x03, 0x7B, 0x6C, 0x4C, 0xC7, 0xB2, 0xC1, 0x84, 0x05,
-    0xD3, 0xC6, 0x12, 0xAB, 0x12, 0x31, 0xA5, 0xBB, 0x42, 0xE5, 0x62, 0xD7, 0x01, 0xB0, 0x4D, 0x2F,
-    0x51, 0xA6, 0x9F, 0x81, 0x3C, 0x95, 0xA1, 0xC7, 0xAC, 0x70, 0x8A, 0xD8, 0xA1, 0x68, 0x96, 0xFA,
-    0xD9, 0x1C, 0x5C, 0x9C, 0xA7, 0x2E, 0xAC, 0x26, 0xDC, 0x37, 0x0E, 0xDE, 0x28, 0x64, 0xAE, 0x07,
-    0xBF, 0xE5, 0x2C, 0x7D, 0xD2, 0xB5, 0x81, 0xB3, 0x97, 0x0C, 0xA5, 0x4B, 0xD2, 0x4D, 0x17, 0x7D,
-    0x4C, 0x21, 0xF3, 0x97, 0x16, 0x4B, 0xF3, 0x97, 0x1A, 0xA3, 0x81, 0xFC, 0xA7, 0xF4, 0xFE, 0x69,
-    0x7C, 0x2B, 0xE0, 0x19, 0x74, 0x2A, 0xE1, 0x44, 0xF4, 0xBA, 0x89, 0x74, 0x11, 0x07, 0x55, 0x1F,
-    0x53, 0xCC, 0x30, 0x7B, 0x52, 0xA2, 0x88, 0x07, 0xB2, 0x90, 0x4D, 0x32, 0xD4, 0xBE, 0xF0, 0x38,
-    0x4E, 0x26, 0x83, 0x74, 0x62, 0x60, 0xA1, 0x17, 0x87, 0xE9, 0x1D, 0xA0, 0x75, 0x3A, 0xAC, 0x64,
-    0x78, 0xDE, 0xBE, 0xEE, 0x9A, 0xAD, 0x15, 0x94, 0xEE, 0xA5, 0x02, 0xF1, 0x2D, 0xC3, 0xBC, 0x05,
-    0xDB, 0xBF, 0x01, 0xCC, 0x0E, 0xB8, 0xEA, 0x74, 0xD9, 0xDD, 0xCA, 0x63, 0xF8, 0x62, 0x53, 0x15,
-    0x8E, 0xC1, 0xBE, 0xF9, 0x23, 0x97, 0xD4, 0xDA, 0x00, 0xB7, 0x7B, 0x7E, 0xC9, 0xB7, 0x59, 0x03,
-    0x3C, 0x03, 0xBB, 0x81, 0x96, 0x23, 0x66, 0xD0, 0x38, 0x05, 0x13, 0x21, 0x87, 0x9E, 0x60, 0xE3,
-    0x58, 0xF8, 0x85, 0x86, 0x4E, 0x1B, 0x5A, 0x82, 0x73, 0x85, 0x8C, 0x96, 0x44, 0xFB, 0xB9, 0x07,
-    0xC2, 0xBD, 0x0D, 0x2C, 0x64, 0x9A, 0x19, 0x1F, 0x47, 0x3F, 0x84, 0x8A, 0x4F, 0x7D, 0x06, 0x1A,
-    0xB5, 0xE7, 0x98, 0x31, 0x56, 0x00, 0xB3, 0x23, 0x00, 0xAD, 0xCA, 0x54, 0x09, 0x63, 0x35, 0x30,
-    0xCD, 0x30, 0xDD, 0x83, 0x87, 0x1B, 0x89, 0x58, 0x37, 0xBF, 0x57, 0x3B, 0x0E, 0x70, 0xDD, 0x01,
-    0xE9, 0x64, 0x3C, 0x7F, 0x2B, 0x71, 0x70, 0xC5, 0xEF, 0xA2, 0x06, 0xFD, 0x95, 0xEC, 0x05, 0x15,
-    0xD4, 0x44, 0x8C, 0x6D, 0x79, 0x85, 0x5F, 0xA2, 0x1F, 0x35, 0x67, 0x50, 0x09, 0x8F, 0x42, 0x76,
-    0x0E, 0x80, 0xC8, 0x17, 0xE2, 0x4F, 0xE1, 0x08, 0xB5, 0x8F, 0x48, 0x47, 0xE4, 0x4F, 0xE0, 0xBD,
-    0xD9, 0x0B, 0xA6, 0x63, 0xC7, 0xBC, 0xFB, 0xA8, 0xC0, 0x4C, 0x42, 0x30, 0xE2, 0xD0, 0x7D, 0xE9,
-    0xFE, 0xBA, 0x5C, 0xC6, 0xF2, 0x34, 0x7A, 0x2C, 0xED, 0x0D, 0xF8, 0x56, 0xB9, 0xFA, 0x0F, 0x1D,
-    0x89, 0xAC, 0xC3, 0x7F, 0xD5, 0x21, 0x44, 0x8B, 0x2D, 0x87, 0x36, 0x8F, 0xDB, 0xB4, 0x73, 0xFE,
-    0x1E, 0xE0, 0x73, 0xE8, 0xE1, 0x79, 0xDB, 0x00, 0xCB, 0x3D, 0x8A, 0x60, 0x43, 0xD2, 0x81, 0xBB,
-    0x4D, 0x87, 0xC8, 0x1D, 0xE8, 0xB7, 0x83, 0x7D, 0x38, 0x6C, 0x43, 0xAA, 0x25, 0xE9, 0xC1, 0x61,
-    0xCA, 0x84, 0x57, 0x61, 0xF3, 0x0D, 0x18, 0xF2, 0x41, 0x83, 0x14, 0x4D, 0x43, 0xC5, 0x7F, 0xCB,
-    0x8F, 0x89, 0x77, 0x1E, 0x6D, 0x21, 0x0C, 0x08, 0xDA, 0xC8, 0x23, 0xFA, 0x39, 0x12, 0x8D, 0xA9,
-    0x31, 0x34, 0xFB, 0xC2, 0x69, 0xCF, 0x97, 0x1A, 0x93, 0x14, 0xA5, 0xBB, 0x1C, 0x62, 0x6B, 0x77,
-    0x37, 0x47, 0x00, 0x55, 0xA0, 0xA8, 0xD5, 0x30, 0x2B, 0xF5, 0x1B, 0xE5, 0x9E, 0xFA, 0x14, 0x71,
-    0xCA, 0xC2, 0x05, 0xC4, 0x84, 0x12, 0x01, 0x65, 0x47, 0x8D, 0x54, 0xD0, 0xB0, 0xCA, 0x8E, 0x60,
-    0x40, 0x9D, 0x55, 0xDD, 0x43, 0x0F, 0x50, 0xAE, 0x4D, 0xBB, 0xFA, 0x89, 0xF9, 0x80, 0x2C, 0xBE,
-    0xB9, 0x85, 0xD3, 0x25, 0x38, 0x7A, 0x9C, 0xC6, 0x00, 0x0D, 0x3C, 0xD2, 0x43, 0x48, 0x8D, 0x80,
-    0x14, 0xFC, 0xC2, 0xD1, 0x56, 0xE1, 0x90, 0x65, 0xB0, 0x54, 0xCC, 0x77, 0x68, 0x28, 0xFC, 0x74,
-    0xD3, 0x15, 0x21, 0x4C, 0x37, 0xB4, 0x97, 0xEE, 0x9A, 0x16, 0x8F, 0x1D, 0x52, 0xD3, 0x25, 0x8D,
-    0x8F, 0x5C, 0xAB, 0x06, 0x28, 0xB9, 0xF7, 0x93, 0x9B, 0x5D, 0xB5, 0x3F, 0x76, 0x4B, 0x19, 0x41,
-    0x58, 0xCD, 0x5E, 0x30, 0xF9, 0xF7, 0xB6, 0xE7, 0x5E, 0xD2, 0xC0, 0xC4, 0x72, 0x1C, 0x08, 0x31,
-    0x2C, 0x43, 0x7A, 0x5D, 0x65, 0xED, 0x8A, 0x6D, 0x50, 0xF0, 0x42, 0xC9, 0x4D, 0x98, 0x75, 0x23,
-    0x99, 0x4D, 0x11, 0x18, 0xBD, 0xEE, 0xFF, 0xD3, 0xAE, 0xF5, 0xC5, 0xF5, 0x35, 0xF9, 0x06, 0x62,
-    0x64, 0x05, 0xD1, 0x7B, 0x45, 0x76, 0x24, 0x47, 0x6F, 0x4D, 0x8C, 0x21, 0x06, 0x8F, 0xC8, 0x22,
-    0x6E, 0x9D, 0xE6, 0x9B, 0x1F, 0xB4, 0xE4, 0x31, 0x5D, 0xE9, 0x02, 0xB2, 0xA4, 0x28, 0x1C, 0x0F,
-    0x21, 0x1A, 0xDC, 0xE3, 0x7B, 0x12, 0xD4, 0x41, 0xD8, 0x75, 0x79, 0xFE, 0x7A, 0xAF, 0xE6, 0x92,
-    0x61, 0x2E, 0xCE, 0xDB, 0x70, 0xDD, 0x91, 0x4B, 0xBF, 0x5F, 0xFC, 0xF9, 0x55, 0xE2, 0xF2, 0xBF,
-    0xBD, 0x59, 0x4F, 0x6C, 0x1C, 0xD5, 0x19, 0xFF, 0xDE, 0x7B, 0xB1, 0x27, 0xF1, 0x24, 0x1E, 0xB7,
-    0x72, 0x10, 0x0D, 0x8E, 0x87, 0x43, 0x0E, 0x2E, 0xB5, 0x3D, 0x39, 0xB8, 0x92, 0xA5, 0xEE, 0x7A,
-    0x5E, 0x72, 0xE8, 0x05, 0x55, 0x44, 0x55, 0xE0, 0x50, 0x50, 0xCB, 0xA9, 0x02, 0xB5, 0x92, 0x7D,
-    0xB0, 0x5A, 0x57, 0xD8, 0xD9, 0x01, 0x0E, 0xA8, 0xAA, 0x5A, 0x2C, 0x55, 0xDC, 0x7D, 0xA9, 0x1A,
-    0xDC, 0x43, 0x82, 0xEA, 0xAA, 0x46, 0x72, 0xB2, 0x0F, 0xE5, 0xC0, 0xA1, 0x87, 0x3E, 0xA9, 0x07,
-    0xA4, 0x5E, 0x18, 0x42, 0xA8, 0x80, 0x4B, 0xA6, 0x30, 0x2A, 0x9B, 0x66, 0xBC, 0xAF, 0xBF, 0xEF,
-    0xCD, 0xAC, 0x13, 0x87, 0x04, 0x11, 0x0A, 0xAC, 0xB3, 0xBB, 0xB3, 0x33, 0xEF, 0x7D, 0xFF, 0xBF,
-    0xDF, 0xF7, 0x7D, 0x2F, 0x44, 0xAA, 0x52, 0x3D, 0x55, 0xAA, 0x82, 0x48, 0x9C, 0x09, 0x6C, 0x60,
-    0x42, 0x13, 0x65, 0x91, 0x8E, 0x28, 0xA6, 0x59, 0x9A, 0xA1, 0x16, 0xFE, 0x56, 0x68, 0x99, 0x2E,
-    0xD2, 0x18, 0x11, 0x3D, 0x4D, 0x2A, 0xA3, 0x23, 0x44, 0x4B, 0x94, 0x94, 0xCA, 0xD9, 0x85, 0x25,
-    0xF9, 0x91, 0x89, 0x46, 0x69, 0x75, 0x4E, 0xBE, 0x63, 0xA2, 0xDF, 0x51, 0x3A, 0x47, 0xDD, 0xF7,
-    0xC9, 0xF5, 0xA8, 0x9B, 0x93, 0xA1, 0x90, 0xF6, 0xBF, 0x44, 0x57, 0x53, 0x80, 0x87, 0x41, 0x1E,
-    0x90, 0xB4, 0xB8, 0x01, 0x96, 0xA0, 0x4E, 0x14, 0xE1, 0xAD, 0x0C, 0x3E, 0x2E, 0xE2, 0x3D, 0x8D,
-    0xB7, 0x73, 0x96, 0x52, 0x87, 0xC7, 0x25, 0x7E, 0xAC, 0x62, 0xE7, 0x2E, 0x51, 0x70, 0x83, 0x48,
-    0x3A, 0x6C, 0x77, 0xCE, 0x79, 0x72, 0xAD, 0x1F, 0xDA, 0xC4, 0x95, 0xCA, 0x16, 0xCA, 0x4C, 0x53,
-    0x11, 0x51, 0x3B, 0xCE, 0x12, 0x67, 0x53, 0x57, 0x45, 0x43, 0xC7, 0x3D, 0x3B, 0x4D, 0xE3, 0xCA,
-    0x52, 0x29, 0x0A, 0x7C, 0x56, 0xB1, 0xA6, 0x4B, 0x6B, 0x44, 0x29, 0x28, 0x26, 0xE0, 0x1D, 0x67,
-    0x24, 0x2E, 0x54, 0x14, 0xB9, 0xF3, 0x44, 0x0B, 0x58, 0x8C, 0x47, 0xB4, 0x83, 0xC7, 0x2E, 0xA7,
-    0x9F, 0xF6, 0xD7, 0x49, 0x82, 0x37, 0x5B, 0xC4, 0xBF, 0x0E, 0xD1, 0x61, 0x48, 0x35, 0x4F, 0x73,
-    0x50, 0xFB, 0x4C, 0x7D, 0x4B, 0x6A, 0x05, 0xF5, 0x46, 0x61, 0x8A, 0x09, 0x9A, 0xC2, 0x03, 0x10,
-    0xCC, 0x89, 0x5E, 0xFF, 0x39, 0x09, 0x73, 0x80, 0x94, 0xAE, 0xD5, 0x89, 0x5D, 0x46, 0xDD, 0x0B,
-    0x85, 0x28, 0xA8, 0x94, 0x86, 0x96, 0x71, 0xAB, 0x90, 0xFD, 0xEF, 0x17, 0xD4, 0x75, 0x86, 0x44,
-    0x1F, 0x7B, 0x2A, 0x3A, 0x20, 0x2A, 0x4A, 0xD8, 0x5E, 0xE0, 0xFB, 0xC8, 0x07, 0xB0, 0x84, 0xFC,
-    0xA8, 0x58, 0x48, 0x83, 0x77, 0xCE, 0x9C, 0x15, 0xAF, 0x52, 0x6F, 0x6C, 0x86, 0x5E, 0xC8, 0x0E,
-    0x3E, 0x23, 0x4E, 0x97, 0x4F, 0x9F, 0x98, 0xA2, 0x67, 0x59, 0xA7, 0xF7, 0x47, 0x26, 0x0E, 0x4F,
-    0x9C, 0x98, 0x9A, 0x5B, 0x4E, 0xCA, 0x11, 0x4D, 0x07, 0x68, 0x2C, 0xC8, 0x26, 0x64, 0x1E, 0x9D,
-    0x2A, 0x02, 0xB3, 0x2A, 0xF3, 0xD0, 0xA6, 0x94, 0x8A, 0x1E, 0xF5, 0x42, 0x1B, 0x40, 0xE4, 0x31,
-    0xD2, 0xDD, 0x57, 0x1F, 0x75, 0xBB, 0x2C, 0x4D, 0x8B, 0x82, 0x8C, 0xB6, 0x88, 0x42, 0xD7, 0x67,
-    0xEB, 0x6E, 0x52, 0xFB, 0xE0, 0xE8, 0xF8, 0x37, 0x16, 0xC5, 0x37, 0x1F, 0x7E, 0xFE, 0xF7, 0xE3,
-    0x47, 0x8E, 0xD1, 0x31, 0x50, 0xEF, 0xF4, 0x6B, 0x3F, 0xED, 0x52, 0x7A, 0x59, 0xD9, 0xE9, 0x49,
-    0xBA, 0x58, 0xAA, 0x2B, 0x76, 0x36, 0x7C, 0xAB, 0x88, 0x9D, 0x66, 0x05, 0x39, 0x06, 0xE0, 0xB0,
-    0x51, 0x90, 0x21, 0xE5, 0x5C, 0x26, 0x72, 0x0E, 0x05, 0xBE, 0x75, 0xA8, 0xB6, 0xCB, 0x51, 0x56,
-    0x6E, 0x1C, 0x17, 0xC3, 0x1B, 0x63, 0x56, 0xD1, 0x94, 0x32, 0x2B, 0xAA, 0x1A, 0x3A, 0x23, 0x37,
-    0xE8, 0x20, 0x3D, 0xA8, 0x72, 0x2C, 0x3E, 0xF9, 0x48, 0x9E, 0x66, 0x44, 0xF3, 0xA1, 0xB0, 0x2D,
-    0xDE, 0xB9, 0x2A, 0x0A, 0x99, 0x07, 0x08, 0xB8, 0x36, 0x7E, 0xC0, 0x56, 0xA1, 0x09, 0xB3, 0x94,
-    0xDA, 0xA2, 0x27, 0x8B, 0xB0, 0xEF, 0x4C, 0xEA, 0x9C, 0x78, 0xDB, 0xF5, 0x46, 0x93, 0x77, 0xED,
-    0x49, 0x48, 0x96, 0x31, 0x93, 0xE1, 0xF5, 0x75, 0x55, 0x1D, 0x21, 0xF7, 0x86, 0x89, 0xCB, 0x69,
-    0xE9, 0x54, 0x16, 0x17, 0x73, 0xB4, 0x1B, 0x50, 0x60, 0x2E, 0x52, 0x35, 0x4A, 0xB1, 0xB6, 0xAA,
-    0x98, 0xA0, 0x54, 0x9A, 0xD0, 0xCE, 0x53, 0xA5, 0x74, 0x62, 0x96, 0x54, 0x19, 0x52, 0x97, 0x72,
-    0x1A, 0x0A, 0xAE, 0xFC, 0xBB, 0x22, 0xCA, 0xBE, 0x4D, 0x0F, 0x06, 0x8F, 0x22, 0x0C, 0xA6, 0x85,
-    0x39, 0xA1, 0xE8, 0xE4, 0x88, 0xAA, 0x8E, 0x6A, 0x59, 0x1E, 0x3A, 0x3C, 0x71, 0xF8, 0xC4, 0xE1,
-    0xA9, 0xA9, 0xB8, 0x18, 0xD6, 0x63, 0x82, 0x28, 0x47, 0xB0, 0x97, 0x81, 0xA1, 0x6D, 0x44, 0x2B,
-    0xAC, 0x2B, 0xCB, 0xC8, 0xC4, 0xD9, 0x0E, 0x55, 0x81, 0x95, 0x66, 0x94, 0x84, 0xCF, 0x88, 0x3A,
-    0x40, 0xE9, 0x3B, 0x1C, 0x14, 0x19, 0x1C, 0x62, 0x69, 0x04, 0x5A, 0x86, 0xB0, 0x3E, 0xC7, 0x07,
-    0x84, 0xD2, 0x01, 0xC5, 0xBB, 0x81, 0x8E, 0x9C, 0xD2, 0x1A, 0xD9, 0xB3, 0x84, 0xF7, 0x2A, 0x1C,
-    0xF2, 0x1C, 0xDE, 0xBF, 0xC8, 0xA4, 0x59, 0xB6, 0xD2, 0xB6, 0x5F, 0x97, 0x76, 0x3C, 0x3D, 0x95,
-    0x23, 0x11, 0x36, 0xE0, 0x26, 0xC1, 0x69, 0xF0, 0x3D, 0xA6, 0x8C, 0x5F, 0x9C, 0x6D, 0x56, 0x18,
-    0xC4, 0xD8, 0x34, 0xE8, 0xA9, 0x8C, 0x23, 0x09, 0x0C, 0x3A, 0xE5, 0x64, 0x17, 0x24, 0x7F, 0x85,
-    0x6C, 0xC9, 0x05, 0x7B, 0x97, 0xF9, 0xE1, 0xA9, 0x45, 0x52, 0x2D, 0x43, 0xA2, 0x49, 0x4A, 0xC1,
-    0x20, 0x42, 0xC8, 0x29, 0x97, 0xB7, 0x28, 0xDD, 0x15, 0xDE, 0xB3, 0xEC, 0xE0, 0xB1, 0x29, 0xBE,
-    0xCA, 0xB0, 0x6B, 0x89, 0x96, 0xE4, 0x2E, 0x18, 0x08, 0x83, 0x90, 0x1D, 0x85, 0x79, 0x08, 0x4B,
-    0xC7, 0xA6, 0xD9, 0xB7, 0x2F, 0x98, 0xB1, 0x8E, 0x5D, 0x0E, 0x88, 0x8E, 0x23, 0x7C, 0x55, 0xF6,
-    0x1C, 0x92, 0xF5, 0xF8, 0x06, 0xB5, 0x82, 0x1F, 0x40, 0xC6, 0xFF, 0x5C, 0x93, 0xF6, 0x68, 0x47,
-    0x6F, 0x83, 0xC1, 0x08, 0x01, 0x1C, 0x10, 0xB6, 0x96, 0x83, 0x99, 0x22, 0x04, 0x7E, 0x9D, 0x20,
-    0x02, 0x5F, 0xE7, 0x10, 0x25, 0xF5, 0x7D, 0x24, 0x5B, 0x58, 0x92, 0xEA, 0xF9, 0x1F, 0xC8, 0xB6,
-    0xD0, 0xF8, 0xCC, 0x8E, 0x61, 0x32, 0xF0, 0x9C, 0xC5, 0x72, 0x58, 0x39, 0x72, 0x25, 0xC5, 0x65,
-    0x93, 0x72, 0x92, 0x1D, 0xDD, 0xC6, 0x3B, 0x60, 0x9C, 0x18, 0xBF, 0x0D, 0x44, 0x22, 0x3C, 0x09,
-    0x39, 0x3B, 0x41, 0x4A, 0x5D, 0xC7, 0xD6, 0x8F, 0x41, 0xAC, 0xC0, 0xBE, 0x6D, 0x2C, 0x5F, 0x85,
-    0x04, 0x6D, 0x84, 0x59, 0x42, 0x3D, 0x50, 0x4F, 0xB0, 0x18, 0xE1, 0xF4, 0xDF, 0x3F, 0xC1, 0x06,
-    0xAE, 0xC2, 0xDB, 0x9D, 0x2A, 0x21, 0x52, 0x45, 0xB2, 0x07, 0x3C, 0xB9, 0xCC, 0xD4, 0x96, 0x98,
-    0x85, 0x6E, 0x60, 0xC8, 0x43, 0xD0, 0x3D, 0x5E, 0x8A, 0xA3, 0x3F, 0xE1, 0x05, 0x0C, 0x3E, 0xD1,
-    0x0E, 0xBB, 0x9D, 0xA5, 0xB8, 0x02, 0xF9, 0x66, 0xC1, 0x55, 0x14, 0x6D, 0xD6, 0x1F, 0x2A, 0xEE,
-    0x60, 0x29, 0x83, 0x28, 0x14, 0x4D, 0x48, 0xF6, 0x37, 0x19, 0x64, 0x00, 0x65, 0xE0, 0x6E, 0xA1,
-    0x4C, 0xA2, 0x53, 0xB0, 0x56, 0x25, 0x64, 0xA0, 0x06, 0xF0, 0x3C, 0xCE, 0xB4, 0xB6, 0x58, 0xE9,
-    0x13, 0x5F, 0x2D, 0xB7, 0x2D, 0x78, 0x3E, 0x3C, 0x09, 0x1A, 0x73, 0x7F, 0x84, 0xE1, 0x4C, 0x49,
-    0x77, 0xD8, 0x15, 0x29, 0x52, 0x1B, 0x96, 0x16, 0x8A, 0xC6, 0xB2, 0x11, 0xFB, 0x94, 0x4D, 0x1B,
-    0xF0, 0x72, 0xB6, 0xAD, 0x2C, 0xB0, 0x94, 0x8D, 0x0B, 0x1B, 0xEF, 0x10, 0x5B, 0x17, 0xA8, 0xE9,
-    0x0C, 0x9B, 0x57, 0x33, 0xC8, 0x12, 0xDB, 0x17, 0x01, 0x11, 0xE6, 0xAC, 0x47, 0x8B, 0x5D, 0xB8,
-    0xC3, 0x11, 0x02, 0xB2, 0x43, 0xFA, 0xEC, 0x3E, 0xA3, 0xB2, 0x50, 0xB2, 0x1A, 0xF0, 0xF4, 0x6A,
-    0xC6, 0xEC, 0x88, 0x16, 0x7B, 0x9E, 0x99, 0x7A, 0x3D, 0x95, 0xF5, 0x21, 0xB3, 0x40, 0x35, 0x57,
-    0x56, 0x94, 0xBA, 0x9B, 0x5D, 0xF2, 0x85, 0xC0, 0xB3, 0xF5, 0x9A, 0x22, 0xD6, 0x93, 0x2C, 0xD5,
-    0xF8, 0xC0, 0xE6, 0x11, 0x7C, 0xC8, 0x83, 0xB8, 0x38, 0x69, 0x6E, 0x03, 0xF2, 0x7D, 0xCA, 0x7A,
-    0xC6, 0xA9, 0xA9, 0xF9, 0x7A, 0x5D, 0x99, 0x6D, 0xF8, 0xA2, 0xAD, 0xB9, 0xB2, 0xAA, 0xCC, 0x14,
-    0xF0, 0x54, 0x78, 0x9E, 0x5E, 0x53, 0x66, 0x09, 0x6D, 0x4B, 0xCF, 0x91, 0x15, 0x1D, 0x30, 0x84,
-    0x72, 0xAC, 0x5B, 0x88, 0x40, 0x63, 0x2D, 0xB8, 0x4E, 0x81, 0xBA, 0xB7, 0x3A, 0x7D, 0xE2, 0x0D,
-    0xAD, 0xFE, 0xE1, 0xC5, 0x08, 0x5F, 0x62, 0xDF, 0x52, 0x1C, 0xBC, 0xF7, 0x0C, 0x7B, 0x35, 0xF0,
-    0xEB, 0x8B, 0x90, 0xD7, 0x2B, 0x1B, 0xB1, 0xCB, 0xC3, 0xCC, 0x7F, 0x25, 0x9B, 0x5D, 0xFE, 0xEA,
-    0xC0, 0xB6, 0xBE, 0x22, 0xBA, 0x0F, 0xCF, 0xB3, 0x26, 0x1D, 0xC0, 0x39, 0x9E, 0x77, 0xF1, 0x95,
-    0x68, 0xDC, 0xDE, 0xBD, 0x43, 0xB5, 0xC5, 0x1E, 0xEF, 0x81, 0x2D, 0x40, 0x3F, 0x62, 0x17, 0x30,
-    0x73, 0x5E, 0x14, 0xEB, 0xC6, 0x12, 0x5C, 0xEA, 0x3C, 0x07, 0x2F, 0x29, 0x2E, 0x84, 0xD3, 0x02,
-    0x22, 0x6F, 0x16, 0xC2, 0xB9, 0x3E, 0xC7, 0x8F, 0x05, 0x05, 0x3C, 0xEC, 0xA2, 0x7E, 0xD1, 0xC3,
-    0x2C, 0x3A, 0x67, 0x88, 0xAA, 0x01, 0xA9, 0xF6, 0x1A, 0x1A, 0x03, 0x96, 0xB7, 0xA1, 0x46, 0xBA,
-    0x61, 0xFE, 0x38, 0x4B, 0xC4, 0x32, 0xF6, 0x38, 0xAB, 0x3D, 0x1E, 0x00, 0x3E, 0x7D, 0x35, 0xA5,
-    0x1B, 0x3F, 0xE2, 0xF2, 0x6A, 0xC0, 0x28, 0xF7, 0xF6, 0xE7, 0xDD, 0xA2, 0xA8, 0xCB, 0x2E, 0xA5,
-    0x9B, 0xE7, 0xD9, 0x68, 0x1A, 0xF6, 0xB3, 0x70, 0xA9, 0x37, 0x58, 0xD8, 0xE4, 0xA6, 0xCA, 0x3E,
-    0x2B, 0x35, 0xBF, 0x54, 0x96, 0x1C, 0x8F, 0x03, 0xCB, 0x5C, 0xC5, 0xE2, 0x8D, 0x11, 0xAE, 0x69,
-    0x5F, 0x22, 0x87, 0x71, 0x34, 0x25, 0xCA, 0xA2, 0x60, 0x5C, 0x82, 0x07, 0xA2, 0x37, 0xAA, 0xDB,
-    0xBB, 0xA3, 0xC7, 0xC9, 0xF3, 0x89, 0xE1, 0x03, 0x86, 0xC5, 0x1A, 0xFE, 0x4C, 0x43, 0x2B, 0x7A,
-    0x65, 0x83, 0x1F, 0x93, 0xE7, 0xA4, 0x3E, 0xFD, 0xF8, 0xC3, 0x4D, 0xB8, 0x11, 0x2C, 0x12, 0xF0,
-    0xAB, 0x79, 0x4D, 0xF9, 0xC2, 0x84, 0x7F, 0xB7, 0x72, 0x2E, 0xC8, 0x39, 0x0A, 0x76, 0x38, 0x0C,
-    0x20, 0xEC, 0x1A, 0xAB, 0x10, 0x31, 0x72, 0x88, 0x92, 0x21, 0x39, 0x25, 0x74, 0x0E, 0xC8, 0xDA,
-    0x54, 0xA3, 0x29, 0x01, 0xC4, 0x36, 0x71, 0xCD, 0x16, 0x41, 0xAD, 0xE0, 0xEA, 0x50, 0xDC, 0xD5,
-    0x03, 0xE7, 0x7C, 0x6C, 0x81, 0x00, 0x47, 0x57, 0xCF, 0x47, 0x44, 0xE2, 0x23, 0x0C, 0x62, 0x82,
-    0xB2, 0x6F, 0xAB, 0xEA, 0x1A, 0x90, 0x73, 0x34, 0x8A, 0xCA, 0xE3, 0xCC, 0x80, 0x3A, 0x3C, 0xCB,
-    0x77, 0x60, 0xED, 0xFC, 0xD0, 0x97, 0x40, 0xB1, 0x1D, 0x18, 0xC6, 0x9B, 0x2A, 0x32, 0xFB, 0xC1,
-    0x06, 0xAA, 0x31, 0x4D, 0x76, 0x5A, 0x5A, 0xE3, 0xEB, 0x5A, 0x5D, 0x87, 0x2A, 0x8F, 0x06, 0x4C,
-    0x35, 0xA9, 0xF3, 0x83, 0xCB, 0x56, 0xEE, 0x53, 0x06, 0xB9, 0xC1, 0x20, 0xE1, 0xE9, 0xC6, 0x68,
-    0x0A, 0x91, 0x10, 0x25, 0x79, 0xE3, 0xA2, 0x39, 0x2E, 0x18, 0xFC, 0x2C, 0x08, 0x45, 0x06, 0x11,
-    0x91, 0xB2, 0xA1, 0xAB, 0x8E, 0xCB, 0xD5, 0xC7, 0x70, 0x40, 0x64, 0x40, 0xFC, 0x32, 0x17, 0xCE,
-    0x12, 0x2C, 0x3A, 0x26, 0x7D, 0xE2, 0xC2, 0x2E, 0x67, 0x70, 0x1E, 0x70, 0x82, 0x25, 0x9C, 0x60,
-    0xCE, 0xAD, 0xDF, 0x12, 0x6E, 0xED, 0x30, 0x3E, 0xBE, 0xFB, 0x26, 0x37, 0xBF, 0x89, 0xDE, 0xBB,
-    0x3B, 0x9C, 0x51, 0x87, 0x25, 0x42, 0x1D, 0xE8, 0x51, 0x54, 0x82, 0x43, 0x80, 0xC6, 0x0C, 0x3D,
-    0x70, 0x06, 0x81, 0x6F, 0xA2, 0x51, 0xA2, 0xB5, 0x0A, 0x8F, 0xD3, 0xE4, 0x14, 0x1E, 0xBF, 0x69,
-    0x2F, 0xC1, 0xBD, 0x3D, 0x14, 0xFD, 0x32, 0x85, 0x61, 0xAA, 0xF0, 0x6F, 0x96, 0xBA, 0xF2, 0x13,
-    0x3C, 0xCE, 0x3A, 0x78, 0x6C, 0xA3, 0x5D, 0xB8, 0x54, 0x39, 0x46, 0xDA, 0x6E, 0xB6, 0x67, 0x14,
-    0x0F, 0x45, 0x89, 0x77, 0xF2, 0xC6, 0x3E, 0x9F, 0x4A, 0x44, 0x19, 0x83, 0x99, 0xA6, 0xE8, 0x1A,
-    0x42, 0x01, 0x40, 0xB2, 0xCB, 0x45, 0x3E, 0xCE, 0x02, 0x8E, 0xBE, 0xDA, 0x2D, 0x5C, 0x0F, 0xD8,
-    0x15, 0x91, 0xF6, 0xF8, 0x0C, 0xA1, 0xF0, 0x04, 0xF5, 0xA1, 0xE4, 0x0A, 0x50, 0x51, 0xFA, 0xC1,
-    0xCF, 0x76, 0x19, 0x4C, 0xFA, 0xDC, 0xB5, 0x3B, 0x4E, 0x93, 0x3E, 0x8F, 0x00, 0xBD, 0x4F, 0xC5,
-    0x0F, 0xD7, 0x40, 0xF4, 0x2C, 0x78, 0xCD, 0x53, 0x53, 0x89, 0xEF, 0xFD, 0xFA, 0x5A, 0x04, 0xF3,
-    0x18, 0xE0, 0x41, 0x80, 0x3E, 0x62, 0x8C, 0xDB, 0xD8, 0x8B, 0xCC, 0x90, 0x21, 0x31, 0x61, 0xD0,
-    0x4D, 0xD7, 0xE1, 0x97, 0x34, 0x43, 0xF8, 0xA1, 0x04, 0x9C, 0xE3, 0x60, 0x8C, 0x32, 0x1F, 0xA1,
-    0x0C, 0x01, 0x25, 0xC7, 0x59, 0x9B, 0x43, 0x37, 0xE1, 0x7E, 0x27, 0x62, 0x8F, 0x21, 0x58, 0x0A,
-    0x4E, 0x2B, 0xF7, 0x87, 0x0B, 0x25, 0xD7, 0x90, 0x5E, 0x53, 0x2C, 0x7C, 0xA9, 0x18, 0x76, 0xF9,
-    0x1D, 0x8A, 0xF6, 0xB8, 0x4B, 0x7B, 0xF7, 0x29, 0xEE, 0x51, 0xD6, 0xBE, 0x7E, 0x0B, 0x0C, 0x71,
-    0x1F, 0xE7, 0x81, 0x4A, 0x96, 0x29, 0x17, 0x90, 0xD8, 0x7C, 0xCD, 0x32, 0x04, 0x2F, 0xD8, 0xD9,
-    0x02, 0x4B, 0x13, 0x1B, 0x5D, 0x90, 0xEB, 0xE7, 0x07, 0xB7, 0x8F, 0x0D, 0x2E, 0x62, 0x7D, 0x1F,
-    0x17, 0x51, 0xB6, 0xFF, 0x22, 0x74, 0x3F, 0xA9, 0x2F, 0x90, 0x8B, 0xF5, 0x85, 0x77, 0xA7, 0xBF,
-    0xC8, 0xA2, 0xBA, 0x14, 0xA4, 0x3A, 0xAA, 0xC7, 0xA1, 0x38, 0x8B, 0xFE, 0xEE, 0x17, 0x21, 0xD3,
-    0xAF, 0x78, 0x37, 0x71, 0xA1, 0xF6, 0x8B, 0xD0, 0x0B, 0x99, 0x76, 0xED, 0xAE, 0xC8, 0xF8, 0x3C,
-    0xA2, 0x85, 0xC8, 0xD4, 0x4C, 0xA2, 0x97, 0x0D, 0xB7, 0xBF, 0x58, 0xED, 0x6C, 0x58, 0x23, 0xA7,
-    0x7B, 0xEF, 0x42, 0x43, 0xBB, 0xEE, 0x0F, 0x88, 0x0D, 0x50, 0x0D, 0x2E, 0x9A, 0x3B, 0xFF, 0x6A,
-    0x42, 0x21, 0x1A, 0x44, 0xC4, 0x67, 0x5C, 0x84, 0x7B, 0x17, 0xC5, 0x9D, 0x77, 0x86, 0x6E, 0x73,
-    0xD7, 0xB7, 0xA8, 0xA9, 0x17, 0xF5, 0xC7, 0xED, 0xED, 0xF4, 0xF0, 0x06, 0x3D, 0xA2, 0x81, 0x70,
-    0xBB, 0xF8, 0x0B, 0x0A, 0x46, 0x9B, 0x0C, 0xAE, 0xDE, 0x45, 0x1B, 0xA7, 0xF8, 0x57, 0xCC, 0x23,
-    0xC4, 0x1A, 0xE2, 0x5B, 0x16, 0x80, 0xC8, 0x88, 0x1B, 0xCD, 0x35, 0xC6, 0xA0, 0x82, 0x21, 0xC9,
-    0x04, 0x05, 0x46, 0xC5, 0xB8, 0x2E, 0x8E, 0xB0, 0x23, 0xEB, 0x22, 0x06, 0x06, 0xF5, 0x3E, 0x1C,
-    0x24, 0xB5, 0x2F, 0xDF, 0x33, 0xF7, 0xCE, 0xEA, 0xB3, 0x34, 0x74, 0xC6, 0x57, 0x1E, 0x5F, 0x7B,
-    0xB8, 0xFA, 0x04, 0x40, 0x2E, 0x96, 0x8B, 0x7F, 0xD5, 0x92, 0x68, 0x98, 0x75, 0x07, 0xDC, 0x15,
-    0x37, 0x64, 0x3E, 0xD7, 0x76, 0x90, 0x5B, 0xAA, 0xC0, 0x86, 0x8E, 0x0E, 0x98, 0x37, 0x24, 0xC9,
-    0xD9, 0xB4, 0xDC, 0x00, 0xED, 0x4F, 0x27, 0x7F, 0x1E, 0xC0, 0x4D, 0x50, 0x38, 0xC9, 0x09, 0x35,
-    0xF2, 0xF9, 0x74, 0x67, 0x1E, 0x97, 0xBE, 0xA0, 0xEE, 0x09, 0xC3, 0x40, 0x8F, 0xAB, 0x58, 0x0E,
-    0x07, 0x1F, 0x15, 0x67, 0xFE, 0x1F, 0x93, 0x9F, 0xFB, 0xDC, 0x6C, 0xB9, 0x53, 0x9B, 0xAF, 0x01,
-    0xEC, 0xF8, 0xBD, 0x26, 0x19, 0x4B, 0xD1, 0x63, 0x19, 0xA1, 0x54, 0x84, 0x66, 0x87, 0x2E, 0x89,
-    0x5E, 0x80, 0x84, 0x4D, 0x29, 0xBA, 0x02, 0x8B, 0x77, 0x34, 0x21, 0x03, 0x05, 0x1A, 0x1A, 0xEE,
-    0xC8, 0x79, 0xAA, 0xEB, 0x90, 0x9F, 0x1D, 0xF8, 0xB2, 0x5B, 0xF7, 0xE9, 0x49, 0x63, 0xDA, 0x19,
-    0x7F, 0x6E, 0xA3, 0x6E, 0x60, 0x79, 0x41, 0x00, 0x89, 0x96, 0xCC, 0x63, 0x6A, 0xA1, 0x79, 0x55,
-    0x36, 0xCC, 0x8A, 0xD8, 0xAC, 0x2E, 0x66, 0x09, 0x4A, 0xE1, 0x07, 0xBE, 0xC2, 0xE7, 0xF5, 0x51,
-    0x4E, 0x1D, 0xA2, 0x70, 0x44, 0x39, 0x81, 0xCD, 0x73, 0x40, 0xFD, 0x75, 0x65, 0xCE, 0x51, 0x04,
-    0xB1, 0x57, 0xA6, 0x48, 0x5A, 0x88, 0x06, 0xD1, 0x57, 0x31, 0x5F, 0xE7, 0x18, 0x08, 0x75, 0xA8,
-    0x57, 0x69, 0x46, 0x7E, 0xFC, 0x64, 0x11, 0xBD, 0xED, 0xF4, 0x42, 0x07, 0x44, 0x44, 0x1D, 0xC3,
-    0x5C, 0xAE, 0x87, 0x6B, 0xA5, 0x17, 0x7F, 0x8D, 0x24, 0x06, 0xC7, 0x1D, 0x91, 0x2B, 0xD3, 0xC2,
-    0x5E, 0x1D, 0x64, 0x17, 0x91, 0x8E, 0xE8, 0x8E, 0x7B, 0x71, 0x81, 0xB4, 0xA2, 0x4E, 0xBF, 0x10,
-    0xFD, 0x1F, 0x37, 0xCC, 0x27, 0xEA, 0x7E, 0xB2, 0xB8, 0x4B, 0x38, 0xDE, 0x07, 0xA5, 0xF9, 0xDA,
-    0x2A, 0x93, 0xF8, 0xB6, 0x13, 0x7E, 0xF3, 0x43, 0x57, 0xB5, 0x44, 0x59, 0x98, 0x85, 0xD3, 0xB0,
-    0x9B, 0x0F, 0xCF, 0x96, 0x69, 0x45, 0x1A, 0x95, 0xF3, 0xF6, 0x85, 0xA0, 0xE2, 0xD6, 0x4E, 0xB8,
-    0x9B, 0xC6, 0xEF, 0x97, 0xF9, 0x12, 0xFD, 0x72, 0x84, 0x46, 0x8F, 0x1B, 0xB2, 0xDB, 0xF7, 0xC9,
-    0x3B, 0x04, 0xF2, 0x2C, 0xC0, 0x40, 0xF0, 0xDF, 0xA0, 0xC3, 0xB9, 0x2F, 0xDE, 0xDC, 0xC3, 0x0E,
-    0x01, 0x01, 0xAE, 0xD4, 0xD3, 0x79, 0x13, 0x92, 0xBD, 0x75, 0xA6, 0xB0, 0x1D, 0x9A, 0x49, 0x6A,
-    0x29, 0x13, 0x18, 0x10, 0x08, 0x91, 0x64, 0x85, 0x2C, 0xA3, 0xE7, 0x1D, 0xEF, 0x0F, 0xDC, 0x75,
-    0x8A, 0xDF, 0xCB, 0x1B, 0xF8, 0x78, 0xE8, 0x2A, 0xFA, 0x09, 0xE0, 0x36, 0xDC, 0x38, 0x2B, 0xFB,
-    0x34, 0x0F, 0xBE, 0xF9, 0x03, 0x60, 0x87, 0xC0, 0xCC, 0x96, 0xA9, 0xB3, 0x79, 0x96, 0xB9, 0x73,
-    0x7C, 0x70, 0xEF, 0xB4, 0x10, 0x38, 0x7D, 0x80, 0xDB, 0x9F, 0x9B, 0x2C, 0x05, 0xC6, 0x19, 0xC8,
-    0xB1, 0x58, 0x83, 0xDD, 0xA2, 0x8D, 0x1C, 0xC6, 0xA8, 0x90, 0x0F, 0x30, 0xD0, 0x2E, 0x85, 0x19,
-    0x57, 0x4B, 0x94, 0x87, 0xFE, 0x86, 0x72, 0xF9, 0xB0, 0xCB, 0xE0, 0xEE, 0x63, 0x9A, 0x86, 0xB9,
-    0x71, 0xA5, 0xA6, 0xDD, 0xDD, 0xA9, 0xDB, 0xB6, 0xBD, 0xD7, 0x01, 0xC4, 0x68, 0x41, 0xAF, 0x87,
-    0xB4, 0x45, 0x76, 0x65, 0x68, 0x0B, 0x65, 0x24, 0xFE, 0xF0, 0x95, 0x50, 0xFB, 0x4E, 0xFC, 0x12,
-    0x8D, 0xC5, 0xAE, 0x92, 0xA8, 0x2C, 0x0F, 0xDD, 0xE0, 0xB5, 0xD6, 0x7B, 0x2E, 0x1C, 0x34, 0x3E,
-    0x77, 0x79, 0x69, 0x1F, 0xFC, 0xA0, 0x36, 0x43, 0x73, 0x41, 0xF6, 0xA4, 0x06, 0x2A, 0x83, 0x1C,
-    0x1F, 0x56, 0xB6, 0xB9, 0x14, 0x92, 0x06, 0x3D, 0x9E, 0x8B, 0x44, 0x77, 0x7D, 0x0F, 0x59, 0x78,
-    0xC2, 0xFA, 0x4B, 0x4E, 0x13, 0xC2, 0xDC, 0x3F, 0x09, 0x01, 0x17, 0x26, 0x30, 0x55, 0x15, 0xEB,
-    0x30, 0xDF, 0x3F, 0xCA, 0x8D, 0xA1, 0xF2, 0xC0, 0x14, 0xD7, 0xA6, 0x99, 0x90, 0xC8, 0x1F, 0x80,
-    0xA9, 0x5C, 0xC6, 0xA6, 0xB5, 0xF5, 0x0C, 0x92, 0xC0, 0xA8, 0x1D, 0x57, 0xF8, 0x29, 0x6D, 0xF1,
-    0x9A, 0x1F, 0xEF, 0xF9, 0x7E, 0x6D, 0xD8, 0x61, 0x86, 0x80, 0x1C, 0x71, 0x30, 0x0D, 0x27, 0xF8,
-    0x63, 0xA1, 0x12, 0x26, 0x4E, 0xD8, 0xC2, 0xDC, 0x70, 0x05, 0x6C, 0x88, 0x3B, 0x67, 0x2A, 0x91,
-    0xB1, 0x69, 0xE6, 0x49, 0x58, 0xFE, 0x6E, 0x71, 0xC7, 0x0F, 0x3B, 0xB6, 0xBD, 0x63, 0x8C, 0x1F,
-    0x7D, 0x3C, 0x90, 0x03, 0xAB, 0xAE, 0x9A, 0x51, 0x5A, 0xAF, 0x27, 0x34, 0xBF, 0x2C, 0xB8, 0x7D,
-    0x39, 0x0D, 0x96, 0x0B, 0x3D, 0x1E, 0xAB, 0xBC, 0x8A, 0x5F, 0x2A, 0x2E, 0x37, 0x0C, 0xFC, 0xE1,
-    0x6E, 0xC1, 0x20, 0x55, 0x7F, 0x67, 0x9C, 0x84, 0x25, 0x13, 0x45, 0xED, 0xDC, 0x6E, 0x96, 0xF8,
-    0x06, 0x9D, 0x95, 0xA1, 0x80, 0xA1, 0x9C, 0x4F, 0x46, 0x09, 0xA8, 0xFD, 0xC0, 0x29, 0xB0, 0xEE,
-    0xB7, 0x28, 0xB0, 0x7F, 0xD5, 0xC4, 0x38, 0x39, 0x0B, 0x5E, 0xCA, 0xF8, 0x93, 0xCD, 0x15, 0x78,
-    0x3B, 0xC6, 0xBE, 0xEB, 0x98, 0xDD, 0x79, 0xF4, 0x09, 0x6A, 0x23, 0xAC, 0xA2, 0xAD, 0xFE, 0xE7,
-    0x04, 0x89, 0x2B, 0xCB, 0x24, 0x9F, 0xBF, 0x35, 0xBB, 0x3C, 0xFC, 0x2C, 0x53, 0xD5, 0xD4, 0x47,
-    0x38, 0x95, 0xCA, 0xC8, 0x02, 0x54, 0x6C, 0x00, 0x4A, 0x7C, 0x5A, 0x14, 0xA1, 0x79, 0x8F, 0x11,
-    0xF9, 0x89, 0x3F, 0x3B, 0x49, 0x39, 0x1E, 0x79, 0x06, 0x5D, 0x68, 0xE6, 0x5E, 0xBD, 0xEF, 0x38,
-    0x3B, 0xA3, 0x6E, 0x1F, 0x72, 0x14, 0x61, 0x16, 0x64, 0x05, 0x2D, 0x4F, 0x52, 0x78, 0xDA, 0x52,
-    0x31, 0x43, 0x93, 0xB2, 0x08, 0x6D, 0xCC, 0x47, 0xD5, 0xE8, 0x6E, 0x7C, 0x13, 0xC1, 0xB1, 0x31,
-    0xEF, 0x01, 0x53, 0xDA, 0x7B, 0x56, 0xC1, 0xFB, 0x21, 0x78, 0x2B, 0xF4, 0x5E, 0x43, 0xE8, 0xC9,
-    0xEC, 0xFE, 0x49, 0xC8, 0xFC, 0x69, 0xFA, 0xF3, 0x6F, 0xE9, 0x08, 0xAA, 0x8D, 0xFE, 0x82, 0x52,
-    0xDC, 0x05, 0x8B, 0x06, 0x80, 0x82, 0xC7, 0x20, 0x12, 0x66, 0x2D, 0xF8, 0x75, 0x45, 0x19, 0x61,
-    0x41, 0x45, 0x6F, 0xA1, 0x48, 0x58, 0x91, 0x87, 0x26, 0xD1, 0x4C, 0x26, 0x45, 0xE4, 0xFA, 0x6A,
-    0x82, 0xA1, 0xD8, 0x77, 0x8A, 0xA6, 0x39, 0xA7, 0xF2, 0xFD, 0xCB, 0x13, 0x9B, 0x2F, 0x36, 0xCD,
-    0x11, 0xB7, 0x32, 0x3C, 0x9F, 0xE9, 0xBD, 0x93, 0x1C, 0x1F, 0x26, 0x8C, 0xE3, 0x54, 0x27, 0x5D,
-    0xBE, 0x37, 0x47, 0xF8, 0x11, 0x62, 0x7A, 0xAF, 0xE6, 0x47, 0xD4, 0x1C, 0x22, 0x08, 0x3E, 0x4C,
-    0x91, 0x4C, 0x4F, 0xE6, 0xF0, 0xBD, 0xCC, 0x5F, 0xE3, 0x79, 0x76, 0x65, 0x85, 0x68, 0xA5, 0x85,
-    0x20, 0x9C, 0x99, 0xC4, 0xCA, 0xE8, 0xB1, 0x20, 0x23, 0x79, 0xF3, 0x37, 0xB6, 0x89, 0xBA, 0x88,
-    0x3F, 0x84, 0x2F, 0xAE, 0xE5, 0xE0, 0x9C, 0xB7, 0x1E, 0x4F, 0x66, 0xF7, 0x68, 0xFB, 0x84, 0xF2,
-    0x99, 0xE4, 0x87, 0xF2, 0x1A, 0x58, 0xB2, 0x3B, 0x2A, 0xAE, 0xF1, 0x7B, 0x87, 0x07, 0xF9, 0x06,
-    0x7C, 0x8F, 0x69, 0x36, 0xC8, 0xA2, 0xD3, 0x56, 0x99, 0x42, 0x14, 0xB0, 0x51, 0x8C, 0xC1, 0x35,
-    0x4B, 0x64, 0xDF, 0x99, 0xAE, 0x2B, 0x60, 0x1B, 0xD9, 0x6F, 0x37, 0x9A, 0xEE, 0x4D, 0xDE, 0x5B,
-    0x9F, 0x8A, 0x97, 0xCF, 0x4B, 0x07, 0xFA, 0xF3, 0x11, 0xE0, 0x5B, 0x5A, 0x18, 0x1E, 0x2A, 0xF8,
-    0x94, 0x7D, 0x95, 0xB6, 0x27, 0xA9, 0x1D, 0xEA, 0x88, 0xC1, 0xBE, 0x90, 0xF9, 0x2A, 0x95, 0x93,
-    0xB4, 0x13, 0xDE, 0x74, 0x00, 0x75, 0x83, 0xEE, 0x29, 0xEC, 0x41, 0xE3, 0x21, 0xA1, 0x55, 0xD1,
-    0xA6, 0x85, 0xD0, 0xFA, 0x26, 0xA6, 0xD1, 0x25, 0x30, 0xD8, 0xCC, 0x07, 0xF6, 0x5B, 0xFC, 0x9F,
-    0x2E, 0x31, 0x15, 0x5C, 0xF7, 0xDB, 0xDE, 0xAB, 0xD7, 0x2B, 0xDE, 0xCE, 0xAE, 0xED, 0xBE, 0xAC,
-    0x1B, 0x67, 0xC0, 0x2B, 0x00, 0x94, 0xCF, 0x3C, 0x5B, 0xF5, 0xFF, 0x13, 0xD4, 0x82, 0x82, 0x5B,
-    0x30, 0x13, 0xAE, 0x00, 0xDD, 0x18, 0xE3, 0x69, 0x16, 0x0D, 0x5F, 0x82, 0xB4, 0x8E, 0x31, 0x91,
-    0x47, 0xDC, 0x8E, 0xF4, 0xEA, 0x3E, 0x97, 0x5B, 0x5C, 0x3E, 0xBF, 0x42, 0x6D, 0x11, 0xDC, 0xEB,
-    0xF1, 0xF4, 0x8F, 0x5B, 0xAF, 0x36, 0xA1, 0x82, 0xB0, 0x60, 0x86, 0x17, 0xB9, 0xA7, 0xA7, 0xE8,
-    0x32, 0x05, 0xA7, 0x73, 0x89, 0x92, 0x5A, 0x04, 0x28, 0x53, 0xE6, 0x38, 0xE5, 0x21, 0x5D, 0x54,
-    0x66, 0x9B, 0xF2, 0x1E, 0x75, 0x4A, 0x0E, 0xBF, 0xE8, 0xF6, 0x2D, 0xF5, 0xF0, 0x79, 0x66, 0x08,
-    0xA0, 0x97, 0x20, 0xDA, 0x16, 0xD0, 0xA0, 0x5D, 0xFE, 0xAA, 0x84, 0xFD, 0x1F, 0xBD, 0x5A, 0x4F,
-    0x8C, 0xDC, 0xE6, 0x75, 0x7F, 0x24, 0xB5, 0xCB, 0x58, 0xB4, 0x44, 0x1D, 0xE4, 0x20, 0x88, 0xB4,
-    0xCB, 0x1C, 0x7C, 0x70, 0x81, 0xDD, 0x65, 0x0B, 0xF8, 0xA0, 0x00, 0xBB, 0x4B, 0xCA, 0x3E, 0x14,
-    0x68, 0x0F, 0xDE, 0x83, 0x56, 0x07, 0x17, 0x48, 0x7D, 0xC8, 0xC1, 0x75, 0x91, 0x4A, 0x45, 0xF7,
-    0xA0, 0x06, 0xAB, 0x1D, 0x3A, 0x3A, 0x15, 0x3D, 0x78, 0x03, 0x54, 0xE9, 0x31, 0x7B, 0x70, 0x00,
-    0x59, 0x17, 0xA9, 0xC0, 0x02, 0x55, 0x81, 0x91, 0xE6, 0x73, 0xD3, 0x22, 0x87, 0xA2, 0x28, 0x91,
-    0x20, 0xF0, 0xD1, 0x6C, 0xA3, 0xC0, 0xB1, 0x7A, 0x30, 0xDD, 0x32, 0x28, 0xB5, 0x9D, 0x19, 0xF6,
-    0xF7, 0x7B, 0x1F, 0x39, 0x33, 0xBB, 0x5A, 0x1B, 0xB2, 0x6B, 0x9B, 0xD2, 0x70, 0x66, 0x96, 0x9C,
-    0xEF, 0x7B, 0xFF, 0xDF, 0xEF, 0xBD, 0x47, 0x11, 0xE7, 0xF2, 0x2D, 0x91, 0xB0, 0x19, 0xCA, 0x13,
-    0x47, 0x8D, 0x97, 0xCB, 0xBF, 0x7B, 0x3C, 0x85, 0x7D, 0x9C, 0xA2, 0x55, 0x9C, 0x56, 0xD7, 0x70,
-    0xBA, 0x87, 0x93, 0x53, 0xE2, 0xE4, 0xE5, 0xEB, 0x22, 0x81, 0xC1, 0x29, 0x92, 0x58, 0x64, 0x9D,
-    0xA7, 0xC1, 0xED, 0x81, 0x48, 0xD3, 0x34, 0xE2, 0xE1, 0x94, 0xFA, 0xB9, 0xC4, 0x69, 0x68, 0x24,
-    0xCE, 0x92, 0x14, 0x27, 0x99, 0x7B, 0x75, 0x4F, 0x06, 0x4D, 0xDE, 0x6D, 0x33, 0x5F, 0xEF, 0xE2,
-    0x6B, 0x1A, 0x64, 0x7D, 0xB9, 0x26, 0xA5, 0x67, 0x7C, 0xB3, 0x20, 0x8B, 0x72, 0x57, 0x6A, 0xCF,
-    0x04, 0x79, 0xF8, 0x66, 0x23, 0x09, 0x88, 0xEB, 0x8D, 0x4B, 0xE9, 0xFD, 0x6D, 0xD6, 0xFE, 0xC4,
-    0x93, 0xF3, 0x38, 0x65, 0x5B, 0x38, 0x35, 0x05, 0xBE, 0x3F, 0x90, 0xAF, 0x8E, 0x7A, 0x1E, 0x2F,
-    0x8A, 0x91, 0x72, 0x51, 0x5C, 0x6C, 0xEE, 0x8E, 0x26, 0x3B, 0x3A, 0x0F, 0x9E, 0x97, 0xB8, 0xC9,
-    0xDD, 0x22, 0x06, 0xFD, 0xAB, 0x52, 0x3A, 0xA5, 0x9F, 0xFA, 0xD9, 0x12, 0x16, 0x2D, 0xDD, 0xCA,
-    0x2B, 0x7A, 0x26, 0xC4, 0x9A, 0x51, 0xD3, 0x97, 0xE8, 0xD7, 0x45, 0x47, 0x21, 0x76, 0x92, 0xC4,
-    0x60, 0xE3, 0xD2, 0x92, 0x17, 0x86, 0xA9, 0x04, 0x37, 0x72, 0xF1, 0x4D, 0xA5, 0xB4, 0xB9, 0x65,
-    0x98, 0x39, 0xA5, 0x5B, 0xE2, 0xE6, 0xBE, 0x12, 0x96, 0x34, 0x8D, 0xC1, 0xAB, 0x8A, 0x52, 0xB9,
-    0x4F, 0xAA, 0xDE, 0xCA, 0x25, 0xC0, 0x6A, 0x7E, 0x8A, 0x17, 0x99, 0xC5, 0xBB, 0xDC, 0x27, 0x31,
-    0x96, 0xA6, 0x2B, 0x7F, 0x45, 0x92, 0x20, 0x5B, 0xA7, 0xF0, 0xCC, 0xAA, 0x6C, 0x93, 0x22, 0x88,
-    0x36, 0x04, 0x4F, 0x75, 0x54, 0x92, 0x20, 0x48, 0xD6, 0x19, 0xEF, 0x88, 0x9C, 0xC6, 0x6F, 0x40,
-    0x08, 0xD6, 0x94, 0x13, 0x13, 0x96, 0xEE, 0xE2, 0x75, 0x9E, 0xCB, 0x92, 0xEF, 0x52, 0x3E, 0xE9,
-    0x98, 0x6F, 0x32, 0xF1, 0xA1, 0x25, 0x77, 0x7C, 0x39, 0x93, 0x31, 0x59, 0x02, 0x19, 0x21, 0x34,
-    0xEC, 0x54, 0xFC, 0x82, 0x97, 0x4F, 0x75, 0xAB, 0x22, 0xB0, 0xBE, 0xC3, 0x0F, 0x51, 0x25, 0x67,
-    0x9C, 0xE6, 0xE0, 0x0E, 0x24, 0x02, 0x31, 0x36, 0xCD, 0x08, 0x2B, 0x34, 0x46, 0x82, 0xE6, 0x37,
-    0x33, 0x0B, 0x63, 0x5F, 0xD7, 0x88, 0x93, 0x1F, 0xDE, 0xFC, 0x5C, 0x25, 0xC9, 0x88, 0xCB, 0x42,
-    0x59, 0x21, 0xD6, 0x36, 0xE2, 0x42, 0x04, 0xF7, 0x74, 0xA7, 0xE0, 0x20, 0x93, 0xA6, 0x96, 0x60,
-    0x3C, 0x4B, 0xDF, 0x69, 0xDA, 0x02, 0xC5, 0xBD, 0x05, 0x86, 0x4E, 0x39, 0xF9, 0x57, 0x42, 0x3E,
-    0x48, 0x8A, 0x53, 0xF1, 0xBF, 0x23, 0x92, 0x9F, 0x9F, 0xA1, 0x3C, 0x6C, 0x52, 0x0F, 0xCC, 0xF4,
-    0x95, 0x74, 0x07, 0x9F, 0x56, 0x44, 0xC9, 0xC7, 0x36, 0xEE, 0x78, 0x0F, 0x97, 0x33, 0x89, 0xEB,
-    0xEE, 0xFE, 0x7B, 0xDC, 0x12, 0xB2, 0x77, 0x49, 0xC8, 0x73, 0x5F, 0xA1, 0xEC, 0x2F, 0x89, 0x57,
-    0x08, 0x6C, 0x6C, 0x6A, 0xDD, 0xF3, 0x23, 0x69, 0x2A, 0xAC, 0xD0, 0x17, 0xCF, 0xC0, 0x59, 0x40,
-    0x1A, 0xA8, 0xA6, 0x05, 0x3E, 0x92, 0x64, 0xDC, 0x91, 0xFC, 0xBB, 0xF3, 0xA0, 0xF5, 0x17, 0x20,
-    0x38, 0xA4, 0x85, 0x5F, 0xFB, 0x44, 0x83, 0x91, 0x2B, 0xB8, 0xBF, 0x87, 0x2D, 0xE3, 0x5F, 0xBF,
-    0xAE, 0xF7, 0x7A, 0x24, 0x96, 0x9B, 0x61, 0x4F, 0xA1, 0x7C, 0xE4, 0x7A, 0x4B, 0xB0, 0x52, 0x1E,
-    0x91, 0xF2, 0x26, 0x75, 0x40, 0xF0, 0xED, 0xD2, 0x69, 0x9A, 0x31, 0xE4, 0x84, 0x08, 0xD2, 0x63,
-    0xD8, 0x1A, 0x8C, 0xB3, 0xC9, 0xB2, 0xE7, 0xDD, 0xCC, 0x7D, 0x2F, 0xA3, 0x08, 0xE8, 0x10, 0x9F,
-    0xDF, 0x60, 0xA8, 0x31, 0xE7, 0xBD, 0x4E, 0xF0, 0x5E, 0x7A, 0x94, 0xFC, 0x68, 0xBC, 0x8B, 0x8D,
-    0x9B, 0x8A, 0x21, 0x02, 0x2A, 0x95, 0xA8, 0x94, 0x6D, 0x09, 0x72, 0xC8, 0x2C, 0xCC, 0xE0, 0xC1,
-    0x09, 0xBE, 0xC9, 0x10, 0x5E, 0xEB, 0xC1, 0x7D, 0xC1, 0x05, 0x02, 0xCD, 0x0E, 0x54, 0xED, 0x55,
-    0x81, 0x91, 0x9E, 0x49, 0x2E, 0xDF, 0x19, 0x31, 0xBE, 0x14, 0x3E, 0x19, 0x89, 0xC9, 0x48, 0xD3,
-    0xEC, 0x4E, 0x0C, 0x55, 0x16, 0xE8, 0x7F, 0xAB, 0xB4, 0x99, 0x55, 0x06, 0xAC, 0xAD, 0x0B, 0xF4,
-    0xBD, 0x7D, 0x09, 0xAA, 0x72, 0x43, 0x7A, 0xA3, 0x02, 0x8A, 0x8D, 0x73, 0x28, 0x01, 0xC2, 0x09,
-    0x69, 0x1C, 0x8B, 0x94, 0xD9, 0x32, 0x59, 0x5B, 0x93, 0x1E, 0x58, 0xFA, 0x11, 0x38, 0x89, 0xA1,
-    0x52, 0x1B, 0xD4, 0xDD, 0xF1, 0xEA, 0xA7, 0x10, 0xDD, 0x6F, 0x89, 0x36, 0x13, 0xA2, 0x7B, 0x4D,
-    0xE1, 0xFD, 0x37, 0xC2, 0x5E, 0x68, 0xA0, 0x80, 0x07, 0x4F, 0x4F, 0xF4, 0x16, 0xE5, 0x94, 0x73,
-    0x53, 0xEC, 0x9C, 0x34, 0xD0, 0x20, 0x1C, 0x57, 0x06, 0xAF, 0x60, 0xDB, 0xE6, 0x9A, 0x25, 0x39,
-    0xA4, 0xB8, 0x19, 0xC9, 0xFC, 0x0C, 0x26, 0xA9, 0x14, 0x57, 0x30, 0x47, 0xEF, 0xF1, 0x95, 0x02,
-    0xA6, 0xD7, 0xA4, 0x96, 0xE0, 0xA0, 0x3E, 0x1C, 0x67, 0x68, 0xDB, 0x72, 0xFB, 0xE6, 0xAC, 0x0A,
-    0x9E, 0xDB, 0xA0, 0xFA, 0x61, 0x10, 0x30, 0xDE, 0x95, 0x76, 0x5F, 0x12, 0x8F, 0x40, 0x8E, 0xD3,
-    0xE3, 0x57, 0x49, 0x45, 0x89, 0xCB, 0x63, 0x06, 0xF4, 0xA3, 0x97, 0xC7, 0xB7, 0xF7, 0x68, 0xF6,
-    0xA9, 0x4B, 0x21, 0x24, 0xDC, 0x56, 0x8F, 0xA4, 0xC9, 0x9D, 0xDB, 0x37, 0x0F, 0xED, 0x7C, 0x82,
-    0x9B, 0x8B, 0xFC, 0x43, 0x20, 0x41, 0x7A, 0x4A, 0xAE, 0xCD, 0xED, 0x43, 0x6E, 0x45, 0xF4, 0xE8,
-    0xA6, 0xEC, 0xDB, 0x35, 0x83, 0x9C, 0xF6, 0x38, 0x84, 0x30, 0x0A, 0x39, 0xF7, 0x78, 0x42, 0xAF,
-    0x2C, 0xC1, 0xF2, 0x61, 0x7E, 0x1E, 0x53, 0x5C, 0x50, 0x1C, 0x35, 0x1D, 0x67, 0x93, 0xC9, 0xA5,
-    0xC4, 0x2F, 0xC7, 0x6A, 0x85, 0xC2, 0x7C, 0xE4, 0x93, 0x32, 0xA6, 0xA8, 0xF0, 0xE6, 0x1E, 0x2F,
-    0x53, 0x6A, 0x05, 0x5D, 0xF0, 0xE8, 0xE5, 0x47, 0xB7, 0xC9, 0x76, 0x45, 0x05, 0xA4, 0xAA, 0x46,
-    0x3D, 0x2E, 0x30, 0x1F, 0x85, 0xB8, 0x02, 0xAE, 0x47, 0x4F, 0xF8, 0x9A, 0x43, 0xDF, 0x31, 0xB2,
-    0xF2, 0x92, 0x71, 0x73, 0x2F, 0x5D, 0x74, 0xBE, 0x87, 0x0D, 0x6A, 0xFF, 0xE0, 0x27, 0xE9, 0x32,
-    0x2E, 0x56, 0x6A, 0xE3, 0x29, 0xB4, 0x0A, 0x1D, 0xD4, 0x32, 0x3F, 0x56, 0x79, 0x6C, 0xB4, 0x1B,
-    0xC7, 0x9D, 0x13, 0xCE, 0x1E, 0x73, 0x97, 0x54, 0xFC, 0xF8, 0x49, 0xA6, 0x0C, 0x54, 0xAD, 0x78,
-    0xE3, 0x96, 0x7E, 0x0F, 0x32, 0x51, 0xE1, 0xD7, 0xED, 0x2A, 0x51, 0x2B, 0x7B, 0xEF, 0xE0, 0x76,
-    0xA6, 0xD4, 0x0F, 0x60, 0x24, 0xAD, 0xE8, 0xE7, 0x34, 0xC0, 0xF9, 0x85, 0x8D, 0xCF, 0xB3, 0x47,
-    0x4A, 0xE9, 0x07, 0xBB, 0x77, 0x21, 0x7C, 0x3F, 0xFB, 0xA3, 0x97, 0x9B, 0xE6, 0xDF, 0xC7, 0xEF,
-    0x6C, 0xEC, 0xEB, 0x8A, 0x90, 0x3C, 0xD6, 0x31, 0x10, 0xBC, 0x33, 0xD8, 0xB5, 0x32, 0x85, 0x30,
-    0x8C, 0x1A, 0xC4, 0xBD, 0xA3, 0x9B, 0x22, 0xC2, 0xA8, 0x44, 0x7B, 0x08, 0x94, 0x34, 0x87, 0x30,
-    0xB5, 0x02, 0x75, 0xCB, 0xD6, 0x1A, 0x7A, 0xA0, 0x86, 0xF2, 0xD4, 0x90, 0xC2, 0x4C, 0xE7, 0x32,
-    0xA0, 0x3C, 0x6C, 0x6F, 0xFD, 0x74, 0x62, 0x96, 0x8F, 0x12, 0xB3, 0xA0, 0x09, 0xF3, 0x59, 0x6C,
-    0xB1, 0x61, 0x55, 0xC6, 0x63, 0xEF, 0x24, 0xD6, 0x5A, 0x68, 0x23, 0xDC, 0x92, 0x7C, 0x99, 0xF2,
-    0xB4, 0xC1, 0x8B, 0x59, 0x07, 0xC9, 0x47, 0x9E, 0xB0, 0x3E, 0xD8, 0x74, 0x34, 0x24, 0x23, 0x34,
-    0x05, 0x98, 0x34, 0x36, 0x7E, 0x13, 0x9C, 0x2C, 0x5B, 0x8B, 0x8E, 0xD3, 0x13, 0x64, 0x85, 0x86,
-    0x60, 0x0D, 0x9A, 0xA1, 0xC7, 0xE1, 0xB6, 0xA7, 0x49, 0x75, 0xBE, 0x30, 0x9B, 0x77, 0x06, 0x23,
-    0x9A, 0x62, 0x2D, 0xF1, 0x43, 0x24, 0x93, 0x51, 0x67, 0x28, 0x84, 0x62, 0x1A, 0xBF, 0xA3, 0xAC,
-    0x45, 0x22, 0xF8, 0x36, 0xFE, 0x9B, 0xD0, 0x00, 0x2C, 0xC1, 0xFD, 0xD7, 0x2F, 0x82, 0x97, 0xD2,
-    0xAF, 0x19, 0x27, 0x1B, 0x4B, 0x75, 0xA9, 0x98, 0x46, 0xCE, 0x29, 0x92, 0x5B, 0x6A, 0x73, 0xD6,
-    0xDF, 0xE5, 0x88, 0x1F, 0x2F, 0x4C, 0x83, 0x40, 0xB5, 0x87, 0x2C, 0x83, 0xD8, 0x11, 0x17, 0x6E,
-    0x1E, 0xE6, 0x0C, 0x7E, 0x3E, 0x42, 0x54, 0x80, 0xD0, 0x17, 0xE0, 0xFE, 0x60, 0x93, 0xE2, 0x1B,
-    0xAB, 0xA4, 0xE4, 0xC1, 0xB6, 0xE6, 0xBE, 0x33, 0x01, 0x17, 0x36, 0x84, 0x96, 0x12, 0x4D, 0x6D,
-    0x8B, 0xAE, 0x42, 0xEC, 0xA6, 0xCE, 0x72, 0x9C, 0xB7, 0xFC, 0x29, 0x8C, 0x20, 0xA2, 0x2A, 0xC6,
-    0x4C, 0x37, 0x5D, 0xEA, 0x54, 0x3F, 0x4E, 0x3A, 0x69, 0x04, 0xB9, 0x7E, 0x0B, 0x3F, 0x4C, 0xE1,
-    0xFD, 0x63, 0x30, 0xE8, 0x3D, 0x8C, 0x98, 0x14, 0x7B, 0x19, 0x74, 0x84, 0x20, 0x99, 0x7B, 0x2D,
-    0x7C, 0x04, 0xB3, 0x83, 0x2E, 0xB1, 0x9C, 0x97, 0x3D, 0xD9, 0x0A, 0x60, 0x8B, 0xD5, 0x51, 0xC0,
-    0x4A, 0xEE, 0x9A, 0xFF, 0x35, 0xE1, 0x0F, 0xC6, 0xB2, 0xEF, 0x55, 0x64, 0x6E, 0x01, 0xAB, 0xDF,
-    0x75, 0x2A, 0x17, 0x1F, 0xC9, 0x5B, 0x04, 0x31, 0x93, 0x97, 0xF8, 0xC7, 0xCA, 0x5A, 0x1A, 0x1B,
-    0x4F, 0xE3, 0x4E, 0xDE, 0x71, 0x36, 0x47, 0x39, 0x93, 0xC4, 0x1D, 0x39, 0x26, 0xE6, 0x50, 0x55,
-    0xB0, 0xAE, 0x42, 0x59, 0xEA, 0xA5, 0x56, 0x53, 0xEA, 0x6F, 0x0A, 0x0F, 0x8A, 0x56, 0x51, 0xA1,
-    0xF1, 0x0E, 0x36, 0xC8, 0x10, 0x33, 0xCB, 0x0F, 0xA9, 0xA7, 0xA8, 0x80, 0xC7, 0x90, 0x9F, 0x90,
-    0xAC, 0xA8, 0x9A, 0xAE, 0x34, 0x59, 0xBB, 0xDF, 0xB6, 0x55, 0x74, 0x74, 0x28, 0x3C, 0x38, 0xA3,
-    0x17, 0xA8, 0x28, 0xAF, 0x18, 0x64, 0xCB, 0xB0, 0xF6, 0xD2, 0x2B, 0xA9, 0xA7, 0x25, 0x64, 0xF3,
-    0xBB, 0x5E, 0xE9, 0xFE, 0xB2, 0x67, 0x7C, 0xCD, 0xDD, 0xA5, 0x04, 0x1F, 0x18, 0xE6, 0x78, 0x6A,
-    0x49, 0x43, 0x4F, 0x25, 0xFE, 0xF8, 0xCB, 0xA3, 0xF7, 0xD0, 0x41, 0x80, 0x14, 0x94, 0x1D, 0xB2,
-    0xC8, 0x5A, 0x7B, 0x55, 0x95, 0xF0, 0xCF, 0xB8, 0x4C, 0x90, 0x44, 0x1D, 0xF7, 0x5A, 0x60, 0xF2,
-    0x45, 0xA9, 0xC9, 0xE6, 0x07, 0xB1, 0xF8, 0x4C, 0x96, 0x98, 0x33, 0xAF, 0x9E, 0x9C, 0x25, 0x0D,
-    0x01, 0x67, 0x9B, 0xEE, 0xDD, 0xA7, 0xF3, 0xD7, 0x60, 0x06, 0xCB, 0x5C, 0x67, 0xA4, 0xEA, 0x93,
-    0xC8, 0xA1, 0x3D, 0xF9, 0x05, 0x64, 0x11, 0xAA, 0x8D, 0x19, 0x3D, 0x41, 0x56, 0x4D, 0x16, 0xB0,
-    0x58, 0xC1, 0xBA, 0x3D, 0x6A, 0x64, 0x20, 0xB1, 0x01, 0x18, 0x4C, 0x32, 0x1A, 0x38, 0x13, 0x31,
-    0x81, 0xCE, 0xC2, 0xC4, 0xA5, 0xE0, 0xD6, 0x41, 0xAA, 0x98, 0xFA, 0xB4, 0xBD, 0x0C, 0x8C, 0xE0,
-    0xFD, 0xB8, 0x80, 0xAF, 0x98, 0xF0, 0xE1, 0xB6, 0xD4, 0xAE, 0x89, 0x65, 0xC9, 0xCB, 0x59, 0x31,
-    0x5C, 0x08, 0x8C, 0x9F, 0xD5, 0x52, 0x85, 0x69, 0xE8, 0xA2, 0x0E, 0x49, 0xB8, 0xD2, 0xC9, 0x54,
-    0x5E, 0x98, 0x90, 0x3A, 0xE4, 0x5F, 0x66, 0x48, 0x25, 0x45, 0x43, 0x52, 0x54, 0xC1, 0x55, 0x82,
-    0x9C, 0xA4, 0x9A, 0xA7, 0x26, 0x95, 0xD1, 0x17, 0x51, 0x35, 0x7C, 0x35, 0xF3, 0x21, 0xCB, 0xEF,
-    0x09, 0xB1, 0xA6, 0x7C, 0x7B, 0x0C, 0xFB, 0x18, 0xCA, 0xF8, 0xF7, 0x4D, 0x98, 0x2D, 0x81, 0x08,
-    0xC0, 0xA9, 0x55, 0xCF, 0x78, 0xAC, 0x17, 0x89, 0xB6, 0x2A, 0x29, 0x63, 0x89, 0x3D, 0x98, 0x9A,
-    0x84, 0x5E, 0x7A, 0xFA, 0xAA, 0xF1, 0x4E, 0xED, 0x39, 0xEF, 0x1E, 0x29, 0x56, 0xA0, 0x66, 0x60,
-    0x0E, 0x86, 0xFC, 0xA1, 0x82, 0x02, 0x40, 0x26, 0x44, 0x50, 0x2A, 0xBE, 0x56, 0xA8, 0x19, 0xAB,
-    0x91, 0xB5, 0x69, 0x68, 0xA4, 0x9A, 0x07, 0x59, 0xF4, 0x24, 0xA7, 0x7A, 0xF1, 0xF4, 0x9F, 0x9B,
-    0xAB, 0xF7, 0x25, 0x9D, 0x2A, 0x70, 0x89, 0x91, 0x15, 0x29, 0x7E, 0x89, 0x32, 0xF4, 0x33, 0x66,
-    0x81, 0x8A, 0x39, 0x25, 0xB6, 0x88, 0xFD, 0xB9, 0x37, 0xB2, 0x27, 0x0B, 0x6A, 0x50, 0x40, 0x44,
-    0x1E, 0x5B, 0x73, 0x5B, 0xB7, 0xB0, 0xBC, 0x6F, 0x6D, 0xBB, 0x56, 0x82, 0x48, 0x5D, 0x62, 0xED,
-    0xFB, 0x81, 0x9A, 0x08, 0xCD, 0x10, 0x54, 0xB4, 0x99, 0x31, 0x6A, 0xCA, 0x0E, 0x06, 0x39, 0x99,
-    0x04, 0xD4, 0x22, 0x2A, 0x99, 0x40, 0x95, 0x57, 0x50, 0x9F, 0x6B, 0xA4, 0x06, 0x5C, 0xAD, 0xD8,
-    0x60, 0xB0, 0x43, 0x13, 0x1E, 0x32, 0xBB, 0x56, 0xD0, 0x13, 0x16, 0x5F, 0xE7, 0x96, 0x7D, 0x6E,
-    0x38, 0x04, 0x35, 0x30, 0xEC, 0x44, 0xFC, 0x12, 0xF2, 0x3F, 0xC9, 0x84, 0xF7, 0x6D, 0x5B, 0x2F,
-    0x60, 0x6D, 0xEA, 0x35, 0x34, 0xCE, 0x84, 0x7E, 0x6C, 0xB6, 0x44, 0xC5, 0x6C, 0x71, 0xAF, 0x12,
-    0x16, 0xE3, 0xE6, 0xD8, 0xCA, 0x63, 0x25, 0x80, 0xB5, 0x73, 0x14, 0xC3, 0xDE, 0x86, 0xA6, 0x24,
-    0x4D, 0x5D, 0xD8, 0x3F, 0x61, 0xF9, 0x70, 0x98, 0x73, 0xB5, 0x61, 0x6C, 0xAC, 0x56, 0x62, 0x6F,
-    0xA9, 0x49, 0x4D, 0x2C, 0x6A, 0xCF, 0xAC, 0xAB, 0x47, 0x24, 0x06, 0xDC, 0xD2, 0x0F, 0x5F, 0x73,
-    0xCD, 0x69, 0xD9, 0x82, 0x5B, 0xC9, 0x05, 0x84, 0xFB, 0x74, 0xD5, 0x2D, 0x83, 0x0C, 0xCB, 0x84,
-    0xC0, 0x8D, 0x7E, 0x4E, 0x33, 0xC4, 0xAF, 0x86, 0x58, 0x6C, 0x07, 0x62, 0x8B, 0xB1, 0x1E, 0x2C,
-    0x0C, 0x21, 0x07, 0x76, 0x4B, 0x13, 0x84, 0xC7, 0xE1, 0x52, 0x68, 0xA2, 0xD4, 0x2F, 0x02, 0xE3,
-    0xD6, 0xB8, 0x30, 0xC2, 0xAE, 0x3D, 0x3A, 0x95, 0x41, 0xAE, 0x28, 0x58, 0x62, 0xC0, 0xF0, 0xBC,
-    0x01, 0x04, 0xCD, 0x24, 0xD0, 0xC3, 0x2B, 0xDE, 0xB5, 0xDE, 0x77, 0xD6, 0xE2, 0xE8, 0x84, 0x11,
-    0xE6, 0x39, 0x1B, 0x21, 0xBA, 0xE3, 0x4C, 0x5B, 0x10, 0x97, 0xF8, 0x07, 0xC1, 0x13, 0x82, 0xC3,
-    0x75, 0x60, 0x88, 0xB0, 0x9B, 0xD4, 0xA3, 0x46, 0xA0, 0x83, 0x90, 0x8B, 0x2C, 0xB2, 0xC8, 0x58,
-    0xE2, 0x4A, 0xAB, 0x54, 0xC6, 0xB5, 0xAE, 0x92, 0x66, 0xB5, 0xA7, 0x71, 0x85, 0x70, 0x4C, 0xBC,
-    0x69, 0xC5, 0x41, 0x17, 0xD4, 0xD8, 0x16, 0x2E, 0x13, 0x7D, 0x3C, 0xDF, 0xFE, 0x19, 0x7E, 0x66,
-    0x0B, 0x90, 0xA4, 0x0B, 0xEF, 0xF7, 0xBB, 0x34, 0x5B, 0xB7, 0xA5, 0x92, 0x82, 0x98, 0x49, 0x54,
-    0xEC, 0x1F, 0xBD, 0xAC, 0x91, 0x6D, 0x7D, 0xB6, 0x06, 0x44, 0x8A, 0xD2, 0xCC, 0x17, 0xD3, 0xDB,
-    0x88, 0x18, 0x7E, 0x67, 0x8A, 0xAC, 0xBD, 0xAE, 0x3E, 0xFC, 0x0F, 0x7C, 0x28, 0x9E, 0x99, 0xA1,
-    0xAD, 0x6C, 0xAB, 0x39, 0x22, 0xC6, 0xB0, 0xED, 0x07, 0x68, 0x19, 0x4D, 0xB6, 0x58, 0x60, 0x10,
-    0x19, 0x04, 0xDD, 0x12, 0x85, 0xFD, 0x05, 0x97, 0x0A, 0x15, 0xD1, 0x4F, 0x36, 0x28, 0xE2, 0x14,
-    0x51, 0x3A, 0x93, 0x3E, 0x5E, 0xEB, 0xA0, 0x34, 0xC2, 0x2B, 0xF8, 0x37, 0x48, 0xF1, 0x3F, 0x61,
-    0xED, 0xC4, 0xCB, 0x04, 0x01, 0x49, 0xA9, 0x20, 0x05, 0x69, 0x82, 0x17, 0x6A, 0x88, 0x00, 0xE8,
-    0x6D, 0x88, 0xBF, 0xAE, 0x23, 0x45, 0xC4, 0x29, 0xA2, 0xBB, 0x89, 0x5A, 0xC5, 0x30, 0x8E, 0x32,
-    0x66, 0x6B, 0x94, 0xAE, 0x5B, 0x16, 0x77, 0x34, 0x87, 0x28, 0xA1, 0x8B, 0x4A, 0xF2, 0xAA, 0x12,
-    0xBF, 0xBF, 0x2D, 0x1F, 0x97, 0xCE, 0x07, 0x00, 0x22, 0x6C, 0x09, 0xF9, 0x23, 0x09, 0x06, 0x12,
-    0x5E, 0x31, 0x51, 0x58, 0xC4, 0x7E, 0xB5, 0xEE, 0xCD, 0xA8, 0xBA, 0xA7, 0x0E, 0x38, 0x64, 0xAE,
-    0x87, 0x00, 0x35, 0xD9, 0xCB, 0xC2, 0x82, 0xFB, 0xB3, 0xEC, 0x42, 0xE1, 0x6F, 0xC3, 0x61, 0xD4,
-    0x3B, 0xD6, 0x4B, 0xEF, 0xAD, 0x6C, 0x6B, 0x14, 0xC2, 0x6A, 0x89, 0xF8, 0x4E, 0xE9, 0x7E, 0xC1,
-    0xAC, 0xDD, 0xC7, 0x16, 0xDA, 0xDA, 0xB0, 0x53, 0x2B, 0x74, 0xB3, 0x61, 0x06, 0x50, 0xCB, 0xB1,
-    0x2D, 0x80, 0x69, 0x24, 0xFA, 0x78, 0xF3, 0x87, 0x00, 0x53, 0x00, 0x72, 0x09, 0xB1, 0x2A, 0x0F,
-    0x84, 0xEA, 0xAB, 0x94, 0xA5, 0x37, 0x93, 0x60, 0xBF, 0xD1, 0x31, 0x53, 0x51, 0xC2, 0xAE, 0x5E,
-    0xC4, 0x7F, 0x78, 0x47, 0x48, 0xDB, 0xA3, 0xB5, 0xAD, 0xE9, 0x2D, 0xDB, 0xA9, 0x0C, 0x8C, 0xD0,
-    0xCC, 0xE6, 0x33, 0x35, 0x9D, 0xAA, 0xDB, 0x0F, 0x37, 0xFA, 0x93, 0xC8, 0xB7, 0x7D, 0x84, 0xCA,
-    0xE1, 0xE6, 0x77, 0x7B, 0xCD, 0x18, 0x60, 0xF8, 0x15, 0xE6, 0xCE, 0x69, 0x5A, 0xCA, 0xE9, 0x9C,
-    0x14, 0xF2, 0x50, 0xA3, 0xA3, 0xA2, 0x0C, 0xDA, 0x7F, 0x21, 0x2C, 0x7C, 0x57, 0xB0, 0xB5, 0x3F,
-    0xF3, 0x25, 0xF5, 0x8C, 0xF3, 0x31, 0xF6, 0x4F, 0x6C, 0x10, 0x0E, 0x0A, 0xA4, 0xFE, 0x1A, 0x3F,
-    0xDD, 0x51, 0x4B, 0x9D, 0x4B, 0xAD, 0x49, 0x56, 0x16, 0x86, 0x27, 0x28, 0x36, 0x2A, 0xDB, 0xF5,
-    0x8B, 0x6D, 0xD7, 0x8F, 0x7F, 0x8D, 0xAD, 0x3E, 0x69, 0xB6, 0xFC, 0x38, 0xDC, 0xBC, 0x44, 0x40,
-    0x40, 0x94, 0xDE, 0x68, 0x64, 0x0D, 0x10, 0xEB, 0x33, 0xEF, 0x1F, 0x73, 0xB7, 0x80, 0x3B, 0x9E,
-    0x25, 0x1F, 0xCB, 0x93, 0xD2, 0xDE, 0x76, 0x8B, 0xB6, 0x55, 0x1A, 0xE0, 0x16, 0xF2, 0x01, 0x35,
-    0x14, 0x87, 0xD2, 0x03, 0x79, 0x74, 0xDB, 0x13, 0x43, 0xAF, 0xE3, 0x03, 0x2A, 0x5C, 0xDF, 0x30,
-    0xB3, 0x5D, 0xD2, 0x3D, 0x8F, 0xDB, 0xFE, 0xBB, 0x87, 0xB6, 0x7F, 0xA1, 0x8D, 0xFB, 0xAB, 0xD0,
-    0xE3, 0xD9, 0xE0, 0x07, 0xE5, 0x6A, 0xF8, 0x66, 0xF9, 0x20, 0xB0, 0xDF, 0xA9, 0x0C, 0x8D, 0xC4,
-    0xFE, 0x3F, 0x49, 0x5C, 0x4A, 0x73, 0xA4, 0x7A, 0x0A, 0xD2, 0x43, 0x6F, 0x0A, 0x4E, 0x5E, 0xB7,
-    0x6F, 0xEB, 0xF6, 0x2D, 0xFC, 0x43, 0x7D, 0xF3, 0xFF, 0x45, 0xDF, 0xBC, 0x0F, 0x2C, 0x7E, 0x69,
-    0xD7, 0xE9, 0xD9, 0xB7, 0xD8, 0xBE, 0xB5, 0xA5, 0x99, 0xDF, 0xBE, 0x59, 0x71, 0xFB, 0xD6, 0xDD,
-    0xFC, 0x51, 0x5B, 0x3E, 0xDB, 0xB7, 0xF7, 0xFF, 0xF9, 0x32, 0xEB, 0x9E, 0xF7, 0x58, 0x22, 0x89,
-    0xFF, 0x73, 0x2D, 0x1D, 0xFD, 0x5C, 0xB9, 0xF1, 0x6D, 0x3F, 0xAC, 0x7B, 0x2B, 0x66, 0xBF, 0x39,
-    0x53, 0xCA, 0xB5, 0x6E, 0x59, 0xED, 0xBA, 0x52, 0x5A, 0xA5, 0x68, 0x40, 0xD3, 0x9A, 0x45, 0x8D,
-    0x54, 0xE9, 0x50, 0x26, 0xC2, 0xCB, 0x0F, 0xE5, 0xEB, 0x83, 0xB7, 0x25, 0xFA, 0xF0, 0xCF, 0xA4,
-    0x2D, 0x5A, 0xEC, 0x4F, 0xB7, 0xC9, 0xF7, 0xC0, 0x4C, 0x19, 0x32, 0x6D, 0xAB, 0xCC, 0x86, 0x12,
-    0x6D, 0x23, 0x3C, 0x79, 0xF4, 0xC9, 0xDB, 0x3A, 0xDD, 0x16, 0xFA, 0x6C, 0x52, 0x36, 0x24, 0x72,
-    0x58, 0x70, 0x52, 0x23, 0xAE, 0x87, 0x03, 0x5E, 0x7E, 0x1F, 0xFA, 0xF3, 0xFE, 0xAB, 0x42, 0x58,
-    0x19, 0x5E, 0xC7, 0xE5, 0x07, 0xE1, 0x0D, 0x5C, 0x7E, 0xF9, 0x63, 0x82, 0x8F, 0xFE, 0x7D, 0x84,
-    0x88, 0xB8, 0x27, 0x5E, 0xED, 0x37, 0x4C, 0x33, 0x08, 0x33, 0x03, 0x9A, 0x42, 0x62, 0xDA, 0xC0,
-    0x74, 0xD5, 0xC6, 0x33, 0xD0, 0xE7, 0x1E, 0xED, 0x0C, 0xCA, 0xB7, 0xFE, 0x44, 0x5C, 0x94, 0x29,
-    0x61, 0xB1, 0x0D, 0x26, 0x90, 0x78, 0x80, 0xFA, 0xD2, 0x08, 0xB7, 0xD6, 0xF8, 0xC8, 0x38, 0x04,
-    0xAA, 0xFA, 0x6E, 0xE5, 0x95, 0xA1, 0x09, 0x55, 0x4F, 0xDF, 0x64, 0xD4, 0x0B, 0x89, 0x6A, 0xE0,
-    0xE4, 0x89, 0x81, 0x4F, 0x45, 0x15, 0x2C, 0x3F, 0x18, 0x93, 0xFC, 0x8F, 0x00, 0xAB, 0x9C, 0xFF,
-    0x29, 0x99, 0x80, 0xEF, 0x43, 0xCC, 0x49, 0xF4, 0x12, 0x2E, 0xDF, 0x28, 0xF0, 0x83, 0x7C, 0xB8,
-    0x03, 0x97, 0x8C, 0xE3, 0xD4, 0x1D, 0x06, 0xEF, 0x03, 0x0E, 0x39, 0xD0, 0x52, 0x92, 0x26, 0xA8,
-    0xF3, 0x0D, 0x22, 0x68, 0x58, 0xBA, 0x93, 0x5C, 0xA1, 0x9A, 0x57, 0xF8, 0xA8, 0xEA, 0xD6, 0xF4,
-    0x60, 0x73, 0xF5, 0xB0, 0x23, 0x98, 0x60, 0x7A, 0xEC, 0x1B, 0xCD, 0x9B, 0x1E, 0xC0, 0xD2, 0x36,
-    0x88, 0x06, 0x58, 0xAA, 0x48, 0x2E, 0xE8, 0x8E, 0xD3, 0x44, 0xB3, 0xA5, 0x4C, 0x30, 0x06, 0x10,
-    0x2F, 0xE3, 0xC1, 0xA8, 0x2D, 0xDA, 0x50, 0x24, 0x9E, 0x61, 0xDC, 0xA7, 0x42, 0xD6, 0x8A, 0xAE,
-    0x81, 0x82, 0xEA, 0xE5, 0xC8, 0xF1, 0x3A, 0x49, 0x48, 0xD8, 0x64, 0xA7, 0x56, 0xA4, 0xD3, 0x4A,
-    0x5C, 0xC3, 0x75, 0x8E, 0xD5, 0xCA, 0xCE, 0xD3, 0x6B, 0xC5, 0x45, 0x26, 0xF6, 0x81, 0xB0, 0x18,
-    0xDC, 0xC3, 0x2E, 0xF9, 0x7E, 0x3E, 0xAD, 0xA4, 0xAA, 0x5A, 0x7C, 0x60, 0x80, 0xFB, 0xCB, 0x63,
-    0xED, 0xEB, 0xEC, 0x1B, 0x5A, 0x3A, 0xF6, 0x5E, 0xCE, 0x03, 0xB3, 0x2C, 0x95, 0x9B, 0x47, 0xB2,
-    0xE6, 0x16, 0x3E, 0x64, 0xD7, 0x87, 0x1C, 0xB3, 0xA1, 0xD4, 0x58, 0xF4, 0x62, 0xAD, 0xC9, 0xF6,
-    0xCB, 0x55, 0x71, 0xD3, 0xF9, 0xC7, 0x3C, 0xFD, 0x23, 0x60, 0x37, 0xC6, 0xDD, 0xF8, 0x0C, 0x7A,
-    0xA5, 0xF7, 0x02, 0x24, 0xDC, 0x01, 0x16, 0x6D, 0x0B, 0x17, 0x4E, 0x5B, 0x8E, 0x9F, 0xEF, 0x04,
-    0x2C, 0x8D, 0xB4, 0x53, 0x98, 0xEC, 0xC2, 0xAC, 0x12, 0x85, 0x84, 0x29, 0x41, 0x55, 0xC6, 0xF2,
-    0x1C, 0x49, 0xA2, 0xA0, 0xE6, 0x2B, 0xB2, 0xBD, 0xC6, 0x70, 0x18, 0x6B, 0xFE, 0x00, 0x0C, 0x63,
-    0xD7, 0xB0, 0xA4, 0x6E, 0x9A, 0x9F, 0xDC, 0xD1, 0x26, 0x5A, 0xCD, 0x06, 0xDE, 0x90, 0x7D, 0x96,
-    0x9A, 0xA4, 0x4F, 0x0A, 0xD0, 0x93, 0x77, 0x00, 0x30, 0x0F, 0x8E, 0x56, 0x60, 0xCE, 0x20, 0xC3,
-    0xBE, 0x99, 0x5B, 0x84, 0x08, 0xD1, 0x8B, 0x08, 0x95, 0x5B, 0x7E, 0xE6, 0xE6, 0xCB, 0x50, 0xF4,
-    0xBE, 0x5C, 0x03, 0xD6, 0xCB, 0x6D, 0x91, 0x58, 0xCC, 0x20, 0x07, 0x3B, 0xF2, 0x91, 0x82, 0x38,
-    0x23, 0x19, 0x75, 0xED, 0xFC, 0xA3, 0x47, 0x4C, 0x19, 0xB2, 0xC3, 0x29, 0xE3, 0x74, 0x80, 0x13,
-    0x0D, 0x7C, 0xC4, 0x34, 0xBE, 0xC3, 0x40, 0x9F, 0x88, 0xED, 0xCE, 0x7A, 0x39, 0x03, 0x7F, 0x45,
-    0x17, 0xE8, 0x93, 0xAD, 0x75, 0xB2, 0x65, 0x67, 0x3C, 0xC6, 0x1B, 0xFF, 0x68, 0x90, 0x6B, 0x9F,
-    0x93, 0x2D, 0xA1, 0x92, 0x35, 0x3C, 0x6E, 0x3B, 0x77, 0xB8, 0x88, 0x3C, 0x7E, 0xFC, 0xF3, 0xFF,
-    0x64, 0x30, 0xC8, 0x98, 0xC8, 0x0D, 0xE2, 0x6E, 0x90, 0xF9, 0xBB, 0x4F, 0xAE, 0x39, 0xC0, 0xAD,
-    0xAE, 0x76, 0xA8, 0x1E, 0xC3, 0xE3, 0x3C, 0x54, 0x9A, 0x29, 0xF4, 0xE5, 0x17, 0x6C, 0x48, 0xD4,
-    0xB6, 0xAA, 0x59, 0x63, 0xBE, 0x63, 0x81, 0x91, 0xAB, 0xB5, 0x93, 0x41, 0xFA, 0x22, 0x0C, 0x22,
-    0xE1, 0xA4, 0x29, 0x3C, 0x78, 0x55, 0x9B, 0x86, 0x60, 0x66, 0xC0, 0xF4, 0x1E, 0xF2, 0x93, 0x5C,
-    0x99, 0xC2, 0xD0, 0x93, 0x32, 0x9F, 0x86, 0x29, 0x2D, 0x3E, 0x30, 0x73, 0xB3, 0xA1, 0x7F, 0xDA,
-    0x48, 0xA7, 0x15, 0xE0, 0x57, 0x2B, 0xE0, 0x69, 0x45, 0x71, 0x2E, 0x07, 0x4A, 0x6E, 0x8E, 0xC0,
-    0x59, 0x92, 0x37, 0x98, 0xC8, 0x7D, 0xED, 0xC4, 0x08, 0x5F, 0xC1, 0xAC, 0x8E, 0xE2, 0x11, 0xBB,
-    0xF5, 0xE0, 0x80, 0x36, 0x12, 0x56, 0xC1, 0x63, 0xD4, 0x08, 0x6A, 0x72, 0x62, 0x55, 0xC4, 0x17,
-    0x95, 0xCA, 0x6E, 0x4A, 0xAD, 0x31, 0xC7, 0xC7, 0x2D, 0x81, 0xD1, 0xB6, 0x24, 0xBB, 0xE8, 0xEC,
-    0x59, 0x67, 0x3A, 0x2C, 0xC0, 0x1B, 0x1B, 0x33, 0x50, 0x18, 0x47, 0x67, 0xE1, 0xE3, 0xCB, 0xF4,
-    0x1A, 0x70, 0xD3, 0xDC, 0xBE, 0x45, 0x3B, 0xA4, 0x25, 0x7A, 0xF6, 0x0D, 0xDC, 0x35, 0xAD, 0xE9,
-    0x6F, 0x50, 0x2B, 0x03, 0xD6, 0xB8, 0xEB, 0x5E, 0xB6, 0x82, 0x78, 0x75, 0x1E, 0x72, 0x36, 0x5F,
-    0x37, 0x25, 0xA7, 0x08, 0x8B, 0x12, 0x1C, 0xDC, 0x7C, 0x89, 0x4C, 0x00, 0x47, 0x44, 0x84, 0xD5,
-    0xC1, 0x90, 0x15, 0x17, 0x5B, 0x54, 0x84, 0x64, 0x39, 0xBC, 0x73, 0xF0, 0x70, 0x36, 0x13, 0x6E,
-    0xD9, 0xB4, 0x35, 0x03, 0xCE, 0xFC, 0x66, 0x57, 0x5D, 0xF4, 0x34, 0xA0, 0xC7, 0x02, 0x42, 0xCE,
-    0x12, 0x5E, 0xFC, 0x77, 0x0D, 0x2A, 0xD8, 0xF7, 0x2B, 0x18, 0x55, 0xEE, 0x00, 0xDB, 0x41, 0x02,
-    0x19, 0x7B, 0xEA, 0x7E, 0xE9, 0x9B, 0xA0, 0xF0, 0xF3, 0x10, 0xFF, 0x22, 0x13, 0xE6, 0xB1, 0x89,
-    0xF2, 0x24, 0x4B, 0x72, 0x9A, 0x17, 0x56, 0x5D, 0xB2, 0x30, 0x9A, 0xC6, 0x74, 0x31, 0x5D, 0x1C,
-    0xC8, 0x60, 0x08, 0xA9, 0xC0, 0x78, 0xFB, 0x44, 0x73, 0xF6, 0xBD, 0x64, 0x15, 0xF3, 0xE0, 0x8B,
-    0xDC, 0xF9, 0xC8, 0xC1, 0xA4, 0xC0, 0x12, 0x98, 0x30, 0x83, 0x99, 0x21, 0x69, 0xC7, 0x32, 0x73,
-    0x73, 0x02, 0x8A, 0xE2, 0x06, 0xFA, 0xA3, 0xCD, 0xF5, 0x15, 0x2B, 0x55, 0xA2, 0xF3, 0x0E, 0xE6,
-    0x84, 0x27, 0x9B, 0xDE, 0xB4, 0xD4, 0x92, 0xDE, 0x18, 0x6A, 0xED, 0xA7, 0x08, 0x3D, 0x3D, 0x01,
-    0x09, 0x5E, 0x80, 0xDD, 0xE6, 0xB6, 0xA3, 0xF9, 0x35, 0xF9, 0xA2, 0x45, 0xE9, 0xC8, 0x09, 0xC7,
-    0x6C, 0xC9, 0xDF, 0xB3, 0xEE, 0x24, 0x74, 0x66, 0xA4, 0x3F, 0x2B, 0xDF, 0x1F, 0x42, 0x98, 0x9C,
-    0x94, 0x59, 0x8A, 0x0B, 0x9A, 0x1A, 0xCC, 0x8C, 0xD5, 0x88, 0xE9, 0x06, 0xBC, 0x2D, 0x2C, 0xD0,
-    0xB2, 0xC6, 0x33, 0x9F, 0x34, 0xFB, 0x74, 0x9B, 0xDF, 0x28, 0x0D, 0x32, 0x78, 0xF4, 0xB6, 0x5A,
-    0xA4, 0x26, 0x88, 0xB5, 0xAE, 0x58, 0x4B, 0x1E, 0x8B, 0xED, 0xDB, 0x3A, 0x8C, 0xB1, 0x72, 0x85,
-    0x17, 0xE9, 0x71, 0x61, 0xED, 0xA4, 0x7E, 0x93, 0xC2, 0x07, 0xCB, 0xD8, 0xF6, 0x4A, 0xC6, 0x88,
-    0x30, 0x1F, 0xCE, 0x58, 0xD7, 0x55, 0xDA, 0x96, 0x77, 0x18, 0x39, 0x46, 0x8F, 0x65, 0x7C, 0x8B,
-    0x05, 0xA7, 0xE2, 0x79, 0x07, 0x26, 0x8F, 0x05, 0x9D, 0x6A, 0xCE, 0xA9, 0xE2, 0xA6, 0xEC, 0x35,
-    0x79, 0x3C, 0x4E, 0x67, 0xCA, 0x38, 0x9B, 0xC9, 0x59, 0xC7, 0x9D, 0x92, 0xDD, 0x43, 0x31, 0x7F,
-    0xCF, 0x92, 0x1C, 0x1F, 0xBC, 0x63, 0xBB, 0x9F, 0x3A, 0x14, 0x59, 0xEB, 0xE6, 0xD1, 0x1E, 0x67,
-    0x3A, 0xEC, 0xBD, 0xB4, 0x44, 0x9F, 0xD3, 0xB9, 0xA1, 0xB6, 0xDE, 0x0A, 0xA5, 0x9A, 0x14, 0xD3,
-    0x89, 0x4D, 0x44, 0x3F, 0x9E, 0x21, 0x9B, 0xA3, 0xDA, 0x4A, 0x1C, 0xC0, 0xD5, 0xBC, 0xEB, 0x70,
-    0x3B, 0xCD, 0xAE, 0x77, 0xB0, 0xC7, 0x02, 0xB2, 0xB0, 0x1D, 0x8F, 0x91, 0x95, 0xC2, 0x75, 0xD9,
-    0x88, 0xC0, 0xBE, 0x01, 0xD5, 0x81, 0xCE, 0x90, 0xE2, 0x31, 0xE3, 0x25, 0x87, 0x70, 0xB7, 0x53,
-    0x25, 0x2A, 0xEE, 0x50, 0xC7, 0x7A, 0x47, 0x13, 0xE7, 0x21, 0x38, 0xE5, 0x4C, 0x2F, 0x1D, 0x49,
-    0x4D, 0x76, 0x56, 0x7A, 0x15, 0x3D, 0x5E, 0x29, 0xEA, 0x21, 0x56, 0x3B, 0x3A, 0x94, 0x62, 0x7B,
-    0x52, 0x6E, 0x75, 0x83, 0x0C, 0x26, 0x8E, 0xF5, 0xF4, 0x29, 0x45, 0x88, 0xF2, 0x78, 0x57, 0x6D,
-    0xF1, 0x85, 0x0E, 0x09, 0xCB, 0xB7, 0xDC, 0x54, 0xDC, 0x77, 0x19, 0x70, 0xCA, 0x16, 0xC6, 0x3A,
-    0xC7, 0x64, 0x9E, 0x2F, 0x8C, 0x83, 0xC1, 0x78, 0x77, 0xDA, 0xAD, 0xCF, 0x5F, 0x94, 0xEF, 0x6B,
-    0x9B, 0xE4, 0x6B, 0x9F, 0xCD, 0x14, 0xE6, 0x36, 0x37, 0x37, 0xB9, 0xEC, 0x4F, 0x99, 0xCA, 0xD2,
-    0x43, 0x23, 0x8F, 0xBA, 0xF5, 0xE2, 0x6E, 0xB6, 0x43, 0x36, 0x15, 0x46, 0x0E, 0xDB, 0x56, 0x02,
-    0x7D, 0x80, 0x08, 0xD3, 0x6B, 0x6B, 0x78, 0xDD, 0xDB, 0xDD, 0xB3, 0xE5, 0x67, 0x37, 0x11, 0xC6,
-    0xF6, 0xF7, 0x10, 0x87, 0xE6, 0x7E, 0xFB, 0x72, 0x33, 0x04, 0x9F, 0xAB, 0xB4, 0x23, 0x0E, 0x15,
-    0xB5, 0xCF, 0xE4, 0x8D, 0xD3, 0x1E, 0x70, 0x5D, 0x3A, 0x0F, 0xC1, 0x89, 0xEC, 0x32, 0xBA, 0x7F,
-    0xC3, 0x01, 0xB1, 0x3F, 0xCB, 0xDA, 0xEE, 0xEB, 0xCC, 0x34, 0x0F, 0x84, 0x6E, 0xC0, 0x15, 0x86,
-    0x40, 0x11, 0xE3, 0x13, 0x87, 0x67, 0x1F, 0x99, 0x2D, 0x43, 0xDC, 0x72, 0xA6, 0xB0, 0x8F, 0xDB,
-    0x76, 0x30, 0x89, 0x53, 0x0C, 0x30, 0x6A, 0xA9, 0xB6, 0x7D, 0xE8, 0x39, 0x6D, 0x69, 0x2E, 0xC8,
-    0xD2, 0xAA, 0xDC, 0xBB, 0x86, 0xD5, 0xE6, 0x7E, 0x9B, 0x26, 0x8D, 0xF1, 0x72, 0xAD, 0x92, 0x4D,
-    0x5B, 0x25, 0xEB, 0x83, 0x1E, 0x92, 0x3C, 0x94, 0x5E, 0x0D, 0xE9, 0xCB, 0xF1, 0xB2, 0xD2, 0xD6,
-    0x49, 0x4B, 0x0E, 0xE1, 0x13, 0x27, 0x64, 0x1A, 0xD9, 0x26, 0xB2, 0xEA, 0x1D, 0x91, 0x95, 0x3B,
-    0x9C, 0xB6, 0x73, 0x6C, 0x45, 0xFE, 0xC7, 0x97, 0x08, 0x2B, 0xD7, 0xB8, 0x46, 0xD2, 0x54, 0x9C,
-    0x8A, 0x96, 0x5D, 0xCC, 0x19, 0xC3, 0x99, 0x32, 0x9F, 0x89, 0x2B, 0xB8, 0x88, 0x35, 0xFE, 0xE2,
-    0x19, 0xAC, 0xF1, 0x07, 0xF0, 0xFB, 0x67, 0xC3, 0xA3, 0xC3, 0xE6, 0x6F, 0x66, 0xF2, 0x0E, 0xC2,
-    0xBC, 0x57, 0x21, 0x88, 0x46, 0x9C, 0xFA, 0x3E, 0xC0, 0xCE, 0x5E, 0x05, 0x32, 0x42, 0x7E, 0xEB,
-    0x81, 0x7B, 0x47, 0x7B, 0xAD, 0xC4, 0x0E, 0x09, 0x98, 0x73, 0x08, 0x07, 0x02, 0x83, 0x5D, 0x12,
-    0xFC, 0x00, 0xE1, 0xB2, 0x67, 0x67, 0x63, 0x9C, 0x8F, 0x80, 0x04, 0x4D, 0xCF, 0xD3, 0x18, 0x56,
-    0xBC, 0xE6, 0xFE, 0xEB, 0x8B, 0x92, 0xCF, 0xA4, 0xEA, 0x50, 0x22, 0xC4, 0xD3, 0x37, 0x01, 0xFE,
-    0xF6, 0xA5, 0x5C, 0x95, 0x6D, 0x80, 0x18, 0x60, 0x82, 0x8B, 0x45, 0x60, 0x06, 0x03, 0x44, 0xAC,
-    0x21, 0x17, 0x18, 0xBC, 0x95, 0x6A, 0x9F, 0x93, 0xC1, 0xE4, 0x28, 0xF8, 0xB9, 0x25, 0x27, 0x77,
-    0x03, 0x05, 0xB7, 0xA9, 0xC3, 0x3E, 0x1D, 0x42, 0x33, 0x70, 0x7D, 0x0A, 0xCD, 0xF1, 0x9B, 0xCF,
-    0x46, 0x6D, 0x94, 0xB2, 0x09, 0x04, 0x33, 0xF4, 0xD8, 0xCC, 0x8B, 0x32, 0x7D, 0xAE, 0x00, 0x76,
-    0x53, 0xE2, 0x07, 0x3D, 0x0E, 0x23, 0x87, 0xF6, 0xD1, 0x84, 0xC4, 0x0E, 0xEE, 0xBA, 0x7C, 0x82,
-    0x0D, 0x83, 0x66, 0x16, 0x71, 0xF1, 0x89, 0x16, 0x13, 0x64, 0xD0, 0x74, 0x90, 0x86, 0x7C, 0xE2,
-    0x06, 0xB4, 0x3A, 0xA8, 0x01, 0x16, 0x81, 0xFF, 0xC7, 0x9C, 0xC9, 0x0D, 0x1D, 0xF6, 0x9B, 0xEB,
-    0x49, 0x13, 0x3F, 0xF7, 0x18, 0x1F, 0xAF, 0xB5, 0xE0, 0x37, 0xA8, 0x8E, 0x45, 0x6F, 0x80, 0xE3,
-    0x05, 0x19, 0x90, 0x29, 0x03, 0xC5, 0x0C, 0x03, 0x05, 0x8B, 0x1C, 0x32, 0x30, 0xD4, 0x2C, 0x4C,
-    0x06, 0xD2, 0xA7, 0x64, 0x40, 0x1F, 0x26, 0x78, 0x56, 0x56, 0x81, 0x99, 0x88, 0xFE, 0x66, 0xB7,
-    0x67, 0xDF, 0x63, 0x5B, 0xEE, 0xF9, 0x40, 0xA8, 0xFB, 0x1C, 0xE6, 0x46, 0x28, 0x6C, 0x0A, 0xD4,
-    0x21, 0x0E, 0xE4, 0x1E, 0x7F, 0xC4, 0x98, 0x6B, 0x38, 0x5F, 0x50, 0xC1, 0x6B, 0x05, 0x3E, 0x7F,
-    0x96, 0xB1, 0x69, 0xB7, 0x6B, 0x78, 0x3D, 0x71, 0xEC, 0xC0, 0x52, 0x75, 0x50, 0xA0, 0x9D, 0x76,
-    0xD4, 0x69, 0x35, 0x19, 0xCB, 0x03, 0x1A, 0x49, 0xD2, 0x1A, 0x49, 0xCE, 0xDE, 0x2B, 0x5B, 0x50,
-    0x64, 0xC5, 0xD7, 0xEA, 0x8D, 0x6E, 0x37, 0x64, 0x6B, 0x9E, 0x29, 0x56, 0xA7, 0x92, 0x35, 0xB1,
-    0x95, 0xD1, 0xE9, 0x46, 0x77, 0x3C, 0x2F, 0xF2, 0x7B, 0xA9, 0x3C, 0xFF, 0x9A, 0x3C, 0x73, 0xD5,
-    0x3A, 0xC9, 0x94, 0x89, 0x77, 0x41, 0x36, 0xF4, 0xB1, 0x2C, 0xAB, 0xE0, 0xC1, 0x83, 0x1D, 0x41,
-    0x1D, 0xC0, 0xBC, 0x60, 0x01, 0x3E, 0x46, 0x6D, 0xC4, 0xBF, 0x82, 0xBF, 0x9C, 0xA5, 0xA7, 0xDE,
-    0x83, 0x5F, 0x78, 0x05, 0x6A, 0xF8, 0xB9, 0xD4, 0x16, 0x39, 0xB3, 0xC7, 0x1B, 0xE2, 0xBE, 0xAD,
-    0x66, 0x6F, 0x3B, 0xC3, 0xD4, 0x82, 0xD2, 0xAF, 0x76, 0xAF, 0xD8, 0x47, 0xED, 0x48, 0x19, 0x50,
-    0xC3, 0x87, 0x7B, 0x5F, 0x97, 0xB0, 0x6D, 0x4B, 0x0F, 0xAD, 0xE5, 0x47, 0x76, 0xD2, 0x0E, 0x59,
-    0x2B, 0x0B, 0x87, 0x4D, 0x1F, 0xBB, 0xAF, 0x39, 0xA5, 0xD4, 0xFE, 0xAE, 0x77, 0x08, 0xB0, 0x50,
-    0x13, 0xB4, 0x2A, 0xAA, 0x82, 0x66, 0x45, 0x5D, 0x10, 0xC8, 0x43, 0x19, 0x80, 0xBC, 0x7D, 0x01,
-    0x2B, 0x88, 0xF5, 0x43, 0x15, 0x88, 0x9A, 0x16, 0x49, 0xFD, 0x14, 0x49, 0xAB, 0xD1, 0x7C, 0x76,
-    0x49, 0x9F, 0x52, 0x7B, 0x25, 0x3D, 0x1B, 0xD3, 0x7E, 0xCC, 0x53, 0x8A, 0xF8, 0x83, 0x9C, 0xED,
-    0x29, 0xD4, 0xCF, 0x1C, 0x65, 0xEF, 0xB4, 0x09, 0xCB, 0x02, 0x0A, 0x9B, 0xD5, 0x74, 0x9E, 0x2B,
-    0x17, 0x26, 0x4F, 0xC9, 0xB0, 0x59, 0x2C, 0x7D, 0x3D, 0xD7, 0xB6, 0xAF, 0xCC, 0x40, 0xEB, 0x15,
-    0xB1, 0x22, 0x04, 0x12, 0x1E, 0x66, 0x31, 0x5D, 0x1A, 0x64, 0x37, 0xD9, 0x8E, 0x24, 0x6E, 0x63,
-    0x86, 0x92, 0xF8, 0xCD, 0xBB, 0x28, 0x44, 0xC2, 0xF7, 0x7F, 0x01, 0x07, 0x4F, 0xFE, 0xFA, 0x3D,
-    0xD8, 0xFB, 0x20, 0xF8, 0x08, 0x10, 0x6F, 0xC4, 0xA2, 0x3E, 0xA9, 0xD9, 0x7C, 0x4A, 0x4A, 0x0E,
-    0xF6, 0x92, 0x9C, 0x0D, 0x56, 0xE0, 0xFD, 0x89, 0x0D, 0x6D, 0xB5, 0x93, 0xB8, 0xA5, 0x6B, 0xFA,
-    0xD8, 0x4E, 0x3B, 0x7A, 0x90, 0x0D, 0x36, 0x2A, 0x11, 0x31, 0xD7, 0x10, 0x07, 0x57, 0xBC, 0xFC,
-    0x5E, 0x28, 0xD5, 0x20, 0xC8, 0xD6, 0x06, 0xBF, 0xE2, 0xD3, 0x73, 0x85, 0x06, 0xB0, 0xE6, 0x2D,
-    0xEC, 0x79, 0x83, 0x35, 0xF8, 0xFD, 0x76, 0xAD, 0x76, 0xB4, 0x1E, 0x7C, 0x07, 0xD0, 0x69, 0x5E,
-    0x6C, 0xE6, 0x0D, 0x5F, 0xC9, 0xA4, 0xA6, 0x55, 0xF4, 0xE5, 0xBE, 0x53, 0xD3, 0x69, 0x13, 0x09,
-    0x7F, 0x0A, 0x3A, 0x7B, 0x29, 0x6B, 0x29, 0xB6, 0xE0, 0x49, 0x52, 0x68, 0xC7, 0x7C, 0x4C, 0x25,
-    0xFC, 0x38, 0xB0, 0xCF, 0x0B, 0xC6, 0xC5, 0x74, 0x5E, 0xAC, 0xCD, 0x60, 0xE7, 0xE7, 0xB8, 0x3D,
-    0x9D, 0x76, 0xA7, 0x4A, 0x84, 0x9E, 0x7D, 0xFC, 0xDB, 0xE6, 0x27, 0xEC, 0xB6, 0x86, 0x94, 0xB1,
-    0x02, 0x7D, 0xC6, 0x40, 0xB2, 0xD1, 0x8E, 0xED, 0x7B, 0x33, 0xC3, 0x07, 0x33, 0x10, 0x3A, 0x66,
-    0xEB, 0x1D, 0xBB, 0xF1, 0x99, 0x25, 0xFC, 0xE9, 0x1D, 0xCD, 0x57, 0xE0, 0xB9, 0x1F, 0x66, 0x5E,
-    0x71, 0x5D, 0xE2, 0x1B, 0xD5, 0xE1, 0x49, 0xE0, 0x1A, 0xE2, 0x49, 0x01, 0x53, 0x73, 0x4B, 0xB7,
-    0xF2, 0x0B, 0x06, 0x49, 0x48, 0x1C, 0x0B, 0x8D, 0x46, 0x5A, 0x7A, 0x52, 0xB8, 0xE1, 0xCC, 0xBC,
-    0xB2, 0xD0, 0x8F, 0x4C, 0x42, 0xFC, 0xEB, 0xC0, 0x02, 0x59, 0xC7, 0x74, 0x56, 0x64, 0x21, 0xEC,
-    0xDD, 0x27, 0xE3, 0x84, 0xE2, 0x4F, 0x5A, 0x60, 0x6A, 0x27, 0xA6, 0x60, 0x80, 0xDC, 0xAB, 0x08,
-    0xB4, 0x28, 0xD0, 0x53, 0x2F, 0xEF, 0x1A, 0x77, 0x93, 0xEE, 0x9D, 0xC3, 0x10, 0xAA, 0x27, 0x97,
-    0x27, 0xAF, 0xF9, 0xE5, 0x66, 0xCA, 0x75, 0xF8, 0x3C, 0x82, 0x1D, 0xED, 0xDB, 0x27, 0x12, 0x0A,
-    0xDB, 0x17, 0xDF, 0x6A, 0x1F, 0x23, 0x3C, 0x8C, 0x6A, 0xF5, 0x6E, 0x1D, 0x05, 0x6B, 0xA3, 0xDD,
-    0x0E, 0xC4, 0x08, 0x18, 0x20, 0x2D, 0x16, 0x87, 0xC9, 0xA3, 0x5D, 0x3E, 0x92, 0x10, 0xDA, 0xB5,
-    0x62, 0x69, 0x71, 0x81, 0xAD, 0x31, 0x9C, 0x8D, 0x23, 0x8B, 0xC1, 0x71, 0x7C, 0xEE, 0xAD, 0x8F,
-    0x6F, 0xDA, 0x69, 0x47, 0x2B, 0x0A, 0xFD, 0x39, 0x4F, 0x84, 0x4B, 0x20, 0x58, 0xDA, 0x93, 0xC7,
-    0x93, 0x8E, 0x9E, 0xF5, 0xA4, 0x8F, 0x81, 0x85, 0xCD, 0xE6, 0x26, 0xD7, 0x41, 0xD9, 0xA7, 0xEC,
-    0x68, 0x19, 0x68, 0x51, 0xE5, 0x9A, 0x85, 0x23, 0x87, 0x9F, 0x89, 0xF1, 0xF5, 0x01, 0x92, 0xD2,
-    0x0E, 0xF1, 0xA6, 0x33, 0xBE, 0x1D, 0x4B, 0x25, 0x9F, 0xC4, 0x3A, 0x78, 0x1B, 0x49, 0x80, 0xA3,
-    0x51, 0x4A, 0xF1, 0x59, 0xC9, 0xAC, 0x41, 0x59, 0xF8, 0x70, 0x8C, 0x54, 0xBE, 0x02, 0xA5, 0x9C,
-    0x91, 0xF3, 0x70, 0xFE, 0xE5, 0xBB, 0x16, 0x3C, 0xBD, 0xF6, 0xF9, 0x95, 0x02, 0x86, 0x77, 0x72,
-    0x84, 0x96, 0xE5, 0xE9, 0x2C, 0xB4, 0x64, 0xA8, 0x59, 0x61, 0x62, 0xB0, 0x8F, 0x0A, 0xF6, 0xDB,
-    0x87, 0x09, 0xB1, 0xCE, 0xFF, 0x01, 0x55, 0x52, 0xBF, 0x4F, 0x53, 0x41, 0x1C, 0xFF, 0xDC, 0x5D,
-    0xDB, 0xC3, 0x1E, 0xF4, 0x61, 0x82, 0x09, 0x09, 0x85, 0xD7, 0xA1, 0x03, 0x26, 0x94, 0x07, 0x86,
-    0xA1, 0x43, 0xED, 0x3B, 0x27, 0x7F, 0x11, 0xD3, 0xA1, 0x95, 0x51, 0x46, 0xC3, 0xD4, 0x81, 0x81,
-    0x81, 0x84, 0x57, 0x26, 0x13, 0x17, 0x12, 0x07, 0x8D, 0x93, 0x31, 0x35, 0x31, 0x2E, 0x76, 0x74,
-    0x40, 0x39, 0x65, 0x60, 0x70, 0x79, 0xC8, 0x60, 0xE2, 0xF4, 0x30, 0xFC, 0x01, 0x27, 0x79, 0x43,
-    0x63, 0x1E, 0x7D, 0xDE, 0x41, 0xAA, 0x78, 0xC9, 0x7D, 0xEF, 0x73, 0xDF, 0xDF, 0xBF, 0x36, 0x89,
-    0x16, 0x0A, 0x40, 0x55, 0x90, 0xB0, 0x66, 0x5E, 0xD4, 0xC0, 0x35, 0x7E, 0x86, 0xB3, 0x54, 0xBA,
-    0xAC, 0xB0, 0x7A, 0x30, 0xF6, 0xBA, 0xA3, 0x0D, 0xF7, 0xDA, 0xDA, 0xF3, 0xF4, 0xCC, 0x8A, 0xB3,
-    0xAD, 0xED, 0xF4, 0x02, 0x01, 0x4C, 0x16, 0x6B, 0x7C, 0x3B, 0x8D, 0xC4, 0x09, 0x5C, 0xE7, 0xE0,
-    0x57, 0xD3, 0xA1, 0xA7, 0xBA, 0xEE, 0xF3, 0xE3, 0x46, 0x73, 0x3E, 0x28, 0x0A, 0x04, 0xF9, 0xED,
-    0xBB, 0x0B, 0x5F, 0x62, 0x80, 0x86, 0x44, 0xD7, 0xE1, 0xB2, 0x88, 0xC4, 0xD6, 0x6C, 0x89, 0xF3,
-    0x07, 0xF8, 0x84, 0x82, 0xC5, 0x15, 0x38, 0x30, 0x22, 0x73, 0x3D, 0xFB, 0xF5, 0x0D, 0x3F, 0xA1,
-    0x31, 0xD3, 0x22, 0x62, 0x7D, 0x57, 0x7D, 0x64, 0xDA, 0x93, 0x09, 0xFC, 0xC0, 0x55, 0x4E, 0xC8,
-    0x23, 0x1A, 0xA3, 0x4F, 0xE4, 0xBE, 0x9E, 0xCD, 0xA2, 0x34, 0x46, 0xFB, 0xED, 0x11, 0xD4, 0xDF,
-    0xDC, 0xDB, 0x8B, 0xB0, 0x8E, 0x39, 0xE3, 0x06, 0x57, 0x46, 0xD7, 0x77, 0x32, 0xE5, 0xD2, 0x12,
-    0x46, 0xF8, 0xED, 0x38, 0xD7, 0x9D, 0x0A, 0x55, 0x09, 0x34, 0x77, 0x52, 0x32, 0x49, 0xAF, 0x3D,
-    0x4B, 0x07, 0x36, 0x79, 0xB1, 0x7F, 0x6A, 0x3C, 0x34, 0xEA, 0xEC, 0xB0, 0xEF, 0x39, 0x61, 0x32,
-    0x4C, 0x90, 0xC5, 0x9E, 0x4A, 0x78, 0xE4, 0xD3, 0xBE, 0x51, 0x0A, 0xAE, 0x63, 0x92, 0xDF, 0x0F,
-    0x21, 0xDB, 0x45, 0x26, 0x3D, 0x39, 0x4E, 0xA8, 0xD2, 0x1B, 0x15, 0x07, 0x5E, 0x52, 0x9D, 0x6B,
-    0x57, 0x81, 0x76, 0x5E, 0xCC, 0xE0, 0x0C, 0xD3, 0x36, 0x5F, 0x2E, 0x59, 0x4C, 0xBF, 0x77, 0xD4,
-    0xAC, 0xC1, 0x97, 0xDB, 0x05, 0x6C, 0xD9, 0x78, 0x10, 0xE9, 0x71, 0x4B, 0xFE, 0x2F, 0x10, 0xE9,
-    0x20, 0x4D, 0x43, 0xD9, 0x59, 0xC6, 0xAB, 0x45, 0x75, 0x94, 0x06, 0x70, 0x93, 0x85, 0xD1, 0x85,
-    0xC9, 0xD5, 0xF2, 0x9E, 0x2E, 0x74, 0xCB, 0x4F, 0x16, 0x97, 0xAF, 0x66, 0x80, 0x17, 0x1C, 0xBD,
-    0x1B, 0xC1, 0x65, 0xC3, 0xC9, 0xE9, 0xE2, 0x38, 0x10, 0x9A, 0xF1, 0x08, 0x90, 0xE8, 0xDC, 0xD3,
-    0xBF, 0x76, 0xFB, 0x67, 0x87, 0x3F, 0x18, 0x40, 0x1E, 0xBE, 0x15, 0xC3, 0xD9, 0xD8, 0x6A, 0xD7,
-    0x7A, 0x7E, 0x6A, 0x6D, 0x0B, 0xEC, 0xEB, 0xAD, 0x23, 0xD5, 0xD3, 0xB5, 0x0F, 0x33, 0x13, 0x59,
-    0xF3, 0x4F, 0xBF, 0xBD, 0x97, 0x35, 0xA2, 0x89, 0x81, 0x12, 0x23, 0xA0, 0x40, 0xC3, 0x75, 0xD8,
-    0xCB, 0x76, 0xFB, 0x77, 0xDE, 0x51, 0x54, 0xA2, 0x84, 0x51, 0x10, 0x79, 0xE1, 0xA4, 0x6A, 0xC9,
-    0xAE, 0x25, 0xB6, 0x37, 0xA6, 0xD9, 0x8F, 0x79, 0xBC, 0x8B, 0xD8, 0x0D, 0xBC, 0x95, 0xD0, 0x07,
-    0x1F, 0xC8, 0x79, 0x2B, 0xBB, 0x69, 0xC9, 0xC4, 0x30, 0x30, 0x4F, 0x48, 0xB0, 0x59, 0x9B, 0xA1,
-    0xCA, 0x8F, 0x86, 0xAC, 0x2D, 0x59, 0x16, 0x4F, 0xCD, 0x86, 0x39, 0x8F, 0xC8, 0x8E, 0xD0, 0x43,
-    0x6E, 0x13, 0x2C, 0x18, 0x62, 0xA2, 0x60, 0xC6, 0xFA, 0x19, 0x36, 0xEE, 0x1D, 0xB3, 0x33, 0xAA,
-    0x8B, 0x29, 0x49, 0xDE, 0x75, 0x41, 0xF6, 0x06, 0x12, 0x3B, 0xC8, 0x85, 0x66, 0x90, 0xD4, 0xAA,
-    0x67, 0xFE, 0x56, 0x58, 0xE1, 0xA9, 0x39, 0xBA, 0xD5, 0x6A, 0xAD, 0x84, 0x38, 0xAF, 0xE6, 0x0F,
-    0xC5, 0x7B, 0x5F, 0x6C, 0x1D, 0xD7, 0x79, 0xE7, 0x37, 0x73, 0x4C, 0x4D, 0xA2, 0x11, 0x79, 0xFC,
-    0x20, 0xB7, 0xDD, 0x48, 0xE4, 0xE4, 0x21, 0x0F, 0x49, 0x4A, 0x72, 0xFC, 0xA0, 0x05, 0xB8, 0xC0,
-    0xE5, 0x9D, 0x91, 0x85, 0xAE, 0x81, 0xCD, 0x83, 0xF9, 0x20, 0xB6, 0x40, 0x0C, 0xD4, 0x05, 0xDA,
-    0x87, 0xC2, 0x6D, 0x20, 0x3D, 0x10, 0x28, 0x1D, 0x90, 0xBC, 0x63, 0x0B, 0x85, 0xB0, 0xC8, 0x83,
-    0xD4, 0xA2, 0xC9, 0x02, 0xBB, 0x0F, 0x51, 0x17, 0x29, 0x60, 0x33, 0x68, 0xC5, 0x05, 0x98, 0x96,
-    0x69, 0x2E, 0x75, 0x8F, 0xA4, 0x02, 0x7E, 0xE8, 0x83, 0x67, 0x57, 0x35, 0xF2, 0x60, 0xA0, 0x1E,
-    0xC7, 0x0A, 0x82, 0xDA, 0x28, 0x78, 0xEC, 0x8C, 0xD7, 0x57, 0xD2, 0xDC, 0x99, 0xFE, 0x7E, 0x67,
-    0xEE, 0xA5, 0x24, 0x5B, 0xC9, 0xC6, 0x6E, 0xBA, 0x25, 0xC5, 0xAB, 0xE1, 0xBD, 0x33, 0xE7, 0xCF,
-    0x77, 0xBE, 0xEF, 0xF7, 0xFB, 0x7D, 0xDF, 0x39, 0x14, 0xB9, 0x2C, 0xE2, 0x17, 0x22, 0x0A, 0x3F,
-    0xDE, 0x8A, 0x8C, 0xBF, 0x82, 0xA6, 0x91, 0x78, 0xFB, 0x65, 0xB1, 0xF8, 0xC0, 0x88, 0x2C, 0xE2,
-    0xAD, 0x12, 0x97, 0x78, 0x37, 0xC2, 0xBB, 0xBB, 0xED, 0xBB, 0x1A, 0xEF, 0xAE, 0xE3, 0xE9, 0xA6,
-    0x31, 0x1A, 0x9F, 0x24, 0xCD, 0xB0, 0x7D, 0x58, 0x7B, 0xB9, 0x2C, 0xE9, 0x49, 0x53, 0x1E, 0x3E,
-    0x0E, 0xDF, 0xD9, 0x96, 0x0E, 0xAE, 0xD1, 0x5C, 0x98, 0x89, 0x2C, 0xE3, 0x12, 0xEF, 0x06, 0x78,
-    0x77, 0xA1, 0x7D, 0x97, 0xCD, 0xCD, 0xE1, 0x72, 0xD0, 0x58, 0xE5, 0x9A, 0xAB, 0x65, 0x6A, 0xF5,
-    0xAB, 0x7F, 0xDE, 0xE0, 0x9A, 0x1F, 0x45, 0xF8, 0x68, 0x0F, 0x77, 0xE5, 0x6D, 0xA7, 0x1B, 0xAB,
-    0xEC, 0x54, 0x74, 0x11, 0xCB, 0xA6, 0x74, 0x7C, 0x2B, 0x56, 0xA7, 0xCA, 0x74, 0x64, 0xCE, 0xB3,
-    0x9E, 0x0D, 0xB3, 0x5E, 0xD6, 0xF5, 0x4B, 0x76, 0x7D, 0x1E, 0x8F, 0xA4, 0xC2, 0x9E, 0xFD, 0x5C,
-    0x1E, 0xF1, 0xD5, 0x34, 0x16, 0x63, 0x48, 0xC7, 0xB3, 0x0B, 0xD0, 0x51, 0x8C, 0xCB, 0x61, 0xDB,
-    0x11, 0xFB, 0xEC, 0xE3, 0x12, 0xA3, 0x8B, 0x30, 0xE6, 0xFD, 0xF6, 0x52, 0x1B, 0x3E, 0x38, 0xC8,
-    0xC5, 0xBF, 0x3B, 0xC0, 0x1B, 0x7E, 0x81, 0xDE, 0x3B, 0x9E, 0x95, 0x90, 0x2D, 0xC8, 0x06, 0x7E,
-    0x62, 0x98, 0x41, 0x37, 0x95, 0x6B, 0x0E, 0x1F, 0x88, 0x5C, 0x93, 0x13, 0x45, 0xDC, 0x34, 0x25,
-    0x6C, 0x5A, 0xA1, 0xCB, 0x21, 0x8C, 0x7B, 0x7B, 0x32, 0x82, 0xB8, 0xCE, 0xDC, 0x03, 0x61, 0xBD,
-    0x9D, 0x7A, 0x23, 0x69, 0x07, 0xC0, 0xDE, 0xA5, 0xCB, 0x8B, 0x06, 0x8B, 0x13, 0x35, 0x05, 0x5F,
-    0xF0, 0xDE, 0x91, 0x86, 0xC6, 0xA5, 0x91, 0x9B, 0xEC, 0xB8, 0xF4, 0xCA, 0x10, 0xE6, 0xF1, 0x69,
-    0xA2, 0x5E, 0xD3, 0x14, 0xDE, 0xA0, 0xBE, 0x3C, 0x6E, 0x34, 0xCA, 0x82, 0x1C, 0xC3, 0xAA, 0xD0,
-    0x46, 0x94, 0x86, 0x06, 0xC3, 0x1E, 0xC2, 0x4E, 0x31, 0xC6, 0x1E, 0x14, 0xFE, 0x50, 0x46, 0xD2,
-    0x93, 0xD8, 0x84, 0x68, 0xF5, 0xB8, 0x97, 0x46, 0xBE, 0xD5, 0x66, 0x18, 0xD8, 0x6B, 0x0F, 0x5B,
-    0x06, 0x33, 0x0E, 0x30, 0x47, 0x0C, 0xBF, 0x72, 0x43, 0x89, 0x52, 0x09, 0x8D, 0x33, 0x00, 0xBA,
-    0xDF, 0x74, 0xC3, 0x84, 0x25, 0x82, 0x42, 0xD0, 0x1E, 0x1A, 0x44, 0x8B, 0x68, 0x52, 0xD8, 0x66,
-    0xFB, 0x15, 0x62, 0xB8, 0x89, 0xB8, 0xA7, 0xD1, 0x8E, 0x9B, 0x15, 0x2F, 0x8B, 0xC3, 0x4B, 0xBA,
-    0x5B, 0x9C, 0x1E, 0x5E, 0xA2, 0x7D, 0x67, 0xEC, 0xF1, 0x25, 0xDE, 0x8D, 0x0A, 0x4C, 0x1A, 0x96,
-    0x2E, 0x61, 0x85, 0x54, 0x8E, 0xAE, 0x48, 0xEB, 0x7E, 0x22, 0x2F, 0xAC, 0xD2, 0x8B, 0x64, 0x06,
-    0x97, 0x05, 0x1C, 0x4D, 0x66, 0x65, 0x1E, 0xEB, 0x6B, 0xD4, 0xEB, 0x22, 0x4B, 0xF0, 0xC1, 0x54,
-    0xA5, 0x41, 0xDA, 0x91, 0x1D, 0xD9, 0xF1, 0xF2, 0x19, 0x78, 0xCB, 0xAC, 0x97, 0x7B, 0x85, 0x9F,
-    0xCF, 0xC3, 0xD3, 0xFA, 0x2A, 0x53, 0x77, 0x9B, 0x33, 0x16, 0x77, 0x15, 0x5B, 0x0F, 0xAE, 0x82,
-    0x3C, 0x26, 0x68, 0x24, 0xA0, 0x73, 0xF9, 0x98, 0x65, 0x06, 0x8F, 0x44, 0xCB, 0x70, 0xED, 0x1D,
-    0xFA, 0x67, 0x47, 0xF4, 0x59, 0xAC, 0x28, 0x57, 0xF0, 0x9D, 0xEF, 0x16, 0x21, 0xEE, 0xD8, 0x95,
-    0x1C, 0xAB, 0x2E, 0xA7, 0xD6, 0xF1, 0xC0, 0xC2, 0x3C, 0x5C, 0x3A, 0xD6, 0x82, 0x96, 0x2F, 0x64,
-    0x58, 0xDE, 0x17, 0x73, 0xE9, 0xD5, 0xE9, 0xD8, 0x8A, 0x78, 0x88, 0x8B, 0x74, 0xE3, 0x2F, 0xB6,
-    0x56, 0x57, 0x44, 0xE3, 0x5D, 0x18, 0xD1, 0x59, 0x91, 0x66, 0x94, 0xAD, 0xA6, 0x5D, 0x7C, 0x5D,
-    0xC6, 0x12, 0x58, 0x65, 0xE0, 0xB4, 0x05, 0xA6, 0xBE, 0x06, 0x6B, 0x76, 0x24, 0xCE, 0xB4, 0xE8,
-    0x9C, 0xAB, 0xA7, 0x0A, 0xBF, 0xF2, 0x9C, 0x3F, 0xCB, 0x93, 0xB4, 0x02, 0x9C, 0x91, 0x53, 0xE6,
-    0x10, 0x3F, 0xF2, 0x35, 0x84, 0xD9, 0x03, 0xB3, 0x05, 0xCB, 0xD2, 0xD2, 0x43, 0x2C, 0x40, 0x70,
-    0x13, 0x9D, 0xC5, 0x5C, 0x89, 0xBB, 0xF4, 0x70, 0x58, 0x52, 0x12, 0xE7, 0x40, 0x86, 0xBF, 0xE1,
-    0x22, 0xE1, 0xCB, 0xDD, 0x1A, 0x23, 0xBB, 0x05, 0xA3, 0x27, 0x1A, 0x2F, 0xC3, 0x08, 0xFE, 0x98,
-    0x27, 0x25, 0x16, 0xB0, 0x67, 0x27, 0x4D, 0x33, 0x46, 0x9C, 0x4F, 0xB6, 0x57, 0xF8, 0xFA, 0x12,
-    0x87, 0x50, 0x4A, 0x64, 0x30, 0xA7, 0x1A, 0xF7, 0xEA, 0x12, 0x93, 0x42, 0xA8, 0xE7, 0x21, 0xA0,
-    0x40, 0xB6, 0xF0, 0x5B, 0xF0, 0xAE, 0x09, 0xF2, 0x6E, 0x22, 0xB1, 0x7A, 0x6F, 0x28, 0x55, 0x1C,
-    0xE6, 0xEA, 0x47, 0x25, 0x7E, 0x7B, 0xEE, 0x74, 0x25, 0xA3, 0xA1, 0x2E, 0x54, 0x63, 0x92, 0x34,
-    0xAA, 0xBC, 0x4A, 0x06, 0x46, 0x5B, 0x35, 0x92, 0x24, 0x1B, 0x83, 0x8F, 0x7C, 0x51, 0x82, 0x6C,
-    0x07, 0xEB, 0x9D, 0x33, 0x7A, 0x1E, 0xFA, 0x5A, 0x07, 0x78, 0x74, 0x10, 0x67, 0xCB, 0x88, 0xB7,
-    0x45, 0x84, 0x57, 0x84, 0x60, 0xD1, 0x18, 0x81, 0xBE, 0x94, 0x62, 0x8D, 0x30, 0x0D, 0x38, 0x63,
-    0x40, 0xA7, 0x2A, 0xC7, 0xF1, 0x8A, 0x26, 0x7A, 0x99, 0xFC, 0x3A, 0x66, 0x88, 0x19, 0xF1, 0x52,
-    0xE4, 0xF7, 0xE4, 0x28, 0x96, 0x70, 0x0E, 0xAB, 0xBC, 0x80, 0x16, 0x3A, 0x40, 0xBF, 0x0D, 0xB4,
-    0xB2, 0x07, 0xA0, 0x29, 0x11, 0xB4, 0x00, 0x10, 0x0F, 0x78, 0xE2, 0x17, 0x58, 0xD3, 0x3C, 0x02,
-    0x32, 0x2D, 0x62, 0x30, 0x49, 0xD3, 0xA4, 0x09, 0xDD, 0x8F, 0x86, 0x27, 0x92, 0x2D, 0xE1, 0x67,
-    0xAD, 0x35, 0x3A, 0xF1, 0x80, 0x96, 0x84, 0x49, 0xBB, 0x04, 0x0B, 0x7C, 0xAC, 0xB1, 0xD6, 0xE1,
-    0x05, 0x2E, 0x06, 0xDC, 0x37, 0xEF, 0x22, 0x90, 0x34, 0x1A, 0xF5, 0x19, 0x88, 0x7D, 0x19, 0x6C,
-    0x0F, 0x60, 0x76, 0x4C, 0x1E, 0x1E, 0x05, 0x67, 0xDF, 0x47, 0x20, 0xC5, 0x97, 0x72, 0x04, 0x0F,
-    0x90, 0xB2, 0x08, 0x5F, 0x5F, 0x75, 0xF0, 0x68, 0xC7, 0x78, 0x74, 0x96, 0x28, 0x85, 0x36, 0x34,
-    0x5D, 0x19, 0xF3, 0x3E, 0xEF, 0x17, 0xCA, 0xE8, 0xB4, 0x87, 0x16, 0x4A, 0xDC, 0x9F, 0x86, 0xCD,
-    0x38, 0xE6, 0x7A, 0xB5, 0x84, 0xDF, 0xDC, 0xC0, 0x73, 0xB8, 0x75, 0x1A, 0xB0, 0x04, 0x38, 0xDC,
-    0x55, 0x70, 0xAE, 0x2D, 0xB8, 0x6C, 0x1A, 0x66, 0x56, 0x36, 0xD0, 0xC4, 0xF5, 0x22, 0x28, 0x01,
-    0x45, 0xCA, 0xF5, 0xDE, 0xBA, 0x4F, 0xD2, 0x54, 0xDE, 0xDD, 0xED, 0xCB, 0x63, 0x58, 0x26, 0x60,
-    0xD1, 0x47, 0xBB, 0x0F, 0x43, 0xE2, 0x24, 0x76, 0xC7, 0x01, 0xEB, 0xBC, 0x42, 0x01, 0xA3, 0x55,
-    0x33, 0x12, 0x46, 0x9B, 0x66, 0x90, 0x60, 0x6D, 0xE6, 0x60, 0xD7, 0x79, 0x69, 0x11, 0x71, 0x1D,
-    0xD3, 0xDD, 0x55, 0x85, 0x67, 0x55, 0x1E, 0x98, 0xC0, 0x44, 0xDF, 0x7C, 0x2E, 0x1F, 0x00, 0x70,
-    0x11, 0x0E, 0x05, 0x8C, 0x02, 0xC3, 0x84, 0xED, 0x72, 0xF7, 0x1A, 0xEB, 0xDF, 0xDD, 0xCE, 0x74,
-    0x6B, 0x58, 0x52, 0x11, 0x03, 0x25, 0x69, 0x2C, 0x86, 0x95, 0x85, 0x2D, 0x7C, 0x3B, 0x73, 0x64,
-    0xC4, 0x56, 0x22, 0x28, 0x29, 0x22, 0x23, 0xC6, 0xC4, 0x16, 0x38, 0x95, 0xA8, 0x1A, 0x03, 0x52,
-    0x36, 0x31, 0x44, 0x8D, 0x0B, 0x95, 0x83, 0x9D, 0xE4, 0x1B, 0x98, 0x5D, 0xF8, 0xF6, 0xFB, 0x0C,
-    0x9B, 0xA4, 0x87, 0x88, 0x20, 0x61, 0xB0, 0x3F, 0xDD, 0xB8, 0xC1, 0xA3, 0x1D, 0x07, 0xD5, 0x34,
-    0x5E, 0xE8, 0x60, 0x45, 0x35, 0xEE, 0xBD, 0x66, 0x30, 0xC0, 0x7B, 0xC9, 0xBB, 0x77, 0x10, 0x2A,
-    0xD1, 0xB0, 0xB9, 0x04, 0x1C, 0xAF, 0x75, 0xD9, 0x2B, 0xFC, 0xE6, 0x46, 0x73, 0x06, 0xEF, 0x7D,
-    0xEE, 0x36, 0x86, 0x66, 0xA6, 0xC8, 0x46, 0x73, 0x8E, 0xCC, 0x02, 0x73, 0xE4, 0xAA, 0x51, 0x6C,
-    0xBB, 0x4F, 0x58, 0x22, 0xD3, 0x78, 0xF6, 0xF3, 0xFE, 0x30, 0x3A, 0xA8, 0x42, 0xB4, 0x38, 0x68,
-    0x03, 0x57, 0x8E, 0x12, 0x12, 0x36, 0x11, 0xE6, 0xB0, 0x4A, 0x92, 0x69, 0x03, 0x77, 0xEF, 0x4A,
-    0x62, 0xFD, 0xD2, 0x07, 0xDB, 0x99, 0x68, 0x5F, 0xBA, 0xDE, 0x5D, 0xEB, 0x95, 0xFA, 0x12, 0xC2,
-    0xA9, 0xDA, 0x92, 0x24, 0xBC, 0x81, 0x00, 0x82, 0x6B, 0x84, 0x3F, 0xCC, 0xB1, 0xD6, 0x5B, 0x0A,
-    0xA1, 0x65, 0x75, 0x8E, 0x90, 0x05, 0x76, 0x5B, 0x05, 0x2B, 0xA4, 0xFA, 0x10, 0x6C, 0x0B, 0x45,
-    0x02, 0x5D, 0xE7, 0x4C, 0xB0, 0x5E, 0x61, 0xF9, 0x40, 0xB8, 0xC0, 0xAF, 0xBF, 0x8C, 0x15, 0xC4,
-    0xE3, 0x95, 0xC4, 0x39, 0x90, 0x04, 0x04, 0x8E, 0x98, 0x93, 0xBE, 0xD7, 0x14, 0xCA, 0xEA, 0x83,
-    0x34, 0xCA, 0x2A, 0xFC, 0x16, 0xBE, 0x6A, 0x95, 0xDD, 0x8F, 0x53, 0x7D, 0x31, 0xAF, 0x64, 0x7F,
-    0x0B, 0x60, 0xF4, 0x61, 0x01, 0x00, 0x6A, 0xC8, 0x15, 0x16, 0x63, 0x46, 0x44, 0x1B, 0xC4, 0x77,
-    0x4D, 0x84, 0x8E, 0x53, 0x8F, 0x66, 0xEF, 0xE3, 0xA7, 0x0B, 0xD7, 0x8D, 0xF0, 0x13, 0xBE, 0x06,
-    0xD4, 0x7C, 0x17, 0x13, 0xA7, 0x4F, 0xD1, 0xA6, 0x09, 0xE3, 0xA0, 0xA2, 0xB5, 0xF9, 0xC1, 0x50,
-    0xFC, 0xB2, 0xE1, 0xA2, 0x58, 0xE9, 0x06, 0x35, 0xBC, 0xA8, 0xC9, 0x31, 0x65, 0xFA, 0x14, 0xDC,
-    0x87, 0x46, 0xD2, 0x59, 0x1F, 0x74, 0x3B, 0xC4, 0x40, 0x4B, 0xD8, 0x01, 0xAE, 0x0A, 0x1E, 0xE8,
-    0x63, 0xE8, 0x08, 0x47, 0xF0, 0xB9, 0x41, 0x28, 0x66, 0x08, 0x45, 0x50, 0x59, 0x8C, 0x00, 0x4E,
-    0x00, 0x09, 0x9B, 0xED, 0xEC, 0x12, 0xD0, 0x0F, 0x58, 0x13, 0x30, 0x59, 0x4A, 0x23, 0xDD, 0x22,
-    0xDC, 0xF0, 0x3E, 0x34, 0x2F, 0x14, 0xE1, 0xB7, 0xD5, 0x6B, 0xE9, 0x72, 0x67, 0xB9, 0x23, 0xF6,
-    0xFD, 0xF7, 0x6C, 0x70, 0xF3, 0x20, 0xCC, 0x16, 0xF5, 0x10, 0x88, 0x91, 0x5C, 0xB7, 0x81, 0x19,
-    0xA1, 0x19, 0xFF, 0x4A, 0x97, 0x71, 0x5B, 0xA2, 0x0F, 0x7A, 0xFB, 0x14, 0xA8, 0x90, 0x5E, 0xB7,
-    0x41, 0xD2, 0xEF, 0xD3, 0xE3, 0x87, 0x58, 0x1D, 0x80, 0xDB, 0x26, 0x29, 0xB0, 0x4F, 0x87, 0xAF,
-    0xC8, 0x4D, 0x70, 0x06, 0x12, 0xA8, 0xCE, 0x95, 0x13, 0x26, 0x7C, 0x01, 0xA9, 0x37, 0x19, 0x31,
-    0x3E, 0x05, 0xD2, 0xF4, 0x80, 0x86, 0xC0, 0x82, 0xD8, 0x01, 0x62, 0xD6, 0xF2, 0x79, 0xED, 0x54,
-    0x0D, 0xD6, 0xA4, 0x4E, 0x81, 0x12, 0x35, 0x01, 0x69, 0x24, 0x1E, 0xE2, 0x92, 0x41, 0x06, 0x5F,
-    0xD5, 0x19, 0x3A, 0x56, 0x39, 0x87, 0x51, 0x92, 0xFE, 0xFA, 0x1C, 0x58, 0x97, 0x01, 0x88, 0xE5,
-    0x00, 0x32, 0x18, 0x55, 0x7F, 0x0B, 0x72, 0x83, 0x61, 0x03, 0x7F, 0x85, 0xF7, 0x2A, 0x5E, 0xC9,
-    0x89, 0x26, 0x7B, 0x10, 0x16, 0x7B, 0x74, 0x35, 0xFC, 0x94, 0x08, 0x42, 0x84, 0x1D, 0x6C, 0x08,
-    0x69, 0xC2, 0xD0, 0xF3, 0x8B, 0xC0, 0xB0, 0x75, 0x80, 0x46, 0x16, 0x00, 0x38, 0xC2, 0x2C, 0xC2,
-    0x4C, 0x63, 0x4C, 0xB4, 0x8B, 0x79, 0x2E, 0xB3, 0x9F, 0x10, 0x44, 0x88, 0x46, 0x53, 0xA1, 0x6F,
-    0x6E, 0x20, 0xDC, 0xBA, 0x88, 0x65, 0xDE, 0x19, 0x98, 0x13, 0xB9, 0xCF, 0xDE, 0x1A, 0xAC, 0x6B,
-    0xEF, 0x95, 0x16, 0x0A, 0x28, 0x80, 0x88, 0x05, 0x24, 0x7E, 0x32, 0x3F, 0xA9, 0x9F, 0x33, 0x96,
-    0xFB, 0xFE, 0x28, 0x72, 0x6E, 0xC8, 0x21, 0x61, 0xF4, 0x3F, 0xFE, 0x7D, 0xF7, 0x3E, 0xD1, 0xD8,
-    0xDD, 0x4C, 0x72, 0x77, 0xF0, 0xB1, 0x39, 0x6E, 0x8A, 0x78, 0x42, 0xAB, 0xC1, 0x77, 0x52, 0x0F,
-    0x84, 0xB9, 0x6D, 0x81, 0x6A, 0x35, 0xE9, 0x36, 0x77, 0x93, 0x92, 0x41, 0xDD, 0x4E, 0x74, 0x6A,
-    0x75, 0x75, 0x95, 0x76, 0xBE, 0x49, 0x4B, 0xA4, 0x84, 0x08, 0x82, 0x93, 0x3F, 0xE1, 0xD2, 0x4D,
-    0xF9, 0xC8, 0xF0, 0xCA, 0x71, 0xDB, 0x84, 0x83, 0x38, 0x6B, 0x89, 0x80, 0x3D, 0x7B, 0xD5, 0x7D,
-    0x2A, 0x59, 0xF8, 0xD4, 0x54, 0x32, 0x1C, 0x53, 0xC9, 0xC4, 0xF6, 0x77, 0x16, 0x7D, 0xB3, 0xA3,
-    0xD3, 0x53, 0xA7, 0x94, 0x99, 0x3E, 0xE9, 0xDB, 0x30, 0x4C, 0x87, 0xE1, 0xF5, 0x7A, 0x30, 0xC8,
-    0x01, 0xF2, 0xB9, 0x83, 0x1E, 0xAE, 0xED, 0x7D, 0x8D, 0xC8, 0x91, 0x66, 0xAD, 0x36, 0x12, 0x3F,
-    0x23, 0x3A, 0x38, 0x3C, 0x8C, 0xE9, 0x8E, 0x81, 0x73, 0x86, 0x21, 0x5F, 0x62, 0xBE, 0x04, 0xEF,
-    0xF2, 0x2E, 0x07, 0xD7, 0x31, 0x5F, 0x42, 0xCE, 0x99, 0x83, 0x1B, 0xC7, 0xFB, 0x87, 0xC4, 0x6C,
-    0x4B, 0x0A, 0xB7, 0xD4, 0x60, 0x16, 0xC1, 0xEE, 0xE2, 0x01, 0x2F, 0x51, 0x8B, 0xF1, 0x5E, 0x21,
-    0x39, 0x48, 0x00, 0xB3, 0x45, 0x48, 0x48, 0x11, 0x64, 0x41, 0xBA, 0xE0, 0x70, 0x1A, 0xA2, 0x23,
-    0xC8, 0x16, 0x61, 0x87, 0xD2, 0x5D, 0x9A, 0x08, 0xEC, 0xBE, 0xBF, 0x7A, 0x07, 0xDE, 0x30, 0xC4,
-    0x0A, 0x8C, 0x25, 0xFE, 0x98, 0x07, 0x9C, 0xE0, 0x28, 0x76, 0x64, 0x0D, 0xAD, 0x40, 0x58, 0x05,
-    0x69, 0x70, 0x01, 0x9E, 0x05, 0xC1, 0xDD, 0xF1, 0x2A, 0xFD, 0xAD, 0x1A, 0x93, 0x4C, 0xE3, 0xB7,
-    0x8D, 0x63, 0x90, 0x3D, 0xC7, 0x25, 0x51, 0xAB, 0x82, 0x3C, 0xFB, 0x1F, 0x94, 0x09, 0xB3, 0xDD,
-    0x19, 0x59, 0x56, 0x66, 0x0D, 0x52, 0xDD, 0x47, 0x9F, 0xEB, 0x5A, 0x96, 0xFD, 0x7C, 0x09, 0xBF,
-    0x79, 0x60, 0x87, 0x4E, 0x88, 0x05, 0x28, 0x3A, 0x52, 0x86, 0xC0, 0x32, 0xD3, 0x09, 0xD2, 0x39,
-    0x29, 0xE6, 0xE5, 0xFB, 0xCF, 0x7E, 0x93, 0x48, 0xDF, 0x00, 0x87, 0x9A, 0x91, 0xFC, 0x82, 0x6D,
-    0x65, 0x68, 0x6B, 0x81, 0x6D, 0xD9, 0x87, 0xDA, 0xFA, 0xDB, 0x67, 0xBF, 0x55, 0xB2, 0xAD, 0x92,
-    0x3A, 0xCE, 0x4C, 0x54, 0x8C, 0x33, 0xE4, 0x61, 0x1C, 0x0D, 0x2C, 0x30, 0x96, 0x93, 0xA4, 0x06,
-    0xC4, 0xBF, 0xD7, 0x61, 0x5F, 0x88, 0x00, 0x34, 0x3F, 0x3F, 0x27, 0xF3, 0xF0, 0x95, 0x8E, 0x37,
-    0xEC, 0x5E, 0xB5, 0xBD, 0x26, 0x6F, 0x6A, 0x79, 0x50, 0x3A, 0x06, 0xA0, 0x5C, 0x78, 0x22, 0x85,
-    0x59, 0x45, 0x51, 0xD6, 0x85, 0x6E, 0xC4, 0xEC, 0x3B, 0xA4, 0xD2, 0xE8, 0x2C, 0x56, 0x1E, 0xED,
-    0x78, 0xA5, 0x32, 0x73, 0x08, 0x6E, 0xEB, 0x9B, 0x04, 0x9E, 0xB7, 0xA3, 0x33, 0x34, 0x18, 0xE2,
-    0xC1, 0x2D, 0x08, 0xBC, 0x77, 0x1A, 0xAF, 0xA2, 0xFD, 0x06, 0xD2, 0xD4, 0x87, 0x2A, 0x48, 0x1E,
-    0x77, 0x03, 0x2C, 0xEE, 0x8F, 0x28, 0xF8, 0x19, 0x23, 0x1A, 0xDC, 0x1F, 0xD1, 0x80, 0x8A, 0x69,
-    0x60, 0x60, 0xFE, 0x4D, 0x84, 0xB0, 0x6F, 0xC1, 0x46, 0xD1, 0x64, 0xA6, 0x91, 0xE3, 0x5A, 0x34,
-    0x51, 0x4F, 0x72, 0x8C, 0x0D, 0x7F, 0x0F, 0xB1, 0x91, 0xB4, 0x8C, 0x3A, 0xA2, 0x5C, 0x4D, 0xE5,
-    0xDC, 0x44, 0xBC, 0x02, 0x12, 0x8F, 0x63, 0x29, 0x29, 0xC2, 0xCA, 0xE8, 0x45, 0xF8, 0x4A, 0x47,
-    0xD6, 0x3D, 0x5B, 0xCA, 0x92, 0xFF, 0xBF, 0x0B, 0xE9, 0xA8, 0x9B, 0x46, 0xD6, 0xD5, 0xAB, 0x46,
-    0xD6, 0x82, 0x37, 0x52, 0xD9, 0x0D, 0x09, 0x1F, 0xFA, 0x19, 0xD0, 0xF7, 0x0C, 0x71, 0x66, 0x56,
-    0xE7, 0xBD, 0x6C, 0x9E, 0x49, 0x61, 0x27, 0x40, 0x74, 0x2C, 0xC9, 0x60, 0x92, 0x9B, 0xC8, 0x51,
-    0x27, 0x7A, 0x73, 0x2C, 0xC0, 0x1A, 0x18, 0x74, 0x9E, 0x50, 0x83, 0xB9, 0xA9, 0xCC, 0x2B, 0xE1,
-    0xA5, 0xBD, 0x74, 0xD7, 0xE5, 0x4E, 0xD4, 0x3C, 0xC0, 0x81, 0xCC, 0x1B, 0x22, 0x96, 0x87, 0x88,
-    0xE5, 0x3E, 0x62, 0x39, 0xC1, 0x77, 0x9C, 0xC5, 0x46, 0x17, 0xF8, 0x2E, 0xD5, 0x98, 0xE6, 0xCE,
-    0xFD, 0x57, 0x36, 0x17, 0x66, 0x7D, 0x8F, 0xCB, 0x2D, 0x1B, 0xF0, 0x4B, 0x48, 0xC7, 0xA1, 0x06,
-    0x7C, 0x0E, 0x23, 0xCB, 0x21, 0xF4, 0x6A, 0xEB, 0xD5, 0xBF, 0xDD, 0x5A, 0x14, 0xE3, 0xF4, 0x21,
-    0x8A, 0x20, 0x64, 0x88, 0x1C, 0xF4, 0xEE, 0xEF, 0x35, 0x19, 0xE5, 0x50, 0x54, 0x24, 0x29, 0x78,
-    0xC5, 0x27, 0x07, 0x67, 0x24, 0x9A, 0x6B, 0x30, 0x56, 0xC1, 0xF5, 0x90, 0x41, 0x86, 0xB1, 0x14,
-    0xFE, 0xEB, 0x1B, 0xCA, 0x9C, 0x54, 0xD9, 0x7C, 0x90, 0xAE, 0x87, 0x20, 0xB0, 0x6D, 0x3B, 0x23,
-    0x4B, 0xB3, 0xD2, 0x99, 0x97, 0xBD, 0xE5, 0x67, 0xE1, 0x14, 0xC5, 0x00, 0x86, 0xDB, 0xDE, 0x4E,
-    0xE1, 0x1E, 0x8B, 0x4E, 0xC2, 0x60, 0xC1, 0x1E, 0x95, 0x3F, 0x11, 0x7E, 0xFC, 0xED, 0x4C, 0x06,
-    0x95, 0xCC, 0x80, 0xDE, 0xF2, 0x3D, 0xE9, 0x68, 0x0C, 0x19, 0xA0, 0x1D, 0x49, 0x44, 0xB4, 0x06,
-    0x1C, 0x29, 0x03, 0x2F, 0xBD, 0x84, 0x65, 0xB1, 0x32, 0xA7, 0x5D, 0x6E, 0x9C, 0x52, 0xAD, 0x87,
-    0x97, 0x77, 0xC2, 0x74, 0x3A, 0xC8, 0x9E, 0x3D, 0xD3, 0x34, 0x6F, 0xD5, 0xAF, 0xAC, 0xEC, 0xBA,
-    0x30, 0x0B, 0x73, 0x8F, 0x29, 0x76, 0xCC, 0x14, 0xF0, 0xD0, 0xCA, 0x90, 0xD7, 0x1B, 0x12, 0x5C,
-    0xAF, 0xB0, 0xE6, 0xCB, 0xF1, 0x45, 0x38, 0xD0, 0xFB, 0x1F, 0xC0, 0x5E, 0x51, 0x42, 0x98, 0xBC,
-    0x77, 0xC0, 0x44, 0xC4, 0xE1, 0x49, 0x6F, 0xE8, 0x54, 0x90, 0x19, 0x8B, 0x20, 0x75, 0xEF, 0x5E,
-    0x29, 0x5E, 0xDD, 0x83, 0x94, 0x1D, 0x5C, 0x7A, 0x0F, 0xA4, 0xFF, 0x56, 0x03, 0xD6, 0x97, 0x41,
-    0xFA, 0xD8, 0x67, 0x45, 0x2E, 0xCB, 0x49, 0x0A, 0x80, 0x5D, 0x26, 0x20, 0xA7, 0x1E, 0x8B, 0xFC,
-    0x26, 0x8F, 0xDB, 0x04, 0x6A, 0x56, 0x12, 0x1F, 0x8B, 0xD2, 0xF1, 0xFF, 0x39, 0xC8, 0xFE, 0xDA,
-    0xEC, 0x2E, 0x74, 0x74, 0x78, 0x26, 0x7B, 0xBF, 0xD8, 0x9D, 0xDB, 0xD3, 0x7E, 0x2D, 0x36, 0xC9,
-    0x16, 0xE1, 0xE2, 0x2D, 0x10, 0xBD, 0xB0, 0x2B, 0xFE, 0xC8, 0xF1, 0xED, 0x27, 0x7A, 0x4E, 0x43,
-    0x40, 0x5E, 0x34, 0xF4, 0xB6, 0x9F, 0x1A, 0xF9, 0x81, 0xA1, 0xD4, 0x46, 0x7A, 0x88, 0x5C, 0x45,
-    0xBD, 0x69, 0xFC, 0xB7, 0x87, 0x62, 0x7B, 0xD9, 0x06, 0x07, 0x3A, 0x75, 0x56, 0x12, 0x78, 0xDB,
-    0xBC, 0xAC, 0x2D, 0xC9, 0xCE, 0x1A, 0xC0, 0xCA, 0x33, 0x80, 0xB5, 0x42, 0xBD, 0x94, 0x87, 0xCA,
-    0x74, 0xD5, 0x61, 0xA4, 0xC7, 0x90, 0x12, 0x10, 0x53, 0x36, 0x18, 0xAA, 0xA1, 0x5F, 0xA3, 0xB3,
-    0x7B, 0xD7, 0x9B, 0xF4, 0xEB, 0xF6, 0x43, 0xB3, 0xB0, 0xF1, 0x7D, 0xAB, 0xA3, 0x7E, 0x15, 0xDC,
-    0x1C, 0x75, 0x7D, 0x5B, 0x47, 0xE9, 0x30, 0xD1, 0x66, 0x39, 0x3C, 0x63, 0x63, 0xC7, 0x1B, 0x14,
-    0xB9, 0xC8, 0x06, 0x0C, 0xB3, 0x03, 0x66, 0x0B, 0x8E, 0x2F, 0x87, 0x70, 0xCB, 0x65, 0xA0, 0x79,
-    0xDC, 0x96, 0x41, 0x2C, 0x14, 0x01, 0x3D, 0x76, 0xD3, 0x79, 0xEC, 0xD6, 0xB8, 0x60, 0x20, 0xE1,
-    0x50, 0xA2, 0xFF, 0x81, 0x07, 0xD7, 0x75, 0xAA, 0xE1, 0xEE, 0x37, 0x00, 0xA5, 0x58, 0x72, 0xF8,
-    0xAB, 0xFE, 0x93, 0x6B, 0xAC, 0x65, 0xF4, 0x1A, 0x39, 0x32, 0x06, 0xB9, 0xD5, 0xD5, 0x34, 0x6E,
-    0x6A, 0x50, 0x77, 0x0E, 0xA4, 0x05, 0x7B, 0x9B, 0x3D, 0x44, 0x7C, 0x1A, 0xA6, 0x08, 0x41, 0xE7,
-    0x22, 0xBE, 0x05, 0x6D, 0xA3, 0x8D, 0x5C, 0xA6, 0x90, 0x70, 0xAB, 0x37, 0xB1, 0x70, 0xCD, 0xE9,
-    0x1C, 0x9D, 0x2D, 0xC1, 0xCD, 0x66, 0xE0, 0x67, 0x48, 0x73, 0x2D, 0x40, 0xA3, 0x42, 0xD4, 0xF7,
-    0xD2, 0x3D, 0x2A, 0x7C, 0x89, 0x06, 0x90, 0x49, 0x97, 0x86, 0x0E, 0xC8, 0x1D, 0xFF, 0x96, 0x6D,
-    0x75, 0xC3, 0xE5, 0x1A, 0xF7, 0x69, 0x3B, 0xD7, 0x4D, 0x5A, 0xD1, 0x53, 0x3B, 0xC4, 0x71, 0x40,
-    0xE3, 0x22, 0x1D, 0xD6, 0xAF, 0xAF, 0x28, 0x04, 0xC0, 0x44, 0x71, 0xF4, 0x9A, 0xD1, 0xD9, 0xA5,
-    0xE3, 0xCC, 0x7E, 0x2C, 0xFF, 0x21, 0x6C, 0x31, 0x14, 0xC5, 0x64, 0x87, 0x4F, 0x92, 0xD6, 0x98,
-    0x1C, 0xEF, 0xE2, 0x9B, 0xE9, 0x48, 0x07, 0x9F, 0x2C, 0xE3, 0xA3, 0x45, 0x7C, 0x10, 0xC3, 0x1D,
-    0x23, 0x08, 0x1F, 0x66, 0x99, 0xAC, 0x63, 0x90, 0xC9, 0x58, 0x33, 0xA0, 0x8D, 0x62, 0x46, 0x19,
-    0x1A, 0x27, 0xE5, 0xE3, 0xAD, 0x57, 0x5C, 0x57, 0x1D, 0x0A, 0x9D, 0x91, 0xC4, 0x07, 0x07, 0xC5,
-    0xA2, 0xCA, 0xE7, 0x67, 0xC4, 0x06, 0xA1, 0xF4, 0xFD, 0x9B, 0x59, 0x57, 0x6C, 0xA1, 0xD3, 0xBD,
-    0x2E, 0x5C, 0x1C, 0x36, 0xAF, 0x9D, 0x66, 0x38, 0xD1, 0xDC, 0x69, 0xAB, 0x36, 0x2E, 0xC9, 0x2E,
-    0x5C, 0x76, 0x4A, 0x14, 0x73, 0x81, 0xFF, 0x38, 0xE1, 0x81, 0x00, 0x11, 0x9E, 0xC1, 0x18, 0x3B,
-    0x6D, 0xBA, 0xB6, 0x0F, 0xEC, 0x66, 0x3D, 0x03, 0x53, 0xBD, 0x09, 0xC5, 0x49, 0xE2, 0xD5, 0xC6,
-    0x4B, 0xA7, 0x78, 0xEF, 0x2E, 0x01, 0x6F, 0x09, 0x49, 0x57, 0x90, 0x85, 0x7E, 0xAE, 0x0C, 0x78,
-    0x73, 0x49, 0xD6, 0x66, 0x65, 0x01, 0x91, 0x72, 0x8B, 0x3A, 0x8C, 0xF5, 0x01, 0xB4, 0x73, 0x54,
-    0x8E, 0xFB, 0xD3, 0xDE, 0x4D, 0xF9, 0x5F, 0x66, 0xE9, 0xCA, 0xEC, 0x92, 0x0E, 0xAF, 0x9A, 0x51,
-    0x01, 0xDB, 0x10, 0xD8, 0x64, 0x45, 0xBC, 0x34, 0xF6, 0x8B, 0x8E, 0x2A, 0x96, 0x41, 0x4C, 0x68,
-    0xD3, 0x51, 0xDD, 0x1E, 0xA2, 0x5D, 0xA7, 0xE0, 0x30, 0x12, 0x56, 0x04, 0x76, 0xF2, 0xF3, 0x59,
-    0xC5, 0x6C, 0x70, 0x48, 0x86, 0x4A, 0x3F, 0xE9, 0x53, 0xCC, 0xE6, 0x5C, 0x52, 0xC3, 0xA5, 0x74,
-    0x44, 0xCD, 0xA0, 0x9E, 0x92, 0xA4, 0x20, 0x1B, 0xA8, 0x96, 0x39, 0x80, 0x90, 0x29, 0x69, 0x03,
-    0x89, 0xDA, 0x9C, 0x87, 0x14, 0xD0, 0x26, 0x2C, 0x05, 0xA0, 0x23, 0x99, 0xC2, 0x42, 0xD3, 0xC5,
-    0xA4, 0xC0, 0xF3, 0x6B, 0x18, 0xF4, 0x7C, 0x00, 0x8E, 0x81, 0xE4, 0x0E, 0xB2, 0xD2, 0xBB, 0x01,
-    0x17, 0xDC, 0x41, 0x87, 0x43, 0xC2, 0xF8, 0x22, 0x90, 0x33, 0x1C, 0x93, 0x43, 0xFA, 0x00, 0x4F,
-    0x66, 0x6C, 0x7E, 0xC2, 0x4A, 0x9D, 0x05, 0xAF, 0x4C, 0x26, 0xCD, 0xBB, 0xB4, 0x0B, 0x3D, 0xEF,
-    0x39, 0x4B, 0x2D, 0xC8, 0x13, 0x9B, 0x84, 0x3D, 0xB8, 0x85, 0x57, 0x7E, 0xEF, 0xB9, 0x82, 0x82,
-    0x61, 0x78, 0xE8, 0x7B, 0x4B, 0x61, 0x25, 0xB3, 0xFA, 0x8C, 0xD1, 0x5A, 0xCE, 0xAB, 0x6F, 0xC8,
-    0xB4, 0x77, 0x2B, 0x0B, 0x60, 0x54, 0xD0, 0x25, 0xFC, 0x7E, 0x66, 0x03, 0x3C, 0xA3, 0xC1, 0x57,
-    0x37, 0xEF, 0x8E, 0x04, 0x48, 0x2B, 0xA7, 0x82, 0x3B, 0x0F, 0xAA, 0x5F, 0x3C, 0x8A, 0xD5, 0x45,
-    0x00, 0x9C, 0x0F, 0x53, 0xF5, 0x8E, 0x05, 0xA4, 0x49, 0xF8, 0xA7, 0x85, 0x8F, 0x29, 0x01, 0xB4,
-    0x31, 0x34, 0x28, 0x60, 0x8C, 0x38, 0x73, 0xC3, 0xA0, 0xE6, 0x3A, 0xFE, 0xC0, 0xC3, 0x9E, 0x4B,
-    0x55, 0x16, 0x9F, 0x32, 0x0B, 0x72, 0x6A, 0xCE, 0xFB, 0x1A, 0xDC, 0xE9, 0xE2, 0xDD, 0xBF, 0x78,
-    0x2A, 0x77, 0x21, 0x12, 0xA7, 0x8F, 0xB1, 0x12, 0x3A, 0x68, 0xB2, 0x23, 0x2D, 0x2D, 0x2A, 0x33,
-    0x8B, 0xC4, 0xD6, 0x8C, 0x6D, 0x70, 0xE4, 0xBF, 0x21, 0xCF, 0xC6, 0x78, 0x41, 0xE7, 0x4D, 0x03,
-    0x1F, 0x44, 0x60, 0x3A, 0xB4, 0x06, 0xE0, 0xAB, 0xFA, 0xBB, 0x40, 0x04, 0x04, 0xE0, 0x38, 0xA8,
-    0x09, 0x3E, 0xC0, 0x6B, 0xFD, 0xD5, 0x2C, 0x00, 0xFF, 0x7C, 0xAD, 0xBD, 0xEF, 0x3F, 0xD5, 0x2E,
-    0xFD, 0xA9, 0x9F, 0x86, 0x38, 0x9F, 0x07, 0x59, 0x03, 0xFB, 0x3B, 0xE4, 0xC2, 0xBE, 0xEC, 0x31,
-    0x2D, 0x28, 0x3D, 0xE0, 0x4E, 0x0C, 0x10, 0xA4, 0xE8, 0x77, 0x49, 0x95, 0x7F, 0xDF, 0x5E, 0x01,
-    0xFE, 0xA5, 0xE3, 0xE5, 0x25, 0xAD, 0x6E, 0x7F, 0x07, 0xD9, 0x14, 0xB3, 0xE7, 0xD2, 0xCD, 0xB2,
-    0x2D, 0xD0, 0x21, 0x0A, 0x18, 0x04, 0x7D, 0x27, 0x83, 0x1D, 0x12, 0x9D, 0x28, 0xA4, 0x9C, 0x57,
-    0xD9, 0x34, 0x32, 0x55, 0xBD, 0xCA, 0x0A, 0xDB, 0x3C, 0x6F, 0x5F, 0x49, 0x0E, 0x6C, 0xD4, 0x14,
-    0x41, 0x3B, 0xC9, 0xE8, 0x8E, 0xD4, 0x2F, 0xB7, 0x85, 0x30, 0x36, 0x40, 0x51, 0x80, 0x30, 0x2F,
-    0xA7, 0x9C, 0xE3, 0x80, 0xDF, 0x62, 0xDC, 0xA6, 0xDB, 0xC2, 0xE2, 0xD9, 0xB1, 0x09, 0x71, 0xB7,
-    0x95, 0x53, 0xCE, 0xEB, 0x55, 0x06, 0xD1, 0x51, 0xB2, 0x82, 0x45, 0x00, 0xF1, 0xD2, 0xE3, 0x91,
-    0x2A, 0xAA, 0xE8, 0xE2, 0xA4, 0xC2, 0xE8, 0xB9, 0x1A, 0x8A, 0x65, 0x61, 0xB6, 0xFD, 0x3F, 0x63,
-    0x8D, 0x8D, 0x15, 0x01, 0x8E, 0x79, 0x4F, 0x5A, 0x27, 0x46, 0xD3, 0xC8, 0x91, 0xC6, 0xCD, 0xD3,
-    0x8D, 0x8C, 0x43, 0x9B, 0x75, 0x7A, 0x11, 0x23, 0x0B, 0x4F, 0x51, 0x69, 0xED, 0xB8, 0xB9, 0xCE,
-    0xBA, 0xC4, 0x1B, 0x0D, 0x00, 0x8A, 0x08, 0x48, 0x15, 0x01, 0x26, 0x1C, 0x1E, 0xFA, 0x86, 0x0F,
-    0x41, 0x70, 0x0C, 0x2A, 0xFB, 0xFC, 0x34, 0x2E, 0x93, 0x1C, 0x97, 0xF9, 0x93, 0x33, 0xFE, 0x4B,
-    0xD9, 0xA9, 0xE9, 0x69, 0xCF, 0xEC, 0xEC, 0x84, 0xCD, 0x37, 0x52, 0x57, 0x14, 0xE3, 0xD8, 0xE4,
-    0x18, 0x88, 0xEE, 0xBC, 0xC2, 0x8D, 0x27, 0x65, 0x5A, 0xAE, 0x00, 0x3C, 0x6B, 0x3F, 0x3B, 0x16,
-    0x4C, 0xCB, 0xCE, 0xB1, 0x27, 0x55, 0xF6, 0x1E, 0x10, 0xFE, 0xBF, 0x48, 0xEF, 0xF6, 0xA7, 0x59,
-    0xD2, 0x75, 0xB7, 0xA4, 0x72, 0xB8, 0xA4, 0xAE, 0x43, 0x3C, 0x91, 0xBB, 0x99, 0xED, 0x4E, 0x66,
-    0x7A, 0x65, 0x5E, 0xD6, 0x97, 0x65, 0x01, 0x8C, 0xB2, 0x2C, 0xE1, 0xBE, 0x28, 0x24, 0x8B, 0xB5,
-    0xAB, 0xD7, 0x2D, 0xC3, 0x49, 0x93, 0x4C, 0x3F, 0x3D, 0x0C, 0x0C, 0x56, 0x84, 0x05, 0x6D, 0x26,
-    0x41, 0x9B, 0xAD, 0x50, 0x6C, 0x5B, 0xCB, 0x95, 0x9D, 0x97, 0x5A, 0x99, 0xC5, 0x7C, 0x3D, 0xFC,
-    0xC3, 0xF0, 0xA9, 0x5B, 0xC6, 0xEE, 0x2E, 0xE9, 0xC5, 0xF0, 0xF4, 0xBB, 0x99, 0x8D, 0x0B, 0x0D,
-    0xAE, 0x2B, 0x92, 0x09, 0xE0, 0xFB, 0x06, 0xC6, 0xC8, 0xB1, 0x02, 0x84, 0x8E, 0x5E, 0xF6, 0xB1,
-    0xD2, 0xF8, 0x2F, 0x09, 0xC2, 0xBD, 0xEC, 0x88, 0xEC, 0xA8, 0x6C, 0x49, 0xF2, 0x69, 0x39, 0x1F,
-    0xC8, 0xBC, 0x6F, 0x66, 0x20, 0xCB, 0xD3, 0x35, 0xCF, 0xCC, 0x23, 0x68, 0x56, 0xD7, 0x59, 0x40,
-    0x62, 0x89, 0xDE, 0xB8, 0x62, 0x7D, 0xDB, 0x71, 0xD4, 0x0C, 0xE3, 0xA6, 0xF4, 0x0F, 0xB1, 0x0B,
-    0x39, 0x7A, 0x63, 0xB5, 0x99, 0xD7, 0xE9, 0xC9, 0x48, 0xE6, 0xE3, 0xD5, 0x3D, 0x7C, 0x1A, 0x35,
-    0x36, 0x6C, 0xF9, 0xA8, 0x60, 0x61, 0x68, 0x41, 0xA6, 0x3E, 0x38, 0x9B, 0x34, 0xC5, 0x22, 0x3D,
-    0x08, 0x5C, 0xA5, 0x5F, 0xDF, 0xD9, 0x90, 0x1F, 0x15, 0xEA, 0x52, 0xBA, 0x90, 0x5C, 0xB5, 0x4D,
-    0x73, 0x01, 0x4B, 0xB2, 0x4A, 0xA5, 0xC3, 0x5D, 0x03, 0xA6, 0x14, 0xAA, 0x22, 0x01, 0x24, 0x29,
-    0xC4, 0x76, 0x00, 0xE5, 0x87, 0x10, 0x61, 0x9E, 0xA8, 0x6B, 0x27, 0x87, 0xA0, 0xA2, 0xBA, 0xCB,
-    0xB0, 0xD3, 0x32, 0x98, 0x5A, 0x16, 0x03, 0x40, 0x3F, 0x58, 0x17, 0xDC, 0x9F, 0x96, 0x1A, 0xDC,
-    0xC2, 0xE5, 0xCC, 0x59, 0xA9, 0x00, 0x51, 0xAF, 0x80, 0xA8, 0xB9, 0xE3, 0x10, 0x5C, 0xC8, 0x65,
-    0xC1, 0xCA, 0x91, 0x5A, 0xFC, 0xBF, 0x87, 0xF4, 0x78, 0xCB, 0x4C, 0x4F, 0x1F, 0x53, 0xD7, 0xAF,
-    0x9B, 0xB5, 0xCE, 0x6C, 0xBB, 0x32, 0x2B, 0xB2, 0x02, 0xFE, 0x9C, 0x93, 0xCD, 0x05, 0x56, 0xEF,
-    0xEC, 0x9E, 0xF7, 0xDE, 0xA0, 0x01, 0x61, 0x61, 0x0A, 0x83, 0x6F, 0x41, 0x78, 0x67, 0xAA, 0x40,
-    0xA4, 0xC5, 0x08, 0x54, 0x56, 0x0A, 0xA5, 0x8B, 0xA0, 0x55, 0x05, 0xC2, 0xA1, 0x0F, 0x85, 0x01,
-    0x65, 0x91, 0x85, 0xAC, 0xF5, 0x8D, 0x38, 0xF4, 0x0C, 0xF4, 0x9B, 0xB7, 0xF6, 0x45, 0xE6, 0xBD,
-    0xA3, 0xDE, 0x80, 0x22, 0x9D, 0x99, 0x97, 0xFF, 0xDB, 0xE4, 0xB8, 0x03, 0x01, 0xB7, 0x8C, 0x18,
-    0x59, 0x57, 0xC6, 0x2B, 0xE6, 0x24, 0x84, 0x98, 0xEE, 0xF8, 0xB9, 0x57, 0x40, 0xCE, 0xA6, 0x30,
-    0x2A, 0x7C, 0x19, 0xEB, 0x57, 0x3C, 0xB8, 0xCA, 0xDE, 0xEF, 0x39, 0x39, 0xE4, 0x52, 0xE2, 0xA6,
-    0x3C, 0xCE, 0x8A, 0x4C, 0x0E, 0x8F, 0x42, 0xDA, 0xD8, 0x75, 0x90, 0xD1, 0x1D, 0xEB, 0x57, 0x82,
-    0x48, 0xE2, 0x84, 0x43, 0xE2, 0xD2, 0xE0, 0xC4, 0xA5, 0xD4, 0x89, 0x4B, 0xAE, 0x13, 0x97, 0xD8,
-    0x27, 0x4F, 0xB9, 0x64, 0xFB, 0x69, 0xFA, 0x75, 0x72, 0xA9, 0x98, 0xC8, 0x4A, 0xBC, 0xA6, 0xEE,
-    0xF5, 0x7E, 0x3F, 0x0F, 0x60, 0xBE, 0x2C, 0x74, 0x64, 0x46, 0x19, 0xD6, 0x2A, 0xD7, 0x88, 0xD3,
-    0x48, 0xE3, 0x54, 0xBE, 0x0E, 0x3F, 0x13, 0xFF, 0x6D, 0x98, 0x03, 0xD6, 0xC0, 0xD3, 0xB1, 0x6D,
-    0x73, 0xF6, 0x20, 0x55, 0x37, 0x9B, 0x43, 0x6A, 0x75, 0x51, 0x8F, 0x4B, 0x8A, 0x9B, 0xAD, 0xED,
-    0xEF, 0x38, 0xE0, 0x28, 0xDB, 0xFA, 0x25, 0x55, 0x37, 0xE9, 0x9F, 0xDA, 0x91, 0x7C, 0x48, 0x39,
-    0x40, 0xF7, 0xE4, 0x2E, 0x0E, 0x2B, 0x98, 0xC9, 0xB8, 0x2A, 0x20, 0x63, 0x15, 0x0A, 0x27, 0x3B,
-    0xBA, 0xDD, 0x67, 0xBA, 0xB1, 0xD8, 0x3E, 0xD4, 0x69, 0x9F, 0xA9, 0x5C, 0x8E, 0xCE, 0xA9, 0xC7,
-    0x32, 0x9E, 0xFB, 0x23, 0xEB, 0xA5, 0xF0, 0x2A, 0xE4, 0x2B, 0x15, 0xF1, 0x8A, 0xDD, 0x25, 0x3F,
-    0xA3, 0x5E, 0xEA, 0x34, 0xF7, 0x12, 0xE3, 0x3D, 0x6A, 0xCC, 0xF2, 0xEA, 0xC4, 0x71, 0x09, 0x81,
-    0xAD, 0xA1, 0x5C, 0xA2, 0x9B, 0xBB, 0xAA, 0xC6, 0xA4, 0x56, 0xD0, 0x91, 0xB1, 0xA2, 0xF9, 0xE3,
-    0xD4, 0xD5, 0x5B, 0x65, 0xC4, 0xCA, 0xD8, 0xA4, 0x44, 0x03, 0x04, 0x0A, 0x8C, 0x9F, 0xB3, 0xD0,
-    0x83, 0xD4, 0xB9, 0x44, 0x4E, 0xCC, 0xE7, 0x9E, 0x4F, 0x9B, 0xE2, 0x49, 0x68, 0xF5, 0xA3, 0x78,
-    0xE2, 0x74, 0x71, 0x7E, 0xE7, 0xD8, 0x52, 0x30, 0x1D, 0x5C, 0x44, 0x5F, 0xDA, 0x24, 0x79, 0x9C,
-    0xFA, 0x65, 0x64, 0x31, 0xAE, 0x24, 0x18, 0xC2, 0x1E, 0xFA, 0xFA, 0x08, 0xAF, 0xDE, 0x70, 0x40,
-    0xFB, 0x24, 0xF1, 0x6B, 0xB4, 0xD6, 0x9B, 0x6F, 0x1A, 0xB7, 0x35, 0xE6, 0xEA, 0x0D, 0xEE, 0x35,
-    0x70, 0x65, 0x52, 0xE5, 0xEA, 0xA3, 0x81, 0x2B, 0xA3, 0xE2, 0x95, 0x55, 0x81, 0xBA, 0x66, 0x99,
-    0xA4, 0x6A, 0xC0, 0x4C, 0x61, 0xD5, 0x7B, 0x15, 0x0E, 0x3A, 0x8A, 0x6D, 0x73, 0x5D, 0x8F, 0x74,
-    0x15, 0x8D, 0x5A, 0x92, 0xDC, 0x71, 0xAF, 0xA7, 0xDC, 0xEB, 0xB1, 0xD6, 0x0C, 0x9D, 0xE8, 0x82,
-    0x09, 0xBF, 0xF2, 0x7F, 0x72, 0x79, 0xFF, 0x7D, 0x44, 0xCD, 0xF7, 0x61, 0x87, 0xBA, 0x68, 0x71,
-    0x28, 0x2E, 0x5B, 0x57, 0x41, 0x24, 0x4B, 0xB2, 0x35, 0x92, 0xE4, 0xDC, 0x73, 0xA6, 0xF7, 0xCC,
-    0xAD, 0xBB, 0x74, 0x21, 0x36, 0xF7, 0x79, 0x39, 0x31, 0x2E, 0xBF, 0x96, 0x6D, 0xF9, 0x95, 0x59,
-    0xD5, 0xD1, 0x41, 0x5B, 0x7E, 0xDD, 0x6B, 0x89, 0x81, 0x59, 0xD7, 0xEF, 0xF8, 0x60, 0x2A, 0x08,
-    0xC3, 0xCA, 0x1B, 0xDC, 0x76, 0x00, 0xBB, 0xE3, 0xF2, 0xF4, 0x9F, 0x99, 0xC8, 0x24, 0xB7, 0x41,
-    0xE6, 0x9F, 0x13, 0xF9, 0x35, 0x38, 0x59, 0xE8, 0xBC, 0x26, 0x61, 0x0A, 0x05, 0xA1, 0xF8, 0x14,
-    0xF2, 0x21, 0x0B, 0x99, 0xD8, 0x85, 0x99, 0xD4, 0x0F, 0x31, 0xCC, 0x7D, 0x57, 0xD5, 0x1C, 0xEF,
-    0xA0, 0xC4, 0x6E, 0x4F, 0x14, 0x7D, 0x93, 0xE5, 0xC3, 0x37, 0x99, 0xDD, 0x21, 0xF7, 0x8E, 0x2E,
-    0x8C, 0xC4, 0x2F, 0x61, 0x93, 0xC4, 0x6B, 0x4C, 0x50, 0xE8, 0xFA, 0xE4, 0x98, 0xC0, 0xDC, 0xA6,
-    0x81, 0xD7, 0xA2, 0xDC, 0x9E, 0xBC, 0x55, 0x78, 0x3F, 0x34, 0xEA, 0x35, 0x51, 0x7D, 0x82, 0xA8,
-    0x2E, 0x24, 0xB2, 0xB2, 0x50, 0x49, 0xE7, 0x9A, 0xAC, 0x27, 0xE9, 0x6E, 0x7C, 0x5D, 0xE4, 0xB3,
-    0x13, 0x93, 0x81, 0xD7, 0x36, 0xE0, 0xEB, 0x51, 0xAA, 0xFE, 0x0E, 0xFE, 0xF9, 0xF5, 0x62, 0x28,
-    0x7A, 0x0B, 0xA1, 0xF9, 0xD3, 0x37, 0x8C, 0xCC, 0x6D, 0xD9, 0x76, 0x65, 0x60, 0x16, 0x09, 0x5F,
-    0xC3, 0xBC, 0x86, 0xC8, 0xE1, 0xA2, 0xE8, 0x9C, 0xF1, 0xDF, 0xB7, 0x8D, 0x74, 0xBF, 0xAC, 0x87,
-    0x00, 0xD0, 0x5E, 0x4E, 0xAD, 0x37, 0x23, 0xBB, 0xDE, 0x3F, 0x2C, 0xC8, 0xE2, 0xAB, 0xA9, 0xDA,
-    0xCF, 0xE5, 0x8F, 0x4A, 0x37, 0x91, 0x9F, 0x54, 0x32, 0xFF, 0x37, 0x85, 0x7A, 0x2D, 0x4E, 0xD7,
-    0x19, 0xC8, 0x80, 0x36, 0x60, 0x45, 0x04, 0xBD, 0xF3, 0xED, 0x4F, 0x56, 0xDF, 0x4D, 0xA5, 0x8A,
-    0x3F, 0x5A, 0xDF, 0x3D, 0xC2, 0x25, 0x09, 0x00, 0xDE, 0x0D, 0xE9, 0x84, 0xEC, 0xBD, 0xBB, 0x21,
-    0xEF, 0x59, 0xEF, 0x27, 0xC6, 0x6F, 0x04, 0x10, 0x1C, 0x8C, 0x24, 0x1C, 0x88, 0x3E, 0x67, 0x22,
-    0x5D, 0xC4, 0x41, 0xD9, 0x55, 0x55, 0x02, 0x89, 0x09, 0x75, 0x8D, 0x58, 0x52, 0x96, 0x15, 0x52,
-    0x6E, 0x32, 0x72, 0x0B, 0xAB, 0xCF, 0xCE, 0xAE, 0xA6, 0xED, 0x08, 0x48, 0xD6, 0x14, 0x44, 0x6E,
-    0x7B, 0x8A, 0x43, 0x70, 0x1B, 0x58, 0xF1, 0x33, 0x00, 0x4D, 0x8B, 0xDF, 0x38, 0x06, 0xB7, 0x7F,
-    0x55, 0x79, 0x0E, 0x82, 0x7A, 0xD5, 0xDC, 0xEA, 0xDE, 0xBA, 0x7C, 0xCF, 0x32, 0x7B, 0x3C, 0x10,
-    0xBF, 0x62, 0x39, 0x3C, 0x80, 0x42, 0xE8, 0x89, 0x8E, 0xB3, 0x39, 0x6D, 0x16, 0x60, 0x7F, 0x57,
-    0x02, 0xEE, 0x8B, 0xC3, 0x61, 0x9D, 0xBA, 0x5A, 0xF0, 0x06, 0x6B, 0x3A, 0xC4, 0x5F, 0x0C, 0x62,
-    0x0B, 0xDF, 0x7E, 0x89, 0xB4, 0x4E, 0x23, 0x43, 0xE0, 0xC6, 0x18, 0x93, 0x3C, 0x10, 0x49, 0x4E,
-    0x36, 0xE1, 0x6E, 0x0E, 0xB7, 0xB1, 0x58, 0x98, 0x20, 0xA7, 0xA4, 0x1E, 0x7F, 0x0B, 0x6D, 0xE1,
-    0x50, 0x6B, 0xBC, 0x5B, 0x27, 0x6E, 0x6F, 0x1D, 0x49, 0x69, 0x87, 0x2A, 0x7B, 0x3E, 0xC8, 0xB4,
-    0xCB, 0x2A, 0xFC, 0xA2, 0xBB, 0xDD, 0x3A, 0x6B, 0xA3, 0x4C, 0xF8, 0x22, 0x12, 0xDE, 0xBE, 0xF7,
-    0x5E, 0xE6, 0x9C, 0x76, 0x42, 0xEB, 0xC0, 0x19, 0x26, 0xF8, 0x4C, 0xC8, 0x08, 0xF1, 0x66, 0x02,
-    0x60, 0x43, 0x27, 0xF5, 0x29, 0x67, 0xF1, 0x13, 0xB7, 0x55, 0xC5, 0xCA, 0x81, 0x0F, 0x71, 0x00,
-    0xF8, 0x43, 0xF8, 0x01, 0x4E, 0xBB, 0x6D, 0x0D, 0x97, 0x22, 0xA8, 0xB6, 0xF8, 0x15, 0x35, 0xAE,
-    0x04, 0xD4, 0xB8, 0x20, 0x56, 0xA5, 0x2B, 0xBF, 0xBA, 0xC2, 0x35, 0x37, 0xB2, 0x14, 0x8D, 0x3B,
-    0x6C, 0x2B, 0x87, 0x10, 0x14, 0x4D, 0x31, 0x2F, 0x2F, 0x9C, 0xC5, 0xD0, 0xC4, 0x55, 0x96, 0xC3,
-    0x14, 0x31, 0x86, 0x41, 0x8B, 0xDE, 0xDE, 0x77, 0x1B, 0xFF, 0x0E, 0x80, 0x59, 0x93, 0x83, 0xB9,
-    0x58, 0xC2, 0x8C, 0x5C, 0x82, 0x58, 0xBB, 0x82, 0x82, 0x53, 0x36, 0x1B, 0xF4, 0x81, 0xD0, 0xD5,
-    0x05, 0x2B, 0x96, 0xDD, 0x18, 0x48, 0xB9, 0xEF, 0x44, 0x6A, 0xB2, 0x9A, 0x06, 0xAC, 0xA2, 0x23,
-    0x3F, 0xE8, 0x5D, 0xDE, 0x80, 0xA2, 0x2C, 0xFC, 0x9C, 0x77, 0x2D, 0x44, 0x30, 0xBA, 0x7F, 0xC3,
-    0x02, 0x7A, 0x3B, 0xAC, 0x52, 0xEB, 0x33, 0x10, 0x36, 0x91, 0xDD, 0x40, 0x40, 0x8D, 0x8B, 0x3E,
-    0x9A, 0x79, 0xD2, 0xF2, 0x2A, 0x12, 0x09, 0xEB, 0xF2, 0x54, 0x74, 0xBF, 0x4C, 0x38, 0xB6, 0x1C,
-    0xA2, 0x01, 0x84, 0xBA, 0x02, 0x7A, 0x29, 0x1F, 0x9C, 0x0D, 0x0C, 0x64, 0xF1, 0xA2, 0xC4, 0x97,
-    0x37, 0x68, 0x2C, 0xC4, 0x3C, 0x00, 0x13, 0xD0, 0x11, 0x8A, 0x93, 0xA8, 0xF8, 0x0D, 0x71, 0x27,
-    0xF0, 0xA5, 0x7E, 0x50, 0x1C, 0x96, 0xBD, 0xC4, 0x15, 0x29, 0x9C, 0xC4, 0x11, 0x6A, 0x03, 0xEE,
-    0x9D, 0x20, 0xD7, 0xF7, 0xEE, 0xF6, 0x55, 0x1E, 0x64, 0xB3, 0x61, 0x86, 0xAC, 0x50, 0xA7, 0x48,
-    0xCE, 0x23, 0x44, 0xF4, 0xDE, 0xA2, 0xEC, 0x32, 0x23, 0x2F, 0xC3, 0x9C, 0x3B, 0x0C, 0x69, 0x57,
-    0xEA, 0xD1, 0x6C, 0x92, 0xC1, 0xC4, 0x54, 0x1B, 0x23, 0xFA, 0xC7, 0xE5, 0xFB, 0x85, 0x19, 0xF2,
-    0x4A, 0xCF, 0xB4, 0x87, 0x29, 0x4C, 0x88, 0x74, 0x6A, 0x7D, 0x76, 0x46, 0xF2, 0x63, 0xB3, 0x60,
-    0xF1, 0x0E, 0x64, 0xD1, 0x52, 0xE0, 0xD9, 0x4E, 0xF8, 0x15, 0xD3, 0x0D, 0x9B, 0xAF, 0xC1, 0xA9,
-    0x46, 0x61, 0xD3, 0x3C, 0xC8, 0xD7, 0x9F, 0xAA, 0xAC, 0xCE, 0x8B, 0xFA, 0xBF, 0x7F, 0xAC, 0xAC,
-    0x4E, 0xD8, 0xFA, 0x15, 0x4E, 0xEE, 0x0B, 0xF2, 0xF0, 0x26, 0xEB, 0xC7, 0x8B, 0x00, 0xDD, 0x87,
-    0x8B, 0x00, 0x5F, 0xA0, 0x6C, 0x1D, 0xB1, 0x20, 0x0F, 0xC9, 0xD5, 0xD4, 0x08, 0x85, 0xEA, 0x71,
-    0xB2, 0x16, 0x33, 0x7F, 0x4A, 0xD2, 0x68, 0xCC, 0xAF, 0xDD, 0xF1, 0x78, 0xFA, 0xED, 0x70, 0xC8,
-    0x8F, 0xFE, 0xB8, 0x94, 0x1E, 0xD8, 0x56, 0x39, 0xB2, 0x68, 0xE3, 0x84, 0xDF, 0xCE, 0xB8, 0x30,
-    0xD3, 0x54, 0x5F, 0xBE, 0xF6, 0x32, 0x71, 0xF2, 0x81, 0xEA, 0x42, 0xAB, 0x04, 0x59, 0x5D, 0x20,
-    0x87, 0xB9, 0x34, 0xCE, 0x71, 0x6F, 0x09, 0x18, 0xBC, 0x60, 0xA5, 0x1F, 0x9A, 0x30, 0x8F, 0xB2,
-    0x2D, 0x49, 0xB8, 0x4D, 0x03, 0x95, 0xF2, 0x21, 0xFC, 0x10, 0xC3, 0x24, 0x00, 0x31, 0xC9, 0x1F,
-    0xB5, 0xDD, 0x51, 0xB0, 0x8C, 0xDA, 0x5E, 0xF1, 0xAE, 0x5F, 0xBB, 0x0D, 0x80, 0x75, 0xC8, 0xDB,
-    0x0D, 0x68, 0x3B, 0x64, 0xD8, 0x58, 0xD0, 0x45, 0x59, 0xEE, 0xC8, 0xF2, 0x2E, 0x15, 0x47, 0x6C,
-    0xF8, 0x40, 0x3C, 0x11, 0x41, 0xFB, 0x6E, 0x66, 0x5D, 0xCC, 0xB0, 0xD2, 0xC6, 0xB7, 0x70, 0xB1,
-    0x3C, 0xC8, 0x75, 0x06, 0xE9, 0x88, 0xE9, 0x40, 0xA4, 0x7F, 0x00, 0x08, 0x64, 0xED, 0x18, 0x6B,
-    0xE3, 0xA1, 0xEB, 0x04, 0x81, 0x85, 0x24, 0x98, 0x50, 0xE3, 0xE2, 0x89, 0x5B, 0x72, 0xDA, 0xBA,
-    0x33, 0x0D, 0x22, 0xBF, 0x8F, 0x6F, 0xC6, 0x0A, 0xFA, 0x65, 0x6A, 0xC0, 0xF2, 0x1F, 0x92, 0x72,
-    0x61, 0xDF, 0xEC, 0xDC, 0xED, 0x21, 0xB3, 0x7B, 0x10, 0x2D, 0x77, 0x9D, 0x1F, 0x32, 0xE5, 0x78,
-    0x27, 0xF1, 0x28, 0x35, 0x0E, 0x1E, 0x5B, 0xE6, 0x0B, 0x10, 0x09, 0x14, 0x4E, 0xD9, 0xE8, 0x06,
-    0x28, 0xFA, 0x4D, 0xB7, 0xEC, 0x66, 0xBC, 0x25, 0xED, 0xF4, 0x5A, 0xEB, 0xCB, 0x9A, 0x5A, 0x4C,
-    0xBF, 0x41, 0xBB, 0xBF, 0x45, 0x3C, 0x2D, 0xA0, 0x7E, 0x75, 0x41, 0xF2, 0xB1, 0xC8, 0x31, 0x30,
-    0xC0, 0xE4, 0x86, 0x69, 0x25, 0xF5, 0x84, 0xB2, 0x3F, 0xD3, 0x46, 0x1B, 0x08, 0x73, 0x0D, 0xF2,
-    0xEB, 0xC5, 0x5C, 0x3A, 0xEB, 0x2E, 0x1D, 0x61, 0x8F, 0x43, 0xE7, 0xC9, 0xD1, 0xB2, 0x04, 0x8C,
-    0xD4, 0x28, 0xDD, 0x94, 0xE1, 0x8A, 0xE3, 0x2C, 0x31, 0x9F, 0xDB, 0x7E, 0x79, 0x0A, 0xB8, 0x30,
-    0x83, 0x01, 0xCE, 0xC2, 0x8B, 0xE6, 0xDD, 0xAE, 0xD2, 0x1E, 0x96, 0xD5, 0x62, 0x5D, 0xAD, 0xEC,
-    0x60, 0xE6, 0xAC, 0xEC, 0x15, 0xD0, 0xA9, 0xD0, 0x3B, 0xBE, 0x81, 0x9B, 0x13, 0x00, 0xDD, 0x4F,
-    0x7B, 0xD2, 0xC7, 0xA9, 0x1F, 0x3A, 0xF4, 0x65, 0x27, 0xB9, 0xA6, 0x11, 0x23, 0x9E, 0x39, 0xA9,
-    0xCC, 0x17, 0x55, 0x76, 0x2A, 0x90, 0x27, 0x43, 0x39, 0x3F, 0x23, 0x57, 0x40, 0xF0, 0x11, 0x1F,
-    0x68, 0xDD, 0xE5, 0x77, 0x8E, 0xA4, 0x3E, 0xD2, 0x2C, 0xE2, 0x48, 0x06, 0x3D, 0x34, 0xC3, 0x63,
-    0x48, 0x9E, 0x3D, 0x09, 0x31, 0x4D, 0xFF, 0xF8, 0x6E, 0x25, 0x83, 0x83, 0xCC, 0xB5, 0xAB, 0x5B,
-    0xD9, 0xB6, 0xD8, 0x9E, 0x0A, 0x5A, 0x2E, 0x44, 0xFD, 0x65, 0x9B, 0xBB, 0x75, 0xC8, 0xCE, 0xBF,
-    0xE6, 0xDF, 0x30, 0x9D, 0x25, 0x75, 0x21, 0x5D, 0x7B, 0x32, 0x54, 0xBE, 0x8D, 0x47, 0xF4, 0xF6,
-    0x79, 0xA7, 0x15, 0x24, 0xD8, 0xA1, 0x4A, 0x70, 0x7B, 0x30, 0x42, 0xA8, 0xEA, 0xCC, 0x60, 0xF2,
-    0xB9, 0xEC, 0x21, 0x37, 0x38, 0x03, 0x7C, 0x5E, 0x5F, 0xEA, 0x86, 0x17, 0x9F, 0xC9, 0xAF, 0xDD,
-    0xAB, 0x58, 0x51, 0x3E, 0x31, 0x1C, 0xCA, 0x49, 0x9D, 0x02, 0xC7, 0x64, 0x29, 0x71, 0x8A, 0xF4,
-    0x33, 0x72, 0xDA, 0x1C, 0xFB, 0xA2, 0x7F, 0x33, 0x5D, 0x3A, 0xFF, 0xF4, 0xD3, 0x5F, 0x42, 0x26,
-    0xED, 0x8F, 0x0A, 0x35, 0x2B, 0xBF, 0x6B, 0x3E, 0x8B, 0x9E, 0xBF, 0xE8, 0x06, 0x06, 0x99, 0xE6,
-    0xB7, 0x09, 0xE1, 0x38, 0x87, 0xFF, 0xE3, 0x15, 0xB4, 0xE5, 0x8D, 0x7C, 0xD3, 0x97, 0xB5, 0x65,
-    0xB4, 0x27, 0x3A, 0xCC, 0xD4, 0x4D, 0x88, 0xFA, 0x52, 0x86, 0xDC, 0xBA, 0x3A, 0xCC, 0x42, 0xDB,
-    0x75, 0x9B, 0xFF, 0x84, 0x59, 0xE8, 0x17, 0xE4, 0x5C, 0xC1, 0x2A, 0x92, 0x49, 0xBE, 0x0D, 0x54,
-    0x1B, 0xD4, 0xE9, 0x9A, 0xDC, 0x6B, 0xDE, 0x4D, 0xA3, 0xAB, 0xE3, 0x62, 0xD4, 0xD6, 0x6A, 0x8B,
-    0x59, 0x0E, 0x4F, 0xDC, 0xF1, 0x9E, 0x41, 0x7E, 0x24, 0x55, 0x64, 0x0E, 0xCA, 0xDE, 0x36, 0x19,
-    0x79, 0xC2, 0x79, 0xC9, 0xB4, 0x5F, 0xAB, 0x1F, 0xE6, 0x57, 0xE2, 0xDB, 0xC7, 0xD4, 0x01, 0x8B,
-    0x21, 0xE6, 0x03, 0x37, 0x09, 0x56, 0xC2, 0xEB, 0xBF, 0xC2, 0x8D, 0x29, 0xC4, 0xFC, 0x0A, 0x80,
-    0x7E, 0xD1, 0x6F, 0xEA, 0xE0, 0x27, 0xA5, 0x67, 0x7A, 0xF5, 0xCA, 0x92, 0x7F, 0xAF, 0x39, 0x90,
-    0xBB, 0xB8, 0x79, 0x00, 0xA4, 0xEB, 0x9E, 0x6D, 0x91, 0x8C, 0x94, 0xE6, 0x36, 0x4F, 0x93, 0x3B,
-    0x7F, 0x60, 0x1C, 0x04, 0x72, 0x03, 0xF5, 0x08, 0xCF, 0xEB, 0xB8, 0x1A, 0x6E, 0x7E, 0x98, 0xF3,
-    0x9E, 0x0C, 0x46, 0xC1, 0x1B, 0x59, 0xDE, 0xBB, 0x7D, 0x52, 0x5D, 0xE5, 0x51, 0x28, 0xF3, 0x63,
-    0xE7, 0x0D, 0x40, 0x20, 0x75, 0xF7, 0x2F, 0xF1, 0x14, 0x1E, 0x4A, 0xE9, 0x92, 0xEA, 0x93, 0x9C,
-    0x8A, 0x9A, 0x7C, 0xCD, 0xB8, 0xE3, 0x36, 0x62, 0xE7, 0x64, 0xB2, 0xD5, 0x36, 0xDE, 0x80, 0x7B,
-    0xC4, 0xD7, 0xBF, 0xCB, 0x59, 0x84, 0xF1, 0xD7, 0x0E, 0x8D, 0x12, 0xA6, 0x84, 0xD0, 0x84, 0x8F,
-    0x79, 0xF5, 0x23, 0x06, 0x38, 0x25, 0xAB, 0x5E, 0x0A, 0x4D, 0x9B, 0x4F, 0xB6, 0x05, 0xBA, 0xF1,
-    0x45, 0xC0, 0xE0, 0xFB, 0xEF, 0x11, 0x0D, 0x7A, 0x1B, 0x4E, 0x0E, 0x38, 0x79, 0xFF, 0xF0, 0xB6,
-    0x80, 0xFE, 0x39, 0xDB, 0x02, 0x8F, 0x41, 0xD2, 0xAC, 0x81, 0xA8, 0xE1, 0x9A, 0xDC, 0x36, 0x05,
-    0x96, 0xAA, 0x5B, 0x86, 0x65, 0x0B, 0xF9, 0x01, 0x10, 0x9B, 0x28, 0xD1, 0xF0, 0x98, 0x40, 0xAE,
-    0x0A, 0xA8, 0x41, 0x38, 0x28, 0xF2, 0x16, 0x04, 0x81, 0xA5, 0xF1, 0x1D, 0x7E, 0x03, 0x95, 0x21,
-    0x03, 0x1D, 0x30, 0x92, 0x83, 0xD2, 0xF4, 0x64, 0x47, 0x7D, 0x43, 0xFE, 0xA3, 0x09, 0xD6, 0xB0,
-    0x18, 0xFA, 0xB6, 0x7F, 0xA3, 0xE8, 0x84, 0x41, 0x7A, 0x7E, 0x27, 0x04, 0x09, 0x78, 0xFD, 0xF1,
-    0xB9, 0xA3, 0x4F, 0x7E, 0x64, 0xE0, 0x72, 0x2F, 0x4B, 0xEC, 0x35, 0x27, 0x81, 0xF5, 0x38, 0x3D,
-    0xE3, 0x1A, 0x9C, 0x6D, 0xB7, 0x0B, 0x46, 0x93, 0xED, 0x82, 0x53, 0xDC, 0x2E, 0xC8, 0x11, 0x2A,
-    0x05, 0x70, 0x2E, 0x54, 0x10, 0xA3, 0x96, 0xA1, 0xD8, 0xEE, 0x7C, 0xFE, 0x62, 0x07, 0x04, 0xEC,
-    0x27, 0x38, 0x20, 0x00, 0x70, 0xCF, 0x3C, 0xB7, 0x86, 0x03, 0x19, 0xB3, 0x74, 0x42, 0x97, 0x1F,
-    0xD0, 0xF4, 0x6D, 0x40, 0x7D, 0x44, 0x2C, 0x06, 0x1F, 0x11, 0x8B, 0x1A, 0x62, 0xB1, 0xE8, 0x7B,
-    0x6D, 0x7E, 0x3E, 0x48, 0x91, 0xDC, 0xC8, 0x2F, 0x3E, 0xD4, 0x4F, 0x75, 0x96, 0xC1, 0x6D, 0xF5,
-    0x3B, 0xBD, 0xD1, 0xEE, 0x62, 0xD1, 0xA1, 0x03, 0x3B, 0x3E, 0xED, 0xD7, 0x8E, 0x77, 0x9E, 0xE3,
-    0x5D, 0xF8, 0x79, 0xE2, 0xD6, 0xB6, 0x7B, 0xC3, 0x2E, 0x79, 0x83, 0x71, 0x3F, 0x2B, 0x47, 0xA1,
-    0x01, 0x6F, 0x20, 0x85, 0xB5, 0xC4, 0xD1, 0x65, 0xB7, 0xB3, 0x1C, 0x5E, 0x07, 0xBD, 0x76, 0xAF,
-    0xDA, 0xA0, 0x76, 0x92, 0x71, 0xBC, 0x9B, 0xE6, 0xB5, 0x65, 0xB2, 0x4E, 0xFB, 0xB4, 0xC3, 0x82,
-    0xCF, 0x78, 0x4F, 0xCB, 0xFF, 0xCC, 0x4E, 0xE5, 0x27, 0x9F, 0xD4, 0x27, 0xC3, 0x0B, 0x07, 0xF9,
-    0xB5, 0x1D, 0x7C, 0xBC, 0x88, 0xFB, 0x55, 0x9B, 0x70, 0xC9, 0x91, 0x2B, 0xE2, 0x5F, 0x91, 0x24,
-    0x27, 0x15, 0x02, 0x81, 0x6A, 0x44, 0x10, 0xCB, 0x56, 0xF1, 0x90, 0xFB, 0xE9, 0xAC, 0x21, 0x49,
-    0x70, 0x60, 0x12, 0x98, 0xA9, 0xA7, 0x3E, 0x04, 0x20, 0x8C, 0xA2, 0x6F, 0x67, 0xC1, 0xAD, 0xB2,
-    0xDA, 0x97, 0x58, 0x1F, 0xDC, 0xA2, 0x9C, 0xA8, 0x23, 0x13, 0xD8, 0x01, 0x32, 0xA9, 0xF8, 0xC5,
-    0xE6, 0x0C, 0x50, 0x22, 0xA8, 0xA2, 0x3C, 0xB0, 0xDA, 0x34, 0x69, 0x6C, 0xBE, 0xC4, 0x73, 0x38,
-    0xC2, 0xBC, 0x6D, 0x62, 0x88, 0x56, 0x2E, 0x3A, 0xEB, 0x8C, 0x8D, 0xE2, 0x6A, 0x06, 0xED, 0x69,
-    0x54, 0xE8, 0x5E, 0x55, 0x44, 0x19, 0xD2, 0x23, 0xAF, 0x52, 0x95, 0xB6, 0x73, 0xF6, 0x07, 0xE6,
-    0xA7, 0xAF, 0xFE, 0xA3, 0x7A, 0x6D, 0xA3, 0x9C, 0x4B, 0xDE, 0x36, 0xBB, 0x4D, 0xAC, 0x6E, 0x94,
-    0x55, 0x14, 0x5C, 0x28, 0xFA, 0x4E, 0xBA, 0x4F, 0x0E, 0xBD, 0x1A, 0x16, 0x3D, 0xBD, 0xCB, 0x0B,
-    0xDC, 0xCD, 0x36, 0x7B, 0x3A, 0xB5, 0x91, 0x5F, 0x2C, 0x2B, 0xB3, 0x11, 0x66, 0x87, 0x27, 0x7D,
-    0x14, 0x18, 0x1A, 0xF6, 0x58, 0x23, 0x74, 0x14, 0xF2, 0xB1, 0x43, 0x73, 0x87, 0xE7, 0xD4, 0x28,
-    0x48, 0x98, 0x78, 0xC1, 0xA4, 0x54, 0x65, 0x3C, 0xAA, 0x26, 0x1D, 0x56, 0x04, 0xF7, 0x5C, 0x2D,
-    0x83, 0x74, 0x92, 0xF3, 0x44, 0x88, 0xE1, 0x96, 0x25, 0x7D, 0x87, 0xF2, 0xDB, 0x1D, 0x58, 0x63,
-    0xB6, 0xE0, 0xF2, 0x87, 0x94, 0xC9, 0x86, 0x3B, 0x99, 0x92, 0x61, 0xB2, 0xF1, 0xB8, 0x72, 0xA8,
-    0x52, 0x64, 0xAA, 0x1D, 0xB2, 0x17, 0xFB, 0x7F, 0xE8, 0x08, 0x92, 0x5B, 0x86, 0xE1, 0x65, 0x7C,
-    0x02, 0xCF, 0xD9, 0x43, 0xEC, 0xCF, 0x39, 0xE1, 0x8D, 0xB5, 0x5F, 0x83, 0x02, 0x0B, 0xA9, 0x25,
-    0x2C, 0x13, 0xAB, 0x17, 0x1B, 0x77, 0x20, 0x17, 0x11, 0x7E, 0x80, 0xCE, 0x7F, 0xEC, 0x4A, 0x0E,
-    0x40, 0x2B, 0x0C, 0x86, 0x5A, 0xE5, 0x3A, 0x86, 0x3F, 0x75, 0xFA, 0xEC, 0xFF, 0x9F, 0x19, 0xC5,
-    0x88, 0x0F, 0x55, 0x40, 0x70, 0x6D, 0x21, 0x10, 0xA6, 0xD2, 0xB3, 0xFF, 0xEA, 0x89, 0x88, 0x03,
-    0x1B, 0x07, 0xEF, 0x55, 0x7B, 0x2E, 0x94, 0x63, 0x6F, 0x8B, 0xCE, 0xF2, 0xA1, 0xB3, 0x96, 0xBA,
-    0xE5, 0x1C, 0x28, 0xBC, 0xE8, 0xEE, 0x8F, 0x02, 0x48, 0x7C, 0x91, 0x8D, 0xC0, 0xDD, 0x0F, 0x3F,
-    0x75, 0x87, 0x92, 0x9D, 0xB2, 0x0F, 0x33, 0xF7, 0x5F, 0xBC, 0x3D, 0x70, 0xC9, 0x6D, 0x7B, 0x9C,
-    0x01, 0xD3, 0x78, 0xE7, 0x65, 0xC6, 0x76, 0x8F, 0x65, 0x42, 0x04, 0x2E, 0x77, 0xCD, 0x52, 0x39,
-    0x3C, 0x38, 0x71, 0x98, 0xDA, 0x9C, 0xF8, 0x91, 0x1E, 0x91, 0x7F, 0xCA, 0x93, 0xB2, 0x88, 0x70,
-    0x58, 0xF2, 0x90, 0xF0, 0xFE, 0x4A, 0xA1, 0x39, 0x24, 0xB8, 0x4F, 0x6F, 0xFB, 0xAC, 0x6F, 0x98,
-    0x3D, 0x6A, 0x67, 0x87, 0x6E, 0xD0, 0xA4, 0x8F, 0xB1, 0xED, 0x7B, 0x48, 0x1F, 0xEE, 0x31, 0x07,
-    0xAD, 0x7F, 0xFB, 0xDC, 0xB8, 0x7C, 0x77, 0x12, 0x9A, 0x7D, 0x1D, 0xD9, 0x2D, 0x73, 0xC8, 0x87,
-    0xDD, 0xED, 0x53, 0x1F, 0xE8, 0x73, 0xDB, 0x40, 0x62, 0xC8, 0xB8, 0x1E, 0xD5, 0xF4, 0xE8, 0x61,
-    0x27, 0x4A, 0x5D, 0xC2, 0x1F, 0x5E, 0xDE, 0xE1, 0xF9, 0xDB, 0x20, 0x7B, 0x36, 0x4D, 0x9A, 0xDA,
-    0xAB, 0x5F, 0x59, 0x61, 0x93, 0x5C, 0xF1, 0x7D, 0x79, 0x9C, 0xB2, 0x03, 0xF2, 0x42, 0x5C, 0xC2,
-    0xD5, 0xBB, 0x4D, 0x52, 0xE5, 0xA1, 0xE1, 0xC7, 0x29, 0x56, 0x59, 0xB1, 0x5B, 0x9F, 0x7A, 0x7E,
-    0x80, 0xC9, 0xDB, 0xC5, 0x95, 0x05, 0xCF, 0x04, 0xE9, 0x34, 0x92, 0x3E, 0x9E, 0x0A, 0x5D, 0x71,
-    0x65, 0x33, 0x6E, 0xF6, 0x43, 0xCF, 0x1C, 0x3F, 0x52, 0xB5, 0x0A, 0xC2, 0xC8, 0x94, 0x85, 0xA1,
-    0x92, 0x7F, 0xDA, 0x98, 0x96, 0x05, 0x95, 0x2E, 0xCA, 0x0B, 0xFB, 0x6E, 0xBB, 0xB0, 0x35, 0x25,
-    0x70, 0xB6, 0x0B, 0xBE, 0x89, 0x5E, 0x82, 0x7C, 0xCE, 0xAB, 0x47, 0xAB, 0x82, 0xE8, 0x4E, 0xCB,
-    0xEB, 0x3C, 0xD2, 0xE0, 0xB9, 0xFA, 0xA3, 0xAB, 0xEC, 0xAD, 0xCB, 0x13, 0xDB, 0x95, 0xD3, 0x4F,
-    0xE1, 0x9F, 0x85, 0x29, 0x07, 0x22, 0xA7, 0x98, 0x16, 0x93, 0x0E, 0xDC, 0xCE, 0xD4, 0xE7, 0x2E,
-    0xE3, 0x11, 0x1E, 0x07, 0x4D, 0xDD, 0x60, 0x82, 0x56, 0x9B, 0xFE, 0xAA, 0xE1, 0xF9, 0x95, 0xBB,
-    0xCF, 0x49, 0xEE, 0xE7, 0xD3, 0x40, 0x86, 0x3B, 0x03, 0x37, 0x3F, 0xBB, 0x29, 0xD7, 0x9C, 0xC6,
-    0x07, 0xBB, 0x13, 0x7D, 0xA2, 0xA7, 0xAC, 0x83, 0x1C, 0x87, 0x3C, 0x4F, 0xDC, 0x3F, 0xD2, 0xFF,
-    0xEF, 0xAA, 0x54, 0x02, 0x43, 0xC3, 0x55, 0xCC, 0x4F, 0xA2, 0x97, 0x58, 0xA7, 0x3D, 0xFB, 0xC4,
-    0xA3, 0x20, 0xEA, 0xA1, 0x53, 0x0B, 0xE6, 0x5F, 0x77, 0x6A, 0x61, 0x0A, 0xCB, 0xBA, 0x0C, 0x25,
-    0x60, 0x13, 0xD1, 0x37, 0x0E, 0x6B, 0xCE, 0xDE, 0x5F, 0xA5, 0xAE, 0x54, 0xB6, 0x42, 0x77, 0x98,
-    0x6B, 0x11, 0x16, 0xF6, 0x7D, 0xBE, 0x6A, 0x0B, 0x79, 0x94, 0x26, 0xA1, 0xB8, 0x5D, 0x26, 0xCF,
-    0xFA, 0x08, 0x82, 0xE8, 0x80, 0x07, 0xEB, 0xCC, 0xE1, 0x39, 0x4E, 0x21, 0xEA, 0x76, 0xD1, 0x2C,
-    0xEC, 0xFB, 0x00, 0x32, 0x10, 0xF1, 0x1E, 0xFF, 0x42, 0x9B, 0xAF, 0x04, 0xED, 0x59, 0x38, 0xEA,
-    0x78, 0x2A, 0xB3, 0x69, 0x91, 0xD3, 0x2C, 0xDD, 0x00, 0x5A, 0xB8, 0x6F, 0xB4, 0xFD, 0x0A, 0x0B,
-    0xF5, 0xEC, 0xBA, 0x3F, 0xAE, 0xD1, 0x6C, 0x31, 0xE7, 0x9E, 0xA4, 0xBB, 0x76, 0x4A, 0x15, 0xF1,
-    0x41, 0x1E, 0x37, 0x19, 0x77, 0x38, 0x79, 0x73, 0xED, 0x28, 0x70, 0x6F, 0x7C, 0x33, 0x42, 0xED,
-    0x6A, 0xEE, 0xA8, 0xD0, 0xDD, 0x8C, 0x0C, 0xF4, 0x2A, 0xE4, 0x7B, 0xEA, 0xB6, 0x43, 0x9F, 0x78,
-    0x9E, 0x1B, 0x30, 0x63, 0x61, 0xE8, 0x5F, 0x76, 0x75, 0x01, 0xE8, 0x03, 0xC8, 0x33, 0x78, 0x09,
-    0x4F, 0x8C, 0x66, 0x9A, 0xBF, 0x0D, 0xA0, 0xFB, 0x83, 0x03, 0xFC, 0xB6, 0xD5, 0x97, 0x4D, 0xF5,
-    0xB6, 0x85, 0x85, 0xA2, 0x4C, 0xDF, 0x40, 0x1E, 0xBB, 0x15, 0x9F, 0xB1, 0xFE, 0x07, 0x65, 0x64,
-    0xF4, 0x9B, 0x19, 0x58, 0xBF, 0x52, 0x25, 0xF2, 0xC8, 0xC8, 0x84, 0xA4, 0xB9, 0x24, 0x67, 0x26,
-    0x3B, 0xF5, 0xD5, 0xEF, 0xB4, 0x9A, 0xFF, 0xFE, 0x3E, 0x24, 0x90, 0x73, 0x1E, 0x1A, 0xC1, 0x86,
-    0xBB, 0x3C, 0xC6, 0xB1, 0x10, 0x3E, 0x23, 0x76, 0x77, 0x49, 0xFD, 0xFD, 0x4B, 0xF9, 0xDC, 0x1E,
-    0x32, 0x8A, 0xAC, 0xC3, 0x6D, 0x27, 0xE4, 0xA8, 0x29, 0xE3, 0x05, 0x24, 0x5E, 0x32, 0xAB, 0x61,
-    0xC0, 0xD0, 0x35, 0xDD, 0x41, 0x90, 0x4D, 0x2A, 0x91, 0x07, 0x4E, 0xC5, 0xC6, 0x48, 0x27, 0xDB,
-    0x53, 0xB1, 0xD7, 0xF0, 0xDB, 0xDD, 0xD2, 0x2B, 0xF5, 0x6B, 0x1F, 0x3B, 0x15, 0x5B, 0xFC, 0x9C,
-    0x53, 0xB1, 0x8F, 0x5E, 0xA2, 0x59, 0x70, 0xF1, 0x8E, 0x1A, 0x72, 0x77, 0x6C, 0xCE, 0x7F, 0x43,
-    0x76, 0x17, 0x3A, 0xEA, 0x46, 0x5E, 0xE8, 0xC5, 0x30, 0xFD, 0x7A, 0xD1, 0xE1, 0x81, 0x13, 0xA4,
-    0xC2, 0x59, 0xBB, 0x3F, 0xA6, 0x4F, 0xDB, 0x31, 0xEF, 0xB8, 0x2A, 0xA4, 0x9C, 0x7D, 0x22, 0x7D,
-    0xD0, 0x4D, 0x5B, 0x8E, 0xA3, 0xA1, 0xF5, 0xED, 0xB6, 0x74, 0xCB, 0x33, 0xA8, 0x4C, 0x30, 0x48,
-    0x1B, 0xED, 0x1F, 0x49, 0x94, 0xC4, 0xA4, 0x3E, 0xA1, 0xCF, 0xB1, 0x8F, 0xCE, 0xDA, 0xD2, 0x22,
-    0xF8, 0xA1, 0x22, 0x67, 0x25, 0xFF, 0xF4, 0x07, 0x6E, 0x3B, 0xA7, 0x66, 0x84, 0xB9, 0x8A, 0x37,
-    0x96, 0xD9, 0x1B, 0xDC, 0xDF, 0x1A, 0x01, 0xC7, 0x2B, 0xDB, 0x95, 0xAD, 0x30, 0x9F, 0x5A, 0x39,
-    0x9C, 0x42, 0x5C, 0xF0, 0x10, 0x89, 0xCA, 0xE7, 0x78, 0x5E, 0x0F, 0xA9, 0x20, 0x5C, 0x0C, 0x0A,
-    0x71, 0x81, 0x1C, 0xD4, 0xFD, 0xCF, 0xAC, 0x47, 0x72, 0x6B, 0xC1, 0x39, 0x93, 0x73, 0x75, 0x80,
-    0x60, 0x80, 0x76, 0x83, 0x3B, 0xE7, 0x72, 0x8C, 0xAC, 0xE2, 0x0E, 0x93, 0xCF, 0xFA, 0xD8, 0x68,
-    0xF5, 0xBB, 0x96, 0x05, 0x4C, 0xAC, 0xC4, 0x26, 0xCB, 0x89, 0x90, 0x81, 0xBD, 0xB4, 0xD7, 0xEE,
-    0x3F, 0x18, 0xEE, 0x83, 0x48, 0x38, 0x49, 0x21, 0x4E, 0x0C, 0x79, 0xE4, 0x0C, 0x0A, 0x5E, 0x78,
-    0x08, 0x45, 0xC2, 0xD3, 0x80, 0xA0, 0x45, 0x76, 0xEC, 0x17, 0x31, 0x0F, 0x11, 0xC3, 0xE0, 0x3C,
-    0x97, 0x4A, 0x40, 0x38, 0x8E, 0xFC, 0x82, 0xC4, 0xA9, 0xAF, 0x97, 0xC8, 0x14, 0x47, 0x8F, 0x46,
-    0x44, 0x39, 0x77, 0xBB, 0x3D, 0xD8, 0x55, 0x3F, 0x5B, 0x7A, 0x3C, 0x39, 0x83, 0xF6, 0x0D, 0x77,
-    0xBD, 0x92, 0xD5, 0xE7, 0x2B, 0xD6, 0x25, 0x31, 0x1E, 0x02, 0x98, 0x36, 0xD7, 0x24, 0xCA, 0xF1,
-    0x06, 0xF1, 0xDB, 0xBA, 0xA3, 0x58, 0x87, 0xE7, 0x4F, 0xDA, 0xC8, 0x0E, 0xDC, 0xFA, 0xEA, 0xEB,
-    0x1F, 0x83, 0xDE, 0x13, 0xAC, 0xC5, 0x50, 0xF3, 0xF2, 0x04, 0x2C, 0x06, 0x1E, 0x62, 0x6A, 0xDC,
-    0x18, 0xB7, 0x3C, 0x06, 0xCF, 0x2D, 0x36, 0xFA, 0xEF, 0xF8, 0x5C, 0x97, 0x48, 0x19, 0x91, 0xEE,
-    0x6D, 0xBB, 0xD0, 0x4F, 0x4C, 0x3D, 0x88, 0x96, 0xBF, 0xCC, 0xB3, 0x74, 0xE8, 0x66, 0x53, 0x9B,
-    0x24, 0xB0, 0xF7, 0x35, 0x4C, 0x3C, 0x92, 0x05, 0xD2, 0x01, 0x77, 0x9B, 0x52, 0xEF, 0xB7, 0x72,
-    0x16, 0x90, 0x58, 0x2D, 0xDD, 0x0C, 0x57, 0x6B, 0x6E, 0x8B, 0x4E, 0xF6, 0xC9, 0xBC, 0xDF, 0x7C,
-    0xB9, 0x3D, 0x13, 0xF7, 0xFF, 0xFA, 0x2B, 0x88, 0xAF, 0x7C, 0xB2, 0xBF, 0x82, 0x68, 0x3D, 0xB9,
-    0x96, 0x23, 0xDB, 0xAB, 0xFF, 0x56, 0xBB, 0xBF, 0xE0, 0xD0, 0x3E, 0xD6, 0x77, 0xE8, 0x00, 0x78,
-    0xEA, 0xF4, 0x8A, 0x3C, 0x7C, 0xF4, 0x96, 0xDF, 0xF7, 0xC7, 0x1F, 0x4D, 0x8E, 0xDE, 0x1E, 0xFC,
-    0x82, 0x47, 0x6F, 0x57, 0x8E, 0x0B, 0x0B, 0xAF, 0xAA, 0xD8, 0x7F, 0xA4, 0xBF, 0xFD, 0xB2, 0xE6,
-    0xE0, 0xA5, 0x1E, 0x4F, 0xE7, 0xD2, 0xD8, 0xB1, 0x1C, 0x4D, 0x8F, 0x7C, 0x64, 0xAF, 0x3C, 0xE0,
-    0x71, 0x07, 0xAE, 0x05, 0xE4, 0x59, 0xEA, 0x26, 0xE3, 0x54, 0xA7, 0x76, 0x67, 0x78, 0xCB, 0xF1,
-    0x66, 0x11, 0x5D, 0x29, 0x98, 0x94, 0x93, 0x5D, 0xA1, 0xD6, 0x9D, 0x9C, 0x86, 0x5C, 0x76, 0xBC,
-    0x39, 0x94, 0xB1, 0xB0, 0xF0, 0x73, 0x3C, 0xDF, 0x85, 0x77, 0x29, 0xEB, 0x95, 0xF2, 0xB3, 0xBE,
-    0x38, 0x33, 0x44, 0x20, 0x93, 0x53, 0x4D, 0xA9, 0x46, 0xAC, 0xA1, 0x46, 0xD8, 0x03, 0xD4, 0xF8,
-    0x4C, 0xE8, 0x83, 0x37, 0xB3, 0x49, 0xF9, 0xBA, 0x18, 0x67, 0x98, 0xEE, 0xE4, 0x88, 0x13, 0x8E,
-    0x14, 0x6B, 0x4C, 0x59, 0x22, 0x37, 0x30, 0x12, 0xD5, 0x77, 0xDA, 0xA8, 0xF2, 0x52, 0x55, 0x2C,
-    0x03, 0x71, 0xCC, 0xC3, 0x7A, 0x66, 0x4D, 0x96, 0x42, 0xA0, 0x3C, 0x4F, 0xE1, 0xB8, 0x92, 0x1A,
-    0x10, 0x67, 0x99, 0x88, 0xD3, 0x41, 0x16, 0xF3, 0xE3, 0x41, 0x16, 0x43, 0x00, 0x0E, 0x2E, 0x1D,
-    0x96, 0xD4, 0x18, 0x0B, 0x00, 0x74, 0xB3, 0x97, 0xA8, 0xB7, 0xAA, 0xF8, 0x37, 0xC6, 0xD8, 0xE5,
-    0xA5, 0x9F, 0x9F, 0xF6, 0xCC, 0x93, 0xA1, 0x67, 0x96, 0x8E, 0x7A, 0xF9, 0x92, 0x96, 0xBF, 0xAD,
-    0x64, 0x54, 0x70, 0x73, 0xC4, 0x9D, 0x01, 0xF9, 0x54, 0x7F, 0x84, 0xC2, 0x31, 0x5E, 0x69, 0xFF,
-    0xC0, 0xEF, 0x33, 0x93, 0x3F, 0x5A, 0xCC, 0x3B, 0xEE, 0x40, 0xC0, 0xB8, 0xD9, 0xC3, 0xFD, 0xD5,
-    0x5C, 0xFC, 0xB4, 0xBD, 0xC9, 0xD9, 0x29, 0x3A, 0x43, 0x97, 0x22, 0x72, 0x78, 0x2B, 0x1F, 0xF7,
-    0x7D, 0x71, 0xA7, 0x2A, 0x58, 0x84, 0x65, 0x29, 0x49, 0x1B, 0x6E, 0x10, 0x17, 0x21, 0x4F, 0x93,
-    0x31, 0x13, 0xEB, 0x7B, 0x1F, 0xA4, 0x18, 0xD8, 0xA0, 0xE6, 0x01, 0x5F, 0x6E, 0xAD, 0x23, 0x3D,
-    0x07, 0x9D, 0x66, 0xA1, 0x0C, 0x99, 0xF2, 0xEE, 0x8B, 0x65, 0x51, 0x18, 0xB9, 0x6B, 0x64, 0x60,
-    0x99, 0xD0, 0x02, 0x1E, 0xD5, 0x04, 0xD5, 0xBD, 0xF4, 0x38, 0xFF, 0xBA, 0x4A, 0x08, 0x05, 0xE3,
-    0xAD, 0xF2, 0x07, 0x0B, 0x34, 0x72, 0x1C, 0x83, 0xD3, 0x80, 0x04, 0x05, 0xFE, 0xF2, 0x38, 0x95,
-    0x9D, 0xA8, 0xC9, 0x3A, 0x61, 0xD6, 0x99, 0x53, 0x79, 0x10, 0xA6, 0xD6, 0xBF, 0x89, 0x0C, 0xB0,
-    0xB0, 0x51, 0x63, 0xF7, 0x00, 0xCA, 0x0B, 0xE3, 0x10, 0x4E, 0x41, 0x72, 0x9C, 0xAC, 0x71, 0x47,
-    0x13, 0xF1, 0x8F, 0xE5, 0xB3, 0xA1, 0xFB, 0xAB, 0x3B, 0xB7, 0x37, 0xC4, 0x5D, 0x4B, 0xB7, 0x69,
-    0xD7, 0xC2, 0x74, 0x7B, 0x7A, 0xDC, 0x95, 0xF3, 0x9C, 0xE0, 0xF9, 0xD8, 0xE9, 0xF1, 0xD2, 0x9D,
-    0x1E, 0x7F, 0x1C, 0x2F, 0xF1, 0xC8, 0x19, 0xD5, 0x4C, 0x4E, 0x9F, 0x1F, 0xB9, 0xCF, 0x82, 0x69,
-    0x38, 0xAE, 0x09, 0x5F, 0xCF, 0x65, 0x61, 0xED, 0xA3, 0x35, 0xE1, 0x6E, 0x5B, 0x13, 0xD6, 0xE9,
-    0x26, 0xF3, 0x63, 0x6A, 0xA3, 0xE3, 0xF2, 0x2F, 0x75, 0x54, 0x3D, 0x6C, 0x1C, 0x45, 0x14, 0xFE,
-    0x66, 0x26, 0xF6, 0x1A, 0x2F, 0xF6, 0xB8, 0x48, 0x85, 0x12, 0x6F, 0x24, 0x10, 0xB2, 0x90, 0xF1,
-    0x22, 0xE4, 0xC2, 0xC5, 0x5D, 0x76, 0x8D, 0x0B, 0xE8, 0xE2, 0x48, 0x20, 0x5A, 0x0A, 0x3A, 0x9A,
-    0x14, 0x46, 0x5C, 0xE1, 0xD8, 0x2B, 0xA4, 0x88, 0x22, 0x05, 0x2E, 0xE8, 0x68, 0x2C, 0x94, 0x82,
-    0x82, 0x22, 0x08, 0x4B, 0x80, 0x84, 0xED, 0x21, 0x96, 0xA0, 0xA0, 0x59, 0x81, 0xA8, 0x28, 0xB2,
-    0x11, 0x1D, 0x08, 0x69, 0x41, 0x2B, 0x58, 0x4B, 0x7B, 0x37, 0x7C, 0x6F, 0xF7, 0xCE, 0x71, 0x12,
-    0x65, 0x74, 0xF3, 0x73, 0x3B, 0x6F, 0xDE, 0x7C, 0xEF, 0x7D, 0xDF, 0x1B, 0x20, 0xF4, 0x23, 0xEF,
-    0x73, 0x9C, 0xCD, 0x40, 0xEC, 0x7D, 0x93, 0x78, 0x5F, 0x73, 0x19, 0x78, 0x3F, 0x3A, 0xF6, 0xDE,
-    0xC9, 0x67, 0x44, 0x9E, 0xED, 0x37, 0x19, 0xCA, 0x27, 0xFE, 0x3F, 0x83, 0x3D, 0xE5, 0x9E, 0xC5,
-    0xB2, 0x76, 0x26, 0x5B, 0xC3, 0xAA, 0x49, 0x03, 0xDC, 0xC0, 0xFE, 0x2C, 0xE6, 0x90, 0x2B, 0x77,
-    0x69, 0xF2, 0xFD, 0x15, 0x83, 0x10, 0x77, 0x51, 0xCC, 0x4F, 0xBE, 0x2F, 0xE9, 0xCC, 0xA4, 0xAB,
-    0xAD, 0x37, 0x43, 0x3F, 0x0F, 0xCE, 0x7C, 0xB3, 0x59, 0xFE, 0xB9, 0xED, 0xC7, 0x97, 0xEF, 0x62,
-    0xA8, 0x1A, 0x53, 0x06, 0x85, 0xCD, 0x4D, 0x15, 0xBB, 0x61, 0x50, 0x24, 0xAA, 0x86, 0x2C, 0x1B,
-    0x2E, 0x75, 0x7D, 0xDE, 0x60, 0x37, 0x72, 0xC9, 0xB5, 0x3C, 0xFA, 0xA9, 0xB0, 0x27, 0x65, 0xF0,
-    0xA0, 0x36, 0x55, 0xC3, 0x5F, 0xF8, 0x4F, 0x6D, 0x7F, 0x29, 0xA3, 0x8F, 0x8A, 0xC4, 0xBA, 0x9D,
-    0x38, 0x3B, 0x7F, 0x92, 0xE6, 0x1F, 0x8B, 0x6D, 0xF8, 0x73, 0x65, 0xCA, 0x46, 0x57, 0x87, 0x30,
-    0x0E, 0x26, 0x43, 0x90, 0x12, 0x2D, 0x2C, 0x30, 0x0F, 0x5C, 0x06, 0x96, 0x31, 0x7B, 0xF4, 0x45,
-    0xE2, 0x1B, 0x6C, 0x81, 0x31, 0x80, 0x38, 0x0B, 0xA8, 0x1C, 0xDA, 0x3D, 0xCD, 0x1C, 0x97, 0x80,
-    0x0B, 0xE3, 0x60, 0xF8, 0x8F, 0x56, 0x58, 0x83, 0x98, 0xC9, 0x71, 0xDA, 0xF1, 0xBC, 0x18, 0xBE,
-    0xF7, 0xC7, 0x5E, 0xEC, 0x87, 0xE2, 0x41, 0x3C, 0xD3, 0x85, 0xB8, 0xA6, 0x0F, 0x45, 0xFB, 0x95,
-    0x42, 0xF9, 0x11, 0x5E, 0xFA, 0x86, 0xC7, 0xF0, 0xD8, 0x31, 0xD9, 0x9E, 0x19, 0x7B, 0x8F, 0x7C,
-    0x6E, 0xE8, 0x62, 0xD7, 0x3B, 0xEB, 0x1B, 0xC5, 0x94, 0x11, 0x26, 0xA9, 0xCB, 0x48, 0x22, 0x49,
-    0x7A, 0xCD, 0xFB, 0x8A, 0x7C, 0x86, 0x6D, 0x6E, 0x57, 0x75, 0x6D, 0x9B, 0x24, 0x13, 0xA2, 0xA7,
-    0xAE, 0xEE, 0x1C, 0xB5, 0x1D, 0x17, 0xB1, 0x59, 0xAB, 0x32, 0xFC, 0xB1, 0xB0, 0x2E, 0x89, 0xB3,
-    0x5D, 0x26, 0xA5, 0xDF, 0x13, 0x4A, 0x30, 0x95, 0x9A, 0x74, 0xE6, 0x8A, 0xC9, 0xF4, 0x1B, 0x3A,
-    0x53, 0xB7, 0x18, 0xEA, 0x07, 0xBC, 0xD6, 0xAE, 0xCB, 0xE9, 0xBC, 0x43, 0x22, 0x60, 0x05, 0x18,
-    0x0E, 0xD8, 0xDF, 0xBF, 0x9E, 0x62, 0x70, 0x6B, 0x01, 0xBD, 0xB7, 0x3E, 0x41, 0xEF, 0xC5, 0x57,
-    0xD1, 0x0B, 0x6E, 0x77, 0x19, 0x78, 0x84, 0xB3, 0xC7, 0xB9, 0x10, 0x83, 0xFD, 0x39, 0xBD, 0x91,
-    0x0F, 0x22, 0xAB, 0xDD, 0xC1, 0xD6, 0xBC, 0xB9, 0x97, 0xDD, 0x98, 0xEB, 0x22, 0x5B, 0xEA, 0x2D,
-    0xCF, 0xCD, 0x72, 0x0E, 0x03, 0x73, 0xAF, 0xD8, 0xEA, 0xCD, 0x87, 0xCA, 0xE5, 0xDD, 0xCE, 0xFE,
-    0xD2, 0xB4, 0x71, 0xE5, 0x4A, 0xA8, 0xF3, 0xDE, 0x9C, 0xC9, 0xEE, 0x2E, 0x05, 0xE8, 0x36, 0x16,
-    0xB0, 0x8D, 0xAF, 0x5D, 0xB9, 0xCD, 0x8B, 0xF3, 0x45, 0x93, 0x6F, 0x8B, 0x26, 0x82, 0x3C, 0x64,
-    0xAE, 0x16, 0x98, 0x7E, 0x0B, 0x5D, 0xD0, 0xA0, 0x8F, 0x46, 0x97, 0x3A, 0x47, 0x7B, 0xF7, 0x14,
-    0xFB, 0xF4, 0x1E, 0xFA, 0xCF, 0x31, 0xBD, 0x4E, 0xFF, 0x5B, 0x01, 0x49, 0x6A, 0x7D, 0x2B, 0xBA,
-    0x40, 0xA2, 0x1B, 0xE1, 0x88, 0xA3, 0x6A, 0xAC, 0x84, 0x6B, 0x4E, 0x87, 0x32, 0xFE, 0xC9, 0x52,
-    0xD9, 0x44, 0x74, 0xAD, 0x41, 0xE8, 0x70, 0x98, 0xE4, 0x48, 0xA0, 0xDE, 0xF6, 0x4E, 0x35, 0xC0,
-    0xB1, 0x17, 0xAF, 0xF6, 0x54, 0x3C, 0xC0, 0x6F, 0x8C, 0x84, 0x9F, 0x2A, 0xE0, 0x86, 0xF6, 0xB0,
-    0x9C, 0x92, 0x12, 0xC7, 0x15, 0x2B, 0x8B, 0xBF, 0x56, 0xEB, 0x49, 0x0B, 0x5B, 0xD5, 0x63, 0xF4,
-    0x4C, 0x32, 0x49, 0x1E, 0x80, 0xE8, 0x38, 0x6F, 0x0B, 0x5E, 0x9B, 0x9E, 0x9F, 0x4B, 0xD8, 0xAC,
-    0xCB, 0x6A, 0x94, 0x61, 0x88, 0xA0, 0x42, 0x22, 0x25, 0xB2, 0x0F, 0x2C, 0x52, 0x26, 0xA7, 0x74,
-    0x5B, 0xA9, 0xFF, 0xEE, 0xBB, 0x0B, 0x83, 0x3E, 0xC2, 0x8D, 0x1C, 0x65, 0x0F, 0x36, 0x70, 0xAA,
-    0xAC, 0xB0, 0x92, 0xC0, 0xDC, 0x77, 0xD8, 0x2D, 0x11, 0x12, 0x06, 0xC3, 0xA0, 0x1F, 0xC5, 0x68,
-    0x63, 0xC6, 0x53, 0xB4, 0xB7, 0xCF, 0x12, 0x39, 0xB7, 0x62, 0xEA, 0x99, 0x70, 0x92, 0x0C, 0xA1,
-    0x4C, 0xBE, 0xEA, 0x8A, 0x70, 0x15, 0x27, 0xD9, 0x20, 0x1E, 0x61, 0xA7, 0x23, 0x40, 0xD1, 0xF8,
-    0xD7, 0x77, 0x80, 0x6F, 0x99, 0x3D, 0x9A, 0x7D, 0x76, 0x05, 0xD4, 0x11, 0x5E, 0x80, 0x9B, 0xF9,
-    0xE1, 0xAB, 0x77, 0xE3, 0xBD, 0x9B, 0xD8, 0x99, 0xFE, 0x6B, 0xFE, 0xD3, 0xE7, 0x2F, 0xEA, 0x33,
-    0x99, 0x42, 0x4B, 0xEA, 0x78, 0x4C, 0x4B, 0x77, 0x5D, 0x17, 0x1D, 0xAB, 0x89, 0x98, 0x26, 0x82,
-    0x3A, 0x2F, 0x2A, 0x16, 0x05, 0xD3, 0x01, 0xF4, 0xC6, 0x7D, 0xD2, 0xA6, 0x3F, 0xC7, 0xEC, 0x1D,
-    0x91, 0x7E, 0x4C, 0xD9, 0xAF, 0x37, 0x2B, 0xEB, 0xB5, 0xA2, 0x34, 0x11, 0xF1, 0x8A, 0x1C, 0x01,
-    0xBD, 0x56, 0x50, 0xA5, 0x64, 0x10, 0x44, 0xD7, 0x6F, 0x17, 0x71, 0xBB, 0xE0, 0x78, 0x55, 0xC8,
-    0x25, 0xAD, 0xCA, 0x43, 0x8F, 0x24, 0x17, 0x6A, 0xD8, 0x12, 0x71, 0xC8, 0xA4, 0xA6, 0xB2, 0x20,
-    0xAB, 0xD6, 0x49, 0x5A, 0x82, 0x1C, 0x8F, 0xB4, 0xA8, 0x3D, 0xCC, 0x3D, 0xDA, 0x05, 0xA4, 0x24,
-    0x87, 0x7A, 0x13, 0x6A, 0x73, 0x82, 0x69, 0x94, 0x92, 0x66, 0xFA, 0x1A, 0x98, 0x72, 0x99, 0x70,
-    0x36, 0x04, 0x06, 0x8B, 0xDE, 0x86, 0xFC, 0x5E, 0x08, 0x1A, 0x9E, 0xB7, 0x1F, 0xD2, 0x6D, 0xD1,
-    0x87, 0xAE, 0x03, 0x67, 0x86, 0xF8, 0x8E, 0xF7, 0xD9, 0x2C, 0x28, 0x08, 0xF6, 0x90, 0xD8, 0xAC,
-    0xE3, 0xAD, 0x77, 0x26, 0x0F, 0xC7, 0x26, 0x75, 0x11, 0x53, 0x8F, 0xA6, 0x20, 0xCF, 0x47, 0xF0,
-    0x0F, 0x81, 0x84, 0xC3, 0xB6, 0xF0, 0x99, 0x31, 0x9B, 0x12, 0xF6, 0x97, 0xC2, 0xE6, 0x9A, 0xA8,
-    0xE4, 0xB2, 0x44, 0xDE, 0x4A, 0x87, 0x2F, 0x4E, 0x1F, 0xAA, 0x90, 0x78, 0x2A, 0x19, 0x7A, 0x38,
-    0x66, 0xF4, 0x6A, 0x24, 0xCC, 0x0F, 0x25, 0x4D, 0xFC, 0xA6, 0x4B, 0xAA, 0x08, 0x75, 0xC8, 0x30,
-    0x6F, 0xEA, 0x3D, 0x46, 0xD0, 0x79, 0x27, 0x93, 0x61, 0x2E, 0xA9, 0x2C, 0x19, 0xAA, 0x6E, 0xA4,
-    0x0E, 0x3C, 0x9E, 0x6C, 0x42, 0x60, 0xC7, 0x5E, 0x4B, 0x19, 0xDF, 0x7C, 0xB4, 0x8F, 0x5C, 0xFB,
-    0xE0, 0xB5, 0xAF, 0x18, 0xFA, 0xF2, 0xA2, 0x45, 0xAF, 0xF3, 0x12, 0x7B, 0x22, 0x54, 0x5F, 0x7F,
-    0x68, 0x2D, 0xEC, 0x76, 0x94, 0xBE, 0x2C, 0xC3, 0x62, 0xFB, 0xEA, 0xCB, 0x10, 0x48, 0x05, 0x99,
-    0xEF, 0xF9, 0x52, 0xEA, 0xDF, 0x45, 0x12, 0x7F, 0x4B, 0x71, 0x1C, 0x0C, 0x27, 0xD6, 0xFD, 0x31,
-    0x11, 0x12, 0xBA, 0x58, 0x0B, 0x08, 0x23, 0x6E, 0x75, 0x71, 0xE6, 0x7B, 0xBF, 0xAB, 0x26, 0x69,
-    0xFF, 0x03, 0x4D, 0x90, 0xA1, 0x4E, 0x43, 0x31, 0x14, 0x86, 0xFF, 0xB6, 0x64, 0x77, 0xDB, 0xED,
-    0xB8, 0x08, 0x48, 0xB6, 0x64, 0xEC, 0x12, 0x32, 0xD1, 0x10, 0x60, 0x57, 0x54, 0x4C, 0x0C, 0x56,
-    0xE0, 0x05, 0x66, 0x08, 0x16, 0x81, 0x00, 0x77, 0x25, 0x62, 0xA2, 0x41, 0x91, 0x80, 0xE0, 0x01,
-    0x10, 0x13, 0x08, 0x70, 0x13, 0x13, 0x88, 0x85, 0x34, 0x24, 0xF8, 0x3E, 0xC2, 0x4D, 0x78, 0x81,
-    0x2B, 0x26, 0x26, 0xC6, 0x46, 0x57, 0x20, 0xE1, 0xE4, 0x53, 0xDF, 0x39, 0xE7, 0x3F, 0x69, 0xE9,
-    0x79, 0xA9, 0xC8, 0x6F, 0x6B, 0x17, 0xCD, 0x44, 0x0C, 0x5B, 0xB6, 0xAC, 0x00, 0x4E, 0xCD, 0xE3,
-    0xF6, 0xDD, 0xD7, 0x99, 0x4A, 0x43, 0x00, 0xEC, 0xB9, 0x04, 0x8E, 0x28, 0x43, 0x82, 0x61, 0xD7,
-    0xD6, 0x40, 0xC6, 0x05, 0xAC, 0x0E, 0x36, 0xA5, 0x68, 0x8A, 0x34, 0xB6, 0x04, 0x08, 0xE6, 0xB0,
-    0x75, 0xA6, 0xD2, 0x55, 0x6A, 0xDA, 0x20, 0x97, 0x05, 0x5E, 0x10, 0x2C, 0xE3, 0x89, 0x94, 0x6D,
-    0xD7, 0xA7, 0xA3, 0x12, 0x77, 0xB5, 0x1B, 0x4E, 0x21, 0x37, 0x86, 0x5D, 0x8D, 0xAD, 0x2B, 0x84,
-    0x8B, 0x09, 0xE6, 0x81, 0x89, 0x54, 0x87, 0xE6, 0xCC, 0x1C, 0xA0, 0xCF, 0x4C, 0xA4, 0xC7, 0x98,
-    0x44, 0x26, 0xC6, 0x94, 0xE6, 0x2D, 0xD5, 0x65, 0x39, 0xCB, 0xB0, 0x0E, 0x91, 0x94, 0xE9, 0xD1,
-    0x47, 0x53, 0x7C, 0x9E, 0xDC, 0xA7, 0x32, 0x0A, 0x6E, 0xEC, 0xE1, 0x8C, 0x2D, 0x54, 0xAC, 0x01,
-    0xD5, 0xA7, 0x5A, 0x32, 0x9C, 0x57, 0xC2, 0xD9, 0xA9, 0x2A, 0x64, 0x5B, 0x03, 0xAA, 0x2B, 0xC8,
-    0x1A, 0x34, 0x8B, 0x27, 0xA7, 0x8A, 0x3E, 0xA0, 0x47, 0xD4, 0x4A, 0x60, 0x89, 0x29, 0xC7, 0x79,
-    0x0D, 0x58, 0x23, 0xA6, 0x41, 0x9E, 0xEA, 0x76, 0x61, 0x76, 0x91, 0x01, 0x3B, 0x5A, 0x07, 0x03,
-    0x3C, 0xB0, 0xE3, 0x71, 0xAC, 0xE9, 0xB4, 0x49, 0x5E, 0x22, 0x9E, 0x24, 0xEF, 0x37, 0x33, 0xA2,
-    0xDE, 0x74, 0x9D, 0xBA, 0x87, 0x10, 0xD3, 0x0E, 0xDC, 0x3F, 0xA0, 0x47, 0xAB, 0xBC, 0x58, 0x91,
-    0x81, 0x15, 0x49, 0x3A, 0x6C, 0xB9, 0xB3, 0x64, 0x50, 0x12, 0xBC, 0x5A, 0x15, 0x55, 0x19, 0xE5,
-    0x48, 0xBB, 0x66, 0xC3, 0x0D, 0x6D, 0x02, 0xD7, 0x40, 0x0E, 0x66, 0x10, 0x6A, 0x44, 0x40, 0xE7,
-    0x57, 0x90, 0x6C, 0xE9, 0x96, 0x5A, 0x2D, 0xB5, 0xA3, 0xE1, 0xA7, 0xF7, 0x3C, 0x9D, 0x3F, 0x0E,
-    0x3C, 0xCE, 0xEC, 0x03, 0xB1, 0xC7, 0x95, 0xF4, 0xC6, 0xAD, 0xB8, 0x75, 0x97, 0x83, 0x91, 0x1F,
-    0xFD, 0x51, 0x2E, 0xCE, 0x59, 0x6A, 0x7D, 0x23, 0xF7, 0x8C, 0xFC, 0xC9, 0xEB, 0x7F, 0xA9, 0x3F,
-    0xF4, 0x3D, 0xAF, 0xC0, 0x14, 0x98, 0xB8, 0xD8, 0x6F, 0x5D, 0x54, 0x3D, 0x6C, 0x1C, 0x45, 0x14,
-    0xFE, 0x76, 0x26, 0xCE, 0x08, 0x56, 0xF6, 0xA4, 0x40, 0x91, 0x40, 0xB6, 0xB7, 0xA1, 0x8A, 0xEC,
-    0x1C, 0x85, 0x0B, 0x17, 0x67, 0xEF, 0x4A, 0x14, 0x69, 0x29, 0xB0, 0x28, 0xD2, 0x23, 0x22, 0x8A,
-    0xB8, 0x70, 0xE1, 0xC2, 0xCE, 0xAD, 0x82, 0x04, 0x05, 0x05, 0xEE, 0x29, 0xE2, 0x22, 0x14, 0x11,
-    0x85, 0xAF, 0xA0, 0xA0, 0x70, 0x7C, 0xE3, 0xB8, 0x44, 0x42, 0x2B, 0xA5, 0x43, 0xA0, 0xAC, 0x90,
-    0x12, 0x21, 0x37, 0x0C, 0xCA, 0x41, 0xCE, 0xD6, 0xDE, 0x0E, 0xDF, 0x9B, 0x3B, 0x5B, 0x86, 0x95,
-    0xE6, 0x69, 0x7E, 0x76, 0xDE, 0x7C, 0xEF, 0xFB, 0xDE, 0x7B, 0xC0, 0xE4, 0x5B, 0x98, 0xA3, 0xE9,
-    0x2E, 0xD1, 0x6C, 0x6D, 0xD3, 0x78, 0x0F, 0xA8, 0x40, 0x93, 0x89, 0x09, 0xDF, 0xEE, 0x43, 0xB7,
-    0x16, 0xB0, 0xCD, 0x02, 0x90, 0x6F, 0x77, 0x81, 0xDD, 0xFE, 0x0F, 0x40, 0x53, 0x7B, 0x24, 0x6F,
-    0x9E, 0x39, 0xE8, 0x37, 0x5F, 0x94, 0xD0, 0x21, 0x05, 0xCC, 0x78, 0x4E, 0xCC, 0xD2, 0x35, 0x98,
-    0xD0, 0x1E, 0xD2, 0x84, 0x11, 0x0F, 0xC2, 0x50, 0x8C, 0x47, 0x7A, 0x10, 0xF6, 0x61, 0xE9, 0x08,
-    0x4B, 0x74, 0x84, 0x55, 0x3A, 0x42, 0x7F, 0x0B, 0xFF, 0xFD, 0xEE, 0x8F, 0x80, 0x5E, 0x70, 0xE8,
-    0xBC, 0xFC, 0x0C, 0xB6, 0x06, 0xF4, 0x90, 0x9B, 0x63, 0x8E, 0xAC, 0xE4, 0x82, 0x70, 0xB0, 0x8B,
-    0x4F, 0x4B, 0xEB, 0x6C, 0x83, 0x06, 0x43, 0x64, 0xD5, 0x02, 0x92, 0xA0, 0x8F, 0x09, 0xF5, 0xC8,
-    0x27, 0x21, 0xB4, 0xB0, 0x21, 0x54, 0xF4, 0xD0, 0x00, 0x83, 0xB6, 0xFC, 0x9F, 0xF3, 0x64, 0x50,
-    0x10, 0xD4, 0x08, 0xA6, 0x36, 0x50, 0x95, 0x44, 0x2A, 0x71, 0x73, 0xE4, 0x84, 0xD7, 0xE1, 0x01,
-    0xFA, 0x82, 0x8E, 0x43, 0x9C, 0xC8, 0x26, 0xE4, 0xF9, 0x1D, 0xDE, 0x24, 0x04, 0x73, 0x26, 0xB4,
-    0xF0, 0xAF, 0x10, 0x02, 0x77, 0x3E, 0x42, 0x07, 0x49, 0x03, 0x5B, 0x22, 0xC0, 0xF0, 0xEF, 0x4A,
-    0x79, 0x64, 0x23, 0x8C, 0x60, 0x5B, 0x62, 0xD4, 0x7F, 0xBA, 0x0E, 0xD4, 0x3F, 0xDE, 0x3A, 0x34,
-    0x4F, 0x4D, 0x45, 0x2A, 0x42, 0x78, 0x2E, 0xC6, 0xDB, 0xAA, 0xD9, 0x85, 0xF1, 0x1D, 0x1E, 0x37,
-    0xE6, 0x85, 0x43, 0x9B, 0x84, 0x1A, 0xBD, 0x22, 0x1F, 0xA2, 0x23, 0x51, 0x59, 0xAF, 0x5A, 0xBE,
-    0x99, 0x72, 0x33, 0xA2, 0xB0, 0xF2, 0x8C, 0x87, 0x67, 0x5C, 0xA1, 0xBE, 0xFB, 0xF2, 0x93, 0x21,
-    0x76, 0x92, 0xA7, 0x3C, 0x0E, 0x65, 0x3C, 0xCE, 0x4E, 0x0B, 0x28, 0x09, 0x23, 0xE7, 0x30, 0xBC,
-    0x83, 0x23, 0x0E, 0xCB, 0xE0, 0x88, 0x0D, 0x74, 0x49, 0xD6, 0x46, 0x12, 0x7B, 0x2E, 0x67, 0xE8,
-    0xC9, 0x26, 0xF6, 0x17, 0xC5, 0x56, 0xA2, 0x3A, 0x9C, 0xD8, 0xC4, 0xDD, 0xA6, 0x55, 0xEE, 0x10,
-    0xE9, 0x48, 0x33, 0xC2, 0xDB, 0x8F, 0x35, 0xDF, 0xFF, 0x80, 0x64, 0x39, 0x6C, 0x22, 0x7D, 0xE5,
-    0xB1, 0x0D, 0x5B, 0x78, 0xE4, 0x85, 0xD8, 0xB4, 0xCE, 0x84, 0x39, 0xDF, 0x21, 0xAE, 0xC2, 0xAF,
-    0x2B, 0xAF, 0x42, 0xBD, 0xAE, 0xBD, 0x09, 0xD5, 0xAE, 0xE6, 0xBC, 0x40, 0x05, 0x5D, 0x52, 0xE2,
-    0x95, 0xA4, 0x42, 0x0A, 0x4E, 0x3C, 0x27, 0x73, 0x58, 0x30, 0xCA, 0x65, 0x8C, 0xE2, 0x84, 0x63,
-    0x98, 0x3C, 0x1F, 0x6D, 0x61, 0xB9, 0xF7, 0x0D, 0xD4, 0x4F, 0x3B, 0x35, 0x96, 0x5F, 0xFF, 0x06,
-    0xD5, 0xE6, 0x94, 0xFD, 0xA4, 0x21, 0x2D, 0x79, 0x89, 0xCE, 0x87, 0x9E, 0x71, 0x75, 0x80, 0x75,
-    0x45, 0xE0, 0xF7, 0x0A, 0xD1, 0xA4, 0xC5, 0x35, 0xB4, 0x07, 0x6E, 0x31, 0xF1, 0xAA, 0x5E, 0xA6,
-    0x7E, 0xBE, 0xAB, 0x1D, 0xEA, 0xAE, 0x3E, 0x2E, 0xEB, 0x6D, 0xF3, 0xF0, 0xB8, 0xEA, 0x5B, 0xFD,
-    0xCC, 0x79, 0xAB, 0x1F, 0x1E, 0xD7, 0x8B, 0xA6, 0x50, 0xD5, 0xB2, 0x29, 0xB4, 0xEB, 0x9A, 0xD2,
-    0xB8, 0xAE, 0xFE, 0xFB, 0x7E, 0xF9, 0x3E, 0x09, 0xA3, 0x9F, 0xEB, 0x03, 0x09, 0x95, 0x93, 0x79,
-    0xE0, 0xD6, 0x79, 0x81, 0x30, 0x96, 0x69, 0x72, 0xD8, 0x67, 0x06, 0x94, 0x49, 0xB5, 0x8B, 0x59,
-    0x06, 0xD7, 0x37, 0xA5, 0x2E, 0xD7, 0x60, 0x49, 0x6D, 0x4E, 0x0E, 0x7A, 0x14, 0xFC, 0xDE, 0x3B,
-    0x4C, 0xB2, 0x40, 0x1F, 0xCD, 0x34, 0x9B, 0xC8, 0xA5, 0xE2, 0x22, 0x25, 0xBE, 0x8C, 0xEE, 0xD6,
-    0x45, 0xB4, 0x06, 0x6F, 0x1D, 0x3D, 0x06, 0x58, 0x1E, 0x37, 0x45, 0xD5, 0xF3, 0x3D, 0x24, 0x3C,
-    0x96, 0x10, 0x44, 0x24, 0x35, 0x92, 0x0C, 0xE2, 0x7B, 0xE2, 0xE3, 0xBD, 0x28, 0x0B, 0x66, 0x36,
-    0x36, 0x36, 0xD2, 0x29, 0x2B, 0x35, 0xE9, 0xA5, 0x8A, 0xD4, 0x4C, 0xFD, 0xC5, 0x09, 0xE5, 0x4D,
-    0x06, 0x7B, 0x2C, 0x1E, 0xAE, 0x1F, 0xFD, 0x42, 0x21, 0x09, 0x3F, 0xE5, 0xED, 0x8C, 0xB7, 0x67,
-    0x7A, 0xA2, 0x6E, 0x39, 0x91, 0x5A, 0xEA, 0x22, 0xCA, 0x3D, 0x49, 0x1B, 0x2D, 0x71, 0x92, 0x24,
-    0x2F, 0x80, 0xA9, 0xE6, 0x1A, 0x32, 0xA8, 0x83, 0xD3, 0x83, 0xD3, 0x22, 0x75, 0x99, 0x93, 0xE3,
-    0x69, 0x6E, 0xA1, 0xF7, 0x44, 0xBC, 0xC8, 0x45, 0xE6, 0xE9, 0x34, 0x7F, 0x54, 0xC4, 0x35, 0x8E,
-    0x11, 0x62, 0x9A, 0x42, 0xB1, 0x14, 0xE3, 0x77, 0x43, 0x1E, 0x91, 0x89, 0x6C, 0xCC, 0x72, 0x7C,
-    0x1E, 0xCB, 0xAD, 0x45, 0xE7, 0x95, 0xBB, 0x61, 0x86, 0xAB, 0xBC, 0xA9, 0x0B, 0x02, 0xDB, 0x24,
-    0x28, 0xFE, 0xF7, 0x80, 0xFF, 0xA5, 0x92, 0x68, 0x0D, 0xC2, 0x77, 0x96, 0xF2, 0xD7, 0x8D, 0x72,
-    0x67, 0x99, 0x5B, 0xCD, 0x92, 0x56, 0xDF, 0xA9, 0x99, 0xD4, 0x63, 0x29, 0x27, 0xA7, 0x85, 0xD6,
-    0xEB, 0xE1, 0x0F, 0x49, 0x4B, 0x44, 0x69, 0x90, 0x94, 0xB1, 0x62, 0xCF, 0xE4, 0x75, 0xE1, 0x0C,
-    0xB7, 0xBE, 0x8F, 0x21, 0xC6, 0x26, 0x10, 0x49, 0x8A, 0x49, 0x2F, 0xDC, 0x05, 0x8A, 0x24, 0x81,
-    0x5E, 0xF9, 0x06, 0xDC, 0x68, 0x62, 0xD5, 0xD5, 0x79, 0xBC, 0x10, 0xAA, 0x44, 0xBA, 0x94, 0xD4,
-    0x8D, 0x89, 0x05, 0x9C, 0xCA, 0xDB, 0x52, 0xD0, 0x7B, 0x57, 0xEF, 0xE9, 0x98, 0x0C, 0x63, 0x0C,
-    0x86, 0xF6, 0x57, 0xEC, 0xF4, 0xF5, 0x49, 0x99, 0xCD, 0xE2, 0xC7, 0x4D, 0xFD, 0xBB, 0xB3, 0x3F,
-    0xA3, 0x73, 0x8E, 0x9C, 0x91, 0x8E, 0xB0, 0x32, 0xF9, 0x59, 0x1C, 0xB9, 0xCB, 0xAB, 0x42, 0x36,
-    0x26, 0x38, 0xD6, 0x04, 0xBA, 0xBF, 0xA0, 0x55, 0x56, 0xEA, 0x72, 0xF5, 0x40, 0x56, 0xC3, 0x8B,
-    0x55, 0xEF, 0x82, 0xF1, 0xCB, 0x15, 0x92, 0x8D, 0x0D, 0xB6, 0x4F, 0x48, 0x2B, 0xC5, 0xCC, 0xDD,
-    0x8F, 0x33, 0x3A, 0x5C, 0xC6, 0xCD, 0x11, 0x7A, 0x0E, 0x83, 0x2A, 0xBA, 0xF5, 0x62, 0xE9, 0x43,
-    0x0F, 0x27, 0xFD, 0x11, 0x78, 0x37, 0xAA, 0xC2, 0x4A, 0x40, 0xA8, 0x93, 0xB0, 0xA7, 0xC7, 0x48,
-    0x1E, 0xBD, 0x4D, 0x7C, 0x05, 0xF3, 0xC5, 0x0E, 0xF5, 0x97, 0x3B, 0xC6, 0x2D, 0xA6, 0x2E, 0x0D,
-    0x85, 0x3E, 0x9B, 0xA2, 0xDD, 0x94, 0x3E, 0x30, 0xD1, 0x51, 0x72, 0x4A, 0x32, 0x3C, 0xBC, 0x28,
-    0xD4, 0xEB, 0xAF, 0x0B, 0x7D, 0x72, 0xA7, 0x30, 0x5F, 0x19, 0xA4, 0x69, 0x0A, 0x3B, 0x37, 0x87,
-    0xB9, 0xD9, 0x59, 0x2C, 0xCC, 0xCF, 0x63, 0x69, 0xA9, 0x8B, 0xEE, 0xEA, 0x2A, 0xBA, 0x2B, 0xD2,
-    0xB4, 0x07, 0x6D, 0x31, 0x49, 0x34, 0x69, 0x50, 0x6C, 0x91, 0x5D, 0xE8, 0x9A, 0xC0, 0x6C, 0x91,
-    0x96, 0xD2, 0xA1, 0x94, 0x30, 0x1F, 0x29, 0xCE, 0xC3, 0x93, 0x2B, 0xE1, 0xF7, 0x78, 0x45, 0xC5,
-    0x1A, 0x92, 0xC4, 0x8D, 0x5D, 0x4B, 0x35, 0x17, 0x09, 0xF6, 0x2F, 0x2D, 0x52, 0x31, 0x6F, 0xD3,
-    0x40, 0x14, 0xFE, 0x6C, 0x97, 0x38, 0xC1, 0x4E, 0x9C, 0xA9, 0x8A, 0xD4, 0x16, 0x2F, 0x1D, 0x32,
-    0x84, 0xDA, 0x43, 0x86, 0x48, 0xA4, 0x8D, 0x51, 0x25, 0x18, 0x22, 0xFE, 0x43, 0x07, 0x36, 0x16,
-    0x0F, 0x1D, 0x40, 0x6A, 0x88, 0x45, 0x06, 0x86, 0x0A, 0x29, 0x43, 0x7F, 0x40, 0x24, 0x7E, 0x00,
-    0x1E, 0x3A, 0x74, 0x08, 0xE2, 0x94, 0xFC, 0x01, 0x57, 0x8C, 0x65, 0xF0, 0xD0, 0x85, 0xCD, 0xA2,
-    0x95, 0x48, 0x85, 0x93, 0xE3, 0x3B, 0xBB, 0x67, 0x9F, 0xEE, 0xEE, 0xBD, 0xEF, 0xBE, 0x77, 0xDF,
-    0x7B, 0x0F, 0xFB, 0xC0, 0x2E, 0xD0, 0x00, 0x1C, 0xC0, 0xC2, 0xCE, 0xE4, 0x95, 0x9C, 0xC8, 0x5B,
-    0xFD, 0x01, 0x18, 0x01, 0x46, 0x0A, 0x1C, 0x71, 0x11, 0x40, 0x13, 0xE5, 0xE8, 0x00, 0x6E, 0x06,
-    0xEB, 0x9F, 0x30, 0x6F, 0x5C, 0x3D, 0xCD, 0xAE, 0xBA, 0x0D, 0x3D, 0xD0, 0x92, 0xC2, 0xAE, 0x60,
-    0x5D, 0xC0, 0x24, 0x2A, 0xE6, 0xAC, 0x01, 0x1A, 0x2D, 0x7D, 0x3A, 0xA2, 0x07, 0x84, 0x3B, 0x9B,
-    0x21, 0x2A, 0x32, 0x45, 0x65, 0x0D, 0x78, 0xC5, 0x4F, 0xE6, 0x67, 0xC4, 0xA0, 0x20, 0x37, 0x02,
-    0xA0, 0x07, 0xE8, 0xBC, 0xB1, 0x47, 0x4B, 0x8A, 0xA6, 0x03, 0x23, 0x89, 0x3B, 0xD6, 0xE7, 0x61,
-    0xE4, 0x7E, 0xC8, 0xE0, 0xE5, 0xC0, 0x98, 0x8E, 0xE4, 0xF1, 0x1D, 0x75, 0xC0, 0x86, 0x1E, 0x01,
-    0x21, 0x3F, 0x46, 0xA8, 0x57, 0xFE, 0xDE, 0xD6, 0x8D, 0x9B, 0x55, 0x65, 0x13, 0x8F, 0xA7, 0xD0,
-    0x7E, 0x9C, 0xD3, 0x85, 0x2B, 0xF2, 0xE3, 0x00, 0x67, 0x54, 0x16, 0x80, 0x86, 0x69, 0x71, 0x29,
-    0xC7, 0x60, 0x6E, 0x7E, 0x79, 0x1F, 0x87, 0x21, 0xEF, 0x93, 0xC7, 0x57, 0xEF, 0x7C, 0x5A, 0xBC,
-    0x62, 0xA6, 0xB6, 0x46, 0xC1, 0xDE, 0x06, 0x01, 0x97, 0xCB, 0xE8, 0xC5, 0x1C, 0x9E, 0x50, 0x29,
-    0xE2, 0xD8, 0x4E, 0xDF, 0x6D, 0xA6, 0x9B, 0x00, 0x32, 0xC2, 0x9F, 0x15, 0x62, 0x2F, 0x88, 0xCD,
-    0x2C, 0xC6, 0xE8, 0x04, 0x5B, 0xE6, 0x05, 0xF0, 0x8D, 0x1E, 0x8B, 0xB9, 0xC9, 0xE1, 0x9E, 0x63,
-    0x70, 0x2C, 0xBE, 0x23, 0x5B, 0xA1, 0xDF, 0x54, 0xD4, 0xD0, 0x03, 0x26, 0x42, 0x4B, 0xAA, 0x0E,
-    0xC4, 0xE9, 0xAE, 0xB1, 0x88, 0xF6, 0xBA, 0xB8, 0x83, 0x19, 0xBF, 0x3D, 0x72, 0x64, 0xF2, 0x64,
-    0x5E, 0x90, 0x33, 0x6C, 0xA7, 0x8A, 0xB4, 0x6B, 0x61, 0xD6, 0xD3, 0x16, 0xC2, 0x68, 0xA0, 0x1E,
-    0xC3, 0x8B, 0x30, 0xDA, 0x86, 0xCC, 0x8D, 0xDF, 0x45, 0xA2, 0x54, 0x8A, 0x8D, 0x48, 0x15, 0xAA,
-    0x4C, 0xD3, 0x40, 0xCA, 0xEC, 0x92, 0xEB, 0x21, 0xA7, 0x25, 0x65, 0xAE, 0x65, 0xDC, 0x50, 0x6E,
-    0xF1, 0xDE, 0x2D, 0xC5, 0xFA, 0x52, 0x55, 0x63, 0x06, 0xAC, 0x08, 0x59, 0xBB, 0x42, 0xBB, 0xB3,
-    0xFA, 0x5A, 0xB6, 0x1C, 0x7E, 0x4A, 0x67, 0xE2, 0x7E, 0xDA, 0x0D, 0xAB, 0xB0, 0xDB, 0x2C, 0x19,
-    0xF5, 0xEA, 0x13, 0x22, 0xAF, 0xC9, 0xEF, 0x13, 0xDD, 0x62, 0x1D, 0x6B, 0xB6, 0xBA, 0xAF, 0x05,
-    0x65, 0x44, 0x15, 0x59, 0xD5, 0x19, 0x99, 0x27, 0xE5, 0x8A, 0xEB, 0x73, 0x95, 0xDF, 0xB1, 0x94,
-    0xB4, 0xB9, 0x8F, 0x41, 0xE3, 0xB2, 0x34, 0x53, 0xC2, 0xDB, 0x7E, 0xC9, 0x8A, 0x05, 0x0F, 0xFB,
-    0xAC, 0x50, 0x45, 0x1D, 0x96, 0x11, 0x02, 0x3F, 0x44, 0xBF, 0x66, 0x5B, 0xC6, 0xF5, 0xE4, 0xB5,
-    0x38, 0xF0, 0xBF, 0x0A, 0x7D, 0xED, 0x26, 0x70, 0x27, 0xA4, 0xC9, 0xD8, 0x6D, 0x76, 0xD9, 0x67,
-    0x4A, 0x6B, 0x84, 0x4C, 0x51, 0xF6, 0x94, 0xD2, 0xA2, 0xBB, 0x94, 0xE0, 0x53, 0x47, 0x72, 0xB0,
-    0x9A, 0x84, 0xDF, 0x13, 0x77, 0x4F, 0xD5, 0x6C, 0xAA, 0x33, 0xD5, 0xAA, 0xA6, 0x50, 0xFD, 0x1A,
-    0xB2, 0x77, 0x28, 0x5D, 0xF1, 0xB4, 0xD8, 0xD4, 0x09, 0x9C, 0x8F, 0x81, 0xF5, 0x66, 0x6D, 0x2D,
-    0x2D, 0x2B, 0x13, 0xE6, 0x2F, 0x1F, 0xC7, 0xD4, 0xB5, 0xA4, 0x4C, 0x01, 0xDB, 0x87, 0x51, 0x1C,
-    0x5C, 0x5F, 0xE8, 0xB9, 0x0F, 0xCF, 0x6E, 0xE9, 0x3F, 0xC7, 0xC1, 0xE1, 0x1A, 0x06, 0xB9, 0x4F,
-    0xF0, 0x1F, 0x4D, 0x52, 0xB1, 0x6E, 0x13, 0x41, 0x10, 0x7D, 0x7B, 0x4B, 0xBC, 0xC5, 0x11, 0x2E,
-    0x4D, 0x52, 0xC4, 0x91, 0x8F, 0x82, 0x02, 0x84, 0x6C, 0xFF, 0xC0, 0xC5, 0xB7, 0x9F, 0xE0, 0x02,
-    0x53, 0xA4, 0xA1, 0x49, 0x0F, 0x05, 0x85, 0x91, 0x82, 0x7D, 0x88, 0x92, 0xC6, 0x15, 0x35, 0x0D,
-    0x0D, 0x0D, 0x29, 0x22, 0x91, 0xC2, 0xD1, 0x1D, 0x15, 0xED, 0x36, 0xF4, 0x27, 0x91, 0x2A, 0x14,
-    0x9C, 0xD0, 0x15, 0x26, 0x9C, 0x3D, 0xCC, 0xDC, 0xC5, 0x31, 0x2B, 0xCD, 0xD3, 0x68, 0x76, 0x66,
-    0xF6, 0xBD, 0x99, 0x05, 0x14, 0x80, 0x20, 0x03, 0x7C, 0x0B, 0x1C, 0xB0, 0x7F, 0x0A, 0xE8, 0x44,
-    0x1D, 0x1F, 0x60, 0xBA, 0x28, 0x8C, 0xFB, 0x62, 0x23, 0x54, 0x5E, 0xAE, 0x5D, 0x80, 0x00, 0x11,
-    0xC6, 0x28, 0x4D, 0xA6, 0x57, 0x4B, 0x18, 0x72, 0x30, 0x0B, 0xDC, 0x9E, 0xF4, 0x32, 0x62, 0x20,
-    0x02, 0xE2, 0x59, 0xDF, 0x21, 0xC8, 0xB1, 0x84, 0x2E, 0x31, 0xCD, 0x31, 0x41, 0x67, 0xC0, 0x0F,
-    0x98, 0xB7, 0x39, 0x4A, 0x95, 0x1F, 0xA2, 0x8F, 0x73, 0xED, 0x74, 0xDE, 0xC5, 0x1C, 0x03, 0xDF,
-    0x06, 0x89, 0xFE, 0xE1, 0xBC, 0x12, 0x71, 0x81, 0x14, 0x9A, 0x9E, 0xA6, 0x0E, 0x31, 0xD1, 0x82,
-    0x5D, 0xEE, 0xA5, 0x7E, 0x12, 0x25, 0x18, 0xB7, 0x19, 0xD4, 0xE6, 0x29, 0xF8, 0xCC, 0x36, 0x74,
-    0xFC, 0x52, 0x0E, 0x5C, 0xE7, 0xF0, 0x7E, 0x17, 0x30, 0x5F, 0x0B, 0x04, 0x6F, 0xB8, 0x0D, 0x16,
-    0xDC, 0xB7, 0x52, 0x25, 0x2A, 0x5D, 0x60, 0xCE, 0xBA, 0x2E, 0xFA, 0x16, 0x13, 0x6E, 0xB9, 0x9A,
-    0x12, 0x2D, 0xD5, 0x68, 0xF4, 0xA4, 0x4F, 0xC4, 0x62, 0x4A, 0x8C, 0x75, 0xE6, 0xB9, 0x0E, 0xAB,
-    0x3A, 0x43, 0xC4, 0x6E, 0xCE, 0x02, 0xED, 0x18, 0x91, 0xE7, 0x14, 0xBB, 0x3E, 0xCB, 0x8E, 0x54,
-    0x8E, 0x22, 0xB0, 0x26, 0x61, 0x65, 0xC7, 0x5E, 0x22, 0x61, 0x9D, 0x75, 0xB9, 0x60, 0x8C, 0x1E,
-    0x0A, 0x9C, 0xE8, 0x0C, 0x85, 0x6F, 0xA5, 0x87, 0xA4, 0x04, 0x1C, 0xE2, 0x62, 0x9C, 0x99, 0x4C,
-    0x32, 0xDB, 0xDF, 0x27, 0x96, 0xC7, 0x61, 0xB1, 0x3B, 0x1A, 0xFA, 0xB4, 0x6C, 0xA6, 0x0A, 0x6C,
-    0x33, 0xFD, 0x17, 0x80, 0xC7, 0xEE, 0xDD, 0x3A, 0xA2, 0x58, 0xC7, 0x19, 0x78, 0xB2, 0x08, 0x47,
-    0x43, 0x16, 0xCD, 0xEA, 0x0B, 0xD1, 0xB8, 0x75, 0xF4, 0x21, 0xA5, 0xAC, 0xD1, 0xBB, 0x3B, 0x62,
-    0x08, 0x79, 0x08, 0xCC, 0x50, 0xE4, 0xB3, 0xC3, 0x4C, 0x04, 0xB8, 0x18, 0xAA, 0xCE, 0x2F, 0x05,
-    0xE6, 0x02, 0xAF, 0x05, 0x06, 0x02, 0x7D, 0xB6, 0x9D, 0x50, 0xCA, 0x64, 0xBF, 0xFA, 0x2F, 0x8F,
-    0x0B, 0x75, 0xF7, 0xBE, 0x64, 0x9B, 0xAA, 0x6E, 0xFE, 0x38, 0xE9, 0xF1, 0x32, 0xBF, 0x11, 0x06,
-    0xE6, 0x62, 0xDB, 0x73, 0x7E, 0xF6, 0xF0, 0x1E, 0xBA, 0x98, 0xBD, 0xC4, 0xA9, 0x56, 0x99, 0x76,
-    0x91, 0x6F, 0xA7, 0xE4, 0x42, 0xFA, 0xB5, 0x42, 0xBC, 0xE4, 0xC5, 0xEE, 0xDB, 0x9B, 0x25, 0xD4,
-    0x0B, 0xD1, 0x24, 0x5E, 0xB9, 0xC3, 0x78, 0x88, 0x35, 0x35, 0xD4, 0x84, 0x3A, 0x58, 0x13, 0xC4,
-    0x89, 0x40, 0x4D, 0xBD, 0xB9, 0xEA, 0x61, 0x2D, 0xE0, 0xBF, 0x2B, 0xB5, 0xB9, 0x32, 0xF5, 0x95,
-    0x7C, 0xAE, 0xFB, 0x31, 0xC3, 0x94, 0x72, 0x79, 0xA9, 0xAA, 0x87, 0x50, 0xCF, 0xA6, 0x26, 0xF0,
-    0x88, 0x95, 0x2E, 0x55, 0xB5, 0xF9, 0x16, 0xAD, 0x24, 0xC8, 0xC2, 0x2C, 0xAE, 0x8B, 0x4D, 0xA5,
-    0x92, 0x93, 0xA8, 0xE3, 0x65, 0xF2, 0x47, 0x9A, 0x33, 0xB5, 0x0F, 0xFC, 0x77, 0xCA, 0x45, 0xC1,
-    0x33, 0x35, 0xF3, 0x8B, 0x75, 0x54, 0x8B, 0xD9, 0xC6, 0x64, 0x2B, 0x1E, 0x97, 0xAB, 0xAB, 0xC4,
-    0x27, 0x2A, 0x5A, 0xEF, 0x85, 0x7D, 0xDE, 0xB0, 0xDE, 0xFB, 0xF3, 0x49, 0x3E, 0xA6, 0x93, 0x65,
-    0xE1, 0x9C, 0x6D, 0x7C, 0xC3, 0x3E, 0xDA, 0x10, 0x90, 0x91, 0x78, 0x9C, 0xEB, 0xAD, 0x6E, 0x8C,
-    0xC4, 0xB8, 0x71, 0x2A, 0x0F, 0xAC, 0x18, 0xDA, 0x74, 0x29, 0x21, 0xBE, 0xC3, 0x73, 0x61, 0xDE,
-    0x6A, 0x36, 0x1C, 0x7F, 0xE4, 0x68, 0x4A, 0xD7, 0x9C, 0x71, 0x34, 0xC7, 0x9D, 0xB5, 0x7A, 0xFF,
-    0x16, 0xC2, 0x0D, 0x30, 0xA7, 0x76, 0x05, 0x95, 0xAE, 0x6C, 0x9B, 0x4A, 0x1E, 0xCB, 0x0C, 0x78,
-    0x75, 0xCB, 0x60, 0xEB, 0x73, 0xB2, 0x4F, 0x74, 0x69, 0xAE, 0x86, 0xC0, 0x3F,
+static const uint8_t opendyslexic_10_italicBitmaps[23027] = {
+    0xBD, 0x9A, 0x4F, 0x8C, 0x1D, 0xC9, 0x7D, 0xDF, 0x3F, 0x55, 0xB5, 0x9C, 0x96, 0xB6, 0x44, 0x16,
+    0x0F, 0x5C, 0xC1, 0xD1, 0xEE, 0xB2, 0x75, 0xC8, 0x61, 0x6D, 0x70, 0xA6, 0x7D, 0x60, 0x00, 0x1A,
+    0x79, 0xF3, 0xBA, 0x76, 0xF7, 0xA0, 0x83, 0x0F, 0xE6, 0x61, 0xE9, 0x83, 0x0C, 0xD8, 0x3A, 0x38,
+    0x80, 0xAD, 0x00, 0x26, 0x0F, 0x7B, 0x98, 0xC3, 0x9B, 0x79, 0xB5, 0x5A, 0x20, 0x46, 0xA0, 0x83,
+    0x98, 0xC3, 0xFA, 0x2A, 0x22, 0x48, 0x80, 0x15, 0x0D, 0x64, 0x19, 0x60, 0x82, 0x8C, 0x93, 0x47,
+    0xBE, 0x62, 0xF6, 0xA0, 0x83, 0x13, 0xA4, 0x02, 0x01, 0x11, 0x10, 0x1D, 0x54, 0xDA, 0xD0, 0x31,
+    0x2C, 0x01, 0xDE, 0x8A, 0xD3, 0xC2, 0x36, 0x77, 0xFB, 0xF5, 0x2F, 0x87, 0x7E, 0x33, 0x24, 0xAD,
+    0x15, 0xA0, 0x4D, 0x64, 0x17, 0x1E, 0xFA, 0xF5, 0xF4, 0x54, 0xFF, 0xEA, 0xCF, 0xEF, 0xDF, 0xB7,
+    0xBE, 0xBF, 0x07, 0x17, 0xD1, 0x11, 0x07, 0x07, 0xE8, 0x84, 0x83, 0x05, 0x3A, 0xE3, 0xFC, 0xD3,
+    0xDF, 0x05, 0x17, 0x78, 0x0E, 0xA0, 0x0E, 0x6C, 0xA8, 0x3A, 0xDA, 0xC8, 0xD2, 0xA5, 0xA1, 0x7D,
+    0xBB, 0x3C, 0x70, 0x0F, 0xFB, 0xE6, 0xED, 0xB2, 0x74, 0x09, 0x2A, 0x7F, 0x0D, 0x70, 0x1C, 0x03,
+    0x97, 0x29, 0xC0, 0xAE, 0xCA, 0xC0, 0xCC, 0x44, 0x94, 0x88, 0xC8, 0xA0, 0x45, 0x44, 0x3A, 0x54,
+    0x71, 0x80, 0xCE, 0x35, 0x60, 0xE2, 0x3E, 0x60, 0xE3, 0x0C, 0x70, 0xE1, 0x04, 0x1A, 0x11, 0x11,
+    0xDF, 0x8A, 0x88, 0xC0, 0xBE, 0xC9, 0xC0, 0xCA, 0x24, 0xA0, 0xB7, 0x11, 0x54, 0xE7, 0x02, 0xCF,
+    0xB6, 0xF3, 0xD7, 0x80, 0x5B, 0x09, 0x2A, 0xD9, 0x80, 0x48, 0xC1, 0x8D, 0x3F, 0x0D, 0x8C, 0xEF,
+    0x7B, 0xAA, 0x1F, 0x7C, 0x01, 0x9A, 0x57, 0x6E, 0xC1, 0xFA, 0x83, 0x08, 0x22, 0xC0, 0x5A, 0x22,
+    0xFC, 0x7B, 0x49, 0x98, 0x6F, 0x4A, 0xE4, 0xFC, 0x3F, 0x16, 0xCF, 0x2D, 0x19, 0x8C, 0x88, 0xE4,
+    0x56, 0x64, 0x34, 0x22, 0x92, 0x76, 0x44, 0x1E, 0x41, 0x75, 0x1E, 0xB8, 0x72, 0xEB, 0xC9, 0x48,
+    0x06, 0x30, 0xBE, 0x09, 0xC6, 0x5F, 0xBB, 0x6A, 0xC2, 0xAF, 0xEC, 0xE8, 0x78, 0x5E, 0x7F, 0x23,
+    0x9A, 0x57, 0x1F, 0x46, 0xE4, 0x47, 0x09, 0xF7, 0xDF, 0x32, 0x20, 0x01, 0xBA, 0x5F, 0x87, 0xEE,
+    0x3C, 0xAC, 0x0C, 0xFC, 0x47, 0x1D, 0x39, 0x96, 0xC8, 0x41, 0x1D, 0xB8, 0x76, 0x26, 0x4A, 0xAD,
+    0x03, 0xE6, 0xE3, 0x15, 0x26, 0x39, 0x54, 0x31, 0x91, 0x45, 0x95, 0x71, 0xDF, 0xCC, 0x20, 0x09,
+    0x96, 0x01, 0xA4, 0xC0, 0x58, 0xF3, 0xB5, 0x07, 0xAA, 0x2C, 0x5A, 0xF6, 0x8E, 0x5C, 0xD4, 0x62,
+    0x7A, 0x25, 0x88, 0x48, 0xAC, 0x65, 0xF3, 0xEB, 0xAC, 0x1F, 0x4D, 0xB2, 0xDA, 0xD7, 0xFB, 0xE6,
+    0xAD, 0xDE, 0xC5, 0x01, 0x5E, 0x86, 0x03, 0x28, 0x98, 0x88, 0x0D, 0x38, 0x98, 0x6D, 0x1F, 0xA8,
+    0x8C, 0x89, 0x98, 0x88, 0xF5, 0x38, 0x70, 0x70, 0x19, 0x5E, 0x86, 0x5D, 0xD8, 0x85, 0xD9, 0xE9,
+    0x67, 0x1F, 0xF6, 0x61, 0x17, 0xF6, 0xA0, 0x86, 0x1A, 0x80, 0xAB, 0xB0, 0x0B, 0x0E, 0x4C, 0x44,
+    0x65, 0x38, 0x86, 0xD9, 0xE9, 0x23, 0xEB, 0x31, 0x11, 0x9D, 0x50, 0x19, 0x0A, 0x14, 0x38, 0x86,
+    0x03, 0x38, 0x78, 0x4A, 0xEA, 0xF4, 0x59, 0xC0, 0x02, 0x4E, 0xA0, 0x87, 0x0E, 0xE0, 0x39, 0xB8,
+    0xC5, 0x6B, 0x0F, 0xBF, 0xF9, 0x5F, 0x16, 0xD5, 0x48, 0x55, 0xD4, 0x27, 0xF7, 0xF7, 0xAE, 0xBD,
+    0x79, 0x31, 0x51, 0x01, 0x9F, 0x43, 0x47, 0x66, 0x98, 0xF0, 0xF5, 0xFF, 0xF0, 0x6D, 0x19, 0x29,
+    0x5C, 0x40, 0x25, 0xAE, 0x60, 0xBA, 0x26, 0x0E, 0x55, 0x6E, 0x75, 0x0F, 0x58, 0x19, 0x45, 0xD2,
+    0xB9, 0xF9, 0xD1, 0x83, 0x27, 0x3A, 0xBA, 0x0D, 0x50, 0x00, 0xDE, 0x04, 0x98, 0x01, 0x5C, 0x01,
+    0xB8, 0x00, 0x60, 0x01, 0x4C, 0x00, 0x4C, 0x04, 0x54, 0xFA, 0x94, 0xDE, 0xBB, 0x00, 0xEE, 0xEC,
+    0x52, 0x3D, 0xE9, 0x9D, 0xCF, 0x7A, 0x1F, 0x9F, 0xF5, 0xDE, 0x87, 0xED, 0x3E, 0x39, 0x0F, 0x54,
+    0xF1, 0xB4, 0xB7, 0x7E, 0xD2, 0xFB, 0xE4, 0x6C, 0x80, 0x8B, 0x5B, 0xED, 0xBF, 0x8B, 0x4E, 0xF7,
+    0x38, 0x36, 0xFE, 0x32, 0xD7, 0x4C, 0x34, 0xE1, 0xE0, 0xEA, 0x35, 0xF7, 0x9B, 0x5F, 0xF1, 0xA5,
+    0x1C, 0xD7, 0xCF, 0x3B, 0x5D, 0x74, 0x6E, 0x38, 0x34, 0xA5, 0x8E, 0x8D, 0x74, 0x5A, 0x46, 0x9C,
+    0x04, 0x9A, 0xDB, 0x00, 0xD4, 0xD1, 0x8C, 0x7C, 0xEE, 0x18, 0x13, 0xA9, 0xE1, 0x04, 0x13, 0x71,
+    0x70, 0x82, 0x49, 0x38, 0x58, 0xB1, 0x96, 0xF7, 0x45, 0x9C, 0xF4, 0xEC, 0xBC, 0x0B, 0x32, 0x62,
+    0x6F, 0x2F, 0xA6, 0xF9, 0xEA, 0x34, 0x2D, 0x68, 0x00, 0x1B, 0x61, 0x84, 0x3A, 0xA3, 0x47, 0x58,
+    0x27, 0xEC, 0x00, 0x4B, 0x29, 0x5A, 0x24, 0x3A, 0x19, 0xE1, 0xC5, 0x11, 0xFE, 0xEA, 0x26, 0x70,
+    0x7E, 0x52, 0xBF, 0x8A, 0x70, 0x19, 0xFE, 0x34, 0x63, 0x37, 0xC0, 0x11, 0xB0, 0x98, 0x16, 0x67,
+    0xC3, 0x73, 0xEA, 0x3E, 0xAD, 0x64, 0x2D, 0x23, 0x3B, 0x32, 0xF9, 0xA6, 0x8A, 0xD4, 0xA8, 0x81,
+    0xCB, 0x59, 0x7D, 0xE4, 0xEB, 0x5D, 0x55, 0x4A, 0x6D, 0x1E, 0xFE, 0xF4, 0xE6, 0xEF, 0x89, 0xDC,
+    0x7D, 0xEF, 0x31, 0x0D, 0x0C, 0x98, 0x42, 0x13, 0x78, 0xE1, 0x86, 0x37, 0x32, 0xF0, 0xE6, 0xA4,
+    0x98, 0x02, 0x17, 0x40, 0x7D, 0xEC, 0x69, 0x25, 0x2A, 0xF6, 0x40, 0x15, 0x68, 0xC0, 0xE4, 0xF3,
+    0x3B, 0x83, 0x12, 0xF1, 0xAD, 0x24, 0x25, 0x19, 0xF8, 0x7A, 0x60, 0x3D, 0x30, 0x3F, 0xB5, 0x4A,
+    0x0E, 0xFE, 0x09, 0x4E, 0x7A, 0xC6, 0x2A, 0xD5, 0x61, 0x4F, 0x17, 0x95, 0x77, 0xD9, 0x35, 0xC9,
+    0xC4, 0x3D, 0x7A, 0x35, 0x0A, 0x4E, 0x22, 0x4D, 0x06, 0x94, 0xC8, 0xC3, 0xAF, 0xBE, 0x07, 0xC7,
+    0x98, 0xC8, 0x1E, 0x14, 0x5C, 0xE0, 0x10, 0x53, 0xA8, 0x3D, 0x03, 0x36, 0xD3, 0xA2, 0x07, 0x5C,
+    0x02, 0x35, 0x7A, 0xF6, 0x2B, 0x6F, 0xA2, 0xE3, 0x02, 0x33, 0xDE, 0x24, 0xEB, 0xE4, 0x7C, 0xF5,
+    0xB0, 0xC7, 0x4A, 0xE0, 0xE6, 0x06, 0x9B, 0x0E, 0x59, 0x71, 0x62, 0x92, 0xCE, 0x35, 0xB5, 0x3F,
+    0xD2, 0x03, 0x22, 0x91, 0xE5, 0x23, 0xB0, 0x3D, 0xD5, 0xFF, 0x2A, 0x14, 0x1B, 0x66, 0x9C, 0x98,
+    0x60, 0xC3, 0x31, 0x27, 0x16, 0x17, 0x8E, 0x55, 0x67, 0xE3, 0x92, 0x56, 0x0A, 0xEB, 0x71, 0x9A,
+    0xF9, 0x89, 0xFE, 0x58, 0x68, 0x25, 0x19, 0xC9, 0xF0, 0xAB, 0x1C, 0xB2, 0x51, 0xC3, 0x13, 0x6B,
+    0xDE, 0x09, 0x2E, 0xD6, 0xB1, 0x8D, 0xFC, 0x1A, 0x2D, 0x0F, 0x18, 0x9F, 0x8A, 0x45, 0x9D, 0x2D,
+    0x2E, 0xD6, 0xA1, 0xE5, 0x01, 0xA0, 0x81, 0xC6, 0xA3, 0x47, 0x68, 0x32, 0x5A, 0x3C, 0x4D, 0x07,
+    0x6D, 0x80, 0xE6, 0x31, 0xEC, 0xC8, 0x63, 0xD8, 0x91, 0x9E, 0x49, 0x7D, 0x5F, 0x52, 0x5F, 0x7D,
+    0xB7, 0x95, 0x7C, 0x2A, 0x69, 0x2D, 0xFF, 0xEC, 0xEE, 0x1B, 0x70, 0x1D, 0xB8, 0x0F, 0xB4, 0x09,
+    0xAA, 0x0D, 0xB0, 0x3C, 0xBD, 0x19, 0xE1, 0xC5, 0x0D, 0x2F, 0x4A, 0x7A, 0x51, 0x1E, 0xD1, 0x3C,
+    0x82, 0xDF, 0x78, 0x2A, 0x88, 0x89, 0xB0, 0xAB, 0xFA, 0xC9, 0xF0, 0x17, 0x60, 0x03, 0x74, 0xD0,
+    0x40, 0x15, 0xD1, 0x1D, 0x6A, 0x03, 0x02, 0x75, 0x40, 0x17, 0x68, 0xA1, 0xCA, 0xF0, 0xFB, 0xD3,
+    0xEB, 0xD7, 0xC1, 0x79, 0x74, 0x07, 0xED, 0xF4, 0xE0, 0x9C, 0x07, 0x6A, 0x09, 0x50, 0xDF, 0xAE,
+    0xA1, 0x0A, 0x5C, 0x45, 0x67, 0x54, 0xE4, 0xE0, 0x81, 0xFF, 0x02, 0xEE, 0x95, 0xAB, 0x2A, 0xEA,
+    0xFF, 0x6E, 0x78, 0x85, 0x59, 0xB8, 0x65, 0xBC, 0xFD, 0xCF, 0x35, 0xF7, 0x18, 0x24, 0xCF, 0x70,
+    0xFF, 0xE9, 0x9D, 0x35, 0x6C, 0xD8, 0xF1, 0xD8, 0x02, 0xD0, 0xA6, 0x2F, 0x82, 0x16, 0x29, 0x60,
+    0x45, 0x00, 0x2B, 0x77, 0x9E, 0x6C, 0x5E, 0x0F, 0xAC, 0x81, 0x36, 0xC2, 0xBC, 0x40, 0x3D, 0x03,
+    0xE7, 0x3C, 0xF6, 0xED, 0x44, 0x15, 0x3B, 0x4C, 0x9A, 0xA3, 0x8B, 0x0B, 0xAA, 0xE8, 0x42, 0xCF,
+    0x8A, 0xF5, 0xDD, 0x35, 0xAD, 0x48, 0x6C, 0x45, 0xBA, 0xDA, 0x73, 0xDF, 0x45, 0x9A, 0x6F, 0x25,
+    0x6C, 0xA6, 0x1E, 0x6F, 0xD3, 0x48, 0xCF, 0x3E, 0x87, 0xCC, 0xD8, 0x65, 0xC1, 0x2E, 0x27, 0xCC,
+    0xE8, 0x54, 0xAF, 0x44, 0x92, 0x16, 0x49, 0x26, 0xAB, 0xDE, 0x24, 0x16, 0x55, 0x64, 0x65, 0x03,
+    0xBD, 0xF3, 0xBA, 0x77, 0xEF, 0xDC, 0x2C, 0xB5, 0x48, 0x6E, 0x44, 0x42, 0x2B, 0x8F, 0x4F, 0x27,
+    0x76, 0xB3, 0x87, 0xA5, 0x44, 0x9A, 0xBF, 0xF8, 0x03, 0x5C, 0x06, 0xD3, 0x01, 0x1B, 0xA0, 0xF6,
+    0x60, 0x0A, 0x70, 0x08, 0xB8, 0x38, 0xF9, 0x31, 0x75, 0x04, 0x25, 0x5E, 0x51, 0xCB, 0xDD, 0xA2,
+    0x44, 0x46, 0x9C, 0x48, 0x62, 0x29, 0x03, 0xAC, 0xC7, 0x6D, 0xA2, 0xAC, 0xC7, 0xDB, 0xB0, 0x96,
+    0x0E, 0x23, 0xD2, 0xE1, 0xA8, 0x0B, 0x0B, 0x6C, 0x32, 0x19, 0x17, 0x9C, 0xA7, 0x65, 0x01, 0x83,
+    0x2E, 0x98, 0xE2, 0x02, 0x2E, 0xEE, 0xC3, 0x91, 0x2A, 0x98, 0xCE, 0x46, 0x96, 0xB1, 0xFD, 0xED,
+    0xF7, 0x36, 0x88, 0x48, 0xAE, 0x44, 0x46, 0x1A, 0x91, 0x84, 0xC8, 0x6D, 0x00, 0x75, 0x03, 0x23,
+    0x12, 0x95, 0x48, 0xE6, 0x64, 0x1B, 0x08, 0x6B, 0xA6, 0xE0, 0x62, 0xFE, 0xE2, 0x0F, 0xA6, 0x6C,
+    0xBB, 0x94, 0xC0, 0x7C, 0x1B, 0x1B, 0xAB, 0x08, 0xBA, 0x00, 0xE3, 0xDD, 0x3B, 0x2C, 0x65, 0x43,
+    0x23, 0xE2, 0x9D, 0x48, 0x82, 0x9D, 0xF5, 0x06, 0x27, 0x03, 0xCE, 0x43, 0x03, 0xCC, 0xB7, 0xF2,
+    0x8E, 0xEE, 0x7A, 0x44, 0x02, 0x22, 0x5E, 0x75, 0xD3, 0xDB, 0xA6, 0x4C, 0x36, 0x64, 0xD3, 0xB4,
+    0x0F, 0x75, 0x84, 0x26, 0x40, 0xEB, 0xCF, 0x7C, 0x66, 0xBD, 0xA1, 0x12, 0xC9, 0x7A, 0xF4, 0x8A,
+    0xA5, 0x9F, 0xBA, 0xE9, 0x9E, 0xC9, 0xCC, 0xAA, 0xBC, 0xB5, 0x73, 0x17, 0xCD, 0xC7, 0xD7, 0x07,
+    0x9A, 0xD1, 0x45, 0xDC, 0xBF, 0x18, 0x50, 0xA5, 0xCE, 0xCC, 0x11, 0x91, 0xE4, 0x44, 0x06, 0x5A,
+    0x91, 0xC8, 0x4D, 0x09, 0x70, 0x0E, 0x2E, 0x4D, 0x50, 0xA8, 0x86, 0x15, 0x0D, 0xF4, 0xCC, 0x51,
+    0x1D, 0x87, 0xE8, 0xC2, 0x0A, 0x53, 0x18, 0x30, 0x99, 0x81, 0x2A, 0xEB, 0x1E, 0x97, 0x8C, 0x88,
+    0x44, 0x23, 0x22, 0xB1, 0x12, 0x91, 0x60, 0x45, 0xC4, 0xBB, 0xC4, 0x92, 0x3A, 0xB2, 0xA6, 0x89,
+    0x8C, 0xB4, 0x41, 0x6D, 0xA0, 0x0E, 0x55, 0xD2, 0x85, 0x81, 0x39, 0xB5, 0xB7, 0xD1, 0x14, 0x7A,
+    0x0E, 0x69, 0x70, 0xB1, 0xCA, 0xBA, 0x67, 0xC3, 0x92, 0x26, 0xDA, 0x53, 0x4F, 0xB5, 0x69, 0x5A,
+    0xC2, 0x00, 0x55, 0x9A, 0x36, 0x6A, 0x98, 0x16, 0xB4, 0xBD, 0x35, 0x19, 0x1A, 0x7F, 0x76, 0x5B,
+    0x7B, 0x58, 0x3D, 0xB9, 0x1D, 0xA0, 0xCE, 0xD4, 0x02, 0xEB, 0x0E, 0x23, 0x9E, 0xE7, 0xAF, 0x03,
+    0x26, 0x37, 0x5E, 0x95, 0x3A, 0xB0, 0xAA, 0x03, 0x73, 0x17, 0xA9, 0x5D, 0xC4, 0xFE, 0xD7, 0x88,
+    0xF9, 0x49, 0x42, 0x49, 0x02, 0xC9, 0xD0, 0x16, 0xA8, 0x07, 0x70, 0x12, 0x31, 0x3F, 0xE9, 0xD1,
+    0x9D, 0xC0, 0xD0, 0x16, 0xE6, 0xD5, 0x48, 0xE3, 0x25, 0xB9, 0x58, 0x0F, 0xB0, 0x13, 0x30, 0x19,
+    0x3A, 0x58, 0xC1, 0x1C, 0x9C, 0xA7, 0x8A, 0x98, 0x02, 0x3D, 0x2C, 0xA0, 0x01, 0x17, 0xA8, 0x12,
+    0xBA, 0xC0, 0x70, 0xE3, 0xF7, 0x97, 0x32, 0x36, 0x22, 0xBF, 0x25, 0x12, 0xD9, 0xB9, 0x83, 0xBE,
+    0x43, 0x9B, 0x68, 0x23, 0xE2, 0xF5, 0x48, 0x35, 0xE2, 0x7A, 0x9A, 0x1E, 0x49, 0x48, 0xB1, 0x42,
+    0xF5, 0x61, 0x6C, 0x57, 0x34, 0x4B, 0xF3, 0x51, 0xA1, 0xDF, 0xD4, 0xDF, 0x0E, 0xD5, 0xF7, 0xBA,
+    0xE1, 0x3E, 0x8D, 0xFB, 0xF0, 0x7B, 0x85, 0xA1, 0x1D, 0xEB, 0x58, 0x95, 0x75, 0x11, 0x9A, 0xB7,
+    0xE4, 0xF5, 0x9E, 0x4D, 0x35, 0xD4, 0xA9, 0x2A, 0x2E, 0x8A, 0x6F, 0xE2, 0xAF, 0x9A, 0x01, 0x81,
+    0xBA, 0x00, 0xF0, 0x25, 0xD4, 0x80, 0x8B, 0xAC, 0x31, 0x89, 0x36, 0xEA, 0x42, 0xDD, 0x31, 0x60,
+    0x47, 0xE6, 0x98, 0x0F, 0x63, 0x83, 0xFA, 0xA8, 0xB8, 0xC8, 0x70, 0xBF, 0xCA, 0xB4, 0xF5, 0x6B,
+    0x85, 0xFA, 0xED, 0x3C, 0xE0, 0xD2, 0x70, 0x84, 0x29, 0x4D, 0xE3, 0xF5, 0x60, 0x7F, 0x18, 0x19,
+    0x95, 0x64, 0x5A, 0xDF, 0x76, 0x34, 0xD1, 0x0D, 0xB8, 0xA2, 0x47, 0x80, 0x66, 0x64, 0xF2, 0x36,
+    0x46, 0xBF, 0x86, 0x11, 0x97, 0xD8, 0xA0, 0x7A, 0x8E, 0x60, 0x4E, 0xCB, 0xE4, 0x74, 0x26, 0xD9,
+    0x08, 0x9D, 0xC9, 0xB0, 0xA2, 0x87, 0x39, 0x73, 0x68, 0xBC, 0x8B, 0x34, 0xD1, 0x8C, 0x7F, 0xB2,
+    0x4E, 0x88, 0x48, 0xA6, 0x11, 0x29, 0x18, 0x91, 0x0C, 0x2F, 0xCA, 0x19, 0xEE, 0xB5, 0xF2, 0x08,
+    0x23, 0xE2, 0x29, 0xBA, 0xB0, 0x60, 0xC6, 0x1C, 0x87, 0xF3, 0x36, 0x54, 0xF1, 0xC5, 0xA4, 0x45,
+    0x32, 0x22, 0x89, 0xE5, 0x77, 0x26, 0xBB, 0x70, 0x71, 0xB2, 0x11, 0xDD, 0x6F, 0x43, 0xC9, 0x12,
+    0x68, 0x22, 0xB8, 0xC9, 0xAE, 0x5E, 0xDC, 0x80, 0x12, 0x89, 0xD8, 0xAE, 0x2A, 0x34, 0x41, 0x75,
+    0x1C, 0x42, 0x4F, 0x0F, 0xBD, 0x2E, 0xD0, 0x9B, 0x0C, 0x7D, 0x15, 0xA1, 0xB3, 0x11, 0x55, 0x5C,
+    0x40, 0x17, 0x17, 0x30, 0xC9, 0x85, 0xCF, 0xB9, 0xE8, 0x52, 0x2B, 0xDE, 0x6D, 0x43, 0xCF, 0x80,
+    0x11, 0x29, 0xF0, 0x9E, 0x14, 0xA0, 0xE9, 0x01, 0xB7, 0x01, 0x76, 0xEE, 0x42, 0x25, 0xB7, 0xB1,
+    0xD2, 0x71, 0x81, 0x05, 0x2F, 0x33, 0xE3, 0x0A, 0x33, 0x66, 0xCC, 0x38, 0xA0, 0xE7, 0xB8, 0xEA,
+    0x10, 0x49, 0x4A, 0x04, 0x2D, 0x12, 0x4C, 0x67, 0x63, 0x55, 0xAA, 0x68, 0x73, 0x95, 0x5C, 0x72,
+    0xA9, 0x8E, 0x2E, 0x35, 0xB1, 0x4E, 0x6D, 0x68, 0x13, 0x34, 0x63, 0xA0, 0x91, 0x1E, 0x3B, 0xDE,
+    0xF5, 0x6A, 0xC3, 0xB4, 0x4A, 0x93, 0xB6, 0x61, 0xC3, 0xC8, 0x6D, 0xA8, 0x25, 0x43, 0x2D, 0x09,
+    0x76, 0x04, 0x70, 0x3D, 0x20, 0xE1, 0x12, 0xCB, 0xCE, 0x8A, 0x88, 0x16, 0x91, 0xB8, 0x14, 0xC9,
+    0x6A, 0x3D, 0xDE, 0xDE, 0x66, 0x9E, 0x1B, 0x37, 0x6E, 0x58, 0x11, 0x79, 0x5F, 0x44, 0xB2, 0x7F,
+    0x26, 0x5A, 0xF5, 0xDB, 0xA0, 0xFB, 0xCC, 0x5E, 0x76, 0xDB, 0x00, 0xDC, 0x32, 0x45, 0x1F, 0x97,
+    0xA6, 0xC8, 0x34, 0xE5, 0xEE, 0xAF, 0xA3, 0xFF, 0x95, 0xEE, 0x71, 0xC9, 0x25, 0x96, 0xB4, 0xE8,
+    0x5E, 0x0D, 0xB8, 0x64, 0x13, 0x2D, 0x2D, 0x6A, 0x60, 0xA0, 0x4A, 0x55, 0xA6, 0x99, 0x50, 0xC7,
+    0x8A, 0x2A, 0x99, 0x42, 0x83, 0x0B, 0x0C, 0x2C, 0xA9, 0x93, 0x12, 0x11, 0x2A, 0x91, 0x1E, 0x27,
+    0x12, 0xA9, 0xA5, 0xDF, 0xAA, 0xFE, 0x15, 0x78, 0xFE, 0xF7, 0x3C, 0xF6, 0xFD, 0x8C, 0xC9, 0x3D,
+    0xA6, 0xCC, 0xD1, 0x9D, 0x8B, 0x6A, 0x30, 0x85, 0x81, 0x81, 0x07, 0xB4, 0x2C, 0x71, 0xA9, 0xF5,
+    0xA6, 0x6B, 0x22, 0x9B, 0x3A, 0xD2, 0x7E, 0x2B, 0x63, 0xA5, 0xA0, 0xA5, 0x83, 0xF5, 0x00, 0xCD,
+    0x00, 0x76, 0xDC, 0xE6, 0x14, 0x56, 0xB5, 0x07, 0xFA, 0xDA, 0x83, 0x2E, 0x8D, 0x07, 0x93, 0x1B,
+    0xC0, 0xC6, 0x86, 0xDA, 0xBB, 0xD0, 0xD0, 0xFA, 0x96, 0x06, 0x09, 0x47, 0xB4, 0x5A, 0xE2, 0x40,
+    0x5B, 0xC9, 0xC3, 0x9E, 0xD6, 0xFD, 0xF0, 0x7B, 0x85, 0xB6, 0xFD, 0xE6, 0xF7, 0x33, 0xED, 0xDA,
+    0x7E, 0x18, 0x69, 0x37, 0x95, 0x04, 0xDA, 0xBE, 0x12, 0x68, 0x4B, 0x35, 0x42, 0x9B, 0xCC, 0x00,
+    0x6D, 0x30, 0x3D, 0xA0, 0x03, 0xCF, 0x7B, 0x3A, 0x6C, 0xA0, 0xC1, 0x46, 0xAA, 0x64, 0xE3, 0xF6,
+    0x4C, 0xD7, 0xD8, 0x08, 0xD5, 0x4F, 0x12, 0xD3, 0xE1, 0x87, 0x26, 0xC1, 0x94, 0xC6, 0xED, 0x06,
+    0xB0, 0x12, 0xC1, 0x7E, 0x54, 0xC0, 0x96, 0x11, 0x6C, 0x69, 0x22, 0xB6, 0x98, 0x1E, 0xDB, 0x21,
+    0xD8, 0x8E, 0x3A, 0xB1, 0x0F, 0x5D, 0x8F, 0x7B, 0xBB, 0xB0, 0xB2, 0xD1, 0xA6, 0x3A, 0x1C, 0xD1,
+    0x9A, 0xC2, 0xD0, 0x62, 0x3E, 0xEA, 0xB0, 0x12, 0xA8, 0x87, 0x29, 0xDD, 0x6F, 0xA0, 0x2A, 0x93,
+    0xD2, 0x36, 0xD3, 0x28, 0x6D, 0x64, 0x72, 0x5D, 0x25, 0x22, 0x81, 0xA5, 0x48, 0xC2, 0x89, 0x14,
+    0xA0, 0xEA, 0x01, 0xDB, 0x03, 0xAE, 0x3B, 0xBD, 0xD4, 0x1D, 0xD0, 0x94, 0xD3, 0x4B, 0x5B, 0x80,
+    0x65, 0x3E, 0xBD, 0xAC, 0x33, 0x20, 0x3F, 0xBD, 0x71, 0x9D, 0xA5, 0x4C, 0x29, 0x4E, 0xBC, 0x13,
+    0x91, 0xC4, 0x14, 0x40, 0x9B, 0x7E, 0xCA, 0x6C, 0x8B, 0xED, 0xB1, 0xA0, 0x9B, 0x70, 0xAF, 0x2E,
+    0x93, 0x09, 0x9B, 0x38, 0x59, 0x9E, 0x0B, 0x13, 0x58, 0xAF, 0xB7, 0x56, 0x3D, 0x7B, 0xF6, 0x15,
+    0x55, 0xA6, 0xF3, 0x85, 0x49, 0x53, 0x77, 0x1B, 0xA6, 0x14, 0x5B, 0x33, 0xA9, 0xB7, 0xED, 0xE1,
+    0x85, 0xEB, 0x70, 0xF1, 0x6B, 0x77, 0xF2, 0xBD, 0x7B, 0xF7, 0xEE, 0xDD, 0x3B, 0x3E, 0x3E, 0x39,
+    0x58, 0x2C, 0x16, 0x8B, 0x37, 0xBF, 0x46, 0x5B, 0xA6, 0x6D, 0xB6, 0x61, 0xEA, 0xBF, 0x3F, 0x89,
+    0x55, 0xDB, 0x19, 0x7C, 0xDA, 0xE3, 0xED, 0x84, 0xEA, 0xED, 0x44, 0xBA, 0xA7, 0x1E, 0x6F, 0x13,
+    0xF6, 0xF6, 0xB1, 0xCE, 0x50, 0x45, 0x8C, 0x78, 0xDC, 0x08, 0x2F, 0xBC, 0x51, 0x79, 0xD3, 0xE9,
+    0xEF, 0xBF, 0x1A, 0x5F, 0x01, 0x5A, 0x91, 0x22, 0x22, 0x11, 0x60, 0xA1, 0x8A, 0x8D, 0x5B, 0xC8,
+    0xF3, 0xCF, 0x69, 0x24, 0xD9, 0xB0, 0x52, 0xD9, 0xC4, 0x19, 0x8B, 0xCA, 0x57, 0xE1, 0x1E, 0xBD,
+    0xA3, 0xF1, 0x7D, 0x5D, 0x9C, 0x08, 0xCB, 0xB1, 0xA8, 0xF1, 0x77, 0x51, 0x8F, 0x60, 0xC5, 0x14,
+    0x42, 0x31, 0x09, 0x55, 0x60, 0xF5, 0x02, 0xF3, 0x75, 0x76, 0x8F, 0xFF, 0xC8, 0x74, 0xE6, 0x61,
+    0x47, 0x59, 0x31, 0x9B, 0x53, 0xBB, 0xE0, 0x5E, 0x2F, 0xF5, 0x43, 0x91, 0xD8, 0x4A, 0xAC, 0x64,
+    0x4B, 0x5E, 0xC0, 0xCD, 0xE4, 0xC4, 0x0F, 0xD8, 0xC8, 0x0C, 0x55, 0xB0, 0x81, 0x3D, 0x18, 0xD0,
+    0xE3, 0x1D, 0x23, 0x59, 0x9F, 0x06, 0xD8, 0x0B, 0xC0, 0xCB, 0xDB, 0x35, 0xCD, 0xB6, 0x07, 0xB7,
+    0x82, 0xED, 0x0A, 0xCB, 0x4D, 0x56, 0x5D, 0x93, 0x4C, 0x74, 0xD1, 0xE1, 0xC2, 0x65, 0x6A, 0xBF,
+    0x4B, 0xC3, 0x3E, 0x4B, 0xDA, 0x3F, 0x19, 0x69, 0x64, 0x42, 0x31, 0x7A, 0x9C, 0x6D, 0xDD, 0xD5,
+    0x53, 0x09, 0xF6, 0xF6, 0x3D, 0xEB, 0xCF, 0x57, 0xE1, 0x77, 0x5E, 0x17, 0xF9, 0xD1, 0xF8, 0x9D,
+    0xEB, 0xC7, 0xB0, 0x0F, 0x36, 0x29, 0x25, 0x12, 0x1B, 0xC9, 0x6A, 0x7D, 0x1B, 0xD4, 0x6D, 0x35,
+    0x32, 0xC3, 0x42, 0xE1, 0x02, 0x4E, 0xDE, 0x92, 0xCE, 0x44, 0x16, 0xD8, 0x40, 0x47, 0x8D, 0x2E,
+    0xCC, 0x31, 0x89, 0x15, 0x50, 0x75, 0x77, 0x90, 0x4F, 0xA2, 0xFB, 0xC6, 0xC8, 0xB1, 0xE9, 0x4C,
+    0x74, 0xF1, 0x65, 0x5A, 0xEE, 0xA9, 0x4E, 0x47, 0x17, 0xED, 0x0D, 0xA1, 0x96, 0x9E, 0x56, 0x22,
+    0xCD, 0xB7, 0x41, 0x75, 0xF8, 0x26, 0x1A, 0x19, 0x68, 0x24, 0x51, 0xF7, 0xDB, 0xE3, 0xEF, 0xF1,
+    0x64, 0x5E, 0x19, 0xAE, 0x4C, 0x8A, 0xFC, 0x8D, 0x11, 0x2B, 0x03, 0xE3, 0x57, 0xA2, 0x0B, 0x57,
+    0x74, 0xD1, 0x71, 0x9F, 0x99, 0x89, 0x26, 0xAC, 0x38, 0x70, 0xC1, 0xF9, 0x8E, 0xD2, 0xD0, 0x98,
+    0x62, 0x0A, 0x6E, 0x02, 0x2A, 0x6F, 0x4C, 0x27, 0x00, 0x74, 0xA4, 0x70, 0x95, 0x2B, 0x38, 0x4C,
+    0xD0, 0x89, 0x8E, 0x19, 0x0D, 0x36, 0x4C, 0x67, 0x61, 0x53, 0x50, 0x3D, 0xDB, 0xCE, 0x80, 0x8E,
+    0x50, 0xE0, 0xE0, 0x8C, 0x51, 0x08, 0xA8, 0x04, 0xF7, 0x60, 0x06, 0x2F, 0x83, 0x3D, 0x23, 0x19,
+    0x0A, 0x6A, 0xC0, 0x0D, 0x93, 0xF7, 0x01, 0x3B, 0xA7, 0xA4, 0xC5, 0xEE, 0x29, 0xA9, 0x71, 0xBC,
+    0xE0, 0x7F, 0x17, 0xF5, 0x97, 0x51, 0x0B, 0x66, 0xA0, 0xDA, 0x60, 0xD7, 0xB8, 0x9B, 0xB1, 0x76,
+    0xB9, 0xA9, 0xBA, 0xB9, 0x19, 0xB8, 0xC2, 0x8C, 0x13, 0x8A, 0x2A, 0x3A, 0x9B, 0x58, 0x45, 0x1B,
+    0x1C, 0x35, 0x7B, 0xEC, 0x33, 0x63, 0xE1, 0xD7, 0x51, 0x22, 0xBF, 0xB2, 0xF4, 0x0F, 0x30, 0xB2,
+    0x59, 0x76, 0x2C, 0x5F, 0x97, 0xAF, 0x04, 0x17, 0xEB, 0x78, 0x8D, 0x4E, 0x15, 0x13, 0x1A, 0xF6,
+    0x38, 0x36, 0xD9, 0x44, 0xC7, 0x82, 0x15, 0xC5, 0x46, 0xE7, 0xF7, 0xE8, 0x54, 0x31, 0xA9, 0x61,
+    0xCE, 0xA1, 0xC9, 0x55, 0xB2, 0x91, 0x2F, 0xFF, 0x21, 0x56, 0x3A, 0xC6, 0x2A, 0x3A, 0x3F, 0xD3,
+    0xC5, 0xC4, 0x7D, 0x16, 0x26, 0xBA, 0xB0, 0xA2, 0x73, 0xB1, 0xA6, 0xD7, 0xA5, 0xF1, 0xAD, 0x29,
+    0x26, 0xF3, 0x62, 0x8F, 0x95, 0xAC, 0xB3, 0xE3, 0x84, 0x03, 0x47, 0xF5, 0x6A, 0xE6, 0x78, 0x17,
+    0xA7, 0x93, 0xCA, 0x0D, 0xF7, 0x95, 0x48, 0x70, 0x92, 0x69, 0x32, 0x9C, 0xB3, 0x19, 0xF3, 0x43,
+    0x01, 0x79, 0x35, 0xD1, 0x72, 0x8D, 0xDA, 0x5F, 0xC0, 0x46, 0x13, 0x4C, 0x51, 0x89, 0x81, 0xC2,
+    0xD2, 0x9F, 0xD0, 0xCA, 0x40, 0xBD, 0xDE, 0xE0, 0xBE, 0xD5, 0x53, 0xC5, 0xED, 0xE9, 0xA0, 0x03,
+    0x56, 0xA7, 0xAC, 0xC4, 0x59, 0x6B, 0xBE, 0x11, 0xAC, 0xFC, 0x1B, 0x4E, 0xAA, 0xAE, 0x8A, 0x2E,
+    0xCE, 0x38, 0x52, 0x59, 0x17, 0x8B, 0x8B, 0x57, 0xB8, 0xCF, 0xB1, 0x2D, 0x4A, 0x24, 0x1A, 0xF9,
+    0x6B, 0xF4, 0xE6, 0x1E, 0x98, 0x87, 0x50, 0x9F, 0xC0, 0x3A, 0x62, 0xB6, 0x04, 0xD3, 0xA5, 0x4B,
+    0xEA, 0x27, 0xC5, 0x4A, 0x6C, 0x03, 0x1D, 0x36, 0x32, 0x67, 0xFA, 0x6E, 0x51, 0x03, 0x36, 0x43,
+    0xFD, 0x98, 0xF1, 0x5D, 0x1D, 0x31, 0x01, 0x93, 0x51, 0xE2, 0xB9, 0x59, 0x50, 0xDD, 0x39, 0xD5,
+    0x35, 0x52, 0x96, 0x92, 0x9A, 0xD1, 0x4F, 0xCA, 0x3F, 0xC1, 0xF9, 0x73, 0x3F, 0x7D, 0x5D, 0x06,
+    0x93, 0x98, 0x61, 0x23, 0x1D, 0x6E, 0x6B, 0xDC, 0xA3, 0x5F, 0xF6, 0x95, 0x78, 0x13, 0xAB, 0x87,
+    0x45, 0xE7, 0x03, 0xBA, 0x5D, 0x66, 0x8E, 0xDA, 0x44, 0xFB, 0x56, 0x31, 0xE9, 0x40, 0x97, 0xE6,
+    0xC3, 0xC1, 0x8A, 0x28, 0x91, 0xD0, 0xFC, 0xCF, 0x74, 0x09, 0xF5, 0x7A, 0xE4, 0x60, 0x17, 0xA7,
+    0xB2, 0x49, 0x35, 0x27, 0x94, 0x1A, 0xF7, 0x7A, 0x64, 0xD5, 0x61, 0xFF, 0x1A, 0xD6, 0x11, 0x3B,
+    0xC0, 0xDA, 0x73, 0x09, 0xCE, 0x39, 0x8F, 0x7D, 0x3F, 0x61, 0x52, 0x87, 0xCE, 0xFB, 0x36, 0x14,
+    0xF7, 0x9B, 0xE5, 0xC4, 0xFC, 0x60, 0x9C, 0x21, 0x32, 0xD2, 0x8A, 0xE0, 0x7A, 0x09, 0xA6, 0x6F,
+    0x23, 0x83, 0x4D, 0x50, 0xB3, 0x8F, 0x0B, 0xDD, 0xF4, 0xD2, 0x87, 0x1E, 0xB3, 0x99, 0xF0, 0x53,
+    0xD5, 0x4F, 0x51, 0xFC, 0xF0, 0x08, 0xD5, 0xB5, 0xD8, 0xDC, 0xF8, 0x26, 0xB8, 0x48, 0x61, 0xC6,
+    0x31, 0xC7, 0x2C, 0x28, 0xCC, 0x4C, 0x62, 0xBF, 0x8A, 0xEC, 0xB9, 0x40, 0x53, 0x43, 0x7D, 0x04,
+    0x6E, 0x98, 0x40, 0x88, 0x2D, 0x60, 0xF3, 0x84, 0x23, 0x9A, 0x80, 0x12, 0x58, 0x0E, 0x53, 0xD2,
+    0xF8, 0x0E, 0x40, 0x2D, 0xDD, 0xC4, 0x4F, 0x1E, 0x4E, 0x68, 0x7F, 0x05, 0x2E, 0xA2, 0x7A, 0x68,
+    0x02, 0xA6, 0x83, 0xF6, 0xC7, 0xB7, 0x95, 0x48, 0x74, 0x22, 0x1E, 0x5E, 0x00, 0x89, 0x0C, 0x30,
+    0x9B, 0x90, 0xB5, 0xA7, 0x8A, 0xE8, 0xCC, 0x4E, 0xC1, 0x66, 0x4C, 0x0F, 0x35, 0xDB, 0x47, 0x74,
+    0x30, 0x9B, 0xFE, 0xDE, 0x4C, 0x47, 0x5F, 0xE0, 0xF3, 0xBC, 0xC4, 0x15, 0xAE, 0x71, 0x95, 0x5B,
+    0xDC, 0x21, 0xA9, 0xA8, 0xA3, 0x09, 0x06, 0xCB, 0x05, 0xCE, 0xF3, 0x12, 0xAF, 0x70, 0x15, 0xCE,
+    0x79, 0x9A, 0x82, 0xEA, 0xA0, 0xA0, 0x0A, 0x3A, 0x63, 0x12, 0x26, 0x52, 0x3D, 0x42, 0x0F, 0xE8,
+    0x0E, 0xE7, 0xD9, 0x3B, 0xA5, 0xF7, 0x7A, 0x54, 0x61, 0x99, 0x18, 0x3D, 0x40, 0x6D, 0x2E, 0x7C,
+    0xED, 0xBB, 0xE7, 0xFF, 0xE5, 0x5B, 0x65, 0xE2, 0xFA, 0x2E, 0x56, 0xE1, 0x25, 0x9D, 0xDD, 0xAB,
+    0xA5, 0x8A, 0x0B, 0x9D, 0x6D, 0x6A, 0x69, 0x55, 0x4F, 0x6F, 0x53, 0xC5, 0x15, 0x2E, 0xE2, 0x2F,
+    0x2A, 0xC8, 0x26, 0xD0, 0x55, 0x91, 0x13, 0x9D, 0x58, 0xE8, 0xAC, 0x3B, 0x17, 0xEB, 0xB0, 0x62,
+    0xA8, 0x92, 0x8E, 0x17, 0x50, 0x5C, 0x9C, 0x80, 0xC4, 0x64, 0xDF, 0x55, 0x02, 0x2E, 0x3D, 0x65,
+    0xE6, 0x2E, 0x4C, 0x3B, 0x6C, 0x06, 0x30, 0x1F, 0x82, 0xFA, 0x3F, 0x11, 0x4A, 0x07, 0x27, 0xFB,
+    0xB0, 0x70, 0x9E, 0x7D, 0x93, 0x69, 0xE8, 0xA9, 0x69, 0x70, 0xC1, 0x46, 0xFB, 0xF1, 0x9F, 0x16,
+    0x23, 0x13, 0xF9, 0xFB, 0x6A, 0x87, 0x4D, 0x03, 0xBA, 0xDF, 0xC0, 0x03, 0x80, 0x5B, 0x40, 0xE5,
+    0xB7, 0x39, 0xC0, 0x44, 0x7E, 0x6E, 0x33, 0x79, 0x0B, 0xA8, 0x11, 0xC0, 0xAD, 0x80, 0x45, 0x01,
+    0xF3, 0x7E, 0x82, 0x3D, 0xE7, 0x51, 0x65, 0x1F, 0x9C, 0xEF, 0x61, 0x65, 0x32, 0x55, 0xB4, 0x91,
+    0x39, 0x0D, 0x7A, 0xBC, 0x3B, 0x4C, 0x38, 0x43, 0x44, 0x52, 0x95, 0x68, 0x7C, 0x0B, 0x0F, 0x4C,
+    0x37, 0x21, 0x75, 0xEE, 0xB1, 0xF5, 0xE9, 0xD9, 0x31, 0xE8, 0xF0, 0x0F, 0xFF, 0x4E, 0x47, 0x33,
+    0x79, 0x06, 0x55, 0x5A, 0x81, 0x4B, 0x03, 0x9C, 0xF3, 0x6F, 0x3C, 0xB3, 0xC4, 0x1E, 0xD0, 0x03,
+    0xD3, 0xD6, 0x4E, 0x83, 0xD6, 0x33, 0x60, 0xB6, 0xCF, 0xB4, 0xBB, 0xAA, 0xEC, 0x83, 0x49, 0x73,
+    0xB0, 0x71, 0x0E, 0x35, 0x0D, 0xCC, 0x69, 0x60, 0x7D, 0x77, 0x0D, 0x22, 0x82, 0x11, 0x11, 0x5F,
+    0xA5, 0xED, 0x21, 0x27, 0xB4, 0x9E, 0x26, 0xFC, 0x1D, 0x90, 0x1E, 0x12, 0xE0, 0xCB, 0x80, 0xF1,
+    0x5B, 0xBE, 0x9E, 0x3B, 0xDB, 0xF9, 0xB3, 0x7B, 0x7A, 0x4C, 0x38, 0x9C, 0x52, 0xF3, 0xD4, 0x6E,
+    0x78, 0x44, 0x0A, 0x4B, 0xE9, 0xD9, 0xFB, 0xDB, 0x44, 0xC5, 0xE3, 0xAF, 0x42, 0x2B, 0x91, 0x5A,
+    0x32, 0x2E, 0x4C, 0x6F, 0xAB, 0xB2, 0x0D, 0xB1, 0xED, 0xDD, 0x77, 0xA9, 0x45, 0xBC, 0x15, 0x49,
+    0x46, 0xA4, 0x3B, 0xA5, 0x97, 0x2B, 0x3F, 0xA5, 0xD8, 0x9F, 0x6F, 0x32, 0xBF, 0xD4, 0x21, 0xB7,
+    0x49, 0x95, 0x01, 0xF8, 0x20, 0xC1, 0x9D, 0xE7, 0x81, 0x17, 0x7E, 0x89, 0x23, 0x5C, 0x52, 0x1E,
+    0x93, 0x16, 0x70, 0xDF, 0x45, 0xDC, 0xC3, 0xA7, 0xC8, 0x49, 0xD4, 0x8D, 0xA9, 0xDE, 0x52, 0xCB,
+    0x38, 0xD1, 0xDD, 0xFB, 0xA7, 0x0C, 0xF8, 0x0A, 0x70, 0xEF, 0xDC, 0x99, 0x48, 0xA0, 0x5A, 0xF2,
+    0x64, 0xB6, 0xCF, 0xFE, 0xFB, 0xC7, 0x77, 0x51, 0x22, 0x1D, 0x8D, 0x88, 0x9F, 0xC6, 0x7A, 0xE5,
+    0xB4, 0x48, 0xF0, 0xC4, 0xFA, 0xAA, 0x4C, 0xED, 0x27, 0x8E, 0xC5, 0x85, 0x89, 0x70, 0x71, 0x71,
+    0x62, 0x5F, 0xA6, 0x04, 0xD4, 0x63, 0x33, 0xAD, 0x57, 0x03, 0xB6, 0x9C, 0x99, 0x94, 0x8E, 0xA8,
+    0x08, 0x79, 0xCB, 0xBF, 0xFF, 0x4C, 0x3B, 0x82, 0xDA, 0x63, 0xCF, 0xA8, 0x89, 0xC3, 0x29, 0x80,
+    0x46, 0x4C, 0x46, 0x75, 0xA7, 0x30, 0xB3, 0x0E, 0xD8, 0x8C, 0xE9, 0x50, 0x03, 0xAC, 0x39, 0x93,
+    0x6E, 0x22, 0x6A, 0x80, 0x0F, 0x12, 0xF9, 0xF3, 0xBF, 0x04, 0x89, 0xFB, 0x55, 0xAC, 0xD2, 0x8A,
+    0xC1, 0xC5, 0x67, 0xDD, 0x4E, 0xF5, 0x50, 0xFB, 0x53, 0xDE, 0xD4, 0xE4, 0x29, 0x2B, 0x44, 0x18,
+    0xC0, 0x05, 0xD4, 0x44, 0xB3, 0x9A, 0x02, 0x47, 0x53, 0x56, 0xD9, 0x40, 0x1D, 0xD1, 0xC3, 0x93,
+    0x99, 0x02, 0x1C, 0x7E, 0x01, 0xF8, 0x47, 0xDF, 0x05, 0xAE, 0x34, 0xFE, 0x29, 0x62, 0x99, 0x25,
+    0xA6, 0xD0, 0x44, 0x7A, 0x5C, 0xC7, 0x82, 0x6A, 0x43, 0x8B, 0x96, 0xE0, 0x02, 0x9F, 0x14, 0x1B,
+    0x39, 0x1C, 0x4C, 0xA1, 0x6D, 0x5E, 0xED, 0x71, 0xDF, 0x4D, 0xF7, 0xA9, 0x72, 0xDF, 0x62, 0xBA,
+    0xB6, 0x0E, 0x0C, 0xF6, 0xCF, 0x13, 0x6B, 0xFD, 0x51, 0xA1, 0x0D, 0xCB, 0x1E, 0x97, 0xDC, 0x06,
+    0x5B, 0x8C, 0x60, 0x06, 0xD6, 0x67, 0x23, 0x4F, 0xD5, 0x92, 0x06, 0x40, 0xDF, 0x79, 0x66, 0xF7,
+    0xB5, 0x64, 0xB0, 0x22, 0x1E, 0xF7, 0xC8, 0x16, 0x5C, 0x66, 0x83, 0x4B, 0xD4, 0xA1, 0xCA, 0x98,
+    0x3C, 0x6D, 0x60, 0x07, 0xFB, 0xAC, 0xC0, 0xF9, 0x39, 0xD8, 0xE8, 0x02, 0x26, 0x9B, 0x8C, 0xEE,
+    0x18, 0xD0, 0x03, 0xED, 0x5F, 0xFD, 0xD3, 0x0D, 0x4E, 0x64, 0x44, 0x8B, 0x08, 0xB4, 0x32, 0x82,
+    0x5A, 0xF7, 0x3F, 0xA3, 0xE9, 0x7B, 0x67, 0xA5, 0x97, 0x6B, 0x67, 0x25, 0x9B, 0x9F, 0xDB, 0xFE,
+    0x5E, 0x26, 0xA6, 0x23, 0x5B, 0x77, 0xE5, 0x6F, 0x12, 0x70, 0xE7, 0xF3, 0x4F, 0x78, 0x9D, 0x00,
+    0x8D, 0x6C, 0xA0, 0xBD, 0xDD, 0x44, 0xDA, 0x60, 0x3A, 0x5A, 0xCF, 0x11, 0x75, 0xC0, 0x05, 0x17,
+    0x31, 0xD9, 0x24, 0xE8, 0x74, 0x81, 0x7D, 0x7A, 0x68, 0x98, 0x83, 0x0B, 0x2E, 0x60, 0x93, 0x29,
+    0xD8, 0x82, 0xFC, 0xEB, 0xF7, 0x3A, 0x5A, 0x91, 0x1E, 0x2B, 0x32, 0x80, 0x48, 0x0F, 0x3B, 0x4F,
+    0xB8, 0x7E, 0xCE, 0x71, 0x9D, 0xC9, 0x9D, 0x75, 0xD7, 0x02, 0x9B, 0x3A, 0xFE, 0xBD, 0xEF, 0xC0,
+    0x3F, 0x38, 0xAB, 0x9B, 0xED, 0xF3, 0xB7, 0x52, 0xF8, 0xCE, 0x1D, 0x7E, 0xCD, 0x37, 0x81, 0x0D,
+    0x1B, 0xAA, 0x62, 0x0A, 0x4D, 0xA8, 0x23, 0x1B, 0xEE, 0x63, 0x8A, 0x29, 0xD4, 0xD1, 0x45, 0x0E,
+    0x39, 0x42, 0x17, 0xD5, 0xE1, 0xA2, 0x8D, 0x1C, 0xD2, 0xA2, 0x0B, 0x3D, 0x2E, 0x56, 0x45, 0x6D,
+    0xA8, 0xA7, 0xC0, 0x27, 0x01, 0x91, 0x01, 0x25, 0x4F, 0x68, 0x33, 0xAA, 0x53, 0x33, 0x30, 0xF1,
+    0xB4, 0xCC, 0xF7, 0xE9, 0xED, 0x0D, 0xCE, 0x5D, 0xB7, 0x99, 0xD6, 0xB7, 0x5E, 0x0D, 0x0C, 0xD8,
+    0x52, 0x15, 0x5A, 0xDF, 0x04, 0x06, 0x86, 0xED, 0x4C, 0xBC, 0x0B, 0xAC, 0x38, 0xC4, 0x14, 0x5D,
+    0x26, 0xED, 0xAC, 0x98, 0x63, 0x8A, 0x1A, 0x58, 0xFA, 0x4A, 0x64, 0xA0, 0x16, 0xC9, 0xB4, 0x13,
+    0x0B, 0x9E, 0x9F, 0x91, 0xFF, 0x32, 0xDB, 0x04, 0x67, 0x2F, 0x03, 0xB7, 0x9E, 0xFF, 0xC5, 0xD6,
+    0x1E, 0x5C, 0xE4, 0xFE, 0xFF, 0xE3, 0xDA, 0x1B, 0x93, 0x26, 0x92, 0xC7, 0xE6, 0x01, 0x5E, 0x50,
+    0xD7, 0xFF, 0x7F, 0xB6, 0xFC, 0xE8, 0x17, 0x1D, 0x56, 0x4D, 0x2A, 0x56, 0x1D, 0xEC, 0x84, 0xCF,
+    0x76, 0xD8, 0x9F, 0xDA, 0x4B, 0x53, 0x2A, 0x2D, 0x9F, 0xA2, 0xAD, 0xCF, 0x20, 0xE9, 0xDA, 0x04,
+    0xDE, 0x2F, 0x5F, 0x83, 0xF4, 0xD2, 0xC4, 0x79, 0x7E, 0xE0, 0xB5, 0x6C, 0xD8, 0xD3, 0x45, 0x65,
+    0x13, 0x1D, 0x35, 0x6F, 0x72, 0xA0, 0xA3, 0xC9, 0x8E, 0xC6, 0xCF, 0xAB, 0x01, 0x91, 0xA2, 0xE4,
+    0x93, 0xA8, 0xC6, 0xDF, 0x05, 0x1B, 0x3B, 0xE6, 0x55, 0xD2, 0x7D, 0x7B, 0x86, 0x8B, 0x3E, 0xD3,
+    0xFB, 0x9F, 0x4A, 0x3C, 0xCC, 0x9F, 0x10, 0x0F, 0x3B, 0x12, 0x14, 0x7C, 0xC9, 0xB3, 0x33, 0x15,
+    0x27, 0xA6, 0x1C, 0xB9, 0x9A, 0x62, 0xFD, 0x59, 0x7B, 0x0E, 0x96, 0x85, 0x3F, 0xB3, 0x1C, 0x93,
+    0x0E, 0xCE, 0x1D, 0xB7, 0x32, 0xD6, 0x3F, 0x7E, 0xC7, 0x7A, 0x4C, 0x82, 0xFB, 0x5C, 0xAC, 0x65,
+    0xD0, 0x32, 0xF2, 0xE2, 0x63, 0x80, 0x04, 0xD7, 0xC0, 0x9E, 0xC6, 0xE0, 0x4F, 0x69, 0x1E, 0x25,
+    0x91, 0x3F, 0xB3, 0xEC, 0x72, 0xB5, 0x0A, 0xBF, 0xE3, 0x45, 0xFA, 0xFA, 0xC7, 0xEF, 0xE8, 0x04,
+    0xFB, 0xA0, 0x3B, 0x7C, 0x2D, 0x03, 0x6B, 0x09, 0x6A, 0x7D, 0xFB, 0xCC, 0x64, 0x4D, 0x07, 0xFF,
+    0x2E, 0xF3, 0x92, 0x8A, 0x9F, 0x5D, 0x84, 0xF2, 0x6F, 0xD0, 0x98, 0xCC, 0x50, 0x7B, 0x9B, 0x37,
+    0xCF, 0x4C, 0xE5, 0x22, 0xD4, 0x03, 0xFA, 0xD1, 0x15, 0x76, 0xB9, 0xAA, 0xF2, 0x17, 0x93, 0x13,
+    0x09, 0xCB, 0xBB, 0x6F, 0xE8, 0xB4, 0xA5, 0x97, 0xFC, 0x73, 0x2C, 0xA5, 0xB0, 0x96, 0xC0, 0xCD,
+    0x47, 0x53, 0xF1, 0xDD, 0xF9, 0x09, 0xD2, 0xB1, 0x83, 0x8E, 0x64, 0xDE, 0xFC, 0x54, 0xFE, 0xE1,
+    0x1E, 0x15, 0x5C, 0xFB, 0x19, 0x20, 0xA6, 0x02, 0x16, 0xAE, 0xA1, 0x12, 0x16, 0x66, 0x90, 0xB1,
+    0x9E, 0x7D, 0x54, 0xC1, 0x46, 0xF6, 0x4E, 0x53, 0x7C, 0x1D, 0xF9, 0x20, 0x5E, 0xE0, 0xF6, 0x04,
+    0xEB, 0x66, 0x90, 0xA9, 0x9E, 0xEE, 0xCE, 0x69, 0x77, 0xE5, 0x2F, 0xD5, 0x26, 0x0F, 0xF5, 0x1F,
+    0x97, 0x07, 0x67, 0x66, 0x7F, 0x05, 0x0A, 0xC6, 0x6F, 0xBF, 0x03, 0xBB, 0xD0, 0x61, 0x22, 0xCD,
+    0xF6, 0xC7, 0x00, 0x8B, 0x2F, 0xC0, 0xFF, 0x78, 0x09, 0xF5, 0xFE, 0x9B, 0xE8, 0xB7, 0x9E, 0x60,
+    0x94, 0x2F, 0xFF, 0x21, 0xAC, 0xC5, 0x33, 0x56, 0x91, 0xCE, 0x44, 0x5D, 0x4C, 0x34, 0xA9, 0x8A,
+    0x26, 0xBA, 0x60, 0xA3, 0xF3, 0x2E, 0xD6, 0xB8, 0xD0, 0xD0, 0xF8, 0x96, 0x96, 0xF9, 0x84, 0x35,
+    0xE7, 0x5B, 0x7C, 0xEB, 0x9F, 0x5E, 0xE2, 0x3A, 0xB0, 0x1E, 0xD9, 0xA3, 0xD8, 0x50, 0x85, 0xC2,
+    0x9B, 0x97, 0xB1, 0xAF, 0x25, 0xCA, 0x2E, 0x97, 0x75, 0xB1, 0xA9, 0x96, 0x1E, 0x19, 0x4F, 0x59,
+    0xCF, 0x08, 0xD7, 0xC0, 0x4D, 0xBF, 0x10, 0xF8, 0x39, 0xED, 0xB3, 0x08, 0x7C, 0x62, 0x2D, 0xFF,
+    0x36, 0xF3, 0x92, 0x0E, 0x9F, 0x5D, 0xC4, 0xA7, 0x78, 0xDC, 0x69, 0xB0, 0x1A, 0x61, 0x3D, 0x62,
+    0xC3, 0x8C, 0x13, 0x0E, 0x4C, 0x54, 0xE9, 0x32, 0xD6, 0x1F, 0x33, 0xD3, 0x49, 0x65, 0x1B, 0x1B,
+    0x3F, 0x71, 0x5F, 0x61, 0xAA, 0xF6, 0x6F, 0x43, 0xFD, 0x02, 0x76, 0x4E, 0x6D, 0x60, 0xC6, 0xA2,
+    0x66, 0xAF, 0x0A, 0xEE, 0xB5, 0x64, 0x62, 0x51, 0x65, 0xC6, 0x49, 0xCD, 0x7E, 0x15, 0x1A, 0x3D,
+    0x4A, 0x5C, 0x4B, 0xA9, 0xA5, 0xD7, 0xE3, 0x96, 0x3D, 0x79, 0x02, 0x21, 0x8F, 0x7F, 0x66, 0x43,
+    0x7E, 0x51, 0x39, 0x95, 0xC7, 0x74, 0xE8, 0xEF, 0x7B, 0x15, 0x5F, 0x01, 0x28, 0xAA, 0x2C, 0x38,
+    0xB9, 0xCC, 0xBE, 0xF5, 0xCE, 0xC4, 0x2A, 0x16, 0x9D, 0x17, 0x74, 0x97, 0x59, 0xD9, 0x4F, 0x44,
+    0x8B, 0xC4, 0xA5, 0x64, 0xDB, 0x77, 0x70, 0x4E, 0x79, 0x53, 0xF6, 0x99, 0xDB, 0x64, 0xF3, 0x29,
+    0xE4, 0x36, 0xB1, 0x8A, 0x0B, 0x4E, 0xAA, 0xE0, 0xFC, 0x31, 0xC5, 0x51, 0x53, 0x74, 0xAE, 0xD9,
+    0x57, 0xD9, 0xC6, 0xE6, 0xC3, 0x41, 0x8B, 0xC4, 0x5A, 0x7A, 0xD6, 0xDF, 0x7A, 0x62, 0x0A, 0xCD,
+    0x66, 0x29, 0x03, 0x5A, 0x44, 0xA4, 0xC7, 0x75, 0xF6, 0xF1, 0x1B, 0x4C, 0xB8, 0x82, 0xA9, 0x28,
+    0x85, 0xEA, 0xD1, 0x3D, 0x98, 0x82, 0xE9, 0xC1, 0x24, 0xAA, 0xC7, 0x6F, 0x60, 0x23, 0x56, 0x7A,
+    0x5C, 0xC0, 0x49, 0x87, 0x0B, 0xB8, 0x0C, 0x2E, 0x50, 0x4F, 0x35, 0xD7, 0x36, 0x82, 0x7B, 0xFC,
+    0xDB, 0xE2, 0xC1, 0x89, 0xC8, 0xDD, 0x77, 0xB1, 0x22, 0xDB, 0xE2, 0x8F, 0xC8, 0x00, 0x37, 0x47,
+    0x91, 0x61, 0x5B, 0xE2, 0x57, 0xEB, 0xB0, 0xCE, 0xAC, 0x65, 0x6E, 0xC2, 0x1E, 0xC2, 0x4B, 0x36,
+    0x54, 0xF1, 0x8B, 0xB1, 0xB0, 0x94, 0xE1, 0x32, 0xF6, 0xE3, 0x77, 0x5E, 0x4B, 0x53, 0x78, 0xAF,
+    0x41, 0x17, 0x3B, 0x40, 0x2D, 0x22, 0x1B, 0x64, 0xD3, 0x4A, 0xD2, 0xE3, 0xF6, 0x37, 0x4E, 0x95,
+    0xC8, 0xB8, 0xDE, 0x52, 0xC7, 0xD4, 0x22, 0x22, 0x3F, 0x10, 0x11, 0x29, 0x4B, 0x36, 0x6A, 0x30,
+    0xA5, 0xCA, 0x2E, 0x99, 0xAE, 0x89, 0x9B, 0x2A, 0xB7, 0xAA, 0x67, 0x59, 0xC7, 0xF6, 0xB7, 0x52,
+    0xFD, 0xE7, 0xD9, 0xBD, 0x5F, 0xAA, 0x1F, 0xF5, 0xA6, 0x1B, 0x4C, 0x37, 0xD8, 0xBF, 0xE9, 0xDD,
+    0xF7, 0x4A, 0xFD, 0xC7, 0xB9, 0x75, 0xF1, 0xA8, 0x09, 0xE7, 0xB8, 0xC4, 0xF5, 0x5E, 0x15, 0xFB,
+    0xDD, 0xEC, 0x62, 0xDB, 0x84, 0xA5, 0xEE, 0xFF, 0x2F, 0x95, 0x97, 0xBF, 0x6F, 0x24, 0x47, 0x76,
+    0xC7, 0x3F, 0x55, 0xA5, 0x55, 0xC1, 0x2A, 0x2C, 0xEB, 0x82, 0x75, 0x60, 0x4B, 0x64, 0x3B, 0xB6,
+    0x49, 0x76, 0xA2, 0x80, 0x41, 0xCF, 0x74, 0x19, 0xFB, 0x07, 0xF8, 0x02, 0x6D, 0x24, 0xC0, 0x97,
+    0x3A, 0x93, 0x02, 0x06, 0x3C, 0x63, 0xB8, 0x53, 0xB6, 0x02, 0xE1, 0x70, 0xC1, 0xCA, 0x06, 0x24,
+    0x07, 0x0E, 0xAC, 0x54, 0xBC, 0x40, 0x3C, 0x60, 0xCE, 0xE0, 0xD9, 0xDC, 0x9D, 0x5A, 0x6D, 0xA0,
+    0xF0, 0xCA, 0x38, 0x08, 0x0E, 0x1C, 0x5C, 0x1D, 0x24, 0x27, 0x12, 0x8C, 0xAD, 0x93, 0xDB, 0x50,
+    0xEF, 0xAA, 0x39, 0xCF, 0xC1, 0x90, 0xB7, 0xB2, 0x01, 0x03, 0xBE, 0xCA, 0xBA, 0xD1, 0xFD, 0xEA,
+    0xFB, 0x7E, 0x7D, 0xBF, 0xEF, 0x01, 0xE0, 0x55, 0xE6, 0xC8, 0x73, 0x7D, 0x94, 0x48, 0x72, 0x5F,
+    0x9E, 0xD1, 0x01, 0x15, 0x5C, 0x84, 0x19, 0x20, 0x92, 0xEC, 0x97, 0x67, 0x1C, 0x6C, 0xDF, 0x9A,
+    0x04, 0x7B, 0xC0, 0x5A, 0xAA, 0x11, 0x49, 0x5E, 0x36, 0x00, 0x23, 0xB0, 0x06, 0xFA, 0x04, 0xF3,
+    0x0A, 0x4D, 0x07, 0xDE, 0x07, 0xDC, 0x3B, 0x19, 0x9B, 0x06, 0x4C, 0x9E, 0xA3, 0xAB, 0x8F, 0xAA,
+    0xEA, 0xCA, 0xC8, 0x25, 0xEB, 0xB3, 0x35, 0xBD, 0x48, 0xEA, 0x45, 0x86, 0x26, 0xF0, 0xD0, 0x27,
+    0xDA, 0x07, 0x19, 0x57, 0x94, 0x48, 0x71, 0x9F, 0xDD, 0x63, 0xB6, 0xBD, 0xCE, 0x26, 0x68, 0xDF,
+    0x00, 0x11, 0x4C, 0xF6, 0x78, 0x76, 0x59, 0xF0, 0xB6, 0x2E, 0x26, 0xF9, 0xB0, 0xA4, 0x97, 0x41,
+    0x89, 0x04, 0x27, 0x65, 0xEB, 0xC1, 0x72, 0x83, 0x7B, 0x7F, 0x41, 0x25, 0x7B, 0x6E, 0xEB, 0xA2,
+    0x53, 0xC7, 0xCA, 0xC8, 0xC8, 0xFD, 0x9F, 0x14, 0x17, 0x5C, 0xAC, 0x2C, 0x3C, 0xFE, 0x71, 0xB1,
+    0x43, 0x2B, 0x62, 0x44, 0x52, 0x2F, 0x19, 0x80, 0x5E, 0x26, 0xF5, 0xFC, 0xEC, 0xBD, 0x6B, 0x8F,
+    0x55, 0x05, 0x97, 0x60, 0x0E, 0x0C, 0xD7, 0x10, 0x80, 0x09, 0x6C, 0x81, 0x36, 0xC0, 0x04, 0xA6,
+    0x02, 0x18, 0xD9, 0x60, 0xE4, 0x0A, 0x1B, 0x3A, 0x3C, 0x1D, 0x9E, 0x13, 0xF6, 0x58, 0xB1, 0x4F,
+    0xA5, 0x53, 0x95, 0x13, 0x5D, 0x59, 0x99, 0xA2, 0xAA, 0xC9, 0x36, 0xD9, 0xD4, 0xBC, 0xFF, 0x83,
+    0xBC, 0x16, 0xA9, 0x22, 0x52, 0x06, 0x4C, 0x1A, 0x70, 0x71, 0x0B, 0x5C, 0xAA, 0x7E, 0x7E, 0x16,
+    0x3D, 0xD0, 0x81, 0x2E, 0xE0, 0x03, 0xF4, 0x52, 0xD5, 0xF3, 0xB3, 0xE8, 0x02, 0x37, 0x39, 0xB1,
+    0x11, 0x5A, 0x99, 0x10, 0xA9, 0x46, 0x24, 0x82, 0xCB, 0x6D, 0x6D, 0x22, 0xBD, 0xD9, 0x98, 0x8A,
+    0xA9, 0x7D, 0x9A, 0xA0, 0x79, 0x67, 0xEA, 0x81, 0xA9, 0xFF, 0x71, 0x06, 0xF7, 0xF9, 0xD7, 0x03,
+    0xD0, 0x2F, 0xEF, 0x03, 0x5A, 0x24, 0x02, 0x5E, 0x2A, 0x80, 0x4C, 0x00, 0xAD, 0x14, 0xC0, 0x89,
+    0x00, 0x46, 0x64, 0x02, 0x64, 0xBD, 0x2E, 0xD0, 0x7F, 0xF5, 0x4C, 0x02, 0xCD, 0x28, 0x0F, 0x26,
+    0xEC, 0xC6, 0x0F, 0xCB, 0xA2, 0xE5, 0x13, 0xB9, 0x2B, 0x81, 0x3F, 0xFC, 0x82, 0x5E, 0xD2, 0x2D,
+    0x2E, 0x60, 0x0F, 0x5C, 0xC4, 0xA6, 0x97, 0x3F, 0x4E, 0x46, 0x22, 0x5C, 0x82, 0x03, 0x9D, 0x51,
+    0xF5, 0x8F, 0xF4, 0xD8, 0x3C, 0x9D, 0x9C, 0x4C, 0xAC, 0x87, 0x6D, 0x7A, 0x5E, 0x09, 0xC0, 0x29,
+    0xB6, 0xEA, 0x4A, 0x1F, 0x7D, 0x32, 0x57, 0xCC, 0xE9, 0xAB, 0x1E, 0xB4, 0x24, 0x9F, 0x9A, 0x87,
+    0xCC, 0xD5, 0xF3, 0xAA, 0x06, 0xFF, 0x20, 0xB9, 0x34, 0xDD, 0xA7, 0x77, 0x9F, 0x0C, 0x8C, 0x0F,
+    0x7D, 0x72, 0xFF, 0x9A, 0x97, 0xF4, 0xF7, 0xCD, 0x88, 0x54, 0x9F, 0xAD, 0xB0, 0xA4, 0xAD, 0x66,
+    0x42, 0x82, 0x2F, 0x37, 0xC5, 0x5B, 0x0C, 0x98, 0x74, 0x02, 0x4E, 0x12, 0xB8, 0x81, 0x17, 0xC7,
+    0x64, 0xFE, 0x98, 0x16, 0x33, 0x32, 0xD1, 0x66, 0x53, 0xB4, 0xD0, 0x84, 0x66, 0xE2, 0x52, 0x49,
+    0x31, 0xD5, 0x3F, 0x0D, 0x4D, 0x9C, 0x26, 0x2E, 0xDD, 0xA7, 0xD5, 0xD4, 0x87, 0x6D, 0xF0, 0xEF,
+    0xE6, 0x89, 0x87, 0xF7, 0x6D, 0x35, 0xDF, 0x94, 0x36, 0x7A, 0xE1, 0x8A, 0x65, 0xB5, 0x55, 0x0B,
+    0x7D, 0xF2, 0x03, 0x1B, 0x30, 0xA5, 0x0D, 0xAA, 0x36, 0x91, 0xCB, 0x26, 0x32, 0xF7, 0x89, 0xC6,
+    0x27, 0xDC, 0x2F, 0x12, 0xE6, 0xAB, 0x8C, 0x92, 0x0C, 0x52, 0xA0, 0xAF, 0xD0, 0x4C, 0xE0, 0x25,
+    0x61, 0xBE, 0x1A, 0xD1, 0x83, 0xC0, 0xD4, 0x57, 0xE6, 0x76, 0x43, 0x1B, 0x24, 0xFB, 0xD4, 0x4C,
+    0x60, 0xE5, 0x0A, 0x27, 0x13, 0x3E, 0x5E, 0xD2, 0x30, 0xD2, 0x32, 0x30, 0x57, 0x95, 0x85, 0x29,
+    0x5C, 0x9A, 0xCC, 0x60, 0x93, 0xAA, 0x2E, 0xE9, 0xE2, 0xA3, 0xC9, 0x4D, 0x70, 0xA9, 0x65, 0x19,
+    0x7B, 0x1E, 0x71, 0xBA, 0xF5, 0xAE, 0x47, 0x8F, 0xEA, 0x0A, 0x9F, 0xDD, 0x80, 0x30, 0x2F, 0x6E,
+    0xA1, 0xBE, 0x49, 0x3F, 0x2C, 0xEE, 0x1F, 0xCC, 0x2F, 0xC2, 0xAC, 0x9B, 0x75, 0xD4, 0xAF, 0x7F,
+    0x53, 0xED, 0x93, 0xA7, 0x2E, 0x1E, 0xFA, 0x71, 0xC6, 0xD0, 0x3F, 0xAE, 0x36, 0x5D, 0xB9, 0xD4,
+    0xEA, 0x0F, 0xE7, 0x8C, 0x30, 0x98, 0x8C, 0x4B, 0x70, 0x0B, 0xEE, 0xE0, 0x03, 0x0B, 0x1A, 0xB8,
+    0xA4, 0x85, 0x91, 0x39, 0x6A, 0xE0, 0x14, 0x5D, 0xB9, 0xC4, 0x54, 0x26, 0x4C, 0x61, 0xC2, 0x16,
+    0x3D, 0xE2, 0xB3, 0x11, 0x91, 0x64, 0x44, 0x24, 0x59, 0x11, 0x89, 0x4E, 0x44, 0x82, 0xCF, 0x2C,
+    0x69, 0x12, 0x6B, 0xDA, 0xC4, 0x86, 0x3E, 0xAA, 0x2B, 0xA0, 0xDD, 0x00, 0x6B, 0x19, 0x60, 0x13,
+    0xD6, 0xB0, 0xC1, 0x67, 0xAE, 0x50, 0x23, 0xF7, 0x61, 0x4E, 0x0F, 0x3E, 0xFA, 0x80, 0xC9, 0x2E,
+    0xC1, 0x60, 0x0A, 0x5C, 0x32, 0xC2, 0x9C, 0x39, 0xB4, 0xC1, 0x27, 0xDA, 0x64, 0x36, 0x1F, 0xAC,
+    0x33, 0x22, 0x52, 0x68, 0x45, 0x2A, 0x46, 0xA4, 0xC0, 0xAB, 0x12, 0xBF, 0x93, 0x66, 0x96, 0x32,
+    0xB1, 0x96, 0x89, 0x81, 0x13, 0x2A, 0x2B, 0x55, 0xA9, 0xBA, 0xA8, 0x6A, 0xB2, 0x2E, 0x36, 0x99,
+    0xEC, 0x92, 0x49, 0x3E, 0xDA, 0xE4, 0x83, 0x8B, 0x0D, 0x3E, 0xB4, 0x34, 0xCC, 0x69, 0x99, 0x31,
+    0x07, 0x27, 0x5F, 0x60, 0x44, 0x02, 0x55, 0x57, 0x16, 0x74, 0xCC, 0xF1, 0xF8, 0xE0, 0xA2, 0x4D,
+    0xAF, 0x66, 0x2D, 0x52, 0x10, 0xC9, 0x2C, 0x3F, 0xDA, 0x52, 0x81, 0x4F, 0x5B, 0x2E, 0xD0, 0x23,
+    0x70, 0x05, 0x2C, 0x81, 0x36, 0xC1, 0x8B, 0x7A, 0x84, 0xB7, 0x46, 0x58, 0x4A, 0xA2, 0xFD, 0xF7,
+    0xBF, 0xC0, 0x17, 0x30, 0xC3, 0xF5, 0xC7, 0x4D, 0xB8, 0xA6, 0x8F, 0xD3, 0x6B, 0x53, 0x4C, 0x40,
+    0x93, 0x40, 0x49, 0x50, 0x34, 0x72, 0x56, 0x95, 0xC8, 0x06, 0x2F, 0x92, 0x59, 0xCA, 0x04, 0xEB,
+    0xCD, 0xD6, 0xD1, 0x5B, 0xF7, 0xEE, 0xDD, 0x73, 0x22, 0xF2, 0x44, 0x44, 0x4A, 0xF0, 0x61, 0x4B,
+    0x4E, 0xBA, 0x5E, 0x33, 0xF0, 0x29, 0xFF, 0x0B, 0xDE, 0x70, 0x6D, 0xBB, 0x07, 0xDA, 0x08, 0x3E,
+    0x6F, 0x6F, 0x56, 0xD3, 0x0D, 0xC8, 0x13, 0x0E, 0xE8, 0x58, 0x30, 0x63, 0xE0, 0x50, 0x55, 0x1A,
+    0x93, 0xF1, 0x2E, 0xE1, 0x1F, 0x04, 0xBC, 0x80, 0xBB, 0x02, 0x3B, 0x6D, 0xC1, 0x9B, 0xBA, 0xB5,
+    0xB0, 0x8C, 0xFC, 0xC9, 0x06, 0xFA, 0x11, 0x96, 0xF1, 0x3B, 0xB1, 0x7F, 0x76, 0xA8, 0xD3, 0xB9,
+    0x0F, 0xAF, 0xBF, 0x6E, 0xD2, 0xED, 0xD7, 0x74, 0x75, 0x2E, 0x8C, 0xEE, 0xF1, 0x66, 0xBD, 0xCE,
+    0xBD, 0x48, 0xD6, 0x22, 0x11, 0x53, 0xB6, 0x94, 0xCA, 0xE2, 0x06, 0x69, 0x04, 0x9B, 0x01, 0x1D,
+    0x79, 0x25, 0x30, 0xE0, 0x22, 0x2D, 0x2E, 0x61, 0xB3, 0x4B, 0x30, 0xBA, 0x04, 0xAD, 0x4B, 0x60,
+    0xBF, 0xCA, 0x80, 0x64, 0xA0, 0xCD, 0x80, 0xAB, 0x6C, 0xC1, 0x5D, 0xF7, 0xFB, 0x37, 0x15, 0x5C,
+    0xDD, 0x80, 0xAB, 0x6D, 0xC2, 0x55, 0x33, 0xE2, 0x06, 0x04, 0x37, 0xD0, 0x6C, 0x39, 0x5E, 0x15,
+    0xB2, 0x0B, 0x8E, 0x8E, 0x8E, 0x4A, 0xB1, 0xD1, 0x86, 0x03, 0xF6, 0xA9, 0x54, 0x93, 0x6C, 0x3C,
+    0xE4, 0x80, 0x81, 0x6A, 0x92, 0x4D, 0x0D, 0x87, 0x3C, 0xBC, 0xF7, 0xCC, 0x88, 0x8C, 0x5E, 0x24,
+    0x81, 0x7F, 0xA1, 0x03, 0xA0, 0x32, 0xE5, 0x9C, 0xE3, 0x8E, 0x6E, 0x07, 0x6F, 0x83, 0x7D, 0x27,
+    0x99, 0x5C, 0x55, 0xED, 0xD4, 0xE4, 0x3F, 0xD8, 0x68, 0x91, 0xD0, 0x7E, 0x9E, 0x50, 0x15, 0x2E,
+    0x60, 0xB6, 0xCD, 0x35, 0xA0, 0xEA, 0x1F, 0x98, 0xE4, 0xE2, 0x6A, 0x87, 0x99, 0x49, 0xC7, 0x54,
+    0xAF, 0x93, 0x8D, 0x27, 0x9E, 0x99, 0xCE, 0x47, 0x54, 0xAF, 0xB2, 0x4D, 0x9D, 0xE3, 0x50, 0x95,
+    0x8E, 0xC1, 0x51, 0x4C, 0xEA, 0x6C, 0xD8, 0xA3, 0xEC, 0xF3, 0xF3, 0x37, 0xDF, 0xAF, 0x46, 0x44,
+    0xA2, 0x17, 0xB9, 0xE2, 0xFF, 0x69, 0x2B, 0x76, 0x8E, 0x03, 0x55, 0x3A, 0xEA, 0xFF, 0xB0, 0xF5,
+    0x4F, 0x6F, 0x7E, 0x30, 0x18, 0x11, 0x19, 0xBC, 0x88, 0x24, 0xE0, 0x90, 0xAD, 0xAA, 0xDC, 0xA8,
+    0x10, 0xB0, 0xAE, 0x48, 0x45, 0x65, 0x74, 0xC2, 0x24, 0xCC, 0x67, 0x38, 0x29, 0x9E, 0x13, 0xCF,
+    0xFE, 0x1E, 0xFB, 0x07, 0x74, 0x9D, 0x1A, 0xE7, 0x1F, 0xD7, 0xA5, 0xE4, 0xAD, 0xF0, 0x6F, 0xCF,
+    0x4B, 0x60, 0xB3, 0x07, 0x5D, 0x4D, 0x84, 0x49, 0x65, 0x98, 0x73, 0x0E, 0x4D, 0xE8, 0xC0, 0xA5,
+    0xE6, 0x0D, 0x4C, 0x71, 0x52, 0xD4, 0x60, 0xD2, 0x1E, 0x97, 0x54, 0x9D, 0x7A, 0x4E, 0x38, 0xF7,
+    0xF1, 0x80, 0xCE, 0x65, 0xCF, 0x7D, 0x53, 0xCD, 0x97, 0xA2, 0x26, 0x2D, 0x12, 0xD6, 0xC8, 0x86,
+    0xFE, 0x06, 0xD0, 0xF7, 0xA0, 0x42, 0x79, 0x81, 0xC8, 0xFE, 0x1F, 0x88, 0xD6, 0x2F, 0x10, 0xAD,
+    0x33, 0x3C, 0x5A, 0x27, 0x66, 0x9C, 0xE2, 0x83, 0xAE, 0x3A, 0xD3, 0xDC, 0x78, 0xDA, 0xC0, 0x52,
+    0x2A, 0x4E, 0x36, 0x5B, 0x61, 0x80, 0x85, 0xBE, 0xA0, 0x8D, 0xFD, 0x56, 0x51, 0xAF, 0x68, 0x44,
+    0x02, 0x6F, 0x6D, 0xC2, 0xF5, 0xFD, 0x77, 0xB8, 0x03, 0x17, 0x46, 0x32, 0x43, 0xF3, 0x57, 0x95,
+    0xDA, 0x71, 0xA2, 0xEA, 0xC0, 0x91, 0xFE, 0x97, 0x42, 0x67, 0x9E, 0x24, 0x4E, 0xCC, 0xA7, 0x89,
+    0x63, 0xFB, 0x6F, 0x81, 0x95, 0x93, 0x40, 0xF5, 0x7F, 0x86, 0x2E, 0x3B, 0x3E, 0xDA, 0xB4, 0xEB,
+    0xF3, 0x32, 0xEE, 0x7B, 0x11, 0x3A, 0x2B, 0x13, 0x47, 0xAC, 0xDF, 0xBB, 0x89, 0xD7, 0x2B, 0x12,
+    0x69, 0x25, 0x73, 0xC8, 0x31, 0x7B, 0xEC, 0xE3, 0xF1, 0x98, 0x64, 0xA2, 0x1A, 0x54, 0x61, 0x19,
+    0x56, 0x78, 0x99, 0x40, 0x04, 0x25, 0x12, 0xD5, 0x68, 0x0B, 0xA3, 0x1E, 0xB8, 0x64, 0xA2, 0xA7,
+    0xA7, 0x8D, 0x6D, 0xF2, 0xC5, 0x17, 0x3F, 0x98, 0x6B, 0x99, 0x7B, 0xEB, 0x47, 0xB4, 0x92, 0x5D,
+    0xBC, 0x54, 0xC5, 0xA4, 0x8E, 0x85, 0x0D, 0x36, 0x9E, 0x33, 0x7A, 0xDA, 0x30, 0x36, 0xD5, 0x8B,
+    0xB0, 0xDC, 0x54, 0xB5, 0xF9, 0xF3, 0x6D, 0x44, 0x9D, 0x04, 0x2D, 0x23, 0x6D, 0x40, 0xD7, 0x6D,
+    0x75, 0xFF, 0x4C, 0xA2, 0x11, 0x49, 0x4D, 0xE9, 0xC3, 0x23, 0x4E, 0x75, 0x55, 0x83, 0x8F, 0x2E,
+    0xB5, 0x3C, 0x62, 0x29, 0x05, 0xD9, 0xC0, 0x3A, 0xA2, 0xA4, 0xE8, 0xCF, 0x16, 0x26, 0xBD, 0x66,
+    0xE2, 0xBE, 0x0D, 0x27, 0x4E, 0xB2, 0x3F, 0xAB, 0x3B, 0x1C, 0xED, 0xD2, 0xED, 0x73, 0x31, 0x7B,
+    0xB3, 0x2E, 0xA5, 0xAC, 0x37, 0x81, 0xB3, 0xB3, 0xB0, 0x94, 0x7C, 0x08, 0x3E, 0x60, 0x12, 0xBA,
+    0xC2, 0x04, 0x73, 0x68, 0x02, 0x2E, 0x61, 0xB6, 0xCF, 0xE8, 0xB3, 0xC8, 0x7A, 0x62, 0xC7, 0x26,
+    0x95, 0x2F, 0xE8, 0x7C, 0xB0, 0xB1, 0xB2, 0x6A, 0x68, 0x74, 0xB1, 0x69, 0xC6, 0x60, 0x92, 0x88,
+    0x3C, 0x10, 0xA9, 0x95, 0x3D, 0x8F, 0x49, 0x10, 0xB0, 0x82, 0x7B, 0xEF, 0xDC, 0x85, 0xDB, 0x36,
+    0xBE, 0x79, 0x57, 0xE4, 0xD7, 0x9B, 0x8F, 0xBE, 0xBF, 0x82, 0x19, 0xB8, 0xAC, 0x94, 0x48, 0x6A,
+    0xA5, 0xA8, 0x17, 0x51, 0x1E, 0x7D, 0x59, 0x60, 0x1F, 0x4F, 0x0D, 0xCC, 0xDA, 0x77, 0x33, 0xFA,
+    0xEB, 0xFF, 0x1A, 0xA0, 0xE9, 0x4F, 0x81, 0x6F, 0x9F, 0x06, 0x70, 0x92, 0x81, 0xE5, 0x08, 0xB4,
+    0x92, 0xAE, 0x87, 0x20, 0xF3, 0xED, 0xB7, 0x03, 0x6A, 0xB3, 0xEC, 0x13, 0xEB, 0x07, 0xBF, 0x11,
+    0xFA, 0x5F, 0x8B, 0x1F, 0x60, 0x1D, 0x5E, 0xFA, 0x3D, 0x78, 0x8F, 0xD7, 0xD8, 0xC0, 0x0A, 0x13,
+    0x79, 0xFD, 0xA5, 0x46, 0x4B, 0x6E, 0xBF, 0x00, 0x60, 0x97, 0x5E, 0x27, 0x5F, 0x3A, 0xFD, 0x1F,
+    0x36, 0xFE, 0x63, 0x5A, 0x1D, 0x74, 0xDE, 0xDD, 0x8D, 0x5F, 0x97, 0xD5, 0xDE, 0x85, 0xD7, 0x1B,
+    0x6A, 0x1F, 0x0F, 0x4D, 0x35, 0x5B, 0x22, 0xFA, 0xE1, 0x0A, 0x7D, 0x05, 0xB7, 0x7E, 0xC7, 0xFF,
+    0xBC, 0x4D, 0xF6, 0xDD, 0x64, 0x3E, 0x4D, 0xFC, 0x67, 0xE2, 0x9F, 0x13, 0x7D, 0xA2, 0x29, 0xF8,
+    0x09, 0xF3, 0xAB, 0xA4, 0x3F, 0x1F, 0xA9, 0xCB, 0xB8, 0xF0, 0x03, 0xDC, 0x7A, 0x83, 0x7E, 0xE2,
+    0x68, 0x9F, 0xE3, 0x23, 0xCE, 0x8F, 0x29, 0xE7, 0x2A, 0x55, 0x93, 0x8A, 0xF9, 0xEB, 0xEC, 0x4C,
+    0x9A, 0x9B, 0xDF, 0x76, 0x7A, 0x1B, 0x5C, 0xF2, 0xD9, 0x56, 0x3B, 0x9A, 0x51, 0x6F, 0xF4, 0x86,
+    0x6F, 0x1F, 0x4B, 0xF8, 0xCB, 0xFA, 0x4D, 0x3A, 0x58, 0xFC, 0xBC, 0xFA, 0xE6, 0x72, 0xB2, 0x4F,
+    0xAE, 0xE6, 0xBA, 0x6E, 0x9A, 0x30, 0xF6, 0x3E, 0xCD, 0xDC, 0xDD, 0xDA, 0xA2, 0x26, 0xE8, 0xF0,
+    0x1C, 0x62, 0x93, 0x0F, 0xBA, 0x98, 0xC4, 0xA0, 0x2B, 0x0B, 0x46, 0x7A, 0x66, 0xF8, 0xD8, 0x8A,
+    0x24, 0x2F, 0x52, 0xAD, 0xC8, 0xA8, 0x07, 0x4E, 0x99, 0xE8, 0xB9, 0xBF, 0x15, 0x39, 0x70, 0x23,
+    0xCD, 0xDF, 0x27, 0x1F, 0x4E, 0x7C, 0xF0, 0x26, 0x99, 0x4F, 0x32, 0xA5, 0xB2, 0xEA, 0x58, 0xF8,
+    0xBF, 0x79, 0xA4, 0x45, 0x58, 0x0A, 0x2F, 0x5F, 0x93, 0xDC, 0xBD, 0x7B, 0xA1, 0x95, 0x8D, 0xC9,
+    0x3A, 0x77, 0x74, 0x36, 0x99, 0x74, 0xC1, 0x89, 0x0F, 0x2E, 0x54, 0x6A, 0x43, 0xA3, 0x8B, 0xAE,
+    0x33, 0xE6, 0x26, 0x99, 0xCC, 0x2D, 0x57, 0x30, 0xBF, 0x12, 0x90, 0x3F, 0xCD, 0xF4, 0x1C, 0xD1,
+    0x84, 0x1D, 0x5C, 0x32, 0xD1, 0x54, 0x95, 0x99, 0xA8, 0x2C, 0xC3, 0x05, 0xBD, 0x4C, 0x34, 0xEB,
+    0x2B, 0xFC, 0x83, 0x11, 0x9B, 0xAE, 0xF5, 0x77, 0x00, 0x2E, 0xD9, 0x6E, 0x39, 0x2F, 0x64, 0x3B,
+    0x7B, 0x09, 0x13, 0x2E, 0xD1, 0xA1, 0x2A, 0x2E, 0x72, 0x08, 0x13, 0x7A, 0xF3, 0xA1, 0x91, 0xA2,
+    0x6F, 0x26, 0x8E, 0xA5, 0x5C, 0xBD, 0x71, 0x74, 0x87, 0x63, 0xA8, 0x50, 0x51, 0x05, 0x93, 0x31,
+    0x19, 0x9B, 0x70, 0x09, 0x1F, 0xA1, 0xD2, 0xB1, 0x62, 0xC5, 0x82, 0x4A, 0x67, 0x32, 0x33, 0x9B,
+    0x38, 0xF4, 0x91, 0xB6, 0x81, 0xE6, 0x3E, 0xF8, 0x09, 0xFC, 0xB8, 0x55, 0x32, 0x57, 0xB6, 0xA2,
+    0xDD, 0x46, 0x94, 0xC0, 0x72, 0x82, 0x75, 0x81, 0x8F, 0x60, 0xBB, 0x10, 0xBC, 0x2A, 0x57, 0xB4,
+    0x4F, 0x9F, 0x96, 0x43, 0x93, 0xF7, 0x77, 0xA8, 0xD6, 0x71, 0xA9, 0x9F, 0xC4, 0x39, 0xB5, 0xF8,
+    0x70, 0x31, 0xB7, 0x8F, 0x27, 0x2F, 0xB2, 0x51, 0x22, 0x1B, 0x5E, 0x95, 0x67, 0xD0, 0xB0, 0x5D,
+    0x60, 0x4C, 0x01, 0x35, 0x00, 0x77, 0xB6, 0x8D, 0xFF, 0x3D, 0x55, 0x4C, 0x32, 0xA9, 0xC3, 0xDD,
+    0x4D, 0xF8, 0x6E, 0xBB, 0xAE, 0x3D, 0x04, 0x3B, 0xC2, 0x69, 0xC5, 0x3D, 0x29, 0x5C, 0xDA, 0xEC,
+    0x92, 0x4F, 0x2A, 0xDC, 0x52, 0xC5, 0xA4, 0x15, 0xB5, 0xE3, 0xC8, 0xB3, 0x6B, 0xA3, 0xD3, 0xD9,
+    0xA4, 0x4A, 0x39, 0xE2, 0x78, 0x97, 0x03, 0x27, 0xF2, 0x4B, 0x91, 0x0A, 0x27, 0xD0, 0xC1, 0x2B,
+    0xDC, 0xD1, 0xB7, 0xD5, 0x13, 0x7E, 0x9A, 0x8E, 0x3E, 0xDC, 0x3D, 0xF2, 0xEE, 0xE3, 0x74, 0x55,
+    0x38, 0x66, 0x1F, 0x0F, 0xDF, 0x47, 0x85, 0x56, 0x97, 0xCE, 0x94, 0x99, 0x8D, 0x9D, 0x49, 0x2B,
+    0x9B, 0x3A, 0xC7, 0x85, 0x8D, 0xD5, 0x87, 0xD5, 0x0E, 0xD5, 0xAB, 0xDC, 0x50, 0xF6, 0x75, 0xDE,
+    0x35, 0xA9, 0x17, 0x19, 0x8D, 0x88, 0x84, 0xDF, 0xF5, 0x2F, 0x31, 0x22, 0x52, 0xAF, 0x53, 0x69,
+    0xD3, 0xF5, 0x3C, 0x74, 0x8B, 0xBE, 0xB0, 0xCE, 0x98, 0xAD, 0x72, 0x48, 0x76, 0xE1, 0xC4, 0xB3,
+    0xEF, 0xE9, 0xF6, 0xD4, 0xD0, 0x4A, 0xED, 0x25, 0x00, 0x2A, 0x70, 0x4B, 0x55, 0x4C, 0xBA, 0x80,
+    0x32, 0x83, 0x63, 0x0F, 0xFB, 0x56, 0x8A, 0xD7, 0xC5, 0xDB, 0x38, 0xA8, 0x4F, 0x72, 0xC7, 0x79,
+    0xF5, 0x6A, 0xEC, 0xAC, 0x4C, 0x87, 0x5A, 0x46, 0x77, 0x2D, 0x0E, 0xE1, 0x3B, 0x3A, 0x19, 0xB1,
+    0x92, 0x6F, 0x54, 0xA9, 0x3B, 0x50, 0x43, 0x7F, 0x63, 0x1E, 0xD0, 0x92, 0x5D, 0xB8, 0x80, 0x0E,
+    0x0E, 0xF8, 0xFD, 0x53, 0xD6, 0x13, 0x2C, 0x50, 0xC3, 0xCF, 0x7E, 0x50, 0x44, 0x42, 0x3B, 0xFE,
+    0xB6, 0xF6, 0x8E, 0xDC, 0xC4, 0xAE, 0xBF, 0x9B, 0xBC, 0xE7, 0x6D, 0xF3, 0x63, 0x6E, 0xAB, 0x5F,
+    0x46, 0xCB, 0x4F, 0x93, 0x4E, 0x7D, 0xA5, 0xEE, 0x2C, 0x38, 0xB6, 0x9E, 0x85, 0x7E, 0xF2, 0xFC,
+    0x8A, 0xB2, 0xDE, 0xF0, 0xBA, 0x7D, 0xF6, 0xDD, 0xE9, 0x77, 0x62, 0xD7, 0x24, 0xC3, 0x11, 0x6F,
+    0xBB, 0x60, 0xBE, 0xAC, 0xB4, 0x82, 0xFB, 0xDB, 0xA2, 0xCB, 0x8C, 0x85, 0x49, 0x9E, 0x13, 0x93,
+    0xB7, 0xC0, 0x4D, 0xDA, 0xE5, 0x44, 0xA7, 0x6B, 0x17, 0x5E, 0xFE, 0xBB, 0xA2, 0x93, 0xE7, 0x6D,
+    0xCE, 0xBD, 0x88, 0x12, 0xA9, 0xB3, 0xED, 0x8E, 0x3F, 0x07, 0xB3, 0xF9, 0x49, 0x6C, 0xA5, 0xB2,
+    0xDC, 0xF6, 0xE4, 0x7F, 0x03, 0xBD, 0x9B, 0x5D, 0x8C, 0x1D, 0x47, 0x76, 0xDF, 0x7F, 0x55, 0xC5,
+    0x61, 0x49, 0x6C, 0x71, 0x8A, 0x0E, 0x28, 0x43, 0x58, 0x91, 0x6C, 0x3D, 0xE8, 0x81, 0x76, 0x86,
+    0xD3, 0x72, 0xC0, 0x07, 0x1A, 0xB9, 0x33, 0x5D, 0xDA, 0x05, 0xE2, 0xC4, 0x76, 0xB2, 0x44, 0x20,
+    0x2A, 0xC0, 0x3A, 0x58, 0xEB, 0xC1, 0x08, 0x64, 0x39, 0x8E, 0x26, 0xC8, 0x20, 0x19, 0xDB, 0x43,
+    0xDE, 0x92, 0xF4, 0x90, 0x04, 0x46, 0xB2, 0x63, 0x38, 0x6B, 0x07, 0x79, 0x31, 0x11, 0xC8, 0x88,
+    0xC4, 0x3C, 0x88, 0x46, 0x08, 0x98, 0x06, 0x86, 0xBC, 0xB5, 0x56, 0x82, 0x7D, 0x30, 0x02, 0xB7,
+    0xBD, 0x30, 0x16, 0xC8, 0xCB, 0xF6, 0xEE, 0x6A, 0xB3, 0x1F, 0x7E, 0x50, 0x69, 0xDD, 0x8E, 0x5B,
+    0xDA, 0xBE, 0xF7, 0xE4, 0xA1, 0xFA, 0xCE, 0x07, 0xC5, 0x35, 0x64, 0x7B, 0x77, 0xFB, 0xE1, 0x76,
+    0xDF, 0xAF, 0xAE, 0x53, 0xA7, 0x4E, 0x9D, 0xF3, 0x3F, 0xFF, 0x73, 0x1A, 0xCC, 0x60, 0x7A, 0xD3,
+    0x99, 0x04, 0xEA, 0xAA, 0x6D, 0x6C, 0x2C, 0xA2, 0x0B, 0xCE, 0x3B, 0x4A, 0xD6, 0xB9, 0xC4, 0x84,
+    0x09, 0x3B, 0x6C, 0x73, 0x9B, 0x33, 0xC0, 0x0B, 0x98, 0xC0, 0x69, 0xD8, 0xA2, 0xEA, 0x8C, 0x34,
+    0x9B, 0x5B, 0xFA, 0xDB, 0xD1, 0xAD, 0xB2, 0x7B, 0x59, 0x7F, 0x39, 0xBA, 0xFF, 0x48, 0x7D, 0x99,
+    0xD9, 0x37, 0x90, 0x9E, 0x59, 0x4B, 0xA4, 0xE0, 0xF8, 0xA1, 0x66, 0x1E, 0x2B, 0x3D, 0xB6, 0xB5,
+    0xE8, 0x06, 0x48, 0xC0, 0x04, 0x70, 0x80, 0x89, 0xC0, 0x6D, 0x60, 0x0D, 0x10, 0x69, 0xA8, 0x25,
+    0x41, 0x07, 0xEC, 0x82, 0x9A, 0x83, 0x7D, 0x1F, 0xB4, 0x48, 0x8F, 0x88, 0x00, 0x30, 0xF9, 0xC7,
+    0x4D, 0x25, 0x9D, 0x69, 0x92, 0x89, 0x6B, 0x24, 0xC7, 0x46, 0x19, 0x2A, 0x69, 0x6A, 0x19, 0xDC,
+    0xCA, 0x79, 0x00, 0xE5, 0x39, 0x6B, 0x1A, 0x3A, 0x95, 0x4C, 0xC3, 0x50, 0x7A, 0xEE, 0x5D, 0x87,
+    0xBA, 0x83, 0xAA, 0x81, 0x32, 0xA0, 0xDE, 0x1A, 0x70, 0xF2, 0x06, 0x6C, 0x02, 0xD7, 0x81, 0x7D,
+    0xA8, 0xA5, 0xE5, 0x9F, 0x2D, 0xF6, 0xD0, 0x09, 0x4C, 0x1A, 0xE5, 0x7E, 0x94, 0xC7, 0x58, 0xE3,
+    0x0A, 0x97, 0xD9, 0xE2, 0x6A, 0xFE, 0x48, 0x7B, 0x43, 0xC1, 0x2A, 0xA7, 0x39, 0xC7, 0x45, 0x2E,
+    0x03, 0x65, 0x0B, 0xBF, 0xF7, 0xCF, 0x51, 0xF1, 0x04, 0xC6, 0xE7, 0xE9, 0x94, 0x12, 0x98, 0xBD,
+    0x95, 0x54, 0xA2, 0xD3, 0x91, 0x6D, 0x13, 0x49, 0x7A, 0xF1, 0xF7, 0x12, 0x33, 0x89, 0xA8, 0x05,
+    0x30, 0x70, 0x42, 0x0D, 0x54, 0xD2, 0x33, 0x93, 0x96, 0x1F, 0xFD, 0x26, 0x38, 0xFD, 0xED, 0xB4,
+    0x59, 0xDB, 0x2F, 0x5F, 0x7D, 0x4E, 0xBD, 0x49, 0x7F, 0xE6, 0x12, 0xAF, 0x86, 0x47, 0x5E, 0x54,
+    0x1F, 0xEF, 0x5E, 0x78, 0xFA, 0x22, 0x3F, 0x0F, 0xA8, 0x6F, 0x9C, 0x3A, 0xF7, 0xD8, 0xB9, 0xA7,
+    0x2F, 0x5E, 0xDE, 0xAE, 0xBA, 0x53, 0x7E, 0xF6, 0xE6, 0x4F, 0xC9, 0x1C, 0x13, 0x99, 0x60, 0x03,
+    0x77, 0xA0, 0x90, 0x85, 0x48, 0xC3, 0x2D, 0x36, 0x1E, 0x59, 0x3D, 0xFB, 0x43, 0x2F, 0xAB, 0xBF,
+    0xF5, 0xD4, 0x2B, 0xBF, 0x7E, 0xF6, 0xF4, 0xC7, 0xF8, 0x18, 0x30, 0x5D, 0xE4, 0x45, 0x98, 0x53,
+    0xDF, 0x37, 0xCD, 0xDA, 0x05, 0x6E, 0x77, 0xE6, 0xED, 0x66, 0xBD, 0xF8, 0x62, 0x2A, 0xC5, 0x97,
+    0x2D, 0x70, 0x06, 0x26, 0xB0, 0x0A, 0x05, 0x46, 0x24, 0xA8, 0x16, 0xB6, 0x60, 0x02, 0x8F, 0xE6,
+    0x49, 0x3F, 0xCE, 0x4C, 0xE2, 0x59, 0xE0, 0xE4, 0xCD, 0x33, 0x8D, 0xE1, 0xA2, 0x89, 0x3B, 0x66,
+    0x58, 0xB9, 0xAA, 0x6F, 0xF2, 0x08, 0x4F, 0x98, 0x96, 0x2D, 0x9E, 0xF9, 0xD1, 0xB6, 0x0E, 0x70,
+    0xA5, 0x50, 0xCD, 0x04, 0x26, 0xEC, 0xAA, 0xA4, 0x5B, 0x1B, 0x9C, 0xDF, 0x60, 0x42, 0x52, 0xA9,
+    0x88, 0x45, 0xA8, 0xD9, 0x50, 0xBD, 0x4E, 0xC5, 0x42, 0x62, 0x2D, 0xA2, 0xBE, 0x24, 0xFD, 0x6A,
+    0xF5, 0xD5, 0xE6, 0x19, 0x50, 0x01, 0xE0, 0xE4, 0xDE, 0x9E, 0x19, 0x4E, 0x23, 0x9F, 0x8B, 0x65,
+    0xB7, 0xA6, 0xC5, 0x84, 0x32, 0x5D, 0x66, 0x6E, 0xB1, 0xF1, 0x36, 0xC3, 0x2A, 0xA5, 0x6F, 0x4C,
+    0x3A, 0x47, 0xAD, 0x63, 0xD1, 0x5C, 0x61, 0x30, 0xBE, 0x8A, 0x5B, 0xA6, 0x2B, 0x98, 0xD1, 0xB2,
+    0x62, 0xDF, 0x7E, 0x6F, 0x80, 0xF0, 0x23, 0x3C, 0x61, 0x7F, 0xAA, 0x81, 0x35, 0x15, 0x9F, 0x36,
+    0x3C, 0x73, 0xCA, 0x0C, 0x8F, 0x7B, 0xDD, 0x3D, 0xFA, 0xD8, 0xB9, 0xC7, 0x9E, 0x7E, 0xEC, 0xE2,
+    0xC5, 0x32, 0x9D, 0xF4, 0x90, 0xED, 0x8A, 0xBF, 0x0D, 0xE8, 0xC0, 0x09, 0x1A, 0x4E, 0xB1, 0x45,
+    0xC1, 0x1A, 0x05, 0xAB, 0x58, 0xAC, 0xB7, 0x94, 0x73, 0xEB, 0x9D, 0x18, 0xEF, 0x31, 0x61, 0x0B,
+    0x13, 0x76, 0x31, 0xF1, 0x57, 0x30, 0xF1, 0x5F, 0x07, 0x1D, 0xB7, 0x1B, 0xDD, 0x6C, 0xFC, 0x9E,
+    0x6E, 0xCE, 0xD6, 0xCF, 0xB6, 0x38, 0x6E, 0x62, 0x83, 0xBA, 0x0D, 0xFC, 0x5D, 0x80, 0x9B, 0x58,
+    0x4E, 0x43, 0xA3, 0x22, 0x97, 0x59, 0x63, 0x15, 0x13, 0x74, 0x64, 0x9B, 0x2D, 0xA6, 0xDD, 0x85,
+    0x99, 0x13, 0xF3, 0x4B, 0x6B, 0xD0, 0xAA, 0xC8, 0x84, 0x35, 0x0A, 0x4C, 0xD0, 0x0D, 0x89, 0x6D,
+    0x76, 0xB9, 0x40, 0x8D, 0x89, 0x2E, 0x92, 0x8C, 0xB4, 0x13, 0xEA, 0xB9, 0x02, 0xB2, 0xB1, 0x9C,
+    0xB9, 0x08, 0xA8, 0xA0, 0x22, 0x5B, 0x6C, 0xE9, 0x39, 0xA7, 0x51, 0xD1, 0x78, 0x56, 0x69, 0xA1,
+    0x9D, 0x70, 0x66, 0xAD, 0xC0, 0xC8, 0xAB, 0xF1, 0xCC, 0xB4, 0xD9, 0xB6, 0x70, 0x5E, 0x25, 0x4C,
+    0xF8, 0x15, 0x48, 0xE7, 0x6F, 0x32, 0xB1, 0xFF, 0x10, 0xC7, 0xFF, 0x7B, 0x47, 0x37, 0x8F, 0x4F,
+    0xFD, 0x5D, 0x4C, 0x3C, 0x05, 0x3B, 0x80, 0x6B, 0x60, 0x00, 0xE7, 0x19, 0xED, 0x5A, 0x5D, 0x85,
+    0x1B, 0x50, 0xE4, 0xCF, 0xCB, 0x40, 0xD1, 0x61, 0x7A, 0x18, 0x60, 0x13, 0x8A, 0x08, 0x1D, 0x94,
+    0xA0, 0x5B, 0x58, 0x07, 0xD5, 0xD9, 0xE8, 0xA4, 0xA3, 0xEC, 0x96, 0x5B, 0xFC, 0xCE, 0x45, 0x28,
+    0x9E, 0x69, 0xE0, 0xF2, 0x7F, 0x03, 0x15, 0xBB, 0xA3, 0xDB, 0xDF, 0x05, 0x60, 0x06, 0x98, 0x01,
+    0xD8, 0x4C, 0xA0, 0xFE, 0x2C, 0x82, 0x73, 0x1E, 0xEE, 0x6E, 0x80, 0x8D, 0x1D, 0x6C, 0x98, 0x16,
+    0x9D, 0x5C, 0xA0, 0xA4, 0x82, 0x9E, 0x7D, 0x8A, 0x0F, 0xFE, 0x7B, 0xA2, 0x16, 0x89, 0x46, 0x44,
+    0x7C, 0xE9, 0xB9, 0xC7, 0x80, 0xEE, 0x5D, 0x43, 0xD1, 0x02, 0xA7, 0x02, 0xE8, 0x47, 0x80, 0x67,
+    0xE2, 0x91, 0x2D, 0x7B, 0x6C, 0x50, 0x3D, 0x00, 0x75, 0x04, 0xB7, 0x3F, 0x8E, 0x39, 0xD9, 0x80,
+    0xE2, 0xB5, 0x06, 0x95, 0x36, 0xF2, 0x90, 0x45, 0xDC, 0x44, 0x25, 0x9D, 0xD8, 0xA4, 0xCA, 0x23,
+    0x8A, 0x08, 0xB5, 0x48, 0x67, 0x1B, 0x2A, 0x3F, 0xA0, 0xFB, 0xDA, 0x53, 0x05, 0x00, 0x56, 0x9E,
+    0x03, 0x0A, 0x91, 0x01, 0x28, 0x45, 0x7A, 0xA0, 0xEE, 0x01, 0xF8, 0x8B, 0x0E, 0xC0, 0x7C, 0x21,
+    0x01, 0x14, 0xFF, 0xB6, 0x05, 0x28, 0xED, 0xD7, 0x5E, 0x04, 0x76, 0xAD, 0x0C, 0x40, 0x2A, 0xA4,
+    0x07, 0xD3, 0xB8, 0x08, 0x14, 0xC1, 0x45, 0xA0, 0xBA, 0x35, 0x8B, 0xC0, 0x54, 0x24, 0x02, 0x22,
+    0xF2, 0xAD, 0x37, 0x30, 0x89, 0xA9, 0xCC, 0x71, 0x91, 0x99, 0xCC, 0xA9, 0x3C, 0x22, 0xF3, 0x83,
+    0x49, 0x95, 0x8B, 0x3D, 0x98, 0x49, 0x87, 0x11, 0xE9, 0x70, 0x94, 0x89, 0x7D, 0x8A, 0xC6, 0xB4,
+    0xB8, 0xE8, 0x3C, 0x35, 0xBB, 0x30, 0x4C, 0xA5, 0x35, 0x7F, 0x26, 0xE2, 0x5D, 0xBC, 0x0E, 0xF7,
+    0x55, 0xC2, 0x74, 0x45, 0x64, 0x1A, 0xEB, 0xE7, 0xDF, 0x9A, 0x23, 0x22, 0xAD, 0x15, 0x59, 0x50,
+    0x89, 0x34, 0x88, 0xEC, 0x1D, 0x6A, 0xAC, 0xBF, 0x08, 0x7C, 0xF5, 0x9F, 0x02, 0x5B, 0xD7, 0x8F,
+    0xA9, 0x52, 0x4B, 0x0B, 0x85, 0x88, 0xC7, 0xBD, 0x53, 0x24, 0x5C, 0xCB, 0x1C, 0xD7, 0x50, 0x06,
+    0xDB, 0x62, 0x5A, 0x93, 0xA0, 0xA7, 0x83, 0x0D, 0xF6, 0xC1, 0xF9, 0x4D, 0x28, 0xA2, 0x0B, 0x98,
+    0xD6, 0xB4, 0xE8, 0x8E, 0x01, 0x3D, 0x50, 0x7F, 0xF3, 0x17, 0xE6, 0x38, 0x91, 0x05, 0x5A, 0x44,
+    0xA0, 0x96, 0x05, 0xA8, 0x59, 0xBF, 0x1C, 0xC2, 0xBE, 0xDA, 0xAC, 0x27, 0x06, 0xAA, 0xC6, 0xBD,
+    0xA5, 0xF7, 0xDE, 0x58, 0x7E, 0xFC, 0xB1, 0x83, 0x89, 0xFB, 0xBF, 0xC2, 0x85, 0x0B, 0xC7, 0x2F,
+    0x0A, 0xF9, 0xD9, 0x7C, 0x51, 0x89, 0xE4, 0x8B, 0x7A, 0xAF, 0x8A, 0xF9, 0x22, 0xB8, 0x6C, 0xAA,
+    0xB5, 0x77, 0xD9, 0x4D, 0x96, 0xC1, 0xFD, 0x61, 0x00, 0x70, 0xD1, 0xBD, 0xDD, 0x42, 0x5E, 0xB3,
+    0x0E, 0x40, 0x27, 0x17, 0x37, 0xB2, 0xAA, 0x5C, 0xAC, 0x00, 0xD8, 0x74, 0x31, 0x0F, 0xE2, 0x3E,
+    0x13, 0x8B, 0x06, 0xC0, 0x48, 0x53, 0x64, 0x63, 0x94, 0xAF, 0xBD, 0x35, 0xDE, 0x3B, 0x9B, 0x0A,
+    0xB8, 0x6C, 0x3A, 0xE0, 0x0E, 0x3E, 0xF9, 0xBF, 0xD2, 0xE6, 0x8B, 0x76, 0x29, 0xF3, 0x77, 0xBF,
+    0x28, 0x0E, 0x2E, 0xD2, 0x83, 0x9F, 0xAC, 0x1C, 0x59, 0x2E, 0xE3, 0xE1, 0x0A, 0xE8, 0x08, 0xE7,
+    0x79, 0xF8, 0x61, 0x1A, 0xDC, 0x27, 0x03, 0x7D, 0x4D, 0x11, 0xF7, 0xB9, 0xA7, 0x7A, 0xDB, 0x9A,
+    0x54, 0xE3, 0xDE, 0x4E, 0xD4, 0x53, 0xCF, 0xAC, 0x47, 0x49, 0xC4, 0x0C, 0xD9, 0x53, 0x4C, 0x41,
+    0xF7, 0xF9, 0x72, 0x96, 0x37, 0x71, 0x35, 0x8E, 0x7B, 0x09, 0x1C, 0x98, 0xF7, 0x51, 0x92, 0xE8,
+    0x6A, 0x26, 0xBA, 0x2D, 0x99, 0x14, 0xC1, 0x99, 0xA6, 0x08, 0xA9, 0x8C, 0xBB, 0x2F, 0x87, 0x4A,
+    0xBC, 0xFB, 0x26, 0x26, 0xA2, 0xDA, 0x1C, 0xD5, 0xB3, 0xE0, 0x73, 0xE8, 0xCE, 0xE1, 0xB8, 0xCC,
+    0x36, 0x7B, 0x26, 0xDE, 0xC0, 0x19, 0xCF, 0xCE, 0x45, 0x74, 0xD3, 0xE0, 0x74, 0x64, 0xD7, 0x36,
+    0xBA, 0xB5, 0xD1, 0xF9, 0xC2, 0xEF, 0x72, 0x49, 0xFF, 0xD9, 0xCF, 0x24, 0xF7, 0x25, 0xF1, 0x9B,
+    0xD3, 0x16, 0x74, 0xBB, 0xC5, 0xBF, 0x39, 0xC5, 0xEA, 0xF9, 0x48, 0x73, 0x17, 0x80, 0x97, 0xFF,
+    0x3D, 0x95, 0x34, 0x45, 0xD8, 0x57, 0xAD, 0x89, 0x13, 0x76, 0xAD, 0xB7, 0xE1, 0x36, 0xBD, 0xA3,
+    0xF2, 0x7D, 0x99, 0x9C, 0x08, 0xD3, 0x45, 0x52, 0x8B, 0x4F, 0x03, 0xEB, 0xB0, 0x72, 0x16, 0xDE,
+    0xCE, 0xBE, 0x2E, 0x1F, 0x27, 0xFB, 0x3D, 0x2D, 0x73, 0xEE, 0x16, 0xF1, 0x02, 0x13, 0x13, 0x6D,
+    0xDC, 0x66, 0xA7, 0xC0, 0x85, 0xA4, 0x3B, 0xF7, 0x8A, 0x20, 0x92, 0xAC, 0xBC, 0x4B, 0xF9, 0xB5,
+    0x16, 0xE0, 0x2C, 0x3C, 0xF9, 0x15, 0x37, 0x47, 0x8B, 0x74, 0xE7, 0x58, 0xD7, 0x0B, 0xAE, 0xA8,
+    0xD6, 0xB4, 0x3F, 0xDC, 0x3A, 0x4A, 0x91, 0xB0, 0xCD, 0xF4, 0xD6, 0x73, 0x3A, 0x9A, 0x16, 0x1C,
+    0x55, 0x80, 0x4D, 0x2B, 0xFE, 0x04, 0x22, 0xF2, 0x9D, 0xA4, 0xE4, 0x3B, 0x22, 0x51, 0x2D, 0x3E,
+    0xFD, 0x72, 0x0F, 0x28, 0x80, 0x1A, 0xE0, 0x0E, 0x58, 0x11, 0x98, 0x49, 0x0B, 0x17, 0xE0, 0x87,
+    0x9F, 0x8D, 0x94, 0x8B, 0x09, 0xB6, 0xF9, 0x5D, 0x4F, 0x32, 0x89, 0x75, 0x36, 0x30, 0xD1, 0x44,
+    0x26, 0xEC, 0x60, 0x9A, 0x12, 0xEA, 0x77, 0x1B, 0x94, 0x74, 0x60, 0x7B, 0x00, 0xDD, 0xBE, 0xC0,
+    0xFF, 0xF8, 0x0F, 0x9C, 0x76, 0x11, 0x7F, 0x1C, 0x78, 0x05, 0x66, 0x0B, 0xD6, 0x49, 0x45, 0xB0,
+    0x21, 0xB1, 0x7D, 0x81, 0xE2, 0xE3, 0x0D, 0xE9, 0x12, 0x17, 0x74, 0x2A, 0x9A, 0x52, 0x7A, 0x64,
+    0x81, 0x5E, 0x64, 0xD0, 0xC4, 0x3E, 0xB8, 0x88, 0x3E, 0xD8, 0x95, 0x2B, 0xCF, 0xDF, 0x7A, 0x6D,
+    0x34, 0xD9, 0x15, 0xA0, 0x83, 0xCA, 0x1F, 0xB8, 0x5A, 0x05, 0x60, 0x02, 0xA0, 0x22, 0x40, 0xCB,
+    0x88, 0xE3, 0xB8, 0xC2, 0x88, 0xE6, 0xB2, 0xFD, 0x39, 0x00, 0xEB, 0x41, 0xCD, 0x22, 0x68, 0x19,
+    0x40, 0xB7, 0xE2, 0xD1, 0xED, 0xEF, 0xB4, 0x90, 0x76, 0x76, 0x60, 0x67, 0x72, 0x09, 0x2E, 0x5D,
+    0x70, 0xE0, 0x3E, 0x69, 0x03, 0xFA, 0x3B, 0xBF, 0xDA, 0x8C, 0xEA, 0x70, 0xD2, 0x82, 0x92, 0xC0,
+    0x68, 0x3C, 0xBB, 0x8C, 0xD0, 0x91, 0xF5, 0x83, 0x7B, 0x17, 0x61, 0x09, 0x23, 0x4D, 0x0B, 0xA8,
+    0x16, 0x20, 0x1C, 0x33, 0xF8, 0x2B, 0x59, 0x36, 0xD5, 0x8C, 0x3F, 0xFC, 0xEE, 0x47, 0x62, 0xC2,
+    0x1D, 0xEE, 0xB0, 0x4B, 0x62, 0x62, 0x1A, 0x36, 0x6C, 0x64, 0xDD, 0x05, 0xAA, 0x12, 0xCA, 0x1B,
+    0xE0, 0x06, 0x70, 0x7D, 0xDE, 0x83, 0x45, 0x0B, 0x2E, 0x42, 0x15, 0x50, 0x02, 0xD3, 0x01, 0x66,
+    0x2D, 0xBC, 0x39, 0x2A, 0xCC, 0x04, 0x54, 0x03, 0xB7, 0xA1, 0xDE, 0xC3, 0xDD, 0xC7, 0x7E, 0xBC,
+    0xD5, 0x71, 0x42, 0xB2, 0x5C, 0x51, 0xF1, 0x3C, 0x6D, 0xC1, 0x6D, 0x13, 0xEF, 0xD2, 0xF6, 0x4C,
+    0x3B, 0xAA, 0x16, 0x77, 0xF4, 0x2F, 0x13, 0x00, 0xAE, 0xAE, 0xA0, 0x52, 0x85, 0x49, 0x9B, 0xD8,
+    0x74, 0xFF, 0xFB, 0x26, 0x2C, 0xEA, 0xF9, 0x37, 0xC0, 0x8D, 0xDE, 0xE9, 0xD8, 0xD1, 0x33, 0xC6,
+    0x51, 0x33, 0x90, 0x03, 0x29, 0xE5, 0x84, 0x1C, 0x49, 0xB9, 0xBB, 0x41, 0x0E, 0xA5, 0xA6, 0xD9,
+    0x84, 0x22, 0x6E, 0x92, 0xC3, 0xF7, 0x26, 0x15, 0xCC, 0x6E, 0xCD, 0x40, 0x44, 0x30, 0x22, 0xE2,
+    0x6D, 0x43, 0xE5, 0x5D, 0xA4, 0x0A, 0x39, 0x9E, 0xAE, 0x7C, 0xEA, 0x26, 0x33, 0x39, 0xBA, 0x07,
+    0x99, 0x89, 0x2F, 0xC2, 0x3E, 0x3B, 0x24, 0x13, 0x6D, 0x3C, 0xCF, 0x05, 0x6E, 0xD3, 0x9B, 0x58,
+    0x34, 0xEE, 0x15, 0xA1, 0x96, 0x81, 0xE9, 0x22, 0x31, 0xFD, 0xCD, 0xE5, 0xCA, 0x1A, 0xCE, 0x81,
+    0x09, 0xDB, 0x60, 0xA4, 0x05, 0xEE, 0xF3, 0x83, 0x93, 0x1E, 0xE0, 0x32, 0x91, 0x74, 0x01, 0x2D,
+    0x2D, 0xFA, 0x30, 0x44, 0xAB, 0xFB, 0x4F, 0x53, 0x49, 0xA3, 0xDB, 0x8A, 0x0B, 0x19, 0xFB, 0x5A,
+    0x6F, 0xC3, 0x1A, 0x9B, 0x24, 0xDD, 0x99, 0x76, 0x1A, 0x9D, 0x08, 0xA5, 0xEC, 0x2F, 0xFD, 0x49,
+    0x3F, 0x62, 0xA3, 0x3A, 0x66, 0x68, 0x54, 0x4E, 0x32, 0x32, 0x2A, 0x5E, 0x6B, 0xB0, 0xB1, 0xC3,
+    0x34, 0x9B, 0xE8, 0xE4, 0x82, 0x4A, 0x3A, 0xD1, 0xB3, 0xCF, 0xEC, 0xD6, 0x8C, 0x5A, 0x24, 0xD6,
+    0x22, 0x5D, 0xE9, 0xB9, 0xE7, 0x22, 0xD5, 0x67, 0x32, 0x26, 0xB2, 0x1E, 0xEC, 0x18, 0x01, 0xB8,
+    0xB7, 0xDC, 0xA3, 0x1F, 0xD9, 0x3F, 0xDE, 0x80, 0xD5, 0xBC, 0x9B, 0x5D, 0x84, 0x13, 0x07, 0x53,
+    0xBA, 0x0D, 0x9C, 0x5B, 0x6E, 0xF6, 0xF4, 0x5D, 0x77, 0xCE, 0x49, 0x09, 0x58, 0x19, 0xD0, 0x8B,
+    0xE7, 0x03, 0x0B, 0xA0, 0xF6, 0x39, 0x68, 0xA8, 0x6E, 0xF4, 0x74, 0xB6, 0x01, 0x06, 0xF2, 0xFD,
+    0xD5, 0x00, 0x94, 0x1D, 0x67, 0x94, 0x7C, 0xF0, 0x16, 0xA5, 0x48, 0x8B, 0xC8, 0x1C, 0x2B, 0x12,
+    0x29, 0xE4, 0x1B, 0x47, 0xA3, 0x55, 0x40, 0x47, 0x54, 0x73, 0x7C, 0xF0, 0x27, 0x3B, 0xEA, 0x39,
+    0x35, 0x54, 0xE0, 0xC0, 0x46, 0x74, 0x0B, 0x77, 0xA1, 0x86, 0xE2, 0x83, 0x80, 0xF4, 0x14, 0x8B,
+    0xA3, 0xF2, 0xAD, 0x92, 0xE3, 0x18, 0xDB, 0xB7, 0xE1, 0xB4, 0x6A, 0x7E, 0x20, 0xE2, 0xB7, 0x50,
+    0x79, 0xEC, 0xA7, 0xA1, 0x39, 0x77, 0x44, 0x72, 0x27, 0xDE, 0xA4, 0xEC, 0x70, 0x41, 0x25, 0x58,
+    0xCF, 0xD8, 0xBA, 0x06, 0xBD, 0xB8, 0x89, 0x93, 0x40, 0x75, 0xE0, 0x86, 0xEF, 0x2E, 0xE1, 0x6C,
+    0x07, 0x3C, 0xFE, 0x03, 0xD4, 0xFD, 0x73, 0x98, 0x96, 0xD2, 0x73, 0x68, 0xDD, 0x27, 0xE7, 0x48,
+    0xE7, 0x22, 0xFB, 0x98, 0x48, 0x09, 0x77, 0xD1, 0x2D, 0x2E, 0x52, 0x7D, 0x8B, 0x7A, 0xB1, 0x14,
+    0xF9, 0x99, 0x93, 0xA0, 0xBF, 0x10, 0x46, 0xE4, 0xB2, 0xF3, 0xDD, 0x7D, 0xED, 0xCB, 0x3D, 0x4C,
+    0x25, 0x52, 0x7D, 0xED, 0x45, 0x5C, 0x0B, 0xA6, 0x03, 0xE6, 0x23, 0x94, 0x33, 0x69, 0xCC, 0xCE,
+    0x5D, 0x1C, 0x25, 0x2F, 0x23, 0x28, 0xF1, 0x8A, 0x52, 0x6E, 0x25, 0x25, 0xB2, 0xC0, 0x89, 0x34,
+    0x4C, 0x65, 0x80, 0xD9, 0xE2, 0xD0, 0xE1, 0x9F, 0xD3, 0x41, 0x7F, 0x31, 0x50, 0x7B, 0xAC, 0xFF,
+    0x9B, 0x18, 0x4C, 0x73, 0x0E, 0xD4, 0x17, 0x97, 0x8A, 0x37, 0xFE, 0x41, 0xF1, 0x1F, 0x82, 0xC6,
+    0x77, 0x47, 0x34, 0x1E, 0x0E, 0xD0, 0xB8, 0x4E, 0x98, 0xE4, 0x02, 0x2E, 0x6E, 0xC0, 0x8D, 0x8F,
+    0x84, 0xC6, 0x57, 0x01, 0xCE, 0x9F, 0x00, 0x26, 0xE7, 0x80, 0xC9, 0x04, 0xD8, 0xBE, 0x02, 0xA4,
+    0x3B, 0x14, 0x5D, 0xBA, 0xCA, 0x74, 0xDE, 0xA2, 0xBA, 0xAA, 0xC9, 0x19, 0xA3, 0xC3, 0x05, 0x2E,
+    0x50, 0x7A, 0x2E, 0x51, 0xC1, 0x06, 0x53, 0xA8, 0x7F, 0x63, 0x01, 0x95, 0xCC, 0x47, 0xA7, 0xAE,
+    0x17, 0x93, 0xEF, 0x77, 0x0A, 0xB1, 0x0A, 0xB0, 0x9D, 0xB1, 0x25, 0x4E, 0xE6, 0x64, 0x1E, 0x47,
+    0x47, 0x98, 0x7D, 0x12, 0x4A, 0xD9, 0xC9, 0x22, 0x3B, 0x6A, 0x48, 0xF4, 0xD8, 0x60, 0x9B, 0x2C,
+    0x71, 0xA7, 0x06, 0xCC, 0xFB, 0x2F, 0xB7, 0x63, 0x8E, 0x21, 0x03, 0x14, 0xFD, 0x71, 0x3F, 0x63,
+    0x65, 0x80, 0x5B, 0x9F, 0x3D, 0xBA, 0x04, 0x8F, 0x5F, 0xC5, 0x89, 0xA0, 0x44, 0x5A, 0xD6, 0xC7,
+    0x71, 0xD9, 0x25, 0x67, 0xAB, 0xBC, 0xFF, 0x29, 0x70, 0x92, 0x50, 0xB2, 0xC8, 0x3C, 0xCF, 0xF1,
+    0xAF, 0x17, 0xB7, 0x6E, 0x52, 0x8A, 0x78, 0x2D, 0xD2, 0x51, 0x8B, 0x8C, 0x37, 0xAE, 0xA5, 0x51,
+    0xB7, 0x3E, 0x7B, 0x6C, 0xE4, 0x13, 0x60, 0x05, 0x7E, 0xAF, 0xA0, 0xF0, 0xA7, 0xD9, 0x59, 0xB9,
+    0x63, 0x44, 0xDA, 0xF2, 0x5B, 0x9F, 0xE5, 0x4E, 0xBE, 0x67, 0xD1, 0x28, 0x4A, 0x19, 0xA8, 0xA4,
+    0xE5, 0xC9, 0xF7, 0x0F, 0xE4, 0x65, 0x0D, 0x76, 0xAC, 0xC7, 0x48, 0x73, 0x04, 0xA6, 0x1F, 0x46,
+    0x89, 0x6B, 0x20, 0x92, 0x28, 0x65, 0x81, 0x6E, 0x81, 0x0D, 0xC0, 0xC6, 0xCC, 0x45, 0xE1, 0x3E,
+    0x7B, 0x13, 0x44, 0xA0, 0x94, 0x36, 0x63, 0x9A, 0xE3, 0x5F, 0x7F, 0xEB, 0x16, 0x4A, 0xA4, 0xA3,
+    0x12, 0xF1, 0x46, 0xA4, 0x5B, 0x62, 0x9C, 0x48, 0x72, 0x28, 0x49, 0xA8, 0xF9, 0x87, 0xF6, 0x9A,
+    0x02, 0x25, 0x91, 0xF5, 0x8F, 0x47, 0xDD, 0x18, 0x7F, 0x41, 0xFD, 0x22, 0x22, 0xBD, 0xFD, 0xE0,
+    0xB7, 0xFD, 0xA5, 0x0C, 0xAD, 0x74, 0x87, 0xB7, 0x22, 0x14, 0xD2, 0x73, 0x72, 0xE1, 0x21, 0x53,
+    0x03, 0x1B, 0x40, 0xB5, 0xDC, 0x84, 0x47, 0x8F, 0x95, 0xE7, 0x70, 0x22, 0x58, 0x91, 0xA0, 0x5B,
+    0x0E, 0x08, 0xBB, 0xFC, 0xE3, 0xCF, 0xDE, 0xC4, 0xC8, 0x90, 0x95, 0xDF, 0x8F, 0x77, 0x29, 0x47,
+    0xDD, 0x9B, 0x0F, 0x6E, 0x05, 0x25, 0xD2, 0x31, 0x93, 0xF9, 0x52, 0xF5, 0x2B, 0xE0, 0x02, 0xB6,
+    0x3D, 0x82, 0x3D, 0xC7, 0xC3, 0x63, 0x85, 0x62, 0xEF, 0x76, 0xE1, 0x4F, 0xDB, 0xF0, 0x33, 0x9F,
+    0x10, 0xF9, 0xF2, 0xE2, 0xCD, 0xAB, 0x77, 0x60, 0x03, 0x8A, 0x46, 0x29, 0x91, 0x58, 0x49, 0xAB,
+    0x66, 0x7B, 0x59, 0xA7, 0x46, 0x24, 0x2A, 0x91, 0x96, 0xBB, 0x0F, 0x0E, 0xFA, 0xB5, 0x17, 0xB3,
+    0x46, 0xA7, 0x12, 0xD8, 0x24, 0x53, 0x1F, 0x36, 0x82, 0x4E, 0xA3, 0x35, 0x4C, 0x65, 0x4E, 0x25,
+    0xE2, 0x9D, 0x48, 0x83, 0x09, 0xA0, 0x03, 0xF0, 0xCE, 0xF8, 0xD3, 0xBF, 0x5C, 0x98, 0x4B, 0x0F,
+    0x0A, 0x73, 0x1E, 0xCE, 0xC1, 0x63, 0x60, 0xAF, 0xE6, 0x25, 0x03, 0xB8, 0x79, 0x0A, 0xDC, 0xF9,
+    0xD1, 0xC3, 0xAD, 0xF1, 0xFD, 0xD4, 0x67, 0x76, 0x5E, 0xF6, 0xD3, 0x50, 0xF9, 0x11, 0x99, 0x3F,
+    0x60, 0xD3, 0xE5, 0x40, 0xB1, 0x77, 0x5B, 0x37, 0xC6, 0xEF, 0xAC, 0xDC, 0x71, 0x22, 0xAF, 0x2C,
+    0xDE, 0xBC, 0x7A, 0x29, 0x5B, 0x74, 0xE5, 0x4F, 0x28, 0x91, 0x58, 0x48, 0x3F, 0x1A, 0xF4, 0x15,
+    0x40, 0xF5, 0xC0, 0xEA, 0x1A, 0xD0, 0x1C, 0x4D, 0x2A, 0x4F, 0xCE, 0xE6, 0x28, 0x91, 0x9E, 0xEA,
+    0x1D, 0xCE, 0xA8, 0xF9, 0xD2, 0x50, 0xEE, 0x33, 0xFA, 0xEF, 0x32, 0x8C, 0x48, 0xC4, 0x24, 0x16,
+    0xFF, 0xC9, 0x45, 0x2D, 0x6D, 0x0D, 0x9B, 0xCF, 0x0E, 0xA8, 0x64, 0x7B, 0x5C, 0x70, 0x92, 0xA5,
+    0xCE, 0x4C, 0x0F, 0x4F, 0x4A, 0x3B, 0x2A, 0xA7, 0x06, 0x7E, 0xA7, 0x41, 0xC7, 0x8B, 0x87, 0x4E,
+    0xA0, 0xBB, 0x49, 0xBD, 0x48, 0xF4, 0x55, 0xAB, 0x1B, 0xD7, 0x98, 0xE8, 0xA2, 0xF5, 0x2E, 0x16,
+    0x94, 0xBE, 0xA0, 0xA6, 0xB8, 0x26, 0x58, 0x59, 0x60, 0x64, 0x80, 0xFB, 0xBB, 0xA0, 0x3A, 0xCE,
+    0x14, 0x89, 0x5A, 0x22, 0x33, 0xF1, 0x94, 0xFD, 0x91, 0x74, 0x20, 0x42, 0xBA, 0x00, 0x4A, 0x12,
+    0x0F, 0xDB, 0x2D, 0xBF, 0x20, 0x0D, 0xA5, 0x48, 0xD0, 0x0B, 0xAF, 0x28, 0x97, 0xA1, 0xB3, 0x68,
+    0x47, 0xC1, 0x54, 0xCF, 0x98, 0x40, 0xD6, 0xB8, 0x6F, 0xFA, 0x81, 0x6A, 0x61, 0x12, 0xE6, 0x9D,
+    0x32, 0x52, 0x32, 0x0D, 0xF4, 0x88, 0x48, 0x63, 0x46, 0xF8, 0x38, 0xA0, 0x66, 0xCB, 0xC0, 0x72,
+    0x8E, 0x9B, 0x6C, 0x17, 0x20, 0xDD, 0x83, 0x80, 0xD5, 0x76, 0x37, 0x91, 0xEF, 0x44, 0xF7, 0xEA,
+    0x82, 0x3B, 0xA6, 0x33, 0xD1, 0xC5, 0xF3, 0xD4, 0xDC, 0x56, 0x9D, 0x8E, 0x2E, 0x16, 0xD7, 0x84,
+    0x52, 0x7A, 0x6A, 0x89, 0x54, 0xBF, 0x05, 0xAA, 0xC3, 0x57, 0xD1, 0xC8, 0x40, 0x25, 0xCD, 0x72,
+    0x66, 0x2B, 0xCB, 0x0C, 0xE8, 0x06, 0x0F, 0xF1, 0x39, 0x27, 0x67, 0x73, 0xAC, 0x48, 0xAB, 0x17,
+    0x5E, 0x31, 0xF5, 0x79, 0xA5, 0x74, 0xBF, 0x84, 0x07, 0xED, 0xB8, 0x50, 0x2E, 0x9A, 0x0F, 0xAE,
+    0x0E, 0x54, 0x0B, 0x17, 0x71, 0xBF, 0x36, 0xA0, 0x52, 0xD9, 0xB2, 0x89, 0x88, 0x34, 0x4E, 0x64,
+    0xC8, 0xCB, 0xF4, 0xB2, 0x84, 0x71, 0xBC, 0xDD, 0xBC, 0xD0, 0xE5, 0x31, 0xF7, 0xA0, 0xE6, 0x17,
+    0xA9, 0x17, 0xC9, 0xB4, 0xB3, 0x70, 0x89, 0x39, 0xC9, 0x24, 0xEB, 0x5D, 0x5C, 0xE3, 0x3A, 0xB7,
+    0x4D, 0xD2, 0x7F, 0x32, 0x8D, 0x56, 0x16, 0x38, 0x49, 0x14, 0x5F, 0x8F, 0x70, 0x9D, 0x33, 0x45,
+    0x42, 0x84, 0x42, 0x3A, 0xEC, 0xE2, 0xFB, 0x27, 0xEF, 0xB1, 0xA3, 0xF6, 0x23, 0x8F, 0x32, 0x8C,
+    0x66, 0x6A, 0xD2, 0x32, 0x87, 0x28, 0x12, 0xD4, 0x1E, 0x35, 0xE4, 0x35, 0x9E, 0x8E, 0xC0, 0xE4,
+    0x7B, 0xB5, 0x4C, 0x39, 0x3E, 0x8C, 0x2C, 0x2C, 0x6B, 0xDB, 0xC0, 0xD6, 0xA9, 0x63, 0xD4, 0xA5,
+    0x67, 0x97, 0x12, 0xF6, 0x33, 0x13, 0xBA, 0x89, 0xEA, 0xB8, 0x8E, 0x4E, 0xEC, 0x63, 0x12, 0x43,
+    0x7E, 0xB1, 0xAD, 0xEE, 0x71, 0x8D, 0x91, 0x91, 0x20, 0x8D, 0x56, 0x44, 0x42, 0x21, 0x22, 0xDE,
+    0x35, 0x4C, 0x29, 0x23, 0x33, 0xAA, 0xC8, 0x82, 0x3A, 0xA8, 0x79, 0x0E, 0xC4, 0x35, 0x14, 0xE7,
+    0x0F, 0xB6, 0xD4, 0x15, 0x28, 0x3C, 0x24, 0x58, 0xCD, 0x5F, 0x4F, 0xC0, 0xFC, 0x56, 0xCB, 0x4C,
+    0xA2, 0x7B, 0x67, 0x97, 0x5E, 0xC7, 0x8A, 0x35, 0xD3, 0x98, 0x38, 0xE1, 0x4A, 0x11, 0x6D, 0xE8,
+    0xE9, 0x9C, 0x77, 0x3A, 0xE9, 0x54, 0x53, 0xC3, 0x29, 0xCF, 0xC5, 0x03, 0x51, 0x07, 0xEA, 0x63,
+    0xA2, 0x1A, 0x11, 0x19, 0xAC, 0x88, 0x74, 0xAA, 0xA7, 0x68, 0x74, 0x8F, 0x8B, 0x1F, 0x59, 0x54,
+    0x13, 0xE0, 0x0E, 0xB8, 0x4F, 0x05, 0x2B, 0x3D, 0xBF, 0x98, 0x53, 0xF6, 0x1F, 0x5F, 0x50, 0xC8,
+    0xC0, 0xE2, 0x27, 0xA2, 0x0B, 0x6B, 0x3A, 0xE9, 0xB8, 0xC1, 0xC4, 0x44, 0x13, 0xF6, 0xD9, 0x71,
+    0xC1, 0xF9, 0x8E, 0x54, 0x51, 0x99, 0x64, 0x12, 0xCE, 0xF8, 0xD5, 0xAD, 0x68, 0x4E, 0xDF, 0x54,
+    0x9F, 0x7B, 0x20, 0x59, 0x29, 0x03, 0xB6, 0x41, 0xA7, 0x25, 0xAF, 0x5D, 0x7A, 0x8A, 0x48, 0x26,
+    0x30, 0xB9, 0x9E, 0x81, 0x61, 0x5C, 0x86, 0xA1, 0x39, 0x4C, 0xA1, 0x8A, 0x14, 0x2D, 0xA8, 0xEE,
+    0xF2, 0xEA, 0xBF, 0x8C, 0x5B, 0xF7, 0x0E, 0xE8, 0x15, 0x0B, 0x6B, 0xD0, 0x62, 0x3D, 0x6B, 0x90,
+    0xB0, 0x81, 0x4B, 0xD0, 0x61, 0x23, 0x55, 0x46, 0xEC, 0x8F, 0xBF, 0x14, 0x3E, 0x9C, 0x50, 0x97,
+    0x01, 0xD5, 0x41, 0x95, 0xCD, 0x6D, 0x33, 0xC3, 0xF2, 0x4C, 0xBB, 0xD0, 0x43, 0xE9, 0xD1, 0x09,
+    0xEA, 0x6C, 0xDF, 0xF7, 0xC1, 0x35, 0xA8, 0x01, 0xAA, 0x03, 0x56, 0xA6, 0x94, 0xB4, 0x84, 0x41,
+    0x2A, 0x50, 0xC0, 0x15, 0x54, 0x43, 0x01, 0x13, 0x68, 0x29, 0x3C, 0x1B, 0x90, 0x28, 0x62, 0x86,
+    0x44, 0x2D, 0x37, 0x28, 0x1A, 0x06, 0x5C, 0xA0, 0xA3, 0x44, 0x27, 0x36, 0xB1, 0x0D, 0xFB, 0xB8,
+    0xC8, 0x40, 0x19, 0x4C, 0x47, 0x8D, 0x4D, 0xCC, 0x38, 0x85, 0x0E, 0xFC, 0x78, 0xCE, 0x17, 0x40,
+    0x79, 0x76, 0x71, 0x51, 0x1D, 0xC8, 0xAF, 0x02, 0x6B, 0x98, 0xC0, 0x36, 0x05, 0x24, 0x56, 0xD1,
+    0x0D, 0x1B, 0x98, 0xC8, 0x3E, 0x2E, 0xD0, 0x70, 0x19, 0x73, 0x95, 0x32, 0xFF, 0xB6, 0xA3, 0x88,
+    0xD4, 0xF0, 0xDC, 0x03, 0x33, 0xBF, 0x8E, 0x4E, 0xB8, 0x98, 0xAD, 0x24, 0xFF, 0xA4, 0xC7, 0x36,
+    0x54, 0x30, 0x60, 0x5B, 0xAA, 0xC0, 0x1C, 0x9B, 0xA8, 0x22, 0xF7, 0x81, 0x17, 0x74, 0x5C, 0x65,
+    0x5B, 0x47, 0xC7, 0x15, 0xDD, 0x38, 0x3F, 0xD1, 0xA9, 0x08, 0x94, 0xC1, 0x05, 0xDB, 0xD8, 0x46,
+    0x27, 0x9D, 0x18, 0x18, 0xD8, 0xE4, 0x06, 0xA5, 0xAF, 0x28, 0xA2, 0x8B, 0x26, 0x99, 0x96, 0x5E,
+    0x77, 0x5C, 0x67, 0xA0, 0x62, 0x13, 0x17, 0x4B, 0x6F, 0xDB, 0x22, 0xEA, 0xDE, 0xB4, 0xCC, 0x55,
+    0xC7, 0x94, 0x7D, 0xAA, 0x58, 0x53, 0xB4, 0xA5, 0x87, 0x32, 0x62, 0x66, 0x2D, 0x48, 0x82, 0x69,
+    0x82, 0x6A, 0x2F, 0xEF, 0xBE, 0xB3, 0x19, 0x47, 0xD7, 0x70, 0x8F, 0xC7, 0xB3, 0x87, 0x58, 0x1E,
+    0x67, 0xC6, 0x84, 0x38, 0x91, 0x50, 0x0D, 0x0D, 0x26, 0xEA, 0x98, 0xC9, 0x39, 0xEB, 0x4D, 0xA0,
+    0xA0, 0xF0, 0x38, 0x9C, 0xE7, 0x02, 0x0E, 0xD6, 0xA8, 0x60, 0xC2, 0xFA, 0x98, 0x06, 0xDD, 0x26,
+    0x67, 0x7B, 0x14, 0x4D, 0x86, 0x63, 0x98, 0xC3, 0x8C, 0x43, 0xC7, 0xD1, 0xB7, 0xB9, 0x4B, 0xA0,
+    0xC3, 0xD3, 0xE3, 0xC7, 0xA7, 0xFC, 0x98, 0x80, 0xD4, 0x4B, 0xF7, 0x7E, 0x6F, 0x19, 0x66, 0xFB,
+    0x31, 0x55, 0xD2, 0xE9, 0xA8, 0x57, 0xDC, 0x7F, 0xF0, 0x6B, 0x93, 0xC8, 0x18, 0xF8, 0x20, 0x07,
+    0x9C, 0x86, 0x1C, 0xF9, 0xAA, 0x39, 0x18, 0xF1, 0xF0, 0x23, 0x87, 0xC8, 0xDA, 0x2C, 0xF3, 0xC3,
+    0xAF, 0x44, 0x68, 0x1F, 0x3D, 0x22, 0x5B, 0x1A, 0xB3, 0xB9, 0x4B, 0xCB, 0xCA, 0x6D, 0xC8, 0x8C,
+    0x1A, 0xB7, 0x47, 0x4E, 0xEE, 0x3C, 0x50, 0x2C, 0x6F, 0xD1, 0xE6, 0x7F, 0xA8, 0x21, 0xD3, 0x50,
+    0xC5, 0x81, 0xF3, 0x33, 0x6D, 0xE5, 0x55, 0x2A, 0x03, 0xFB, 0x65, 0x60, 0xD3, 0x45, 0x4A, 0x17,
+    0x29, 0xFE, 0x30, 0x62, 0xFE, 0xB4, 0x41, 0x49, 0x03, 0xD2, 0x42, 0x9D, 0xA0, 0x1C, 0xC0, 0x49,
+    0xC4, 0xFC, 0x69, 0x8F, 0xEE, 0x04, 0x86, 0x3A, 0xB1, 0x69, 0x17, 0x54, 0x5E, 0x1A, 0x17, 0xCB,
+    0x71, 0x61, 0x5C, 0x93, 0x7D, 0xB6, 0xE9, 0xC6, 0x49, 0x0F, 0x63, 0x0C, 0xE4, 0x24, 0x38, 0xB8,
+    0x00, 0x97, 0x60, 0x02, 0x3B, 0x70, 0x67, 0x97, 0xF7, 0x92, 0xFA, 0x7A, 0xD4, 0x82, 0x19, 0xB0,
+    0x73, 0x8A, 0x19, 0xEE, 0xE5, 0x58, 0xBA, 0xB6, 0xB2, 0xDD, 0xA6, 0x39, 0xB2, 0xD4, 0x53, 0xB8,
+    0x0F, 0x03, 0xAA, 0xC7, 0xA4, 0x91, 0x2D, 0x3E, 0x7F, 0x5E, 0x7F, 0x3E, 0x5C, 0x69, 0xED, 0x2E,
+    0xB3, 0xBC, 0x3B, 0x36, 0x93, 0xF9, 0x4C, 0xD8, 0x9E, 0x3B, 0x9B, 0xE0, 0x1C, 0x9C, 0x06, 0xC7,
+    0xF1, 0xF2, 0x77, 0x95, 0xA1, 0x6D, 0x76, 0x3B, 0x3D, 0x6C, 0x2C, 0xDD, 0x8C, 0x69, 0x50, 0x99,
+    0x02, 0x38, 0xF4, 0x44, 0xEF, 0x5D, 0xFB, 0x35, 0x91, 0x7E, 0x26, 0xF3, 0x7A, 0x2C, 0x75, 0x73,
+    0x11, 0xB6, 0x50, 0xED, 0x31, 0xD6, 0xF2, 0x89, 0xE5, 0x64, 0x3A, 0x48, 0xE8, 0x16, 0x13, 0x31,
+    0x91, 0x22, 0xE0, 0x3C, 0x0E, 0xD6, 0x61, 0x03, 0x26, 0xB0, 0xEB, 0x99, 0x45, 0x24, 0xC2, 0xC9,
+    0x80, 0xC9, 0xFC, 0x7B, 0x1E, 0xCF, 0x79, 0xEC, 0x81, 0xE7, 0xDB, 0x7D, 0x40, 0xCA, 0xE1, 0xDA,
+    0xCF, 0x4D, 0x65, 0x51, 0x89, 0x7C, 0x32, 0x17, 0xA6, 0x38, 0x50, 0xB3, 0x4D, 0x98, 0x0E, 0x06,
+    0x98, 0x8F, 0x28, 0x03, 0x13, 0x75, 0x4B, 0x62, 0x97, 0x75, 0x1C, 0xF6, 0xC8, 0x1B, 0x6F, 0xA2,
+    0x7A, 0x8F, 0x59, 0xAC, 0xD3, 0x58, 0xAA, 0x30, 0x49, 0xF7, 0x0C, 0xDC, 0xA0, 0x06, 0x56, 0x7C,
+    0x36, 0xC9, 0x2E, 0xC3, 0xF0, 0x9A, 0xAB, 0x74, 0x99, 0xF5, 0xAB, 0x32, 0xEB, 0x67, 0x63, 0xC6,
+    0xBE, 0x7D, 0x36, 0xDB, 0x0A, 0x18, 0xAE, 0x3D, 0x67, 0x45, 0xDA, 0x4A, 0xC4, 0x67, 0x56, 0xBA,
+    0xC0, 0x99, 0x60, 0x7E, 0xBF, 0xD1, 0x6D, 0x22, 0x9D, 0x65, 0x77, 0x59, 0x90, 0xB0, 0x11, 0x9D,
+    0xD9, 0xA2, 0x5D, 0x58, 0x07, 0xE7, 0x31, 0x11, 0xF5, 0x1E, 0xCC, 0x22, 0x75, 0x02, 0x4E, 0x86,
+    0x83, 0xE1, 0x8B, 0x08, 0x9B, 0x74, 0x74, 0x45, 0xB4, 0xB1, 0xA6, 0xE6, 0x39, 0xFA, 0x2C, 0xD4,
+    0x87, 0x86, 0xFF, 0xB9, 0x63, 0xC3, 0x5F, 0x1C, 0xFD, 0xFE, 0x04, 0x95, 0xCE, 0x16, 0xAF, 0xA6,
+    0x89, 0x7B, 0x25, 0xDD, 0x2F, 0xF2, 0x7B, 0x8A, 0x90, 0x3D, 0xB1, 0xFD, 0x9F, 0x54, 0x09, 0x79,
+    0x20, 0x7B, 0x2A, 0xFC, 0xB1, 0x53, 0x00, 0x78, 0x31, 0x9F, 0x36, 0xF3, 0xC9, 0xFD, 0x54, 0x00,
+    0xB0, 0x7F, 0x10, 0x00, 0xCC, 0xD7, 0x33, 0x7E, 0x19, 0xEF, 0x33, 0xCD, 0xA7, 0xB1, 0x86, 0x35,
+    0xA6, 0x66, 0x76, 0x3C, 0x65, 0x75, 0xE7, 0xBA, 0x00, 0x76, 0x3E, 0xA6, 0xCF, 0xF9, 0xF4, 0xA5,
+    0xFF, 0xF5, 0xBC, 0x07, 0xFB, 0x45, 0x91, 0x16, 0xEC, 0x1F, 0x8B, 0x74, 0x60, 0x1B, 0x91, 0x61,
+    0xF4, 0x0D, 0x87, 0xA7, 0xF6, 0xE8, 0x3B, 0x75, 0x28, 0xF9, 0xDA, 0x01, 0xFF, 0x7E, 0x97, 0x31,
+    0x4B, 0x51, 0x89, 0x4C, 0x5E, 0x65, 0x23, 0xB5, 0x71, 0x39, 0x25, 0xF7, 0xFC, 0x3B, 0xFC, 0xF0,
+    0xEC, 0x75, 0xCA, 0x6F, 0xFE, 0x0B, 0xC6, 0xA4, 0x25, 0xFF, 0x75, 0xD7, 0x03, 0xB3, 0x78, 0x38,
+    0xA1, 0x07, 0x0A, 0x08, 0xDB, 0x0F, 0x65, 0x8B, 0xF6, 0xB1, 0x89, 0x4D, 0xCC, 0x80, 0xF3, 0x88,
+    0x2F, 0x22, 0xD3, 0xC6, 0x24, 0xEA, 0x5E, 0x75, 0xB8, 0x19, 0xFB, 0xD8, 0x2F, 0xC5, 0x1A, 0xF3,
+    0xED, 0xAE, 0x0C, 0x0C, 0xD7, 0x8B, 0xC8, 0x7D, 0xF7, 0x5A, 0xA2, 0xFE, 0xC4, 0x7B, 0x3D, 0x2E,
+    0xEE, 0xDF, 0xA3, 0x48, 0xD5, 0x14, 0xD3, 0x5B, 0x09, 0xCC, 0x91, 0x86, 0x19, 0x75, 0xA2, 0x8E,
+    0xA3, 0x63, 0xDA, 0xCA, 0xFE, 0x6C, 0x42, 0xEE, 0x50, 0x39, 0x76, 0x3C, 0xF5, 0xF3, 0x68, 0x99,
+    0xE3, 0xDA, 0x5D, 0x36, 0x48, 0x3A, 0x99, 0xE8, 0x7C, 0xC9, 0x84, 0x5E, 0x27, 0xD3, 0xB8, 0x58,
+    0xB2, 0xC9, 0xBE, 0xEE, 0x4C, 0x5A, 0x16, 0x03, 0x3F, 0x86, 0x1A, 0x70, 0x91, 0x19, 0xA6, 0xA1,
+    0x8E, 0x3A, 0x51, 0x76, 0x0C, 0x14, 0x0B, 0x36, 0x31, 0xEF, 0xC6, 0x0A, 0xF5, 0x17, 0xC9, 0x45,
+    0x86, 0x7B, 0xB6, 0xA5, 0x2E, 0x3F, 0x9E, 0x28, 0x5F, 0x6B, 0x07, 0x5C, 0x33, 0xDC, 0xC0, 0xA4,
+    0xAA, 0xF2, 0x7A, 0x28, 0xBE, 0x14, 0x59, 0x28, 0x69, 0xA9, 0x7D, 0xDD, 0x51, 0x45, 0x37, 0xE0,
+    0x92, 0x3E, 0x88, 0x15, 0x55, 0x5C, 0xC2, 0x47, 0x9B, 0x18, 0xC3, 0x43, 0x8E, 0xD5, 0xC3, 0x52,
+    0xE0, 0x42, 0x3A, 0x16, 0x36, 0x3A, 0x3F, 0xD1, 0xC9, 0xC4, 0x0D, 0x76, 0x4D, 0x74, 0x61, 0x9F,
+    0xCE, 0xC5, 0x92, 0x5E, 0xA7, 0xCA, 0xD7, 0x26, 0x99, 0x76, 0xDC, 0xD7, 0x6A, 0x80, 0x3A, 0x97,
+    0x76, 0xE6, 0x63, 0xD2, 0xC6, 0x09, 0xCE, 0x80, 0x8E, 0xB7, 0x81, 0x8D, 0x76, 0x49, 0xA0, 0x70,
+    0xF3, 0x41, 0xDD, 0xBC, 0x88, 0x4D, 0xD4, 0xE8, 0xBC, 0x2A, 0x2C, 0x57, 0xA5, 0xEA, 0xE9, 0x1F,
+    0xBE, 0x2A, 0x37, 0x3E, 0xFA, 0xAA, 0x68, 0xCE, 0x62, 0xAD, 0xA7, 0x48, 0x39, 0xE0, 0x9C, 0xF9,
+    0xEB, 0xAF, 0x8A, 0x87, 0x09, 0xB8, 0x80, 0x4E, 0xF0, 0x4B, 0x0F, 0xB5, 0xAF, 0xB3, 0x2F, 0x61,
+    0x64, 0x60, 0xFA, 0x89, 0xA6, 0x88, 0x97, 0xE8, 0x74, 0x53, 0xB2, 0xA1, 0x5B, 0x1B, 0x37, 0xD8,
+    0xB7, 0xD1, 0x85, 0x81, 0xDE, 0xC5, 0xF2, 0xD9, 0x5E, 0xA7, 0xEF, 0xFB, 0x12, 0xCB, 0x72, 0x7F,
+    0x9C, 0x94, 0x08, 0xC5, 0xC2, 0x83, 0xBE, 0xFA, 0x57, 0x58, 0x57, 0xDB, 0xC2, 0x3D, 0x78, 0x2B,
+    0x52, 0x8D, 0x89, 0xCB, 0xCA, 0xA7, 0x6E, 0x7E, 0x97, 0xFA, 0x4E, 0x21, 0x61, 0x64, 0x0A, 0xEB,
+    0xBD, 0x2A, 0x52, 0x07, 0xD3, 0x51, 0x7B, 0x6E, 0x50, 0x06, 0x5C, 0x70, 0x11, 0xD3, 0x9A, 0x06,
+    0x3A, 0x9D, 0x60, 0x83, 0x1E, 0x2A, 0x36, 0xC1, 0x05, 0x17, 0x28, 0x1A, 0x93, 0x28, 0x12, 0xF2,
+    0xDB, 0x6F, 0x75, 0xB9, 0xC8, 0x9D, 0x7B, 0x23, 0x44, 0x7A, 0x38, 0x29, 0x07, 0x09, 0xE8, 0xA9,
+    0xB7, 0x12, 0xB3, 0x0F, 0xC2, 0x87, 0x9A, 0xC2, 0x02, 0x95, 0x04, 0xDD, 0x3A, 0xD6, 0xB9, 0x40,
+    0x62, 0xDB, 0x06, 0xDD, 0x5C, 0xC2, 0x71, 0x87, 0x1D, 0x9D, 0x8A, 0x26, 0x27, 0x89, 0xED, 0x11,
+    0xE4, 0x90, 0x4B, 0x3E, 0xB4, 0xE7, 0x81, 0x7A, 0xBE, 0xA4, 0xF3, 0x1F, 0x3C, 0xAA, 0x05, 0x99,
+    0xE1, 0x64, 0xE1, 0x67, 0xB0, 0xC0, 0x35, 0xCC, 0x51, 0x3D, 0x37, 0x60, 0x93, 0x9A, 0xCC, 0xCE,
+    0x9A, 0xA6, 0x88, 0xD0, 0x99, 0x16, 0xF6, 0xE9, 0x61, 0x93, 0x4D, 0xC6, 0x1A, 0x4F, 0x34, 0x8B,
+    0xDF, 0x98, 0x35, 0x88, 0x48, 0x4B, 0x25, 0x92, 0x30, 0x22, 0x2D, 0x3C, 0x79, 0x3C, 0x89, 0x7C,
+    0x78, 0xF9, 0xE7, 0x6F, 0x38, 0xC1, 0x22, 0x98, 0x48, 0x11, 0x6D, 0x43, 0x11, 0xEC, 0xDE, 0x87,
+    0xEF, 0x39, 0xEB, 0x41, 0x8B, 0x34, 0x98, 0xF7, 0xF5, 0x80, 0xE9, 0xA9, 0xBD, 0xE9, 0xB0, 0xAD,
+    0xEA, 0xA1, 0xCF, 0x59, 0xCD, 0x06, 0x38, 0x5F, 0x81, 0x69, 0x5C, 0x40, 0x27, 0xD3, 0x42, 0x4F,
+    0x0F, 0xF7, 0xA8, 0x61, 0x86, 0xFB, 0xE0, 0x53, 0xE2, 0x8D, 0x88, 0x04, 0x66, 0x22, 0x11, 0x27,
+    0x12, 0xE0, 0xE5, 0x43, 0x18, 0x7A, 0x8A, 0x93, 0xDE, 0x79, 0x1B, 0x5D, 0x28, 0xE2, 0xCA, 0x51,
+    0xD7, 0x7F, 0x48, 0xA4, 0xF7, 0x50, 0x49, 0x60, 0x9D, 0xC4, 0x3A, 0x17, 0x70, 0x58, 0x6F, 0x83,
+    0x6E, 0x74, 0x43, 0xE2, 0x0E, 0x3B, 0x54, 0xDC, 0xC3, 0xCA, 0x02, 0x64, 0x71, 0x14, 0xF8, 0xB1,
+    0x36, 0xFA, 0xF6, 0xF6, 0x58, 0x15, 0xD6, 0xCA, 0x1E, 0x85, 0x74, 0xAC, 0xB2, 0xCB, 0x79, 0x26,
+    0xAC, 0x31, 0x19, 0x9B, 0x0F, 0x7B, 0xEE, 0xD8, 0x0E, 0x91, 0x46, 0x89, 0xA0, 0x45, 0x82, 0xE9,
+    0x8A, 0x68, 0x93, 0x8D, 0x45, 0x6B, 0x1B, 0xD7, 0xB8, 0xA6, 0x8C, 0xAE, 0xA9, 0x62, 0xD9, 0xD4,
+    0xA1, 0x6E, 0xE0, 0x32, 0x26, 0xB2, 0x36, 0xD6, 0x7F, 0x41, 0x3D, 0xEB, 0x2F, 0xCC, 0x98, 0x0D,
+    0xA6, 0xC7, 0x79, 0xF6, 0x31, 0xED, 0x78, 0x4E, 0x94, 0x39, 0xC3, 0xF8, 0x9E, 0x8D, 0xFC, 0x60,
+    0x7B, 0xC5, 0x91, 0x72, 0x6B, 0x19, 0x32, 0x34, 0xBF, 0x0E, 0xAC, 0xAC, 0x70, 0x61, 0x46, 0x25,
+    0xD4, 0x81, 0x0D, 0xD8, 0x87, 0x1E, 0x3A, 0x74, 0xC2, 0x24, 0x6C, 0x7A, 0x08, 0x4F, 0x6C, 0x3A,
+    0x6C, 0xC2, 0x35, 0xB8, 0x48, 0x3D, 0x82, 0x5A, 0x7F, 0x02, 0xDA, 0x2B, 0xB0, 0xD9, 0x64, 0x12,
+    0xF0, 0x11, 0xBE, 0xD7, 0xAA, 0x54, 0x9C, 0x50, 0x71, 0x9B, 0xDF, 0x8D, 0x6C, 0xC2, 0x13, 0xD9,
+    0x39, 0x9E, 0xE5, 0x97, 0x07, 0x66, 0x03, 0x8B, 0xA5, 0xC4, 0x2D, 0xA6, 0xA1, 0x88, 0xB8, 0x48,
+    0x19, 0x97, 0x35, 0xD1, 0x31, 0x92, 0x72, 0x7E, 0x89, 0x06, 0x1E, 0x5A, 0x2E, 0xD4, 0xF2, 0x0D,
+    0xB4, 0x48, 0x60, 0xF6, 0xAD, 0xD7, 0x29, 0x9B, 0x31, 0x81, 0xD9, 0x58, 0xE6, 0x37, 0xF5, 0xFB,
+    0x64, 0xAA, 0x53, 0xC9, 0x1C, 0x78, 0x39, 0x01, 0x12, 0xC0, 0xF5, 0xCA, 0x5B, 0xF1, 0x33, 0x91,
+    0x54, 0x65, 0x7A, 0x61, 0xC1, 0x93, 0xF2, 0xCD, 0x23, 0xD6, 0xB5, 0x05, 0xED, 0x83, 0x05, 0xFE,
+    0xF2, 0x7D, 0x16, 0x6F, 0xE8, 0x88, 0x09, 0x98, 0x16, 0x25, 0x9E, 0x97, 0x13, 0xAA, 0x5B, 0x51,
+    0x5D, 0x25, 0x69, 0x2A, 0x4D, 0xB5, 0xF0, 0x47, 0x32, 0x9F, 0x1C, 0xFC, 0xBE, 0x12, 0xE1, 0x34,
+    0x7B, 0xC7, 0xDC, 0xE4, 0xCD, 0x2C, 0x72, 0xF5, 0xC1, 0x9B, 0x99, 0x30, 0x2C, 0xE2, 0x12, 0xD3,
+    0xF4, 0x80, 0x91, 0x3D, 0xB0, 0xD2, 0x2F, 0x85, 0x7E, 0x72, 0x20, 0x97, 0xDE, 0xA9, 0x5B, 0xE5,
+    0xAD, 0xF8, 0x4A, 0x64, 0xD0, 0x22, 0x12, 0x4B, 0x91, 0xFE, 0xA8, 0xD8, 0x26, 0xA0, 0x3B, 0xD4,
+    0xD7, 0x03, 0xCD, 0x92, 0x14, 0x56, 0xB2, 0x67, 0x3E, 0xB8, 0xA9, 0x23, 0xB4, 0x99, 0x24, 0x98,
+    0x67, 0x2D, 0x5C, 0xE7, 0x6A, 0xE9, 0x67, 0x12, 0xA7, 0xD2, 0x14, 0xB2, 0x07, 0x54, 0x8B, 0x40,
+    0x25, 0x3D, 0xC5, 0xE2, 0x96, 0x57, 0xF3, 0x91, 0x2D, 0x36, 0xCD, 0x98, 0xEE, 0x19, 0xD9, 0xCB,
+    0x25, 0x04, 0x4A, 0x69, 0xE0, 0xA4, 0x2C, 0x45, 0x92, 0x70, 0x96, 0x69, 0x57, 0x88, 0x88, 0x16,
+    0x91, 0x38, 0x15, 0x69, 0x95, 0xC8, 0xDE, 0xD8, 0x46, 0xF4, 0xC6, 0x92, 0xFB, 0x3F, 0x07, 0x6C,
+    0xFA, 0x8F, 0xA8, 0xC2, 0x80, 0xDA, 0x83, 0x47, 0xE0, 0xE2, 0x12, 0x3C, 0xF2, 0x94, 0xF6, 0xE8,
+    0xCF, 0x35, 0xE0, 0x96, 0xFD, 0xBE, 0xEA, 0x21, 0xCE, 0xFA, 0x7B, 0x36, 0x83, 0xD9, 0x62, 0xEF,
+    0x90, 0xE0, 0x6E, 0x2E, 0xF3, 0xCB, 0x0D, 0xD5, 0xB1, 0xDD, 0xF1, 0x51, 0xE6, 0xB1, 0x72, 0xED,
+    0xDA, 0xB5, 0x42, 0x44, 0xDE, 0x16, 0x91, 0xD6, 0x1F, 0xAB, 0x12, 0xF4, 0xE3, 0x2E, 0x5E, 0x96,
+    0x43, 0x6C, 0x3B, 0x22, 0xAF, 0x61, 0xCC, 0xBE, 0xAB, 0x90, 0x41, 0x99, 0x19, 0xD3, 0x5E, 0x1E,
+    0x01, 0xF4, 0xCD, 0x9C, 0xB1, 0x2D, 0x8B, 0xA8, 0x3A, 0x72, 0x17, 0xE7, 0x57, 0xFE, 0xFC, 0x13,
+    0x32, 0x98, 0x86, 0x09, 0x45, 0xA4, 0xC3, 0x65, 0x6A, 0xC6, 0x2C, 0xFC, 0xB4, 0xB7, 0xE2, 0x4F,
+    0x7A, 0x34, 0xEC, 0xA9, 0x1E, 0x9E, 0x50, 0x01, 0xF3, 0xF9, 0x30, 0x12, 0x96, 0x47, 0x0A, 0x60,
+    0xD7, 0xAE, 0x5D, 0xBB, 0x3A, 0x13, 0x19, 0x6A, 0x91, 0xC5, 0x89, 0xE3, 0xE5, 0x82, 0x90, 0x91,
+    0xBB, 0x4E, 0x47, 0x72, 0xE1, 0x6A, 0x64, 0x50, 0x4D, 0x1A, 0xC3, 0xE6, 0x7C, 0x94, 0x3A, 0x53,
+    0xB7, 0x2B, 0xB0, 0x0A, 0xE7, 0x59, 0x9B, 0x70, 0x77, 0x87, 0x8E, 0x95, 0x3F, 0xF7, 0xB5, 0x44,
+    0xD3, 0x60, 0x22, 0x45, 0x1C, 0x13, 0xCB, 0x0A, 0x36, 0xA1, 0x7E, 0x87, 0x69, 0xCF, 0xB4, 0xE3,
+    0xE1, 0xBA, 0x32, 0xE9, 0xB0, 0x7A, 0xE1, 0x64, 0xC8, 0xAD, 0x4D, 0xC5, 0x51, 0x5D, 0x4D, 0x1F,
+    0xD0, 0x95, 0x1E, 0x0E, 0x19, 0x90, 0x9C, 0xC4, 0xFE, 0xEC, 0x73, 0x46, 0x06, 0x36, 0x60, 0x97,
+    0x5A, 0xBA, 0x5A, 0x12, 0x69, 0xE9, 0x73, 0x16, 0xDE, 0x4A, 0xB0, 0xE2, 0xA1, 0x78, 0x36, 0xC0,
+    0xBF, 0x7A, 0x14, 0xCC, 0x4F, 0x6E, 0xC1, 0x63, 0xEE, 0xC1, 0xFA, 0xEC, 0xC7, 0x02, 0x6F, 0x72,
+    0x1F, 0xD3, 0x99, 0x8E, 0x32, 0xBA, 0xC8, 0x7D, 0xA6, 0x98, 0x4E, 0x77, 0xB8, 0xE8, 0x22, 0x53,
+    0x6A, 0x54, 0xA7, 0xFA, 0x1C, 0x6E, 0x6B, 0x2A, 0x54, 0xCF, 0x40, 0x11, 0x4D, 0x4B, 0x4D, 0x19,
+    0x6D, 0xC7, 0x34, 0x97, 0x93, 0x16, 0x18, 0x91, 0x94, 0x23, 0xDA, 0xA1, 0x0F, 0x6B, 0x5F, 0xD0,
+    0xFF, 0xFB, 0x32, 0xCD, 0x11, 0x04, 0xE2, 0x28, 0x6D, 0x2C, 0x5E, 0x69, 0x4D, 0x73, 0x87, 0x34,
+    0x61, 0xD7, 0xB1, 0x6E, 0xA3, 0x7B, 0xB6, 0x2D, 0xE2, 0x6C, 0x96, 0x2A, 0x19, 0xAC, 0x2C, 0x98,
+    0x7D, 0xC6, 0xC3, 0xE3, 0x2F, 0x05, 0xF4, 0x32, 0xC3, 0x3F, 0xC4, 0x0B, 0x6F, 0x70, 0x6A, 0xAF,
+    0x68, 0xA9, 0x7D, 0xED, 0xD5, 0xC0, 0x40, 0xD1, 0xDA, 0x44, 0xED, 0x2B, 0xCF, 0xC0, 0x80, 0x4D,
+    0x26, 0x51, 0xFA, 0x32, 0xB0, 0xCF, 0x75, 0x4C, 0xD2, 0x89, 0x32, 0xB8, 0xC8, 0x3E, 0x9B, 0x98,
+    0xA4, 0x06, 0xA6, 0xDE, 0x8A, 0x0C, 0xB9, 0x9A, 0x5F, 0xE7, 0x5A, 0xD7, 0x32, 0x9E, 0x3C, 0xFE,
+    0x52, 0x28, 0xE4, 0x28, 0x48, 0x99, 0xB0, 0x6B, 0x63, 0x11, 0x76, 0xE8, 0x0A, 0xEF, 0x48, 0x2A,
+    0x39, 0xD6, 0x55, 0x32, 0xCD, 0x05, 0xF6, 0xF5, 0x42, 0x62, 0x25, 0x83, 0x12, 0x09, 0x45, 0x7F,
+    0xC0, 0x7B, 0x37, 0x06, 0x4C, 0xDC, 0x19, 0xF1, 0x62, 0xD1, 0x3D, 0x14, 0xF0, 0x0C, 0xB8, 0xB6,
+    0x68, 0xA9, 0x39, 0x9C, 0x40, 0x7B, 0x64, 0x02, 0xAD, 0x49, 0x54, 0xBE, 0x0C, 0x0C, 0xEC, 0x8F,
+    0x13, 0xF0, 0x1F, 0x71, 0x02, 0x80, 0xF1, 0x8F, 0x31, 0xB1, 0x41, 0x4B, 0x7B, 0x7C, 0x78, 0x13,
+    0x6D, 0xDC, 0xE5, 0xAE, 0x0D, 0xCE, 0xDF, 0x21, 0x39, 0x4A, 0x92, 0x6E, 0x4B, 0x36, 0x54, 0x5B,
+    0xC4, 0xEA, 0xDD, 0x41, 0x8B, 0xC4, 0x52, 0xFA, 0xAC, 0x78, 0xEE, 0x02, 0x27, 0xCF, 0x02, 0x4F,
+    0xED, 0x2D, 0x39, 0xA2, 0x0F, 0x1D, 0x37, 0xD0, 0x9D, 0xEE, 0x71, 0x8D, 0x6B, 0x98, 0x52, 0xA3,
+    0x7B, 0x35, 0xE0, 0x9A, 0xA2, 0xA1, 0xA6, 0x1E, 0x8D, 0xA4, 0xB1, 0x2D, 0x15, 0xA5, 0x67, 0x60,
+    0x1F, 0xDB, 0x98, 0x44, 0x85, 0x0B, 0x0C, 0x4C, 0x29, 0x1B, 0x25, 0xB9, 0x90, 0xD7, 0xE3, 0x44,
+    0x22, 0xA5, 0x1C, 0xDA, 0xC8, 0xD3, 0xF0, 0x63, 0x9E, 0xA7, 0x5F, 0xE0, 0xD1, 0xAD, 0x23, 0xDD,
+    0x90, 0x60, 0xA2, 0xFD, 0x5C, 0xD2, 0xED, 0x0E, 0xDD, 0x25, 0x26, 0x8E, 0xD2, 0xC4, 0xE2, 0x95,
+    0x64, 0x9A, 0x1D, 0x9D, 0xAA, 0x77, 0x87, 0x42, 0x44, 0x89, 0x84, 0xEA, 0xAB, 0x0D, 0x9C, 0x65,
+    0x05, 0xEE, 0xB2, 0x8B, 0x69, 0x55, 0xC7, 0x8A, 0xD7, 0x57, 0x1F, 0x14, 0xFF, 0x25, 0xF4, 0xEB,
+    0xDC, 0xC7, 0x74, 0x99, 0x4C, 0x1D, 0x28, 0x5A, 0x35, 0xE0, 0x1A, 0xDD, 0xE1, 0xA2, 0x49, 0x94,
+    0xD1, 0x24, 0x4A, 0x6F, 0x5B, 0x2A, 0x6C, 0x43, 0x4D, 0x11, 0xB9, 0x8E, 0x1B, 0x99, 0xDC, 0x21,
+    0x5B, 0x7E, 0x99, 0x8B, 0xD3, 0xD2, 0xE6, 0x29, 0x1C, 0x37, 0x7D, 0x76, 0xD9, 0x50, 0x89, 0xDE,
+    0xEE, 0x99, 0x63, 0x80, 0xC5, 0x44, 0x1B, 0x6D, 0x2C, 0x82, 0x0D, 0xCE, 0x17, 0xDE, 0xE1, 0x28,
+    0x71, 0xAC, 0x53, 0xB2, 0xC1, 0x05, 0xF6, 0xA9, 0xDE, 0x1D, 0xA8, 0x64, 0xA0, 0x94, 0x9E, 0xA2,
+    0xEF, 0xB2, 0xA8, 0x7F, 0x89, 0xA6, 0x07, 0x06, 0xEC, 0x5F, 0x5D, 0xD3, 0xA7, 0x01, 0x1A, 0xC0,
+    0x5C, 0x3D, 0xA4, 0x30, 0x3E, 0xA2, 0x8A, 0xBF, 0xDE, 0x60, 0x03, 0xD6, 0xA3, 0x03, 0xDC, 0x58,
+    0x36, 0x39, 0xC6, 0x43, 0x4A, 0x64, 0x75, 0x0D, 0xE0, 0x8A, 0x3D, 0xD6, 0x74, 0xBC, 0x5F, 0x7A,
+    0xA0, 0xCF, 0x54, 0x6C, 0xE5, 0xC1, 0xB4, 0x15, 0x50, 0xC4, 0x8A, 0xD2, 0xBB, 0x50, 0x51, 0xFB,
+    0x9A, 0x0A, 0x09, 0x37, 0xA8, 0xB5, 0xC4, 0x81, 0xDA, 0xCA, 0xE7, 0x7A, 0x6A, 0xF7, 0xA5, 0x2F,
+    0x24, 0xEA, 0xFA, 0x57, 0xBF, 0xD8, 0x52, 0xCF, 0x8A, 0x77, 0x23, 0xF5, 0xDC, 0x4A, 0xA0, 0xEE,
+    0xAD, 0x40, 0x9D, 0xEC, 0x02, 0xEA, 0xC6, 0x0C, 0x50, 0x07, 0x73, 0x60, 0x43, 0xDB, 0x63, 0xF1,
+    0x6A, 0x6D, 0x07, 0xCE, 0xE9, 0x30, 0xB2, 0xF5, 0x5C, 0xED, 0x60, 0x7F, 0x03, 0x36, 0x9C, 0x67,
+    0xDD, 0x34, 0x77, 0x1D, 0xDD, 0xAC, 0x08, 0x1B, 0xB3, 0xAF, 0x46, 0x27, 0xD2, 0x1A, 0x91, 0x84,
+    0x7C, 0xA6, 0xA7, 0x7E, 0x6D, 0xC0, 0xC5, 0x7B, 0xE3, 0xBD, 0xC6, 0x6A, 0x74, 0xF1, 0x69, 0xD8,
+    0x3A, 0xF9, 0xBD, 0x6C, 0x0C, 0xCE, 0x45, 0xE3, 0xFB, 0xA0, 0xFE, 0x38, 0x62, 0xFC, 0xF6, 0xF7,
+    0xBE, 0xBD, 0x52, 0x79, 0xF6, 0x5D, 0x30, 0xED, 0x75, 0xAA, 0xD7, 0xBA, 0xE3, 0xC5, 0xB3, 0x8D,
+    0x4D, 0x4C, 0x3B, 0x50, 0xE9, 0xA4, 0x3B, 0xDB, 0x96, 0xC1, 0xC5, 0x81, 0xDA, 0x45, 0xE6, 0x73,
+    0xB4, 0xB4, 0x58, 0xC9, 0x88, 0x64, 0x59, 0xE2, 0x6B, 0xA1, 0xF6, 0xE8, 0x21, 0x7F, 0x3A, 0xCB,
+    0x40, 0x36, 0xF7, 0xB4, 0x36, 0x2C, 0x21, 0xEC, 0xED, 0x0F, 0xFB, 0x09, 0x2B, 0xB2, 0x40, 0x89,
+    0x88, 0xCF, 0x45, 0xC6, 0xFC, 0x28, 0x50, 0x56, 0x41, 0xDD, 0x2C, 0x5F, 0xA6, 0xCD, 0x92, 0xEB,
+    0x3A, 0x20, 0xBC, 0x94, 0x84, 0xF1, 0x45, 0x4B, 0x00, 0x23, 0x7F, 0x72, 0xCD, 0x2B, 0xC9, 0x25,
+    0xFC, 0x5C, 0x0D, 0xCF, 0x45, 0xFC, 0x36, 0x53, 0xC9, 0xDB, 0x63, 0xE7, 0xDD, 0x71, 0x54, 0x2B,
+    0x1D, 0x33, 0x89, 0x70, 0x3D, 0x17, 0x13, 0x72, 0x0D, 0x49, 0xF5, 0x50, 0x05, 0x4C, 0x07, 0xF5,
+    0xB7, 0xF6, 0x94, 0x48, 0x74, 0xF9, 0x5E, 0xD5, 0x41, 0x3B, 0x7C, 0xD1, 0x8E, 0x8F, 0x7B, 0x1C,
+    0xBB, 0x99, 0xF4, 0x58, 0x91, 0x39, 0xCB, 0x67, 0xAC, 0xA6, 0x81, 0x51, 0x15, 0xE2, 0xC7, 0x17,
+    0x25, 0x1E, 0xB4, 0x30, 0xBE, 0x18, 0x81, 0x5C, 0xAD, 0xB5, 0x0B, 0xC8, 0x9D, 0x53, 0x4E, 0xAE,
+    0x5D, 0xC3, 0x8A, 0x48, 0xA3, 0x45, 0xA4, 0x43, 0xF2, 0xB3, 0x0B, 0x2B, 0x19, 0x28, 0xEB, 0xF4,
+    0x60, 0x1B, 0x89, 0x95, 0x39, 0x95, 0xA4, 0x5C, 0xF7, 0x3A, 0x2C, 0x8B, 0xDD, 0xC8, 0x52, 0xCE,
+    0xC1, 0x7D, 0xF0, 0x3A, 0x53, 0x49, 0x46, 0xA4, 0x01, 0x1E, 0x23, 0x64, 0x83, 0xCA, 0xF0, 0xE1,
+    0x21, 0x5A, 0xF9, 0x01, 0x2C, 0xCA, 0x19, 0xCE, 0x59, 0xCF, 0xA5, 0xDB, 0x19, 0x3C, 0xBD, 0xF0,
+    0xD7, 0x5F, 0x14, 0xDD, 0x71, 0xA3, 0x31, 0x91, 0x4B, 0x87, 0xE5, 0xC3, 0x84, 0x89, 0xAC, 0x43,
+    0x37, 0x76, 0xD7, 0xED, 0x8F, 0xFD, 0x77, 0xFB, 0xB0, 0xAB, 0x52, 0x11, 0x39, 0x78, 0xC2, 0x0A,
+    0x26, 0xD8, 0xC4, 0x57, 0x9A, 0x8B, 0xDA, 0x97, 0x66, 0xF5, 0x85, 0xCF, 0x9F, 0xFE, 0xAF, 0xAF,
+    0x24, 0xE0, 0xF1, 0x97, 0x7E, 0x33, 0xC7, 0xF9, 0x95, 0x6B, 0xAF, 0x1E, 0x3C, 0x38, 0x62, 0xFC,
+    0xB9, 0x89, 0x7D, 0x55, 0xDA, 0xE2, 0x1D, 0x4A, 0xF7, 0xF9, 0xF7, 0x9E, 0x3B, 0x7C, 0xD6, 0x6C,
+    0x3D, 0x9C, 0x2B, 0x08, 0xA7, 0x5E, 0xFD, 0x07, 0xCF, 0xFC, 0x7E, 0x07, 0xBA, 0x51, 0x69, 0x93,
+    0xD2, 0xB4, 0xB9, 0x08, 0x78, 0xD9, 0xDA, 0x7F, 0xC4, 0xFD, 0xDC, 0xD8, 0x75, 0x09, 0xC7, 0x26,
+    0x65, 0x6E, 0x8D, 0x85, 0x9A, 0xFB, 0x0C, 0xBA, 0x33, 0xA9, 0x68, 0x4D, 0x5F, 0xC6, 0x7B, 0x26,
+    0x55, 0x7E, 0xA0, 0x0E, 0x65, 0x74, 0x8D, 0x6D, 0x75, 0x47, 0xAF, 0xFC, 0xDB, 0xE9, 0xE2, 0x0A,
+    0x4F, 0x9D, 0xD6, 0xFD, 0xD6, 0x23, 0x6C, 0xFE, 0xF6, 0x4F, 0xCE, 0x5A, 0xB6, 0x59, 0xC3, 0xC1,
+    0xA3, 0x8F, 0x6D, 0xEF, 0x9D, 0x78, 0xFA, 0xA9, 0xCB, 0x3C, 0x62, 0x7F, 0xA2, 0x3B, 0xF9, 0xFA,
+    0x93, 0x4D, 0x7C, 0x0A, 0x7D, 0xF2, 0x9D, 0xA7, 0x60, 0xE5, 0xA5, 0x5F, 0x97, 0x05, 0xB0, 0x52,
+    0xBC, 0xFD, 0xED, 0x5E, 0xF9, 0xAB, 0x9B, 0xE6, 0x8F, 0xFA, 0xCA, 0x35, 0xC3, 0x52, 0x40, 0xD3,
+    0x55, 0x71, 0xB0, 0x6D, 0xAD, 0x7B, 0x0E, 0x9F, 0xF6, 0xF2, 0x5B, 0xE7, 0x8C, 0xAF, 0xFC, 0x19,
+    0xA5, 0x63, 0xDA, 0xB9, 0xE4, 0xA8, 0x86, 0x2B, 0x6B, 0x5B, 0x57, 0x60, 0xEB, 0x54, 0x71, 0x81,
+    0x79, 0x6E, 0x41, 0xB7, 0xDE, 0x74, 0xFA, 0x8B, 0xAF, 0xC4, 0x8B, 0xC0, 0x51, 0x75, 0x2D, 0x1F,
+    0x8E, 0x2B, 0xE4, 0xCB, 0xD7, 0xFC, 0xF1, 0x2F, 0xF2, 0x13, 0x75, 0xFE, 0x95, 0x9F, 0xE6, 0xE6,
+    0x8F, 0xC5, 0x2F, 0x48, 0xA0, 0x1C, 0x9E, 0x79, 0xEC, 0x99, 0x27, 0x5E, 0x78, 0x7A, 0x96, 0x56,
+    0x5F, 0x7F, 0xFA, 0xDF, 0xFD, 0xD8, 0x4F, 0xFF, 0xD0, 0x09, 0xF8, 0xCF, 0x96, 0xDB, 0x7F, 0x27,
+    0x1C, 0xFD, 0xE3, 0x13, 0xE7, 0xCF, 0x9D, 0x81, 0x86, 0x09, 0xC5, 0x92, 0x88, 0x38, 0x54, 0x77,
+    0x3D, 0xFF, 0xA3, 0xFF, 0x63, 0x40, 0x3D, 0xFF, 0xC6, 0x51, 0x34, 0xB6, 0xF2, 0xD2, 0xED, 0x5A,
+    0x12, 0xB0, 0x6A, 0xFE, 0xE0, 0xD9, 0x2F, 0xC4, 0xDB, 0x69, 0x72, 0xF7, 0xC2, 0xD9, 0x15, 0x40,
+    0xFE, 0xF8, 0x2D, 0x3F, 0x51, 0x49, 0x01, 0x9E, 0x47, 0xD0, 0x70, 0xB5, 0x74, 0xE6, 0xBF, 0x6C,
+    0x6D, 0x7D, 0x70, 0xCA, 0x45, 0xED, 0x79, 0x8A, 0xC7, 0x50, 0xFE, 0xD0, 0xDD, 0xE6, 0x4E, 0xA3,
+    0x1E, 0x98, 0xB5, 0xBC, 0x68, 0xBB, 0x7D, 0xBA, 0x32, 0x54, 0xFF, 0xA4, 0xA9, 0xB1, 0x0B, 0xBF,
+    0x7E, 0x40, 0xC1, 0x9F, 0x3D, 0xD8, 0x2B, 0x83, 0x0A, 0xBB, 0x93, 0x0B, 0x3A, 0xD6, 0x07, 0x5E,
+    0x7B, 0xEA, 0x9F, 0x2E, 0x7E, 0x55, 0x35, 0x13, 0xF7, 0xB3, 0x6A, 0xEF, 0xE0, 0x29, 0x13, 0x9E,
+    0x3B, 0xB2, 0xD5, 0x54, 0x64, 0x85, 0xA7, 0x3E, 0x87, 0x07, 0xFE, 0x3E, 0xE8, 0xF8, 0x3A, 0x4F,
+    0x7A, 0x75, 0xEB, 0x75, 0xD4, 0x6C, 0xE1, 0xD9, 0xE3, 0x64, 0xF3, 0xD4, 0xD8, 0x3B, 0x75, 0xE2,
+    0xFF, 0x03, 0xC5, 0x9B, 0x7F, 0x8C, 0x1D, 0xD7, 0x75, 0xDF, 0x3F, 0xF7, 0x5E, 0x71, 0xAF, 0xC4,
+    0xCB, 0xDD, 0xAB, 0x3F, 0x28, 0xD7, 0xB6, 0x96, 0x3B, 0x46, 0x2B, 0x14, 0x8C, 0xBB, 0xBB, 0x43,
+    0x14, 0x2C, 0xB0, 0x05, 0xDE, 0x7B, 0x73, 0x25, 0xA1, 0x51, 0x51, 0xFF, 0x61, 0x06, 0xE0, 0xD6,
+    0x40, 0x0C, 0x34, 0x06, 0x6A, 0x14, 0x8E, 0xDD, 0x40, 0xFC, 0x63, 0x8B, 0xAC, 0x83, 0xE5, 0xBE,
+    0xB1, 0x04, 0x57, 0x05, 0x54, 0x40, 0xFB, 0x47, 0xD0, 0x3F, 0x9A, 0x02, 0x66, 0x03, 0x05, 0x90,
+    0xE9, 0x26, 0xDA, 0xA0, 0x6C, 0xB3, 0x69, 0x96, 0x7C, 0x97, 0x54, 0xDB, 0xFC, 0x11, 0xA0, 0x1A,
+    0x44, 0x0D, 0x0C, 0x54, 0x6D, 0x35, 0xB6, 0xE5, 0xA4, 0xB1, 0x51, 0xF0, 0xCA, 0x1E, 0x45, 0x43,
+    0x6A, 0xDE, 0x3B, 0xFD, 0x63, 0xDE, 0x23, 0x69, 0x59, 0x4E, 0x6B, 0xF4, 0xD7, 0x60, 0x97, 0xEF,
+    0x71, 0x76, 0xE6, 0xCD, 0xB9, 0xF7, 0x9E, 0x7B, 0xCE, 0xF7, 0x7C, 0xCF, 0xF7, 0xC1, 0xFC, 0xD8,
+    0xB0, 0x22, 0x22, 0x69, 0x7B, 0x7B, 0xFB, 0x33, 0x15, 0x40, 0x00, 0x0E, 0x40, 0xD7, 0x60, 0x6A,
+    0x50, 0x17, 0x16, 0x17, 0x5A, 0x11, 0xF2, 0xAB, 0xAF, 0x90, 0xC0, 0x44, 0xD8, 0x04, 0x1A, 0x30,
+    0x22, 0x64, 0x57, 0x5F, 0xE1, 0x5A, 0x7F, 0xD6, 0x03, 0xBB, 0xA0, 0x45, 0xA2, 0x17, 0xA1, 0x90,
+    0x96, 0x13, 0xDB, 0x3F, 0xFF, 0xCF, 0x45, 0x24, 0x9A, 0x08, 0x19, 0x70, 0x04, 0xA6, 0xEA, 0xAF,
+    0xDC, 0xDB, 0x46, 0x8B, 0xE0, 0xEB, 0x9C, 0xCB, 0x0C, 0x74, 0x22, 0xF9, 0x60, 0xE2, 0x80, 0x35,
+    0x95, 0x54, 0x72, 0xE5, 0xB8, 0x1C, 0xE9, 0x06, 0xE0, 0x12, 0x98, 0x00, 0x03, 0xD0, 0x15, 0x1F,
+    0x72, 0x88, 0x24, 0xFB, 0xBD, 0xAB, 0x61, 0x6E, 0x92, 0x8D, 0x90, 0x03, 0x6D, 0xFF, 0xA0, 0x0C,
+    0x38, 0x06, 0x93, 0x20, 0x2B, 0xE1, 0x7A, 0xFF, 0xD6, 0x47, 0x80, 0x49, 0x85, 0xBE, 0x3B, 0xC1,
+    0x24, 0x5D, 0xEB, 0xC4, 0x40, 0x25, 0x1C, 0x0D, 0xB0, 0x07, 0xE4, 0xD2, 0xE2, 0xA5, 0xC3, 0x46,
+    0x50, 0x09, 0xB8, 0xC1, 0xE3, 0x75, 0x2E, 0xD2, 0x58, 0x91, 0x0E, 0x91, 0x16, 0x2B, 0x6F, 0x2F,
+    0x2C, 0xC8, 0x67, 0x25, 0xB9, 0xB4, 0xB8, 0xD9, 0xD5, 0xA0, 0xA6, 0xF4, 0x06, 0x98, 0x0A, 0x18,
+    0x01, 0x46, 0x0E, 0x20, 0x93, 0x1A, 0x32, 0xA9, 0x60, 0x49, 0x00, 0xDF, 0x02, 0x52, 0x9E, 0x66,
+    0xDC, 0x38, 0x11, 0xD1, 0x22, 0x12, 0xC7, 0x22, 0xB5, 0x9A, 0xCC, 0x0E, 0xE6, 0x1F, 0x9A, 0x95,
+    0xB6, 0xD2, 0x89, 0x8E, 0x11, 0x59, 0x70, 0xD1, 0x24, 0x5A, 0x2E, 0x93, 0xE3, 0xA3, 0xAD, 0x75,
+    0xCB, 0x94, 0x31, 0x79, 0x74, 0x35, 0x9C, 0x56, 0x21, 0xD3, 0xC9, 0xC7, 0xD6, 0xA6, 0x1B, 0x3F,
+    0x3A, 0x33, 0x59, 0x89, 0xAD, 0xD0, 0x09, 0x3A, 0x18, 0x41, 0x16, 0x70, 0x11, 0x93, 0xA0, 0x85,
+    0xCB, 0x90, 0x83, 0x8F, 0xD8, 0x1A, 0xDD, 0xC2, 0x14, 0xC6, 0x90, 0x47, 0x5C, 0xBD, 0xB8, 0xDF,
+    0x55, 0x50, 0x00, 0x1D, 0xD8, 0xAA, 0x1F, 0x55, 0x07, 0xB6, 0xBE, 0xF7, 0xD6, 0xD4, 0x90, 0x87,
+    0x7B, 0x6F, 0xB3, 0xD0, 0x4F, 0xF6, 0xFC, 0x6D, 0x07, 0x59, 0x4D, 0x26, 0x30, 0x69, 0x30, 0x12,
+    0x38, 0x79, 0x81, 0xDE, 0x67, 0xE0, 0xCB, 0xDB, 0x09, 0x1C, 0x2B, 0x40, 0xAD, 0x2A, 0x38, 0xC3,
+    0x3A, 0xE8, 0x68, 0xFE, 0x08, 0xB6, 0x28, 0x24, 0x98, 0x60, 0xC3, 0x80, 0x43, 0x0E, 0x55, 0xB5,
+    0x82, 0xE7, 0x8C, 0xAA, 0x54, 0xAD, 0xAB, 0x75, 0x36, 0x38, 0x36, 0xA5, 0xB9, 0x2B, 0x4F, 0x27,
+    0x0A, 0xA9, 0xF7, 0x1F, 0x5C, 0x05, 0x1E, 0x82, 0x75, 0x2C, 0x78, 0x74, 0xC4, 0x94, 0x24, 0x54,
+    0xC5, 0x2E, 0x1C, 0xB2, 0x01, 0x03, 0xFC, 0x45, 0xBC, 0x88, 0x34, 0xF6, 0x7B, 0xDF, 0xA8, 0x9D,
+    0x8E, 0x5C, 0xA3, 0x4A, 0x0C, 0x38, 0xBF, 0x8B, 0x67, 0x63, 0x1D, 0x57, 0xE6, 0x1E, 0x73, 0x57,
+    0x9E, 0x2F, 0x11, 0xF9, 0x4A, 0xC5, 0x78, 0x16, 0xE6, 0xB3, 0x28, 0x22, 0x4E, 0x44, 0x6E, 0xFD,
+    0xC6, 0xFE, 0xF6, 0x05, 0x7C, 0x00, 0x17, 0x7B, 0x37, 0xA2, 0x05, 0xF6, 0xA5, 0x5F, 0x7C, 0xDF,
+    0xE4, 0xD8, 0x64, 0xA2, 0x6E, 0xA8, 0xE9, 0xD8, 0x61, 0xCC, 0x80, 0xBC, 0xF4, 0xF8, 0xCA, 0x45,
+    0x93, 0x4C, 0xAD, 0x3B, 0xD5, 0x00, 0x70, 0x0E, 0x30, 0x25, 0xB0, 0x0E, 0xA8, 0x1F, 0xF3, 0xE9,
+    0xD6, 0x55, 0xD8, 0xB8, 0x0F, 0xB9, 0xAD, 0xA1, 0x2D, 0xC0, 0xBE, 0x96, 0x20, 0x2F, 0x80, 0xBB,
+    0x0D, 0x58, 0x09, 0x50, 0xB4, 0x80, 0x44, 0xB0, 0x02, 0x14, 0x02, 0xDC, 0x9D, 0x81, 0x7B, 0xA3,
+    0x83, 0xC2, 0x77, 0xD0, 0x66, 0x2D, 0xAE, 0x2A, 0x1A, 0x0A, 0xC6, 0x69, 0xF1, 0xD1, 0x9B, 0xCC,
+    0x7D, 0xB2, 0x7F, 0x07, 0xFC, 0x0C, 0xA0, 0x1A, 0xB2, 0xE8, 0x22, 0x33, 0x0A, 0x7C, 0x43, 0x8B,
+    0x44, 0x57, 0x39, 0xA1, 0x60, 0xBF, 0xA1, 0xB5, 0xDF, 0x8F, 0xB6, 0x1A, 0x15, 0xE4, 0xE6, 0x9D,
+    0x96, 0x2E, 0x77, 0x95, 0xF9, 0x76, 0x53, 0x90, 0xFF, 0xC2, 0x93, 0x1D, 0xD3, 0xD6, 0xD7, 0x46,
+    0x62, 0x11, 0xB2, 0x4E, 0x75, 0x4C, 0xA2, 0x4F, 0x66, 0x4A, 0x51, 0xCE, 0x23, 0x06, 0x67, 0xB1,
+    0xE5, 0x21, 0x46, 0x2A, 0xF8, 0x80, 0x63, 0xEE, 0x32, 0x64, 0xC0, 0x1E, 0x43, 0x1A, 0x36, 0x55,
+    0x22, 0x33, 0x15, 0xDE, 0x45, 0xFC, 0x4B, 0x01, 0x2F, 0xE0, 0xA6, 0x60, 0x3B, 0x30, 0xCD, 0x7C,
+    0xBF, 0x56, 0x30, 0x2E, 0xF9, 0x2B, 0x33, 0x28, 0x1A, 0x18, 0x97, 0xC0, 0xE7, 0x39, 0xC9, 0x35,
+    0xD6, 0x48, 0x6C, 0xA8, 0xC4, 0x40, 0xD7, 0xEC, 0x99, 0x8A, 0x23, 0x13, 0x69, 0x6C, 0x24, 0xB9,
+    0x52, 0x25, 0x1F, 0x74, 0xED, 0x31, 0x55, 0x86, 0x89, 0x9B, 0xD8, 0xB2, 0x10, 0x09, 0x85, 0x48,
+    0x3F, 0xF1, 0x03, 0x60, 0x0B, 0xD8, 0x01, 0x54, 0x09, 0x83, 0xDE, 0xC9, 0x4F, 0x3F, 0x60, 0xA6,
+    0x82, 0xAC, 0x63, 0xF3, 0xA9, 0xB8, 0xC1, 0xF9, 0x35, 0xF5, 0x4B, 0x5E, 0xE4, 0x85, 0xBB, 0xBF,
+    0xF1, 0x54, 0x05, 0x0D, 0xE4, 0xE1, 0x21, 0x2B, 0xC2, 0x44, 0xCA, 0xA5, 0x59, 0xC0, 0x94, 0x70,
+    0x0D, 0xFC, 0xCF, 0x97, 0x56, 0x5A, 0x7E, 0xA9, 0x0F, 0x87, 0x7F, 0x7D, 0x86, 0x93, 0x8E, 0xD9,
+    0x33, 0xD1, 0x97, 0xEB, 0x3A, 0xE9, 0x38, 0x64, 0x60, 0xA2, 0x29, 0x8F, 0x39, 0xF2, 0xA5, 0x0F,
+    0x8D, 0x4A, 0x39, 0xB9, 0x49, 0x26, 0x61, 0x04, 0x8A, 0x84, 0x6E, 0xEF, 0x3D, 0xDA, 0x82, 0x0D,
+    0x98, 0x88, 0x89, 0x00, 0x27, 0xAF, 0xBE, 0x6C, 0x65, 0xAA, 0x6B, 0x68, 0x60, 0xB0, 0xD8, 0xB9,
+    0xA6, 0x46, 0x35, 0x70, 0x0C, 0xC5, 0x3C, 0xA6, 0x3D, 0x5E, 0xD3, 0xAC, 0x9B, 0x72, 0xD9, 0x81,
+    0xDF, 0x26, 0x13, 0xD6, 0x61, 0xC0, 0x85, 0xE2, 0x76, 0xCA, 0xA4, 0xB6, 0xBD, 0x47, 0x67, 0x77,
+    0x98, 0xBD, 0xD2, 0xEF, 0x10, 0x53, 0xA3, 0x24, 0xF0, 0x6C, 0x42, 0x35, 0x27, 0x54, 0x93, 0x4B,
+    0x1A, 0x4B, 0x95, 0xCF, 0x02, 0xBE, 0x8F, 0x38, 0x17, 0xE7, 0xD3, 0xA0, 0x23, 0x89, 0xF3, 0xAC,
+    0xE3, 0x31, 0xA5, 0xAE, 0x68, 0x18, 0x90, 0xE3, 0x4A, 0x54, 0x38, 0x9D, 0x99, 0xBA, 0xCB, 0x5E,
+    0x58, 0x84, 0x1E, 0x05, 0xEB, 0x90, 0x30, 0x61, 0xFE, 0x5A, 0xB2, 0x01, 0x0D, 0x26, 0x92, 0xC3,
+    0x11, 0x80, 0x8D, 0x98, 0x84, 0x6A, 0x99, 0x7F, 0x3C, 0xA0, 0x23, 0x24, 0xD8, 0x85, 0x0D, 0xF0,
+    0x60, 0x4A, 0x54, 0x05, 0x87, 0x30, 0x80, 0x33, 0xE0, 0xC0, 0x44, 0x54, 0x0D, 0x09, 0xD5, 0xE1,
+    0x3B, 0xDC, 0x7C, 0xAA, 0xC6, 0x1D, 0xBA, 0x3C, 0xE4, 0x94, 0x2E, 0xB9, 0xB4, 0x8C, 0x2E, 0x8B,
+    0xEA, 0x94, 0x2E, 0xAB, 0x73, 0x2B, 0xFA, 0xB9, 0xF2, 0xFC, 0xF2, 0xB2, 0x8A, 0x87, 0x87, 0x4E,
+    0x5E, 0x0C, 0x45, 0x3B, 0xB7, 0x8D, 0x53, 0x1C, 0x70, 0xC9, 0xA0, 0xCB, 0x55, 0x96, 0xB9, 0x42,
+    0x21, 0x33, 0x5D, 0x9E, 0xB2, 0xCB, 0x1C, 0x9E, 0x3A, 0x67, 0xCA, 0x77, 0xA2, 0x97, 0xBF, 0xC5,
+    0xB8, 0x8F, 0x28, 0x3F, 0xE5, 0x92, 0xEE, 0xFA, 0xD2, 0x87, 0x86, 0x7B, 0x4B, 0x0A, 0xA0, 0x22,
+    0x54, 0x90, 0xE0, 0xDA, 0x62, 0xA4, 0x57, 0xD6, 0xD9, 0x1D, 0xB2, 0x31, 0xC4, 0x0F, 0x71, 0xD7,
+    0x31, 0x53, 0xD4, 0x0C, 0x24, 0x32, 0xEC, 0xD8, 0x2C, 0x4A, 0xFF, 0x4C, 0x6B, 0xA3, 0x04, 0x74,
+    0x05, 0x3E, 0xC0, 0x65, 0xE0, 0xD1, 0x85, 0x37, 0x56, 0x26, 0xAD, 0x33, 0x33, 0x71, 0xB3, 0xDA,
+    0x75, 0x7F, 0xDF, 0x3D, 0xF5, 0x46, 0x4C, 0xD7, 0xB6, 0xFC, 0xA6, 0x7B, 0xF2, 0xFB, 0x65, 0xCA,
+    0x6B, 0x6F, 0x5A, 0x5D, 0x17, 0x0C, 0x17, 0x13, 0xBA, 0x8C, 0xAE, 0xD6, 0x41, 0xD2, 0x7C, 0xBB,
+    0xFC, 0xE8, 0x91, 0x18, 0x70, 0x8D, 0x6B, 0xEC, 0x91, 0x18, 0x98, 0x8A, 0xA1, 0x8D, 0x6C, 0xFA,
+    0x92, 0x3C, 0x83, 0x6C, 0x1F, 0x7C, 0xD7, 0xE7, 0x28, 0x97, 0xC0, 0xD5, 0xBD, 0x73, 0xE5, 0x25,
+    0x4A, 0x60, 0xDC, 0xC1, 0xA4, 0x86, 0xAF, 0x03, 0xAA, 0x5C, 0xE2, 0xD0, 0x94, 0x5B, 0x54, 0xCB,
+    0x5C, 0xB2, 0xAC, 0xEB, 0xB8, 0x42, 0x6D, 0xC2, 0x8E, 0x8A, 0xEB, 0x1C, 0xFA, 0xED, 0x5D, 0x23,
+    0x53, 0x4C, 0x80, 0x08, 0x97, 0x16, 0x0F, 0xCE, 0xA4, 0xCD, 0xA5, 0xD1, 0xD5, 0xDC, 0xB9, 0x6D,
+    0x85, 0x93, 0xE4, 0xE3, 0xBA, 0x0F, 0xAB, 0x19, 0xEB, 0xF9, 0xF6, 0x51, 0x2E, 0x4D, 0x26, 0xC9,
+    0x49, 0x09, 0x50, 0x63, 0x4B, 0x36, 0x38, 0xF1, 0xEE, 0xC5, 0x42, 0xEA, 0x4D, 0x38, 0xC2, 0x48,
+    0xED, 0xFF, 0xE8, 0x70, 0x8F, 0x6F, 0xD7, 0xE6, 0xA5, 0xB0, 0x51, 0xBC, 0x9A, 0x44, 0x9E, 0x97,
+    0x8E, 0x6D, 0xC8, 0x45, 0x04, 0x2F, 0x22, 0xA5, 0xE9, 0x28, 0x22, 0x45, 0x28, 0x4A, 0x6C, 0x5D,
+    0x04, 0x38, 0x2E, 0x00, 0x3F, 0x03, 0x72, 0x39, 0x80, 0xD1, 0x70, 0x08, 0x43, 0x6F, 0x22, 0x9B,
+    0x36, 0x26, 0x32, 0x5D, 0x0F, 0xF0, 0xA1, 0xF1, 0xB8, 0x38, 0x30, 0xD1, 0x54, 0x39, 0x0D, 0x6C,
+    0x6F, 0x5F, 0xC8, 0x65, 0xA6, 0x92, 0x2B, 0xED, 0xF3, 0x15, 0x1B, 0x89, 0xA5, 0x19, 0xFA, 0x0F,
+    0xB6, 0x38, 0xFC, 0x56, 0x5C, 0x5E, 0x3E, 0x65, 0x6E, 0xDE, 0x8C, 0x3B, 0x83, 0x33, 0xFD, 0xCA,
+    0x5C, 0xE0, 0x82, 0x96, 0x72, 0x8D, 0xCB, 0x1B, 0x26, 0xFA, 0x90, 0x8E, 0xD4, 0x3B, 0x13, 0xE1,
+    0x71, 0x91, 0x92, 0xC9, 0x3F, 0x99, 0x92, 0x95, 0xA6, 0x36, 0x35, 0x39, 0xC7, 0xE8, 0xE4, 0x4B,
+    0x46, 0xAA, 0xC1, 0xD4, 0x39, 0x1C, 0xEB, 0x84, 0x2F, 0xF3, 0xD2, 0x35, 0x4A, 0x64, 0x8A, 0x17,
+    0x29, 0x19, 0x4B, 0xD5, 0xCF, 0x2F, 0x63, 0x0E, 0xCD, 0x9B, 0xA6, 0x5C, 0x5F, 0x59, 0xE7, 0xCF,
+    0xA4, 0x52, 0x22, 0xB8, 0x72, 0xC8, 0x2E, 0xBB, 0x26, 0xAA, 0x7A, 0x0D, 0x17, 0xAE, 0x31, 0xD0,
+    0x95, 0xAA, 0x5D, 0xCC, 0x43, 0x26, 0x2D, 0x85, 0x94, 0xE4, 0xF5, 0x83, 0xAB, 0xAC, 0x3E, 0x0F,
+    0x90, 0x77, 0x00, 0xD2, 0x9C, 0x06, 0x2B, 0xD5, 0x65, 0xC8, 0x2A, 0x46, 0x50, 0xC0, 0x68, 0x0E,
+    0x0C, 0x54, 0x03, 0x05, 0x26, 0x41, 0x81, 0xAF, 0xA0, 0x20, 0x2F, 0xA1, 0xA0, 0x00, 0x0A, 0xA6,
+    0x40, 0xF1, 0x54, 0x07, 0x14, 0xCF, 0x24, 0xA0, 0x78, 0xA9, 0x06, 0x72, 0x89, 0x40, 0x2E, 0x01,
+    0xC8, 0xE5, 0xFE, 0x73, 0xF2, 0xFB, 0x31, 0x8C, 0x8D, 0x01, 0x2B, 0x26, 0xEA, 0x38, 0x60, 0xC7,
+    0x44, 0xCF, 0x50, 0x57, 0xA6, 0xDA, 0x65, 0xD3, 0xA3, 0xBF, 0x53, 0x93, 0x1F, 0xA3, 0x25, 0x90,
+    0x27, 0x54, 0x07, 0xD8, 0x60, 0x5E, 0x93, 0x9A, 0x1D, 0xD6, 0xF1, 0x00, 0x67, 0x80, 0x75, 0x0A,
+    0xE9, 0xD8, 0xBF, 0xFA, 0x32, 0x47, 0x3D, 0xB8, 0x53, 0x09, 0x74, 0xEA, 0x11, 0x86, 0xA9, 0x7A,
+    0xB0, 0xE7, 0x62, 0xEF, 0x9E, 0x59, 0xD9, 0x63, 0x91, 0xDE, 0xE8, 0xC5, 0x71, 0x06, 0x4C, 0x3C,
+    0x79, 0xF5, 0x58, 0x89, 0x94, 0x9B, 0xFD, 0x4D, 0x83, 0xFE, 0x9E, 0x0E, 0x7C, 0x89, 0x6A, 0x20,
+    0x67, 0x3E, 0x76, 0xA0, 0x90, 0x4E, 0xDD, 0xBD, 0x7A, 0xE0, 0x4A, 0x18, 0xF6, 0xCF, 0xCB, 0x45,
+    0x10, 0xE9, 0x54, 0xDB, 0x3F, 0xAE, 0x78, 0x00, 0x04, 0xCD, 0x91, 0xCF, 0x3C, 0xBD, 0x3A, 0xA9,
+    0xB6, 0xA0, 0x22, 0x93, 0x38, 0xDC, 0x5E, 0x38, 0x2E, 0xA9, 0x8F, 0xE0, 0xB9, 0x48, 0xE9, 0x45,
+    0x2A, 0x1B, 0x7B, 0x74, 0x4D, 0x33, 0x4F, 0x41, 0x19, 0xE0, 0xBE, 0x1A, 0x30, 0x32, 0x83, 0xA9,
+    0xA9, 0x39, 0x66, 0xC0, 0x08, 0x8F, 0xC7, 0x94, 0x36, 0xEA, 0x4A, 0xD7, 0x2A, 0xD1, 0xB8, 0x86,
+    0xA1, 0xA9, 0x81, 0x2F, 0x06, 0xA9, 0xCF, 0xB1, 0xCA, 0x49, 0x8C, 0x3C, 0x59, 0x5F, 0x3A, 0x3C,
+    0xB5, 0x65, 0x97, 0xED, 0x0B, 0xB6, 0xC4, 0xC7, 0xA2, 0xCA, 0x83, 0x6E, 0xB2, 0x94, 0x07, 0x0A,
+    0xDB, 0x66, 0x25, 0xFE, 0xE6, 0x34, 0x2B, 0x51, 0xED, 0xC4, 0x47, 0x28, 0xF2, 0xD7, 0x23, 0xB8,
+    0xB7, 0xDE, 0x8A, 0x80, 0x48, 0x05, 0xE4, 0x52, 0x01, 0x56, 0x6A, 0xC0, 0x48, 0xD7, 0xC3, 0xFC,
+    0x12, 0xAC, 0x48, 0x03, 0x76, 0x36, 0x13, 0x70, 0x9D, 0x14, 0x09, 0xD7, 0x8D, 0x7F, 0x7F, 0x8A,
+    0x9F, 0xE6, 0x49, 0x6E, 0xFA, 0xA9, 0xEF, 0xB2, 0x69, 0x04, 0xE0, 0x10, 0x80, 0xF3, 0x00, 0x9C,
+    0xEA, 0xA7, 0x61, 0x90, 0x3D, 0x1F, 0xDD, 0xA7, 0xFE, 0xB0, 0xE2, 0x07, 0x3F, 0xA8, 0xD8, 0xF8,
+    0xDD, 0x1A, 0x3B, 0xAB, 0xFB, 0x38, 0x94, 0x37, 0xBD, 0xAB, 0x14, 0x52, 0x53, 0xEC, 0x4F, 0x29,
+    0x9E, 0xFD, 0x85, 0x38, 0xFE, 0xF4, 0x1B, 0x77, 0x03, 0x10, 0x81, 0x4F, 0xF0, 0xF8, 0xDB, 0x14,
+    0x12, 0x4F, 0xD0, 0xC0, 0x1A, 0xB8, 0x80, 0x8B, 0x27, 0x27, 0xD1, 0x48, 0x09, 0x47, 0x7D, 0x62,
+    0x88, 0xE8, 0xF4, 0x39, 0xDD, 0xE4, 0xD2, 0x79, 0xE9, 0xD4, 0xE4, 0x6D, 0xE8, 0xF3, 0xC4, 0x43,
+    0xC0, 0x24, 0x3C, 0xF4, 0x08, 0x1C, 0xB0, 0xCA, 0x0C, 0xAE, 0x61, 0x4A, 0xCE, 0x3F, 0x94, 0x69,
+    0xA9, 0x8A, 0xB7, 0x09, 0x7C, 0x1C, 0x3E, 0x8A, 0x0D, 0xAE, 0x02, 0x1B, 0x0B, 0x68, 0x7D, 0xC4,
+    0x3F, 0xD5, 0xA0, 0xD2, 0x75, 0x18, 0x65, 0x25, 0xE6, 0x9B, 0x35, 0x5C, 0xEF, 0xC0, 0xCB, 0x1C,
+    0x5A, 0xE5, 0x0D, 0x18, 0x29, 0x61, 0x3C, 0x05, 0xF7, 0x56, 0x82, 0x6E, 0x12, 0xC9, 0x9E, 0x9F,
+    0xA2, 0x9B, 0x22, 0x51, 0x28, 0x89, 0xB6, 0xF6, 0xB3, 0xD5, 0x79, 0x02, 0x63, 0x6B, 0x9E, 0x63,
+    0x20, 0x1D, 0xF1, 0xAD, 0x5A, 0x7D, 0x33, 0x9A, 0xD7, 0x31, 0xC7, 0xB8, 0x84, 0xAF, 0xC9, 0x12,
+    0x1B, 0x1D, 0x83, 0x1B, 0xEC, 0x16, 0xE1, 0x5A, 0x7E, 0x13, 0x1E, 0x59, 0x4C, 0x99, 0xAA, 0xD9,
+    0x63, 0x9D, 0x2C, 0x98, 0x7F, 0x6B, 0x2A, 0x7E, 0xA5, 0x6E, 0xF1, 0xFB, 0x23, 0xF8, 0xE1, 0x9B,
+    0x91, 0xB5, 0xFD, 0xD4, 0xAF, 0x4C, 0x21, 0x11, 0xF7, 0xFA, 0x0C, 0xDA, 0xF7, 0x1B, 0xB2, 0xEC,
+    0xD9, 0xA8, 0x7F, 0x90, 0x84, 0xD1, 0x27, 0x7D, 0x6B, 0x2B, 0xC6, 0x15, 0xA8, 0xB0, 0xC2, 0x35,
+    0xF5, 0x1F, 0x37, 0xD8, 0xFC, 0xFD, 0x60, 0xAE, 0x57, 0xFC, 0x72, 0x83, 0x17, 0xF8, 0x93, 0x8E,
+    0xF5, 0xDF, 0xA9, 0xCD, 0xEB, 0x79, 0xD8, 0x65, 0x0A, 0xA6, 0xCA, 0x43, 0x26, 0x59, 0xB9, 0x34,
+    0xFB, 0x5A, 0xC9, 0xC8, 0x47, 0x32, 0x1F, 0x71, 0xAF, 0x47, 0xCC, 0xF7, 0x2B, 0x94, 0x54, 0x20,
+    0x35, 0x14, 0x09, 0xB2, 0x0E, 0xBC, 0x44, 0xCC, 0xF7, 0x5B, 0x74, 0x23, 0x81, 0x2E, 0x4F, 0x8C,
+    0xEC, 0x8C, 0x3C, 0x48, 0xE5, 0x63, 0xD6, 0xC1, 0x12, 0x78, 0xAC, 0x24, 0x2F, 0x89, 0x01, 0xEC,
+    0xC2, 0xB5, 0x3D, 0xDE, 0x49, 0xEA, 0x4F, 0xA2, 0x16, 0x4C, 0x87, 0x9D, 0xE2, 0x26, 0xF8, 0x67,
+    0x63, 0xE6, 0xEB, 0xDC, 0x36, 0x23, 0xD3, 0x15, 0xD2, 0xBA, 0x37, 0x44, 0x54, 0x8B, 0x49, 0xFB,
+    0x30, 0xF2, 0xB1, 0xC7, 0xB6, 0xC7, 0x1D, 0xF8, 0x57, 0x43, 0x6F, 0x41, 0xD1, 0x82, 0x11, 0x60,
+    0x9C, 0x7A, 0x13, 0xB8, 0x3B, 0x83, 0xFC, 0xD3, 0x0D, 0x26, 0x49, 0x64, 0x64, 0x67, 0x3D, 0xB0,
+    0xED, 0x94, 0x44, 0x60, 0xDC, 0xAD, 0x6D, 0x1F, 0xED, 0xF2, 0xAF, 0x12, 0x3F, 0x8C, 0xDC, 0x46,
+    0x77, 0x98, 0x16, 0xDB, 0xE1, 0xC6, 0xF8, 0xBC, 0x5C, 0xF3, 0x71, 0xC3, 0x25, 0x4E, 0xC0, 0x69,
+    0x8E, 0x31, 0xB5, 0xA9, 0xF1, 0xC1, 0x07, 0xF6, 0xD8, 0x43, 0x27, 0x93, 0xF0, 0xA5, 0x8F, 0xEC,
+    0xB3, 0x8F, 0x6E, 0x74, 0x83, 0x8F, 0x3E, 0x52, 0x30, 0x16, 0x69, 0xB5, 0x88, 0x54, 0x5E, 0x44,
+    0x28, 0x44, 0x3A, 0xD5, 0xE1, 0x6B, 0x5F, 0x53, 0x84, 0x22, 0xA8, 0x4E, 0x75, 0xB8, 0x54, 0x03,
+    0x36, 0xCC, 0x61, 0x3C, 0x17, 0x00, 0x76, 0xA8, 0x07, 0xEC, 0x78, 0xD6, 0x6D, 0xE9, 0x75, 0x65,
+    0x62, 0xD2, 0xF5, 0xE8, 0x6A, 0xEF, 0xAC, 0x62, 0xA2, 0xFB, 0x4A, 0x32, 0xD5, 0xB1, 0x7A, 0xA7,
+    0x84, 0xEA, 0x7E, 0x5A, 0x67, 0x88, 0x12, 0x89, 0x2A, 0xE1, 0x44, 0x70, 0x71, 0x11, 0xC0, 0x5A,
+    0xA0, 0xC5, 0x56, 0x60, 0x2B, 0xF2, 0xBE, 0xA8, 0xEC, 0x80, 0x0E, 0x53, 0x83, 0xAD, 0xC9, 0x03,
+    0xE4, 0x25, 0x1D, 0x20, 0x22, 0x09, 0x8C, 0x88, 0x44, 0xC8, 0x44, 0x66, 0xFD, 0xB9, 0x06, 0x4C,
+    0x43, 0x16, 0x21, 0x8B, 0x4C, 0x80, 0x09, 0xA6, 0x05, 0xD3, 0x92, 0x55, 0x3D, 0xA0, 0x90, 0x7A,
+    0x9D, 0x2F, 0x5F, 0x34, 0xD1, 0xC1, 0x2E, 0x09, 0x17, 0x3C, 0x24, 0x5D, 0xE3, 0xAF, 0x5E, 0x47,
+    0x8B, 0x44, 0x0A, 0xE9, 0x30, 0xD1, 0x95, 0xEC, 0xD1, 0xE0, 0xCA, 0x0C, 0x18, 0xCB, 0x0C, 0x9C,
+    0x48, 0x05, 0x89, 0x3D, 0xF0, 0xB8, 0x88, 0x4A, 0x74, 0xB0, 0x49, 0x56, 0x62, 0x2A, 0xDD, 0xC0,
+    0x80, 0x62, 0x3B, 0xD8, 0x68, 0x44, 0xC2, 0x11, 0xE3, 0x83, 0x3D, 0x1F, 0x5C, 0xAD, 0xAB, 0x44,
+    0xC7, 0x46, 0x86, 0x2F, 0xF5, 0xAD, 0xA4, 0x1A, 0x06, 0x23, 0x72, 0xFC, 0xD3, 0x95, 0x49, 0x59,
+    0xDA, 0xA3, 0x98, 0xD7, 0x47, 0x78, 0x91, 0xC0, 0x70, 0x7B, 0x0F, 0x95, 0x54, 0xC2, 0x95, 0xAE,
+    0x64, 0xC8, 0x10, 0x12, 0x09, 0x17, 0x6D, 0x64, 0xC4, 0x08, 0x1A, 0xDE, 0xBD, 0x68, 0xA3, 0x95,
+    0xE9, 0x26, 0xF9, 0xC1, 0x1E, 0xB4, 0x5C, 0xC3, 0x44, 0x5D, 0xB1, 0x86, 0x83, 0x86, 0x01, 0x26,
+    0xEA, 0x9A, 0x0C, 0x81, 0x63, 0xBB, 0x48, 0x8C, 0xA7, 0x01, 0x3D, 0xA5, 0x87, 0x38, 0x14, 0x01,
+    0xE8, 0xC8, 0x1B, 0x9D, 0xD4, 0xDD, 0x63, 0x53, 0xD9, 0xF2, 0x8C, 0x2B, 0x3D, 0x67, 0x7C, 0x18,
+    0x30, 0xC8, 0xD8, 0xE2, 0x68, 0x93, 0x6B, 0x3A, 0x0D, 0x69, 0x5C, 0x35, 0xA4, 0x29, 0xC2, 0x88,
+    0xD9, 0xF4, 0x4C, 0x51, 0x8A, 0xCC, 0x72, 0x11, 0x99, 0x7A, 0x11, 0x39, 0x50, 0x93, 0x45, 0xCD,
+    0xEE, 0x22, 0x8C, 0x63, 0x4F, 0x8D, 0x44, 0xD7, 0xBA, 0xB0, 0x7B, 0x66, 0x85, 0xEA, 0xD4, 0x19,
+    0x53, 0xAE, 0x0F, 0x4C, 0xD8, 0xD9, 0xB2, 0x2A, 0x0D, 0xDC, 0xA7, 0xE2, 0xC8, 0xC9, 0x2F, 0x15,
+    0x22, 0x53, 0x27, 0xF2, 0x60, 0xBE, 0x7E, 0xB6, 0x85, 0xB1, 0x44, 0xF2, 0xEF, 0x7E, 0x01, 0x5F,
+    0xF7, 0xD5, 0x0F, 0x53, 0xFA, 0x62, 0xDA, 0x24, 0x7A, 0x38, 0xE8, 0x63, 0x9F, 0x81, 0xC8, 0x22,
+    0x28, 0x01, 0xB2, 0xD9, 0x3F, 0x4D, 0x4A, 0x64, 0x86, 0x17, 0xA9, 0x18, 0x4B, 0x07, 0x13, 0x29,
+    0xE1, 0x23, 0x01, 0x78, 0x82, 0x1F, 0xAD, 0xBE, 0x9E, 0xAD, 0xBC, 0x84, 0x0E, 0x17, 0x19, 0xA0,
+    0x12, 0xAE, 0xEC, 0x51, 0x80, 0x9E, 0x5D, 0x31, 0x52, 0x6B, 0x29, 0x79, 0x02, 0x15, 0x99, 0x72,
+    0x62, 0x7B, 0xFB, 0x62, 0x21, 0x32, 0x1B, 0x8B, 0x74, 0x8F, 0xDA, 0x08, 0xBE, 0xEC, 0x21, 0x69,
+    0x36, 0xCF, 0xAF, 0xA3, 0xB9, 0x3D, 0xC7, 0xBD, 0x39, 0xAA, 0x05, 0x3D, 0x2F, 0xD7, 0x6C, 0xEA,
+    0x91, 0xA3, 0x6F, 0x7A, 0xFA, 0x66, 0x9E, 0x26, 0xC8, 0xA5, 0xFB, 0xE4, 0x8D, 0x57, 0xD8, 0x82,
+    0x1D, 0x48, 0x90, 0x50, 0x35, 0x3D, 0x12, 0xB4, 0x11, 0x57, 0xE2, 0x23, 0xAA, 0xEC, 0xF7, 0x04,
+    0x4D, 0x8B, 0x7F, 0x3E, 0x71, 0xEC, 0xA2, 0xAB, 0xB2, 0x72, 0x9F, 0xC2, 0x24, 0xBA, 0x02, 0xF3,
+    0x5E, 0x83, 0x93, 0x92, 0xAC, 0x83, 0x22, 0xC2, 0xB4, 0x7F, 0x5C, 0x5E, 0xC2, 0xB4, 0x7F, 0x6A,
+    0x11, 0xD1, 0x33, 0x60, 0x97, 0xDD, 0x3D, 0xD2, 0x9E, 0xAE, 0x07, 0x36, 0x0E, 0x7C, 0x18, 0x6C,
+    0x32, 0x1C, 0x30, 0xBC, 0x46, 0x9E, 0xC8, 0x23, 0x79, 0x49, 0xBE, 0x00, 0x41, 0xD7, 0xC1, 0x07,
+    0x46, 0xBE, 0xA4, 0xF3, 0x51, 0x27, 0x17, 0x6D, 0x65, 0x2B, 0x5F, 0xDA, 0xBA, 0xC0, 0xA4, 0xEB,
+    0x98, 0x77, 0x5B, 0xB4, 0x24, 0x94, 0x44, 0x94, 0x94, 0x14, 0xD2, 0x50, 0x48, 0x42, 0x77, 0x60,
+    0x5A, 0x70, 0x0D, 0xF8, 0x04, 0x59, 0x0D, 0x7C, 0x81, 0x2F, 0xB0, 0x47, 0xC3, 0x9E, 0xAE, 0x19,
+    0x98, 0xC8, 0xC0, 0x07, 0x06, 0x6B, 0x30, 0x1C, 0xC0, 0xF0, 0x1A, 0x8C, 0x12, 0xE4, 0x91, 0x5C,
+    0xA4, 0x2C, 0x44, 0xC2, 0x8F, 0x4C, 0x25, 0xC0, 0xC9, 0xC0, 0x49, 0x74, 0xC2, 0x07, 0x86, 0xF8,
+    0x80, 0x8F, 0xBE, 0x44, 0x25, 0x5F, 0xC2, 0xC8, 0x97, 0xE0, 0xDF, 0x8A, 0xD0, 0x47, 0xBE, 0x22,
+    0xD2, 0x97, 0xC6, 0xBD, 0x2F, 0x7B, 0x09, 0xE0, 0xDF, 0x4C, 0xE0, 0xBF, 0xD5, 0x81, 0xAF, 0x8B,
+    0x12, 0x5F, 0xBB, 0x84, 0x4F, 0x6A, 0x86, 0x4F, 0x14, 0xB7, 0x62, 0x0F, 0xA9, 0x17, 0x29, 0xFB,
+    0xE1, 0x7E, 0xB7, 0xB1, 0xCA, 0x8E, 0x0D, 0xE6, 0x2B, 0x15, 0x83, 0x5D, 0xD4, 0xAC, 0xC7, 0x45,
+    0x2D, 0x8C, 0x23, 0xD9, 0x10, 0x7B, 0x2B, 0xA9, 0x26, 0x0B, 0x97, 0x69, 0x2F, 0xC0, 0x23, 0x40,
+    0xFC, 0xF8, 0xD5, 0x57, 0x4E, 0x14, 0xD2, 0xAD, 0x30, 0xE4, 0x0C, 0x03, 0xD6, 0xD9, 0x63, 0xC0,
+    0x11, 0x5B, 0x24, 0x76, 0x48, 0x1C, 0xEA, 0x9A, 0x64, 0x2A, 0x6A, 0x13, 0x55, 0x65, 0xA3, 0x8E,
+    0x4E, 0xA4, 0xF3, 0xF3, 0xDF, 0x9E, 0x02, 0xA4, 0x01, 0x52, 0xCF, 0x35, 0x52, 0xC8, 0x32, 0xD5,
+    0x29, 0x15, 0x57, 0x4D, 0x3C, 0x6B, 0xCA, 0xF3, 0x96, 0x73, 0x8E, 0x4B, 0x2B, 0x5C, 0xF1, 0xD2,
+    0x65, 0xD2, 0x31, 0x77, 0x97, 0xCF, 0x2D, 0x05, 0x5D, 0x1E, 0xB3, 0xE7, 0x83, 0x2B, 0x13, 0xCD,
+    0x0A, 0x5E, 0x55, 0x2A, 0xAD, 0x32, 0x52, 0xD1, 0x55, 0xD9, 0x37, 0x3A, 0x26, 0xB7, 0x4B, 0x68,
+    0xC0, 0xF7, 0xB0, 0x6D, 0xB3, 0xA7, 0x0B, 0x87, 0x35, 0xE6, 0x37, 0xFB, 0xDA, 0x6D, 0x00, 0x8A,
+    0x8F, 0xEA, 0x5B, 0x71, 0xB0, 0x65, 0x9E, 0x0F, 0x3B, 0xE7, 0x9C, 0xD1, 0x29, 0x9F, 0xA2, 0x22,
+    0xEB, 0x98, 0x92, 0xF3, 0xD8, 0x43, 0x3E, 0x0E, 0x15, 0xE0, 0xD0, 0x55, 0x62, 0xB0, 0x82, 0xBD,
+    0x55, 0x71, 0x34, 0xC0, 0x3F, 0x1D, 0x55, 0xDA, 0xDD, 0x1A, 0xB9, 0x17, 0x3E, 0x5D, 0xDD, 0x78,
+    0xBF, 0x33, 0x22, 0xF1, 0xF1, 0xB6, 0x65, 0xD5, 0x07, 0x7D, 0x2B, 0xB1, 0x55, 0x80, 0xA9, 0x79,
+    0x98, 0x27, 0xE3, 0xA9, 0xB3, 0xFA, 0xB5, 0xB0, 0x75, 0xE9, 0x99, 0x67, 0x7E, 0x26, 0x8D, 0x45,
+    0x4F, 0x6B, 0x73, 0x86, 0xBF, 0x1B, 0x1F, 0x19, 0xC0, 0x59, 0xF0, 0x60, 0x4B, 0x74, 0x5F, 0x10,
+    0xCE, 0x6B, 0xF8, 0xAF, 0x5E, 0x30, 0x22, 0x6A, 0xAA, 0xE3, 0x31, 0x3B, 0x43, 0x56, 0x3D, 0xDE,
+    0x95, 0xE6, 0xB5, 0x4A, 0xD5, 0x0D, 0xED, 0x1E, 0xC3, 0xFB, 0x55, 0x68, 0xBF, 0x6E, 0xEB, 0x3F,
+    0x65, 0x15, 0xFA, 0x04, 0xCF, 0xD6, 0x26, 0x16, 0x12, 0x8B, 0xAF, 0x95, 0x9E, 0xC9, 0x2C, 0xEC,
+    0xF0, 0xBE, 0x7C, 0x3F, 0x64, 0xAF, 0x4A, 0x6B, 0x44, 0x24, 0xEC, 0x6F, 0xF7, 0x31, 0x8B, 0x8E,
+    0xBE, 0xCE, 0x63, 0x52, 0x2D, 0x05, 0x23, 0xD2, 0x90, 0x8B, 0xD0, 0x17, 0x23, 0x8F, 0x01, 0xB0,
+    0xAC, 0x67, 0xE6, 0x9B, 0xD5, 0x95, 0xFC, 0xED, 0x53, 0xE6, 0xB6, 0x28, 0x91, 0xF8, 0x2E, 0x0C,
+    0xC0, 0x07, 0xCC, 0xEC, 0xB7, 0x18, 0x4B, 0xD0, 0x12, 0x2E, 0x30, 0x3E, 0xD8, 0xD4, 0x32, 0xB3,
+    0x7F, 0xD2, 0xA8, 0x38, 0x9E, 0x5D, 0xD8, 0xD2, 0xEF, 0xCB, 0x6D, 0xEE, 0x8A, 0xC4, 0x89, 0x48,
+    0x3D, 0xBA, 0xD8, 0x47, 0x32, 0x5B, 0x81, 0x9A, 0x02, 0xC5, 0x9D, 0x2F, 0x45, 0x27, 0x52, 0x33,
+    0x91, 0x86, 0x25, 0x79, 0x7B, 0xCE, 0x8A, 0x55, 0xF7, 0x6A, 0xDE, 0x55, 0x3B, 0xB5, 0x6F, 0x96,
+    0xD5, 0xF8, 0xED, 0x55, 0xF3, 0xAA, 0x68, 0x91, 0xF8, 0x5D, 0xD8, 0x82, 0x0C, 0xCC, 0xDD, 0xDF,
+    0x64, 0x22, 0x2C, 0x49, 0xE0, 0x11, 0x30, 0x3F, 0x0D, 0x5D, 0xBA, 0x38, 0x56, 0x38, 0x07, 0x90,
+    0xD6, 0x7A, 0xEC, 0x1E, 0x01, 0xF2, 0x0F, 0x25, 0x98, 0xC1, 0x55, 0x79, 0xCA, 0x4A, 0x0A, 0x33,
+    0x33, 0x09, 0x93, 0x8A, 0xD8, 0x41, 0xF6, 0x7C, 0x57, 0x00, 0x5D, 0xF1, 0x62, 0x05, 0xEE, 0x3B,
+    0x3F, 0x68, 0x80, 0x62, 0xBC, 0x0F, 0x68, 0x91, 0x12, 0xF0, 0x92, 0x00, 0xA4, 0x2F, 0x8B, 0xA4,
+    0x06, 0x9C, 0x48, 0xCF, 0x80, 0x76, 0x80, 0x4C, 0x26, 0x35, 0x14, 0xDF, 0xBF, 0x23, 0x81, 0xAC,
+    0x95, 0x97, 0x3A, 0xEC, 0xCC, 0x37, 0xE3, 0x5A, 0xCB, 0x2D, 0x79, 0x5A, 0xC2, 0xE2, 0xD9, 0x87,
+    0xA6, 0x04, 0x17, 0x0E, 0x81, 0xA2, 0x03, 0xD4, 0xEC, 0x43, 0x0C, 0x3C, 0xC1, 0xB6, 0x0A, 0xB4,
+    0xBE, 0xDA, 0xC3, 0xDE, 0xEC, 0x32, 0x18, 0xE5, 0x2F, 0x44, 0xF4, 0x0F, 0xDE, 0x49, 0xE0, 0xC7,
+    0x7B, 0x80, 0x08, 0x60, 0xA5, 0x02, 0xC6, 0xED, 0xA2, 0x7E, 0xF3, 0x22, 0x60, 0xDE, 0x7F, 0xBF,
+    0x41, 0xCD, 0xC6, 0x45, 0x64, 0xF2, 0xD2, 0x3B, 0x42, 0xF1, 0x2D, 0xF1, 0x0D, 0x3C, 0xC4, 0x05,
+    0x76, 0x7C, 0xA9, 0xE3, 0x31, 0xDE, 0x45, 0x76, 0xF7, 0x30, 0x6F, 0x44, 0xFC, 0x10, 0x7E, 0xAF,
+    0xC2, 0xCC, 0xC0, 0x4B, 0xC9, 0x71, 0x56, 0x99, 0xDA, 0xC7, 0x0C, 0xCF, 0x31, 0x03, 0x53, 0x93,
+    0xB2, 0xE0, 0x22, 0x0C, 0xC1, 0x26, 0xB4, 0xF4, 0x81, 0xF1, 0x09, 0x20, 0x84, 0xD5, 0x81, 0x79,
+    0x91, 0xBF, 0x16, 0xED, 0x0E, 0x53, 0xFC, 0xDB, 0xFA, 0x56, 0x3D, 0x70, 0x36, 0x5C, 0x3A, 0x74,
+    0xA8, 0x5A, 0x1D, 0xCF, 0x09, 0x49, 0x2B, 0x53, 0x9C, 0x74, 0xF8, 0xF2, 0x98, 0x8C, 0x96, 0x9C,
+    0x86, 0x91, 0x4A, 0xEC, 0x99, 0x9A, 0x63, 0x53, 0xD1, 0xD8, 0xA8, 0x92, 0x8B, 0xBA, 0xF6, 0xA5,
+    0xA9, 0xB2, 0xE0, 0x62, 0x7E, 0x30, 0x2E, 0x8B, 0x74, 0x83, 0x71, 0xD5, 0x67, 0xC6, 0x02, 0xD8,
+    0x07, 0x2E, 0xC2, 0x89, 0x8B, 0x14, 0x53, 0xB6, 0xD6, 0xD9, 0xD9, 0xE2, 0xF0, 0x3C, 0xF5, 0xA1,
+    0xAA, 0x92, 0x8E, 0xB5, 0xF9, 0x4A, 0xE5, 0x4C, 0x33, 0x32, 0x09, 0x5D, 0x61, 0x63, 0x3F, 0x7B,
+    0x9C, 0xC6, 0x07, 0xF6, 0xC8, 0xE0, 0x98, 0x1C, 0xDA, 0xBE, 0x2A, 0xBE, 0x8C, 0x4E, 0x1C, 0x63,
+    0x12, 0x5D, 0xFF, 0x8F, 0xAD, 0x75, 0x8B, 0xAF, 0x8C, 0x88, 0x44, 0x23, 0x22, 0xD1, 0x8A, 0x48,
+    0xE9, 0x44, 0x24, 0xF8, 0x8A, 0x71, 0x8F, 0xB3, 0xF2, 0x88, 0x94, 0x45, 0xA9, 0x24, 0x00, 0x13,
+    0xE6, 0x59, 0xBA, 0x98, 0x02, 0x93, 0x96, 0xC5, 0x86, 0xFA, 0x00, 0x58, 0xB4, 0x1F, 0x00, 0x8B,
+    0xFE, 0x2B, 0xC9, 0xD4, 0xC7, 0xAA, 0xAF, 0xCF, 0x27, 0x81, 0x49, 0xE0, 0x7F, 0xDD, 0xD4, 0xFA,
+    0xA7, 0x30, 0x75, 0x46, 0x51, 0xAA, 0x29, 0xC0, 0x98, 0x39, 0xDE, 0xA0, 0xA3, 0x4F, 0xE6, 0xD8,
+    0x34, 0x6F, 0x03, 0xF4, 0xF6, 0xAE, 0xB3, 0xE3, 0xD9, 0xF8, 0xF3, 0xC0, 0x6D, 0x82, 0x21, 0x64,
+    0xE0, 0x02, 0x36, 0xF2, 0x08, 0x27, 0x6D, 0x34, 0xB7, 0x6A, 0x95, 0x12, 0x47, 0x03, 0x86, 0x2B,
+    0x78, 0x1B, 0xDC, 0xCD, 0xCA, 0x56, 0xA3, 0x57, 0x93, 0x9D, 0x75, 0xB0, 0xD9, 0xC7, 0x90, 0x88,
+    0xEA, 0x69, 0xB2, 0x41, 0x7F, 0x37, 0x98, 0x92, 0x87, 0xD5, 0x33, 0xFC, 0x7A, 0x79, 0xBE, 0x5A,
+    0x3D, 0xE7, 0x57, 0xDD, 0xF3, 0xB7, 0xAB, 0x1B, 0x87, 0x0C, 0xD8, 0xC4, 0x07, 0xD3, 0x17, 0x5C,
+    0x2C, 0x5D, 0x41, 0x5F, 0xA1, 0xA8, 0x28, 0x22, 0x12, 0xF4, 0x0C, 0x3B, 0xC3, 0xB7, 0xE4, 0x2D,
+    0x52, 0x21, 0xC9, 0x09, 0xF6, 0x76, 0x2C, 0x8E, 0xC9, 0xC7, 0xE6, 0xBD, 0x44, 0x3B, 0xCD, 0xBE,
+    0x56, 0xDA, 0x37, 0x9A, 0xEE, 0x3A, 0xB9, 0xBF, 0xFD, 0x46, 0xA2, 0x2B, 0x66, 0x59, 0xB4, 0x69,
+    0x92, 0x84, 0xFC, 0x2B, 0xF2, 0x74, 0xCB, 0xD4, 0x76, 0x59, 0x65, 0x93, 0x8F, 0x12, 0xF2, 0xF8,
+    0x33, 0xA6, 0x43, 0x20, 0x4B, 0x2C, 0x26, 0xA2, 0x87, 0x8B, 0x74, 0xDC, 0x9B, 0x94, 0x82, 0xC5,
+    0x4C, 0x81, 0xA9, 0x4C, 0x9D, 0x95, 0x79, 0x10, 0xD5, 0x99, 0xCE, 0xA7, 0xB5, 0xF4, 0x7B, 0xF1,
+    0x87, 0xBF, 0xFF, 0x5F, 0xCD, 0xEB, 0x7B, 0xCD, 0x5A, 0xF1, 0x9D, 0x78, 0x4D, 0x72, 0x73, 0xAB,
+    0xE9, 0x32, 0xFB, 0x7C, 0x7D, 0x4C, 0x1E, 0xEE, 0x77, 0xC3, 0x22, 0x6C, 0xA0, 0x0E, 0x36, 0x4C,
+    0x1C, 0xD8, 0x78, 0xE4, 0x43, 0xCA, 0x74, 0x3D, 0x34, 0x71, 0xCF, 0x95, 0xCD, 0x62, 0x77, 0x1B,
+    0x56, 0xC1, 0x94, 0x3B, 0x60, 0xA4, 0xE6, 0xC7, 0xD8, 0xF4, 0xBE, 0x6B, 0x00, 0xE8, 0x0E, 0x30,
+    0x1D, 0xE0, 0x8F, 0x81, 0x6C, 0x00, 0x0C, 0x86, 0xC0, 0xD1, 0x10, 0x54, 0x1A, 0x82, 0xA9, 0x46,
+    0xE0, 0xE2, 0x08, 0x32, 0x72, 0x18, 0x91, 0xC3, 0xE4, 0xEA, 0x04, 0x44, 0x04, 0x23, 0x22, 0xC1,
+    0x56, 0xE4, 0xC1, 0x47, 0xF2, 0xB2, 0x08, 0xE4, 0x73, 0xE6, 0xD0, 0x84, 0x53, 0x30, 0xB0, 0x25,
+    0x5A, 0xEA, 0x1E, 0xEF, 0xFC, 0xC8, 0xB1, 0xD4, 0x1E, 0xA0, 0x65, 0x0A, 0x47, 0x2E, 0xB2, 0xC6,
+    0x00, 0x13, 0x6D, 0x64, 0x87, 0x5D, 0x1C, 0xBE, 0x24, 0xE9, 0x06, 0xFF, 0x15, 0x01, 0x91, 0x84,
+    0x95, 0xDB, 0x90, 0x7D, 0xB7, 0x06, 0x4C, 0xB5, 0x07, 0x2E, 0x76, 0xE0, 0x6F, 0xB6, 0x70, 0xE2,
+    0xC9, 0x8B, 0xFF, 0x6F, 0x46, 0x94, 0x9B, 0x1A, 0x53, 0x5F, 0x86, 0x7D, 0x5F, 0x71, 0x22, 0x5C,
+    0xFC, 0xDF, 0x1E, 0x08, 0x70, 0xE2, 0x62, 0x1F, 0xDE, 0xBB, 0xBE, 0x61, 0xD4, 0x32, 0x6F, 0xD1,
+    0xC0, 0x7B, 0x0D, 0x80, 0x79, 0x23, 0x01, 0xB8, 0x17, 0x6A, 0x80, 0xCC, 0x7E, 0xF7, 0x0B, 0xC0,
+    0x9E, 0x95, 0x0E, 0x48, 0x4E, 0x5A, 0x30, 0x95, 0x8F, 0x80, 0x2B, 0x7D, 0x04, 0xF2, 0xAB, 0x93,
+    0x08, 0x8C, 0x45, 0x7A, 0xBA, 0x46, 0xBE, 0xF7, 0x0A, 0x26, 0x31, 0x96, 0x29, 0x3E, 0x32, 0x91,
+    0x29, 0x79, 0x40, 0x64, 0xFA, 0xE0, 0x84, 0x9D, 0x86, 0xC7, 0xBF, 0xED, 0xA7, 0x68, 0x91, 0x66,
+    0x95, 0x4D, 0x3D, 0x63, 0x4B, 0xD5, 0xA6, 0xFE, 0x48, 0xED, 0xC9, 0x44, 0xCA, 0x1D, 0xC6, 0x57,
+    0x2F, 0xEA, 0x68, 0x6A, 0xF0, 0xE4, 0x25, 0x8C, 0xAC, 0x84, 0x87, 0x10, 0x91, 0xF7, 0x93, 0x92,
+    0xF7, 0x45, 0xA2, 0x9A, 0xFD, 0x9D, 0x67, 0xE7, 0xF4, 0xDD, 0x2A, 0x87, 0xEC, 0xDA, 0x80, 0x34,
+    0x1F, 0x74, 0xB7, 0xB1, 0x24, 0x7D, 0xF7, 0x6A, 0xE9, 0x7B, 0xFE, 0x4A, 0xD7, 0x7D, 0x55, 0x50,
+    0x48, 0x52, 0x77, 0xAF, 0x96, 0xAE, 0x6F, 0xD4, 0x92, 0xC0, 0x96, 0x90, 0x4B, 0x87, 0x48, 0x32,
+    0x7D, 0x42, 0x04, 0xB6, 0x88, 0xA4, 0x35, 0x94, 0xA4, 0x1E, 0x02, 0x3C, 0x70, 0x04, 0x18, 0x27,
+    0xDC, 0xC1, 0x21, 0xD7, 0xA8, 0x6C, 0xF9, 0xD9, 0x50, 0xC8, 0x4C, 0xCD, 0xBE, 0x7E, 0xC1, 0x05,
+    0x18, 0x02, 0xD7, 0x79, 0x54, 0x89, 0x44, 0x2D, 0x33, 0xD4, 0xE4, 0x00, 0xC6, 0x6F, 0x93, 0x4B,
+    0x6D, 0x44, 0x78, 0x54, 0xB5, 0xE0, 0x4A, 0xD8, 0x3D, 0xF1, 0xC5, 0x89, 0x16, 0x49, 0x9B, 0x17,
+    0x36, 0x54, 0xB4, 0x61, 0xD9, 0xD6, 0x14, 0x4D, 0x5F, 0x9A, 0x7F, 0x31, 0x20, 0x33, 0xC6, 0x52,
+    0x9D, 0x5E, 0xEA, 0x7A, 0x04, 0x11, 0x39, 0x91, 0x44, 0x9A, 0xE2, 0x4F, 0xF7, 0x96, 0xD9, 0x30,
+    0x61, 0x93, 0x2F, 0x5F, 0xC7, 0x2E, 0xC8, 0xCB, 0xD3, 0x27, 0x60, 0x64, 0x2A, 0xB2, 0xE7, 0x12,
+    0xBE, 0xEA, 0x3E, 0x1C, 0x15, 0x64, 0x77, 0xFA, 0xBC, 0xEE, 0xA5, 0x43, 0x91, 0x95, 0x73, 0x66,
+    0x6F, 0x97, 0xC7, 0xAE, 0x76, 0xE4, 0x22, 0xB8, 0x5F, 0x75, 0x41, 0x45, 0x1B, 0x38, 0x9F, 0x95,
+    0x18, 0x09, 0xF3, 0xEE, 0xD2, 0xC7, 0x0F, 0xF0, 0x52, 0x2B, 0x91, 0x70, 0x7A, 0xA9, 0xEB, 0x59,
+    0xC5, 0x01, 0xFC, 0x85, 0x28, 0xD2, 0xF8, 0xBB, 0xBF, 0x40, 0xA5, 0xAB, 0x65, 0x8E, 0xB8, 0x33,
+    0x21, 0x97, 0xDA, 0xA4, 0xCB, 0xDC, 0xF0, 0x15, 0x40, 0xEB, 0x03, 0x90, 0x3D, 0x95, 0x00, 0xDD,
+    0x14, 0x00, 0x8F, 0xDD, 0x6F, 0xD0, 0xFF, 0x7F, 0x45, 0x2A, 0x36, 0xB6, 0x40, 0xE7, 0x4B, 0xC8,
+    0x9E, 0x6B, 0x40, 0x5D, 0x7C, 0xEC, 0xC3, 0x42, 0x94, 0xAF, 0x17, 0xF0, 0x64, 0xD8, 0xC3, 0x93,
+    0x77, 0x1B, 0xC8, 0x8A, 0xCB, 0xC0, 0xFB, 0xB7, 0x03, 0xB8, 0x0F, 0xC0, 0x13, 0xF7, 0xE7, 0xC0,
+    0x93, 0x13, 0x5C, 0x60, 0xE8, 0xA2, 0x4E, 0x05, 0xFE, 0xD6, 0x3D, 0xCE, 0x59, 0xFD, 0x56, 0xA0,
+    0x90, 0xC8, 0x05, 0x57, 0xC2, 0x5A, 0x1F, 0x61, 0x6D, 0xE4, 0x8B, 0x5D, 0x4F, 0xE4, 0xB9, 0x08,
+    0x0E, 0xD8, 0x00, 0x95, 0x34, 0x79, 0x99, 0xDD, 0xEE, 0x98, 0x48, 0x64, 0xB2, 0x08, 0x69, 0xAE,
+    0x6C, 0x18, 0xB9, 0xA8, 0x9B, 0xE2, 0xC1, 0xC8, 0xE0, 0x1A, 0x78, 0xF4, 0x89, 0xBE, 0x5E, 0xB1,
+    0xE0, 0xEB, 0xBE, 0xB8, 0x30, 0x25, 0x2C, 0xC3, 0x93, 0x09, 0x27, 0x81, 0xFC, 0x6D, 0xE0, 0xEA,
+    0xD7, 0x95, 0x08, 0xAC, 0xC1, 0xF1, 0x9C, 0xA3, 0xD9, 0x87, 0x67, 0xAB, 0x45, 0xB9, 0x9B, 0x4E,
+    0x98, 0x3A, 0xBF, 0x5D, 0xE5, 0x52, 0xDA, 0x3B, 0xFD, 0xC5, 0x33, 0xD8, 0x84, 0xA3, 0xF9, 0xC5,
+    0x37, 0xE0, 0xD5, 0x0A, 0xB5, 0xB8, 0xD8, 0xD6, 0xC5, 0xAB, 0xB1, 0x90, 0x60, 0xEF, 0x00, 0x8F,
+    0x7D, 0xB1, 0x44, 0xC9, 0x1C, 0x18, 0xEA, 0x03, 0x20, 0x0B, 0xAA, 0xE3, 0x18, 0x5F, 0x9B, 0x84,
+    0x04, 0x5F, 0xFA, 0x8E, 0x63, 0x26, 0xC9, 0x24, 0x7B, 0x3B, 0xF8, 0x72, 0xFF, 0x98, 0xCB, 0xE6,
+    0x3B, 0x49, 0xA7, 0x22, 0x2B, 0xFD, 0xAD, 0x74, 0x9D, 0xFD, 0xFC, 0xE9, 0xA4, 0xDF, 0x6D, 0xB2,
+    0xE8, 0xDF, 0x2A, 0x67, 0x14, 0x9D, 0x69, 0x94, 0xC4, 0x2C, 0xBA, 0x0E, 0xA1, 0xA8, 0x4C, 0x0B,
+    0x27, 0x7E, 0xFE, 0xE5, 0x1E, 0xF3, 0xDF, 0xEF, 0x43, 0x06, 0x1F, 0xD7, 0x99, 0x91, 0xDC, 0x35,
+    0x5B, 0xFE, 0xEB, 0xB8, 0xE1, 0x3E, 0x4D, 0xBA, 0xB6, 0x65, 0xFE, 0xE0, 0xB9, 0x6A, 0xED, 0xC8,
+    0x33, 0x29, 0x07, 0xA6, 0xD5, 0xB5, 0x8F, 0x3E, 0xC0, 0xC8, 0x44, 0x54, 0x93, 0xD3, 0x6F, 0x98,
+    0xC7, 0xD4, 0x05, 0x4E, 0x00, 0x5C, 0xC6, 0xD6, 0x3A, 0x51, 0x94, 0x3E, 0x9A, 0x29, 0x23, 0xF2,
+    0xA4, 0x1A, 0x2D, 0xD1, 0xC7, 0xEC, 0x06, 0x23, 0xEE, 0x36, 0xAA, 0xF1, 0xAF, 0x47, 0x17, 0xBB,
+    0x7D, 0x0A, 0x77, 0xAB, 0xA1, 0xBD, 0xEE, 0xA3, 0xFB, 0x66, 0x3D, 0xA6, 0xD8, 0x37, 0x2D, 0x92,
+    0x7C, 0x65, 0x85, 0x31, 0x79, 0x32, 0x1D, 0x12, 0x7C, 0xFD, 0x93, 0x96, 0xE8, 0x0C, 0x05, 0x87,
+    0xA6, 0x35, 0x71, 0xB3, 0x5A, 0xD3, 0x6F, 0x72, 0x6D, 0x63, 0x60, 0x6E, 0x55, 0xB5, 0xDF, 0x74,
+    0xE1, 0x57, 0xEA, 0x81, 0x9E, 0x91, 0x7C, 0xED, 0xCA, 0xBE, 0x3F, 0xE6, 0x9F, 0x4C, 0xF3, 0xBC,
+    0x63, 0xD2, 0x3E, 0x70, 0xF1, 0xB1, 0xF0, 0xA0, 0x9B, 0xF6, 0x39, 0x4E, 0x24, 0xE0, 0xDF, 0xEE,
+    0xA9, 0xDB, 0x29, 0xBE, 0x22, 0x2B, 0x6D, 0x8D, 0xA9, 0x7B, 0xF5, 0x44, 0x03, 0x43, 0x8E, 0xC1,
+    0x87, 0x11, 0xB8, 0xE8, 0xCB, 0x9E, 0x5A, 0xD4, 0x0D, 0x1D, 0xBA, 0xA3, 0xF8, 0xD3, 0x2F, 0x4D,
+    0xF1, 0x22, 0x33, 0xB4, 0x88, 0x40, 0x21, 0x33, 0x50, 0x93, 0xFB, 0xAD, 0x91, 0x4C, 0xD7, 0x26,
+    0x8D, 0xD8, 0x77, 0xD5, 0x89, 0x0B, 0xF7, 0x86, 0x90, 0xD7, 0x64, 0xBF, 0x16, 0x4D, 0xB5, 0x46,
+    0x43, 0xF2, 0x78, 0x5D, 0x51, 0x0F, 0xD8, 0x30, 0xD1, 0xC6, 0xD1, 0xCF, 0xB6, 0x5A, 0x84, 0x4C,
+    0x22, 0xCF, 0xCE, 0x97, 0x47, 0x4D, 0x0E, 0xB0, 0x32, 0xC3, 0xDE, 0x79, 0xB6, 0xB2, 0x35, 0x9D,
+    0xA9, 0xC9, 0x75, 0xC2, 0xC5, 0xE9, 0xF6, 0x37, 0xD2, 0x58, 0xA4, 0xCD, 0xE1, 0xB2, 0x8B, 0x14,
+    0xBA, 0x65, 0x1C, 0xC6, 0x7D, 0xFF, 0x21, 0x2A, 0x91, 0x12, 0xB7, 0x28, 0x21, 0x1E, 0x6F, 0x71,
+    0x52, 0x9B, 0xDA, 0x73, 0xC4, 0xAE, 0xC7, 0x3D, 0x29, 0xD2, 0x6C, 0xE2, 0x75, 0xA5, 0xEB, 0x9C,
+    0x63, 0x25, 0x12, 0xBC, 0xD4, 0x7D, 0x53, 0xE9, 0xB4, 0x0A, 0xE4, 0xA6, 0xC6, 0xDF, 0x6C, 0x70,
+    0xF5, 0xF4, 0xC3, 0x23, 0x22, 0xCF, 0xBE, 0x8D, 0x12, 0x29, 0xD5, 0xEC, 0xB3, 0x8D, 0x6A, 0x29,
+    0x68, 0x71, 0xF1, 0x18, 0x9D, 0x8A, 0xED, 0x2F, 0x76, 0x99, 0xC8, 0xCC, 0x45, 0xB2, 0xA7, 0x12,
+    0x3E, 0xDE, 0x20, 0xAB, 0x32, 0x91, 0xDA, 0x88, 0x24, 0xC6, 0x52, 0xA3, 0x17, 0x29, 0xA2, 0xDF,
+    0xD9, 0x36, 0xEA, 0xA6, 0xC0, 0xDF, 0xFC, 0xB1, 0xD0, 0xFB, 0x78, 0x8B, 0x96, 0x96, 0x11, 0x49,
+    0xD7, 0xAA, 0xF6, 0xB8, 0x30, 0x96, 0xA9, 0xAE, 0x49, 0x2E, 0xB8, 0x32, 0xE7, 0x98, 0xB1, 0x54,
+    0xC8, 0x0C, 0x26, 0x25, 0xD0, 0x64, 0x90, 0x9B, 0xD4, 0x2F, 0xF4, 0x63, 0x27, 0x1E, 0x8C, 0x96,
+    0x93, 0x0A, 0x6E, 0x4C, 0x22, 0x43, 0x2E, 0xE3, 0x83, 0x4E, 0xBA, 0x22, 0x63, 0x4E, 0x4B, 0x64,
+    0x30, 0x96, 0x84, 0x93, 0xD9, 0x42, 0xC8, 0xB3, 0xA7, 0x8F, 0xC8, 0xCB, 0xA2, 0x4F, 0x66, 0x53,
+    0x32, 0x91, 0xC0, 0xB3, 0x0B, 0x85, 0x08, 0x4D, 0xC6, 0x65, 0x1F, 0x0B, 0x9B, 0xEE, 0x63, 0x98,
+    0x7C, 0xCA, 0x86, 0xAE, 0xFB, 0x6E, 0x53, 0x50, 0x9F, 0xA9, 0xB4, 0x24, 0xD8, 0x83, 0xCB, 0x6E,
+    0x7B, 0x66, 0x64, 0x7A, 0xAF, 0x4F, 0xA6, 0xFE, 0xF6, 0x2B, 0x78, 0xE9, 0xFE, 0xE7, 0xF2, 0x88,
+    0x4F, 0xFD, 0x74, 0xF2, 0x88, 0xDE, 0x93, 0x67, 0x2C, 0x5D, 0xDD, 0xFE, 0xBF, 0xD5, 0xFD, 0xC5,
+    0xC4, 0x63, 0x5C, 0x6C, 0xF1, 0xB7, 0x5A, 0x4E, 0x3C, 0x79, 0xE1, 0x01, 0xFB, 0x37, 0x18, 0x30,
+    0x60, 0xF0, 0x80, 0xFD, 0xD9, 0x42, 0xDE, 0x71, 0xFB, 0xCF, 0xB7, 0xBF, 0x5D, 0xD8, 0x7F, 0xE1,
+    0x34, 0x3A, 0x0D, 0x31, 0xF5, 0xF5, 0x0F, 0xF5, 0xB7, 0xFF, 0x53, 0x63, 0x50, 0x41, 0x05, 0x1A,
+    0xF6, 0x18, 0x92, 0x73, 0x32, 0x2C, 0x7D, 0xA0, 0x57, 0x6E, 0x4B, 0x5D, 0x31, 0x60, 0x0F, 0x53,
+    0xF9, 0xC0, 0xA6, 0x4A, 0x3D, 0xEA, 0xF4, 0x2E, 0x42, 0xDB, 0xCC, 0x9B, 0x45, 0x93, 0xAA, 0x1F,
+    0x0F, 0xC5, 0x82, 0xA8, 0x9D, 0x02, 0xE3, 0x12, 0x3D, 0xA9, 0xFB, 0x21, 0xF5, 0xC0, 0x42, 0x57,
+    0x2A, 0x31, 0x22, 0xC3, 0x24, 0xD5, 0xF0, 0x93, 0x8E, 0xC4, 0x00, 0x5D, 0xE9, 0x0A, 0x1B, 0x3D,
+    0x78, 0x1A, 0x18, 0xDA, 0x08, 0x47, 0x23, 0xD0, 0xEF, 0x24, 0xB0, 0x6F, 0x95, 0x0B, 0xFA, 0xBA,
+    0x9E, 0x57, 0x98, 0xBA, 0x5D, 0x30, 0xC3, 0x37, 0xE8, 0x4B, 0x96, 0x4C, 0xE8, 0x47, 0xA9, 0x5F,
+    0xEE, 0x77, 0x95, 0x0A, 0xA6, 0x1E, 0xB2, 0xEF, 0xE2, 0x8F, 0xE2, 0x99, 0x1D, 0xB6, 0x1C, 0x36,
+    0x24, 0x52, 0x4F, 0xA9, 0xD5, 0x03, 0x86, 0x26, 0xDA, 0x38, 0x50, 0x9D, 0xF9, 0xEE, 0xA4, 0xCC,
+    0xA5, 0x61, 0xF2, 0xD2, 0x3D, 0x4A, 0xCD, 0x54, 0x70, 0x19, 0x1B, 0x8F, 0x0A, 0xF3, 0xAD, 0x2E,
+    0xFF, 0x1B, 0xF3, 0xD8, 0xA5, 0xC2, 0x27, 0x96, 0x55, 0x3C, 0xE7, 0x54, 0xDC, 0x3A, 0xA9, 0xAA,
+    0x2D, 0xCF, 0xBF, 0xE9, 0x98, 0xD6, 0xD8, 0xB9, 0x06, 0xE4, 0x43, 0x9A, 0xAA, 0x2E, 0xF6, 0xAC,
+    0xE7, 0x03, 0x82, 0xBD, 0x0F, 0x34, 0x55, 0x3B, 0xE0, 0x4A, 0xAF, 0xFC, 0x7B, 0x78, 0x21, 0x41,
+    0xAC, 0x06, 0x70, 0xFF, 0x63, 0xEF, 0xF5, 0x57, 0x2B, 0x74, 0xE8, 0x2F, 0x1A, 0xDA, 0x08, 0xD9,
+    0xD3, 0x89, 0x3E, 0x72, 0xA8, 0x0B, 0x3F, 0xEE, 0xFB, 0x04, 0xB8, 0x4C, 0x82, 0x9C, 0x2D, 0xF0,
+    0xF1, 0x0C, 0x98, 0xDA, 0x81, 0x6A, 0x4C, 0x84, 0x63, 0xF5, 0x6E, 0x60, 0xC4, 0x64, 0x46, 0x16,
+    0x06, 0xAA, 0x76, 0xD1, 0xB3, 0x6E, 0x92, 0x2D, 0x1D, 0xAD, 0xAE, 0x4C, 0xBC, 0x4E, 0xB2, 0x75,
+    0xC1, 0xE8, 0xD5, 0x94, 0xC5, 0x5C, 0x1A, 0x97, 0xBC, 0xD4, 0x66, 0x11, 0xD5, 0x55, 0x38, 0x0D,
+    0x6D, 0x06, 0x97, 0x7D, 0x9C, 0xB7, 0xCA, 0x1F, 0x24, 0x68, 0x38, 0x6D, 0x23, 0x5E, 0xD7, 0x98,
+    0xB2, 0x41, 0x55, 0x03, 0x38, 0xCC, 0xA4, 0x1C, 0xB8, 0x72, 0xB0, 0x66, 0x2A, 0xEB, 0x42, 0xD2,
+    0xAF, 0xC5, 0x81, 0xAD, 0x53, 0x26, 0xE9, 0xC8, 0x49, 0xBD, 0x31, 0xDF, 0xC2, 0x81, 0x13, 0x81,
+    0x84, 0x8D, 0x6C, 0x62, 0x23, 0x36, 0xDA, 0x0A, 0x5A, 0x5B, 0x41, 0x6E, 0x2B, 0xB0, 0xDF, 0xAC,
+    0xE9, 0x9B, 0x76, 0x7D, 0x98, 0x76, 0x09, 0x70, 0x1D, 0xE0, 0xA4, 0x04, 0xF7, 0x5E, 0x02, 0x97,
+    0x66, 0xE0, 0x52, 0x1E, 0x71, 0xC9, 0x34, 0xB8, 0x06, 0x79, 0xD4, 0x35, 0xE4, 0x53, 0xC0, 0xF6,
+    0xF5, 0x45, 0x05, 0x2C, 0xDD, 0xCF, 0x82, 0xC1, 0xCD, 0x39, 0xE1, 0x9B, 0x15, 0x1B, 0x3B, 0x1F,
+    0xE4, 0x84, 0x47, 0x3D, 0x27, 0xEC, 0xC3, 0x65, 0xA4, 0xC7, 0x46, 0xA7, 0x01, 0x27, 0x33, 0x91,
+    0xEA, 0xFE, 0x2B, 0xE4, 0x22, 0x5D, 0xD1, 0xD7, 0x42, 0xBD, 0x8A, 0x4E, 0xDE, 0x14, 0x11, 0x49,
+    0x3C, 0xC2, 0x81, 0x8A, 0xA7, 0x58, 0xD7, 0xD1, 0x94, 0x5B, 0x9C, 0x37, 0xC1, 0x72, 0x89, 0x2B,
+    0x27, 0x59, 0xA6, 0x52, 0x71, 0x75, 0x71, 0xFE, 0x9C, 0xC1, 0x71, 0x48, 0xBD, 0xB2, 0x38, 0x7F,
+    0x56, 0x97, 0x26, 0xF4, 0xBD, 0x66, 0x23, 0x22, 0xDF, 0xEA, 0xBB, 0x5E, 0xF7, 0x5A, 0x46, 0xF2,
+    0x62, 0xDF, 0xFF, 0x02, 0xD3, 0xE4, 0xB1, 0xB3, 0x75, 0xA1, 0x5B, 0xC6, 0x4C, 0x55, 0x67, 0x92,
+    0xAD, 0x7D, 0xF5, 0xE0, 0xD9, 0x2C, 0x16, 0x2F, 0xD5, 0xFE, 0xB5, 0xE4, 0xFE, 0xB0, 0x31, 0xA9,
+    0xD3, 0xCD, 0x75, 0x4C, 0xC4, 0x94, 0xD8, 0x80, 0x03, 0x0F, 0x2B, 0x70, 0x06, 0xD6, 0x39, 0x79,
+    0xE3, 0x5F, 0x14, 0xD2, 0xB1, 0x03, 0x87, 0x90, 0xA0, 0x46, 0x55, 0xE8, 0xF8, 0x93, 0x2E, 0x67,
+    0xB5, 0x6F, 0x45, 0xC3, 0x3D, 0xB2, 0x76, 0xAB, 0xEF, 0x12, 0x1E, 0xDE, 0x23, 0x71, 0xCF, 0xC0,
+    0x97, 0xBE, 0x77, 0x90, 0xCB, 0x14, 0x53, 0xC2, 0x4E, 0x8F, 0x48, 0x13, 0xAC, 0xF4, 0x82, 0xA1,
+    0xCD, 0x5A, 0xC9, 0x8C, 0x4F, 0x1E, 0x81, 0xE5, 0x03, 0xB7, 0xA9, 0x78, 0x6F, 0x33, 0x90, 0x49,
+    0x65, 0x64, 0xCA, 0x58, 0xA2, 0x97, 0x4E, 0x89, 0xC4, 0x42, 0x3A, 0x2B, 0x52, 0x8A, 0xB4, 0x99,
+    0xC8, 0x53, 0x22, 0x4D, 0x21, 0xE2, 0x44, 0x12, 0x9C, 0xD7, 0xAD, 0xEF, 0x8A, 0xB2, 0x02, 0x4E,
+    0x8C, 0xF6, 0x6F, 0x9C, 0x18, 0xED, 0xDF, 0x60, 0x38, 0x00, 0x0C, 0x27, 0x82, 0x09, 0x0F, 0x7F,
+    0xC2, 0x94, 0xFA, 0x6F, 0xEA, 0x52, 0x7D, 0x55, 0x47, 0x7E, 0x59, 0x45, 0xFC, 0x93, 0xD5, 0x9C,
+    0x86, 0xAD, 0xE7, 0xF9, 0xF0, 0x90, 0x5E, 0xC2, 0xF4, 0x0F, 0x7E, 0x2E, 0xB0, 0xFB, 0xD5, 0x47,
+    0x19, 0x6C, 0xFF, 0x2A, 0x83, 0xBF, 0xFC, 0x57, 0x19, 0xD8, 0x17, 0xFB, 0xE1, 0x9A, 0x26, 0x8F,
+    0x53, 0x5B, 0x17, 0xAA, 0xC5, 0x34, 0x9D, 0xFB, 0x41, 0xEB, 0xDF, 0x48, 0xD9, 0x0B, 0x75, 0xE1,
+    0xE3, 0x7E, 0xCF, 0x21, 0x5C, 0x59, 0xD6, 0x4F, 0x57, 0xBB, 0x99, 0xD7, 0xF1, 0xDA, 0xCE, 0x8A,
+    0xB9, 0x55, 0x5E, 0x5A, 0xEE, 0x87, 0x71, 0x76, 0xB0, 0xBE, 0x7C, 0x12, 0x70, 0xD6, 0xDC, 0xAA,
+    0x77, 0x06, 0x2B, 0x4E, 0xC5, 0x39, 0xBE, 0xB9, 0x72, 0x76, 0xC9, 0xC4, 0xB4, 0xE9, 0x74, 0x35,
+    0x58, 0x36, 0xE5, 0xE1, 0x59, 0x4B, 0xFF, 0x87, 0x47, 0xD9, 0xE3, 0x77, 0x62, 0xDA, 0xE3, 0x21,
+    0xAA, 0x35, 0x53, 0xED, 0x99, 0x64, 0x6B, 0x5B, 0x39, 0x1E, 0xE6, 0x51, 0xB6, 0xF0, 0xE8, 0x9A,
+    0x3D, 0x86, 0x74, 0x3A, 0xE9, 0x8A, 0x72, 0xBE, 0xF7, 0x58, 0x3A, 0x60, 0xF8, 0x71, 0xF0, 0x51,
+    0xFF, 0x59, 0x03, 0x45, 0xF0, 0x02, 0x8C, 0x7B, 0x5A, 0x67, 0xC6, 0x0D, 0x40, 0x75, 0xBE, 0x06,
+    0xCC, 0x9D, 0x29, 0x60, 0xBE, 0x2F, 0x15, 0x17, 0xC8, 0x3E, 0xDD, 0xE1, 0x22, 0xD7, 0x8B, 0x8A,
+    0x02, 0xF5, 0x19, 0x89, 0x6A, 0xD1, 0x5B, 0xC3, 0xDF, 0x11, 0x00, 0x79, 0x7A, 0x06, 0x64, 0x8D,
+    0xED, 0x40, 0x0B, 0xBE, 0x83, 0x22, 0x31, 0x69, 0xB0, 0x82, 0xED, 0xDD, 0xB3, 0x17, 0xA3, 0xA8,
+    0x76, 0x6E, 0xBD, 0x8E, 0x78, 0xD8, 0x45, 0x57, 0x78, 0xD8, 0x43, 0xD7, 0x3D, 0x9F, 0x77, 0xEF,
+    0x35, 0xE1, 0xCB, 0x7E, 0x56, 0xB3, 0x92, 0x29, 0xB6, 0xE9, 0x1B, 0x3D, 0x57, 0x60, 0x0D, 0xEC,
+    0x1D, 0xAC, 0x34, 0xEA, 0xBD, 0xB7, 0xE2, 0x43, 0xBB, 0x43, 0xDC, 0xD3, 0x15, 0x69, 0x80, 0xB7,
+    0x51, 0xA5, 0x86, 0xCD, 0x02, 0xF3, 0x56, 0x64, 0x9C, 0x70, 0x1D, 0x4C, 0x7F, 0x44, 0xDF, 0xD2,
+    0xD3, 0x14, 0x27, 0x4B, 0xE8, 0x20, 0x8F, 0x98, 0x16, 0x8A, 0x12, 0xD7, 0x42, 0x21, 0x4D, 0xBF,
+    0x6F, 0xCE, 0xF3, 0x5A, 0xB9, 0x9B, 0xCF, 0xD8, 0x9F, 0xC7, 0xB3, 0x12, 0xFE, 0xE8, 0x73, 0xF0,
+    0xBB, 0xB0, 0xD4, 0xC2, 0xAF, 0x7F, 0x02, 0x4E, 0xC3, 0x13, 0xC4, 0x87, 0xFF, 0xFD, 0xBF, 0xFC,
+    0x7C, 0x7E, 0x70, 0x99, 0xFD, 0xA5, 0xFF, 0xBE, 0xF2, 0x6B, 0x7F, 0xE9, 0xB4, 0xBE, 0xE7, 0x93,
+    0xE8, 0xB9, 0x6E, 0x4E, 0x97, 0xBD, 0x24, 0x42, 0xC7, 0xDE, 0x69, 0xD5, 0xC2, 0x99, 0x16, 0x0E,
+    0xF5, 0xA0, 0x53, 0xED, 0xF4, 0xAA, 0x71, 0x06, 0xF3, 0xDF, 0x7B, 0x64, 0xCC, 0x2B, 0x9C, 0x7C,
+    0x99, 0x4C, 0xAA, 0x5C, 0xA2, 0x7F, 0xB2, 0xDB, 0x7C, 0xB2, 0x55, 0xF8, 0x27, 0xC9, 0xC0, 0xF4,
+    0xC4, 0x6D, 0x83, 0xEA, 0x31, 0x55, 0x0B, 0x43, 0xD8, 0x83, 0x1C, 0x86, 0xF4, 0x34, 0x10, 0x63,
+    0xB8, 0x81, 0x12, 0xF4, 0x0C, 0xA6, 0xA8, 0x29, 0x14, 0x70, 0x1D, 0xB2, 0x40, 0x01, 0x2E, 0xCE,
+    0x05, 0x94, 0xF6, 0x03, 0x94, 0x7F, 0x06, 0x23, 0xF0, 0x91, 0x2C, 0x60, 0x6B, 0x7C, 0x85, 0xBA,
+    0x78, 0x5F, 0x07, 0xBF, 0x34, 0x0B, 0x3D, 0x41, 0xB4, 0x6B, 0xD2, 0xBA, 0xC2, 0x3F, 0x1D, 0xA1,
+    0xD9, 0x02, 0xEF, 0x02, 0xBA, 0x4E, 0xB0, 0x97, 0x81, 0x7F, 0xAE, 0xC6, 0xD6, 0x43, 0x74, 0x6B,
+    0xA3, 0x99, 0x72, 0x4C, 0x81, 0x2F, 0x6D, 0xAD, 0x12, 0xD7, 0xC9, 0xF1, 0xD1, 0xD4, 0xBC, 0xBC,
+    0x88, 0x12, 0x17, 0x54, 0x4B, 0x4E, 0x11, 0x4C, 0x6D, 0x1B, 0x6E, 0x20, 0x0F, 0x54, 0xF2, 0x53,
+    0xE6, 0xB2, 0x71, 0x1F, 0xAE, 0xC3, 0x6F, 0xE3, 0x4B, 0xB6, 0xD0, 0x35, 0x67, 0xA0, 0xE9, 0x5D,
+    0xC7, 0x44, 0x86, 0xA8, 0x9A, 0x02, 0x1A, 0x0A, 0x18, 0x30, 0x81, 0xBC, 0x8F, 0xD6, 0x53, 0x30,
+    0x55, 0x01, 0x3A, 0x65, 0x65, 0xAF, 0x29, 0xE6, 0xB2, 0x3E, 0x80, 0xA5, 0x7B, 0x5C, 0x91, 0xAB,
+    0x32, 0x30, 0xC9, 0x47, 0x74, 0x67, 0x13, 0x0F, 0x3E, 0x9B, 0x07, 0x85, 0x99, 0x73, 0x89, 0x72,
+    0x9A, 0x6B, 0xF1, 0x7B, 0x9D, 0x4B, 0x2F, 0x7A, 0x58, 0x01, 0x86, 0x0E, 0xC8, 0x9E, 0x29, 0xC1,
+    0xBF, 0x16, 0x41, 0xFD, 0xDC, 0xFD, 0xAB, 0xAF, 0xB1, 0x58, 0xD2, 0x0D, 0xE8, 0xEB, 0xF1, 0x5E,
+    0xDC, 0x65, 0x4B, 0xC0, 0xDC, 0x0C, 0xA0, 0xBF, 0x53, 0x03, 0xEF, 0xB4, 0xC0, 0xB5, 0xE9, 0xE2,
+    0xEA, 0xE1, 0x7C, 0x21, 0x7A, 0x6A, 0xA9, 0x27, 0xE9, 0x4D, 0xC5, 0x9C, 0x5F, 0xE9, 0x3F, 0xFB,
+    0x0A, 0xF7, 0xDA, 0x44, 0xFA, 0x73, 0x8F, 0x3C, 0x7C, 0xEA, 0x1F, 0x7D, 0xEC, 0xF3, 0x4F, 0x9C,
+    0x3B, 0x7B, 0x98, 0x57, 0x27, 0x03, 0x9C, 0xD2, 0xF1, 0x9F, 0xFD, 0xC5, 0x17, 0xA7, 0x9F, 0x09,
+    0x97, 0x1C, 0x60, 0x5E, 0x79, 0x84, 0x53, 0xF8, 0x9A, 0x73, 0x1C, 0x16, 0xD5, 0xC7, 0x50, 0xC7,
+    0x4B, 0xAC, 0x5C, 0x39, 0x73, 0xFE, 0xEC, 0x13, 0x67, 0x2F, 0x65, 0x95, 0x02, 0x3B, 0xA3, 0x5A,
+    0x35, 0xE1, 0xD2, 0x8A, 0x8E, 0x5B, 0xA8, 0x2F, 0x2C, 0x9D, 0x5A, 0x3A, 0x6B, 0xEA, 0x53, 0xE7,
+    0xCE, 0x9F, 0xDF, 0xBA, 0x94, 0x55, 0xFA, 0xDA, 0x23, 0xA7, 0x4E, 0x9D, 0x3A, 0xB5, 0xEE, 0x5A,
+    0xCE, 0x3F, 0x76, 0x58, 0x94, 0x7C, 0xE2, 0x17, 0x71, 0xD2, 0x30, 0xB3, 0xD1, 0x87, 0x81, 0x4E,
+    0x26, 0x0E, 0xD9, 0x33, 0xD1, 0x97, 0xC7, 0x34, 0x3E, 0x66, 0xB4, 0x3A, 0xE5, 0xA1, 0x30, 0xC9,
+    0xD4, 0x9C, 0xE6, 0xEC, 0xB9, 0x93, 0xFA, 0xC9, 0x7F, 0xF7, 0xC4, 0xD9, 0xEF, 0x3C, 0xFD, 0x8F,
+    0x2F, 0x9D, 0xF7, 0xF6, 0xB9, 0x6A, 0xD4, 0x19, 0x09, 0x59, 0x09, 0x61, 0x4F, 0x97, 0xE7, 0x0D,
+    0x9F, 0x5B, 0x76, 0xDD, 0x76, 0x58, 0xAA, 0x3F, 0x71, 0x45, 0x97, 0xCB, 0xD4, 0x6B, 0xBA, 0xCE,
+    0x9A, 0xED, 0xA0, 0x0F, 0xB8, 0xA0, 0xC2, 0x43, 0xB6, 0x52, 0xF1, 0x64, 0x96, 0x3E, 0x06, 0x8F,
+    0xAA, 0xB8, 0xA6, 0x5E, 0x5E, 0xAD, 0x24, 0xAE, 0x53, 0xC3, 0x27, 0xCB, 0xD2, 0x5E, 0xE1, 0xC0,
+    0x3C, 0x75, 0x9C, 0x95, 0xBA, 0x7D, 0x42, 0x7D, 0xDD, 0x9F, 0x3A, 0x77, 0xEE, 0xD6, 0x73, 0x9D,
+    0x0A, 0x37, 0xCA, 0x55, 0x1D, 0x2E, 0xAD, 0xA8, 0xB8, 0x65, 0x03, 0x70, 0x41, 0x7F, 0xF4, 0xD4,
+    0xC3, 0xCB, 0xE7, 0x6D, 0x75, 0xF6, 0xDC, 0xA5, 0xC3, 0xBC, 0x04, 0x75, 0xE5, 0x91, 0xB3, 0xA7,
+    0x3E, 0xFA, 0xD1, 0xB3, 0x1F, 0x3D, 0xEF, 0x13, 0x97, 0x8A, 0xF8, 0x58, 0xAF, 0x91, 0xDB, 0x9D,
+    0x0B, 0xD5, 0x5C, 0x89, 0x67, 0x2E, 0xE6, 0x49, 0xA8, 0x7A, 0x2E, 0xD2, 0x74, 0x01, 0x0F, 0x1E,
+    0xD6, 0xE0, 0x0C, 0x6C, 0xD0, 0x2B, 0xEA, 0xE7, 0x3F, 0x43, 0x18, 0xC2, 0x06, 0x6C, 0x42, 0x36,
+    0x5F, 0x38, 0xCE, 0xDF, 0xD3, 0xF2, 0xF6, 0xC2, 0xDD, 0x9E, 0xDA, 0xEF, 0x4F, 0xB9, 0x80, 0x89,
+    0xE8, 0x6A, 0xAE, 0xE8, 0x9D, 0x0B, 0x64, 0x77, 0x61, 0xF7, 0x81, 0x4F, 0xED, 0x7F, 0xF6, 0x60,
+    0x0F, 0x8E, 0xA0, 0xED, 0x9B, 0xC6, 0xF7, 0xCA, 0xFD, 0x15, 0x60, 0xB0, 0x0E, 0xEC, 0xEC, 0x02,
+    0x29, 0x81, 0x96, 0x04, 0x99, 0x24, 0x90, 0x5F, 0xBB, 0x82, 0x99, 0x79, 0xF0, 0xDD, 0x19, 0x28,
+    0x76, 0x07, 0x70, 0xF9, 0xF0, 0x1A, 0x74, 0x75, 0x42, 0xBD, 0x77, 0x2B, 0x62, 0xDE, 0x7B, 0xBE,
+    0xC4, 0x88, 0x03, 0x3B, 0x5D, 0x01, 0x3B, 0x5D, 0x7F, 0x08, 0x2B, 0xB3, 0x63, 0xAC, 0x48, 0x8B,
+    0x11, 0x69, 0x30, 0x22, 0x09, 0xF7, 0xAA, 0x5C, 0xC1, 0x7B, 0x60, 0xFD, 0x0C, 0xB0, 0x35, 0x00,
+    0x0E, 0x77, 0x3E, 0x58, 0xF3, 0xFE, 0x44, 0xD9, 0x46, 0x79, 0x4F, 0xB6, 0xF1, 0xF7, 0x4A, 0x1F,
+    0x7D, 0x47, 0x47, 0x43, 0x56, 0x9D, 0x41, 0x89, 0xB9, 0x49, 0x26, 0x37, 0x7E, 0x4C, 0xB6, 0x31,
+    0xFB, 0xA0, 0x54, 0x57, 0x4D, 0x02, 0x56, 0x5A, 0x6C, 0x6D, 0xFB, 0xAF, 0xBF, 0xA4, 0xF9, 0x26,
+    0x29, 0x24, 0x91, 0x4B, 0xDB, 0x87, 0xD1, 0xF5, 0xB9, 0xA4, 0xAF, 0x90, 0xC4, 0xE2, 0x2B, 0x2C,
+    0x6A, 0x0A, 0xF6, 0x0E, 0x68, 0x91, 0x16, 0x11, 0x01, 0x75, 0x81, 0x1C, 0xD5, 0xE1, 0x4B, 0x04,
+    0x5B, 0x51, 0x54, 0x3A, 0x91, 0xB5, 0xB4, 0xF8, 0x19, 0x97, 0x31, 0xB7, 0x63, 0x8E, 0xFE, 0xB3,
+    0xE4, 0x23, 0xDD, 0x75, 0x5B, 0x59, 0x11, 0x91, 0x37, 0x44, 0x44, 0x92, 0xAF, 0xBA, 0xCB, 0xD8,
+    0x94, 0xE7, 0xE8, 0xCE, 0xBE, 0x15, 0x99, 0x29, 0xA9, 0x19, 0x87, 0xA2, 0x21, 0x8F, 0xBE, 0xC3,
+    0x27, 0x3D, 0x03, 0x9C, 0xD4, 0xBD, 0x15, 0x9E, 0x1C, 0x95, 0x48, 0x5E, 0x44, 0xEA, 0xCF, 0x7E,
+    0xF7, 0x33, 0x0D, 0x7B, 0xEA, 0x3A, 0x4E, 0xA4, 0x44, 0xA4, 0x22, 0xFB, 0x5E, 0x40, 0xA7, 0x79,
+    0x62, 0xB4, 0x8B, 0x7E, 0x86, 0xAF, 0xE8, 0x85, 0xA0, 0x79, 0xEC, 0x55, 0x15, 0xF3, 0xEA, 0x86,
+    0x71, 0x07, 0x70, 0x65, 0x0D, 0xA0, 0x5A, 0x01, 0x88, 0x2B, 0x80, 0x8A, 0x9B, 0x80, 0x8E, 0xC7,
+    0xB8, 0xD6, 0x48, 0xCB, 0xE6, 0xCB, 0x46, 0x6A, 0xCE, 0x61, 0x25, 0x72, 0x09, 0xF7, 0xC7, 0x89,
+    0x5D, 0x7C, 0x48, 0x14, 0xC1, 0x87, 0x84, 0xAB, 0x33, 0x12, 0xA4, 0x5C, 0x25, 0x42, 0x1A, 0xE9,
+    0xA4, 0xA5, 0x1E, 0x99, 0x64, 0xA5, 0xBA, 0x6C, 0x92, 0x96, 0x40, 0x85, 0x29, 0xCF, 0xC0, 0x79,
+    0x55, 0xE1, 0x38, 0x03, 0x49, 0x55, 0xAC, 0x70, 0xC6, 0xEA, 0x98, 0x89, 0xC8, 0x6B, 0x22, 0xD2,
+    0xA8, 0x37, 0xDA, 0x1D, 0x36, 0xC6, 0x2F, 0xA1, 0xFF, 0x60, 0xAF, 0x66, 0xE3, 0x87, 0xFF, 0x05,
+    0x3D, 0x2B, 0x22, 0xF9, 0x6B, 0x1D, 0xBA, 0x2B, 0x4A, 0xF2, 0xA7, 0x13, 0x3A, 0xE5, 0x30, 0xD2,
+    0x35, 0xFC, 0x62, 0x00, 0x64, 0xC6, 0x43, 0xCC, 0x5E, 0x8D, 0x6B, 0x2A, 0xE9, 0x7A, 0x43, 0x57,
+    0xA4, 0x81, 0x89, 0xD4, 0x03, 0x73, 0xB3, 0xAC, 0x77, 0xED, 0x73, 0x37, 0xAB, 0x43, 0x6F, 0x6E,
+    0xC5, 0xE4, 0xCD, 0x73, 0x37, 0xEB, 0x35, 0x1B, 0x74, 0xB5, 0x61, 0x83, 0x89, 0x03, 0x5B, 0xDA,
+    0x38, 0x30, 0xEF, 0x3E, 0x5B, 0x3E, 0x81, 0x48, 0x80, 0xA5, 0x49, 0x5F, 0x09, 0xB0, 0x0A, 0x9F,
+    0xBC, 0x1B, 0x90, 0x29, 0xAC, 0xA2, 0x8E, 0x0F, 0xC9, 0xA5, 0x54, 0xD5, 0x65, 0x96, 0x49, 0x1C,
+    0xDA, 0xD2, 0x94, 0x43, 0xBC, 0x4E, 0x14, 0x12, 0x19, 0x0B, 0xFC, 0xE2, 0x69, 0xB2, 0x5E, 0xBD,
+    0xCA, 0x7D, 0xB5, 0xBC, 0x74, 0xB8, 0xF9, 0x17, 0x74, 0x46, 0xE0, 0xA4, 0xE3, 0x91, 0x1B, 0x2F,
+    0xC3, 0x35, 0xF8, 0x88, 0xD4, 0x8C, 0xEF, 0x1E, 0xA0, 0xEA, 0x3E, 0xD2, 0xEA, 0xD4, 0x17, 0x96,
+    0x5A, 0xA6, 0x3D, 0x39, 0xFC, 0xF1, 0x1E, 0xC3, 0x9C, 0xD8, 0xDE, 0xDE, 0x76, 0xF3, 0x59, 0xA9,
+    0x83, 0x0F, 0x7D, 0x84, 0xD6, 0xEF, 0x04, 0x90, 0x0A, 0x35, 0x39, 0xC0, 0x08, 0xE8, 0xAF, 0xFD,
+    0x27, 0x30, 0x12, 0x70, 0xD3, 0x5E, 0x4D, 0x78, 0x62, 0x4C, 0xAF, 0xD3, 0xF1, 0x55, 0xBF, 0x2F,
+    0x54, 0xDF, 0x48, 0x93, 0x1A, 0x8C, 0x48, 0x40, 0x25, 0x9D, 0xC8, 0x44, 0xA4, 0x65, 0x48, 0x86,
+    0x7E, 0xF5, 0x7B, 0xAF, 0x7E, 0x2F, 0xB8, 0x98, 0x45, 0x8C, 0x2C, 0x7C, 0x8B, 0xF1, 0xD7, 0xE7,
+    0xDF, 0xAF, 0xEA, 0xCB, 0x5D, 0x5B, 0x2F, 0xAA, 0x5F, 0xEE, 0xF7, 0x30, 0xF3, 0x48, 0x4F, 0xD2,
+    0xB2, 0x48, 0x12, 0x6E, 0x21, 0x7C, 0x59, 0x06, 0xBE, 0x24, 0x15, 0x63, 0x99, 0x91, 0xFF, 0x71,
+    0x7C, 0xD4, 0x36, 0x5B, 0x30, 0x35, 0x81, 0xBC, 0xBC, 0x84, 0x49, 0x0E, 0xF6, 0xA9, 0x71, 0xD5,
+    0x0A, 0x74, 0xC8, 0x6F, 0xF8, 0x98, 0x49, 0xDD, 0xE9, 0x78, 0x27, 0x8B, 0x5B, 0x99, 0x9A, 0x99,
+    0x67, 0x6A, 0x2F, 0x32, 0x65, 0xDE, 0x53, 0xED, 0x58, 0x92, 0xFF, 0x36, 0x87, 0xCA, 0xAB, 0x73,
+    0xC4, 0x84, 0x9A, 0xDC, 0x01, 0xBC, 0x4C, 0x81, 0x4F, 0x7E, 0xA3, 0x83, 0x85, 0x42, 0xB8, 0xEF,
+    0x35, 0x17, 0xE0, 0x64, 0xAE, 0x2A, 0x94, 0xF6, 0xC1, 0xAD, 0x3E, 0x11, 0x91, 0xCE, 0x8A, 0x88,
+    0xD4, 0x45, 0xCF, 0xC7, 0x57, 0xAA, 0xC4, 0x88, 0x48, 0x89, 0x15, 0x11, 0x70, 0x22, 0x53, 0xD0,
+    0x22, 0x07, 0x0F, 0xDE, 0x67, 0x60, 0x15, 0x35, 0x65, 0xD2, 0xF8, 0xFF, 0xCC, 0xDE, 0xA1, 0x79,
+    0xAD, 0xCC, 0x96, 0x39, 0xBA, 0x64, 0xBE, 0x1D, 0xFD, 0x7F, 0x20, 0xBF, 0x4B, 0x31, 0x23, 0x6F,
+    0xE7, 0x1A, 0x5D, 0xEC, 0xA2, 0x46, 0xBA, 0x57, 0x94, 0xD1, 0xDB, 0x31, 0x64, 0xFE, 0x45, 0x37,
+    0x1F, 0xE7, 0x19, 0x58, 0xDF, 0xFB, 0xDF, 0xFE, 0xA2, 0xC9, 0xE9, 0xE3, 0x7C, 0x8A, 0xEF, 0xF3,
+    0x0D, 0x63, 0x00, 0xB5, 0xBD, 0x6D, 0x65, 0xC6, 0x0A, 0x58, 0x4E, 0x7C, 0xF6, 0x62, 0x26, 0x2D,
+    0x1B, 0x7C, 0xA4, 0x65, 0x1C, 0x99, 0xDC, 0xA7, 0xB3, 0xD1, 0x0D, 0xA6, 0xE9, 0xE3, 0x23, 0x7C,
+    0xAC, 0xEF, 0xF2, 0xDE, 0x2C, 0x91, 0x5A, 0xC9, 0x81, 0x99, 0xA2, 0xBE, 0x76, 0x12, 0x2B, 0xC1,
+    0x4D, 0xF1, 0x8D, 0xF9, 0x87, 0x7B, 0x36, 0xAE, 0xB9, 0xE8, 0x24, 0x98, 0x3B, 0x73, 0x6B, 0x2F,
+    0xCD, 0xD3, 0x7E, 0xDD, 0x83, 0xA3, 0xB1, 0x80, 0xBC, 0x15, 0xF4, 0x0F, 0x5F, 0x0C, 0xE6, 0xB5,
+    0x67, 0x82, 0x7D, 0xC1, 0xE2, 0x9C, 0xC3, 0xAF, 0xAC, 0xB0, 0xB2, 0xBC, 0xCC, 0x99, 0xD5, 0x55,
+    0xD6, 0xD7, 0x07, 0x0C, 0xB6, 0xB6, 0x18, 0x9C, 0xDF, 0x01, 0x26, 0xB3, 0xD0, 0x3B, 0x9A, 0x27,
+    0x87, 0x3D, 0x06, 0x98, 0x9A, 0x84, 0x0F, 0xAE, 0x64, 0x4F, 0x5D, 0xD7, 0x22, 0x52, 0x3B, 0x91,
+    0x29, 0x85, 0x7C, 0xFD, 0x81, 0xE1, 0x8F, 0x45, 0x82, 0x16, 0xE9, 0xE6, 0x5A, 0xAB, 0x62, 0xD1,
+    0x96, 0xEC, 0x1D, 0xEC, 0x09, 0x58, 0x85, 0x95, 0x3E, 0xAF, 0xF1, 0xF8, 0xF3, 0x3F, 0x2B, 0xCF,
+    0xCB, 0xDB, 0xFA, 0x0E, 0x5C, 0xEE, 0x51, 0xF7, 0xA8, 0xAF, 0x02, 0x1F, 0xBD, 0x5F, 0x14, 0x66,
+    0x09, 0xF7, 0x7E, 0xB4, 0x6F, 0x66, 0xBA, 0x4E, 0x47, 0xE7, 0x57, 0x74, 0x50, 0xD5, 0xBD, 0x62,
+    0xF1, 0xFC, 0xBD, 0xAA, 0x8F, 0x47, 0x7A, 0xE8, 0x3C, 0x00, 0x53, 0xDE, 0xE1, 0xD2, 0xE3, 0xB3,
+    0x4F, 0xB1, 0x24, 0x35, 0x4B, 0x53, 0xC8, 0x17, 0x18, 0x77, 0xAD, 0x17, 0x1C, 0x3F, 0xDA, 0xF3,
+    0x24, 0x5B, 0x3D, 0x5E, 0x3B, 0x03, 0xD4, 0x3C, 0xEA, 0x31, 0xD5, 0xE1, 0xBA, 0x7B, 0xE1, 0x53,
+    0x65, 0xF6, 0xE5, 0x44, 0xDE, 0xF5, 0x4B, 0xB5, 0x40, 0xBB, 0xCB, 0x70, 0x0A, 0x5D, 0xC2, 0x25,
+    0x2E, 0x81, 0x29, 0x97, 0x97, 0xDE, 0x7B, 0x7B, 0xD9, 0xBC, 0xD9, 0x2E, 0xCD, 0x0E, 0xC7, 0x07,
+    0xA8, 0xC9, 0x8B, 0x25, 0x70, 0xB4, 0x06, 0x6C, 0xB2, 0x07, 0x2E, 0x50, 0xC2, 0x01, 0xFF, 0x03,
+    0x4D, 0x94, 0x31, 0x6C, 0x9B, 0xC7, 0x15, 0xC7, 0x7F, 0x77, 0x67, 0xE9, 0x73, 0x72, 0x94, 0x4E,
+    0x4B, 0x0C, 0xD7, 0xB2, 0xF4, 0x75, 0xC8, 0xA0, 0xA2, 0x96, 0xC8, 0xC1, 0x83, 0x80, 0x7E, 0x22,
+    0xAF, 0xF0, 0xD0, 0xA1, 0x28, 0xE0, 0xA1, 0xEA, 0x90, 0xA5, 0x19, 0xBC, 0x65, 0x08, 0x07, 0x0F,
+    0x0C, 0x40, 0x99, 0x9F, 0xA3, 0x31, 0x28, 0xA0, 0xA1, 0xE8, 0x2C, 0xA0, 0xE8, 0xD2, 0x25, 0x1C,
+    0x04, 0x54, 0x03, 0x0D, 0x9E, 0xAD, 0xA1, 0xEB, 0x05, 0x45, 0xB7, 0x0E, 0x07, 0xD4, 0x4B, 0xDD,
+    0xA1, 0x87, 0xE4, 0x1B, 0x98, 0x94, 0xE4, 0xEB, 0x40, 0xC9, 0xEA, 0x01, 0xEF, 0x86, 0x7B, 0xC0,
+    0xBD, 0xDF, 0xFF, 0xBD, 0xFB, 0x1F, 0x2D, 0xF4, 0x9C, 0xDE, 0xA4, 0xF8, 0xDD, 0x60, 0xDC, 0xEF,
+    0xEB, 0x9A, 0x0D, 0xE8, 0xA0, 0x02, 0x1F, 0xC2, 0x16, 0x9C, 0xA3, 0x02, 0x06, 0x36, 0x60, 0x8F,
+    0x71, 0xBF, 0x7F, 0x71, 0x55, 0xFF, 0x6C, 0x42, 0x3B, 0xF0, 0x10, 0x80, 0x7B, 0xE9, 0xB3, 0xE5,
+    0xD9, 0xD2, 0x23, 0x35, 0xDF, 0xCE, 0x18, 0xB7, 0xFD, 0xB8, 0xC8, 0x63, 0x4E, 0x3E, 0xE5, 0x4E,
+    0xF1, 0x7B, 0xF8, 0x7A, 0xE9, 0xB1, 0x19, 0x3B, 0xA7, 0xFC, 0x8A, 0xDE, 0x93, 0xF0, 0x8A, 0x3C,
+    0xA3, 0xDA, 0xE2, 0x43, 0x40, 0x7B, 0x2A, 0x54, 0xBC, 0xEB, 0x08, 0xCF, 0x1F, 0x9A, 0x37, 0xF5,
+    0xCE, 0x63, 0xBE, 0xA3, 0x18, 0x3F, 0xEB, 0x3A, 0x89, 0x6B, 0x13, 0x00, 0x0C, 0x3C, 0xBA, 0x4B,
+    0x7A, 0x6C, 0x39, 0x3F, 0x54, 0x6F, 0x82, 0xD9, 0x64, 0x63, 0x4C, 0xBB, 0xE6, 0xE4, 0x1E, 0x32,
+    0x37, 0xFF, 0x42, 0x01, 0x26, 0x80, 0xA9, 0xC1, 0x02, 0x3B, 0x40, 0x4F, 0x24, 0x5F, 0x00, 0x47,
+    0x80, 0x15, 0x99, 0xAB, 0x0C, 0x0C, 0x81, 0x87, 0xC0, 0x1D, 0x80, 0x9F, 0x03, 0xE3, 0x73, 0x98,
+    0x1D, 0xC1, 0xA2, 0x0C, 0xEA, 0x3B, 0x5B, 0xA9, 0x7C, 0xF5, 0xCB, 0x2F, 0xD3, 0x79, 0x68, 0xCE,
+    0x1E, 0xF7, 0xEF, 0xD2, 0xDA, 0x83, 0x62, 0x03, 0xF4, 0x29, 0xF0, 0x4D, 0x80, 0xCE, 0x39, 0xDC,
+    0x7F, 0x0C, 0x1F, 0xB4, 0x00, 0x94, 0x5F, 0x55, 0x34, 0x01, 0x54, 0x04, 0x72, 0x5B, 0x64, 0x06,
+    0xEC, 0x03, 0x97, 0x23, 0x91, 0x08, 0xE5, 0x75, 0xD1, 0x31, 0x00, 0x9C, 0xD5, 0xB0, 0xD7, 0x59,
+    0xDD, 0xCA, 0x9B, 0x1A, 0x3E, 0xEE, 0xC3, 0xFA, 0x06, 0x70, 0x55, 0xE3, 0x3B, 0x7D, 0xAA, 0x0F,
+    0x5A, 0xD6, 0x7C, 0x73, 0xFA, 0x8B, 0x70, 0xD0, 0xF9, 0x63, 0xD0, 0x8B, 0x32, 0x52, 0x9E, 0x46,
+    0xC8, 0x09, 0x5A, 0x5B, 0x00, 0x28, 0xA0, 0x26, 0xC3, 0x98, 0x43, 0xD8, 0xE1, 0x11, 0x98, 0xB0,
+    0x03, 0x3C, 0x77, 0x22, 0x22, 0xD6, 0x03, 0xB9, 0x01, 0xD5, 0x58, 0x11, 0x49, 0x0C, 0x31, 0x89,
+    0x22, 0x98, 0x04, 0x7D, 0x12, 0xDC, 0x61, 0x0B, 0xB8, 0x0F, 0x2E, 0xE2, 0x5E, 0x78, 0xFB, 0xAB,
+    0x85, 0xBD, 0xB2, 0x36, 0x87, 0xE2, 0x1F, 0x1D, 0x9E, 0xB4, 0xE0, 0x0A, 0x3A, 0x81, 0x56, 0x07,
+    0xD3, 0x82, 0x2B, 0xCA, 0x4E, 0xD0, 0xF3, 0x0E, 0xED, 0xD6, 0x7D, 0xFD, 0xB7, 0x91, 0x3F, 0x5A,
+    0x60, 0x1A, 0xF8, 0xF4, 0x9A, 0xC3, 0x05, 0xB0, 0x7E, 0xD5, 0xD2, 0x31, 0x98, 0x5A, 0x3D, 0x7B,
+    0xC8, 0x68, 0x96, 0x8B, 0xF8, 0x17, 0x5F, 0x31, 0xD7, 0xC9, 0x44, 0x87, 0xA3, 0x62, 0x40, 0x53,
+    0x04, 0xB3, 0x5C, 0x50, 0x48, 0xA4, 0x98, 0xF1, 0x7E, 0x4D, 0xDF, 0x56, 0x30, 0x15, 0x81, 0xDE,
+    0x59, 0x3B, 0xE2, 0x12, 0x0B, 0x4C, 0xC3, 0x28, 0xF1, 0x82, 0xDD, 0x2E, 0x2E, 0x14, 0xA7, 0x89,
+    0x46, 0xA5, 0x23, 0xDA, 0x5C, 0x9A, 0x68, 0xD2, 0x3E, 0x13, 0xBA, 0xD6, 0xBB, 0xDA, 0xFC, 0x33,
+    0xEA, 0x86, 0x5E, 0x66, 0x8A, 0x91, 0xDF, 0x4C, 0x23, 0x3D, 0x91, 0x19, 0x46, 0x44, 0x50, 0xFF,
+    0x16, 0xA9, 0x19, 0x6C, 0x4B, 0x8D, 0xBA, 0x2D, 0x85, 0x0D, 0x50, 0x46, 0xE8, 0x25, 0xF8, 0x21,
+    0xA1, 0xBF, 0xCD, 0x14, 0xAF, 0x33, 0xEE, 0x65, 0x43, 0x8F, 0x19, 0x13, 0xE6, 0xAA, 0x61, 0x6E,
+    0x32, 0x13, 0x17, 0x78, 0xD5, 0xF6, 0xBC, 0xE8, 0x89, 0x2C, 0x47, 0x22, 0x0B, 0x75, 0x7C, 0xFC,
+    0xEB, 0xB6, 0x48, 0x74, 0x34, 0x0C, 0x4C, 0xD0, 0x71, 0x17, 0xC7, 0x05, 0x95, 0x09, 0x3A, 0x39,
+    0x9C, 0x1F, 0x50, 0xE9, 0xA8, 0x92, 0xC3, 0xFA, 0x8A, 0x4A, 0x25, 0xB2, 0xF3, 0x45, 0x5D, 0xC1,
+    0x33, 0x5D, 0xAB, 0xE4, 0x30, 0x61, 0x1F, 0xC7, 0x80, 0x03, 0x32, 0x43, 0x13, 0xC8, 0xD6, 0xEB,
+    0xB8, 0x4B, 0x51, 0x57, 0x38, 0x32, 0x95, 0x8E, 0x5C, 0x14, 0x41, 0x25, 0xC7, 0xF6, 0xDF, 0x5F,
+    0xF8, 0xA9, 0x88, 0xE7, 0xA3, 0xE3, 0xA7, 0x56, 0x16, 0xAB, 0xAE, 0xC2, 0x06, 0xD0, 0x07, 0x5D,
+    0x43, 0x0B, 0x4C, 0x8D, 0x8A, 0x70, 0x01, 0x15, 0x94, 0xC7, 0x4F, 0x8D, 0x08, 0x3D, 0xC9, 0x00,
+    0x6B, 0x9F, 0x9C, 0x4F, 0x25, 0xAC, 0xF4, 0x7E, 0x74, 0x0C, 0x94, 0x52, 0x83, 0xF3, 0x80, 0xAD,
+    0xAF, 0x5D, 0x82, 0x89, 0x80, 0xCA, 0x00, 0x0D, 0xC0, 0x04, 0xE0, 0x04, 0xA0, 0x0B, 0xD0, 0x06,
+    0xB6, 0xCA, 0x1A, 0x9C, 0x0B, 0x60, 0xFE, 0x9B, 0x00, 0xC9, 0x40, 0xBB, 0x01, 0x8A, 0x39, 0x00,
+    0x3F, 0xAD, 0x0F, 0x28, 0xE4, 0xAF, 0x42, 0xB7, 0x78, 0xB5, 0xA1, 0xA3, 0x0D, 0x7B, 0x9B, 0xEC,
+    0x73, 0xF6, 0x9C, 0xB1, 0x51, 0xC1, 0xC4, 0xCA, 0xFA, 0x91, 0xC4, 0x52, 0xFE, 0xB3, 0xA4, 0xB7,
+    0x68, 0x47, 0x1E, 0xF8, 0xEB, 0x21, 0x28, 0x00, 0x23, 0x80, 0x6A, 0xB6, 0xAE, 0xED, 0xB9, 0x42,
+    0x23, 0x03, 0xEC, 0x72, 0x03, 0xC8, 0x10, 0xAE, 0xD1, 0x57, 0xA9, 0x03, 0x6E, 0x04, 0xFC, 0x5F,
+    0x4A, 0xDD, 0xA6, 0x8A, 0x00, 0x30, 0x03, 0x7E, 0xDC, 0x03, 0x46, 0x92, 0xC0, 0xC8, 0x1C, 0x28,
+    0x05, 0x60, 0x0D, 0x80, 0x9F, 0x70, 0xC2, 0x42, 0xCD, 0x6F, 0x9F, 0xC5, 0x7A, 0xED, 0x42, 0x19,
+    0x7A, 0x01, 0xA0, 0x98, 0xAB, 0x7A, 0x58, 0xED, 0xEA, 0xD0, 0x4B, 0x37, 0xE9, 0x91, 0xFF, 0xD8,
+    0x7E, 0xA5, 0x62, 0xE5, 0x7E, 0xAB, 0xCE, 0x6C, 0xBE, 0x39, 0x35, 0x80, 0xF1, 0xAB, 0xD0, 0x35,
+    0xE8, 0x00, 0xEA, 0x5D, 0x6D, 0x45, 0xF2, 0xFA, 0x1F, 0x22, 0x90, 0x56, 0xD4, 0xF7, 0xBE, 0xFF,
+    0x33, 0x3D, 0x91, 0xC8, 0x05, 0x70, 0x09, 0x0C, 0xAE, 0xE9, 0xAB, 0x5B, 0x00, 0x05, 0xE8, 0x0C,
+    0x7A, 0x79, 0x1D, 0x02, 0x5A, 0x3C, 0x4C, 0x3D, 0x98, 0xA5, 0x87, 0x6D, 0x79, 0x0B, 0x5A, 0x96,
+    0xC0, 0xE7, 0x73, 0x60, 0x7D, 0x35, 0xE1, 0xDE, 0x9F, 0x40, 0x4F, 0xE5, 0x07, 0x0F, 0x9F, 0x4C,
+    0x56, 0x7F, 0xDA, 0x0C, 0xB0, 0xEF, 0xB7, 0xF2, 0x76, 0x8B, 0xB0, 0x3D, 0x47, 0x4D, 0x97, 0x7E,
+    0x5B, 0x1A, 0x8C, 0x9C, 0xC1, 0x17, 0xEF, 0x09, 0xD6, 0xBE, 0xAE, 0x1F, 0x88, 0xBC, 0x2D, 0xDE,
+    0x3D, 0x05, 0xD4, 0xD9, 0x7A, 0xAD, 0x97, 0x66, 0x4E, 0xC5, 0x25, 0x96, 0x4D, 0x48, 0x3A, 0x52,
+    0xCA, 0x9C, 0x52, 0x44, 0xA8, 0x18, 0x50, 0x04, 0xEB, 0xB9, 0xA4, 0xC1, 0xF9, 0x12, 0xB2, 0xCE,
+    0x94, 0x74, 0x31, 0xC9, 0x44, 0xBA, 0x0C, 0x29, 0xA2, 0x0D, 0x4C, 0xB8, 0xB1, 0xB9, 0x49, 0x3C,
+    0x68, 0x98, 0x2E, 0x38, 0x84, 0x47, 0xB0, 0x09, 0x85, 0xC7, 0x49, 0x53, 0xC8, 0x9C, 0xCA, 0x51,
+    0x9A, 0xDA, 0xBE, 0x8C, 0x26, 0x66, 0x95, 0x2B, 0x26, 0x07, 0x74, 0x9D, 0x2F, 0x9F, 0x44, 0xFB,
+    0x3A, 0xC3, 0xDA, 0xD9, 0x0E, 0xED, 0xB4, 0xCF, 0x80, 0x8A, 0xCC, 0x80, 0x44, 0x76, 0x91, 0x5C,
+    0xCA, 0x97, 0xA9, 0x14, 0x13, 0x4C, 0x30, 0xA1, 0x08, 0xB6, 0xB6, 0xB5, 0xF3, 0xCE, 0x3B, 0x4A,
+    0x4A, 0xDA, 0x74, 0xE9, 0x72, 0xC4, 0x09, 0xA3, 0x34, 0x61, 0x14, 0xDF, 0x6B, 0x34, 0x81, 0x1F,
+    0xF1, 0x59, 0x66, 0x5A, 0xCB, 0x4A, 0x1A, 0x8F, 0x38, 0x84, 0x4D, 0xF6, 0xA1, 0x10, 0xD1, 0xA1,
+    0x14, 0x91, 0x4C, 0x56, 0xE9, 0x90, 0x21, 0x17, 0x3B, 0x1C, 0x70, 0x64, 0x71, 0xBE, 0x34, 0xC1,
+    0x04, 0xFB, 0x3A, 0xA9, 0x6C, 0xD2, 0x05, 0x33, 0x9A, 0x8A, 0x2E, 0xC3, 0x92, 0xD2, 0xB7, 0x6D,
+    0xB0, 0xC1, 0x9D, 0xA6, 0x55, 0xCB, 0xF6, 0x68, 0xA7, 0x5E, 0xA8, 0xA8, 0xB8, 0xE4, 0x92, 0x31,
+    0x89, 0x4C, 0xD2, 0x51, 0x65, 0x25, 0x12, 0x74, 0x2C, 0x45, 0xC4, 0x04, 0x13, 0x8A, 0xBA, 0xA8,
+    0x8B, 0x60, 0xBD, 0xF5, 0xB6, 0x76, 0xDE, 0xE1, 0x7C, 0x49, 0x89, 0xA3, 0xCD, 0x01, 0x25, 0x5D,
+    0x8E, 0xE8, 0x72, 0x44, 0x45, 0x97, 0x21, 0x43, 0x7F, 0xC2, 0x84, 0x69, 0x98, 0x30, 0xE3, 0xC6,
+    0xD4, 0x00, 0xE7, 0xDC, 0x18, 0xC7, 0x04, 0xDA, 0xDF, 0xAF, 0xBD, 0x7A, 0xEA, 0xDE, 0xBD, 0x94,
+    0xA5, 0x0E, 0x90, 0x39, 0x84, 0x03, 0x4C, 0xC2, 0x44, 0xDA, 0x0D, 0x15, 0x7C, 0x9E, 0x6D, 0x80,
+    0xD2, 0x37, 0xAC, 0xE9, 0xC6, 0x79, 0x2D, 0xA2, 0x25, 0x4E, 0x25, 0xF6, 0xE6, 0x5A, 0xDE, 0x6A,
+    0x09, 0xFF, 0x03,
 };
 
 static const EpdGlyph opendyslexic_10_italicGlyphs[] = {
@@ -1577,7 +1547,7 @@ static const EpdGlyph opendyslexic_10_italicGlyphs[] = {
     { 8, 18, 5, 0, 15, 36, 5628 }, // |
     { 12, 20, 13, 0, 16, 60, 5664 }, // }
     { 9, 5, 12, 4, 16, 12, 5724 }, // ~
-    { 0, 0, 18, 0, 0, 0, 0 }, //  
+    { 0, 0, 18, 0, 0, 0, 5736 }, //  
     { 8, 22, 9, 2, 16, 44, 0 }, // ¡
     { 11, 19, 14, 1, 16, 53, 44 }, // ¢
     { 17, 20, 14, 0, 20, 85, 97 }, // £
@@ -1588,625 +1558,631 @@ static const EpdGlyph opendyslexic_10_italicGlyphs[] = {
     { 10, 4, 11, 4, 16, 10, 398 }, // ¨
     { 10, 8, 11, 5, 19, 20, 408 }, // ©
     { 8, 8, 9, 3, 16, 16, 428 }, // ª
-    { 14, 10, 17, 2, 10, 35, 444 }, // «
-    { 10, 6, 13, 3, 7, 15, 479 }, // ¬
-    { 10, 3, 11, 3, 8, 8, 494 }, // ­
-    { 10, 8, 11, 5, 22, 20, 502 }, // ®
-    { 8, 3, 11, 5, 15, 6, 522 }, // ¯
-    { 11, 10, 11, 3, 17, 28, 528 }, // °
-    { 13, 13, 15, 0, 12, 43, 556 }, // ±
-    { 7, 8, 6, 2, 17, 14, 599 }, // ²
-    { 8, 8, 7, 2, 17, 16, 613 }, // ³
-    { 6, 5, 6, 4, 17, 8, 629 }, // ´
-    { 15, 14, 15, -1, 12, 53, 637 }, // µ
-    { 14, 17, 13, 1, 15, 60, 690 }, // ¶
-    { 5, 4, 5, 2, 9, 5, 750 }, // ·
-    { 6, 6, 7, 0, 1, 9, 755 }, // ¸
-    { 6, 9, 6, 2, 18, 14, 764 }, // ¹
-    { 8, 7, 9, 3, 15, 14, 778 }, // º
-    { 15, 10, 13, -3, 10, 38, 792 }, // »
-    { 17, 20, 23, 5, 19, 85, 830 }, // ¼
-    { 18, 20, 23, 5, 18, 90, 915 }, // ½
-    { 18, 19, 23, 4, 18, 86, 1005 }, // ¾
-    { 14, 23, 12, -2, 12, 81, 1091 }, // ¿
-    { 17, 24, 21, 0, 24, 102, 1172 }, // À
-    { 19, 27, 21, 0, 27, 129, 1274 }, // Á
-    { 19, 23, 21, 0, 23, 110, 1403 }, // Â
-    { 19, 24, 21, 0, 24, 114, 1513 }, // Ã
-    { 20, 24, 21, 0, 24, 120, 1627 }, // Ä
-    { 18, 25, 21, 0, 25, 113, 1747 }, // Å
-    { 28, 19, 30, 0, 18, 133, 1860 }, // Æ
-    { 18, 24, 18, 1, 19, 108, 1993 }, // Ç
-    { 17, 23, 16, 0, 23, 98, 2101 }, // È
-    { 17, 27, 16, 0, 27, 115, 2199 }, // É
-    { 17, 23, 16, 0, 23, 98, 2314 }, // Ê
-    { 18, 24, 16, 0, 24, 108, 2412 }, // Ë
-    { 11, 25, 9, 0, 25, 69, 2520 }, // Ì
-    { 13, 29, 9, 0, 29, 95, 2589 }, // Í
-    { 13, 25, 9, 0, 25, 82, 2684 }, // Î
-    { 14, 25, 9, 0, 25, 88, 2766 }, // Ï
-    { 19, 18, 20, 0, 18, 86, 2854 }, // Ð
-    { 21, 23, 20, 0, 23, 121, 2940 }, // Ñ
-    { 21, 25, 21, 1, 24, 132, 3061 }, // Ò
-    { 21, 29, 21, 1, 28, 153, 3193 }, // Ó
-    { 21, 24, 21, 1, 23, 126, 3346 }, // Ô
-    { 21, 25, 21, 1, 24, 132, 3472 }, // Õ
-    { 21, 25, 21, 1, 24, 132, 3604 }, // Ö
-    { 10, 6, 12, 2, 8, 15, 3736 }, // ×
-    { 37, 34, 21, -8, 26, 315, 3751 }, // Ø
-    { 19, 25, 19, 1, 24, 119, 4066 }, // Ù
-    { 19, 28, 19, 1, 27, 133, 4185 }, // Ú
-    { 19, 25, 19, 1, 24, 119, 4318 }, // Û
-    { 19, 25, 19, 1, 24, 119, 4437 }, // Ü
-    { 15, 28, 19, 5, 28, 105, 4556 }, // Ý
-    { 13, 17, 12, 1, 17, 56, 4661 }, // Þ
-    { 15, 17, 14, 1, 17, 64, 4717 }, // ß
-    { 14, 17, 16, 0, 17, 60, 4781 }, // à
-    { 14, 21, 16, 0, 21, 74, 4841 }, // á
-    { 15, 17, 16, 0, 17, 64, 4915 }, // â
-    { 14, 17, 16, 0, 17, 60, 4979 }, // ã
-    { 15, 17, 16, 0, 17, 64, 5039 }, // ä
-    { 14, 18, 16, 0, 18, 63, 5103 }, // å
-    { 23, 13, 26, 0, 13, 75, 5166 }, // æ
-    { 11, 18, 14, 1, 13, 50, 5241 }, // ç
-    { 13, 19, 16, 1, 19, 62, 5291 }, // è
-    { 14, 23, 16, 1, 23, 81, 5353 }, // é
-    { 14, 19, 16, 1, 19, 67, 5434 }, // ê
-    { 15, 20, 16, 1, 20, 75, 5501 }, // ë
-    { 9, 18, 8, 0, 18, 41, 5576 }, // ì
-    { 11, 21, 8, 0, 21, 58, 5617 }, // í
-    { 11, 17, 8, 0, 17, 47, 5675 }, // î
-    { 11, 18, 8, 0, 18, 50, 5722 }, // ï
-    { 18, 17, 17, 2, 17, 77, 5772 }, // ð
-    { 16, 18, 16, 0, 18, 72, 5849 }, // ñ
-    { 14, 19, 16, 1, 19, 67, 5921 }, // ò
-    { 14, 23, 16, 1, 23, 81, 5988 }, // ó
-    { 14, 19, 16, 1, 19, 67, 6069 }, // ô
-    { 14, 19, 16, 1, 19, 67, 6136 }, // õ
-    { 15, 19, 16, 1, 19, 72, 6203 }, // ö
-    { 14, 13, 16, 3, 13, 46, 6275 }, // ÷
-    { 21, 33, 16, -3, 22, 174, 6321 }, // ø
-    { 13, 18, 15, 1, 18, 59, 6495 }, // ù
-    { 13, 22, 15, 1, 22, 72, 6554 }, // ú
-    { 13, 17, 15, 1, 17, 56, 6626 }, // û
-    { 14, 18, 15, 1, 18, 63, 6682 }, // ü
-    { 16, 29, 16, 0, 23, 116, 6745 }, // ý
-    { 13, 21, 12, 0, 17, 69, 6861 }, // þ
-    { 16, 26, 16, 0, 20, 104, 6930 }, // ÿ
-    { 20, 23, 21, 0, 23, 115, 0 }, // Ā
-    { 15, 16, 16, 0, 16, 60, 115 }, // ā
-    { 20, 26, 21, 0, 26, 130, 175 }, // Ă
-    { 15, 19, 16, 0, 19, 72, 305 }, // ă
-    { 17, 23, 21, 0, 18, 98, 377 }, // Ą
-    { 14, 17, 16, 0, 13, 60, 475 }, // ą
-    { 18, 29, 18, 1, 28, 131, 535 }, // Ć
-    { 13, 21, 14, 1, 20, 69, 666 }, // ć
-    { 18, 27, 18, 1, 26, 122, 735 }, // Ĉ
-    { 14, 19, 14, 1, 18, 67, 857 }, // ĉ
-    { 18, 27, 18, 1, 26, 122, 924 }, // Ċ
-    { 11, 20, 14, 1, 19, 55, 1046 }, // ċ
-    { 18, 28, 18, 1, 27, 126, 1101 }, // Č
-    { 13, 21, 14, 1, 20, 69, 1227 }, // č
-    { 19, 26, 20, 0, 26, 124, 1296 }, // Ď
-    { 20, 19, 16, 1, 18, 95, 1420 }, // ď
-    { 19, 18, 20, 0, 18, 86, 1515 }, // Đ
-    { 19, 19, 16, 1, 18, 91, 1601 }, // đ
-    { 18, 23, 16, 0, 23, 104, 1692 }, // Ē
-    { 15, 19, 16, 1, 19, 72, 1796 }, // ē
-    { 18, 26, 16, 0, 26, 117, 1868 }, // Ĕ
-    { 15, 22, 16, 1, 22, 83, 1985 }, // ĕ
-    { 17, 25, 16, 0, 25, 107, 2068 }, // Ė
-    { 13, 21, 16, 1, 21, 69, 2175 }, // ė
-    { 17, 23, 16, 0, 18, 98, 2244 }, // Ę
-    { 13, 19, 16, 1, 13, 62, 2342 }, // ę
-    { 17, 25, 16, 0, 25, 107, 2404 }, // Ě
-    { 14, 22, 16, 1, 22, 77, 2511 }, // ě
-    { 19, 24, 21, 1, 24, 114, 2588 }, // Ĝ
-    { 16, 23, 15, 0, 18, 92, 2702 }, // ĝ
-    { 19, 26, 21, 1, 26, 124, 2794 }, // Ğ
-    { 15, 25, 15, 0, 20, 94, 2918 }, // ğ
-    { 18, 25, 21, 1, 25, 113, 3012 }, // Ġ
-    { 15, 24, 15, 0, 19, 90, 3125 }, // ġ
-    { 18, 28, 21, 1, 19, 126, 3215 }, // Ģ
-    { 15, 25, 15, 0, 20, 94, 3341 }, // ģ
-    { 20, 24, 19, 0, 24, 120, 3435 }, // Ĥ
-    { 14, 23, 16, 0, 23, 81, 3555 }, // ĥ
-    { 20, 18, 19, 0, 18, 90, 3636 }, // Ħ
-    { 14, 18, 16, 0, 18, 63, 3726 }, // ħ
-    { 13, 26, 9, 0, 26, 85, 3789 }, // Ĩ
-    { 11, 18, 8, 0, 18, 50, 3874 }, // ĩ
-    { 14, 24, 9, 0, 24, 84, 3924 }, // Ī
-    { 11, 17, 8, 0, 17, 47, 4008 }, // ī
-    { 10, 23, 13, 2, 18, 58, 4055 }, // Į
-    { 10, 24, 8, -1, 19, 60, 4113 }, // į
-    { 11, 26, 9, 0, 26, 72, 4173 }, // İ
-    { 7, 12, 8, 0, 12, 21, 4245 }, // ı
-    { 17, 23, 19, 0, 18, 98, 4266 }, // Ĳ
-    { 20, 24, 8, 0, 18, 120, 4364 }, // ĳ
-    { 18, 29, 13, -1, 24, 131, 4484 }, // Ĵ
-    { 17, 24, 13, 2, 18, 102, 4615 }, // ĵ
-    { 17, 25, 18, 0, 18, 107, 4717 }, // Ķ
-    { 12, 26, 16, 0, 17, 78, 4824 }, // ķ
-    { 10, 12, 12, 0, 12, 30, 4902 }, // ĸ
-    { 13, 25, 16, 0, 25, 82, 4932 }, // Ĺ
-    { 12, 25, 10, 1, 25, 75, 5014 }, // ĺ
-    { 13, 27, 16, 0, 18, 88, 5089 }, // Ļ
-    { 9, 25, 10, 0, 17, 57, 5177 }, // ļ
-    { 15, 18, 16, 0, 18, 68, 5234 }, // Ľ
-    { 13, 18, 10, 1, 18, 59, 5302 }, // ľ
-    { 15, 18, 16, 0, 18, 68, 5361 }, // Ŀ
-    { 11, 17, 10, 1, 17, 47, 5429 }, // ŀ
-    { 29, 27, 16, -10, 22, 196, 5476 }, // Ł
-    { 20, 17, 10, -7, 17, 85, 5672 }, // ł
-    { 21, 25, 20, 0, 25, 132, 5757 }, // Ń
-    { 15, 20, 16, 0, 20, 75, 5889 }, // ń
-    { 21, 25, 20, 0, 18, 132, 5964 }, // Ņ
-    { 14, 19, 16, 0, 12, 67, 6096 }, // ņ
-    { 21, 25, 20, 0, 25, 132, 6163 }, // Ň
-    { 15, 20, 16, 0, 20, 75, 6295 }, // ň
-    { 14, 22, 14, -2, 22, 77, 6370 }, // ŉ
-    { 21, 23, 20, 0, 18, 121, 6447 }, // Ŋ
-    { 14, 16, 16, 0, 12, 56, 6568 }, // ŋ
-    { 21, 24, 21, 1, 23, 126, 6624 }, // Ō
-    { 15, 18, 16, 1, 18, 68, 6750 }, // ō
-    { 21, 27, 21, 1, 26, 142, 6818 }, // Ŏ
-    { 15, 22, 16, 1, 22, 83, 6960 }, // ŏ
-    { 21, 26, 21, 1, 25, 137, 7043 }, // Ő
-    { 17, 20, 16, 1, 20, 85, 7180 }, // ő
-    { 28, 19, 25, 1, 19, 133, 7265 }, // Œ
-    { 22, 13, 22, 1, 13, 72, 7398 }, // œ
-    { 16, 25, 17, 0, 25, 100, 7470 }, // Ŕ
-    { 11, 18, 12, 0, 18, 50, 7570 }, // ŕ
-    { 16, 28, 17, 0, 18, 112, 7620 }, // Ŗ
-    { 12, 23, 12, -1, 12, 69, 7732 }, // ŗ
-    { 16, 25, 17, 0, 25, 100, 7801 }, // Ř
-    { 12, 18, 12, 0, 18, 54, 7901 }, // ř
-    { 18, 28, 20, 1, 27, 126, 7955 }, // Ś
-    { 12, 20, 15, 1, 20, 60, 8081 }, // ś
-    { 19, 26, 20, 1, 25, 124, 8141 }, // Ŝ
-    { 13, 18, 15, 1, 18, 59, 8265 }, // ŝ
-    { 18, 23, 20, 1, 18, 104, 8324 }, // Ş
-    { 12, 18, 15, 1, 12, 54, 8428 }, // ş
-    { 18, 27, 20, 1, 26, 122, 8482 }, // Š
-    { 12, 20, 15, 1, 20, 60, 8604 }, // š
-    { 17, 22, 20, 4, 18, 94, 8664 }, // Ţ
-    { 10, 20, 14, 3, 16, 50, 8758 }, // ţ
-    { 17, 24, 20, 4, 24, 102, 8808 }, // Ť
-    { 12, 18, 14, 3, 18, 54, 8910 }, // ť
-    { 17, 18, 20, 4, 18, 77, 8964 }, // Ŧ
-    { 12, 16, 14, 1, 16, 48, 9041 }, // ŧ
-    { 19, 26, 19, 1, 25, 124, 9089 }, // Ũ
-    { 13, 19, 15, 1, 19, 62, 9213 }, // ũ
-    { 19, 24, 19, 1, 23, 114, 9275 }, // Ū
-    { 14, 17, 15, 1, 17, 60, 9389 }, // ū
-    { 19, 28, 19, 1, 27, 133, 9449 }, // Ŭ
-    { 14, 20, 15, 1, 20, 70, 9582 }, // ŭ
-    { 19, 27, 19, 1, 26, 129, 9652 }, // Ů
-    { 13, 20, 15, 1, 20, 65, 9781 }, // ů
-    { 20, 26, 19, 1, 25, 130, 9846 }, // Ű
-    { 16, 19, 15, 1, 19, 76, 9976 }, // ű
-    { 19, 23, 19, 1, 18, 110, 10052 }, // Ų
-    { 13, 17, 15, 1, 12, 56, 10162 }, // ų
-    { 24, 23, 27, 4, 23, 138, 10218 }, // Ŵ
-    { 17, 18, 20, 3, 18, 77, 10356 }, // ŵ
-    { 15, 24, 19, 5, 24, 90, 10433 }, // Ŷ
-    { 16, 25, 16, 0, 19, 100, 10523 }, // ŷ
-    { 15, 25, 19, 5, 25, 94, 10623 }, // Ÿ
-    { 21, 25, 21, 0, 25, 132, 10717 }, // Ź
-    { 15, 20, 16, 0, 20, 75, 10849 }, // ź
-    { 21, 24, 21, 0, 24, 126, 10924 }, // Ż
-    { 15, 19, 16, 0, 19, 72, 11050 }, // ż
-    { 21, 25, 21, 0, 25, 132, 11122 }, // Ž
-    { 15, 20, 16, 0, 20, 75, 11254 }, // ž
-    { 11, 17, 11, 3, 17, 47, 11329 }, // ſ
-    { 6, 4, 0, 5, 16, 6, 0 }, // ̀
-    { 6, 5, 0, 4, 17, 8, 6 }, // ́
-    { 10, 5, 0, -1, 1, 13, 14 }, // ̂
-    { 9, 5, 0, 4, 16, 12, 27 }, // ̃
-    { 10, 3, 0, 4, 14, 8, 39 }, // ̄
-    { 14, 3, 0, 6, 18, 11, 47 }, // ̅
-    { 10, 5, 0, 4, 16, 13, 58 }, // ̆
-    { 5, 4, 0, 4, 16, 5, 71 }, // ̇
-    { 10, 4, 0, 4, 16, 10, 76 }, // ̈
-    { 6, 4, 0, 3, 13, 6, 86 }, // ̉
-    { 6, 5, 0, 4, 16, 8, 92 }, // ̊
-    { 15, 4, 0, 4, 16, 15, 100 }, // ̋
-    { 9, 5, 0, 4, 16, 12, 115 }, // ̌
-    { 15, 4, 0, -7, 17, 15, 127 }, // ̏
-    { 7, 6, 0, 3, 16, 11, 142 }, // ̒
-    { 7, 6, 0, 3, 15, 11, 153 }, // ̓
-    { 8, 6, 0, -4, 15, 12, 164 }, // ̔
-    { 5, 5, 0, 0, -1, 7, 176 }, // ̘
-    { 5, 5, 0, 1, -1, 7, 183 }, // ̙
-    { 9, 5, 0, 5, 17, 12, 190 }, // ̚
-    { 4, 5, 0, 4, 14, 5, 202 }, // ̛
-    { 4, 5, 0, 0, -1, 5, 207 }, // ̜
-    { 5, 4, 0, 2, 3, 5, 212 }, // ̝
-    { 5, 4, 0, 0, -1, 5, 217 }, // ̞
-    { 5, 5, 0, 0, -2, 7, 222 }, // ̟
-    { 10, 3, 0, 0, -3, 8, 229 }, // ̠
-    { 5, 4, 0, 0, 1, 5, 237 }, // ̣
-    { 11, 4, 0, -1, 0, 11, 242 }, // ̤
-    { 6, 5, 0, 4, 16, 8, 253 }, // ̥
-    { 7, 6, 0, 0, 3, 11, 261 }, // ̦
-    { 6, 6, 0, 0, 1, 9, 272 }, // ̧
-    { 6, 6, 0, 0, 1, 9, 281 }, // ̨
-    { 5, 6, 0, -1, -1, 8, 290 }, // ̩
-    { 8, 4, 0, 0, -1, 8, 298 }, // ̪
-    { 9, 5, 0, 0, 0, 12, 306 }, // ̬
-    { 9, 5, 0, -1, -1, 12, 318 }, // ̭
-    { 9, 5, 0, 4, 16, 12, 330 }, // ̰
-    { 8, 3, 0, 5, 15, 6, 342 }, // ̱
-    { 9, 3, 0, 0, -1, 7, 348 }, // ̲
-    { 9, 5, 0, 4, 16, 12, 355 }, // ̴
-    { 10, 3, 0, 3, 8, 8, 367 }, // ̵
-    { 3, 5, 0, 2, -1, 4, 375 }, // ̹
-    { 7, 4, 0, -1, -1, 7, 379 }, // ̺
-    { 8, 5, 0, 0, 0, 10, 386 }, // ̻
-    { 8, 4, 0, 0, 0, 8, 396 }, // ̼
-    { 6, 5, 0, 4, 16, 8, 404 }, // ̽
-    { 9, 5, 0, 4, 16, 12, 412 }, // ͂
-    { 4, 4, 0, 4, 17, 4, 424 }, // ̓
-    { 10, 10, 0, 4, 22, 25, 428 }, // ̈́
-    { 7, 4, 0, 5, 16, 7, 453 }, // ͆
-    { 12, 8, 0, -1, 0, 24, 460 }, // ͇
-    { 9, 6, 0, 0, 0, 14, 484 }, // ͈
-    { 7, 6, 0, 0, -1, 11, 498 }, // ͉
-    { 10, 13, 0, 4, 20, 33, 509 }, // ͊
-    { 20, 10, 0, 7, 19, 50, 542 }, // ͋
-    { 15, 11, 0, 4, 11, 42, 592 }, // ͌
-    { 11, 7, 0, 1, 0, 20, 634 }, // ͍
-    { 3, 3, 0, 3, 2, 3, 654 }, // ͎
-    { 17, 4, 0, 1, 0, 17, 657 }, // ͜
-    { 18, 4, 0, 4, 16, 18, 674 }, // ͡
-    { 21, 5, 0, 0, -1, 27, 692 }, // ͢
-    { 15, 21, 13, 1, 21, 79, 0 }, // Ѐ
-    { 15, 20, 13, 1, 20, 75, 79 }, // Ё
-    { 15, 17, 21, 7, 17, 64, 154 }, // Ђ
-    { 15, 24, 14, 1, 24, 90, 218 }, // Ѓ
-    { 17, 17, 19, 1, 16, 73, 308 }, // Є
-    { 18, 19, 20, 1, 18, 86, 381 }, // Ѕ
-    { 9, 18, 9, 0, 18, 41, 467 }, // І
-    { 13, 26, 9, 0, 26, 85, 508 }, // Ї
-    { 15, 24, 13, -1, 19, 90, 593 }, // Ј
-    { 22, 16, 24, 2, 15, 88, 683 }, // Љ
-    { 21, 17, 23, 2, 16, 90, 771 }, // Њ
-    { 17, 18, 20, 4, 18, 77, 861 }, // Ћ
-    { 19, 25, 18, 0, 25, 119, 938 }, // Ќ
-    { 19, 23, 20, 1, 23, 110, 1057 }, // Ѝ
-    { 16, 25, 14, -1, 24, 100, 1167 }, // Ў
-    { 16, 19, 15, 1, 15, 76, 1267 }, // Џ
-    { 17, 18, 21, 0, 18, 77, 1343 }, // А
-    { 15, 16, 14, 2, 15, 60, 1420 }, // Б
-    { 14, 16, 14, 1, 15, 56, 1480 }, // В
-    { 15, 15, 14, 1, 15, 57, 1536 }, // Г
-    { 16, 18, 17, 2, 15, 72, 1593 }, // Д
-    { 15, 15, 13, 1, 15, 57, 1665 }, // Е
-    { 26, 18, 27, 0, 18, 117, 1722 }, // Ж
-    { 13, 17, 15, 1, 16, 56, 1839 }, // З
-    { 19, 18, 20, 1, 18, 86, 1895 }, // И
-    { 19, 24, 20, 1, 24, 114, 1981 }, // Й
-    { 17, 18, 18, 0, 18, 77, 2095 }, // К
-    { 16, 16, 16, 2, 15, 64, 2172 }, // Л
-    { 19, 15, 18, 1, 15, 72, 2236 }, // М
-    { 20, 18, 19, 0, 18, 90, 2308 }, // Н
-    { 21, 19, 21, 1, 18, 100, 2398 }, // О
-    { 16, 16, 14, 1, 16, 64, 2498 }, // П
-    { 17, 18, 17, 0, 18, 77, 2562 }, // Р
-    { 18, 20, 18, 1, 19, 90, 2639 }, // С
-    { 17, 18, 20, 4, 18, 77, 2729 }, // Т
-    { 16, 18, 14, -1, 17, 72, 2806 }, // У
-    { 17, 16, 18, 4, 16, 68, 2878 }, // Ф
-    { 21, 18, 21, 0, 18, 95, 2946 }, // Х
-    { 15, 19, 15, 1, 16, 72, 3041 }, // Ц
-    { 13, 16, 14, 3, 16, 52, 3113 }, // Ч
-    { 19, 16, 17, 1, 16, 76, 3165 }, // Ш
-    { 19, 20, 19, 1, 16, 95, 3241 }, // Щ
-    { 12, 17, 14, 2, 16, 51, 3336 }, // Ъ
-    { 21, 18, 23, 2, 17, 95, 3387 }, // Ы
-    { 12, 17, 14, 2, 16, 51, 3482 }, // Ь
-    { 18, 17, 19, 1, 16, 77, 3533 }, // Э
-    { 20, 17, 21, 2, 16, 85, 3610 }, // Ю
-    { 17, 18, 17, 0, 18, 77, 3695 }, // Я
-    { 14, 13, 16, 0, 13, 46, 3772 }, // а
-    { 15, 16, 15, 2, 16, 60, 3818 }, // б
-    { 12, 13, 13, 0, 13, 39, 3878 }, // в
-    { 13, 12, 12, 1, 12, 39, 3917 }, // г
-    { 14, 14, 16, 2, 12, 49, 3956 }, // д
-    { 13, 13, 16, 1, 13, 43, 4005 }, // е
-    { 22, 15, 22, 0, 15, 83, 4048 }, // ж
-    { 10, 11, 9, 0, 11, 28, 4131 }, // з
-    { 14, 12, 14, 1, 12, 42, 4159 }, // и
-    { 14, 16, 14, 1, 16, 56, 4201 }, // й
-    { 13, 13, 14, 0, 13, 43, 4257 }, // к
-    { 12, 12, 11, 0, 11, 36, 4300 }, // л
-    { 17, 14, 17, 0, 14, 60, 4336 }, // м
-    { 17, 13, 17, 0, 13, 56, 4396 }, // н
-    { 13, 14, 17, 2, 13, 46, 4452 }, // о
-    { 14, 12, 14, 1, 12, 42, 4498 }, // п
-    { 17, 18, 17, -1, 12, 77, 4540 }, // р
-    { 11, 14, 14, 1, 13, 39, 4617 }, // с
-    { 12, 12, 14, 4, 12, 36, 4656 }, // т
-    { 16, 18, 16, 0, 12, 72, 4692 }, // у
-    { 17, 17, 18, 2, 12, 73, 4764 }, // ф
-    { 15, 12, 15, 1, 12, 45, 4837 }, // х
-    { 13, 15, 15, 2, 12, 49, 4882 }, // ц
-    { 9, 11, 9, 2, 11, 25, 4931 }, // ч
-    { 18, 12, 17, 1, 12, 54, 4956 }, // ш
-    { 18, 16, 19, 1, 12, 72, 5010 }, // щ
-    { 12, 12, 16, 4, 11, 36, 5082 }, // ъ
-    { 17, 13, 17, 2, 12, 56, 5118 }, // ы
-    { 12, 13, 13, 1, 12, 39, 5174 }, // ь
-    { 12, 13, 13, 2, 12, 39, 5213 }, // э
-    { 17, 14, 17, 1, 13, 60, 5252 }, // ю
-    { 14, 12, 13, 1, 12, 42, 5312 }, // я
-    { 13, 20, 16, 1, 20, 65, 5354 }, // ѐ
-    { 14, 17, 14, 2, 16, 60, 5419 }, // ё
-    { 14, 22, 16, 0, 18, 77, 5479 }, // ђ
-    { 13, 18, 12, 1, 18, 59, 5556 }, // ѓ
-    { 12, 12, 13, 0, 11, 36, 5615 }, // є
-    { 12, 12, 15, 1, 12, 36, 5651 }, // ѕ
-    { 9, 18, 8, 0, 18, 41, 5687 }, // і
-    { 11, 18, 8, 0, 18, 50, 5728 }, // ї
-    { 13, 24, 13, 2, 18, 78, 5778 }, // ј
-    { 15, 12, 17, 1, 11, 45, 5856 }, // љ
-    { 15, 12, 16, 1, 11, 45, 5901 }, // њ
-    { 14, 18, 16, 0, 18, 63, 5946 }, // ћ
-    { 13, 19, 14, 0, 19, 62, 6009 }, // ќ
-    { 14, 17, 14, 1, 17, 60, 6071 }, // ѝ
-    { 16, 27, 16, 0, 21, 108, 6131 }, // ў
-    { 13, 14, 11, 0, 11, 46, 6239 }, // џ
-    { 12, 17, 17, 5, 16, 51, 6285 }, // Ѣ
-    { 11, 16, 15, 4, 15, 44, 6336 }, // ѣ
-    { 21, 15, 21, 2, 15, 79, 6380 }, // Ѫ
-    { 14, 12, 15, 1, 11, 42, 6459 }, // ѫ
-    { 18, 19, 20, 2, 19, 86, 6501 }, // Ѳ
-    { 15, 15, 16, 1, 15, 57, 6587 }, // ѳ
-    { 24, 22, 21, 5, 22, 132, 6644 }, // Ѵ
-    { 14, 14, 17, 3, 14, 49, 6776 }, // ѵ
-    { 9, 6, 0, 5, 19, 14, 6825 }, // ҆
-    { 16, 17, 14, 1, 17, 68, 6839 }, // Ґ
-    { 14, 15, 12, 1, 15, 53, 6907 }, // ґ
-    { 15, 15, 14, 1, 15, 57, 6960 }, // Ғ
-    { 11, 11, 9, 0, 11, 31, 7017 }, // ғ
-    { 17, 17, 14, 1, 17, 73, 7048 }, // Ҕ
-    { 9, 11, 9, 0, 11, 25, 7121 }, // ҕ
-    { 25, 21, 27, -1, 18, 132, 7146 }, // Җ
-    { 17, 15, 18, -1, 13, 64, 7278 }, // җ
-    { 13, 19, 15, 2, 16, 62, 7342 }, // Ҙ
-    { 10, 16, 9, 0, 11, 40, 7404 }, // ҙ
-    { 18, 21, 18, -1, 18, 95, 7444 }, // Қ
-    { 12, 15, 13, -1, 13, 45, 7539 }, // қ
-    { 18, 16, 20, 2, 16, 72, 7584 }, // Ҝ
-    { 14, 11, 15, 1, 11, 39, 7656 }, // ҝ
-    { 17, 18, 18, 0, 18, 77, 7695 }, // Ҟ
-    { 12, 17, 16, 0, 17, 51, 7772 }, // ҟ
-    { 18, 18, 18, -1, 18, 81, 7823 }, // Ҡ
-    { 12, 13, 13, -1, 13, 39, 7904 }, // ҡ
-    { 19, 21, 19, -1, 18, 100, 7943 }, // Ң
-    { 13, 15, 13, -1, 13, 49, 8043 }, // ң
-    { 27, 19, 19, 0, 19, 129, 8092 }, // Ҥ
-    { 18, 12, 13, 0, 12, 54, 8221 }, // ҥ
-    { 22, 17, 25, 2, 17, 94, 8275 }, // Ҧ
-    { 19, 20, 22, 2, 14, 95, 8369 }, // ҧ
-    { 20, 18, 25, 3, 17, 90, 8464 }, // Ҩ
-    { 16, 15, 19, 2, 14, 60, 8554 }, // ҩ
-    { 18, 23, 18, 1, 19, 104, 8614 }, // Ҫ
-    { 11, 16, 14, 1, 13, 44, 8718 }, // ҫ
-    { 16, 21, 20, 3, 18, 84, 8762 }, // Ҭ
-    { 12, 14, 13, 1, 12, 42, 8846 }, // ҭ
-    { 15, 18, 19, 5, 18, 68, 8888 }, // Ү
-    { 12, 15, 14, 4, 11, 45, 8956 }, // ү
-    { 16, 18, 19, 4, 18, 72, 9001 }, // Ұ
-    { 16, 16, 14, 0, 11, 64, 9073 }, // ұ
-    { 21, 21, 21, -1, 18, 111, 9137 }, // Ҳ
-    { 14, 15, 14, -1, 13, 53, 9248 }, // ҳ
-    { 16, 19, 22, 5, 15, 76, 9301 }, // Ҵ
-    { 12, 14, 16, 3, 11, 42, 9377 }, // ҵ
-    { 14, 20, 17, 3, 15, 70, 9419 }, // Ҷ
-    { 10, 15, 12, 2, 11, 38, 9489 }, // ҷ
-    { 14, 15, 15, 4, 15, 53, 9527 }, // Ҹ
-    { 10, 11, 10, 2, 11, 28, 9580 }, // ҹ
-    { 13, 17, 16, 2, 17, 56, 9608 }, // Һ
-    { 14, 18, 16, 0, 18, 63, 9664 }, // һ
-    { 18, 16, 20, 1, 15, 72, 9727 }, // Ҽ
-    { 13, 12, 15, 0, 12, 39, 9799 }, // ҽ
-    { 17, 18, 23, 4, 15, 77, 9838 }, // Ҿ
-    { 13, 14, 16, 2, 12, 46, 9915 }, // ҿ
-    { 9, 18, 9, 0, 18, 41, 9961 }, // Ӏ
-    { 26, 26, 27, 0, 26, 169, 10002 }, // Ӂ
-    { 22, 23, 22, 0, 23, 127, 10171 }, // ӂ
-    { 15, 21, 16, 2, 16, 79, 10298 }, // Ӄ
-    { 10, 15, 11, 1, 11, 38, 10377 }, // ӄ
-    { 16, 19, 16, 2, 15, 76, 10415 }, // Ӆ
-    { 12, 14, 11, 0, 11, 42, 10491 }, // ӆ
-    { 20, 23, 19, 0, 18, 115, 10533 }, // Ӈ
-    { 13, 17, 13, 0, 13, 56, 10648 }, // ӈ
-    { 20, 24, 19, 0, 18, 120, 10704 }, // Ӊ
-    { 13, 17, 13, 0, 13, 56, 10824 }, // ӊ
-    { 13, 19, 14, 3, 15, 62, 10880 }, // Ӌ
-    { 9, 14, 10, 2, 11, 32, 10942 }, // ӌ
-    { 23, 24, 26, 0, 18, 138, 10974 }, // Ӎ
-    { 15, 17, 18, 0, 13, 64, 11112 }, // ӎ
-    { 6, 15, 6, 2, 15, 23, 11176 }, // ӏ
-    { 20, 26, 21, 0, 26, 130, 11199 }, // Ӑ
-    { 18, 20, 16, 0, 20, 90, 11329 }, // ӑ
-    { 20, 24, 21, 0, 24, 120, 11419 }, // Ӓ
-    { 18, 18, 16, 0, 18, 81, 11539 }, // ӓ
-    { 28, 19, 30, 0, 18, 133, 11620 }, // Ӕ
-    { 23, 13, 26, 0, 13, 75, 11753 }, // ӕ
-    { 15, 23, 13, 1, 23, 87, 11828 }, // Ӗ
-    { 15, 21, 16, 1, 21, 79, 11915 }, // ӗ
-    { 14, 13, 16, 1, 12, 46, 11994 }, // Ә
-    { 13, 14, 17, 7, 13, 46, 12040 }, // ә
-    { 17, 22, 16, 1, 21, 94, 12086 }, // Ӛ
-    { 14, 15, 17, 6, 13, 53, 12180 }, // ӛ
-    { 26, 24, 27, 0, 24, 156, 12233 }, // Ӝ
-    { 22, 21, 22, 0, 21, 116, 12389 }, // ӝ
-    { 15, 23, 15, 1, 22, 87, 12505 }, // Ӟ
-    { 15, 17, 9, 0, 17, 64, 12592 }, // ӟ
-    { 12, 15, 12, 2, 15, 45, 12656 }, // Ӡ
-    { 12, 15, 12, 1, 11, 45, 12701 }, // ӡ
-    { 19, 21, 20, 1, 21, 100, 12746 }, // Ӣ
-    { 15, 16, 14, 1, 16, 60, 12846 }, // ӣ
-    { 19, 22, 20, 1, 22, 105, 12906 }, // Ӥ
-    { 15, 17, 14, 1, 17, 64, 13011 }, // ӥ
-    { 21, 25, 21, 1, 24, 132, 13075 }, // Ӧ
-    { 14, 19, 17, 2, 18, 67, 13207 }, // ӧ
-    { 17, 16, 21, 2, 15, 68, 13274 }, // Ө
-    { 14, 12, 16, 1, 12, 42, 13342 }, // ө
-    { 17, 25, 21, 2, 24, 107, 13384 }, // Ӫ
-    { 15, 20, 16, 1, 20, 75, 13491 }, // ӫ
-    { 18, 23, 19, 1, 22, 104, 13566 }, // Ӭ
-    { 13, 18, 13, 2, 17, 59, 13670 }, // ӭ
-    { 16, 22, 14, -1, 21, 88, 13729 }, // Ӯ
-    { 16, 25, 16, 0, 19, 100, 13817 }, // ӯ
-    { 16, 23, 14, -1, 22, 92, 13917 }, // Ӱ
-    { 16, 26, 16, 0, 20, 104, 14009 }, // ӱ
-    { 18, 24, 14, -1, 23, 108, 14113 }, // Ӳ
-    { 19, 26, 16, 0, 20, 124, 14221 }, // ӳ
-    { 14, 22, 14, 3, 22, 77, 14345 }, // Ӵ
-    { 11, 17, 9, 2, 17, 47, 14422 }, // ӵ
-    { 15, 18, 14, 1, 15, 68, 14469 }, // Ӷ
-    { 11, 13, 9, 0, 11, 36, 14537 }, // ӷ
-    { 21, 24, 23, 2, 23, 126, 14573 }, // Ӹ
-    { 17, 20, 17, 2, 19, 85, 14699 }, // ӹ
-    { 21, 22, 21, 0, 18, 116, 14784 }, // Ӽ
-    { 14, 15, 14, 0, 13, 53, 14900 }, // ӽ
-    { 0, 0, 17, 0, 0, 0, 0 }, //  
-    { 0, 0, 28, 0, 0, 0, 0 }, //  
-    { 0, 0, 17, 0, 0, 0, 0 }, //  
-    { 0, 0, 28, 0, 0, 0, 0 }, //  
-    { 0, 0, 14, 0, 0, 0, 0 }, //  
-    { 0, 0, 12, 0, 0, 0, 0 }, //  
-    { 0, 0, 10, 0, 0, 0, 0 }, //  
-    { 0, 0, 14, 0, 0, 0, 0 }, //  
-    { 0, 0, 5, 0, 0, 0, 0 }, //  
-    { 0, 0, 11, 0, 0, 0, 0 }, //  
-    { 0, 0, 10, 0, 0, 0, 0 }, //  
-    { 0, 0, 7, 0, 0, 0, 0 }, // ​
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‍
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‎
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‏
-    { 10, 3, 11, 3, 8, 8, 0 }, // ‐
-    { 10, 3, 11, 3, 8, 8, 8 }, // ‑
-    { 16, 3, 16, 3, 8, 12, 16 }, // ‒
-    { 14, 3, 17, 3, 8, 11, 28 }, // –
-    { 21, 3, 23, 3, 8, 16, 39 }, // —
-    { 21, 3, 23, 3, 8, 16, 55 }, // ―
-    { 14, 18, 11, 0, 15, 63, 71 }, // ‖
-    { 17, 8, 16, 0, -1, 34, 134 }, // ‗
-    { 7, 6, 7, 4, 18, 11, 168 }, // ‘
-    { 7, 6, 7, 4, 18, 11, 179 }, // ’
-    { 7, 6, 7, 0, 3, 11, 190 }, // ‚
-    { 7, 6, 7, 4, 18, 11, 201 }, // ‛
-    { 12, 6, 12, 4, 18, 18, 212 }, // “
-    { 12, 6, 12, 4, 18, 18, 230 }, // ”
-    { 7, 6, 7, 0, 3, 11, 248 }, // „
-    { 12, 6, 12, 4, 18, 18, 259 }, // ‟
-    { 12, 27, 12, 3, 21, 81, 277 }, // †
-    { 14, 27, 13, 1, 21, 95, 358 }, // ‡
-    { 14, 12, 11, 0, 14, 42, 453 }, // •
-    { 7, 7, 8, 2, 9, 13, 495 }, // ‣
-    { 4, 4, 5, 1, 4, 4, 508 }, // ․
-    { 4, 4, 5, 1, 4, 4, 512 }, // ‥
-    { 19, 4, 20, 1, 4, 19, 516 }, // …
-    { 4, 3, 5, 1, 8, 3, 535 }, // ‧
-    { 0, 0, 26, 0, 0, 0, 538 }, //  
-    { 17, 18, 23, 5, 16, 77, 538 }, // ‰
-    { 7, 6, 7, 4, 18, 11, 615 }, // ′
-    { 12, 6, 12, 4, 18, 18, 626 }, // ″
-    { 15, 7, 18, -2, 18, 27, 644 }, // ‴
-    { 4, 7, 7, 5, 18, 7, 671 }, // ‵
-    { 9, 7, 11, 4, 18, 16, 678 }, // ‶
-    { 15, 7, 18, 5, 18, 27, 694 }, // ‷
-    { 9, 4, 12, 5, 17, 9, 721 }, // ‸
-    { 7, 10, 9, 3, 11, 18, 730 }, // ‹
-    { 8, 10, 9, -2, 11, 20, 748 }, // ›
-    { 27, 21, 28, 1, 19, 142, 768 }, // ※
-    { 11, 21, 7, 0, 21, 58, 910 }, // ‼
-    { 14, 26, 16, 4, 25, 91, 968 }, // ‽
-    { 11, 3, 11, 5, 17, 9, 1059 }, // ‾
-    { 10, 4, 13, 4, 14, 10, 1068 }, // ‿
-    { 15, 14, 17, 3, 19, 53, 1078 }, // ⁂
-    { 17, 17, 23, 5, 16, 73, 1131 }, // ⁄
-    { 25, 24, 26, 5, 24, 150, 1204 }, // ⁇
-    { 18, 23, 21, 5, 23, 104, 1354 }, // ⁈
-    { 21, 25, 17, 0, 23, 132, 1458 }, // ⁉
-    { 21, 33, 15, -1, 23, 174, 1590 }, // ⁒
-    { 0, 0, 100, 0, 0, 0, 1764 }, //  
-    { 8, 8, 7, 2, 17, 16, 0 }, // ⁰
-    { 6, 9, 7, 3, 18, 14, 16 }, // ⁴
-    { 8, 9, 7, 2, 18, 18, 30 }, // ⁵
-    { 8, 8, 7, 2, 17, 16, 48 }, // ⁶
-    { 6, 9, 7, 4, 18, 14, 64 }, // ⁷
-    { 8, 8, 7, 2, 17, 16, 78 }, // ⁸
-    { 8, 8, 7, 2, 17, 16, 94 }, // ⁹
-    { 14, 12, 16, 0, 12, 42, 110 }, // ⁿ
-    { 10, 11, 9, 1, 11, 28, 152 }, // ₀
-    { 6, 9, 6, -1, 5, 14, 180 }, // ₁
-    { 7, 9, 7, -1, 5, 16, 194 }, // ₂
-    { 7, 9, 7, -1, 5, 16, 210 }, // ₃
-    { 7, 8, 7, -1, 5, 14, 226 }, // ₄
-    { 7, 8, 6, -1, 5, 14, 240 }, // ₅
-    { 7, 8, 7, -1, 4, 14, 254 }, // ₆
-    { 6, 9, 7, 1, 5, 14, 268 }, // ₇
-    { 8, 9, 7, -1, 5, 18, 282 }, // ₈
-    { 8, 9, 7, -1, 5, 18, 300 }, // ₉
-    { 12, 29, 9, 2, 21, 87, 318 }, // ₍
-    { 12, 29, 9, -5, 21, 87, 405 }, // ₎
-    { 20, 28, 18, 0, 23, 140, 0 }, // ₡
-    { 18, 20, 18, 1, 19, 90, 140 }, // ₢
-    { 17, 20, 14, 0, 20, 85, 230 }, // ₤
-    { 21, 18, 20, 0, 18, 95, 315 }, // ₦
-    { 18, 18, 17, 0, 18, 81, 410 }, // ₧
-    { 24, 18, 24, 0, 18, 108, 491 }, // ₨
-    { 18, 18, 16, -1, 18, 81, 599 }, // ₩
-    { 20, 16, 22, 3, 16, 80, 680 }, // ₪
-    { 15, 17, 14, 2, 17, 64, 760 }, // ₫
-    { 16, 19, 17, 2, 16, 76, 824 }, // €
-    { 17, 18, 20, 4, 18, 77, 900 }, // ₮
-    { 21, 18, 13, 0, 18, 95, 977 }, // ₱
-    { 18, 25, 21, 1, 22, 113, 1072 }, // ₲
-    { 23, 19, 19, 2, 18, 110, 1185 }, // ₴
-    { 11, 16, 14, 1, 15, 44, 1295 }, // ₵
-    { 19, 19, 20, 4, 19, 91, 1339 }, // ₸
-    { 12, 17, 13, 3, 16, 51, 1430 }, // ₹
-    { 13, 15, 14, 2, 14, 49, 1481 }, // ₺
-    { 16, 16, 13, 1, 16, 64, 1530 }, // ₼
-    { 19, 18, 17, -2, 18, 86, 1594 }, // ₽
-    { 13, 13, 16, -2, 10, 43, 0 }, // ←
-    { 14, 13, 16, 3, 13, 46, 43 }, // ↑
-    { 13, 13, 16, 5, 10, 43, 89 }, // →
-    { 14, 13, 16, 6, 13, 46, 132 }, // ↓
-    { 22, 11, 19, -1, 10, 61, 178 }, // ↔
-    { 11, 22, 14, 3, 20, 61, 239 }, // ↕
-    { 12, 9, 13, -2, 9, 27, 300 }, // ↖
-    { 13, 9, 13, 3, 9, 30, 327 }, // ↗
-    { 10, 13, 13, 5, 12, 33, 357 }, // ↘
-    { 11, 13, 13, -2, 12, 36, 390 }, // ↙
-    { 16, 13, 18, 0, 12, 52, 426 }, // ⇐
-    { 17, 15, 19, 3, 15, 64, 478 }, // ⇑
-    { 16, 13, 18, 2, 12, 52, 542 }, // ⇒
-    { 17, 16, 19, 7, 15, 68, 594 }, // ⇓
-    { 21, 13, 20, 0, 12, 69, 662 }, // ⇔
-    { 13, 20, 16, 5, 13, 65, 731 }, // ⇕
-    { 15, 17, 14, 2, 17, 64, 0 }, // ∂
-    { 22, 20, 21, 0, 19, 110, 64 }, // ∅
-    { 16, 16, 18, 1, 16, 64, 174 }, // ∆
-    { 15, 15, 15, 3, 15, 57, 238 }, // ∏
-    { 15, 15, 15, 7, 15, 57, 295 }, // ∐
-    { 14, 16, 12, 1, 15, 56, 352 }, // ∑
-    { 11, 3, 13, 2, 7, 9, 408 }, // −
-    { 21, 18, 19, 2, 17, 95, 417 }, // √
-    { 19, 11, 19, 2, 13, 53, 512 }, // ∞
-    { 22, 24, 18, 0, 19, 132, 565 }, // ∫
-    { 8, 13, 6, 0, 13, 26, 697 }, // ∶
-    { 15, 11, 16, 4, 11, 42, 723 }, // ≈
-    { 17, 18, 23, 5, 16, 77, 765 }, // ≠
-    { 18, 16, 18, -1, 15, 72, 842 }, // ≤
-    { 18, 16, 18, 1, 15, 72, 914 }, // ≥
+    { 14, 10, 17, 2, 10, 35, 5736 }, // «
+    { 10, 6, 13, 3, 7, 15, 444 }, // ¬
+    { 10, 3, 11, 3, 8, 8, 459 }, // ­
+    { 10, 8, 11, 5, 22, 20, 467 }, // ®
+    { 8, 3, 11, 5, 15, 6, 487 }, // ¯
+    { 11, 10, 11, 3, 17, 28, 493 }, // °
+    { 13, 13, 15, 0, 12, 43, 521 }, // ±
+    { 7, 8, 6, 2, 17, 14, 564 }, // ²
+    { 8, 8, 7, 2, 17, 16, 578 }, // ³
+    { 6, 5, 6, 4, 17, 8, 594 }, // ´
+    { 15, 14, 15, -1, 12, 53, 602 }, // µ
+    { 14, 17, 13, 1, 15, 60, 655 }, // ¶
+    { 5, 4, 5, 2, 9, 5, 715 }, // ·
+    { 6, 6, 7, 0, 1, 9, 720 }, // ¸
+    { 6, 9, 6, 2, 18, 14, 729 }, // ¹
+    { 8, 7, 9, 3, 15, 14, 743 }, // º
+    { 15, 10, 13, -3, 10, 38, 5771 }, // »
+    { 17, 20, 23, 5, 19, 85, 757 }, // ¼
+    { 18, 20, 23, 5, 18, 90, 842 }, // ½
+    { 18, 19, 23, 4, 18, 86, 932 }, // ¾
+    { 14, 23, 12, -2, 12, 81, 1018 }, // ¿
+    { 17, 24, 21, 0, 24, 102, 5809 }, // À
+    { 19, 27, 21, 0, 27, 129, 5911 }, // Á
+    { 19, 23, 21, 0, 23, 110, 6040 }, // Â
+    { 19, 24, 21, 0, 24, 114, 1099 }, // Ã
+    { 20, 24, 21, 0, 24, 120, 6150 }, // Ä
+    { 18, 25, 21, 0, 25, 113, 1213 }, // Å
+    { 28, 19, 30, 0, 18, 133, 1326 }, // Æ
+    { 18, 24, 18, 1, 19, 108, 6270 }, // Ç
+    { 17, 23, 16, 0, 23, 98, 6378 }, // È
+    { 17, 27, 16, 0, 27, 115, 6476 }, // É
+    { 17, 23, 16, 0, 23, 98, 6591 }, // Ê
+    { 18, 24, 16, 0, 24, 108, 6689 }, // Ë
+    { 11, 25, 9, 0, 25, 69, 6797 }, // Ì
+    { 13, 29, 9, 0, 29, 95, 6866 }, // Í
+    { 13, 25, 9, 0, 25, 82, 6961 }, // Î
+    { 14, 25, 9, 0, 25, 88, 7043 }, // Ï
+    { 19, 18, 20, 0, 18, 86, 1459 }, // Ð
+    { 21, 23, 20, 0, 23, 121, 7131 }, // Ñ
+    { 21, 25, 21, 1, 24, 132, 7252 }, // Ò
+    { 21, 29, 21, 1, 28, 153, 7384 }, // Ó
+    { 21, 24, 21, 1, 23, 126, 7537 }, // Ô
+    { 21, 25, 21, 1, 24, 132, 1545 }, // Õ
+    { 21, 25, 21, 1, 24, 132, 7663 }, // Ö
+    { 10, 6, 12, 2, 8, 15, 1677 }, // ×
+    { 37, 34, 21, -8, 26, 315, 1692 }, // Ø
+    { 19, 25, 19, 1, 24, 119, 7795 }, // Ù
+    { 19, 28, 19, 1, 27, 133, 7914 }, // Ú
+    { 19, 25, 19, 1, 24, 119, 8047 }, // Û
+    { 19, 25, 19, 1, 24, 119, 8166 }, // Ü
+    { 15, 28, 19, 5, 28, 105, 2007 }, // Ý
+    { 13, 17, 12, 1, 17, 56, 2112 }, // Þ
+    { 15, 17, 14, 1, 17, 64, 2168 }, // ß
+    { 14, 17, 16, 0, 17, 60, 8285 }, // à
+    { 14, 21, 16, 0, 21, 74, 8345 }, // á
+    { 15, 17, 16, 0, 17, 64, 8419 }, // â
+    { 14, 17, 16, 0, 17, 60, 2232 }, // ã
+    { 15, 17, 16, 0, 17, 64, 8483 }, // ä
+    { 14, 18, 16, 0, 18, 63, 2292 }, // å
+    { 23, 13, 26, 0, 13, 75, 2355 }, // æ
+    { 11, 18, 14, 1, 13, 50, 8547 }, // ç
+    { 13, 19, 16, 1, 19, 62, 8597 }, // è
+    { 14, 23, 16, 1, 23, 81, 8659 }, // é
+    { 14, 19, 16, 1, 19, 67, 8740 }, // ê
+    { 15, 20, 16, 1, 20, 75, 8807 }, // ë
+    { 9, 18, 8, 0, 18, 41, 8882 }, // ì
+    { 11, 21, 8, 0, 21, 58, 8923 }, // í
+    { 11, 17, 8, 0, 17, 47, 8981 }, // î
+    { 11, 18, 8, 0, 18, 50, 9028 }, // ï
+    { 18, 17, 17, 2, 17, 77, 2430 }, // ð
+    { 16, 18, 16, 0, 18, 72, 9078 }, // ñ
+    { 14, 19, 16, 1, 19, 67, 9150 }, // ò
+    { 14, 23, 16, 1, 23, 81, 9217 }, // ó
+    { 14, 19, 16, 1, 19, 67, 9298 }, // ô
+    { 14, 19, 16, 1, 19, 67, 2507 }, // õ
+    { 15, 19, 16, 1, 19, 72, 9365 }, // ö
+    { 14, 13, 16, 3, 13, 46, 2574 }, // ÷
+    { 21, 33, 16, -3, 22, 174, 2620 }, // ø
+    { 13, 18, 15, 1, 18, 59, 9437 }, // ù
+    { 13, 22, 15, 1, 22, 72, 9496 }, // ú
+    { 13, 17, 15, 1, 17, 56, 9568 }, // û
+    { 14, 18, 15, 1, 18, 63, 9624 }, // ü
+    { 16, 29, 16, 0, 23, 116, 2794 }, // ý
+    { 13, 21, 12, 0, 17, 69, 2910 }, // þ
+    { 16, 26, 16, 0, 20, 104, 2979 }, // ÿ
+    { 20, 23, 21, 0, 23, 115, 3083 }, // Ā
+    { 15, 16, 16, 0, 16, 60, 3198 }, // ā
+    { 20, 26, 21, 0, 26, 130, 3258 }, // Ă
+    { 15, 19, 16, 0, 19, 72, 3388 }, // ă
+    { 17, 23, 21, 0, 18, 98, 3460 }, // Ą
+    { 14, 17, 16, 0, 13, 60, 3558 }, // ą
+    { 18, 29, 18, 1, 28, 131, 3618 }, // Ć
+    { 13, 21, 14, 1, 20, 69, 3749 }, // ć
+    { 18, 27, 18, 1, 26, 122, 3818 }, // Ĉ
+    { 14, 19, 14, 1, 18, 67, 3940 }, // ĉ
+    { 18, 27, 18, 1, 26, 122, 4007 }, // Ċ
+    { 11, 20, 14, 1, 19, 55, 4129 }, // ċ
+    { 18, 28, 18, 1, 27, 126, 4184 }, // Č
+    { 13, 21, 14, 1, 20, 69, 4310 }, // č
+    { 19, 26, 20, 0, 26, 124, 4379 }, // Ď
+    { 20, 19, 16, 1, 18, 95, 4503 }, // ď
+    { 19, 18, 20, 0, 18, 86, 4598 }, // Đ
+    { 19, 19, 16, 1, 18, 91, 4684 }, // đ
+    { 18, 23, 16, 0, 23, 104, 4775 }, // Ē
+    { 15, 19, 16, 1, 19, 72, 4879 }, // ē
+    { 18, 26, 16, 0, 26, 117, 4951 }, // Ĕ
+    { 15, 22, 16, 1, 22, 83, 5068 }, // ĕ
+    { 17, 25, 16, 0, 25, 107, 5151 }, // Ė
+    { 13, 21, 16, 1, 21, 69, 5258 }, // ė
+    { 17, 23, 16, 0, 18, 98, 5327 }, // Ę
+    { 13, 19, 16, 1, 13, 62, 5425 }, // ę
+    { 17, 25, 16, 0, 25, 107, 5487 }, // Ě
+    { 14, 22, 16, 1, 22, 77, 5594 }, // ě
+    { 19, 24, 21, 1, 24, 114, 5671 }, // Ĝ
+    { 16, 23, 15, 0, 18, 92, 5785 }, // ĝ
+    { 19, 26, 21, 1, 26, 124, 5877 }, // Ğ
+    { 15, 25, 15, 0, 20, 94, 6001 }, // ğ
+    { 18, 25, 21, 1, 25, 113, 6095 }, // Ġ
+    { 15, 24, 15, 0, 19, 90, 6208 }, // ġ
+    { 18, 28, 21, 1, 19, 126, 6298 }, // Ģ
+    { 15, 25, 15, 0, 20, 94, 6424 }, // ģ
+    { 20, 24, 19, 0, 24, 120, 6518 }, // Ĥ
+    { 14, 23, 16, 0, 23, 81, 6638 }, // ĥ
+    { 20, 18, 19, 0, 18, 90, 6719 }, // Ħ
+    { 14, 18, 16, 0, 18, 63, 6809 }, // ħ
+    { 13, 26, 9, 0, 26, 85, 6872 }, // Ĩ
+    { 11, 18, 8, 0, 18, 50, 6957 }, // ĩ
+    { 14, 24, 9, 0, 24, 84, 7007 }, // Ī
+    { 11, 17, 8, 0, 17, 47, 7091 }, // ī
+    { 10, 23, 13, 2, 18, 58, 7138 }, // Į
+    { 10, 24, 8, -1, 19, 60, 7196 }, // į
+    { 11, 26, 9, 0, 26, 72, 7256 }, // İ
+    { 7, 12, 8, 0, 12, 21, 7328 }, // ı
+    { 17, 23, 19, 0, 18, 98, 7349 }, // Ĳ
+    { 20, 24, 8, 0, 18, 120, 7447 }, // ĳ
+    { 18, 29, 13, -1, 24, 131, 7567 }, // Ĵ
+    { 17, 24, 13, 2, 18, 102, 7698 }, // ĵ
+    { 17, 25, 18, 0, 18, 107, 7800 }, // Ķ
+    { 12, 26, 16, 0, 17, 78, 7907 }, // ķ
+    { 10, 12, 12, 0, 12, 30, 7985 }, // ĸ
+    { 13, 25, 16, 0, 25, 82, 8015 }, // Ĺ
+    { 12, 25, 10, 1, 25, 75, 8097 }, // ĺ
+    { 13, 27, 16, 0, 18, 88, 8172 }, // Ļ
+    { 9, 25, 10, 0, 17, 57, 8260 }, // ļ
+    { 15, 18, 16, 0, 18, 68, 8317 }, // Ľ
+    { 13, 18, 10, 1, 18, 59, 8385 }, // ľ
+    { 15, 18, 16, 0, 18, 68, 8444 }, // Ŀ
+    { 11, 17, 10, 1, 17, 47, 8512 }, // ŀ
+    { 29, 27, 16, -10, 22, 196, 8559 }, // Ł
+    { 20, 17, 10, -7, 17, 85, 8755 }, // ł
+    { 21, 25, 20, 0, 25, 132, 8840 }, // Ń
+    { 15, 20, 16, 0, 20, 75, 8972 }, // ń
+    { 21, 25, 20, 0, 18, 132, 9047 }, // Ņ
+    { 14, 19, 16, 0, 12, 67, 9179 }, // ņ
+    { 21, 25, 20, 0, 25, 132, 9246 }, // Ň
+    { 15, 20, 16, 0, 20, 75, 9378 }, // ň
+    { 14, 22, 14, -2, 22, 77, 9453 }, // ŉ
+    { 21, 23, 20, 0, 18, 121, 9530 }, // Ŋ
+    { 14, 16, 16, 0, 12, 56, 9651 }, // ŋ
+    { 21, 24, 21, 1, 23, 126, 9707 }, // Ō
+    { 15, 18, 16, 1, 18, 68, 9833 }, // ō
+    { 21, 27, 21, 1, 26, 142, 9901 }, // Ŏ
+    { 15, 22, 16, 1, 22, 83, 10043 }, // ŏ
+    { 21, 26, 21, 1, 25, 137, 10126 }, // Ő
+    { 17, 20, 16, 1, 20, 85, 10263 }, // ő
+    { 28, 19, 25, 1, 19, 133, 9687 }, // Œ
+    { 22, 13, 22, 1, 13, 72, 9820 }, // œ
+    { 16, 25, 17, 0, 25, 100, 10348 }, // Ŕ
+    { 11, 18, 12, 0, 18, 50, 10448 }, // ŕ
+    { 16, 28, 17, 0, 18, 112, 10498 }, // Ŗ
+    { 12, 23, 12, -1, 12, 69, 10610 }, // ŗ
+    { 16, 25, 17, 0, 25, 100, 10679 }, // Ř
+    { 12, 18, 12, 0, 18, 54, 10779 }, // ř
+    { 18, 28, 20, 1, 27, 126, 10833 }, // Ś
+    { 12, 20, 15, 1, 20, 60, 10959 }, // ś
+    { 19, 26, 20, 1, 25, 124, 11019 }, // Ŝ
+    { 13, 18, 15, 1, 18, 59, 11143 }, // ŝ
+    { 18, 23, 20, 1, 18, 104, 11202 }, // Ş
+    { 12, 18, 15, 1, 12, 54, 11306 }, // ş
+    { 18, 27, 20, 1, 26, 122, 11360 }, // Š
+    { 12, 20, 15, 1, 20, 60, 11482 }, // š
+    { 17, 22, 20, 4, 18, 94, 11542 }, // Ţ
+    { 10, 20, 14, 3, 16, 50, 11636 }, // ţ
+    { 17, 24, 20, 4, 24, 102, 11686 }, // Ť
+    { 12, 18, 14, 3, 18, 54, 11788 }, // ť
+    { 17, 18, 20, 4, 18, 77, 11842 }, // Ŧ
+    { 12, 16, 14, 1, 16, 48, 11919 }, // ŧ
+    { 19, 26, 19, 1, 25, 124, 11967 }, // Ũ
+    { 13, 19, 15, 1, 19, 62, 12091 }, // ũ
+    { 19, 24, 19, 1, 23, 114, 12153 }, // Ū
+    { 14, 17, 15, 1, 17, 60, 12267 }, // ū
+    { 19, 28, 19, 1, 27, 133, 12327 }, // Ŭ
+    { 14, 20, 15, 1, 20, 70, 12460 }, // ŭ
+    { 19, 27, 19, 1, 26, 129, 12530 }, // Ů
+    { 13, 20, 15, 1, 20, 65, 12659 }, // ů
+    { 20, 26, 19, 1, 25, 130, 12724 }, // Ű
+    { 16, 19, 15, 1, 19, 76, 12854 }, // ű
+    { 19, 23, 19, 1, 18, 110, 12930 }, // Ų
+    { 13, 17, 15, 1, 12, 56, 13040 }, // ų
+    { 24, 23, 27, 4, 23, 138, 13096 }, // Ŵ
+    { 17, 18, 20, 3, 18, 77, 13234 }, // ŵ
+    { 15, 24, 19, 5, 24, 90, 13311 }, // Ŷ
+    { 16, 25, 16, 0, 19, 100, 13401 }, // ŷ
+    { 15, 25, 19, 5, 25, 94, 13501 }, // Ÿ
+    { 21, 25, 21, 0, 25, 132, 13595 }, // Ź
+    { 15, 20, 16, 0, 20, 75, 13727 }, // ź
+    { 21, 24, 21, 0, 24, 126, 13802 }, // Ż
+    { 15, 19, 16, 0, 19, 72, 13928 }, // ż
+    { 21, 25, 21, 0, 25, 132, 14000 }, // Ž
+    { 15, 20, 16, 0, 20, 75, 14132 }, // ž
+    { 11, 17, 11, 3, 17, 47, 14207 }, // ſ
+    { 6, 4, 0, 5, 16, 6, 14254 }, // ̀
+    { 6, 5, 0, 4, 17, 8, 14260 }, // ́
+    { 10, 5, 0, -1, 1, 13, 14268 }, // ̂
+    { 9, 5, 0, 4, 16, 12, 14281 }, // ̃
+    { 10, 3, 0, 4, 14, 8, 14293 }, // ̄
+    { 14, 3, 0, 6, 18, 11, 14301 }, // ̅
+    { 10, 5, 0, 4, 16, 13, 14312 }, // ̆
+    { 5, 4, 0, 4, 16, 5, 14325 }, // ̇
+    { 10, 4, 0, 4, 16, 10, 14330 }, // ̈
+    { 6, 4, 0, 3, 13, 6, 14340 }, // ̉
+    { 6, 5, 0, 4, 16, 8, 14346 }, // ̊
+    { 15, 4, 0, 4, 16, 15, 14354 }, // ̋
+    { 9, 5, 0, 4, 16, 12, 14369 }, // ̌
+    { 15, 4, 0, -7, 17, 15, 14381 }, // ̏
+    { 7, 6, 0, 3, 16, 11, 14396 }, // ̒
+    { 7, 6, 0, 3, 15, 11, 14407 }, // ̓
+    { 8, 6, 0, -4, 15, 12, 14418 }, // ̔
+    { 5, 5, 0, 0, -1, 7, 14430 }, // ̘
+    { 5, 5, 0, 1, -1, 7, 14437 }, // ̙
+    { 9, 5, 0, 5, 17, 12, 14444 }, // ̚
+    { 4, 5, 0, 4, 14, 5, 14456 }, // ̛
+    { 4, 5, 0, 0, -1, 5, 14461 }, // ̜
+    { 5, 4, 0, 2, 3, 5, 14466 }, // ̝
+    { 5, 4, 0, 0, -1, 5, 14471 }, // ̞
+    { 5, 5, 0, 0, -2, 7, 14476 }, // ̟
+    { 10, 3, 0, 0, -3, 8, 14483 }, // ̠
+    { 5, 4, 0, 0, 1, 5, 14491 }, // ̣
+    { 11, 4, 0, -1, 0, 11, 14496 }, // ̤
+    { 6, 5, 0, 4, 16, 8, 14507 }, // ̥
+    { 7, 6, 0, 0, 3, 11, 14515 }, // ̦
+    { 6, 6, 0, 0, 1, 9, 14526 }, // ̧
+    { 6, 6, 0, 0, 1, 9, 14535 }, // ̨
+    { 5, 6, 0, -1, -1, 8, 14544 }, // ̩
+    { 8, 4, 0, 0, -1, 8, 14552 }, // ̪
+    { 9, 5, 0, 0, 0, 12, 14560 }, // ̬
+    { 9, 5, 0, -1, -1, 12, 14572 }, // ̭
+    { 9, 5, 0, 4, 16, 12, 14584 }, // ̰
+    { 8, 3, 0, 5, 15, 6, 14596 }, // ̱
+    { 9, 3, 0, 0, -1, 7, 14602 }, // ̲
+    { 9, 5, 0, 4, 16, 12, 14609 }, // ̴
+    { 10, 3, 0, 3, 8, 8, 14621 }, // ̵
+    { 3, 5, 0, 2, -1, 4, 14629 }, // ̹
+    { 7, 4, 0, -1, -1, 7, 14633 }, // ̺
+    { 8, 5, 0, 0, 0, 10, 14640 }, // ̻
+    { 8, 4, 0, 0, 0, 8, 14650 }, // ̼
+    { 6, 5, 0, 4, 16, 8, 14658 }, // ̽
+    { 9, 5, 0, 4, 16, 12, 14666 }, // ͂
+    { 4, 4, 0, 4, 17, 4, 14678 }, // ̓
+    { 10, 10, 0, 4, 22, 25, 14682 }, // ̈́
+    { 7, 4, 0, 5, 16, 7, 14707 }, // ͆
+    { 12, 8, 0, -1, 0, 24, 14714 }, // ͇
+    { 9, 6, 0, 0, 0, 14, 14738 }, // ͈
+    { 7, 6, 0, 0, -1, 11, 14752 }, // ͉
+    { 10, 13, 0, 4, 20, 33, 14763 }, // ͊
+    { 20, 10, 0, 7, 19, 50, 14796 }, // ͋
+    { 15, 11, 0, 4, 11, 42, 14846 }, // ͌
+    { 11, 7, 0, 1, 0, 20, 14888 }, // ͍
+    { 3, 3, 0, 3, 2, 3, 14908 }, // ͎
+    { 17, 4, 0, 1, 0, 17, 14911 }, // ͜
+    { 18, 4, 0, 4, 16, 18, 14928 }, // ͡
+    { 21, 5, 0, 0, -1, 27, 0 }, // ͢
+    { 15, 21, 13, 1, 21, 79, 27 }, // Ѐ
+    { 15, 20, 13, 1, 20, 75, 0 }, // Ё
+    { 15, 17, 21, 7, 17, 64, 106 }, // Ђ
+    { 15, 24, 14, 1, 24, 90, 170 }, // Ѓ
+    { 17, 17, 19, 1, 16, 73, 260 }, // Є
+    { 18, 19, 20, 1, 18, 86, 333 }, // Ѕ
+    { 9, 18, 9, 0, 18, 41, 419 }, // І
+    { 13, 26, 9, 0, 26, 85, 460 }, // Ї
+    { 15, 24, 13, -1, 19, 90, 545 }, // Ј
+    { 22, 16, 24, 2, 15, 88, 635 }, // Љ
+    { 21, 17, 23, 2, 16, 90, 723 }, // Њ
+    { 17, 18, 20, 4, 18, 77, 813 }, // Ћ
+    { 19, 25, 18, 0, 25, 119, 890 }, // Ќ
+    { 19, 23, 20, 1, 23, 110, 1009 }, // Ѝ
+    { 16, 25, 14, -1, 24, 100, 1119 }, // Ў
+    { 16, 19, 15, 1, 15, 76, 1219 }, // Џ
+    { 17, 18, 21, 0, 18, 77, 75 }, // А
+    { 15, 16, 14, 2, 15, 60, 152 }, // Б
+    { 14, 16, 14, 1, 15, 56, 212 }, // В
+    { 15, 15, 14, 1, 15, 57, 268 }, // Г
+    { 16, 18, 17, 2, 15, 72, 325 }, // Д
+    { 15, 15, 13, 1, 15, 57, 397 }, // Е
+    { 26, 18, 27, 0, 18, 117, 454 }, // Ж
+    { 13, 17, 15, 1, 16, 56, 571 }, // З
+    { 19, 18, 20, 1, 18, 86, 627 }, // И
+    { 19, 24, 20, 1, 24, 114, 713 }, // Й
+    { 17, 18, 18, 0, 18, 77, 827 }, // К
+    { 16, 16, 16, 2, 15, 64, 904 }, // Л
+    { 19, 15, 18, 1, 15, 72, 968 }, // М
+    { 20, 18, 19, 0, 18, 90, 1040 }, // Н
+    { 21, 19, 21, 1, 18, 100, 1130 }, // О
+    { 16, 16, 14, 1, 16, 64, 1230 }, // П
+    { 17, 18, 17, 0, 18, 77, 1294 }, // Р
+    { 18, 20, 18, 1, 19, 90, 1371 }, // С
+    { 17, 18, 20, 4, 18, 77, 1461 }, // Т
+    { 16, 18, 14, -1, 17, 72, 1538 }, // У
+    { 17, 16, 18, 4, 16, 68, 1610 }, // Ф
+    { 21, 18, 21, 0, 18, 95, 1678 }, // Х
+    { 15, 19, 15, 1, 16, 72, 1773 }, // Ц
+    { 13, 16, 14, 3, 16, 52, 1845 }, // Ч
+    { 19, 16, 17, 1, 16, 76, 1897 }, // Ш
+    { 19, 20, 19, 1, 16, 95, 1973 }, // Щ
+    { 12, 17, 14, 2, 16, 51, 2068 }, // Ъ
+    { 21, 18, 23, 2, 17, 95, 2119 }, // Ы
+    { 12, 17, 14, 2, 16, 51, 2214 }, // Ь
+    { 18, 17, 19, 1, 16, 77, 2265 }, // Э
+    { 20, 17, 21, 2, 16, 85, 2342 }, // Ю
+    { 17, 18, 17, 0, 18, 77, 2427 }, // Я
+    { 14, 13, 16, 0, 13, 46, 2504 }, // а
+    { 15, 16, 15, 2, 16, 60, 2550 }, // б
+    { 12, 13, 13, 0, 13, 39, 2610 }, // в
+    { 13, 12, 12, 1, 12, 39, 2649 }, // г
+    { 14, 14, 16, 2, 12, 49, 2688 }, // д
+    { 13, 13, 16, 1, 13, 43, 2737 }, // е
+    { 22, 15, 22, 0, 15, 83, 2780 }, // ж
+    { 10, 11, 9, 0, 11, 28, 2863 }, // з
+    { 14, 12, 14, 1, 12, 42, 2891 }, // и
+    { 14, 16, 14, 1, 16, 56, 2933 }, // й
+    { 13, 13, 14, 0, 13, 43, 2989 }, // к
+    { 12, 12, 11, 0, 11, 36, 3032 }, // л
+    { 17, 14, 17, 0, 14, 60, 3068 }, // м
+    { 17, 13, 17, 0, 13, 56, 3128 }, // н
+    { 13, 14, 17, 2, 13, 46, 3184 }, // о
+    { 14, 12, 14, 1, 12, 42, 3230 }, // п
+    { 17, 18, 17, -1, 12, 77, 3272 }, // р
+    { 11, 14, 14, 1, 13, 39, 3349 }, // с
+    { 12, 12, 14, 4, 12, 36, 3388 }, // т
+    { 16, 18, 16, 0, 12, 72, 3424 }, // у
+    { 17, 17, 18, 2, 12, 73, 3496 }, // ф
+    { 15, 12, 15, 1, 12, 45, 3569 }, // х
+    { 13, 15, 15, 2, 12, 49, 3614 }, // ц
+    { 9, 11, 9, 2, 11, 25, 3663 }, // ч
+    { 18, 12, 17, 1, 12, 54, 3688 }, // ш
+    { 18, 16, 19, 1, 12, 72, 3742 }, // щ
+    { 12, 12, 16, 4, 11, 36, 3814 }, // ъ
+    { 17, 13, 17, 2, 12, 56, 3850 }, // ы
+    { 12, 13, 13, 1, 12, 39, 3906 }, // ь
+    { 12, 13, 13, 2, 12, 39, 3945 }, // э
+    { 17, 14, 17, 1, 13, 60, 3984 }, // ю
+    { 14, 12, 13, 1, 12, 42, 4044 }, // я
+    { 13, 20, 16, 1, 20, 65, 1295 }, // ѐ
+    { 14, 17, 14, 2, 16, 60, 4086 }, // ё
+    { 14, 22, 16, 0, 18, 77, 1360 }, // ђ
+    { 13, 18, 12, 1, 18, 59, 1437 }, // ѓ
+    { 12, 12, 13, 0, 11, 36, 1496 }, // є
+    { 12, 12, 15, 1, 12, 36, 1532 }, // ѕ
+    { 9, 18, 8, 0, 18, 41, 1568 }, // і
+    { 11, 18, 8, 0, 18, 50, 1609 }, // ї
+    { 13, 24, 13, 2, 18, 78, 1659 }, // ј
+    { 15, 12, 17, 1, 11, 45, 1737 }, // љ
+    { 15, 12, 16, 1, 11, 45, 1782 }, // њ
+    { 14, 18, 16, 0, 18, 63, 1827 }, // ћ
+    { 13, 19, 14, 0, 19, 62, 1890 }, // ќ
+    { 14, 17, 14, 1, 17, 60, 1952 }, // ѝ
+    { 16, 27, 16, 0, 21, 108, 2012 }, // ў
+    { 13, 14, 11, 0, 11, 46, 2120 }, // џ
+    { 12, 17, 17, 5, 16, 51, 2166 }, // Ѣ
+    { 11, 16, 15, 4, 15, 44, 2217 }, // ѣ
+    { 21, 15, 21, 2, 15, 79, 2261 }, // Ѫ
+    { 14, 12, 15, 1, 11, 42, 2340 }, // ѫ
+    { 18, 19, 20, 2, 19, 86, 2382 }, // Ѳ
+    { 15, 15, 16, 1, 15, 57, 2468 }, // ѳ
+    { 24, 22, 21, 5, 22, 132, 2525 }, // Ѵ
+    { 14, 14, 17, 3, 14, 49, 2657 }, // ѵ
+    { 9, 6, 0, 5, 19, 14, 2706 }, // ҆
+    { 16, 17, 14, 1, 17, 68, 2720 }, // Ґ
+    { 14, 15, 12, 1, 15, 53, 2788 }, // ґ
+    { 15, 15, 14, 1, 15, 57, 2841 }, // Ғ
+    { 11, 11, 9, 0, 11, 31, 2898 }, // ғ
+    { 17, 17, 14, 1, 17, 73, 2929 }, // Ҕ
+    { 9, 11, 9, 0, 11, 25, 3002 }, // ҕ
+    { 25, 21, 27, -1, 18, 132, 3027 }, // Җ
+    { 17, 15, 18, -1, 13, 64, 3159 }, // җ
+    { 13, 19, 15, 2, 16, 62, 3223 }, // Ҙ
+    { 10, 16, 9, 0, 11, 40, 3285 }, // ҙ
+    { 18, 21, 18, -1, 18, 95, 3325 }, // Қ
+    { 12, 15, 13, -1, 13, 45, 3420 }, // қ
+    { 18, 16, 20, 2, 16, 72, 3465 }, // Ҝ
+    { 14, 11, 15, 1, 11, 39, 3537 }, // ҝ
+    { 17, 18, 18, 0, 18, 77, 3576 }, // Ҟ
+    { 12, 17, 16, 0, 17, 51, 3653 }, // ҟ
+    { 18, 18, 18, -1, 18, 81, 3704 }, // Ҡ
+    { 12, 13, 13, -1, 13, 39, 3785 }, // ҡ
+    { 19, 21, 19, -1, 18, 100, 3824 }, // Ң
+    { 13, 15, 13, -1, 13, 49, 3924 }, // ң
+    { 27, 19, 19, 0, 19, 129, 3973 }, // Ҥ
+    { 18, 12, 13, 0, 12, 54, 4102 }, // ҥ
+    { 22, 17, 25, 2, 17, 94, 4156 }, // Ҧ
+    { 19, 20, 22, 2, 14, 95, 4250 }, // ҧ
+    { 20, 18, 25, 3, 17, 90, 4345 }, // Ҩ
+    { 16, 15, 19, 2, 14, 60, 4435 }, // ҩ
+    { 18, 23, 18, 1, 19, 104, 4495 }, // Ҫ
+    { 11, 16, 14, 1, 13, 44, 4599 }, // ҫ
+    { 16, 21, 20, 3, 18, 84, 4643 }, // Ҭ
+    { 12, 14, 13, 1, 12, 42, 4727 }, // ҭ
+    { 15, 18, 19, 5, 18, 68, 4769 }, // Ү
+    { 12, 15, 14, 4, 11, 45, 4837 }, // ү
+    { 16, 18, 19, 4, 18, 72, 4882 }, // Ұ
+    { 16, 16, 14, 0, 11, 64, 4954 }, // ұ
+    { 21, 21, 21, -1, 18, 111, 5018 }, // Ҳ
+    { 14, 15, 14, -1, 13, 53, 5129 }, // ҳ
+    { 16, 19, 22, 5, 15, 76, 5182 }, // Ҵ
+    { 12, 14, 16, 3, 11, 42, 5258 }, // ҵ
+    { 14, 20, 17, 3, 15, 70, 5300 }, // Ҷ
+    { 10, 15, 12, 2, 11, 38, 5370 }, // ҷ
+    { 14, 15, 15, 4, 15, 53, 5408 }, // Ҹ
+    { 10, 11, 10, 2, 11, 28, 5461 }, // ҹ
+    { 13, 17, 16, 2, 17, 56, 5489 }, // Һ
+    { 14, 18, 16, 0, 18, 63, 5545 }, // һ
+    { 18, 16, 20, 1, 15, 72, 5608 }, // Ҽ
+    { 13, 12, 15, 0, 12, 39, 5680 }, // ҽ
+    { 17, 18, 23, 4, 15, 77, 5719 }, // Ҿ
+    { 13, 14, 16, 2, 12, 46, 5796 }, // ҿ
+    { 9, 18, 9, 0, 18, 41, 5842 }, // Ӏ
+    { 26, 26, 27, 0, 26, 169, 5883 }, // Ӂ
+    { 22, 23, 22, 0, 23, 127, 6052 }, // ӂ
+    { 15, 21, 16, 2, 16, 79, 6179 }, // Ӄ
+    { 10, 15, 11, 1, 11, 38, 6258 }, // ӄ
+    { 16, 19, 16, 2, 15, 76, 6296 }, // Ӆ
+    { 12, 14, 11, 0, 11, 42, 6372 }, // ӆ
+    { 20, 23, 19, 0, 18, 115, 6414 }, // Ӈ
+    { 13, 17, 13, 0, 13, 56, 6529 }, // ӈ
+    { 20, 24, 19, 0, 18, 120, 6585 }, // Ӊ
+    { 13, 17, 13, 0, 13, 56, 6705 }, // ӊ
+    { 13, 19, 14, 3, 15, 62, 6761 }, // Ӌ
+    { 9, 14, 10, 2, 11, 32, 6823 }, // ӌ
+    { 23, 24, 26, 0, 18, 138, 6855 }, // Ӎ
+    { 15, 17, 18, 0, 13, 64, 6993 }, // ӎ
+    { 6, 15, 6, 2, 15, 23, 7057 }, // ӏ
+    { 20, 26, 21, 0, 26, 130, 7080 }, // Ӑ
+    { 18, 20, 16, 0, 20, 90, 7210 }, // ӑ
+    { 20, 24, 21, 0, 24, 120, 7300 }, // Ӓ
+    { 18, 18, 16, 0, 18, 81, 7420 }, // ӓ
+    { 28, 19, 30, 0, 18, 133, 7501 }, // Ӕ
+    { 23, 13, 26, 0, 13, 75, 7634 }, // ӕ
+    { 15, 23, 13, 1, 23, 87, 7709 }, // Ӗ
+    { 15, 21, 16, 1, 21, 79, 7796 }, // ӗ
+    { 14, 13, 16, 1, 12, 46, 7875 }, // Ә
+    { 13, 14, 17, 7, 13, 46, 7921 }, // ә
+    { 17, 22, 16, 1, 21, 94, 7967 }, // Ӛ
+    { 14, 15, 17, 6, 13, 53, 8061 }, // ӛ
+    { 26, 24, 27, 0, 24, 156, 8114 }, // Ӝ
+    { 22, 21, 22, 0, 21, 116, 8270 }, // ӝ
+    { 15, 23, 15, 1, 22, 87, 8386 }, // Ӟ
+    { 15, 17, 9, 0, 17, 64, 8473 }, // ӟ
+    { 12, 15, 12, 2, 15, 45, 8537 }, // Ӡ
+    { 12, 15, 12, 1, 11, 45, 8582 }, // ӡ
+    { 19, 21, 20, 1, 21, 100, 8627 }, // Ӣ
+    { 15, 16, 14, 1, 16, 60, 8727 }, // ӣ
+    { 19, 22, 20, 1, 22, 105, 8787 }, // Ӥ
+    { 15, 17, 14, 1, 17, 64, 8892 }, // ӥ
+    { 21, 25, 21, 1, 24, 132, 8956 }, // Ӧ
+    { 14, 19, 17, 2, 18, 67, 9088 }, // ӧ
+    { 17, 16, 21, 2, 15, 68, 9155 }, // Ө
+    { 14, 12, 16, 1, 12, 42, 9223 }, // ө
+    { 17, 25, 21, 2, 24, 107, 9265 }, // Ӫ
+    { 15, 20, 16, 1, 20, 75, 9372 }, // ӫ
+    { 18, 23, 19, 1, 22, 104, 9447 }, // Ӭ
+    { 13, 18, 13, 2, 17, 59, 9551 }, // ӭ
+    { 16, 22, 14, -1, 21, 88, 9610 }, // Ӯ
+    { 16, 25, 16, 0, 19, 100, 9698 }, // ӯ
+    { 16, 23, 14, -1, 22, 92, 9798 }, // Ӱ
+    { 16, 26, 16, 0, 20, 104, 9890 }, // ӱ
+    { 18, 24, 14, -1, 23, 108, 9994 }, // Ӳ
+    { 19, 26, 16, 0, 20, 124, 10102 }, // ӳ
+    { 14, 22, 14, 3, 22, 77, 10226 }, // Ӵ
+    { 11, 17, 9, 2, 17, 47, 10303 }, // ӵ
+    { 15, 18, 14, 1, 15, 68, 10350 }, // Ӷ
+    { 11, 13, 9, 0, 11, 36, 10418 }, // ӷ
+    { 21, 24, 23, 2, 23, 126, 10454 }, // Ӹ
+    { 17, 20, 17, 2, 19, 85, 10580 }, // ӹ
+    { 21, 22, 21, 0, 18, 116, 10665 }, // Ӽ
+    { 14, 15, 14, 0, 13, 53, 10781 }, // ӽ
+    { 0, 0, 17, 0, 0, 0, 10834 }, //  
+    { 0, 0, 28, 0, 0, 0, 10834 }, //  
+    { 0, 0, 17, 0, 0, 0, 10834 }, //  
+    { 0, 0, 28, 0, 0, 0, 10834 }, //  
+    { 0, 0, 14, 0, 0, 0, 10834 }, //  
+    { 0, 0, 12, 0, 0, 0, 10834 }, //  
+    { 0, 0, 10, 0, 0, 0, 10834 }, //  
+    { 0, 0, 14, 0, 0, 0, 10834 }, //  
+    { 0, 0, 5, 0, 0, 0, 10834 }, //  
+    { 0, 0, 11, 0, 0, 0, 10834 }, //  
+    { 0, 0, 10, 0, 0, 0, 10834 }, //  
+    { 0, 0, 7, 0, 0, 0, 10834 }, // ​
+    { 0, 0, 0, 0, 0, 0, 10834 }, // ‌
+    { 0, 0, 0, 0, 0, 0, 10834 }, // ‍
+    { 0, 0, 0, 0, 0, 0, 10834 }, // ‎
+    { 0, 0, 0, 0, 0, 0, 10834 }, // ‏
+    { 10, 3, 11, 3, 8, 8, 10834 }, // ‐
+    { 10, 3, 11, 3, 8, 8, 10842 }, // ‑
+    { 16, 3, 16, 3, 8, 12, 10850 }, // ‒
+    { 14, 3, 17, 3, 8, 11, 9892 }, // –
+    { 21, 3, 23, 3, 8, 16, 9903 }, // —
+    { 21, 3, 23, 3, 8, 16, 10862 }, // ―
+    { 14, 18, 11, 0, 15, 63, 10878 }, // ‖
+    { 17, 8, 16, 0, -1, 34, 10941 }, // ‗
+    { 7, 6, 7, 4, 18, 11, 9919 }, // ‘
+    { 7, 6, 7, 4, 18, 11, 9930 }, // ’
+    { 7, 6, 7, 0, 3, 11, 10975 }, // ‚
+    { 7, 6, 7, 4, 18, 11, 10986 }, // ‛
+    { 12, 6, 12, 4, 18, 18, 9941 }, // “
+    { 12, 6, 12, 4, 18, 18, 9959 }, // ”
+    { 7, 6, 7, 0, 3, 11, 10997 }, // „
+    { 12, 6, 12, 4, 18, 18, 11008 }, // ‟
+    { 12, 27, 12, 3, 21, 81, 11026 }, // †
+    { 14, 27, 13, 1, 21, 95, 11107 }, // ‡
+    { 14, 12, 11, 0, 14, 42, 11202 }, // •
+    { 7, 7, 8, 2, 9, 13, 11244 }, // ‣
+    { 4, 4, 5, 1, 4, 4, 11257 }, // ․
+    { 4, 4, 5, 1, 4, 4, 11261 }, // ‥
+    { 19, 4, 20, 1, 4, 19, 9977 }, // …
+    { 4, 3, 5, 1, 8, 3, 11265 }, // ‧
+    { 0, 0, 26, 0, 0, 0, 11268 }, //  
+    { 17, 18, 23, 5, 16, 77, 11268 }, // ‰
+    { 7, 6, 7, 4, 18, 11, 11345 }, // ′
+    { 12, 6, 12, 4, 18, 18, 11356 }, // ″
+    { 15, 7, 18, -2, 18, 27, 11374 }, // ‴
+    { 4, 7, 7, 5, 18, 7, 11401 }, // ‵
+    { 9, 7, 11, 4, 18, 16, 11408 }, // ‶
+    { 15, 7, 18, 5, 18, 27, 11424 }, // ‷
+    { 9, 4, 12, 5, 17, 9, 11451 }, // ‸
+    { 7, 10, 9, 3, 11, 18, 11460 }, // ‹
+    { 8, 10, 9, -2, 11, 20, 11478 }, // ›
+    { 27, 21, 28, 1, 19, 142, 11498 }, // ※
+    { 11, 21, 7, 0, 21, 58, 11640 }, // ‼
+    { 14, 26, 16, 4, 25, 91, 11698 }, // ‽
+    { 11, 3, 11, 5, 17, 9, 11789 }, // ‾
+    { 10, 4, 13, 4, 14, 10, 11798 }, // ‿
+    { 15, 14, 17, 3, 19, 53, 11808 }, // ⁂
+    { 17, 17, 23, 5, 16, 73, 11861 }, // ⁄
+    { 25, 24, 26, 5, 24, 150, 11934 }, // ⁇
+    { 18, 23, 21, 5, 23, 104, 12084 }, // ⁈
+    { 21, 25, 17, 0, 23, 132, 12188 }, // ⁉
+    { 21, 33, 15, -1, 23, 174, 12320 }, // ⁒
+    { 0, 0, 100, 0, 0, 0, 12494 }, //  
+    { 8, 8, 7, 2, 17, 16, 12494 }, // ⁰
+    { 6, 9, 7, 3, 18, 14, 12510 }, // ⁴
+    { 8, 9, 7, 2, 18, 18, 12524 }, // ⁵
+    { 8, 8, 7, 2, 17, 16, 12542 }, // ⁶
+    { 6, 9, 7, 4, 18, 14, 12558 }, // ⁷
+    { 8, 8, 7, 2, 17, 16, 12572 }, // ⁸
+    { 8, 8, 7, 2, 17, 16, 12588 }, // ⁹
+    { 14, 12, 16, 0, 12, 42, 12604 }, // ⁿ
+    { 10, 11, 9, 1, 11, 28, 12646 }, // ₀
+    { 6, 9, 6, -1, 5, 14, 12674 }, // ₁
+    { 7, 9, 7, -1, 5, 16, 12688 }, // ₂
+    { 7, 9, 7, -1, 5, 16, 12704 }, // ₃
+    { 7, 8, 7, -1, 5, 14, 12720 }, // ₄
+    { 7, 8, 6, -1, 5, 14, 12734 }, // ₅
+    { 7, 8, 7, -1, 4, 14, 12748 }, // ₆
+    { 6, 9, 7, 1, 5, 14, 12762 }, // ₇
+    { 8, 9, 7, -1, 5, 18, 12776 }, // ₈
+    { 8, 9, 7, -1, 5, 18, 12794 }, // ₉
+    { 12, 29, 9, 2, 21, 87, 12812 }, // ₍
+    { 12, 29, 9, -5, 21, 87, 12899 }, // ₎
+    { 20, 28, 18, 0, 23, 140, 12986 }, // ₡
+    { 18, 20, 18, 1, 19, 90, 13126 }, // ₢
+    { 17, 20, 14, 0, 20, 85, 13216 }, // ₤
+    { 21, 18, 20, 0, 18, 95, 13301 }, // ₦
+    { 18, 18, 17, 0, 18, 81, 13396 }, // ₧
+    { 24, 18, 24, 0, 18, 108, 13477 }, // ₨
+    { 18, 18, 16, -1, 18, 81, 13585 }, // ₩
+    { 20, 16, 22, 3, 16, 80, 13666 }, // ₪
+    { 15, 17, 14, 2, 17, 64, 13746 }, // ₫
+    { 16, 19, 17, 2, 16, 76, 13810 }, // €
+    { 17, 18, 20, 4, 18, 77, 13886 }, // ₮
+    { 21, 18, 13, 0, 18, 95, 13963 }, // ₱
+    { 18, 25, 21, 1, 22, 113, 14058 }, // ₲
+    { 23, 19, 19, 2, 18, 110, 14171 }, // ₴
+    { 11, 16, 14, 1, 15, 44, 14281 }, // ₵
+    { 19, 19, 20, 4, 19, 91, 14325 }, // ₸
+    { 12, 17, 13, 3, 16, 51, 14416 }, // ₹
+    { 13, 15, 14, 2, 14, 49, 14467 }, // ₺
+    { 16, 16, 13, 1, 16, 64, 14516 }, // ₼
+    { 19, 18, 17, -2, 18, 86, 14580 }, // ₽
+    { 13, 13, 16, -2, 10, 43, 14666 }, // ←
+    { 14, 13, 16, 3, 13, 46, 14709 }, // ↑
+    { 13, 13, 16, 5, 10, 43, 14755 }, // →
+    { 14, 13, 16, 6, 13, 46, 14798 }, // ↓
+    { 22, 11, 19, -1, 10, 61, 14844 }, // ↔
+    { 11, 22, 14, 3, 20, 61, 0 }, // ↕
+    { 12, 9, 13, -2, 9, 27, 61 }, // ↖
+    { 13, 9, 13, 3, 9, 30, 88 }, // ↗
+    { 10, 13, 13, 5, 12, 33, 118 }, // ↘
+    { 11, 13, 13, -2, 12, 36, 151 }, // ↙
+    { 16, 13, 18, 0, 12, 52, 187 }, // ⇐
+    { 17, 15, 19, 3, 15, 64, 239 }, // ⇑
+    { 16, 13, 18, 2, 12, 52, 303 }, // ⇒
+    { 17, 16, 19, 7, 15, 68, 355 }, // ⇓
+    { 21, 13, 20, 0, 12, 69, 423 }, // ⇔
+    { 13, 20, 16, 5, 13, 65, 492 }, // ⇕
+    { 15, 17, 14, 2, 17, 64, 557 }, // ∂
+    { 22, 20, 21, 0, 19, 110, 621 }, // ∅
+    { 16, 16, 18, 1, 16, 64, 731 }, // ∆
+    { 15, 15, 15, 3, 15, 57, 795 }, // ∏
+    { 15, 15, 15, 7, 15, 57, 852 }, // ∐
+    { 14, 16, 12, 1, 15, 56, 909 }, // ∑
+    { 11, 3, 13, 2, 7, 9, 965 }, // −
+    { 21, 18, 19, 2, 17, 95, 974 }, // √
+    { 19, 11, 19, 2, 13, 53, 1069 }, // ∞
+    { 22, 24, 18, 0, 19, 132, 1122 }, // ∫
+    { 8, 13, 6, 0, 13, 26, 1254 }, // ∶
+    { 15, 11, 16, 4, 11, 42, 1280 }, // ≈
+    { 17, 18, 23, 5, 16, 77, 1322 }, // ≠
+    { 18, 16, 18, -1, 15, 72, 1399 }, // ≤
+    { 18, 16, 18, 1, 15, 72, 1471 }, // ≥
+    { 18, 17, 21, 2, 17, 77, 1543 }, // ﬀ
+    { 13, 19, 18, 2, 19, 62, 1620 }, // ﬁ
+    { 16, 17, 21, 2, 17, 68, 1682 }, // ﬂ
+    { 21, 19, 27, 2, 19, 100, 1750 }, // ﬃ
+    { 24, 17, 28, 2, 17, 102, 1850 }, // ﬄ
+    { 22, 16, 26, 1, 16, 88, 1952 }, // ﬆ
 };
 
 static const EpdUnicodeInterval opendyslexic_10_italicIntervals[] = {
@@ -2266,30 +2242,98 @@ static const EpdUnicodeInterval opendyslexic_10_italicIntervals[] = {
     { 0x2248, 0x2248, 0x2D1 },
     { 0x2260, 0x2260, 0x2D2 },
     { 0x2264, 0x2265, 0x2D3 },
+    { 0xFB00, 0xFB04, 0x2D5 },
+    { 0xFB06, 0xFB06, 0x2DA },
 };
 
 static const EpdFontGroup opendyslexic_10_italicGroups[] = {
-    { 0, 3344, 5736, 95, 0 },
-    { 3344, 3229, 7034, 96, 95 },
-    { 6573, 4969, 11376, 126, 191 },
-    { 11542, 538, 719, 61, 317 },
-    { 12080, 7816, 14953, 213, 378 },
-    { 19896, 1034, 1764, 63, 591 },
-    { 20930, 375, 492, 20, 654 },
-    { 21305, 1042, 1680, 20, 674 },
-    { 22347, 567, 796, 16, 694 },
-    { 22914, 603, 986, 15, 710 },
+    { 0, 4825, 9996, 151, 0 },
+    { 4825, 2396, 4146, 66, 379 },
+    { 7221, 6653, 14946, 233, 96 },
+    { 13874, 7918, 14905, 249, 377 },
+    { 21792, 1235, 2040, 32, 699 },
+};
+
+static const uint8_t opendyslexic_10_italicGlyphGroups[731] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 0,
+    0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 2, 2, 2, 0,
+    0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 1, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 3, 1, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 0, 0, 3, 3, 3, 0, 0, 3, 3, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+};
+
+static const EpdLigaturePair opendyslexic_10_italicLigatures[] = {
+    { 0x66, 0x66, 0xFB00 },
+    { 0x66, 0x69, 0xFB01 },
+    { 0x66, 0x6C, 0xFB02 },
+    { 0xFB00, 0x69, 0xFB03 },
+    { 0xFB00, 0x6C, 0xFB04 },
+};
+
+static const uint16_t opendyslexic_10_italicGlyphLookup[368] = {
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x005F, 0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E,
+    0x006F, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E,
+    0x007F, 0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E,
+    0x008F, 0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E,
+    0x009F, 0x00A0, 0x00A1, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE,
+    0x00AF, 0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE,
+    0x024F, 0x0250, 0x0251, 0x0252, 0x0253, 0x0254, 0x0255, 0x0256, 0x0257, 0x0258, 0x0259, 0x025A, 0x025B, 0x025C, 0x025D, 0x025E,
+    0x025F, 0x0260, 0x0261, 0x0262, 0x0263, 0x0264, 0x0265, 0x0266, 0x0267, 0x0268, 0x0269, 0x026A, 0x026B, 0x026C, 0x026D, 0x026E,
+    0x026F, 0x0270, 0x0271, 0x0272, 0x0273, 0x0274, 0x0275, 0x0276, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0277,
+    0x0278, 0xFFFF, 0x0279, 0x027A, 0x027B, 0x027C, 0x027D, 0x027E, 0x027F, 0x0280, 0x0281, 0x0282, 0x0283, 0x0284, 0x0285, 0x0286,
+    0xFFFF, 0xFFFF, 0x0287, 0xFFFF, 0x0288, 0xFFFF, 0xFFFF, 0x0289, 0x028A, 0x028B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x028C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x028D,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
 };
 
 static const EpdFontData opendyslexic_10_italic = {
     opendyslexic_10_italicBitmaps,
     opendyslexic_10_italicGlyphs,
     opendyslexic_10_italicIntervals,
-    56,
+    58,
     38,
     28,
     -11,
     true,
     opendyslexic_10_italicGroups,
-    10,
+    5,
+    nullptr,
+    nullptr,
+    nullptr,
+    0,
+    opendyslexic_10_italicLigatures,
+    5,
+    0x4000000001ull,
+    opendyslexic_10_italicGlyphLookup,
+    opendyslexic_10_italicGlyphGroups,
+    false,
+    nullptr,
 };
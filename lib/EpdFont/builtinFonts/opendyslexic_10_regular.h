@@ -3,1283 +3,1268 @@
  * name: opendyslexic_10_regular
  * size: 10
  * mode: 2-bit  compressed: true
- * Command used: fontconvert.py opendyslexic_10_regular 10 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Regular.otf --2bit --compress
+ * Command used: fontconvert.py opendyslexic_10_regular 10 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Regular.otf --2bit --compress --no-kerning --frequency-corpus ../../../test/hyphenation_eval/resources/english_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/french_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/german_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/italian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/russian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/spanish_hyphenation_tests.txt
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t opendyslexic_10_regularBitmaps[20331] = {
-    0x75, 0x58, 0x4F, 0x6C, 0x1C, 0x57, 0x19, 0xFF, 0xDE, 0xBC, 0xB8, 0x23, 0x3C, 0xA9, 0x5F, 0x0E,
-    0x89, 0xDA, 0x26, 0xC1, 0xC3, 0xA1, 0x87, 0x34, 0xB2, 0x3D, 0x3D, 0xE4, 0x60, 0xA1, 0xDD, 0x7D,
-    0xE3, 0xF6, 0xC0, 0xA1, 0xAA, 0xF0, 0xA1, 0x39, 0xB4, 0x08, 0x95, 0x03, 0x07, 0x40, 0x80, 0x83,
-    0xC8, 0xC1, 0x85, 0xB5, 0x77, 0x92, 0x1C, 0x7A, 0x08, 0xC2, 0x16, 0x08, 0x2E, 0x1C, 0x48, 0x25,
-    0x2A, 0xB5, 0x29, 0x52, 0x2C, 0x94, 0x83, 0x45, 0xC7, 0xDE, 0x97, 0xEC, 0x21, 0x87, 0x1C, 0x32,
-    0x89, 0x5B, 0x55, 0xA2, 0x1C, 0x06, 0x02, 0x6A, 0xD5, 0x4A, 0xE4, 0x35, 0x19, 0xD4, 0x89, 0x33,
-    0x3B, 0x8F, 0xDF, 0x37, 0xBB, 0x4E, 0x82, 0x10, 0x3B, 0xEF, 0xCD, 0x8E, 0x67, 0xDF, 0x9F, 0xEF,
-    0xEF, 0xEF, 0xFB, 0x3D, 0x53, 0xDC, 0x92, 0x66, 0xD4, 0xBA, 0xBE, 0xE9, 0x06, 0x26, 0x45, 0x53,
-    0x66, 0x1F, 0x89, 0x32, 0x1A, 0x54, 0xDA, 0x44, 0x6F, 0xDA, 0x61, 0x38, 0x28, 0x7A, 0xEA, 0x4A,
-    0xA1, 0xFD, 0xBC, 0x8A, 0x12, 0x92, 0x66, 0x86, 0x88, 0x5A, 0x9E, 0x21, 0x3C, 0xB6, 0xF0, 0xB8,
-    0x2C, 0xF1, 0xE8, 0x27, 0x2D, 0x12, 0x0E, 0x9F, 0x2A, 0xE2, 0x7B, 0x4C, 0x45, 0x90, 0x10, 0xA9,
-    0x78, 0x13, 0x03, 0xAC, 0x8A, 0x89, 0x42, 0x2A, 0x88, 0x04, 0x3F, 0x6A, 0x1E, 0xF0, 0x22, 0xDF,
-    0x2C, 0x69, 0x61, 0xB1, 0x4C, 0x1E, 0x61, 0x54, 0xC7, 0xC3, 0xA3, 0x9F, 0x75, 0x68, 0xEF, 0xE3,
-    0xEF, 0x27, 0xF2, 0x06, 0x31, 0x79, 0xAE, 0x26, 0xDF, 0xB9, 0x44, 0xBA, 0x1F, 0x2D, 0x7A, 0xBB,
-    0x78, 0x51, 0x9D, 0xCA, 0x48, 0x1F, 0x3D, 0x41, 0xC1, 0x83, 0x27, 0x89, 0xF0, 0x03, 0x05, 0x18,
-    0x41, 0x73, 0xAE, 0x20, 0x5F, 0xB9, 0x58, 0x0C, 0x7A, 0x39, 0x9D, 0xBA, 0x53, 0x61, 0x9B, 0x9A,
-    0x65, 0x09, 0xD1, 0x45, 0xDF, 0xDD, 0x27, 0xC2, 0x14, 0xF2, 0x9F, 0xDC, 0x5B, 0x5E, 0x40, 0xEA,
-    0x13, 0x41, 0x1E, 0x78, 0x67, 0x93, 0xEC, 0xF9, 0xFD, 0x2D, 0x49, 0xD7, 0xE8, 0xF9, 0xA3, 0xB9,
-    0xE7, 0xFE, 0x48, 0xC1, 0x27, 0x10, 0xFD, 0xCB, 0x82, 0xA6, 0xAF, 0x18, 0xF9, 0xE9, 0x24, 0xFD,
-    0x29, 0xBE, 0x30, 0x7D, 0x6C, 0x4A, 0x1A, 0x67, 0x96, 0x7D, 0x1B, 0x8C, 0x67, 0x7B, 0xD8, 0x56,
-    0xBD, 0x67, 0x69, 0x8E, 0x2E, 0x53, 0x1B, 0xAA, 0x45, 0x50, 0x44, 0x5D, 0xCF, 0x48, 0x3A, 0xE8,
-    0x53, 0x41, 0x73, 0x7C, 0x47, 0x6F, 0x9A, 0x67, 0xB4, 0x28, 0xDA, 0x3D, 0x6A, 0xA7, 0x3D, 0x52,
-    0xA5, 0x4E, 0x42, 0x0B, 0x89, 0x4A, 0x88, 0xFB, 0xB4, 0xE8, 0xE7, 0xCD, 0x3A, 0x7A, 0x6D, 0xC7,
-    0x56, 0x5A, 0x19, 0xBA, 0xE0, 0xC7, 0x2D, 0x91, 0x29, 0x9A, 0xF7, 0xF8, 0x26, 0xB2, 0x20, 0x6E,
-    0x91, 0x95, 0x46, 0x51, 0x8B, 0x2E, 0x7B, 0x99, 0x9F, 0xF0, 0x43, 0x21, 0x72, 0xBC, 0x89, 0x43,
-    0xEC, 0x98, 0x1E, 0xA3, 0xD3, 0x64, 0x45, 0x26, 0x4D, 0x10, 0x4F, 0xF1, 0x18, 0x91, 0x8F, 0xC6,
-    0x8C, 0xE6, 0x88, 0x3C, 0x48, 0x66, 0xC9, 0xFA, 0x66, 0x8E, 0x0A, 0xDF, 0x74, 0x60, 0xF7, 0x84,
-    0x0E, 0x40, 0x65, 0x21, 0xA5, 0xFA, 0xC5, 0xA6, 0x5F, 0x93, 0x2C, 0xE8, 0xFD, 0x6D, 0xF5, 0xF2,
-    0x0C, 0xC1, 0x26, 0x19, 0xD1, 0xB3, 0x44, 0x39, 0xC9, 0x84, 0xA6, 0xE8, 0xF8, 0xF6, 0x5B, 0xCE,
-    0x99, 0xE6, 0x91, 0xE6, 0xF9, 0x6D, 0xC4, 0x12, 0xAE, 0x6A, 0xB8, 0x10, 0x4E, 0xE8, 0x39, 0x7B,
-    0xB0, 0x9B, 0x0E, 0x1B, 0xD1, 0x27, 0x60, 0x51, 0xA2, 0x99, 0x66, 0xD8, 0x69, 0xA2, 0x0D, 0x38,
-    0x9A, 0xC7, 0x7B, 0x30, 0x82, 0xE1, 0xB5, 0xFC, 0x98, 0x60, 0x2D, 0x45, 0x34, 0x4D, 0x34, 0x8B,
-    0x88, 0x69, 0xDA, 0x66, 0x33, 0xCA, 0x92, 0xD8, 0x1B, 0xE8, 0x1B, 0x42, 0xA4, 0x20, 0x2C, 0x30,
-    0x70, 0x8E, 0xA0, 0x19, 0x4B, 0x84, 0xCD, 0xE8, 0x22, 0xC9, 0xB3, 0x66, 0x8A, 0x36, 0x20, 0x62,
-    0x8B, 0xE6, 0x5B, 0xCD, 0xA7, 0x8B, 0x76, 0xAC, 0xD5, 0xA2, 0x2E, 0x0C, 0xA0, 0x05, 0x42, 0xAD,
-    0x50, 0xCE, 0xFA, 0x2E, 0x13, 0x35, 0x0B, 0xD4, 0xA3, 0xD0, 0x8A, 0x35, 0x5E, 0x5D, 0x8D, 0x6E,
-    0xF0, 0x49, 0xB8, 0x77, 0xF3, 0xDD, 0xB0, 0xE7, 0x3E, 0x72, 0x43, 0xF1, 0x2E, 0x42, 0x46, 0xAE,
-    0xAF, 0x36, 0xD2, 0x14, 0x24, 0x33, 0x1E, 0x5C, 0x51, 0x90, 0x51, 0x1F, 0xD3, 0x3D, 0x47, 0x91,
-    0xC5, 0x80, 0x1D, 0xE7, 0x7E, 0xEF, 0xEA, 0xA0, 0xA6, 0x77, 0x97, 0x1A, 0x2D, 0xA0, 0xE8, 0x29,
-    0x48, 0x7B, 0x38, 0x25, 0x97, 0x91, 0x6F, 0x79, 0x1A, 0xA4, 0x9E, 0x3B, 0xE8, 0x15, 0xCE, 0x0D,
-    0xDC, 0xF0, 0x09, 0x44, 0x03, 0x47, 0x6C, 0xCC, 0x8A, 0x20, 0x47, 0x7E, 0x9E, 0xD0, 0xBD, 0x44,
-    0xEE, 0x98, 0xE0, 0x9C, 0x09, 0xA5, 0xE9, 0x3C, 0xF5, 0x41, 0xCF, 0x55, 0x5F, 0xBF, 0x54, 0x22,
-    0xBC, 0x79, 0x23, 0x6E, 0xF9, 0xA1, 0x93, 0x31, 0xB2, 0xC0, 0xF0, 0xEE, 0x2D, 0x96, 0x56, 0x7E,
-    0x16, 0x2B, 0x97, 0x1F, 0xF0, 0x9A, 0xB5, 0xB1, 0x4A, 0xFB, 0x39, 0xDF, 0xF2, 0xDA, 0x55, 0x50,
-    0xC7, 0x74, 0xF8, 0x82, 0x70, 0x36, 0x68, 0x7C, 0x02, 0x7B, 0xB7, 0x5E, 0x45, 0x0E, 0x65, 0xBD,
-    0x33, 0x76, 0x95, 0xBA, 0x2D, 0x82, 0x39, 0x5A, 0x6D, 0x6A, 0x45, 0x94, 0x2A, 0x57, 0xF8, 0x2E,
-    0x17, 0x48, 0x3E, 0x4E, 0xC5, 0x9B, 0xAF, 0x5D, 0x1A, 0x2F, 0x8D, 0x89, 0x1D, 0xD6, 0x15, 0xBB,
-    0x47, 0xAC, 0xAB, 0x84, 0x45, 0x12, 0x6A, 0x62, 0x20, 0x34, 0xA2, 0x1F, 0x07, 0x0B, 0x76, 0x8A,
-    0x4E, 0x7F, 0x95, 0xE6, 0x67, 0x69, 0x7E, 0x9A, 0x36, 0xD5, 0x19, 0x2B, 0x5D, 0x06, 0xAB, 0x86,
-    0x0B, 0x25, 0x16, 0xEE, 0x52, 0xBB, 0x4D, 0x6D, 0xBD, 0x50, 0x85, 0xAE, 0x40, 0xD4, 0x8B, 0x3A,
-    0x56, 0xBF, 0xCB, 0x66, 0x85, 0x45, 0x38, 0xCE, 0x53, 0xBA, 0x4C, 0xDD, 0x79, 0x96, 0xA2, 0x1B,
-    0x89, 0x4A, 0xB9, 0xCA, 0x73, 0xE9, 0xC8, 0xCD, 0xEA, 0xBD, 0x22, 0x74, 0x36, 0x74, 0xC9, 0xA4,
-    0x7F, 0xAB, 0xAC, 0xC7, 0x39, 0x73, 0xA6, 0xD8, 0xD6, 0xC9, 0x61, 0x35, 0xF8, 0x62, 0x14, 0x40,
-    0x14, 0xDC, 0x2E, 0x2A, 0x1D, 0xAE, 0x21, 0xFE, 0x68, 0x11, 0xE9, 0x02, 0x4B, 0x43, 0xC8, 0x21,
-    0xB1, 0x06, 0x7D, 0x98, 0x19, 0x80, 0xA1, 0xA0, 0x7C, 0xE0, 0xFE, 0x41, 0xB4, 0x04, 0x0B, 0x3F,
-    0x81, 0x9C, 0xA2, 0x99, 0x89, 0x1F, 0xFC, 0xDA, 0xD5, 0x0F, 0xB3, 0xB0, 0x3E, 0xFE, 0xF6, 0xE2,
-    0x41, 0x3C, 0x6D, 0xA1, 0xF7, 0xE1, 0x84, 0x08, 0x69, 0x15, 0x0C, 0xA9, 0x59, 0x03, 0x1E, 0xA5,
-    0xA5, 0x8A, 0xFA, 0x2E, 0xEE, 0xD7, 0xB1, 0x8F, 0x95, 0x9E, 0x19, 0xCF, 0xAA, 0xE3, 0xC8, 0xE5,
-    0x6D, 0xAF, 0x38, 0x40, 0xE9, 0x5E, 0x5C, 0xA2, 0xA5, 0x4D, 0x3C, 0xC0, 0x36, 0x86, 0x1C, 0x9B,
-    0xE9, 0x51, 0x5B, 0x6F, 0xA6, 0xBD, 0x42, 0x54, 0xEE, 0xBD, 0xA1, 0x89, 0x26, 0x1F, 0xB0, 0xD9,
-    0x7D, 0x4E, 0xFC, 0x18, 0xD1, 0xCF, 0xC1, 0xEF, 0x2F, 0x3C, 0x10, 0xA6, 0xB5, 0x7F, 0x46, 0x92,
-    0x5D, 0x3C, 0xB5, 0xDF, 0xBF, 0xBA, 0x60, 0x9E, 0x8F, 0x26, 0x03, 0xCF, 0xA4, 0xE1, 0x70, 0x56,
-    0x94, 0x87, 0x97, 0x72, 0x2C, 0x7F, 0x90, 0x02, 0x0C, 0x25, 0x75, 0x5F, 0xAC, 0x53, 0x38, 0x42,
-    0x2F, 0xC7, 0xF2, 0x7E, 0xBA, 0x87, 0x4B, 0xFC, 0x2B, 0x2B, 0xA8, 0x01, 0x50, 0x73, 0x6C, 0x83,
-    0x1F, 0x63, 0xAB, 0x6B, 0x86, 0xBC, 0x1C, 0x7F, 0x14, 0xF0, 0x20, 0x80, 0x1A, 0x0E, 0x2D, 0xB1,
-    0x6D, 0x44, 0x81, 0xF1, 0x33, 0xB9, 0x7B, 0xB1, 0x64, 0xEC, 0x85, 0xA6, 0x2E, 0xD3, 0x90, 0x0F,
-    0xDE, 0x65, 0x48, 0x09, 0x72, 0xBD, 0x1B, 0x4B, 0x80, 0x71, 0x9B, 0x56, 0x64, 0x26, 0xF2, 0x36,
-    0xA9, 0xD1, 0xD7, 0x0A, 0xBF, 0xD4, 0xAE, 0x94, 0x99, 0x57, 0xB4, 0x29, 0x18, 0x64, 0x9C, 0x50,
-    0xFE, 0x4E, 0x46, 0xC3, 0xCE, 0xC9, 0xFE, 0x00, 0x18, 0x0E, 0xEC, 0x94, 0x6E, 0x14, 0xD3, 0x74,
-    0xA4, 0xA6, 0xC8, 0x59, 0x75, 0xFF, 0x55, 0x09, 0xED, 0x91, 0x36, 0x58, 0x58, 0x40, 0x10, 0xC8,
-    0x01, 0x65, 0x48, 0x8F, 0xBF, 0x50, 0x17, 0x20, 0x73, 0xE4, 0x2E, 0x22, 0x68, 0x1D, 0x34, 0x62,
-    0xA0, 0x83, 0xD3, 0xD8, 0x72, 0x10, 0x02, 0x70, 0x88, 0x70, 0x73, 0x40, 0xE8, 0x42, 0xB0, 0x38,
-    0x3E, 0xD7, 0x81, 0x6D, 0x0E, 0x74, 0x53, 0x90, 0x67, 0x91, 0xF4, 0x5B, 0x78, 0x11, 0x9E, 0x83,
-    0xD3, 0xA1, 0xA4, 0x87, 0xB0, 0xF3, 0x86, 0xEA, 0x37, 0xEF, 0xB1, 0x10, 0x2E, 0x41, 0x37, 0x10,
-    0x28, 0x51, 0x8C, 0xE1, 0x34, 0x71, 0x12, 0xAB, 0x9F, 0x85, 0xA2, 0x69, 0x83, 0x17, 0x88, 0x6D,
-    0x0F, 0x5E, 0xD8, 0x7A, 0x0D, 0x2E, 0xCD, 0x90, 0x00, 0x2C, 0x0C, 0xE4, 0x44, 0xBC, 0x03, 0xF1,
-    0x60, 0x98, 0xF5, 0x91, 0x36, 0x0A, 0x6B, 0x4C, 0xF6, 0xF1, 0xF4, 0xB7, 0x82, 0x11, 0x27, 0x84,
-    0x11, 0x49, 0xEC, 0xBE, 0x1B, 0x70, 0xB9, 0xCA, 0x53, 0x88, 0x00, 0x43, 0xB2, 0x2E, 0x4D, 0x72,
-    0xA8, 0xF1, 0xE3, 0xE8, 0xF3, 0x84, 0x2B, 0xA1, 0x97, 0x8B, 0x39, 0xB2, 0x14, 0x42, 0x35, 0xC0,
-    0x37, 0x32, 0x67, 0x34, 0x40, 0x53, 0x63, 0x10, 0x9E, 0x55, 0xAF, 0x57, 0x14, 0xD5, 0x78, 0x11,
-    0x9D, 0xCF, 0x29, 0x58, 0x80, 0xBE, 0x99, 0x6E, 0xC0, 0x1E, 0xAA, 0xC3, 0x31, 0xB1, 0xD7, 0xBF,
-    0xCF, 0x90, 0xB9, 0x08, 0xC3, 0x95, 0x8F, 0xF5, 0x6A, 0xAF, 0xEB, 0xC7, 0xFB, 0x48, 0xEA, 0x47,
-    0x3D, 0x16, 0x7B, 0x7D, 0xA8, 0x13, 0x31, 0x3C, 0xAE, 0x06, 0xB6, 0x8A, 0x82, 0xAB, 0x36, 0x1D,
-    0xDD, 0xD4, 0x4E, 0x31, 0xD4, 0x6B, 0x5C, 0x51, 0x64, 0x2E, 0x4A, 0x78, 0x29, 0x4C, 0xFC, 0x1C,
-    0x5E, 0x5A, 0xA1, 0x30, 0xF6, 0xE1, 0x64, 0xC4, 0x36, 0x87, 0x0A, 0xD4, 0xE4, 0x07, 0x65, 0xA4,
-    0x95, 0xA5, 0x1E, 0x2A, 0xD8, 0x97, 0xDE, 0xC6, 0x7B, 0x4D, 0x11, 0x8F, 0x09, 0x13, 0x99, 0x57,
-    0xA4, 0xCE, 0x67, 0xD4, 0x81, 0x10, 0xBB, 0x48, 0x06, 0x2E, 0x72, 0x50, 0x13, 0x05, 0x55, 0x38,
-    0x40, 0x35, 0x7A, 0xD4, 0x33, 0x94, 0xF6, 0xB0, 0x40, 0xDF, 0x28, 0x54, 0x44, 0x4D, 0xCE, 0x54,
-    0xF8, 0x6D, 0x92, 0x0B, 0xFC, 0x7F, 0xB5, 0xE8, 0x7F, 0x9A, 0x1E, 0xB5, 0x43, 0xAF, 0x41, 0xA3,
-    0x51, 0x9B, 0x5C, 0xA7, 0xC9, 0x75, 0x84, 0xB9, 0x4E, 0x60, 0x9E, 0x1A, 0x55, 0x49, 0x95, 0x61,
-    0x45, 0x3D, 0xDB, 0x2B, 0xA5, 0xBB, 0xF2, 0xC0, 0x2A, 0xE7, 0xDF, 0xC8, 0xB6, 0xAA, 0x28, 0x1A,
-    0xDC, 0xB3, 0x69, 0x2F, 0x5C, 0xBB, 0x6A, 0xEB, 0xA1, 0x0E, 0x6E, 0x3A, 0x3B, 0xD4, 0x2F, 0xBA,
-    0x73, 0xC5, 0x30, 0xA8, 0xC2, 0x9D, 0x22, 0xB4, 0xBD, 0xB5, 0x5C, 0x2F, 0xD4, 0x3A, 0xF9, 0x5E,
-    0xC0, 0x40, 0x13, 0x71, 0xFA, 0x3C, 0x07, 0x88, 0x6D, 0x2B, 0x4B, 0x2B, 0x0A, 0x36, 0x80, 0x06,
-    0x5D, 0x35, 0x04, 0x3C, 0xF6, 0xD1, 0x2F, 0xC5, 0x69, 0xB8, 0x96, 0x54, 0xE1, 0x79, 0x53, 0x85,
-    0xE7, 0xC0, 0x67, 0xCE, 0xC2, 0x8E, 0x49, 0x89, 0xBE, 0x55, 0xE9, 0x44, 0x97, 0x4D, 0x37, 0x21,
-    0xBA, 0x2A, 0x11, 0xF9, 0x4C, 0x56, 0x2A, 0x88, 0xA7, 0x8D, 0x4E, 0x64, 0xC9, 0x69, 0x85, 0x85,
-    0xFD, 0x1D, 0x8E, 0x31, 0x04, 0x99, 0x46, 0xDC, 0x06, 0x37, 0x40, 0x50, 0xEE, 0xC1, 0xF2, 0x25,
-    0xEC, 0xD4, 0x01, 0xF4, 0xEB, 0x6F, 0xD4, 0xBF, 0xED, 0x1B, 0x26, 0x37, 0x48, 0x6E, 0x2B, 0x38,
-    0xE6, 0x9F, 0x70, 0x23, 0x00, 0x09, 0xDD, 0x3A, 0x4A, 0x28, 0x4A, 0x91, 0xED, 0x32, 0x5E, 0xAB,
-    0x97, 0x8C, 0xBC, 0x8A, 0x3F, 0xFA, 0xAE, 0x8C, 0x5C, 0xA9, 0x3E, 0x5B, 0xE4, 0xD8, 0xAD, 0x1A,
-    0x23, 0x21, 0xA4, 0xF8, 0x0F, 0xE0, 0x18, 0xEA, 0x2E, 0x07, 0x1D, 0x85, 0x88, 0xFD, 0x1E, 0xF0,
-    0xA6, 0x07, 0x50, 0x5B, 0x45, 0x96, 0x60, 0x50, 0x1A, 0xE2, 0xB7, 0xF3, 0xC0, 0x85, 0x7B, 0x18,
-    0x9A, 0x42, 0x9E, 0x10, 0x51, 0xEF, 0xDF, 0x18, 0xBF, 0xA8, 0xB6, 0xE8, 0x3B, 0x9D, 0x10, 0x21,
-    0xC8, 0x4C, 0xCB, 0xF4, 0xD0, 0x11, 0x89, 0x28, 0x00, 0xD0, 0x07, 0xB0, 0x89, 0x90, 0x8D, 0xF8,
-    0xE1, 0x62, 0xAC, 0xEA, 0x04, 0xF5, 0x0E, 0x1C, 0x22, 0xA5, 0x5C, 0x66, 0x53, 0x34, 0x27, 0x72,
-    0x91, 0x4F, 0x53, 0x47, 0xE4, 0x61, 0x16, 0xBA, 0x92, 0xC9, 0x17, 0xA4, 0xF3, 0x8A, 0x20, 0x8B,
-    0xE2, 0x8E, 0x2C, 0x3C, 0xAB, 0x63, 0xFD, 0x62, 0x21, 0xD9, 0x52, 0x83, 0x12, 0x4C, 0xE7, 0x08,
-    0x94, 0xD3, 0x50, 0x32, 0xDA, 0x7D, 0xA7, 0x91, 0x14, 0x49, 0x3D, 0x82, 0x30, 0x26, 0x72, 0x41,
-    0x0D, 0xCD, 0xFB, 0x0D, 0x74, 0x33, 0x26, 0x03, 0xD4, 0xC9, 0xAF, 0x1A, 0x70, 0x5E, 0x44, 0x21,
-    0x85, 0x50, 0x16, 0x51, 0x50, 0x70, 0xF7, 0xDC, 0xD8, 0x48, 0x87, 0x4E, 0x9E, 0x7C, 0x05, 0x2F,
-    0x86, 0xDC, 0x0F, 0xC8, 0xF1, 0x82, 0x0F, 0x7B, 0x3E, 0xEA, 0xFE, 0xFF, 0xE9, 0x8C, 0xAC, 0xE3,
-    0x7E, 0x9C, 0xC4, 0x3B, 0x43, 0x0A, 0xEE, 0xA1, 0xC6, 0xC1, 0x24, 0x3D, 0x4D, 0xA2, 0xAA, 0xC8,
-    0xBF, 0x0D, 0x78, 0x5F, 0x33, 0xB4, 0x0A, 0xF3, 0x95, 0x29, 0xC9, 0xBF, 0xDB, 0xC6, 0x82, 0x2B,
-    0x51, 0xEC, 0x15, 0x28, 0xFF, 0x37, 0x5D, 0x83, 0x7B, 0x15, 0x5B, 0xCA, 0x77, 0xA3, 0x22, 0xF5,
-    0x1C, 0x10, 0xE0, 0x2C, 0xDB, 0x13, 0xD6, 0x0E, 0x63, 0xC6, 0x87, 0x06, 0x29, 0x56, 0x51, 0xC5,
-    0xE1, 0x22, 0x04, 0x47, 0x8C, 0x1A, 0x5A, 0x02, 0x10, 0x14, 0x92, 0x81, 0x86, 0xD8, 0x39, 0xC8,
-    0xD9, 0x6F, 0xA8, 0x22, 0x92, 0x6D, 0x1D, 0xA1, 0x10, 0xA1, 0x78, 0x8F, 0x18, 0x21, 0x81, 0xF5,
-    0x35, 0x04, 0x17, 0x9B, 0x43, 0xE2, 0x5B, 0x6C, 0xA7, 0xC8, 0x67, 0xFF, 0x56, 0x80, 0x2B, 0xA8,
-    0x86, 0x4C, 0xC4, 0x2E, 0x29, 0x3C, 0x5F, 0x89, 0x22, 0xA8, 0x90, 0xA7, 0xB9, 0x2E, 0xC2, 0x44,
-    0x5D, 0x75, 0x76, 0x0B, 0x98, 0xFE, 0x31, 0x42, 0x6F, 0xAB, 0x0F, 0x85, 0xC4, 0x83, 0x52, 0x6F,
-    0x63, 0x03, 0xD3, 0xC7, 0xC6, 0x8E, 0x93, 0x53, 0x17, 0x4C, 0x3D, 0xFB, 0x26, 0x28, 0x09, 0x6C,
-    0x08, 0x9E, 0x98, 0x04, 0x6D, 0x68, 0x6A, 0x53, 0x07, 0x20, 0x29, 0x33, 0xA0, 0x5E, 0xCA, 0x80,
-    0x3B, 0x00, 0xF7, 0xDA, 0x65, 0xC4, 0x2E, 0x47, 0x44, 0xB5, 0x29, 0x35, 0xEC, 0x98, 0x1E, 0x87,
-    0xDE, 0x12, 0x16, 0x1A, 0x30, 0x2D, 0x00, 0x5F, 0xCD, 0x95, 0x45, 0x0A, 0xD5, 0xA8, 0xC9, 0x11,
-    0xB3, 0x72, 0x0E, 0xB7, 0x42, 0x01, 0x43, 0xFC, 0x0C, 0x25, 0xC7, 0x2A, 0x68, 0x8D, 0x84, 0x60,
-    0xB8, 0xDA, 0xDE, 0xC6, 0x4C, 0x56, 0x15, 0x4B, 0x2A, 0x3B, 0x42, 0x48, 0xEE, 0x6A, 0xDC, 0xC3,
-    0x71, 0x07, 0x82, 0xCA, 0x71, 0x99, 0x32, 0x9C, 0x1C, 0xA3, 0x60, 0x90, 0x7B, 0x7D, 0x38, 0xEE,
-    0xF5, 0xB8, 0xBB, 0xC7, 0x7B, 0x8C, 0xFE, 0x21, 0x53, 0xA6, 0x06, 0x10, 0x19, 0xCF, 0x01, 0xF7,
-    0x15, 0x2E, 0xE2, 0x2B, 0x7C, 0x78, 0x45, 0x28, 0x0A, 0xA3, 0xAB, 0x03, 0x2E, 0xB9, 0x77, 0xB5,
-    0xC6, 0x57, 0x97, 0x7A, 0x45, 0xCF, 0x1E, 0x5A, 0x3C, 0x40, 0x5F, 0x03, 0x9F, 0x3B, 0x81, 0x37,
-    0x33, 0xE0, 0x54, 0x0A, 0x0C, 0xCF, 0x4F, 0xA4, 0xF1, 0x50, 0x1C, 0x51, 0xC6, 0x0B, 0x0C, 0x03,
-    0xE3, 0xC4, 0x10, 0x86, 0x22, 0x2B, 0x9A, 0x8B, 0xF6, 0xAE, 0xE2, 0xE1, 0x55, 0x82, 0xCC, 0x8E,
-    0xAE, 0x14, 0x33, 0xF6, 0xAE, 0x56, 0x54, 0x85, 0xD5, 0x04, 0xB8, 0x02, 0x56, 0xD0, 0x71, 0xEB,
-    0xF4, 0xBC, 0x44, 0xA5, 0x75, 0x9F, 0xB0, 0xDE, 0x7C, 0x56, 0xC2, 0x88, 0x95, 0x51, 0x5D, 0xE9,
-    0xBF, 0x82, 0xF8, 0x08, 0x92, 0x6A, 0x8A, 0xBA, 0x47, 0xA9, 0x35, 0xC3, 0x3C, 0xAE, 0xDD, 0x42,
-    0x28, 0xBE, 0x50, 0xA3, 0x58, 0x06, 0xEE, 0x5F, 0x62, 0xFB, 0x9B, 0xEF, 0x34, 0xA4, 0xE4, 0x61,
-    0xEB, 0xA2, 0x3D, 0x43, 0xAB, 0x48, 0x9C, 0x7F, 0x16, 0x9A, 0x5A, 0x1D, 0x9A, 0xED, 0xD0, 0x74,
-    0x9B, 0xA6, 0x3B, 0x0D, 0x3D, 0x43, 0x3D, 0x0F, 0x99, 0x0C, 0x8F, 0xAA, 0x36, 0x2D, 0xE5, 0xA1,
-    0x43, 0xAA, 0xA4, 0x14, 0xC0, 0x6D, 0xCC, 0x50, 0x36, 0x99, 0x77, 0xEA, 0xBF, 0x08, 0xCE, 0xE9,
-    0x66, 0x0C, 0x7E, 0x00, 0x05, 0xC7, 0xF9, 0x85, 0x39, 0x65, 0xC0, 0xA7, 0xB9, 0xA0, 0xB4, 0x81,
-    0x4B, 0x83, 0x33, 0x0E, 0x67, 0x88, 0x2B, 0xF0, 0xF1, 0x06, 0xA5, 0xB3, 0x80, 0xBC, 0x44, 0x5D,
-    0x19, 0x2E, 0x21, 0x53, 0x2B, 0xA0, 0x17, 0x45, 0xB7, 0x0D, 0x4F, 0x3E, 0x08, 0x10, 0x89, 0xD5,
-    0x42, 0x36, 0x43, 0xA7, 0x96, 0x27, 0x36, 0xFB, 0xAE, 0xFA, 0xF3, 0xDB, 0xB1, 0x6D, 0xE8, 0xFD,
-    0x2A, 0xC7, 0x3C, 0x78, 0x79, 0xC1, 0xE9, 0xFE, 0xDD, 0x30, 0xB7, 0x32, 0x99, 0xA2, 0x79, 0xE5,
-    0xEE, 0xB8, 0xE6, 0x78, 0xE2, 0x9B, 0x90, 0xBA, 0xA2, 0xF9, 0xF2, 0xCA, 0xD3, 0x3D, 0x77, 0xFB,
-    0xA6, 0xFB, 0x36, 0x0D, 0x37, 0xBC, 0x2F, 0x8D, 0xFF, 0x31, 0x85, 0x3F, 0xA4, 0xAD, 0x37, 0xBE,
-    0x05, 0x0A, 0x71, 0x05, 0x3B, 0x6D, 0xB7, 0x50, 0x97, 0xE3, 0xE8, 0x9C, 0x03, 0xF3, 0xCC, 0x8E,
-    0xDC, 0xE7, 0x33, 0xC4, 0x06, 0x79, 0x8F, 0x31, 0xE6, 0x1B, 0xD8, 0xA5, 0xD4, 0xBF, 0xB2, 0xA5,
-    0xF7, 0x91, 0xF1, 0x5F, 0xA7, 0xE9, 0x2E, 0xFD, 0xCC, 0x8A, 0xCF, 0x8D, 0x7F, 0x89, 0xA2, 0x94,
-    0xFA, 0x56, 0x5A, 0x9C, 0x54, 0xE0, 0x88, 0x03, 0xF3, 0xFC, 0x59, 0x5E, 0xEE, 0x76, 0xD3, 0x14,
-    0xB1, 0xD0, 0x81, 0x84, 0x87, 0x1A, 0x13, 0x1D, 0x7B, 0x18, 0x17, 0x8F, 0xAE, 0xF9, 0xE6, 0xDA,
-    0x14, 0x85, 0xB6, 0x4C, 0x27, 0x9F, 0x6E, 0x36, 0x7A, 0xB4, 0xA7, 0x7F, 0x35, 0x0B, 0x23, 0x7A,
-    0x03, 0xB8, 0x1E, 0xFB, 0x25, 0xD7, 0x9A, 0xBE, 0xF5, 0x6E, 0xDB, 0xE0, 0x9A, 0x8D, 0x82, 0xA2,
-    0x52, 0xC5, 0x14, 0x9F, 0xBC, 0xFC, 0x64, 0x8E, 0x8F, 0x6C, 0x0A, 0x3C, 0xA7, 0x90, 0xF8, 0xE2,
-    0x33, 0xD9, 0x07, 0xAA, 0xD2, 0xF6, 0xE9, 0x28, 0xD9, 0xA6, 0xF7, 0xDD, 0x0D, 0xE7, 0x55, 0xAA,
-    0x9C, 0x55, 0x26, 0x4C, 0xE6, 0x39, 0x48, 0x6D, 0x81, 0x01, 0x03, 0x9C, 0xE4, 0x14, 0x07, 0x30,
-    0xF8, 0xF6, 0xA6, 0xB8, 0x8B, 0xBC, 0xF7, 0xAF, 0xF3, 0x51, 0x4F, 0xF3, 0x59, 0xEF, 0xD9, 0xEF,
-    0xF3, 0x99, 0xA5, 0x98, 0xC3, 0x5A, 0x5D, 0xFA, 0xC2, 0xCA, 0x8F, 0x8C, 0x5A, 0xC2, 0x99, 0x92,
-    0x76, 0xAD, 0xFC, 0xDC, 0xA0, 0xAC, 0x75, 0x3C, 0x64, 0xBC, 0xCB, 0xDA, 0xC2, 0x2E, 0xD3, 0xF2,
-    0x65, 0x6A, 0xA1, 0x15, 0xD4, 0xDA, 0xA4, 0xEE, 0x8A, 0x28, 0x35, 0xB8, 0x9B, 0xCB, 0x30, 0x60,
-    0xDF, 0x91, 0x75, 0xFF, 0x52, 0x2D, 0x9C, 0x07, 0x9C, 0x9A, 0x57, 0x09, 0xA8, 0xA0, 0x67, 0x4A,
-    0xDA, 0x40, 0x20, 0xA9, 0x3C, 0x84, 0x67, 0x5F, 0x40, 0x56, 0x96, 0x2E, 0x69, 0xF3, 0xA9, 0x9D,
-    0x39, 0x92, 0x67, 0x1F, 0x71, 0x20, 0xA6, 0x81, 0xB7, 0x12, 0x75, 0xA7, 0x0B, 0x4E, 0x63, 0x96,
-    0xA9, 0x0A, 0x62, 0x65, 0x36, 0x88, 0x93, 0x2F, 0xD9, 0x10, 0xA5, 0x6F, 0x7A, 0x09, 0x97, 0x00,
-    0xF7, 0x20, 0xF6, 0x86, 0xA7, 0x9B, 0x63, 0x10, 0xBD, 0x8F, 0x33, 0x0E, 0x66, 0xDF, 0x6F, 0x62,
-    0x65, 0x5F, 0x7B, 0xA8, 0x87, 0x1A, 0x40, 0x34, 0xCA, 0x49, 0xF6, 0xC0, 0x36, 0xEA, 0x98, 0xE7,
-    0xCE, 0xEC, 0xFE, 0xA1, 0xC5, 0xE6, 0x05, 0xF5, 0x77, 0xEB, 0xA2, 0x0F, 0x60, 0xDE, 0x27, 0xEF,
-    0xBA, 0xBA, 0xEF, 0x6E, 0x31, 0xE7, 0xC7, 0xA9, 0xB2, 0x05, 0xCB, 0x3F, 0xF5, 0x21, 0x38, 0x1A,
-    0x3F, 0xF8, 0x06, 0x79, 0xD8, 0x85, 0x8D, 0xC0, 0x64, 0x5C, 0xD2, 0x2F, 0xC2, 0xDA, 0xD2, 0xDD,
-    0x4C, 0x5E, 0x8F, 0xD5, 0x2C, 0x6B, 0xFB, 0x45, 0x2E, 0xAF, 0x25, 0xEA, 0x75, 0xDA, 0xD2, 0x97,
-    0x70, 0x2A, 0xBB, 0x05, 0x8D, 0xEA, 0xF6, 0x22, 0x89, 0x69, 0x92, 0x03, 0x23, 0xF2, 0x4D, 0x80,
-    0x17, 0x75, 0x3D, 0xB0, 0xDF, 0x36, 0xF2, 0xFD, 0x7A, 0x2C, 0x1E, 0x00, 0xEA, 0x40, 0xD4, 0x4A,
-    0x50, 0x4D, 0xA6, 0xF6, 0x07, 0xF9, 0x28, 0xC0, 0x19, 0x06, 0x03, 0x6C, 0x76, 0x7C, 0x53, 0x44,
-    0x2A, 0xB7, 0xA1, 0xFE, 0x37, 0xAC, 0xE7, 0x72, 0xF4, 0x2C, 0xA8, 0xFA, 0x06, 0x65, 0x0F, 0xD4,
-    0x07, 0x78, 0x1C, 0xE3, 0x48, 0x1D, 0x01, 0xE4, 0x49, 0xDE, 0x89, 0xA9, 0x97, 0x70, 0xC1, 0x46,
-    0x3C, 0xF8, 0x2E, 0x96, 0xF7, 0x10, 0x77, 0xAB, 0x28, 0x97, 0x37, 0x4B, 0xAA, 0x2E, 0x37, 0x87,
-    0xB3, 0x39, 0x5A, 0x56, 0xFC, 0xEF, 0x90, 0xC2, 0xBF, 0x69, 0xE5, 0x5D, 0x2B, 0xBE, 0xCC, 0xF9,
-    0x10, 0x09, 0x1E, 0x05, 0xE6, 0x03, 0xC2, 0x00, 0xDD, 0x35, 0x43, 0x36, 0x10, 0x14, 0xF2, 0x1C,
-    0xE7, 0x42, 0xC1, 0x4E, 0x23, 0xAE, 0x49, 0x7C, 0x43, 0x98, 0x25, 0x7C, 0x33, 0xA2, 0xBE, 0xF8,
-    0x92, 0x73, 0x11, 0xEA, 0xD2, 0x44, 0x1C, 0xA0, 0x3C, 0x00, 0xE3, 0x3C, 0x2E, 0x27, 0x40, 0xF5,
-    0x36, 0x1D, 0x31, 0xA8, 0x7F, 0xBD, 0x18, 0xF9, 0x0E, 0x73, 0x36, 0x36, 0xED, 0xF2, 0x0F, 0xDA,
-    0xF2, 0x59, 0x86, 0x9E, 0xBD, 0xFD, 0xCB, 0xF9, 0x9D, 0x97, 0x4F, 0xA0, 0x0D, 0x8E, 0xFE, 0xC4,
-    0x1C, 0x62, 0x9C, 0xF5, 0x9A, 0x53, 0x72, 0x83, 0x0C, 0x05, 0xB3, 0xE8, 0x15, 0xD0, 0x4B, 0x6C,
-    0xE2, 0xF3, 0xC4, 0xBD, 0x5B, 0x2A, 0x5C, 0xC2, 0xC0, 0x4D, 0xED, 0x89, 0x9F, 0x7E, 0xE5, 0xAD,
-    0xBF, 0x5E, 0x80, 0x89, 0xFE, 0x03, 0xB5, 0x58, 0x4F, 0x68, 0x1C, 0xD7, 0x19, 0xFF, 0xDE, 0x3C,
-    0x49, 0x93, 0x7A, 0x22, 0x3D, 0x1F, 0xA4, 0x92, 0xB8, 0x92, 0xC6, 0x6D, 0x0D, 0x75, 0xCD, 0x4A,
-    0x9B, 0x83, 0x0F, 0x7B, 0x98, 0xD5, 0x8C, 0x25, 0xA8, 0x03, 0x26, 0x58, 0xA5, 0x4A, 0xA0, 0xBD,
-    0x34, 0x85, 0x14, 0x42, 0x7B, 0xF0, 0x16, 0x74, 0x10, 0x65, 0xA5, 0x1D, 0x4B, 0xA5, 0x39, 0x18,
-    0x6A, 0x5D, 0x72, 0xAE, 0x0A, 0x0E, 0x24, 0xEA, 0x41, 0x4B, 0x11, 0x45, 0xD4, 0x2B, 0xEF, 0xC8,
-    0xA2, 0x98, 0x92, 0x83, 0xC7, 0x0E, 0x21, 0x90, 0x14, 0x3A, 0xC4, 0xA5, 0x34, 0x2D, 0xC4, 0xD3,
-    0x64, 0x9A, 0x8E, 0x93, 0xD9, 0x7D, 0xFD, 0x7D, 0x33, 0x2B, 0x59, 0x49, 0x1C, 0x90, 0x9B, 0xFA,
-    0x31, 0xF3, 0x76, 0x76, 0x66, 0xDE, 0xF7, 0xFF, 0xFB, 0x7D, 0xDF, 0x1B, 0x92, 0x99, 0x7B, 0x3D,
-    0xB5, 0x7D, 0x12, 0x7E, 0x66, 0x05, 0x2D, 0x2B, 0xA8, 0x9B, 0x7C, 0x38, 0xB2, 0x77, 0xF4, 0x51,
-    0x8D, 0x4C, 0xCA, 0xA7, 0x81, 0xAE, 0xA1, 0xE3, 0xA9, 0xA6, 0xF5, 0x3A, 0x6D, 0x36, 0xD5, 0x39,
-    0x4A, 0x9A, 0xD6, 0x25, 0xDA, 0x6E, 0x4A, 0xBD, 0x66, 0x6B, 0xBF, 0x9C, 0x52, 0x44, 0x43, 0x74,
-    0x60, 0x94, 0x23, 0x2A, 0xEB, 0xD0, 0x0A, 0x2D, 0xDA, 0x24, 0xB2, 0x70, 0x63, 0x9E, 0x48, 0x06,
-    0x44, 0x25, 0x22, 0x11, 0x11, 0x29, 0x1C, 0x3A, 0x23, 0xAD, 0x03, 0xAA, 0xE3, 0x79, 0x40, 0x46,
-    0x42, 0xB2, 0x43, 0xE4, 0xEA, 0xEE, 0x8C, 0xC6, 0x03, 0xA2, 0xF1, 0xE1, 0xA6, 0xAD, 0x13, 0x6B,
-    0x39, 0x52, 0x14, 0xF3, 0xB1, 0x1C, 0x2B, 0x1D, 0xBB, 0x3A, 0x2B, 0x0D, 0x57, 0xF0, 0x74, 0x98,
-    0xC4, 0x74, 0x44, 0x5B, 0xCA, 0x2F, 0xD3, 0x92, 0x15, 0x18, 0x1F, 0x25, 0xA4, 0xBA, 0x58, 0x9D,
-    0xD3, 0x11, 0x6D, 0x10, 0xFE, 0xD8, 0xA7, 0x32, 0x91, 0x11, 0x13, 0xFF, 0xB4, 0x75, 0xD0, 0xDF,
-    0x78, 0x75, 0xEF, 0x1F, 0xC6, 0x89, 0x3B, 0xBF, 0xAA, 0xDC, 0xF6, 0xC8, 0x78, 0xE6, 0xF4, 0xEE,
-    0xE8, 0xCF, 0x02, 0xBE, 0xA3, 0x43, 0xB9, 0x3A, 0x2F, 0x89, 0x95, 0x95, 0x11, 0x19, 0xDA, 0x57,
-    0x3A, 0xB1, 0x3D, 0xA7, 0x44, 0xA5, 0x49, 0x72, 0x20, 0xAA, 0xA1, 0x13, 0xB2, 0x62, 0x32, 0xD2,
-    0x3E, 0x23, 0x2D, 0xEB, 0xA4, 0xA1, 0xA3, 0x53, 0xEF, 0x51, 0xDD, 0xBA, 0x14, 0x64, 0x1D, 0xF5,
-    0x47, 0x6F, 0x6E, 0xE0, 0x4A, 0xFF, 0x8F, 0x97, 0x8F, 0x8F, 0xCC, 0x89, 0xAF, 0x8A, 0xA7, 0xB7,
-    0x7C, 0x7F, 0xF5, 0x88, 0x4F, 0x34, 0x35, 0x33, 0xF4, 0xC4, 0x13, 0xB3, 0x3F, 0x5A, 0xD9, 0xD5,
-    0xC6, 0x2F, 0xE8, 0x78, 0x9F, 0x11, 0x44, 0x55, 0xDB, 0xDC, 0x89, 0x9D, 0x71, 0x4A, 0x17, 0x29,
-    0xDB, 0xA6, 0x74, 0x9B, 0xA2, 0x1A, 0x91, 0xD7, 0x78, 0xED, 0x0C, 0xDB, 0xC1, 0x26, 0x72, 0x88,
-    0xE2, 0xDC, 0x4A, 0xA6, 0xD6, 0x0D, 0x1D, 0x83, 0xE8, 0x77, 0x97, 0xBF, 0x31, 0x72, 0x7E, 0xE7,
-    0x9B, 0x5F, 0x7F, 0xFA, 0x4F, 0xFE, 0xAD, 0x70, 0xC0, 0x67, 0xAB, 0xE5, 0xE2, 0x52, 0xC3, 0x2F,
-    0x6F, 0x98, 0xC1, 0xC2, 0xA6, 0xBC, 0x49, 0xCE, 0x96, 0x79, 0xE3, 0x6F, 0x10, 0x0A, 0xF7, 0xE8,
-    0x04, 0xC1, 0x11, 0xD2, 0xA7, 0x71, 0xC2, 0xFA, 0xE2, 0xB2, 0x70, 0x4B, 0xBF, 0xD4, 0xDD, 0x7E,
-    0xA2, 0x63, 0x62, 0x94, 0x82, 0x51, 0x73, 0x3A, 0x74, 0x6F, 0xCD, 0x1D, 0xF3, 0xFA, 0x69, 0x76,
-    0x8B, 0x56, 0x07, 0x4E, 0xDD, 0x49, 0x69, 0x70, 0xD4, 0x99, 0x77, 0xC8, 0x59, 0xDC, 0x3B, 0x96,
-    0x7A, 0x47, 0xB5, 0x41, 0xDB, 0xED, 0x7F, 0x76, 0xDA, 0xBA, 0x73, 0x55, 0x77, 0x7E, 0xD7, 0xAD,
-    0x36, 0x89, 0xD6, 0x60, 0xD7, 0xD5, 0xB5, 0xC6, 0xCA, 0x6E, 0xD7, 0xB2, 0x93, 0x52, 0x23, 0x6C,
-    0xEA, 0xE9, 0x9D, 0x8E, 0x25, 0xE2, 0x92, 0x15, 0x34, 0xCB, 0x46, 0x90, 0x59, 0x32, 0x2E, 0xD9,
-    0x41, 0xB3, 0x6D, 0x5C, 0x4F, 0x2D, 0x15, 0x8D, 0xBA, 0x7E, 0x6D, 0xB8, 0xDE, 0xEA, 0x1C, 0x7D,
-    0x4C, 0xFA, 0x8F, 0x49, 0xDB, 0x23, 0x11, 0x3E, 0x49, 0xAB, 0x5F, 0xA1, 0xD5, 0x41, 0x99, 0x8D,
-    0x78, 0xB6, 0x7F, 0xFD, 0x97, 0xF2, 0xE4, 0xE3, 0xB5, 0x9A, 0xF6, 0x5E, 0x20, 0xEF, 0xA8, 0x08,
-    0x9B, 0x46, 0x94, 0x18, 0xD1, 0xA6, 0x88, 0x12, 0x75, 0x23, 0xCC, 0xB6, 0x31, 0x55, 0x06, 0xF1,
-    0x20, 0xD7, 0x41, 0xC0, 0x7F, 0xF4, 0x2D, 0xBE, 0x7A, 0x0A, 0x7E, 0x82, 0xA7, 0x42, 0x04, 0x66,
-    0x09, 0x17, 0xD2, 0xC3, 0x45, 0x84, 0x8B, 0x51, 0x58, 0x6E, 0xC6, 0xA7, 0x46, 0xD2, 0x14, 0x44,
-    0x63, 0xAC, 0x7F, 0x30, 0x49, 0xB4, 0x69, 0x36, 0x61, 0x85, 0xB7, 0xC8, 0x08, 0x9C, 0x1A, 0x2D,
-    0x98, 0x1B, 0xAB, 0x8A, 0x9E, 0xDD, 0x36, 0x42, 0x84, 0xE5, 0x49, 0x3C, 0xE4, 0xE0, 0x34, 0xA0,
-    0x16, 0x49, 0x8E, 0xF3, 0x1A, 0x0D, 0x82, 0x8E, 0x11, 0xE0, 0xE2, 0x34, 0x2E, 0xF0, 0xB0, 0x26,
-    0x42, 0x10, 0xAC, 0xB4, 0xCF, 0xEA, 0xB3, 0xDF, 0x9E, 0x60, 0xF3, 0x46, 0xE0, 0x79, 0x84, 0x2D,
-    0x1B, 0xC1, 0x5B, 0x25, 0xB0, 0xB1, 0x7C, 0x19, 0xC8, 0x18, 0x81, 0x9E, 0x21, 0xAE, 0x6D, 0x2D,
-    0x43, 0x24, 0xCA, 0x30, 0x08, 0xDA, 0x08, 0x74, 0xF2, 0xD6, 0x58, 0xE0, 0x40, 0x04, 0xA0, 0x36,
-    0x48, 0x56, 0x42, 0x4D, 0x58, 0x00, 0x02, 0x8B, 0x00, 0x71, 0x2C, 0xCF, 0x04, 0x74, 0xB4, 0x04,
-    0x0F, 0xE9, 0xA8, 0x29, 0x8C, 0xAE, 0xE9, 0xE1, 0x9E, 0x63, 0x20, 0xFE, 0xC2, 0xF1, 0x20, 0x17,
-    0x99, 0x9A, 0x0A, 0x3A, 0xF9, 0x3F, 0xBF, 0x47, 0x8E, 0x78, 0x2E, 0xC9, 0x65, 0x3E, 0x42, 0x04,
-    0x31, 0xDC, 0xFC, 0x98, 0xE2, 0x4C, 0xE0, 0x31, 0xB0, 0x77, 0xA7, 0x38, 0x34, 0x49, 0x64, 0x44,
-    0x1E, 0x53, 0xD5, 0x3C, 0xAC, 0xEA, 0xF9, 0x8C, 0xD7, 0xCB, 0x7E, 0xDD, 0xD2, 0xA9, 0x68, 0xFB,
-    0xBC, 0xEA, 0x24, 0x6B, 0x1D, 0x52, 0xFE, 0x80, 0x68, 0xF6, 0x40, 0xFA, 0x62, 0x21, 0x29, 0x88,
-    0x2F, 0x91, 0x8A, 0xC6, 0x5D, 0x8F, 0xE8, 0x23, 0xFC, 0xA9, 0x83, 0xCA, 0xA4, 0xF2, 0x48, 0x4D,
-    0xC7, 0x04, 0x98, 0x40, 0xA2, 0x28, 0x9F, 0x12, 0x64, 0x55, 0x8B, 0x16, 0xC9, 0x5D, 0xDF, 0xF0,
-    0x6D, 0xAD, 0x63, 0x4B, 0xEB, 0x0E, 0x8C, 0xA1, 0x76, 0x52, 0x92, 0x31, 0x56, 0x5F, 0xCB, 0x73,
-    0x1E, 0xAA, 0x17, 0x30, 0x20, 0x03, 0xFA, 0x82, 0x01, 0xE2, 0xE4, 0x72, 0x84, 0xC3, 0xCB, 0xD6,
-    0x36, 0xDE, 0x7C, 0x07, 0xA8, 0xF4, 0x2F, 0xFC, 0xD9, 0x82, 0x0A, 0x55, 0x40, 0x84, 0x0D, 0xFF,
-    0x2B, 0x7F, 0x0A, 0x12, 0x23, 0xE3, 0x63, 0x91, 0x50, 0x77, 0xFD, 0x1A, 0xC2, 0x5C, 0x07, 0x65,
-    0xAD, 0x13, 0x28, 0xEB, 0x9A, 0x11, 0xA9, 0x5D, 0xCE, 0x51, 0x58, 0x1D, 0xC4, 0x16, 0xF2, 0x34,
-    0x01, 0xF2, 0xE0, 0xE2, 0xB8, 0xE1, 0xDD, 0xE7, 0x64, 0x42, 0x06, 0x99, 0x72, 0xD2, 0xE3, 0xBC,
-    0x0A, 0xFD, 0xAB, 0x5B, 0xD0, 0x18, 0x2A, 0x5B, 0x2B, 0x21, 0xA8, 0xB7, 0x10, 0x68, 0xF8, 0x93,
-    0x02, 0x07, 0xAA, 0x50, 0xAD, 0x4C, 0xB6, 0xA7, 0xFE, 0xF1, 0xDB, 0x08, 0x39, 0x09, 0x14, 0xD0,
-    0xDA, 0xCB, 0xA0, 0xD8, 0x12, 0x51, 0xE6, 0xB2, 0x35, 0x49, 0x9D, 0xF1, 0xC8, 0xAC, 0xAD, 0x92,
-    0xF1, 0x12, 0x72, 0x39, 0xDC, 0x7A, 0x44, 0x36, 0xAC, 0x42, 0xE6, 0x7C, 0x49, 0xD4, 0x21, 0x31,
-    0x37, 0xF2, 0x88, 0xB8, 0xE4, 0x09, 0xB6, 0xCB, 0xF9, 0x05, 0x0B, 0x59, 0xE1, 0x67, 0x1C, 0xF4,
-    0x7F, 0x35, 0x1B, 0xC6, 0xC8, 0x1C, 0xC3, 0x99, 0x06, 0x45, 0x76, 0x20, 0x9C, 0xCF, 0xB4, 0xE9,
-    0x6A, 0x3E, 0x7F, 0xC0, 0xB3, 0xBC, 0xC5, 0xB3, 0xB9, 0xD3, 0xF9, 0x01, 0x5E, 0xF4, 0x40, 0x02,
-    0xCA, 0xF2, 0x5C, 0x25, 0x2E, 0x10, 0xAD, 0x7C, 0xEE, 0xAE, 0xA3, 0x6A, 0x80, 0x3E, 0xD0, 0x5F,
-    0x82, 0xCB, 0xFA, 0x15, 0x04, 0x0A, 0x68, 0x42, 0x5D, 0xF0, 0x75, 0x3D, 0x2A, 0x8A, 0xC9, 0xDE,
-    0xF8, 0x5A, 0x17, 0xBC, 0x62, 0x75, 0xEF, 0xFB, 0xAC, 0x07, 0x84, 0x41, 0xD4, 0x20, 0x8E, 0xB8,
-    0x28, 0xC0, 0x10, 0x9C, 0x38, 0xF9, 0x8F, 0x4F, 0xB2, 0xCB, 0x42, 0xAD, 0xC7, 0xA0, 0x08, 0x2B,
-    0xC5, 0x90, 0x8F, 0x2E, 0xE8, 0x55, 0x02, 0x80, 0xD2, 0x15, 0x9C, 0xCF, 0xE7, 0x09, 0xA7, 0x7C,
-    0xE4, 0x23, 0xA7, 0x0E, 0x2F, 0x2A, 0x86, 0x78, 0x76, 0x5A, 0xEB, 0xA8, 0xAD, 0x13, 0x50, 0xB4,
-    0x7C, 0x42, 0x26, 0x13, 0x6C, 0x54, 0x7E, 0x6E, 0xD5, 0xD2, 0x89, 0xD4, 0x1D, 0x96, 0x78, 0x8A,
-    0x17, 0x72, 0x8D, 0x81, 0xE8, 0x57, 0x5C, 0xAD, 0x61, 0x81, 0x5D, 0xB0, 0x60, 0xC8, 0x01, 0xA0,
-    0x00, 0x1D, 0x38, 0x51, 0x3F, 0x3B, 0xBE, 0x04, 0xDD, 0xBE, 0xDC, 0x71, 0xE6, 0x16, 0x99, 0x33,
-    0xBE, 0xD1, 0x43, 0x8B, 0x67, 0x67, 0xDB, 0x1A, 0x05, 0xA3, 0xC3, 0x75, 0xB7, 0x20, 0x05, 0x94,
-    0xB4, 0xDE, 0xBC, 0x62, 0x80, 0x14, 0x0C, 0xEC, 0xEE, 0x93, 0x82, 0x95, 0xDC, 0xF5, 0xD7, 0x7A,
-    0xA4, 0x60, 0x4A, 0xE1, 0x0D, 0x53, 0x62, 0x73, 0xC9, 0x2D, 0xAF, 0x24, 0x7B, 0xC2, 0xFD, 0xCF,
-    0xD4, 0x8E, 0x02, 0x32, 0xB7, 0xE8, 0xC5, 0x82, 0xCA, 0xAB, 0x32, 0x56, 0x81, 0x4B, 0x2D, 0x23,
-    0x06, 0xF1, 0xFD, 0x1F, 0x99, 0xA8, 0xD0, 0xF5, 0xBA, 0xEC, 0xAE, 0xB0, 0x59, 0x99, 0xD8, 0x63,
-    0xF9, 0xAA, 0x8B, 0x44, 0x6F, 0x95, 0xAD, 0xEB, 0xBD, 0xC9, 0x3D, 0xFF, 0x46, 0xD2, 0x65, 0xF0,
-    0x80, 0xFD, 0x1A, 0x34, 0x1F, 0xD5, 0x8E, 0xF4, 0x5E, 0x34, 0xD6, 0x60, 0x1B, 0x17, 0x7E, 0xCE,
-    0x63, 0xBF, 0x4C, 0xD6, 0xA7, 0x2E, 0x3A, 0xE4, 0x7A, 0x2A, 0x04, 0xF1, 0x2E, 0xD9, 0x32, 0x6A,
-    0xA9, 0x95, 0xD8, 0xED, 0xF7, 0xE6, 0xEE, 0xF7, 0x30, 0x88, 0x56, 0x76, 0x2E, 0xA2, 0xA4, 0xCC,
-    0xF1, 0x86, 0x15, 0xD6, 0x67, 0x2F, 0x3B, 0x39, 0xD2, 0x86, 0x1C, 0x34, 0x5D, 0x44, 0xE0, 0x15,
-    0x0E, 0x69, 0xEE, 0x44, 0x38, 0x4E, 0x13, 0xA1, 0x3D, 0xC0, 0x6B, 0x03, 0xC1, 0xCB, 0x29, 0xCC,
-    0xD4, 0x12, 0xAC, 0x04, 0x62, 0x99, 0x6F, 0x20, 0xA2, 0x6C, 0xBF, 0xCA, 0x41, 0x88, 0x5B, 0x29,
-    0xDE, 0x2A, 0x87, 0xEA, 0xE5, 0x0D, 0xCD, 0x0B, 0x53, 0x58, 0x4D, 0x07, 0x92, 0x2F, 0x94, 0xBE,
-    0x97, 0xBB, 0x1F, 0x54, 0x97, 0x3D, 0x3A, 0x79, 0xC7, 0xA3, 0xD3, 0xEE, 0x9E, 0x74, 0x27, 0xC1,
-    0xB5, 0x0A, 0xB0, 0x5C, 0x54, 0x09, 0xCE, 0x8C, 0xEA, 0xAA, 0x43, 0x2D, 0xD5, 0xC6, 0xB9, 0xE1,
-    0xB5, 0xEC, 0xCB, 0x41, 0x66, 0xA3, 0x39, 0xB1, 0x57, 0xA2, 0xAC, 0xBC, 0x1C, 0x67, 0x65, 0x3F,
-    0xC5, 0xB9, 0x9D, 0xB9, 0x7E, 0x23, 0x75, 0x7D, 0x37, 0x75, 0x03, 0x1B, 0xA7, 0x4A, 0xE9, 0x49,
-    0xCA, 0x1B, 0x9E, 0x5E, 0x63, 0xD4, 0x2B, 0x01, 0x03, 0x88, 0x75, 0xB8, 0x09, 0xB8, 0xA2, 0x62,
-    0x60, 0x4B, 0x97, 0x81, 0xF5, 0x3A, 0x1A, 0xAB, 0x84, 0xE3, 0x8C, 0x03, 0xED, 0x26, 0x7A, 0xA7,
-    0x0F, 0x11, 0xFC, 0x2D, 0xF8, 0x65, 0x8A, 0x1D, 0x7C, 0x09, 0x6F, 0xDC, 0xD2, 0xAF, 0x6C, 0xA0,
-    0x43, 0xD3, 0x19, 0xA7, 0x3C, 0x80, 0x19, 0x48, 0xD5, 0xFE, 0xEB, 0x41, 0xFC, 0x60, 0x56, 0xF0,
-    0x91, 0x60, 0x60, 0x89, 0x1F, 0x50, 0x01, 0x1E, 0x0D, 0x5B, 0xA7, 0x57, 0x57, 0x2A, 0xA8, 0xAD,
-    0x27, 0x44, 0x51, 0x06, 0xF8, 0x0D, 0xC9, 0x46, 0x4E, 0x65, 0x06, 0xF7, 0xBB, 0x17, 0x19, 0x02,
-    0x51, 0x73, 0x16, 0x99, 0xE8, 0x65, 0x44, 0x6B, 0xCE, 0x85, 0x91, 0x81, 0xD9, 0x5E, 0x0E, 0x48,
-    0xBE, 0x8B, 0x37, 0x92, 0xC6, 0x7B, 0x3F, 0xCD, 0x20, 0xA0, 0x16, 0x9A, 0xDD, 0xC7, 0x2E, 0xBE,
-    0x70, 0xAF, 0xC7, 0xC5, 0xBA, 0xE8, 0x93, 0x79, 0xFA, 0x79, 0x12, 0xBB, 0x68, 0x74, 0x67, 0xEB,
-    0x8F, 0x48, 0xA1, 0x29, 0x94, 0x4F, 0x75, 0x11, 0xAD, 0x72, 0x8C, 0xB2, 0x3A, 0x37, 0xE2, 0x3D,
-    0x12, 0x2E, 0xE3, 0x96, 0xB7, 0x14, 0x0A, 0x58, 0x25, 0x50, 0xBF, 0x9E, 0x5E, 0x7B, 0xF1, 0xA0,
-    0x87, 0x26, 0xF7, 0x0B, 0x01, 0x46, 0xF2, 0xF9, 0x5B, 0xE9, 0x5E, 0xDE, 0xEC, 0x35, 0x16, 0x94,
-    0x83, 0xF4, 0x80, 0xDE, 0xA0, 0x1C, 0x9F, 0x39, 0xD0, 0xBA, 0x42, 0xE7, 0x1E, 0xB1, 0xF1, 0xB2,
-    0x19, 0x49, 0xEE, 0x67, 0x5B, 0xD4, 0xDA, 0x66, 0x30, 0x56, 0x2B, 0x8C, 0x12, 0x32, 0x66, 0xA1,
-    0xBD, 0x45, 0x0E, 0x4B, 0xD4, 0x75, 0xFE, 0xB3, 0x1C, 0xF3, 0x9F, 0x6C, 0x89, 0x31, 0xDB, 0xBA,
-    0x1B, 0x20, 0xF2, 0xA9, 0x71, 0xEF, 0x42, 0x56, 0x60, 0x3E, 0x7C, 0xCB, 0xE5, 0x0C, 0x5E, 0x2D,
-    0xC0, 0xDE, 0xCD, 0x9D, 0x52, 0x94, 0x2F, 0x51, 0xA0, 0x7F, 0x91, 0x34, 0x56, 0xB4, 0x2F, 0x11,
-    0x6E, 0xE5, 0xC6, 0x33, 0x8B, 0x38, 0xEC, 0xE4, 0xF3, 0xC4, 0xA7, 0xA2, 0xF1, 0xF9, 0x9E, 0x8A,
-    0xAC, 0xD3, 0x3E, 0x26, 0x00, 0x4F, 0x8E, 0x5D, 0x0E, 0xA9, 0xED, 0x7A, 0x22, 0xCB, 0xC8, 0xFC,
-    0x30, 0x26, 0xFB, 0x66, 0x40, 0x4B, 0x2E, 0x89, 0x14, 0x7F, 0xEF, 0x00, 0x2B, 0x2E, 0x05, 0x34,
-    0x05, 0x03, 0xA4, 0x2D, 0x32, 0x6F, 0x27, 0x54, 0x3E, 0x17, 0x8B, 0x0E, 0x4B, 0x07, 0x4B, 0x07,
-    0x68, 0xA2, 0x61, 0xE8, 0x5E, 0x59, 0xAD, 0x15, 0xC9, 0x30, 0xF6, 0x05, 0xB9, 0x00, 0x96, 0xE2,
-    0x7B, 0x58, 0x7F, 0x13, 0xF8, 0x01, 0xEA, 0x7B, 0xCC, 0x2E, 0xEF, 0x33, 0x93, 0xEF, 0xEE, 0x33,
-    0x13, 0xC9, 0x36, 0x59, 0xB7, 0xE1, 0xC4, 0xB3, 0x30, 0x80, 0x2A, 0xEA, 0x95, 0x67, 0xEB, 0x7D,
-    0x80, 0xE6, 0xDD, 0x16, 0xD0, 0x89, 0x86, 0xC6, 0x89, 0x3B, 0xEF, 0xDE, 0xC0, 0x16, 0xE5, 0x27,
-    0xAE, 0x67, 0x64, 0x9D, 0x7D, 0x35, 0x1A, 0xF7, 0xD5, 0x60, 0x46, 0x3D, 0x35, 0x98, 0x91, 0x7D,
-    0x2E, 0xA4, 0xED, 0x72, 0x60, 0x26, 0xDC, 0x6E, 0xC1, 0xE4, 0x28, 0xB8, 0x00, 0x37, 0x5D, 0xC4,
-    0x5F, 0xAA, 0x80, 0x20, 0x8B, 0x64, 0x23, 0xE6, 0x46, 0xFA, 0xBD, 0x47, 0x61, 0x28, 0x2E, 0x8C,
-    0x8C, 0x1A, 0x5F, 0xDC, 0x3C, 0x72, 0xF9, 0x6B, 0x61, 0x73, 0x91, 0x30, 0xD2, 0x9B, 0xA1, 0x19,
-    0x72, 0x35, 0x11, 0xBC, 0xB1, 0xE5, 0x7E, 0xE3, 0x1A, 0xB2, 0xC5, 0x85, 0xDB, 0xB1, 0x4D, 0x2D,
-    0xDA, 0xCB, 0xA8, 0x38, 0x55, 0xEF, 0xB4, 0x7B, 0x67, 0x39, 0x2A, 0x8C, 0x05, 0xE9, 0xFE, 0x4E,
-    0x68, 0x22, 0xCC, 0x38, 0xB6, 0x6E, 0xD2, 0x44, 0x4C, 0x7F, 0xC1, 0xA4, 0x6E, 0x9E, 0x8B, 0x71,
-    0x2F, 0xE5, 0xA7, 0x7B, 0x3E, 0x33, 0xB4, 0xA7, 0xCE, 0x84, 0x63, 0x54, 0x2B, 0xD1, 0x53, 0x8E,
-    0x8C, 0x9C, 0x21, 0x72, 0x1E, 0x27, 0x67, 0x10, 0x3B, 0x46, 0x8F, 0xFF, 0x52, 0x56, 0xA5, 0x89,
-    0x2A, 0x8D, 0x55, 0x5F, 0xD9, 0x5E, 0x6C, 0x67, 0x8B, 0x17, 0x22, 0x51, 0xA4, 0x05, 0xC4, 0x38,
-    0x96, 0xAF, 0x6F, 0xCF, 0x49, 0x9D, 0x59, 0x7E, 0x36, 0x44, 0xF5, 0x51, 0xC2, 0x66, 0xD3, 0x71,
-    0xA8, 0xEA, 0xD0, 0x62, 0x79, 0xBA, 0x8B, 0x2A, 0x62, 0xE9, 0xF7, 0xC5, 0xB5, 0xF3, 0x3D, 0xE4,
-    0x04, 0xCB, 0xA1, 0xA2, 0x93, 0x3E, 0x30, 0x0E, 0xB9, 0xBC, 0xC4, 0x65, 0x46, 0xBC, 0xE5, 0x9B,
-    0xB4, 0x76, 0xC8, 0x55, 0x46, 0x74, 0x5C, 0xBE, 0x58, 0x33, 0x07, 0xD7, 0xCC, 0x22, 0xB1, 0x0F,
-    0xB1, 0xC4, 0x0A, 0x60, 0xFB, 0x14, 0xCD, 0x64, 0xAF, 0x82, 0x1E, 0x46, 0xB6, 0x53, 0x44, 0xCB,
-    0x44, 0xD8, 0x88, 0x37, 0x1E, 0x4E, 0x23, 0xF4, 0x61, 0xE5, 0x37, 0xE1, 0x4C, 0x57, 0x77, 0xA5,
-    0x3F, 0x29, 0x3B, 0x74, 0x7A, 0x88, 0x96, 0xC4, 0x0F, 0x4D, 0x86, 0xC1, 0xEB, 0x81, 0xFC, 0xF8,
-    0x65, 0x2F, 0xE6, 0xD4, 0x75, 0x98, 0xAE, 0x15, 0xB6, 0x71, 0x89, 0x98, 0xD5, 0x51, 0x59, 0xA3,
-    0x51, 0x01, 0x85, 0x0B, 0x39, 0x4C, 0x5D, 0x88, 0xB0, 0x55, 0x8B, 0x80, 0x3D, 0x16, 0xC2, 0x86,
-    0x4B, 0xF4, 0x16, 0x63, 0x86, 0xFB, 0xB6, 0xD0, 0xE9, 0x80, 0xF6, 0x1F, 0x23, 0x7A, 0x8D, 0x31,
-    0x80, 0xC1, 0x02, 0xCF, 0x18, 0x7E, 0x5A, 0x07, 0x2C, 0x3F, 0xDC, 0x73, 0x7D, 0x89, 0x6A, 0x0B,
-    0xFD, 0x5B, 0x6D, 0x9D, 0xFD, 0xE1, 0x15, 0x2F, 0xCE, 0x7B, 0x9F, 0x25, 0xEE, 0x1C, 0x13, 0x85,
-    0xFC, 0x68, 0x87, 0xEC, 0xB2, 0xB1, 0xDC, 0xFE, 0x95, 0x07, 0xC5, 0xEC, 0x21, 0x89, 0x1C, 0xCF,
-    0x1B, 0x8E, 0xF7, 0xC9, 0x92, 0x7E, 0x1F, 0x79, 0x0F, 0xB5, 0x16, 0x1B, 0x7C, 0x6C, 0x01, 0xEC,
-    0x99, 0xF8, 0x40, 0xBB, 0x76, 0xD8, 0xB5, 0x13, 0xC8, 0xA9, 0x1C, 0xC9, 0x85, 0x37, 0x04, 0xF9,
-    0x23, 0xE9, 0x0F, 0xD1, 0x82, 0x88, 0xCC, 0xC0, 0xCE, 0xBB, 0xB3, 0xC1, 0x52, 0xA1, 0xD3, 0x89,
-    0x0A, 0x8F, 0x85, 0x85, 0x7A, 0xBD, 0xD5, 0x22, 0x1F, 0x92, 0x5E, 0xF5, 0x9B, 0x95, 0xA3, 0x22,
-    0xF7, 0x52, 0xBE, 0x47, 0xAE, 0xC0, 0x0A, 0xD2, 0x17, 0x11, 0xF6, 0x63, 0x36, 0xEA, 0x44, 0xDE,
-    0x7F, 0xF5, 0x0B, 0xAF, 0x05, 0x50, 0x77, 0xD5, 0xAD, 0x5E, 0x77, 0x2E, 0xF2, 0xF0, 0xAE, 0xD0,
-    0xFE, 0x27, 0x8B, 0x05, 0xFE, 0x4C, 0x64, 0xE6, 0x3B, 0xD8, 0xBC, 0xDB, 0xCA, 0xB7, 0x74, 0x39,
-    0x9A, 0x03, 0xC4, 0x2C, 0xE0, 0x03, 0x9F, 0xFC, 0xE2, 0x0B, 0xD8, 0x54, 0xEB, 0x67, 0xC8, 0x9E,
-    0xF9, 0x73, 0xBE, 0x2F, 0x70, 0xF0, 0x7A, 0x1D, 0xAB, 0x1D, 0x9A, 0x87, 0xFC, 0x31, 0x95, 0xEF,
-    0x46, 0xF9, 0x37, 0x13, 0x03, 0xF8, 0x87, 0xA8, 0x1E, 0xFC, 0x8D, 0x5F, 0x7B, 0x5B, 0xEC, 0xF4,
-    0xB2, 0xF7, 0x3B, 0xAB, 0xFC, 0x4D, 0x69, 0x3A, 0x4A, 0xE4, 0x8D, 0x40, 0xD9, 0x54, 0xAD, 0xD3,
-    0x47, 0xB1, 0x7C, 0x27, 0x50, 0x1B, 0x34, 0xD5, 0xA2, 0x4F, 0x50, 0x73, 0x8E, 0xEC, 0xE7, 0x6B,
-    0xDF, 0x7D, 0xF3, 0x81, 0x94, 0xD2, 0x61, 0x55, 0xC4, 0x0B, 0xB4, 0xB0, 0x49, 0x0E, 0x8E, 0x84,
-    0x9C, 0x2D, 0xAA, 0x2F, 0x8A, 0xD4, 0xC5, 0xE6, 0x42, 0x87, 0xCC, 0xAB, 0xF0, 0xBC, 0x53, 0xEC,
-    0x42, 0x1F, 0x30, 0x0E, 0x45, 0xE4, 0x28, 0x3B, 0xC5, 0x80, 0xAE, 0xA6, 0xF7, 0x04, 0xF9, 0x0F,
-    0xB5, 0xD6, 0x0C, 0x83, 0xA1, 0xF9, 0x60, 0xD0, 0xF6, 0xFB, 0x1E, 0x92, 0xA9, 0x6D, 0xE4, 0xF1,
-    0x32, 0x13, 0x8F, 0x88, 0xD9, 0x87, 0x93, 0xB6, 0xBF, 0xF8, 0xDE, 0xE6, 0x1E, 0xDC, 0x10, 0xF5,
-    0x3F, 0xB7, 0x3E, 0xB3, 0xB7, 0x05, 0x9B, 0x3D, 0xB8, 0xD1, 0xCA, 0x5D, 0x0E, 0x57, 0x33, 0xAC,
-    0x17, 0x7B, 0x9E, 0xB1, 0xFC, 0x03, 0x81, 0x2C, 0xB6, 0x41, 0xF3, 0x64, 0x75, 0x98, 0xA5, 0x3A,
-    0xDB, 0x32, 0x97, 0xDF, 0x5A, 0x0E, 0xE3, 0x78, 0x73, 0xC1, 0xA9, 0x4E, 0x28, 0xEB, 0xB2, 0xB9,
-    0xF3, 0xC9, 0x8D, 0x08, 0x4C, 0x25, 0xEA, 0x9B, 0x1B, 0x71, 0x7C, 0x20, 0x7F, 0xB1, 0x4A, 0x14,
-    0x11, 0x5C, 0xCD, 0xA1, 0x12, 0x81, 0xC3, 0x84, 0xFC, 0x83, 0x1F, 0x17, 0x16, 0xF7, 0x0B, 0xBC,
-    0x22, 0x35, 0xC1, 0x4A, 0x7C, 0x10, 0xCA, 0xD7, 0x7D, 0x35, 0x4E, 0xCE, 0x02, 0xFD, 0x3B, 0xB6,
-    0xDE, 0xF8, 0x58, 0x9F, 0xD7, 0x1D, 0x84, 0x7F, 0xF9, 0x4E, 0x58, 0xD4, 0x1D, 0x88, 0x37, 0xF6,
-    0xB9, 0xEA, 0x7C, 0x88, 0xC5, 0x11, 0x03, 0xC9, 0xEF, 0xC3, 0x23, 0x22, 0x3C, 0xE4, 0x8A, 0x61,
-    0xE1, 0xA5, 0x6A, 0x26, 0x5E, 0xB4, 0xAF, 0xA7, 0x87, 0xE5, 0x61, 0xE5, 0x21, 0x36, 0xF1, 0xC0,
-    0xDD, 0x22, 0x8F, 0x4D, 0x86, 0x4E, 0x67, 0x92, 0x16, 0x14, 0x25, 0x96, 0x9F, 0x98, 0xB7, 0x62,
-    0xF9, 0x41, 0x2C, 0xFE, 0x13, 0x11, 0xCA, 0x6A, 0x23, 0xE0, 0x2F, 0xA5, 0xD8, 0x84, 0x97, 0x3D,
-    0xB8, 0x42, 0x74, 0xB9, 0x36, 0xC2, 0x94, 0xA7, 0x38, 0xE0, 0x4C, 0x0F, 0x11, 0x6B, 0xFA, 0xD4,
-    0xF0, 0xCD, 0xBB, 0x7E, 0x65, 0x52, 0xFA, 0x5B, 0x15, 0x63, 0xD7, 0x2F, 0x55, 0xE4, 0xAE, 0x5F,
-    0xA9, 0x28, 0xF9, 0x52, 0xE8, 0x26, 0x68, 0x98, 0x2B, 0x6C, 0x5E, 0x87, 0xA7, 0x0A, 0xFB, 0x7D,
-    0x56, 0x5D, 0x8C, 0xD5, 0x72, 0x62, 0xEF, 0x26, 0x5F, 0x5E, 0x84, 0xFF, 0x02, 0xB5, 0x5A, 0x4F,
-    0x6C, 0x1C, 0xD7, 0x79, 0xFF, 0x66, 0x46, 0xE4, 0xD4, 0x9C, 0x9A, 0x4F, 0x07, 0x09, 0xF9, 0x23,
-    0x92, 0x93, 0x83, 0x0A, 0xD8, 0x2A, 0xC9, 0xD1, 0x41, 0x01, 0x98, 0x74, 0x77, 0x67, 0x24, 0x1D,
-    0x7C, 0x50, 0x01, 0x0B, 0x85, 0x68, 0xA0, 0x0A, 0xD2, 0xF8, 0x90, 0x8B, 0x85, 0xA0, 0xD2, 0x81,
-    0x05, 0x68, 0x80, 0xD4, 0x8E, 0xCC, 0x43, 0x0E, 0x3E, 0x90, 0x08, 0xA0, 0x5C, 0x43, 0x20, 0x12,
-    0xA0, 0xB2, 0x28, 0xC4, 0x03, 0x0B, 0x10, 0xED, 0x92, 0xFB, 0x2C, 0x1E, 0x04, 0xD4, 0x28, 0x3C,
-    0xB6, 0xE2, 0x0A, 0x88, 0x0F, 0x99, 0x46, 0x3E, 0xA4, 0x31, 0x5A, 0x8F, 0xAC, 0x51, 0x33, 0x62,
-    0x66, 0xE7, 0xE5, 0xF7, 0xBD, 0x99, 0x5D, 0x2E, 0x49, 0xC5, 0xA6, 0x5D, 0x66, 0x77, 0xDF, 0xEC,
-    0xEE, 0x70, 0xE7, 0x7D, 0xBF, 0xF7, 0xBD, 0xEF, 0xCF, 0xEF, 0xFB, 0x86, 0x74, 0xFC, 0x4A, 0x48,
-    0xAE, 0x4A, 0x69, 0xF7, 0x63, 0x0E, 0xC3, 0x0F, 0x89, 0x44, 0x42, 0xE4, 0x6C, 0x10, 0x59, 0x1F,
-    0x85, 0x64, 0x3C, 0xC6, 0x97, 0xF5, 0x3A, 0x51, 0xDD, 0x91, 0xE4, 0x1A, 0x09, 0x89, 0xB0, 0x41,
-    0x56, 0xE4, 0x48, 0x33, 0x31, 0x52, 0x2A, 0x56, 0x36, 0xA9, 0xA9, 0x94, 0xF4, 0x94, 0x4A, 0x85,
-    0x24, 0xDF, 0x8E, 0x49, 0x6C, 0x25, 0x64, 0x66, 0xC6, 0xE5, 0x5B, 0x42, 0x65, 0xD5, 0xBC, 0xED,
-    0x4B, 0x96, 0xCA, 0x9D, 0x30, 0x1F, 0xA6, 0xB9, 0x11, 0xAA, 0x8D, 0x53, 0xAD, 0x46, 0xF5, 0x1A,
-    0xCD, 0x7B, 0xE7, 0x0A, 0xA1, 0x0A, 0x47, 0xFD, 0xAF, 0xB1, 0xF9, 0xAA, 0xFE, 0xDD, 0x9F, 0xD3,
-    0x2A, 0x59, 0xE1, 0x14, 0x51, 0x33, 0x27, 0xB2, 0xB3, 0x3D, 0xE8, 0x20, 0x9B, 0xA8, 0x60, 0x88,
-    0x92, 0x68, 0x12, 0xD8, 0xC5, 0xDF, 0xE3, 0x57, 0xF7, 0x25, 0x99, 0x31, 0xBE, 0xA4, 0x1E, 0xF0,
-    0xDB, 0x92, 0x1A, 0x94, 0x91, 0x08, 0x3C, 0x72, 0xA4, 0x1D, 0x59, 0xDB, 0x2B, 0x99, 0xA1, 0x94,
-    0xA2, 0xB6, 0x52, 0x91, 0x4F, 0x94, 0xBB, 0x21, 0xF9, 0x80, 0xE9, 0xC4, 0x98, 0x65, 0x88, 0x4E,
-    0x3B, 0xC1, 0xAA, 0xA5, 0x22, 0xDA, 0x0C, 0xBE, 0x04, 0xCE, 0xC3, 0x45, 0x61, 0x41, 0xB4, 0xC9,
-    0xE2, 0x31, 0x19, 0x79, 0xFC, 0x41, 0x63, 0xF1, 0x3E, 0x24, 0x5F, 0xC9, 0x49, 0x2B, 0x01, 0x12,
-    0x9B, 0x84, 0x29, 0x2D, 0x99, 0x50, 0x0A, 0x28, 0x4E, 0xD4, 0x0E, 0x95, 0x8A, 0x3D, 0xB5, 0x6E,
-    0x6C, 0xFE, 0x80, 0x68, 0x84, 0x97, 0x41, 0x06, 0xB4, 0x35, 0x50, 0xAE, 0x00, 0xDF, 0x28, 0x22,
-    0x1A, 0xC7, 0xCC, 0x21, 0xED, 0x7F, 0x18, 0xED, 0xD8, 0x04, 0x10, 0x75, 0x73, 0x09, 0xDB, 0x8C,
-    0xBD, 0x22, 0x5C, 0xE9, 0x06, 0x64, 0x62, 0x4D, 0x00, 0x66, 0x55, 0x6F, 0x50, 0xBC, 0x1F, 0x93,
-    0xA9, 0xB6, 0xEF, 0x0A, 0xA5, 0x12, 0xA0, 0xC6, 0x35, 0xC9, 0xA0, 0x7A, 0x56, 0x4D, 0x62, 0x4A,
-    0x9A, 0x22, 0x3B, 0xA0, 0xA4, 0x3B, 0xEB, 0x60, 0x61, 0xA8, 0xA4, 0x81, 0xB5, 0xD2, 0x1A, 0x16,
-    0x4D, 0x29, 0x39, 0x21, 0x6D, 0x90, 0xD5, 0x59, 0x76, 0x55, 0xE8, 0xE9, 0x5D, 0x34, 0x4A, 0xE3,
-    0x1A, 0x8B, 0xC9, 0x3E, 0x1F, 0x52, 0x38, 0x70, 0xC8, 0x98, 0x2E, 0x92, 0x4B, 0x76, 0xCB, 0x88,
-    0x56, 0x8F, 0xB2, 0xFA, 0xBE, 0x18, 0x0E, 0x36, 0x88, 0x5A, 0xD8, 0x39, 0x68, 0xEA, 0xD2, 0x9F,
-    0x40, 0x45, 0x17, 0x21, 0x16, 0xBE, 0xE1, 0xF5, 0x76, 0xE0, 0x6A, 0xEC, 0x2A, 0x2B, 0x86, 0x48,
-    0x87, 0xE1, 0x00, 0xD3, 0x3A, 0x39, 0x11, 0xF9, 0xBF, 0x34, 0x54, 0x66, 0x2A, 0xFE, 0xD5, 0xD2,
-    0x0B, 0x64, 0xFD, 0x38, 0xD0, 0x80, 0xA6, 0x9E, 0xB3, 0x6D, 0x74, 0xA2, 0x20, 0x4F, 0x25, 0xE2,
-    0xD9, 0xDF, 0xB2, 0xE0, 0xEB, 0x40, 0x2E, 0x09, 0x02, 0xC8, 0xDB, 0x01, 0x94, 0x68, 0xCF, 0xB5,
-    0x60, 0x98, 0x9E, 0x5A, 0x49, 0x60, 0x6D, 0x0E, 0x00, 0xC1, 0x2B, 0xE9, 0xAA, 0x5A, 0x2A, 0x77,
-    0x2D, 0x3C, 0xE3, 0x7C, 0x9F, 0x31, 0x7D, 0x89, 0x6D, 0xE3, 0xC7, 0x8C, 0x03, 0x7D, 0x2D, 0x92,
-    0x96, 0x42, 0xF6, 0x1E, 0x5C, 0xFE, 0x36, 0x40, 0xAB, 0x82, 0x2C, 0xB8, 0x3F, 0xA5, 0x86, 0x0A,
-    0xEA, 0x64, 0x27, 0x98, 0x6B, 0xD3, 0x8A, 0x80, 0x31, 0x85, 0xD6, 0x10, 0x38, 0x36, 0x70, 0xC2,
-    0x5D, 0x88, 0xA0, 0x4C, 0x9C, 0xC8, 0xEA, 0x64, 0x76, 0xC4, 0xCD, 0x7F, 0x52, 0xB8, 0x44, 0xC1,
-    0x94, 0x95, 0xF4, 0xF1, 0x2E, 0x4A, 0xCD, 0x39, 0xEC, 0x0D, 0x11, 0x0E, 0x6B, 0x33, 0xB0, 0xE1,
-    0x51, 0x9C, 0xC0, 0x19, 0xEB, 0x9E, 0x74, 0xB2, 0x84, 0x1C, 0x05, 0xF5, 0xDD, 0x50, 0x64, 0x49,
-    0x21, 0x8D, 0x08, 0xEB, 0x5D, 0x85, 0x3E, 0x27, 0x80, 0xCA, 0x09, 0x71, 0xA2, 0x73, 0x35, 0x81,
-    0xC7, 0xE4, 0x64, 0x63, 0xC5, 0xE4, 0x3D, 0x92, 0x1A, 0x9D, 0xA5, 0x6E, 0x91, 0x86, 0x87, 0x3F,
-    0xA9, 0x40, 0xE3, 0x03, 0xAE, 0x26, 0x2F, 0x76, 0x93, 0xEA, 0xBC, 0xB3, 0x8C, 0x10, 0x10, 0xEC,
-    0x07, 0xB8, 0xCC, 0x0D, 0xEB, 0xAC, 0x5B, 0xC6, 0x88, 0x5F, 0x79, 0x91, 0xB8, 0x79, 0x57, 0xF1,
-    0x85, 0x19, 0x31, 0x4A, 0x8B, 0x3F, 0xF4, 0xC1, 0xAC, 0x86, 0x8D, 0xD9, 0x79, 0x10, 0xB4, 0xD4,
-    0x5E, 0x84, 0x41, 0x7C, 0xAA, 0x41, 0x0A, 0xE0, 0x1A, 0xC5, 0x18, 0xC7, 0x16, 0x31, 0xC6, 0x49,
-    0x0C, 0xF7, 0x3F, 0x71, 0x1E, 0x72, 0x34, 0xC4, 0xF6, 0x62, 0x4F, 0x87, 0xF8, 0x7A, 0xE5, 0x76,
-    0x37, 0x02, 0x19, 0xD3, 0xE7, 0xE0, 0xDE, 0x6D, 0xC5, 0x71, 0x04, 0xDB, 0x61, 0xC2, 0xFE, 0xD6,
-    0xB1, 0xA0, 0xD7, 0x96, 0x1C, 0x95, 0x5A, 0xAA, 0xC3, 0xC6, 0xD8, 0xC0, 0x9A, 0xB0, 0xD3, 0xF8,
-    0x4B, 0xB1, 0x72, 0x0B, 0xF8, 0x30, 0xE7, 0x16, 0xF6, 0x1A, 0x17, 0xBB, 0x2A, 0x39, 0xF5, 0x8F,
-    0x17, 0x77, 0x76, 0xE7, 0x18, 0xF0, 0x04, 0xE2, 0x6C, 0x34, 0x4E, 0xD7, 0x66, 0x07, 0xD6, 0xDB,
-    0x2A, 0xFF, 0xD7, 0xDB, 0x41, 0xA2, 0x27, 0xBC, 0xCE, 0x66, 0x92, 0x0A, 0x95, 0x1A, 0xED, 0x88,
-    0x7F, 0x29, 0x1D, 0x9A, 0xB2, 0x42, 0x5B, 0x49, 0xBA, 0xDA, 0x1F, 0x36, 0x06, 0xA6, 0x61, 0x45,
-    0x6F, 0x21, 0x6A, 0xC1, 0x59, 0x26, 0x7B, 0x80, 0x36, 0x2E, 0x07, 0x9E, 0x8A, 0x70, 0x31, 0x1B,
-    0x5D, 0xD6, 0x03, 0xB4, 0xBD, 0xB2, 0xA4, 0x54, 0x5E, 0x02, 0x62, 0xFD, 0x8F, 0xD0, 0xF2, 0xB0,
-    0x11, 0x61, 0x4E, 0xA3, 0xD8, 0x6D, 0x34, 0x07, 0x84, 0x35, 0xA0, 0xFD, 0xD4, 0x84, 0x99, 0x77,
-    0xFA, 0xAF, 0x3E, 0x7E, 0xC9, 0xE3, 0x58, 0xAC, 0xCE, 0x95, 0x97, 0x54, 0xB0, 0x9E, 0xBE, 0x81,
-    0xE8, 0x1A, 0xF8, 0x80, 0x25, 0xB5, 0x6A, 0x2A, 0x58, 0xBF, 0x5D, 0x39, 0x0F, 0xD5, 0x94, 0xB0,
-    0x58, 0x30, 0x7B, 0x7D, 0x6B, 0xCF, 0x84, 0x07, 0x07, 0xF4, 0x95, 0xB5, 0x61, 0x86, 0x3A, 0xC0,
-    0xFF, 0x03, 0x56, 0x14, 0xED, 0x97, 0x38, 0xAB, 0x25, 0x5E, 0xEC, 0x49, 0xF4, 0x8B, 0xAE, 0xC4,
-    0x97, 0x88, 0x96, 0xF5, 0x95, 0x1F, 0x13, 0xCD, 0x6B, 0x27, 0x0E, 0x4E, 0x52, 0x6D, 0x56, 0x87,
-    0x9F, 0xDA, 0x21, 0x29, 0x85, 0x68, 0xD8, 0x90, 0xD6, 0xBB, 0x3A, 0xCE, 0x4D, 0x7D, 0x25, 0xBD,
-    0xD0, 0x35, 0xD2, 0x67, 0xE8, 0x4D, 0xC8, 0x98, 0x19, 0xEA, 0x0F, 0xA5, 0x05, 0xDC, 0x56, 0x45,
-    0x0E, 0x04, 0x5B, 0xD8, 0x47, 0x93, 0x83, 0x4A, 0xA7, 0x0A, 0x25, 0xC0, 0xA4, 0xA3, 0x16, 0xE4,
-    0xFA, 0xB7, 0xE0, 0xC5, 0x6A, 0x11, 0x19, 0xF1, 0xD7, 0x19, 0xFC, 0xBF, 0x19, 0x12, 0xA6, 0x56,
-    0x85, 0xC9, 0x11, 0x02, 0x21, 0x2C, 0xA2, 0xBB, 0x45, 0x40, 0xA7, 0xF9, 0xD7, 0xF5, 0xC4, 0x0A,
-    0x57, 0xCB, 0xC9, 0xBD, 0x1F, 0xBF, 0xA2, 0x8A, 0xBA, 0xFB, 0x34, 0x12, 0x1F, 0x91, 0x37, 0x47,
-    0xF3, 0xAB, 0xC6, 0xFF, 0x49, 0xE7, 0xE1, 0xCD, 0xB6, 0x50, 0x39, 0xFC, 0xC0, 0x41, 0x08, 0xF0,
-    0x8E, 0x98, 0x99, 0xAF, 0xDE, 0x51, 0x1D, 0xA3, 0xBD, 0xD4, 0xCD, 0x8E, 0x67, 0xC8, 0xC0, 0x72,
-    0xC8, 0x07, 0x0A, 0xB3, 0xB3, 0x37, 0xC8, 0xAA, 0x18, 0xFA, 0xEA, 0x50, 0x1B, 0xBB, 0xE5, 0xC3,
-    0x21, 0x39, 0x7E, 0x73, 0x44, 0xAE, 0x50, 0x76, 0x61, 0x5B, 0xDB, 0xE7, 0x13, 0x6A, 0x67, 0x38,
-    0xB1, 0x89, 0x5F, 0x4C, 0xD8, 0x9C, 0xE8, 0x95, 0xCE, 0xC9, 0x1C, 0xCD, 0x71, 0xFD, 0x90, 0xFA,
-    0x98, 0xA7, 0xBB, 0x66, 0x85, 0xF1, 0xA8, 0xA9, 0x62, 0x63, 0x47, 0x8E, 0x99, 0xCD, 0x34, 0xD5,
-    0xA3, 0xF7, 0xD5, 0xF7, 0xA9, 0xB3, 0x6A, 0xFE, 0x4E, 0xDA, 0x1F, 0x91, 0xFB, 0x23, 0xDA, 0x78,
-    0xF3, 0x7B, 0xD8, 0x8C, 0x77, 0xB0, 0x17, 0x9B, 0x35, 0x84, 0xA3, 0xC0, 0x5B, 0xE0, 0x15, 0x44,
-    0x27, 0x9E, 0xE9, 0x4C, 0xA2, 0xB7, 0x4C, 0x2B, 0xCB, 0x4E, 0xF6, 0xE0, 0xBD, 0xAA, 0x42, 0xC8,
-    0x4B, 0xCD, 0xA2, 0xD2, 0xEA, 0x26, 0x95, 0xB8, 0xFB, 0x34, 0xCB, 0x98, 0xC5, 0x7F, 0x0B, 0x69,
-    0xAA, 0x47, 0x4C, 0xCA, 0xF0, 0x8B, 0x35, 0x37, 0xA6, 0xBA, 0x8E, 0xBD, 0x48, 0x5A, 0xB1, 0xC3,
-    0x71, 0xFB, 0x2F, 0x39, 0x43, 0x1C, 0xE3, 0x0C, 0xC7, 0x0C, 0x6E, 0x67, 0xFE, 0xCD, 0x51, 0x57,
-    0x65, 0x69, 0xF3, 0x61, 0xE0, 0x03, 0x64, 0x02, 0xF5, 0x02, 0xAF, 0xF7, 0x77, 0xAF, 0xC1, 0x6C,
-    0x92, 0x26, 0x18, 0x1F, 0x22, 0x58, 0xEB, 0xA8, 0x13, 0x2B, 0x65, 0xAB, 0x74, 0xB0, 0x28, 0x03,
-    0xD8, 0x20, 0x82, 0x24, 0xF4, 0x10, 0x78, 0x71, 0xA9, 0x3A, 0x4D, 0x71, 0xD2, 0x5D, 0xEA, 0xD3,
-    0xD8, 0x8A, 0xA5, 0x9C, 0xBC, 0x02, 0x27, 0xBC, 0xB7, 0x63, 0x72, 0xCE, 0x22, 0x81, 0x44, 0x1C,
-    0x69, 0x01, 0xA7, 0x60, 0x96, 0x14, 0x98, 0xED, 0x67, 0x7B, 0x16, 0xCB, 0xB3, 0xB1, 0x06, 0x98,
-    0xEB, 0x68, 0x63, 0xEB, 0xAE, 0xB4, 0x49, 0x66, 0xCE, 0x72, 0x40, 0x9E, 0x72, 0x9D, 0xAF, 0xBF,
-    0x92, 0xA2, 0x39, 0x5B, 0x60, 0x32, 0x07, 0x12, 0x26, 0xE0, 0x59, 0xAF, 0x0F, 0x96, 0xF1, 0x0F,
-    0x3B, 0x80, 0x40, 0x9C, 0xF5, 0x8D, 0xBC, 0x3B, 0xFC, 0xFE, 0x51, 0x3A, 0xD3, 0xCE, 0x08, 0x8C,
-    0xEE, 0xE8, 0xF8, 0x61, 0x69, 0x00, 0x6B, 0x0C, 0x95, 0x66, 0x56, 0xF5, 0xDC, 0x6B, 0x9A, 0xA2,
-    0x39, 0xA5, 0xD0, 0x44, 0x3B, 0xB3, 0xF0, 0x23, 0x0B, 0xAB, 0x2F, 0x2E, 0xC8, 0x06, 0x36, 0x89,
-    0x46, 0x6D, 0x69, 0xDF, 0x48, 0x8C, 0xB8, 0x45, 0xB3, 0x1E, 0x8D, 0x39, 0xD2, 0xB9, 0x97, 0x98,
-    0x49, 0x4E, 0xF9, 0x60, 0x48, 0x2F, 0xF3, 0x4E, 0x85, 0x2D, 0xB8, 0x34, 0x63, 0x42, 0xFA, 0xF6,
-    0xF9, 0x04, 0x72, 0x80, 0xCA, 0x31, 0x0A, 0xDE, 0x44, 0x8B, 0xF7, 0x12, 0x5F, 0x12, 0x46, 0x03,
-    0x5F, 0xD2, 0xD9, 0x56, 0x76, 0xA0, 0x41, 0x86, 0x05, 0x5D, 0x36, 0xCF, 0x67, 0xE4, 0x46, 0x8C,
-    0x03, 0x20, 0xE8, 0x5F, 0x02, 0xF0, 0x5E, 0x3A, 0x0E, 0x20, 0x02, 0xDF, 0x9E, 0x74, 0x88, 0xA9,
-    0x3B, 0x90, 0x88, 0x70, 0xC2, 0x48, 0x8C, 0xC8, 0xA5, 0x31, 0xBC, 0x41, 0xDA, 0x98, 0xA9, 0xDF,
-    0x3C, 0x13, 0x58, 0x7C, 0xEC, 0xA7, 0xE1, 0x5A, 0xDF, 0xBE, 0x7F, 0x7A, 0xBE, 0x67, 0xDE, 0xCB,
-    0x56, 0xC2, 0x4F, 0x73, 0xDF, 0xD3, 0x4A, 0xF5, 0x33, 0xB3, 0xB2, 0xFA, 0x8B, 0x3F, 0xFF, 0xEB,
-    0x28, 0x2F, 0xAD, 0xC5, 0x0A, 0xAC, 0xB0, 0xFB, 0xB4, 0xF9, 0x29, 0x6D, 0x89, 0x95, 0xCA, 0x81,
-    0x2B, 0x4B, 0x65, 0x0A, 0xE9, 0x3E, 0x86, 0x42, 0x36, 0x9E, 0x9C, 0x2D, 0x07, 0xCB, 0xF5, 0x38,
-    0x86, 0x9B, 0x7B, 0x3F, 0xC2, 0x1E, 0x3A, 0x6C, 0x6B, 0x22, 0xD6, 0x25, 0x8C, 0xAD, 0xF2, 0x6E,
-    0x56, 0x7D, 0x81, 0x28, 0xA6, 0xE1, 0xDE, 0x61, 0x8C, 0x8C, 0x18, 0x7C, 0x11, 0x3C, 0xDE, 0xE3,
-    0x4B, 0x4F, 0x89, 0x7B, 0x49, 0xCB, 0x73, 0xAA, 0xC3, 0x86, 0x77, 0xE1, 0x83, 0xB4, 0xF0, 0x17,
-    0xFF, 0x4B, 0xCA, 0x6B, 0x42, 0x1E, 0x75, 0x9D, 0xAD, 0x94, 0x19, 0x62, 0x30, 0x35, 0x0C, 0x6F,
-    0x9E, 0x1A, 0xC3, 0x96, 0xCC, 0x79, 0xCE, 0xD6, 0xB9, 0xF0, 0x36, 0x24, 0x1E, 0x13, 0x0B, 0x8F,
-    0xF3, 0x32, 0xFC, 0xA2, 0xE6, 0xC9, 0x7B, 0x73, 0xB4, 0x3C, 0xF1, 0x20, 0xED, 0xF8, 0x8B, 0xF1,
-    0xB1, 0x29, 0x7E, 0xCC, 0xCE, 0xCE, 0xCD, 0xB5, 0x5A, 0xA7, 0x68, 0x70, 0x21, 0x61, 0x6B, 0xE1,
-    0xF2, 0x08, 0x06, 0x04, 0xA9, 0xCF, 0x79, 0x7B, 0x2B, 0x61, 0x23, 0x13, 0x0B, 0x29, 0x65, 0x7E,
-    0xC0, 0x6F, 0xA9, 0x1F, 0xBA, 0xE7, 0x33, 0xE6, 0x7A, 0xD0, 0xF6, 0xDD, 0x84, 0xDC, 0x02, 0x31,
-    0x19, 0xEB, 0x8E, 0x99, 0x4E, 0xFF, 0x4D, 0x42, 0xD6, 0xA7, 0x20, 0x5A, 0x37, 0xB5, 0x69, 0x51,
-    0x97, 0x68, 0x63, 0x95, 0x13, 0x88, 0xE4, 0x6B, 0xE0, 0xA7, 0x5B, 0x21, 0x39, 0xF8, 0x8A, 0x94,
-    0x41, 0x8F, 0x63, 0xB2, 0x50, 0xA5, 0x08, 0x17, 0x5F, 0x91, 0xC0, 0x3E, 0x4B, 0xB4, 0xED, 0xE1,
-    0x8F, 0x34, 0xAB, 0xD3, 0x92, 0x85, 0x5C, 0xE0, 0x96, 0xEE, 0x73, 0x86, 0xA3, 0xDC, 0xBB, 0x14,
-    0x8D, 0xE0, 0xDD, 0x80, 0x9D, 0x84, 0xE5, 0x21, 0x05, 0x0F, 0xD6, 0x07, 0xE4, 0x64, 0xAD, 0xBA,
-    0x9D, 0x83, 0xAF, 0x9D, 0x1A, 0xB5, 0x94, 0x9F, 0x63, 0x9E, 0x97, 0xA1, 0xF7, 0x97, 0x98, 0xA0,
-    0x8E, 0xAD, 0x19, 0xF2, 0x0C, 0xCF, 0x78, 0x94, 0x8B, 0x06, 0xA1, 0xED, 0x5C, 0xCB, 0xED, 0xFB,
-    0x38, 0xAC, 0xD3, 0x4E, 0xCC, 0x09, 0x6B, 0x9E, 0xFC, 0xC4, 0x2C, 0xC9, 0x82, 0x23, 0x7D, 0x98,
-    0x59, 0x4A, 0x2D, 0x37, 0xB4, 0xE2, 0x9C, 0xC4, 0xDB, 0x11, 0x35, 0x60, 0x02, 0xDB, 0x29, 0x70,
-    0x86, 0x24, 0xA0, 0xF6, 0x66, 0x4C, 0x06, 0x34, 0xC1, 0x9C, 0xC5, 0x6B, 0x4A, 0x6A, 0x35, 0xA5,
-    0x95, 0xB4, 0xC1, 0x0D, 0x41, 0x28, 0x49, 0xC9, 0xDC, 0x28, 0x0D, 0x88, 0x63, 0x78, 0x51, 0xC6,
-    0x20, 0x0E, 0x16, 0x08, 0x1C, 0x4C, 0x28, 0xBE, 0xBE, 0x07, 0x86, 0x7D, 0x2F, 0x72, 0x3D, 0x7A,
-    0x33, 0x01, 0x41, 0x44, 0x38, 0xF7, 0x10, 0xDE, 0x13, 0xF3, 0x51, 0xE2, 0xDC, 0x4F, 0x3C, 0x27,
-    0xCD, 0x45, 0xAF, 0x4A, 0x46, 0xFC, 0x71, 0x25, 0xC2, 0x2C, 0xA6, 0xC0, 0x64, 0x5A, 0xE5, 0x8E,
-    0x63, 0xDE, 0x0F, 0x9F, 0xC8, 0xEF, 0x46, 0x22, 0x86, 0x06, 0x3A, 0xF4, 0x57, 0xD1, 0xE8, 0xBC,
-    0x7D, 0xE1, 0xFD, 0xA8, 0x83, 0xF2, 0x0B, 0x25, 0x12, 0x04, 0x8C, 0xF5, 0x07, 0x31, 0xA8, 0x78,
-    0xF7, 0xCB, 0xDB, 0xF7, 0xF2, 0xCB, 0xD7, 0xF1, 0xCB, 0x70, 0xDD, 0xF2, 0xC5, 0x8E, 0x32, 0x4E,
-    0xB1, 0x53, 0x5A, 0xF3, 0x30, 0xD5, 0x8C, 0xD8, 0x0E, 0x27, 0x69, 0xCD, 0x8C, 0x04, 0xF8, 0x76,
-    0x6A, 0xE1, 0xAD, 0x46, 0x89, 0xF5, 0x0B, 0x91, 0xFB, 0xC9, 0xD0, 0x57, 0x94, 0xD0, 0x23, 0xF4,
-    0x01, 0xAF, 0xAB, 0xA9, 0x35, 0x95, 0xF3, 0xEB, 0xF3, 0xC5, 0xB1, 0x13, 0xA7, 0x22, 0xF2, 0x8D,
-    0xCC, 0x41, 0x65, 0x3B, 0xB0, 0x4B, 0xF2, 0x51, 0x97, 0x66, 0x3C, 0x7E, 0xAD, 0xE9, 0xD7, 0x1E,
-    0xE1, 0xAF, 0xED, 0x08, 0xB7, 0xCF, 0xBF, 0x13, 0x25, 0x6B, 0xB3, 0xE3, 0x63, 0x03, 0x4E, 0x68,
-    0x72, 0x4C, 0xAA, 0x23, 0xA3, 0x82, 0x82, 0xA7, 0xFC, 0x81, 0xB7, 0xE9, 0x29, 0xEC, 0x02, 0x5B,
-    0xBE, 0x7B, 0x6D, 0x2D, 0x97, 0x3D, 0x06, 0xAF, 0x4B, 0x9F, 0xBF, 0xB6, 0x61, 0xDE, 0x60, 0xED,
-    0xF3, 0x93, 0xC6, 0xB9, 0xA8, 0x35, 0x21, 0xB6, 0xA2, 0xBC, 0x8E, 0x7C, 0x43, 0xFA, 0x50, 0xE3,
-    0xF9, 0xEB, 0x08, 0x7F, 0xE4, 0xF7, 0xA5, 0xD7, 0x51, 0x3E, 0x68, 0x32, 0xC4, 0x27, 0x71, 0x29,
-    0x0D, 0xB1, 0xB3, 0xB8, 0xBC, 0x05, 0xAE, 0xCB, 0x4C, 0x9B, 0xD9, 0x97, 0xBB, 0xCE, 0x07, 0xFE,
-    0x85, 0xC7, 0xAC, 0xCE, 0xD3, 0x25, 0x3C, 0x75, 0x0F, 0x3A, 0x91, 0xB2, 0x66, 0x0D, 0xA5, 0x4B,
-    0x11, 0x36, 0x96, 0xF6, 0xF1, 0xCB, 0xE4, 0xF2, 0x92, 0x1B, 0x7C, 0x68, 0xF1, 0x81, 0x8D, 0x8B,
-    0x69, 0xA4, 0xAE, 0x49, 0x99, 0x39, 0x6A, 0xF6, 0xC6, 0x1E, 0xA3, 0x1F, 0xB1, 0x36, 0x1A, 0x46,
-    0x30, 0x56, 0xFE, 0x6E, 0x82, 0x2B, 0x24, 0xA2, 0xFA, 0x0F, 0x75, 0xAD, 0x87, 0x5D, 0x82, 0xED,
-    0x5F, 0xAF, 0x51, 0x83, 0xF1, 0x01, 0x94, 0xF5, 0x0B, 0xE2, 0x95, 0x68, 0x71, 0xE3, 0xDA, 0x95,
-    0x89, 0x56, 0xAB, 0x75, 0xEC, 0x7A, 0xD4, 0x11, 0x27, 0xE7, 0x45, 0x82, 0x91, 0x62, 0xE4, 0x34,
-    0x27, 0x3A, 0xD4, 0x12, 0x6D, 0x8C, 0x9F, 0x05, 0x2D, 0x77, 0x51, 0xE6, 0xEE, 0xDB, 0x51, 0xEE,
-    0x2E, 0xC4, 0xB9, 0xF7, 0x16, 0x42, 0x5B, 0x98, 0x61, 0x6C, 0xE4, 0x7E, 0xE8, 0x67, 0x3E, 0x6A,
-    0x43, 0x5F, 0xBA, 0x18, 0x22, 0xE3, 0x7A, 0xB0, 0xA6, 0x9D, 0xB7, 0x7F, 0xEA, 0x93, 0x6F, 0xA0,
-    0xA6, 0xB1, 0xD2, 0x49, 0xD8, 0xC9, 0x1C, 0x3D, 0x4E, 0xAC, 0x87, 0x52, 0x5C, 0xA5, 0x7A, 0x8B,
-    0xB6, 0x13, 0xEB, 0x13, 0x09, 0x11, 0x4C, 0x68, 0x5E, 0x46, 0xFD, 0x5B, 0x7F, 0xAE, 0xF8, 0xBB,
-    0x2C, 0x3E, 0x84, 0x78, 0xF9, 0x47, 0xC4, 0xFB, 0x3B, 0xE2, 0xB5, 0x4F, 0x55, 0x54, 0x83, 0xDD,
-    0x9B, 0x07, 0x7B, 0xBC, 0x7F, 0x30, 0x10, 0xF0, 0x67, 0x4F, 0xFB, 0xB3, 0x66, 0x3E, 0xD7, 0xB5,
-    0xD6, 0x03, 0x1A, 0xC1, 0xA2, 0x6C, 0x44, 0x48, 0xAE, 0xF8, 0x69, 0xA9, 0x7F, 0x61, 0x87, 0x02,
-    0x7A, 0x80, 0xBE, 0x35, 0xE4, 0x30, 0xD1, 0x40, 0x15, 0x7A, 0xE4, 0xCB, 0xE8, 0x2C, 0x60, 0x7B,
-    0x85, 0x81, 0xE0, 0xE3, 0x9D, 0xBD, 0xBB, 0xF9, 0xF5, 0x2B, 0x5C, 0x84, 0x78, 0x37, 0x12, 0xB8,
-    0x5A, 0x83, 0x66, 0xEB, 0x34, 0x87, 0x57, 0x83, 0x5F, 0xAD, 0xF2, 0x75, 0x9D, 0xCB, 0x9E, 0xC3,
-    0xD2, 0x3A, 0x66, 0x30, 0xC1, 0xCA, 0xED, 0x67, 0x07, 0x82, 0x8E, 0xC4, 0x95, 0x21, 0x5A, 0x9B,
-    0x3A, 0xCA, 0xEC, 0xEB, 0x3B, 0x9E, 0x00, 0x73, 0xE4, 0xC2, 0x1D, 0x12, 0xA4, 0x1F, 0x5A, 0x19,
-    0xF7, 0xC6, 0x80, 0xD2, 0x7E, 0xC0, 0xD5, 0x14, 0x77, 0x59, 0x50, 0x94, 0x3B, 0xEF, 0x05, 0x64,
-    0x3E, 0xE1, 0x02, 0x86, 0xCB, 0x5F, 0x6C, 0xB0, 0xFF, 0x4A, 0xF1, 0xD3, 0xB6, 0xE6, 0x37, 0x2E,
-    0x86, 0xC1, 0x24, 0x76, 0xB0, 0x6A, 0x73, 0x7C, 0xF3, 0x6E, 0xE2, 0x17, 0xCB, 0xFD, 0xBA, 0x41,
-    0x46, 0x11, 0x2A, 0xAA, 0x1B, 0xC9, 0x2C, 0xCD, 0xAE, 0x51, 0x0D, 0xAF, 0x94, 0x6A, 0xEB, 0x34,
-    0x37, 0x6F, 0xA0, 0x3A, 0x48, 0xF0, 0xA7, 0x2A, 0xE5, 0xD0, 0x8B, 0x28, 0x64, 0x4C, 0xD9, 0xAD,
-    0x0E, 0xB2, 0x7D, 0x2D, 0x98, 0xC3, 0x05, 0xDA, 0xAB, 0x90, 0x9D, 0xFD, 0x15, 0xF2, 0x01, 0x41,
-    0x0F, 0x92, 0x19, 0x9A, 0x31, 0x88, 0x4C, 0x86, 0xDD, 0x3D, 0x46, 0xC7, 0xF7, 0xA0, 0xE5, 0x66,
-    0x03, 0x28, 0x57, 0x8E, 0x04, 0x28, 0x62, 0x86, 0x8B, 0xBC, 0x65, 0xA4, 0xF0, 0x0D, 0xB1, 0xC0,
-    0x6D, 0x2D, 0xC6, 0xBB, 0x05, 0xC7, 0x69, 0x71, 0x4D, 0xB8, 0xC0, 0xAB, 0x60, 0xC0, 0x67, 0xD5,
-    0xED, 0xBB, 0x09, 0x33, 0x46, 0xDD, 0xD6, 0xD5, 0x88, 0x8D, 0xF6, 0xC7, 0xD5, 0xAC, 0x2F, 0xD1,
-    0x37, 0x20, 0x6D, 0xDD, 0x91, 0x76, 0x7C, 0x8C, 0x06, 0xF6, 0xB7, 0xA9, 0x98, 0xF6, 0xA3, 0x00,
-    0xB2, 0xC0, 0x18, 0x99, 0xCF, 0x39, 0x81, 0x25, 0x79, 0x08, 0x7E, 0x67, 0x76, 0x17, 0x21, 0x9B,
-    0x73, 0xB6, 0xC1, 0x6F, 0xF4, 0x6F, 0xBB, 0x58, 0xAF, 0xE2, 0x84, 0x62, 0xFE, 0x6A, 0x65, 0x76,
-    0x31, 0xCD, 0x2E, 0xDD, 0x26, 0x4E, 0xB5, 0xBE, 0xEE, 0x89, 0x22, 0x27, 0xF9, 0xBA, 0xBB, 0x05,
-    0xA0, 0xFE, 0x87, 0x21, 0x1F, 0x95, 0xAC, 0xEB, 0x63, 0x43, 0xB7, 0x61, 0xCB, 0xBF, 0x32, 0xFA,
-    0x80, 0xDC, 0xED, 0xCB, 0x8A, 0x9B, 0x3E, 0x4A, 0xAD, 0xDC, 0xB1, 0x79, 0xCE, 0x0E, 0xB7, 0x5E,
-    0x41, 0xAC, 0x4F, 0x14, 0x6D, 0x9D, 0xE8, 0x8E, 0x40, 0xB7, 0x20, 0x07, 0x42, 0x3D, 0x8C, 0xAE,
-    0xD5, 0xA1, 0xF8, 0xF1, 0x59, 0x9A, 0x33, 0x7E, 0xB4, 0x86, 0xD9, 0x8A, 0x35, 0x6A, 0xDC, 0xBE,
-    0x98, 0x72, 0x44, 0x5B, 0xE7, 0x72, 0x7B, 0x1E, 0x74, 0x80, 0x1B, 0x40, 0xCC, 0xA0, 0x1F, 0xAA,
-    0x1C, 0x1A, 0xAF, 0x14, 0x31, 0x55, 0x36, 0xC2, 0x92, 0xFE, 0xE4, 0xAE, 0x7E, 0x03, 0xA1, 0x29,
-    0xB2, 0xB4, 0x1C, 0x46, 0x66, 0x89, 0xCD, 0x78, 0x0C, 0xA4, 0x39, 0xB6, 0xE2, 0x31, 0x83, 0x01,
-    0xA0, 0x8C, 0xE5, 0xAE, 0x62, 0xE8, 0x05, 0x1B, 0x66, 0x6A, 0xC5, 0x7E, 0xE0, 0x31, 0x1F, 0xF6,
-    0x03, 0x7F, 0x01, 0xFB, 0xC3, 0x16, 0x85, 0x12, 0x5C, 0xDA, 0x81, 0x28, 0xCB, 0xEE, 0x23, 0xF5,
-    0x8E, 0xDF, 0xF1, 0x83, 0x06, 0x16, 0x5C, 0xC7, 0xB3, 0x81, 0xD0, 0xB4, 0x09, 0x8D, 0x88, 0x22,
-    0x84, 0x96, 0x82, 0x61, 0x6C, 0x76, 0x6C, 0x45, 0xC3, 0xC8, 0x67, 0xB1, 0x01, 0x31, 0x0D, 0x23,
-    0x76, 0x23, 0x97, 0x6B, 0x4F, 0x6E, 0x12, 0x66, 0x66, 0xEA, 0x44, 0x5E, 0xD0, 0xB0, 0x52, 0x50,
-    0xF4, 0xC0, 0x3F, 0x0F, 0xD2, 0x8D, 0xF9, 0xB7, 0xD8, 0x0C, 0xF6, 0xB4, 0xEE, 0x02, 0x5D, 0x24,
-    0x22, 0xD5, 0x73, 0xD1, 0xD4, 0xD1, 0xC1, 0x73, 0xC0, 0xB0, 0x7E, 0x15, 0x29, 0xE0, 0x12, 0x60,
-    0x5D, 0x65, 0xFE, 0x0D, 0xED, 0x18, 0xAE, 0xD0, 0xEE, 0xBF, 0xD2, 0x4E, 0x70, 0xA6, 0xC3, 0x95,
-    0xA5, 0x44, 0xDD, 0x65, 0x20, 0x68, 0x8E, 0x23, 0x35, 0xFF, 0x5B, 0xA8, 0x23, 0xE6, 0x9F, 0x1D,
-    0x96, 0x46, 0x8E, 0xD2, 0xD9, 0xE8, 0x8C, 0xFD, 0xCF, 0xDC, 0x7B, 0x7D, 0x9D, 0xB3, 0x68, 0x10,
-    0xD4, 0x3B, 0x4C, 0x30, 0x03, 0x20, 0x6B, 0x54, 0xF9, 0x3B, 0x86, 0x66, 0x9C, 0xB8, 0x87, 0xEE,
-    0x45, 0x2A, 0xCB, 0x19, 0x6E, 0x7D, 0x9B, 0xD1, 0x73, 0xDA, 0xA8, 0x83, 0xA8, 0xCC, 0x05, 0x6C,
-    0xCD, 0x29, 0x56, 0xCA, 0xB2, 0x34, 0xAD, 0x6E, 0x7A, 0x70, 0xDE, 0x35, 0xB9, 0x5B, 0x08, 0x54,
-    0xB0, 0x77, 0xEC, 0x3B, 0x5D, 0x4D, 0xAB, 0xD4, 0xDD, 0x8C, 0x8E, 0x91, 0x9F, 0xBA, 0x65, 0x21,
-    0xD5, 0xE1, 0x81, 0x12, 0xF5, 0xE3, 0xDE, 0x9C, 0x11, 0xF2, 0x2C, 0x04, 0xAE, 0xF5, 0x3C, 0x57,
-    0xDD, 0xD8, 0xBE, 0xA5, 0x69, 0x05, 0x4C, 0x57, 0x2D, 0x19, 0x6D, 0x64, 0x96, 0x23, 0xD6, 0x67,
-    0x0A, 0xE6, 0xF7, 0x41, 0xF7, 0x32, 0xCE, 0xC8, 0x0C, 0x7A, 0x6D, 0xB5, 0x57, 0x6A, 0x56, 0x25,
-    0x3D, 0xDC, 0x96, 0x1B, 0x1E, 0xED, 0xDF, 0x2E, 0x97, 0x05, 0x6E, 0x50, 0x11, 0x03, 0x8E, 0x46,
-    0xDE, 0x36, 0xA2, 0x0B, 0xF7, 0x1A, 0x4F, 0x70, 0x00, 0x1D, 0x64, 0x90, 0xCC, 0x3E, 0xEC, 0x8E,
-    0x01, 0xFE, 0x72, 0x96, 0x0B, 0x3C, 0x8C, 0x88, 0x87, 0xA3, 0xAA, 0x7A, 0x1C, 0x7B, 0x03, 0xE7,
-    0xFB, 0x1F, 0x8A, 0x67, 0x8E, 0x71, 0x67, 0xFC, 0x0B, 0xB0, 0x9D, 0x40, 0x68, 0xF2, 0x31, 0xB7,
-    0xB7, 0x7D, 0xA7, 0x6C, 0x7C, 0x44, 0xD5, 0x4D, 0x17, 0x4E, 0x96, 0x4E, 0x81, 0xB8, 0xD5, 0x06,
-    0xF9, 0x1E, 0x64, 0xEF, 0xD5, 0x7D, 0x1F, 0x3B, 0x67, 0x15, 0x05, 0x17, 0x49, 0x45, 0xCD, 0xB2,
-    0xD6, 0x4C, 0x79, 0x00, 0xE3, 0x52, 0x69, 0x08, 0xE6, 0x72, 0x59, 0x7E, 0x69, 0x77, 0xE1, 0x26,
-    0xFA, 0xE7, 0xC9, 0x4F, 0xE9, 0x5B, 0x34, 0x04, 0xA3, 0xE4, 0x7E, 0x92, 0xAE, 0x98, 0x5F, 0x37,
-    0x21, 0x15, 0x24, 0x5A, 0xAB, 0xCA, 0xE9, 0xDD, 0x1B, 0xD9, 0xD5, 0xB1, 0x39, 0x24, 0xC0, 0xBD,
-    0x98, 0x6C, 0xC8, 0x11, 0xFB, 0x55, 0x0E, 0x3D, 0xAB, 0x07, 0xDB, 0xCF, 0xE3, 0xD3, 0xD3, 0x97,
-    0x30, 0x45, 0x87, 0xC7, 0x51, 0xAB, 0x82, 0xD0, 0x1B, 0x71, 0x39, 0xEC, 0x3F, 0x32, 0xB8, 0xDB,
-    0xD0, 0x1D, 0xC4, 0xCC, 0xEF, 0x8D, 0x4A, 0x55, 0x3A, 0xF7, 0xCC, 0x20, 0x10, 0x09, 0xFA, 0xDA,
-    0x87, 0x30, 0x49, 0xFE, 0x60, 0x4B, 0xAC, 0x6C, 0x0E, 0xC4, 0xD7, 0x91, 0xA6, 0x0A, 0xDB, 0x29,
-    0x2A, 0xC1, 0xEF, 0x30, 0x3F, 0x39, 0x89, 0xEC, 0xCA, 0x36, 0xC4, 0x6D, 0x0B, 0x9E, 0xC8, 0xDC,
-    0x29, 0x9C, 0x0F, 0x0F, 0x5C, 0x00, 0x4A, 0x6C, 0x44, 0xA3, 0x13, 0xD6, 0xBD, 0xA8, 0x06, 0x48,
-    0x8E, 0xCA, 0xA0, 0x8F, 0x1A, 0x9B, 0xE6, 0x5C, 0x79, 0x40, 0x39, 0xDC, 0x8E, 0x1D, 0x15, 0x34,
-    0xB3, 0x2F, 0x12, 0xCA, 0x4E, 0xCF, 0xE3, 0x8B, 0x85, 0x96, 0xF7, 0x98, 0x04, 0x0D, 0x3C, 0x3D,
-    0x07, 0xAB, 0x47, 0xED, 0x85, 0xDD, 0xFC, 0x44, 0x15, 0x06, 0x7F, 0xE2, 0xC2, 0x13, 0x11, 0x2F,
-    0x82, 0x16, 0x26, 0x06, 0xC8, 0xF8, 0x8F, 0x93, 0x34, 0x34, 0x1A, 0xD1, 0x4B, 0x2E, 0xED, 0xEE,
-    0x1A, 0x5C, 0xF1, 0x03, 0x33, 0xEF, 0x90, 0xFD, 0x04, 0xD7, 0xBC, 0x87, 0x92, 0x8D, 0xB9, 0x48,
-    0x4E, 0xF6, 0x23, 0x7C, 0x5D, 0x94, 0xC8, 0xD0, 0x50, 0x75, 0x8B, 0xAC, 0x5F, 0xE3, 0xEB, 0x85,
-    0x88, 0x36, 0x3C, 0x69, 0xA7, 0xCD, 0xD2, 0x8D, 0xB8, 0xB1, 0x66, 0xF0, 0x4D, 0x83, 0xF2, 0xD1,
-    0x18, 0x34, 0xFE, 0xFD, 0xE4, 0x90, 0xD3, 0x53, 0x6D, 0x8D, 0x53, 0xF2, 0x67, 0x91, 0xF5, 0x6E,
-    0x20, 0x26, 0xB9, 0xBA, 0x7E, 0x1C, 0x83, 0xF6, 0x78, 0xAF, 0x7E, 0x82, 0x55, 0xA7, 0x6D, 0x15,
-    0xB5, 0x17, 0x03, 0x9A, 0x5E, 0x41, 0x6D, 0xBA, 0xAB, 0xC5, 0x78, 0x87, 0x06, 0x7F, 0x0E, 0x5B,
-    0x7D, 0x2F, 0xD2, 0x38, 0xF2, 0xBC, 0x84, 0x05, 0x1C, 0xD7, 0x4B, 0x58, 0x8C, 0x43, 0xBC, 0xAD,
-    0x61, 0x19, 0xE9, 0x06, 0x39, 0x1F, 0xE4, 0xD4, 0x7C, 0xA5, 0x0C, 0x3B, 0x7C, 0x27, 0x27, 0xA8,
-    0x78, 0xD3, 0xF1, 0x2B, 0x37, 0x76, 0x80, 0x59, 0x92, 0x31, 0x4C, 0x68, 0x38, 0xB1, 0x75, 0x3F,
-    0x14, 0x63, 0x54, 0x9F, 0x33, 0xD3, 0xA2, 0xFD, 0x40, 0xA9, 0x0B, 0xAA, 0xE3, 0x64, 0x69, 0xD9,
-    0x68, 0x41, 0x29, 0xCF, 0xBA, 0x54, 0x65, 0x4B, 0x6E, 0xF7, 0x03, 0xF1, 0xF0, 0x49, 0xDA, 0xD3,
-    0xCF, 0x01, 0x70, 0x75, 0x9E, 0x8B, 0x8B, 0x63, 0xA1, 0x6D, 0xCA, 0x9A, 0xA5, 0x64, 0x1F, 0x79,
-    0x4A, 0x2A, 0x35, 0x4D, 0x30, 0x7D, 0x79, 0xAC, 0x21, 0xFE, 0x80, 0x36, 0xFC, 0xBB, 0xA9, 0x82,
-    0xFB, 0xA8, 0x73, 0x45, 0x5D, 0xB7, 0xC4, 0x4F, 0x43, 0xB3, 0x5B, 0xCF, 0x21, 0x5D, 0xC4, 0xED,
-    0xAA, 0xFD, 0xF8, 0x1E, 0xF5, 0xF0, 0x75, 0xF7, 0x8F, 0xF1, 0xCD, 0x7B, 0x81, 0x99, 0xB6, 0xC9,
-    0x7D, 0xBF, 0xEC, 0x77, 0xE5, 0xDC, 0x7A, 0xEE, 0x6D, 0xC1, 0x32, 0xBD, 0x70, 0x9A, 0xC5, 0x3C,
-    0xD4, 0x37, 0xCE, 0x0E, 0x0C, 0x8E, 0x69, 0xCE, 0x24, 0x74, 0xD7, 0x80, 0xCD, 0xFD, 0x05, 0x7D,
-    0x63, 0x37, 0x38, 0x6C, 0xE8, 0x32, 0x1B, 0x18, 0xF7, 0xD3, 0x2C, 0xEE, 0x0D, 0xE4, 0xDC, 0x60,
-    0x83, 0xCE, 0xB8, 0x9A, 0xE0, 0x13, 0x61, 0xBE, 0xD3, 0xA4, 0x6B, 0xC0, 0x64, 0xDD, 0x00, 0xEA,
-    0x8B, 0xD8, 0xCC, 0x40, 0x4D, 0x72, 0xA6, 0x3C, 0xBA, 0x5B, 0xDA, 0x67, 0x68, 0x3A, 0x7E, 0x81,
-    0x60, 0x59, 0xF1, 0x24, 0x8D, 0xED, 0x0A, 0x77, 0x02, 0x4F, 0x27, 0xE8, 0x1B, 0x21, 0x62, 0x42,
-    0x39, 0x02, 0x5B, 0x7A, 0x81, 0xB5, 0xAD, 0x90, 0x06, 0x54, 0x60, 0xF2, 0x64, 0x30, 0xC0, 0x53,
-    0x64, 0xDC, 0xF9, 0xFF, 0x69, 0xEE, 0x59, 0x79, 0x7B, 0x7A, 0x84, 0xF4, 0x9D, 0x0B, 0x5D, 0x40,
-    0x1C, 0x44, 0x65, 0x08, 0x40, 0x23, 0x5C, 0x13, 0x72, 0xA7, 0xF6, 0x62, 0x39, 0x45, 0x55, 0x0D,
-    0x5B, 0xBF, 0xD2, 0xEC, 0x69, 0x57, 0xB1, 0xA8, 0x63, 0x90, 0x06, 0x01, 0xC2, 0xC5, 0x85, 0xB3,
-    0x99, 0xCC, 0xEB, 0x3E, 0x31, 0x9B, 0x42, 0x83, 0x7B, 0x89, 0x46, 0xEA, 0x48, 0x11, 0x09, 0xE9,
-    0x06, 0x6D, 0xE9, 0xE3, 0x94, 0x3A, 0x9B, 0xA1, 0xEC, 0x57, 0x4E, 0x64, 0x25, 0x9D, 0x0D, 0x9F,
-    0x9C, 0x8F, 0x1E, 0x63, 0x61, 0x6E, 0x7B, 0xE1, 0xF7, 0x31, 0xF9, 0x40, 0x8E, 0x20, 0x9D, 0xB8,
-    0xD0, 0xBB, 0x0A, 0x50, 0x07, 0x3B, 0x39, 0x77, 0xF3, 0xDD, 0xB8, 0x7B, 0xC7, 0xC7, 0xAE, 0x5A,
-    0xFA, 0x53, 0x33, 0x08, 0xB8, 0x2F, 0xF4, 0x30, 0x5C, 0x02, 0xE9, 0xC2, 0xF2, 0x50, 0xBF, 0x70,
-    0xE1, 0x44, 0xEB, 0x0D, 0x5B, 0xA6, 0x9E, 0x88, 0x13, 0xD7, 0x7F, 0xCA, 0x5C, 0x38, 0x16, 0x9C,
-    0x53, 0xF3, 0xB6, 0x04, 0x97, 0x92, 0x56, 0x02, 0x2A, 0xCD, 0x37, 0x74, 0x40, 0xFE, 0x69, 0x14,
-    0x69, 0x62, 0x75, 0x64, 0x57, 0x62, 0x42, 0xEA, 0x69, 0x21, 0xD5, 0xA5, 0x42, 0x9A, 0x89, 0x1D,
-    0xD9, 0x40, 0xC9, 0x4D, 0x34, 0x5C, 0xC3, 0x9D, 0xE2, 0xCD, 0x4D, 0xA8, 0x02, 0x7A, 0xF1, 0xB2,
-    0xEA, 0x9F, 0x2C, 0xE2, 0x72, 0x88, 0x6A, 0xB8, 0xD5, 0x60, 0x72, 0x7C, 0x92, 0xA9, 0x89, 0xF1,
-    0x29, 0xC1, 0xA7, 0x8E, 0x74, 0xDB, 0x01, 0xBA, 0x8F, 0x5C, 0x43, 0xF4, 0x99, 0xA4, 0x59, 0x41,
-    0xA9, 0x13, 0xA6, 0xF6, 0xFB, 0x89, 0xF5, 0x59, 0x62, 0xFC, 0x2E, 0x46, 0x4E, 0xE3, 0x5E, 0x00,
-    0xE8, 0x30, 0x88, 0x30, 0xB3, 0x66, 0x02, 0xB9, 0x85, 0x2C, 0x3F, 0xA6, 0x53, 0x7C, 0x27, 0x01,
-    0x74, 0x3D, 0x03, 0x9D, 0xC8, 0x5D, 0x78, 0x94, 0xB7, 0xEB, 0x7F, 0x03, 0x0E, 0x0D, 0xB1, 0xEE,
-    0x36, 0x8C, 0x94, 0x7D, 0x2E, 0x0E, 0xDE, 0xBB, 0x1B, 0xF8, 0xB0, 0x2B, 0xB3, 0x5B, 0x57, 0x94,
-    0xCC, 0x45, 0x74, 0x47, 0x5A, 0x8D, 0xAC, 0x1A, 0x79, 0xDF, 0x60, 0x66, 0xAA, 0xA6, 0xA7, 0xB9,
-    0x81, 0xCD, 0xB7, 0xB5, 0xB9, 0xBF, 0x8E, 0x3D, 0x76, 0x58, 0x98, 0xA9, 0xBB, 0x87, 0xFD, 0x22,
-    0xB8, 0x38, 0x22, 0x4F, 0x37, 0x28, 0x03, 0x04, 0x13, 0x2F, 0xE4, 0x03, 0xCA, 0xAB, 0x95, 0x0B,
-    0x4A, 0x79, 0x08, 0x05, 0xBA, 0xD3, 0xD2, 0xBD, 0x17, 0x31, 0xD0, 0x87, 0x10, 0xB3, 0x26, 0xB0,
-    0xFA, 0x5C, 0xFF, 0x9F, 0x86, 0x6E, 0xAA, 0xE8, 0xFF, 0xEF, 0xD0, 0x23, 0xAA, 0x46, 0x5C, 0x8D,
-    0xA4, 0x6F, 0x70, 0x63, 0xB6, 0x33, 0x7D, 0x89, 0xEB, 0x8D, 0xAD, 0x0A, 0x61, 0x07, 0x41, 0xC3,
-    0xE8, 0xB6, 0xA4, 0xBB, 0x46, 0xAE, 0x0A, 0x01, 0x87, 0x87, 0xC9, 0x70, 0x00, 0x00, 0x9B, 0x87,
-    0x0A, 0x37, 0x39, 0xCB, 0x35, 0x57, 0x7E, 0xA2, 0xD4, 0xBB, 0xBC, 0xA2, 0xD3, 0xDC, 0x76, 0xB8,
-    0x40, 0x65, 0x2B, 0xF7, 0x4F, 0xAA, 0xBC, 0x23, 0x44, 0xE3, 0x36, 0x4D, 0x70, 0xEB, 0x96, 0x8D,
-    0xEC, 0xA0, 0xCA, 0xB3, 0xE3, 0xEB, 0x0F, 0xA4, 0xA0, 0x59, 0x6E, 0x07, 0x8E, 0xD1, 0xAC, 0x19,
-    0x3B, 0xA1, 0x47, 0x2D, 0x33, 0x71, 0x24, 0xDE, 0xE8, 0x0F, 0x4D, 0x51, 0x31, 0x68, 0x13, 0x51,
-    0x18, 0xFE, 0x2E, 0x2F, 0xC7, 0x35, 0x5E, 0x92, 0xCB, 0x70, 0x42, 0xC1, 0xEA, 0x9D, 0x90, 0xA1,
-    0x14, 0xCA, 0x39, 0xA6, 0x90, 0xF4, 0x1E, 0xC9, 0xE0, 0xD0, 0x45, 0xA4, 0xA9, 0x0E, 0x0E, 0x05,
-    0xB7, 0x2C, 0x3D, 0xE8, 0x0D, 0x57, 0x88, 0xB9, 0x73, 0x11, 0xD1, 0xC1, 0x8A, 0xBA, 0x4A, 0x83,
-    0x38, 0x74, 0x52, 0xA4, 0x63, 0xA4, 0xE7, 0xA0, 0xC5, 0xA9, 0x27, 0x82, 0x93, 0xC2, 0xA1, 0x85,
-    0xAE, 0x19, 0x22, 0x44, 0xB8, 0xF6, 0xF9, 0x5F, 0x7A, 0xA5, 0xF9, 0x1F, 0x3F, 0xEF, 0xBD, 0xFF,
-    0x7F, 0xFF, 0xF7, 0x7F, 0xFF, 0xF7, 0x3C, 0x74, 0xF1, 0x00, 0x40, 0x69, 0xAE, 0xEE, 0xD2, 0x56,
-    0x83, 0xCD, 0xEB, 0x6E, 0x8D, 0xF1, 0x86, 0xBC, 0x59, 0xE8, 0xFF, 0xDC, 0x19, 0x00, 0x72, 0x67,
-    0x47, 0x88, 0x90, 0x72, 0xB8, 0xBC, 0xD6, 0x12, 0x22, 0xC1, 0xC4, 0x8A, 0x78, 0x13, 0xB8, 0x7E,
-    0xA2, 0x8C, 0xD1, 0x1D, 0x9C, 0xAC, 0x76, 0xD5, 0xA7, 0x61, 0x72, 0xA2, 0x7D, 0xE6, 0xAB, 0x16,
-    0x77, 0x1C, 0x73, 0x41, 0xEF, 0xCC, 0xD2, 0x3B, 0x69, 0x88, 0x3D, 0x0B, 0x5A, 0x2B, 0x96, 0x46,
-    0x69, 0x49, 0x8D, 0xB5, 0x0E, 0xB8, 0xCD, 0x59, 0x40, 0x67, 0x0F, 0x0D, 0x6A, 0xBC, 0x4C, 0xAD,
-    0xAD, 0x34, 0x65, 0xB7, 0xC6, 0x46, 0x90, 0x68, 0xE1, 0x47, 0xFB, 0xD9, 0xF7, 0x61, 0xD2, 0xB3,
-    0xB8, 0xDD, 0xCC, 0x02, 0xB2, 0xE2, 0x2B, 0xB2, 0xE9, 0xF8, 0x8E, 0xD9, 0x7B, 0x7B, 0x69, 0x3F,
-    0xA6, 0xC2, 0x32, 0x58, 0x50, 0x2C, 0xCE, 0x3A, 0xC8, 0x3F, 0x2A, 0x03, 0x8C, 0x7F, 0x13, 0x30,
-    0x86, 0x51, 0x35, 0x9F, 0xCB, 0x1D, 0x99, 0x29, 0xDB, 0x17, 0xE2, 0x94, 0x10, 0x75, 0xA2, 0xA5,
-    0xCB, 0x37, 0xC3, 0x64, 0xA0, 0x1D, 0x46, 0x49, 0x46, 0xC8, 0x9A, 0xA0, 0xDB, 0xBC, 0x32, 0xC3,
-    0x82, 0x19, 0x66, 0x70, 0x89, 0x31, 0x29, 0xB4, 0x39, 0xD7, 0xFF, 0xBC, 0xDE, 0x8A, 0xFD, 0x7F,
-    0xD1, 0x31, 0x71, 0x9B, 0x66, 0x29, 0x45, 0x48, 0xF0, 0x3B, 0x8C, 0xE6, 0xE8, 0x7C, 0x21, 0x08,
-    0xA0, 0x9D, 0xE9, 0xA1, 0x89, 0x4F, 0x6D, 0x3E, 0x1D, 0x57, 0x84, 0xF0, 0xC5, 0xB0, 0xF2, 0xFC,
-    0x1E, 0x9C, 0xA5, 0xF0, 0x58, 0x04, 0xF0, 0xFF, 0x06, 0x3F, 0xD8, 0xDD, 0x92, 0x3F, 0x5A, 0x58,
-    0x7F, 0x7C, 0xFB, 0xFA, 0xCB, 0x87, 0x28, 0x06, 0xE1, 0xDE, 0xFD, 0x29, 0xAC, 0xF5, 0x0F, 0xD4,
-    0x11, 0x0A, 0xC7, 0x7B, 0x9A, 0x6B, 0x62, 0x17, 0x52, 0x66, 0x84, 0xCE, 0x27, 0x9A, 0xD8, 0xDA,
-    0xAE, 0x2D, 0x62, 0x92, 0x52, 0x4B, 0x97, 0xA7, 0x79, 0x86, 0x2E, 0x43, 0x12, 0x5F, 0xDE, 0xF1,
-    0x06, 0x46, 0x12, 0xA7, 0x07, 0x26, 0x6E, 0xC0, 0x5C, 0x7C, 0xB5, 0xF9, 0xB5, 0xFF, 0xAB, 0x9F,
-    0xE4, 0x38, 0x83, 0x82, 0x3C, 0x85, 0x55, 0x72, 0x16, 0xD1, 0x44, 0x23, 0x5C, 0x39, 0xC2, 0xFC,
-    0xB2, 0x1A, 0x6A, 0x1B, 0xE8, 0xAD, 0x1C, 0x1E, 0x34, 0xF7, 0x83, 0x1C, 0x01, 0x62, 0x7C, 0x86,
-    0x6F, 0x44, 0x85, 0xBA, 0x5B, 0xF6, 0xAE, 0x5D, 0x75, 0x95, 0xEC, 0xA3, 0x8D, 0xB8, 0x50, 0x6F,
-    0x94, 0x5C, 0x35, 0xBB, 0x62, 0xF1, 0x16, 0x56, 0x52, 0x6D, 0x50, 0xAD, 0x56, 0x2A, 0xB4, 0x3D,
-    0x21, 0x0F, 0xB7, 0xA0, 0x04, 0xE8, 0xEC, 0x02, 0x1B, 0x62, 0x3B, 0xB7, 0x0D, 0xB5, 0x49, 0x54,
-    0xAA, 0xE4, 0xD2, 0x39, 0x6F, 0x2C, 0x91, 0x36, 0x42, 0xC4, 0xED, 0x76, 0xFB, 0x4E, 0xDA, 0x0E,
-    0x1C, 0xFF, 0x01, 0xBD, 0x5A, 0x4D, 0x6C, 0x1C, 0x47, 0x76, 0x7E, 0xDD, 0x25, 0xAA, 0x37, 0x6A,
-    0x8B, 0xA5, 0x00, 0x12, 0xB2, 0x6B, 0x91, 0xEC, 0x3D, 0xF8, 0x20, 0x2B, 0x24, 0xDB, 0x07, 0x1D,
-    0x18, 0x64, 0x66, 0xBA, 0x25, 0x1D, 0x74, 0x30, 0x02, 0x33, 0x88, 0xE8, 0x45, 0xEC, 0x00, 0xF2,
-    0x21, 0x87, 0xC0, 0x59, 0x58, 0x3C, 0x08, 0xC8, 0x6C, 0xD0, 0xE4, 0xB4, 0xCC, 0xC3, 0x1E, 0xF6,
-    0x20, 0x26, 0xD9, 0x1F, 0x20, 0xBB, 0x07, 0x07, 0xF1, 0x02, 0x5E, 0x3A, 0x89, 0xB8, 0x59, 0x06,
-    0x61, 0xB2, 0x23, 0x4E, 0x4B, 0x0C, 0x20, 0x20, 0x3A, 0xA8, 0x6D, 0xC1, 0x30, 0x10, 0x03, 0xAB,
-    0xB6, 0x6C, 0xC7, 0x88, 0x14, 0x58, 0x25, 0xA9, 0x65, 0xB5, 0xA8, 0x9E, 0xA9, 0x7C, 0xAF, 0x7A,
-    0xF8, 0x27, 0xCB, 0x5E, 0x79, 0x77, 0x91, 0x61, 0x57, 0x4D, 0x4F, 0xB3, 0xBB, 0xAA, 0xFA, 0xD5,
-    0x7B, 0xDF, 0xFB, 0xDE, 0xAB, 0xDA, 0x49, 0x24, 0x43, 0x92, 0x31, 0x0D, 0x84, 0xC4, 0x1F, 0x47,
-    0xEB, 0x13, 0x0B, 0x6F, 0x34, 0xC9, 0xCA, 0xC8, 0x89, 0x69, 0x84, 0xA8, 0xA5, 0x6F, 0xAD, 0x2D,
-    0x7C, 0xDB, 0x9C, 0xE2, 0xAA, 0x32, 0x37, 0xE8, 0x6E, 0x4B, 0xE7, 0xB8, 0xB9, 0xE6, 0x92, 0x1A,
-    0x33, 0x8F, 0x59, 0x5A, 0xBF, 0x7B, 0x7D, 0xA1, 0xBA, 0xC7, 0x3C, 0xE9, 0xE9, 0x72, 0x76, 0xE1,
-    0xEF, 0xD6, 0x1B, 0x89, 0xCC, 0x0D, 0xE6, 0xC9, 0x81, 0xA9, 0x17, 0x5E, 0x93, 0x5A, 0xF7, 0x88,
-    0x14, 0xB7, 0x40, 0xA6, 0x7F, 0x12, 0x29, 0x4E, 0xB8, 0xC9, 0xFA, 0x3E, 0x5C, 0xD0, 0x05, 0x89,
-    0xDC, 0x4D, 0xA8, 0xC0, 0xA5, 0x3A, 0x9E, 0x97, 0x24, 0x62, 0x91, 0x50, 0x86, 0x47, 0x96, 0xA9,
-    0x2E, 0x4A, 0x3C, 0x52, 0x10, 0xB9, 0x44, 0x87, 0xC8, 0x4E, 0xF0, 0xDF, 0xED, 0x1F, 0xAD, 0xEF,
-    0x5C, 0x5F, 0x38, 0x63, 0xDA, 0xCE, 0xB9, 0x61, 0xB4, 0x5F, 0x37, 0xA7, 0x19, 0x79, 0x31, 0xCD,
-    0x92, 0x55, 0x90, 0x83, 0xD3, 0x84, 0xC8, 0xCF, 0xC9, 0x59, 0x2B, 0x69, 0x86, 0x22, 0xDC, 0xB6,
-    0xEC, 0x61, 0x48, 0x4B, 0xD5, 0x50, 0xA4, 0x2E, 0x29, 0xD0, 0x8A, 0x87, 0x88, 0xA7, 0x48, 0x66,
-    0xD6, 0x8A, 0xAF, 0x75, 0x1E, 0x68, 0x9D, 0xB4, 0x74, 0x97, 0x7C, 0x1D, 0x9B, 0x9E, 0xF6, 0xEB,
-    0x79, 0xDC, 0x96, 0x93, 0xBF, 0xF6, 0x06, 0xC9, 0xB4, 0x7A, 0xD4, 0xE2, 0xD7, 0x6A, 0xA0, 0xB8,
-    0xBD, 0x79, 0xA2, 0x0E, 0xEE, 0xDC, 0x89, 0x27, 0xC8, 0xEA, 0xE0, 0x7F, 0x4E, 0xC9, 0x92, 0x0A,
-    0x27, 0x49, 0xA7, 0x2D, 0xAD, 0x55, 0x50, 0x35, 0x99, 0xDB, 0x1A, 0xED, 0xF0, 0xE7, 0xA0, 0x5C,
-    0x55, 0xA5, 0xEF, 0x5E, 0x50, 0xED, 0xAA, 0x92, 0x57, 0xF2, 0x6E, 0x70, 0x26, 0x6B, 0x88, 0xD5,
-    0x6C, 0x26, 0x70, 0xDF, 0x9F, 0x9C, 0x5A, 0x7F, 0xC5, 0x5D, 0x31, 0x41, 0x08, 0x09, 0x2A, 0x48,
-    0xA9, 0xFD, 0x88, 0xAA, 0xCB, 0xE3, 0x41, 0x95, 0x51, 0x8F, 0xEF, 0x17, 0x19, 0x5E, 0x7A, 0x16,
-    0xAF, 0xEF, 0x64, 0x56, 0x8E, 0xF7, 0xF5, 0x42, 0x27, 0xB5, 0x73, 0xDC, 0xEA, 0xE3, 0x66, 0x5B,
-    0x99, 0x13, 0x99, 0x08, 0x25, 0x8A, 0xA0, 0x2B, 0xB5, 0xD0, 0xF4, 0x63, 0x12, 0x5A, 0x63, 0x5E,
-    0xD6, 0xDE, 0xC4, 0xB0, 0x27, 0xE8, 0x14, 0xD1, 0x20, 0x0D, 0xA3, 0x9D, 0xD8, 0xC1, 0xC5, 0xD4,
-    0xFA, 0x28, 0x84, 0xE8, 0x5B, 0x3A, 0xDC, 0x4D, 0xC3, 0x96, 0x72, 0x42, 0x27, 0x94, 0x56, 0x6A,
-    0xA5, 0x22, 0x99, 0xC6, 0xFC, 0xA8, 0x51, 0x1A, 0xA7, 0x48, 0x92, 0x7B, 0xA3, 0x27, 0x13, 0xBC,
-    0x9A, 0x93, 0x52, 0xA7, 0x57, 0x0D, 0x7B, 0x0F, 0xED, 0x20, 0x5A, 0xE2, 0x86, 0x3E, 0x53, 0x8D,
-    0x98, 0xEA, 0x38, 0x04, 0xA6, 0x75, 0xBA, 0xB2, 0xB0, 0x42, 0x39, 0x5F, 0xAB, 0x71, 0x35, 0xBA,
-    0x51, 0x45, 0x4B, 0xE4, 0xBD, 0x59, 0xA2, 0xD2, 0x8A, 0xAB, 0x18, 0xC2, 0xEB, 0x0A, 0x7E, 0xE0,
-    0xE0, 0x37, 0x3E, 0x3A, 0x5E, 0x49, 0xDD, 0x28, 0x52, 0x7D, 0xFD, 0xA4, 0xD1, 0x49, 0xF8, 0x45,
-    0xA0, 0xC5, 0x31, 0x26, 0x5D, 0x41, 0x87, 0x66, 0xA1, 0x16, 0x4E, 0xB6, 0xF5, 0xA4, 0x83, 0x13,
-    0x57, 0x39, 0x7C, 0x32, 0xC3, 0xEA, 0x44, 0xBB, 0xF1, 0xE0, 0x22, 0x1A, 0x48, 0xB6, 0x2A, 0x95,
-    0xAD, 0x64, 0xE2, 0x26, 0xE7, 0xC8, 0x87, 0xEA, 0x14, 0x01, 0x89, 0x6B, 0x39, 0xC9, 0x33, 0x09,
-    0x35, 0xCE, 0x41, 0xDF, 0x32, 0xF4, 0x41, 0xE4, 0x41, 0x25, 0x5B, 0x0A, 0xF3, 0xAB, 0xC8, 0xBD,
-    0xAA, 0xC8, 0xF7, 0x14, 0x95, 0xBE, 0x12, 0x2A, 0xC0, 0x93, 0x81, 0x0A, 0xF8, 0x7F, 0xD4, 0x57,
-    0xF2, 0xF1, 0x6A, 0x0A, 0xD7, 0x3F, 0x4F, 0x1B, 0x8D, 0x11, 0xAA, 0x81, 0x21, 0x06, 0x24, 0xF3,
-    0x80, 0x3C, 0x94, 0x20, 0xF7, 0x69, 0xB6, 0xF0, 0xA9, 0x2C, 0x7C, 0xAB, 0x28, 0xFC, 0xA3, 0xD0,
-    0x8C, 0x63, 0x59, 0xE9, 0x3D, 0x77, 0xBE, 0xF4, 0xCE, 0x9C, 0x2E, 0xBD, 0xB3, 0x56, 0xE9, 0xF5,
-    0xAC, 0x52, 0x96, 0x56, 0x57, 0x16, 0x28, 0xCA, 0xEA, 0xB2, 0xD2, 0xD1, 0x21, 0x27, 0x9C, 0xB6,
-    0x31, 0xA4, 0x4E, 0xB8, 0xD1, 0x7E, 0x93, 0xC6, 0xEA, 0x54, 0xF3, 0x30, 0x29, 0xE1, 0xB2, 0x93,
-    0xE4, 0x22, 0x53, 0xD6, 0x5D, 0xC5, 0xC3, 0x6E, 0x65, 0x14, 0xA4, 0x6C, 0x09, 0x50, 0x25, 0x3F,
-    0xA6, 0x16, 0xFD, 0x6E, 0x0F, 0xDD, 0x52, 0x10, 0xD3, 0x53, 0xB4, 0xCB, 0x23, 0x71, 0x31, 0xA1,
-    0x5B, 0x8A, 0x6A, 0x11, 0xC9, 0x2F, 0xF8, 0xA1, 0xF5, 0x45, 0xE8, 0x32, 0x4B, 0x6C, 0xD4, 0xD8,
-    0xA4, 0x95, 0xF4, 0x8D, 0x80, 0x27, 0x3D, 0xC0, 0x8F, 0x71, 0xBC, 0xB2, 0x7C, 0x05, 0xDA, 0x8F,
-    0x87, 0xEC, 0x0C, 0x3F, 0xF0, 0x62, 0x14, 0x41, 0xE0, 0x0D, 0x18, 0xB8, 0x0C, 0x59, 0x05, 0x9D,
-    0x54, 0xAC, 0x2D, 0x14, 0xC0, 0x08, 0xCD, 0x0A, 0x90, 0x06, 0x44, 0x25, 0x4C, 0x35, 0xC0, 0xB0,
-    0xDC, 0xAC, 0xA5, 0xEF, 0xDF, 0x9D, 0x3A, 0x6A, 0xCC, 0x1C, 0x16, 0x7D, 0x7F, 0x52, 0xE8, 0x52,
-    0x86, 0x51, 0x9D, 0x26, 0x72, 0xBA, 0x93, 0x8A, 0xCB, 0xA1, 0x1F, 0xE8, 0x42, 0xEB, 0x0B, 0x30,
-    0xC3, 0x56, 0x2F, 0x9C, 0xF9, 0x46, 0xDA, 0xA4, 0xC5, 0x26, 0x4D, 0xF3, 0x61, 0xA9, 0x96, 0x8E,
-    0x67, 0xDF, 0xCC, 0x9A, 0x14, 0x35, 0xA9, 0xDE, 0xA4, 0x46, 0x93, 0xCE, 0xB5, 0x74, 0x09, 0xEC,
-    0x6A, 0xB1, 0xEE, 0x94, 0x6B, 0x0B, 0x7F, 0x6F, 0x9A, 0xAD, 0x6F, 0x03, 0x8A, 0x0A, 0x1D, 0xD6,
-    0x81, 0x82, 0x5F, 0x04, 0x46, 0x2C, 0x00, 0x58, 0x12, 0xFD, 0xD7, 0xF0, 0x66, 0xD0, 0x15, 0x91,
-    0x78, 0xF8, 0x19, 0x6D, 0xFD, 0x09, 0xED, 0xA4, 0xDC, 0x52, 0xDE, 0x3B, 0x2F, 0xA6, 0x78, 0x8D,
-    0x0F, 0x50, 0x9E, 0x8D, 0x59, 0xE8, 0x46, 0x14, 0xB0, 0x95, 0xBB, 0x5B, 0x50, 0x34, 0x63, 0x14,
-    0xF5, 0x36, 0x61, 0xD6, 0x33, 0x37, 0x18, 0x84, 0x0C, 0x6D, 0x00, 0x1F, 0xF4, 0x4B, 0xF9, 0x06,
-    0xA6, 0x22, 0x16, 0xC1, 0x79, 0x05, 0x2D, 0x93, 0x97, 0x56, 0xD1, 0x92, 0x7F, 0xB2, 0xC5, 0x52,
-    0x05, 0x40, 0xF2, 0x23, 0xAC, 0xA1, 0x0C, 0x2E, 0x46, 0xE9, 0x18, 0xB5, 0x32, 0x03, 0x7F, 0x06,
-    0xC0, 0xB8, 0x66, 0x59, 0x02, 0x87, 0x74, 0x0B, 0x26, 0xF8, 0x5E, 0xD9, 0x49, 0xDD, 0x9E, 0xAF,
-    0x74, 0xDA, 0x51, 0x9D, 0x54, 0x27, 0x3B, 0xEF, 0xE3, 0x4E, 0x0B, 0xD2, 0x67, 0xA9, 0x02, 0xD6,
-    0x93, 0x97, 0xBB, 0x16, 0xEE, 0xC6, 0x0B, 0x43, 0x12, 0x18, 0xD3, 0xF8, 0x4B, 0xF6, 0x5D, 0x9E,
-    0xDA, 0xEE, 0x4E, 0x1D, 0xFF, 0x06, 0x15, 0x94, 0x44, 0x38, 0x04, 0xD3, 0x42, 0x9F, 0x3C, 0x64,
-    0x3F, 0xDE, 0x86, 0xDC, 0x90, 0xFE, 0x64, 0xD5, 0x8F, 0xDB, 0xEF, 0xC7, 0x7F, 0xA8, 0x9F, 0xFC,
-    0xB1, 0xFA, 0x61, 0x09, 0xFA, 0x8C, 0x6F, 0x5E, 0x2C, 0x32, 0x00, 0xE5, 0x77, 0x52, 0x6A, 0x40,
-    0xA7, 0xD6, 0x30, 0xCB, 0xC0, 0x63, 0x09, 0x14, 0x86, 0xE6, 0x5B, 0x10, 0x9F, 0x83, 0xE2, 0xB7,
-    0x80, 0x99, 0x2D, 0x80, 0x5F, 0x27, 0x91, 0x89, 0xC6, 0x93, 0x3A, 0x29, 0xF1, 0x3F, 0x47, 0x77,
-    0xF9, 0x48, 0xEA, 0x1B, 0x87, 0x5B, 0x1D, 0x71, 0x5D, 0x56, 0x47, 0x88, 0x63, 0x06, 0xA0, 0xD1,
-    0x03, 0x6E, 0x60, 0x4E, 0xA0, 0x2E, 0xD0, 0x91, 0x0F, 0x4A, 0x6A, 0x9D, 0x59, 0x16, 0xBF, 0xA8,
-    0x29, 0xD9, 0xBC, 0x93, 0xFE, 0xDB, 0x9D, 0x4B, 0xAB, 0x17, 0x2F, 0x4B, 0xDF, 0xAB, 0x35, 0xF2,
-    0x48, 0x75, 0xCE, 0xDF, 0x4B, 0xB4, 0x7B, 0x55, 0xE4, 0x7E, 0xB4, 0x33, 0x3E, 0xA7, 0xC8, 0xBE,
-    0x87, 0xC9, 0x4D, 0x06, 0xF0, 0xD2, 0x98, 0x85, 0x62, 0x4B, 0x29, 0xD7, 0x4B, 0xB0, 0xB5, 0x68,
-    0xBD, 0xBD, 0x84, 0xD6, 0x7A, 0xE9, 0x06, 0x31, 0x84, 0xBB, 0xBF, 0x17, 0x42, 0x33, 0xE0, 0xB8,
-    0xE2, 0x20, 0x09, 0x62, 0x51, 0xB0, 0x05, 0xB9, 0x98, 0xCB, 0x2B, 0x10, 0x74, 0x01, 0x85, 0x09,
-    0x20, 0x5E, 0xF7, 0x72, 0x48, 0xF6, 0x1D, 0xA8, 0x49, 0x01, 0x21, 0x34, 0x20, 0xFE, 0xE0, 0x58,
-    0xEF, 0xFB, 0x9D, 0x04, 0xDA, 0xAA, 0x60, 0xC8, 0x0A, 0x16, 0x98, 0xC3, 0x5F, 0xCD, 0xAF, 0x4F,
-    0x88, 0xB1, 0x96, 0x32, 0x62, 0x43, 0xAF, 0xFF, 0xD2, 0xC3, 0xD3, 0xF3, 0x50, 0x6B, 0xF8, 0x03,
-    0x85, 0x07, 0xE0, 0x4F, 0x9E, 0x4D, 0xC4, 0x05, 0xFC, 0xE8, 0xE8, 0xC2, 0xD7, 0x85, 0xBC, 0x3E,
-    0x29, 0x30, 0x8E, 0x92, 0x05, 0xC5, 0x70, 0xC3, 0x3F, 0xA0, 0x0F, 0x41, 0x68, 0x1C, 0x67, 0xE5,
-    0x4D, 0x7B, 0x70, 0xAC, 0x4A, 0xDE, 0xFF, 0x63, 0x81, 0xC1, 0xCE, 0x9A, 0xBB, 0xE0, 0xAC, 0xE0,
-    0x99, 0xCC, 0xCD, 0x41, 0xFF, 0x2B, 0x26, 0x01, 0x60, 0xF1, 0xF5, 0x82, 0xC2, 0xA0, 0x5D, 0x8C,
-    0x19, 0x8E, 0x99, 0x4E, 0x9A, 0x21, 0xEF, 0x9B, 0x9A, 0x3A, 0xCE, 0x2E, 0x81, 0xCB, 0x1E, 0xD1,
-    0xF7, 0xC7, 0x1B, 0x25, 0xAB, 0x8A, 0xF3, 0x39, 0xC5, 0x55, 0x9B, 0xE5, 0x57, 0x82, 0xCC, 0x3E,
-    0x7B, 0x4A, 0x47, 0x44, 0xB2, 0x3C, 0x21, 0x92, 0xD1, 0x67, 0x44, 0x32, 0x7C, 0xCA, 0x49, 0x86,
-    0x6B, 0x50, 0x9D, 0xE0, 0xE6, 0x83, 0x52, 0x56, 0x9E, 0x3E, 0x86, 0xA9, 0xD1, 0x66, 0x49, 0x37,
-    0xCA, 0xAE, 0x90, 0x9E, 0x04, 0x58, 0xC8, 0x10, 0xDA, 0x1F, 0x8B, 0x14, 0xFF, 0x6D, 0x33, 0x26,
-    0xC1, 0xEA, 0xAD, 0x35, 0x7E, 0x71, 0x08, 0x05, 0xCC, 0xA7, 0x82, 0x55, 0x26, 0x13, 0x2D, 0x96,
-    0xE5, 0xC9, 0x84, 0x82, 0xD5, 0x1C, 0xE3, 0x69, 0xC1, 0xD7, 0x4B, 0x25, 0x15, 0xF5, 0x5C, 0xF0,
-    0x11, 0x16, 0xE9, 0x20, 0x0D, 0x82, 0x35, 0xC5, 0x8A, 0xB2, 0x1A, 0x4D, 0x48, 0xFC, 0x48, 0x9C,
-    0x58, 0x59, 0xF8, 0xD1, 0x04, 0x58, 0x39, 0x89, 0x73, 0x5A, 0x59, 0x98, 0xA8, 0xC8, 0x9B, 0x3A,
-    0x79, 0x4C, 0xEB, 0x5B, 0x50, 0x28, 0x62, 0x2C, 0x84, 0xE5, 0xDB, 0x8C, 0x22, 0x87, 0x68, 0xE2,
-    0x14, 0xD5, 0xAA, 0xA3, 0xC9, 0x07, 0x20, 0xB4, 0x5D, 0x83, 0x16, 0xFE, 0xB0, 0xF4, 0x74, 0xDB,
-    0xB9, 0x1F, 0x31, 0xA9, 0xDB, 0x3C, 0x00, 0x73, 0xBB, 0xE0, 0x14, 0x22, 0xE9, 0x59, 0xAA, 0x06,
-    0x6C, 0xBF, 0xA5, 0x24, 0x7E, 0xD6, 0x5C, 0x0F, 0x74, 0x20, 0x12, 0xC9, 0x4F, 0x95, 0xB4, 0x37,
-    0x7F, 0xC6, 0x3F, 0xBD, 0x7B, 0xE2, 0xF9, 0x55, 0x4C, 0x9F, 0x34, 0xBD, 0xC2, 0x75, 0xD2, 0x6B,
-    0x90, 0x52, 0x24, 0x01, 0x9F, 0x22, 0xC1, 0xD3, 0x0A, 0xF7, 0xE1, 0x42, 0x0D, 0x17, 0xA4, 0x9D,
-    0x34, 0x45, 0xB2, 0x38, 0x82, 0x07, 0x9D, 0xB8, 0xE6, 0x5A, 0x99, 0xB9, 0x10, 0x2F, 0x7A, 0xDF,
-    0xBB, 0xBB, 0x72, 0x94, 0xD5, 0x56, 0x57, 0x6D, 0x8C, 0xB0, 0xF3, 0x5B, 0x27, 0x92, 0xFC, 0x71,
-    0xE1, 0x92, 0x3B, 0xCA, 0xBC, 0x13, 0xF5, 0xBF, 0xEE, 0x4E, 0x1A, 0x88, 0x04, 0x60, 0x4B, 0x90,
-    0x0E, 0x08, 0x06, 0x52, 0x21, 0x65, 0x67, 0xF2, 0x46, 0x17, 0x58, 0x18, 0x4B, 0x9D, 0xEE, 0x41,
-    0x03, 0xB7, 0x13, 0x06, 0x5B, 0xB6, 0x68, 0x26, 0xA7, 0x25, 0x53, 0xC0, 0x3B, 0x7C, 0xE9, 0x32,
-    0xD8, 0x57, 0x10, 0x60, 0xFE, 0x4A, 0x46, 0xFC, 0x3B, 0x09, 0x48, 0xCF, 0x65, 0x3C, 0x8F, 0xBB,
-    0x26, 0x70, 0xC9, 0xCE, 0xC4, 0x9D, 0x35, 0x1D, 0xCA, 0xAB, 0x80, 0xE6, 0x00, 0xCC, 0x88, 0xBA,
-    0x7B, 0xD8, 0x19, 0x2E, 0x72, 0xC7, 0x8A, 0xAB, 0xBB, 0x93, 0xE8, 0x5B, 0x39, 0x97, 0x69, 0x58,
-    0xD1, 0x4D, 0x1A, 0x54, 0xF6, 0xCD, 0x1B, 0x5D, 0xAD, 0xCF, 0x00, 0x72, 0x4F, 0x66, 0x24, 0xAF,
-    0x17, 0xF0, 0x3B, 0x05, 0x88, 0x9B, 0xAA, 0x19, 0xF9, 0xB3, 0x6E, 0xC8, 0x3E, 0x0D, 0xCD, 0xAB,
-    0xB7, 0xF2, 0xBC, 0x79, 0x8B, 0x0D, 0x9F, 0xDF, 0x38, 0xD4, 0xE8, 0x06, 0xEE, 0x8E, 0x5F, 0x74,
-    0x2F, 0xED, 0x83, 0x8D, 0x74, 0x0A, 0x27, 0x59, 0x76, 0xCF, 0xC3, 0xD7, 0x2D, 0x35, 0x6B, 0xE4,
-    0x8D, 0x80, 0x32, 0x5F, 0x84, 0xBF, 0xB9, 0xF5, 0x7E, 0x46, 0x63, 0x33, 0x4B, 0xE4, 0x9E, 0xE8,
-    0xE1, 0xC2, 0x0F, 0xE1, 0xB5, 0xDF, 0x07, 0x2C, 0x9E, 0x0A, 0x4E, 0xAF, 0x0C, 0xC3, 0x76, 0x1C,
-    0xB4, 0x73, 0x38, 0xDD, 0xD9, 0x63, 0x26, 0x8B, 0xCE, 0x72, 0x1B, 0x5C, 0xAE, 0x46, 0x50, 0x5A,
-    0x27, 0x6C, 0x52, 0x13, 0x5F, 0x71, 0x10, 0x36, 0x81, 0x09, 0xB1, 0xA3, 0x01, 0x89, 0x8C, 0x8D,
-    0x25, 0x64, 0x97, 0x94, 0x54, 0xCA, 0x44, 0x9E, 0xC7, 0x97, 0x9F, 0x78, 0xAB, 0x65, 0x85, 0xEB,
-    0x9D, 0xE3, 0x70, 0xCC, 0x6E, 0x5C, 0x0E, 0x52, 0x34, 0x44, 0xB5, 0x51, 0xAA, 0xD5, 0xA8, 0x5E,
-    0xA3, 0x19, 0xFF, 0x48, 0x4F, 0xEA, 0x9E, 0xAB, 0x3F, 0xB1, 0x56, 0x9E, 0x23, 0xD0, 0xBF, 0x93,
-    0xB9, 0xD0, 0x19, 0x1C, 0xED, 0x98, 0xF1, 0x3B, 0xCD, 0x0E, 0x88, 0x70, 0xD1, 0x3A, 0xDD, 0x9D,
-    0xA5, 0x46, 0x9D, 0x01, 0x2A, 0x00, 0xD4, 0xCB, 0x07, 0xA5, 0x83, 0x97, 0xEE, 0xC4, 0x41, 0x97,
-    0xEE, 0xBE, 0x22, 0xE2, 0xD1, 0x41, 0x9A, 0x86, 0x41, 0xE9, 0x52, 0x5C, 0x6F, 0x0F, 0x52, 0x6D,
-    0x82, 0x16, 0x33, 0xB1, 0xFA, 0x4E, 0x07, 0x51, 0x02, 0x66, 0xE3, 0xE0, 0xC2, 0xDF, 0xE8, 0x5E,
-    0x8D, 0xC9, 0x9A, 0xA9, 0x66, 0xD8, 0x92, 0x4C, 0x35, 0x6B, 0xAC, 0xFA, 0xE0, 0x1B, 0xB0, 0xC9,
-    0x94, 0x16, 0xEB, 0xE4, 0x42, 0x86, 0xAA, 0x4E, 0xB2, 0xFA, 0x1A, 0x17, 0x60, 0xAB, 0x75, 0x2A,
-    0x44, 0x06, 0x89, 0x42, 0x15, 0xCB, 0x31, 0x12, 0xA7, 0x53, 0xF0, 0xDC, 0xBD, 0x64, 0x63, 0x16,
-    0x0F, 0xA7, 0xA3, 0xE0, 0x0F, 0x03, 0xCB, 0x1D, 0x5D, 0xFE, 0xFB, 0x8F, 0x43, 0xA8, 0xC0, 0xB2,
-    0x41, 0x24, 0x5F, 0xE7, 0x90, 0x92, 0xA1, 0xF2, 0xAC, 0xB5, 0x76, 0x16, 0x01, 0x61, 0xE7, 0x32,
-    0xAA, 0x8F, 0x33, 0xA3, 0x29, 0x30, 0x51, 0x0F, 0x6E, 0x02, 0x08, 0x58, 0x21, 0x6D, 0xF6, 0xBF,
-    0x4C, 0x0B, 0x31, 0x81, 0x54, 0x71, 0x50, 0xF4, 0x04, 0xEC, 0xEA, 0x6A, 0x0A, 0x2E, 0xE5, 0x5A,
-    0x74, 0xFD, 0xF7, 0x35, 0x1B, 0xEA, 0x9F, 0xD2, 0x13, 0x74, 0x00, 0x3C, 0xFD, 0x14, 0xE8, 0xD3,
-    0xE8, 0x9E, 0xA8, 0x93, 0xB7, 0xB8, 0xF5, 0x53, 0x98, 0x24, 0xAB, 0x3C, 0x25, 0xFE, 0xF7, 0x94,
-    0xFC, 0x66, 0x73, 0x64, 0xB4, 0x59, 0x1B, 0x6D, 0xE6, 0xB5, 0x6F, 0x65, 0xB5, 0x56, 0x52, 0x6B,
-    0x85, 0xB5, 0x59, 0xC3, 0x70, 0x9D, 0x1F, 0x86, 0x2C, 0xFA, 0xAF, 0xD3, 0x63, 0xDE, 0xAF, 0xEA,
-    0xE2, 0x42, 0x06, 0xF2, 0x56, 0xCB, 0xE9, 0x41, 0x8C, 0x50, 0xC4, 0x03, 0x49, 0x4C, 0xED, 0x1B,
-    0x99, 0x7B, 0x26, 0xAB, 0xCB, 0x2C, 0x97, 0x6A, 0x60, 0x4A, 0xE8, 0x44, 0x4D, 0xD7, 0x86, 0x06,
-    0x1D, 0xF1, 0x6A, 0x92, 0x2D, 0x1E, 0x1A, 0x1D, 0x76, 0xDD, 0x23, 0x17, 0x93, 0xC5, 0xCA, 0xA2,
-    0x10, 0x3F, 0x1C, 0x2E, 0xA9, 0xEB, 0xE4, 0xA2, 0xF0, 0x95, 0x9F, 0xFD, 0x3C, 0x7D, 0xF0, 0xEA,
-    0xD5, 0x6F, 0x5F, 0x75, 0x4F, 0x36, 0xDA, 0x63, 0x8D, 0xDB, 0x2A, 0xEF, 0x5C, 0x5A, 0x7D, 0xBF,
-    0xEB, 0xCB, 0x39, 0x55, 0x36, 0x9C, 0xB9, 0x1C, 0xCC, 0x2E, 0xAD, 0x6D, 0xA7, 0x8A, 0x9E, 0xC7,
-    0x14, 0xD0, 0x02, 0xAB, 0x40, 0xF8, 0xA8, 0x4F, 0x6A, 0xFD, 0x5E, 0x6A, 0x7D, 0x9A, 0xD3, 0x0A,
-    0x48, 0x75, 0x6C, 0xAD, 0x84, 0xEE, 0x7B, 0xD9, 0x08, 0xAB, 0x3F, 0xD4, 0x97, 0x11, 0x27, 0x62,
-    0x0D, 0x8A, 0x82, 0xA9, 0x02, 0x64, 0xDF, 0xD5, 0x99, 0xD5, 0x0B, 0xF7, 0x4D, 0x4D, 0xAE, 0x3B,
-    0xA3, 0x87, 0x8E, 0x68, 0xE3, 0xD8, 0xB1, 0x7F, 0xDE, 0x39, 0xDB, 0xB3, 0xB4, 0x0D, 0x5D, 0x9D,
-    0x90, 0x31, 0x66, 0xDB, 0x4E, 0x0A, 0x5A, 0x0C, 0xA8, 0x26, 0x33, 0x0F, 0xE8, 0x7C, 0x04, 0x5A,
-    0x5C, 0xE8, 0xB8, 0x6E, 0xA2, 0x4E, 0x18, 0x99, 0x5D, 0xF9, 0xA4, 0xFE, 0xE7, 0x64, 0xE6, 0x69,
-    0xF8, 0x88, 0x36, 0x23, 0x49, 0xCE, 0x77, 0x2C, 0x13, 0x1C, 0x68, 0xF0, 0x5F, 0x96, 0x2E, 0xEC,
-    0x7E, 0xC8, 0xD7, 0xD2, 0xBD, 0xBD, 0xB5, 0x7D, 0xAC, 0xBB, 0x5B, 0x8F, 0xFA, 0xE6, 0xB1, 0xC4,
-    0xE3, 0xAE, 0x8D, 0x53, 0x53, 0x52, 0xEE, 0xC6, 0xB9, 0xF3, 0x96, 0x12, 0xB7, 0x95, 0x75, 0x2F,
-    0x43, 0xCC, 0x47, 0x60, 0x1A, 0x81, 0x71, 0x1B, 0x7E, 0xC8, 0x7C, 0x01, 0x9E, 0x03, 0xF6, 0x9D,
-    0xD1, 0x41, 0x32, 0xD1, 0x06, 0x3B, 0x07, 0x79, 0x53, 0xE7, 0x63, 0xA0, 0x47, 0x87, 0x44, 0x32,
-    0xC4, 0x0E, 0x64, 0x1A, 0x0E, 0x64, 0xC2, 0x49, 0xC6, 0x1A, 0xC7, 0xDE, 0x6A, 0xC3, 0xD1, 0xB1,
-    0x13, 0x51, 0xDB, 0x9D, 0x48, 0xDF, 0x81, 0x58, 0x21, 0x8C, 0x6B, 0x87, 0x00, 0xB2, 0x2D, 0xB9,
-    0xA1, 0xC4, 0x7F, 0x80, 0x59, 0x5E, 0xCA, 0x2E, 0xD3, 0xEE, 0x92, 0x75, 0x2F, 0xB1, 0xF2, 0x36,
-    0x15, 0x6C, 0xBA, 0xC5, 0x5E, 0x9A, 0xF4, 0x68, 0xCC, 0x49, 0xDC, 0x50, 0xD9, 0x98, 0xA2, 0x53,
-    0xC0, 0x42, 0xB8, 0x86, 0x50, 0x59, 0xD5, 0x8F, 0x11, 0x61, 0x20, 0xA6, 0x64, 0x54, 0x66, 0x6F,
-    0x60, 0xCD, 0x87, 0x5F, 0x49, 0x87, 0xAA, 0xBF, 0xAC, 0x36, 0x5B, 0xFA, 0x3F, 0xA2, 0x21, 0xFC,
-    0x8D, 0xEE, 0x25, 0xFA, 0x43, 0xC0, 0xF5, 0x06, 0xE6, 0x3F, 0x0C, 0xF2, 0xE6, 0xE7, 0x3A, 0xC8,
-    0xE3, 0xE6, 0x49, 0xC6, 0xF5, 0x8D, 0x02, 0x48, 0x7F, 0x44, 0x59, 0x82, 0x89, 0xE8, 0xC0, 0x24,
-    0x07, 0x4C, 0x30, 0x57, 0xEF, 0x97, 0xBD, 0x10, 0x92, 0x2C, 0xCC, 0x88, 0x38, 0x2A, 0x03, 0xF6,
-    0xD5, 0x76, 0xA6, 0xA0, 0xE3, 0xFC, 0xBA, 0x0A, 0x64, 0x4F, 0xA7, 0x52, 0xC7, 0xE8, 0xE3, 0xB7,
-    0xF1, 0xB6, 0xAB, 0xE0, 0x54, 0x80, 0xDB, 0x51, 0xCC, 0xCA, 0xA2, 0xBE, 0x8F, 0x9F, 0x63, 0xF8,
-    0x39, 0x8A, 0x39, 0x59, 0x54, 0xCA, 0x59, 0x5D, 0xD5, 0x3D, 0xF9, 0x9C, 0x9E, 0xAF, 0xEF, 0x01,
-    0x0F, 0x05, 0x6E, 0x8B, 0x98, 0x2B, 0x9D, 0x4D, 0xEC, 0xBC, 0x18, 0xCB, 0x26, 0xDD, 0x8B, 0xFD,
-    0x16, 0x48, 0x38, 0xFB, 0x3F, 0xE0, 0x69, 0xD8, 0x36, 0xAE, 0x2D, 0xB7, 0x9E, 0xCF, 0xD0, 0x3C,
-    0x07, 0x6D, 0x77, 0x3F, 0x3C, 0xF9, 0x6D, 0x5D, 0xEE, 0x34, 0xB8, 0x2B, 0x92, 0x56, 0x5A, 0x1B,
-    0x76, 0xE7, 0x56, 0xE3, 0xD1, 0xDA, 0x34, 0x5D, 0xB9, 0x44, 0x83, 0x13, 0x8A, 0x3E, 0xD0, 0x34,
-    0x58, 0x57, 0x74, 0xE5, 0x3B, 0xF1, 0xD8, 0x44, 0xEB, 0xEC, 0xEA, 0x9C, 0xCE, 0x27, 0x9C, 0xFB,
-    0x68, 0x2C, 0xDF, 0x6D, 0xA7, 0xD3, 0xEE, 0xE1, 0x64, 0x4C, 0xAC, 0x01, 0xFF, 0xD2, 0xBA, 0x7B,
-    0x38, 0x1B, 0xC3, 0x4C, 0x2D, 0xDB, 0x57, 0x30, 0x0D, 0x3B, 0x43, 0x03, 0xF9, 0xE8, 0x6D, 0xDF,
-    0x16, 0x2E, 0xFC, 0xD8, 0x40, 0x24, 0x79, 0xD6, 0x4E, 0xF1, 0x23, 0x3B, 0xC8, 0xF9, 0x7E, 0xB6,
-    0x9B, 0x4E, 0x01, 0x48, 0x02, 0xE6, 0x88, 0x65, 0xD3, 0x28, 0x27, 0x24, 0xE9, 0x5F, 0x6F, 0x4B,
-    0x86, 0xF0, 0x0F, 0xF9, 0xB6, 0x25, 0x32, 0x61, 0xAE, 0x7B, 0x1C, 0x90, 0xAF, 0x68, 0x9F, 0xAA,
-    0x84, 0x2A, 0x41, 0x6B, 0x02, 0xBC, 0x7A, 0x0F, 0xB4, 0x2D, 0x73, 0x43, 0x0F, 0x1E, 0x32, 0x22,
-    0x84, 0x50, 0x56, 0x86, 0xF0, 0x2C, 0xF6, 0xE1, 0x60, 0xDB, 0xD4, 0xB6, 0x95, 0x9D, 0xCB, 0x04,
-    0xC0, 0x61, 0x03, 0xCF, 0x40, 0x34, 0xE8, 0x6B, 0x15, 0xA5, 0x37, 0x7E, 0xCE, 0xE2, 0xD1, 0x7C,
-    0x31, 0x1E, 0x5B, 0x2B, 0x34, 0xE6, 0x86, 0xA9, 0xEB, 0xD2, 0x8E, 0xFA, 0x71, 0xD2, 0x39, 0xE4,
-    0x2F, 0xC3, 0xBD, 0xFE, 0xCD, 0x3C, 0xD0, 0x89, 0xCF, 0x31, 0x8D, 0xAD, 0x4F, 0xAF, 0xBD, 0x6E,
-    0x9E, 0x84, 0x89, 0xE8, 0x79, 0x0B, 0xF1, 0xFB, 0xEC, 0x0E, 0x71, 0x5B, 0xF7, 0x3A, 0xFA, 0x6D,
-    0xFD, 0x61, 0xD4, 0xEE, 0x22, 0xCC, 0xDF, 0x33, 0xC1, 0x9F, 0x66, 0x33, 0x8A, 0xDA, 0xED, 0x01,
-    0x2B, 0x6C, 0xCB, 0x57, 0x55, 0x20, 0xDF, 0xEA, 0x5B, 0xB1, 0xC5, 0xC4, 0x07, 0x93, 0x4A, 0x19,
-    0x4F, 0xEE, 0xE0, 0x7A, 0xB8, 0x95, 0xB0, 0xEE, 0xB4, 0x8D, 0xB9, 0xD7, 0x21, 0x90, 0xD9, 0xBE,
-    0xA8, 0x0F, 0x70, 0x48, 0xF7, 0xD0, 0xDF, 0x84, 0xF9, 0x5B, 0xB6, 0xF2, 0x40, 0x75, 0x62, 0xE6,
-    0x11, 0x09, 0x1D, 0x70, 0x88, 0x5E, 0x1B, 0x22, 0x3B, 0x9C, 0xA6, 0xDF, 0xB2, 0x74, 0xFC, 0x94,
-    0x23, 0xE2, 0x74, 0x48, 0x88, 0x70, 0xFA, 0x89, 0x27, 0xAC, 0x64, 0x71, 0xDA, 0xD1, 0x73, 0x31,
-    0x47, 0xFF, 0x9C, 0xE0, 0x20, 0x87, 0x9E, 0xA1, 0x69, 0x11, 0x3A, 0x60, 0x50, 0xFC, 0x05, 0xD2,
-    0x37, 0x2D, 0x0E, 0x5F, 0xA4, 0x43, 0xBB, 0xF0, 0xEB, 0x63, 0x0A, 0xBA, 0xD3, 0x02, 0xE4, 0x60,
-    0xC9, 0x44, 0xCA, 0xF4, 0x2F, 0x21, 0x7C, 0xA6, 0x99, 0x01, 0xA6, 0x27, 0x77, 0xBA, 0x26, 0xF3,
-    0x85, 0x09, 0x90, 0xF1, 0x18, 0x04, 0x9F, 0x82, 0xA7, 0xB1, 0xFC, 0x21, 0x7B, 0xDB, 0x7C, 0xF9,
-    0x10, 0x3F, 0xE2, 0xA2, 0x80, 0x7B, 0xC2, 0x3B, 0xF1, 0xE4, 0x5A, 0x59, 0x9F, 0xED, 0xC0, 0x94,
-    0x61, 0x77, 0x0A, 0xF1, 0xB0, 0x5C, 0x06, 0xCE, 0x00, 0x5B, 0xDC, 0x2E, 0x8D, 0x77, 0x69, 0xB9,
-    0x27, 0xD2, 0x9E, 0x3C, 0xAC, 0x59, 0x1A, 0x1C, 0x8A, 0xCE, 0x18, 0x11, 0xD1, 0x63, 0xF9, 0x0C,
-    0xF9, 0xFA, 0xF4, 0x6E, 0x9A, 0x76, 0x29, 0xE5, 0x21, 0x2F, 0x6F, 0x8B, 0xD4, 0x7E, 0x35, 0x94,
-    0x7B, 0xCD, 0x8E, 0xC0, 0x7D, 0x7E, 0x3F, 0x19, 0x54, 0xA2, 0xBD, 0x7E, 0x72, 0x6E, 0xEA, 0xA6,
-    0x2E, 0x04, 0x51, 0x02, 0xB9, 0x55, 0x1C, 0x0E, 0x10, 0x8D, 0x03, 0x27, 0xFD, 0x03, 0x21, 0xAC,
-    0xCE, 0xDD, 0x74, 0xCC, 0x4D, 0x06, 0xDD, 0xC4, 0x75, 0x3E, 0x3A, 0xE9, 0xE8, 0x9E, 0x40, 0xD8,
-    0x6B, 0x82, 0x60, 0x3B, 0x36, 0xF4, 0x0E, 0x6A, 0x7E, 0x62, 0x0A, 0xE0, 0x9C, 0x92, 0x99, 0x61,
-    0x08, 0x72, 0x5E, 0xDC, 0x7D, 0x85, 0x0A, 0x0B, 0x4E, 0xFE, 0x90, 0x8C, 0x87, 0xC5, 0x5A, 0x27,
-    0xEC, 0xE8, 0x84, 0x15, 0x7E, 0x2A, 0xF4, 0xAB, 0xC8, 0x41, 0x27, 0x3D, 0xF8, 0x40, 0x30, 0x99,
-    0x14, 0x7C, 0x26, 0x35, 0x51, 0x22, 0x0F, 0xDF, 0x02, 0xFC, 0xD8, 0xD7, 0xAE, 0x65, 0x56, 0xB6,
-    0x3C, 0x46, 0x6A, 0x1C, 0x60, 0xEC, 0xC6, 0x6A, 0xC4, 0x82, 0xC1, 0x22, 0x14, 0x58, 0x4D, 0x7C,
-    0xCA, 0x11, 0x67, 0xF8, 0xC0, 0x91, 0xB0, 0x2D, 0xCE, 0x2B, 0x60, 0x86, 0xD5, 0x89, 0x9D, 0x3F,
-    0x99, 0x1E, 0x1C, 0x9A, 0x18, 0x1A, 0x1A, 0x1A, 0x1D, 0xDA, 0x3D, 0x31, 0x24, 0xAD, 0x49, 0x9A,
-    0x44, 0x94, 0xA9, 0x7C, 0x8F, 0x9D, 0xEE, 0x5B, 0xAA, 0xEE, 0xEB, 0xF4, 0x69, 0xA6, 0x51, 0xBD,
-    0xB3, 0x29, 0xA7, 0xD9, 0xBC, 0xB0, 0x0A, 0xF3, 0x30, 0x93, 0x6D, 0x2E, 0x7E, 0x55, 0x4A, 0x2F,
-    0x75, 0x0A, 0x46, 0x78, 0x0E, 0x23, 0x2C, 0xCE, 0xBF, 0x19, 0x9B, 0x20, 0x51, 0x38, 0xF6, 0x85,
-    0xB7, 0x93, 0x5B, 0x9D, 0xEC, 0x77, 0x60, 0x32, 0x99, 0x67, 0x65, 0x76, 0x86, 0x09, 0x18, 0x23,
-    0x29, 0x43, 0xB8, 0x74, 0x4B, 0xCD, 0x58, 0x05, 0x53, 0x45, 0xC8, 0xC4, 0x2D, 0xB6, 0x4C, 0xD2,
-    0x8A, 0x71, 0x58, 0x6C, 0x95, 0x1E, 0x5B, 0x87, 0xD0, 0x47, 0xE6, 0xF9, 0xA2, 0xCF, 0xA1, 0x15,
-    0x22, 0x2B, 0x1C, 0x08, 0x62, 0xB8, 0x7F, 0x76, 0x13, 0xB0, 0xCE, 0x73, 0x1C, 0x65, 0x71, 0x6C,
-    0x96, 0x5B, 0x0C, 0xFF, 0x20, 0x7F, 0x18, 0x13, 0x07, 0x5D, 0x32, 0xED, 0x70, 0x73, 0x26, 0xC5,
-    0x79, 0xAB, 0x34, 0x9C, 0x26, 0x61, 0x5B, 0xE5, 0x5C, 0x96, 0xA7, 0x4D, 0xCE, 0x55, 0x99, 0x8C,
-    0xE7, 0x46, 0xD7, 0x07, 0xF6, 0x92, 0x9C, 0x4B, 0x2C, 0x35, 0x46, 0x63, 0x56, 0xC6, 0x30, 0x1D,
-    0xB1, 0x5F, 0x02, 0xF2, 0x73, 0x64, 0x28, 0x3E, 0xC8, 0xC8, 0x03, 0xDC, 0xA1, 0x11, 0x46, 0x75,
-    0x6E, 0x7B, 0x98, 0x86, 0x5B, 0x5D, 0xAE, 0x39, 0x1B, 0x88, 0xC9, 0xBC, 0xA3, 0xF5, 0xE5, 0x85,
-    0x05, 0x93, 0x99, 0xD8, 0x9A, 0xC1, 0x4D, 0x39, 0x53, 0xBD, 0x91, 0xC1, 0xE5, 0xF0, 0xCB, 0xB0,
-    0x7B, 0x79, 0x70, 0x01, 0x0F, 0x7C, 0x2E, 0xEA, 0x40, 0xA4, 0x72, 0x61, 0x41, 0x1A, 0x2B, 0x43,
-    0x53, 0x70, 0xE1, 0x38, 0xBC, 0xB8, 0x9F, 0xF8, 0xF6, 0xB6, 0x1E, 0x89, 0x89, 0x1C, 0x2E, 0x24,
-    0x00, 0xB4, 0x8E, 0x96, 0xDF, 0x3B, 0x0A, 0x42, 0x8E, 0x26, 0x25, 0xF7, 0x1C, 0x18, 0x57, 0x06,
-    0xF7, 0xD2, 0xD7, 0x37, 0x59, 0xE1, 0x66, 0x7E, 0x9C, 0x61, 0x53, 0xA6, 0xB3, 0x60, 0x94, 0x50,
-    0x87, 0xA5, 0x88, 0x86, 0xC1, 0x73, 0x8E, 0x25, 0x98, 0x76, 0x09, 0x3F, 0x97, 0xD1, 0xCB, 0x73,
-    0xFA, 0x0F, 0x00, 0x28, 0x99, 0xD0, 0xCF, 0x89, 0xA6, 0x9B, 0x7A, 0xA7, 0x3F, 0x41, 0x73, 0x4A,
-    0x26, 0x3C, 0xB4, 0x06, 0xA4, 0x2B, 0x13, 0x8E, 0xD4, 0xE5, 0x6A, 0x06, 0xC1, 0xFA, 0xCF, 0x5D,
-    0x4A, 0x39, 0xCA, 0x98, 0x35, 0x4C, 0x43, 0x99, 0x6C, 0x0E, 0xF3, 0x0E, 0x13, 0xE2, 0x18, 0x4A,
-    0x09, 0x79, 0x27, 0x26, 0xDD, 0x9E, 0xF0, 0x29, 0x6A, 0x4E, 0x9A, 0x41, 0x8E, 0x0F, 0x7A, 0xA8,
-    0xF5, 0xE5, 0x02, 0x3A, 0x5E, 0x06, 0xB7, 0x60, 0x41, 0xA9, 0xBE, 0x50, 0x51, 0x96, 0x51, 0x33,
-    0x21, 0x86, 0xC3, 0x59, 0xE6, 0x82, 0x33, 0x77, 0x3E, 0x13, 0x6F, 0xE3, 0x45, 0xEE, 0x5C, 0x8A,
-    0xE9, 0x5F, 0xAF, 0xA2, 0xBF, 0x6E, 0x95, 0xBD, 0x94, 0x79, 0x75, 0x0E, 0xCD, 0x13, 0x0F, 0xD0,
-    0xD0, 0xC7, 0x77, 0x54, 0x70, 0xC9, 0xCC, 0xF7, 0x57, 0xB9, 0x3C, 0x59, 0x65, 0x8C, 0x1A, 0x9B,
-    0x19, 0xA3, 0xD2, 0x64, 0x8C, 0x32, 0x96, 0x03, 0x0C, 0xB5, 0xFE, 0x92, 0x7D, 0x5B, 0xEB, 0x4B,
-    0x88, 0x02, 0xD0, 0xB1, 0x81, 0xDF, 0x47, 0xD1, 0xDB, 0x4E, 0xFA, 0x75, 0x40, 0x81, 0x0D, 0x80,
-    0x9C, 0xC1, 0x04, 0x9C, 0x23, 0xF8, 0x13, 0x79, 0x54, 0x59, 0x39, 0xD8, 0x25, 0xB4, 0xF2, 0x36,
-    0x82, 0xD7, 0x16, 0xDE, 0x34, 0x61, 0xD5, 0x67, 0xFA, 0x1C, 0xF0, 0x17, 0x62, 0xEE, 0x4E, 0x2C,
-    0x3E, 0xE8, 0x51, 0x43, 0x16, 0x4E, 0xD6, 0x4A, 0x67, 0x6D, 0x7D, 0x0C, 0x3E, 0x19, 0x83, 0x9A,
-    0x66, 0xC0, 0x35, 0xB8, 0x6B, 0xA5, 0x6A, 0x78, 0xCC, 0x7A, 0x37, 0x19, 0x55, 0xF6, 0x27, 0xE4,
-    0x27, 0x02, 0x61, 0x58, 0x26, 0xAE, 0xC6, 0xB5, 0x15, 0xB1, 0x9A, 0x83, 0xFC, 0x91, 0xE8, 0x33,
-    0xE5, 0x41, 0xA8, 0xC5, 0x08, 0xE6, 0x7D, 0x04, 0x1E, 0x61, 0x24, 0x42, 0x24, 0xD0, 0x6E, 0xD3,
-    0x58, 0x3B, 0xA7, 0xFA, 0x4A, 0x46, 0x0D, 0xF4, 0xCB, 0xAA, 0x5D, 0x87, 0xE8, 0xEB, 0x65, 0x89,
-    0xD2, 0xA1, 0x99, 0x32, 0x48, 0xA2, 0x37, 0x30, 0x95, 0xE4, 0x94, 0x3B, 0x68, 0x8F, 0xA0, 0x9A,
-    0xF5, 0x1F, 0xC3, 0xF4, 0x17, 0x67, 0x68, 0xEC, 0x06, 0xB9, 0xAD, 0x90, 0x87, 0x7A, 0xAF, 0x4D,
-    0xF5, 0x8F, 0x53, 0xB9, 0x7C, 0x0E, 0x8A, 0x0E, 0x6F, 0x19, 0xD8, 0xFA, 0x5A, 0xBE, 0xB3, 0x77,
-    0xE2, 0x51, 0xB9, 0x27, 0x6F, 0x3D, 0xF7, 0x94, 0x1A, 0xC7, 0xF2, 0x39, 0xB9, 0x27, 0x7A, 0xC9,
-    0xA8, 0x57, 0x80, 0x79, 0x60, 0x1B, 0xAB, 0xFC, 0x83, 0xC5, 0x39, 0x6F, 0x9F, 0xAC, 0x8F, 0xE1,
-    0xCB, 0x72, 0x86, 0x55, 0xF2, 0x95, 0x91, 0xD4, 0x78, 0x40, 0x36, 0x66, 0xC9, 0x77, 0x73, 0xA1,
-    0x02, 0xC4, 0x53, 0xD0, 0x2D, 0x54, 0x00, 0x5F, 0xA1, 0x66, 0x39, 0xE7, 0x81, 0x2E, 0x39, 0x5D,
-    0x0D, 0xB3, 0x63, 0x57, 0x7F, 0xC3, 0xC4, 0x25, 0x31, 0xE7, 0x2A, 0x58, 0x17, 0x7A, 0x26, 0x6B,
-    0x11, 0x56, 0x7E, 0xCE, 0x24, 0xAE, 0xC9, 0xBD, 0xC8, 0xA9, 0x80, 0x0B, 0x9A, 0x61, 0x82, 0x55,
-    0x2B, 0x09, 0x58, 0x49, 0x0D, 0x84, 0x04, 0x5D, 0x39, 0xF0, 0xE2, 0xB3, 0xA1, 0x75, 0x25, 0xA1,
-    0x9F, 0xA1, 0xE3, 0x8C, 0xB3, 0x25, 0x9C, 0xAD, 0x41, 0x03, 0x75, 0xA0, 0x89, 0x1F, 0x42, 0xD8,
-    0x96, 0x6A, 0x85, 0xCC, 0xF7, 0xEA, 0x18, 0x31, 0x97, 0x06, 0x80, 0x66, 0x7B, 0xB1, 0x31, 0xD9,
-    0xA6, 0x14, 0x88, 0x03, 0xB6, 0x17, 0xBE, 0x46, 0xA2, 0xE4, 0xD2, 0x21, 0xC1, 0x81, 0xE5, 0xEE,
-    0x7E, 0xD9, 0x61, 0x56, 0x8B, 0x16, 0xCD, 0xB1, 0xB4, 0x71, 0x34, 0x16, 0x40, 0x1D, 0xF8, 0xA8,
-    0x51, 0x81, 0x23, 0x62, 0x32, 0xFF, 0x04, 0xD1, 0x57, 0xFA, 0x39, 0x7B, 0x98, 0x7E, 0xCF, 0x67,
-    0x85, 0xBE, 0xA6, 0x4C, 0xC2, 0x86, 0xC9, 0xBE, 0xFD, 0xF0, 0x29, 0x27, 0xD7, 0x48, 0x6C, 0x39,
-    0x35, 0x16, 0xC5, 0x29, 0xB6, 0x6D, 0xA7, 0x9C, 0x65, 0x21, 0x4E, 0xB8, 0x99, 0x53, 0xE0, 0x01,
-    0xE7, 0xDC, 0x60, 0xD8, 0x1D, 0x04, 0xFF, 0x1F, 0xFD, 0x51, 0xE2, 0x62, 0x8E, 0xC6, 0x30, 0xC2,
-    0x25, 0x52, 0x40, 0x82, 0xEB, 0x67, 0x43, 0x09, 0x38, 0xE6, 0xE0, 0x5D, 0x09, 0x06, 0xC0, 0xD8,
-    0x03, 0xED, 0xE0, 0xB5, 0xA3, 0xAA, 0x6A, 0x32, 0xA0, 0x45, 0x55, 0xD5, 0x78, 0xA8, 0xDA, 0x17,
-    0x46, 0xBC, 0xF8, 0x84, 0x2A, 0x6E, 0xA3, 0xA2, 0x71, 0xFE, 0x87, 0xE4, 0x9B, 0xAB, 0x0A, 0xDA,
-    0x46, 0x7E, 0x9B, 0x1A, 0x76, 0x97, 0xAB, 0x7C, 0x3D, 0x51, 0x07, 0xDF, 0x3E, 0x65, 0x92, 0x31,
-    0xB5, 0xCF, 0x54, 0xB5, 0x2D, 0x55, 0xC4, 0xC1, 0x4B, 0x4B, 0x67, 0xA8, 0x0E, 0x17, 0xCC, 0x07,
-    0xCC, 0x4D, 0x63, 0x5C, 0x0D, 0x6F, 0x54, 0x7C, 0x8D, 0x93, 0x4D, 0x8C, 0x5F, 0xE6, 0x33, 0xC0,
-    0x95, 0xCF, 0xE8, 0x18, 0x30, 0x2A, 0x99, 0xBC, 0xAD, 0x17, 0xDA, 0x3D, 0xCE, 0xDD, 0xDF, 0xE0,
-    0x17, 0x4E, 0x10, 0xBB, 0xD9, 0x89, 0x48, 0x22, 0xCE, 0xAB, 0x78, 0x10, 0x4B, 0xD3, 0xC1, 0xA5,
-    0x9A, 0xA5, 0x1C, 0x68, 0x75, 0x44, 0x39, 0x3B, 0x96, 0xA0, 0x73, 0xEC, 0x48, 0xD7, 0xD5, 0x37,
-    0x79, 0xE1, 0x4B, 0x17, 0x0E, 0x2F, 0xDC, 0xD0, 0xFE, 0xFB, 0xEB, 0x2E, 0xC3, 0xEB, 0x2F, 0x17,
-    0xF8, 0x86, 0xD3, 0x06, 0xE0, 0xA0, 0xCD, 0x61, 0x3B, 0x99, 0x10, 0xB1, 0xDA, 0x4D, 0x59, 0xCD,
-    0x01, 0xCB, 0xB5, 0xD2, 0x48, 0xA4, 0xB5, 0x19, 0x3A, 0x27, 0x7B, 0xDF, 0x94, 0x66, 0xAD, 0xE0,
-    0xC1, 0xA6, 0xC7, 0xF9, 0xF5, 0xD2, 0x87, 0xD0, 0x64, 0xCE, 0x0F, 0x12, 0xB3, 0x8D, 0x2F, 0x8C,
-    0x05, 0xFF, 0x16, 0xB1, 0x20, 0x28, 0x20, 0xC8, 0x8A, 0x03, 0x10, 0xE1, 0x8C, 0x63, 0x07, 0xDA,
-    0xC1, 0x65, 0xCF, 0x7A, 0x48, 0xE6, 0x3E, 0xA2, 0xC8, 0x87, 0x4B, 0xBA, 0x59, 0xA0, 0x4B, 0x2C,
-    0x75, 0x2E, 0x2D, 0x5D, 0x5C, 0x5F, 0x9B, 0xAF, 0x88, 0xEB, 0xC4, 0xE6, 0x1A, 0xAC, 0xE1, 0xB0,
-    0xAE, 0x51, 0xDA, 0x79, 0xA6, 0x6F, 0xD0, 0x93, 0x36, 0x38, 0x04, 0xA0, 0xD3, 0x56, 0x4E, 0xEA,
-    0xA4, 0xEC, 0x4E, 0x2C, 0xF6, 0x22, 0xCC, 0x28, 0x56, 0xE0, 0xF6, 0x03, 0xF6, 0x25, 0x8C, 0xE8,
-    0x6C, 0xCE, 0x59, 0x55, 0x64, 0xBF, 0x78, 0xFD, 0xE2, 0x67, 0xAC, 0x12, 0x75, 0x5A, 0x1E, 0x41,
-    0x43, 0xA4, 0xE4, 0x91, 0x0C, 0xEC, 0x06, 0xF1, 0x9C, 0xFD, 0x5E, 0x68, 0xC1, 0xF6, 0x71, 0x9C,
-    0xDB, 0x76, 0x6C, 0xEF, 0x14, 0x4A, 0x8D, 0xC8, 0xCB, 0xCE, 0xFB, 0x9D, 0x9E, 0x83, 0x27, 0x6E,
-    0x75, 0xAB, 0x8E, 0xE1, 0x4A, 0x38, 0x44, 0x35, 0x61, 0xAA, 0x7C, 0xA8, 0x63, 0x74, 0x7A, 0x80,
-    0x0E, 0xD4, 0xA9, 0x39, 0xBE, 0xD1, 0xE9, 0x5C, 0x2A, 0xD0, 0xEF, 0x7B, 0x71, 0xD5, 0xA9, 0xD6,
-    0x5D, 0x1C, 0x9B, 0xFD, 0x12, 0x3D, 0x49, 0xF4, 0x34, 0x2F, 0xDD, 0x1A, 0x7F, 0xE1, 0xC2, 0x92,
-    0x4C, 0x9E, 0xCC, 0x3B, 0x86, 0xE0, 0xF6, 0x9E, 0xAA, 0xF4, 0x91, 0x59, 0x0F, 0x53, 0x16, 0x66,
-    0x14, 0x86, 0x16, 0x76, 0x40, 0x5D, 0x82, 0x67, 0x15, 0xA6, 0x1B, 0x4A, 0x91, 0x78, 0xA9, 0x97,
-    0xDA, 0x25, 0x64, 0x61, 0x74, 0x77, 0x94, 0x2A, 0xF2, 0x6D, 0x85, 0x46, 0xE6, 0x13, 0x2E, 0x2D,
-    0x8A, 0xF3, 0x29, 0x43, 0x9A, 0x36, 0x92, 0x9D, 0x65, 0x38, 0xB3, 0x3F, 0x4E, 0x9C, 0xD5, 0x4C,
-    0x86, 0xD0, 0xDB, 0x15, 0xA3, 0x17, 0xF6, 0xCB, 0x0B, 0xAF, 0xEF, 0x80, 0xBE, 0x1C, 0x61, 0x8A,
-    0x31, 0x0A, 0x8F, 0x67, 0x3F, 0xDE, 0x09, 0x54, 0x1D, 0x9E, 0x1F, 0x94, 0x92, 0x4F, 0xFA, 0x4B,
-    0x7F, 0xF6, 0xFA, 0x89, 0x35, 0x6F, 0x68, 0x99, 0x4A, 0x29, 0xDD, 0x0D, 0x90, 0x7B, 0xC4, 0x97,
-    0xA1, 0x75, 0xFC, 0x56, 0x43, 0xD5, 0xC2, 0xDA, 0x57, 0x21, 0x3D, 0x27, 0x81, 0x15, 0x50, 0x5D,
-    0x6C, 0xFB, 0xB2, 0x13, 0x37, 0x95, 0x6F, 0x76, 0xA9, 0xF5, 0x20, 0x35, 0xFE, 0x99, 0xA9, 0xC9,
-    0x96, 0xAF, 0x5F, 0x80, 0x15, 0x6F, 0x26, 0x43, 0x07, 0x16, 0x77, 0xB9, 0xA4, 0x16, 0x25, 0xAA,
-    0x69, 0x29, 0x8E, 0xC0, 0x06, 0xF8, 0xF2, 0x20, 0x47, 0x15, 0xA8, 0xFE, 0xA9, 0xFF, 0x0D, 0x0D,
-    0x94, 0xA0, 0x2A, 0x20, 0x0A, 0x4A, 0x31, 0xDD, 0xF7, 0x24, 0x21, 0x80, 0x7E, 0x55, 0xE5, 0x59,
-    0xE9, 0xAF, 0x68, 0xA1, 0x1F, 0x24, 0xFE, 0xFB, 0x30, 0xF6, 0x88, 0x26, 0x3C, 0x02, 0x33, 0x07,
-    0xA4, 0x4F, 0x0E, 0x1C, 0xB0, 0xFF, 0x93, 0xFE, 0x39, 0x1E, 0xBD, 0x26, 0x47, 0x2F, 0x5E, 0xD4,
-    0xAA, 0x15, 0x09, 0x49, 0xAB, 0xC9, 0x33, 0xEA, 0x29, 0xD6, 0x61, 0x7A, 0x28, 0x67, 0x1C, 0x4D,
-    0x85, 0xC0, 0xA1, 0x56, 0x08, 0xCA, 0x34, 0x61, 0x8E, 0xCD, 0x94, 0x4E, 0x9B, 0xA2, 0x31, 0xE6,
-    0x2C, 0xF6, 0xFA, 0xB2, 0x1F, 0xDC, 0xCC, 0xE5, 0x9C, 0x33, 0x7E, 0x7F, 0xAD, 0x0A, 0xFB, 0xDD,
-    0xC4, 0x39, 0x01, 0xDF, 0x4D, 0x7F, 0xA9, 0xAC, 0x1B, 0x89, 0x73, 0x96, 0xC1, 0xB0, 0xA3, 0xD8,
-    0xBA, 0x9F, 0x0C, 0x99, 0x14, 0xC5, 0x50, 0xF7, 0x71, 0x0E, 0x76, 0x96, 0xF2, 0x3A, 0x1E, 0x9B,
-    0x03, 0x1F, 0xE4, 0x55, 0xE5, 0x6B, 0x9A, 0xA7, 0x81, 0x03, 0x48, 0xC9, 0xE8, 0xC5, 0xEA, 0xC2,
-    0x66, 0x41, 0xC1, 0x87, 0x16, 0x74, 0x0F, 0x72, 0x76, 0x0D, 0x91, 0x62, 0xF5, 0x19, 0x98, 0xAC,
-    0xB2, 0xF9, 0xE0, 0xD3, 0xA7, 0xDF, 0x3E, 0x1A, 0x0E, 0x7D, 0xFA, 0xCE, 0x8B, 0x27, 0x30, 0x7D,
-    0x08, 0x59, 0x65, 0xB5, 0x88, 0xD0, 0x5A, 0x48, 0x5D, 0x5E, 0xF7, 0x07, 0xBE, 0x3C, 0x39, 0xCF,
-    0x0E, 0x14, 0x9D, 0xCF, 0x1E, 0x36, 0x5C, 0x55, 0x45, 0xE3, 0x64, 0xBF, 0x85, 0xBE, 0xF4, 0xAB,
-    0x5C, 0x91, 0xBF, 0x70, 0xDC, 0xC4, 0xF6, 0xD5, 0x42, 0xA0, 0x59, 0x4F, 0x94, 0x86, 0x37, 0xF7,
-    0xDE, 0x34, 0x9C, 0x12, 0x24, 0x9F, 0x1D, 0xC2, 0x7E, 0x76, 0xC9, 0xEE, 0x06, 0x5F, 0x7B, 0xA9,
-    0x8F, 0x42, 0x88, 0x7F, 0xC7, 0x1C, 0xDB, 0x09, 0x47, 0x7F, 0xEF, 0xEE, 0xF3, 0x17, 0x60, 0x18,
-    0xD6, 0x47, 0x93, 0x26, 0xD5, 0x8D, 0x16, 0xDC, 0xB5, 0x7F, 0x30, 0x64, 0xA5, 0xF3, 0x21, 0x07,
-    0x4F, 0xF0, 0x7A, 0x9F, 0xB3, 0x7B, 0xA0, 0xDF, 0x92, 0x08, 0x9F, 0x30, 0x8A, 0xBF, 0x68, 0x16,
-    0x0A, 0x59, 0xF7, 0xDD, 0x9C, 0x3E, 0xFB, 0xF9, 0xFF, 0x5A, 0x7E, 0xAC, 0x7A, 0x9B, 0xE6, 0xF0,
-    0x2D, 0x1B, 0x66, 0x6E, 0x8B, 0x16, 0xAC, 0xDE, 0xC3, 0xA3, 0x19, 0x08, 0x27, 0x07, 0xAA, 0x3C,
-    0xAB, 0xFF, 0x45, 0x79, 0x56, 0xE7, 0x97, 0xE5, 0x59, 0x77, 0xD0, 0xE4, 0xA0, 0xAD, 0x46, 0xC0,
-    0xFC, 0x40, 0xFC, 0x3C, 0x1A, 0xAF, 0x83, 0xF2, 0x51, 0x23, 0xE7, 0xB0, 0x34, 0xE8, 0x85, 0xF5,
-    0xFD, 0x59, 0x9D, 0x8A, 0x3A, 0xD5, 0x67, 0xD8, 0xD7, 0xFA, 0x11, 0xE3, 0x2C, 0xA3, 0x1D, 0x47,
-    0x27, 0x00, 0xAE, 0x5D, 0xB4, 0x63, 0x87, 0x23, 0xED, 0x8B, 0xE1, 0xCF, 0xE2, 0x83, 0x20, 0x78,
-    0xE2, 0x3E, 0xBD, 0x9F, 0x4F, 0xB8, 0x83, 0xD6, 0xBB, 0x31, 0x93, 0xDA, 0x57, 0x8C, 0x25, 0x3B,
-    0x90, 0x03, 0xA2, 0x4F, 0x07, 0xE1, 0x66, 0x24, 0xD6, 0xBF, 0x5C, 0x7C, 0xB5, 0xF1, 0x15, 0x73,
-    0xA2, 0x39, 0x95, 0xF8, 0xCA, 0xF1, 0x15, 0xCE, 0xBE, 0xA8, 0x9C, 0x5E, 0xCF, 0x04, 0x66, 0x26,
-    0xCC, 0x82, 0xCC, 0x07, 0xA6, 0x10, 0x41, 0x49, 0x87, 0xCD, 0xD1, 0xA1, 0x6C, 0x7A, 0xD0, 0xA5,
-    0x6C, 0x71, 0x37, 0x62, 0xFA, 0x95, 0xC8, 0xCD, 0xAA, 0x90, 0x86, 0x3D, 0xF0, 0x24, 0x8C, 0xAC,
-    0xC1, 0x9C, 0x25, 0x46, 0xC4, 0x96, 0x31, 0x83, 0xC1, 0x85, 0xC0, 0x90, 0x18, 0x26, 0x30, 0x4C,
-    0x5E, 0x98, 0xC3, 0x18, 0xD2, 0xA2, 0xAB, 0xFD, 0x25, 0x9C, 0x30, 0xD4, 0x86, 0xBA, 0x74, 0xC9,
-    0xC9, 0xC1, 0x5E, 0xF4, 0x73, 0x99, 0xE9, 0x99, 0x97, 0xB9, 0xD8, 0xC3, 0xB3, 0xE9, 0x57, 0xEA,
-    0x40, 0xC6, 0xE2, 0x17, 0x1F, 0xE2, 0x58, 0xDB, 0x09, 0x56, 0x19, 0xF1, 0xA2, 0x1D, 0x53, 0xE1,
-    0x4A, 0x7B, 0x7E, 0x03, 0x83, 0x52, 0xBC, 0x7E, 0x09, 0x29, 0xB7, 0xC2, 0xCA, 0x3A, 0x0C, 0x8E,
-    0x73, 0xE4, 0x0A, 0x02, 0x6B, 0x5C, 0x25, 0xA7, 0xF1, 0xBF, 0x80, 0xF9, 0x15, 0xEB, 0xCC, 0xAF,
-    0xA0, 0x8A, 0xCA, 0x30, 0xD2, 0xE4, 0x07, 0xE8, 0xE9, 0x3A, 0x35, 0x6A, 0x7C, 0x8C, 0xE3, 0x18,
-    0xA5, 0xB1, 0x51, 0xAA, 0x0F, 0xD3, 0x0C, 0x20, 0x52, 0xE8, 0x73, 0xDB, 0x12, 0xB6, 0xCC, 0x7D,
-    0xC6, 0xCC, 0xC9, 0x04, 0x8E, 0xAF, 0x0F, 0x4C, 0xEF, 0x9A, 0x1E, 0xE4, 0xBF, 0x67, 0x46, 0x82,
-    0x15, 0xF9, 0x0B, 0x00, 0xA1, 0x0F, 0xF2, 0x70, 0x08, 0x7F, 0xB4, 0x6B, 0x1E, 0x07, 0x84, 0x06,
-    0x82, 0xA1, 0x99, 0xFB, 0x80, 0xC8, 0xEB, 0x18, 0xBC, 0xB8, 0x85, 0x80, 0x3D, 0x0E, 0x4A, 0xEB,
-    0x81, 0x42, 0x4C, 0x12, 0x75, 0xDD, 0xAB, 0x89, 0xEF, 0xAF, 0xDE, 0x51, 0xEE, 0xC5, 0x5B, 0x45,
-    0x69, 0xAB, 0x5E, 0x37, 0xA0, 0x73, 0x9E, 0x96, 0xA9, 0x7F, 0x54, 0xCF, 0xE5, 0x08, 0xA5, 0xCF,
-    0x77, 0x45, 0xEE, 0xA9, 0x56, 0xDC, 0xC3, 0x57, 0x16, 0xC4, 0x7F, 0xE6, 0x16, 0xB2, 0x4A, 0xA8,
-    0xF5, 0xE1, 0xC1, 0x48, 0x80, 0xDD, 0x50, 0x25, 0x03, 0x23, 0x84, 0x4A, 0x0A, 0xB6, 0xB2, 0xC0,
-    0xEB, 0x03, 0x51, 0x42, 0x6A, 0x49, 0x47, 0x7C, 0x22, 0x97, 0xEA, 0xB7, 0x6E, 0x1C, 0xBD, 0x3C,
-    0xB3, 0x54, 0xEB, 0x5C, 0x9E, 0x5B, 0x2D, 0x8A, 0x9A, 0x2F, 0xE7, 0xCE, 0x2B, 0x4C, 0x92, 0xAC,
-    0x78, 0x14, 0x3B, 0x1A, 0xE3, 0x04, 0x9E, 0x8A, 0xA2, 0xA8, 0xB6, 0xF9, 0x31, 0x73, 0xBD, 0x1B,
-    0xC1, 0x93, 0x48, 0x26, 0xAA, 0x85, 0x44, 0xBB, 0x78, 0xC8, 0xF2, 0x7E, 0x93, 0x3B, 0x38, 0x18,
-    0x7D, 0x68, 0x54, 0xC4, 0x13, 0x8C, 0x13, 0xAD, 0x2D, 0x4B, 0xFE, 0x8F, 0xB3, 0x66, 0x14, 0xB9,
-    0x88, 0x23, 0x99, 0x9D, 0xA7, 0x25, 0x59, 0x93, 0x5B, 0x33, 0xA4, 0x4C, 0x18, 0x99, 0x57, 0xB0,
-    0x1A, 0xDB, 0x37, 0x21, 0xA9, 0x4F, 0xF1, 0x23, 0x82, 0x02, 0x8C, 0x73, 0x60, 0x7F, 0x84, 0x23,
-    0xD4, 0x08, 0x2A, 0x09, 0xB4, 0xCF, 0xCD, 0x16, 0xA7, 0x19, 0x0A, 0x16, 0xCE, 0xC6, 0xBC, 0xCC,
-    0xED, 0xF2, 0xBE, 0x21, 0x34, 0x79, 0x1E, 0xC1, 0xA5, 0xC2, 0xD3, 0x2B, 0xBC, 0xEA, 0x98, 0xB6,
-    0xDD, 0xAC, 0x1C, 0x98, 0x3C, 0xFE, 0x25, 0xC6, 0xC6, 0x6B, 0xCE, 0xC7, 0x0D, 0xDA, 0x15, 0x6C,
-    0x49, 0x1C, 0xAB, 0x05, 0x46, 0x90, 0x3F, 0x37, 0xF5, 0x6D, 0xAE, 0xC5, 0x5B, 0x5C, 0x3B, 0xE7,
-    0xBB, 0x2F, 0x70, 0xF2, 0x81, 0xF1, 0xDE, 0xE3, 0x00, 0x1B, 0xFA, 0xC6, 0xD3, 0xDC, 0x36, 0x75,
-    0x6F, 0xA1, 0xCB, 0x48, 0xC6, 0x79, 0x6F, 0xB6, 0x93, 0x85, 0xD7, 0x61, 0x42, 0x68, 0x13, 0x23,
-    0x37, 0xEB, 0xFC, 0xD4, 0x5F, 0x26, 0x5D, 0x67, 0xE2, 0xFE, 0x3B, 0xE0, 0x76, 0x81, 0xEE, 0x89,
-    0x78, 0x1C, 0x21, 0xD2, 0xA1, 0x41, 0x9A, 0xB5, 0x4E, 0x38, 0x3C, 0x8A, 0x0B, 0x89, 0x58, 0xFB,
-    0x5E, 0xA8, 0xD8, 0x3B, 0xD4, 0x38, 0x37, 0xE2, 0xA6, 0x9D, 0x9C, 0x11, 0x19, 0xBE, 0xCB, 0xD7,
-    0x1D, 0x10, 0xD7, 0x95, 0xE7, 0x4E, 0x16, 0x7D, 0xDC, 0xCD, 0x46, 0x30, 0x1B, 0x5B, 0x10, 0xF7,
-    0xF1, 0x77, 0xA8, 0xC8, 0xEF, 0x2E, 0x3E, 0x41, 0xAF, 0x0D, 0x5A, 0x09, 0xC3, 0x6E, 0xF1, 0xA5,
-    0x53, 0xD6, 0xFB, 0xD7, 0x30, 0xF6, 0x94, 0x77, 0xD7, 0xB1, 0xD2, 0x61, 0xBA, 0x6A, 0x03, 0x2F,
-    0xB4, 0x71, 0xF3, 0xB7, 0xC2, 0x89, 0x09, 0x52, 0xBB, 0xC1, 0x67, 0x21, 0x9D, 0x3D, 0x64, 0xFD,
-    0x04, 0xAE, 0x1C, 0x1C, 0xBC, 0xF0, 0xF8, 0xE5, 0x1B, 0x66, 0x85, 0xD7, 0xF3, 0x11, 0xCE, 0xAD,
-    0xFD, 0xE3, 0x10, 0x8D, 0x0E, 0x52, 0x53, 0xFC, 0xA0, 0xBF, 0xC9, 0x69, 0xAF, 0x15, 0xD6, 0x9D,
-    0x64, 0xD6, 0x4D, 0x56, 0x36, 0xB6, 0x12, 0x6C, 0xC4, 0x04, 0x5F, 0xA2, 0xAF, 0xF4, 0x0B, 0xFA,
-    0x72, 0x7F, 0x00, 0xD3, 0x56, 0xF2, 0xD5, 0xDC, 0x5B, 0xE5, 0x78, 0x9C, 0x43, 0x14, 0xE8, 0x0B,
-    0x1B, 0xE8, 0x1C, 0xDB, 0xC9, 0xD4, 0x40, 0xB8, 0xAD, 0x5B, 0x3F, 0x6C, 0x43, 0xBD, 0x00, 0x82,
-    0xBC, 0x8D, 0xC8, 0x01, 0x0E, 0x82, 0x39, 0x73, 0x60, 0x51, 0x72, 0xB6, 0xCF, 0xFE, 0x94, 0x69,
-    0xAB, 0xD0, 0x55, 0x0C, 0x5E, 0x1A, 0xC7, 0x99, 0x6E, 0x26, 0xD2, 0x7A, 0xE6, 0x42, 0xD7, 0x78,
-    0xD2, 0x2E, 0x87, 0xE5, 0x5C, 0x77, 0x6E, 0xDE, 0x03, 0x17, 0xE9, 0x76, 0x2E, 0x75, 0xA9, 0x73,
-    0x4D, 0x4B, 0x04, 0x51, 0x6E, 0x57, 0x22, 0xE4, 0xE7, 0x75, 0xE1, 0x12, 0x6A, 0x62, 0x22, 0xFD,
-    0x81, 0xF0, 0xF8, 0x67, 0x8C, 0x78, 0xDC, 0x01, 0x5B, 0x5F, 0x6E, 0x90, 0x78, 0x1B, 0x11, 0xB0,
-    0x73, 0xF9, 0x0C, 0x0C, 0x63, 0x85, 0xE3, 0x02, 0x76, 0xC0, 0x7E, 0xB7, 0x1F, 0xCE, 0x09, 0x76,
-    0xBE, 0x2C, 0x24, 0x5E, 0xFA, 0xA1, 0xE0, 0xE6, 0x55, 0x85, 0xE8, 0xFB, 0x39, 0x15, 0xBC, 0xDD,
-    0xF3, 0x14, 0x84, 0x5B, 0x78, 0x22, 0x3B, 0xE7, 0xAD, 0xF6, 0x67, 0xFA, 0xE4, 0x3C, 0x24, 0xB1,
-    0x17, 0x06, 0x25, 0x0C, 0x37, 0x8B, 0x76, 0x9E, 0x4D, 0x3D, 0x8E, 0x6A, 0x0D, 0x82, 0x36, 0xC9,
-    0xFE, 0x6F, 0xF2, 0x4F, 0xF0, 0xAE, 0x91, 0x14, 0x9A, 0x56, 0x77, 0x2E, 0xA6, 0xED, 0x59, 0xF9,
-    0x4E, 0xDF, 0xA8, 0xFC, 0x94, 0x76, 0x86, 0x20, 0x2A, 0x76, 0x0C, 0xB3, 0x75, 0x42, 0x38, 0x4F,
-    0x3B, 0xD9, 0x13, 0xB9, 0x3A, 0x84, 0x43, 0x3A, 0xB8, 0x10, 0xB3, 0xEF, 0x1E, 0x63, 0xCC, 0x6A,
-    0x30, 0xC7, 0x02, 0xF4, 0x9D, 0x4D, 0xFB, 0x7B, 0x91, 0x7C, 0x2B, 0x2E, 0xBD, 0x9B, 0x59, 0x4B,
-    0x73, 0xFC, 0x40, 0x5F, 0xEA, 0x5E, 0xEB, 0xF9, 0x37, 0x8C, 0x73, 0x5E, 0xFF, 0xEC, 0xFB, 0xC2,
-    0xAD, 0x4C, 0xDD, 0xED, 0x5B, 0x99, 0x9E, 0xFD, 0xFC, 0x2D, 0x46, 0x03, 0x2F, 0xBC, 0xE6, 0xE9,
-    0x4D, 0x02, 0xF5, 0x4B, 0x73, 0xE9, 0x56, 0xB8, 0x17, 0x78, 0x84, 0x68, 0x12, 0x30, 0xE6, 0x66,
-    0xE5, 0x23, 0xF6, 0xFE, 0xB9, 0x9F, 0xB3, 0xB5, 0xEA, 0xF1, 0xB6, 0x3C, 0x49, 0x28, 0x1B, 0x88,
-    0xFC, 0x9C, 0xDA, 0x77, 0x78, 0xF2, 0x31, 0x87, 0xC4, 0x86, 0x53, 0xE1, 0x24, 0xC6, 0x64, 0x17,
-    0xC1, 0xA6, 0x0E, 0x5B, 0xE0, 0x94, 0xD0, 0x85, 0x44, 0x14, 0xA2, 0xE4, 0x44, 0xDA, 0x69, 0xC6,
-    0x49, 0x78, 0xCD, 0x19, 0xDE, 0xBB, 0x73, 0x06, 0xEA, 0x76, 0x07, 0x7A, 0xD7, 0xE6, 0xE0, 0xBA,
-    0x41, 0x66, 0x1B, 0xA4, 0xB8, 0xC6, 0x3B, 0x76, 0x5B, 0xFF, 0xF3, 0xE7, 0xC6, 0xB5, 0x1B, 0x2F,
-    0xE0, 0x31, 0xC8, 0x9D, 0xEC, 0x47, 0xF7, 0xF2, 0x30, 0x42, 0x3D, 0xE5, 0xCD, 0xE5, 0x1B, 0xA3,
-    0x7B, 0x9C, 0x05, 0x5F, 0xEA, 0x20, 0xEC, 0x03, 0x66, 0xF4, 0x5E, 0x2C, 0x38, 0xE8, 0x9C, 0x41,
-    0x37, 0x8A, 0xDC, 0x4B, 0xEF, 0xBC, 0xD0, 0x61, 0x12, 0xD1, 0x26, 0xFB, 0x36, 0x30, 0xFC, 0x62,
-    0x6E, 0xAD, 0xC8, 0x6A, 0xFB, 0x52, 0xCC, 0x33, 0xD2, 0x4F, 0x42, 0xC3, 0x3D, 0xC3, 0xA4, 0xEB,
-    0x96, 0x6A, 0x52, 0x73, 0x89, 0x6A, 0xB8, 0x7F, 0x99, 0x6A, 0xCB, 0x14, 0xCD, 0x58, 0x05, 0x34,
-    0x1D, 0x16, 0x87, 0x1B, 0x78, 0x4E, 0x30, 0x32, 0x02, 0x74, 0x6C, 0x7B, 0xFD, 0x2D, 0x6C, 0x18,
-    0x46, 0xCA, 0xB4, 0xEE, 0xFE, 0xC9, 0x2C, 0x00, 0x11, 0xCE, 0x49, 0x7E, 0x07, 0x51, 0xB8, 0x3F,
-    0xF5, 0x72, 0x89, 0x57, 0xBC, 0xCD, 0x83, 0x01, 0xB5, 0xF1, 0xD2, 0x9D, 0x45, 0xB5, 0x33, 0xB8,
-    0x67, 0x56, 0x20, 0xAA, 0xA4, 0x3D, 0x0D, 0x58, 0x21, 0xEC, 0x33, 0x70, 0xB2, 0xC0, 0x51, 0xDB,
-    0xDA, 0x7C, 0x8C, 0x91, 0x35, 0xA0, 0xCB, 0xA5, 0x17, 0x0A, 0xB5, 0x42, 0x03, 0x87, 0x37, 0xAD,
-    0x9A, 0x77, 0x6A, 0xF4, 0xCE, 0xC6, 0x32, 0x66, 0xB2, 0x25, 0x61, 0x80, 0x4C, 0x3D, 0x23, 0x13,
-    0xD3, 0xF1, 0x6C, 0x99, 0x1D, 0xBB, 0xB0, 0x42, 0xEB, 0xD6, 0x7D, 0xF2, 0xFA, 0x4B, 0xAF, 0x00,
-    0x5D, 0xDE, 0xBE, 0x61, 0x16, 0xFE, 0xE0, 0x4B, 0x79, 0xA9, 0x2C, 0x2D, 0xF7, 0x59, 0x93, 0xFD,
-    0xD7, 0xCB, 0x86, 0x61, 0xC9, 0x16, 0x07, 0x2E, 0x03, 0x2F, 0xC6, 0x41, 0x8F, 0xC1, 0x5A, 0xBC,
-    0xFB, 0x57, 0x2B, 0x98, 0x82, 0xFD, 0xF7, 0xC9, 0x7A, 0xE1, 0x75, 0x13, 0x0E, 0xFD, 0xEA, 0xDB,
-    0x48, 0x0D, 0x96, 0xE5, 0x4F, 0xFE, 0x64, 0xF2, 0xD7, 0x5F, 0x3B, 0x92, 0xA1, 0x92, 0xA7, 0x73,
-    0xEF, 0x42, 0x3E, 0xB0, 0xAE, 0x42, 0x18, 0x4F, 0x8D, 0xC7, 0x53, 0xDB, 0x1C, 0xCF, 0x2D, 0xC5,
-    0x2B, 0x11, 0x9F, 0x3F, 0x9E, 0x01, 0x9A, 0xF4, 0x6C, 0x05, 0x7B, 0x0A, 0x8E, 0xAA, 0x5F, 0x7F,
-    0x48, 0x70, 0x78, 0x7B, 0x21, 0xBB, 0x65, 0x37, 0x11, 0xD9, 0xD7, 0x78, 0xFF, 0xD6, 0x96, 0xCF,
-    0x08, 0xB9, 0xA1, 0x0C, 0x11, 0x31, 0x27, 0x1E, 0x84, 0x3B, 0x6E, 0x72, 0xA1, 0x4C, 0x54, 0x69,
-    0x26, 0xAA, 0x48, 0xC2, 0x7A, 0xC2, 0x9D, 0x95, 0x43, 0xF4, 0xD3, 0x34, 0x18, 0xF2, 0x2E, 0x4E,
-    0x9A, 0x74, 0x2B, 0x62, 0x83, 0x69, 0x6D, 0x02, 0xBF, 0x41, 0xAA, 0x65, 0xFC, 0x08, 0xE5, 0x04,
-    0x00, 0x4A, 0xF3, 0xE7, 0xC6, 0x23, 0xC4, 0xBB, 0x59, 0x6C, 0x84, 0x31, 0x56, 0x1E, 0xB1, 0x9F,
-    0x41, 0x3F, 0xBC, 0xE3, 0x0F, 0xED, 0x7B, 0x6A, 0x4B, 0x1A, 0x28, 0xAD, 0xD8, 0x24, 0x38, 0x18,
-    0x67, 0xCF, 0x79, 0xF1, 0x85, 0xB7, 0x21, 0x3F, 0x52, 0x2A, 0x5F, 0x6A, 0x03, 0xD8, 0xB8, 0xB8,
-    0xA2, 0xB6, 0xEC, 0x50, 0xDF, 0x41, 0x71, 0x3A, 0xB4, 0xDB, 0x4A, 0x4C, 0x95, 0xD5, 0x9C, 0x9B,
-    0x89, 0xFF, 0x23, 0x4E, 0x5F, 0x0C, 0x01, 0xF0, 0x1F, 0x73, 0xDF, 0x6D, 0xD9, 0x0F, 0xFF, 0x4D,
-    0xE2, 0xB1, 0x53, 0x2E, 0x52, 0xF5, 0xA7, 0xFA, 0x7F, 0x25, 0xDC, 0xC8, 0x57, 0xF0, 0x2C, 0x3A,
-    0x97, 0xAF, 0x72, 0xF0, 0xCD, 0xAF, 0x76, 0x7C, 0xDF, 0xC3, 0x12, 0xE2, 0xA4, 0x71, 0xB9, 0xB8,
-    0xBE, 0xA9, 0xEB, 0xF2, 0xF6, 0x4D, 0x5D, 0xEF, 0x00, 0xFD, 0x2E, 0xF3, 0xDA, 0x02, 0xEF, 0xE2,
-    0x2D, 0x95, 0x95, 0x8A, 0x3B, 0x89, 0x88, 0xD7, 0x37, 0x75, 0x2D, 0x53, 0xD9, 0xEB, 0xA4, 0xE2,
-    0x1E, 0x6F, 0xFC, 0xBD, 0x0A, 0x35, 0x00, 0x3E, 0x4C, 0xEE, 0x05, 0xD1, 0x85, 0x1E, 0x61, 0x9C,
-    0xA5, 0xB7, 0x75, 0x77, 0x38, 0x06, 0xB9, 0x03, 0x23, 0xF9, 0xE9, 0x96, 0xED, 0x07, 0x08, 0x2B,
-    0x17, 0x95, 0x7B, 0x64, 0x35, 0x71, 0xA5, 0xD9, 0x7E, 0x60, 0x29, 0xA5, 0xF5, 0xDC, 0x15, 0xFD,
-    0xA1, 0x0C, 0x79, 0xA3, 0x1F, 0x99, 0x9D, 0x7E, 0x9C, 0xD7, 0x05, 0x9A, 0xA6, 0x9C, 0x21, 0x6C,
-    0xF3, 0x2E, 0x0E, 0xDE, 0xED, 0x57, 0x6D, 0xF7, 0xAB, 0x88, 0xA4, 0xD9, 0xF0, 0x57, 0x6D, 0xE1,
-    0x37, 0x6B, 0xFD, 0x2D, 0x93, 0x84, 0x3F, 0x89, 0xDB, 0x03, 0xF6, 0xC7, 0xBC, 0xED, 0x8F, 0xF7,
-    0xFD, 0xE5, 0x3C, 0xC3, 0x60, 0xAB, 0x39, 0x58, 0x56, 0xD2, 0x4F, 0xEF, 0x9B, 0x77, 0x27, 0x4A,
-    0x45, 0xC2, 0x31, 0x7F, 0x6D, 0x84, 0x38, 0xC3, 0xC5, 0x0A, 0xD7, 0xA8, 0x82, 0x09, 0x60, 0x05,
-    0x82, 0x5D, 0xE7, 0x42, 0x46, 0xB9, 0xFC, 0x6E, 0xC0, 0xCD, 0x57, 0x31, 0xC0, 0xFF, 0x01, 0x8D,
-    0x54, 0xBF, 0x6F, 0x1C, 0x45, 0x14, 0xFE, 0x66, 0xC6, 0xCE, 0x20, 0x36, 0xCE, 0xA4, 0xA0, 0x80,
-    0xE4, 0x94, 0x0D, 0x60, 0xA1, 0x14, 0x70, 0x2B, 0x24, 0x17, 0x2E, 0xF6, 0xB2, 0x7B, 0x42, 0xC8,
-    0x42, 0xE6, 0xC7, 0x15, 0x08, 0xF1, 0x07, 0x50, 0xD0, 0xC5, 0x85, 0x25, 0x5C, 0x5C, 0x7C, 0x9B,
-    0x34, 0x14, 0x01, 0xEC, 0x96, 0xCA, 0xA9, 0x10, 0x12, 0x8D, 0x0B, 0x17, 0x57, 0x1C, 0xE7, 0xB1,
-    0x8E, 0x08, 0xCA, 0xB5, 0xAE, 0x45, 0x62, 0x14, 0x23, 0x45, 0xA2, 0x40, 0x63, 0xB4, 0x52, 0xB6,
-    0xD8, 0xBB, 0xE1, 0xCD, 0xDE, 0x39, 0x1C, 0xA1, 0x61, 0xEE, 0x3D, 0xED, 0xCC, 0x9B, 0xF7, 0xE6,
-    0xBD, 0xF7, 0xCD, 0x37, 0x07, 0x48, 0xE7, 0x7A, 0xCE, 0xE2, 0xD9, 0x17, 0xCC, 0x39, 0xF7, 0x84,
-    0x34, 0xA3, 0xB9, 0x70, 0xDE, 0xEA, 0x0C, 0xFC, 0x50, 0x6E, 0xBE, 0xE3, 0xCA, 0xE7, 0xD7, 0xAB,
-    0xFC, 0x43, 0x9C, 0x65, 0xEB, 0xE6, 0xCA, 0xBA, 0xF8, 0x1A, 0x67, 0xE9, 0x5A, 0xBE, 0xB2, 0x26,
-    0x3E, 0xC0, 0x78, 0x36, 0x79, 0x1F, 0x63, 0xBC, 0xAD, 0x1B, 0x5B, 0xB2, 0xC1, 0xB4, 0x8F, 0xA3,
-    0x03, 0x27, 0x5E, 0x31, 0x1F, 0x8B, 0xEB, 0x69, 0xF4, 0xA5, 0xAD, 0x92, 0x0D, 0x13, 0xED, 0x8D,
-    0x6D, 0xB5, 0x9B, 0xA4, 0x17, 0xDF, 0x0B, 0xFB, 0x34, 0xD9, 0x7C, 0x5C, 0xF6, 0xC2, 0x11, 0x2D,
-    0x3E, 0x3A, 0x29, 0x87, 0xD1, 0xDE, 0x59, 0x31, 0x49, 0x14, 0x2D, 0x77, 0xC9, 0xB3, 0xB8, 0xF0,
-    0x1E, 0x46, 0x3F, 0x9F, 0x57, 0xB5, 0x39, 0xDA, 0x3C, 0x2D, 0x77, 0xFD, 0xC1, 0xDB, 0x0B, 0xB2,
-    0x76, 0x21, 0xEB, 0xB8, 0x36, 0xFC, 0x3E, 0x71, 0x15, 0x4D, 0xFE, 0xAF, 0x34, 0x80, 0x17, 0xE6,
-    0x75, 0x8B, 0x0C, 0x57, 0x6A, 0x9B, 0x59, 0x9C, 0xFE, 0xF0, 0xC7, 0x03, 0xE7, 0xD2, 0x18, 0xB0,
-    0x10, 0x1A, 0x0A, 0x98, 0x4D, 0xFF, 0x14, 0xAE, 0xBA, 0x36, 0x78, 0xCE, 0x4A, 0x78, 0xF0, 0xFA,
-    0x24, 0x57, 0x12, 0xEA, 0x38, 0x76, 0x3A, 0x72, 0x56, 0xB9, 0x09, 0xC1, 0xDE, 0x26, 0xD4, 0x8F,
-    0x5D, 0x99, 0x38, 0x47, 0x30, 0x8F, 0x9C, 0x3B, 0x77, 0x54, 0xA6, 0x4C, 0x7B, 0x1B, 0x93, 0xDE,
-    0x3B, 0x29, 0xF0, 0x52, 0x77, 0x30, 0xA9, 0x15, 0x1D, 0xB6, 0xA1, 0x55, 0xDA, 0x1A, 0xB0, 0x52,
-    0xFE, 0x96, 0x47, 0xD9, 0x90, 0x3D, 0x25, 0x90, 0xE5, 0x72, 0x2A, 0xDA, 0x37, 0xD9, 0xC9, 0x67,
-    0xC8, 0x3F, 0x49, 0x0F, 0x57, 0xF4, 0x36, 0x37, 0xB3, 0xDA, 0xA9, 0xCA, 0x80, 0xB6, 0x33, 0x5F,
-    0x05, 0x3B, 0x7D, 0x17, 0x7F, 0xBD, 0x7A, 0xF3, 0xE8, 0xDB, 0x4F, 0xE3, 0xD7, 0xDF, 0x68, 0xC9,
-    0x07, 0xCB, 0x54, 0xC9, 0x3F, 0xB8, 0xFF, 0x0B, 0x58, 0x5F, 0xE4, 0x25, 0x98, 0x5B, 0xAA, 0x6D,
-    0xBB, 0x37, 0x84, 0x2E, 0xE2, 0xA0, 0x6D, 0x0E, 0x57, 0x84, 0xA7, 0x08, 0x56, 0x43, 0x6E, 0x62,
-    0x9A, 0xDE, 0x6A, 0x88, 0x91, 0x09, 0x15, 0x8E, 0x76, 0xF8, 0x89, 0x9E, 0x21, 0xB4, 0xFA, 0x22,
-    0xD3, 0xDD, 0x50, 0x98, 0xB7, 0x64, 0x66, 0x15, 0xD7, 0x3B, 0x22, 0x7B, 0xD8, 0xA8, 0x37, 0x3A,
-    0xE8, 0xE2, 0x0B, 0xDD, 0x6F, 0xE1, 0x2A, 0xD3, 0x4D, 0x91, 0xB7, 0x50, 0xB0, 0x92, 0x7E, 0x86,
-    0xA5, 0x84, 0x89, 0xC8, 0xB9, 0xE1, 0x46, 0xE9, 0x4A, 0xE9, 0x18, 0x3E, 0x85, 0x2F, 0xEC, 0x73,
-    0x94, 0xFC, 0xA1, 0xB0, 0x4A, 0xFF, 0x08, 0x75, 0x52, 0x45, 0x19, 0x7A, 0x08, 0x2C, 0x78, 0xC5,
-    0x2A, 0x22, 0xA2, 0xE9, 0x91, 0x47, 0x72, 0x90, 0x23, 0x62, 0xAE, 0x5C, 0x16, 0x56, 0x4E, 0x51,
-    0x24, 0x48, 0xF2, 0xF0, 0x5E, 0x47, 0xB9, 0x76, 0x45, 0xF8, 0x92, 0x17, 0xDC, 0x01, 0xD1, 0x3B,
-    0x31, 0xC7, 0x1A, 0x41, 0xC5, 0x1D, 0x48, 0x54, 0x89, 0xE3, 0xBC, 0x93, 0x98, 0xA8, 0xA4, 0x40,
-    0xC2, 0xC4, 0xD3, 0x1F, 0x09, 0xC1, 0x8B, 0x34, 0x16, 0x7A, 0x26, 0x5D, 0xA9, 0xBB, 0x81, 0x1E,
-    0x90, 0x28, 0xBD, 0x04, 0x56, 0x46, 0xA3, 0x2A, 0xD1, 0x58, 0x05, 0x33, 0xB8, 0x93, 0x2B, 0x67,
-    0xFB, 0x3D, 0xD3, 0x7E, 0xA2, 0x83, 0xBD, 0xAC, 0xD9, 0x44, 0xBF, 0xE4, 0x67, 0xB9, 0x3A, 0xC0,
-    0xED, 0x02, 0x4E, 0x8B, 0x0A, 0x91, 0xC6, 0x10, 0xBC, 0x44, 0x60, 0x40, 0x15, 0x77, 0x7C, 0xDF,
-    0x4A, 0xFB, 0x04, 0x13, 0xC8, 0x12, 0xA1, 0x21, 0xEA, 0x3F, 0xA5, 0x7B, 0x07, 0xB6, 0xF8, 0x37,
-    0xEC, 0xD4, 0xD9, 0x60, 0xBF, 0x46, 0x87, 0xAE, 0xE6, 0xAB, 0x7D, 0x5C, 0xA2, 0x57, 0xD7, 0xCB,
-    0x70, 0xF9, 0x11, 0x70, 0x79, 0x89, 0x12, 0xEA, 0xD7, 0xDE, 0xFB, 0xF5, 0x74, 0xCA, 0x8D, 0xCC,
-    0x77, 0xC7, 0xDF, 0xFD, 0xF2, 0x88, 0x65, 0x73, 0x1E, 0xF2, 0x9A, 0x89, 0xFE, 0x69, 0xE5, 0xC0,
-    0x61, 0xCD, 0xEB, 0xF8, 0x3F, 0x77, 0xCD, 0x73, 0xCF, 0x37, 0xBF, 0xBD, 0x53, 0x6F, 0xCF, 0xC7,
-    0xF5, 0xDF, 0x71, 0x7D, 0x9F, 0xD0, 0x91, 0xAE, 0x68, 0xF2, 0xB2, 0x25, 0x8B, 0xAB, 0xAC, 0x48,
-    0x09, 0x06, 0x61, 0x7C, 0x50, 0x90, 0x79, 0xA6, 0xDE, 0xAE, 0x03, 0x0A, 0x30, 0x0B, 0x49, 0xD4,
-    0x4D, 0x71, 0x17, 0x18, 0x40, 0x1A, 0xA8, 0x9C, 0x4D, 0xC1, 0x27, 0xBE, 0x3B, 0x45, 0xD0, 0x13,
-    0x72, 0x7E, 0x03, 0x15, 0xB8, 0xF5, 0x50, 0xFA, 0xE8, 0x0C, 0x0B, 0x83, 0x0E, 0xE0, 0x06, 0x81,
-    0xF6, 0x18, 0x44, 0xA9, 0xF7, 0xFE, 0xB8, 0x16, 0x1A, 0x92, 0x1E, 0x7F, 0xE2, 0x34, 0x8E, 0xA4,
-    0x8D, 0xA9, 0x04, 0xCA, 0x57, 0x92, 0xF6, 0x7D, 0x5E, 0xFF, 0x50, 0x62, 0x0A, 0xEC, 0x52, 0x64,
-    0x97, 0xE2, 0xBA, 0x94, 0x71, 0xC0, 0x0B, 0x52, 0xFB, 0x4C, 0x2B, 0xB6, 0x8F, 0xA5, 0x19, 0xB1,
-    0x88, 0x45, 0x96, 0x57, 0xBC, 0x10, 0x95, 0x20, 0x9D, 0x25, 0xBE, 0x43, 0x48, 0xD2, 0x9B, 0xC4,
-    0x8E, 0xB4, 0xFC, 0x27, 0xEA, 0x87, 0x6A, 0x23, 0x66, 0x31, 0x4B, 0xCD, 0xF5, 0xA9, 0xCD, 0x16,
-    0x19, 0x42, 0x22, 0x64, 0x98, 0x86, 0x74, 0x4D, 0x52, 0xF7, 0x32, 0x66, 0xC3, 0x0C, 0x03, 0xE9,
-    0xF9, 0x54, 0x90, 0xEF, 0x5D, 0x6A, 0xE7, 0x15, 0xE0, 0xE5, 0x39, 0x75, 0xC3, 0xAC, 0x45, 0x3D,
-    0x87, 0x99, 0xA8, 0xA8, 0x73, 0xB7, 0xD8, 0xA1, 0x47, 0x3D, 0xAE, 0xFF, 0x07, 0xB6, 0x6B, 0xAC,
-    0x0D, 0x58, 0x1E, 0xDC, 0xD7, 0x6A, 0x44, 0x92, 0x2D, 0x6F, 0xA6, 0x1E, 0x4E, 0x92, 0x1B, 0xC0,
-    0x9B, 0xB5, 0x23, 0xDD, 0xC5, 0x11, 0xB5, 0xD7, 0xC1, 0xB9, 0xE5, 0x8F, 0xAD, 0x18, 0x17, 0x54,
-    0x0D, 0x61, 0x1C, 0xD4, 0x8E, 0x21, 0xD0, 0x04, 0x15, 0xE7, 0x1D, 0xB7, 0x88, 0x91, 0xC0, 0xDF,
-    0x25, 0x8E, 0xB1, 0x4B, 0xC3, 0x50, 0x18, 0xC4, 0xEF, 0xF5, 0xA3, 0x7D, 0x34, 0x69, 0x1B, 0x17,
-    0x45, 0x4A, 0xA0, 0x82, 0x1D, 0x82, 0x60, 0x0D, 0xEA, 0x20, 0x12, 0xED, 0x03, 0x07, 0x41, 0x45,
-    0x9C, 0x9D, 0x44, 0x27, 0x27, 0x33, 0x38, 0x38, 0x88, 0xC6, 0x76, 0x73, 0x12, 0xFF, 0x82, 0xA0,
-    0x0E, 0x8E, 0x82, 0x0E, 0x0E, 0x82, 0x5F, 0xED, 0x3F, 0xF0, 0xD4, 0x41, 0xC7, 0xA0, 0x6E, 0x2E,
-    0x4F, 0xC8, 0x24, 0xD6, 0x6A, 0x75, 0x39, 0x8E, 0xE3, 0x77, 0xC7, 0xE5, 0x9B, 0xD9, 0xF1, 0xE1,
-    0x61, 0x7F, 0x63, 0x79, 0x8C, 0xCF, 0x80, 0x41, 0x8A, 0x9E, 0xAB, 0xED, 0xEF, 0x01, 0xED, 0x0A,
-    0x06, 0x9D, 0xFB, 0x84, 0x7A, 0x64, 0xF5, 0x9D, 0x76, 0xCA, 0xB0, 0x1F, 0xD4, 0x74, 0xF3, 0xD0,
-    0x9F, 0x58, 0xAC, 0xE8, 0x3E, 0xE0, 0x96, 0x25, 0x3C, 0x24, 0xA4, 0x5C, 0x5C, 0x10, 0x5B, 0xD1,
-    0x41, 0x63, 0x81, 0x4C, 0x35, 0xE6, 0xF6, 0xA2, 0x4C, 0x4B, 0xD1, 0x5D, 0x93, 0x8A, 0x6E, 0xC5,
-    0xA0, 0xB5, 0x6A, 0x9B, 0xEA, 0x26, 0xBA, 0x5D, 0x4A, 0x6B, 0x8E, 0x0A, 0x76, 0xF1, 0x61, 0xE8,
-    0x89, 0x9D, 0x2D, 0xCC, 0xDC, 0xE0, 0xD3, 0xD0, 0x3B, 0x3B, 0xB7, 0x98, 0xCD, 0xAA, 0xAA, 0x1F,
-    0x0E, 0x9E, 0x14, 0x5E, 0x97, 0x5E, 0x0A, 0xC6, 0xBD, 0x08, 0xF6, 0xBE, 0xEA, 0xA9, 0xAD, 0x91,
-    0x49, 0x72, 0x58, 0xB3, 0x10, 0x5B, 0xD4, 0x19, 0x89, 0xC6, 0x1A, 0x25, 0x84, 0x96, 0xD0, 0x3B,
-    0x35, 0xEA, 0xF6, 0xAF, 0x94, 0x55, 0x1E, 0x43, 0x79, 0x47, 0x5B, 0xB8, 0xEC, 0xF4, 0x03, 0xB0,
-    0xB0, 0x4B, 0xA1, 0xC7, 0x5D, 0x76, 0x11, 0xFE, 0x9D, 0x7E, 0x03, 0x17, 0xA7, 0x1F, 0x7F, 0x57,
-    0x8E, 0xE8, 0xBA, 0xE4, 0xF9, 0xFE, 0x7D, 0xAB, 0x03, 0x55, 0x8F, 0x73, 0x88, 0x8B, 0xD0, 0x6E,
-    0x86, 0x03, 0x20, 0xAB, 0xD6, 0x1B, 0x64, 0x79, 0x0E, 0xDF, 0xB7, 0xE7, 0x65, 0x0A, 0xE4, 0xD4,
-    0xF1, 0x9C, 0x2C, 0x14, 0x26, 0xC3, 0x7D, 0x96, 0x76, 0x9A, 0x05, 0x62, 0xA9, 0x02, 0xA1, 0x1D,
-    0x4C, 0x65, 0x7A, 0x22, 0xB4, 0xAD, 0x02, 0x18, 0x62, 0x07, 0x01, 0xAE, 0x32, 0x5A, 0x46, 0x3D,
-    0x93, 0x8A, 0xE4, 0x37, 0x51, 0x15, 0xCC, 0xE0, 0xC6, 0xC3, 0x36, 0x8C, 0xD0, 0xC4, 0xB6, 0x2A,
-    0xF5, 0x18, 0x91, 0xFC, 0x33, 0xFF, 0x1D, 0x91, 0xD8, 0xD1, 0x28, 0x8C, 0xE4, 0x1A, 0x52, 0xC9,
-    0xB3, 0xC2, 0x38, 0xD1, 0x0F, 0x65, 0x54, 0x31, 0x6F, 0x1C, 0x45, 0x18, 0x7D, 0xBB, 0xA3, 0x78,
-    0x8A, 0x51, 0xBC, 0x29, 0x30, 0x42, 0xF8, 0x92, 0x6D, 0x28, 0x0F, 0x96, 0x22, 0x85, 0x8B, 0x4B,
-    0x76, 0x91, 0x8B, 0x14, 0x29, 0x88, 0x04, 0xC6, 0x4A, 0x87, 0x44, 0x81, 0xA8, 0x72, 0x85, 0x8B,
-    0x14, 0x26, 0x3B, 0xFC, 0x03, 0x17, 0x48, 0xE9, 0x80, 0x86, 0x02, 0xA5, 0xF0, 0x15, 0x48, 0x44,
-    0xC8, 0xCE, 0x8D, 0x63, 0x89, 0x86, 0xE6, 0x42, 0x43, 0x41, 0xB3, 0x22, 0x0E, 0x96, 0x4C, 0xC1,
-    0x08, 0x6F, 0xC4, 0x9E, 0xB5, 0x77, 0x1F, 0x6F, 0xEE, 0x64, 0x1F, 0x0A, 0xAB, 0x7B, 0xDF, 0xED,
-    0x7C, 0x3B, 0x3B, 0xF3, 0xBE, 0x37, 0xEF, 0x5B, 0x80, 0x97, 0x3A, 0x74, 0xB8, 0xB6, 0x0C, 0x0C,
-    0xB6, 0xA0, 0x9E, 0x3A, 0x24, 0x62, 0x23, 0x11, 0xE4, 0x7F, 0x1C, 0xC5, 0x62, 0x90, 0x36, 0x3D,
-    0x4C, 0x9E, 0x55, 0xFA, 0x37, 0x53, 0x64, 0xBD, 0x1E, 0xDA, 0xCA, 0xAB, 0x7F, 0x6E, 0xD9, 0xA4,
-    0xED, 0x22, 0xF7, 0x1E, 0x72, 0x68, 0x63, 0x91, 0x5D, 0x25, 0xD2, 0x1A, 0x11, 0x9F, 0x8A, 0xB8,
-    0x1F, 0x65, 0x1C, 0x56, 0x59, 0x4E, 0x80, 0xAD, 0x35, 0xC4, 0x07, 0x23, 0x5C, 0x5C, 0xAB, 0x53,
-    0x64, 0xE2, 0x93, 0xF1, 0x5D, 0xD5, 0x00, 0x0F, 0x80, 0xC4, 0x21, 0xAA, 0x81, 0x8C, 0x14, 0x7C,
-    0x7C, 0x37, 0x47, 0xFE, 0xDC, 0xAB, 0x51, 0x6E, 0xD7, 0xD4, 0x54, 0xD9, 0x4C, 0x86, 0x5E, 0x44,
-    0xC2, 0xAA, 0x19, 0xD9, 0xDC, 0x93, 0x9D, 0xC5, 0x3A, 0xC8, 0x2A, 0x2E, 0x34, 0x32, 0x23, 0x83,
-    0xEF, 0x01, 0xC3, 0xC4, 0x7D, 0x20, 0x95, 0x96, 0xB4, 0x5D, 0x54, 0x71, 0x5D, 0xFE, 0xA4, 0x05,
-    0x47, 0xD8, 0xE6, 0x73, 0x87, 0xB8, 0x86, 0x9A, 0x00, 0xB9, 0x4C, 0xD7, 0xC9, 0x14, 0x77, 0x90,
-    0x14, 0xA4, 0x90, 0x16, 0xAA, 0x0D, 0x61, 0x1A, 0x82, 0x90, 0x86, 0x92, 0x82, 0xE1, 0x2F, 0x97,
-    0x41, 0x1F, 0x8F, 0x72, 0xE8, 0xE7, 0x3E, 0xC7, 0x90, 0x24, 0x5A, 0x09, 0xC1, 0x54, 0xFB, 0x39,
-    0x4C, 0x75, 0x33, 0x84, 0xAC, 0x44, 0x52, 0x25, 0x53, 0x06, 0xC3, 0xE0, 0x75, 0x08, 0x5C, 0x27,
-    0x92, 0x31, 0x66, 0x24, 0xBC, 0xF6, 0x91, 0x87, 0xE7, 0xCB, 0xD3, 0xCD, 0x97, 0x1F, 0x8D, 0x63,
-    0xBF, 0xE4, 0xA9, 0x53, 0x45, 0x58, 0x75, 0xF6, 0x25, 0xCB, 0xC5, 0xFF, 0x51, 0x2F, 0x90, 0x1F,
-    0x21, 0x94, 0x60, 0x39, 0x02, 0x1F, 0xC1, 0x5D, 0x65, 0x78, 0x57, 0x71, 0xDC, 0x01, 0xEB, 0xD3,
-    0x54, 0x2D, 0xFB, 0x82, 0x85, 0xDC, 0xFC, 0xA6, 0x9C, 0x30, 0x95, 0x4A, 0xA1, 0x61, 0x5E, 0x78,
-    0xD4, 0xB1, 0x7F, 0x07, 0xD9, 0x68, 0x4F, 0xBB, 0x68, 0x92, 0x91, 0x80, 0xFE, 0xD9, 0x6D, 0xA3,
-    0x38, 0xF5, 0x69, 0x51, 0xB6, 0xAD, 0xAE, 0x72, 0xC9, 0xA3, 0x96, 0x5C, 0xBB, 0xC0, 0xF5, 0x0E,
-    0x8F, 0x87, 0xAB, 0x0E, 0x96, 0xE7, 0xF0, 0x89, 0xB2, 0x15, 0xAB, 0x9C, 0x04, 0x98, 0xE4, 0xF7,
-    0x91, 0x7E, 0xFF, 0x6F, 0xA7, 0xBF, 0x3A, 0x75, 0x6A, 0xFF, 0x07, 0xA7, 0xDA, 0xD2, 0xAA, 0x36,
-    0xB7, 0x71, 0x93, 0x17, 0x71, 0x9D, 0x21, 0xF2, 0xE9, 0x0C, 0xDF, 0x16, 0xA0, 0xC8, 0xC5, 0x25,
-    0xD9, 0xAD, 0x92, 0x06, 0x75, 0x52, 0xA3, 0x37, 0xC7, 0x5B, 0xDD, 0xC4, 0xF7, 0xFE, 0x0B, 0xCA,
-    0xD3, 0x25, 0x52, 0xA4, 0xDE, 0xBC, 0x28, 0x3F, 0xA6, 0x0E, 0xC0, 0xEB, 0x43, 0xE0, 0x0D, 0x20,
-    0x76, 0x58, 0x7A, 0xB2, 0x83, 0xE1, 0x14, 0xE8, 0x41, 0x9F, 0xD2, 0x7B, 0x0D, 0xD6, 0x52, 0x6B,
-    0xF0, 0x18, 0x95, 0xB1, 0x09, 0xFF, 0xEA, 0xD4, 0x6A, 0x26, 0x33, 0xEA, 0xF1, 0xD9, 0x6B, 0x9A,
-    0xF2, 0x96, 0x2C, 0x3D, 0x5C, 0xB1, 0x78, 0xC5, 0x53, 0x6F, 0x23, 0xEC, 0x01, 0x37, 0x82, 0xF2,
-    0xD8, 0x3C, 0xB1, 0x54, 0xEC, 0xD2, 0xB0, 0x51, 0xF2, 0x1D, 0x14, 0xBD, 0xD7, 0xCC, 0xFC, 0xA5,
-    0xEB, 0xC0, 0x94, 0x42, 0x39, 0x0C, 0x83, 0xA0, 0x2B, 0x1B, 0x1B, 0x1F, 0xE6, 0xAC, 0x34, 0xE0,
-    0x4A, 0x98, 0x36, 0xC3, 0x2F, 0x08, 0x16, 0xC0, 0xEA, 0x98, 0x93, 0x29, 0xF3, 0xF1, 0x71, 0x01,
-    0xCD, 0x71, 0x5A, 0xCF, 0xC7, 0x0F, 0x83, 0xF4, 0x84, 0xF1, 0x0B, 0x94, 0xD3, 0x30, 0x87, 0xD5,
-    0x6C, 0x47, 0x7B, 0x3A, 0xD8, 0x84, 0x54, 0x6E, 0x2C, 0xED, 0x9E, 0x3C, 0x3A, 0xC3, 0x5E, 0xD4,
-    0x82, 0xF6, 0xB5, 0xB4, 0x50, 0x85, 0xE4, 0xE4, 0x0E, 0x10, 0x58, 0xD3, 0xF3, 0xAF, 0xDE, 0x84,
-    0x0E, 0x99, 0x9C, 0xDF, 0xE0, 0x0A, 0x71, 0x39, 0x74, 0x25, 0xC5, 0x05, 0x33, 0x6F, 0xF2, 0xED,
-    0x52, 0x26, 0x18, 0x3E, 0x8C, 0x90, 0xBF, 0xE7, 0x90, 0xD9, 0x3E, 0x67, 0x76, 0xE8, 0x19, 0xCD,
-    0xF7, 0x23, 0x87, 0x1C, 0x4C, 0xB8, 0xF4, 0x6C, 0xDD, 0xEB, 0x61, 0xC3, 0xC4, 0x13, 0xCE, 0x78,
-    0x5B, 0x37, 0x9D, 0xA4, 0x20, 0x9D, 0x8A, 0xCD, 0xD3, 0x50, 0xEE, 0x09, 0xA9, 0x1C, 0xCD, 0x7B,
-    0x25, 0x0E, 0x1B, 0x93, 0x0D, 0x86, 0xE3, 0x50, 0x2F, 0xB9, 0x2F, 0x3F, 0x92, 0xB0, 0xF3, 0x7E,
-    0x08, 0x4D, 0xD8, 0xBA, 0x9A, 0x95, 0xF2, 0x35, 0x31, 0xBD, 0xE8, 0xB9, 0x45, 0x2A, 0xA7, 0x06,
-    0x90, 0x51, 0x64, 0xF9, 0xB2, 0xCC, 0x42, 0x11, 0x02, 0xA2, 0x50, 0xE8, 0xFC, 0x2A, 0x40, 0x4F,
-    0x91, 0x37, 0xB7, 0x57, 0x7F, 0x62, 0x6F, 0x60, 0x6E, 0xA3, 0x1E, 0x24, 0xB7, 0xF1, 0xB8, 0x6F,
-    0x7E, 0x45, 0x7E, 0xC6, 0x33, 0x5E, 0x12, 0x1B, 0xCF, 0xA6, 0x86, 0x23, 0x38, 0xDF, 0xE3, 0xFC,
-    0x48, 0x70, 0x71, 0x24, 0xE7, 0xA8, 0xE6, 0xD0, 0xAF, 0xC0, 0x2C, 0x8E, 0x63, 0x65, 0x63, 0x93,
-    0x1C, 0x06, 0x50, 0x76, 0xE5, 0xF3, 0x0F, 0x78, 0x77, 0x3F, 0xBA, 0x57, 0x94, 0x23, 0xBA, 0x9D,
-    0xCD, 0xA2, 0x1D, 0xED, 0xC1, 0xF9, 0x25, 0x74, 0x38, 0xFD, 0xD8, 0x42, 0x39, 0xA8, 0x03, 0xCB,
-    0x5E, 0x37, 0x13, 0x94, 0x0E, 0x9F, 0xFE, 0xE4, 0x94, 0xD8, 0xD5, 0x86, 0xF7, 0x97, 0x3F, 0x71,
-    0x3D, 0x75, 0x50, 0x73, 0x18, 0x3A, 0x11, 0x33, 0x8F, 0x9A, 0x99, 0x6A, 0xF1, 0x94, 0x72, 0xB1,
-    0x8F, 0x1F, 0xE0, 0xE5, 0xA1, 0xEB, 0xF5, 0xFD, 0xB5, 0x4E, 0x57, 0xDF, 0xD2, 0xD1, 0xB3, 0x03,
-    0xB7, 0xD5, 0xEF, 0x5F, 0xED, 0x74, 0xD4, 0xBA, 0x46, 0xF5, 0xD4, 0xAD, 0x5D, 0x1F, 0xD0, 0x68,
-    0x3B, 0x33, 0x5B, 0x84, 0x0F, 0x01, 0xBF, 0x41, 0x3D, 0x7A, 0x30, 0x29, 0x8C, 0x53, 0x2E, 0x66,
-    0xA2, 0xE4, 0x91, 0xF0, 0x4B, 0xD9, 0x68, 0xA1, 0x29, 0x42, 0xEB, 0x07, 0x1B, 0xB0, 0xEC, 0x22,
-    0x11, 0x19, 0xCD, 0x13, 0x41, 0x91, 0xBC, 0x98, 0x5B, 0xE2, 0x5F, 0x7D, 0x52, 0x31, 0x6B, 0x14,
-    0x41, 0x14, 0xFE, 0x76, 0x26, 0xBA, 0x09, 0xCB, 0x65, 0x53, 0x04, 0x39, 0xE4, 0x2E, 0xBB, 0x45,
-    0x8A, 0x03, 0xBD, 0xD8, 0x5C, 0x71, 0xC5, 0x5E, 0x6E, 0x34, 0xC5, 0x95, 0xDA, 0xE4, 0x3F, 0x88,
-    0xD5, 0x15, 0x16, 0x01, 0x0F, 0xB2, 0xF8, 0x0B, 0x92, 0x5F, 0xA0, 0xA5, 0x9C, 0x45, 0x2C, 0x04,
-    0x05, 0x09, 0x2E, 0x5E, 0x69, 0x91, 0x59, 0xAC, 0x82, 0x08, 0x8B, 0xA5, 0x58, 0x8C, 0x30, 0xE0,
-    0x11, 0x24, 0xE3, 0x37, 0x77, 0x4B, 0x50, 0x04, 0x87, 0x7D, 0xCC, 0xEC, 0x7B, 0xDF, 0xBC, 0xF7,
-    0xBE, 0xEF, 0x0D, 0x56, 0x01, 0x59, 0x00, 0x06, 0xE8, 0x02, 0x61, 0xBE, 0x38, 0x0D, 0x9D, 0x9B,
-    0x5D, 0x4C, 0x5F, 0xC4, 0x00, 0x32, 0x2C, 0x3C, 0x3E, 0xB0, 0x89, 0xE5, 0xF2, 0x00, 0x8D, 0xC4,
-    0xA9, 0xF0, 0x6C, 0x47, 0x54, 0xE6, 0x6D, 0x3F, 0x0E, 0x72, 0xEF, 0x8C, 0x97, 0xB1, 0x3F, 0x36,
-    0x41, 0x3B, 0x00, 0x82, 0x0A, 0x88, 0x54, 0x9D, 0xEB, 0xD0, 0xB9, 0xA7, 0xD3, 0xE9, 0x1C, 0xD8,
-    0x62, 0xD6, 0x65, 0xE1, 0x6C, 0x89, 0xBC, 0xF6, 0xCF, 0x7D, 0x83, 0x8D, 0x98, 0xDD, 0x99, 0x2C,
-    0xBE, 0x1F, 0xAB, 0xC1, 0xCF, 0x02, 0xCE, 0x40, 0xF0, 0xEA, 0x75, 0xC6, 0x52, 0x5E, 0xA9, 0xA4,
-    0x92, 0x45, 0xA0, 0x23, 0x60, 0xDC, 0xDD, 0xDF, 0x9F, 0xB0, 0xED, 0xCB, 0x36, 0xD3, 0xF1, 0xFF,
-    0x95, 0x28, 0x44, 0x81, 0xE7, 0x52, 0xD5, 0x3D, 0xB3, 0x46, 0xE0, 0x10, 0x3D, 0xD2, 0xB7, 0x3B,
-    0x8F, 0xD3, 0xCE, 0x26, 0x3A, 0xB8, 0xFA, 0xD2, 0x0E, 0xB2, 0x4E, 0x3F, 0x7E, 0x58, 0x09, 0x97,
-    0xE3, 0xD4, 0xD3, 0xBC, 0x71, 0x52, 0xB9, 0x8B, 0x3D, 0x8B, 0x75, 0x8B, 0x9E, 0x85, 0xB6, 0x52,
-    0xD9, 0x36, 0x6C, 0x0A, 0x0B, 0xE4, 0xC9, 0xB7, 0x07, 0xB7, 0x5C, 0x81, 0x21, 0xE4, 0x77, 0x0C,
-    0x7A, 0x52, 0xEB, 0x81, 0xDC, 0xD3, 0xEB, 0x03, 0x6C, 0x1F, 0x01, 0xDB, 0xBE, 0x63, 0x65, 0xE4,
-    0x5D, 0xD3, 0x08, 0xAA, 0xB1, 0xF8, 0x5A, 0x88, 0xCF, 0x90, 0xF3, 0x9B, 0x2F, 0xAB, 0xF7, 0x6E,
-    0xD9, 0x47, 0xAA, 0xE4, 0x4C, 0x75, 0x1B, 0xA2, 0xEA, 0x6F, 0xE1, 0x87, 0x11, 0x67, 0x08, 0x0D,
-    0x92, 0xE9, 0xD1, 0x90, 0x09, 0x7D, 0x94, 0xD6, 0xA7, 0xBD, 0xA6, 0x62, 0x9A, 0x53, 0xA1, 0xE4,
-    0xB1, 0x73, 0xBF, 0xBC, 0x6A, 0x3B, 0xB4, 0x90, 0x67, 0x41, 0x25, 0x31, 0xAF, 0x71, 0x1B, 0xB4,
-    0x15, 0x1F, 0x18, 0x11, 0x5C, 0x1A, 0x48, 0x7B, 0x08, 0xF9, 0xA5, 0x65, 0xE4, 0xA7, 0x51, 0x2C,
-    0x75, 0x59, 0x18, 0xDD, 0x1B, 0xAF, 0xA0, 0xD1, 0x62, 0x94, 0x08, 0x94, 0x2C, 0xD2, 0x1B, 0xE3,
-    0x6F, 0xC7, 0x62, 0xA8, 0xBE, 0x02, 0x87, 0x0F, 0xEA, 0x46, 0xB5, 0x39, 0x20, 0xCA, 0x8F, 0x09,
-    0xCD, 0xF2, 0x4C, 0x50, 0xCC, 0xEE, 0x77, 0x6B, 0x1C, 0xD7, 0x6A, 0xF3, 0x3F, 0x19, 0x15, 0x1D,
-    0x59, 0xA3, 0x15, 0x85, 0xB3, 0x51, 0xA4, 0x26, 0xE5, 0x47, 0x15, 0xDA, 0x27, 0x0A, 0xA7, 0x89,
-    0x42, 0x34, 0x62, 0x9A, 0xE3, 0x7A, 0x1C, 0x29, 0x72, 0x12, 0xEC, 0x7A, 0xB2, 0x06, 0x6D, 0x3E,
-    0x2F, 0xB2, 0xED, 0xC2, 0x39, 0x67, 0x59, 0x44, 0x7E, 0x20, 0xCD, 0x03, 0xF2, 0xBD, 0x24, 0xF1,
-    0xA8, 0xC0, 0x3C, 0x20, 0xB9, 0xBC, 0xED, 0x19, 0x33, 0xC5, 0x1A, 0x5F, 0x0B, 0x27, 0xF1, 0x46,
-    0x63, 0x37, 0xC9, 0xEF, 0x94, 0xCF, 0xEE, 0x9D, 0x37, 0x33, 0x1C, 0xE7, 0x58, 0x63, 0x5B, 0x57,
-    0x9B, 0x38, 0x6F, 0x4E, 0x92, 0xF2, 0x44, 0x11, 0x82, 0x77, 0x1A, 0x82, 0x8C, 0xF8, 0xD0, 0x7F,
-    0x03, 0x85, 0x52, 0x31, 0x6F, 0xD3, 0x40, 0x14, 0xFE, 0xEC, 0x53, 0x72, 0x2A, 0xA6, 0xB9, 0xA9,
-    0x0C, 0x2D, 0xD4, 0x0C, 0x0C, 0x0C, 0x80, 0x97, 0x0E, 0x0C, 0x8E, 0x63, 0x89, 0x81, 0x89, 0x31,
-    0x42, 0xAA, 0x84, 0x58, 0x98, 0x60, 0xC8, 0x92, 0xA1, 0x43, 0xA4, 0x1C, 0xFF, 0x00, 0x89, 0x3F,
-    0xC0, 0x40, 0x17, 0x16, 0x32, 0x30, 0x64, 0x48, 0x9B, 0x13, 0x95, 0x60, 0xC4, 0xA2, 0x2B, 0xC3,
-    0x0D, 0x61, 0xE6, 0x06, 0x23, 0x5C, 0xC9, 0xE9, 0xE3, 0x9D, 0x1D, 0x18, 0xE1, 0xC9, 0xEF, 0xE4,
-    0x77, 0xF7, 0xDE, 0xFB, 0xBE, 0xEF, 0xDD, 0x01, 0x39, 0x82, 0x0A, 0xB8, 0x0B, 0xF4, 0x36, 0xDF,
-    0xB3, 0x5E, 0x44, 0x8F, 0xE2, 0x07, 0xDF, 0xFA, 0xA8, 0x53, 0x2C, 0x26, 0x38, 0x4A, 0x31, 0xCE,
-    0xE0, 0x92, 0x1F, 0x56, 0x91, 0x09, 0x2F, 0xD1, 0x5A, 0xB0, 0x5C, 0x09, 0x23, 0x88, 0xCE, 0x8C,
-    0xA8, 0x04, 0xF1, 0x82, 0x81, 0xE1, 0x46, 0xD2, 0xE1, 0x04, 0x62, 0x8D, 0x01, 0xE4, 0x17, 0xAD,
-    0xB4, 0x3C, 0xB3, 0xA2, 0x90, 0x66, 0x81, 0x52, 0xEA, 0x04, 0x99, 0xE4, 0x2D, 0xF5, 0x59, 0x0B,
-    0x1B, 0x92, 0x16, 0x25, 0xA6, 0xDF, 0x5F, 0xD4, 0x50, 0x44, 0x84, 0xA8, 0x59, 0x9E, 0x12, 0xE5,
-    0x32, 0x1F, 0x5D, 0x20, 0xC8, 0xF1, 0xC7, 0x64, 0x01, 0x28, 0x0B, 0xC4, 0x0E, 0xC8, 0xE6, 0xC0,
-    0x64, 0x02, 0x54, 0x19, 0x82, 0x32, 0x81, 0x70, 0x4A, 0x8B, 0x22, 0x32, 0x91, 0x91, 0x96, 0xFF,
-    0x5C, 0xC2, 0x4A, 0x06, 0x40, 0x3D, 0x25, 0x6A, 0x7C, 0x67, 0x38, 0xE4, 0x8E, 0x76, 0x2E, 0xCC,
-    0x3D, 0xB8, 0x48, 0xA7, 0xA1, 0x55, 0xF8, 0x67, 0xD0, 0xCD, 0x6F, 0xFF, 0x37, 0xA7, 0x0D, 0xE4,
-    0xCF, 0xD1, 0x63, 0xA2, 0x6A, 0x67, 0xC8, 0xEB, 0x7D, 0xC0, 0x42, 0x68, 0x6C, 0x03, 0x07, 0x80,
-    0xC1, 0x1D, 0x44, 0x10, 0x06, 0x0E, 0xFD, 0xE1, 0x43, 0xA2, 0x29, 0x31, 0xF1, 0xCE, 0xF3, 0xD7,
-    0xD4, 0x0E, 0xAE, 0x33, 0x64, 0x49, 0xC4, 0xF9, 0x2C, 0x8B, 0x53, 0x00, 0x96, 0x84, 0x3E, 0xBB,
-    0x62, 0x8F, 0x0C, 0x20, 0x58, 0x6B, 0x50, 0x72, 0xB0, 0x60, 0xCF, 0x80, 0x9B, 0x71, 0x0E, 0xA5,
-    0x0C, 0xC2, 0x5F, 0x9C, 0x3D, 0xE0, 0x9B, 0x8A, 0xD6, 0x7C, 0x40, 0xEC, 0xE1, 0xBC, 0x6B, 0x05,
-    0x9D, 0x53, 0x68, 0xB3, 0x62, 0xE6, 0x44, 0x71, 0xF5, 0x00, 0x4E, 0x3C, 0x61, 0xF8, 0xF3, 0x5C,
-    0xE9, 0x99, 0x8B, 0xA8, 0x4E, 0xE8, 0xFD, 0x5A, 0xD0, 0xC7, 0x35, 0x76, 0x75, 0x0B, 0xEE, 0x31,
-    0x6A, 0xAE, 0x74, 0x3C, 0xDF, 0xD4, 0x0F, 0xD7, 0xEF, 0x7F, 0xF0, 0xE8, 0xF9, 0x86, 0x8E, 0xA7,
-    0x11, 0xF8, 0x9F, 0x7D, 0x8F, 0x60, 0x37, 0xE4, 0x1A, 0xB6, 0xBE, 0x80, 0x75, 0xF1, 0x15, 0xF8,
-    0x36, 0xBE, 0x92, 0xD9, 0xDC, 0x4A, 0x72, 0x24, 0x2C, 0x31, 0xA4, 0xB5, 0x17, 0xC6, 0xBB, 0x1D,
-    0x6E, 0x75, 0x45, 0x7E, 0xAD, 0x36, 0x0F, 0x25, 0x7C, 0x59, 0x9E, 0x0E, 0x7C, 0x72, 0x5C, 0x6C,
-    0xA5, 0xE3, 0xDE, 0xD1, 0xFE, 0x8D, 0xB1, 0xAC, 0xDB, 0xA3, 0xD8, 0x6E, 0xA5, 0xFD, 0xED, 0x71,
-    0xD4, 0x86, 0x92, 0x9D, 0x61, 0xAE, 0x33, 0x08, 0x77, 0x98, 0x31, 0x83, 0x37, 0x03, 0xA2, 0x4F,
-    0xC7, 0xB3, 0xE6, 0x59, 0x86, 0x06, 0xD7, 0x4E, 0xDE, 0xF1, 0x3C, 0xAB, 0xB0, 0x68, 0xA8, 0x30,
-    0xE3, 0xC0, 0xB6, 0xA4, 0xFE, 0x5A, 0x97, 0x8F, 0xA6, 0x1A, 0x11, 0xF3, 0x5A, 0x6A, 0xC4, 0x55,
-    0x13, 0x61, 0xBA, 0x62, 0x28, 0x7A, 0x05, 0x8C, 0x78, 0x09, 0x96, 0x6E, 0x23, 0x10, 0xF1, 0x31,
-    0xB0, 0x47, 0xF4, 0x16, 0x38, 0x5C, 0x34, 0x04, 0x38, 0x45, 0xF8, 0xE1, 0x8E, 0xB8, 0x6F, 0xF3,
-    0xCE, 0x13, 0xAE, 0x0C, 0x99, 0xDD, 0x5E, 0xCD, 0xD2, 0xCA, 0x2E, 0x5D, 0x40, 0x5D, 0xE6, 0xED,
-    0xAC, 0x1A, 0x3B, 0x2C, 0x77, 0x89, 0x56, 0x19, 0xF7, 0xF9, 0x0D,
+static const uint8_t opendyslexic_10_regularBitmaps[20091] = {
+    0xB5, 0x99, 0x41, 0x8C, 0xDE, 0xC6, 0x75, 0xC7, 0x7F, 0xC3, 0x91, 0xC4, 0x46, 0xB4, 0x77, 0x74,
+    0x90, 0x10, 0xDB, 0xB2, 0x45, 0x1F, 0x7C, 0xB0, 0x0D, 0x49, 0xCC, 0x41, 0x87, 0x45, 0xC1, 0xEF,
+    0x9B, 0x91, 0x05, 0xD4, 0x07, 0x23, 0xB0, 0x80, 0x4A, 0x05, 0xE2, 0xA2, 0x88, 0x0F, 0x3D, 0xA4,
+    0x69, 0x5A, 0xA9, 0xA8, 0x0E, 0x9B, 0xF6, 0xDB, 0xFD, 0x68, 0xEB, 0x90, 0x83, 0x8B, 0x6A, 0xD1,
+    0xA2, 0xBD, 0xF4, 0x50, 0x07, 0xB0, 0x01, 0x5B, 0x2E, 0x20, 0xA1, 0x10, 0x8A, 0x45, 0xCD, 0xDD,
+    0x6F, 0xA4, 0x3D, 0xF8, 0xE0, 0x83, 0x28, 0x2B, 0x86, 0x81, 0xB8, 0x40, 0x59, 0xCB, 0x45, 0xD2,
+    0x04, 0x88, 0xC7, 0x16, 0x93, 0x50, 0x32, 0x3F, 0xBE, 0x1E, 0xBE, 0x6F, 0x57, 0x32, 0x1C, 0x07,
+    0x72, 0xD3, 0xCC, 0x9B, 0x47, 0x12, 0xE4, 0xBC, 0x37, 0x9C, 0x99, 0x37, 0xEF, 0xCD, 0x7F, 0x06,
+    0x97, 0x6B, 0x3F, 0xCB, 0xA3, 0xD8, 0x8F, 0x12, 0x5F, 0x26, 0xBE, 0x34, 0x7E, 0x07, 0xAA, 0xCD,
+    0x36, 0x3B, 0xEB, 0xB3, 0xEF, 0x85, 0x69, 0xBA, 0xD9, 0x8C, 0xCD, 0xE5, 0xC6, 0xC6, 0x75, 0x97,
+    0x15, 0x68, 0x7F, 0x10, 0xC8, 0x23, 0x0F, 0xDA, 0xE7, 0xC0, 0x92, 0xF6, 0x10, 0x17, 0x39, 0x4A,
+    0x44, 0xA4, 0xCB, 0x44, 0x44, 0x1C, 0x4D, 0x52, 0x80, 0x71, 0x6B, 0x40, 0x30, 0x0E, 0x52, 0x1A,
+    0x50, 0xC1, 0x38, 0xAC, 0x88, 0xC8, 0x31, 0x11, 0x91, 0x80, 0x55, 0x01, 0x74, 0x9D, 0x01, 0xC3,
+    0x28, 0x40, 0x5C, 0x0D, 0xD9, 0x4A, 0xF1, 0x7D, 0x10, 0x6D, 0x3A, 0x22, 0xE9, 0x89, 0x45, 0x0A,
+    0x2D, 0x7F, 0x76, 0x3C, 0xBA, 0xBD, 0xE9, 0xE8, 0x4E, 0x57, 0xD8, 0x87, 0x8F, 0x90, 0x7C, 0x7A,
+    0x3F, 0x88, 0x14, 0x24, 0xD2, 0xC3, 0x61, 0x69, 0x88, 0x8D, 0x38, 0xB5, 0x39, 0xAE, 0x39, 0xFD,
+    0x51, 0x67, 0x45, 0xFA, 0x4C, 0x44, 0x52, 0x11, 0x51, 0x13, 0xB9, 0x05, 0x0F, 0x1F, 0x81, 0xF8,
+    0xFE, 0x2D, 0xF5, 0xCA, 0xC3, 0x91, 0xA4, 0x4E, 0xA2, 0x17, 0x8B, 0xEA, 0x6B, 0xF7, 0xE5, 0x9A,
+    0xB7, 0xF8, 0xDA, 0xC3, 0x75, 0x24, 0xFF, 0x42, 0xF2, 0xA3, 0x02, 0x7E, 0xD9, 0x70, 0xE0, 0xB2,
+    0xD7, 0x3F, 0xDE, 0xCD, 0xBF, 0xBA, 0x97, 0x0F, 0x3C, 0xBE, 0xA0, 0xBD, 0xF8, 0xA5, 0x38, 0x24,
+    0x73, 0xE9, 0x48, 0x0A, 0xCC, 0x1B, 0x81, 0xC3, 0x5C, 0x62, 0x40, 0x43, 0xA6, 0x02, 0xE6, 0xED,
+    0x0A, 0x2D, 0xA0, 0x3B, 0x30, 0x02, 0xD9, 0xF7, 0xFC, 0x83, 0x56, 0x35, 0x83, 0x31, 0x83, 0x72,
+    0x8C, 0x69, 0x6D, 0x91, 0x86, 0x4C, 0xA4, 0x4D, 0xA4, 0x7F, 0x40, 0x4D, 0x6A, 0x00, 0xEC, 0xB9,
+    0xEB, 0xA1, 0xB3, 0xC6, 0xF3, 0x72, 0xEC, 0x72, 0x55, 0x19, 0x16, 0xA3, 0xCA, 0xB0, 0xA8, 0xAA,
+    0xC4, 0xE5, 0x04, 0xED, 0x0D, 0x39, 0x97, 0xA2, 0x2A, 0x2E, 0x0C, 0x39, 0x8D, 0xAA, 0xB5, 0x37,
+    0x2E, 0x65, 0x40, 0xF9, 0x38, 0x67, 0x08, 0xAA, 0xD2, 0x3E, 0x71, 0x0B, 0xE4, 0x5C, 0x52, 0xF5,
+    0xAC, 0xCC, 0x4C, 0x46, 0xD5, 0x49, 0x71, 0x88, 0x10, 0xFB, 0xC3, 0x34, 0xB1, 0x1F, 0xAA, 0x60,
+    0x0A, 0xF6, 0xA0, 0xBC, 0xD2, 0xDA, 0xFC, 0xCD, 0x5A, 0xDC, 0xA3, 0x1B, 0xDE, 0xDC, 0x30, 0x5F,
+    0x3F, 0xC8, 0x11, 0xA8, 0xE0, 0x31, 0xA8, 0xD1, 0x05, 0x0B, 0x3C, 0xB9, 0xF1, 0x7D, 0x11, 0xAF,
+    0x0B, 0x16, 0x60, 0x11, 0x6A, 0xB2, 0x73, 0xD7, 0x43, 0xB7, 0x62, 0x1D, 0xC4, 0x22, 0x63, 0x09,
+    0x7B, 0x47, 0xE5, 0x14, 0x80, 0x9D, 0xF0, 0x30, 0x1C, 0x84, 0x45, 0x38, 0x03, 0x17, 0x21, 0x40,
+    0x4D, 0x54, 0xA1, 0x3D, 0xBA, 0x20, 0x76, 0x24, 0x60, 0xE0, 0x00, 0x1C, 0x82, 0x1C, 0x72, 0x58,
+    0x83, 0x00, 0x01, 0xB5, 0x55, 0x30, 0xF6, 0x24, 0x05, 0xC6, 0x61, 0xE0, 0x30, 0x0C, 0xE0, 0x08,
+    0x38, 0xE0, 0x3C, 0xFA, 0x45, 0xBF, 0xC0, 0xC5, 0x83, 0x1C, 0xC9, 0x59, 0xCC, 0xF3, 0x3C, 0xCF,
+    0xF3, 0x51, 0x9E, 0x8F, 0x1E, 0xCF, 0x73, 0x46, 0x03, 0x4A, 0xAB, 0xBA, 0x4C, 0x1A, 0x23, 0x21,
+    0x96, 0x4A, 0xF5, 0x00, 0x63, 0xD2, 0xA0, 0xCE, 0x41, 0xC0, 0xCC, 0x2E, 0x2A, 0x90, 0x6E, 0x5D,
+    0x62, 0x99, 0x8E, 0xE5, 0x3D, 0x99, 0xAA, 0xD7, 0x11, 0xD1, 0xAB, 0x2B, 0x90, 0x43, 0x83, 0xAE,
+    0x30, 0xD0, 0x91, 0x54, 0x4C, 0x48, 0x43, 0x24, 0x64, 0x01, 0x91, 0xEB, 0x22, 0xFF, 0x2C, 0x7D,
+    0xD2, 0xF3, 0xFA, 0x29, 0x47, 0x02, 0x0F, 0xC3, 0x69, 0xB4, 0x7F, 0xA8, 0x44, 0x2A, 0xE2, 0x80,
+    0xAE, 0x48, 0x0A, 0x0E, 0xEF, 0x8D, 0x1A, 0x91, 0x4D, 0x99, 0xEE, 0x92, 0x02, 0x20, 0x76, 0x18,
+    0x47, 0x56, 0xF0, 0xD7, 0x05, 0x37, 0x0B, 0x7D, 0xDD, 0x27, 0x67, 0x7D, 0xAA, 0xFD, 0xF0, 0xAB,
+    0x3F, 0x18, 0x4B, 0xF7, 0xBB, 0x17, 0x5A, 0xE2, 0x8A, 0x64, 0x96, 0xEB, 0x7D, 0x27, 0x9D, 0xC8,
+    0x31, 0x8F, 0x81, 0x1C, 0x02, 0xFA, 0x27, 0xCE, 0x48, 0xBD, 0x27, 0x0A, 0xE8, 0x0A, 0xE3, 0x18,
+    0x3C, 0x11, 0x07, 0x91, 0x4D, 0xE9, 0x92, 0xDE, 0xF1, 0xD0, 0xCB, 0x4A, 0x42, 0x52, 0xB0, 0x00,
+    0x07, 0x21, 0xFF, 0x06, 0x56, 0xAA, 0xF1, 0x0B, 0x61, 0x85, 0x51, 0x4E, 0x9E, 0x93, 0x0F, 0xC8,
+    0x33, 0x4A, 0x23, 0x4D, 0x2C, 0xB5, 0x12, 0x07, 0x4A, 0xE4, 0xDA, 0x73, 0x17, 0xE6, 0xAA, 0x93,
+    0x82, 0x21, 0x34, 0xC4, 0x15, 0x19, 0x74, 0xE8, 0x40, 0x5A, 0xD0, 0xA3, 0x1B, 0x52, 0xAF, 0x26,
+    0x2E, 0x39, 0x1A, 0x16, 0x38, 0xF3, 0x08, 0x8B, 0x87, 0x58, 0x3C, 0xC0, 0x9A, 0x79, 0x21, 0x68,
+    0xA9, 0x62, 0xA9, 0xD2, 0xA3, 0xED, 0x80, 0x7C, 0xC4, 0x60, 0xC0, 0xC0, 0x1E, 0xED, 0x52, 0x69,
+    0x22, 0x29, 0x54, 0xEF, 0xCC, 0x3F, 0x55, 0x87, 0x54, 0xC8, 0x69, 0x16, 0x29, 0x97, 0x18, 0x2D,
+    0x32, 0xCA, 0x19, 0x65, 0xAA, 0x33, 0xD2, 0x45, 0x52, 0xCE, 0x86, 0xD9, 0xBC, 0xD1, 0xA4, 0x12,
+    0x52, 0x29, 0x76, 0xC7, 0xEF, 0xB4, 0xFD, 0x7C, 0xCE, 0xBC, 0xD0, 0x6C, 0xD8, 0xE2, 0x21, 0xB3,
+    0xF9, 0xF1, 0xCC, 0x80, 0x48, 0x6E, 0x34, 0x9D, 0x4D, 0xCF, 0x55, 0xC0, 0x71, 0xC8, 0x1C, 0x49,
+    0x43, 0x3C, 0x45, 0x89, 0x63, 0x52, 0x11, 0x37, 0x60, 0x7A, 0x47, 0x22, 0x1F, 0xC2, 0x29, 0x29,
+    0xD8, 0x25, 0xC0, 0xC1, 0x9D, 0xDF, 0xFE, 0x7B, 0xE9, 0xB7, 0x67, 0x61, 0xFF, 0xE4, 0xAB, 0xC7,
+    0xF7, 0x02, 0xEB, 0xC0, 0xA4, 0x80, 0xAC, 0x86, 0x64, 0x0A, 0x4A, 0x1C, 0x4C, 0xE0, 0x54, 0xC7,
+    0x44, 0xDC, 0xA4, 0x77, 0x71, 0xEF, 0x78, 0x70, 0x2E, 0xD5, 0xBB, 0x4C, 0xEA, 0x41, 0xD4, 0xEC,
+    0xA1, 0xDC, 0xB2, 0xCB, 0x1C, 0x4A, 0x68, 0xD0, 0x81, 0xD4, 0x23, 0xD0, 0xDD, 0x95, 0x57, 0x01,
+    0x38, 0x01, 0xED, 0xD6, 0x1B, 0x76, 0x3A, 0x88, 0xA5, 0x86, 0x5B, 0x2A, 0x60, 0x1C, 0x17, 0x09,
+    0x50, 0xC7, 0x47, 0x3F, 0x55, 0x3E, 0xBF, 0xEF, 0xA0, 0x26, 0x1C, 0x3F, 0x7D, 0x5F, 0x7C, 0xE5,
+    0xA8, 0xFF, 0x5A, 0xB6, 0x3B, 0x89, 0x7C, 0x99, 0x4E, 0x0F, 0xA9, 0xF6, 0xA1, 0x53, 0xB5, 0x0E,
+    0xEC, 0x25, 0x09, 0x80, 0xB9, 0xA5, 0x56, 0x49, 0x67, 0xDE, 0x4B, 0x40, 0xC9, 0x8F, 0xB7, 0xFC,
+    0x52, 0x00, 0x7A, 0xC0, 0x7A, 0x38, 0xDC, 0x80, 0xF9, 0x73, 0x88, 0xDF, 0xF2, 0x44, 0x75, 0x03,
+    0x4D, 0x06, 0xA3, 0xD8, 0x33, 0xA4, 0xC5, 0xB8, 0x8C, 0xC4, 0xC7, 0x95, 0xBE, 0x7D, 0xBE, 0x55,
+    0x22, 0xC2, 0x44, 0xA4, 0xB2, 0xD0, 0xA5, 0x05, 0xD6, 0x78, 0x92, 0xDA, 0xDE, 0x76, 0x5A, 0xC4,
+    0x0D, 0x58, 0xD6, 0x95, 0xAA, 0x07, 0x98, 0xD9, 0x6D, 0x59, 0x8B, 0x38, 0x2B, 0xAD, 0xAE, 0xA2,
+    0x66, 0x40, 0xB2, 0x59, 0x31, 0x1A, 0x10, 0x5F, 0xAF, 0x98, 0x0E, 0x4F, 0x4E, 0x36, 0x45, 0x3A,
+    0x2B, 0xA2, 0x65, 0x66, 0xD3, 0xEC, 0xEF, 0xC9, 0x24, 0x98, 0x5B, 0xDF, 0xD0, 0x2D, 0xAC, 0x80,
+    0xF1, 0xA8, 0x06, 0x32, 0xD0, 0x01, 0xEC, 0xFC, 0x56, 0xA0, 0x7B, 0xC8, 0xE4, 0x7C, 0x10, 0x91,
+    0x44, 0x24, 0x64, 0x22, 0x9C, 0x92, 0x55, 0xC0, 0xDE, 0x76, 0x18, 0xE9, 0xD1, 0x22, 0x0D, 0x8D,
+    0x12, 0x37, 0x20, 0x0E, 0xC6, 0xB1, 0xA1, 0x2B, 0x8C, 0x6F, 0x88, 0xC2, 0x00, 0xD6, 0x8D, 0x23,
+    0x3D, 0x5B, 0x11, 0xD7, 0x0D, 0x51, 0x3B, 0x20, 0x9A, 0x9A, 0x7F, 0x78, 0x43, 0xB4, 0x88, 0x14,
+    0x22, 0xE2, 0xAD, 0x48, 0x61, 0xE4, 0x16, 0xB0, 0xF3, 0x64, 0x22, 0xF2, 0xA2, 0x48, 0x55, 0xC2,
+    0x61, 0x48, 0x0A, 0xA2, 0x1A, 0xD6, 0x9F, 0x73, 0x99, 0x54, 0x46, 0x1A, 0x1D, 0xA0, 0x85, 0x21,
+    0x98, 0x02, 0x7D, 0xFB, 0xFC, 0xEA, 0xAC, 0x35, 0x46, 0xC4, 0xEF, 0x9E, 0x74, 0x56, 0xFE, 0xAB,
+    0x21, 0xF6, 0xA4, 0x30, 0x42, 0xDD, 0x7E, 0x3D, 0x91, 0x2E, 0x93, 0xBA, 0x24, 0x0A, 0x24, 0x1E,
+    0x3B, 0x9F, 0x1C, 0x66, 0xFE, 0x38, 0x4B, 0xBB, 0xA4, 0x25, 0x13, 0x71, 0x59, 0x0D, 0xA6, 0x82,
+    0xA4, 0x06, 0xDD, 0x30, 0x2B, 0x60, 0x01, 0xE3, 0x41, 0x07, 0xFA, 0xD5, 0x8E, 0xAC, 0xB7, 0x90,
+    0xBD, 0x54, 0x93, 0x1C, 0xED, 0xD1, 0x95, 0x15, 0x69, 0x13, 0x91, 0x9E, 0x89, 0x88, 0x8B, 0x26,
+    0xB7, 0xD8, 0x09, 0xC7, 0x33, 0x68, 0xEF, 0xE2, 0x6E, 0x8B, 0xED, 0xDD, 0x3C, 0xFB, 0xEB, 0x3B,
+    0xEC, 0xD4, 0x16, 0x4F, 0x6D, 0xA1, 0xA6, 0x4F, 0x9A, 0xCD, 0xD0, 0x65, 0xC9, 0x95, 0x50, 0xCE,
+    0x2E, 0xE6, 0x7A, 0x33, 0xB5, 0xE7, 0x6A, 0x40, 0xD7, 0xAA, 0x65, 0x85, 0xB4, 0x88, 0x6B, 0xD5,
+    0xB0, 0x4C, 0xEA, 0xE2, 0x2A, 0x6A, 0x28, 0xC9, 0x48, 0x7C, 0x14, 0x28, 0xC9, 0x30, 0x5E, 0x07,
+    0xDD, 0xDA, 0xA9, 0x11, 0x2D, 0xBC, 0x4A, 0xE2, 0x2D, 0x59, 0xD4, 0x50, 0xA6, 0x85, 0xAE, 0x3B,
+    0xCC, 0x4B, 0x15, 0x43, 0x0B, 0xB7, 0x1B, 0xB4, 0x14, 0x98, 0x0E, 0xC6, 0x35, 0x4A, 0x3C, 0xB1,
+    0x78, 0xB2, 0xB1, 0xA7, 0x1C, 0x7B, 0x1D, 0x26, 0xDE, 0x78, 0xF1, 0x16, 0xF1, 0x9D, 0x12, 0xBF,
+    0x1B, 0xD2, 0xCF, 0xE6, 0xEC, 0x73, 0xD9, 0xCE, 0xF2, 0xBE, 0xE7, 0xAC, 0xC8, 0x2C, 0xEF, 0x5E,
+    0x65, 0xF7, 0xAA, 0xF5, 0xD8, 0x42, 0x5C, 0xD4, 0xC7, 0x3D, 0xA6, 0x4D, 0x3B, 0xC6, 0x61, 0xDC,
+    0x6A, 0xB9, 0xFC, 0x69, 0x30, 0x12, 0x5F, 0xAD, 0xD6, 0xBB, 0x2C, 0xDB, 0xBC, 0x19, 0xCA, 0x71,
+    0x7A, 0xEE, 0x4A, 0xE8, 0xA7, 0x36, 0xB9, 0x26, 0x61, 0x6A, 0x8F, 0xC9, 0xD9, 0x66, 0x9A, 0x74,
+    0xE9, 0xF5, 0x26, 0x0D, 0xE3, 0x73, 0xB5, 0x3D, 0xDA, 0xDB, 0xE2, 0x5B, 0x49, 0xDB, 0x43, 0x16,
+    0x80, 0x27, 0x92, 0x8A, 0x81, 0x09, 0x2C, 0x9B, 0x86, 0x65, 0xD3, 0x31, 0x32, 0x53, 0x4A, 0x33,
+    0xA1, 0x34, 0x17, 0x5C, 0x99, 0x9E, 0x2B, 0xBA, 0xF4, 0x25, 0xDF, 0xA5, 0x67, 0xEB, 0x2E, 0x7B,
+    0x31, 0x74, 0x59, 0xD1, 0x76, 0x59, 0xB1, 0xDE, 0xD9, 0xC2, 0xB6, 0xB6, 0xB0, 0xAD, 0xF5, 0x69,
+    0x6B, 0xBD, 0x69, 0xD9, 0xDF, 0x3B, 0xAC, 0x74, 0xD8, 0xC2, 0x7A, 0x5B, 0xE8, 0x36, 0x2D, 0xB0,
+    0x49, 0x45, 0x7C, 0x3D, 0x40, 0xDB, 0x82, 0x1D, 0x40, 0x72, 0xD5, 0x11, 0xDD, 0xAC, 0xA1, 0xED,
+    0x60, 0x98, 0x15, 0xD8, 0xA7, 0xFB, 0x7F, 0x9C, 0x78, 0x11, 0x09, 0xA9, 0x48, 0x50, 0x22, 0x0D,
+    0xBB, 0x64, 0xE6, 0x40, 0x52, 0x59, 0x8D, 0x45, 0x54, 0x88, 0xC3, 0x88, 0x3C, 0xC3, 0x3C, 0xE3,
+    0xF5, 0x95, 0x10, 0x87, 0x89, 0xB4, 0x99, 0xB4, 0xE6, 0x27, 0xC7, 0x75, 0x80, 0x0E, 0x2C, 0x18,
+    0x8F, 0x0E, 0x30, 0x05, 0xEB, 0x30, 0x15, 0x90, 0xDE, 0x82, 0xB1, 0xD4, 0x8C, 0x99, 0xB0, 0x42,
+    0x5C, 0x5B, 0x28, 0x53, 0x87, 0x79, 0xC9, 0x13, 0xDD, 0x0C, 0x50, 0xB6, 0x90, 0x0E, 0x21, 0xBE,
+    0x3A, 0x7F, 0xD1, 0xAD, 0xF3, 0xFC, 0x30, 0xAD, 0xAC, 0x1C, 0x13, 0x11, 0x3F, 0x16, 0xF1, 0x89,
+    0x48, 0x45, 0x26, 0x1D, 0x44, 0xE2, 0x21, 0xEB, 0x20, 0x3A, 0xEF, 0x4C, 0x5F, 0x20, 0xE2, 0x16,
+    0x28, 0xA9, 0x75, 0xB5, 0xC0, 0x61, 0x55, 0xAB, 0xFA, 0x00, 0x43, 0x55, 0xA7, 0x55, 0x2A, 0x6D,
+    0x24, 0x3D, 0x99, 0xB4, 0x51, 0x93, 0x54, 0x99, 0x1B, 0xEA, 0x26, 0x0A, 0xD6, 0xD9, 0x63, 0x8D,
+    0x6E, 0x6D, 0x61, 0x37, 0x5B, 0xDD, 0xB1, 0x5F, 0x56, 0xB1, 0xD2, 0x90, 0xDD, 0x7E, 0x0D, 0x53,
+    0x81, 0xAE, 0xE6, 0x2E, 0x6C, 0x08, 0x24, 0xFD, 0x2A, 0x4C, 0xA4, 0x60, 0x97, 0x4C, 0x41, 0x4D,
+    0x2A, 0x88, 0x3B, 0x50, 0xE2, 0x8E, 0x23, 0xD5, 0x58, 0x24, 0x58, 0x91, 0xC6, 0x8A, 0x34, 0x91,
+    0xCC, 0x3B, 0x69, 0xDF, 0xC9, 0x93, 0x27, 0xAC, 0xC8, 0xD4, 0x8A, 0x4C, 0xF7, 0xE8, 0xB9, 0xC2,
+    0x6D, 0xAE, 0x67, 0x1C, 0x7F, 0x01, 0x27, 0x61, 0x9B, 0x9F, 0x44, 0xBD, 0x36, 0x25, 0xB9, 0xD9,
+    0x90, 0x5E, 0xF5, 0x8C, 0x2D, 0xAA, 0xEB, 0x88, 0x6F, 0x04, 0xD2, 0x73, 0x9E, 0x15, 0x0B, 0x6D,
+    0x89, 0xFE, 0x20, 0x60, 0x5E, 0xF2, 0x2C, 0x67, 0x2E, 0x6A, 0x26, 0xA4, 0xD7, 0x44, 0x44, 0x8B,
+    0x74, 0x89, 0x48, 0x15, 0xCB, 0x2C, 0x48, 0x3D, 0x01, 0xBB, 0x5E, 0x0C, 0xD0, 0xA5, 0x8E, 0xD4,
+    0x75, 0xE8, 0x90, 0x78, 0x2C, 0x2B, 0x24, 0x95, 0x0E, 0x74, 0x58, 0x97, 0x7A, 0xD5, 0xEA, 0x06,
+    0xE3, 0x2D, 0x4C, 0x93, 0x40, 0x52, 0x4F, 0xC1, 0xA6, 0x1E, 0x2D, 0x1D, 0x64, 0xE2, 0x50, 0x12,
+    0x66, 0x2B, 0x42, 0x26, 0x35, 0x43, 0x80, 0xB6, 0x04, 0xE2, 0x77, 0x02, 0x90, 0xC5, 0x15, 0xD0,
+    0x99, 0x02, 0x74, 0x6D, 0xC9, 0x48, 0x5D, 0xC9, 0x94, 0x4E, 0x35, 0x49, 0xA7, 0x83, 0xAE, 0x6D,
+    0x93, 0x16, 0xE6, 0x8A, 0x84, 0x75, 0xAC, 0x79, 0xFF, 0x7A, 0x60, 0x7D, 0x92, 0x5E, 0xF5, 0xEA,
+    0xD3, 0xD6, 0x6E, 0xA0, 0xC5, 0x4F, 0x1A, 0x8C, 0x28, 0xF1, 0xD8, 0x46, 0x0B, 0x4C, 0x7C, 0xD2,
+    0xA2, 0x7A, 0x4C, 0xC5, 0x6E, 0xC7, 0x43, 0x2A, 0x60, 0xDC, 0x90, 0xA4, 0xD0, 0x55, 0xEC, 0x29,
+    0x75, 0x85, 0xD9, 0x0C, 0xA8, 0xDB, 0x01, 0x6C, 0x3B, 0x5B, 0xA8, 0xD2, 0x03, 0x93, 0x0A, 0xC6,
+    0x1D, 0xD8, 0x53, 0x1E, 0xBB, 0xD9, 0x90, 0xFA, 0x31, 0xA6, 0x36, 0xC1, 0x04, 0xFA, 0xA4, 0x21,
+    0xAB, 0x86, 0x33, 0x73, 0x6B, 0x8C, 0x8F, 0x42, 0x5C, 0xC5, 0x95, 0x0E, 0xC6, 0xAB, 0x36, 0x2D,
+    0xE8, 0x2C, 0x6C, 0x6C, 0x80, 0xED, 0x20, 0x6B, 0xC1, 0x84, 0x99, 0x87, 0x4C, 0x6A, 0x30, 0x73,
+    0x4E, 0xE7, 0x9C, 0xD5, 0xE8, 0x79, 0x98, 0xF2, 0xA9, 0x48, 0x98, 0x19, 0x83, 0xDE, 0xE2, 0xE9,
+    0x9C, 0xFB, 0x39, 0xCB, 0xDD, 0xEC, 0xD0, 0xF2, 0xEE, 0x49, 0x27, 0x33, 0x87, 0x28, 0x46, 0x44,
+    0x2A, 0xD3, 0x99, 0xCE, 0x60, 0x30, 0xA4, 0xDB, 0x94, 0x71, 0x78, 0x4E, 0x43, 0x06, 0xDB, 0x94,
+    0xCF, 0x69, 0xC4, 0xB8, 0x19, 0x87, 0x7D, 0xC7, 0xF7, 0xF0, 0x28, 0xA7, 0x39, 0x42, 0xCE, 0x41,
+    0x16, 0x30, 0x24, 0xC4, 0x85, 0xF6, 0x51, 0xA5, 0x6A, 0x02, 0x0D, 0x23, 0x72, 0x16, 0x79, 0x14,
+    0xC6, 0x61, 0x1C, 0x54, 0x50, 0x41, 0x05, 0xB6, 0xA8, 0xD9, 0xA6, 0x96, 0xB5, 0x39, 0x95, 0x8C,
+    0xB6, 0x29, 0xCF, 0xBA, 0xB4, 0xDB, 0x79, 0x02, 0x58, 0xC4, 0xBA, 0xFC, 0xCC, 0xA2, 0x76, 0x56,
+    0xE4, 0x47, 0x22, 0x02, 0xB0, 0xC4, 0x88, 0xE5, 0x59, 0x5C, 0x99, 0x9C, 0xD0, 0xD2, 0x25, 0x45,
+    0xB7, 0xC0, 0xE8, 0x61, 0xF2, 0x83, 0xE4, 0x39, 0x83, 0x9C, 0xE5, 0xEC, 0xA9, 0xDE, 0x48, 0x9F,
+    0xC8, 0xCF, 0xD4, 0xC6, 0xB3, 0xAF, 0x41, 0x79, 0x57, 0x1E, 0xC1, 0xE8, 0x41, 0x56, 0xA4, 0x1A,
+    0xFF, 0x77, 0x63, 0xC9, 0x87, 0x1C, 0x1A, 0x72, 0x60, 0xC0, 0x81, 0x21, 0x03, 0x7B, 0xB4, 0xB3,
+    0xD2, 0xA6, 0x12, 0xE2, 0x79, 0xD4, 0xE6, 0x54, 0x9D, 0x8A, 0xAE, 0x29, 0x49, 0x1C, 0x0D, 0xC6,
+    0xB1, 0x46, 0x52, 0x61, 0x7F, 0xA8, 0xA4, 0x8D, 0x66, 0x65, 0x12, 0x47, 0x54, 0xC1, 0x25, 0x38,
+    0x08, 0x09, 0x68, 0x9F, 0xB4, 0x21, 0x91, 0x32, 0x79, 0x41, 0xB4, 0x37, 0x97, 0x2B, 0x1D, 0x2E,
+    0x52, 0x1E, 0xC2, 0x26, 0x85, 0xB9, 0x3C, 0x3D, 0x15, 0xAC, 0x74, 0xB1, 0x08, 0xD9, 0x0D, 0x0F,
+    0xB0, 0x97, 0x48, 0x9C, 0x39, 0x5A, 0x1D, 0xE4, 0xF4, 0xD2, 0xCE, 0xB5, 0x89, 0x74, 0xFF, 0xFE,
+    0xAA, 0x0B, 0xB0, 0x06, 0x2B, 0x90, 0x49, 0x63, 0xA4, 0x51, 0x93, 0x8A, 0x3F, 0x4E, 0xEB, 0xA0,
+    0x8B, 0x05, 0x16, 0x8D, 0x7C, 0x24, 0x86, 0x9C, 0x10, 0xFB, 0x94, 0x91, 0x0A, 0xB1, 0x4F, 0x89,
+    0xDA, 0x33, 0x63, 0xB9, 0x71, 0x4D, 0xFE, 0x88, 0xE9, 0xC5, 0xE8, 0x97, 0x3E, 0x7E, 0x9F, 0xF4,
+    0x3B, 0xAC, 0x7F, 0xF7, 0x0F, 0x83, 0xC8, 0x65, 0x11, 0x36, 0x72, 0xA2, 0xE0, 0xB2, 0xB3, 0xD2,
+    0xA5, 0x52, 0xED, 0xBF, 0xC5, 0x21, 0xB8, 0x48, 0x74, 0xD7, 0x8A, 0xF9, 0x6A, 0x63, 0xA4, 0xB5,
+    0x7F, 0x17, 0xDA, 0xE8, 0x3D, 0x1F, 0x7F, 0x93, 0x03, 0x23, 0xFE, 0x2A, 0xA8, 0x9F, 0xFA, 0xF8,
+    0x02, 0x59, 0xC9, 0x24, 0xE8, 0x30, 0x2A, 0xA7, 0x27, 0x60, 0xCF, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2,
+    0xD2, 0xD2, 0x68, 0x54, 0x96, 0x0C, 0x18, 0xB2, 0xC2, 0x3E, 0x00, 0x1E, 0xDF, 0xB6, 0x8B, 0x3B,
+    0xB4, 0xC8, 0x22, 0x8B, 0xAC, 0xA9, 0xC6, 0x86, 0x49, 0x01, 0x0F, 0x40, 0x40, 0xDF, 0xA9, 0x33,
+    0xBE, 0x52, 0xA5, 0x19, 0xDF, 0x0D, 0x4A, 0x5C, 0xDC, 0x92, 0x05, 0x26, 0x21, 0xBA, 0x11, 0x92,
+    0xB7, 0x42, 0x96, 0x34, 0x9D, 0x69, 0x16, 0xC8, 0x55, 0x1D, 0x17, 0x87, 0xB9, 0x14, 0x55, 0xC6,
+    0x0D, 0x68, 0x74, 0x65, 0x5C, 0x4E, 0xD0, 0x3F, 0x30, 0x9D, 0x0D, 0x0F, 0x64, 0xC5, 0x06, 0x6F,
+    0xCA, 0x55, 0x89, 0x3A, 0xD3, 0x1E, 0x32, 0x3E, 0x2D, 0x16, 0x87, 0x0C, 0x08, 0x0D, 0x41, 0x6F,
+    0x56, 0xDA, 0x9B, 0x94, 0x94, 0x7C, 0xC4, 0x9A, 0xFA, 0x24, 0xE8, 0x3A, 0x7E, 0xDB, 0x1B, 0x97,
+    0x5A, 0x06, 0x94, 0x8F, 0xFD, 0x09, 0x22, 0xBA, 0x39, 0x6C, 0x5C, 0x3E, 0xE2, 0xE3, 0xA0, 0xDF,
+    0xF3, 0xE6, 0x14, 0x83, 0x92, 0xDB, 0x41, 0xFF, 0xD4, 0x9B, 0x09, 0xC3, 0xA8, 0xC7, 0x48, 0x35,
+    0x50, 0x61, 0x89, 0xA5, 0x4B, 0xE4, 0x97, 0xC8, 0x1B, 0xF2, 0x35, 0x46, 0xCB, 0xAA, 0xB5, 0x12,
+    0x8C, 0x54, 0x51, 0xCF, 0x8E, 0xFD, 0xAB, 0xF1, 0x85, 0x5E, 0x49, 0xE4, 0x2D, 0x8B, 0xA6, 0x30,
+    0xBA, 0x8A, 0x7C, 0xCB, 0x45, 0x4B, 0x6E, 0xEA, 0x34, 0x16, 0x79, 0x4A, 0xC4, 0xB7, 0x52, 0x0C,
+    0xC0, 0x38, 0x62, 0x4F, 0x14, 0xEE, 0xAC, 0x81, 0x80, 0xFD, 0xEF, 0x14, 0xE6, 0xA3, 0x91, 0xAE,
+    0xAC, 0x5F, 0xA2, 0x4B, 0x9C, 0xF1, 0x17, 0xE9, 0x0C, 0xA6, 0xB8, 0xA8, 0xDA, 0xD8, 0x8F, 0x0B,
+    0x2B, 0x0D, 0xF2, 0xA9, 0x8B, 0xA6, 0x67, 0x20, 0x76, 0xF0, 0x66, 0x45, 0xD2, 0xC1, 0x2D, 0x80,
+    0xBD, 0x3B, 0x06, 0x53, 0x3B, 0xB5, 0x6E, 0x38, 0x9F, 0x93, 0x43, 0x56, 0xD8, 0x60, 0x42, 0x24,
+    0x2F, 0xDC, 0x7E, 0x25, 0x47, 0x7B, 0x32, 0x87, 0xAC, 0xAA, 0x89, 0x67, 0x65, 0x87, 0xFE, 0x44,
+    0xFA, 0x89, 0xBC, 0x23, 0x1F, 0x02, 0x67, 0xC8, 0x31, 0x7C, 0xF5, 0xDD, 0x4C, 0xEA, 0x1C, 0x43,
+    0xEC, 0x55, 0x60, 0x44, 0x4A, 0xE2, 0x23, 0x29, 0x26, 0x4D, 0xDA, 0x07, 0x3E, 0xA9, 0xF4, 0xDB,
+    0xCE, 0x1C, 0x22, 0x5F, 0xE3, 0xE3, 0x5A, 0xBF, 0x55, 0x98, 0x6F, 0xB2, 0x6E, 0x2F, 0x34, 0x22,
+    0xEF, 0x88, 0x3C, 0xD5, 0x0F, 0x8E, 0xA3, 0x0E, 0xA0, 0x37, 0xBD, 0xAA, 0xD7, 0x68, 0x0C, 0xA3,
+    0xA8, 0x1E, 0x30, 0x30, 0x24, 0x6F, 0x3B, 0xF5, 0xA9, 0xC7, 0xD6, 0x24, 0x2D, 0xD1, 0x94, 0x13,
+    0xB0, 0xB7, 0x84, 0x7C, 0x04, 0xA3, 0x01, 0xAC, 0x0D, 0x63, 0xDF, 0x64, 0xA6, 0x0E, 0xA9, 0xFD,
+    0x79, 0x30, 0x22, 0xB5, 0x11, 0xA9, 0x92, 0x6E, 0xE2, 0x75, 0x6B, 0xBD, 0x0E, 0x69, 0x61, 0xDC,
+    0x50, 0x85, 0x0C, 0x9B, 0xA2, 0x3F, 0x72, 0x8C, 0x0B, 0x8C, 0x27, 0x6E, 0x89, 0xC5, 0xE9, 0x9B,
+    0x41, 0x87, 0x95, 0xA8, 0x49, 0xAE, 0xB5, 0x74, 0x97, 0xC8, 0x73, 0xF2, 0xC3, 0x2C, 0x19, 0x9A,
+    0xA4, 0x68, 0xE2, 0x6B, 0x41, 0x7F, 0x12, 0xD4, 0x2F, 0x6B, 0xA4, 0x62, 0xEC, 0xB1, 0x9E, 0xAC,
+    0x20, 0x73, 0x58, 0x54, 0x8F, 0xED, 0xB0, 0x35, 0x4F, 0x82, 0x91, 0xD6, 0x4A, 0x20, 0x73, 0x51,
+    0x43, 0xE6, 0xA2, 0x96, 0xAC, 0x88, 0x5A, 0x32, 0xAF, 0xFA, 0xF3, 0xCF, 0x88, 0x64, 0x32, 0x65,
+    0xA7, 0x4B, 0x3A, 0xD5, 0x70, 0x98, 0xA8, 0x66, 0x88, 0xAE, 0x18, 0xB0, 0xDF, 0xC7, 0x35, 0x63,
+    0x47, 0x89, 0xF6, 0xE4, 0x68, 0xCF, 0x08, 0x5D, 0x61, 0x03, 0x02, 0x3C, 0x76, 0xE3, 0x6F, 0x17,
+    0xAF, 0x7F, 0xFD, 0xC8, 0xF5, 0xAF, 0x1F, 0xD9, 0x7C, 0xF8, 0x2F, 0xFC, 0x3E, 0xF4, 0x94, 0x28,
+    0x60, 0x98, 0x79, 0x86, 0x86, 0xA4, 0x60, 0xD9, 0xA9, 0x8E, 0xCC, 0xC7, 0x9E, 0x11, 0x5B, 0x97,
+    0x52, 0x49, 0x91, 0xD6, 0xC0, 0x60, 0xE7, 0x5F, 0x7E, 0xE5, 0xFB, 0xFF, 0xF1, 0x72, 0x09, 0x3C,
+    0xBA, 0x23, 0xF2, 0xF5, 0x20, 0x8D, 0x2F, 0x87, 0xFC, 0x00, 0xED, 0x32, 0xDD, 0x3A, 0xED, 0x3A,
+    0xF5, 0x69, 0x70, 0x6E, 0x8F, 0xAA, 0x2E, 0x46, 0x75, 0x13, 0xD5, 0x97, 0x54, 0xDD, 0x98, 0xB7,
+    0xAA, 0x6E, 0xDD, 0xBC, 0x55, 0x2D, 0xDE, 0x8F, 0xDB, 0x03, 0x8F, 0x33, 0x0B, 0xE1, 0xB3, 0xF8,
+    0x77, 0xFC, 0x8E, 0x61, 0x91, 0x32, 0x0B, 0x13, 0xBA, 0x83, 0xE8, 0x23, 0x07, 0xBF, 0xA8, 0x61,
+    0x34, 0x82, 0xC3, 0xC6, 0x61, 0x9E, 0x0A, 0xC4, 0x7E, 0x84, 0xAE, 0x4D, 0x41, 0x13, 0x05, 0x4A,
+    0x96, 0xB1, 0xE7, 0x2F, 0x14, 0xA9, 0x48, 0x48, 0x44, 0xA6, 0x3A, 0x60, 0x2E, 0xB7, 0xE8, 0xD0,
+    0xC1, 0x06, 0x1C, 0x04, 0xEE, 0x07, 0x12, 0x40, 0x7B, 0xBE, 0x20, 0x8D, 0x00, 0x5B, 0xCC, 0xA3,
+    0xD5, 0x3A, 0xE8, 0xF7, 0x0B, 0xD4, 0xC7, 0x01, 0xD6, 0x06, 0x30, 0x48, 0x3C, 0xA9, 0x0A, 0x98,
+    0x62, 0x88, 0xAE, 0x12, 0x1F, 0x05, 0xD5, 0xD0, 0x9F, 0xDF, 0x60, 0x2C, 0xE2, 0x33, 0x91, 0xC6,
+    0x78, 0x6C, 0x5C, 0x63, 0x36, 0x03, 0x51, 0x3B, 0xDB, 0xAC, 0x58, 0x02, 0xC6, 0x05, 0x9C, 0x59,
+    0x82, 0x47, 0x23, 0x77, 0xA7, 0xA6, 0xD8, 0x83, 0x6E, 0x01, 0x01, 0xDE, 0xAC, 0x60, 0xB0, 0x06,
+    0x69, 0x0A, 0xC9, 0xD9, 0x0A, 0x5D, 0x95, 0xA8, 0x90, 0x42, 0xAB, 0x6B, 0x06, 0x94, 0x64, 0xA4,
+    0xCE, 0xFC, 0xE4, 0x8D, 0x3A, 0x16, 0xE9, 0x22, 0x11, 0x71, 0x1D, 0x3A, 0xAC, 0xCC, 0x40, 0x41,
+    0x56, 0x30, 0x88, 0xFD, 0xAC, 0x43, 0xEA, 0x29, 0xEA, 0xC4, 0xBE, 0xDF, 0x56, 0x1F, 0xFE, 0xE6,
+    0xA0, 0x6F, 0x27, 0xF0, 0x0A, 0xF0, 0x3C, 0xEC, 0x02, 0x53, 0x44, 0x15, 0x0C, 0x67, 0x42, 0x73,
+    0x90, 0x7B, 0xF2, 0x29, 0x91, 0x7A, 0x22, 0x4D, 0xB6, 0x0D, 0xE1, 0xD6, 0x20, 0xFB, 0x83, 0xD5,
+    0x44, 0x1A, 0x2D, 0x53, 0xBA, 0x6D, 0x08, 0x57, 0x43, 0x7F, 0xFE, 0x95, 0x19, 0x84, 0xDB, 0x14,
+    0x09, 0x44, 0x1E, 0x6A, 0xB8, 0x08, 0xF9, 0xE7, 0x07, 0xF6, 0x37, 0xD0, 0xBB, 0x03, 0x62, 0x4F,
+    0xBC, 0x46, 0x7C, 0xAC, 0x88, 0xD8, 0x0B, 0xC0, 0xC9, 0xE3, 0x13, 0x69, 0x33, 0x99, 0x26, 0x7E,
+    0x4B, 0xD5, 0x61, 0x48, 0xDE, 0x7D, 0x25, 0x92, 0x29, 0x22, 0xCE, 0x6E, 0xAB, 0x6A, 0xC1, 0x9E,
+    0x7F, 0x7D, 0xAE, 0x4A, 0xA4, 0x53, 0x6E, 0x2F, 0x4D, 0xCA, 0x4A, 0xE2, 0xB3, 0xB3, 0xCD, 0xD6,
+    0xCF, 0xFD, 0x9F, 0xB5, 0xED, 0xE1, 0x12, 0x6B, 0x7C, 0x6B, 0xA6, 0xE5, 0x35, 0x1D, 0x8C, 0xB7,
+    0x94, 0x51, 0x48, 0x7C, 0xB6, 0x7D, 0xD3, 0x8D, 0xA9, 0xAC, 0xEB, 0x75, 0x0B, 0xD5, 0xC5, 0xC5,
+    0x43, 0x5B, 0x55, 0xBE, 0x66, 0xCD, 0xE6, 0x16, 0x48, 0x4C, 0xAE, 0x84, 0xD2, 0x3E, 0x7B, 0xBD,
+    0xE9, 0x6D, 0x01, 0x5C, 0x64, 0xCC, 0x99, 0xFA, 0xF4, 0xEE, 0xAD, 0x9D, 0x94, 0x97, 0xE9, 0xB0,
+    0x98, 0x2D, 0x8C, 0x98, 0x7C, 0xE6, 0x61, 0x8A, 0x75, 0xA6, 0xD2, 0x2D, 0x3D, 0xA9, 0xAE, 0x4B,
+    0x73, 0x36, 0xD8, 0x9D, 0xEE, 0xC4, 0x76, 0xAF, 0x67, 0x77, 0x80, 0x73, 0x06, 0x5B, 0x70, 0xFA,
+    0xB3, 0x8F, 0x53, 0x74, 0x83, 0xA9, 0xB0, 0x05, 0x3D, 0xA0, 0xC0, 0xBC, 0xE8, 0x78, 0xFC, 0x86,
+    0xE3, 0x88, 0xDD, 0xD2, 0xF3, 0xB8, 0xF9, 0xB5, 0xB0, 0xCD, 0x7F, 0x01, 0x6C, 0x1B, 0x7F, 0x16,
+    0xB6, 0x3D, 0xC8, 0x0C, 0x24, 0x90, 0xDD, 0xE5, 0x69, 0x76, 0xC9, 0x2A, 0x46, 0x64, 0xB6, 0xAA,
+    0xAD, 0xE9, 0xE3, 0x1A, 0x73, 0xA5, 0x41, 0x35, 0x1D, 0x0C, 0x87, 0x60, 0xAE, 0x3A, 0xA2, 0x9B,
+    0xD5, 0x0C, 0x48, 0x0D, 0x2D, 0x98, 0x97, 0x6A, 0xCC, 0x35, 0x79, 0xF5, 0x42, 0xB0, 0x22, 0x5D,
+    0x2C, 0xD2, 0x31, 0x96, 0x29, 0x6A, 0xF2, 0xE1, 0x5D, 0xE6, 0x16, 0x03, 0xBA, 0x00, 0x55, 0x01,
+    0xE1, 0x57, 0x38, 0x9A, 0xDF, 0x4E, 0xB5, 0xF9, 0xDC, 0x7D, 0x2D, 0x2E, 0xC2, 0x63, 0x6A, 0xE6,
+    0x6D, 0xD4, 0xE4, 0x43, 0xB4, 0x88, 0xD7, 0xAD, 0xEE, 0x74, 0x8B, 0x7D, 0xA1, 0x45, 0x87, 0x75,
+    0x58, 0xB6, 0x60, 0xCE, 0x15, 0xE8, 0x9B, 0x15, 0x94, 0x0D, 0x64, 0x43, 0x30, 0xE7, 0x3C, 0xFA,
+    0x83, 0x16, 0xDD, 0x8C, 0xFF, 0xE7, 0x4F, 0x3B, 0x23, 0x22, 0x4A, 0x44, 0x48, 0x45, 0x1C, 0xA7,
+    0x6E, 0xCD, 0x6B, 0x19, 0x6A, 0x8F, 0x79, 0xA1, 0x41, 0x87, 0x0D, 0x38, 0xB1, 0xCF, 0xFD, 0x76,
+    0x1A, 0xF4, 0x3C, 0xD0, 0x00, 0xED, 0x6C, 0x87, 0x6D, 0xDB, 0x1A, 0x1F, 0x3A, 0x57, 0x31, 0xB1,
+    0x4E, 0x75, 0x1D, 0xF1, 0xCD, 0x40, 0x7A, 0xD5, 0xB3, 0x62, 0x51, 0xED, 0x0C, 0xC4, 0x99, 0x97,
+    0x3C, 0xC3, 0x0C, 0xDA, 0x92, 0xF8, 0x9D, 0x86, 0xEC, 0x99, 0xA0, 0xA6, 0xE9, 0x0C, 0x4E, 0xFA,
+    0x89, 0x4C, 0x19, 0x4B, 0x35, 0xD3, 0x74, 0x7A, 0x36, 0x40, 0x8F, 0x7C, 0xC1, 0xF8, 0x70, 0x02,
+    0xF5, 0xFB, 0x0D, 0xD9, 0xD5, 0x6A, 0x1B, 0x22, 0xDE, 0xDC, 0x86, 0x88, 0xAA, 0xED, 0xB6, 0x21,
+    0xE2, 0x30, 0x43, 0x35, 0xEB, 0x24, 0xEF, 0x74, 0x8C, 0x9F, 0x16, 0xE9, 0xCC, 0xCC, 0xDB, 0xB9,
+    0x54, 0xB6, 0xA7, 0x37, 0x66, 0x86, 0xA6, 0x16, 0x0E, 0xC0, 0xEA, 0x57, 0xB6, 0x5E, 0xEE, 0x2E,
+    0xF8, 0xB6, 0x75, 0x51, 0x37, 0xDD, 0x6E, 0xC6, 0xF8, 0x4E, 0x33, 0xD2, 0x73, 0xDB, 0xCD, 0xD0,
+    0x1F, 0x04, 0xD2, 0x67, 0x2A, 0xD6, 0x33, 0x1F, 0x37, 0x63, 0x11, 0x2F, 0x22, 0x91, 0x48, 0xA3,
+    0x44, 0x66, 0x3D, 0xDF, 0x1A, 0x74, 0xBD, 0x4C, 0x7A, 0xA5, 0x61, 0xDF, 0x4E, 0xF7, 0xFF, 0xDC,
+    0x51, 0x6A, 0x16, 0x9C, 0x5B, 0x78, 0xE8, 0x5E, 0xC1, 0xC9, 0xDC, 0xFE, 0x0D, 0xF3, 0x5D, 0xE9,
+    0xBB, 0xD3, 0x3D, 0x8A, 0x1F, 0x84, 0x15, 0xD4, 0x7B, 0x45, 0xCC, 0xCB, 0xF7, 0x28, 0x95, 0xF8,
+    0xC6, 0xF8, 0xD6, 0x5C, 0x6E, 0xE7, 0xEE, 0xE7, 0xDE, 0x2A, 0xFA, 0x35, 0x58, 0x68, 0x97, 0x14,
+    0xBF, 0x03, 0xAF, 0xC3, 0xF3, 0x74, 0x80, 0x71, 0xE8, 0x1A, 0xCA, 0xBB, 0xDA, 0x72, 0x8F, 0x48,
+    0x67, 0x01, 0x1E, 0xD9, 0x3A, 0x0D, 0xF9, 0x7C, 0xBA, 0x47, 0x25, 0x8F, 0x42, 0x49, 0xF4, 0x33,
+    0x12, 0x5D, 0xEC, 0xC0, 0x7D, 0x29, 0xD9, 0x9D, 0x1C, 0x37, 0x4F, 0x85, 0xF4, 0x58, 0xB8, 0x2B,
+    0xE0, 0xDC, 0xAB, 0xEC, 0x21, 0x86, 0x33, 0x67, 0xA9, 0xDC, 0x02, 0x8B, 0xD4, 0xBA, 0x58, 0x60,
+    0x49, 0xD5, 0xB1, 0x4F, 0x29, 0xA3, 0x90, 0xDC, 0x7F, 0x70, 0xD6, 0xA6, 0xC7, 0xEE, 0x06, 0x52,
+    0x05, 0x25, 0x6F, 0x16, 0x17, 0x17, 0xF7, 0x28, 0x60, 0x27, 0xBA, 0xA0, 0x66, 0x91, 0x05, 0x74,
+    0xA1, 0x6A, 0x96, 0x48, 0x89, 0x67, 0x11, 0x64, 0xA7, 0x72, 0xA5, 0x79, 0x31, 0x58, 0x73, 0x6D,
+    0x0E, 0x26, 0x14, 0xDB, 0x47, 0x4B, 0xB3, 0x53, 0xA6, 0x25, 0x54, 0x3D, 0xDF, 0x94, 0x2D, 0x89,
+    0x02, 0x51, 0xFD, 0xE8, 0xFD, 0xDF, 0x2F, 0x4E, 0xFF, 0x50, 0x5D, 0x9E, 0xCD, 0xD8, 0xE8, 0xF7,
+    0x56, 0x8D, 0x04, 0xFB, 0x54, 0xDD, 0xE8, 0xB7, 0xBC, 0x49, 0x19, 0x8C, 0xF8, 0x45, 0xD0, 0xEF,
+    0x7B, 0x73, 0x81, 0x61, 0xC9, 0xA7, 0x41, 0xD7, 0xBB, 0xB7, 0xAD, 0x77, 0xC7, 0x9D, 0xA6, 0xDF,
+    0x0B, 0x26, 0x9A, 0x8F, 0x5A, 0x3E, 0x5B, 0xC0, 0xFD, 0x8A, 0x74, 0x4F, 0x4A, 0xF6, 0xC0, 0x1A,
+    0xD1, 0x94, 0x24, 0x76, 0x0F, 0x50, 0x7C, 0x29, 0xD9, 0x34, 0x0A, 0xE9, 0xB1, 0x90, 0x1D, 0x0B,
+    0xFB, 0xD4, 0xF1, 0x2F, 0x57, 0x29, 0x8C, 0x60, 0x19, 0x0E, 0x6D, 0xF9, 0x1E, 0x73, 0x88, 0xFC,
+    0x12, 0x9F, 0x54, 0xFA, 0xED, 0xC2, 0x1C, 0x20, 0x5F, 0xE2, 0xE7, 0x21, 0xB9, 0x7E, 0x5B, 0x9E,
+    0x95, 0x69, 0x26, 0x4D, 0x76, 0xA3, 0x9A, 0x79, 0x43, 0x5D, 0xF0, 0xC8, 0xE7, 0x5C, 0xE1, 0x3D,
+    0x08, 0xD7, 0x24, 0x15, 0xFF, 0x56, 0xED, 0x56, 0xD5, 0x3D, 0x4A, 0xEC, 0x55, 0xAE, 0x35, 0xC7,
+    0xC2, 0x72, 0x7A, 0xA5, 0xFD, 0x12, 0x3F, 0x08, 0xEC, 0xEF, 0x4F, 0xC9, 0x14, 0x11, 0x91, 0x4E,
+    0xB7, 0x71, 0x7F, 0x12, 0x53, 0x33, 0x81, 0xD4, 0x63, 0x21, 0x73, 0x58, 0x87, 0x05, 0x5B, 0x30,
+    0x04, 0xFB, 0x6E, 0x31, 0x04, 0x2B, 0x7E, 0x00, 0x56, 0xFC, 0x10, 0xAC, 0x9F, 0x7F, 0xCD, 0x0A,
+    0xAC, 0x23, 0xBD, 0xFD, 0x9C, 0x80, 0x11, 0x91, 0xF3, 0xAF, 0xC5, 0x22, 0x22, 0x53, 0x25, 0x22,
+    0xD2, 0xB3, 0xBF, 0x9F, 0x88, 0x00, 0x3B, 0x88, 0x7A, 0x25, 0xDE, 0xC8, 0x7B, 0xD5, 0xE9, 0x81,
+    0xEA, 0x39, 0xB8, 0xC4, 0x48, 0x7D, 0xE7, 0x12, 0x56, 0xFA, 0x4B, 0x0C, 0x5F, 0x3D, 0xDE, 0xCC,
+    0x0E, 0x2D, 0x97, 0x61, 0x59, 0xC9, 0xEC, 0xEC, 0xBA, 0x33, 0xF2, 0x9E, 0x74, 0x51, 0xCF, 0xE4,
+    0x43, 0x40, 0x8B, 0xC8, 0x58, 0x64, 0x76, 0x9A, 0x6B, 0x44, 0x66, 0x7B, 0x3D, 0xD2, 0xF6, 0xD9,
+    0xF7, 0x42, 0x67, 0x9F, 0xAE, 0xB7, 0x8E, 0x4F, 0x7B, 0xFB, 0xCC, 0x07, 0xED, 0x38, 0xDD, 0x0C,
+    0x9D, 0x7D, 0xF6, 0x72, 0xBB, 0x91, 0x9D, 0xBB, 0xD1, 0x4C, 0xAD, 0xD9, 0x0C, 0xDD, 0x4A, 0x76,
+    0xEE, 0x7A, 0xB3, 0x97, 0xE3, 0xEA, 0x69, 0x6F, 0xDC, 0xA0, 0x54, 0x6D, 0xFC, 0x9F, 0x55, 0x56,
+    0x6C, 0xFC, 0x2F, 0x8D, 0x96, 0x3F, 0x6C, 0xDD, 0xD6, 0x15, 0x87, 0x3F, 0xBE, 0xEB, 0xE8, 0x16,
+    0x61, 0xA3, 0xEB, 0x02, 0xF6, 0x52, 0x5B, 0x62, 0xC7, 0x36, 0x7D, 0x32, 0x33, 0x64, 0xD0, 0x70,
+    0x9F, 0x2E, 0x9D, 0x0C, 0x1E, 0x32, 0x44, 0x05, 0xA2, 0x14, 0x45, 0x87, 0x74, 0xE8, 0x54, 0x14,
+    0x95, 0x06, 0x0D, 0xAF, 0x00, 0x2D, 0xD2, 0xF1, 0x90, 0x21, 0x83, 0x0D, 0x14, 0xCD, 0x92, 0x0E,
+    0x2D, 0x8A, 0x02, 0x81, 0x3A, 0x44, 0x01, 0x3C, 0xA8, 0xAD, 0xEC, 0x77, 0x1D, 0x0D, 0x1A, 0x3C,
+    0x98, 0x81, 0x11, 0x18, 0x68, 0x80, 0x9A, 0x46, 0x32, 0x39, 0x45, 0x7D, 0x1D, 0x53, 0x35, 0x6D,
+    0xF3, 0xBD, 0xD3, 0xE1, 0xC9, 0xFF, 0x82, 0x16, 0xCD, 0xE5, 0xEF, 0xE3, 0xC1, 0x01, 0x08, 0x1E,
+    0xDC, 0x73, 0x0F, 0xCF, 0x21, 0x60, 0x63, 0xC2, 0x02, 0x00, 0x91, 0xC8, 0xF5, 0x5B, 0x9B, 0xF3,
+    0x30, 0x24, 0xAA, 0xD1, 0x25, 0x89, 0x74, 0x1B, 0x9B, 0x7F, 0xA8, 0xD1, 0x25, 0xF3, 0x90, 0x13,
+    0x89, 0x5C, 0x17, 0x79, 0x4B, 0xC6, 0x44, 0x01, 0x98, 0x00, 0xCE, 0xC3, 0x89, 0x06, 0xCC, 0xAF,
+    0x40, 0xEF, 0x79, 0x7A, 0x75, 0x03, 0x4D, 0x0A, 0xB9, 0xF6, 0x2C, 0xD1, 0x62, 0xB2, 0x94, 0xD8,
+    0xEB, 0x4A, 0x3D, 0xD8, 0x6C, 0x23, 0x11, 0x61, 0x24, 0x52, 0x39, 0xE8, 0x92, 0x12, 0x67, 0x3C,
+    0x71, 0x5D, 0xC8, 0xFD, 0xFD, 0x95, 0x57, 0x3D, 0x06, 0x2C, 0xDC, 0x5F, 0x56, 0xD2, 0x99, 0x2C,
+    0x1F, 0xB0, 0xD8, 0x70, 0xB7, 0x52, 0x57, 0xB3, 0xD4, 0x49, 0x2B, 0xF2, 0xB1, 0x34, 0x14, 0x93,
+    0xEC, 0xF4, 0x8F, 0xAB, 0x21, 0x5B, 0x43, 0xD6, 0x86, 0xAC, 0x0D, 0xA3, 0x50, 0x48, 0xB9, 0xF1,
+    0xE7, 0x7A, 0x48, 0x3E, 0x64, 0x30, 0x64, 0x69, 0xC8, 0xC5, 0x42, 0xBA, 0x42, 0x9A, 0x42, 0x4A,
+    0x27, 0xDD, 0x83, 0xCD, 0x3F, 0x7A, 0x0C, 0x0C, 0xA0, 0x41, 0x55, 0x98, 0x8C, 0x01, 0xB4, 0xE8,
+    0x9A, 0xA4, 0x64, 0x83, 0xA8, 0x45, 0x07, 0x60, 0x24, 0xA5, 0x92, 0x09, 0x06, 0x8B, 0x8D, 0x02,
+    0x41, 0x7B, 0xE5, 0x13, 0x0C, 0xF9, 0xD3, 0xEE, 0x3C, 0x39, 0x4D, 0x14, 0x92, 0x4F, 0x7F, 0x5A,
+    0x89, 0xC8, 0xE7, 0x22, 0xF2, 0x5A, 0x89, 0x4D, 0xA6, 0xA9, 0xA0, 0x90, 0xFD, 0x07, 0x9B, 0xEF,
+    0x94, 0x3C, 0xCE, 0x9E, 0x48, 0xB2, 0xF9, 0xC1, 0xE3, 0x44, 0x42, 0x21, 0xFB, 0x22, 0xD7, 0x45,
+    0xB2, 0x5E, 0x13, 0x7B, 0x87, 0x0A, 0x69, 0xD4, 0xA2, 0xEB, 0xDC, 0x78, 0xE2, 0xCB, 0xE1, 0x22,
+    0x98, 0x2B, 0xBB, 0x01, 0xD2, 0xD5, 0x02, 0x70, 0xD2, 0x02, 0x85, 0x78, 0x40, 0xC6, 0x40, 0x24,
+    0x01, 0x30, 0x52, 0x03, 0x22, 0x15, 0x18, 0x91, 0x0A, 0x46, 0x22, 0x15, 0xF1, 0x44, 0x8A, 0x8A,
+    0xD1, 0x67, 0xDD, 0xA8, 0x8A, 0x27, 0x69, 0x90, 0x6A, 0x14, 0x46, 0x95, 0xF8, 0x99, 0xFB, 0x88,
+    0x44, 0x59, 0x0A, 0x16, 0x02, 0xDA, 0xFF, 0x62, 0x1C, 0x49, 0x85, 0x0E, 0xA8, 0x0A, 0x5D, 0x72,
+    0xE2, 0x67, 0xBD, 0x7D, 0x91, 0x3D, 0x19, 0xCF, 0x48, 0xF9, 0x03, 0x60, 0x09, 0x15, 0x96, 0xD0,
+    0xC1, 0x61, 0x1A, 0x47, 0xD2, 0x38, 0x5C, 0x93, 0xB2, 0xD1, 0xA6, 0x74, 0x6D, 0x1A, 0xB5, 0x6D,
+    0xFA, 0x6A, 0xE8, 0xD2, 0x53, 0x75, 0x97, 0xBC, 0x7E, 0xB9, 0x4B, 0xCE, 0x9D, 0xE9, 0x92, 0x0F,
+    0xA3, 0x2E, 0x99, 0x44, 0x9D, 0xE9, 0xA2, 0xB1, 0x69, 0xA3, 0xB1, 0x09, 0xD1, 0x18, 0x40, 0x65,
+    0xC7, 0x51, 0xDE, 0x82, 0x04, 0x48, 0x4B, 0x9E, 0x5E, 0x03, 0x58, 0x9E, 0xC6, 0x89, 0x0F, 0xE2,
+    0xA4, 0x5F, 0x8B, 0xD3, 0x7C, 0xA3, 0x38, 0xB1, 0x77, 0xA4, 0xBD, 0x86, 0x9D, 0xA4, 0x54, 0x75,
+    0x87, 0x79, 0xB7, 0x62, 0xC9, 0xC1, 0x83, 0x06, 0x25, 0x25, 0xA6, 0x83, 0xA2, 0x26, 0x12, 0x8F,
+    0x16, 0x4F, 0x5A, 0x78, 0x76, 0x0A, 0xAF, 0xC2, 0xC8, 0x1B, 0x2F, 0xDE, 0x21, 0xBE, 0x8B, 0xC4,
+    0x6B, 0x19, 0x6B, 0x19, 0x6B, 0x3F, 0x78, 0xAC, 0x78, 0xAA, 0x72, 0x60, 0xA6, 0xCA, 0x06, 0x26,
+    0x3B, 0x3D, 0xE2, 0xF4, 0x84, 0xD3, 0x80, 0x23, 0x6A, 0x27, 0x98, 0xCF, 0x3B, 0x8A, 0x73, 0xDB,
+    0xEA, 0x1F, 0x36, 0x98, 0xE1, 0xDD, 0xEA, 0x2F, 0x77, 0xAF, 0xEC, 0xEE, 0x5D, 0x35, 0x69, 0x62,
+    0x97, 0x9A, 0x3C, 0x8C, 0x2E, 0xDF, 0xF3, 0x12, 0xDF, 0x50, 0x4D, 0x9A, 0xCF, 0x94, 0x17, 0x03,
+    0xBD, 0x7B, 0x9E, 0xD8, 0x3F, 0x07, 0xCB, 0x29, 0xB4, 0x4F, 0xD1, 0x3D, 0xC2, 0x3D, 0x8D, 0xC8,
+    0xB3, 0x64, 0xD1, 0x23, 0xC6, 0xAE, 0x8C, 0xC6, 0x1C, 0x9B, 0x64, 0x38, 0xE9, 0x70, 0xA5, 0xF3,
+    0xAE, 0x54, 0x6D, 0x52, 0xE2, 0xE2, 0x0A, 0x7D, 0x2D, 0x40, 0xDB, 0x82, 0x1B, 0x40, 0x7C, 0x35,
+    0xA3, 0x77, 0xB7, 0x86, 0xB6, 0x83, 0xA5, 0xB4, 0xC4, 0x9D, 0x9A, 0xBC, 0x37, 0xF2, 0x22, 0x12,
+    0x12, 0x91, 0x10, 0x89, 0x34, 0xCC, 0xC8, 0xF9, 0x47, 0x07, 0x52, 0x48, 0x57, 0x48, 0x97, 0x63,
+    0x73, 0x06, 0xFF, 0x57, 0x89, 0x9C, 0xD7, 0x22, 0x51, 0xD0, 0x21, 0xC7, 0xA6, 0x98, 0xD7, 0xBC,
+    0xFA, 0x38, 0xE8, 0x30, 0x92, 0x36, 0x95, 0xD6, 0xDC, 0x5A, 0x56, 0x01, 0x3A, 0x70, 0x60, 0x3C,
+    0x2A, 0xC0, 0x18, 0x5C, 0x86, 0xA9, 0x0E, 0x82, 0x1D, 0x9B, 0x90, 0x4A, 0x30, 0xF7, 0x7F, 0xA2,
+    0x5A, 0xD8, 0x00, 0xE3, 0x89, 0x1A, 0x48, 0x41, 0x05, 0x70, 0x07, 0xA6, 0x44, 0x4D, 0x20, 0x95,
+    0xCD, 0x20, 0x22, 0xB1, 0x48, 0x48, 0x45, 0x58, 0x95, 0xF3, 0xC0, 0xD1, 0x95, 0x95, 0x37, 0x9C,
+    0xC8, 0xD8, 0x89, 0x8C, 0x0F, 0xAB, 0x0A, 0x9E, 0xA1, 0x9E, 0xA2, 0xFF, 0x07, 0x71, 0x78, 0x02,
+    0x0C, 0x59, 0x18, 0x60, 0x13, 0x72, 0x93, 0x6D, 0x6B, 0xDF, 0xA8, 0x3A, 0x44, 0xFB, 0x01, 0xA9,
+    0x29, 0x6A, 0x5C, 0x45, 0xE2, 0x31, 0x9E, 0xB4, 0xA4, 0xE0, 0x87, 0x13, 0x5C, 0x83, 0x9B, 0x16,
+    0xB2, 0x16, 0xA9, 0xE6, 0x95, 0xDF, 0x5E, 0x54, 0xBE, 0xFF, 0x92, 0xF2, 0x73, 0xEB, 0xDA, 0xCF,
+    0x59, 0xED, 0x07, 0xEE, 0xF6, 0xC3, 0xCE, 0x88, 0x34, 0x3D, 0x91, 0x12, 0xED, 0x79, 0x42, 0xF5,
+    0x98, 0xE7, 0x33, 0xBE, 0x1B, 0x05, 0x4C, 0xB6, 0x44, 0x5C, 0xAA, 0x4A, 0x7B, 0x76, 0x54, 0x85,
+    0xD9, 0x0D, 0x44, 0x0F, 0x02, 0xB8, 0x16, 0x54, 0x77, 0xD0, 0x56, 0x47, 0x15, 0x14, 0x1D, 0xB8,
+    0x55, 0x8F, 0xDB, 0x6D, 0x48, 0x7C, 0x81, 0xA9, 0x4D, 0x30, 0x81, 0x49, 0xDC, 0x90, 0x56, 0xC0,
+    0x2C, 0xB3, 0xAA, 0x54, 0x65, 0xA0, 0xB6, 0x2C, 0x1A, 0x66, 0x95, 0xD7, 0x65, 0x88, 0x6A, 0xCB,
+    0x30, 0x61, 0x5E, 0x7B, 0x7D, 0x26, 0x44, 0x21, 0x27, 0x4F, 0x56, 0x56, 0x4F, 0x89, 0xDC, 0x11,
+    0xE9, 0xC0, 0x80, 0x2E, 0xE9, 0xD5, 0xC0, 0xCB, 0x2C, 0xAE, 0x63, 0xA7, 0x1A, 0x62, 0x87, 0xE4,
+    0x43, 0x76, 0x2C, 0x9D, 0x7B, 0xBF, 0x4B, 0x64, 0x47, 0xDF, 0xCF, 0xE1, 0x69, 0x11, 0x85, 0xE7,
+    0xD5, 0x9E, 0xCF, 0x4D, 0x12, 0x05, 0x9B, 0x6B, 0x7F, 0x27, 0x18, 0xB5, 0xE7, 0x6D, 0x9C, 0x10,
+    0xFA, 0xB9, 0xF2, 0x1F, 0x05, 0xD3, 0x7B, 0xE2, 0x96, 0x1F, 0xED, 0xBF, 0xF5, 0xE6, 0xAE, 0x88,
+    0x18, 0x91, 0x0E, 0x20, 0xE1, 0xF7, 0x56, 0xFB, 0xDC, 0x44, 0x21, 0x51, 0x3E, 0xD7, 0x3E, 0x24,
+    0x04, 0xAB, 0xBD, 0x35, 0x51, 0x30, 0x3D, 0x3F, 0x54, 0x7E, 0x6B, 0x9E, 0xD0, 0xD7, 0xA5, 0x8D,
+    0xA3, 0xDA, 0xF4, 0xFC, 0x50, 0x95, 0x5B, 0xC9, 0x6F, 0xF7, 0x2F, 0xBD, 0x2A, 0x22, 0x41, 0xA6,
+    0xEF, 0x98, 0x07, 0xE2, 0x6C, 0x7A, 0xD4, 0x00, 0xC4, 0x02, 0xA3, 0x00, 0x06, 0x38, 0x30, 0xFB,
+    0xCB, 0x18, 0xA9, 0x09, 0xDA, 0x1B, 0xE6, 0x08, 0xD4, 0x86, 0x59, 0x42, 0xAF, 0x36, 0x5F, 0x8E,
+    0x11, 0x29, 0x8D, 0x54, 0x87, 0x41, 0x7D, 0xE5, 0xC1, 0x5C, 0x01, 0x9C, 0x05, 0xBA, 0x00, 0xEA,
+    0xAE, 0x07, 0x73, 0x75, 0x05, 0x9C, 0x93, 0x92, 0x2E, 0x68, 0xAF, 0xEE, 0x7A, 0x9D, 0x99, 0xAB,
+    0xCC, 0xE2, 0x2C, 0x8B, 0x74, 0xA1, 0x57, 0xAB, 0xBB, 0x0F, 0x24, 0x33, 0x37, 0xA4, 0xC5, 0x15,
+    0x92, 0x31, 0x3E, 0x4C, 0x0C, 0x5B, 0x18, 0x08, 0x18, 0xD8, 0x5F, 0x36, 0x52, 0x07, 0x7D, 0x95,
+    0xB9, 0xC0, 0x6D, 0x66, 0x43, 0xEF, 0xF6, 0x97, 0x63, 0x91, 0x73, 0x52, 0xB1, 0x5A, 0x63, 0x6E,
+    0xB5, 0xB4, 0xB4, 0xB1, 0x27, 0x58, 0x7A, 0xF5, 0xB4, 0x36, 0x0C, 0x46, 0x3A, 0x9C, 0x34, 0xD3,
+    0x5D, 0x25, 0xC9, 0xF9, 0xA8, 0x73, 0xD3, 0x1D, 0x67, 0x22, 0x2D, 0xC5, 0x24, 0x03, 0x38, 0xC2,
+    0x51, 0x52, 0x46, 0xAD, 0xF6, 0xDB, 0xF1, 0xE5, 0x7A, 0xC8, 0x85, 0xA1, 0x25, 0x99, 0x37, 0xA8,
+    0xBD, 0x77, 0x4A, 0xEE, 0xDC, 0xAC, 0x59, 0x38, 0x7D, 0x81, 0xF8, 0xAD, 0x09, 0x6A, 0xEF, 0x7D,
+    0xCF, 0x9D, 0x9B, 0x0D, 0x3B, 0xEB, 0xEE, 0xCC, 0xA5, 0xB9, 0x58, 0x44, 0x67, 0x22, 0x27, 0xAB,
+    0x99, 0x09, 0x1C, 0x13, 0x8C, 0x34, 0xBD, 0xA0, 0x33, 0xCB, 0xBA, 0xF6, 0x3A, 0x1B, 0x32, 0xD4,
+    0x5E, 0x97, 0x2E, 0x1B, 0x46, 0x22, 0xA5, 0x96, 0x2E, 0x12, 0xF1, 0x8E, 0x4E, 0x7B, 0xE3, 0x3B,
+    0x3A, 0xE3, 0xCD, 0xE5, 0x8E, 0x2E, 0xF5, 0xC9, 0x6E, 0x37, 0xED, 0xEB, 0xA3, 0x37, 0x94, 0x74,
+    0x71, 0xD9, 0xCD, 0x92, 0x1F, 0xC7, 0xF6, 0xB1, 0x96, 0x81, 0xE5, 0x74, 0xFA, 0xCA, 0xC4, 0xC8,
+    0x24, 0x96, 0x7F, 0x45, 0x97, 0x5E, 0x87, 0x43, 0xAC, 0x36, 0x4A, 0x6A, 0x93, 0xB1, 0x00, 0x16,
+    0x86, 0xA3, 0xAA, 0x90, 0xB6, 0x38, 0x33, 0xDE, 0x60, 0x69, 0x80, 0x1B, 0xE0, 0x52, 0x36, 0xCC,
+    0xC3, 0x4E, 0x4B, 0xC3, 0xA8, 0x74, 0x63, 0xF6, 0x7F, 0xA5, 0xCA, 0xFE, 0x2C, 0x6B, 0x8B, 0xCA,
+    0x4B, 0xA7, 0x6E, 0xED, 0xCC, 0x62, 0x17, 0xD9, 0xAA, 0xD5, 0xEE, 0xA7, 0x23, 0x23, 0xAD, 0x93,
+    0xF2, 0xC5, 0xCD, 0xDF, 0xC8, 0xC4, 0xA2, 0x3C, 0x16, 0xE5, 0x39, 0x8D, 0xAE, 0xA6, 0xB7, 0x0D,
+    0x74, 0x0D, 0x2F, 0x7E, 0x80, 0x96, 0x8A, 0xAD, 0x01, 0xB1, 0xAA, 0x08, 0x03, 0xCC, 0xD4, 0x9C,
+    0x50, 0x95, 0xF2, 0x03, 0x5A, 0x55, 0x3B, 0x91, 0x5D, 0x91, 0x6E, 0x01, 0x75, 0xA6, 0x62, 0x9D,
+    0x23, 0xF4, 0x24, 0x33, 0x27, 0xAB, 0x3E, 0x6B, 0xC3, 0xE7, 0xB6, 0x47, 0xD2, 0xFD, 0xF5, 0x4F,
+    0x59, 0x80, 0x6D, 0xD8, 0x80, 0x54, 0x1A, 0x23, 0x4D, 0x34, 0x9A, 0xD6, 0x58, 0xD2, 0xAB, 0x73,
+    0x5C, 0x7C, 0xB6, 0x66, 0x70, 0x22, 0x85, 0xBC, 0x6D, 0xE0, 0xE1, 0xED, 0x12, 0xA4, 0x83, 0x9E,
+    0x54, 0xA0, 0x04, 0x70, 0x02, 0x4A, 0x04, 0x9C, 0x08, 0x6A, 0x32, 0x16, 0xDC, 0x95, 0x46, 0xD4,
+    0x38, 0xBD, 0x29, 0xA4, 0x15, 0x3F, 0xE7, 0xDB, 0x7C, 0xDF, 0xD4, 0xAC, 0xD3, 0xA7, 0x7F, 0x38,
+    0x1F, 0x35, 0x45, 0x05, 0xAC, 0xB3, 0xB3, 0x1E, 0x75, 0xEB, 0xEA, 0x9F, 0xEB, 0xE6, 0x97, 0xC3,
+    0xF9, 0xFE, 0xD0, 0xF6, 0x87, 0x8D, 0xFD, 0x75, 0x6D, 0x0B, 0x6F, 0x8B, 0xCC, 0x6E, 0x30, 0x00,
+    0xF4, 0xFB, 0x59, 0x34, 0x86, 0xEF, 0xF1, 0x0D, 0x9F, 0x0F, 0x03, 0xF5, 0x71, 0x6D, 0x12, 0x6C,
+    0xC3, 0xC3, 0x52, 0x77, 0x24, 0x35, 0xA3, 0xAA, 0xF7, 0x65, 0x1D, 0x9F, 0xAB, 0x07, 0xA6, 0x6E,
+    0x4C, 0x78, 0x6E, 0x45, 0x89, 0x0F, 0x6B, 0xF6, 0xF8, 0xAC, 0x56, 0x6F, 0xFB, 0x7A, 0xEB, 0xE5,
+    0xFE, 0x5C, 0x1C, 0xBF, 0xB2, 0xE7, 0xB7, 0xA6, 0x5F, 0xD4, 0x06, 0xC9, 0xC9, 0x8E, 0xB1, 0x6E,
+    0x54, 0x9B, 0x86, 0xB4, 0xFE, 0x5B, 0xF5, 0xF0, 0xED, 0x1B, 0xEF, 0xDC, 0x88, 0x57, 0x97, 0x76,
+    0x16, 0x96, 0xBE, 0x0A, 0xCD, 0xE8, 0xCA, 0xEE, 0xCD, 0x71, 0x6A, 0xCE, 0x86, 0x6E, 0x49, 0x9F,
+    0x6D, 0x5A, 0x4C, 0x65, 0x31, 0x09, 0x6A, 0xCF, 0x73, 0x27, 0x60, 0x73, 0x92, 0x04, 0xBD, 0xE7,
+    0xA3, 0x7D, 0x91, 0x71, 0x21, 0xB2, 0x2A, 0xF2, 0x59, 0x15, 0xFD, 0xBB, 0xE1, 0xD2, 0x45, 0xD2,
+    0x32, 0xBA, 0x94, 0xC5, 0x9F, 0xD5, 0xF3, 0x04, 0xCB, 0xD0, 0x62, 0x87, 0xD8, 0x1C, 0x6B, 0xC9,
+    0xDD, 0x4A, 0x9B, 0x48, 0x88, 0xA5, 0x8E, 0x26, 0xD9, 0xD1, 0x95, 0xE5, 0x47, 0xC3, 0xE8, 0x6B,
+    0xCA, 0x1F, 0xEB, 0xD0, 0xB1, 0xF3, 0xFA, 0xC3, 0x49, 0x24, 0x3D, 0xEF, 0x58, 0x34, 0xA5, 0x51,
+    0x55, 0xCF, 0xB7, 0x6C, 0x39, 0xAC, 0xA9, 0x13, 0x2D, 0xF2, 0x8A, 0x88, 0x6F, 0xA5, 0x1C, 0x80,
+    0xC9, 0xD0, 0x9E, 0xDE, 0x74, 0x26, 0x1D, 0xAC, 0xD5, 0x3A, 0x11, 0x55, 0xB3, 0x43, 0x9C, 0xD1,
+    0x60, 0x32, 0xB6, 0x89, 0x2B, 0xDC, 0xDF, 0x23, 0x69, 0x7B, 0x52, 0x1E, 0x4C, 0xC4, 0xC9, 0x11,
+    0x7B, 0x14, 0xCB, 0x33, 0x1A, 0x3C, 0xD1, 0x05, 0xAC, 0xC5, 0x9E, 0x60, 0x68, 0x68, 0xE2, 0xB2,
+    0xD1, 0x9F, 0x04, 0xF5, 0x55, 0x88, 0xEE, 0xD5, 0x48, 0x45, 0xE1, 0x71, 0x9E, 0xB4, 0x24, 0xCD,
+    0x70, 0x44, 0x13, 0x5C, 0x87, 0xAB, 0x79, 0x11, 0x50, 0x9E, 0x9E, 0x48, 0x69, 0x6E, 0x4B, 0xB3,
+    0xA0, 0xBC, 0x7D, 0x59, 0xF9, 0xE3, 0x2F, 0x29, 0x3F, 0xB7, 0xA6, 0xFD, 0xDC, 0xA2, 0xF6, 0x0B,
+    0x4B, 0xA7, 0x3E, 0xD9, 0x49, 0x45, 0x3A, 0x23, 0x12, 0x9E, 0x1D, 0x22, 0x07, 0x03, 0x24, 0xCA,
+    0x38, 0xC4, 0x21, 0xE5, 0x0D, 0x17, 0xE2, 0xCC, 0x68, 0xCF, 0x5D, 0x4F, 0x52, 0xA1, 0x02, 0xBD,
+    0x31, 0xD1, 0x3D, 0x1F, 0x35, 0x3B, 0xB4, 0xC6, 0x77, 0xB4, 0x47, 0x58, 0x4E, 0x58, 0xD0, 0x3E,
+    0xCE, 0x42, 0xAF, 0xB2, 0xAC, 0x1B, 0xE6, 0x94, 0xD7, 0x59, 0x88, 0xA6, 0xCE, 0xBC, 0x12, 0x09,
+    0x22, 0x1D, 0x24, 0xA0, 0x4B, 0xA2, 0xF3, 0xD9, 0xB7, 0xAA, 0xE3, 0xD3, 0xAB, 0xB6, 0x1B, 0x5D,
+    0xFA, 0x3B, 0x8E, 0x73, 0x9C, 0xFE, 0x11, 0xF8, 0x51, 0x48, 0x9E, 0xF4, 0xFC, 0xAF, 0x37, 0x79,
+    0xFF, 0x51, 0x30, 0xBD, 0x47, 0x4D, 0xFE, 0x08, 0x2C, 0xE7, 0xDA, 0x87, 0xC7, 0x28, 0xBF, 0xF5,
+    0x5F, 0xB8, 0xE0, 0x44, 0xC4, 0x89, 0x4C, 0x80, 0xA5, 0xE9, 0xFF, 0x20, 0x03, 0xE0, 0x88, 0xAB,
+    0x31, 0x2D, 0x24, 0xA0, 0x3C, 0x48, 0x8B, 0x9D, 0xA9, 0x0C, 0x56, 0x79, 0x43, 0x88, 0xBD, 0x93,
+    0xCA, 0x48, 0x79, 0x04, 0xBE, 0x13, 0xE8, 0xED, 0x7A, 0x62, 0x03, 0x7D, 0x0B, 0x5B, 0x72, 0xBF,
+    0xB7, 0xEB, 0x17, 0x62, 0x43, 0xDF, 0x5A, 0xB6, 0x42, 0xD0, 0xBB, 0xBB, 0x32, 0x31, 0xAF, 0xCB,
+    0xF9, 0xC1, 0x61, 0x54, 0xC6, 0x22, 0xAA, 0x64, 0x11, 0x25, 0xF5, 0xE2, 0xCC, 0x5E, 0x69, 0x86,
+    0xDC, 0x2B, 0xD3, 0x42, 0xAE, 0x4B, 0x0D, 0x8C, 0x5A, 0x9D, 0xED, 0x40, 0x0E, 0x4D, 0xF4, 0x66,
+    0x6D, 0xA4, 0xE4, 0x04, 0xEC, 0x7F, 0xB1, 0xFA, 0x8E, 0x74, 0x33, 0x93, 0x0C, 0x50, 0xBE, 0xA8,
+    0xEC, 0x5C, 0x7C, 0x76, 0xB7, 0xEC, 0xDB, 0x35, 0xAE, 0x5D, 0x61, 0x76, 0x31, 0xF0, 0xB9, 0x30,
+    0x3B, 0x08, 0x5C, 0x7B, 0xB7, 0x5C, 0x58, 0x2C, 0x3E, 0xDC, 0x3D, 0x2B, 0xCD, 0xA2, 0xBE, 0x0F,
+    0xA3, 0xE6, 0x85, 0x5E, 0xB5, 0x16, 0x9F, 0xF4, 0x0B, 0xEA, 0x41, 0xA3, 0xA4, 0x1A, 0xC4, 0x27,
+    0xEB, 0x05, 0xC3, 0x85, 0xED, 0xDE, 0x35, 0x1F, 0x67, 0x80, 0x61, 0xDD, 0xB0, 0x0E, 0x70, 0x08,
+    0xFD, 0x5E, 0xFD, 0x02, 0xEB, 0x7D, 0xFA, 0x4E, 0x3A, 0x27, 0xDD, 0x10, 0x2C, 0x2C, 0x41, 0x7A,
+    0x6B, 0xC7, 0x48, 0x17, 0xC9, 0x17, 0xC0, 0x7F, 0x00, 0xB5, 0x9A, 0x7F, 0x6C, 0x1D, 0x57, 0x76,
+    0xDF, 0x3F, 0x33, 0x57, 0xE4, 0xAC, 0x35, 0x16, 0xAF, 0xFE, 0xA0, 0x1A, 0xEF, 0x5A, 0xE2, 0x28,
+    0xA9, 0x82, 0x7A, 0x55, 0x52, 0xA3, 0x3F, 0x54, 0x80, 0xDB, 0xBE, 0xF7, 0xEE, 0xB5, 0xF4, 0x87,
+    0x03, 0xA8, 0x81, 0xD5, 0x40, 0x72, 0x5A, 0xB7, 0xA9, 0x5D, 0x74, 0x0B, 0x64, 0x85, 0xA0, 0x62,
+    0x11, 0x06, 0xA0, 0x0B, 0x92, 0x6F, 0x24, 0x15, 0x71, 0x51, 0x01, 0x15, 0xFB, 0xC3, 0xFD, 0xB3,
+    0xD1, 0x62, 0x6D, 0xC0, 0xAB, 0xA0, 0x10, 0x11, 0xB0, 0x80, 0x90, 0x7D, 0xE4, 0xBB, 0x16, 0xD1,
+    0x0A, 0xA9, 0x51, 0x78, 0x6C, 0x67, 0x63, 0xA0, 0x4E, 0xB1, 0x93, 0x95, 0xD1, 0x24, 0xBB, 0x68,
+    0x7D, 0x6D, 0x8F, 0x37, 0x23, 0x65, 0xDE, 0x3B, 0xFD, 0x63, 0x1E, 0x29, 0xEA, 0xC7, 0x66, 0xE5,
+    0x5D, 0x7B, 0x38, 0x67, 0xF8, 0xF8, 0xF8, 0xDE, 0xDC, 0xEF, 0x9C, 0x73, 0xEE, 0xB9, 0xE7, 0x7C,
+    0xEF, 0x41, 0xD5, 0xE6, 0x46, 0x95, 0x64, 0x04, 0x59, 0x1D, 0xBB, 0x5E, 0xEC, 0x16, 0x23, 0xB7,
+    0x18, 0xB9, 0x96, 0x1A, 0x9D, 0xBB, 0x98, 0x23, 0x82, 0x39, 0x22, 0xC6, 0x87, 0xA1, 0xF8, 0xCE,
+    0x6A, 0xFC, 0x26, 0x6B, 0xAB, 0xFA, 0x24, 0xE5, 0x6A, 0x7C, 0x89, 0xF5, 0x55, 0x25, 0x57, 0x12,
+    0xC9, 0xD2, 0x8A, 0x82, 0x09, 0x76, 0x1C, 0x69, 0x41, 0x2A, 0x79, 0x9C, 0xC7, 0xAC, 0x41, 0x0C,
+    0xCC, 0x83, 0x72, 0x30, 0x0D, 0x41, 0x01, 0x1A, 0xB4, 0xD4, 0x88, 0x38, 0x16, 0x21, 0x76, 0x84,
+    0x25, 0x6A, 0x00, 0x46, 0x86, 0x27, 0x44, 0x6A, 0x60, 0x6A, 0x72, 0x35, 0x91, 0x32, 0xBE, 0x50,
+    0x68, 0xBC, 0xC6, 0xEB, 0x0B, 0x5E, 0x8B, 0x37, 0x52, 0x4F, 0x4F, 0xCE, 0x02, 0x93, 0x04, 0xC7,
+    0x0B, 0xAE, 0xEB, 0x2C, 0x65, 0x39, 0x76, 0xE1, 0x8F, 0x4A, 0xF4, 0x10, 0x8C, 0x23, 0x2C, 0x09,
+    0xFA, 0x35, 0x72, 0x27, 0x23, 0x85, 0xD0, 0x43, 0x0A, 0x7D, 0x71, 0x63, 0xDD, 0xD7, 0xB7, 0xFE,
+    0x02, 0x0E, 0xDD, 0xFA, 0xB7, 0xB3, 0xEF, 0x58, 0xC2, 0x5F, 0x3E, 0xB6, 0xB9, 0xFF, 0x5F, 0x38,
+    0x00, 0xC9, 0xD5, 0xCA, 0xBC, 0x82, 0x08, 0x54, 0x41, 0x28, 0x99, 0x96, 0x32, 0xB1, 0xAD, 0x69,
+    0xA6, 0x8F, 0xD0, 0xD2, 0x52, 0x87, 0x52, 0x12, 0x7B, 0xC2, 0x6A, 0x57, 0x58, 0xA5, 0x52, 0x76,
+    0xA5, 0x38, 0xFC, 0xE7, 0x2C, 0xC6, 0x97, 0x5C, 0x3D, 0xD0, 0xFF, 0xCD, 0x9E, 0x1E, 0x7F, 0x75,
+    0xEC, 0x9F, 0x5D, 0x38, 0xB8, 0xEF, 0x74, 0xF0, 0xD7, 0x82, 0x5F, 0xBA, 0x9E, 0x65, 0x2B, 0xBB,
+    0x33, 0xE8, 0x9C, 0x98, 0x78, 0xE2, 0x89, 0x53, 0xFF, 0xE4, 0xE2, 0xA6, 0x84, 0xFF, 0xAA, 0xFB,
+    0xED, 0xA7, 0x45, 0x1C, 0x09, 0xB4, 0xC0, 0xA3, 0x1C, 0x44, 0x22, 0x5D, 0xF1, 0xE3, 0xAF, 0x8E,
+    0xFD, 0xBD, 0x0B, 0xBF, 0xB0, 0xEF, 0xD9, 0x37, 0xFE, 0xFA, 0xCF, 0xFF, 0xD2, 0x1F, 0x64, 0x6F,
+    0xE7, 0xE3, 0x19, 0x68, 0x71, 0x00, 0x74, 0xB3, 0xF4, 0x5A, 0xE4, 0x16, 0xD6, 0xD4, 0x5B, 0xB4,
+    0xAE, 0x47, 0x37, 0xFF, 0x4F, 0x95, 0x0A, 0xDD, 0x8C, 0x43, 0x50, 0xA0, 0x32, 0xA6, 0xE8, 0x8A,
+    0x6F, 0x5E, 0x36, 0xAA, 0x1F, 0x53, 0x32, 0x1C, 0x83, 0xAF, 0x04, 0xFB, 0x71, 0xFB, 0xA3, 0xE3,
+    0xB9, 0x79, 0xFB, 0xF4, 0x57, 0xEC, 0x18, 0xA7, 0xAE, 0xB3, 0x32, 0x7E, 0xF8, 0x56, 0xC5, 0x9E,
+    0xFD, 0xAD, 0xF9, 0x16, 0xAD, 0xA5, 0xAD, 0x73, 0x79, 0x74, 0xB6, 0xBB, 0xAC, 0xF7, 0x7F, 0x38,
+    0xE8, 0xCB, 0xE0, 0x3B, 0x32, 0xF8, 0xBD, 0x61, 0x7B, 0x15, 0xAE, 0x40, 0xB8, 0x72, 0xA5, 0x7B,
+    0x71, 0x73, 0x18, 0x27, 0xE5, 0x74, 0x37, 0x5F, 0x95, 0xE3, 0x6F, 0x0C, 0xE2, 0xC0, 0x4F, 0xC7,
+    0x6E, 0x35, 0x0D, 0x5D, 0x1D, 0x2B, 0x3F, 0x9D, 0xB8, 0xD5, 0x7E, 0x78, 0xA3, 0x8A, 0x75, 0xB1,
+    0xDF, 0x64, 0x73, 0x93, 0x8B, 0xBD, 0xC1, 0xDE, 0x2F, 0xA9, 0xEC, 0x4B, 0x2A, 0xB1, 0x04, 0xF9,
+    0x97, 0x59, 0x79, 0x8C, 0x95, 0x3D, 0xAA, 0xDE, 0x67, 0x93, 0xEC, 0xC6, 0x6F, 0xAB, 0xA7, 0x1E,
+    0x9F, 0x9B, 0x13, 0xFB, 0x75, 0x00, 0x02, 0x0F, 0xFC, 0x0D, 0x80, 0xA3, 0x44, 0x44, 0x90, 0x33,
+    0xC7, 0x34, 0x11, 0xCA, 0x32, 0x47, 0x41, 0xC4, 0x7E, 0x22, 0x39, 0x91, 0xD1, 0x2D, 0x57, 0x03,
+    0x38, 0x40, 0x81, 0x72, 0x47, 0x60, 0x2D, 0x5A, 0x65, 0x82, 0xF7, 0x08, 0x5D, 0x6B, 0x8E, 0x85,
+    0xE8, 0xDA, 0x8A, 0xE6, 0xCC, 0x7A, 0x98, 0x13, 0xF3, 0x14, 0xAC, 0xC5, 0x40, 0xB8, 0x0A, 0x28,
+    0x98, 0x63, 0x8E, 0x3D, 0x44, 0x84, 0x8E, 0x39, 0x8E, 0x11, 0x11, 0xC3, 0x5C, 0x90, 0xD3, 0x2D,
+    0x67, 0xFB, 0xCF, 0xC8, 0x33, 0x5F, 0x9D, 0x81, 0x82, 0x82, 0x69, 0x76, 0xA3, 0x32, 0x0A, 0x3C,
+    0xD3, 0x1C, 0x20, 0xCE, 0x94, 0x53, 0x9E, 0x35, 0x6A, 0x34, 0x89, 0xA8, 0x3C, 0x14, 0x3F, 0x09,
+    0x24, 0x05, 0x60, 0xAF, 0x00, 0xB8, 0xC0, 0x11, 0xB1, 0x87, 0xB8, 0x64, 0x95, 0x20, 0x57, 0x96,
+    0xC0, 0xCD, 0x82, 0x7A, 0xDA, 0xB1, 0x77, 0x7A, 0x02, 0xA4, 0x58, 0x0D, 0xC2, 0x61, 0x64, 0x67,
+    0xA1, 0x15, 0x16, 0x84, 0xF9, 0x94, 0x63, 0x82, 0xF7, 0x60, 0x55, 0xEF, 0x27, 0xCA, 0xFE, 0xE5,
+    0x6D, 0x5A, 0xC1, 0x73, 0x65, 0x98, 0x13, 0xB3, 0x1B, 0x66, 0xC0, 0x80, 0x81, 0x0E, 0x4C, 0x02,
+    0x30, 0xBE, 0xF5, 0x4E, 0x73, 0x0A, 0xAA, 0x44, 0x3B, 0x12, 0x68, 0x43, 0x0B, 0x16, 0xA1, 0x05,
+    0x1D, 0x48, 0xB3, 0xC5, 0x58, 0xAA, 0xA0, 0x9F, 0x01, 0xE8, 0xA7, 0x2D, 0xD1, 0xDC, 0x0A, 0xE1,
+    0xCB, 0x73, 0x90, 0x5F, 0xDF, 0x31, 0x0D, 0x13, 0x40, 0x17, 0xA0, 0x6A, 0x08, 0x3F, 0xB4, 0xF0,
+    0xA3, 0x02, 0x16, 0x17, 0xE1, 0x88, 0xB6, 0xE8, 0xE3, 0x9E, 0xC8, 0x2D, 0xA2, 0x0A, 0x9D, 0x51,
+    0x86, 0x9E, 0x1E, 0x4B, 0x98, 0xAB, 0xD7, 0xB2, 0x44, 0xC4, 0xC7, 0x22, 0x03, 0xE5, 0xD1, 0x6F,
+    0x54, 0x28, 0x5F, 0xC3, 0x46, 0x63, 0xB6, 0x4D, 0xE0, 0xA8, 0x83, 0x38, 0xE7, 0xDE, 0x23, 0x72,
+    0xA0, 0x2A, 0x40, 0x80, 0xEF, 0xE4, 0xD0, 0xBE, 0x0E, 0x49, 0x02, 0xF1, 0xC5, 0x1C, 0x95, 0xF7,
+    0x08, 0x7C, 0x02, 0x95, 0x2A, 0x68, 0xD3, 0x23, 0x25, 0xB1, 0xFA, 0x07, 0xBF, 0x5B, 0x44, 0x22,
+    0x75, 0x28, 0x22, 0xB6, 0x46, 0xF9, 0x65, 0xA8, 0x0D, 0xA4, 0x19, 0xC0, 0xBE, 0xD3, 0xA0, 0x45,
+    0x2A, 0x48, 0x45, 0x4A, 0x30, 0x15, 0xC0, 0x77, 0x2A, 0x80, 0x8F, 0x2B, 0x40, 0xBD, 0x5D, 0x01,
+    0xD1, 0x1B, 0x83, 0xE7, 0x41, 0x5B, 0x11, 0x4B, 0x82, 0x88, 0xA5, 0x4D, 0x0D, 0xF4, 0xA8, 0x81,
+    0xE1, 0xD5, 0x01, 0x84, 0x22, 0x43, 0x50, 0x22, 0x72, 0xF5, 0xD5, 0xD8, 0x21, 0x52, 0xE9, 0x0C,
+    0x91, 0xDA, 0x58, 0x9A, 0x50, 0x03, 0x28, 0x79, 0x15, 0xB4, 0x0C, 0xC1, 0x88, 0x58, 0xCA, 0x40,
+    0xAC, 0xCA, 0xE9, 0xA2, 0x2D, 0x1B, 0xB4, 0xA1, 0xA6, 0x24, 0xF4, 0x22, 0x2E, 0x7A, 0x57, 0x84,
+    0x24, 0x6B, 0xC3, 0x32, 0x25, 0x61, 0xA5, 0x72, 0xD2, 0x5C, 0xBF, 0x72, 0x4D, 0x30, 0x22, 0x15,
+    0x22, 0xE2, 0x94, 0x48, 0x85, 0x96, 0xDB, 0x40, 0x7C, 0x3E, 0x23, 0x3A, 0xF6, 0x22, 0xC1, 0xE6,
+    0x3C, 0x9C, 0x5A, 0x6C, 0xC6, 0x1A, 0x97, 0x15, 0xB4, 0x08, 0xBA, 0xD0, 0x5E, 0x17, 0x0C, 0xA3,
+    0x02, 0x7D, 0xA3, 0x24, 0x28, 0x6B, 0xE8, 0x74, 0x40, 0xBF, 0x65, 0x09, 0x3F, 0xC9, 0xA1, 0x57,
+    0x41, 0xC7, 0x80, 0xBE, 0x54, 0xA0, 0xDF, 0x96, 0xD7, 0xAE, 0x79, 0x23, 0x52, 0x47, 0x22, 0x35,
+    0x5D, 0x19, 0x10, 0xF4, 0x3F, 0x00, 0x60, 0x2A, 0xB6, 0xCB, 0x79, 0x50, 0x61, 0x9C, 0xFE, 0x9D,
+    0xE3, 0x57, 0x7E, 0x7D, 0xA7, 0x51, 0x8E, 0x6C, 0x9B, 0x06, 0x28, 0x1F, 0x7C, 0xAB, 0x6A, 0x62,
+    0x75, 0xA3, 0x82, 0xC6, 0xA2, 0x35, 0x30, 0x2E, 0xD7, 0x00, 0x25, 0x52, 0x00, 0xC3, 0x40, 0x00,
+    0x93, 0x25, 0x15, 0x44, 0x85, 0x12, 0x07, 0x3D, 0x7A, 0xEB, 0xA0, 0x9D, 0xBE, 0x58, 0x40, 0xA5,
+    0x7C, 0x07, 0xB4, 0x5D, 0x52, 0x05, 0x94, 0xDA, 0x75, 0x40, 0x5F, 0xF0, 0xAA, 0x80, 0x7A, 0x99,
+    0x65, 0x88, 0x3F, 0x74, 0x3A, 0x87, 0xEE, 0xED, 0x73, 0x75, 0x63, 0x85, 0x0C, 0x12, 0x11, 0x0F,
+    0x41, 0xA3, 0x7E, 0x73, 0xEE, 0x36, 0x5B, 0x0E, 0x15, 0x34, 0xF6, 0x30, 0x00, 0xC4, 0xC5, 0x36,
+    0x22, 0x30, 0x16, 0x20, 0xF2, 0x00, 0x0C, 0x00, 0x98, 0xB9, 0xD7, 0x03, 0xE7, 0x80, 0x02, 0x82,
+    0xBC, 0x59, 0x69, 0x7E, 0xCC, 0xD1, 0x81, 0x5E, 0x62, 0x29, 0xB5, 0x0B, 0x7D, 0x94, 0x47, 0xB9,
+    0xF2, 0xDA, 0x05, 0x55, 0x92, 0x51, 0x1B, 0xD8, 0xD8, 0x00, 0x53, 0x43, 0x5A, 0x81, 0xF6, 0x0D,
+    0x82, 0xB8, 0x68, 0xA6, 0x90, 0x2E, 0x9A, 0x48, 0x90, 0x14, 0x90, 0x16, 0x80, 0x06, 0x8F, 0xFE,
+    0x33, 0xA4, 0xD2, 0x91, 0xF7, 0xF1, 0x5B, 0xCC, 0x78, 0xBE, 0xC7, 0x8C, 0xD7, 0x6F, 0x9D, 0xF4,
+    0x52, 0xE9, 0x0A, 0xDF, 0x7C, 0x04, 0x20, 0x14, 0xAB, 0x9F, 0xCE, 0x0F, 0x30, 0x37, 0xCD, 0xD1,
+    0x96, 0x2A, 0x5A, 0x13, 0xB4, 0x1E, 0xA7, 0xB5, 0x87, 0x96, 0xB6, 0x2D, 0x55, 0xB4, 0xA8, 0xDB,
+    0xCC, 0xB4, 0x39, 0xD0, 0x7E, 0x6D, 0x7D, 0xA9, 0x5F, 0x2F, 0x9D, 0x2B, 0xC2, 0xE2, 0xA0, 0xFA,
+    0xF5, 0xB9, 0x68, 0xCF, 0x95, 0xA8, 0xB1, 0x54, 0xFF, 0xB4, 0x92, 0x3A, 0xCE, 0xEA, 0x09, 0x16,
+    0xF7, 0xD3, 0x9A, 0xA6, 0xD5, 0xA2, 0xDD, 0x62, 0x29, 0x3D, 0x3E, 0xD4, 0x32, 0x8C, 0xE5, 0xFF,
+    0x05, 0x1B, 0xCF, 0x72, 0x18, 0x2E, 0xC0, 0x3B, 0x96, 0xEE, 0xD6, 0xB3, 0x3E, 0xCA, 0xB7, 0x60,
+    0x0C, 0xD2, 0xEF, 0xA6, 0x15, 0x46, 0x86, 0x2A, 0x3B, 0xA2, 0x06, 0x1C, 0x9B, 0x60, 0x39, 0x78,
+    0x21, 0x42, 0x8B, 0xDC, 0x70, 0xEA, 0xCE, 0x2B, 0xD6, 0x53, 0x42, 0x8B, 0x2E, 0xC4, 0x79, 0xBF,
+    0x04, 0x11, 0x91, 0x22, 0x95, 0xBE, 0x54, 0xC1, 0xC6, 0xB3, 0xE7, 0x2A, 0xC0, 0x8E, 0x4C, 0x37,
+    0x05, 0xB1, 0x0C, 0x88, 0x65, 0x00, 0x13, 0xF0, 0xF5, 0x3D, 0xC4, 0xF2, 0xCB, 0x24, 0x27, 0xFE,
+    0x98, 0x36, 0x35, 0x2D, 0x7A, 0x2C, 0xB2, 0x40, 0x8B, 0x79, 0x3A, 0x78, 0xD2, 0x0F, 0x0B, 0xB4,
+    0x38, 0xC2, 0x21, 0x44, 0xB9, 0x9B, 0x98, 0x77, 0x7B, 0x92, 0x6C, 0xD7, 0x0E, 0x63, 0x85, 0x43,
+    0xB4, 0xE4, 0xED, 0xC0, 0x2F, 0xB0, 0xB0, 0x46, 0x6B, 0x8D, 0x56, 0x49, 0xEB, 0x3A, 0x8B, 0x4B,
+    0x41, 0x65, 0xC4, 0x6B, 0xC9, 0xC3, 0x21, 0x8C, 0x35, 0xEB, 0xBC, 0x01, 0xE5, 0xB7, 0xBE, 0x38,
+    0xF6, 0xDC, 0xD5, 0x13, 0x5B, 0x93, 0xFB, 0x14, 0xA4, 0xCD, 0xFF, 0x0C, 0x40, 0x00, 0x2A, 0x23,
+    0xC8, 0x61, 0x15, 0x5A, 0x70, 0x00, 0xE2, 0xC6, 0x63, 0x0A, 0x98, 0x27, 0x1E, 0xA0, 0x25, 0xD7,
+    0xCF, 0xF4, 0xA2, 0x0B, 0xEF, 0x5D, 0xC8, 0xBD, 0x5F, 0x5B, 0x68, 0xB5, 0x67, 0x74, 0x7C, 0x39,
+    0x7A, 0xE3, 0x2F, 0x6F, 0x16, 0x46, 0xBC, 0x92, 0x12, 0x53, 0x90, 0x40, 0x6C, 0x51, 0x8E, 0xC0,
+    0xC3, 0x75, 0x68, 0x83, 0x86, 0xC8, 0xA1, 0x1C, 0x64, 0x23, 0x14, 0x31, 0x4C, 0xC0, 0x0C, 0xB4,
+    0x1E, 0xEE, 0x8B, 0x6B, 0xB4, 0x5A, 0xB4, 0x8E, 0xB0, 0xA0, 0x29, 0xE3, 0xAC, 0x8C, 0xDE, 0xF6,
+    0xEA, 0x63, 0x1F, 0xFC, 0x45, 0x81, 0xE4, 0x74, 0x1D, 0xC6, 0x91, 0x66, 0xA4, 0x16, 0x43, 0x30,
+    0xC4, 0xD4, 0x98, 0x82, 0xC3, 0xB0, 0x97, 0xC8, 0xB2, 0x40, 0x94, 0xD1, 0xCD, 0xA2, 0x0F, 0xB3,
+    0xD9, 0x23, 0x2A, 0xBB, 0x3E, 0x1B, 0x6E, 0x66, 0xD3, 0xB3, 0x6A, 0x33, 0x9B, 0x9D, 0xD5, 0xEA,
+    0xE5, 0xDC, 0x94, 0xAA, 0x62, 0x16, 0xE5, 0x68, 0xA1, 0x1C, 0xB3, 0x30, 0xC6, 0x29, 0x7D, 0xDE,
+    0xEB, 0x0B, 0x65, 0xB2, 0x59, 0xFE, 0xEC, 0x10, 0xD8, 0x77, 0x36, 0x23, 0x91, 0xF2, 0xBE, 0xE7,
+    0x59, 0x04, 0x4C, 0x36, 0x9A, 0x3A, 0xEB, 0xA0, 0xDE, 0xCF, 0x08, 0x3E, 0xF2, 0x70, 0xBD, 0x0D,
+    0xED, 0xD8, 0x91, 0x04, 0x1E, 0x9D, 0x75, 0x50, 0x79, 0xEC, 0x42, 0x1F, 0x94, 0x0C, 0xAF, 0x6E,
+    0xD0, 0x15, 0x71, 0xA9, 0x48, 0xA9, 0x1D, 0x26, 0x2A, 0xD0, 0x9B, 0x9E, 0xB0, 0x0A, 0x9E, 0x7F,
+    0x55, 0x4B, 0xF5, 0x99, 0xFC, 0x18, 0x1E, 0x67, 0x15, 0x95, 0xCD, 0x42, 0xB7, 0x86, 0xA8, 0xBA,
+    0x0F, 0x5D, 0xE0, 0x81, 0x21, 0x60, 0x1C, 0x1C, 0x29, 0x41, 0xFF, 0x73, 0x88, 0x6E, 0x3A, 0xC2,
+    0xA2, 0x84, 0x32, 0x85, 0xC5, 0xC8, 0xD1, 0xA1, 0x42, 0xDB, 0x94, 0xD8, 0x45, 0xB9, 0xBA, 0x73,
+    0xB5, 0x0A, 0x44, 0x84, 0xBE, 0x48, 0x6E, 0xA0, 0x4E, 0x32, 0x8C, 0x76, 0x4D, 0x60, 0xDA, 0xCD,
+    0xD1, 0xD8, 0xAE, 0x2A, 0xC9, 0xD9, 0xB0, 0x9F, 0x01, 0xE7, 0xE7, 0x8B, 0x42, 0x59, 0x08, 0x2D,
+    0xE0, 0x80, 0xD4, 0x36, 0x33, 0x11, 0xD2, 0xEF, 0x62, 0xC4, 0x1D, 0x51, 0x7E, 0x82, 0xC5, 0x08,
+    0x1D, 0x3A, 0xE5, 0x3C, 0x65, 0x8B, 0xA5, 0x38, 0xEF, 0x67, 0x22, 0x45, 0x2A, 0xD7, 0x83, 0x8D,
+    0x17, 0x60, 0x3F, 0xEC, 0x6E, 0x66, 0xEE, 0x58, 0xF3, 0x04, 0xBB, 0x81, 0x1C, 0xA6, 0x41, 0x65,
+    0x0F, 0x71, 0xD8, 0xA0, 0x5F, 0x84, 0x22, 0xC8, 0x2B, 0x2B, 0x26, 0x23, 0x2A, 0xA0, 0x86, 0xC4,
+    0xEE, 0x9C, 0x7E, 0xA6, 0xC9, 0x02, 0x4C, 0x41, 0x28, 0x77, 0xAE, 0x69, 0x11, 0xDF, 0x17, 0x09,
+    0x45, 0xFC, 0xB8, 0xDC, 0xDE, 0x9A, 0xD4, 0x8E, 0x59, 0x22, 0xCB, 0xF6, 0x64, 0x1D, 0x1F, 0x06,
+    0xE2, 0x3B, 0xC4, 0x8E, 0x35, 0xB4, 0xA5, 0x24, 0xCE, 0x58, 0x47, 0x0D, 0x46, 0x95, 0x45, 0x33,
+    0x67, 0x59, 0x84, 0xA9, 0x82, 0xE8, 0x44, 0x46, 0x36, 0xF6, 0x39, 0x63, 0x3A, 0x45, 0x42, 0xD4,
+    0x0B, 0xF2, 0xD5, 0xBD, 0xD8, 0x47, 0x81, 0x13, 0x39, 0xE8, 0x81, 0xCE, 0xE1, 0xF4, 0x17, 0xA0,
+    0xA2, 0x53, 0x68, 0x1B, 0x94, 0xA3, 0x3C, 0x08, 0xE0, 0x5C, 0x91, 0x88, 0x2A, 0xE8, 0x11, 0x5B,
+    0x4A, 0xB4, 0xE5, 0x3A, 0x71, 0x8E, 0xF9, 0x5F, 0x81, 0x54, 0xA1, 0x64, 0xC0, 0xCA, 0x63, 0xA8,
+    0x97, 0x2D, 0x3A, 0x87, 0xD9, 0x87, 0x05, 0x9A, 0x27, 0x87, 0xA4, 0xE2, 0xF5, 0xED, 0x7F, 0xA0,
+    0x2A, 0x58, 0x06, 0xED, 0x08, 0xCA, 0x9D, 0x61, 0x51, 0x79, 0x30, 0x19, 0x6A, 0x08, 0xA9, 0x5C,
+    0xF5, 0x22, 0x12, 0x8B, 0xF8, 0x54, 0x84, 0x73, 0xB2, 0xD2, 0x58, 0x2D, 0x3B, 0x16, 0xFF, 0x1A,
+    0x69, 0xF6, 0x59, 0xCC, 0x06, 0x30, 0x1F, 0x43, 0x74, 0x79, 0xB4, 0xA6, 0x47, 0xF7, 0xE1, 0x32,
+    0x77, 0x2C, 0x5A, 0x86, 0x28, 0x91, 0x92, 0x32, 0x10, 0xDB, 0x26, 0xF2, 0xDA, 0xB2, 0xA1, 0x72,
+    0xB4, 0x2B, 0x09, 0x7D, 0x1B, 0xD6, 0xB5, 0x25, 0xB9, 0x98, 0x13, 0x15, 0x25, 0x61, 0xD5, 0x26,
+    0x1C, 0xE8, 0x57, 0x7E, 0x57, 0x94, 0x88, 0x64, 0x22, 0xE2, 0x8C, 0x48, 0xD6, 0x64, 0x5B, 0xC4,
+    0x16, 0xC2, 0xDC, 0xC2, 0xDA, 0x3C, 0x4C, 0x1F, 0x80, 0x38, 0xB6, 0xA8, 0x1B, 0x2E, 0xAE, 0x3C,
+    0xB1, 0xF4, 0x88, 0xCF, 0x0B, 0xCA, 0x69, 0x17, 0xE4, 0xCA, 0xB3, 0x4A, 0x8F, 0x19, 0x0C, 0x71,
+    0xA6, 0x5D, 0x30, 0x38, 0xE7, 0x31, 0x52, 0x13, 0x89, 0x40, 0x7A, 0xCB, 0x7D, 0x91, 0x49, 0x21,
+    0xB1, 0xDD, 0x96, 0x48, 0x86, 0x44, 0x32, 0x84, 0x18, 0xFA, 0x97, 0x09, 0xE5, 0x43, 0xE2, 0xF3,
+    0x82, 0xC6, 0x70, 0x00, 0xC3, 0x34, 0x29, 0x33, 0x18, 0x8E, 0x60, 0x48, 0xFE, 0x48, 0xD0, 0x22,
+    0x0D, 0xC4, 0xFE, 0xE5, 0x6D, 0x1D, 0x8A, 0x70, 0xF6, 0xB5, 0xAD, 0x08, 0x14, 0x9C, 0x39, 0x2E,
+    0x52, 0xF4, 0xA5, 0x4C, 0x21, 0xCE, 0x08, 0x0B, 0xB8, 0x0E, 0xE9, 0x73, 0x2B, 0xB1, 0x94, 0x4A,
+    0x06, 0xD4, 0xD0, 0x01, 0x9D, 0xA1, 0x0A, 0x18, 0x5E, 0x7D, 0xD5, 0x88, 0x68, 0x91, 0x4D, 0x11,
+    0x0F, 0x24, 0xE2, 0x0F, 0x7F, 0xFB, 0xD4, 0x5D, 0xEB, 0x4C, 0x8E, 0xD2, 0x96, 0x69, 0xE6, 0x16,
+    0xC6, 0xAE, 0xF7, 0xA5, 0xFE, 0xFD, 0xD7, 0x6C, 0xB3, 0xDA, 0x2D, 0x43, 0x2A, 0xA5, 0x96, 0x32,
+    0xE8, 0xE7, 0x00, 0x2E, 0x66, 0x56, 0x65, 0x91, 0x38, 0xCE, 0xED, 0x0C, 0x1B, 0x63, 0x67, 0x62,
+    0x91, 0x0B, 0x22, 0x79, 0x0F, 0x8E, 0x6C, 0x03, 0x5A, 0x7F, 0xDE, 0xA6, 0x92, 0x6B, 0x29, 0x95,
+    0x87, 0x6A, 0x1B, 0xD0, 0x9D, 0xAB, 0x2B, 0x22, 0x75, 0x03, 0xC8, 0x01, 0xFB, 0xB9, 0x32, 0x11,
+    0xE4, 0x91, 0xB8, 0x60, 0x78, 0xAF, 0xD3, 0x3C, 0x22, 0xAC, 0x31, 0x88, 0x1C, 0x61, 0xB9, 0x95,
+    0x2D, 0x8E, 0x8E, 0x7D, 0xA7, 0x53, 0x19, 0xC6, 0x22, 0xC7, 0x9B, 0xAF, 0x8C, 0x60, 0x7D, 0xFA,
+    0x0D, 0xFA, 0x62, 0x8D, 0xE4, 0xDA, 0xA1, 0x8A, 0x6D, 0x58, 0x3F, 0xB8, 0x7A, 0x42, 0xC4, 0x37,
+    0xB0, 0x60, 0x12, 0x7A, 0xD0, 0xBB, 0xEF, 0x86, 0x8F, 0x0E, 0xE8, 0xA7, 0xD6, 0x46, 0x98, 0x81,
+    0x83, 0xDF, 0x82, 0x28, 0x7F, 0x70, 0xC4, 0x85, 0xBE, 0xD4, 0xBF, 0xFF, 0xDA, 0xA9, 0xED, 0x11,
+    0xCD, 0x70, 0x6B, 0xC4, 0xA7, 0xE0, 0x0A, 0x38, 0xF8, 0x00, 0x96, 0x00, 0x42, 0x7B, 0x88, 0xD6,
+    0x02, 0xAA, 0xBA, 0x2F, 0x25, 0xF9, 0x19, 0x94, 0x02, 0x13, 0x81, 0x53, 0x6F, 0x42, 0xFD, 0x40,
+    0xEC, 0x79, 0x54, 0xFF, 0x99, 0x03, 0x96, 0x81, 0x97, 0x0A, 0x98, 0xDF, 0xBD, 0x33, 0x94, 0x0E,
+    0x89, 0x45, 0xF2, 0xB8, 0x02, 0x55, 0x42, 0x58, 0x8D, 0x52, 0x7F, 0x03, 0x68, 0x37, 0xCA, 0xF7,
+    0x6A, 0xCC, 0xAB, 0x86, 0x58, 0x2E, 0x3B, 0xE2, 0xEF, 0x57, 0x84, 0x79, 0x37, 0xA3, 0xD4, 0x22,
+    0xC3, 0x50, 0x44, 0xB2, 0x54, 0x24, 0xE7, 0xDA, 0xD0, 0x72, 0x14, 0xE5, 0x69, 0x7B, 0x95, 0xAD,
+    0x8E, 0x08, 0xAA, 0x97, 0x9F, 0x91, 0x61, 0x3B, 0xF9, 0x34, 0xD7, 0xEF, 0x93, 0x2E, 0xB2, 0xB4,
+    0x1A, 0xFC, 0xC8, 0xC5, 0xEF, 0xBD, 0xD2, 0xD7, 0x52, 0x27, 0xE2, 0xE3, 0x5B, 0x8E, 0x74, 0x57,
+    0x58, 0x19, 0x79, 0x43, 0x06, 0x41, 0x7F, 0x65, 0x6B, 0x75, 0x3C, 0x46, 0x90, 0x4F, 0x83, 0x19,
+    0x40, 0x38, 0xB8, 0x3F, 0xC8, 0x4A, 0x41, 0x5F, 0x06, 0xF4, 0xB3, 0xA6, 0x5A, 0x49, 0xB3, 0x66,
+    0x89, 0x18, 0xA1, 0xDC, 0x82, 0xAD, 0xEE, 0x9C, 0xF0, 0xF4, 0xAB, 0x1A, 0x36, 0xD2, 0x8C, 0x99,
+    0xA8, 0x42, 0xDB, 0x26, 0x9F, 0x96, 0x2A, 0x14, 0x19, 0xB0, 0x5B, 0x3E, 0x00, 0x98, 0x53, 0x59,
+    0x71, 0x20, 0x94, 0x22, 0xB8, 0x3B, 0x4E, 0x58, 0xCD, 0x77, 0xE5, 0xD6, 0xDB, 0xF2, 0x6B, 0x0C,
+    0x56, 0xC3, 0xBF, 0x70, 0xD1, 0xFB, 0x24, 0xBF, 0xC1, 0xFA, 0x4B, 0xFF, 0xD0, 0x8B, 0xBC, 0x21,
+    0xC2, 0x46, 0x8B, 0xD0, 0xDB, 0xF4, 0xA2, 0xD4, 0x89, 0xE4, 0x4F, 0xDE, 0x6E, 0x52, 0x5F, 0x3A,
+    0x23, 0x65, 0x45, 0xFE, 0x3E, 0xBC, 0xE7, 0x24, 0x0B, 0x45, 0xCA, 0x70, 0x38, 0xD2, 0xEA, 0xC6,
+    0xA8, 0xCA, 0xDA, 0xA1, 0x59, 0x30, 0xE8, 0x3F, 0xD7, 0x2E, 0x94, 0x5B, 0x9E, 0xB0, 0xDA, 0x80,
+    0xB5, 0xA4, 0xA0, 0xAD, 0x44, 0x24, 0xEB, 0x8B, 0x14, 0xB1, 0x48, 0xC9, 0xDF, 0x94, 0x15, 0x98,
+    0x24, 0xF4, 0x68, 0x37, 0xAA, 0xDC, 0x00, 0xD8, 0x38, 0x90, 0x48, 0x55, 0x76, 0xDF, 0xB3, 0xE6,
+    0x37, 0x58, 0xF7, 0xC1, 0x8F, 0x5C, 0xF4, 0x3E, 0xE9, 0x3F, 0x7E, 0xAE, 0x36, 0xE2, 0xBB, 0xE2,
+    0xD2, 0xCB, 0xD0, 0xDB, 0x1B, 0x17, 0x22, 0x91, 0x94, 0xE3, 0x43, 0x3B, 0x2A, 0x8D, 0x2B, 0x52,
+    0x11, 0x9B, 0x16, 0x8D, 0xEA, 0xE2, 0xA2, 0xB1, 0xFC, 0x0E, 0xF5, 0x81, 0xF2, 0x0C, 0x57, 0x6A,
+    0xD2, 0xA1, 0x81, 0xF4, 0x52, 0x41, 0xFC, 0xF4, 0x10, 0x95, 0x1B, 0x91, 0x2A, 0x16, 0x19, 0xD2,
+    0x17, 0xB1, 0x61, 0xFF, 0xF6, 0x7D, 0x0F, 0xAB, 0xF3, 0x46, 0x03, 0x41, 0x3D, 0x72, 0xB6, 0xAD,
+    0x27, 0xED, 0x12, 0xD6, 0xC4, 0x05, 0xA9, 0xA5, 0x26, 0x2A, 0x7E, 0x4A, 0x45, 0xD3, 0x54, 0x10,
+    0xB1, 0x87, 0x99, 0x16, 0xBC, 0x38, 0xDE, 0xC4, 0x3F, 0x38, 0x95, 0x42, 0xB5, 0x43, 0xEA, 0x2D,
+    0x31, 0x3B, 0xA5, 0x99, 0x4C, 0x77, 0xC5, 0x06, 0x5B, 0x32, 0x30, 0x59, 0xE3, 0x00, 0x6B, 0xD0,
+    0x85, 0xF9, 0x55, 0x5E, 0x1C, 0x87, 0x35, 0x98, 0xDE, 0x2E, 0x5B, 0x3C, 0xB4, 0x40, 0x9B, 0x5C,
+    0xC9, 0x90, 0xE1, 0x49, 0xD7, 0x61, 0x2D, 0xE1, 0x40, 0xE4, 0xA2, 0xF3, 0x3E, 0x28, 0x7A, 0x2C,
+    0xA4, 0x4C, 0xC5, 0x2E, 0xBE, 0xE1, 0x43, 0x5F, 0x53, 0x8F, 0x67, 0x7C, 0x35, 0xF4, 0xE8, 0xAC,
+    0x87, 0x2A, 0x52, 0xA8, 0x62, 0x87, 0x09, 0x3D, 0x7A, 0x53, 0x44, 0x6A, 0x11, 0x19, 0x6A, 0x87,
+    0x51, 0x1E, 0xED, 0x44, 0xC4, 0x1B, 0x91, 0x5A, 0x8B, 0x88, 0x12, 0x11, 0x37, 0x20, 0xF2, 0xC6,
+    0x06, 0xB5, 0xCE, 0xE9, 0x9E, 0xA8, 0x48, 0xF2, 0x2D, 0x6E, 0xF7, 0xBF, 0x5A, 0x25, 0x35, 0xFB,
+    0x3C, 0x68, 0xE0, 0x93, 0x01, 0x5A, 0x2A, 0x86, 0x27, 0x9D, 0xCE, 0x66, 0x02, 0x1F, 0xE4, 0x09,
+    0x53, 0x81, 0x0F, 0x8A, 0x94, 0xA9, 0xD0, 0x07, 0x45, 0x4A, 0x1A, 0xFA, 0xD0, 0x1B, 0x0C, 0x41,
+    0xA2, 0xFE, 0xD6, 0xCD, 0xA3, 0x4B, 0xDB, 0xEE, 0x7D, 0x45, 0x79, 0xE5, 0x95, 0x0F, 0x1F, 0xF8,
+    0x51, 0xA5, 0x2A, 0x55, 0xA9, 0x2A, 0x55, 0xB5, 0xF7, 0x7C, 0xEB, 0xEF, 0xE6, 0x75, 0xE3, 0x2D,
+    0xCA, 0xAA, 0x6C, 0xEB, 0x27, 0xCA, 0xA2, 0x2C, 0x72, 0x91, 0x8B, 0x5D, 0xEC, 0xC6, 0xCE, 0xAE,
+    0x88, 0xEC, 0x64, 0x00, 0x76, 0x67, 0x18, 0xA8, 0x51, 0x9E, 0xD8, 0x91, 0x42, 0x8F, 0xF0, 0xFE,
+    0x97, 0xC6, 0x32, 0x40, 0x95, 0xE8, 0x02, 0x93, 0x41, 0x24, 0xF5, 0xD6, 0xAA, 0xFA, 0x18, 0x0D,
+    0xB9, 0x3D, 0xBA, 0x4C, 0x11, 0x14, 0x24, 0x04, 0x9E, 0x94, 0xD0, 0x73, 0x58, 0xDF, 0xF0, 0xBD,
+    0x34, 0x1E, 0x5D, 0xD6, 0xD3, 0x93, 0xEF, 0x94, 0x43, 0x73, 0xF9, 0x4F, 0x9C, 0x9B, 0xD3, 0x6E,
+    0x6F, 0x12, 0x6F, 0x96, 0xA7, 0x01, 0x3B, 0x3B, 0xA1, 0xB2, 0x62, 0x76, 0x2A, 0x3A, 0xEF, 0x17,
+    0xD3, 0x78, 0xF3, 0x78, 0xF6, 0x5A, 0xEC, 0x98, 0xD4, 0x17, 0x3F, 0x6A, 0x2A, 0xD4, 0x7D, 0x7A,
+    0xD3, 0xD7, 0xDB, 0xF7, 0xE8, 0xA5, 0xFA, 0xDD, 0x72, 0x60, 0x2E, 0x17, 0x93, 0xB3, 0xB3, 0xB3,
+    0xB3, 0xB3, 0x0B, 0x0B, 0x8B, 0x8B, 0xBD, 0xDE, 0x61, 0xC6, 0x2F, 0x7A, 0x6A, 0x83, 0xDE, 0xF4,
+    0xD4, 0x29, 0xFA, 0xC6, 0xC3, 0x7E, 0x5D, 0xF0, 0x54, 0x29, 0xFA, 0x62, 0x49, 0x65, 0xAC, 0xBE,
+    0x58, 0x52, 0x9A, 0x2C, 0x39, 0x51, 0x05, 0x25, 0x18, 0x82, 0x6B, 0x9E, 0x64, 0x48, 0x28, 0x8E,
+    0xB4, 0x60, 0x11, 0x7E, 0xC5, 0xA3, 0x3E, 0xCC, 0xD1, 0xAF, 0xB0, 0x4D, 0x19, 0x04, 0x34, 0x25,
+    0xEB, 0x2C, 0xAC, 0x15, 0x84, 0x9B, 0x19, 0xF1, 0x04, 0xB4, 0x16, 0xE0, 0xA3, 0x02, 0x75, 0xD3,
+    0xA1, 0x13, 0x68, 0xF5, 0xE0, 0xE3, 0x86, 0xC4, 0x9E, 0x00, 0x16, 0x20, 0xCA, 0x51, 0x32, 0x22,
+    0x4A, 0xE1, 0x18, 0xDA, 0xA9, 0x37, 0xC9, 0xF7, 0xA3, 0x5D, 0x50, 0x91, 0x64, 0xCD, 0xA5, 0x24,
+    0xB1, 0x41, 0x49, 0x62, 0xC3, 0xB2, 0x51, 0xDD, 0xDD, 0x8B, 0x41, 0x79, 0x86, 0x4A, 0x72, 0x53,
+    0x2B, 0xE1, 0xAB, 0x16, 0x9E, 0x22, 0x28, 0x99, 0x5A, 0x0B, 0xDC, 0x31, 0x80, 0xBD, 0x84, 0x0E,
+    0x7D, 0x97, 0x3C, 0xDF, 0xF1, 0x72, 0x02, 0x66, 0xA1, 0x20, 0xCE, 0x58, 0xC2, 0xF8, 0xB0, 0x49,
+    0x16, 0x62, 0x67, 0x48, 0xC3, 0x92, 0x5E, 0x92, 0xA9, 0xA2, 0x46, 0x5F, 0xCA, 0xE9, 0x18, 0xB8,
+    0x53, 0xA2, 0x24, 0x43, 0xD7, 0xD0, 0x2D, 0x08, 0xC4, 0x11, 0x89, 0x23, 0xED, 0x3A, 0x7A, 0x5D,
+    0xA7, 0x7C, 0xDF, 0x69, 0x27, 0xCE, 0x20, 0xAE, 0x0E, 0x1A, 0x07, 0x4A, 0x33, 0x18, 0x36, 0x31,
+    0x48, 0x3B, 0x58, 0x86, 0xB0, 0x84, 0x27, 0xEE, 0x83, 0x11, 0xDD, 0xC8, 0x93, 0x94, 0x97, 0x7C,
+    0x20, 0x36, 0xAA, 0x48, 0x3D, 0x7D, 0x1F, 0xDE, 0xF2, 0xF1, 0x4D, 0x9F, 0xC6, 0x65, 0xAD, 0xB7,
+    0xAB, 0xE4, 0xC8, 0x93, 0x38, 0x36, 0x08, 0x4B, 0xB4, 0x6B, 0x54, 0x1E, 0xC7, 0xE1, 0xCD, 0xEC,
+    0x13, 0xF7, 0xB7, 0x73, 0x5D, 0x28, 0xCF, 0x80, 0xBF, 0x93, 0x1F, 0x58, 0x8A, 0x4E, 0xBE, 0x9D,
+    0x0F, 0x54, 0x46, 0x64, 0xD1, 0x30, 0xB5, 0x33, 0x88, 0x41, 0x72, 0xEF, 0x99, 0x3E, 0x70, 0x8E,
+    0xB8, 0xE3, 0x7D, 0xCF, 0x1B, 0x91, 0xE6, 0x04, 0x65, 0xA7, 0x29, 0xE2, 0xC6, 0x9B, 0x27, 0x68,
+    0x05, 0x45, 0x94, 0x1D, 0x61, 0x2D, 0xCC, 0xB5, 0x6D, 0x53, 0xAA, 0x5C, 0xDB, 0x16, 0x5E, 0xFD,
+    0xA1, 0xAE, 0x8D, 0xDF, 0xFD, 0x53, 0x8E, 0xB0, 0x9D, 0xD0, 0x5B, 0xBA, 0xD0, 0x85, 0x65, 0xA8,
+    0xA1, 0xFE, 0x09, 0xC3, 0x01, 0xAA, 0xD4, 0xB9, 0x09, 0xAA, 0x38, 0x37, 0x8C, 0xDD, 0x33, 0xF2,
+    0xDE, 0x84, 0xF9, 0x94, 0xF9, 0x94, 0xB5, 0x94, 0xB5, 0x07, 0x06, 0x7F, 0xEE, 0xEE, 0xE0, 0xD1,
+    0x89, 0x37, 0x72, 0xBF, 0xB6, 0x30, 0x3D, 0x35, 0x16, 0x67, 0x61, 0xCE, 0x1A, 0x6D, 0xB4, 0x55,
+    0x39, 0x25, 0x6D, 0x34, 0xCA, 0xF1, 0x29, 0xC6, 0xEB, 0x9A, 0x7B, 0x9F, 0xAD, 0x97, 0x50, 0xA7,
+    0xD4, 0x29, 0xA7, 0xFF, 0xEA, 0x67, 0x9B, 0x00, 0xDF, 0xCC, 0xF9, 0x23, 0xC1, 0xF1, 0xBC, 0x37,
+    0xA3, 0x37, 0xF3, 0xBA, 0x8D, 0xCA, 0x69, 0xA3, 0xF2, 0x86, 0x5E, 0x69, 0x5B, 0x25, 0x98, 0x1D,
+    0xCB, 0xEB, 0x01, 0x18, 0x25, 0x43, 0x9E, 0x66, 0xBF, 0x6B, 0xB7, 0x72, 0x90, 0xC4, 0xB6, 0xA1,
+    0xC4, 0x49, 0x5A, 0x40, 0x72, 0x1D, 0x48, 0x3C, 0x90, 0xE6, 0x40, 0xEA, 0xB6, 0xA8, 0xD8, 0x74,
+    0x9B, 0x02, 0x15, 0x20, 0x10, 0x40, 0x09, 0x10, 0xF7, 0xF7, 0x3D, 0x4F, 0x62, 0x44, 0xE8, 0x18,
+    0x11, 0x7A, 0x46, 0x84, 0x12, 0x08, 0x8B, 0x2D, 0x46, 0x57, 0x67, 0x5B, 0x0C, 0xEF, 0xDE, 0x06,
+    0x49, 0xB3, 0xD5, 0x16, 0x14, 0x30, 0xD5, 0x7C, 0x6E, 0x06, 0xC2, 0x1C, 0xDA, 0x5F, 0x47, 0x0D,
+    0x61, 0x19, 0xBA, 0x8E, 0xE5, 0x16, 0x1D, 0xE5, 0xA0, 0x05, 0xEA, 0x0F, 0xC1, 0xF8, 0x66, 0xB8,
+    0x69, 0xE0, 0x18, 0xB0, 0x0A, 0xDC, 0x9F, 0x3B, 0xD0, 0xD6, 0x05, 0x4B, 0xDA, 0xB3, 0xA4, 0x4B,
+    0x96, 0x74, 0xCD, 0xA2, 0x1E, 0xD0, 0xD3, 0x7D, 0x7A, 0xFA, 0x77, 0x6C, 0x2F, 0xB9, 0xEC, 0xEA,
+    0xE4, 0x52, 0x5E, 0x27, 0x17, 0x8B, 0x3A, 0xBD, 0xE0, 0xEB, 0x34, 0xAB, 0xEA, 0x34, 0x5B, 0xAF,
+    0x4D, 0x66, 0x2A, 0x93, 0xA5, 0x95, 0x71, 0x49, 0x65, 0x9C, 0xAE, 0x88, 0xA0, 0x05, 0x05, 0xF1,
+    0xCE, 0x5B, 0x1F, 0xFA, 0x06, 0x22, 0xAA, 0x3C, 0xA2, 0x6D, 0x6B, 0x91, 0x8F, 0xBC, 0x7A, 0xCF,
+    0xE9, 0x73, 0xB4, 0x7B, 0xDC, 0xF1, 0xEA, 0x87, 0x4E, 0xF7, 0xE9, 0x00, 0x5F, 0x8D, 0x73, 0xDA,
+    0x0F, 0x1D, 0xFE, 0x9A, 0xED, 0x25, 0x97, 0xB3, 0x3A, 0xB9, 0xE4, 0x7E, 0xCC, 0xF0, 0xE6, 0xEE,
+    0xF0, 0x8C, 0x76, 0x47, 0x74, 0xDE, 0x4C, 0x6F, 0xED, 0x9A, 0x19, 0x6F, 0x1E, 0x0D, 0x44, 0xE4,
+    0x49, 0x1D, 0x1B, 0xA3, 0xCC, 0x67, 0x19, 0xD8, 0x8B, 0x65, 0x7F, 0x04, 0x51, 0xAF, 0xE1, 0x24,
+    0x59, 0xD9, 0xF9, 0x60, 0x9F, 0x0B, 0xE8, 0x31, 0x0E, 0xEE, 0x8E, 0x89, 0x3D, 0xDA, 0xB2, 0xEB,
+    0xB3, 0xE8, 0xCC, 0xA2, 0x72, 0x74, 0x46, 0x07, 0x5E, 0xBF, 0xDF, 0x9A, 0x4F, 0x9C, 0xB5, 0xA9,
+    0xE4, 0xE9, 0x79, 0x9F, 0xB2, 0xD6, 0x61, 0xA1, 0xCD, 0x62, 0x9B, 0xC5, 0x0E, 0x8B, 0x1D, 0x7A,
+    0xCD, 0xB9, 0x4C, 0xEF, 0xF3, 0xD3, 0xBA, 0xF6, 0x84, 0x92, 0x13, 0xDD, 0x7E, 0x24, 0xE8, 0x86,
+    0xA0, 0xA2, 0x5B, 0x84, 0xC2, 0xC3, 0x78, 0xC7, 0x27, 0x87, 0x16, 0x23, 0x35, 0x26, 0x33, 0xCE,
+    0x64, 0xAA, 0x4A, 0x32, 0x4C, 0x9C, 0x13, 0xBD, 0xEB, 0xA1, 0xAA, 0xC0, 0xB4, 0x21, 0x7E, 0xCB,
+    0x12, 0x7E, 0x52, 0x40, 0x55, 0x43, 0x27, 0xCD, 0x30, 0xCF, 0x0C, 0xFF, 0x53, 0xDF, 0x89, 0x88,
+    0x4F, 0x44, 0x7C, 0x20, 0x52, 0x32, 0x3E, 0xA2, 0x39, 0xBE, 0x72, 0xCD, 0x9B, 0xE1, 0x15, 0x3E,
+    0x2B, 0x07, 0x0D, 0xB0, 0x87, 0x39, 0x42, 0xB7, 0x55, 0x1D, 0x54, 0x0F, 0x50, 0x30, 0x9F, 0x2F,
+    0xD0, 0xED, 0x0A, 0x39, 0x7E, 0xB0, 0x42, 0x7E, 0x44, 0xD0, 0xE3, 0x84, 0x59, 0x58, 0x04, 0x9E,
+    0x8A, 0x1E, 0x93, 0xEC, 0xBB, 0x0F, 0xAD, 0x16, 0x41, 0x55, 0xAA, 0x66, 0x88, 0x2E, 0x92, 0x0C,
+    0x13, 0x96, 0x04, 0xA5, 0x01, 0x7D, 0xB1, 0x80, 0xBA, 0x0D, 0xF1, 0x66, 0x0E, 0xBD, 0x0E, 0xE8,
+    0x8B, 0x1E, 0xAA, 0x34, 0xC3, 0x3C, 0x2D, 0xAF, 0x5D, 0xF3, 0x5A, 0x44, 0xE8, 0x8A, 0xB8, 0x40,
+    0xA4, 0xDC, 0xDE, 0xA7, 0x82, 0xA7, 0xF8, 0x72, 0xE0, 0xB9, 0x1E, 0xBB, 0xA8, 0x98, 0x64, 0xEC,
+    0x41, 0x9A, 0x2A, 0x2D, 0x40, 0x06, 0xA8, 0x3C, 0x21, 0xCA, 0xA2, 0x2C, 0xB6, 0xCA, 0xC5, 0x56,
+    0x39, 0x6D, 0x95, 0x8B, 0xB3, 0xC8, 0x45, 0x79, 0x92, 0x29, 0x11, 0x90, 0xC1, 0x68, 0x0B, 0xA6,
+    0x09, 0xB3, 0x51, 0x13, 0xA0, 0xEE, 0xAE, 0x94, 0xF2, 0x67, 0x68, 0x29, 0x29, 0x62, 0x37, 0x41,
+    0x9B, 0x22, 0x2C, 0xA6, 0x98, 0x0A, 0x0A, 0x55, 0x4C, 0x05, 0x83, 0x40, 0x24, 0x4B, 0xA5, 0x08,
+    0x45, 0xB2, 0xD4, 0xAE, 0x87, 0xA5, 0x2A, 0x8C, 0x4D, 0x55, 0xA9, 0x4A, 0x63, 0xCD, 0xC5, 0x4A,
+    0xD5, 0x26, 0x33, 0x2E, 0x70, 0xCA, 0x45, 0x56, 0x37, 0x35, 0xEC, 0xAE, 0xF6, 0xC0, 0x0C, 0x8C,
+    0xED, 0xD0, 0xA1, 0x4D, 0x9B, 0x0E, 0xCB, 0x6C, 0xD0, 0x47, 0x0F, 0x33, 0x44, 0xEC, 0x04, 0x3D,
+    0x0A, 0x95, 0x4F, 0x70, 0x24, 0x28, 0x82, 0x62, 0x8A, 0x4E, 0x50, 0x24, 0x79, 0x22, 0x55, 0x28,
+    0x43, 0x52, 0xA9, 0xC2, 0x32, 0xCE, 0x53, 0xDB, 0x51, 0x65, 0xE8, 0x8D, 0x35, 0x27, 0x4A, 0x55,
+    0x99, 0xCC, 0x6C, 0x56, 0xAA, 0xBE, 0x9F, 0x07, 0xB3, 0x28, 0x0F, 0x5D, 0x88, 0x0A, 0x18, 0x80,
+    0x76, 0x8C, 0x05, 0xEA, 0x7B, 0xB9, 0x94, 0xC6, 0xEA, 0x4C, 0x15, 0xCD, 0x62, 0x96, 0x45, 0x45,
+    0x58, 0xD1, 0xBF, 0x67, 0xDB, 0xD5, 0x87, 0x15, 0x03, 0x0C, 0xDA, 0xC5, 0x05, 0x01, 0x7B, 0x99,
+    0xDE, 0x0D, 0xDF, 0xC9, 0x08, 0x3D, 0x7C, 0xE9, 0xF3, 0xD2, 0xC8, 0x5E, 0x9E, 0xCE, 0x8F, 0x45,
+    0xFF, 0x85, 0xC4, 0xF2, 0x22, 0x10, 0x58, 0xDB, 0x1E, 0x28, 0xC9, 0x8D, 0x55, 0x05, 0x9D, 0xD1,
+    0x62, 0x58, 0xB0, 0x4C, 0x5C, 0x6C, 0xA3, 0xDB, 0xD3, 0xEC, 0x7F, 0xA0, 0xB2, 0x66, 0xC5, 0x79,
+    0xE0, 0x18, 0x97, 0x0F, 0xD0, 0x32, 0x20, 0x1E, 0x5E, 0x6D, 0x6A, 0xBC, 0x72, 0xB4, 0x83, 0xA0,
+    0x33, 0x08, 0xE5, 0x55, 0x48, 0xA5, 0x20, 0xE8, 0x8B, 0x85, 0x73, 0xE5, 0x68, 0x1D, 0xEC, 0xE6,
+    0x93, 0x98, 0x32, 0x69, 0xAA, 0x92, 0x81, 0x16, 0x19, 0xD0, 0x97, 0x0F, 0xB6, 0xEF, 0x99, 0x33,
+    0x8D, 0xCA, 0x58, 0xDB, 0x9E, 0x06, 0x72, 0xFE, 0xCE, 0xAB, 0x2D, 0x94, 0x23, 0xB5, 0xC8, 0x4A,
+    0xD0, 0x77, 0x2C, 0xEF, 0x52, 0x1F, 0xCB, 0xB0, 0x2F, 0xEF, 0x6C, 0x7D, 0x6D, 0x15, 0xE8, 0x03,
+    0x6B, 0xAB, 0xDB, 0x75, 0xDB, 0xA8, 0x3E, 0x1E, 0x5A, 0x44, 0x72, 0xFA, 0x3F, 0xB8, 0xD2, 0x54,
+    0x8B, 0x76, 0xB4, 0xCA, 0x56, 0x40, 0x7A, 0xC7, 0x12, 0xCA, 0x10, 0x9E, 0x94, 0x12, 0xC6, 0xC5,
+    0x36, 0x4B, 0x79, 0x34, 0x08, 0xAC, 0x92, 0xA7, 0x45, 0xC4, 0x89, 0x48, 0x2E, 0x22, 0x79, 0x2C,
+    0xA3, 0xE2, 0x96, 0xBD, 0x68, 0xAB, 0xFE, 0x2F, 0xC5, 0xFC, 0x24, 0xF6, 0x27, 0x62, 0x7B, 0x52,
+    0x56, 0x30, 0x52, 0x92, 0xDE, 0x79, 0xBD, 0x61, 0x11, 0xF2, 0xD1, 0x0E, 0x46, 0x07, 0x88, 0x87,
+    0x2B, 0xD0, 0x97, 0x8C, 0x71, 0x19, 0x40, 0xD0, 0xCF, 0x21, 0xAA, 0x21, 0x10, 0x7B, 0x0A, 0xC9,
+    0xBB, 0x4D, 0xE1, 0x56, 0x1A, 0x91, 0x32, 0x94, 0xE1, 0x4A, 0xE3, 0x08, 0xE1, 0x95, 0xA6, 0x96,
+    0x21, 0xA2, 0x61, 0xA4, 0xFF, 0xAA, 0xF1, 0x4B, 0x0E, 0xB2, 0xDB, 0x36, 0xAD, 0x14, 0x03, 0x80,
+    0x17, 0x43, 0x88, 0x23, 0xDB, 0xA8, 0x2A, 0xDE, 0xDE, 0x68, 0xB8, 0x87, 0xFE, 0xF8, 0x9C, 0x00,
+    0x6F, 0x07, 0xB8, 0xC0, 0xED, 0x8F, 0x9E, 0x25, 0x71, 0xAC, 0x3E, 0x9A, 0x3D, 0xF7, 0x9D, 0x39,
+    0x73, 0xDA, 0x88, 0x0C, 0x8C, 0xC8, 0x60, 0xAF, 0x1A, 0x41, 0xD8, 0x96, 0xA2, 0x91, 0xE8, 0xC7,
+    0x48, 0xEC, 0xEF, 0x0A, 0x19, 0xF0, 0x8D, 0x91, 0xAA, 0x2A, 0x80, 0x79, 0x5A, 0x68, 0x7E, 0xEE,
+    0xBB, 0xA9, 0x14, 0x2D, 0x34, 0x91, 0x0B, 0x3C, 0x8B, 0x24, 0xC4, 0x2E, 0x94, 0xAC, 0x5F, 0x26,
+    0x43, 0xBE, 0x06, 0x2B, 0x1C, 0x0A, 0x2A, 0x5E, 0x1C, 0x6F, 0x38, 0x80, 0xD8, 0x43, 0x78, 0xB7,
+    0x0A, 0xFD, 0xFC, 0xC0, 0x59, 0x0E, 0x10, 0xE4, 0x07, 0x66, 0xD4, 0x8D, 0xBC, 0xC5, 0xCF, 0x7D,
+    0x37, 0x96, 0x4A, 0x39, 0x5A, 0x44, 0x8E, 0xC5, 0xE6, 0x12, 0x3B, 0xFA, 0x45, 0x2C, 0xB6, 0x5B,
+    0xFD, 0xA4, 0x41, 0x43, 0x91, 0x2C, 0x14, 0xC9, 0x7E, 0xF2, 0xA0, 0xCD, 0x86, 0x8D, 0x66, 0xEC,
+    0xD3, 0xE3, 0x32, 0xC4, 0x93, 0xD0, 0x97, 0x1F, 0xCA, 0x30, 0xF0, 0x24, 0x84, 0x9E, 0xB4, 0x0A,
+    0x25, 0x4F, 0x86, 0xCC, 0x8C, 0x11, 0xFC, 0xCF, 0x43, 0xEC, 0x3E, 0x90, 0xF3, 0x54, 0xC2, 0xBD,
+    0x25, 0xF8, 0x59, 0x63, 0xC3, 0x7A, 0x40, 0xF4, 0x89, 0x27, 0x79, 0xCB, 0xD1, 0x35, 0x04, 0x55,
+    0x4D, 0x74, 0xCB, 0x93, 0x5C, 0x76, 0x74, 0x52, 0xA8, 0x7A, 0xA8, 0xEF, 0x7B, 0x92, 0x93, 0x39,
+    0xEB, 0xA9, 0x8B, 0xCA, 0x6E, 0x33, 0x8D, 0x42, 0x91, 0x32, 0x10, 0xD9, 0x72, 0xB8, 0xCE, 0x78,
+    0xF0, 0x3F, 0x0E, 0xED, 0x8E, 0xB7, 0x55, 0xDB, 0xA2, 0xB5, 0xC6, 0xC7, 0xB9, 0x7A, 0xD3, 0xEA,
+    0x23, 0xB4, 0x16, 0xF8, 0xA8, 0x50, 0xEF, 0xB9, 0xF4, 0xD9, 0x1F, 0x0E, 0x8C, 0x94, 0x7D, 0xC9,
+    0xFB, 0x97, 0x2D, 0x67, 0xAE, 0x12, 0xC9, 0x3D, 0x7C, 0xDD, 0xEB, 0x8C, 0x7F, 0xAB, 0x24, 0x7D,
+    0x2B, 0xA7, 0x6B, 0x08, 0xEA, 0xBA, 0x81, 0x75, 0xD9, 0xB1, 0xDC, 0xC0, 0x52, 0xDF, 0xF7, 0xE8,
+    0x4B, 0x8E, 0x4E, 0x4A, 0x50, 0xAE, 0x13, 0xBF, 0x53, 0xD3, 0x7D, 0xA6, 0x09, 0x3B, 0x3E, 0x15,
+    0xB1, 0xA3, 0x24, 0x64, 0xDF, 0xD9, 0xF3, 0x77, 0x81, 0x29, 0xA7, 0xDE, 0xB4, 0x7A, 0x86, 0xD6,
+    0x1A, 0x1F, 0x17, 0xEA, 0x66, 0xA6, 0xA7, 0x68, 0x2F, 0x86, 0xE5, 0xB0, 0xFF, 0xAE, 0xC8, 0x49,
+    0x19, 0xC4, 0x55, 0xD9, 0xB0, 0x16, 0xFB, 0xD1, 0x78, 0xB4, 0x6C, 0x77, 0x38, 0xEC, 0x38, 0x06,
+    0xC4, 0x9F, 0x94, 0xDB, 0xFA, 0x79, 0x04, 0x5C, 0x83, 0x87, 0xE2, 0x02, 0xF2, 0x28, 0x74, 0x2D,
+    0x25, 0x6E, 0x47, 0x26, 0xE2, 0x47, 0x6A, 0x9A, 0xA1, 0x75, 0x9D, 0x8F, 0x0A, 0x75, 0x33, 0xD3,
+    0x2F, 0xB0, 0x6E, 0xAE, 0x95, 0x22, 0xEF, 0x88, 0x1C, 0x1F, 0xB6, 0x89, 0xF2, 0xA6, 0xBD, 0x67,
+    0xF3, 0x21, 0x19, 0x0C, 0xC6, 0x06, 0xF5, 0x83, 0xF8, 0x6E, 0x6D, 0xE3, 0xDB, 0xB2, 0x9F, 0xBE,
+    0xE4, 0x58, 0x4A, 0x6D, 0x58, 0xF6, 0x49, 0xDE, 0x6E, 0xC8, 0xA3, 0x3A, 0x16, 0xC9, 0xB7, 0x4D,
+    0x70, 0x85, 0xC7, 0x8E, 0x72, 0xD4, 0xF1, 0x1E, 0x41, 0xF9, 0x19, 0xC0, 0x4D, 0x32, 0xC6, 0x11,
+    0x34, 0x1D, 0x12, 0x7E, 0x91, 0x2F, 0xDF, 0x0B, 0xEE, 0x75, 0xC6, 0xAF, 0x18, 0x1B, 0xD6, 0x3A,
+    0xA7, 0xAB, 0x3C, 0x89, 0xAB, 0x89, 0xBC, 0x21, 0xA8, 0xB4, 0x63, 0x59, 0x79, 0x92, 0xAC, 0xBE,
+    0xCB, 0x78, 0x75, 0x42, 0x4F, 0x62, 0xD7, 0x89, 0xF3, 0xD4, 0x45, 0x65, 0x24, 0x52, 0x23, 0x22,
+    0xA4, 0x22, 0x76, 0x87, 0xA3, 0x41, 0x93, 0xAD, 0xA8, 0xE2, 0x08, 0x53, 0xF7, 0x84, 0x3B, 0x8D,
+    0x26, 0xB6, 0x3B, 0x24, 0xD3, 0x44, 0x8D, 0xD8, 0xC8, 0xA5, 0x56, 0xDD, 0x11, 0xAB, 0x44, 0x6C,
+    0x28, 0x62, 0xE9, 0x5F, 0xB6, 0x87, 0x09, 0x5E, 0xFF, 0xD9, 0x34, 0x77, 0xBB, 0xD9, 0xEB, 0xDD,
+    0x0F, 0xFC, 0x16, 0xD0, 0x7B, 0x44, 0x95, 0x85, 0x8E, 0xFD, 0x50, 0x10, 0xD4, 0x70, 0xAA, 0xB9,
+    0xC5, 0xA8, 0xB4, 0x54, 0xDF, 0x03, 0x98, 0xBD, 0xA7, 0xF2, 0x42, 0x15, 0x80, 0xBE, 0xE4, 0x80,
+    0xA5, 0x14, 0x08, 0xFD, 0x12, 0xA0, 0x5D, 0x05, 0x74, 0x94, 0x0F, 0x7D, 0x50, 0xC6, 0x4E, 0xE7,
+    0xDA, 0x25, 0xB6, 0xEF, 0x0C, 0x1D, 0x25, 0x4F, 0x57, 0xD4, 0xA9, 0xC4, 0xB9, 0xF2, 0x83, 0x75,
+    0x43, 0xFC, 0xFE, 0x47, 0x75, 0x4D, 0xD2, 0xBF, 0xF8, 0x97, 0x05, 0xA6, 0x8E, 0xC5, 0x22, 0x3E,
+    0xA9, 0x51, 0x62, 0x8D, 0x27, 0xAE, 0xE9, 0x67, 0x24, 0xC5, 0xD6, 0xF6, 0x49, 0x34, 0xE2, 0xC7,
+    0x67, 0xE7, 0x21, 0x7B, 0x6C, 0x1B, 0xC3, 0x69, 0x98, 0xEC, 0x41, 0x6B, 0x11, 0x16, 0xDB, 0x70,
+    0xBD, 0x13, 0xB9, 0x32, 0xD5, 0x85, 0x4F, 0xCC, 0xA7, 0x5E, 0x8B, 0x14, 0x5A, 0x24, 0x8F, 0xEB,
+    0xBE, 0x53, 0x95, 0x71, 0xCA, 0x27, 0x19, 0x61, 0xD6, 0x74, 0x0F, 0x1D, 0x58, 0x85, 0xD5, 0xFD,
+    0xF7, 0x2C, 0x4C, 0x9F, 0x5B, 0xB3, 0xCF, 0x21, 0x58, 0x24, 0xF8, 0x90, 0x28, 0x74, 0xBB, 0xB6,
+    0x6A, 0xEB, 0x9F, 0xBE, 0x7B, 0xE2, 0xD4, 0x18, 0x54, 0xDA, 0x52, 0x27, 0x36, 0xA8, 0xD3, 0xEC,
+    0x8B, 0x69, 0x4F, 0x3A, 0x46, 0xE3, 0x2E, 0xBA, 0x09, 0xDE, 0xF7, 0xB2, 0xE1, 0xA3, 0xB6, 0x3B,
+    0xBA, 0x22, 0xAE, 0xC9, 0x5C, 0xF4, 0x96, 0x94, 0x23, 0xA9, 0x46, 0x52, 0xEF, 0x90, 0x01, 0x68,
+    0x39, 0x73, 0x46, 0x89, 0x88, 0x97, 0x86, 0xAC, 0x16, 0x4B, 0x0C, 0xC7, 0x08, 0xDD, 0xBD, 0x0D,
+    0xC0, 0x5A, 0x2A, 0x23, 0x9E, 0xD4, 0x86, 0x25, 0xA9, 0x0D, 0x2B, 0xD2, 0x2C, 0xAC, 0x48, 0x5D,
+    0x30, 0xBC, 0x7A, 0x52, 0x24, 0x95, 0x41, 0x43, 0x5B, 0x6C, 0x11, 0xFB, 0x63, 0x3B, 0x10, 0x9A,
+    0xA6, 0xFD, 0xB0, 0x0E, 0x44, 0x04, 0xE8, 0xBA, 0xA6, 0x59, 0xC2, 0x38, 0x30, 0xF9, 0x48, 0x8A,
+    0x91, 0xF8, 0x1D, 0x52, 0x82, 0x19, 0x9C, 0x39, 0xAD, 0x45, 0x64, 0x73, 0x84, 0x70, 0xC0, 0x24,
+    0xC1, 0x16, 0xBF, 0xBB, 0xE5, 0xE4, 0x32, 0xD4, 0x52, 0x13, 0xE7, 0xAC, 0x13, 0xE7, 0x6C, 0x10,
+    0x17, 0x6C, 0x10, 0x7B, 0xBA, 0x57, 0xFF, 0xBD, 0xC8, 0x9B, 0x22, 0x96, 0xA3, 0x11, 0x44, 0x27,
+    0x69, 0x78, 0xD1, 0x2F, 0x54, 0x79, 0xBB, 0x60, 0x3A, 0x62, 0xC6, 0x93, 0xC2, 0xA1, 0x47, 0x57,
+    0x5E, 0x54, 0x2C, 0xBF, 0xEB, 0x34, 0x0B, 0x41, 0x11, 0x65, 0x53, 0x2C, 0x84, 0x45, 0x9C, 0xA5,
+    0xF4, 0x42, 0x1F, 0xBB, 0x94, 0x1E, 0x0B, 0x2C, 0xB2, 0x04, 0xEC, 0xD9, 0xDF, 0x9A, 0x07, 0x66,
+    0x31, 0xB6, 0x35, 0x3F, 0xAB, 0x6C, 0x7B, 0xEC, 0x37, 0x1F, 0xFB, 0xE6, 0x1F, 0x5F, 0xE9, 0xC1,
+    0xD8, 0xD9, 0x2B, 0x23, 0x8A, 0x7C, 0xDF, 0x73, 0xDB, 0x8D, 0x52, 0x3C, 0xCE, 0xB7, 0xB2, 0xF9,
+    0x6E, 0x1D, 0x55, 0x2C, 0xF6, 0x06, 0xA7, 0xEF, 0x76, 0x37, 0xA7, 0x76, 0x6E, 0xEE, 0xE0, 0xE1,
+    0xC9, 0xB3, 0x4F, 0xD4, 0x10, 0x78, 0xD6, 0x52, 0xF4, 0x89, 0xA2, 0x09, 0xDD, 0xB3, 0xEA, 0xC4,
+    0x4D, 0x6B, 0xAC, 0xCA, 0x80, 0x05, 0xDA, 0x2C, 0xD2, 0x61, 0x69, 0xC4, 0x60, 0x9D, 0xA8, 0x92,
+    0xAC, 0xD6, 0x6E, 0xDD, 0x5C, 0x7E, 0xD7, 0xD7, 0xCB, 0xA9, 0x35, 0xC7, 0x47, 0x6F, 0x8C, 0x45,
+    0xDD, 0x68, 0xEC, 0xE0, 0x5C, 0x77, 0xEE, 0xE0, 0xF2, 0x6B, 0xBB, 0xFB, 0x05, 0x0B, 0x4C, 0xA0,
+    0xB2, 0xC7, 0x1F, 0x7F, 0x62, 0x8E, 0x5D, 0xBF, 0x3D, 0x01, 0xCA, 0xBE, 0x2D, 0x24, 0x3E, 0x3F,
+    0xB4, 0x2B, 0x0C, 0x3F, 0x38, 0x08, 0x63, 0x67, 0xFF, 0x83, 0x0C, 0x81, 0xC9, 0xC5, 0xDE, 0x60,
+    0x72, 0xEC, 0x19, 0x57, 0xF7, 0xF4, 0x5B, 0x79, 0x3D, 0x02, 0x94, 0x5E, 0x7E, 0xD7, 0xD7, 0xCB,
+    0xC6, 0x6E, 0x35, 0x1F, 0x07, 0x4A, 0x05, 0xCE, 0x58, 0x3B, 0x79, 0xEB, 0x3F, 0xBF, 0x54, 0x74,
+    0x6F, 0xE7, 0x7F, 0xAA, 0xB2, 0x7B, 0x50, 0x06, 0x39, 0x35, 0xDF, 0x77, 0xF9, 0x7E, 0xE0, 0xAE,
+    0x42, 0xB6, 0xBB, 0xAE, 0xB5, 0xBC, 0x71, 0xC6, 0xEE, 0x7C, 0xBF, 0xE9, 0xD3, 0xDE, 0xFB, 0xEF,
+    0xFE, 0x11, 0x73, 0x5F, 0x73, 0x7F, 0x2A, 0x19, 0xDD, 0x4F, 0xB3, 0x3F, 0x52, 0x7F, 0x7F, 0x4F,
+    0xB7, 0x3C, 0xFC, 0xE2, 0xBF, 0xFE, 0x95, 0x9F, 0xFF, 0x8F, 0xE7, 0x79, 0x3C, 0x73, 0x6B, 0xFF,
+    0x74, 0xC7, 0xBD, 0x5E, 0xFC, 0xBD, 0xAC, 0xE9, 0x70, 0x59, 0xDD, 0x9A, 0x12, 0x77, 0x55, 0x39,
+    0x02, 0xB4, 0xF5, 0x44, 0x00, 0x3C, 0xF7, 0x6D, 0x23, 0x05, 0xCC, 0xEA, 0x59, 0x3D, 0xAB, 0x17,
+    0xF4, 0x42, 0x32, 0x39, 0x46, 0x20, 0xFF, 0xFD, 0x9A, 0x6D, 0x53, 0x06, 0x16, 0x38, 0xC8, 0x51,
+    0x0E, 0xCE, 0xBC, 0xF2, 0x9B, 0x7F, 0xF0, 0xCD, 0xFF, 0xFD, 0xCD, 0x3A, 0xB4, 0x8A, 0x88, 0x5D,
+    0x5B, 0xE5, 0x55, 0x0E, 0x41, 0xC9, 0x93, 0x1F, 0xF0, 0x54, 0x27, 0x76, 0xFA, 0x1C, 0xCB, 0x27,
+    0xDF, 0xBA, 0x79, 0xBC, 0x9F, 0x85, 0xC5, 0x76, 0x7B, 0x27, 0x49, 0xFE, 0x58, 0x6B, 0x7E, 0x62,
+    0x61, 0xEA, 0xC0, 0x7C, 0x34, 0x32, 0x74, 0x52, 0x3C, 0xD6, 0x6A, 0xEF, 0x99, 0x8F, 0xB7, 0xEA,
+    0xD0, 0x99, 0x53, 0x9C, 0xCC, 0x00, 0x0E, 0x1D, 0xDA, 0xBB, 0x17, 0xF8, 0x37, 0x80, 0x7B, 0x89,
+    0x28, 0xE3, 0xEC, 0xB7, 0xE1, 0x9C, 0xAC, 0x84, 0x2B, 0xC4, 0xC7, 0x2D, 0x1C, 0xB2, 0xCD, 0x1E,
+    0x41, 0x73, 0x7C, 0x2D, 0x12, 0x11, 0x29, 0xCE, 0x9C, 0x39, 0xF3, 0xAB, 0x05, 0x80, 0x65, 0x1C,
+    0xB4, 0x45, 0x67, 0x5B, 0xF3, 0x39, 0x12, 0x79, 0xE1, 0xEA, 0xEB, 0x0B, 0x04, 0x05, 0x51, 0xC6,
+    0x14, 0x74, 0xE5, 0xA3, 0x3B, 0x57, 0x5F, 0xCE, 0x98, 0x82, 0x05, 0x02, 0x4F, 0x24, 0xF2, 0x82,
+    0x0C, 0xBA, 0x52, 0x8E, 0x9D, 0x79, 0xFE, 0x8A, 0x16, 0x19, 0x36, 0x5C, 0x63, 0x8B, 0xA6, 0xDE,
+    0x52, 0xF9, 0xA8, 0x30, 0x6C, 0xEF, 0x03, 0x2D, 0x15, 0xAA, 0x8C, 0x1D, 0x15, 0x25, 0x6D, 0xA6,
+    0xD0, 0xA8, 0x4C, 0x39, 0x0A, 0x3C, 0xD7, 0x69, 0xAB, 0x1A, 0x6D, 0x2B, 0xB6, 0xC3, 0x91, 0xBE,
+    0x2F, 0x7D, 0x11, 0xF9, 0xE4, 0x07, 0x57, 0x2F, 0x43, 0x0B, 0x4A, 0x54, 0x8E, 0xB6, 0xB4, 0xA1,
+    0x44, 0x15, 0x24, 0x19, 0xCB, 0x04, 0x15, 0x51, 0x41, 0xE2, 0x20, 0x2D, 0x89, 0xEE, 0xD4, 0x2C,
+    0xB1, 0xA8, 0x72, 0xAE, 0x27, 0xE0, 0xD7, 0x1A, 0x28, 0x5A, 0x6A, 0x8C, 0x78, 0x7C, 0xB3, 0x54,
+    0xEA, 0x22, 0xD8, 0x48, 0x9B, 0xBA, 0xC5, 0x75, 0x65, 0x40, 0x2A, 0xD9, 0x17, 0x52, 0x0A, 0x1D,
+    0x7E, 0xF8, 0xFE, 0x50, 0x47, 0x6D, 0x16, 0x4B, 0x26, 0xFE, 0x93, 0x53, 0x67, 0x76, 0x64, 0xD9,
+    0x35, 0xDA, 0x51, 0x13, 0x3B, 0x7A, 0x0F, 0xB9, 0x0C, 0xD0, 0x39, 0x03, 0x74, 0xC1, 0x90, 0xFF,
+    0x0F, 0xAD, 0x9B, 0x5D, 0x8C, 0x1D, 0xC7, 0x95, 0xDF, 0x7F, 0xD5, 0xC5, 0x61, 0xDB, 0x6C, 0x72,
+    0x8A, 0x0F, 0xA4, 0x23, 0x4B, 0x33, 0xD3, 0x4C, 0x4C, 0x04, 0xB4, 0x76, 0x66, 0x9A, 0x49, 0xF8,
+    0x30, 0xD9, 0xF4, 0x9D, 0x6E, 0x8A, 0x08, 0x88, 0x44, 0xBB, 0xAB, 0x01, 0x96, 0xB4, 0xB3, 0x72,
+    0x00, 0x19, 0xD9, 0x05, 0xE2, 0x75, 0x16, 0xE6, 0x3C, 0x10, 0xD8, 0xD9, 0xE4, 0xCE, 0xDC, 0x96,
+    0xF8, 0xB0, 0x40, 0x9C, 0x44, 0xDC, 0xCD, 0x2E, 0x8C, 0x7C, 0x20, 0x26, 0xB2, 0x72, 0x20, 0x53,
+    0x49, 0x34, 0x89, 0x27, 0xD8, 0xC1, 0xE6, 0x72, 0x6E, 0x91, 0xB3, 0x1B, 0x06, 0xD1, 0x03, 0x9B,
+    0x22, 0x0C, 0x05, 0x50, 0xB2, 0x2A, 0x53, 0xD2, 0x0A, 0x91, 0x16, 0x56, 0x51, 0x6A, 0x59, 0x4D,
+    0xAA, 0xEF, 0x3D, 0x79, 0xE8, 0xCB, 0x4F, 0xD9, 0x8A, 0x0C, 0xA7, 0x6F, 0x9D, 0xAA, 0xEA, 0x9E,
+    0xCB, 0xAE, 0xBA, 0x55, 0xA7, 0x4E, 0xFD, 0xCF, 0xF9, 0x17, 0x01, 0xED, 0x54, 0xCD, 0x1A, 0x71,
+    0x11, 0x3A, 0x55, 0xB1, 0x4A, 0x9C, 0x87, 0x65, 0x50, 0xD1, 0x27, 0x21, 0xB2, 0x81, 0xA7, 0x4F,
+    0x82, 0xB1, 0xDA, 0xEB, 0x3A, 0x1B, 0x1A, 0xD1, 0xC2, 0x77, 0xD0, 0x22, 0x39, 0xDC, 0x7A, 0xA1,
+    0x84, 0x05, 0x4E, 0xC3, 0x24, 0xD3, 0xA0, 0x8B, 0x30, 0x87, 0x52, 0xBD, 0x99, 0x73, 0x84, 0x9E,
+    0xE4, 0x7B, 0x98, 0x56, 0x3E, 0xCC, 0xC3, 0xDC, 0xA8, 0x52, 0x95, 0xDA, 0x2E, 0xB3, 0x89, 0x9F,
+    0x65, 0x9E, 0xAE, 0x21, 0x7A, 0x67, 0x64, 0x6C, 0x20, 0x12, 0x96, 0x0C, 0x46, 0x00, 0xB0, 0x97,
+    0x1D, 0xB0, 0xC1, 0xF4, 0x8F, 0xC9, 0x66, 0x60, 0x83, 0x99, 0x13, 0x0C, 0x44, 0xA4, 0xDC, 0x3A,
+    0xBF, 0x45, 0xB5, 0xC1, 0x0C, 0xE9, 0x06, 0x33, 0xCC, 0xDE, 0xC9, 0xBA, 0x1B, 0xC4, 0x2F, 0x34,
+    0x1B, 0xC4, 0xE2, 0x37, 0x88, 0xA5, 0xC8, 0x44, 0x86, 0x5A, 0x44, 0xCA, 0x47, 0xBF, 0xFC, 0xE6,
+    0x09, 0x58, 0x04, 0x74, 0x09, 0x74, 0x6E, 0x57, 0x16, 0x07, 0x16, 0x2D, 0x02, 0xBD, 0xA2, 0x26,
+    0xF4, 0xDA, 0xB2, 0x46, 0x4A, 0xE8, 0xEE, 0xAD, 0x0C, 0x48, 0x89, 0x7C, 0x68, 0x19, 0xB0, 0x4A,
+    0x60, 0x61, 0x0F, 0xB0, 0x0E, 0xDA, 0x72, 0xCF, 0x15, 0x78, 0x63, 0x23, 0x7B, 0x81, 0x24, 0x74,
+    0xD4, 0x19, 0xFA, 0x7A, 0x85, 0x79, 0xD6, 0xB2, 0x78, 0x01, 0xC4, 0xA1, 0x05, 0xE2, 0x1A, 0x7A,
+    0x1E, 0x25, 0x9E, 0xE8, 0x35, 0x4F, 0x12, 0x7B, 0x9A, 0xC4, 0x6B, 0x9F, 0x79, 0x63, 0x33, 0x9F,
+    0xD1, 0xF3, 0x00, 0x54, 0xC0, 0x3C, 0xB0, 0xAB, 0xB8, 0xF3, 0xEE, 0x2F, 0x02, 0x8B, 0x68, 0xBF,
+    0x48, 0xE8, 0x33, 0x4C, 0x95, 0x11, 0x57, 0x19, 0x59, 0x95, 0xB0, 0x56, 0x27, 0x34, 0x75, 0xA2,
+    0xEA, 0x3A, 0x39, 0xE6, 0x9B, 0xE4, 0xB8, 0x6B, 0xE2, 0x27, 0x2E, 0x36, 0xF1, 0xB3, 0x4F, 0x37,
+    0xF1, 0x8B, 0xAA, 0x89, 0x47, 0xAA, 0x31, 0x8D, 0x1A, 0x9A, 0x5A, 0x0D, 0x8D, 0x57, 0x43, 0x20,
+    0xE2, 0x48, 0x98, 0x2F, 0x07, 0xE2, 0x18, 0xE4, 0x77, 0xDE, 0xBF, 0xC2, 0x5C, 0x87, 0x34, 0xA6,
+    0x6B, 0xF2, 0xCD, 0xD0, 0x56, 0xDA, 0x79, 0xF5, 0x81, 0x47, 0x1C, 0x3D, 0x47, 0x56, 0x12, 0x5B,
+    0x8C, 0x25, 0x29, 0xE8, 0xF1, 0x73, 0x23, 0xB2, 0x8A, 0xAC, 0xE0, 0x20, 0xBB, 0x62, 0xF4, 0x65,
+    0xCB, 0x0D, 0x4F, 0xDA, 0xC5, 0x7C, 0xC2, 0x8D, 0xC8, 0x65, 0x11, 0xCF, 0x3A, 0xCC, 0x42, 0x04,
+    0xCA, 0xB2, 0x33, 0x27, 0x70, 0xD0, 0x87, 0xFD, 0xF7, 0x0C, 0xE1, 0x3E, 0x02, 0xC9, 0xCD, 0xD1,
+    0x72, 0x96, 0xE5, 0x95, 0x89, 0xCD, 0x81, 0x34, 0x7F, 0xF4, 0x9D, 0xDC, 0xC3, 0x26, 0xAC, 0x41,
+    0x22, 0x95, 0x91, 0x4A, 0x0D, 0x4A, 0x36, 0x20, 0xB0, 0x10, 0x9D, 0xC0, 0x88, 0x67, 0xBF, 0x6F,
+    0x67, 0xC2, 0x64, 0x25, 0x99, 0x38, 0x46, 0x8F, 0x5B, 0xED, 0xA2, 0x3C, 0x66, 0x9A, 0x2E, 0x2B,
+    0xCA, 0x2B, 0x17, 0xD9, 0xB0, 0x48, 0x98, 0xA1, 0x4F, 0x3F, 0xF0, 0x41, 0x65, 0x6C, 0xEC, 0x08,
+    0x04, 0xA2, 0x0A, 0x3E, 0x0F, 0xA0, 0x73, 0xD6, 0x31, 0xA8, 0x12, 0x78, 0xF4, 0xFC, 0x3F, 0x97,
+    0x51, 0x8A, 0xB6, 0xA4, 0x68, 0xCB, 0x2A, 0x61, 0xD9, 0x66, 0x6B, 0x84, 0x0E, 0xB5, 0xC5, 0x5C,
+    0x94, 0x97, 0x51, 0xC4, 0x8E, 0xCE, 0x09, 0xA4, 0xD2, 0x05, 0x26, 0xDF, 0x97, 0xBC, 0x5B, 0x65,
+    0x62, 0x93, 0x1A, 0x08, 0xE4, 0xE9, 0x5B, 0xCF, 0xA5, 0x68, 0x4B, 0x92, 0x23, 0x67, 0xD5, 0xC0,
+    0xB2, 0xB6, 0x43, 0xBF, 0x27, 0xA3, 0x81, 0xBC, 0x2C, 0x6F, 0x74, 0xFB, 0xC3, 0x13, 0xB0, 0x77,
+    0x61, 0x61, 0x61, 0x61, 0x61, 0x65, 0xA5, 0xDB, 0xED, 0xF7, 0x27, 0x54, 0xDE, 0x37, 0xCF, 0xF8,
+    0xCC, 0x5C, 0x6D, 0xDA, 0x31, 0x50, 0x30, 0x09, 0x0B, 0xE0, 0xD0, 0x05, 0x93, 0xB0, 0x82, 0x72,
+    0x84, 0x96, 0x18, 0xFA, 0x04, 0x1E, 0x3A, 0x2C, 0xB2, 0x36, 0x1E, 0xB7, 0x43, 0xA4, 0x1F, 0xFB,
+    0x2C, 0xB0, 0xC0, 0x02, 0x9B, 0xAA, 0xCA, 0xFC, 0xA0, 0x80, 0x48, 0x2C, 0x87, 0x42, 0x38, 0x37,
+    0x45, 0x90, 0x2F, 0xF3, 0x59, 0x25, 0xC5, 0xC1, 0x50, 0x17, 0xE5, 0x94, 0xD6, 0xF9, 0xF2, 0xEE,
+    0xDD, 0xCA, 0xAE, 0x2F, 0x87, 0x72, 0xA6, 0x88, 0xEB, 0x76, 0xFD, 0x11, 0x72, 0x98, 0x65, 0x9D,
+    0x87, 0x1C, 0x61, 0x59, 0xE7, 0xA1, 0x48, 0xB5, 0xAC, 0x8F, 0x5E, 0xE6, 0xC8, 0xAE, 0x65, 0x9D,
+    0xBF, 0x45, 0x36, 0x5C, 0xD6, 0x92, 0xB3, 0x01, 0x11, 0xF0, 0x5F, 0x72, 0x2D, 0x0D, 0xFB, 0x3D,
+    0x18, 0xE0, 0xFD, 0x21, 0x46, 0x6A, 0x46, 0x8F, 0x5B, 0x53, 0xCC, 0x29, 0xAF, 0xCA, 0x98, 0x19,
+    0xE5, 0x95, 0x4B, 0x98, 0x09, 0xBC, 0x72, 0x09, 0x49, 0xE0, 0x03, 0x9F, 0x91, 0x01, 0x38, 0x42,
+    0x48, 0x51, 0xAE, 0xFD, 0xD9, 0x51, 0x50, 0xA6, 0x31, 0xDE, 0xEB, 0x2B, 0xB9, 0xD9, 0xA4, 0x67,
+    0xD5, 0x88, 0x68, 0xC8, 0xFC, 0x90, 0xCD, 0x91, 0x2E, 0x47, 0xE6, 0xA8, 0xA0, 0x0B, 0x94, 0x87,
+    0x55, 0x50, 0x63, 0x75, 0x39, 0x4D, 0xFF, 0xB4, 0x6A, 0x4E, 0xEB, 0x3F, 0x3F, 0x6D, 0x7E, 0x63,
+    0x65, 0x66, 0x76, 0x25, 0x9D, 0x5D, 0xA9, 0xD2, 0xDF, 0x72, 0x69, 0xCF, 0xA6, 0xBD, 0x3C, 0x5D,
+    0xA3, 0x63, 0x9E, 0x5B, 0xDE, 0xC3, 0x72, 0x44, 0xA9, 0x25, 0x67, 0xF3, 0xDE, 0xC5, 0xCA, 0x06,
+    0x69, 0x4A, 0x3A, 0xCF, 0x8A, 0xA1, 0x8A, 0x8A, 0x2A, 0xBC, 0xEA, 0xF5, 0x7B, 0x5E, 0x7D, 0xE8,
+    0x90, 0x92, 0x9E, 0x25, 0xB3, 0x24, 0x05, 0x49, 0x4E, 0x86, 0x1A, 0x91, 0x35, 0x64, 0x8E, 0x47,
+    0xE1, 0x5C, 0xD0, 0xE5, 0x5D, 0xFE, 0x86, 0x9D, 0xF4, 0xBA, 0x7F, 0xBB, 0x72, 0xE1, 0xE4, 0xBB,
+    0x52, 0x6B, 0xB0, 0x1C, 0x06, 0x88, 0x72, 0x44, 0xAC, 0x88, 0x8D, 0x72, 0xC6, 0xA9, 0x24, 0x92,
+    0x2A, 0x2A, 0xE7, 0x22, 0x3B, 0x19, 0xD9, 0x28, 0x7C, 0xF3, 0x54, 0x28, 0x23, 0x2D, 0x43, 0xA4,
+    0x06, 0x82, 0x02, 0x3C, 0xA4, 0xF0, 0xD4, 0x49, 0x7A, 0x52, 0xE2, 0xA1, 0x03, 0x46, 0xCE, 0xEA,
+    0x0F, 0xBE, 0x41, 0xAD, 0x6C, 0x87, 0x23, 0xA6, 0x98, 0xD6, 0xB7, 0x06, 0xF9, 0x40, 0xAC, 0x11,
+    0xCF, 0xC9, 0x3C, 0x11, 0x91, 0x48, 0x44, 0xEC, 0x88, 0xD8, 0x19, 0x6B, 0x4A, 0x1A, 0x53, 0x62,
+    0xBE, 0x59, 0x82, 0x94, 0x28, 0x19, 0x11, 0x5C, 0xBF, 0xEE, 0x94, 0xDB, 0x9C, 0xC3, 0xCF, 0x6B,
+    0x9B, 0x46, 0x85, 0x9F, 0x51, 0x6E, 0xCE, 0xE4, 0x9B, 0xE1, 0xB6, 0x4D, 0xA8, 0xF6, 0x9F, 0x3C,
+    0x99, 0xC8, 0xC8, 0xE4, 0x7D, 0x7D, 0xD1, 0xF3, 0x61, 0xA1, 0x06, 0x45, 0xF8, 0x77, 0x97, 0x27,
+    0xA7, 0x16, 0xA6, 0xA6, 0xA6, 0x66, 0xA7, 0xF6, 0x2C, 0x4C, 0x19, 0xB5, 0xC4, 0x92, 0x69, 0xF0,
+    0x49, 0x8C, 0xEF, 0xE8, 0xAB, 0xBE, 0x93, 0x48, 0xF9, 0x45, 0x91, 0x22, 0x1C, 0xBD, 0x58, 0x1A,
+    0xAB, 0x7D, 0x9C, 0x53, 0x27, 0xD0, 0x64, 0xD0, 0xCF, 0xA0, 0x9F, 0xB4, 0xD2, 0xC4, 0x65, 0x58,
+    0x1B, 0x11, 0x1F, 0x8A, 0x94, 0x4A, 0x24, 0x27, 0xA9, 0x01, 0x74, 0x1D, 0x06, 0x97, 0x5E, 0xB6,
+    0x37, 0x06, 0xEE, 0x2F, 0x48, 0xA5, 0x5D, 0xAC, 0x5C, 0xE0, 0x36, 0x48, 0xE7, 0x30, 0x26, 0xD7,
+    0x97, 0x9C, 0xF2, 0xAB, 0xAA, 0x36, 0xD2, 0x20, 0x43, 0xA2, 0xFA, 0x9E, 0x49, 0xDA, 0x02, 0xE8,
+    0x95, 0x40, 0xDC, 0x00, 0x5A, 0x1E, 0x3B, 0x0B, 0x5B, 0x24, 0x60, 0xAC, 0xAA, 0x50, 0x15, 0xC6,
+    0x92, 0x41, 0x1F, 0xED, 0x09, 0x1D, 0x17, 0x20, 0xC3, 0x58, 0x74, 0xA5, 0x1A, 0x88, 0x8B, 0x2C,
+    0x87, 0x46, 0x7B, 0x30, 0xE5, 0x00, 0xD8, 0x32, 0x25, 0xE8, 0x1B, 0x0D, 0x90, 0x89, 0x85, 0x40,
+    0x2A, 0x20, 0x16, 0x00, 0xF1, 0x40, 0x34, 0xBA, 0xD3, 0xF4, 0xA1, 0x7D, 0x98, 0x33, 0x56, 0xF9,
+    0x39, 0xE6, 0x94, 0xD3, 0xD6, 0xD0, 0x65, 0x23, 0xCA, 0x43, 0xEB, 0x49, 0x13, 0xF4, 0xEB, 0x8E,
+    0xB8, 0x0F, 0x62, 0x31, 0x35, 0x0C, 0x80, 0x69, 0xA6, 0x7B, 0x43, 0xA6, 0x99, 0x66, 0x1A, 0x52,
+    0x78, 0x5F, 0xE4, 0xCA, 0xF9, 0xF3, 0x29, 0x78, 0x74, 0x89, 0xC9, 0xE9, 0x40, 0x85, 0x2E, 0x31,
+    0x05, 0x6B, 0xA8, 0x9A, 0xD0, 0x11, 0x17, 0xF4, 0x00, 0x3C, 0xE6, 0xD1, 0xF3, 0xEF, 0x8B, 0xFC,
+    0x44, 0xAB, 0x63, 0x44, 0xCC, 0xF9, 0xF3, 0x06, 0x0C, 0x98, 0x9C, 0x9E, 0x8C, 0x7A, 0x32, 0x8A,
+    0x0B, 0x4C, 0x8E, 0x29, 0x88, 0xEF, 0x4D, 0x16, 0x88, 0xE4, 0x92, 0x65, 0x9D, 0x81, 0x98, 0xDF,
+    0x3F, 0x66, 0xF1, 0xA4, 0x18, 0x74, 0x49, 0x26, 0x62, 0x44, 0xB6, 0xED, 0x6D, 0x7D, 0x33, 0xAD,
+    0xDD, 0xAC, 0x4E, 0x90, 0x89, 0x33, 0xE5, 0x9A, 0x2E, 0xF5, 0x45, 0xCF, 0x46, 0x97, 0xE9, 0x98,
+    0xF0, 0xB8, 0xD5, 0x57, 0xBD, 0xF1, 0x5D, 0xED, 0xF8, 0xFA, 0x19, 0xF9, 0x45, 0x16, 0x70, 0x5A,
+    0x9E, 0xD0, 0x2B, 0x51, 0x19, 0x3F, 0xFD, 0x43, 0x83, 0xF6, 0xC6, 0xAE, 0x11, 0xBA, 0x45, 0xED,
+    0x31, 0xB6, 0x8E, 0x0B, 0xCC, 0xB6, 0x6B, 0x20, 0x79, 0xE2, 0xA5, 0x12, 0xB2, 0x6C, 0x0D, 0xE8,
+    0x89, 0x07, 0x44, 0x0A, 0x40, 0x1A, 0x20, 0x90, 0x12, 0x88, 0xC5, 0x82, 0x12, 0xB1, 0x10, 0x8B,
+    0x58, 0x94, 0x88, 0x58, 0xCC, 0x47, 0x23, 0xB1, 0xC8, 0x95, 0x5A, 0xAC, 0x69, 0xB2, 0x1B, 0x62,
+    0xA5, 0x94, 0x4B, 0x52, 0x00, 0xCC, 0x42, 0xBB, 0xDF, 0x82, 0x2A, 0x00, 0xC2, 0x33, 0x17, 0x9D,
+    0x7E, 0x79, 0xDB, 0xF2, 0xFE, 0x4B, 0x05, 0x7F, 0xF8, 0x1A, 0x64, 0xC3, 0x76, 0x73, 0x35, 0x55,
+    0x5B, 0x17, 0xC9, 0xF5, 0x47, 0x62, 0xCD, 0x5B, 0xEF, 0xFB, 0xEC, 0xA5, 0x1B, 0x0D, 0xF0, 0x10,
+    0xF0, 0xD0, 0xC3, 0x37, 0x11, 0x51, 0xF9, 0x22, 0xA4, 0xE0, 0x09, 0xED, 0xD7, 0x1B, 0x25, 0x25,
+    0xA1, 0x43, 0x5B, 0xA2, 0x9C, 0xCE, 0x57, 0x83, 0xF7, 0x44, 0x5E, 0x92, 0x26, 0x92, 0xA2, 0x35,
+    0xBF, 0x49, 0xC9, 0xAF, 0xB1, 0x9B, 0x43, 0xC6, 0x71, 0x9A, 0x59, 0x66, 0xF7, 0x76, 0x07, 0xD5,
+    0xA0, 0x3C, 0xC0, 0xA3, 0x04, 0x79, 0xC8, 0x2A, 0x26, 0xBF, 0x40, 0x65, 0xAC, 0x39, 0xE6, 0x55,
+    0xB5, 0x46, 0x6C, 0xAC, 0x7A, 0xAF, 0x22, 0xE9, 0x11, 0x88, 0x25, 0xA9, 0xD1, 0x02, 0x59, 0x8D,
+    0x16, 0x47, 0x36, 0x28, 0xF4, 0xEB, 0x23, 0x16, 0x4D, 0x1D, 0xBA, 0x5E, 0xB9, 0x16, 0xC8, 0x71,
+    0x67, 0x04, 0x58, 0x86, 0xB0, 0xB5, 0xBB, 0xAA, 0xF4, 0xD3, 0x73, 0xEA, 0x15, 0x3B, 0xEB, 0x83,
+    0x1F, 0x92, 0x58, 0x5D, 0x93, 0x39, 0xFD, 0x5A, 0x91, 0x6E, 0xE9, 0xED, 0x2A, 0x35, 0x0E, 0x0D,
+    0x07, 0x00, 0x26, 0x09, 0xCB, 0x19, 0x4C, 0x31, 0x43, 0xCC, 0x4C, 0xB7, 0xC3, 0x7C, 0xBF, 0xCF,
+    0x5C, 0xBF, 0xA2, 0xB3, 0xE5, 0x58, 0x14, 0x4B, 0x26, 0x96, 0x8E, 0x78, 0x3A, 0x4D, 0x43, 0xA7,
+    0x19, 0xB0, 0xDA, 0x64, 0xB6, 0xFB, 0xBC, 0xF1, 0x5D, 0xC2, 0x66, 0x07, 0x7B, 0x35, 0xA9, 0xFA,
+    0xE3, 0x69, 0x7E, 0xF3, 0x59, 0xE6, 0xDE, 0x21, 0xEA, 0xE5, 0x81, 0x58, 0x3E, 0xEC, 0xD3, 0x79,
+    0xAB, 0x34, 0x9B, 0x17, 0xB4, 0x35, 0x2E, 0xB2, 0x59, 0x20, 0xD7, 0xAB, 0x9D, 0xA3, 0xA7, 0x0A,
+    0xED, 0x1A, 0xCC, 0x37, 0x4B, 0x16, 0x33, 0xB8, 0x55, 0xA1, 0xA5, 0x20, 0x6E, 0xA0, 0xE7, 0x50,
+    0x52, 0x12, 0x89, 0x25, 0xE9, 0x59, 0xFA, 0x3D, 0xAB, 0xFD, 0xC0, 0x1A, 0x2B, 0x36, 0x43, 0x6C,
+    0xA3, 0xC4, 0xF2, 0x55, 0x30, 0x90, 0x49, 0xAE, 0xA5, 0x82, 0x76, 0x7F, 0x50, 0x7E, 0x83, 0x38,
+    0x41, 0xBD, 0x65, 0x89, 0x2B, 0xD4, 0x08, 0x12, 0x4F, 0x20, 0x96, 0xF9, 0x8C, 0xE0, 0x46, 0x43,
+    0x12, 0x55, 0xDA, 0x67, 0x65, 0x4F, 0xBC, 0xB1, 0x3D, 0xF1, 0x49, 0x8E, 0xF6, 0x6B, 0xA0, 0x5D,
+    0x03, 0xFA, 0x7A, 0x05, 0xFA, 0x75, 0x0F, 0xFA, 0x9D, 0x12, 0xB4, 0x14, 0x10, 0x0A, 0x10, 0x8E,
+    0x80, 0x50, 0xF2, 0x76, 0x9F, 0x23, 0x7A, 0xCD, 0x43, 0x74, 0xB9, 0x01, 0x73, 0x49, 0xC0, 0x58,
+    0xB1, 0x18, 0x9B, 0x79, 0x8C, 0x8D, 0x1B, 0x20, 0x1B, 0x9A, 0x89, 0xAF, 0x3C, 0x9E, 0xAB, 0x6B,
+    0x96, 0xEF, 0x59, 0xE6, 0x1D, 0x91, 0x47, 0xD7, 0x20, 0x39, 0x9D, 0x0A, 0x93, 0xE4, 0x7A, 0xBB,
+    0x52, 0xBE, 0x97, 0xEF, 0x83, 0xA5, 0x0E, 0xCA, 0x77, 0x50, 0x7E, 0x11, 0x55, 0xDD, 0x2F, 0x41,
+    0xB5, 0xD6, 0x4A, 0xDD, 0x13, 0xB9, 0x5F, 0x08, 0xEA, 0x1E, 0xBA, 0xE9, 0xA1, 0x9B, 0x01, 0x7A,
+    0x48, 0x0B, 0x16, 0xF7, 0x00, 0x3B, 0x80, 0x94, 0xF5, 0x94, 0xF5, 0x94, 0x8D, 0x3B, 0x69, 0xF1,
+    0x7C, 0x95, 0x49, 0x95, 0x49, 0x95, 0x52, 0xA7, 0xD4, 0x5D, 0x1A, 0xD8, 0x0D, 0x9F, 0x19, 0x43,
+    0x4A, 0x8C, 0x8C, 0x12, 0x10, 0xB9, 0xEE, 0x31, 0x96, 0x04, 0x1A, 0x82, 0x07, 0xAB, 0x19, 0x34,
+    0xE8, 0x7B, 0xAA, 0x22, 0x62, 0xC9, 0x44, 0xEE, 0xAF, 0x56, 0xC4, 0x96, 0x2C, 0x57, 0x6D, 0xB5,
+    0x24, 0x2B, 0xD4, 0x10, 0x16, 0x18, 0x34, 0x3E, 0x78, 0xF3, 0x97, 0x6D, 0x84, 0x61, 0x8E, 0x94,
+    0x0D, 0xBC, 0x2E, 0xF5, 0xDB, 0x2F, 0xE6, 0x46, 0x86, 0x64, 0x52, 0xE1, 0xB5, 0xD3, 0xD6, 0x14,
+    0x31, 0x8B, 0xF4, 0x64, 0x48, 0x9B, 0xAD, 0xD0, 0x81, 0x6E, 0x9B, 0x2D, 0x3E, 0x90, 0xED, 0xCF,
+    0xBB, 0x64, 0xE2, 0xBB, 0x64, 0x45, 0xBF, 0x4B, 0xC6, 0x7C, 0x97, 0x45, 0x4C, 0x97, 0xCE, 0x38,
+    0xEB, 0xD3, 0x21, 0xE9, 0xB3, 0x18, 0x0C, 0xFB, 0x2C, 0x06, 0x15, 0x00, 0x3D, 0x69, 0x60, 0xF5,
+    0x64, 0x17, 0xBA, 0xA4, 0x1F, 0xCB, 0xD2, 0x7B, 0xB2, 0xEE, 0x7E, 0x52, 0x7A, 0xE2, 0x52, 0x7A,
+    0x47, 0x6B, 0x58, 0x6D, 0xBF, 0x34, 0x07, 0x5D, 0xA6, 0xEF, 0x64, 0x29, 0x74, 0x75, 0x03, 0x5D,
+    0x3D, 0xC6, 0x17, 0x13, 0x00, 0x89, 0x05, 0x32, 0x0F, 0x24, 0x05, 0x10, 0xE7, 0xC1, 0x88, 0xC8,
+    0x86, 0xEF, 0x78, 0x5D, 0x6A, 0x3B, 0x83, 0x0F, 0xAC, 0xB6, 0x5D, 0x3C, 0x2E, 0x66, 0x81, 0x95,
+    0xD0, 0xCE, 0x90, 0x2A, 0x1F, 0xDA, 0x8C, 0x2E, 0x55, 0x86, 0xB1, 0xD9, 0xE0, 0xF8, 0x63, 0xC3,
+    0x48, 0xDE, 0xF5, 0x99, 0x88, 0xD4, 0xA1, 0x88, 0x94, 0x3C, 0x72, 0xF3, 0xF6, 0x96, 0x11, 0x03,
+    0x99, 0x85, 0x04, 0x30, 0x64, 0x2E, 0xCA, 0x57, 0xA6, 0x03, 0xBB, 0xA0, 0x0B, 0xBF, 0x07, 0x97,
+    0x86, 0x9C, 0x36, 0xAA, 0xEC, 0xEA, 0x32, 0x5D, 0xE5, 0x82, 0x19, 0xFD, 0x86, 0x11, 0x11, 0x06,
+    0x1F, 0xDD, 0xDD, 0x71, 0x78, 0x64, 0x44, 0x22, 0xDE, 0xDC, 0xFC, 0x15, 0x5D, 0xC3, 0x1A, 0x18,
+    0x8B, 0xAA, 0x20, 0x01, 0xED, 0x21, 0x1B, 0x17, 0x05, 0x7A, 0x04, 0x89, 0x9C, 0xF7, 0x2D, 0x08,
+    0xF0, 0x89, 0x08, 0xA7, 0xC4, 0x11, 0x39, 0xD0, 0x10, 0x95, 0xE3, 0xD7, 0x9D, 0x72, 0xB1, 0x68,
+    0x47, 0x9F, 0x28, 0xA7, 0xC2, 0xE4, 0x6C, 0x12, 0x95, 0x64, 0xFF, 0x52, 0x49, 0xAD, 0xA4, 0xE0,
+    0x30, 0x21, 0xA6, 0xD8, 0x7F, 0xF2, 0xE4, 0x89, 0x81, 0x48, 0x33, 0x10, 0x69, 0xF6, 0x86, 0x16,
+    0x42, 0x0B, 0xD1, 0x8F, 0x11, 0xF3, 0xA0, 0x94, 0x77, 0x25, 0x2E, 0x61, 0x1A, 0x98, 0x86, 0x9E,
+    0xD4, 0x6F, 0xDF, 0x3A, 0xDB, 0x02, 0xD7, 0x05, 0x94, 0x23, 0x2C, 0x98, 0x19, 0x63, 0xD8, 0xC8,
+    0x92, 0xC0, 0x59, 0x14, 0x2C, 0x42, 0x3F, 0xCE, 0xA9, 0x8C, 0x0D, 0x7C, 0x58, 0x86, 0xA5, 0xF6,
+    0xC6, 0xAA, 0x3A, 0x2E, 0x68, 0x32, 0xD8, 0xDA, 0x82, 0xAC, 0x81, 0xA4, 0x06, 0xE3, 0x21, 0x72,
+    0xAD, 0x98, 0xB1, 0xC4, 0x63, 0x49, 0x1C, 0x29, 0x69, 0x87, 0xCD, 0x19, 0x2A, 0x83, 0x37, 0x8F,
+    0xB9, 0x70, 0xDB, 0xEA, 0xCB, 0x36, 0x78, 0x35, 0x57, 0x02, 0x02, 0x17, 0xEE, 0x4B, 0xF7, 0x37,
+    0xAA, 0x9D, 0xF6, 0x91, 0x0D, 0xAA, 0x71, 0xA3, 0x17, 0x7A, 0xD0, 0x1B, 0xB6, 0x0D, 0xC7, 0x35,
+    0x81, 0x48, 0x11, 0x88, 0x14, 0x77, 0x1A, 0x35, 0x77, 0x1B, 0x3D, 0xC4, 0xA1, 0x0E, 0x2B, 0xF3,
+    0x77, 0x1A, 0x3D, 0x53, 0xEA, 0x6D, 0xAB, 0x5F, 0x2D, 0xDA, 0x46, 0x45, 0x86, 0x22, 0xC3, 0xBB,
+    0xED, 0xC2, 0xC3, 0xF0, 0x45, 0xED, 0x88, 0x59, 0xC5, 0xE4, 0x91, 0x35, 0x05, 0x75, 0x64, 0x89,
+    0x8F, 0x97, 0xE8, 0x0F, 0x7D, 0xAB, 0x8F, 0x51, 0x0D, 0xAA, 0x01, 0xC4, 0x82, 0xD4, 0x30, 0xC8,
+    0x72, 0xB2, 0xC7, 0x3D, 0x59, 0x31, 0x22, 0xB1, 0x71, 0x19, 0x97, 0x41, 0x63, 0x7C, 0xAB, 0xBB,
+    0xB3, 0xB4, 0xE0, 0x5B, 0xE5, 0xC0, 0x34, 0x0B, 0x11, 0xEB, 0xFA, 0x62, 0xA9, 0xAE, 0x59, 0x04,
+    0x16, 0x61, 0x0D, 0x24, 0x0F, 0xDE, 0xB2, 0xE1, 0xB6, 0x33, 0x79, 0x95, 0xB1, 0x05, 0x1A, 0x82,
+    0xAF, 0x9F, 0x7F, 0x6E, 0x47, 0x24, 0xF2, 0x98, 0x25, 0x65, 0x16, 0x6D, 0x83, 0x4F, 0x57, 0xC9,
+    0x44, 0x9C, 0x16, 0x19, 0x91, 0x89, 0xB8, 0xB1, 0x67, 0x1A, 0xDC, 0xAE, 0xA8, 0xB3, 0x80, 0x16,
+    0x5F, 0x52, 0xEE, 0x61, 0x0F, 0x3F, 0xA6, 0x30, 0xD2, 0x20, 0x62, 0x61, 0x0A, 0x94, 0x85, 0x87,
+    0x0E, 0x71, 0x28, 0xB4, 0xBA, 0x4C, 0xE9, 0xE8, 0xFB, 0x8A, 0xC0, 0x46, 0xA5, 0x79, 0x61, 0x48,
+    0xEF, 0xA3, 0x12, 0xD2, 0x16, 0x9A, 0xDC, 0x53, 0xFC, 0x29, 0x74, 0xC6, 0x6E, 0x86, 0x87, 0x89,
+    0xF5, 0x5D, 0x11, 0x7E, 0xDD, 0x44, 0xF8, 0x65, 0xA3, 0x1F, 0xF3, 0x89, 0x80, 0x67, 0x12, 0x1C,
+    0x93, 0xF0, 0x1F, 0xC7, 0x25, 0x0B, 0x18, 0x83, 0xDE, 0xB6, 0x78, 0x4F, 0x9A, 0x12, 0x1B, 0xC2,
+    0xED, 0xED, 0x67, 0x7C, 0xE5, 0x9A, 0x64, 0x4B, 0xB4, 0x7C, 0x64, 0x93, 0x1F, 0x78, 0x5C, 0x97,
+    0x85, 0x98, 0xC9, 0xC8, 0x12, 0x54, 0x4B, 0x13, 0x87, 0x82, 0xFF, 0xC1, 0x7F, 0x2E, 0x66, 0xAF,
+    0x9B, 0xD9, 0xCB, 0x97, 0xC5, 0xF7, 0xBA, 0xDA, 0xB0, 0x6D, 0x0F, 0xFB, 0x83, 0xB0, 0x02, 0xDD,
+    0x07, 0xD2, 0xC9, 0xBC, 0x27, 0xAE, 0x97, 0x6F, 0x74, 0x59, 0xE8, 0xB2, 0xD0, 0x25, 0xBD, 0x93,
+    0xFA, 0x74, 0xE7, 0x60, 0x9D, 0xC0, 0x62, 0xC6, 0x70, 0x43, 0x5F, 0xA9, 0x8C, 0xD4, 0xD9, 0xEF,
+    0xFA, 0x3A, 0x78, 0xC5, 0x86, 0x4F, 0x31, 0xD3, 0xE5, 0x1F, 0x7A, 0xF5, 0x8E, 0x0D, 0x5F, 0x24,
+    0xE9, 0x33, 0xF0, 0xDA, 0xC3, 0xC3, 0x39, 0xC4, 0x52, 0x10, 0xB9, 0x79, 0x94, 0x67, 0xA3, 0xEA,
+    0xA0, 0xAF, 0x9C, 0xB1, 0xAC, 0x0E, 0x44, 0xE4, 0xBA, 0x88, 0x8C, 0x18, 0x9E, 0x00, 0x53, 0x00,
+    0x0D, 0xED, 0xB2, 0x20, 0x7B, 0x43, 0x15, 0x4A, 0xA4, 0x21, 0x12, 0xB1, 0x18, 0xA9, 0x61, 0x62,
+    0x09, 0x80, 0x70, 0x48, 0xF4, 0xF4, 0xCB, 0xC7, 0xF2, 0xA9, 0x1F, 0x7D, 0xFF, 0x2B, 0x4F, 0x89,
+    0xB8, 0xCE, 0x09, 0x0C, 0x68, 0x07, 0xBD, 0xF3, 0x65, 0x24, 0x15, 0x49, 0x05, 0x0F, 0x9F, 0x85,
+    0x50, 0x3C, 0xAC, 0x1D, 0xF5, 0xE8, 0x12, 0xDF, 0x9D, 0x27, 0xB8, 0x2A, 0x22, 0xF2, 0x8C, 0x88,
+    0x08, 0xC9, 0xF9, 0x13, 0xD0, 0x07, 0x94, 0x07, 0x42, 0x4F, 0x8B, 0xB3, 0x88, 0x47, 0x2F, 0x94,
+    0x64, 0x22, 0x39, 0x89, 0x0C, 0xE1, 0x11, 0x29, 0x5A, 0xB5, 0x6C, 0xF1, 0xDA, 0x57, 0xC7, 0x56,
+    0x68, 0x60, 0x99, 0x0B, 0x83, 0x30, 0x9F, 0xFD, 0xEB, 0x1F, 0x7C, 0xE9, 0x92, 0xC8, 0x50, 0xBD,
+    0xB9, 0xC4, 0x4C, 0x1B, 0xE4, 0x88, 0x6E, 0xFD, 0x7B, 0x32, 0xB1, 0x0C, 0xDE, 0x00, 0x0B, 0xBB,
+    0x79, 0xD4, 0x6C, 0xFB, 0x26, 0x89, 0x2E, 0xF9, 0x7E, 0x9B, 0x99, 0x6B, 0xD5, 0x30, 0x7B, 0x76,
+    0x6C, 0xC0, 0xD1, 0xF9, 0x6E, 0x20, 0x62, 0x1D, 0x30, 0x92, 0xD3, 0xFA, 0xEF, 0x1F, 0xBB, 0x82,
+    0x2A, 0xB2, 0x19, 0xDA, 0x27, 0xAA, 0x26, 0x74, 0x5D, 0x63, 0x89, 0x2E, 0xFA, 0x0B, 0x60, 0x5E,
+    0xDA, 0xF6, 0x90, 0x9C, 0xEA, 0x01, 0x99, 0xD4, 0x40, 0x4F, 0x2C, 0x20, 0x43, 0x40, 0x89, 0x07,
+    0x8C, 0x38, 0x40, 0xA4, 0x04, 0x23, 0x52, 0xC2, 0x40, 0xA4, 0x24, 0x1A, 0x49, 0xAF, 0x64, 0xF0,
+    0x6A, 0x33, 0x28, 0xA3, 0x51, 0xE2, 0xA5, 0x1C, 0xF8, 0x41, 0x29, 0xE3, 0xD0, 0xCF, 0x72, 0x50,
+    0x80, 0x9B, 0x86, 0x40, 0x3C, 0xA8, 0xD1, 0x83, 0xBD, 0x99, 0xC8, 0x97, 0x26, 0x88, 0x03, 0xD7,
+    0x25, 0x89, 0xCE, 0x38, 0x3A, 0xF3, 0x09, 0x74, 0xEB, 0x0A, 0x3E, 0x7A, 0xB7, 0x68, 0x51, 0x71,
+    0x20, 0xE5, 0x18, 0xCA, 0x64, 0x42, 0x1B, 0x8A, 0xCA, 0x44, 0xD0, 0xA3, 0xA1, 0x90, 0xBD, 0x54,
+    0x89, 0x1E, 0x26, 0x3F, 0x10, 0x76, 0xB0, 0x34, 0x19, 0xF8, 0x99, 0xB0, 0x9C, 0x31, 0xC5, 0x4C,
+    0xCC, 0x7C, 0x87, 0xB9, 0x3E, 0x8B, 0x15, 0x99, 0x23, 0x1B, 0xE5, 0x9D, 0x47, 0x5C, 0x87, 0xBA,
+    0x43, 0x67, 0x95, 0xF9, 0x2E, 0x49, 0x97, 0xA4, 0x35, 0xB1, 0x98, 0x1A, 0xE3, 0xD8, 0xC5, 0x8E,
+    0x1D, 0xA1, 0x09, 0x2E, 0xE7, 0xDF, 0x2B, 0x1E, 0xB5, 0xC6, 0xE9, 0x9B, 0xFC, 0xA0, 0x5A, 0x88,
+    0x26, 0xD5, 0x2B, 0xC5, 0x69, 0x66, 0xF9, 0x06, 0xF3, 0x40, 0x28, 0x43, 0x7A, 0x52, 0x86, 0xB6,
+    0x43, 0x57, 0xDF, 0x2E, 0x22, 0xDB, 0xA1, 0xAF, 0xCB, 0xA8, 0xE8, 0x50, 0xEB, 0xD2, 0x14, 0x1D,
+    0x2A, 0x5D, 0x9A, 0x7C, 0xED, 0x2B, 0x3E, 0x1C, 0x8D, 0xE8, 0x95, 0xD0, 0x40, 0x5C, 0x10, 0x54,
+    0x13, 0x27, 0x11, 0x6F, 0x42, 0xFC, 0xB2, 0x09, 0x71, 0xCB, 0x93, 0x11, 0x6E, 0x7D, 0x4F, 0x14,
+    0x94, 0x5B, 0xDD, 0xC8, 0xB5, 0x2E, 0x0D, 0x13, 0xB0, 0x14, 0x59, 0x16, 0x03, 0x8F, 0x29, 0xFA,
+    0x68, 0x97, 0x40, 0x13, 0x59, 0xB2, 0xC0, 0x63, 0x6C, 0x83, 0xF6, 0x19, 0x34, 0xC6, 0x92, 0x69,
+    0x11, 0xB1, 0x22, 0xE2, 0x33, 0x91, 0xC6, 0x88, 0x88, 0xAE, 0x88, 0xED, 0x90, 0xB0, 0xCA, 0x72,
+    0x25, 0x4F, 0x38, 0x7A, 0x25, 0x44, 0x1E, 0x74, 0x03, 0x89, 0xDC, 0x56, 0x07, 0x80, 0x85, 0x31,
+    0xC0, 0x5A, 0xFF, 0x09, 0x00, 0xAB, 0xE9, 0x32, 0x84, 0x2E, 0x61, 0xD3, 0x6A, 0xCF, 0xFF, 0x87,
+    0x4E, 0xF9, 0x2C, 0x57, 0x43, 0xE3, 0xE8, 0xE5, 0xED, 0xEA, 0x50, 0xCD, 0xD8, 0x73, 0x4D, 0xF2,
+    0x76, 0xAB, 0x0C, 0xDD, 0x27, 0x22, 0xBF, 0xFA, 0x36, 0xF2, 0xAB, 0x69, 0xA1, 0x0C, 0x2B, 0x50,
+    0x1D, 0xE2, 0x8B, 0x1D, 0x16, 0x53, 0x16, 0x53, 0xE6, 0x53, 0xE6, 0x67, 0x99, 0x9B, 0xA5, 0x33,
+    0xCD, 0xAA, 0x79, 0x61, 0xA8, 0xE5, 0x02, 0x74, 0xEE, 0x49, 0x73, 0x30, 0x07, 0x1D, 0x58, 0x80,
+    0x85, 0x03, 0x13, 0xCB, 0xBB, 0x96, 0x27, 0x97, 0x27, 0x97, 0x27, 0x0F, 0xCF, 0x64, 0x5B, 0xE6,
+    0x4F, 0x99, 0x24, 0x21, 0xE3, 0x08, 0x47, 0x60, 0xD7, 0x59, 0x76, 0x9D, 0xD5, 0x0D, 0xBA, 0x46,
+    0xF2, 0x60, 0x44, 0xCF, 0x21, 0x45, 0xDC, 0xD0, 0xF3, 0xA1, 0x14, 0x59, 0xA3, 0x3E, 0xF2, 0x46,
+    0xE8, 0x0E, 0xA3, 0xD7, 0x6C, 0x92, 0x6C, 0xBF, 0xEF, 0xA3, 0xCB, 0x37, 0xEA, 0x26, 0xF0, 0xA3,
+    0x61, 0xC6, 0x85, 0x58, 0x4C, 0x99, 0x1C, 0x93, 0x33, 0x95, 0x29, 0x07, 0x17, 0x87, 0xBA, 0x8A,
+    0x7D, 0xAF, 0x18, 0xE9, 0x2A, 0x76, 0x59, 0xF1, 0xB5, 0xA8, 0x36, 0x6D, 0x40, 0x6D, 0x6C, 0x1E,
+    0x54, 0x03, 0xB0, 0xC6, 0x78, 0x0C, 0x30, 0x96, 0xF1, 0x28, 0x04, 0x5E, 0xF9, 0x24, 0xCF, 0x74,
+    0x13, 0xFA, 0xCC, 0x0E, 0xF4, 0x0F, 0xCD, 0x46, 0xE7, 0xC6, 0x3B, 0xC7, 0xAE, 0xAC, 0x6E, 0xA4,
+    0x83, 0x2B, 0x67, 0xB6, 0xEB, 0x3A, 0x4D, 0xCC, 0x99, 0x8B, 0xBE, 0xE9, 0x62, 0x5A, 0x1C, 0x15,
+    0xB8, 0xF1, 0x26, 0x70, 0xB0, 0xDB, 0xED, 0xA6, 0x77, 0x2F, 0x00, 0xF6, 0xB0, 0x8C, 0xB6, 0x0B,
+    0xD0, 0x6B, 0x20, 0xA8, 0x1F, 0x58, 0x79, 0xCA, 0x03, 0xA3, 0x31, 0x24, 0x9B, 0xAF, 0xC0, 0x7C,
+    0x03, 0xC2, 0xCB, 0x96, 0xC0, 0x55, 0x50, 0x25, 0xD0, 0x0D, 0x2D, 0x8B, 0xD4, 0x98, 0x3C, 0x21,
+    0xB2, 0x61, 0xA9, 0x6F, 0x9D, 0xAF, 0x95, 0x88, 0x30, 0x10, 0x29, 0x33, 0x68, 0xE2, 0x82, 0xCC,
+    0xD8, 0xD6, 0xC8, 0x6A, 0x66, 0x75, 0xB1, 0xA0, 0xC4, 0xD3, 0xBB, 0x1B, 0x96, 0x65, 0x70, 0x42,
+    0x4B, 0x13, 0x15, 0xCD, 0x24, 0xDD, 0x29, 0xD2, 0x59, 0xD2, 0x94, 0x4E, 0xCA, 0x6A, 0xF2, 0xD8,
+    0xC8, 0xC8, 0x28, 0x92, 0x1F, 0xAA, 0xAD, 0x27, 0xE8, 0x46, 0x05, 0x89, 0xF6, 0x98, 0xB2, 0x41,
+    0x2D, 0xDD, 0x1B, 0xEE, 0x8C, 0x69, 0x71, 0x85, 0x6E, 0x20, 0x78, 0x37, 0x87, 0x1F, 0x39, 0xE8,
+    0x76, 0x61, 0xDE, 0xE4, 0x98, 0xC7, 0x3C, 0xA1, 0xED, 0xA2, 0x9D, 0x29, 0xA8, 0x02, 0x4F, 0x9F,
+    0x55, 0xB2, 0xF3, 0x2F, 0x16, 0xB1, 0x88, 0x8F, 0x44, 0x86, 0xDA, 0x63, 0x2E, 0xD6, 0x68, 0xDF,
+    0xC0, 0x96, 0xB6, 0xDD, 0xB0, 0xEC, 0x47, 0xAE, 0x99, 0x58, 0x3A, 0xF1, 0x53, 0xF4, 0x0D, 0xD8,
+    0x7F, 0x02, 0x8C, 0x48, 0x0D, 0x89, 0x48, 0x05, 0x59, 0x0D, 0xF0, 0x5F, 0x6B, 0x80, 0xF7, 0x6A,
+    0x40, 0x5F, 0xAD, 0x81, 0xF0, 0xE2, 0xF0, 0x49, 0x30, 0xB9, 0x48, 0x4E, 0x8C, 0x48, 0x4E, 0x87,
+    0x06, 0xE8, 0xD3, 0x00, 0xA3, 0xF3, 0x43, 0x08, 0x44, 0x46, 0xA0, 0x45, 0xE4, 0xFC, 0x73, 0x91,
+    0x45, 0xA4, 0x36, 0x05, 0x22, 0x4D, 0x96, 0x23, 0xD2, 0xDC, 0x35, 0x89, 0x90, 0x7C, 0x3F, 0xA9,
+    0xC9, 0x64, 0xA4, 0x8B, 0x79, 0x3D, 0xE4, 0xC8, 0x24, 0x6B, 0xEA, 0xA9, 0x10, 0x23, 0x72, 0xC9,
+    0xEA, 0x5B, 0xBF, 0x9F, 0x7B, 0x2A, 0x48, 0xE9, 0x41, 0x54, 0x0E, 0x2A, 0x10, 0x11, 0x71, 0x89,
+    0x0C, 0xA4, 0x56, 0x5B, 0x4F, 0x9C, 0xAA, 0xC7, 0x76, 0xD7, 0xCD, 0x28, 0xF1, 0xF7, 0x58, 0xDC,
+    0x9E, 0x7C, 0x70, 0xEB, 0xFC, 0x6F, 0xDF, 0x85, 0x9B, 0xA1, 0x48, 0x7C, 0xFE, 0xF9, 0x95, 0x31,
+    0x08, 0x8D, 0xA1, 0x27, 0x1F, 0x88, 0xBC, 0x22, 0x92, 0x9B, 0xDF, 0x5B, 0xDF, 0xCD, 0xB9, 0x49,
+    0x65, 0x43, 0x81, 0xFA, 0xA7, 0x8E, 0x3F, 0x3F, 0x72, 0x8B, 0x4C, 0xCA, 0x4C, 0x3C, 0x41, 0x0D,
+    0x5D, 0x48, 0x27, 0x9E, 0xEC, 0x0F, 0xA4, 0xF9, 0xAD, 0x7C, 0x61, 0x01, 0xBF, 0x27, 0x2C, 0x43,
+    0xC9, 0xD9, 0x8B, 0xFA, 0x2E, 0xB1, 0xB8, 0x58, 0xEA, 0x58, 0x1A, 0x58, 0x84, 0x19, 0x88, 0x13,
+    0x19, 0x25, 0xB7, 0xFE, 0xC3, 0x14, 0xB3, 0x93, 0xAC, 0xE8, 0x6F, 0x8D, 0x63, 0xF0, 0xFB, 0x54,
+    0xDE, 0x09, 0xED, 0x5A, 0x64, 0xB7, 0x4C, 0xF9, 0x80, 0x16, 0xFF, 0x34, 0x6D, 0x95, 0x9F, 0xD0,
+    0x56, 0xF4, 0x2D, 0x6F, 0xC4, 0x9B, 0x67, 0xAA, 0x78, 0xBB, 0x02, 0x9F, 0x00, 0x61, 0xD9, 0x07,
+    0x92, 0x33, 0x1E, 0x38, 0x39, 0x91, 0xDF, 0xD7, 0x6C, 0x92, 0xF7, 0xB5, 0x27, 0x0B, 0x7C, 0x5C,
+    0xB0, 0x16, 0xDA, 0x06, 0xFA, 0x71, 0x54, 0x42, 0xD3, 0xCF, 0x20, 0xF8, 0xD1, 0x87, 0x1E, 0xB4,
+    0xB4, 0x3E, 0x78, 0x03, 0x98, 0x71, 0x60, 0x07, 0x40, 0x46, 0x80, 0x91, 0x21, 0x20, 0x32, 0x84,
+    0x48, 0x64, 0x08, 0x83, 0x77, 0x3F, 0x1C, 0x12, 0x0D, 0x07, 0x2F, 0x0D, 0x19, 0x5C, 0x17, 0x33,
+    0x8C, 0x24, 0x1A, 0x9A, 0x86, 0x44, 0x97, 0xD0, 0x98, 0xA2, 0xF5, 0xF4, 0x27, 0xF2, 0x13, 0x1F,
+    0x5B, 0xC4, 0xF3, 0xA1, 0x0D, 0xFC, 0xE6, 0x22, 0xFA, 0xE5, 0xEB, 0x9E, 0xF0, 0xCA, 0xB3, 0x39,
+    0x66, 0xAB, 0x06, 0x23, 0x16, 0x92, 0xE1, 0xD8, 0x9D, 0xD3, 0xE2, 0x21, 0x13, 0x8F, 0x16, 0xF1,
+    0x64, 0xEF, 0xBE, 0xE6, 0x75, 0x33, 0x78, 0xC2, 0x67, 0x2F, 0x8F, 0x62, 0xBF, 0x4F, 0xE5, 0x75,
+    0xAC, 0xDD, 0x85, 0x78, 0x7B, 0x3C, 0xD3, 0xA7, 0xCE, 0x1A, 0xF1, 0xFB, 0x02, 0x8F, 0xB6, 0x18,
+    0xE8, 0xEE, 0x7C, 0xB1, 0x8C, 0x87, 0xD0, 0x83, 0x0E, 0xAC, 0x10, 0xFC, 0x19, 0xC9, 0x53, 0xD2,
+    0xF4, 0xA4, 0x3C, 0x55, 0xD3, 0x09, 0x2F, 0x97, 0xFD, 0x35, 0xF3, 0xFD, 0xF1, 0xA2, 0x4A, 0x4A,
+    0x76, 0xE6, 0xEC, 0x26, 0x28, 0x8C, 0x23, 0xCC, 0x99, 0x25, 0xB0, 0x7B, 0xBB, 0x91, 0xE4, 0xBD,
+    0x92, 0x47, 0xCF, 0x17, 0x22, 0x30, 0x47, 0xE0, 0x58, 0x44, 0x3B, 0x92, 0x9C, 0x17, 0x4B, 0x74,
+    0x49, 0x58, 0x90, 0xA8, 0xA2, 0x89, 0xDF, 0x75, 0x3D, 0x21, 0x71, 0xF0, 0x53, 0x7D, 0x57, 0x7D,
+    0xE9, 0x79, 0x42, 0x19, 0xDE, 0x19, 0x92, 0xFD, 0x9F, 0x48, 0x05, 0x0D, 0xEF, 0xA7, 0x82, 0x1E,
+    0xFF, 0xC9, 0x54, 0xD0, 0xC4, 0x93, 0xE7, 0x62, 0xB9, 0x0B, 0xA0, 0xFE, 0x9F, 0xB1, 0x74, 0x95,
+    0xEF, 0x23, 0xB4, 0x7D, 0xA2, 0xB2, 0x21, 0x72, 0xCD, 0x8F, 0xA1, 0xA6, 0xA2, 0x9F, 0x40, 0x4D,
+    0x55, 0x9F, 0x8A, 0x9A, 0x32, 0x81, 0x8F, 0x1F, 0xF3, 0xC9, 0x19, 0xBF, 0xFF, 0xE8, 0xD2, 0xA7,
+    0xEC, 0x12, 0xFB, 0xD4, 0xD8, 0x4E, 0x96, 0x0D, 0x41, 0x9D, 0xDD, 0xD5, 0x61, 0x35, 0x78, 0x03,
+    0x2D, 0x62, 0x75, 0xAD, 0x1B, 0x5D, 0x93, 0x3D, 0x5D, 0xA3, 0xFD, 0x05, 0x58, 0xCD, 0xC0, 0x3C,
+    0x5B, 0xA0, 0xDF, 0x2F, 0xA1, 0x5F, 0x41, 0xB2, 0x08, 0xE6, 0x59, 0x8B, 0xBE, 0x5E, 0xA3, 0xAB,
+    0xDE, 0xFF, 0xF9, 0x07, 0x8D, 0x11, 0x11, 0x25, 0x22, 0xC4, 0x22, 0x39, 0xA7, 0xC6, 0xDE, 0xBD,
+    0x39, 0xEA, 0xCD, 0x63, 0x3E, 0x3E, 0x53, 0xDD, 0xE9, 0x9D, 0xDA, 0xCA, 0xA3, 0x57, 0xDD, 0x0C,
+    0x3E, 0x65, 0x25, 0x25, 0x5D, 0x21, 0xED, 0x92, 0xA6, 0x74, 0xB3, 0x93, 0x75, 0x2C, 0x3E, 0x12,
+    0xA7, 0x46, 0x39, 0x03, 0x47, 0x2C, 0x95, 0x1A, 0x7D, 0xA5, 0x36, 0x36, 0xF0, 0xAB, 0xE8, 0xEB,
+    0x9E, 0xE8, 0xA5, 0xEF, 0x3F, 0x39, 0xC8, 0x44, 0x9A, 0x3E, 0xC1, 0x7B, 0x1E, 0x73, 0xB9, 0x52,
+    0x5B, 0x46, 0xC4, 0xC7, 0x22, 0x45, 0x2C, 0xD5, 0xED, 0x20, 0x74, 0x30, 0x22, 0x96, 0xB2, 0xA3,
+    0xFC, 0x0A, 0x2B, 0x1B, 0xA4, 0x22, 0xCD, 0x26, 0xE9, 0x26, 0xDD, 0x55, 0x55, 0x67, 0xE2, 0x8D,
+    0x94, 0xC1, 0x08, 0x95, 0xEF, 0xC3, 0x1C, 0xF5, 0xAC, 0x45, 0xF6, 0xBE, 0x9F, 0x7F, 0x0F, 0x1A,
+    0x96, 0x82, 0x9E, 0x94, 0xE1, 0xCD, 0x53, 0x2E, 0x23, 0xBA, 0x58, 0x61, 0xBE, 0x69, 0x49, 0x92,
+    0x93, 0x5F, 0x6F, 0x44, 0xE4, 0x3D, 0x4F, 0xF4, 0x92, 0x25, 0x8B, 0xCB, 0x9D, 0x75, 0x26, 0x62,
+    0x7B, 0x32, 0xA2, 0x27, 0xE5, 0x38, 0x68, 0xCF, 0x84, 0xCA, 0x13, 0x5D, 0x66, 0xA1, 0xCB, 0x42,
+    0x7F, 0xDF, 0x3B, 0x3F, 0x45, 0xCF, 0x16, 0x75, 0x49, 0x13, 0xE7, 0xDA, 0x6F, 0x31, 0x71, 0xF4,
+    0xEE, 0xAA, 0xDE, 0x39, 0x82, 0xD1, 0x8B, 0x85, 0x29, 0x4C, 0xD1, 0xC7, 0x68, 0xCB, 0x3C, 0xD0,
+    0x05, 0x3C, 0x22, 0xB6, 0x25, 0x94, 0x3B, 0xA0, 0x6E, 0xDC, 0x24, 0xDE, 0x16, 0x11, 0x23, 0x52,
+    0x19, 0x91, 0x22, 0x94, 0x37, 0x00, 0xE8, 0x46, 0xCF, 0xF8, 0xCC, 0x94, 0xCD, 0x7E, 0xB5, 0x34,
+    0xFE, 0x79, 0x6E, 0x3A, 0xF0, 0x28, 0x8F, 0x2E, 0x27, 0xBE, 0x52, 0x64, 0x23, 0xD8, 0x44, 0xBF,
+    0xF2, 0x3B, 0x5B, 0xB1, 0xF8, 0x47, 0x6E, 0xA2, 0x9E, 0x7C, 0xCE, 0x48, 0xFD, 0xB3, 0xB0, 0x9C,
+    0x80, 0x91, 0xEA, 0xE1, 0xEF, 0x2E, 0xFD, 0xEC, 0xDC, 0x91, 0xC9, 0xBD, 0x79, 0xBA, 0x8A, 0x2F,
+    0x55, 0x13, 0xB7, 0x55, 0x68, 0x85, 0xB9, 0x94, 0x34, 0x26, 0xBD, 0xDB, 0x9F, 0x1B, 0x1E, 0xF1,
+    0x9F, 0xD0, 0x9F, 0x09, 0x96, 0xE2, 0xC0, 0x27, 0xC7, 0x7C, 0x76, 0xCC, 0xFF, 0xEC, 0x5D, 0x62,
+    0x1F, 0xFB, 0x94, 0x67, 0x33, 0xB2, 0xDA, 0x7D, 0x9E, 0x5D, 0xF7, 0x29, 0xD0, 0x0C, 0x51, 0x6E,
+    0x72, 0x43, 0x68, 0x63, 0x74, 0x39, 0x8F, 0xF2, 0x1D, 0xA8, 0x53, 0x58, 0xED, 0xB6, 0x20, 0xE1,
+    0x76, 0xC0, 0x3D, 0xF4, 0x6D, 0x64, 0x2A, 0x72, 0x10, 0x5B, 0x76, 0x49, 0x81, 0x19, 0xB6, 0xC0,
+    0x06, 0xCF, 0x4A, 0x68, 0x03, 0x97, 0xB4, 0x1E, 0xEB, 0xC7, 0xAE, 0x39, 0x0C, 0x06, 0x43, 0x54,
+    0xCC, 0xA0, 0x6D, 0x87, 0xC0, 0x75, 0x50, 0x55, 0x17, 0x9A, 0x3E, 0xAC, 0xD6, 0x90, 0x55, 0x10,
+    0xFB, 0x7B, 0xC2, 0x40, 0x65, 0x8B, 0x26, 0x7B, 0x05, 0x46, 0xC0, 0xD4, 0x2D, 0x4B, 0xFE, 0x63,
+    0x47, 0xE5, 0x08, 0x0B, 0xA7, 0x49, 0xDB, 0xB4, 0x42, 0xBA, 0x42, 0x77, 0x85, 0x7E, 0x4A, 0x93,
+    0xFD, 0xAB, 0x26, 0x96, 0x7E, 0x78, 0xF3, 0x3E, 0x4F, 0x7E, 0x5E, 0x5F, 0xF3, 0xAB, 0x59, 0xF4,
+    0x83, 0xA5, 0x93, 0x00, 0xEC, 0xA0, 0x28, 0xA7, 0xF6, 0x28, 0x5B, 0x4E, 0xED, 0x51, 0xD6, 0xA5,
+    0xE1, 0xBB, 0x36, 0xF9, 0xD7, 0x28, 0xCB, 0x14, 0x81, 0xCD, 0xA4, 0xB9, 0x75, 0xFE, 0x0F, 0x2C,
+    0x86, 0xBB, 0x9C, 0x4E, 0x4E, 0x07, 0x6E, 0x73, 0x3A, 0x2D, 0xBD, 0xD3, 0x8C, 0xDD, 0xFF, 0x09,
+    0x80, 0x41, 0xB3, 0x4E, 0xFB, 0xF1, 0xE3, 0x4F, 0xC3, 0x6E, 0x3E, 0x83, 0x2E, 0xBB, 0x60, 0x9E,
+    0xF1, 0xB0, 0x16, 0x95, 0x70, 0x62, 0xFF, 0x83, 0x23, 0xB4, 0x03, 0x68, 0xD6, 0x41, 0xBF, 0x67,
+    0xC1, 0x5C, 0x01, 0xB2, 0x14, 0x68, 0x3C, 0xE8, 0xF7, 0xBF, 0x9F, 0x63, 0xAE, 0x88, 0x23, 0x4B,
+    0x95, 0xA7, 0xF1, 0xAA, 0xD4, 0xEF, 0x5B, 0x5D, 0x98, 0x2B, 0x4C, 0x92, 0xA5, 0x6C, 0xD2, 0x8C,
+    0x06, 0xA5, 0xFE, 0x50, 0x46, 0x98, 0xD7, 0xA4, 0x24, 0xCB, 0x59, 0xDA, 0x47, 0x64, 0x2B, 0xB2,
+    0xD0, 0xD1, 0xC4, 0xF7, 0x1E, 0x5E, 0x98, 0x80, 0x1D, 0x5D, 0xF8, 0x4F, 0x9E, 0x60, 0xDB, 0x12,
+    0x19, 0x98, 0xCD, 0x46, 0xF9, 0xBA, 0x8F, 0x1E, 0xDB, 0xB6, 0x91, 0x31, 0xCC, 0xA6, 0xA9, 0xF2,
+    0x5E, 0xE4, 0xCC, 0x35, 0x79, 0xC3, 0xE4, 0xBB, 0x72, 0x1E, 0x46, 0x79, 0x4C, 0xCE, 0x22, 0xA6,
+    0x40, 0x97, 0x91, 0x85, 0x7E, 0x58, 0x82, 0xD9, 0xF6, 0xA0, 0x6E, 0x79, 0xC6, 0x40, 0x52, 0x37,
+    0x8C, 0x61, 0x38, 0x83, 0x92, 0x16, 0xAA, 0x93, 0x9D, 0xB2, 0x90, 0x6D, 0xD7, 0x10, 0xDB, 0x1E,
+    0x18, 0x67, 0x2A, 0x8C, 0x47, 0x9A, 0xA8, 0x22, 0x11, 0x3B, 0x0E, 0xEF, 0xB3, 0x03, 0x80, 0x52,
+    0xDB, 0x88, 0x75, 0xD2, 0x19, 0xD4, 0x35, 0x8B, 0xA9, 0x60, 0xB1, 0x75, 0x26, 0x24, 0x67, 0xBE,
+    0x4B, 0x78, 0xC9, 0x51, 0x99, 0xDF, 0xCB, 0x18, 0x94, 0x77, 0x7C, 0x80, 0x50, 0xA4, 0x27, 0xFE,
+    0x6E, 0x89, 0x12, 0x91, 0xB7, 0xA4, 0x65, 0xA2, 0xC0, 0xC8, 0xF8, 0x56, 0xEA, 0x83, 0xC1, 0x2F,
+    0xF1, 0x7A, 0xB1, 0xE0, 0x26, 0x17, 0xF4, 0x3F, 0xE5, 0xF5, 0xFC, 0x48, 0xB9, 0xE7, 0x88, 0xFE,
+    0x45, 0xAE, 0xB5, 0x95, 0x5F, 0xE0, 0x1A, 0x7F, 0xC5, 0x4E, 0x2D, 0x87, 0x53, 0xCA, 0xB6, 0x00,
+    0x53, 0x86, 0x3D, 0xB9, 0xBB, 0x15, 0xDF, 0x7B, 0x9F, 0x3C, 0x7B, 0xCD, 0x37, 0x6B, 0x59, 0x3E,
+    0x4A, 0x7E, 0xDB, 0x37, 0xD9, 0x71, 0x77, 0xFB, 0x7E, 0x2B, 0xB9, 0x7C, 0xA3, 0xC9, 0xCC, 0xB6,
+    0x6F, 0x92, 0xC7, 0xAF, 0xD6, 0x6B, 0xED, 0xB6, 0x76, 0x37, 0x1D, 0xB9, 0x9D, 0x16, 0x78, 0x78,
+    0xEB, 0xF9, 0x4C, 0x1A, 0x16, 0xF8, 0xB4, 0x69, 0xEA, 0x36, 0x4B, 0x00, 0xB7, 0xE3, 0xAD, 0x77,
+    0xCE, 0x0C, 0x2C, 0x80, 0xE3, 0x85, 0xB7, 0xBF, 0x29, 0x92, 0xB7, 0xB1, 0xA7, 0x7B, 0xC2, 0x50,
+    0x3F, 0xD4, 0xD2, 0x3C, 0xDC, 0x7F, 0xE0, 0xA9, 0xB2, 0x04, 0x00, 0x5A, 0x6A, 0x25, 0xC2, 0x40,
+    0x6C, 0x22, 0xDE, 0xC8, 0x50, 0x8B, 0x1C, 0x15, 0x71, 0x03, 0xA9, 0xC7, 0xEC, 0xA1, 0xC8, 0x0D,
+    0x91, 0x86, 0x30, 0xEF, 0x1D, 0x1F, 0xF6, 0x8E, 0xE5, 0xB0, 0xAF, 0xDB, 0x1F, 0xEE, 0xEB, 0xF6,
+    0x87, 0xEA, 0x43, 0x0B, 0xE1, 0x44, 0xAE, 0x8F, 0x1E, 0x50, 0x17, 0x7F, 0x8D, 0xF2, 0x4B, 0xF9,
+    0xFA, 0x1E, 0x7B, 0x3A, 0x70, 0x6D, 0x4F, 0x27, 0x21, 0x82, 0xB0, 0x40, 0x5B, 0xD4, 0xD5, 0xBF,
+    0xC9, 0x7B, 0x7F, 0xF1, 0xC0, 0xC6, 0xBF, 0xF8, 0x3B, 0xE9, 0x17, 0xFE, 0x72, 0x27, 0xFC, 0xE6,
+    0xC4, 0x3D, 0xE3, 0x97, 0x3C, 0xFB, 0x7A, 0x35, 0xCC, 0xCC, 0xB6, 0x6F, 0xD6, 0x92, 0x67, 0xAF,
+    0x55, 0x00, 0x3B, 0x71, 0x87, 0xCC, 0x51, 0xDF, 0x9D, 0xD1, 0xB6, 0x4A, 0xA3, 0xA3, 0x6E, 0x7D,
+    0x8F, 0x2E, 0x00, 0x0E, 0xC6, 0x81, 0x4B, 0x75, 0xC1, 0xA1, 0x29, 0xBD, 0xED, 0x62, 0xC3, 0xC6,
+    0x4A, 0x70, 0x71, 0xAC, 0xD3, 0x07, 0x77, 0x29, 0xDB, 0x8D, 0xB5, 0x9B, 0x0B, 0x0B, 0x6F, 0x02,
+    0xBB, 0xA2, 0x8B, 0x73, 0x53, 0x00, 0x2C, 0xD1, 0xE5, 0x37, 0xED, 0x66, 0x87, 0xBD, 0xCA, 0xCE,
+    0xEB, 0xB2, 0x43, 0xA5, 0x6A, 0x55, 0x2B, 0xA7, 0x72, 0x94, 0xD5, 0x65, 0xE0, 0x02, 0x67, 0x6C,
+    0x63, 0x6C, 0x4A, 0x31, 0xE6, 0x0C, 0xBE, 0x46, 0x1D, 0x9C, 0xD3, 0xDE, 0xD8, 0x0B, 0x98, 0x8B,
+    0x4D, 0x52, 0xD0, 0x23, 0xF2, 0x04, 0x8D, 0x6A, 0xC0, 0xB8, 0x1E, 0x90, 0x7D, 0xBB, 0x24, 0x51,
+    0x52, 0x4F, 0x68, 0x1F, 0x8E, 0xA8, 0x32, 0xB2, 0x32, 0x7E, 0x7A, 0xC9, 0xC8, 0xD1, 0x06, 0x2D,
+    0x0D, 0x20, 0xDF, 0xF6, 0x90, 0xB9, 0x81, 0x25, 0x6A, 0x02, 0x21, 0x10, 0x4C, 0xCD, 0xA0, 0x5C,
+    0xCA, 0x5C, 0x52, 0x27, 0x4A, 0x0A, 0xB4, 0x07, 0xC8, 0x72, 0x20, 0x4F, 0xB5, 0x6D, 0x53, 0x37,
+    0xB4, 0xDD, 0xC8, 0xF6, 0x23, 0xDB, 0x37, 0x76, 0x07, 0xAA, 0x4E, 0xB6, 0x9B, 0xCC, 0x72, 0x10,
+    0xE5, 0x38, 0x55, 0x1A, 0xF1, 0x9B, 0x3D, 0x77, 0xF4, 0x2D, 0x1B, 0x3D, 0x5B, 0xCC, 0xCF, 0xB3,
+    0x59, 0x07, 0xAF, 0x97, 0xE6, 0xDB, 0x2C, 0x56, 0x88, 0xD5, 0x0D, 0x89, 0x65, 0x8B, 0xA0, 0x26,
+    0x72, 0x24, 0x05, 0x4B, 0xB0, 0x84, 0xB1, 0x64, 0x39, 0x43, 0xC2, 0x9A, 0xD8, 0xD1, 0x93, 0x0F,
+    0x45, 0x80, 0xE5, 0xE0, 0x9F, 0xA9, 0xAB, 0xE2, 0xA3, 0xB3, 0x00, 0x58, 0xD4, 0x3F, 0x39, 0xCB,
+    0x4E, 0x07, 0xBD, 0x82, 0xDD, 0x7F, 0x02, 0xBB, 0x77, 0x70, 0x10, 0xFB, 0x97, 0xFE, 0xD6, 0xFF,
+    0xBA, 0x3A, 0x0A, 0x5C, 0x58, 0xAE, 0x5D, 0xFB, 0x77, 0xFF, 0xFD, 0x4F, 0x54, 0x31, 0xD6, 0xBA,
+    0x00, 0x74, 0x81, 0xB2, 0x50, 0xC2, 0x3A, 0x1C, 0x81, 0xF4, 0x63, 0x73, 0x1D, 0x94, 0xE0, 0x61,
+    0x1D, 0x56, 0x20, 0xBD, 0xEB, 0xD6, 0xBC, 0xC1, 0x23, 0x67, 0xB5, 0x34, 0xA1, 0x54, 0xF3, 0x41,
+    0xDD, 0x09, 0xAB, 0xBD, 0xAA, 0xCA, 0xB5, 0x47, 0xB7, 0x54, 0x6C, 0x81, 0x81, 0x96, 0xA6, 0xAD,
+    0x50, 0x9E, 0xD0, 0x62, 0x72, 0x56, 0xA1, 0x4F, 0xE8, 0x30, 0xA5, 0x1A, 0x11, 0x0C, 0x89, 0x1C,
+    0xA6, 0x24, 0xA1, 0x3D, 0x01, 0xD0, 0xB2, 0x61, 0xDA, 0x13, 0x15, 0x0F, 0xEC, 0x36, 0xCA, 0x13,
+    0x38, 0xA2, 0x76, 0x37, 0xCD, 0xC9, 0xE0, 0x04, 0x9C, 0xB8, 0x1D, 0x20, 0x25, 0x13, 0xCB, 0x46,
+    0xE8, 0xD3, 0xBD, 0xAA, 0x4A, 0xDB, 0x1D, 0x6E, 0x33, 0x85, 0x2A, 0x05, 0x9F, 0x12, 0xB8, 0x2E,
+    0x91, 0xED, 0x92, 0xE4, 0xDD, 0x60, 0x48, 0x3F, 0xA8, 0xE8, 0x07, 0xFE, 0x8E, 0x34, 0xEA, 0xEC,
+    0xD8, 0x4A, 0x2D, 0xA9, 0x5A, 0xF9, 0xA0, 0x09, 0x2A, 0xDD, 0xE8, 0x4A, 0x37, 0xB7, 0x19, 0x18,
+    0x10, 0xC9, 0x59, 0x09, 0x7D, 0xF0, 0xC7, 0x2C, 0xE2, 0x89, 0x6C, 0x8A, 0xF2, 0x06, 0x36, 0xB5,
+    0xA5, 0x83, 0x27, 0xA6, 0x4B, 0x9C, 0xC7, 0x24, 0x45, 0x68, 0x7B, 0x85, 0xF2, 0x71, 0x41, 0x3F,
+    0x2C, 0x49, 0x54, 0x45, 0x64, 0x57, 0xD1, 0xFE, 0xF3, 0x2D, 0x77, 0x0D, 0x4B, 0xC4, 0x45, 0x87,
+    0xC8, 0xC5, 0x85, 0x6E, 0x22, 0x87, 0xDC, 0xB7, 0x4D, 0x4C, 0x41, 0x0A, 0x0B, 0x70, 0x1A, 0xD6,
+    0xC1, 0xA1, 0xCA, 0xE8, 0x19, 0x6B, 0xB6, 0xAD, 0xD9, 0x2E, 0x26, 0x1E, 0xCF, 0x69, 0x8F, 0x0E,
+    0xCC, 0xC0, 0x2C, 0xA4, 0xB0, 0x02, 0x1B, 0xE0, 0x97, 0xB8, 0xE1, 0x83, 0xEB, 0x5E, 0x5F, 0xAB,
+    0xB4, 0x25, 0xB4, 0x44, 0x39, 0x06, 0x62, 0x98, 0x87, 0x0E, 0xA4, 0xB0, 0x0C, 0x39, 0x7C, 0xF6,
+    0xCC, 0xC4, 0x5F, 0xFD, 0xC2, 0x17, 0x0E, 0xFF, 0xEA, 0x2F, 0x25, 0xF6, 0x39, 0x78, 0x48, 0x17,
+    0xFF, 0xF3, 0xE0, 0xF6, 0xE8, 0x73, 0xE5, 0x94, 0xB2, 0xE8, 0xE7, 0x0F, 0x6B, 0xB2, 0x62, 0xD7,
+    0xDE, 0x3F, 0x18, 0x3E, 0x4C, 0xF4, 0x72, 0xFE, 0xF3, 0x67, 0xFE, 0xF1, 0xE1, 0xBF, 0xF6, 0x78,
+    0x5C, 0xEE, 0x85, 0x81, 0x0D, 0x39, 0x84, 0xD3, 0xF9, 0x14, 0xEB, 0xDA, 0xEE, 0x2A, 0x9E, 0x7E,
+    0xE6, 0x6F, 0x6B, 0x7F, 0xF0, 0x9C, 0xDD, 0x7E, 0x3C, 0xAC, 0x26, 0x8B, 0x4B, 0x67, 0xF4, 0x9E,
+    0xA9, 0xD8, 0x73, 0xF1, 0xC9, 0xC8, 0x1F, 0xFC, 0x75, 0x44, 0x74, 0x35, 0x6F, 0xF2, 0xB4, 0xCB,
+    0x0D, 0xAF, 0x5F, 0xB1, 0xE6, 0x14, 0x9D, 0x3E, 0xB7, 0xBC, 0x7E, 0xC7, 0x9A, 0x01, 0x8B, 0x13,
+    0xF9, 0xC1, 0xC3, 0xCB, 0x0F, 0xFD, 0xDB, 0xDD, 0xAF, 0xFF, 0xC2, 0xF5, 0xDD, 0x7E, 0x6A, 0x3D,
+    0x5D, 0x6B, 0xB2, 0x2A, 0x2A, 0x09, 0xDC, 0x4E, 0xBE, 0xBA, 0x8B, 0x73, 0xBB, 0xF4, 0xF0, 0xD1,
+    0x22, 0x79, 0x66, 0x92, 0xE5, 0x5D, 0xAA, 0x5C, 0x99, 0xD7, 0xB2, 0x7F, 0xE9, 0xE1, 0xFC, 0xB3,
+    0x1C, 0xF8, 0xAC, 0x29, 0x77, 0xF1, 0xBD, 0xE1, 0x7E, 0x60, 0x17, 0x5D, 0xBD, 0x7C, 0xC8, 0x8A,
+    0x9D, 0x62, 0x19, 0xFD, 0xFC, 0x61, 0xFD, 0x06, 0x76, 0xCF, 0xCF, 0x5F, 0xAB, 0xA2, 0xF2, 0xAC,
+    0xDE, 0x9C, 0x3C, 0x74, 0xF8, 0xF0, 0xD5, 0x8B, 0x43, 0xF2, 0xEC, 0xDC, 0x4E, 0xCE, 0xED, 0xA1,
+    0x9C, 0x0A, 0x6C, 0x0A, 0x13, 0xF9, 0xDF, 0x7B, 0x46, 0xEF, 0x3A, 0x64, 0xEC, 0xD5, 0xED, 0xE3,
+    0x61, 0x05, 0x3B, 0xF3, 0xDF, 0x3D, 0x16, 0xEE, 0xDE, 0x7D, 0x64, 0xB9, 0x67, 0xC3, 0xA8, 0x9A,
+    0x80, 0x73, 0x61, 0x9E, 0xAA, 0xD2, 0xB0, 0x10, 0x94, 0x86, 0x05, 0x55, 0x46, 0x79, 0x8A, 0xD7,
+    0xD6, 0x90, 0xB2, 0x11, 0x94, 0x61, 0x61, 0x48, 0xA9, 0x94, 0xD3, 0xD6, 0xE4, 0x31, 0x1D, 0xFA,
+    0x87, 0x38, 0x8D, 0x57, 0xA5, 0xB6, 0x51, 0x3E, 0x49, 0xCA, 0x86, 0x72, 0xED, 0x77, 0xDA, 0x7F,
+    0xA3, 0x5C, 0x54, 0xCC, 0xE1, 0x43, 0x3B, 0x4F, 0x15, 0xDA, 0x45, 0xE5, 0xC7, 0x5A, 0xAC, 0xB7,
+    0x2D, 0x33, 0x93, 0xB0, 0x7E, 0x1A, 0x7D, 0xC9, 0x62, 0xA4, 0x50, 0x22, 0x64, 0x7F, 0xF6, 0x46,
+    0x20, 0x11, 0x71, 0x9D, 0x32, 0xBC, 0xEA, 0xC2, 0x57, 0xA3, 0x3C, 0x49, 0x53, 0x1A, 0xE7, 0xF5,
+    0x87, 0xC7, 0x0B, 0xD3, 0xCC, 0x92, 0x79, 0x8F, 0x6C, 0x17, 0x81, 0xC8, 0x8B, 0x5A, 0xA4, 0x89,
+    0x5A, 0x0F, 0xC3, 0xFE, 0x91, 0xDC, 0xD4, 0x97, 0x2C, 0x93, 0x06, 0x4E, 0x2F, 0x10, 0x5C, 0x2C,
+    0x3F, 0x1D, 0xFF, 0x18, 0xFC, 0x4A, 0x46, 0xF6, 0xBA, 0xD7, 0x65, 0x56, 0x2C, 0xE8, 0x91, 0x2E,
+    0x12, 0x19, 0xDC, 0xCF, 0x3F, 0x9E, 0xBD, 0x37, 0x7A, 0xE0, 0x48, 0xA4, 0x8C, 0xCA, 0xE8, 0xF6,
+    0x31, 0xB1, 0x15, 0x88, 0xA5, 0x51, 0x22, 0x56, 0xB9, 0xF6, 0x10, 0xCB, 0x98, 0x15, 0xEA, 0x42,
+    0x64, 0x09, 0x2A, 0xF4, 0x10, 0x32, 0x19, 0x1D, 0x13, 0x69, 0x58, 0xC2, 0xE4, 0xBA, 0x26, 0xCE,
+    0x75, 0x43, 0x9C, 0xEB, 0x11, 0x71, 0xAE, 0x85, 0x04, 0x2D, 0x79, 0x82, 0x7E, 0xD7, 0x26, 0x84,
+    0x6F, 0x95, 0x19, 0xE1, 0xEB, 0x3E, 0x63, 0x20, 0x22, 0x8D, 0x88, 0x48, 0x13, 0xB9, 0x0B, 0x19,
+    0x91, 0x5B, 0xCC, 0x88, 0x5C, 0xD2, 0xC3, 0x38, 0x33, 0xC2, 0xB8, 0x68, 0x84, 0xF1, 0xE1, 0x08,
+    0xE3, 0xF5, 0x08, 0x25, 0x37, 0x51, 0x22, 0x56, 0xF9, 0xD0, 0x2B, 0x8F, 0x1F, 0x88, 0x8C, 0xBE,
+    0xFC, 0xC1, 0x97, 0x6E, 0x06, 0x7E, 0xA7, 0x0F, 0x44, 0x5C, 0x20, 0x52, 0xE8, 0x5B, 0xBF, 0x87,
+    0x1E, 0x23, 0xDA, 0xFB, 0xA4, 0xBA, 0x2B, 0xD9, 0x1B, 0x80, 0x91, 0x02, 0x34, 0x1E, 0xB0, 0xD3,
+    0xC0, 0x61, 0x5D, 0xC0, 0x14, 0x0E, 0x42, 0x55, 0x91, 0x3C, 0x2D, 0x0D, 0x8B, 0xE7, 0x7A, 0x43,
+    0xA6, 0x88, 0x25, 0x0F, 0x89, 0xDE, 0xF4, 0x54, 0x81, 0x9F, 0x27, 0x29, 0xFB, 0xA1, 0x55, 0xC3,
+    0x44, 0x79, 0xC2, 0x97, 0x6C, 0x97, 0xFC, 0x7D, 0x1F, 0xE7, 0xBD, 0xA6, 0x09, 0x5D, 0x26, 0x99,
+    0x6A, 0xC2, 0x11, 0xB3, 0x70, 0x64, 0x0A, 0x4E, 0x4F, 0xC3, 0xFA, 0x64, 0x2B, 0xDE, 0xE8, 0xC2,
+    0x89, 0xC8, 0x50, 0x44, 0x86, 0x91, 0xB9, 0x5E, 0x86, 0x4F, 0xBC, 0x67, 0xC3, 0x7F, 0xF3, 0xBE,
+    0xD5, 0x17, 0xFE, 0xD0, 0xEA, 0xA6, 0x57, 0xE8, 0x26, 0x2B, 0x82, 0x3A, 0xCB, 0x83, 0x2A, 0x41,
+    0xF9, 0x18, 0xE5, 0x63, 0xBE, 0x93, 0x83, 0x48, 0x3E, 0x21, 0x2F, 0x3A, 0x53, 0x53, 0x99, 0x8A,
+    0xB4, 0x95, 0x83, 0xB3, 0xC6, 0xA7, 0xF7, 0x0A, 0xC6, 0xCF, 0x62, 0x7C, 0x4C, 0xEC, 0xA3, 0x37,
+    0x7B, 0x5F, 0x0D, 0x44, 0xE0, 0x73, 0x03, 0x78, 0x08, 0x02, 0xCB, 0xCE, 0xAD, 0xB3, 0x0C, 0x46,
+    0x90, 0x12, 0xBE, 0x5F, 0x28, 0xA9, 0x59, 0x88, 0x8B, 0x88, 0x4D, 0x5C, 0x54, 0x18, 0x36, 0xA9,
+    0xE2, 0x22, 0x94, 0x9A, 0x44, 0x0A, 0x7E, 0x7D, 0x5F, 0x28, 0x62, 0x7B, 0xE3, 0x60, 0x5F, 0x20,
+    0x5E, 0x4B, 0xA3, 0x1A, 0x45, 0x1F, 0x3A, 0x28, 0x11, 0xBE, 0xFC, 0x76, 0x81, 0x67, 0x62, 0x50,
+    0x6B, 0xF9, 0x2E, 0xBA, 0x84, 0x1A, 0x12, 0x08, 0x2B, 0x10, 0x21, 0x16, 0xCB, 0xC0, 0x03, 0xFB,
+    0x4F, 0x9E, 0x3C, 0x91, 0x89, 0x0C, 0x33, 0x91, 0xE1, 0x5E, 0x5D, 0xB6, 0x47, 0x75, 0xF5, 0xCB,
+    0xA0, 0x25, 0xE7, 0x91, 0x9B, 0x20, 0x0E, 0xDE, 0x7A, 0x2B, 0x27, 0x94, 0x9C, 0xB8, 0x6A, 0xEF,
+    0xBF, 0xE5, 0x5A, 0x5C, 0x18, 0xF9, 0xBB, 0xD2, 0x1B, 0xE5, 0x84, 0x22, 0xD0, 0x55, 0xFD, 0x50,
+    0x44, 0x84, 0x3E, 0x9D, 0x9D, 0x2F, 0xBE, 0xFD, 0xC2, 0x2D, 0xFA, 0xAA, 0x21, 0x12, 0x29, 0x18,
+    0x88, 0xC3, 0xBC, 0xBD, 0xD4, 0x12, 0x6A, 0xC6, 0xF2, 0x60, 0xA5, 0x04, 0x86, 0xB7, 0x2B, 0xEC,
+    0x1D, 0x9F, 0xE6, 0xD0, 0x39, 0x50, 0xC2, 0xC3, 0xE2, 0xE8, 0xC9, 0x90, 0xC1, 0xB7, 0x14, 0xD9,
+    0x51, 0x4B, 0x52, 0x2C, 0x63, 0xCA, 0x29, 0xB4, 0x0F, 0xA1, 0x51, 0x96, 0x8C, 0x65, 0x8C, 0x8D,
+    0x6F, 0x1D, 0xF3, 0xE1, 0xA0, 0x6E, 0x94, 0xDD, 0x4A, 0x8A, 0xE5, 0xB9, 0xB0, 0x9E, 0x32, 0x79,
+    0x1B, 0xD5, 0x94, 0x3A, 0x10, 0x19, 0x12, 0xC9, 0x1B, 0xED, 0x5A, 0x09, 0x2C, 0xB0, 0x04, 0x0C,
+    0x6E, 0x8E, 0xE9, 0xA0, 0xC9, 0x17, 0x04, 0xC6, 0x5C, 0x72, 0x0D, 0x68, 0x17, 0x8A, 0x88, 0x7C,
+    0x5B, 0x44, 0xEE, 0x46, 0x3F, 0xEF, 0x3E, 0xCA, 0x1C, 0x20, 0xA5, 0x2A, 0xB4, 0x88, 0x14, 0x5A,
+    0x44, 0x72, 0x2D, 0x22, 0xA8, 0x81, 0xDC, 0xA6, 0xD2, 0xF2, 0x96, 0x2A, 0xED, 0xB9, 0x44, 0xF4,
+    0x3B, 0xF4, 0xD7, 0xA3, 0xC7, 0xA9, 0xD6, 0xCD, 0xE3, 0x6C, 0x2E, 0x47, 0xAF, 0x90, 0xDD, 0x52,
+    0x52, 0xEF, 0x94, 0x22, 0x00, 0x20, 0xBB, 0x07, 0xF0, 0xDE, 0x9E, 0x12, 0xEE, 0x4C, 0xC9, 0x6D,
+    0x71, 0xAD, 0x84, 0x0F, 0x48, 0x74, 0x77, 0x3A, 0xF6, 0x9F, 0xFC, 0xB2, 0x08, 0xEB, 0xE8, 0x62,
+    0xFF, 0xEA, 0x2F, 0x8B, 0xB0, 0xA2, 0x4E, 0xE5, 0xBD, 0x32, 0x1C, 0xA1, 0x2A, 0x42, 0x4B, 0x87,
+    0xD0, 0xD1, 0x6B, 0xE9, 0x83, 0xA0, 0x40, 0x5B, 0xF4, 0xC5, 0x42, 0xBF, 0x6B, 0xA3, 0x21, 0x3D,
+    0xCB, 0xDF, 0xFF, 0x6F, 0x56, 0x4B, 0xF1, 0x48, 0x4D, 0xCF, 0xEE, 0xF9, 0x55, 0x9B, 0xEA, 0x8B,
+    0x95, 0x96, 0x42, 0xB7, 0xC1, 0xAB, 0x87, 0x20, 0x82, 0xC0, 0x12, 0x8C, 0xD0, 0xE2, 0x03, 0x59,
+    0xE3, 0x83, 0x6D, 0x9B, 0x2E, 0xFB, 0x99, 0xA9, 0xD9, 0xF0, 0x78, 0xA8, 0xAE, 0x5E, 0xB4, 0xA7,
+    0x97, 0x97, 0xA7, 0xA7, 0xA6, 0xF4, 0xB1, 0x10, 0x77, 0xC9, 0x2E, 0x1C, 0x59, 0x27, 0x96, 0xB3,
+    0x84, 0x22, 0x28, 0x1F, 0x7A, 0xBA, 0xA4, 0x24, 0x98, 0x3C, 0xB2, 0xDA, 0x06, 0x3E, 0xF4, 0x3D,
+    0x91, 0x3A, 0x16, 0xA9, 0x43, 0x79, 0x7B, 0xA9, 0x85, 0x66, 0x0D, 0x64, 0x22, 0xB9, 0x11, 0x29,
+    0xDB, 0x07, 0xC3, 0x31, 0x5C, 0x33, 0x25, 0xF0, 0x99, 0x96, 0xA4, 0xF6, 0x30, 0x07, 0x61, 0x7B,
+    0x9A, 0x33, 0x13, 0xD9, 0xBE, 0x75, 0xFE, 0x79, 0x43, 0x0B, 0x7A, 0x7C, 0xFB, 0x87, 0x7D, 0xE3,
+    0x71, 0xF4, 0x90, 0x95, 0xC4, 0x92, 0x87, 0x57, 0xE6, 0x03, 0xE7, 0x37, 0x17, 0x8C, 0x2A, 0xB8,
+    0x4B, 0x6E, 0xDF, 0x53, 0x04, 0xAD, 0xF1, 0x54, 0x0E, 0xA2, 0x7C, 0xFC, 0xAE, 0x9E, 0xC8, 0x33,
+    0xE7, 0xCF, 0xD7, 0x30, 0xD3, 0x9E, 0xD6, 0x68, 0x0F, 0xF3, 0x05, 0x63, 0xBC, 0xFA, 0xE0, 0x6B,
+    0xF6, 0x1A, 0xB4, 0xF5, 0xA9, 0x79, 0xC2, 0xE4, 0x9D, 0x0F, 0x2D, 0xE3, 0x40, 0xF2, 0x4E, 0xE0,
+    0x40, 0x00, 0x4E, 0xE7, 0xDA, 0xAA, 0x32, 0x82, 0xE5, 0xB9, 0x93, 0x27, 0xBB, 0x99, 0xC8, 0x68,
+    0x1A, 0xD2, 0x08, 0xD6, 0x03, 0x1B, 0x58, 0xCE, 0xE9, 0x3B, 0x31, 0x81, 0x14, 0x25, 0x44, 0x5F,
+    0x2F, 0x67, 0x0F, 0x9D, 0x3E, 0x70, 0x68, 0x1F, 0x87, 0xB8, 0x93, 0x0E, 0x1C, 0x22, 0x3D, 0xB4,
+    0x60, 0xBE, 0xE6, 0x02, 0x29, 0xB8, 0x00, 0xFB, 0xF8, 0xDC, 0x8B, 0x4E, 0x6E, 0x1D, 0xAB, 0x98,
+    0xAC, 0x38, 0x52, 0x51, 0x56, 0x3A, 0xAF, 0xA6, 0xA9, 0x0E, 0x50, 0x41, 0x11, 0xBF, 0xBD, 0xF4,
+    0x73, 0x62, 0xC9, 0xD0, 0x7F, 0x4E, 0xE7, 0x88, 0x2E, 0xCB, 0x8E, 0x3E, 0x56, 0x4E, 0x76, 0x38,
+    0x78, 0x16, 0x0E, 0x82, 0x27, 0xF7, 0xFA, 0xA8, 0xDF, 0xA3, 0xDC, 0x72, 0x70, 0xDD, 0x06, 0xAF,
+    0xA2, 0xEB, 0x87, 0x5F, 0x70, 0x83, 0x31, 0xC1, 0x77, 0x20, 0xD7, 0xDB, 0xF9, 0xDC, 0x9E, 0xC0,
+    0x2D, 0xCC, 0x70, 0xC3, 0x07, 0x57, 0x08, 0x3D, 0xF1, 0xF9, 0xB3, 0x59, 0x4B, 0xC7, 0x1E, 0x00,
+    0x16, 0x80, 0x0D, 0x50, 0x25, 0xE8, 0x02, 0x8C, 0x48, 0x93, 0x8E, 0x0F, 0x2B, 0x84, 0x22, 0x4D,
+    0xE0, 0xC6, 0x8B, 0x68, 0x61, 0xBC, 0x96, 0x77, 0x00, 0xE1, 0x71, 0xD0, 0x57, 0x3D, 0xBA, 0xEA,
+    0xA1, 0xFF, 0xF7, 0x94, 0xD7, 0xD7, 0x8E, 0x1B, 0x5D, 0x5E, 0xB5, 0xBE, 0x3C, 0xB2, 0xBC, 0x83,
+    0x3D, 0x53, 0xA0, 0x8F, 0x03, 0x57, 0x2D, 0x1C, 0x59, 0xE6, 0xFE, 0x07, 0xEC, 0x1B, 0xCF, 0xF1,
+    0xDC, 0xF8, 0x54, 0x86, 0xB6, 0x3D, 0x11, 0x3F, 0x0E, 0x6B, 0x55, 0x3D, 0x11, 0x0B, 0x26, 0x6F,
+    0xFF, 0xEB, 0xC1, 0x18, 0x00, 0x7F, 0xE6, 0xA1, 0x4F, 0x78, 0x63, 0x7E, 0x64, 0x99, 0x74, 0xCF,
+    0x54, 0x14, 0x6E, 0x1F, 0x8F, 0xF2, 0xEE, 0xD5, 0x97, 0xF2, 0xB0, 0xFA, 0x47, 0x39, 0x17, 0xE2,
+    0x9C, 0xE8, 0x78, 0x0E, 0xBF, 0x33, 0x9E, 0x8E, 0x03, 0x14, 0xE8, 0x62, 0x0E, 0x36, 0xF0, 0x4C,
+    0x13, 0x16, 0xBA, 0x60, 0x0E, 0x11, 0xA9, 0x52, 0xD0, 0x97, 0x1C, 0xAC, 0x84, 0x22, 0x23, 0xE6,
+    0x89, 0x2C, 0xB5, 0xF2, 0xE8, 0x62, 0x1A, 0xF6, 0x92, 0xF3, 0x7F, 0x01, 0x85, 0x94, 0xB1, 0x6F,
+    0x1C, 0x45, 0x14, 0xC6, 0x7F, 0xBB, 0x43, 0x3C, 0x98, 0x25, 0x37, 0x55, 0x90, 0x71, 0x88, 0x87,
+    0x82, 0x82, 0xE2, 0x72, 0xDB, 0xA4, 0x70, 0xB1, 0xDE, 0x5D, 0x25, 0x45, 0x2A, 0xBA, 0x58, 0x91,
+    0x22, 0xA1, 0x34, 0xAE, 0xA0, 0x30, 0x85, 0x8B, 0x14, 0x8B, 0x6E, 0x10, 0xFF, 0x80, 0x23, 0xFE,
+    0x00, 0x5C, 0x60, 0x09, 0xA5, 0xC9, 0x15, 0x91, 0xB0, 0x84, 0x13, 0x8F, 0x88, 0x04, 0x25, 0x1B,
+    0x52, 0x45, 0xA2, 0x98, 0xC2, 0xA9, 0x99, 0x62, 0x23, 0xD6, 0xD2, 0x9E, 0x1F, 0xC5, 0x1D, 0xA6,
+    0x41, 0xF0, 0x69, 0xF4, 0x3D, 0x7D, 0x9A, 0x79, 0x7A, 0xDF, 0x7B, 0x7A, 0x1A, 0x56, 0x21, 0xED,
+    0xE0, 0x87, 0x96, 0xD2, 0xBA, 0xFC, 0xC5, 0xB7, 0x37, 0x5F, 0xAD, 0x15, 0x3C, 0x74, 0xAC, 0xAE,
+    0xF1, 0x4F, 0x48, 0x5F, 0xAD, 0x35, 0xF6, 0xC5, 0xE3, 0xBA, 0xB4, 0x8E, 0x1F, 0x5B, 0xD2, 0x08,
+    0x6F, 0x03, 0xD4, 0x24, 0x3D, 0x5C, 0x87, 0xD1, 0xF2, 0xEC, 0x8C, 0x32, 0xF9, 0xC4, 0xDE, 0xFA,
+    0x7D, 0x8B, 0xA1, 0xE0, 0xB8, 0xE1, 0x41, 0xC1, 0x5E, 0x49, 0xCC, 0xFF, 0x08, 0x46, 0x7C, 0x7A,
+    0xCE, 0x02, 0xC9, 0xC9, 0xA9, 0xF2, 0x4A, 0xE4, 0xB9, 0x57, 0xBD, 0x12, 0xAF, 0x7A, 0x2A, 0x9F,
+    0xF4, 0xE8, 0xC8, 0x53, 0xD4, 0x9C, 0x0A, 0xFD, 0xAB, 0x33, 0x4E, 0x3F, 0x0F, 0xAA, 0xD5, 0xFE,
+    0x98, 0x4E, 0xBB, 0x9C, 0x52, 0x3B, 0xE3, 0xCC, 0x2F, 0x4E, 0x85, 0x54, 0x9C, 0xEA, 0x98, 0xBE,
+    0xFE, 0x7C, 0xC0, 0x88, 0x08, 0x99, 0x88, 0x90, 0xDD, 0x17, 0xA9, 0x75, 0xBD, 0x7B, 0x46, 0x52,
+    0xF3, 0x37, 0x74, 0x0B, 0x26, 0x80, 0x8D, 0x50, 0x1E, 0x41, 0xD3, 0x40, 0x5F, 0x92, 0x74, 0x39,
+    0x2A, 0x1A, 0xA7, 0xDA, 0xCC, 0x67, 0x5E, 0x07, 0xE3, 0x54, 0xCC, 0x49, 0xFA, 0x0A, 0x86, 0xA9,
+    0xC8, 0x30, 0x15, 0x19, 0xAE, 0x6C, 0x6F, 0xDF, 0x17, 0x09, 0x47, 0xCA, 0x4F, 0x88, 0x99, 0x2B,
+    0xD2, 0x60, 0xF8, 0x4F, 0xB1, 0x52, 0x7F, 0xFC, 0xBF, 0x6F, 0x16, 0x42, 0xBF, 0xD9, 0xBD, 0x2B,
+    0xD2, 0x5F, 0xD9, 0xBE, 0x2B, 0xB2, 0x09, 0x01, 0xE5, 0xB8, 0x0C, 0x37, 0xC0, 0x33, 0x26, 0x43,
+    0x79, 0x22, 0x5B, 0xDB, 0xB7, 0x45, 0xA6, 0x12, 0xE1, 0xD2, 0x67, 0xDF, 0xC8, 0x62, 0x70, 0x97,
+    0xB6, 0x41, 0x4B, 0x40, 0xB5, 0x40, 0x04, 0x8E, 0x80, 0x2D, 0xC0, 0x00, 0x99, 0x07, 0x15, 0x20,
+    0xE9, 0x80, 0x63, 0xA0, 0x84, 0x0F, 0x6D, 0x8D, 0x31, 0x9E, 0xF4, 0xCF, 0x08, 0x55, 0x0F, 0xD9,
+    0x1C, 0x10, 0x20, 0x3D, 0x5A, 0x09, 0x4A, 0x5E, 0x4A, 0x1A, 0xCA, 0x76, 0x16, 0x55, 0xFB, 0xEE,
+    0x0D, 0xA2, 0xFA, 0x94, 0x31, 0x2F, 0x6B, 0xE3, 0x66, 0x31, 0x93, 0x21, 0x97, 0xC7, 0x73, 0x25,
+    0x3F, 0xCD, 0x59, 0x77, 0x8B, 0xE2, 0x40, 0x36, 0x40, 0x1A, 0x6B, 0x28, 0x00, 0xED, 0x80, 0x27,
+    0x80, 0xA9, 0x97, 0x76, 0x0C, 0x90, 0x44, 0x60, 0x03, 0x48, 0xC3, 0xD2, 0x9C, 0x6A, 0x59, 0x24,
+    0x28, 0x0F, 0x34, 0x40, 0xE6, 0x80, 0x1E, 0x3E, 0xCA, 0x6B, 0x72, 0x89, 0xA4, 0x32, 0x07, 0x2D,
+    0x0E, 0x2E, 0xD5, 0xF0, 0x8E, 0xFE, 0xAD, 0x5F, 0x2E, 0x4A, 0xFA, 0x55, 0xF7, 0xAC, 0x72, 0x80,
+    0x6D, 0x57, 0x8B, 0xBD, 0xD1, 0x83, 0x8D, 0x6B, 0x7B, 0x7A, 0x58, 0x5C, 0xD9, 0xB0, 0x5A, 0x6C,
+    0x5D, 0xDE, 0xCB, 0x16, 0x52, 0x03, 0x2D, 0x7C, 0x00, 0xAA, 0x86, 0x19, 0x6C, 0x1C, 0x54, 0x22,
+    0x3F, 0x1F, 0xCE, 0x60, 0x04, 0xA9, 0xE7, 0xBD, 0xA7, 0x8F, 0x6E, 0x8B, 0xF4, 0x69, 0x0B, 0x05,
+    0x98, 0x9A, 0x24, 0x2C, 0x4C, 0x5D, 0x60, 0xA5, 0x85, 0xA9, 0x23, 0xEB, 0xE1, 0xC4, 0x61, 0x7B,
+    0x98, 0x3A, 0x98, 0x9E, 0x82, 0x95, 0x7D, 0xD8, 0x95, 0x7D, 0x92, 0x93, 0xB8, 0x6C, 0x10, 0x7B,
+    0x08, 0x57, 0x45, 0xBE, 0x83, 0x7B, 0xC7, 0x00, 0x7A, 0x1F, 0xD4, 0x1C, 0xD8, 0x0D, 0x90, 0x9E,
+    0x03, 0xF9, 0x29, 0xA4, 0x03, 0x5C, 0x1D, 0xD0, 0xD2, 0xAD, 0xC8, 0x19, 0xE6, 0xBC, 0x5E, 0xCC,
+    0x0A, 0x80, 0x7B, 0xDD, 0xBA, 0xC8, 0x69, 0x79, 0x08, 0xEC, 0x24, 0x07, 0x36, 0xE4, 0x6D, 0x24,
+    0x28, 0xA7, 0xEB, 0x11, 0x63, 0x36, 0x99, 0x19, 0x11, 0x99, 0xFA, 0x6C, 0x6E, 0x98, 0xD0, 0x70,
+    0x94, 0xC4, 0x34, 0x68, 0x9F, 0x39, 0xCB, 0x84, 0x86, 0x3E, 0x89, 0x2A, 0x68, 0x6F, 0xBC, 0xA5,
+    0x02, 0x4A, 0xDE, 0x37, 0x6E, 0xFA, 0x75, 0x2C, 0xB8, 0x33, 0x02, 0xE5, 0x20, 0xA0, 0x24, 0x7E,
+    0x21, 0xFD, 0x58, 0xF9, 0x2C, 0x89, 0xA9, 0x6F, 0x98, 0x59, 0xC6, 0xDA, 0x9B, 0x24, 0xAA, 0xB6,
+    0xA1, 0xB3, 0x94, 0xDA, 0x1B, 0xC7, 0x8E, 0xAE, 0x6D, 0xB8, 0x4E, 0x24, 0x2A, 0xA7, 0xFC, 0x08,
+    0xC3, 0x26, 0x85, 0x11, 0x1F, 0xAB, 0x73, 0xE5, 0x0D, 0x96, 0x86, 0x26, 0x89, 0x49, 0xD4, 0x5E,
+    0x7B, 0x7B, 0x21, 0xDF, 0x68, 0xAF, 0xE7, 0x16, 0xDB, 0x03, 0x14, 0xEC, 0x24, 0x07, 0x5F, 0xEA,
+    0x3E, 0xEB, 0x9E, 0x19, 0x46, 0x6C, 0x8F, 0xB8, 0x06, 0x23, 0xC6, 0x4B, 0x12, 0x91, 0xAE, 0x10,
+    0xF2, 0xAE, 0x30, 0x4C, 0x28, 0xEC, 0xBF, 0x52, 0xB9, 0xA0, 0xC6, 0x52, 0x2D, 0x89, 0x9D, 0xE4,
+    0x20, 0xC3, 0x86, 0xBC, 0x2D, 0x88, 0x04, 0xA2, 0x72, 0xBA, 0x56, 0x7E, 0xC4, 0x98, 0x0D, 0x36,
+    0x99, 0xF1, 0xC0, 0x88, 0xC8, 0xCD, 0x50, 0xF9, 0x6C, 0x9E, 0xD5, 0x86, 0x09, 0xD7, 0x69, 0x38,
+    0xE2, 0x49, 0x12, 0xD3, 0xA0, 0x5A, 0xED, 0x33, 0x67, 0x6A, 0x4B, 0xC9, 0x16, 0x0D, 0x3D, 0x5D,
+    0x12, 0x55, 0x50, 0xAF, 0xB5, 0x37, 0xDE, 0x0C, 0x96, 0x8A, 0x2A, 0x5E, 0x7C, 0x12, 0x2C, 0x57,
+    0x17, 0xC3, 0x8A, 0xB8, 0xDD, 0x3B, 0xF6, 0xD1, 0x2D, 0x99, 0x17, 0x60, 0x29, 0xC0, 0x92, 0xD7,
+    0xE4, 0x98, 0x33, 0x26, 0x24, 0x27, 0x7E, 0x02, 0x3A, 0x4C, 0x78, 0x4B, 0xC5, 0x8A, 0x4A, 0x42,
+    0x35, 0x9C, 0x48, 0x5B, 0x0D, 0xF9, 0x79, 0xBD, 0xFE, 0xFD, 0x5F,
 };
 
 static const EpdGlyph opendyslexic_10_regularGlyphs[] = {
@@ -1378,7 +1363,7 @@ static const EpdGlyph opendyslexic_10_regularGlyphs[] = {
     { 3, 18, 5, 1, 15, 14, 4582 }, // |
     { 10, 20, 12, 1, 16, 50, 4596 }, // }
     { 8, 5, 10, 1, 16, 10, 4646 }, // ~
-    { 0, 0, 18, 0, 0, 0, 0 }, //  
+    { 0, 0, 18, 0, 0, 0, 4656 }, //  
     { 6, 22, 7, 0, 16, 33, 0 }, // ¡
     { 10, 19, 16, 3, 16, 48, 33 }, // ¢
     { 14, 20, 14, 0, 20, 70, 81 }, // £
@@ -1389,625 +1374,631 @@ static const EpdGlyph opendyslexic_10_regularGlyphs[] = {
     { 10, 4, 11, 1, 16, 10, 318 }, // ¨
     { 9, 8, 11, 1, 19, 18, 328 }, // ©
     { 7, 8, 9, 2, 16, 14, 346 }, // ª
-    { 11, 10, 13, 1, 10, 28, 360 }, // «
-    { 11, 6, 13, 1, 7, 17, 388 }, // ¬
-    { 10, 3, 11, 1, 8, 8, 405 }, // ­
-    { 9, 8, 11, 1, 22, 18, 413 }, // ®
-    { 9, 3, 11, 1, 15, 7, 431 }, // ¯
-    { 10, 10, 11, 1, 17, 25, 438 }, // °
-    { 11, 12, 13, 1, 11, 33, 463 }, // ±
-    { 6, 8, 6, 0, 17, 12, 496 }, // ²
-    { 6, 8, 7, 0, 17, 12, 508 }, // ³
-    { 4, 5, 6, 1, 17, 5, 520 }, // ´
-    { 12, 14, 17, 2, 12, 42, 525 }, // µ
-    { 11, 17, 13, 1, 15, 47, 567 }, // ¶
-    { 4, 4, 5, 1, 9, 4, 614 }, // ·
-    { 5, 6, 7, 1, 1, 8, 618 }, // ¸
-    { 6, 9, 6, 0, 18, 14, 626 }, // ¹
-    { 7, 7, 9, 2, 15, 13, 640 }, // º
-    { 11, 10, 13, 1, 10, 28, 653 }, // »
-    { 18, 20, 23, 3, 19, 90, 681 }, // ¼
-    { 18, 20, 23, 3, 18, 90, 771 }, // ½
-    { 19, 19, 23, 2, 18, 91, 861 }, // ¾
-    { 12, 23, 12, 0, 12, 69, 952 }, // ¿
-    { 17, 24, 24, 3, 24, 102, 1021 }, // À
-    { 17, 27, 24, 3, 27, 115, 1123 }, // Á
-    { 17, 25, 24, 3, 25, 107, 1238 }, // Â
-    { 17, 24, 24, 3, 24, 102, 1345 }, // Ã
-    { 17, 24, 24, 3, 24, 102, 1447 }, // Ä
-    { 17, 25, 24, 3, 25, 107, 1549 }, // Å
-    { 24, 19, 30, 3, 18, 114, 1656 }, // Æ
-    { 14, 24, 21, 3, 19, 84, 1770 }, // Ç
-    { 13, 23, 19, 3, 23, 75, 1854 }, // È
-    { 13, 27, 19, 3, 27, 88, 1929 }, // É
-    { 13, 24, 19, 3, 24, 78, 2017 }, // Ê
-    { 13, 24, 19, 3, 24, 78, 2095 }, // Ë
-    { 7, 25, 10, 0, 25, 44, 2173 }, // Ì
-    { 5, 29, 10, 2, 29, 37, 2217 }, // Í
-    { 9, 26, 10, 0, 26, 59, 2254 }, // Î
-    { 11, 25, 10, -1, 25, 69, 2313 }, // Ï
-    { 19, 18, 23, 1, 18, 86, 2382 }, // Ð
-    { 16, 23, 22, 3, 23, 92, 2468 }, // Ñ
-    { 17, 24, 24, 3, 23, 102, 2560 }, // Ò
-    { 17, 28, 24, 3, 27, 119, 2662 }, // Ó
-    { 17, 25, 24, 3, 24, 107, 2781 }, // Ô
-    { 17, 24, 24, 3, 23, 102, 2888 }, // Õ
-    { 17, 24, 24, 3, 23, 102, 2990 }, // Ö
-    { 10, 6, 12, 1, 8, 15, 3092 }, // ×
-    { 26, 38, 25, -1, 28, 247, 3107 }, // Ø
-    { 15, 25, 22, 3, 24, 94, 3354 }, // Ù
-    { 15, 28, 22, 3, 27, 105, 3448 }, // Ú
-    { 15, 26, 22, 3, 25, 98, 3553 }, // Û
-    { 15, 25, 22, 3, 24, 94, 3651 }, // Ü
-    { 16, 28, 22, 3, 28, 112, 3745 }, // Ý
-    { 10, 17, 12, 1, 17, 43, 3857 }, // Þ
-    { 12, 17, 14, 1, 17, 51, 3900 }, // ß
-    { 12, 17, 17, 2, 17, 51, 3951 }, // à
-    { 12, 21, 17, 2, 21, 63, 4002 }, // á
-    { 12, 18, 17, 2, 18, 54, 4065 }, // â
-    { 12, 17, 17, 2, 17, 51, 4119 }, // ã
-    { 12, 17, 17, 2, 17, 51, 4170 }, // ä
-    { 12, 18, 17, 2, 18, 54, 4221 }, // å
-    { 21, 13, 26, 2, 13, 69, 4275 }, // æ
-    { 10, 18, 16, 3, 13, 45, 4344 }, // ç
-    { 12, 19, 17, 3, 19, 57, 4389 }, // è
-    { 12, 23, 17, 3, 23, 69, 4446 }, // é
-    { 12, 20, 17, 3, 20, 60, 4515 }, // ê
-    { 12, 20, 17, 3, 20, 60, 4575 }, // ë
-    { 7, 17, 9, 0, 17, 30, 4635 }, // ì
-    { 4, 21, 9, 3, 21, 21, 4665 }, // í
-    { 9, 18, 9, 0, 18, 41, 4686 }, // î
-    { 11, 18, 9, -1, 18, 50, 4727 }, // ï
-    { 16, 17, 17, 1, 17, 68, 4777 }, // ð
-    { 11, 18, 17, 3, 18, 50, 4845 }, // ñ
-    { 12, 19, 17, 3, 19, 57, 4895 }, // ò
-    { 12, 23, 17, 3, 23, 69, 4952 }, // ó
-    { 12, 20, 17, 3, 20, 60, 5021 }, // ô
-    { 12, 19, 17, 3, 19, 57, 5081 }, // õ
-    { 12, 19, 17, 3, 19, 57, 5138 }, // ö
-    { 14, 13, 16, 1, 13, 46, 5195 }, // ÷
-    { 13, 33, 17, 2, 22, 108, 5241 }, // ø
-    { 11, 18, 17, 3, 18, 50, 5349 }, // ù
-    { 11, 22, 17, 3, 22, 61, 5399 }, // ú
-    { 11, 18, 17, 3, 18, 50, 5460 }, // û
-    { 11, 18, 17, 3, 18, 50, 5510 }, // ü
-    { 12, 29, 17, 3, 23, 87, 5560 }, // ý
-    { 10, 21, 12, 1, 17, 53, 5647 }, // þ
-    { 12, 26, 17, 3, 20, 78, 5700 }, // ÿ
-    { 17, 23, 24, 3, 23, 98, 0 }, // Ā
-    { 12, 16, 17, 2, 16, 48, 98 }, // ā
-    { 17, 26, 24, 3, 26, 111, 146 }, // Ă
-    { 12, 19, 17, 2, 19, 57, 257 }, // ă
-    { 17, 23, 24, 3, 18, 98, 314 }, // Ą
-    { 13, 17, 17, 2, 13, 56, 412 }, // ą
-    { 14, 29, 21, 3, 28, 102, 468 }, // Ć
-    { 10, 21, 16, 3, 20, 53, 570 }, // ć
-    { 14, 27, 21, 3, 26, 95, 623 }, // Ĉ
-    { 10, 19, 16, 3, 18, 48, 718 }, // ĉ
-    { 14, 27, 21, 3, 26, 95, 766 }, // Ċ
-    { 10, 20, 16, 3, 19, 50, 861 }, // ċ
-    { 14, 28, 21, 3, 27, 98, 911 }, // Č
-    { 10, 21, 16, 3, 20, 53, 1009 }, // č
-    { 17, 26, 23, 3, 26, 111, 1062 }, // Ď
-    { 17, 19, 18, 2, 18, 81, 1173 }, // ď
-    { 19, 18, 23, 1, 18, 86, 1254 }, // Đ
-    { 16, 19, 18, 2, 18, 76, 1340 }, // đ
-    { 13, 23, 19, 3, 23, 75, 1416 }, // Ē
-    { 12, 19, 17, 3, 19, 57, 1491 }, // ē
-    { 13, 26, 19, 3, 26, 85, 1548 }, // Ĕ
-    { 12, 22, 17, 3, 22, 66, 1633 }, // ĕ
-    { 13, 25, 19, 3, 25, 82, 1699 }, // Ė
-    { 12, 21, 17, 3, 21, 63, 1781 }, // ė
-    { 13, 23, 19, 3, 18, 75, 1844 }, // Ę
-    { 12, 19, 17, 3, 13, 57, 1919 }, // ę
-    { 13, 25, 19, 3, 25, 82, 1976 }, // Ě
-    { 12, 22, 17, 3, 22, 66, 2058 }, // ě
-    { 17, 24, 24, 3, 24, 102, 2124 }, // Ĝ
-    { 11, 23, 17, 3, 18, 64, 2226 }, // ĝ
-    { 17, 26, 24, 3, 26, 111, 2290 }, // Ğ
-    { 11, 25, 17, 3, 20, 69, 2401 }, // ğ
-    { 17, 25, 24, 3, 25, 107, 2470 }, // Ġ
-    { 11, 24, 17, 3, 19, 66, 2577 }, // ġ
-    { 17, 28, 24, 3, 19, 119, 2643 }, // Ģ
-    { 11, 25, 17, 3, 20, 69, 2762 }, // ģ
-    { 16, 24, 22, 3, 24, 96, 2831 }, // Ĥ
-    { 13, 23, 17, 1, 23, 75, 2927 }, // ĥ
-    { 17, 18, 22, 2, 18, 77, 3002 }, // Ħ
-    { 14, 18, 17, 0, 18, 63, 3079 }, // ħ
-    { 8, 26, 10, 0, 26, 52, 3142 }, // Ĩ
-    { 8, 18, 9, 1, 18, 36, 3194 }, // ĩ
-    { 11, 24, 10, -1, 24, 66, 3230 }, // Ī
-    { 10, 17, 9, 0, 17, 43, 3296 }, // ī
-    { 5, 23, 13, 5, 18, 29, 3339 }, // Į
-    { 5, 23, 9, 2, 18, 29, 3368 }, // į
-    { 5, 26, 10, 2, 26, 33, 3397 }, // İ
-    { 4, 12, 9, 3, 12, 12, 3430 }, // ı
-    { 14, 23, 19, 2, 18, 81, 3442 }, // Ĳ
-    { 15, 24, 9, 3, 18, 90, 3523 }, // ĳ
-    { 10, 27, 16, 3, 22, 68, 3613 }, // Ĵ
-    { 11, 23, 13, 3, 17, 64, 3681 }, // ĵ
-    { 15, 25, 21, 3, 18, 94, 3745 }, // Ķ
-    { 11, 26, 17, 3, 17, 72, 3839 }, // ķ
-    { 9, 12, 13, 2, 12, 27, 3911 }, // ĸ
-    { 12, 25, 19, 3, 25, 75, 3938 }, // Ĺ
-    { 7, 25, 11, 2, 25, 44, 4013 }, // ĺ
-    { 12, 27, 19, 3, 18, 81, 4057 }, // Ļ
-    { 7, 25, 11, 2, 17, 44, 4138 }, // ļ
-    { 12, 18, 19, 3, 18, 54, 4182 }, // Ľ
-    { 9, 18, 11, 2, 18, 41, 4236 }, // ľ
-    { 12, 18, 19, 3, 18, 54, 4277 }, // Ŀ
-    { 10, 17, 11, 2, 17, 43, 4331 }, // ŀ
-    { 20, 29, 19, -5, 23, 145, 4374 }, // Ł
-    { 14, 17, 11, -4, 17, 60, 4519 }, // ł
-    { 16, 25, 22, 3, 25, 100, 4579 }, // Ń
-    { 11, 20, 17, 3, 20, 55, 4679 }, // ń
-    { 16, 25, 22, 3, 18, 100, 4734 }, // Ņ
-    { 11, 19, 17, 3, 12, 53, 4834 }, // ņ
-    { 16, 25, 22, 3, 25, 100, 4887 }, // Ň
-    { 11, 20, 17, 3, 20, 55, 4987 }, // ň
-    { 12, 22, 14, 1, 22, 66, 5042 }, // ŉ
-    { 16, 22, 22, 3, 18, 88, 5108 }, // Ŋ
-    { 11, 16, 17, 3, 12, 44, 5196 }, // ŋ
-    { 17, 23, 24, 3, 22, 98, 5240 }, // Ō
-    { 12, 18, 17, 3, 18, 54, 5338 }, // ō
-    { 17, 27, 24, 3, 26, 115, 5392 }, // Ŏ
-    { 12, 22, 17, 3, 22, 66, 5507 }, // ŏ
-    { 18, 25, 24, 3, 24, 113, 5573 }, // Ő
-    { 16, 20, 17, 1, 20, 80, 5686 }, // ő
-    { 24, 19, 25, 3, 19, 114, 5766 }, // Œ
-    { 20, 13, 22, 3, 13, 65, 5880 }, // œ
-    { 14, 25, 20, 3, 25, 88, 5945 }, // Ŕ
-    { 8, 18, 14, 3, 18, 36, 6033 }, // ŕ
-    { 14, 28, 20, 3, 18, 98, 6069 }, // Ŗ
-    { 9, 23, 14, 2, 12, 52, 6167 }, // ŗ
-    { 14, 25, 20, 3, 25, 88, 6219 }, // Ř
-    { 10, 18, 14, 1, 18, 45, 6307 }, // ř
-    { 17, 28, 23, 3, 27, 119, 6352 }, // Ś
-    { 10, 20, 16, 3, 20, 50, 6471 }, // ś
-    { 17, 26, 23, 3, 25, 111, 6521 }, // Ŝ
-    { 10, 18, 16, 3, 18, 45, 6632 }, // ŝ
-    { 17, 23, 23, 3, 18, 98, 6677 }, // Ş
-    { 10, 18, 16, 3, 12, 45, 6775 }, // ş
-    { 17, 27, 23, 3, 26, 115, 6820 }, // Š
-    { 10, 20, 16, 3, 20, 50, 6935 }, // š
-    { 16, 22, 22, 3, 18, 88, 6985 }, // Ţ
-    { 9, 20, 15, 3, 16, 45, 7073 }, // ţ
-    { 16, 24, 22, 3, 24, 96, 7118 }, // Ť
-    { 10, 18, 15, 3, 18, 45, 7214 }, // ť
-    { 16, 18, 22, 3, 18, 72, 7259 }, // Ŧ
-    { 10, 16, 15, 2, 16, 40, 7331 }, // ŧ
-    { 15, 26, 22, 3, 25, 98, 7371 }, // Ũ
-    { 11, 19, 17, 3, 19, 53, 7469 }, // ũ
-    { 15, 24, 22, 3, 23, 90, 7522 }, // Ū
-    { 11, 17, 17, 3, 17, 47, 7612 }, // ū
-    { 15, 28, 22, 3, 27, 105, 7659 }, // Ŭ
-    { 11, 20, 17, 3, 20, 55, 7764 }, // ŭ
-    { 15, 27, 22, 3, 26, 102, 7819 }, // Ů
-    { 11, 20, 17, 3, 20, 55, 7921 }, // ů
-    { 17, 26, 22, 3, 25, 111, 7976 }, // Ű
-    { 16, 19, 17, 1, 19, 76, 8087 }, // ű
-    { 15, 23, 22, 3, 18, 87, 8163 }, // Ų
-    { 11, 17, 17, 3, 12, 47, 8250 }, // ų
-    { 23, 24, 30, 3, 24, 138, 8297 }, // Ŵ
-    { 16, 19, 22, 3, 19, 76, 8435 }, // ŵ
-    { 16, 25, 22, 3, 25, 100, 8511 }, // Ŷ
-    { 12, 26, 17, 3, 20, 78, 8611 }, // ŷ
-    { 16, 25, 22, 3, 25, 100, 8689 }, // Ÿ
-    { 17, 25, 24, 3, 25, 107, 8789 }, // Ź
-    { 11, 20, 17, 3, 20, 55, 8896 }, // ź
-    { 17, 24, 24, 3, 24, 102, 8951 }, // Ż
-    { 11, 19, 17, 3, 19, 53, 9053 }, // ż
-    { 17, 25, 24, 3, 25, 107, 9106 }, // Ž
-    { 11, 20, 17, 3, 20, 55, 9213 }, // ž
-    { 7, 17, 11, 3, 17, 30, 9268 }, // ſ
-    { 7, 4, 0, 1, 16, 7, 0 }, // ̀
-    { 4, 5, 0, 1, 17, 5, 7 }, // ́
-    { 9, 5, 0, 1, 1, 12, 12 }, // ̂
-    { 8, 5, 0, 1, 16, 10, 24 }, // ̃
-    { 11, 3, 0, 1, 14, 9, 34 }, // ̄
-    { 14, 3, 0, 1, 18, 11, 43 }, // ̅
-    { 9, 5, 0, 1, 16, 12, 54 }, // ̆
-    { 4, 4, 0, 1, 16, 4, 66 }, // ̇
-    { 10, 4, 0, 1, 16, 10, 70 }, // ̈
-    { 5, 4, 0, 0, 13, 5, 80 }, // ̉
-    { 5, 5, 0, 1, 16, 7, 85 }, // ̊
-    { 15, 4, 0, 1, 16, 15, 92 }, // ̋
-    { 9, 5, 0, 1, 16, 12, 107 }, // ̌
-    { 15, 4, 0, -4, 17, 15, 119 }, // ̏
-    { 6, 6, 0, 0, 16, 9, 134 }, // ̒
-    { 5, 6, 0, 1, 15, 8, 143 }, // ̓
-    { 6, 6, 0, 0, 15, 9, 151 }, // ̔
-    { 4, 5, 0, 1, -1, 5, 160 }, // ̘
-    { 4, 5, 0, 1, -1, 5, 165 }, // ̙
-    { 9, 5, 0, 1, 17, 12, 170 }, // ̚
-    { 4, 5, 0, 1, 13, 5, 182 }, // ̛
-    { 3, 5, 0, 1, -1, 4, 187 }, // ̜
-    { 5, 4, 0, 1, 3, 5, 191 }, // ̝
-    { 5, 4, 0, 1, 0, 5, 196 }, // ̞
-    { 5, 5, 0, 1, -2, 7, 201 }, // ̟
-    { 10, 3, 0, 1, -3, 8, 208 }, // ̠
-    { 4, 4, 0, 1, 1, 4, 216 }, // ̣
-    { 10, 4, 0, 1, 0, 10, 220 }, // ̤
-    { 5, 5, 0, 1, 16, 7, 230 }, // ̥
-    { 5, 6, 0, 1, 3, 8, 237 }, // ̦
-    { 5, 6, 0, 1, 1, 8, 245 }, // ̧
-    { 5, 6, 0, 1, 1, 8, 253 }, // ̨
-    { 3, 6, 0, 1, -1, 5, 261 }, // ̩
-    { 7, 4, 0, 1, -1, 7, 266 }, // ̪
-    { 9, 5, 0, 1, 0, 12, 273 }, // ̬
-    { 9, 5, 0, 1, -1, 12, 285 }, // ̭
-    { 8, 5, 0, 1, 16, 10, 297 }, // ̰
-    { 9, 3, 0, 1, 15, 7, 307 }, // ̱
-    { 9, 3, 0, 1, -1, 7, 314 }, // ̲
-    { 8, 5, 0, 1, 16, 10, 321 }, // ̴
-    { 10, 3, 0, 1, 8, 8, 331 }, // ̵
-    { 3, 5, 0, 1, -1, 4, 339 }, // ̹
-    { 7, 4, 0, 1, -1, 7, 343 }, // ̺
-    { 7, 5, 0, 1, 0, 9, 350 }, // ̻
-    { 7, 4, 0, 1, 0, 7, 359 }, // ̼
-    { 5, 5, 0, 2, 16, 7, 366 }, // ̽
-    { 8, 5, 0, 1, 16, 10, 373 }, // ͂
-    { 3, 4, 0, 1, 17, 3, 383 }, // ̓
-    { 10, 10, 0, 1, 22, 25, 386 }, // ̈́
-    { 7, 4, 0, 1, 16, 7, 411 }, // ͆
-    { 10, 8, 0, 1, 0, 20, 418 }, // ͇
-    { 8, 6, 0, 1, 0, 12, 438 }, // ͈
-    { 7, 6, 0, 1, -1, 11, 450 }, // ͉
-    { 8, 12, 0, 1, 20, 24, 461 }, // ͊
-    { 17, 9, 0, 1, 19, 39, 485 }, // ͋
-    { 12, 11, 0, 2, 12, 33, 524 }, // ͌
-    { 10, 5, 0, 2, -2, 13, 557 }, // ͍
-    { 4, 3, 0, 1, 2, 3, 570 }, // ͎
-    { 17, 4, 0, 1, 0, 17, 573 }, // ͜
-    { 17, 4, 0, 1, 16, 17, 590 }, // ͡
-    { 21, 5, 0, 1, -1, 27, 607 }, // ͢
-    { 11, 21, 13, 1, 21, 58, 0 }, // Ѐ
-    { 11, 20, 13, 1, 20, 55, 58 }, // Ё
-    { 17, 17, 21, 2, 17, 73, 113 }, // Ђ
-    { 11, 24, 14, 1, 24, 66, 186 }, // Ѓ
-    { 15, 17, 19, 2, 16, 64, 252 }, // Є
-    { 17, 19, 23, 3, 18, 81, 316 }, // Ѕ
-    { 5, 18, 10, 2, 18, 23, 397 }, // І
-    { 10, 25, 10, -1, 25, 63, 420 }, // Ї
-    { 9, 24, 16, 3, 19, 54, 483 }, // Ј
-    { 21, 16, 24, 2, 15, 84, 537 }, // Љ
-    { 20, 16, 23, 2, 16, 80, 621 }, // Њ
-    { 18, 18, 22, 3, 18, 81, 701 }, // Ћ
-    { 15, 25, 21, 3, 25, 94, 782 }, // Ќ
-    { 16, 24, 22, 3, 24, 96, 876 }, // Ѝ
-    { 12, 25, 14, 1, 24, 75, 972 }, // Ў
-    { 13, 19, 15, 1, 15, 62, 1047 }, // Џ
-    { 17, 18, 24, 3, 18, 77, 1109 }, // А
-    { 11, 15, 14, 1, 15, 42, 1186 }, // Б
-    { 12, 15, 14, 1, 15, 45, 1228 }, // В
-    { 11, 15, 14, 1, 15, 42, 1273 }, // Г
-    { 15, 18, 17, 1, 15, 68, 1315 }, // Д
-    { 11, 15, 13, 1, 15, 42, 1383 }, // Е
-    { 23, 18, 30, 3, 18, 104, 1425 }, // Ж
-    { 11, 16, 13, 1, 16, 44, 1529 }, // З
-    { 16, 18, 22, 3, 18, 72, 1573 }, // И
-    { 16, 26, 22, 3, 26, 104, 1645 }, // Й
-    { 15, 18, 21, 3, 18, 68, 1749 }, // К
-    { 12, 16, 16, 2, 15, 48, 1817 }, // Л
-    { 15, 15, 18, 1, 15, 57, 1865 }, // М
-    { 16, 18, 22, 3, 18, 72, 1922 }, // Н
-    { 17, 19, 24, 3, 18, 81, 1994 }, // О
-    { 12, 16, 14, 1, 16, 48, 2075 }, // П
-    { 13, 18, 19, 3, 18, 59, 2123 }, // Р
-    { 14, 20, 21, 3, 19, 70, 2182 }, // С
-    { 16, 18, 22, 3, 18, 72, 2252 }, // Т
-    { 12, 18, 14, 1, 17, 54, 2324 }, // У
-    { 16, 16, 18, 1, 16, 64, 2378 }, // Ф
-    { 17, 18, 24, 3, 18, 77, 2442 }, // Х
-    { 13, 19, 15, 1, 16, 62, 2519 }, // Ц
-    { 12, 16, 14, 1, 16, 48, 2581 }, // Ч
-    { 15, 16, 17, 1, 16, 60, 2629 }, // Ш
-    { 17, 20, 19, 1, 16, 85, 2689 }, // Щ
-    { 14, 16, 14, -2, 16, 56, 2774 }, // Ъ
-    { 19, 16, 23, 2, 16, 76, 2830 }, // Ы
-    { 10, 16, 14, 2, 16, 40, 2906 }, // Ь
-    { 15, 17, 19, 2, 16, 64, 2946 }, // Э
-    { 17, 16, 21, 2, 16, 68, 3010 }, // Ю
-    { 14, 18, 20, 3, 18, 63, 3078 }, // Я
-    { 12, 13, 17, 2, 13, 39, 3141 }, // а
-    { 12, 16, 15, 1, 16, 48, 3180 }, // б
-    { 11, 13, 15, 2, 13, 36, 3228 }, // в
-    { 10, 12, 12, 1, 12, 30, 3264 }, // г
-    { 14, 14, 16, 1, 12, 49, 3294 }, // д
-    { 12, 13, 17, 3, 13, 39, 3343 }, // е
-    { 19, 15, 25, 3, 15, 72, 3382 }, // ж
-    { 8, 11, 9, 1, 11, 22, 3454 }, // з
-    { 12, 12, 14, 1, 12, 36, 3476 }, // и
-    { 12, 16, 14, 1, 16, 48, 3512 }, // й
-    { 11, 13, 17, 3, 13, 36, 3560 }, // к
-    { 9, 12, 11, 1, 11, 27, 3596 }, // л
-    { 15, 14, 19, 2, 14, 53, 3623 }, // м
-    { 13, 13, 19, 3, 13, 43, 3676 }, // н
-    { 12, 12, 14, 1, 12, 36, 3719 }, // о
-    { 12, 12, 14, 1, 12, 36, 3755 }, // п
-    { 13, 18, 17, 2, 12, 59, 3791 }, // р
-    { 10, 14, 16, 3, 13, 35, 3850 }, // с
-    { 12, 12, 14, 1, 12, 36, 3885 }, // т
-    { 12, 18, 17, 3, 12, 54, 3921 }, // у
-    { 16, 17, 18, 1, 12, 68, 3975 }, // ф
-    { 13, 12, 15, 1, 12, 39, 4043 }, // х
-    { 13, 15, 15, 1, 12, 49, 4082 }, // ц
-    { 8, 11, 9, 1, 11, 22, 4131 }, // ч
-    { 15, 12, 17, 1, 12, 45, 4153 }, // ш
-    { 16, 16, 19, 1, 12, 64, 4198 }, // щ
-    { 13, 11, 16, 1, 11, 36, 4262 }, // ъ
-    { 15, 12, 17, 1, 12, 45, 4298 }, // ы
-    { 10, 12, 13, 1, 12, 30, 4343 }, // ь
-    { 11, 12, 13, 1, 12, 33, 4373 }, // э
-    { 14, 13, 17, 1, 13, 46, 4406 }, // ю
-    { 11, 11, 13, 1, 11, 31, 4452 }, // я
-    { 12, 20, 17, 3, 20, 60, 4483 }, // ѐ
-    { 12, 17, 14, 1, 16, 51, 4543 }, // ё
-    { 15, 21, 17, 0, 18, 79, 4594 }, // ђ
-    { 10, 18, 12, 1, 18, 45, 4673 }, // ѓ
-    { 11, 12, 13, 1, 11, 33, 4718 }, // є
-    { 10, 12, 16, 3, 12, 30, 4751 }, // ѕ
-    { 4, 18, 9, 3, 18, 18, 4781 }, // і
-    { 11, 18, 9, -1, 18, 50, 4799 }, // ї
-    { 8, 24, 13, 3, 18, 48, 4849 }, // ј
-    { 15, 12, 17, 1, 11, 45, 4897 }, // љ
-    { 14, 11, 16, 1, 11, 39, 4942 }, // њ
-    { 14, 18, 17, 0, 18, 63, 4981 }, // ћ
-    { 11, 19, 17, 3, 19, 53, 5044 }, // ќ
-    { 12, 17, 14, 1, 17, 51, 5097 }, // ѝ
-    { 12, 27, 17, 3, 21, 81, 5148 }, // ў
-    { 9, 14, 11, 1, 11, 32, 5229 }, // џ
-    { 12, 17, 17, 3, 16, 51, 5261 }, // Ѣ
-    { 13, 16, 15, 1, 15, 52, 5312 }, // ѣ
-    { 17, 15, 21, 2, 15, 64, 5364 }, // Ѫ
-    { 12, 11, 15, 1, 11, 33, 5428 }, // ѫ
-    { 16, 19, 22, 3, 19, 76, 5461 }, // Ѳ
-    { 13, 15, 17, 2, 15, 49, 5537 }, // ѳ
-    { 22, 23, 24, 3, 23, 127, 5586 }, // Ѵ
-    { 14, 15, 17, 2, 15, 53, 5713 }, // ѵ
-    { 8, 6, 0, 1, 19, 12, 5766 }, // ҆
-    { 11, 17, 14, 1, 17, 47, 5778 }, // Ґ
-    { 10, 14, 12, 1, 14, 35, 5825 }, // ґ
-    { 12, 15, 14, 0, 15, 45, 5860 }, // Ғ
-    { 9, 11, 9, 0, 11, 25, 5905 }, // ғ
-    { 13, 17, 14, 1, 17, 56, 5930 }, // Ҕ
-    { 7, 11, 9, 1, 11, 20, 5986 }, // ҕ
-    { 23, 21, 27, 2, 18, 121, 6006 }, // Җ
-    { 16, 15, 18, 1, 13, 60, 6127 }, // җ
-    { 11, 18, 15, 2, 16, 50, 6187 }, // Ҙ
-    { 8, 16, 9, 1, 11, 32, 6237 }, // ҙ
-    { 14, 21, 18, 2, 18, 74, 6269 }, // Қ
-    { 10, 15, 13, 1, 13, 38, 6343 }, // қ
-    { 16, 16, 20, 2, 16, 64, 6381 }, // Ҝ
-    { 13, 11, 15, 1, 11, 36, 6445 }, // ҝ
-    { 15, 18, 21, 3, 18, 68, 6481 }, // Ҟ
-    { 14, 17, 17, 0, 17, 60, 6549 }, // ҟ
-    { 20, 18, 21, -2, 18, 90, 6609 }, // Ҡ
-    { 13, 13, 15, -1, 13, 43, 6699 }, // ҡ
-    { 16, 21, 19, 2, 18, 84, 6742 }, // Ң
-    { 12, 15, 13, 1, 13, 45, 6826 }, // ң
-    { 22, 19, 22, 3, 19, 105, 6871 }, // Ҥ
-    { 15, 12, 15, 2, 12, 45, 6976 }, // ҥ
-    { 20, 17, 25, 2, 17, 85, 7021 }, // Ҧ
-    { 20, 20, 22, 1, 14, 100, 7106 }, // ҧ
-    { 21, 18, 25, 2, 17, 95, 7206 }, // Ҩ
-    { 17, 15, 19, 1, 14, 64, 7301 }, // ҩ
-    { 14, 23, 21, 3, 19, 81, 7365 }, // Ҫ
-    { 10, 16, 16, 3, 13, 40, 7446 }, // ҫ
-    { 16, 20, 20, 2, 18, 80, 7486 }, // Ҭ
-    { 11, 14, 13, 1, 12, 39, 7566 }, // ҭ
-    { 16, 18, 22, 3, 18, 72, 7605 }, // Ү
-    { 12, 15, 14, 1, 11, 45, 7677 }, // ү
-    { 16, 18, 22, 3, 18, 72, 7722 }, // Ұ
-    { 12, 16, 14, 1, 11, 48, 7794 }, // ұ
-    { 17, 21, 21, 2, 18, 90, 7842 }, // Ҳ
-    { 12, 15, 14, 1, 13, 45, 7932 }, // ҳ
-    { 18, 19, 22, 2, 15, 86, 7977 }, // Ҵ
-    { 14, 14, 16, 1, 11, 49, 8063 }, // ҵ
-    { 14, 20, 17, 1, 15, 70, 8112 }, // Ҷ
-    { 10, 15, 12, 1, 11, 38, 8182 }, // ҷ
-    { 13, 15, 15, 1, 15, 49, 8220 }, // Ҹ
-    { 9, 11, 10, 1, 11, 25, 8269 }, // ҹ
-    { 12, 17, 16, 2, 17, 51, 8294 }, // Һ
-    { 11, 18, 17, 3, 18, 50, 8345 }, // һ
-    { 18, 17, 20, 0, 16, 77, 8395 }, // Ҽ
-    { 13, 12, 15, 0, 12, 39, 8472 }, // ҽ
-    { 19, 19, 23, 2, 16, 91, 8511 }, // Ҿ
-    { 14, 14, 16, 1, 12, 49, 8602 }, // ҿ
-    { 5, 18, 10, 2, 18, 23, 8651 }, // Ӏ
-    { 23, 26, 30, 3, 26, 150, 8674 }, // Ӂ
-    { 19, 23, 25, 3, 23, 110, 8824 }, // ӂ
-    { 12, 21, 16, 2, 16, 63, 8934 }, // Ӄ
-    { 9, 15, 11, 1, 11, 34, 8997 }, // ӄ
-    { 14, 18, 16, 2, 15, 63, 9031 }, // Ӆ
-    { 10, 14, 11, 1, 11, 35, 9094 }, // ӆ
-    { 17, 23, 22, 3, 18, 98, 9129 }, // Ӈ
-    { 12, 17, 15, 2, 13, 51, 9227 }, // ӈ
-    { 17, 24, 22, 3, 18, 102, 9278 }, // Ӊ
-    { 12, 17, 15, 2, 13, 51, 9380 }, // ӊ
-    { 12, 19, 14, 0, 15, 57, 9431 }, // Ӌ
-    { 8, 14, 10, 1, 11, 28, 9488 }, // ӌ
-    { 21, 24, 26, 3, 18, 126, 9516 }, // Ӎ
-    { 14, 17, 18, 2, 13, 60, 9642 }, // ӎ
-    { 4, 15, 6, 1, 15, 15, 9702 }, // ӏ
-    { 17, 26, 24, 3, 26, 111, 9717 }, // Ӑ
-    { 12, 20, 17, 2, 20, 60, 9828 }, // ӑ
-    { 17, 24, 24, 3, 24, 102, 9888 }, // Ӓ
-    { 12, 18, 17, 2, 18, 54, 9990 }, // ӓ
-    { 24, 19, 30, 3, 18, 114, 10044 }, // Ӕ
-    { 21, 13, 26, 2, 13, 69, 10158 }, // ӕ
-    { 11, 23, 13, 1, 23, 64, 10227 }, // Ӗ
-    { 12, 21, 17, 3, 21, 63, 10291 }, // ӗ
-    { 12, 13, 17, 3, 12, 39, 10354 }, // Ә
-    { 12, 14, 17, 3, 13, 42, 10393 }, // ә
-    { 12, 22, 17, 3, 21, 66, 10435 }, // Ӛ
-    { 12, 15, 17, 3, 13, 45, 10501 }, // ӛ
-    { 23, 24, 27, 3, 24, 138, 10546 }, // Ӝ
-    { 19, 21, 25, 3, 21, 100, 10684 }, // ӝ
-    { 11, 22, 13, 1, 22, 61, 10784 }, // Ӟ
-    { 10, 17, 9, 1, 17, 43, 10845 }, // ӟ
-    { 11, 16, 12, 1, 15, 44, 10888 }, // Ӡ
-    { 11, 16, 12, 1, 11, 44, 10932 }, // ӡ
-    { 16, 22, 22, 3, 22, 88, 10976 }, // Ӣ
-    { 12, 16, 14, 1, 16, 48, 11064 }, // ӣ
-    { 16, 24, 22, 3, 24, 96, 11112 }, // Ӥ
-    { 12, 17, 14, 1, 17, 51, 11208 }, // ӥ
-    { 17, 25, 24, 3, 24, 107, 11259 }, // Ӧ
-    { 12, 18, 14, 1, 18, 54, 11366 }, // ӧ
-    { 15, 16, 22, 4, 15, 60, 11420 }, // Ө
-    { 12, 12, 17, 3, 12, 36, 11480 }, // ө
-    { 15, 25, 22, 4, 24, 94, 11516 }, // Ӫ
-    { 12, 20, 17, 3, 20, 60, 11610 }, // ӫ
-    { 15, 23, 19, 2, 22, 87, 11670 }, // Ӭ
-    { 11, 17, 13, 1, 17, 47, 11757 }, // ӭ
-    { 12, 22, 14, 1, 21, 66, 11804 }, // Ӯ
-    { 12, 25, 17, 3, 19, 75, 11870 }, // ӯ
-    { 12, 23, 14, 1, 22, 69, 11945 }, // Ӱ
-    { 12, 26, 17, 3, 20, 78, 12014 }, // ӱ
-    { 16, 24, 14, 0, 23, 96, 12092 }, // Ӳ
-    { 16, 26, 17, 2, 20, 104, 12188 }, // ӳ
-    { 12, 22, 14, 1, 22, 66, 12292 }, // Ӵ
-    { 10, 17, 9, -1, 17, 43, 12358 }, // ӵ
-    { 11, 18, 14, 1, 15, 50, 12401 }, // Ӷ
-    { 8, 13, 9, 1, 11, 26, 12451 }, // ӷ
-    { 19, 23, 23, 2, 23, 110, 12477 }, // Ӹ
-    { 15, 19, 17, 1, 19, 72, 12587 }, // ӹ
-    { 21, 20, 24, 3, 18, 105, 12659 }, // Ӽ
-    { 14, 15, 16, 2, 13, 53, 12764 }, // ӽ
-    { 0, 0, 17, 0, 0, 0, 0 }, //  
-    { 0, 0, 28, 0, 0, 0, 0 }, //  
-    { 0, 0, 17, 0, 0, 0, 0 }, //  
-    { 0, 0, 28, 0, 0, 0, 0 }, //  
-    { 0, 0, 14, 0, 0, 0, 0 }, //  
-    { 0, 0, 12, 0, 0, 0, 0 }, //  
-    { 0, 0, 10, 0, 0, 0, 0 }, //  
-    { 0, 0, 14, 0, 0, 0, 0 }, //  
-    { 0, 0, 5, 0, 0, 0, 0 }, //  
-    { 0, 0, 11, 0, 0, 0, 0 }, //  
-    { 0, 0, 10, 0, 0, 0, 0 }, //  
-    { 0, 0, 7, 0, 0, 0, 0 }, // ​
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‍
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‎
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‏
-    { 10, 3, 11, 1, 8, 8, 0 }, // ‐
-    { 10, 3, 11, 1, 8, 8, 8 }, // ‑
-    { 15, 3, 16, 1, 8, 12, 16 }, // ‒
-    { 14, 3, 17, 1, 8, 11, 28 }, // –
-    { 21, 3, 23, 1, 8, 16, 39 }, // —
-    { 21, 3, 23, 1, 8, 16, 55 }, // ―
-    { 9, 18, 11, 1, 15, 41, 71 }, // ‖
-    { 16, 8, 16, 1, -1, 32, 112 }, // ‗
-    { 5, 6, 7, 1, 18, 8, 144 }, // ‘
-    { 5, 6, 7, 1, 18, 8, 152 }, // ’
-    { 5, 6, 7, 1, 3, 8, 160 }, // ‚
-    { 5, 6, 7, 1, 18, 8, 168 }, // ‛
-    { 10, 6, 12, 1, 18, 15, 176 }, // “
-    { 10, 6, 12, 1, 18, 15, 191 }, // ”
-    { 5, 6, 7, 1, 3, 8, 206 }, // „
-    { 10, 6, 12, 1, 18, 15, 214 }, // ‟
-    { 12, 28, 12, 0, 22, 84, 229 }, // †
-    { 11, 28, 13, 1, 22, 77, 313 }, // ‡
-    { 13, 12, 11, -1, 14, 39, 390 }, // •
-    { 6, 7, 8, 1, 9, 11, 429 }, // ‣
-    { 4, 4, 5, 1, 4, 4, 440 }, // ․
-    { 4, 4, 5, 1, 4, 4, 444 }, // ‥
-    { 18, 4, 20, 1, 4, 18, 448 }, // …
-    { 3, 3, 5, 1, 8, 3, 466 }, // ‧
-    { 0, 0, 26, 0, 0, 0, 469 }, //  
-    { 13, 18, 23, 5, 16, 59, 469 }, // ‰
-    { 5, 6, 7, 1, 18, 8, 528 }, // ′
-    { 10, 6, 12, 1, 18, 15, 536 }, // ″
-    { 16, 7, 18, 1, 18, 28, 551 }, // ‴
-    { 5, 6, 7, 1, 17, 8, 579 }, // ‵
-    { 10, 6, 11, 0, 17, 15, 587 }, // ‶
-    { 16, 7, 18, 1, 18, 28, 602 }, // ‷
-    { 9, 4, 12, 1, 17, 9, 630 }, // ‸
-    { 7, 10, 9, 1, 11, 18, 639 }, // ‹
-    { 7, 10, 9, 1, 11, 18, 657 }, // ›
-    { 22, 21, 28, 4, 19, 116, 675 }, // ※
-    { 6, 21, 7, 0, 21, 32, 791 }, // ‼
-    { 11, 26, 16, 2, 25, 72, 823 }, // ‽
-    { 10, 3, 11, 1, 17, 8, 895 }, // ‾
-    { 9, 4, 12, 1, 14, 9, 903 }, // ‿
-    { 14, 14, 17, 1, 19, 49, 912 }, // ⁂
-    { 13, 17, 23, 5, 16, 56, 961 }, // ⁄
-    { 23, 24, 26, 2, 24, 138, 1017 }, // ⁇
-    { 16, 23, 21, 2, 23, 92, 1155 }, // ⁈
-    { 17, 25, 17, 0, 23, 107, 1247 }, // ⁉
-    { 12, 33, 15, 2, 23, 99, 1354 }, // ⁒
-    { 0, 0, 100, 0, 0, 0, 1453 }, //  
-    { 6, 8, 7, 0, 17, 12, 0 }, // ⁰
-    { 6, 9, 7, 0, 18, 14, 12 }, // ⁴
-    { 6, 9, 7, 0, 18, 14, 26 }, // ⁵
-    { 6, 8, 7, 0, 17, 12, 40 }, // ⁶
-    { 7, 9, 7, 0, 18, 16, 52 }, // ⁷
-    { 7, 8, 7, 0, 17, 14, 68 }, // ⁸
-    { 7, 8, 7, 0, 17, 14, 82 }, // ⁹
-    { 11, 12, 17, 3, 12, 33, 96 }, // ⁿ
-    { 8, 11, 9, 1, 11, 22, 129 }, // ₀
-    { 6, 9, 6, 0, 5, 14, 151 }, // ₁
-    { 6, 9, 7, 0, 5, 14, 165 }, // ₂
-    { 6, 9, 7, 0, 5, 14, 179 }, // ₃
-    { 7, 8, 7, 0, 5, 14, 193 }, // ₄
-    { 6, 8, 6, 0, 5, 12, 207 }, // ₅
-    { 7, 8, 7, 0, 4, 14, 219 }, // ₆
-    { 6, 9, 7, 0, 5, 14, 233 }, // ₇
-    { 7, 9, 7, 0, 5, 16, 247 }, // ₈
-    { 7, 9, 7, 0, 5, 16, 263 }, // ₉
-    { 7, 28, 9, 2, 21, 49, 279 }, // ₍
-    { 7, 28, 9, 0, 21, 49, 328 }, // ₎
-    { 15, 28, 21, 3, 23, 105, 0 }, // ₡
-    { 14, 20, 21, 3, 19, 70, 105 }, // ₢
-    { 14, 20, 14, 0, 20, 70, 175 }, // ₤
-    { 20, 18, 22, 2, 18, 90, 245 }, // ₦
-    { 16, 18, 19, 1, 18, 72, 335 }, // ₧
-    { 21, 18, 24, 3, 18, 95, 407 }, // ₨
-    { 16, 18, 18, 1, 18, 72, 502 }, // ₩
-    { 16, 16, 22, 3, 16, 64, 574 }, // ₪
-    { 14, 17, 14, 1, 17, 60, 638 }, // ₫
-    { 13, 19, 16, 1, 16, 62, 698 }, // €
-    { 16, 18, 22, 3, 18, 72, 760 }, // ₮
-    { 18, 18, 13, 0, 18, 81, 832 }, // ₱
-    { 17, 25, 24, 3, 22, 107, 913 }, // ₲
-    { 19, 19, 19, 1, 18, 91, 1020 }, // ₴
-    { 10, 16, 16, 3, 15, 40, 1111 }, // ₵
-    { 16, 19, 22, 3, 19, 76, 1151 }, // ₸
-    { 10, 17, 13, 1, 16, 43, 1227 }, // ₹
-    { 12, 15, 14, 1, 14, 45, 1270 }, // ₺
-    { 13, 16, 13, 0, 16, 52, 1315 }, // ₼
-    { 17, 18, 19, -1, 18, 77, 1367 }, // ₽
-    { 14, 13, 16, 1, 12, 46, 0 }, // ←
-    { 14, 13, 16, 1, 13, 46, 46 }, // ↑
-    { 14, 13, 16, 1, 12, 46, 92 }, // →
-    { 14, 13, 16, 1, 13, 46, 138 }, // ↓
-    { 16, 11, 19, 1, 11, 44, 184 }, // ↔
-    { 12, 16, 14, 1, 17, 48, 228 }, // ↕
-    { 11, 10, 13, 1, 10, 28, 276 }, // ↖
-    { 11, 10, 13, 1, 10, 28, 304 }, // ↗
-    { 11, 11, 13, 1, 11, 31, 332 }, // ↘
-    { 11, 11, 13, 1, 11, 31, 363 }, // ↙
-    { 16, 13, 18, 1, 12, 52, 394 }, // ⇐
-    { 17, 15, 19, 1, 15, 64, 446 }, // ⇑
-    { 16, 13, 18, 1, 12, 52, 510 }, // ⇒
-    { 17, 16, 19, 1, 15, 68, 562 }, // ⇓
-    { 18, 13, 20, 1, 12, 59, 630 }, // ⇔
-    { 14, 17, 16, 1, 11, 60, 689 }, // ⇕
-    { 12, 17, 14, 1, 17, 51, 0 }, // ∂
-    { 21, 20, 24, 2, 19, 105, 51 }, // ∅
-    { 16, 16, 18, 1, 16, 64, 156 }, // ∆
-    { 13, 15, 15, 1, 15, 49, 220 }, // ∏
-    { 13, 15, 15, 1, 15, 49, 269 }, // ∐
-    { 10, 16, 12, 1, 15, 40, 318 }, // ∑
-    { 10, 3, 13, 1, 7, 8, 358 }, // −
-    { 17, 18, 19, 1, 17, 77, 366 }, // √
-    { 17, 11, 19, 1, 13, 47, 443 }, // ∞
-    { 18, 24, 18, 0, 19, 108, 490 }, // ∫
-    { 5, 13, 6, 0, 13, 17, 598 }, // ∶
-    { 12, 11, 16, 2, 12, 33, 615 }, // ≈
-    { 14, 18, 23, 5, 16, 63, 648 }, // ≠
-    { 16, 16, 18, 1, 15, 64, 711 }, // ≤
-    { 16, 16, 18, 1, 15, 64, 775 }, // ≥
+    { 11, 10, 13, 1, 10, 28, 4656 }, // «
+    { 11, 6, 13, 1, 7, 17, 360 }, // ¬
+    { 10, 3, 11, 1, 8, 8, 377 }, // ­
+    { 9, 8, 11, 1, 22, 18, 385 }, // ®
+    { 9, 3, 11, 1, 15, 7, 403 }, // ¯
+    { 10, 10, 11, 1, 17, 25, 410 }, // °
+    { 11, 12, 13, 1, 11, 33, 435 }, // ±
+    { 6, 8, 6, 0, 17, 12, 468 }, // ²
+    { 6, 8, 7, 0, 17, 12, 480 }, // ³
+    { 4, 5, 6, 1, 17, 5, 492 }, // ´
+    { 12, 14, 17, 2, 12, 42, 497 }, // µ
+    { 11, 17, 13, 1, 15, 47, 539 }, // ¶
+    { 4, 4, 5, 1, 9, 4, 586 }, // ·
+    { 5, 6, 7, 1, 1, 8, 590 }, // ¸
+    { 6, 9, 6, 0, 18, 14, 598 }, // ¹
+    { 7, 7, 9, 2, 15, 13, 612 }, // º
+    { 11, 10, 13, 1, 10, 28, 4684 }, // »
+    { 18, 20, 23, 3, 19, 90, 625 }, // ¼
+    { 18, 20, 23, 3, 18, 90, 715 }, // ½
+    { 19, 19, 23, 2, 18, 91, 805 }, // ¾
+    { 12, 23, 12, 0, 12, 69, 896 }, // ¿
+    { 17, 24, 24, 3, 24, 102, 4712 }, // À
+    { 17, 27, 24, 3, 27, 115, 4814 }, // Á
+    { 17, 25, 24, 3, 25, 107, 4929 }, // Â
+    { 17, 24, 24, 3, 24, 102, 965 }, // Ã
+    { 17, 24, 24, 3, 24, 102, 5036 }, // Ä
+    { 17, 25, 24, 3, 25, 107, 1067 }, // Å
+    { 24, 19, 30, 3, 18, 114, 1174 }, // Æ
+    { 14, 24, 21, 3, 19, 84, 5138 }, // Ç
+    { 13, 23, 19, 3, 23, 75, 5222 }, // È
+    { 13, 27, 19, 3, 27, 88, 5297 }, // É
+    { 13, 24, 19, 3, 24, 78, 5385 }, // Ê
+    { 13, 24, 19, 3, 24, 78, 5463 }, // Ë
+    { 7, 25, 10, 0, 25, 44, 5541 }, // Ì
+    { 5, 29, 10, 2, 29, 37, 5585 }, // Í
+    { 9, 26, 10, 0, 26, 59, 5622 }, // Î
+    { 11, 25, 10, -1, 25, 69, 5681 }, // Ï
+    { 19, 18, 23, 1, 18, 86, 1288 }, // Ð
+    { 16, 23, 22, 3, 23, 92, 5750 }, // Ñ
+    { 17, 24, 24, 3, 23, 102, 5842 }, // Ò
+    { 17, 28, 24, 3, 27, 119, 5944 }, // Ó
+    { 17, 25, 24, 3, 24, 107, 6063 }, // Ô
+    { 17, 24, 24, 3, 23, 102, 1374 }, // Õ
+    { 17, 24, 24, 3, 23, 102, 6170 }, // Ö
+    { 10, 6, 12, 1, 8, 15, 1476 }, // ×
+    { 26, 38, 25, -1, 28, 247, 1491 }, // Ø
+    { 15, 25, 22, 3, 24, 94, 6272 }, // Ù
+    { 15, 28, 22, 3, 27, 105, 6366 }, // Ú
+    { 15, 26, 22, 3, 25, 98, 6471 }, // Û
+    { 15, 25, 22, 3, 24, 94, 6569 }, // Ü
+    { 16, 28, 22, 3, 28, 112, 1738 }, // Ý
+    { 10, 17, 12, 1, 17, 43, 1850 }, // Þ
+    { 12, 17, 14, 1, 17, 51, 1893 }, // ß
+    { 12, 17, 17, 2, 17, 51, 6663 }, // à
+    { 12, 21, 17, 2, 21, 63, 6714 }, // á
+    { 12, 18, 17, 2, 18, 54, 6777 }, // â
+    { 12, 17, 17, 2, 17, 51, 1944 }, // ã
+    { 12, 17, 17, 2, 17, 51, 6831 }, // ä
+    { 12, 18, 17, 2, 18, 54, 1995 }, // å
+    { 21, 13, 26, 2, 13, 69, 2049 }, // æ
+    { 10, 18, 16, 3, 13, 45, 6882 }, // ç
+    { 12, 19, 17, 3, 19, 57, 6927 }, // è
+    { 12, 23, 17, 3, 23, 69, 6984 }, // é
+    { 12, 20, 17, 3, 20, 60, 7053 }, // ê
+    { 12, 20, 17, 3, 20, 60, 7113 }, // ë
+    { 7, 17, 9, 0, 17, 30, 7173 }, // ì
+    { 4, 21, 9, 3, 21, 21, 7203 }, // í
+    { 9, 18, 9, 0, 18, 41, 7224 }, // î
+    { 11, 18, 9, -1, 18, 50, 7265 }, // ï
+    { 16, 17, 17, 1, 17, 68, 2118 }, // ð
+    { 11, 18, 17, 3, 18, 50, 7315 }, // ñ
+    { 12, 19, 17, 3, 19, 57, 7365 }, // ò
+    { 12, 23, 17, 3, 23, 69, 7422 }, // ó
+    { 12, 20, 17, 3, 20, 60, 7491 }, // ô
+    { 12, 19, 17, 3, 19, 57, 2186 }, // õ
+    { 12, 19, 17, 3, 19, 57, 7551 }, // ö
+    { 14, 13, 16, 1, 13, 46, 2243 }, // ÷
+    { 13, 33, 17, 2, 22, 108, 2289 }, // ø
+    { 11, 18, 17, 3, 18, 50, 7608 }, // ù
+    { 11, 22, 17, 3, 22, 61, 7658 }, // ú
+    { 11, 18, 17, 3, 18, 50, 7719 }, // û
+    { 11, 18, 17, 3, 18, 50, 7769 }, // ü
+    { 12, 29, 17, 3, 23, 87, 2397 }, // ý
+    { 10, 21, 12, 1, 17, 53, 2484 }, // þ
+    { 12, 26, 17, 3, 20, 78, 2537 }, // ÿ
+    { 17, 23, 24, 3, 23, 98, 2615 }, // Ā
+    { 12, 16, 17, 2, 16, 48, 2713 }, // ā
+    { 17, 26, 24, 3, 26, 111, 2761 }, // Ă
+    { 12, 19, 17, 2, 19, 57, 2872 }, // ă
+    { 17, 23, 24, 3, 18, 98, 2929 }, // Ą
+    { 13, 17, 17, 2, 13, 56, 3027 }, // ą
+    { 14, 29, 21, 3, 28, 102, 3083 }, // Ć
+    { 10, 21, 16, 3, 20, 53, 3185 }, // ć
+    { 14, 27, 21, 3, 26, 95, 3238 }, // Ĉ
+    { 10, 19, 16, 3, 18, 48, 3333 }, // ĉ
+    { 14, 27, 21, 3, 26, 95, 3381 }, // Ċ
+    { 10, 20, 16, 3, 19, 50, 3476 }, // ċ
+    { 14, 28, 21, 3, 27, 98, 3526 }, // Č
+    { 10, 21, 16, 3, 20, 53, 3624 }, // č
+    { 17, 26, 23, 3, 26, 111, 3677 }, // Ď
+    { 17, 19, 18, 2, 18, 81, 3788 }, // ď
+    { 19, 18, 23, 1, 18, 86, 3869 }, // Đ
+    { 16, 19, 18, 2, 18, 76, 3955 }, // đ
+    { 13, 23, 19, 3, 23, 75, 4031 }, // Ē
+    { 12, 19, 17, 3, 19, 57, 4106 }, // ē
+    { 13, 26, 19, 3, 26, 85, 4163 }, // Ĕ
+    { 12, 22, 17, 3, 22, 66, 4248 }, // ĕ
+    { 13, 25, 19, 3, 25, 82, 4314 }, // Ė
+    { 12, 21, 17, 3, 21, 63, 4396 }, // ė
+    { 13, 23, 19, 3, 18, 75, 4459 }, // Ę
+    { 12, 19, 17, 3, 13, 57, 4534 }, // ę
+    { 13, 25, 19, 3, 25, 82, 4591 }, // Ě
+    { 12, 22, 17, 3, 22, 66, 4673 }, // ě
+    { 17, 24, 24, 3, 24, 102, 4739 }, // Ĝ
+    { 11, 23, 17, 3, 18, 64, 4841 }, // ĝ
+    { 17, 26, 24, 3, 26, 111, 4905 }, // Ğ
+    { 11, 25, 17, 3, 20, 69, 5016 }, // ğ
+    { 17, 25, 24, 3, 25, 107, 5085 }, // Ġ
+    { 11, 24, 17, 3, 19, 66, 5192 }, // ġ
+    { 17, 28, 24, 3, 19, 119, 5258 }, // Ģ
+    { 11, 25, 17, 3, 20, 69, 5377 }, // ģ
+    { 16, 24, 22, 3, 24, 96, 5446 }, // Ĥ
+    { 13, 23, 17, 1, 23, 75, 5542 }, // ĥ
+    { 17, 18, 22, 2, 18, 77, 5617 }, // Ħ
+    { 14, 18, 17, 0, 18, 63, 5694 }, // ħ
+    { 8, 26, 10, 0, 26, 52, 5757 }, // Ĩ
+    { 8, 18, 9, 1, 18, 36, 5809 }, // ĩ
+    { 11, 24, 10, -1, 24, 66, 5845 }, // Ī
+    { 10, 17, 9, 0, 17, 43, 5911 }, // ī
+    { 5, 23, 13, 5, 18, 29, 5954 }, // Į
+    { 5, 23, 9, 2, 18, 29, 5983 }, // į
+    { 5, 26, 10, 2, 26, 33, 6012 }, // İ
+    { 4, 12, 9, 3, 12, 12, 6045 }, // ı
+    { 14, 23, 19, 2, 18, 81, 6057 }, // Ĳ
+    { 15, 24, 9, 3, 18, 90, 6138 }, // ĳ
+    { 10, 27, 16, 3, 22, 68, 6228 }, // Ĵ
+    { 11, 23, 13, 3, 17, 64, 6296 }, // ĵ
+    { 15, 25, 21, 3, 18, 94, 6360 }, // Ķ
+    { 11, 26, 17, 3, 17, 72, 6454 }, // ķ
+    { 9, 12, 13, 2, 12, 27, 6526 }, // ĸ
+    { 12, 25, 19, 3, 25, 75, 6553 }, // Ĺ
+    { 7, 25, 11, 2, 25, 44, 6628 }, // ĺ
+    { 12, 27, 19, 3, 18, 81, 6672 }, // Ļ
+    { 7, 25, 11, 2, 17, 44, 6753 }, // ļ
+    { 12, 18, 19, 3, 18, 54, 6797 }, // Ľ
+    { 9, 18, 11, 2, 18, 41, 6851 }, // ľ
+    { 12, 18, 19, 3, 18, 54, 6892 }, // Ŀ
+    { 10, 17, 11, 2, 17, 43, 6946 }, // ŀ
+    { 20, 29, 19, -5, 23, 145, 6989 }, // Ł
+    { 14, 17, 11, -4, 17, 60, 7134 }, // ł
+    { 16, 25, 22, 3, 25, 100, 7194 }, // Ń
+    { 11, 20, 17, 3, 20, 55, 7294 }, // ń
+    { 16, 25, 22, 3, 18, 100, 7349 }, // Ņ
+    { 11, 19, 17, 3, 12, 53, 7449 }, // ņ
+    { 16, 25, 22, 3, 25, 100, 7502 }, // Ň
+    { 11, 20, 17, 3, 20, 55, 7602 }, // ň
+    { 12, 22, 14, 1, 22, 66, 7657 }, // ŉ
+    { 16, 22, 22, 3, 18, 88, 7723 }, // Ŋ
+    { 11, 16, 17, 3, 12, 44, 7811 }, // ŋ
+    { 17, 23, 24, 3, 22, 98, 7855 }, // Ō
+    { 12, 18, 17, 3, 18, 54, 7953 }, // ō
+    { 17, 27, 24, 3, 26, 115, 8007 }, // Ŏ
+    { 12, 22, 17, 3, 22, 66, 8122 }, // ŏ
+    { 18, 25, 24, 3, 24, 113, 8188 }, // Ő
+    { 16, 20, 17, 1, 20, 80, 8301 }, // ő
+    { 24, 19, 25, 3, 19, 114, 7819 }, // Œ
+    { 20, 13, 22, 3, 13, 65, 7933 }, // œ
+    { 14, 25, 20, 3, 25, 88, 8381 }, // Ŕ
+    { 8, 18, 14, 3, 18, 36, 8469 }, // ŕ
+    { 14, 28, 20, 3, 18, 98, 8505 }, // Ŗ
+    { 9, 23, 14, 2, 12, 52, 8603 }, // ŗ
+    { 14, 25, 20, 3, 25, 88, 8655 }, // Ř
+    { 10, 18, 14, 1, 18, 45, 8743 }, // ř
+    { 17, 28, 23, 3, 27, 119, 8788 }, // Ś
+    { 10, 20, 16, 3, 20, 50, 8907 }, // ś
+    { 17, 26, 23, 3, 25, 111, 8957 }, // Ŝ
+    { 10, 18, 16, 3, 18, 45, 9068 }, // ŝ
+    { 17, 23, 23, 3, 18, 98, 9113 }, // Ş
+    { 10, 18, 16, 3, 12, 45, 9211 }, // ş
+    { 17, 27, 23, 3, 26, 115, 9256 }, // Š
+    { 10, 20, 16, 3, 20, 50, 9371 }, // š
+    { 16, 22, 22, 3, 18, 88, 9421 }, // Ţ
+    { 9, 20, 15, 3, 16, 45, 9509 }, // ţ
+    { 16, 24, 22, 3, 24, 96, 9554 }, // Ť
+    { 10, 18, 15, 3, 18, 45, 9650 }, // ť
+    { 16, 18, 22, 3, 18, 72, 9695 }, // Ŧ
+    { 10, 16, 15, 2, 16, 40, 9767 }, // ŧ
+    { 15, 26, 22, 3, 25, 98, 9807 }, // Ũ
+    { 11, 19, 17, 3, 19, 53, 9905 }, // ũ
+    { 15, 24, 22, 3, 23, 90, 9958 }, // Ū
+    { 11, 17, 17, 3, 17, 47, 10048 }, // ū
+    { 15, 28, 22, 3, 27, 105, 10095 }, // Ŭ
+    { 11, 20, 17, 3, 20, 55, 10200 }, // ŭ
+    { 15, 27, 22, 3, 26, 102, 10255 }, // Ů
+    { 11, 20, 17, 3, 20, 55, 10357 }, // ů
+    { 17, 26, 22, 3, 25, 111, 10412 }, // Ű
+    { 16, 19, 17, 1, 19, 76, 10523 }, // ű
+    { 15, 23, 22, 3, 18, 87, 10599 }, // Ų
+    { 11, 17, 17, 3, 12, 47, 10686 }, // ų
+    { 23, 24, 30, 3, 24, 138, 10733 }, // Ŵ
+    { 16, 19, 22, 3, 19, 76, 10871 }, // ŵ
+    { 16, 25, 22, 3, 25, 100, 10947 }, // Ŷ
+    { 12, 26, 17, 3, 20, 78, 11047 }, // ŷ
+    { 16, 25, 22, 3, 25, 100, 11125 }, // Ÿ
+    { 17, 25, 24, 3, 25, 107, 11225 }, // Ź
+    { 11, 20, 17, 3, 20, 55, 11332 }, // ź
+    { 17, 24, 24, 3, 24, 102, 11387 }, // Ż
+    { 11, 19, 17, 3, 19, 53, 11489 }, // ż
+    { 17, 25, 24, 3, 25, 107, 11542 }, // Ž
+    { 11, 20, 17, 3, 20, 55, 11649 }, // ž
+    { 7, 17, 11, 3, 17, 30, 11704 }, // ſ
+    { 7, 4, 0, 1, 16, 7, 11734 }, // ̀
+    { 4, 5, 0, 1, 17, 5, 11741 }, // ́
+    { 9, 5, 0, 1, 1, 12, 11746 }, // ̂
+    { 8, 5, 0, 1, 16, 10, 11758 }, // ̃
+    { 11, 3, 0, 1, 14, 9, 11768 }, // ̄
+    { 14, 3, 0, 1, 18, 11, 11777 }, // ̅
+    { 9, 5, 0, 1, 16, 12, 11788 }, // ̆
+    { 4, 4, 0, 1, 16, 4, 11800 }, // ̇
+    { 10, 4, 0, 1, 16, 10, 11804 }, // ̈
+    { 5, 4, 0, 0, 13, 5, 11814 }, // ̉
+    { 5, 5, 0, 1, 16, 7, 11819 }, // ̊
+    { 15, 4, 0, 1, 16, 15, 11826 }, // ̋
+    { 9, 5, 0, 1, 16, 12, 11841 }, // ̌
+    { 15, 4, 0, -4, 17, 15, 11853 }, // ̏
+    { 6, 6, 0, 0, 16, 9, 11868 }, // ̒
+    { 5, 6, 0, 1, 15, 8, 11877 }, // ̓
+    { 6, 6, 0, 0, 15, 9, 11885 }, // ̔
+    { 4, 5, 0, 1, -1, 5, 11894 }, // ̘
+    { 4, 5, 0, 1, -1, 5, 11899 }, // ̙
+    { 9, 5, 0, 1, 17, 12, 11904 }, // ̚
+    { 4, 5, 0, 1, 13, 5, 11916 }, // ̛
+    { 3, 5, 0, 1, -1, 4, 11921 }, // ̜
+    { 5, 4, 0, 1, 3, 5, 11925 }, // ̝
+    { 5, 4, 0, 1, 0, 5, 11930 }, // ̞
+    { 5, 5, 0, 1, -2, 7, 11935 }, // ̟
+    { 10, 3, 0, 1, -3, 8, 11942 }, // ̠
+    { 4, 4, 0, 1, 1, 4, 11950 }, // ̣
+    { 10, 4, 0, 1, 0, 10, 11954 }, // ̤
+    { 5, 5, 0, 1, 16, 7, 11964 }, // ̥
+    { 5, 6, 0, 1, 3, 8, 11971 }, // ̦
+    { 5, 6, 0, 1, 1, 8, 11979 }, // ̧
+    { 5, 6, 0, 1, 1, 8, 11987 }, // ̨
+    { 3, 6, 0, 1, -1, 5, 11995 }, // ̩
+    { 7, 4, 0, 1, -1, 7, 12000 }, // ̪
+    { 9, 5, 0, 1, 0, 12, 12007 }, // ̬
+    { 9, 5, 0, 1, -1, 12, 12019 }, // ̭
+    { 8, 5, 0, 1, 16, 10, 12031 }, // ̰
+    { 9, 3, 0, 1, 15, 7, 12041 }, // ̱
+    { 9, 3, 0, 1, -1, 7, 12048 }, // ̲
+    { 8, 5, 0, 1, 16, 10, 12055 }, // ̴
+    { 10, 3, 0, 1, 8, 8, 12065 }, // ̵
+    { 3, 5, 0, 1, -1, 4, 12073 }, // ̹
+    { 7, 4, 0, 1, -1, 7, 12077 }, // ̺
+    { 7, 5, 0, 1, 0, 9, 12084 }, // ̻
+    { 7, 4, 0, 1, 0, 7, 12093 }, // ̼
+    { 5, 5, 0, 2, 16, 7, 12100 }, // ̽
+    { 8, 5, 0, 1, 16, 10, 12107 }, // ͂
+    { 3, 4, 0, 1, 17, 3, 12117 }, // ̓
+    { 10, 10, 0, 1, 22, 25, 12120 }, // ̈́
+    { 7, 4, 0, 1, 16, 7, 12145 }, // ͆
+    { 10, 8, 0, 1, 0, 20, 12152 }, // ͇
+    { 8, 6, 0, 1, 0, 12, 12172 }, // ͈
+    { 7, 6, 0, 1, -1, 11, 12184 }, // ͉
+    { 8, 12, 0, 1, 20, 24, 12195 }, // ͊
+    { 17, 9, 0, 1, 19, 39, 12219 }, // ͋
+    { 12, 11, 0, 2, 12, 33, 12258 }, // ͌
+    { 10, 5, 0, 2, -2, 13, 12291 }, // ͍
+    { 4, 3, 0, 1, 2, 3, 12304 }, // ͎
+    { 17, 4, 0, 1, 0, 17, 12307 }, // ͜
+    { 17, 4, 0, 1, 16, 17, 12324 }, // ͡
+    { 21, 5, 0, 1, -1, 27, 12341 }, // ͢
+    { 11, 21, 13, 1, 21, 58, 12368 }, // Ѐ
+    { 11, 20, 13, 1, 20, 55, 0 }, // Ё
+    { 17, 17, 21, 2, 17, 73, 12426 }, // Ђ
+    { 11, 24, 14, 1, 24, 66, 12499 }, // Ѓ
+    { 15, 17, 19, 2, 16, 64, 12565 }, // Є
+    { 17, 19, 23, 3, 18, 81, 12629 }, // Ѕ
+    { 5, 18, 10, 2, 18, 23, 12710 }, // І
+    { 10, 25, 10, -1, 25, 63, 12733 }, // Ї
+    { 9, 24, 16, 3, 19, 54, 0 }, // Ј
+    { 21, 16, 24, 2, 15, 84, 54 }, // Љ
+    { 20, 16, 23, 2, 16, 80, 138 }, // Њ
+    { 18, 18, 22, 3, 18, 81, 218 }, // Ћ
+    { 15, 25, 21, 3, 25, 94, 299 }, // Ќ
+    { 16, 24, 22, 3, 24, 96, 393 }, // Ѝ
+    { 12, 25, 14, 1, 24, 75, 489 }, // Ў
+    { 13, 19, 15, 1, 15, 62, 564 }, // Џ
+    { 17, 18, 24, 3, 18, 77, 55 }, // А
+    { 11, 15, 14, 1, 15, 42, 132 }, // Б
+    { 12, 15, 14, 1, 15, 45, 174 }, // В
+    { 11, 15, 14, 1, 15, 42, 219 }, // Г
+    { 15, 18, 17, 1, 15, 68, 261 }, // Д
+    { 11, 15, 13, 1, 15, 42, 329 }, // Е
+    { 23, 18, 30, 3, 18, 104, 371 }, // Ж
+    { 11, 16, 13, 1, 16, 44, 475 }, // З
+    { 16, 18, 22, 3, 18, 72, 519 }, // И
+    { 16, 26, 22, 3, 26, 104, 591 }, // Й
+    { 15, 18, 21, 3, 18, 68, 695 }, // К
+    { 12, 16, 16, 2, 15, 48, 763 }, // Л
+    { 15, 15, 18, 1, 15, 57, 811 }, // М
+    { 16, 18, 22, 3, 18, 72, 868 }, // Н
+    { 17, 19, 24, 3, 18, 81, 940 }, // О
+    { 12, 16, 14, 1, 16, 48, 1021 }, // П
+    { 13, 18, 19, 3, 18, 59, 1069 }, // Р
+    { 14, 20, 21, 3, 19, 70, 1128 }, // С
+    { 16, 18, 22, 3, 18, 72, 1198 }, // Т
+    { 12, 18, 14, 1, 17, 54, 1270 }, // У
+    { 16, 16, 18, 1, 16, 64, 1324 }, // Ф
+    { 17, 18, 24, 3, 18, 77, 1388 }, // Х
+    { 13, 19, 15, 1, 16, 62, 1465 }, // Ц
+    { 12, 16, 14, 1, 16, 48, 1527 }, // Ч
+    { 15, 16, 17, 1, 16, 60, 1575 }, // Ш
+    { 17, 20, 19, 1, 16, 85, 1635 }, // Щ
+    { 14, 16, 14, -2, 16, 56, 1720 }, // Ъ
+    { 19, 16, 23, 2, 16, 76, 1776 }, // Ы
+    { 10, 16, 14, 2, 16, 40, 1852 }, // Ь
+    { 15, 17, 19, 2, 16, 64, 1892 }, // Э
+    { 17, 16, 21, 2, 16, 68, 1956 }, // Ю
+    { 14, 18, 20, 3, 18, 63, 2024 }, // Я
+    { 12, 13, 17, 2, 13, 39, 2087 }, // а
+    { 12, 16, 15, 1, 16, 48, 2126 }, // б
+    { 11, 13, 15, 2, 13, 36, 2174 }, // в
+    { 10, 12, 12, 1, 12, 30, 2210 }, // г
+    { 14, 14, 16, 1, 12, 49, 2240 }, // д
+    { 12, 13, 17, 3, 13, 39, 2289 }, // е
+    { 19, 15, 25, 3, 15, 72, 2328 }, // ж
+    { 8, 11, 9, 1, 11, 22, 2400 }, // з
+    { 12, 12, 14, 1, 12, 36, 2422 }, // и
+    { 12, 16, 14, 1, 16, 48, 2458 }, // й
+    { 11, 13, 17, 3, 13, 36, 2506 }, // к
+    { 9, 12, 11, 1, 11, 27, 2542 }, // л
+    { 15, 14, 19, 2, 14, 53, 2569 }, // м
+    { 13, 13, 19, 3, 13, 43, 2622 }, // н
+    { 12, 12, 14, 1, 12, 36, 2665 }, // о
+    { 12, 12, 14, 1, 12, 36, 2701 }, // п
+    { 13, 18, 17, 2, 12, 59, 2737 }, // р
+    { 10, 14, 16, 3, 13, 35, 2796 }, // с
+    { 12, 12, 14, 1, 12, 36, 2831 }, // т
+    { 12, 18, 17, 3, 12, 54, 2867 }, // у
+    { 16, 17, 18, 1, 12, 68, 2921 }, // ф
+    { 13, 12, 15, 1, 12, 39, 2989 }, // х
+    { 13, 15, 15, 1, 12, 49, 3028 }, // ц
+    { 8, 11, 9, 1, 11, 22, 3077 }, // ч
+    { 15, 12, 17, 1, 12, 45, 3099 }, // ш
+    { 16, 16, 19, 1, 12, 64, 3144 }, // щ
+    { 13, 11, 16, 1, 11, 36, 3208 }, // ъ
+    { 15, 12, 17, 1, 12, 45, 3244 }, // ы
+    { 10, 12, 13, 1, 12, 30, 3289 }, // ь
+    { 11, 12, 13, 1, 12, 33, 3319 }, // э
+    { 14, 13, 17, 1, 13, 46, 3352 }, // ю
+    { 11, 11, 13, 1, 11, 31, 3398 }, // я
+    { 12, 20, 17, 3, 20, 60, 626 }, // ѐ
+    { 12, 17, 14, 1, 16, 51, 3429 }, // ё
+    { 15, 21, 17, 0, 18, 79, 686 }, // ђ
+    { 10, 18, 12, 1, 18, 45, 765 }, // ѓ
+    { 11, 12, 13, 1, 11, 33, 810 }, // є
+    { 10, 12, 16, 3, 12, 30, 843 }, // ѕ
+    { 4, 18, 9, 3, 18, 18, 873 }, // і
+    { 11, 18, 9, -1, 18, 50, 891 }, // ї
+    { 8, 24, 13, 3, 18, 48, 941 }, // ј
+    { 15, 12, 17, 1, 11, 45, 989 }, // љ
+    { 14, 11, 16, 1, 11, 39, 1034 }, // њ
+    { 14, 18, 17, 0, 18, 63, 1073 }, // ћ
+    { 11, 19, 17, 3, 19, 53, 1136 }, // ќ
+    { 12, 17, 14, 1, 17, 51, 1189 }, // ѝ
+    { 12, 27, 17, 3, 21, 81, 1240 }, // ў
+    { 9, 14, 11, 1, 11, 32, 1321 }, // џ
+    { 12, 17, 17, 3, 16, 51, 1353 }, // Ѣ
+    { 13, 16, 15, 1, 15, 52, 1404 }, // ѣ
+    { 17, 15, 21, 2, 15, 64, 1456 }, // Ѫ
+    { 12, 11, 15, 1, 11, 33, 1520 }, // ѫ
+    { 16, 19, 22, 3, 19, 76, 1553 }, // Ѳ
+    { 13, 15, 17, 2, 15, 49, 1629 }, // ѳ
+    { 22, 23, 24, 3, 23, 127, 1678 }, // Ѵ
+    { 14, 15, 17, 2, 15, 53, 1805 }, // ѵ
+    { 8, 6, 0, 1, 19, 12, 1858 }, // ҆
+    { 11, 17, 14, 1, 17, 47, 1870 }, // Ґ
+    { 10, 14, 12, 1, 14, 35, 1917 }, // ґ
+    { 12, 15, 14, 0, 15, 45, 1952 }, // Ғ
+    { 9, 11, 9, 0, 11, 25, 1997 }, // ғ
+    { 13, 17, 14, 1, 17, 56, 2022 }, // Ҕ
+    { 7, 11, 9, 1, 11, 20, 2078 }, // ҕ
+    { 23, 21, 27, 2, 18, 121, 2098 }, // Җ
+    { 16, 15, 18, 1, 13, 60, 2219 }, // җ
+    { 11, 18, 15, 2, 16, 50, 2279 }, // Ҙ
+    { 8, 16, 9, 1, 11, 32, 2329 }, // ҙ
+    { 14, 21, 18, 2, 18, 74, 2361 }, // Қ
+    { 10, 15, 13, 1, 13, 38, 2435 }, // қ
+    { 16, 16, 20, 2, 16, 64, 2473 }, // Ҝ
+    { 13, 11, 15, 1, 11, 36, 2537 }, // ҝ
+    { 15, 18, 21, 3, 18, 68, 2573 }, // Ҟ
+    { 14, 17, 17, 0, 17, 60, 2641 }, // ҟ
+    { 20, 18, 21, -2, 18, 90, 2701 }, // Ҡ
+    { 13, 13, 15, -1, 13, 43, 2791 }, // ҡ
+    { 16, 21, 19, 2, 18, 84, 2834 }, // Ң
+    { 12, 15, 13, 1, 13, 45, 2918 }, // ң
+    { 22, 19, 22, 3, 19, 105, 2963 }, // Ҥ
+    { 15, 12, 15, 2, 12, 45, 3068 }, // ҥ
+    { 20, 17, 25, 2, 17, 85, 3113 }, // Ҧ
+    { 20, 20, 22, 1, 14, 100, 3198 }, // ҧ
+    { 21, 18, 25, 2, 17, 95, 3298 }, // Ҩ
+    { 17, 15, 19, 1, 14, 64, 3393 }, // ҩ
+    { 14, 23, 21, 3, 19, 81, 3457 }, // Ҫ
+    { 10, 16, 16, 3, 13, 40, 3538 }, // ҫ
+    { 16, 20, 20, 2, 18, 80, 3578 }, // Ҭ
+    { 11, 14, 13, 1, 12, 39, 3658 }, // ҭ
+    { 16, 18, 22, 3, 18, 72, 3697 }, // Ү
+    { 12, 15, 14, 1, 11, 45, 3769 }, // ү
+    { 16, 18, 22, 3, 18, 72, 3814 }, // Ұ
+    { 12, 16, 14, 1, 11, 48, 3886 }, // ұ
+    { 17, 21, 21, 2, 18, 90, 3934 }, // Ҳ
+    { 12, 15, 14, 1, 13, 45, 4024 }, // ҳ
+    { 18, 19, 22, 2, 15, 86, 4069 }, // Ҵ
+    { 14, 14, 16, 1, 11, 49, 4155 }, // ҵ
+    { 14, 20, 17, 1, 15, 70, 4204 }, // Ҷ
+    { 10, 15, 12, 1, 11, 38, 4274 }, // ҷ
+    { 13, 15, 15, 1, 15, 49, 4312 }, // Ҹ
+    { 9, 11, 10, 1, 11, 25, 4361 }, // ҹ
+    { 12, 17, 16, 2, 17, 51, 4386 }, // Һ
+    { 11, 18, 17, 3, 18, 50, 4437 }, // һ
+    { 18, 17, 20, 0, 16, 77, 4487 }, // Ҽ
+    { 13, 12, 15, 0, 12, 39, 4564 }, // ҽ
+    { 19, 19, 23, 2, 16, 91, 4603 }, // Ҿ
+    { 14, 14, 16, 1, 12, 49, 4694 }, // ҿ
+    { 5, 18, 10, 2, 18, 23, 4743 }, // Ӏ
+    { 23, 26, 30, 3, 26, 150, 4766 }, // Ӂ
+    { 19, 23, 25, 3, 23, 110, 4916 }, // ӂ
+    { 12, 21, 16, 2, 16, 63, 5026 }, // Ӄ
+    { 9, 15, 11, 1, 11, 34, 5089 }, // ӄ
+    { 14, 18, 16, 2, 15, 63, 5123 }, // Ӆ
+    { 10, 14, 11, 1, 11, 35, 5186 }, // ӆ
+    { 17, 23, 22, 3, 18, 98, 5221 }, // Ӈ
+    { 12, 17, 15, 2, 13, 51, 5319 }, // ӈ
+    { 17, 24, 22, 3, 18, 102, 5370 }, // Ӊ
+    { 12, 17, 15, 2, 13, 51, 5472 }, // ӊ
+    { 12, 19, 14, 0, 15, 57, 5523 }, // Ӌ
+    { 8, 14, 10, 1, 11, 28, 5580 }, // ӌ
+    { 21, 24, 26, 3, 18, 126, 5608 }, // Ӎ
+    { 14, 17, 18, 2, 13, 60, 5734 }, // ӎ
+    { 4, 15, 6, 1, 15, 15, 5794 }, // ӏ
+    { 17, 26, 24, 3, 26, 111, 5809 }, // Ӑ
+    { 12, 20, 17, 2, 20, 60, 5920 }, // ӑ
+    { 17, 24, 24, 3, 24, 102, 5980 }, // Ӓ
+    { 12, 18, 17, 2, 18, 54, 6082 }, // ӓ
+    { 24, 19, 30, 3, 18, 114, 6136 }, // Ӕ
+    { 21, 13, 26, 2, 13, 69, 6250 }, // ӕ
+    { 11, 23, 13, 1, 23, 64, 6319 }, // Ӗ
+    { 12, 21, 17, 3, 21, 63, 6383 }, // ӗ
+    { 12, 13, 17, 3, 12, 39, 6446 }, // Ә
+    { 12, 14, 17, 3, 13, 42, 6485 }, // ә
+    { 12, 22, 17, 3, 21, 66, 6527 }, // Ӛ
+    { 12, 15, 17, 3, 13, 45, 6593 }, // ӛ
+    { 23, 24, 27, 3, 24, 138, 6638 }, // Ӝ
+    { 19, 21, 25, 3, 21, 100, 6776 }, // ӝ
+    { 11, 22, 13, 1, 22, 61, 6876 }, // Ӟ
+    { 10, 17, 9, 1, 17, 43, 6937 }, // ӟ
+    { 11, 16, 12, 1, 15, 44, 6980 }, // Ӡ
+    { 11, 16, 12, 1, 11, 44, 7024 }, // ӡ
+    { 16, 22, 22, 3, 22, 88, 7068 }, // Ӣ
+    { 12, 16, 14, 1, 16, 48, 7156 }, // ӣ
+    { 16, 24, 22, 3, 24, 96, 7204 }, // Ӥ
+    { 12, 17, 14, 1, 17, 51, 7300 }, // ӥ
+    { 17, 25, 24, 3, 24, 107, 7351 }, // Ӧ
+    { 12, 18, 14, 1, 18, 54, 7458 }, // ӧ
+    { 15, 16, 22, 4, 15, 60, 7512 }, // Ө
+    { 12, 12, 17, 3, 12, 36, 7572 }, // ө
+    { 15, 25, 22, 4, 24, 94, 7608 }, // Ӫ
+    { 12, 20, 17, 3, 20, 60, 7702 }, // ӫ
+    { 15, 23, 19, 2, 22, 87, 7762 }, // Ӭ
+    { 11, 17, 13, 1, 17, 47, 7849 }, // ӭ
+    { 12, 22, 14, 1, 21, 66, 7896 }, // Ӯ
+    { 12, 25, 17, 3, 19, 75, 7962 }, // ӯ
+    { 12, 23, 14, 1, 22, 69, 8037 }, // Ӱ
+    { 12, 26, 17, 3, 20, 78, 8106 }, // ӱ
+    { 16, 24, 14, 0, 23, 96, 8184 }, // Ӳ
+    { 16, 26, 17, 2, 20, 104, 8280 }, // ӳ
+    { 12, 22, 14, 1, 22, 66, 8384 }, // Ӵ
+    { 10, 17, 9, -1, 17, 43, 8450 }, // ӵ
+    { 11, 18, 14, 1, 15, 50, 8493 }, // Ӷ
+    { 8, 13, 9, 1, 11, 26, 8543 }, // ӷ
+    { 19, 23, 23, 2, 23, 110, 8569 }, // Ӹ
+    { 15, 19, 17, 1, 19, 72, 8679 }, // ӹ
+    { 21, 20, 24, 3, 18, 105, 8751 }, // Ӽ
+    { 14, 15, 16, 2, 13, 53, 8856 }, // ӽ
+    { 0, 0, 17, 0, 0, 0, 8909 }, //  
+    { 0, 0, 28, 0, 0, 0, 8909 }, //  
+    { 0, 0, 17, 0, 0, 0, 8909 }, //  
+    { 0, 0, 28, 0, 0, 0, 8909 }, //  
+    { 0, 0, 14, 0, 0, 0, 8909 }, //  
+    { 0, 0, 12, 0, 0, 0, 8909 }, //  
+    { 0, 0, 10, 0, 0, 0, 8909 }, //  
+    { 0, 0, 14, 0, 0, 0, 8909 }, //  
+    { 0, 0, 5, 0, 0, 0, 8909 }, //  
+    { 0, 0, 11, 0, 0, 0, 8909 }, //  
+    { 0, 0, 10, 0, 0, 0, 8909 }, //  
+    { 0, 0, 7, 0, 0, 0, 8909 }, // ​
+    { 0, 0, 0, 0, 0, 0, 8909 }, // ‌
+    { 0, 0, 0, 0, 0, 0, 8909 }, // ‍
+    { 0, 0, 0, 0, 0, 0, 8909 }, // ‎
+    { 0, 0, 0, 0, 0, 0, 8909 }, // ‏
+    { 10, 3, 11, 1, 8, 8, 8909 }, // ‐
+    { 10, 3, 11, 1, 8, 8, 8917 }, // ‑
+    { 15, 3, 16, 1, 8, 12, 8925 }, // ‒
+    { 14, 3, 17, 1, 8, 11, 7998 }, // –
+    { 21, 3, 23, 1, 8, 16, 8009 }, // —
+    { 21, 3, 23, 1, 8, 16, 8937 }, // ―
+    { 9, 18, 11, 1, 15, 41, 8953 }, // ‖
+    { 16, 8, 16, 1, -1, 32, 8994 }, // ‗
+    { 5, 6, 7, 1, 18, 8, 8025 }, // ‘
+    { 5, 6, 7, 1, 18, 8, 8033 }, // ’
+    { 5, 6, 7, 1, 3, 8, 9026 }, // ‚
+    { 5, 6, 7, 1, 18, 8, 9034 }, // ‛
+    { 10, 6, 12, 1, 18, 15, 8041 }, // “
+    { 10, 6, 12, 1, 18, 15, 8056 }, // ”
+    { 5, 6, 7, 1, 3, 8, 9042 }, // „
+    { 10, 6, 12, 1, 18, 15, 9050 }, // ‟
+    { 12, 28, 12, 0, 22, 84, 9065 }, // †
+    { 11, 28, 13, 1, 22, 77, 9149 }, // ‡
+    { 13, 12, 11, -1, 14, 39, 9226 }, // •
+    { 6, 7, 8, 1, 9, 11, 9265 }, // ‣
+    { 4, 4, 5, 1, 4, 4, 9276 }, // ․
+    { 4, 4, 5, 1, 4, 4, 9280 }, // ‥
+    { 18, 4, 20, 1, 4, 18, 8071 }, // …
+    { 3, 3, 5, 1, 8, 3, 9284 }, // ‧
+    { 0, 0, 26, 0, 0, 0, 9287 }, //  
+    { 13, 18, 23, 5, 16, 59, 9287 }, // ‰
+    { 5, 6, 7, 1, 18, 8, 9346 }, // ′
+    { 10, 6, 12, 1, 18, 15, 9354 }, // ″
+    { 16, 7, 18, 1, 18, 28, 9369 }, // ‴
+    { 5, 6, 7, 1, 17, 8, 9397 }, // ‵
+    { 10, 6, 11, 0, 17, 15, 9405 }, // ‶
+    { 16, 7, 18, 1, 18, 28, 9420 }, // ‷
+    { 9, 4, 12, 1, 17, 9, 9448 }, // ‸
+    { 7, 10, 9, 1, 11, 18, 9457 }, // ‹
+    { 7, 10, 9, 1, 11, 18, 9475 }, // ›
+    { 22, 21, 28, 4, 19, 116, 9493 }, // ※
+    { 6, 21, 7, 0, 21, 32, 9609 }, // ‼
+    { 11, 26, 16, 2, 25, 72, 9641 }, // ‽
+    { 10, 3, 11, 1, 17, 8, 9713 }, // ‾
+    { 9, 4, 12, 1, 14, 9, 9721 }, // ‿
+    { 14, 14, 17, 1, 19, 49, 9730 }, // ⁂
+    { 13, 17, 23, 5, 16, 56, 9779 }, // ⁄
+    { 23, 24, 26, 2, 24, 138, 9835 }, // ⁇
+    { 16, 23, 21, 2, 23, 92, 9973 }, // ⁈
+    { 17, 25, 17, 0, 23, 107, 10065 }, // ⁉
+    { 12, 33, 15, 2, 23, 99, 10172 }, // ⁒
+    { 0, 0, 100, 0, 0, 0, 10271 }, //  
+    { 6, 8, 7, 0, 17, 12, 10271 }, // ⁰
+    { 6, 9, 7, 0, 18, 14, 10283 }, // ⁴
+    { 6, 9, 7, 0, 18, 14, 10297 }, // ⁵
+    { 6, 8, 7, 0, 17, 12, 10311 }, // ⁶
+    { 7, 9, 7, 0, 18, 16, 10323 }, // ⁷
+    { 7, 8, 7, 0, 17, 14, 10339 }, // ⁸
+    { 7, 8, 7, 0, 17, 14, 10353 }, // ⁹
+    { 11, 12, 17, 3, 12, 33, 10367 }, // ⁿ
+    { 8, 11, 9, 1, 11, 22, 10400 }, // ₀
+    { 6, 9, 6, 0, 5, 14, 10422 }, // ₁
+    { 6, 9, 7, 0, 5, 14, 10436 }, // ₂
+    { 6, 9, 7, 0, 5, 14, 10450 }, // ₃
+    { 7, 8, 7, 0, 5, 14, 10464 }, // ₄
+    { 6, 8, 6, 0, 5, 12, 10478 }, // ₅
+    { 7, 8, 7, 0, 4, 14, 10490 }, // ₆
+    { 6, 9, 7, 0, 5, 14, 10504 }, // ₇
+    { 7, 9, 7, 0, 5, 16, 10518 }, // ₈
+    { 7, 9, 7, 0, 5, 16, 10534 }, // ₉
+    { 7, 28, 9, 2, 21, 49, 10550 }, // ₍
+    { 7, 28, 9, 0, 21, 49, 10599 }, // ₎
+    { 15, 28, 21, 3, 23, 105, 10648 }, // ₡
+    { 14, 20, 21, 3, 19, 70, 10753 }, // ₢
+    { 14, 20, 14, 0, 20, 70, 10823 }, // ₤
+    { 20, 18, 22, 2, 18, 90, 10893 }, // ₦
+    { 16, 18, 19, 1, 18, 72, 10983 }, // ₧
+    { 21, 18, 24, 3, 18, 95, 11055 }, // ₨
+    { 16, 18, 18, 1, 18, 72, 11150 }, // ₩
+    { 16, 16, 22, 3, 16, 64, 11222 }, // ₪
+    { 14, 17, 14, 1, 17, 60, 11286 }, // ₫
+    { 13, 19, 16, 1, 16, 62, 11346 }, // €
+    { 16, 18, 22, 3, 18, 72, 11408 }, // ₮
+    { 18, 18, 13, 0, 18, 81, 11480 }, // ₱
+    { 17, 25, 24, 3, 22, 107, 11561 }, // ₲
+    { 19, 19, 19, 1, 18, 91, 11668 }, // ₴
+    { 10, 16, 16, 3, 15, 40, 11759 }, // ₵
+    { 16, 19, 22, 3, 19, 76, 11799 }, // ₸
+    { 10, 17, 13, 1, 16, 43, 11875 }, // ₹
+    { 12, 15, 14, 1, 14, 45, 11918 }, // ₺
+    { 13, 16, 13, 0, 16, 52, 11963 }, // ₼
+    { 17, 18, 19, -1, 18, 77, 12015 }, // ₽
+    { 14, 13, 16, 1, 12, 46, 12092 }, // ←
+    { 14, 13, 16, 1, 13, 46, 12138 }, // ↑
+    { 14, 13, 16, 1, 12, 46, 12184 }, // →
+    { 14, 13, 16, 1, 13, 46, 12230 }, // ↓
+    { 16, 11, 19, 1, 11, 44, 12276 }, // ↔
+    { 12, 16, 14, 1, 17, 48, 12320 }, // ↕
+    { 11, 10, 13, 1, 10, 28, 12368 }, // ↖
+    { 11, 10, 13, 1, 10, 28, 12396 }, // ↗
+    { 11, 11, 13, 1, 11, 31, 12424 }, // ↘
+    { 11, 11, 13, 1, 11, 31, 12455 }, // ↙
+    { 16, 13, 18, 1, 12, 52, 12486 }, // ⇐
+    { 17, 15, 19, 1, 15, 64, 12538 }, // ⇑
+    { 16, 13, 18, 1, 12, 52, 12602 }, // ⇒
+    { 17, 16, 19, 1, 15, 68, 12654 }, // ⇓
+    { 18, 13, 20, 1, 12, 59, 12722 }, // ⇔
+    { 14, 17, 16, 1, 11, 60, 0 }, // ⇕
+    { 12, 17, 14, 1, 17, 51, 60 }, // ∂
+    { 21, 20, 24, 2, 19, 105, 111 }, // ∅
+    { 16, 16, 18, 1, 16, 64, 216 }, // ∆
+    { 13, 15, 15, 1, 15, 49, 280 }, // ∏
+    { 13, 15, 15, 1, 15, 49, 329 }, // ∐
+    { 10, 16, 12, 1, 15, 40, 378 }, // ∑
+    { 10, 3, 13, 1, 7, 8, 418 }, // −
+    { 17, 18, 19, 1, 17, 77, 426 }, // √
+    { 17, 11, 19, 1, 13, 47, 503 }, // ∞
+    { 18, 24, 18, 0, 19, 108, 550 }, // ∫
+    { 5, 13, 6, 0, 13, 17, 658 }, // ∶
+    { 12, 11, 16, 2, 12, 33, 675 }, // ≈
+    { 14, 18, 23, 5, 16, 63, 708 }, // ≠
+    { 16, 16, 18, 1, 15, 64, 771 }, // ≤
+    { 16, 16, 18, 1, 15, 64, 835 }, // ≥
+    { 15, 17, 21, 3, 17, 64, 899 }, // ﬀ
+    { 13, 18, 18, 3, 18, 59, 963 }, // ﬁ
+    { 15, 17, 21, 3, 17, 64, 1022 }, // ﬂ
+    { 20, 18, 27, 3, 18, 90, 1086 }, // ﬃ
+    { 23, 17, 28, 3, 17, 98, 1176 }, // ﬄ
+    { 20, 16, 26, 3, 16, 80, 1274 }, // ﬆ
 };
 
 static const EpdUnicodeInterval opendyslexic_10_regularIntervals[] = {
@@ -2067,30 +2058,90 @@ static const EpdUnicodeInterval opendyslexic_10_regularIntervals[] = {
     { 0x2248, 0x2248, 0x2D1 },
     { 0x2260, 0x2260, 0x2D2 },
     { 0x2264, 0x2265, 0x2D3 },
+    { 0xFB00, 0xFB04, 0x2D5 },
+    { 0xFB06, 0xFB06, 0x2DA },
 };
 
 static const EpdFontGroup opendyslexic_10_regularGroups[] = {
-    { 0, 2966, 4656, 95, 0 },
-    { 2966, 2759, 5778, 96, 95 },
-    { 5725, 4189, 9298, 126, 191 },
-    { 9914, 489, 634, 61, 317 },
-    { 10403, 6716, 12817, 213, 378 },
-    { 17119, 913, 1453, 63, 591 },
-    { 18032, 341, 377, 20, 654 },
-    { 18373, 918, 1444, 20, 674 },
-    { 19291, 502, 749, 16, 694 },
-    { 19793, 538, 839, 15, 710 },
+    { 0, 4163, 8089, 151, 0 },
+    { 4163, 2118, 3480, 66, 379 },
+    { 6281, 5896, 12796, 241, 96 },
+    { 12177, 7083, 12781, 251, 386 },
+    { 19260, 831, 1354, 22, 709 },
+};
+
+static const uint8_t opendyslexic_10_regularGlyphGroups[731] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 0,
+    0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 2, 2, 2, 0,
+    0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 2, 2, 2, 2,
+    2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 3, 1, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 0, 0, 3, 3, 3, 0, 0, 3, 3, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+};
+
+static const uint16_t opendyslexic_10_regularGlyphLookup[368] = {
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x005F, 0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E,
+    0x006F, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E,
+    0x007F, 0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E,
+    0x008F, 0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E,
+    0x009F, 0x00A0, 0x00A1, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE,
+    0x00AF, 0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE,
+    0x024F, 0x0250, 0x0251, 0x0252, 0x0253, 0x0254, 0x0255, 0x0256, 0x0257, 0x0258, 0x0259, 0x025A, 0x025B, 0x025C, 0x025D, 0x025E,
+    0x025F, 0x0260, 0x0261, 0x0262, 0x0263, 0x0264, 0x0265, 0x0266, 0x0267, 0x0268, 0x0269, 0x026A, 0x026B, 0x026C, 0x026D, 0x026E,
+    0x026F, 0x0270, 0x0271, 0x0272, 0x0273, 0x0274, 0x0275, 0x0276, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0277,
+    0x0278, 0xFFFF, 0x0279, 0x027A, 0x027B, 0x027C, 0x027D, 0x027E, 0x027F, 0x0280, 0x0281, 0x0282, 0x0283, 0x0284, 0x0285, 0x0286,
+    0xFFFF, 0xFFFF, 0x0287, 0xFFFF, 0x0288, 0xFFFF, 0xFFFF, 0x0289, 0x028A, 0x028B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x028C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x028D,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
 };
 
 static const EpdFontData opendyslexic_10_regular = {
     opendyslexic_10_regularBitmaps,
     opendyslexic_10_regularGlyphs,
     opendyslexic_10_regularIntervals,
-    56,
+    58,
     38,
     28,
     -11,
     true,
     opendyslexic_10_regularGroups,
-    10,
+    5,
+    nullptr,
+    nullptr,
+    nullptr,
+    0,
+    nullptr,
+    0,
+    0,
+    opendyslexic_10_regularGlyphLookup,
+    opendyslexic_10_regularGlyphGroups,
+    false,
+    nullptr,
 };
@@ -3,1819 +3,1804 @@
  * name: opendyslexic_12_bold
  * size: 12
  * mode: 2-bit  compressed: true
- * Command used: fontconvert.py opendyslexic_12_bold 12 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Bold.otf --2bit --compress
+ * Command used: fontconvert.py opendyslexic_12_bold 12 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Bold.otf --2bit --compress --no-kerning --frequency-corpus ../../../test/hyphenation_eval/resources/english_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/french_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/german_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/italian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/russian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/spanish_hyphenation_tests.txt
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t opendyslexic_12_boldBitmaps[28911] = {
-    0x6D, 0x59, 0xBF, 0x8F, 0xDD, 0xD6, 0x95, 0xBE, 0x24, 0x57, 0x22, 0x12, 0x22, 0xA1, 0x8A, 0x28,
-    0x48, 0x56, 0xD8, 0x65, 0x8A, 0x34, 0x11, 0x10, 0x33, 0x7F, 0x80, 0x9D, 0x4B, 0x47, 0x48, 0x54,
-    0xA8, 0x90, 0x16, 0xBB, 0x63, 0x2F, 0xB0, 0x85, 0xD2, 0xC6, 0x40, 0x30, 0x4D, 0x8A, 0x14, 0x8E,
-    0xC8, 0xD8, 0xD8, 0xB8, 0x50, 0xA1, 0x29, 0x9C, 0xCA, 0x45, 0x54, 0xD8, 0x41, 0x32, 0x29, 0xC6,
-    0xA5, 0x0B, 0x47, 0xA4, 0x34, 0xC0, 0xAA, 0x98, 0x62, 0x68, 0x0D, 0x8C, 0x14, 0x2A, 0x4C, 0xCB,
-    0xDA, 0x0D, 0xE0, 0x14, 0xC3, 0x48, 0xB4, 0xC4, 0xA7, 0x5C, 0xF2, 0xEC, 0xF7, 0x9D, 0xCB, 0x37,
-    0x33, 0xCA, 0xEE, 0x7B, 0x8F, 0xBC, 0x7C, 0x7C, 0x97, 0xF7, 0x9E, 0x7B, 0xCF, 0x77, 0xBE, 0xF3,
-    0xE3, 0x19, 0x13, 0x9A, 0xA8, 0x89, 0x7A, 0xFF, 0x8E, 0xF5, 0x9D, 0xE0, 0x9D, 0x1E, 0xBD, 0xA3,
-    0xDE, 0xBC, 0x6F, 0xCE, 0x98, 0xA3, 0x57, 0x36, 0xE4, 0x83, 0x1D, 0xF1, 0x76, 0xA5, 0xAB, 0x5D,
-    0xC9, 0x16, 0xDF, 0xCB, 0xDE, 0xF6, 0x65, 0x77, 0xF2, 0x28, 0x7B, 0xBE, 0x5F, 0xDB, 0x3A, 0x7F,
-    0xD3, 0x18, 0x5B, 0xD4, 0x7C, 0x74, 0x69, 0xCA, 0x42, 0xB4, 0x31, 0x33, 0x9B, 0xDA, 0x37, 0xC2,
-    0x26, 0x11, 0xBE, 0x5C, 0xAA, 0xCD, 0xE8, 0x9B, 0xE1, 0xD4, 0x2B, 0xF2, 0xEA, 0xBC, 0x71, 0xC5,
-    0x84, 0x73, 0xE4, 0xD0, 0x31, 0x9C, 0xB4, 0x89, 0xD6, 0x4D, 0x8C, 0xC6, 0xF7, 0xEC, 0x33, 0xDF,
-    0x58, 0x6D, 0xBA, 0xB3, 0x57, 0xA7, 0xAB, 0xAB, 0x8D, 0xC2, 0x24, 0x2E, 0x1D, 0xD0, 0x33, 0x5D,
-    0x9A, 0x31, 0xED, 0xB5, 0xC9, 0xD8, 0x7C, 0xF9, 0xDD, 0x7F, 0xBC, 0x79, 0xB4, 0xB2, 0xA4, 0xE5,
-    0xF0, 0xEC, 0x64, 0xFE, 0xA8, 0xE2, 0x6E, 0x19, 0x13, 0x63, 0x3C, 0x8A, 0x35, 0xF0, 0xE4, 0x4C,
-    0x24, 0xF5, 0xBF, 0x9B, 0x40, 0x2E, 0x37, 0x90, 0x7B, 0xB7, 0xE7, 0x66, 0x38, 0xF6, 0xE1, 0xB2,
-    0x44, 0x56, 0x2A, 0x08, 0x9E, 0xAF, 0x45, 0x5A, 0x13, 0xD4, 0x32, 0xE1, 0xC6, 0xA1, 0x34, 0x26,
-    0xEA, 0xEB, 0x21, 0x2E, 0x5C, 0x3A, 0xE1, 0xF1, 0x44, 0x2E, 0x50, 0xBA, 0x5D, 0x9E, 0x1A, 0x74,
-    0x94, 0x2A, 0xD8, 0xE1, 0x93, 0x26, 0xC3, 0x98, 0x26, 0xA6, 0x50, 0x01, 0x17, 0x66, 0xAE, 0x99,
-    0x13, 0xAF, 0xAF, 0xF1, 0x94, 0xB2, 0x47, 0x38, 0x9A, 0xBC, 0x32, 0xD6, 0x64, 0x62, 0xD2, 0x2E,
-    0xEA, 0x3E, 0x40, 0xE7, 0x17, 0xE3, 0xC6, 0x16, 0x51, 0xF3, 0x62, 0xD2, 0x9B, 0x97, 0x92, 0xDB,
-    0x14, 0x72, 0xB4, 0x15, 0x3A, 0x70, 0xB0, 0xBC, 0xD2, 0xDD, 0xCD, 0xEF, 0x8C, 0x18, 0x7C, 0xC0,
-    0x5A, 0x8C, 0xBC, 0x90, 0x34, 0x26, 0x3F, 0x68, 0x5E, 0x34, 0xD1, 0xF8, 0x62, 0xD4, 0x18, 0x89,
-    0xBA, 0x0F, 0x4D, 0xD6, 0xE5, 0x52, 0x61, 0x43, 0xD1, 0xA1, 0x2E, 0x30, 0x85, 0xEE, 0x91, 0xD9,
-    0xDC, 0xE2, 0x8A, 0xB0, 0xA0, 0x09, 0x43, 0xC5, 0x40, 0x89, 0xC9, 0x0D, 0x1E, 0xFE, 0x10, 0x4D,
-    0xE0, 0x30, 0x71, 0xE4, 0x6C, 0x8B, 0xD9, 0x30, 0x43, 0x84, 0x05, 0x9B, 0x1C, 0x72, 0x87, 0xD8,
-    0xA4, 0xB7, 0xB3, 0x47, 0x53, 0x3C, 0xD4, 0x2F, 0x4F, 0xF9, 0xAE, 0x0B, 0x66, 0x49, 0xC7, 0x40,
-    0x06, 0x3B, 0xBF, 0xEA, 0x97, 0x5B, 0x70, 0xE1, 0xD8, 0xAC, 0xF1, 0x7D, 0xB3, 0x89, 0x65, 0xBF,
-    0xF6, 0x5B, 0xD9, 0x93, 0x7C, 0xAC, 0xEF, 0xC9, 0xA5, 0x29, 0x1F, 0xA4, 0x33, 0x71, 0x67, 0x6C,
-    0x15, 0x3A, 0x93, 0xB5, 0x80, 0x44, 0x3C, 0x18, 0xDB, 0x04, 0xB3, 0xC1, 0xCA, 0xD0, 0x4E, 0xBE,
-    0xC5, 0xFD, 0x08, 0x12, 0x76, 0xA6, 0xAC, 0xF0, 0x53, 0xAC, 0x97, 0xFE, 0x2E, 0x3A, 0x8C, 0x26,
-    0xF3, 0x7D, 0xAA, 0x00, 0x37, 0xF0, 0xA4, 0x83, 0xAA, 0x4D, 0x8E, 0x71, 0xB0, 0x32, 0xEA, 0x37,
-    0x2F, 0x80, 0x38, 0x60, 0x2D, 0x9C, 0x20, 0xBE, 0x49, 0x06, 0x2E, 0x35, 0x6F, 0x30, 0x27, 0x06,
-    0xC0, 0xB4, 0xB1, 0xDE, 0xD0, 0xE1, 0xF0, 0x2D, 0xD1, 0xDF, 0x6A, 0xF6, 0xD4, 0xBB, 0x14, 0x65,
-    0x34, 0xB6, 0xC5, 0xD8, 0x18, 0xB5, 0x6C, 0x43, 0x6D, 0xA5, 0x89, 0x67, 0x8C, 0x1F, 0x4A, 0xA1,
-    0xBA, 0x3A, 0x0D, 0x35, 0x59, 0x53, 0xFC, 0xD8, 0x65, 0xD1, 0x93, 0x27, 0x2E, 0x07, 0x80, 0x72,
-    0x20, 0x21, 0x06, 0x0E, 0x4A, 0x19, 0x00, 0x90, 0xD1, 0x1E, 0xEE, 0x34, 0x3F, 0xBF, 0xF5, 0x15,
-    0xF3, 0x03, 0xE8, 0x24, 0xD9, 0x3A, 0xD2, 0x31, 0xE6, 0xE3, 0x6C, 0xC7, 0x0D, 0xB6, 0x6B, 0x0F,
-    0xA0, 0x43, 0xD3, 0x3C, 0xFF, 0x5B, 0x80, 0x55, 0xCE, 0xD9, 0x04, 0x44, 0xBB, 0x6C, 0xB4, 0xB0,
-    0xBC, 0xBA, 0x7B, 0xAD, 0x2A, 0x45, 0xEE, 0xA2, 0x37, 0x9A, 0xE6, 0xD4, 0x0F, 0x26, 0xFB, 0xD9,
-    0x6C, 0x9F, 0xCA, 0x7A, 0xE4, 0xC6, 0x23, 0x0B, 0x8A, 0x85, 0x2E, 0xD5, 0xF4, 0x74, 0x1C, 0xEE,
-    0x9C, 0x89, 0x06, 0x3F, 0xB5, 0x9A, 0xA1, 0x2D, 0x3C, 0x10, 0xB1, 0x70, 0x6E, 0xB2, 0x09, 0x26,
-    0xB5, 0x50, 0xC3, 0x1D, 0xD1, 0xDE, 0xD8, 0x1F, 0x13, 0xAD, 0x7B, 0x97, 0xC5, 0x32, 0x0C, 0x7A,
-    0x43, 0x0F, 0xDC, 0x53, 0x1A, 0xB2, 0xEF, 0x9D, 0x75, 0xFE, 0x07, 0xF6, 0x0E, 0xD8, 0xBB, 0x2E,
-    0x96, 0x1F, 0x70, 0x13, 0xBB, 0x48, 0x75, 0xF9, 0xDE, 0x1C, 0xC6, 0xA2, 0xFD, 0x2A, 0x8E, 0x53,
-    0x2A, 0x70, 0xE0, 0x11, 0x55, 0x4A, 0x17, 0x8D, 0x59, 0x9B, 0x37, 0x79, 0x83, 0x0D, 0xBE, 0x38,
-    0xBC, 0x3F, 0xE7, 0x7B, 0x8F, 0x9D, 0xF8, 0xD3, 0xFE, 0x23, 0x27, 0xF6, 0xEE, 0x67, 0x4E, 0x7E,
-    0x94, 0x3E, 0x12, 0x53, 0xEF, 0xCD, 0xF1, 0x9C, 0x71, 0x73, 0xBD, 0x59, 0x19, 0xDA, 0x2D, 0xD0,
-    0x66, 0xCA, 0x8E, 0x0B, 0x48, 0xC4, 0xE4, 0x62, 0xAC, 0x98, 0x97, 0xC4, 0x7C, 0x4B, 0x74, 0xDA,
-    0x13, 0x9F, 0x60, 0xFD, 0x09, 0xF9, 0xDC, 0xF1, 0xCB, 0x9C, 0xA5, 0x15, 0x17, 0xA5, 0x4C, 0xA4,
-    0x81, 0x6B, 0x45, 0xFD, 0x2B, 0x5D, 0x0D, 0x96, 0xCC, 0x06, 0x6B, 0x81, 0xF2, 0xA9, 0xF5, 0x1A,
-    0x58, 0x74, 0x98, 0xA0, 0x48, 0xA5, 0xA5, 0x01, 0x40, 0x86, 0x3F, 0x89, 0x4C, 0x10, 0xE3, 0x13,
-    0x91, 0xF9, 0xB4, 0x6C, 0x85, 0x20, 0x04, 0xDC, 0x8C, 0xB6, 0x94, 0xAC, 0xB0, 0x07, 0xBE, 0x89,
-    0x5D, 0x20, 0x14, 0xAC, 0x8D, 0x20, 0xE9, 0xD9, 0x4D, 0x8E, 0x09, 0xDE, 0x98, 0xFF, 0xB9, 0x28,
-    0x1F, 0xE0, 0x39, 0x3F, 0x0A, 0xD5, 0x1F, 0xD4, 0x33, 0xB6, 0xE8, 0x17, 0x5E, 0x25, 0xB6, 0xC3,
-    0x9C, 0x30, 0x6F, 0x6C, 0xE9, 0x0C, 0x58, 0xDE, 0xEF, 0xCD, 0xAD, 0xBC, 0x89, 0x7B, 0xAC, 0xEE,
-    0x82, 0x0B, 0x41, 0x6E, 0x00, 0xDC, 0x04, 0xD9, 0x9F, 0xE2, 0xF8, 0xF8, 0x95, 0x1D, 0x3C, 0x88,
-    0x31, 0x0D, 0x84, 0xE4, 0x76, 0x67, 0xC3, 0x82, 0x88, 0xC8, 0xD3, 0xA4, 0x36, 0xF8, 0xD6, 0x2B,
-    0x24, 0xA8, 0xDB, 0x52, 0xB6, 0xB0, 0xD6, 0x16, 0x28, 0x3A, 0xFD, 0xEB, 0xAB, 0x7E, 0x91, 0xD1,
-    0x74, 0xC6, 0xD8, 0x83, 0x87, 0xD9, 0x64, 0x15, 0x61, 0x23, 0x04, 0x02, 0x8A, 0xAB, 0x73, 0x73,
-    0x05, 0x75, 0xBD, 0x57, 0x60, 0x6D, 0x58, 0xB0, 0xE3, 0x50, 0xB0, 0x59, 0xC2, 0x8B, 0xC3, 0x65,
-    0x7B, 0x2B, 0xE0, 0x77, 0xC6, 0xDD, 0x39, 0x95, 0x77, 0x9C, 0xED, 0x93, 0x51, 0xAA, 0xF4, 0xF1,
-    0x64, 0xEC, 0x1E, 0x0C, 0x26, 0x1B, 0x12, 0x87, 0xD1, 0x3A, 0x2A, 0xAA, 0x86, 0xA2, 0xC8, 0x04,
-    0x4A, 0x9E, 0x0E, 0x52, 0xEF, 0x93, 0x68, 0x83, 0xB2, 0x51, 0x48, 0x01, 0x34, 0xA4, 0x6D, 0x51,
-    0xD8, 0x40, 0x3D, 0x5C, 0x3E, 0xAC, 0x8D, 0xB6, 0x9C, 0x42, 0x3C, 0x18, 0x55, 0xE6, 0x70, 0x1F,
-    0x06, 0x3C, 0xC2, 0xC4, 0x0A, 0x73, 0x6E, 0x45, 0x26, 0x6E, 0xA2, 0xB9, 0xEE, 0xD4, 0x8D, 0x75,
-    0xD1, 0x80, 0x03, 0xDB, 0x12, 0x0F, 0xC9, 0xBC, 0x09, 0x1B, 0x05, 0xC5, 0x94, 0x52, 0xA1, 0xED,
-    0xD3, 0x21, 0x19, 0xF3, 0x8E, 0x1C, 0x16, 0x4E, 0xB6, 0x8D, 0x26, 0xBB, 0xBA, 0x3A, 0x65, 0xDE,
-    0xFB, 0x0C, 0x11, 0x19, 0x3C, 0x7F, 0xA6, 0x14, 0x98, 0xC9, 0x10, 0xB0, 0x7B, 0x97, 0xF5, 0xD7,
-    0x4C, 0x76, 0x07, 0x3C, 0x00, 0xFA, 0xBF, 0x65, 0x61, 0x34, 0x1F, 0x9A, 0xF4, 0x11, 0xCC, 0x74,
-    0x57, 0x6A, 0xA1, 0x77, 0xC0, 0xD1, 0x87, 0x75, 0x0D, 0xF5, 0xCE, 0xA7, 0xC0, 0x2C, 0x44, 0x22,
-    0x96, 0x4F, 0xE8, 0x7C, 0x59, 0x19, 0x1E, 0xC8, 0xE9, 0x40, 0xFC, 0xA9, 0x2B, 0x1F, 0x91, 0x2E,
-    0x17, 0xA7, 0x03, 0x03, 0xC6, 0xCD, 0xCC, 0xD5, 0xB4, 0xC3, 0xD9, 0xD4, 0x8D, 0xED, 0x53, 0x17,
-    0xCB, 0xCB, 0xC7, 0x5D, 0xE8, 0xA7, 0xB6, 0x23, 0x0C, 0xD6, 0xD9, 0x01, 0x3F, 0xCD, 0x80, 0x9C,
-    0x34, 0x65, 0x7F, 0xFC, 0xEB, 0xB7, 0x8D, 0xB7, 0x3F, 0x53, 0x92, 0x51, 0xBC, 0x07, 0xA2, 0x03,
-    0x18, 0x81, 0x69, 0xEC, 0x89, 0x52, 0x78, 0x2A, 0x34, 0x54, 0x01, 0x1E, 0xB0, 0xC6, 0x49, 0x7D,
-    0xD4, 0xB8, 0xF8, 0xA8, 0xD3, 0x3C, 0x99, 0x84, 0x27, 0xF3, 0x4D, 0x18, 0x5F, 0x91, 0xAB, 0xFD,
-    0xCC, 0x5C, 0xD3, 0x59, 0xCF, 0x69, 0x26, 0x78, 0xE5, 0x77, 0xD8, 0x93, 0x01, 0xCF, 0x76, 0x32,
-    0x6F, 0x57, 0x7A, 0x8F, 0x9E, 0x93, 0x88, 0xC4, 0xB0, 0x24, 0x02, 0x0A, 0x9C, 0x08, 0x69, 0x40,
-    0xD4, 0xDC, 0xD5, 0x25, 0x60, 0xBB, 0x31, 0x61, 0x65, 0xCE, 0xE1, 0xDE, 0x26, 0x26, 0xC6, 0xB1,
-    0x0A, 0xE9, 0x2A, 0xB5, 0x67, 0xFE, 0x10, 0x1D, 0xDF, 0x3D, 0x0E, 0x2D, 0x68, 0x4E, 0x80, 0x09,
-    0x26, 0xC9, 0x57, 0x57, 0x87, 0x14, 0x1E, 0x29, 0x50, 0x52, 0x51, 0x1A, 0x5A, 0x0E, 0x5E, 0xD3,
-    0xFC, 0x48, 0x21, 0x35, 0xDC, 0x12, 0xA6, 0xE1, 0xFC, 0x44, 0xC3, 0x73, 0x07, 0x66, 0xFF, 0x92,
-    0x79, 0xFE, 0x75, 0xEA, 0x8A, 0xA7, 0x24, 0x32, 0x50, 0x8E, 0xC3, 0xF2, 0x50, 0x93, 0xF8, 0x07,
-    0xD5, 0x0E, 0xE4, 0xA4, 0x9B, 0x57, 0x7B, 0x01, 0x96, 0xC1, 0x77, 0xF0, 0x76, 0x98, 0x2E, 0x69,
-    0xE2, 0xEE, 0x85, 0x3E, 0x35, 0x36, 0x3A, 0x6C, 0xBE, 0x1B, 0x8C, 0xFF, 0x94, 0x16, 0x1F, 0x24,
-    0xDD, 0xFB, 0xDF, 0x0D, 0x3B, 0x7B, 0xA1, 0xFA, 0x59, 0x52, 0xCD, 0x5F, 0x0D, 0xBA, 0x97, 0xA2,
-    0xF1, 0x85, 0x9D, 0x37, 0x10, 0x2E, 0x95, 0x92, 0x57, 0xB6, 0x2D, 0xC1, 0x07, 0x40, 0x70, 0x09,
-    0xAF, 0xC2, 0xBD, 0x22, 0x40, 0xCF, 0xC0, 0xE8, 0x56, 0x9B, 0x0D, 0x23, 0x0A, 0x88, 0x8B, 0xF3,
-    0xCC, 0xFB, 0x42, 0x2E, 0xDD, 0x9C, 0x8F, 0xBC, 0x00, 0x09, 0x92, 0x7E, 0xCB, 0xE8, 0xE2, 0x96,
-    0xAD, 0x0D, 0xB8, 0x57, 0xC6, 0x1E, 0xE2, 0xB7, 0x68, 0xA5, 0x7B, 0x7B, 0xB9, 0xE7, 0x4A, 0x60,
-    0x1C, 0xC1, 0x4C, 0xC5, 0xDB, 0x96, 0x76, 0xEA, 0xF8, 0x5C, 0xDD, 0x60, 0x75, 0xE9, 0xBC, 0x2D,
-    0x45, 0xC0, 0x18, 0x8A, 0x5C, 0x04, 0x73, 0x10, 0x4E, 0x47, 0xF7, 0x0B, 0x6C, 0x41, 0x8E, 0x97,
-    0x21, 0x4F, 0x3E, 0x62, 0xE9, 0x01, 0x21, 0xFA, 0x90, 0x9D, 0x1A, 0x5A, 0x5F, 0x34, 0x9D, 0x92,
-    0x0A, 0x3E, 0xAD, 0x87, 0xAB, 0x73, 0xD8, 0xA9, 0x1A, 0x1B, 0x5D, 0x56, 0x1C, 0x81, 0xD6, 0xCA,
-    0x28, 0x2B, 0xC2, 0xC8, 0xE0, 0x9A, 0x78, 0xC2, 0x84, 0xF5, 0x0D, 0xD8, 0xC2, 0xE3, 0x79, 0xA3,
-    0xA6, 0xD5, 0x92, 0xAE, 0xE4, 0xF2, 0x12, 0xD9, 0x10, 0xF7, 0x0B, 0x70, 0x80, 0xAE, 0x15, 0x57,
-    0xDB, 0x45, 0x84, 0x1D, 0x7F, 0xCB, 0xE5, 0x99, 0xD3, 0x78, 0x81, 0x0B, 0xA4, 0xAA, 0x02, 0xEE,
-    0x51, 0x4E, 0x8F, 0xC0, 0xC5, 0x52, 0x21, 0xFE, 0xC2, 0xAD, 0xE3, 0x0A, 0xD9, 0xFA, 0xFA, 0xED,
-    0x75, 0x5C, 0xD8, 0x80, 0x9A, 0x5C, 0xC8, 0x0B, 0x0D, 0xC8, 0xCE, 0xE9, 0x64, 0x2B, 0x12, 0x9A,
-    0x02, 0x47, 0x79, 0x16, 0xB7, 0xFE, 0x73, 0x53, 0x76, 0x11, 0x1C, 0xC8, 0xE5, 0x11, 0xBB, 0x49,
-    0xCE, 0x70, 0x98, 0x24, 0x7D, 0x8C, 0x0D, 0xB2, 0xFB, 0x04, 0x0E, 0x6E, 0x45, 0x47, 0xB7, 0x64,
-    0x7F, 0x0C, 0x36, 0x85, 0x0F, 0x8E, 0xA4, 0xFD, 0x03, 0x9E, 0xD2, 0x25, 0x92, 0x9C, 0x8D, 0xAE,
-    0xE5, 0xFC, 0x1F, 0xE4, 0x0B, 0x51, 0xFE, 0x93, 0x4C, 0x9E, 0xBD, 0x0B, 0xC5, 0xD2, 0xA7, 0x71,
-    0xEF, 0xE9, 0xE7, 0xEA, 0xCF, 0x27, 0x88, 0x34, 0x10, 0x3B, 0xB0, 0x9D, 0x02, 0x14, 0x10, 0xCE,
-    0x1E, 0xA1, 0xF6, 0xD9, 0xF6, 0xBB, 0x78, 0xE6, 0xB1, 0xE7, 0x35, 0x81, 0xF0, 0x33, 0x57, 0x72,
-    0x7E, 0x87, 0xFB, 0x44, 0x0E, 0xDC, 0x95, 0xED, 0x7F, 0xB3, 0x8B, 0x43, 0xA9, 0xD6, 0xBC, 0x4C,
-    0xCE, 0x40, 0xD7, 0x78, 0xDA, 0x28, 0x80, 0x22, 0xC4, 0x30, 0x50, 0xEB, 0xC9, 0x06, 0xEA, 0x4B,
-    0x8F, 0x1B, 0x6C, 0x31, 0xB8, 0x38, 0x5F, 0xB4, 0x3D, 0x7B, 0x95, 0x63, 0xD3, 0xCE, 0xDE, 0x4C,
-    0x09, 0x96, 0x58, 0x14, 0x81, 0xD4, 0x07, 0x39, 0x40, 0x51, 0xCF, 0xE7, 0xBE, 0x53, 0x44, 0x50,
-    0x35, 0x28, 0xB7, 0x81, 0xEC, 0xE5, 0x00, 0x5A, 0xFC, 0x0B, 0x7A, 0x96, 0x2B, 0x98, 0x2C, 0x00,
-    0x20, 0x6F, 0xFF, 0x87, 0x4B, 0x96, 0x58, 0xCD, 0xA3, 0x83, 0xB1, 0x21, 0xC3, 0x5B, 0xF5, 0x46,
-    0x10, 0xCB, 0x7E, 0x44, 0xE7, 0x79, 0x11, 0x78, 0x9A, 0x08, 0xB9, 0x81, 0xB7, 0x1E, 0xF0, 0xD6,
-    0x75, 0xDC, 0x9A, 0x61, 0x5F, 0xE9, 0x58, 0xEB, 0xAD, 0x02, 0xB7, 0x18, 0x00, 0xE5, 0xAB, 0x8D,
-    0x4D, 0xBA, 0x33, 0x79, 0x24, 0xCB, 0x76, 0xE8, 0x9E, 0x13, 0x3D, 0xD8, 0x20, 0x70, 0xF2, 0x3E,
-    0xC2, 0x2B, 0x01, 0x91, 0xE7, 0x0E, 0x32, 0xD4, 0xBD, 0x5C, 0x1F, 0x6B, 0x7C, 0xDE, 0x1A, 0xCB,
-    0xE5, 0xE3, 0xCA, 0xBB, 0xAE, 0xDC, 0x73, 0xF5, 0x9E, 0x93, 0x4F, 0x26, 0x22, 0x23, 0x1D, 0xBD,
-    0xCB, 0xA4, 0x41, 0x39, 0x6F, 0xD7, 0xDC, 0x7B, 0x08, 0xC1, 0x5D, 0x82, 0x8E, 0x69, 0x7E, 0x74,
-    0x7C, 0xF4, 0x21, 0xDA, 0xD1, 0x68, 0xC7, 0x7C, 0xE9, 0x38, 0x2F, 0x43, 0x74, 0xDF, 0xBF, 0x08,
-    0x9B, 0x10, 0x17, 0x6B, 0xB0, 0xC6, 0x25, 0x0F, 0xC1, 0xCE, 0xBC, 0x10, 0x34, 0x38, 0x17, 0xCF,
-    0xC2, 0xC7, 0xC3, 0x5D, 0x42, 0x4F, 0x88, 0x25, 0xD3, 0xBF, 0x62, 0xD8, 0x72, 0x1F, 0x5E, 0x6A,
-    0x46, 0x78, 0x11, 0xFF, 0x4D, 0x88, 0xD1, 0x85, 0x75, 0x23, 0xD1, 0x7C, 0x04, 0xC2, 0x59, 0xC2,
-    0x1A, 0xA8, 0x24, 0xFA, 0x1B, 0xB2, 0x2E, 0xF8, 0x60, 0x9F, 0x9B, 0x9D, 0x49, 0x9B, 0x38, 0x9C,
-    0x2C, 0xE6, 0xEA, 0xA8, 0xA9, 0x6E, 0xED, 0xA2, 0x9D, 0xE7, 0x27, 0x92, 0x80, 0x98, 0xA3, 0xAF,
-    0xD8, 0xD8, 0xB5, 0xE0, 0x99, 0xFF, 0xBA, 0x5E, 0xA1, 0xAE, 0xE3, 0x50, 0x7D, 0xFD, 0x27, 0x1E,
-    0x5D, 0x74, 0xFD, 0x03, 0x34, 0x1C, 0x41, 0x58, 0xC8, 0xD8, 0x83, 0x87, 0x52, 0x21, 0x47, 0xCA,
-    0x50, 0x32, 0xD4, 0xB8, 0x48, 0xDF, 0x86, 0x4B, 0x84, 0x8B, 0x17, 0x69, 0x50, 0xB8, 0x6C, 0x45,
-    0x2E, 0xFD, 0x4D, 0x72, 0x38, 0xF6, 0x9D, 0xA7, 0xB3, 0x5C, 0x5F, 0x61, 0xAC, 0xB1, 0xDE, 0x87,
-    0x5A, 0xAE, 0x43, 0x59, 0x37, 0x46, 0xB8, 0xB7, 0x2F, 0x64, 0x1F, 0x50, 0xCD, 0x9C, 0xDC, 0x96,
-    0x4F, 0x71, 0x99, 0x4E, 0x50, 0x50, 0x5B, 0xDF, 0x91, 0x7D, 0x24, 0x5F, 0x16, 0x97, 0x98, 0x8D,
-    0xC0, 0xC2, 0xB6, 0x40, 0xD5, 0xF0, 0xC7, 0xD9, 0xA7, 0xD2, 0x06, 0x33, 0x02, 0xAE, 0xEC, 0x81,
-    0x0C, 0x21, 0x2E, 0x9A, 0xFC, 0x40, 0x26, 0x78, 0x59, 0x80, 0x1B, 0xC6, 0x75, 0x61, 0xB2, 0x4F,
-    0x1D, 0x2E, 0xEC, 0x81, 0xB3, 0x8F, 0x66, 0x7B, 0x57, 0xD2, 0xA7, 0xAE, 0xEC, 0x6B, 0x18, 0x57,
-    0x8C, 0x70, 0x07, 0xD0, 0xDB, 0x93, 0x80, 0x17, 0x29, 0x30, 0x62, 0x40, 0x2E, 0x3D, 0x97, 0x82,
-    0x28, 0x8A, 0x9E, 0x44, 0xFD, 0x1A, 0xB6, 0x38, 0x93, 0x77, 0x00, 0xCA, 0x09, 0xB4, 0x91, 0x90,
-    0xD0, 0xC8, 0x7C, 0x25, 0xF1, 0x98, 0xBA, 0x9A, 0xBB, 0x45, 0xD5, 0x97, 0x34, 0x74, 0x86, 0x1C,
-    0x40, 0x80, 0xAA, 0xA2, 0xD4, 0x9B, 0xDC, 0xB6, 0x47, 0x1C, 0xC6, 0xD5, 0xF3, 0xBF, 0x94, 0xA2,
-    0x39, 0xE3, 0x9B, 0x3C, 0x31, 0xE8, 0x91, 0x3E, 0x51, 0xA0, 0x97, 0x3C, 0xC1, 0x3B, 0x1E, 0x47,
-    0xE7, 0xC6, 0x53, 0x18, 0x03, 0xF8, 0xC1, 0x82, 0x63, 0x61, 0x3A, 0x07, 0xC0, 0xC5, 0x8D, 0x1E,
-    0x93, 0x7D, 0xBC, 0x43, 0xDE, 0xF8, 0x93, 0x72, 0x83, 0x1A, 0x2E, 0xA8, 0x77, 0xEB, 0x48, 0x3F,
-    0xAD, 0x1A, 0x1F, 0x64, 0x55, 0x6A, 0x03, 0xB2, 0x23, 0xF5, 0x09, 0xE6, 0x35, 0x5A, 0xA4, 0x25,
-    0x6E, 0x12, 0x9A, 0xAE, 0xF7, 0xC8, 0x88, 0x61, 0x4A, 0x4D, 0x56, 0x6C, 0x4F, 0x9D, 0x97, 0xAD,
-    0xDA, 0x79, 0xA5, 0xD8, 0xF5, 0x20, 0xD0, 0x10, 0xB2, 0xCF, 0x14, 0x26, 0x25, 0x81, 0x12, 0x28,
-    0x54, 0xE2, 0xC9, 0x5C, 0xC9, 0xFA, 0x74, 0x8C, 0x06, 0x44, 0x10, 0xD3, 0xD5, 0x35, 0xDD, 0xAB,
-    0xF5, 0x56, 0x74, 0x05, 0x0C, 0x93, 0x18, 0xFD, 0xF0, 0x1A, 0x8F, 0x6D, 0xEA, 0x19, 0x0B, 0x6D,
-    0x8C, 0x07, 0xEE, 0xFA, 0xAC, 0x8E, 0xF0, 0x21, 0x65, 0xA2, 0xDB, 0x70, 0x08, 0xF4, 0xCB, 0xC2,
-    0x56, 0x49, 0x97, 0x76, 0xA1, 0x83, 0xB7, 0x67, 0xBA, 0x6E, 0x1B, 0x5B, 0xE5, 0x74, 0x07, 0x03,
-    0xA0, 0x8D, 0xEC, 0x0E, 0xBD, 0x98, 0x76, 0x64, 0x13, 0xE2, 0xBA, 0x29, 0x10, 0x84, 0xA7, 0x25,
-    0xEC, 0x25, 0x1B, 0xF3, 0x31, 0x96, 0x74, 0x0E, 0x40, 0xA8, 0x4D, 0x39, 0x32, 0x3D, 0x5F, 0x82,
-    0x19, 0x0C, 0x4F, 0xBA, 0x24, 0x65, 0x35, 0x81, 0x3C, 0x9B, 0x18, 0x7B, 0x9C, 0xD1, 0x38, 0x55,
-    0xF3, 0x01, 0x75, 0x7F, 0x09, 0x09, 0x2B, 0x63, 0xDC, 0x64, 0xA9, 0xF4, 0x9C, 0x6E, 0x39, 0x59,
-    0x24, 0x6F, 0x96, 0x9F, 0x93, 0x39, 0xEA, 0xE8, 0xC7, 0xA6, 0x1F, 0xC9, 0x3D, 0xF1, 0xBB, 0x4F,
-    0x40, 0x63, 0xED, 0xA7, 0x8F, 0xFC, 0xCF, 0x06, 0x5E, 0xFF, 0x2A, 0x8B, 0x81, 0xD0, 0x42, 0xD4,
-    0x44, 0x30, 0xB9, 0x56, 0x03, 0xFC, 0x9C, 0xC5, 0x92, 0x8C, 0xFC, 0xDD, 0xAD, 0xD9, 0x78, 0x7A,
-    0x50, 0x22, 0x51, 0x27, 0xC5, 0xC8, 0x93, 0x51, 0x8A, 0xD1, 0xB4, 0x22, 0xA0, 0x20, 0xCA, 0xAE,
-    0x19, 0x95, 0x04, 0x1B, 0x83, 0x87, 0x4B, 0x67, 0x5C, 0xD4, 0x87, 0x58, 0xD3, 0xF1, 0x05, 0x20,
-    0x59, 0xDF, 0x47, 0x36, 0x39, 0x2D, 0x17, 0x31, 0x2F, 0x4A, 0x5E, 0x10, 0xAD, 0x20, 0x35, 0x18,
-    0x33, 0x06, 0x84, 0x01, 0x3C, 0x53, 0x9F, 0xA0, 0x3E, 0x74, 0xCC, 0x17, 0xF2, 0xED, 0x74, 0xAF,
-    0x14, 0x82, 0xF0, 0x3A, 0xA2, 0x24, 0xF7, 0x26, 0xD1, 0xD4, 0xD2, 0x8B, 0xF7, 0x24, 0x5A, 0x7A,
-    0x7E, 0x00, 0x80, 0x1A, 0x43, 0xAE, 0x0B, 0xB9, 0x20, 0x15, 0xE5, 0x61, 0x94, 0x98, 0x8F, 0xC8,
-    0xCB, 0xA1, 0x07, 0x3C, 0x21, 0xF7, 0x95, 0xA9, 0x44, 0x83, 0x10, 0x52, 0x0E, 0xEB, 0x01, 0xB9,
-    0x68, 0x09, 0x43, 0x93, 0x31, 0xCD, 0xDD, 0xFC, 0xAA, 0xBA, 0x63, 0xE0, 0xB7, 0x1A, 0x1D, 0xD6,
-    0x9D, 0xBA, 0x8D, 0xD2, 0x7B, 0x0F, 0x75, 0x22, 0x4C, 0x3E, 0x97, 0x8A, 0x90, 0xF9, 0x09, 0x45,
-    0x41, 0x68, 0x0F, 0xE0, 0x66, 0xF0, 0xCF, 0x95, 0xED, 0x20, 0x15, 0x04, 0x68, 0xD3, 0x29, 0x01,
-    0x59, 0x34, 0x09, 0xF2, 0x80, 0x9E, 0x82, 0x01, 0xF1, 0x52, 0xC5, 0xD0, 0xC4, 0x24, 0x45, 0xE4,
-    0xD3, 0xAC, 0x48, 0x8D, 0x87, 0x98, 0xC0, 0xC2, 0x09, 0xD0, 0x37, 0x18, 0x1C, 0xD1, 0x8C, 0x26,
-    0x15, 0x8A, 0x12, 0xE2, 0xB2, 0xA6, 0x03, 0x74, 0x0C, 0x72, 0x73, 0x3A, 0x74, 0xA8, 0x26, 0x1D,
-    0xB0, 0x6A, 0x0B, 0xBB, 0x24, 0x9B, 0xCB, 0x1D, 0xA6, 0x62, 0x7F, 0xA6, 0x8B, 0xF7, 0x1C, 0xAC,
-    0x96, 0xC5, 0x0C, 0x97, 0x2B, 0x8A, 0x3C, 0x6A, 0xFA, 0xE5, 0x07, 0xED, 0x82, 0x04, 0x05, 0xB3,
-    0xDD, 0xA7, 0x1C, 0xBB, 0x8C, 0x27, 0x5E, 0x96, 0x0E, 0x69, 0x15, 0xEC, 0x1B, 0x93, 0xB8, 0x1A,
-    0xD3, 0x50, 0x73, 0xE9, 0xC8, 0x2C, 0x72, 0x97, 0xD5, 0x04, 0x4C, 0x96, 0x31, 0x80, 0x92, 0x8A,
-    0x09, 0x0C, 0x56, 0x0A, 0x60, 0x94, 0xEA, 0xF2, 0xE8, 0x0B, 0x44, 0x89, 0x50, 0x96, 0x08, 0x5C,
-    0xE3, 0xED, 0x7C, 0x5A, 0xFB, 0xDB, 0xE7, 0xA0, 0x62, 0xB8, 0x89, 0xA1, 0x17, 0x48, 0x49, 0xCD,
-    0x87, 0x36, 0x74, 0x3F, 0x9A, 0x48, 0x89, 0x0B, 0xFE, 0xA0, 0x94, 0x10, 0x53, 0xDE, 0x8C, 0x1D,
-    0x41, 0xDE, 0x46, 0xB7, 0x23, 0xE6, 0xE0, 0x19, 0x97, 0x45, 0xD3, 0x65, 0xFE, 0x88, 0x5B, 0xF4,
-    0x0C, 0xA2, 0xD9, 0xDB, 0x17, 0x1B, 0x5A, 0x60, 0x69, 0xB5, 0x02, 0xA6, 0xD5, 0x30, 0x45, 0xFB,
-    0x52, 0x4F, 0x6B, 0x65, 0xC2, 0x69, 0x36, 0x59, 0x8B, 0x28, 0xDA, 0x9F, 0x58, 0x5A, 0xC8, 0x4F,
-    0x9C, 0xE0, 0x74, 0xEC, 0x72, 0x42, 0x38, 0x51, 0x1D, 0x9D, 0x0A, 0x64, 0x87, 0xE5, 0xD1, 0x89,
-    0x19, 0xF5, 0x50, 0xCB, 0x25, 0x9E, 0x7E, 0xF8, 0xDE, 0x15, 0xC4, 0xB6, 0xC6, 0x7C, 0xCF, 0xC4,
-    0x95, 0x79, 0x9D, 0x55, 0xB4, 0x5B, 0x4C, 0x01, 0x6D, 0xC1, 0x2A, 0x4E, 0x63, 0xB4, 0x7A, 0x53,
-    0x16, 0x1C, 0xA3, 0x41, 0x2C, 0x8F, 0xA0, 0x5A, 0x58, 0x76, 0x29, 0x39, 0x49, 0xDE, 0x06, 0xF0,
-    0x4F, 0x95, 0xE9, 0xCD, 0x69, 0xA3, 0x35, 0x46, 0x26, 0x52, 0xF0, 0x04, 0x74, 0x7B, 0x35, 0x9F,
-    0xD3, 0x53, 0x69, 0x9E, 0x9B, 0xDB, 0x16, 0xCF, 0x4B, 0x76, 0x24, 0x72, 0xFE, 0xFC, 0x5A, 0xB2,
-    0x3B, 0x32, 0xE5, 0x20, 0x06, 0x9C, 0x3E, 0xDA, 0x78, 0xDB, 0x47, 0xD7, 0x9A, 0x62, 0x51, 0x2D,
-    0x21, 0xF6, 0x32, 0xFF, 0x68, 0x0A, 0x47, 0x33, 0xAF, 0xE9, 0x7D, 0x29, 0xCA, 0xA9, 0x26, 0xCE,
-    0x6F, 0x6F, 0x6F, 0xDF, 0x3C, 0xAB, 0xE9, 0x67, 0x5D, 0x11, 0x5C, 0xF5, 0x3A, 0x1B, 0x0B, 0x98,
-    0x51, 0x6B, 0x04, 0xDA, 0xA7, 0x6D, 0xD9, 0x5C, 0x33, 0xF5, 0x85, 0xDE, 0x4C, 0x29, 0x76, 0xEB,
-    0xFB, 0x58, 0x1B, 0x38, 0x6D, 0x17, 0x56, 0xCF, 0xCC, 0xC5, 0x7E, 0xCE, 0x95, 0x30, 0x3A, 0x65,
-    0x68, 0x01, 0xF4, 0x7A, 0x5F, 0x82, 0x20, 0xEF, 0xFF, 0x3D, 0xF2, 0x5F, 0x5E, 0x31, 0xF9, 0xCE,
-    0x44, 0xF3, 0xAC, 0x48, 0x76, 0xD9, 0x94, 0xF4, 0xD9, 0x10, 0x0E, 0x59, 0x1F, 0xB0, 0x54, 0x89,
-    0x68, 0x9C, 0x11, 0x79, 0x04, 0xE7, 0x7B, 0x95, 0x60, 0x19, 0x99, 0x6C, 0x32, 0x4B, 0x0D, 0x68,
-    0x2A, 0x4B, 0x96, 0x96, 0xCC, 0xCC, 0xC2, 0x80, 0x84, 0xF4, 0x8B, 0x6F, 0x60, 0xDF, 0x18, 0x3F,
-    0xCC, 0x3A, 0x7A, 0xEA, 0xBF, 0x68, 0xD9, 0xE0, 0x03, 0x3C, 0x55, 0xC1, 0x08, 0x83, 0xFA, 0xA1,
-    0x2F, 0x35, 0xAE, 0x8F, 0xF0, 0xF8, 0xC8, 0xEF, 0xB1, 0x32, 0x41, 0x3C, 0xBA, 0x14, 0x94, 0x94,
-    0xB5, 0x76, 0xB4, 0x15, 0xAC, 0xBD, 0x48, 0x47, 0x6B, 0xF4, 0x18, 0xF4, 0xA8, 0x72, 0xB2, 0xD4,
-    0xB8, 0xC8, 0x33, 0x46, 0x04, 0xED, 0x66, 0xA7, 0x79, 0x1D, 0x41, 0x69, 0xFF, 0x02, 0x8F, 0x81,
-    0x25, 0x7C, 0xF4, 0x2A, 0x77, 0x62, 0xD7, 0x27, 0x08, 0x93, 0x7D, 0xAF, 0xA0, 0x58, 0x64, 0xDC,
-    0x44, 0xAE, 0xFC, 0x34, 0xF5, 0x69, 0x25, 0xC4, 0x16, 0x78, 0x06, 0x6E, 0x52, 0xC0, 0x70, 0x13,
-    0x96, 0xCE, 0x2A, 0x5F, 0x0B, 0x75, 0xA7, 0x78, 0x86, 0x10, 0xBE, 0x57, 0x7F, 0x8E, 0x07, 0xE1,
-    0xFF, 0xB0, 0x1F, 0x25, 0x1C, 0xC7, 0xC9, 0x4B, 0x98, 0x23, 0x9D, 0x6D, 0x79, 0x00, 0x41, 0x0E,
-    0x59, 0x57, 0x78, 0x73, 0x28, 0xE7, 0xBC, 0xB0, 0x03, 0xF2, 0xF3, 0x83, 0x2E, 0x90, 0xCB, 0x55,
-    0x34, 0x41, 0x41, 0xF8, 0x5A, 0x1E, 0xC0, 0x6B, 0x25, 0xDE, 0xE4, 0x18, 0xEC, 0x35, 0x0C, 0xF8,
-    0xB2, 0x27, 0xEB, 0x58, 0xAB, 0x1A, 0x62, 0x5F, 0xCB, 0x60, 0x1C, 0xBF, 0x84, 0x81, 0x49, 0xEF,
-    0x7F, 0xD4, 0xA3, 0x3B, 0x71, 0x80, 0x6C, 0x52, 0x2F, 0x7A, 0x9F, 0xAD, 0xA0, 0xAF, 0x3E, 0x1A,
-    0xB2, 0x2E, 0x1C, 0xF3, 0xF6, 0xF8, 0xB0, 0x2D, 0x2B, 0x0C, 0x38, 0x58, 0x69, 0xE8, 0x62, 0x56,
-    0x42, 0xFC, 0xB1, 0x8B, 0x50, 0x76, 0xAA, 0x3F, 0xDE, 0xD0, 0x02, 0xDD, 0x98, 0xBF, 0xC1, 0x8F,
-    0x7D, 0x53, 0x3F, 0xBB, 0xFC, 0x15, 0x7E, 0x28, 0xAB, 0xC2, 0x05, 0xDF, 0xC7, 0xAF, 0xF3, 0x27,
-    0x4C, 0x32, 0x1A, 0x96, 0x93, 0xDA, 0x9B, 0x3F, 0xC5, 0x34, 0x9A, 0xB4, 0xCB, 0xE7, 0x10, 0x01,
-    0xA6, 0xD3, 0x44, 0xEA, 0xFF, 0xCA, 0xDD, 0x1E, 0x1F, 0xAC, 0xF6, 0x65, 0xBB, 0x20, 0x82, 0xFD,
-    0xC1, 0x64, 0x87, 0x70, 0xA7, 0x74, 0x2A, 0xE2, 0xA9, 0x2B, 0x17, 0x62, 0x1D, 0x2A, 0x60, 0x66,
-    0xF1, 0x09, 0xFC, 0xFE, 0x1E, 0x12, 0xC1, 0x3B, 0x08, 0xE2, 0x1A, 0xEC, 0x5E, 0x1B, 0x0D, 0x40,
-    0x4D, 0x89, 0x01, 0x92, 0x9E, 0xC5, 0x4A, 0x18, 0x1D, 0xF0, 0x49, 0x7B, 0xB2, 0x15, 0x4B, 0x2E,
-    0xFE, 0xE2, 0xBF, 0x23, 0xD0, 0x10, 0x7C, 0xDA, 0x22, 0x7D, 0xFC, 0x64, 0x06, 0x3B, 0x24, 0xE4,
-    0xFB, 0x56, 0xB3, 0x8B, 0x9E, 0xEE, 0xE1, 0x02, 0xB8, 0x3C, 0x9A, 0x15, 0xDF, 0x13, 0x6C, 0x09,
-    0x28, 0x37, 0x73, 0x76, 0x74, 0x46, 0x24, 0xD9, 0xC7, 0x3C, 0x77, 0xC9, 0x18, 0x22, 0x97, 0xF3,
-    0xE7, 0x74, 0x08, 0xC5, 0xB6, 0x29, 0xA2, 0x59, 0xDB, 0xA2, 0x97, 0x4E, 0x60, 0x81, 0x3B, 0x40,
-    0x30, 0x26, 0xA2, 0x56, 0x59, 0x5F, 0x56, 0xD9, 0x6D, 0x80, 0x10, 0xDA, 0x9B, 0xC0, 0x6B, 0x43,
-    0x6D, 0xB2, 0xCF, 0x26, 0x53, 0xDE, 0x40, 0x44, 0x6A, 0x5B, 0x96, 0xA3, 0x72, 0xE4, 0x7E, 0x48,
-    0xFD, 0xD4, 0x67, 0x42, 0x26, 0x16, 0x5C, 0x91, 0x01, 0x27, 0x50, 0x5B, 0x8A, 0xF0, 0x2E, 0x3B,
-    0xC0, 0xA2, 0x6F, 0x74, 0x66, 0xE6, 0x66, 0xF3, 0x2B, 0x02, 0x99, 0x4B, 0x1E, 0x36, 0x5D, 0xAE,
-    0x65, 0xBB, 0xDE, 0x9C, 0x23, 0xBF, 0x9F, 0x35, 0xC1, 0x24, 0x4C, 0x9F, 0xE0, 0x16, 0xE4, 0x1D,
-    0x08, 0x54, 0x58, 0xD0, 0x7D, 0xD2, 0xD8, 0x2E, 0x18, 0xE0, 0xA3, 0x7E, 0x01, 0xDF, 0x9C, 0x55,
-    0xF0, 0x7C, 0x30, 0xA2, 0x98, 0xE1, 0x23, 0xCD, 0x6A, 0x0E, 0xBD, 0x73, 0xC7, 0x1E, 0xDD, 0xFE,
-    0xBD, 0xAF, 0x9F, 0x6A, 0xF1, 0xDC, 0x3B, 0x79, 0x0D, 0x38, 0xD2, 0xE1, 0x64, 0xE9, 0xE2, 0xF4,
-    0x64, 0x59, 0xB4, 0x1A, 0x19, 0xD5, 0x55, 0x69, 0x5B, 0x83, 0x19, 0x74, 0xA2, 0x6C, 0x80, 0xD6,
-    0xC5, 0x00, 0xDA, 0x7D, 0x44, 0x66, 0xC5, 0x1D, 0x28, 0x21, 0xA6, 0x78, 0x1A, 0xFC, 0x31, 0xA3,
-    0x12, 0x6A, 0x15, 0x30, 0xDE, 0x7C, 0xE7, 0x7F, 0x98, 0x75, 0xAB, 0xDD, 0x2D, 0x17, 0x29, 0xC3,
-    0xA4, 0xD1, 0x4F, 0x91, 0x3E, 0x81, 0x21, 0x3B, 0xFD, 0xFC, 0x2E, 0xD5, 0x32, 0xF8, 0xD1, 0x27,
-    0xD3, 0x0F, 0x0C, 0x8C, 0x85, 0xF4, 0x81, 0xB5, 0x36, 0xA5, 0xC2, 0x7A, 0x85, 0x81, 0x47, 0x33,
-    0xBD, 0xD2, 0x44, 0x9D, 0xAF, 0x6B, 0x32, 0x78, 0xB2, 0x4C, 0x0F, 0x35, 0x4E, 0x67, 0xB8, 0x52,
-    0x9C, 0x09, 0xE7, 0xE8, 0x61, 0x4A, 0x9E, 0x60, 0x8C, 0x46, 0xDA, 0x0A, 0x76, 0x56, 0xC7, 0x0B,
-    0xDB, 0x62, 0x01, 0x9A, 0x35, 0x9D, 0xB2, 0xD0, 0x9A, 0x3F, 0x49, 0x93, 0x95, 0xC6, 0x2A, 0x6F,
-    0x68, 0x77, 0x24, 0xA4, 0x5A, 0x4B, 0xAE, 0x0B, 0xA1, 0x69, 0xB5, 0x11, 0xBE, 0x7A, 0x50, 0xE2,
-    0x23, 0xA5, 0x27, 0x3D, 0x6C, 0x7F, 0x17, 0xB0, 0x4F, 0xDB, 0xD0, 0xD9, 0x22, 0xE9, 0x41, 0xA2,
-    0xBB, 0x88, 0x44, 0x2E, 0x75, 0x11, 0xF4, 0x9E, 0x42, 0xEF, 0xC8, 0x54, 0x2F, 0x20, 0xDD, 0xA1,
-    0xF3, 0x93, 0x01, 0x82, 0x74, 0x3A, 0x3E, 0x4D, 0x0B, 0x19, 0x0A, 0xFF, 0x07, 0x60, 0x71, 0xBF,
-    0xAA, 0x8B, 0x64, 0xE0, 0x5F, 0x20, 0x58, 0x04, 0xFC, 0x92, 0xB0, 0xE6, 0x3F, 0x90, 0xFC, 0xF7,
-    0x7B, 0xFF, 0x1F, 0x87, 0x16, 0xB8, 0x7C, 0x64, 0xC1, 0x6C, 0x62, 0xF4, 0x41, 0x28, 0x73, 0x35,
-    0xBB, 0x4F, 0x37, 0xFD, 0x40, 0xF3, 0xCC, 0xB2, 0x7A, 0x9D, 0xE3, 0xD9, 0xDB, 0x33, 0x66, 0x1F,
-    0xEA, 0xA2, 0xFC, 0x8D, 0x58, 0x66, 0xCF, 0x87, 0x64, 0x6B, 0xAF, 0xBF, 0x49, 0x5D, 0x3E, 0x06,
-    0xE5, 0x7F, 0x43, 0xF2, 0x57, 0xE9, 0x7C, 0x2D, 0xC6, 0x87, 0xF6, 0x5A, 0x9D, 0x05, 0x14, 0xAB,
-    0xAC, 0xCF, 0x90, 0x04, 0xBF, 0xC5, 0x5C, 0x5A, 0x58, 0xB4, 0xA3, 0xC6, 0xB4, 0x46, 0x62, 0xFC,
-    0x05, 0xEF, 0xC4, 0xB2, 0x04, 0x1F, 0xFC, 0xC3, 0x2D, 0x9D, 0x42, 0x04, 0x4E, 0x55, 0xAA, 0xA5,
-    0x99, 0x98, 0xAB, 0x03, 0x6A, 0x61, 0x1B, 0x49, 0xAF, 0xFF, 0x95, 0x95, 0xCD, 0xCC, 0x8C, 0x9C,
-    0xC9, 0x11, 0xB2, 0x72, 0xFE, 0xD3, 0xA2, 0xFF, 0x06, 0x31, 0x74, 0x98, 0xD7, 0xC3, 0xAE, 0xCB,
-    0xF6, 0x83, 0x39, 0xB5, 0xC9, 0xB4, 0xCA, 0x87, 0x5F, 0xAC, 0x9B, 0x9B, 0x74, 0xE5, 0xCB, 0xC6,
-    0x24, 0x79, 0xA7, 0x89, 0x01, 0xC1, 0xB0, 0xCE, 0x6E, 0x92, 0xD9, 0x57, 0x70, 0xEA, 0x4E, 0xE3,
-    0x1A, 0x1F, 0xD6, 0x6C, 0xD3, 0x91, 0xB1, 0x9C, 0xC1, 0x52, 0xA8, 0x5B, 0x1C, 0x54, 0x09, 0x9B,
-    0x9B, 0x58, 0x6D, 0x9F, 0xE9, 0x8A, 0x43, 0xFD, 0x23, 0x86, 0xFF, 0xC5, 0x68, 0x78, 0x07, 0x33,
-    0x62, 0x95, 0x61, 0xA4, 0x35, 0x44, 0x7F, 0xF7, 0xD1, 0xC4, 0x35, 0x60, 0xD6, 0x40, 0xC3, 0xC8,
-    0xEE, 0x7E, 0x3A, 0x5E, 0xCB, 0xDE, 0x7A, 0x30, 0xDE, 0xCA, 0xAF, 0xDF, 0x1B, 0xFE, 0x98, 0x5F,
-    0x3A, 0x18, 0x26, 0x7B, 0x79, 0xB7, 0x77, 0x36, 0xBD, 0xC3, 0xBA, 0x24, 0x9C, 0x1B, 0xF0, 0xCD,
-    0xA8, 0x89, 0x41, 0xA1, 0xF7, 0xE2, 0x15, 0xEB, 0x71, 0xFC, 0x60, 0xFD, 0xB3, 0xFE, 0x81, 0x06,
-    0x33, 0x99, 0x89, 0x59, 0xEE, 0xC8, 0xF1, 0x07, 0x01, 0x97, 0x7E, 0x0A, 0x8D, 0xF4, 0xCD, 0xA9,
-    0xE0, 0x82, 0x7B, 0xA9, 0x7C, 0x7C, 0x7F, 0xDF, 0x7D, 0x58, 0xFE, 0xD7, 0x2F, 0x6F, 0xFE, 0x2F,
-    0xCD, 0x5A, 0x3D, 0x8C, 0xDD, 0x56, 0x76, 0xBE, 0x24, 0x57, 0x22, 0x62, 0x26, 0xA1, 0x8A, 0xD5,
-    0xC2, 0xB1, 0x12, 0x31, 0xC5, 0x36, 0x59, 0x64, 0xC5, 0x26, 0xE5, 0x68, 0x48, 0x45, 0x08, 0x54,
-    0xB8, 0x18, 0x25, 0xF0, 0x20, 0x41, 0x1A, 0xB7, 0x69, 0x02, 0xA5, 0x74, 0x61, 0x8B, 0x6F, 0x3D,
-    0x08, 0x54, 0xB8, 0xD0, 0x00, 0xFB, 0xD3, 0x6C, 0x21, 0x03, 0x71, 0x80, 0x60, 0x0C, 0x64, 0x8A,
-    0xA4, 0x70, 0x00, 0x69, 0x2E, 0xE5, 0x29, 0x54, 0xA8, 0x10, 0xA5, 0x09, 0x90, 0x00, 0x29, 0x44,
-    0xCB, 0x4A, 0x82, 0x95, 0x0A, 0x71, 0x64, 0x1A, 0xA6, 0x66, 0x49, 0x9E, 0x7C, 0xDF, 0xB9, 0x7C,
-    0x6F, 0x7E, 0xBC, 0xDE, 0xD5, 0x42, 0x42, 0xB4, 0x7C, 0xBC, 0x24, 0xDF, 0x23, 0xEF, 0x3D, 0xE7,
-    0x9E, 0x7B, 0xCE, 0x77, 0x7E, 0xF8, 0x8A, 0x3E, 0xD3, 0x4F, 0xDA, 0x27, 0x5D, 0xD2, 0x9A, 0x83,
-    0xDB, 0xDF, 0xF9, 0x4D, 0xAC, 0x9F, 0x48, 0x3F, 0x61, 0xCB, 0x4F, 0xB0, 0xF8, 0xF8, 0xB5, 0x3F,
-    0x9B, 0x9E, 0x6C, 0x8C, 0x59, 0x32, 0x26, 0x31, 0x26, 0x2C, 0x4D, 0x34, 0x9A, 0x54, 0xAA, 0x54,
-    0xDA, 0x58, 0xFE, 0x33, 0xDA, 0xAD, 0x83, 0xFE, 0x1D, 0x33, 0x9E, 0x36, 0xD9, 0x95, 0x59, 0xFC,
-    0x14, 0x5F, 0x3E, 0x31, 0xF2, 0xCF, 0x26, 0x91, 0x2E, 0x10, 0x99, 0x65, 0xD2, 0x7A, 0xF6, 0xA1,
-    0x89, 0x66, 0xC6, 0xAF, 0x8C, 0xF9, 0x57, 0x63, 0xFE, 0x68, 0x9F, 0x76, 0xDA, 0x1A, 0x5F, 0x24,
-    0x8F, 0x45, 0xAA, 0xB8, 0x4E, 0xEA, 0x18, 0x94, 0xB4, 0x95, 0xC6, 0x44, 0x78, 0x38, 0x04, 0xC5,
-    0x00, 0x4D, 0x30, 0x0C, 0xDB, 0x86, 0x6C, 0xE4, 0x66, 0x44, 0x3F, 0x34, 0x1F, 0x2D, 0x1D, 0x8C,
-    0xB1, 0xB2, 0x97, 0x5B, 0x91, 0x06, 0xAD, 0xDB, 0xD8, 0xD8, 0xF8, 0x27, 0xCF, 0xF8, 0xE6, 0xFB,
-    0x66, 0xD9, 0x1F, 0x65, 0xC4, 0xB0, 0x5D, 0x22, 0x52, 0x66, 0xF7, 0x46, 0x33, 0x06, 0x7D, 0xD0,
-    0x61, 0x96, 0x6D, 0x51, 0x66, 0x32, 0x82, 0xE8, 0x90, 0xA2, 0x15, 0xE8, 0xF8, 0xEE, 0xB7, 0x12,
-    0x93, 0x9B, 0x13, 0x26, 0xAB, 0x4C, 0xD2, 0x14, 0x95, 0x27, 0xB9, 0xAD, 0xE2, 0xCE, 0x48, 0x29,
-    0xA5, 0x91, 0xFB, 0xBD, 0xF1, 0xC0, 0x9C, 0x09, 0x04, 0xE4, 0x02, 0x01, 0x2F, 0xA1, 0x80, 0x7E,
-    0x2C, 0xB5, 0xE1, 0xC8, 0xE4, 0x2C, 0x0F, 0x45, 0x2E, 0xE2, 0xA7, 0x0E, 0xBF, 0x67, 0x9F, 0x19,
-    0x53, 0xE0, 0x51, 0xCC, 0xBB, 0xC7, 0x43, 0x02, 0x49, 0x67, 0x35, 0x7E, 0x17, 0x4C, 0x2A, 0x18,
-    0xA6, 0x49, 0x9F, 0x4A, 0xB1, 0x65, 0xCB, 0x67, 0x79, 0x7D, 0x7A, 0x79, 0xF9, 0xAC, 0x6E, 0xDF,
-    0x35, 0xC7, 0x3F, 0xC2, 0xD8, 0x0D, 0x46, 0x2C, 0x93, 0xFC, 0xBA, 0xDF, 0x04, 0x79, 0x5A, 0x81,
-    0x76, 0x87, 0x61, 0x5A, 0x0C, 0x57, 0x16, 0x7F, 0x3F, 0x46, 0x55, 0x54, 0xDB, 0x1F, 0x8F, 0x91,
-    0x48, 0x9D, 0x49, 0x0F, 0xBE, 0x72, 0x0F, 0x64, 0x4C, 0x51, 0x9D, 0x30, 0x63, 0x58, 0xC7, 0x35,
-    0x88, 0x62, 0x52, 0xF9, 0xA6, 0xE4, 0x1C, 0xFA, 0x58, 0xBE, 0x1A, 0xB5, 0xD9, 0xF6, 0x18, 0xB7,
-    0xB2, 0x36, 0x64, 0xBB, 0x72, 0xAD, 0xB7, 0xB5, 0xB1, 0xE0, 0xB6, 0x89, 0xEF, 0xF6, 0x29, 0xC8,
-    0xD6, 0x67, 0x96, 0xAA, 0xD3, 0x38, 0xA6, 0xC5, 0x59, 0xFC, 0x42, 0xDA, 0x16, 0x6C, 0x7A, 0x3F,
-    0x3F, 0xF7, 0xB8, 0x6A, 0x3E, 0xF9, 0x93, 0xDF, 0xFD, 0x9D, 0x60, 0xED, 0x27, 0x8D, 0xED, 0xA3,
-    0xC7, 0x8E, 0xEB, 0x0F, 0x7F, 0xDB, 0x2C, 0x87, 0x25, 0x1F, 0xEC, 0xED, 0xB9, 0x31, 0xAB, 0x8A,
-    0x37, 0x9B, 0xA8, 0x15, 0x53, 0x3C, 0x06, 0x23, 0x9B, 0x4D, 0xD0, 0xDB, 0x32, 0xFE, 0xB4, 0x33,
-    0x4B, 0x51, 0x6E, 0xF2, 0x13, 0xAB, 0x58, 0x1A, 0x19, 0x7F, 0x2A, 0xB2, 0x27, 0x10, 0xC6, 0xC9,
-    0xA2, 0x34, 0x71, 0x63, 0x02, 0xB0, 0x0A, 0xD9, 0x65, 0xA5, 0xCC, 0xB7, 0x9E, 0xE3, 0xDA, 0x19,
-    0x39, 0x92, 0xEB, 0x67, 0x7E, 0x78, 0xF6, 0xEC, 0x3F, 0x9C, 0x5E, 0xB2, 0x67, 0xCE, 0xFC, 0xCB,
-    0xE5, 0xE4, 0x8B, 0x3E, 0x82, 0xD6, 0xC8, 0xA4, 0x78, 0x56, 0x6E, 0x89, 0xAC, 0xAE, 0xE6, 0x07,
-    0x1E, 0xEF, 0xD3, 0xBB, 0x43, 0x36, 0xDB, 0xCA, 0xCA, 0x31, 0x95, 0x01, 0x5F, 0x27, 0xEE, 0x8F,
-    0x61, 0x21, 0x52, 0x28, 0x8F, 0x85, 0x7E, 0xF4, 0xE6, 0x8D, 0xCD, 0xBD, 0x0F, 0xA1, 0x16, 0x9F,
-    0x82, 0x14, 0xBF, 0x9A, 0xA8, 0x59, 0xDC, 0xC5, 0x76, 0xFC, 0x63, 0x68, 0x86, 0xC8, 0xFB, 0x64,
-    0x11, 0x5B, 0x52, 0x2F, 0xB7, 0x50, 0xEF, 0x77, 0xBC, 0x26, 0xAE, 0x52, 0x58, 0x8A, 0x97, 0x27,
-    0xED, 0x89, 0x3F, 0x36, 0xBF, 0xEF, 0x5F, 0x8F, 0x30, 0xAD, 0xDF, 0x7B, 0x2F, 0xED, 0xD3, 0x36,
-    0x68, 0x92, 0xD9, 0x10, 0x34, 0xE9, 0x8C, 0xE3, 0xF8, 0xFD, 0xA2, 0x55, 0xAE, 0x65, 0x6C, 0x75,
-    0x30, 0x68, 0x6B, 0xA6, 0x36, 0xC4, 0x03, 0xA8, 0xCC, 0xDB, 0xA8, 0x2D, 0xED, 0x4C, 0x46, 0x6D,
-    0x41, 0xFB, 0x1E, 0x9A, 0x2F, 0x2B, 0x95, 0xB4, 0x50, 0xC8, 0x95, 0x1D, 0x69, 0xA0, 0x93, 0xF1,
-    0x7F, 0xE0, 0x94, 0x49, 0x7C, 0x0F, 0xA7, 0x58, 0xC0, 0x4E, 0x33, 0x04, 0x63, 0x54, 0x67, 0xF5,
-    0x16, 0x4F, 0x45, 0xB5, 0x15, 0x0D, 0x51, 0x2D, 0xD5, 0x56, 0xCC, 0x53, 0xB9, 0x95, 0xF4, 0xD1,
-    0x03, 0x9C, 0xB2, 0x3E, 0xFA, 0x6C, 0x35, 0x3F, 0x99, 0xEE, 0x0C, 0xD9, 0xE7, 0x63, 0xB1, 0xBB,
-    0x7A, 0xC6, 0xB4, 0x41, 0x97, 0x76, 0x7F, 0xB1, 0x2B, 0x1F, 0xF4, 0x6F, 0xE4, 0xD1, 0xEC, 0xB2,
-    0xF7, 0x8E, 0xA9, 0x83, 0xD9, 0x69, 0xF3, 0x4E, 0x3C, 0x66, 0x1D, 0x8C, 0xFC, 0xC9, 0xF9, 0xB2,
-    0x69, 0x96, 0x96, 0xE2, 0xF8, 0xC9, 0x4D, 0xA9, 0x12, 0x98, 0x9B, 0x09, 0xCC, 0x87, 0xE6, 0x6C,
-    0x34, 0x0B, 0x5A, 0x6B, 0x92, 0xCF, 0x07, 0x53, 0xDC, 0x6E, 0xCD, 0x98, 0x56, 0xF1, 0xD3, 0x31,
-    0x18, 0xED, 0x5D, 0xAC, 0x72, 0xF6, 0xBF, 0xBD, 0xDF, 0x65, 0xE6, 0x0F, 0x82, 0xD2, 0xE4, 0x7F,
-    0x68, 0x8E, 0xB3, 0x8B, 0x51, 0x65, 0xA3, 0x6E, 0xC7, 0xD5, 0x6F, 0x41, 0xDD, 0xB7, 0x4C, 0x50,
-    0xD1, 0x66, 0xE3, 0xDC, 0x64, 0x33, 0xF3, 0x9E, 0xF1, 0x60, 0x40, 0x2D, 0xEE, 0x99, 0xB0, 0xA2,
-    0xDC, 0x93, 0x3C, 0x6C, 0xBE, 0x15, 0x49, 0x93, 0xCD, 0xDA, 0x4C, 0x3E, 0xED, 0xE3, 0xCA, 0x62,
-    0x7E, 0x16, 0x43, 0x48, 0x78, 0x03, 0xB6, 0xD5, 0x2E, 0xD1, 0x62, 0xD6, 0x76, 0x6A, 0xAC, 0xD7,
-    0x99, 0x64, 0xDD, 0x24, 0x9F, 0xA9, 0x91, 0xC1, 0xC2, 0x4C, 0xD4, 0x72, 0xD8, 0x0C, 0xAA, 0x54,
-    0x92, 0x5A, 0x61, 0x5E, 0xFB, 0x50, 0x57, 0x51, 0x99, 0x88, 0xD1, 0xED, 0x98, 0xE3, 0xA2, 0x34,
-    0xD7, 0x72, 0x13, 0xD5, 0x64, 0x83, 0xF0, 0x81, 0x5E, 0xB8, 0xF7, 0x9E, 0xAE, 0x7F, 0x92, 0x1B,
-    0x3C, 0x01, 0x46, 0xB0, 0xE0, 0x60, 0xAA, 0x80, 0x46, 0x80, 0x93, 0x2B, 0xB2, 0x06, 0x75, 0xDA,
-    0x96, 0xCE, 0x4A, 0x52, 0x3D, 0x4C, 0x8D, 0xEA, 0x6A, 0x45, 0x65, 0xC1, 0x33, 0x01, 0xAC, 0xBA,
-    0x57, 0xD5, 0x1D, 0x8C, 0x37, 0x60, 0xA5, 0xA8, 0xC3, 0x01, 0x8E, 0x36, 0xF7, 0x05, 0x12, 0x9A,
-    0x19, 0x22, 0x5C, 0x69, 0x32, 0xA9, 0xA9, 0x7B, 0x30, 0xEE, 0x4E, 0x85, 0x82, 0x59, 0xBF, 0xE5,
-    0x99, 0x4F, 0x14, 0xC9, 0x1A, 0x08, 0x05, 0xF0, 0x07, 0x6E, 0x92, 0xDE, 0x64, 0xB9, 0xB1, 0x2D,
-    0x99, 0x39, 0xD5, 0x28, 0xCA, 0x95, 0xE0, 0xE5, 0xBF, 0x6D, 0xD8, 0xBC, 0x1E, 0x48, 0x9F, 0xFD,
-    0xA0, 0x4D, 0xE5, 0x01, 0x84, 0x72, 0x69, 0x48, 0x2A, 0xCA, 0x55, 0x22, 0x15, 0xCA, 0xBB, 0x1D,
-    0x85, 0xB2, 0x4D, 0xA1, 0x64, 0x6F, 0xD7, 0xCF, 0x21, 0x14, 0x13, 0xE3, 0x4B, 0xC4, 0x06, 0x42,
-    0x21, 0x1B, 0x46, 0xF0, 0xDE, 0x32, 0x87, 0xB7, 0xD7, 0xA1, 0x79, 0xF8, 0x3D, 0x99, 0xB7, 0xD6,
-    0x35, 0x4B, 0x4C, 0x6E, 0x20, 0x9A, 0x5C, 0xC5, 0x0A, 0x14, 0x22, 0x81, 0xA3, 0xED, 0x04, 0x14,
-    0xA6, 0x8D, 0xDB, 0x08, 0x96, 0x27, 0x9D, 0x42, 0x64, 0x3A, 0xEC, 0x0F, 0x1D, 0x13, 0xF4, 0xF4,
-    0xD1, 0xB9, 0x82, 0xA8, 0x8D, 0x1D, 0x65, 0x21, 0x50, 0x04, 0x50, 0x84, 0x8C, 0x44, 0x9F, 0xA5,
-    0x6B, 0x4A, 0x14, 0x2D, 0x47, 0xDE, 0xCB, 0xAE, 0xE1, 0x1E, 0x61, 0x86, 0xB2, 0x20, 0x7F, 0x35,
-    0x24, 0x1E, 0x0C, 0xEC, 0x97, 0x95, 0xE8, 0x17, 0x01, 0x7C, 0x70, 0xEB, 0xD1, 0x66, 0x4B, 0x38,
-    0x96, 0x59, 0xA0, 0xA8, 0x02, 0x1B, 0x93, 0x3A, 0x22, 0xC2, 0x00, 0xC5, 0x4D, 0xD6, 0x42, 0xEC,
-    0x3E, 0x16, 0x39, 0xA7, 0xFC, 0x8D, 0xDF, 0x90, 0xD0, 0x32, 0x0F, 0x91, 0xEA, 0x8E, 0xF2, 0x90,
-    0xCE, 0xCC, 0x73, 0x6C, 0xAF, 0x82, 0x5F, 0xB7, 0x5D, 0x57, 0x88, 0x22, 0xEB, 0x21, 0xA9, 0x79,
-    0x8A, 0x59, 0xC5, 0x05, 0x2E, 0x5B, 0x19, 0xD5, 0xAF, 0x9C, 0xC9, 0x8B, 0xDF, 0xA6, 0x0C, 0xEF,
-    0xD5, 0xF4, 0x91, 0x67, 0x70, 0xB9, 0x04, 0xFF, 0x68, 0xC2, 0x5B, 0xA4, 0x76, 0x36, 0x39, 0x22,
-    0x5A, 0xD5, 0x0A, 0xA7, 0x0F, 0xB6, 0x51, 0x5F, 0x9A, 0x1B, 0x75, 0x74, 0xB8, 0xF5, 0x04, 0xF7,
-    0x82, 0x67, 0xBC, 0x67, 0x57, 0x1A, 0x5A, 0x22, 0xA0, 0xC1, 0x1B, 0xA9, 0xBD, 0x59, 0x85, 0x7E,
-    0xF0, 0xE1, 0xB8, 0x67, 0x4B, 0x08, 0x22, 0x1E, 0x37, 0xE8, 0xFE, 0xA0, 0x7C, 0xCA, 0x59, 0x49,
-    0x26, 0x47, 0x78, 0x0A, 0x38, 0xF4, 0x18, 0x06, 0x2B, 0xE7, 0xC0, 0x64, 0xDA, 0x65, 0x2D, 0x46,
-    0x2E, 0xE1, 0x16, 0x4E, 0x2A, 0xC4, 0x10, 0x03, 0x1A, 0x78, 0x23, 0x4F, 0x68, 0x18, 0x69, 0x8B,
-    0x5B, 0x81, 0x5C, 0x1D, 0x7E, 0x43, 0x56, 0x5A, 0x05, 0xE5, 0x04, 0x73, 0x83, 0x82, 0x89, 0xAE,
-    0x2E, 0x64, 0xE4, 0x62, 0x87, 0xD7, 0xF2, 0xDF, 0x00, 0x75, 0x5C, 0xFD, 0xDE, 0xC7, 0xBA, 0x56,
-    0x52, 0x68, 0x78, 0xE3, 0x0B, 0x83, 0x2F, 0xAE, 0xBB, 0xC8, 0xA3, 0x75, 0x32, 0x22, 0x6A, 0xF5,
-    0xC9, 0x74, 0xCE, 0xEE, 0xBB, 0x73, 0xB1, 0xE2, 0xCE, 0x12, 0xAB, 0xBF, 0xF5, 0x19, 0xC5, 0x30,
-    0xA4, 0xEA, 0xDD, 0x39, 0xEA, 0x80, 0x23, 0x3F, 0xE3, 0x8A, 0x07, 0xFA, 0x5C, 0xB6, 0xF7, 0xB1,
-    0x9E, 0x0B, 0x71, 0xE3, 0x90, 0x9B, 0x47, 0x1B, 0xEB, 0x9E, 0x0B, 0x1C, 0x9A, 0xC0, 0x9D, 0x5B,
-    0x60, 0x1C, 0x7F, 0x6A, 0x63, 0x0D, 0xD3, 0x04, 0xEE, 0x4E, 0x1F, 0xED, 0x0F, 0xCB, 0xE9, 0xB8,
-    0x3C, 0x83, 0xD9, 0x48, 0x8D, 0x5E, 0x03, 0x6F, 0x97, 0xA9, 0xEC, 0xF5, 0x01, 0x20, 0x4B, 0x85,
-    0x8B, 0xBE, 0x46, 0x43, 0x0D, 0x76, 0x0E, 0xA8, 0x8C, 0xD0, 0x9A, 0xE9, 0xA2, 0xE7, 0x45, 0xC5,
-    0x68, 0x66, 0xFD, 0x3B, 0x37, 0x39, 0x70, 0xCC, 0xEE, 0x60, 0xAA, 0xF7, 0x79, 0x11, 0x91, 0xD4,
-    0x29, 0xE5, 0x90, 0xAB, 0x44, 0xA8, 0xA4, 0x6F, 0x30, 0x27, 0x54, 0x30, 0xB9, 0x5B, 0x1B, 0xFF,
-    0x23, 0x7A, 0x14, 0xC5, 0x52, 0xC6, 0x88, 0x4A, 0xEE, 0x10, 0x0E, 0x42, 0xA0, 0x5F, 0x62, 0x34,
-    0xC4, 0x38, 0x92, 0xC8, 0xDE, 0x47, 0x58, 0x22, 0x6F, 0x74, 0x90, 0x9D, 0xA0, 0xBB, 0x7D, 0x34,
-    0xF8, 0x9C, 0xA9, 0x30, 0xDA, 0x46, 0x6C, 0x5A, 0x6A, 0xE4, 0x1B, 0xD1, 0x24, 0xF6, 0x36, 0x3E,
-    0x42, 0x9F, 0x2F, 0xD0, 0xEE, 0xA0, 0x81, 0xAB, 0x51, 0xE7, 0xEE, 0x35, 0x2E, 0x82, 0xBE, 0xEC,
-    0x82, 0xE7, 0xA4, 0xFC, 0x25, 0x88, 0xF6, 0xB2, 0x69, 0xEB, 0xD2, 0xE7, 0x1A, 0xE8, 0xC5, 0x54,
-    0x2D, 0x81, 0x2B, 0x10, 0xF8, 0xCE, 0xE2, 0x00, 0x4D, 0x7F, 0xC3, 0xCA, 0xDB, 0x78, 0x18, 0x9D,
-    0x76, 0x45, 0x36, 0x2E, 0x4C, 0xC4, 0x26, 0xDA, 0xD1, 0xB8, 0xE9, 0x88, 0x89, 0xA3, 0x4D, 0x43,
-    0x25, 0x2B, 0x50, 0x5C, 0xD9, 0xD8, 0x58, 0x01, 0x15, 0xE8, 0x67, 0x8F, 0xD3, 0x57, 0x68, 0x4F,
-    0xB8, 0x0A, 0xB4, 0x6E, 0x44, 0x95, 0x46, 0x2E, 0xF4, 0xC1, 0x90, 0x34, 0x49, 0x67, 0x2B, 0xFB,
-    0xB9, 0x1C, 0x41, 0x9D, 0x97, 0x4D, 0x14, 0xD9, 0x02, 0x9E, 0xE0, 0x8E, 0x38, 0xE1, 0xE2, 0x41,
-    0xA3, 0x1C, 0x29, 0x20, 0xDC, 0xB0, 0x33, 0x08, 0x0B, 0x92, 0x04, 0x99, 0x62, 0xE6, 0x2D, 0x2E,
-    0x4B, 0x98, 0x1C, 0x80, 0x08, 0x10, 0x66, 0x4B, 0x84, 0x13, 0x20, 0x05, 0x75, 0x93, 0x0A, 0xFA,
-    0x16, 0x56, 0x7D, 0xB2, 0xD6, 0x1E, 0x94, 0x14, 0x14, 0xC6, 0x7E, 0xC0, 0xBD, 0xB8, 0x32, 0xDF,
-    0x6F, 0xF5, 0xD8, 0xED, 0xED, 0xDE, 0xDE, 0x19, 0xE4, 0xBE, 0xA2, 0x82, 0xD7, 0x29, 0xA6, 0xC6,
-    0x8C, 0x4B, 0x7A, 0x33, 0x46, 0x4D, 0x96, 0x1F, 0x5D, 0x72, 0xEA, 0x1D, 0xE6, 0x12, 0xED, 0x9F,
-    0x30, 0xEF, 0xF0, 0xEB, 0xA7, 0x52, 0x83, 0x85, 0xE9, 0x84, 0xD5, 0x8E, 0xDC, 0x89, 0xD1, 0x04,
-    0xAC, 0x00, 0xA7, 0x93, 0x2E, 0xA7, 0x18, 0x90, 0x53, 0x5C, 0x19, 0x8A, 0xCF, 0x5C, 0x4E, 0x71,
-    0x14, 0x3A, 0x47, 0xA5, 0x02, 0x09, 0x80, 0x10, 0xF5, 0x05, 0xA3, 0x63, 0xE2, 0x20, 0xE0, 0xED,
-    0x7F, 0xA1, 0xBD, 0x2A, 0x25, 0xC8, 0x21, 0xEA, 0x35, 0xAE, 0xB2, 0xC4, 0x1A, 0x12, 0xA1, 0xE9,
-    0x21, 0x47, 0xA3, 0xF9, 0x10, 0xDE, 0x15, 0x8F, 0x72, 0x3D, 0x56, 0x48, 0xB0, 0xFE, 0x1A, 0x68,
-    0x03, 0xB3, 0x42, 0xE6, 0x88, 0x23, 0x26, 0x86, 0x23, 0xF0, 0x4C, 0x8F, 0x78, 0x84, 0x11, 0x38,
-    0x8E, 0xC1, 0x74, 0xE4, 0xEF, 0xA1, 0x1E, 0x19, 0x7A, 0xD5, 0xC7, 0x26, 0x74, 0x73, 0x3E, 0xA3,
-    0x71, 0x48, 0xE7, 0xFC, 0x07, 0x8F, 0xA3, 0xD2, 0x02, 0x88, 0x85, 0x35, 0x93, 0xCE, 0xAB, 0x40,
-    0xBC, 0xAD, 0xC6, 0xF8, 0x4F, 0xC1, 0x5C, 0xE2, 0x62, 0x85, 0xC3, 0x52, 0xDD, 0x05, 0x5B, 0x82,
-    0x81, 0x11, 0x90, 0x55, 0x1E, 0x12, 0x11, 0x93, 0x3C, 0x90, 0xD6, 0xC7, 0x45, 0x99, 0xEE, 0x40,
-    0x91, 0x10, 0xC2, 0x37, 0xD9, 0x8E, 0xC8, 0xF9, 0x21, 0xFB, 0xAA, 0xC7, 0x45, 0xB6, 0xD3, 0x67,
-    0x4F, 0xC7, 0xEC, 0x96, 0xC4, 0x5F, 0xF5, 0x45, 0xC3, 0xA4, 0x26, 0x94, 0xDE, 0x36, 0x99, 0xDC,
-    0x16, 0x8F, 0x17, 0x31, 0x4C, 0xC9, 0xD8, 0x9E, 0xE8, 0x36, 0xA3, 0x9C, 0x16, 0x00, 0x5F, 0x2D,
-    0xFC, 0xC2, 0xB1, 0x8B, 0x87, 0x38, 0x38, 0x45, 0x21, 0x31, 0xDF, 0x24, 0x4E, 0x36, 0xA6, 0x18,
-    0x2F, 0x09, 0x65, 0x68, 0x6B, 0x28, 0x65, 0xDC, 0x43, 0x38, 0x1E, 0x6C, 0x02, 0x03, 0x70, 0x06,
-    0x61, 0x8F, 0x51, 0x3D, 0x21, 0x22, 0x65, 0x77, 0x88, 0x45, 0x5F, 0x11, 0x7E, 0x07, 0xF7, 0x23,
-    0xA6, 0x6B, 0x6F, 0x73, 0x98, 0xA7, 0xF2, 0xEC, 0xCF, 0xD4, 0x48, 0x34, 0x7B, 0x16, 0xB8, 0x51,
-    0x87, 0x97, 0x38, 0x78, 0x2A, 0xA6, 0xE3, 0xBA, 0x30, 0x6E, 0x8B, 0xD4, 0x93, 0x53, 0x01, 0xFC,
-    0x76, 0x11, 0x49, 0x6D, 0x3D, 0x47, 0x1C, 0xF5, 0x8A, 0xF9, 0xDE, 0x67, 0x9E, 0x5A, 0xEF, 0x22,
-    0xAA, 0x90, 0x9A, 0x16, 0xB6, 0xB4, 0x84, 0xC6, 0xEF, 0x0E, 0x3E, 0xC8, 0xE2, 0x85, 0xBA, 0x0F,
-    0x1E, 0x60, 0xBB, 0xF2, 0x3F, 0x5C, 0xA1, 0x3C, 0x1A, 0x35, 0x19, 0x28, 0xD1, 0x39, 0x69, 0x0B,
-    0x06, 0x12, 0x60, 0xDE, 0x14, 0x77, 0x08, 0x2C, 0x5F, 0xA8, 0x67, 0xD3, 0x08, 0xBE, 0x20, 0xDF,
-    0xF7, 0xF5, 0x47, 0x61, 0x3C, 0x6E, 0x39, 0x4C, 0x2A, 0x3F, 0x7A, 0x5B, 0x31, 0x57, 0x6A, 0x75,
-    0x63, 0x74, 0xBE, 0xEA, 0x51, 0x7A, 0xFA, 0x4D, 0xCC, 0xFC, 0x92, 0x3C, 0x5C, 0x90, 0xCF, 0xB1,
-    0xE6, 0xFE, 0xF0, 0x7D, 0x3A, 0xC1, 0xDB, 0x60, 0xF4, 0x5D, 0xFA, 0xA3, 0x84, 0xA1, 0x60, 0x70,
-    0xB3, 0x3B, 0xE2, 0xE6, 0xD6, 0xD5, 0xEF, 0xCE, 0xDC, 0x20, 0x89, 0xFC, 0x54, 0x4A, 0x98, 0x53,
-    0xDA, 0x45, 0x0C, 0x88, 0xA8, 0x40, 0xC5, 0x5D, 0xE2, 0x32, 0x52, 0xF5, 0x49, 0xA0, 0xCA, 0x6D,
-    0xFC, 0xC5, 0x30, 0x09, 0xD4, 0x71, 0x5B, 0xDC, 0x21, 0xFA, 0x3D, 0xE5, 0x30, 0xBD, 0x1D, 0xFF,
-    0xBC, 0x10, 0x72, 0x07, 0xFF, 0x4F, 0xFB, 0xA3, 0x80, 0x9B, 0x48, 0x6D, 0x47, 0x57, 0xCE, 0xB3,
-    0xA4, 0xA9, 0x1B, 0xA0, 0x81, 0xEE, 0x9B, 0x02, 0xEC, 0x89, 0x89, 0x1A, 0x62, 0xD9, 0x1D, 0x66,
-    0xFC, 0xAD, 0x7C, 0xDD, 0x78, 0x5E, 0xB1, 0x54, 0x19, 0x5A, 0x7C, 0x3A, 0x9A, 0xE2, 0x09, 0x10,
-    0x99, 0x40, 0x84, 0x94, 0x4F, 0x91, 0x00, 0x31, 0x82, 0xAD, 0xB3, 0x56, 0x83, 0x2E, 0xDD, 0xFE,
-    0xEA, 0x00, 0x84, 0xBA, 0x92, 0xD5, 0xFC, 0x56, 0x31, 0x47, 0x3E, 0x99, 0xD0, 0xD6, 0x97, 0x49,
-    0xC3, 0x34, 0x06, 0xD0, 0x4E, 0xF3, 0x40, 0x24, 0x99, 0xF7, 0xCE, 0xE6, 0xBD, 0x6D, 0x75, 0xA4,
-    0xF7, 0xA2, 0x53, 0x38, 0x4E, 0xAB, 0xB9, 0xE9, 0x7A, 0xBB, 0x38, 0xCB, 0x68, 0x80, 0xA3, 0xBD,
-    0x55, 0x56, 0x2E, 0xCB, 0xF3, 0x35, 0x14, 0x03, 0x4F, 0x81, 0x4C, 0xB1, 0x60, 0xE4, 0xAA, 0x19,
-    0x45, 0x89, 0x29, 0x2B, 0x9D, 0x32, 0xDB, 0x73, 0xB1, 0xE1, 0xAC, 0xD8, 0x9D, 0x2E, 0xA4, 0x72,
-    0x17, 0x7F, 0x0A, 0x39, 0x93, 0x65, 0x39, 0x2F, 0xB9, 0xBB, 0xF8, 0x40, 0x3C, 0x77, 0xEB, 0xFE,
-    0xE0, 0xBB, 0xEE, 0xD2, 0x85, 0xD3, 0xC5, 0x97, 0x85, 0x4C, 0xEC, 0x38, 0x12, 0x84, 0xCD, 0x61,
-    0x0A, 0xF5, 0x1C, 0xF5, 0x78, 0xCE, 0x61, 0x22, 0xF3, 0xE8, 0x4F, 0x10, 0x7A, 0x69, 0xF7, 0xA9,
-    0xE6, 0xE8, 0x49, 0x3D, 0x9F, 0xEE, 0x34, 0xEF, 0x68, 0x2E, 0xB5, 0x78, 0x2E, 0x80, 0x45, 0x22,
-    0x59, 0xCC, 0xA5, 0x26, 0xCD, 0x5C, 0xC2, 0xD5, 0xD1, 0xDE, 0xCF, 0xE6, 0x12, 0x9E, 0x5B, 0xF7,
-    0x77, 0x17, 0x1A, 0xC6, 0x20, 0x8B, 0x91, 0x97, 0x03, 0x50, 0x8D, 0x8A, 0xE5, 0x17, 0x80, 0x11,
-    0x4C, 0x84, 0xF5, 0x47, 0x23, 0x4F, 0x06, 0xC4, 0x01, 0xB8, 0xB0, 0x8B, 0x8B, 0xC7, 0x3D, 0xB2,
-    0x68, 0x58, 0x8B, 0xFD, 0xAF, 0xE9, 0xA2, 0xC0, 0x45, 0xA8, 0x17, 0xB7, 0x71, 0xD1, 0x43, 0x41,
-    0xED, 0xAD, 0x11, 0xCB, 0x5C, 0xC8, 0xA6, 0x6C, 0x53, 0x0C, 0x14, 0xCA, 0xFB, 0x9A, 0x84, 0x50,
-    0x4A, 0x0C, 0x29, 0x26, 0x2A, 0x4C, 0x38, 0xC3, 0x6A, 0x02, 0x49, 0xFA, 0xE7, 0xA0, 0x7D, 0x9E,
-    0x8C, 0xF3, 0xFF, 0x89, 0x3B, 0xA5, 0x54, 0xBA, 0xA2, 0xAA, 0xAE, 0x55, 0x0A, 0x02, 0x51, 0x5B,
-    0xE4, 0x80, 0xC2, 0xF1, 0x15, 0x31, 0x35, 0x86, 0xC8, 0x4A, 0x1A, 0x44, 0x51, 0x42, 0x2F, 0xDF,
-    0x30, 0xC5, 0x83, 0x3D, 0x9D, 0xBC, 0xB8, 0x9A, 0x7F, 0x9D, 0x21, 0xF2, 0x02, 0x65, 0x8C, 0x0F,
-    0xF3, 0xA2, 0x17, 0x07, 0x79, 0xB1, 0x0B, 0x5E, 0x78, 0x41, 0x1C, 0x44, 0x30, 0x05, 0xF8, 0x80,
-    0x29, 0x03, 0x38, 0xF6, 0x1C, 0x2F, 0xDB, 0x9A, 0x48, 0x68, 0xF6, 0x03, 0x24, 0xF1, 0x27, 0xEB,
-    0x9B, 0x6F, 0x5C, 0xBE, 0x90, 0x3A, 0x9C, 0xE5, 0xD3, 0xB7, 0xA8, 0x36, 0xBF, 0xC6, 0x06, 0xF8,
-    0x08, 0x46, 0x2D, 0x35, 0xB3, 0x86, 0xF3, 0x03, 0x44, 0x7D, 0xC8, 0x44, 0x60, 0xB7, 0x21, 0x0D,
-    0x4E, 0x7D, 0x1F, 0xE2, 0x57, 0x44, 0x23, 0xC4, 0xB5, 0x82, 0xA4, 0x69, 0x49, 0x2C, 0x35, 0xB9,
-    0xEA, 0xB3, 0x5A, 0x8B, 0xC2, 0x0A, 0x91, 0x84, 0xB9, 0xAD, 0x2B, 0x48, 0x6B, 0x6A, 0x46, 0xD4,
-    0xF2, 0xF1, 0xD3, 0x0D, 0x33, 0xED, 0xC8, 0x9E, 0xED, 0x00, 0xD3, 0x2D, 0xAD, 0x34, 0x5B, 0x51,
-    0x7F, 0xC3, 0x1B, 0x6E, 0x98, 0xE1, 0x86, 0x3F, 0xDC, 0x00, 0x62, 0x4A, 0x6B, 0xA5, 0xB2, 0x48,
-    0x99, 0xD7, 0xF7, 0x9F, 0xC7, 0x6E, 0xDE, 0x58, 0x67, 0x55, 0x0C, 0x9D, 0x9A, 0xB0, 0x8B, 0xEB,
-    0xB4, 0x8C, 0xCB, 0xD1, 0xB3, 0x01, 0x92, 0xC0, 0xB8, 0x92, 0xF5, 0xEC, 0x4A, 0x63, 0xC6, 0x24,
-    0x0F, 0xBA, 0xCB, 0x1A, 0xD7, 0x17, 0xEF, 0xCB, 0xB9, 0x31, 0x80, 0xAF, 0x0E, 0x25, 0x69, 0x82,
-    0xB1, 0x28, 0x83, 0x3D, 0x79, 0x98, 0x3C, 0x86, 0xDC, 0x2E, 0x61, 0x61, 0xAD, 0x56, 0x85, 0x3A,
-    0x16, 0xA9, 0x34, 0xE6, 0xA4, 0x43, 0x60, 0x51, 0xCA, 0xEC, 0x67, 0x3F, 0xC9, 0x43, 0x26, 0x8E,
-    0xF4, 0xD3, 0x66, 0x08, 0xFB, 0xB0, 0x46, 0x70, 0x69, 0xE2, 0x0A, 0x41, 0xDA, 0x5A, 0x6D, 0xC6,
-    0x38, 0xF7, 0xFB, 0xB3, 0x26, 0x6A, 0xB0, 0xFA, 0xDB, 0xE3, 0xA6, 0x44, 0x2E, 0xFD, 0x22, 0xAC,
-    0x57, 0xCE, 0xEC, 0x3B, 0xE7, 0xC5, 0x33, 0x57, 0xC7, 0x8A, 0xBF, 0x31, 0xCF, 0x79, 0x31, 0x2A,
-    0xC6, 0xBD, 0x93, 0x60, 0x39, 0x8C, 0xF1, 0x9E, 0xE4, 0xAC, 0x4A, 0xC0, 0x75, 0xCC, 0xD5, 0xD0,
-    0x1B, 0x19, 0x9C, 0xD2, 0xD1, 0x34, 0x71, 0x55, 0x94, 0x97, 0x8D, 0x3D, 0xDF, 0x98, 0x21, 0x2E,
-    0x83, 0x6E, 0x19, 0x42, 0x6A, 0x4D, 0xBA, 0x0D, 0x55, 0x8C, 0x67, 0x08, 0x49, 0x1F, 0xE9, 0x5B,
-    0x8A, 0xD2, 0x85, 0x27, 0x03, 0x25, 0x6F, 0x6E, 0xC4, 0x50, 0xC8, 0x25, 0x93, 0x8E, 0x8D, 0xE9,
-    0x64, 0xE6, 0xD7, 0xD7, 0x5F, 0x0A, 0xD3, 0x1E, 0x32, 0xA2, 0xB4, 0x02, 0xA8, 0xAF, 0x0D, 0xC1,
-    0x18, 0x77, 0x30, 0xB6, 0x1A, 0xE0, 0x7F, 0x50, 0x3E, 0x2F, 0xC4, 0x34, 0x63, 0x61, 0xE8, 0x68,
-    0x70, 0x1F, 0x22, 0x39, 0xE3, 0xD2, 0x65, 0x7C, 0x35, 0x7F, 0xF3, 0x72, 0x46, 0x5F, 0x4C, 0x7F,
-    0x73, 0x1D, 0x83, 0x0C, 0x0E, 0x13, 0x64, 0xB3, 0xC6, 0x48, 0xA3, 0xA1, 0x20, 0xE4, 0xD8, 0xA5,
-    0x35, 0xBE, 0x27, 0x91, 0x46, 0xA3, 0xF9, 0x7E, 0x59, 0x1D, 0xCF, 0x4A, 0xEE, 0x8F, 0x3F, 0x66,
-    0xE1, 0x96, 0xD5, 0xE4, 0x4E, 0xCD, 0x03, 0xA3, 0xCB, 0xFA, 0x29, 0xAD, 0x64, 0x88, 0x7B, 0xEB,
-    0xD0, 0x24, 0xEE, 0xBD, 0x83, 0x5D, 0xD7, 0xF8, 0x83, 0xD6, 0xAB, 0xEF, 0xB1, 0x12, 0x69, 0xE3,
-    0x2F, 0x5F, 0x8F, 0xDC, 0x4B, 0x0A, 0xA6, 0x01, 0xB3, 0xC5, 0x1B, 0x0B, 0x04, 0x22, 0xE3, 0x27,
-    0xF3, 0xF7, 0x58, 0x08, 0x20, 0xA0, 0x0B, 0xF0, 0xD0, 0xDE, 0xB5, 0x92, 0x41, 0x03, 0xC2, 0xB0,
-    0xE3, 0xEB, 0x0B, 0x05, 0xD7, 0x4A, 0xEB, 0x61, 0x05, 0x3F, 0x98, 0x81, 0x42, 0x28, 0x05, 0x50,
-    0x0C, 0x88, 0x94, 0xCD, 0xD2, 0x73, 0xC3, 0xC9, 0x22, 0x72, 0xE8, 0xD7, 0x82, 0xA5, 0x9D, 0xBD,
-    0xB7, 0xB4, 0x68, 0x4A, 0x57, 0x65, 0xBF, 0x3C, 0x5E, 0x4D, 0x02, 0xF1, 0xE8, 0x50, 0x37, 0x27,
-    0x35, 0x64, 0xA4, 0x9D, 0xE6, 0x0A, 0x3A, 0xC4, 0x9C, 0x2C, 0x7F, 0x0E, 0xB8, 0x81, 0x36, 0x78,
-    0x4C, 0xC2, 0x11, 0x03, 0x8C, 0xE6, 0x46, 0xD8, 0xAE, 0xF2, 0x0D, 0x51, 0x43, 0x82, 0x14, 0xD9,
-    0xCF, 0x2E, 0x72, 0xA6, 0x54, 0x6D, 0x5F, 0xFE, 0xFD, 0xD4, 0x79, 0x10, 0x44, 0x30, 0xD6, 0xA2,
-    0x95, 0x3E, 0xC5, 0xA3, 0x04, 0x2B, 0x45, 0x99, 0x04, 0x3F, 0x0D, 0x69, 0x99, 0x96, 0xDF, 0x58,
-    0x4D, 0x48, 0x1F, 0x02, 0x89, 0xB0, 0x20, 0x8F, 0xFB, 0xA0, 0xF3, 0xDB, 0xE4, 0xEE, 0x5F, 0x72,
-    0x61, 0x89, 0xA5, 0x2B, 0x7C, 0xF3, 0xF1, 0x8F, 0xFA, 0xDE, 0x8E, 0x65, 0xAC, 0x48, 0x2E, 0xFE,
-    0xED, 0x5C, 0x57, 0x19, 0xA3, 0xBC, 0x26, 0xEB, 0xDE, 0xC5, 0x63, 0x79, 0x52, 0xDB, 0xDC, 0xAE,
-    0x01, 0x4C, 0xA8, 0xAE, 0x59, 0x93, 0x1D, 0x56, 0xD7, 0x97, 0x44, 0x68, 0x95, 0x4B, 0x1A, 0x6B,
-    0xE6, 0xB8, 0x3F, 0xFC, 0x16, 0xA5, 0x39, 0x1D, 0xB0, 0x04, 0xE3, 0x74, 0x80, 0x86, 0x4D, 0x07,
-    0xAC, 0xEE, 0x72, 0x54, 0xF5, 0xE9, 0xDA, 0xBE, 0x23, 0x48, 0xDF, 0xEF, 0xB8, 0xAF, 0x75, 0x19,
-    0xF7, 0x3E, 0xDB, 0xC6, 0x3E, 0x50, 0x35, 0xFC, 0x41, 0x83, 0x49, 0x88, 0x2B, 0x6C, 0xED, 0xB9,
-    0xDE, 0x3B, 0x58, 0x5B, 0x24, 0x48, 0xA5, 0xB3, 0x83, 0x27, 0x08, 0x3F, 0x38, 0x70, 0x2A, 0x8D,
-    0xAB, 0xCC, 0xB9, 0x53, 0x45, 0x2A, 0x3A, 0x72, 0xEF, 0xB2, 0xFE, 0xFD, 0x91, 0xB6, 0x0E, 0xEC,
-    0xE3, 0xE1, 0x5D, 0x0E, 0xEE, 0x73, 0x0D, 0xD1, 0xEA, 0xB6, 0x86, 0x9E, 0x96, 0xA3, 0xF8, 0x5A,
-    0xD6, 0x72, 0xAF, 0x29, 0xA7, 0x83, 0x47, 0xAD, 0x92, 0x5D, 0x38, 0x43, 0x19, 0x3B, 0xC6, 0x6F,
-    0x4C, 0xAC, 0x0B, 0x48, 0x8A, 0xB5, 0xD6, 0x02, 0x90, 0xE7, 0x0E, 0xF8, 0x8A, 0x28, 0x79, 0x8F,
-    0xB5, 0x55, 0xE6, 0x19, 0x31, 0x63, 0xCC, 0x40, 0xA3, 0xC0, 0x4B, 0xF4, 0x82, 0xC9, 0x79, 0xF8,
-    0xB4, 0x15, 0x13, 0x3D, 0xB9, 0x6E, 0xCE, 0x80, 0xDC, 0xF5, 0xF4, 0xA8, 0x8A, 0x66, 0x58, 0x3C,
-    0x61, 0x48, 0x89, 0x65, 0x79, 0x96, 0x20, 0x59, 0x48, 0x6E, 0x62, 0x25, 0x61, 0x77, 0xD0, 0xAD,
-    0xC5, 0x5B, 0xA7, 0xAB, 0xC8, 0xA1, 0xB3, 0x2A, 0x02, 0x1E, 0xA6, 0x08, 0xF9, 0xE5, 0x4E, 0x17,
-    0xC8, 0x2F, 0x71, 0x21, 0x11, 0xDF, 0xCA, 0x08, 0xF9, 0x41, 0x40, 0x3B, 0x46, 0x2D, 0x40, 0x05,
-    0xB2, 0xC7, 0x02, 0x7E, 0x8E, 0x29, 0x5C, 0xC5, 0x52, 0xF2, 0x2B, 0x82, 0xDF, 0x7B, 0xD0, 0x10,
-    0x4C, 0xB5, 0x8B, 0xB4, 0x6E, 0xD7, 0x23, 0xBE, 0xCE, 0x7F, 0x0D, 0x17, 0xF2, 0x62, 0x54, 0x7E,
-    0x95, 0x0B, 0x61, 0x36, 0x90, 0x4A, 0xA3, 0x78, 0xD9, 0xA6, 0xB0, 0x04, 0xAC, 0xB9, 0x29, 0x56,
-    0x38, 0xEC, 0x2C, 0xE8, 0x48, 0x85, 0x5F, 0xBB, 0x90, 0xEF, 0xAC, 0x1B, 0x20, 0xC6, 0xCC, 0x12,
-    0xC3, 0xB0, 0x0A, 0x97, 0x20, 0x97, 0x6F, 0x1F, 0x83, 0xBE, 0x2C, 0x21, 0x6C, 0x68, 0xCC, 0xBF,
-    0x01, 0x5E, 0x1E, 0x8C, 0xE6, 0xF8, 0xB9, 0xF5, 0x83, 0x6F, 0xD8, 0x23, 0x7D, 0xB8, 0x0F, 0x86,
-    0xA8, 0x4B, 0xAB, 0xB8, 0x11, 0x93, 0xEC, 0xCC, 0x99, 0xC6, 0xE8, 0xFC, 0x3A, 0x7A, 0xF2, 0xA6,
-    0x73, 0x21, 0x75, 0xAA, 0xB3, 0x6C, 0xCC, 0xA9, 0x61, 0xF2, 0x22, 0x34, 0xCB, 0xC1, 0x99, 0xE5,
-    0xD7, 0xBC, 0xC8, 0x0B, 0xF1, 0xAD, 0xF1, 0x39, 0x6B, 0x70, 0x2C, 0x03, 0x69, 0x05, 0x68, 0x0A,
-    0x6C, 0xF6, 0xCD, 0x6C, 0x35, 0xD7, 0x7A, 0x2B, 0xAB, 0xFA, 0x17, 0xE6, 0x69, 0xC7, 0x73, 0x75,
-    0x34, 0xEB, 0xEE, 0x45, 0x8F, 0xD7, 0xBB, 0x3F, 0x0B, 0x28, 0x58, 0x12, 0xBA, 0xF8, 0x0A, 0x98,
-    0xB6, 0xA6, 0x37, 0xF8, 0x1E, 0x98, 0xF8, 0x17, 0xCF, 0xFF, 0x6A, 0xC0, 0xC4, 0x57, 0x8B, 0x12,
-    0x00, 0x77, 0x42, 0xCC, 0x7D, 0xA8, 0xE0, 0x0E, 0xE6, 0xB6, 0x3B, 0x0E, 0x10, 0x54, 0x36, 0x1B,
-    0x21, 0xB5, 0xEC, 0xDA, 0x4E, 0x17, 0xFF, 0x7C, 0x17, 0x22, 0x19, 0x58, 0x2F, 0x44, 0x8A, 0xED,
-    0xA2, 0xC4, 0x46, 0xC5, 0x16, 0x22, 0xE4, 0x21, 0x06, 0xD0, 0xFC, 0x94, 0x3D, 0x96, 0x11, 0xE3,
-    0x69, 0x6C, 0xD6, 0xBF, 0xD4, 0x28, 0xF9, 0x0A, 0x84, 0x2F, 0x5C, 0xA9, 0x7A, 0x01, 0x6D, 0x33,
-    0x9F, 0x6A, 0x3B, 0x4C, 0xEB, 0x93, 0x03, 0xC5, 0xE2, 0x03, 0x96, 0x03, 0xD6, 0x7B, 0x38, 0x4E,
-    0x44, 0x66, 0x31, 0x8B, 0x5C, 0x79, 0xD4, 0x20, 0xB5, 0xDF, 0xEE, 0x8C, 0xBC, 0x59, 0x07, 0xB0,
-    0x9E, 0x18, 0xD6, 0x93, 0xDD, 0x45, 0x26, 0x07, 0x41, 0x0D, 0x84, 0xBD, 0x54, 0xFF, 0x25, 0x80,
-    0x09, 0x74, 0x07, 0xBC, 0x87, 0xD9, 0xF7, 0x1E, 0xDF, 0xA4, 0xE9, 0x2F, 0x44, 0x48, 0x89, 0x94,
-    0x1A, 0x84, 0xA6, 0xF4, 0x18, 0xD9, 0x51, 0x8F, 0x31, 0x1F, 0xB9, 0xDC, 0x1F, 0xB9, 0xC5, 0x57,
-    0x8E, 0x3C, 0xD3, 0x91, 0xEF, 0xF5, 0x46, 0x2E, 0x0C, 0xF1, 0x00, 0x08, 0x6A, 0x59, 0xC3, 0xB3,
-    0xFA, 0xD7, 0x0F, 0x84, 0xA9, 0xC8, 0xF0, 0xDB, 0xB4, 0x4A, 0x6B, 0x44, 0x35, 0xDB, 0x93, 0x9B,
-    0x28, 0x9A, 0x23, 0xD9, 0xC0, 0x8B, 0x8C, 0xEE, 0x44, 0x92, 0x4C, 0xFF, 0x3E, 0x09, 0x27, 0x3D,
-    0x79, 0xFE, 0x8D, 0x7F, 0x31, 0x80, 0x52, 0x0A, 0x16, 0xBA, 0xC8, 0x8B, 0x92, 0x82, 0x8A, 0x1B,
-    0x4F, 0x30, 0x48, 0xF6, 0x80, 0xC9, 0x86, 0x56, 0xC3, 0x59, 0x9A, 0x29, 0x5D, 0x24, 0x5F, 0x4C,
-    0xEF, 0x02, 0x54, 0x7F, 0x59, 0xED, 0x03, 0xE0, 0x9F, 0x44, 0x04, 0x1F, 0x23, 0xE8, 0xD7, 0x6C,
-    0x9E, 0x2D, 0x7B, 0xA8, 0x18, 0x6F, 0x17, 0xFB, 0xBA, 0x61, 0xC8, 0x0E, 0x93, 0xB0, 0x8D, 0x8D,
-    0x3A, 0xEB, 0x0F, 0xD6, 0x8C, 0xD6, 0x6C, 0x15, 0xDC, 0x87, 0xC2, 0xEF, 0x8B, 0xA8, 0x2B, 0x8A,
-    0xA6, 0x60, 0xA5, 0xC6, 0x14, 0x0F, 0x59, 0x76, 0x3F, 0xB4, 0xEB, 0x5B, 0xB0, 0xCE, 0x14, 0x37,
-    0x47, 0xA6, 0x56, 0x65, 0x04, 0x4F, 0x1B, 0xC8, 0x4A, 0x6F, 0x56, 0xCF, 0xAD, 0x7E, 0xF3, 0xCC,
-    0xA0, 0xAD, 0x16, 0x9D, 0x58, 0x62, 0x4F, 0xAA, 0xA4, 0x89, 0x1A, 0x7D, 0x83, 0x54, 0x94, 0x23,
-    0xCB, 0xD3, 0xAC, 0x24, 0xE9, 0xEB, 0x6F, 0xFD, 0xF3, 0x8A, 0x32, 0x9D, 0x8C, 0x53, 0xA6, 0xCD,
-    0xA0, 0x90, 0x76, 0x0A, 0x6D, 0x3E, 0x76, 0xA9, 0x77, 0x8E, 0x82, 0x1E, 0x23, 0x63, 0x15, 0x8A,
-    0x41, 0xCD, 0xFF, 0x01, 0xCD, 0x5B, 0xBF, 0x93, 0xDD, 0xD6, 0x75, 0xBE, 0x00, 0xB2, 0x8B, 0x09,
-    0x31, 0x13, 0xA8, 0x59, 0x8F, 0x22, 0x16, 0x68, 0x13, 0xA6, 0xC0, 0x3F, 0x10, 0x12, 0x90, 0x38,
-    0x63, 0x16, 0x2A, 0x48, 0x4D, 0xB8, 0x52, 0x46, 0x2E, 0xDC, 0x78, 0x26, 0x13, 0xC7, 0x19, 0xFE,
-    0x03, 0x36, 0x01, 0x93, 0x85, 0x0B, 0x15, 0x5A, 0x8D, 0x95, 0x2A, 0x85, 0x59, 0x48, 0x19, 0x6B,
-    0x35, 0x93, 0x6D, 0x55, 0x28, 0x04, 0xA8, 0x2D, 0x58, 0xB0, 0x20, 0x28, 0x26, 0xE3, 0x42, 0x85,
-    0x60, 0x91, 0x89, 0x33, 0x64, 0x41, 0x48, 0x04, 0x23, 0xEC, 0xF2, 0x02, 0x37, 0xDF, 0x77, 0xEE,
-    0xC5, 0xDB, 0xB7, 0x3F, 0x48, 0x25, 0x12, 0x25, 0x79, 0x77, 0xDF, 0x7D, 0x78, 0x78, 0xC0, 0xC5,
-    0x3D, 0xBF, 0xBF, 0x73, 0xCE, 0x5D, 0xB5, 0xB2, 0x69, 0x72, 0xE5, 0x1B, 0xA3, 0x95, 0xCA, 0x8C,
-    0xA9, 0xD5, 0xEA, 0xE6, 0xBB, 0xE7, 0xD5, 0x93, 0x7E, 0xB2, 0x1A, 0x43, 0x30, 0xF1, 0xB0, 0xEA,
-    0x30, 0xC4, 0xB8, 0x57, 0x79, 0x66, 0xE0, 0x57, 0x0F, 0xF0, 0x5D, 0xB0, 0xC3, 0xEF, 0xAA, 0xB3,
-    0xF8, 0x2E, 0xEE, 0xAA, 0x5C, 0x79, 0x53, 0x88, 0xEF, 0xB2, 0x06, 0xF7, 0x05, 0x9A, 0xF7, 0x55,
-    0x75, 0xD2, 0xA9, 0x78, 0xC2, 0x33, 0x3D, 0x63, 0x70, 0x1F, 0x1E, 0x69, 0xEA, 0x00, 0xC3, 0xA4,
-    0x2A, 0x8C, 0x5D, 0xAC, 0x55, 0x60, 0x5E, 0xC4, 0x32, 0xD2, 0x21, 0xEB, 0x31, 0x73, 0xAD, 0xD6,
-    0x7F, 0x5A, 0xE2, 0x22, 0x2C, 0x70, 0x8A, 0xCD, 0xBD, 0x77, 0x8E, 0x58, 0x93, 0x37, 0xE5, 0x98,
-    0x46, 0xFB, 0xBC, 0xBB, 0x29, 0xEA, 0x8B, 0xAA, 0x3A, 0xDD, 0xA9, 0x31, 0xAE, 0x83, 0xE1, 0x94,
-    0x8A, 0xDB, 0x5E, 0xA5, 0xDB, 0x8D, 0xAA, 0xE2, 0x32, 0xD0, 0xD9, 0x3D, 0xD3, 0xE1, 0x21, 0x35,
-    0x9E, 0xF3, 0xA2, 0x31, 0xA3, 0xAA, 0x36, 0xE6, 0x19, 0x46, 0x5F, 0x93, 0x16, 0x53, 0x2A, 0x85,
-    0x59, 0x94, 0x0A, 0xF1, 0xAD, 0x52, 0xD1, 0xEE, 0x51, 0x2C, 0x08, 0xB4, 0x30, 0xA2, 0xE5, 0x05,
-    0x86, 0x87, 0xA6, 0xC7, 0x90, 0xF0, 0xDE, 0x60, 0xE2, 0x77, 0xD9, 0x6F, 0xF0, 0x5D, 0xD4, 0xF3,
-    0x3B, 0x13, 0xE1, 0xBB, 0xA4, 0x2D, 0x4A, 0x15, 0x8C, 0xBC, 0x2F, 0xAB, 0x71, 0x5F, 0xA4, 0x3D,
-    0x7C, 0x67, 0xEE, 0x6D, 0xF5, 0xB8, 0x0B, 0xCF, 0x24, 0xF5, 0x5A, 0x18, 0xD1, 0x46, 0x18, 0x8C,
-    0x02, 0xD1, 0x59, 0x9F, 0x68, 0x08, 0xE5, 0x32, 0xD8, 0x9B, 0xD8, 0xE7, 0x95, 0x59, 0x5E, 0x3D,
-    0xC0, 0x9D, 0xA6, 0x05, 0xA1, 0xCA, 0x5B, 0xAC, 0xFD, 0x19, 0xB0, 0xE0, 0x7B, 0x10, 0x2A, 0x66,
-    0x6A, 0xF8, 0xD0, 0x41, 0x68, 0xFB, 0x5B, 0x1E, 0xCA, 0xD9, 0x84, 0x7C, 0x57, 0x17, 0xEA, 0x3D,
-    0xD2, 0x92, 0xBB, 0xD4, 0x4B, 0xAD, 0x52, 0x50, 0x4D, 0xDA, 0xC2, 0x36, 0xEA, 0x03, 0x10, 0xA7,
-    0xC0, 0xB2, 0x92, 0xD4, 0xC5, 0xB9, 0x3F, 0x04, 0x20, 0x4F, 0x0D, 0x64, 0x2F, 0xE8, 0x8B, 0xC8,
-    0x4E, 0x3C, 0x36, 0x07, 0x77, 0x71, 0xFE, 0xD7, 0xE0, 0x9F, 0xCF, 0x69, 0xF9, 0xBA, 0x8A, 0x57,
-    0x3A, 0x51, 0xC0, 0x78, 0x44, 0x41, 0x62, 0x9F, 0x73, 0xCF, 0xE1, 0x4A, 0x12, 0xD0, 0x1D, 0xF0,
-    0x64, 0x31, 0x2F, 0x70, 0xDF, 0xCF, 0xAA, 0xD9, 0xC1, 0x8D, 0xA6, 0x0D, 0xC8, 0x39, 0x92, 0x98,
-    0x9A, 0x5D, 0x1D, 0xE0, 0x19, 0xC2, 0x36, 0x10, 0x09, 0xD2, 0xA0, 0x05, 0xE9, 0x40, 0x6A, 0x30,
-    0x15, 0x68, 0x75, 0x07, 0x9A, 0x07, 0xB8, 0x2E, 0x35, 0x1B, 0x3F, 0xB8, 0x46, 0x71, 0xC7, 0xBC,
-    0xBD, 0x30, 0x22, 0x32, 0x53, 0xCB, 0x8A, 0x8F, 0xD3, 0xF8, 0x82, 0x56, 0x79, 0xB8, 0x0B, 0xD7,
-    0x5F, 0xC4, 0x6D, 0x39, 0x9F, 0xEA, 0x9B, 0x32, 0x32, 0x3D, 0x34, 0x32, 0x18, 0x7F, 0x48, 0x35,
-    0x35, 0x54, 0x06, 0xD0, 0x2D, 0x8A, 0x68, 0x44, 0x13, 0x43, 0xF3, 0xAF, 0x58, 0x4F, 0x1B, 0x63,
-    0x59, 0x17, 0x76, 0x70, 0xCB, 0x49, 0x2E, 0xBF, 0xE3, 0xAD, 0xA0, 0xB2, 0xE2, 0x35, 0xB7, 0x35,
-    0xEE, 0x88, 0xBA, 0xA3, 0xF4, 0xF9, 0x82, 0xD9, 0x50, 0x05, 0x24, 0x05, 0xA1, 0x35, 0xB1, 0x5D,
-    0xD1, 0x56, 0x9D, 0x8D, 0x4E, 0xBB, 0x39, 0x43, 0x32, 0xC8, 0x2A, 0x96, 0x09, 0xEA, 0x9D, 0xC0,
-    0x78, 0x9D, 0x6F, 0x76, 0xBC, 0x9F, 0x51, 0x93, 0xA9, 0x55, 0x3A, 0xB4, 0x8C, 0x01, 0x41, 0xD4,
-    0x33, 0xAF, 0x32, 0xA2, 0xBE, 0x24, 0x0A, 0xEA, 0x12, 0x1B, 0xDC, 0xA6, 0xD5, 0x14, 0x75, 0x59,
-    0x9E, 0xCC, 0x42, 0xC6, 0xD4, 0x3E, 0x56, 0x5E, 0xE0, 0xF1, 0x8F, 0x9E, 0xF7, 0xC5, 0x4A, 0x44,
-    0x31, 0x40, 0x65, 0xE0, 0x3E, 0x41, 0x62, 0xC9, 0xF4, 0x81, 0xB2, 0xBC, 0xCF, 0x57, 0xB1, 0x62,
-    0xB5, 0x46, 0xFB, 0xA3, 0xE5, 0x71, 0x61, 0xF1, 0x30, 0x2F, 0x55, 0x7F, 0x0F, 0x42, 0x4B, 0x41,
-    0x58, 0x2F, 0x8B, 0xC4, 0x4C, 0x50, 0xAA, 0x35, 0xEB, 0x3F, 0x2B, 0x58, 0xEA, 0x08, 0x83, 0xC8,
-    0xCD, 0x2B, 0x65, 0x65, 0xC9, 0x6F, 0x85, 0x30, 0x63, 0x3F, 0x0C, 0x78, 0xF2, 0x7D, 0xF8, 0xB6,
-    0x81, 0x34, 0x1D, 0x87, 0x05, 0x9F, 0x57, 0x2B, 0x2A, 0xEA, 0xC2, 0x4E, 0xA5, 0x10, 0x17, 0xF8,
-    0xA1, 0xAC, 0xA9, 0x88, 0xD8, 0x4E, 0x1D, 0xE9, 0x8E, 0xBF, 0x7D, 0xE2, 0x4E, 0xA8, 0xD5, 0xB7,
-    0xC6, 0x60, 0x08, 0xA7, 0x49, 0x5C, 0x5C, 0x01, 0xFD, 0xC4, 0xAD, 0xC7, 0x72, 0xF5, 0x0D, 0x84,
-    0x77, 0xAC, 0xF4, 0xDF, 0x01, 0x2F, 0xE0, 0x15, 0xE3, 0xC7, 0x03, 0xDD, 0xCD, 0x2C, 0x41, 0x51,
-    0x89, 0xE7, 0x0F, 0x12, 0x89, 0x95, 0x6D, 0x50, 0x3B, 0x07, 0x52, 0x38, 0x8A, 0xB7, 0x8C, 0x87,
-    0x57, 0x8D, 0x86, 0xE2, 0x17, 0x3D, 0xEE, 0xCD, 0xEE, 0xE0, 0x09, 0xC5, 0x4D, 0x32, 0x36, 0xA3,
-    0x55, 0xE0, 0x54, 0xF4, 0x10, 0xA7, 0xB2, 0xF9, 0x54, 0x8C, 0x53, 0x3F, 0x30, 0x0F, 0xE9, 0x5B,
-    0xDF, 0xE4, 0x14, 0x74, 0x4F, 0x1D, 0x3F, 0x71, 0x2E, 0x58, 0x8D, 0xB9, 0x2B, 0x2A, 0xAA, 0x65,
-    0x28, 0x38, 0x40, 0x5C, 0xBE, 0x1D, 0x0C, 0x87, 0x49, 0xA5, 0x1F, 0xEB, 0x09, 0xA2, 0xD4, 0xEF,
-    0x85, 0x64, 0x4C, 0xBC, 0x8B, 0x21, 0x69, 0x32, 0x78, 0x9C, 0x12, 0xC6, 0x91, 0xE5, 0x58, 0x7D,
-    0xA6, 0xEC, 0xD0, 0xBB, 0xA1, 0x04, 0xD3, 0x53, 0x2E, 0x3A, 0xE6, 0x10, 0x71, 0x08, 0x38, 0xA8,
-    0x0B, 0x8C, 0x1C, 0x99, 0x99, 0x72, 0x65, 0x89, 0x12, 0x6F, 0x99, 0xCB, 0xD8, 0xA8, 0xEC, 0xF7,
-    0xAF, 0x23, 0xFE, 0x60, 0xCD, 0x69, 0xCF, 0x91, 0x53, 0x8A, 0xA1, 0xCB, 0x48, 0x0B, 0xF5, 0x65,
-    0x0C, 0xDC, 0x28, 0xC6, 0x2F, 0x63, 0xC2, 0x71, 0xC5, 0xC5, 0x11, 0xEB, 0x81, 0x3B, 0x1B, 0x53,
-    0xAC, 0x37, 0xE6, 0x38, 0xC9, 0xB3, 0x36, 0xF6, 0x68, 0xA5, 0x1F, 0xC4, 0x2D, 0x7B, 0x83, 0xF7,
-    0xDA, 0x78, 0x9E, 0xB4, 0x2A, 0x6F, 0x71, 0xEA, 0x1B, 0xD3, 0xBA, 0xF2, 0xFA, 0x56, 0x59, 0x08,
-    0xAF, 0xC7, 0x64, 0xF3, 0xBD, 0x73, 0x47, 0x68, 0xF1, 0xE6, 0x96, 0xF9, 0x1D, 0xD6, 0x08, 0x17,
-    0xA2, 0x0B, 0x73, 0xEF, 0x2D, 0xBA, 0xE7, 0x81, 0x61, 0x13, 0x52, 0x2D, 0xA1, 0x60, 0xEF, 0xF7,
-    0x98, 0xB1, 0xC1, 0xFC, 0x79, 0x65, 0x46, 0x1F, 0x02, 0x89, 0xF0, 0x6D, 0xDA, 0x32, 0x84, 0x6E,
-    0xFE, 0x1A, 0xF7, 0xDD, 0xC4, 0x0B, 0x74, 0x8D, 0x78, 0x7B, 0x2C, 0x64, 0xE3, 0xE7, 0x04, 0xC3,
-    0xA8, 0x19, 0xA9, 0xC6, 0x6B, 0xEB, 0xEA, 0x69, 0x3F, 0xE9, 0x5D, 0xD0, 0x09, 0xB6, 0xDD, 0xD7,
-    0xC1, 0xE0, 0xF7, 0xC9, 0xAD, 0xD7, 0x18, 0x1F, 0xB7, 0x31, 0xCF, 0x59, 0x6A, 0xCA, 0xBB, 0xB9,
-    0xC2, 0x72, 0x02, 0xF1, 0x86, 0xE7, 0xFE, 0x11, 0xE4, 0xF5, 0x0C, 0x2A, 0x78, 0xA9, 0x63, 0xC2,
-    0x48, 0xF0, 0x23, 0x53, 0xE6, 0xC1, 0xE0, 0x53, 0x1C, 0x60, 0xB0, 0x57, 0x95, 0x07, 0xE6, 0xF7,
-    0x37, 0x2B, 0xF3, 0x63, 0xA1, 0xCC, 0x7C, 0x6E, 0xCC, 0xE6, 0x99, 0x3D, 0xCA, 0x3C, 0xCC, 0x1C,
-    0x4D, 0x5B, 0x7B, 0x94, 0x99, 0x3E, 0xD2, 0x96, 0x32, 0xCC, 0x12, 0x98, 0xCD, 0xCD, 0xB3, 0x96,
-    0x32, 0x8D, 0xB7, 0x2F, 0xF1, 0x7A, 0x20, 0x82, 0xE4, 0x9A, 0x6B, 0x80, 0x01, 0xB3, 0x00, 0x03,
-    0x6A, 0x3F, 0x18, 0x78, 0x56, 0xD4, 0xAD, 0x40, 0x43, 0x11, 0xED, 0x69, 0xBF, 0xB4, 0xCE, 0xAC,
-    0x73, 0x91, 0xFB, 0x5B, 0xA5, 0x8E, 0x61, 0x0B, 0x4E, 0x83, 0x08, 0x89, 0x97, 0xD3, 0x61, 0xAD,
-    0xE7, 0xDF, 0x02, 0x75, 0x27, 0xDE, 0x37, 0x8F, 0x70, 0xE1, 0x75, 0xD1, 0xBB, 0xDD, 0x77, 0xDC,
-    0x82, 0x67, 0xBD, 0xAB, 0xEE, 0xD9, 0x05, 0xCF, 0x7A, 0x57, 0x2B, 0x7F, 0xB2, 0x7A, 0x97, 0xED,
-    0x6E, 0xBE, 0x83, 0x7B, 0x1E, 0x3A, 0xBD, 0x03, 0xDD, 0x13, 0x1D, 0x92, 0x4F, 0x3F, 0x06, 0xE6,
-    0x7C, 0x68, 0x83, 0x6E, 0x20, 0x6E, 0xE3, 0x99, 0x28, 0x98, 0xF2, 0x4B, 0xC1, 0x23, 0xC4, 0x25,
-    0xA9, 0x45, 0x68, 0x22, 0x86, 0x6A, 0xC1, 0x85, 0xAB, 0x50, 0xC2, 0xEA, 0x4C, 0x8F, 0x78, 0x9B,
-    0xAB, 0xAA, 0x17, 0xF6, 0x2A, 0x7D, 0x14, 0xBB, 0x9E, 0x31, 0xCD, 0x2B, 0xCA, 0x3B, 0x07, 0x58,
-    0x5A, 0x66, 0xD7, 0xE9, 0x6F, 0xE0, 0x87, 0xAD, 0xDB, 0x57, 0x3F, 0x7F, 0x9A, 0xB9, 0xF9, 0xF0,
-    0x7B, 0x05, 0xC0, 0xE1, 0x54, 0xD5, 0x70, 0x1B, 0x2F, 0x8E, 0x6B, 0x05, 0x6D, 0x14, 0x6A, 0xD0,
-    0x63, 0xCA, 0xDB, 0xBB, 0xE7, 0x19, 0x23, 0x01, 0x2D, 0xB1, 0x9C, 0x47, 0xAB, 0x8D, 0x43, 0xA9,
-    0x1E, 0x8D, 0x7A, 0x6B, 0xC7, 0x01, 0x34, 0x51, 0x11, 0xA0, 0x4D, 0x89, 0x0C, 0x8C, 0x72, 0x9F,
-    0x83, 0xD9, 0x4F, 0x02, 0x37, 0x07, 0xA2, 0xE5, 0x54, 0x5A, 0x3F, 0x25, 0xCE, 0x30, 0xB3, 0x01,
-    0x73, 0x63, 0xED, 0x8A, 0x4C, 0x16, 0x1A, 0x09, 0x67, 0xB9, 0x43, 0x12, 0xD4, 0x77, 0x09, 0xA1,
-    0x7F, 0x99, 0x43, 0x9A, 0x31, 0xD4, 0xB4, 0x06, 0x7B, 0x8A, 0x1E, 0xAB, 0xBF, 0x8F, 0x2B, 0x8B,
-    0x1D, 0x78, 0xD6, 0xB8, 0xCB, 0xCC, 0xDB, 0x3F, 0xD2, 0x0E, 0xB5, 0x73, 0xBA, 0x58, 0x1C, 0x10,
-    0x04, 0x0C, 0x98, 0x5B, 0x4D, 0x4E, 0x71, 0xFD, 0xCE, 0x71, 0x99, 0x71, 0xCA, 0x94, 0xDE, 0x98,
-    0xB4, 0x61, 0xE7, 0x0F, 0x87, 0xD6, 0x57, 0xDC, 0x86, 0x1F, 0x79, 0x3C, 0xD0, 0x7F, 0xC6, 0xB7,
-    0xCC, 0x90, 0xE6, 0x59, 0x9F, 0x21, 0x10, 0x9C, 0x52, 0x09, 0x5E, 0xB1, 0xBC, 0x32, 0x1C, 0x67,
-    0x79, 0xD1, 0xA5, 0x44, 0xD5, 0x46, 0xB0, 0x6E, 0x47, 0xD4, 0xAF, 0x8A, 0x4F, 0x3A, 0xCB, 0x99,
-    0x04, 0x80, 0xB8, 0xE0, 0x3A, 0x6A, 0x28, 0x51, 0x9E, 0x22, 0x36, 0xBF, 0x60, 0x5A, 0xF7, 0x80,
-    0xB0, 0x27, 0x97, 0x5C, 0xD0, 0x11, 0x04, 0x40, 0x4C, 0x9C, 0x0E, 0x4F, 0xE5, 0xDA, 0x71, 0xB3,
-    0x4B, 0x10, 0x89, 0x49, 0x8C, 0x8B, 0xC1, 0x46, 0x81, 0xB4, 0x57, 0xCB, 0x4C, 0x42, 0x36, 0x35,
-    0x2D, 0x1A, 0x05, 0xC0, 0xAB, 0x25, 0xD6, 0xBD, 0x4B, 0xD6, 0x65, 0xD0, 0x19, 0xE8, 0xF5, 0x68,
-    0x1A, 0x88, 0x70, 0x8B, 0x51, 0xE5, 0x0F, 0xD4, 0x93, 0xDA, 0x4C, 0xAF, 0x5C, 0x20, 0x09, 0x46,
-    0x07, 0x32, 0x9D, 0x48, 0xC2, 0x97, 0x00, 0x48, 0x44, 0x23, 0x3F, 0x51, 0x17, 0x35, 0xC9, 0xAE,
-    0x91, 0x85, 0x56, 0x04, 0x59, 0x77, 0x0F, 0x2E, 0x2C, 0x1C, 0xB3, 0xB2, 0x9A, 0x26, 0xB2, 0x2B,
-    0x3B, 0x63, 0x3E, 0xEB, 0x03, 0x73, 0xB6, 0x8E, 0x46, 0x72, 0x0B, 0x02, 0xBE, 0x8D, 0xE5, 0x9E,
-    0xAD, 0x71, 0x09, 0x98, 0xE5, 0x12, 0x1E, 0xDF, 0x82, 0x9B, 0xCE, 0x33, 0xCC, 0x2F, 0x0C, 0x65,
-    0x42, 0x56, 0xE1, 0xE1, 0x9E, 0xD5, 0xFB, 0xDC, 0x72, 0x2A, 0x95, 0xF4, 0x84, 0xD0, 0x32, 0x90,
-    0x6C, 0x84, 0xF0, 0xC4, 0xE6, 0x0A, 0x6B, 0xE7, 0xFF, 0xE8, 0x38, 0xE5, 0x9D, 0xB7, 0x62, 0x2F,
-    0x9C, 0xCF, 0xC4, 0xFC, 0xD9, 0xF0, 0x5D, 0x71, 0xCA, 0x96, 0x04, 0xF4, 0x6C, 0x8E, 0xC1, 0x9E,
-    0xF1, 0x14, 0xC2, 0xC8, 0xDE, 0x5A, 0x90, 0xB3, 0x2D, 0xEF, 0xC9, 0x8E, 0xFC, 0xFB, 0xB5, 0xD1,
-    0x95, 0x75, 0x4B, 0x05, 0xAE, 0x26, 0x09, 0x5C, 0x31, 0x26, 0x66, 0xC6, 0x13, 0x8F, 0x4E, 0xF2,
-    0x2E, 0x17, 0xED, 0x27, 0x1A, 0x28, 0x96, 0xD7, 0x8E, 0x89, 0x79, 0xA3, 0x89, 0x47, 0xDA, 0xE7,
-    0x00, 0xC3, 0x25, 0x0F, 0xCB, 0x60, 0xA4, 0x79, 0xC2, 0x5D, 0x7D, 0x64, 0xB1, 0x25, 0x1F, 0x4A,
-    0x0B, 0x05, 0x73, 0x2B, 0x5B, 0x37, 0x48, 0xDA, 0x93, 0x1E, 0x57, 0xC1, 0x2C, 0xA9, 0xA1, 0x6D,
-    0xFE, 0x83, 0x99, 0xF1, 0x42, 0xD8, 0xB8, 0x4C, 0xDC, 0xE6, 0x55, 0x0C, 0x22, 0x03, 0x34, 0x71,
-    0x29, 0x4F, 0x9A, 0x2F, 0x44, 0x32, 0x3D, 0x32, 0xDF, 0xEE, 0x21, 0xF3, 0xEC, 0x16, 0x4B, 0x09,
-    0x67, 0x70, 0x6A, 0x4A, 0x71, 0x6A, 0x80, 0xD7, 0xCE, 0x3E, 0xE3, 0xA9, 0x37, 0xE4, 0x54, 0xCF,
-    0x53, 0x8D, 0x2A, 0xBE, 0x30, 0xFF, 0xF4, 0xAA, 0xB9, 0x41, 0xEA, 0x45, 0x97, 0x8C, 0xF3, 0xE6,
-    0xE2, 0xCE, 0x0D, 0xF4, 0x25, 0xD5, 0xA0, 0xBD, 0x7A, 0x48, 0x2C, 0x7F, 0x73, 0x92, 0xC4, 0x2F,
-    0x16, 0x1E, 0xCF, 0x35, 0x0E, 0xE6, 0x90, 0x31, 0x2B, 0x1A, 0xD3, 0x52, 0xDC, 0x99, 0x7F, 0xAA,
-    0xB9, 0x28, 0x22, 0x8E, 0x99, 0x11, 0x40, 0x4D, 0x73, 0x6E, 0x1F, 0xFF, 0xC1, 0x82, 0x4E, 0x29,
-    0x0C, 0xA8, 0x70, 0x7A, 0x09, 0x58, 0xB2, 0x0B, 0x20, 0xA0, 0x32, 0x6A, 0x91, 0x94, 0xA7, 0x25,
-    0x52, 0xB8, 0xAB, 0x2A, 0x6D, 0xE0, 0x0D, 0x4D, 0x1E, 0x77, 0x30, 0xB8, 0xAC, 0x06, 0xD8, 0x80,
-    0xA2, 0xB7, 0xA0, 0x13, 0xA2, 0xEF, 0x20, 0xD8, 0xAA, 0x16, 0x9A, 0xA9, 0xE3, 0x59, 0x73, 0xF0,
-    0xD0, 0x03, 0x0A, 0xAC, 0x06, 0xEA, 0x89, 0x04, 0x55, 0x89, 0x25, 0x60, 0x39, 0xA9, 0x6E, 0x61,
-    0x0D, 0xD0, 0x98, 0xEA, 0x3F, 0xD7, 0xAB, 0xCE, 0xCA, 0xDF, 0x56, 0x23, 0x16, 0xAA, 0x30, 0x1F,
-    0x82, 0xF6, 0x2E, 0x16, 0xBA, 0x97, 0x0E, 0xAD, 0x1F, 0x20, 0xF5, 0xAF, 0xC1, 0xDA, 0xE8, 0x4C,
-    0xA1, 0x56, 0xFF, 0x3D, 0x13, 0xB7, 0x43, 0xED, 0xA0, 0x19, 0x16, 0xCC, 0x72, 0xCD, 0x46, 0x45,
-    0xB9, 0x8C, 0x10, 0x30, 0x28, 0xA9, 0xF2, 0x65, 0xE2, 0x32, 0xE2, 0x74, 0x21, 0x6E, 0x12, 0xE2,
-    0xA0, 0x00, 0x59, 0x17, 0x59, 0xE2, 0xBC, 0xFC, 0x5C, 0xF6, 0xAB, 0x8F, 0xCC, 0x6F, 0xE2, 0x2D,
-    0x7D, 0x2A, 0x6D, 0x7E, 0xF2, 0xE7, 0x07, 0x38, 0x0B, 0x79, 0x4C, 0x8C, 0xC0, 0x00, 0x4D, 0x55,
-    0x89, 0x58, 0x8D, 0x20, 0x82, 0x48, 0x5D, 0xCC, 0x87, 0xF0, 0xFA, 0x78, 0x34, 0x1F, 0x0C, 0xD9,
-    0x57, 0x50, 0x7D, 0xEA, 0x2B, 0x10, 0x13, 0xF0, 0xC3, 0xE5, 0xED, 0xE9, 0xE4, 0xC5, 0xC7, 0x37,
-    0x6E, 0xE8, 0x9F, 0xA7, 0x4B, 0x46, 0x97, 0x96, 0x58, 0x9D, 0x1B, 0x02, 0x02, 0x7A, 0x3B, 0xC0,
-    0xFD, 0xD4, 0x76, 0x18, 0xD5, 0xCA, 0x4F, 0xAB, 0x5F, 0x5A, 0x26, 0xDE, 0xDE, 0x7C, 0xEF, 0x09,
-    0xEE, 0x0E, 0xE9, 0x06, 0xA1, 0x41, 0xBA, 0x78, 0x23, 0x8C, 0x48, 0x0E, 0xBD, 0x81, 0x75, 0x49,
-    0x37, 0xBF, 0x11, 0xB7, 0xA7, 0xF6, 0x0D, 0x2B, 0xA4, 0x99, 0x11, 0xDA, 0x29, 0x2F, 0x4F, 0x45,
-    0x16, 0x93, 0x20, 0xF5, 0x23, 0xFC, 0x43, 0x5A, 0x4A, 0xD1, 0x86, 0xD1, 0x32, 0x6A, 0xED, 0xC7,
-    0xC9, 0xEA, 0x96, 0x00, 0x85, 0x52, 0x24, 0x44, 0xED, 0x73, 0xC0, 0x51, 0xD1, 0x80, 0x87, 0xC8,
-    0xFD, 0x86, 0xCB, 0xBF, 0xDA, 0xFE, 0x46, 0xF2, 0x1B, 0x8F, 0xF2, 0xDB, 0x20, 0xC8, 0x62, 0x25,
-    0xE9, 0xB0, 0xDA, 0x73, 0x8A, 0xB8, 0x4B, 0xBA, 0xB4, 0x4F, 0xFB, 0xD9, 0xD1, 0x47, 0xED, 0xFC,
-    0x1B, 0xCF, 0xBF, 0x9D, 0xFB, 0x45, 0x28, 0x4D, 0xDA, 0xAC, 0x2C, 0x54, 0xA1, 0x33, 0xCC, 0xA7,
-    0x9E, 0x5B, 0xC9, 0x8B, 0x4B, 0x26, 0xD6, 0x59, 0xB7, 0x07, 0x92, 0xE3, 0x21, 0x6D, 0xAB, 0x4B,
-    0x53, 0x34, 0x24, 0x6D, 0xF1, 0xCB, 0x29, 0x94, 0x37, 0x13, 0xEA, 0xA4, 0x2B, 0x3E, 0x32, 0x91,
-    0x4E, 0x3B, 0x73, 0xDB, 0x9C, 0x1D, 0xD3, 0x4B, 0x03, 0xFF, 0x2E, 0x0F, 0x19, 0xFF, 0x74, 0xB6,
-    0x8D, 0xBF, 0x11, 0xFA, 0x0D, 0x6F, 0xE2, 0x86, 0x50, 0x06, 0x3D, 0x0F, 0xD1, 0xFE, 0x21, 0x1E,
-    0x96, 0x86, 0x86, 0x18, 0x61, 0x79, 0x48, 0x3A, 0x26, 0x87, 0x8B, 0x21, 0xED, 0xE0, 0xCE, 0xEC,
-    0xD0, 0x16, 0x9D, 0xAD, 0x62, 0xCA, 0x50, 0x34, 0xEA, 0xCF, 0x72, 0xAB, 0xE7, 0xB5, 0x1D, 0x52,
-    0x97, 0x95, 0x3A, 0xAC, 0xB0, 0xBA, 0x9C, 0x64, 0x18, 0x95, 0x6C, 0x6B, 0x55, 0x24, 0x1D, 0xB2,
-    0xE4, 0x26, 0xFE, 0x02, 0x17, 0xAE, 0xEC, 0xCB, 0xB2, 0xD2, 0x8F, 0x60, 0x05, 0x30, 0x02, 0x0D,
-    0x1B, 0x68, 0x61, 0xDF, 0x97, 0x07, 0x75, 0x35, 0x86, 0x69, 0x64, 0x65, 0xDC, 0xC0, 0x0A, 0x4E,
-    0x0F, 0x6A, 0x84, 0x3D, 0xF4, 0x30, 0x87, 0x1A, 0xD6, 0x00, 0xF1, 0xE9, 0xB8, 0x0F, 0xAD, 0x00,
-    0x13, 0x3A, 0xEE, 0x01, 0x8A, 0xD2, 0xD8, 0xA0, 0xB2, 0x50, 0x3A, 0x65, 0x93, 0x07, 0x82, 0xA8,
-    0x14, 0x66, 0x9A, 0xDE, 0x9A, 0x68, 0x61, 0xED, 0x21, 0x93, 0xB1, 0xF0, 0x31, 0xE9, 0xC5, 0x53,
-    0x8A, 0xFA, 0xC1, 0x36, 0x44, 0xF9, 0x24, 0xA3, 0x90, 0x3A, 0xE7, 0x7C, 0x15, 0xA3, 0x3C, 0x83,
-    0xBC, 0x5C, 0x55, 0x2C, 0x5D, 0xE5, 0x2F, 0xAE, 0x6A, 0x83, 0xBB, 0x45, 0x2F, 0xE9, 0x30, 0x2C,
-    0xDD, 0x56, 0x21, 0xE9, 0xCE, 0xB6, 0x96, 0xD7, 0xE6, 0xF7, 0x72, 0x37, 0x96, 0x0E, 0xA4, 0xEF,
-    0x4D, 0x71, 0x57, 0xE4, 0xE9, 0x01, 0xAF, 0xED, 0xBB, 0x9A, 0x88, 0x7B, 0xEB, 0xA5, 0xBA, 0x27,
-    0x6F, 0x16, 0xDA, 0xEF, 0x7F, 0x2B, 0x6C, 0xD5, 0x67, 0x02, 0x1B, 0x40, 0xE9, 0x28, 0x31, 0x41,
-    0xEC, 0x65, 0xE1, 0x73, 0x7B, 0x57, 0xDD, 0x8B, 0xA6, 0x39, 0xD0, 0xF2, 0x93, 0xC4, 0x47, 0xC1,
-    0x73, 0xAC, 0xED, 0x78, 0x87, 0x33, 0xDF, 0xB4, 0x41, 0x64, 0x33, 0x2F, 0x19, 0x18, 0x3D, 0xC2,
-    0x5C, 0xDC, 0xC1, 0x4D, 0x66, 0xD7, 0x91, 0xB6, 0x1A, 0x9C, 0x0E, 0xE9, 0xD3, 0x92, 0x07, 0x9A,
-    0xEE, 0xBE, 0xC1, 0xEC, 0x93, 0x03, 0xD8, 0x19, 0xE3, 0x2D, 0x3F, 0x31, 0xC1, 0xA5, 0x6E, 0x28,
-    0x61, 0x05, 0xEE, 0x01, 0x64, 0x41, 0xE6, 0x97, 0x43, 0x9F, 0x4C, 0x0E, 0x97, 0x6B, 0x2E, 0xD3,
-    0xC3, 0x96, 0xB4, 0x44, 0x1A, 0xE7, 0xE2, 0xD5, 0xEC, 0xBD, 0x18, 0xCC, 0x92, 0x6D, 0xF8, 0xC9,
-    0x9B, 0x3D, 0x1E, 0x05, 0xDA, 0x44, 0xD1, 0x14, 0x69, 0xC4, 0x3B, 0xF5, 0x0D, 0x0B, 0x62, 0xF0,
-    0xFF, 0x14, 0x6A, 0x72, 0xC3, 0xD4, 0xD9, 0x47, 0xA6, 0x03, 0x0A, 0x3A, 0x94, 0xCE, 0x78, 0x86,
-    0x0E, 0xA6, 0xB1, 0x54, 0x9B, 0x5A, 0xCA, 0x5C, 0x74, 0x2A, 0x84, 0x56, 0x64, 0xC9, 0xB1, 0xF7,
-    0xAC, 0x01, 0x9E, 0x69, 0xE3, 0xB3, 0x75, 0x92, 0x96, 0x49, 0xC1, 0x47, 0x80, 0x33, 0xA0, 0x93,
-    0x7F, 0x84, 0x17, 0xEA, 0x54, 0x51, 0x5F, 0x4C, 0xBB, 0x8B, 0xF1, 0x18, 0xD0, 0xB3, 0xE4, 0x92,
-    0x35, 0x51, 0xA1, 0xB2, 0x3D, 0x3F, 0x44, 0x05, 0xA1, 0xA2, 0x1C, 0x74, 0x32, 0x2E, 0x9C, 0xEF,
-    0x01, 0xAF, 0xD0, 0x7D, 0x64, 0xDA, 0xE4, 0x72, 0xD7, 0xF4, 0xB1, 0xD4, 0x24, 0x98, 0xDB, 0x7E,
-    0x6A, 0xD3, 0xA6, 0x51, 0x0A, 0x79, 0x69, 0x1E, 0xD7, 0x61, 0x1B, 0xF4, 0xFB, 0x5C, 0x6A, 0x1E,
-    0x37, 0x61, 0xE7, 0x41, 0xC9, 0x10, 0x76, 0x22, 0x98, 0x15, 0xA2, 0x2A, 0xAC, 0xA3, 0x85, 0xBE,
-    0x80, 0x11, 0xE5, 0x7C, 0xF0, 0x76, 0x0C, 0x1E, 0x77, 0x46, 0xC7, 0x22, 0x8D, 0xD2, 0x8A, 0x99,
-    0x20, 0x88, 0x25, 0x5A, 0x62, 0xBF, 0x60, 0x2E, 0x1A, 0x6E, 0x1E, 0x2C, 0x09, 0x08, 0x96, 0x95,
-    0xD2, 0x5F, 0x6D, 0xE9, 0x90, 0x90, 0x6D, 0xD4, 0xDE, 0x89, 0x85, 0xB9, 0xD0, 0x10, 0x12, 0x77,
-    0xC2, 0xDF, 0x67, 0x3F, 0xC8, 0xFB, 0x4E, 0x13, 0x7C, 0xE2, 0xD5, 0xB3, 0xE4, 0xC2, 0xF8, 0x99,
-    0x83, 0x92, 0x2C, 0x87, 0xF5, 0x16, 0x0A, 0x43, 0x45, 0xC5, 0x95, 0xC1, 0x50, 0xF8, 0xD3, 0x81,
-    0xE1, 0x5C, 0x6C, 0x4A, 0xD6, 0x1A, 0xF7, 0x59, 0x07, 0x84, 0x65, 0x5A, 0x84, 0x2E, 0x40, 0x33,
-    0x24, 0x40, 0x79, 0xD6, 0x31, 0x68, 0xB7, 0x96, 0xEF, 0xF9, 0x12, 0xDF, 0x13, 0x38, 0x8B, 0x22,
-    0xD0, 0xBE, 0x8E, 0xBB, 0xA8, 0x03, 0x1C, 0xBD, 0x66, 0xD4, 0x14, 0x6A, 0xFF, 0x1D, 0x27, 0x86,
-    0x05, 0xDF, 0x29, 0x86, 0x07, 0xFB, 0xF8, 0xCE, 0xF5, 0x4A, 0x1C, 0xB9, 0x2A, 0xE1, 0x63, 0x82,
-    0x17, 0x8A, 0x9B, 0x31, 0xB9, 0x36, 0x42, 0x1F, 0x13, 0x29, 0xE0, 0x2E, 0xFE, 0xC0, 0x0D, 0x18,
-    0xE8, 0x11, 0x7F, 0x6F, 0xAB, 0x8C, 0x78, 0x54, 0xFE, 0x96, 0x57, 0x16, 0xC1, 0x8D, 0x65, 0x0D,
-    0x82, 0xD8, 0x65, 0x1D, 0xC0, 0xF4, 0x13, 0x5D, 0xD4, 0x6B, 0xAF, 0x2C, 0x69, 0xC4, 0x57, 0xAF,
-    0x0C, 0x86, 0x81, 0x3F, 0xBB, 0x94, 0xE4, 0xDA, 0xF9, 0x74, 0x5B, 0xA7, 0xDB, 0x23, 0xFF, 0xAE,
-    0x4F, 0xD9, 0x8D, 0xE9, 0x2B, 0x57, 0x63, 0x7F, 0x7E, 0xB2, 0xD7, 0x9F, 0x53, 0xDE, 0x68, 0x95,
-    0xB7, 0x5D, 0xE0, 0x33, 0x9B, 0x80, 0x2E, 0x2E, 0xF0, 0x6D, 0x62, 0xC3, 0x8E, 0x0E, 0x14, 0x43,
-    0xA6, 0x90, 0x52, 0xAC, 0x05, 0x9E, 0xFC, 0x4A, 0x2E, 0x08, 0x6C, 0x31, 0x2D, 0xB6, 0xCF, 0xB0,
-    0x79, 0x85, 0xAB, 0x01, 0x85, 0xF6, 0x11, 0x89, 0x05, 0xC7, 0xF6, 0x9C, 0x6D, 0x87, 0x21, 0x20,
-    0x2E, 0xDD, 0x9B, 0xB8, 0xF9, 0x0C, 0x7D, 0x8A, 0x80, 0x30, 0xC2, 0x28, 0x9A, 0x42, 0x30, 0x89,
-    0x54, 0xD2, 0x87, 0x92, 0xCD, 0x08, 0xA6, 0xB7, 0xC9, 0x82, 0x55, 0xC0, 0xB9, 0x23, 0x25, 0x4C,
-    0xE3, 0x63, 0xED, 0x05, 0x56, 0xAD, 0x17, 0x55, 0x44, 0x69, 0xD2, 0xD0, 0x5E, 0xA5, 0xA2, 0xC9,
-    0x10, 0x62, 0x8B, 0xC8, 0xA4, 0x59, 0x0A, 0x30, 0x52, 0x16, 0xB0, 0x48, 0xEE, 0x22, 0xDD, 0xC3,
-    0x60, 0x73, 0x15, 0x5B, 0x42, 0x91, 0x50, 0xC2, 0x82, 0xE5, 0xD9, 0x56, 0xAD, 0x6E, 0x58, 0xE4,
-    0x7A, 0x8E, 0x4B, 0xA7, 0xD7, 0xB2, 0x30, 0x7C, 0xB9, 0x2B, 0x74, 0xD1, 0x3D, 0xD0, 0xD3, 0x4F,
-    0x48, 0x5E, 0x0C, 0xA2, 0x4E, 0xFC, 0x39, 0xF0, 0xE0, 0x94, 0xC0, 0xC5, 0x7D, 0x86, 0x04, 0x6A,
-    0x82, 0x53, 0x4B, 0x3F, 0x43, 0x36, 0x35, 0xC2, 0xB3, 0xA5, 0xB7, 0x91, 0x16, 0xE0, 0xA0, 0xCF,
-    0x6E, 0x9B, 0x62, 0x7B, 0xCC, 0x1E, 0x8E, 0xD9, 0xB6, 0x49, 0xEF, 0xE8, 0xA2, 0x33, 0xC5, 0x75,
-    0x13, 0x19, 0x1C, 0x14, 0x40, 0xE9, 0x81, 0xD1, 0x55, 0x97, 0xE0, 0x40, 0x01, 0xA9, 0x03, 0xB8,
-    0xDE, 0x34, 0xC2, 0xFA, 0x5F, 0xD8, 0x55, 0x24, 0xA5, 0x74, 0xB2, 0xC2, 0x23, 0xCB, 0x1D, 0xBA,
-    0xDA, 0x40, 0xDE, 0xD1, 0xB2, 0x84, 0x54, 0xDC, 0x2D, 0xAE, 0x4D, 0xAA, 0xC0, 0x75, 0x3A, 0xAD,
-    0x83, 0xBE, 0x52, 0xF1, 0xC7, 0xF0, 0x2E, 0x6F, 0xF6, 0xDE, 0x94, 0x35, 0xD1, 0x80, 0x55, 0xDD,
-    0x01, 0x96, 0xBF, 0x39, 0x04, 0x26, 0x6B, 0x85, 0xEB, 0x58, 0x77, 0x0E, 0x02, 0x80, 0xCF, 0x7F,
-    0x8F, 0x24, 0x14, 0xEB, 0x26, 0x01, 0xBD, 0x8F, 0x83, 0x1A, 0xEB, 0x1E, 0x49, 0x40, 0x87, 0x75,
-    0x9B, 0xD3, 0x63, 0xF6, 0xA5, 0xC6, 0x41, 0x76, 0x5B, 0x67, 0x5F, 0x4C, 0xD9, 0x75, 0x13, 0x7F,
-    0xA9, 0x99, 0x38, 0x5E, 0x37, 0x21, 0xD7, 0x9D, 0x61, 0xDD, 0x1E, 0x0F, 0x62, 0xAE, 0xBB, 0x02,
-    0x01, 0x81, 0x4B, 0x71, 0x6C, 0x3B, 0xA9, 0x73, 0x21, 0xAB, 0x6A, 0xE6, 0xFE, 0x44, 0x6D, 0xE3,
-    0x97, 0x24, 0xC5, 0x27, 0xAE, 0x38, 0x77, 0x88, 0x6C, 0x1F, 0x39, 0x60, 0xC8, 0x72, 0xD8, 0x0E,
-    0xE0, 0x52, 0x99, 0x5C, 0x03, 0x3E, 0x85, 0x2C, 0x47, 0x4B, 0x4B, 0x72, 0x67, 0x24, 0x2D, 0xBE,
-    0xA5, 0xA5, 0x4C, 0x1F, 0x4E, 0xCA, 0x90, 0x16, 0x2B, 0x85, 0x4E, 0x42, 0x23, 0x1F, 0xC3, 0x89,
-    0x71, 0xC8, 0xB0, 0xE8, 0x0E, 0xFD, 0x4D, 0x5C, 0x71, 0x5E, 0xAD, 0x41, 0x31, 0x92, 0x46, 0xA5,
-    0x9F, 0xB0, 0x5E, 0x36, 0xBA, 0x9C, 0x52, 0xEC, 0xE5, 0x2F, 0xBE, 0x7B, 0xD9, 0xAE, 0x5E, 0x51,
-    0xBF, 0xF5, 0x47, 0x24, 0x0B, 0x55, 0x65, 0xA3, 0xA1, 0xE0, 0x14, 0xC6, 0x87, 0x2B, 0x47, 0x2E,
-    0x25, 0xBE, 0xB1, 0x23, 0xCD, 0x6A, 0xA9, 0x14, 0x82, 0x3D, 0x2C, 0x27, 0x25, 0x75, 0xD0, 0x91,
-    0x37, 0xF6, 0x15, 0x02, 0x09, 0xF2, 0x15, 0xD9, 0x57, 0x0B, 0xA0, 0x08, 0x29, 0x5B, 0x49, 0x9F,
-    0xC8, 0x17, 0x9D, 0x99, 0x51, 0xC0, 0x5F, 0x30, 0x1D, 0xD9, 0xE6, 0xFE, 0x62, 0xCA, 0xF9, 0x90,
-    0x82, 0x35, 0xB8, 0xB7, 0x4C, 0x38, 0x78, 0x9A, 0xCF, 0xB0, 0x7A, 0x94, 0xBD, 0xDC, 0x51, 0x8F,
-    0x42, 0xD1, 0xA3, 0x51, 0x55, 0x6F, 0xC2, 0x6F, 0x73, 0x76, 0x53, 0xDA, 0x8C, 0xFC, 0x5B, 0xD5,
-    0x25, 0x1A, 0xC3, 0x6B, 0x92, 0x7E, 0xF5, 0x4A, 0xCA, 0xDF, 0xE9, 0xB4, 0x17, 0xB0, 0xBF, 0xBE,
-    0xE6, 0x80, 0x37, 0x5E, 0x41, 0x44, 0x52, 0x2A, 0x76, 0x42, 0x90, 0x01, 0xAC, 0x6D, 0x0A, 0x2A,
-    0xB1, 0x99, 0x1E, 0xF0, 0xD1, 0x93, 0x37, 0x46, 0x48, 0x47, 0x32, 0xE1, 0x95, 0x6C, 0x62, 0x60,
-    0xF8, 0x67, 0xC4, 0x32, 0xE2, 0x8D, 0x88, 0x9D, 0x6F, 0x32, 0xB8, 0xB8, 0x25, 0x8F, 0xA8, 0x88,
-    0x16, 0x08, 0xB8, 0xA5, 0x5F, 0x15, 0x3F, 0x1C, 0xC5, 0xFF, 0x32, 0x90, 0x17, 0x72, 0x92, 0x41,
-    0xE2, 0x0B, 0x4E, 0xA3, 0xAB, 0xE9, 0x95, 0x82, 0x2D, 0x11, 0x83, 0x88, 0x4F, 0x0F, 0x49, 0xA7,
-    0x29, 0x59, 0x6C, 0x47, 0xFF, 0x89, 0xBC, 0xAA, 0x32, 0x4B, 0x21, 0x7E, 0x6D, 0x73, 0xEE, 0x77,
-    0x0C, 0x27, 0x36, 0xD7, 0x0F, 0x35, 0x59, 0x60, 0x6D, 0xA9, 0x2D, 0x14, 0xC6, 0x3D, 0x52, 0x92,
-    0x3C, 0x23, 0x7A, 0x87, 0xD3, 0x9B, 0x98, 0x02, 0x22, 0x32, 0xDF, 0xE1, 0xC7, 0x21, 0x1C, 0x59,
-    0x56, 0x44, 0x5C, 0x2F, 0x2B, 0x57, 0x74, 0xBB, 0x30, 0x83, 0x94, 0xA4, 0x49, 0x09, 0xB0, 0x04,
-    0x71, 0xD1, 0x86, 0x13, 0xD9, 0xF4, 0x50, 0x1D, 0xA1, 0x9F, 0x5E, 0x75, 0x57, 0xDA, 0x4A, 0xEC,
-    0x4A, 0x33, 0xE5, 0x37, 0xFF, 0x45, 0xB1, 0xE5, 0xD1, 0xC4, 0x20, 0x68, 0x6A, 0xD2, 0xC6, 0xC2,
-    0x45, 0x60, 0xE8, 0xD7, 0x85, 0x0B, 0x09, 0x9B, 0x75, 0x81, 0x16, 0x94, 0x49, 0x2E, 0x64, 0x9F,
-    0xCA, 0x49, 0xB1, 0x83, 0x8A, 0xD3, 0xA4, 0xE6, 0xED, 0x1F, 0x4B, 0xD5, 0xDA, 0xB4, 0x1C, 0x58,
-    0x21, 0xB7, 0x6D, 0x4A, 0x6D, 0xD9, 0xAD, 0x2E, 0x98, 0xE5, 0xE2, 0xA0, 0x6C, 0x95, 0x30, 0x4F,
-    0xDA, 0x2A, 0xF1, 0x8D, 0x78, 0x01, 0xAD, 0x58, 0x39, 0x47, 0xD3, 0xA9, 0x72, 0x84, 0x77, 0x80,
-    0xC3, 0x0A, 0x09, 0x78, 0x1E, 0x6B, 0x17, 0xA4, 0x8E, 0xD2, 0x0A, 0x4F, 0xCA, 0xAD, 0xB2, 0x4E,
-    0xCF, 0xEC, 0x54, 0x5A, 0x89, 0x5E, 0x10, 0x52, 0x65, 0x9D, 0x28, 0x46, 0xC3, 0x18, 0x0A, 0xF4,
-    0x4C, 0xCD, 0xE0, 0x89, 0x50, 0xB3, 0xDB, 0x12, 0x77, 0x04, 0x19, 0xC0, 0x15, 0xD4, 0x8D, 0xD3,
-    0xF6, 0xB4, 0x20, 0x88, 0x94, 0x6D, 0xE3, 0x5A, 0xB4, 0x83, 0x35, 0x15, 0xE9, 0x1E, 0x43, 0x2E,
-    0xA1, 0x54, 0x32, 0xAC, 0x7E, 0x08, 0xE3, 0xF7, 0x29, 0x88, 0x77, 0x4E, 0xAD, 0xE4, 0xAC, 0x1A,
-    0x80, 0x94, 0xD2, 0x67, 0x75, 0x05, 0xC9, 0x0D, 0x30, 0x63, 0xD1, 0x1E, 0x51, 0xA1, 0xA7, 0x20,
-    0xC4, 0xAE, 0x94, 0x34, 0xEF, 0xC9, 0x25, 0x02, 0x06, 0xE9, 0x5A, 0x87, 0xBD, 0x92, 0x9A, 0x81,
-    0xAD, 0x1D, 0xB8, 0x43, 0x39, 0x3B, 0x31, 0x42, 0xA7, 0xA2, 0x1C, 0xD2, 0x69, 0x8C, 0xA4, 0x57,
-    0x95, 0x0A, 0x0A, 0x10, 0x35, 0x5A, 0x35, 0xB7, 0xD6, 0x5F, 0xDF, 0xCC, 0x45, 0xA5, 0xA5, 0x38,
-    0xCD, 0xB5, 0xD2, 0x52, 0x58, 0xEE, 0x1E, 0xA5, 0x00, 0x27, 0xD6, 0x62, 0x03, 0x3F, 0xF2, 0x51,
-    0xA9, 0x1C, 0x68, 0x41, 0x9F, 0xA1, 0xDD, 0xE7, 0xE0, 0x9B, 0xFB, 0x3D, 0x99, 0x53, 0x71, 0x33,
-    0x84, 0x98, 0x66, 0xCE, 0x66, 0x2F, 0xC8, 0x97, 0x2F, 0x1B, 0x89, 0x28, 0x95, 0x75, 0xFF, 0xA9,
-    0xE4, 0x31, 0xFF, 0xC2, 0xCA, 0x95, 0x3C, 0xEB, 0xDE, 0xE6, 0x69, 0x63, 0x9F, 0x59, 0xC8, 0x9B,
-    0xAD, 0x08, 0x62, 0x06, 0xFB, 0xB1, 0xF5, 0x2A, 0x39, 0xBB, 0x48, 0x94, 0x06, 0xB6, 0xF2, 0xA0,
-    0xE6, 0x15, 0x74, 0x97, 0xB7, 0x6B, 0xA6, 0x4D, 0x5D, 0xD8, 0xA6, 0x4D, 0x3C, 0xAD, 0x01, 0x85,
-    0xD2, 0x0A, 0x91, 0xCF, 0x92, 0xFB, 0xDB, 0x52, 0xAC, 0xD4, 0xF8, 0x30, 0xAD, 0xD3, 0xB7, 0x12,
-    0xBE, 0x64, 0x2D, 0x13, 0xD5, 0x97, 0xB8, 0x07, 0x26, 0xFF, 0x40, 0xCA, 0x4C, 0xD4, 0x24, 0xD2,
-    0xEA, 0x4B, 0xA7, 0x13, 0x52, 0x90, 0x9E, 0xFF, 0xBC, 0x39, 0x42, 0x3A, 0x36, 0x17, 0x1D, 0x98,
-    0x59, 0x2E, 0xF9, 0xA5, 0xD0, 0xED, 0xC8, 0x6E, 0xA7, 0xD1, 0xC0, 0xAE, 0x45, 0x9E, 0x95, 0xAC,
-    0x46, 0xF8, 0x1A, 0xCC, 0xAF, 0x98, 0x13, 0xB0, 0x8F, 0xC2, 0x26, 0x76, 0x0F, 0xB1, 0x0F, 0x73,
-    0xA2, 0x5A, 0x27, 0x63, 0xD2, 0x47, 0xA3, 0x67, 0x7C, 0x78, 0xF0, 0xA6, 0x6A, 0x93, 0x21, 0x85,
-    0x4F, 0x8C, 0x21, 0xA4, 0xDB, 0xA6, 0x2E, 0x06, 0x32, 0x7E, 0xF1, 0x84, 0x53, 0xD2, 0xB6, 0xD2,
-    0x4C, 0x51, 0x6D, 0x52, 0x12, 0xFF, 0xCF, 0x10, 0x13, 0xA4, 0xE3, 0xEF, 0xB7, 0xD0, 0x71, 0x80,
-    0xEF, 0xC5, 0x5F, 0x22, 0x7F, 0xD0, 0x76, 0xF6, 0xA7, 0xFB, 0x45, 0xA9, 0xB9, 0xE8, 0xAD, 0xA8,
-    0x42, 0xE3, 0x76, 0x1C, 0x54, 0x4B, 0x79, 0x09, 0x8B, 0xA8, 0x87, 0x52, 0xD1, 0xC8, 0xEC, 0x28,
-    0x69, 0x5C, 0x48, 0x55, 0xBB, 0x4C, 0x1A, 0x96, 0x07, 0x1C, 0x49, 0x29, 0x48, 0x8A, 0xBB, 0xB8,
-    0x8D, 0xA8, 0xDB, 0xEC, 0xFE, 0x4C, 0x92, 0x70, 0x82, 0x6B, 0xC8, 0x0C, 0xCE, 0x8C, 0xE0, 0x5C,
-    0x51, 0x83, 0xA4, 0x1E, 0x24, 0x4D, 0x11, 0x48, 0xDA, 0x06, 0x8D, 0x3D, 0x48, 0x9A, 0x32, 0x1D,
-    0x2E, 0x32, 0x0B, 0xA0, 0x3C, 0x3C, 0x98, 0x49, 0xAE, 0xE6, 0x2A, 0xB8, 0xD8, 0x8E, 0x59, 0xC5,
-    0xA2, 0x08, 0xFD, 0xFF, 0xA2, 0xF2, 0xEF, 0xD5, 0xB1, 0x52, 0x10, 0x43, 0x75, 0x81, 0x30, 0xB6,
-    0x71, 0x00, 0xA6, 0x3D, 0x1C, 0xA3, 0x7D, 0x76, 0xF6, 0x2B, 0xDB, 0x88, 0x47, 0x02, 0x17, 0xF6,
-    0x20, 0xEA, 0xAA, 0x23, 0x2A, 0x02, 0x51, 0x01, 0xDB, 0x80, 0x93, 0x72, 0x9A, 0xC7, 0x18, 0x5E,
-    0xB3, 0xCF, 0xEE, 0x99, 0x5B, 0x26, 0xAF, 0xE0, 0x0B, 0x40, 0xD4, 0x48, 0xA2, 0x2E, 0x81, 0xA8,
-    0x0E, 0x50, 0x6E, 0x24, 0x51, 0x6F, 0xC2, 0xD6, 0xC5, 0xC3, 0xAC, 0xA9, 0x95, 0x97, 0x90, 0x00,
-    0x45, 0x8F, 0x8C, 0xA4, 0xCE, 0xD4, 0x75, 0xED, 0x8A, 0xB5, 0x33, 0x51, 0x4A, 0x4A, 0xDC, 0x50,
-    0xD7, 0xDD, 0x92, 0xD9, 0xAB, 0xB1, 0xD9, 0x93, 0x7D, 0x5B, 0x2E, 0xC6, 0xB9, 0x2A, 0xDC, 0xA2,
-    0x59, 0x30, 0x2C, 0x8A, 0xD0, 0xF3, 0x06, 0x81, 0xFD, 0x3B, 0xA0, 0x8E, 0x41, 0x11, 0x7D, 0x41,
-    0xEC, 0x52, 0xF1, 0xDC, 0x1D, 0x99, 0x70, 0x3E, 0x27, 0xB9, 0x90, 0xA4, 0x91, 0x02, 0x23, 0x22,
-    0x3A, 0x8F, 0x84, 0x9D, 0x09, 0xBA, 0x4E, 0x5E, 0xDA, 0x38, 0x4F, 0x70, 0x41, 0xAA, 0x15, 0xFC,
-    0x3A, 0x9A, 0x90, 0x6F, 0xA7, 0x43, 0x36, 0xFE, 0xD0, 0x7C, 0x6C, 0x6C, 0xDF, 0xDF, 0xF4, 0x6C,
-    0x2A, 0xB2, 0xF8, 0x9F, 0x2F, 0x2D, 0x27, 0x6A, 0x64, 0x31, 0xDE, 0xB0, 0x6F, 0x29, 0xC7, 0xCD,
-    0x06, 0x96, 0x51, 0xC6, 0xFF, 0xF1, 0x33, 0xD9, 0x14, 0xA3, 0x6D, 0x6A, 0x1B, 0x18, 0xB6, 0x59,
-    0x07, 0xBB, 0x6D, 0x2D, 0xE9, 0x3D, 0x95, 0xB6, 0xA7, 0x72, 0x30, 0xD1, 0x88, 0x1F, 0x87, 0xE5,
-    0xA9, 0x17, 0x66, 0x77, 0xD8, 0xCF, 0xA5, 0x6A, 0xEE, 0x91, 0x89, 0xC4, 0x61, 0x21, 0x11, 0x3A,
-    0xAA, 0x83, 0xF8, 0x57, 0xB8, 0x25, 0x92, 0x4D, 0x64, 0x12, 0xC9, 0xEE, 0xF7, 0xE4, 0x5A, 0x2E,
-    0xB9, 0x8A, 0x2D, 0x78, 0x93, 0x67, 0x2C, 0x5D, 0x40, 0x3F, 0xEF, 0x3A, 0xBF, 0x57, 0x19, 0xEB,
-    0x07, 0xC5, 0x01, 0xCF, 0x5F, 0xA7, 0x43, 0x5C, 0x42, 0xF9, 0xCC, 0xA3, 0xE3, 0xE6, 0x65, 0x63,
-    0xDB, 0xE5, 0x90, 0x37, 0x23, 0xC3, 0xF1, 0xB9, 0xDF, 0x65, 0xC3, 0x6C, 0x6E, 0x25, 0xC5, 0x50,
-    0xC9, 0xFC, 0xD9, 0x00, 0xEA, 0x17, 0x7B, 0x91, 0x75, 0x47, 0xD2, 0x95, 0xF1, 0xD5, 0x9A, 0x05,
-    0x0B, 0xB6, 0x9B, 0x25, 0x46, 0x48, 0x47, 0xB5, 0x94, 0xED, 0x39, 0xF0, 0xC1, 0xCF, 0xF9, 0x53,
-    0x70, 0x37, 0x66, 0x8F, 0x82, 0xCC, 0x65, 0x07, 0xC2, 0xDB, 0xDA, 0x79, 0xA6, 0x12, 0xCC, 0x21,
-    0xC1, 0x70, 0x96, 0xE0, 0xED, 0xB9, 0xA9, 0xD0, 0xAF, 0x0A, 0xF9, 0x94, 0x60, 0xB8, 0x68, 0xFE,
-    0xFC, 0x5D, 0xE7, 0xFC, 0x01, 0x11, 0xAD, 0x7A, 0x21, 0xFF, 0x7A, 0x84, 0x90, 0x53, 0x44, 0x60,
-    0xEC, 0x78, 0x05, 0xB5, 0xEB, 0x56, 0x23, 0x3E, 0x80, 0xA7, 0x02, 0xF2, 0xF1, 0x90, 0xF7, 0x24,
-    0xC6, 0xAD, 0xDB, 0x0E, 0x67, 0xB8, 0xC3, 0xF4, 0xDB, 0xEE, 0xE3, 0x9C, 0xB3, 0xC2, 0xE8, 0x70,
-    0x6D, 0x79, 0x6B, 0x12, 0x41, 0xE5, 0xBE, 0x05, 0x12, 0x5B, 0x10, 0x73, 0xE3, 0xD9, 0x3A, 0x89,
-    0xED, 0x64, 0xB4, 0xAE, 0xD0, 0xE6, 0x71, 0xD3, 0x8C, 0x6C, 0x68, 0xF1, 0xA5, 0x86, 0x23, 0x61,
-    0x71, 0x55, 0x62, 0x45, 0x25, 0x30, 0xA8, 0x3D, 0x25, 0x7B, 0x35, 0xFF, 0xFD, 0x02, 0x95, 0x8D,
-    0x1B, 0x21, 0x8C, 0x39, 0x23, 0x5B, 0x6F, 0x16, 0xC0, 0x84, 0x5B, 0x9E, 0x92, 0x06, 0x68, 0x14,
-    0x59, 0x36, 0xE9, 0xA3, 0xE6, 0xD0, 0xCB, 0x3F, 0xAF, 0x9E, 0x95, 0x74, 0xD7, 0xF1, 0xF3, 0x37,
-    0xC6, 0x55, 0x16, 0x8C, 0xA4, 0xD8, 0x02, 0x96, 0x6C, 0x27, 0xD3, 0xCA, 0x38, 0x77, 0x65, 0xA0,
-    0x03, 0xA7, 0xA6, 0x59, 0x95, 0x49, 0xB1, 0x88, 0x2B, 0xE4, 0x29, 0xFA, 0x6E, 0x41, 0x08, 0xDE,
-    0xA2, 0xB4, 0x28, 0x3D, 0xCC, 0x78, 0xD1, 0xF4, 0xE1, 0xA9, 0x3F, 0xE1, 0x66, 0xC3, 0x13, 0x73,
-    0x01, 0x32, 0x98, 0xDD, 0xC9, 0x06, 0x63, 0x09, 0xEB, 0x10, 0x45, 0x0E, 0xF0, 0xA8, 0xC4, 0x06,
-    0xB9, 0xF1, 0xAA, 0x44, 0x2E, 0x1E, 0x59, 0xAF, 0x55, 0x49, 0x62, 0x8E, 0x0F, 0xB2, 0x91, 0x91,
-    0xA5, 0x0C, 0xF8, 0xAD, 0x9E, 0x75, 0xC7, 0x0F, 0x64, 0x75, 0x70, 0xDC, 0xFE, 0x96, 0x4C, 0x5B,
-    0xB8, 0x26, 0x19, 0xDC, 0x69, 0x67, 0x77, 0xD6, 0x8A, 0xD9, 0x4A, 0x46, 0x69, 0x77, 0x03, 0x1C,
-    0x94, 0xEE, 0x0A, 0xD9, 0x91, 0xCD, 0x4C, 0xF8, 0x72, 0xC1, 0x97, 0xFC, 0x89, 0x4C, 0xD8, 0x3B,
-    0xD5, 0xBA, 0xD2, 0x6F, 0x70, 0x80, 0x09, 0x0B, 0xBE, 0x68, 0xD7, 0x0F, 0x76, 0xA5, 0x10, 0xF6,
-    0x24, 0x18, 0x09, 0x84, 0xF6, 0x51, 0xF9, 0x39, 0x8B, 0x79, 0x49, 0x13, 0xF6, 0xAB, 0x57, 0xA4,
-    0x10, 0x53, 0xB0, 0xEE, 0x20, 0x9D, 0xC9, 0xDE, 0xB9, 0x08, 0x57, 0x92, 0xA0, 0xC3, 0x91, 0x22,
-    0xC5, 0x7C, 0x42, 0xCA, 0x72, 0xC6, 0x72, 0x03, 0xCA, 0xD0, 0x88, 0x47, 0xFB, 0x3A, 0xC2, 0xB5,
-    0x4D, 0x29, 0x71, 0x5A, 0x02, 0xE1, 0xFE, 0xEF, 0xC2, 0xE5, 0xCF, 0x9F, 0x8A, 0xBF, 0xE5, 0xDA,
-    0x13, 0x79, 0xE3, 0xEA, 0x2B, 0x29, 0xF6, 0x01, 0x76, 0xD0, 0x2D, 0xDC, 0x01, 0x19, 0x99, 0xFD,
-    0x24, 0x79, 0xA4, 0x6C, 0x1D, 0xAF, 0x03, 0xD9, 0xA5, 0xDB, 0x78, 0xC6, 0xE6, 0x93, 0x2B, 0x1E,
-    0x13, 0x4D, 0x68, 0x47, 0xF6, 0x10, 0x84, 0x30, 0xB3, 0xF9, 0x90, 0xA5, 0xB0, 0xF2, 0x49, 0x7B,
-    0x95, 0x18, 0xAD, 0xA5, 0x12, 0xF4, 0x60, 0x64, 0xA1, 0x11, 0xD6, 0xB8, 0x38, 0xB8, 0xAF, 0xE1,
-    0xA9, 0x00, 0x03, 0xAB, 0x4F, 0xDC, 0x41, 0x81, 0x83, 0x50, 0x0E, 0x6E, 0xE0, 0x40, 0x63, 0xDE,
-    0xEA, 0x3A, 0xE2, 0x3D, 0xFC, 0xEA, 0x96, 0x74, 0x01, 0xA5, 0x09, 0x78, 0xC9, 0x75, 0xF8, 0x26,
-    0xDB, 0xCA, 0x90, 0x9F, 0x5F, 0xC4, 0x60, 0xD2, 0x5F, 0xAB, 0xF4, 0x6A, 0xA7, 0x3E, 0x80, 0x48,
-    0xBA, 0x0F, 0x0F, 0x55, 0x50, 0x54, 0xBA, 0x0D, 0x9C, 0x10, 0xD7, 0xBE, 0xCE, 0xF2, 0xA8, 0x03,
-    0x56, 0xDF, 0x06, 0xCA, 0x47, 0xD8, 0x1E, 0x53, 0x84, 0xD3, 0x4A, 0x65, 0xC8, 0x7E, 0x81, 0x41,
-    0xE2, 0x31, 0xB1, 0x25, 0xD0, 0x06, 0xFE, 0xBE, 0x94, 0x8D, 0xCE, 0xE4, 0xE5, 0xAB, 0x57, 0xA4,
-    0xD9, 0x19, 0xDA, 0xED, 0xAF, 0xF7, 0xCA, 0xA7, 0x34, 0xBA, 0x49, 0x29, 0x9C, 0x49, 0xBC, 0x9F,
-    0x52, 0x39, 0x58, 0xA6, 0xB4, 0x5A, 0x50, 0xCA, 0x03, 0xE6, 0x8F, 0xC5, 0x75, 0xCD, 0xB2, 0x3B,
-    0x10, 0xFC, 0x75, 0xB3, 0x6B, 0x29, 0x25, 0xC9, 0xF4, 0x09, 0xD2, 0xD5, 0x6C, 0x45, 0xD1, 0x9C,
-    0x53, 0x61, 0x7B, 0xCD, 0x9B, 0x37, 0xC2, 0x1D, 0xDE, 0x7B, 0xF7, 0x4D, 0xA8, 0xF5, 0x07, 0xBF,
-    0x57, 0xC9, 0x2E, 0x4D, 0x0A, 0xC6, 0x18, 0x51, 0xCF, 0x8E, 0x8F, 0xDF, 0x23, 0xB5, 0xD1, 0xCE,
-    0xCB, 0x4D, 0x5A, 0x17, 0xD0, 0xFD, 0x61, 0x7F, 0xEE, 0xFA, 0x6C, 0x64, 0xCB, 0x4D, 0x3C, 0xE2,
-    0xE2, 0xE2, 0x93, 0xAE, 0xBD, 0x22, 0x65, 0xB3, 0xF4, 0xA9, 0xBB, 0x19, 0xBE, 0x0B, 0x21, 0xC7,
-    0xA5, 0xAD, 0x71, 0x7D, 0x0A, 0x73, 0x3D, 0x69, 0x1D, 0x13, 0xAD, 0xFC, 0xD0, 0x7F, 0x4A, 0x08,
-    0xD9, 0xF0, 0x39, 0xDA, 0x91, 0xDD, 0x58, 0x2E, 0x20, 0x83, 0xF8, 0x18, 0x98, 0xF1, 0xE5, 0x0E,
-    0x5C, 0xA8, 0xE3, 0xBE, 0x68, 0x24, 0xDC, 0x9E, 0x76, 0xC5, 0x04, 0xDA, 0xBC, 0xD4, 0xEB, 0x22,
-    0xA0, 0x86, 0x06, 0xFE, 0x25, 0xEE, 0xD9, 0x71, 0x1E, 0xA5, 0xDD, 0x9C, 0xAF, 0xE5, 0xEA, 0x49,
-    0x9B, 0x2B, 0x81, 0x2D, 0x03, 0x53, 0x0B, 0x78, 0x0E, 0x18, 0x62, 0x4B, 0x1C, 0xA6, 0xCB, 0x87,
-    0xC0, 0xA0, 0x3E, 0x5B, 0x47, 0x00, 0x0A, 0x8B, 0xC3, 0x84, 0x87, 0x9E, 0x3D, 0xEC, 0xE4, 0xD0,
-    0xE2, 0x70, 0x8F, 0xFF, 0x24, 0x81, 0x10, 0x78, 0xDF, 0xE6, 0x0B, 0xD2, 0x82, 0x63, 0xA7, 0x9E,
-    0x66, 0xC6, 0x04, 0xCC, 0xE6, 0x80, 0x4F, 0x49, 0x76, 0xAB, 0xFA, 0xE8, 0x64, 0x37, 0x60, 0xAF,
-    0x42, 0x65, 0x12, 0x84, 0xEC, 0x61, 0xCE, 0xC3, 0x7E, 0xEF, 0x90, 0xFB, 0x12, 0x14, 0xD5, 0x83,
-    0x9E, 0x9A, 0x87, 0xE0, 0x11, 0xD6, 0x75, 0x9A, 0xFF, 0x98, 0x21, 0x22, 0x90, 0xA0, 0x12, 0xCD,
-    0x1B, 0x79, 0x99, 0xFA, 0xB4, 0xDF, 0xBE, 0xDC, 0x05, 0x9E, 0x67, 0x33, 0x60, 0x2F, 0x3A, 0xB7,
-    0xF7, 0xC6, 0x15, 0x85, 0x67, 0x29, 0x77, 0x7B, 0x52, 0xA6, 0xAE, 0x83, 0x94, 0xB3, 0x4B, 0xBA,
-    0x8E, 0xC4, 0xEA, 0x8C, 0xD9, 0xA2, 0x57, 0xA7, 0xAE, 0xB7, 0x12, 0x9B, 0x1F, 0x77, 0xD2, 0x9E,
-    0xF4, 0xDC, 0x6E, 0x46, 0x26, 0x07, 0x9C, 0xFC, 0xC2, 0xEC, 0xC8, 0x4E, 0xCE, 0xED, 0x5F, 0x9B,
-    0xE9, 0xB8, 0xAA, 0xBF, 0x3C, 0x55, 0xF6, 0xAC, 0xB3, 0xC1, 0x52, 0xA9, 0xAF, 0x32, 0x09, 0xB6,
-    0xAA, 0xC8, 0x25, 0x3A, 0x6C, 0xFB, 0x66, 0xAB, 0x86, 0x83, 0xBC, 0x25, 0x3D, 0xF4, 0x63, 0xDD,
-    0x56, 0x3A, 0xB8, 0x55, 0x22, 0xD1, 0xEC, 0x09, 0xB5, 0xB1, 0x86, 0x3E, 0x15, 0x4D, 0x0C, 0xB5,
-    0x6C, 0xAA, 0x3A, 0x9A, 0x62, 0xD3, 0x31, 0x73, 0x4A, 0x4D, 0x6F, 0xCA, 0x10, 0x21, 0x71, 0xA4,
-    0xC2, 0x89, 0x72, 0xE0, 0xED, 0x77, 0x86, 0x2A, 0x45, 0xD6, 0x11, 0xBC, 0x5D, 0x12, 0x60, 0x0A,
-    0x3F, 0x38, 0x4A, 0x64, 0x95, 0x00, 0x0B, 0x0D, 0x26, 0x04, 0xD1, 0xEC, 0x35, 0x5B, 0x1B, 0xB2,
-    0xFF, 0x4D, 0x60, 0x11, 0xA3, 0xA0, 0x0B, 0x70, 0xC9, 0x6E, 0xC7, 0x7F, 0x0A, 0x31, 0x7C, 0xB1,
-    0xA5, 0x52, 0xBC, 0xC1, 0x46, 0xE1, 0xAD, 0xC9, 0xEB, 0x62, 0xF6, 0x2B, 0xC3, 0x01, 0x3C, 0x06,
-    0x87, 0xA7, 0x42, 0xCB, 0x9E, 0xAD, 0x4A, 0x36, 0x1D, 0x51, 0x78, 0x86, 0x9B, 0x93, 0xB8, 0xAD,
-    0xDA, 0x54, 0x5C, 0xE9, 0x75, 0x23, 0x79, 0x01, 0xFB, 0xF4, 0xC9, 0xE2, 0x41, 0x1F, 0xCE, 0xBB,
-    0x67, 0x32, 0xD9, 0xB7, 0x4F, 0xCD, 0xFA, 0x15, 0x73, 0xF3, 0xE0, 0xE9, 0x1B, 0xF5, 0x2A, 0xEE,
-    0x00, 0x60, 0x7B, 0x65, 0x1B, 0x33, 0x4F, 0xB0, 0xD1, 0x84, 0xFF, 0x78, 0x83, 0x14, 0x93, 0x1B,
-    0x6F, 0x33, 0x76, 0xFF, 0x0B, 0xD9, 0x1A, 0x74, 0x53, 0xB6, 0x77, 0x37, 0xE4, 0x13, 0xA5, 0xD7,
-    0xBB, 0x5E, 0x87, 0x24, 0x2A, 0x59, 0xB7, 0xDC, 0x49, 0x5E, 0x20, 0x1D, 0xDB, 0x6A, 0x36, 0x47,
-    0xF5, 0xE2, 0x13, 0x18, 0x62, 0xC2, 0x5E, 0x7C, 0x1D, 0xB5, 0x4F, 0x5C, 0x1A, 0x80, 0x4D, 0x7A,
-    0x6D, 0x62, 0x51, 0xAB, 0x0E, 0xFB, 0x50, 0x8B, 0x29, 0xD1, 0xB6, 0x59, 0x32, 0x01, 0xF0, 0x29,
-    0x6E, 0x22, 0xFF, 0x92, 0xE4, 0x4D, 0xDB, 0x9E, 0x4B, 0x68, 0xAC, 0x53, 0x13, 0x6C, 0xCF, 0xCE,
-    0x15, 0x3C, 0x8F, 0xF7, 0x23, 0xC9, 0x8A, 0x72, 0x69, 0x51, 0x71, 0xC5, 0x81, 0x24, 0x8B, 0x86,
-    0x75, 0x28, 0x2D, 0x19, 0x3B, 0x2D, 0xEA, 0x63, 0x0A, 0xFE, 0xEC, 0x08, 0x00, 0xB8, 0x76, 0xEE,
-    0x8F, 0x80, 0x5B, 0xE4, 0x94, 0x94, 0x75, 0xD4, 0xBF, 0x29, 0x57, 0xE4, 0xD9, 0xBF, 0xF1, 0x33,
-    0x99, 0xFF, 0xF7, 0x42, 0xFE, 0x71, 0x46, 0x76, 0xF9, 0x69, 0xEF, 0x7D, 0x71, 0x27, 0xA1, 0x2D,
-    0xB4, 0xD6, 0xF3, 0xBF, 0x82, 0xB0, 0xEB, 0xC3, 0xE7, 0x93, 0xE3, 0xDC, 0x43, 0xCB, 0x75, 0x29,
-    0xD9, 0x5B, 0x6C, 0xCB, 0xB1, 0x85, 0x79, 0xB4, 0x9E, 0x1B, 0xD7, 0x9E, 0xB5, 0xA5, 0x52, 0xF9,
-    0x2F, 0x87, 0x5E, 0xCA, 0x4E, 0x56, 0xAD, 0xB4, 0xDD, 0xAC, 0xC0, 0x46, 0xD2, 0x11, 0x1B, 0x66,
-    0x03, 0x5B, 0x4E, 0xD4, 0x52, 0x6B, 0x92, 0x0C, 0xAE, 0x6A, 0xA4, 0x1E, 0x28, 0x69, 0xD6, 0x20,
-    0xBE, 0x4D, 0x5A, 0x2B, 0x52, 0x54, 0xDB, 0x2C, 0x5D, 0x89, 0x94, 0xFE, 0x43, 0xB3, 0xAB, 0xE2,
-    0xF6, 0x4D, 0xF8, 0xD3, 0x9C, 0x1C, 0xEC, 0x0D, 0xDF, 0x03, 0xC1, 0x34, 0x97, 0xD0, 0x56, 0x15,
-    0x25, 0x56, 0xF3, 0xB5, 0x72, 0xFE, 0x19, 0x12, 0x6C, 0x85, 0xC9, 0x84, 0xF0, 0x4C, 0x6F, 0xF1,
-    0xBA, 0xCD, 0x9E, 0x85, 0xFE, 0x23, 0xB6, 0x60, 0x7F, 0x67, 0xA4, 0x87, 0xAD, 0x37, 0xF8, 0x9A,
-    0x8D, 0xF8, 0x83, 0x0D, 0xA5, 0x73, 0xCF, 0x56, 0xE6, 0xEB, 0x2A, 0x43, 0x00, 0xB9, 0x65, 0x46,
-    0x44, 0x6E, 0x84, 0x18, 0x20, 0x8C, 0x79, 0x98, 0xF7, 0x93, 0x65, 0xCD, 0x62, 0x68, 0xB9, 0x01,
-    0xAE, 0x51, 0xFF, 0x0B, 0x75, 0x54, 0x31, 0x6F, 0x1C, 0x45, 0x14, 0x7E, 0x7B, 0xAB, 0xCB, 0x4A,
-    0x6C, 0x31, 0x69, 0x4E, 0x42, 0x50, 0x2C, 0x45, 0x8A, 0x28, 0x4A, 0x32, 0x29, 0x52, 0x50, 0x98,
-    0xCC, 0x2A, 0x2E, 0x28, 0x5C, 0x60, 0x21, 0x1F, 0x0D, 0x0D, 0x2D, 0x6E, 0xAE, 0x42, 0xA2, 0xB0,
-    0xB3, 0x0B, 0x27, 0x1A, 0x28, 0x92, 0x26, 0x15, 0x05, 0x96, 0x70, 0xE3, 0xAD, 0xF8, 0x01, 0x87,
-    0x67, 0x8D, 0x25, 0x2C, 0x91, 0xE2, 0x16, 0xB9, 0x48, 0xE1, 0x82, 0x8D, 0x49, 0x14, 0x89, 0x14,
-    0x8C, 0x73, 0x9B, 0x64, 0x63, 0xCD, 0xEE, 0xC7, 0x9B, 0x3D, 0x2E, 0x28, 0x06, 0x46, 0x73, 0xF7,
-    0x66, 0xDF, 0xCC, 0xDB, 0xF9, 0xBE, 0xEF, 0xBD, 0xB7, 0x03, 0x22, 0x1D, 0x93, 0x4E, 0x49, 0xE7,
-    0xA4, 0x0B, 0x22, 0xF2, 0x4D, 0x94, 0x36, 0xBE, 0x91, 0x29, 0xAF, 0xA3, 0x98, 0x7C, 0x4B, 0x84,
-    0x92, 0x14, 0x52, 0x71, 0xD2, 0xFA, 0x75, 0xAF, 0x66, 0x37, 0xF5, 0xBD, 0x65, 0xFB, 0x5E, 0x32,
-    0x3B, 0x9A, 0xDA, 0x49, 0xF2, 0xF3, 0x17, 0x5B, 0xFD, 0x0C, 0x3E, 0x50, 0x27, 0xC0, 0x2F, 0xD9,
-    0xDD, 0x35, 0xA2, 0xC1, 0x47, 0x31, 0x00, 0x2B, 0xF9, 0xEF, 0x38, 0xCB, 0xEE, 0x0E, 0xE5, 0x23,
-    0xB9, 0x62, 0xC4, 0x1E, 0x60, 0x24, 0x8C, 0xC7, 0xB7, 0xF4, 0xE3, 0xE4, 0xCB, 0x56, 0x58, 0x65,
-    0x90, 0xAB, 0x71, 0xAD, 0xF6, 0x2D, 0xCF, 0xE4, 0xC0, 0xCD, 0x1B, 0xA2, 0x7C, 0x77, 0x69, 0xC9,
-    0xDD, 0x71, 0x2B, 0x80, 0xDC, 0xD0, 0x06, 0xE9, 0x36, 0x91, 0xB7, 0xCA, 0x21, 0x1E, 0x1C, 0x18,
-    0x9D, 0xB3, 0x55, 0x25, 0xDB, 0xA8, 0x76, 0x76, 0x31, 0x18, 0x9A, 0x65, 0x84, 0x0E, 0xA8, 0xC3,
-    0xEB, 0x60, 0x33, 0xFA, 0x01, 0xD1, 0x1A, 0xF9, 0x0D, 0x85, 0x15, 0x89, 0x9A, 0x24, 0xF3, 0x30,
-    0x73, 0xA2, 0x3D, 0xC4, 0x5D, 0xD8, 0xFA, 0x96, 0xAE, 0x94, 0x51, 0x46, 0x56, 0x51, 0x2D, 0xAC,
-    0x68, 0x42, 0x84, 0xB8, 0x89, 0x5C, 0x97, 0xB2, 0x12, 0xD6, 0x47, 0x0F, 0x29, 0x8A, 0x4B, 0x5B,
-    0x94, 0xD4, 0xA2, 0xE5, 0x75, 0x52, 0x3A, 0x27, 0xE9, 0x32, 0xB2, 0xBD, 0x8C, 0xBC, 0x78, 0x73,
-    0x74, 0xD4, 0xE8, 0x62, 0x33, 0x28, 0xD6, 0xC2, 0x7C, 0xF7, 0xDB, 0x46, 0x1F, 0xE5, 0x13, 0xD2,
-    0x3B, 0xAB, 0x1A, 0x96, 0x27, 0x79, 0x8B, 0x49, 0x3C, 0x49, 0xA4, 0x3F, 0x06, 0x05, 0x13, 0x35,
-    0x97, 0x9D, 0xB0, 0x6A, 0xB2, 0xAB, 0x22, 0x7E, 0x83, 0x22, 0x2B, 0x5B, 0x7D, 0x8A, 0x92, 0x7F,
-    0x4F, 0x30, 0x36, 0x22, 0x1F, 0x90, 0x4F, 0xD7, 0x92, 0x93, 0xCF, 0x7C, 0x96, 0x79, 0x5D, 0xE7,
-    0x0A, 0x8C, 0x07, 0x78, 0x83, 0x85, 0x8D, 0x0A, 0x3D, 0xEE, 0x54, 0x1B, 0xC6, 0x67, 0x54, 0x7B,
-    0x4D, 0xAD, 0xA8, 0x8D, 0x1A, 0xA6, 0x62, 0xA3, 0xDA, 0x11, 0xD3, 0xE5, 0x7A, 0x7A, 0x95, 0x2A,
-    0xBF, 0x96, 0xF5, 0x87, 0x27, 0xF8, 0xC6, 0xBE, 0x15, 0xD3, 0xAA, 0x6F, 0x44, 0xA9, 0xD2, 0x84,
-    0x12, 0xAB, 0x6C, 0x68, 0xE9, 0x3C, 0x45, 0xF7, 0x9F, 0x37, 0x7A, 0xF4, 0xDB, 0x8B, 0x06, 0xB1,
-    0x42, 0x05, 0x1C, 0x02, 0x1F, 0xFC, 0xDA, 0x28, 0xBF, 0xB2, 0xA2, 0x50, 0xA9, 0x6F, 0x45, 0x15,
-    0x19, 0xBF, 0x45, 0x4E, 0x00, 0x91, 0xE2, 0xEB, 0x84, 0x21, 0x0A, 0x8A, 0xB9, 0xF2, 0xCE, 0xBA,
-    0x67, 0xC5, 0xA5, 0x81, 0x96, 0xF8, 0x5C, 0xEA, 0xCE, 0xBB, 0x38, 0xB7, 0x1D, 0x16, 0x15, 0x0E,
-    0x7F, 0xC7, 0xF4, 0xBB, 0x51, 0xB3, 0xA9, 0x4C, 0x25, 0x9D, 0xEE, 0x01, 0xB0, 0x0C, 0x3C, 0x68,
-    0xB3, 0x6D, 0x1A, 0x66, 0x21, 0xB0, 0x0F, 0xBC, 0xC4, 0xE9, 0xCE, 0xBF, 0x8E, 0x72, 0x45, 0x1D,
-    0x70, 0x21, 0xB1, 0xC9, 0x49, 0x09, 0x33, 0x81, 0xBA, 0xED, 0xCA, 0x92, 0x01, 0xC1, 0x28, 0xE4,
-    0x58, 0x8C, 0x3F, 0xB2, 0xEC, 0x52, 0xF6, 0x3D, 0xA0, 0x30, 0x2B, 0xD5, 0x0D, 0x7F, 0xD6, 0xAD,
-    0x00, 0xB9, 0x1B, 0xE1, 0xC9, 0x68, 0xF7, 0xFE, 0xF4, 0x64, 0x66, 0x37, 0x18, 0xE1, 0xE5, 0xEB,
-    0xA2, 0x0C, 0xF2, 0xB0, 0xB8, 0x52, 0x5D, 0xBC, 0x78, 0xA6, 0x84, 0xE9, 0x4A, 0x78, 0x6C, 0x13,
-    0xF9, 0x55, 0xC7, 0x48, 0xA4, 0xC4, 0x30, 0x15, 0xAB, 0x4A, 0xD4, 0xD0, 0xFF, 0x0D, 0x97, 0x83,
-    0x71, 0x3D, 0x4F, 0x80, 0xBE, 0xE7, 0xB8, 0xCE, 0x85, 0xC3, 0x5C, 0xB8, 0x43, 0xA3, 0xE2, 0x33,
-    0x09, 0x9C, 0xC7, 0xF5, 0x89, 0x8B, 0xC3, 0xF5, 0x0B, 0xF7, 0x87, 0x19, 0xB2, 0x63, 0xE0, 0xAD,
-    0x5A, 0x71, 0x60, 0x54, 0xB4, 0x67, 0x93, 0xE0, 0xA9, 0x8D, 0xEE, 0x99, 0x44, 0xFE, 0x64, 0x3F,
-    0x1D, 0x4A, 0x1C, 0xE1, 0x39, 0x1A, 0xEE, 0x4F, 0x59, 0x86, 0x5D, 0xDF, 0x7D, 0x42, 0xF4, 0x39,
-    0x69, 0x4E, 0x2A, 0x26, 0x0A, 0x7F, 0x8A, 0x29, 0xF6, 0x0D, 0x4A, 0x9B, 0x18, 0xBA, 0x1A, 0x93,
-    0x88, 0x29, 0xC8, 0xA9, 0xC7, 0x34, 0x2B, 0xA2, 0x0D, 0x22, 0xD9, 0xF1, 0xF0, 0xD9, 0x95, 0xBE,
-    0x06, 0xBB, 0x4B, 0x8A, 0x70, 0xB9, 0xF3, 0x5A, 0xB7, 0x8C, 0x5C, 0x0F, 0x79, 0x3B, 0xFF, 0xCD,
-    0xB1, 0xBF, 0xD6, 0x43, 0x4D, 0xFA, 0x01, 0xA3, 0x0D, 0x58, 0x53, 0x3C, 0xC3, 0x63, 0xBC, 0x0F,
-    0x34, 0xBA, 0xE2, 0xAC, 0x8D, 0xF1, 0xF5, 0x0A, 0xEE, 0x90, 0xD7, 0x41, 0x93, 0x79, 0x97, 0x18,
-    0xEA, 0x9A, 0x95, 0x6B, 0x24, 0x3C, 0xE6, 0x0F, 0xC0, 0x74, 0x66, 0xB5, 0x1A, 0xA3, 0x4A, 0x7C,
-    0x4E, 0xA0, 0xB7, 0xCD, 0xBD, 0x48, 0x02, 0xBD, 0x5A, 0x63, 0x65, 0x56, 0x6B, 0x7D, 0xBB, 0xD4,
-    0xF6, 0x5C, 0x9A, 0x14, 0xAF, 0x6E, 0x0B, 0x96, 0xEF, 0x84, 0x4F, 0x2D, 0xBD, 0x73, 0x61, 0xFE,
-    0xF8, 0xA6, 0xB8, 0x99, 0xFF, 0xE0, 0x16, 0x5E, 0xE8, 0x28, 0x2C, 0x25, 0xEE, 0x9A, 0xBD, 0x36,
-    0xA6, 0x91, 0x61, 0xF9, 0x18, 0xD7, 0x39, 0xE0, 0xE1, 0x22, 0xF6, 0x6D, 0xBC, 0xE4, 0x5D, 0x76,
-    0xC7, 0xE2, 0x74, 0xF8, 0x71, 0xEB, 0x57, 0xEE, 0x93, 0x30, 0x71, 0x2F, 0xDD, 0x73, 0xDB, 0x17,
-    0xFE, 0xE1, 0xD4, 0xA3, 0xBF, 0x93, 0x1C, 0x76, 0xB5, 0x53, 0xC9, 0xCE, 0x30, 0x28, 0x37, 0xE2,
-    0x57, 0xEA, 0x10, 0x5D, 0x5F, 0x44, 0xFC, 0x05, 0xC5, 0x7C, 0x4D, 0x8F, 0xDD, 0x56, 0x9A, 0xDE,
-    0x21, 0x39, 0x12, 0x01, 0x33, 0x08, 0x7B, 0xD1, 0xEA, 0x4C, 0xAC, 0xA4, 0x99, 0x45, 0x2F, 0x26,
-    0xEA, 0xC1, 0xF0, 0x0F, 0xD8, 0x22, 0x6D, 0xA1, 0x47, 0x41, 0xBC, 0x28, 0x0D, 0xA2, 0xEA, 0x5E,
-    0x78, 0xE1, 0x55, 0x80, 0xB4, 0x80, 0xA0, 0x36, 0xBD, 0xE8, 0x00, 0x65, 0x91, 0xB6, 0x80, 0x78,
-    0xE1, 0x85, 0x6A, 0x91, 0x9E, 0x4D, 0x2F, 0xE4, 0x85, 0x1B, 0x69, 0x97, 0x17, 0x15, 0x20, 0xB3,
-    0x18, 0x24, 0x92, 0x0E, 0xA5, 0x5A, 0x28, 0x48, 0x01, 0x23, 0xDA, 0x1A, 0xC7, 0x41, 0xB4, 0x10,
-    0xED, 0x52, 0xC7, 0xDD, 0xF2, 0xA2, 0x28, 0x89, 0x65, 0xB1, 0x4A, 0x87, 0x3C, 0x79, 0x9E, 0xF7,
-    0xF0, 0x56, 0xDD, 0xAA, 0x2E, 0x7F, 0xB5, 0xDB, 0x99, 0xAA, 0xCB, 0x73, 0x49, 0x5E, 0x5E, 0xF2,
-    0x9C, 0xF7, 0xBC, 0x1F, 0xCF, 0xFB, 0x71, 0x6E, 0x60, 0x94, 0x52, 0x36, 0x57, 0x2A, 0x6B, 0x94,
-    0x8A, 0x79, 0xB0, 0xA8, 0x7E, 0xEF, 0xEF, 0xC4, 0xE2, 0xDB, 0x89, 0xB5, 0x3D, 0xB6, 0x0E, 0x5B,
-    0x9B, 0xE2, 0xD2, 0xB4, 0x9E, 0xDB, 0x76, 0x57, 0x55, 0x6A, 0xAD, 0x6C, 0x19, 0x37, 0x7C, 0x9E,
-    0xD5, 0xD3, 0xF6, 0x9B, 0xC5, 0x73, 0x38, 0xD7, 0x61, 0xEB, 0xA7, 0xCD, 0x70, 0x3B, 0x76, 0xEE,
-    0x44, 0x9E, 0x55, 0x56, 0xD9, 0xB3, 0x26, 0x18, 0x92, 0x36, 0xE9, 0x75, 0xAD, 0x37, 0x6D, 0x79,
-    0xF0, 0xB9, 0xFE, 0xAA, 0xB6, 0xAF, 0xE0, 0xE2, 0xC2, 0xDA, 0x87, 0xD6, 0xAE, 0x9E, 0xED, 0x95,
-    0x4A, 0x70, 0xEF, 0xA2, 0x54, 0xDE, 0xA8, 0x54, 0x34, 0xAE, 0xD5, 0x78, 0x64, 0xAE, 0xED, 0xE0,
-    0xE3, 0x09, 0x11, 0x3A, 0xCF, 0x9E, 0xE9, 0x52, 0x05, 0x76, 0x75, 0x75, 0xC1, 0x5A, 0xCB, 0x07,
-    0xE1, 0xED, 0x09, 0xB6, 0x2D, 0x6C, 0x15, 0xEF, 0xF9, 0x1D, 0x75, 0xD2, 0xDA, 0x51, 0xE1, 0xD0,
-    0xD6, 0xDA, 0xCA, 0xCD, 0x7B, 0x9E, 0x1F, 0xD9, 0x64, 0xEC, 0x40, 0xDC, 0xA2, 0x09, 0x48, 0x0A,
-    0xCF, 0xF2, 0x64, 0x61, 0x07, 0x3C, 0xD7, 0xDA, 0x46, 0x85, 0xFC, 0xA6, 0x67, 0xAB, 0xA2, 0x56,
-    0x45, 0x15, 0xF6, 0xEC, 0x8C, 0x55, 0x78, 0x4F, 0x2B, 0xF4, 0x27, 0x6A, 0xD1, 0x31, 0x39, 0x99,
-    0x8D, 0x2A, 0x34, 0xB1, 0xC5, 0x95, 0x01, 0x28, 0x7B, 0xA1, 0x7C, 0x07, 0x23, 0xC1, 0x3D, 0x63,
-    0x3C, 0xFF, 0x22, 0xEE, 0x8C, 0xDD, 0xA4, 0x3A, 0x44, 0x61, 0x0F, 0x3D, 0xB9, 0x85, 0x2D, 0x61,
-    0x87, 0x3E, 0x58, 0xFC, 0x2B, 0xF4, 0x26, 0xE4, 0x68, 0x71, 0x6D, 0x51, 0x49, 0x3F, 0x64, 0x78,
-    0x38, 0xD4, 0x95, 0xF2, 0xE7, 0x0F, 0x6B, 0x1C, 0xE6, 0x2A, 0x42, 0x17, 0xD3, 0x4E, 0xA9, 0x0B,
-    0x2B, 0xB3, 0x3B, 0xA6, 0xA4, 0x90, 0x05, 0x45, 0x39, 0xF0, 0x68, 0xF4, 0x6C, 0x89, 0x5E, 0xDB,
-    0x17, 0xD1, 0xFF, 0x11, 0x03, 0x0C, 0x0C, 0x88, 0x28, 0x4F, 0xAD, 0x70, 0x91, 0x4C, 0x9D, 0x21,
-    0xE5, 0xDC, 0x90, 0x43, 0x9B, 0x87, 0x96, 0x04, 0x1C, 0x40, 0x41, 0xDB, 0x82, 0xFC, 0xB6, 0xD4,
-    0x72, 0x05, 0x89, 0xF8, 0x43, 0x7B, 0x7F, 0x7A, 0xC6, 0x33, 0xD8, 0x23, 0xE9, 0xF9, 0xF5, 0xCA,
-    0xB3, 0xBB, 0x03, 0xFB, 0xF1, 0x1D, 0x99, 0x77, 0xC5, 0xFB, 0x04, 0x24, 0x6A, 0x44, 0xEE, 0x4A,
-    0xEC, 0x8E, 0x22, 0x6F, 0x94, 0xBC, 0xB4, 0x66, 0xC7, 0x40, 0x81, 0x25, 0x36, 0xF2, 0x71, 0x34,
-    0x06, 0x8D, 0x4A, 0xFB, 0x6C, 0xF8, 0x4B, 0xFB, 0xBE, 0x75, 0x64, 0xB0, 0x5D, 0x41, 0x6A, 0x1F,
-    0xB7, 0x63, 0xEE, 0x1E, 0x66, 0xDF, 0xEC, 0x35, 0x5E, 0x6F, 0xF4, 0xC5, 0xF4, 0x32, 0xC5, 0x2D,
-    0x53, 0x6C, 0x18, 0xBD, 0x61, 0xEC, 0xBD, 0xC1, 0xD6, 0xD9, 0x99, 0xED, 0x21, 0xF9, 0xB0, 0x2F,
-    0xD6, 0x1E, 0x59, 0x5C, 0x37, 0x47, 0xDB, 0xB8, 0x27, 0x5F, 0xE8, 0xD2, 0xC7, 0x1C, 0xC9, 0x9C,
-    0x15, 0x25, 0xA6, 0x2B, 0x9C, 0xED, 0x62, 0x06, 0x0D, 0x09, 0x5D, 0x54, 0xA0, 0x2B, 0xC8, 0x0A,
-    0xAA, 0xDA, 0x1A, 0x13, 0x17, 0x0F, 0xEE, 0xBB, 0x1C, 0x8E, 0x87, 0x4E, 0xE2, 0x2A, 0x99, 0x8F,
-    0xB9, 0x09, 0x20, 0xA3, 0x63, 0x48, 0x01, 0xAE, 0x8C, 0xBB, 0xE9, 0x42, 0x25, 0x17, 0xCE, 0x66,
-    0x6A, 0x9C, 0x6E, 0xD1, 0x9C, 0x3E, 0x6B, 0x5F, 0x00, 0x05, 0x43, 0x8A, 0x0F, 0xE8, 0x8D, 0xE1,
-    0x79, 0x6B, 0xE3, 0xDE, 0xDC, 0x1B, 0x61, 0x33, 0x92, 0x2C, 0x15, 0xCA, 0x84, 0x1D, 0xB9, 0xC4,
-    0x33, 0x4A, 0x3E, 0x50, 0x99, 0x22, 0xCB, 0x90, 0x7F, 0xC2, 0x56, 0x3E, 0xE8, 0x15, 0x49, 0x79,
-    0x1D, 0x14, 0x1D, 0x55, 0x5A, 0xC6, 0x20, 0x69, 0xD4, 0x04, 0x5D, 0x68, 0xFC, 0x5E, 0x0D, 0x4A,
-    0x63, 0xCB, 0xF2, 0xA4, 0xCE, 0xF2, 0xB8, 0x8E, 0xDB, 0xB8, 0x0E, 0x76, 0xD7, 0xCC, 0xC9, 0x0E,
-    0xDF, 0x18, 0x21, 0xDF, 0x98, 0x83, 0xC0, 0xAA, 0xD8, 0xEE, 0x38, 0xDE, 0x9E, 0xFD, 0x65, 0xB9,
-    0x6B, 0xC9, 0xA7, 0x5F, 0xD2, 0x4A, 0x6F, 0xC9, 0x17, 0x63, 0xCE, 0xD6, 0x36, 0x59, 0x19, 0x50,
-    0xB0, 0x73, 0x76, 0x80, 0xAD, 0x3F, 0xB0, 0xF5, 0x86, 0xBD, 0x7D, 0x3C, 0x1F, 0xAD, 0xBB, 0x06,
-    0xE3, 0x67, 0x3B, 0xE6, 0xA7, 0xDC, 0xA4, 0x72, 0xA2, 0x63, 0xB6, 0xF9, 0xDC, 0xEE, 0xF8, 0xAE,
-    0x7D, 0xB7, 0x73, 0xE4, 0x85, 0x2C, 0x4B, 0xCF, 0xDA, 0xC3, 0xBB, 0xBA, 0x97, 0x5E, 0x80, 0x95,
-    0xF9, 0x0D, 0x95, 0x0D, 0x20, 0x3B, 0x2E, 0x80, 0x64, 0xE1, 0x02, 0xA3, 0xC2, 0x51, 0xC5, 0x90,
-    0xD2, 0x06, 0xB4, 0xC0, 0x2E, 0x67, 0xBA, 0xE1, 0xA4, 0x5B, 0xD9, 0x6D, 0x31, 0x81, 0xD8, 0xE5,
-    0x24, 0xBD, 0xAA, 0x9C, 0x44, 0xAA, 0x84, 0xA2, 0xCF, 0x29, 0x0F, 0xDB, 0x79, 0x0D, 0x34, 0x90,
-    0x5A, 0x5D, 0xDA, 0x2B, 0x28, 0xAB, 0x4A, 0x59, 0xF0, 0x37, 0x44, 0xA7, 0x51, 0xC9, 0x63, 0xF4,
-    0xA5, 0xB8, 0xD2, 0x43, 0x9A, 0x70, 0x3A, 0xA2, 0x86, 0x48, 0x2D, 0xB9, 0xC1, 0xB2, 0x6F, 0xE8,
-    0x7B, 0xCC, 0xA3, 0x0C, 0x8D, 0xC7, 0x3E, 0x72, 0xDA, 0xF9, 0x9D, 0x56, 0xE9, 0x5B, 0xB6, 0xF3,
-    0x6D, 0x88, 0x91, 0x9A, 0x08, 0x04, 0x69, 0xD1, 0x50, 0xD0, 0x85, 0xB3, 0x14, 0x24, 0x14, 0xD7,
-    0x97, 0x47, 0x2B, 0xE1, 0x39, 0x86, 0x6E, 0x45, 0xBE, 0x7C, 0x8B, 0x9D, 0xAC, 0xB3, 0x79, 0x64,
-    0x5F, 0xC2, 0xF4, 0x76, 0x3A, 0x4F, 0xEC, 0x9B, 0x5D, 0x60, 0x7B, 0x5D, 0x16, 0xF6, 0x8D, 0x3E,
-    0x86, 0x26, 0x79, 0x6D, 0xB4, 0xB7, 0x4C, 0x76, 0x8F, 0x92, 0x82, 0x1D, 0xBB, 0x80, 0xFD, 0xD6,
-    0xAE, 0x83, 0x11, 0x20, 0xD8, 0x95, 0xBD, 0x63, 0x7B, 0xEE, 0xE4, 0x76, 0xD3, 0xB6, 0xC9, 0x98,
-    0x0D, 0x1E, 0x76, 0xAA, 0xC4, 0x2A, 0x03, 0xC6, 0xCB, 0x9E, 0x82, 0x80, 0x1C, 0x0D, 0x89, 0x1B,
-    0x8D, 0x47, 0x77, 0xC4, 0x07, 0x9D, 0xDB, 0xA2, 0x0C, 0x0C, 0x3A, 0x32, 0x82, 0xA6, 0x3A, 0xCF,
-    0xEA, 0xAC, 0x8A, 0x4C, 0x0C, 0xBD, 0xF8, 0x06, 0xB4, 0xC2, 0x63, 0x4E, 0x09, 0xBE, 0xAB, 0x71,
-    0x8F, 0xD8, 0x52, 0x6E, 0x48, 0x94, 0xCE, 0x09, 0x0F, 0x55, 0xB8, 0x58, 0x1E, 0x7C, 0x40, 0x42,
-    0xC5, 0x32, 0x97, 0xF8, 0x90, 0x17, 0x9D, 0x98, 0x9E, 0xA0, 0x73, 0x6F, 0xFC, 0x83, 0x37, 0xB0,
-    0xE8, 0x6C, 0x83, 0x70, 0x41, 0x39, 0xE1, 0xC6, 0xF3, 0xDB, 0xB1, 0x73, 0x64, 0xA7, 0x6A, 0xA6,
-    0xA8, 0x94, 0x26, 0x5D, 0x63, 0x76, 0xC9, 0x13, 0x9B, 0x90, 0x6D, 0xE1, 0xB3, 0x60, 0x87, 0x9F,
-    0xE9, 0x05, 0x2A, 0xF0, 0x56, 0xE7, 0xE8, 0x76, 0x28, 0x3A, 0x01, 0xDF, 0x0B, 0x0C, 0xBF, 0xA7,
-    0x2B, 0xCC, 0x5D, 0x3C, 0xAE, 0xDA, 0x9C, 0xEA, 0xB4, 0x17, 0xD1, 0xA8, 0xC8, 0x94, 0x23, 0xD5,
-    0xA5, 0x6D, 0x63, 0x12, 0xE1, 0x05, 0x0C, 0x12, 0xFA, 0xAD, 0xA3, 0xF5, 0x38, 0xB5, 0xBA, 0x7A,
-    0xC9, 0x59, 0x42, 0x1A, 0x19, 0xB9, 0x8F, 0xBC, 0xF9, 0xD0, 0x91, 0xA9, 0xB3, 0x65, 0x69, 0x95,
-    0xDE, 0x84, 0xF0, 0xA7, 0x55, 0xF4, 0x9E, 0x51, 0x43, 0xF2, 0x40, 0xDF, 0x80, 0xD4, 0x41, 0x29,
-    0x42, 0x85, 0x34, 0xF1, 0xB8, 0x32, 0x89, 0xCE, 0x0A, 0xA5, 0x29, 0xAE, 0xA2, 0x36, 0x83, 0x6D,
-    0x81, 0xE2, 0x0A, 0x5A, 0xCF, 0x50, 0x17, 0x64, 0x96, 0xFA, 0xA1, 0x0B, 0xB6, 0x5F, 0x36, 0x71,
-    0xE5, 0xF7, 0x19, 0x18, 0xDC, 0xA8, 0x78, 0x1D, 0x7A, 0x2D, 0x76, 0xD6, 0xB7, 0xB5, 0xD4, 0x02,
-    0xA4, 0xB3, 0xA8, 0x9D, 0x87, 0x33, 0xE3, 0xB3, 0xBD, 0x78, 0x7E, 0xB2, 0xAD, 0x33, 0x65, 0x57,
-    0x1C, 0xB2, 0x36, 0x73, 0x87, 0xDD, 0x01, 0xE3, 0xF3, 0xEC, 0xDB, 0xB8, 0x17, 0x46, 0xE6, 0xB4,
-    0x99, 0xE3, 0x77, 0xAA, 0x32, 0x8D, 0x7F, 0xDF, 0x80, 0x51, 0xA2, 0x36, 0x02, 0x47, 0x54, 0xC0,
-    0x0B, 0x38, 0x95, 0x07, 0xC6, 0x1F, 0x40, 0x4F, 0x9C, 0xCA, 0x78, 0x0A, 0xAC, 0x03, 0x2E, 0x82,
-    0xB6, 0xCC, 0x9A, 0xA8, 0xC7, 0x13, 0xD2, 0x86, 0xA4, 0xDB, 0xA1, 0x32, 0xB8, 0xC3, 0x86, 0x6A,
-    0xC1, 0x40, 0xBD, 0x26, 0x9C, 0x01, 0x5D, 0x2E, 0x2A, 0xEF, 0xFC, 0xB7, 0x82, 0x4A, 0x30, 0x1A,
-    0xCA, 0x04, 0x26, 0x2C, 0xB0, 0x0D, 0xC4, 0x3C, 0x1A, 0x63, 0x7B, 0xC6, 0x12, 0x18, 0xA5, 0x43,
-    0x4A, 0x7B, 0xDC, 0xEB, 0x96, 0xFA, 0x39, 0xDD, 0xB6, 0x1B, 0xD4, 0x15, 0xD9, 0x13, 0x2B, 0x4A,
-    0xAA, 0xD8, 0x12, 0xE5, 0x4D, 0x75, 0xD6, 0x4D, 0xEF, 0x64, 0x2B, 0xDF, 0x69, 0x76, 0x35, 0xA3,
-    0x75, 0x6C, 0x45, 0xB8, 0xBD, 0xE9, 0xE3, 0xC4, 0xBD, 0xFB, 0xD6, 0xBD, 0xA7, 0x82, 0x49, 0xC8,
-    0x06, 0xF6, 0x36, 0xDE, 0x33, 0xBB, 0x01, 0x3B, 0xD8, 0x04, 0xD6, 0xA4, 0x98, 0xFA, 0x06, 0x02,
-    0xAB, 0xBB, 0xD4, 0xB6, 0xC7, 0xF5, 0x0A, 0xA8, 0x4B, 0xAD, 0x72, 0x02, 0x24, 0x24, 0x62, 0x81,
-    0x9E, 0x03, 0x71, 0xA9, 0x56, 0x5A, 0x91, 0x34, 0x00, 0x11, 0xA2, 0x99, 0xEC, 0x7F, 0x40, 0xE3,
-    0xFC, 0x6E, 0xA9, 0x07, 0x23, 0x66, 0x42, 0x41, 0xA5, 0x77, 0xC4, 0x2A, 0x43, 0x58, 0xD3, 0xD6,
-    0xA2, 0x53, 0x0B, 0x9D, 0xD2, 0xD0, 0x1A, 0x31, 0xD4, 0x07, 0x18, 0x1E, 0xC2, 0x0B, 0x13, 0x1B,
-    0xDA, 0xBE, 0x28, 0xC1, 0x0E, 0x7D, 0xB2, 0x65, 0x8A, 0xF5, 0x01, 0x5A, 0xA3, 0xB8, 0x8D, 0x57,
-    0x67, 0xB1, 0x1F, 0x83, 0x46, 0x0D, 0x26, 0xC4, 0x50, 0x6B, 0x94, 0xD8, 0xE9, 0x62, 0xDC, 0x9A,
-    0x5A, 0xA3, 0x86, 0xFA, 0x30, 0x1E, 0x99, 0x11, 0x46, 0xCA, 0x6E, 0xF5, 0x1C, 0x69, 0x2E, 0x52,
-    0xAD, 0x74, 0xF3, 0x0F, 0xA8, 0xCA, 0xA2, 0x8E, 0x26, 0xAF, 0x46, 0x1F, 0x68, 0xF5, 0x02, 0x03,
-    0xA6, 0x8D, 0x1F, 0x62, 0x0E, 0x30, 0x26, 0xB0, 0x39, 0x26, 0x38, 0x7C, 0x6A, 0x49, 0x78, 0xF2,
-    0x32, 0x0D, 0x39, 0xA7, 0x2B, 0xB6, 0x64, 0x10, 0x4E, 0x14, 0x67, 0x2B, 0xE4, 0xD4, 0x08, 0x27,
-    0x17, 0xB7, 0x2D, 0x10, 0x42, 0x02, 0x53, 0x8B, 0xE9, 0xA8, 0x33, 0x98, 0xF1, 0xC6, 0x56, 0x54,
-    0xFA, 0x56, 0xEC, 0xF9, 0xB4, 0x7D, 0x8A, 0x2D, 0x9F, 0xDB, 0xBC, 0x03, 0xDB, 0xDE, 0x3F, 0xF0,
-    0x98, 0x0F, 0x8D, 0xC9, 0x2D, 0xC4, 0x96, 0x42, 0xEA, 0x33, 0x70, 0x5F, 0xD6, 0xF8, 0x0E, 0x72,
-    0xC2, 0xC2, 0x6C, 0xD3, 0xDE, 0x7C, 0x68, 0x61, 0x5C, 0x5F, 0x01, 0x13, 0x8F, 0xC5, 0xA0, 0xC0,
-    0x18, 0x30, 0x1A, 0x9F, 0xC0, 0x82, 0xDA, 0x2B, 0xF6, 0x23, 0x28, 0x35, 0x7D, 0xFB, 0xE9, 0xCE,
-    0x68, 0xF5, 0xBD, 0x4F, 0x77, 0x71, 0xB0, 0xB6, 0x69, 0xB7, 0x47, 0x7D, 0xD9, 0xDE, 0xDA, 0x1D,
-    0x93, 0x31, 0xF9, 0x14, 0xCA, 0x46, 0xAF, 0x35, 0xF6, 0xA6, 0xD5, 0xAF, 0xBD, 0x13, 0x8D, 0xE0,
-    0x87, 0xF4, 0x29, 0x06, 0xA7, 0xFF, 0xCF, 0x8A, 0xF2, 0xDE, 0x81, 0x54, 0x67, 0xEF, 0x51, 0xB7,
-    0x9F, 0x85, 0x6E, 0x1A, 0xA8, 0xBE, 0x3A, 0x9E, 0xFA, 0x98, 0xA7, 0xDE, 0xC4, 0xA9, 0x11, 0xB2,
-    0x1E, 0xF7, 0x5A, 0x4E, 0xE5, 0x38, 0x05, 0x1B, 0x6A, 0xD3, 0x9D, 0xC5, 0x25, 0x43, 0xA9, 0x7C,
-    0x44, 0x36, 0xBD, 0x6D, 0x1D, 0xBC, 0x16, 0x7C, 0x6D, 0x1F, 0xDB, 0xD2, 0xB7, 0xB7, 0x01, 0xAF,
-    0x6C, 0x06, 0xAC, 0x65, 0x40, 0x13, 0xA8, 0xD2, 0xE3, 0x76, 0x45, 0x58, 0xBC, 0x64, 0x03, 0x84,
-    0x65, 0x7F, 0x69, 0x2B, 0x88, 0x56, 0xDA, 0x47, 0x54, 0x88, 0xD4, 0x9C, 0xC5, 0x7B, 0x22, 0x5A,
-    0x9A, 0x00, 0x97, 0x62, 0x54, 0xDC, 0x86, 0x88, 0xC5, 0x8F, 0xC1, 0xD5, 0xC1, 0x20, 0xF4, 0x2F,
-    0xE4, 0x24, 0x95, 0xCD, 0x23, 0xDE, 0xC6, 0xE8, 0xF1, 0xAF, 0x0A, 0xC1, 0x86, 0xF6, 0x92, 0xC8,
-    0x0A, 0x81, 0x69, 0x4B, 0xFC, 0xDA, 0x52, 0x8D, 0xB5, 0xCA, 0xD3, 0x76, 0x65, 0xDF, 0x38, 0xE1,
-    0xFC, 0x5D, 0x6C, 0x4B, 0x50, 0xFD, 0xFA, 0x17, 0x2F, 0x7F, 0x36, 0xA8, 0xE4, 0x6E, 0xA7, 0x8A,
-    0xA5, 0xDA, 0x1B, 0x74, 0x1E, 0x4E, 0x87, 0x7A, 0xA9, 0xF1, 0x07, 0x5D, 0x46, 0xBB, 0xC0, 0x51,
-    0x9F, 0xF6, 0x0A, 0x14, 0xF3, 0xC7, 0x43, 0x87, 0x17, 0xF2, 0xE3, 0x6F, 0x3B, 0x99, 0x86, 0x2C,
-    0x0A, 0x42, 0xE9, 0x32, 0xA8, 0x7C, 0xC0, 0x82, 0x3B, 0xE0, 0xAD, 0xCB, 0x2D, 0xFA, 0xFE, 0xC1,
-    0x1A, 0xA4, 0x0C, 0x73, 0x25, 0xC0, 0x95, 0x70, 0x19, 0xE2, 0xB9, 0x72, 0x08, 0xA1, 0x13, 0x4E,
-    0x66, 0xCE, 0xBA, 0x05, 0xFB, 0x7E, 0xCE, 0x71, 0xE8, 0xFC, 0xD0, 0xDD, 0x79, 0x10, 0xAD, 0x91,
-    0xDA, 0x5D, 0x13, 0x90, 0x03, 0x69, 0x8C, 0xE8, 0x8F, 0x09, 0x1E, 0xA0, 0xEE, 0x09, 0xC4, 0x4B,
-    0xEB, 0x66, 0x3B, 0x86, 0x3B, 0x54, 0x73, 0x76, 0xE5, 0x7B, 0x37, 0x38, 0x11, 0xD4, 0x91, 0x55,
-    0x21, 0x4A, 0xCC, 0xA1, 0x7A, 0x43, 0x4F, 0xA7, 0x5A, 0xC4, 0xDF, 0xBF, 0x21, 0xB5, 0xEE, 0xB1,
-    0x21, 0xC5, 0x06, 0x41, 0x5A, 0x82, 0x58, 0x27, 0xA8, 0x9E, 0x2B, 0xC1, 0xB0, 0x87, 0x4F, 0x8D,
-    0x13, 0x00, 0x16, 0xD5, 0x29, 0xFD, 0x08, 0x79, 0x2A, 0xE9, 0x1D, 0x87, 0xD2, 0x96, 0xD1, 0x57,
-    0xE0, 0x29, 0x67, 0xC1, 0x74, 0x28, 0x38, 0x49, 0xC5, 0x4D, 0x02, 0xD5, 0x1E, 0x0C, 0x30, 0x6C,
-    0x45, 0x05, 0x1C, 0xD1, 0x17, 0x39, 0x78, 0xDB, 0x99, 0xF9, 0x48, 0x4C, 0xBC, 0x71, 0x0E, 0x8A,
-    0x0C, 0x05, 0xF3, 0x2F, 0x6E, 0x1D, 0x9F, 0x1E, 0x4F, 0x88, 0x81, 0xEA, 0x34, 0x23, 0xD5, 0xB0,
-    0xEF, 0x9D, 0x9B, 0x51, 0x2B, 0x9C, 0x7C, 0x90, 0x21, 0x6C, 0x8A, 0x1B, 0x26, 0x85, 0x4C, 0x75,
-    0xC0, 0x9C, 0xC1, 0x26, 0x1E, 0x97, 0x5C, 0xC6, 0xA9, 0x91, 0x2A, 0xB4, 0xCB, 0x66, 0x84, 0x20,
-    0x53, 0xAC, 0x88, 0xC1, 0x12, 0x8B, 0x25, 0xB3, 0x21, 0x4F, 0x93, 0x53, 0x82, 0xEF, 0x49, 0x4F,
-    0x18, 0x0E, 0xB8, 0x6B, 0xD0, 0x59, 0x5D, 0x08, 0xE0, 0x8C, 0xA9, 0xE0, 0x35, 0x10, 0x1C, 0x58,
-    0x9A, 0x4F, 0xA8, 0x47, 0x9D, 0x52, 0x20, 0x6A, 0xA1, 0x3E, 0x0B, 0x38, 0xE8, 0xC0, 0x79, 0x2E,
-    0xED, 0xF4, 0x81, 0x5C, 0xA2, 0xC5, 0x37, 0xBC, 0x6B, 0x81, 0x6E, 0xD7, 0x49, 0xFF, 0x17, 0x6C,
-    0x93, 0xC0, 0xCF, 0xEC, 0x30, 0x53, 0x85, 0x01, 0x5A, 0x4D, 0xC7, 0x53, 0xEA, 0xF8, 0x4A, 0x01,
-    0x75, 0x8D, 0xAD, 0x99, 0x6D, 0x7A, 0x7E, 0xCB, 0x7F, 0x6F, 0x6B, 0xF7, 0xB7, 0xA4, 0x9B, 0xC0,
-    0xCC, 0x30, 0x6D, 0x46, 0x00, 0x98, 0xA0, 0x07, 0x9A, 0xEB, 0xE3, 0x6F, 0x1F, 0x53, 0xDE, 0x0B,
-    0xBD, 0xBA, 0x96, 0xE6, 0xD1, 0xFB, 0xAD, 0x1A, 0x52, 0x30, 0x28, 0x60, 0xD9, 0x69, 0x15, 0x6F,
-    0x36, 0x6A, 0xCC, 0x54, 0xBA, 0xD9, 0x87, 0xB4, 0x04, 0x1F, 0xE1, 0x2E, 0x91, 0x7D, 0xDA, 0x9C,
-    0xEC, 0x2F, 0x3A, 0xB0, 0x5B, 0x28, 0x31, 0x19, 0x9A, 0x6F, 0xC0, 0x9D, 0xC7, 0x5E, 0xEE, 0x92,
-    0xDA, 0xEA, 0x17, 0xC6, 0xF8, 0x69, 0x97, 0x34, 0xB3, 0x1D, 0x9E, 0x19, 0x0E, 0xEE, 0x68, 0x9D,
-    0x0F, 0xD1, 0xD3, 0x2E, 0x3E, 0x72, 0x07, 0x73, 0xF0, 0x94, 0x7C, 0xB6, 0xB7, 0xE3, 0x9C, 0xD2,
-    0xFA, 0xC2, 0x19, 0x13, 0xF1, 0xB6, 0xFE, 0x10, 0xF6, 0x59, 0xC5, 0x9B, 0xB7, 0x69, 0x5D, 0xC8,
-    0xC9, 0x9A, 0x27, 0x21, 0x5B, 0xDA, 0x1B, 0x70, 0xB2, 0xE2, 0x49, 0x78, 0x2F, 0xDA, 0x37, 0x01,
-    0xF0, 0x10, 0x9C, 0x9A, 0x08, 0x27, 0xB3, 0x17, 0x0F, 0x9C, 0x24, 0xCA, 0x12, 0xB3, 0xB9, 0x61,
-    0x67, 0x9A, 0xC9, 0x9C, 0x58, 0x5C, 0xFC, 0xB1, 0x83, 0x73, 0xF9, 0x8C, 0x9B, 0xE3, 0x09, 0xD2,
-    0x67, 0x14, 0x18, 0x5A, 0xA6, 0x80, 0x80, 0x5D, 0xF9, 0x64, 0xF7, 0x88, 0x17, 0xA4, 0xBC, 0xF4,
-    0x9A, 0x28, 0x0D, 0xB8, 0x9B, 0xE2, 0x9D, 0xA6, 0xE2, 0x61, 0x81, 0xC5, 0xFC, 0xDE, 0x23, 0x74,
-    0x0C, 0x30, 0x83, 0x25, 0xD1, 0xCB, 0xBB, 0x36, 0x17, 0xBB, 0x2E, 0x57, 0x65, 0x93, 0x2F, 0x2C,
-    0xE2, 0xE3, 0xC4, 0x06, 0x8F, 0x79, 0x5F, 0x80, 0x64, 0x77, 0x55, 0x3E, 0x90, 0x7B, 0xDB, 0x97,
-    0x6A, 0xF9, 0xA0, 0x93, 0x0F, 0xAE, 0xCD, 0x7F, 0x20, 0x9E, 0xF1, 0xFB, 0x54, 0x5F, 0x71, 0x47,
-    0x1E, 0xC2, 0x07, 0x25, 0xB4, 0xB1, 0x7D, 0xB3, 0x09, 0x81, 0x8E, 0x3E, 0xEE, 0x15, 0x05, 0xE8,
-    0x3A, 0x31, 0x93, 0x4D, 0x1F, 0x60, 0x00, 0x1C, 0x2B, 0x8C, 0xE5, 0x23, 0xF9, 0x86, 0x21, 0x87,
-    0x8B, 0x08, 0xAA, 0x14, 0x63, 0xA9, 0x64, 0x4C, 0xD7, 0x64, 0x40, 0x18, 0x98, 0x2F, 0x76, 0x6D,
-    0x05, 0x43, 0x41, 0x67, 0x3F, 0xEE, 0x43, 0x73, 0x1D, 0xFA, 0xAF, 0x8C, 0x3F, 0x6D, 0xA2, 0xCF,
-    0xC6, 0x35, 0xB2, 0x50, 0x4A, 0x60, 0xB0, 0x73, 0x44, 0xC4, 0xA0, 0x8C, 0x61, 0x91, 0xF2, 0x02,
-    0x4E, 0x3D, 0xD8, 0xCB, 0x1F, 0x01, 0xE8, 0x25, 0x20, 0x02, 0x42, 0x52, 0xEF, 0x8A, 0xCB, 0x15,
-    0x5B, 0xBB, 0xAF, 0x33, 0xEE, 0xD2, 0x74, 0x27, 0xD6, 0xC1, 0x28, 0x18, 0xC6, 0xC9, 0xA1, 0xEB,
-    0x09, 0x75, 0x4A, 0x38, 0xFA, 0x93, 0x5A, 0x3E, 0x41, 0x57, 0x22, 0x86, 0x92, 0x83, 0x7F, 0x8B,
-    0xAB, 0x73, 0x13, 0x8F, 0xBA, 0xCD, 0x00, 0xF9, 0x4C, 0xBC, 0x0E, 0x65, 0x7A, 0xA9, 0x25, 0xA5,
-    0xC1, 0x2B, 0x1E, 0x6E, 0x03, 0x8B, 0x4B, 0x97, 0x20, 0x5E, 0x27, 0x9E, 0x04, 0x62, 0xCD, 0x71,
-    0x32, 0x21, 0x86, 0x5D, 0x07, 0xB0, 0xBE, 0x44, 0x08, 0x5B, 0x1B, 0xF4, 0xBF, 0x3D, 0x2D, 0x5A,
-    0xB9, 0xCC, 0x70, 0xCF, 0xC6, 0x23, 0xDA, 0x88, 0xF0, 0x85, 0x09, 0xF8, 0x55, 0x71, 0x1D, 0xB6,
-    0x21, 0x60, 0x31, 0x04, 0xA5, 0x50, 0xF4, 0x0E, 0xD3, 0x2A, 0xEC, 0x22, 0xCE, 0x28, 0x7B, 0x98,
-    0xB8, 0xB1, 0x00, 0x71, 0x5A, 0x18, 0xE4, 0xB3, 0xB6, 0x04, 0xDC, 0x68, 0xB2, 0x3A, 0x31, 0x49,
-    0x17, 0xDA, 0x18, 0xA7, 0xD6, 0x71, 0xEA, 0xA1, 0x6D, 0x52, 0xC8, 0x6F, 0xB4, 0xEF, 0x2F, 0x7B,
-    0x23, 0xB1, 0x0D, 0xF5, 0x2C, 0x58, 0xB1, 0xA8, 0x2E, 0x2A, 0x7D, 0x06, 0xF2, 0x16, 0x57, 0x41,
-    0x0F, 0x61, 0x6B, 0x80, 0x72, 0xD7, 0xC1, 0x26, 0x31, 0x00, 0x6D, 0xF6, 0xC0, 0xB6, 0x0C, 0x99,
-    0x58, 0x41, 0xEE, 0xF0, 0xCC, 0x85, 0x0C, 0x7F, 0x82, 0xED, 0xCF, 0x20, 0xAF, 0x2D, 0xF4, 0x73,
-    0x03, 0x02, 0x55, 0xC4, 0x18, 0x70, 0x20, 0x24, 0x7A, 0x45, 0x77, 0xA4, 0xF8, 0x8F, 0x6F, 0x53,
-    0xCB, 0xE5, 0xD8, 0x88, 0x83, 0x3B, 0xE0, 0x3E, 0x18, 0xC9, 0xD8, 0x14, 0x55, 0x28, 0x5B, 0x56,
-    0x03, 0x89, 0x8D, 0x9A, 0xC8, 0x97, 0xD6, 0xAF, 0xF6, 0xC8, 0xD2, 0x30, 0x11, 0x12, 0xD6, 0xAA,
-    0x87, 0x7F, 0xD2, 0x1A, 0xAF, 0x33, 0xAA, 0x33, 0x7E, 0x2B, 0x53, 0xD1, 0x8E, 0xEF, 0x1A, 0xA3,
-    0xAE, 0xE3, 0x65, 0xD7, 0x46, 0x8C, 0x54, 0x8C, 0x36, 0x6D, 0xE7, 0x92, 0x18, 0xC8, 0xDD, 0x51,
-    0x62, 0x66, 0x78, 0x78, 0xD4, 0x8B, 0x66, 0x84, 0xF6, 0x83, 0xA6, 0x84, 0xC6, 0x9C, 0x3B, 0x18,
-    0x66, 0x02, 0x04, 0xBB, 0x61, 0x89, 0x8F, 0xF1, 0xC4, 0x01, 0xD2, 0x50, 0x00, 0xC1, 0x27, 0x37,
-    0x31, 0x6B, 0xAD, 0x2E, 0x7D, 0x83, 0x7B, 0x58, 0x98, 0x00, 0x60, 0x35, 0xC8, 0x5D, 0x51, 0xA6,
-    0x6D, 0x22, 0x9C, 0xC0, 0xD8, 0xDB, 0x26, 0x35, 0x33, 0xF9, 0x23, 0x05, 0x6B, 0x43, 0xEB, 0x64,
-    0xCE, 0x04, 0xA6, 0xF7, 0xC1, 0xBD, 0x98, 0xF9, 0x4F, 0x4D, 0xD0, 0xFB, 0x5D, 0xF2, 0xDE, 0x4F,
-    0x48, 0xAF, 0x75, 0x5C, 0xB7, 0xC0, 0xE0, 0xD3, 0xAF, 0x72, 0x02, 0x59, 0xCA, 0x56, 0x64, 0xCF,
-    0xFD, 0xFB, 0xD8, 0x01, 0xFD, 0x1A, 0x9B, 0x7A, 0x06, 0x1C, 0xB5, 0x9A, 0xAF, 0xBE, 0x75, 0xEA,
-    0x2D, 0x74, 0x2F, 0xEB, 0x61, 0x92, 0x02, 0x4C, 0x18, 0xED, 0x65, 0xF1, 0xBE, 0x7D, 0xC9, 0x50,
-    0xE1, 0x17, 0x1F, 0xB2, 0xD3, 0xF6, 0xCA, 0x63, 0x31, 0x50, 0x4F, 0x47, 0x3B, 0x61, 0x02, 0xD1,
-    0x0A, 0x0E, 0x88, 0x87, 0x53, 0x4C, 0x70, 0x82, 0xE7, 0x74, 0xD9, 0x1C, 0x3A, 0x6F, 0xDD, 0x1B,
-    0xAE, 0x15, 0x70, 0xCE, 0xBB, 0x3F, 0x81, 0x01, 0x2D, 0xE1, 0xB7, 0x43, 0xCB, 0x00, 0x84, 0x41,
-    0xAB, 0xA7, 0xB6, 0x3E, 0x09, 0x64, 0x7A, 0x43, 0xFD, 0x8D, 0xFA, 0xBE, 0x4A, 0x5E, 0x04, 0xA7,
-    0xB4, 0xEA, 0xA2, 0x8A, 0xFE, 0xEE, 0xE5, 0xC7, 0xC0, 0x69, 0x43, 0xBA, 0xA3, 0xAE, 0xAB, 0xF8,
-    0x91, 0x81, 0xB8, 0xB6, 0x00, 0x4F, 0x55, 0x66, 0x74, 0x60, 0x1F, 0x01, 0x39, 0x6E, 0xB4, 0xB6,
-    0x48, 0x37, 0xB6, 0x8D, 0x2E, 0x6E, 0xE1, 0x4E, 0xC9, 0x5D, 0x4C, 0xF1, 0x12, 0x14, 0x9F, 0xEE,
-    0xA2, 0xCF, 0x6C, 0x99, 0xDE, 0x35, 0x4E, 0x6D, 0x51, 0x41, 0x74, 0x21, 0x80, 0x9E, 0x45, 0x07,
-    0xEA, 0x18, 0x3D, 0x38, 0xD9, 0x1F, 0x82, 0xCE, 0x49, 0x7E, 0xCC, 0xEB, 0x82, 0x2E, 0xCE, 0x75,
-    0xDE, 0xC7, 0x7D, 0xFC, 0xBA, 0x2D, 0xFB, 0xAC, 0x8F, 0xDF, 0xD8, 0xAA, 0xCC, 0x60, 0xE2, 0x7B,
-    0xAF, 0x54, 0x78, 0x5A, 0x3C, 0x42, 0x47, 0xDE, 0x34, 0x51, 0x9F, 0xD6, 0xFA, 0xC5, 0x21, 0xBE,
-    0x31, 0x42, 0xA4, 0x5A, 0xAF, 0xD7, 0x2A, 0xFA, 0x04, 0xDA, 0x8C, 0x56, 0xCE, 0x08, 0x88, 0xA0,
-    0x95, 0x85, 0x99, 0xF2, 0x2C, 0x81, 0x1E, 0xA0, 0x0F, 0xA0, 0x9C, 0x8E, 0x21, 0xF9, 0x31, 0x8D,
-    0x99, 0xE1, 0x0B, 0xA0, 0xA4, 0xBD, 0xBA, 0xFF, 0x6A, 0x0C, 0x5E, 0xA1, 0xBC, 0xA2, 0x1A, 0xFC,
-    0x68, 0xB2, 0xF2, 0xD7, 0xE8, 0xD2, 0xB1, 0x5C, 0x9D, 0x07, 0x13, 0x15, 0x2F, 0x5A, 0x82, 0xEE,
-    0x3A, 0xE9, 0x53, 0x13, 0xC1, 0xD6, 0x04, 0xF6, 0x75, 0x58, 0x9D, 0x66, 0x34, 0x70, 0xB4, 0x0A,
-    0x7D, 0x3D, 0xBE, 0x67, 0xD7, 0xD6, 0xB7, 0xED, 0xDD, 0x76, 0xC8, 0x1E, 0x9B, 0xEC, 0xB2, 0xB1,
-    0xF1, 0x47, 0x63, 0xB6, 0xDE, 0x67, 0x71, 0x6B, 0xBD, 0x33, 0x12, 0x76, 0x85, 0xFC, 0xDE, 0x82,
-    0x2F, 0x93, 0x54, 0xBE, 0x29, 0x54, 0xF4, 0x10, 0x87, 0x1B, 0x80, 0x6A, 0x69, 0x1D, 0x18, 0x98,
-    0xC2, 0x47, 0xF3, 0xB8, 0xCE, 0xDA, 0xCF, 0xC0, 0x6B, 0xF7, 0x7A, 0x62, 0x45, 0xE0, 0x15, 0xE0,
-    0xFB, 0x48, 0x20, 0x82, 0x09, 0x06, 0x8E, 0x1A, 0xB7, 0x54, 0xC9, 0x1D, 0x80, 0x92, 0xCB, 0x34,
-    0x81, 0x65, 0xD0, 0xF3, 0x10, 0x72, 0xFD, 0x92, 0xC3, 0x4B, 0x8D, 0x53, 0x13, 0x10, 0xC4, 0x81,
-    0x02, 0xF7, 0x68, 0x32, 0x24, 0xB3, 0x07, 0x01, 0x0D, 0xE0, 0xB9, 0x9F, 0x77, 0x88, 0xE7, 0x6E,
-    0xF4, 0xCA, 0xCE, 0x14, 0x9B, 0x37, 0x40, 0x36, 0x20, 0x54, 0x25, 0x80, 0x2E, 0x3C, 0x97, 0x3C,
-    0x53, 0x00, 0x01, 0x55, 0xD6, 0x78, 0x1D, 0xA0, 0xC5, 0xAB, 0xE8, 0x5B, 0x52, 0x42, 0xD2, 0xEB,
-    0xAC, 0x0F, 0x09, 0x21, 0x19, 0x08, 0x1C, 0x7D, 0xE7, 0x35, 0xE0, 0x46, 0x37, 0xDE, 0x11, 0x1B,
-    0x45, 0x33, 0x2E, 0xD8, 0x84, 0xDC, 0x99, 0x4D, 0x90, 0x68, 0xEF, 0x0F, 0xAA, 0x33, 0x25, 0xF7,
-    0x77, 0xF1, 0xF6, 0x9F, 0x46, 0xAD, 0x28, 0xE4, 0xD1, 0x39, 0x80, 0xEE, 0x80, 0x10, 0x79, 0xFC,
-    0x5B, 0x88, 0x26, 0x75, 0xA1, 0xA7, 0xEF, 0x6B, 0x91, 0x75, 0xB1, 0xBE, 0x1F, 0x04, 0xDD, 0x31,
-    0x95, 0xC0, 0x04, 0x15, 0x39, 0x3A, 0x3A, 0xC5, 0x96, 0x5D, 0xAC, 0x9C, 0x21, 0x4A, 0xCC, 0x99,
-    0x0B, 0x9D, 0x3B, 0xF7, 0x5E, 0x1D, 0x00, 0x73, 0x49, 0x0D, 0x30, 0xD7, 0xCE, 0x81, 0x39, 0x4D,
-    0xB8, 0xEE, 0xC0, 0x5C, 0x48, 0x49, 0x21, 0x10, 0x49, 0xC6, 0x29, 0x3C, 0x37, 0x07, 0xE6, 0x8E,
-    0x2D, 0x19, 0x67, 0x68, 0x1D, 0x98, 0xC3, 0x39, 0x67, 0x69, 0x96, 0xC9, 0x29, 0xE3, 0x2F, 0x44,
-    0xB4, 0x6A, 0x89, 0xF4, 0x66, 0xF5, 0x00, 0xCD, 0xA6, 0x06, 0x6F, 0xB8, 0xAE, 0x06, 0x35, 0x8C,
-    0x68, 0x46, 0x69, 0x60, 0xF5, 0x19, 0xCB, 0x19, 0x82, 0x21, 0xFB, 0xCD, 0xF8, 0x8A, 0x11, 0x78,
-    0x47, 0xBC, 0x0F, 0x45, 0x2F, 0xB2, 0x2A, 0x6A, 0x69, 0xD8, 0x0B, 0xDF, 0xEF, 0x37, 0xCE, 0x56,
-    0x31, 0xD2, 0x90, 0x60, 0xBA, 0xD0, 0x75, 0x72, 0x02, 0xD1, 0xFE, 0xCC, 0xC7, 0x53, 0xCE, 0x33,
-    0x8D, 0xA5, 0xDF, 0x3D, 0xCD, 0x64, 0xAD, 0xD2, 0xCF, 0x18, 0xF7, 0x86, 0x12, 0x01, 0x7C, 0x6C,
-    0x33, 0xF8, 0xD3, 0xA5, 0x83, 0x11, 0x80, 0x3A, 0x47, 0x6C, 0x45, 0x2E, 0x48, 0xEE, 0xF0, 0x06,
-    0x47, 0x5D, 0xC2, 0xE6, 0xC3, 0x2C, 0xA6, 0xE0, 0x10, 0x1A, 0xE0, 0x03, 0xA8, 0xFE, 0x03, 0xEF,
-    0x6C, 0xB9, 0xFC, 0xB3, 0xF0, 0x56, 0xBE, 0xFC, 0x5F, 0xC2, 0x0D, 0x75, 0xF5, 0x6F, 0x93, 0x5B,
-    0xB8, 0xE6, 0x69, 0xF5, 0x6F, 0x9F, 0x53, 0x41, 0xA5, 0xD8, 0xE8, 0xFC, 0xFC, 0x17, 0xC0, 0xAE,
-    0xE8, 0xF3, 0x60, 0xD7, 0x3C, 0xDA, 0x62, 0xB6, 0x63, 0xE4, 0x7D, 0x08, 0xAC, 0x2E, 0xED, 0xA1,
-    0x2D, 0x02, 0xAB, 0x17, 0x86, 0x39, 0xB4, 0xA5, 0x79, 0x12, 0xFA, 0x21, 0x27, 0xB0, 0xAA, 0x09,
-    0xAC, 0x78, 0x2B, 0x7F, 0x98, 0x01, 0x2B, 0xBB, 0x0F, 0xAC, 0x3E, 0x72, 0x4A, 0x70, 0x06, 0x73,
-    0x9C, 0x0A, 0x95, 0x08, 0x46, 0x9B, 0x71, 0x7E, 0xE9, 0x94, 0x80, 0xB9, 0x62, 0x9C, 0x7F, 0x1E,
-    0x67, 0x3B, 0x17, 0x03, 0xA5, 0xD6, 0x7A, 0x1E, 0xAA, 0xBE, 0x8B, 0xAA, 0xA0, 0xCE, 0x54, 0xFC,
-    0xA9, 0x11, 0x00, 0xE6, 0xF0, 0x86, 0xC4, 0x5C, 0xE3, 0x1B, 0xF4, 0x64, 0x62, 0xEC, 0x99, 0xE7,
-    0x78, 0x8A, 0x78, 0x7A, 0x9D, 0xDE, 0x37, 0xEF, 0x04, 0xE2, 0xE5, 0x01, 0xED, 0x7E, 0x7C, 0x07,
-    0x74, 0xCD, 0x16, 0xF2, 0xAB, 0x6A, 0x78, 0x3E, 0x68, 0x83, 0x7E, 0x84, 0x2D, 0xDC, 0x04, 0x5F,
-    0x65, 0x97, 0x61, 0x04, 0x46, 0x58, 0xD2, 0x96, 0x4F, 0xC7, 0x57, 0xF0, 0xEC, 0x1D, 0x28, 0x2C,
-    0x28, 0xE5, 0x1E, 0xCF, 0xED, 0xA2, 0x3B, 0x4D, 0xBA, 0xB0, 0x25, 0x31, 0x8B, 0x41, 0xF9, 0xFF,
-    0x8D, 0xB1, 0xE7, 0xFC, 0x79, 0x6F, 0xF0, 0xE4, 0xD9, 0x69, 0x09, 0x35, 0x43, 0xE3, 0x9B, 0x88,
-    0x2F, 0x72, 0x03, 0x13, 0xF4, 0x3C, 0xF3, 0x35, 0x8C, 0x9E, 0x75, 0x6A, 0xE9, 0xB7, 0x6A, 0xD9,
-    0xBB, 0x5E, 0x2E, 0x03, 0xE2, 0x2F, 0xA7, 0xB6, 0x5F, 0xCE, 0x72, 0xB3, 0x7C, 0x51, 0xBD, 0xFA,
-    0xEA, 0x55, 0x75, 0xBA, 0x30, 0xB2, 0x65, 0x7C, 0xBF, 0x38, 0xA8, 0xD3, 0xCB, 0x45, 0x3E, 0x2E,
-    0x17, 0xD6, 0x2C, 0x67, 0xB8, 0x0E, 0x80, 0xE5, 0xE7, 0xBE, 0x24, 0x39, 0x68, 0xD4, 0x55, 0xA6,
-    0x8C, 0x0F, 0xA4, 0x13, 0xD5, 0x80, 0x3C, 0x79, 0x96, 0x83, 0xC3, 0x19, 0x97, 0xA3, 0xB9, 0x21,
-    0xCE, 0x2A, 0xCE, 0x8E, 0x01, 0x74, 0x73, 0xD2, 0xA6, 0xAD, 0xAE, 0xF4, 0x3A, 0x1E, 0x9E, 0x98,
-    0xD8, 0xD0, 0xDB, 0xA1, 0x3C, 0x52, 0x17, 0x84, 0xC3, 0xE4, 0x72, 0x7D, 0xEE, 0xDF, 0x37, 0xB0,
-    0x9F, 0x7E, 0x97, 0xC2, 0xC7, 0x80, 0xF2, 0x59, 0x07, 0x1D, 0x20, 0xE2, 0xF4, 0xC3, 0x8F, 0xFE,
-    0x8B, 0x76, 0x68, 0x0D, 0x55, 0xBC, 0x6B, 0x71, 0xBB, 0x6B, 0x61, 0xB7, 0x28, 0xB8, 0x6B, 0x8A,
-    0xCD, 0x2D, 0xFC, 0xEE, 0x9C, 0x18, 0x73, 0xB1, 0x95, 0x7F, 0x7F, 0xF2, 0x0C, 0xBD, 0x33, 0x3C,
-    0x88, 0xA6, 0xD5, 0xD7, 0x00, 0xC7, 0x69, 0x35, 0x31, 0xCB, 0xB1, 0x62, 0x98, 0x72, 0x69, 0x85,
-    0xFD, 0xED, 0x2C, 0xD7, 0x96, 0x5D, 0x71, 0x61, 0xFC, 0x9C, 0xAA, 0x13, 0x88, 0xEF, 0xFE, 0x12,
-    0x9A, 0x8A, 0x91, 0xFB, 0x32, 0x6A, 0x20, 0x7A, 0x07, 0x1A, 0xB0, 0x42, 0x3B, 0x35, 0x25, 0xF4,
-    0x0B, 0x54, 0x2D, 0x44, 0xF5, 0x86, 0x36, 0x74, 0xD6, 0xC4, 0x1D, 0x6E, 0x95, 0xF3, 0xAD, 0x7D,
-    0x67, 0x2B, 0xC3, 0x9A, 0x53, 0x0D, 0x6B, 0x42, 0x15, 0x51, 0x4C, 0xA9, 0x16, 0xDA, 0x0C, 0x98,
-    0x0E, 0x78, 0xF7, 0xFE, 0x3E, 0xF0, 0x31, 0x47, 0x03, 0x9F, 0x7D, 0xED, 0x1B, 0x8E, 0x4C, 0x5A,
-    0xA8, 0x31, 0xE8, 0x92, 0x32, 0xBE, 0xD9, 0xAA, 0xEF, 0x12, 0x6E, 0x5A, 0x6A, 0x79, 0xE1, 0xA6,
-    0xEC, 0xEF, 0x97, 0xDE, 0x77, 0x26, 0x05, 0x8E, 0x27, 0xF4, 0xCE, 0x9E, 0xAD, 0xF6, 0x34, 0x63,
-    0xBA, 0xBD, 0x1A, 0x7E, 0x5C, 0x05, 0x8D, 0x4B, 0x01, 0x4A, 0xFC, 0x71, 0xE4, 0x80, 0x19, 0x19,
-    0x29, 0x99, 0x5B, 0xFA, 0x8E, 0x3F, 0x06, 0xF7, 0xE3, 0x1E, 0x54, 0x65, 0xF6, 0x0B, 0xBC, 0xD1,
-    0x7A, 0x6B, 0x4E, 0x57, 0x62, 0x72, 0x8A, 0x8D, 0x41, 0x7F, 0x20, 0xF9, 0x00, 0xBF, 0x4F, 0x5F,
-    0xE7, 0x2B, 0xBB, 0x24, 0xAF, 0x75, 0xC3, 0x57, 0xCD, 0x13, 0xB2, 0xCB, 0x74, 0xD8, 0x2D, 0xB3,
-    0x3F, 0x6D, 0xD7, 0xE7, 0x5E, 0xE3, 0xC1, 0x97, 0x9D, 0x7F, 0xE5, 0x30, 0x4D, 0x3E, 0x75, 0x7D,
-    0x30, 0xF7, 0x65, 0x75, 0x0A, 0xD6, 0x52, 0x65, 0xD2, 0xE4, 0x41, 0x37, 0x35, 0x1C, 0xEC, 0xD4,
-    0x84, 0x54, 0xAF, 0x71, 0x93, 0xC2, 0x8A, 0xD5, 0x99, 0x11, 0x47, 0xDE, 0xE9, 0x56, 0x22, 0xF7,
-    0xA0, 0x86, 0xEF, 0xF3, 0x5C, 0x58, 0x42, 0xA3, 0x2D, 0x73, 0xC7, 0xAE, 0x84, 0x20, 0x4C, 0xBE,
-    0x1C, 0xDE, 0x30, 0x61, 0xB5, 0x1C, 0x55, 0xCB, 0x61, 0x75, 0x35, 0x2A, 0x5F, 0x5D, 0xBA, 0xD1,
-    0x03, 0x51, 0x65, 0x65, 0x31, 0x04, 0x7B, 0x49, 0x97, 0xEF, 0x60, 0xEB, 0xBD, 0x52, 0xF5, 0x7E,
-    0xBD, 0xB7, 0x01, 0x6D, 0x10, 0xAF, 0xAF, 0x10, 0x3F, 0xF6, 0x7E, 0x73, 0x0D, 0xDB, 0x69, 0xB7,
-    0xFD, 0xDF, 0xB1, 0xC7, 0x43, 0xB1, 0x35, 0x42, 0x72, 0x61, 0x36, 0xEA, 0xF6, 0x9F, 0x40, 0xD1,
-    0x24, 0x8E, 0xAD, 0x7E, 0x3B, 0xD9, 0x84, 0x60, 0x07, 0xC4, 0x66, 0x78, 0x5C, 0x58, 0xCD, 0xB3,
-    0x2B, 0x9A, 0x32, 0x36, 0xC0, 0x5A, 0x61, 0xF0, 0xE4, 0x2F, 0x7F, 0x80, 0x56, 0x00, 0x9E, 0xBD,
-    0x8E, 0x29, 0x02, 0x29, 0xC8, 0x68, 0x30, 0xDB, 0x59, 0x15, 0xC3, 0x8B, 0x51, 0x19, 0x04, 0x04,
-    0x76, 0x01, 0xFC, 0x11, 0x72, 0xFE, 0x24, 0x07, 0xC7, 0xC8, 0xAB, 0xE3, 0x2B, 0x07, 0xD8, 0xDA,
-    0xA2, 0x4C, 0xE0, 0xC6, 0x5C, 0x4C, 0x2B, 0x7F, 0x67, 0x54, 0xD1, 0x56, 0x2B, 0x56, 0x0F, 0x02,
-    0x1F, 0xC8, 0x93, 0xC9, 0xF8, 0xCC, 0x11, 0x94, 0xD1, 0x63, 0x20, 0xBD, 0x75, 0xB8, 0x05, 0xC0,
-    0x5E, 0x14, 0x77, 0x9A, 0x7E, 0x09, 0x7E, 0xF4, 0x53, 0x0A, 0xFE, 0x40, 0x8E, 0x05, 0x13, 0xB0,
-    0xD1, 0xC2, 0xF7, 0xAB, 0x12, 0xA3, 0x15, 0x41, 0x1D, 0x20, 0x64, 0x61, 0xD3, 0xF5, 0xC1, 0xE8,
-    0xF4, 0xC3, 0x47, 0x83, 0x4D, 0x36, 0x6C, 0x5B, 0x2C, 0xD9, 0xD7, 0x07, 0x6D, 0x00, 0x21, 0xEB,
-    0xF4, 0x2E, 0xC0, 0xDB, 0x52, 0xEB, 0x0F, 0x7B, 0x77, 0x28, 0x30, 0x22, 0xD2, 0x22, 0x10, 0x09,
-    0x63, 0x1A, 0x66, 0x96, 0x52, 0x3D, 0xEA, 0xEF, 0xDB, 0xB3, 0xFC, 0xA7, 0xD5, 0xE9, 0x4C, 0x65,
-    0x5F, 0xF4, 0x92, 0x90, 0x22, 0x63, 0xF5, 0xA7, 0xD5, 0xF4, 0x3A, 0xA1, 0xD4, 0x05, 0xE5, 0xE2,
-    0x13, 0x99, 0x73, 0xD6, 0x06, 0xD9, 0x91, 0x33, 0x0C, 0x59, 0xA8, 0x88, 0x42, 0xAA, 0x77, 0x57,
-    0xE8, 0xBA, 0xD6, 0x44, 0x71, 0x10, 0x60, 0x4E, 0x68, 0x19, 0x57, 0x50, 0xA3, 0xE8, 0xF9, 0x07,
-    0x4B, 0x95, 0xC4, 0x8D, 0x32, 0x97, 0x96, 0x99, 0x62, 0xD3, 0xE9, 0xCC, 0x25, 0x5D, 0x9C, 0xD8,
-    0x86, 0x37, 0x64, 0x38, 0x85, 0x37, 0x8D, 0x5D, 0x44, 0xAE, 0x57, 0x3F, 0x19, 0xCE, 0x4F, 0xD5,
-    0x11, 0xEE, 0x7B, 0xE8, 0xC0, 0xBB, 0x80, 0x8A, 0x65, 0x5A, 0xA6, 0x0D, 0xF4, 0x3A, 0xFC, 0x56,
-    0xC1, 0x70, 0x0E, 0xF6, 0xC9, 0x77, 0x5A, 0x17, 0x4D, 0xDE, 0x47, 0xE9, 0xE2, 0x46, 0x48, 0xD8,
-    0x4D, 0x3C, 0x0A, 0x2A, 0x46, 0xD1, 0xFF, 0x79, 0xCA, 0x78, 0xA9, 0x27, 0xC9, 0x70, 0x86, 0xA2,
-    0xA2, 0x91, 0xC1, 0x09, 0xC9, 0x24, 0x2A, 0x29, 0x49, 0x88, 0xC4, 0xBF, 0x2E, 0xB6, 0x9E, 0x82,
-    0x96, 0x86, 0xC8, 0x33, 0xAD, 0x19, 0x25, 0x07, 0x2C, 0x4F, 0xEB, 0xD0, 0xC4, 0x6D, 0x51, 0xA5,
-    0x8D, 0x54, 0x50, 0xE4, 0x36, 0x18, 0x43, 0x13, 0x9A, 0xC8, 0x64, 0x30, 0x25, 0x49, 0xF7, 0xCC,
-    0xEA, 0xEA, 0xAF, 0x83, 0xC9, 0x01, 0x07, 0x02, 0x06, 0x8E, 0x1C, 0xE1, 0xA9, 0xC5, 0x5B, 0x8C,
-    0x43, 0x4A, 0xBA, 0x54, 0xF9, 0x4F, 0x9E, 0xC0, 0x0D, 0x30, 0xD7, 0xD4, 0xD5, 0x0C, 0x8E, 0x73,
-    0xBC, 0xDE, 0x26, 0x97, 0xDA, 0x6B, 0x71, 0x63, 0x92, 0x4A, 0xFD, 0x70, 0x25, 0xEC, 0x3C, 0xC0,
-    0x67, 0x48, 0x34, 0x9E, 0x84, 0xCE, 0xDE, 0xC2, 0x7D, 0x81, 0xA7, 0xA9, 0x9D, 0x7A, 0xE6, 0x2C,
-    0xDB, 0x70, 0x64, 0xA8, 0x9C, 0x04, 0xE1, 0x80, 0x24, 0xFD, 0x5A, 0xC5, 0x8C, 0x76, 0x31, 0xD4,
-    0xDE, 0x42, 0x67, 0xA6, 0x5D, 0xD6, 0xAA, 0x84, 0x4D, 0xDC, 0xE3, 0xE1, 0x68, 0x5A, 0xD7, 0x24,
-    0x70, 0x50, 0x54, 0x86, 0x1B, 0xFD, 0xB5, 0x18, 0x22, 0x78, 0xCF, 0x24, 0x05, 0x09, 0x52, 0xC9,
-    0xAD, 0x30, 0x6E, 0xC6, 0xB1, 0xA6, 0x99, 0xF1, 0x46, 0x0F, 0xDA, 0xE1, 0x06, 0xF8, 0x7D, 0xDB,
-    0xC4, 0x8C, 0xEF, 0xD7, 0xBA, 0x73, 0xDE, 0xEE, 0x28, 0x8E, 0x5B, 0xDC, 0xA5, 0x0D, 0x11, 0x7E,
-    0x06, 0x8F, 0x9E, 0x7A, 0x6A, 0x6F, 0xE3, 0x71, 0x93, 0x74, 0xA9, 0x7B, 0x00, 0x4D, 0x6D, 0xE5,
-    0xF3, 0xEE, 0x4B, 0xF3, 0xF3, 0xE2, 0x89, 0x9C, 0x39, 0x69, 0xCB, 0x44, 0x77, 0xE8, 0x4E, 0x94,
-    0xF1, 0x5B, 0x85, 0xA4, 0xED, 0xA1, 0xA5, 0x61, 0x37, 0xB3, 0x76, 0xAA, 0x08, 0x60, 0x78, 0xB0,
-    0xC7, 0xA0, 0x94, 0x0C, 0x92, 0xFE, 0x30, 0x93, 0x07, 0x20, 0x3E, 0x2E, 0xB3, 0x9E, 0xA4, 0x36,
-    0x5F, 0xB7, 0x8C, 0x63, 0xAF, 0x4B, 0x46, 0xF3, 0xAE, 0x08, 0x84, 0x04, 0xBD, 0xC4, 0xE2, 0xB9,
-    0x08, 0x21, 0x58, 0xC3, 0x08, 0x4B, 0x48, 0x14, 0xC8, 0xB6, 0x7B, 0x6D, 0x68, 0xE7, 0x92, 0x24,
-    0xFF, 0x6E, 0xB2, 0x97, 0x51, 0x97, 0x41, 0xC9, 0xF8, 0xA0, 0x67, 0x9E, 0x54, 0x01, 0x73, 0xDA,
-    0x70, 0x28, 0x1B, 0x9A, 0x46, 0xF4, 0x3D, 0xE8, 0x28, 0x87, 0xB7, 0x3A, 0xB0, 0xAC, 0x9D, 0xEE,
-    0x62, 0x25, 0x7C, 0xC3, 0xF0, 0x81, 0x99, 0xCC, 0xA0, 0xD8, 0x2F, 0xFF, 0x2D, 0xE6, 0xC4, 0x8B,
-    0x67, 0x56, 0x01, 0x84, 0x5A, 0xD1, 0x00, 0x1C, 0x3B, 0xE3, 0x7E, 0x54, 0x3D, 0x2C, 0x44, 0x29,
-    0x92, 0xBD, 0x12, 0x1B, 0x7B, 0x6B, 0x58, 0x5C, 0x9C, 0x95, 0xD8, 0x58, 0x75, 0x54, 0xCD, 0xC3,
-    0x7C, 0x1A, 0x70, 0x38, 0x90, 0x06, 0x3C, 0xFE, 0xCE, 0x5E, 0x56, 0xA7, 0x11, 0xBC, 0xCB, 0xAC,
-    0xEB, 0x1A, 0x4C, 0xED, 0xD7, 0x8A, 0x31, 0x48, 0x72, 0x8C, 0x3D, 0x72, 0x3B, 0xDB, 0x8B, 0xE7,
-    0x25, 0x51, 0x9C, 0x38, 0x0D, 0x40, 0x84, 0xC6, 0xFC, 0x87, 0x75, 0xD9, 0x7B, 0xF1, 0x56, 0x8E,
-    0xD8, 0xE9, 0x94, 0xF4, 0x68, 0x7F, 0x87, 0xA9, 0xDE, 0x98, 0x06, 0x7A, 0x88, 0x3F, 0x38, 0xCF,
-    0x1C, 0x95, 0xED, 0xF1, 0xC2, 0xCE, 0xF4, 0xAA, 0x0F, 0xBC, 0x5C, 0xA8, 0x63, 0x3F, 0x3D, 0x48,
-    0xCF, 0x49, 0xB6, 0xE6, 0xE0, 0x96, 0xDA, 0x31, 0x4F, 0x9D, 0x1B, 0xD9, 0x31, 0xAF, 0x91, 0x42,
-    0xED, 0x42, 0xD4, 0xC6, 0xFD, 0x8D, 0xC7, 0xD9, 0x00, 0x41, 0x35, 0xD8, 0xDA, 0x67, 0xDF, 0x3A,
-    0x95, 0x4B, 0x86, 0x19, 0x5E, 0x4C, 0xA5, 0xAE, 0x32, 0x5E, 0xA7, 0x87, 0xC8, 0x76, 0xD7, 0xE2,
-    0x8D, 0xEA, 0xB9, 0x3E, 0xB8, 0x7D, 0xE3, 0x2A, 0xFC, 0xE1, 0x75, 0x17, 0x8B, 0x80, 0xBD, 0xAC,
-    0x34, 0x8B, 0x62, 0x98, 0xFB, 0x6B, 0x25, 0x23, 0xC9, 0xFC, 0x31, 0xF8, 0xCE, 0x0E, 0x8C, 0xC0,
-    0x47, 0x70, 0x30, 0x16, 0xA4, 0x78, 0xEB, 0x36, 0x66, 0x8D, 0x14, 0xFA, 0xCC, 0x4A, 0xA8, 0x23,
-    0xB0, 0x7A, 0x14, 0x6B, 0x2C, 0x65, 0x3B, 0x52, 0x80, 0xB3, 0x17, 0xE6, 0xB0, 0xF5, 0xA4, 0x93,
-    0xC4, 0xDC, 0x46, 0x53, 0x7A, 0x72, 0x76, 0x01, 0xC5, 0x71, 0x98, 0xDE, 0x79, 0x65, 0x6C, 0x6F,
-    0x0F, 0x5A, 0x6A, 0x9F, 0xEE, 0x00, 0x4F, 0x36, 0x78, 0xAF, 0xF1, 0x0F, 0x4F, 0x16, 0x3D, 0x82,
-    0x13, 0xDB, 0xC2, 0x73, 0x8E, 0xA9, 0xD5, 0x66, 0xE6, 0x6F, 0x9A, 0xFD, 0x99, 0x05, 0xCB, 0x66,
-    0xDC, 0xB0, 0x8F, 0x2B, 0x21, 0x9D, 0x90, 0xD1, 0xB0, 0xB5, 0x1F, 0x1B, 0x15, 0x6D, 0xDA, 0x05,
-    0x50, 0xFB, 0xEE, 0x00, 0x85, 0x9B, 0x6E, 0x3D, 0x69, 0x67, 0x51, 0x19, 0x51, 0x02, 0x4A, 0x3A,
-    0xE0, 0xEE, 0x1D, 0x8B, 0xAB, 0x27, 0x0A, 0x22, 0x79, 0xCA, 0xE0, 0xA0, 0xBD, 0xBD, 0x09, 0xE3,
-    0x64, 0xB2, 0x37, 0xAC, 0x6F, 0xAB, 0xD1, 0x05, 0xE6, 0x02, 0x19, 0x59, 0x2C, 0x86, 0xED, 0xCF,
-    0xD5, 0x57, 0x48, 0x92, 0x76, 0x9F, 0x9F, 0x24, 0xA5, 0x19, 0xD0, 0x62, 0x15, 0x8E, 0xBF, 0xA5,
-    0x8E, 0x8A, 0xF1, 0xDC, 0xFE, 0x25, 0x63, 0x3C, 0x26, 0x25, 0x36, 0x19, 0x55, 0xD1, 0xFE, 0xC9,
-    0x32, 0x95, 0x40, 0xFE, 0x53, 0xA8, 0x0C, 0x49, 0x33, 0x4A, 0x95, 0x48, 0x22, 0x7A, 0x1B, 0x78,
-    0x81, 0xF5, 0x22, 0x61, 0xCF, 0x32, 0x91, 0x5D, 0x3E, 0xF8, 0xE9, 0x28, 0xAC, 0xA8, 0xC4, 0x3F,
-    0x72, 0xA2, 0x1B, 0x3B, 0x6A, 0x93, 0xC3, 0x78, 0x2E, 0xE1, 0x80, 0xA5, 0x10, 0x28, 0x7D, 0xC2,
-    0x50, 0xEF, 0x43, 0x5A, 0x2F, 0x00, 0xFB, 0x9C, 0x49, 0xC7, 0x07, 0x59, 0x1B, 0x3B, 0x92, 0x67,
-    0x07, 0x9B, 0x53, 0x51, 0x0D, 0x00, 0xB3, 0xD0, 0xA8, 0xAB, 0x85, 0x0A, 0x1E, 0x43, 0x5F, 0xDD,
-    0x83, 0x86, 0xA0, 0x0D, 0x6E, 0xC5, 0x3E, 0x93, 0x67, 0x0A, 0xE8, 0x0B, 0x3C, 0x20, 0xDA, 0x82,
-    0x1A, 0x7E, 0x05, 0xA0, 0x34, 0xED, 0xA1, 0x47, 0x78, 0x2F, 0x78, 0x5F, 0x8A, 0xC2, 0x53, 0x86,
-    0x22, 0xDD, 0x54, 0x8E, 0xAC, 0x71, 0x93, 0x62, 0x9B, 0x54, 0x2A, 0x6A, 0x60, 0x1E, 0xD3, 0x1E,
-    0x03, 0xBA, 0xCA, 0x54, 0x8F, 0x4D, 0x25, 0x9B, 0xB5, 0xB1, 0x41, 0xDD, 0xF3, 0xF8, 0xA9, 0xD4,
-    0xBC, 0x58, 0x97, 0x31, 0x15, 0x05, 0x24, 0x7C, 0x95, 0x3C, 0xE1, 0x41, 0x68, 0x8C, 0xA5, 0x94,
-    0x67, 0xAC, 0xFF, 0xD0, 0xFF, 0xB3, 0x64, 0x6C, 0x96, 0x9C, 0x04, 0x54, 0xA5, 0x68, 0x67, 0x64,
-    0xA4, 0xD5, 0x62, 0xAE, 0xBC, 0xC5, 0xF3, 0xC2, 0x8B, 0x95, 0xFA, 0xB5, 0xDF, 0x82, 0xAA, 0x57,
-    0xA5, 0xEE, 0x29, 0xCB, 0xE3, 0xBF, 0x03, 0x30, 0x7D, 0xB2, 0x56, 0x49, 0x90, 0x2E, 0x63, 0x40,
-    0x78, 0xCB, 0xAA, 0xF0, 0xD3, 0xB5, 0xD6, 0xDB, 0x05, 0x17, 0x5C, 0xA4, 0xC9, 0x29, 0x43, 0x4B,
-    0x17, 0xA1, 0xD9, 0xCB, 0xF6, 0x46, 0x94, 0x84, 0x93, 0xE3, 0xD2, 0xB7, 0x92, 0xED, 0x9D, 0xC2,
-    0x86, 0x85, 0x2B, 0x73, 0xA8, 0x5C, 0xFC, 0x41, 0x94, 0x86, 0x48, 0x61, 0x45, 0xDB, 0xC2, 0x52,
-    0x85, 0x0D, 0x16, 0x07, 0xB9, 0xE1, 0x89, 0xE1, 0x55, 0xE9, 0x40, 0x65, 0xD4, 0xB9, 0x34, 0x04,
-    0xC3, 0x34, 0x2A, 0xBB, 0x37, 0x82, 0xA4, 0xF0, 0x16, 0xB2, 0x9B, 0xB6, 0x65, 0xB8, 0xAD, 0x62,
-    0x28, 0x9B, 0xA6, 0x17, 0x83, 0x88, 0xA5, 0x52, 0xCB, 0x25, 0xAD, 0x39, 0x8E, 0x6A, 0xCA, 0x85,
-    0xCA, 0x48, 0xC0, 0x46, 0xAE, 0x5A, 0x4C, 0xD0, 0x0F, 0xBB, 0x2F, 0xA3, 0x71, 0xC3, 0x71, 0xE3,
-    0x91, 0x01, 0x4D, 0x5D, 0x4C, 0xDC, 0xBC, 0xDC, 0x96, 0xAE, 0x24, 0xC4, 0x1C, 0x1C, 0x95, 0x92,
-    0x61, 0x29, 0x19, 0x17, 0x03, 0xB3, 0xD6, 0x64, 0xB9, 0x02, 0xC8, 0x54, 0x06, 0x3D, 0xDD, 0xE5,
-    0xFC, 0xC0, 0x7B, 0xB2, 0xB5, 0x72, 0xF6, 0x8D, 0xFE, 0x5D, 0x2D, 0x8E, 0x7D, 0xF0, 0x14, 0xFC,
-    0xFD, 0x48, 0xBC, 0x73, 0xA0, 0x20, 0x48, 0x74, 0xCD, 0x20, 0xEC, 0x51, 0x4D, 0x33, 0xD7, 0x64,
-    0x87, 0x9B, 0x62, 0x56, 0x5B, 0xD8, 0x1D, 0x6E, 0xB6, 0x17, 0x8B, 0xAE, 0x60, 0x41, 0x00, 0x9B,
-    0x1D, 0x36, 0x56, 0x3B, 0x30, 0xED, 0x30, 0xDF, 0xD4, 0x5C, 0x54, 0xE9, 0xD9, 0xC6, 0xEF, 0xC0,
-    0x27, 0x67, 0xDB, 0x60, 0xEE, 0xED, 0x8D, 0x36, 0xE8, 0xF5, 0xAA, 0x7E, 0x13, 0x9A, 0x1B, 0x36,
-    0x58, 0xDE, 0x04, 0x43, 0x43, 0xD3, 0x30, 0xA8, 0xF6, 0x17, 0x98, 0x86, 0x86, 0xF9, 0x6E, 0x56,
-    0x98, 0x08, 0xCF, 0x7E, 0x62, 0x84, 0x81, 0xAF, 0xB4, 0x02, 0xC3, 0xF9, 0x51, 0x23, 0x86, 0x04,
-    0x04, 0x64, 0xB2, 0x7A, 0x54, 0x13, 0x04, 0xA0, 0xA5, 0x92, 0x8F, 0x72, 0xF9, 0x68, 0x90, 0xCC,
-    0x8B, 0x24, 0xC6, 0x95, 0xAB, 0xF5, 0x99, 0xD5, 0x72, 0xC4, 0x2E, 0xE3, 0x25, 0x09, 0x72, 0x57,
-    0xE4, 0x46, 0x21, 0x2C, 0x7D, 0x7E, 0x44, 0xD8, 0x27, 0x98, 0x23, 0x35, 0x92, 0x0D, 0x66, 0xA2,
-    0x37, 0xC3, 0x0C, 0x99, 0x59, 0x53, 0x29, 0xD7, 0xE4, 0x87, 0x9A, 0x54, 0xBA, 0x7C, 0xA0, 0x79,
-    0xC0, 0x0E, 0x95, 0xE9, 0x7E, 0x23, 0x08, 0x78, 0x70, 0x2A, 0x5C, 0xCA, 0xD1, 0xEC, 0xB8, 0x7F,
-    0x20, 0x75, 0x5C, 0x0C, 0x8B, 0xB5, 0x72, 0x60, 0xE7, 0x0E, 0x62, 0x3B, 0x4B, 0xEE, 0xE4, 0x56,
-    0xAE, 0x77, 0x07, 0x3D, 0xD3, 0x3C, 0x75, 0x71, 0x0F, 0xCE, 0x76, 0xEB, 0x8D, 0x3C, 0x90, 0x84,
-    0x27, 0x7B, 0x8D, 0x83, 0x51, 0x92, 0xB9, 0x92, 0xC3, 0xC0, 0x27, 0x81, 0xDD, 0xE2, 0x65, 0x99,
-    0x71, 0x07, 0xFF, 0xFA, 0x6D, 0xB5, 0x0A, 0x73, 0x77, 0x6A, 0x75, 0xF5, 0x6D, 0x67, 0x4C, 0xF7,
-    0xDA, 0x8A, 0xAA, 0xE8, 0x6B, 0xB5, 0x0C, 0x91, 0x12, 0x13, 0xD4, 0xD2, 0xE2, 0x1E, 0xC9, 0x70,
-    0x52, 0xA0, 0x08, 0x95, 0x3B, 0xD4, 0xC9, 0x28, 0x15, 0x3F, 0x73, 0xAD, 0x27, 0x6D, 0x26, 0x9F,
-    0x66, 0x52, 0x17, 0x2C, 0x89, 0xDE, 0x36, 0x5B, 0x39, 0xE8, 0xEC, 0x5C, 0xC8, 0x05, 0x71, 0xD4,
-    0x92, 0x1A, 0xE8, 0x20, 0xA0, 0x3E, 0xE3, 0x03, 0x18, 0xD0, 0xAE, 0xE4, 0xE3, 0x6B, 0x66, 0x31,
-    0x8A, 0x0A, 0x88, 0xB2, 0x05, 0xD2, 0x6C, 0x3C, 0xA0, 0xEE, 0xB0, 0x23, 0x02, 0x67, 0x3A, 0xA9,
-    0x9C, 0xD5, 0xBB, 0x25, 0x75, 0xDA, 0xC6, 0x5D, 0x68, 0xD2, 0x6D, 0xF0, 0x8C, 0xD5, 0xB0, 0xDC,
-    0xF4, 0xE4, 0x7B, 0xE1, 0x01, 0xA9, 0x0A, 0x99, 0xC2, 0x9C, 0xA2, 0x34, 0xA4, 0x9C, 0xF5, 0x7B,
-    0x2B, 0x7B, 0x0E, 0x98, 0x54, 0x02, 0xDB, 0xEA, 0x3C, 0xD8, 0x63, 0xC3, 0xB2, 0x92, 0x13, 0xD7,
-    0x76, 0xD7, 0x43, 0xA0, 0x5A, 0x03, 0xD1, 0xF2, 0x3A, 0x38, 0x95, 0x7E, 0x1B, 0x34, 0x17, 0xFD,
-    0x2E, 0xAE, 0x0B, 0xBF, 0x4B, 0xAA, 0xC2, 0x37, 0xC5, 0x4A, 0xF6, 0xDA, 0x08, 0x4A, 0x37, 0xAE,
-    0xFA, 0x89, 0xF9, 0x08, 0x86, 0x0C, 0xE4, 0xDE, 0xC7, 0xCE, 0x1D, 0x2E, 0x2D, 0xF0, 0x25, 0xF3,
-    0xF4, 0xCD, 0x4B, 0x0B, 0x98, 0x71, 0x9E, 0xC0, 0xFE, 0xE4, 0x4D, 0x11, 0xFD, 0xAA, 0x67, 0xAE,
-    0xC9, 0x00, 0xF6, 0x93, 0xAC, 0x9F, 0x1F, 0xA6, 0x6E, 0x66, 0x61, 0xEA, 0x74, 0xE7, 0x67, 0x81,
-    0x78, 0x45, 0xDD, 0x3F, 0xB5, 0xF7, 0xC3, 0x51, 0x64, 0xED, 0xA7, 0x4E, 0x4E, 0x9E, 0x1C, 0x2C,
-    0x55, 0x58, 0xFC, 0xC9, 0xB8, 0x78, 0xEE, 0xC8, 0x52, 0x85, 0x59, 0x5D, 0x82, 0xC4, 0xCA, 0x0F,
-    0x96, 0x2A, 0xA8, 0xFD, 0x52, 0x05, 0xA9, 0x9F, 0xDD, 0xE6, 0x50, 0x19, 0x4E, 0x73, 0x90, 0xBB,
-    0x9A, 0x59, 0x4C, 0x29, 0x10, 0xF8, 0x10, 0x4F, 0x29, 0xE8, 0x56, 0x74, 0x52, 0x03, 0xCA, 0xD0,
-    0x51, 0x7A, 0xE4, 0x9B, 0xAB, 0xE6, 0x25, 0x95, 0x88, 0x32, 0xC4, 0x97, 0x80, 0xF4, 0xC5, 0x3D,
-    0x83, 0x0C, 0xEB, 0xB0, 0xFA, 0x63, 0x38, 0x00, 0xA5, 0x32, 0x7A, 0x5C, 0x26, 0x2C, 0x46, 0x17,
-    0x2D, 0x57, 0x48, 0x4D, 0x0D, 0xED, 0x8F, 0x75, 0x4A, 0x5F, 0xB9, 0x02, 0x88, 0x58, 0x0A, 0xBE,
-    0x86, 0x59, 0x39, 0xEB, 0x81, 0x42, 0x0A, 0x00, 0x0A, 0xB2, 0xA3, 0x54, 0x18, 0x4C, 0x9E, 0x90,
-    0x4A, 0x37, 0x71, 0xDF, 0xA8, 0x03, 0xAA, 0x80, 0xCF, 0x43, 0xAF, 0x4F, 0x9F, 0xED, 0xBD, 0x91,
-    0xA9, 0x08, 0x0A, 0x72, 0xAF, 0x44, 0x9B, 0x13, 0x4A, 0xF7, 0x72, 0xB3, 0xC0, 0xBA, 0x19, 0xE6,
-    0xCD, 0xF7, 0x0F, 0xF7, 0xBA, 0x7B, 0x93, 0xDD, 0x05, 0x19, 0x53, 0x09, 0x6A, 0x94, 0x49, 0x7F,
-    0xB0, 0xBB, 0x5B, 0xE2, 0xDA, 0x55, 0x52, 0x89, 0x21, 0xAC, 0x95, 0x4E, 0xF3, 0x6F, 0xDD, 0x1D,
-    0x0F, 0xD6, 0x7D, 0x08, 0x3B, 0xED, 0x75, 0xF7, 0x44, 0xAE, 0x16, 0x43, 0xC6, 0x53, 0xAC, 0x54,
-    0xF6, 0x25, 0x0D, 0xFC, 0x52, 0x11, 0x19, 0x95, 0xBE, 0xC7, 0xB2, 0x78, 0x0D, 0xD5, 0x59, 0x54,
-    0x52, 0x2C, 0x1B, 0xCC, 0x85, 0x10, 0x92, 0xA9, 0x04, 0xF1, 0xA1, 0x68, 0xCC, 0xD8, 0x4C, 0x31,
-    0x05, 0xA1, 0x52, 0xC3, 0xF9, 0xF7, 0x47, 0x8F, 0xC8, 0x0F, 0xCF, 0xF7, 0xD8, 0x79, 0x4E, 0xB1,
-    0x6E, 0xA8, 0x4E, 0x07, 0x31, 0x50, 0x56, 0xD0, 0x78, 0x3B, 0x15, 0xDF, 0xAA, 0x82, 0xAC, 0x10,
-    0x8F, 0x33, 0x83, 0x18, 0xB9, 0xD9, 0x17, 0x9B, 0x6F, 0x89, 0x81, 0x6E, 0xF3, 0x5E, 0x1F, 0xD1,
-    0xF6, 0x31, 0x80, 0xAD, 0xE1, 0x94, 0x57, 0x05, 0x1C, 0x8E, 0x9E, 0xB5, 0x1A, 0x52, 0xAE, 0x5E,
-    0xCD, 0x0A, 0x81, 0x9D, 0x9F, 0xF8, 0x2F, 0x99, 0x51, 0x0F, 0x6B, 0xE0, 0x11, 0x55, 0x04, 0xAC,
-    0xAD, 0x28, 0xBD, 0xC1, 0x4C, 0xF6, 0xD0, 0x85, 0x20, 0xB2, 0x56, 0x0E, 0x13, 0x4A, 0x45, 0x56,
-    0x45, 0x9D, 0x2E, 0xA1, 0x20, 0xE8, 0x40, 0xE3, 0x66, 0x92, 0xF3, 0x38, 0xB1, 0x48, 0x90, 0x83,
-    0xE1, 0xAD, 0x4B, 0x08, 0x20, 0xA6, 0x4A, 0xA0, 0xBD, 0x4D, 0x1A, 0x89, 0x4E, 0x96, 0x41, 0xC7,
-    0x79, 0x06, 0x8E, 0x60, 0xF0, 0xE5, 0x6B, 0x9C, 0x16, 0xCC, 0x2E, 0x59, 0x14, 0x01, 0xFC, 0xB5,
-    0xCB, 0x5B, 0xFA, 0xAB, 0xAB, 0xEF, 0x8A, 0x3F, 0x15, 0x0A, 0xA3, 0x26, 0x82, 0x8E, 0x0B, 0xD1,
-    0x76, 0xC3, 0x09, 0x48, 0x14, 0x2C, 0xCD, 0x32, 0xBE, 0x9A, 0x00, 0xB5, 0x87, 0x95, 0x32, 0x1E,
-    0x23, 0x7A, 0xCB, 0x10, 0x8D, 0xC3, 0x27, 0x3E, 0x58, 0x3A, 0x37, 0x2B, 0x4D, 0xCA, 0x25, 0xEE,
-    0xE2, 0x8A, 0x26, 0xAE, 0xCD, 0x6A, 0x26, 0xE0, 0xD5, 0x45, 0x7D, 0xDA, 0xF8, 0x2C, 0x8A, 0xD5,
-    0xAF, 0x81, 0x4F, 0x9B, 0x22, 0x0F, 0xE1, 0xAA, 0x7B, 0x23, 0x7A, 0x58, 0x94, 0x03, 0xB5, 0x70,
-    0x19, 0x77, 0x51, 0x97, 0x48, 0xF8, 0x83, 0xDE, 0x12, 0x7A, 0xB8, 0xD5, 0x4D, 0x52, 0xCC, 0x5C,
-    0x27, 0x6B, 0x35, 0x49, 0x41, 0x8F, 0x75, 0xAD, 0x9C, 0x38, 0x46, 0x94, 0x42, 0x8A, 0x70, 0xDC,
-    0xB8, 0xBC, 0x89, 0x1A, 0xAF, 0xF9, 0x9D, 0x7B, 0x2D, 0x7B, 0xF2, 0xF2, 0xBB, 0xD3, 0x21, 0x1C,
-    0xFC, 0x8E, 0xC6, 0xC8, 0x9F, 0xBD, 0x3C, 0x56, 0xD7, 0x8A, 0xDB, 0x9A, 0xC9, 0xEB, 0xD4, 0xD1,
-    0xF5, 0x30, 0xA7, 0xE3, 0xCD, 0xCD, 0x66, 0xCC, 0x4E, 0xA7, 0x9B, 0x4F, 0x3F, 0x99, 0xAF, 0x87,
-    0x49, 0xFA, 0x8B, 0xEA, 0x74, 0x08, 0x5D, 0x5B, 0xA8, 0xD3, 0x7B, 0xF5, 0x30, 0xFB, 0x09, 0x9B,
-    0xFF, 0x7A, 0x6B, 0xE3, 0xB9, 0xAB, 0xFF, 0xFD, 0x9E, 0x4B, 0xD8, 0xBC, 0xFA, 0x5C, 0xB0, 0x5E,
-    0xFD, 0x19, 0x13, 0x36, 0xA7, 0x94, 0x4B, 0xA8, 0x75, 0xEA, 0xA8, 0xFC, 0x1A, 0xDC, 0x68, 0xDF,
-    0xA5, 0xAC, 0x68, 0x12, 0x3A, 0xDD, 0x24, 0x10, 0x30, 0x26, 0x33, 0x0B, 0xD8, 0x28, 0xC8, 0x42,
-    0xF4, 0x68, 0x70, 0xB9, 0x4D, 0x57, 0x86, 0x16, 0xEF, 0xAC, 0xAA, 0x53, 0x2B, 0x51, 0x3B, 0x85,
-    0x04, 0x5B, 0x47, 0x82, 0xBD, 0xED, 0x13, 0x29, 0xC9, 0x26, 0xE3, 0xB4, 0xC9, 0x4E, 0xD4, 0x26,
-    0x40, 0x3B, 0x0C, 0x5E, 0xC2, 0xCB, 0xDC, 0xDB, 0x18, 0xB9, 0x94, 0xAD, 0xE1, 0x16, 0x1A, 0x86,
-    0x2D, 0x25, 0x74, 0x39, 0xB7, 0xD2, 0xE4, 0xBE, 0xF3, 0x01, 0xC7, 0xA9, 0xFA, 0x57, 0x0C, 0x50,
-    0x5D, 0xD4, 0x6E, 0xFD, 0x43, 0x5B, 0x54, 0xC1, 0x70, 0xEC, 0x65, 0x01, 0x62, 0xCE, 0xFB, 0x95,
-    0xA4, 0xBD, 0x7B, 0xF3, 0x56, 0xE1, 0xCE, 0x8F, 0x6F, 0xEF, 0x65, 0xF2, 0x62, 0x17, 0xE7, 0x9E,
-    0x62, 0x96, 0x5C, 0xC9, 0xF1, 0xCF, 0x38, 0x75, 0x3B, 0x7F, 0x69, 0x9C, 0x47, 0x60, 0x9C, 0x3B,
-    0x3F, 0xAD, 0x6E, 0x70, 0xB1, 0x0F, 0x91, 0x4F, 0x4F, 0xEF, 0x4E, 0x75, 0x14, 0x53, 0xA1, 0xFC,
-    0xFF, 0xEA, 0x33, 0x75, 0x5D, 0x5D, 0xCD, 0x56, 0xA7, 0x35, 0x27, 0x63, 0x24, 0xC6, 0xD3, 0x1B,
-    0xCE, 0xCD, 0x44, 0xD0, 0xE6, 0xC7, 0xA7, 0x0C, 0x3D, 0x17, 0x3D, 0xB8, 0xFE, 0x7B, 0xF3, 0xC5,
-    0xA5, 0x9E, 0xBE, 0x3F, 0xD5, 0xD8, 0x4E, 0xEE, 0xBB, 0x1B, 0x18, 0xA1, 0x28, 0xD7, 0x78, 0x74,
-    0x20, 0xCB, 0x78, 0xEC, 0x27, 0xB3, 0x11, 0x4D, 0x6F, 0x62, 0x97, 0xED, 0xF0, 0x7B, 0x03, 0x9B,
-    0x46, 0x34, 0x4C, 0x65, 0x67, 0xA5, 0xFA, 0x47, 0x1C, 0xD1, 0xF0, 0x23, 0xE3, 0x6A, 0x08, 0x9C,
-    0x87, 0x2A, 0x6F, 0x2E, 0xC5, 0xC7, 0xC7, 0xBA, 0x28, 0x92, 0x8B, 0xAD, 0x4E, 0x3E, 0xEF, 0x11,
-    0x6F, 0x32, 0x68, 0x49, 0x39, 0x06, 0xC3, 0x52, 0x69, 0xFC, 0xDE, 0x6F, 0x65, 0xD4, 0x02, 0x17,
-    0x5E, 0x73, 0x50, 0x31, 0xDA, 0xCE, 0x67, 0xC3, 0x2E, 0x6A, 0x8F, 0xB1, 0xE3, 0x2D, 0x59, 0x48,
-    0x30, 0xF3, 0x0D, 0xE9, 0xA4, 0xCE, 0x5C, 0x5E, 0x91, 0xEF, 0xE7, 0xBF, 0x7C, 0x79, 0x8C, 0x9A,
-    0x8B, 0x07, 0x5F, 0x74, 0x8C, 0xB0, 0xD6, 0x4D, 0xC5, 0xC9, 0x95, 0x1B, 0xA5, 0x1B, 0xAD, 0x3F,
-    0x96, 0xEA, 0x0F, 0xFD, 0x8B, 0xE0, 0xFF, 0x12, 0x6A, 0xC5, 0x80, 0x0C, 0xAF, 0xD1, 0xD0, 0xF7,
-    0xD9, 0xE0, 0xEC, 0x90, 0xEE, 0x38, 0x57, 0xB0, 0x2F, 0xEB, 0x12, 0x1A, 0xFB, 0xD0, 0x4A, 0x70,
-    0xCA, 0xDE, 0x33, 0x56, 0x16, 0x1D, 0x69, 0x21, 0x62, 0x30, 0x45, 0x28, 0x82, 0xA9, 0x5E, 0x2C,
-    0x9A, 0x02, 0x15, 0x53, 0xDD, 0xB4, 0x9B, 0x79, 0xD1, 0xE4, 0xD3, 0xC2, 0x2C, 0x79, 0x8F, 0xA6,
-    0xF2, 0x32, 0xED, 0x2A, 0x36, 0x58, 0x21, 0xCB, 0xD2, 0x41, 0x6B, 0x53, 0x53, 0x10, 0x52, 0xB5,
-    0x1A, 0x5E, 0x46, 0xC9, 0x4A, 0x8A, 0x5A, 0xDB, 0xFD, 0x58, 0x44, 0xD8, 0x72, 0x0D, 0x00, 0xC9,
-    0xDA, 0xA9, 0xBD, 0x08, 0x9D, 0x64, 0xD3, 0xA6, 0xC4, 0xDA, 0x57, 0xFB, 0xF3, 0xDF, 0xF1, 0x57,
-    0xCB, 0x0B, 0x25, 0x4C, 0x15, 0x46, 0x2E, 0xD1, 0x4E, 0x86, 0x3A, 0x3D, 0xFB, 0xD2, 0xC0, 0x11,
-    0xA6, 0x8F, 0xEC, 0x02, 0xA7, 0x7A, 0x14, 0xD7, 0xCD, 0x45, 0x73, 0x67, 0xA1, 0xDD, 0x29, 0xA6,
-    0x21, 0x42, 0x31, 0x4D, 0x44, 0xE9, 0x6A, 0x54, 0xFA, 0x89, 0x06, 0x95, 0x9A, 0xF4, 0xBB, 0x1B,
-    0x63, 0x0D, 0x42, 0xDC, 0xB3, 0xC5, 0x28, 0x01, 0x99, 0x0D, 0x9A, 0xE5, 0x9A, 0xF5, 0x45, 0x79,
-    0xD4, 0x00, 0x80, 0xC2, 0x7C, 0xC7, 0xAD, 0xAE, 0xE2, 0x8F, 0x00, 0xBF, 0x37, 0xA1, 0x28, 0xE0,
-    0xD3, 0x24, 0x5B, 0x04, 0x06, 0xAD, 0x80, 0x83, 0x54, 0xB2, 0x92, 0xF7, 0x19, 0x56, 0xA0, 0x22,
-    0x6F, 0x80, 0x6C, 0x3B, 0xA9, 0x23, 0xAA, 0x83, 0x81, 0x92, 0x91, 0xD5, 0xFE, 0x08, 0xD1, 0x1F,
-    0x2F, 0x94, 0x54, 0xCC, 0x8C, 0x5D, 0x48, 0xD5, 0x4B, 0x2B, 0xA5, 0x8E, 0x6E, 0x79, 0x84, 0xFA,
-    0xEE, 0xB1, 0xBC, 0xCF, 0x82, 0xCD, 0x2E, 0xBE, 0x52, 0x9D, 0x06, 0x6E, 0x68, 0xB8, 0x9A, 0xA6,
-    0xC7, 0x2C, 0xF8, 0x3B, 0x36, 0xAA, 0x8B, 0x34, 0x37, 0x83, 0xFF, 0xA4, 0x8D, 0x18, 0x61, 0xE4,
-    0xE9, 0xCA, 0xBB, 0x3F, 0x5B, 0xE2, 0xC3, 0xC1, 0x18, 0xCE, 0x22, 0xAC, 0xCA, 0x2E, 0x2D, 0x24,
-    0xD0, 0x81, 0xA4, 0x15, 0xE2, 0x8E, 0x75, 0xDF, 0x15, 0xCB, 0xDD, 0x68, 0xD6, 0x4D, 0xC8, 0x44,
-    0xBD, 0xAC, 0xC5, 0x62, 0xE9, 0x19, 0xC5, 0xB6, 0x0F, 0x19, 0x30, 0x80, 0xFB, 0xA5, 0x4B, 0x5D,
-    0xB1, 0x54, 0xBA, 0x65, 0x14, 0xF8, 0x12, 0xD0, 0xEC, 0x00, 0xED, 0xA3, 0x67, 0xE0, 0x49, 0x56,
-    0xA8, 0xEC, 0x61, 0x93, 0xE3, 0xEF, 0x48, 0xFA, 0x81, 0x43, 0x5D, 0xAB, 0xE3, 0x9B, 0x00, 0xD1,
-    0xD7, 0x94, 0x49, 0xF3, 0x2C, 0x92, 0x83, 0x66, 0xF0, 0xFA, 0x2C, 0xBF, 0x18, 0xD7, 0xE9, 0x19,
-    0x0C, 0xDB, 0x2E, 0x34, 0x59, 0x25, 0xD8, 0xB4, 0xA3, 0xC8, 0xD1, 0xF9, 0xAB, 0x8F, 0x6A, 0xC4,
-    0xF5, 0x3B, 0xDC, 0xD4, 0xAE, 0x29, 0x1A, 0xFD, 0x9B, 0x45, 0xDD, 0x8A, 0x0B, 0x28, 0x8D, 0x3D,
-    0xD4, 0xD0, 0xCB, 0x63, 0x23, 0xA5, 0xD1, 0x83, 0x34, 0x53, 0x05, 0x6A, 0xE0, 0x32, 0x97, 0x82,
-    0x4F, 0xFA, 0xA9, 0xA6, 0xD4, 0x7F, 0x67, 0x16, 0x40, 0x4B, 0x4A, 0xA3, 0x2E, 0xCA, 0xB2, 0x0E,
-    0xB8, 0x20, 0x74, 0x03, 0x07, 0xE0, 0x8F, 0x0E, 0x87, 0x35, 0x0E, 0xE1, 0xFC, 0xB9, 0x80, 0x28,
-    0xF1, 0x79, 0x4B, 0xE7, 0x6F, 0x54, 0x7A, 0x9D, 0xCB, 0x27, 0x04, 0x67, 0xEB, 0xD6, 0xE5, 0x9D,
-    0x44, 0x2D, 0x7D, 0xDE, 0xB0, 0x9A, 0x2F, 0x1C, 0x56, 0xFB, 0x15, 0x87, 0xB5, 0xDF, 0xEC, 0xEE,
-    0xE1, 0xAE, 0x61, 0xA6, 0x46, 0xA5, 0x11, 0x69, 0x17, 0xA8, 0x5B, 0x48, 0xE2, 0xA6, 0xC9, 0x54,
-    0x8C, 0xB1, 0x15, 0x32, 0xB6, 0xFA, 0x2B, 0x8C, 0xAD, 0xC2, 0xD8, 0xCE, 0xF4, 0x44, 0xE0, 0x8C,
-    0xCE, 0x49, 0x3E, 0xA8, 0x94, 0x88, 0x0B, 0x51, 0xDA, 0x89, 0x1C, 0xB6, 0x93, 0x85, 0x40, 0xAC,
-    0xD9, 0xBE, 0x02, 0x34, 0x52, 0xE4, 0xD1, 0x36, 0x50, 0xD1, 0x1D, 0x18, 0xDA, 0x85, 0xDA, 0x1F,
-    0x08, 0x41, 0xF4, 0x0B, 0xF6, 0x3D, 0xDC, 0xF2, 0x45, 0x49, 0xC4, 0x6C, 0xB9, 0xD5, 0x7A, 0xC4,
-    0x1F, 0x74, 0x21, 0x09, 0x3F, 0xD2, 0x5A, 0xBC, 0x1F, 0x09, 0x6C, 0xB5, 0x72, 0xE7, 0x40, 0xF4,
-    0xC2, 0x0F, 0xBC, 0x33, 0xD5, 0x73, 0x3F, 0x27, 0x02, 0xF8, 0x59, 0xB8, 0x91, 0x5F, 0x5D, 0x66,
-    0xC9, 0x46, 0xFA, 0xB4, 0xFA, 0xE9, 0x73, 0x2E, 0x61, 0x9A, 0x55, 0xB3, 0x94, 0xE8, 0x09, 0x25,
-    0x61, 0x5A, 0x7A, 0xF6, 0x10, 0x8C, 0x82, 0xFC, 0xAE, 0x8A, 0x81, 0xD1, 0xDE, 0x82, 0x45, 0x46,
-    0x68, 0x21, 0x78, 0x68, 0xCB, 0x82, 0x6D, 0x25, 0xFE, 0x4F, 0xCD, 0x2A, 0x3F, 0xFD, 0x88, 0xCB,
-    0x2B, 0xD7, 0x9E, 0x8C, 0x68, 0xAF, 0xD8, 0x01, 0xED, 0x6D, 0x0B, 0xB5, 0xA8, 0x37, 0xE0, 0x7E,
-    0x97, 0x7A, 0xDD, 0x6E, 0xE3, 0xE2, 0x75, 0x20, 0xE3, 0xCA, 0xDE, 0x00, 0x58, 0xA9, 0xF0, 0xFF,
-    0x3E, 0xB6, 0x5A, 0xDF, 0x64, 0x5B, 0x30, 0x8F, 0x58, 0xBB, 0x82, 0x64, 0x25, 0x21, 0x85, 0xBD,
-    0xD6, 0x65, 0x44, 0xBB, 0xBD, 0x35, 0x73, 0x8E, 0xF4, 0xD3, 0x82, 0x0C, 0x77, 0xFD, 0x62, 0x9E,
-    0x56, 0x41, 0x17, 0x77, 0x80, 0x6B, 0xF0, 0x54, 0x4B, 0x5B, 0x65, 0x4D, 0xD6, 0xA7, 0x70, 0x5D,
-    0x63, 0x9C, 0xF8, 0xD0, 0x96, 0xE3, 0xF8, 0xB4, 0xCD, 0x8A, 0xC1, 0xC4, 0xB7, 0xC7, 0x22, 0x78,
-    0x64, 0x97, 0x2A, 0x93, 0x6D, 0xB4, 0xD9, 0xC2, 0x63, 0x13, 0xBF, 0xDF, 0xDB, 0xA0, 0xFB, 0x2E,
-    0xF3, 0x14, 0x12, 0x9E, 0x2F, 0x26, 0xD0, 0x2C, 0x90, 0xAD, 0x13, 0xE3, 0x65, 0xD3, 0x8D, 0xCF,
-    0x06, 0xBD, 0x74, 0x17, 0xCD, 0x2B, 0x1F, 0x6E, 0x8F, 0xC5, 0x95, 0x4F, 0x76, 0xC6, 0xE2, 0xF2,
-    0x26, 0x54, 0x52, 0xC5, 0xB5, 0x76, 0x76, 0xAD, 0x9F, 0x19, 0xEB, 0x42, 0x94, 0xFE, 0xD1, 0x0B,
-    0x45, 0xFE, 0xFF, 0x2F, 0xCF, 0x72, 0x35, 0x44, 0x74, 0x75, 0x59, 0x5C, 0x59, 0x32, 0x4A, 0x7B,
-    0x7C, 0x2E, 0x61, 0x5A, 0xAC, 0x48, 0xAF, 0x59, 0x62, 0xD6, 0x25, 0x6D, 0x02, 0xA9, 0x03, 0x13,
-    0x9C, 0x01, 0xB0, 0x8C, 0xCB, 0xA0, 0x7F, 0x1E, 0x9C, 0xC9, 0xFA, 0x4F, 0x38, 0x16, 0xF1, 0xAE,
-    0x96, 0x32, 0x89, 0xCC, 0xD5, 0x5A, 0xE6, 0x34, 0x28, 0x61, 0xCB, 0x6C, 0xB1, 0x16, 0x80, 0xD7,
-    0x49, 0xA2, 0x68, 0xA1, 0x9B, 0xED, 0xCE, 0xFD, 0xB9, 0x3C, 0xBC, 0x78, 0xB2, 0xCE, 0x03, 0x14,
-    0x0B, 0x95, 0x38, 0x47, 0x57, 0x30, 0xC7, 0x15, 0x46, 0x00, 0x3B, 0xF1, 0x90, 0xC8, 0xBB, 0x49,
-    0x53, 0x94, 0x4E, 0xA1, 0x82, 0x5E, 0x19, 0xEB, 0x19, 0x88, 0x82, 0xED, 0x03, 0x18, 0x78, 0x02,
-    0x9C, 0xD2, 0x61, 0xB1, 0xCC, 0x25, 0x1E, 0x25, 0x28, 0x01, 0x31, 0xEF, 0x12, 0x7A, 0x30, 0x97,
-    0x98, 0xFE, 0x37, 0x69, 0xAD, 0x21, 0x5E, 0x43, 0x30, 0x42, 0x21, 0xF7, 0x45, 0x53, 0x3C, 0xB4,
-    0xE5, 0xE2, 0x8F, 0x16, 0xFF, 0x28, 0x63, 0x06, 0x93, 0x9D, 0x7A, 0x57, 0xE6, 0x8B, 0x1E, 0xBD,
-    0xE4, 0x63, 0xB4, 0x75, 0x9E, 0x9A, 0xB5, 0x0F, 0x56, 0xD4, 0xB4, 0x16, 0x78, 0x16, 0xA3, 0xC4,
-    0x08, 0xEE, 0xB9, 0xF7, 0x62, 0x61, 0xCA, 0x5A, 0xC4, 0x82, 0xFA, 0x7C, 0x42, 0x42, 0xE6, 0x9A,
-    0x8D, 0x7B, 0x8F, 0x7A, 0x98, 0xC6, 0xDF, 0x71, 0xD6, 0x1D, 0xEF, 0x67, 0xBB, 0xEF, 0xCA, 0x7B,
-    0x31, 0x25, 0x33, 0x38, 0xCE, 0x07, 0xAB, 0x2B, 0xE2, 0x0E, 0xE1, 0x79, 0x81, 0x7B, 0xEF, 0x00,
-    0xE9, 0x3C, 0x59, 0x68, 0x2A, 0x2E, 0x39, 0x60, 0x79, 0xBF, 0x87, 0xE4, 0x0E, 0x14, 0x57, 0xDE,
-    0x57, 0x6B, 0x2B, 0xA0, 0xD8, 0xC0, 0x72, 0x48, 0x7C, 0xBE, 0xD6, 0xC4, 0x35, 0x0C, 0xAF, 0x09,
-    0x41, 0xC0, 0x63, 0x4B, 0x97, 0x24, 0x38, 0xD6, 0x0A, 0x49, 0xCD, 0x69, 0x89, 0x97, 0x2D, 0xE4,
-    0xFE, 0xF8, 0x0B, 0x42, 0x32, 0xBA, 0x34, 0xBD, 0x08, 0x5C, 0xF6, 0xC0, 0xDA, 0x95, 0x93, 0x42,
-    0x70, 0x29, 0x01, 0x26, 0x6C, 0x17, 0xD0, 0xA9, 0xF4, 0x0A, 0xC1, 0x6A, 0x5C, 0xC7, 0x55, 0x3C,
-    0xCA, 0x52, 0x8D, 0x52, 0x22, 0x03, 0xC5, 0xFD, 0xA3, 0x96, 0xDE, 0xFF, 0xFA, 0x8F, 0xBD, 0xC8,
-    0x2D, 0x6A, 0xA2, 0x3A, 0xDD, 0xB5, 0x92, 0x65, 0x26, 0x20, 0x3A, 0x90, 0x17, 0xFD, 0xE3, 0x15,
-    0xFE, 0x88, 0xF6, 0x91, 0x98, 0xFD, 0x94, 0xE3, 0xE5, 0xCC, 0x70, 0xA7, 0xFB, 0x0F, 0x6E, 0xE5,
-    0xB7, 0x8B, 0x75, 0xD4, 0x04, 0xC2, 0x7A, 0x0A, 0xFA, 0xC8, 0x02, 0xA3, 0x5B, 0x82, 0xCF, 0x81,
-    0xA8, 0x5E, 0x64, 0xEA, 0x35, 0xEE, 0x93, 0x81, 0x93, 0x9A, 0x4B, 0x04, 0xC5, 0xD3, 0x73, 0x11,
-    0xBC, 0x93, 0xD3, 0x0A, 0x48, 0xC7, 0x71, 0x4D, 0x23, 0xC2, 0x4B, 0xFA, 0x8F, 0xDF, 0x7B, 0x97,
-    0xF9, 0x3D, 0xA9, 0xA6, 0x09, 0x77, 0xFF, 0x33, 0xAC, 0x67, 0x52, 0x27, 0x0F, 0x24, 0x71, 0xC5,
-    0x31, 0xC9, 0xDF, 0xC0, 0x54, 0xDF, 0x7B, 0xE0, 0x86, 0x11, 0x8E, 0x5A, 0xFA, 0xF1, 0x08, 0x7E,
-    0xCC, 0xDA, 0xA3, 0x2A, 0xAC, 0xFE, 0xE1, 0x87, 0x10, 0x4D, 0x43, 0x48, 0x1F, 0x8C, 0xD2, 0x9D,
-    0x93, 0x3B, 0xCC, 0xFF, 0xE6, 0x09, 0x7A, 0x0F, 0xC8, 0xEF, 0x8F, 0x69, 0x13, 0xF5, 0x5C, 0xBB,
-    0x1F, 0xB4, 0x2E, 0xE5, 0xC6, 0x0F, 0x44, 0x61, 0xBE, 0xE4, 0x00, 0xFE, 0x98, 0xB9, 0xD5, 0x87,
-    0xBD, 0xFD, 0xFA, 0xC8, 0xBE, 0x68, 0x32, 0xCB, 0x8A, 0x36, 0xD8, 0x1B, 0x23, 0x32, 0x73, 0xD3,
-    0x36, 0x92, 0xEF, 0x3D, 0x6B, 0xDF, 0x90, 0xBC, 0x4F, 0x32, 0x90, 0x6C, 0xE1, 0x98, 0x6D, 0x8B,
-    0xCB, 0x6E, 0xAC, 0x00, 0xDD, 0xF8, 0xA9, 0xD5, 0xB5, 0x5B, 0xCE, 0x3E, 0x4E, 0xEE, 0x58, 0x3B,
-    0x41, 0xF6, 0xDC, 0x81, 0xC2, 0xD9, 0xC2, 0xC8, 0x76, 0xEE, 0xE3, 0x60, 0x5A, 0x3F, 0x59, 0xB8,
-    0xF7, 0x70, 0x2A, 0x3B, 0xD4, 0x36, 0x7B, 0xC2, 0xB4, 0x15, 0x6C, 0xE0, 0x1D, 0x59, 0xDA, 0x7A,
-    0xD6, 0x9E, 0x21, 0x30, 0xE8, 0x92, 0x51, 0xE0, 0x7A, 0xD8, 0x5C, 0x74, 0xAB, 0x91, 0xB3, 0x49,
-    0x61, 0xB4, 0x53, 0xE9, 0x94, 0x10, 0x63, 0xDB, 0xE6, 0x5F, 0x6D, 0xA8, 0xCF, 0xBC, 0xFD, 0xCC,
-    0xAA, 0xBF, 0x8A, 0xA1, 0x05, 0xE2, 0xBB, 0x64, 0x2D, 0x53, 0x3E, 0x2A, 0x04, 0x8E, 0x67, 0x69,
-    0x8B, 0xBE, 0x35, 0x70, 0xA2, 0xE3, 0x1D, 0xEB, 0x60, 0xA6, 0xDE, 0x6A, 0xDD, 0xF8, 0x3A, 0xD7,
-    0x71, 0x07, 0xB3, 0xDC, 0xB0, 0x5C, 0xC6, 0x52, 0xCA, 0x48, 0xA6, 0x12, 0x90, 0xE9, 0xAD, 0x9B,
-    0x56, 0x79, 0xB2, 0x7E, 0xA2, 0x18, 0x2C, 0xC1, 0xF3, 0x82, 0x4D, 0x19, 0x5B, 0x3B, 0x03, 0xC2,
-    0x0E, 0xC9, 0x0D, 0x13, 0xB5, 0x9A, 0x80, 0x1C, 0x86, 0x21, 0xBB, 0x33, 0x1C, 0xD5, 0xCB, 0x67,
-    0xC7, 0x3C, 0x91, 0xF2, 0xE1, 0xEA, 0xFC, 0x2C, 0x87, 0x99, 0x73, 0x5D, 0xAD, 0xAD, 0x23, 0x66,
-    0xAC, 0x06, 0x89, 0x54, 0x32, 0x6A, 0x62, 0xFF, 0x85, 0x2A, 0x6E, 0xFF, 0x4A, 0x6F, 0x4A, 0xAA,
-    0xDB, 0xC8, 0x7A, 0x05, 0xC0, 0xFF, 0xA3, 0x8A, 0xC5, 0x3C, 0x0D, 0xFD, 0xD3, 0x7A, 0xEA, 0x6F,
-    0x94, 0xFA, 0x39, 0xA3, 0x28, 0x5A, 0x92, 0x12, 0x2C, 0x70, 0xBA, 0x1A, 0xFC, 0x35, 0x0C, 0x21,
-    0x8B, 0xB4, 0x7C, 0xA9, 0xCA, 0xC0, 0x88, 0xCE, 0xC8, 0x9A, 0x02, 0x33, 0x85, 0x5A, 0x7C, 0x79,
-    0x31, 0x90, 0xAC, 0x8D, 0x64, 0xBA, 0x18, 0x6A, 0x28, 0x18, 0x0B, 0xF9, 0x41, 0xD4, 0x65, 0xBF,
-    0x1C, 0x5C, 0x52, 0xB5, 0xD4, 0xEC, 0x5A, 0xB9, 0x5F, 0x12, 0x73, 0x56, 0xC2, 0x2E, 0x4C, 0x90,
-    0x4D, 0x77, 0x08, 0xD8, 0xE2, 0x26, 0xA3, 0x7A, 0x96, 0x68, 0xC6, 0x08, 0xA2, 0x48, 0xEB, 0x57,
-    0xB9, 0xE8, 0x89, 0xB5, 0x09, 0xA1, 0xAC, 0xD6, 0x70, 0xD5, 0x61, 0x8B, 0xCE, 0x15, 0x9E, 0xEA,
-    0x79, 0x86, 0x2F, 0x9B, 0xD6, 0x6F, 0x79, 0x89, 0xE9, 0xB1, 0x0B, 0x9A, 0x0B, 0x35, 0x08, 0x55,
-    0xBF, 0xBF, 0xFA, 0xAB, 0x73, 0x87, 0x1E, 0xFE, 0x4D, 0xD6, 0x00, 0x08, 0x5A, 0x28, 0xCE, 0x76,
-    0xB0, 0xF4, 0x8C, 0x9A, 0x5E, 0xEE, 0xBF, 0x48, 0x82, 0xBF, 0xE5, 0x85, 0xBD, 0xEC, 0x0B, 0x97,
-    0xA4, 0x43, 0xA5, 0x50, 0x9D, 0xCC, 0x75, 0x24, 0x2D, 0x03, 0xA3, 0x55, 0xF6, 0x08, 0x57, 0x6D,
-    0x40, 0x8F, 0x31, 0x8B, 0xA8, 0x43, 0x8C, 0x32, 0xBB, 0xB7, 0xF1, 0x68, 0x28, 0xD2, 0x7B, 0x0F,
-    0xA1, 0x10, 0xC3, 0xCF, 0x60, 0x68, 0xEF, 0x82, 0xCD, 0x97, 0x06, 0x8C, 0xB2, 0xC1, 0x28, 0xC5,
-    0x78, 0x91, 0x17, 0x6E, 0x08, 0x9A, 0xD7, 0xB4, 0xEB, 0x94, 0x5E, 0x01, 0x44, 0x87, 0x39, 0xFF,
-    0x24, 0xE1, 0x57, 0x41, 0x99, 0x92, 0x55, 0x9E, 0xC5, 0xB8, 0x64, 0x19, 0x87, 0xD7, 0x74, 0x0B,
-    0x63, 0x23, 0x89, 0xE4, 0xB3, 0x84, 0x3E, 0x8F, 0xA4, 0x62, 0x45, 0xAA, 0x78, 0xC4, 0x0E, 0xDE,
-    0x26, 0xB8, 0x7A, 0x32, 0x4E, 0xCB, 0x49, 0x3D, 0x11, 0x5C, 0xBD, 0xC1, 0xDB, 0x3C, 0xB2, 0x3B,
-    0x3F, 0x12, 0xBE, 0xC2, 0xE4, 0x5A, 0xB7, 0x3A, 0x47, 0x12, 0x24, 0x53, 0x25, 0x52, 0x35, 0xF7,
-    0xB3, 0x23, 0xEC, 0x21, 0x47, 0x9E, 0x71, 0xB5, 0x27, 0x3A, 0xF6, 0x39, 0x62, 0xE9, 0x82, 0x45,
-    0xC2, 0xE7, 0x00, 0x1B, 0x43, 0xD4, 0x33, 0x58, 0x1F, 0xB7, 0xDE, 0x00, 0x44, 0x3C, 0xEE, 0x6D,
-    0x3C, 0xEE, 0xC3, 0x21, 0x72, 0xA9, 0x14, 0xAE, 0x3B, 0x6A, 0xC5, 0x04, 0x9F, 0x1C, 0x5C, 0xDD,
-    0x93, 0x37, 0xAD, 0x9B, 0xEF, 0x3C, 0x57, 0x1E, 0x05, 0x27, 0x1B, 0xA0, 0x9D, 0x6B, 0x11, 0x3D,
-    0x16, 0x7B, 0xC8, 0xFA, 0xBD, 0xD9, 0x92, 0x5B, 0xAE, 0xC2, 0x65, 0x06, 0x52, 0x6A, 0xAA, 0xF4,
-    0xF8, 0x32, 0x9D, 0x09, 0x57, 0x1F, 0xD3, 0x4B, 0xEC, 0x20, 0xB4, 0xB2, 0x9C, 0x83, 0x55, 0x49,
-    0x52, 0x87, 0x7B, 0xF4, 0xD2, 0x88, 0x45, 0xBD, 0xE0, 0x6A, 0x1F, 0xB8, 0x34, 0x62, 0xF3, 0xE8,
-    0xA5, 0x11, 0xD4, 0x1A, 0x4E, 0xAD, 0xCA, 0x24, 0x25, 0x0F, 0x89, 0x55, 0x6E, 0x1D, 0x86, 0x4C,
-    0xDF, 0xF2, 0x00, 0x58, 0xDC, 0xC5, 0x72, 0x65, 0x3C, 0xF8, 0x70, 0xB9, 0x72, 0xC4, 0xBC, 0x9D,
-    0xC3, 0x40, 0xF6, 0xC5, 0x91, 0x84, 0x67, 0x0D, 0xD8, 0x78, 0x62, 0x89, 0x30, 0xE5, 0x32, 0x87,
-    0x57, 0x85, 0x60, 0xD8, 0xE2, 0x7D, 0x77, 0xFB, 0x3E, 0x92, 0xF5, 0xB1, 0x06, 0x1D, 0x66, 0xB6,
-    0xEB, 0x12, 0x2B, 0x95, 0x62, 0xAE, 0x01, 0x2D, 0xA6, 0xB1, 0xE9, 0x0D, 0xF3, 0x25, 0x31, 0x1F,
-    0x59, 0xD8, 0xEE, 0x4A, 0x02, 0x7B, 0xC6, 0x18, 0x3B, 0xF9, 0x09, 0x19, 0xD0, 0x26, 0x6D, 0xC6,
-    0xC9, 0x67, 0x91, 0x34, 0xEA, 0xE0, 0x72, 0x9E, 0x53, 0x58, 0xCB, 0x25, 0xAF, 0x34, 0x38, 0x97,
-    0x69, 0x0E, 0x29, 0xD3, 0x16, 0xF6, 0x93, 0x5F, 0x3D, 0x61, 0x01, 0x61, 0x2F, 0x49, 0x3B, 0x27,
-    0x56, 0x37, 0x7B, 0x0E, 0x03, 0x9A, 0x9A, 0x6F, 0x13, 0xB5, 0xBF, 0x76, 0x11, 0xBB, 0xFC, 0xFD,
-    0xD0, 0x61, 0x58, 0xE6, 0xED, 0x3A, 0x6F, 0xF1, 0x8B, 0x8C, 0x21, 0xB4, 0xA4, 0xE1, 0x6F, 0x1A,
-    0xD1, 0xAF, 0x2D, 0x8B, 0x0A, 0x4C, 0xD2, 0x81, 0x65, 0x2D, 0x6B, 0x80, 0x3F, 0x1A, 0xA0, 0xDA,
-    0xAD, 0x2B, 0x2A, 0x48, 0xC5, 0xE1, 0x6C, 0x5D, 0xB6, 0x29, 0x1E, 0xA6, 0xA2, 0x2B, 0xFE, 0xA0,
-    0x90, 0xC0, 0xCE, 0x56, 0x2A, 0x5B, 0x24, 0xA6, 0x41, 0xED, 0xCC, 0xEA, 0xBA, 0x63, 0xF2, 0x54,
-    0xEF, 0xC7, 0x6F, 0xC9, 0x2A, 0xD9, 0x4C, 0x64, 0x6D, 0x7C, 0xEB, 0xCB, 0x4D, 0xF2, 0xB7, 0xB8,
-    0x0C, 0x25, 0x0B, 0xC1, 0xA8, 0x90, 0x6B, 0x2A, 0x57, 0x5A, 0x5C, 0x51, 0xB0, 0x47, 0xFD, 0x05,
-    0xFC, 0xED, 0x0A, 0xF9, 0x91, 0x93, 0x4E, 0x31, 0x09, 0xA5, 0xC5, 0xBB, 0x0C, 0x67, 0x3F, 0x72,
-    0x92, 0xCC, 0x7E, 0xE4, 0xA4, 0xF8, 0xC3, 0x7E, 0xE4, 0x84, 0xDE, 0x60, 0xBA, 0xEE, 0x16, 0xA8,
-    0xB8, 0x7E, 0x2C, 0x74, 0x5F, 0x69, 0x86, 0x8A, 0x1C, 0x33, 0x54, 0xED, 0xCF, 0xD0, 0xC7, 0x86,
-    0xCA, 0xCF, 0xCD, 0x50, 0x22, 0xD9, 0xBB, 0xD6, 0xE5, 0x53, 0x62, 0x73, 0x70, 0x86, 0x4E, 0xE8,
-    0x56, 0xB2, 0xF8, 0x6E, 0x86, 0xA8, 0x38, 0x89, 0xD6, 0x8F, 0x9D, 0x53, 0x27, 0x72, 0x7F, 0x60,
-    0x2C, 0xC4, 0x82, 0x20, 0x0C, 0x3C, 0xC3, 0x81, 0x6B, 0x95, 0xAE, 0xBF, 0x68, 0x82, 0x4E, 0x95,
-    0xEA, 0x82, 0x92, 0x9F, 0xF2, 0xE0, 0x4B, 0xAA, 0xFC, 0x92, 0x7A, 0x72, 0x45, 0xD3, 0x56, 0xDC,
-    0x83, 0xB3, 0x42, 0x0A, 0x2D, 0x0E, 0x7B, 0xC3, 0x9E, 0xB8, 0x12, 0x33, 0xCA, 0x88, 0x76, 0x81,
-    0xCE, 0x7C, 0xB6, 0x36, 0xDB, 0xFD, 0x26, 0x91, 0x24, 0x7A, 0x23, 0x33, 0xAB, 0x60, 0x71, 0x25,
-    0x92, 0xEE, 0x5B, 0x02, 0xAB, 0xCE, 0x4F, 0x4B, 0x89, 0x31, 0x1E, 0x4C, 0x49, 0xDA, 0x84, 0x78,
-    0x3C, 0xF0, 0x49, 0x8E, 0xF7, 0xC5, 0xD9, 0xA7, 0x5F, 0xF8, 0x27, 0x33, 0xEA, 0x7E, 0xBC, 0x8B,
-    0x6B, 0x42, 0x6B, 0xD0, 0x8D, 0x41, 0x25, 0x09, 0x1A, 0x08, 0x2D, 0x85, 0xBB, 0x58, 0x2F, 0x23,
-    0x6E, 0xAA, 0x24, 0x92, 0x9D, 0x4F, 0x69, 0xA6, 0x6C, 0xC0, 0x14, 0x51, 0x71, 0x8B, 0xA5, 0x92,
-    0x66, 0xB6, 0x32, 0xE6, 0xC7, 0x92, 0x07, 0x17, 0x44, 0x38, 0x55, 0xAE, 0xC9, 0xB7, 0x56, 0x26,
-    0x63, 0xAE, 0xF9, 0x1B, 0x28, 0x3A, 0xC7, 0x04, 0x4F, 0xF6, 0xF3, 0x98, 0x3A, 0xF6, 0x42, 0xF7,
-    0xCD, 0x16, 0x6C, 0x67, 0x67, 0x3A, 0x68, 0xB0, 0xE2, 0x8D, 0x5E, 0x4B, 0xA8, 0x1F, 0x37, 0xFD,
-    0xC7, 0xEA, 0xAD, 0xEF, 0x7B, 0xED, 0x3F, 0x97, 0xD7, 0x9F, 0xE3, 0xE5, 0xB7, 0x7F, 0x11, 0xC2,
-    0xF1, 0x6C, 0xE3, 0xB1, 0xF5, 0xFE, 0x53, 0x2B, 0x75, 0x5E, 0x7C, 0x7D, 0xE3, 0xDF, 0x7D, 0xE1,
-    0x52, 0xFE, 0x52, 0x3D, 0x7B, 0xDD, 0x95, 0xC2, 0x87, 0x20, 0xC2, 0xB3, 0x39, 0xFD, 0xD5, 0x73,
-    0xE2, 0x1E, 0x2E, 0xB0, 0x8A, 0x45, 0x19, 0xAA, 0xA9, 0x78, 0xB6, 0xDB, 0x31, 0x61, 0x99, 0x31,
-    0xFC, 0xCB, 0x84, 0x05, 0xE3, 0x16, 0xAF, 0xF5, 0x6A, 0x32, 0xFF, 0x93, 0xFD, 0x9F, 0xB8, 0xDF,
-    0xAD, 0xDD, 0xFC, 0xCA, 0x7F, 0x6E, 0x99, 0xDC, 0x6C, 0x0D, 0xF6, 0x4B, 0xD5, 0xDC, 0x1A, 0xEC,
-    0x6B, 0x5F, 0xB2, 0x06, 0x9B, 0xD9, 0x30, 0xDA, 0xBC, 0x4A, 0xD6, 0x60, 0xF3, 0x47, 0x00, 0xAE,
-    0x4B, 0x82, 0x39, 0x25, 0x1F, 0xDB, 0x37, 0x1B, 0x91, 0xAC, 0x9E, 0x1C, 0x6E, 0xB8, 0xF2, 0x3B,
-    0xB0, 0x52, 0x97, 0xC7, 0x65, 0x51, 0xF8, 0xC6, 0x63, 0xA2, 0x04, 0xF8, 0x80, 0xD7, 0x23, 0x62,
-    0x56, 0x59, 0x89, 0x37, 0x99, 0x46, 0x9A, 0xA8, 0x2F, 0x54, 0x6C, 0x52, 0x7F, 0xF0, 0xA7, 0x7B,
-    0x8B, 0x9E, 0xAA, 0xD9, 0x3A, 0xA8, 0xE7, 0x79, 0x8A, 0xB8, 0x65, 0x1D, 0x6C, 0x94, 0x91, 0x97,
-    0x86, 0xE7, 0xC3, 0x36, 0xE8, 0xBA, 0xA8, 0x8A, 0xEF, 0x30, 0x01, 0x7D, 0xF9, 0x53, 0x03, 0xE6,
-    0xB0, 0x75, 0xD0, 0xC3, 0x54, 0xC4, 0x8D, 0xFC, 0x78, 0x01, 0xDD, 0x7E, 0x48, 0x4D, 0x51, 0x33,
-    0xE0, 0x25, 0x8B, 0x14, 0xDC, 0xEF, 0x17, 0xF8, 0xF6, 0x4A, 0x3F, 0x4B, 0xF0, 0xB8, 0xF4, 0x8E,
-    0xFC, 0x84, 0x81, 0x5B, 0xFE, 0x26, 0x75, 0x1E, 0x53, 0x28, 0x6D, 0x92, 0x31, 0xB6, 0xA1, 0xD8,
-    0xAA, 0xEC, 0x33, 0xD1, 0x20, 0xEB, 0xD4, 0xF6, 0x70, 0xEB, 0xFF, 0x15, 0xF4, 0x95, 0x94, 0xCF,
-    0xB2, 0x40, 0x91, 0xF5, 0x6A, 0x72, 0x7D, 0x21, 0x4C, 0x9C, 0x4E, 0xEE, 0x6C, 0x52, 0x06, 0x0D,
-    0x57, 0x3B, 0xA9, 0xCC, 0x87, 0xAF, 0xD6, 0x72, 0xD5, 0x8D, 0xD4, 0x8E, 0x4E, 0x1A, 0x99, 0xCA,
-    0x87, 0x1D, 0x4B, 0xAC, 0x4B, 0xCA, 0xC7, 0xD0, 0x9B, 0x61, 0x5F, 0xFC, 0x6F, 0xC6, 0x73, 0x2E,
-    0x0D, 0xAC, 0x52, 0x74, 0x82, 0xA4, 0xD4, 0xFF, 0x03, 0x8D, 0x55, 0x3D, 0x8F, 0xDE, 0x44, 0x10,
-    0x1E, 0xDB, 0xE4, 0x1C, 0xB0, 0x94, 0xA5, 0x89, 0x84, 0x82, 0xC4, 0x42, 0x7B, 0x0A, 0xF1, 0x1F,
-    0x48, 0x58, 0x27, 0x57, 0xA4, 0x00, 0x89, 0x2B, 0x72, 0x55, 0x8A, 0x5C, 0x9D, 0x06, 0x2A, 0xAA,
-    0x23, 0x76, 0x2E, 0x7F, 0xE0, 0x0A, 0x7A, 0xAE, 0xCD, 0x41, 0x07, 0x05, 0x45, 0x0E, 0xFB, 0x82,
-    0x04, 0x65, 0x1C, 0x52, 0x50, 0x50, 0xC4, 0xE2, 0x43, 0x02, 0xA5, 0xC8, 0x42, 0x36, 0xCA, 0x46,
-    0xAC, 0xBD, 0x3C, 0xB3, 0xFB, 0x7E, 0x5C, 0xA2, 0x0B, 0xC4, 0xAF, 0x66, 0xFC, 0x8E, 0x77, 0x77,
-    0x3E, 0x9F, 0x99, 0xAD, 0xBD, 0xFF, 0xC1, 0x7B, 0x57, 0x7B, 0xDF, 0xD5, 0xCB, 0xBF, 0xAD, 0xF7,
-    0x7E, 0x5C, 0x32, 0xC2, 0x93, 0xE3, 0xCF, 0xC4, 0xD2, 0xCF, 0xFC, 0xE5, 0xEA, 0xDE, 0xDE, 0x5E,
-    0x43, 0x34, 0x5F, 0xC0, 0xD3, 0x06, 0xFE, 0x4F, 0xE0, 0x13, 0x2F, 0xEF, 0xED, 0xED, 0xFC, 0xEF,
-    0x06, 0xD9, 0xA9, 0x7C, 0x10, 0x07, 0x36, 0xD3, 0xD7, 0xC8, 0xC9, 0x86, 0x85, 0xDB, 0x36, 0xD7,
-    0xDF, 0x26, 0xAE, 0x6C, 0xAE, 0x15, 0xBD, 0xDC, 0x36, 0xF9, 0xB0, 0x9F, 0xD8, 0xB2, 0x62, 0xE1,
-    0x86, 0x29, 0x86, 0x31, 0xB5, 0xAA, 0xDA, 0x17, 0x5D, 0xB9, 0xA6, 0x8B, 0xDE, 0xA5, 0x46, 0x11,
-    0x0B, 0x17, 0x76, 0x57, 0x1A, 0xC5, 0x7A, 0xEF, 0x30, 0x7B, 0xC4, 0xCC, 0xD1, 0xE2, 0x11, 0xCB,
-    0x8F, 0xC1, 0x78, 0x6D, 0xC5, 0x94, 0xF9, 0xA6, 0x1D, 0x84, 0xCB, 0x3C, 0xB5, 0x83, 0x74, 0xE9,
-    0x1E, 0x36, 0x65, 0xBE, 0xF3, 0x43, 0x69, 0x84, 0xCB, 0xB1, 0x5A, 0xF9, 0x6E, 0x75, 0x87, 0xE4,
-    0x24, 0x47, 0xE1, 0x84, 0x93, 0x56, 0x69, 0xA5, 0xDB, 0xE1, 0x6A, 0x73, 0xE4, 0xD9, 0xDA, 0x2A,
-    0x27, 0x26, 0xD6, 0xB0, 0xCD, 0x4B, 0xF5, 0xC0, 0x67, 0x32, 0x9F, 0xFA, 0x8A, 0x05, 0x09, 0x21,
-    0xDD, 0x4B, 0xD8, 0x44, 0xE1, 0xD7, 0xFC, 0x6D, 0x36, 0xD3, 0xC2, 0x10, 0x9B, 0x8A, 0xC6, 0x32,
-    0x7F, 0xC1, 0x37, 0xF8, 0xDC, 0xAF, 0xEE, 0xAC, 0xEE, 0x1E, 0x69, 0xF4, 0xA5, 0xF4, 0x53, 0xBA,
-    0x8B, 0x64, 0xEB, 0xFF, 0xA6, 0xE2, 0xF1, 0x6E, 0xE1, 0xBD, 0x41, 0x4E, 0x6C, 0x89, 0x84, 0x9C,
-    0xBC, 0xCC, 0xDF, 0x9E, 0x23, 0xC1, 0x34, 0xBC, 0x1C, 0xE5, 0xA0, 0x0C, 0x44, 0x4C, 0x5C, 0xF0,
-    0xD7, 0x97, 0x89, 0x2F, 0x81, 0x90, 0x09, 0xCB, 0x36, 0x6E, 0x55, 0xCF, 0x89, 0x15, 0x6D, 0xF8,
-    0x09, 0xE0, 0x70, 0x70, 0xC4, 0x78, 0xFF, 0xE7, 0x3A, 0x01, 0x68, 0x99, 0xC1, 0x6A, 0x1F, 0x56,
-    0xE7, 0xA2, 0xF4, 0x3D, 0x8A, 0xBB, 0x8D, 0xCA, 0x09, 0xFF, 0xF4, 0x12, 0xC9, 0x8E, 0xA8, 0x26,
-    0x4A, 0x5C, 0x0C, 0x68, 0x26, 0xD2, 0x2D, 0x10, 0xC4, 0x04, 0x62, 0x36, 0xB3, 0x0F, 0xC4, 0xF5,
-    0xE4, 0x67, 0x6C, 0x48, 0xE6, 0x4C, 0xA7, 0xCC, 0xB2, 0x67, 0x98, 0x61, 0x90, 0xDA, 0x82, 0x19,
-    0xC3, 0xC5, 0x2D, 0x99, 0x9C, 0xB3, 0xB1, 0x64, 0xC6, 0x30, 0x9B, 0x02, 0x63, 0x3F, 0xB3, 0x89,
-    0xBC, 0x55, 0xF0, 0x6B, 0x6D, 0xA4, 0x6F, 0xD8, 0xE4, 0xB1, 0xAA, 0xDE, 0xF6, 0xC2, 0x29, 0xED,
-    0xBB, 0x67, 0xFE, 0x1E, 0x5B, 0x4F, 0xD6, 0xCB, 0x5E, 0xE8, 0xC2, 0xA8, 0x41, 0x18, 0x61, 0x67,
-    0x5C, 0x4B, 0x2B, 0x5C, 0xAD, 0x4B, 0x2B, 0xDD, 0xFE, 0xFE, 0x3E, 0x9F, 0x67, 0x25, 0x8E, 0x3E,
-    0xA5, 0x62, 0xC8, 0x3E, 0x20, 0x45, 0x6F, 0x7D, 0x8D, 0x0C, 0x7C, 0x32, 0xC8, 0x2E, 0xB9, 0x57,
-    0x8D, 0x94, 0x39, 0x94, 0x27, 0x1F, 0x38, 0x5C, 0xCE, 0x22, 0x95, 0x08, 0x96, 0xB3, 0x14, 0x2A,
-    0x46, 0x35, 0x52, 0x96, 0x31, 0xEE, 0xCB, 0x83, 0x66, 0x93, 0xA6, 0x37, 0xBE, 0xDF, 0x14, 0xFA,
-    0x8B, 0xD5, 0xAE, 0xDE, 0xFE, 0xF2, 0x01, 0x0E, 0xFE, 0xED, 0x60, 0x7F, 0xAD, 0xF7, 0xB1, 0x23,
-    0x18, 0xEC, 0xBD, 0xD2, 0x87, 0xC1, 0xBE, 0x84, 0x67, 0xDF, 0x0E, 0x4A, 0xBF, 0x08, 0x9E, 0xE1,
-    0x49, 0x8C, 0xE8, 0x6E, 0x65, 0x4E, 0xF6, 0x53, 0x6E, 0xD4, 0x6D, 0x27, 0x86, 0x3A, 0x37, 0x65,
-    0x37, 0x8A, 0xE1, 0x0C, 0x19, 0x31, 0x9B, 0x0B, 0x64, 0x0B, 0x2D, 0xE0, 0x79, 0xD9, 0x95, 0x41,
-    0x3C, 0x53, 0x74, 0xF5, 0x95, 0x41, 0xDD, 0xD1, 0xF2, 0x9E, 0xCD, 0xFF, 0x72, 0xA9, 0xDE, 0x9A,
-    0xE3, 0x44, 0x26, 0xA6, 0xE8, 0xD4, 0x77, 0x4E, 0x0E, 0xE5, 0xDD, 0x49, 0x68, 0xA1, 0xDB, 0xCC,
-    0x66, 0xA6, 0xBC, 0xEE, 0xC8, 0x14, 0xCD, 0x6C, 0x97, 0xA8, 0x42, 0x6C, 0x5E, 0x93, 0xF2, 0xBD,
-    0x34, 0x7E, 0xFB, 0xE6, 0xCA, 0x4D, 0x9E, 0x2D, 0x54, 0x52, 0x9B, 0x8D, 0x42, 0xAB, 0xA6, 0xEE,
-    0x38, 0x1E, 0x54, 0x64, 0xA4, 0xD3, 0x74, 0x9C, 0x68, 0x97, 0xB6, 0x00, 0x8C, 0xB2, 0x2F, 0x6C,
-    0x32, 0x26, 0x3E, 0x1F, 0x4B, 0xA3, 0x7A, 0x55, 0x9D, 0x8E, 0x00, 0x6D, 0xA3, 0x56, 0x5F, 0xC5,
-    0x57, 0xB3, 0x78, 0xE5, 0xFE, 0x3C, 0x42, 0xED, 0x12, 0xDF, 0x6F, 0x5C, 0xC4, 0x6A, 0x6B, 0xD0,
-    0x8F, 0x40, 0xE3, 0x48, 0xB5, 0xE3, 0xBC, 0x9D, 0x87, 0x03, 0x94, 0xF9, 0x9F, 0x80, 0x29, 0x62,
-    0x2C, 0x55, 0x48, 0x7D, 0x0B, 0x14, 0x1B, 0xA9, 0x4B, 0xEF, 0x0A, 0x2B, 0xB5, 0xF0, 0x5A, 0xD8,
-    0x12, 0xAF, 0x1E, 0xB5, 0x37, 0x25, 0x24, 0x77, 0x72, 0xBD, 0xF5, 0xEE, 0xD8, 0xA5, 0x70, 0x60,
-    0x36, 0x0F, 0x1B, 0x56, 0x76, 0xDF, 0x73, 0x1B, 0xF8, 0x1B, 0x1E, 0xB5, 0xF4, 0x3E, 0xC1, 0x9C,
-    0x4D, 0x31, 0xB7, 0x5A, 0x5F, 0x15, 0xDE, 0xE0, 0x7B, 0x07, 0xE0, 0x63, 0x97, 0x5E, 0xF4, 0x53,
-    0x72, 0x29, 0xBC, 0xB2, 0x38, 0xDB, 0xF2, 0xF8, 0x2A, 0x66, 0xAF, 0x31, 0xA6, 0x29, 0xBE, 0x92,
-    0x2A, 0xED, 0x53, 0x93, 0x5A, 0xCE, 0x63, 0xFC, 0xE5, 0xE1, 0x57, 0x84, 0x9F, 0x30, 0xA9, 0xA6,
-    0x8F, 0x0F, 0x77, 0xAA, 0xB0, 0x12, 0x10, 0x2C, 0x9D, 0x72, 0x6A, 0x54, 0x51, 0x45, 0xCA, 0x96,
-    0x90, 0x9E, 0xBC, 0x3B, 0x34, 0x3C, 0x34, 0xB1, 0x97, 0x68, 0x13, 0x1E, 0xB7, 0x83, 0xBA, 0xEF,
-    0xCD, 0x09, 0xF1, 0xC8, 0x92, 0x78, 0xE4, 0x48, 0xFC, 0x72, 0x88, 0x7E, 0x75, 0x24, 0x1F, 0x58,
-    0x74, 0xAE, 0xE6, 0xEE, 0x05, 0x35, 0x24, 0xA1, 0x56, 0x9A, 0x25, 0x95, 0x4C, 0xD5, 0x33, 0xF3,
-    0x22, 0x0E, 0x0D, 0xCE, 0x89, 0x5E, 0x52, 0x6D, 0x22, 0xB5, 0x9C, 0x24, 0x26, 0x47, 0x87, 0x2E,
-    0xAA, 0x53, 0x9F, 0x9D, 0x7A, 0x5F, 0x8B, 0x03, 0x74, 0x31, 0x32, 0x9D, 0xB4, 0xA8, 0x4A, 0xCA,
-    0xB5, 0x3C, 0xFB, 0x36, 0xD1, 0x93, 0xFB, 0x3C, 0x3A, 0x86, 0x68, 0x2D, 0x47, 0x46, 0xC9, 0x3F,
-    0xAC, 0x68, 0xE5, 0xEC, 0x3B, 0x44, 0x5F, 0xDD, 0xD5, 0xD7, 0xA5, 0xFC, 0x7C, 0xEB, 0x3D, 0xDC,
-    0x46, 0x17, 0xFD, 0xE3, 0xB6, 0xCF, 0x47, 0xE9, 0x7F, 0x44, 0x59, 0xB6, 0xCE, 0x3D, 0xF9, 0x43,
-    0xD3, 0x87, 0xF4, 0x5A, 0x9C, 0x65, 0xB3, 0x86, 0x14, 0x48, 0x41, 0xC1, 0x73, 0x4E, 0xC7, 0xBE,
-    0xE3, 0xD1, 0x13, 0xDA, 0x8E, 0x51, 0xC4, 0x83, 0x8A, 0x27, 0x1B, 0xCF, 0x21, 0x1E, 0x6B, 0x3C,
-    0x40, 0x73, 0x13, 0xAB, 0x94, 0xF2, 0xA6, 0x89, 0x91, 0xC5, 0xED, 0x89, 0x4D, 0x0A, 0x9B, 0xCA,
-    0x7E, 0xD6, 0xAF, 0x8B, 0x07, 0x6E, 0x27, 0xC8, 0x50, 0x09, 0x1F, 0x6B, 0x3F, 0x00, 0x1E, 0x06,
-    0x19, 0xD6, 0xEA, 0xE9, 0x15, 0xDD, 0xFE, 0x5E, 0x0F, 0xE7, 0x48, 0x0E, 0x16, 0x27, 0xD7, 0x41,
-    0x4D, 0x68, 0xF2, 0x36, 0x6A, 0x65, 0x37, 0xD8, 0x1D, 0xB6, 0xC6, 0x96, 0x79, 0x1A, 0xB0, 0x37,
-    0x3E, 0x1A, 0x16, 0x9C, 0x60, 0x0D, 0x48, 0x75, 0x88, 0x1E, 0x48, 0x76, 0x30, 0x62, 0x81, 0xDD,
-    0x0E, 0xF5, 0x03, 0x6C, 0x6D, 0x58, 0x25, 0x85, 0x83, 0x6D, 0x17, 0xB0, 0x8F, 0x0B, 0x8D, 0x72,
-    0x1E, 0x6B, 0xD0, 0x2B, 0xFB, 0x18, 0xD5, 0x26, 0x2D, 0x32, 0x71, 0xD4, 0x73, 0x12, 0xB4, 0x01,
-    0x4F, 0xA6, 0x18, 0x6F, 0x61, 0x63, 0x68, 0xA1, 0x6E, 0xD0, 0x00, 0x5B, 0xB8, 0xA4, 0x82, 0x62,
-    0x31, 0x2D, 0x0E, 0xAD, 0x4C, 0x70, 0xB2, 0xC9, 0xB9, 0x17, 0x4E, 0xA4, 0x7C, 0x53, 0x27, 0x56,
-    0x3D, 0xFE, 0x08, 0x48, 0x39, 0x30, 0xD4, 0x56, 0x89, 0x3B, 0xCE, 0xBA, 0x42, 0x30, 0x5D, 0xCA,
-    0x49, 0x8C, 0x42, 0xD9, 0xB1, 0x05, 0x10, 0xE7, 0xB0, 0x6E, 0x58, 0x90, 0x9A, 0x7D, 0x7C, 0x73,
-    0xE2, 0x2C, 0x08, 0xD8, 0xAA, 0x9B, 0x04, 0xF5, 0xCE, 0x6D, 0xA8, 0x38, 0x0B, 0x15, 0xA5, 0x51,
-    0xC8, 0x1B, 0xF6, 0x83, 0x5E, 0xA1, 0x32, 0x04, 0x93, 0x56, 0x2F, 0x0A, 0x88, 0x5B, 0x0C, 0x1D,
-    0x55, 0x06, 0xE7, 0xB3, 0x31, 0x34, 0x14, 0x52, 0x84, 0x71, 0xC0, 0x99, 0xC1, 0x28, 0xA8, 0x39,
-    0xA3, 0x7C, 0xD7, 0xA1, 0x41, 0xE3, 0x91, 0x1D, 0x8E, 0xE7, 0x5D, 0x89, 0x38, 0x8A, 0x87, 0x40,
-    0x64, 0xE6, 0xC7, 0xCB, 0x8E, 0xE7, 0x54, 0x5B, 0xA9, 0x4D, 0xD4, 0x05, 0x97, 0x59, 0xE6, 0xF8,
-    0x1A, 0xF3, 0xC9, 0xC8, 0x21, 0xA1, 0x80, 0x98, 0x8A, 0x3D, 0xDC, 0x2C, 0x0C, 0x7A, 0x18, 0xD1,
-    0x41, 0x6B, 0x4B, 0x6A, 0xC2, 0x1A, 0xFE, 0x09, 0x9D, 0x63, 0xDB, 0xAD, 0x84, 0x6B, 0x11, 0x0A,
-    0x53, 0x71, 0x95, 0x48, 0xFC, 0x76, 0xB4, 0xDB, 0xD9, 0x98, 0xF0, 0x5C, 0x69, 0xB0, 0xBD, 0xD5,
-    0xAA, 0xA7, 0xD2, 0x09, 0xCE, 0x05, 0x9C, 0xCD, 0x78, 0x94, 0x27, 0x0C, 0xFB, 0xC5, 0xF3, 0x2A,
-    0xEB, 0xD0, 0xF3, 0x7B, 0x83, 0x0B, 0xC2, 0x88, 0x0E, 0xC8, 0x8D, 0x92, 0x89, 0xD2, 0x06, 0xFC,
-    0xC9, 0x31, 0x3B, 0x00, 0x10, 0x78, 0xDF, 0x76, 0x2D, 0x94, 0x21, 0xDF, 0xB8, 0x0F, 0x38, 0x70,
-    0xBE, 0x7D, 0xB8, 0x2E, 0x14, 0xA5, 0x6A, 0x2E, 0xB1, 0x2A, 0x86, 0x4C, 0xB2, 0xB8, 0x90, 0x54,
-    0xA7, 0xBA, 0x64, 0x42, 0x28, 0x85, 0xCE, 0xB9, 0x6E, 0x88, 0x04, 0xF7, 0x65, 0x5F, 0x98, 0x64,
-    0x23, 0x54, 0x31, 0xB4, 0x45, 0x1E, 0x2E, 0xB2, 0x7E, 0x2E, 0xB9, 0xD9, 0x08, 0x08, 0x52, 0x98,
-    0x74, 0xC1, 0x3D, 0x3B, 0x9B, 0x46, 0x71, 0x5C, 0xFC, 0x0B, 0x25, 0x91, 0x31, 0x6F, 0xD4, 0x30,
-    0x18, 0x86, 0xDF, 0x8B, 0xD5, 0x5A, 0x22, 0xA2, 0x66, 0x46, 0xF4, 0xFC, 0x07, 0xAE, 0x64, 0x61,
-    0xB8, 0xE1, 0x8E, 0xA4, 0xEA, 0xD8, 0x05, 0x21, 0x55, 0x42, 0xFC, 0x83, 0x2E, 0xB0, 0x9E, 0xC4,
-    0xA1, 0x98, 0xFE, 0x01, 0x2A, 0x7E, 0x00, 0x62, 0x60, 0xA2, 0x43, 0x19, 0x3A, 0x1C, 0x52, 0x5B,
-    0x87, 0x09, 0xA1, 0x4A, 0x10, 0xB1, 0x30, 0xA0, 0x93, 0x42, 0x61, 0x45, 0x67, 0x71, 0x16, 0x35,
-    0xC8, 0xC9, 0x87, 0x93, 0xF3, 0xF2, 0xDA, 0xAF, 0x3F, 0xBF, 0x9F, 0xFD, 0x98, 0x57, 0xFD, 0xE1,
-    0xE0, 0xD6, 0x78, 0x7E, 0x77, 0x3E, 0x9E, 0x8F, 0xC7, 0x89, 0x17, 0x2E, 0x3A, 0xC4, 0x0D, 0x9C,
-    0xF4, 0x2C, 0x9B, 0x6D, 0x0C, 0x6F, 0x9F, 0xA5, 0x0D, 0xA6, 0x98, 0x3E, 0x7C, 0x41, 0x17, 0x18,
-    0x40, 0x1F, 0x1C, 0x15, 0xF1, 0x83, 0xB1, 0x5E, 0xD2, 0xB3, 0x7B, 0x58, 0x7F, 0xA5, 0x3F, 0x64,
-    0x5B, 0x87, 0xB4, 0xBC, 0x5C, 0xB0, 0xB3, 0x7E, 0x6E, 0x1F, 0x65, 0x60, 0xF4, 0xEF, 0x58, 0xF5,
-    0x61, 0x59, 0x21, 0x71, 0xCA, 0x8C, 0x50, 0xFB, 0x00, 0xA2, 0xA6, 0xF7, 0xA5, 0x9C, 0x9C, 0xC4,
-    0x9E, 0x2D, 0x76, 0x0A, 0x63, 0xA7, 0x49, 0x13, 0x35, 0xC1, 0xEE, 0x65, 0xC2, 0x0D, 0x36, 0xEF,
-    0x88, 0xA1, 0x48, 0x88, 0x13, 0x36, 0x92, 0x3A, 0xB1, 0xE8, 0x46, 0x9A, 0xFC, 0x04, 0x91, 0xE3,
-    0x44, 0x56, 0xFE, 0x95, 0x26, 0x57, 0xF2, 0xBD, 0x47, 0x1A, 0x1B, 0xD4, 0x49, 0xC1, 0xAC, 0x86,
-    0xFC, 0x51, 0x23, 0x7F, 0x6E, 0xA3, 0x26, 0x2D, 0x63, 0x47, 0x2A, 0x59, 0x36, 0xA0, 0xCF, 0x8E,
-    0x91, 0x2C, 0x2E, 0x2F, 0xD8, 0xD3, 0x4F, 0x57, 0x4F, 0xE6, 0x8B, 0xDD, 0xE3, 0x3A, 0x35, 0x39,
-    0xAE, 0xC1, 0x73, 0xC3, 0x0A, 0x81, 0x11, 0x82, 0xD0, 0x15, 0x95, 0xC0, 0xCD, 0x03, 0xFA, 0x18,
-    0x67, 0x7D, 0xCC, 0x78, 0x71, 0x2E, 0x2A, 0x4D, 0x64, 0x80, 0xB5, 0x6D, 0x2A, 0x78, 0xB6, 0x29,
-    0xCD, 0xE3, 0x92, 0xBF, 0x3C, 0xD7, 0x7F, 0x48, 0xA1, 0x8A, 0x0C, 0x37, 0xD7, 0xCD, 0xC8, 0xBC,
-    0x73, 0xE4, 0xF7, 0x2C, 0x0C, 0xCC, 0xDE, 0xFD, 0x0E, 0x02, 0xB5, 0x10, 0xF6, 0x4F, 0xE9, 0x77,
-    0x83, 0xF5, 0xD7, 0xFA, 0x6B, 0x87, 0xE0, 0xFB, 0x82, 0xFD, 0x12, 0xB9, 0xCB, 0xD5, 0x9B, 0x23,
-    0x32, 0x5C, 0x6D, 0xB5, 0x08, 0x12, 0x78, 0x56, 0x49, 0x05, 0x70, 0xC7, 0xBE, 0x6D, 0x97, 0xD5,
-    0x64, 0x16, 0x10, 0xD0, 0x4E, 0xD9, 0x22, 0xA0, 0x0E, 0xC1, 0x1A, 0x52, 0xF3, 0x76, 0x52, 0x8D,
-    0xAA, 0x51, 0xEE, 0xA5, 0xC7, 0x48, 0x5B, 0x5D, 0x05, 0x9B, 0x57, 0x48, 0x55, 0xE4, 0x21, 0x4B,
-    0x10, 0xB8, 0x45, 0x5A, 0xF4, 0x1A, 0x84, 0xE7, 0x07, 0xAD, 0x57, 0x1A, 0x7C, 0xE6, 0x20, 0x2A,
-    0xE4, 0x2A, 0x6C, 0xF1, 0x6E, 0xBA, 0x72, 0x43, 0x81, 0x83, 0x5C, 0xD5, 0xA8, 0x5E, 0x30, 0xC2,
-    0x49, 0x0F, 0xE1, 0x10, 0xE0, 0xA6, 0x06, 0x3A, 0x00, 0x40, 0x92, 0x41, 0x03, 0x0D, 0xA2, 0x1A,
-    0xCC, 0x23, 0xB6, 0x10, 0x06, 0x49, 0x11, 0x7A, 0x86, 0x80, 0xD0, 0x96, 0x77, 0x46, 0x17, 0x17,
-    0x56, 0x71, 0xB7, 0xA7, 0xDB, 0xCA, 0xCE, 0x6D, 0xAF, 0xE2, 0x90, 0x96, 0x21, 0x3B, 0xA4, 0xE6,
-    0x65, 0xD4, 0x69, 0xC0, 0xD7, 0x84, 0xFC, 0x88, 0xB2, 0xF6, 0x03, 0xFF, 0x03, 0x6D, 0x56, 0xBF,
-    0x6F, 0xDE, 0x54, 0x14, 0xBD, 0xB6, 0xA1, 0x96, 0xF8, 0x06, 0x33, 0x94, 0x01, 0x22, 0xE4, 0x15,
-    0xBA, 0x78, 0x47, 0x22, 0xCF, 0x88, 0x91, 0x21, 0x48, 0x90, 0x25, 0x0C, 0x88, 0x8D, 0x5F, 0x52,
-    0xFE, 0x01, 0x8A, 0x0D, 0x8C, 0x1D, 0xDA, 0x81, 0x89, 0x25, 0x1D, 0x90, 0xA0, 0x61, 0x28, 0x03,
-    0x03, 0x43, 0xA8, 0x5F, 0x92, 0x81, 0xA1, 0x43, 0x2C, 0xA1, 0xB2, 0x30, 0xC4, 0xD0, 0x4A, 0x2D,
-    0x74, 0xC8, 0x23, 0x75, 0xA8, 0x93, 0xD8, 0xBE, 0x9C, 0xF3, 0xFC, 0x7D, 0xA1, 0x15, 0xB5, 0xE4,
-    0x9B, 0xF7, 0xF9, 0xDD, 0x77, 0x7F, 0x9D, 0x73, 0xEF, 0x8B, 0x48, 0xBC, 0xD3, 0x88, 0x6C, 0x2D,
-    0x8B, 0x24, 0x3F, 0xD7, 0x22, 0xDD, 0x27, 0x22, 0xE9, 0x1B, 0x56, 0x02, 0xD7, 0x8B, 0x14, 0xFB,
-    0xB5, 0x14, 0x3A, 0x4A, 0xA6, 0x5A, 0xCF, 0x54, 0xFB, 0x50, 0xB5, 0xB2, 0x46, 0x77, 0xEF, 0xCC,
-    0xB4, 0xBF, 0x28, 0xBA, 0x7F, 0xC9, 0xA6, 0x7D, 0xB7, 0x15, 0xEA, 0xC6, 0x8A, 0x35, 0xFF, 0xB8,
-    0x2E, 0xD2, 0x22, 0xCD, 0xCD, 0xC3, 0xDF, 0x5D, 0xA4, 0x63, 0x26, 0x46, 0x7F, 0x71, 0xA1, 0x8E,
-    0xC5, 0x56, 0xA2, 0xAA, 0x16, 0x6F, 0x1F, 0x73, 0x01, 0x5B, 0xBD, 0x54, 0x58, 0x84, 0x5C, 0x98,
-    0x34, 0x97, 0xE8, 0x0F, 0x27, 0x72, 0xD1, 0x88, 0xC4, 0xBB, 0x88, 0xE4, 0xFD, 0x97, 0x65, 0xFE,
-    0x9C, 0xD3, 0x63, 0xC1, 0x91, 0x06, 0x8A, 0x83, 0x3F, 0x91, 0xE9, 0x49, 0x1F, 0x29, 0x82, 0xAC,
-    0x70, 0x20, 0x41, 0x7C, 0x81, 0x5A, 0x91, 0xAC, 0x13, 0x09, 0x35, 0xBF, 0xB1, 0x65, 0xDA, 0x99,
-    0xEE, 0x6A, 0x5E, 0xDD, 0x33, 0xFD, 0xAC, 0x81, 0xDE, 0x16, 0xE2, 0xDE, 0xFF, 0x75, 0x9B, 0x9E,
-    0x7D, 0x08, 0xC5, 0x94, 0x81, 0x5A, 0xA6, 0x22, 0x4B, 0xCA, 0xC3, 0x8B, 0xA7, 0xAA, 0x61, 0x43,
-    0x73, 0xBC, 0xAD, 0x0C, 0x32, 0xCA, 0x32, 0x8D, 0xAB, 0x22, 0x7B, 0xB5, 0xA9, 0xAA, 0x93, 0x14,
-    0xCA, 0x11, 0xDC, 0x1A, 0x04, 0x04, 0x6B, 0x5D, 0xF8, 0xDD, 0x78, 0x4D, 0xA0, 0x88, 0x2F, 0x25,
-    0x62, 0x40, 0xE0, 0x55, 0x8B, 0x57, 0x4F, 0x72, 0x26, 0x08, 0x0F, 0xFA, 0xF9, 0xE6, 0xE6, 0xE6,
-    0x55, 0xDA, 0x8E, 0x10, 0x69, 0xDA, 0x4A, 0x82, 0xD3, 0x85, 0x93, 0xA2, 0x84, 0xE5, 0x3A, 0xC0,
-    0xC9, 0x99, 0xDA, 0x18, 0xB1, 0x67, 0x9A, 0xFB, 0xE3, 0x2A, 0x15, 0x6A, 0xA1, 0x43, 0x38, 0x20,
-    0x39, 0x84, 0xDC, 0xD2, 0x59, 0x6B, 0xEA, 0x48, 0xFD, 0xB3, 0x37, 0xFD, 0xB9, 0x70, 0x7D, 0xAC,
-    0x0E, 0x4E, 0xBE, 0x86, 0x25, 0x2D, 0x80, 0x92, 0xEE, 0x20, 0x48, 0x58, 0x8A, 0x91, 0x91, 0x64,
-    0xC8, 0xD3, 0xB1, 0x3A, 0x29, 0x52, 0x8B, 0x14, 0x48, 0xD1, 0x92, 0x54, 0xD8, 0x32, 0xBD, 0x68,
-    0x33, 0xCF, 0x15, 0x06, 0x4B, 0x9F, 0x08, 0xDD, 0xA1, 0xB4, 0x62, 0x6C, 0xEA, 0x26, 0x2F, 0x86,
-    0xC2, 0x21, 0x60, 0xD8, 0x36, 0xB7, 0xAE, 0x77, 0x54, 0x80, 0x5A, 0xC1, 0x0A, 0xC4, 0xAC, 0x1A,
-    0x97, 0x00, 0x4A, 0xC7, 0x1C, 0x7E, 0x58, 0xBF, 0x59, 0x3F, 0x2F, 0x1F, 0x96, 0x03, 0x97, 0xC4,
-    0x47, 0x92, 0x69, 0x49, 0x8F, 0x89, 0xAF, 0x11, 0xF5, 0xF1, 0x81, 0x8E, 0x69, 0x93, 0xBF, 0x12,
-    0x6B, 0xF8, 0xCD, 0xC8, 0x16, 0xFF, 0xF4, 0xA1, 0xE3, 0x96, 0x9B, 0x59, 0x29, 0x9A, 0xC4, 0x16,
-    0xF0, 0x51, 0x1B, 0x12, 0xE4, 0x1D, 0x9C, 0xAA, 0xA5, 0xA5, 0x4F, 0x89, 0x6A, 0x49, 0xF1, 0x6D,
-    0xD6, 0x48, 0x71, 0xDA, 0x81, 0x01, 0x81, 0xC6, 0x40, 0x66, 0x88, 0xBB, 0xA4, 0x86, 0xCB, 0xAC,
-    0x01, 0x14, 0x61, 0x57, 0x95, 0x2A, 0x4F, 0xC5, 0x87, 0x23, 0xB2, 0xF8, 0x21, 0xBB, 0xD9, 0x25,
-    0x2D, 0x02, 0xC7, 0x56, 0x83, 0x62, 0xEA, 0xB6, 0x96, 0xAA, 0x9F, 0xAD, 0x06, 0xAB, 0xB2, 0x7E,
-    0x67, 0x01, 0x7D, 0x8C, 0x28, 0xFB, 0xA0, 0x63, 0x24, 0x05, 0x80, 0x2A, 0x13, 0x8B, 0x4F, 0x80,
-    0x3A, 0x24, 0x13, 0x10, 0x9C, 0x79, 0xCD, 0x99, 0x39, 0x06, 0x7C, 0xFE, 0xD2, 0xEA, 0x74, 0xBC,
-    0x9A, 0xDC, 0xEC, 0x3F, 0x95, 0xE8, 0x81, 0xAE, 0xE7, 0x32, 0xE8, 0xFD, 0x9A, 0xD5, 0x74, 0xA8,
-    0x35, 0x4A, 0x1D, 0xEA, 0x6F, 0xA8, 0x50, 0x75, 0x88, 0x54, 0xD3, 0xBE, 0x68, 0x24, 0x1E, 0x89,
-    0xA4, 0x7E, 0xC1, 0x3A, 0xD7, 0x15, 0xD2, 0x76, 0xA0, 0xD2, 0x2B, 0x5F, 0x8A, 0x47, 0xD7, 0xC3,
-    0x20, 0x06, 0xA2, 0x2C, 0x4C, 0x9D, 0xD6, 0x85, 0x81, 0x6F, 0x88, 0xC8, 0x15, 0xCB, 0xCF, 0xBF,
-    0x0E, 0x91, 0xEE, 0x3E, 0x2E, 0x76, 0xBE, 0xAF, 0x96, 0x11, 0x20, 0x44, 0x43, 0xD1, 0x89, 0x2E,
-    0xC7, 0x7A, 0xA0, 0xCB, 0xE4, 0xF5, 0x79, 0xF6, 0x29, 0xEC, 0xAE, 0xDD, 0x80, 0x38, 0x8F, 0x97,
-    0x25, 0x0D, 0xDE, 0xBD, 0x45, 0x8A, 0x0D, 0x24, 0x58, 0x3B, 0x51, 0x38, 0xDB, 0xB0, 0x04, 0x93,
-    0xBE, 0x11, 0x6E, 0x9B, 0x21, 0xF0, 0xD2, 0x58, 0x79, 0x95, 0x6C, 0x6E, 0x23, 0x60, 0xDE, 0xC0,
-    0x78, 0x42, 0xAC, 0x52, 0x6A, 0x65, 0x84, 0x7D, 0xE9, 0xB6, 0xF3, 0xC5, 0x7A, 0x7A, 0x75, 0x75,
-    0x95, 0x1C, 0xE8, 0xD9, 0x1D, 0x6E, 0x5E, 0xC1, 0xA0, 0xEA, 0xD8, 0x2D, 0xAC, 0xC2, 0x00, 0x2E,
-    0x82, 0x7C, 0xC4, 0x39, 0x3D, 0xCA, 0x85, 0x94, 0x49, 0xA7, 0x16, 0xA6, 0x25, 0x10, 0x26, 0x24,
-    0x5F, 0x32, 0xAA, 0x40, 0x97, 0x9D, 0x85, 0xD2, 0xBE, 0x09, 0x65, 0x37, 0xE7, 0x4B, 0x42, 0x3B,
-    0x15, 0xF6, 0x22, 0x2E, 0x66, 0x0C, 0xFC, 0xDC, 0xD4, 0xA8, 0xF0, 0xBC, 0xFA, 0x16, 0x11, 0xD8,
-    0xA7, 0x40, 0x0C, 0x3A, 0x70, 0x81, 0xC6, 0x6A, 0x9F, 0x45, 0x2E, 0xF7, 0x2D, 0xF9, 0x45, 0x6E,
-    0x12, 0x03, 0x1F, 0x7C, 0x43, 0xBA, 0xA2, 0xDD, 0xEE, 0x8E, 0x1F, 0xD3, 0xB0, 0xEF, 0x5E, 0x0B,
-    0x9B, 0x23, 0xA3, 0xCD, 0xA1, 0x09, 0xD0, 0xBD, 0xD6, 0x7B, 0xF4, 0x10, 0xB3, 0x76, 0x69, 0x7F,
-    0x36, 0x12, 0xE6, 0x34, 0xF5, 0xAC, 0x27, 0x4C, 0x96, 0xD8, 0x65, 0x3D, 0x8B, 0xAC, 0x3E, 0x47,
-    0x49, 0x7C, 0x5E, 0x54, 0x48, 0x8E, 0x3E, 0x1A, 0x65, 0xDE, 0x2C, 0x81, 0xDF, 0xF5, 0x93, 0x83,
-    0xE6, 0x27, 0xD3, 0xE4, 0x7F, 0xA8, 0xD3, 0xA8, 0xF1, 0xD9, 0x64, 0xAD, 0x9C, 0xB5, 0x4C, 0xA4,
-    0xF9, 0x59, 0xE7, 0x88, 0xE9, 0x64, 0xD1, 0x35, 0x8B, 0x27, 0xE1, 0x46, 0xE4, 0x0F, 0x78, 0x7D,
-    0x33, 0xB5, 0x0F, 0xC4, 0xBA, 0xDE, 0x63, 0xB2, 0x5A, 0xD2, 0x75, 0x43, 0x81, 0x09, 0x77, 0xDA,
-    0xAE, 0x89, 0xFA, 0xF1, 0xED, 0x0C, 0xC7, 0x23, 0x34, 0x67, 0x03, 0x09, 0xAD, 0x82, 0x8F, 0xCA,
-    0xB6, 0x33, 0x2E, 0xD1, 0x3F, 0x57, 0x30, 0x4C, 0xF5, 0x81, 0x12, 0x09, 0xF4, 0x5A, 0xA5, 0xD7,
-    0xFB, 0xC4, 0xEA, 0x37, 0xBA, 0xEB, 0x0C, 0xA6, 0xF5, 0x50, 0x39, 0x26, 0xDA, 0x7B, 0xE6, 0x33,
-    0x7D, 0x3F, 0xB0, 0x3D, 0x24, 0xC7, 0xAC, 0x53, 0x39, 0xEF, 0x1C, 0x09, 0x7C, 0xBC, 0x1F, 0x50,
-    0xBC, 0xE0, 0x1B, 0x3E, 0x9E, 0xBA, 0x9C, 0xC8, 0x88, 0xBC, 0x18, 0x4F, 0x49, 0x1B, 0x9F, 0x5B,
-    0xEC, 0x75, 0xC1, 0xB3, 0xA9, 0x9F, 0x86, 0xA9, 0xA3, 0x0A, 0x2F, 0xEB, 0x45, 0xD1, 0xFF, 0xB7,
-    0x81, 0x82, 0xBD, 0x04, 0x8F, 0x5D, 0xE0, 0xE7, 0xA3, 0xA7, 0x5D, 0xA5, 0x13, 0xD4, 0xDE, 0xD5,
-    0x92, 0x8F, 0x68, 0xFE, 0x3C, 0x53, 0x7A, 0x8E, 0xF7, 0x80, 0x01, 0xE8, 0x0C, 0x1C, 0xEA, 0x3A,
-    0x94, 0x95, 0x11, 0xB3, 0x67, 0x93, 0xDB, 0x2E, 0xEA, 0x30, 0x08, 0xA7, 0x1F, 0xA7, 0x2D, 0x90,
-    0x2A, 0x8D, 0x76, 0x04, 0x7A, 0x09, 0x00, 0xFD, 0x84, 0x62, 0xE5, 0x1F, 0x62, 0x6A, 0x5F, 0xF3,
-    0x7E, 0xE5, 0xF1, 0xE7, 0x02, 0x36, 0xBE, 0x65, 0x1D, 0x86, 0xFF, 0x04, 0xB2, 0xF4, 0x14, 0x79,
-    0x92, 0x28, 0x1F, 0x15, 0xC1, 0x13, 0x85, 0x9D, 0x04, 0x92, 0x39, 0x50, 0x3D, 0x25, 0x8F, 0x80,
-    0x7A, 0xCA, 0xFB, 0xE6, 0xE1, 0x54, 0x03, 0x70, 0x25, 0xE3, 0xCD, 0x8B, 0x4C, 0x3A, 0xA8, 0x95,
-    0x6C, 0x13, 0x5E, 0x0F, 0xA8, 0x08, 0xBB, 0x96, 0x4D, 0x52, 0x02, 0x6A, 0x79, 0xEE, 0x6D, 0x09,
-    0x7F, 0x14, 0x7F, 0xC3, 0x98, 0xED, 0x5A, 0xB4, 0xCA, 0x71, 0x8F, 0x80, 0x1C, 0x2D, 0xC1, 0xCA,
-    0x34, 0xCD, 0xD1, 0x50, 0xC1, 0x8A, 0xB6, 0xE7, 0x54, 0xBF, 0x5A, 0xD7, 0x2B, 0x55, 0xD5, 0xC7,
-    0x27, 0x77, 0x5D, 0x65, 0x93, 0x03, 0x4C, 0x7A, 0xB5, 0x01, 0xA0, 0x8A, 0x8F, 0x1F, 0x4D, 0xD6,
-    0x2C, 0x08, 0x47, 0xAA, 0xC5, 0x9E, 0xDA, 0xC3, 0x04, 0x29, 0x48, 0x61, 0x23, 0x3D, 0xC5, 0x60,
-    0x3E, 0x58, 0xAF, 0xA3, 0x93, 0x6E, 0x90, 0x62, 0xFD, 0x72, 0x13, 0x1F, 0x76, 0xA3, 0x14, 0xE9,
-    0xA5, 0x26, 0xFA, 0xBB, 0xBB, 0x81, 0x4B, 0xFD, 0x32, 0x17, 0xE3, 0xB4, 0x38, 0xEA, 0x07, 0x31,
-    0x1B, 0x7B, 0x75, 0x74, 0xDC, 0x0F, 0x0B, 0xFB, 0x4A, 0xA6, 0xF8, 0x1B, 0x28, 0xA1, 0xD1, 0x08,
-    0xE3, 0x44, 0xD8, 0x50, 0x18, 0x21, 0x16, 0x13, 0x28, 0x71, 0xF8, 0x1D, 0x0D, 0x6B, 0x9C, 0xD6,
-    0xCA, 0x7B, 0x00, 0xA0, 0x27, 0x3A, 0x0D, 0x0B, 0xA4, 0x0B, 0x71, 0xC5, 0x17, 0x21, 0xD4, 0xF9,
-    0x3F, 0x13, 0xEA, 0xBB, 0xD2, 0xCE, 0x7B, 0xC8, 0xB4, 0x8B, 0x0E, 0x62, 0x7D, 0xE4, 0x5F, 0x8D,
-    0x54, 0x31, 0x6F, 0xD6, 0x30, 0x10, 0xBD, 0xC4, 0xA8, 0x41, 0x04, 0x64, 0x24, 0x60, 0x60, 0x80,
-    0xEC, 0x48, 0x28, 0xFC, 0x81, 0xD6, 0x91, 0x18, 0x18, 0xE9, 0x40, 0x67, 0xFA, 0x33, 0xD8, 0x12,
-    0xD4, 0x9D, 0xB0, 0xB0, 0x33, 0x56, 0x61, 0x28, 0x7F, 0xA0, 0x4D, 0x68, 0x47, 0x06, 0x5C, 0x18,
-    0xBB, 0x7C, 0xA2, 0x03, 0x12, 0x1D, 0x12, 0x89, 0x48, 0xB5, 0xC0, 0xC9, 0xF1, 0x2E, 0xE9, 0xD7,
-    0x56, 0x48, 0x48, 0xB5, 0x74, 0xFE, 0xEE, 0xB3, 0xCF, 0xE7, 0xF7, 0xDE, 0x9D, 0x43, 0x41, 0x41,
-    0x14, 0x38, 0x22, 0xE2, 0xA5, 0x65, 0x44, 0x75, 0x31, 0x5B, 0xCE, 0xCC, 0x62, 0x5F, 0x60, 0x1D,
-    0xBF, 0xDB, 0x78, 0xA1, 0xBB, 0xB3, 0xA8, 0x04, 0x4E, 0x30, 0xC2, 0x49, 0x11, 0x1E, 0xC2, 0x2E,
-    0x46, 0xB0, 0x38, 0xDB, 0x0F, 0x19, 0x53, 0x8A, 0x49, 0x31, 0xF7, 0x64, 0xDA, 0xB6, 0x8F, 0x46,
-    0xF3, 0xD2, 0xA5, 0x76, 0xD0, 0xF6, 0xB1, 0xEA, 0x6F, 0x11, 0x69, 0x8B, 0x50, 0x23, 0xA7, 0x07,
-    0x98, 0xEA, 0xE9, 0xDF, 0xA5, 0x79, 0x6C, 0xC2, 0xD6, 0xE4, 0x2E, 0xEC, 0x29, 0x59, 0x36, 0x0D,
-    0x1C, 0x0F, 0x27, 0xDF, 0x07, 0x32, 0x57, 0x63, 0xDA, 0x81, 0x7D, 0xDA, 0xD8, 0xC8, 0x11, 0x62,
-    0xEC, 0x1C, 0x9A, 0x02, 0x48, 0x02, 0x53, 0x02, 0xFA, 0xC9, 0x32, 0xD9, 0x7F, 0x6E, 0x5A, 0x2E,
-    0x85, 0x8D, 0xC9, 0xDE, 0x4E, 0x10, 0xF3, 0x6F, 0x3D, 0x17, 0x79, 0xDB, 0x3A, 0x32, 0x0C, 0x51,
-    0x0C, 0x38, 0x80, 0x8D, 0xC0, 0x90, 0x7C, 0x0F, 0x25, 0xD7, 0x6D, 0xA1, 0x4B, 0xD7, 0x71, 0xDA,
-    0xEA, 0x82, 0x42, 0x87, 0x24, 0xA1, 0x47, 0xCE, 0xC0, 0x53, 0xD4, 0x61, 0xA2, 0x9C, 0x78, 0x92,
-    0x0E, 0x63, 0xD0, 0xBF, 0xAB, 0x8A, 0x65, 0xB1, 0xA6, 0xB4, 0xA1, 0x3C, 0x9B, 0x22, 0xC9, 0x14,
-    0xA6, 0xC0, 0xF1, 0x18, 0x8C, 0xD6, 0x49, 0x6A, 0x01, 0x8B, 0x44, 0x37, 0x04, 0x32, 0x8B, 0x74,
-    0x56, 0x9F, 0x1E, 0xF5, 0xE9, 0xD6, 0xA1, 0xBB, 0xA1, 0xEC, 0x26, 0x42, 0xE9, 0xB2, 0x69, 0x65,
-    0x3F, 0xA6, 0x07, 0x5F, 0x9D, 0x3E, 0x6D, 0xBB, 0x90, 0xB9, 0xA1, 0x1A, 0x08, 0x13, 0xD4, 0x33,
-    0x92, 0x2A, 0x08, 0xB9, 0x7B, 0x05, 0xE0, 0x07, 0xCC, 0x3E, 0x62, 0x7E, 0x9F, 0x80, 0x6A, 0x3D,
-    0xA0, 0x32, 0x03, 0xC5, 0x3F, 0x06, 0x32, 0xCF, 0x06, 0x1A, 0xA2, 0x41, 0xF5, 0xD1, 0xA0, 0x9B,
-    0x68, 0xB8, 0x3B, 0x9D, 0x5A, 0xA1, 0xFB, 0xEB, 0x88, 0x60, 0x97, 0x42, 0xD1, 0x9A, 0x3D, 0x30,
-    0x20, 0xAD, 0x07, 0xF7, 0x26, 0xF6, 0x43, 0xC8, 0xDA, 0xD6, 0xCD, 0x6E, 0xDA, 0xC5, 0x27, 0x9E,
-    0xF6, 0x0C, 0xEE, 0x00, 0xE0, 0x9B, 0x33, 0xE6, 0xBA, 0x88, 0xBF, 0x8F, 0x34, 0x68, 0xA7, 0xAD,
-    0xB1, 0x9E, 0xF8, 0x79, 0xA3, 0x46, 0x4F, 0x9A, 0x0B, 0xCA, 0x1D, 0x40, 0x3C, 0x85, 0x12, 0xF8,
-    0x99, 0xCB, 0xA0, 0x60, 0x7E, 0x97, 0xCC, 0xD1, 0x42, 0xBB, 0x3C, 0x1C, 0xA3, 0xAE, 0x2E, 0x4C,
-    0xD2, 0xA9, 0x3F, 0x10, 0x85, 0x71, 0x7B, 0x83, 0xEB, 0xF8, 0x35, 0x50, 0x6B, 0x21, 0xB5, 0x1C,
-    0x51, 0xB6, 0xAC, 0x5B, 0x6A, 0xCF, 0xDA, 0x60, 0xEA, 0x46, 0x35, 0x56, 0xD5, 0x76, 0x2C, 0x22,
-    0xA7, 0x32, 0x49, 0x03, 0x50, 0x02, 0xB9, 0xB7, 0x23, 0xF9, 0x1B, 0xCA, 0x44, 0xB5, 0x04, 0x4F,
-    0x3B, 0x5A, 0xBC, 0xF8, 0x52, 0xCF, 0x16, 0x92, 0xFA, 0x8D, 0xD4, 0xD2, 0xC9, 0x4B, 0xC8, 0x4B,
-    0x69, 0x1C, 0x07, 0xD8, 0x11, 0x97, 0x4C, 0x01, 0x3B, 0x88, 0x60, 0xDA, 0xB2, 0xED, 0xB4, 0x73,
-    0xBE, 0x3E, 0x18, 0x75, 0xB9, 0xEF, 0x75, 0xE1, 0x7C, 0x9C, 0x6D, 0xEA, 0xB2, 0x41, 0x13, 0x38,
-    0xE9, 0x45, 0xB8, 0x74, 0x05, 0x77, 0x1E, 0xDD, 0xB2, 0xE5, 0xA6, 0x36, 0x9E, 0x5E, 0x12, 0xD5,
-    0xD9, 0xA3, 0xAA, 0xAA, 0xAD, 0xE1, 0x59, 0x27, 0x96, 0x1D, 0x35, 0x60, 0x6D, 0xC7, 0x9F, 0xAF,
-    0x21, 0x43, 0x30, 0x31, 0x9E, 0x7A, 0xD6, 0x2D, 0x53, 0x4D, 0xE3, 0xEA, 0x28, 0x56, 0xE0, 0x06,
-    0xE4, 0xE0, 0xF6, 0x66, 0xE1, 0x7C, 0x6A, 0xB9, 0x2C, 0x3F, 0x7B, 0x35, 0xBA, 0x91, 0x51, 0xAE,
-    0x12, 0xCC, 0x8D, 0xE3, 0x05, 0x6E, 0x2A, 0xA5, 0x93, 0x9C, 0xA0, 0x4B, 0x4A, 0x51, 0xE9, 0x95,
-    0xE8, 0x47, 0xD7, 0xCE, 0x69, 0x3C, 0x20, 0x3D, 0xBD, 0x1F, 0xA0, 0x89, 0x7B, 0xA1, 0x62, 0x9A,
-    0xC8, 0x09, 0xA7, 0x18, 0x0F, 0xFE, 0x67, 0xB5, 0x23, 0x3D, 0x09, 0xE4, 0xE9, 0xFC, 0x0A, 0x20,
-    0xB9, 0x39, 0xE4, 0xAA, 0xFA, 0x20, 0xFD, 0xC8, 0xBC, 0x98, 0x36, 0x51, 0x6C, 0xF9, 0x5A, 0x80,
-    0x10, 0xF6, 0x55, 0x27, 0x9C, 0xE2, 0x4C, 0x5D, 0x28, 0x25, 0x75, 0x4A, 0xA5, 0x60, 0xC8, 0xAE,
-    0xE4, 0x0D, 0xE2, 0x20, 0xE5, 0xBF, 0xD8, 0x9A, 0xD1, 0xF0, 0x01, 0x1F, 0x9F, 0xF8, 0x78, 0x6F,
-    0x35, 0x21, 0x75, 0x0C, 0x68, 0x6B, 0xAB, 0x74, 0xE1, 0xDC, 0x39, 0xB6, 0xEB, 0xC9, 0xB8, 0x6A,
-    0xB6, 0xF8, 0xB8, 0xF5, 0x09, 0x82, 0xB3, 0xF4, 0x54, 0x5A, 0x11, 0x1A, 0x86, 0x48, 0x01, 0x5E,
-    0xF3, 0x33, 0xFE, 0x0B, 0xA5, 0x54, 0xB1, 0x6E, 0xD4, 0x40, 0x10, 0x7D, 0xBE, 0x25, 0xB1, 0xC4,
-    0x21, 0x99, 0x02, 0x90, 0x48, 0x90, 0xDC, 0xA7, 0x71, 0x43, 0x8B, 0x6C, 0x2A, 0x0A, 0x0A, 0x28,
-    0x42, 0x43, 0x93, 0x1E, 0x8A, 0xFC, 0x00, 0x68, 0x8D, 0x52, 0x50, 0x92, 0x82, 0x4F, 0x00, 0x09,
-    0x29, 0x45, 0x3E, 0xC1, 0x8E, 0x28, 0x28, 0x28, 0x30, 0x75, 0x0A, 0x0C, 0xBA, 0x26, 0xA4, 0x60,
-    0x21, 0x16, 0x32, 0x91, 0xED, 0xE1, 0xCD, 0xFA, 0x0C, 0x81, 0x0E, 0x61, 0x9D, 0xC7, 0xAB, 0x9D,
-    0x9D, 0xB7, 0x6F, 0xE6, 0xCD, 0x1C, 0xA0, 0x4F, 0x0F, 0x84, 0x02, 0xA4, 0x03, 0x60, 0x3A, 0xAE,
-    0x1D, 0x10, 0x97, 0x80, 0xC5, 0xFE, 0xFB, 0x36, 0x96, 0xE3, 0x8F, 0x22, 0x72, 0xA7, 0xB7, 0xBD,
-    0x2D, 0xD3, 0xAF, 0x3D, 0xEC, 0x5B, 0x07, 0x49, 0x4A, 0xD3, 0xDA, 0x3C, 0x39, 0x90, 0x63, 0x31,
-    0x22, 0x0D, 0xDF, 0x32, 0x94, 0x0E, 0xB3, 0x22, 0xF7, 0x80, 0x58, 0x01, 0x82, 0x62, 0x11, 0x34,
-    0x08, 0x44, 0x5A, 0x5B, 0xC2, 0x12, 0xC2, 0x21, 0x96, 0x3D, 0x1E, 0x32, 0x92, 0x45, 0xBC, 0xAD,
-    0x28, 0x51, 0x38, 0x44, 0x2D, 0x77, 0xB3, 0x40, 0xA0, 0xE1, 0x89, 0x0B, 0xA4, 0x28, 0xCD, 0x00,
-    0xFB, 0xA6, 0x43, 0x5A, 0xC7, 0x2E, 0x2D, 0x4D, 0x1F, 0x76, 0xA6, 0x47, 0xFA, 0x5E, 0xB2, 0xB4,
-    0x32, 0x83, 0xAD, 0x42, 0x7A, 0xA4, 0x61, 0xF4, 0x4C, 0x7A, 0xC4, 0x8C, 0x91, 0x6A, 0x4B, 0x4A,
-    0x5E, 0xC3, 0x8B, 0x08, 0xC5, 0x27, 0x0B, 0xD5, 0x3A, 0xBF, 0xD5, 0x91, 0x2E, 0x3F, 0x30, 0x6E,
-    0x55, 0x86, 0x0C, 0x17, 0xF0, 0xC7, 0x73, 0x8F, 0xEF, 0x4C, 0x32, 0x66, 0x2D, 0x4C, 0x77, 0x2E,
-    0x15, 0x10, 0x49, 0xCD, 0xE4, 0xC9, 0x15, 0xE9, 0x61, 0x0B, 0x4F, 0x04, 0xB2, 0x33, 0x30, 0x8F,
-    0x19, 0x51, 0x04, 0x92, 0x87, 0x3D, 0xA4, 0x8C, 0x08, 0x5C, 0xC5, 0x2D, 0x52, 0x97, 0x3A, 0x24,
-    0x8D, 0xAD, 0x11, 0x75, 0x85, 0xDE, 0xF7, 0x97, 0xD1, 0x5B, 0x12, 0x2E, 0x94, 0xC4, 0x37, 0xDD,
-    0x98, 0x37, 0x91, 0x9B, 0xF5, 0xAC, 0x72, 0x91, 0x09, 0x92, 0x2A, 0x2D, 0xFF, 0x71, 0x63, 0x2D,
-    0xDF, 0xC8, 0xC3, 0x66, 0xFE, 0x5F, 0x18, 0xBA, 0xA1, 0xEC, 0x26, 0x62, 0x6E, 0x24, 0x79, 0x2C,
-    0x72, 0x2A, 0x32, 0x50, 0x2D, 0xD6, 0x58, 0xE5, 0xA1, 0x36, 0x60, 0x75, 0x22, 0x87, 0x80, 0x1B,
-    0x29, 0xAB, 0x91, 0xEB, 0x8F, 0x1E, 0x96, 0x8B, 0x00, 0xFB, 0xBF, 0x62, 0x70, 0xF9, 0x41, 0x9E,
-    0x8A, 0xDC, 0xE4, 0x32, 0x92, 0xCF, 0xAF, 0xB4, 0xA0, 0x5A, 0x51, 0x15, 0x8A, 0xC2, 0x9E, 0x12,
-    0x7F, 0xD0, 0x4A, 0x44, 0x2C, 0xB0, 0xC7, 0xA2, 0x8B, 0x6E, 0x98, 0x56, 0x97, 0x36, 0x53, 0x97,
-    0x92, 0x80, 0xA8, 0x89, 0x6B, 0x75, 0xF9, 0x80, 0x94, 0x01, 0xD7, 0x95, 0x8D, 0xA9, 0x3D, 0xDE,
-    0x07, 0x06, 0x50, 0xD7, 0x4C, 0x75, 0xD2, 0x00, 0xAB, 0x01, 0x46, 0x25, 0x43, 0xDC, 0xFF, 0xD6,
-    0xF5, 0x2A, 0xD6, 0xD8, 0x52, 0x6D, 0xDA, 0xF1, 0xEC, 0x17, 0x29, 0x7D, 0x6F, 0xD8, 0xDC, 0xD6,
-    0x36, 0x2E, 0x4D, 0x1D, 0x1E, 0xD6, 0x68, 0x82, 0xEF, 0x2D, 0x6E, 0xE0, 0xB1, 0xC5, 0x76, 0x65,
-    0xB7, 0xD4, 0xFF, 0xDA, 0xF7, 0x8C, 0xB6, 0x69, 0x13, 0x8A, 0x63, 0x2B, 0x5D, 0xC9, 0xE7, 0x0B,
-    0xC5, 0x3A, 0xAF, 0xD6, 0x2A, 0x67, 0x55, 0xD3, 0xF4, 0xD7, 0x96, 0xB4, 0x43, 0xA6, 0x86, 0xB9,
-    0x9B, 0x8C, 0xE7, 0x1F, 0xD5, 0x93, 0x89, 0x35, 0x53, 0x9D, 0x21, 0x24, 0xE5, 0x94, 0xED, 0x68,
-    0xF2, 0xC9, 0xF8, 0xB4, 0x0B, 0x36, 0xE0, 0x13, 0xD1, 0xF2, 0x33, 0xDF, 0x82, 0x1D, 0xCD, 0x9A,
-    0x75, 0xCB, 0xEC, 0x82, 0x69, 0x98, 0x58, 0x06, 0xB9, 0x35, 0xC4, 0x6D, 0x71, 0xA2, 0x45, 0x18,
-    0x9F, 0xA8, 0xE1, 0x48, 0x3C, 0x1D, 0x92, 0x8E, 0x8D, 0x7E, 0x97, 0x27, 0xBA, 0xF9, 0x27, 0xE9,
-    0x92, 0x77, 0x27, 0x5D, 0x91, 0xEE, 0x48, 0x63, 0xB5, 0xA1, 0x83, 0x17, 0xD8, 0x54, 0xA8, 0x59,
-    0x5B, 0xC8, 0xED, 0x93, 0xB6, 0x28, 0x9E, 0xD5, 0x45, 0xB7, 0x9A, 0xDB, 0x6A, 0x09, 0xB1, 0xBA,
-    0x0B, 0xAF, 0x2A, 0x4C, 0x33, 0x91, 0xED, 0xA7, 0x74, 0xEC, 0xA6, 0xD1, 0x7A, 0x68, 0x87, 0xE8,
-    0xF4, 0xCB, 0x41, 0x36, 0x6E, 0x93, 0x73, 0xD8, 0xAD, 0x64, 0xD4, 0x5A, 0xE7, 0x5E, 0x86, 0x78,
-    0x9C, 0xB1, 0x7C, 0xFC, 0xE3, 0x40, 0x52, 0x2F, 0x45, 0x9C, 0x2B, 0xE4, 0xC6, 0xC4, 0xFF, 0xA2,
-    0x9A, 0x47, 0x7E, 0xD8, 0xD4, 0xA7, 0x59, 0x58, 0x0E, 0x9B, 0x57, 0x72, 0xAE, 0x49, 0x27, 0xDA,
-    0x28, 0xB1, 0xEC, 0x6A, 0xB7, 0x2C, 0xF4, 0x98, 0xFC, 0x00, 0xB6, 0x45, 0x47, 0x36, 0xF6, 0x53,
-    0xB4, 0x2E, 0x1A, 0xB9, 0xEE, 0xF3, 0x0F, 0x9D, 0x19, 0x9E, 0xE3, 0x1C, 0x0F, 0xC9, 0x4B, 0x28,
-    0xB9, 0x3A, 0xB8, 0x3F, 0x8E, 0xDA, 0xCA, 0x5E, 0x36, 0x5E, 0x18, 0xEB, 0x37, 0xD0, 0x3E, 0x21,
-    0xB4, 0xAF, 0xB3, 0xE4, 0x67, 0x6C, 0x75, 0xC6, 0x7A, 0x56, 0x6E, 0x79, 0x03, 0xF5, 0x6F, 0x15,
-    0x77, 0xA1, 0xAB, 0x9C, 0x64, 0xB4, 0x0B, 0xAD, 0xE6, 0x12, 0xF2, 0xF4, 0x25, 0x62, 0x3E, 0x94,
-    0x72, 0x85, 0x7D, 0xDF, 0x8F, 0x17, 0x93, 0xDC, 0x51, 0x66, 0x8E, 0x28, 0x00, 0x7E, 0x02,
+static const uint8_t opendyslexic_12_boldBitmaps[28657] = {
+    0xCD, 0x9B, 0xBF, 0x93, 0x1F, 0xC7, 0x99, 0xDE, 0x3F, 0x33, 0x6D, 0x60, 0xCA, 0x1A, 0xFB, 0x9A,
+    0x81, 0xE1, 0xB2, 0xCD, 0x3A, 0xCF, 0x05, 0x4E, 0xCC, 0xAA, 0xD3, 0xF8, 0x0F, 0x10, 0xD9, 0x43,
+    0xA2, 0xEE, 0x18, 0x30, 0x00, 0x5C, 0x16, 0x24, 0x97, 0x1D, 0xD0, 0xA9, 0x59, 0xE5, 0x42, 0xE2,
+    0xC0, 0xC1, 0x1D, 0x67, 0x8E, 0x28, 0x5B, 0x01, 0x03, 0x22, 0x90, 0x23, 0x05, 0x62, 0x20, 0x5D,
+    0x9D, 0xF7, 0x02, 0x28, 0x54, 0x40, 0xB1, 0x9B, 0xDC, 0x2A, 0x23, 0x40, 0x80, 0x21, 0x61, 0x95,
+    0x02, 0x06, 0x1C, 0x91, 0xF0, 0x5D, 0x99, 0x0A, 0xD0, 0x02, 0x47, 0xE2, 0x2C, 0xD5, 0xD3, 0x8F,
+    0x83, 0xFE, 0xEE, 0x2E, 0x40, 0x9E, 0xEE, 0x74, 0xA6, 0x4E, 0x72, 0x6F, 0xFF, 0x98, 0xF9, 0x4E,
+    0x6F, 0xFF, 0x98, 0x7E, 0xFB, 0x79, 0xDF, 0x7E, 0xBA, 0x07, 0x6A, 0x4C, 0x30, 0xB1, 0xFC, 0x35,
+    0xB1, 0x89, 0x4D, 0x6C, 0x63, 0x1B, 0xED, 0xD9, 0x9F, 0x89, 0x7C, 0x8F, 0x27, 0x38, 0x73, 0xDD,
+    0xDA, 0xAF, 0x6E, 0x73, 0x9B, 0x4B, 0x63, 0xF2, 0x69, 0xDC, 0x5C, 0x1A, 0x57, 0xB7, 0x8D, 0xD1,
+    0xC5, 0x71, 0x79, 0x34, 0x8C, 0x71, 0x8C, 0x63, 0x7C, 0xE9, 0xE6, 0x53, 0xAF, 0x83, 0x1B, 0x3C,
+    0x9C, 0x25, 0xE3, 0x20, 0x80, 0x91, 0x0C, 0xE0, 0x4B, 0x22, 0x32, 0xB4, 0x92, 0xA4, 0x64, 0x25,
+    0x49, 0x5B, 0x49, 0xD6, 0x0B, 0x5F, 0xD3, 0xD7, 0xF3, 0xB5, 0xAB, 0xD4, 0xD9, 0x24, 0xA0, 0xDE,
+    0x4D, 0x02, 0xCC, 0x69, 0xD2, 0x24, 0x28, 0x39, 0x63, 0x57, 0x12, 0x27, 0x49, 0x5A, 0x2E, 0xBD,
+    0xB8, 0xBF, 0x78, 0x72, 0x6D, 0xA0, 0x4D, 0x76, 0x05, 0xEC, 0x21, 0xD9, 0x6C, 0x04, 0xEC, 0xD6,
+    0x45, 0xE0, 0x4B, 0xDF, 0xF9, 0x67, 0xAF, 0x9F, 0xF5, 0xAC, 0x9D, 0x81, 0x7A, 0x05, 0xF8, 0x01,
+    0x80, 0xBB, 0x09, 0x8D, 0x14, 0x69, 0xA5, 0x95, 0x56, 0x4A, 0x18, 0xF9, 0x7F, 0x4B, 0xA5, 0x2B,
+    0x01, 0xFC, 0x71, 0x84, 0x6E, 0x4D, 0xD0, 0xC8, 0x03, 0xD2, 0x09, 0x58, 0x69, 0x05, 0x2F, 0xCD,
+    0x54, 0x5E, 0x3B, 0xD8, 0x07, 0x0A, 0x98, 0xE8, 0xD7, 0x66, 0x48, 0x76, 0x37, 0xF2, 0xAD, 0x2E,
+    0x4B, 0xD2, 0xB1, 0x24, 0x05, 0x2F, 0x69, 0xAA, 0x6E, 0xE9, 0x04, 0xE8, 0x02, 0xD0, 0x44, 0xA0,
+    0x4A, 0x00, 0x2F, 0xF3, 0x88, 0xFB, 0x47, 0x00, 0x36, 0x00, 0xF5, 0x46, 0x3F, 0xE1, 0xE8, 0x84,
+    0x5D, 0xCC, 0xF2, 0xFD, 0x2A, 0xF1, 0x95, 0x26, 0xB8, 0xC1, 0x84, 0xAF, 0xB4, 0x91, 0xA7, 0xDB,
+    0xB7, 0x12, 0x46, 0x9B, 0x9B, 0xE8, 0xD4, 0x44, 0xE8, 0xA7, 0x0C, 0xD0, 0xBF, 0xBD, 0x41, 0xB3,
+    0x2A, 0x82, 0xBE, 0xDC, 0x06, 0xFA, 0x7B, 0xE1, 0x2B, 0x98, 0xED, 0x2B, 0x26, 0x20, 0xB3, 0xBC,
+    0x41, 0xB7, 0xF4, 0x9A, 0x4C, 0x42, 0x11, 0x3F, 0xD4, 0x1B, 0x36, 0x02, 0x5C, 0xBF, 0x09, 0x56,
+    0x2B, 0xEC, 0x4D, 0xA4, 0x09, 0x26, 0xD2, 0xD3, 0x06, 0xDE, 0xA0, 0xA7, 0x4A, 0x55, 0xC2, 0x24,
+    0x37, 0x63, 0x94, 0xC1, 0x68, 0x86, 0x3E, 0x41, 0xAD, 0xC4, 0x37, 0xBB, 0x87, 0x7B, 0xB3, 0xFA,
+    0x67, 0xF7, 0xFE, 0x38, 0x55, 0x59, 0x76, 0xAB, 0xB4, 0xBA, 0xFC, 0xF5, 0xD2, 0xDD, 0x41, 0x92,
+    0x90, 0xB6, 0xEF, 0x71, 0xFD, 0x04, 0x5E, 0xFA, 0x53, 0xDD, 0x51, 0xBF, 0xF9, 0x77, 0xF5, 0xC2,
+    0xDE, 0xAF, 0x5A, 0x68, 0x16, 0xDC, 0x54, 0x27, 0xBA, 0x19, 0xD1, 0xAC, 0xB8, 0x50, 0x65, 0xDA,
+    0x88, 0x0B, 0xD5, 0x5E, 0x52, 0x84, 0xD9, 0xB0, 0x0B, 0xE3, 0x54, 0x65, 0x9A, 0x0D, 0xBB, 0x1C,
+    0x7E, 0xDD, 0x69, 0x37, 0xBA, 0x92, 0x67, 0xAA, 0x84, 0xC9, 0xB4, 0x09, 0xBB, 0xD1, 0xAF, 0xB8,
+    0x88, 0x9F, 0x81, 0x7E, 0xC0, 0x43, 0xA6, 0xDE, 0x31, 0x89, 0x76, 0xC5, 0x46, 0xFA, 0x80, 0x9B,
+    0x10, 0x75, 0xA2, 0x59, 0xB1, 0x87, 0x4A, 0xEA, 0x44, 0x1B, 0xE9, 0x03, 0x1E, 0x93, 0xCA, 0xAF,
+    0x55, 0xA6, 0xDD, 0x70, 0x73, 0x25, 0xEC, 0xC6, 0x38, 0xD7, 0xC2, 0x6E, 0x28, 0x34, 0x19, 0x17,
+    0x6B, 0x0D, 0x00, 0x5C, 0x0C, 0xE0, 0x18, 0xFE, 0x43, 0xEA, 0xCC, 0xCF, 0x7F, 0x9E, 0x7A, 0x29,
+    0xF6, 0xDA, 0x69, 0x14, 0x18, 0xB5, 0x5A, 0x69, 0x73, 0x0F, 0x6E, 0x85, 0xFF, 0xF2, 0xE6, 0x3F,
+    0xE4, 0xB9, 0x0D, 0xDA, 0x9B, 0x67, 0x63, 0x5C, 0x27, 0xE8, 0xC3, 0x23, 0x89, 0x97, 0xEE, 0x48,
+    0xC9, 0x4B, 0xE1, 0xF1, 0x67, 0xD5, 0x46, 0x97, 0xBB, 0xDD, 0x26, 0x9B, 0xBA, 0xCD, 0x45, 0x17,
+    0xFD, 0xF2, 0xD2, 0x34, 0x4A, 0xB7, 0xA5, 0x34, 0x4A, 0xE1, 0xC2, 0x73, 0xBB, 0xFB, 0x30, 0xBB,
+    0x4F, 0x74, 0x5A, 0x72, 0x28, 0x92, 0x55, 0x6F, 0xC0, 0x0E, 0x8C, 0x40, 0x1F, 0xC0, 0x2E, 0x60,
+    0xD6, 0x52, 0x35, 0x19, 0x70, 0x43, 0x11, 0xC4, 0x36, 0x82, 0xD9, 0xA0, 0xDA, 0x01, 0x0F, 0xB8,
+    0x43, 0xEE, 0x66, 0x05, 0x73, 0x9A, 0x7B, 0x1C, 0x0E, 0xC5, 0x44, 0x68, 0x36, 0xA8, 0x77, 0x40,
+    0x87, 0xDC, 0xDD, 0x52, 0x1E, 0x98, 0x04, 0x55, 0x06, 0xFC, 0x70, 0x78, 0x10, 0xA1, 0xDD, 0xC0,
+    0x9C, 0xE6, 0x1E, 0x07, 0x70, 0xC0, 0xEF, 0x00, 0x17, 0x00, 0xA8, 0x8A, 0x44, 0x8D, 0x5A, 0xCC,
+    0xD6, 0xCD, 0x7D, 0xE8, 0x43, 0xC6, 0x3D, 0xBF, 0x7E, 0x2F, 0xF7, 0x77, 0x3E, 0x4E, 0x2A, 0xD1,
+    0xDD, 0x87, 0x49, 0xEE, 0xF6, 0x87, 0x49, 0x7F, 0x68, 0x1F, 0x0A, 0x7F, 0x27, 0x37, 0xB9, 0x93,
+    0x36, 0x57, 0xA6, 0x15, 0x52, 0x44, 0x1A, 0x18, 0x17, 0xF0, 0xB4, 0xA2, 0x17, 0x4E, 0x3C, 0x2D,
+    0x7E, 0x4F, 0xF0, 0xB8, 0xAF, 0x4E, 0x7D, 0x2D, 0xF4, 0x88, 0xE3, 0x12, 0x95, 0xD7, 0x30, 0x6A,
+    0x6F, 0xA4, 0xF8, 0xF2, 0xE0, 0xFF, 0x1B, 0xA6, 0x8C, 0x80, 0x49, 0xE0, 0x02, 0x76, 0xA3, 0xD6,
+    0x80, 0x5F, 0x18, 0x13, 0xBD, 0x06, 0xAB, 0xB9, 0x56, 0xC2, 0x49, 0x3F, 0x92, 0x76, 0x2F, 0xBD,
+    0x2F, 0xE5, 0x8B, 0xBA, 0x59, 0x4B, 0xB3, 0x93, 0xCC, 0xCD, 0x26, 0x95, 0x69, 0x5C, 0x92, 0x26,
+    0x55, 0x12, 0xBD, 0x66, 0x23, 0x0D, 0x97, 0xAE, 0x27, 0x70, 0x33, 0x55, 0xFE, 0xE7, 0xC3, 0xF8,
+    0x81, 0x94, 0x4B, 0x29, 0xC9, 0x4B, 0x95, 0xCF, 0x03, 0xFC, 0x71, 0x19, 0x12, 0xB7, 0x50, 0x6B,
+    0xA2, 0xCB, 0x90, 0x13, 0xF6, 0xBD, 0xC8, 0x9B, 0x7D, 0x68, 0xA2, 0x70, 0x97, 0x53, 0xBD, 0xD9,
+    0xD8, 0x4B, 0xBB, 0xA4, 0x4F, 0x24, 0xFD, 0xF0, 0x6B, 0xB7, 0xF2, 0x80, 0x9B, 0x41, 0x03, 0x66,
+    0x87, 0x6E, 0x3D, 0x48, 0x84, 0x29, 0x30, 0x69, 0xA4, 0xE8, 0xC0, 0x44, 0x18, 0xCB, 0xD8, 0x8E,
+    0xBA, 0xD9, 0x48, 0xF3, 0x28, 0x5D, 0xFC, 0xEF, 0x2F, 0x96, 0x4E, 0x9A, 0xFD, 0x09, 0xDC, 0xBD,
+    0xFB, 0xDD, 0xEE, 0xA4, 0xDB, 0xD2, 0xE6, 0x25, 0x2B, 0x4D, 0x4F, 0xE6, 0x09, 0x2E, 0x7C, 0x77,
+    0xA8, 0x25, 0x9C, 0x92, 0x91, 0x62, 0x37, 0xC3, 0x5E, 0x8A, 0xEB, 0xEE, 0x9C, 0xE0, 0x95, 0x8D,
+    0x94, 0xAD, 0xBE, 0x95, 0x5C, 0x6C, 0x37, 0x4D, 0xF6, 0xE3, 0x1D, 0x77, 0x67, 0x43, 0xDD, 0xDA,
+    0x26, 0x27, 0x2D, 0x5E, 0xC2, 0x2B, 0x72, 0xFD, 0x04, 0xC0, 0x4A, 0x49, 0xD2, 0x5D, 0x29, 0x51,
+    0x8D, 0x81, 0x66, 0x03, 0x3F, 0x60, 0x57, 0x10, 0x74, 0x91, 0x5A, 0xE0, 0x16, 0x9A, 0x0C, 0x7E,
+    0xC6, 0x26, 0x50, 0xA0, 0x4B, 0xD4, 0x0A, 0xB8, 0x8D, 0x46, 0x03, 0x4F, 0x9E, 0x80, 0x14, 0x4C,
+    0xF6, 0x4B, 0x1B, 0xDB, 0x68, 0x17, 0xB3, 0xDA, 0xC5, 0x6C, 0x36, 0x36, 0x6B, 0x9B, 0xAF, 0xC7,
+    0x5A, 0x5A, 0x18, 0x35, 0xD5, 0x52, 0xB4, 0x6B, 0xBB, 0xF5, 0x8B, 0x49, 0x6E, 0xAE, 0x77, 0x37,
+    0x9B, 0xDD, 0x9D, 0xBC, 0xB8, 0x77, 0x45, 0xFB, 0xAC, 0x46, 0x9A, 0xE9, 0x3F, 0x85, 0xEB, 0x37,
+    0xE9, 0xB4, 0x56, 0x52, 0xB4, 0x4B, 0x17, 0x5F, 0xA6, 0x7B, 0x3B, 0xE2, 0xAE, 0x04, 0xDE, 0x74,
+    0xD4, 0xE9, 0x0D, 0xEC, 0xC3, 0x84, 0x3F, 0x96, 0x57, 0x2B, 0xA5, 0x56, 0x8A, 0xB5, 0xF7, 0x01,
+    0xF2, 0x05, 0xDA, 0xD5, 0x49, 0x41, 0xCA, 0x8D, 0x14, 0xBF, 0xA4, 0x13, 0x00, 0xFA, 0x45, 0xC7,
+    0xB2, 0x69, 0x7C, 0xA8, 0xF9, 0x4C, 0xE9, 0x6C, 0x2E, 0xEA, 0x58, 0x5D, 0xF2, 0x2B, 0xD4, 0x19,
+    0x1F, 0x5C, 0xB4, 0xA9, 0xD1, 0xB3, 0xE7, 0x59, 0x80, 0x2F, 0x1D, 0x19, 0x05, 0x2D, 0x6E, 0xB5,
+    0xA9, 0xC9, 0xB5, 0x06, 0x85, 0x31, 0x9E, 0x3F, 0xFD, 0x17, 0x94, 0xF9, 0xC7, 0xB8, 0x41, 0x5B,
+    0x34, 0xD0, 0x44, 0xA7, 0x8D, 0x4A, 0x1A, 0x0A, 0x84, 0x5B, 0x05, 0xB0, 0xCA, 0x03, 0x9D, 0xB4,
+    0x83, 0x97, 0xB6, 0x83, 0x8E, 0xBA, 0xA8, 0x1D, 0x68, 0x77, 0x80, 0x7F, 0x0A, 0xD5, 0xD0, 0x4B,
+    0x48, 0xB9, 0x95, 0xD2, 0xA5, 0x82, 0x69, 0x54, 0x5F, 0xFB, 0x33, 0x23, 0xAD, 0x9D, 0xB4, 0x28,
+    0x1F, 0x4D, 0x00, 0xBC, 0x4E, 0x91, 0x48, 0xAC, 0x06, 0xE8, 0x35, 0x43, 0xAB, 0x0D, 0x6A, 0x65,
+    0xC0, 0x6B, 0x86, 0x5E, 0x0B, 0x74, 0x9A, 0x78, 0x52, 0x99, 0xEB, 0xD2, 0x7E, 0x5D, 0x3A, 0xA9,
+    0xA5, 0x93, 0x92, 0xB3, 0xBF, 0x0F, 0x7C, 0xE7, 0xDC, 0xB4, 0xD8, 0xA8, 0xA5, 0xC9, 0x4A, 0x4B,
+    0x7F, 0xF2, 0xE2, 0x6A, 0x27, 0x93, 0x2A, 0xEA, 0xFD, 0x00, 0x43, 0x87, 0x50, 0xED, 0x05, 0x53,
+    0xDA, 0x0D, 0x7C, 0xA4, 0xD1, 0x8C, 0xD5, 0x80, 0x4D, 0x3C, 0x1E, 0x66, 0xF8, 0xFB, 0x3C, 0xEE,
+    0x2E, 0x5C, 0x2D, 0x90, 0xD4, 0x45, 0xE8, 0x23, 0xB8, 0x08, 0x6E, 0x05, 0xF8, 0x7B, 0x00, 0xBD,
+    0x26, 0x68, 0xA5, 0x19, 0x34, 0x74, 0x33, 0x76, 0xA1, 0x0D, 0xEC, 0xD0, 0x86, 0x66, 0xF9, 0x72,
+    0xB4, 0x38, 0xF3, 0x20, 0xFC, 0x7E, 0xB5, 0xFD, 0xAE, 0x1D, 0xBE, 0xDF, 0x2E, 0xDF, 0xFB, 0xFD,
+    0x7A, 0x71, 0x97, 0xA7, 0xFF, 0xDC, 0x4E, 0xF9, 0x77, 0xAA, 0xE5, 0x69, 0xB3, 0x7D, 0xF9, 0xD6,
+    0x2B, 0xD1, 0xC6, 0x51, 0xFD, 0xE4, 0xE6, 0x71, 0x4C, 0x8C, 0x81, 0x71, 0x42, 0x13, 0x50, 0x2B,
+    0xF0, 0x04, 0x46, 0x27, 0xD7, 0x03, 0x8D, 0xA4, 0x81, 0x46, 0xCA, 0x50, 0x4B, 0x09, 0xB8, 0x9E,
+    0xCF, 0xB4, 0x80, 0x0B, 0x80, 0x29, 0x86, 0x51, 0x3C, 0x7D, 0xB5, 0x95, 0x36, 0xC0, 0x3D, 0x08,
+    0x60, 0x4E, 0x32, 0xE0, 0xAF, 0x44, 0xB0, 0xD1, 0x0F, 0x54, 0xB9, 0xD9, 0xC0, 0xCD, 0x2E, 0x60,
+    0x92, 0xC9, 0xE0, 0x43, 0x17, 0xB1, 0xF9, 0x48, 0x43, 0x25, 0x69, 0xC3, 0x49, 0x0A, 0x46, 0x52,
+    0xC6, 0x4B, 0x8A, 0x36, 0x61, 0xF4, 0xAC, 0x02, 0xFD, 0xE6, 0x56, 0x2A, 0x05, 0xE9, 0x3E, 0x4E,
+    0x0A, 0x56, 0x4A, 0x66, 0xBF, 0xA0, 0x49, 0xD8, 0xE8, 0x42, 0x95, 0x6C, 0xC4, 0x9B, 0xC4, 0x38,
+    0x49, 0x0A, 0x4E, 0x5A, 0xAC, 0x24, 0x93, 0x8F, 0x14, 0x45, 0xB3, 0xBB, 0x80, 0x7F, 0x2D, 0xE2,
+    0x3E, 0xCE, 0xD7, 0x7C, 0x52, 0x81, 0x2B, 0x5D, 0x39, 0x58, 0x36, 0x41, 0xCA, 0x07, 0xC1, 0xE1,
+    0xA2, 0x4E, 0x68, 0xA4, 0xC5, 0x48, 0x3B, 0x92, 0x42, 0xAF, 0x4F, 0x93, 0xD1, 0x5C, 0x3A, 0x68,
+    0x13, 0x54, 0x9A, 0xA0, 0xDF, 0xC0, 0x68, 0x28, 0x03, 0x52, 0x2E, 0xD2, 0xA9, 0x5D, 0xA1, 0x9B,
+    0xFF, 0xF8, 0xAD, 0x53, 0xBB, 0x30, 0x8C, 0x52, 0xAA, 0x25, 0x85, 0x56, 0x4A, 0x3C, 0x29, 0x05,
+    0xE9, 0x04, 0xA3, 0x22, 0x38, 0x9A, 0x9D, 0xA4, 0xA0, 0xFF, 0x7A, 0x5D, 0xC7, 0x99, 0x46, 0x57,
+    0x36, 0x4C, 0x76, 0x0B, 0x4D, 0xD2, 0x84, 0xFD, 0x38, 0x83, 0xBB, 0xBB, 0x81, 0x77, 0x0B, 0xE6,
+    0xEC, 0x27, 0xDD, 0xDD, 0xAA, 0xEB, 0x72, 0x92, 0x36, 0x49, 0xBA, 0x27, 0x49, 0xF6, 0x60, 0x49,
+    0x66, 0xA4, 0x3C, 0xF0, 0xD4, 0x9F, 0xEB, 0x67, 0x92, 0x6E, 0x4B, 0xEA, 0xF4, 0xE9, 0x77, 0xC6,
+    0x89, 0x2A, 0x97, 0x49, 0xD7, 0x2D, 0xE0, 0x3F, 0xDA, 0x6B, 0x69, 0x6D, 0xA5, 0xB9, 0x97, 0x06,
+    0x1F, 0xA8, 0x73, 0x91, 0x50, 0xF7, 0xE9, 0xD1, 0x77, 0x24, 0x7D, 0x5C, 0x70, 0x4D, 0xA3, 0x94,
+    0x25, 0xA5, 0xA7, 0x6E, 0xE9, 0x58, 0x4A, 0x4E, 0x3A, 0xD6, 0xD1, 0x57, 0xDD, 0x41, 0xA1, 0x4C,
+    0xA7, 0xB8, 0xDC, 0x48, 0x71, 0x94, 0x9A, 0xFD, 0xDA, 0x30, 0x06, 0xDA, 0x04, 0xFE, 0xB1, 0x44,
+    0xE1, 0x14, 0xFD, 0x6C, 0x02, 0x2E, 0x2A, 0x4F, 0xF4, 0x87, 0xD1, 0xCE, 0x65, 0xC8, 0x7B, 0xDD,
+    0xBC, 0xF4, 0xBA, 0xCD, 0x40, 0x23, 0xA0, 0x18, 0x27, 0x0A, 0x14, 0xA9, 0xC7, 0x26, 0xFE, 0xE5,
+    0x60, 0x84, 0x55, 0x52, 0xA8, 0xA5, 0x71, 0x65, 0xD4, 0x4F, 0x04, 0xE3, 0x89, 0x16, 0x6C, 0x74,
+    0xFA, 0xE6, 0xBF, 0x4F, 0xED, 0xC1, 0x56, 0x2B, 0xD2, 0xA1, 0x88, 0x97, 0x56, 0x2A, 0x9F, 0x07,
+    0xC6, 0x80, 0x7B, 0x47, 0xA0, 0xE7, 0x13, 0x66, 0xEF, 0x22, 0x76, 0x1D, 0x03, 0xEE, 0x03, 0x81,
+    0x5E, 0x4D, 0x98, 0xDC, 0x47, 0xEC, 0xE6, 0x03, 0xEE, 0x03, 0x0D, 0xE8, 0xD5, 0x9D, 0x46, 0xFD,
+    0xC9, 0xB5, 0xEB, 0xC9, 0x4B, 0x7A, 0xA8, 0xC3, 0xEB, 0x90, 0x53, 0xC1, 0x7C, 0x7D, 0xAC, 0xA9,
+    0xD6, 0xDD, 0x4C, 0x2B, 0xB7, 0xD1, 0x27, 0x2D, 0xF8, 0xA8, 0x57, 0x37, 0xFF, 0xEA, 0xE6, 0xBF,
+    0xB1, 0x8D, 0x07, 0x9F, 0xC6, 0xDB, 0x69, 0xBC, 0x93, 0xFC, 0x9D, 0xA4, 0xF7, 0x77, 0xCD, 0x60,
+    0xB7, 0xA2, 0x32, 0x35, 0xD0, 0xA4, 0x32, 0xAF, 0x7D, 0xA0, 0x16, 0xB4, 0x09, 0xDC, 0x02, 0x9A,
+    0x30, 0x3B, 0xD8, 0xF5, 0x90, 0x11, 0x9A, 0x54, 0x26, 0xFF, 0x61, 0x90, 0xEC, 0x06, 0x6E, 0x79,
+    0xE6, 0x79, 0x3D, 0x2B, 0xA5, 0x46, 0x8A, 0x05, 0xFC, 0xD6, 0xEA, 0x56, 0x3E, 0x00, 0xF4, 0x6A,
+    0x13, 0x6E, 0xF6, 0x0B, 0x32, 0xC2, 0xA4, 0x7E, 0xC5, 0xFE, 0x54, 0x13, 0xE3, 0xDD, 0x44, 0x95,
+    0xC7, 0x85, 0xE6, 0x17, 0x82, 0xFE, 0x14, 0x75, 0x8D, 0x12, 0x58, 0xCD, 0xE0, 0x34, 0x81, 0x34,
+    0xD1, 0x48, 0x81, 0x4E, 0x0A, 0x8C, 0x77, 0x15, 0x6A, 0x75, 0x9A, 0xDB, 0xD4, 0x69, 0x76, 0xB1,
+    0xD7, 0xA2, 0xD0, 0x6B, 0x39, 0x55, 0xD1, 0xA9, 0xE0, 0x93, 0x0B, 0x20, 0xCE, 0x6E, 0xC7, 0x70,
+    0xD6, 0xF0, 0xAE, 0xDC, 0x9E, 0xF6, 0xB0, 0x8F, 0xE0, 0x1F, 0xE8, 0x13, 0x49, 0xEF, 0x17, 0xE9,
+    0xDA, 0x25, 0xAD, 0x2E, 0x62, 0x64, 0x34, 0x31, 0xC6, 0x31, 0x61, 0xD5, 0x68, 0x46, 0xEB, 0x28,
+    0x7A, 0x3D, 0xAF, 0xD5, 0x68, 0x1D, 0x35, 0x8D, 0x7A, 0x5E, 0xC9, 0x6A, 0x1D, 0x35, 0x4B, 0x2F,
+    0xFC, 0x42, 0xBD, 0x36, 0x7F, 0xEB, 0x93, 0xAC, 0x57, 0x4F, 0xA4, 0xF7, 0x37, 0x7F, 0x57, 0x49,
+    0xAF, 0x26, 0xAF, 0xD7, 0x36, 0x7F, 0xAC, 0x9F, 0xE9, 0x6E, 0x72, 0xEA, 0x92, 0xDE, 0xD2, 0x8F,
+    0x75, 0x37, 0xD9, 0xBD, 0x4F, 0x9A, 0xFD, 0xDB, 0xBA, 0xBB, 0x37, 0xC9, 0x25, 0xCD, 0x18, 0x05,
+    0xC0, 0xFE, 0x54, 0x03, 0xEA, 0x12, 0xDD, 0x8F, 0x35, 0x57, 0xB9, 0x17, 0xDD, 0x07, 0x5A, 0xEB,
+    0xDC, 0x2B, 0xF4, 0xF7, 0xB4, 0xD7, 0xBB, 0x53, 0x74, 0xF7, 0xA4, 0xCB, 0xBB, 0xFB, 0x24, 0xB9,
+    0x7B, 0x72, 0xF7, 0x92, 0x7B, 0x98, 0xDD, 0x6D, 0xD9, 0x4F, 0xD2, 0x18, 0xBD, 0x6E, 0xAB, 0x51,
+    0xF2, 0xD1, 0xE9, 0x8E, 0x2A, 0x25, 0x1F, 0xAD, 0xEE, 0x0A, 0x9F, 0x14, 0x8D, 0x26, 0x2E, 0xEA,
+    0x26, 0x74, 0xD2, 0x44, 0x27, 0x25, 0x3A, 0x7D, 0x4B, 0xC1, 0xEE, 0xF4, 0x5B, 0x9B, 0x30, 0x32,
+    0x19, 0xC6, 0x77, 0x04, 0x36, 0xF9, 0x40, 0x25, 0xB7, 0xC0, 0x78, 0x77, 0x03, 0xFB, 0xF1, 0x0E,
+    0x66, 0xD7, 0x04, 0x1A, 0x17, 0x18, 0xEF, 0x26, 0xE8, 0x1F, 0x6A, 0xA2, 0x4B, 0x3E, 0xFF, 0xEB,
+    0x51, 0x9D, 0x24, 0xDD, 0x90, 0x8A, 0xD1, 0xA3, 0xD8, 0x4A, 0x8A, 0x8C, 0x52, 0xA4, 0xF2, 0x3A,
+    0xB7, 0xCE, 0x29, 0x10, 0xB6, 0x5A, 0x69, 0x75, 0xA1, 0x8B, 0xC2, 0xDE, 0x4B, 0xB8, 0xD7, 0x62,
+    0x25, 0xF7, 0xC3, 0x5B, 0x9B, 0xA4, 0x1F, 0x49, 0xEA, 0xCA, 0xC4, 0xAD, 0xA4, 0x9B, 0x67, 0xE3,
+    0x33, 0x53, 0x6B, 0xC0, 0xEE, 0x05, 0xDA, 0xB4, 0x60, 0x34, 0x01, 0xBC, 0x34, 0x00, 0x4E, 0x2B,
+    0xB4, 0xD2, 0x76, 0xD0, 0xC8, 0x8D, 0x86, 0x71, 0xC5, 0x45, 0x5C, 0xAC, 0x04, 0xE3, 0x6C, 0x13,
+    0x68, 0x72, 0x33, 0x95, 0x8A, 0x10, 0x34, 0x09, 0x6C, 0xEC, 0x22, 0xB8, 0x30, 0x06, 0x50, 0x25,
+    0x30, 0xA9, 0xD9, 0xB9, 0xDA, 0x45, 0xBB, 0x99, 0xD5, 0x07, 0xB7, 0xBF, 0x78, 0x0A, 0xF7, 0x48,
+    0xD2, 0x54, 0x49, 0x4A, 0xD4, 0x92, 0x16, 0x2A, 0x49, 0x01, 0xAE, 0x4B, 0x01, 0x18, 0x15, 0x28,
+    0x82, 0x7B, 0x1A, 0x03, 0xBD, 0xEE, 0xD3, 0x16, 0xB5, 0x91, 0xC8, 0x8C, 0x83, 0x9B, 0xDA, 0xC5,
+    0x2E, 0x75, 0x32, 0x1B, 0x9E, 0x8C, 0x0B, 0x6E, 0xEA, 0x17, 0x2B, 0xAD, 0x8D, 0xB4, 0x55, 0x52,
+    0x62, 0x94, 0x42, 0xB7, 0x77, 0x6B, 0xBB, 0x57, 0xAA, 0x35, 0x8D, 0xB3, 0x5F, 0xBA, 0xAD, 0xDF,
+    0x1A, 0xD9, 0x5C, 0xE9, 0x9E, 0xC2, 0xB8, 0x29, 0x76, 0x87, 0xF5, 0xC8, 0x97, 0x74, 0x9F, 0x5A,
+    0x5A, 0xE9, 0xA5, 0x50, 0xE9, 0xD3, 0x9D, 0x76, 0xE7, 0x09, 0xDC, 0x7C, 0x58, 0x0F, 0x98, 0x0C,
+    0xB4, 0x1A, 0xA0, 0xD3, 0x09, 0x38, 0x69, 0xA2, 0x97, 0x66, 0xDA, 0x43, 0xCB, 0xC3, 0xE1, 0x71,
+    0x9B, 0xCD, 0x42, 0xBF, 0xB9, 0xFD, 0x0F, 0xF5, 0xAE, 0xCA, 0xDB, 0xD7, 0x3A, 0x4A, 0x99, 0x8B,
+    0x67, 0xFA, 0xE7, 0xDA, 0xB5, 0x6B, 0xD7, 0xFE, 0x8D, 0x0E, 0x13, 0x44, 0xA3, 0xCA, 0x14, 0xD1,
+    0x8A, 0x5D, 0xE1, 0x50, 0xE7, 0x70, 0x58, 0x8C, 0x7C, 0xE6, 0xA7, 0x4C, 0x81, 0x07, 0xDC, 0x72,
+    0x50, 0x52, 0x4D, 0x2E, 0x56, 0x0A, 0x8C, 0x0B, 0x54, 0x0A, 0x07, 0x74, 0xED, 0x12, 0x68, 0x46,
+    0xDA, 0xB1, 0x59, 0x33, 0xFE, 0xC1, 0x4E, 0x7B, 0x7E, 0xE1, 0x03, 0xFE, 0xBD, 0x44, 0xBB, 0x1F,
+    0x2E, 0x9A, 0xDD, 0x07, 0xC6, 0xF7, 0x12, 0x4D, 0xF2, 0x81, 0xF1, 0x76, 0xA2, 0x4D, 0xE3, 0x82,
+    0x6E, 0xEB, 0x53, 0x25, 0x77, 0xD0, 0xA1, 0x5B, 0x7F, 0x00, 0xDF, 0xA5, 0x96, 0x8A, 0xDD, 0xAE,
+    0x89, 0x4A, 0x5D, 0x04, 0x7F, 0x63, 0x07, 0x37, 0x2B, 0xD0, 0xC7, 0x3E, 0x62, 0x93, 0xC9, 0x34,
+    0x3B, 0x0A, 0x46, 0xF4, 0x6B, 0xA5, 0xD0, 0x08, 0xCD, 0x28, 0x8C, 0x91, 0x7E, 0xEB, 0x13, 0x8D,
+    0xEC, 0x0E, 0x7A, 0x4F, 0xD0, 0x4B, 0x81, 0xA6, 0x58, 0x39, 0x8A, 0xD0, 0x2B, 0x41, 0xA3, 0x1D,
+    0x90, 0x00, 0x57, 0x7A, 0xB5, 0x9C, 0x0B, 0xFE, 0x0C, 0xB4, 0xBB, 0x5F, 0x00, 0x9B, 0xC6, 0xA2,
+    0x3D, 0x5C, 0x04, 0xBA, 0xAD, 0x24, 0x6B, 0xBF, 0xF2, 0x1F, 0xE9, 0x63, 0xBF, 0x21, 0x5C, 0xEC,
+    0x52, 0xAD, 0xC9, 0x2D, 0x36, 0x19, 0x85, 0x71, 0xB6, 0x7B, 0xAB, 0xD9, 0x87, 0x36, 0x5B, 0x45,
+    0x85, 0x46, 0x4E, 0xAB, 0xA6, 0x46, 0xA3, 0x76, 0x0D, 0xA6, 0x2C, 0xB3, 0x8C, 0xF4, 0x23, 0x89,
+    0x5A, 0x3A, 0x96, 0xA8, 0xA4, 0x57, 0x94, 0x41, 0xAA, 0xB4, 0x83, 0x84, 0x12, 0x68, 0xC7, 0x27,
+    0xF0, 0x89, 0x71, 0xA3, 0x5F, 0x68, 0x92, 0xDD, 0xB0, 0x6B, 0xB3, 0xE3, 0x16, 0x23, 0x7C, 0x40,
+    0x6F, 0x6B, 0xC0, 0xFF, 0x65, 0x06, 0x57, 0x30, 0x78, 0x85, 0x56, 0x0B, 0x05, 0x9D, 0x4C, 0x91,
+    0x9A, 0x78, 0x78, 0xE0, 0x94, 0xC0, 0x2B, 0x53, 0xE9, 0x3D, 0x0D, 0x46, 0xC7, 0x0A, 0xAD, 0x9E,
+    0xD5, 0xD2, 0x65, 0xB4, 0xBA, 0xC4, 0x98, 0xFC, 0x46, 0x9F, 0x7D, 0xC0, 0x6E, 0x1A, 0x18, 0x8F,
+    0x85, 0xC9, 0xCD, 0x4E, 0x17, 0x6D, 0x42, 0x53, 0xB7, 0xB6, 0x09, 0x17, 0xDD, 0xC2, 0xF8, 0x81,
+    0x40, 0x77, 0x13, 0x95, 0x34, 0x63, 0xA4, 0x83, 0x05, 0x6E, 0x15, 0xA0, 0xDF, 0x4F, 0xF5, 0xED,
+    0x63, 0xA2, 0xC2, 0x18, 0x8B, 0x4D, 0x48, 0x2B, 0xE8, 0x4E, 0x4D, 0x9B, 0xD4, 0x48, 0x4A, 0x46,
+    0x52, 0xAA, 0xFE, 0x5C, 0xDA, 0xA0, 0x51, 0x84, 0x4E, 0x01, 0x46, 0x41, 0xA5, 0x1D, 0x1A, 0xAD,
+    0xD0, 0x69, 0x29, 0x53, 0xB7, 0x92, 0xA0, 0x51, 0x82, 0x4E, 0x2B, 0x8C, 0xFA, 0xD9, 0xB5, 0x41,
+    0x92, 0x66, 0x49, 0x5A, 0x24, 0x29, 0x4A, 0xD2, 0x7A, 0xE0, 0xD3, 0x66, 0xED, 0x56, 0x73, 0xA6,
+    0x9B, 0xAB, 0xFD, 0x10, 0x85, 0x3A, 0xD1, 0x3F, 0x12, 0x99, 0x84, 0x3B, 0x44, 0x1B, 0x6E, 0x3A,
+    0x8B, 0x86, 0x66, 0x65, 0x3C, 0x8B, 0x3C, 0xAD, 0x56, 0xAF, 0x17, 0xB4, 0x7A, 0xFD, 0xC1, 0x77,
+    0xAF, 0x3E, 0x81, 0x81, 0x7F, 0x45, 0x33, 0xF1, 0x47, 0xB4, 0x33, 0x6F, 0x62, 0x22, 0x6E, 0xA8,
+    0x13, 0x5D, 0x20, 0xD3, 0x46, 0xC6, 0xC1, 0x6C, 0xB8, 0x50, 0xEF, 0xD8, 0x05, 0xD1, 0xAE, 0x8C,
+    0xC1, 0x24, 0xFA, 0xB9, 0x4A, 0xD8, 0x89, 0xC8, 0x45, 0x78, 0x02, 0xF0, 0x6A, 0x15, 0xBD, 0xB0,
+    0x11, 0x4F, 0x7B, 0x88, 0x46, 0x1E, 0xAB, 0xDB, 0x0D, 0x8F, 0xB7, 0xEC, 0xAC, 0xC9, 0xFD, 0xE3,
+    0x7D, 0xE9, 0xDE, 0xD6, 0xDE, 0xEB, 0x5D, 0xED, 0xBD, 0xDE, 0xB9, 0xF6, 0xCD, 0x62, 0x5D, 0x43,
+    0x9D, 0xA1, 0xDF, 0xA9, 0xB5, 0xD3, 0xBF, 0xB3, 0xD7, 0x1B, 0xF9, 0x14, 0xDE, 0x0F, 0xA4, 0x9C,
+    0x95, 0x94, 0x9E, 0x3A, 0x3A, 0x3A, 0x7A, 0xFD, 0x12, 0xF8, 0x01, 0x3F, 0xE1, 0x43, 0xE1, 0x8E,
+    0x00, 0xAA, 0x3C, 0xE0, 0x94, 0x6A, 0x29, 0xDA, 0x79, 0x0C, 0x2F, 0xE3, 0x2F, 0x47, 0x76, 0x1B,
+    0xCC, 0xF6, 0x0C, 0x76, 0x59, 0xE9, 0x8F, 0x67, 0xBC, 0x9D, 0x4C, 0x72, 0x1F, 0x29, 0x7A, 0x29,
+    0x48, 0x7A, 0x56, 0xDA, 0xF1, 0x45, 0x97, 0xB8, 0xE9, 0xAF, 0x0E, 0xFD, 0x9F, 0x5C, 0xA5, 0xBF,
+    0xB5, 0xD3, 0x4B, 0x53, 0x2F, 0xCD, 0xDD, 0xDE, 0xC6, 0x6E, 0xAD, 0xD7, 0x2E, 0x56, 0x5B, 0x17,
+    0x49, 0x36, 0x56, 0xC9, 0x46, 0x93, 0xEC, 0xFE, 0x62, 0xB2, 0xD2, 0xD6, 0x4A, 0xD1, 0x48, 0x73,
+    0xA5, 0x0C, 0x87, 0x55, 0x5A, 0x9B, 0xE9, 0x35, 0x77, 0x5A, 0xED, 0xCF, 0xFE, 0x49, 0x1B, 0x31,
+    0x09, 0x32, 0xB8, 0x09, 0x5B, 0x6E, 0x34, 0xD1, 0xE5, 0xEF, 0x1B, 0x69, 0x72, 0x5A, 0x2B, 0x7F,
+    0xBF, 0x50, 0x8D, 0xA7, 0xA1, 0x3E, 0x0F, 0xFD, 0xBB, 0xA9, 0x2A, 0xF2, 0x98, 0xEC, 0xA7, 0x4A,
+    0xDD, 0xEC, 0x36, 0x37, 0x75, 0x9B, 0x1B, 0xEC, 0xE6, 0xB0, 0x9B, 0xC3, 0xAE, 0x0E, 0xBB, 0xBA,
+    0xA9, 0xDF, 0xFA, 0x42, 0xD4, 0x6E, 0xAD, 0xB4, 0x19, 0x69, 0xE3, 0xFA, 0x02, 0xFD, 0x7D, 0x1A,
+    0x25, 0xDC, 0x4F, 0x92, 0xD9, 0xEA, 0xB5, 0x7B, 0xE7, 0xEB, 0xD1, 0x97, 0xB7, 0x7B, 0x45, 0xDA,
+    0xDD, 0x77, 0x07, 0x72, 0x41, 0xDC, 0x56, 0x57, 0xFF, 0x93, 0x2D, 0xCB, 0xCA, 0xB9, 0x93, 0xF8,
+    0x92, 0x6E, 0x02, 0x95, 0x82, 0x15, 0x3E, 0x99, 0x0D, 0x3B, 0xE3, 0x06, 0xAB, 0xDD, 0x69, 0x95,
+    0xDE, 0xF5, 0x1F, 0x91, 0x69, 0x12, 0x5D, 0x64, 0x0C, 0x95, 0x1E, 0xBD, 0x6C, 0x13, 0x7D, 0x84,
+    0xF1, 0xDE, 0xD6, 0xEA, 0xC1, 0xE2, 0xA5, 0x1B, 0xEB, 0x98, 0xFB, 0xC1, 0xAD, 0x09, 0x7F, 0x6F,
+    0xA9, 0x74, 0x65, 0x32, 0xFB, 0x33, 0xD8, 0x35, 0x31, 0xDE, 0x5B, 0x1B, 0xB5, 0x65, 0xCA, 0xC5,
+    0x5E, 0x0A, 0xBD, 0x44, 0xF7, 0xF3, 0x53, 0x5B, 0x6B, 0x5A, 0x9B, 0xC2, 0x65, 0x48, 0x83, 0x3F,
+    0x98, 0x81, 0x6D, 0x2C, 0x0F, 0x6D, 0x2C, 0x24, 0xD8, 0x59, 0xF8, 0xCB, 0x8C, 0x2D, 0x4D, 0x8F,
+    0xDD, 0x49, 0x1B, 0xBB, 0x68, 0xD6, 0x6E, 0xA9, 0xB7, 0x7E, 0x3E, 0x0F, 0x6E, 0x36, 0xC9, 0xCD,
+    0x26, 0xB9, 0xC5, 0x24, 0xB7, 0x34, 0xC9, 0xC5, 0xB6, 0x84, 0xE3, 0x34, 0xDE, 0xD9, 0xFD, 0x0F,
+    0xAF, 0x01, 0xD4, 0x5B, 0xFF, 0xCA, 0xD6, 0xBF, 0xB2, 0xB9, 0x1B, 0x9B, 0xBB, 0xB1, 0xB9, 0xE3,
+    0xE4, 0x8E, 0x93, 0x9B, 0xE9, 0xA6, 0xFA, 0x20, 0xDF, 0xE7, 0xEE, 0xA9, 0x47, 0xA6, 0xA4, 0x59,
+    0x0F, 0x11, 0x26, 0x9E, 0x46, 0x4D, 0xC4, 0x63, 0x97, 0x3E, 0xD7, 0x9A, 0x5D, 0x32, 0x1A, 0xF8,
+    0x2B, 0xDA, 0x3D, 0x9F, 0x87, 0x2E, 0x40, 0x77, 0xBC, 0xD3, 0xDD, 0x5D, 0xE9, 0x1E, 0x2C, 0xF4,
+    0x0A, 0xF4, 0x2A, 0xD0, 0xD5, 0x6B, 0xC0, 0x69, 0xC6, 0x69, 0xC3, 0xBD, 0x9F, 0x71, 0x77, 0x14,
+    0xDC, 0xDB, 0x8A, 0x2E, 0x28, 0xD9, 0xD9, 0xAC, 0x55, 0x62, 0xA4, 0x0B, 0x6D, 0xAC, 0x13, 0x9E,
+    0x3E, 0xD8, 0x68, 0x36, 0x32, 0x6E, 0xB2, 0xCB, 0xE9, 0xC5, 0xFF, 0x36, 0x5A, 0x94, 0xDC, 0x29,
+    0x13, 0xD9, 0xFC, 0x3C, 0xF3, 0x26, 0xAD, 0xF4, 0x23, 0xCD, 0xAD, 0x24, 0x45, 0xBB, 0xB7, 0xBA,
+    0x9C, 0xEC, 0x66, 0x72, 0x95, 0x6C, 0x34, 0x3B, 0xBB, 0x8D, 0x26, 0x91, 0xBB, 0xB3, 0xB8, 0xCA,
+    0x7D, 0x6C, 0x52, 0x95, 0xFB, 0xA5, 0xDD, 0xEA, 0xEC, 0x0E, 0xB1, 0x5D, 0x6B, 0xB9, 0xD9, 0xAE,
+    0x46, 0x6E, 0xEE, 0xA2, 0x11, 0x80, 0xEB, 0xEF, 0x23, 0x6D, 0x8D, 0xB4, 0x76, 0x27, 0x5D, 0x1C,
+    0xA7, 0xEE, 0xAD, 0x84, 0x6B, 0x23, 0x7B, 0x1F, 0xCC, 0xEA, 0xE9, 0x3E, 0xDC, 0x19, 0x5F, 0x5B,
+    0xEB, 0xEC, 0xE6, 0x76, 0xD3, 0xD4, 0x7F, 0x9C, 0xD1, 0xDD, 0xCD, 0x88, 0x7E, 0xA5, 0x55, 0xC2,
+    0x2B, 0x99, 0xBD, 0xDD, 0xFA, 0xD9, 0x46, 0xD1, 0xDD, 0xDB, 0x70, 0xAF, 0x2D, 0x64, 0x37, 0x99,
+    0x4D, 0x74, 0xF7, 0x72, 0xA5, 0x17, 0x8A, 0xD8, 0x2C, 0xBD, 0x44, 0xAF, 0xC8, 0x93, 0x3B, 0x70,
+    0x89, 0x6A, 0xD7, 0xCA, 0x28, 0x4D, 0x9D, 0xBE, 0xB5, 0x1A, 0x0D, 0x0E, 0x85, 0x36, 0xB8, 0xA5,
+    0x5A, 0xED, 0xC6, 0x1F, 0x9B, 0x4C, 0x37, 0x29, 0x34, 0xB3, 0xDB, 0x9A, 0xD5, 0x96, 0x69, 0x95,
+    0xEB, 0xA2, 0xDC, 0x33, 0xEE, 0xAD, 0xFF, 0x51, 0xF8, 0xD3, 0x04, 0xB5, 0x8A, 0x92, 0xC7, 0x2D,
+    0x07, 0x63, 0xE4, 0xCC, 0x5D, 0xDC, 0xDD, 0x54, 0x4B, 0x1B, 0x5E, 0x9A, 0xEC, 0xEC, 0xD7, 0xBA,
+    0x54, 0xD4, 0xAD, 0x26, 0x22, 0x9E, 0xC1, 0x46, 0xB3, 0x20, 0x1C, 0x5D, 0x34, 0x5B, 0x23, 0xFA,
+    0x62, 0xFC, 0x65, 0x5A, 0x69, 0xA1, 0x57, 0x86, 0xEB, 0xDF, 0xFA, 0x8B, 0x19, 0xFC, 0x0E, 0xAD,
+    0x0E, 0x17, 0x36, 0x0F, 0xB0, 0x95, 0x2A, 0xEC, 0xCF, 0x37, 0xAB, 0x64, 0x95, 0xAC, 0xFE, 0xCC,
+    0xAE, 0xD8, 0x78, 0xEE, 0xBB, 0x48, 0x17, 0xE9, 0x23, 0xFD, 0x8A, 0x5B, 0x71, 0xE5, 0x3F, 0x2A,
+    0x7F, 0x42, 0xAF, 0x8D, 0xFD, 0x6B, 0xC1, 0x2C, 0x85, 0xD7, 0x74, 0x33, 0xB8, 0x3C, 0x30, 0x6A,
+    0xA2, 0xD3, 0x44, 0xA5, 0xE1, 0x89, 0x3A, 0x9B, 0xFB, 0x76, 0xEB, 0xA5, 0x77, 0x25, 0xB5, 0x52,
+    0xAC, 0x6E, 0x9D, 0x9C, 0x77, 0xEC, 0x26, 0x66, 0xA5, 0xDA, 0x61, 0x1C, 0xE8, 0x66, 0xA4, 0xE8,
+    0xB5, 0x3B, 0x69, 0xEA, 0x03, 0x6D, 0xA4, 0x4E, 0xE0, 0xA1, 0xDC, 0x98, 0x04, 0x12, 0x4E, 0xA1,
+    0xD5, 0x5A, 0x29, 0x17, 0x48, 0x6F, 0x63, 0xA2, 0x3F, 0x8E, 0x78, 0x3B, 0xD7, 0xC9, 0x0D, 0x6D,
+    0xDC, 0xE9, 0x8F, 0x37, 0xF4, 0xC2, 0x62, 0xF6, 0x3E, 0xD8, 0xD5, 0xE3, 0xDE, 0xD1, 0x65, 0x3D,
+    0x2F, 0xED, 0x56, 0x5A, 0x7B, 0x69, 0x71, 0xD2, 0xD4, 0x6F, 0xB8, 0x40, 0xF7, 0xC1, 0x8E, 0x49,
+    0x36, 0xE2, 0x26, 0x3F, 0xB4, 0xAB, 0x49, 0x08, 0x37, 0xF7, 0x73, 0x25, 0x93, 0xB0, 0xAB, 0x9F,
+    0xF0, 0x77, 0x63, 0xD9, 0xE3, 0xE8, 0x35, 0x43, 0xB1, 0x2C, 0x26, 0xD0, 0x56, 0x8C, 0x50, 0x17,
+    0xC0, 0xDD, 0x8D, 0xD0, 0x7D, 0xB0, 0x83, 0x5D, 0xC7, 0xE9, 0x8F, 0x4C, 0xB2, 0xD1, 0xBD, 0x95,
+    0xCD, 0xDE, 0xAF, 0x7E, 0x18, 0xBF, 0x2D, 0x17, 0xAC, 0xF4, 0x20, 0x1A, 0x1D, 0xC6, 0x6F, 0xA7,
+    0x2B, 0x56, 0xCF, 0x03, 0x05, 0xF4, 0x53, 0x2D, 0x85, 0x8B, 0x29, 0xA6, 0x3D, 0x80, 0x49, 0xF8,
+    0xA9, 0x8B, 0xDD, 0x82, 0xFF, 0x46, 0xC2, 0x64, 0x0D, 0x74, 0x9A, 0xC1, 0x6F, 0x60, 0x44, 0xB9,
+    0xE8, 0x34, 0xD3, 0xE8, 0x60, 0x7C, 0xB8, 0x38, 0x2E, 0x76, 0xAF, 0xF5, 0x8A, 0x26, 0xBB, 0xBB,
+    0x80, 0x6F, 0x36, 0x5C, 0x10, 0xDD, 0xDC, 0xC5, 0x36, 0x9A, 0xDD, 0x24, 0xC6, 0x90, 0xB1, 0x9B,
+    0xA7, 0x92, 0x0B, 0x38, 0x2D, 0xC5, 0xB8, 0x50, 0x82, 0x2E, 0x9F, 0x16, 0x7B, 0x4A, 0xDB, 0xAF,
+    0x5C, 0xB8, 0x9E, 0x30, 0x07, 0xF3, 0x0B, 0x27, 0xB0, 0x27, 0x85, 0x36, 0xDE, 0x4C, 0xB1, 0x51,
+    0x12, 0xF4, 0xEB, 0xD9, 0xEA, 0xA6, 0xCD, 0x85, 0xC1, 0xF1, 0x0B, 0xB5, 0xC2, 0xC1, 0xAC, 0x39,
+    0x9A, 0xFA, 0x42, 0x67, 0xAC, 0xAE, 0xF0, 0x5C, 0xB4, 0x99, 0x31, 0xA3, 0xBD, 0x12, 0x55, 0xA6,
+    0x2E, 0x7E, 0xA7, 0xDE, 0x31, 0x3B, 0x3E, 0xA1, 0x15, 0x45, 0xFC, 0x46, 0x93, 0x30, 0x9F, 0xF1,
+    0x5A, 0x8D, 0xD6, 0x4A, 0x2B, 0xFD, 0x0A, 0x74, 0xB7, 0x7F, 0xBC, 0xBD, 0xDC, 0x7D, 0xE3, 0x83,
+    0xED, 0xCD, 0xFE, 0xD5, 0x77, 0xD7, 0x1F, 0xF4, 0x2F, 0xDC, 0x5B, 0x77, 0x77, 0xE5, 0x38, 0x26,
+    0x67, 0xDF, 0x7E, 0x1D, 0xF0, 0xF7, 0xF1, 0x3B, 0xA3, 0x40, 0xC3, 0xA9, 0x16, 0x9F, 0x18, 0x8B,
+    0x0F, 0xB8, 0x4C, 0x27, 0xAC, 0xE8, 0x33, 0x6E, 0xC6, 0x85, 0x47, 0x7D, 0xA7, 0xE2, 0x87, 0x6E,
+    0x03, 0xB8, 0x50, 0x5D, 0x4E, 0x4F, 0x8F, 0x1F, 0xBF, 0x77, 0x37, 0xBD, 0x31, 0xFE, 0xCF, 0x3F,
+    0x29, 0xDB, 0x85, 0xAF, 0xFF, 0x03, 0x9E, 0x69, 0x82, 0x7D, 0x27, 0x35, 0xC9, 0x3F, 0x9B, 0xDD,
+    0x3C, 0xBE, 0x10, 0xDB, 0x55, 0x8C, 0x3F, 0x49, 0x95, 0x6E, 0x45, 0x93, 0x7C, 0xB0, 0x6F, 0x6F,
+    0x7C, 0xA5, 0x1D, 0x18, 0x9E, 0x00, 0x0C, 0xAF, 0xF3, 0x74, 0x3B, 0x9D, 0x61, 0xD0, 0x9D, 0x95,
+    0xDC, 0xCF, 0xF6, 0x61, 0x36, 0xD9, 0xBF, 0xA3, 0x5B, 0xD1, 0xFD, 0x65, 0xAA, 0x37, 0xC7, 0xEF,
+    0x9A, 0xC0, 0xF0, 0x7B, 0x05, 0xA3, 0x0F, 0x54, 0x20, 0x1A, 0xCE, 0x08, 0xC1, 0xEA, 0xAB, 0x8F,
+    0xD3, 0x99, 0x45, 0x2F, 0xB8, 0x85, 0x62, 0x47, 0x82, 0x56, 0x0A, 0xDB, 0x8A, 0xC9, 0x09, 0x70,
+    0xDF, 0x5E, 0xA0, 0x5D, 0x05, 0xA8, 0x5D, 0xA1, 0x5B, 0xC6, 0xE9, 0xB0, 0x71, 0xEA, 0x82, 0x5B,
+    0x68, 0x53, 0x25, 0xD0, 0x47, 0xB7, 0x56, 0x3A, 0x49, 0x93, 0x91, 0xCA, 0xEE, 0x85, 0x96, 0x03,
+    0xF5, 0x13, 0x70, 0x6B, 0x97, 0xA8, 0x75, 0x43, 0x03, 0x5D, 0x82, 0x3A, 0x02, 0x3C, 0x73, 0xB6,
+    0x5D, 0x4A, 0x02, 0xE8, 0x27, 0x7E, 0x05, 0xF7, 0xDB, 0x68, 0x6F, 0x71, 0x6F, 0x40, 0xE1, 0x4E,
+    0x68, 0x34, 0x41, 0x81, 0x8E, 0xF1, 0xF9, 0x0D, 0xBA, 0xD0, 0x2E, 0xBF, 0xED, 0x46, 0x5E, 0xB8,
+    0x7A, 0x69, 0x00, 0x15, 0x7E, 0x67, 0x0C, 0x54, 0x6A, 0x13, 0xF4, 0xAB, 0x02, 0x46, 0xAF, 0xED,
+    0xFF, 0x1F, 0xBD, 0xC9, 0xBF, 0x7B, 0x2E, 0x17, 0x22, 0xD0, 0xCF, 0x07, 0x44, 0x7A, 0x62, 0x3D,
+    0x50, 0x97, 0x6E, 0x81, 0xFA, 0x3B, 0xC5, 0x92, 0x59, 0xCB, 0xB2, 0xDC, 0xA6, 0xCF, 0x4E, 0x89,
+    0x5F, 0x33, 0x49, 0x4B, 0x15, 0x8B, 0x56, 0x7B, 0xF9, 0xB0, 0xA7, 0x15, 0xFE, 0x1A, 0xE1, 0xFE,
+    0x75, 0xD7, 0x0D, 0xD0, 0x0D, 0x20, 0xB0, 0x02, 0x09, 0xBB, 0x88, 0x9D, 0xF1, 0x91, 0x3A, 0xEB,
+    0x23, 0xAF, 0x17, 0xCB, 0x9E, 0xEF, 0x4F, 0xA5, 0xA3, 0xE7, 0x0F, 0x95, 0x1D, 0xEA, 0x6E, 0xF3,
+    0xAD, 0x52, 0x99, 0x4A, 0xDD, 0x09, 0xFA, 0x05, 0xFC, 0x84, 0xD1, 0xD1, 0xD1, 0x95, 0xC2, 0xBE,
+    0xA6, 0xC3, 0x56, 0xE1, 0x03, 0x49, 0xE1, 0xC2, 0xD5, 0x4B, 0x83, 0x0B, 0x42, 0xCF, 0x27, 0xB3,
+    0x77, 0xB1, 0xDB, 0xFC, 0xEC, 0x3F, 0xD4, 0x67, 0xE6, 0xF6, 0xAF, 0xBB, 0x52, 0x37, 0xD3, 0x2F,
+    0xF4, 0x0B, 0x7D, 0xA4, 0xBA, 0xFA, 0xA8, 0x90, 0x67, 0xDA, 0x8D, 0x7E, 0xC1, 0x4F, 0x75, 0xA6,
+    0xD9, 0xE8, 0xCE, 0xB7, 0xFC, 0xBB, 0xE5, 0xD1, 0x15, 0x80, 0x0F, 0xB5, 0x68, 0x13, 0x6E, 0x45,
+    0xB3, 0xD1, 0xD0, 0xCC, 0xA9, 0xBB, 0xB1, 0x3E, 0xFA, 0xA6, 0xB0, 0x9B, 0x7F, 0x75, 0xF3, 0xAF,
+    0x9E, 0x51, 0xC9, 0xDB, 0x78, 0x3B, 0x8D, 0xB7, 0x93, 0xBF, 0x93, 0xFC, 0xDD, 0x5D, 0xEF, 0xEF,
+    0x00, 0xD5, 0x56, 0x36, 0x75, 0x85, 0x51, 0x22, 0xB7, 0xD1, 0x0D, 0x9F, 0x1D, 0x72, 0xBB, 0x81,
+    0x9F, 0xCA, 0xDE, 0x53, 0x49, 0xC6, 0x89, 0xE6, 0xF3, 0x49, 0xA0, 0x49, 0x67, 0xC9, 0x39, 0x77,
+    0x6F, 0x77, 0xD0, 0x8C, 0xDD, 0xB9, 0x34, 0x5C, 0x6B, 0x57, 0x77, 0xBC, 0xDB, 0x55, 0xDF, 0xD8,
+    0xC7, 0x1F, 0xEB, 0xDB, 0xC9, 0x2F, 0x9F, 0x9B, 0xE5, 0x19, 0xFC, 0x44, 0xBF, 0xD0, 0x6E, 0xD4,
+    0x19, 0xC6, 0x89, 0x6E, 0xA1, 0xD9, 0xA8, 0xCE, 0x6F, 0x12, 0x95, 0x60, 0x0C, 0x74, 0x91, 0x36,
+    0x51, 0x0B, 0x7C, 0xC0, 0xAD, 0xD8, 0x1D, 0xA3, 0x81, 0x66, 0x89, 0xA0, 0xD7, 0x06, 0xBA, 0x37,
+    0x23, 0xF5, 0x43, 0x41, 0xD7, 0xCE, 0x9F, 0x93, 0xDE, 0xBF, 0x53, 0xEA, 0x76, 0x9C, 0xCE, 0x21,
+    0x6B, 0x3E, 0xD3, 0x66, 0x17, 0xAE, 0x3E, 0xD6, 0x82, 0x27, 0xF3, 0x00, 0xA3, 0x32, 0x85, 0x7B,
+    0x1D, 0xF3, 0x75, 0xE1, 0x56, 0xFC, 0xD2, 0x47, 0x6C, 0xB2, 0x1B, 0x95, 0x9E, 0x4F, 0xE0, 0x1E,
+    0x8A, 0xB2, 0x99, 0x53, 0x48, 0x5E, 0x77, 0x77, 0x05, 0xFB, 0x49, 0x3E, 0x90, 0xBC, 0x95, 0x5C,
+    0x04, 0x7F, 0x27, 0xC3, 0xF8, 0x50, 0x27, 0x7F, 0xA0, 0x34, 0x4A, 0xCA, 0x56, 0x65, 0x15, 0x5E,
+    0x56, 0x7B, 0x0A, 0x85, 0x03, 0x3D, 0x27, 0x09, 0xA1, 0x0D, 0x80, 0x59, 0xCE, 0x0E, 0x00, 0x25,
+    0x80, 0x37, 0x7F, 0x05, 0xA5, 0xF6, 0x5B, 0x6E, 0xF7, 0x79, 0xE3, 0x9B, 0xED, 0x54, 0xBD, 0x35,
+    0xDA, 0xA0, 0x59, 0xC7, 0x89, 0x26, 0xD6, 0xDB, 0xA3, 0x19, 0x2B, 0x7F, 0x1F, 0x1A, 0x69, 0xA1,
+    0x91, 0x44, 0xA3, 0xBF, 0x50, 0x34, 0x1A, 0xDA, 0x5C, 0x0B, 0x14, 0x34, 0xD1, 0xAD, 0x63, 0xC0,
+    0xA8, 0x8F, 0x07, 0xFE, 0xBC, 0xFB, 0x38, 0x83, 0x49, 0x1A, 0x0E, 0xFC, 0xB9, 0x7B, 0x7F, 0x83,
+    0xEE, 0x63, 0x41, 0x9B, 0xFC, 0x42, 0xA3, 0x5E, 0xDF, 0x7C, 0x51, 0xB7, 0xCF, 0xE8, 0xA6, 0xB5,
+    0xD3, 0x01, 0xD3, 0x53, 0x21, 0xEA, 0xB9, 0xAE, 0xFB, 0xA7, 0xD5, 0x5F, 0x1A, 0xAE, 0x81, 0x8D,
+    0xE3, 0x44, 0x93, 0xFA, 0x78, 0xD0, 0x73, 0xFE, 0x9E, 0xC0, 0xAD, 0xFA, 0xBC, 0x50, 0xFE, 0x76,
+    0x5B, 0x5B, 0x7D, 0xF5, 0xB0, 0x72, 0x3E, 0x30, 0xC2, 0xD3, 0x41, 0x25, 0x7D, 0x6E, 0xEA, 0xEC,
+    0x58, 0x69, 0x46, 0x8F, 0x73, 0xBE, 0x9A, 0xF1, 0x3F, 0x79, 0x84, 0xF3, 0x6D, 0xCF, 0x38, 0xDF,
+    0xDD, 0x07, 0xC6, 0x3B, 0x89, 0x26, 0x8D, 0x01, 0x7F, 0x3B, 0x63, 0xD3, 0xA8, 0x5B, 0x3A, 0x56,
+    0xD9, 0x10, 0xD4, 0x2B, 0x92, 0xA2, 0x95, 0x32, 0xBD, 0x74, 0x3A, 0xD0, 0xCF, 0x00, 0xCD, 0x7C,
+    0x10, 0xCC, 0x2E, 0x94, 0x63, 0x3B, 0xBF, 0x82, 0xFB, 0xCD, 0xB4, 0xEE, 0xF4, 0x74, 0x5A, 0x9D,
+    0x01, 0xBF, 0x96, 0xB5, 0x52, 0xBB, 0x8E, 0xC3, 0x39, 0xBF, 0xF6, 0x1B, 0x6F, 0x54, 0x6E, 0x56,
+    0xBA, 0xE8, 0xA7, 0x5A, 0x76, 0xC3, 0x45, 0x05, 0x23, 0x9B, 0xB8, 0x74, 0xF5, 0xDA, 0xF0, 0xF9,
+    0x06, 0xFD, 0x06, 0xB8, 0xFB, 0x76, 0x2D, 0xFA, 0xBE, 0x4D, 0x87, 0xA3, 0x16, 0xE7, 0x96, 0x4B,
+    0x77, 0x1F, 0x73, 0xE0, 0xA1, 0xF6, 0x26, 0x35, 0x4B, 0xBB, 0x3A, 0xEC, 0x9C, 0x70, 0x37, 0x16,
+    0xB2, 0x1D, 0xEA, 0xF4, 0x34, 0x6D, 0xDC, 0x70, 0xC7, 0xF9, 0xD6, 0x29, 0x71, 0xB5, 0x76, 0xD2,
+    0xDC, 0x9E, 0x00, 0x6C, 0x65, 0xFE, 0xBB, 0x72, 0xBC, 0xCB, 0xFE, 0x52, 0x1B, 0xE5, 0x8B, 0xD5,
+    0x02, 0xD8, 0x09, 0x34, 0x60, 0x35, 0x20, 0x0D, 0x36, 0xFA, 0x21, 0x33, 0x0E, 0xBF, 0x06, 0x5A,
+    0xB4, 0xBA, 0x7A, 0x69, 0xE8, 0x67, 0x0D, 0xBA, 0xB1, 0x9B, 0x6C, 0x37, 0x9B, 0xC6, 0x65, 0xFC,
+    0xA9, 0x1E, 0xED, 0xC8, 0x17, 0x25, 0x5D, 0xFF, 0x76, 0xC4, 0xA8, 0xEE, 0x63, 0x27, 0x9A, 0x4C,
+    0xF5, 0xED, 0xC0, 0x18, 0xE9, 0x22, 0x17, 0x6F, 0x9E, 0x0D, 0x60, 0x93, 0xA0, 0x79, 0x7C, 0x00,
+    0x1F, 0xB5, 0x8E, 0xF2, 0xC0, 0xA8, 0x60, 0xB2, 0x0F, 0x6E, 0xEA, 0x9F, 0xDD, 0x2F, 0x8D, 0x6D,
+    0x91, 0xD1, 0x55, 0xD2, 0xBD, 0x4F, 0xBF, 0x8A, 0x5D, 0x0A, 0xA0, 0xF8, 0x9F, 0x5D, 0x9C, 0x0F,
+    0xAD, 0xAC, 0xA4, 0xC8, 0x29, 0x27, 0x62, 0x16, 0xE8, 0x07, 0x48, 0xD0, 0x2E, 0xE5, 0x40, 0xDE,
+    0xDF, 0xE8, 0xDA, 0x13, 0x2A, 0x09, 0xFB, 0xA9, 0xC8, 0xFC, 0xA0, 0x59, 0xAF, 0xA5, 0xBE, 0x10,
+    0xFF, 0xF7, 0x24, 0x5D, 0xF9, 0x3F, 0x57, 0x71, 0x65, 0xE8, 0x6A, 0xFD, 0xAF, 0x27, 0x2F, 0x4B,
+    0x7B, 0x53, 0x76, 0xEE, 0x42, 0xED, 0xEF, 0x1F, 0x2A, 0x9C, 0xA9, 0x14, 0xE8, 0x14, 0xEA, 0xBD,
+    0x0F, 0x7D, 0xF8, 0xA5, 0x96, 0xEE, 0x17, 0x20, 0x76, 0xAB, 0xAB, 0x17, 0x86, 0x6E, 0xF1, 0x83,
+    0xBF, 0x91, 0x8D, 0xEC, 0x66, 0x93, 0x8B, 0xEE, 0xF1, 0x51, 0xFE, 0x35, 0x55, 0x74, 0x0D, 0x93,
+    0xB0, 0x2B, 0x6E, 0xE1, 0xBC, 0xF8, 0x37, 0x69, 0x97, 0xD3, 0xC8, 0x2E, 0xE4, 0x43, 0x14, 0xD1,
+    0x21, 0x5A, 0xE1, 0x99, 0x76, 0x4E, 0xFD, 0x8D, 0x73, 0x5C, 0x2D, 0x9C, 0x6C, 0x5F, 0x38, 0xD9,
+    0x1B, 0xC9, 0x1D, 0x27, 0x77, 0xBC, 0x63, 0x27, 0xEA, 0x1D, 0xC6, 0x48, 0xA7, 0xD0, 0xAC, 0xFE,
+    0xD9, 0x54, 0x3D, 0xBA, 0x44, 0xAB, 0x37, 0xE8, 0xA7, 0x47, 0x13, 0x37, 0x95, 0x73, 0x7B, 0x87,
+    0xE4, 0xEC, 0xF0, 0xA0, 0x29, 0xE7, 0xFD, 0xFA, 0x57, 0x0E, 0x84, 0x6F, 0xB1, 0x48, 0xCF, 0x4B,
+    0x7A, 0xF3, 0x11, 0x9F, 0x1F, 0xF7, 0x8F, 0x1D, 0x5F, 0x1C, 0xE8, 0x2E, 0x07, 0x74, 0x85, 0xF6,
+    0xC1, 0x1B, 0x7C, 0xD9, 0x45, 0xDE, 0xE8, 0x3F, 0x2B, 0x34, 0xFF, 0xAF, 0xC4, 0xE8, 0x5F, 0x03,
+    0x5A, 0xED, 0x4E, 0x2D, 0xD1, 0x4B, 0xE8, 0xB9, 0xDC, 0xAE, 0x26, 0xB9, 0xD0, 0xAC, 0x19, 0xFB,
+    0xE1, 0x29, 0x6D, 0x1A, 0x9A, 0x55, 0xD3, 0xF8, 0xAE, 0x24, 0x53, 0xF6, 0x07, 0x42, 0xAB, 0xC4,
+    0x45, 0x0D, 0x7F, 0x0B, 0xD0, 0xFA, 0x62, 0xB5, 0xFC, 0x4D, 0xA0, 0x85, 0x9F, 0xE9, 0x15, 0xCB,
+    0x61, 0xC0, 0x7E, 0xF1, 0x83, 0x3B, 0x4E, 0x8C, 0x57, 0x0E, 0x9C, 0x6F, 0xC6, 0x7E, 0x98, 0x18,
+    0xAF, 0x6C, 0xCD, 0x7E, 0xE0, 0xB1, 0x26, 0xAF, 0x84, 0x57, 0xE0, 0xFA, 0x7A, 0x00, 0x2D, 0x3F,
+    0xF8, 0x1B, 0x7B, 0x11, 0xE7, 0xCF, 0x81, 0xD6, 0x17, 0x29, 0xFD, 0xC2, 0xD5, 0xC2, 0x57, 0x74,
+    0x8F, 0xAC, 0x77, 0x1F, 0x19, 0xCE, 0x2F, 0xC0, 0x79, 0x9E, 0x83, 0x0C, 0xE7, 0x20, 0xF3, 0xCB,
+    0x5E, 0xFF, 0x17, 0xAA, 0xC8, 0x2C, 0xE5, 0xCC, 0xB2, 0x02, 0xBD, 0x42, 0xBD, 0xBB, 0xCF, 0x02,
+    0xCB, 0x69, 0xC9, 0xE1, 0xBC, 0xE4, 0x15, 0x6F, 0x17, 0xB3, 0xF7, 0x93, 0x5D, 0x3D, 0xEE, 0xDD,
+    0x84, 0x9E, 0xDF, 0xED, 0xDE, 0x15, 0x0A, 0x71, 0xF6, 0xD2, 0x24, 0x65, 0xFC, 0x42, 0xB3, 0xF6,
+    0x73, 0xBF, 0x68, 0xD0, 0xF1, 0x01, 0x4D, 0xC6, 0xF8, 0x19, 0xD5, 0xFE, 0x45, 0x4A, 0xE7, 0xA2,
+    0xDE, 0xB9, 0xF6, 0xEF, 0x8E, 0x86, 0xF2, 0x41, 0x41, 0xE8, 0x4E, 0x3F, 0x2F, 0xF8, 0x96, 0xA4,
+    0xCD, 0xEE, 0xB8, 0x04, 0x6D, 0xC2, 0xA8, 0x2C, 0x66, 0xC6, 0x72, 0xB2, 0xA8, 0x2B, 0x8B, 0xBC,
+    0x46, 0x87, 0x43, 0xBA, 0x3F, 0x59, 0xED, 0x06, 0x5E, 0xBB, 0xD9, 0xA1, 0x97, 0x06, 0x4D, 0xB4,
+    0xD2, 0xEC, 0x16, 0x6A, 0x95, 0xF3, 0xAB, 0x3E, 0x96, 0xF7, 0x93, 0xC0, 0xEB, 0x4F, 0xFD, 0x61,
+    0x37, 0x58, 0x1F, 0x1D, 0x5D, 0x2E, 0x27, 0x90, 0xE3, 0x58, 0xBE, 0x88, 0x28, 0x1F, 0x46, 0x68,
+    0x28, 0xB7, 0x4B, 0xE5, 0x75, 0x46, 0x12, 0x00, 0xFD, 0x56, 0xF9, 0x89, 0x4E, 0xAB, 0xD7, 0xD0,
+    0x4A, 0xFA, 0x28, 0xA1, 0xE7, 0x14, 0x9B, 0xA5, 0x9F, 0x6D, 0xBE, 0x34, 0x9A, 0xC4, 0x28, 0x6D,
+    0x6E, 0x32, 0x92, 0x8E, 0x37, 0x9C, 0x94, 0xDC, 0x64, 0xF2, 0x35, 0x4C, 0x62, 0x0C, 0xE0, 0x96,
+    0x2E, 0xC3, 0x73, 0x92, 0xF2, 0xF0, 0xFD, 0xF2, 0x2D, 0xC5, 0xE4, 0x25, 0x69, 0xAB, 0xA5, 0x4E,
+    0x9A, 0x6A, 0x0D, 0x4F, 0x96, 0x35, 0x47, 0x23, 0x29, 0x7B, 0x49, 0xEF, 0x49, 0xDA, 0x5F, 0x3A,
+    0x3A, 0x3A, 0x9C, 0x05, 0xA5, 0x29, 0x2D, 0xF4, 0x92, 0xA4, 0x5F, 0x48, 0x92, 0xF2, 0x4B, 0x47,
+    0x47, 0x47, 0x47, 0x47, 0x37, 0xC7, 0xCD, 0x66, 0xA3, 0xC9, 0x2F, 0x36, 0x19, 0xE1, 0x97, 0x2E,
+    0xD5, 0x47, 0x58, 0x19, 0x05, 0x2D, 0xFD, 0x6A, 0x53, 0x93, 0x8D, 0x06, 0x85, 0xA7, 0x6E, 0x32,
+    0x6E, 0x2E, 0xD9, 0x6C, 0x65, 0xF4, 0x8A, 0x26, 0xBF, 0x8C, 0x8B, 0x4D, 0x36, 0x19, 0xD5, 0x1A,
+    0xFC, 0x32, 0x2E, 0x5D, 0xB2, 0xA9, 0x3E, 0xAA, 0x8E, 0xB0, 0x6A, 0x75, 0x59, 0x6F, 0x2B, 0x68,
+    0xF1, 0x4B, 0xBF, 0xF6, 0xAB, 0x4D, 0xA5, 0x14, 0xA3, 0xE7, 0x34, 0x29, 0x68, 0x7E, 0xEA, 0xE6,
+    0x53, 0xAF, 0x73, 0x61, 0xB8, 0x70, 0xB5, 0xBA, 0xDA, 0xCF, 0x36, 0xB6, 0xAB, 0x5B, 0xEC, 0x6A,
+    0xB7, 0x43, 0x1C, 0xBB, 0xCD, 0xA6, 0x31, 0xF6, 0x5B, 0x97, 0xFE, 0x2F, 0x7D, 0x98, 0xBF, 0xAF,
+    0x1E, 0xC7, 0x75, 0x86, 0xDF, 0xDD, 0x09, 0xB9, 0x40, 0xB6, 0x98, 0x4A, 0x49, 0x10, 0x02, 0xD9,
+    0x26, 0x85, 0xA1, 0x66, 0xFE, 0x01, 0x93, 0xB3, 0x14, 0x0B, 0x15, 0x2A, 0xA8, 0x20, 0x62, 0x52,
+    0xA8, 0x50, 0x95, 0xC6, 0x40, 0xC0, 0x26, 0x45, 0x0A, 0x5A, 0xBB, 0xB6, 0x80, 0xB8, 0x50, 0xA1,
+    0xDB, 0xA4, 0x72, 0x61, 0x17, 0x0A, 0x10, 0xD3, 0x05, 0x53, 0xA4, 0x30, 0x02, 0x89, 0xB3, 0xD4,
+    0x2D, 0x18, 0x80, 0x40, 0xB8, 0x12, 0x63, 0x18, 0x08, 0x0B, 0xAE, 0x44, 0x19, 0x8E, 0xCD, 0x82,
+    0x23, 0x6A, 0x28, 0xED, 0x25, 0x67, 0xE7, 0x49, 0xB1, 0xF7, 0x8A, 0xA4, 0x63, 0xFB, 0xFB, 0xBE,
+    0xB3, 0x33, 0xB3, 0xFB, 0x61, 0x7F, 0x9C, 0x9D, 0x73, 0xDE, 0xE7, 0xCC, 0xA9, 0xD7, 0x5F, 0xEA,
+    0xFD, 0x84, 0x78, 0x35, 0x9B, 0xAD, 0x8B, 0xDD, 0x1A, 0xE6, 0x70, 0x9F, 0x51, 0x2F, 0x7C, 0xEA,
+    0xAB, 0x81, 0xB7, 0x20, 0x0F, 0xF0, 0x05, 0x5C, 0x7D, 0x75, 0x95, 0xBA, 0x45, 0x1A, 0x46, 0x55,
+    0x45, 0x6A, 0xCB, 0xB5, 0xD9, 0x41, 0x1F, 0xD8, 0x6A, 0x48, 0x6D, 0x96, 0xDC, 0x22, 0x85, 0x51,
+    0x86, 0xAB, 0x57, 0x2F, 0x02, 0x1E, 0x32, 0xF0, 0x35, 0xF0, 0x10, 0x98, 0x24, 0x3F, 0x49, 0x32,
+    0x45, 0x92, 0x42, 0x94, 0x64, 0xE9, 0xA5, 0x8A, 0x55, 0x92, 0x7F, 0x38, 0x49, 0xE6, 0xA8, 0x48,
+    0x0A, 0x17, 0xA3, 0x64, 0x63, 0xE8, 0x55, 0x95, 0x66, 0x95, 0xFC, 0xEC, 0x27, 0x99, 0x6C, 0x8A,
+    0x14, 0xA6, 0x2E, 0xCA, 0x96, 0xAB, 0xF4, 0x15, 0xB0, 0xCA, 0x03, 0x93, 0x01, 0x8A, 0x02, 0x10,
+    0x6D, 0x96, 0xE1, 0x3C, 0x93, 0xDC, 0xEA, 0x93, 0x2A, 0xA6, 0x97, 0xAF, 0x5E, 0x7D, 0x07, 0x56,
+    0x0F, 0x26, 0x4B, 0x7E, 0xD2, 0x71, 0x53, 0x73, 0x24, 0xB7, 0xDF, 0xB9, 0x9B, 0xDC, 0x47, 0x59,
+    0xD9, 0x4D, 0xED, 0xC7, 0x59, 0x5B, 0xF7, 0x9B, 0x70, 0x03, 0x72, 0x07, 0xE7, 0x61, 0xB1, 0xE5,
+    0x40, 0x92, 0x04, 0x07, 0x06, 0xA2, 0x9D, 0xDA, 0xE8, 0x65, 0xA7, 0x2C, 0x67, 0x62, 0x95, 0x2D,
+    0xCC, 0x9E, 0x55, 0x90, 0xCC, 0xE3, 0x37, 0xB3, 0x9D, 0xEA, 0xD5, 0xCB, 0xC4, 0x2C, 0x7B, 0x18,
+    0x85, 0x85, 0xEC, 0x21, 0x02, 0x06, 0x16, 0x49, 0xDA, 0x3D, 0xC9, 0x4D, 0xA0, 0x7B, 0x7C, 0xE9,
+    0x8D, 0x63, 0x4F, 0x36, 0x59, 0xEA, 0xA2, 0x34, 0x4C, 0xAA, 0x91, 0xDA, 0x2C, 0xB9, 0x28, 0x85,
+    0xE7, 0x86, 0x49, 0x0A, 0xB3, 0x6A, 0x7A, 0xB5, 0x9B, 0xF4, 0xE7, 0xEF, 0x4B, 0x7A, 0xF9, 0xEA,
+    0x55, 0x55, 0x90, 0xD5, 0x40, 0x54, 0x07, 0x93, 0x82, 0x82, 0xEA, 0x5C, 0x67, 0xB5, 0xB1, 0x4D,
+    0x72, 0x93, 0x9B, 0x15, 0x14, 0x7A, 0x93, 0xEB, 0x4D, 0x36, 0xB6, 0x49, 0x7E, 0x72, 0xB3, 0x50,
+    0x18, 0x4D, 0xAE, 0x8B, 0xFC, 0xD2, 0xAE, 0x35, 0x72, 0x4B, 0x00, 0x8E, 0x00, 0xEE, 0x00, 0x58,
+    0x20, 0xFB, 0x59, 0x5D, 0x0C, 0xBD, 0xC2, 0x78, 0x49, 0xD5, 0x1B, 0xD2, 0x4B, 0x97, 0xDE, 0xEF,
+    0x60, 0xED, 0x20, 0x75, 0x10, 0xDD, 0x22, 0xB9, 0xF9, 0x39, 0x7B, 0x72, 0x55, 0x0E, 0xE4, 0x40,
+    0x1E, 0xE4, 0x17, 0xC9, 0xCF, 0xC7, 0xF6, 0xCB, 0x4B, 0xAF, 0x7B, 0x48, 0x7E, 0x7F, 0x0F, 0xAB,
+    0xDF, 0xFD, 0x92, 0x6B, 0x7A, 0x56, 0xBB, 0xC9, 0x60, 0x58, 0x86, 0x45, 0x6D, 0xB1, 0x5C, 0x40,
+    0xB2, 0xD9, 0x6D, 0x6E, 0x95, 0xBA, 0x35, 0x44, 0x26, 0xC9, 0x3D, 0xE6, 0xD6, 0x26, 0xC9, 0x7F,
+    0x8D, 0x5F, 0x24, 0x0D, 0x0F, 0x61, 0x7F, 0x27, 0xA4, 0xE3, 0x76, 0x92, 0x54, 0x43, 0x96, 0xA4,
+    0x13, 0x5F, 0x5B, 0x18, 0x25, 0x55, 0xC7, 0x87, 0xBB, 0xBD, 0xAD, 0xD9, 0x5B, 0x07, 0x30, 0xAB,
+    0xE6, 0x88, 0xDB, 0xCC, 0xF2, 0xDC, 0xA2, 0x63, 0x31, 0x64, 0x97, 0x3B, 0x16, 0xCF, 0x14, 0x92,
+    0x23, 0x9E, 0x0E, 0x07, 0x0D, 0x54, 0x10, 0x5F, 0xAA, 0x37, 0xC9, 0x8F, 0xB2, 0xB3, 0xDA, 0xD8,
+    0x92, 0x6A, 0xA2, 0x02, 0xBD, 0xDA, 0x28, 0x15, 0xC9, 0xFF, 0xA7, 0xBA, 0x2F, 0x7F, 0x7D, 0x79,
+    0x85, 0xE2, 0xC1, 0x82, 0xC2, 0x91, 0x90, 0x64, 0xA3, 0x5C, 0x44, 0x86, 0x8B, 0x49, 0x21, 0x85,
+    0xDE, 0xF2, 0x5A, 0xAA, 0x58, 0x43, 0xEF, 0x79, 0x77, 0x6D, 0x58, 0x87, 0x11, 0x6E, 0xAE, 0xDD,
+    0xC3, 0x3C, 0x1C, 0x6E, 0xDC, 0xCC, 0xC3, 0xED, 0x3C, 0xDC, 0x4E, 0x1C, 0x6E, 0xD8, 0xEC, 0x59,
+    0xB8, 0x43, 0xB6, 0x9B, 0x67, 0xE4, 0x0E, 0xC9, 0x16, 0x4F, 0xC5, 0x7D, 0xE6, 0xAE, 0xF8, 0x5C,
+    0x11, 0xED, 0x64, 0x27, 0xF1, 0x70, 0x95, 0x85, 0x5E, 0x9E, 0x45, 0x0A, 0x8B, 0xFE, 0xC0, 0xC7,
+    0x46, 0x49, 0xA8, 0xC6, 0x46, 0xF9, 0x44, 0xDF, 0xF2, 0x5A, 0x12, 0x29, 0xF4, 0x1D, 0xEF, 0x26,
+    0xC3, 0x1A, 0xC6, 0x81, 0x1F, 0xAC, 0x96, 0x3C, 0x7C, 0xAF, 0x70, 0x33, 0xFB, 0x7B, 0x79, 0xB8,
+    0x99, 0xB9, 0x99, 0xB9, 0x98, 0xFD, 0xBD, 0xC8, 0x21, 0xC5, 0x6E, 0x9E, 0x89, 0x3B, 0xAC, 0x76,
+    0xF3, 0xF4, 0xDC, 0x27, 0x76, 0xC5, 0x6F, 0x15, 0xF7, 0x99, 0x3A, 0xDA, 0x64, 0xB3, 0xFC, 0x1C,
+    0x16, 0x61, 0x90, 0xC9, 0x2E, 0xC9, 0x7E, 0xC1, 0xA8, 0xE1, 0x76, 0x56, 0x55, 0x86, 0x45, 0xCD,
+    0x53, 0x24, 0x47, 0x92, 0x02, 0xA3, 0x0C, 0x59, 0xB2, 0xCC, 0x92, 0x67, 0x94, 0x60, 0x54, 0x03,
+    0xD3, 0x3E, 0x93, 0x87, 0xDB, 0x4C, 0x35, 0x1D, 0x73, 0x9B, 0x3B, 0x66, 0x1F, 0x1D, 0x0B, 0x93,
+    0x63, 0x11, 0xF0, 0xCC, 0x1E, 0x20, 0xFA, 0xE7, 0xAC, 0x7A, 0xC1, 0xBE, 0xF9, 0x96, 0x8A, 0xBA,
+    0xD4, 0xD4, 0xA5, 0xA6, 0x29, 0x35, 0x6E, 0xAB, 0xF1, 0xB9, 0xC6, 0x2F, 0x35, 0x92, 0x34, 0x2C,
+    0xEA, 0x1E, 0x33, 0x89, 0x5F, 0x30, 0x1A, 0xDE, 0x42, 0xAE, 0x0C, 0x9B, 0x38, 0x22, 0xB7, 0xFC,
+    0x8A, 0xE8, 0xF9, 0x11, 0x9F, 0x52, 0x86, 0x70, 0xFB, 0xE9, 0x51, 0x21, 0xDC, 0x7B, 0xF0, 0x84,
+    0x32, 0x5C, 0xBB, 0xCF, 0xE3, 0x12, 0xDE, 0xE3, 0xE6, 0x93, 0xD2, 0x95, 0xEE, 0xC1, 0xEA, 0x53,
+    0xB8, 0xB6, 0xF0, 0x11, 0xE1, 0x7B, 0x3F, 0x69, 0x4B, 0x91, 0xDC, 0xD3, 0x2C, 0x85, 0xFF, 0x39,
+    0x50, 0xF5, 0x93, 0x61, 0x92, 0xFF, 0x18, 0x89, 0x57, 0xB3, 0xCC, 0xD6, 0x45, 0xD9, 0x34, 0x4C,
+    0xF2, 0x9F, 0x21, 0xF1, 0x6E, 0x96, 0x29, 0x2E, 0xCA, 0xAE, 0x61, 0x92, 0xFF, 0x8C, 0x5E, 0xBC,
+    0xBB, 0xA9, 0xC1, 0x1D, 0x5D, 0xBA, 0x9C, 0x03, 0xF0, 0x08, 0xE0, 0x36, 0x7B, 0x32, 0x25, 0x03,
+    0x7C, 0xC9, 0x58, 0x73, 0xBB, 0xA8, 0xC5, 0xAF, 0x72, 0x99, 0x45, 0x21, 0xEA, 0x34, 0x07, 0x52,
+    0x07, 0xA3, 0x3A, 0xC8, 0xEA, 0xF8, 0x21, 0x93, 0xDD, 0xE4, 0xD6, 0x36, 0xCB, 0x60, 0x8A, 0x34,
+    0x7C, 0x8C, 0x64, 0x73, 0x98, 0x54, 0xE1, 0x17, 0x69, 0xB8, 0xBD, 0x4A, 0xF6, 0xCB, 0x4D, 0x32,
+    0x1B, 0xA3, 0xC4, 0xB0, 0x48, 0xC3, 0xED, 0x2C, 0xB9, 0x47, 0x8C, 0xEA, 0x72, 0x28, 0x7F, 0x35,
+    0xD0, 0x01, 0xBC, 0x03, 0x30, 0x0F, 0x40, 0x6C, 0x81, 0xA8, 0x01, 0xA2, 0xAA, 0xC0, 0xC1, 0x33,
+    0xA9, 0x00, 0xEE, 0x02, 0x97, 0x61, 0x0B, 0xFF, 0xFC, 0xE6, 0x57, 0x9B, 0xBA, 0xBB, 0x49, 0xC3,
+    0xE5, 0xB9, 0xDA, 0x42, 0xDF, 0x1C, 0x0F, 0xC3, 0xE5, 0xA5, 0xDE, 0xC2, 0xD8, 0x3E, 0x29, 0x72,
+    0x0F, 0x56, 0x85, 0x6B, 0x4B, 0x5D, 0x7E, 0x6B, 0xF8, 0x9D, 0xFE, 0xF4, 0xFB, 0x7B, 0x4C, 0x2F,
+    0x06, 0x92, 0x85, 0xE4, 0xA7, 0x2E, 0x22, 0x7B, 0x27, 0xCB, 0xBF, 0x17, 0x2B, 0xFC, 0xCF, 0xAF,
+    0xAD, 0xC0, 0x2F, 0x80, 0x0E, 0xE2, 0x00, 0x15, 0x1C, 0x7C, 0x93, 0x33, 0xF7, 0x24, 0x69, 0x37,
+    0xC9, 0x27, 0x89, 0x45, 0xE6, 0x99, 0xAA, 0x9D, 0xE6, 0x48, 0xCD, 0x7E, 0xE6, 0x4D, 0xC0, 0xE4,
+    0x78, 0x92, 0x0D, 0xF3, 0x2E, 0x46, 0x36, 0x4B, 0x15, 0xA3, 0xE4, 0x56, 0xC9, 0xD0, 0xEF, 0x67,
+    0xD8, 0x3B, 0x59, 0x32, 0xCC, 0x92, 0xE3, 0xE0, 0x4F, 0x6E, 0x00, 0xD9, 0x02, 0xD3, 0x00, 0xB9,
+    0x06, 0xA6, 0x16, 0xB2, 0xCE, 0xC0, 0x74, 0xE9, 0xD2, 0xA5, 0x4B, 0x7F, 0x0D, 0x70, 0x0F, 0x60,
+    0x00, 0x36, 0x80, 0x24, 0x9B, 0xB4, 0x27, 0x43, 0xD1, 0x4B, 0x66, 0x93, 0x7E, 0x7B, 0x57, 0x91,
+    0x64, 0x57, 0x49, 0x7E, 0x39, 0xBE, 0x8F, 0xA6, 0x48, 0xEA, 0xD6, 0x7D, 0x86, 0xAA, 0x62, 0x92,
+    0x1A, 0x24, 0x75, 0xBB, 0x82, 0x85, 0x66, 0x95, 0x9F, 0x90, 0x5D, 0xBA, 0xD8, 0x26, 0xB3, 0x99,
+    0xAC, 0x61, 0x2A, 0xB2, 0xEB, 0xD0, 0xD7, 0xF8, 0x49, 0x9E, 0x45, 0x2D, 0x49, 0x22, 0x4B, 0xAE,
+    0x1C, 0x3F, 0x4A, 0x98, 0x76, 0x11, 0xB7, 0x49, 0xB2, 0x59, 0x86, 0x22, 0x81, 0xE4, 0xE9, 0x65,
+    0x8B, 0x54, 0xBD, 0x7E, 0xE2, 0xAD, 0x06, 0xB2, 0x02, 0x6C, 0xCD, 0x32, 0xDC, 0xC8, 0xAE, 0x42,
+    0x29, 0x35, 0xD9, 0xDC, 0x5F, 0xBA, 0xD8, 0xBD, 0xB7, 0x0C, 0x37, 0x8A, 0x63, 0x4F, 0xEA, 0xBB,
+    0x23, 0x34, 0xC0, 0x81, 0x6A, 0xB4, 0x2B, 0x96, 0x5C, 0xD4, 0x7E, 0xB5, 0x1A, 0x49, 0x76, 0xD3,
+    0xEE, 0x4F, 0xB7, 0xA8, 0xC9, 0x76, 0x95, 0x4D, 0xCD, 0x26, 0xBF, 0x18, 0x14, 0x26, 0xF1, 0x11,
+    0xBD, 0xC2, 0xAF, 0x8A, 0xE4, 0xF7, 0xA4, 0x90, 0xA4, 0x96, 0x45, 0x32, 0x4C, 0xC7, 0x9B, 0x96,
+    0x78, 0x7C, 0xC0, 0x93, 0xA5, 0x40, 0x51, 0xC5, 0x5D, 0x7A, 0xC3, 0x21, 0x53, 0xCB, 0x79, 0x96,
+    0xAE, 0x88, 0xE4, 0xB3, 0x86, 0x1C, 0x56, 0xB9, 0xF2, 0xB2, 0x4E, 0x1F, 0x0C, 0xB2, 0xF3, 0x20,
+    0xBB, 0x9C, 0x58, 0x78, 0xDE, 0xFA, 0xFF, 0x67, 0xF1, 0x99, 0x75, 0x29, 0x40, 0x09, 0xB0, 0x1D,
+    0x5B, 0x96, 0xEA, 0x2C, 0x99, 0xBC, 0xCB, 0xF5, 0xE9, 0xF7, 0x4F, 0xA9, 0x3A, 0xBF, 0xEA, 0x43,
+    0xD7, 0xB7, 0x9F, 0x44, 0x6D, 0x4E, 0xF6, 0x4E, 0x54, 0x39, 0x27, 0x7B, 0x7F, 0x51, 0xF1, 0x72,
+    0xF7, 0xD7, 0xA6, 0x78, 0xF8, 0x14, 0x4A, 0xCB, 0xD3, 0xE5, 0xCC, 0xFA, 0xB6, 0xD4, 0x44, 0x69,
+    0x90, 0xDA, 0x28, 0x05, 0xA9, 0x8D, 0x97, 0xA4, 0x53, 0x6F, 0xA6, 0x6E, 0x26, 0x9C, 0x2F, 0xF6,
+    0x69, 0xEA, 0x96, 0x93, 0xCE, 0x4C, 0x38, 0xBF, 0xBD, 0xD8, 0x09, 0xA1, 0xDF, 0xDA, 0xA7, 0xC9,
+    0xFE, 0xCE, 0x0E, 0xF0, 0x14, 0xE0, 0x9B, 0x8E, 0x24, 0xC9, 0xCD, 0xDF, 0xB9, 0x90, 0xDB, 0xD4,
+    0x2D, 0xD4, 0x5B, 0xB3, 0xFA, 0x29, 0x9C, 0x2F, 0x36, 0xBA, 0x79, 0xB8, 0x90, 0xDB, 0xD4, 0xCD,
+    0xD4, 0x5B, 0x93, 0xFC, 0x14, 0xAA, 0xCD, 0x46, 0x37, 0x0D, 0x17, 0x72, 0x1B, 0xED, 0x1C, 0xEA,
+    0x6C, 0x92, 0x9B, 0x82, 0xB6, 0x36, 0xBA, 0xC9, 0xBF, 0xF2, 0xC2, 0x4E, 0xA0, 0x38, 0x80, 0x5B,
+    0x9C, 0x64, 0xA6, 0xFC, 0xD2, 0xA5, 0x4B, 0x7F, 0xB3, 0xE3, 0x5C, 0x7F, 0x32, 0x9B, 0x6D, 0xDC,
+    0xE7, 0x8F, 0x67, 0x96, 0xA0, 0x97, 0x61, 0x93, 0x54, 0x27, 0x49, 0xED, 0x2C, 0xC9, 0xF5, 0x92,
+    0x3E, 0x94, 0x54, 0x53, 0x7A, 0xB5, 0x30, 0xC9, 0xC1, 0xA8, 0xEB, 0x15, 0xAA, 0xD7, 0x6A, 0x53,
+    0xBB, 0x98, 0x55, 0x6E, 0x74, 0xB3, 0xC2, 0x4F, 0xE9, 0x6B, 0xC8, 0xFB, 0xBF, 0x3C, 0x9F, 0x4B,
+    0x3A, 0x0E, 0x9F, 0x3D, 0x6C, 0x24, 0xFF, 0x49, 0x94, 0x64, 0xD3, 0x07, 0x92, 0xCC, 0xE6, 0x7A,
+    0x49, 0xBC, 0x36, 0x4B, 0xF2, 0x9F, 0x24, 0x49, 0x36, 0x7D, 0xF8, 0xFC, 0x01, 0x8E, 0x24, 0xFF,
+    0x09, 0x44, 0xD9, 0x14, 0x28, 0x32, 0x9B, 0x1B, 0x87, 0x49, 0xBC, 0xBB, 0x34, 0x49, 0xFE, 0xB3,
+    0x55, 0x45, 0x76, 0xBD, 0xAE, 0xD0, 0x1B, 0xDC, 0x6F, 0x98, 0xC5, 0x2D, 0x88, 0xF2, 0x8F, 0x20,
+    0xCA, 0x66, 0x38, 0xD8, 0x43, 0x50, 0x4E, 0x6A, 0x27, 0xD5, 0x49, 0xFA, 0x50, 0x72, 0xBD, 0xDA,
+    0x59, 0x75, 0x92, 0x02, 0x07, 0x0E, 0x5A, 0xF8, 0x6C, 0x6D, 0xF2, 0x75, 0x0D, 0x97, 0x47, 0xFB,
+    0x60, 0x69, 0xBF, 0x2A, 0xD7, 0xB6, 0x00, 0x0E, 0x2C, 0x47, 0xC7, 0xD1, 0xE5, 0x8A, 0xD4, 0xC2,
+    0x28, 0x60, 0xB4, 0x5B, 0x4D, 0x3F, 0x4C, 0x15, 0x26, 0xAB, 0x2E, 0x76, 0x91, 0xC9, 0xBB, 0x23,
+    0x81, 0xD9, 0x00, 0xBD, 0x85, 0x67, 0x39, 0xE3, 0x2E, 0x7D, 0x4B, 0xC7, 0x8E, 0x51, 0x2C, 0x00,
+    0x3D, 0xB0, 0x56, 0xC0, 0xA8, 0xCB, 0x27, 0x69, 0xF9, 0x25, 0xB5, 0x45, 0x76, 0x72, 0x24, 0x13,
+    0x3B, 0xE8, 0xB3, 0x2D, 0x21, 0xFA, 0x76, 0xAD, 0xB3, 0x3D, 0xCC, 0xF2, 0xEF, 0xC4, 0x4D, 0xED,
+    0x02, 0xAA, 0xB2, 0x67, 0xD2, 0x60, 0x89, 0xB2, 0x87, 0x64, 0x35, 0x11, 0xFA, 0x2A, 0xFB, 0x2E,
+    0x0A, 0x7B, 0x58, 0x14, 0xDE, 0x89, 0xC0, 0x9C, 0x1D, 0xC4, 0x73, 0x06, 0x92, 0x1D, 0x3D, 0xC9,
+    0x2C, 0x55, 0x58, 0xA4, 0x96, 0x7C, 0x02, 0x7E, 0x93, 0x9D, 0x9B, 0xD8, 0xC4, 0x2A, 0xD7, 0x59,
+    0x83, 0x50, 0x37, 0xB9, 0xA9, 0x49, 0xED, 0x5A, 0x6D, 0x02, 0xFA, 0x6E, 0x7F, 0x96, 0xB5, 0x86,
+    0x52, 0xF1, 0x2A, 0x63, 0x18, 0x87, 0xC5, 0xCF, 0x5D, 0xEE, 0x52, 0x83, 0x2D, 0x15, 0x87, 0x8C,
+    0xE1, 0x0B, 0x16, 0x97, 0xC3, 0xDA, 0xF2, 0x8D, 0xB2, 0x54, 0xA5, 0x97, 0x27, 0xD7, 0x10, 0xED,
+    0x3C, 0x4C, 0x6F, 0x2B, 0x5C, 0x88, 0xDA, 0xEC, 0x64, 0xD6, 0x73, 0xB2, 0x4B, 0x92, 0x3B, 0x9C,
+    0x15, 0xEC, 0x68, 0xB2, 0xFF, 0x0D, 0x31, 0xC0, 0x04, 0x9C, 0x87, 0x4D, 0xE1, 0x40, 0x92, 0xFE,
+    0x48, 0xD2, 0xB7, 0xA4, 0xD3, 0x51, 0x67, 0x58, 0x2A, 0x98, 0x1A, 0x98, 0x6C, 0xB9, 0x2A, 0xB7,
+    0xEC, 0xE5, 0xC8, 0xF0, 0x4F, 0xEF, 0x2B, 0x40, 0x1F, 0x60, 0x09, 0x90, 0x42, 0x72, 0x39, 0x4C,
+    0x36, 0x0F, 0x53, 0x93, 0x87, 0xA9, 0xC9, 0x7E, 0xB6, 0xD9, 0x97, 0xB0, 0x76, 0xBB, 0xFA, 0xCD,
+    0x15, 0xF4, 0x72, 0xAB, 0x28, 0x82, 0x79, 0xFB, 0xD3, 0x98, 0xAB, 0x94, 0x95, 0x72, 0x1D, 0x61,
+    0x81, 0x58, 0x7E, 0x9A, 0xB3, 0xAE, 0x67, 0x5D, 0xE7, 0x5A, 0x81, 0x02, 0x79, 0xD7, 0xCE, 0xCB,
+    0x70, 0x17, 0x9E, 0x14, 0x29, 0x8C, 0x72, 0x8B, 0xDA, 0x55, 0x35, 0x52, 0x98, 0xE4, 0xA2, 0xDA,
+    0xFC, 0xFC, 0x60, 0x3B, 0x09, 0xA0, 0x24, 0xCB, 0x26, 0x03, 0xBD, 0x36, 0x37, 0x6B, 0x68, 0x93,
+    0xBA, 0x8F, 0x36, 0xB5, 0x31, 0x8C, 0x75, 0x76, 0x8B, 0x68, 0x56, 0x0D, 0xDF, 0x2B, 0xF2, 0xF3,
+    0x30, 0xBA, 0xD8, 0x2D, 0x1C, 0x57, 0x5A, 0xF7, 0x81, 0x04, 0x64, 0x37, 0x89, 0x26, 0xCA, 0xEF,
+    0x12, 0xE8, 0x3E, 0x57, 0x43, 0x96, 0x7F, 0x90, 0xCD, 0x5A, 0xA7, 0xEE, 0xE3, 0xBF, 0x8D, 0x01,
+    0x0E, 0x81, 0x8B, 0xB0, 0xF9, 0x7F, 0xE9, 0x55, 0xF6, 0xD8, 0x6A, 0x79, 0xFD, 0xEF, 0xED, 0x0E,
+    0xFA, 0x73, 0x07, 0xFA, 0x63, 0x0E, 0x74, 0xB5, 0xBF, 0xFA, 0xE3, 0x97, 0x7F, 0x2C, 0x17, 0xFD,
+    0xDA, 0xAD, 0x32, 0xD8, 0x62, 0xB3, 0x34, 0x7C, 0xC2, 0x6B, 0x59, 0x6A, 0xF3, 0xF0, 0x8B, 0x4D,
+    0x12, 0x3F, 0xFA, 0x12, 0x49, 0xDD, 0xD3, 0xC2, 0x31, 0x13, 0xF4, 0x92, 0xFC, 0x0E, 0xE2, 0xCD,
+    0xCE, 0xE1, 0x3A, 0xC6, 0x73, 0x28, 0xC7, 0x74, 0x1E, 0xF7, 0x86, 0x7E, 0x87, 0xF3, 0x55, 0x86,
+    0xAF, 0xB9, 0xC7, 0xD8, 0x90, 0x78, 0x44, 0x6E, 0x49, 0x3E, 0x3B, 0xE6, 0x33, 0xAB, 0xE5, 0x86,
+    0xFE, 0x5D, 0x7F, 0xA1, 0xEE, 0x15, 0xC6, 0x10, 0xF5, 0xB6, 0xDA, 0xFF, 0x7A, 0xF3, 0x4B, 0x8E,
+    0xD8, 0xDC, 0x91, 0xAE, 0xCB, 0x3E, 0xCA, 0xE2, 0x56, 0x6C, 0x70, 0x93, 0xCF, 0xC1, 0xF0, 0x28,
+    0x77, 0xDC, 0x8A, 0x0C, 0xEE, 0xD6, 0xE3, 0x1C, 0x86, 0x9B, 0x8F, 0xC8, 0xDD, 0x5D, 0x96, 0x70,
+    0x99, 0x7A, 0x0B, 0xA9, 0xFD, 0x8A, 0xD1, 0xDD, 0xCD, 0x7B, 0xDA, 0x92, 0x64, 0x52, 0x13, 0x3D,
+    0xD4, 0x30, 0x5B, 0x56, 0x9D, 0x59, 0x7F, 0x0B, 0x9D, 0xBB, 0xFE, 0x54, 0x95, 0x4C, 0xB2, 0x7D,
+    0xE8, 0x57, 0xBB, 0xDA, 0xEF, 0x33, 0xAE, 0x7E, 0xB5, 0x3F, 0x78, 0x38, 0xE5, 0x2D, 0xDB, 0x7B,
+    0x6F, 0x4D, 0x3C, 0xCA, 0xB6, 0xB8, 0x29, 0x7C, 0x94, 0xDB, 0xD5, 0xCD, 0xE1, 0x95, 0xCD, 0xDE,
+    0x28, 0x1A, 0x6C, 0xAC, 0xD6, 0xA0, 0xF6, 0x57, 0xAB, 0x5C, 0x98, 0x44, 0x96, 0x61, 0x96, 0x2D,
+    0x92, 0xCF, 0xAA, 0xD8, 0xD4, 0x50, 0xE4, 0x6E, 0x17, 0x05, 0x8B, 0xC9, 0x96, 0xDE, 0x90, 0x0D,
+    0xD9, 0x3C, 0xC9, 0x26, 0x7E, 0xF0, 0xEC, 0xB7, 0x64, 0xB3, 0xE4, 0x66, 0xC9, 0xCD, 0x92, 0xDB,
+    0x39, 0xFB, 0x39, 0xFB, 0xF1, 0x5F, 0x25, 0x9D, 0xEA, 0xF5, 0x46, 0xBB, 0x6A, 0x78, 0x05, 0xF9,
+    0x39, 0xCC, 0xDD, 0xEA, 0x72, 0x5B, 0x5A, 0x0C, 0xDF, 0xE7, 0x53, 0x96, 0x92, 0x59, 0xFD, 0x10,
+    0xAE, 0xDB, 0x7B, 0x5C, 0x3B, 0x7C, 0xCC, 0xDD, 0xB8, 0xF9, 0x2F, 0xB3, 0x7F, 0x2F, 0x63, 0x3F,
+    0x2D, 0xFE, 0x70, 0xF5, 0x36, 0x52, 0x5D, 0xC8, 0x92, 0xAA, 0x2C, 0x77, 0x33, 0x2A, 0x74, 0x53,
+    0x9D, 0x07, 0xB5, 0x5F, 0x64, 0xB9, 0x5B, 0x49, 0xC1, 0xCD, 0x26, 0x87, 0xDE, 0x3E, 0x7A, 0x9E,
+    0xEB, 0xE0, 0xAB, 0x22, 0x7F, 0x6F, 0x15, 0xC3, 0x62, 0x8A, 0x5C, 0x52, 0x4B, 0x56, 0x20, 0x9B,
+    0xAD, 0x5D, 0xDD, 0x6C, 0x23, 0xEA, 0xEE, 0xAC, 0xF2, 0xEF, 0x2D, 0x2A, 0x7E, 0x34, 0x2B, 0xEA,
+    0xEE, 0x94, 0x8A, 0xD7, 0x76, 0x5E, 0x5A, 0xF6, 0x34, 0x11, 0x75, 0x66, 0x53, 0xD8, 0xF5, 0xE3,
+    0x16, 0x70, 0x72, 0xA1, 0x4D, 0xFE, 0x56, 0xD2, 0xEF, 0x1B, 0x16, 0xF9, 0x5B, 0xAB, 0x38, 0x49,
+    0x6C, 0xD5, 0x46, 0xD2, 0x00, 0x63, 0xC7, 0x0F, 0x93, 0xA1, 0xF7, 0x62, 0x6A, 0x27, 0xBF, 0x54,
+    0xC9, 0xAE, 0xFA, 0xAE, 0x29, 0xEA, 0x46, 0xA6, 0x66, 0xF6, 0x6B, 0x93, 0x2C, 0xE4, 0x06, 0x4A,
+    0xBD, 0x57, 0x0D, 0x45, 0xFE, 0xC6, 0x4F, 0x64, 0xE3, 0x2E, 0xE3, 0x35, 0x92, 0x18, 0x77, 0xE8,
+    0xB2, 0xE9, 0xB9, 0x17, 0xDE, 0x16, 0x39, 0xE6, 0x8E, 0x64, 0x1F, 0xFF, 0x59, 0x1B, 0x65, 0xF2,
+    0x5E, 0xE6, 0x8D, 0xB2, 0xFB, 0x80, 0x51, 0x5D, 0xF9, 0x99, 0x81, 0xD1, 0x93, 0xAA, 0xF0, 0x79,
+    0x80, 0x72, 0xAC, 0xBE, 0x3F, 0x37, 0xE9, 0x94, 0xBA, 0x59, 0x1A, 0x7A, 0x55, 0x9B, 0xD4, 0x1C,
+    0xAF, 0x9B, 0x84, 0x51, 0x75, 0x91, 0xDA, 0xF5, 0x78, 0xA1, 0x64, 0x2F, 0xEF, 0xF5, 0x02, 0xCC,
+    0x75, 0x73, 0x17, 0xDB, 0xF8, 0x1C, 0xCC, 0x05, 0x55, 0x27, 0x30, 0xD7, 0x10, 0x77, 0x98, 0xEB,
+    0x8A, 0x64, 0xD0, 0x0B, 0x30, 0x77, 0xEA, 0x72, 0xDE, 0x85, 0x76, 0x87, 0x39, 0xC9, 0xEE, 0x4A,
+    0x73, 0x45, 0xD2, 0xA9, 0xF2, 0xCF, 0xAA, 0xD9, 0x83, 0x99, 0xE4, 0xE7, 0xAD, 0xC9, 0x83, 0xB6,
+    0x6A, 0xBB, 0xAE, 0x4D, 0x5B, 0xD1, 0xA6, 0x52, 0xB4, 0xA9, 0x04, 0x6D, 0x55, 0x09, 0xFD, 0x66,
+    0x36, 0xFF, 0xCB, 0xF2, 0x56, 0x76, 0x40, 0x6A, 0x81, 0xA5, 0x0A, 0x14, 0x49, 0x9B, 0x4E, 0x36,
+    0xE5, 0xC5, 0xCD, 0xAE, 0x55, 0x41, 0xA1, 0xEF, 0x66, 0x93, 0x4D, 0x96, 0x8D, 0x48, 0xE1, 0xF2,
+    0x72, 0x52, 0xE3, 0x69, 0xAF, 0x4C, 0x6D, 0x91, 0x0C, 0xAB, 0x14, 0x98, 0xE5, 0xBE, 0xA2, 0x6F,
+    0xB0, 0x59, 0x4C, 0x43, 0xF4, 0xA9, 0xDE, 0x31, 0x3D, 0xF4, 0xDD, 0xFC, 0xBB, 0x6C, 0xE8, 0xED,
+    0x7C, 0x4C, 0x73, 0xCF, 0xDB, 0xE2, 0x61, 0x3B, 0xB6, 0xEC, 0xE1, 0x98, 0xD0, 0xCC, 0x2A, 0x35,
+    0xEB, 0x5F, 0x56, 0xAF, 0x8E, 0x57, 0xFE, 0xA1, 0xB9, 0xD9, 0x5F, 0xF9, 0xB7, 0xE6, 0x96, 0x3E,
+    0xF8, 0x59, 0x77, 0x93, 0xEC, 0x9F, 0x4E, 0x7F, 0xF7, 0x6D, 0x99, 0x49, 0xDF, 0x96, 0x99, 0x42,
+    0xFF, 0xC6, 0x1F, 0xC0, 0xAE, 0xF6, 0xF7, 0x61, 0xD7, 0xF3, 0xB4, 0xF5, 0x35, 0x50, 0x42, 0xFF,
+    0x86, 0x8D, 0x6E, 0x1E, 0xDE, 0xF9, 0x86, 0xB6, 0x92, 0x9F, 0xC2, 0xF9, 0xED, 0x39, 0xDA, 0x0A,
+    0xF5, 0xD6, 0x24, 0x37, 0x85, 0x7E, 0x6B, 0xA3, 0x9B, 0xFD, 0x2B, 0xB9, 0x4D, 0x76, 0x0E, 0xF5,
+    0x76, 0x02, 0x56, 0x3C, 0x03, 0xAB, 0x4F, 0xF7, 0x24, 0x78, 0x82, 0x39, 0x7B, 0x0A, 0x9D, 0x24,
+    0x75, 0xD1, 0x6F, 0x12, 0x49, 0x32, 0xB3, 0x64, 0x7B, 0xE9, 0xAC, 0xA4, 0x24, 0x19, 0x92, 0x2C,
+    0xAB, 0xCE, 0x36, 0x51, 0xA9, 0x9D, 0xCC, 0xEC, 0x65, 0x1F, 0x64, 0x79, 0x66, 0xED, 0xBC, 0x61,
+    0xA2, 0x24, 0x7B, 0xA3, 0x97, 0xBC, 0x95, 0x94, 0xBF, 0x2D, 0x99, 0x18, 0x25, 0x7B, 0x38, 0x4B,
+    0xDE, 0xF6, 0x52, 0xF6, 0xF4, 0x26, 0x42, 0x6F, 0xEF, 0xCC, 0x83, 0xFC, 0xC5, 0xFE, 0x03, 0x6D,
+    0x67, 0x4D, 0x34, 0x6B, 0x09, 0x93, 0xBD, 0xCF, 0x26, 0xFF, 0x1E, 0x07, 0x2A, 0xDF, 0x92, 0xA2,
+    0xCC, 0x2C, 0xDB, 0xEB, 0xAC, 0x74, 0xD4, 0x1B, 0x56, 0xCB, 0x7A, 0xB6, 0x89, 0xA9, 0xBD, 0xB3,
+    0xB8, 0x8B, 0x0F, 0xB3, 0x67, 0x61, 0x53, 0xFD, 0x1F, 0xBD, 0x81, 0xFE, 0x6C, 0xB5, 0x55, 0x32,
+    0x51, 0x72, 0xA3, 0xAA, 0x5C, 0xC1, 0xD4, 0x91, 0x25, 0x77, 0x43, 0x66, 0x3D, 0x5B, 0x61, 0x60,
+    0xF6, 0x24, 0x5D, 0xFE, 0x5F, 0x5D, 0xA9, 0xAE, 0x8F, 0x57, 0x5A, 0xE2, 0x15, 0xC7, 0x7A, 0xC5,
+    0xF7, 0xF9, 0xCA, 0xDB, 0xFA, 0xEE, 0x77, 0x3F, 0xD0, 0xB9, 0x21, 0xEB, 0xDC, 0x90, 0xE5, 0x87,
+    0xAC, 0x73, 0x6F, 0x6F, 0x3A, 0x77, 0x65, 0xE8, 0xCB, 0x95, 0x81, 0x7C, 0xC5, 0xB3, 0x5E, 0xB1,
+    0xC4, 0x7F, 0xAC, 0x19, 0xE5, 0x98, 0x1A, 0x90, 0x57, 0xAE, 0x93, 0x89, 0xED, 0x6C, 0x27, 0xD7,
+    0xFB, 0x7E, 0xD0, 0x26, 0x48, 0x82, 0xA5, 0x85, 0x71, 0x78, 0xB5, 0x98, 0xDC, 0xAE, 0x5D, 0x74,
+    0x31, 0x4C, 0xE1, 0x10, 0x43, 0x97, 0x6D, 0xAE, 0x93, 0xEB, 0xED, 0x52, 0xE4, 0x0F, 0x73, 0x45,
+    0x17, 0xDB, 0x1C, 0xA6, 0xDF, 0xB3, 0x76, 0xD2, 0x1E, 0xA9, 0x02, 0xD9, 0x27, 0xA8, 0xE8, 0xC3,
+    0x26, 0x5D, 0xCA, 0x6E, 0x5F, 0xDA, 0xBB, 0x03, 0x5C, 0xFC, 0xF5, 0xEB, 0xF2, 0xA3, 0x44, 0xAF,
+    0x9A, 0xFF, 0x3E, 0x73, 0x01, 0xB6, 0x06, 0x52, 0x03, 0x53, 0x1D, 0x3E, 0xD7, 0xFF, 0x01, 0xCD,
+    0x9C, 0x4F, 0xEC, 0x1D, 0xD7, 0x75, 0xDF, 0x3F, 0x33, 0x13, 0x72, 0x10, 0x0D, 0x9A, 0xEB, 0x45,
+    0x18, 0x38, 0x56, 0xE1, 0xE9, 0x22, 0x8B, 0x44, 0x8D, 0x35, 0x5D, 0x64, 0xD1, 0x85, 0xC8, 0x3B,
+    0xB2, 0x80, 0x68, 0xA1, 0x05, 0xE9, 0x96, 0x3F, 0x3B, 0x68, 0x16, 0xE9, 0x22, 0x40, 0x1B, 0x37,
+    0x05, 0xBB, 0x29, 0xE0, 0x85, 0xA4, 0x19, 0x8B, 0x08, 0x0C, 0xD4, 0x0B, 0x31, 0x88, 0xDD, 0x4D,
+    0x16, 0x16, 0x10, 0x05, 0x88, 0x7E, 0x06, 0xC2, 0x02, 0xED, 0xC2, 0x05, 0x24, 0xDE, 0x2B, 0x11,
+    0x28, 0x81, 0x6A, 0xC1, 0xA1, 0xD8, 0xC0, 0x05, 0xB4, 0xD0, 0x58, 0xA2, 0x9B, 0x56, 0x5A, 0xE8,
+    0x52, 0x1C, 0xC5, 0x43, 0xEA, 0xCE, 0x7C, 0xBB, 0xB8, 0xF3, 0x7E, 0xBF, 0x1F, 0xFF, 0xC8, 0x89,
+    0x63, 0xD9, 0xCA, 0xBC, 0x37, 0x77, 0xEE, 0x7B, 0x6F, 0xE6, 0xCD, 0x3D, 0xE7, 0x9E, 0x7B, 0xEE,
+    0x39, 0xDF, 0x73, 0xEE, 0x74, 0xD1, 0x46, 0x1B, 0x6D, 0x6C, 0x62, 0x3D, 0xD7, 0x13, 0x47, 0xB7,
+    0xFF, 0x90, 0x07, 0x13, 0x4C, 0x30, 0xA1, 0x0A, 0x55, 0xA8, 0x42, 0x39, 0x95, 0x53, 0x39, 0x15,
+    0x07, 0xAF, 0x7C, 0xCC, 0xFB, 0xED, 0xCC, 0x00, 0x8F, 0x41, 0x0D, 0xA5, 0xA7, 0x5A, 0x69, 0x34,
+    0x34, 0x9A, 0x8C, 0xFE, 0x77, 0x75, 0x73, 0x2C, 0xE2, 0xD7, 0x58, 0x3F, 0x8F, 0xFD, 0x46, 0x6F,
+    0x3E, 0x18, 0x8B, 0xF8, 0x3D, 0xF4, 0x97, 0xD4, 0x9A, 0x0B, 0xA9, 0xB7, 0x9A, 0x32, 0x77, 0x83,
+    0xAA, 0x27, 0x1F, 0xE0, 0xBF, 0xC1, 0x6F, 0x1C, 0xDE, 0xBB, 0x99, 0xC8, 0xA5, 0xD6, 0x48, 0x83,
+    0x19, 0xEB, 0xD1, 0xF4, 0x60, 0x7A, 0x30, 0x1E, 0xAA, 0x01, 0xCA, 0x00, 0x45, 0x00, 0x49, 0xBD,
+    0xA4, 0x7E, 0x5F, 0xFB, 0x2D, 0x2B, 0xB0, 0x42, 0xBE, 0x42, 0xB3, 0x80, 0xD3, 0x9D, 0xD6, 0x49,
+    0xC1, 0x49, 0xF3, 0xFE, 0xFE, 0xFE, 0x5F, 0x64, 0xE4, 0x7C, 0x81, 0x53, 0xF9, 0xAA, 0xD5, 0x48,
+    0x73, 0x2D, 0x79, 0xFB, 0xC6, 0xCA, 0x5A, 0xC4, 0x62, 0x36, 0xC1, 0x4C, 0x9D, 0xB7, 0x5A, 0x73,
+    0x69, 0x69, 0xA4, 0xA5, 0x93, 0xC2, 0xD3, 0xBF, 0x50, 0xD3, 0xF2, 0x19, 0xEC, 0x40, 0x1D, 0xBA,
+    0x21, 0x53, 0xEB, 0x06, 0x33, 0x23, 0x2F, 0x8F, 0xDE, 0x8A, 0x64, 0xD2, 0x40, 0xA1, 0x15, 0x0A,
+    0x05, 0x28, 0x05, 0x18, 0x8D, 0xD4, 0x92, 0x47, 0x52, 0x5B, 0x4A, 0x67, 0xC0, 0xCC, 0x80, 0xFD,
+    0x01, 0x74, 0x5A, 0x29, 0xA4, 0x88, 0x91, 0x26, 0xB0, 0x23, 0xA0, 0x1E, 0x8A, 0x65, 0x23, 0xFA,
+    0xE1, 0xA6, 0x69, 0x1A, 0x7B, 0xEA, 0x24, 0xC0, 0xE7, 0x4F, 0x9D, 0x3A, 0x79, 0xF2, 0xE4, 0xC9,
+    0x93, 0x27, 0x7F, 0x8D, 0xE3, 0x2F, 0x52, 0x2A, 0x20, 0xF9, 0xBA, 0x7D, 0x39, 0x0F, 0x45, 0xDB,
+    0x0C, 0x64, 0x9A, 0x31, 0x9A, 0x0A, 0xC9, 0x77, 0x7F, 0xB4, 0x56, 0x43, 0x35, 0xBA, 0x6F, 0xAF,
+    0x95, 0x34, 0x5A, 0xC5, 0x4C, 0x6A, 0x33, 0x45, 0xE8, 0x86, 0xCF, 0xB0, 0x96, 0xA3, 0x19, 0xA5,
+    0xD8, 0x48, 0xED, 0x45, 0xB5, 0x00, 0xC7, 0xDA, 0xBD, 0x6A, 0xB2, 0x97, 0x57, 0x33, 0xE9, 0xFC,
+    0x62, 0x6F, 0xEA, 0x3B, 0xD1, 0x8D, 0xB8, 0xB6, 0x54, 0x30, 0xD7, 0x62, 0x73, 0xEA, 0xE4, 0xC9,
+    0xF1, 0xD1, 0xC7, 0x86, 0xCF, 0x9F, 0x1C, 0x1F, 0x6D, 0xBA, 0x93, 0xE6, 0x5A, 0x2C, 0x15, 0x70,
+    0x3D, 0x64, 0x1F, 0x3D, 0xFE, 0xDE, 0x10, 0xBE, 0xF7, 0x5B, 0xBF, 0xF4, 0x8F, 0x8A, 0xF3, 0xFF,
+    0x39, 0xB8, 0x58, 0xBD, 0xC7, 0x1E, 0x34, 0x5A, 0xFF, 0x54, 0xBA, 0x23, 0xAD, 0x9C, 0xE8, 0x3C,
+    0x26, 0x50, 0x44, 0x10, 0x58, 0xAF, 0xDD, 0x16, 0x01, 0x5C, 0x5F, 0x2A, 0x18, 0xBD, 0xFC, 0xE8,
+    0x9F, 0x9C, 0x3C, 0xF9, 0x67, 0x9F, 0x7F, 0xCC, 0x3D, 0xFA, 0xE8, 0x7F, 0x7D, 0xB6, 0xBE, 0x15,
+    0x2B, 0x4D, 0x99, 0x36, 0x39, 0x72, 0xBA, 0x22, 0xED, 0xED, 0xB5, 0x47, 0x4E, 0x8F, 0xCD, 0xB5,
+    0xC5, 0xF6, 0x97, 0xAC, 0x5F, 0x1B, 0x2D, 0x46, 0xBB, 0xC6, 0x1C, 0x3B, 0x03, 0x8D, 0x07, 0x07,
+    0x79, 0xE4, 0x73, 0x17, 0xEF, 0xBC, 0xE0, 0xA4, 0xD7, 0x24, 0x91, 0x47, 0xA8, 0xC2, 0xC1, 0xAF,
+    0xC0, 0xF1, 0xEF, 0xCA, 0x5B, 0xE9, 0x39, 0x69, 0x05, 0xA8, 0xC7, 0x53, 0x13, 0x8F, 0xF1, 0xB5,
+    0x2C, 0x98, 0xA1, 0x89, 0x36, 0x66, 0x6D, 0x3D, 0x7D, 0xE6, 0x37, 0xF9, 0xC7, 0xF9, 0xCB, 0xD5,
+    0xCC, 0x63, 0xBF, 0xFA, 0x4C, 0x13, 0x9B, 0xA9, 0x08, 0x75, 0xBF, 0x14, 0xA1, 0xE9, 0xA1, 0xF1,
+    0x79, 0x3C, 0xD8, 0x87, 0xB4, 0xDB, 0x21, 0x8F, 0x76, 0x2C, 0x16, 0x3B, 0x16, 0x8B, 0x0D, 0xDB,
+    0xBE, 0x98, 0xC5, 0x4A, 0xBB, 0x7D, 0xB5, 0xD2, 0x6A, 0x9B, 0x19, 0x0B, 0x58, 0xE0, 0x11, 0x20,
+    0xD7, 0xE9, 0x41, 0xD3, 0xD2, 0xE8, 0xF4, 0x75, 0x85, 0xA5, 0x93, 0xF9, 0xBE, 0xC2, 0x62, 0x65,
+    0xDE, 0x50, 0x58, 0x8C, 0xCC, 0xD0, 0x84, 0xA5, 0x58, 0xAB, 0xD1, 0x8E, 0x97, 0x8A, 0xB5, 0x1A,
+    0xBB, 0xE1, 0x52, 0xB5, 0x54, 0xA3, 0x86, 0x4B, 0x66, 0xA9, 0x46, 0xF9, 0x4B, 0x75, 0xAC, 0xDE,
+    0x96, 0xBF, 0x64, 0x63, 0xF5, 0x83, 0xBD, 0xF6, 0x44, 0x73, 0x7D, 0xB1, 0xEF, 0xAC, 0xDD, 0xCD,
+    0xBD, 0x47, 0x99, 0x8A, 0xB9, 0x99, 0xFF, 0xC5, 0x4D, 0x7D, 0x33, 0x7E, 0xAE, 0xAD, 0xFA, 0x67,
+    0xB3, 0xAF, 0x31, 0x16, 0xFD, 0xE7, 0xF9, 0x9A, 0x59, 0xED, 0x5C, 0x4E, 0xE5, 0xFB, 0x4F, 0xF8,
+    0x10, 0x1E, 0x7B, 0xCC, 0x98, 0xF7, 0x5F, 0xD5, 0x50, 0x0F, 0xC7, 0x07, 0x00, 0xB5, 0x24, 0xC9,
+    0x33, 0xC3, 0x2F, 0x4E, 0x70, 0x89, 0x62, 0xA0, 0x08, 0x98, 0x16, 0xDB, 0xF3, 0x0C, 0x59, 0x24,
+    0x9B, 0x30, 0x03, 0xE5, 0x80, 0x83, 0xBA, 0x2D, 0xC3, 0x2F, 0x54, 0x0A, 0xB6, 0x9F, 0xAC, 0x5E,
+    0x8B, 0x66, 0x70, 0x32, 0x83, 0x6B, 0x41, 0xE5, 0x2B, 0x50, 0x4E, 0x8F, 0x4D, 0x60, 0xCF, 0x5F,
+    0x1F, 0xC9, 0xE3, 0xA3, 0xF5, 0x05, 0xEA, 0x1F, 0x48, 0x1E, 0x95, 0x12, 0xD5, 0x44, 0x11, 0xB0,
+    0x1E, 0xE3, 0x8B, 0x05, 0x3A, 0x1E, 0x7A, 0x01, 0x20, 0x35, 0xC2, 0x4C, 0x70, 0x2C, 0xB5, 0xC2,
+    0xF3, 0x9D, 0x96, 0x6A, 0xA4, 0x18, 0x28, 0x03, 0x4C, 0x14, 0x13, 0x3C, 0x43, 0x1E, 0xA1, 0x6E,
+    0x59, 0xA0, 0x1C, 0x58, 0x21, 0x9B, 0xE8, 0xA0, 0x52, 0xB0, 0xDF, 0xD0, 0x79, 0xC5, 0xE6, 0xB2,
+    0x66, 0xA7, 0x7A, 0xB8, 0xD1, 0x80, 0x09, 0x14, 0x03, 0x55, 0x20, 0x9B, 0x28, 0x66, 0x88, 0x14,
+    0x11, 0x16, 0xB2, 0x85, 0x5C, 0x20, 0x0A, 0x81, 0x6B, 0x73, 0x2D, 0x74, 0x3D, 0x52, 0x6F, 0x3D,
+    0x56, 0xE3, 0xB1, 0x33, 0x00, 0x0F, 0xCF, 0x00, 0x8A, 0x64, 0x67, 0x33, 0xBE, 0x87, 0xF1, 0x10,
+    0xB8, 0x04, 0x55, 0x5F, 0x06, 0xEA, 0x88, 0x6D, 0x71, 0x53, 0x1E, 0xE1, 0xE1, 0x60, 0x3C, 0x54,
+    0x7E, 0x85, 0x1F, 0xBA, 0x32, 0x7C, 0xB6, 0x50, 0xB4, 0x5F, 0x9F, 0x1A, 0xBD, 0x1D, 0xCD, 0x70,
+    0x6E, 0xA9, 0x07, 0xB5, 0xA0, 0xEA, 0x15, 0x28, 0xA7, 0xA7, 0x67, 0xB0, 0xE7, 0x2F, 0x8F, 0xE4,
+    0xD1, 0xFE, 0xDE, 0xF8, 0x77, 0x60, 0x0A, 0x66, 0x81, 0x6A, 0x81, 0x2A, 0x42, 0x19, 0xA1, 0x9C,
+    0x21, 0x3B, 0xCB, 0xDD, 0xDB, 0x67, 0x21, 0x9F, 0xA1, 0xDE, 0xED, 0x53, 0xDA, 0xDD, 0x44, 0xAE,
+    0x40, 0xA5, 0x16, 0x33, 0x41, 0x33, 0x80, 0xF5, 0xF7, 0xED, 0x9F, 0xA9, 0x07, 0x26, 0x33, 0x55,
+    0xB1, 0x94, 0xE6, 0x4C, 0x1A, 0x68, 0x96, 0x23, 0xFF, 0x7D, 0xE6, 0x97, 0x81, 0xE6, 0x8D, 0x11,
+    0x0A, 0x3D, 0x0A, 0x3C, 0xA6, 0x11, 0xCA, 0x2B, 0x11, 0x38, 0x59, 0xF7, 0x77, 0xB7, 0xC3, 0x7A,
+    0xA0, 0x58, 0x01, 0x5C, 0x00, 0x8C, 0x5A, 0xC8, 0x34, 0x03, 0xF6, 0x7D, 0x0F, 0xC5, 0xED, 0x15,
+    0x70, 0xA7, 0x03, 0x98, 0xE0, 0x5A, 0xB2, 0xB5, 0x9C, 0xC1, 0x0E, 0xD6, 0x53, 0xC4, 0x62, 0x05,
+    0xE7, 0xEB, 0x80, 0x59, 0xF7, 0xD5, 0x66, 0x92, 0x66, 0xAC, 0x24, 0x5F, 0x48, 0x5A, 0x71, 0x92,
+    0x82, 0x89, 0x14, 0x7A, 0x5C, 0x9E, 0x66, 0xB6, 0x13, 0x99, 0x3C, 0xD4, 0xFD, 0xC1, 0x3D, 0x5F,
+    0x09, 0x40, 0xF5, 0xFC, 0xC1, 0xED, 0x93, 0x16, 0x7D, 0xA8, 0xBD, 0xBB, 0x91, 0x45, 0x84, 0x4D,
+    0xD5, 0x56, 0x02, 0xD0, 0x04, 0xD4, 0xEA, 0xA1, 0x58, 0x23, 0x60, 0xBF, 0x33, 0x42, 0x35, 0x09,
+    0x50, 0x35, 0x41, 0x3D, 0x76, 0x3D, 0xC5, 0x52, 0x44, 0xB0, 0xDE, 0x8E, 0x54, 0x31, 0x13, 0xE8,
+    0xDD, 0x8B, 0x13, 0xB5, 0xA4, 0xBE, 0x90, 0x14, 0xB1, 0x92, 0xC6, 0x4A, 0x92, 0x90, 0xC7, 0x4E,
+    0x75, 0x24, 0xD7, 0x79, 0xB5, 0xD4, 0x11, 0xD8, 0x7B, 0xE4, 0xBB, 0x9A, 0x01, 0x75, 0xD2, 0x04,
+    0xB9, 0x9C, 0x14, 0xA0, 0x90, 0xF4, 0xEE, 0x05, 0xA8, 0x24, 0x0F, 0xA4, 0x79, 0x02, 0xB0, 0x6F,
+    0xA5, 0x63, 0x77, 0x3A, 0x1D, 0x65, 0xA4, 0x15, 0xF2, 0xB5, 0x92, 0x56, 0x28, 0x62, 0x3A, 0x56,
+    0x73, 0x29, 0xFD, 0x3F, 0x30, 0xA1, 0x90, 0x07, 0xEC, 0x9D, 0xEF, 0xCA, 0x03, 0x9D, 0xD2, 0xFF,
+    0x48, 0xD2, 0xBB, 0xFB, 0x17, 0xB2, 0xA4, 0x73, 0x43, 0x91, 0x8E, 0x53, 0xB5, 0x90, 0x49, 0x9A,
+    0x4C, 0x24, 0x93, 0x34, 0x37, 0x33, 0xEC, 0x74, 0x72, 0xEA, 0x47, 0xAD, 0x2D, 0x58, 0x69, 0x06,
+    0x2B, 0xA9, 0xC5, 0x4A, 0x1A, 0xB0, 0x3F, 0xF8, 0x57, 0x0A, 0xD8, 0x91, 0x66, 0xC2, 0x8E, 0x98,
+    0x19, 0x3B, 0x52, 0xC4, 0x54, 0x5A, 0x69, 0xC8, 0xA3, 0x95, 0x86, 0x62, 0x2B, 0xB1, 0x23, 0x65,
+    0xC4, 0x8E, 0xD4, 0x11, 0x3B, 0x1E, 0xDB, 0xB8, 0x94, 0xBA, 0x35, 0x24, 0x8E, 0xA5, 0x2E, 0xC6,
+    0x4A, 0x2B, 0x58, 0xE9, 0x02, 0x64, 0xED, 0x19, 0xC8, 0x97, 0x2F, 0x00, 0x7A, 0xBD, 0x87, 0xA7,
+    0x35, 0x40, 0x5D, 0x07, 0x28, 0x5E, 0x9D, 0xEF, 0xEA, 0xCA, 0xE3, 0xBA, 0x00, 0xB5, 0xD4, 0x53,
+    0x4B, 0x91, 0x5A, 0x7F, 0x2A, 0x6F, 0x16, 0x9A, 0xB9, 0x8A, 0x14, 0x2A, 0x56, 0xE8, 0xAE, 0x09,
+    0x4C, 0x74, 0x9E, 0x4C, 0x76, 0x84, 0xEE, 0xEA, 0x0C, 0xE6, 0xD6, 0x02, 0xC5, 0xA2, 0x1E, 0xD4,
+    0x8D, 0xD0, 0x5D, 0x8D, 0xD0, 0x7C, 0xA0, 0x9E, 0x3A, 0xBA, 0xF5, 0x4B, 0x9D, 0x6A, 0x49, 0x3A,
+    0x2F, 0x49, 0x43, 0x27, 0x29, 0x54, 0x92, 0x02, 0x9D, 0x14, 0xC8, 0x9C, 0x2E, 0x1C, 0x36, 0xA0,
+    0x7B, 0x6D, 0xA5, 0x7B, 0x7F, 0xA4, 0x13, 0x74, 0x81, 0x42, 0x23, 0x56, 0x63, 0x21, 0x37, 0xDA,
+    0xC9, 0x85, 0xDD, 0x59, 0xBF, 0xB3, 0x1D, 0xCD, 0xAE, 0xF5, 0xCD, 0xEE, 0xA7, 0x6E, 0xDC, 0x2A,
+    0xA9, 0x9B, 0x21, 0xD7, 0x26, 0xAD, 0x85, 0x76, 0x17, 0xED, 0xBA, 0xA5, 0xDE, 0x5D, 0x6D, 0x77,
+    0x57, 0xBB, 0xE1, 0x9E, 0xAB, 0x0F, 0x2E, 0x2A, 0xD7, 0x8D, 0x3F, 0x17, 0xD3, 0xD5, 0x49, 0xEA,
+    0x20, 0x93, 0x14, 0x00, 0x4A, 0xFD, 0x9F, 0x54, 0x31, 0x4B, 0xAE, 0x39, 0xB5, 0xA9, 0xD0, 0x36,
+    0x32, 0xAA, 0x34, 0x2D, 0x76, 0xBE, 0x96, 0x00, 0x9C, 0xB7, 0x77, 0xD2, 0x48, 0xE9, 0xBB, 0x9B,
+    0x5B, 0x45, 0x43, 0xAA, 0x7C, 0x51, 0x5E, 0x2D, 0xA0, 0x27, 0xD4, 0xA6, 0xCA, 0x37, 0x95, 0xA5,
+    0x9F, 0xDE, 0x5A, 0xF2, 0x74, 0xB9, 0xE6, 0x72, 0xAB, 0x7C, 0xD8, 0x69, 0x6B, 0x4E, 0xBA, 0x85,
+    0x95, 0xB4, 0x6C, 0x82, 0x9F, 0xEE, 0x6E, 0x76, 0x2D, 0xAC, 0xB5, 0x1B, 0x0B, 0xD2, 0xED, 0x44,
+    0xEE, 0x66, 0x8B, 0x66, 0x1A, 0x77, 0xE4, 0x6E, 0x74, 0x57, 0x3B, 0xAE, 0x99, 0x1D, 0x03, 0x0E,
+    0x54, 0x58, 0xB7, 0xE3, 0x9A, 0xC2, 0x8E, 0xC3, 0xC3, 0xBD, 0x57, 0xDF, 0xDE, 0x71, 0x78, 0xA7,
+    0x29, 0x7E, 0xED, 0x1E, 0xFD, 0x1A, 0x81, 0x72, 0x04, 0x6C, 0xBB, 0x7D, 0xAA, 0x46, 0x7E, 0x82,
+    0xAD, 0x09, 0x14, 0xAB, 0x1D, 0xA8, 0x83, 0x3C, 0xFA, 0xBA, 0xDA, 0x32, 0x16, 0xC2, 0x8E, 0xE5,
+    0x92, 0x0B, 0x13, 0xCD, 0x4C, 0x3D, 0x3B, 0x8F, 0xBD, 0x25, 0xE8, 0x34, 0x81, 0xE4, 0xC9, 0xB5,
+    0x6C, 0x66, 0x64, 0xA5, 0x76, 0x93, 0x03, 0x1B, 0x48, 0x5A, 0xAF, 0x14, 0x24, 0xCD, 0xE2, 0x02,
+    0xE4, 0xF2, 0xBC, 0xC2, 0xF6, 0x76, 0x2D, 0x6E, 0xC1, 0xC9, 0x3B, 0x85, 0x4B, 0x55, 0x7C, 0x25,
+    0x5B, 0x5E, 0x61, 0x79, 0x25, 0x5F, 0x5E, 0xA9, 0xA2, 0xD3, 0xE4, 0x34, 0xB8, 0x15, 0x77, 0xE1,
+    0xF0, 0xFC, 0x57, 0x80, 0xCF, 0x5D, 0xA0, 0x52, 0xC0, 0x29, 0x94, 0xB3, 0x19, 0x1B, 0x6F, 0xFC,
+    0x9A, 0xB9, 0x62, 0xAA, 0xA3, 0x19, 0x74, 0xC1, 0x7E, 0x23, 0xB0, 0xD6, 0x6D, 0x31, 0x3F, 0x8B,
+    0x19, 0x45, 0xF7, 0x9C, 0x1E, 0x5F, 0x0B, 0x3D, 0x19, 0x4B, 0xD5, 0xA1, 0x58, 0x3B, 0x5F, 0xDC,
+    0xD1, 0x8D, 0xFA, 0x3D, 0x49, 0xE7, 0xA4, 0xE8, 0xA4, 0x81, 0x66, 0x86, 0x57, 0x0C, 0xE5, 0xF2,
+    0x18, 0xCD, 0x1A, 0x98, 0xD5, 0xE7, 0xE3, 0xCB, 0x07, 0xDC, 0xA8, 0x6F, 0x50, 0x48, 0xBE, 0x91,
+    0x58, 0xCA, 0x58, 0x8E, 0xD5, 0x64, 0x31, 0x43, 0xC4, 0x9E, 0x1F, 0x59, 0x4D, 0x9B, 0xC7, 0x93,
+    0x54, 0x61, 0xC6, 0x5E, 0x5E, 0x2F, 0xAA, 0x92, 0xA2, 0x91, 0xA6, 0x5A, 0x1A, 0xAA, 0xDB, 0x24,
+    0x53, 0xDF, 0x79, 0x8A, 0xB7, 0x5A, 0xCC, 0xA3, 0x60, 0x27, 0x70, 0x1E, 0xFE, 0xED, 0xC1, 0xBF,
+    0x67, 0x6B, 0x8B, 0x55, 0xCC, 0xA5, 0x60, 0x86, 0xCE, 0x3F, 0x8B, 0x7B, 0x22, 0xB0, 0x18, 0x5F,
+    0xCC, 0xA7, 0x30, 0xE3, 0x44, 0x73, 0x79, 0xC0, 0x99, 0xBE, 0x88, 0xF6, 0x5D, 0x05, 0x27, 0x79,
+    0x49, 0x8F, 0x4B, 0x0B, 0xEE, 0xC2, 0x91, 0x06, 0x5E, 0xBC, 0x80, 0xD5, 0xA2, 0x95, 0x46, 0xD2,
+    0xC5, 0xD1, 0x0C, 0xDD, 0x4A, 0x2C, 0xC7, 0x4A, 0xC7, 0xCE, 0x9D, 0x0F, 0x48, 0x0A, 0x11, 0x2B,
+    0xC5, 0x53, 0x18, 0x49, 0xA7, 0xDB, 0x7C, 0xFD, 0x36, 0xC5, 0x80, 0x6B, 0x61, 0xC6, 0x06, 0xB0,
+    0xEF, 0x4A, 0x17, 0x1E, 0xAE, 0x24, 0xA5, 0x5B, 0x48, 0xA1, 0x4E, 0x86, 0xAF, 0xBB, 0x90, 0xB9,
+    0x1B, 0x07, 0x92, 0xD1, 0xEF, 0x06, 0xB4, 0x8B, 0x40, 0x1E, 0xA1, 0x50, 0x72, 0x0A, 0xB6, 0x22,
+    0x23, 0x82, 0x6E, 0x46, 0x2A, 0xAD, 0x33, 0xB5, 0x34, 0x63, 0xC7, 0x6E, 0xC2, 0xFA, 0x3A, 0xD0,
+    0xB5, 0x66, 0x2B, 0xAC, 0xAF, 0x47, 0xEC, 0x1D, 0x79, 0x1A, 0xA9, 0xC7, 0x48, 0x50, 0x68, 0x01,
+    0xCE, 0x8D, 0xC0, 0x2F, 0x1F, 0xA3, 0x88, 0x8F, 0x51, 0xCF, 0x81, 0xFF, 0x2E, 0x5F, 0xBC, 0xBD,
+    0x72, 0xFC, 0xF1, 0x0B, 0x47, 0x5D, 0xAB, 0x4A, 0x11, 0xA7, 0x58, 0x2C, 0xD5, 0xDC, 0x0C, 0x26,
+    0x88, 0xFA, 0xFA, 0x8C, 0x7D, 0x7E, 0x64, 0xB5, 0x7D, 0x31, 0x8B, 0xFA, 0xFA, 0x9A, 0xE9, 0xA9,
+    0xD4, 0x1B, 0x63, 0x23, 0xD1, 0x28, 0xF0, 0xF0, 0xB2, 0x19, 0x23, 0xF5, 0x08, 0x74, 0x1E, 0x72,
+    0xED, 0x54, 0x96, 0x3D, 0xF4, 0x1C, 0xF7, 0x5A, 0x23, 0xC9, 0x3B, 0x49, 0x4F, 0xEE, 0x46, 0xFE,
+    0xDF, 0xE9, 0x42, 0x2E, 0x40, 0x1E, 0x20, 0x8B, 0xC9, 0x8F, 0xC3, 0xB6, 0x50, 0xFB, 0x64, 0xCE,
+    0x17, 0xF3, 0xF6, 0x83, 0x03, 0x6C, 0x0F, 0x66, 0xE7, 0x05, 0x46, 0x68, 0x56, 0xE8, 0xE4, 0xE9,
+    0x14, 0xB1, 0x6F, 0xA9, 0x6F, 0xAE, 0x2B, 0x98, 0x9B, 0xEB, 0x52, 0xCC, 0xB2, 0xFD, 0x6A, 0x9F,
+    0x1F, 0xED, 0x77, 0xAE, 0xCF, 0xE6, 0xA3, 0x9B, 0x4B, 0xA1, 0x45, 0xAD, 0x93, 0xBC, 0x91, 0xC6,
+    0x5C, 0x0A, 0x34, 0x0A, 0x94, 0x1A, 0xC8, 0x17, 0x40, 0x5B, 0xF3, 0x9A, 0x11, 0xCC, 0xF6, 0xDF,
+    0xD9, 0xBA, 0x19, 0xCB, 0xD6, 0x43, 0x3D, 0x40, 0xE5, 0xA1, 0xE8, 0x81, 0xA4, 0x3F, 0x2C, 0xC9,
+    0x2A, 0x31, 0x7E, 0x6B, 0xCF, 0xFC, 0x93, 0xE8, 0x0A, 0x91, 0xC7, 0x7A, 0x44, 0x45, 0xA4, 0x6B,
+    0x3B, 0xDF, 0x78, 0x33, 0x99, 0x90, 0xA9, 0x98, 0xB1, 0x6F, 0x47, 0xCA, 0x28, 0x48, 0x13, 0x9E,
+    0x4F, 0xCA, 0xA1, 0x9B, 0x13, 0xDF, 0x72, 0x01, 0x5D, 0x0F, 0x76, 0xE0, 0x84, 0x0B, 0x18, 0x4D,
+    0x14, 0x8A, 0xA0, 0x08, 0xF6, 0x06, 0x5C, 0x02, 0x77, 0xF0, 0xBE, 0x80, 0x5B, 0x71, 0xF2, 0xCE,
+    0x05, 0x57, 0xCD, 0x2E, 0x5F, 0x1C, 0xAB, 0xE3, 0x52, 0xC7, 0xA5, 0x8E, 0xA5, 0xCB, 0x63, 0x57,
+    0xCD, 0x5D, 0x17, 0x3A, 0x0D, 0x9D, 0xE8, 0x6E, 0xD0, 0x71, 0xF7, 0xBB, 0x05, 0x95, 0x33, 0xDD,
+    0xAB, 0x2B, 0x75, 0x70, 0xBE, 0x8A, 0x36, 0x14, 0x3A, 0x1D, 0xD9, 0x7B, 0x7C, 0xEF, 0xE3, 0x29,
+    0xB3, 0x1E, 0x57, 0xCE, 0x58, 0x2F, 0xEA, 0xA1, 0x0E, 0x55, 0x28, 0x96, 0x22, 0xD2, 0xF9, 0x15,
+    0x33, 0x3B, 0x32, 0x25, 0xE3, 0x9B, 0x52, 0x21, 0x35, 0xBA, 0x5E, 0xB7, 0x19, 0xCD, 0xF9, 0x24,
+    0x28, 0x66, 0xE2, 0xD8, 0xB9, 0x98, 0xC4, 0x5A, 0x02, 0x2B, 0x30, 0xB7, 0x01, 0x8E, 0xED, 0xAB,
+    0x25, 0x97, 0x22, 0x58, 0xC9, 0x73, 0x7C, 0xFF, 0xCF, 0xCF, 0xFE, 0xB8, 0x76, 0xFC, 0xBC, 0xAD,
+    0xD4, 0xBD, 0xAF, 0xF6, 0x56, 0xCA, 0xA5, 0xD5, 0xE8, 0xDD, 0x17, 0x1F, 0xD0, 0xA6, 0x9F, 0x5E,
+    0x6B, 0x65, 0x4B, 0x1E, 0xC1, 0x48, 0x3D, 0x28, 0x81, 0x0F, 0x0B, 0x50, 0xDD, 0x79, 0x10, 0x0B,
+    0x3E, 0x15, 0x1B, 0x18, 0xDB, 0xDB, 0xD6, 0xBD, 0x1F, 0xB3, 0x34, 0xD2, 0xC8, 0xDC, 0x85, 0x4F,
+    0x8E, 0x05, 0x9F, 0x86, 0xEB, 0x81, 0x19, 0xD8, 0x0D, 0x6F, 0xFB, 0x3B, 0x07, 0x26, 0x45, 0xBD,
+    0x00, 0x9C, 0xF3, 0x1C, 0x9D, 0xF1, 0xB0, 0x8A, 0x34, 0x12, 0x66, 0xE8, 0x7C, 0x39, 0x56, 0x53,
+    0x11, 0x58, 0x88, 0xD8, 0xFE, 0x14, 0x66, 0x34, 0x6D, 0x3E, 0x17, 0x03, 0x8E, 0x19, 0xEB, 0xED,
+    0xBB, 0x0A, 0x95, 0x14, 0x91, 0xD4, 0xD6, 0xD2, 0x80, 0xFB, 0x93, 0x48, 0xD2, 0x47, 0x0B, 0x70,
+    0x89, 0xA4, 0xDF, 0x4A, 0x79, 0xE8, 0x02, 0xF0, 0x99, 0xED, 0x3E, 0xF3, 0x66, 0xC4, 0x14, 0x01,
+    0xE8, 0x76, 0x0D, 0xBC, 0xC7, 0x64, 0xBE, 0x4D, 0x29, 0x8D, 0x85, 0xB4, 0x20, 0xC9, 0x37, 0xBA,
+    0x13, 0x0B, 0x0D, 0x89, 0x6D, 0x26, 0x42, 0xA6, 0x1E, 0x9A, 0x19, 0x0A, 0xB5, 0x49, 0x1B, 0xA7,
+    0x4A, 0x84, 0x42, 0x03, 0x34, 0xBA, 0xF0, 0x2B, 0xAF, 0x2A, 0xCD, 0x04, 0xF2, 0x9D, 0x14, 0x73,
+    0x49, 0xBE, 0x92, 0x22, 0x0F, 0x4B, 0x9E, 0x62, 0x24, 0x9B, 0x20, 0xC2, 0xB3, 0x9B, 0xC5, 0x44,
+    0xAE, 0xBE, 0xD2, 0x54, 0x6A, 0x29, 0x96, 0xDF, 0xCE, 0x37, 0x30, 0xA8, 0xC7, 0x8C, 0x07, 0xC8,
+    0xD0, 0x48, 0xA9, 0xBF, 0x44, 0x1A, 0x8D, 0x16, 0xCE, 0xDD, 0x06, 0x4E, 0x92, 0x34, 0x6E, 0x2E,
+    0x0F, 0x4E, 0x60, 0xAF, 0x47, 0xCC, 0x58, 0x85, 0x07, 0xC9, 0xF3, 0x39, 0x5D, 0xA0, 0xD3, 0x8A,
+    0x95, 0x06, 0x93, 0x5A, 0x74, 0xD1, 0xDB, 0x65, 0x93, 0x6E, 0xF9, 0x64, 0x3D, 0xE7, 0xEA, 0x8F,
+    0x12, 0x34, 0x6D, 0x1D, 0x66, 0x17, 0xC8, 0x75, 0x3B, 0xFB, 0xC3, 0x7A, 0x9B, 0xAB, 0x63, 0x99,
+    0x18, 0xA3, 0x88, 0x93, 0x7C, 0xE6, 0x92, 0x69, 0x9A, 0x4D, 0x60, 0x3D, 0x46, 0x14, 0x8A, 0xAC,
+    0x55, 0xB0, 0x6D, 0xBD, 0xEB, 0xE4, 0x5C, 0x7D, 0xAE, 0x85, 0x4E, 0x83, 0xF9, 0xF0, 0xB3, 0x79,
+    0x04, 0xEB, 0x29, 0x66, 0xB0, 0x3D, 0xC5, 0xF6, 0x69, 0x85, 0x7A, 0xFD, 0x1E, 0x89, 0xF7, 0xED,
+    0x71, 0x5D, 0x80, 0x13, 0x40, 0x35, 0x6D, 0x98, 0x9F, 0x99, 0x77, 0x4D, 0x8D, 0x9F, 0x42, 0xA7,
+    0x35, 0x1E, 0x33, 0x51, 0xAC, 0xA0, 0x9E, 0x2E, 0x70, 0x22, 0xE9, 0x4F, 0x37, 0xE6, 0x5A, 0x32,
+    0xA9, 0xD5, 0x97, 0x7A, 0x97, 0xC8, 0x1F, 0x29, 0xE6, 0x0D, 0xCE, 0xC3, 0xCC, 0x64, 0x7A, 0xAF,
+    0xB7, 0x9A, 0x0B, 0xA9, 0x7D, 0x78, 0x6D, 0x39, 0xCB, 0x31, 0xAA, 0x50, 0x06, 0x9A, 0xEB, 0x11,
+    0x3A, 0x6D, 0xF6, 0x6A, 0x15, 0x80, 0x53, 0x0F, 0x54, 0xC7, 0x3F, 0x7B, 0xE2, 0x1E, 0xE1, 0xF8,
+    0x1F, 0x2F, 0xC5, 0x5C, 0xAE, 0x2B, 0xB5, 0x7A, 0xBA, 0x91, 0x2C, 0x1E, 0xC5, 0x05, 0xFE, 0x3E,
+    0x9D, 0xF7, 0x50, 0x9F, 0xBF, 0x88, 0x19, 0xBB, 0x1E, 0xF3, 0xD1, 0x0C, 0xE6, 0xA0, 0x07, 0x6B,
+    0x9F, 0x00, 0x99, 0xBB, 0x37, 0x23, 0x5D, 0x48, 0x0E, 0xB5, 0xA4, 0xA5, 0x90, 0x14, 0xCD, 0xFC,
+    0x65, 0x45, 0x3B, 0xD2, 0x4D, 0xEA, 0xB1, 0xEF, 0xAC, 0x9B, 0x73, 0x2A, 0x3B, 0x52, 0x44, 0xF5,
+    0x54, 0xB7, 0x56, 0xB0, 0xBB, 0xAF, 0x4C, 0x54, 0xFF, 0x2B, 0xBA, 0x25, 0x49, 0xCF, 0x2B, 0x01,
+    0x8A, 0x0A, 0x92, 0x54, 0x48, 0x1A, 0x8D, 0x74, 0x03, 0x36, 0x7B, 0x28, 0x8B, 0x1D, 0x64, 0xD1,
+    0x41, 0x9E, 0x0A, 0x41, 0x1E, 0x57, 0x9A, 0x37, 0xE2, 0x9A, 0x49, 0xF1, 0xA5, 0x52, 0x8A, 0x98,
+    0x3B, 0x8A, 0xD4, 0x83, 0x9D, 0xB1, 0x7D, 0x3D, 0x63, 0x5B, 0x33, 0x63, 0x49, 0xC5, 0xB4, 0x15,
+    0x7D, 0x33, 0xD3, 0x48, 0x33, 0x46, 0x9A, 0xA9, 0xA4, 0x99, 0x42, 0x9A, 0x37, 0x9B, 0xF2, 0xD3,
+    0x45, 0x09, 0x76, 0xB4, 0x42, 0x29, 0xC5, 0x23, 0x45, 0xF6, 0x95, 0xE5, 0x2C, 0xCD, 0x1B, 0x91,
+    0xEC, 0xE0, 0xAB, 0x9F, 0x9A, 0xD6, 0x63, 0xFF, 0xEA, 0x62, 0xDF, 0x49, 0x85, 0xB4, 0xD4, 0xFB,
+    0x2F, 0x9D, 0x79, 0x80, 0x14, 0xEF, 0x5F, 0xD4, 0xF7, 0x25, 0xD5, 0x52, 0xEC, 0xF4, 0xEE, 0x1F,
+    0xAF, 0x09, 0xA9, 0xAB, 0x47, 0xE8, 0x7A, 0x72, 0x7D, 0x77, 0xAA, 0xA4, 0xA1, 0x91, 0x5A, 0xA7,
+    0x25, 0x17, 0x54, 0x73, 0x32, 0x2A, 0xF5, 0xEE, 0xFE, 0x9F, 0x48, 0xBA, 0x2A, 0xC9, 0x4A, 0x8B,
+    0xA4, 0x8F, 0x76, 0x1E, 0xF0, 0x23, 0x12, 0xD2, 0x52, 0x49, 0xF1, 0xC4, 0xDE, 0x8F, 0xF7, 0x2F,
+    0x6F, 0x50, 0x2A, 0x62, 0xDF, 0x8B, 0xC5, 0x9C, 0x4F, 0xF5, 0xB5, 0xAF, 0x04, 0x27, 0x5D, 0x96,
+    0x74, 0x5A, 0x5A, 0xEC, 0x9F, 0xB7, 0xAC, 0x09, 0x0C, 0xAB, 0x74, 0xE6, 0xDF, 0xEF, 0xBC, 0xA9,
+    0x5A, 0xE2, 0xA1, 0x84, 0x65, 0xD8, 0xD6, 0xA2, 0xF7, 0xE7, 0x5C, 0x1A, 0x0A, 0xAD, 0x64, 0xEE,
+    0x1E, 0x58, 0x8F, 0x7C, 0xDF, 0xE9, 0xF7, 0xA4, 0xD8, 0x49, 0x37, 0xA5, 0xFD, 0x27, 0x0F, 0x29,
+    0xCB, 0x56, 0xA8, 0xD6, 0x8B, 0x87, 0x94, 0x69, 0xAA, 0x62, 0xA2, 0xCC, 0xF5, 0x14, 0xDA, 0xDF,
+    0x3F, 0x9D, 0x28, 0x8B, 0x92, 0x7E, 0x24, 0xE9, 0xFD, 0x9D, 0x5B, 0xDF, 0x78, 0xDB, 0x3A, 0x1D,
+    0x18, 0x03, 0xDC, 0x6D, 0x0C, 0x7C, 0x52, 0xD4, 0x1D, 0x6B, 0xC1, 0xB5, 0x14, 0x6B, 0x1A, 0x9D,
+    0x36, 0x6C, 0x33, 0xF7, 0xCF, 0x94, 0x3A, 0x13, 0xC0, 0x7A, 0x32, 0x25, 0xD8, 0xD6, 0x4E, 0xB0,
+    0xD7, 0xFE, 0x0C, 0xA8, 0x7B, 0xE4, 0xBB, 0xFA, 0x50, 0xD2, 0x15, 0x49, 0xB5, 0xEE, 0xBC, 0xB8,
+    0x35, 0x78, 0x27, 0x77, 0xEE, 0xDD, 0xD4, 0xE0, 0x9D, 0xDC, 0x79, 0xF2, 0x35, 0xC9, 0x9D, 0xBD,
+    0xB3, 0xFF, 0xA2, 0xA4, 0x5B, 0x9B, 0xDC, 0x75, 0xD2, 0x2A, 0x29, 0xE6, 0x73, 0xF2, 0x59, 0x5E,
+    0x4E, 0x93, 0x6E, 0xA1, 0xE4, 0x8F, 0x7E, 0x02, 0x02, 0x46, 0xDE, 0x43, 0x97, 0xEC, 0x92, 0x26,
+    0x59, 0x68, 0x99, 0x0E, 0xA2, 0x31, 0x00, 0x97, 0xB0, 0xAD, 0x7B, 0x72, 0xC2, 0xA9, 0xC5, 0x4D,
+    0xE0, 0xFA, 0x84, 0xB3, 0xDC, 0xB7, 0x7D, 0xC2, 0x34, 0x1F, 0x23, 0x3B, 0x63, 0x7B, 0xDB, 0xDB,
+    0x2B, 0x33, 0x56, 0x3D, 0x36, 0xA9, 0x7D, 0x9E, 0xFE, 0x71, 0xC3, 0x2D, 0x5F, 0x5B, 0x3A, 0xF9,
+    0x62, 0x75, 0xDE, 0xF6, 0xCD, 0xE3, 0xCB, 0x89, 0xAE, 0x92, 0xA2, 0x95, 0x26, 0x49, 0xD7, 0xEF,
+    0x9C, 0xC5, 0x8C, 0x60, 0x07, 0x70, 0x1F, 0x1E, 0x1F, 0x36, 0x2B, 0x35, 0x93, 0x02, 0x17, 0x6F,
+    0xEF, 0x50, 0x26, 0x13, 0x00, 0xB3, 0x02, 0x46, 0x01, 0xCC, 0x4D, 0xF1, 0xB1, 0xC6, 0xCD, 0x3D,
+    0xB3, 0xE5, 0xDA, 0x27, 0x3D, 0x65, 0x95, 0x0C, 0x1E, 0xF9, 0x46, 0x17, 0x4E, 0xBC, 0x60, 0x56,
+    0x36, 0x58, 0x28, 0x61, 0x88, 0x09, 0x10, 0x0E, 0xC9, 0xAB, 0xFE, 0x8D, 0xB6, 0x10, 0x46, 0x51,
+    0x3E, 0x97, 0xBA, 0x89, 0x4E, 0xEF, 0x09, 0xBA, 0xDB, 0x1A, 0x31, 0xC1, 0xEA, 0x5B, 0xBF, 0x1B,
+    0x37, 0xAB, 0x5D, 0xC9, 0x13, 0x56, 0xC0, 0x49, 0x13, 0x99, 0x5B, 0x37, 0xC1, 0xCD, 0xC3, 0xC6,
+    0xE5, 0x15, 0x3A, 0xF5, 0xD9, 0x52, 0x8F, 0x65, 0xC8, 0xEF, 0xF7, 0x6C, 0xBB, 0xEB, 0x73, 0xAE,
+    0x8F, 0xE6, 0x4A, 0x9A, 0xCD, 0x35, 0xCD, 0x4D, 0x6B, 0x27, 0x4B, 0x33, 0x9D, 0xA2, 0x9E, 0x4E,
+    0x61, 0xA6, 0x53, 0x98, 0xC9, 0x52, 0x4F, 0xB6, 0xED, 0x42, 0x23, 0x05, 0x93, 0xD0, 0xD5, 0x90,
+    0x4B, 0x81, 0xEE, 0xCD, 0x90, 0x38, 0x53, 0x8F, 0xA6, 0xED, 0xBC, 0x91, 0x7C, 0x2D, 0xB5, 0x8D,
+    0x16, 0x3E, 0xB7, 0xC3, 0xFC, 0x28, 0xA7, 0x2A, 0xC0, 0x36, 0xE9, 0xC4, 0x1D, 0xC8, 0xD1, 0xFC,
+    0x78, 0x1F, 0xFB, 0x61, 0xDD, 0x01, 0x27, 0x8D, 0x68, 0x9B, 0x83, 0x85, 0x5B, 0xDB, 0x2F, 0xF7,
+    0x76, 0xDE, 0xE1, 0x68, 0xD5, 0x72, 0x00, 0xA0, 0xEE, 0x58, 0xF7, 0xE7, 0x98, 0x88, 0xD5, 0x2D,
+    0x51, 0x69, 0xD1, 0x90, 0x49, 0x17, 0x23, 0x99, 0xFE, 0x5A, 0x3D, 0xD6, 0x6B, 0xFD, 0xD2, 0xB9,
+    0xD0, 0x48, 0x8A, 0x85, 0x24, 0xA5, 0x9E, 0xC8, 0x25, 0x0D, 0x1C, 0xDF, 0x00, 0x4B, 0xAA, 0x50,
+    0x0D, 0xF5, 0x1D, 0x61, 0x15, 0x71, 0xF2, 0x34, 0x37, 0xEE, 0x6D, 0x58, 0xB9, 0xD8, 0xDE, 0xAD,
+    0x6B, 0x25, 0xCD, 0xF6, 0x49, 0xBD, 0x3D, 0x15, 0x3A, 0xED, 0xAB, 0xE5, 0x14, 0xF5, 0x34, 0x63,
+    0xAF, 0x8F, 0xE8, 0xB4, 0x2F, 0x17, 0xDB, 0x76, 0x3B, 0x87, 0x27, 0x4F, 0xC6, 0x4D, 0xC8, 0x74,
+    0xCE, 0x83, 0xA0, 0x9C, 0x4D, 0xDB, 0x79, 0x2B, 0x65, 0x49, 0xEE, 0xDB, 0xC4, 0xA9, 0xC6, 0x6F,
+    0xB1, 0xB4, 0x2D, 0x08, 0xA2, 0x9E, 0xCD, 0x57, 0x38, 0x71, 0xF6, 0x1F, 0x1C, 0xA7, 0xB2, 0xB3,
+    0xA9, 0xDB, 0xBB, 0x4D, 0x67, 0x2E, 0x60, 0xE7, 0x9F, 0x17, 0xA7, 0x12, 0x24, 0x10, 0x77, 0xC3,
+    0xB1, 0x38, 0x1C, 0x3C, 0xDD, 0x98, 0xA0, 0xB1, 0x0D, 0x97, 0x2A, 0x05, 0x64, 0x1F, 0xAF, 0xC8,
+    0x3F, 0xDD, 0x31, 0x7A, 0x6C, 0x2F, 0x51, 0xA1, 0x91, 0x42, 0x2D, 0x26, 0x82, 0x0D, 0xE4, 0xEA,
+    0x31, 0xCB, 0xD6, 0xF3, 0x9B, 0x2F, 0x3A, 0xAD, 0xB9, 0x3E, 0x9A, 0x1B, 0x69, 0x5C, 0x6A, 0x7D,
+    0x73, 0x30, 0x8B, 0xA5, 0x99, 0x66, 0xBA, 0xEB, 0x23, 0x3A, 0xDD, 0x17, 0x8B, 0xA5, 0x9E, 0x96,
+    0x4C, 0xAF, 0x25, 0xDB, 0x32, 0x56, 0x69, 0x84, 0xFA, 0x72, 0x71, 0x09, 0x37, 0xA8, 0xC7, 0x93,
+    0x99, 0x48, 0x5E, 0xD2, 0xD0, 0x68, 0xE1, 0xDF, 0xED, 0x82, 0xF5, 0x94, 0xC3, 0xE6, 0x89, 0x27,
+    0xBF, 0x4A, 0x9E, 0x62, 0x6E, 0x3C, 0x47, 0xFC, 0xA4, 0xDD, 0x89, 0x91, 0x62, 0xA9, 0x03, 0x66,
+    0xEA, 0x3C, 0xF6, 0x9A, 0x40, 0x4F, 0x46, 0x8A, 0xB5, 0x09, 0x98, 0xD9, 0x79, 0xEC, 0xDB, 0x02,
+    0x7D, 0x33, 0x52, 0xAC, 0xCD, 0x84, 0x99, 0xDD, 0x40, 0xF7, 0x81, 0xBE, 0xFD, 0x65, 0xBD, 0x2E,
+    0x49, 0x8D, 0xD2, 0x8C, 0x9B, 0xCC, 0xE1, 0xAB, 0x92, 0x64, 0x67, 0x9A, 0xA8, 0x11, 0x77, 0x4B,
+    0x7D, 0xAE, 0xAB, 0x2B, 0x95, 0xC0, 0xB4, 0x1B, 0x82, 0x57, 0x89, 0xE4, 0x43, 0x9A, 0x49, 0xB0,
+    0x1E, 0x99, 0x77, 0x76, 0x9B, 0xDB, 0x81, 0x22, 0x26, 0x6C, 0x68, 0x22, 0xEB, 0xCE, 0xB7, 0x37,
+    0x7F, 0x9D, 0x8C, 0xCE, 0x36, 0x93, 0x44, 0xB9, 0x7E, 0x31, 0x52, 0x87, 0x62, 0xA2, 0xEB, 0xAB,
+    0x31, 0x5F, 0x68, 0xFA, 0x6A, 0xE2, 0x12, 0xCD, 0x90, 0xCF, 0xA8, 0x35, 0xA1, 0x58, 0xB0, 0xDE,
+    0xCC, 0x08, 0x3B, 0x96, 0x11, 0xF9, 0x26, 0x14, 0xC2, 0xF9, 0x32, 0x52, 0x2C, 0x74, 0x1E, 0x3B,
+    0xDC, 0x5B, 0xCD, 0xF4, 0xEE, 0xBE, 0x9B, 0xAD, 0x94, 0x26, 0x55, 0x45, 0x2B, 0x49, 0xDE, 0x0D,
+    0x74, 0x63, 0xB5, 0x50, 0x0A, 0xF7, 0xC3, 0x3D, 0x17, 0x52, 0xFF, 0x27, 0x34, 0xE2, 0x40, 0x14,
+    0x76, 0xD5, 0x11, 0x17, 0xCC, 0x4A, 0x75, 0x57, 0x35, 0xE9, 0x01, 0x01, 0x5F, 0xD1, 0x40, 0x2D,
+    0xB5, 0x74, 0xFA, 0xBF, 0x3B, 0xE2, 0x6E, 0x27, 0xA0, 0x78, 0xA0, 0x93, 0x7C, 0xA6, 0x0B, 0x8E,
+    0x32, 0xB2, 0x50, 0x8F, 0xF9, 0x8C, 0x6B, 0x8F, 0x12, 0x67, 0x87, 0x22, 0x26, 0xE2, 0x56, 0xAC,
+    0x37, 0x73, 0x26, 0x6C, 0xA8, 0x12, 0x71, 0x59, 0x7B, 0xC6, 0x7E, 0xE3, 0x35, 0x7D, 0xC7, 0x5C,
+    0x8C, 0xA7, 0x9A, 0xE1, 0xF7, 0x7F, 0xF5, 0x5E, 0x3C, 0xB3, 0xCF, 0x57, 0xAA, 0x99, 0x66, 0xC4,
+    0xF5, 0xD9, 0x4A, 0x39, 0x53, 0x8F, 0x74, 0xBB, 0x6A, 0xA0, 0xF3, 0x99, 0x28, 0x23, 0x4D, 0xC0,
+    0xF9, 0x5C, 0x98, 0x05, 0x3B, 0xA1, 0xA1, 0x3E, 0x7F, 0x79, 0x3D, 0xF9, 0xEC, 0x47, 0xAF, 0xBF,
+    0x1E, 0x9F, 0x6E, 0x8E, 0x0C, 0xBA, 0xA6, 0xCF, 0xE7, 0x5D, 0x51, 0xCC, 0xD8, 0xAD, 0x88, 0x58,
+    0x9F, 0x8A, 0x85, 0x63, 0x5F, 0x75, 0x5F, 0x4F, 0x4C, 0xBC, 0xBE, 0xFF, 0xD2, 0xC7, 0xA8, 0x3B,
+    0x3B, 0xA6, 0xAC, 0xA0, 0x83, 0x43, 0xB6, 0x42, 0x7D, 0xDF, 0x41, 0x50, 0x87, 0xDD, 0x21, 0x17,
+    0x34, 0xE9, 0x60, 0x27, 0x0A, 0xB5, 0x09, 0xAB, 0xCE, 0xDA, 0x46, 0x42, 0x5A, 0x2B, 0x29, 0x9E,
+    0x78, 0x80, 0x7E, 0x68, 0x7A, 0xB8, 0x94, 0x42, 0xF4, 0xD5, 0x98, 0x3E, 0xAE, 0x49, 0xB6, 0xCC,
+    0x98, 0x84, 0x4D, 0x49, 0xFA, 0x36, 0xC3, 0x11, 0xB5, 0x98, 0xB9, 0xDA, 0x5E, 0xE5, 0xD1, 0x57,
+    0x4C, 0xAF, 0x2A, 0x56, 0xB1, 0x8A, 0x66, 0x31, 0x8B, 0x59, 0xCC, 0xD0, 0xB4, 0x16, 0x3B, 0x35,
+    0xF3, 0xF1, 0x09, 0x4C, 0x30, 0xA1, 0x0E, 0xCD, 0xD4, 0x4C, 0x3B, 0x45, 0x5F, 0x8D, 0xBB, 0x97,
+    0xD9, 0xBD, 0xB6, 0x24, 0x2E, 0x33, 0x55, 0xA1, 0x1E, 0x6D, 0xDF, 0xD1, 0x45, 0x1B, 0xAB, 0xC8,
+    0x67, 0x8E, 0xB5, 0xDD, 0x73, 0x32, 0xD1, 0x86, 0x43, 0x23, 0xD9, 0xCC, 0xCD, 0xE8, 0x9E, 0x5B,
+    0xAB, 0xB9, 0x1E, 0xBB, 0xAF, 0xAF, 0xE5, 0x5C, 0x8F, 0xDD, 0xD7, 0x55, 0xC6, 0x3A, 0x74, 0xAF,
+    0xA9, 0x8A, 0x4D, 0xD0, 0x75, 0x9D, 0x5E, 0x9A, 0xE7, 0xE6, 0xE6, 0xB9, 0xB9, 0x39, 0x3F, 0xDB,
+    0xF3, 0xB3, 0x3D, 0x1F, 0xED, 0xE5, 0x68, 0x2F, 0x2F, 0x9D, 0xA7, 0x58, 0xEC, 0x56, 0x94, 0x8B,
+    0xF5, 0x94, 0x71, 0x57, 0x54, 0x77, 0x17, 0x66, 0x3E, 0x52, 0x0C, 0x98, 0xE9, 0xAE, 0xA2, 0x0E,
+    0x76, 0x3C, 0x52, 0x34, 0xA1, 0x0B, 0x5B, 0x31, 0x76, 0x21, 0xA1, 0x98, 0x76, 0x04, 0xBA, 0x81,
+    0x5F, 0x6A, 0x93, 0x9C, 0xFB, 0x54, 0x34, 0x9B, 0x57, 0xBA, 0xD9, 0x0A, 0xC7, 0x8F, 0x3A, 0x19,
+    0xA2, 0xBE, 0x1C, 0xE9, 0xEA, 0x90, 0x47, 0x37, 0x98, 0x0F, 0xD4, 0x72, 0xEC, 0x2E, 0x2F, 0xAB,
+    0x79, 0x6D, 0xC6, 0x55, 0x63, 0x1E, 0x9B, 0xBE, 0x1A, 0x2F, 0xD1, 0x9C, 0x9F, 0xB9, 0x64, 0xC6,
+    0x7C, 0xB6, 0xBD, 0x19, 0x56, 0xEC, 0x13, 0x33, 0x8B, 0x09, 0xC5, 0x64, 0xBD, 0xF1, 0xC2, 0x16,
+    0x91, 0x68, 0xA6, 0x32, 0x75, 0x60, 0x2D, 0xE8, 0x66, 0x72, 0x0D, 0x69, 0x52, 0x39, 0x10, 0x3A,
+    0x92, 0xF3, 0x50, 0xAF, 0xD0, 0x68, 0xA4, 0xB9, 0xB6, 0xD2, 0xF4, 0xF7, 0xC5, 0x12, 0x95, 0x50,
+    0x7C, 0xEA, 0x29, 0xE5, 0x7C, 0x64, 0x3B, 0x10, 0xBC, 0x09, 0xC9, 0xA3, 0x28, 0xD6, 0x23, 0x67,
+    0x99, 0x29, 0x4D, 0xF2, 0xD9, 0x41, 0xAC, 0x62, 0x3B, 0x2B, 0x3F, 0x38, 0x6B, 0x2C, 0x6E, 0x74,
+    0x53, 0x26, 0x45, 0x3A, 0x29, 0xA1, 0x90, 0x52, 0x9B, 0x5D, 0x3C, 0xDA, 0xB6, 0x7C, 0x82, 0xCE,
+    0x53, 0x8B, 0x52, 0x31, 0x5B, 0x4D, 0xE8, 0xDA, 0xE6, 0x1E, 0xAD, 0x9D, 0x6F, 0x98, 0xC8, 0x76,
+    0x98, 0xC0, 0xB6, 0xE9, 0x90, 0x4C, 0xFB, 0xBB, 0x0F, 0x5D, 0x42, 0x7D, 0x56, 0x72, 0x8D, 0x34,
+    0x0B, 0x85, 0xFC, 0x5D, 0xB1, 0x1D, 0xDC, 0xB4, 0xA1, 0x7B, 0xD5, 0xBA, 0x9B, 0x68, 0x0F, 0x42,
+    0x9B, 0xCD, 0x0C, 0x68, 0x80, 0xEC, 0x7E, 0xCF, 0xB7, 0x19, 0x6C, 0x40, 0x5F, 0x54, 0x5F, 0x44,
+    0x13, 0x31, 0xC1, 0x0D, 0xD8, 0x2B, 0x2B, 0x99, 0x6C, 0xA0, 0xBC, 0xAD, 0x9E, 0xFA, 0xFD, 0x08,
+    0x4E, 0x03, 0xB9, 0xD6, 0xCD, 0xC0, 0xB6, 0x6A, 0x21, 0xE5, 0xE5, 0xAD, 0x50, 0x4B, 0xD0, 0x49,
+    0x64, 0xB2, 0xA2, 0x8A, 0x9D, 0xDA, 0x26, 0x74, 0x6A, 0xE5, 0x9D, 0xCE, 0x0B, 0xA7, 0xDE, 0x84,
+    0x34, 0x38, 0x0F, 0xF6, 0xE1, 0x70, 0xAF, 0x3D, 0xD4, 0x97, 0x17, 0xEA, 0xAB, 0x13, 0xF5, 0xFB,
+    0x23, 0x8D, 0x3C, 0x8D, 0x52, 0xCC, 0xB9, 0x51, 0x8B, 0xD5, 0x80, 0xD5, 0x8C, 0x7D, 0x6B, 0xC5,
+    0xBE, 0x2E, 0x6F, 0x5F, 0x53, 0xB0, 0x5E, 0xF7, 0xB9, 0x33, 0x99, 0x46, 0x32, 0x0D, 0x89, 0x6A,
+    0x79, 0x32, 0xF5, 0x14, 0x6A, 0x29, 0x94, 0x58, 0xF2, 0xD0, 0x4B, 0x69, 0x00, 0x3E, 0x39, 0x9A,
+    0xD3, 0xBE, 0x6E, 0xFA, 0xBA, 0xA3, 0x59, 0x68, 0x66, 0x6C, 0xC0, 0x06, 0xEC, 0x8C, 0x15, 0xA7,
+    0x3A, 0xFF, 0x6C, 0x13, 0x9E, 0x35, 0x4B, 0x31, 0x42, 0xD3, 0x42, 0x4C, 0x4A, 0xC6, 0x1E, 0xEA,
+    0x21, 0x33, 0x25, 0x41, 0xB9, 0x57, 0xC9, 0x6C, 0xD3, 0xF9, 0xA1, 0xE1, 0x55, 0x6E, 0x1F, 0x9D,
+    0x27, 0xDF, 0x7C, 0xD7, 0xE6, 0x23, 0x2D, 0x9B, 0x6F, 0xFB, 0x56, 0x72, 0x9B, 0x16, 0xE0, 0x14,
+    0x4D, 0x6B, 0x7C, 0x39, 0x16, 0x77, 0x65, 0x87, 0xDA, 0xD6, 0x0C, 0x65, 0xC8, 0x22, 0x1D, 0x8D,
+    0xAF, 0x42, 0x1E, 0x71, 0x58, 0x6F, 0xC6, 0x62, 0x66, 0xC5, 0xF6, 0xBB, 0xCA, 0xB7, 0x8C, 0xCE,
+    0x2B, 0x28, 0x9A, 0x15, 0x0A, 0xF5, 0xA9, 0x9B, 0x6D, 0x48, 0x10, 0x6D, 0xB5, 0x24, 0xD3, 0x32,
+    0x93, 0x87, 0xFD, 0x7B, 0x21, 0x81, 0x62, 0x39, 0x12, 0x79, 0xDB, 0x85, 0xE3, 0x10, 0x87, 0x5F,
+    0x1C, 0x0C, 0x97, 0xCE, 0x27, 0x5A, 0xCA, 0x5D, 0x68, 0xEC, 0x60, 0xFC, 0xAC, 0xD2, 0x13, 0x92,
+    0x06, 0x49, 0x93, 0x95, 0x16, 0x23, 0xA9, 0x2D, 0x26, 0x6C, 0x5B, 0x06, 0x3A, 0xCA, 0x80, 0xA3,
+    0xDA, 0x0A, 0x61, 0x46, 0xD6, 0x7B, 0x8A, 0x33, 0x46, 0xBD, 0xA2, 0xB9, 0x1B, 0x47, 0x78, 0xE8,
+    0x25, 0x34, 0x9A, 0x05, 0x79, 0x33, 0xE7, 0x6A, 0x6D, 0x28, 0x85, 0x1B, 0x13, 0xDF, 0xDB, 0x23,
+    0x7C, 0xAF, 0xBD, 0xE8, 0x8A, 0x98, 0x47, 0x13, 0xAA, 0xD0, 0x79, 0xFB, 0xAA, 0x58, 0xCB, 0x98,
+    0xBF, 0xB8, 0x75, 0xC3, 0x01, 0xDF, 0x03, 0xB8, 0xF7, 0xEF, 0xE2, 0xBB, 0xA4, 0x09, 0x2E, 0xC1,
+    0x25, 0x58, 0x61, 0x35, 0xC3, 0x6A, 0x86, 0xA5, 0x7E, 0x75, 0xA9, 0x3D, 0xB5, 0xA7, 0x39, 0xF2,
+    0xB6, 0x1E, 0xDB, 0x3F, 0xE8, 0xFD, 0x2D, 0xEC, 0x8A, 0x15, 0x56, 0x77, 0xB7, 0xAC, 0x9A, 0xAC,
+    0xB7, 0x83, 0xD0, 0xF9, 0x58, 0xAC, 0x26, 0xD4, 0xB1, 0xF3, 0x27, 0xBE, 0x74, 0x44, 0x22, 0xFE,
+    0xF6, 0x96, 0x99, 0x01, 0x33, 0x90, 0x9A, 0x52, 0xBF, 0x7A, 0xB6, 0xB9, 0x1C, 0x9B, 0xCB, 0x4B,
+    0x73, 0x79, 0x69, 0xAE, 0xAC, 0xF6, 0xF5, 0xF5, 0x6F, 0x6D, 0x4D, 0xDA, 0x7E, 0xFF, 0x30, 0x3E,
+    0x47, 0x96, 0x32, 0x38, 0xCC, 0x78, 0x60, 0x9F, 0x25, 0x07, 0xF4, 0xE0, 0x84, 0x3C, 0x39, 0x36,
+    0xA7, 0x53, 0xA6, 0x97, 0x80, 0x04, 0xC5, 0x26, 0xC3, 0x13, 0x48, 0x99, 0x25, 0xC5, 0x96, 0xE7,
+    0x92, 0xEE, 0x91, 0xFC, 0x8A, 0x0D, 0x03, 0x2A, 0xD3, 0x2D, 0xEA, 0x70, 0x24, 0x89, 0x26, 0x85,
+    0xC3, 0xE8, 0xE2, 0x91, 0x6B, 0xEB, 0xED, 0xFF, 0xE4, 0x34, 0x50, 0x49, 0xC9, 0x8C, 0x92, 0x16,
+    0x8A, 0x55, 0xD2, 0x44, 0x73, 0x4B, 0xD2, 0x90, 0x12, 0x28, 0x77, 0x09, 0x3B, 0x9D, 0xE7, 0x20,
+    0x22, 0xB5, 0x25, 0xFC, 0x64, 0xDB, 0x09, 0x49, 0xAC, 0x0F, 0x50, 0x44, 0x33, 0x6C, 0x91, 0xED,
+    0x2C, 0x92, 0x22, 0xC6, 0x09, 0x44, 0x76, 0x5B, 0x42, 0x40, 0x02, 0xCF, 0x93, 0x25, 0xF7, 0x6C,
+    0x4B, 0xA1, 0x39, 0xF9, 0x2A, 0x09, 0x42, 0x59, 0xA1, 0xD1, 0x4C, 0xA5, 0xD3, 0x23, 0xC7, 0x2F,
+    0x24, 0xCB, 0xF5, 0x0C, 0x14, 0x1A, 0xC1, 0x24, 0x33, 0xFC, 0x68, 0x54, 0xE8, 0xD9, 0xED, 0x86,
+    0x59, 0xFC, 0xB8, 0xF8, 0x73, 0x3D, 0x61, 0x6E, 0xCA, 0x67, 0x6B, 0xBD, 0x50, 0xBF, 0xAD, 0x90,
+    0xAD, 0x8D, 0xDA, 0xE6, 0x6D, 0xC5, 0x7C, 0xB1, 0x1A, 0x9A, 0xEB, 0x52, 0xB1, 0x58, 0x4D, 0xF6,
+    0xBA, 0xBA, 0xCB, 0x8B, 0xBD, 0xB5, 0xD8, 0xCB, 0x6A, 0xDE, 0x89, 0x5D, 0x50, 0x77, 0x45, 0x95,
+    0x62, 0x17, 0x3A, 0xBD, 0xAE, 0x42, 0xD1, 0x85, 0x5A, 0xAF, 0x0B, 0x45, 0x85, 0x4A, 0x57, 0x85,
+    0x9D, 0xE1, 0x99, 0xD4, 0x8A, 0xBA, 0x87, 0x65, 0x23, 0xF5, 0xBE, 0x2D, 0xBA, 0x0B, 0x85, 0x34,
+    0xD6, 0xD2, 0xD0, 0xDD, 0xE8, 0x5E, 0x5D, 0xE9, 0xCA, 0x40, 0x6C, 0x7C, 0x31, 0x39, 0xCC, 0x1B,
+    0x91, 0xEE, 0xF9, 0x29, 0x5B, 0xED, 0x50, 0xCD, 0x6A, 0x9B, 0x77, 0x56, 0xDC, 0xD5, 0xB9, 0x90,
+    0x1D, 0x4D, 0x04, 0xCC, 0x4D, 0xB5, 0xA8, 0x8E, 0xD4, 0x3F, 0xD0, 0x90, 0xAD, 0x8D, 0xA8, 0xDF,
+    0xD6, 0x94, 0xAF, 0x8D, 0x7C, 0x73, 0x5D, 0x4B, 0xBE, 0x58, 0x05, 0x7B, 0x5D, 0x7A, 0x62, 0xB1,
+    0x3F, 0x8A, 0xF6, 0xBA, 0xEC, 0xF5, 0x68, 0x3F, 0x58, 0xED, 0x15, 0x99, 0x1F, 0xC5, 0x2E, 0x38,
+    0x5D, 0x51, 0xA9, 0xE8, 0x82, 0xD5, 0xEB, 0xCA, 0x14, 0x5D, 0x30, 0xBA, 0x2A, 0x5C, 0x54, 0x28,
+    0x36, 0x17, 0x27, 0x85, 0x93, 0xC2, 0x36, 0x65, 0xB9, 0x61, 0x17, 0x9F, 0xF0, 0x69, 0xFE, 0x2A,
+    0x04, 0x3C, 0xF2, 0xC2, 0xA6, 0x0E, 0x9B, 0x1B, 0x48, 0x73, 0x29, 0x4D, 0xF5, 0xED, 0x3A, 0x74,
+    0x7D, 0xFD, 0x6A, 0xC4, 0x56, 0x81, 0x25, 0xD1, 0x52, 0xBF, 0xB3, 0xD0, 0x3D, 0x3F, 0xE5, 0x89,
+    0x96, 0xBE, 0xB9, 0xB5, 0xA2, 0xAB, 0xF3, 0x96, 0xC2, 0xA5, 0x40, 0x2E, 0x4F, 0xB5, 0xA6, 0x3F,
+    0x96, 0xA7, 0xD4, 0x41, 0x35, 0xDF, 0x07, 0xCE, 0x72, 0x82, 0x2A, 0xD4, 0x03, 0xCD, 0x9B, 0x13,
+    0xB8, 0x65, 0xF3, 0x29, 0xCD, 0x08, 0xFC, 0xFA, 0xCF, 0xBF, 0x6F, 0x8F, 0xBF, 0xC0, 0x5F, 0xE4,
+    0x4B, 0x35, 0xE1, 0x5C, 0x9A, 0x0D, 0xAB, 0x08, 0xC5, 0x04, 0xBC, 0xF0, 0xC0, 0xA6, 0x98, 0xD7,
+    0x6F, 0x63, 0xA4, 0xBE, 0x96, 0x86, 0xFA, 0x76, 0x1D, 0xEA, 0xB1, 0x0C, 0xB5, 0x2F, 0x42, 0xE3,
+    0x8B, 0x29, 0xED, 0xE5, 0x6C, 0x87, 0x72, 0xB6, 0x43, 0x95, 0xF6, 0xB1, 0x8A, 0x76, 0x34, 0x31,
+    0xF5, 0xF4, 0x23, 0xED, 0x41, 0x64, 0x66, 0x01, 0x3B, 0xEE, 0xC6, 0xD9, 0xBD, 0xF3, 0xC5, 0x07,
+    0x6B, 0x6B, 0xA4, 0xBE, 0x93, 0x1E, 0xD7, 0x1F, 0xAB, 0x9C, 0xB3, 0x58, 0xFB, 0x22, 0x24, 0x39,
+    0xB2, 0x4F, 0x85, 0x6C, 0xB5, 0x43, 0x39, 0xAB, 0x6D, 0xDE, 0x59, 0x70, 0xCF, 0xCF, 0xB9, 0xEC,
+    0x68, 0xA2, 0xFA, 0xE4, 0x91, 0xFF, 0x4C, 0x65, 0xC9, 0xCE, 0xF0, 0x15, 0xF5, 0x18, 0x4D, 0xE4,
+    0x12, 0x34, 0xEB, 0xE1, 0x84, 0xFD, 0xF7, 0x97, 0x1C, 0x13, 0xC9, 0xBA, 0x91, 0x46, 0x7D, 0x4A,
+    0x5C, 0x86, 0x13, 0xFB, 0x0B, 0x07, 0x29, 0x41, 0x81, 0xF2, 0xE3, 0x13, 0x23, 0x3E, 0xF5, 0x64,
+    0xCA, 0x13, 0xFB, 0xBB, 0x78, 0xC7, 0xFC, 0xC8, 0xFE, 0xDE, 0x7D, 0x41, 0x16, 0x37, 0xD0, 0x24,
+    0xA0, 0xD0, 0x4C, 0xCD, 0xE8, 0x5A, 0x7B, 0x39, 0xD2, 0x9D, 0xDE, 0x12, 0x94, 0x56, 0xCC, 0x3B,
+    0x91, 0xEE, 0xF4, 0x5C, 0x2E, 0x8D, 0x14, 0xAC, 0xD4, 0xBB, 0x0D, 0x74, 0x3B, 0xB7, 0x33, 0x52,
+    0xEA, 0xA1, 0xE9, 0x29, 0xA4, 0x61, 0x4B, 0x90, 0xA8, 0x35, 0x01, 0xEE, 0x01, 0xF2, 0x99, 0xB9,
+    0x1B, 0x50, 0x4A, 0x23, 0xA5, 0xA4, 0x94, 0x2C, 0x59, 0xA8, 0xAD, 0xD6, 0x5C, 0x20, 0xAF, 0x9E,
+    0x7A, 0xEA, 0x3C, 0x85, 0x9A, 0xB0, 0x71, 0xA1, 0xBE, 0xB5, 0x42, 0x11, 0xD5, 0x6E, 0x5C, 0xB0,
+    0x6F, 0xCD, 0x50, 0xDF, 0x12, 0x54, 0xD1, 0x8D, 0x94, 0x6A, 0xF4, 0xAD, 0xDF, 0xD3, 0x15, 0x49,
+    0x1A, 0xA5, 0x84, 0x90, 0xA7, 0x30, 0x65, 0x4C, 0xEC, 0xE6, 0x9C, 0x8E, 0x82, 0x83, 0xB6, 0xBF,
+    0x2B, 0x3A, 0x72, 0x4F, 0xAA, 0xC4, 0x4F, 0xC5, 0x8B, 0xEC, 0x2C, 0xC7, 0xCE, 0x60, 0x3D, 0xAE,
+    0x2D, 0x23, 0x66, 0xC2, 0xF9, 0x4C, 0xAD, 0x89, 0x87, 0x59, 0xA9, 0xF7, 0x49, 0x45, 0x26, 0xCD,
+    0xA4, 0x76, 0x66, 0xBA, 0xED, 0x22, 0x66, 0xA1, 0x99, 0x71, 0x1E, 0x1B, 0x8A, 0x15, 0xBA, 0xA1,
+    0x0E, 0x20, 0xEF, 0x3C, 0x99, 0x8A, 0x15, 0xCA, 0x68, 0x66, 0x30, 0xC1, 0x0E, 0x60, 0x07, 0xF5,
+    0xA0, 0x27, 0xD2, 0xD7, 0x11, 0x9A, 0xD0, 0xCC, 0x64, 0xF2, 0x6E, 0xFD, 0x52, 0xA7, 0x4C, 0x92,
+    0xE6, 0x42, 0x92, 0x86, 0x52, 0x92, 0x48, 0xF2, 0x51, 0x4A, 0xE2, 0x2E, 0x01, 0xC9, 0xCE, 0x70,
+    0xAC, 0xCD, 0x56, 0xCA, 0x88, 0xEB, 0x73, 0x61, 0x47, 0xD4, 0xD7, 0xF3, 0x61, 0x0E, 0xED, 0x51,
+    0x4F, 0x45, 0x2D, 0x69, 0x5C, 0xE1, 0x14, 0xC1, 0x4C, 0xCD, 0x48, 0xBE, 0xA4, 0xA8, 0x75, 0x39,
+    0x51, 0xCC, 0xC9, 0x06, 0x29, 0xE6, 0x5D, 0xD5, 0x97, 0x13, 0xC5, 0x9A, 0xA9, 0xA5, 0x91, 0x02,
+    0xA4, 0xFC, 0x6A, 0xC9, 0x43, 0xA3, 0x00, 0x87, 0x62, 0x94, 0x4D, 0x5B, 0x0E, 0xE8, 0xB3, 0x47,
+    0x12, 0xD2, 0x0E, 0x7C, 0x13, 0xDD, 0xA0, 0x4A, 0x89, 0x23, 0x91, 0x95, 0xAE, 0xB5, 0x7D, 0x35,
+    0x9A, 0x31, 0x8F, 0xC5, 0x8C, 0x63, 0xC5, 0x7A, 0xDB, 0x37, 0xA3, 0x91, 0xA6, 0x2D, 0xDB, 0x3E,
+    0xD2, 0x49, 0xBE, 0x5E, 0xEA, 0xA9, 0x5A, 0x32, 0xE5, 0xEA, 0xBB, 0xC1, 0x8D, 0xF5, 0xDC, 0xCC,
+    0xA5, 0xCC, 0x9A, 0xE9, 0xBA, 0x7C, 0x37, 0x2B, 0xD4, 0x3A, 0xB8, 0xC3, 0x29, 0x78, 0x19, 0x22,
+    0xF9, 0x9C, 0xD4, 0x2B, 0xE6, 0x6F, 0x66, 0xA3, 0x68, 0x14, 0x8D, 0xFE, 0xC2, 0x4C, 0x98, 0x70,
+    0xF8, 0xAE, 0x03, 0x75, 0xA0, 0x09, 0x34, 0x13, 0x76, 0x3A, 0x00, 0x55, 0xBB, 0x29, 0x21, 0xB9,
+    0xA5, 0xB6, 0xD8, 0xBA, 0x3B, 0x62, 0x81, 0x9B, 0xE5, 0x01, 0x4E, 0x57, 0xA5, 0xDB, 0xE4, 0x52,
+    0x40, 0x12, 0xB6, 0xAF, 0x07, 0x33, 0xE6, 0xF3, 0x46, 0x52, 0xE3, 0x6D, 0x6F, 0x82, 0x19, 0xAB,
+    0xB9, 0x48, 0x71, 0x8E, 0x95, 0x4E, 0xA2, 0x96, 0x42, 0xA9, 0x27, 0x97, 0x5C, 0x6D, 0xE7, 0xDD,
+    0x58, 0x4F, 0xCD, 0x5C, 0xAE, 0xD5, 0x9A, 0xE9, 0xB2, 0xFA, 0x6E, 0x52, 0xA8, 0x57, 0x1B, 0xCB,
+    0x03, 0x1B, 0xDA, 0xAC, 0x98, 0x05, 0x13, 0x31, 0x91, 0x7A, 0xC6, 0x4E, 0xD8, 0x80, 0x1B, 0x0F,
+    0xE3, 0x66, 0x3F, 0x11, 0x95, 0x7F, 0xC0, 0x43, 0x7D, 0x15, 0xEA, 0x01, 0x77, 0x6E, 0xA0, 0xD2,
+    0xB0, 0x4D, 0xD5, 0xE3, 0xFD, 0xB3, 0x51, 0xAE, 0xB5, 0xC5, 0xA5, 0x90, 0xB3, 0x37, 0x63, 0x39,
+    0x15, 0x33, 0x97, 0x36, 0xA2, 0xAA, 0x60, 0xC6, 0x22, 0x16, 0x73, 0xBE, 0x22, 0xA9, 0xED, 0xD2,
+    0x6C, 0xE5, 0x4B, 0x29, 0x66, 0xBA, 0xA6, 0xD6, 0x0D, 0x75, 0x68, 0xE6, 0x72, 0xA9, 0xD6, 0x4C,
+    0xCF, 0xA9, 0xEF, 0x82, 0xC6, 0x7A, 0xB1, 0xB1, 0xD4, 0xF3, 0xCA, 0x92, 0xE1, 0x78, 0x82, 0x63,
+    0x5F, 0x8C, 0x79, 0xAC, 0x3E, 0x14, 0x8D, 0x3C, 0x2E, 0x90, 0xC7, 0x0D, 0x96, 0xDC, 0x11, 0x85,
+    0xE4, 0x8D, 0x22, 0xBA, 0xD3, 0x9B, 0x09, 0x94, 0xFC, 0x84, 0x74, 0x38, 0x0A, 0x3B, 0x6D, 0x78,
+    0xD3, 0x01, 0x2C, 0x3E, 0x1F, 0xC0, 0xAD, 0xBB, 0x50, 0xF8, 0xDD, 0xB9, 0x3E, 0x0F, 0xE9, 0x06,
+    0xB9, 0x34, 0xD1, 0x48, 0x3E, 0xD3, 0x9D, 0x85, 0x6A, 0x49, 0x0B, 0xD7, 0x92, 0xC3, 0x54, 0xAC,
+    0xBB, 0xBC, 0xE9, 0x5A, 0xB7, 0xC1, 0x4A, 0x3D, 0x8D, 0x92, 0x7D, 0xEB, 0xE1, 0x9C, 0xFC, 0xF6,
+    0x73, 0xB5, 0x16, 0x23, 0xCD, 0x6C, 0x97, 0xDF, 0xD6, 0x1B, 0x4A, 0x11, 0x6E, 0x4D, 0x9D, 0xB4,
+    0x72, 0x5C, 0x87, 0x73, 0xD6, 0x9C, 0x32, 0x73, 0x2D, 0x64, 0xF3, 0x5D, 0x4D, 0x79, 0x58, 0x17,
+    0x72, 0xA9, 0x37, 0x7F, 0xF5, 0x87, 0x9C, 0x4A, 0xE3, 0xA6, 0x58, 0xA0, 0xD0, 0x0D, 0x4A, 0xCD,
+    0x29, 0x41, 0xAB, 0x9E, 0x32, 0x9A, 0xF1, 0x54, 0xAB, 0xE7, 0xD2, 0x4A, 0xBB, 0xE0, 0x24, 0x3E,
+    0xB7, 0x1B, 0xF8, 0xD3, 0x0E, 0x94, 0x75, 0x01, 0x2A, 0x85, 0x64, 0xF2, 0x3F, 0x28, 0x56, 0xF6,
+    0x4F, 0x75, 0x81, 0x4A, 0x1A, 0x70, 0x12, 0xA5, 0xDE, 0x9B, 0x68, 0x26, 0x5A, 0xD4, 0xEE, 0xA0,
+    0xDD, 0x79, 0x97, 0x18, 0xDE, 0xE9, 0xC6, 0x36, 0xC2, 0x9D, 0xD2, 0x88, 0x87, 0xCC, 0x69, 0xF7,
+    0x73, 0x33, 0x9B, 0x1E, 0x37, 0xEA, 0xC3, 0x87, 0xF5, 0x94, 0x52, 0x60, 0x58, 0xD7, 0x24, 0xCD,
+    0x3C, 0xBC, 0x8B, 0xEC, 0x1C, 0xE4, 0x8B, 0x2B, 0xB9, 0x16, 0x12, 0x66, 0x14, 0x0B, 0xDD, 0xE1,
+    0x1C, 0x72, 0x9B, 0x46, 0x33, 0xCB, 0x97, 0x7D, 0x31, 0xA6, 0xC0, 0xAA, 0x1D, 0xC0, 0xAE, 0x2D,
+    0x9D, 0x7A, 0x6A, 0xF5, 0x64, 0x6A, 0x3F, 0x93, 0xAF, 0xC5, 0x0D, 0x33, 0x37, 0xD2, 0x1B, 0x92,
+    0x2A, 0x29, 0x64, 0x17, 0x6F, 0x7F, 0xA2, 0x3D, 0xD8, 0x52, 0xAD, 0xE5, 0xAE, 0x07, 0xAF, 0xEF,
+    0xE0, 0xF3, 0xE9, 0xB8, 0xB4, 0x82, 0xD6, 0x36, 0x25, 0xB6, 0x37, 0x13, 0xF0, 0x6F, 0xC2, 0xA6,
+    0x0F, 0xAA, 0x08, 0x7C, 0xAE, 0xFD, 0xFB, 0x11, 0x72, 0x4D, 0x92, 0x91, 0xC2, 0x71, 0xDD, 0xA6,
+    0xD8, 0x32, 0x37, 0xDD, 0x40, 0x66, 0xFA, 0x64, 0xCE, 0x06, 0x78, 0x09, 0xB2, 0x33, 0xEC, 0xA5,
+    0x58, 0x5E, 0x79, 0x5B, 0xA4, 0xA4, 0xCF, 0x52, 0x3B, 0xFF, 0xA7, 0xBA, 0x1F, 0x45, 0xBD, 0xB8,
+    0xB6, 0x34, 0x52, 0x9B, 0xA7, 0x29, 0xF3, 0xE2, 0x80, 0x1B, 0xB2, 0x84, 0x08, 0x24, 0xCC, 0x7E,
+    0xDC, 0x20, 0xA5, 0x4C, 0xBA, 0x90, 0x52, 0x37, 0x72, 0x69, 0xD9, 0x26, 0x80, 0xE3, 0x8A, 0xBB,
+    0x15, 0x04, 0x6E, 0x3C, 0x45, 0xAE, 0xF3, 0xFA, 0x5F, 0xE7, 0x96, 0x46, 0xD2, 0x4D, 0x6D, 0x69,
+    0xC9, 0xE3, 0xE1, 0x14, 0xFC, 0x50, 0x9F, 0xBF, 0x58, 0x0F, 0x5D, 0x5F, 0x7F, 0x34, 0x53, 0xAB,
+    0xC7, 0xCC, 0x49, 0xCB, 0x7F, 0x96, 0x4F, 0xAA, 0x77, 0xF7, 0xF6, 0xF6, 0xF6, 0xFE, 0xA5, 0x36,
+    0x1F, 0x5A, 0x9D, 0x92, 0x17, 0xAD, 0x29, 0xC5, 0xEC, 0x52, 0x1F, 0xB7, 0x1B, 0xE0, 0x71, 0xCF,
+    0x57, 0xEB, 0x4E, 0x94, 0xED, 0xB8, 0x75, 0x57, 0xB9, 0xEE, 0x96, 0x87, 0x74, 0xE3, 0x7D, 0xEB,
+    0x03, 0xCC, 0x41, 0x78, 0x43, 0xC0, 0x2F, 0x9C, 0x04, 0x1E, 0xD9, 0x41, 0x6D, 0x07, 0x99, 0xC9,
+    0x17, 0x28, 0x26, 0xB2, 0x05, 0xBA, 0x96, 0x7A, 0x40, 0x0A, 0x4E, 0x8B, 0x95, 0xFA, 0xC6, 0x53,
+    0x25, 0xAD, 0xE5, 0x20, 0x7D, 0x28, 0x22, 0x48, 0x58, 0x79, 0xA3, 0x29, 0xD7, 0xCA, 0xF7, 0xC0,
+    0x0E, 0x98, 0x48, 0x7E, 0x11, 0xE4, 0xE9, 0xB6, 0x70, 0x90, 0x19, 0xCB, 0x90, 0x72, 0x48, 0xAB,
+    0xB4, 0x8A, 0xE1, 0x20, 0xEE, 0x7D, 0x6F, 0xEF, 0x1E, 0xDB, 0xDB, 0xDB, 0xDB, 0xB3, 0x3B, 0x26,
+    0xFC, 0xE8, 0x80, 0x2F, 0xED, 0xC7, 0x32, 0xE1, 0xF0, 0xAB, 0x83, 0x25, 0xB3, 0xF7, 0x30, 0xE1,
+    0x80, 0x2F, 0x71, 0x8B, 0x7C, 0x6E, 0x4E, 0x7F, 0xD3, 0xA7, 0x99, 0xA0, 0x98, 0x81, 0x85, 0xBC,
+    0xB5, 0xAD, 0x19, 0xEA, 0xA1, 0x9C, 0x8E, 0xBF, 0x90, 0x2D, 0x40, 0xD7, 0x52, 0xA4, 0xF8, 0xE4,
+    0xB4, 0xA9, 0x88, 0xCD, 0xF9, 0xAE, 0xC2, 0xE6, 0x8E, 0xEF, 0xBE, 0x30, 0x81, 0x2D, 0xC3, 0x5A,
+    0xD0, 0x68, 0xA0, 0x4C, 0x2B, 0x69, 0x7E, 0xE2, 0xCE, 0x4D, 0xE1, 0x17, 0x29, 0x25, 0x2B, 0xFD,
+    0x24, 0x9D, 0x0B, 0xF0, 0x8B, 0x60, 0x06, 0xB2, 0x05, 0xEA, 0x81, 0x6C, 0xA1, 0x90, 0xBC, 0xD3,
+    0x62, 0xA4, 0x31, 0x8F, 0x58, 0xE9, 0x9D, 0xB4, 0xF6, 0x74, 0xDC, 0x65, 0xB6, 0x45, 0xB0, 0xF2,
+    0x85, 0x22, 0x8D, 0x86, 0x6C, 0x4B, 0xC7, 0x3F, 0x96, 0xB5, 0x14, 0xF1, 0x24, 0xD8, 0x5B, 0x03,
+    0xE5, 0xD5, 0x08, 0x2F, 0x77, 0x9E, 0xBC, 0xFF, 0xB8, 0xAC, 0x1C, 0xB3, 0xA4, 0xD0, 0x91, 0xDE,
+    0x5F, 0xA8, 0x56, 0x0D, 0xB8, 0x83, 0xCA, 0x7B, 0x91, 0x6A, 0x71, 0x1E, 0xF7, 0xE6, 0x56, 0xE9,
+    0xDE, 0x8C, 0x94, 0x8B, 0xF3, 0x74, 0xAF, 0x47, 0xCA, 0xD8, 0x79, 0xDC, 0x95, 0x15, 0x13, 0x3B,
+    0x5D, 0xD4, 0xE5, 0x5D, 0xB8, 0xEB, 0xB9, 0x2D, 0x96, 0xB5, 0x26, 0xD0, 0x1E, 0x80, 0x67, 0x0C,
+    0xC5, 0xF2, 0x18, 0xCD, 0xA5, 0xC0, 0xF7, 0xE4, 0xF3, 0xF0, 0xF2, 0x7D, 0x58, 0x01, 0xCD, 0xE5,
+    0x80, 0x33, 0x3E, 0x8F, 0xB6, 0xAD, 0xC2, 0x42, 0x73, 0x79, 0xC2, 0x99, 0xB1, 0x58, 0x9A, 0xDE,
+    0x4C, 0x0E, 0xFB, 0x46, 0x44, 0x4F, 0x2E, 0x66, 0xA9, 0x13, 0xD8, 0x37, 0x38, 0xA9, 0x97, 0x56,
+    0xDC, 0x08, 0xD9, 0x97, 0x5F, 0xC0, 0xA6, 0x35, 0xD9, 0x11, 0xA7, 0x77, 0xFB, 0x1F, 0x97, 0x95,
+    0x3F, 0x20, 0x2D, 0x98, 0xBB, 0x29, 0x7D, 0x7F, 0xA1, 0x5A, 0x8F, 0x52, 0xEA, 0x0E, 0x28, 0x7D,
+    0x33, 0x52, 0x46, 0xE7, 0xE9, 0xAE, 0x44, 0xAA, 0xD8, 0x8D, 0xE8, 0x8A, 0xEE, 0x24, 0x4A, 0x2F,
+    0x4B, 0x9A, 0x9B, 0x2D, 0x7E, 0x37, 0xE6, 0xDB, 0xD2, 0xAC, 0x5D, 0x20, 0x29, 0xDB, 0xA5, 0x7C,
+    0xDD, 0x9F, 0x65, 0xF6, 0xD3, 0x50, 0x9B, 0xCF, 0xF9, 0x44, 0x7D, 0x47, 0x2D, 0x52, 0xA0, 0x52,
+    0x84, 0x87, 0x97, 0x4F, 0x91, 0xDA, 0xEA, 0xF6, 0x53, 0x43, 0xE3, 0x3B, 0x3A, 0xCD, 0x77, 0x7B,
+    0x69, 0x9F, 0x4C, 0xDF, 0xE6, 0x61, 0x53, 0x71, 0xE6, 0xE4, 0x16, 0x48, 0x30, 0x91, 0x94, 0x7C,
+    0xF4, 0xE9, 0x76, 0xB2, 0xE9, 0x13, 0x9A, 0xF3, 0x16, 0xD4, 0x27, 0x93, 0x62, 0x52, 0x0F, 0xF7,
+    0xAD, 0x09, 0x30, 0x3E, 0x8F, 0x96, 0x2A, 0xC4, 0x8D, 0xEC, 0x21, 0x71, 0x61, 0xC5, 0xBE, 0x31,
+    0xA3, 0xA7, 0x42, 0xB1, 0x34, 0xDE, 0x4C, 0xDD, 0xA0, 0x6B, 0x92, 0x9E, 0xD8, 0xDC, 0x66, 0x23,
+    0x8D, 0xD5, 0x9A, 0x92, 0x8A, 0x9B, 0xA1, 0x58, 0x30, 0x53, 0x26, 0xCA, 0x05, 0xE7, 0x73, 0xB5,
+    0x27, 0x5A, 0x3E, 0x2E, 0x8D, 0xB0, 0x50, 0x5B, 0xC8, 0xDB, 0x09, 0x3B, 0x17, 0x6A, 0x73, 0xF5,
+    0x76, 0xA2, 0x39, 0x5A, 0xCD, 0x45, 0xAE, 0xB6, 0x09, 0x34, 0xD3, 0x41, 0xB5, 0x9E, 0x72, 0x91,
+    0xA5, 0x6A, 0xC8, 0x45, 0xA6, 0x64, 0x87, 0x67, 0xEA, 0x0B, 0x51, 0xEB, 0xBD, 0xE4, 0x2F, 0x08,
+    0x23, 0x69, 0xC4, 0x49, 0x91, 0x42, 0x52, 0x9F, 0xAC, 0xB4, 0x8F, 0x77, 0xEB, 0x9C, 0x7F, 0xB0,
+    0x5B, 0x57, 0x04, 0x1C, 0x58, 0xAA, 0xB0, 0xAB, 0xB6, 0x55, 0xA0, 0x98, 0x0E, 0xAB, 0x33, 0x6A,
+    0x69, 0x7A, 0x33, 0x91, 0x47, 0xD4, 0xD2, 0x78, 0x33, 0x91, 0xE9, 0x09, 0xB5, 0xD4, 0x4A, 0x0B,
+    0xEB, 0xD4, 0xA6, 0xE4, 0xCE, 0x64, 0x30, 0xE1, 0xC6, 0x9F, 0x7D, 0xBF, 0x67, 0x71, 0xB3, 0xD3,
+    0xCB, 0x61, 0x9B, 0x8B, 0x0A, 0xB5, 0x07, 0xF0, 0xE7, 0xAE, 0x97, 0xC3, 0x61, 0x2F, 0x2F, 0x34,
+    0x97, 0x67, 0x74, 0xFA, 0x88, 0xAC, 0x2F, 0x99, 0x9E, 0xD4, 0xC5, 0xC5, 0x24, 0x59, 0x1F, 0xAD,
+    0xD4, 0x37, 0x1F, 0x05, 0xB0, 0x7D, 0xB2, 0xB8, 0x7D, 0xC2, 0x94, 0xBA, 0x00, 0xE7, 0x76, 0x8A,
+    0xEC, 0xE4, 0x2E, 0xD0, 0x99, 0x3C, 0x9D, 0x0D, 0xDF, 0x0E, 0x40, 0xCA, 0xCE, 0x86, 0x4B, 0x0F,
+    0x48, 0x85, 0xB8, 0x77, 0x48, 0x40, 0xB5, 0xB8, 0x11, 0x30, 0xB1, 0x4B, 0x87, 0x84, 0x8F, 0xCD,
+    0x36, 0x00, 0xF5, 0x64, 0x27, 0xF6, 0x92, 0x4F, 0x2F, 0x6C, 0xA8, 0x63, 0xAE, 0xD6, 0x8E, 0x26,
+    0x16, 0xF2, 0xDD, 0x60, 0x96, 0x4A, 0x83, 0xF3, 0xD5, 0x6A, 0x14, 0xE4, 0x4B, 0x35, 0x9A, 0xD4,
+    0x97, 0xEA, 0xB4, 0xA8, 0x4D, 0xAB, 0x91, 0x29, 0xA4, 0xEF, 0x4B, 0xE4, 0xD2, 0x65, 0x89, 0x4C,
+    0x7A, 0x4E, 0x2B, 0x48, 0xD9, 0xB6, 0xCA, 0x47, 0x11, 0xB4, 0xE0, 0x22, 0xB8, 0x98, 0x96, 0x73,
+    0x9A, 0x7E, 0x97, 0x37, 0x9F, 0x2C, 0x46, 0x05, 0xA8, 0x26, 0x47, 0x4A, 0x3C, 0xFF, 0x71, 0x4B,
+    0xAB, 0x40, 0xD6, 0x43, 0xF7, 0xCD, 0x09, 0xEC, 0xB5, 0x35, 0x0B, 0x26, 0x58, 0xAF, 0x72, 0x36,
+    0x93, 0x7B, 0x63, 0xC9, 0xD6, 0x2E, 0x0A, 0x2B, 0x39, 0x6F, 0xB6, 0xCE, 0xD3, 0x44, 0x97, 0x1E,
+    0xCF, 0xE1, 0x44, 0xA1, 0x2B, 0xEA, 0x71, 0xA3, 0x06, 0xEA, 0x50, 0x1F, 0xDC, 0xE8, 0xE5, 0x5D,
+    0x9E, 0x88, 0x9D, 0x49, 0xE0, 0xBC, 0xFD, 0xC6, 0x4C, 0x31, 0xFD, 0x2D, 0xCB, 0xBE, 0x9C, 0xC7,
+    0xCC, 0x6A, 0xE9, 0x2E, 0x8B, 0x62, 0x2D, 0x17, 0xEA, 0x60, 0x22, 0xEA, 0xEB, 0xA9, 0x8A, 0xD8,
+    0x60, 0x47, 0xBA, 0xB7, 0x05, 0xBA, 0x7A, 0xF0, 0x54, 0x11, 0x41, 0xA5, 0x69, 0x43, 0xF5, 0x9B,
+    0x65, 0x97, 0x3A, 0x74, 0xB7, 0x45, 0xD0, 0xED, 0x96, 0x4C, 0x54, 0x7A, 0x50, 0xD4, 0xB9, 0xD6,
+    0x48, 0x7D, 0x6D, 0xA5, 0xF1, 0x3F, 0x66, 0x05, 0xAB, 0x09, 0x34, 0xAF, 0xAE, 0x98, 0x60, 0x7D,
+    0x39, 0x95, 0x31, 0x8F, 0xA8, 0x15, 0x75, 0xB0, 0x7D, 0xB1, 0x36, 0x9E, 0xEE, 0x6A, 0xC0, 0x68,
+    0x26, 0x4B, 0xCB, 0xAD, 0xA0, 0x54, 0x52, 0x6A, 0x34, 0x5B, 0x92, 0x60, 0xB1, 0x90, 0xFD, 0xAE,
+    0x20, 0x45, 0xDF, 0x3D, 0x46, 0x9E, 0x62, 0x6D, 0x01, 0x15, 0x33, 0x45, 0xAC, 0x03, 0x75, 0x70,
+    0x1E, 0xF7, 0x86, 0xC8, 0x75, 0x7A, 0xE1, 0xD8, 0xDE, 0x89, 0x33, 0xFF, 0x00, 0xB8, 0x65, 0xD9,
+    0x60, 0x1D, 0x5E, 0xD9, 0x2D, 0xFB, 0xBD, 0x3B, 0xC5, 0xB1, 0xDE, 0xAD, 0x32, 0x88, 0xE5, 0x2E,
+    0x9F, 0x2D, 0x66, 0xDF, 0x95, 0xE6, 0x4D, 0x0A, 0x6B, 0xF9, 0xDD, 0xA2, 0x87, 0x05, 0x4A, 0x4D,
+    0x89, 0xE3, 0x74, 0xF2, 0x64, 0x12, 0x94, 0x8A, 0x1B, 0xF0, 0xD8, 0xE9, 0xC3, 0xBD, 0x56, 0x5B,
+    0x20, 0x32, 0x81, 0x82, 0x41, 0x4A, 0x39, 0xA4, 0x9A, 0x93, 0x58, 0xC5, 0x14, 0x96, 0x2F, 0xC2,
+    0x16, 0x03, 0xBA, 0x57, 0x69, 0x6B, 0x2E, 0x52, 0x2B, 0x62, 0xF2, 0xE0, 0xDC, 0x40, 0xAE, 0x36,
+    0xB9, 0x59, 0x33, 0xB8, 0x31, 0x05, 0x11, 0x04, 0xB5, 0xF6, 0xFB, 0x0D, 0x0C, 0x9C, 0xAC, 0x14,
+    0xE1, 0x2C, 0x5B, 0x86, 0x40, 0xBE, 0xEE, 0x9C, 0x83, 0xC3, 0xE2, 0x53, 0x20, 0xB8, 0x98, 0x53,
+    0xB8, 0xB1, 0x8A, 0x69, 0xAE, 0x36, 0x11, 0x8E, 0x9D, 0xFD, 0x04, 0x09, 0x4E, 0x9D, 0xB9, 0x80,
+    0x7B, 0x72, 0x4A, 0xF6, 0x7A, 0xF2, 0x9E, 0xF3, 0x75, 0xD7, 0xD7, 0x77, 0x6F, 0x3F, 0x37, 0xD2,
+    0xCB, 0x31, 0x9B, 0xF3, 0x58, 0x85, 0xFB, 0x43, 0x27, 0x67, 0x3E, 0xD9, 0x3E, 0xDF, 0xC3, 0x2E,
+    0x46, 0xD7, 0xB4, 0xD4, 0x53, 0xBE, 0xD0, 0xF8, 0x3C, 0xEE, 0x8A, 0x5D, 0xE6, 0x94, 0x1D, 0x0E,
+    0x8A, 0xB1, 0x58, 0xB1, 0x03, 0x27, 0xD2, 0x82, 0xF2, 0x1E, 0xE7, 0xD3, 0xF3, 0x06, 0x8E, 0x3C,
+    0x08, 0x87, 0x3A, 0x85, 0x61, 0x34, 0x62, 0xD5, 0x9B, 0x9B, 0x6B, 0x31, 0xA7, 0xE1, 0x72, 0x2C,
+    0x7B, 0x22, 0x9E, 0xEC, 0x6E, 0xBD, 0x79, 0x35, 0xBE, 0xDC, 0xFD, 0x8F, 0xAF, 0xBF, 0x70, 0x6C,
+    0x5F, 0x85, 0x34, 0x77, 0xD2, 0xFF, 0xDC, 0xFF, 0xF6, 0x59, 0x38, 0xF1, 0xE5, 0x56, 0xE9, 0xF9,
+    0x43, 0x7A, 0x7B, 0x7F, 0xFF, 0xDB, 0x7B, 0xCD, 0x0F, 0x9B, 0xA7, 0x82, 0x79, 0x55, 0x0A, 0x8D,
+    0x42, 0xE6, 0x06, 0x8E, 0xB5, 0xDD, 0x73, 0x6B, 0x4A, 0x43, 0xB2, 0xE7, 0x67, 0x7B, 0x39, 0xDA,
+    0xCB, 0xB1, 0xBB, 0x12, 0xBB, 0x2B, 0xF1, 0x94, 0x19, 0xFF, 0xF9, 0x63, 0x8F, 0x01, 0x3C, 0x5B,
+    0xAA, 0x79, 0xDA, 0x05, 0xF5, 0x2F, 0xEE, 0x6C, 0x08, 0x51, 0x44, 0x9C, 0xCF, 0x0E, 0x6D, 0x08,
+    0x7B, 0xA8, 0xE3, 0x8A, 0x39, 0x8F, 0xE6, 0xE6, 0x8A, 0x55, 0x8F, 0xD2, 0xBA, 0xB3, 0xBA, 0xE5,
+    0x04, 0x9C, 0xA5, 0x58, 0xA8, 0x26, 0xCC, 0x4C, 0x33, 0x62, 0x43, 0x22, 0x74, 0xF7, 0x1C, 0x86,
+    0xAF, 0xBE, 0xE0, 0x26, 0x1B, 0x6C, 0x68, 0xA6, 0x7A, 0x36, 0xD1, 0x2C, 0x95, 0x2A, 0x7D, 0x51,
+    0xDE, 0x8D, 0xCD, 0x64, 0x62, 0xA1, 0x5C, 0xBD, 0x86, 0x47, 0x5E, 0xA0, 0x9B, 0xCD, 0x9A, 0xAB,
+    0xEF, 0x46, 0x13, 0x0B, 0xE1, 0xC6, 0x3A, 0xE6, 0xFB, 0x64, 0xED, 0x33, 0xE7, 0xDE, 0x5C, 0xDC,
+    0xF0, 0x4C, 0x39, 0x9C, 0xAD, 0xFC, 0xA5, 0x3F, 0x5D, 0xDC, 0x9B, 0xFE, 0x65, 0xDC, 0x4B, 0x67,
+    0x9C, 0xA2, 0x53, 0x24, 0xDB, 0xBD, 0x89, 0x80, 0xE9, 0x5F, 0x29, 0x87, 0x68, 0x2F, 0x87, 0xDF,
+    0x04, 0x6A, 0xFB, 0xF2, 0x25, 0x5B, 0x93, 0xB5, 0x96, 0xD8, 0xAC, 0xEE, 0x8E, 0x46, 0x77, 0x47,
+    0xEF, 0xE9, 0x7C, 0x30, 0xFE, 0x04, 0x05, 0xFF, 0xAC, 0xBB, 0xF9, 0x1F, 0x0B, 0x38, 0xF6, 0x55,
+    0xE7, 0xAD, 0xF4, 0x45, 0x49, 0x0F, 0xED, 0x7F, 0xFB, 0x6C, 0x3D, 0xB8, 0xF3, 0xAB, 0x89, 0x36,
+    0xEC, 0xB5, 0xF7, 0x70, 0xED, 0x2E, 0x6E, 0xD5, 0x6B, 0xBD, 0x98, 0x68, 0x62, 0x3D, 0xDB, 0x60,
+    0x83, 0x1B, 0xBF, 0xDA, 0xDF, 0xFD, 0xB8, 0x20, 0xCE, 0x14, 0xC1, 0xDC, 0x95, 0x15, 0x46, 0xFD,
+    0xFD, 0xBF, 0x59, 0xDC, 0xB9, 0xB7, 0x7E, 0xB4, 0xA8, 0xB5, 0x9A, 0xA4, 0xEB, 0xD2, 0xE9, 0x6B,
+    0x8B, 0x2D, 0xA6, 0x68, 0x06, 0xDB, 0x17, 0xD1, 0x4C, 0x75, 0x28, 0x56, 0xF9, 0xB4, 0x2A, 0x77,
+    0xCB, 0x75, 0x28, 0x87, 0xC3, 0xA4, 0x50, 0x13, 0xD2, 0xF4, 0xA8, 0x95, 0x62, 0x55, 0x6F, 0xA6,
+    0x3A, 0xD8, 0x3E, 0x2D, 0x42, 0xAD, 0x86, 0x49, 0xD7, 0xDF, 0xD1, 0xD5, 0xEF, 0x9C, 0x5B, 0x9E,
+    0xB1, 0x61, 0x6A, 0x5A, 0xA0, 0x94, 0x9E, 0x90, 0x7E, 0xB0, 0xEE, 0xBF, 0xC8, 0xDE, 0x7E, 0x25,
+    0x5D, 0x96, 0x6E, 0xEB, 0xCE, 0x4B, 0xF7, 0x9D, 0xDA, 0x49, 0x57, 0x12, 0x3E, 0xE7, 0xB1, 0x26,
+    0xBC, 0x2C, 0xFB, 0x7C, 0x0F, 0x14, 0xD1, 0x28, 0x58, 0x1D, 0x3E, 0x6D, 0xEA, 0xDD, 0xFD, 0xFD,
+    0x47, 0xF6, 0xFF, 0x4C, 0xB2, 0xBA, 0x35, 0xDA, 0x53, 0xC5, 0x2D, 0xC9, 0xEA, 0x96, 0xD4, 0x5C,
+    0xAA, 0xF5, 0xDE, 0xB9, 0x4B, 0xDF, 0xBF, 0x7A, 0xF3, 0x56, 0x7C, 0x3A, 0xC0, 0x6F, 0xFE, 0x96,
+    0x19, 0x4B, 0x5F, 0x0D, 0x5F, 0x98, 0x7E, 0xFD, 0xD7, 0xEF, 0x11, 0x61, 0xBE, 0x50, 0xBD, 0x1D,
+    0xBB, 0xE6, 0x8F, 0x76, 0x36, 0x7C, 0xD3, 0x62, 0xE1, 0xD9, 0xB4, 0x20, 0xF3, 0x63, 0x32, 0x0C,
+    0xCF, 0xCF, 0xF6, 0xFC, 0x9C, 0x3A, 0xC0, 0xBD, 0x1E, 0x81, 0xC4, 0x38, 0x25, 0xC6, 0x5D, 0x0F,
+    0xB6, 0xBD, 0xA7, 0x03, 0x37, 0x30, 0x04, 0xA7, 0x58, 0x24, 0x2B, 0x32, 0xEC, 0x01, 0x27, 0xB2,
+    0x33, 0xD1, 0x5C, 0x09, 0xB6, 0x7E, 0x35, 0x76, 0xE5, 0x07, 0xB1, 0x7E, 0x3D, 0x74, 0xCD, 0x6B,
+    0xF1, 0x0F, 0xF6, 0x1A, 0xBD, 0xA9, 0xBF, 0xD1, 0x82, 0x6B, 0x9B, 0xB1, 0x9A, 0x01, 0xFE, 0x35,
+    0x7C, 0x0D, 0x67, 0x83, 0xD3, 0xCB, 0x56, 0xEF, 0x9B, 0xAB, 0xBA, 0x1C, 0x34, 0xC6, 0x2E, 0xF0,
+    0x68, 0x8B, 0x69, 0x29, 0x3D, 0x79, 0x80, 0x09, 0x9E, 0x86, 0x06, 0x4C, 0x4F, 0xE1, 0xC9, 0xFB,
+    0xFB, 0x9E, 0x75, 0x91, 0x00, 0xDC, 0x6C, 0x7B, 0x38, 0x16, 0x90, 0xBD, 0xF4, 0x60, 0x1A, 0x8F,
+    0x9D, 0xCD, 0x35, 0xE3, 0x7E, 0x20, 0xCD, 0xA5, 0xAC, 0xF4, 0xA1, 0xFE, 0x5A, 0x4F, 0x4A, 0x8B,
+    0x9B, 0x2A, 0xE9, 0xBC, 0xFE, 0xD3, 0x53, 0xBA, 0x40, 0x96, 0x1E, 0x2F, 0xE2, 0x77, 0x19, 0xB6,
+    0xD9, 0x19, 0xB0, 0xB1, 0x7A, 0x5B, 0xB1, 0xB9, 0x7A, 0x2B, 0x3A, 0x7B, 0x5E, 0x53, 0x57, 0xC8,
+    0x93, 0xBD, 0xC8, 0x59, 0x30, 0xCA, 0x67, 0xA7, 0xA7, 0x6E, 0xCD, 0xCE, 0x3D, 0x3F, 0xBA, 0x78,
+    0xBC, 0xEF, 0x0E, 0xB1, 0xE4, 0xF2, 0x89, 0x0B, 0xD5, 0x07, 0x91, 0x7F, 0xB2, 0x3D, 0x9E, 0xE3,
+    0xB3, 0xE6, 0x8B, 0xFE, 0xBF, 0x00, 0x64, 0x55, 0x0F, 0x3C, 0xD6, 0x01, 0xCD, 0xAB, 0x6B, 0xCB,
+    0xB9, 0x50, 0x48, 0x9A, 0x39, 0xAE, 0xC3, 0x98, 0xDA, 0xC3, 0xBA, 0x0D, 0x8D, 0xA4, 0xD6, 0xDC,
+    0xD9, 0xFB, 0xDD, 0xB5, 0x98, 0xA0, 0x98, 0x5F, 0x06, 0xCA, 0x57, 0xEF, 0x79, 0xE2, 0x47, 0xBE,
+    0x73, 0xD4, 0xD2, 0xC3, 0x1B, 0xA6, 0x46, 0x92, 0x34, 0x3B, 0x25, 0x44, 0xEA, 0x10, 0x69, 0xFF,
+    0xAD, 0xBB, 0x56, 0x53, 0xAB, 0x4D, 0xA0, 0x8D, 0x89, 0xF0, 0x20, 0x3F, 0xEB, 0xC4, 0xDE, 0x8B,
+    0x75, 0x7A, 0xC6, 0xDC, 0x54, 0x4B, 0xA1, 0x19, 0xD3, 0x03, 0x99, 0x0E, 0xF6, 0x3B, 0xFB, 0x34,
+    0x5B, 0x72, 0x9E, 0x95, 0xB0, 0xDB, 0x12, 0x12, 0x3B, 0x80, 0xFD, 0xE1, 0xDE, 0x99, 0x4D, 0x89,
+    0xCF, 0xDB, 0x1E, 0x77, 0x73, 0xDA, 0x67, 0x78, 0x58, 0x5A, 0x91, 0x92, 0x03, 0xAC, 0xD8, 0x25,
+    0x10, 0x2A, 0x3D, 0x5E, 0xA5, 0xDF, 0x41, 0x6E, 0x89, 0xF3, 0xDB, 0xC3, 0x57, 0x16, 0xA8, 0xB7,
+    0xE0, 0xE6, 0x4A, 0x26, 0xDF, 0x0D, 0x74, 0x3E, 0xE5, 0xE5, 0x8A, 0x72, 0xA6, 0xF1, 0xD9, 0x4A,
+    0x15, 0xE8, 0xFA, 0x72, 0xA6, 0x1E, 0xED, 0x4A, 0x19, 0x8D, 0xC8, 0x54, 0xA8, 0xE5, 0xAB, 0xFD,
+    0x4B, 0xC9, 0xBD, 0x36, 0x1E, 0x9E, 0xDD, 0xF2, 0x39, 0xFC, 0x7D, 0xA9, 0x6D, 0xBB, 0x25, 0x3A,
+    0x8A, 0xDD, 0x5F, 0xED, 0x7D, 0x69, 0xB7, 0x44, 0xE7, 0x48, 0x92, 0xFF, 0x2E, 0x95, 0xE8, 0x9E,
+    0xCC, 0xA2, 0x6D, 0x36, 0x5B, 0xD2, 0xE4, 0xF6, 0xD5, 0x0B, 0xF0, 0xFF, 0x01, 0xC5, 0xBC, 0x4D,
+    0xAC, 0x1E, 0xD7, 0x99, 0xE7, 0xF7, 0xAB, 0x3A, 0x4D, 0x55, 0xC7, 0x95, 0xE9, 0xE3, 0x85, 0xD5,
+    0xE8, 0xB1, 0xC6, 0xAE, 0x09, 0xD0, 0x8B, 0x19, 0xB5, 0xED, 0xCA, 0x22, 0x8B, 0x46, 0x20, 0xF1,
+    0x94, 0x2C, 0xF4, 0x28, 0x88, 0x02, 0x90, 0x48, 0x74, 0xDB, 0x41, 0x7B, 0x61, 0x67, 0x37, 0x76,
+    0x3E, 0x98, 0x45, 0x23, 0x70, 0x10, 0x5A, 0x55, 0x92, 0x16, 0x5E, 0x68, 0x61, 0x22, 0xE8, 0x99,
+    0x45, 0x06, 0x88, 0xB4, 0x70, 0x63, 0xDA, 0x54, 0x00, 0x0E, 0x30, 0x5E, 0x38, 0x09, 0xA5, 0x3A,
+    0x22, 0x81, 0x30, 0x09, 0x81, 0x61, 0x59, 0x1C, 0x8F, 0x03, 0x18, 0x0D, 0x95, 0x45, 0x75, 0xFC,
+    0x85, 0x80, 0x47, 0xE4, 0xA1, 0x54, 0x24, 0x4F, 0xD5, 0x3F, 0x8B, 0x53, 0xF7, 0xF2, 0x52, 0xAD,
+    0x96, 0xDB, 0x8D, 0x34, 0x52, 0xB7, 0xCE, 0xA9, 0xAA, 0xB7, 0xDE, 0xFB, 0xD6, 0xF9, 0x7C, 0xCE,
+    0xF3, 0xFC, 0x9F, 0xFF, 0x53, 0x00, 0xD0, 0x6E, 0x50, 0x4B, 0x03, 0x92, 0x7C, 0xBD, 0x15, 0x1A,
+    0xFA, 0x09, 0x7D, 0x71, 0xA3, 0xD8, 0x6C, 0xC0, 0xA4, 0x7E, 0x80, 0x42, 0x92, 0xAF, 0x25, 0xD1,
+    0x4A, 0x89, 0x71, 0x80, 0x42, 0x40, 0xA5, 0xAE, 0xD2, 0x29, 0x49, 0xAB, 0x93, 0x14, 0x7A, 0x49,
+    0xC3, 0x28, 0x25, 0x46, 0xC9, 0xF3, 0x7B, 0x7A, 0x97, 0xBC, 0x7D, 0x42, 0xEF, 0x52, 0x4A, 0x91,
+    0x56, 0xF2, 0x85, 0xEE, 0xAD, 0xD4, 0x2B, 0x9F, 0xC4, 0x4D, 0x80, 0x00, 0xB3, 0x01, 0xB5, 0x3A,
+    0x68, 0x74, 0x17, 0x9C, 0x34, 0xD0, 0x4A, 0x13, 0xB5, 0xE4, 0xE1, 0x8C, 0xFC, 0x7E, 0xBB, 0xDE,
+    0xCC, 0x4C, 0xBB, 0xB8, 0xF5, 0x1F, 0xE9, 0x2D, 0x49, 0x6A, 0x24, 0xC5, 0x5E, 0xDA, 0x78, 0x44,
+    0x5B, 0x97, 0x1F, 0xA6, 0x97, 0x97, 0xF1, 0xE5, 0x65, 0xFC, 0xD6, 0xD2, 0xEF, 0x7B, 0xEA, 0xAF,
+    0xA4, 0xFE, 0x6A, 0x1A, 0xAF, 0x26, 0xBD, 0xBD, 0x6A, 0x72, 0x4F, 0xDF, 0x59, 0x9B, 0x1F, 0x2D,
+    0xFD, 0x85, 0x5B, 0x1A, 0x5F, 0x5E, 0x78, 0xB0, 0xD9, 0x85, 0x76, 0x66, 0x1C, 0xCA, 0x8D, 0x7A,
+    0xA1, 0x99, 0xE9, 0x87, 0x62, 0xA3, 0x3A, 0x3C, 0x15, 0x55, 0xA2, 0x09, 0xF4, 0xBE, 0x14, 0x75,
+    0xA2, 0x0D, 0x68, 0x32, 0xEA, 0xEC, 0x9A, 0xFF, 0x17, 0x37, 0x51, 0xA8, 0xA3, 0x4A, 0xD0, 0x04,
+    0x18, 0x3D, 0xA5, 0xA0, 0x4E, 0xE0, 0x66, 0xD0, 0x80, 0x59, 0xC1, 0xC6, 0xFD, 0x8B, 0x50, 0x25,
+    0x68, 0xF7, 0x2F, 0x6E, 0xFB, 0x4F, 0xCC, 0x27, 0x9F, 0xD1, 0x53, 0x52, 0xAA, 0xA4, 0xD0, 0x4A,
+    0x48, 0xB1, 0xB8, 0xB0, 0xE5, 0xF2, 0x15, 0x52, 0x02, 0x7A, 0x09, 0x68, 0x25, 0x0F, 0x55, 0x34,
+    0x01, 0x8A, 0x44, 0x02, 0x7A, 0x1C, 0xD0, 0x78, 0xEB, 0xA1, 0x0A, 0x26, 0x40, 0xB1, 0x20, 0x0D,
+    0xBC, 0x81, 0xD3, 0x46, 0x3B, 0x58, 0x69, 0xAA, 0x67, 0x13, 0xAB, 0x54, 0x2E, 0xAC, 0x8C, 0xAC,
+    0xB8, 0xAE, 0x99, 0x5C, 0x67, 0x27, 0x1B, 0xEC, 0x64, 0xEE, 0x5D, 0x48, 0x8F, 0x45, 0xA4, 0xCD,
+    0x26, 0x9C, 0x64, 0x84, 0xD5, 0xDD, 0x42, 0xC7, 0x9A, 0x08, 0xD7, 0xE5, 0xBC, 0x0C, 0xBF, 0x32,
+    0x97, 0x12, 0x38, 0x49, 0x5B, 0xE7, 0x24, 0x69, 0x76, 0x83, 0x91, 0x16, 0xD7, 0x99, 0x58, 0x25,
+    0xD7, 0x99, 0x58, 0xAE, 0xAE, 0x33, 0xB1, 0x58, 0x8F, 0xCE, 0xEF, 0x5D, 0x48, 0xAE, 0xDB, 0xBF,
+    0x23, 0x05, 0xD7, 0x19, 0x6D, 0xDD, 0xE3, 0xB9, 0x53, 0x25, 0x45, 0x2B, 0x49, 0xDD, 0xB1, 0xD3,
+    0xED, 0x35, 0xBD, 0x16, 0x73, 0xF3, 0x62, 0x04, 0xE0, 0xC2, 0x87, 0x4F, 0xC7, 0x05, 0x9C, 0x14,
+    0x30, 0x92, 0x3A, 0xDC, 0x5A, 0x25, 0x8C, 0x68, 0x3C, 0x2E, 0x90, 0xA8, 0x36, 0xEC, 0x44, 0x3F,
+    0xB3, 0x52, 0x6D, 0x34, 0x33, 0xFD, 0x5C, 0x6C, 0x54, 0xA2, 0x99, 0xE9, 0x43, 0x29, 0x2A, 0xD1,
+    0x06, 0xF8, 0x26, 0x60, 0x02, 0xD0, 0x0C, 0xC0, 0x0A, 0x54, 0xE1, 0x58, 0xBB, 0x94, 0xAB, 0x11,
+    0x36, 0xB6, 0x0B, 0xCE, 0xCB, 0xA3, 0x7A, 0xC5, 0xA4, 0x7E, 0xA6, 0xB9, 0x2D, 0xE8, 0x5F, 0x59,
+    0x28, 0x36, 0x79, 0x6A, 0xAD, 0xD0, 0x6A, 0x06, 0x09, 0x8C, 0x22, 0x58, 0xCD, 0xE0, 0x34, 0x53,
+    0x48, 0x81, 0x4A, 0x0A, 0x34, 0xB7, 0x15, 0x18, 0xAF, 0x28, 0x96, 0xAA, 0x14, 0x6D, 0xAA, 0xB5,
+    0xB8, 0x50, 0x6B, 0xA9, 0x16, 0xF2, 0xC8, 0xA2, 0x9F, 0xA0, 0xD0, 0x00, 0x1C, 0xF0, 0x31, 0x9B,
+    0x0D, 0x80, 0x28, 0x65, 0x03, 0x2E, 0xAA, 0xAB, 0xF5, 0x6C, 0x44, 0x71, 0xEC, 0x1A, 0xBD, 0x1C,
+    0x8D, 0x96, 0x71, 0xE8, 0xF5, 0xAD, 0xC5, 0x2A, 0xF5, 0x2F, 0x6C, 0xBA, 0x92, 0xDC, 0xDB, 0xA9,
+    0xBF, 0x92, 0x74, 0x25, 0xE9, 0x54, 0x72, 0x6F, 0x07, 0x5D, 0xD6, 0x66, 0x57, 0x27, 0xAF, 0xEB,
+    0x5A, 0xEC, 0xEA, 0xD4, 0xE9, 0x86, 0x42, 0xB3, 0xB9, 0xB5, 0xD0, 0x0D, 0xF9, 0x46, 0xA4, 0x22,
+    0xE1, 0xEE, 0x6F, 0x58, 0x09, 0xA4, 0x8E, 0x7A, 0xFB, 0xE8, 0x82, 0x94, 0x89, 0x2A, 0xF4, 0x83,
+    0x49, 0x36, 0xB0, 0x95, 0x62, 0xEC, 0xDC, 0xE4, 0x7C, 0x9D, 0xEC, 0x8C, 0xBE, 0x15, 0x69, 0x6F,
+    0x27, 0x8C, 0x36, 0x18, 0xD5, 0x61, 0xE5, 0x29, 0x35, 0x83, 0x8B, 0x79, 0xF2, 0x14, 0x1B, 0xA0,
+    0x0E, 0xE4, 0x71, 0x9A, 0xB1, 0x0A, 0xB9, 0xE9, 0x34, 0xC3, 0xA3, 0xFB, 0x13, 0xC6, 0xAE, 0xD8,
+    0xFE, 0xC6, 0x49, 0x3A, 0x4A, 0xBD, 0xB4, 0x52, 0xCF, 0x3C, 0x94, 0x4E, 0x9C, 0xA6, 0x38, 0x0D,
+    0xF5, 0x92, 0xE7, 0x6C, 0xB5, 0x42, 0xB5, 0x7D, 0x5C, 0xC3, 0xB7, 0xEF, 0x52, 0x29, 0xE1, 0x7E,
+    0x99, 0xCC, 0x52, 0xC6, 0xE6, 0x07, 0x5F, 0x0A, 0xA3, 0x74, 0x59, 0xD2, 0x29, 0x69, 0x75, 0x7F,
+    0xDA, 0xB1, 0x81, 0x59, 0xA1, 0xD6, 0xE9, 0xFF, 0xD2, 0x4A, 0xB1, 0x91, 0xA6, 0x46, 0xE2, 0x13,
+    0x3A, 0x47, 0xEB, 0x01, 0xE7, 0xE1, 0x44, 0xBF, 0x42, 0xAF, 0x15, 0x7A, 0xFD, 0x0C, 0x70, 0x03,
+    0xE0, 0x5E, 0xC9, 0xC3, 0xB9, 0xA3, 0x97, 0x3C, 0xFD, 0xBB, 0x67, 0x3C, 0xBD, 0xB7, 0x13, 0xFD,
+    0x50, 0xCF, 0x8C, 0xDD, 0x43, 0x99, 0x3A, 0x1B, 0xF6, 0x6C, 0xB0, 0x11, 0x0D, 0x4D, 0x42, 0x6F,
+    0x8E, 0x09, 0x5D, 0x52, 0x02, 0xA3, 0x00, 0x46, 0x03, 0x94, 0x59, 0x0C, 0x56, 0x13, 0x26, 0x50,
+    0x24, 0x58, 0xA1, 0xDF, 0x45, 0xCE, 0x3A, 0x4A, 0x67, 0xA4, 0x5F, 0x2E, 0x94, 0x1B, 0x8C, 0x03,
+    0xED, 0x4C, 0x9D, 0x28, 0x05, 0xA3, 0xA7, 0x0D, 0xC7, 0x2F, 0xE2, 0x51, 0x0B, 0x54, 0x5B, 0x67,
+    0xB4, 0xB1, 0x99, 0xD8, 0x0C, 0xF6, 0x52, 0xE0, 0x53, 0x4E, 0xD1, 0x48, 0x9D, 0xCB, 0xB3, 0xC8,
+    0xFD, 0xEB, 0x33, 0x6F, 0x49, 0xC9, 0x4A, 0xBE, 0x57, 0x60, 0x3C, 0x12, 0xC3, 0xC5, 0x78, 0x97,
+    0x56, 0x0B, 0xEB, 0x1F, 0x7A, 0x33, 0x83, 0xF5, 0xE0, 0x26, 0x70, 0x5B, 0x47, 0xAF, 0x81, 0x46,
+    0x03, 0x85, 0xBA, 0x4F, 0x96, 0x9B, 0x79, 0xD7, 0x2E, 0xAD, 0xF4, 0x96, 0xA4, 0x5A, 0x0A, 0xC5,
+    0x85, 0xBB, 0x59, 0x3E, 0x5D, 0x4E, 0xFD, 0xD5, 0x75, 0xFC, 0xE1, 0x01, 0x40, 0xB9, 0xB4, 0x2F,
+    0x2E, 0xED, 0x8B, 0x8B, 0x7B, 0x69, 0x71, 0x2F, 0x2D, 0xEE, 0x72, 0x72, 0x97, 0x93, 0x9B, 0xDA,
+    0x17, 0xF7, 0xD3, 0xFE, 0x4A, 0xEA, 0xAF, 0xA4, 0x07, 0xBD, 0xF6, 0xC6, 0xB1, 0x7D, 0x7B, 0x78,
+    0xD7, 0xF1, 0xBD, 0xA3, 0x19, 0xCA, 0x05, 0xE7, 0xCD, 0xB1, 0x7F, 0xE6, 0xF1, 0xC1, 0x2C, 0xB8,
+    0xC1, 0x2C, 0xB8, 0xCE, 0xC4, 0x3D, 0xC3, 0x84, 0xC3, 0xAC, 0x0A, 0x8C, 0xD8, 0xB9, 0xDD, 0x4A,
+    0x4D, 0x2E, 0x19, 0x75, 0x80, 0xC9, 0x22, 0xD2, 0x63, 0xA6, 0x8B, 0xF0, 0x44, 0x35, 0x60, 0xFC,
+    0x59, 0x78, 0xA2, 0xD2, 0xB9, 0xCA, 0xF7, 0xEA, 0xCE, 0x56, 0x6F, 0xA6, 0xCA, 0x9F, 0xAD, 0xFD,
+    0xD9, 0xCA, 0x5F, 0xAC, 0x87, 0x6F, 0x9E, 0x79, 0x73, 0xA9, 0x14, 0xDD, 0xD0, 0xAF, 0xE6, 0x48,
+    0xF8, 0x7C, 0x12, 0x58, 0x8A, 0x81, 0xA5, 0x9C, 0x8E, 0x52, 0x32, 0x33, 0x92, 0xCE, 0x49, 0x4A,
+    0x4B, 0x39, 0xBF, 0xBE, 0x94, 0xF3, 0xC9, 0x9C, 0xFE, 0xEF, 0x6D, 0x31, 0x4A, 0x8B, 0xD1, 0xBC,
+    0x00, 0x79, 0xB0, 0x09, 0xF8, 0x92, 0x26, 0x9A, 0x3C, 0xAC, 0x7E, 0x06, 0x6C, 0x80, 0xB9, 0xAB,
+    0x01, 0x2B, 0x4D, 0xF4, 0x92, 0x2F, 0x74, 0x6E, 0xA4, 0x4A, 0xAC, 0x34, 0x73, 0xB9, 0x30, 0x76,
+    0xF5, 0x5C, 0xAE, 0xB4, 0x43, 0x1D, 0x79, 0x03, 0x37, 0x99, 0x84, 0x3A, 0x1B, 0xCC, 0x86, 0xF3,
+    0x76, 0x29, 0x84, 0x0B, 0x75, 0x42, 0xBE, 0x0D, 0x54, 0x13, 0x38, 0x28, 0x16, 0xB0, 0xD3, 0x3E,
+    0xAE, 0x00, 0x30, 0xA1, 0x1F, 0x9A, 0xCB, 0x89, 0xE7, 0x5B, 0x5F, 0xDE, 0xDD, 0xA8, 0x6F, 0x06,
+    0x9C, 0x40, 0x11, 0xA3, 0x01, 0x2B, 0xE8, 0xD5, 0x15, 0xD2, 0x50, 0xDF, 0xD6, 0xD0, 0x5E, 0x96,
+    0x97, 0xD1, 0x54, 0x9C, 0xCE, 0x72, 0xCD, 0xC6, 0xBC, 0x62, 0xDA, 0xF4, 0x61, 0x59, 0xB3, 0xE0,
+    0xAE, 0x06, 0xA3, 0xD6, 0x37, 0x69, 0x44, 0xB7, 0x92, 0xD5, 0xD5, 0xD0, 0xAB, 0xBD, 0xBC, 0xA6,
+    0xB1, 0xFD, 0xD1, 0xAD, 0x55, 0xCD, 0x55, 0x85, 0xFE, 0x8C, 0x5E, 0x5C, 0xC7, 0x54, 0xBF, 0xAF,
+    0xA9, 0xFD, 0xF1, 0xC6, 0x78, 0x26, 0x94, 0xEB, 0xD1, 0x2F, 0xF4, 0xBC, 0x41, 0x23, 0x75, 0x46,
+    0xF2, 0xF4, 0xF2, 0x94, 0x87, 0xAA, 0xC5, 0x47, 0x6D, 0xCE, 0x33, 0x56, 0x0B, 0xCE, 0x8B, 0x66,
+    0x6A, 0x42, 0x1D, 0xCC, 0x6A, 0x12, 0xBD, 0xDF, 0xB0, 0xCB, 0x48, 0x21, 0x97, 0xA5, 0x56, 0xA5,
+    0x00, 0x4A, 0xD0, 0x6C, 0xFB, 0x02, 0x35, 0x7A, 0x68, 0x66, 0xB0, 0x91, 0x13, 0x67, 0x12, 0x46,
+    0x6B, 0x5E, 0x16, 0x9C, 0xC0, 0xDE, 0x05, 0x4E, 0x72, 0xD2, 0xE1, 0x3E, 0x6E, 0x97, 0xF2, 0xCE,
+    0x49, 0xF6, 0xFD, 0x51, 0xF8, 0x3A, 0x50, 0xE7, 0x05, 0x78, 0x32, 0xD2, 0x8A, 0x93, 0x26, 0xEA,
+    0x00, 0x8C, 0x40, 0x1D, 0x81, 0xF1, 0xDE, 0x39, 0x6A, 0x69, 0x62, 0x94, 0xA8, 0x53, 0xB9, 0x30,
+    0x0E, 0xD6, 0xD7, 0x0B, 0x89, 0xFE, 0x87, 0x67, 0x7C, 0x25, 0x25, 0x9C, 0xE4, 0x8D, 0xB4, 0x60,
+    0xA5, 0x8E, 0x56, 0xE7, 0x72, 0x7D, 0x0F, 0xF6, 0x61, 0x53, 0x07, 0x28, 0x53, 0xFE, 0x51, 0x2B,
+    0xCD, 0x46, 0x5A, 0xF8, 0xD2, 0xFA, 0x5C, 0x96, 0xD5, 0x2E, 0xFF, 0xDF, 0x64, 0xF4, 0xDA, 0xCA,
+    0x38, 0xB4, 0x43, 0x3B, 0x9B, 0x50, 0x2F, 0x65, 0x2A, 0x25, 0xD1, 0x4B, 0x43, 0x93, 0xFF, 0x27,
+    0xD0, 0x2A, 0x1E, 0x6B, 0xCE, 0x46, 0x92, 0xBA, 0x5E, 0xD2, 0x5A, 0x48, 0x52, 0xAC, 0x24, 0x69,
+    0xAE, 0xD5, 0xB5, 0x1B, 0xB5, 0x0A, 0x4D, 0xD4, 0xB2, 0x2B, 0xD4, 0x9B, 0x26, 0xF2, 0x8A, 0x4A,
+    0xAF, 0x05, 0x6A, 0x69, 0x85, 0xFE, 0xE6, 0xFD, 0x84, 0x49, 0xEE, 0x6A, 0xA4, 0x9D, 0x64, 0x03,
+    0x32, 0xA9, 0x9D, 0xAA, 0x64, 0x43, 0xEF, 0xDB, 0xD9, 0x79, 0xA1, 0x4E, 0x66, 0xAB, 0x52, 0x95,
+    0xEA, 0xE4, 0x42, 0x1B, 0x9A, 0xF8, 0x89, 0xF3, 0xE7, 0xFF, 0xCC, 0xEC, 0x9A, 0xC5, 0x64, 0x83,
+    0x9B, 0xD9, 0xDA, 0x09, 0x7B, 0x73, 0xA2, 0xCC, 0x6A, 0x03, 0xE5, 0x07, 0x1F, 0x84, 0x62, 0x49,
+    0xAF, 0x73, 0xD1, 0xD9, 0xC1, 0xD9, 0xCB, 0xA1, 0x79, 0x29, 0xBC, 0x6E, 0xE7, 0xD4, 0x78, 0x7E,
+    0xEF, 0x5C, 0x15, 0x0B, 0x25, 0x93, 0x8C, 0x64, 0x52, 0x25, 0x5D, 0x49, 0x75, 0x1A, 0x95, 0xEC,
+    0xD2, 0x6A, 0xB1, 0xA9, 0x56, 0xA8, 0xB6, 0x51, 0x03, 0x4E, 0x0B, 0x85, 0x24, 0x8C, 0x24, 0x6F,
+    0xF5, 0x94, 0x66, 0x9B, 0x70, 0xA1, 0x8D, 0xB4, 0xD1, 0x05, 0x9A, 0xE8, 0x02, 0x76, 0x71, 0x33,
+    0x76, 0xC9, 0x67, 0x81, 0x66, 0x71, 0x0B, 0x6E, 0x69, 0xF5, 0x4F, 0x15, 0x1B, 0x49, 0xC1, 0x4A,
+    0x9A, 0x2B, 0x49, 0xBE, 0x90, 0x04, 0xBD, 0x12, 0x3C, 0xB2, 0xF7, 0x4C, 0xB1, 0x15, 0x4B, 0xA5,
+    0x37, 0x93, 0xD5, 0x9D, 0x64, 0xAF, 0x6B, 0xB1, 0xD3, 0x18, 0x6B, 0x69, 0x2A, 0xB4, 0x51, 0x49,
+    0xDE, 0xC6, 0x76, 0x6E, 0x27, 0x1B, 0x9C, 0xAF, 0xA2, 0x1B, 0xCC, 0x72, 0x94, 0x7C, 0x15, 0xDD,
+    0xDC, 0xC4, 0x36, 0x3F, 0x60, 0xAE, 0x25, 0x5F, 0x4A, 0x70, 0xE6, 0x78, 0xBF, 0x14, 0x09, 0x0E,
+    0x67, 0x9B, 0x5B, 0x00, 0xC6, 0xA8, 0x81, 0x42, 0xAF, 0xF6, 0x9E, 0x72, 0xC3, 0x4D, 0x98, 0x15,
+    0x17, 0x76, 0xCD, 0xD8, 0x2E, 0xD8, 0x85, 0x26, 0x62, 0x13, 0x2E, 0x50, 0xAF, 0xF4, 0x33, 0x95,
+    0xD0, 0x84, 0x51, 0x21, 0x4F, 0xA9, 0x17, 0xE5, 0x29, 0x74, 0x59, 0x1D, 0xE8, 0xC7, 0x02, 0x46,
+    0x89, 0x7D, 0xC5, 0xC3, 0x29, 0x01, 0xAD, 0x12, 0xD0, 0x28, 0x02, 0x56, 0xE1, 0x28, 0xAF, 0x34,
+    0x3F, 0x28, 0xD9, 0x3F, 0xDE, 0xD7, 0xCB, 0x3A, 0x3A, 0x8A, 0xA5, 0x8C, 0xB4, 0x5D, 0xE3, 0x4D,
+    0x20, 0xF1, 0x06, 0x76, 0xB6, 0x13, 0x7D, 0x91, 0x30, 0xD1, 0x79, 0xDC, 0x95, 0x48, 0x99, 0xB4,
+    0xFF, 0x8A, 0x36, 0xA8, 0xE5, 0xA1, 0x4F, 0xFB, 0x32, 0xD8, 0x46, 0xA0, 0x7C, 0x95, 0xC6, 0xD3,
+    0x7F, 0xE2, 0x7C, 0x72, 0x0A, 0x92, 0xA7, 0xA7, 0x48, 0x54, 0x01, 0x8A, 0xD3, 0xD0, 0x78, 0xE8,
+    0x1B, 0x29, 0xF5, 0xD2, 0x7B, 0x92, 0xAE, 0xAC, 0x07, 0x07, 0xCD, 0x0C, 0xFD, 0x70, 0xA4, 0xD2,
+    0x7F, 0x48, 0xF7, 0x6F, 0x8F, 0x5D, 0xAE, 0xF9, 0x19, 0xE3, 0x44, 0xA9, 0x8E, 0x47, 0xBE, 0x7B,
+    0xA4, 0xA8, 0xCD, 0x98, 0x05, 0xB6, 0x5E, 0xBA, 0x20, 0xFD, 0x52, 0xBA, 0xF7, 0x60, 0xA9, 0x5D,
+    0x3E, 0x7A, 0xA9, 0x0D, 0xD4, 0xEB, 0xA1, 0x55, 0x20, 0xDF, 0x48, 0x29, 0x9F, 0xDC, 0x39, 0x78,
+    0xAE, 0xD8, 0x76, 0x3D, 0xD1, 0x49, 0x32, 0x92, 0x82, 0x93, 0xB2, 0x16, 0x5B, 0x0A, 0x3E, 0xEA,
+    0x24, 0x42, 0xA9, 0xEE, 0xD8, 0xC9, 0x89, 0xD3, 0x60, 0x95, 0xAC, 0x56, 0xFB, 0xC3, 0xE7, 0xAC,
+    0x47, 0x5A, 0xA4, 0xC5, 0x7A, 0xF6, 0x7D, 0x7A, 0x68, 0x07, 0x70, 0x52, 0x74, 0xD2, 0xE2, 0xA4,
+    0xA5, 0x99, 0xA0, 0x99, 0xB2, 0x78, 0x3B, 0x9E, 0x5A, 0x6D, 0x5D, 0x2B, 0xCD, 0xAD, 0x14, 0xDB,
+    0xA5, 0x4E, 0x6D, 0x28, 0xD7, 0x76, 0x62, 0x7B, 0x90, 0xCA, 0xB5, 0x9D, 0xDC, 0xDA, 0xCE, 0x2E,
+    0xB5, 0xB3, 0x0B, 0x9F, 0x7E, 0xF5, 0xF1, 0x0E, 0xAC, 0x3A, 0xC5, 0xDA, 0x73, 0x91, 0xDA, 0x33,
+    0xAE, 0xB5, 0xE2, 0xEB, 0xF6, 0xAA, 0x7F, 0x62, 0x31, 0xD7, 0xDE, 0xBC, 0x98, 0xDC, 0xB7, 0x2F,
+    0xCF, 0x00, 0xF2, 0xBD, 0xFC, 0x38, 0xD3, 0x2E, 0x8D, 0x66, 0x17, 0x30, 0x32, 0x5A, 0x5C, 0x84,
+    0x7E, 0xD6, 0xDA, 0x2C, 0x50, 0xAF, 0x4E, 0xA7, 0x12, 0xA0, 0x6B, 0xBA, 0xB2, 0x02, 0xCD, 0xFB,
+    0xBA, 0xAD, 0x6C, 0x22, 0x6C, 0xEA, 0xB2, 0x61, 0xA5, 0x01, 0xA8, 0x25, 0xF9, 0xDD, 0xE8, 0x98,
+    0x76, 0x99, 0x14, 0xC8, 0x37, 0x12, 0xC7, 0xBE, 0x60, 0x25, 0xAD, 0xFB, 0x51, 0x13, 0x58, 0x5D,
+    0x5B, 0xC7, 0x15, 0x1A, 0x5D, 0xD7, 0x29, 0xCD, 0x34, 0x9A, 0x34, 0x69, 0xA3, 0xD1, 0xEC, 0xA2,
+    0x55, 0x68, 0x15, 0xEC, 0x5A, 0x48, 0x87, 0xCB, 0xDF, 0xDE, 0xFB, 0x87, 0x2B, 0x98, 0x3B, 0x1C,
+    0x0D, 0xFE, 0xC1, 0x12, 0xB9, 0xB8, 0xC5, 0x0D, 0x55, 0xD0, 0x3B, 0x89, 0xFA, 0x86, 0x4E, 0x4D,
+    0xD8, 0x1F, 0xAF, 0x23, 0xB4, 0x37, 0x3F, 0x08, 0xBB, 0x9D, 0x9C, 0x85, 0x00, 0xD2, 0x04, 0xF9,
+    0xB7, 0xAD, 0xB6, 0x5C, 0x78, 0x68, 0xEE, 0x4B, 0x14, 0xBA, 0x76, 0x43, 0x34, 0xC9, 0x7D, 0x4B,
+    0xA5, 0xFC, 0x56, 0x0B, 0xC0, 0x4C, 0x00, 0xB6, 0x03, 0xF8, 0x1C, 0x8F, 0x8C, 0xE7, 0x2A, 0xA9,
+    0x90, 0xC2, 0xA3, 0xE5, 0x0A, 0x6E, 0xC0, 0x4E, 0xD4, 0xA1, 0x56, 0x2C, 0x15, 0x18, 0xD5, 0x51,
+    0x47, 0xD8, 0xC0, 0xFD, 0xEF, 0x34, 0xB7, 0x7F, 0x7E, 0x66, 0x91, 0x36, 0x27, 0x59, 0x89, 0xF1,
+    0x2E, 0x65, 0x82, 0x11, 0x5A, 0xCF, 0x23, 0xAF, 0xF2, 0xD8, 0x62, 0xF5, 0x26, 0xDF, 0xE3, 0xB3,
+    0x34, 0x5F, 0xD4, 0x30, 0x06, 0x9E, 0xA7, 0xBE, 0xF6, 0xCF, 0x6E, 0xEB, 0xAE, 0x52, 0xBB, 0x94,
+    0x13, 0x1B, 0x7D, 0xF8, 0x8D, 0xB3, 0x46, 0x85, 0xBA, 0xAF, 0x61, 0x56, 0x23, 0x4C, 0xAA, 0x57,
+    0x4C, 0x6A, 0x12, 0x26, 0xB9, 0x40, 0x95, 0xFA, 0x99, 0x6A, 0x91, 0xA7, 0xBE, 0xA7, 0x8E, 0xFA,
+    0xFE, 0x06, 0x56, 0x09, 0xAC, 0x96, 0x7D, 0xEA, 0xDA, 0xDC, 0xDA, 0x13, 0x34, 0x5A, 0xA0, 0xD1,
+    0xB6, 0x1B, 0xC4, 0xED, 0x07, 0x0A, 0xB8, 0xF7, 0x94, 0x70, 0x61, 0x54, 0xE7, 0x42, 0xAB, 0x5F,
+    0xB8, 0x60, 0x73, 0x93, 0xBB, 0x87, 0xB3, 0xC7, 0xEB, 0x69, 0xA5, 0x3D, 0x35, 0x73, 0xB1, 0xC7,
+    0xDC, 0x5E, 0xB0, 0x6F, 0x7B, 0xDC, 0x0A, 0x0A, 0x18, 0x41, 0xB3, 0x40, 0x1F, 0x29, 0xB5, 0x50,
+    0xDF, 0x5C, 0x70, 0x5F, 0x59, 0x58, 0xDB, 0xC5, 0x44, 0x27, 0xE0, 0x09, 0x20, 0x40, 0x39, 0x54,
+    0x01, 0x46, 0x5F, 0x24, 0xE8, 0x27, 0x7A, 0x70, 0x81, 0xD6, 0xE3, 0x02, 0x75, 0xA0, 0x5D, 0x30,
+    0xE9, 0x62, 0x93, 0x40, 0xAD, 0x5D, 0xC1, 0x5D, 0xBD, 0x2A, 0xB0, 0xB7, 0xEF, 0x0B, 0x4C, 0x1E,
+    0x6B, 0x79, 0x20, 0xF5, 0x52, 0x82, 0xE6, 0x03, 0xC9, 0x53, 0xA5, 0xA4, 0x44, 0x29, 0x67, 0xE5,
+    0x19, 0xFF, 0xCF, 0x41, 0x89, 0x76, 0xA6, 0x91, 0xB7, 0x0B, 0x85, 0x92, 0xD9, 0xA0, 0x95, 0x3F,
+    0xE8, 0x28, 0x0E, 0x9E, 0x03, 0xA8, 0x3D, 0x7F, 0x56, 0x06, 0x36, 0x2E, 0xD2, 0xE3, 0x70, 0x9D,
+    0xFD, 0x57, 0xCE, 0x9B, 0x0F, 0x2E, 0x78, 0xA4, 0x19, 0xA7, 0x80, 0xBD, 0x29, 0xAA, 0x5F, 0x5E,
+    0x08, 0xC5, 0xBD, 0x1B, 0xE2, 0x79, 0x5C, 0x68, 0x87, 0x4A, 0xF5, 0xCC, 0x38, 0xD7, 0xD1, 0x26,
+    0xDC, 0x34, 0xCE, 0xB5, 0x6E, 0x8B, 0xC7, 0xB6, 0x33, 0x11, 0xFB, 0x9E, 0x06, 0xFA, 0x6B, 0x89,
+    0x62, 0xEB, 0x67, 0xAA, 0xFB, 0x22, 0xAF, 0xCF, 0xA3, 0x86, 0xAC, 0xAD, 0x5A, 0x4D, 0xE0, 0x72,
+    0xD9, 0x07, 0x2A, 0xC9, 0xD3, 0x48, 0x9E, 0xFE, 0x9A, 0x7C, 0xA9, 0x46, 0x53, 0x9D, 0x1A, 0x4D,
+    0x2E, 0xB4, 0x9A, 0xE5, 0x5B, 0xCD, 0x88, 0xFC, 0xAD, 0x5E, 0x29, 0x9F, 0xB0, 0x92, 0x35, 0x41,
+    0x56, 0xB2, 0x40, 0x2D, 0x92, 0x9B, 0x68, 0xAE, 0x2E, 0x14, 0x5B, 0xAE, 0x1E, 0xA5, 0x02, 0xB4,
+    0x2B, 0x94, 0x8A, 0xE0, 0x34, 0x61, 0xA4, 0x01, 0xF7, 0xF6, 0x86, 0x49, 0xE3, 0x82, 0xBB, 0xA4,
+    0x60, 0x92, 0x95, 0x97, 0xA2, 0x4D, 0x46, 0x9A, 0xC6, 0xD9, 0x4A, 0x46, 0x60, 0x52, 0x1B, 0xC1,
+    0xBE, 0x27, 0x0F, 0xFD, 0xB5, 0x44, 0xAE, 0x09, 0xF5, 0xFD, 0x8C, 0x9A, 0x44, 0x72, 0x65, 0x72,
+    0x6D, 0x72, 0x75, 0x72, 0x7D, 0x90, 0x86, 0xBD, 0xAC, 0xB9, 0x4A, 0xF4, 0xD7, 0xE4, 0x29, 0xD5,
+    0x68, 0xA2, 0x4E, 0x8D, 0x26, 0x5C, 0x68, 0x35, 0x23, 0xDF, 0x6A, 0x56, 0x6A, 0xBD, 0x92, 0xEB,
+    0x48, 0x23, 0xA4, 0x15, 0xEE, 0x2D, 0x14, 0x0A, 0x14, 0x9A, 0xC8, 0xEB, 0x5B, 0x47, 0xA9, 0x09,
+    0xA3, 0x88, 0xB9, 0xBF, 0x62, 0x6E, 0xA9, 0x33, 0x41, 0xB3, 0x09, 0x6E, 0x71, 0x13, 0x6D, 0xF8,
+    0xC8, 0x6C, 0x3E, 0x96, 0xB9, 0x0F, 0x67, 0xFD, 0x21, 0xC6, 0x16, 0x3F, 0x9C, 0xDD, 0x39, 0xE8,
+    0x63, 0x1F, 0x70, 0xB1, 0x0F, 0xB8, 0xBB, 0x7D, 0xC0, 0x69, 0xCC, 0xCA, 0x74, 0xD6, 0xF9, 0xF6,
+    0xEC, 0x79, 0xDA, 0x67, 0xE6, 0x32, 0xF6, 0xB8, 0x67, 0x82, 0x39, 0x76, 0xF8, 0x56, 0x30, 0xCB,
+    0x78, 0x7E, 0x7C, 0x59, 0x5A, 0x46, 0xE9, 0x65, 0x69, 0x19, 0x71, 0x57, 0x83, 0x59, 0x47, 0xDC,
+    0x0C, 0x5F, 0x80, 0x72, 0xEE, 0x3D, 0x4E, 0xBA, 0x2B, 0x90, 0xF4, 0xD3, 0x84, 0x91, 0xF4, 0x4A,
+    0xC0, 0x46, 0xE8, 0x3D, 0x6E, 0xA6, 0x14, 0x68, 0xA0, 0x4E, 0x98, 0x8D, 0x5D, 0x05, 0x60, 0xDC,
+    0x6F, 0x75, 0x68, 0xA0, 0x5E, 0xA9, 0x04, 0xED, 0xDD, 0x83, 0x33, 0x09, 0x46, 0x49, 0x81, 0x52,
+    0x92, 0x7C, 0x96, 0xA0, 0x79, 0xC1, 0x4A, 0x19, 0xEC, 0x09, 0x18, 0x0D, 0xA5, 0x3C, 0x76, 0xA3,
+    0x16, 0xB8, 0x85, 0x36, 0x81, 0x66, 0xC6, 0x00, 0x8E, 0x46, 0xE9, 0x30, 0xF3, 0xE4, 0xAC, 0xFB,
+    0x50, 0xD6, 0x7A, 0x9C, 0xF4, 0x50, 0xF6, 0x8B, 0xD1, 0xE3, 0x86, 0xF6, 0x41, 0x36, 0x31, 0x4A,
+    0x6B, 0x16, 0xE1, 0x33, 0x48, 0xDA, 0x1E, 0x5C, 0x50, 0x6F, 0x60, 0x03, 0x63, 0x00, 0x51, 0xEB,
+    0xD8, 0x85, 0xCD, 0x17, 0x92, 0x3A, 0x61, 0x25, 0xE5, 0x8B, 0x45, 0x9D, 0xD5, 0xD4, 0xBF, 0x1D,
+    0x51, 0x28, 0x36, 0x75, 0x56, 0x58, 0x45, 0x34, 0x33, 0xAA, 0xB3, 0x1B, 0xB5, 0x22, 0x9A, 0x0B,
+    0xA9, 0xB3, 0x32, 0xBA, 0x19, 0x51, 0x70, 0x29, 0x5F, 0xFC, 0x87, 0xDF, 0xE1, 0xFC, 0xAB, 0x8F,
+    0x77, 0x8F, 0x9F, 0x3F, 0xFF, 0x9D, 0xBC, 0x98, 0x1E, 0xE5, 0xBE, 0x59, 0x7E, 0xCD, 0x5C, 0x1B,
+    0xCE, 0x37, 0xD2, 0xE4, 0x7C, 0x23, 0x45, 0x68, 0xD6, 0xC7, 0x12, 0xB4, 0xA1, 0x5C, 0xA1, 0x9D,
+    0xD9, 0xA0, 0x9D, 0x8E, 0xE7, 0xC5, 0x06, 0xED, 0xE4, 0x56, 0x68, 0x67, 0x97, 0xA0, 0x9D, 0x5D,
+    0x84, 0x36, 0xB8, 0x73, 0x0F, 0x1B, 0x3B, 0x5F, 0xEF, 0x80, 0x42, 0x13, 0x50, 0x2A, 0xB6, 0x2B,
+    0xA5, 0xD6, 0x51, 0x73, 0xA1, 0x7B, 0xD2, 0x8A, 0x26, 0x37, 0xF5, 0x43, 0xEF, 0x9D, 0xAF, 0x42,
+    0x3B, 0xD9, 0xB9, 0x48, 0x36, 0x54, 0x11, 0x99, 0x54, 0x26, 0xFA, 0xE1, 0x10, 0xF7, 0x69, 0xA6,
+    0x36, 0xD8, 0x58, 0xA5, 0xF6, 0x4E, 0x29, 0x34, 0xCA, 0xF7, 0x4B, 0x2B, 0x2D, 0x56, 0x92, 0x84,
+    0xA4, 0x8C, 0x86, 0x64, 0xA1, 0xA1, 0xAD, 0x83, 0xDF, 0x3E, 0x77, 0x64, 0x80, 0x35, 0x1E, 0x90,
+    0x7F, 0x0E, 0xA3, 0xAB, 0x1A, 0xAC, 0xA4, 0xA9, 0x89, 0x6F, 0x54, 0xC1, 0xF9, 0x64, 0x82, 0x2B,
+    0xA2, 0x09, 0x7D, 0x19, 0xCC, 0xFC, 0x7C, 0x19, 0xED, 0xD4, 0x97, 0xB1, 0xF1, 0x7D, 0x99, 0xFA,
+    0x73, 0xEE, 0x85, 0x4D, 0xC1, 0xCD, 0xD2, 0xD2, 0x48, 0x4A, 0xB5, 0xA4, 0x50, 0x48, 0x5B, 0xC7,
+    0x89, 0xD3, 0x87, 0xBF, 0xFC, 0x88, 0xEE, 0x52, 0x49, 0x73, 0x29, 0xAD, 0x8C, 0x92, 0x6F, 0x75,
+    0x2F, 0x19, 0x4D, 0x30, 0x86, 0xAC, 0xF9, 0x16, 0x1A, 0xA0, 0x5D, 0xC0, 0xA8, 0xCB, 0xF8, 0x54,
+    0x3E, 0x49, 0x60, 0x34, 0x41, 0xAB, 0x73, 0xBF, 0xFD, 0xA6, 0x32, 0xAE, 0x21, 0x3F, 0x4A, 0x69,
+    0x57, 0xF6, 0x77, 0x6B, 0x0A, 0x4D, 0xF0, 0x89, 0xD7, 0x01, 0xF9, 0x1D, 0x9D, 0x03, 0xEA, 0x8D,
+    0x56, 0x53, 0xA3, 0x68, 0xEF, 0xFC, 0x4E, 0x1D, 0x30, 0x29, 0x2F, 0xB4, 0x03, 0x76, 0xC6, 0x24,
+    0xD0, 0x40, 0x7B, 0xF7, 0x8F, 0x8D, 0xD4, 0xF5, 0x8A, 0x7F, 0x57, 0xEF, 0x56, 0x1B, 0xA5, 0xE0,
+    0x6B, 0x79, 0x9E, 0x7C, 0x20, 0x49, 0x6F, 0x4B, 0x52, 0x2F, 0x69, 0x3D, 0xF8, 0xD2, 0x76, 0x70,
+    0x1A, 0x1B, 0x61, 0x47, 0xD7, 0xBB, 0x8C, 0x34, 0x61, 0x17, 0x76, 0xA0, 0x54, 0xC3, 0x0E, 0xB8,
+    0x3F, 0xFC, 0x51, 0xB5, 0x01, 0x4D, 0x02, 0xFA, 0x3B, 0x50, 0x28, 0x91, 0x6D, 0xD6, 0xAC, 0x8E,
+    0xB8, 0xAC, 0xA8, 0xF4, 0xD2, 0x8F, 0xA4, 0xB5, 0x97, 0xA6, 0x22, 0x42, 0x33, 0x50, 0x2E, 0xD0,
+    0x7E, 0xE4, 0x21, 0xA3, 0xDA, 0x2E, 0x66, 0x2D, 0x23, 0x92, 0x4D, 0x5E, 0xBB, 0xA8, 0xA3, 0xBF,
+    0x2C, 0xCC, 0x56, 0xAD, 0x34, 0xC1, 0x26, 0x34, 0x34, 0xB1, 0x4E, 0x59, 0xCA, 0xF5, 0xEF, 0x08,
+    0x74, 0x2D, 0x51, 0x28, 0x0B, 0x7D, 0xA8, 0x33, 0x4C, 0xEA, 0xF3, 0x82, 0x90, 0x61, 0x5D, 0x79,
+    0xA8, 0x74, 0x54, 0xE0, 0x00, 0x65, 0xF6, 0x11, 0xEC, 0x96, 0x10, 0xED, 0x8D, 0x84, 0xEA, 0x68,
+    0x52, 0x33, 0xB7, 0x93, 0xF3, 0x62, 0x7C, 0x66, 0x29, 0xB6, 0x76, 0x32, 0x49, 0xD4, 0x5A, 0x68,
+    0x34, 0xE1, 0x04, 0xE3, 0x02, 0xF2, 0x18, 0xE5, 0x1E, 0x76, 0xE1, 0xF8, 0xE5, 0x51, 0x71, 0x2F,
+    0x09, 0xB3, 0x99, 0x95, 0x36, 0xD4, 0x09, 0x0D, 0xCD, 0xF2, 0x70, 0x71, 0x6F, 0x2E, 0x14, 0x92,
+    0xC7, 0x68, 0xA3, 0x56, 0x46, 0xEE, 0xE5, 0xC7, 0x2C, 0xD2, 0x02, 0x14, 0x0F, 0x17, 0x77, 0x3C,
+    0x5E, 0xDC, 0x47, 0x3B, 0x0E, 0xAA, 0x85, 0xB1, 0x13, 0xCE, 0xB7, 0x53, 0x33, 0x57, 0xA9, 0x8E,
+    0xC8, 0x24, 0xDA, 0x1F, 0x6C, 0x54, 0x69, 0xEC, 0x50, 0xEF, 0x69, 0x35, 0x67, 0xBC, 0x6E, 0x87,
+    0x10, 0x1A, 0x49, 0x57, 0x94, 0x6D, 0x90, 0x84, 0x4D, 0x3B, 0xA6, 0x20, 0x0F, 0xED, 0x8C, 0x8D,
+    0x94, 0x5B, 0x21, 0x0A, 0xE1, 0x42, 0x21, 0xCC, 0x86, 0x06, 0xC6, 0x59, 0x1E, 0xBB, 0x6A, 0xA2,
+    0x90, 0x66, 0x68, 0x33, 0xFE, 0x17, 0x81, 0x7E, 0x01, 0xEC, 0x76, 0xB8, 0x20, 0xD6, 0xB9, 0xF7,
+    0x35, 0x60, 0xA4, 0x48, 0xA9, 0x6B, 0xA2, 0xD0, 0x4F, 0x34, 0xA3, 0xE0, 0x56, 0xC6, 0x58, 0xC9,
+    0xF7, 0xA9, 0xD0, 0xE2, 0x12, 0xBD, 0xBA, 0x7D, 0x56, 0x56, 0xE1, 0xC8, 0x4E, 0xFC, 0x87, 0xD0,
+    0x76, 0xD5, 0xE4, 0x70, 0xF4, 0x26, 0xB0, 0xB6, 0x43, 0xB1, 0xA6, 0x7D, 0x3D, 0xCC, 0x10, 0x84,
+    0x0B, 0x94, 0x9A, 0x68, 0xE4, 0x91, 0xF3, 0x75, 0x1C, 0x87, 0x7E, 0x90, 0x49, 0x95, 0xA0, 0x01,
+    0xCE, 0xF2, 0xE8, 0xC1, 0x41, 0x47, 0x21, 0xE9, 0x72, 0xAC, 0x24, 0xD9, 0xA9, 0x91, 0x92, 0xEB,
+    0x68, 0x66, 0x56, 0xE8, 0x07, 0x13, 0x29, 0x36, 0xEC, 0x44, 0xB5, 0xF0, 0xEB, 0x7C, 0x2C, 0x69,
+    0xA5, 0x91, 0x14, 0xE9, 0x25, 0x4D, 0x85, 0x24, 0x75, 0xE5, 0xF9, 0xF3, 0xAF, 0xAD, 0x00, 0x55,
+    0x84, 0x6C, 0xBC, 0x40, 0xDF, 0x01, 0xC5, 0xFA, 0xE8, 0xC1, 0x69, 0x1A, 0xA5, 0xB3, 0x95, 0xD4,
+    0x60, 0x42, 0xE5, 0x49, 0x45, 0xC0, 0x71, 0x16, 0xEB, 0x3F, 0xFC, 0xC1, 0x0F, 0xCF, 0x9C, 0x36,
+    0xD2, 0x8A, 0xA4, 0xCE, 0x49, 0x13, 0x94, 0x11, 0x78, 0x1D, 0x68, 0x3B, 0x80, 0x71, 0xA8, 0x97,
+    0x76, 0x2E, 0xB7, 0x6A, 0x61, 0x7C, 0x61, 0xA3, 0x9D, 0xFB, 0xAE, 0x5A, 0xEC, 0x54, 0x6C, 0x26,
+    0xD2, 0x0F, 0x2B, 0xED, 0xE4, 0x06, 0x1B, 0xEB, 0xD8, 0xAC, 0x85, 0xA4, 0xAE, 0x95, 0xA6, 0x42,
+    0x37, 0xE3, 0x3E, 0x8B, 0xC7, 0x0E, 0xDA, 0x29, 0xB7, 0x60, 0xB1, 0x9D, 0xCB, 0x1D, 0xD7, 0x6C,
+    0x50, 0x69, 0x00, 0x3B, 0x83, 0x59, 0x80, 0xED, 0xF5, 0x32, 0xE6, 0xFD, 0x6C, 0x11, 0xCF, 0x16,
+    0xF1, 0x6C, 0x19, 0x4F, 0x56, 0xB1, 0x55, 0xB4, 0x8A, 0x94, 0x87, 0x7B, 0x11, 0xC9, 0x63, 0x04,
+    0x07, 0x0E, 0x1E, 0x3F, 0x41, 0xF1, 0xD4, 0xC2, 0xEB, 0x6D, 0x57, 0xBF, 0x15, 0x58, 0x5B, 0xEC,
+    0xF5, 0xC0, 0x76, 0xF2, 0xA4, 0xBD, 0x71, 0x63, 0xDE, 0xDC, 0xC9, 0xF6, 0xC6, 0xFD, 0x9F, 0x6E,
+    0x4E, 0xFA, 0x89, 0xB4, 0xD5, 0xBA, 0x3F, 0x37, 0xCB, 0xF3, 0x9C, 0xAC, 0x82, 0x99, 0x7B, 0x4E,
+    0xD6, 0x01, 0x46, 0xA8, 0xC3, 0xEF, 0x16, 0xCF, 0x0C, 0x67, 0xFF, 0xB8, 0xBA, 0xD2, 0x9D, 0xFD,
+    0x97, 0x57, 0xAE, 0x3E, 0x71, 0xF1, 0x7F, 0x7D, 0xFB, 0x8A, 0x92, 0xBB, 0xEF, 0xBF, 0xF9, 0x84,
+    0xB9, 0xEC, 0xFF, 0xC1, 0x13, 0x18, 0xFF, 0x38, 0x14, 0x6B, 0x6E, 0xE6, 0x66, 0x82, 0xBE, 0xCB,
+    0x97, 0x4B, 0x36, 0x10, 0xFB, 0x81, 0x52, 0x8A, 0xB5, 0xB4, 0xB4, 0x52, 0x1C, 0xE7, 0xE6, 0x1D,
+    0xD1, 0x5E, 0x8D, 0xF4, 0xED, 0x54, 0xA4, 0xB1, 0xAB, 0x6F, 0xAD, 0xB4, 0x57, 0x23, 0xE3, 0x99,
+    0xB9, 0x5C, 0xC7, 0xC1, 0xDE, 0x3D, 0xCF, 0xE3, 0xE7, 0xEA, 0xB0, 0x43, 0x82, 0x21, 0x37, 0xC1,
+    0x51, 0xFA, 0xE9, 0x86, 0xCD, 0x6B, 0x49, 0x68, 0xEE, 0xD6, 0xA1, 0x09, 0x26, 0x36, 0x73, 0xB9,
+    0xB4, 0xD3, 0x83, 0xE4, 0x26, 0x93, 0xDC, 0x64, 0x92, 0x9B, 0x4D, 0x72, 0x73, 0x95, 0x5C, 0xA8,
+    0x93, 0x0B, 0xF5, 0x31, 0x50, 0xB1, 0xC8, 0x5E, 0xCC, 0x46, 0x1B, 0xD9, 0x46, 0xF4, 0x80, 0xA6,
+    0x7E, 0xCA, 0x7E, 0xC0, 0xD0, 0x7B, 0xB3, 0x9E, 0xF8, 0x72, 0xEC, 0x25, 0x65, 0xEB, 0x57, 0x52,
+    0x6A, 0xF3, 0xA1, 0x38, 0x7F, 0x41, 0xDA, 0xBE, 0xB3, 0xE3, 0x79, 0xBB, 0xC4, 0x3D, 0xC2, 0x2C,
+    0x6B, 0x75, 0xFC, 0x3D, 0xA8, 0x74, 0xF7, 0x1F, 0xA5, 0x6C, 0x11, 0xA4, 0x6C, 0xCE, 0xEF, 0x5E,
+    0xBE, 0x8C, 0x7D, 0x28, 0x02, 0xC5, 0x78, 0x0F, 0x28, 0xB6, 0xEE, 0xD0, 0x61, 0xF4, 0x6F, 0x16,
+    0xC7, 0x1B, 0x5C, 0x74, 0xE7, 0x77, 0xDF, 0xEB, 0x56, 0x4B, 0x12, 0xC5, 0x7A, 0xFA, 0x70, 0x0A,
+    0xAA, 0x7B, 0x04, 0xA4, 0x0D, 0x9C, 0xB6, 0xBD, 0xFC, 0xC5, 0x78, 0x0C, 0x37, 0x29, 0xC6, 0x77,
+    0xC9, 0xC6, 0xEB, 0x6E, 0xBE, 0xE7, 0x8A, 0xB5, 0xC1, 0x4D, 0x85, 0xA8, 0xA2, 0x9B, 0xCC, 0x76,
+    0xE2, 0x4B, 0x87, 0x35, 0xDA, 0x0F, 0x8D, 0x24, 0x69, 0xFD, 0x4B, 0x15, 0xDB, 0x6B, 0x94, 0x21,
+    0x89, 0x4A, 0x03, 0xFF, 0x36, 0x18, 0xAD, 0x7F, 0x90, 0xA0, 0xDC, 0x6B, 0xB4, 0x1F, 0xB2, 0x5F,
+    0x10, 0x2B, 0x65, 0x14, 0x29, 0x63, 0xAB, 0xBB, 0xCD, 0xFB, 0x11, 0x87, 0x62, 0xEB, 0xC0, 0x68,
+    0x01, 0xB3, 0x9E, 0x19, 0x52, 0xB9, 0x94, 0xC1, 0x9D, 0x97, 0x56, 0x2B, 0x49, 0x2F, 0x64, 0x55,
+    0xB1, 0xBE, 0xD3, 0x1D, 0x56, 0xBB, 0x9F, 0x8A, 0x01, 0xAB, 0x9B, 0x33, 0x85, 0x8E, 0x6C, 0x43,
+    0xC6, 0xBB, 0x47, 0x26, 0x6F, 0x04, 0x78, 0xF2, 0x57, 0xBB, 0x89, 0x39, 0x86, 0x07, 0x3F, 0x9F,
+    0x07, 0xC2, 0x85, 0x08, 0x60, 0x76, 0x74, 0xA0, 0x52, 0xAE, 0x6D, 0xB9, 0x0D, 0xFC, 0x4D, 0xB7,
+    0x7A, 0x35, 0x9A, 0x5D, 0xC4, 0x26, 0xAB, 0x17, 0x34, 0xD0, 0x2E, 0x6E, 0xCD, 0xEB, 0xD0, 0x18,
+    0xC7, 0x19, 0xFA, 0x77, 0x74, 0x59, 0xC0, 0xF8, 0x23, 0xB5, 0x11, 0xD0, 0xDB, 0x49, 0x03, 0x14,
+    0x1A, 0x95, 0x72, 0x51, 0x34, 0xED, 0xC7, 0x1D, 0x98, 0x08, 0x7B, 0x9F, 0x0E, 0xB9, 0x53, 0xB7,
+    0x5C, 0xD2, 0x7C, 0xBB, 0xCF, 0xC7, 0x3C, 0x54, 0xB2, 0x06, 0xAE, 0x8E, 0x5A, 0x3F, 0x95, 0x53,
+    0x87, 0xD4, 0xA6, 0x5E, 0x83, 0x55, 0x18, 0x43, 0xAF, 0x41, 0x2A, 0x35, 0x8D, 0x7A, 0x80, 0x45,
+    0x54, 0xA1, 0x9E, 0x33, 0xDE, 0x14, 0x39, 0x42, 0xE8, 0xA8, 0xF2, 0x81, 0xF6, 0xDD, 0xBF, 0x66,
+    0x95, 0xCB, 0xEF, 0x96, 0xE7, 0x87, 0xAF, 0x0F, 0xC8, 0x6B, 0xCE, 0x68, 0xE7, 0xE2, 0x02, 0x85,
+    0x9E, 0x5D, 0xDB, 0x08, 0xED, 0x2D, 0x9D, 0x5A, 0xC0, 0x6C, 0xFD, 0xB5, 0xC4, 0x8E, 0xE6, 0x1E,
+    0x42, 0xBB, 0x3B, 0xA6, 0x01, 0x4D, 0x3E, 0x98, 0x5C, 0xCB, 0x32, 0x8F, 0x24, 0x93, 0x6D, 0xE9,
+    0x2C, 0xDF, 0x73, 0x1D, 0x27, 0xAC, 0xDE, 0x56, 0xBF, 0xD1, 0xE8, 0xBA, 0xAE, 0x2A, 0xB4, 0x9A,
+    0x14, 0x46, 0x75, 0xF5, 0xDC, 0x06, 0x1B, 0xDC, 0x6C, 0xC3, 0xE8, 0xED, 0x4F, 0xD4, 0xD9, 0x1B,
+    0x1B, 0xF6, 0xA7, 0x89, 0xE6, 0xE6, 0x42, 0xA3, 0x40, 0xA3, 0x89, 0x56, 0x03, 0xAD, 0xDE, 0xA5,
+    0xCD, 0x82, 0x7C, 0x76, 0x53, 0x1F, 0xDD, 0x64, 0x93, 0x9B, 0xCC, 0xEA, 0x26, 0xB3, 0xB9, 0xA9,
+    0xDC, 0x7A, 0x6F, 0xB6, 0xAF, 0x0F, 0x66, 0x85, 0x26, 0x61, 0xB4, 0x60, 0x14, 0x30, 0xF2, 0x59,
+    0xBD, 0x82, 0x4F, 0x9D, 0xE8, 0x16, 0x67, 0x6E, 0x44, 0xFB, 0x8A, 0x3F, 0x99, 0xD0, 0x5C, 0x89,
+    0x66, 0xA1, 0x57, 0x79, 0x57, 0xF5, 0xD4, 0xB7, 0x5D, 0x5A, 0xCB, 0x0F, 0x42, 0xED, 0xE9, 0x69,
+    0x16, 0x7A, 0x5F, 0xBC, 0x7B, 0xE8, 0xEA, 0xC6, 0x48, 0x09, 0x2B, 0x05, 0xDC, 0x3D, 0x79, 0xD4,
+    0x09, 0xB3, 0x9A, 0x84, 0x8D, 0x36, 0xE0, 0x7C, 0xEF, 0x51, 0x21, 0x4C, 0xAA, 0x12, 0x36, 0x34,
+    0x81, 0xDE, 0xF7, 0xBE, 0x50, 0x21, 0xAA, 0xA5, 0x4A, 0xB4, 0x73, 0x1B, 0x18, 0x87, 0xD1, 0x57,
+    0x5B, 0xA9, 0x30, 0xC6, 0x5A, 0x2F, 0xC9, 0xB7, 0xAB, 0x5D, 0x18, 0x0F, 0x95, 0xA7, 0x7A, 0xE3,
+    0x98, 0x6E, 0xF2, 0xC8, 0x77, 0x31, 0x5A, 0x91, 0x3A, 0x77, 0x61, 0xB2, 0x97, 0xA2, 0x09, 0xAF,
+    0x93, 0xDA, 0xCE, 0xD5, 0x93, 0xBD, 0x14, 0xCD, 0xBC, 0x16, 0x8B, 0xEB, 0x9E, 0xB7, 0x53, 0xFB,
+    0xF4, 0xE6, 0x26, 0x9D, 0x9A, 0x9D, 0xC7, 0xCE, 0x98, 0x48, 0x91, 0xE8, 0x3D, 0x6E, 0xFA, 0xA8,
+    0x6C, 0xF4, 0xB8, 0xF9, 0xC3, 0xD9, 0x94, 0xB3, 0x7E, 0x1E, 0xFF, 0xE2, 0x60, 0x0C, 0xA3, 0xA4,
+    0x9C, 0xE9, 0x43, 0xD9, 0xCC, 0x18, 0x34, 0x33, 0x26, 0xCD, 0x8C, 0xAB, 0x66, 0xC6, 0x15, 0xB0,
+    0xEB, 0x6E, 0xB6, 0x9B, 0xAC, 0x9F, 0x2C, 0x50, 0x2B, 0x40, 0xF9, 0xDD, 0x43, 0x00, 0xAD, 0x19,
+    0x12, 0xCF, 0x9B, 0x50, 0x24, 0xEB, 0xAB, 0xE0, 0xBA, 0xC6, 0xAF, 0xF4, 0x26, 0x16, 0xC9, 0x4E,
+    0x55, 0x70, 0xBF, 0x18, 0x7D, 0x06, 0x44, 0x93, 0x95, 0x82, 0x1B, 0xDA, 0x69, 0x63, 0xBC, 0xBC,
+    0x94, 0x02, 0x93, 0x60, 0x0C, 0xD9, 0xEF, 0xB4, 0x00, 0x7F, 0x65, 0xB5, 0xE6, 0x8F, 0xAD, 0x56,
+    0xF8, 0x6B, 0x56, 0xEB, 0x41, 0x76, 0xEF, 0x48, 0xEF, 0x5A, 0x0F, 0xC5, 0xA8, 0x4D, 0x3B, 0x22,
+    0x9B, 0x55, 0xDD, 0x3E, 0x00, 0xE3, 0xEC, 0xB0, 0x43, 0xA2, 0x37, 0x61, 0xAF, 0xCC, 0xAF, 0xAA,
+    0x9B, 0xDF, 0x18, 0x9F, 0x5E, 0xCA, 0x2D, 0x3B, 0x69, 0xEA, 0x90, 0xFD, 0xC7, 0x6B, 0xD6, 0xD2,
+    0x1E, 0xED, 0xC6, 0xC1, 0xBE, 0xBF, 0xE1, 0x7E, 0xB9, 0x30, 0xBE, 0x32, 0x97, 0x5B, 0xDF, 0xD5,
+    0x77, 0x56, 0x9A, 0xEB, 0x91, 0xFE, 0xD4, 0x54, 0xAE, 0x6E, 0xB0, 0x71, 0x7C, 0x4A, 0x3F, 0x90,
+    0xF4, 0x45, 0x69, 0xCD, 0x0A, 0x88, 0x9B, 0x60, 0xEC, 0x28, 0xD7, 0xAC, 0x7E, 0xB4, 0x13, 0x46,
+    0x1D, 0x76, 0xCD, 0xE5, 0x5C, 0xC1, 0x44, 0x80, 0xDF, 0x2D, 0x9E, 0xF6, 0x4F, 0x7C, 0xA3, 0xBA,
+    0xD2, 0x9D, 0xFD, 0xE3, 0xEA, 0x6A, 0x77, 0xF1, 0x6C, 0x73, 0x45, 0xA9, 0xBD, 0xEF, 0xBF, 0xF6,
+    0x44, 0x76, 0x98, 0x3A, 0x7F, 0xE8, 0x12, 0x7D, 0x14, 0x17, 0x30, 0xC2, 0x2D, 0x54, 0xA2, 0x4F,
+    0x58, 0xD1, 0xAF, 0x58, 0x75, 0xBD, 0x68, 0xD5, 0xF5, 0xEA, 0x9C, 0xBA, 0x5E, 0x43, 0xAF, 0xAE,
+    0x97, 0x97, 0xBA, 0x5E, 0x93, 0xD4, 0x8D, 0xE3, 0x2D, 0x69, 0x18, 0x2F, 0x7C, 0xB0, 0x69, 0x18,
+    0x5F, 0xD1, 0xAA, 0x61, 0xBC, 0xA6, 0xA4, 0x61, 0xBC, 0xAA, 0x45, 0xC3, 0x78, 0x59, 0x77, 0xE4,
+    0x75, 0x59, 0xEF, 0xC9, 0xEB, 0x4D, 0xFD, 0x44, 0x5E, 0x5E, 0x6F, 0xC9, 0x6B, 0x1A, 0x2F, 0xC9,
+    0x6B, 0xEA, 0x2F, 0xCB, 0x6B, 0xC2, 0x64, 0xC1, 0xD6, 0xA6, 0x63, 0x79, 0xF6, 0x88, 0xC6, 0x23,
+    0xEE, 0x48, 0x6E, 0x7A, 0xC6, 0x1D, 0x5F, 0x06, 0x38, 0xE8, 0x5A, 0x6F, 0xA2, 0x8D, 0xC5, 0x66,
+    0x84, 0x06, 0x79, 0x37, 0xBB, 0xA5, 0x5D, 0xAC, 0xEC, 0x66, 0xF4, 0x23, 0x0D, 0xDB, 0x76, 0x3F,
+    0xB8, 0x7E, 0x4D, 0xF6, 0xDA, 0xD6, 0x9B, 0x5B, 0x3A, 0xE3, 0x93, 0xBB, 0x1A, 0xDC, 0xA9, 0xDB,
+    0xC9, 0xBE, 0xB5, 0xC8, 0xC4, 0x4F, 0x39, 0xBF, 0xF3, 0x19, 0xFA, 0x5D, 0x69, 0xB6, 0x73, 0x6E,
+    0xB7, 0x22, 0xA1, 0xF6, 0xEA, 0xFB, 0xEB, 0x78, 0xE6, 0xC7, 0xEF, 0xAF, 0xE3, 0x57, 0x7E, 0x74,
+    0x67, 0xEB, 0x5F, 0xF9, 0xE9, 0xDD, 0xAD, 0xFF, 0xF6, 0x8D, 0x85, 0xC6, 0x37, 0x03, 0xE8, 0xC2,
+    0x72, 0xB8, 0x58, 0xF7, 0x9A, 0x8E, 0xCA, 0xF5, 0x11, 0xEE, 0xC8, 0xDD, 0xBC, 0xCB, 0x93, 0xDD,
+    0xAA, 0x83, 0x42, 0x0B, 0xE0, 0x6E, 0x7A, 0x30, 0x77, 0x37, 0x60, 0x3C, 0x15, 0xC0, 0x86, 0xB1,
+    0xA3, 0xD8, 0xAA, 0x05, 0xDC, 0xE4, 0x3C, 0x26, 0x99, 0x0D, 0x46, 0xDF, 0x04, 0xEC, 0x76, 0x5E,
+    0x5D, 0x21, 0x69, 0xC1, 0x29, 0xFB, 0x01, 0xB5, 0x65, 0xC8, 0xC6, 0x26, 0x8C, 0x9E, 0x92, 0xA7,
+    0x5D, 0x5C, 0xCC, 0xE2, 0x03, 0x36, 0x92, 0x91, 0x42, 0x2D, 0x0D, 0x56, 0x0B, 0x8F, 0x1C, 0x73,
+    0x98, 0xF6, 0xE7, 0xB0, 0x12, 0xA3, 0x92, 0x89, 0x4D, 0x68, 0x86, 0x76, 0x4A, 0xB8, 0xA7, 0x03,
+    0x9B, 0x1D, 0xCC, 0xF2, 0x24, 0x75, 0x88, 0xB4, 0x97, 0x67, 0x64, 0xEF, 0x8D, 0xA9, 0xCD, 0xBE,
+    0x8A, 0xA9, 0x97, 0xBA, 0xF6, 0x5D, 0xA8, 0x42, 0x0F, 0x8C, 0x75, 0x00, 0x1B, 0xD5, 0x81, 0x4E,
+    0xC5, 0xC3, 0xD3, 0x63, 0x5B, 0xF6, 0xC3, 0xBB, 0x99, 0x43, 0x0B, 0x50, 0x11, 0x68, 0xB2, 0xA1,
+    0x9B, 0x00, 0xF7, 0xCA, 0x0C, 0x75, 0x14, 0xA0, 0x3A, 0x42, 0x33, 0xF7, 0x43, 0x16, 0xA8, 0x38,
+    0xEF, 0x66, 0xEA, 0x54, 0x08, 0xF4, 0x8B, 0x0B, 0x91, 0x46, 0xD2, 0x90, 0x75, 0x31, 0x97, 0x1D,
+    0x8F, 0x92, 0x90, 0xC7, 0xC5, 0x26, 0x51, 0xEA, 0x25, 0x75, 0x34, 0xA9, 0x9D, 0x46, 0xC6, 0xA7,
+    0x57, 0xB3, 0xD9, 0x68, 0x97, 0x7E, 0xEE, 0xDF, 0xD3, 0x70, 0xF0, 0x07, 0x07, 0xFF, 0x9F, 0xD4,
+    0x19, 0x0E, 0x1E, 0x7F, 0x4D, 0x0B, 0xA0, 0x5E, 0x8A, 0x50, 0x6A, 0x54, 0xB6, 0xD4, 0xA4, 0x5F,
+    0x9C, 0x63, 0xE7, 0xC4, 0x1D, 0x62, 0x94, 0xE0, 0xDE, 0xCE, 0xC7, 0xFE, 0xD4, 0xEE, 0xB5, 0xB0,
+    0xD2, 0x06, 0xE5, 0x56, 0x4B, 0x1B, 0x98, 0x94, 0x8F, 0xF5, 0x52, 0x49, 0x3F, 0x07, 0x1B, 0xF2,
+    0xD8, 0x77, 0xF7, 0x5E, 0x93, 0xDF, 0x95, 0x02, 0xBF, 0x33, 0xAC, 0x7E, 0x71, 0xFE, 0x5C, 0x21,
+    0x49, 0x52, 0x30, 0xF9, 0x18, 0xEB, 0x95, 0x42, 0x52, 0xB4, 0x89, 0x42, 0xD2, 0xD2, 0x2E, 0x47,
+    0x9A, 0xDC, 0xF1, 0xAD, 0x79, 0x97, 0x0B, 0xE7, 0x70, 0x5A, 0xB5, 0xD1, 0x4A, 0xBA, 0x30, 0xDB,
+    0xA9, 0xDF, 0x48, 0xD5, 0x5C, 0xEB, 0xC4, 0x99, 0x97, 0x02, 0x92, 0x42, 0xC2, 0x49, 0xE9, 0x24,
+    0x56, 0xD2, 0xA9, 0xAE, 0xDC, 0xFE, 0x09, 0x66, 0x62, 0xEC, 0x60, 0xC1, 0x05, 0x70, 0xBF, 0x90,
+    0xCE, 0x3D, 0x56, 0x4B, 0x92, 0x7C, 0x2E, 0x45, 0x23, 0x49, 0x89, 0xF1, 0x5C, 0x31, 0xBE, 0x8B,
+    0x9D, 0xAC, 0xB7, 0x9B, 0x7C, 0x9D, 0x7B, 0x08, 0xFA, 0x8F, 0xD0, 0x39, 0x1E, 0x3D, 0xF8, 0xB3,
+    0x26, 0xC3, 0x3C, 0xB1, 0x91, 0x42, 0x3B, 0x67, 0x83, 0xE9, 0x28, 0xDD, 0x3B, 0x4F, 0x9B, 0x79,
+    0x8C, 0x38, 0x09, 0x37, 0xEF, 0x04, 0x93, 0x09, 0xDC, 0x5F, 0x1C, 0x9C, 0x3E, 0xEE, 0xC5, 0x72,
+    0x59, 0xED, 0x4D, 0xF5, 0x5C, 0x4F, 0xED, 0x3D, 0xD1, 0x6B, 0x61, 0x94, 0x7F, 0xD8, 0x2F, 0xFA,
+    0xB0, 0x3A, 0x77, 0x97, 0x42, 0xC2, 0xDE, 0x13, 0x1B, 0xAF, 0x57, 0xF1, 0x20, 0xB5, 0x59, 0xF6,
+    0x5F, 0x97, 0x74, 0xEA, 0xE7, 0xA7, 0x71, 0x03, 0xA8, 0xA3, 0xD4, 0xBF, 0x7E, 0xEC, 0x69, 0x69,
+    0xAD, 0xB2, 0x7F, 0xDB, 0x97, 0xE3, 0x5E, 0x93, 0x56, 0x33, 0xEE, 0xD0, 0xC7, 0xDB, 0x4B, 0xAA,
+    0x24, 0xC5, 0xFF, 0x36, 0x33, 0x20, 0x33, 0xD6, 0x31, 0x81, 0x59, 0xC7, 0x1D, 0xF4, 0x49, 0xE3,
+    0x8E, 0x03, 0x24, 0x37, 0xA0, 0x2F, 0x26, 0xDA, 0x60, 0x97, 0x66, 0xA5, 0x97, 0xBA, 0x42, 0x9A,
+    0x28, 0xC6, 0x63, 0x08, 0xDE, 0x63, 0x3A, 0x67, 0xB2, 0x93, 0x37, 0x38, 0x69, 0x9E, 0x0B, 0xF9,
+    0x6C, 0x52, 0x6E, 0xBF, 0xFD, 0x9A, 0x16, 0x65, 0x36, 0x4D, 0x75, 0xEF, 0x9F, 0x27, 0xEB, 0x9B,
+    0xA9, 0xF9, 0xC5, 0x46, 0xA3, 0x99, 0x3A, 0x6B, 0xF8, 0xAC, 0x76, 0xC2, 0xFE, 0x60, 0xA5, 0xD8,
+    0x9A, 0x99, 0xF6, 0x9D, 0x0D, 0x23, 0x17, 0x3E, 0x8A, 0xFB, 0xF4, 0xFF, 0x7F, 0x15, 0xEA, 0xBD,
+    0x0A, 0xED, 0x2F, 0x36, 0x5A, 0xCD, 0x3C, 0x76, 0x17, 0x13, 0x5D, 0xD7, 0xFC, 0x60, 0x65, 0x7C,
+    0x79, 0x29, 0xB7, 0x76, 0xAE, 0x97, 0x71, 0x00, 0x13, 0xB2, 0xCB, 0xAD, 0xF9, 0x41, 0xD6, 0xE4,
+    0xC7, 0x67, 0xB3, 0x82, 0xBF, 0xB9, 0x39, 0x5B, 0x6B, 0xFA, 0xF5, 0x35, 0xFB, 0x7E, 0x76, 0x2A,
+    0x35, 0xA0, 0x69, 0x4C, 0x36, 0x51, 0xE8, 0x92, 0xE6, 0x71, 0xA2, 0xD4, 0x33, 0xFA, 0x96, 0xC0,
+    0xA8, 0x59, 0x5D, 0x80, 0x6A, 0x73, 0x77, 0x34, 0x80, 0x4D, 0xBA, 0x96, 0x00, 0x7B, 0x5F, 0xE3,
+    0x94, 0x69, 0x9D, 0xDB, 0x6E, 0x8E, 0x85, 0x5D, 0x65, 0xEF, 0xB2, 0x52, 0x98, 0x76, 0x95, 0x37,
+    0x1C, 0xBB, 0x6D, 0x94, 0x95, 0xF1, 0x3E, 0x1F, 0x2B, 0x49, 0x5A, 0x60, 0x94, 0xFB, 0x40, 0x0B,
+    0xB5, 0xDE, 0xD3, 0x75, 0x2D, 0x48, 0xCF, 0xE8, 0x69, 0x25, 0xAB, 0xD8, 0x6C, 0x95, 0x12, 0x54,
+    0xF3, 0xF3, 0x99, 0x95, 0xE7, 0x76, 0x81, 0x11, 0x76, 0xEA, 0x14, 0x40, 0x73, 0x47, 0xDD, 0x5F,
+    0xAF, 0xAA, 0x9F, 0xF8, 0xCE, 0x27, 0xCE, 0x97, 0xE7, 0x29, 0x65, 0xF4, 0x82, 0x06, 0x5C, 0xD0,
+    0x2C, 0x4F, 0xB5, 0xB6, 0x71, 0xF4, 0x30, 0x5E, 0x59, 0xFB, 0x09, 0xEC, 0x5D, 0x65, 0x35, 0x73,
+    0xBC, 0x19, 0x72, 0xFD, 0x62, 0x2E, 0x78, 0x56, 0xB3, 0x72, 0xB5, 0xB2, 0xC7, 0x12, 0x2B, 0xCD,
+    0x3B, 0x05, 0x64, 0x3F, 0x44, 0x68, 0x25, 0x69, 0xC0, 0xA9, 0x5F, 0xB5, 0xD0, 0xEB, 0x94, 0x5A,
+    0xF9, 0x51, 0x4F, 0xEB, 0x92, 0xD6, 0xE6, 0xCD, 0x54, 0x87, 0xD1, 0xAC, 0x6E, 0xD2, 0xA9, 0xE8,
+    0xAE, 0xAF, 0x1F, 0x55, 0xCA, 0x4F, 0x6F, 0x5D, 0xA3, 0x54, 0x49, 0xFE, 0xB9, 0x43, 0x1F, 0x66,
+    0x47, 0xEB, 0x5B, 0x4D, 0xB5, 0x7C, 0xA9, 0x15, 0x5A, 0x8F, 0x59, 0x40, 0x7F, 0x9F, 0xFE, 0xDA,
+    0x9F, 0x8E, 0x37, 0xA4, 0x45, 0x4A, 0x4E, 0xA9, 0xD4, 0xBB, 0x7C, 0x24, 0x59, 0xAC, 0x18, 0x07,
+    0xA3, 0x50, 0xF0, 0x3D, 0xF8, 0x06, 0x45, 0x64, 0x9C, 0x19, 0x03, 0xC5, 0x02, 0x17, 0xCD, 0x3F,
+    0x4D, 0x46, 0x4B, 0xA5, 0x58, 0xEA, 0x5C, 0xAE, 0xD1, 0xD3, 0xD2, 0x2C, 0xA5, 0x1D, 0x6A, 0x29,
+    0x45, 0x29, 0x0A, 0x0D, 0x8C, 0x89, 0x56, 0x9E, 0x3A, 0x41, 0x0F, 0xCD, 0xF4, 0xBB, 0x75, 0x74,
+    0xFF, 0x6C, 0xCD, 0x4E, 0xD5, 0x61, 0x94, 0x2F, 0x8F, 0x06, 0x5F, 0x23, 0x3D, 0x23, 0xFD, 0x44,
+    0x5A, 0x28, 0xB6, 0xFD, 0x17, 0x8C, 0x28, 0x35, 0x30, 0x6E, 0x7C, 0x5A, 0x13, 0x26, 0x41, 0xDF,
+    0xD1, 0x4E, 0xDF, 0x6C, 0xE2, 0xA8, 0xD4, 0x4B, 0x95, 0xD4, 0x35, 0xCA, 0xEC, 0xB0, 0x83, 0x6C,
+    0x0A, 0xEF, 0x7C, 0x9E, 0xF5, 0x57, 0x75, 0xEB, 0xDF, 0x32, 0x6B, 0xF4, 0xC4, 0xD7, 0xC7, 0x6E,
+    0xCC, 0xAA, 0xEA, 0x67, 0xCF, 0xFF, 0xE9, 0xE9, 0x0F, 0x3D, 0xFC, 0x0D, 0xEC, 0xAD, 0x84, 0xAE,
+    0x86, 0x4A, 0xAD, 0x77, 0x69, 0x34, 0xBA, 0x95, 0x1A, 0x5D, 0x0D, 0xEA, 0xDB, 0xAB, 0x77, 0xD2,
+    0xD8, 0x5F, 0xB9, 0xA5, 0xD4, 0xFC, 0x58, 0xF3, 0x78, 0x46, 0xE5, 0x3A, 0xC6, 0xFA, 0x7D, 0x0D,
+    0xED, 0x8F, 0x13, 0x63, 0xC7, 0xAE, 0x2D, 0xF4, 0xCF, 0x44, 0xEA, 0x38, 0x76, 0xE8, 0xDB, 0xCB,
+    0xC7, 0xCD, 0x60, 0xE5, 0x9A, 0xB6, 0x41, 0x18, 0x9D, 0x8A, 0x8C, 0x71, 0xEC, 0xAC, 0x9E, 0x8D,
+    0x85, 0x96, 0xB1, 0x73, 0x7A, 0x79, 0xA9, 0xB4, 0xF4, 0x83, 0x74, 0x65, 0x69, 0x6E, 0xA6, 0xFE,
+    0xF2, 0xAA, 0x2B, 0xA9, 0xBF, 0x96, 0xFA, 0x6B, 0x51, 0x97, 0x57, 0xD9, 0xE4, 0x34, 0xEB, 0xBA,
+    0x92, 0x5D, 0x9D, 0x06, 0x5D, 0x57, 0xB4, 0x9B, 0x53, 0xA1, 0x1B, 0x9A, 0x9A, 0xCD, 0xA5, 0x42,
+    0xA1, 0x0A, 0x3D, 0xED, 0xA5, 0xC4, 0xF8, 0x6C, 0x34, 0x9B, 0x9B, 0x8F, 0x15, 0xA4, 0x1D, 0x4C,
+    0x1A, 0x71, 0xB7, 0x52, 0xA1, 0xAB, 0xC1, 0xAA, 0xF5, 0x4A, 0x63, 0xA5, 0x5B, 0xC9, 0xBD, 0x7D,
+    0xF5, 0xD6, 0xDA, 0xB7, 0x6F, 0xBF, 0x97, 0x46, 0x55, 0xEF, 0x6B, 0x69, 0x7F, 0x2C, 0x3F, 0x9E,
+    0x59, 0xCB, 0x75, 0x9C, 0xEB, 0xF7, 0x45, 0x9B, 0x01, 0x89, 0xE6, 0xCD, 0x04, 0x75, 0x18, 0xC1,
+    0x24, 0xE7, 0x77, 0x85, 0xE8, 0xC3, 0x23, 0xFF, 0xB1, 0xAD, 0x83, 0x5E, 0x1B, 0xF4, 0x52, 0xA0,
+    0xDF, 0xCE, 0x08, 0x17, 0x19, 0xE7, 0x36, 0x60, 0x93, 0x5D, 0x28, 0xF4, 0x4C, 0x02, 0x77, 0x4B,
+    0x50, 0x25, 0x0D, 0x14, 0x72, 0x33, 0xB8, 0x6B, 0x11, 0xEC, 0x07, 0x1B, 0x98, 0x35, 0x7F, 0x18,
+    0x60, 0xBC, 0xBA, 0x41, 0x7F, 0x4B, 0x77, 0xFF, 0x40, 0xA9, 0x97, 0xB4, 0x59, 0x49, 0x7A, 0x4A,
+    0x92, 0x7C, 0x7B, 0xC8, 0x44, 0xF2, 0xC7, 0xE8, 0xF7, 0xCD, 0x9B, 0x89, 0xF6, 0x52, 0xC2, 0x5D,
+    0x4F, 0xB8, 0xEB, 0x2B, 0x7F, 0xC5, 0xB4, 0xCC, 0x60, 0xD1, 0x28, 0x5F, 0x4A, 0xC1, 0xAC, 0xF5,
+    0x52, 0x47, 0x93, 0x6C, 0x28, 0x56, 0x3B, 0xB3, 0x1D, 0xA5, 0x50, 0xAC, 0x76, 0xA9, 0xD6, 0x3A,
+    0xBB, 0x52, 0x96, 0x52, 0x0A, 0x8C, 0xF2, 0x3C, 0xB6, 0x66, 0xDE, 0x53, 0x21, 0x05, 0x1A, 0x29,
+    0x16, 0x99, 0x1E, 0x85, 0xE6, 0x3E, 0xA0, 0x4B, 0xEA, 0x0A, 0x9D, 0x4A, 0x54, 0x9B, 0x93, 0x94,
+    0x24, 0xE9, 0xB6, 0x24, 0x5D, 0x5B, 0xA9, 0xE4, 0x16, 0xDC, 0x32, 0x6E, 0x5F, 0xD6, 0xA4, 0x9D,
+    0x1F, 0xB3, 0x18, 0x49, 0xBE, 0x92, 0xD6, 0xEC, 0xFE, 0x2D, 0xC6, 0x77, 0xA1, 0x8D, 0xD4, 0x4A,
+    0x8C, 0x4A, 0x66, 0xAD, 0x97, 0x76, 0xB2, 0x41, 0x34, 0xD7, 0x97, 0x83, 0xF1, 0x54, 0xE6, 0x3E,
+    0x2C, 0xA2, 0xB9, 0xB1, 0x15, 0x7A, 0x36, 0xDB, 0x5C, 0x73, 0xD6, 0x2A, 0x02, 0x8F, 0xAD, 0xD0,
+    0xBE, 0xB8, 0x64, 0xB1, 0x6A, 0x92, 0xF3, 0x34, 0xEF, 0x09, 0x1E, 0x62, 0x9A, 0x1E, 0x3A, 0x9C,
+    0xFE, 0x36, 0x2B, 0x60, 0x16, 0x37, 0xD8, 0x79, 0xA3, 0xBF, 0x92, 0x0A, 0x35, 0xA1, 0x4E, 0xA3,
+    0x3F, 0xD6, 0xF2, 0xE5, 0xAE, 0x03, 0xE9, 0x8B, 0x5B, 0x1D, 0x4D, 0x72, 0xBE, 0x8A, 0xDB, 0xA3,
+    0x67, 0xAE, 0x4B, 0xFA, 0xB6, 0xB4, 0x39, 0x5F, 0x2D, 0x1A, 0xFA, 0xB7, 0xF2, 0xCF, 0x2F, 0xB5,
+    0xE4, 0x6B, 0x25, 0x1E, 0x51, 0x07, 0xEE, 0xA5, 0x05, 0x36, 0x3B, 0x53, 0xA5, 0x7E, 0xAF, 0xDB,
+    0x78, 0x35, 0xFD, 0x0A, 0xCC, 0x47, 0x33, 0x8C, 0x99, 0x12, 0xB8, 0xA0, 0xA9, 0x8D, 0x55, 0xA2,
+    0x09, 0xCE, 0xD3, 0xCE, 0xDB, 0x6E, 0xB3, 0x08, 0xBB, 0x93, 0x15, 0xE3, 0x21, 0xF1, 0x26, 0x3B,
+    0xAF, 0xC6, 0xC8, 0xF8, 0x9E, 0x94, 0x09, 0xD4, 0x9B, 0x3D, 0x64, 0xFF, 0x0F, 0x8D, 0xB4, 0xF0,
+    0x88, 0x76, 0xF5, 0xA4, 0xBD, 0xB4, 0x98, 0xE4, 0xBC, 0xBB, 0x9C, 0x4C, 0x72, 0x7E, 0x6F, 0xED,
+    0xF2, 0x7F, 0xE9, 0x8C, 0xD4, 0x3D, 0x59, 0xAC, 0x05, 0x26, 0x40, 0x3B, 0x50, 0xA4, 0x42, 0xF2,
+    0x8D, 0x12, 0xB4, 0x6F, 0x62, 0x96, 0x27, 0x0B, 0x19, 0x69, 0x72, 0x8A, 0x9C, 0xF9, 0x59, 0xFE,
+    0xA9, 0xDF, 0xCB, 0x3A, 0xAC, 0xB7, 0x52, 0x2C, 0x0E, 0x3E, 0x6E, 0x31, 0x14, 0x65, 0x6A, 0x66,
+    0x64, 0x12, 0x6E, 0xE8, 0x7D, 0x3B, 0xD9, 0x68, 0x43, 0x21, 0xB3, 0xE0, 0x7E, 0xB2, 0x52, 0x27,
+    0x65, 0x52, 0x41, 0xAB, 0x29, 0x3B, 0x6F, 0xC6, 0x25, 0x1B, 0xFA, 0xA5, 0x80, 0x7E, 0xD8, 0xD5,
+    0xCE, 0x80, 0xD5, 0x92, 0x31, 0x0D, 0xAD, 0x99, 0x5D, 0x77, 0xA2, 0x03, 0x28, 0xFE, 0xF0, 0x55,
+    0x46, 0x6D, 0x38, 0xC9, 0xB7, 0xDA, 0x5E, 0xFD, 0xD5, 0x4B, 0xF2, 0xDF, 0x1E, 0x19, 0x15, 0x57,
+    0x05, 0x9A, 0x4B, 0x89, 0x3A, 0x8E, 0x9D, 0x59, 0xDD, 0x84, 0xBE, 0xBD, 0x7C, 0x64, 0x19, 0x4C,
+    0xA2, 0xCE, 0x64, 0xFF, 0xC8, 0x56, 0x88, 0x11, 0x37, 0x39, 0x5F, 0x1D, 0x92, 0xFD, 0x9B, 0x43,
+    0xB2, 0x7F, 0xFF, 0x37, 0x23, 0xFB, 0x8F, 0x75, 0xA0, 0xBD, 0x9C, 0xB0, 0x41, 0xE4, 0x72, 0x9C,
+    0x8A, 0x7F, 0xAD, 0x1E, 0xEA, 0xBB, 0xDE, 0xB7, 0xFE, 0x41, 0x0F, 0xBD, 0x93, 0xA8, 0x0E, 0x7B,
+    0xA8, 0x91, 0xCF, 0x3D, 0xD4, 0xEF, 0x94, 0xE2, 0xE3, 0x3D, 0xF4, 0xE8, 0x18, 0xB0, 0x8A, 0x7B,
+    0x0F, 0x25, 0x70, 0xEF, 0x02, 0x27, 0x4E, 0xF3, 0x68, 0x57, 0xAE, 0xD4, 0x11, 0x75, 0x66, 0xA5,
+    0x9F, 0x0A, 0x75, 0x6D, 0x60, 0x9C, 0x3E, 0xAE, 0x83, 0x1E, 0x1F, 0xF8, 0x3A, 0xE5, 0x8A, 0x0D,
+    0xD8, 0xC0, 0x06, 0xE3, 0xD0, 0x4C, 0xBB, 0x29, 0xDA, 0x06, 0x37, 0x80, 0x9E, 0x89, 0x50, 0xA7,
+    0x11, 0x70, 0x37, 0x67, 0x28, 0x77, 0x8A, 0x99, 0x27, 0x8F, 0x9F, 0xEC, 0x73, 0xA6, 0x0D, 0xEC,
+    0x41, 0x58, 0xD9, 0xD1, 0x5B, 0xA7, 0x43, 0x06, 0x4B, 0xA6, 0x48, 0xE6, 0xFF, 0xDA, 0x00, 0x9E,
+    0xCB, 0x13, 0x64, 0xA2, 0x1F, 0x6C, 0xA4, 0x9D, 0xAB, 0x15, 0x1B, 0x4B, 0x75, 0xD5, 0xCA, 0xC1,
+    0xE1, 0xDD, 0x8F, 0xDD, 0x4C, 0xA2, 0x0E, 0x34, 0x73, 0x26, 0xC0, 0x37, 0x13, 0x55, 0x2A, 0xD3,
+    0x0E, 0x1A, 0x14, 0x32, 0x0B, 0xD8, 0x65, 0x04, 0xFA, 0x6B, 0x81, 0xDC, 0xB7, 0x34, 0xD9, 0xA6,
+    0x4C, 0xBB, 0x37, 0x60, 0x47, 0x54, 0xCA, 0x0C, 0xDF, 0xCE, 0xEC, 0xEE, 0xAC, 0x3F, 0x94, 0x07,
+    0xAB, 0x48, 0x1E, 0x6C, 0x7B, 0x2D, 0x75, 0x6E, 0x5F, 0xCC, 0xC7, 0x3A, 0xD4, 0x71, 0xEC, 0x74,
+    0x2A, 0xEE, 0xEB, 0xE7, 0x09, 0x4E, 0x3C, 0x15, 0xFF, 0x92, 0x83, 0x0A, 0x7B, 0x63, 0x66, 0x73,
+    0xB4, 0x37, 0x96, 0xEA, 0xB8, 0x83, 0xEA, 0xB1, 0xE5, 0xF9, 0x0C, 0x77, 0xF5, 0x19, 0x00, 0x1B,
+    0xA1, 0x0E, 0xEE, 0xE9, 0xE8, 0x5E, 0x5A, 0xFA, 0x6F, 0x2D, 0xE3, 0xD5, 0x94, 0xE5, 0xD6, 0x6F,
+    0xF1, 0xEA, 0x67, 0x8B, 0xF0, 0x99, 0x22, 0x7C, 0xA6, 0x08, 0x9F, 0x2B, 0xC2, 0xE7, 0xCA, 0xF0,
+    0x85, 0x2A, 0x34, 0x0A, 0x76, 0x0B, 0xC5, 0x9F, 0x04, 0xD8, 0xF7, 0x43, 0xC2, 0xA7, 0xA4, 0xE6,
+    0xCE, 0xC1, 0x73, 0xFD, 0x40, 0xB1, 0x3D, 0x20, 0x7C, 0xF6, 0x1F, 0x4D, 0xF8, 0x4C, 0xC7, 0x08,
+    0x9F, 0x33, 0xB5, 0x06, 0x3E, 0xFD, 0x46, 0xA6, 0xC2, 0x57, 0x33, 0x7C, 0xBA, 0x83, 0x47, 0x0F,
+    0x4E, 0x4B, 0xD7, 0xA5, 0x53, 0x1E, 0x07, 0x09, 0x13, 0xB0, 0x87, 0xA7, 0x11, 0x3B, 0xE1, 0x3C,
+    0xEA, 0x78, 0x12, 0x22, 0x34, 0x2F, 0x2C, 0xEC, 0xCB, 0xFF, 0xBE, 0xFE, 0xEF, 0xA3, 0xBF, 0xFF,
+    0xD1, 0xFA, 0xEB, 0x18, 0x29, 0x36, 0xDB, 0x39, 0xF9, 0x7F, 0xF4, 0xAC, 0x07, 0xDC, 0x5B, 0x01,
+    0xB0, 0xF1, 0x75, 0xC0, 0xAC, 0x6D, 0x07, 0xE8, 0xD9, 0x09, 0x70, 0x6F, 0xC5, 0xE3, 0x37, 0xF4,
+    0x2E, 0xE8, 0x59, 0xC9, 0xE3, 0xDE, 0x92, 0x16, 0x6C, 0x7C, 0xA3, 0x10, 0x66, 0x6B, 0x87, 0x66,
+    0x42, 0x2F, 0xCF, 0x66, 0xC1, 0xBD, 0xB3, 0x94, 0x2B, 0x36, 0x8D, 0xAF, 0xA9, 0x33, 0x6A, 0x25,
+    0x8F, 0xAE, 0x4A, 0x1E, 0x77, 0x5B, 0x5B, 0x47, 0x93, 0x78, 0xA3, 0x9E, 0x30, 0xC9, 0x0D, 0xD8,
+    0xB0, 0x2F, 0x8D, 0x85, 0x9A, 0xF0, 0xB1, 0x82, 0x0D, 0x20, 0xFD, 0x0E, 0x98, 0x10, 0xC0, 0x5E,
+    0xF6, 0xE0, 0x2C, 0x90, 0x9E, 0x04, 0x13, 0x22, 0xD8, 0xCB, 0x8A, 0x38, 0xAB, 0xC8, 0xFA, 0x64,
+    0x15, 0x4C, 0x8C, 0xB5, 0xB7, 0xD7, 0x27, 0x87, 0xFB, 0xF6, 0x2F, 0x13, 0x9B, 0xD3, 0x64, 0x16,
+    0xDD, 0xC5, 0xCE, 0xED, 0x4C, 0x95, 0x70, 0x33, 0x6E, 0xA2, 0x9F, 0xCC, 0x46, 0x0E, 0x52, 0x40,
+    0x97, 0xD4, 0x51, 0xEA, 0x95, 0xE5, 0xD0, 0xC1, 0x93, 0xDD, 0x3B, 0xB5, 0x66, 0xC0, 0xE6, 0x79,
+    0x96, 0x38, 0x84, 0xD2, 0xF6, 0x39, 0xA6, 0x00, 0x95, 0x34, 0x81, 0x7B, 0x5F, 0x1E, 0xA3, 0xCB,
+    0x1A, 0x68, 0xD7, 0x4A, 0xFF, 0x01, 0x9A, 0xAD, 0x92, 0x15, 0x8D, 0x96, 0x71, 0xC1, 0x29, 0x00,
+    0xBD, 0x06, 0xA0, 0xDD, 0xCD, 0xD9, 0x66, 0x30, 0x73, 0x19, 0x4D, 0xC0, 0x95, 0x0B, 0x75, 0x48,
+    0xB0, 0xAE, 0xD0, 0x68, 0x97, 0xC8, 0xFD, 0x90, 0x87, 0x52, 0xA3, 0xEC, 0x94, 0xB7, 0xB7, 0x13,
+    0xD5, 0xD2, 0xFF, 0x5F, 0x26, 0xD5, 0x7A, 0x69, 0x45, 0x61, 0x9F, 0x48, 0xD0, 0x4B, 0x57, 0x32,
+    0x23, 0xD9, 0x1F, 0x3B, 0x1D, 0x95, 0x63, 0x77, 0xF6, 0x6C, 0xF7, 0xE1, 0x64, 0x54, 0x67, 0x94,
+    0x24, 0xDD, 0x97, 0x24, 0x6D, 0x5F, 0x3F, 0x7F, 0xFE, 0xFC, 0xF9, 0xF3, 0xE7, 0x1A, 0xEF, 0xAA,
+    0xD9, 0xBE, 0xB9, 0x98, 0xF0, 0x3C, 0xA9, 0x19, 0x5C, 0x35, 0xDB, 0x4B, 0x4B, 0x15, 0xDE, 0x28,
+    0x52, 0x3B, 0x3C, 0x5F, 0x4F, 0xCD, 0x8B, 0xB1, 0x9A, 0x5F, 0x2F, 0x96, 0xB6, 0x7B, 0xBE, 0x9E,
+    0x9A, 0x97, 0x62, 0x3D, 0xAF, 0xE5, 0xE2, 0xBA, 0xD7, 0xAD, 0x6F, 0x9F, 0x0E, 0xF5, 0x94, 0xCA,
+    0xE8, 0x78, 0xDD, 0xFA, 0xF6, 0x8B, 0xAF, 0x3E, 0x32, 0x38, 0x49, 0xBA, 0x76, 0xA4, 0xB4, 0x1C,
+    0x53, 0x0E, 0xEC, 0x83, 0x0F, 0x25, 0x49, 0xCD, 0xD6, 0xAC, 0x36, 0xD9, 0xD4, 0x2C, 0x2E, 0xB8,
+    0x30, 0xCE, 0x5F, 0x1F, 0xFA, 0xC5, 0x6E, 0x46, 0xC3, 0x38, 0xDB, 0x64, 0xC4, 0x38, 0x37, 0xA9,
+    0x3C, 0xCF, 0x47, 0x7D, 0xCD, 0x25, 0xBB, 0x59, 0x19, 0xBD, 0xA8, 0x61, 0x9C, 0xFB, 0xD9, 0x26,
+    0x9B, 0x8C, 0x4A, 0x75, 0xE3, 0xDC, 0xCF, 0x4D, 0xB2, 0xA9, 0x3C, 0x5F, 0x9C, 0x87, 0xF2, 0xD5,
+    0x2C, 0x02, 0x3E, 0x2E, 0xD5, 0x77, 0x5E, 0xAD, 0xB3, 0x52, 0xB1, 0xB4, 0x52, 0x7A, 0xF4, 0xCB,
+    0x21, 0xCB, 0x8B, 0xE3, 0xE9, 0x2F, 0xF9, 0x96, 0x3F, 0x26, 0x55, 0x33, 0x98, 0x19, 0x98, 0x81,
+    0x73, 0x7B, 0x88, 0xCE, 0x91, 0xF6, 0x0F, 0x5B, 0xF6, 0xD2, 0xDB, 0x39, 0x63, 0xF2, 0xC7, 0x2F,
+    0x3B, 0x0E, 0xB4, 0x55, 0xD9, 0x81, 0x1C, 0xA5, 0x9F, 0x9F, 0x3E, 0xC4, 0xD5, 0xED, 0x94, 0x63,
+    0x2F, 0xF7, 0xCB, 0x46, 0x93, 0x93, 0x5E, 0x94, 0x64, 0x75, 0xF7, 0xB9, 0xCC, 0x4A, 0xCF, 0x1E,
+    0xD0, 0x2A, 0x70, 0x78, 0xC9, 0xC5, 0xCC, 0x52, 0x2D, 0x3C, 0x98, 0xC3, 0x38, 0x39, 0x69, 0xCA,
+    0xEA, 0x95, 0xA4, 0xB9, 0x38, 0xCC, 0x42, 0x79, 0x88, 0xF9, 0x3D, 0xC8, 0x62, 0xA5, 0xAC, 0xFB,
+    0x65, 0x6A, 0x56, 0x7A, 0x90, 0x35, 0x87, 0xD9, 0xDA, 0x1E, 0xC6, 0xFE, 0x6E, 0x6E, 0xA7, 0xCE,
+    0x4D, 0x66, 0x43, 0x8B, 0x93, 0xD5, 0xD3, 0x2B, 0xDF, 0x07, 0x38, 0xD1, 0xF5, 0x2F, 0xCA, 0x26,
+    0x17, 0xE4, 0x8F, 0x9D, 0xBE, 0xFE, 0xFA, 0xEB, 0xC0, 0x89, 0x4C, 0x2B, 0xFA, 0x26, 0xF5, 0x6C,
+    0xFE, 0x23, 0x1C, 0x9F, 0xFD, 0x9E, 0x89, 0xFC, 0x37, 0x73, 0xE3, 0x8B, 0xEB, 0xDD, 0x8A, 0x49,
+    0x75, 0xA0, 0x9A, 0x7B, 0x76, 0x5A, 0x43, 0xEB, 0x77, 0xD2, 0xA8, 0x0D, 0x3B, 0x84, 0x6E, 0x12,
+    0xD0, 0xBE, 0x39, 0x7C, 0x95, 0xED, 0x77, 0xFE, 0xB7, 0xAF, 0xDA, 0xF0, 0xDA, 0xE3, 0xBE, 0x7F,
+    0xF1, 0x7F, 0xFA, 0xA5, 0x49, 0xF5, 0xAD, 0xD4, 0x4E, 0xF6, 0xE9, 0x49, 0x79, 0xD4, 0x19, 0x79,
+    0x4D, 0x2E, 0xD8, 0x54, 0x6D, 0x46, 0x9D, 0xFC, 0xE3, 0xE7, 0xB0, 0xAA, 0xF5, 0xB4, 0x2E, 0xC9,
+    0x6B, 0x1A, 0x67, 0x17, 0xDA, 0x68, 0x53, 0xBE, 0x6D, 0xF4, 0x45, 0x0D, 0xF2, 0x9A, 0x1E, 0x3F,
+    0xF7, 0xF8, 0xAE, 0x72, 0x15, 0xD1, 0xFA, 0x8B, 0x26, 0x35, 0xD3, 0x56, 0x45, 0x77, 0x29, 0xD9,
+    0xB9, 0xAF, 0x62, 0xEB, 0x57, 0x3B, 0x7F, 0x81, 0x68, 0x0F, 0x0D, 0xBB, 0xA5, 0x0E, 0x76, 0x6E,
+    0x7C, 0xEB, 0x5B, 0x00, 0xBE, 0x50, 0xFB, 0xFE, 0x2B, 0xB3, 0xBB, 0x16, 0x9A, 0xEB, 0x4B, 0xF5,
+    0x5E, 0x2A, 0xC3, 0xD9, 0x23, 0xAC, 0xB4, 0x88, 0xB5, 0x77, 0x97, 0x53, 0x33, 0xB7, 0x3F, 0xD8,
+    0x6C, 0xB0, 0x61, 0x34, 0x8B, 0x89, 0xED, 0x0B, 0x89, 0x58, 0x0F, 0xFB, 0xB7, 0x6C, 0x97, 0xB9,
+    0x5F, 0x01, 0xA7, 0xA9, 0x89, 0x7A, 0xF1, 0xBB, 0x8F, 0x7C, 0x17, 0xA8, 0x68, 0x19, 0xCD, 0x6A,
+    0x83, 0x1B, 0x7A, 0xEF, 0x82, 0x4D, 0x66, 0x63, 0xE5, 0x73, 0xFC, 0x26, 0xBC, 0xCA, 0x59, 0x7A,
+    0xDA, 0xA9, 0x5E, 0x8A, 0xB5, 0x50, 0xB5, 0xB6, 0xD1, 0x4D, 0xAE, 0xFB, 0x5C, 0x1E, 0x7C, 0xE3,
+    0xAE, 0x0D, 0x65, 0x65, 0x76, 0xB7, 0x45, 0x33, 0xDD, 0xF5, 0x29, 0x79, 0xF9, 0x42, 0xD3, 0xC1,
+    0x33, 0xEA, 0x18, 0x23, 0xCD, 0x06, 0x6E, 0xA5, 0x4F, 0x60, 0xF5, 0x54, 0x06, 0x9E, 0x7F, 0xB4,
+    0x93, 0xCB, 0xD5, 0x61, 0xC3, 0xA8, 0xAD, 0x8A, 0x4D, 0x68, 0x95, 0xEA, 0xA5, 0x09, 0x56, 0xC1,
+    0x2E, 0x6D, 0xB0, 0x9A, 0x6C, 0x72, 0xB1, 0x55, 0xB0, 0xE9, 0xD1, 0xD3, 0xA3, 0xD2, 0x89, 0xE7,
+    0x72, 0xB8, 0x4B, 0x96, 0x39, 0x03, 0x58, 0xBD, 0x9D, 0x43, 0x5D, 0x5F, 0xD2, 0x02, 0x52, 0xA1,
+    0x95, 0x52, 0x89, 0x51, 0x5D, 0xAD, 0x88, 0x93, 0x6F, 0x34, 0xED, 0x82, 0x75, 0x6F, 0xF5, 0xE7,
+    0x8E, 0xA1, 0xFB, 0x54, 0x3B, 0xC5, 0xE0, 0x21, 0xA6, 0x81, 0xDD, 0x63, 0x20, 0xBA, 0x72, 0x2A,
+    0x63, 0xB9, 0x98, 0xC5, 0xC4, 0xFC, 0x57, 0xC5, 0x2A, 0x56, 0xB1, 0x8E, 0x75, 0xAC, 0xA3, 0x8D,
+    0x65, 0xE0, 0xBF, 0x3E, 0x3E, 0x0B, 0xED, 0xD2, 0x2C, 0x4D, 0x6A, 0x93, 0x4B, 0x6E, 0x75, 0xBB,
+    0x17, 0x1F, 0x30, 0x1D, 0x54, 0xFE, 0x98, 0x60, 0x08, 0x14, 0x5A, 0xA9, 0xA5, 0xC1, 0x49, 0xB3,
+    0x7B, 0x5B, 0xF1, 0xB7, 0xEC, 0xED, 0x05, 0x7B, 0x3B, 0x61, 0xDF, 0x39, 0x96, 0x6E, 0x24, 0x9A,
+    0x5F, 0x3E, 0xF0, 0x1D, 0x37, 0x1A, 0x68, 0x56, 0x68, 0xE2, 0x83, 0xD4, 0xC6, 0xCC, 0x00, 0xFA,
+    0xE4, 0x87, 0xE1, 0xD2, 0x39, 0xEB, 0x46, 0x87, 0xA9, 0x8F, 0x39, 0x8D, 0x0B, 0x68, 0x01, 0xA5,
+    0xE3, 0xF2, 0xFD, 0xD3, 0x7F, 0xF2, 0xE9, 0x67, 0x83, 0x7D, 0x53, 0x0A, 0xAD, 0x42, 0x31, 0x4E,
+    0x50, 0x0E, 0xC0, 0x13, 0x7F, 0x1F, 0x3E, 0x78, 0x1B, 0x1A, 0xCD, 0xF9, 0x69, 0x95, 0x22, 0xE8,
+    0x66, 0xC7, 0x23, 0x4F, 0xFC, 0x3B, 0xF0, 0x2F, 0x7F, 0x10, 0x5E, 0x68, 0x9A, 0x57, 0xCE, 0x9E,
+    0xBC, 0x2F, 0x3D, 0xA3, 0x3B, 0xE3, 0x54, 0xAD, 0x8D, 0xDE, 0x92, 0x74, 0xF6, 0xC9, 0x0F, 0x7E,
+    0x16, 0x38, 0xC5, 0x27, 0xB2, 0x9C, 0xDA, 0x27, 0xA4, 0xF5, 0x39, 0xEC, 0xD5, 0x84, 0x3C, 0xEF,
+    0x8A, 0xB4, 0x4F, 0xBB, 0x71, 0x0F, 0x00, 0x77, 0xC3, 0x03, 0xE7, 0x55, 0x1D, 0x32, 0x99, 0xC7,
+    0x24, 0x28, 0xD7, 0x3D, 0x74, 0xF0, 0x48, 0x79, 0xF6, 0x19, 0x75, 0xB7, 0x0F, 0xAD, 0xED, 0xE3,
+    0x44, 0xA1, 0x81, 0x56, 0x91, 0x5E, 0x73, 0x95, 0xF9, 0x3E, 0xC1, 0xDD, 0xFD, 0x4A, 0x18, 0xFF,
+    0xA2, 0x9F, 0x9F, 0xA4, 0x99, 0x17, 0x9C, 0x3F, 0x8D, 0xF3, 0x03, 0x7D, 0x97, 0x1F, 0xBB, 0xE5,
+    0x62, 0x98, 0x25, 0x3F, 0xCD, 0xCE, 0x59, 0x1A, 0xB8, 0x0E, 0x94, 0x1F, 0x6C, 0x23, 0xB4, 0x81,
+    0x52, 0x9E, 0x4A, 0x1D, 0x63, 0xA2, 0xD0, 0x82, 0x91, 0xA7, 0x56, 0x87, 0x5D, 0xF2, 0x6A, 0xEA,
+    0xE6, 0x6C, 0xEB, 0x68, 0xC0, 0x28, 0x93, 0x1E, 0x6D, 0xCA, 0x54, 0x24, 0x37, 0xC0, 0x57, 0x39,
+    0x6A, 0x89, 0x8F, 0xDA, 0x1E, 0xCD, 0xF1, 0x6F, 0xC5, 0x96, 0xEB, 0x5B, 0x2F, 0xB9, 0x6A, 0x2E,
+    0x64, 0x50, 0x7B, 0xA7, 0x7D, 0x1B, 0x1D, 0x6A, 0xDE, 0xD9, 0xCC, 0xDF, 0x3A, 0x18, 0x2A, 0x09,
+    0x7E, 0xAB, 0x94, 0x12, 0xC5, 0xE2, 0xEE, 0x9C, 0x09, 0x34, 0x6F, 0x46, 0xC6, 0xAE, 0x48, 0xBF,
+    0x89, 0x49, 0xB9, 0x32, 0xBE, 0x4C, 0x50, 0xE6, 0x8B, 0xD6, 0x9B, 0x04, 0x26, 0xE1, 0x3C, 0xF4,
+    0x83, 0xC9, 0x7A, 0xA6, 0x1B, 0x78, 0x6C, 0xC3, 0x2C, 0x58, 0x79, 0xFA, 0xA1, 0xD0, 0x4C, 0xB5,
+    0xD0, 0x44, 0xE8, 0x87, 0x42, 0x1D, 0x65, 0xBE, 0xA8, 0x86, 0x52, 0x1D, 0xFC, 0xC6, 0xAE, 0x6B,
+    0x94, 0x7F, 0xA5, 0x0D, 0x5B, 0x3C, 0x07, 0x75, 0xA2, 0x9D, 0x40, 0xDE, 0xAC, 0x60, 0x57, 0xDC,
+    0x4C, 0xA1, 0xA9, 0xDA, 0xA0, 0xD9, 0xE8, 0x43, 0xB6, 0xCF, 0xD8, 0xD9, 0xE4, 0x70, 0xEE, 0x91,
+    0xAD, 0xE3, 0xF3, 0x8D, 0x12, 0xF5, 0x4D, 0xC9, 0x1B, 0xAD, 0x5F, 0x4E, 0x28, 0x30, 0x76, 0xEE,
+    0xAB, 0x39, 0xDE, 0xCA, 0x24, 0x13, 0x41, 0xC5, 0x0A, 0xCE, 0xF7, 0x1D, 0x76, 0x6E, 0x26, 0xAA,
+    0xA5, 0x8E, 0xD9, 0x6E, 0x68, 0x36, 0x46, 0xDC, 0x86, 0xF3, 0xCD, 0x86, 0x0D, 0xD5, 0x0A, 0x17,
+    0x0B, 0x41, 0xC5, 0xE8, 0xA1, 0x6B, 0x03, 0x60, 0xDF, 0xFD, 0xE8, 0x62, 0x9B, 0xB5, 0x78, 0x8E,
+    0x42, 0x83, 0x60, 0x0C, 0x6E, 0xA2, 0x4D, 0x76, 0xC1, 0xAA, 0xDA, 0x30, 0xBA, 0x24, 0x5F, 0x3C,
+    0x14, 0x4A, 0xF8, 0x6F, 0x01, 0x65, 0x38, 0x5C, 0x37, 0xB6, 0xA3, 0x00, 0xFE, 0xA3, 0xAB, 0x98,
+    0xAF, 0x0E, 0x18, 0xA9, 0x16, 0xB3, 0xD0, 0x06, 0x3B, 0x31, 0xFA, 0x11, 0x23, 0x93, 0xB0, 0xC9,
+    0xCE, 0xE4, 0x85, 0xB4, 0x4C, 0x39, 0x48, 0x2B, 0x2F, 0x3A, 0xF9, 0x2A, 0xEC, 0x21, 0xD9, 0xC5,
+    0xD1, 0x82, 0xE4, 0xBC, 0xF3, 0xC5, 0x56, 0x88, 0x3A, 0x54, 0x09, 0xE7, 0xDB, 0xC0, 0x86, 0xA6,
+    0x3A, 0x16, 0x07, 0x87, 0x10, 0x47, 0x66, 0xBA, 0x65, 0x30, 0x4F, 0x87, 0x42, 0xAD, 0x9D, 0x0F,
+    0x5F, 0x83, 0x91, 0x0E, 0x8B, 0xB7, 0xEC, 0xD2, 0x28, 0x8B, 0x8B, 0x6A, 0xFE, 0xEC, 0xEF, 0x7F,
+    0xEE, 0xEF, 0x3D, 0xF9, 0xE7, 0x27, 0xFF, 0xFC, 0xC9, 0x3F, 0x7F, 0xF2, 0xC9, 0x36, 0xD9, 0xA5,
+    0x3C, 0xC7, 0x27, 0xF9, 0x5E, 0x11, 0xCD, 0xF7, 0x7F, 0xEB, 0xF7, 0xBF, 0xF0, 0xBA, 0xDB, 0x38,
+    0xCB, 0xD9, 0x3F, 0xFA, 0xEF, 0x75, 0x95, 0xCF, 0x31, 0xBE, 0xF8, 0x9A, 0xAF, 0xFF, 0xD3, 0x27,
+    0xC7, 0xDB, 0x7A, 0xE1, 0x34, 0x8F, 0xBC, 0x3A, 0x5E, 0xE9, 0x3E, 0x7F, 0x4E, 0xB7, 0xDF, 0xB9,
+    0x69, 0x5E, 0xFF, 0x6C, 0x1F, 0xFF, 0xAB, 0x0E, 0xA3, 0x7B, 0x17, 0x86, 0xCF, 0x12, 0x8D, 0x6F,
+    0xB8, 0x68, 0x82, 0x1D, 0xBE, 0x06, 0x94, 0x5B, 0xF1, 0xD6, 0xF4, 0x8D, 0xEF, 0xD5, 0xC9, 0xDC,
+    0x7C, 0xDA, 0x87, 0x78, 0xB6, 0xDD, 0xCA, 0x0D, 0x28, 0x3A, 0xBB, 0x7C, 0xEE, 0x33, 0xFF, 0x9E,
+    0xFD, 0x7D, 0xDB, 0xAA, 0x12, 0xBF, 0xD5, 0xAE, 0x87, 0x21, 0xDE, 0xAE, 0x7D, 0x17, 0x69, 0xA9,
+    0xA4, 0xD8, 0xDC, 0x6D, 0x42, 0x3F, 0x34, 0x6F, 0x26, 0x5C, 0x1D, 0x58, 0x5B, 0x6F, 0xE2, 0x48,
+    0x73, 0x63, 0xA5, 0xFF, 0x76, 0x2C, 0x37, 0x37, 0xD5, 0x8B, 0x86, 0xF6, 0xF6, 0x86, 0xAE, 0x2D,
+    0x46, 0x8D, 0x7F, 0xE7, 0xAA, 0xF9, 0xE6, 0xBF, 0xFA, 0xE0, 0xBF, 0xFB, 0xF3, 0x9B, 0xCF, 0x5E,
+    0x58, 0x5D, 0xE8, 0xF9, 0x04, 0xA9, 0x0A, 0xC6, 0x5B, 0x9E, 0x20, 0x18, 0xAF, 0x0F, 0x34, 0xC1,
+    0xA7, 0x5F, 0xD4, 0xFF, 0x51, 0x77, 0x9F, 0xE5, 0xFB, 0x95, 0x7F, 0xC3, 0xCE, 0xD9, 0xFD, 0x79,
+    0xE2, 0x29, 0xF9, 0xAA, 0xFB, 0x4C, 0x13, 0xCE, 0x4C, 0xD5, 0xFF, 0xF8, 0xC6, 0xF8, 0xBE, 0x06,
+    0xE6, 0x32, 0x54, 0xE1, 0xEF, 0x84, 0x27, 0xC2, 0xFF, 0xBC, 0x28, 0x1D, 0x44, 0x02, 0xE1, 0xE0,
+    0x3F, 0xD6, 0x55, 0x3E, 0x87, 0x5E, 0x7C, 0xCD, 0xD7, 0x5F, 0xBB, 0xA8, 0x5B, 0x1B, 0x8F, 0x7C,
+    0x67, 0xFC, 0x51, 0xF7, 0xF9, 0x73, 0xBA, 0xFD, 0x93, 0x9B, 0xE6, 0xFF, 0xB1, 0xFD, 0xD2, 0x0F,
+    0xE7, 0x5F, 0x53, 0xA8, 0x86, 0xCF, 0x13, 0x8D, 0x6F, 0x49, 0x66, 0x6E, 0x06, 0xA8, 0x16, 0xF3,
+    0xE3, 0xA7, 0xA6, 0xF9, 0x1B, 0xDF, 0xAF, 0x93, 0xD1, 0xD3, 0x53, 0x88, 0x67, 0x5B, 0x95, 0x1B,
+    0x70, 0x02, 0x17, 0xFE, 0xC5, 0x37, 0xE6, 0x27, 0xE6, 0x27, 0xFA, 0xD4, 0x24, 0x9E, 0xC8, 0xBC,
+    0x2C, 0xAA, 0x19, 0x37, 0x94, 0x89, 0x66, 0x42, 0x54, 0x11, 0xE7, 0x8B, 0x8D, 0x3A, 0xE0, 0x7C,
+    0xB1, 0xE6, 0x23, 0xC2, 0x2C, 0xD8, 0x07, 0x6F, 0x11, 0xB1, 0xF3, 0xFE, 0xE9, 0x4A, 0xBD, 0xD0,
+    0xE4, 0xEF, 0x0C, 0x99, 0x9D, 0x5B, 0x27, 0xEC, 0x42, 0x1B, 0x71, 0x3B, 0x80, 0xD0, 0x76, 0x8C,
+    0xB0, 0x51, 0xAE, 0x98, 0x44, 0x1D, 0xB1, 0x39, 0xB0, 0x68, 0x40, 0x94, 0x89, 0x2A, 0x62, 0xF7,
+    0x87, 0x94, 0x89, 0x3A, 0xD0, 0x7A, 0x46, 0x4C, 0xCA, 0x9F, 0x16, 0x1B, 0xF5, 0x82, 0x9B, 0x0A,
+    0x61, 0x17, 0xFA, 0xA9, 0x14, 0x76, 0x41, 0xBE, 0xDA, 0x70, 0xA1, 0x3C, 0x74, 0xEF, 0x54, 0x97,
+    0x66, 0xB8, 0x78, 0x12, 0xEC, 0x95, 0x09, 0x96, 0xB3, 0xD0, 0x3C, 0xEB, 0x29, 0x42, 0x82, 0xFE,
+    0xED, 0x89, 0x3E, 0xA3, 0x60, 0x53, 0x2D, 0xA5, 0x52, 0x1A, 0xBD, 0xD3, 0xE5, 0x77, 0x6B, 0xA5,
+    0x6F, 0xA2, 0xB7, 0x5F, 0xF6, 0x4D, 0x5A, 0x2E, 0x96, 0x7A, 0xE5, 0x94, 0x77, 0xEF, 0x87, 0xC5,
+    0xA8, 0x6F, 0x3A, 0xF7, 0xC1, 0x4F, 0x82, 0xD1, 0xD6, 0xE2, 0x74, 0x3D, 0x94, 0xDA, 0xFA, 0x8B,
+    0x76, 0xF7, 0xE3, 0xA6, 0x6A, 0x07, 0x8B, 0xF3, 0x7B, 0x61, 0x4A, 0x29, 0xE1, 0x9A, 0x0E, 0xF3,
+    0x4E, 0x80, 0x6F, 0x3A, 0xA8, 0x2E, 0xCF, 0xF0, 0x8F, 0xFF, 0xE1, 0xAF, 0x43, 0xC4, 0xF7, 0x99,
+    0xAF, 0x51, 0xAA, 0x7B, 0xE3, 0xA2, 0x8B, 0xB5, 0x2E, 0xAB, 0x1B, 0x7F, 0xE6, 0x52, 0x3D, 0x1B,
+    0x4D, 0x17, 0x69, 0xF5, 0xF6, 0xBF, 0x79, 0x40, 0xC4, 0xEF, 0x73, 0x0D, 0xE4, 0x6B, 0x29, 0xF1,
+    0x98, 0x8E, 0x71, 0xDA, 0xB2, 0x65, 0xAE, 0xAE, 0x94, 0x22, 0x2B, 0x1B, 0x27, 0xB3, 0x9E, 0x43,
+    0x9F, 0x83, 0x2A, 0x03, 0x8D, 0xDF, 0xDF, 0x58, 0x20, 0xCD, 0x56, 0x5A, 0xCA, 0xD7, 0xB6, 0xEF,
+    0x66, 0xF1, 0xE1, 0x86, 0x3C, 0x75, 0xC7, 0x08, 0xA3, 0xEE, 0x75, 0xED, 0x1E, 0x58, 0xF0, 0xE2,
+    0xF9, 0xF3, 0xE7, 0x5F, 0x3D, 0x54, 0x5C, 0x9A, 0x88, 0x0D, 0xD0, 0x87, 0x1C, 0x21, 0x3A, 0x15,
+    0x39, 0xE8, 0xB4, 0x5A, 0xA0, 0x55, 0xD7, 0xCE, 0x30, 0x8A, 0xB1, 0xC3, 0x68, 0x2D, 0xD7, 0x1C,
+    0x72, 0x19, 0xC1, 0x29, 0xBA, 0x69, 0xF7, 0xC0, 0x5F, 0xCB, 0x87, 0xC7, 0x2F, 0x6C, 0xE3, 0xCD,
+    0x7B, 0xDF, 0xA1, 0x0F, 0xEA, 0x3D, 0x85, 0x2E, 0x65, 0x6A, 0x7C, 0xA5, 0x04, 0x6D, 0xB2, 0x0A,
+    0x30, 0x86, 0x0C, 0x63, 0x79, 0x27, 0xB0, 0x62, 0x4C, 0xE0, 0x12, 0x47, 0xB1, 0xB2, 0x99, 0x2F,
+    0xE7, 0xA4, 0x8E, 0xEC, 0x07, 0x72, 0xBE, 0xD9, 0xFD, 0xFC, 0x2E, 0xFB, 0xFC, 0x33, 0x9D, 0xEB,
+    0x87, 0x17, 0x96, 0xFD, 0x65, 0x29, 0xFD, 0xFE, 0x4E, 0x92, 0xB4, 0xBF, 0x75, 0xA6, 0xD2, 0xD6,
+    0xE5, 0xF5, 0x73, 0xD7, 0xC3, 0xC6, 0xE9, 0x48, 0x17, 0xD3, 0x74, 0xA4, 0x8F, 0x65, 0x9B, 0x79,
+    0x23, 0xBF, 0xB7, 0xE1, 0x10, 0x97, 0xC2, 0x64, 0x5F, 0xA6, 0xF5, 0x7B, 0x0C, 0xDE, 0x45, 0x80,
+    0x54, 0x06, 0xC0, 0x84, 0xDA, 0xD3, 0xCF, 0xD6, 0xF7, 0x54, 0x9A, 0x9C, 0x12, 0xEE, 0xCB, 0x48,
+    0x13, 0x91, 0x4A, 0x1B, 0x66, 0xA2, 0x51, 0xA2, 0x9E, 0xE9, 0xEF, 0x2F, 0xD8, 0x54, 0xA8, 0x0A,
+    0x34, 0x6B, 0xB5, 0xD8, 0x09, 0xBB, 0xB6, 0xB3, 0x1B, 0x28, 0x97, 0x71, 0x10, 0xBF, 0x51, 0xDD,
+    0xDA, 0x4C, 0xE2, 0x7B, 0xED, 0xD5, 0xC5, 0xC6, 0x4A, 0x6A, 0x67, 0x37, 0x3B, 0x45, 0xBD, 0xA9,
+    0x41, 0x7A, 0xE1, 0xA0, 0x38, 0xE0, 0xCC, 0x11, 0x67, 0xA0, 0x9A, 0x21, 0x15, 0x0B, 0x38, 0x7A,
+    0x68, 0x06, 0xEB, 0xA9, 0x66, 0x13, 0x28, 0x23, 0x2B, 0x5C, 0xC4, 0x3D, 0x15, 0xDC, 0xDE, 0x07,
+    0x92, 0xF4, 0x0B, 0x8D, 0xF7, 0xB7, 0x57, 0xED, 0xD5, 0xF4, 0x3C, 0xE6, 0xB6, 0xCE, 0x74, 0xAC,
+    0xFA, 0xE5, 0x94, 0x1D, 0xB1, 0x56, 0x63, 0xA2, 0xD4, 0x8F, 0x05, 0xE3, 0x2D, 0x0D, 0x34, 0xA9,
+    0x9F, 0xA9, 0x36, 0x1B, 0x41, 0x2F, 0xAD, 0xE0, 0xA6, 0x11, 0x6C, 0x68, 0x3C, 0xFF, 0xFE, 0x9F,
+    0x00, 0x6E, 0x8F, 0xED, 0xC1, 0x39, 0x69, 0xE8, 0xDD, 0xD4, 0x4C, 0xBD, 0xA3, 0x9A, 0x7B, 0x87,
+    0x09, 0xFD, 0xC9, 0xBF, 0xFB, 0x74, 0xE8, 0x4F, 0x36, 0x97, 0x1F, 0xCE, 0x2E, 0xFD, 0x8B, 0xF1,
+    0xA4, 0xF5, 0x8C, 0x27, 0xED, 0xCC, 0x78, 0xD2, 0x2E, 0xE8, 0x64, 0xA5, 0x9B, 0x3A, 0x59, 0x4A,
+    0xFA, 0x14, 0xAD, 0x04, 0xFC, 0xD1, 0x1B, 0xC0, 0xA7, 0xF6, 0x45, 0xAF, 0xF8, 0xCA, 0x0F, 0xA1,
+    0xD5, 0x0A, 0xA3, 0x62, 0x1E, 0xC2, 0xED, 0x2B, 0x9E, 0x2A, 0x83, 0xBA, 0x89, 0x32, 0xB6, 0x01,
+    0x3B, 0x38, 0xCF, 0x93, 0x6C, 0x10, 0xCD, 0x82, 0x99, 0xED, 0x9C, 0xA9, 0xA3, 0x8D, 0xB4, 0x07,
+    0x5F, 0x3F, 0x76, 0x23, 0xAB, 0x6E, 0x27, 0x0E, 0x0E, 0x0E, 0xE8, 0xF7, 0x28, 0xE3, 0x70, 0xC4,
+    0x20, 0x5E, 0x72, 0x9C, 0x86, 0xCB, 0x5A, 0xB2, 0x47, 0x03, 0x34, 0x77, 0x3A, 0xA4, 0x44, 0x93,
+    0xA7, 0xB0, 0xF2, 0xFA, 0x5B, 0xE6, 0x78, 0x6E, 0xCF, 0x4E, 0xBF, 0x0F, 0x46, 0x3A, 0xBD, 0xBF,
+    0xCE, 0x46, 0x33, 0xF9, 0x45, 0x13, 0xA3, 0x56, 0x4C, 0x7E, 0xEF, 0xD3, 0x0A, 0x8F, 0xEC, 0x9C,
+    0xAB, 0x83, 0x83, 0x83, 0xFF, 0xE4, 0xE1, 0x28, 0x17, 0x49, 0x8A, 0xD8, 0xF8, 0x49, 0x70, 0xBF,
+    0xF4, 0x19, 0x3C, 0xAC, 0x94, 0x28, 0x73, 0xE1, 0xE7, 0x0C, 0xB5, 0x14, 0x3F, 0xDD, 0xFE, 0x8B,
+    0x1D, 0xAA, 0x71, 0xF2, 0xD4, 0xDA, 0x28, 0xA4, 0x2E, 0x13, 0x07, 0x1B, 0xCD, 0xF0, 0x9F, 0x3D,
+    0x1C, 0x98, 0x71, 0x34, 0x4D, 0xBA, 0x23, 0x8F, 0x7B, 0xA6, 0x45, 0xDB, 0xD0, 0xA6, 0xEC, 0x88,
+    0x96, 0x47, 0xD8, 0xB9, 0xCC, 0x6C, 0x68, 0xEC, 0x9D, 0xFF, 0x7C, 0x63, 0x9F, 0x2C, 0xC5, 0x51,
+    0x30, 0xE7, 0x51, 0x00, 0x61, 0x9E, 0x2F, 0x19, 0xF5, 0xCC, 0xD3, 0x66, 0xE7, 0x97, 0xE5, 0x29,
+    0x63, 0x76, 0xDF, 0xFE, 0xF4, 0x20, 0xA8, 0xDE, 0x1E, 0x7F, 0xAF, 0x8C, 0x9D, 0x0E, 0xB5, 0x14,
+    0xD6, 0xA3, 0x97, 0x2F, 0x59, 0x0F, 0x9C, 0xD1, 0xCF, 0x28, 0x0F, 0x99, 0x4A, 0xB3, 0x91, 0x94,
+    0x4A, 0xDD, 0x8F, 0x7F, 0x84, 0x42, 0x82, 0x3E, 0x38, 0x68, 0x17, 0xEB, 0xA9, 0x57, 0x13, 0x28,
+    0x45, 0x02, 0x79, 0x07, 0x2E, 0x58, 0xFD, 0xFC, 0x54, 0x32, 0xD2, 0x6D, 0x21, 0xAD, 0x9A, 0xDC,
+    0xA8, 0x0B, 0xC9, 0x7A, 0xFD, 0x73, 0x5D, 0x0E, 0xCE, 0x4B, 0xEB, 0x18, 0x5A, 0xED, 0x91, 0x4B,
+    0xCA, 0xE4, 0xAF, 0x52, 0xB9, 0x4B, 0xEE, 0x1E, 0xBE, 0xFD, 0xA8, 0x9A, 0xC9, 0x20, 0x26, 0x7C,
+    0x0D, 0xE0, 0xD3, 0x9A, 0xD9, 0xE3, 0x45, 0x20, 0x3B, 0xF8, 0x3F, 0x53, 0xE5, 0x4A, 0xBB, 0x89,
+    0x43, 0xA5, 0x07, 0x36, 0xF2, 0x7C, 0x5A, 0xF3, 0x8C, 0xCA, 0x94, 0xF9, 0xE9, 0xB0, 0xD1, 0xFF,
+    0xD2, 0x8D, 0xD1, 0xF3, 0x0F, 0xA0, 0x59, 0x8A, 0xB1, 0xC3, 0xE4, 0x61, 0x97, 0x63, 0x6A, 0x76,
+    0x8B, 0xF2, 0xB1, 0x43, 0xDF, 0x0F, 0xC0, 0x27, 0x06, 0x4C, 0x80, 0x44, 0xA1, 0xB9, 0xD4, 0x5A,
+    0x4A, 0x9D, 0xD6, 0x61, 0x74, 0xB8, 0x6B, 0xDE, 0xDE, 0x08, 0x66, 0x49, 0x28, 0x5F, 0xDC, 0x8F,
+    0x85, 0x34, 0x38, 0x2D, 0x46, 0xEA, 0x1E, 0xDB, 0x3A, 0x5E, 0x87, 0xB6, 0xFB, 0xFA, 0xF9, 0xF3,
+    0xE7, 0xBF, 0xAB, 0x9D, 0x19, 0xFD, 0x10, 0x62, 0x7F, 0xFE, 0xFC, 0xF9, 0x3F, 0x73, 0x87, 0x38,
+    0x47, 0xCE, 0x76, 0x4B, 0xFA, 0x23, 0xB3, 0xE1, 0x78, 0x56, 0x7C, 0x64, 0xE6, 0x73, 0x36, 0x4A,
+    0x37, 0xA5, 0xFB, 0x52, 0x62, 0x83, 0xC6, 0x37, 0xD2, 0x07, 0xB9, 0x0D, 0x18, 0x33, 0x3F, 0x61,
+    0x2E, 0xB5, 0x30, 0x6A, 0xA0, 0x09, 0x94, 0xEB, 0x61, 0xE0, 0xBF, 0x5D, 0x31, 0x1A, 0x50, 0xE0,
+    0xD1, 0xE7, 0x28, 0xBF, 0xBF, 0xDB, 0x20, 0x6F, 0x4E, 0x68, 0xEC, 0x8C, 0x56, 0xCE, 0x28, 0xD6,
+    0xBA, 0x4B, 0xAB, 0xA6, 0x1B, 0xB5, 0x16, 0xA7, 0x14, 0x1F, 0x91, 0xFE, 0x87, 0x33, 0x3A, 0x37,
+    0x8E, 0xA9, 0xBA, 0xF7, 0xD3, 0x30, 0x7A, 0x7B, 0x33, 0xD1, 0x67, 0x75, 0xB9, 0xBA, 0xFB, 0x61,
+    0x98, 0xD5, 0xC4, 0x7D, 0xA8, 0x55, 0x1B, 0x87, 0x8E, 0xA0, 0xFC, 0xE6, 0x36, 0xA3, 0xFB, 0x09,
+    0x77, 0xF3, 0xCC, 0x64, 0xEE, 0x2D, 0x2B, 0xFD, 0x99, 0x6F, 0xCF, 0xD5, 0xAD, 0x65, 0xA3, 0x6F,
+    0x5E, 0x9E, 0xCD, 0x7B, 0xCB, 0x1B, 0xB8, 0xE6, 0xDB, 0xB3, 0x79, 0x6F, 0xD9, 0xF2, 0xC9, 0x9D,
+    0xB4, 0xE2, 0x5E, 0xB9, 0x36, 0x99, 0xBB, 0xE9, 0x08, 0x9C, 0x56, 0x86, 0x00, 0xD4, 0x61, 0xA5,
+    0x88, 0xC9, 0xBC, 0xBB, 0x0C, 0x73, 0x9B, 0x05, 0x1B, 0x0A, 0x61, 0xD6, 0x3F, 0xD2, 0x20, 0x49,
+    0x93, 0x3B, 0x7C, 0xE7, 0x45, 0x06, 0xA5, 0x90, 0x74, 0x6E, 0xC7, 0xD6, 0x77, 0x65, 0x42, 0xB4,
+    0x79, 0xD6, 0xE5, 0x30, 0xDE, 0x78, 0x38, 0x83, 0x8C, 0x06, 0xA0, 0x18, 0xF6, 0x61, 0xAA, 0xC3,
+    0xD4, 0xC1, 0x38, 0xE4, 0xD4, 0xEF, 0x03, 0xED, 0x9A, 0xA4, 0xA0, 0x7F, 0x72, 0xF0, 0xDC, 0xCE,
+    0x7B, 0xC8, 0x32, 0xA9, 0xD8, 0xF6, 0x88, 0x9D, 0x87, 0x8D, 0x90, 0x62, 0xDE, 0xEF, 0xE7, 0x00,
+    0xE5, 0xFC, 0x7A, 0x90, 0x88, 0xBB, 0x79, 0x33, 0x56, 0x9B, 0xFB, 0xCA, 0xD2, 0x4E, 0xAB, 0x9D,
+    0x3E, 0x6F, 0xE2, 0xDF, 0xD9, 0x27, 0xAF, 0xEB, 0xF6, 0xB9, 0x6B, 0x22, 0x1F, 0xFE, 0x28, 0x6F,
+    0x5F, 0x05, 0x4E, 0xEE, 0x26, 0x81, 0x59, 0x77, 0x02, 0xA7, 0x49, 0x40, 0x7F, 0x49, 0x39, 0x20,
+    0x57, 0x17, 0x24, 0xBD, 0x79, 0x70, 0xD0, 0xEF, 0x3C, 0xB5, 0x76, 0xCA, 0x8A, 0x47, 0xB3, 0xDB,
+    0xE8, 0xFC, 0xBB, 0x87, 0x3F, 0xF6, 0x57, 0x3C, 0xE9, 0xF0, 0xA3, 0xD2, 0xBB, 0xEE, 0x5C, 0x3B,
+    0xAD, 0x76, 0xEA, 0xAF, 0x47, 0x0D, 0xFD, 0xCD, 0x9B, 0x4B, 0xEE, 0x0C, 0x97, 0x89, 0x36, 0x87,
+    0x6E, 0xA5, 0xCF, 0x1E, 0xBE, 0x57, 0xA8, 0xE0, 0x37, 0xC1, 0x4C, 0x76, 0xA0, 0x5C, 0x4C, 0xA4,
+    0x4C, 0xB8, 0xAE, 0x48, 0x54, 0xA1, 0x48, 0xD0, 0x73, 0xC4, 0x6C, 0x5E, 0xED, 0xBD, 0xF3, 0xE7,
+    0x55, 0x24, 0x18, 0x69, 0x3D, 0x7D, 0x57, 0x26, 0x5C, 0x87, 0x1B, 0xDC, 0x80, 0x99, 0x6A, 0x0F,
+    0xA7, 0x19, 0xF8, 0x7F, 0x01, 0xA5, 0x96, 0xBF, 0xEF, 0x1E, 0x47, 0x11, 0xC6, 0x3F, 0x77, 0x1B,
+    0x7B, 0xA5, 0x5C, 0xA4, 0x8D, 0x44, 0x82, 0x94, 0x1F, 0x70, 0xBD, 0x29, 0xAE, 0xA1, 0x35, 0x7B,
+    0x28, 0x45, 0x0A, 0x8A, 0xB8, 0x08, 0x14, 0x34, 0x4E, 0x0D, 0x85, 0x5B, 0x0A, 0x60, 0x2F, 0x72,
+    0x91, 0x8E, 0x37, 0x05, 0x7F, 0x40, 0x8A, 0x20, 0x59, 0x5F, 0x17, 0xE6, 0x1F, 0x48, 0x6E, 0x83,
+    0x8B, 0x14, 0x2E, 0x38, 0xA7, 0x75, 0xC1, 0x25, 0x36, 0x82, 0xD8, 0x85, 0x17, 0x7C, 0x22, 0x1B,
+    0xB3, 0x77, 0x0F, 0xC5, 0xBD, 0xAF, 0x6D, 0x28, 0x10, 0x11, 0x2B, 0xDD, 0xCC, 0x68, 0xA5, 0x9B,
+    0x9D, 0xD9, 0x79, 0xE6, 0x99, 0xA5, 0x1A, 0xC0, 0x26, 0xE8, 0x0A, 0x48, 0x18, 0x69, 0x72, 0x5F,
+    0xDD, 0x59, 0xBA, 0xAB, 0xB7, 0xF3, 0xF3, 0x66, 0x7A, 0x07, 0x33, 0xF1, 0xEC, 0xE7, 0xCC, 0xF4,
+    0xFB, 0xEE, 0xE6, 0x67, 0xD9, 0x7D, 0xF5, 0x30, 0xD5, 0x52, 0x64, 0x14, 0xB4, 0x19, 0xEC, 0x0C,
+    0xF4, 0xC0, 0xCB, 0x83, 0x97, 0x2A, 0xA9, 0x58, 0xE9, 0x83, 0x76, 0x85, 0x71, 0xA5, 0xD6, 0x4A,
+    0xF3, 0x97, 0x15, 0xFF, 0xE6, 0xCA, 0x6A, 0x57, 0xB3, 0xD8, 0xD5, 0x45, 0xBB, 0xBE, 0x84, 0x9D,
+    0xE1, 0x3C, 0xAF, 0x5C, 0xA2, 0x96, 0x72, 0x27, 0x7D, 0x32, 0xAA, 0x60, 0x14, 0x19, 0x0B, 0x9D,
+    0x62, 0x53, 0xD6, 0x5A, 0x6E, 0x1A, 0xE3, 0x47, 0x5D, 0x6A, 0x1E, 0x14, 0x3E, 0xF6, 0xD0, 0x0F,
+    0xF0, 0xC2, 0x1E, 0xF3, 0x38, 0x34, 0x5F, 0x6C, 0xAC, 0x2E, 0xBB, 0xC9, 0x4F, 0x05, 0xBD, 0x15,
+    0xCD, 0x56, 0x70, 0x1A, 0x08, 0xD9, 0x4B, 0x6F, 0x48, 0xC9, 0x4B, 0x00, 0x60, 0x80, 0xF2, 0x11,
+    0xFE, 0xCE, 0xEC, 0x72, 0xA8, 0x37, 0x9B, 0xC6, 0xC1, 0xB7, 0xC9, 0xFC, 0xB3, 0xE0, 0x45, 0xAD,
+    0x48, 0x27, 0xBD, 0x2B, 0x15, 0x27, 0x45, 0x4E, 0xCB, 0xF6, 0x80, 0x9B, 0x80, 0x6E, 0x02, 0x7C,
+    0x04, 0x04, 0x98, 0xED, 0xEC, 0xEC, 0x5A, 0x23, 0x69, 0xED, 0x24, 0xAD, 0x7E, 0x02, 0xDA, 0xC7,
+    0x67, 0x67, 0xD7, 0xAC, 0xA4, 0xB5, 0x96, 0xB4, 0x32, 0x46, 0xC0, 0x4F, 0x80, 0x8B, 0x40, 0xD3,
+    0x3F, 0xF1, 0xCA, 0x00, 0xD8, 0xDF, 0x00, 0x55, 0xCE, 0x40, 0x38, 0xCC, 0xD0, 0x66, 0x0D, 0x58,
+    0x1D, 0x44, 0xA5, 0xAC, 0x82, 0x7F, 0x78, 0x78, 0x98, 0x5C, 0xCE, 0x65, 0xBC, 0xB9, 0xB9, 0xC3,
+    0x1F, 0x8A, 0x1B, 0x72, 0x69, 0xFA, 0x77, 0xDC, 0x21, 0xBE, 0x08, 0xB9, 0x00, 0xEE, 0x10, 0xF9,
+    0x1F, 0xCC, 0x7D, 0x25, 0xC0, 0x2C, 0x80, 0x29, 0x40, 0xB5, 0x01, 0x8C, 0xFD, 0x85, 0xB3, 0xB3,
+    0x71, 0xF2, 0xDA, 0xEF, 0x49, 0x05, 0x30, 0xEB, 0x85, 0xB3, 0xB3, 0x1B, 0xE5, 0xC9, 0x5E, 0x84,
+    0x4A, 0x80, 0x59, 0x01, 0x93, 0x4F, 0xAE, 0x80, 0x6F, 0x12, 0xC5, 0x79, 0x72, 0xA9, 0xC8, 0xEE,
+    0x10, 0x17, 0x3F, 0xE7, 0xD2, 0x4D, 0x3A, 0x1C, 0x6E, 0x15, 0xB3, 0xE5, 0x4D, 0x38, 0x1D, 0x34,
+    0xE0, 0xB3, 0x66, 0x2A, 0x1D, 0x32, 0xD8, 0xBC, 0x01, 0xED, 0x61, 0x00, 0x7E, 0x31, 0x01, 0x3C,
+    0xF7, 0x24, 0x8D, 0xEF, 0xE0, 0x80, 0x95, 0x15, 0x9A, 0xC5, 0x14, 0xF0, 0xD1, 0x66, 0x4C, 0xA1,
+    0x59, 0xF0, 0xF7, 0xCF, 0x6E, 0xA4, 0x5A, 0x92, 0x52, 0x27, 0x49, 0x49, 0x3D, 0xF8, 0xDB, 0x3A,
+    0x3B, 0xBB, 0xAE, 0x4A, 0x92, 0xE6, 0x5A, 0x92, 0xA8, 0x45, 0x9B, 0x30, 0x2B, 0xEA, 0x31, 0xC9,
+    0x64, 0x68, 0x7A, 0xF3, 0xF4, 0xA6, 0x7A, 0xA0, 0x03, 0x9A, 0x02, 0x46, 0x0B, 0x48, 0x33, 0xE1,
+    0x91, 0x26, 0xBF, 0x79, 0xDD, 0xD4, 0xDD, 0x07, 0xA5, 0xF9, 0xF8, 0x62, 0x8B, 0xB9, 0x3B, 0xC1,
+    0x0F, 0x2E, 0xF2, 0xD4, 0xF8, 0xD6, 0xDD, 0xE9, 0x52, 0xBB, 0x5D, 0xF4, 0x57, 0x75, 0xF7, 0x61,
+    0x69, 0x37, 0xAF, 0xBE, 0xFB, 0x4A, 0x03, 0x41, 0x91, 0x5A, 0x33, 0xD8, 0x0C, 0x7C, 0xF7, 0x74,
+    0xCC, 0x0A, 0x56, 0xE0, 0xB7, 0xBD, 0x24, 0x36, 0x41, 0x1B, 0x21, 0x70, 0xE3, 0x76, 0x6E, 0xF5,
+    0xE0, 0x73, 0x49, 0x6F, 0xAD, 0x61, 0x0D, 0xD1, 0xFF, 0x6D, 0x25, 0xDC, 0x4A, 0xA8, 0x8B, 0x26,
+    0x87, 0xA1, 0xFB, 0x44, 0x0F, 0x64, 0xA4, 0xC5, 0x48, 0xD1, 0xAA, 0x50, 0x8F, 0xC3, 0xEE, 0xF1,
+    0x1C, 0x54, 0xE3, 0xBD, 0x6A, 0xA1, 0x92, 0x72, 0x88, 0x04, 0x49, 0x89, 0x56, 0xD7, 0x55, 0x30,
+    0xEA, 0x9D, 0x60, 0x8C, 0x8C, 0x09, 0x97, 0x69, 0xD5, 0x57, 0xC2, 0xAA, 0xD0, 0xA5, 0x4A, 0x63,
+    0x34, 0x1B, 0xE1, 0xD3, 0x82, 0x9F, 0xDB, 0xE4, 0xA3, 0x59, 0x6D, 0x31, 0x2B, 0xFE, 0xB6, 0x7A,
+    0x3F, 0x99, 0x2D, 0x4C, 0xB6, 0xE0, 0xB5, 0x30, 0xC6, 0x5A, 0x2B, 0x6D, 0xA1, 0xD3, 0x74, 0x59,
+    0xB1, 0x92, 0xA4, 0x4C, 0x2B, 0x49, 0xBD, 0x95, 0xA4, 0x54, 0x49, 0x52, 0x21, 0xDC, 0x92, 0x84,
+    0x49, 0xE7, 0xB5, 0xF5, 0xBC, 0xC0, 0xBF, 0xAD, 0x1F, 0x03, 0xB5, 0x7A, 0x30, 0x8A, 0xD0, 0x68,
+    0x02, 0xA7, 0x19, 0x5A, 0x25, 0xF0, 0x77, 0x32, 0x84, 0x4F, 0x0B, 0xE8, 0xEA, 0x46, 0xA5, 0x5A,
+    0x18, 0xA1, 0xC1, 0xAE, 0x28, 0xBA, 0x42, 0x98, 0xDA, 0x8C, 0x4F, 0x3E, 0xD1, 0x2D, 0x61, 0xC6,
+    0x95, 0x51, 0xD2, 0x7F, 0x0A, 0x80, 0x4E, 0xD2, 0x2D, 0x49, 0x7F, 0x97, 0x54, 0x9A, 0xC5, 0xA5,
+    0x7A, 0x35, 0x85, 0xB1, 0x17, 0xDD, 0xE4, 0xE3, 0x37, 0xDC, 0x78, 0x75, 0xB8, 0x30, 0xD8, 0xA5,
+    0xF9, 0xBF, 0x7C, 0x74, 0x93, 0x8F, 0xA3, 0xA4, 0x53, 0x60, 0x69, 0x0F, 0xF2, 0x81, 0xF4, 0x58,
+    0xDA, 0x42, 0xC4, 0x16, 0x18, 0x23, 0x2E, 0x83, 0x7A, 0x5C, 0xA2, 0x2A, 0xE0, 0x21, 0x0C, 0x84,
+    0x81, 0x31, 0xA2, 0xC8, 0x28, 0xDD, 0x78, 0xF2, 0x0F, 0x2F, 0xFF, 0x6C, 0xF0, 0xD2, 0x0F, 0xA5,
+    0xCD, 0xE9, 0xFE, 0x35, 0x30, 0x52, 0x04, 0xAF, 0x05, 0xAC, 0x1E, 0x03, 0x1B, 0x27, 0xF6, 0xAA,
+    0x0A, 0x27, 0xFA, 0xDA, 0x7B, 0x38, 0xF4, 0x80, 0x4B, 0x1C, 0xF9, 0x8C, 0x76, 0x06, 0xCC, 0xC6,
+    0x91, 0xB2, 0xBE, 0x6F, 0x0B, 0x98, 0x59, 0x11, 0xFC, 0x9F, 0x32, 0x54, 0x52, 0x0F, 0x4E, 0x09,
+    0x08, 0x02, 0x8C, 0x66, 0xA0, 0x5D, 0x9F, 0xD6, 0xF5, 0x15, 0x5E, 0xED, 0x2B, 0x65, 0x5F, 0x2A,
+    0xE9, 0xA1, 0xA2, 0x24, 0xE5, 0x30, 0x84, 0x39, 0xB4, 0xD1, 0xCC, 0xF6, 0xCE, 0xCC, 0x52, 0xFD,
+    0x23, 0x73, 0x91, 0x5F, 0x05, 0xAE, 0x4C, 0xE1, 0xB2, 0x24, 0xDD, 0x94, 0xA4, 0x14, 0x24, 0x2D,
+    0x56, 0x49, 0x99, 0x6F, 0x0F, 0xCD, 0x3D, 0x80, 0xE7, 0xEF, 0x01, 0xA1, 0x00, 0x2A, 0x60, 0xD6,
+    0xD7, 0x8F, 0x61, 0xDB, 0x05, 0x68, 0xD2, 0x49, 0xB8, 0x04, 0xB8, 0xF9, 0x24, 0xDA, 0x89, 0xBD,
+    0x87, 0xE8, 0xE2, 0x29, 0xDB, 0x5D, 0x0C, 0x27, 0x11, 0x7A, 0x60, 0x84, 0xFA, 0x5D, 0x41, 0xA7,
+    0x0D, 0x46, 0xAD, 0xE0, 0x55, 0x8E, 0xD9, 0x55, 0xA7, 0x66, 0xC2, 0x4F, 0x7A, 0x73, 0x6B, 0xF3,
+    0xF8, 0xE8, 0xE9, 0x38, 0x70, 0x8B, 0xBF, 0xAD, 0xF7, 0xB6, 0xAE, 0x28, 0x55, 0x97, 0xC0, 0x97,
+    0xE6, 0x0B, 0x95, 0xEE, 0x8F, 0x8F, 0xCA, 0xE8, 0xAF, 0x6A, 0x09, 0x46, 0x91, 0xEA, 0x43, 0xDE,
+    0x06, 0xA7, 0x3A, 0x8F, 0xFA, 0xD1, 0xA3, 0x3C, 0x8E, 0x87, 0x79, 0x2C, 0xE7, 0x87, 0x30, 0x1D,
+    0x5D, 0x9C, 0x7F, 0x1F, 0xF0, 0x27, 0x2E, 0x6E, 0xE3, 0x4E, 0x04, 0x7B, 0x3A, 0xE1, 0x6D, 0x73,
+    0xE2, 0xAE, 0xCF, 0x25, 0xE9, 0x93, 0x7E, 0xDF, 0xEE, 0xC1, 0x96, 0x73, 0xBD, 0x97, 0x64, 0x24,
+    0x6D, 0xED, 0xDE, 0x63, 0xC3, 0x91, 0xCB, 0xBB, 0xF9, 0x58, 0xC4, 0x66, 0x01, 0x2E, 0x9C, 0xE2,
+    0x7F, 0x11, 0xE0, 0x97, 0x40, 0x2D, 0xA0, 0x51, 0x84, 0xA0, 0x69, 0xAF, 0x64, 0xA3, 0x15, 0x3A,
+    0x2D, 0xD0, 0xEA, 0x7D, 0xB0, 0xBA, 0x07, 0xB5, 0xF4, 0x35, 0x5C, 0x91, 0xB6, 0x9E, 0x56, 0x2A,
+    0xF0, 0x9A, 0x04, 0xBC, 0xA6, 0x08, 0xD8, 0x64, 0xB6, 0xDF, 0xF2, 0x5C, 0x2D, 0xE9, 0x77, 0x48,
+    0xD2, 0x5C, 0xFD, 0x74, 0x6F, 0xB5, 0x73, 0xD7, 0x8F, 0x83, 0xAD, 0xED, 0x81, 0x4A, 0x3D, 0xD0,
+    0xA9, 0x07, 0x46, 0x0D, 0xCF, 0xC8, 0xE9, 0x19, 0x09, 0xD4, 0x4A, 0xC7, 0x13, 0x82, 0x94, 0x6B,
+    0x49, 0xF7, 0x08, 0xD2, 0x80, 0xD5, 0x06, 0x84, 0x05, 0xB0, 0x13, 0xBC, 0x04, 0xD5, 0xCF, 0x15,
+    0xCF, 0xDD, 0x90, 0xD6, 0xFD, 0xE0, 0x56, 0xFA, 0xB2, 0x37, 0x5F, 0x5E, 0x7A, 0x82, 0xBC, 0xB6,
+    0xA0, 0xA9, 0x15, 0x5A, 0x1A, 0xC5, 0xB0, 0x9A, 0x4C, 0x17, 0x29, 0xB8, 0x09, 0x8F, 0x59, 0x2A,
+    0x49, 0x5A, 0x83, 0x24, 0x5D, 0x96, 0xA4, 0xCF, 0xC6, 0xFB, 0xD7, 0xB7, 0x0F, 0xDB, 0x19, 0x61,
+    0x33, 0x3E, 0x56, 0x1B, 0x2E, 0x11, 0xA2, 0x29, 0xB4, 0x09, 0x61, 0x0B, 0x3E, 0x56, 0xC2, 0x25,
+    0xC6, 0x68, 0x76, 0x7E, 0xA4, 0x29, 0x84, 0xA9, 0x16, 0xED, 0x02, 0xF0, 0x72, 0x7F, 0xBC, 0xFA,
+    0x10, 0xAD, 0x9A, 0x52, 0x29, 0x29, 0x76, 0x72, 0xAB, 0xC9, 0xA7, 0xE2, 0x26, 0xB0, 0x7B, 0x6E,
+    0xC9, 0xBF, 0x27, 0x99, 0xE5, 0x7B, 0xDB, 0x07, 0xBE, 0x0F, 0x83, 0x59, 0x6C, 0xE6, 0x68, 0x14,
+    0x7C, 0x1F, 0xE2, 0x6E, 0x0C, 0x21, 0x9A, 0xDC, 0x14, 0xFC, 0x30, 0x46, 0x53, 0x9A, 0x42, 0x88,
+    0x63, 0xB4, 0x05, 0x68, 0x66, 0xDA, 0x62, 0x32, 0xAD, 0xD8, 0x68, 0x14, 0x7D, 0x6F, 0x32, 0x6E,
+    0xA2, 0x60, 0x16, 0x3C, 0xD5, 0x5A, 0x49, 0x31, 0x10, 0x94, 0xDA, 0xD8, 0xAA, 0xD8, 0x54, 0x8F,
+    0xF7, 0xAB, 0x42, 0x3B, 0x33, 0x62, 0x33, 0x5D, 0xAC, 0x36, 0x9A, 0x44, 0x88, 0x75, 0xA1, 0x4D,
+    0x8C, 0xD8, 0x42, 0xF7, 0x34, 0xBF, 0xF5, 0x52, 0x97, 0x50, 0x69, 0x0A, 0x5E, 0xB5, 0x70, 0xDA,
+    0x81, 0x5A, 0xBD, 0xBD, 0x3F, 0x7F, 0x32, 0xEC, 0x93, 0x70, 0x9C, 0xAD, 0x5C, 0xA9, 0x35, 0xB7,
+    0x72, 0xC5, 0x68, 0xF6, 0x72, 0xC5, 0x26, 0x7C, 0x0F, 0x4D, 0x22, 0xEC, 0x81, 0x06, 0x60, 0x94,
+    0xA4, 0xA3, 0x32, 0xCB, 0x51, 0x5D, 0x79, 0x7C, 0xA6, 0xFB, 0x66, 0x69, 0x12, 0x61, 0x30, 0x8B,
+    0x3B, 0xAA, 0x85, 0xF1, 0xBF, 0x2A, 0x7B, 0x54, 0xD9, 0x2D, 0x8C, 0xD1, 0x66, 0x97, 0x19, 0xA3,
+    0x2D, 0x2E, 0xA3, 0xD8, 0x94, 0xBD, 0xF6, 0x81, 0x4A, 0xD1, 0xAD, 0x75, 0x61, 0x07, 0x40, 0x62,
+    0x2C, 0x56, 0x53, 0x37, 0xEC, 0x28, 0xD8, 0x70, 0x91, 0x15, 0x93, 0xF1, 0x98, 0x05, 0x37, 0xB7,
+    0x92, 0x34, 0xF9, 0x21, 0x48, 0x52, 0xBF, 0xEE, 0xE0, 0x30, 0x4B, 0x3D, 0xDE, 0xBF, 0xBE, 0x7D,
+    0xE8, 0xA6, 0x1D, 0x0C, 0xBE, 0xDF, 0x91, 0xB1, 0xB2, 0xC3, 0x64, 0x39, 0xC2, 0x63, 0xDA, 0xAF,
+    0x2D, 0x1C, 0x31, 0x72, 0x02, 0xCC, 0x11, 0x28, 0xED, 0x9F, 0xF7, 0x87, 0xC5, 0x58, 0x8E, 0x68,
+    0x59, 0xBA, 0x54, 0xA9, 0x6F, 0x34, 0x3F, 0x33, 0xFD, 0x5E, 0xDF, 0x11, 0x1B, 0x01, 0xEA, 0x3D,
+    0x87, 0x2E, 0x62, 0xF5, 0x41, 0x5D, 0x30, 0xD2, 0x9B, 0x52, 0x0C, 0x3F, 0x49, 0x52, 0x69, 0x26,
+    0x5A, 0x69, 0xFA, 0x35, 0x98, 0x82, 0xF9, 0x1A, 0x7C, 0xA4, 0xD3, 0x60, 0x0A, 0x8C, 0xEA, 0xFD,
+    0x00, 0xE3, 0x8E, 0xB7, 0x2E, 0xF9, 0x81, 0x17, 0xD1, 0x1B, 0x19, 0x33, 0xB7, 0x8B, 0xD7, 0x20,
+    0xC9, 0xA8, 0x78, 0x69, 0xF6, 0xBA, 0x29, 0xE5, 0x5A, 0x6B, 0x3D, 0xFE, 0xF5, 0x69, 0x0C, 0xFF,
+    0x02,
 };
 
 static const EpdGlyph opendyslexic_12_boldGlyphs[] = {
@@ -1914,7 +1899,7 @@ static const EpdGlyph opendyslexic_12_boldGlyphs[] = {
     { 5, 23, 10, 2, 18, 29, 7352 }, // |
     { 12, 26, 14, 1, 20, 78, 7381 }, // }
     { 10, 6, 12, 1, 20, 15, 7459 }, // ~
-    { 0, 0, 22, 0, 0, 0, 0 }, //  
+    { 0, 0, 22, 0, 0, 0, 7474 }, //  
     { 8, 32, 19, 5, 28, 64, 0 }, // ¡
     { 13, 24, 20, 3, 20, 78, 64 }, // ¢
     { 16, 23, 17, 1, 22, 92, 142 }, // £
@@ -1925,625 +1910,631 @@ static const EpdGlyph opendyslexic_12_boldGlyphs[] = {
     { 13, 6, 13, 0, 21, 20, 499 }, // ¨
     { 12, 11, 17, 2, 24, 33, 519 }, // ©
     { 9, 9, 16, 5, 19, 21, 552 }, // ª
-    { 14, 14, 13, 0, 13, 49, 573 }, // «
-    { 13, 9, 15, 1, 10, 30, 622 }, // ¬
-    { 13, 3, 15, 1, 9, 10, 652 }, // ­
-    { 12, 12, 17, 2, 28, 36, 662 }, // ®
-    { 11, 4, 13, 1, 19, 11, 698 }, // ¯
-    { 12, 11, 17, 2, 19, 33, 709 }, // °
-    { 15, 16, 16, 0, 14, 60, 742 }, // ±
-    { 8, 8, 8, 0, 20, 16, 802 }, // ²
-    { 8, 10, 8, 0, 21, 20, 818 }, // ³
-    { 7, 6, 7, 0, 19, 11, 838 }, // ´
-    { 16, 19, 21, 2, 15, 76, 849 }, // µ
-    { 14, 22, 19, 2, 18, 77, 925 }, // ¶
-    { 6, 6, 7, 0, 12, 9, 1002 }, // ·
-    { 7, 8, 8, 1, 1, 14, 1011 }, // ¸
-    { 7, 9, 8, 0, 21, 16, 1025 }, // ¹
-    { 9, 8, 17, 5, 18, 18, 1041 }, // º
-    { 14, 14, 19, 2, 13, 49, 1059 }, // »
-    { 23, 23, 31, 4, 21, 133, 1108 }, // ¼
-    { 25, 23, 31, 4, 21, 144, 1241 }, // ½
-    { 23, 23, 31, 4, 21, 133, 1385 }, // ¾
-    { 16, 32, 17, 0, 18, 128, 1518 }, // ¿
-    { 22, 28, 24, 1, 28, 154, 1646 }, // À
-    { 22, 32, 24, 1, 32, 176, 1800 }, // Á
-    { 22, 30, 24, 1, 30, 165, 1976 }, // Â
-    { 22, 29, 24, 1, 29, 160, 2141 }, // Ã
-    { 22, 30, 24, 1, 30, 165, 2301 }, // Ä
-    { 22, 30, 24, 1, 30, 165, 2466 }, // Å
-    { 32, 22, 34, 1, 21, 176, 2631 }, // Æ
-    { 18, 30, 25, 3, 23, 135, 2807 }, // Ç
-    { 15, 29, 23, 4, 29, 109, 2942 }, // È
-    { 15, 33, 23, 4, 33, 124, 3051 }, // É
-    { 15, 31, 23, 4, 31, 117, 3175 }, // Ê
-    { 15, 31, 23, 4, 31, 117, 3292 }, // Ë
-    { 11, 30, 14, 0, 30, 83, 3409 }, // Ì
-    { 6, 34, 14, 4, 34, 51, 3492 }, // Í
-    { 14, 32, 14, 0, 32, 112, 3543 }, // Î
-    { 13, 32, 14, 0, 32, 104, 3655 }, // Ï
-    { 24, 21, 26, -1, 21, 126, 3759 }, // Ð
-    { 18, 29, 26, 4, 29, 131, 3885 }, // Ñ
-    { 21, 31, 28, 4, 29, 163, 4016 }, // Ò
-    { 21, 35, 28, 4, 33, 184, 4179 }, // Ó
-    { 21, 33, 28, 4, 31, 174, 4363 }, // Ô
-    { 21, 32, 28, 4, 30, 168, 4537 }, // Õ
-    { 21, 33, 28, 4, 31, 174, 4705 }, // Ö
-    { 15, 9, 15, 0, 11, 34, 4879 }, // ×
-    { 36, 50, 28, -4, 36, 450, 4913 }, // Ø
-    { 18, 31, 26, 4, 30, 140, 5363 }, // Ù
-    { 18, 35, 26, 4, 34, 158, 5503 }, // Ú
-    { 18, 33, 26, 4, 32, 149, 5661 }, // Û
-    { 18, 32, 26, 4, 31, 144, 5810 }, // Ü
-    { 19, 36, 27, 4, 36, 171, 5954 }, // Ý
-    { 12, 20, 14, 1, 20, 60, 6125 }, // Þ
-    { 15, 22, 17, 1, 20, 83, 6185 }, // ß
-    { 15, 23, 21, 3, 22, 87, 6268 }, // à
-    { 15, 27, 21, 3, 26, 102, 6355 }, // á
-    { 15, 25, 21, 3, 24, 94, 6457 }, // â
-    { 15, 23, 21, 3, 22, 87, 6551 }, // ã
-    { 15, 25, 21, 3, 24, 94, 6638 }, // ä
-    { 15, 25, 21, 3, 24, 94, 6732 }, // å
-    { 25, 17, 31, 3, 16, 107, 6826 }, // æ
-    { 13, 22, 20, 3, 16, 72, 6933 }, // ç
-    { 15, 26, 21, 3, 25, 98, 7005 }, // è
-    { 15, 31, 21, 3, 30, 117, 7103 }, // é
-    { 15, 28, 21, 3, 27, 105, 7220 }, // ê
-    { 15, 28, 21, 3, 27, 105, 7325 }, // ë
-    { 10, 22, 12, 0, 22, 55, 7430 }, // ì
-    { 6, 26, 12, 3, 26, 39, 7485 }, // í
-    { 14, 23, 12, -1, 23, 81, 7524 }, // î
-    { 12, 22, 12, 0, 22, 66, 7605 }, // ï
-    { 20, 22, 17, -1, 21, 110, 7671 }, // ð
-    { 15, 24, 22, 3, 24, 90, 7781 }, // ñ
-    { 15, 23, 22, 3, 22, 87, 7871 }, // ò
-    { 15, 27, 22, 3, 26, 102, 7958 }, // ó
-    { 15, 25, 22, 3, 24, 94, 8060 }, // ô
-    { 15, 24, 22, 3, 23, 90, 8154 }, // õ
-    { 15, 25, 22, 3, 24, 94, 8244 }, // ö
-    { 19, 18, 22, 2, 17, 86, 8338 }, // ÷
-    { 17, 44, 22, 2, 30, 187, 8424 }, // ø
-    { 15, 24, 21, 3, 23, 90, 8611 }, // ù
-    { 15, 28, 21, 3, 27, 105, 8701 }, // ú
-    { 15, 25, 21, 3, 24, 94, 8806 }, // û
-    { 15, 25, 21, 3, 24, 94, 8900 }, // ü
-    { 17, 36, 23, 3, 29, 153, 8994 }, // ý
-    { 12, 26, 14, 1, 21, 78, 9147 }, // þ
-    { 17, 33, 23, 3, 26, 141, 9225 }, // ÿ
-    { 22, 29, 24, 1, 29, 160, 0 }, // Ā
-    { 15, 25, 21, 3, 24, 94, 160 }, // ā
-    { 22, 30, 24, 1, 30, 165, 254 }, // Ă
-    { 15, 25, 21, 3, 24, 94, 419 }, // ă
-    { 22, 28, 24, 1, 21, 154, 513 }, // Ą
-    { 17, 24, 21, 3, 16, 102, 667 }, // ą
-    { 18, 31, 25, 3, 31, 140, 769 }, // Ć
-    { 13, 21, 20, 3, 21, 69, 909 }, // ć
-    { 18, 32, 25, 3, 32, 144, 978 }, // Ĉ
-    { 14, 24, 20, 3, 24, 84, 1122 }, // ĉ
-    { 18, 31, 25, 3, 31, 140, 1206 }, // Ċ
-    { 13, 22, 20, 3, 22, 72, 1346 }, // ċ
-    { 18, 33, 25, 3, 33, 149, 1418 }, // Č
-    { 14, 24, 20, 3, 24, 84, 1567 }, // č
-    { 19, 31, 26, 4, 31, 148, 1651 }, // Ď
-    { 20, 22, 22, 3, 21, 110, 1799 }, // ď
-    { 24, 21, 26, -1, 21, 126, 1909 }, // Đ
-    { 20, 22, 22, 3, 21, 110, 2035 }, // đ
-    { 15, 30, 23, 4, 30, 113, 2145 }, // Ē
-    { 15, 28, 21, 3, 27, 105, 2258 }, // ē
-    { 15, 31, 23, 4, 31, 117, 2363 }, // Ĕ
-    { 15, 28, 21, 3, 27, 105, 2480 }, // ĕ
-    { 15, 31, 23, 4, 31, 117, 2585 }, // Ė
-    { 15, 28, 21, 3, 27, 105, 2702 }, // ė
-    { 15, 28, 23, 4, 21, 105, 2807 }, // Ę
-    { 15, 25, 21, 3, 15, 94, 2912 }, // ę
-    { 15, 33, 23, 4, 33, 124, 3006 }, // Ě
-    { 15, 30, 21, 3, 29, 113, 3130 }, // ě
-    { 21, 34, 29, 4, 33, 179, 3243 }, // Ĝ
-    { 16, 34, 22, 3, 26, 136, 3422 }, // ĝ
-    { 21, 33, 29, 4, 32, 174, 3558 }, // Ğ
-    { 15, 33, 22, 3, 25, 124, 3732 }, // ğ
-    { 21, 33, 29, 4, 32, 174, 3856 }, // Ġ
-    { 15, 33, 22, 3, 25, 124, 4030 }, // ġ
-    { 21, 38, 29, 4, 37, 200, 4154 }, // Ģ
-    { 15, 34, 22, 3, 26, 128, 4354 }, // ģ
-    { 19, 31, 26, 4, 31, 148, 4482 }, // Ĥ
-    { 19, 30, 22, 0, 30, 143, 4630 }, // ĥ
-    { 22, 21, 26, 2, 21, 116, 4773 }, // Ħ
-    { 19, 21, 22, 0, 21, 100, 4889 }, // ħ
-    { 11, 32, 14, 1, 32, 88, 4989 }, // Ĩ
-    { 10, 23, 12, 1, 23, 58, 5077 }, // ĩ
-    { 14, 31, 14, -1, 31, 109, 5135 }, // Ī
-    { 15, 23, 12, -2, 23, 87, 5244 }, // ī
-    { 8, 28, 14, 2, 21, 56, 5331 }, // Į
-    { 8, 31, 12, 2, 23, 62, 5387 }, // į
-    { 7, 32, 14, 3, 32, 56, 5449 }, // İ
-    { 6, 14, 12, 3, 14, 21, 5505 }, // ı
-    { 20, 31, 40, 9, 21, 155, 5526 }, // Ĳ
-    { 15, 30, 12, 3, 24, 113, 5681 }, // ĳ
-    { 17, 37, 23, 4, 31, 158, 5794 }, // Ĵ
-    { 14, 32, 16, 3, 25, 112, 5952 }, // ĵ
-    { 19, 34, 26, 4, 34, 162, 6064 }, // Ķ
-    { 16, 34, 23, 3, 21, 136, 6226 }, // ķ
-    { 12, 14, 16, 2, 14, 42, 6362 }, // ĸ
-    { 15, 28, 22, 4, 28, 105, 6404 }, // Ĺ
-    { 9, 32, 15, 3, 32, 72, 6509 }, // ĺ
-    { 17, 33, 22, 2, 33, 141, 6581 }, // Ļ
-    { 10, 35, 15, 2, 21, 88, 6722 }, // ļ
-    { 15, 21, 22, 4, 21, 79, 6810 }, // Ľ
-    { 12, 25, 15, 3, 25, 75, 6889 }, // ľ
-    { 15, 21, 22, 4, 21, 79, 6964 }, // Ŀ
-    { 12, 21, 15, 3, 21, 63, 7043 }, // ŀ
-    { 27, 37, 22, -7, 29, 250, 7106 }, // Ł
-    { 19, 21, 15, -5, 21, 100, 7356 }, // ł
-    { 18, 30, 26, 4, 30, 135, 7456 }, // Ń
-    { 15, 25, 22, 3, 25, 94, 7591 }, // ń
-    { 18, 31, 26, 4, 21, 140, 7685 }, // Ņ
-    { 15, 26, 22, 3, 16, 98, 7825 }, // ņ
-    { 18, 32, 26, 4, 32, 144, 7923 }, // Ň
-    { 16, 27, 22, 3, 27, 108, 8067 }, // ň
-    { 15, 26, 22, 3, 26, 98, 8175 }, // ŉ
-    { 18, 27, 26, 4, 21, 122, 8273 }, // Ŋ
-    { 15, 21, 22, 3, 16, 79, 8395 }, // ŋ
-    { 21, 32, 28, 4, 30, 168, 8474 }, // Ō
-    { 15, 25, 22, 3, 24, 94, 8642 }, // ō
-    { 21, 33, 28, 4, 31, 174, 8736 }, // Ŏ
-    { 15, 25, 22, 3, 24, 94, 8910 }, // ŏ
-    { 23, 32, 28, 4, 30, 184, 9004 }, // Ő
-    { 22, 24, 22, 1, 23, 132, 9188 }, // ő
-    { 29, 24, 30, 4, 22, 174, 9320 }, // Œ
-    { 26, 16, 27, 3, 15, 104, 9494 }, // œ
-    { 17, 30, 24, 4, 29, 128, 9598 }, // Ŕ
-    { 12, 22, 18, 3, 22, 66, 9726 }, // ŕ
-    { 17, 35, 24, 4, 34, 149, 9792 }, // Ŗ
-    { 12, 27, 18, 3, 27, 81, 9941 }, // ŗ
-    { 17, 32, 24, 4, 31, 136, 10022 }, // Ř
-    { 14, 24, 18, 1, 24, 84, 10158 }, // ř
-    { 19, 31, 27, 4, 29, 148, 10242 }, // Ś
-    { 15, 24, 22, 3, 22, 90, 10390 }, // ś
-    { 19, 32, 27, 4, 30, 152, 10480 }, // Ŝ
-    { 15, 26, 22, 3, 24, 98, 10632 }, // ŝ
-    { 19, 28, 27, 4, 21, 133, 10730 }, // Ş
-    { 15, 24, 22, 3, 16, 90, 10863 }, // ş
-    { 19, 33, 27, 4, 31, 157, 10953 }, // Š
-    { 15, 26, 22, 3, 24, 98, 11110 }, // š
-    { 19, 29, 26, 4, 22, 138, 11208 }, // Ţ
-    { 13, 26, 20, 3, 20, 85, 11346 }, // ţ
-    { 19, 32, 26, 4, 32, 152, 11431 }, // Ť
-    { 17, 24, 20, 3, 23, 102, 11583 }, // ť
-    { 19, 22, 26, 4, 22, 105, 11685 }, // Ŧ
-    { 14, 21, 20, 2, 20, 74, 11790 }, // ŧ
-    { 18, 33, 26, 4, 32, 149, 11864 }, // Ũ
-    { 15, 25, 21, 3, 24, 94, 12013 }, // ũ
-    { 18, 32, 26, 4, 31, 144, 12107 }, // Ū
-    { 15, 25, 21, 3, 24, 94, 12251 }, // ū
-    { 18, 32, 26, 4, 31, 144, 12345 }, // Ŭ
-    { 15, 25, 21, 3, 24, 94, 12489 }, // ŭ
-    { 18, 34, 26, 4, 33, 153, 12583 }, // Ů
-    { 15, 27, 21, 3, 26, 102, 12736 }, // ů
-    { 22, 31, 26, 3, 30, 171, 12838 }, // Ű
-    { 22, 24, 21, 1, 23, 132, 13009 }, // ű
-    { 18, 28, 26, 4, 21, 126, 13141 }, // Ų
-    { 15, 23, 21, 3, 15, 87, 13267 }, // ų
-    { 28, 31, 36, 4, 31, 217, 13354 }, // Ŵ
-    { 21, 27, 28, 3, 26, 142, 13571 }, // ŵ
-    { 19, 33, 27, 4, 33, 157, 13713 }, // Ŷ
-    { 17, 34, 23, 3, 27, 145, 13870 }, // ŷ
-    { 19, 33, 27, 4, 33, 157, 14015 }, // Ÿ
-    { 20, 28, 27, 4, 28, 140, 14172 }, // Ź
-    { 16, 24, 22, 3, 24, 96, 14312 }, // ź
-    { 20, 29, 27, 4, 29, 145, 14408 }, // Ż
-    { 16, 24, 22, 3, 24, 96, 14553 }, // ż
-    { 20, 31, 27, 4, 31, 155, 14649 }, // Ž
-    { 16, 26, 22, 3, 26, 104, 14804 }, // ž
-    { 10, 21, 15, 2, 21, 53, 14908 }, // ſ
-    { 11, 6, 0, 0, 20, 17, 0 }, // ̀
-    { 7, 6, 0, 0, 19, 11, 17 }, // ́
-    { 14, 7, 0, 0, 1, 25, 28 }, // ̂
-    { 10, 6, 0, 1, 20, 15, 53 }, // ̃
-    { 14, 4, 0, 1, 17, 14, 68 }, // ̄
-    { 18, 4, 0, 0, 23, 18, 82 }, // ̅
-    { 13, 5, 0, 0, 18, 17, 100 }, // ̆
-    { 7, 6, 0, 3, 21, 11, 117 }, // ̇
-    { 12, 5, 0, 0, 18, 15, 128 }, // ̈
-    { 5, 6, 0, 5, 16, 8, 143 }, // ̉
-    { 7, 7, 0, 1, 20, 13, 151 }, // ̊
-    { 22, 6, 0, 0, 20, 33, 164 }, // ̋
-    { 14, 7, 0, 0, 20, 25, 197 }, // ̌
-    { 22, 6, 0, -6, 20, 33, 222 }, // ̏
-    { 8, 9, 0, 0, 20, 18, 255 }, // ̒
-    { 9, 9, 0, 0, 19, 21, 273 }, // ̓
-    { 9, 9, 0, -1, 19, 21, 294 }, // ̔
-    { 6, 7, 0, 1, 0, 11, 315 }, // ̘
-    { 6, 7, 0, 1, 0, 11, 326 }, // ̙
-    { 12, 8, 0, 1, 21, 24, 337 }, // ̚
-    { 6, 8, 0, 0, 17, 12, 361 }, // ̛
-    { 4, 8, 0, 1, 0, 8, 373 }, // ̜
-    { 7, 6, 0, 1, 4, 11, 381 }, // ̝
-    { 7, 6, 0, 1, 0, 11, 392 }, // ̞
-    { 6, 6, 0, 1, -2, 9, 403 }, // ̟
-    { 15, 4, 0, 0, -3, 15, 412 }, // ̠
-    { 7, 6, 0, 0, 2, 11, 427 }, // ̣
-    { 12, 5, 0, 0, -2, 15, 438 }, // ̤
-    { 7, 7, 0, 1, 20, 13, 453 }, // ̥
-    { 8, 9, 0, 0, 4, 18, 466 }, // ̦
-    { 7, 8, 0, 1, 1, 14, 484 }, // ̧
-    { 8, 9, 0, 1, 1, 18, 498 }, // ̨
-    { 5, 9, 0, 1, 0, 12, 516 }, // ̩
-    { 11, 6, 0, 0, 0, 17, 528 }, // ̪
-    { 16, 8, 0, -1, 1, 32, 545 }, // ̬
-    { 16, 8, 0, -1, 1, 32, 577 }, // ̭
-    { 11, 6, 0, 1, 21, 17, 609 }, // ̰
-    { 13, 4, 0, 1, 21, 13, 626 }, // ̱
-    { 13, 4, 0, 0, -1, 13, 639 }, // ̲
-    { 11, 6, 0, 1, 21, 17, 652 }, // ̴
-    { 14, 3, 0, 0, 9, 11, 669 }, // ̵
-    { 5, 8, 0, 1, 0, 10, 680 }, // ̹
-    { 11, 8, 0, 0, 1, 22, 690 }, // ̺
-    { 10, 8, 0, 0, 1, 20, 712 }, // ̻
-    { 9, 7, 0, 1, 1, 16, 732 }, // ̼
-    { 8, 6, 0, 2, 19, 12, 748 }, // ̽
-    { 10, 6, 0, 1, 20, 15, 760 }, // ͂
-    { 5, 7, 0, 6, 22, 9, 775 }, // ̓
-    { 12, 19, 0, 1, 32, 57, 784 }, // ̈́
-    { 11, 7, 0, 0, 21, 20, 841 }, // ͆
-    { 15, 10, 0, 0, 0, 38, 861 }, // ͇
-    { 11, 8, 0, 1, 1, 22, 899 }, // ͈
-    { 9, 8, 0, 1, -1, 18, 921 }, // ͉
-    { 13, 19, 0, 1, 26, 62, 939 }, // ͊
-    { 22, 19, 0, 1, 29, 105, 1001 }, // ͋
-    { 15, 14, 0, 10, 14, 53, 1106 }, // ͌
-    { 13, 6, 0, 2, -3, 20, 1159 }, // ͍
-    { 5, 4, 0, 1, 3, 5, 1179 }, // ͎
-    { 22, 7, 0, 1, 1, 39, 1184 }, // ͜
-    { 22, 7, 0, 1, 20, 39, 1223 }, // ͡
-    { 27, 8, 0, 1, -1, 54, 1262 }, // ͢
-    { 16, 30, 22, 3, 30, 120, 0 }, // Ѐ
-    { 15, 31, 23, 4, 31, 117, 120 }, // Ё
-    { 21, 23, 17, -3, 22, 121, 237 }, // Ђ
-    { 15, 29, 16, 1, 28, 109, 358 }, // Ѓ
-    { 19, 22, 21, 1, 20, 105, 467 }, // Є
-    { 19, 23, 27, 4, 21, 110, 572 }, // Ѕ
-    { 6, 21, 14, 4, 21, 32, 682 }, // І
-    { 11, 30, 14, 1, 30, 83, 714 }, // Ї
-    { 15, 27, 23, 4, 21, 102, 797 }, // Ј
-    { 25, 21, 29, 2, 19, 132, 899 }, // Љ
-    { 24, 20, 15, -5, 19, 120, 1031 }, // Њ
-    { 22, 23, 26, 4, 23, 127, 1151 }, // Ћ
-    { 19, 28, 26, 4, 28, 133, 1278 }, // Ќ
-    { 18, 32, 26, 4, 32, 144, 1411 }, // Ѝ
-    { 17, 32, 20, 1, 29, 136, 1555 }, // Ў
-    { 16, 25, 20, 2, 19, 100, 1691 }, // Џ
-    { 22, 21, 24, 1, 21, 116, 1791 }, // А
-    { 14, 19, 16, 1, 19, 67, 1907 }, // Б
-    { 15, 20, 17, 1, 19, 75, 1974 }, // В
-    { 15, 20, 16, 1, 19, 75, 2049 }, // Г
-    { 19, 23, 21, 1, 19, 110, 2124 }, // Д
-    { 16, 21, 22, 3, 21, 84, 2234 }, // Е
-    { 31, 21, 28, -1, 21, 163, 2318 }, // Ж
-    { 13, 19, 16, 1, 18, 62, 2481 }, // З
-    { 18, 21, 26, 4, 21, 95, 2543 }, // И
-    { 18, 32, 26, 4, 32, 144, 2638 }, // Й
-    { 19, 21, 26, 4, 21, 100, 2782 }, // К
-    { 16, 21, 15, -1, 19, 84, 2882 }, // Л
-    { 19, 20, 21, 1, 19, 95, 2966 }, // М
-    { 19, 21, 26, 4, 21, 100, 3061 }, // Н
-    { 21, 24, 28, 4, 22, 126, 3161 }, // О
-    { 15, 21, 17, 1, 20, 79, 3287 }, // П
-    { 15, 22, 23, 4, 22, 83, 3366 }, // Р
-    { 18, 23, 25, 3, 23, 104, 3449 }, // С
-    { 19, 22, 26, 4, 22, 105, 3553 }, // Т
-    { 17, 22, 20, 1, 19, 94, 3658 }, // У
-    { 19, 19, 22, 1, 19, 91, 3752 }, // Ф
-    { 20, 21, 28, 4, 21, 105, 3843 }, // Х
-    { 16, 24, 18, 1, 19, 96, 3948 }, // Ц
-    { 14, 19, 17, 1, 19, 67, 4044 }, // Ч
-    { 18, 20, 20, 1, 19, 90, 4111 }, // Ш
-    { 21, 25, 23, 1, 20, 132, 4201 }, // Щ
-    { 19, 18, 16, -5, 18, 86, 4333 }, // Ъ
-    { 25, 21, 29, 1, 21, 132, 4419 }, // Ы
-    { 13, 19, 16, 1, 19, 62, 4551 }, // Ь
-    { 19, 22, 21, 1, 20, 105, 4613 }, // Э
-    { 21, 19, 23, 1, 19, 100, 4718 }, // Ю
-    { 17, 22, 24, 4, 21, 94, 4818 }, // Я
-    { 15, 17, 21, 3, 16, 64, 4912 }, // а
-    { 16, 23, 17, 1, 22, 92, 4976 }, // б
-    { 12, 15, 18, 3, 15, 45, 5068 }, // в
-    { 13, 16, 15, 1, 15, 52, 5113 }, // г
-    { 17, 19, 19, 1, 15, 81, 5165 }, // д
-    { 15, 16, 21, 3, 15, 60, 5246 }, // е
-    { 29, 18, 35, 3, 18, 131, 5306 }, // ж
-    { 9, 13, 11, 1, 13, 30, 5437 }, // з
-    { 15, 16, 17, 1, 15, 60, 5467 }, // и
-    { 14, 24, 17, 1, 24, 84, 5527 }, // й
-    { 15, 14, 20, 3, 14, 53, 5611 }, // к
-    { 12, 15, 10, -1, 13, 45, 5664 }, // л
-    { 17, 16, 21, 2, 16, 68, 5709 }, // м
-    { 15, 16, 21, 3, 16, 60, 5777 }, // н
-    { 15, 16, 22, 3, 15, 60, 5837 }, // о
-    { 15, 16, 17, 1, 15, 60, 5897 }, // п
-    { 17, 23, 23, 3, 15, 98, 5957 }, // р
-    { 13, 16, 20, 3, 16, 52, 6055 }, // с
-    { 15, 16, 17, 1, 15, 60, 6107 }, // т
-    { 17, 21, 23, 3, 14, 90, 6167 }, // у
-    { 20, 21, 22, 1, 15, 105, 6257 }, // ф
-    { 18, 16, 18, 0, 15, 72, 6362 }, // х
-    { 16, 19, 18, 1, 15, 76, 6434 }, // ц
-    { 10, 13, 11, 1, 13, 33, 6510 }, // ч
-    { 18, 16, 20, 1, 15, 72, 6543 }, // ш
-    { 21, 20, 22, 1, 15, 105, 6615 }, // щ
-    { 15, 14, 12, -4, 14, 53, 6720 }, // ъ
-    { 19, 16, 22, 0, 16, 76, 6773 }, // ы
-    { 11, 14, 12, 0, 14, 39, 6849 }, // ь
-    { 14, 14, 16, 1, 14, 49, 6888 }, // э
-    { 16, 15, 18, 1, 15, 60, 6937 }, // ю
-    { 15, 16, 21, 3, 16, 60, 6997 }, // я
-    { 15, 28, 21, 3, 27, 105, 7057 }, // ѐ
-    { 15, 27, 21, 3, 26, 102, 7162 }, // ё
-    { 20, 24, 22, 0, 21, 120, 7264 }, // ђ
-    { 13, 23, 15, 1, 22, 75, 7384 }, // ѓ
-    { 14, 16, 14, 0, 14, 56, 7459 }, // є
-    { 15, 18, 22, 3, 16, 68, 7515 }, // ѕ
-    { 6, 23, 12, 3, 23, 35, 7583 }, // і
-    { 12, 22, 12, 0, 22, 66, 7618 }, // ї
-    { 10, 29, 16, 3, 22, 73, 7684 }, // ј
-    { 18, 15, 20, 1, 13, 68, 7757 }, // љ
-    { 16, 15, 10, -3, 14, 60, 7825 }, // њ
-    { 19, 21, 22, 0, 21, 100, 7885 }, // ћ
-    { 15, 21, 20, 3, 21, 79, 7985 }, // ќ
-    { 15, 25, 17, 1, 24, 94, 8064 }, // ѝ
-    { 17, 33, 23, 3, 26, 141, 8158 }, // ў
-    { 12, 18, 15, 1, 13, 54, 8299 }, // џ
-    { 18, 21, 19, 0, 19, 95, 8353 }, // Ѣ
-    { 17, 21, 16, -1, 19, 90, 8448 }, // ѣ
-    { 23, 21, 22, -1, 20, 121, 8538 }, // Ѫ
-    { 17, 14, 15, -1, 13, 60, 8659 }, // ѫ
-    { 20, 27, 28, 4, 26, 135, 8719 }, // Ѳ
-    { 16, 22, 22, 3, 21, 88, 8854 }, // ѳ
-    { 24, 26, 28, 4, 26, 156, 8942 }, // Ѵ
-    { 18, 19, 22, 2, 19, 86, 9098 }, // ѵ
-    { 11, 9, 0, 2, 24, 25, 9184 }, // ҆
-    { 15, 23, 16, 1, 22, 87, 9209 }, // Ґ
-    { 13, 20, 15, 1, 19, 65, 9296 }, // ґ
-    { 18, 20, 16, -2, 19, 90, 9361 }, // Ғ
-    { 12, 14, 11, -1, 13, 42, 9451 }, // ғ
-    { 16, 23, 15, -1, 22, 92, 9493 }, // Ҕ
-    { 10, 15, 9, 0, 13, 38, 9585 }, // ҕ
-    { 33, 26, 37, 2, 21, 215, 9623 }, // Җ
-    { 23, 18, 25, 1, 15, 104, 9838 }, // җ
-    { 13, 23, 16, 1, 18, 75, 9942 }, // Ҙ
-    { 9, 20, 11, 1, 13, 45, 10017 }, // ҙ
-    { 20, 25, 18, 2, 21, 125, 10062 }, // Қ
-    { 15, 18, 13, 1, 15, 68, 10187 }, // қ
-    { 25, 20, 27, 1, 19, 125, 10255 }, // Ҝ
-    { 17, 15, 19, 1, 14, 64, 10380 }, // ҝ
-    { 19, 21, 26, 4, 21, 100, 10444 }, // Ҟ
-    { 18, 21, 23, 1, 21, 95, 10544 }, // ҟ
-    { 23, 21, 26, 0, 21, 121, 10639 }, // Ҡ
-    { 16, 15, 18, 0, 15, 60, 10760 }, // ҡ
-    { 20, 24, 19, 0, 21, 120, 10820 }, // Ң
-    { 14, 17, 13, 0, 15, 60, 10940 }, // ң
-    { 27, 21, 26, 4, 21, 142, 11000 }, // Ҥ
-    { 20, 15, 18, 2, 15, 75, 11142 }, // ҥ
-    { 26, 22, 32, 3, 21, 143, 11217 }, // Ҧ
-    { 24, 25, 32, 3, 17, 150, 11360 }, // ҧ
-    { 25, 21, 17, -4, 19, 132, 11510 }, // Ҩ
-    { 20, 18, 14, -3, 16, 90, 11642 }, // ҩ
-    { 18, 27, 25, 3, 23, 122, 11732 }, // Ҫ
-    { 13, 19, 20, 3, 16, 62, 11854 }, // ҫ
-    { 19, 24, 19, 1, 21, 114, 11916 }, // Ҭ
-    { 14, 18, 13, 0, 15, 63, 12030 }, // ҭ
-    { 19, 21, 27, 4, 21, 100, 12093 }, // Ү
-    { 15, 20, 19, 2, 14, 75, 12193 }, // ү
-    { 19, 21, 27, 4, 21, 100, 12268 }, // Ұ
-    { 17, 20, 19, 1, 14, 85, 12368 }, // ұ
-    { 21, 25, 20, 3, 21, 132, 12453 }, // Ҳ
-    { 15, 17, 14, 2, 15, 64, 12585 }, // ҳ
-    { 23, 24, 15, -4, 19, 138, 12649 }, // Ҵ
-    { 17, 18, 11, -3, 13, 77, 12787 }, // ҵ
-    { 17, 24, 17, 0, 18, 102, 12864 }, // Ҷ
-    { 12, 18, 12, 0, 13, 54, 12966 }, // ҷ
-    { 14, 19, 17, 1, 19, 67, 13020 }, // Ҹ
-    { 10, 13, 11, 1, 13, 33, 13087 }, // ҹ
-    { 15, 22, 17, 1, 21, 83, 13120 }, // Һ
-    { 16, 21, 22, 3, 21, 84, 13203 }, // һ
-    { 28, 21, 24, -5, 20, 147, 13287 }, // Ҽ
-    { 20, 14, 17, -4, 13, 70, 13434 }, // ҽ
-    { 28, 25, 22, -4, 20, 175, 13504 }, // Ҿ
-    { 21, 17, 16, -3, 13, 90, 13679 }, // ҿ
-    { 6, 21, 14, 4, 21, 32, 13769 }, // Ӏ
-    { 31, 34, 28, -1, 34, 264, 13801 }, // Ӂ
-    { 29, 29, 35, 3, 29, 211, 14065 }, // ӂ
-    { 16, 26, 18, 1, 19, 104, 14276 }, // Ӄ
-    { 11, 19, 12, 1, 13, 53, 14380 }, // ӄ
-    { 19, 25, 15, -1, 19, 119, 14433 }, // Ӆ
-    { 13, 17, 10, -1, 13, 56, 14552 }, // ӆ
-    { 20, 28, 26, 4, 21, 140, 14608 }, // Ӈ
-    { 15, 20, 18, 2, 15, 75, 14748 }, // ӈ
-    { 20, 29, 26, 4, 21, 145, 14823 }, // Ӊ
-    { 15, 21, 18, 2, 15, 79, 14968 }, // ӊ
-    { 15, 24, 17, 1, 18, 90, 15047 }, // Ӌ
-    { 10, 17, 15, 3, 13, 43, 15137 }, // ӌ
-    { 24, 30, 29, 4, 21, 180, 15180 }, // Ӎ
-    { 17, 21, 20, 2, 15, 90, 15360 }, // ӎ
-    { 5, 19, 15, 5, 18, 24, 15450 }, // ӏ
-    { 22, 29, 24, 1, 29, 160, 15474 }, // Ӑ
-    { 15, 24, 21, 3, 23, 90, 15634 }, // ӑ
-    { 22, 28, 24, 1, 28, 154, 15724 }, // Ӓ
-    { 15, 24, 21, 3, 23, 90, 15878 }, // ӓ
-    { 32, 22, 34, 1, 21, 176, 15968 }, // Ӕ
-    { 25, 17, 31, 3, 16, 107, 16144 }, // ӕ
-    { 16, 30, 22, 3, 30, 120, 16251 }, // Ӗ
-    { 15, 27, 21, 3, 26, 102, 16371 }, // ӗ
-    { 18, 21, 27, 5, 19, 95, 16473 }, // Ә
-    { 15, 17, 21, 4, 16, 64, 16568 }, // ә
-    { 18, 29, 27, 5, 27, 131, 16632 }, // Ӛ
-    { 15, 21, 21, 4, 16, 79, 16763 }, // ӛ
-    { 31, 32, 35, 2, 32, 248, 16842 }, // Ӝ
-    { 29, 28, 35, 3, 28, 203, 17090 }, // ӝ
-    { 13, 30, 16, 1, 29, 98, 17293 }, // Ӟ
-    { 12, 20, 11, -1, 20, 60, 17391 }, // ӟ
-    { 13, 21, 17, 2, 19, 69, 17451 }, // Ӡ
-    { 13, 20, 17, 2, 14, 65, 17520 }, // ӡ
-    { 18, 32, 26, 4, 32, 144, 17585 }, // Ӣ
-    { 15, 24, 17, 1, 23, 90, 17729 }, // ӣ
-    { 18, 31, 26, 4, 31, 140, 17819 }, // Ӥ
-    { 15, 23, 17, 1, 22, 87, 17959 }, // ӥ
-    { 21, 31, 28, 4, 29, 163, 18046 }, // Ӧ
-    { 16, 26, 22, 2, 25, 104, 18209 }, // ӧ
-    { 19, 20, 28, 4, 19, 95, 18313 }, // Ө
-    { 15, 16, 22, 3, 15, 60, 18408 }, // ө
-    { 19, 28, 28, 4, 27, 133, 18468 }, // Ӫ
-    { 15, 23, 22, 3, 22, 87, 18601 }, // ӫ
-    { 19, 32, 21, 1, 30, 152, 18688 }, // Ӭ
-    { 14, 20, 16, 1, 20, 70, 18840 }, // ӭ
-    { 17, 33, 20, 1, 30, 141, 18910 }, // Ӯ
-    { 17, 33, 23, 3, 26, 141, 19051 }, // ӯ
-    { 17, 32, 20, 1, 29, 136, 19192 }, // Ӱ
-    { 17, 32, 23, 3, 25, 136, 19328 }, // ӱ
-    { 22, 32, 20, 1, 29, 176, 19464 }, // Ӳ
-    { 22, 32, 23, 3, 25, 176, 19640 }, // ӳ
-    { 14, 25, 17, 1, 25, 88, 19816 }, // Ӵ
-    { 12, 19, 11, 0, 19, 57, 19904 }, // ӵ
-    { 15, 23, 16, 1, 19, 87, 19961 }, // Ӷ
-    { 11, 16, 11, 0, 13, 44, 20048 }, // ӷ
-    { 25, 32, 29, 1, 32, 200, 20092 }, // Ӹ
-    { 19, 26, 22, 0, 26, 124, 20292 }, // ӹ
-    { 23, 24, 28, 4, 21, 138, 20416 }, // Ӽ
-    { 17, 17, 19, 2, 15, 73, 20554 }, // ӽ
-    { 0, 0, 17, 0, 0, 0, 0 }, //  
-    { 0, 0, 29, 0, 0, 0, 0 }, //  
-    { 0, 0, 17, 0, 0, 0, 0 }, //  
-    { 0, 0, 29, 0, 0, 0, 0 }, //  
-    { 0, 0, 12, 0, 0, 0, 0 }, //  
-    { 0, 0, 10, 0, 0, 0, 0 }, //  
-    { 0, 0, 8, 0, 0, 0, 0 }, //  
-    { 0, 0, 18, 0, 0, 0, 0 }, //  
-    { 0, 0, 7, 0, 0, 0, 0 }, //  
-    { 0, 0, 9, 0, 0, 0, 0 }, //  
-    { 0, 0, 8, 0, 0, 0, 0 }, //  
-    { 0, 0, 4, 0, 0, 0, 0 }, // ​
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‍
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‎
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‏
-    { 14, 3, 14, 0, 9, 11, 0 }, // ‐
-    { 14, 3, 14, 0, 9, 11, 11 }, // ‑
-    { 20, 3, 14, -3, 9, 15, 22 }, // ‒
-    { 18, 5, 20, 1, 10, 23, 37 }, // –
-    { 26, 5, 29, 1, 10, 33, 60 }, // —
-    { 26, 5, 29, 1, 10, 33, 93 }, // ―
-    { 13, 23, 14, 2, 18, 75, 126 }, // ‖
-    { 21, 8, 14, -4, -2, 42, 201 }, // ‗
-    { 9, 9, 11, 1, 22, 21, 243 }, // ‘
-    { 9, 9, 11, 1, 22, 21, 264 }, // ’
-    { 8, 9, 8, 0, 4, 18, 285 }, // ‚
-    { 9, 9, 11, 1, 22, 21, 303 }, // ‛
-    { 17, 9, 19, 1, 22, 39, 324 }, // “
-    { 17, 9, 19, 1, 22, 39, 363 }, // ”
-    { 8, 9, 8, 0, 4, 18, 402 }, // „
-    { 17, 9, 19, 1, 22, 39, 420 }, // ‟
-    { 16, 35, 20, 2, 26, 140, 459 }, // †
-    { 15, 35, 22, 4, 26, 132, 599 }, // ‡
-    { 20, 19, 13, -4, 22, 95, 731 }, // •
-    { 9, 9, 15, 3, 11, 21, 826 }, // ‣
-    { 7, 6, 15, 4, 6, 11, 847 }, // ․
-    { 7, 6, 15, 4, 6, 11, 858 }, // ‥
-    { 24, 6, 24, 0, 6, 36, 869 }, // …
-    { 4, 3, 14, 5, 9, 3, 905 }, // ‧
-    { 0, 0, 28, 0, 0, 0, 908 }, //  
-    { 19, 22, 28, 5, 20, 105, 908 }, // ‰
-    { 9, 9, 14, 4, 22, 21, 1013 }, // ′
-    { 17, 9, 20, 4, 22, 39, 1034 }, // ″
-    { 20, 8, 10, 1, 21, 40, 1073 }, // ‴
-    { 7, 8, 10, 2, 21, 14, 1113 }, // ‵
-    { 12, 8, 10, 0, 21, 24, 1127 }, // ‶
-    { 20, 8, 10, -5, 21, 40, 1151 }, // ‷
-    { 14, 6, 16, 1, 21, 21, 1191 }, // ‸
-    { 8, 14, 10, 1, 14, 28, 1212 }, // ‹
-    { 8, 14, 10, 1, 14, 28, 1240 }, // ›
-    { 28, 32, 34, 4, 25, 224, 1268 }, // ※
-    { 8, 32, 15, 3, 28, 64, 1492 }, // ‼
-    { 16, 40, 22, 2, 34, 160, 1556 }, // ‽
-    { 14, 3, 14, 0, 21, 11, 1716 }, // ‾
-    { 13, 5, 14, 0, 17, 17, 1727 }, // ‿
-    { 18, 17, 16, -1, 23, 77, 1744 }, // ⁂
-    { 17, 22, 31, 7, 20, 94, 1821 }, // ⁄
-    { 31, 31, 38, 3, 28, 241, 1915 }, // ⁇
-    { 26, 32, 30, 2, 28, 208, 2156 }, // ⁈
-    { 21, 32, 19, -1, 28, 168, 2364 }, // ⁉
-    { 19, 44, 23, 2, 30, 209, 2532 }, // ⁒
-    { 0, 0, 117, 0, 0, 0, 2741 }, //  
-    { 8, 10, 8, 0, 21, 20, 0 }, // ⁰
-    { 8, 9, 9, 0, 21, 18, 20 }, // ⁴
-    { 7, 11, 9, 1, 22, 20, 38 }, // ⁵
-    { 7, 10, 9, 1, 21, 18, 58 }, // ⁶
-    { 7, 11, 9, 1, 22, 20, 76 }, // ⁷
-    { 9, 11, 9, 0, 21, 25, 96 }, // ⁸
-    { 8, 11, 9, 0, 21, 22, 121 }, // ⁹
-    { 15, 16, 22, 3, 16, 60, 143 }, // ⁿ
-    { 7, 10, 9, 1, 6, 18, 203 }, // ₀
-    { 7, 11, 8, 1, 6, 20, 221 }, // ₁
-    { 7, 11, 9, 1, 6, 20, 241 }, // ₂
-    { 7, 10, 9, 1, 6, 18, 261 }, // ₃
-    { 8, 10, 9, 1, 6, 20, 279 }, // ₄
-    { 7, 10, 8, 1, 6, 18, 299 }, // ₅
-    { 7, 10, 9, 1, 6, 18, 317 }, // ₆
-    { 7, 11, 9, 1, 6, 20, 335 }, // ₇
-    { 9, 11, 9, 0, 6, 25, 355 }, // ₈
-    { 8, 11, 9, 1, 6, 22, 380 }, // ₉
-    { 11, 35, 12, 1, 26, 97, 402 }, // ₍
-    { 11, 35, 11, -1, 26, 97, 499 }, // ₎
-    { 18, 33, 25, 3, 28, 149, 0 }, // ₡
-    { 18, 23, 25, 3, 23, 104, 149 }, // ₢
-    { 17, 23, 17, 0, 22, 98, 253 }, // ₤
-    { 27, 21, 26, -1, 21, 142, 351 }, // ₦
-    { 22, 22, 23, 0, 22, 121, 493 }, // ₧
-    { 27, 23, 33, 3, 21, 156, 614 }, // ₨
-    { 21, 22, 21, 0, 22, 116, 770 }, // ₩
-    { 20, 19, 27, 3, 19, 95, 886 }, // ₪
-    { 19, 22, 13, -2, 21, 105, 981 }, // ₫
-    { 18, 24, 19, 0, 20, 108, 1086 }, // €
-    { 19, 22, 26, 4, 22, 105, 1194 }, // ₮
-    { 25, 22, 16, -1, 22, 138, 1299 }, // ₱
-    { 21, 33, 29, 4, 28, 174, 1437 }, // ₲
-    { 25, 21, 26, 5, 19, 132, 1611 }, // ₴
-    { 13, 20, 15, 3, 18, 65, 1743 }, // ₵
-    { 20, 23, 26, 3, 23, 115, 1808 }, // ₸
-    { 13, 21, 17, 2, 20, 69, 1923 }, // ₹
-    { 15, 19, 17, 1, 17, 72, 1992 }, // ₺
-    { 18, 21, 20, 1, 20, 95, 2064 }, // ₼
-    { 21, 22, 23, -2, 22, 116, 2159 }, // ₽
-    { 17, 18, 18, 0, 15, 77, 0 }, // ←
-    { 19, 18, 19, 0, 17, 86, 77 }, // ↑
-    { 17, 18, 19, 1, 15, 77, 163 }, // →
-    { 19, 17, 19, 0, 16, 81, 240 }, // ↓
-    { 21, 15, 26, 2, 14, 79, 321 }, // ↔
-    { 16, 20, 20, 2, 22, 80, 400 }, // ↕
-    { 15, 14, 20, 2, 13, 53, 480 }, // ↖
-    { 14, 14, 16, 1, 13, 49, 533 }, // ↗
-    { 14, 14, 16, 1, 14, 49, 582 }, // ↘
-    { 14, 14, 16, 1, 14, 49, 631 }, // ↙
-    { 20, 18, 24, 2, 16, 90, 680 }, // ⇐
-    { 22, 20, 27, 2, 19, 110, 770 }, // ⇑
-    { 20, 18, 24, 2, 16, 90, 880 }, // ⇒
-    { 22, 20, 27, 2, 18, 110, 970 }, // ⇓
-    { 23, 18, 27, 2, 16, 104, 1080 }, // ⇔
-    { 18, 22, 22, 2, 13, 99, 1184 }, // ⇕
-    { 15, 22, 17, 1, 21, 83, 0 }, // ∂
-    { 26, 26, 28, 1, 23, 169, 83 }, // ∅
-    { 20, 20, 22, 1, 19, 100, 252 }, // ∆
-    { 17, 20, 18, 1, 19, 85, 352 }, // ∏
-    { 17, 19, 18, 1, 18, 81, 437 }, // ∐
-    { 13, 20, 15, 1, 19, 65, 518 }, // ∑
-    { 15, 4, 15, 0, 9, 15, 583 }, // −
-    { 22, 23, 24, 1, 21, 127, 598 }, // √
-    { 21, 14, 23, 1, 16, 74, 725 }, // ∞
-    { 20, 27, 21, 1, 20, 135, 799 }, // ∫
-    { 7, 17, 8, 1, 17, 30, 934 }, // ∶
-    { 15, 14, 36, 10, 14, 53, 964 }, // ≈
-    { 19, 22, 31, 6, 20, 105, 1017 }, // ≠
-    { 21, 21, 20, -1, 18, 111, 1122 }, // ≤
-    { 22, 22, 22, 0, 19, 121, 1233 }, // ≥
+    { 14, 14, 13, 0, 13, 49, 7474 }, // «
+    { 13, 9, 15, 1, 10, 30, 573 }, // ¬
+    { 13, 3, 15, 1, 9, 10, 603 }, // ­
+    { 12, 12, 17, 2, 28, 36, 613 }, // ®
+    { 11, 4, 13, 1, 19, 11, 649 }, // ¯
+    { 12, 11, 17, 2, 19, 33, 660 }, // °
+    { 15, 16, 16, 0, 14, 60, 693 }, // ±
+    { 8, 8, 8, 0, 20, 16, 753 }, // ²
+    { 8, 10, 8, 0, 21, 20, 769 }, // ³
+    { 7, 6, 7, 0, 19, 11, 789 }, // ´
+    { 16, 19, 21, 2, 15, 76, 800 }, // µ
+    { 14, 22, 19, 2, 18, 77, 876 }, // ¶
+    { 6, 6, 7, 0, 12, 9, 953 }, // ·
+    { 7, 8, 8, 1, 1, 14, 962 }, // ¸
+    { 7, 9, 8, 0, 21, 16, 976 }, // ¹
+    { 9, 8, 17, 5, 18, 18, 992 }, // º
+    { 14, 14, 19, 2, 13, 49, 7523 }, // »
+    { 23, 23, 31, 4, 21, 133, 1010 }, // ¼
+    { 25, 23, 31, 4, 21, 144, 1143 }, // ½
+    { 23, 23, 31, 4, 21, 133, 1287 }, // ¾
+    { 16, 32, 17, 0, 18, 128, 1420 }, // ¿
+    { 22, 28, 24, 1, 28, 154, 7572 }, // À
+    { 22, 32, 24, 1, 32, 176, 7726 }, // Á
+    { 22, 30, 24, 1, 30, 165, 7902 }, // Â
+    { 22, 29, 24, 1, 29, 160, 1548 }, // Ã
+    { 22, 30, 24, 1, 30, 165, 8067 }, // Ä
+    { 22, 30, 24, 1, 30, 165, 1708 }, // Å
+    { 32, 22, 34, 1, 21, 176, 1873 }, // Æ
+    { 18, 30, 25, 3, 23, 135, 8232 }, // Ç
+    { 15, 29, 23, 4, 29, 109, 8367 }, // È
+    { 15, 33, 23, 4, 33, 124, 8476 }, // É
+    { 15, 31, 23, 4, 31, 117, 8600 }, // Ê
+    { 15, 31, 23, 4, 31, 117, 8717 }, // Ë
+    { 11, 30, 14, 0, 30, 83, 8834 }, // Ì
+    { 6, 34, 14, 4, 34, 51, 8917 }, // Í
+    { 14, 32, 14, 0, 32, 112, 8968 }, // Î
+    { 13, 32, 14, 0, 32, 104, 9080 }, // Ï
+    { 24, 21, 26, -1, 21, 126, 2049 }, // Ð
+    { 18, 29, 26, 4, 29, 131, 9184 }, // Ñ
+    { 21, 31, 28, 4, 29, 163, 9315 }, // Ò
+    { 21, 35, 28, 4, 33, 184, 9478 }, // Ó
+    { 21, 33, 28, 4, 31, 174, 9662 }, // Ô
+    { 21, 32, 28, 4, 30, 168, 2175 }, // Õ
+    { 21, 33, 28, 4, 31, 174, 9836 }, // Ö
+    { 15, 9, 15, 0, 11, 34, 2343 }, // ×
+    { 36, 50, 28, -4, 36, 450, 2377 }, // Ø
+    { 18, 31, 26, 4, 30, 140, 10010 }, // Ù
+    { 18, 35, 26, 4, 34, 158, 10150 }, // Ú
+    { 18, 33, 26, 4, 32, 149, 10308 }, // Û
+    { 18, 32, 26, 4, 31, 144, 10457 }, // Ü
+    { 19, 36, 27, 4, 36, 171, 2827 }, // Ý
+    { 12, 20, 14, 1, 20, 60, 2998 }, // Þ
+    { 15, 22, 17, 1, 20, 83, 3058 }, // ß
+    { 15, 23, 21, 3, 22, 87, 10601 }, // à
+    { 15, 27, 21, 3, 26, 102, 10688 }, // á
+    { 15, 25, 21, 3, 24, 94, 10790 }, // â
+    { 15, 23, 21, 3, 22, 87, 3141 }, // ã
+    { 15, 25, 21, 3, 24, 94, 10884 }, // ä
+    { 15, 25, 21, 3, 24, 94, 3228 }, // å
+    { 25, 17, 31, 3, 16, 107, 3322 }, // æ
+    { 13, 22, 20, 3, 16, 72, 10978 }, // ç
+    { 15, 26, 21, 3, 25, 98, 11050 }, // è
+    { 15, 31, 21, 3, 30, 117, 11148 }, // é
+    { 15, 28, 21, 3, 27, 105, 11265 }, // ê
+    { 15, 28, 21, 3, 27, 105, 11370 }, // ë
+    { 10, 22, 12, 0, 22, 55, 11475 }, // ì
+    { 6, 26, 12, 3, 26, 39, 11530 }, // í
+    { 14, 23, 12, -1, 23, 81, 11569 }, // î
+    { 12, 22, 12, 0, 22, 66, 11650 }, // ï
+    { 20, 22, 17, -1, 21, 110, 3429 }, // ð
+    { 15, 24, 22, 3, 24, 90, 11716 }, // ñ
+    { 15, 23, 22, 3, 22, 87, 11806 }, // ò
+    { 15, 27, 22, 3, 26, 102, 11893 }, // ó
+    { 15, 25, 22, 3, 24, 94, 11995 }, // ô
+    { 15, 24, 22, 3, 23, 90, 3539 }, // õ
+    { 15, 25, 22, 3, 24, 94, 12089 }, // ö
+    { 19, 18, 22, 2, 17, 86, 3629 }, // ÷
+    { 17, 44, 22, 2, 30, 187, 3715 }, // ø
+    { 15, 24, 21, 3, 23, 90, 12183 }, // ù
+    { 15, 28, 21, 3, 27, 105, 12273 }, // ú
+    { 15, 25, 21, 3, 24, 94, 12378 }, // û
+    { 15, 25, 21, 3, 24, 94, 12472 }, // ü
+    { 17, 36, 23, 3, 29, 153, 3902 }, // ý
+    { 12, 26, 14, 1, 21, 78, 4055 }, // þ
+    { 17, 33, 23, 3, 26, 141, 4133 }, // ÿ
+    { 22, 29, 24, 1, 29, 160, 4274 }, // Ā
+    { 15, 25, 21, 3, 24, 94, 4434 }, // ā
+    { 22, 30, 24, 1, 30, 165, 4528 }, // Ă
+    { 15, 25, 21, 3, 24, 94, 4693 }, // ă
+    { 22, 28, 24, 1, 21, 154, 4787 }, // Ą
+    { 17, 24, 21, 3, 16, 102, 4941 }, // ą
+    { 18, 31, 25, 3, 31, 140, 5043 }, // Ć
+    { 13, 21, 20, 3, 21, 69, 5183 }, // ć
+    { 18, 32, 25, 3, 32, 144, 5252 }, // Ĉ
+    { 14, 24, 20, 3, 24, 84, 5396 }, // ĉ
+    { 18, 31, 25, 3, 31, 140, 5480 }, // Ċ
+    { 13, 22, 20, 3, 22, 72, 5620 }, // ċ
+    { 18, 33, 25, 3, 33, 149, 5692 }, // Č
+    { 14, 24, 20, 3, 24, 84, 5841 }, // č
+    { 19, 31, 26, 4, 31, 148, 5925 }, // Ď
+    { 20, 22, 22, 3, 21, 110, 6073 }, // ď
+    { 24, 21, 26, -1, 21, 126, 6183 }, // Đ
+    { 20, 22, 22, 3, 21, 110, 6309 }, // đ
+    { 15, 30, 23, 4, 30, 113, 6419 }, // Ē
+    { 15, 28, 21, 3, 27, 105, 6532 }, // ē
+    { 15, 31, 23, 4, 31, 117, 6637 }, // Ĕ
+    { 15, 28, 21, 3, 27, 105, 6754 }, // ĕ
+    { 15, 31, 23, 4, 31, 117, 6859 }, // Ė
+    { 15, 28, 21, 3, 27, 105, 6976 }, // ė
+    { 15, 28, 23, 4, 21, 105, 7081 }, // Ę
+    { 15, 25, 21, 3, 15, 94, 7186 }, // ę
+    { 15, 33, 23, 4, 33, 124, 7280 }, // Ě
+    { 15, 30, 21, 3, 29, 113, 7404 }, // ě
+    { 21, 34, 29, 4, 33, 179, 7517 }, // Ĝ
+    { 16, 34, 22, 3, 26, 136, 7696 }, // ĝ
+    { 21, 33, 29, 4, 32, 174, 7832 }, // Ğ
+    { 15, 33, 22, 3, 25, 124, 8006 }, // ğ
+    { 21, 33, 29, 4, 32, 174, 8130 }, // Ġ
+    { 15, 33, 22, 3, 25, 124, 8304 }, // ġ
+    { 21, 38, 29, 4, 37, 200, 8428 }, // Ģ
+    { 15, 34, 22, 3, 26, 128, 8628 }, // ģ
+    { 19, 31, 26, 4, 31, 148, 8756 }, // Ĥ
+    { 19, 30, 22, 0, 30, 143, 8904 }, // ĥ
+    { 22, 21, 26, 2, 21, 116, 9047 }, // Ħ
+    { 19, 21, 22, 0, 21, 100, 9163 }, // ħ
+    { 11, 32, 14, 1, 32, 88, 9263 }, // Ĩ
+    { 10, 23, 12, 1, 23, 58, 9351 }, // ĩ
+    { 14, 31, 14, -1, 31, 109, 9409 }, // Ī
+    { 15, 23, 12, -2, 23, 87, 9518 }, // ī
+    { 8, 28, 14, 2, 21, 56, 9605 }, // Į
+    { 8, 31, 12, 2, 23, 62, 9661 }, // į
+    { 7, 32, 14, 3, 32, 56, 9723 }, // İ
+    { 6, 14, 12, 3, 14, 21, 9779 }, // ı
+    { 20, 31, 40, 9, 21, 155, 9800 }, // Ĳ
+    { 15, 30, 12, 3, 24, 113, 9955 }, // ĳ
+    { 17, 37, 23, 4, 31, 158, 10068 }, // Ĵ
+    { 14, 32, 16, 3, 25, 112, 10226 }, // ĵ
+    { 19, 34, 26, 4, 34, 162, 10338 }, // Ķ
+    { 16, 34, 23, 3, 21, 136, 10500 }, // ķ
+    { 12, 14, 16, 2, 14, 42, 10636 }, // ĸ
+    { 15, 28, 22, 4, 28, 105, 10678 }, // Ĺ
+    { 9, 32, 15, 3, 32, 72, 10783 }, // ĺ
+    { 17, 33, 22, 2, 33, 141, 10855 }, // Ļ
+    { 10, 35, 15, 2, 21, 88, 10996 }, // ļ
+    { 15, 21, 22, 4, 21, 79, 11084 }, // Ľ
+    { 12, 25, 15, 3, 25, 75, 11163 }, // ľ
+    { 15, 21, 22, 4, 21, 79, 11238 }, // Ŀ
+    { 12, 21, 15, 3, 21, 63, 11317 }, // ŀ
+    { 27, 37, 22, -7, 29, 250, 11380 }, // Ł
+    { 19, 21, 15, -5, 21, 100, 11630 }, // ł
+    { 18, 30, 26, 4, 30, 135, 11730 }, // Ń
+    { 15, 25, 22, 3, 25, 94, 11865 }, // ń
+    { 18, 31, 26, 4, 21, 140, 11959 }, // Ņ
+    { 15, 26, 22, 3, 16, 98, 12099 }, // ņ
+    { 18, 32, 26, 4, 32, 144, 12197 }, // Ň
+    { 16, 27, 22, 3, 27, 108, 12341 }, // ň
+    { 15, 26, 22, 3, 26, 98, 12449 }, // ŉ
+    { 18, 27, 26, 4, 21, 122, 12547 }, // Ŋ
+    { 15, 21, 22, 3, 16, 79, 12669 }, // ŋ
+    { 21, 32, 28, 4, 30, 168, 12748 }, // Ō
+    { 15, 25, 22, 3, 24, 94, 12916 }, // ō
+    { 21, 33, 28, 4, 31, 174, 13010 }, // Ŏ
+    { 15, 25, 22, 3, 24, 94, 13184 }, // ŏ
+    { 23, 32, 28, 4, 30, 184, 13278 }, // Ő
+    { 22, 24, 22, 1, 23, 132, 13462 }, // ő
+    { 29, 24, 30, 4, 22, 174, 12566 }, // Œ
+    { 26, 16, 27, 3, 15, 104, 12740 }, // œ
+    { 17, 30, 24, 4, 29, 128, 13594 }, // Ŕ
+    { 12, 22, 18, 3, 22, 66, 13722 }, // ŕ
+    { 17, 35, 24, 4, 34, 149, 13788 }, // Ŗ
+    { 12, 27, 18, 3, 27, 81, 13937 }, // ŗ
+    { 17, 32, 24, 4, 31, 136, 14018 }, // Ř
+    { 14, 24, 18, 1, 24, 84, 14154 }, // ř
+    { 19, 31, 27, 4, 29, 148, 14238 }, // Ś
+    { 15, 24, 22, 3, 22, 90, 14386 }, // ś
+    { 19, 32, 27, 4, 30, 152, 14476 }, // Ŝ
+    { 15, 26, 22, 3, 24, 98, 14628 }, // ŝ
+    { 19, 28, 27, 4, 21, 133, 14726 }, // Ş
+    { 15, 24, 22, 3, 16, 90, 14859 }, // ş
+    { 19, 33, 27, 4, 31, 157, 14949 }, // Š
+    { 15, 26, 22, 3, 24, 98, 15106 }, // š
+    { 19, 29, 26, 4, 22, 138, 15204 }, // Ţ
+    { 13, 26, 20, 3, 20, 85, 15342 }, // ţ
+    { 19, 32, 26, 4, 32, 152, 15427 }, // Ť
+    { 17, 24, 20, 3, 23, 102, 15579 }, // ť
+    { 19, 22, 26, 4, 22, 105, 15681 }, // Ŧ
+    { 14, 21, 20, 2, 20, 74, 15786 }, // ŧ
+    { 18, 33, 26, 4, 32, 149, 15860 }, // Ũ
+    { 15, 25, 21, 3, 24, 94, 16009 }, // ũ
+    { 18, 32, 26, 4, 31, 144, 16103 }, // Ū
+    { 15, 25, 21, 3, 24, 94, 16247 }, // ū
+    { 18, 32, 26, 4, 31, 144, 16341 }, // Ŭ
+    { 15, 25, 21, 3, 24, 94, 16485 }, // ŭ
+    { 18, 34, 26, 4, 33, 153, 16579 }, // Ů
+    { 15, 27, 21, 3, 26, 102, 16732 }, // ů
+    { 22, 31, 26, 3, 30, 171, 16834 }, // Ű
+    { 22, 24, 21, 1, 23, 132, 17005 }, // ű
+    { 18, 28, 26, 4, 21, 126, 17137 }, // Ų
+    { 15, 23, 21, 3, 15, 87, 17263 }, // ų
+    { 28, 31, 36, 4, 31, 217, 17350 }, // Ŵ
+    { 21, 27, 28, 3, 26, 142, 17567 }, // ŵ
+    { 19, 33, 27, 4, 33, 157, 17709 }, // Ŷ
+    { 17, 34, 23, 3, 27, 145, 17866 }, // ŷ
+    { 19, 33, 27, 4, 33, 157, 18011 }, // Ÿ
+    { 20, 28, 27, 4, 28, 140, 18168 }, // Ź
+    { 16, 24, 22, 3, 24, 96, 18308 }, // ź
+    { 20, 29, 27, 4, 29, 145, 18404 }, // Ż
+    { 16, 24, 22, 3, 24, 96, 18549 }, // ż
+    { 20, 31, 27, 4, 31, 155, 18645 }, // Ž
+    { 16, 26, 22, 3, 26, 104, 18800 }, // ž
+    { 10, 21, 15, 2, 21, 53, 18904 }, // ſ
+    { 11, 6, 0, 0, 20, 17, 18957 }, // ̀
+    { 7, 6, 0, 0, 19, 11, 18974 }, // ́
+    { 14, 7, 0, 0, 1, 25, 18985 }, // ̂
+    { 10, 6, 0, 1, 20, 15, 19010 }, // ̃
+    { 14, 4, 0, 1, 17, 14, 19025 }, // ̄
+    { 18, 4, 0, 0, 23, 18, 19039 }, // ̅
+    { 13, 5, 0, 0, 18, 17, 19057 }, // ̆
+    { 7, 6, 0, 3, 21, 11, 19074 }, // ̇
+    { 12, 5, 0, 0, 18, 15, 19085 }, // ̈
+    { 5, 6, 0, 5, 16, 8, 19100 }, // ̉
+    { 7, 7, 0, 1, 20, 13, 19108 }, // ̊
+    { 22, 6, 0, 0, 20, 33, 19121 }, // ̋
+    { 14, 7, 0, 0, 20, 25, 19154 }, // ̌
+    { 22, 6, 0, -6, 20, 33, 19179 }, // ̏
+    { 8, 9, 0, 0, 20, 18, 19212 }, // ̒
+    { 9, 9, 0, 0, 19, 21, 19230 }, // ̓
+    { 9, 9, 0, -1, 19, 21, 19251 }, // ̔
+    { 6, 7, 0, 1, 0, 11, 19272 }, // ̘
+    { 6, 7, 0, 1, 0, 11, 19283 }, // ̙
+    { 12, 8, 0, 1, 21, 24, 19294 }, // ̚
+    { 6, 8, 0, 0, 17, 12, 19318 }, // ̛
+    { 4, 8, 0, 1, 0, 8, 19330 }, // ̜
+    { 7, 6, 0, 1, 4, 11, 19338 }, // ̝
+    { 7, 6, 0, 1, 0, 11, 19349 }, // ̞
+    { 6, 6, 0, 1, -2, 9, 19360 }, // ̟
+    { 15, 4, 0, 0, -3, 15, 19369 }, // ̠
+    { 7, 6, 0, 0, 2, 11, 19384 }, // ̣
+    { 12, 5, 0, 0, -2, 15, 19395 }, // ̤
+    { 7, 7, 0, 1, 20, 13, 19410 }, // ̥
+    { 8, 9, 0, 0, 4, 18, 19423 }, // ̦
+    { 7, 8, 0, 1, 1, 14, 19441 }, // ̧
+    { 8, 9, 0, 1, 1, 18, 19455 }, // ̨
+    { 5, 9, 0, 1, 0, 12, 19473 }, // ̩
+    { 11, 6, 0, 0, 0, 17, 19485 }, // ̪
+    { 16, 8, 0, -1, 1, 32, 19502 }, // ̬
+    { 16, 8, 0, -1, 1, 32, 19534 }, // ̭
+    { 11, 6, 0, 1, 21, 17, 19566 }, // ̰
+    { 13, 4, 0, 1, 21, 13, 19583 }, // ̱
+    { 13, 4, 0, 0, -1, 13, 19596 }, // ̲
+    { 11, 6, 0, 1, 21, 17, 19609 }, // ̴
+    { 14, 3, 0, 0, 9, 11, 19626 }, // ̵
+    { 5, 8, 0, 1, 0, 10, 19637 }, // ̹
+    { 11, 8, 0, 0, 1, 22, 19647 }, // ̺
+    { 10, 8, 0, 0, 1, 20, 19669 }, // ̻
+    { 9, 7, 0, 1, 1, 16, 19689 }, // ̼
+    { 8, 6, 0, 2, 19, 12, 19705 }, // ̽
+    { 10, 6, 0, 1, 20, 15, 19717 }, // ͂
+    { 5, 7, 0, 6, 22, 9, 19732 }, // ̓
+    { 12, 19, 0, 1, 32, 57, 19741 }, // ̈́
+    { 11, 7, 0, 0, 21, 20, 19798 }, // ͆
+    { 15, 10, 0, 0, 0, 38, 19818 }, // ͇
+    { 11, 8, 0, 1, 1, 22, 19856 }, // ͈
+    { 9, 8, 0, 1, -1, 18, 19878 }, // ͉
+    { 13, 19, 0, 1, 26, 62, 19896 }, // ͊
+    { 22, 19, 0, 1, 29, 105, 19958 }, // ͋
+    { 15, 14, 0, 10, 14, 53, 20063 }, // ͌
+    { 13, 6, 0, 2, -3, 20, 20116 }, // ͍
+    { 5, 4, 0, 1, 3, 5, 20136 }, // ͎
+    { 22, 7, 0, 1, 1, 39, 20141 }, // ͜
+    { 22, 7, 0, 1, 20, 39, 20180 }, // ͡
+    { 27, 8, 0, 1, -1, 54, 20219 }, // ͢
+    { 16, 30, 22, 3, 30, 120, 20273 }, // Ѐ
+    { 15, 31, 23, 4, 31, 117, 0 }, // Ё
+    { 21, 23, 17, -3, 22, 121, 20393 }, // Ђ
+    { 15, 29, 16, 1, 28, 109, 20514 }, // Ѓ
+    { 19, 22, 21, 1, 20, 105, 0 }, // Є
+    { 19, 23, 27, 4, 21, 110, 105 }, // Ѕ
+    { 6, 21, 14, 4, 21, 32, 215 }, // І
+    { 11, 30, 14, 1, 30, 83, 247 }, // Ї
+    { 15, 27, 23, 4, 21, 102, 330 }, // Ј
+    { 25, 21, 29, 2, 19, 132, 432 }, // Љ
+    { 24, 20, 15, -5, 19, 120, 564 }, // Њ
+    { 22, 23, 26, 4, 23, 127, 684 }, // Ћ
+    { 19, 28, 26, 4, 28, 133, 811 }, // Ќ
+    { 18, 32, 26, 4, 32, 144, 944 }, // Ѝ
+    { 17, 32, 20, 1, 29, 136, 1088 }, // Ў
+    { 16, 25, 20, 2, 19, 100, 1224 }, // Џ
+    { 22, 21, 24, 1, 21, 116, 117 }, // А
+    { 14, 19, 16, 1, 19, 67, 233 }, // Б
+    { 15, 20, 17, 1, 19, 75, 300 }, // В
+    { 15, 20, 16, 1, 19, 75, 375 }, // Г
+    { 19, 23, 21, 1, 19, 110, 450 }, // Д
+    { 16, 21, 22, 3, 21, 84, 560 }, // Е
+    { 31, 21, 28, -1, 21, 163, 644 }, // Ж
+    { 13, 19, 16, 1, 18, 62, 807 }, // З
+    { 18, 21, 26, 4, 21, 95, 869 }, // И
+    { 18, 32, 26, 4, 32, 144, 964 }, // Й
+    { 19, 21, 26, 4, 21, 100, 1108 }, // К
+    { 16, 21, 15, -1, 19, 84, 1208 }, // Л
+    { 19, 20, 21, 1, 19, 95, 1292 }, // М
+    { 19, 21, 26, 4, 21, 100, 1387 }, // Н
+    { 21, 24, 28, 4, 22, 126, 1487 }, // О
+    { 15, 21, 17, 1, 20, 79, 1613 }, // П
+    { 15, 22, 23, 4, 22, 83, 1692 }, // Р
+    { 18, 23, 25, 3, 23, 104, 1775 }, // С
+    { 19, 22, 26, 4, 22, 105, 1879 }, // Т
+    { 17, 22, 20, 1, 19, 94, 1984 }, // У
+    { 19, 19, 22, 1, 19, 91, 2078 }, // Ф
+    { 20, 21, 28, 4, 21, 105, 2169 }, // Х
+    { 16, 24, 18, 1, 19, 96, 2274 }, // Ц
+    { 14, 19, 17, 1, 19, 67, 2370 }, // Ч
+    { 18, 20, 20, 1, 19, 90, 2437 }, // Ш
+    { 21, 25, 23, 1, 20, 132, 2527 }, // Щ
+    { 19, 18, 16, -5, 18, 86, 2659 }, // Ъ
+    { 25, 21, 29, 1, 21, 132, 2745 }, // Ы
+    { 13, 19, 16, 1, 19, 62, 2877 }, // Ь
+    { 19, 22, 21, 1, 20, 105, 2939 }, // Э
+    { 21, 19, 23, 1, 19, 100, 3044 }, // Ю
+    { 17, 22, 24, 4, 21, 94, 3144 }, // Я
+    { 15, 17, 21, 3, 16, 64, 3238 }, // а
+    { 16, 23, 17, 1, 22, 92, 3302 }, // б
+    { 12, 15, 18, 3, 15, 45, 3394 }, // в
+    { 13, 16, 15, 1, 15, 52, 3439 }, // г
+    { 17, 19, 19, 1, 15, 81, 3491 }, // д
+    { 15, 16, 21, 3, 15, 60, 3572 }, // е
+    { 29, 18, 35, 3, 18, 131, 3632 }, // ж
+    { 9, 13, 11, 1, 13, 30, 3763 }, // з
+    { 15, 16, 17, 1, 15, 60, 3793 }, // и
+    { 14, 24, 17, 1, 24, 84, 3853 }, // й
+    { 15, 14, 20, 3, 14, 53, 3937 }, // к
+    { 12, 15, 10, -1, 13, 45, 3990 }, // л
+    { 17, 16, 21, 2, 16, 68, 4035 }, // м
+    { 15, 16, 21, 3, 16, 60, 4103 }, // н
+    { 15, 16, 22, 3, 15, 60, 4163 }, // о
+    { 15, 16, 17, 1, 15, 60, 4223 }, // п
+    { 17, 23, 23, 3, 15, 98, 4283 }, // р
+    { 13, 16, 20, 3, 16, 52, 4381 }, // с
+    { 15, 16, 17, 1, 15, 60, 4433 }, // т
+    { 17, 21, 23, 3, 14, 90, 4493 }, // у
+    { 20, 21, 22, 1, 15, 105, 4583 }, // ф
+    { 18, 16, 18, 0, 15, 72, 4688 }, // х
+    { 16, 19, 18, 1, 15, 76, 4760 }, // ц
+    { 10, 13, 11, 1, 13, 33, 4836 }, // ч
+    { 18, 16, 20, 1, 15, 72, 4869 }, // ш
+    { 21, 20, 22, 1, 15, 105, 4941 }, // щ
+    { 15, 14, 12, -4, 14, 53, 5046 }, // ъ
+    { 19, 16, 22, 0, 16, 76, 5099 }, // ы
+    { 11, 14, 12, 0, 14, 39, 5175 }, // ь
+    { 14, 14, 16, 1, 14, 49, 5214 }, // э
+    { 16, 15, 18, 1, 15, 60, 5263 }, // ю
+    { 15, 16, 21, 3, 16, 60, 5323 }, // я
+    { 15, 28, 21, 3, 27, 105, 1324 }, // ѐ
+    { 15, 27, 21, 3, 26, 102, 5383 }, // ё
+    { 20, 24, 22, 0, 21, 120, 1429 }, // ђ
+    { 13, 23, 15, 1, 22, 75, 1549 }, // ѓ
+    { 14, 16, 14, 0, 14, 56, 1624 }, // є
+    { 15, 18, 22, 3, 16, 68, 1680 }, // ѕ
+    { 6, 23, 12, 3, 23, 35, 1748 }, // і
+    { 12, 22, 12, 0, 22, 66, 1783 }, // ї
+    { 10, 29, 16, 3, 22, 73, 1849 }, // ј
+    { 18, 15, 20, 1, 13, 68, 1922 }, // љ
+    { 16, 15, 10, -3, 14, 60, 1990 }, // њ
+    { 19, 21, 22, 0, 21, 100, 2050 }, // ћ
+    { 15, 21, 20, 3, 21, 79, 2150 }, // ќ
+    { 15, 25, 17, 1, 24, 94, 2229 }, // ѝ
+    { 17, 33, 23, 3, 26, 141, 2323 }, // ў
+    { 12, 18, 15, 1, 13, 54, 2464 }, // џ
+    { 18, 21, 19, 0, 19, 95, 2518 }, // Ѣ
+    { 17, 21, 16, -1, 19, 90, 2613 }, // ѣ
+    { 23, 21, 22, -1, 20, 121, 2703 }, // Ѫ
+    { 17, 14, 15, -1, 13, 60, 2824 }, // ѫ
+    { 20, 27, 28, 4, 26, 135, 2884 }, // Ѳ
+    { 16, 22, 22, 3, 21, 88, 3019 }, // ѳ
+    { 24, 26, 28, 4, 26, 156, 3107 }, // Ѵ
+    { 18, 19, 22, 2, 19, 86, 3263 }, // ѵ
+    { 11, 9, 0, 2, 24, 25, 3349 }, // ҆
+    { 15, 23, 16, 1, 22, 87, 3374 }, // Ґ
+    { 13, 20, 15, 1, 19, 65, 3461 }, // ґ
+    { 18, 20, 16, -2, 19, 90, 3526 }, // Ғ
+    { 12, 14, 11, -1, 13, 42, 3616 }, // ғ
+    { 16, 23, 15, -1, 22, 92, 3658 }, // Ҕ
+    { 10, 15, 9, 0, 13, 38, 3750 }, // ҕ
+    { 33, 26, 37, 2, 21, 215, 3788 }, // Җ
+    { 23, 18, 25, 1, 15, 104, 4003 }, // җ
+    { 13, 23, 16, 1, 18, 75, 4107 }, // Ҙ
+    { 9, 20, 11, 1, 13, 45, 4182 }, // ҙ
+    { 20, 25, 18, 2, 21, 125, 4227 }, // Қ
+    { 15, 18, 13, 1, 15, 68, 4352 }, // қ
+    { 25, 20, 27, 1, 19, 125, 4420 }, // Ҝ
+    { 17, 15, 19, 1, 14, 64, 4545 }, // ҝ
+    { 19, 21, 26, 4, 21, 100, 4609 }, // Ҟ
+    { 18, 21, 23, 1, 21, 95, 4709 }, // ҟ
+    { 23, 21, 26, 0, 21, 121, 4804 }, // Ҡ
+    { 16, 15, 18, 0, 15, 60, 4925 }, // ҡ
+    { 20, 24, 19, 0, 21, 120, 4985 }, // Ң
+    { 14, 17, 13, 0, 15, 60, 5105 }, // ң
+    { 27, 21, 26, 4, 21, 142, 5165 }, // Ҥ
+    { 20, 15, 18, 2, 15, 75, 5307 }, // ҥ
+    { 26, 22, 32, 3, 21, 143, 5382 }, // Ҧ
+    { 24, 25, 32, 3, 17, 150, 5525 }, // ҧ
+    { 25, 21, 17, -4, 19, 132, 5675 }, // Ҩ
+    { 20, 18, 14, -3, 16, 90, 5807 }, // ҩ
+    { 18, 27, 25, 3, 23, 122, 5897 }, // Ҫ
+    { 13, 19, 20, 3, 16, 62, 6019 }, // ҫ
+    { 19, 24, 19, 1, 21, 114, 6081 }, // Ҭ
+    { 14, 18, 13, 0, 15, 63, 6195 }, // ҭ
+    { 19, 21, 27, 4, 21, 100, 6258 }, // Ү
+    { 15, 20, 19, 2, 14, 75, 6358 }, // ү
+    { 19, 21, 27, 4, 21, 100, 6433 }, // Ұ
+    { 17, 20, 19, 1, 14, 85, 6533 }, // ұ
+    { 21, 25, 20, 3, 21, 132, 6618 }, // Ҳ
+    { 15, 17, 14, 2, 15, 64, 6750 }, // ҳ
+    { 23, 24, 15, -4, 19, 138, 6814 }, // Ҵ
+    { 17, 18, 11, -3, 13, 77, 6952 }, // ҵ
+    { 17, 24, 17, 0, 18, 102, 7029 }, // Ҷ
+    { 12, 18, 12, 0, 13, 54, 7131 }, // ҷ
+    { 14, 19, 17, 1, 19, 67, 7185 }, // Ҹ
+    { 10, 13, 11, 1, 13, 33, 7252 }, // ҹ
+    { 15, 22, 17, 1, 21, 83, 7285 }, // Һ
+    { 16, 21, 22, 3, 21, 84, 7368 }, // һ
+    { 28, 21, 24, -5, 20, 147, 7452 }, // Ҽ
+    { 20, 14, 17, -4, 13, 70, 7599 }, // ҽ
+    { 28, 25, 22, -4, 20, 175, 7669 }, // Ҿ
+    { 21, 17, 16, -3, 13, 90, 7844 }, // ҿ
+    { 6, 21, 14, 4, 21, 32, 7934 }, // Ӏ
+    { 31, 34, 28, -1, 34, 264, 7966 }, // Ӂ
+    { 29, 29, 35, 3, 29, 211, 8230 }, // ӂ
+    { 16, 26, 18, 1, 19, 104, 8441 }, // Ӄ
+    { 11, 19, 12, 1, 13, 53, 8545 }, // ӄ
+    { 19, 25, 15, -1, 19, 119, 8598 }, // Ӆ
+    { 13, 17, 10, -1, 13, 56, 8717 }, // ӆ
+    { 20, 28, 26, 4, 21, 140, 8773 }, // Ӈ
+    { 15, 20, 18, 2, 15, 75, 8913 }, // ӈ
+    { 20, 29, 26, 4, 21, 145, 8988 }, // Ӊ
+    { 15, 21, 18, 2, 15, 79, 9133 }, // ӊ
+    { 15, 24, 17, 1, 18, 90, 9212 }, // Ӌ
+    { 10, 17, 15, 3, 13, 43, 9302 }, // ӌ
+    { 24, 30, 29, 4, 21, 180, 9345 }, // Ӎ
+    { 17, 21, 20, 2, 15, 90, 9525 }, // ӎ
+    { 5, 19, 15, 5, 18, 24, 9615 }, // ӏ
+    { 22, 29, 24, 1, 29, 160, 9639 }, // Ӑ
+    { 15, 24, 21, 3, 23, 90, 9799 }, // ӑ
+    { 22, 28, 24, 1, 28, 154, 9889 }, // Ӓ
+    { 15, 24, 21, 3, 23, 90, 10043 }, // ӓ
+    { 32, 22, 34, 1, 21, 176, 10133 }, // Ӕ
+    { 25, 17, 31, 3, 16, 107, 10309 }, // ӕ
+    { 16, 30, 22, 3, 30, 120, 10416 }, // Ӗ
+    { 15, 27, 21, 3, 26, 102, 10536 }, // ӗ
+    { 18, 21, 27, 5, 19, 95, 10638 }, // Ә
+    { 15, 17, 21, 4, 16, 64, 10733 }, // ә
+    { 18, 29, 27, 5, 27, 131, 10797 }, // Ӛ
+    { 15, 21, 21, 4, 16, 79, 10928 }, // ӛ
+    { 31, 32, 35, 2, 32, 248, 11007 }, // Ӝ
+    { 29, 28, 35, 3, 28, 203, 11255 }, // ӝ
+    { 13, 30, 16, 1, 29, 98, 11458 }, // Ӟ
+    { 12, 20, 11, -1, 20, 60, 11556 }, // ӟ
+    { 13, 21, 17, 2, 19, 69, 11616 }, // Ӡ
+    { 13, 20, 17, 2, 14, 65, 11685 }, // ӡ
+    { 18, 32, 26, 4, 32, 144, 11750 }, // Ӣ
+    { 15, 24, 17, 1, 23, 90, 11894 }, // ӣ
+    { 18, 31, 26, 4, 31, 140, 11984 }, // Ӥ
+    { 15, 23, 17, 1, 22, 87, 12124 }, // ӥ
+    { 21, 31, 28, 4, 29, 163, 12211 }, // Ӧ
+    { 16, 26, 22, 2, 25, 104, 12374 }, // ӧ
+    { 19, 20, 28, 4, 19, 95, 12478 }, // Ө
+    { 15, 16, 22, 3, 15, 60, 12573 }, // ө
+    { 19, 28, 28, 4, 27, 133, 12633 }, // Ӫ
+    { 15, 23, 22, 3, 22, 87, 12766 }, // ӫ
+    { 19, 32, 21, 1, 30, 152, 12853 }, // Ӭ
+    { 14, 20, 16, 1, 20, 70, 13005 }, // ӭ
+    { 17, 33, 20, 1, 30, 141, 13075 }, // Ӯ
+    { 17, 33, 23, 3, 26, 141, 13216 }, // ӯ
+    { 17, 32, 20, 1, 29, 136, 13357 }, // Ӱ
+    { 17, 32, 23, 3, 25, 136, 13493 }, // ӱ
+    { 22, 32, 20, 1, 29, 176, 13629 }, // Ӳ
+    { 22, 32, 23, 3, 25, 176, 13805 }, // ӳ
+    { 14, 25, 17, 1, 25, 88, 13981 }, // Ӵ
+    { 12, 19, 11, 0, 19, 57, 14069 }, // ӵ
+    { 15, 23, 16, 1, 19, 87, 14126 }, // Ӷ
+    { 11, 16, 11, 0, 13, 44, 14213 }, // ӷ
+    { 25, 32, 29, 1, 32, 200, 14257 }, // Ӹ
+    { 19, 26, 22, 0, 26, 124, 14457 }, // ӹ
+    { 23, 24, 28, 4, 21, 138, 14581 }, // Ӽ
+    { 17, 17, 19, 2, 15, 73, 14719 }, // ӽ
+    { 0, 0, 17, 0, 0, 0, 14792 }, //  
+    { 0, 0, 29, 0, 0, 0, 14792 }, //  
+    { 0, 0, 17, 0, 0, 0, 14792 }, //  
+    { 0, 0, 29, 0, 0, 0, 14792 }, //  
+    { 0, 0, 12, 0, 0, 0, 14792 }, //  
+    { 0, 0, 10, 0, 0, 0, 14792 }, //  
+    { 0, 0, 8, 0, 0, 0, 14792 }, //  
+    { 0, 0, 18, 0, 0, 0, 14792 }, //  
+    { 0, 0, 7, 0, 0, 0, 14792 }, //  
+    { 0, 0, 9, 0, 0, 0, 14792 }, //  
+    { 0, 0, 8, 0, 0, 0, 14792 }, //  
+    { 0, 0, 4, 0, 0, 0, 14792 }, // ​
+    { 0, 0, 0, 0, 0, 0, 14792 }, // ‌
+    { 0, 0, 0, 0, 0, 0, 14792 }, // ‍
+    { 0, 0, 0, 0, 0, 0, 14792 }, // ‎
+    { 0, 0, 0, 0, 0, 0, 14792 }, // ‏
+    { 14, 3, 14, 0, 9, 11, 14792 }, // ‐
+    { 14, 3, 14, 0, 9, 11, 14803 }, // ‑
+    { 20, 3, 14, -3, 9, 15, 14814 }, // ‒
+    { 18, 5, 20, 1, 10, 23, 12844 }, // –
+    { 26, 5, 29, 1, 10, 33, 12867 }, // —
+    { 26, 5, 29, 1, 10, 33, 14829 }, // ―
+    { 13, 23, 14, 2, 18, 75, 14862 }, // ‖
+    { 21, 8, 14, -4, -2, 42, 14937 }, // ‗
+    { 9, 9, 11, 1, 22, 21, 12900 }, // ‘
+    { 9, 9, 11, 1, 22, 21, 12921 }, // ’
+    { 8, 9, 8, 0, 4, 18, 14979 }, // ‚
+    { 9, 9, 11, 1, 22, 21, 14997 }, // ‛
+    { 17, 9, 19, 1, 22, 39, 12942 }, // “
+    { 17, 9, 19, 1, 22, 39, 12981 }, // ”
+    { 8, 9, 8, 0, 4, 18, 15018 }, // „
+    { 17, 9, 19, 1, 22, 39, 15036 }, // ‟
+    { 16, 35, 20, 2, 26, 140, 15075 }, // †
+    { 15, 35, 22, 4, 26, 132, 15215 }, // ‡
+    { 20, 19, 13, -4, 22, 95, 15347 }, // •
+    { 9, 9, 15, 3, 11, 21, 15442 }, // ‣
+    { 7, 6, 15, 4, 6, 11, 15463 }, // ․
+    { 7, 6, 15, 4, 6, 11, 15474 }, // ‥
+    { 24, 6, 24, 0, 6, 36, 13020 }, // …
+    { 4, 3, 14, 5, 9, 3, 15485 }, // ‧
+    { 0, 0, 28, 0, 0, 0, 15488 }, //  
+    { 19, 22, 28, 5, 20, 105, 15488 }, // ‰
+    { 9, 9, 14, 4, 22, 21, 15593 }, // ′
+    { 17, 9, 20, 4, 22, 39, 15614 }, // ″
+    { 20, 8, 10, 1, 21, 40, 15653 }, // ‴
+    { 7, 8, 10, 2, 21, 14, 15693 }, // ‵
+    { 12, 8, 10, 0, 21, 24, 15707 }, // ‶
+    { 20, 8, 10, -5, 21, 40, 15731 }, // ‷
+    { 14, 6, 16, 1, 21, 21, 15771 }, // ‸
+    { 8, 14, 10, 1, 14, 28, 15792 }, // ‹
+    { 8, 14, 10, 1, 14, 28, 15820 }, // ›
+    { 28, 32, 34, 4, 25, 224, 15848 }, // ※
+    { 8, 32, 15, 3, 28, 64, 16072 }, // ‼
+    { 16, 40, 22, 2, 34, 160, 16136 }, // ‽
+    { 14, 3, 14, 0, 21, 11, 16296 }, // ‾
+    { 13, 5, 14, 0, 17, 17, 16307 }, // ‿
+    { 18, 17, 16, -1, 23, 77, 16324 }, // ⁂
+    { 17, 22, 31, 7, 20, 94, 16401 }, // ⁄
+    { 31, 31, 38, 3, 28, 241, 16495 }, // ⁇
+    { 26, 32, 30, 2, 28, 208, 16736 }, // ⁈
+    { 21, 32, 19, -1, 28, 168, 16944 }, // ⁉
+    { 19, 44, 23, 2, 30, 209, 17112 }, // ⁒
+    { 0, 0, 117, 0, 0, 0, 17321 }, //  
+    { 8, 10, 8, 0, 21, 20, 17321 }, // ⁰
+    { 8, 9, 9, 0, 21, 18, 17341 }, // ⁴
+    { 7, 11, 9, 1, 22, 20, 17359 }, // ⁵
+    { 7, 10, 9, 1, 21, 18, 17379 }, // ⁶
+    { 7, 11, 9, 1, 22, 20, 17397 }, // ⁷
+    { 9, 11, 9, 0, 21, 25, 17417 }, // ⁸
+    { 8, 11, 9, 0, 21, 22, 17442 }, // ⁹
+    { 15, 16, 22, 3, 16, 60, 17464 }, // ⁿ
+    { 7, 10, 9, 1, 6, 18, 17524 }, // ₀
+    { 7, 11, 8, 1, 6, 20, 17542 }, // ₁
+    { 7, 11, 9, 1, 6, 20, 17562 }, // ₂
+    { 7, 10, 9, 1, 6, 18, 17582 }, // ₃
+    { 8, 10, 9, 1, 6, 20, 17600 }, // ₄
+    { 7, 10, 8, 1, 6, 18, 17620 }, // ₅
+    { 7, 10, 9, 1, 6, 18, 17638 }, // ₆
+    { 7, 11, 9, 1, 6, 20, 17656 }, // ₇
+    { 9, 11, 9, 0, 6, 25, 17676 }, // ₈
+    { 8, 11, 9, 1, 6, 22, 17701 }, // ₉
+    { 11, 35, 12, 1, 26, 97, 17723 }, // ₍
+    { 11, 35, 11, -1, 26, 97, 17820 }, // ₎
+    { 18, 33, 25, 3, 28, 149, 17917 }, // ₡
+    { 18, 23, 25, 3, 23, 104, 18066 }, // ₢
+    { 17, 23, 17, 0, 22, 98, 18170 }, // ₤
+    { 27, 21, 26, -1, 21, 142, 18268 }, // ₦
+    { 22, 22, 23, 0, 22, 121, 18410 }, // ₧
+    { 27, 23, 33, 3, 21, 156, 18531 }, // ₨
+    { 21, 22, 21, 0, 22, 116, 18687 }, // ₩
+    { 20, 19, 27, 3, 19, 95, 18803 }, // ₪
+    { 19, 22, 13, -2, 21, 105, 18898 }, // ₫
+    { 18, 24, 19, 0, 20, 108, 19003 }, // €
+    { 19, 22, 26, 4, 22, 105, 19111 }, // ₮
+    { 25, 22, 16, -1, 22, 138, 19216 }, // ₱
+    { 21, 33, 29, 4, 28, 174, 19354 }, // ₲
+    { 25, 21, 26, 5, 19, 132, 19528 }, // ₴
+    { 13, 20, 15, 3, 18, 65, 19660 }, // ₵
+    { 20, 23, 26, 3, 23, 115, 19725 }, // ₸
+    { 13, 21, 17, 2, 20, 69, 19840 }, // ₹
+    { 15, 19, 17, 1, 17, 72, 19909 }, // ₺
+    { 18, 21, 20, 1, 20, 95, 19981 }, // ₼
+    { 21, 22, 23, -2, 22, 116, 20076 }, // ₽
+    { 17, 18, 18, 0, 15, 77, 20192 }, // ←
+    { 19, 18, 19, 0, 17, 86, 20269 }, // ↑
+    { 17, 18, 19, 1, 15, 77, 20355 }, // →
+    { 19, 17, 19, 0, 16, 81, 20432 }, // ↓
+    { 21, 15, 26, 2, 14, 79, 20513 }, // ↔
+    { 16, 20, 20, 2, 22, 80, 0 }, // ↕
+    { 15, 14, 20, 2, 13, 53, 80 }, // ↖
+    { 14, 14, 16, 1, 13, 49, 133 }, // ↗
+    { 14, 14, 16, 1, 14, 49, 182 }, // ↘
+    { 14, 14, 16, 1, 14, 49, 231 }, // ↙
+    { 20, 18, 24, 2, 16, 90, 280 }, // ⇐
+    { 22, 20, 27, 2, 19, 110, 370 }, // ⇑
+    { 20, 18, 24, 2, 16, 90, 480 }, // ⇒
+    { 22, 20, 27, 2, 18, 110, 570 }, // ⇓
+    { 23, 18, 27, 2, 16, 104, 680 }, // ⇔
+    { 18, 22, 22, 2, 13, 99, 784 }, // ⇕
+    { 15, 22, 17, 1, 21, 83, 883 }, // ∂
+    { 26, 26, 28, 1, 23, 169, 966 }, // ∅
+    { 20, 20, 22, 1, 19, 100, 1135 }, // ∆
+    { 17, 20, 18, 1, 19, 85, 1235 }, // ∏
+    { 17, 19, 18, 1, 18, 81, 1320 }, // ∐
+    { 13, 20, 15, 1, 19, 65, 1401 }, // ∑
+    { 15, 4, 15, 0, 9, 15, 1466 }, // −
+    { 22, 23, 24, 1, 21, 127, 1481 }, // √
+    { 21, 14, 23, 1, 16, 74, 1608 }, // ∞
+    { 20, 27, 21, 1, 20, 135, 1682 }, // ∫
+    { 7, 17, 8, 1, 17, 30, 1817 }, // ∶
+    { 15, 14, 36, 10, 14, 53, 1847 }, // ≈
+    { 19, 22, 31, 6, 20, 105, 1900 }, // ≠
+    { 21, 21, 20, -1, 18, 111, 2005 }, // ≤
+    { 22, 22, 22, 0, 19, 121, 2116 }, // ≥
+    { 21, 22, 27, 3, 22, 116, 2237 }, // ﬀ
+    { 18, 24, 24, 3, 24, 108, 2353 }, // ﬁ
+    { 21, 22, 27, 3, 22, 116, 2461 }, // ﬂ
+    { 28, 24, 33, 4, 24, 168, 2577 }, // ﬃ
+    { 31, 22, 37, 3, 22, 171, 2745 }, // ﬄ
+    { 26, 22, 30, 2, 20, 143, 2916 }, // ﬆ
 };
 
 static const EpdUnicodeInterval opendyslexic_12_boldIntervals[] = {
@@ -2603,30 +2594,90 @@ static const EpdUnicodeInterval opendyslexic_12_boldIntervals[] = {
     { 0x2248, 0x2248, 0x2D1 },
     { 0x2260, 0x2260, 0x2D2 },
     { 0x2264, 0x2265, 0x2D3 },
+    { 0xFB00, 0xFB04, 0x2D5 },
+    { 0xFB06, 0xFB06, 0x2DA },
 };
 
 static const EpdFontGroup opendyslexic_12_boldGroups[] = {
-    { 0, 4096, 7474, 95, 0 },
-    { 4096, 3940, 9366, 96, 95 },
-    { 8036, 5840, 14961, 126, 191 },
-    { 13876, 852, 1316, 61, 317 },
-    { 14728, 9601, 20627, 213, 378 },
-    { 24329, 1393, 2741, 63, 591 },
-    { 25722, 467, 596, 20, 654 },
-    { 26189, 1282, 2275, 20, 674 },
-    { 27471, 709, 1283, 16, 694 },
-    { 28180, 731, 1354, 15, 710 },
+    { 0, 5628, 13056, 151, 0 },
+    { 5628, 3027, 5485, 66, 379 },
+    { 8655, 8398, 20623, 237, 96 },
+    { 17053, 10040, 20592, 245, 382 },
+    { 27093, 1564, 3059, 32, 699 },
+};
+
+static const uint8_t opendyslexic_12_boldGlyphGroups[731] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 0,
+    0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 2, 2, 2, 0,
+    0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 2, 2, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 3, 1, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 0, 0, 3, 3, 3, 0, 0, 3, 3, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+};
+
+static const uint16_t opendyslexic_12_boldGlyphLookup[368] = {
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x005F, 0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E,
+    0x006F, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E,
+    0x007F, 0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E,
+    0x008F, 0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E,
+    0x009F, 0x00A0, 0x00A1, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE,
+    0x00AF, 0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE,
+    0x024F, 0x0250, 0x0251, 0x0252, 0x0253, 0x0254, 0x0255, 0x0256, 0x0257, 0x0258, 0x0259, 0x025A, 0x025B, 0x025C, 0x025D, 0x025E,
+    0x025F, 0x0260, 0x0261, 0x0262, 0x0263, 0x0264, 0x0265, 0x0266, 0x0267, 0x0268, 0x0269, 0x026A, 0x026B, 0x026C, 0x026D, 0x026E,
+    0x026F, 0x0270, 0x0271, 0x0272, 0x0273, 0x0274, 0x0275, 0x0276, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0277,
+    0x0278, 0xFFFF, 0x0279, 0x027A, 0x027B, 0x027C, 0x027D, 0x027E, 0x027F, 0x0280, 0x0281, 0x0282, 0x0283, 0x0284, 0x0285, 0x0286,
+    0xFFFF, 0xFFFF, 0x0287, 0xFFFF, 0x0288, 0xFFFF, 0xFFFF, 0x0289, 0x028A, 0x028B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x028C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x028D,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
 };
 
 static const EpdFontData opendyslexic_12_bold = {
     opendyslexic_12_boldBitmaps,
     opendyslexic_12_boldGlyphs,
     opendyslexic_12_boldIntervals,
-    56,
+    58,
     46,
     33,
     -13,
     true,
     opendyslexic_12_boldGroups,
-    10,
+    5,
+    nullptr,
+    nullptr,
+    nullptr,
+    0,
+    nullptr,
+    0,
+    0,
+    opendyslexic_12_boldGlyphLookup,
+    opendyslexic_12_boldGlyphGroups,
+    false,
+    nullptr,
 };
@@ -3,2083 +3,2066 @@
  * name: opendyslexic_12_bolditalic
  * size: 12
  * mode: 2-bit  compressed: true
- * Command used: fontconvert.py opendyslexic_12_bolditalic 12 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-BoldItalic.otf --2bit --compress
+ * Command used: fontconvert.py opendyslexic_12_bolditalic 12 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-BoldItalic.otf --2bit --compress --no-kerning --frequency-corpus ../../../test/hyphenation_eval/resources/english_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/french_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/german_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/italian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/russian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/spanish_hyphenation_tests.txt
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t opendyslexic_12_bolditalicBitmaps[33132] = {
-    0x85, 0x5A, 0xBD, 0xAF, 0xDF, 0xE6, 0x75, 0x7E, 0x49, 0x5A, 0x22, 0x2A, 0x0E, 0xCC, 0x10, 0x05,
-    0x68, 0x55, 0x94, 0x1D, 0x3A, 0x14, 0x0E, 0x5A, 0xFE, 0x03, 0x36, 0x48, 0x5B, 0x83, 0x87, 0x0C,
-    0xD6, 0x20, 0xB5, 0x40, 0x3D, 0x18, 0x05, 0x32, 0x34, 0x0E, 0x8A, 0xBB, 0x76, 0x48, 0x4D, 0x36,
-    0x1E, 0x34, 0x74, 0xC8, 0xED, 0xE0, 0xAE, 0xD1, 0x60, 0x17, 0xCE, 0x5D, 0xD4, 0xA1, 0x43, 0x03,
-    0xB8, 0x22, 0x03, 0x03, 0xD5, 0xD0, 0x21, 0x74, 0x94, 0xD4, 0x43, 0x86, 0xD0, 0xC6, 0x35, 0x1C,
-    0x38, 0x40, 0x4D, 0x57, 0x54, 0xC3, 0x6B, 0x91, 0x7C, 0xFB, 0x3C, 0xCF, 0x21, 0x7F, 0xF7, 0xCA,
-    0x72, 0xD1, 0x9F, 0x2E, 0x7E, 0x1F, 0xE4, 0xFB, 0x71, 0xDE, 0x73, 0x9E, 0xF3, 0x9C, 0x0F, 0xCA,
-    0x39, 0xBE, 0xFE, 0xC8, 0xB9, 0xA8, 0x75, 0xEE, 0x75, 0xE7, 0x92, 0xDE, 0xB9, 0xD9, 0xB9, 0xAC,
-    0x75, 0xD1, 0xE4, 0x5C, 0x51, 0xBA, 0x64, 0x70, 0xCE, 0x3B, 0x97, 0xF6, 0x2E, 0xC4, 0xF5, 0xA2,
-    0x75, 0x31, 0xAE, 0x37, 0xA5, 0x4B, 0x71, 0xBD, 0x72, 0x2E, 0xE8, 0x9C, 0x7B, 0xC6, 0x3D, 0xFD,
-    0xCA, 0x07, 0x17, 0x61, 0x5A, 0xD3, 0xBB, 0x74, 0x75, 0xA1, 0xEF, 0x5C, 0xB1, 0xB8, 0xD8, 0xB7,
-    0xAE, 0x9A, 0x8A, 0x39, 0x5D, 0xD2, 0x35, 0xF2, 0x2F, 0xFA, 0xBA, 0xE9, 0xAA, 0x3E, 0x9B, 0xD2,
-    0x29, 0xF2, 0x18, 0xEB, 0x5B, 0xDF, 0xE5, 0x53, 0x3E, 0x5D, 0xFE, 0x51, 0x78, 0xC2, 0x15, 0xB2,
-    0x16, 0xBB, 0xE3, 0xB5, 0x06, 0x33, 0x3F, 0xE2, 0x01, 0x22, 0x38, 0x4A, 0x50, 0xD9, 0xE5, 0x50,
-    0x97, 0x13, 0x5D, 0x0E, 0xBD, 0x5E, 0x2E, 0xD3, 0xC7, 0xE0, 0xEC, 0x67, 0x1D, 0xDC, 0x6A, 0x7E,
-    0xE1, 0xDF, 0xBC, 0x89, 0xFB, 0x4B, 0xA4, 0xD1, 0xE9, 0x90, 0x77, 0xFC, 0x6C, 0x6A, 0xCF, 0x8F,
-    0x68, 0xE6, 0x61, 0x5C, 0xA5, 0xD1, 0x6D, 0xA4, 0x8F, 0xC5, 0xE5, 0xDB, 0x22, 0xB7, 0xAA, 0x47,
-    0xCD, 0xC7, 0xB7, 0x70, 0xDF, 0xBF, 0xA0, 0xD1, 0xC9, 0x9C, 0x4E, 0x92, 0x60, 0x28, 0xB8, 0x48,
-    0x80, 0x13, 0xF0, 0xE7, 0xE5, 0x77, 0x2E, 0xBF, 0xF5, 0xE4, 0xD9, 0x4D, 0x5E, 0x49, 0x9B, 0x53,
-    0xD6, 0x60, 0xC1, 0xDB, 0x35, 0xC8, 0x03, 0x95, 0xF8, 0x59, 0xFB, 0x75, 0xF8, 0xFA, 0xE0, 0x0C,
-    0xF7, 0xC7, 0x14, 0x7A, 0xF7, 0x25, 0x34, 0x19, 0x2D, 0x21, 0x96, 0xCF, 0xD6, 0x97, 0xB1, 0x78,
-    0xE1, 0xB9, 0x74, 0xE3, 0x7D, 0xA9, 0xF7, 0x7A, 0x9B, 0x8E, 0x91, 0xBC, 0x1E, 0x61, 0x91, 0x3F,
-    0xC6, 0x59, 0x87, 0xD0, 0x97, 0x8D, 0xAF, 0x31, 0xD8, 0xCF, 0x12, 0xBE, 0xC5, 0x28, 0x3F, 0xBA,
-    0xA0, 0xF1, 0x12, 0x94, 0x4B, 0x63, 0x2D, 0xBE, 0x99, 0x0E, 0x93, 0xFE, 0x09, 0x39, 0x6F, 0x9C,
-    0x0F, 0x9A, 0x79, 0x2F, 0xED, 0x02, 0x1C, 0x7B, 0x71, 0xE9, 0xF5, 0x0E, 0xBF, 0xFE, 0x35, 0x2D,
-    0x1B, 0xA0, 0xE2, 0xB9, 0x78, 0x70, 0xE9, 0x8B, 0x43, 0x45, 0xA1, 0x5E, 0x1A, 0x21, 0xCE, 0x44,
-    0xB3, 0xDC, 0xBB, 0x6E, 0xAA, 0xF8, 0x77, 0x7C, 0x84, 0x73, 0x83, 0xD5, 0xF3, 0xFB, 0xED, 0x00,
-    0x3D, 0x3F, 0x0F, 0x1C, 0x65, 0xDD, 0x90, 0xB9, 0x60, 0x8D, 0x7F, 0x32, 0x41, 0xE1, 0x19, 0x8C,
-    0xEE, 0x69, 0x7D, 0x00, 0x26, 0xAF, 0x9D, 0x97, 0xF1, 0x5C, 0x70, 0xAF, 0xA4, 0x1E, 0x80, 0xA6,
-    0x31, 0xAB, 0x21, 0x22, 0xC6, 0x0F, 0xEE, 0x7B, 0x2E, 0x69, 0x23, 0x8C, 0x2A, 0x0B, 0x5C, 0x4A,
-    0x66, 0x1E, 0x9D, 0xCA, 0xA1, 0x56, 0x3C, 0xF5, 0xBD, 0xB8, 0xB7, 0xB2, 0x47, 0x4B, 0x34, 0xFA,
-    0x17, 0x96, 0xFC, 0xFE, 0x1C, 0xAE, 0x6B, 0x06, 0x0D, 0x0C, 0xCD, 0xA3, 0x23, 0x1F, 0xD0, 0x70,
-    0x54, 0xC1, 0x18, 0x7B, 0xFF, 0x41, 0x19, 0xFA, 0xDD, 0x22, 0xCF, 0xBE, 0x55, 0x4C, 0xC5, 0x58,
-    0x8C, 0xF9, 0x98, 0xCD, 0x29, 0x80, 0x97, 0xAC, 0xB8, 0xF8, 0xA7, 0xD8, 0x3B, 0xC1, 0x51, 0xC2,
-    0x55, 0x50, 0xC0, 0xF2, 0x03, 0xB1, 0x40, 0xF5, 0xE2, 0x4E, 0xD6, 0x6F, 0x3F, 0x9A, 0x8B, 0x3F,
-    0xAA, 0xDA, 0xC9, 0x15, 0x1C, 0xE7, 0x64, 0xDD, 0x76, 0x15, 0x82, 0xCA, 0x1F, 0x34, 0x56, 0xB7,
-    0xBD, 0x50, 0xF6, 0xD4, 0x97, 0x71, 0x5B, 0x3C, 0xD1, 0x60, 0x9C, 0x2A, 0xD6, 0x74, 0xAE, 0xC3,
-    0xFB, 0x14, 0xC0, 0x05, 0x44, 0x49, 0xBD, 0x8F, 0xA9, 0x2F, 0xCC, 0xE2, 0x3A, 0x01, 0x37, 0xCE,
-    0xBB, 0x0B, 0xE2, 0xA4, 0xBB, 0x38, 0x39, 0xD6, 0xA3, 0xB7, 0x6A, 0x2B, 0xC9, 0xB6, 0xFF, 0xE0,
-    0x9D, 0x78, 0xDC, 0x26, 0x17, 0xDB, 0x1C, 0x3B, 0xA9, 0x5C, 0xC9, 0x0E, 0xC8, 0x0D, 0xA3, 0x75,
-    0xDB, 0xAB, 0x6A, 0xE5, 0xBC, 0x8E, 0x58, 0x8F, 0x08, 0x5C, 0x5C, 0x0B, 0xEE, 0x08, 0x27, 0x7F,
-    0x58, 0x25, 0xD7, 0x1F, 0x9D, 0xCD, 0xF0, 0x8F, 0xA1, 0x82, 0x31, 0x52, 0x38, 0x18, 0x90, 0x0C,
-    0x34, 0x7F, 0xB8, 0x2E, 0x6B, 0xF4, 0x60, 0xB8, 0xF3, 0x0C, 0x68, 0xC3, 0xFD, 0xF8, 0x02, 0xC2,
-    0x60, 0x4D, 0x52, 0x89, 0xBB, 0x87, 0xAF, 0x23, 0x65, 0xA3, 0xA3, 0xBE, 0x0C, 0xB8, 0x02, 0xB3,
-    0x3D, 0xE9, 0x83, 0x4E, 0x4C, 0x07, 0x06, 0xA6, 0x04, 0xD1, 0x6A, 0x0A, 0x7D, 0x0B, 0xC6, 0x28,
-    0x88, 0xED, 0x74, 0x76, 0xBE, 0x83, 0xC5, 0x9E, 0xBD, 0x43, 0x87, 0xF8, 0x00, 0xD3, 0xE0, 0x0B,
-    0x6D, 0x70, 0x33, 0xEB, 0xFD, 0x4B, 0x4B, 0xF1, 0xB9, 0x6F, 0x6D, 0x93, 0xC0, 0x3E, 0x62, 0xFB,
-    0x69, 0x78, 0xDE, 0xA1, 0x1E, 0x0F, 0x26, 0xC7, 0xE4, 0xCE, 0xBD, 0xC0, 0x94, 0x46, 0x1D, 0xDB,
-    0x87, 0xD1, 0x8C, 0x74, 0xC5, 0xF9, 0x9D, 0x7D, 0xD8, 0x44, 0x2A, 0xEF, 0xFF, 0x9D, 0x5F, 0x5F,
-    0x9C, 0x9F, 0x7D, 0xE5, 0x7C, 0x9B, 0x18, 0x2E, 0x5F, 0x35, 0xBF, 0xB2, 0xF9, 0xC5, 0x36, 0xBF,
-    0xBF, 0x38, 0x3F, 0xF9, 0xCA, 0xF9, 0x7E, 0xFB, 0x30, 0xC1, 0xAB, 0xF6, 0xE2, 0xFC, 0x7C, 0x9B,
-    0x6F, 0x1F, 0x89, 0x5D, 0x8C, 0xCA, 0x8B, 0x9A, 0x72, 0x9B, 0x55, 0xE1, 0xEC, 0x50, 0x2C, 0x88,
-    0x7A, 0x81, 0xB6, 0xF2, 0x36, 0x6D, 0x41, 0x54, 0x85, 0x4B, 0x3F, 0xEF, 0x66, 0x57, 0xFD, 0xF0,
-    0xFE, 0x00, 0xBF, 0xC6, 0xC5, 0x87, 0xB3, 0x77, 0xD5, 0x0F, 0x3E, 0x99, 0xC2, 0xA5, 0xC8, 0xBB,
-    0x74, 0xFC, 0x4B, 0xF8, 0x72, 0x07, 0x6C, 0x80, 0xAD, 0x45, 0x98, 0x40, 0x01, 0x56, 0xC8, 0xC9,
-    0x4E, 0x15, 0x3D, 0xB5, 0x21, 0x4D, 0x55, 0xDA, 0xFC, 0x08, 0x97, 0x26, 0xB8, 0x2E, 0xDC, 0x71,
-    0x70, 0xCF, 0xAF, 0xEE, 0x12, 0x54, 0xF3, 0x54, 0x0C, 0x09, 0xBC, 0x44, 0x26, 0xD2, 0xAA, 0x2E,
-    0x32, 0x64, 0xDC, 0x86, 0x1F, 0x7B, 0x31, 0xDD, 0x25, 0xB1, 0x44, 0x2D, 0x3E, 0x8C, 0x48, 0x6D,
-    0x55, 0xD9, 0xD4, 0x57, 0xCE, 0x7D, 0x8F, 0xC8, 0xE5, 0x0A, 0xDA, 0x31, 0x23, 0x96, 0xF0, 0x23,
-    0x01, 0xBB, 0xC6, 0x18, 0x1B, 0x02, 0xA3, 0x90, 0xA7, 0x64, 0x54, 0x18, 0x24, 0x2B, 0x96, 0x19,
-    0x12, 0xEF, 0xA1, 0xFE, 0x4B, 0x08, 0x4C, 0x8E, 0x18, 0x84, 0xE4, 0x65, 0x74, 0x4C, 0xE6, 0x15,
-    0x50, 0x83, 0x69, 0x03, 0x04, 0x3C, 0x32, 0xE1, 0x7C, 0x8A, 0x91, 0x93, 0x53, 0x6F, 0x11, 0x6E,
-    0xB6, 0x71, 0x1B, 0x97, 0xD8, 0x0B, 0x0B, 0x96, 0xDB, 0xCA, 0x0B, 0x29, 0xBD, 0x74, 0xCD, 0x2A,
-    0x35, 0xFF, 0xB5, 0x31, 0x3E, 0x3D, 0x9C, 0x22, 0x41, 0x07, 0xC1, 0xE3, 0xD1, 0xC5, 0x9F, 0x0C,
-    0x2E, 0xFB, 0xFB, 0xC1, 0x55, 0xE9, 0x10, 0xCC, 0x69, 0x1F, 0x23, 0x12, 0x61, 0xF6, 0x02, 0x91,
-    0x66, 0x4C, 0x9E, 0xAF, 0xFE, 0x85, 0x3F, 0x95, 0x45, 0x79, 0x1C, 0x72, 0x42, 0xB4, 0x9E, 0x1B,
-    0x0B, 0xA4, 0x06, 0x7F, 0x80, 0x7A, 0xB9, 0x55, 0xB1, 0x89, 0x4A, 0x0B, 0xD3, 0xBF, 0x02, 0xFF,
-    0x05, 0x8F, 0x39, 0xF2, 0x74, 0xE5, 0x95, 0x37, 0x8F, 0x36, 0x0F, 0xC7, 0x3A, 0xA5, 0xF3, 0xF5,
-    0xF3, 0x81, 0x6F, 0x29, 0x25, 0xCD, 0xB4, 0x2D, 0xD3, 0xBB, 0x6B, 0xAB, 0x20, 0x17, 0x7C, 0xE7,
-    0x06, 0x94, 0xB4, 0x62, 0x28, 0xAE, 0x35, 0x58, 0x3A, 0x3B, 0x35, 0x3F, 0xA5, 0xBF, 0xBA, 0xF4,
-    0x97, 0x67, 0x8C, 0xAB, 0x5A, 0xB7, 0x8D, 0xFD, 0x07, 0xAB, 0x6B, 0xBA, 0x74, 0xA0, 0xE9, 0xF1,
-    0x2F, 0xED, 0xD3, 0x01, 0x68, 0xF4, 0xE0, 0xB2, 0x94, 0x63, 0xA8, 0xD4, 0x88, 0x20, 0x48, 0x6C,
-    0x69, 0x6A, 0xE7, 0x3D, 0x5C, 0xCC, 0x15, 0x8F, 0x80, 0x50, 0x6A, 0x84, 0x98, 0x06, 0xAF, 0x51,
-    0x3A, 0x32, 0x0C, 0x0E, 0x9B, 0xCE, 0x32, 0x1D, 0xCF, 0x9B, 0x41, 0xF3, 0x32, 0x1C, 0x14, 0x4C,
-    0xDB, 0xB5, 0x4C, 0x1C, 0x88, 0xE7, 0xC9, 0x0C, 0x90, 0xAC, 0x4D, 0x0B, 0x1A, 0xC3, 0xF9, 0xEB,
-    0xB4, 0x8D, 0x47, 0xB8, 0x62, 0x55, 0x56, 0x6D, 0xBC, 0x1C, 0x8D, 0xB8, 0xBD, 0x12, 0x26, 0xD4,
-    0xC2, 0xEC, 0x8A, 0x3E, 0xEF, 0x41, 0x9C, 0x08, 0x09, 0x8C, 0xF6, 0x7D, 0xB8, 0x86, 0xFE, 0x1F,
-    0x91, 0x58, 0x40, 0xC5, 0x0C, 0x12, 0x30, 0x2A, 0x56, 0xBE, 0xA2, 0x58, 0xFA, 0xCD, 0x53, 0x62,
-    0x85, 0xDB, 0xE2, 0x2D, 0x1D, 0x21, 0x5D, 0x03, 0xF6, 0x80, 0x4A, 0x11, 0x8E, 0x6A, 0x44, 0xC4,
-    0x77, 0xC1, 0xE8, 0xFC, 0xD5, 0xA6, 0x5D, 0x0C, 0x46, 0x7A, 0x4C, 0xF8, 0x71, 0x76, 0x43, 0x4C,
-    0x1C, 0x3D, 0x9E, 0xE4, 0xF3, 0x01, 0xA3, 0x48, 0xB6, 0x02, 0xE1, 0x8C, 0xD6, 0xC2, 0xE8, 0x15,
-    0x7F, 0x30, 0x1D, 0x50, 0xD4, 0xB4, 0xB0, 0x24, 0x0E, 0x01, 0x26, 0xDB, 0xFC, 0xF5, 0xF0, 0x82,
-    0x34, 0xB3, 0x98, 0xAE, 0xC6, 0x51, 0x2B, 0xF3, 0x74, 0xAC, 0x86, 0xF1, 0x31, 0xD8, 0x75, 0x21,
-    0x7A, 0x8A, 0xF9, 0xCB, 0x89, 0xD5, 0xC9, 0x1D, 0xE7, 0x7B, 0x18, 0x15, 0xB3, 0xA0, 0xB6, 0xC4,
-    0x46, 0x8D, 0x9B, 0xCB, 0xD9, 0x12, 0xE5, 0xCE, 0x7F, 0x95, 0x70, 0xE0, 0x09, 0xA0, 0x95, 0x41,
-    0x74, 0xA2, 0x9A, 0x7A, 0xBE, 0x75, 0x74, 0x95, 0x56, 0x89, 0xD3, 0xB1, 0x8C, 0x75, 0xCA, 0xAC,
-    0x81, 0x03, 0x8E, 0x94, 0x74, 0xE4, 0x1C, 0xE6, 0xAE, 0x69, 0xF7, 0xCB, 0x7C, 0xFB, 0x3A, 0x95,
-    0x8B, 0xD1, 0x33, 0x40, 0x34, 0x5F, 0xBA, 0xB1, 0x6D, 0x75, 0xF5, 0xB5, 0x63, 0x98, 0xBF, 0x07,
-    0xC0, 0xFA, 0x62, 0x3D, 0x39, 0xB6, 0x8B, 0x57, 0xCE, 0x19, 0x53, 0xAB, 0xD0, 0x81, 0x85, 0xB3,
-    0x4D, 0x04, 0x93, 0x41, 0x72, 0xE1, 0x42, 0xCD, 0x8D, 0x3B, 0x6E, 0x3B, 0x25, 0xCC, 0xD9, 0x12,
-    0xCA, 0x12, 0xF9, 0x33, 0x8E, 0xE0, 0x82, 0xDF, 0xBE, 0x70, 0xF6, 0xE4, 0x8C, 0x33, 0x66, 0x1A,
-    0x71, 0xC0, 0xDD, 0xAA, 0x4E, 0x6A, 0x10, 0xCA, 0xD7, 0x44, 0xBD, 0xE1, 0x21, 0x1E, 0x8F, 0x7B,
-    0xF0, 0x63, 0x68, 0x9B, 0x99, 0x3A, 0xD9, 0x61, 0x43, 0x6E, 0x5B, 0x0C, 0x9B, 0x6B, 0x55, 0x54,
-    0x01, 0xF5, 0x43, 0xA7, 0xFD, 0xFA, 0x53, 0xF9, 0xEB, 0xD5, 0x8D, 0x83, 0xC5, 0x2E, 0x44, 0xAB,
-    0xE2, 0x74, 0xF3, 0x64, 0x02, 0x75, 0x74, 0x26, 0x1A, 0xF7, 0xDC, 0xB1, 0x3A, 0x3B, 0xC2, 0x8A,
-    0x19, 0xD0, 0x68, 0xAC, 0x3D, 0x1A, 0x09, 0x30, 0x93, 0xF9, 0x2F, 0xF7, 0x9C, 0x4B, 0x3F, 0xF2,
-    0x7D, 0xD4, 0x06, 0xF3, 0xDF, 0x3C, 0x8F, 0x34, 0xA7, 0x78, 0x39, 0x6C, 0x93, 0x3A, 0x1E, 0xBA,
-    0xE7, 0x30, 0xAC, 0xF9, 0xFD, 0xA8, 0xCD, 0x5D, 0xF2, 0xDF, 0x9F, 0xCE, 0x49, 0xE7, 0x7C, 0xE6,
-    0x6F, 0x33, 0x6B, 0x6A, 0x9A, 0x55, 0x0E, 0x02, 0x92, 0x4C, 0x0C, 0x02, 0xD5, 0x99, 0xFB, 0x2B,
-    0x4A, 0x41, 0x04, 0x92, 0x74, 0x79, 0x35, 0xD7, 0x0F, 0x7C, 0x4C, 0x17, 0x84, 0x8A, 0x4D, 0xF3,
-    0x44, 0x78, 0x3E, 0x8B, 0x3C, 0x38, 0xC6, 0xC6, 0x7F, 0xC6, 0x7C, 0xE0, 0x7F, 0x18, 0x45, 0x3C,
-    0xE3, 0x54, 0xFE, 0xFE, 0xCA, 0xF1, 0x0C, 0x39, 0xF4, 0x17, 0xF8, 0x0E, 0x00, 0x0B, 0xDE, 0xC2,
-    0x57, 0xFF, 0xE9, 0xDD, 0x81, 0x9E, 0xEF, 0xCB, 0xD8, 0x9B, 0x83, 0x7B, 0xCB, 0x34, 0xA7, 0x98,
-    0x92, 0xB5, 0xF4, 0xCF, 0x19, 0xB8, 0x03, 0x12, 0x61, 0x0E, 0xE8, 0xD0, 0x52, 0x5B, 0x89, 0x57,
-    0xB5, 0xAF, 0x22, 0x24, 0xF4, 0x81, 0x72, 0xBE, 0x8A, 0xFE, 0x5E, 0xD4, 0x70, 0x5D, 0x68, 0xDC,
-    0x93, 0x69, 0x0A, 0xA6, 0xBF, 0xE4, 0x3E, 0xF8, 0xF4, 0x09, 0xA2, 0xC8, 0xC2, 0x44, 0xC7, 0x33,
-    0x04, 0x54, 0x6D, 0xE0, 0xCB, 0xFC, 0xD1, 0x2B, 0x9E, 0xA4, 0x62, 0x9C, 0x3D, 0xD2, 0x6B, 0x27,
-    0x27, 0x6C, 0x16, 0x02, 0xEB, 0xFE, 0xBA, 0x4C, 0x8C, 0x24, 0x5C, 0x50, 0x5B, 0x07, 0xB6, 0xB5,
-    0x07, 0xD5, 0xA6, 0x44, 0x70, 0xA4, 0x63, 0x37, 0x0C, 0xA3, 0x34, 0x33, 0xAC, 0x5F, 0x3B, 0x33,
-    0xBF, 0x38, 0x66, 0xB3, 0x65, 0xAA, 0xAF, 0x5E, 0xA3, 0xFC, 0xC7, 0xAF, 0x48, 0xC2, 0x85, 0xAB,
-    0x6A, 0x2D, 0x2C, 0x4B, 0x19, 0x6A, 0xEA, 0x5B, 0x34, 0xA4, 0x14, 0x4E, 0x52, 0xA4, 0x0A, 0x23,
-    0xA9, 0xEE, 0x66, 0x3A, 0x56, 0x3E, 0xFC, 0x19, 0xD6, 0x29, 0xF8, 0x85, 0x89, 0x1D, 0xCE, 0x04,
-    0xDA, 0x03, 0x12, 0x1A, 0xBD, 0x7B, 0x56, 0x52, 0xD4, 0x31, 0x78, 0x53, 0x21, 0x8F, 0x20, 0xAC,
-    0x78, 0x78, 0x68, 0x30, 0x5E, 0x82, 0x23, 0x5F, 0x26, 0x7E, 0x8B, 0xA7, 0xCA, 0xAD, 0xB8, 0xE3,
-    0xB6, 0x30, 0xAD, 0xC0, 0xC3, 0x33, 0xA9, 0x0D, 0x4F, 0xEE, 0x42, 0xB4, 0x82, 0x26, 0x89, 0x25,
-    0x82, 0xF7, 0x27, 0xB5, 0x65, 0x0B, 0x82, 0xAA, 0xC5, 0x7F, 0x25, 0x6E, 0xAE, 0xFA, 0x74, 0x95,
-    0xB8, 0x1D, 0x47, 0x29, 0x38, 0x42, 0xD8, 0x50, 0xA3, 0x8A, 0x8B, 0xA3, 0x40, 0x29, 0xA9, 0xE2,
-    0xAD, 0xCA, 0x1E, 0x6E, 0xAA, 0x82, 0xCA, 0xEC, 0xCF, 0x85, 0x4F, 0x3C, 0x6B, 0x38, 0x88, 0x25,
-    0x4D, 0xC7, 0xFE, 0xE4, 0xA6, 0x25, 0x26, 0xDA, 0x56, 0x09, 0x4B, 0xBE, 0x89, 0xB8, 0x95, 0x2E,
-    0x8D, 0x24, 0xBB, 0x75, 0xD3, 0x1C, 0x51, 0x82, 0xC9, 0xE9, 0xB4, 0xA3, 0x52, 0x5F, 0xA1, 0x5A,
-    0xF5, 0x54, 0x26, 0x22, 0x1D, 0x77, 0xE3, 0x38, 0xF2, 0xC1, 0x5B, 0x2A, 0x7B, 0x7A, 0xC9, 0x52,
-    0x2B, 0xB9, 0xC7, 0xD7, 0x9F, 0x07, 0xDF, 0x76, 0x72, 0xB5, 0xC4, 0x8E, 0x30, 0x1C, 0xAC, 0x2A,
-    0x03, 0xF3, 0xC2, 0xDB, 0xD8, 0xAB, 0x8E, 0xFD, 0x42, 0x5A, 0xF4, 0x13, 0x2E, 0x80, 0x6A, 0x14,
-    0x54, 0xAE, 0x63, 0x1C, 0xD2, 0x17, 0xFF, 0xF3, 0x6F, 0x78, 0xE9, 0x73, 0xD6, 0xD9, 0x44, 0xDA,
-    0xCA, 0x5C, 0x68, 0xDE, 0x6B, 0x8C, 0xC0, 0x14, 0x11, 0x1C, 0x0C, 0x19, 0xF1, 0x25, 0xD1, 0x3B,
-    0xA4, 0xC4, 0x4F, 0xD8, 0x13, 0x3F, 0xE1, 0x1F, 0xF8, 0x89, 0x85, 0xE1, 0xE8, 0x66, 0x6A, 0xA0,
-    0x1A, 0x3F, 0x9B, 0x8E, 0x3F, 0x19, 0x1C, 0x50, 0x43, 0xFD, 0xE2, 0x16, 0xE9, 0xF9, 0x50, 0x52,
-    0xD6, 0xF6, 0x4E, 0x3F, 0x42, 0x4E, 0x6B, 0x46, 0x26, 0xC6, 0xC8, 0xDC, 0x20, 0x7E, 0x38, 0x69,
-    0x86, 0xA8, 0x36, 0xC9, 0x5B, 0xE3, 0x5F, 0x73, 0xAF, 0x84, 0xF1, 0x88, 0xDA, 0xCD, 0xE8, 0x47,
-    0xCC, 0xFA, 0x91, 0x33, 0xE1, 0x0F, 0x99, 0x22, 0x08, 0xC1, 0x53, 0xA1, 0x30, 0x23, 0x34, 0x0A,
-    0xE9, 0x28, 0x9A, 0xFE, 0xA0, 0x47, 0x84, 0x99, 0x6F, 0x8E, 0x7B, 0xF9, 0xBD, 0x93, 0x40, 0x3C,
-    0x1F, 0xB4, 0x65, 0x19, 0xA3, 0x11, 0x8A, 0x10, 0x10, 0x3C, 0x7D, 0xC1, 0x9D, 0x5F, 0xE8, 0x0E,
-    0x17, 0xB6, 0xC2, 0xB7, 0x93, 0xC6, 0xCF, 0x2F, 0x28, 0xF3, 0x54, 0xB2, 0xF2, 0x0F, 0xCD, 0xB8,
-    0xD3, 0x11, 0x8D, 0x45, 0x6C, 0x92, 0x6C, 0xF9, 0xD5, 0x7D, 0xF7, 0x89, 0xB8, 0x57, 0xB5, 0x70,
-    0xBC, 0x70, 0x21, 0x8B, 0xA4, 0x43, 0xC5, 0x26, 0xC2, 0x1B, 0x5C, 0x60, 0xA1, 0x80, 0xE9, 0x43,
-    0x91, 0x2C, 0x42, 0x3A, 0x0E, 0xA7, 0x5A, 0x4C, 0xCC, 0xA6, 0xD2, 0x37, 0xD2, 0xD7, 0xDC, 0xC8,
-    0x6C, 0x75, 0x5B, 0x4C, 0xC3, 0x05, 0xB1, 0x99, 0xF6, 0x9C, 0x09, 0x72, 0xD4, 0x05, 0xE4, 0xA1,
-    0x37, 0x18, 0x26, 0x96, 0x98, 0xAC, 0x81, 0xDC, 0x67, 0xDA, 0x4A, 0x20, 0xAE, 0xA9, 0xAA, 0x67,
-    0x30, 0x92, 0xDE, 0x12, 0x25, 0x2B, 0xB7, 0x78, 0x3C, 0xDD, 0xD8, 0x2A, 0x1F, 0xBB, 0xD1, 0x9A,
-    0x66, 0x74, 0x63, 0xF5, 0x00, 0x92, 0xF7, 0x3F, 0x21, 0x74, 0xC8, 0x48, 0x85, 0xF6, 0x8D, 0x88,
-    0xAD, 0x89, 0xA6, 0x0C, 0x80, 0x35, 0xC4, 0xDC, 0x94, 0xE6, 0x01, 0x26, 0xF8, 0x0D, 0x99, 0x13,
-    0x0A, 0x1D, 0x5F, 0x16, 0x4C, 0x83, 0x97, 0xD0, 0xF3, 0xDA, 0x84, 0xD2, 0x5D, 0xC8, 0xF4, 0x75,
-    0xB8, 0xFA, 0xFF, 0xA0, 0xBB, 0xFF, 0xD6, 0x57, 0xBF, 0x02, 0xA2, 0x7E, 0xEA, 0x91, 0xE5, 0x84,
-    0xBE, 0xF0, 0x50, 0x44, 0x8A, 0x6A, 0xE7, 0x55, 0x88, 0xFF, 0x11, 0xCA, 0x1E, 0x80, 0xEA, 0x5B,
-    0xFE, 0x01, 0xAF, 0x65, 0x9E, 0xF1, 0x1E, 0x8A, 0x53, 0x12, 0x80, 0x63, 0x96, 0xC9, 0x1A, 0xCD,
-    0xB9, 0x72, 0x00, 0xE3, 0x31, 0x8B, 0x7E, 0x90, 0x19, 0x07, 0x85, 0x58, 0x70, 0xCF, 0x94, 0xA9,
-    0x10, 0xE3, 0x00, 0x8E, 0x1B, 0xFA, 0x91, 0x65, 0x2F, 0x74, 0xE7, 0x55, 0x80, 0x73, 0x90, 0x47,
-    0x9E, 0xE4, 0xD2, 0xC7, 0x33, 0x30, 0x17, 0x2F, 0xCD, 0x4B, 0x24, 0xBD, 0xFC, 0x23, 0x0E, 0xBA,
-    0x3F, 0x43, 0x61, 0xD5, 0xE7, 0x1E, 0x76, 0x46, 0x19, 0x8D, 0x83, 0xA4, 0x4B, 0xCA, 0x54, 0xCC,
-    0x47, 0x62, 0xC6, 0xB6, 0xE1, 0x91, 0x11, 0xFD, 0x11, 0xA7, 0x46, 0x86, 0x19, 0x64, 0x2B, 0x8A,
-    0xF8, 0x70, 0xE1, 0xC9, 0xD2, 0xD6, 0x4E, 0x04, 0x24, 0xA6, 0xFC, 0x27, 0xFC, 0x80, 0x8E, 0x00,
-    0xD3, 0x84, 0x6C, 0xE2, 0x88, 0x00, 0xA6, 0xFC, 0xAC, 0x73, 0x89, 0x43, 0xA8, 0xBC, 0x51, 0x2F,
-    0x84, 0xEA, 0xAE, 0x5A, 0x2A, 0x3C, 0x1B, 0x88, 0xC4, 0x74, 0x0A, 0x85, 0x10, 0xA7, 0x06, 0x0A,
-    0x91, 0xCC, 0x8C, 0xC9, 0x1F, 0xBF, 0xE2, 0xBB, 0xE8, 0xBC, 0xDD, 0x33, 0xCA, 0xAF, 0x27, 0x11,
-    0xF6, 0xE4, 0x8C, 0x21, 0x49, 0x25, 0xC7, 0x5F, 0x0A, 0xEC, 0x95, 0x01, 0x53, 0x39, 0x01, 0xA6,
-    0x22, 0x93, 0x5C, 0x2C, 0x42, 0x29, 0xAB, 0x85, 0x8B, 0x41, 0x0B, 0xC5, 0xC7, 0x77, 0x67, 0x63,
-    0xF8, 0x78, 0x27, 0x43, 0xA7, 0x14, 0x17, 0xB3, 0x4F, 0x37, 0xE7, 0x92, 0x07, 0xF0, 0x0C, 0xB8,
-    0x4D, 0x7C, 0x0B, 0x98, 0xC4, 0xB3, 0x32, 0xD6, 0x2D, 0x79, 0xC5, 0xEB, 0xF7, 0x8E, 0xE5, 0x45,
-    0x06, 0x61, 0x42, 0x33, 0x56, 0x70, 0x89, 0x7D, 0x5D, 0x91, 0xC2, 0x4B, 0x7A, 0x31, 0x19, 0xB3,
-    0xE5, 0x21, 0x71, 0x68, 0x0C, 0x84, 0xC7, 0x42, 0x13, 0x80, 0x1F, 0x35, 0xD1, 0xD4, 0x64, 0xD9,
-    0xA2, 0xA7, 0x1B, 0xA7, 0x23, 0x07, 0xF1, 0x76, 0xFD, 0x4C, 0xC4, 0x22, 0x39, 0xF9, 0x19, 0x84,
-    0x5E, 0xFF, 0x9C, 0x40, 0xF2, 0x7B, 0xCC, 0xA2, 0x9A, 0x15, 0x37, 0x02, 0xBD, 0x53, 0x2D, 0xD3,
-    0xA1, 0x99, 0x84, 0x5B, 0x46, 0x9B, 0x12, 0xAF, 0xF0, 0xDD, 0x79, 0x32, 0x8A, 0x18, 0x1E, 0x52,
-    0x23, 0x91, 0xB4, 0x88, 0x22, 0x85, 0x01, 0x0B, 0x6A, 0xE8, 0x91, 0x59, 0xA5, 0x1D, 0xF2, 0xB9,
-    0x1C, 0x69, 0x37, 0x40, 0x95, 0x0F, 0x16, 0xC1, 0xB5, 0xA0, 0xB7, 0x1A, 0x89, 0x3A, 0xEA, 0x58,
-    0xA2, 0x39, 0xE6, 0xC0, 0x38, 0x03, 0x4C, 0x0C, 0x1B, 0x01, 0xEF, 0x75, 0xB6, 0x00, 0x28, 0xF9,
-    0x8C, 0xB7, 0x62, 0x8E, 0xF7, 0x92, 0xDD, 0x85, 0xCD, 0xD9, 0x16, 0x9A, 0x98, 0x3F, 0xE2, 0xED,
-    0x37, 0x83, 0x29, 0x53, 0x61, 0xC2, 0x48, 0x47, 0xEC, 0x92, 0x2F, 0x07, 0x57, 0xDF, 0x63, 0x58,
-    0x47, 0x33, 0x90, 0xA1, 0x8E, 0xAC, 0x25, 0xB6, 0x85, 0x78, 0x96, 0x08, 0xCE, 0x9F, 0x02, 0x8D,
-    0xA2, 0x5B, 0xBD, 0x59, 0xE8, 0x3C, 0xA2, 0xD1, 0x2E, 0xDD, 0xC2, 0x8B, 0xBF, 0x57, 0x32, 0xFF,
-    0xA2, 0xA6, 0x59, 0xA5, 0x48, 0x10, 0xFE, 0x5F, 0x91, 0x49, 0xFD, 0x17, 0x19, 0x5B, 0xEC, 0x29,
-    0x82, 0x64, 0xDA, 0x28, 0x9C, 0xCA, 0xE0, 0x81, 0xA5, 0xB6, 0xE5, 0x96, 0x1E, 0xEA, 0xCD, 0xA2,
-    0x13, 0x59, 0x7D, 0xDE, 0x58, 0x1D, 0xB3, 0xF1, 0x05, 0xD8, 0x60, 0xA0, 0xE8, 0xF9, 0x85, 0xEA,
-    0x53, 0xB8, 0xE0, 0x1F, 0x90, 0xC7, 0xBC, 0x27, 0xA0, 0x11, 0xB9, 0x98, 0x21, 0x02, 0x02, 0x45,
-    0x8A, 0x43, 0xB1, 0xE2, 0x90, 0x71, 0x3C, 0x69, 0xC6, 0x7F, 0xE6, 0x47, 0x59, 0x78, 0xD0, 0xBB,
-    0x59, 0xBB, 0x55, 0xCE, 0x22, 0xA0, 0x4D, 0x5F, 0xC2, 0x3B, 0x7D, 0xEA, 0x55, 0x56, 0x5E, 0xF7,
-    0x59, 0x6C, 0xBD, 0xCF, 0x38, 0xDD, 0x83, 0xEA, 0x72, 0x96, 0x72, 0xD9, 0x18, 0x91, 0x54, 0x20,
-    0x00, 0x22, 0x12, 0xE0, 0xB4, 0xE2, 0x47, 0x4C, 0x3B, 0x5E, 0xA7, 0x6D, 0x7F, 0x46, 0x97, 0x3E,
-    0xDB, 0x6D, 0x14, 0x71, 0x47, 0x4B, 0x76, 0x73, 0xAA, 0x5F, 0xE5, 0xB1, 0x01, 0xA9, 0x51, 0x92,
-    0x7C, 0x91, 0xE6, 0x03, 0x8B, 0xCB, 0x93, 0x7C, 0x21, 0xF4, 0x5B, 0xF2, 0xD5, 0x2B, 0xCC, 0x27,
-    0xF3, 0xE6, 0x31, 0x35, 0x38, 0xEB, 0x3B, 0xD8, 0x36, 0x42, 0x21, 0xDD, 0xB3, 0xC4, 0x02, 0x89,
-    0x38, 0x06, 0xCD, 0xD2, 0x0F, 0xA0, 0x89, 0x62, 0x2C, 0x20, 0x07, 0xF6, 0x45, 0x91, 0x86, 0xF2,
-    0x06, 0xC4, 0xEE, 0x7F, 0x40, 0xDA, 0xA9, 0xFC, 0xA2, 0x96, 0xC0, 0x2A, 0xFF, 0xF5, 0xFE, 0xA7,
-    0xE6, 0x98, 0xA3, 0xB9, 0xD5, 0x9A, 0x58, 0x99, 0xD3, 0x36, 0x6A, 0x05, 0x8C, 0xE4, 0x5F, 0x54,
-    0xE6, 0xAA, 0x85, 0x12, 0xD2, 0x71, 0xBD, 0x01, 0x8C, 0x39, 0x9A, 0xE2, 0x2C, 0xCC, 0x19, 0x33,
-    0x7C, 0xAC, 0x8A, 0x86, 0xE0, 0xD6, 0x8E, 0x22, 0xDF, 0x15, 0x02, 0xCC, 0x4F, 0xAC, 0xF7, 0x9A,
-    0x18, 0xB7, 0x15, 0x93, 0x95, 0xE4, 0xB6, 0xCE, 0x6C, 0x9C, 0xD2, 0x69, 0xB0, 0x61, 0x40, 0x80,
-    0xF4, 0x9F, 0x70, 0x40, 0x31, 0x17, 0xC2, 0x6C, 0xA8, 0x86, 0x6F, 0xCB, 0x36, 0x26, 0x02, 0x25,
-    0x1B, 0x26, 0x2B, 0x96, 0xAB, 0x95, 0x21, 0xCE, 0x10, 0x24, 0x1B, 0xC8, 0xD7, 0x5D, 0x4E, 0xF7,
-    0xCF, 0x99, 0x20, 0x66, 0x23, 0x6D, 0x3E, 0x21, 0xCB, 0x40, 0x96, 0xDD, 0x23, 0x92, 0x99, 0x85,
-    0xB9, 0xEF, 0xB2, 0xC5, 0xC2, 0x88, 0xFB, 0x84, 0x56, 0xC4, 0x89, 0x5C, 0xCA, 0x2D, 0xB3, 0x15,
-    0x00, 0xC5, 0x3F, 0xD9, 0xB2, 0x17, 0x01, 0x72, 0xD2, 0x0D, 0x2B, 0x6A, 0xAC, 0x9A, 0xB2, 0x84,
-    0x96, 0x67, 0x2D, 0xCB, 0x73, 0x99, 0xBC, 0x53, 0xFA, 0xC2, 0x92, 0x56, 0x45, 0xAC, 0x76, 0xBC,
-    0x52, 0xF6, 0xB5, 0x43, 0x8E, 0x1A, 0x34, 0xBB, 0xBD, 0x84, 0xB3, 0x2E, 0x2D, 0xEC, 0xF1, 0xE8,
-    0x56, 0xB9, 0x65, 0xAF, 0xDB, 0x66, 0x99, 0x7E, 0x88, 0x99, 0x94, 0xF5, 0x6F, 0x75, 0x31, 0x3F,
-    0xA4, 0x38, 0x46, 0x43, 0x6B, 0xA9, 0xA8, 0x66, 0x53, 0xFF, 0x54, 0x29, 0xA5, 0x9A, 0x57, 0xEA,
-    0xA7, 0xA9, 0xA9, 0xA5, 0x06, 0x5B, 0x75, 0x68, 0x7C, 0xAD, 0x7B, 0x4B, 0x5D, 0x25, 0x9F, 0x0A,
-    0xCD, 0x0B, 0xF3, 0xFB, 0xBD, 0x07, 0x77, 0x3E, 0x5F, 0x0F, 0x0C, 0x9A, 0xC3, 0xFC, 0xF3, 0xA9,
-    0xE7, 0xF3, 0x87, 0x9D, 0x1A, 0xF5, 0x96, 0x19, 0x6F, 0x62, 0x95, 0x6F, 0xBC, 0x69, 0xA0, 0xFE,
-    0x1D, 0xD7, 0xFD, 0x49, 0xD4, 0xBF, 0x1E, 0x0F, 0x95, 0xFD, 0x5D, 0x1F, 0x8B, 0xEB, 0x53, 0xF1,
-    0xC6, 0x5C, 0xBC, 0xA7, 0xBF, 0x07, 0x73, 0x71, 0xBD, 0x7F, 0x2E, 0x2A, 0xBF, 0xA6, 0xC3, 0xD9,
-    0xB9, 0xA4, 0xA8, 0xF3, 0x93, 0x48, 0x88, 0x75, 0xDF, 0x3A, 0x3E, 0xDC, 0x34, 0x09, 0xF7, 0x73,
-    0x49, 0x24, 0x3B, 0x48, 0xB7, 0xDF, 0x6C, 0xF6, 0xF3, 0x9E, 0xDF, 0xD4, 0x01, 0xA5, 0x96, 0xF3,
-    0x9B, 0xD3, 0xD3, 0x37, 0xFD, 0xD6, 0xB3, 0x64, 0x1A, 0x64, 0x27, 0x2B, 0x68, 0x2B, 0xF6, 0xC4,
-    0xDC, 0xAD, 0xB7, 0xE5, 0xA7, 0xA3, 0xD1, 0x1C, 0xE2, 0xB5, 0x72, 0xA5, 0xEF, 0xCF, 0x58, 0x67,
-    0xEB, 0x32, 0x12, 0x24, 0x0F, 0x68, 0x3C, 0xDA, 0x71, 0x7A, 0xED, 0xE4, 0xE4, 0xE4, 0xF8, 0xAA,
-    0xB3, 0x6A, 0xAD, 0xEA, 0x82, 0x83, 0xB7, 0x5F, 0x5E, 0x9C, 0x3A, 0x30, 0x6C, 0x20, 0xAD, 0xF1,
-    0x12, 0x4D, 0xE1, 0x1C, 0x0F, 0x21, 0x8A, 0xD9, 0x70, 0x4E, 0xDB, 0x70, 0xCA, 0xCA, 0x68, 0xCA,
-    0x5D, 0x34, 0x16, 0x30, 0x6D, 0xF1, 0xA9, 0x1F, 0xD8, 0x83, 0xCB, 0xAD, 0x21, 0xD5, 0x0B, 0xB8,
-    0x57, 0xB7, 0xF6, 0xB9, 0xDF, 0x54, 0xB0, 0x98, 0xCC, 0x54, 0x53, 0x38, 0x61, 0xC3, 0xC7, 0x4A,
-    0xA3, 0xD9, 0xBC, 0x1A, 0x13, 0xFF, 0xC2, 0x04, 0xB6, 0x62, 0xA2, 0x32, 0x03, 0x28, 0x73, 0xD6,
-    0x87, 0x53, 0xDE, 0xC5, 0x63, 0xFE, 0xA8, 0xE2, 0xBA, 0x3D, 0x3B, 0x55, 0xB9, 0x6A, 0x28, 0x1C,
-    0xE9, 0xE6, 0x26, 0xDF, 0x35, 0xD6, 0x02, 0x03, 0x43, 0x88, 0x3F, 0xBE, 0xC1, 0xDE, 0xE3, 0x28,
-    0xAD, 0x41, 0xF9, 0xD4, 0x1B, 0x72, 0xEB, 0x70, 0x0D, 0x5C, 0xF6, 0x05, 0x9B, 0x6B, 0x5D, 0xAC,
-    0x0E, 0x51, 0x7D, 0x80, 0x8A, 0xB4, 0xC8, 0x66, 0x9B, 0xE1, 0x52, 0x3A, 0xA6, 0x60, 0xD9, 0x68,
-    0x95, 0x8E, 0x3A, 0x93, 0x20, 0xC9, 0xDF, 0xB0, 0x58, 0xEA, 0xC0, 0x0C, 0x59, 0x97, 0xF0, 0x51,
-    0x0A, 0xB3, 0x73, 0xF8, 0x79, 0x8D, 0x83, 0x30, 0x6D, 0x67, 0x10, 0xC9, 0xDB, 0x6C, 0x3E, 0x94,
-    0x6C, 0x56, 0x2C, 0xC9, 0x03, 0xB1, 0x6E, 0x7E, 0x6A, 0x39, 0x53, 0xED, 0x2C, 0xAF, 0x6A, 0x90,
-    0xA8, 0x05, 0x63, 0x38, 0x5F, 0xBA, 0xC7, 0xA1, 0x75, 0x63, 0x27, 0x9B, 0xB2, 0xF5, 0xED, 0x1B,
-    0x34, 0xB0, 0xBA, 0xC0, 0xCD, 0x69, 0xDC, 0x6D, 0xDD, 0x47, 0xD6, 0x32, 0x48, 0xC4, 0x9A, 0x53,
-    0x3B, 0x6F, 0x6A, 0x0F, 0xDA, 0x70, 0x79, 0xEF, 0xB7, 0x22, 0x87, 0x7B, 0xF4, 0xCF, 0x09, 0x15,
-    0xE0, 0xBB, 0x2B, 0xFE, 0x1D, 0x9E, 0x39, 0xDA, 0xFA, 0xB0, 0xB3, 0x52, 0x5F, 0x22, 0xC0, 0xDB,
-    0x33, 0xBB, 0x55, 0xC4, 0x68, 0x35, 0x43, 0xDE, 0xB3, 0x3A, 0x5D, 0x25, 0x36, 0x13, 0x01, 0x80,
-    0xA4, 0x28, 0xC1, 0xD9, 0xAF, 0x33, 0x90, 0xBD, 0xCB, 0x78, 0x88, 0x0B, 0x5D, 0xC0, 0x42, 0x17,
-    0x6F, 0xA8, 0x79, 0xA6, 0xD8, 0x12, 0x11, 0xA5, 0x1E, 0x87, 0x8C, 0x09, 0xE2, 0x26, 0x8F, 0x0F,
-    0xAE, 0x06, 0x45, 0x5E, 0x29, 0x2B, 0x31, 0x11, 0x53, 0x4F, 0xE9, 0x51, 0x4D, 0x9A, 0x6E, 0xF7,
-    0x81, 0x6C, 0x7F, 0x9C, 0xC1, 0x3E, 0x6C, 0xBC, 0x3F, 0xE4, 0x48, 0x7F, 0xB9, 0x58, 0x74, 0x2B,
-    0x54, 0x57, 0xBD, 0xC8, 0x1C, 0x29, 0x6D, 0x89, 0x02, 0xDC, 0xCE, 0xDA, 0xBC, 0x0B, 0x27, 0xA6,
-    0x71, 0xEC, 0x09, 0x0E, 0xC8, 0xE0, 0x1B, 0xE6, 0x1F, 0x43, 0x36, 0xB2, 0xFF, 0x57, 0xC2, 0x34,
-    0x03, 0x28, 0xFE, 0xBB, 0xC2, 0xC4, 0x4D, 0x2A, 0x30, 0xDA, 0x83, 0x6A, 0x76, 0xA1, 0xC1, 0xF6,
-    0x63, 0x81, 0x6F, 0x26, 0xFC, 0xC2, 0x89, 0x06, 0x8C, 0x06, 0xEE, 0xCF, 0x27, 0x63, 0x3D, 0x95,
-    0x99, 0xB7, 0x5B, 0x1D, 0x86, 0xF8, 0x7F, 0x24, 0x90, 0xFC, 0x9B, 0xE1, 0x35, 0x9C, 0x0F, 0x2D,
-    0xFA, 0x27, 0x5E, 0x7C, 0x16, 0xC1, 0xD3, 0x10, 0x46, 0x3C, 0x4C, 0xB5, 0xB5, 0x56, 0x77, 0x88,
-    0x4F, 0xD6, 0x6E, 0xE5, 0x19, 0xD9, 0xAF, 0xA3, 0xCB, 0xEF, 0xC3, 0xD5, 0xB6, 0x76, 0x8C, 0x13,
-    0xEA, 0x01, 0x9E, 0xB7, 0xF7, 0xF6, 0xED, 0xB6, 0xB9, 0x04, 0x44, 0xBA, 0xCD, 0x25, 0xCF, 0x14,
-    0xB7, 0x91, 0x69, 0x20, 0x9D, 0x6F, 0x60, 0x56, 0x4F, 0x8D, 0x8D, 0xCE, 0x82, 0xCF, 0x20, 0xD2,
-    0x66, 0x0C, 0x41, 0xB1, 0x51, 0x67, 0x0F, 0x7D, 0x9F, 0x7F, 0xE8, 0xC7, 0xA2, 0x6B, 0x30, 0xE8,
-    0xD7, 0x5C, 0x0E, 0xAB, 0x61, 0xB1, 0x94, 0x8F, 0x01, 0x75, 0xD2, 0x5A, 0xC0, 0x11, 0x30, 0x56,
-    0xA9, 0x64, 0xE6, 0xA8, 0xD8, 0x46, 0xE1, 0xEF, 0x63, 0xB6, 0xF6, 0x73, 0x36, 0xD5, 0xCF, 0x1F,
-    0xFA, 0xFE, 0x6A, 0x64, 0x55, 0x05, 0xB4, 0xF8, 0x49, 0xD1, 0x85, 0xDD, 0xE3, 0x29, 0x5F, 0xB1,
-    0x28, 0x82, 0x7D, 0x9F, 0xB5, 0xC9, 0x8C, 0xC8, 0xDB, 0x00, 0x34, 0x09, 0x8C, 0xC5, 0x04, 0xB7,
-    0xCD, 0xFA, 0x64, 0x42, 0x69, 0xD6, 0x94, 0x45, 0x9B, 0x8E, 0xBA, 0xC6, 0xD4, 0x3F, 0x9D, 0x00,
-    0xC4, 0xA6, 0xC6, 0xED, 0x21, 0x42, 0x12, 0x89, 0xAF, 0xBA, 0x66, 0x15, 0x02, 0x7D, 0xE5, 0x0C,
-    0xC7, 0xCB, 0x0F, 0x0F, 0x05, 0xC6, 0xAA, 0xC6, 0x2A, 0xEC, 0x4C, 0xE7, 0x75, 0xD6, 0x91, 0x81,
-    0x40, 0xB7, 0x45, 0x9B, 0x0C, 0x31, 0xAF, 0x69, 0x32, 0x80, 0xC0, 0xFD, 0x10, 0x62, 0x41, 0x51,
-    0x5E, 0xF9, 0x75, 0x73, 0x8C, 0xE9, 0x4A, 0xF1, 0xBB, 0x68, 0x8D, 0x67, 0xAE, 0x8E, 0x93, 0xE6,
-    0x6D, 0x83, 0x13, 0x16, 0x75, 0x34, 0xA7, 0x7D, 0xB0, 0xC6, 0xEA, 0x24, 0xA3, 0xD2, 0xE2, 0x33,
-    0x5B, 0x52, 0x56, 0x64, 0x7D, 0x91, 0x7E, 0xEB, 0x3C, 0x38, 0xB6, 0x42, 0x93, 0xDF, 0x5A, 0xDD,
-    0xAB, 0x9A, 0xE2, 0x3F, 0xA9, 0x80, 0x3E, 0xAD, 0x59, 0xE8, 0xBC, 0xCB, 0x3A, 0x07, 0x20, 0x90,
-    0xA7, 0x60, 0xFD, 0xAC, 0x64, 0xC5, 0x03, 0xDD, 0xAD, 0xC1, 0xBA, 0xF5, 0xCA, 0xD4, 0x20, 0x8F,
-    0xE4, 0x29, 0x4A, 0xA8, 0xD3, 0xF1, 0xB5, 0x72, 0xCB, 0x7F, 0x95, 0x6F, 0x9A, 0x27, 0x6A, 0x2F,
-    0x3D, 0x24, 0xBC, 0xF8, 0x58, 0x60, 0xE3, 0xB7, 0x9E, 0x04, 0xF7, 0x59, 0x2B, 0x27, 0x45, 0xC5,
-    0x5B, 0xC2, 0x47, 0x87, 0xB8, 0x47, 0x56, 0xFB, 0x2E, 0x1F, 0xD5, 0xD4, 0xE4, 0x12, 0x94, 0x35,
-    0x79, 0x09, 0x1D, 0xC0, 0x41, 0xB9, 0x23, 0x4A, 0x47, 0xEB, 0x31, 0xB5, 0x96, 0x49, 0xDF, 0x3B,
-    0xBA, 0x5B, 0x5A, 0x3E, 0x51, 0xAC, 0xF6, 0xFC, 0xC4, 0xB1, 0x6E, 0xFA, 0x83, 0x9D, 0xE2, 0xD3,
-    0x4F, 0xD8, 0xFA, 0xE6, 0xC3, 0xBB, 0x32, 0xF5, 0x3F, 0xA2, 0x60, 0x94, 0x90, 0xD0, 0x83, 0x33,
-    0xF0, 0x28, 0xB4, 0x3A, 0x68, 0x43, 0xFD, 0xAD, 0xD9, 0x59, 0x89, 0xD6, 0xBA, 0x2B, 0xF7, 0xF6,
-    0x6C, 0x1F, 0x09, 0x38, 0xFB, 0xB6, 0xC5, 0x9B, 0xFF, 0xC2, 0xFF, 0x63, 0xE0, 0xFE, 0x76, 0x8B,
-    0x87, 0x85, 0x0A, 0xC3, 0xCE, 0x9E, 0x44, 0xB1, 0xEC, 0x4E, 0xE6, 0xA8, 0xCB, 0x26, 0x16, 0x66,
-    0xA4, 0x73, 0x3E, 0x54, 0xB9, 0xEC, 0x4F, 0xCF, 0x8F, 0xFA, 0xBB, 0x72, 0x21, 0xEC, 0x09, 0x40,
-    0xC5, 0x2C, 0xA1, 0xF9, 0xB4, 0x88, 0x7C, 0xB0, 0x5D, 0x1A, 0xE5, 0x1A, 0xAB, 0x9C, 0x0D, 0x10,
-    0x4E, 0x49, 0x8F, 0x7C, 0x50, 0xC3, 0xB0, 0x87, 0xF1, 0x0D, 0x9C, 0x6C, 0x4D, 0xBB, 0x60, 0x49,
-    0x15, 0x9B, 0xA2, 0x39, 0x6B, 0x11, 0x9B, 0xDA, 0x64, 0xCA, 0x51, 0xF4, 0x15, 0x25, 0x92, 0xB0,
-    0x92, 0xCF, 0xF6, 0x1B, 0xB2, 0x6D, 0xA7, 0x65, 0x2D, 0x9E, 0xD4, 0x97, 0x57, 0x39, 0x65, 0xFE,
-    0x00, 0x54, 0x38, 0x61, 0x2F, 0x0F, 0x06, 0xC9, 0x3B, 0xE4, 0xAC, 0x53, 0xA0, 0x87, 0x21, 0x03,
-    0xAF, 0x7D, 0x0B, 0xC9, 0xE4, 0x99, 0xB7, 0x74, 0x88, 0x8F, 0x9F, 0xF4, 0x44, 0x22, 0x56, 0xB5,
-    0x32, 0x6F, 0xF9, 0x22, 0x9F, 0xF4, 0x55, 0x3F, 0x64, 0xFD, 0x79, 0x7F, 0x52, 0xF7, 0x35, 0x1C,
-    0xD2, 0xA1, 0xFA, 0xBB, 0x25, 0x19, 0xB3, 0x0F, 0xFD, 0xED, 0x39, 0x9E, 0xFC, 0xC3, 0x05, 0xA6,
-    0x59, 0xBD, 0xEA, 0x38, 0x3E, 0x5D, 0x62, 0xC2, 0x0A, 0x61, 0x02, 0xFF, 0x98, 0x6D, 0x84, 0x89,
-    0xED, 0xB9, 0x39, 0x67, 0x3F, 0x2A, 0x3E, 0xD0, 0x0D, 0xFB, 0xB5, 0x48, 0xD6, 0x4B, 0x11, 0xB8,
-    0x1E, 0x1C, 0xF9, 0x3D, 0x25, 0x4F, 0x0F, 0x45, 0x09, 0x39, 0x40, 0xD1, 0x85, 0x58, 0xA3, 0xAD,
-    0x0B, 0xF2, 0x41, 0xB2, 0x28, 0xEB, 0x6D, 0x93, 0x55, 0xED, 0x03, 0x9E, 0xC2, 0xE9, 0x31, 0x48,
-    0xC4, 0xC7, 0x2C, 0x70, 0x1C, 0x28, 0x31, 0x1B, 0xC0, 0x7C, 0xD1, 0xC2, 0xF8, 0xE7, 0x6F, 0x33,
-    0xF7, 0x7F, 0x38, 0xED, 0xF9, 0x9F, 0xF2, 0xB9, 0xC2, 0x52, 0x4E, 0x3D, 0x4F, 0x3C, 0x64, 0x5C,
-    0x6A, 0x42, 0xB2, 0x72, 0xBA, 0xC4, 0xBE, 0x50, 0x6A, 0xE9, 0xAA, 0x7A, 0x2D, 0xD3, 0x79, 0x17,
-    0x5D, 0xBE, 0x9B, 0x1D, 0x4A, 0x49, 0xF5, 0x00, 0xD5, 0x5D, 0x62, 0xB5, 0xA5, 0x62, 0x90, 0x03,
-    0x13, 0xF5, 0x77, 0x3A, 0x7B, 0x96, 0x16, 0xF8, 0x2F, 0xDE, 0xB1, 0x66, 0x6C, 0xB5, 0xF5, 0x87,
-    0xDB, 0x43, 0x37, 0xB8, 0x15, 0x70, 0x13, 0x6F, 0x41, 0xEC, 0xC9, 0x76, 0x4F, 0x6F, 0x59, 0x8E,
-    0xC2, 0xDD, 0x6A, 0xAC, 0x9A, 0xFA, 0xAD, 0x47, 0x9C, 0x0E, 0x17, 0xFB, 0x40, 0xDB, 0x0C, 0x5E,
-    0x8C, 0xFD, 0x60, 0x79, 0x6A, 0xB1, 0xEE, 0x45, 0xBE, 0xC0, 0x3C, 0xC9, 0xA5, 0xF9, 0xA8, 0x10,
-    0x4C, 0xA9, 0xCF, 0x44, 0x9F, 0xFA, 0x3F, 0x14, 0x05, 0x03, 0x48, 0xDC, 0x13, 0x81, 0xFA, 0xCC,
-    0xF5, 0xA9, 0xFF, 0xFA, 0x80, 0x54, 0xF8, 0xCE, 0xA1, 0xDA, 0xEE, 0xB5, 0xB4, 0x32, 0x45, 0x16,
-    0x9C, 0x04, 0x3F, 0x25, 0xE4, 0xBE, 0x94, 0x96, 0x0F, 0xFA, 0xE9, 0xFF, 0xC5, 0xC6, 0xFF, 0x4C,
-    0xE2, 0xD9, 0x53, 0xF1, 0x16, 0xFE, 0x29, 0x2F, 0x0F, 0x93, 0xD8, 0x94, 0x44, 0x25, 0x34, 0xC9,
-    0x04, 0xA3, 0x37, 0x7F, 0x49, 0xDE, 0x1F, 0x9A, 0xFB, 0xEF, 0x7D, 0xB6, 0xE6, 0xD9, 0xF0, 0xBD,
-    0xBC, 0xFC, 0x5F, 0xD5, 0x5A, 0x3F, 0xAC, 0xDD, 0xD6, 0x79, 0xFF, 0x48, 0xE6, 0x3D, 0x36, 0x21,
-    0x8A, 0xE3, 0x21, 0xCF, 0x68, 0xA2, 0xC2, 0xDC, 0x53, 0x54, 0x5C, 0x33, 0x58, 0x3E, 0x94, 0x05,
-    0x44, 0x43, 0x86, 0xBE, 0x41, 0x9A, 0x0C, 0x34, 0x4B, 0x87, 0xD6, 0xCB, 0x03, 0x8A, 0x0C, 0x02,
-    0x2A, 0x85, 0x4C, 0x35, 0x74, 0xE8, 0xD0, 0x37, 0x14, 0x5D, 0x32, 0xD4, 0x43, 0x52, 0x14, 0xCF,
-    0x05, 0x14, 0x14, 0x1D, 0x5A, 0x40, 0x16, 0x69, 0x6B, 0xD0, 0x90, 0xC1, 0x94, 0x0B, 0xB4, 0x28,
-    0xBA, 0x30, 0xA9, 0x0B, 0xD4, 0x36, 0x50, 0x51, 0x2E, 0x01, 0x53, 0x12, 0xC9, 0xD3, 0xDF, 0xEF,
-    0x3B, 0xBC, 0xF7, 0xF2, 0x59, 0xCF, 0x95, 0x53, 0xA7, 0x8D, 0x42, 0xE9, 0xDE, 0x77, 0x2F, 0xEF,
-    0xE1, 0x39, 0xDF, 0xF9, 0x7D, 0xDF, 0xF9, 0x7D, 0x7F, 0xCE, 0x91, 0xD4, 0x49, 0xE2, 0xEA, 0xD0,
-    0x35, 0xE2, 0x3A, 0xB1, 0x83, 0x98, 0x51, 0x22, 0x27, 0x67, 0x5D, 0x61, 0x29, 0x71, 0x23, 0xA6,
-    0x93, 0x68, 0x94, 0x60, 0x16, 0x29, 0x72, 0xC9, 0x6A, 0xFD, 0x3E, 0x88, 0x4C, 0xFA, 0x3D, 0xAD,
-    0x25, 0xD9, 0x7E, 0xB7, 0x22, 0xA9, 0xC8, 0xFE, 0xBA, 0x8B, 0x4E, 0x6F, 0x85, 0xAD, 0xC8, 0x05,
-    0x91, 0x73, 0x93, 0x18, 0xD7, 0xC5, 0x6E, 0x16, 0x37, 0x1C, 0xDA, 0x77, 0xF3, 0xB8, 0xEF, 0xC4,
-    0x19, 0x31, 0x3F, 0x6D, 0x83, 0xE9, 0xBC, 0xA4, 0xFF, 0xD8, 0x84, 0xF3, 0x05, 0x49, 0xDD, 0x20,
-    0xCE, 0x35, 0xB1, 0xA3, 0x98, 0xA5, 0x18, 0xDF, 0xC9, 0x4B, 0x22, 0xC1, 0xF1, 0xBA, 0xE3, 0xA0,
-    0x6A, 0x30, 0x20, 0x66, 0x80, 0x86, 0xAD, 0xD8, 0x06, 0x82, 0x8C, 0xB8, 0x1D, 0x61, 0x24, 0x31,
-    0x25, 0xDE, 0x5E, 0x61, 0x2B, 0xBD, 0x85, 0xC7, 0x23, 0xE7, 0x26, 0xF4, 0x8C, 0xE6, 0xAF, 0xBB,
-    0x93, 0x52, 0xA2, 0x1E, 0xF7, 0x53, 0x74, 0x10, 0x3A, 0xF6, 0x84, 0x6F, 0xC6, 0xB9, 0x3F, 0x97,
-    0xC2, 0xB9, 0x3E, 0x74, 0x68, 0xF5, 0x95, 0x93, 0x93, 0x93, 0xD2, 0x8F, 0x93, 0xE4, 0x21, 0xE4,
-    0xF8, 0xE7, 0x36, 0x61, 0x0F, 0x0E, 0xA2, 0xDB, 0xF7, 0x26, 0xC9, 0x1A, 0x9B, 0x9B, 0x2E, 0x6D,
-    0xA2, 0x29, 0xC3, 0x0C, 0x54, 0x60, 0x17, 0xE0, 0xD5, 0x5A, 0x3C, 0x1C, 0xD7, 0xAF, 0x76, 0x92,
-    0xCB, 0x0B, 0x22, 0x2E, 0x97, 0xA2, 0x4E, 0x46, 0x41, 0x23, 0xDB, 0xE2, 0x6F, 0xE8, 0x2E, 0x61,
-    0xBC, 0x74, 0x72, 0x35, 0x7E, 0x83, 0x2C, 0x90, 0x9D, 0x02, 0x5A, 0xA2, 0x1F, 0xF0, 0x26, 0x44,
-    0xD4, 0x9F, 0x80, 0x65, 0x06, 0x0C, 0xF0, 0xFB, 0x7C, 0x88, 0xBB, 0x05, 0x7F, 0x32, 0x63, 0x8E,
-    0x4F, 0x10, 0x80, 0xB2, 0x76, 0x9C, 0x11, 0x1F, 0xB3, 0x9C, 0x6F, 0x3C, 0x51, 0xD2, 0xAA, 0xDE,
-    0x81, 0xF3, 0x06, 0xE0, 0x8E, 0x6B, 0x81, 0x72, 0xF3, 0xA0, 0x93, 0x4C, 0xA2, 0x35, 0x76, 0x3F,
-    0x86, 0xA2, 0xA2, 0x46, 0xAE, 0x4B, 0xC2, 0x16, 0x69, 0x1E, 0x76, 0x00, 0x2B, 0xCC, 0xF9, 0xD3,
-    0xEB, 0xC2, 0x91, 0x73, 0x48, 0x8A, 0x37, 0xD3, 0x5C, 0x17, 0xB9, 0x2D, 0xC7, 0x12, 0x0E, 0x04,
-    0xC2, 0x1D, 0x43, 0x48, 0x08, 0x05, 0x18, 0x6B, 0x71, 0xDF, 0x82, 0x7A, 0x5A, 0xFC, 0x6A, 0x05,
-    0x8F, 0xBB, 0x93, 0xAA, 0x84, 0x40, 0x23, 0x95, 0x51, 0xCB, 0xBE, 0xCE, 0x2A, 0xA3, 0x64, 0x30,
-    0x97, 0x1B, 0xC1, 0xC4, 0xDB, 0x80, 0x80, 0x02, 0x1F, 0xA1, 0x17, 0x09, 0xAE, 0xEC, 0x1D, 0x16,
-    0x7F, 0x3C, 0x99, 0xC1, 0xDE, 0x77, 0x97, 0xC7, 0xAC, 0x77, 0x77, 0x5D, 0x3A, 0xF2, 0x81, 0xC2,
-    0xC9, 0xF7, 0x2E, 0x37, 0x76, 0xB8, 0x9E, 0x35, 0xA9, 0xE9, 0xE2, 0x9B, 0x63, 0xD4, 0x7C, 0xF2,
-    0x71, 0x97, 0x5D, 0xEE, 0x22, 0xD7, 0x03, 0x74, 0xD5, 0xC7, 0xDF, 0x44, 0x0F, 0xEA, 0x1F, 0x5F,
-    0xFB, 0xF5, 0xF8, 0x62, 0xFD, 0xDD, 0xDF, 0x3E, 0x0A, 0x5C, 0x97, 0xFC, 0xE7, 0x32, 0xAD, 0x7D,
-    0xF9, 0x4D, 0x4C, 0x2B, 0x29, 0x83, 0x31, 0xEE, 0xC5, 0xBD, 0x3A, 0x4B, 0x51, 0x3A, 0x28, 0xD9,
-    0x96, 0xD1, 0x68, 0x7A, 0xB1, 0x1D, 0xF0, 0x71, 0x37, 0x9D, 0xC4, 0xFC, 0x96, 0xE5, 0x05, 0xCC,
-    0x2A, 0x6C, 0x24, 0x90, 0x5F, 0x93, 0x2F, 0x1F, 0x72, 0x62, 0x8F, 0x80, 0xF8, 0xBF, 0x11, 0xFA,
-    0x03, 0xC0, 0x0D, 0x83, 0x17, 0x5B, 0x4A, 0xD2, 0x53, 0x89, 0xF8, 0xA1, 0x03, 0xDA, 0x77, 0xA9,
-    0x7D, 0x5E, 0xE7, 0x06, 0x60, 0x54, 0x66, 0x8F, 0xFA, 0xF4, 0xEE, 0x4B, 0xE6, 0x6F, 0xBF, 0x7D,
-    0xF3, 0xC1, 0xDD, 0x76, 0xFE, 0xC3, 0xCE, 0x7E, 0xA7, 0x8F, 0x21, 0x65, 0xD1, 0x2E, 0xE2, 0x58,
-    0xF6, 0xF6, 0x2F, 0x57, 0x0F, 0x55, 0x1F, 0x77, 0x72, 0x41, 0xCF, 0x30, 0x57, 0xD3, 0xDB, 0x8B,
-    0x63, 0xD4, 0xA7, 0x75, 0x05, 0x88, 0x5B, 0x03, 0xA4, 0xAA, 0x59, 0x7F, 0xC6, 0x75, 0x85, 0x5A,
-    0xE6, 0xE3, 0x16, 0x5F, 0x03, 0x48, 0xF0, 0xF5, 0x5B, 0x8F, 0x8F, 0x69, 0x5A, 0x65, 0xAC, 0x26,
-    0x71, 0xEA, 0x37, 0xA2, 0xFF, 0xA9, 0xEB, 0xF5, 0x4A, 0x15, 0xD0, 0x13, 0xE9, 0x66, 0xC1, 0x64,
-    0x88, 0x3E, 0xCA, 0xA5, 0x95, 0x2E, 0xE8, 0xE3, 0x3E, 0x72, 0xAF, 0xE2, 0xFE, 0x57, 0x25, 0xEB,
-    0x83, 0xA8, 0x94, 0x6F, 0xCA, 0x2D, 0x42, 0x6E, 0xE4, 0x2F, 0xBA, 0x74, 0x0A, 0xA1, 0xEE, 0x31,
-    0xEC, 0xE3, 0xD6, 0xD4, 0x96, 0x86, 0x0F, 0x04, 0x2B, 0x2E, 0xEC, 0x19, 0x83, 0x42, 0x7F, 0xA6,
-    0x09, 0x47, 0x31, 0x35, 0x50, 0xC9, 0x6A, 0xAC, 0x75, 0x5B, 0x27, 0x03, 0xD0, 0x05, 0x8E, 0x55,
-    0x9E, 0x42, 0xFB, 0xB9, 0xED, 0x02, 0xD7, 0x54, 0x2D, 0x6D, 0xB2, 0xE1, 0x5B, 0x9D, 0xF0, 0xCD,
-    0x50, 0xF4, 0xF4, 0x1E, 0x40, 0xCB, 0xD8, 0xA7, 0x5D, 0x89, 0x7A, 0xEB, 0x1E, 0xAC, 0xD2, 0x65,
-    0x60, 0xA1, 0x7E, 0x86, 0x41, 0xDD, 0x85, 0xC2, 0xE6, 0xB4, 0x86, 0x96, 0x0B, 0x58, 0xF7, 0x3B,
-    0xC0, 0x77, 0x36, 0x8D, 0xD8, 0x1E, 0x8F, 0x14, 0x6F, 0x83, 0x9E, 0x66, 0x4C, 0x36, 0xED, 0x31,
-    0x75, 0x57, 0xF3, 0x5B, 0x8C, 0x87, 0x7B, 0xF4, 0xE9, 0xEA, 0x49, 0x92, 0x19, 0xEB, 0xDB, 0x02,
-    0xD0, 0xD0, 0xD5, 0x77, 0xC4, 0xCC, 0x58, 0xDA, 0x45, 0x6F, 0xEA, 0xE0, 0x6A, 0x7E, 0x00, 0x8C,
-    0x7A, 0xFB, 0xB6, 0x33, 0x63, 0xF1, 0xF0, 0x6A, 0x1E, 0xB6, 0x51, 0x9D, 0xB4, 0x66, 0xF8, 0xEA,
-    0xED, 0x6C, 0xB0, 0xDD, 0x37, 0xB0, 0x2C, 0x4C, 0xFD, 0xBB, 0xF2, 0xDD, 0xA8, 0x36, 0x72, 0x2D,
-    0x9D, 0xAA, 0x2E, 0x04, 0x52, 0xEF, 0xB4, 0x5D, 0xF7, 0xF2, 0xB5, 0x97, 0xD2, 0x5B, 0x97, 0x5C,
-    0x59, 0xA8, 0x4A, 0xA2, 0xFC, 0xCB, 0x64, 0x92, 0xEB, 0x80, 0x1C, 0x1D, 0x27, 0x43, 0x0A, 0xC0,
-    0x3A, 0x18, 0x62, 0x56, 0x17, 0x79, 0xE0, 0x80, 0x87, 0x6D, 0x31, 0xCF, 0x31, 0xC3, 0xFC, 0x23,
-    0xC2, 0x04, 0xA1, 0xAE, 0x81, 0xAE, 0x42, 0xF9, 0x92, 0x70, 0x75, 0x51, 0x4D, 0x83, 0x4E, 0x18,
-    0xF8, 0x02, 0xC0, 0xAF, 0x75, 0x4A, 0x47, 0x99, 0x90, 0x2E, 0x49, 0x55, 0x98, 0xD2, 0x0D, 0x55,
-    0x25, 0x1A, 0x03, 0x62, 0xF2, 0x55, 0x05, 0x16, 0x28, 0xC9, 0xAB, 0xD6, 0xD5, 0x71, 0x9F, 0x46,
-    0x30, 0x91, 0x29, 0xEE, 0x0A, 0x80, 0xFC, 0xFD, 0x59, 0x0D, 0xE4, 0x8F, 0xA0, 0xDB, 0x68, 0x7C,
-    0xE9, 0x3A, 0x7B, 0x8D, 0x7F, 0x82, 0x41, 0xB2, 0xB7, 0xBB, 0x89, 0x73, 0x2D, 0xB0, 0xC8, 0x82,
-    0xC9, 0xD0, 0x4A, 0x8B, 0x52, 0xC9, 0xB8, 0x95, 0x58, 0xC9, 0x5B, 0xEE, 0x88, 0x9C, 0x2C, 0x7C,
-    0xE6, 0x59, 0xA2, 0x2A, 0x57, 0x62, 0x05, 0x7F, 0xE9, 0x0D, 0xCB, 0xCB, 0x45, 0xE6, 0xE4, 0x8A,
-    0xF7, 0x82, 0x61, 0x89, 0x73, 0x15, 0x2F, 0x92, 0x05, 0x03, 0x90, 0x08, 0x54, 0xB4, 0xAE, 0xEA,
-    0xF0, 0x27, 0xBD, 0xEF, 0x46, 0xCA, 0x76, 0xE9, 0x18, 0xCD, 0x61, 0x2E, 0xA4, 0x79, 0x7A, 0x03,
-    0x34, 0x5F, 0xFC, 0x84, 0xAD, 0x29, 0x07, 0x1E, 0x0E, 0xC0, 0xE6, 0x21, 0x15, 0x46, 0x59, 0xA1,
-    0xFD, 0x96, 0xF7, 0x2D, 0xFE, 0x40, 0xD8, 0x0A, 0x86, 0x79, 0xD5, 0x0B, 0x78, 0xA4, 0x76, 0x6D,
-    0x94, 0x0E, 0x83, 0xFC, 0x02, 0xE5, 0x23, 0x5B, 0x01, 0xB6, 0xE0, 0x36, 0xC5, 0xE3, 0xF3, 0xB4,
-    0x84, 0x56, 0xA5, 0xCB, 0x14, 0x36, 0x70, 0x1C, 0x84, 0xFB, 0xF7, 0x8A, 0xB0, 0xA1, 0xE3, 0x1D,
-    0x6C, 0x19, 0xF8, 0xFA, 0x2C, 0xD8, 0xFE, 0x54, 0x61, 0x7B, 0x38, 0x3E, 0x05, 0xDB, 0x01, 0x7D,
-    0x5A, 0xCB, 0xD1, 0x4E, 0xC3, 0x86, 0x31, 0x3B, 0xD1, 0x29, 0x80, 0x40, 0x48, 0x6C, 0x1D, 0x41,
-    0xE4, 0x5A, 0xBC, 0xF2, 0xB4, 0xDF, 0xE4, 0x9A, 0x3F, 0xC2, 0x08, 0xC9, 0xB4, 0x3C, 0x27, 0x7C,
-    0x4E, 0xBF, 0x91, 0xF5, 0x53, 0x02, 0x01, 0xF9, 0x61, 0xD2, 0xBC, 0x23, 0x8A, 0x87, 0x02, 0xA5,
-    0xF0, 0x53, 0x67, 0xC2, 0x99, 0xBC, 0x20, 0x85, 0x44, 0xB5, 0xCC, 0x01, 0xBD, 0x35, 0x08, 0x00,
-    0x6F, 0xA5, 0xF7, 0x7B, 0x5B, 0x99, 0x54, 0x99, 0xEA, 0xBC, 0x55, 0x2A, 0x2C, 0x0B, 0xBE, 0x1F,
-    0xE4, 0xA7, 0xE5, 0x29, 0xA8, 0x6C, 0x43, 0x43, 0x0C, 0x15, 0xD6, 0x62, 0xDC, 0x20, 0x1C, 0xCE,
-    0xFC, 0x58, 0x1C, 0xA1, 0x4F, 0xF3, 0x10, 0x63, 0x87, 0x13, 0x75, 0x55, 0x10, 0x32, 0xF8, 0x37,
-    0x80, 0x80, 0xC1, 0xE9, 0x7F, 0xA0, 0x4B, 0x33, 0x9F, 0x38, 0xF5, 0x3A, 0x3D, 0xFD, 0xA4, 0xCB,
-    0xB9, 0xBA, 0x07, 0x7E, 0xC7, 0x5A, 0xC1, 0xAA, 0x18, 0x11, 0x46, 0x08, 0x38, 0x12, 0xF0, 0xA9,
-    0x24, 0x81, 0x4A, 0x62, 0xEA, 0x8D, 0x17, 0x5E, 0xF8, 0xAA, 0x90, 0xCF, 0x75, 0x05, 0xCA, 0xB4,
-    0x2A, 0xB2, 0x54, 0x84, 0x23, 0x56, 0xC1, 0xD5, 0x53, 0x7A, 0x99, 0xD3, 0x7F, 0x55, 0xF0, 0xE8,
-    0xC4, 0xA1, 0xC2, 0x72, 0x11, 0x3A, 0x1A, 0x89, 0x83, 0x6D, 0x21, 0x3A, 0x04, 0x07, 0x3C, 0x2A,
-    0x35, 0x39, 0x54, 0x9D, 0x90, 0xE7, 0x46, 0xD7, 0x7A, 0xB1, 0xD3, 0x81, 0x81, 0x0F, 0x3A, 0x86,
-    0xF0, 0x8C, 0x66, 0x38, 0x4E, 0x26, 0x5B, 0x44, 0x13, 0x7D, 0x2F, 0xB8, 0x44, 0xA2, 0x81, 0xAA,
-    0xB6, 0x65, 0x56, 0x9E, 0x16, 0x33, 0x56, 0x01, 0xD5, 0x07, 0x87, 0x8B, 0xFF, 0xD6, 0xC7, 0x95,
-    0x9F, 0x9F, 0x74, 0x1B, 0x68, 0xA3, 0x91, 0x6C, 0x92, 0xDD, 0x9F, 0x39, 0x31, 0x3E, 0xA3, 0xD8,
-    0xC2, 0x28, 0xE0, 0x69, 0x20, 0x2F, 0x9E, 0xB1, 0x8F, 0xDF, 0x1C, 0x17, 0x70, 0x53, 0x92, 0xA8,
-    0xA8, 0x80, 0x84, 0x78, 0x16, 0x45, 0x97, 0x11, 0x9A, 0xED, 0x6C, 0xBF, 0xC4, 0x09, 0x6A, 0x62,
-    0x92, 0xDE, 0xE7, 0xC8, 0x8E, 0x1C, 0x10, 0xBF, 0x4B, 0xCB, 0x79, 0x45, 0xCD, 0xF2, 0xEF, 0x33,
-    0x79, 0x4E, 0xC4, 0xDC, 0x3B, 0x3C, 0xD0, 0xE1, 0xE9, 0xBA, 0xA3, 0xC9, 0xE8, 0x0A, 0xFA, 0x36,
-    0x47, 0x85, 0xA1, 0x70, 0xD4, 0x87, 0xAE, 0xFE, 0x1F, 0xD4, 0xAF, 0xAB, 0x66, 0xD1, 0xBF, 0xB7,
-    0x59, 0x6F, 0x00, 0x92, 0x3D, 0xA8, 0xB7, 0x16, 0xA0, 0x66, 0xBB, 0x98, 0x40, 0x4C, 0x7E, 0x5E,
-    0x6C, 0xC0, 0x5B, 0xAE, 0x37, 0x02, 0x71, 0x1F, 0xDE, 0xEA, 0x16, 0x2B, 0xF0, 0xC6, 0xEB, 0xCD,
-    0x40, 0xDF, 0x11, 0x01, 0xA9, 0x1D, 0xA8, 0xFD, 0xD6, 0x5B, 0x43, 0xC0, 0x28, 0xB9, 0x46, 0x5D,
-    0x14, 0xE7, 0x13, 0x8E, 0x77, 0xFE, 0xFA, 0x0E, 0x3F, 0x35, 0xEE, 0xDF, 0x97, 0x5F, 0xFE, 0x32,
-    0xDB, 0x3B, 0x79, 0xD3, 0xA9, 0xB8, 0x95, 0x4E, 0x8B, 0x56, 0xEB, 0x54, 0xAF, 0x7C, 0x5A, 0x63,
-    0x58, 0x1F, 0x63, 0x8A, 0x0F, 0x96, 0xD5, 0xA7, 0x4D, 0x1E, 0x57, 0xB1, 0xF7, 0x26, 0x1F, 0xE6,
-    0x4F, 0x99, 0xD3, 0x5B, 0x69, 0x5B, 0x11, 0x21, 0xA0, 0x16, 0x69, 0x78, 0x0A, 0xE1, 0x8C, 0x7B,
-    0x5C, 0xAA, 0x9F, 0x28, 0x94, 0x76, 0xCC, 0xFC, 0xA6, 0x8E, 0xC2, 0xE1, 0x26, 0x59, 0x86, 0x7B,
-    0x7C, 0xF2, 0x86, 0x87, 0x95, 0xC1, 0x9F, 0x8A, 0xEA, 0xD4, 0x0C, 0x08, 0x2F, 0xCD, 0x25, 0xD7,
-    0x98, 0x9A, 0xDC, 0x64, 0xB4, 0xC9, 0x53, 0xD7, 0xBE, 0x7B, 0xA4, 0x3D, 0xB5, 0xA2, 0x41, 0x64,
-    0xA0, 0xAD, 0x0A, 0xF7, 0x84, 0x0F, 0x94, 0x0C, 0xDE, 0xEB, 0x8D, 0x19, 0xA8, 0x3A, 0x42, 0x15,
-    0xD6, 0xF6, 0x3A, 0xB9, 0xAD, 0x85, 0x18, 0x6F, 0xD3, 0xFE, 0x63, 0xF3, 0x62, 0xE3, 0xD5, 0x6D,
-    0x96, 0xBE, 0x9C, 0xB7, 0xDB, 0x92, 0x76, 0x3B, 0x68, 0x74, 0x8D, 0x69, 0xC4, 0x2A, 0x8B, 0xCE,
-    0x43, 0x17, 0x4E, 0x60, 0xF2, 0x0D, 0x61, 0x2B, 0x59, 0xCB, 0x1F, 0xAC, 0x96, 0x8F, 0xC6, 0xB3,
-    0xDE, 0x24, 0x23, 0x35, 0xCF, 0xE0, 0xF0, 0x8C, 0x8C, 0xE9, 0xE4, 0x96, 0xA3, 0xE7, 0x86, 0xF6,
-    0x62, 0x0D, 0x17, 0x55, 0x09, 0x46, 0x3B, 0x77, 0xDB, 0x5E, 0x22, 0xED, 0xBC, 0xF8, 0x70, 0xD6,
-    0x59, 0x37, 0x6C, 0x35, 0x6A, 0x58, 0x5F, 0x6A, 0x42, 0xB2, 0x2C, 0xD5, 0x4D, 0x2B, 0xA0, 0x6B,
-    0x14, 0x51, 0x45, 0x91, 0xEB, 0x4E, 0x3C, 0xA0, 0xD6, 0xA7, 0x00, 0x9B, 0xD0, 0x4A, 0x3D, 0x7B,
-    0x30, 0x6C, 0xBF, 0x9B, 0x46, 0x3E, 0xE7, 0xF5, 0x4B, 0x92, 0x9A, 0xD7, 0xF7, 0x64, 0xE3, 0xFE,
-    0x02, 0xA7, 0xE1, 0x2D, 0x75, 0x6D, 0x3A, 0xD0, 0x2D, 0x42, 0x90, 0xE9, 0x94, 0x94, 0xDF, 0x38,
-    0x59, 0x94, 0x98, 0x53, 0x9F, 0x58, 0x0B, 0xEE, 0xF1, 0x5F, 0x2F, 0x54, 0x4D, 0x9A, 0xC2, 0x22,
-    0x53, 0x21, 0x38, 0xEB, 0x78, 0xBE, 0xC5, 0x90, 0x43, 0x83, 0x66, 0xE7, 0x53, 0xAA, 0x61, 0xD1,
-    0x71, 0xB4, 0x6E, 0x75, 0x72, 0xB2, 0xC8, 0xA7, 0xA2, 0x06, 0xDE, 0x4C, 0xF9, 0x31, 0x72, 0x7E,
-    0x01, 0x30, 0x53, 0x41, 0xEB, 0xB7, 0x1D, 0x1D, 0x2C, 0x51, 0x70, 0x37, 0xF1, 0x7C, 0x3A, 0xC0,
-    0x09, 0x47, 0xEE, 0x77, 0xA6, 0xE7, 0x08, 0xCF, 0xBD, 0xDC, 0xCF, 0x8A, 0xAF, 0x62, 0x79, 0x9D,
-    0xBE, 0xD2, 0x37, 0x34, 0x93, 0x24, 0x4C, 0x88, 0xDC, 0xC9, 0x8B, 0x14, 0x86, 0xF1, 0x29, 0xE9,
-    0xD9, 0x89, 0x46, 0x3C, 0x1A, 0xAA, 0xE5, 0xFE, 0x63, 0xA7, 0x39, 0x65, 0xB4, 0xB4, 0x67, 0x56,
-    0xE4, 0xFC, 0x0A, 0x04, 0x11, 0x71, 0x0D, 0x7E, 0xC5, 0xCF, 0x9F, 0xB4, 0x38, 0xF8, 0x34, 0x3B,
-    0x69, 0x34, 0x70, 0x79, 0xD6, 0x15, 0xFF, 0x87, 0x8F, 0x57, 0x38, 0x36, 0xBB, 0x26, 0x32, 0x1C,
-    0x8D, 0xB0, 0x50, 0x16, 0x52, 0x36, 0x5F, 0x24, 0x54, 0x3A, 0x5E, 0x4F, 0xE4, 0x8A, 0x0A, 0xA5,
-    0x21, 0x24, 0x7C, 0xDC, 0x2C, 0xAF, 0x94, 0x53, 0xC0, 0xEB, 0xB7, 0xFA, 0xA5, 0x7F, 0x46, 0x1D,
-    0xEC, 0xCF, 0x92, 0x2B, 0x41, 0x3F, 0x60, 0xDB, 0xB8, 0x0B, 0xC7, 0xFF, 0x37, 0x19, 0xE2, 0x1E,
-    0x11, 0xB3, 0xBB, 0x34, 0xA2, 0xC3, 0x0A, 0x49, 0x0D, 0x7E, 0xB7, 0x0F, 0x5D, 0xB9, 0x77, 0xF5,
-    0xE0, 0xCA, 0x67, 0x80, 0xA1, 0x19, 0xBE, 0x66, 0x0A, 0x1A, 0x90, 0x77, 0x8B, 0x9D, 0x50, 0x96,
-    0x70, 0x5A, 0xE2, 0xBC, 0x68, 0x5C, 0x5C, 0x4C, 0xB2, 0x89, 0x1A, 0x29, 0x6E, 0xB8, 0x29, 0x02,
-    0xA8, 0x9D, 0xB0, 0x1B, 0xA5, 0x48, 0xDA, 0x3C, 0x45, 0x52, 0xAA, 0xF4, 0xB8, 0xC0, 0x5A, 0xDE,
-    0x17, 0x35, 0x1F, 0xE6, 0x1D, 0x6A, 0x34, 0xA9, 0x7E, 0x49, 0xC6, 0x83, 0x8A, 0x59, 0x15, 0x5A,
-    0xE4, 0x1C, 0x16, 0x16, 0x04, 0xB5, 0x63, 0x14, 0x74, 0x1B, 0x8E, 0x29, 0xAD, 0xD8, 0x25, 0xB4,
-    0x4D, 0x7B, 0x93, 0xC6, 0x0C, 0x70, 0x48, 0xA3, 0x1D, 0xDB, 0x65, 0x9C, 0xE2, 0x5E, 0x35, 0xA9,
-    0x1B, 0xF0, 0xAB, 0x06, 0x13, 0x50, 0x67, 0xA5, 0x0E, 0xA1, 0xD4, 0x81, 0x72, 0x5A, 0xEE, 0x07,
-    0x7E, 0xB6, 0x51, 0xFB, 0x77, 0xBA, 0x08, 0x59, 0x9D, 0x09, 0x9F, 0x3C, 0xE0, 0xAD, 0x41, 0x39,
-    0xF5, 0x82, 0x29, 0x3F, 0xCB, 0x5C, 0x9C, 0xCE, 0x10, 0x18, 0x00, 0x60, 0x26, 0x60, 0x8E, 0x08,
-    0x21, 0x20, 0x8C, 0x58, 0x51, 0xE9, 0x69, 0xCF, 0xAC, 0x28, 0xD1, 0x05, 0xD5, 0x6C, 0xE4, 0x3A,
-    0xA6, 0xB5, 0x4F, 0x98, 0xE6, 0xC7, 0x53, 0x75, 0x99, 0x9C, 0x91, 0xFD, 0x8C, 0x8D, 0xEE, 0x8D,
-    0xA4, 0x8E, 0x87, 0x0E, 0x28, 0xD9, 0x81, 0x89, 0x87, 0x41, 0xD4, 0x8F, 0xAC, 0xCE, 0x45, 0x4A,
-    0x2C, 0x35, 0x33, 0x71, 0xD7, 0xA6, 0x68, 0x54, 0xF5, 0x8C, 0x37, 0x61, 0x3E, 0xAE, 0xDD, 0xC5,
-    0x83, 0x7E, 0x01, 0x2F, 0x2B, 0xD8, 0x93, 0x89, 0x6C, 0x92, 0x96, 0xB5, 0x2F, 0x6B, 0x35, 0xC0,
-    0xA2, 0x22, 0x33, 0xA5, 0x1D, 0x3B, 0xFF, 0x80, 0x01, 0xC7, 0xC0, 0x65, 0x83, 0x19, 0x24, 0x23,
-    0x35, 0x13, 0xC0, 0xB3, 0x33, 0x52, 0x6D, 0x58, 0xBB, 0x31, 0xBD, 0x9A, 0xD5, 0x44, 0x60, 0xD1,
-    0x3D, 0xB5, 0x58, 0xD4, 0x1C, 0x40, 0xAB, 0x46, 0xF8, 0x59, 0xD7, 0xE0, 0x48, 0xAD, 0x22, 0xFB,
-    0xB1, 0xF3, 0xC5, 0x23, 0x1F, 0x17, 0x00, 0x02, 0xA7, 0x61, 0x58, 0xE5, 0x3C, 0x21, 0xAA, 0x6E,
-    0xF5, 0x0E, 0xE4, 0x98, 0x4F, 0x65, 0x01, 0xB1, 0xF2, 0x41, 0xD4, 0xED, 0xDE, 0xB5, 0xAA, 0xE3,
-    0x6B, 0x09, 0x9F, 0xEF, 0x7A, 0x4E, 0xA7, 0x76, 0xDB, 0xBB, 0x40, 0x35, 0x9F, 0xCC, 0x67, 0x41,
-    0x3E, 0x48, 0xFB, 0xD9, 0xA4, 0x89, 0xDF, 0x53, 0x85, 0x92, 0xA0, 0x1A, 0x34, 0x74, 0x60, 0x5F,
-    0x89, 0xF3, 0x15, 0xB5, 0xBF, 0xC2, 0x17, 0x33, 0x53, 0xFC, 0x84, 0x0B, 0x01, 0xBE, 0x81, 0x14,
-    0xAA, 0x84, 0xD7, 0x63, 0x42, 0x9C, 0x01, 0xEB, 0x6B, 0xC8, 0x74, 0x19, 0xB8, 0xD5, 0xA9, 0xB2,
-    0x85, 0xCE, 0x60, 0xD8, 0x4D, 0x10, 0xCD, 0x11, 0x3C, 0x84, 0x8C, 0x88, 0x8F, 0x5F, 0xF3, 0x95,
-    0x10, 0xD7, 0xE9, 0x72, 0xE8, 0xD5, 0xAD, 0x0C, 0xBA, 0x42, 0x06, 0xF1, 0xAE, 0x01, 0x72, 0xB8,
-    0x75, 0x59, 0x2E, 0xD0, 0x49, 0xC5, 0xFD, 0x35, 0x6A, 0xC8, 0x9D, 0xA7, 0x86, 0xFE, 0x4B, 0x83,
-    0xAD, 0x41, 0x2B, 0x7B, 0xE7, 0x4D, 0xFD, 0xAB, 0x31, 0x8F, 0x83, 0xFC, 0x8A, 0x72, 0x17, 0x59,
-    0xD3, 0xF4, 0xA4, 0x2E, 0xB8, 0x4E, 0xAD, 0xC1, 0xD2, 0x2C, 0x02, 0xF7, 0x93, 0xB3, 0x8B, 0xCD,
-    0x72, 0x34, 0xEB, 0xEA, 0x62, 0x8F, 0xA1, 0x72, 0x47, 0xE4, 0x3E, 0xA8, 0x7A, 0xBC, 0x97, 0xF1,
-    0xAC, 0x44, 0x56, 0xD5, 0xCC, 0xBF, 0x11, 0x7B, 0x33, 0xCC, 0x9C, 0xD4, 0xC3, 0xB9, 0x5C, 0x6D,
-    0xA9, 0x61, 0xD4, 0x9D, 0x76, 0x24, 0xE4, 0x78, 0x5C, 0x28, 0x7A, 0x37, 0x4D, 0x56, 0x68, 0x40,
-    0xE2, 0xC8, 0xFA, 0xDE, 0x7F, 0x91, 0x64, 0xA6, 0x11, 0xB2, 0xD5, 0xF0, 0x30, 0x71, 0x8B, 0x7F,
-    0x5E, 0xEA, 0xAA, 0xB4, 0x98, 0x23, 0xE5, 0xC9, 0x35, 0xFF, 0xDC, 0x44, 0xF3, 0x07, 0x9D, 0xE6,
-    0xED, 0xAC, 0x3E, 0x30, 0x7B, 0xAA, 0x5C, 0x1D, 0xBB, 0xAA, 0xCD, 0x46, 0x3B, 0xAC, 0x5A, 0xBE,
-    0xB8, 0xE2, 0xB0, 0x25, 0x8B, 0xF0, 0xAE, 0x77, 0xB5, 0xC8, 0x4E, 0xD5, 0xDA, 0xD7, 0xD1, 0xB0,
-    0x5D, 0x3D, 0x60, 0xA6, 0xF5, 0x03, 0x2B, 0x6B, 0x77, 0xEB, 0xEC, 0xBF, 0xFF, 0xAC, 0x07, 0xCA,
-    0xAD, 0x85, 0x3C, 0x72, 0x1B, 0xEB, 0x0F, 0xBC, 0xCA, 0xFC, 0x55, 0x6D, 0x6A, 0x99, 0xEC, 0x66,
-    0xBE, 0xB5, 0x15, 0x03, 0xA6, 0xB3, 0x49, 0x17, 0x08, 0x79, 0xB6, 0xFD, 0xA1, 0x68, 0x13, 0xB7,
-    0x19, 0xC2, 0x00, 0xE2, 0x8D, 0x1C, 0xB0, 0xA9, 0xE2, 0x93, 0xCD, 0x0F, 0x59, 0x97, 0x4E, 0x76,
-    0xF9, 0x21, 0x9A, 0x63, 0xE2, 0xB6, 0x3C, 0x5D, 0xBB, 0xB6, 0x58, 0xBA, 0x4A, 0x46, 0x3B, 0x9A,
-    0x8D, 0x20, 0xD5, 0x9F, 0x39, 0xD9, 0x4C, 0x8F, 0x91, 0xDA, 0x16, 0x03, 0x98, 0x41, 0xB2, 0x91,
-    0xD0, 0xB8, 0xF9, 0xB5, 0xED, 0xBC, 0xDD, 0x26, 0xBF, 0xF1, 0x4F, 0xB8, 0x2D, 0x38, 0xCE, 0x53,
-    0x84, 0x17, 0x64, 0x35, 0xD7, 0xC4, 0xB9, 0xAD, 0xE4, 0xA1, 0xFB, 0x27, 0xA6, 0x1A, 0x8B, 0x50,
-    0x2B, 0xF8, 0xD2, 0x79, 0xC5, 0x94, 0x6E, 0xA7, 0xC5, 0xC0, 0xAD, 0xC8, 0xA3, 0x58, 0x69, 0x31,
-    0x75, 0xEB, 0x07, 0x56, 0x95, 0x77, 0xB7, 0xD2, 0x62, 0xB1, 0x32, 0xA4, 0x74, 0x65, 0x1A, 0xC1,
-    0xA7, 0xD6, 0xB1, 0x86, 0x05, 0x3E, 0x7C, 0x5D, 0x0A, 0x73, 0xB6, 0xDD, 0xD5, 0x3F, 0xCE, 0xBE,
-    0xE8, 0x7A, 0x47, 0x52, 0x2F, 0x3E, 0x58, 0xDD, 0xC7, 0x81, 0xC1, 0xE1, 0x43, 0xD5, 0xF2, 0x03,
-    0x89, 0xB3, 0xA5, 0x75, 0xF1, 0x3F, 0x0B, 0xA5, 0x01, 0x7D, 0x7B, 0x19, 0x32, 0x68, 0xCC, 0xB1,
-    0x38, 0x60, 0x84, 0x58, 0x41, 0xF8, 0x80, 0x25, 0x03, 0x9A, 0x06, 0x01, 0x18, 0xFD, 0x0F, 0x12,
-    0x37, 0xEE, 0x81, 0xF3, 0x99, 0x9A, 0x0F, 0x8B, 0x9B, 0x25, 0x87, 0x4A, 0x34, 0x64, 0x08, 0x56,
-    0x46, 0xB4, 0xB2, 0xBE, 0x72, 0x9B, 0x75, 0xC8, 0x5B, 0x3B, 0xAF, 0x12, 0x75, 0xF2, 0x73, 0x5F,
-    0xCF, 0xD5, 0xBC, 0x54, 0x2F, 0x6A, 0x26, 0x91, 0xAF, 0x61, 0xA9, 0xB5, 0x65, 0x6A, 0x14, 0x85,
-    0x5A, 0xF7, 0x24, 0x45, 0xFE, 0x9C, 0xCF, 0x42, 0x4B, 0x39, 0xE1, 0xCC, 0x20, 0x37, 0x9A, 0xF8,
-    0x1E, 0x73, 0xD7, 0x0A, 0xFD, 0x71, 0xB1, 0xED, 0x5D, 0x39, 0x38, 0xFC, 0xD5, 0xD1, 0x45, 0xB6,
-    0x4D, 0x19, 0x75, 0x63, 0x8F, 0x9A, 0x49, 0x7E, 0x4E, 0x1B, 0x03, 0x0D, 0x81, 0x81, 0x1A, 0x78,
-    0x0B, 0xC6, 0x94, 0x0D, 0xF7, 0xEF, 0xCA, 0xAC, 0x83, 0xD0, 0x69, 0x4F, 0x09, 0x07, 0xB8, 0x17,
-    0x20, 0x83, 0xA8, 0x78, 0xF2, 0xF2, 0x70, 0x79, 0x4F, 0xE4, 0x54, 0xA6, 0x38, 0xAE, 0x5B, 0x6A,
-    0x3B, 0xA1, 0xAF, 0x4B, 0xE4, 0x4B, 0x05, 0x42, 0x4B, 0x85, 0x86, 0x0B, 0x38, 0x9D, 0xB6, 0x51,
-    0xC8, 0xD7, 0x73, 0x5F, 0x43, 0xB2, 0xCB, 0xAE, 0x4D, 0x31, 0x91, 0xA4, 0x00, 0x94, 0x6B, 0x83,
-    0xD1, 0x74, 0x61, 0x1F, 0xF5, 0x51, 0x17, 0xE3, 0x65, 0xBA, 0xB8, 0xAD, 0x9A, 0x44, 0x2B, 0x69,
-    0xAC, 0x58, 0xB4, 0x92, 0x7E, 0xB0, 0x7A, 0x54, 0xB4, 0x0E, 0xBD, 0xF1, 0x30, 0x3F, 0x14, 0x6D,
-    0x11, 0x6B, 0x4F, 0x17, 0xB9, 0x21, 0x63, 0xEA, 0x68, 0x80, 0xE8, 0x05, 0x22, 0xD8, 0xA4, 0x73,
-    0x6F, 0xC8, 0x8C, 0x0C, 0x2C, 0x7D, 0xAF, 0x47, 0xEC, 0x8E, 0x2E, 0xEC, 0x3B, 0x50, 0xC4, 0x00,
-    0x22, 0x29, 0xF2, 0xA2, 0x61, 0x08, 0x20, 0x8C, 0x9E, 0xD3, 0xE9, 0x5B, 0x33, 0x7D, 0x6C, 0x0D,
-    0x2F, 0x38, 0x68, 0x8A, 0x5A, 0xE1, 0xB5, 0x77, 0x65, 0x53, 0xD6, 0xD0, 0xA4, 0x83, 0xB3, 0x23,
-    0x0F, 0xA5, 0xA7, 0x95, 0xB1, 0xAF, 0x9B, 0x93, 0xB3, 0x66, 0xD7, 0x73, 0x3C, 0x45, 0x43, 0x38,
-    0x32, 0xB9, 0x4A, 0x9A, 0x70, 0x34, 0x75, 0x38, 0xA4, 0x79, 0x34, 0x64, 0x50, 0x8D, 0xC5, 0x30,
-    0xF6, 0x43, 0xD7, 0x71, 0x47, 0x94, 0x1B, 0x68, 0x50, 0x70, 0xEB, 0x0B, 0x37, 0x92, 0xE6, 0x3E,
-    0x45, 0xE3, 0x8B, 0xC1, 0x59, 0xFC, 0x2C, 0x15, 0x72, 0x48, 0xC2, 0xC3, 0x34, 0x39, 0x82, 0x86,
-    0x38, 0x26, 0x18, 0xA6, 0x02, 0xD7, 0x64, 0xB5, 0x45, 0x1F, 0x1C, 0x34, 0xA9, 0x65, 0x02, 0xE1,
-    0x60, 0x82, 0x6F, 0xEA, 0xBC, 0x3A, 0xCD, 0x59, 0x38, 0xB7, 0xAD, 0x23, 0x51, 0xAB, 0xD1, 0xC4,
-    0x4E, 0xE7, 0x00, 0x23, 0xB8, 0x3F, 0x8B, 0x69, 0x56, 0xE3, 0x07, 0x95, 0xEE, 0x7D, 0x42, 0x52,
-    0xD8, 0x27, 0x66, 0x27, 0x98, 0xA7, 0x14, 0x18, 0x25, 0xCB, 0x93, 0x8E, 0xD3, 0x43, 0x18, 0x3D,
-    0x87, 0x58, 0x04, 0x39, 0x56, 0x44, 0xCD, 0xF9, 0x61, 0x5E, 0x74, 0x87, 0x8E, 0x01, 0x45, 0xB9,
-    0x4C, 0x30, 0x8B, 0x91, 0xF8, 0x7C, 0x0C, 0x35, 0x22, 0x7C, 0x31, 0x7F, 0x82, 0x88, 0xF8, 0xF8,
-    0xF7, 0x76, 0x93, 0x61, 0xFA, 0x46, 0xFC, 0x58, 0x82, 0x32, 0x2D, 0x94, 0xD2, 0x26, 0x1D, 0x01,
-    0x0C, 0xB9, 0xE5, 0x06, 0x7D, 0x96, 0x37, 0x10, 0xB3, 0x12, 0x41, 0xEE, 0xB7, 0x45, 0xF0, 0xCD,
-    0xF4, 0x6C, 0x35, 0x21, 0x8C, 0xB8, 0x2E, 0x32, 0xD5, 0xC6, 0x55, 0x68, 0x29, 0x61, 0x59, 0xD5,
-    0x36, 0xCE, 0xD7, 0x54, 0x75, 0x39, 0x17, 0x1F, 0x9F, 0x5D, 0x50, 0x3D, 0xF2, 0x11, 0x62, 0xA9,
-    0x4A, 0x23, 0x82, 0xAC, 0x65, 0xD7, 0x0A, 0x21, 0xF5, 0x26, 0xC4, 0x30, 0xE0, 0x4D, 0x82, 0x28,
-    0x54, 0x9D, 0xA2, 0xA8, 0x7B, 0xCC, 0x0A, 0xA3, 0xD1, 0x44, 0x71, 0x3E, 0x45, 0x8A, 0x9A, 0xF6,
-    0x5E, 0xF7, 0xD6, 0xCE, 0x82, 0xE8, 0x7E, 0xF9, 0x0B, 0xB6, 0x93, 0x45, 0xF4, 0x00, 0x2E, 0x31,
-    0x73, 0x8B, 0x28, 0xEE, 0xA3, 0x11, 0xBD, 0x41, 0xB9, 0x35, 0x66, 0x30, 0xEE, 0xBD, 0x85, 0x2E,
-    0xC9, 0x1F, 0x6F, 0xB1, 0xC5, 0x64, 0xB8, 0x4F, 0xE2, 0xEE, 0x63, 0x22, 0x8F, 0x7F, 0x94, 0x67,
-    0xCA, 0xD9, 0xB4, 0x88, 0x5A, 0x5E, 0xC0, 0x08, 0xEE, 0x38, 0xF5, 0xB5, 0xC9, 0x2E, 0xF3, 0x15,
-    0x4A, 0x7D, 0xE7, 0x58, 0xF1, 0x26, 0x7C, 0x3D, 0xC7, 0x33, 0x02, 0xFE, 0x7C, 0xC2, 0xF1, 0x21,
-    0xEC, 0x24, 0xEE, 0x75, 0xD3, 0xCB, 0xB4, 0x12, 0x4C, 0x7A, 0x5E, 0x20, 0x9C, 0x03, 0x49, 0x1F,
-    0x6F, 0xCF, 0x27, 0x9C, 0x83, 0x9C, 0x17, 0x74, 0xB3, 0x94, 0x83, 0x7C, 0xE9, 0xBA, 0x56, 0xBD,
-    0xC1, 0x28, 0xE1, 0x0F, 0x37, 0x49, 0xE3, 0x2E, 0x95, 0xEF, 0xCE, 0x4A, 0x16, 0x97, 0xEB, 0xDC,
-    0xE0, 0x0B, 0x5F, 0xF6, 0x09, 0xAD, 0x2A, 0xCD, 0xB3, 0xFA, 0xB5, 0x16, 0x38, 0x0C, 0x0C, 0xEA,
-    0x29, 0xF3, 0xF7, 0xDD, 0x87, 0x57, 0x29, 0x88, 0x16, 0x26, 0x92, 0x39, 0xBF, 0x11, 0x2C, 0x06,
-    0x47, 0x0D, 0xB5, 0x72, 0x6E, 0x95, 0x0E, 0xDD, 0x5E, 0x42, 0x0D, 0x75, 0xBD, 0x93, 0xDF, 0x81,
-    0xFF, 0xDC, 0x17, 0xE5, 0x30, 0x7A, 0xB6, 0x80, 0x7B, 0xE5, 0x72, 0x43, 0x28, 0x48, 0xE4, 0xE9,
-    0x81, 0x9B, 0xD5, 0x6E, 0x0E, 0x28, 0x09, 0xBB, 0x54, 0x86, 0xC8, 0x1E, 0x05, 0xBD, 0x8A, 0x62,
-    0x7C, 0x21, 0x0A, 0xF6, 0x71, 0xF4, 0x68, 0x23, 0x05, 0x77, 0xAB, 0x35, 0x12, 0xAD, 0x9C, 0xCF,
-    0xC5, 0xA2, 0x3E, 0x1C, 0xFE, 0xCF, 0x47, 0xD6, 0xE4, 0xA3, 0xBA, 0x44, 0xAA, 0xBD, 0xC4, 0x4A,
-    0x72, 0x32, 0xFA, 0xBC, 0x23, 0x76, 0xD9, 0xF0, 0xAC, 0x3D, 0x27, 0x86, 0x5E, 0x14, 0x42, 0xF5,
-    0xA0, 0x52, 0x84, 0xE3, 0xDE, 0x1D, 0x51, 0x31, 0x34, 0xBF, 0xA2, 0x1C, 0x08, 0x15, 0x7F, 0x74,
-    0xE8, 0x51, 0xD5, 0x03, 0x09, 0x94, 0xC4, 0x9F, 0x2C, 0xD9, 0x1C, 0xCB, 0x68, 0xBD, 0x2C, 0x58,
-    0xE7, 0x46, 0xFF, 0x33, 0x25, 0x5E, 0x7C, 0xEC, 0xF9, 0x9C, 0xFB, 0xBE, 0x1D, 0x6B, 0x64, 0x77,
-    0xE8, 0xBE, 0xC0, 0x80, 0x05, 0xF3, 0x70, 0x60, 0x55, 0xE4, 0xDC, 0x62, 0xC7, 0x5C, 0x60, 0xC3,
-    0xB2, 0x3F, 0xEC, 0x02, 0x2B, 0xB4, 0x49, 0x1A, 0xDD, 0xC7, 0x3D, 0x9B, 0x26, 0xFF, 0x41, 0xBD,
-    0x0B, 0x5A, 0xA1, 0x49, 0xB8, 0x3B, 0x87, 0x53, 0x93, 0x5A, 0xA3, 0x41, 0x2D, 0xB7, 0x52, 0xD6,
-    0x43, 0xE7, 0x40, 0x23, 0xA0, 0x2F, 0xB9, 0xA1, 0x96, 0x19, 0x80, 0x01, 0x2D, 0x9C, 0xCE, 0xC3,
-    0x59, 0xE9, 0x74, 0xC3, 0x4F, 0xC7, 0xDA, 0x07, 0x3A, 0xE4, 0xBD, 0xCC, 0x1F, 0x96, 0xB1, 0x9E,
-    0xA5, 0xEF, 0x6C, 0x17, 0x43, 0xB6, 0x9C, 0x91, 0xA0, 0x37, 0xC5, 0x7C, 0x4B, 0x30, 0x42, 0x76,
-    0x71, 0x4A, 0x1B, 0x87, 0xD5, 0x7C, 0x6F, 0xCC, 0x3E, 0x76, 0x5F, 0x50, 0xC2, 0x53, 0xF5, 0x61,
-    0x9F, 0x32, 0x65, 0x1A, 0xC5, 0xAB, 0xD3, 0xB7, 0x5A, 0x9D, 0xD5, 0xE0, 0x3F, 0xD6, 0x74, 0xE0,
-    0x05, 0x16, 0xBB, 0x8B, 0xD1, 0x92, 0xE6, 0xE6, 0x41, 0x7F, 0x42, 0xF7, 0x13, 0xFD, 0xB2, 0xAD,
-    0xA1, 0x03, 0x18, 0x8D, 0xF6, 0xCF, 0xB1, 0xAC, 0x66, 0xBD, 0xEE, 0x23, 0xA7, 0xC7, 0x82, 0x86,
-    0x85, 0x19, 0xF1, 0xAE, 0xD9, 0xF4, 0xC2, 0x71, 0x41, 0xFF, 0x32, 0x73, 0xC9, 0x97, 0x69, 0x11,
-    0xE4, 0x37, 0xC6, 0x4D, 0x69, 0xDC, 0x9E, 0xA9, 0x81, 0xF4, 0x07, 0x7E, 0x47, 0x41, 0xE5, 0xCA,
-    0x91, 0x57, 0x70, 0x43, 0xBB, 0xC4, 0x2A, 0x74, 0x80, 0x0F, 0x23, 0xDA, 0x12, 0xAA, 0x2D, 0xF2,
-    0x88, 0x74, 0x8B, 0x58, 0x0C, 0x3C, 0x36, 0x80, 0x13, 0x0C, 0x2B, 0x57, 0x69, 0x87, 0x10, 0x29,
-    0xEB, 0xE0, 0x68, 0xAC, 0x66, 0xE1, 0xD1, 0xC6, 0x43, 0xE9, 0x91, 0x1E, 0x6E, 0xF5, 0xAE, 0xF7,
-    0x97, 0xF7, 0x67, 0x96, 0xD2, 0x06, 0x2D, 0xC1, 0x20, 0x52, 0xE9, 0xD0, 0xC5, 0x08, 0x00, 0xAB,
-    0x90, 0x61, 0xC0, 0x4C, 0x22, 0x2D, 0xE3, 0x21, 0x6D, 0xB8, 0x01, 0x16, 0xEB, 0x79, 0xA4, 0xDC,
-    0xFA, 0xED, 0xB9, 0x5A, 0x03, 0x8F, 0x85, 0xBF, 0x37, 0xEE, 0x97, 0xC5, 0xDA, 0x67, 0xBA, 0xDF,
-    0x5F, 0xC4, 0x90, 0x61, 0xB7, 0xB0, 0x21, 0xF7, 0x69, 0xB8, 0x9F, 0x6A, 0xE1, 0x13, 0x4F, 0x6D,
-    0xA6, 0x06, 0xD5, 0x31, 0x74, 0x31, 0x6B, 0x2D, 0x03, 0x89, 0xE3, 0xC8, 0x2A, 0x05, 0x5C, 0x6F,
-    0x56, 0xF3, 0x10, 0x8A, 0x1E, 0xE0, 0x69, 0x83, 0x99, 0xA7, 0x7A, 0x02, 0xFC, 0xAB, 0x0B, 0xB4,
-    0x32, 0x7E, 0x17, 0xB7, 0xD3, 0x03, 0x04, 0xDE, 0x5F, 0xEC, 0xE9, 0x56, 0xCD, 0x35, 0xBF, 0x21,
-    0x9A, 0x22, 0x39, 0x8E, 0x1E, 0x62, 0xD0, 0xAF, 0xED, 0xE7, 0x72, 0x6A, 0x1C, 0xF1, 0xC5, 0xC9,
-    0x89, 0xB1, 0x5E, 0xA7, 0x03, 0xC1, 0xED, 0x75, 0x49, 0xA7, 0x23, 0x9A, 0x8E, 0x23, 0x51, 0x67,
-    0x30, 0x92, 0x74, 0x0C, 0x96, 0x1D, 0xB8, 0x56, 0xFC, 0x06, 0x12, 0x4B, 0xF5, 0xF3, 0xC6, 0xFF,
-    0xC6, 0x8B, 0xFF, 0xCD, 0x77, 0xFE, 0xD7, 0x3E, 0xBD, 0xA1, 0x49, 0x00, 0x65, 0xD9, 0x78, 0xCA,
-    0x05, 0x54, 0x4E, 0xC5, 0x8F, 0x3A, 0xA6, 0x62, 0x88, 0xF5, 0x04, 0x2A, 0x07, 0x88, 0x3A, 0x28,
-    0x51, 0x94, 0x74, 0xD9, 0xA7, 0x2E, 0xFD, 0x8E, 0x80, 0x5A, 0x67, 0xA5, 0xA6, 0xC7, 0x22, 0xBF,
-    0x22, 0xA9, 0xBB, 0xFD, 0xFE, 0x64, 0x41, 0x2D, 0x6B, 0xC7, 0x7C, 0x70, 0x25, 0xDC, 0xB8, 0xB8,
-    0xF7, 0x76, 0xD9, 0x31, 0x37, 0x31, 0xD4, 0xAC, 0xB4, 0x5C, 0xAC, 0x69, 0x65, 0xD1, 0x7E, 0xAA,
-    0xB2, 0xA0, 0xD7, 0x6F, 0x78, 0x98, 0x3C, 0xFD, 0x2C, 0x86, 0x61, 0xBC, 0xD5, 0x2F, 0x75, 0x7D,
-    0xEB, 0x1F, 0xA9, 0x7C, 0xFB, 0x65, 0x03, 0xD1, 0x93, 0x47, 0xDC, 0x9F, 0xD5, 0xBE, 0x5C, 0xB5,
-    0xD7, 0x12, 0x8F, 0xC7, 0x51, 0xB3, 0x77, 0xDD, 0x6E, 0x7B, 0xA0, 0xDA, 0x73, 0xDF, 0x51, 0xE8,
-    0x66, 0xCB, 0xBD, 0xDD, 0x70, 0x2C, 0x78, 0x7E, 0x22, 0x1A, 0x9C, 0x56, 0xBE, 0x1F, 0x4D, 0xBA,
-    0xBB, 0xFB, 0x64, 0xD4, 0xA9, 0xBB, 0x27, 0xFE, 0x8F, 0x66, 0xF5, 0x7E, 0x05, 0x33, 0x66, 0xEB,
-    0x7C, 0x11, 0xA0, 0xD4, 0x24, 0x7C, 0xD8, 0xE5, 0x6C, 0xCB, 0xF6, 0xDD, 0x52, 0xBD, 0x5D, 0xB6,
-    0xF1, 0x96, 0x93, 0x13, 0x5A, 0xD9, 0xDF, 0xD6, 0x77, 0xFD, 0x56, 0xCB, 0x72, 0x92, 0x62, 0x33,
-    0x8D, 0xCC, 0xB7, 0xF8, 0xA6, 0x9F, 0xEF, 0x06, 0x2F, 0x2A, 0x22, 0xE9, 0x97, 0x47, 0x38, 0x66,
-    0x71, 0x8A, 0x1A, 0x80, 0x5C, 0x85, 0xA5, 0x35, 0x9B, 0x26, 0x98, 0x8C, 0x06, 0x3C, 0xD1, 0x98,
-    0x22, 0x4C, 0xCF, 0x6A, 0x04, 0x6D, 0xA5, 0xE9, 0x6D, 0x8E, 0xF4, 0x23, 0xB7, 0x9D, 0x6D, 0x2A,
-    0x1E, 0x19, 0x6C, 0xAC, 0x0F, 0xC5, 0x19, 0xE5, 0x95, 0xFB, 0x3B, 0x65, 0xDE, 0x38, 0xBD, 0xB3,
-    0xF2, 0xD9, 0xAE, 0xFC, 0x0B, 0x8F, 0x97, 0xD4, 0x1E, 0x20, 0xC6, 0x72, 0x5C, 0xA1, 0x73, 0x86,
-    0x40, 0x7B, 0xE7, 0xAE, 0xBF, 0x70, 0xFF, 0xE4, 0x08, 0x75, 0xCB, 0xA6, 0x2F, 0xE0, 0xE0, 0xFC,
-    0x8E, 0x48, 0x1D, 0x3C, 0xB5, 0x23, 0x52, 0x60, 0xBD, 0x73, 0x20, 0x18, 0x56, 0xDA, 0xE8, 0xA9,
-    0x33, 0x8D, 0x88, 0x6A, 0x46, 0x8F, 0xE0, 0x54, 0x8E, 0x15, 0x31, 0x89, 0xE1, 0x60, 0xD1, 0xC4,
-    0x8A, 0xB1, 0x3F, 0x71, 0xA6, 0xF5, 0x3C, 0x46, 0x7F, 0x83, 0x6C, 0xF1, 0x7B, 0x65, 0x5B, 0x93,
-    0x50, 0x1D, 0x6A, 0x01, 0xC6, 0xD4, 0xF2, 0xBF, 0xBA, 0x1C, 0x8D, 0x09, 0xAE, 0x79, 0xA4, 0x43,
-    0x9F, 0x59, 0xAB, 0xA9, 0x98, 0x4A, 0x22, 0xF7, 0xD7, 0x0A, 0x67, 0x34, 0xF3, 0x1C, 0x4A, 0xF5,
-    0x2E, 0xB3, 0x25, 0xD7, 0x2D, 0xD9, 0xA2, 0xAF, 0xA4, 0xA9, 0xD7, 0xF2, 0xDB, 0xD4, 0x6E, 0x5B,
-    0xDF, 0x61, 0x6D, 0xF2, 0x45, 0xA7, 0x07, 0x58, 0xDB, 0x25, 0xE6, 0x88, 0xF9, 0x69, 0x09, 0x7C,
-    0xE9, 0xE3, 0xD4, 0x21, 0x57, 0xCB, 0x02, 0x32, 0xEF, 0xB3, 0x01, 0xE2, 0x4F, 0x5F, 0xAC, 0x04,
-    0xED, 0x5C, 0x46, 0x6A, 0x5E, 0x13, 0x2D, 0x03, 0x45, 0x45, 0xF0, 0x6B, 0xC4, 0x87, 0xB1, 0x7B,
-    0x0D, 0x82, 0xF9, 0xA9, 0xC3, 0x62, 0xD1, 0x6D, 0xF7, 0x9C, 0x5B, 0x23, 0x62, 0x1F, 0xF9, 0xD3,
-    0xAE, 0xCC, 0x95, 0x75, 0x51, 0x10, 0x22, 0x3D, 0xEB, 0xE1, 0xE1, 0x88, 0xF4, 0xDC, 0x44, 0x75,
-    0x53, 0xEB, 0xF5, 0x05, 0x87, 0xE1, 0x21, 0x0D, 0xDB, 0x61, 0x45, 0x06, 0x57, 0xF7, 0xAE, 0x3C,
-    0x1B, 0x1E, 0x5B, 0x7B, 0x84, 0xD0, 0x9F, 0x85, 0x3C, 0x0B, 0x3E, 0x60, 0xD0, 0xC6, 0xC7, 0x61,
-    0xA0, 0x1C, 0x0E, 0xA7, 0x00, 0x6D, 0xCE, 0xBC, 0x96, 0x4B, 0x3E, 0xED, 0x11, 0xF2, 0xE7, 0x45,
-    0xCC, 0x6E, 0x1F, 0x97, 0x10, 0xED, 0xF1, 0x64, 0xAE, 0x67, 0x0B, 0xDD, 0x17, 0x56, 0x8C, 0x16,
-    0x2A, 0xFC, 0x6F, 0xD5, 0x5C, 0x3D, 0x93, 0xDD, 0xD6, 0x79, 0x3E, 0x00, 0xBC, 0xC4, 0x0C, 0x51,
-    0xC0, 0x45, 0xE8, 0x99, 0x48, 0x33, 0x46, 0x93, 0x22, 0x66, 0x66, 0x82, 0x5F, 0xE0, 0x00, 0xB6,
-    0x0A, 0x97, 0xDA, 0x82, 0xEB, 0x4C, 0xA2, 0xD6, 0x45, 0x62, 0x4F, 0x86, 0x7F, 0xC0, 0x12, 0xE0,
-    0xB8, 0x50, 0xA9, 0x4D, 0xE1, 0x26, 0x29, 0xC2, 0x82, 0xCE, 0x48, 0xEB, 0x82, 0x29, 0xD2, 0x78,
-    0x46, 0x26, 0x20, 0xA9, 0x50, 0xE1, 0xC2, 0xD0, 0xC4, 0xA9, 0x52, 0x18, 0x76, 0xA8, 0xB1, 0x4D,
-    0x17, 0x84, 0x2C, 0x48, 0x06, 0x49, 0x00, 0x27, 0xEF, 0xF3, 0xBC, 0xE7, 0xE0, 0xDE, 0xFD, 0x22,
-    0x29, 0x4F, 0xAC, 0xC8, 0x6B, 0x0B, 0xDC, 0x7B, 0x2F, 0xEE, 0xC1, 0x79, 0x9F, 0xF7, 0xFB, 0xE3,
-    0xAC, 0x31, 0xE6, 0xE0, 0xC4, 0x96, 0xC6, 0xA4, 0xD6, 0x76, 0xC6, 0x24, 0xD6, 0x4E, 0xC6, 0x5C,
-    0x39, 0xF9, 0xFE, 0x0D, 0xF3, 0x84, 0x9F, 0x78, 0xC2, 0x35, 0x5A, 0x71, 0x0D, 0x6D, 0x2B, 0xD7,
-    0xC0, 0x0E, 0x78, 0x61, 0x67, 0x5C, 0x9B, 0x06, 0xD7, 0xEA, 0xA6, 0xAC, 0x67, 0x8A, 0x77, 0x47,
-    0xB9, 0xE6, 0xEF, 0xE1, 0xDE, 0xAC, 0xAF, 0x6A, 0x79, 0xD0, 0x90, 0xC9, 0xBD, 0xE9, 0x14, 0xCB,
-    0xBD, 0xF2, 0x9F, 0x95, 0x85, 0xEC, 0x49, 0xD3, 0xCA, 0xD5, 0xDA, 0x51, 0x16, 0xB2, 0x76, 0x91,
-    0x85, 0xE4, 0xA7, 0xE6, 0xB5, 0x37, 0x55, 0x6F, 0xD2, 0xD9, 0x14, 0x83, 0xDC, 0x61, 0x0A, 0xDC,
-    0x81, 0x07, 0x1E, 0xFC, 0xED, 0x6D, 0xDD, 0x72, 0x23, 0x37, 0xC6, 0xF6, 0xFE, 0x1B, 0x97, 0x6E,
-    0xF6, 0xF9, 0x11, 0x9B, 0x94, 0x75, 0x72, 0x2B, 0x74, 0xAE, 0xF1, 0x62, 0xD2, 0x3E, 0x19, 0x4C,
-    0x65, 0xF2, 0x36, 0x1C, 0x4D, 0x63, 0xD2, 0x36, 0x9C, 0xCC, 0xCB, 0xF2, 0x66, 0x38, 0x98, 0xA2,
-    0x4C, 0xDB, 0x48, 0x9E, 0x75, 0x5F, 0xC8, 0x91, 0x67, 0xB7, 0xF2, 0x3D, 0x8B, 0x8D, 0x4D, 0xB2,
-    0x42, 0xBD, 0xBF, 0xE8, 0x1C, 0x80, 0xD2, 0xD4, 0xF2, 0x5D, 0x4B, 0xE2, 0x63, 0x4B, 0x54, 0xAE,
-    0xDC, 0xBE, 0x6C, 0x23, 0x15, 0x57, 0x48, 0xA7, 0x1D, 0x6A, 0xA6, 0x22, 0x5E, 0x29, 0x5F, 0x84,
-    0xEB, 0xBC, 0x83, 0x2D, 0xFD, 0x60, 0xC1, 0x5B, 0x4B, 0xD6, 0xE3, 0xAD, 0xEF, 0x00, 0x3D, 0xC5,
-    0x2D, 0x5A, 0x03, 0x8B, 0xB7, 0xDA, 0x14, 0x20, 0xAE, 0x27, 0x84, 0x0F, 0xC0, 0x99, 0xCA, 0x82,
-    0x3E, 0xD9, 0x92, 0xEC, 0x23, 0x52, 0xFC, 0x14, 0x39, 0xF9, 0xBF, 0xB1, 0x6D, 0x24, 0x1F, 0x66,
-    0x78, 0xC2, 0x64, 0x66, 0xC1, 0xF0, 0xCE, 0xEC, 0xF6, 0xDD, 0xE0, 0xE1, 0xCF, 0x2F, 0x17, 0x6F,
-    0xF9, 0x0A, 0xDE, 0xCF, 0xED, 0x8A, 0xDB, 0xE4, 0x57, 0x80, 0x17, 0x4D, 0xE1, 0x6C, 0xE2, 0x41,
-    0x2E, 0x49, 0x27, 0x17, 0xA2, 0x97, 0x95, 0xD1, 0x64, 0x72, 0x13, 0x8D, 0xA6, 0x90, 0x6D, 0x2A,
-    0x7C, 0x05, 0x56, 0xCF, 0x71, 0x49, 0x01, 0xBE, 0xC7, 0x4F, 0x45, 0x87, 0x2F, 0xF2, 0x99, 0xA8,
-    0xB5, 0x5E, 0x6E, 0xF2, 0x07, 0xF2, 0x6B, 0xFC, 0x31, 0x1E, 0x69, 0xB3, 0xCE, 0x09, 0x4D, 0x3C,
-    0x01, 0x02, 0x0B, 0xA2, 0x8B, 0x5E, 0x00, 0x50, 0x89, 0xB1, 0xF7, 0xEF, 0xF0, 0x09, 0xB6, 0x8C,
-    0x49, 0x3C, 0xC9, 0xC5, 0xEB, 0x29, 0x5E, 0x41, 0xAC, 0x2C, 0x9A, 0xCE, 0x9B, 0xAC, 0x10, 0xC4,
-    0x18, 0x72, 0x68, 0xEE, 0x1E, 0x12, 0xEF, 0x12, 0x10, 0x52, 0x62, 0x9B, 0x33, 0xD4, 0x82, 0x58,
-    0xD0, 0x2A, 0xA4, 0x82, 0x52, 0x10, 0x0A, 0x3A, 0x41, 0x26, 0xA8, 0x04, 0x91, 0xA0, 0x11, 0x24,
-    0x82, 0x42, 0x10, 0x28, 0xF4, 0x0D, 0xA1, 0x7D, 0x4D, 0x96, 0x2B, 0x3A, 0x5D, 0x70, 0x76, 0x0A,
-    0x21, 0x74, 0x83, 0x07, 0xC6, 0x94, 0x3B, 0xD5, 0xE9, 0x8C, 0xDE, 0x20, 0x77, 0xE3, 0x92, 0xE0,
-    0x63, 0x0A, 0xD3, 0x79, 0xF0, 0xED, 0x43, 0x2A, 0x64, 0x0F, 0x76, 0xCE, 0xD4, 0x8C, 0x56, 0xB8,
-    0xFC, 0x78, 0x54, 0x02, 0x22, 0xD2, 0xD6, 0x80, 0x0A, 0x70, 0xD8, 0x21, 0x5C, 0xA8, 0x28, 0x92,
-    0xB4, 0x9E, 0xB4, 0x12, 0x6F, 0xDE, 0x65, 0xDF, 0x7F, 0xA9, 0x33, 0xD4, 0xAF, 0xC4, 0xAD, 0x25,
-    0xCB, 0x46, 0x94, 0x94, 0x94, 0x7A, 0x4F, 0x0D, 0x91, 0xED, 0x08, 0x54, 0x69, 0xCD, 0x5D, 0x62,
-    0x7B, 0x95, 0xD3, 0xA3, 0x45, 0xD6, 0x9D, 0xE5, 0x4B, 0x7D, 0xB4, 0x7E, 0xA5, 0x2C, 0x5A, 0x13,
-    0x08, 0x5C, 0x09, 0xA8, 0xAE, 0xF5, 0x57, 0xF9, 0x56, 0xDE, 0x7F, 0xDE, 0x54, 0xBF, 0xE9, 0xE5,
-    0x21, 0x5D, 0x80, 0x27, 0x34, 0xE4, 0x76, 0x46, 0xF2, 0x73, 0x95, 0x78, 0xB2, 0x01, 0x12, 0x65,
-    0xA2, 0xB9, 0x6A, 0xB1, 0x42, 0x3C, 0x3C, 0xC1, 0xD4, 0xDC, 0xB4, 0xC7, 0x0E, 0x04, 0xF0, 0xBB,
-    0x75, 0x28, 0x08, 0xD7, 0x9B, 0xD2, 0xF1, 0xB1, 0x50, 0x9B, 0xA3, 0xF6, 0xA7, 0xDD, 0x80, 0x88,
-    0x48, 0xB8, 0x22, 0x91, 0xAC, 0x66, 0x83, 0xC2, 0x5F, 0x81, 0x05, 0x94, 0xA5, 0x73, 0x60, 0xC4,
-    0xBC, 0x2A, 0x1A, 0x46, 0xAF, 0x0E, 0x0E, 0xAE, 0x00, 0xB6, 0xE1, 0x55, 0xBE, 0x38, 0x4D, 0x5F,
-    0x85, 0xF4, 0xA2, 0xCE, 0xBA, 0x3D, 0x43, 0x23, 0x1F, 0x65, 0x82, 0x74, 0x0C, 0xEA, 0xEC, 0xF1,
-    0xA1, 0x29, 0x5A, 0x27, 0x76, 0x90, 0x89, 0x54, 0x28, 0x08, 0xA8, 0x4E, 0x1D, 0x74, 0x3D, 0x90,
-    0x7B, 0x1F, 0x4D, 0x78, 0x52, 0x87, 0x47, 0x83, 0x46, 0x55, 0x90, 0x6B, 0xDC, 0x9E, 0xA2, 0x44,
-    0xD8, 0x86, 0x8D, 0x98, 0x66, 0xF8, 0x2C, 0x49, 0x89, 0x28, 0xBF, 0xB0, 0x50, 0x9E, 0x3D, 0xEB,
-    0xD2, 0x99, 0x7C, 0x74, 0x4D, 0xDD, 0x46, 0xD0, 0x74, 0x44, 0x42, 0x64, 0x05, 0x40, 0xE0, 0x2E,
-    0xE0, 0x00, 0x61, 0x01, 0x0C, 0x54, 0xEE, 0x4E, 0xA5, 0x05, 0x20, 0xA4, 0x76, 0x51, 0x0C, 0x54,
-    0x5C, 0x0E, 0x89, 0x41, 0x65, 0xAA, 0x12, 0x42, 0x65, 0x37, 0x79, 0x31, 0x29, 0xAD, 0x54, 0xA0,
-    0xB6, 0xEA, 0xCB, 0x4F, 0x72, 0x50, 0xB2, 0x83, 0xB5, 0xF4, 0x72, 0x93, 0xD2, 0xCE, 0x65, 0x20,
-    0x43, 0xAE, 0xEB, 0xE2, 0x0D, 0x80, 0x12, 0x9D, 0xF0, 0xAA, 0x00, 0x3B, 0x23, 0xE5, 0x6C, 0x33,
-    0xD1, 0xCE, 0xA7, 0x9D, 0xD0, 0x28, 0x96, 0xB2, 0x99, 0xA3, 0x1F, 0x19, 0xB5, 0x3E, 0x0E, 0x22,
-    0x80, 0x3E, 0xF0, 0xAD, 0x89, 0xE6, 0x78, 0x35, 0x1B, 0x4A, 0x57, 0x8F, 0x83, 0xDB, 0x42, 0xBC,
-    0x90, 0x1D, 0xAE, 0x22, 0xB2, 0x6A, 0xE9, 0x08, 0x3F, 0xF5, 0xE1, 0xEA, 0x99, 0x5D, 0x77, 0x2A,
-    0x42, 0x44, 0x8E, 0x32, 0x14, 0xCD, 0xDE, 0x76, 0x25, 0x83, 0x93, 0x22, 0xE2, 0x47, 0x00, 0x89,
-    0xA0, 0xCA, 0x11, 0x30, 0x54, 0x10, 0x1D, 0x8A, 0xE1, 0x2D, 0xF3, 0x06, 0xC0, 0x52, 0x01, 0x6C,
-    0xF0, 0xB0, 0x62, 0xDD, 0x39, 0x20, 0xDA, 0x1D, 0x13, 0x96, 0x17, 0x81, 0x27, 0x44, 0x1D, 0x13,
-    0xB6, 0x95, 0x57, 0x01, 0x25, 0xA3, 0x23, 0xCE, 0x87, 0xAF, 0xC3, 0xB0, 0xE3, 0x17, 0x98, 0x3A,
-    0x11, 0x52, 0x51, 0x60, 0x51, 0xFB, 0x86, 0x57, 0xA0, 0x31, 0xC0, 0x4E, 0xA7, 0x62, 0x0D, 0xB1,
-    0x35, 0xC4, 0x07, 0x55, 0x1B, 0x2D, 0xB0, 0xC2, 0xF1, 0x12, 0xDC, 0xB4, 0x25, 0xD0, 0xB2, 0x5C,
-    0x72, 0x71, 0x8E, 0xCA, 0x2D, 0x4C, 0x2C, 0x05, 0x3E, 0xE7, 0x3B, 0x89, 0xB6, 0x29, 0x5E, 0xA3,
-    0xF1, 0xFE, 0x31, 0xE9, 0xFE, 0x10, 0xBB, 0x8E, 0x1E, 0xD2, 0x2B, 0xCE, 0xA2, 0x4F, 0xD9, 0x68,
-    0xC5, 0xEE, 0xC8, 0x57, 0xFE, 0xB9, 0x56, 0xC3, 0x60, 0x8A, 0xDF, 0x90, 0x07, 0x5D, 0x31, 0x01,
-    0xA1, 0x84, 0xC6, 0x0B, 0x1B, 0x11, 0xAF, 0x24, 0x14, 0x88, 0x89, 0x85, 0x3A, 0x56, 0xD4, 0xA7,
-    0xBC, 0x85, 0x27, 0x8C, 0x95, 0x51, 0x7C, 0xB6, 0x5B, 0x23, 0x56, 0x57, 0x9E, 0xDF, 0x33, 0x2A,
-    0x0E, 0xF6, 0x9E, 0xDE, 0xA0, 0xD6, 0xC7, 0x1A, 0xB7, 0xDF, 0x64, 0xBE, 0xD6, 0xCC, 0x88, 0x7F,
-    0x42, 0x5B, 0xD2, 0x33, 0x75, 0x0E, 0x03, 0xC1, 0x26, 0x9C, 0x33, 0x7A, 0xA4, 0x04, 0xF2, 0x56,
-    0x7C, 0x17, 0xCF, 0x10, 0x56, 0x01, 0x43, 0x82, 0x26, 0x4E, 0x2F, 0x1B, 0x0E, 0x1A, 0x55, 0x2E,
-    0xAB, 0x8E, 0xBA, 0x74, 0xE1, 0x4E, 0xC5, 0x6B, 0xE1, 0xFD, 0xF8, 0xAF, 0xCD, 0x3E, 0x1A, 0x0B,
-    0x35, 0x16, 0xE2, 0xC3, 0x95, 0x9D, 0x2E, 0x1E, 0xBC, 0xF4, 0xF0, 0x50, 0xF0, 0x7D, 0x71, 0x30,
-    0xEA, 0x66, 0x1D, 0x1D, 0xF6, 0x0E, 0x6C, 0xD9, 0x12, 0xC9, 0x72, 0xF1, 0x08, 0x10, 0x14, 0x8A,
-    0xB4, 0x03, 0x4F, 0x32, 0x84, 0x38, 0x72, 0x05, 0x44, 0x8A, 0x44, 0xC6, 0xB5, 0x52, 0x86, 0x11,
-    0xAA, 0x2D, 0x0E, 0x88, 0xE6, 0x58, 0xE5, 0xF2, 0xEB, 0x3F, 0xE8, 0x29, 0xD1, 0x2D, 0xD1, 0x90,
-    0xE5, 0xEE, 0xBF, 0xF1, 0xC4, 0x00, 0x51, 0x04, 0xFB, 0xA4, 0xB1, 0xDC, 0x8D, 0x86, 0x74, 0xB0,
-    0x1D, 0x8F, 0x5E, 0x37, 0xE4, 0x81, 0x09, 0x54, 0xF1, 0x28, 0x87, 0x70, 0x99, 0xF2, 0xC6, 0x0F,
-    0x26, 0xD2, 0xD5, 0xF1, 0x2B, 0xC4, 0x7C, 0x52, 0xCB, 0x02, 0xB7, 0x6F, 0x9C, 0xED, 0x35, 0xF1,
-    0x7A, 0x72, 0xC2, 0x3B, 0x18, 0xBC, 0xD0, 0xD4, 0x62, 0x4F, 0x39, 0xF7, 0x64, 0xAD, 0xDD, 0xB9,
-    0xD1, 0x6F, 0x59, 0x88, 0x9D, 0x5C, 0xA8, 0x8D, 0x07, 0x47, 0x87, 0xE6, 0x59, 0x7E, 0x82, 0x06,
-    0xF1, 0x29, 0xC5, 0xE8, 0x31, 0x1E, 0x21, 0x61, 0x61, 0x38, 0x1F, 0xDC, 0xD5, 0x45, 0x12, 0x5C,
-    0xA8, 0x14, 0xD9, 0xFA, 0xFD, 0x43, 0x55, 0x5F, 0x55, 0xC2, 0x87, 0xE2, 0x30, 0x33, 0x17, 0xE9,
-    0x20, 0x4A, 0x05, 0x1F, 0x6E, 0x3E, 0xA4, 0x04, 0x0D, 0x21, 0x20, 0x5D, 0x01, 0x1C, 0xC3, 0x28,
-    0xD9, 0x7C, 0xBF, 0x59, 0x95, 0xCF, 0x22, 0x70, 0x69, 0x9B, 0xD1, 0x17, 0xF6, 0x2E, 0x3C, 0xCC,
-    0xB8, 0xDF, 0x6F, 0x96, 0xCF, 0x86, 0x5D, 0x84, 0x95, 0x22, 0x8B, 0x68, 0x7E, 0x16, 0x50, 0x08,
-    0x9E, 0x3A, 0xD3, 0x06, 0x4B, 0xD2, 0x40, 0x12, 0x3D, 0x1A, 0xB3, 0x90, 0x96, 0xBC, 0xB9, 0x17,
-    0x77, 0x0A, 0x1F, 0x1D, 0x98, 0xDC, 0xB4, 0x62, 0x35, 0x55, 0x41, 0x73, 0x44, 0x23, 0x8C, 0x3D,
-    0x44, 0xBC, 0xBB, 0xEA, 0xBC, 0x27, 0xD3, 0xD8, 0xEE, 0xA2, 0x9F, 0xF0, 0x04, 0xE2, 0x4F, 0x08,
-    0x55, 0xC7, 0xAD, 0x3D, 0xA9, 0x11, 0x98, 0x7A, 0x04, 0xF7, 0xD7, 0xBB, 0xBF, 0x7A, 0x00, 0xBD,
-    0x5A, 0xD5, 0x26, 0xB4, 0x1B, 0x7E, 0xFE, 0xAE, 0x93, 0x5B, 0xB4, 0x58, 0x0E, 0x3E, 0x98, 0x01,
-    0x98, 0x07, 0x8D, 0x73, 0x9D, 0xB9, 0x6A, 0x99, 0xCF, 0x18, 0x98, 0x02, 0x1A, 0x59, 0x7A, 0x93,
-    0x6B, 0x87, 0x4F, 0x05, 0x0D, 0xDF, 0x87, 0xBC, 0xA5, 0x43, 0xDC, 0x11, 0x31, 0x59, 0xB2, 0xA7,
-    0xB4, 0xC1, 0xD8, 0x00, 0xAE, 0x70, 0xF6, 0x71, 0x83, 0x3D, 0xCE, 0x4A, 0x62, 0xE5, 0x8C, 0x47,
-    0x2F, 0xFE, 0xFF, 0xF8, 0xFF, 0x85, 0xE2, 0x88, 0x52, 0x48, 0x8F, 0x92, 0xD5, 0x5B, 0x46, 0xC3,
-    0x0C, 0xC3, 0xE4, 0xE5, 0x29, 0x0A, 0x23, 0x06, 0x10, 0x4D, 0x0B, 0x99, 0x20, 0x81, 0x90, 0x08,
-    0x08, 0x04, 0xE4, 0x01, 0xF4, 0x41, 0x1A, 0x28, 0x0C, 0x90, 0x05, 0x90, 0x47, 0x49, 0x80, 0x20,
-    0x6C, 0x72, 0x10, 0xD6, 0xEA, 0x06, 0xF1, 0x5F, 0x34, 0x38, 0xEE, 0xC3, 0x8F, 0x86, 0x67, 0x63,
-    0x67, 0x09, 0xD9, 0xA7, 0x2D, 0x75, 0xB2, 0x7B, 0x21, 0x62, 0x36, 0xA8, 0x80, 0x3F, 0x4D, 0x92,
-    0x15, 0xCC, 0x88, 0x66, 0x38, 0x76, 0x4E, 0x10, 0x2A, 0x48, 0x38, 0xDD, 0x2A, 0xC4, 0x53, 0x75,
-    0x50, 0x01, 0xD5, 0x04, 0x49, 0x11, 0x55, 0x25, 0x54, 0x48, 0x35, 0x49, 0x56, 0x4C, 0x55, 0x0B,
-    0x15, 0xD4, 0x74, 0x73, 0x27, 0xC6, 0xA9, 0xA1, 0x17, 0xA4, 0x1B, 0xE6, 0xA0, 0x14, 0xEB, 0x92,
-    0xC3, 0x80, 0x23, 0x65, 0x2C, 0x40, 0x82, 0x8B, 0xD5, 0xB8, 0x01, 0xF3, 0x8C, 0x3F, 0xCF, 0x4F,
-    0xB4, 0x37, 0xAD, 0xB3, 0x66, 0x45, 0x9B, 0x61, 0xDD, 0x97, 0x7A, 0x75, 0x1D, 0x14, 0x30, 0x86,
-    0x75, 0x81, 0xBD, 0x7F, 0xE4, 0xD6, 0xA6, 0x3D, 0x4B, 0xD6, 0xF2, 0x65, 0xDA, 0x1E, 0xE7, 0x4D,
-    0xD4, 0xA0, 0x3D, 0xBF, 0x3A, 0xA6, 0x2A, 0xDE, 0x0C, 0x44, 0x4C, 0xA4, 0x01, 0x53, 0xC3, 0xDD,
-    0x65, 0xBF, 0x00, 0x95, 0xD1, 0x18, 0x4E, 0xCF, 0xBA, 0x43, 0x61, 0x2F, 0x5C, 0x7E, 0x48, 0x0B,
-    0x11, 0x30, 0x20, 0x70, 0x69, 0x6C, 0x66, 0x7F, 0x1A, 0x7C, 0x43, 0x96, 0xEF, 0x76, 0x71, 0x2F,
-    0x95, 0xDE, 0x87, 0x68, 0x8C, 0xA0, 0x10, 0xB5, 0x5D, 0x3D, 0x44, 0x8A, 0x25, 0xDF, 0x2D, 0x93,
-    0x45, 0xBE, 0x35, 0x49, 0xF0, 0x26, 0x2F, 0x6A, 0x84, 0x8A, 0x92, 0x6A, 0xC0, 0x57, 0x23, 0x10,
-    0xFE, 0xE9, 0x17, 0x10, 0x5D, 0x5A, 0x67, 0x64, 0x3C, 0xE6, 0x3D, 0x9F, 0x36, 0xF9, 0x2C, 0x63,
-    0xFB, 0x99, 0x76, 0x56, 0xB6, 0x62, 0xD8, 0xA1, 0x41, 0xDB, 0xDB, 0xB2, 0xA6, 0xD0, 0x76, 0xF7,
-    0x52, 0x6A, 0x92, 0xA9, 0x28, 0x85, 0x8C, 0x55, 0x3D, 0xEA, 0x80, 0x1C, 0x01, 0xF6, 0xBB, 0xC3,
-    0x66, 0x5E, 0xC1, 0x96, 0xC3, 0x01, 0x81, 0x40, 0x5A, 0x43, 0x1C, 0x5E, 0x86, 0x24, 0x89, 0x8D,
-    0x14, 0x80, 0x13, 0x51, 0x72, 0xA3, 0xB9, 0x32, 0x36, 0x44, 0x27, 0x0B, 0x1B, 0x48, 0x7F, 0xEC,
-    0x62, 0x37, 0xD5, 0x34, 0x88, 0xE0, 0x97, 0x02, 0x08, 0x84, 0x8F, 0x04, 0xC0, 0x5D, 0x6E, 0xEF,
-    0xA6, 0x3D, 0x6D, 0xA3, 0xB3, 0x9A, 0x1E, 0x4A, 0xC5, 0x32, 0x20, 0xB1, 0x02, 0x1E, 0x57, 0x31,
-    0x27, 0xE5, 0x33, 0x71, 0xE7, 0x26, 0x43, 0x90, 0x9C, 0x10, 0xC5, 0x1B, 0x5E, 0xD4, 0x8A, 0x8F,
-    0xCC, 0xDF, 0xC8, 0x83, 0x97, 0xBD, 0x52, 0x86, 0xB2, 0x47, 0xD3, 0x09, 0x17, 0x4E, 0xE3, 0xBD,
-    0x2F, 0x95, 0x9E, 0x3F, 0x21, 0x92, 0xF5, 0x15, 0xEF, 0x81, 0x4D, 0x4C, 0xCE, 0x3B, 0xC7, 0xA0,
-    0xC8, 0x7E, 0x74, 0x80, 0x00, 0xCA, 0x6E, 0xAA, 0x31, 0x6F, 0x1C, 0xCA, 0x34, 0x4A, 0x63, 0x9A,
-    0x73, 0xC6, 0xA3, 0x16, 0xCF, 0xE6, 0x51, 0x4D, 0xF3, 0xDD, 0x11, 0xEB, 0x3C, 0x68, 0x9D, 0x54,
-    0xA7, 0x3D, 0x42, 0xE4, 0xC5, 0x20, 0xF5, 0xEA, 0xB1, 0xD5, 0x9C, 0xF6, 0x7A, 0x82, 0x3E, 0xC7,
-    0x1D, 0x0C, 0x66, 0x56, 0x82, 0x9C, 0xBB, 0x01, 0x0B, 0x17, 0xF8, 0x4A, 0xEC, 0x4D, 0xA5, 0xEE,
-    0x08, 0xB9, 0xC5, 0xE3, 0x79, 0xA7, 0x07, 0x72, 0x47, 0x78, 0x9C, 0x69, 0xF4, 0xD4, 0x02, 0x74,
-    0xBA, 0x41, 0xFC, 0x7A, 0x85, 0x3C, 0x24, 0x26, 0x6A, 0x84, 0xFA, 0xAD, 0xFE, 0x11, 0x13, 0xBE,
-    0x82, 0x9F, 0x1F, 0x95, 0xCF, 0xC2, 0x0B, 0xB2, 0x42, 0x39, 0x51, 0x69, 0xF1, 0x03, 0x7C, 0x20,
-    0x1B, 0x94, 0x0B, 0xCA, 0x04, 0xF2, 0x40, 0x59, 0xA0, 0x1C, 0x20, 0x03, 0xBE, 0x4A, 0xFC, 0x15,
-    0x7E, 0x45, 0x9F, 0xE0, 0x2B, 0xF6, 0xBB, 0xC8, 0x7C, 0x76, 0xC0, 0x2B, 0xEE, 0x1E, 0x76, 0x73,
-    0xC3, 0xFB, 0x6B, 0x9A, 0x32, 0x06, 0x18, 0x7C, 0x58, 0x36, 0x5F, 0xBC, 0xDF, 0xBC, 0x5F, 0x54,
-    0x15, 0x88, 0x1C, 0x11, 0x2F, 0x4A, 0x79, 0x2C, 0xF5, 0xE0, 0x4D, 0x78, 0x1A, 0xC0, 0x1D, 0x20,
-    0x85, 0xA0, 0x12, 0x84, 0x53, 0x6C, 0x6B, 0x62, 0x1D, 0x38, 0xA7, 0x83, 0xEC, 0x01, 0xC2, 0xAB,
-    0x40, 0xD3, 0xDD, 0x88, 0xF8, 0x5F, 0x2D, 0xAB, 0x4E, 0x51, 0xCE, 0xD5, 0x40, 0xC9, 0x87, 0xCF,
-    0xDB, 0xEE, 0xD4, 0xA3, 0x15, 0xD7, 0x79, 0x67, 0x27, 0xAA, 0xFE, 0xC2, 0xE2, 0x80, 0xE6, 0x93,
-    0x07, 0x37, 0x3E, 0x91, 0xB1, 0x22, 0x0F, 0xD4, 0x56, 0x69, 0xED, 0x49, 0x4D, 0x95, 0xEA, 0xC2,
-    0x25, 0x55, 0x08, 0xB5, 0x53, 0xB1, 0x44, 0x8E, 0x76, 0x54, 0x33, 0xA5, 0x6C, 0x50, 0x2B, 0x95,
-    0xA2, 0xBC, 0x56, 0xAA, 0x91, 0xDA, 0xCB, 0x0A, 0x28, 0x79, 0xAB, 0x37, 0x51, 0x9E, 0x11, 0x07,
-    0x47, 0xCC, 0x03, 0x6A, 0xCF, 0x71, 0x92, 0x4E, 0x2A, 0x29, 0x48, 0xD9, 0xE4, 0x19, 0xA3, 0x35,
-    0x8F, 0xD3, 0x4A, 0x40, 0x86, 0x28, 0xBE, 0x34, 0x4D, 0x54, 0x01, 0x72, 0x84, 0x1A, 0x40, 0xC3,
-    0x44, 0x05, 0x50, 0xBB, 0x44, 0xF9, 0xCF, 0x5D, 0xB8, 0x38, 0x3B, 0x9E, 0xA8, 0xF4, 0xAB, 0x51,
-    0xA2, 0xF0, 0x0B, 0x53, 0x54, 0xF6, 0x79, 0x4F, 0xA3, 0x21, 0xDC, 0xBC, 0x2F, 0xF9, 0xBB, 0x0A,
-    0x8A, 0xF3, 0xA1, 0xCA, 0xA1, 0x8A, 0x08, 0xAD, 0x78, 0x2B, 0x1A, 0x83, 0x8B, 0x2A, 0x90, 0xB2,
-    0x9D, 0x70, 0x45, 0x50, 0x25, 0xBF, 0x24, 0xBC, 0xCA, 0x2E, 0xE5, 0xA5, 0x64, 0x9E, 0x09, 0xF2,
-    0x28, 0xBC, 0x94, 0xCD, 0x67, 0xA3, 0x4B, 0x4A, 0x45, 0x34, 0xE4, 0xA5, 0x24, 0xD1, 0xF2, 0x12,
-    0xD5, 0x27, 0x21, 0xE5, 0xBF, 0x8E, 0xB4, 0x8A, 0x8B, 0x02, 0x28, 0xDC, 0x8C, 0x5E, 0x63, 0xA6,
-    0x5D, 0xA9, 0x0A, 0x3D, 0x72, 0x31, 0xC8, 0xB1, 0xF0, 0x01, 0xD9, 0xD9, 0x62, 0x24, 0x83, 0x64,
-    0x6D, 0xF2, 0xDB, 0x6E, 0xC3, 0x44, 0xBA, 0x42, 0x52, 0xF6, 0x81, 0xA4, 0x7C, 0xD3, 0xB9, 0x88,
-    0x83, 0xA5, 0x1D, 0xBA, 0x88, 0x9A, 0xE9, 0xA6, 0x96, 0xCC, 0x08, 0xCE, 0xC2, 0x4A, 0x08, 0x1F,
-    0x2B, 0x01, 0xCD, 0x98, 0x23, 0xE9, 0x42, 0x05, 0x33, 0x6D, 0xD3, 0x3E, 0x98, 0x45, 0xA1, 0xF2,
-    0xBA, 0x68, 0xA3, 0x51, 0x68, 0xAA, 0x4C, 0x53, 0x27, 0x83, 0x10, 0x64, 0xC5, 0xBE, 0xE7, 0x7D,
-    0x3E, 0x22, 0x7D, 0x13, 0x8A, 0xAE, 0xFC, 0xFB, 0x41, 0xE9, 0x91, 0x80, 0x69, 0x92, 0x6D, 0x08,
-    0xF6, 0x45, 0xE7, 0x48, 0x16, 0x28, 0x84, 0xDD, 0xF9, 0x7A, 0xF2, 0x03, 0x71, 0x7A, 0xA0, 0x67,
-    0x20, 0x6D, 0x13, 0x69, 0x5E, 0x70, 0x87, 0x88, 0x84, 0xDC, 0x91, 0xA0, 0xC4, 0x72, 0xF4, 0xD7,
-    0x2A, 0x55, 0x42, 0x8F, 0x96, 0xD6, 0x8B, 0x2D, 0x09, 0xD7, 0x84, 0x1C, 0xA2, 0x27, 0x86, 0xBA,
-    0x45, 0x74, 0x25, 0x1F, 0x8B, 0x38, 0x8B, 0x13, 0xF5, 0x70, 0xD0, 0x05, 0x65, 0x6F, 0x95, 0x92,
-    0x5C, 0xCD, 0x1A, 0x35, 0xDA, 0x8F, 0x4A, 0x7D, 0x37, 0xFD, 0xEF, 0x05, 0x0B, 0x4F, 0x0C, 0x18,
-    0x62, 0xFB, 0xD5, 0x59, 0xF6, 0x98, 0xA2, 0x44, 0x3D, 0x07, 0x22, 0xF4, 0x6D, 0xDE, 0x85, 0x13,
-    0xCA, 0xEA, 0x65, 0xD5, 0xC6, 0x83, 0x38, 0xD6, 0x46, 0x0C, 0x60, 0x3A, 0x64, 0x63, 0xB8, 0x8A,
-    0x53, 0x90, 0x8C, 0x7D, 0x10, 0x53, 0xF8, 0x2D, 0x9A, 0x98, 0x3F, 0x49, 0x05, 0xC5, 0x57, 0x85,
-    0xBE, 0x8F, 0x65, 0xE3, 0xB9, 0xB0, 0xF9, 0x1D, 0x79, 0xF2, 0xAD, 0x3F, 0xBB, 0x44, 0x23, 0xB3,
-    0x5B, 0x1A, 0x72, 0x87, 0xAB, 0x4B, 0x74, 0x10, 0x83, 0x23, 0x40, 0x4B, 0x26, 0x67, 0xAD, 0xAC,
-    0x0B, 0xCC, 0x61, 0x76, 0x51, 0xA0, 0x8C, 0x66, 0x17, 0x11, 0x43, 0x7E, 0x11, 0xEE, 0xA2, 0xD2,
-    0x16, 0xCF, 0x4E, 0x51, 0xC9, 0xE7, 0x5E, 0x9D, 0xC9, 0x55, 0x0A, 0xE4, 0x2B, 0x49, 0x59, 0xFC,
-    0x4F, 0x97, 0xDF, 0x1D, 0xD2, 0x17, 0xA7, 0xE8, 0xBD, 0x33, 0x3E, 0xE6, 0x2F, 0x45, 0x22, 0x3A,
-    0x44, 0xA3, 0x60, 0xBE, 0x84, 0x05, 0xE2, 0xFD, 0x25, 0xBA, 0x8C, 0x07, 0x44, 0x09, 0x80, 0xA5,
-    0x42, 0xBC, 0x05, 0x09, 0x92, 0xA7, 0x22, 0x1A, 0xBC, 0xC9, 0xD0, 0xE5, 0xDA, 0x37, 0xD1, 0xD8,
-    0x58, 0xA0, 0x58, 0x5D, 0x6C, 0x1F, 0xBD, 0xF1, 0xC4, 0x46, 0xCB, 0xAF, 0x58, 0xEB, 0x77, 0xD1,
-    0x08, 0xDB, 0x34, 0x83, 0x23, 0x00, 0x11, 0x28, 0x49, 0x04, 0x79, 0xF4, 0x2D, 0x08, 0x16, 0x41,
-    0x23, 0x89, 0xCE, 0x06, 0x17, 0x81, 0x82, 0x48, 0xDA, 0x6C, 0x2C, 0x43, 0xCB, 0x00, 0x2A, 0x33,
-    0x9F, 0x9F, 0xFC, 0x85, 0x57, 0xD2, 0xEB, 0xCD, 0x2A, 0x3C, 0xFD, 0x40, 0x64, 0xE0, 0xFA, 0xD1,
-    0x59, 0x8B, 0x98, 0x1C, 0xB3, 0xFE, 0x20, 0xC4, 0x81, 0xD2, 0xBC, 0xA6, 0x90, 0x17, 0x08, 0xB5,
-    0x49, 0xB7, 0x48, 0x3A, 0xD4, 0x17, 0x11, 0x2B, 0xE3, 0x4C, 0xBA, 0x07, 0x25, 0xF6, 0x95, 0x9A,
-    0xE8, 0x4A, 0x12, 0x00, 0xA0, 0x2D, 0xF7, 0x05, 0x6E, 0x49, 0xA0, 0xE9, 0xEE, 0x45, 0x43, 0x00,
-    0xB5, 0xDC, 0x81, 0x64, 0x89, 0xBC, 0x22, 0x62, 0x86, 0x23, 0x66, 0xD7, 0x02, 0x3B, 0x0E, 0x64,
-    0x9F, 0xC2, 0x91, 0xE8, 0xB7, 0x25, 0x62, 0xCF, 0x1C, 0xBC, 0x12, 0x60, 0xC7, 0xAD, 0x30, 0x2D,
-    0x80, 0x1C, 0x6A, 0xE8, 0x8A, 0x12, 0xD4, 0x4C, 0x73, 0x78, 0x26, 0x39, 0x04, 0x01, 0xC2, 0x1D,
-    0x7C, 0x1F, 0x7B, 0x16, 0x0A, 0x40, 0x0F, 0xF2, 0x08, 0xC9, 0x76, 0x41, 0x42, 0x34, 0x69, 0x59,
-    0xAD, 0x51, 0x2C, 0x81, 0xB2, 0x48, 0x08, 0x76, 0x9A, 0x29, 0x71, 0x69, 0xA7, 0x2E, 0x85, 0x2D,
-    0x13, 0xF9, 0xFA, 0xE7, 0xF8, 0xDC, 0x1B, 0x7B, 0x25, 0xD0, 0x49, 0x51, 0x2D, 0xC6, 0x4B, 0x39,
-    0x09, 0x92, 0xC0, 0x48, 0x40, 0x81, 0x27, 0x80, 0x47, 0x60, 0x23, 0xB6, 0x0E, 0x2E, 0xB2, 0x40,
-    0x55, 0x13, 0x0E, 0x40, 0x05, 0x3C, 0x58, 0xC0, 0x5A, 0x95, 0x83, 0xB1, 0x2B, 0xB4, 0xFA, 0x62,
-    0x2B, 0xA4, 0x94, 0xEC, 0xFB, 0xA1, 0x10, 0x33, 0x8B, 0x35, 0x99, 0xA2, 0x31, 0x1A, 0x44, 0xC1,
-    0xFA, 0xB4, 0xCF, 0xBA, 0xBC, 0x2D, 0xE4, 0x7F, 0x4D, 0x2B, 0x7C, 0x48, 0xEF, 0x21, 0xE4, 0xC3,
-    0x12, 0x22, 0x03, 0x0A, 0xB2, 0xFC, 0x22, 0x1B, 0x96, 0x87, 0xA3, 0x1D, 0x36, 0xE2, 0x31, 0xA0,
-    0x03, 0x2A, 0x4D, 0xF0, 0x65, 0x17, 0x72, 0x93, 0xEC, 0x0B, 0x5E, 0x61, 0xC0, 0xD3, 0x23, 0xF0,
-    0x81, 0x80, 0xC0, 0x34, 0x94, 0x10, 0x2B, 0xB9, 0x4F, 0x28, 0x90, 0xFF, 0x0B, 0xF9, 0x09, 0xCB,
-    0x61, 0x11, 0x4C, 0x54, 0x09, 0x7E, 0x35, 0xAD, 0x33, 0xC3, 0x85, 0x37, 0x51, 0xB2, 0xFB, 0x2B,
-    0x8D, 0x4B, 0x87, 0xB4, 0x28, 0x41, 0x41, 0x4C, 0x4A, 0xF8, 0xCC, 0x88, 0xA1, 0x6E, 0xE0, 0xB3,
-    0x27, 0x8A, 0xB5, 0xAB, 0xA2, 0xE2, 0x1A, 0xDC, 0xD9, 0xD7, 0x3C, 0xB0, 0x83, 0xCE, 0x20, 0xE0,
-    0xAA, 0x11, 0x3B, 0x5C, 0xF1, 0xE4, 0x82, 0x9F, 0x6B, 0xE7, 0xDC, 0xF9, 0x0F, 0xC9, 0xE5, 0x85,
-    0xE6, 0x19, 0xD2, 0x51, 0x42, 0x88, 0x2B, 0x2A, 0xE9, 0x5D, 0x4A, 0xF2, 0x42, 0x49, 0x40, 0x57,
-    0x0B, 0x4B, 0x26, 0x3D, 0xDE, 0x14, 0x99, 0x96, 0x37, 0x45, 0x24, 0xE4, 0xCD, 0x1C, 0x21, 0x3A,
-    0xB8, 0x23, 0x0A, 0x20, 0x57, 0x59, 0x0C, 0x16, 0xB8, 0x86, 0x88, 0x57, 0xE5, 0xAE, 0x50, 0xBF,
-    0xEE, 0xC2, 0x0E, 0xA6, 0x0D, 0x2E, 0x16, 0x3E, 0xE3, 0x2B, 0xA8, 0x16, 0xA1, 0xC2, 0x50, 0xB9,
-    0xE2, 0x32, 0x4B, 0xFC, 0x33, 0x93, 0xAF, 0x86, 0xC2, 0x79, 0x71, 0x48, 0x35, 0xEC, 0x12, 0x4A,
-    0x6A, 0xF3, 0x16, 0x74, 0x2B, 0x9C, 0xA7, 0x3F, 0xA7, 0xBB, 0x4D, 0xDC, 0xE7, 0xF5, 0x2E, 0x73,
-    0x0D, 0x5D, 0xB5, 0x82, 0x9F, 0xC7, 0xFB, 0x9F, 0x6B, 0xD3, 0xC1, 0x7F, 0xDE, 0xEF, 0x7F, 0x0E,
-    0x13, 0xF3, 0x4F, 0x0D, 0xB3, 0x11, 0x26, 0xA9, 0xDA, 0x2C, 0x0E, 0x34, 0x79, 0x2A, 0x34, 0xC5,
-    0xB8, 0x73, 0x91, 0x07, 0x57, 0x1C, 0x6A, 0x4F, 0xAB, 0x66, 0xA3, 0x48, 0xA4, 0xF2, 0x3A, 0xE9,
-    0x2F, 0xA1, 0xF3, 0x3A, 0x37, 0xDB, 0xFA, 0x22, 0x35, 0x1D, 0xAA, 0x76, 0xC8, 0x98, 0x7A, 0x41,
-    0x8F, 0x9F, 0xE9, 0x63, 0x8D, 0x4E, 0x46, 0xDF, 0x66, 0x25, 0x7F, 0x58, 0xC8, 0x8F, 0xD7, 0x0B,
-    0xF8, 0x62, 0xB7, 0x60, 0x5C, 0x6D, 0x87, 0x42, 0x57, 0xED, 0x42, 0x69, 0x66, 0x18, 0xFA, 0x59,
-    0x70, 0x61, 0xC8, 0x18, 0x58, 0x58, 0xD4, 0x64, 0xA4, 0x15, 0x78, 0x0B, 0x6D, 0x81, 0x95, 0xEA,
-    0x3A, 0x92, 0xE8, 0x9F, 0xC0, 0x4F, 0x21, 0x1C, 0x30, 0xE9, 0x63, 0x9A, 0x63, 0xA4, 0x12, 0x91,
-    0xD5, 0x4D, 0xF5, 0x3E, 0x89, 0x8E, 0x88, 0x68, 0xC6, 0x6B, 0x03, 0x9D, 0x50, 0xCD, 0xC8, 0x3E,
-    0x64, 0x3B, 0xF1, 0x5D, 0xE4, 0xAF, 0x2B, 0xE4, 0x25, 0x1F, 0x51, 0x98, 0xB3, 0xAD, 0x26, 0x3F,
-    0x30, 0x4E, 0xE1, 0xA9, 0x00, 0xA4, 0xD9, 0x02, 0x10, 0xD7, 0x69, 0x88, 0x26, 0xD1, 0xE9, 0x4A,
-    0x14, 0x3E, 0x79, 0x8C, 0xAE, 0x13, 0x5B, 0x55, 0xA5, 0x30, 0x9B, 0x85, 0x43, 0xC3, 0xCE, 0x9E,
-    0x3C, 0x50, 0x94, 0xF5, 0x77, 0x28, 0x08, 0x14, 0x12, 0x0A, 0xFD, 0xDC, 0x4A, 0x08, 0x92, 0x9C,
-    0x0E, 0xAD, 0x9D, 0x2D, 0x63, 0x04, 0x38, 0xB8, 0x00, 0x9A, 0xB5, 0xCD, 0xD1, 0x95, 0x28, 0xF8,
-    0x02, 0xBE, 0xE5, 0xC4, 0x87, 0x70, 0x3F, 0x9F, 0xCD, 0xB7, 0x2B, 0x93, 0xFE, 0xA4, 0x35, 0xBF,
-    0x1B, 0x10, 0xF8, 0xC1, 0x78, 0x57, 0x3D, 0xE1, 0x65, 0x96, 0x51, 0x47, 0x1F, 0x4A, 0xC4, 0x95,
-    0x8F, 0x49, 0x47, 0x29, 0x83, 0xDB, 0x82, 0x29, 0x98, 0x5C, 0xA5, 0x61, 0x3D, 0x33, 0x76, 0x10,
-    0x79, 0xAF, 0x0E, 0x05, 0x80, 0xC6, 0xC0, 0x90, 0x9E, 0x8A, 0x01, 0xF8, 0xC1, 0x9E, 0x67, 0xA7,
-    0x40, 0x43, 0xC2, 0xF9, 0xC1, 0x63, 0xBB, 0x20, 0xD0, 0x41, 0x90, 0xF4, 0x36, 0x42, 0x20, 0xED,
-    0x9D, 0xF3, 0xE7, 0x4D, 0xED, 0x7C, 0x62, 0x0B, 0x00, 0xF4, 0x12, 0x3D, 0x0C, 0x7E, 0xA5, 0xDE,
-    0x22, 0xDA, 0x6B, 0x68, 0xF1, 0xF6, 0x56, 0xE1, 0x87, 0xFC, 0x55, 0x6E, 0x8F, 0xAB, 0x4A, 0x26,
-    0x3B, 0x65, 0xD3, 0x5E, 0x0F, 0x0C, 0xFF, 0xBD, 0xAF, 0x1C, 0xC8, 0xAD, 0x32, 0x40, 0x84, 0xE5,
-    0x6C, 0x0C, 0x73, 0x2A, 0x5C, 0xA9, 0x55, 0x65, 0x7D, 0x70, 0x03, 0x18, 0x4E, 0xC5, 0x31, 0xFC,
-    0x60, 0xB5, 0xF6, 0x05, 0x21, 0xE8, 0x2D, 0x84, 0x81, 0xA2, 0xA8, 0x53, 0xA1, 0xA6, 0xF4, 0xAC,
-    0x1D, 0x81, 0x50, 0xAE, 0x2A, 0xD6, 0x01, 0xBB, 0x9D, 0x48, 0x59, 0x3B, 0x4D, 0x23, 0xA0, 0x01,
-    0x57, 0x5F, 0x57, 0xB8, 0x6F, 0x29, 0x45, 0xBB, 0x36, 0xEF, 0x99, 0x5F, 0xE1, 0x4A, 0xB1, 0xDB,
-    0xD5, 0x79, 0x55, 0xF7, 0xEB, 0xA8, 0xBF, 0xC2, 0x73, 0x3D, 0x2C, 0x49, 0x24, 0x9A, 0x25, 0xF6,
-    0xC2, 0x2E, 0xEF, 0xF5, 0xD7, 0x29, 0x06, 0x90, 0x1D, 0x88, 0x0D, 0x8A, 0x21, 0x0B, 0x5B, 0x6F,
-    0xF4, 0xF1, 0xB3, 0xC7, 0x85, 0x5A, 0x8C, 0x47, 0x91, 0x66, 0x49, 0x5A, 0x07, 0x94, 0xB3, 0x24,
-    0x4C, 0x95, 0x07, 0x26, 0x93, 0x3C, 0xB1, 0x10, 0x7F, 0xE7, 0x5E, 0x5D, 0xB9, 0x4D, 0xA4, 0xF4,
-    0xCE, 0xD9, 0x99, 0x32, 0x7D, 0x25, 0xF8, 0x94, 0x28, 0x82, 0xB3, 0x5F, 0x97, 0xB8, 0x99, 0x01,
-    0x2D, 0x62, 0xDC, 0xF6, 0xA5, 0xC1, 0x46, 0x6D, 0x4A, 0xF0, 0x2B, 0xB1, 0x21, 0x69, 0x0F, 0xEE,
-    0xBC, 0x30, 0xA9, 0x72, 0x51, 0x9F, 0xC0, 0xDE, 0xD3, 0xAF, 0x74, 0x12, 0x64, 0x70, 0xDA, 0xC7,
-    0x57, 0xC9, 0xF6, 0x6A, 0xD9, 0x5E, 0x61, 0xED, 0xF5, 0x10, 0x6A, 0x02, 0x61, 0xB1, 0xDB, 0xB0,
-    0xCC, 0x39, 0xFA, 0x24, 0x09, 0x44, 0x3E, 0x20, 0xDE, 0x5B, 0xB2, 0x76, 0x71, 0xA7, 0x09, 0xD2,
-    0xC4, 0xA2, 0xBB, 0x76, 0xA8, 0x34, 0x4C, 0xCE, 0x78, 0x7F, 0x12, 0xFA, 0xA0, 0x4D, 0xE7, 0x64,
-    0xF6, 0x3D, 0x09, 0x41, 0xDF, 0x91, 0x95, 0x5F, 0x95, 0x67, 0xBD, 0x28, 0x01, 0xBB, 0x64, 0x40,
-    0x56, 0x9C, 0xE7, 0xF2, 0x09, 0x64, 0xF6, 0x5C, 0xE5, 0x74, 0xCB, 0x8C, 0xB6, 0x4F, 0x0B, 0x1F,
-    0x87, 0xA5, 0xC3, 0xA9, 0x3A, 0xC8, 0xCE, 0x6D, 0x89, 0x5A, 0x17, 0xCE, 0xC8, 0xD8, 0x17, 0x9D,
-    0x2E, 0xA6, 0x1F, 0x2E, 0xDE, 0xA6, 0xFA, 0xB2, 0x56, 0xEE, 0x2D, 0x91, 0x9A, 0x48, 0x1A, 0xE7,
-    0x75, 0x6B, 0x58, 0x7A, 0x5D, 0xB5, 0xDE, 0xA9, 0x64, 0xFE, 0xA6, 0x68, 0xDB, 0xCA, 0x66, 0xCA,
-    0xAA, 0x79, 0x33, 0xFA, 0xED, 0xD9, 0x35, 0xAD, 0xBF, 0xBD, 0xB0, 0x8F, 0x55, 0x34, 0x52, 0x4D,
-    0x98, 0x70, 0x53, 0xE5, 0x3A, 0x25, 0xF6, 0xC7, 0x3A, 0x20, 0x20, 0x1A, 0xE3, 0xEC, 0x47, 0xE2,
-    0x97, 0x0C, 0xB7, 0x32, 0x5C, 0xE3, 0x1F, 0x97, 0x7B, 0x03, 0x93, 0x3C, 0xF4, 0x37, 0x5D, 0xE2,
-    0xFA, 0xBE, 0xA8, 0x64, 0x28, 0x59, 0x91, 0x7E, 0x4D, 0xC7, 0x26, 0x9E, 0xFE, 0x5E, 0xD6, 0xEE,
-    0x01, 0xAF, 0xC5, 0x79, 0x93, 0xBD, 0x77, 0xA7, 0x26, 0x86, 0x8F, 0xCA, 0x83, 0x3B, 0x76, 0x3D,
-    0x46, 0x8E, 0x76, 0xA7, 0xE3, 0x90, 0x41, 0xB3, 0xCF, 0x0B, 0x30, 0x16, 0xB8, 0xB8, 0x7A, 0xDE,
-    0x70, 0x0A, 0x9B, 0xA4, 0xDD, 0xCD, 0xAD, 0x44, 0xC3, 0xEE, 0x89, 0x4F, 0x2D, 0xF3, 0x16, 0xAD,
-    0x0B, 0x1F, 0x93, 0x15, 0xA6, 0x3B, 0xB2, 0x2D, 0x83, 0xC8, 0x01, 0x7B, 0x6C, 0x16, 0x98, 0xB4,
-    0x42, 0x04, 0xB4, 0x45, 0xC3, 0x1B, 0x37, 0xD9, 0x59, 0x64, 0x3B, 0x5A, 0x2D, 0x1B, 0xC6, 0x37,
-    0xDF, 0x43, 0xAA, 0xFB, 0xE3, 0x09, 0x37, 0x7D, 0x60, 0x11, 0x69, 0xCE, 0xD5, 0xCF, 0xC4, 0x3B,
-    0x89, 0xF3, 0xC3, 0x4A, 0x2F, 0x58, 0xE4, 0x9B, 0x2D, 0x0B, 0x45, 0x43, 0x8E, 0xD6, 0xE9, 0x04,
-    0xBD, 0xCA, 0x97, 0x80, 0x5D, 0x38, 0xA4, 0xAC, 0xDC, 0x28, 0x2B, 0x83, 0x7E, 0xAF, 0x44, 0x68,
-    0xB9, 0xBC, 0xBC, 0xF3, 0x50, 0x1E, 0xC6, 0x8A, 0xAA, 0x28, 0x8D, 0x04, 0xB1, 0xEF, 0xC1, 0x98,
-    0x88, 0xE6, 0x14, 0x6D, 0xD2, 0x8B, 0x1E, 0x17, 0x92, 0x9D, 0xE3, 0x9F, 0x56, 0xFE, 0x59, 0xF1,
-    0xCF, 0x24, 0x3A, 0x57, 0x74, 0xFE, 0x1F, 0xD1, 0xB9, 0xB2, 0x18, 0xBC, 0x18, 0x70, 0x5A, 0x09,
-    0x00, 0x88, 0x51, 0xCB, 0x50, 0x70, 0x07, 0x0C, 0x31, 0x01, 0x08, 0xED, 0xC8, 0x28, 0x7A, 0xC5,
-    0x4D, 0x95, 0x78, 0x70, 0x54, 0xB2, 0x06, 0x71, 0x58, 0xE9, 0xE3, 0x59, 0xCC, 0x40, 0xBC, 0x34,
-    0x5F, 0x83, 0xB5, 0xCC, 0x7F, 0x81, 0x9B, 0xDE, 0x9D, 0xE1, 0x2D, 0x3F, 0xB0, 0xE2, 0xBA, 0x8A,
-    0x09, 0xBE, 0x3E, 0x15, 0xEF, 0x25, 0x59, 0xB1, 0xD5, 0x96, 0x4A, 0xDB, 0x20, 0xE0, 0xEE, 0x69,
-    0x62, 0x47, 0x4C, 0x52, 0x49, 0xF4, 0x69, 0x77, 0xB2, 0xA5, 0xB3, 0x36, 0x9A, 0xBB, 0x6B, 0xAD,
-    0xCB, 0x8F, 0x39, 0x94, 0xBB, 0x31, 0x07, 0x57, 0x62, 0xE7, 0xB7, 0xAE, 0xDF, 0x3A, 0x8D, 0x46,
-    0xAE, 0xB5, 0xA8, 0x51, 0x56, 0xAA, 0x6A, 0x82, 0x61, 0xC5, 0x2D, 0x66, 0x1D, 0x67, 0xC0, 0xAA,
-    0x12, 0x58, 0xC4, 0x78, 0xAF, 0xA9, 0xB3, 0x21, 0x15, 0xB2, 0x08, 0x45, 0x2E, 0xD9, 0xBC, 0x3C,
-    0x47, 0xAB, 0xD6, 0x3A, 0x33, 0x81, 0x8D, 0xB0, 0x1E, 0xE5, 0x53, 0x4F, 0xEE, 0x03, 0xCF, 0x44,
-    0xF9, 0x30, 0x70, 0xE5, 0xE8, 0x6B, 0x68, 0x7C, 0x88, 0x0D, 0xE1, 0x88, 0x58, 0xFA, 0xB1, 0x56,
-    0xF1, 0xAC, 0x5A, 0x81, 0x7A, 0x57, 0x6B, 0x35, 0x7F, 0xF7, 0xB4, 0x42, 0x1D, 0x4C, 0x8D, 0xA6,
-    0x32, 0x0A, 0xBF, 0x4A, 0x1E, 0xD4, 0x1E, 0xB9, 0xA9, 0xED, 0x60, 0x43, 0x15, 0x7F, 0x15, 0x3D,
-    0xD1, 0x0A, 0xB0, 0xA4, 0x78, 0x30, 0x20, 0xEF, 0x24, 0x03, 0x9C, 0xEC, 0xA5, 0x73, 0xF5, 0x13,
-    0x94, 0xCD, 0xDE, 0x5D, 0xC0, 0x51, 0x72, 0x40, 0x85, 0x4F, 0xC2, 0x1F, 0xC4, 0xB2, 0xA9, 0x84,
-    0x7C, 0x93, 0x67, 0x81, 0x4A, 0x9F, 0x3C, 0x2C, 0xA5, 0x62, 0x3E, 0x57, 0x87, 0x70, 0xA0, 0x2D,
-    0x34, 0xAD, 0x78, 0xD0, 0x6F, 0xFA, 0xA5, 0xC0, 0xA8, 0xED, 0x3F, 0x7E, 0x0A, 0x25, 0xD9, 0xBF,
-    0x68, 0x20, 0x38, 0x6F, 0x81, 0x20, 0xDB, 0x5A, 0x82, 0x77, 0x0D, 0xDD, 0xBD, 0x8B, 0xA4, 0x15,
-    0xBA, 0xDE, 0x20, 0x53, 0x91, 0x37, 0x30, 0x18, 0xD1, 0x47, 0x4C, 0xB8, 0x33, 0xA6, 0x6D, 0x0D,
-    0xE6, 0x0E, 0x10, 0x2C, 0x34, 0x6D, 0x86, 0x3A, 0xBB, 0x3E, 0xFD, 0xBA, 0x33, 0x97, 0xDE, 0xEE,
-    0xE6, 0xCE, 0x36, 0x67, 0xEE, 0xDF, 0xD4, 0xA9, 0x76, 0x3A, 0x9B, 0xDF, 0xE3, 0x87, 0xA2, 0x63,
-    0xFC, 0xBE, 0xC9, 0x44, 0x15, 0x38, 0xDD, 0xBC, 0x51, 0xB5, 0x52, 0xEB, 0x73, 0xD7, 0x25, 0x74,
-    0x85, 0xF6, 0x91, 0x74, 0xB4, 0x85, 0x4A, 0xA6, 0xC5, 0x72, 0x35, 0x50, 0x54, 0x32, 0xAD, 0x07,
-    0x72, 0x69, 0xCA, 0x99, 0x62, 0x99, 0x8D, 0x5A, 0xE6, 0xFD, 0xCC, 0x68, 0x1E, 0x95, 0xEE, 0xA0,
-    0xD2, 0xD9, 0x46, 0x8E, 0xB9, 0xD9, 0xBD, 0x11, 0x26, 0xF3, 0x7F, 0xAB, 0x60, 0xE9, 0xAC, 0xFD,
-    0xC1, 0x98, 0xE9, 0xC1, 0xAC, 0x95, 0x10, 0xA8, 0xD2, 0xC9, 0xB2, 0xE1, 0x9E, 0xB3, 0x69, 0xF1,
-    0xC5, 0x93, 0xEF, 0x1F, 0x3E, 0xB1, 0xB6, 0x3D, 0xE9, 0x7C, 0x89, 0xCE, 0x00, 0xB3, 0xE7, 0xF9,
-    0x6F, 0xF2, 0x42, 0x44, 0x59, 0xF4, 0x35, 0xC1, 0xA4, 0x0B, 0xD3, 0xA6, 0xAA, 0x83, 0xEA, 0xA6,
-    0x23, 0x7A, 0x50, 0xE0, 0x06, 0xE2, 0xBC, 0x12, 0x01, 0x48, 0xD5, 0x66, 0xAC, 0x68, 0x68, 0x29,
-    0x84, 0x65, 0x8B, 0x05, 0x4A, 0x88, 0x99, 0x5D, 0x68, 0x58, 0x9D, 0xDA, 0xE3, 0x97, 0x6C, 0xC7,
-    0xF2, 0x2B, 0xBB, 0xD7, 0x42, 0x74, 0xBE, 0xCD, 0xAA, 0x4E, 0x6E, 0xE2, 0x01, 0x35, 0xF6, 0x33,
-    0x3A, 0x11, 0x7C, 0x13, 0x85, 0x04, 0xCB, 0xE6, 0xC0, 0x6A, 0xAE, 0x9E, 0x7C, 0xEF, 0x42, 0x32,
-    0xAE, 0xAC, 0xEC, 0x89, 0xD5, 0x5A, 0x9E, 0xB6, 0xDF, 0x11, 0xB6, 0x8F, 0x02, 0x21, 0x8C, 0xB6,
-    0xFC, 0x93, 0xB7, 0x62, 0x3A, 0x64, 0x23, 0x75, 0x3C, 0xD1, 0x84, 0xC7, 0xB3, 0x04, 0x9C, 0x1C,
-    0xD3, 0x29, 0x74, 0xCC, 0x78, 0xD6, 0x2F, 0x9F, 0xCE, 0xD8, 0x39, 0x0A, 0xE1, 0x66, 0x21, 0xDC,
-    0x8C, 0xAF, 0x4E, 0x43, 0x5C, 0x3A, 0x0E, 0x71, 0x73, 0x35, 0xBE, 0x6D, 0xA7, 0x3D, 0xCD, 0xC8,
-    0xFE, 0xBA, 0x81, 0xDA, 0xD5, 0xF1, 0xCA, 0x72, 0x5B, 0xD3, 0xC2, 0x94, 0x65, 0xAC, 0xAE, 0x0B,
-    0x3E, 0x15, 0x6B, 0x56, 0x39, 0xC7, 0x96, 0x58, 0x3F, 0x1A, 0x74, 0x28, 0xDA, 0x55, 0x7D, 0x76,
-    0xE8, 0x8A, 0x4D, 0x81, 0x52, 0xF7, 0x91, 0xBD, 0xF7, 0x05, 0x37, 0xEE, 0x3A, 0xB3, 0x78, 0xAB,
-    0x73, 0x44, 0x6C, 0xF8, 0xBB, 0x69, 0xAD, 0x85, 0xCD, 0xA2, 0x7B, 0x67, 0xB7, 0xC6, 0x81, 0x65,
-    0x02, 0xED, 0xDA, 0x8C, 0xE8, 0x4D, 0xBD, 0x7E, 0x81, 0x1C, 0x70, 0xF2, 0x6B, 0x72, 0xBD, 0x17,
-    0x00, 0x09, 0x36, 0x23, 0xA0, 0x68, 0x10, 0x07, 0x36, 0x86, 0x48, 0xA6, 0x3D, 0xEA, 0xBA, 0x5D,
-    0x84, 0x22, 0x7C, 0x36, 0x2B, 0x94, 0x6C, 0x8E, 0xA5, 0xDA, 0x30, 0x5E, 0x77, 0xD5, 0x8F, 0x6B,
-    0xEC, 0x1D, 0x05, 0x2C, 0xE3, 0xE3, 0x3F, 0x15, 0x13, 0x92, 0x8E, 0xFA, 0x7C, 0xF9, 0x44, 0x81,
-    0x74, 0xDD, 0x06, 0x9D, 0x1E, 0x71, 0x68, 0x3A, 0x99, 0x84, 0x82, 0x43, 0xD8, 0x2A, 0xD6, 0xB0,
-    0x1C, 0xA0, 0x4E, 0x2C, 0x9D, 0xF8, 0xA1, 0x14, 0x12, 0xCF, 0xFE, 0xC1, 0xAE, 0x48, 0xC7, 0x7F,
-    0x46, 0x9A, 0x38, 0xD4, 0xA6, 0x08, 0xAB, 0x51, 0xE1, 0xF4, 0xA1, 0x5E, 0x6A, 0xB7, 0xD9, 0xBE,
-    0xD5, 0x78, 0xF9, 0x34, 0x9C, 0x15, 0x45, 0xB3, 0xE9, 0xE1, 0xFE, 0x3E, 0x6F, 0x40, 0xE5, 0x30,
-    0xDA, 0x85, 0xF4, 0x03, 0xE4, 0x89, 0x2E, 0x83, 0xAC, 0x8B, 0x6A, 0x0C, 0x8A, 0xAE, 0x36, 0x2C,
-    0x55, 0xD5, 0x8A, 0xBE, 0x6A, 0x15, 0x60, 0xCC, 0x9F, 0x63, 0x2F, 0x00, 0x39, 0x9A, 0x18, 0x3B,
-    0x01, 0x63, 0x31, 0x02, 0xAC, 0x8C, 0x06, 0x3A, 0xA1, 0xBA, 0xEC, 0x8D, 0x79, 0x9D, 0x6D, 0x7D,
-    0x0A, 0x62, 0xD7, 0x8E, 0x4E, 0x6E, 0x69, 0x8F, 0xD6, 0xEF, 0x5F, 0x45, 0xFB, 0xD1, 0x4D, 0xA5,
-    0x6B, 0x45, 0x77, 0x43, 0x59, 0x43, 0x93, 0x8F, 0x4D, 0x36, 0xAE, 0x81, 0x84, 0x84, 0x8B, 0xF8,
-    0xA5, 0xBE, 0xC1, 0x57, 0xAD, 0x3F, 0xA2, 0x31, 0x0D, 0x75, 0x16, 0xC9, 0x35, 0x37, 0x13, 0x3F,
-    0xA2, 0x23, 0x86, 0x33, 0x20, 0x22, 0x44, 0xCC, 0x68, 0x59, 0xB6, 0xD0, 0xB1, 0xF8, 0xF7, 0xEF,
-    0x68, 0x5F, 0x0A, 0x1B, 0x38, 0x79, 0x43, 0xC7, 0xF9, 0xB1, 0x95, 0x50, 0x7F, 0x71, 0x5D, 0x78,
-    0x3F, 0x70, 0xAB, 0xDD, 0xEE, 0xC6, 0x3A, 0xA0, 0xF7, 0xD0, 0x42, 0xC4, 0x5C, 0xD8, 0xDF, 0xCA,
-    0xE7, 0x48, 0xD8, 0x1F, 0x2D, 0x00, 0x6C, 0x35, 0x13, 0x10, 0xEB, 0x5E, 0x1A, 0x04, 0x32, 0xAC,
-    0xD1, 0x90, 0xD2, 0x88, 0xCD, 0x87, 0x59, 0x50, 0xC3, 0x38, 0x83, 0xC0, 0xC6, 0x82, 0x22, 0x3A,
-    0x58, 0x9F, 0xC3, 0x77, 0x3F, 0xBA, 0xD2, 0xA7, 0x8A, 0x4B, 0xA1, 0x9D, 0x91, 0xC2, 0xFE, 0x82,
-    0x13, 0xEA, 0x53, 0xD0, 0xEC, 0x18, 0xCA, 0x80, 0x91, 0x69, 0x20, 0x47, 0x58, 0x2A, 0x73, 0x2E,
-    0x62, 0xB4, 0x2B, 0xAA, 0x26, 0x4A, 0x81, 0xD8, 0xAE, 0x01, 0x05, 0x43, 0x5C, 0xC8, 0xBE, 0x14,
-    0xCE, 0x38, 0x6F, 0x91, 0x8F, 0xB6, 0x39, 0x07, 0x65, 0x78, 0x3E, 0xA1, 0x34, 0xFE, 0x4C, 0x03,
-    0x0A, 0x2E, 0xB0, 0xF8, 0xA2, 0xD6, 0xB8, 0xD4, 0x62, 0x58, 0x31, 0xAB, 0x20, 0xA6, 0x21, 0x13,
-    0x93, 0xDE, 0xE6, 0xB3, 0x5C, 0x8A, 0x39, 0x3E, 0x55, 0xBC, 0xCE, 0xDD, 0x40, 0x76, 0xBB, 0x0D,
-    0x64, 0xBB, 0x49, 0xC8, 0x4C, 0xD8, 0xD2, 0xC0, 0xA4, 0xDE, 0x2F, 0x21, 0xCD, 0x22, 0x49, 0xA1,
-    0x2B, 0x5D, 0x57, 0x35, 0x5B, 0x03, 0x80, 0x00, 0xF2, 0x65, 0xD5, 0x51, 0x34, 0x62, 0x87, 0xEF,
-    0xEC, 0x15, 0x35, 0xC8, 0x2B, 0x56, 0xBC, 0x38, 0xEA, 0xDA, 0x74, 0xBE, 0xD2, 0xC7, 0x81, 0x93,
-    0xD5, 0xFB, 0xFF, 0x83, 0x0B, 0x0C, 0xEE, 0xA7, 0x8E, 0x02, 0xF8, 0x88, 0x49, 0x5D, 0x6C, 0xD7,
-    0x17, 0x09, 0x7A, 0x52, 0x06, 0xE9, 0xDF, 0xEB, 0x9E, 0xA7, 0xBF, 0x14, 0x05, 0xB4, 0x5D, 0xC8,
-    0xF6, 0xDE, 0x1B, 0x10, 0x5F, 0x48, 0x6E, 0xA2, 0x95, 0x0A, 0x28, 0x14, 0xCA, 0x2A, 0x12, 0x3C,
-    0x04, 0x0E, 0x14, 0x3A, 0xA7, 0xD6, 0x5C, 0x65, 0x20, 0xF2, 0x5C, 0xC9, 0x90, 0xAD, 0x46, 0x55,
-    0xB7, 0xF8, 0xD9, 0xB0, 0xA5, 0x98, 0x9A, 0xCA, 0x2D, 0x97, 0x87, 0x6C, 0x29, 0x0D, 0xAE, 0x8F,
-    0xD3, 0x50, 0xE2, 0x6F, 0x51, 0x11, 0x69, 0x90, 0x73, 0xD0, 0x74, 0x2A, 0x28, 0x3E, 0x4E, 0x0B,
-    0xAD, 0x9F, 0xB6, 0x24, 0x2E, 0xD1, 0xDE, 0xE0, 0x65, 0x33, 0x16, 0xAD, 0x42, 0x23, 0xDB, 0x83,
-    0x01, 0x6B, 0xFA, 0x14, 0x3E, 0xB2, 0x14, 0x9D, 0x25, 0x3A, 0xC2, 0xC6, 0x14, 0xE0, 0xB5, 0x5B,
-    0x16, 0x2B, 0x26, 0x36, 0x28, 0xC3, 0x59, 0x72, 0x9C, 0xF4, 0xE3, 0x55, 0xE3, 0x01, 0x96, 0x29,
-    0x99, 0x71, 0x7F, 0x7B, 0x7F, 0x9B, 0x6B, 0x55, 0x52, 0x6A, 0x42, 0x8E, 0xDB, 0xAE, 0xB7, 0xB5,
-    0x58, 0xAC, 0x53, 0xF8, 0xBE, 0x6F, 0xB4, 0xB5, 0x95, 0x3A, 0x57, 0xFE, 0xB5, 0x2E, 0xCE, 0x60,
-    0x17, 0xF4, 0xFA, 0xA9, 0xA4, 0xAF, 0xD8, 0x86, 0xBD, 0xB4, 0xE0, 0xDA, 0xEE, 0x82, 0xF4, 0xAD,
-    0x24, 0xD0, 0x3C, 0x74, 0xD3, 0x66, 0xCE, 0x3F, 0xFC, 0x66, 0x50, 0xD9, 0x8A, 0xD6, 0x6D, 0x38,
-    0x8D, 0xB5, 0xEC, 0x7C, 0xD9, 0x22, 0x26, 0x3F, 0x6B, 0xD1, 0xC1, 0x96, 0xE9, 0x6C, 0x4B, 0xBD,
-    0x8D, 0xA7, 0xCF, 0x66, 0x44, 0x3C, 0x62, 0xEF, 0x49, 0xEC, 0xC5, 0x5E, 0x2E, 0x2F, 0x3A, 0x41,
-    0xEC, 0xFD, 0xDE, 0xE5, 0x95, 0xBC, 0x50, 0xEE, 0xC8, 0xE0, 0x3B, 0xBF, 0xF7, 0x1F, 0xE6, 0x15,
-    0x83, 0x29, 0x1C, 0xB6, 0xE9, 0x38, 0x1A, 0x9D, 0xDA, 0x4E, 0x8F, 0x6D, 0x24, 0x1C, 0xA1, 0x8C,
-    0xBA, 0x6C, 0x02, 0x4F, 0x30, 0x8D, 0x27, 0x26, 0xB5, 0xBC, 0xB2, 0x73, 0xAA, 0xF9, 0x2E, 0xD5,
-    0xD6, 0xF1, 0xF1, 0x8A, 0xA3, 0xF6, 0x13, 0x1A, 0x37, 0x45, 0x7D, 0x61, 0xE1, 0xF0, 0x2A, 0xBE,
-    0x4D, 0x4B, 0xAA, 0x31, 0x47, 0x64, 0x1F, 0xCD, 0xBE, 0x4A, 0xA1, 0xD3, 0x20, 0x7B, 0x33, 0x6A,
-    0x8D, 0x96, 0xA1, 0x2D, 0x27, 0x2A, 0xED, 0x7E, 0x7F, 0x64, 0xA0, 0x07, 0xEA, 0xB7, 0x61, 0x74,
-    0x91, 0x94, 0xA8, 0x83, 0x0E, 0x14, 0x0F, 0x63, 0x8D, 0xAE, 0x56, 0x5A, 0xDD, 0x1E, 0x92, 0xB5,
-    0x9C, 0xF1, 0x56, 0x6F, 0xFA, 0x8C, 0x1F, 0xC3, 0x0A, 0x21, 0x6B, 0xC0, 0x38, 0x62, 0xB3, 0xEC,
-    0x1A, 0x69, 0x24, 0xE8, 0xD8, 0xF0, 0xEC, 0x46, 0xFA, 0xFE, 0x3F, 0x18, 0x62, 0x04, 0x28, 0x75,
-    0x04, 0x3D, 0xB5, 0xB5, 0xC2, 0xE4, 0x8E, 0xED, 0x34, 0x1C, 0x43, 0x30, 0x40, 0x8A, 0x9D, 0x5F,
-    0xCE, 0xC9, 0x66, 0x60, 0xDC, 0x1E, 0x58, 0x9F, 0x96, 0x08, 0x70, 0x22, 0x46, 0xBC, 0xC8, 0x3D,
-    0x57, 0xAC, 0x60, 0xA5, 0x38, 0xF8, 0xD7, 0x7A, 0x1B, 0x92, 0x00, 0x6A, 0x57, 0xCB, 0xDF, 0x53,
-    0x12, 0x30, 0xD0, 0x25, 0x4F, 0xE8, 0x9F, 0xB7, 0x30, 0x5A, 0xF7, 0x58, 0x15, 0xE1, 0x59, 0x06,
-    0xC1, 0xE5, 0xF3, 0xA3, 0xD6, 0x4E, 0x11, 0xD3, 0xFC, 0xBD, 0x6F, 0x48, 0xDE, 0x40, 0x2A, 0xCB,
-    0x3A, 0x8C, 0xD5, 0x83, 0x70, 0x3A, 0x23, 0x37, 0xEF, 0x6A, 0x61, 0xF1, 0xC5, 0x05, 0x66, 0xC2,
-    0xE5, 0x8E, 0x0F, 0xB8, 0x00, 0x04, 0xA2, 0x12, 0xEF, 0x0D, 0xEF, 0x67, 0xFB, 0x93, 0x88, 0x8B,
-    0xD9, 0x3A, 0x06, 0x3A, 0x7D, 0xA4, 0xC2, 0xE2, 0x70, 0x0B, 0x9A, 0x75, 0xFF, 0x00, 0x83, 0x51,
-    0xE8, 0x22, 0x7B, 0x5C, 0xF9, 0x11, 0xFC, 0x62, 0x6F, 0x04, 0xDF, 0x85, 0xDF, 0x3C, 0x3B, 0xA0,
-    0x47, 0x07, 0x38, 0xE8, 0xC1, 0x83, 0x03, 0x7C, 0x34, 0xDD, 0xCF, 0xE9, 0x53, 0x03, 0x00, 0x92,
-    0x48, 0x12, 0x4A, 0x62, 0x49, 0x30, 0xB5, 0x37, 0xA6, 0x5F, 0xD5, 0x6E, 0xD1, 0xE0, 0xEB, 0x97,
-    0xE8, 0x16, 0x42, 0x66, 0x52, 0x37, 0x4E, 0xCA, 0x71, 0xA6, 0x72, 0x4F, 0x68, 0x0E, 0x8E, 0xE4,
-    0x07, 0x5B, 0x5A, 0x19, 0xE4, 0xE2, 0x32, 0x57, 0x1A, 0x41, 0xAC, 0x9E, 0xB5, 0x54, 0x18, 0x1D,
-    0x44, 0x9A, 0x7C, 0x09, 0x95, 0x51, 0x8D, 0x4E, 0xC3, 0xF4, 0xBE, 0x09, 0xC6, 0x8C, 0xD7, 0xB6,
-    0xAE, 0x8A, 0x10, 0xEA, 0xA1, 0x18, 0x5F, 0x0B, 0xA1, 0xFA, 0x06, 0xBD, 0x2F, 0x6D, 0x71, 0xB9,
-    0xCF, 0xC1, 0x66, 0x3E, 0x37, 0xFB, 0xCA, 0x5D, 0xB1, 0x75, 0x40, 0xC4, 0xF6, 0x07, 0xDA, 0xB4,
-    0x06, 0x5F, 0x2B, 0xEA, 0xA3, 0x6C, 0x0D, 0x54, 0xB0, 0x99, 0x5D, 0x53, 0x4B, 0x1A, 0x15, 0x0C,
-    0xD7, 0x10, 0x67, 0x9C, 0xDE, 0xC6, 0xFA, 0x4F, 0x52, 0xB3, 0x68, 0x27, 0xCB, 0x86, 0x77, 0x4A,
-    0x78, 0xDD, 0x64, 0x33, 0xA7, 0xCC, 0xF8, 0x8C, 0xCD, 0x7A, 0x67, 0x4C, 0xF2, 0xAD, 0xAA, 0x9C,
-    0x9C, 0x1B, 0x58, 0xFD, 0x74, 0xD1, 0xD9, 0x3A, 0x6B, 0x8B, 0x6F, 0xB4, 0x81, 0xD8, 0x6F, 0x44,
-    0x92, 0x31, 0x0F, 0xE2, 0x36, 0xD2, 0xE1, 0xEA, 0x2D, 0x77, 0x2C, 0x45, 0xB3, 0xA5, 0x56, 0xC5,
-    0xD0, 0x1D, 0x44, 0xF0, 0x75, 0xCA, 0x60, 0xF1, 0xF5, 0x61, 0xEA, 0x44, 0xB4, 0x3B, 0xD1, 0x62,
-    0x87, 0x73, 0x97, 0xCB, 0x09, 0x8C, 0x2E, 0x21, 0x30, 0xB7, 0xFE, 0xC8, 0x61, 0xE1, 0x02, 0x6B,
-    0x4F, 0xA0, 0x7D, 0x26, 0x02, 0x8D, 0xF9, 0xD3, 0xB3, 0xFD, 0x0C, 0x90, 0x22, 0x8B, 0xE9, 0xE4,
-    0x0E, 0x67, 0x88, 0x84, 0xAE, 0x99, 0xCB, 0xEF, 0x77, 0x39, 0x2C, 0x79, 0x9C, 0xF2, 0xC9, 0x3C,
-    0x98, 0xAA, 0x9E, 0xF1, 0x1D, 0xDA, 0xC7, 0x5F, 0x62, 0x07, 0x0F, 0xF9, 0xF4, 0x81, 0x89, 0xCC,
-    0xAD, 0x3F, 0x7F, 0x5A, 0xF5, 0x04, 0x23, 0x48, 0xB3, 0x9B, 0xB9, 0x11, 0x5E, 0xC9, 0x2F, 0x22,
-    0x27, 0x98, 0x6A, 0xEA, 0xF1, 0x0B, 0x42, 0x29, 0xCE, 0x36, 0xE1, 0xFF, 0x35, 0x87, 0x5D, 0xD1,
-    0x6F, 0x0F, 0x11, 0x53, 0x95, 0xE8, 0xC0, 0x5B, 0x97, 0xF8, 0x20, 0xEF, 0xE1, 0xD0, 0x94, 0x1E,
-    0x00, 0xCD, 0xA1, 0x6C, 0x0F, 0x34, 0x4B, 0xD3, 0x83, 0x0A, 0x2E, 0xDD, 0xD1, 0xA9, 0xCB, 0xAD,
-    0x97, 0x7B, 0xEA, 0xE7, 0xE5, 0x54, 0x30, 0x7C, 0x07, 0xAC, 0x1C, 0x4C, 0x26, 0x86, 0x2E, 0x7E,
-    0xFB, 0xFC, 0x6C, 0x43, 0x80, 0xEC, 0xFA, 0xAE, 0x08, 0x40, 0x51, 0xC6, 0x63, 0xDA, 0x89, 0xC9,
-    0x93, 0x4D, 0xE2, 0xB0, 0x4D, 0xDD, 0x48, 0x86, 0x90, 0xD7, 0xA9, 0xBC, 0x19, 0xCF, 0xD1, 0x88,
-    0x90, 0xE6, 0xAB, 0xEC, 0x47, 0x74, 0xA9, 0x1F, 0xF0, 0x6E, 0xC4, 0xBA, 0x5D, 0x71, 0x79, 0x52,
-    0xF0, 0x75, 0x1D, 0x04, 0xD6, 0x51, 0x53, 0x9E, 0x46, 0x79, 0x74, 0xFB, 0x99, 0xCA, 0x4D, 0x9F,
-    0x21, 0xC0, 0x70, 0xD0, 0xF3, 0xA6, 0x45, 0x64, 0x6E, 0x7B, 0xFA, 0xC2, 0x6B, 0x17, 0xA6, 0xB7,
-    0x95, 0x48, 0xBE, 0x18, 0xD2, 0x55, 0x34, 0x2A, 0xEB, 0x80, 0x99, 0x99, 0xD9, 0xCE, 0xA2, 0x0D,
-    0x68, 0x6A, 0x80, 0x16, 0x8D, 0x28, 0xF5, 0x94, 0xC5, 0x10, 0x2D, 0x09, 0x3D, 0x7A, 0xE7, 0x46,
-    0xE2, 0x39, 0xCD, 0x36, 0x6D, 0xB0, 0xCD, 0x74, 0xEA, 0xF6, 0x81, 0xCE, 0x4D, 0xA8, 0xD9, 0xE7,
-    0x0C, 0xF7, 0xF2, 0x47, 0x05, 0x9B, 0x2B, 0xB6, 0x54, 0x5A, 0xC9, 0x40, 0xC2, 0xBB, 0x5E, 0x54,
-    0x66, 0xC9, 0xDA, 0x10, 0x25, 0xC3, 0xB4, 0x17, 0xF3, 0x21, 0x19, 0x1E, 0x90, 0xC3, 0x61, 0xDC,
-    0xC0, 0x15, 0x7A, 0x56, 0x03, 0xE8, 0x10, 0xCF, 0xB4, 0x14, 0xB8, 0x74, 0xCC, 0x27, 0xB5, 0x07,
-    0x6E, 0xA8, 0x72, 0xD6, 0x13, 0x81, 0x1E, 0xBC, 0x70, 0xDC, 0xCD, 0x48, 0xA4, 0x2F, 0xEF, 0xB9,
-    0x67, 0xEE, 0x30, 0xEE, 0xCD, 0x1F, 0x9B, 0xFC, 0x61, 0xC6, 0x12, 0x46, 0xFE, 0xCB, 0x42, 0xD8,
-    0x9B, 0x83, 0xF6, 0xE8, 0xE1, 0xBE, 0x9E, 0x3B, 0xDF, 0xC2, 0x97, 0xFD, 0x41, 0x04, 0xD3, 0x2E,
-    0x58, 0x52, 0x9E, 0x6F, 0x8E, 0x66, 0x08, 0x60, 0xDE, 0x26, 0x13, 0x40, 0x2C, 0xCA, 0x6C, 0x80,
-    0xF8, 0x15, 0x5D, 0x83, 0x53, 0x1A, 0x5D, 0xA1, 0xC6, 0xB0, 0x15, 0x3B, 0x5B, 0x2B, 0x7C, 0xE2,
-    0x04, 0x5C, 0x2A, 0x25, 0x51, 0xAF, 0xEC, 0xDF, 0x15, 0x54, 0x30, 0xF6, 0x70, 0xE3, 0xC2, 0x9C,
-    0x71, 0x7F, 0x16, 0x75, 0xD0, 0x16, 0x6F, 0x1D, 0xEA, 0x84, 0x17, 0x0A, 0xE6, 0x0A, 0x5A, 0x88,
-    0xE9, 0x83, 0x96, 0x33, 0x99, 0x2B, 0xD7, 0x2B, 0x5C, 0x2D, 0xBF, 0x05, 0x3A, 0x88, 0x81, 0x30,
-    0x97, 0x34, 0xFA, 0xF7, 0x5C, 0x91, 0x27, 0xE3, 0x0C, 0x28, 0x7C, 0x19, 0x2B, 0x0A, 0xFC, 0xAE,
-    0xA2, 0xC7, 0xE8, 0x46, 0x4F, 0xAD, 0x2D, 0x5A, 0xCA, 0x19, 0x8C, 0x03, 0xD0, 0x57, 0xF6, 0xCE,
-    0xD8, 0xB3, 0x43, 0x73, 0x50, 0x6A, 0xB5, 0xAA, 0x42, 0x49, 0x87, 0xA5, 0x2A, 0xCC, 0xEC, 0x8E,
-    0x17, 0x62, 0x68, 0x28, 0x8E, 0x06, 0x30, 0xC2, 0x41, 0x62, 0xDC, 0x8F, 0x5D, 0x2E, 0x48, 0xA4,
-    0x01, 0x98, 0x68, 0x3D, 0x21, 0xD9, 0x2A, 0x51, 0x8F, 0x87, 0x50, 0x1A, 0x40, 0x8A, 0x9D, 0x2C,
-    0xBB, 0xE3, 0x15, 0x3A, 0xED, 0x2E, 0xEE, 0xE9, 0x66, 0xFF, 0x74, 0x89, 0x6A, 0xFE, 0x50, 0x12,
-    0x15, 0x3A, 0x89, 0xD2, 0x96, 0xED, 0xDD, 0xDD, 0xFC, 0x8E, 0x1B, 0xA6, 0xD3, 0xEB, 0x2E, 0xBB,
-    0xF1, 0x32, 0x84, 0xF6, 0xD8, 0xBE, 0x0C, 0x65, 0x5E, 0x86, 0xEA, 0x54, 0x64, 0x28, 0x1F, 0x24,
-    0x9F, 0xEE, 0x8B, 0x47, 0xB6, 0xAB, 0xF6, 0x64, 0x28, 0x5E, 0x5D, 0x7F, 0x99, 0xF9, 0x19, 0xC2,
-    0x6E, 0x37, 0xD0, 0x76, 0x65, 0x3C, 0x67, 0x18, 0xCC, 0xD6, 0x26, 0xDF, 0xE6, 0xAB, 0xDC, 0xCC,
-    0x14, 0x0E, 0x5B, 0xEA, 0x11, 0x9C, 0x8B, 0xA6, 0x35, 0x8E, 0x74, 0xBA, 0x3B, 0xD3, 0xB9, 0x9D,
-    0x7F, 0x74, 0x0D, 0x5B, 0x56, 0xCB, 0xE2, 0x55, 0x7B, 0x60, 0xB2, 0x19, 0x9D, 0x9A, 0x96, 0x04,
-    0xFB, 0xEA, 0x31, 0xFF, 0xBE, 0x84, 0xE0, 0x58, 0x89, 0xF1, 0x2E, 0xAB, 0x01, 0x7F, 0x74, 0x62,
-    0x4C, 0x6D, 0x80, 0xE9, 0xDD, 0x17, 0xEC, 0x48, 0x61, 0x6C, 0xEC, 0xAB, 0x40, 0x58, 0xC2, 0x6D,
-    0x84, 0x38, 0xBF, 0xB3, 0xF6, 0x67, 0x2C, 0x60, 0x3F, 0xB0, 0x6C, 0x29, 0xCC, 0x96, 0xB3, 0x0C,
-    0xF6, 0x45, 0x70, 0xB4, 0xB2, 0x7D, 0x83, 0xF3, 0x97, 0x76, 0x4E, 0xF4, 0xEF, 0x2C, 0x94, 0x15,
-    0x0F, 0x5E, 0xF5, 0xCC, 0x9D, 0x9A, 0xD9, 0x4D, 0x7F, 0x19, 0x12, 0xDC, 0x94, 0xBE, 0x16, 0x53,
-    0xF0, 0xE4, 0xF9, 0x7F, 0xF2, 0x84, 0x66, 0xD6, 0x5D, 0xFA, 0xE7, 0x37, 0xE2, 0x87, 0x2B, 0x4F,
-    0xD0, 0xD7, 0x3C, 0xE9, 0x94, 0x1B, 0x1B, 0x4F, 0x59, 0xD7, 0x7C, 0x65, 0xCD, 0xA6, 0xAA, 0xAD,
-    0x5E, 0xB3, 0x05, 0x8E, 0x51, 0x3D, 0xE0, 0x2C, 0xF0, 0x18, 0x30, 0x72, 0xAA, 0x2C, 0x1D, 0x53,
-    0x83, 0x52, 0xDA, 0x6B, 0x98, 0xB2, 0x7F, 0x1B, 0x6D, 0xD3, 0xB6, 0x3A, 0x1D, 0x5D, 0x32, 0x0A,
-    0x8E, 0x67, 0x9F, 0x31, 0xB0, 0xE9, 0xDE, 0x7C, 0x6D, 0x82, 0x40, 0x37, 0x97, 0xEB, 0x33, 0x8E,
-    0x01, 0xCF, 0x1C, 0x07, 0xE4, 0x58, 0x60, 0x8E, 0x63, 0x2E, 0x39, 0x4E, 0x01, 0x67, 0x23, 0xC4,
-    0x6F, 0xCA, 0x30, 0x01, 0x28, 0x1F, 0x25, 0x8B, 0x0A, 0x1B, 0x74, 0x6F, 0x71, 0x5D, 0x77, 0x0E,
-    0x86, 0xB0, 0xB6, 0x10, 0x6A, 0xBE, 0xEB, 0x4F, 0x3B, 0x31, 0x36, 0x63, 0x2B, 0x8D, 0x45, 0xCB,
-    0x7C, 0xAF, 0x17, 0x15, 0x0E, 0x5B, 0xFE, 0xED, 0x86, 0xD2, 0x30, 0xDE, 0xF3, 0x5D, 0x0E, 0xF7,
-    0x65, 0xED, 0x93, 0x5B, 0xD2, 0x6C, 0x08, 0x35, 0x50, 0x11, 0xD1, 0xD0, 0x06, 0x87, 0x64, 0xB2,
-    0x01, 0x45, 0x99, 0x85, 0x5D, 0xC3, 0x57, 0x11, 0xD6, 0x7D, 0x38, 0xB9, 0x81, 0x28, 0xE3, 0x0E,
-    0x98, 0x70, 0x37, 0xA5, 0x57, 0x04, 0xEA, 0x07, 0x0F, 0x80, 0xC1, 0xD6, 0x1E, 0xB0, 0x24, 0xAD,
-    0x94, 0x70, 0x5A, 0x67, 0xDA, 0xD5, 0xBE, 0x83, 0x05, 0x87, 0x5B, 0xB0, 0x72, 0x3C, 0x73, 0x4E,
-    0x92, 0x15, 0x67, 0xD1, 0xE1, 0x6B, 0x37, 0x9E, 0x76, 0x22, 0xF5, 0x53, 0x85, 0x54, 0x8F, 0x94,
-    0x39, 0x87, 0xE7, 0x7A, 0x76, 0xF4, 0xBD, 0xC9, 0x70, 0xBE, 0xD2, 0xB5, 0xFD, 0x7D, 0x16, 0xB5,
-    0x1B, 0xB3, 0x71, 0xE7, 0x96, 0xC3, 0x3B, 0x5A, 0x9E, 0x08, 0xB4, 0xEB, 0xA7, 0x95, 0xB3, 0x9C,
-    0x5A, 0xA7, 0x03, 0x6E, 0x31, 0xE3, 0x93, 0x50, 0xA7, 0x2A, 0xB4, 0xAE, 0x5F, 0xE9, 0xA1, 0x41,
-    0xCD, 0x0C, 0xF9, 0x3D, 0x51, 0x26, 0x8C, 0x1F, 0xDB, 0xCD, 0x3A, 0xF1, 0x1C, 0x2F, 0x5E, 0x30,
-    0x1F, 0xD0, 0x7A, 0x71, 0xBF, 0x4D, 0x24, 0xFC, 0x95, 0x97, 0xD9, 0xBC, 0xBC, 0xEC, 0xCF, 0x68,
-    0x68, 0x19, 0xA1, 0xE2, 0x09, 0x24, 0x3E, 0x1B, 0xD5, 0xBC, 0xE4, 0xDC, 0x20, 0x74, 0x3E, 0x3A,
-    0xA4, 0x2A, 0x1E, 0x7F, 0xBE, 0x7F, 0x8B, 0x89, 0x29, 0xFF, 0x9C, 0x42, 0xEA, 0x8F, 0x78, 0x6A,
-    0x38, 0xE7, 0x86, 0x26, 0xF6, 0x27, 0x30, 0x5D, 0x83, 0xBA, 0x38, 0xE7, 0x91, 0x77, 0x74, 0xCC,
-    0x7A, 0x00, 0x4D, 0xFF, 0xD0, 0x84, 0xDC, 0x77, 0xDD, 0x2D, 0x9A, 0x11, 0x82, 0xD8, 0x9D, 0xCF,
-    0x9A, 0x76, 0xAD, 0x42, 0xA6, 0x81, 0x6E, 0xEC, 0x25, 0x25, 0x74, 0x2A, 0x93, 0x81, 0x7E, 0xAF,
-    0x51, 0x59, 0xB4, 0x1F, 0x1D, 0x95, 0xFB, 0x4C, 0xE9, 0xDC, 0x34, 0x7F, 0xB8, 0x1B, 0xF0, 0x57,
-    0xCB, 0xB9, 0x4D, 0x21, 0x71, 0x1E, 0x2E, 0xF5, 0x52, 0x1A, 0x1C, 0xFD, 0xE1, 0xE0, 0x72, 0x87,
-    0x23, 0x58, 0x3A, 0x2A, 0xDE, 0xD6, 0xBD, 0xAF, 0xC6, 0x2B, 0x93, 0xCF, 0xAC, 0x83, 0xF1, 0x12,
-    0x15, 0xF8, 0xCC, 0x60, 0x97, 0x97, 0x08, 0xAC, 0x8A, 0xEF, 0x70, 0x6C, 0x93, 0x09, 0x73, 0x33,
-    0x6F, 0x75, 0x3B, 0x6D, 0x65, 0x07, 0x4F, 0x38, 0xBF, 0x65, 0xDD, 0x9F, 0x66, 0x18, 0xE9, 0xE5,
-    0x77, 0xD1, 0x79, 0xD3, 0xEE, 0x8E, 0x32, 0xD7, 0xBE, 0x8F, 0xA3, 0x7E, 0xA9, 0x18, 0xB7, 0xBF,
-    0xCF, 0x51, 0xAD, 0x27, 0xFE, 0x6F, 0x4A, 0x64, 0xBB, 0xF3, 0xDB, 0x2A, 0x8C, 0x11, 0x77, 0x29,
-    0x8C, 0x9A, 0xC9, 0xD0, 0xA6, 0xD6, 0xE1, 0xF5, 0x9E, 0xB5, 0x97, 0xD0, 0xFD, 0x5A, 0xEC, 0x9A,
-    0x01, 0x28, 0x81, 0x5B, 0xAD, 0xC1, 0xB8, 0x12, 0x38, 0xBB, 0x39, 0x72, 0xD3, 0xFF, 0x02, 0xAD,
-    0x54, 0x31, 0x8C, 0x1C, 0x35, 0x14, 0xFD, 0x1E, 0x27, 0x99, 0x28, 0x23, 0x64, 0x8A, 0x5C, 0x91,
-    0x80, 0x18, 0x0A, 0xAA, 0x48, 0x87, 0x1B, 0x5A, 0xCE, 0x03, 0x29, 0x52, 0x20, 0xC1, 0x16, 0x77,
-    0x34, 0xB4, 0x14, 0x68, 0x9B, 0x50, 0x50, 0xEE, 0x69, 0x36, 0x69, 0x29, 0xB2, 0x0D, 0xA2, 0x4D,
-    0x71, 0x48, 0x64, 0x29, 0xA0, 0xA0, 0x5C, 0x18, 0xE7, 0x82, 0x44, 0x41, 0x33, 0x10, 0x89, 0xB4,
-    0xBE, 0x03, 0x01, 0x52, 0x0A, 0x7C, 0xB9, 0x29, 0x9C, 0xC4, 0x33, 0x8F, 0xEF, 0xD9, 0x8B, 0x80,
-    0x08, 0xA5, 0xC2, 0xD2, 0x68, 0xFC, 0xFD, 0xED, 0xEF, 0xF7, 0xDE, 0xFF, 0xDF, 0x1B, 0x24, 0x7B,
-    0x52, 0x1D, 0xD5, 0xAD, 0x40, 0x45, 0x44, 0x31, 0xEB, 0x72, 0xA7, 0xAC, 0x99, 0xF3, 0x7C, 0x46,
-    0xA4, 0x3C, 0x09, 0xB4, 0x64, 0x50, 0xA9, 0xA3, 0x21, 0x0B, 0x59, 0xE4, 0x65, 0x2A, 0x7E, 0xF4,
-    0xCD, 0xF7, 0x77, 0xFE, 0x1C, 0x74, 0xE9, 0x67, 0xBA, 0x12, 0xD3, 0xA6, 0x05, 0x06, 0x0D, 0x1C,
-    0x2E, 0x3F, 0xDB, 0x26, 0x3A, 0xBD, 0x33, 0xAF, 0xD9, 0x2E, 0x01, 0xFC, 0xB6, 0x5C, 0xEE, 0x6C,
-    0xA7, 0x03, 0xAE, 0x38, 0x04, 0x7C, 0x8D, 0x50, 0xA0, 0xA3, 0xE9, 0x82, 0xC4, 0xC4, 0x58, 0x14,
-    0xD1, 0x3C, 0xC0, 0x5C, 0xFA, 0x3A, 0x8B, 0xDA, 0x42, 0xF9, 0xE6, 0x87, 0x68, 0x7E, 0x19, 0x68,
-    0xAB, 0x6C, 0xBF, 0x0E, 0x1F, 0xA5, 0x7B, 0xF4, 0x75, 0xBC, 0xB3, 0x5B, 0x7B, 0xCC, 0xF7, 0x88,
-    0x36, 0x88, 0xB6, 0x09, 0x24, 0xE3, 0x08, 0x57, 0x05, 0x32, 0xCE, 0x38, 0x42, 0x82, 0x39, 0x0E,
-    0x19, 0xB2, 0xA0, 0x0E, 0x06, 0xAA, 0x51, 0x65, 0xB0, 0x09, 0x37, 0xAD, 0x4E, 0x4E, 0xF1, 0xDC,
-    0x58, 0x81, 0x44, 0x54, 0x7B, 0x26, 0x9A, 0x81, 0x8A, 0x7E, 0x7D, 0x6A, 0x7A, 0x93, 0xE0, 0x78,
-    0xBF, 0x1C, 0x97, 0x54, 0xA4, 0x92, 0x03, 0xB3, 0x18, 0x9E, 0xE0, 0x25, 0xE6, 0xBC, 0x50, 0x3B,
-    0xF6, 0xE9, 0x4E, 0xC0, 0xAA, 0x9E, 0x2E, 0x2D, 0xC8, 0x44, 0x6A, 0xD8, 0x6B, 0x33, 0x54, 0xEC,
-    0xC8, 0x07, 0xE2, 0xE5, 0x32, 0xD2, 0xC5, 0x9B, 0x62, 0xA2, 0xF6, 0x1B, 0xDD, 0xC1, 0x1A, 0x0A,
-    0x74, 0x5E, 0x74, 0xF2, 0x91, 0xEA, 0xCB, 0xB0, 0x45, 0x91, 0xCC, 0xAD, 0x49, 0x8D, 0xD8, 0x20,
-    0x32, 0x48, 0x92, 0x1D, 0x49, 0x4F, 0x39, 0xC3, 0x23, 0xB1, 0xC8, 0x5B, 0x2D, 0xA2, 0x69, 0x07,
-    0xE9, 0x4E, 0xB1, 0xBD, 0xA9, 0x7E, 0xEA, 0xF4, 0x9B, 0x5D, 0xC1, 0x12, 0x92, 0x3E, 0xB3, 0x2A,
-    0xBB, 0x3A, 0x5E, 0xF5, 0x62, 0xFE, 0xBE, 0xC0, 0xA7, 0xD8, 0x47, 0xF1, 0x5D, 0x99, 0x68, 0x56,
-    0x1F, 0x36, 0x07, 0xBF, 0x3E, 0xC7, 0x5B, 0xA6, 0xCD, 0x6D, 0x20, 0x1A, 0xE0, 0x67, 0x56, 0xBD,
-    0xF0, 0x66, 0x1F, 0x2A, 0x36, 0x07, 0x3B, 0x55, 0xE1, 0x1B, 0xE5, 0x06, 0x7D, 0x38, 0x98, 0xBB,
-    0x7D, 0x7D, 0x2F, 0xFE, 0x5B, 0xC5, 0x3A, 0x30, 0x59, 0x35, 0x90, 0xF1, 0x8C, 0x9F, 0xD9, 0xA1,
-    0xCD, 0xC1, 0xD8, 0x29, 0x73, 0xD2, 0x16, 0x4E, 0x85, 0xF3, 0x2B, 0x1D, 0x8C, 0xBF, 0x54, 0x31,
-    0x81, 0xBE, 0x08, 0x65, 0x6B, 0x2A, 0x13, 0x4D, 0x2C, 0x02, 0x3D, 0x4F, 0x49, 0xFA, 0x90, 0x77,
-    0xCA, 0x2B, 0xAF, 0x9D, 0x69, 0x8D, 0x2D, 0x11, 0x75, 0x02, 0x10, 0xCC, 0x95, 0xAE, 0xCE, 0xFD,
-    0xB7, 0x8C, 0xC1, 0x66, 0x31, 0x79, 0xF3, 0x21, 0x25, 0x81, 0xAF, 0x06, 0xD3, 0xAC, 0x2D, 0x91,
-    0x39, 0x49, 0xD2, 0x16, 0x7F, 0x0D, 0x57, 0x19, 0x1C, 0x49, 0x04, 0x2A, 0x06, 0x50, 0xE9, 0x39,
-    0xD6, 0x3C, 0x0F, 0xC9, 0x9D, 0xBB, 0x59, 0x19, 0x76, 0x4D, 0x5C, 0xED, 0xD6, 0x61, 0x65, 0xFC,
-    0xAC, 0xE0, 0xA3, 0x94, 0x81, 0xC9, 0xE3, 0x68, 0x58, 0xEE, 0xD1, 0xC6, 0x74, 0x51, 0xA3, 0x57,
-    0x5C, 0x68, 0x78, 0x74, 0x2B, 0x0B, 0x3A, 0xC3, 0x5B, 0x16, 0xC7, 0x6E, 0xD5, 0x74, 0x46, 0xC5,
-    0xE2, 0x36, 0xA7, 0x0E, 0xB8, 0x87, 0x24, 0x35, 0x57, 0x00, 0x05, 0x2E, 0x09, 0x2F, 0x99, 0x42,
-    0x94, 0xED, 0x78, 0x7B, 0x9E, 0x08, 0xD9, 0x41, 0x26, 0x8C, 0x40, 0x05, 0x04, 0x0E, 0x65, 0xA7,
-    0xCB, 0xCF, 0xB3, 0xE5, 0x52, 0xF0, 0xAC, 0x81, 0x33, 0x99, 0x57, 0xF3, 0x98, 0x63, 0x90, 0xE3,
-    0x06, 0x9B, 0x3D, 0x76, 0x1A, 0xED, 0x31, 0xAE, 0xDC, 0x98, 0xBD, 0x3E, 0xF3, 0x0F, 0x7E, 0x4F,
-    0xE5, 0x96, 0xBF, 0x4D, 0x03, 0xBD, 0x4A, 0xA5, 0xDD, 0xEC, 0x2E, 0x5C, 0x78, 0xAA, 0x17, 0x48,
-    0xB8, 0x72, 0x3F, 0xEA, 0x3B, 0xDD, 0x2B, 0x27, 0x8C, 0x15, 0x03, 0xF9, 0x26, 0x31, 0x1B, 0x45,
-    0xE0, 0xE4, 0x3F, 0x7B, 0xB0, 0x8E, 0x32, 0xB2, 0xB4, 0x47, 0xA0, 0xE6, 0x46, 0x90, 0xBD, 0x19,
-    0x91, 0x2B, 0x0C, 0x0A, 0x7D, 0xD2, 0xFB, 0x7A, 0x34, 0x97, 0x83, 0xE1, 0x30, 0xEF, 0x7E, 0x11,
-    0x19, 0x72, 0x64, 0x98, 0xF1, 0xDC, 0xF2, 0x93, 0xED, 0xF5, 0x69, 0x51, 0xE5, 0x40, 0xCB, 0xA4,
-    0x1C, 0x0B, 0xE1, 0x36, 0x58, 0x68, 0x31, 0xD9, 0x10, 0x51, 0xD9, 0x94, 0x9B, 0xCB, 0xA1, 0xB4,
-    0x3D, 0x17, 0x87, 0x0C, 0xE6, 0x5A, 0x5F, 0xB6, 0xE7, 0x76, 0xDE, 0x48, 0x3D, 0x7B, 0x97, 0xD3,
-    0x64, 0x2C, 0xCB, 0xDF, 0xAC, 0x3B, 0x29, 0xD5, 0xA1, 0x4C, 0x53, 0xCE, 0x5C, 0xD9, 0xAF, 0x28,
-    0xC7, 0xC7, 0x2D, 0x21, 0x44, 0xD2, 0x5F, 0x72, 0xAB, 0x3E, 0xE6, 0x84, 0x9A, 0xE3, 0x9E, 0xC4,
-    0x6E, 0xDA, 0x66, 0xD7, 0xDB, 0x58, 0x0B, 0x26, 0x98, 0x8C, 0xEE, 0x69, 0x63, 0x33, 0x81, 0xFA,
-    0x0F, 0x9A, 0xD2, 0x8F, 0xBF, 0x66, 0x2D, 0xD1, 0x68, 0x70, 0x7F, 0xA6, 0x71, 0x71, 0xF1, 0x2C,
-    0x79, 0x0A, 0x38, 0x81, 0x39, 0x93, 0xB4, 0x3A, 0x72, 0x5D, 0x20, 0x47, 0x55, 0x87, 0xC4, 0x55,
-    0x81, 0x38, 0x9D, 0x5C, 0x6F, 0x19, 0xB8, 0x8D, 0x47, 0xD1, 0xC4, 0xF8, 0x54, 0x31, 0xB9, 0xD1,
-    0xD8, 0xFE, 0x3B, 0x08, 0xBF, 0x73, 0x1F, 0x50, 0xD3, 0x73, 0x11, 0xDC, 0x3F, 0xEA, 0x59, 0x6D,
-    0xEE, 0xD8, 0x6B, 0xA9, 0x50, 0xC5, 0xDE, 0x3F, 0xDD, 0x85, 0x2F, 0xEF, 0x1F, 0x0D, 0xA3, 0x5B,
-    0xCF, 0x4F, 0xDC, 0xA7, 0xD2, 0x4B, 0x46, 0xA9, 0x9A, 0x5E, 0xA6, 0xFF, 0x63, 0x9C, 0x1E, 0x0B,
-    0x63, 0x14, 0xE3, 0x6C, 0x61, 0xBF, 0x7A, 0x71, 0xAD, 0x4D, 0x42, 0xFF, 0x12, 0x97, 0x12, 0x95,
-    0x6E, 0xA8, 0xE8, 0x6A, 0x48, 0x44, 0x1F, 0xD2, 0x19, 0xE0, 0x8F, 0x27, 0xE7, 0x5E, 0x60, 0x9B,
-    0xD2, 0xFB, 0x5A, 0x15, 0x0F, 0x77, 0xDE, 0x83, 0xE0, 0xE6, 0xC9, 0xFA, 0xD4, 0x5B, 0x99, 0x4B,
-    0x4F, 0xF8, 0xD9, 0x71, 0xD3, 0x64, 0x1D, 0xAD, 0x4B, 0xC7, 0x31, 0x76, 0x4D, 0xFA, 0x99, 0xF1,
-    0x37, 0xE6, 0x7A, 0x2D, 0x13, 0xBD, 0xF6, 0x24, 0xEA, 0x5F, 0xCD, 0x7C, 0x3D, 0xAC, 0xDE, 0xD6,
-    0x99, 0xE6, 0xF9, 0xC8, 0x48, 0x1F, 0x60, 0x02, 0x61, 0x0A, 0x2B, 0x41, 0xAC, 0x01, 0xD8, 0x4C,
-    0x31, 0xEB, 0x4C, 0xC2, 0x76, 0xB1, 0x48, 0x44, 0x3A, 0xC6, 0xC0, 0x45, 0x0A, 0xAB, 0x90, 0x52,
-    0xAC, 0x0B, 0x6F, 0xBB, 0x0E, 0x10, 0x35, 0x5B, 0x6C, 0x21, 0x8B, 0x74, 0x0C, 0x6C, 0x8A, 0x14,
-    0xD1, 0x02, 0x93, 0x6D, 0xA6, 0x88, 0x8B, 0x64, 0x61, 0xCB, 0x0B, 0x68, 0x8B, 0x29, 0xB2, 0x80,
-    0x6C, 0x52, 0x76, 0xE1, 0xC2, 0x85, 0xE9, 0x18, 0xD9, 0x00, 0xEB, 0xC2, 0x4C, 0xEC, 0x4C, 0x76,
-    0x2C, 0x60, 0x45, 0xDB, 0x74, 0x4C, 0x4B, 0x24, 0xCF, 0x3E, 0xCF, 0xF3, 0x1E, 0x7E, 0xF7, 0xCA,
-    0x96, 0xED, 0x64, 0x92, 0xCC, 0xCC, 0x95, 0xF4, 0xE9, 0x5E, 0x5E, 0x92, 0xE7, 0x9C, 0xF7, 0xBC,
-    0x3F, 0xCF, 0xFB, 0x77, 0x9C, 0x73, 0x45, 0xEB, 0x9C, 0xDB, 0x79, 0x7C, 0xB8, 0x64, 0xE6, 0x67,
-    0x31, 0xF0, 0xF3, 0x54, 0xE9, 0x3E, 0xE1, 0xEB, 0xFC, 0xF9, 0xA7, 0xDC, 0xDE, 0xFB, 0xD5, 0xB9,
-    0xC6, 0xFB, 0xD6, 0xA5, 0xDE, 0x4F, 0xCE, 0xE9, 0xF9, 0xBC, 0xC3, 0x47, 0x6C, 0x2F, 0xE1, 0x5B,
-    0xF7, 0xEB, 0x95, 0x96, 0x77, 0xE1, 0x0A, 0xEE, 0xAA, 0x31, 0x8A, 0x1F, 0x71, 0x57, 0xCF, 0xBB,
-    0x16, 0xDE, 0x55, 0xF1, 0xAE, 0x64, 0x39, 0x7F, 0x0E, 0x2F, 0xF0, 0xBE, 0xE3, 0x5D, 0x0B, 0xEF,
-    0xC2, 0x6B, 0x0B, 0x8F, 0xC7, 0x62, 0x7D, 0x8B, 0xE9, 0x9D, 0x3B, 0x71, 0x16, 0xEF, 0xBC, 0x8E,
-    0x51, 0xF6, 0x33, 0x9F, 0xF7, 0x4F, 0x62, 0xF8, 0x6C, 0x6A, 0x3A, 0xDC, 0xF2, 0xF0, 0xF2, 0x09,
-    0x13, 0x8D, 0xAE, 0x5C, 0xB5, 0x17, 0x8D, 0x61, 0xBE, 0xDE, 0x5F, 0xA9, 0x5D, 0x3A, 0x1C, 0xD6,
-    0x7B, 0x7C, 0x26, 0x6F, 0xE3, 0xF7, 0x09, 0xE7, 0xE0, 0xFC, 0x61, 0xBE, 0x91, 0xEE, 0x2A, 0x8E,
-    0xDF, 0x75, 0xE5, 0x29, 0xFE, 0xCA, 0x6B, 0xBE, 0x83, 0xCB, 0xF8, 0x6D, 0xA4, 0x6F, 0x0B, 0x5D,
-    0x0D, 0x5F, 0xF7, 0xE1, 0x87, 0x1A, 0x63, 0xE2, 0x52, 0x85, 0x8F, 0x79, 0xEF, 0x7F, 0x81, 0xF9,
-    0xBB, 0xC6, 0x1D, 0xE8, 0x93, 0xF1, 0xA5, 0xAE, 0x29, 0x0F, 0x17, 0xF0, 0x56, 0xFC, 0x50, 0xF1,
-    0x33, 0xD2, 0xAB, 0xD2, 0x85, 0x63, 0x56, 0x6D, 0x3C, 0xB9, 0x68, 0x75, 0x69, 0xCF, 0x89, 0x17,
-    0x25, 0x08, 0x1B, 0xCD, 0x6E, 0xB7, 0x72, 0xEE, 0xC9, 0x98, 0x79, 0x5E, 0x68, 0x26, 0xAC, 0x27,
-    0xC6, 0x7C, 0x4F, 0xFE, 0xEC, 0x9E, 0xCB, 0x36, 0x81, 0x98, 0xAF, 0x2F, 0x48, 0x83, 0x91, 0x83,
-    0x91, 0x86, 0xF3, 0x5D, 0x69, 0x84, 0x01, 0x7B, 0x8E, 0x57, 0x8B, 0xF4, 0xC5, 0x2F, 0xCE, 0x9F,
-    0xC5, 0x60, 0x18, 0x7C, 0x0C, 0x7B, 0x28, 0x42, 0x25, 0x13, 0x7F, 0xEA, 0xF8, 0x53, 0x19, 0xB8,
-    0x44, 0x4C, 0x82, 0x21, 0xDD, 0x9E, 0x84, 0xC9, 0xF5, 0x13, 0x6E, 0xDF, 0xF3, 0xF6, 0x9C, 0xB7,
-    0x3F, 0x56, 0x1F, 0x1B, 0xE5, 0xC2, 0xAA, 0xA1, 0x70, 0x6B, 0x4E, 0x5A, 0x25, 0xFE, 0x01, 0x5F,
-    0xE3, 0x5D, 0x58, 0x39, 0xDE, 0x9A, 0x77, 0x78, 0xFF, 0x6E, 0x31, 0x16, 0xCA, 0xB6, 0x6D, 0xAF,
-    0xC3, 0xC6, 0x4D, 0xA2, 0x13, 0x5F, 0x96, 0xAC, 0xF8, 0x2D, 0xE9, 0xEE, 0xFB, 0x84, 0x44, 0x25,
-    0xFB, 0xE1, 0x1D, 0xFC, 0x99, 0x8F, 0x61, 0xC6, 0xA7, 0xFD, 0x5B, 0x47, 0x9B, 0xDF, 0x7C, 0x18,
-    0x36, 0x34, 0xE5, 0x0D, 0xA9, 0xBF, 0x31, 0x80, 0x1F, 0x49, 0x9A, 0xF5, 0xB0, 0xFF, 0x62, 0xBF,
-    0x9C, 0x0B, 0xD8, 0x93, 0x3D, 0x0E, 0x3B, 0xDF, 0x71, 0xB2, 0x5C, 0xE5, 0x05, 0xAE, 0xD0, 0x79,
-    0xAE, 0x2E, 0x9D, 0xDD, 0xC8, 0x29, 0xF8, 0xB7, 0x40, 0x74, 0x4E, 0xA2, 0xD6, 0x47, 0xCE, 0x39,
-    0xE0, 0x3E, 0x0E, 0xBC, 0xFF, 0xBF, 0xE0, 0x4E, 0x12, 0x0B, 0xD4, 0xC3, 0x66, 0x65, 0x03, 0x37,
-    0x09, 0x32, 0x01, 0x3A, 0xE2, 0x6F, 0x55, 0x73, 0xBB, 0x3D, 0x87, 0x06, 0x5F, 0x61, 0x16, 0xD8,
-    0x5E, 0xDC, 0x9E, 0xEA, 0x6F, 0x36, 0x91, 0x6A, 0x5F, 0xC1, 0x1A, 0xF6, 0x43, 0x05, 0x8E, 0x28,
-    0xDA, 0xDD, 0x0A, 0x16, 0xF1, 0x3F, 0x9C, 0x5C, 0xF1, 0xDA, 0x5D, 0xF8, 0x7B, 0x77, 0x2B, 0x4C,
-    0x9F, 0x2C, 0xCC, 0xCD, 0x22, 0x13, 0x69, 0x51, 0x24, 0x15, 0xE5, 0x90, 0x6C, 0xAE, 0x8B, 0x6B,
-    0xE0, 0x33, 0xEE, 0x26, 0xA6, 0xA4, 0xED, 0x13, 0x0D, 0xC4, 0x6F, 0xAD, 0x6D, 0x25, 0xA6, 0x20,
-    0xEA, 0x44, 0x5C, 0xF0, 0xD5, 0xCE, 0x06, 0xD1, 0xAE, 0x6A, 0x93, 0x39, 0xD1, 0x83, 0x66, 0xE0,
-    0x73, 0x9B, 0xAA, 0xE8, 0x5D, 0x60, 0x8A, 0x3B, 0x2F, 0x1C, 0x53, 0x26, 0xDD, 0xE1, 0x42, 0x3A,
-    0x1D, 0x2E, 0x44, 0xC7, 0x2E, 0x68, 0x13, 0x62, 0x5C, 0x88, 0xFF, 0x6B, 0x33, 0x8A, 0x41, 0x5A,
-    0xEE, 0xC4, 0xC2, 0x4D, 0xC1, 0xC6, 0x81, 0x0D, 0xB8, 0xFE, 0xEF, 0xF8, 0xF2, 0x4E, 0xAE, 0xD5,
-    0x43, 0xDA, 0xA4, 0xD4, 0x6B, 0x83, 0x8A, 0x12, 0xD2, 0xE1, 0x76, 0xB3, 0x18, 0x3D, 0xE9, 0x63,
-    0x5D, 0x73, 0x59, 0xAD, 0x6B, 0xCF, 0xD9, 0x35, 0xFF, 0x21, 0xEF, 0x03, 0xB3, 0xF0, 0x5A, 0x83,
-    0x3D, 0xC7, 0xB5, 0x91, 0x5C, 0x58, 0xA6, 0x6D, 0x3A, 0xE0, 0x5A, 0x05, 0x32, 0xA5, 0x7D, 0x34,
-    0x61, 0x6F, 0x70, 0xED, 0x6D, 0x3F, 0x60, 0xE1, 0x18, 0xAC, 0x6E, 0x28, 0x24, 0x13, 0x66, 0x99,
-    0xE2, 0xA1, 0x6C, 0xBC, 0x63, 0x2F, 0x4E, 0x68, 0x66, 0x3B, 0x93, 0xAF, 0xBC, 0xE5, 0xF8, 0x90,
-    0xD9, 0xB4, 0xE6, 0x50, 0x91, 0x76, 0x54, 0x92, 0xD8, 0x38, 0x4E, 0x09, 0x72, 0x7C, 0xC9, 0x05,
-    0xED, 0x21, 0xF5, 0xB1, 0x96, 0x14, 0x3F, 0xCC, 0x08, 0x82, 0xCD, 0x21, 0x46, 0x2E, 0xA4, 0x05,
-    0x0F, 0x0C, 0xD1, 0x9C, 0x0C, 0x9A, 0x10, 0xA7, 0x99, 0x4C, 0x69, 0xE7, 0xFC, 0xB3, 0x1E, 0xC3,
-    0x90, 0x9F, 0x0B, 0x88, 0x8F, 0xDD, 0x0C, 0xE5, 0x7B, 0x7F, 0xD8, 0x2E, 0xBE, 0x8D, 0x6A, 0x68,
-    0xE1, 0xC7, 0x2C, 0xC5, 0x73, 0xE9, 0x59, 0xFF, 0xEC, 0x24, 0xEA, 0xDA, 0x9E, 0x4B, 0x5A, 0xB5,
-    0x33, 0xA9, 0x3E, 0x56, 0xEC, 0x6E, 0x16, 0xD4, 0x17, 0x58, 0x6D, 0x7D, 0x08, 0xCB, 0xC5, 0xC0,
-    0xAE, 0xE9, 0xA2, 0x09, 0x02, 0x1D, 0xEB, 0x63, 0xDC, 0x41, 0x99, 0x0D, 0x91, 0x2F, 0xD3, 0x21,
-    0xB6, 0x0F, 0xA8, 0xAF, 0xC4, 0x73, 0x2B, 0xBF, 0xEB, 0xEE, 0x35, 0x7D, 0x23, 0xCE, 0xC8, 0x45,
-    0x08, 0xED, 0x6A, 0xCA, 0x5D, 0x75, 0x1F, 0xE1, 0xDC, 0x6C, 0xA0, 0x6A, 0x68, 0x20, 0xFC, 0x60,
-    0xCD, 0x6C, 0xA6, 0x16, 0xD4, 0x66, 0x3F, 0x4C, 0x92, 0xCD, 0xFC, 0x36, 0x7F, 0x9D, 0x8F, 0x78,
-    0xE8, 0xF5, 0x20, 0x92, 0x05, 0x59, 0xC0, 0xE9, 0xDB, 0xC4, 0xB6, 0x99, 0xFC, 0xB8, 0xA3, 0x7E,
-    0xA0, 0x74, 0x93, 0xAF, 0xF9, 0xB9, 0xF3, 0x05, 0x55, 0x26, 0x16, 0x4D, 0x1E, 0x94, 0x52, 0x7E,
-    0x00, 0x0F, 0xA5, 0x73, 0xAC, 0x47, 0xDD, 0xB9, 0x23, 0xCD, 0x6B, 0xAC, 0x6C, 0xDC, 0x99, 0x7E,
-    0x44, 0x29, 0x8A, 0x2D, 0xA1, 0x72, 0xC0, 0x99, 0x90, 0x21, 0xE8, 0x01, 0x8F, 0x41, 0xF8, 0x44,
-    0x33, 0x43, 0xD2, 0xF6, 0x98, 0x0B, 0x56, 0x4D, 0xBD, 0x15, 0x83, 0xF3, 0xB2, 0xBE, 0xC0, 0x8C,
-    0x9A, 0x6F, 0x82, 0x86, 0xF1, 0x9C, 0xDF, 0x58, 0x5C, 0xF6, 0x8E, 0x87, 0x84, 0x34, 0x3F, 0x7C,
-    0x07, 0x34, 0x5B, 0xFC, 0xC3, 0x18, 0xDE, 0x4F, 0xBC, 0xE0, 0xBF, 0x87, 0x0B, 0x7E, 0x4E, 0x79,
-    0xA1, 0xAD, 0x46, 0x57, 0x2D, 0x91, 0xC7, 0x66, 0xF7, 0x29, 0xD9, 0xC9, 0x55, 0x52, 0xAE, 0xA4,
-    0x1D, 0x76, 0xA3, 0x25, 0x53, 0x4B, 0xFD, 0x74, 0x94, 0x92, 0x4F, 0xB4, 0xC1, 0xB6, 0x1A, 0x70,
-    0x56, 0x53, 0x62, 0x8F, 0xB2, 0x1E, 0x5B, 0x16, 0xCF, 0x14, 0x75, 0xE8, 0x26, 0x52, 0xA0, 0x2A,
-    0xB1, 0x42, 0x48, 0xFC, 0xCE, 0x5F, 0x68, 0x03, 0x11, 0x53, 0x92, 0x2F, 0xA2, 0x9A, 0x74, 0x95,
-    0xF6, 0x7E, 0xD9, 0x98, 0xC2, 0x96, 0x6D, 0x74, 0x6D, 0xC3, 0xD8, 0xB9, 0x3D, 0xD2, 0x53, 0xCA,
-    0xEA, 0x8D, 0x80, 0xF6, 0x05, 0xCD, 0x92, 0xB7, 0x18, 0x1D, 0x02, 0xB3, 0x92, 0xD3, 0x9B, 0x12,
-    0xCA, 0x1B, 0x63, 0x79, 0x59, 0xA8, 0x76, 0xAF, 0xF9, 0x2C, 0xB0, 0x4E, 0xB8, 0x42, 0xD9, 0xE2,
-    0x6F, 0xA0, 0xCB, 0xAA, 0x1A, 0x57, 0xF2, 0xEE, 0xF0, 0xE0, 0x1C, 0x1E, 0x24, 0xEF, 0xD3, 0xA4,
-    0xB6, 0xB4, 0x97, 0x3D, 0x8D, 0x3F, 0xA6, 0x98, 0x52, 0x4B, 0xEC, 0xB9, 0xDF, 0x91, 0xB6, 0x48,
-    0xD3, 0x3C, 0x15, 0x26, 0x60, 0x36, 0x41, 0xD3, 0xCA, 0x67, 0x29, 0x6F, 0x32, 0x9B, 0x74, 0x41,
-    0x7E, 0x93, 0x46, 0xE8, 0x77, 0x62, 0xA2, 0x8C, 0xCB, 0x78, 0x75, 0xE5, 0xFD, 0xB4, 0xB6, 0x7E,
-    0x27, 0xCA, 0x40, 0x05, 0x62, 0x3F, 0x69, 0xC0, 0xDF, 0xBE, 0x6A, 0x56, 0xBB, 0xDC, 0x6B, 0x4C,
-    0xA9, 0x73, 0xFE, 0x3C, 0x51, 0x11, 0xFA, 0x96, 0xD0, 0x66, 0x2E, 0x46, 0xD1, 0xE4, 0xFE, 0x2B,
-    0x57, 0x68, 0xCE, 0x07, 0x61, 0x19, 0x01, 0x08, 0x1F, 0x6C, 0xF8, 0x4E, 0xE6, 0x0F, 0x74, 0x8A,
-    0x03, 0x68, 0x71, 0xFB, 0x5B, 0x0D, 0xEE, 0x83, 0xE0, 0x42, 0x50, 0x06, 0x4C, 0xBC, 0xC0, 0x62,
-    0x92, 0x6E, 0x47, 0x5D, 0x95, 0x9B, 0xBD, 0xEA, 0xB4, 0x21, 0xBB, 0xF3, 0x66, 0xEF, 0x46, 0xDA,
-    0x7B, 0xAA, 0x88, 0xAC, 0x85, 0xD5, 0x9E, 0xDD, 0xE3, 0x50, 0x1D, 0x49, 0xBB, 0xE7, 0x84, 0xC8,
-    0x30, 0x6B, 0xB9, 0xE3, 0x13, 0xF9, 0xF9, 0x0B, 0x35, 0x5E, 0xF7, 0x38, 0xB4, 0xC7, 0xBE, 0x4F,
-    0x3A, 0xBC, 0x17, 0x92, 0xDA, 0x81, 0x6E, 0xF3, 0x2E, 0x98, 0x21, 0x68, 0xB7, 0x83, 0xF9, 0xCB,
-    0x28, 0xCD, 0x8D, 0x5D, 0x83, 0xC4, 0xBE, 0x0F, 0x80, 0x45, 0xBB, 0x20, 0x10, 0xA3, 0xE9, 0x53,
-    0xE9, 0x1E, 0x19, 0xFA, 0xAA, 0x0B, 0x2A, 0x59, 0xF2, 0x40, 0x1D, 0x7E, 0xA7, 0xA1, 0x17, 0x5B,
-    0x24, 0xBC, 0xFD, 0xBE, 0xA7, 0xF4, 0xFE, 0x7B, 0x40, 0x0F, 0x4E, 0x7B, 0x96, 0xF8, 0xD5, 0x5C,
-    0xFC, 0x48, 0x0D, 0xD7, 0xF0, 0xF5, 0x1C, 0x60, 0xE5, 0x8E, 0x65, 0x2D, 0xB6, 0x20, 0x9E, 0xC1,
-    0x0B, 0xAE, 0xA8, 0xC1, 0x06, 0xFB, 0x91, 0xB2, 0xD7, 0x70, 0x2A, 0x69, 0x8F, 0x81, 0x23, 0xD9,
-    0xFC, 0xA6, 0xA5, 0xA1, 0x1C, 0x31, 0x1B, 0xE9, 0x2E, 0xCE, 0xD8, 0xB7, 0xFC, 0x76, 0x8C, 0x83,
-    0x5E, 0x34, 0xAE, 0xC1, 0x5F, 0x60, 0xD2, 0xF3, 0x14, 0x89, 0x13, 0xE7, 0xFF, 0xBD, 0x50, 0x62,
-    0x6D, 0x08, 0xB4, 0x90, 0x81, 0xE7, 0xB2, 0x92, 0xF1, 0x20, 0xE6, 0x66, 0xE0, 0xDF, 0xFE, 0x1F,
-    0xD2, 0x8B, 0x01, 0xCF, 0xED, 0x49, 0xC9, 0x68, 0x3D, 0x18, 0x31, 0xB3, 0xFF, 0xEF, 0x9F, 0x3F,
-    0x6B, 0xC0, 0x53, 0xC4, 0x32, 0xF4, 0xB9, 0x41, 0x3A, 0xBD, 0xAA, 0x81, 0xA0, 0x77, 0xA4, 0x03,
-    0x98, 0xC2, 0xCB, 0x52, 0xF9, 0x07, 0xFD, 0x58, 0x50, 0xB5, 0xAF, 0xA9, 0x7F, 0x81, 0xAF, 0x82,
-    0xE6, 0x59, 0x73, 0x61, 0xA6, 0x77, 0xFC, 0xFB, 0xE2, 0xCC, 0xEA, 0x86, 0x7F, 0xC3, 0xF8, 0xD4,
-    0xAF, 0xE2, 0xCF, 0xC8, 0x87, 0xD7, 0xED, 0x03, 0xA8, 0xE5, 0xA0, 0xF3, 0xA6, 0xB9, 0xCD, 0xE4,
-    0x6E, 0x18, 0x32, 0x0B, 0xDF, 0xC8, 0x34, 0x04, 0x83, 0x17, 0x74, 0xE0, 0x8D, 0xB5, 0x91, 0xF1,
-    0x5E, 0x8B, 0x91, 0x86, 0x31, 0xF3, 0x9D, 0xBF, 0x8E, 0x6F, 0x22, 0xBF, 0xEC, 0x57, 0x6A, 0x25,
-    0x48, 0x6F, 0x3E, 0xEE, 0xF9, 0xE2, 0xFB, 0x84, 0xA1, 0x68, 0x22, 0x66, 0xF7, 0x97, 0x32, 0x4F,
-    0xB3, 0x89, 0xD3, 0xE9, 0x49, 0x1C, 0x5B, 0xAC, 0xDC, 0xBD, 0xD2, 0xE0, 0x21, 0x05, 0x2E, 0xEB,
-    0xBE, 0x00, 0x56, 0x38, 0xF3, 0x88, 0xC8, 0x5F, 0x57, 0x18, 0xB0, 0x01, 0x1B, 0x9D, 0xF6, 0xF5,
-    0x41, 0xE1, 0x18, 0xD3, 0x83, 0x41, 0xA0, 0x76, 0x04, 0xDF, 0x20, 0x7F, 0x19, 0x2C, 0x03, 0x18,
-    0xBE, 0xCE, 0xA8, 0x06, 0x1D, 0xA6, 0x02, 0x0E, 0xC0, 0x85, 0x0A, 0xF8, 0xA8, 0x8D, 0x96, 0xE4,
-    0x36, 0x98, 0x78, 0x68, 0xAE, 0x42, 0xEB, 0xBD, 0x04, 0x0D, 0x1F, 0xAD, 0xC5, 0x4B, 0x10, 0xF7,
-    0x0F, 0x96, 0x62, 0xA2, 0x10, 0x50, 0x0D, 0xAE, 0x09, 0xE5, 0x7F, 0xD0, 0x85, 0x9D, 0x87, 0xA0,
-    0x8C, 0x09, 0xB5, 0x6E, 0x5D, 0x40, 0x75, 0x80, 0xB9, 0xFB, 0x23, 0xBD, 0xD3, 0x51, 0xA2, 0x0B,
-    0x11, 0xA4, 0x91, 0x1E, 0x93, 0xFE, 0x77, 0x8F, 0x5D, 0xFE, 0x17, 0x57, 0xDF, 0x55, 0xDB, 0xF4,
-    0x60, 0x67, 0x2A, 0x8E, 0x74, 0xA8, 0xC0, 0x29, 0xD5, 0x93, 0x64, 0x93, 0x45, 0xD0, 0xEA, 0x3D,
-    0x4D, 0xF8, 0x02, 0x41, 0xDA, 0x2A, 0x72, 0xD3, 0x5F, 0x72, 0xB2, 0x60, 0xB1, 0xBE, 0xCD, 0x4D,
-    0x7F, 0xAD, 0x07, 0x1C, 0x9A, 0x0B, 0xF2, 0x18, 0x06, 0x9A, 0x25, 0x64, 0xEF, 0xF0, 0xD3, 0x3F,
-    0x89, 0xCF, 0x64, 0xD9, 0xD3, 0x52, 0x83, 0xC6, 0xB2, 0x1B, 0x64, 0xA5, 0xBD, 0x3C, 0xB0, 0x86,
-    0xD4, 0x48, 0xD7, 0x86, 0x7C, 0xFA, 0x80, 0x97, 0xB1, 0xC5, 0x9C, 0x56, 0xCA, 0x7C, 0xD1, 0x51,
-    0xFA, 0x66, 0xCA, 0x73, 0x53, 0x63, 0xDC, 0x74, 0x84, 0xB4, 0xEC, 0xA4, 0x10, 0xF3, 0x1E, 0x77,
-    0x81, 0x20, 0x72, 0x35, 0x20, 0x0F, 0xE9, 0x84, 0xBB, 0x4E, 0x02, 0x66, 0x03, 0x60, 0x0C, 0x00,
-    0x3A, 0xF9, 0x42, 0xB0, 0xEA, 0x4B, 0x83, 0x7E, 0x62, 0x80, 0x89, 0x28, 0x22, 0x17, 0x6C, 0x2D,
-    0xB6, 0xBF, 0xA0, 0x02, 0x68, 0x4C, 0x2D, 0x0A, 0x01, 0x1E, 0x1C, 0x37, 0x75, 0xD8, 0xF9, 0x35,
-    0x83, 0x73, 0xB1, 0xFA, 0xE2, 0x66, 0x07, 0x82, 0x36, 0x4D, 0x8B, 0xC5, 0xF8, 0xA2, 0x4D, 0x26,
-    0xBF, 0x54, 0x75, 0x3A, 0xFA, 0xA9, 0x01, 0x98, 0xF0, 0x03, 0xAC, 0xC3, 0xE0, 0x5F, 0xF5, 0x98,
-    0x8A, 0x7F, 0x01, 0x4A, 0xA0, 0xBB, 0x82, 0xC9, 0x60, 0x26, 0x34, 0x10, 0x2D, 0x75, 0xD0, 0x63,
-    0xA5, 0x3B, 0xF9, 0x13, 0x29, 0x2F, 0x88, 0x2E, 0x36, 0x13, 0xDF, 0x24, 0xFA, 0xC4, 0x36, 0x13,
-    0x40, 0x8F, 0xFC, 0x11, 0x3A, 0x24, 0x25, 0x59, 0x08, 0xCE, 0xC0, 0x9F, 0x80, 0xAE, 0x50, 0x6A,
-    0xDC, 0xBD, 0x8E, 0x3F, 0x82, 0x48, 0x0D, 0x38, 0xEB, 0x17, 0xE7, 0xB9, 0x71, 0x14, 0x3F, 0xA9,
-    0x96, 0xDA, 0x3E, 0xE5, 0xA7, 0x95, 0xA9, 0x44, 0x0D, 0x46, 0x11, 0x1C, 0x03, 0x68, 0x82, 0xDD,
-    0x26, 0x6F, 0xC3, 0x3E, 0x4D, 0x66, 0x64, 0x76, 0xCD, 0x64, 0xB2, 0xDB, 0x09, 0x78, 0x70, 0xA7,
-    0xFD, 0x7F, 0xA7, 0x77, 0xB1, 0x92, 0x22, 0x50, 0x8E, 0xA0, 0x13, 0xF7, 0xBF, 0xEA, 0xA8, 0x21,
-    0xD2, 0x91, 0x1A, 0x14, 0x73, 0x6C, 0x88, 0x6F, 0x4A, 0xAA, 0xD4, 0x8A, 0x7A, 0x0E, 0xF3, 0xE4,
-    0x2E, 0xA4, 0x53, 0x24, 0xFE, 0x70, 0xD2, 0x9D, 0x9C, 0x67, 0x44, 0x0F, 0xEC, 0xF2, 0x23, 0xBE,
-    0xD3, 0x9C, 0x06, 0x59, 0xA3, 0x51, 0x90, 0x6E, 0x92, 0x5E, 0x9A, 0x9C, 0xF9, 0x43, 0x98, 0x87,
-    0xBF, 0x7C, 0x27, 0x10, 0xC8, 0xA9, 0x46, 0x8A, 0xF0, 0x31, 0xB9, 0xEA, 0x47, 0x8F, 0x60, 0x1B,
-    0x4A, 0x60, 0x47, 0x1A, 0x64, 0xEC, 0x31, 0xF0, 0x2C, 0xE6, 0x88, 0x2D, 0x30, 0xB3, 0x0D, 0x0B,
-    0x3D, 0xD3, 0x18, 0xD3, 0x70, 0xA7, 0xBC, 0x33, 0xE5, 0x9D, 0x19, 0xEF, 0x2C, 0x78, 0x67, 0xD1,
-    0x89, 0xFE, 0x94, 0x9A, 0x56, 0xD4, 0x27, 0xF1, 0x37, 0xD8, 0xDD, 0x07, 0x01, 0x14, 0xE6, 0xDE,
-    0x8F, 0xB0, 0x7E, 0x7C, 0x63, 0xCD, 0xA1, 0x68, 0xE1, 0xF1, 0xBE, 0xE2, 0x37, 0x57, 0x05, 0x51,
-    0x57, 0xE9, 0xB9, 0xE0, 0xCB, 0x8A, 0x5E, 0x15, 0xCD, 0x93, 0x7C, 0x0A, 0x01, 0x7F, 0x39, 0x63,
-    0x06, 0x71, 0xC4, 0xFF, 0x14, 0x1B, 0x73, 0x1D, 0xD3, 0xF5, 0xF8, 0xF2, 0x4E, 0x7A, 0x73, 0xE4,
-    0x7A, 0xC3, 0xFB, 0xA6, 0x9F, 0x2B, 0x7F, 0x1B, 0x3E, 0x16, 0x1F, 0x8E, 0xF5, 0x70, 0x33, 0x6C,
-    0xD6, 0x4B, 0x1E, 0x8C, 0x79, 0x2A, 0x72, 0x46, 0xA1, 0xBD, 0xA5, 0x6A, 0xDD, 0xC1, 0x91, 0xF3,
-    0xBF, 0x79, 0xA4, 0x23, 0x7D, 0xB9, 0xD5, 0xF6, 0xAE, 0x83, 0xCB, 0x69, 0xB1, 0x0C, 0x9A, 0x69,
-    0xD8, 0x18, 0x7C, 0xDD, 0x0D, 0x52, 0x9B, 0x01, 0x91, 0x29, 0x15, 0x94, 0x34, 0x34, 0x3D, 0x6D,
-    0xB6, 0x54, 0x0B, 0xD4, 0xF0, 0xF2, 0x85, 0x68, 0x5A, 0xC5, 0x04, 0x5A, 0xE4, 0x8E, 0x93, 0x8B,
-    0x6C, 0xDA, 0xC1, 0xEB, 0x21, 0xBF, 0x99, 0xAF, 0xDD, 0xD0, 0x7C, 0x01, 0xD8, 0xAF, 0x74, 0x22,
-    0x0A, 0xDA, 0x4E, 0xC9, 0x69, 0xBC, 0xEE, 0x69, 0x5B, 0x5F, 0x24, 0x5C, 0xFE, 0x1D, 0x81, 0x72,
-    0x70, 0x55, 0xB5, 0xF3, 0xE5, 0x01, 0xFD, 0x74, 0xDB, 0x88, 0xE9, 0x81, 0xC2, 0x44, 0xD8, 0x7B,
-    0x2A, 0x91, 0xC8, 0x1E, 0x11, 0x9E, 0x9E, 0x0E, 0x1E, 0x8B, 0x0B, 0x16, 0x66, 0x21, 0x05, 0xD6,
-    0xFD, 0x54, 0xB4, 0xD7, 0x0A, 0xAC, 0xED, 0xFD, 0x21, 0x1D, 0x93, 0x97, 0xDB, 0xA2, 0x2D, 0xF2,
-    0x6F, 0xFA, 0xFD, 0x44, 0x27, 0xFB, 0x55, 0x92, 0x41, 0x8E, 0x76, 0xA4, 0x9D, 0xBC, 0xD3, 0xF9,
-    0x2F, 0x0E, 0xCE, 0xBF, 0x74, 0x97, 0x9C, 0x23, 0x61, 0xAD, 0x8E, 0xD3, 0x20, 0x51, 0x20, 0xF9,
-    0x54, 0x65, 0xAB, 0x50, 0x45, 0x31, 0x18, 0xDC, 0xB8, 0x2A, 0x92, 0x19, 0x3C, 0x97, 0x32, 0x04,
-    0x25, 0xA4, 0xEC, 0x35, 0x45, 0x4C, 0xBC, 0xD6, 0x7B, 0x66, 0x63, 0xBC, 0xCE, 0xEC, 0xA5, 0x79,
-    0x7D, 0x1A, 0xF0, 0xB7, 0xBC, 0xA1, 0x98, 0x0B, 0xB9, 0xEC, 0x91, 0x67, 0x24, 0xA8, 0xCD, 0x88,
-    0x27, 0x46, 0xEE, 0x73, 0xBE, 0xD2, 0x86, 0x00, 0xA9, 0xD4, 0xBB, 0x9F, 0x80, 0xB2, 0x69, 0x07,
-    0xA0, 0x0A, 0x48, 0xD6, 0xD1, 0xB7, 0x01, 0xAF, 0x9A, 0xCF, 0xD7, 0xD3, 0xE3, 0x03, 0xFF, 0x47,
-    0xE4, 0x61, 0xC8, 0x0A, 0xA4, 0xBD, 0x4E, 0xF4, 0x5F, 0x2B, 0x8C, 0x0A, 0x5D, 0x35, 0xDA, 0x7F,
-    0x13, 0xA6, 0x2E, 0xAC, 0x68, 0xD1, 0x1C, 0x50, 0x22, 0x37, 0xCB, 0x1C, 0x4F, 0x5B, 0xDC, 0x8B,
-    0x3F, 0x51, 0x54, 0xCE, 0xBA, 0x7B, 0x01, 0xD4, 0xE6, 0x18, 0xEE, 0xE4, 0x1E, 0x5E, 0x54, 0x0A,
-    0xFF, 0x29, 0x2D, 0xF7, 0x43, 0xEE, 0x92, 0xE1, 0x0C, 0x46, 0xFE, 0x06, 0xE8, 0x72, 0x09, 0x80,
-    0xAA, 0x32, 0x94, 0x43, 0xE4, 0x56, 0xEE, 0xD7, 0x22, 0x84, 0x6B, 0x2E, 0x05, 0xA7, 0x69, 0x36,
-    0x87, 0x12, 0x80, 0x67, 0x77, 0xCE, 0xF9, 0x68, 0xE1, 0x8C, 0x61, 0x59, 0x4A, 0x18, 0xAD, 0xEF,
-    0x61, 0x05, 0x0F, 0x2C, 0x00, 0x97, 0x70, 0x0F, 0x39, 0xEB, 0xE2, 0x3A, 0x36, 0xB0, 0x5E, 0x93,
-    0x01, 0xF6, 0x67, 0xE4, 0x85, 0xBC, 0xE5, 0x05, 0x0F, 0x8F, 0x6D, 0x89, 0xA7, 0x1C, 0x2B, 0xC9,
-    0x5A, 0xAE, 0xA1, 0x81, 0x1F, 0xB7, 0xC6, 0x53, 0x86, 0x35, 0xA5, 0x5D, 0x23, 0xB0, 0x35, 0x49,
-    0xCD, 0x74, 0x16, 0xA8, 0xCA, 0x37, 0x7C, 0xA2, 0x0D, 0x79, 0xE0, 0xE9, 0xC3, 0x90, 0x43, 0xF1,
-    0x02, 0x87, 0x5C, 0x35, 0xE4, 0x78, 0xE7, 0x90, 0x33, 0x86, 0x6C, 0x39, 0x24, 0x46, 0xC0, 0x90,
-    0x50, 0x08, 0x1C, 0x32, 0x19, 0x32, 0x8E, 0x50, 0x37, 0xA0, 0xCE, 0x82, 0xB7, 0x74, 0xFB, 0x21,
-    0xED, 0x2A, 0x8D, 0x60, 0x61, 0x13, 0x2F, 0x2D, 0x37, 0xEA, 0x42, 0x0B, 0x39, 0xFB, 0xF6, 0xE2,
-    0x36, 0xCE, 0xB5, 0x58, 0x4F, 0xBC, 0xCD, 0xA4, 0x50, 0x94, 0x0D, 0x66, 0x4F, 0x26, 0x31, 0x0F,
-    0x9E, 0x25, 0xDD, 0x4D, 0xF9, 0x99, 0x7E, 0xAD, 0x85, 0x6F, 0x00, 0x98, 0xDA, 0xA4, 0xC7, 0x0C,
-    0x47, 0x05, 0x00, 0x60, 0x96, 0xF1, 0x9E, 0xE2, 0x6D, 0x4F, 0x84, 0xDC, 0xEF, 0x8D, 0x71, 0x8F,
-    0xA9, 0xCD, 0xC4, 0x80, 0x72, 0x61, 0xE0, 0xC2, 0x97, 0x27, 0x6B, 0x0D, 0x59, 0xC8, 0x47, 0x75,
-    0x93, 0x66, 0xB1, 0xEF, 0x24, 0xE5, 0x85, 0x4D, 0x8C, 0xF3, 0xA9, 0x6A, 0x7A, 0x24, 0x40, 0xAD,
-    0x79, 0xAD, 0x6B, 0x1A, 0x9C, 0xA6, 0xA4, 0x05, 0xBB, 0x6B, 0x06, 0x93, 0x7B, 0x9E, 0x10, 0xA3,
-    0xD3, 0x34, 0xA0, 0x13, 0x41, 0x9A, 0x64, 0x16, 0xE2, 0x2D, 0x86, 0x78, 0xBD, 0x4A, 0x7D, 0xAF,
-    0x09, 0x51, 0xE4, 0x40, 0xB1, 0x51, 0xB3, 0x32, 0x30, 0x18, 0x35, 0x61, 0x6E, 0xB3, 0x45, 0xEF,
-    0x32, 0x88, 0xCA, 0x35, 0x5B, 0x29, 0x57, 0xFC, 0x3C, 0x19, 0xFF, 0x96, 0x44, 0x00, 0x9C, 0x13,
-    0x4D, 0x46, 0xD5, 0xC2, 0x15, 0xD7, 0xE7, 0x68, 0x4D, 0x6F, 0x35, 0x23, 0xF6, 0xF3, 0x09, 0xEC,
-    0x68, 0x02, 0x87, 0xE1, 0xB8, 0xF6, 0x3C, 0x6D, 0x2A, 0xC2, 0xB7, 0x21, 0x5A, 0x9B, 0x7C, 0x48,
-    0xC1, 0x22, 0x7C, 0x83, 0xFA, 0xA6, 0x02, 0x2B, 0x42, 0x44, 0x94, 0x1A, 0x48, 0x1A, 0x9B, 0xDB,
-    0x34, 0x85, 0x78, 0xEC, 0x86, 0xA9, 0x12, 0x02, 0xB1, 0x5D, 0x13, 0x38, 0x25, 0x93, 0x6D, 0xAA,
-    0xA4, 0x31, 0xC5, 0x45, 0x3B, 0x05, 0xC1, 0xDC, 0xC7, 0x2C, 0x13, 0x3C, 0xB6, 0xD3, 0x50, 0xDE,
-    0x95, 0xDC, 0xF5, 0xE7, 0x64, 0x3B, 0xE7, 0x6C, 0xBD, 0x0A, 0x2F, 0xA7, 0xE8, 0x21, 0x67, 0x53,
-    0x05, 0x97, 0x26, 0x1A, 0x81, 0x2F, 0x86, 0x98, 0xF0, 0x7B, 0x20, 0x2C, 0xDB, 0xF7, 0xC4, 0x37,
-    0x49, 0x97, 0x60, 0x88, 0xB4, 0x23, 0x92, 0x04, 0x0B, 0xFF, 0x00, 0xC3, 0xD5, 0xD9, 0xB7, 0x66,
-    0x58, 0xCD, 0x5C, 0xC6, 0xF7, 0xCC, 0x9E, 0xCC, 0xFA, 0x0D, 0xF9, 0x1D, 0x17, 0xE5, 0x20, 0x5D,
-    0x73, 0xF9, 0x87, 0xC7, 0xE2, 0x63, 0x8D, 0x0F, 0xCB, 0x4E, 0x64, 0xA9, 0x86, 0x68, 0x22, 0x29,
-    0x17, 0xE2, 0xDF, 0x8A, 0xEE, 0x09, 0x55, 0x6C, 0xCD, 0x20, 0xDD, 0x18, 0xCB, 0xC0, 0x2E, 0x1B,
-    0x80, 0x0A, 0x21, 0x6D, 0xC0, 0x89, 0xB1, 0xA2, 0xF6, 0x82, 0x52, 0x4B, 0x66, 0x82, 0x5D, 0x60,
-    0x22, 0x80, 0x87, 0xBA, 0x82, 0xA1, 0xEC, 0xA0, 0xA2, 0xFC, 0x00, 0x33, 0xD5, 0x40, 0x17, 0x1C,
-    0x27, 0xF7, 0x49, 0x45, 0x38, 0x89, 0x9B, 0x17, 0xB7, 0xEE, 0x21, 0x0B, 0x10, 0x10, 0xC6, 0x71,
-    0xA0, 0x76, 0xD2, 0x36, 0x9A, 0x32, 0x38, 0xEB, 0xB9, 0x8B, 0x47, 0xB8, 0x84, 0x03, 0x98, 0x73,
-    0xC0, 0x9E, 0x0D, 0x0C, 0x88, 0xA6, 0x62, 0xD0, 0x63, 0x01, 0xD3, 0xBF, 0xE0, 0xBB, 0x14, 0xD0,
-    0xEC, 0xA9, 0xA1, 0x5B, 0x8B, 0x0E, 0x17, 0xEB, 0x62, 0x8A, 0x36, 0x58, 0x20, 0x00, 0xA3, 0x3D,
-    0x09, 0x20, 0xE7, 0x45, 0x51, 0xE9, 0x6C, 0x85, 0xCD, 0x83, 0x2F, 0x45, 0x30, 0x15, 0x89, 0x11,
-    0x69, 0xCF, 0x09, 0xD4, 0x6E, 0x01, 0xBE, 0x28, 0xD0, 0xA3, 0x05, 0x9A, 0x0D, 0x69, 0xE8, 0xCC,
-    0x35, 0x2B, 0x5D, 0xD2, 0x3A, 0x7D, 0xB5, 0x02, 0x61, 0xAE, 0x45, 0x63, 0x3C, 0xA4, 0x6D, 0x0E,
-    0x5D, 0x37, 0x91, 0xAA, 0xE9, 0xDB, 0x57, 0xDB, 0xC2, 0xE5, 0x0F, 0xCC, 0x6E, 0x49, 0x6E, 0x69,
-    0xBE, 0x35, 0xFD, 0x63, 0xF1, 0x98, 0x7C, 0x33, 0x4F, 0x9D, 0xEB, 0x07, 0x06, 0x88, 0x65, 0x11,
-    0xFD, 0x47, 0xC2, 0x92, 0xFB, 0x25, 0x78, 0x96, 0x9C, 0x36, 0xC5, 0x8D, 0xB1, 0xB3, 0xE4, 0x28,
-    0x2C, 0x44, 0xF1, 0xDE, 0xD9, 0x02, 0x69, 0x57, 0x1E, 0x86, 0x53, 0xC8, 0xB0, 0x45, 0xDA, 0xE3,
-    0x99, 0x0A, 0x48, 0x1E, 0xC8, 0xBC, 0xE3, 0x4F, 0xA5, 0xF3, 0x0C, 0x1C, 0x4C, 0xD8, 0xB1, 0xA6,
-    0xAD, 0xE4, 0xA6, 0xF7, 0x9B, 0x1E, 0x99, 0x14, 0x3D, 0x00, 0x1F, 0xD3, 0xE9, 0x4C, 0x86, 0x03,
-    0x07, 0x10, 0x5A, 0xD1, 0xB0, 0x37, 0x40, 0x3D, 0xBB, 0x31, 0x9A, 0x4F, 0x3C, 0xCF, 0x39, 0xD7,
-    0x74, 0x8B, 0x09, 0x94, 0xB2, 0xF5, 0xA7, 0x67, 0x13, 0x93, 0x67, 0x50, 0xE1, 0xAD, 0x7D, 0xC7,
-    0x85, 0xC4, 0x06, 0xA3, 0x56, 0x3C, 0xFE, 0x96, 0xDB, 0x5D, 0xA9, 0xAF, 0x94, 0xF7, 0xD7, 0x8F,
-    0x5D, 0x4E, 0x97, 0x04, 0x02, 0x97, 0x11, 0x5F, 0x56, 0x75, 0xF3, 0x20, 0x7E, 0xEB, 0xBF, 0x0F,
-    0xDD, 0x88, 0x1D, 0x4B, 0xE6, 0xEA, 0xFA, 0xC2, 0x75, 0x15, 0xEF, 0xCD, 0xC5, 0x2B, 0x13, 0x0D,
-    0x56, 0xF3, 0xD2, 0x6D, 0xF3, 0xD4, 0xE6, 0xC6, 0xA0, 0x88, 0x7F, 0xC3, 0x5B, 0x54, 0x54, 0x72,
-    0xE5, 0x42, 0xFE, 0xC0, 0x6D, 0xB0, 0x4E, 0xBF, 0xD0, 0x1D, 0x8D, 0xF4, 0x23, 0x9F, 0xC8, 0xD7,
-    0x8A, 0xFE, 0x33, 0x7C, 0xCB, 0x9F, 0x53, 0x18, 0xC0, 0x25, 0x73, 0x4A, 0x3D, 0x06, 0x46, 0x84,
-    0x5F, 0x56, 0xBB, 0x0B, 0x00, 0xB3, 0xD3, 0xAE, 0xFC, 0xBA, 0x73, 0x5F, 0x77, 0x27, 0x60, 0xEF,
-    0xF0, 0x63, 0x47, 0xFE, 0x8E, 0x86, 0xCF, 0x3F, 0x0A, 0xCB, 0x04, 0xC3, 0x52, 0x53, 0x1A, 0xE0,
-    0xD3, 0xF4, 0x29, 0x6C, 0xEF, 0x0E, 0xE2, 0xDB, 0xE6, 0x75, 0x35, 0xC7, 0xA0, 0x55, 0x5D, 0x3D,
-    0x08, 0x35, 0x31, 0xF8, 0xAA, 0xF4, 0xC5, 0x2F, 0x87, 0xF4, 0xE6, 0x08, 0x3F, 0x60, 0x4D, 0xF1,
-    0xD4, 0x13, 0x80, 0xEE, 0x3D, 0xCC, 0xFE, 0x1C, 0x83, 0xAB, 0x21, 0x6F, 0x80, 0x7F, 0xC7, 0x03,
-    0x9D, 0xCB, 0x6E, 0x31, 0xE6, 0xA1, 0xEF, 0x45, 0x79, 0x75, 0x27, 0x9F, 0x09, 0xF1, 0x98, 0x16,
-    0x80, 0x62, 0x86, 0x64, 0xA5, 0x75, 0x55, 0xEF, 0x46, 0x7A, 0x0D, 0x31, 0x85, 0x1A, 0x7B, 0x7B,
-    0x86, 0x76, 0xF8, 0xE5, 0x37, 0x3A, 0xB7, 0xBC, 0x4F, 0x4C, 0xCD, 0xB0, 0xE5, 0x8B, 0xF8, 0xF5,
-    0xD0, 0x80, 0x5D, 0xB0, 0x97, 0xD5, 0x13, 0x72, 0x7A, 0x06, 0xE8, 0xA3, 0xB1, 0x29, 0x77, 0x73,
-    0x53, 0xBA, 0xA5, 0x02, 0xA3, 0xE3, 0xFF, 0x5C, 0xC2, 0x58, 0x62, 0xF1, 0xA5, 0x30, 0x9E, 0x90,
-    0x80, 0xE0, 0xDA, 0x05, 0x38, 0x73, 0x2F, 0xFA, 0x36, 0xED, 0xAB, 0xD9, 0xA2, 0x5A, 0x15, 0x04,
-    0xF3, 0xD6, 0xF3, 0x2E, 0x7D, 0x01, 0xF0, 0x09, 0x62, 0x36, 0xC2, 0xCC, 0x5E, 0x1F, 0xDD, 0x19,
-    0x7E, 0x0B, 0x49, 0xBB, 0x3E, 0xB9, 0x4B, 0x50, 0x27, 0xA3, 0x74, 0xE5, 0xEE, 0xE9, 0x93, 0x97,
-    0x37, 0xD5, 0xB4, 0x3B, 0x0B, 0xDB, 0x9E, 0xF5, 0x50, 0xD0, 0x74, 0x6F, 0xA8, 0xE2, 0xDA, 0x6A,
-    0x48, 0x98, 0x48, 0x29, 0x96, 0x7C, 0x71, 0xB7, 0x3F, 0x04, 0x5F, 0xDF, 0xBC, 0x79, 0xB3, 0x2D,
-    0xAA, 0xB5, 0x71, 0xB3, 0x7F, 0x6F, 0xDA, 0xBF, 0xEB, 0x7F, 0xDC, 0x15, 0x2F, 0xCF, 0x8D, 0x5B,
-    0xB3, 0xD7, 0x60, 0xF9, 0xAA, 0xAC, 0xCF, 0xDB, 0xB3, 0x9B, 0x02, 0xC8, 0x98, 0x98, 0xC9, 0x6B,
-    0xA8, 0x93, 0xA2, 0x84, 0x6A, 0xAD, 0xC8, 0x8A, 0x0D, 0x75, 0x2B, 0x93, 0x37, 0xA0, 0x5D, 0x4E,
-    0xEC, 0x21, 0x73, 0x61, 0xA1, 0xAE, 0x3A, 0xD9, 0xDC, 0x0E, 0xB9, 0xD0, 0x10, 0x99, 0x38, 0x80,
-    0x6F, 0x30, 0xDF, 0x65, 0x89, 0x28, 0x35, 0x26, 0xE0, 0x1F, 0xBD, 0xB3, 0x46, 0x3A, 0x0B, 0x10,
-    0x11, 0x36, 0x1F, 0xBA, 0xBF, 0xDF, 0x11, 0x15, 0x7A, 0xFA, 0x70, 0x44, 0x12, 0x32, 0x73, 0xB1,
-    0xC5, 0x2C, 0x7A, 0x83, 0xC0, 0xE4, 0x29, 0x2A, 0x06, 0xE1, 0x65, 0x02, 0x7F, 0x01, 0x75, 0x98,
-    0xB0, 0x51, 0x81, 0x39, 0xAF, 0x40, 0xCD, 0x6E, 0x25, 0xDA, 0xEC, 0x18, 0x5F, 0xC1, 0xAF, 0xAB,
-    0x96, 0x48, 0x87, 0xD1, 0xB1, 0xB2, 0xA9, 0xD3, 0x83, 0xC3, 0xC7, 0xD4, 0x5B, 0xF2, 0x81, 0x45,
-    0xE5, 0x05, 0xFD, 0xFF, 0x37, 0xD8, 0x02, 0x2F, 0xAF, 0xE9, 0xF8, 0x5C, 0xA3, 0x78, 0xC3, 0x40,
-    0x41, 0x06, 0x26, 0xAA, 0x00, 0x98, 0x2D, 0x78, 0x40, 0x50, 0x33, 0xAB, 0xA2, 0x91, 0xDC, 0xB0,
-    0xDC, 0x8B, 0x61, 0x42, 0xC2, 0x10, 0xBB, 0x3A, 0x3E, 0x56, 0x86, 0x94, 0x80, 0x0C, 0xB0, 0x05,
-    0x64, 0x25, 0x2B, 0xF4, 0x90, 0x42, 0x4C, 0xF2, 0xB8, 0x0D, 0xC3, 0x6B, 0xFD, 0x40, 0xD7, 0xD8,
-    0x5F, 0x3E, 0xAB, 0x38, 0x92, 0x52, 0x69, 0xF0, 0x38, 0x18, 0x7D, 0xCB, 0x19, 0xD2, 0xD9, 0xB9,
-    0xEC, 0x16, 0xD1, 0x0C, 0x2D, 0x94, 0x82, 0x07, 0x86, 0xDB, 0x89, 0xD8, 0xE7, 0x73, 0x59, 0x7B,
-    0x2F, 0xF5, 0xBD, 0x32, 0x20, 0x50, 0x13, 0xCA, 0x86, 0x78, 0x53, 0x56, 0x9C, 0x24, 0x29, 0x1E,
-    0x2F, 0x36, 0x8F, 0xE4, 0x80, 0x3B, 0x42, 0x3C, 0xB3, 0x11, 0x06, 0x80, 0xC5, 0xAC, 0xF1, 0x86,
-    0x6C, 0x60, 0x40, 0x8B, 0x8C, 0xEB, 0xFC, 0xF7, 0x99, 0xAB, 0x78, 0x6F, 0xA2, 0x95, 0x99, 0x0F,
-    0xE0, 0xDA, 0xF0, 0x7C, 0x19, 0x22, 0x66, 0x96, 0x04, 0x55, 0x92, 0x91, 0x5E, 0xC1, 0x09, 0xA6,
-    0x37, 0xE4, 0xB6, 0x53, 0x2F, 0xE1, 0x96, 0x69, 0xF3, 0x4E, 0x68, 0xFE, 0xF9, 0xFF, 0xA9, 0xE6,
-    0xA7, 0x0A, 0xF5, 0x2C, 0x82, 0x4A, 0xC3, 0x7E, 0x49, 0x5B, 0x48, 0xE9, 0x6E, 0x26, 0xA6, 0x2A,
-    0xEA, 0xE2, 0xC9, 0x29, 0x86, 0xB5, 0x2A, 0xC0, 0x5A, 0xD5, 0x83, 0x43, 0x82, 0xED, 0x2B, 0x4A,
-    0xA0, 0xF2, 0x78, 0x79, 0xF4, 0x1F, 0x7C, 0x97, 0x6F, 0x70, 0x6E, 0xA1, 0xED, 0xD3, 0x64, 0xCA,
-    0x2D, 0x84, 0x6A, 0x79, 0xC7, 0x54, 0x4A, 0xE8, 0x58, 0x44, 0x9E, 0x21, 0x12, 0xA2, 0x1E, 0x62,
-    0x66, 0x46, 0x8D, 0xB3, 0x5E, 0x3E, 0xA9, 0x85, 0x57, 0x18, 0xD3, 0x32, 0x3F, 0x45, 0xAB, 0x11,
-    0x62, 0x9F, 0xE5, 0x2E, 0x30, 0x3F, 0x09, 0x5F, 0x2D, 0xF6, 0x0F, 0xAD, 0xFC, 0x2D, 0x7D, 0xE9,
-    0x52, 0x6E, 0x9B, 0xA1, 0x05, 0x02, 0x4E, 0x85, 0xA2, 0x8B, 0x3A, 0xEF, 0xF6, 0x4C, 0xAE, 0x34,
-    0x82, 0xD3, 0x90, 0x8B, 0x55, 0x08, 0x3C, 0x61, 0x9E, 0x85, 0xCC, 0x4C, 0x4C, 0xBE, 0x23, 0x53,
-    0x72, 0xEE, 0x4A, 0xA2, 0x16, 0x21, 0xFE, 0xD7, 0x86, 0x18, 0x6F, 0x08, 0xB2, 0xEE, 0xDC, 0xBD,
-    0x5F, 0x8D, 0xBA, 0x21, 0xDD, 0x97, 0x17, 0xBF, 0x1E, 0xF5, 0x7D, 0xF6, 0xD0, 0xF5, 0x39, 0xE3,
-    0xCD, 0xED, 0x97, 0xBF, 0xE6, 0x1C, 0x58, 0xAB, 0x25, 0x2E, 0xF4, 0xBB, 0x73, 0x69, 0x2F, 0x68,
-    0x0A, 0x94, 0x3B, 0xE7, 0x6D, 0xDE, 0x55, 0x0F, 0xCE, 0x86, 0x91, 0x8B, 0x16, 0xC8, 0x74, 0x3F,
-    0xA5, 0x7D, 0x43, 0xE4, 0x4C, 0xC2, 0x11, 0x11, 0x7B, 0xD8, 0xE4, 0x0E, 0x78, 0xFA, 0x09, 0x68,
-    0xAE, 0x78, 0xCC, 0x15, 0x72, 0x9C, 0x84, 0x4B, 0x4B, 0x42, 0x9B, 0x21, 0xB1, 0x90, 0xDB, 0x9F,
-    0xE4, 0xBD, 0xFE, 0x49, 0xE1, 0x5D, 0xBE, 0xD7, 0x27, 0x3E, 0x40, 0x2B, 0xC3, 0xB8, 0x82, 0xBB,
-    0xF2, 0x1C, 0x69, 0xB0, 0x19, 0x52, 0x82, 0x79, 0xC6, 0xAF, 0xB1, 0x71, 0x17, 0x05, 0x78, 0x53,
-    0xC6, 0x04, 0x96, 0xDD, 0x90, 0xD5, 0xD7, 0xE2, 0xFE, 0x0C, 0x9C, 0x89, 0x9B, 0x73, 0x42, 0x43,
-    0xB0, 0x91, 0xDC, 0x7D, 0x4D, 0xE9, 0xB7, 0x7E, 0x07, 0x3D, 0x39, 0xEE, 0x7A, 0x02, 0xC8, 0x91,
-    0x8E, 0x04, 0x8C, 0x43, 0x5E, 0x66, 0x44, 0x8F, 0x49, 0x2B, 0x6C, 0x05, 0xC0, 0x45, 0xB7, 0xF1,
-    0x39, 0x77, 0x31, 0xE9, 0x8A, 0xF2, 0xCC, 0x6E, 0x04, 0x3C, 0x2D, 0xB1, 0x90, 0xFD, 0x0D, 0x2C,
-    0x0C, 0xF4, 0xC7, 0xA6, 0x60, 0xC1, 0x55, 0x19, 0x12, 0xC6, 0x4F, 0x41, 0xAF, 0xBB, 0x8D, 0xC0,
-    0xD9, 0x59, 0x45, 0x76, 0x96, 0x6C, 0x37, 0x5D, 0x8B, 0xDF, 0xEC, 0x8B, 0x87, 0x6F, 0x42, 0xB4,
-    0x5E, 0x0B, 0x73, 0xF8, 0xCA, 0x5B, 0x82, 0xE7, 0x67, 0xCA, 0xC5, 0x95, 0x04, 0xCF, 0x86, 0x59,
-    0xF7, 0xF2, 0x29, 0x66, 0x0B, 0x2D, 0xFA, 0xB8, 0xBE, 0x30, 0xA6, 0x22, 0xED, 0x68, 0x19, 0xD7,
-    0x43, 0x1A, 0xA3, 0x3B, 0x0D, 0x64, 0xC2, 0xE5, 0x5C, 0x2B, 0xFC, 0x18, 0xFF, 0x7A, 0x89, 0xBB,
-    0x14, 0x13, 0xAB, 0x1F, 0x7F, 0xCE, 0x9D, 0x61, 0x60, 0x11, 0x4F, 0x95, 0xFB, 0x96, 0x51, 0xA6,
-    0xDD, 0x07, 0x58, 0x41, 0xF2, 0x30, 0x74, 0xEE, 0xD7, 0x69, 0xA1, 0x87, 0x06, 0x12, 0x02, 0x38,
-    0xE2, 0xBE, 0x7A, 0x10, 0x22, 0x80, 0x19, 0x88, 0xCF, 0x90, 0xD6, 0xC5, 0x0E, 0x38, 0x26, 0x2F,
-    0xF3, 0x6F, 0x8E, 0xD1, 0x98, 0x75, 0x79, 0x6D, 0x3B, 0x8B, 0xAD, 0x80, 0xE6, 0x6C, 0xAE, 0xC3,
-    0x25, 0x29, 0xBA, 0xE2, 0xB5, 0x25, 0x5E, 0xAA, 0xBE, 0xC0, 0xE2, 0x57, 0x4B, 0x2D, 0x08, 0x08,
-    0x58, 0xE2, 0xBB, 0x0B, 0xAE, 0xFA, 0xA7, 0x7F, 0x11, 0x62, 0xC8, 0x11, 0x2F, 0x6E, 0x33, 0x2B,
-    0x00, 0x6F, 0x8F, 0x18, 0xA3, 0xB0, 0xFC, 0xF4, 0x2A, 0x0D, 0x4C, 0x90, 0xA1, 0x0C, 0x46, 0x2E,
-    0x09, 0xBA, 0x9C, 0x95, 0x59, 0x88, 0xEE, 0x50, 0x23, 0xF6, 0xEE, 0xA4, 0x20, 0x73, 0x05, 0x31,
-    0x8D, 0xC0, 0x5B, 0x78, 0x09, 0x85, 0xF1, 0x07, 0xD0, 0xA4, 0x6B, 0xD1, 0x7F, 0xFA, 0xE0, 0x17,
-    0xB6, 0x94, 0x8E, 0xBF, 0x39, 0x68, 0x70, 0xD7, 0xEC, 0x2E, 0xD4, 0x52, 0xB3, 0x79, 0x50, 0x05,
-    0x00, 0x0C, 0xCF, 0x9C, 0x93, 0xE6, 0x93, 0xCA, 0xD3, 0xF0, 0xC2, 0xCD, 0x69, 0x00, 0x82, 0x75,
-    0x18, 0x5F, 0xE9, 0x95, 0xEC, 0x7A, 0xE9, 0xBE, 0x63, 0xBF, 0x04, 0xAC, 0x7F, 0xBF, 0xB4, 0xAB,
-    0xE9, 0xEB, 0x8C, 0x2D, 0x33, 0xE2, 0x28, 0xB3, 0xF5, 0x4D, 0x46, 0x85, 0xE8, 0xD6, 0x38, 0x8A,
-    0x78, 0x06, 0x69, 0xA0, 0x2B, 0x02, 0x5D, 0x53, 0xB5, 0x30, 0x2C, 0x13, 0x64, 0x1D, 0x50, 0x72,
-    0xC8, 0xC6, 0x68, 0x8D, 0x18, 0xF5, 0x2A, 0x86, 0x2F, 0x2D, 0xEE, 0x3B, 0x89, 0xAA, 0x2A, 0x2C,
-    0x58, 0x6D, 0x6A, 0xE4, 0xE4, 0x9D, 0x99, 0x2D, 0x12, 0xE8, 0x5A, 0xF0, 0x7E, 0xAB, 0x4D, 0x75,
-    0x85, 0xFC, 0x6E, 0xA8, 0xA1, 0x68, 0xEF, 0x9A, 0xE8, 0xE6, 0x46, 0x09, 0x51, 0xCE, 0x21, 0x98,
-    0xC2, 0x4D, 0x63, 0x78, 0x21, 0xBF, 0x23, 0x45, 0x1B, 0x29, 0xCB, 0x09, 0xA0, 0xF0, 0xC0, 0x0C,
-    0x85, 0x73, 0x0D, 0xFC, 0x79, 0xAF, 0xD9, 0x89, 0x55, 0xBE, 0x95, 0xFE, 0xBD, 0xF5, 0xA8, 0x60,
-    0x78, 0x6A, 0xD6, 0x19, 0x7B, 0x3B, 0x1E, 0x7F, 0xFE, 0x2D, 0x39, 0xA1, 0xC5, 0x8F, 0xFE, 0x5E,
-    0x73, 0x7C, 0x9C, 0xF3, 0x64, 0x28, 0x43, 0x51, 0xC0, 0x0E, 0xF3, 0x19, 0xAC, 0x48, 0x02, 0x9E,
-    0x42, 0x97, 0x11, 0x8F, 0x52, 0x95, 0xF5, 0x2C, 0xE6, 0x38, 0x79, 0xC8, 0xC9, 0x9C, 0x23, 0x83,
-    0x59, 0xEC, 0x92, 0x09, 0xFF, 0x63, 0x99, 0xC7, 0xFF, 0x25, 0x9F, 0x7F, 0xA6, 0xC7, 0x4F, 0x37,
-    0x65, 0xA4, 0x00, 0x81, 0x23, 0x92, 0x9E, 0x3A, 0x1B, 0x16, 0x47, 0xE1, 0x20, 0x45, 0x88, 0x5A,
-    0x77, 0xA1, 0x76, 0xD1, 0x98, 0x3F, 0xB0, 0x64, 0x9D, 0x87, 0x52, 0x7A, 0x69, 0xCE, 0xDF, 0xF5,
-    0xEE, 0x8E, 0x37, 0x81, 0x76, 0x58, 0x0F, 0x19, 0x6A, 0xD2, 0x6B, 0x0B, 0x49, 0x33, 0xDE, 0x15,
-    0xAB, 0xC8, 0x82, 0xB6, 0x80, 0x00, 0x7B, 0xE0, 0x3C, 0x76, 0xCF, 0xEB, 0xA9, 0xE7, 0x2C, 0xE8,
-    0x10, 0xCD, 0xC7, 0xFC, 0xEE, 0x63, 0x5F, 0x24, 0x4F, 0x16, 0x4C, 0x27, 0x77, 0x86, 0x3B, 0xF4,
-    0xBC, 0x3D, 0xC2, 0x18, 0x05, 0xC7, 0x89, 0x2D, 0xCD, 0xCD, 0x61, 0x2C, 0x93, 0x10, 0x6E, 0xC7,
-    0x36, 0x33, 0x24, 0x93, 0x13, 0xDB, 0xE3, 0xD6, 0x6A, 0xE3, 0x69, 0x32, 0x6E, 0x44, 0x8E, 0x28,
-    0xA0, 0x5B, 0xE2, 0x16, 0xAA, 0xEA, 0xE2, 0x1E, 0x60, 0xBA, 0x86, 0x72, 0xC0, 0x2E, 0x74, 0xD9,
-    0x6E, 0x38, 0x13, 0xF5, 0x5F, 0x8B, 0xFB, 0x6F, 0xC4, 0xDD, 0xA5, 0x7D, 0x7B, 0xE6, 0xC2, 0x0B,
-    0xF0, 0x39, 0x26, 0xB8, 0xF4, 0xCB, 0xFE, 0xC8, 0xC3, 0xFC, 0x02, 0xDF, 0x53, 0xFE, 0x15, 0x34,
-    0x25, 0xF5, 0x93, 0xFB, 0xCF, 0x30, 0xA1, 0x49, 0xE9, 0xCE, 0x38, 0x61, 0x8D, 0x0F, 0x15, 0xD5,
-    0x4B, 0xEA, 0xAF, 0xED, 0xBB, 0x31, 0xEE, 0xBE, 0x91, 0xB9, 0xAF, 0x27, 0x2F, 0x0C, 0xFB, 0xD7,
-    0xE7, 0x33, 0xE0, 0xA7, 0x07, 0x81, 0x96, 0xEA, 0x8B, 0xF6, 0x92, 0x3F, 0x09, 0xE3, 0x0F, 0x1F,
-    0x63, 0xFC, 0xAE, 0x80, 0xF1, 0x76, 0xDF, 0x09, 0x69, 0xE7, 0x3E, 0xB0, 0x78, 0x5E, 0x06, 0x83,
-    0x7C, 0x5C, 0xFF, 0x55, 0x80, 0x63, 0xE9, 0xCF, 0x61, 0xB5, 0x09, 0x7E, 0x8B, 0x47, 0x81, 0x2F,
-    0x6E, 0x13, 0xDE, 0x2C, 0x66, 0x7F, 0x19, 0xD7, 0x12, 0xE9, 0xF6, 0x12, 0x75, 0xD8, 0x86, 0xEC,
-    0x75, 0x4F, 0x1F, 0x09, 0x43, 0x3F, 0xA1, 0x38, 0xD8, 0xA9, 0xCD, 0x92, 0x08, 0x3B, 0x31, 0xD2,
-    0x18, 0xF9, 0xBB, 0xA8, 0x8B, 0xB4, 0xDB, 0x59, 0xCA, 0x30, 0x6B, 0xB3, 0x39, 0x02, 0x39, 0x01,
-    0x28, 0xE0, 0xC9, 0x8D, 0xF0, 0x14, 0x9A, 0xF4, 0x83, 0x31, 0x7D, 0x6F, 0xA9, 0xDC, 0xEA, 0x1F,
-    0x1E, 0x32, 0xDF, 0x63, 0x05, 0x53, 0xD6, 0x15, 0x2B, 0xD3, 0x24, 0x40, 0x84, 0xD5, 0xB0, 0x67,
-    0x4E, 0xA0, 0x29, 0x3F, 0xC2, 0x14, 0x99, 0x52, 0xC5, 0x16, 0x8B, 0x54, 0x8E, 0x50, 0xB0, 0xED,
-    0xB1, 0xD2, 0xFD, 0x1E, 0x5F, 0x42, 0x57, 0xCC, 0xCE, 0x0C, 0x01, 0x5E, 0x25, 0x13, 0xB9, 0x4F,
-    0xF8, 0x0A, 0x42, 0x2D, 0x49, 0x26, 0xC0, 0x8A, 0x3C, 0xB9, 0x68, 0x1F, 0xCA, 0x3C, 0xFA, 0x0D,
-    0x62, 0x39, 0x09, 0xA7, 0x61, 0x2C, 0xE3, 0x58, 0x81, 0x2C, 0x2D, 0x5C, 0x28, 0x6B, 0xCB, 0xAE,
-    0x88, 0x2E, 0x52, 0xE4, 0xC1, 0x44, 0x5C, 0xC3, 0x9F, 0x19, 0x5B, 0x38, 0xB9, 0x29, 0x1A, 0x69,
-    0x24, 0xA2, 0x01, 0xA6, 0x71, 0xD8, 0xF7, 0x71, 0x9F, 0x74, 0xFB, 0x2E, 0x6D, 0xED, 0x0F, 0xD4,
-    0xB4, 0x02, 0x73, 0x85, 0xF9, 0xB8, 0x32, 0xC5, 0xD2, 0x50, 0x34, 0x78, 0xAC, 0xE4, 0xFA, 0x5A,
-    0xAD, 0x45, 0x14, 0xE6, 0x4B, 0x76, 0x54, 0x50, 0xE4, 0x9A, 0xDD, 0x26, 0x46, 0xFE, 0x19, 0x25,
-    0xF2, 0x99, 0x33, 0x4E, 0x96, 0x68, 0x4A, 0xC7, 0x1D, 0x5C, 0xD7, 0x68, 0x4C, 0xDF, 0x7F, 0x64,
-    0xA0, 0x01, 0xC8, 0x82, 0xA6, 0x81, 0x9D, 0xA8, 0x23, 0x1F, 0xE2, 0x16, 0x5F, 0x2E, 0x4D, 0x68,
-    0xA8, 0x59, 0x1A, 0xE3, 0x4D, 0xCB, 0xC3, 0xF9, 0xF2, 0x4B, 0xCB, 0x79, 0x2D, 0x34, 0xB6, 0x6C,
-    0x35, 0xEC, 0xCB, 0xD5, 0x21, 0x1D, 0x81, 0x05, 0x30, 0x77, 0x78, 0x30, 0x0A, 0x22, 0x30, 0x89,
-    0x98, 0x9B, 0x3F, 0x5E, 0x2A, 0xEA, 0x7B, 0xEC, 0x4B, 0x71, 0x1B, 0x4D, 0x37, 0x94, 0xAE, 0x31,
-    0xD0, 0x62, 0x6E, 0x27, 0xEB, 0x38, 0xC8, 0x6C, 0xAB, 0x02, 0xE9, 0xD9, 0xAC, 0xE8, 0x6B, 0x7E,
-    0x5B, 0x0A, 0xBA, 0x50, 0x96, 0xCD, 0xA2, 0x47, 0x16, 0x3E, 0x62, 0x38, 0x85, 0x3C, 0x56, 0xBD,
-    0x34, 0x35, 0xA4, 0x7D, 0xFE, 0xAA, 0xD2, 0x4B, 0x3E, 0x66, 0x9E, 0x1C, 0xDE, 0x25, 0x54, 0x16,
-    0x0C, 0x2E, 0xF1, 0x72, 0xCB, 0xF4, 0xD2, 0x1E, 0xA6, 0x96, 0x31, 0xA6, 0x41, 0x79, 0xF7, 0x1D,
-    0xDF, 0x89, 0x7F, 0xF7, 0x5F, 0xB9, 0xF2, 0x13, 0xB7, 0xB9, 0x41, 0x7C, 0x00, 0x4F, 0xBD, 0x4B,
-    0xF3, 0x70, 0xB3, 0xB3, 0xDA, 0x84, 0x94, 0x1B, 0xB7, 0x2E, 0xF0, 0x7C, 0x5F, 0xFB, 0x35, 0xB4,
-    0x76, 0xF6, 0xAD, 0x36, 0x1E, 0xAE, 0xE5, 0xF0, 0xFA, 0x86, 0xE7, 0x76, 0x4B, 0xFE, 0xBD, 0x51,
-    0xB2, 0xAF, 0x3A, 0xBB, 0xA7, 0x62, 0xF9, 0xDC, 0xCA, 0x5F, 0xC1, 0x63, 0xDA, 0x5B, 0xFD, 0x16,
-    0xA3, 0xDF, 0xD9, 0xA8, 0x74, 0x09, 0x3C, 0x76, 0x25, 0x2D, 0x7A, 0x25, 0xD9, 0xF2, 0xF5, 0xA1,
-    0x45, 0xE1, 0xE4, 0xD1, 0xCC, 0xCB, 0x72, 0xE4, 0x8E, 0x17, 0x8B, 0x42, 0x39, 0xE0, 0x13, 0x79,
-    0x4F, 0xAD, 0x0B, 0xF5, 0x7F, 0x96, 0xA1, 0xE1, 0x7F, 0xFB, 0x45, 0x69, 0x71, 0xE6, 0x9E, 0x54,
-    0x6B, 0xA2, 0xFC, 0x42, 0xBA, 0x30, 0x49, 0x84, 0x97, 0xFC, 0xB7, 0x50, 0x3B, 0xC6, 0x57, 0x27,
-    0xE6, 0xD0, 0x87, 0x44, 0x6F, 0x14, 0xFC, 0xFD, 0xC6, 0xE0, 0xD2, 0xE9, 0xE3, 0x01, 0x3A, 0x68,
-    0x60, 0xEA, 0xC5, 0x19, 0xC2, 0x94, 0xF9, 0x37, 0x99, 0xE4, 0xAE, 0x18, 0xE8, 0xF9, 0x1E, 0x1E,
-    0xDF, 0xFB, 0xBF, 0x53, 0x69, 0x00, 0x1D, 0x16, 0x19, 0xCF, 0x29, 0x93, 0xB4, 0x34, 0x0C, 0x44,
-    0x42, 0x70, 0xE4, 0x5E, 0xD2, 0xB9, 0x1C, 0xE8, 0x5F, 0xAE, 0xCE, 0x8A, 0x30, 0x20, 0x42, 0x73,
-    0x88, 0xC7, 0xA9, 0xEE, 0xCD, 0x6A, 0xDA, 0x2C, 0xDE, 0x93, 0x1C, 0x1C, 0xAB, 0xCF, 0x99, 0xEA,
-    0x91, 0x4C, 0x88, 0x16, 0x0E, 0xEA, 0x95, 0x0E, 0xDE, 0x4C, 0x2D, 0xC2, 0x44, 0x1D, 0xCD, 0x28,
-    0x57, 0x0B, 0x18, 0xC2, 0x12, 0x3D, 0x65, 0xD7, 0x32, 0x55, 0x12, 0x31, 0xCB, 0x02, 0xEF, 0x9B,
-    0xFB, 0x3E, 0xF0, 0x8D, 0x29, 0xA3, 0x05, 0x4A, 0x89, 0xD3, 0xAD, 0xFA, 0xB9, 0x02, 0x3D, 0x1F,
-    0x52, 0x6D, 0xD9, 0xF8, 0x21, 0x5C, 0x6F, 0x09, 0x5B, 0xE1, 0xC1, 0x10, 0xCB, 0xB5, 0xA4, 0x84,
-    0x6B, 0xAC, 0x12, 0xF3, 0x0E, 0x40, 0xA0, 0x64, 0xB5, 0xFF, 0x01, 0x13, 0x78, 0xCF, 0xB3, 0xF6,
-    0x89, 0x71, 0xFA, 0x46, 0xB1, 0x79, 0x56, 0x44, 0x61, 0xA1, 0x7B, 0xA0, 0x6F, 0x57, 0x3D, 0x0C,
-    0x33, 0xF9, 0x3B, 0x25, 0x96, 0x18, 0xBA, 0x1C, 0xCD, 0x1E, 0x8B, 0x8D, 0x99, 0x9B, 0x8F, 0x4D,
-    0x0D, 0x3E, 0x2D, 0xB3, 0x3A, 0xDF, 0xF7, 0xEC, 0x04, 0x6E, 0x66, 0xB8, 0x29, 0x19, 0x54, 0x4C,
-    0xA9, 0xE0, 0xE6, 0xBD, 0x9B, 0x0D, 0xD8, 0xCD, 0x56, 0x79, 0x98, 0x07, 0x8D, 0x3F, 0xAA, 0x14,
-    0xD2, 0xC0, 0xB9, 0xA5, 0xA8, 0xB6, 0x32, 0xB6, 0x63, 0xD9, 0x9F, 0x8F, 0xD4, 0x52, 0x29, 0xE5,
-    0x72, 0x67, 0x0A, 0x48, 0x39, 0x2D, 0xA9, 0x9E, 0xE3, 0xE5, 0x90, 0x5A, 0x1E, 0x61, 0x59, 0x2C,
-    0x98, 0xC6, 0x18, 0xC0, 0xB0, 0x53, 0x08, 0xBE, 0x0F, 0xAF, 0xA6, 0xE3, 0x28, 0xB7, 0x98, 0x13,
-    0x20, 0xEA, 0x51, 0xE6, 0x84, 0xEF, 0xD5, 0xAA, 0x88, 0x0D, 0x35, 0x7A, 0xD3, 0xB9, 0xBB, 0x56,
-    0x7C, 0x64, 0xC7, 0x2B, 0x3E, 0x78, 0x65, 0x54, 0x8C, 0xAC, 0x31, 0x79, 0xDB, 0xEA, 0x3F, 0x3E,
-    0x5E, 0xF1, 0x91, 0x1E, 0x55, 0x7C, 0xD4, 0x21, 0x4E, 0x77, 0xEA, 0xAC, 0x25, 0x68, 0xA0, 0x57,
-    0xE6, 0xE8, 0xFD, 0xF3, 0x65, 0x41, 0xB5, 0xB0, 0x52, 0x27, 0x24, 0x9D, 0xCC, 0x1A, 0xE0, 0x01,
-    0x17, 0x84, 0x0D, 0x21, 0x0A, 0x00, 0x38, 0x38, 0x84, 0xE0, 0xEE, 0xCC, 0x4C, 0x8E, 0xE6, 0x0E,
-    0x17, 0x2A, 0x8E, 0xA8, 0xB7, 0xE2, 0x57, 0xEF, 0x0E, 0xC4, 0xF5, 0x83, 0x21, 0x3E, 0xCE, 0x17,
-    0xFB, 0xF9, 0x80, 0x27, 0x71, 0x2B, 0xE6, 0x28, 0x99, 0xA3, 0xC1, 0x9B, 0x59, 0x10, 0xC9, 0x30,
-    0x0A, 0x19, 0xBD, 0x61, 0xB8, 0x02, 0xEF, 0x84, 0x9E, 0xE9, 0xDC, 0xD5, 0xFA, 0x99, 0x2D, 0x9C,
-    0x88, 0x69, 0x02, 0xFF, 0xD3, 0x83, 0xDA, 0x91, 0x93, 0xB9, 0x99, 0x6D, 0x7A, 0x7D, 0x4C, 0xDA,
-    0x6F, 0xC4, 0x7D, 0xEA, 0xC6, 0xAC, 0xBD, 0x58, 0xB4, 0x79, 0x1A, 0x50, 0x04, 0x0B, 0x3B, 0x7A,
-    0xF2, 0x0A, 0x0B, 0x3B, 0x22, 0x05, 0x9A, 0x1E, 0xF4, 0x8C, 0xF3, 0xA9, 0xB0, 0xE3, 0x55, 0xD2,
-    0x80, 0x25, 0x65, 0x46, 0x95, 0x77, 0xFC, 0x64, 0x79, 0xCA, 0x1B, 0xFE, 0x8D, 0x39, 0x14, 0x6B,
-    0x34, 0x5B, 0x61, 0xC7, 0xB2, 0x69, 0xD9, 0x2E, 0x44, 0xF8, 0xD6, 0x8D, 0x00, 0xFD, 0x56, 0xD8,
-    0x51, 0x6F, 0x85, 0x1D, 0xE5, 0x56, 0xD8, 0x51, 0x86, 0xC2, 0x0E, 0x8B, 0x1A, 0xDC, 0x50, 0x09,
-    0x1B, 0x70, 0x72, 0x31, 0x51, 0x26, 0x58, 0xD8, 0xD1, 0xA9, 0x3A, 0x10, 0x8A, 0x29, 0x12, 0x08,
-    0xEE, 0xF2, 0x39, 0x3E, 0x28, 0xF6, 0x74, 0xDB, 0xFA, 0x62, 0xE3, 0xAA, 0xCD, 0x21, 0x4C, 0xBA,
-    0xE3, 0x76, 0xBA, 0xF7, 0xC3, 0x4A, 0xC0, 0x30, 0x12, 0xF8, 0x3D, 0x3C, 0x63, 0x7F, 0xD2, 0xDF,
-    0xAE, 0x15, 0x4D, 0x95, 0xAF, 0xB6, 0xEA, 0xB9, 0x50, 0x7C, 0x6C, 0x55, 0x75, 0x12, 0xA7, 0x4D,
-    0x5B, 0xD9, 0x2C, 0xBD, 0xBF, 0x49, 0xFD, 0xFE, 0xC3, 0x37, 0x99, 0xCF, 0xFD, 0xFE, 0xD8, 0x8C,
-    0xB1, 0xFF, 0xDE, 0x1C, 0xB2, 0xB4, 0xA9, 0x19, 0x18, 0xAD, 0x6E, 0xD7, 0xFD, 0xB1, 0x55, 0x27,
-    0xE5, 0xF1, 0xAA, 0x93, 0xE3, 0xC8, 0x72, 0x47, 0x36, 0xFC, 0xEC, 0xB0, 0x67, 0x99, 0x83, 0x74,
-    0x5F, 0x95, 0x0D, 0xF5, 0xED, 0xEE, 0xD9, 0x16, 0x9B, 0x2A, 0x81, 0x6A, 0x6A, 0xDE, 0xB9, 0x50,
-    0x5F, 0x65, 0x03, 0xF5, 0x5E, 0xF3, 0x10, 0x75, 0xC5, 0x4C, 0x5E, 0xCF, 0xDE, 0x14, 0xDD, 0x29,
-    0xAB, 0xF1, 0x6A, 0x69, 0xD5, 0x43, 0x71, 0xC9, 0x3E, 0x14, 0x68, 0xD4, 0x47, 0x05, 0x1A, 0x92,
-    0xCF, 0x50, 0xA0, 0xA1, 0x88, 0x91, 0x0A, 0x34, 0x7E, 0xAD, 0xD4, 0xF4, 0x83, 0x8C, 0xD6, 0xC2,
-    0x3D, 0x9F, 0x9E, 0x66, 0x81, 0xC6, 0x07, 0x12, 0x84, 0xAC, 0xDE, 0x30, 0x76, 0xA8, 0x92, 0xBC,
-    0xA7, 0x76, 0x39, 0x96, 0x34, 0x17, 0xE5, 0xFE, 0x35, 0x38, 0xC3, 0x10, 0x88, 0x5B, 0xB3, 0xB2,
-    0xB8, 0xC4, 0x79, 0x98, 0x66, 0x62, 0x68, 0x99, 0x01, 0xCF, 0xE4, 0x26, 0x18, 0x38, 0x1F, 0x77,
-    0xD8, 0x3E, 0x38, 0xAE, 0xB7, 0x41, 0x31, 0x38, 0xE4, 0x0C, 0x0D, 0x44, 0xB5, 0x84, 0x2E, 0x97,
-    0x3A, 0xA3, 0x4E, 0xC0, 0x5B, 0xE0, 0xF3, 0xEC, 0x16, 0x65, 0x97, 0x59, 0xA1, 0x47, 0x75, 0x78,
-    0x95, 0x8E, 0x4F, 0xB4, 0xCC, 0x0C, 0xCF, 0xA4, 0xEF, 0xBD, 0x2B, 0xCD, 0xF8, 0xC3, 0x9B, 0x16,
-    0xC6, 0xE1, 0x0F, 0xA9, 0x31, 0xAE, 0x12, 0xE0, 0x50, 0x6C, 0x15, 0x17, 0x9B, 0x8E, 0x0B, 0x97,
-    0x5F, 0xBD, 0xF4, 0x1E, 0xE5, 0x71, 0xBD, 0xEF, 0x41, 0xA5, 0x42, 0x94, 0x9B, 0x65, 0x79, 0x08,
-    0x03, 0x92, 0x64, 0xCE, 0x96, 0x51, 0xC1, 0x53, 0xE7, 0x4B, 0x77, 0x9F, 0x3B, 0xF9, 0x14, 0x60,
-    0x51, 0xE1, 0xF6, 0x2D, 0xF6, 0x2A, 0xFF, 0x02, 0x3C, 0x84, 0xDB, 0x2F, 0x4E, 0x6E, 0xFF, 0x06,
-    0x67, 0xD4, 0x84, 0x98, 0xED, 0xFE, 0x26, 0x26, 0x92, 0x9F, 0xC1, 0xD4, 0x66, 0xF8, 0x2B, 0x7B,
-    0x45, 0x3A, 0xA9, 0x5E, 0x66, 0xD3, 0x38, 0x56, 0x3E, 0xB3, 0xEE, 0x15, 0x21, 0xAC, 0x98, 0x11,
-    0x78, 0xFD, 0xA3, 0xE5, 0x33, 0x57, 0xFF, 0x1C, 0xE5, 0x33, 0x3B, 0x35, 0x1B, 0x50, 0xF7, 0x0E,
-    0x91, 0xB0, 0x90, 0x15, 0xE8, 0x8A, 0x2D, 0x15, 0x30, 0xFC, 0x3E, 0xC9, 0xDF, 0xBB, 0x06, 0xAA,
-    0x54, 0x8D, 0x09, 0xA3, 0xB3, 0x44, 0xF3, 0x20, 0x4C, 0x2A, 0xFF, 0xF1, 0xB6, 0xAF, 0xB3, 0xF7,
-    0x7C, 0x9F, 0xFF, 0x0A, 0xD6, 0xA5, 0x6B, 0x96, 0x84, 0x6A, 0x16, 0x6A, 0x85, 0xB5, 0x40, 0x78,
-    0xED, 0xDD, 0x6B, 0x81, 0x3E, 0x61, 0x31, 0xF3, 0x1F, 0xB3, 0x98, 0xD4, 0xBF, 0x30, 0x67, 0xFE,
-    0x07, 0xD8, 0x79, 0x08, 0x56, 0x81, 0x5D, 0x78, 0x9C, 0xC9, 0x22, 0x26, 0xF2, 0x7A, 0x21, 0x65,
-    0xAB, 0x5B, 0xAB, 0xB5, 0x91, 0x29, 0xC4, 0x39, 0x7B, 0x05, 0xD6, 0xEE, 0xFB, 0x00, 0x7F, 0x0F,
-    0x32, 0x49, 0xC6, 0x4C, 0x0B, 0xB7, 0x79, 0xAF, 0xF2, 0x46, 0xDA, 0x7A, 0xED, 0x7A, 0xA1, 0x2A,
-    0xF6, 0x3B, 0xEA, 0x69, 0x5A, 0xC2, 0x86, 0x50, 0x4F, 0x53, 0x2B, 0x25, 0x56, 0xEE, 0xEE, 0xA8,
-    0xA7, 0x29, 0x2D, 0x49, 0x98, 0x1E, 0x3E, 0xE1, 0x2E, 0x2D, 0xE7, 0x2F, 0x2C, 0xAC, 0xED, 0x08,
-    0xF5, 0x34, 0xCB, 0xD9, 0x8A, 0x0A, 0x62, 0x68, 0x06, 0x25, 0x80, 0x9C, 0x39, 0x8E, 0x9B, 0x4E,
-    0xB3, 0xD2, 0x61, 0x85, 0x03, 0x0A, 0xF8, 0x4C, 0xC4, 0xE3, 0xE0, 0x98, 0x21, 0x9A, 0xA0, 0x0F,
-    0x16, 0xFC, 0xA9, 0xE0, 0x75, 0xE5, 0x70, 0x3F, 0xD2, 0x3E, 0xB9, 0xF5, 0x2C, 0x8B, 0x04, 0x55,
-    0x02, 0x49, 0xE3, 0x57, 0x17, 0x6D, 0xD6, 0xF3, 0xF2, 0x43, 0xB8, 0xDC, 0x99, 0xA4, 0x10, 0xBA,
-    0xC7, 0x4B, 0xE0, 0xF8, 0x2A, 0xF4, 0x95, 0x24, 0x5B, 0xC1, 0x07, 0xFE, 0xAA, 0x08, 0xD0, 0x8A,
-    0x88, 0xCC, 0xC4, 0x6F, 0x05, 0x24, 0xB2, 0xE5, 0xF1, 0x1A, 0xFC, 0x29, 0x5B, 0xBE, 0x8C, 0x62,
-    0x28, 0x9A, 0x6D, 0xCD, 0xFC, 0x62, 0x71, 0x8F, 0xCE, 0x9B, 0x4A, 0x6F, 0xAD, 0x26, 0x4B, 0xBB,
-    0x1A, 0x87, 0x74, 0x8E, 0x74, 0xFC, 0x18, 0x90, 0xA6, 0xD9, 0xBB, 0xCE, 0x0A, 0x56, 0xAC, 0xCE,
-    0x88, 0x8F, 0xB6, 0x3B, 0x2B, 0xE0, 0x08, 0xC5, 0x46, 0xAA, 0x5C, 0xA7, 0xD9, 0xC4, 0xF6, 0x33,
-    0xA7, 0x5C, 0xC8, 0x69, 0xAC, 0xA4, 0x4C, 0x9F, 0x17, 0x80, 0x58, 0xE4, 0x78, 0x13, 0xDA, 0x31,
-    0xD5, 0xEC, 0xF6, 0xA6, 0x8B, 0x34, 0x70, 0x6A, 0x15, 0xB4, 0xB7, 0xAE, 0x52, 0xB7, 0x75, 0x0C,
-    0x56, 0xE7, 0x2D, 0xB9, 0x1A, 0x86, 0x2F, 0x54, 0x51, 0x58, 0x4D, 0xB5, 0x19, 0xA9, 0xCC, 0x7E,
-    0xDC, 0x8C, 0x18, 0xAB, 0xD0, 0x5B, 0x4B, 0x86, 0x5B, 0xCA, 0x5B, 0xE5, 0xBF, 0xF0, 0x51, 0x2B,
-    0xE9, 0x44, 0xAB, 0x56, 0x49, 0x15, 0xC1, 0x2A, 0x77, 0xDE, 0x34, 0x48, 0xAE, 0x0E, 0x92, 0x81,
-    0x9E, 0x9C, 0x2F, 0xB9, 0x09, 0x31, 0x2B, 0xC7, 0xF7, 0xAA, 0x0A, 0x2B, 0xEA, 0xA6, 0xC6, 0x33,
-    0x70, 0x55, 0x54, 0x96, 0xD1, 0x30, 0xAA, 0xBE, 0x12, 0xA5, 0x32, 0x8D, 0x5A, 0x2D, 0x11, 0xCB,
-    0xAC, 0x18, 0xAF, 0x07, 0x6E, 0x81, 0xDC, 0x44, 0x4F, 0xBB, 0xFB, 0xAF, 0xB1, 0x87, 0x05, 0x2E,
-    0xC2, 0x53, 0x72, 0x39, 0x06, 0xCB, 0x64, 0x10, 0xA5, 0x31, 0x78, 0xB4, 0x90, 0xEC, 0xF1, 0x2C,
-    0x86, 0x9E, 0xA9, 0xDD, 0xF6, 0x13, 0x23, 0xD4, 0xC9, 0x28, 0x48, 0x3E, 0xEC, 0x55, 0xF7, 0x46,
-    0x05, 0x9A, 0xF7, 0x2C, 0x9D, 0x2D, 0xE8, 0x0D, 0x75, 0x58, 0xB8, 0x5E, 0x54, 0x7C, 0xF8, 0x28,
-    0xB5, 0x22, 0x4B, 0x41, 0xAC, 0xAF, 0xC6, 0xAA, 0xA7, 0x9D, 0x52, 0xE1, 0x16, 0xEE, 0x87, 0xFB,
-    0x0E, 0x55, 0x14, 0x2F, 0x7B, 0x0D, 0xC0, 0x50, 0xFE, 0x7E, 0x4E, 0xA7, 0x8F, 0xC5, 0xDE, 0xC4,
-    0xA1, 0x8D, 0x35, 0x38, 0xF8, 0xFF, 0xA2, 0x1E, 0x93, 0xDB, 0xAA, 0xED, 0xFD, 0x07, 0x85, 0xAC,
-    0x7A, 0xB8, 0x1B, 0x6D, 0x36, 0x26, 0xD8, 0x9A, 0x58, 0x19, 0x96, 0xB6, 0x62, 0x0A, 0x06, 0x17,
-    0x88, 0xF8, 0x58, 0x9D, 0x50, 0x16, 0xD8, 0x98, 0x64, 0x48, 0x27, 0xD0, 0xD0, 0x63, 0x05, 0xD9,
-    0x90, 0xDE, 0x62, 0xAE, 0xA6, 0x24, 0x84, 0x4B, 0xD7, 0x47, 0xC9, 0x28, 0x2A, 0x94, 0x18, 0x24,
-    0x4D, 0x53, 0xC8, 0xB9, 0xC3, 0x79, 0x78, 0xE0, 0x58, 0x00, 0xDF, 0xCA, 0xA6, 0x4E, 0x61, 0x2A,
-    0x1F, 0x92, 0xB6, 0x37, 0x88, 0x12, 0x9E, 0x58, 0x52, 0xB8, 0xF6, 0x73, 0x34, 0x64, 0xED, 0x35,
-    0x37, 0xA5, 0x5D, 0xC1, 0x52, 0x94, 0xAC, 0x6E, 0x76, 0x73, 0xD2, 0x35, 0xAE, 0x8A, 0xC6, 0xE6,
-    0x72, 0x0E, 0x20, 0x88, 0xED, 0xC9, 0xC3, 0x18, 0xA4, 0x0E, 0x4D, 0x29, 0xB3, 0xBA, 0xBB, 0x73,
-    0x9F, 0x54, 0x79, 0xB5, 0xDC, 0x59, 0x79, 0x55, 0x6F, 0x95, 0x57, 0xD5, 0xA1, 0xF2, 0xCA, 0x22,
-    0xA6, 0xC5, 0x78, 0x54, 0x79, 0x35, 0x7C, 0xB4, 0xF2, 0xAA, 0xFB, 0x62, 0xA8, 0xBC, 0x12, 0x1C,
-    0xE5, 0xFE, 0x6E, 0x82, 0x98, 0x1F, 0xD5, 0x30, 0x1A, 0x70, 0x7F, 0x6C, 0x38, 0x78, 0x2C, 0x47,
-    0xBE, 0xC1, 0x67, 0x67, 0x82, 0x7C, 0xE4, 0xB2, 0x95, 0x51, 0x43, 0xA6, 0xC4, 0xDC, 0x8F, 0x7D,
-    0x9D, 0x5B, 0xFB, 0xC3, 0xFD, 0xE5, 0xDD, 0x1B, 0x24, 0xCE, 0x7F, 0x7B, 0x05, 0x54, 0x16, 0x46,
-    0x88, 0xEF, 0x52, 0xCD, 0xA5, 0xA0, 0x4A, 0xFE, 0x09, 0xD5, 0x5C, 0x96, 0x8B, 0x37, 0x52, 0xFC,
-    0x0D, 0x3F, 0x72, 0x96, 0x18, 0x0B, 0x8F, 0x51, 0x54, 0x15, 0x24, 0x73, 0x0A, 0x7B, 0x42, 0xD5,
-    0x79, 0xFF, 0xA2, 0x8A, 0xE2, 0x7A, 0x8B, 0x03, 0xCD, 0x06, 0x6B, 0x58, 0x49, 0xB2, 0x18, 0x30,
-    0xC8, 0x42, 0x95, 0x07, 0x86, 0xCD, 0xFE, 0x0F, 0x46, 0x01, 0xCA, 0x21, 0x84, 0x4D, 0x4A, 0x6A,
-    0xA8, 0x64, 0x86, 0x17, 0x96, 0x0D, 0xF2, 0xC6, 0x30, 0x1D, 0x2C, 0x8B, 0x29, 0x43, 0xB0, 0x18,
-    0x93, 0xE2, 0x50, 0x54, 0xE9, 0x8C, 0x5F, 0x25, 0x8B, 0xD5, 0x3B, 0x04, 0x94, 0x12, 0x5B, 0xAA,
-    0x49, 0x55, 0xFF, 0x47, 0x13, 0x2D, 0xC3, 0xEE, 0x98, 0x20, 0x4B, 0x03, 0x2C, 0x5B, 0x21, 0xBD,
-    0x85, 0x66, 0xD8, 0x7D, 0x94, 0x8C, 0x54, 0xA5, 0xAC, 0x1B, 0xCD, 0xBB, 0xA6, 0xCC, 0x3B, 0xE0,
-    0x6E, 0x78, 0xA7, 0xD9, 0x6F, 0x27, 0xC5, 0x51, 0x33, 0x71, 0x7C, 0xAD, 0xBD, 0xA5, 0x23, 0x98,
-    0xCE, 0x46, 0x33, 0x52, 0x8B, 0xC4, 0x52, 0x42, 0xBC, 0x33, 0x6D, 0x9A, 0x53, 0x2F, 0x50, 0x53,
-    0xA8, 0x14, 0x4C, 0x73, 0x87, 0xDE, 0x4C, 0x89, 0x6F, 0xEA, 0x86, 0x66, 0x29, 0xD1, 0x0B, 0x14,
-    0xB4, 0xBD, 0x6D, 0x6D, 0x62, 0xF2, 0x3F, 0x7C, 0x70, 0x5C, 0xB4, 0x6B, 0xED, 0xA6, 0xAD, 0xA4,
-    0x71, 0x8D, 0x41, 0x2C, 0x82, 0x2A, 0x1E, 0xB3, 0x16, 0x05, 0xAD, 0xC3, 0x2E, 0xB8, 0x53, 0x25,
-    0x38, 0xB9, 0xB0, 0x72, 0x47, 0x75, 0x25, 0x64, 0xEC, 0xC4, 0x52, 0x29, 0x39, 0x73, 0xCB, 0xBF,
-    0x22, 0x86, 0x79, 0x93, 0x11, 0xA7, 0x1B, 0x24, 0x37, 0x47, 0x4C, 0x0D, 0x10, 0xD5, 0xC6, 0xB1,
-    0xC5, 0x96, 0x06, 0x0A, 0x03, 0x7F, 0x84, 0x0F, 0xAC, 0x89, 0x69, 0x95, 0x1F, 0x95, 0xC9, 0x46,
-    0x62, 0x59, 0x89, 0xD0, 0xA0, 0xAC, 0x45, 0xA5, 0xBE, 0x96, 0xD8, 0x5B, 0x4D, 0xA3, 0x14, 0xEB,
-    0xCE, 0xF0, 0x7E, 0x6A, 0x1E, 0x82, 0x45, 0x97, 0x93, 0x50, 0xE4, 0x6D, 0x3D, 0x6E, 0x62, 0x29,
-    0xBB, 0x79, 0x1F, 0x42, 0x6A, 0xAF, 0xEB, 0x65, 0x2C, 0x44, 0x01, 0x57, 0xC7, 0xB2, 0xE2, 0x2D,
-    0xB3, 0x27, 0xC4, 0x2C, 0x03, 0x35, 0xB4, 0x49, 0x97, 0x82, 0xD2, 0x07, 0xE0, 0x6F, 0x3B, 0x79,
-    0x8F, 0x84, 0xD1, 0xB1, 0xFC, 0x0C, 0xDC, 0x95, 0xD7, 0xB8, 0x3A, 0x83, 0x35, 0x53, 0xC6, 0x58,
-    0x9A, 0x29, 0x14, 0xEB, 0xD1, 0x23, 0x4B, 0x84, 0x07, 0x7B, 0xF3, 0xC4, 0xF3, 0xD7, 0x61, 0x08,
-    0xA7, 0xAA, 0x65, 0xAE, 0x0B, 0x8B, 0xA3, 0x43, 0x4A, 0x26, 0x14, 0xEC, 0xDC, 0xA9, 0x28, 0x52,
-    0xB5, 0xF2, 0x6B, 0xF6, 0x22, 0x33, 0x59, 0xEF, 0xE0, 0xE3, 0x45, 0xD5, 0x5A, 0xB3, 0xEA, 0xDB,
-    0xB1, 0x71, 0x0D, 0x4A, 0x69, 0xA7, 0x6E, 0x45, 0xA8, 0x56, 0xD2, 0x7D, 0x37, 0x5B, 0x0A, 0x7C,
-    0xCF, 0xB4, 0x38, 0xD4, 0x77, 0xD6, 0x5A, 0xD8, 0xAF, 0xA0, 0xFE, 0x95, 0x52, 0x53, 0x2F, 0x9F,
-    0x95, 0xFA, 0xCB, 0x60, 0x3E, 0x76, 0xE5, 0x8A, 0x76, 0x59, 0x09, 0x68, 0xC9, 0xE4, 0xCE, 0x02,
-    0x05, 0xE5, 0x09, 0x48, 0x6A, 0xEE, 0xE7, 0x8B, 0x85, 0x9F, 0x26, 0xF7, 0xB8, 0x1B, 0xDD, 0x35,
-    0xCC, 0x0D, 0x9A, 0x6E, 0x37, 0xC5, 0x7D, 0x34, 0xC6, 0x5D, 0x3C, 0x00, 0x83, 0x0E, 0x49, 0xBB,
-    0xFF, 0xCD, 0xA3, 0x97, 0x13, 0xF3, 0x79, 0x07, 0x6B, 0x0E, 0x63, 0x08, 0x96, 0xF5, 0x5C, 0x49,
-    0x7B, 0x08, 0xE9, 0xFF, 0x23, 0xC3, 0x56, 0xF0, 0x2B, 0x59, 0x0E, 0x9B, 0xF5, 0xD1, 0xCA, 0x70,
-    0x8A, 0x12, 0xF4, 0xAC, 0x09, 0x28, 0x58, 0x7A, 0x89, 0x5F, 0xC4, 0xD3, 0x69, 0xCD, 0xAA, 0x64,
-    0x60, 0x2D, 0x62, 0xA6, 0x45, 0x89, 0xC9, 0x68, 0x2B, 0x75, 0xA1, 0x33, 0x9B, 0x7D, 0x68, 0x39,
-    0x5F, 0x09, 0x99, 0x06, 0x9B, 0x42, 0x9E, 0xD5, 0x2A, 0xBA, 0xF2, 0xF2, 0x52, 0x5E, 0x3E, 0x07,
-    0x35, 0x7C, 0xC6, 0xCD, 0x17, 0x77, 0xD3, 0xC5, 0x78, 0xB8, 0x98, 0x30, 0x28, 0x95, 0x53, 0x88,
-    0x5A, 0xFE, 0x85, 0x87, 0x00, 0x95, 0x90, 0x2B, 0xD2, 0x92, 0xE8, 0xCA, 0x3D, 0xE5, 0x27, 0x96,
-    0x11, 0x16, 0xC9, 0x70, 0xA6, 0x48, 0xFB, 0x6F, 0x5C, 0x2A, 0xBA, 0x4B, 0xCF, 0x7F, 0xBC, 0x8C,
-    0x30, 0x1E, 0xF0, 0xAF, 0xBF, 0x84, 0xD5, 0x1E, 0x95, 0x11, 0xEE, 0x4A, 0xCB, 0x9F, 0x3E, 0x54,
-    0x5E, 0xFC, 0xEB, 0x5F, 0x0F, 0xBF, 0xFD, 0xF1, 0x93, 0xFF, 0x6F, 0x49, 0x95, 0x3F, 0x2D, 0xBE,
-    0xEB, 0xFE, 0xE7, 0x18, 0x3D, 0xC9, 0xF0, 0xB9, 0xA3, 0xD5, 0xA5, 0xEE, 0x91, 0xCB, 0xD6, 0x04,
-    0xDE, 0x20, 0x6C, 0x48, 0x42, 0xD2, 0xC5, 0x6A, 0x7B, 0x2C, 0x37, 0x4D, 0xE5, 0x4A, 0xC3, 0xDB,
-    0xB0, 0xF0, 0xAD, 0x6D, 0xCA, 0xA4, 0xE7, 0x7E, 0x42, 0xC6, 0x16, 0xDC, 0xDD, 0x48, 0xEA, 0x68,
-    0x4E, 0xAB, 0x36, 0x99, 0x58, 0xD6, 0x10, 0xAC, 0xCA, 0x1A, 0x32, 0x8B, 0xAA, 0x99, 0x2C, 0xB6,
-    0x60, 0xF8, 0x16, 0x6C, 0xDF, 0x6D, 0xC1, 0xF6, 0xF8, 0x78, 0xB0, 0xDD, 0xFD, 0x81, 0xC1, 0x76,
-    0x49, 0x03, 0x81, 0xF5, 0x8A, 0x9B, 0x89, 0x6A, 0xBA, 0x4A, 0x1D, 0xA0, 0x63, 0xE1, 0x7F, 0x52,
-    0x98, 0xD1, 0xC3, 0x3E, 0x31, 0xDD, 0xE9, 0x6F, 0x35, 0xAC, 0x74, 0x37, 0xDC, 0x93, 0x1E, 0xFD,
-    0x37, 0x4B, 0x61, 0xBF, 0xFD, 0xB7, 0x5B, 0xFF, 0xE3, 0xE1, 0x3F, 0xCC, 0xFA, 0x3F, 0x50, 0x40,
-    0xFF, 0xF6, 0x91, 0xDE, 0x60, 0x93, 0xC5, 0xB8, 0xAC, 0xED, 0xD5, 0x5B, 0x79, 0xAF, 0x09, 0xF9,
-    0x69, 0x7F, 0xD9, 0xFD, 0x3B, 0xBA, 0xAB, 0x29, 0x15, 0x57, 0xBC, 0x96, 0xFE, 0x91, 0x8E, 0x49,
-    0xF9, 0x9F, 0xA9, 0xD4, 0x87, 0x09, 0x7A, 0x06, 0xF2, 0x95, 0x84, 0xBB, 0x75, 0xDE, 0xC8, 0xAE,
-    0x2A, 0xC4, 0xD0, 0x4D, 0x63, 0x45, 0xE6, 0x0D, 0x79, 0xE9, 0xE4, 0x51, 0x49, 0x5D, 0xFA, 0x14,
-    0x7F, 0x54, 0x7D, 0x48, 0x46, 0x03, 0x28, 0x9B, 0x09, 0x4F, 0xE3, 0xAD, 0x62, 0x39, 0x39, 0x5B,
-    0x0B, 0x53, 0x41, 0x3E, 0xF5, 0xCF, 0x42, 0x98, 0x4F, 0x1B, 0x6A, 0x70, 0x21, 0x89, 0xBD, 0x85,
-    0x1B, 0xF0, 0x79, 0xA5, 0x0C, 0xEA, 0x2B, 0x28, 0x35, 0xD3, 0x04, 0x7F, 0xC1, 0xC9, 0x7F, 0xF8,
-    0x40, 0x13, 0xE0, 0xAB, 0x35, 0xD7, 0x49, 0x55, 0x1D, 0x61, 0x57, 0x65, 0x76, 0x2F, 0xAC, 0x97,
-    0x0F, 0xBD, 0x8E, 0xE6, 0xD4, 0x1E, 0x22, 0x10, 0x86, 0xDB, 0xB9, 0xEE, 0x3E, 0xA5, 0x6D, 0xD7,
-    0xBA, 0x99, 0x04, 0x83, 0x9C, 0x2A, 0xF2, 0xA4, 0x3C, 0x9E, 0xAD, 0x3B, 0xF9, 0xC7, 0x73, 0x47,
-    0xEB, 0xDE, 0x87, 0xAE, 0x4F, 0xEB, 0xF7, 0x54, 0x79, 0xD1, 0x0B, 0x58, 0xB7, 0x14, 0x8F, 0xFB,
-    0x19, 0x3F, 0xFE, 0xCA, 0x26, 0xFA, 0xA7, 0xE8, 0xAF, 0x3D, 0x1E, 0x15, 0xEF, 0xF6, 0x16, 0x9D,
-    0x09, 0xE1, 0xEE, 0xAD, 0xEB, 0xF7, 0x50, 0x90, 0xAC, 0xC2, 0x30, 0xF7, 0xC7, 0x7E, 0x45, 0x2C,
-    0x9A, 0x2B, 0xA5, 0xBC, 0xD9, 0x46, 0x42, 0x5B, 0x09, 0xF9, 0xEB, 0x48, 0xDD, 0x6C, 0x2A, 0x64,
-    0xFF, 0x14, 0x5D, 0x92, 0xD6, 0xF3, 0x2F, 0xF9, 0x5F, 0x5A, 0x83, 0xF2, 0x55, 0xAF, 0xF8, 0x2C,
-    0x34, 0xE3, 0x6D, 0xAB, 0xC1, 0xB4, 0x9E, 0xD1, 0xA3, 0xE6, 0x20, 0xEE, 0x94, 0xED, 0x60, 0x63,
-    0x6C, 0xB7, 0x35, 0xC4, 0x6E, 0x1E, 0xBD, 0x3D, 0x33, 0x6F, 0x25, 0x66, 0xE6, 0x2B, 0x5F, 0xBD,
-    0x65, 0xB0, 0x60, 0xF2, 0xAF, 0xC9, 0xCF, 0xF7, 0x0F, 0x7A, 0xC6, 0x4E, 0x13, 0x3F, 0x32, 0x71,
-    0x49, 0x5F, 0xB8, 0x6C, 0xBA, 0xCC, 0x0F, 0x1F, 0x49, 0x75, 0x4F, 0xD1, 0xA1, 0x55, 0xA9, 0x0C,
-    0x14, 0x32, 0xDA, 0x25, 0x5B, 0x21, 0xC2, 0x3D, 0x3F, 0xF9, 0x43, 0x88, 0x72, 0xDF, 0xD3, 0xF7,
-    0xFC, 0x24, 0x7A, 0xFA, 0xE4, 0x33, 0x40, 0xF5, 0x4D, 0x5D, 0x5C, 0xA7, 0xEF, 0xB8, 0x9F, 0x80,
-    0x3A, 0x7A, 0xD0, 0xA4, 0x6A, 0x15, 0xC1, 0x6F, 0x5E, 0x9A, 0xB3, 0xD7, 0x14, 0xD1, 0x2D, 0x5E,
-    0x9C, 0xB9, 0x1F, 0xD9, 0xED, 0xB9, 0x6A, 0xAC, 0x50, 0xEE, 0xE5, 0xE0, 0x61, 0x2D, 0x16, 0x68,
-    0xCB, 0xB6, 0xF8, 0xDA, 0x46, 0xA3, 0xC0, 0xC4, 0xD6, 0x61, 0x1B, 0x08, 0x61, 0xEB, 0x7E, 0xD7,
-    0xFF, 0x56, 0x1E, 0xF1, 0x9C, 0x2F, 0xB9, 0x1A, 0xC8, 0xA0, 0xB7, 0x59, 0xF6, 0x00, 0x6D, 0x38,
-    0x29, 0xDA, 0x13, 0xB3, 0x4F, 0x26, 0x1E, 0x15, 0x5A, 0xA1, 0xEE, 0x18, 0x18, 0x50, 0x79, 0x93,
-    0xF0, 0x92, 0xFD, 0x5C, 0xC5, 0x4D, 0xB6, 0x72, 0x58, 0x50, 0x3E, 0x34, 0x1D, 0xEE, 0x08, 0x9C,
-    0xD5, 0xC3, 0x17, 0x2F, 0x50, 0x29, 0x7B, 0xC6, 0xC3, 0xD9, 0xFF, 0x21, 0x37, 0x49, 0x88, 0x07,
-    0xA0, 0x61, 0x17, 0xAA, 0x31, 0x1F, 0xAB, 0x15, 0xD7, 0xBD, 0x30, 0x85, 0x7E, 0xD6, 0x00, 0x3B,
-    0x28, 0x3E, 0x07, 0x4E, 0xBB, 0xF7, 0x44, 0x19, 0xBF, 0x3A, 0xB9, 0x8B, 0x95, 0x4B, 0x5F, 0x69,
-    0xDD, 0xED, 0x81, 0x50, 0x27, 0xB6, 0x58, 0x3C, 0xBD, 0xF7, 0xB9, 0xAA, 0x33, 0x00, 0xFC, 0x31,
-    0x69, 0x61, 0x54, 0xF6, 0xC0, 0xF9, 0xAA, 0xE4, 0x5D, 0x15, 0x2C, 0x4E, 0x2E, 0x1F, 0x0A, 0x2B,
-    0xFF, 0x5C, 0x8D, 0x41, 0xEB, 0x8E, 0x56, 0xB5, 0x65, 0x63, 0x10, 0x4D, 0x40, 0x48, 0xC8, 0x75,
-    0x9B, 0x17, 0x10, 0x5B, 0x58, 0x93, 0xBB, 0x70, 0xCF, 0xD3, 0xEE, 0x58, 0x81, 0x1E, 0x20, 0xC2,
-    0x0B, 0x83, 0xBB, 0x14, 0x0A, 0xF4, 0x5E, 0x18, 0xED, 0xDB, 0x50, 0xA0, 0x97, 0xB2, 0x40, 0x6F,
-    0xA8, 0xAE, 0xFB, 0x27, 0x9E, 0xDE, 0x87, 0x92, 0x91, 0xC6, 0x14, 0xC4, 0x51, 0xDB, 0xCF, 0xFA,
-    0x27, 0x6A, 0xFB, 0x69, 0x3F, 0xAD, 0xED, 0x07, 0xA6, 0x9E, 0xA9, 0x80, 0x9A, 0x9E, 0xB8, 0x56,
-    0x22, 0xB0, 0x1C, 0x85, 0xCE, 0x03, 0x0B, 0xCB, 0x58, 0x36, 0x52, 0x29, 0xC8, 0xFF, 0x58, 0x5A,
-    0x93, 0x79, 0xDA, 0x26, 0x1D, 0x7B, 0xCE, 0x43, 0xFD, 0xF9, 0xF3, 0x16, 0xA4, 0xA8, 0xD3, 0x8E,
-    0x55, 0xDA, 0xFB, 0xF5, 0xD9, 0x39, 0x0A, 0x15, 0x21, 0xA5, 0x4A, 0x66, 0xE5, 0xFC, 0xC5, 0x0B,
-    0x5D, 0xD8, 0xD0, 0x99, 0x4F, 0x5E, 0xA0, 0x8B, 0xBD, 0x55, 0x52, 0xFD, 0xE9, 0xBB, 0x9D, 0xDA,
-    0xDF, 0xB7, 0xDB, 0x69, 0x55, 0xC3, 0xBF, 0x35, 0xF5, 0xFB, 0xA3, 0x2E, 0xE9, 0x6C, 0x3A, 0x3A,
-    0x02, 0xC0, 0xB2, 0xA9, 0xA1, 0xAD, 0x51, 0x24, 0xC8, 0x4B, 0x10, 0xA1, 0x4B, 0x3A, 0x66, 0x53,
-    0x03, 0x09, 0x1A, 0x76, 0xB2, 0xD7, 0x59, 0xCB, 0x92, 0x2F, 0x90, 0x60, 0x52, 0xAB, 0x49, 0xC0,
-    0xD5, 0x2D, 0xCB, 0xC4, 0xE0, 0xAF, 0xC3, 0xAC, 0x47, 0xEB, 0x71, 0xB0, 0x31, 0x84, 0x5D, 0x9F,
-    0x8F, 0x7A, 0x8E, 0x63, 0x41, 0x35, 0xC1, 0x09, 0x41, 0xB5, 0x85, 0xAD, 0x4D, 0xC2, 0x18, 0xCB,
-    0x31, 0xA8, 0xB6, 0x1F, 0x4F, 0xAF, 0x9F, 0x09, 0xD5, 0xBA, 0xA3, 0xD3, 0x0E, 0xE8, 0x5A, 0xCA,
-    0x00, 0x6D, 0x8E, 0x8F, 0x50, 0x52, 0x0F, 0x94, 0x54, 0x5F, 0xFC, 0xEB, 0x68, 0x18, 0xB2, 0x27,
-    0xAF, 0x13, 0x25, 0xE5, 0xBE, 0xFD, 0xF2, 0x77, 0xE9, 0xA3, 0xE1, 0x5E, 0x48, 0xDA, 0x25, 0x1E,
-    0xA8, 0x01, 0xEB, 0x76, 0xCA, 0x9C, 0x0E, 0xEC, 0x56, 0xBA, 0xAA, 0x3C, 0xAE, 0x12, 0x16, 0x57,
-    0x27, 0x24, 0xBF, 0x6B, 0xD9, 0x6C, 0x58, 0x71, 0xB7, 0x19, 0xC0, 0x8F, 0x54, 0x5D, 0x30, 0xA9,
-    0x04, 0x85, 0x75, 0xCB, 0x75, 0xB4, 0x42, 0x83, 0x61, 0x4B, 0x3F, 0xF0, 0xD5, 0x1B, 0xC0, 0xC2,
-    0xAF, 0xF8, 0xB5, 0xC1, 0x9C, 0x0B, 0xFF, 0x1E, 0xD3, 0x6B, 0x8D, 0x7F, 0x74, 0x52, 0x40, 0x99,
-    0x9B, 0xF8, 0x2D, 0xA8, 0x69, 0x5C, 0xCB, 0x7C, 0xC6, 0x34, 0x6A, 0x35, 0xB0, 0x43, 0xBA, 0xF5,
-    0x4F, 0xFA, 0x32, 0x61, 0x35, 0xDA, 0x2C, 0x77, 0x3B, 0x28, 0xEB, 0xC2, 0x56, 0x62, 0x0E, 0x86,
-    0x79, 0xE0, 0x87, 0x6E, 0x9C, 0xFA, 0x58, 0xB7, 0xBB, 0x6D, 0x5E, 0x48, 0x8F, 0x9D, 0x3A, 0x27,
-    0xDA, 0xEC, 0xD5, 0xFE, 0xD5, 0x26, 0xDC, 0x8D, 0x82, 0x7D, 0x7F, 0x18, 0xA4, 0x4B, 0x30, 0xBA,
-    0x2B, 0x16, 0xBC, 0xD7, 0xDF, 0xBE, 0xDD, 0xEF, 0x6F, 0x78, 0x78, 0x82, 0x17, 0x16, 0x6C, 0x6E,
-    0x75, 0x63, 0xD8, 0xBF, 0xE3, 0x8B, 0x3A, 0x7F, 0x69, 0x5C, 0xDD, 0x9A, 0xBE, 0x3C, 0xC6, 0xE3,
-    0xBD, 0x56, 0xEB, 0xB8, 0x35, 0xC2, 0x88, 0xB2, 0x45, 0x1D, 0xA0, 0x82, 0x45, 0x9F, 0xB0, 0x1D,
-    0x55, 0x68, 0x4B, 0xEB, 0x55, 0x76, 0x6A, 0xCD, 0x68, 0xEA, 0x43, 0x53, 0x0B, 0x5A, 0xAF, 0xCC,
-    0x8E, 0x35, 0x94, 0xF1, 0xA9, 0x3A, 0x13, 0xA6, 0x52, 0xA3, 0x50, 0xB6, 0xE5, 0x50, 0xED, 0xB4,
-    0x9A, 0xCB, 0x9F, 0x60, 0x56, 0xAC, 0x35, 0xDC, 0x42, 0x78, 0xC1, 0xA7, 0xB5, 0xFE, 0x28, 0x6B,
-    0x0F, 0xB7, 0xFE, 0xF0, 0xD0, 0x20, 0x6E, 0x1D, 0xE2, 0xD6, 0x22, 0x1E, 0x7A, 0xC4, 0xAD, 0x49,
-    0xDC, 0xBA, 0xC4, 0x43, 0x9B, 0xB8, 0xF5, 0x89, 0x9B, 0x43, 0xE8, 0x0C, 0x66, 0x99, 0x9F, 0x12,
-    0xE2, 0x7C, 0xD6, 0x2C, 0xEE, 0xD4, 0x2D, 0xEE, 0x42, 0xBB, 0x78, 0xF8, 0x7A, 0x9E, 0xFE, 0xBC,
-    0x72, 0xB7, 0x95, 0xB5, 0x95, 0x75, 0x47, 0x35, 0xD3, 0x1F, 0x69, 0x1A, 0x50, 0xD7, 0x80, 0xDD,
-    0xBB, 0x02, 0xCC, 0xB2, 0x71, 0x80, 0x4D, 0x0B, 0x40, 0x3B, 0xAC, 0x1A, 0x66, 0xEF, 0x80, 0x63,
-    0xF3, 0x80, 0x63, 0xF7, 0x00, 0xBD, 0x3A, 0x30, 0xCD, 0xDB, 0xD6, 0xA1, 0x3C, 0xD8, 0x91, 0x2A,
-    0x4A, 0xB6, 0x6E, 0x3D, 0x04, 0xD9, 0x75, 0x85, 0x92, 0x5F, 0x50, 0xDE, 0xEA, 0x45, 0x01, 0xFA,
-    0x97, 0x85, 0xE0, 0x7F, 0x38, 0xDD, 0x95, 0x5E, 0x16, 0xE1, 0x32, 0x72, 0x55, 0xF3, 0x81, 0x5A,
-    0xD1, 0x3A, 0x1F, 0x88, 0x95, 0xBE, 0xB3, 0x1C, 0x68, 0x65, 0x55, 0xDB, 0x22, 0x15, 0xB0, 0xBD,
-    0xDF, 0x28, 0x95, 0xAE, 0x57, 0x36, 0xCF, 0x59, 0x21, 0xCF, 0xD2, 0x1D, 0x6F, 0xB2, 0x14, 0x99,
-    0x2C, 0x77, 0xBC, 0x51, 0xA9, 0xFA, 0x26, 0x7F, 0x7C, 0x90, 0xA1, 0x00, 0x05, 0x64, 0x95, 0x52,
-    0x87, 0x9A, 0x39, 0x71, 0xFE, 0xD4, 0xB9, 0x3F, 0x3F, 0x91, 0xDC, 0x89, 0x2B, 0xCF, 0x9A, 0xE4,
-    0x34, 0x01, 0xB6, 0x6F, 0x68, 0x89, 0xB3, 0xBF, 0x52, 0x1F, 0x54, 0x7D, 0x68, 0x53, 0x30, 0xAD,
-    0x1C, 0x1E, 0x2E, 0x5E, 0xB2, 0x3C, 0x5C, 0x04, 0x10, 0x61, 0x40, 0xA3, 0x6F, 0x82, 0x9B, 0x1F,
-    0x12, 0xDE, 0xEC, 0x82, 0xBE, 0x65, 0xE9, 0xE3, 0xCA, 0xC2, 0xDA, 0xEB, 0xB3, 0x06, 0x9D, 0x9A,
-    0x90, 0x2E, 0xE4, 0x70, 0xB7, 0x18, 0xE6, 0x54, 0x0E, 0xD0, 0x8E, 0x7E, 0xB0, 0x08, 0x71, 0x31,
-    0x6C, 0xC7, 0x1F, 0x95, 0x76, 0xB8, 0x50, 0x3E, 0x6E, 0x9E, 0xC6, 0xC7, 0x42, 0x91, 0x1D, 0xAB,
-    0x10, 0xD5, 0x48, 0xA5, 0x17, 0xDE, 0x80, 0xC7, 0xB4, 0xF7, 0x70, 0x82, 0x21, 0x9D, 0xF3, 0x89,
-    0xE7, 0x78, 0x6C, 0x07, 0x70, 0xFC, 0x73, 0xBC, 0x63, 0x49, 0x65, 0x0E, 0x5E, 0x05, 0x6D, 0x6E,
-    0xFD, 0xB4, 0xCC, 0xAD, 0xA0, 0x64, 0x20, 0xE7, 0x7E, 0x01, 0x74, 0xF2, 0x97, 0x33, 0x1B, 0x7F,
-    0xC8, 0xFD, 0xC1, 0x19, 0x57, 0x5B, 0xCA, 0xDE, 0xA4, 0xED, 0x71, 0x45, 0x19, 0x9A, 0x9B, 0xCB,
-    0x01, 0x27, 0x1B, 0x55, 0x92, 0xF5, 0x53, 0x4A, 0x7E, 0x4E, 0x9C, 0x7F, 0xCC, 0x85, 0xC3, 0x97,
-    0x92, 0xED, 0x74, 0x9D, 0x69, 0xEB, 0xF4, 0x92, 0xB6, 0xB0, 0xAC, 0x70, 0xF8, 0x54, 0xBF, 0xBE,
-    0x1D, 0x18, 0xE5, 0x74, 0xA3, 0x9D, 0x18, 0x65, 0x2D, 0xFB, 0x76, 0x04, 0x53, 0x38, 0xBE, 0x43,
-    0x67, 0x46, 0xA5, 0x9B, 0xD3, 0xB6, 0x84, 0x83, 0x83, 0x42, 0xCB, 0xFE, 0xD6, 0xB8, 0x7F, 0x89,
-    0x53, 0x06, 0xB8, 0xAF, 0x43, 0x0D, 0x8B, 0xF9, 0x6A, 0xEB, 0x67, 0x97, 0x28, 0x9D, 0x5C, 0x03,
-    0x72, 0xE1, 0x99, 0x1C, 0xCE, 0xCA, 0x2B, 0x93, 0xE1, 0x8B, 0x93, 0x95, 0xB1, 0x47, 0x5B, 0xE7,
-    0x13, 0x54, 0xFC, 0xAD, 0x1F, 0x95, 0x16, 0x87, 0x4D, 0xAC, 0x84, 0xF7, 0x72, 0x56, 0x9A, 0x9B,
-    0x93, 0x86, 0xD8, 0xF5, 0x74, 0x87, 0x13, 0xE7, 0xAE, 0xAE, 0xA5, 0x05, 0xEB, 0x63, 0xF9, 0x57,
-    0xE2, 0x38, 0x09, 0x4B, 0x7E, 0xF9, 0xB4, 0xEF, 0x3F, 0x17, 0x00, 0x40, 0xC8, 0x30, 0xE8, 0x9C,
-    0xA1, 0x56, 0xD5, 0xC8, 0x0A, 0x95, 0x50, 0xFD, 0xCC, 0xBB, 0xF5, 0x47, 0xDF, 0x62, 0x5B, 0x1A,
-    0x24, 0x2A, 0x85, 0x49, 0x21, 0x89, 0x94, 0x91, 0x5B, 0x3E, 0xEE, 0xAD, 0x5C, 0xB0, 0x16, 0x82,
-    0x10, 0x0B, 0x99, 0x3E, 0x5F, 0x66, 0xA1, 0xC4, 0x2F, 0x9A, 0xBF, 0x82, 0x9F, 0x8B, 0x50, 0xA7,
-    0x58, 0x3C, 0x73, 0xA1, 0x3D, 0x03, 0x2D, 0x9C, 0xDF, 0x58, 0x85, 0x6B, 0x76, 0x07, 0x0A, 0xCD,
-    0xF4, 0xE9, 0x2A, 0x1A, 0x65, 0xA9, 0x91, 0xEC, 0x1D, 0x15, 0xBE, 0xDC, 0x8D, 0x0F, 0xFF, 0xF9,
-    0x17, 0xA7, 0x43, 0xA5, 0x2A, 0xEB, 0xE2, 0xD5, 0xE9, 0x1D, 0xB5, 0xAD, 0x4F, 0xAC, 0x14, 0xCD,
-    0xD1, 0x55, 0x3B, 0xCE, 0x63, 0xD0, 0x96, 0x71, 0x89, 0x71, 0xCF, 0x03, 0x48, 0x6E, 0xAC, 0x96,
-    0xDA, 0x55, 0x29, 0xCF, 0x00, 0x90, 0xE9, 0x59, 0x64, 0xF9, 0xAB, 0x95, 0x25, 0xB7, 0x40, 0x4F,
-    0xBF, 0x5C, 0x8E, 0xAD, 0x9C, 0xDB, 0x3A, 0x84, 0xBE, 0x3C, 0xD3, 0xA3, 0xDC, 0xE2, 0x10, 0x0F,
-    0x48, 0xA7, 0xCF, 0xAE, 0x10, 0xFE, 0xA4, 0xAF, 0x8C, 0x39, 0x62, 0x2B, 0xA1, 0xC9, 0x69, 0x69,
-    0x69, 0x94, 0xFD, 0x2A, 0x4F, 0xD0, 0xBF, 0xE8, 0xC7, 0x4A, 0x75, 0x33, 0xA9, 0x7F, 0x49, 0xAE,
-    0xCB, 0x52, 0xAC, 0x42, 0x5D, 0xE9, 0xE2, 0x3F, 0xB0, 0xAE, 0x89, 0xDB, 0xC1, 0xCB, 0xA9, 0x36,
-    0x4F, 0x30, 0x38, 0xE9, 0x76, 0x82, 0x45, 0x28, 0x45, 0x98, 0xEE, 0x38, 0x5A, 0xE2, 0x50, 0x9B,
-    0xD0, 0x04, 0x3D, 0x92, 0xFA, 0x2D, 0x66, 0xB1, 0xF8, 0x37, 0x54, 0x1B, 0xE5, 0x7F, 0xB0, 0x16,
-    0xAA, 0x76, 0x9A, 0x8A, 0xA1, 0x90, 0x6B, 0x54, 0xB3, 0x64, 0x04, 0x58, 0x71, 0x54, 0x32, 0xB3,
-    0x3C, 0x66, 0x5B, 0x9C, 0xF5, 0x69, 0x1D, 0x27, 0x4C, 0x32, 0x35, 0x46, 0x8F, 0x8F, 0x5B, 0x99,
-    0x4F, 0x2D, 0xA2, 0xFE, 0x57, 0xDB, 0x64, 0x05, 0x64, 0xC3, 0x0A, 0xDC, 0x95, 0x4A, 0xBE, 0xD3,
-    0x31, 0x5C, 0xFB, 0xB9, 0x6A, 0x3F, 0x6D, 0x29, 0x57, 0x27, 0xAB, 0x99, 0xD3, 0x59, 0x30, 0x56,
-    0xFC, 0x90, 0xB6, 0x56, 0xFD, 0x60, 0x5A, 0x9A, 0x99, 0x94, 0x3E, 0xD4, 0x3F, 0xD8, 0xAF, 0x3B,
-    0xC5, 0x0A, 0x59, 0x01, 0x11, 0xFF, 0xA6, 0x51, 0x9D, 0x4C, 0xAD, 0x30, 0x08, 0x6B, 0x20, 0xEC,
-    0xC8, 0x01, 0xA3, 0xF6, 0x98, 0x97, 0x6E, 0xC1, 0xDD, 0xCD, 0xB7, 0x46, 0x51, 0xFC, 0x78, 0xDD,
-    0xEF, 0xAE, 0x29, 0xAD, 0x9B, 0xE4, 0x2C, 0x8B, 0x31, 0x62, 0x8C, 0xF8, 0xA5, 0xCE, 0x70, 0xA0,
-    0x92, 0x76, 0x0C, 0xCF, 0x24, 0xAD, 0xFB, 0xFC, 0xA3, 0xBD, 0x5C, 0x4E, 0xA5, 0x05, 0x0E, 0xB2,
-    0xD4, 0xA8, 0xC4, 0x7A, 0x0E, 0xB5, 0x0C, 0x93, 0x6C, 0x0F, 0xE1, 0x22, 0x79, 0x51, 0x35, 0x04,
-    0x4B, 0x98, 0xAE, 0xBA, 0xFA, 0xD4, 0x44, 0xB3, 0x2B, 0xAB, 0x3A, 0xF9, 0x07, 0xC1, 0x78, 0x15,
-    0x42, 0xF0, 0x08, 0x9B, 0x43, 0xB5, 0x3C, 0x2B, 0xF3, 0x0B, 0xF9, 0xD3, 0xAB, 0x81, 0x6F, 0x66,
-    0x51, 0x31, 0x15, 0x1D, 0x8D, 0xB1, 0x58, 0x35, 0xE6, 0x7D, 0x3E, 0xA0, 0x7D, 0xFE, 0xCB, 0xBA,
-    0xA8, 0x6F, 0x98, 0xA6, 0x63, 0x1A, 0x0A, 0xDB, 0xB6, 0x58, 0x35, 0xF5, 0xE7, 0x8E, 0x29, 0xE3,
-    0x2B, 0xA1, 0x7B, 0x75, 0x4B, 0x73, 0xDE, 0xFF, 0xD3, 0xF3, 0xE5, 0xBF, 0x8E, 0x63, 0x9B, 0xBE,
-    0xFD, 0xEC, 0x64, 0xC7, 0xE0, 0x68, 0x62, 0xF7, 0x5C, 0xF9, 0xE9, 0xB9, 0xBB, 0x32, 0x06, 0xFD,
-    0x14, 0x15, 0xDF, 0xAA, 0x11, 0x4F, 0xD5, 0xB7, 0xEA, 0xC4, 0x53, 0xF9, 0xAD, 0x5A, 0xF1, 0x54,
-    0x7F, 0xCB, 0x5E, 0x3C, 0xC7, 0x02, 0x5C, 0xC7, 0x66, 0x3C, 0xC7, 0x0A, 0x5C, 0x57, 0xA8, 0x31,
-    0x6B, 0x20, 0x4A, 0x3E, 0xD6, 0x8E, 0x27, 0x76, 0x70, 0xE9, 0xAB, 0x52, 0x8B, 0xDF, 0x92, 0xBF,
-    0x44, 0x69, 0x3C, 0xC6, 0x14, 0x76, 0xAA, 0xE3, 0x2A, 0xAF, 0x79, 0x24, 0x2E, 0x55, 0x62, 0x77,
-    0xC7, 0x96, 0x0C, 0xC7, 0x6E, 0xF6, 0x89, 0x89, 0x11, 0x51, 0x8A, 0xC5, 0x56, 0x13, 0x2B, 0x2E,
-    0xF3, 0xAE, 0x61, 0xF5, 0x63, 0x72, 0xCB, 0x97, 0x60, 0x74, 0x96, 0x07, 0xBC, 0x39, 0xC3, 0x8F,
-    0xF7, 0xD5, 0x6B, 0x04, 0x71, 0x6B, 0xCA, 0xEA, 0xB8, 0xBE, 0x61, 0xEA, 0x37, 0xE6, 0x85, 0x21,
-    0xE3, 0xD6, 0x97, 0x3C, 0xEC, 0x68, 0x62, 0xC2, 0x17, 0x6E, 0xAD, 0x14, 0x3B, 0xA5, 0x26, 0x7B,
-    0x95, 0xA5, 0xEE, 0xD4, 0xA7, 0x2F, 0x32, 0xD9, 0xDE, 0xB4, 0x7F, 0x8E, 0x3A, 0xE4, 0x4A, 0xE1,
-    0x63, 0x53, 0x3F, 0x6A, 0x9C, 0x08, 0x2A, 0x48, 0x03, 0x7F, 0xC4, 0x9E, 0x4B, 0xF4, 0x33, 0xE9,
-    0x30, 0xCB, 0x34, 0x16, 0xEB, 0xDF, 0x31, 0xA2, 0x32, 0xB1, 0x9A, 0x21, 0x9F, 0xE4, 0x53, 0xB3,
-    0x8F, 0xB9, 0x24, 0x42, 0x2D, 0x3A, 0x16, 0xD7, 0xA5, 0xE3, 0xD1, 0x19, 0x1D, 0xA0, 0x1B, 0xF9,
-    0xBF, 0x6A, 0x2D, 0xBB, 0xA5, 0x23, 0x3C, 0xC6, 0x58, 0xC5, 0x8F, 0xC4, 0x4F, 0xF0, 0x25, 0x8B,
-    0xF5, 0x81, 0x0B, 0xC1, 0xAD, 0x36, 0x47, 0xBB, 0x93, 0xA6, 0xE9, 0xB7, 0x74, 0xBB, 0xA9, 0xDF,
-    0x93, 0x77, 0x74, 0x67, 0x53, 0x9E, 0x45, 0x29, 0x6E, 0x5E, 0xF5, 0xD2, 0x7C, 0xA4, 0x42, 0xEF,
-    0xD6, 0x6B, 0x72, 0xD9, 0xA2, 0x92, 0xB4, 0x78, 0x30, 0x8D, 0x83, 0x2A, 0x41, 0x43, 0x49, 0x64,
-    0xA3, 0x32, 0x50, 0x7A, 0x55, 0x2A, 0x02, 0x65, 0x0D, 0xE8, 0x2E, 0x78, 0xF9, 0xBD, 0x33, 0x7B,
-    0xBC, 0x6E, 0xC9, 0xD4, 0x93, 0x76, 0x04, 0x45, 0x38, 0xC9, 0xA3, 0x0F, 0x47, 0x6C, 0x16, 0xE0,
-    0xED, 0x3A, 0xE2, 0xD4, 0x43, 0xC0, 0x54, 0xF1, 0x04, 0x8B, 0x1B, 0x58, 0x0C, 0x8D, 0xAB, 0x19,
-    0xE9, 0xEC, 0xAB, 0xF6, 0x33, 0xE3, 0x8A, 0x1F, 0xD1, 0x81, 0x58, 0x2A, 0x61, 0x3E, 0x3A, 0xAC,
-    0x33, 0xD9, 0x2A, 0x11, 0x34, 0xCC, 0x65, 0x77, 0xD4, 0xCD, 0x18, 0x87, 0x6E, 0xC6, 0xE8, 0xD0,
-    0xCD, 0xF8, 0x37, 0x8F, 0x12, 0x7F, 0xCC, 0xA9, 0x8E, 0x9F, 0xF8, 0xD4, 0x6E, 0x46, 0x17, 0x4D,
-    0x6A, 0xBA, 0xEF, 0xD7, 0x03, 0xC7, 0x6B, 0x97, 0x85, 0x48, 0xEE, 0x82, 0xDF, 0xFE, 0xD9, 0x17,
-    0x29, 0xC0, 0x40, 0x8F, 0x4B, 0x9B, 0x49, 0x77, 0xEB, 0x4E, 0x7C, 0xC0, 0x3E, 0xF8, 0xD4, 0xCE,
-    0x72, 0x81, 0xD0, 0x3D, 0xC1, 0x3A, 0xC6, 0x84, 0x3D, 0x71, 0x8D, 0x23, 0x15, 0xD2, 0x00, 0xB8,
-    0xFB, 0xAC, 0x67, 0x71, 0xC3, 0x4E, 0xF3, 0xD9, 0x4E, 0x00, 0x53, 0xE1, 0x76, 0x7F, 0xD4, 0x2A,
-    0x18, 0x38, 0xC7, 0xCC, 0xFB, 0x0B, 0xF3, 0x76, 0x38, 0x53, 0x30, 0xC7, 0xC1, 0xD5, 0x3B, 0x6E,
-    0x90, 0xFF, 0x69, 0x5F, 0x17, 0x96, 0xC3, 0xA9, 0x2F, 0xF3, 0xA1, 0x9C, 0xD3, 0xA0, 0x8F, 0x1D,
-    0x22, 0x60, 0x2D, 0x53, 0x21, 0xA8, 0x50, 0x95, 0x56, 0x48, 0x43, 0x9D, 0x7E, 0xD4, 0x44, 0x12,
-    0xE6, 0x94, 0x6D, 0x71, 0xE9, 0x68, 0x8B, 0xD3, 0x86, 0xC3, 0x6C, 0x8E, 0xA9, 0xEF, 0xA3, 0x4C,
-    0x0B, 0xC8, 0x7E, 0x7A, 0x71, 0x9B, 0xCD, 0x6E, 0xB7, 0xF8, 0xEE, 0xB8, 0x5D, 0x0A, 0x75, 0x87,
-    0x87, 0x57, 0x55, 0xDB, 0xE9, 0x59, 0x77, 0x39, 0x80, 0x40, 0x04, 0x82, 0x46, 0xDA, 0x83, 0x16,
-    0xB0, 0xE0, 0x3B, 0xFF, 0xA8, 0x5E, 0x13, 0x3D, 0x5F, 0xE2, 0xE6, 0x2E, 0x7E, 0x2B, 0xED, 0x3E,
-    0x67, 0x27, 0x35, 0x2A, 0x10, 0x54, 0xA9, 0x0E, 0xAC, 0x55, 0x4A, 0x3E, 0x1D, 0xFE, 0xED, 0x49,
-    0x62, 0x54, 0xE2, 0xD2, 0x32, 0xF2, 0x77, 0x68, 0x94, 0x7B, 0xC2, 0x59, 0x31, 0x83, 0x31, 0xC2,
-    0xEE, 0xFC, 0xEF, 0xD1, 0xF4, 0xC0, 0xAE, 0x0D, 0x5A, 0x27, 0xA5, 0x42, 0x09, 0x3B, 0x49, 0x32,
-    0xC5, 0x5F, 0x21, 0xCD, 0x2C, 0x5C, 0xA0, 0x4F, 0x54, 0xBD, 0x3E, 0x1C, 0x6F, 0x11, 0x55, 0x1B,
-    0x88, 0x3A, 0x68, 0x42, 0x58, 0xD5, 0xB0, 0x4E, 0x7B, 0x28, 0x47, 0x18, 0xEC, 0x00, 0x39, 0x0B,
-    0xC2, 0x5B, 0x35, 0x9C, 0x34, 0xDD, 0xA9, 0x83, 0xDA, 0xF8, 0xF6, 0x65, 0xA7, 0x83, 0x2E, 0x49,
-    0x42, 0xC9, 0xC1, 0x33, 0x7F, 0x10, 0x13, 0xA8, 0x51, 0x43, 0x59, 0x5D, 0xAB, 0x9B, 0x81, 0x27,
-    0xD6, 0x6C, 0x7D, 0x1A, 0xF4, 0xDC, 0x31, 0x79, 0xB5, 0x2B, 0xBC, 0xD2, 0x6F, 0xDE, 0x72, 0x61,
-    0x65, 0x06, 0xC3, 0x76, 0xB2, 0xAA, 0xC5, 0x43, 0xE4, 0xF0, 0x99, 0x1B, 0x47, 0x63, 0xA0, 0x26,
-    0x8D, 0x38, 0xF4, 0xCC, 0x2A, 0x7F, 0xD6, 0x1F, 0xEB, 0x85, 0xCD, 0xBF, 0xC9, 0xA4, 0xFC, 0xAB,
-    0x4B, 0x50, 0xEB, 0xF1, 0xAC, 0x4C, 0x5E, 0x3E, 0x7C, 0xFA, 0x61, 0x88, 0xC9, 0xE1, 0x30, 0x44,
-    0x1D, 0x16, 0xC7, 0x0C, 0xAC, 0x0E, 0x43, 0xCC, 0xFB, 0x86, 0x55, 0x3C, 0x6A, 0x47, 0xFA, 0xE4,
-    0xC3, 0x10, 0xE7, 0x7F, 0xC2, 0x61, 0x88, 0x3C, 0xC8, 0xC1, 0xFA, 0xF6, 0x9C, 0x76, 0x4F, 0x92,
-    0x97, 0xBF, 0xB9, 0xFE, 0x1E, 0xBC, 0xA0, 0xD0, 0x57, 0xA4, 0x70, 0xEE, 0x1A, 0x88, 0x5A, 0xB5,
-    0x15, 0x7B, 0xA3, 0x41, 0xF1, 0x78, 0x25, 0x79, 0x45, 0x53, 0x25, 0x62, 0xC2, 0xC6, 0xCE, 0x47,
-    0x87, 0xD5, 0x1E, 0xE6, 0x29, 0x09, 0x27, 0x45, 0xBF, 0xA8, 0x46, 0xA1, 0xC3, 0xD2, 0xF6, 0x56,
-    0xD3, 0x55, 0x87, 0x56, 0x77, 0xCE, 0x58, 0x83, 0x32, 0x8E, 0x3C, 0x2A, 0x76, 0xAC, 0x63, 0xDC,
-    0x3E, 0xD3, 0x83, 0xB9, 0xBF, 0x76, 0x8F, 0x29, 0x5F, 0x28, 0x42, 0x5A, 0x8F, 0x4E, 0xAC, 0x2A,
-    0x51, 0x2E, 0x58, 0x9C, 0x6B, 0x07, 0x4D, 0x82, 0xC2, 0x8D, 0x48, 0xA8, 0xF2, 0x78, 0x0B, 0x1F,
-    0x59, 0x88, 0xDC, 0x74, 0x46, 0x38, 0x4C, 0xA4, 0x3E, 0xCC, 0xDC, 0x88, 0x9D, 0xCD, 0xE1, 0x0C,
-    0xC4, 0x40, 0x64, 0x63, 0x9F, 0x70, 0x04, 0xD0, 0xA9, 0xE3, 0x07, 0x4E, 0x86, 0xA9, 0xE3, 0x15,
-    0xB1, 0x9D, 0x40, 0x84, 0xDD, 0x39, 0x71, 0xF6, 0x53, 0x8E, 0xA9, 0xBE, 0x0B, 0x8B, 0x70, 0xCE,
-    0x22, 0x7B, 0xE8, 0x3A, 0xC2, 0x92, 0x12, 0xD5, 0x59, 0xEC, 0xAC, 0xF5, 0x53, 0x92, 0xA5, 0xC6,
-    0x23, 0x2C, 0x6A, 0x75, 0x87, 0x5A, 0xE8, 0xD0, 0x6C, 0x5B, 0x84, 0x72, 0x8D, 0xEE, 0xA8, 0xFC,
-    0x24, 0xE8, 0x2E, 0xB5, 0x1F, 0x85, 0xE6, 0xF1, 0x47, 0x42, 0xEB, 0x4C, 0x7F, 0x20, 0x84, 0xAB,
-    0xF4, 0xAE, 0xAD, 0xFD, 0x22, 0x6D, 0x01, 0x36, 0xA0, 0x96, 0x88, 0x5C, 0x68, 0xF5, 0xFD, 0x2B,
-    0xBA, 0x69, 0x77, 0xD6, 0x9D, 0x53, 0xC6, 0xBF, 0x67, 0xA9, 0xD6, 0x1F, 0x77, 0x70, 0x50, 0x68,
-    0x11, 0x6C, 0x1E, 0x1E, 0x31, 0x48, 0x40, 0x85, 0xFF, 0xE9, 0x64, 0xF9, 0xF5, 0xB8, 0x4B, 0xDD,
-    0xB0, 0x2F, 0x2F, 0xC6, 0xF0, 0xF7, 0xFB, 0xAC, 0xBC, 0x98, 0xB1, 0x5C, 0x9E, 0xAB, 0xFB, 0xF2,
-    0x57, 0xD9, 0x4C, 0x47, 0xDF, 0x21, 0x1A, 0xFE, 0x0C, 0xC7, 0x47, 0xB2, 0x8E, 0x89, 0x1B, 0x7B,
-    0xDF, 0xB2, 0x55, 0x41, 0xCB, 0xBD, 0xFE, 0x37, 0xE1, 0x3C, 0xF1, 0x32, 0x95, 0x07, 0xD2, 0x02,
-    0xD4, 0xF2, 0x97, 0x58, 0x0F, 0x13, 0xB3, 0xCF, 0x1D, 0x7A, 0x0B, 0xB8, 0xFB, 0x93, 0x9D, 0x50,
-    0x33, 0x5B, 0xAD, 0xF9, 0xDF, 0x1F, 0x28, 0x49, 0xFE, 0x4F, 0x86, 0x23, 0x0B, 0x98, 0xBF, 0xBB,
-    0xFE, 0xE1, 0x4E, 0x28, 0xB7, 0xF5, 0x43, 0x77, 0x14, 0x0A, 0x05, 0xA9, 0x77, 0x4F, 0x69, 0x77,
-    0x53, 0xEB, 0xC4, 0x38, 0xA3, 0x4D, 0xDE, 0xA9, 0x06, 0xB2, 0x4C, 0xDB, 0xA3, 0xD3, 0x82, 0x7A,
-    0xAB, 0x97, 0x28, 0x59, 0xC0, 0xCA, 0x6B, 0xFE, 0x29, 0xAB, 0x8E, 0x1C, 0x78, 0x84, 0x1A, 0xEB,
-    0x8A, 0x01, 0x74, 0x6A, 0x40, 0xED, 0xD1, 0x0A, 0x57, 0xDB, 0x78, 0x88, 0x75, 0x8A, 0x4D, 0x9B,
-    0xF7, 0xC4, 0x8E, 0xCF, 0xB2, 0x4B, 0x16, 0x54, 0xE6, 0xF9, 0x52, 0x19, 0x8F, 0x61, 0x01, 0x36,
-    0xF2, 0x6F, 0x85, 0x2C, 0x8B, 0xBB, 0x6A, 0xA1, 0x31, 0xD2, 0xC4, 0xD4, 0x8C, 0xC1, 0xDC, 0xEA,
-    0x65, 0x1D, 0xE1, 0xFC, 0x59, 0x1D, 0xC2, 0xD6, 0x9A, 0xA9, 0xDA, 0xDA, 0xBF, 0x64, 0xBD, 0x85,
-    0xF5, 0x86, 0x63, 0x97, 0x41, 0x5C, 0x35, 0x87, 0x33, 0xC1, 0x3E, 0x3B, 0x75, 0x87, 0x93, 0xB7,
-    0xB3, 0xDA, 0xDA, 0xC3, 0xF7, 0xED, 0x73, 0xF1, 0xE8, 0xD4, 0x1F, 0xEE, 0xF0, 0xAF, 0x71, 0x6A,
-    0x10, 0x87, 0x7C, 0x02, 0x61, 0x1E, 0x3A, 0xC4, 0x77, 0xF3, 0xBF, 0xE4, 0x29, 0x5F, 0xBD, 0x4E,
-    0xF9, 0xF2, 0x76, 0xCA, 0xD7, 0x68, 0xCF, 0x96, 0x5B, 0x47, 0x76, 0x08, 0xB1, 0xD4, 0x58, 0x66,
-    0x41, 0xB9, 0x58, 0xB0, 0xBC, 0x1D, 0x6B, 0x9F, 0xE2, 0x0F, 0x86, 0x70, 0xAA, 0x81, 0xD2, 0x22,
-    0x55, 0xBD, 0xB5, 0xD3, 0x2C, 0x41, 0x52, 0x8B, 0x57, 0x06, 0x3A, 0xFB, 0x2C, 0x2A, 0xA8, 0xB8,
-    0x73, 0xBE, 0xDF, 0x72, 0x27, 0x67, 0xDD, 0xFF, 0x07, 0x95, 0x56, 0x3D, 0x8C, 0xDC, 0x44, 0x14,
-    0x7E, 0xB6, 0xB9, 0x18, 0xC5, 0x02, 0x87, 0x22, 0x0D, 0x29, 0xDC, 0x50, 0x9D, 0x04, 0x6E, 0x22,
-    0x94, 0x02, 0x34, 0x8E, 0x52, 0x20, 0x91, 0xE6, 0x8A, 0x6C, 0x9D, 0x82, 0x8E, 0x86, 0x36, 0x45,
-    0x88, 0x1D, 0x52, 0x50, 0xA4, 0x48, 0x0A, 0xE8, 0x53, 0xC2, 0x15, 0x51, 0x3A, 0x82, 0xC4, 0xC5,
-    0x4E, 0x40, 0x4A, 0x91, 0xC6, 0x28, 0x48, 0x48, 0x88, 0x62, 0x81, 0x20, 0x0A, 0x8A, 0x38, 0x92,
-    0x51, 0x2C, 0xB0, 0x3D, 0x7C, 0xDF, 0x9B, 0xB9, 0xBD, 0xDD, 0xFC, 0x09, 0x2C, 0xAD, 0x67, 0x76,
-    0xDE, 0xBC, 0x79, 0x7F, 0xDF, 0xF7, 0xC6, 0xC6, 0xDA, 0x1F, 0xAD, 0x1D, 0x6B, 0x6B, 0x1B, 0x73,
-    0x30, 0x4D, 0x2D, 0x9E, 0x7B, 0x7C, 0xDD, 0xE7, 0xAB, 0x13, 0x3E, 0x5C, 0x1C, 0x73, 0xBC, 0x7A,
-    0xC3, 0xB5, 0xED, 0xDD, 0xDD, 0xDD, 0x6B, 0x22, 0x2B, 0x91, 0x17, 0x62, 0x30, 0x3A, 0xF4, 0xDC,
-    0xF0, 0x1F, 0xB7, 0x84, 0x43, 0xBC, 0x14, 0x23, 0x7B, 0x12, 0x75, 0x69, 0x23, 0x17, 0x82, 0x51,
-    0xD2, 0x36, 0xAF, 0x64, 0x8C, 0x3A, 0xC9, 0x2A, 0x23, 0x61, 0xAF, 0xE2, 0x49, 0x62, 0x8A, 0x6F,
-    0x51, 0xDC, 0xE4, 0xC5, 0x4A, 0x1C, 0xF5, 0x89, 0x17, 0x2F, 0x21, 0xDE, 0x0B, 0x06, 0x15, 0x07,
-    0x14, 0xE7, 0x55, 0x49, 0x71, 0x2B, 0xDB, 0xF2, 0x85, 0x48, 0x4C, 0xA3, 0x83, 0xDA, 0xBE, 0xCD,
-    0xD7, 0x2C, 0x6B, 0x8F, 0x7A, 0xB4, 0xB6, 0xA3, 0x2D, 0x7B, 0xB1, 0xCB, 0xC0, 0x36, 0x91, 0x95,
-    0x78, 0x96, 0x64, 0x92, 0x74, 0x94, 0x7C, 0x90, 0xED, 0x6B, 0x62, 0xBB, 0xD8, 0x16, 0xF9, 0x28,
-    0xB6, 0x81, 0xC0, 0x74, 0xA1, 0xAD, 0x20, 0xFA, 0xF0, 0xAA, 0x48, 0x39, 0x84, 0x48, 0x9E, 0x5B,
-    0x2B, 0xB0, 0x66, 0xDB, 0x64, 0xA6, 0xC2, 0x73, 0x8F, 0x2A, 0xFB, 0x72, 0x80, 0xA8, 0xEE, 0x20,
-    0xA4, 0x18, 0x6A, 0xF1, 0x8C, 0x5D, 0xC9, 0x04, 0xC5, 0x74, 0xD4, 0x6D, 0xD9, 0x88, 0x8D, 0x6A,
-    0x95, 0x76, 0x4F, 0xD9, 0x2A, 0x1F, 0x33, 0xDA, 0xAE, 0x5B, 0xDD, 0x6A, 0x3A, 0xD3, 0x87, 0xF6,
-    0x22, 0xEC, 0x8E, 0xEA, 0xC5, 0x8B, 0xFC, 0xA8, 0xFF, 0x87, 0x39, 0x79, 0xBD, 0x12, 0x41, 0x86,
-    0xA2, 0x5E, 0x24, 0x6B, 0x44, 0x6A, 0x37, 0x4D, 0xFD, 0x74, 0xC0, 0xF4, 0xF7, 0x0A, 0x60, 0x79,
-    0x0F, 0x79, 0x44, 0xC2, 0x86, 0x45, 0x5D, 0x48, 0x38, 0x62, 0x75, 0x29, 0x62, 0x0A, 0x41, 0x91,
-    0x24, 0xE9, 0x36, 0xA7, 0x38, 0x70, 0x42, 0x15, 0x38, 0x6D, 0x56, 0xD3, 0x1C, 0xD3, 0x0B, 0xC8,
-    0x3F, 0xCE, 0x0E, 0x31, 0x8D, 0x31, 0x7D, 0x49, 0x36, 0x1E, 0x9A, 0xE4, 0xC9, 0x7A, 0x00, 0x7D,
-    0x90, 0x12, 0x3F, 0xD4, 0x5C, 0xCF, 0x58, 0x89, 0xB7, 0x4A, 0xD4, 0x03, 0xD8, 0x62, 0x25, 0x01,
-    0xE6, 0xBF, 0x3F, 0x73, 0xE2, 0xEC, 0x99, 0xDA, 0x19, 0x40, 0x8D, 0x7D, 0x02, 0x3C, 0x22, 0xA9,
-    0xD3, 0xE2, 0x09, 0x71, 0xBA, 0x7E, 0xB8, 0x50, 0x3B, 0x86, 0x58, 0x8E, 0xE3, 0x17, 0x1D, 0x38,
-    0x66, 0x48, 0x8D, 0x80, 0xE6, 0x14, 0xDE, 0x50, 0x45, 0x1E, 0x24, 0xC4, 0x74, 0xA9, 0x0B, 0x85,
-    0x20, 0x3F, 0x93, 0x44, 0x4A, 0xA1, 0x5C, 0xF7, 0x11, 0x59, 0x8A, 0xC3, 0x81, 0xDA, 0x04, 0x05,
-    0xF7, 0x71, 0xF3, 0x44, 0x6D, 0xDB, 0x51, 0xDB, 0x13, 0x90, 0xDA, 0x76, 0xA4, 0xB6, 0xA5, 0x3B,
-    0xF2, 0xB1, 0x24, 0x08, 0xAE, 0xCF, 0xEC, 0x1D, 0xDB, 0xE5, 0x0F, 0x42, 0x5D, 0x0B, 0xCE, 0xA4,
-    0x5D, 0x7D, 0x69, 0xCE, 0x7B, 0xDB, 0x6E, 0x4C, 0xE5, 0x8C, 0x2C, 0xE2, 0x21, 0x9C, 0x82, 0x39,
-    0xED, 0xA3, 0x31, 0x9A, 0xB3, 0x3E, 0x19, 0xE3, 0xC9, 0x74, 0xE9, 0x98, 0x4C, 0x65, 0x97, 0xA1,
-    0xD4, 0xC6, 0x18, 0x0D, 0x62, 0x47, 0x5C, 0x92, 0x70, 0x1E, 0xE2, 0x3C, 0xDE, 0x20, 0xE2, 0xE0,
-    0x71, 0x81, 0xD8, 0x5F, 0xFD, 0x99, 0x59, 0x38, 0xD1, 0xDD, 0x22, 0x39, 0x4E, 0xA3, 0x52, 0x61,
-    0xCF, 0xD4, 0x68, 0xD1, 0xB4, 0xAE, 0x0E, 0x05, 0x2E, 0x73, 0x12, 0x31, 0x49, 0x5A, 0x4C, 0x64,
-    0xFB, 0x50, 0x58, 0x49, 0xD6, 0x7E, 0xFE, 0x76, 0x11, 0xCC, 0xF1, 0x97, 0x5F, 0x4B, 0xB6, 0xDC,
-    0xFE, 0xE9, 0x86, 0x20, 0x9E, 0xBC, 0x49, 0xBB, 0xA0, 0x3B, 0x4F, 0x00, 0x29, 0xE5, 0x94, 0x47,
-    0xC3, 0x1A, 0x8F, 0x32, 0xC7, 0xA3, 0x7D, 0xA8, 0x17, 0x0A, 0xC7, 0xA7, 0xA0, 0x5E, 0x65, 0x07,
-    0x50, 0x67, 0x0E, 0xFA, 0xB4, 0xF9, 0x26, 0x6F, 0xA6, 0xF4, 0xB7, 0x3E, 0x6B, 0x26, 0x13, 0xF6,
-    0xD9, 0xE5, 0xD6, 0x44, 0xDD, 0xB9, 0xA8, 0x7D, 0xCB, 0xD9, 0x89, 0x96, 0x75, 0xDC, 0x99, 0x93,
-    0x43, 0x42, 0x47, 0xE5, 0x66, 0x1E, 0x3F, 0x1A, 0xD3, 0xFB, 0x43, 0xFE, 0x69, 0x67, 0xD2, 0xE6,
-    0x7C, 0xBA, 0x5F, 0xCD, 0xF3, 0x71, 0x9B, 0x47, 0xBD, 0xB9, 0x38, 0x26, 0x5D, 0x19, 0x0D, 0x69,
-    0x33, 0xC5, 0x5D, 0x7E, 0x12, 0xE3, 0xBB, 0x61, 0xEB, 0xF7, 0x84, 0x84, 0x6B, 0x8B, 0x7A, 0x36,
-    0xA8, 0x55, 0x93, 0x0E, 0xB6, 0xD9, 0xBD, 0xB8, 0xCB, 0x3C, 0xC8, 0x2B, 0x12, 0x37, 0xD1, 0x10,
-    0xCC, 0x52, 0x17, 0xA6, 0x4A, 0x06, 0x29, 0xDB, 0xD0, 0x4A, 0xDA, 0xA3, 0x2B, 0x05, 0x4B, 0x79,
-    0x99, 0x3B, 0x5A, 0x26, 0x18, 0xF8, 0x8A, 0x01, 0x90, 0x49, 0x82, 0x89, 0x09, 0x63, 0xC8, 0xDC,
-    0x85, 0x56, 0xF7, 0x8E, 0x48, 0xE5, 0x41, 0xD5, 0xB8, 0x31, 0x5B, 0x7A, 0xF4, 0x0F, 0x6E, 0x8C,
-    0x27, 0x95, 0x0E, 0x91, 0x3D, 0x8D, 0x59, 0x62, 0x65, 0x71, 0x76, 0xD2, 0x1C, 0x4A, 0xCE, 0x31,
-    0x9F, 0xA5, 0x64, 0x09, 0xE0, 0x5C, 0xAD, 0xA5, 0xB0, 0x93, 0xD5, 0x31, 0x23, 0xD6, 0xA0, 0xFE,
-    0x18, 0x23, 0x6C, 0x46, 0x53, 0x69, 0xFB, 0xC0, 0x02, 0xB6, 0xA9, 0xED, 0xA5, 0x06, 0x22, 0xEF,
-    0x62, 0x34, 0x4B, 0x29, 0x1F, 0xA3, 0x1F, 0xA2, 0x18, 0x47, 0x3F, 0x02, 0xFE, 0xB6, 0xCE, 0xD0,
-    0x84, 0x2A, 0x7A, 0x68, 0x73, 0xFC, 0x53, 0x71, 0x98, 0xD9, 0xEF, 0xAD, 0x5A, 0xB4, 0xAD, 0x41,
-    0x26, 0x30, 0x82, 0x76, 0x3D, 0xD9, 0x40, 0x78, 0xBB, 0x11, 0xB2, 0x75, 0x06, 0x07, 0x3B, 0xBE,
-    0x10, 0xA3, 0xFF, 0x6F, 0xBD, 0xA0, 0xF6, 0xC1, 0x1A, 0x77, 0xC5, 0xD0, 0xFE, 0xEA, 0x39, 0x84,
-    0xDF, 0x9B, 0x8E, 0x7D, 0xF1, 0x41, 0xF7, 0x48, 0x9E, 0x98, 0x02, 0xAD, 0xF3, 0xE6, 0xD4, 0x37,
-    0xA9, 0xF4, 0xE9, 0x46, 0xE2, 0x13, 0x39, 0xAA, 0xBD, 0x40, 0x59, 0x2B, 0xCC, 0x5A, 0xA8, 0x7C,
-    0xAD, 0x56, 0x3B, 0x38, 0x0B, 0x14, 0xC9, 0x8C, 0x37, 0xEA, 0xF6, 0x41, 0x4F, 0x2B, 0xA8, 0x7C,
-    0x41, 0x02, 0xB7, 0x88, 0xF1, 0x21, 0xEE, 0x1F, 0xFB, 0xED, 0x20, 0x87, 0xCD, 0x25, 0xF8, 0x5D,
-    0x9E, 0xC2, 0xAB, 0x26, 0x25, 0x6C, 0x0C, 0x1F, 0x66, 0xEC, 0x0E, 0x26, 0x50, 0x28, 0x1C, 0xCB,
-    0x46, 0xA2, 0x59, 0xD5, 0xE8, 0x1F, 0x73, 0x15, 0xD1, 0x5A, 0x34, 0xEF, 0x97, 0x35, 0x1D, 0xF7,
-    0x5F, 0x79, 0x25, 0xCF, 0x7E, 0xD0, 0x5D, 0xE1, 0x67, 0x41, 0x55, 0x7D, 0x89, 0x62, 0x40, 0x34,
-    0x04, 0x78, 0xE1, 0x10, 0x80, 0xC0, 0x66, 0xD7, 0x97, 0xFE, 0x40, 0x43, 0xE1, 0x4D, 0xAE, 0x8D,
-    0x32, 0xF9, 0x15, 0x8D, 0x05, 0x65, 0xA7, 0xE9, 0xA3, 0xC4, 0xEB, 0x61, 0xFC, 0x5E, 0xFB, 0xA5,
-    0x90, 0xE4, 0xFA, 0x4D, 0x78, 0x3B, 0xFB, 0x93, 0x6B, 0x4C, 0xF2, 0x7F, 0x10, 0xF2, 0x95, 0xF7,
-    0x2B, 0x39, 0xD7, 0xDF, 0xDC, 0xB9, 0x7C, 0xF6, 0xE1, 0x1E, 0xBB, 0xD4, 0x27, 0xB8, 0x32, 0x9A,
-    0x64, 0xCA, 0xED, 0x65, 0xF4, 0xFA, 0xE1, 0xAB, 0x7B, 0x1F, 0xDC, 0x06, 0x5E, 0x4F, 0x48, 0xB0,
-    0x72, 0x6E, 0x67, 0xBF, 0x4D, 0xBB, 0x5E, 0x89, 0xDB, 0x5B, 0x7C, 0xFF, 0x74, 0x6D, 0xDA, 0x11,
-    0xDE, 0x35, 0x0E, 0xED, 0x21, 0xDA, 0x68, 0x37, 0x7A, 0x88, 0x6B, 0x1C, 0x07, 0x3D, 0x44, 0x95,
-    0x33, 0x9E, 0x13, 0xE8, 0x35, 0x9D, 0xAA, 0xB2, 0x5D, 0x9B, 0x16, 0x9B, 0x09, 0x3A, 0x34, 0x17,
-    0x9A, 0x4C, 0xD4, 0x06, 0x49, 0xD1, 0xAE, 0x3B, 0x24, 0x6C, 0xBC, 0xF5, 0x83, 0xBC, 0xB5, 0x3F,
-    0x94, 0x55, 0xD4, 0xA2, 0x26, 0x15, 0x6C, 0x1C, 0x41, 0x7B, 0x3F, 0xA2, 0xF7, 0x02, 0xEF, 0x37,
-    0x35, 0x4A, 0x43, 0xC6, 0x5F, 0x14, 0xEA, 0x90, 0x71, 0xD7, 0x1C, 0xD9, 0x29, 0x19, 0xEC, 0xC5,
-    0xAC, 0x1C, 0x91, 0x88, 0x94, 0x1E, 0xD3, 0x52, 0x12, 0x32, 0xD0, 0x42, 0x4A, 0x03, 0xD2, 0x82,
-    0x34, 0xCD, 0x3B, 0x42, 0xBB, 0x70, 0xD5, 0xE1, 0x9F, 0x72, 0xE9, 0x4A, 0x95, 0x30, 0x9A, 0x9A,
-    0xF7, 0x29, 0x9C, 0xDE, 0x12, 0xF7, 0x7B, 0xFE, 0xC3, 0x1A, 0x1D, 0xF5, 0x74, 0x21, 0x9C, 0x95,
-    0x26, 0x56, 0xD6, 0x8D, 0x54, 0xCE, 0x88, 0x81, 0xB4, 0xEC, 0xD6, 0x75, 0x8F, 0x61, 0x4B, 0x08,
-    0x0D, 0xF8, 0x14, 0xF0, 0x76, 0x81, 0xDF, 0x7B, 0x62, 0x1F, 0x20, 0x1E, 0x23, 0x69, 0x81, 0xBC,
-    0x67, 0x4D, 0xC0, 0xD2, 0xE8, 0x0D, 0x67, 0x0A, 0x2D, 0x04, 0x96, 0x46, 0x97, 0x57, 0x9E, 0x89,
-    0x0E, 0xC5, 0xC2, 0xC0, 0x38, 0x2B, 0x81, 0x94, 0x32, 0xDF, 0x00, 0x57, 0x3C, 0x28, 0x44, 0x58,
-    0x19, 0x33, 0xA9, 0x3F, 0x19, 0x51, 0x5F, 0x69, 0x5E, 0x92, 0xD6, 0x39, 0x74, 0x43, 0x7D, 0x23,
-    0xF1, 0x7C, 0x7D, 0xDE, 0x78, 0x51, 0xA0, 0x0B, 0x47, 0x02, 0x9C, 0x81, 0xDE, 0xCF, 0x26, 0x84,
-    0x2F, 0x15, 0x4D, 0x39, 0x62, 0x62, 0xCE, 0xCC, 0xA8, 0xA7, 0x66, 0xD6, 0x7F, 0x42, 0x36, 0x6B,
-    0x2D, 0xA5, 0x60, 0xA4, 0x12, 0xDD, 0xB1, 0x4A, 0x25, 0x7E, 0xB0, 0x91, 0x11, 0x7F, 0xB1, 0x58,
-    0xE9, 0xC3, 0x82, 0x58, 0x4B, 0xBF, 0x53, 0x9C, 0x21, 0x0A, 0xF2, 0x11, 0x4D, 0x83, 0xFC, 0x2D,
-    0x0B, 0x8D, 0xA7, 0x76, 0x35, 0x9F, 0x5D, 0xDB, 0x98, 0x5C, 0xD9, 0x46, 0xE5, 0x50, 0x34, 0x86,
-    0xA4, 0x68, 0x3C, 0xB0, 0xCF, 0xC3, 0x1B, 0x65, 0x68, 0xD4, 0x25, 0x0A, 0xCE, 0xA5, 0xB2, 0x54,
-    0x8E, 0x64, 0xAE, 0x51, 0x99, 0xAB, 0x2F, 0x0E, 0x12, 0x8D, 0x6E, 0xA1, 0x4D, 0x59, 0x41, 0x1C,
-    0xDB, 0x48, 0xD9, 0x6E, 0xF5, 0xC8, 0x6C, 0xD6, 0xB3, 0x8C, 0x1F, 0xA6, 0x67, 0x68, 0xBB, 0x78,
-    0x63, 0xD7, 0x4B, 0x1D, 0x7D, 0x3C, 0x75, 0x3C, 0x57, 0x3C, 0xC9, 0x64, 0xFF, 0x46, 0x35, 0x7E,
-    0x40, 0x4A, 0xB6, 0x76, 0x14, 0xE2, 0x08, 0x8A, 0xA5, 0x86, 0x23, 0xAA, 0x8F, 0xAF, 0x3E, 0x7A,
-    0x5E, 0x2E, 0xDD, 0x27, 0xD1, 0xF0, 0x84, 0x7E, 0x59, 0xAC, 0xDF, 0x41, 0x99, 0x33, 0xEC, 0xF8,
-    0xB6, 0xB2, 0x3F, 0x6C, 0xD8, 0xF7, 0xDF, 0xD0, 0x75, 0xAE, 0x7B, 0xCB, 0x2B, 0xEE, 0xE3, 0xE0,
-    0xAE, 0xBB, 0x7A, 0xEE, 0x3B, 0xBE, 0x3E, 0x72, 0x7D, 0xA8, 0x5F, 0xEC, 0x1C, 0xDC, 0x01, 0xA1,
-    0x37, 0x6C, 0x37, 0x86, 0xB2, 0xDA, 0xB0, 0xBF, 0x5C, 0xB7, 0x9F, 0x0C, 0x1B, 0xF1, 0xFB, 0xEB,
-    0xD1, 0xDF, 0x33, 0xBE, 0x19, 0xFC, 0x0B, 0x65, 0x51, 0x31, 0x8B, 0x14, 0x31, 0x18, 0x7D, 0x49,
-    0xC0, 0x11, 0xC2, 0x11, 0x0B, 0x3B, 0x65, 0xD3, 0xAF, 0xEB, 0x4D, 0x63, 0x71, 0xC5, 0xAE, 0x19,
-    0xB8, 0xBF, 0x70, 0xFA, 0x1B, 0xC4, 0xEA, 0x8A, 0x2D, 0x16, 0x3C, 0x9C, 0xC8, 0xFE, 0x01, 0xFD,
-    0x03, 0x62, 0x25, 0x9C, 0x8D, 0x57, 0x1C, 0xDC, 0x15, 0xEA, 0x0E, 0x67, 0x61, 0x3B, 0xDA, 0x8A,
-    0x90, 0xCA, 0xC6, 0xC2, 0x08, 0x41, 0x46, 0x9C, 0x99, 0xF8, 0x65, 0x6E, 0x16, 0x0E, 0x1C, 0x08,
-    0xCC, 0xF7, 0xBE, 0xF7, 0x7D, 0xEF, 0xE5, 0x05, 0xEF, 0xF1, 0xAB, 0x3A, 0xB9, 0xB7, 0xF8, 0x36,
-    0xF9, 0x2B, 0x9F, 0x5C, 0x7C, 0x71, 0x1B, 0xAF, 0x03, 0x7B, 0x05, 0x5C, 0xC7, 0x1C, 0xAD, 0x38,
-    0xDF, 0x59, 0x2E, 0x9A, 0xD8, 0x72, 0x27, 0x6A, 0xF6, 0xA6, 0x88, 0xF5, 0x21, 0x66, 0x50, 0x8D,
-    0x78, 0x5B, 0x30, 0xF7, 0x22, 0x98, 0x56, 0xB7, 0xEC, 0x00, 0x98, 0xDA, 0xD2, 0xAD, 0xB0, 0x78,
-    0xAE, 0x3B, 0xF9, 0xE9, 0x63, 0xE5, 0xFC, 0xA9, 0x69, 0x79, 0x03, 0xA0, 0xEC, 0x1E, 0xBF, 0xC3,
-    0x0A, 0x9E, 0x7B, 0x51, 0xCB, 0x4A, 0x59, 0x83, 0x29, 0x12, 0x5C, 0xAD, 0x96, 0xB3, 0x59, 0xD6,
-    0xF1, 0x9F, 0xFB, 0x44, 0x3E, 0x37, 0x6D, 0x96, 0xC8, 0xB8, 0x81, 0x68, 0xFD, 0xC9, 0xE1, 0xED,
-    0x99, 0x92, 0xB1, 0xDA, 0x38, 0xF8, 0xB2, 0xC9, 0x03, 0xC6, 0x8F, 0xFD, 0xD9, 0x58, 0xE4, 0x31,
-    0x42, 0xC4, 0x18, 0x50, 0x86, 0xD2, 0xCA, 0x86, 0x35, 0x88, 0xC8, 0xAD, 0xAE, 0x45, 0xC3, 0x5B,
-    0x94, 0x85, 0xA9, 0xA4, 0xCF, 0x12, 0xB6, 0xB1, 0xDA, 0xAB, 0xC0, 0x7B, 0x16, 0x61, 0xEA, 0xDC,
-    0x67, 0x9D, 0x20, 0xAC, 0xC2, 0x53, 0xDC, 0xDD, 0xCB, 0xD6, 0xF6, 0x6C, 0x4F, 0x9D, 0x3D, 0xFB,
-    0x7E, 0x3A, 0xD1, 0x3C, 0x3A, 0xDD, 0xE2, 0x03, 0xF0, 0x48, 0x39, 0x53, 0xCC, 0x99, 0x97, 0x76,
-    0x4E, 0xAA, 0x7D, 0x74, 0xA4, 0x77, 0x4C, 0x22, 0xD7, 0x32, 0x4B, 0xF6, 0x15, 0x32, 0xC7, 0x1B,
-    0xD6, 0xC3, 0x74, 0x64, 0x2C, 0x99, 0x39, 0x80, 0x09, 0x4C, 0x58, 0x2C, 0x79, 0x87, 0x3B, 0x0E,
-    0x13, 0xFE, 0xC3, 0xD1, 0x25, 0x7A, 0x80, 0x17, 0xA2, 0x12, 0x5E, 0x1C, 0x89, 0x97, 0xE2, 0xEB,
-    0x3A, 0x86, 0x87, 0x0D, 0xCE, 0x71, 0x1F, 0xEC, 0x01, 0x05, 0xB7, 0x1C, 0x82, 0xE3, 0x29, 0xB8,
-    0xD7, 0xDE, 0x34, 0x2A, 0xA4, 0xD8, 0x74, 0x4B, 0x0A, 0xBF, 0x0B, 0xDD, 0x73, 0xEF, 0x17, 0x4A,
-    0x5C, 0xB8, 0xBC, 0x45, 0x8F, 0xE9, 0x71, 0xD9, 0x51, 0xF8, 0xA7, 0xF0, 0xC2, 0x65, 0x95, 0xAA,
-    0x74, 0x61, 0x86, 0xD8, 0x8A, 0xDD, 0x23, 0xB1, 0xAE, 0x56, 0x2B, 0x1E, 0x51, 0xFA, 0x89, 0x14,
-    0x9F, 0xBD, 0xE9, 0x29, 0xB3, 0xD4, 0xBB, 0x09, 0x1D, 0xB2, 0x7D, 0xEB, 0xE6, 0x3B, 0xD2, 0xC6,
-    0x90, 0x45, 0x30, 0x72, 0x24, 0xFA, 0x31, 0xBC, 0xDD, 0x02, 0x90, 0x24, 0xC8, 0x13, 0x40, 0x39,
-    0x42, 0x7B, 0x40, 0xB4, 0x54, 0x44, 0xEA, 0x68, 0x37, 0x16, 0x9B, 0xAB, 0x45, 0x49, 0x34, 0x49,
-    0x34, 0xA4, 0x19, 0x5D, 0x8F, 0xA8, 0x21, 0x74, 0x78, 0xAD, 0xC4, 0x1D, 0xDA, 0x91, 0x8E, 0xFA,
-    0xFF, 0x27, 0x8C, 0xCB, 0xE5, 0x40, 0xA6, 0xD4, 0xB2, 0x61, 0x3C, 0xED, 0x49, 0xFD, 0x64, 0x00,
-    0x8C, 0xCE, 0x2D, 0xBB, 0xE5, 0xD8, 0x2B, 0x53, 0x69, 0x0F, 0x4B, 0xC2, 0x79, 0x7D, 0xC5, 0x8E,
-    0xDA, 0xDA, 0xC9, 0x69, 0x9F, 0x68, 0x46, 0xA9, 0xC1, 0xDB, 0xB6, 0x48, 0x9D, 0x2C, 0x8C, 0xC3,
-    0x66, 0x9C, 0xB9, 0xBC, 0x69, 0x02, 0xAA, 0xCB, 0x0B, 0x26, 0xC1, 0x21, 0x9C, 0xA4, 0x55, 0x12,
-    0x98, 0x13, 0x4B, 0x25, 0xB0, 0x23, 0xB0, 0xC0, 0x3F, 0x65, 0x56, 0xB1, 0x8E, 0xDD, 0x54, 0x10,
-    0x1D, 0xDB, 0x10, 0x4B, 0xB8, 0xB8, 0x42, 0xA2, 0x0A, 0xC5, 0xAB, 0xA1, 0x71, 0x8F, 0x44, 0xEE,
-    0x4B, 0x9A, 0x94, 0x49, 0xB1, 0x4B, 0x01, 0x5F, 0x00, 0x14, 0xFB, 0x03, 0x2C, 0xB6, 0x48, 0x41,
-    0x49, 0x24, 0x22, 0xDA, 0x34, 0xA1, 0xC8, 0x0A, 0xB4, 0x14, 0x14, 0x14, 0x9B, 0xD8, 0x90, 0x22,
-    0x45, 0x8A, 0x58, 0xA4, 0x48, 0x89, 0x49, 0x82, 0x90, 0x68, 0x72, 0x93, 0x38, 0xC4, 0x9B, 0xD8,
-    0x1E, 0xCE, 0x99, 0xBB, 0x6F, 0x13, 0xC0, 0xDA, 0x9D, 0xF7, 0x6C, 0xCF, 0x9D, 0x7B, 0xE6, 0xCC,
-    0x99, 0xB9, 0x4F, 0x44, 0x92, 0xF0, 0x93, 0x88, 0xB8, 0x9B, 0x1D, 0xEC, 0x6E, 0x09, 0x93, 0x85,
-    0x01, 0x76, 0x75, 0xB6, 0x85, 0x3D, 0x78, 0x1F, 0xE6, 0xED, 0xC3, 0x51, 0x24, 0x57, 0xED, 0x45,
-    0x54, 0x75, 0x2D, 0x2B, 0xD5, 0x49, 0x12, 0xE5, 0x03, 0xA7, 0x61, 0xE4, 0x53, 0xAC, 0xCE, 0xF5,
-    0x9A, 0x17, 0xF1, 0xCF, 0x1E, 0x0D, 0x92, 0xEA, 0xE5, 0x73, 0xAD, 0xB8, 0x99, 0xAB, 0xAB, 0x27,
-    0xF7, 0x02, 0x1E, 0xEC, 0xBB, 0x1A, 0xCE, 0xE3, 0x01, 0x3C, 0xF4, 0x86, 0x05, 0x2A, 0xBF, 0x97,
-    0x0C, 0x31, 0x06, 0x29, 0x60, 0x5B, 0x06, 0x55, 0xBE, 0xD4, 0xD1, 0x2C, 0x5C, 0x1A, 0xEE, 0x95,
-    0xFD, 0x1A, 0x80, 0xA0, 0xC4, 0x6A, 0x11, 0xAE, 0x96, 0x82, 0xAB, 0xE5, 0x9D, 0x93, 0xF2, 0xCA,
-    0x75, 0x42, 0x0F, 0x85, 0x61, 0x7A, 0x46, 0x9C, 0x0D, 0x5A, 0x2B, 0x95, 0xBE, 0x18, 0xB1, 0x25,
-    0x16, 0x66, 0xCA, 0x54, 0x2A, 0x06, 0x72, 0x33, 0x4C, 0x62, 0xF7, 0x7E, 0x28, 0x1E, 0xD6, 0x99,
-    0x0A, 0x36, 0x6C, 0x82, 0x7B, 0x5E, 0xBB, 0x25, 0x99, 0x80, 0x2B, 0x20, 0x09, 0xA7, 0x77, 0xFF,
-    0xEE, 0x98, 0xEB, 0x8C, 0xAF, 0x31, 0x16, 0x32, 0x26, 0xDA, 0x9A, 0x38, 0x81, 0xB0, 0x24, 0xB6,
-    0x57, 0xAE, 0xA4, 0xE9, 0x08, 0x3B, 0x44, 0x9A, 0x7C, 0xB7, 0x6A, 0x05, 0xC1, 0x98, 0x42, 0xCB,
-    0x65, 0x0C, 0x83, 0x55, 0x93, 0xB1, 0x2B, 0x11, 0x25, 0x02, 0x05, 0xF9, 0x44, 0xF7, 0x6A, 0xC9,
-    0x8C, 0x6F, 0x04, 0x48, 0x95, 0x91, 0x06, 0x02, 0xD0, 0x4B, 0xDC, 0x74, 0x48, 0xB1, 0x38, 0xBC,
-    0xB1, 0xB7, 0xB7, 0x57, 0xC7, 0x7D, 0x1C, 0x57, 0x2F, 0x92, 0x4D, 0x74, 0xAE, 0x93, 0x45, 0x88,
-    0x58, 0x94, 0xE9, 0x4D, 0xE2, 0x5B, 0x02, 0x5B, 0x97, 0x3D, 0x03, 0xF4, 0x74, 0xCD, 0x75, 0x8A,
-    0xAE, 0x9A, 0x9A, 0x6B, 0xD3, 0x02, 0xB6, 0xDA, 0x15, 0xE2, 0xC7, 0xF0, 0xEE, 0xFE, 0xD2, 0x3C,
-    0x7C, 0x7E, 0x05, 0xAE, 0xAB, 0x67, 0x13, 0xA1, 0x5D, 0x50, 0x73, 0xED, 0x2C, 0xC3, 0x26, 0x78,
-    0x92, 0xE5, 0xA7, 0x82, 0x15, 0x59, 0x2D, 0x09, 0xEA, 0x05, 0xA6, 0xD7, 0x95, 0xB9, 0xB6, 0x6E,
-    0x79, 0x85, 0x02, 0x8D, 0x5C, 0x6B, 0x4C, 0x10, 0x0E, 0xF9, 0x90, 0xCE, 0x56, 0x5D, 0x9D, 0x49,
-    0x23, 0x18, 0x58, 0xF5, 0x78, 0x22, 0xE5, 0x1F, 0xFB, 0xD3, 0xA6, 0xD4, 0x95, 0xF9, 0x93, 0x27,
-    0x6A, 0x62, 0xB1, 0x30, 0x17, 0x23, 0x13, 0x96, 0x29, 0xAE, 0xDC, 0x6C, 0x31, 0x5B, 0xFE, 0xA4,
-    0x50, 0x56, 0x66, 0xCB, 0x91, 0xD6, 0x9B, 0xC5, 0x36, 0x91, 0xA1, 0xA3, 0xBA, 0x38, 0x35, 0x97,
-    0x24, 0x14, 0xAD, 0xB9, 0xCA, 0x67, 0x16, 0xAF, 0x8F, 0xB7, 0xBB, 0x42, 0xFD, 0xD6, 0x45, 0x5B,
-    0xAD, 0xA5, 0x9A, 0x85, 0x10, 0xDC, 0x37, 0xAD, 0xC3, 0xF6, 0x49, 0x88, 0x79, 0xAC, 0xC8, 0x24,
-    0x52, 0x1D, 0x80, 0x61, 0xA7, 0xE5, 0xB6, 0xBE, 0x46, 0xC4, 0x6A, 0xC8, 0x07, 0x87, 0x10, 0x4D,
-    0xDB, 0x9C, 0x26, 0x9E, 0xC9, 0x85, 0x12, 0x75, 0x73, 0x9D, 0x66, 0xB3, 0xE4, 0x67, 0xE6, 0x55,
-    0xF0, 0x1D, 0xD6, 0xFF, 0xA2, 0x40, 0xEE, 0x75, 0xF0, 0x7D, 0xD5, 0x67, 0xBA, 0x24, 0x5B, 0xC9,
-    0xD6, 0x51, 0x16, 0x76, 0xA5, 0x08, 0xEC, 0xA5, 0xE8, 0x25, 0x19, 0xA5, 0x5C, 0x4B, 0xD1, 0xC9,
-    0x35, 0x3E, 0xE0, 0xE3, 0x91, 0x77, 0xF8, 0x2B, 0x4F, 0x43, 0x87, 0xB9, 0x51, 0xE7, 0xAD, 0x5A,
-    0xFB, 0xAA, 0xCD, 0x5F, 0x6B, 0x7F, 0x6E, 0x00, 0x8A, 0xB9, 0xF9, 0x13, 0x4A, 0x7F, 0xA6, 0xFB,
-    0x6B, 0x0A, 0x85, 0x54, 0x2E, 0xD6, 0x9B, 0x4F, 0xD8, 0x2F, 0xFA, 0xD5, 0x44, 0x99, 0x7B, 0xB0,
-    0xEA, 0x03, 0x49, 0xD1, 0x0B, 0x40, 0x9A, 0x4D, 0x94, 0x83, 0x0B, 0x9E, 0x2C, 0xBD, 0xB7, 0x45,
-    0x14, 0x15, 0xD7, 0x80, 0xF9, 0x09, 0x64, 0x90, 0x79, 0xD8, 0xB5, 0x4F, 0x46, 0x34, 0x41, 0x99,
-    0x0E, 0x50, 0x69, 0x99, 0x85, 0xEC, 0xD1, 0x25, 0x9F, 0x87, 0xFC, 0xDE, 0x78, 0xAA, 0xE8, 0x8B,
-    0x3B, 0xC3, 0xAE, 0xEB, 0xDC, 0x8D, 0x70, 0xCD, 0xB5, 0xEE, 0xCB, 0xF0, 0x5D, 0xD9, 0xAE, 0xCE,
-    0x06, 0xB0, 0x52, 0x16, 0x41, 0x2A, 0xF1, 0xC5, 0x98, 0xA8, 0x9C, 0xCA, 0x75, 0x7F, 0x91, 0xDD,
-    0x94, 0xF2, 0x7E, 0x4B, 0x76, 0x62, 0x0D, 0x3E, 0x34, 0x2B, 0xB6, 0xA7, 0xB5, 0xF1, 0x07, 0x87,
-    0x6B, 0xB2, 0x3B, 0x9B, 0x4C, 0x5A, 0x2B, 0x07, 0xEE, 0x2F, 0xE3, 0xDB, 0xCA, 0x54, 0x43, 0xFE,
-    0x13, 0xC3, 0xEB, 0xA9, 0xEC, 0xAC, 0x73, 0x00, 0x7A, 0x90, 0xC0, 0xBF, 0x68, 0x29, 0xF1, 0xE6,
-    0xD8, 0x8B, 0x1C, 0x33, 0x87, 0x9D, 0x0D, 0xB3, 0xDB, 0xDB, 0xDB, 0xE7, 0xD9, 0x9B, 0x8B, 0x35,
-    0x6B, 0x27, 0xFF, 0x1E, 0x12, 0x36, 0x59, 0xD8, 0xE3, 0xF8, 0x96, 0xD9, 0xE4, 0x61, 0x4D, 0xDC,
-    0xB8, 0xC5, 0x9A, 0x4F, 0x51, 0xB4, 0x91, 0xD0, 0x8A, 0x22, 0x6A, 0xA2, 0x9E, 0x3A, 0x3E, 0xEB,
-    0x18, 0xB5, 0x03, 0x67, 0xE7, 0x8F, 0xB4, 0x99, 0xAA, 0xF5, 0x2B, 0x22, 0x25, 0x8C, 0x64, 0x1A,
-    0x82, 0x0F, 0x90, 0x26, 0xE8, 0xD5, 0xD7, 0x01, 0x64, 0x1B, 0x2B, 0x74, 0xF1, 0x9B, 0x12, 0x4E,
-    0x15, 0x8D, 0xA4, 0xCB, 0x6B, 0xD4, 0xF5, 0x01, 0x33, 0x18, 0x98, 0x31, 0x87, 0x23, 0x14, 0x9F,
-    0x13, 0x5D, 0xC1, 0x20, 0xAE, 0x7A, 0xCC, 0x8E, 0x23, 0x33, 0x15, 0x72, 0x3C, 0x11, 0xC7, 0x62,
-    0x1F, 0xEF, 0x90, 0x3C, 0xA0, 0x7D, 0x4D, 0x04, 0x99, 0x9A, 0xEC, 0xE5, 0xBF, 0x1D, 0xC8, 0x8E,
-    0xB3, 0xF9, 0x66, 0x1F, 0xC9, 0x72, 0x02, 0x2B, 0x4C, 0x43, 0xB8, 0xF5, 0x6D, 0x36, 0x46, 0x59,
-    0x61, 0xBB, 0xE2, 0xF0, 0x53, 0x95, 0x4D, 0x1F, 0xC6, 0x99, 0xC9, 0xB5, 0x53, 0x7C, 0x56, 0x6F,
-    0x5A, 0x51, 0x8A, 0x58, 0x40, 0xDF, 0xC7, 0x3D, 0xEA, 0x97, 0xDD, 0x28, 0x54, 0xD9, 0x66, 0x9E,
-    0x46, 0x36, 0x8F, 0x1B, 0xF2, 0xF8, 0x72, 0xF6, 0xD2, 0x9B, 0xA3, 0xBD, 0x2A, 0xAC, 0x2E, 0x9E,
-    0x14, 0x9F, 0xD4, 0xE7, 0x6B, 0xEE, 0xB9, 0xD8, 0xFE, 0xA3, 0x1D, 0x02, 0x6C, 0xA0, 0xE1, 0xE4,
-    0xDA, 0xE9, 0x39, 0xD6, 0x3A, 0x54, 0xCC, 0xF4, 0xCC, 0xC8, 0xA6, 0x77, 0x1D, 0xE7, 0x92, 0xB7,
-    0xD4, 0x81, 0x69, 0x35, 0xE6, 0x58, 0xDE, 0x74, 0xE0, 0xF9, 0x0B, 0x5D, 0x23, 0x88, 0x9B, 0xB3,
-    0x17, 0x68, 0xBA, 0xC1, 0xFD, 0xAC, 0x17, 0x35, 0x7C, 0xEE, 0x38, 0x3D, 0x17, 0x6D, 0x6D, 0x02,
-    0xD9, 0x20, 0x9F, 0x6C, 0x83, 0x9E, 0x76, 0xB1, 0x53, 0x83, 0x18, 0x2C, 0xBB, 0xCC, 0x12, 0x59,
-    0x19, 0xD4, 0x8F, 0x0D, 0xF6, 0xCE, 0x62, 0x89, 0xFA, 0x28, 0xE2, 0x3C, 0x72, 0x2A, 0x0F, 0xCA,
-    0x21, 0xB6, 0x70, 0xCC, 0x3F, 0x0A, 0x05, 0x85, 0xEF, 0xE4, 0x88, 0xD6, 0x29, 0xB3, 0x8F, 0x39,
-    0x8D, 0xE3, 0x75, 0x43, 0x42, 0x19, 0x67, 0xAE, 0x8B, 0x33, 0xB7, 0x88, 0xAE, 0x68, 0x38, 0xF9,
-    0x81, 0x41, 0xFA, 0x7C, 0xB6, 0x99, 0x65, 0x9B, 0xA4, 0x76, 0x28, 0x4A, 0x94, 0x31, 0xAE, 0x7D,
-    0xBD, 0xF2, 0x6F, 0x3E, 0xEB, 0xA3, 0x01, 0x82, 0x71, 0x4C, 0xFD, 0xE4, 0x18, 0x30, 0x3A, 0x9F,
-    0xF7, 0xBF, 0xB5, 0xF9, 0xD3, 0x51, 0xB4, 0x5C, 0xBB, 0xFB, 0x21, 0x99, 0xBD, 0x94, 0x77, 0xFB,
-    0x54, 0xAF, 0xC3, 0x63, 0xA4, 0x88, 0x81, 0xCE, 0x66, 0x24, 0x96, 0xE5, 0x7D, 0x0C, 0x84, 0x53,
-    0x65, 0xEF, 0x6A, 0x16, 0x91, 0xFC, 0xEF, 0x3A, 0xC9, 0x97, 0xA6, 0x9B, 0xD9, 0xEC, 0x24, 0x51,
-    0xBF, 0x92, 0x59, 0xE6, 0x99, 0x2D, 0x89, 0xCA, 0x70, 0x56, 0x55, 0x67, 0xC4, 0x94, 0xE1, 0xA5,
-    0x2C, 0x2A, 0xAB, 0x73, 0x63, 0xBC, 0x19, 0x7B, 0x51, 0x3B, 0x99, 0x4D, 0x68, 0x53, 0x2F, 0x38,
-    0x33, 0x32, 0x11, 0x19, 0x38, 0x16, 0x6B, 0xC0, 0x74, 0xB2, 0x9A, 0xF0, 0xC0, 0xC4, 0xFF, 0x60,
-    0xA7, 0x24, 0x8E, 0x6E, 0xF6, 0x83, 0x87, 0x77, 0xB5, 0xC4, 0x1E, 0x58, 0x37, 0x88, 0x55, 0xD5,
-    0x31, 0xBE, 0xC6, 0x7F, 0xEA, 0x90, 0x67, 0x7D, 0xB2, 0x8D, 0x1D, 0x72, 0x60, 0x28, 0xD8, 0x4E,
-    0xBF, 0xFF, 0x68, 0x5D, 0x56, 0x6A, 0x60, 0xA3, 0x39, 0x1D, 0x20, 0xAD, 0x8F, 0x5A, 0xC4, 0xAD,
-    0xDF, 0xC4, 0x61, 0x51, 0xEA, 0xE1, 0x55, 0xBF, 0x9C, 0x9E, 0xAB, 0xA9, 0x18, 0xBF, 0x1D, 0x2B,
-    0xFA, 0xE0, 0xC4, 0x9E, 0x11, 0xA7, 0x93, 0xF4, 0x98, 0x78, 0x93, 0xAC, 0x09, 0xD9, 0x0C, 0xCB,
-    0x9D, 0x91, 0x8C, 0xD5, 0xD1, 0x6F, 0x16, 0xC0, 0x58, 0x60, 0x74, 0xAE, 0xD0, 0xE0, 0x53, 0x05,
-    0x7A, 0x68, 0x9E, 0x8E, 0xD7, 0x25, 0x7F, 0x3C, 0xE0, 0x0C, 0xBC, 0x1F, 0x90, 0xD1, 0x9D, 0x47,
-    0x30, 0x37, 0x1F, 0x43, 0xE5, 0xB7, 0xEE, 0x0F, 0x52, 0xDE, 0xBE, 0x8B, 0xAC, 0x6E, 0xDF, 0x82,
-    0xB9, 0x7C, 0x1B, 0x47, 0x01, 0x52, 0x7A, 0xC9, 0x7E, 0x9C, 0xCD, 0x16, 0x98, 0x4C, 0xF0, 0x24,
-    0x1F, 0x12, 0x1B, 0xE3, 0xC2, 0x09, 0x0E, 0x35, 0x73, 0x1E, 0xD4, 0xE4, 0xDC, 0xF3, 0x30, 0xA5,
-    0x74, 0x96, 0xA8, 0x40, 0xEB, 0x24, 0xB5, 0x83, 0x75, 0x31, 0x11, 0x3D, 0xD8, 0x94, 0xE5, 0xF8,
-    0x39, 0xCA, 0x50, 0x46, 0xAD, 0xC5, 0xBA, 0xC4, 0x9F, 0x46, 0x47, 0xE7, 0x69, 0x3C, 0xD2, 0xFF,
-    0x01, 0x65, 0x54, 0xBF, 0x6F, 0xDD, 0x36, 0x10, 0xBE, 0x27, 0x19, 0x61, 0x5A, 0x21, 0xE0, 0xD4,
-    0x22, 0x40, 0x80, 0xA8, 0x63, 0x87, 0xB6, 0x5C, 0x32, 0x3F, 0x2A, 0xCD, 0xD0, 0xA1, 0x43, 0xFA,
-    0x1F, 0xA4, 0x73, 0x33, 0x74, 0xEB, 0xE6, 0x4A, 0x86, 0xFF, 0x00, 0x7B, 0xF0, 0x1F, 0xE0, 0x21,
-    0x43, 0xF0, 0xF6, 0x2C, 0x85, 0x6B, 0xAA, 0xF1, 0x98, 0x21, 0x02, 0x3C, 0x64, 0x15, 0x50, 0x6F,
-    0x1D, 0xCC, 0xDA, 0x2A, 0x20, 0x37, 0x14, 0xAF, 0xDF, 0x51, 0x7A, 0xF9, 0x81, 0x3E, 0xE0, 0xF8,
-    0x28, 0xF2, 0xEE, 0xE3, 0x77, 0xDF, 0x1D, 0x49, 0x59, 0x45, 0xB4, 0x1A, 0x89, 0x68, 0x82, 0x9D,
-    0xC2, 0x6A, 0x98, 0xAD, 0xEE, 0xF5, 0x76, 0xCF, 0x8D, 0xE5, 0x25, 0x47, 0xCD, 0x7C, 0xA1, 0x39,
-    0x56, 0x05, 0x1F, 0x12, 0x71, 0x4F, 0x54, 0x44, 0x78, 0x38, 0x4F, 0xA4, 0x24, 0xE4, 0x57, 0x98,
-    0xA2, 0x0F, 0x7F, 0xAB, 0x5E, 0xF6, 0x1B, 0x20, 0x61, 0xDF, 0xF0, 0x40, 0x40, 0xE8, 0x14, 0x47,
-    0xCE, 0xD9, 0x1C, 0x84, 0x7A, 0x7F, 0xB0, 0xDF, 0xB6, 0x96, 0x3A, 0x52, 0x7E, 0x39, 0x51, 0x77,
-    0x18, 0x02, 0xAC, 0x6C, 0x89, 0x72, 0xE1, 0x62, 0xDF, 0x81, 0x7D, 0x21, 0xCB, 0xCD, 0x42, 0x2F,
-    0x45, 0x98, 0x46, 0x5D, 0xE0, 0xAB, 0x8E, 0xDF, 0x79, 0xC5, 0xEC, 0xDA, 0x5B, 0xCC, 0xD8, 0xFB,
-    0x99, 0xB1, 0x77, 0x8F, 0x01, 0x50, 0x63, 0x52, 0x02, 0xAD, 0x60, 0x38, 0x33, 0x42, 0x95, 0xF0,
-    0xF9, 0x72, 0xC1, 0xFB, 0x0C, 0x96, 0x0F, 0x09, 0x06, 0x4C, 0xE5, 0x50, 0xDD, 0x2E, 0xE8, 0x05,
-    0xFC, 0x2A, 0x64, 0xBF, 0xCE, 0x87, 0xFB, 0x6A, 0x32, 0xFB, 0xA1, 0xBC, 0x09, 0xDC, 0x58, 0x06,
-    0x72, 0xCD, 0xF0, 0x64, 0x00, 0x66, 0x0C, 0xAE, 0x4A, 0xE2, 0x3F, 0x59, 0x00, 0x6F, 0xC1, 0x7E,
-    0x04, 0x0A, 0xE0, 0xB0, 0x6C, 0xF0, 0x75, 0x42, 0xB4, 0x3B, 0xE7, 0x10, 0x56, 0xEE, 0xB0, 0x6C,
-    0xF2, 0xBF, 0x1D, 0xC7, 0xEF, 0xA1, 0x00, 0xBF, 0x05, 0x96, 0xE6, 0x1B, 0xF0, 0x1C, 0xED, 0x8D,
-    0x70, 0x98, 0x4A, 0xC9, 0xA8, 0x08, 0x49, 0x49, 0xD3, 0x13, 0x57, 0x89, 0xB2, 0xA4, 0xFF, 0x3B,
-    0xD1, 0x1D, 0xFC, 0x3D, 0xF8, 0x58, 0x5A, 0x70, 0x35, 0x2D, 0x29, 0xE4, 0xE9, 0xB8, 0x81, 0xAE,
-    0x7B, 0x71, 0xD7, 0x3D, 0x7E, 0xE9, 0x4F, 0xEE, 0xEA, 0xB6, 0xA2, 0x35, 0x1C, 0xC0, 0xA1, 0x80,
-    0xD3, 0x32, 0x55, 0xDD, 0xCC, 0xCC, 0xCE, 0xB4, 0x64, 0x29, 0xEF, 0xE9, 0x6B, 0xDD, 0x76, 0xD1,
-    0xE8, 0xCE, 0x9D, 0x32, 0x32, 0xF3, 0x64, 0x71, 0x6C, 0x39, 0xCC, 0x9E, 0x3B, 0x92, 0xD2, 0x21,
-    0x7D, 0xCE, 0x23, 0xF8, 0xF2, 0x8A, 0xF9, 0x08, 0x4A, 0x63, 0x0B, 0x65, 0xCC, 0x19, 0xC7, 0x46,
-    0x13, 0xC9, 0x36, 0x6E, 0xD4, 0xBD, 0xE2, 0xB3, 0x91, 0xCA, 0x1E, 0x79, 0x1C, 0x67, 0x47, 0x22,
-    0x75, 0xAC, 0x80, 0x84, 0x06, 0x79, 0x2A, 0x62, 0x59, 0x88, 0xE5, 0xB8, 0x05, 0x00, 0xAA, 0x74,
-    0x3E, 0x16, 0x5C, 0xC5, 0x12, 0x91, 0xFB, 0x81, 0x74, 0xFF, 0x80, 0xB2, 0x21, 0xA3, 0x59, 0xAF,
-    0x56, 0xB4, 0x7F, 0x56, 0x78, 0xDD, 0xDA, 0x87, 0x63, 0x16, 0x4C, 0xA5, 0xCF, 0x3D, 0x39, 0x4B,
-    0xF9, 0xDB, 0x1E, 0xF2, 0xAC, 0x88, 0x5B, 0xCB, 0x01, 0x54, 0x1A, 0xC7, 0xC3, 0xEA, 0xA9, 0x94,
-    0xF4, 0x07, 0xD8, 0x6D, 0x54, 0x02, 0xCA, 0xD9, 0x87, 0xC7, 0x85, 0xB7, 0x34, 0x65, 0xBE, 0x6C,
-    0xCB, 0x47, 0x23, 0x8D, 0x35, 0xE9, 0xD7, 0x3D, 0x9D, 0x06, 0x28, 0x04, 0x15, 0xFD, 0x8E, 0x50,
-    0x36, 0x3C, 0x81, 0x45, 0xAF, 0xE3, 0x51, 0x0A, 0x4D, 0x3F, 0x51, 0x3D, 0x15, 0x3F, 0x0B, 0xDB,
-    0x7E, 0x28, 0x64, 0x4D, 0xFF, 0xBB, 0xD9, 0x1C, 0x1B, 0x24, 0xEE, 0x6B, 0x0C, 0x83, 0x34, 0x31,
-    0xD5, 0x58, 0x7B, 0x0E, 0xA9, 0x39, 0x64, 0x2C, 0xAD, 0xE6, 0xA4, 0x5B, 0x8D, 0xDF, 0x86, 0x64,
-    0xDD, 0xFB, 0xF2, 0x88, 0x78, 0xF4, 0x42, 0x16, 0xAC, 0x34, 0x42, 0x79, 0x0D, 0x74, 0x15, 0x6D,
-    0x8F, 0xB6, 0x79, 0x03, 0x8D, 0x5D, 0x70, 0x13, 0xD9, 0xCB, 0x83, 0x4B, 0x5F, 0xFE, 0x33, 0x04,
-    0x3E, 0x9B, 0x4C, 0xB9, 0x1F, 0x6C, 0x7E, 0x35, 0xDC, 0xA7, 0x66, 0x6D, 0xA9, 0x22, 0x75, 0x2E,
-    0xAD, 0x7A, 0x22, 0xDD, 0xA3, 0x5F, 0x49, 0x5B, 0x8E, 0xE9, 0x56, 0x3C, 0x01, 0x8D, 0xEC, 0x4A,
-    0x48, 0x5A, 0x29, 0x64, 0x7E, 0xEE, 0xE7, 0x66, 0x90, 0x21, 0xEB, 0xB7, 0xA9, 0x90, 0x93, 0x41,
-    0x2F, 0xDF, 0x3F, 0x6D, 0x36, 0xAE, 0x49, 0x99, 0x08, 0x75, 0xD1, 0x8D, 0xEC, 0x1F, 0x1B, 0x2C,
-    0xF6, 0xF2, 0xD9, 0xA1, 0x50, 0x72, 0x57, 0x28, 0x0D, 0xAE, 0x5D, 0xEE, 0x1E, 0xE5, 0xED, 0x36,
-    0x95, 0x5D, 0xB9, 0xD7, 0xF9, 0x9F, 0x7E, 0x7B, 0xE8, 0x7C, 0x7E, 0xA2, 0x32, 0xB3, 0x9A, 0x09,
-    0x0A, 0xD7, 0xBB, 0xA0, 0xBD, 0x93, 0xF7, 0x6B, 0x9B, 0xF5, 0xF5, 0xD9, 0xD5, 0x50, 0xEF, 0xF1,
-    0x93, 0xF2, 0x60, 0x50, 0x71, 0xE0, 0x88, 0xBE, 0x39, 0xC0, 0x11, 0x26, 0xC8, 0x73, 0xE1, 0xDE,
-    0xA0, 0xCB, 0x57, 0xD1, 0x02, 0x22, 0xBF, 0x16, 0x9A, 0xFA, 0xAB, 0x0F, 0x7B, 0xBB, 0x22, 0x8D,
-    0xF1, 0x9B, 0x94, 0x0C, 0x94, 0x95, 0xCE, 0x70, 0xA9, 0x34, 0x78, 0x11, 0x24, 0x35, 0xD3, 0x4A,
-    0x75, 0x36, 0x93, 0x54, 0x61, 0x29, 0x10, 0xF3, 0x2B, 0x79, 0x2D, 0x54, 0x90, 0x1A, 0x6D, 0xB8,
-    0x49, 0x4B, 0x5D, 0x72, 0xF0, 0x54, 0x4C, 0xA4, 0x83, 0x54, 0x2A, 0xE3, 0x24, 0x8E, 0x24, 0x88,
-    0x62, 0xF9, 0x8F, 0xDF, 0x29, 0x2B, 0x37, 0x04, 0x97, 0x1A, 0x41, 0x17, 0xE4, 0x6A, 0xEE, 0xCA,
-    0xEB, 0xBF, 0xD0, 0xAD, 0xEB, 0x4F, 0x33, 0x06, 0x47, 0xCB, 0xB8, 0x48, 0xBF, 0x08, 0x59, 0x83,
-    0x49, 0xF6, 0xBF, 0xC9, 0x6F, 0x8B, 0x4F, 0x72, 0x56, 0xBC, 0x2E, 0x51, 0x73, 0x74, 0x7F, 0xED,
-    0x12, 0x8B, 0x0B, 0x4A, 0x6F, 0xA6, 0x15, 0xA1, 0x10, 0xF0, 0x1F, 0x65, 0x54, 0xBD, 0xAE, 0xDE,
-    0x44, 0x10, 0x3D, 0x6B, 0x73, 0x65, 0x29, 0x5B, 0xB8, 0x8A, 0x14, 0x71, 0x0B, 0xF7, 0x48, 0x68,
-    0x1F, 0xC1, 0x96, 0x28, 0x78, 0x02, 0x68, 0x68, 0x53, 0x10, 0x28, 0x6E, 0x4F, 0xF3, 0x39, 0xF0,
-    0x02, 0xB7, 0x40, 0xA2, 0xA5, 0x48, 0x8A, 0x34, 0xA4, 0xA5, 0x88, 0xB2, 0x7E, 0x04, 0x17, 0x91,
-    0x52, 0xA4, 0xC0, 0x05, 0x0D, 0xA4, 0xD9, 0x48, 0x96, 0x62, 0xA1, 0xB5, 0x27, 0x67, 0x66, 0x73,
-    0x6F, 0xBE, 0x2B, 0xBE, 0x62, 0xFC, 0xED, 0xCF, 0xCC, 0x39, 0x73, 0x66, 0x66, 0x81, 0xF2, 0xF3,
-    0x33, 0x4D, 0xB7, 0xD1, 0xF4, 0x99, 0xC6, 0xA9, 0x81, 0x9A, 0x4A, 0xF7, 0xEA, 0x15, 0x55, 0xFC,
-    0x3A, 0x21, 0xC8, 0x9B, 0x05, 0x51, 0x64, 0xAA, 0xE4, 0x37, 0x99, 0xEA, 0xBD, 0x92, 0xC1, 0xAF,
-    0x4E, 0xD0, 0x26, 0x77, 0xA0, 0x5D, 0xAA, 0x8C, 0x2E, 0xF9, 0x0D, 0xDD, 0x11, 0x13, 0x5A, 0x91,
-    0x19, 0x5E, 0x64, 0x40, 0x2D, 0x3B, 0x63, 0xC4, 0x05, 0x77, 0x7E, 0xF7, 0x14, 0x26, 0x6E, 0x91,
-    0x9F, 0x93, 0x08, 0x51, 0x78, 0x57, 0x46, 0x40, 0xFE, 0x8B, 0xBC, 0xDE, 0x1E, 0x90, 0xAC, 0x4E,
-    0xAD, 0x24, 0x34, 0x07, 0x62, 0x9C, 0xD1, 0x33, 0xB6, 0x0C, 0x4E, 0x86, 0xF8, 0xCB, 0x0E, 0x9F,
-    0xFD, 0xD6, 0xAE, 0xE8, 0x97, 0x38, 0x9E, 0x26, 0x27, 0x3E, 0x93, 0x86, 0xCF, 0x71, 0x6A, 0x37,
-    0x84, 0xF7, 0x19, 0xFD, 0x0C, 0xD2, 0xAC, 0x85, 0xE0, 0x19, 0x61, 0x23, 0x9B, 0x57, 0xDF, 0x91,
-    0x4F, 0x4F, 0x0C, 0x21, 0x06, 0x7F, 0x2B, 0x1A, 0x31, 0x44, 0xE6, 0x43, 0x78, 0x45, 0x27, 0xD7,
-    0xF0, 0x38, 0xCA, 0x35, 0xF0, 0xE0, 0x96, 0xE6, 0xFD, 0x81, 0x46, 0x26, 0x0A, 0xA1, 0xA6, 0x61,
-    0x0C, 0xC6, 0x62, 0x2A, 0x3D, 0x79, 0x21, 0xFE, 0x95, 0xE0, 0xA4, 0x4D, 0xA8, 0x77, 0x72, 0x69,
-    0xB3, 0x82, 0xA7, 0x36, 0xE3, 0x34, 0xD3, 0xC8, 0xE8, 0x33, 0x09, 0xF8, 0xDD, 0xEF, 0xCC, 0x80,
-    0xDA, 0x36, 0x62, 0xF0, 0xCC, 0x56, 0x0E, 0x05, 0xDD, 0x75, 0x65, 0x42, 0xAB, 0x58, 0x92, 0xF4,
-    0xE0, 0x67, 0xDD, 0x47, 0x04, 0x89, 0xE7, 0x9A, 0xB4, 0x97, 0x30, 0xE3, 0x34, 0x08, 0xAA, 0x5C,
-    0x67, 0xCA, 0xDC, 0x2D, 0xE8, 0xC7, 0x08, 0xB7, 0xDB, 0xAA, 0xE5, 0x6A, 0x3A, 0x0D, 0xEE, 0xA0,
-    0xF0, 0x7E, 0x25, 0x8D, 0x7E, 0xEA, 0x47, 0x1C, 0x8E, 0x78, 0xAB, 0x4F, 0xF8, 0x7C, 0xFC, 0x62,
-    0xD4, 0x2D, 0x66, 0x35, 0xF5, 0x13, 0xBA, 0x99, 0xA6, 0x5D, 0xBA, 0xB9, 0x78, 0xFA, 0x44, 0x87,
-    0x66, 0xE3, 0xBD, 0x3A, 0x37, 0x6B, 0x81, 0xAB, 0x34, 0x2E, 0x34, 0x1C, 0x84, 0x51, 0x8C, 0x87,
-    0xC1, 0x2B, 0xEA, 0xA0, 0x60, 0x63, 0xAD, 0x9C, 0x2B, 0x65, 0xE9, 0x34, 0x0F, 0x63, 0x5F, 0x2B,
-    0x67, 0xB2, 0x9F, 0xBC, 0xE6, 0x73, 0xA2, 0x4E, 0xB5, 0x1E, 0x30, 0x3E, 0x43, 0xE8, 0x4A, 0xEB,
-    0x1F, 0xB4, 0xFE, 0xB6, 0x4D, 0x09, 0x09, 0x68, 0xBB, 0x15, 0x43, 0x3B, 0x15, 0x96, 0xCA, 0xCC,
-    0xB5, 0x7A, 0x6B, 0x77, 0xB5, 0xD6, 0x0F, 0xF7, 0x7F, 0x18, 0x19, 0x37, 0x88, 0xBC, 0x96, 0x7F,
-    0x9F, 0x41, 0xB5, 0x67, 0x7D, 0x14, 0x6B, 0x54, 0xBF, 0x83, 0x16, 0xBB, 0xC1, 0x17, 0x12, 0x27,
-    0xB3, 0xBD, 0x6E, 0x33, 0x5F, 0x13, 0xD5, 0x3A, 0xCE, 0x58, 0x30, 0x51, 0x23, 0x6A, 0x6A, 0x57,
-    0xC5, 0x41, 0xF4, 0x2F, 0x2C, 0x5A, 0x52, 0xCE, 0xEC, 0x31, 0x75, 0x08, 0x5A, 0x58, 0x82, 0x99,
-    0x43, 0x29, 0x4F, 0x6F, 0x0E, 0x5E, 0xCE, 0xDB, 0xD7, 0x3D, 0xC4, 0x23, 0x82, 0x1E, 0x1D, 0x1B,
-    0x5F, 0x0E, 0x0A, 0xA1, 0x15, 0xCD, 0xCD, 0xDE, 0xC8, 0x57, 0x29, 0x4C, 0xF5, 0xE2, 0x27, 0x56,
-    0x08, 0xA1, 0x49, 0xF8, 0x13, 0x39, 0x4C, 0x97, 0x6B, 0x37, 0xEB, 0x0D, 0x51, 0xD5, 0x64, 0xAB,
-    0xAD, 0xF5, 0x6A, 0x49, 0x84, 0x71, 0x8F, 0xF0, 0x72, 0x28, 0x41, 0xFF, 0xB0, 0x6F, 0x34, 0xD0,
-    0xA0, 0xCC, 0xE0, 0xB7, 0x07, 0x37, 0x5C, 0x6F, 0xD2, 0x2A, 0x49, 0xB0, 0x2C, 0x9F, 0xB2, 0x73,
-    0xFB, 0xF9, 0xB9, 0x31, 0x47, 0xC4, 0xFF, 0xCE, 0xFB, 0x3B, 0xE7, 0x67, 0xFE, 0x95, 0x9D, 0x5F,
-    0x6B, 0xAD, 0x9C, 0x4E, 0x86, 0xD5, 0x43, 0xF7, 0x45, 0x6B, 0xC3, 0x04, 0x75, 0x0B, 0x97, 0xDB,
-    0xB9, 0x00, 0x61, 0x61, 0x91, 0xD9, 0xE8, 0xEC, 0x83, 0xA9, 0xCF, 0x77, 0x46, 0xFB, 0xC4, 0x29,
-    0x74, 0x32, 0xF6, 0x6B, 0x23, 0x30, 0x35, 0x95, 0x82, 0x0C, 0xDF, 0x23, 0xEE, 0x6D, 0x0A, 0x6F,
-    0xDF, 0xB1, 0xCB, 0x7A, 0x3A, 0x3D, 0xD6, 0x33, 0xF7, 0xE4, 0xFC, 0xD8, 0xA7, 0xEE, 0xED, 0xBB,
-    0xC3, 0x8E, 0xC3, 0x78, 0x7E, 0xFC, 0xBB, 0xDA, 0x6E, 0xBC, 0x7D, 0x9A, 0x3A, 0x4B, 0xC5, 0x68,
-    0x6B, 0x3F, 0xB1, 0x09, 0x2E, 0xA0, 0x25, 0x38, 0x6C, 0x90, 0x37, 0xAB, 0xC6, 0xE2, 0x4A, 0x92,
-    0xA5, 0xF6, 0xFD, 0xF4, 0x8D, 0x0D, 0xFE, 0x6E, 0xC3, 0xB6, 0xD9, 0x1B, 0xB0, 0x94, 0xAE, 0x74,
-    0x56, 0xDF, 0x2E, 0xDD, 0x2A, 0x5D, 0x54, 0x89, 0x77, 0x1F, 0xAC, 0x2F, 0x3F, 0xF5, 0x4E, 0x28,
-    0xE2, 0x1C, 0xF6, 0x76, 0x2D, 0xDA, 0x2D, 0x07, 0x3E, 0x3E, 0x09, 0xB4, 0x83, 0xD9, 0xEB, 0xA2,
-    0x22, 0x3F, 0x97, 0x72, 0xF3, 0xC9, 0xE6, 0x6B, 0x21, 0xAE, 0x4A, 0x49, 0xAF, 0x88, 0xF8, 0x14,
-    0xCE, 0x98, 0xFD, 0x33, 0x7C, 0x24, 0x75, 0xF1, 0x63, 0x29, 0x02, 0xBE, 0x7D, 0x01, 0x94, 0xD6,
-    0x28, 0xD2, 0x5B, 0x4B, 0xB8, 0xD2, 0x9A, 0xD1, 0x16, 0xA5, 0x34, 0xCE, 0x46, 0x83, 0xA1, 0x57,
-    0x9B, 0xC6, 0x7C, 0x73, 0xCB, 0x45, 0xDD, 0xB9, 0xD2, 0x74, 0x83, 0x0D, 0x6B, 0x94, 0x63, 0x50,
-    0x2C, 0x25, 0x27, 0x96, 0xFA, 0xDF, 0xC0, 0x67, 0xFC, 0x5E, 0x3C, 0xDF, 0xE1, 0x9E, 0xEB, 0x9D,
-    0xD6, 0xC6, 0x9A, 0xD7, 0x9F, 0x0D, 0xF8, 0xE9, 0x57, 0x45, 0xFA, 0x00,
+static const uint8_t opendyslexic_12_bolditalicBitmaps[32859] = {
+    0xD5, 0x9B, 0xBF, 0xEF, 0x26, 0xC7, 0x7D, 0xDF, 0x5F, 0xB3, 0xA3, 0xBB, 0x8D, 0xB9, 0xC5, 0xB8,
+    0xF0, 0x09, 0x48, 0x68, 0x64, 0x53, 0xA4, 0x08, 0x68, 0xC4, 0xFB, 0x0F, 0x90, 0x9E, 0x95, 0xAE,
+    0x50, 0xA1, 0x42, 0x57, 0xDC, 0x25, 0x40, 0x58, 0x08, 0x01, 0x5C, 0x44, 0x34, 0x82, 0x6B, 0x5D,
+    0x50, 0xDA, 0x55, 0x58, 0xB0, 0x48, 0xE1, 0x4B, 0xA1, 0x34, 0x2E, 0x7C, 0x05, 0x15, 0x48, 0x5F,
+    0x15, 0x4C, 0xE1, 0x22, 0x02, 0x28, 0xEE, 0x08, 0x04, 0xC2, 0xC2, 0x85, 0x57, 0xA6, 0x1D, 0x15,
+    0x2A, 0xBC, 0x22, 0x4E, 0x90, 0x42, 0x03, 0xE1, 0x50, 0x5C, 0x46, 0x73, 0xBC, 0xD9, 0x7D, 0xA7,
+    0x98, 0x7D, 0x9E, 0xEF, 0xF7, 0x78, 0x54, 0xC4, 0x40, 0x4E, 0xC4, 0x2C, 0x0E, 0xF7, 0x7C, 0x9F,
+    0x7D, 0x76, 0x76, 0x66, 0x3E, 0xF3, 0x99, 0xCF, 0x8F, 0xF7, 0xFB, 0x33, 0x00, 0xF0, 0x4F, 0xC1,
+    0x06, 0xF8, 0x1A, 0x34, 0x0B, 0x64, 0x68, 0x03, 0x36, 0x81, 0xEF, 0x69, 0x22, 0x08, 0xDC, 0x42,
+    0x95, 0xC1, 0x07, 0xEA, 0x04, 0x53, 0x8F, 0x8B, 0x30, 0x80, 0x99, 0xE1, 0x33, 0x3C, 0x79, 0x75,
+    0x11, 0x2B, 0x98, 0x16, 0xDC, 0x4E, 0xA5, 0x19, 0xBF, 0x51, 0x2B, 0x30, 0x24, 0x9F, 0xDD, 0xE6,
+    0x76, 0xAB, 0xCF, 0x6B, 0x9C, 0xE6, 0x61, 0x69, 0x93, 0x4B, 0x56, 0x56, 0x28, 0x68, 0xEE, 0x52,
+    0x97, 0xAE, 0x7F, 0xBB, 0xBA, 0x00, 0x68, 0x83, 0xEF, 0x01, 0x76, 0x93, 0x01, 0xEA, 0xE8, 0x16,
+    0x00, 0x1F, 0x86, 0x72, 0xBB, 0xCA, 0x00, 0x4D, 0x74, 0x0B, 0x54, 0x92, 0x24, 0xD1, 0x4A, 0x92,
+    0x22, 0xE5, 0xEB, 0x68, 0xEE, 0x4C, 0x7F, 0xA3, 0x6F, 0xDC, 0x86, 0x6A, 0xB3, 0x19, 0xC0, 0xC5,
+    0x6E, 0x06, 0x98, 0x46, 0x01, 0xD8, 0x5C, 0x27, 0x60, 0x90, 0x24, 0x05, 0x2B, 0x49, 0xDA, 0xE8,
+    0x8E, 0x97, 0xDC, 0x19, 0x3E, 0x98, 0x7E, 0x72, 0x07, 0xD0, 0xE7, 0x04, 0xD0, 0x64, 0x97, 0x00,
+    0x7C, 0xF4, 0x33, 0x60, 0xF4, 0x79, 0x01, 0x5C, 0xFF, 0xD6, 0xF5, 0x57, 0x1E, 0x9F, 0x7B, 0x19,
+    0xEF, 0x02, 0xD0, 0xF5, 0x80, 0xD9, 0x80, 0xA7, 0xA5, 0x11, 0x2B, 0x65, 0x18, 0xA4, 0x19, 0xAB,
+    0xB7, 0x1E, 0x42, 0xB7, 0xBA, 0x00, 0xEA, 0x07, 0xB0, 0x5B, 0x95, 0xA0, 0xDD, 0xBF, 0x34, 0x83,
+    0x97, 0x80, 0x49, 0xEA, 0x61, 0x92, 0xC6, 0xA3, 0x39, 0x48, 0x80, 0x55, 0xE6, 0x9F, 0xD1, 0x2A,
+    0x56, 0xEA, 0x27, 0x8D, 0x5E, 0x52, 0xB6, 0x92, 0x14, 0x9E, 0x96, 0xB4, 0x62, 0x26, 0x25, 0x00,
+    0x17, 0x00, 0x3C, 0x40, 0x91, 0x61, 0xB3, 0x3C, 0x36, 0xCE, 0x5B, 0x97, 0x0F, 0x65, 0x9A, 0x05,
+    0x37, 0x1B, 0x45, 0x36, 0xDC, 0xCD, 0xB9, 0x59, 0xF8, 0x2F, 0xAE, 0x9F, 0xB0, 0xE1, 0xD9, 0x3A,
+    0xE2, 0x3E, 0x1F, 0x07, 0xF0, 0xFA, 0xC2, 0x0A, 0x53, 0xF2, 0x3D, 0xBC, 0x7E, 0xB3, 0x88, 0xE2,
+    0xBF, 0x26, 0xA8, 0xF2, 0x94, 0xA1, 0x7B, 0x33, 0x44, 0xAA, 0xED, 0x39, 0x1B, 0x68, 0xE7, 0xD8,
+    0x62, 0xF6, 0xFA, 0xFB, 0x09, 0x17, 0x5B, 0x05, 0x84, 0xDF, 0x70, 0x91, 0x6E, 0x44, 0x3D, 0x00,
+    0xE6, 0xF5, 0x1E, 0x06, 0x05, 0xEA, 0xB5, 0x1D, 0xF1, 0xB4, 0x98, 0xC8, 0x8B, 0x34, 0xC1, 0x46,
+    0xBA, 0xDE, 0x8F, 0xF8, 0x26, 0xC3, 0xA4, 0x00, 0x4A, 0xD0, 0x0A, 0x8C, 0x36, 0x5E, 0x69, 0x3F,
+    0xD8, 0xEC, 0xAA, 0xCF, 0x6D, 0xDD, 0x9B, 0xB9, 0xDA, 0xF7, 0x36, 0x56, 0x8A, 0xD3, 0x07, 0x77,
+    0x65, 0x24, 0x6D, 0x56, 0xD2, 0x5A, 0x4B, 0x3F, 0xEC, 0x2B, 0x9D, 0x56, 0xE4, 0x99, 0x57, 0x7C,
+    0xF2, 0xAB, 0x5F, 0xBB, 0xB5, 0xCD, 0x2E, 0xBB, 0xAD, 0xD9, 0x81, 0xDF, 0xEF, 0xA1, 0x59, 0xA1,
+    0xDA, 0x81, 0x69, 0x84, 0x36, 0x82, 0xCD, 0x80, 0x7A, 0x68, 0x97, 0xE3, 0xCB, 0x74, 0xF5, 0xCB,
+    0x30, 0x42, 0x13, 0x81, 0x1D, 0x68, 0xE7, 0xE3, 0xAE, 0x1F, 0xA1, 0x4E, 0xC7, 0xB3, 0x4D, 0x04,
+    0x04, 0xB8, 0x27, 0xFF, 0x58, 0x8F, 0x97, 0x37, 0x09, 0x98, 0x02, 0xD4, 0x19, 0xF0, 0x33, 0x58,
+    0x51, 0x06, 0x80, 0x01, 0x9E, 0x1E, 0x4F, 0xCF, 0x8C, 0x57, 0x5A, 0xB9, 0x08, 0x66, 0x07, 0xBA,
+    0xF9, 0xCA, 0x70, 0xDC, 0x69, 0x38, 0x5D, 0x00, 0x9B, 0x8E, 0xAE, 0xDA, 0xF9, 0xCA, 0x97, 0x2E,
+    0x40, 0xBD, 0x1E, 0x8D, 0xFD, 0xD1, 0xA6, 0xCC, 0x14, 0xF0, 0xA1, 0x4C, 0xB0, 0x49, 0x60, 0xF7,
+    0xA3, 0xAF, 0x21, 0x40, 0x17, 0xC1, 0x25, 0xB0, 0x1B, 0xD0, 0x83, 0xB9, 0x0F, 0x2E, 0xF0, 0x4F,
+    0x86, 0xE6, 0xE6, 0x07, 0x0F, 0x73, 0x27, 0xC5, 0x41, 0x1B, 0x4E, 0xA3, 0x91, 0xE6, 0x41, 0xFA,
+    0xF1, 0xBE, 0xED, 0xF6, 0xAD, 0x78, 0xFF, 0x33, 0x6D, 0x80, 0xEF, 0x5E, 0xD1, 0x30, 0x1B, 0xA1,
+    0x0D, 0xF0, 0x3A, 0xD8, 0x15, 0xDA, 0xB9, 0x92, 0xF4, 0x25, 0x29, 0x7B, 0x69, 0x61, 0x80, 0x2A,
+    0x83, 0x5B, 0xC0, 0xF7, 0x45, 0x45, 0x87, 0x54, 0x29, 0xB8, 0x1D, 0x1F, 0x2B, 0xF5, 0x2E, 0xA3,
+    0xB9, 0xD9, 0x79, 0xE6, 0x3E, 0x5E, 0xFA, 0xA1, 0x94, 0x27, 0x29, 0x98, 0xDB, 0xED, 0xA2, 0x2F,
+    0x6C, 0xFE, 0x3D, 0x85, 0xD2, 0x89, 0x29, 0x1F, 0x75, 0xF9, 0x5A, 0xF4, 0xF9, 0xA4, 0xEA, 0x75,
+    0x2C, 0xE3, 0x48, 0x5C, 0xEE, 0x82, 0x22, 0x34, 0x60, 0x2A, 0x1F, 0xC5, 0xCC, 0xD0, 0x1D, 0xED,
+    0xE7, 0xF2, 0x51, 0x1A, 0xD6, 0xEB, 0x27, 0x68, 0x3F, 0x5E, 0x6D, 0xDF, 0x7E, 0x6C, 0xFB, 0xD2,
+    0xB0, 0xDA, 0x3E, 0xAE, 0xFD, 0x50, 0xDA, 0xFB, 0xA3, 0xFD, 0x72, 0xB5, 0x7D, 0xF3, 0xB1, 0xED,
+    0x75, 0x7C, 0x94, 0x81, 0x0F, 0xE1, 0x6A, 0xFB, 0xEE, 0x68, 0x5F, 0x3E, 0x9A, 0x72, 0xD3, 0xF6,
+    0x57, 0x25, 0xC5, 0xB1, 0xAA, 0x8A, 0xE0, 0x15, 0xB1, 0x5B, 0xB3, 0xD0, 0x05, 0x17, 0xCC, 0x86,
+    0xC7, 0xBD, 0x37, 0x67, 0x86, 0x3F, 0x7B, 0x33, 0x56, 0x79, 0xEA, 0x82, 0x7B, 0x3F, 0x8B, 0xE1,
+    0x4F, 0x7E, 0x9A, 0xAA, 0xCD, 0x77, 0xB3, 0x5B, 0xFF, 0xB5, 0xF0, 0xB3, 0x4B, 0x28, 0x14, 0x83,
+    0x89, 0x93, 0x22, 0x9D, 0x34, 0x32, 0x28, 0xC1, 0xA4, 0x11, 0x86, 0x05, 0xE0, 0xEE, 0xC8, 0x90,
+    0x68, 0xD5, 0x57, 0x8A, 0x3C, 0xB7, 0x73, 0xAD, 0x9D, 0x9F, 0xF4, 0x21, 0x46, 0xD0, 0x2D, 0xD8,
+    0x0D, 0x86, 0xD9, 0x16, 0xCD, 0x78, 0x59, 0x5A, 0x25, 0x01, 0xD7, 0x7A, 0x18, 0x34, 0xE2, 0x25,
+    0xAC, 0xB4, 0x32, 0xF4, 0xD3, 0xF8, 0xD4, 0xE5, 0xDE, 0x6B, 0x12, 0x18, 0x51, 0x7A, 0x6C, 0x33,
+    0x38, 0x41, 0xA3, 0x99, 0x5A, 0x2B, 0x95, 0x36, 0x98, 0xD4, 0xD3, 0x4A, 0xD1, 0x4A, 0xC2, 0x4B,
+    0xB1, 0x91, 0x76, 0xB8, 0x36, 0x2D, 0x20, 0x2D, 0x74, 0x52, 0x6F, 0xEF, 0x55, 0x89, 0xA2, 0xA8,
+    0x26, 0x1D, 0x0A, 0xD1, 0x46, 0x1A, 0x6D, 0xC5, 0xE0, 0x76, 0x5A, 0x31, 0x77, 0x14, 0x4E, 0x9B,
+    0x3E, 0xD4, 0x7D, 0x9B, 0x91, 0xD4, 0x1F, 0x6F, 0xDE, 0x18, 0xA4, 0x9E, 0x69, 0xEF, 0x01, 0xFE,
+    0x6D, 0xB1, 0xF8, 0x75, 0x2E, 0x43, 0x1A, 0x12, 0xE6, 0xD1, 0x4A, 0xFD, 0xD3, 0x48, 0xFB, 0xEF,
+    0x23, 0x83, 0x8B, 0x26, 0xBB, 0xA5, 0x8E, 0xDD, 0xDC, 0x4A, 0x9B, 0x97, 0xF2, 0x20, 0xE5, 0x1B,
+    0xFF, 0x4A, 0x0F, 0x40, 0x3D, 0x46, 0xC5, 0x26, 0xD8, 0xFD, 0x72, 0xB1, 0x6A, 0x29, 0x56, 0x52,
+    0x42, 0xDA, 0xF0, 0xC7, 0x50, 0xDD, 0x52, 0xF6, 0x97, 0xD1, 0x87, 0x30, 0x69, 0xC5, 0x4B, 0xFD,
+    0x53, 0xDF, 0xB8, 0x7B, 0xEC, 0x70, 0x23, 0x7A, 0x34, 0x3E, 0x67, 0x14, 0x5A, 0x29, 0x3A, 0x29,
+    0x1E, 0xAF, 0x59, 0x78, 0x7A, 0x1F, 0x01, 0xCC, 0x57, 0x6E, 0x51, 0x69, 0xC7, 0x48, 0x0B, 0x93,
+    0x36, 0xDA, 0x07, 0x65, 0x9F, 0xF2, 0x3A, 0xE0, 0x7E, 0xF4, 0x90, 0x4A, 0xE5, 0xBD, 0xA1, 0xD6,
+    0x0F, 0x77, 0xA6, 0xD9, 0x45, 0x97, 0x10, 0xC2, 0x2D, 0x2E, 0x56, 0x1B, 0x62, 0x0A, 0x4E, 0x5A,
+    0x91, 0x76, 0xAC, 0x34, 0xD2, 0x94, 0x57, 0x23, 0xE9, 0x0D, 0x69, 0xEF, 0xA4, 0x15, 0x33, 0x04,
+    0xCC, 0x56, 0x74, 0x7A, 0x1A, 0xB1, 0xB9, 0x58, 0x18, 0xF5, 0xB8, 0x0C, 0xC3, 0x82, 0x15, 0xB4,
+    0x09, 0x34, 0x53, 0x0B, 0xFC, 0x4A, 0xA5, 0x80, 0xDB, 0x01, 0xBA, 0x54, 0x16, 0xA0, 0xD9, 0xA7,
+    0x60, 0x76, 0x36, 0xFC, 0xE8, 0x42, 0xBD, 0x9A, 0xCC, 0xD0, 0x0F, 0xA1, 0xDE, 0xEE, 0xAE, 0x74,
+    0xDA, 0x61, 0x10, 0x4C, 0xCA, 0xF8, 0xA5, 0x5B, 0xDC, 0x8A, 0x8C, 0x70, 0xB1, 0x5B, 0xAA, 0xBD,
+    0xD2, 0x7F, 0xD4, 0xDC, 0x49, 0xD9, 0x48, 0xA2, 0x91, 0x02, 0x4F, 0x69, 0x04, 0x7E, 0xEF, 0x01,
+    0x34, 0x4A, 0x20, 0x25, 0xDC, 0xEA, 0x22, 0x13, 0x2E, 0xD8, 0x88, 0xA7, 0x1D, 0xC9, 0xBC, 0x46,
+    0x13, 0x6D, 0xC4, 0x07, 0x37, 0xD7, 0x3B, 0xFE, 0x91, 0x56, 0x06, 0x29, 0x30, 0x49, 0x70, 0xF7,
+    0x51, 0x02, 0xBA, 0x60, 0xA8, 0x76, 0xDA, 0x5D, 0x91, 0x49, 0xEA, 0xAD, 0xB4, 0xF2, 0x94, 0xCE,
+    0x4B, 0xD7, 0x46, 0xA6, 0x60, 0x77, 0xBA, 0x84, 0xE6, 0xE6, 0xD8, 0xAF, 0xE7, 0x4B, 0x34, 0x19,
+    0x1F, 0x2B, 0x8D, 0x6E, 0x67, 0x28, 0x3B, 0xBD, 0xDA, 0xB1, 0x3B, 0xF5, 0x86, 0xDB, 0x68, 0x33,
+    0x3E, 0x7F, 0x34, 0xB0, 0xBA, 0xB8, 0x8F, 0x16, 0xA3, 0x50, 0x69, 0xB4, 0xA2, 0x29, 0x4F, 0xAD,
+    0xC7, 0x96, 0x2B, 0xAF, 0xE8, 0x4F, 0xF6, 0x6F, 0xC8, 0x60, 0x24, 0xA8, 0xB5, 0x43, 0xAB, 0x04,
+    0x83, 0x16, 0x18, 0x34, 0x83, 0x53, 0x80, 0x4A, 0xBA, 0x07, 0x92, 0x1E, 0x60, 0x26, 0x29, 0xC1,
+    0x5D, 0xA9, 0x87, 0x4E, 0x0B, 0xF0, 0x74, 0x06, 0xB8, 0x0E, 0xF0, 0x3B, 0x4C, 0xCA, 0x95, 0x94,
+    0x6B, 0x29, 0x5F, 0xBB, 0x75, 0x74, 0x75, 0xE3, 0x85, 0x7B, 0x4E, 0x5A, 0x5A, 0x69, 0xF1, 0xFB,
+    0xC5, 0xBD, 0x72, 0xF3, 0xA9, 0x4B, 0x8B, 0xA9, 0x85, 0xB2, 0x81, 0xA9, 0xB4, 0x73, 0x0C, 0xA1,
+    0x8C, 0xC1, 0x48, 0x40, 0xAB, 0x11, 0x33, 0x69, 0xE6, 0xAE, 0x94, 0x1A, 0x49, 0x63, 0x23, 0x3D,
+    0xC0, 0xEA, 0x21, 0x18, 0xDD, 0x03, 0xFE, 0xF0, 0xCA, 0xDC, 0x9B, 0x87, 0xD0, 0x2A, 0xD3, 0x48,
+    0xD1, 0xE8, 0xDE, 0x30, 0x36, 0x63, 0x95, 0xF9, 0x6D, 0xBA, 0x50, 0x3C, 0x49, 0xF1, 0xC7, 0xEB,
+    0xC9, 0xF9, 0x2D, 0xD0, 0x64, 0x78, 0x5A, 0x65, 0xB2, 0x95, 0x16, 0xF0, 0xF1, 0xD8, 0x5A, 0xC3,
+    0x0C, 0x2E, 0x83, 0xD9, 0x7B, 0xF8, 0x9D, 0x27, 0xE2, 0xD7, 0x1B, 0x87, 0x0D, 0x36, 0x2A, 0xC1,
+    0x6C, 0xF1, 0xD3, 0xD3, 0xE3, 0x01, 0xD4, 0xDD, 0x87, 0x50, 0xF6, 0x1E, 0x0C, 0x0F, 0xEF, 0xCE,
+    0xD0, 0xAE, 0x74, 0xC5, 0x6A, 0xAF, 0xC5, 0x08, 0x8C, 0xF8, 0xE6, 0x7F, 0xF0, 0x2C, 0xEE, 0x6D,
+    0x2D, 0x36, 0x98, 0xFC, 0xC7, 0xCF, 0xF1, 0x22, 0xFE, 0x4B, 0x55, 0x68, 0xC6, 0x3A, 0xCE, 0xCF,
+    0xB2, 0x32, 0xFD, 0xAE, 0x0D, 0x1D, 0xCD, 0xCF, 0xDF, 0xC9, 0xCD, 0x8C, 0x5A, 0xBD, 0x9C, 0x70,
+    0x71, 0x9A, 0x76, 0x50, 0xCF, 0xD4, 0xD3, 0x14, 0x15, 0x18, 0x1E, 0xF2, 0x6F, 0xC0, 0x4A, 0x0A,
+    0xE0, 0xA4, 0x0C, 0x74, 0x52, 0x00, 0xBA, 0x12, 0xEE, 0x9D, 0x8C, 0x45, 0x91, 0xFC, 0x08, 0x74,
+    0x19, 0xA8, 0x15, 0x80, 0xF2, 0xFC, 0xBB, 0x01, 0xEA, 0xFF, 0xB9, 0x01, 0x6A, 0x67, 0xE8, 0x7E,
+    0xB0, 0x43, 0x9D, 0xDA, 0x05, 0x64, 0x04, 0x7E, 0x69, 0x23, 0x75, 0x46, 0xA0, 0x77, 0x5E, 0x8D,
+    0x78, 0x49, 0x7D, 0xAD, 0xB2, 0xC1, 0x55, 0x22, 0xCD, 0x54, 0xEF, 0xA0, 0xA0, 0x80, 0xCB, 0x7E,
+    0xC5, 0x28, 0xD0, 0x68, 0xEF, 0x8F, 0xD0, 0x56, 0x52, 0x60, 0x08, 0x5F, 0x8E, 0x74, 0x8B, 0xD9,
+    0x70, 0x91, 0x01, 0x9B, 0xF1, 0xA3, 0xD9, 0x19, 0x66, 0x24, 0x2D, 0x78, 0x69, 0xA6, 0x95, 0x36,
+    0x9A, 0xFD, 0x42, 0xC1, 0x6E, 0xB8, 0x15, 0x61, 0x37, 0x86, 0x60, 0xD4, 0x77, 0x1F, 0x3C, 0xAF,
+    0xE0, 0x74, 0xD8, 0xEC, 0xD5, 0x48, 0x4A, 0x4C, 0x52, 0xC2, 0x4B, 0xF7, 0x2E, 0xE7, 0x79, 0x5D,
+    0x0F, 0xA1, 0x91, 0x96, 0xD2, 0xB5, 0x29, 0x5D, 0xEB, 0xD1, 0x8A, 0x53, 0x0F, 0x56, 0x01, 0x98,
+    0x22, 0x65, 0x99, 0xA9, 0x34, 0x52, 0x96, 0x9F, 0x5A, 0x9C, 0xD6, 0xD2, 0x09, 0x40, 0x11, 0x70,
+    0xFA, 0xC9, 0xF3, 0x33, 0x92, 0x36, 0x9A, 0xE3, 0x5D, 0xCA, 0x58, 0x49, 0x23, 0x4E, 0x4A, 0xD0,
+    0x49, 0x3D, 0x34, 0xD2, 0x3D, 0x70, 0xD2, 0x0E, 0x4E, 0xD2, 0x48, 0x2B, 0x69, 0xA1, 0x8B, 0xFF,
+    0x42, 0x11, 0xBF, 0xD0, 0x45, 0xFC, 0x8C, 0x5B, 0x19, 0x02, 0xCD, 0xCA, 0x14, 0x68, 0x56, 0xD4,
+    0xD3, 0x44, 0x23, 0x70, 0xB1, 0x12, 0x74, 0x8B, 0xDD, 0x61, 0x08, 0x76, 0xC3, 0x28, 0xD4, 0x9B,
+    0xB9, 0xAB, 0xBE, 0xD1, 0xE1, 0x4F, 0xB5, 0xE1, 0x24, 0xA5, 0xD3, 0x8B, 0x25, 0xF5, 0x78, 0xE9,
+    0x15, 0xA0, 0xBA, 0x78, 0x55, 0x01, 0x2F, 0xAD, 0xD4, 0xD2, 0x0E, 0xD2, 0xC5, 0x58, 0xA2, 0x05,
+    0xA3, 0xB3, 0xFF, 0xB7, 0x1B, 0xC0, 0xF0, 0xCE, 0x0E, 0x8D, 0x34, 0x83, 0x94, 0xC1, 0x49, 0x23,
+    0x95, 0x00, 0xFC, 0xD5, 0xA7, 0x2E, 0xEE, 0xE3, 0x24, 0x81, 0xA4, 0x48, 0x2B, 0x89, 0x4A, 0x52,
+    0x59, 0x7F, 0xC0, 0x5C, 0x68, 0xA7, 0x92, 0xB6, 0x22, 0xE9, 0x5A, 0x17, 0xB7, 0x4B, 0x60, 0xE2,
+    0xE2, 0x29, 0x60, 0xE9, 0x8E, 0x21, 0x1E, 0xA9, 0xCB, 0xA4, 0x1D, 0x74, 0xE7, 0x76, 0xD9, 0x88,
+    0x46, 0x1C, 0x9B, 0xCE, 0x6E, 0x1C, 0xA1, 0x6F, 0x93, 0x29, 0x31, 0x26, 0x6D, 0x02, 0xBA, 0xF5,
+    0xB4, 0x38, 0x60, 0x26, 0xBD, 0x02, 0x93, 0xB4, 0xD0, 0x4A, 0x1A, 0x8D, 0xA4, 0x8D, 0x56, 0x7F,
+    0x6D, 0xFE, 0x10, 0xAD, 0x40, 0x53, 0xA6, 0x10, 0xCF, 0xAB, 0xEA, 0xF2, 0x71, 0xE3, 0x9B, 0x18,
+    0x8D, 0xB5, 0xB6, 0x66, 0xA3, 0x55, 0xF2, 0x91, 0x41, 0x8B, 0x66, 0x6A, 0xDD, 0xD4, 0x48, 0x37,
+    0x3B, 0xFD, 0xF5, 0x67, 0x45, 0x27, 0x29, 0xE3, 0xA5, 0x62, 0xB4, 0x35, 0x32, 0x48, 0x09, 0x9E,
+    0xD6, 0x83, 0x32, 0xC4, 0x6A, 0xA7, 0xCE, 0xD8, 0x8D, 0x26, 0x63, 0x37, 0x5C, 0xA2, 0xCE, 0xB8,
+    0x95, 0x26, 0xD3, 0x46, 0x5C, 0xC2, 0x47, 0xDA, 0xF5, 0x58, 0xEA, 0x61, 0xC6, 0x47, 0xA6, 0x19,
+    0xBF, 0xA0, 0xC0, 0x34, 0x1B, 0xFD, 0xCD, 0x1D, 0x85, 0xEA, 0x32, 0xA5, 0x1C, 0xCB, 0xFF, 0xB5,
+    0x24, 0xF5, 0xAE, 0x2C, 0xF2, 0x46, 0x23, 0xDA, 0x8C, 0xDB, 0xE9, 0x32, 0xED, 0x86, 0x4F, 0x74,
+    0x19, 0xEA, 0x9F, 0x51, 0x67, 0x9A, 0x84, 0x5B, 0x71, 0x91, 0x36, 0xD2, 0x2D, 0x74, 0x33, 0x3E,
+    0xE0, 0x03, 0xC3, 0xC8, 0xD4, 0x23, 0x8C, 0xA8, 0x84, 0xDD, 0xB1, 0x1B, 0x75, 0xC6, 0x65, 0x5C,
+    0xA6, 0x4D, 0x74, 0x89, 0xDF, 0x5B, 0x4F, 0xE9, 0xF7, 0xC9, 0x08, 0xD4, 0xF9, 0x2C, 0xAD, 0x12,
+    0x31, 0x16, 0x83, 0xE2, 0x17, 0xC0, 0x3C, 0x79, 0x83, 0xCB, 0x1B, 0xF3, 0xF9, 0xC6, 0x91, 0xF8,
+    0xCE, 0x70, 0xE8, 0x4F, 0xB9, 0x31, 0x04, 0x8E, 0x60, 0xE5, 0x3F, 0x4C, 0xEB, 0xC9, 0x1C, 0x49,
+    0x1B, 0xD4, 0xD2, 0x02, 0x5E, 0x1B, 0xF0, 0x47, 0x8F, 0xF9, 0xBD, 0x21, 0x4C, 0x0B, 0xD5, 0x56,
+    0xEF, 0xE0, 0xE2, 0x10, 0x61, 0x78, 0x49, 0x60, 0x37, 0x1F, 0xC1, 0xBD, 0x2F, 0x60, 0xBA, 0xBB,
+    0x82, 0xDD, 0xD5, 0x9F, 0xFC, 0x85, 0x34, 0x82, 0x55, 0x02, 0xBA, 0x62, 0xCC, 0x76, 0x0E, 0x9F,
+    0x46, 0xA7, 0x8D, 0x53, 0x9F, 0x59, 0x19, 0xFC, 0x7B, 0xCA, 0xA0, 0x97, 0x94, 0x69, 0xB6, 0x5A,
+    0x09, 0x1F, 0x9D, 0xD2, 0x91, 0x02, 0xA9, 0x3F, 0xB2, 0x9E, 0x58, 0x8C, 0xF4, 0x11, 0x28, 0x95,
+    0x74, 0xCB, 0xCF, 0xC7, 0x0F, 0x47, 0xE6, 0x53, 0x7E, 0x08, 0x45, 0x32, 0x6D, 0x84, 0x66, 0x97,
+    0x6E, 0x4A, 0xFA, 0xBE, 0xA4, 0x38, 0x49, 0xC9, 0x4B, 0x1B, 0x58, 0x8D, 0x74, 0x09, 0xB7, 0x63,
+    0x34, 0x33, 0x64, 0x9C, 0xA8, 0x14, 0x99, 0x32, 0x4E, 0xA1, 0xD6, 0xC2, 0xA0, 0xDE, 0xAB, 0xAF,
+    0xB4, 0x55, 0xCA, 0x38, 0xA5, 0x56, 0x45, 0x33, 0x35, 0x56, 0xBB, 0xFE, 0x42, 0x1B, 0xEE, 0x17,
+    0x1A, 0xFE, 0x76, 0xC5, 0xFF, 0xA5, 0xF6, 0x29, 0x54, 0xF2, 0x7A, 0x5F, 0xB8, 0x3C, 0xE9, 0xCB,
+    0x09, 0xFF, 0xB6, 0xF2, 0x34, 0x1B, 0x7D, 0x51, 0x6F, 0x09, 0x97, 0x5B, 0xB5, 0x19, 0x1F, 0x87,
+    0xA8, 0xC5, 0x28, 0xE8, 0x25, 0xF5, 0xCD, 0x6E, 0x73, 0x97, 0xF1, 0xEB, 0x61, 0xC7, 0x8A, 0xF7,
+    0xF3, 0x0B, 0x3E, 0xD0, 0x25, 0xDA, 0x05, 0x27, 0x5C, 0xA4, 0x56, 0xB0, 0x99, 0x4A, 0x6B, 0xB5,
+    0x83, 0x76, 0x04, 0x83, 0x82, 0x0F, 0x74, 0x8A, 0xDD, 0x82, 0x7B, 0x94, 0xDD, 0x4A, 0xBD, 0x4D,
+    0x5F, 0xC8, 0x58, 0x75, 0x6F, 0xEF, 0xA0, 0x37, 0xB3, 0x7A, 0x86, 0xF7, 0x34, 0x04, 0x7C, 0xF2,
+    0x5A, 0x70, 0x9B, 0xD3, 0x4A, 0x23, 0xAB, 0x8C, 0x55, 0x98, 0x76, 0x8C, 0x96, 0x56, 0x3D, 0xD3,
+    0x5A, 0x2B, 0xE0, 0x73, 0xF1, 0xF8, 0x98, 0x29, 0x95, 0xB0, 0x75, 0x86, 0xE6, 0xB0, 0x94, 0xFF,
+    0x49, 0x33, 0x6E, 0xA7, 0x4D, 0x34, 0x3B, 0x95, 0xA8, 0xF7, 0x12, 0xF2, 0x83, 0x5B, 0x8D, 0x7A,
+    0xEC, 0xC6, 0x14, 0x40, 0xBD, 0x5F, 0x60, 0x08, 0x6D, 0x84, 0x36, 0x36, 0x19, 0x5C, 0xAA, 0x04,
+    0x76, 0x43, 0x23, 0x56, 0xF8, 0x48, 0xA5, 0xD1, 0xE9, 0xDE, 0xF3, 0x9A, 0xED, 0x25, 0xDC, 0xB3,
+    0xD2, 0x49, 0x4A, 0x58, 0x49, 0x89, 0x62, 0x21, 0x31, 0xD3, 0x55, 0x8F, 0x51, 0xF4, 0xAF, 0x28,
+    0xA6, 0x28, 0x99, 0x4B, 0xBD, 0x9A, 0xAD, 0x78, 0x28, 0x84, 0x5B, 0x18, 0x46, 0xB7, 0xE2, 0x7F,
+    0xF2, 0x6A, 0x2E, 0x16, 0xBE, 0x3E, 0x19, 0x43, 0x50, 0x89, 0x32, 0x1F, 0x1C, 0x9B, 0xCB, 0x25,
+    0xA0, 0xDE, 0x81, 0x4A, 0x3D, 0xA0, 0x00, 0x0C, 0xF1, 0x88, 0x58, 0x8F, 0xE0, 0x15, 0xF8, 0x47,
+    0xF7, 0x00, 0x73, 0xA8, 0xB0, 0x32, 0xD4, 0x92, 0x02, 0xB5, 0xC6, 0x61, 0xA5, 0x56, 0x6F, 0xF7,
+    0x02, 0x94, 0x85, 0x4A, 0xD0, 0x46, 0x34, 0x52, 0x67, 0xA6, 0x80, 0x11, 0x7E, 0x81, 0x69, 0x74,
+    0x11, 0xFC, 0x52, 0x67, 0x70, 0x6B, 0x25, 0xA8, 0x33, 0xD3, 0xF8, 0x19, 0xBB, 0xE3, 0x63, 0xF3,
+    0x57, 0xC2, 0xED, 0xFF, 0x52, 0x1A, 0x8B, 0xBD, 0x61, 0x90, 0x34, 0xE3, 0x24, 0x2D, 0x18, 0x49,
+    0x0B, 0x74, 0x52, 0x3A, 0x83, 0x49, 0x38, 0x15, 0xB3, 0xB9, 0x03, 0x78, 0xCD, 0x97, 0xC1, 0xE8,
+    0xDE, 0x53, 0x49, 0x11, 0x2B, 0x25, 0x6C, 0x34, 0x99, 0x26, 0x9A, 0x8C, 0x5B, 0xAA, 0x8C, 0x9B,
+    0x6D, 0xA2, 0x0B, 0xF5, 0x8A, 0x0F, 0x5D, 0x2C, 0x1E, 0x7C, 0x92, 0xFA, 0xB2, 0xF1, 0x8A, 0x8C,
+    0x66, 0x61, 0x85, 0x7A, 0x2B, 0x34, 0x36, 0x3B, 0x1A, 0xDD, 0x56, 0x69, 0x6C, 0x37, 0xAB, 0xD0,
+    0x65, 0xAB, 0xE0, 0x73, 0x7D, 0x4A, 0xD9, 0xA9, 0xA6, 0x87, 0x87, 0x6B, 0x72, 0xD2, 0x82, 0xD3,
+    0xDF, 0xC5, 0x22, 0x4C, 0xBB, 0x9F, 0x8D, 0xCE, 0x10, 0x80, 0x6E, 0x3B, 0x6F, 0xF5, 0x93, 0x0F,
+    0x9B, 0x61, 0x50, 0x06, 0xEE, 0x16, 0x48, 0xEC, 0x70, 0xF1, 0x2B, 0xCD, 0x8E, 0x1E, 0xB4, 0xEA,
+    0x25, 0x69, 0x94, 0xA4, 0xB1, 0xB8, 0xCE, 0xBB, 0x7A, 0x00, 0xD7, 0xEE, 0xDC, 0xB9, 0x73, 0xA7,
+    0x93, 0xB4, 0x7B, 0x95, 0xBC, 0x4B, 0x79, 0x90, 0x94, 0x0B, 0x0C, 0xF4, 0x71, 0x9E, 0xC9, 0xAD,
+    0x27, 0x4B, 0xEA, 0xE3, 0xC9, 0x40, 0x0E, 0xF3, 0x61, 0x14, 0x50, 0x00, 0x53, 0x42, 0xDB, 0xFE,
+    0x08, 0x0F, 0xAD, 0xCE, 0xDE, 0xA9, 0xCB, 0xB4, 0xF9, 0xB0, 0xEA, 0x3E, 0xE2, 0x13, 0x43, 0xC4,
+    0x47, 0xA6, 0x85, 0x21, 0xA2, 0x99, 0x69, 0x41, 0x01, 0x05, 0x34, 0xA2, 0x60, 0xD4, 0x1B, 0x8D,
+    0x95, 0xA8, 0x4E, 0x1A, 0x61, 0x37, 0xEC, 0x4E, 0x9D, 0xA9, 0x37, 0x9A, 0x93, 0x8D, 0xEF, 0x12,
+    0x4E, 0xEF, 0x6A, 0xC5, 0x49, 0x8A, 0xB8, 0xF3, 0x6A, 0x07, 0x1A, 0x49, 0x60, 0xF4, 0x58, 0x2C,
+    0x78, 0x48, 0x51, 0x5F, 0x8E, 0x30, 0xBD, 0x99, 0x61, 0xF8, 0x81, 0x7A, 0xFC, 0xE2, 0x67, 0xBA,
+    0xE8, 0x12, 0xED, 0x6A, 0x85, 0xCB, 0x28, 0xB8, 0x0D, 0x1F, 0x9B, 0x1D, 0x97, 0x6B, 0x61, 0x75,
+    0x53, 0x3D, 0xFA, 0x2B, 0x05, 0xFC, 0xC3, 0xD3, 0x1A, 0x59, 0x29, 0x1E, 0xC1, 0x6E, 0xA7, 0x4C,
+    0x49, 0x8F, 0x8B, 0x22, 0x4D, 0x02, 0xBA, 0xAB, 0x66, 0xDE, 0x14, 0xBF, 0x9C, 0xBA, 0x04, 0x54,
+    0x3A, 0x82, 0xAF, 0xA5, 0x5B, 0x81, 0x26, 0x1F, 0x3B, 0x66, 0xF4, 0x2B, 0x5F, 0xC1, 0x47, 0xAB,
+    0xBE, 0x5D, 0xEA, 0x1D, 0xBF, 0xD6, 0x42, 0xC1, 0xAA, 0x57, 0x6C, 0x13, 0x7E, 0xF5, 0xBA, 0x29,
+    0xAC, 0x1A, 0xA5, 0x61, 0xC1, 0xBF, 0x27, 0xFD, 0x49, 0xC6, 0x6A, 0xD0, 0xA6, 0x11, 0xAF, 0x5D,
+    0x8A, 0xD4, 0xD2, 0x5F, 0x96, 0x8D, 0xB9, 0x96, 0x6D, 0xB5, 0x37, 0x25, 0xCD, 0x09, 0x93, 0xA0,
+    0xD1, 0x5A, 0x6B, 0x81, 0x69, 0x67, 0xC8, 0xD0, 0x28, 0xD4, 0x1A, 0x0F, 0x05, 0xF3, 0x33, 0x2E,
+    0xE1, 0x56, 0x98, 0x42, 0xBD, 0x41, 0xBD, 0x1B, 0xF5, 0xE0, 0xE3, 0x30, 0x43, 0xA5, 0x57, 0x13,
+    0xE0, 0xCA, 0x3E, 0x29, 0xD8, 0x6B, 0x53, 0x6C, 0x9B, 0x4F, 0x25, 0x25, 0x2F, 0xEF, 0xC9, 0xC5,
+    0xA6, 0xCC, 0x80, 0x3B, 0xC0, 0x59, 0x45, 0x40, 0x3F, 0xD5, 0x08, 0x3E, 0xFB, 0x0C, 0x4E, 0x95,
+    0x66, 0xAC, 0x42, 0x2B, 0x98, 0x56, 0x14, 0xE9, 0x76, 0x1A, 0x8D, 0x0C, 0x81, 0x26, 0xFB, 0x99,
+    0x36, 0xFA, 0x05, 0x3F, 0x77, 0x11, 0x8D, 0x5D, 0xAC, 0x44, 0xBB, 0x36, 0x19, 0x97, 0xDA, 0x15,
+    0x97, 0xFD, 0x42, 0xB3, 0x95, 0x15, 0x86, 0xBA, 0x78, 0x9C, 0x04, 0x56, 0x11, 0xAA, 0x92, 0xC4,
+    0x8D, 0x60, 0xD5, 0x1F, 0x91, 0x6D, 0xA3, 0x93, 0xFD, 0x69, 0xB7, 0x53, 0x12, 0x00, 0x3A, 0xEB,
+    0x4A, 0x86, 0xE9, 0xB0, 0x41, 0x52, 0x82, 0x67, 0x4A, 0x94, 0x47, 0xAB, 0x00, 0xD4, 0x5A, 0x80,
+    0xAA, 0xA8, 0x51, 0x99, 0xFE, 0xA0, 0x1E, 0xE8, 0x8E, 0x49, 0xAE, 0x40, 0xAD, 0xCC, 0x29, 0x85,
+    0x2B, 0x28, 0x2D, 0x5E, 0x1F, 0xDC, 0xE9, 0x8F, 0xE8, 0xF5, 0xE8, 0xAC, 0x95, 0xB4, 0x15, 0x6C,
+    0x7E, 0xC1, 0x4B, 0x47, 0x5E, 0xAC, 0xFD, 0x10, 0x5C, 0xA5, 0x7C, 0x40, 0x2A, 0xF5, 0xCA, 0x81,
+    0x9F, 0xBA, 0x78, 0x02, 0xAF, 0xBA, 0x70, 0x02, 0xB5, 0xFC, 0x08, 0x0C, 0x67, 0xE0, 0x6B, 0x3F,
+    0x41, 0xEA, 0x55, 0x3E, 0x25, 0x9A, 0x57, 0xDA, 0x2F, 0x27, 0x0C, 0xEE, 0xB2, 0xFD, 0xD0, 0x9F,
+    0xC0, 0x36, 0x01, 0x5C, 0x36, 0xBD, 0x6C, 0x1F, 0x4F, 0xA6, 0xD1, 0x29, 0x42, 0x5B, 0xEC, 0xE6,
+    0x0C, 0x9F, 0xFD, 0x46, 0x51, 0xEA, 0xDF, 0x62, 0xFE, 0xE7, 0x76, 0xF9, 0x5A, 0x1D, 0x87, 0xF2,
+    0xEF, 0xE6, 0xEA, 0x6F, 0x26, 0xFF, 0x52, 0xF6, 0x6F, 0x64, 0xFF, 0x46, 0xF6, 0x6F, 0x65, 0x7F,
+    0x73, 0x79, 0xD6, 0xF6, 0xBF, 0x8D, 0xF6, 0xD3, 0xBC, 0xB4, 0x3E, 0x36, 0x93, 0xA1, 0x3F, 0x86,
+    0x5E, 0x9D, 0x27, 0xEC, 0x96, 0xF3, 0x08, 0x4F, 0xF3, 0xB2, 0xF9, 0x3C, 0x91, 0xF9, 0xF4, 0xE3,
+    0x74, 0x9A, 0xEF, 0xE5, 0x8F, 0xED, 0x7C, 0x12, 0xCB, 0xE5, 0x8F, 0xE9, 0xC9, 0x1F, 0x75, 0x60,
+    0x96, 0xB5, 0xD2, 0x31, 0x33, 0xAF, 0x50, 0x30, 0x31, 0xEE, 0x7C, 0x13, 0xC0, 0xAC, 0xC5, 0xCC,
+    0x4D, 0x89, 0x5A, 0x09, 0xFF, 0xEF, 0xB2, 0x4D, 0x1C, 0x28, 0xE3, 0x24, 0xE9, 0x2D, 0x49, 0x6A,
+    0x25, 0xA5, 0x17, 0x2E, 0x2E, 0x2E, 0xEE, 0xDD, 0xA0, 0x64, 0x6B, 0xC3, 0x6C, 0xCE, 0xBB, 0xFD,
+    0xFA, 0x06, 0x9D, 0x76, 0x26, 0x6D, 0xEC, 0xF5, 0x66, 0x53, 0x95, 0xEB, 0x58, 0xE5, 0x66, 0xAE,
+    0xB2, 0x0B, 0x55, 0x6A, 0x7B, 0x9B, 0x3A, 0xEC, 0xEA, 0x71, 0xD1, 0xBF, 0xA3, 0xE8, 0xA5, 0xD8,
+    0x15, 0x40, 0x6A, 0xA9, 0x34, 0x96, 0x4C, 0x7B, 0xEA, 0xCB, 0x60, 0xF7, 0xB2, 0x3C, 0x26, 0x17,
+    0x31, 0x55, 0xE9, 0x06, 0xF6, 0x91, 0x82, 0x2D, 0xE0, 0xD5, 0xDA, 0xE8, 0x73, 0xC9, 0x65, 0xB2,
+    0x5B, 0xC9, 0x2E, 0x92, 0xDB, 0xA5, 0x4A, 0xDD, 0x5C, 0xAF, 0xDD, 0x07, 0x43, 0xF4, 0xD2, 0xE2,
+    0xA5, 0xD0, 0x49, 0x45, 0x49, 0x6F, 0x1F, 0xE3, 0x7B, 0x7A, 0xA3, 0x55, 0xAC, 0xB5, 0xA3, 0x7B,
+    0xB7, 0x7C, 0xA0, 0x5E, 0x61, 0x02, 0xB7, 0x60, 0x36, 0xE8, 0x66, 0xAA, 0xDD, 0xD0, 0x7E, 0x98,
+    0x90, 0xE6, 0x5A, 0xA2, 0xD1, 0x78, 0x56, 0x15, 0x3F, 0x1E, 0x60, 0x5B, 0xD1, 0x4B, 0x9B, 0x8E,
+    0xF5, 0x6B, 0xD7, 0x92, 0xE9, 0x8C, 0x78, 0x29, 0xE0, 0xFF, 0x4E, 0x11, 0x3F, 0xFB, 0x44, 0x3B,
+    0x37, 0x99, 0x66, 0xA9, 0x84, 0x5D, 0xD1, 0x68, 0x32, 0x3E, 0x30, 0xD0, 0x45, 0xBA, 0xD0, 0xE6,
+    0x73, 0xCA, 0x56, 0x92, 0xA5, 0x40, 0x2D, 0x45, 0xE8, 0x1E, 0x94, 0x98, 0x69, 0xA4, 0xC4, 0x55,
+    0x53, 0xB0, 0xD9, 0xAC, 0x55, 0xBE, 0xF6, 0x3A, 0x92, 0xC6, 0xA9, 0xCC, 0x2C, 0xB5, 0xFB, 0x37,
+    0x6F, 0x35, 0xF1, 0x40, 0x81, 0xA7, 0x07, 0xF5, 0x7C, 0xA0, 0x8F, 0x19, 0xAF, 0x1D, 0x33, 0x3D,
+    0x28, 0xF3, 0x75, 0x85, 0x68, 0x53, 0xE6, 0x84, 0xB7, 0xF6, 0x0C, 0x1F, 0xFC, 0xE7, 0x46, 0x3B,
+    0xD2, 0xFC, 0x94, 0xBE, 0x45, 0x37, 0x63, 0x0F, 0x1C, 0x36, 0xC3, 0x34, 0xE2, 0x56, 0x50, 0xE1,
+    0xEC, 0x76, 0xF0, 0xF3, 0x91, 0x33, 0x74, 0xCB, 0x86, 0xD1, 0x9E, 0xA9, 0xA5, 0x8C, 0x5B, 0xA6,
+    0x84, 0xEF, 0xFD, 0xCA, 0xD7, 0xF0, 0x91, 0xD7, 0xF0, 0x0B, 0x09, 0x3F, 0x9B, 0x95, 0x21, 0x98,
+    0x15, 0x85, 0x2A, 0xD5, 0x25, 0x10, 0xC1, 0x5C, 0x8D, 0x98, 0x36, 0x68, 0x1E, 0x9D, 0xB7, 0x9A,
+    0x8B, 0x3C, 0xD5, 0x0F, 0x33, 0x4E, 0x0A, 0x74, 0x25, 0x63, 0xCC, 0xF0, 0x74, 0x09, 0x45, 0xF6,
+    0x43, 0xDE, 0xF6, 0x84, 0xC3, 0xD6, 0x27, 0x92, 0xC3, 0xFD, 0x68, 0x2B, 0xDE, 0xCD, 0x4B, 0xC1,
+    0xEA, 0xF3, 0x99, 0x29, 0xB8, 0xE0, 0x22, 0x99, 0x9D, 0x36, 0x74, 0x73, 0x95, 0x6C, 0xC6, 0xF7,
+    0x43, 0xA8, 0x63, 0x93, 0x98, 0xD0, 0xE8, 0x62, 0xBB, 0x56, 0x7B, 0xA5, 0xDE, 0xCF, 0x3E, 0xD6,
+    0x1B, 0x7F, 0xC4, 0x6D, 0xE0, 0x36, 0xD5, 0x76, 0x24, 0x77, 0x2E, 0xD3, 0x5E, 0x01, 0xD8, 0xBE,
+    0x0B, 0x1B, 0x64, 0x4C, 0xA6, 0x4A, 0xD8, 0x15, 0x1B, 0xA9, 0x23, 0xCD, 0x82, 0x5B, 0x68, 0x67,
+    0xBA, 0x70, 0xE4, 0x61, 0x53, 0xE0, 0xEE, 0x08, 0xF0, 0xBD, 0xA2, 0xAF, 0x55, 0x3E, 0x43, 0xF4,
+    0x8F, 0x5D, 0x2E, 0x94, 0xD9, 0xF8, 0xB1, 0x4C, 0x66, 0x38, 0xA0, 0xD5, 0x93, 0x8A, 0xA7, 0x02,
+    0xB7, 0xD6, 0xB1, 0xE0, 0x75, 0x6E, 0xBE, 0x7C, 0x5C, 0x3D, 0xAD, 0xA0, 0xDB, 0xC1, 0x67, 0xAE,
+    0xC0, 0x7B, 0xA7, 0xEE, 0x8E, 0xB6, 0x4D, 0x2C, 0x76, 0xC4, 0xCD, 0xC5, 0xCE, 0xF8, 0x97, 0x13,
+    0x43, 0xB7, 0x30, 0x4D, 0x23, 0xDA, 0x30, 0x5A, 0x29, 0xCE, 0x27, 0x52, 0x17, 0xE4, 0x0C, 0xF7,
+    0x0B, 0x8D, 0xED, 0xFB, 0x5A, 0xBA, 0x1F, 0x6B, 0xF5, 0xF3, 0xB4, 0x61, 0x7E, 0x86, 0x4D, 0xD8,
+    0x95, 0x26, 0xE2, 0x16, 0x5C, 0x99, 0xE9, 0x88, 0xEF, 0x19, 0x40, 0xB0, 0x63, 0x32, 0x55, 0xC6,
+    0x26, 0xEA, 0xF2, 0x54, 0xC4, 0xFD, 0x84, 0x56, 0x7D, 0x27, 0xBC, 0x2E, 0x49, 0xDF, 0xBF, 0x5D,
+    0x9B, 0x15, 0xA4, 0xAC, 0x44, 0x5D, 0xA2, 0x72, 0x9F, 0xBA, 0xDD, 0x2D, 0x68, 0xF4, 0x4B, 0x1B,
+    0x9A, 0x6C, 0xC4, 0x84, 0x9F, 0x9B, 0x64, 0xB3, 0x11, 0x3E, 0xB4, 0x4B, 0x93, 0xCC, 0xCE, 0xD4,
+    0xFB, 0xE0, 0x56, 0x9B, 0x8D, 0x18, 0x42, 0x1B, 0x5D, 0xB2, 0x3B, 0xD3, 0xE8, 0x43, 0x1B, 0xED,
+    0x56, 0x89, 0x69, 0x6C, 0xA3, 0x4B, 0x47, 0x86, 0x00, 0x98, 0x87, 0xD3, 0x48, 0x77, 0x26, 0x05,
+    0xD6, 0x61, 0x6C, 0x92, 0x49, 0x88, 0x6E, 0x6C, 0x67, 0x9B, 0xAA, 0xCC, 0xD0, 0xFB, 0xD0, 0xC4,
+    0x3A, 0x71, 0x34, 0x5E, 0xAB, 0xDD, 0x08, 0x3F, 0x77, 0xB1, 0xDE, 0xAC, 0x98, 0x02, 0x66, 0xBA,
+    0x87, 0x2D, 0x21, 0xFE, 0x6C, 0xF7, 0x3A, 0xDB, 0x8D, 0x89, 0x9D, 0x2E, 0x4C, 0x34, 0xD1, 0x8F,
+    0x36, 0xBB, 0xC5, 0xEC, 0xF5, 0x8A, 0x8C, 0x8C, 0xC2, 0x20, 0xCD, 0x4E, 0x5A, 0x6C, 0xC1, 0x45,
+    0x96, 0x03, 0x79, 0xE0, 0xDA, 0x2D, 0x68, 0x7E, 0x51, 0xF2, 0x5E, 0x81, 0xD3, 0x7F, 0x5B, 0x41,
+    0x8B, 0x1B, 0x69, 0x13, 0xAF, 0x51, 0x09, 0x17, 0xCA, 0x4E, 0xB1, 0x1B, 0x6D, 0xCF, 0x30, 0xDB,
+    0x88, 0xDB, 0xCD, 0x7E, 0x60, 0x65, 0x9D, 0xB4, 0x62, 0xA5, 0xFD, 0x88, 0xD0, 0xDD, 0xFA, 0x42,
+    0x7F, 0xC4, 0xBF, 0x7E, 0x39, 0x67, 0xEF, 0x1A, 0x4F, 0x24, 0xE1, 0x55, 0x5A, 0xE0, 0xB0, 0x6F,
+    0xCB, 0x46, 0xAB, 0x77, 0x43, 0x2D, 0x65, 0xB6, 0x5A, 0xBD, 0xEF, 0x7D, 0xAC, 0x97, 0x6A, 0xE7,
+    0x35, 0xFC, 0xEC, 0x46, 0x9B, 0xCD, 0xCA, 0x30, 0x76, 0xBD, 0x5B, 0xAB, 0x54, 0x8B, 0x4E, 0x5A,
+    0xCC, 0x81, 0x31, 0x85, 0x12, 0x49, 0xBF, 0x7E, 0xF7, 0xD5, 0xBE, 0xC4, 0x13, 0x7E, 0x2F, 0xFC,
+    0x09, 0xBA, 0x07, 0xFF, 0xF8, 0x64, 0xE2, 0xDD, 0x4F, 0x57, 0x06, 0xCD, 0x95, 0xD4, 0x3B, 0x7D,
+    0x1B, 0xBF, 0x60, 0x54, 0x54, 0xCF, 0x07, 0xCC, 0x5E, 0x72, 0x69, 0x3F, 0x63, 0x54, 0xB0, 0x18,
+    0x1F, 0xA9, 0x14, 0x78, 0xEA, 0xF5, 0x53, 0xB4, 0xAF, 0x07, 0xB4, 0xCA, 0xF8, 0x6F, 0xFC, 0x39,
+    0x5F, 0x03, 0xBE, 0x7A, 0xF8, 0x43, 0xBF, 0x83, 0xD3, 0x5C, 0x98, 0xA8, 0x26, 0x41, 0x93, 0xED,
+    0xDC, 0x26, 0x27, 0x45, 0x2F, 0x2D, 0x83, 0xD4, 0x5F, 0xD7, 0x83, 0xCB, 0xA9, 0xFE, 0x43, 0x18,
+    0xC0, 0x07, 0xDC, 0x42, 0x1D, 0x19, 0x94, 0xBD, 0xE4, 0xA5, 0x70, 0xDC, 0x5A, 0xA9, 0x32, 0xEC,
+    0xE0, 0x7B, 0xBA, 0x80, 0x53, 0xB4, 0xCA, 0x48, 0x78, 0x85, 0x3A, 0x32, 0x35, 0x0B, 0xBB, 0x9B,
+    0xCD, 0xE6, 0xE6, 0x2A, 0xBB, 0x60, 0x73, 0x1B, 0x6C, 0xEA, 0x42, 0x93, 0xBA, 0xD1, 0xAD, 0xBE,
+    0x6F, 0xA3, 0xEF, 0x7D, 0xF4, 0xF3, 0xB4, 0x78, 0x69, 0xF6, 0x52, 0x38, 0xFC, 0xC9, 0x78, 0x7D,
+    0x07, 0x3F, 0xD2, 0xBD, 0x95, 0xA9, 0x93, 0x0F, 0xA8, 0xDA, 0xE8, 0xE6, 0x76, 0xA9, 0x93, 0x11,
+    0xC2, 0x45, 0x1F, 0xD0, 0x17, 0x13, 0xEE, 0xA1, 0x4A, 0x38, 0x54, 0x6B, 0x2D, 0x8C, 0x44, 0xAD,
+    0xB9, 0xC0, 0xF0, 0xB5, 0xC6, 0xC2, 0xF4, 0x0D, 0x7F, 0xB6, 0x80, 0x7F, 0x33, 0x41, 0xF7, 0x83,
+    0xBD, 0x8A, 0x2E, 0x0E, 0x5F, 0xDF, 0x9A, 0xB5, 0xFD, 0xB1, 0x5E, 0xCE, 0x75, 0xD2, 0xFB, 0x9B,
+    0x91, 0x76, 0x31, 0x1C, 0xEC, 0x92, 0x42, 0x2D, 0x69, 0x36, 0x7A, 0xA4, 0x85, 0x21, 0x29, 0xD2,
+    0xE6, 0x2E, 0x51, 0xE7, 0xFA, 0x6C, 0x6E, 0xEA, 0x8C, 0x7A, 0xD4, 0x0B, 0xBA, 0x28, 0xB0, 0xBB,
+    0x4E, 0x21, 0xB9, 0x3B, 0x27, 0x25, 0x95, 0xE6, 0x52, 0x37, 0x80, 0x95, 0x7A, 0xAC, 0x7C, 0xA4,
+    0x56, 0xB3, 0x51, 0xEF, 0x46, 0xA1, 0xD9, 0xF1, 0x2B, 0xF8, 0x80, 0x70, 0x91, 0x09, 0xBB, 0xE1,
+    0x47, 0xA6, 0xB1, 0x0B, 0xB4, 0xB1, 0x9D, 0xB1, 0x9B, 0x8B, 0xA0, 0x97, 0x57, 0xE8, 0xDE, 0x4F,
+    0xA7, 0xF8, 0x4F, 0x3B, 0x94, 0xED, 0xDF, 0xA8, 0x07, 0xA3, 0x73, 0xC4, 0xD5, 0x2D, 0x47, 0xE6,
+    0x74, 0x6D, 0x5A, 0xC1, 0x95, 0x70, 0x35, 0x83, 0x29, 0xA9, 0x68, 0x31, 0x66, 0x56, 0x5A, 0x69,
+    0xCF, 0xA9, 0x24, 0xDD, 0x7A, 0xA0, 0x4B, 0x3E, 0x1E, 0x99, 0xF5, 0xB4, 0x40, 0xB3, 0x01, 0x9A,
+    0x0B, 0x97, 0x66, 0xF4, 0xE1, 0xB7, 0x0A, 0x18, 0x3B, 0x1C, 0xF8, 0x70, 0x38, 0xA3, 0xC1, 0x81,
+    0x46, 0x33, 0x8D, 0x8A, 0x13, 0x7B, 0x1C, 0xEE, 0x59, 0x4A, 0x94, 0x53, 0x67, 0x98, 0xF6, 0x62,
+    0x55, 0x9D, 0x0E, 0x8C, 0xD8, 0xC5, 0xAB, 0x38, 0xD0, 0xD1, 0xC2, 0x45, 0xA8, 0x15, 0x4B, 0x9C,
+    0xEA, 0xF7, 0x53, 0x92, 0x0F, 0x50, 0x25, 0x5C, 0xC0, 0x63, 0x12, 0x6E, 0x2E, 0x9F, 0xCD, 0x8C,
+    0xC7, 0x64, 0x9A, 0x05, 0x0F, 0x99, 0x7A, 0xC1, 0xF7, 0xE5, 0xB3, 0xEB, 0xC9, 0xD4, 0x91, 0x6E,
+    0x64, 0xA3, 0xBA, 0x7F, 0xCE, 0xB6, 0x17, 0x8C, 0x72, 0x89, 0x14, 0x9B, 0x5C, 0x94, 0xDF, 0xAD,
+    0xA5, 0xDF, 0x76, 0x29, 0x44, 0xBF, 0x5F, 0x4A, 0xD7, 0x3E, 0x97, 0x20, 0x7E, 0x4A, 0xA0, 0xE2,
+    0xFE, 0x6D, 0x2E, 0x93, 0x69, 0x4A, 0x93, 0x46, 0x0B, 0x4E, 0x81, 0x4E, 0xE0, 0x8F, 0xFD, 0xD2,
+    0xFC, 0x20, 0x4E, 0x6F, 0xBE, 0xF1, 0xEE, 0xDE, 0xB5, 0xF1, 0xC5, 0xEE, 0x18, 0xFB, 0x75, 0x7E,
+    0x17, 0x3B, 0x37, 0xA3, 0xC9, 0xF5, 0x8A, 0x3E, 0xBF, 0x33, 0x8C, 0xA2, 0x9D, 0xFD, 0x68, 0xB3,
+    0x5B, 0xF1, 0x71, 0x0A, 0xE8, 0x25, 0x51, 0x67, 0xB7, 0xD2, 0xF5, 0x03, 0xC4, 0x6A, 0xC6, 0xF0,
+    0x0F, 0x0E, 0x0E, 0xF9, 0xB7, 0xE0, 0x0F, 0x78, 0x11, 0x93, 0xED, 0x4A, 0x93, 0xDA, 0xA5, 0x94,
+    0xD3, 0x74, 0x61, 0xE8, 0x8D, 0x6C, 0xC6, 0x2F, 0x0A, 0x2E, 0x77, 0xD1, 0xC8, 0x6E, 0xB8, 0xB9,
+    0x1B, 0xF9, 0x63, 0x22, 0x55, 0x29, 0x0F, 0x2A, 0xEC, 0xB4, 0x38, 0x9B, 0xB4, 0x6E, 0x05, 0xB8,
+    0xF1, 0x11, 0x4A, 0x6C, 0x18, 0x4F, 0xC9, 0x77, 0x55, 0x00, 0x95, 0xCC, 0x89, 0xA9, 0xDA, 0x33,
+    0x30, 0xDC, 0x9D, 0xC1, 0xBD, 0xB7, 0x41, 0xB5, 0xB5, 0x0B, 0x0C, 0x5F, 0xDF, 0xC1, 0xC5, 0x36,
+    0x62, 0x77, 0x23, 0x18, 0x82, 0x8B, 0xB8, 0xFD, 0x42, 0x58, 0xA9, 0x10, 0x76, 0x05, 0x73, 0x4D,
+    0x05, 0x84, 0x1D, 0x16, 0x5C, 0x76, 0x19, 0xF4, 0x86, 0xFA, 0xC3, 0xF9, 0x9B, 0xF5, 0x6A, 0x1D,
+    0xCC, 0xB9, 0x76, 0x60, 0xE0, 0x13, 0x5D, 0x66, 0xBF, 0xC4, 0x43, 0xA7, 0x78, 0xE6, 0x5B, 0xBC,
+    0x38, 0x8D, 0xB9, 0xFD, 0xD1, 0x7A, 0x22, 0x5C, 0x9A, 0x75, 0x18, 0x8F, 0x41, 0xDB, 0x5C, 0xE7,
+    0x83, 0x71, 0x31, 0xC2, 0x87, 0x32, 0xEA, 0xC2, 0x3F, 0x14, 0xCA, 0xC5, 0xAB, 0xF8, 0x1B, 0x69,
+    0x6C, 0x13, 0x56, 0x28, 0xE0, 0xB2, 0xDB, 0x4E, 0x30, 0xD3, 0x65, 0x29, 0x40, 0x81, 0x1C, 0x06,
+    0xF5, 0x60, 0xD3, 0xD4, 0x83, 0x1F, 0xBB, 0xF1, 0xF1, 0x61, 0x16, 0x56, 0xC8, 0x2F, 0x67, 0xC9,
+    0xB6, 0x85, 0xF9, 0xC8, 0x40, 0xF3, 0x28, 0x9E, 0x44, 0x6B, 0xF3, 0xD0, 0x1F, 0xBC, 0x90, 0xD9,
+    0xEB, 0x74, 0xC8, 0x16, 0x8D, 0x43, 0x38, 0x88, 0x21, 0xFF, 0xE1, 0x77, 0xF2, 0x21, 0xDC, 0x56,
+    0xD2, 0x5C, 0x98, 0x21, 0x27, 0x69, 0x67, 0x58, 0x70, 0xD9, 0x0A, 0x7C, 0x3C, 0xA8, 0x21, 0xB8,
+    0x76, 0xEB, 0x06, 0x50, 0xA7, 0x6E, 0xE6, 0x30, 0x23, 0x46, 0x5F, 0xCC, 0x80, 0xDE, 0x10, 0x30,
+    0x9C, 0xCB, 0x38, 0x3E, 0x56, 0xAE, 0xC5, 0xF3, 0x15, 0xC1, 0x16, 0x65, 0x38, 0xE2, 0x8D, 0xEE,
+    0xDD, 0x70, 0x16, 0xAD, 0x7B, 0x6F, 0xE3, 0x24, 0xDB, 0xC2, 0x66, 0x15, 0xE1, 0x16, 0x95, 0x28,
+    0xD2, 0x2D, 0x84, 0x56, 0x11, 0x6F, 0xD1, 0x8A, 0x22, 0x5F, 0x7C, 0x61, 0x5A, 0x12, 0x05, 0x09,
+    0x29, 0x50, 0x48, 0x91, 0xF0, 0xAF, 0xE6, 0x99, 0xC6, 0x5F, 0xCA, 0x33, 0xAD, 0x97, 0x3C, 0x53,
+    0xFC, 0x28, 0xCF, 0x34, 0x7F, 0xF6, 0xE0, 0x99, 0xDC, 0x47, 0x79, 0xA6, 0xF6, 0x0A, 0xCF, 0x54,
+    0xEA, 0x59, 0xB6, 0x33, 0x9A, 0x6F, 0x5C, 0x7F, 0x42, 0xA2, 0x9A, 0x0D, 0xE0, 0x2B, 0x57, 0x16,
+    0xB6, 0x54, 0x7D, 0x68, 0x3C, 0x47, 0x08, 0xE6, 0xD6, 0x93, 0x22, 0xFD, 0x4D, 0x70, 0x47, 0xA7,
+    0x02, 0xB4, 0x26, 0x70, 0x54, 0x57, 0x94, 0xEF, 0x6E, 0xE6, 0x13, 0x5E, 0xBF, 0xA1, 0x51, 0x03,
+    0x7C, 0xED, 0x5C, 0x82, 0x63, 0xB4, 0x70, 0x64, 0xCF, 0x2E, 0x4E, 0x3D, 0xD5, 0x39, 0x4B, 0x3E,
+    0x15, 0x9A, 0x5D, 0x1C, 0x8B, 0xD8, 0x33, 0x14, 0x44, 0xF3, 0xC3, 0x6F, 0x1D, 0xBB, 0xB3, 0x8D,
+    0x1C, 0xB5, 0x66, 0x85, 0x41, 0xA9, 0xF7, 0x57, 0x17, 0x98, 0xB4, 0x51, 0x42, 0x30, 0xCA, 0xA2,
+    0x5F, 0x46, 0x77, 0xC7, 0x53, 0x17, 0x17, 0xC7, 0xF8, 0xDC, 0x29, 0xA5, 0x8A, 0x74, 0x2A, 0x41,
+    0xAF, 0x22, 0x60, 0x6E, 0x5F, 0xBB, 0x05, 0xFE, 0xFB, 0x82, 0x3A, 0x77, 0x0B, 0xE8, 0xA5, 0x1D,
+    0xDA, 0x34, 0xCD, 0x58, 0x7D, 0x69, 0xFB, 0x14, 0xC9, 0xF3, 0x5A, 0x5F, 0x66, 0xE5, 0xE7, 0x82,
+    0xA0, 0x0E, 0x4F, 0xAC, 0x7E, 0x7B, 0x1F, 0x86, 0x40, 0xB5, 0x17, 0x3F, 0xE8, 0x43, 0x09, 0x31,
+    0x53, 0x71, 0x85, 0x2A, 0x2E, 0xAF, 0x5D, 0x60, 0xEA, 0xCB, 0x9F, 0x11, 0xA6, 0x80, 0x3D, 0x9E,
+    0x1F, 0x02, 0xF6, 0x08, 0x3E, 0x87, 0x12, 0x9B, 0x3F, 0x55, 0xE6, 0xFF, 0x22, 0x90, 0x4A, 0xA1,
+    0x4C, 0x73, 0xA4, 0x57, 0xBF, 0xE2, 0xAA, 0x7F, 0x76, 0xF8, 0xD6, 0xAB, 0x2E, 0x39, 0x16, 0xB1,
+    0x74, 0x73, 0xF1, 0x64, 0x3E, 0x14, 0x57, 0x75, 0xE0, 0x16, 0x46, 0x25, 0x72, 0xB1, 0x7B, 0x11,
+    0x49, 0x9D, 0xCB, 0x50, 0x5C, 0x2E, 0xF4, 0x66, 0x97, 0x38, 0x11, 0x73, 0x47, 0x52, 0x18, 0x8B,
+    0x5B, 0x97, 0xFA, 0x6A, 0x6B, 0x97, 0x3A, 0x56, 0xF9, 0xFF, 0xD9, 0x18, 0xEA, 0xB5, 0x0B, 0xE8,
+    0x66, 0xA6, 0x8D, 0x53, 0xB0, 0x72, 0x19, 0xFF, 0x9E, 0xC6, 0x6B, 0x77, 0x6E, 0xDC, 0xFE, 0x25,
+    0xC2, 0x60, 0x08, 0x47, 0x51, 0xE2, 0xB9, 0x16, 0xF1, 0x54, 0x5E, 0x51, 0x6D, 0x87, 0x6B, 0xBF,
+    0xAC, 0x91, 0x3C, 0x55, 0x5F, 0xB4, 0xF1, 0x14, 0xCD, 0x2D, 0x87, 0x9E, 0x0C, 0xE1, 0x30, 0x91,
+    0x0A, 0x65, 0x48, 0x95, 0xC6, 0x4B, 0xB9, 0xD8, 0xE5, 0xCF, 0x01, 0xBB, 0xFF, 0x01, 0x50, 0x3D,
+    0x7A, 0x17, 0x20, 0x69, 0x04, 0x9E, 0x73, 0xE3, 0x2F, 0x5B, 0xAA, 0xDF, 0x38, 0xCF, 0x75, 0x54,
+    0xE2, 0x95, 0x62, 0xBD, 0xB2, 0x7B, 0x0E, 0xEA, 0x95, 0x3B, 0x1F, 0x1D, 0xEC, 0x75, 0x2D, 0x40,
+    0x7B, 0x94, 0xD7, 0x28, 0x81, 0xDF, 0xFF, 0x54, 0x3D, 0x3E, 0x31, 0x2C, 0x74, 0x89, 0x26, 0xD3,
+    0x26, 0x8C, 0x7A, 0x97, 0xC1, 0xCF, 0xF5, 0x76, 0x22, 0x7C, 0x0A, 0xF5, 0x65, 0xC4, 0x10, 0x60,
+    0x08, 0x5D, 0x04, 0xBF, 0x34, 0x19, 0xDC, 0x6A, 0x77, 0x0A, 0x7E, 0x4F, 0xB3, 0xE3, 0xF7, 0xCF,
+    0xDD, 0x3D, 0x18, 0xE6, 0xC2, 0x3C, 0xCF, 0x4C, 0x2A, 0xC6, 0x48, 0x5A, 0x40, 0xD2, 0x0C, 0xD7,
+    0xB5, 0x3F, 0x16, 0x74, 0xD5, 0xF3, 0xA9, 0x52, 0xF3, 0xF4, 0x7F, 0x95, 0xAE, 0x16, 0x3B, 0x7E,
+    0x82, 0xEB, 0x53, 0x3A, 0xB5, 0xD7, 0xAE, 0x94, 0x67, 0x16, 0x14, 0xBC, 0xD0, 0xC7, 0xED, 0xDB,
+    0x1B, 0xE0, 0x96, 0x8F, 0x94, 0x43, 0x7F, 0x6A, 0x69, 0xCB, 0x1B, 0xFD, 0x6D, 0xA0, 0x5B, 0xA6,
+    0x1E, 0xDC, 0xEA, 0x03, 0xD4, 0xB9, 0x94, 0x24, 0xB9, 0x0C, 0x46, 0x7F, 0xA1, 0x8F, 0x5F, 0x96,
+    0xBB, 0x85, 0x4B, 0xD3, 0x5A, 0x0A, 0xE4, 0x47, 0xAC, 0xFE, 0xFB, 0xB4, 0x62, 0x35, 0xD6, 0x3B,
+    0x95, 0x46, 0xA6, 0x60, 0x34, 0xD2, 0xAE, 0x28, 0x60, 0x37, 0x86, 0x19, 0xD4, 0x77, 0x91, 0x52,
+    0xE2, 0x49, 0x1B, 0xEB, 0x0C, 0x75, 0x3E, 0xCC, 0xCA, 0xE5, 0x34, 0x15, 0x5C, 0x86, 0x69, 0xB1,
+    0x7A, 0xF0, 0xD9, 0xA3, 0x36, 0xA8, 0x14, 0x54, 0x94, 0xD2, 0x99, 0x82, 0x6D, 0x94, 0xF2, 0x98,
+    0x0D, 0x0A, 0xFF, 0x76, 0x29, 0xE4, 0xDB, 0x9C, 0xFD, 0x21, 0xD3, 0x78, 0xF6, 0x25, 0x47, 0x0C,
+    0xFD, 0xF1, 0xD7, 0xA7, 0x86, 0x4E, 0x03, 0x28, 0x06, 0xC9, 0x73, 0x42, 0x00, 0x8F, 0xAD, 0x62,
+    0x23, 0xFF, 0xC7, 0xD7, 0xA7, 0x6A, 0x5E, 0x00, 0xD5, 0x7A, 0x59, 0x6F, 0xDC, 0x1C, 0xBC, 0xCF,
+    0x02, 0x0C, 0x2F, 0x65, 0x60, 0x2B, 0x34, 0xC6, 0xA7, 0x79, 0x16, 0x7B, 0x9D, 0xA0, 0xDA, 0xDD,
+    0x0A, 0x76, 0x73, 0x2B, 0xD4, 0x5B, 0x17, 0xC1, 0x65, 0x1F, 0xE1, 0xDA, 0xED, 0x1B, 0xB7, 0xFE,
+    0x3F, 0x58, 0x0B, 0x73, 0xEB, 0x70, 0xAD, 0xEA, 0x8F, 0xEA, 0x93, 0xC7, 0x9F, 0xF8, 0x75, 0x29,
+    0x17, 0x68, 0xFB, 0x12, 0x88, 0xB8, 0x50, 0xD2, 0xDD, 0xFA, 0x57, 0xE9, 0xEE, 0xF5, 0x0D, 0x9A,
+    0x52, 0x9E, 0x39, 0xDB, 0xD4, 0xAE, 0x36, 0x55, 0xD9, 0x64, 0x26, 0xBE, 0x47, 0x17, 0x3C, 0xCD,
+    0xD2, 0xF6, 0x36, 0x35, 0x81, 0xCD, 0x46, 0x84, 0xBE, 0xA3, 0x70, 0x14, 0x5B, 0x67, 0xA4, 0x9D,
+    0x66, 0xBF, 0x7A, 0x38, 0xC6, 0x07, 0xF0, 0x5B, 0xA1, 0xD8, 0xDA, 0x1F, 0xEC, 0xB8, 0xF9, 0x4A,
+    0xFF, 0x66, 0xEA, 0xA9, 0xA4, 0xA5, 0x92, 0x56, 0xF6, 0x7A, 0x63, 0x67, 0x62, 0xA0, 0x0B, 0x5D,
+    0xDF, 0x44, 0x17, 0xAA, 0x54, 0xCF, 0xEC, 0x55, 0xC4, 0xF7, 0x19, 0x1F, 0xFC, 0x3B, 0x8A, 0x4E,
+    0xCA, 0xD5, 0x51, 0xDF, 0x3D, 0x1E, 0x13, 0xBC, 0x63, 0x6E, 0xD1, 0xA4, 0x6E, 0xC6, 0xCF, 0x2A,
+    0x19, 0xA7, 0xCB, 0x3E, 0x32, 0xFC, 0xFC, 0xE3, 0xD3, 0xCD, 0xBB, 0xC5, 0xE2, 0x8F, 0x4C, 0xDA,
+    0xB0, 0xA9, 0x5D, 0xF1, 0x63, 0x17, 0x4C, 0x66, 0xA2, 0x99, 0xAB, 0x8C, 0xA7, 0x59, 0xCC, 0x8A,
+    0x1F, 0x9B, 0xC0, 0x86, 0xC7, 0x45, 0xF4, 0x9D, 0xA3, 0x02, 0xBE, 0x91, 0x72, 0xA1, 0xC8, 0x2F,
+    0x67, 0xF9, 0xBF, 0x27, 0x9D, 0xDA, 0x27, 0x48, 0xA7, 0xA7, 0x35, 0xF2, 0x5C, 0xA1, 0x05, 0x15,
+    0xF8, 0xCC, 0x8B, 0x18, 0x05, 0xBA, 0x48, 0xF5, 0x0A, 0x57, 0xCE, 0x92, 0x9C, 0x8B, 0x51, 0x9F,
+    0x8C, 0x2E, 0x4E, 0xFD, 0xA6, 0x92, 0xA5, 0xF8, 0x47, 0x19, 0x1F, 0xDA, 0xBE, 0x0B, 0xCF, 0x2F,
+    0xAE, 0x94, 0xD6, 0xEE, 0x56, 0xD2, 0xD7, 0xF5, 0xCE, 0x1D, 0xA6, 0xE3, 0x24, 0x49, 0xB3, 0xF7,
+    0x5F, 0x35, 0x87, 0xDC, 0x82, 0x2D, 0x85, 0xE1, 0xFD, 0x63, 0xDE, 0xB3, 0x1D, 0x0F, 0xB3, 0xB6,
+    0x5D, 0x1E, 0x70, 0xF8, 0x44, 0xD7, 0xD3, 0x07, 0xE1, 0x68, 0x35, 0x05, 0xC4, 0x57, 0xE9, 0xC2,
+    0xF3, 0x8B, 0x95, 0x76, 0x26, 0x69, 0x71, 0xD2, 0x6E, 0xF4, 0xCE, 0x9D, 0x52, 0xB8, 0xBB, 0x01,
+    0xDD, 0x43, 0xB3, 0x9A, 0xF3, 0x71, 0x02, 0xAF, 0xFD, 0x54, 0x5C, 0xFB, 0xDA, 0xC1, 0x93, 0x5A,
+    0x8D, 0x05, 0xD4, 0x6C, 0xDF, 0xDE, 0xB0, 0x6B, 0x95, 0xFE, 0xAF, 0xF7, 0x7C, 0xA3, 0xBF, 0x0D,
+    0xD3, 0xCD, 0x0D, 0x74, 0x33, 0x63, 0xD4, 0xE4, 0xE2, 0x70, 0x6B, 0x75, 0xE9, 0x57, 0x61, 0x42,
+    0xD3, 0x78, 0xE2, 0x5B, 0x1F, 0x65, 0x10, 0x5F, 0xA5, 0xCA, 0xD7, 0x5E, 0x2F, 0x38, 0x7F, 0x23,
+    0xED, 0xA5, 0xB8, 0xA8, 0xDD, 0xBF, 0x79, 0xAB, 0x48, 0xB5, 0x9B, 0x8F, 0x91, 0xD0, 0x1E, 0x46,
+    0x22, 0x62, 0xA5, 0xA5, 0x8C, 0xA5, 0x59, 0x71, 0x2B, 0x6E, 0xA5, 0x4D, 0xE7, 0xBC, 0xFE, 0xF7,
+    0x7B, 0x36, 0x6C, 0xA4, 0x0D, 0xBC, 0x8E, 0x5D, 0x71, 0x81, 0x81, 0x2A, 0xE1, 0x16, 0x86, 0xBE,
+    0xCA, 0xB8, 0x88, 0x0F, 0x95, 0xB8, 0x9E, 0x2E, 0x9D, 0x96, 0x0B, 0x34, 0x33, 0x75, 0xFC, 0x65,
+    0x9E, 0xEA, 0xBB, 0xE0, 0x7B, 0x5C, 0xA0, 0x8E, 0x54, 0x09, 0x36, 0xF0, 0xD0, 0x06, 0x9A, 0x05,
+    0x9B, 0x30, 0x1B, 0x4C, 0x05, 0x7E, 0x8F, 0x34, 0x19, 0xF3, 0x7A, 0x81, 0xF2, 0x5D, 0xC4, 0x68,
+    0xC6, 0x6B, 0x74, 0xEF, 0xED, 0x55, 0xBE, 0x8C, 0x1B, 0x9B, 0x7B, 0xB0, 0x81, 0x0B, 0x98, 0x0C,
+    0xDD, 0x88, 0x5D, 0xC1, 0x17, 0x63, 0xF3, 0xFA, 0x25, 0x03, 0x1B, 0x4E, 0x6C, 0x64, 0x93, 0xE1,
+    0xEE, 0x48, 0xB5, 0x76, 0x9F, 0xDB, 0xDA, 0x59, 0x2E, 0xFA, 0x37, 0x73, 0xF7, 0x73, 0xFD, 0x9A,
+    0x23, 0xC4, 0xAC, 0xCF, 0x42, 0x9D, 0x9F, 0x05, 0xA7, 0x0C, 0xAD, 0x5B, 0xA1, 0xAD, 0x97, 0x8F,
+    0x15, 0x41, 0xFB, 0xA7, 0x05, 0x7F, 0x01, 0x2F, 0xF5, 0x0C, 0xEB, 0x30, 0x32, 0x8D, 0xED, 0x88,
+    0xE8, 0x46, 0xB3, 0xE1, 0xC7, 0x2A, 0x33, 0xF4, 0x36, 0x33, 0x51, 0x27, 0x44, 0x93, 0x8C, 0x70,
+    0x6B, 0xB5, 0xD3, 0x46, 0xBB, 0xD1, 0xC5, 0x7A, 0xC3, 0xC7, 0x26, 0x9F, 0xCF, 0x8A, 0x40, 0xBD,
+    0x01, 0xD3, 0x7C, 0x8A, 0x7C, 0x0E, 0x7B, 0xBA, 0xF7, 0xB8, 0x52, 0xE2, 0xDB, 0xBB, 0xD4, 0x46,
+    0xB7, 0x56, 0xD9, 0x26, 0xA6, 0x2A, 0xD3, 0x85, 0x1D, 0x17, 0xFD, 0x58, 0xA7, 0x76, 0xB6, 0xB9,
+    0xCE, 0xB5, 0x8C, 0xA4, 0xDE, 0x17, 0x98, 0x2D, 0x50, 0x8E, 0x59, 0x70, 0xD5, 0x8C, 0x37, 0xF3,
+    0x27, 0x30, 0xE3, 0x7F, 0x1F, 0x5D, 0x56, 0xA7, 0x13, 0x6D, 0x53, 0x2C, 0x80, 0xA3, 0x7F, 0x39,
+    0x3D, 0x8E, 0x36, 0xFE, 0xBD, 0xD0, 0x6A, 0x77, 0xCC, 0xAD, 0x02, 0x19, 0xFA, 0x59, 0xFD, 0xA5,
+    0xF5, 0xF6, 0x4F, 0x82, 0x85, 0xD7, 0xF7, 0xBE, 0xD4, 0xE7, 0xB4, 0x52, 0x8F, 0xBE, 0x2E, 0xDC,
+    0x5A, 0x65, 0xFC, 0xD8, 0xC4, 0x2A, 0xD3, 0x05, 0xB7, 0x20, 0xFC, 0x58, 0x27, 0xB3, 0xE1, 0x43,
+    0x9D, 0x6B, 0xD1, 0x1E, 0xE0, 0xEA, 0xC8, 0x51, 0xB2, 0x3E, 0x1E, 0x94, 0xC4, 0xB5, 0xE3, 0x5C,
+    0xA0, 0xDD, 0x0E, 0x2C, 0x6D, 0x78, 0x4C, 0x49, 0x7E, 0x5D, 0x06, 0xE9, 0xB8, 0xBE, 0xFA, 0x38,
+    0x22, 0xF1, 0xCB, 0xAD, 0xEA, 0xAF, 0xDD, 0x5F, 0x73, 0x10, 0x19, 0x5D, 0x2E, 0x6B, 0xB5, 0x77,
+    0xB3, 0x4D, 0x97, 0x96, 0xF3, 0xD7, 0x7E, 0x7F, 0x9D, 0xDA, 0x99, 0xE9, 0xE6, 0x86, 0x5B, 0x87,
+    0x50, 0x1D, 0x48, 0x42, 0x30, 0x4F, 0x20, 0x09, 0x03, 0x4D, 0x6C, 0x16, 0x76, 0x36, 0xDA, 0xD9,
+    0xCD, 0x55, 0x26, 0xE3, 0x43, 0x1B, 0x6C, 0xAA, 0x32, 0xD3, 0xD8, 0x8D, 0x6E, 0xB5, 0xAB, 0x11,
+    0xBE, 0xF7, 0xD1, 0x6E, 0xCD, 0x8E, 0x97, 0xE6, 0xA3, 0xB0, 0x41, 0xA1, 0x92, 0x12, 0x87, 0xFC,
+    0xCC, 0x94, 0x6E, 0xDC, 0xB9, 0xB8, 0x7F, 0x3A, 0xB2, 0xDB, 0xD3, 0xA8, 0x24, 0x1F, 0xE8, 0xC3,
+    0xBB, 0x52, 0x39, 0x34, 0xD4, 0x6E, 0x47, 0x79, 0x7F, 0x17, 0x8F, 0x12, 0xCD, 0x69, 0x2E, 0xC8,
+    0xA9, 0x2D, 0x34, 0x55, 0x8F, 0xDB, 0x8E, 0x42, 0xBF, 0x61, 0xFF, 0x1E, 0xF8, 0xA5, 0x1C, 0x74,
+    0x32, 0x3A, 0x10, 0xB9, 0x26, 0x53, 0x3C, 0x41, 0xB7, 0x60, 0x34, 0x17, 0xC8, 0xE2, 0x20, 0xD3,
+    0xFA, 0x72, 0x26, 0xC7, 0xE9, 0x27, 0xAF, 0x6A, 0x06, 0xBC, 0x24, 0x5D, 0x7C, 0x9B, 0xE3, 0xCC,
+    0x71, 0x3E, 0x9D, 0x45, 0x8E, 0x94, 0xF3, 0xC4, 0x0A, 0xC7, 0x1F, 0x3B, 0x98, 0x49, 0x7A, 0x3C,
+    0xDA, 0x33, 0xD3, 0xBD, 0xE6, 0x21, 0x78, 0xFD, 0xFC, 0x28, 0x36, 0xFD, 0x70, 0xC3, 0x2F, 0xC3,
+    0x4E, 0xB2, 0x1B, 0xD3, 0xFC, 0x7C, 0x74, 0x4B, 0x25, 0x29, 0x4C, 0x34, 0x92, 0x6C, 0xC2, 0x4B,
+    0xD9, 0x2D, 0x46, 0xEF, 0xDC, 0x61, 0xE8, 0xDD, 0x0A, 0x46, 0x46, 0x0B, 0x9F, 0xA9, 0x25, 0x7D,
+    0x70, 0x7D, 0x71, 0x45, 0x2E, 0xBE, 0x9C, 0x64, 0xF6, 0x7A, 0x5B, 0x8A, 0x74, 0xC9, 0x4C, 0x0F,
+    0x0F, 0x2F, 0x20, 0x29, 0x77, 0x92, 0x56, 0x2F, 0x29, 0x3E, 0x73, 0x71, 0x71, 0x71, 0xE2, 0xA4,
+    0x4A, 0xD3, 0x5C, 0x4E, 0x3F, 0x67, 0x2F, 0x49, 0x5A, 0x9F, 0xB9, 0xB8, 0xB8, 0xB8, 0xB8, 0xB8,
+    0x3F, 0xAC, 0xE5, 0xD0, 0x91, 0x15, 0xF5, 0x4E, 0xB3, 0x1D, 0x81, 0xED, 0x33, 0xF7, 0x51, 0xAC,
+    0xD5, 0x77, 0x19, 0x85, 0x7A, 0x3F, 0xCE, 0x32, 0x65, 0x5E, 0xB8, 0xC7, 0xB0, 0x0E, 0x09, 0x2D,
+    0x53, 0x34, 0xE5, 0xA4, 0x60, 0xA5, 0xBE, 0xDE, 0xAD, 0x68, 0xB6, 0x66, 0x2F, 0x14, 0x4C, 0x97,
+    0xDA, 0xCC, 0x33, 0xF7, 0x9F, 0xB9, 0x8F, 0xA2, 0x62, 0xAD, 0x9B, 0x1A, 0xBB, 0xDC, 0x66, 0x14,
+    0xA6, 0xB9, 0xDE, 0xAD, 0xF0, 0xD1, 0xAF, 0x95, 0xBE, 0xAE, 0xE0, 0xB2, 0xCB, 0xBC, 0x70, 0xEF,
+    0x85, 0x7B, 0x98, 0xDB, 0xDC, 0xE6, 0x4E, 0x9D, 0xAA, 0xCD, 0xEC, 0x6E, 0xB5, 0xD9, 0xEE, 0xED,
+    0xDA, 0xE4, 0x7A, 0xF3, 0xD1, 0xE5, 0x66, 0x1B, 0x62, 0x9B, 0x5D, 0xFE, 0x5F, 0xAD, 0x99, 0x31,
+    0xEF, 0x24, 0xB7, 0x79, 0xC6, 0x7F, 0x33, 0xC4, 0x1D, 0x01, 0x0F, 0x10, 0xA6, 0xB0, 0x8A, 0xF8,
+    0x02, 0x4C, 0x93, 0xCA, 0x81, 0xCD, 0x2F, 0x20, 0x1F, 0x47, 0x52, 0xE1, 0x22, 0x85, 0xAE, 0xD0,
+    0x3F, 0x45, 0x54, 0xB8, 0x57, 0x73, 0x5F, 0x40, 0xD6, 0x50, 0x56, 0xE1, 0xC2, 0x45, 0xAE, 0x49,
+    0x1D, 0x15, 0x72, 0x60, 0x1F, 0x02, 0xDC, 0x17, 0x38, 0x6B, 0x78, 0x72, 0xE1, 0xC2, 0x45, 0x46,
+    0x31, 0x92, 0x94, 0x1E, 0x24, 0x72, 0x02, 0x48, 0xC5, 0x51, 0x11, 0x65, 0x8F, 0x24, 0x0E, 0x9F,
+    0x14, 0xB3, 0x7B, 0x3E, 0x27, 0x41, 0xAA, 0x2C, 0x16, 0xBB, 0xC0, 0xEE, 0xEC, 0x90, 0x2F, 0xF9,
+    0xF2, 0x79, 0x7E, 0xEF, 0xBB, 0xD0, 0xBD, 0x76, 0xEB, 0x1E, 0x84, 0x27, 0x02, 0x5B, 0xFD, 0x06,
+    0x7A, 0xA7, 0xC1, 0xB8, 0x2F, 0x2B, 0x46, 0xAF, 0x1E, 0xFC, 0xEF, 0x8F, 0xFE, 0xE1, 0x23, 0x25,
+    0x82, 0x54, 0xB0, 0x52, 0x03, 0xE9, 0x61, 0xC4, 0x65, 0xA0, 0x13, 0x80, 0xDF, 0x00, 0x73, 0x00,
+    0xCC, 0x1F, 0x37, 0x18, 0xA4, 0x15, 0xA4, 0x0A, 0x4E, 0x8A, 0xF4, 0x02, 0x08, 0xCF, 0x5F, 0xF5,
+    0xF0, 0x5D, 0x9C, 0x24, 0x90, 0x94, 0x19, 0x25, 0xD1, 0x4B, 0xCA, 0x04, 0x49, 0x00, 0xD8, 0x1D,
+    0x40, 0x11, 0xF0, 0x15, 0xB0, 0x4A, 0x80, 0x2A, 0xE0, 0x9F, 0x26, 0xB0, 0xBF, 0x3D, 0x00, 0x8D,
+    0x2B, 0xF8, 0x0F, 0x1B, 0xD8, 0x7D, 0xDC, 0x40, 0x9D, 0x20, 0x6C, 0x63, 0xC6, 0x56, 0x04, 0xFA,
+    0xF8, 0xD1, 0x79, 0xCF, 0xC9, 0x4A, 0x2A, 0x48, 0x52, 0x0C, 0x92, 0x76, 0xDB, 0x40, 0x49, 0x09,
+    0x57, 0x43, 0xA1, 0x53, 0xE2, 0x9B, 0x0F, 0x1F, 0x46, 0x2B, 0x65, 0x16, 0xD5, 0x33, 0x3C, 0x01,
+    0xE3, 0x06, 0xDD, 0x01, 0x78, 0x6D, 0x18, 0x9D, 0x2B, 0x81, 0xFD, 0x72, 0xC9, 0x2C, 0xCC, 0xB8,
+    0x6C, 0x32, 0x8D, 0x80, 0x5B, 0x87, 0xB5, 0x93, 0x2A, 0x5E, 0x9A, 0x8C, 0xB4, 0x12, 0xB4, 0xD1,
+    0xDD, 0x00, 0x8C, 0x2A, 0xF4, 0x52, 0x26, 0x30, 0x26, 0xB3, 0x51, 0xF9, 0x3E, 0x2E, 0x0E, 0xC9,
+    0x16, 0xA4, 0x86, 0x53, 0x9B, 0x3A, 0x69, 0xC5, 0xDF, 0xDC, 0x8F, 0x26, 0xF3, 0x7D, 0xDE, 0xC2,
+    0x6E, 0xC3, 0x4A, 0xA3, 0x32, 0xAF, 0x4E, 0xAA, 0x9D, 0xA4, 0xE8, 0xA5, 0xCD, 0x48, 0x1F, 0x5D,
+    0xF6, 0x65, 0x94, 0x76, 0x96, 0xF3, 0x33, 0x4D, 0xEE, 0xF3, 0x9B, 0xD7, 0x58, 0xE2, 0x65, 0x89,
+    0x5D, 0x06, 0xE6, 0x04, 0x7D, 0x03, 0x5C, 0x01, 0xE6, 0x95, 0x73, 0x27, 0x5C, 0xBD, 0xEC, 0x46,
+    0xA7, 0x09, 0x86, 0x0A, 0x84, 0x0C, 0x9D, 0x12, 0x0C, 0x0D, 0xF8, 0xC6, 0xBB, 0x00, 0x7C, 0xED,
+    0xE1, 0xC3, 0x48, 0x2F, 0x55, 0x08, 0x52, 0xC4, 0x48, 0x05, 0x16, 0x16, 0x70, 0xD9, 0x65, 0x68,
+    0x34, 0x18, 0xD3, 0xB8, 0x62, 0x6A, 0x7F, 0x40, 0x88, 0x21, 0x61, 0x8B, 0xAD, 0xB0, 0xB0, 0x44,
+    0xDC, 0xE6, 0x0A, 0xFD, 0x81, 0x60, 0x49, 0x63, 0xC6, 0x97, 0xBE, 0x11, 0x24, 0x1D, 0x46, 0x92,
+    0x52, 0x90, 0x54, 0x8C, 0x24, 0x11, 0x12, 0x7E, 0x35, 0x15, 0x53, 0x79, 0x61, 0xE2, 0x66, 0x02,
+    0x6E, 0xDD, 0xFC, 0x15, 0x9D, 0xA4, 0xC8, 0x72, 0x59, 0xF5, 0xED, 0x0C, 0x6B, 0x28, 0x80, 0xA9,
+    0x5C, 0x36, 0x88, 0xF9, 0xE3, 0xBF, 0x07, 0x2F, 0x5D, 0xB2, 0xCD, 0x4A, 0xEB, 0x19, 0x36, 0x9A,
+    0x2E, 0xAB, 0x80, 0xFF, 0xFC, 0xE6, 0x1E, 0x4E, 0x3A, 0x30, 0x92, 0xA6, 0x4E, 0x52, 0xE2, 0x9A,
+    0x70, 0x15, 0x60, 0xD9, 0x82, 0xD6, 0x90, 0x41, 0x49, 0x32, 0x02, 0xA3, 0x57, 0x54, 0x42, 0x01,
+    0xDB, 0x9C, 0x3E, 0xD0, 0x04, 0xAE, 0xCE, 0xCD, 0x17, 0x20, 0x7C, 0xAA, 0xCF, 0x15, 0x81, 0xF9,
+    0x13, 0xFD, 0xFA, 0xCC, 0x53, 0x35, 0x25, 0xA0, 0xD7, 0xE5, 0x76, 0x56, 0x52, 0x02, 0x70, 0x97,
+    0x0F, 0xF0, 0xD2, 0xCA, 0x79, 0xAD, 0xAE, 0xFB, 0x27, 0x2E, 0xBF, 0x39, 0x03, 0x91, 0xD4, 0x80,
+    0x41, 0x9F, 0xB4, 0xA5, 0x01, 0x6A, 0xA1, 0xE8, 0x80, 0x51, 0xAB, 0x9E, 0xE8, 0xA0, 0xD7, 0x61,
+    0x9B, 0x51, 0x65, 0xD6, 0xEA, 0x8B, 0x55, 0x85, 0x6F, 0x28, 0x12, 0x54, 0x08, 0xAA, 0xFC, 0x59,
+    0x57, 0x81, 0x0A, 0x7D, 0x85, 0x3B, 0x3B, 0x5E, 0x1B, 0xA1, 0x41, 0xD0, 0x04, 0x63, 0x02, 0xB7,
+    0xC2, 0xB8, 0xFE, 0x31, 0xF3, 0x7A, 0xF7, 0x75, 0xA5, 0x20, 0xC5, 0x59, 0x8D, 0x45, 0x3B, 0x77,
+    0x14, 0xCF, 0xA4, 0x3A, 0xD7, 0x75, 0xDC, 0x08, 0x1B, 0xCB, 0x64, 0x34, 0x99, 0x8A, 0xAF, 0x8C,
+    0xB9, 0x57, 0x66, 0x89, 0xA3, 0xA2, 0xA9, 0xE8, 0xC0, 0x65, 0xA7, 0xCC, 0x1C, 0xA5, 0xD4, 0x1F,
+    0xC3, 0x57, 0x0D, 0x97, 0x97, 0x47, 0x85, 0xF9, 0x17, 0x55, 0xA9, 0x6F, 0xE1, 0x17, 0xC2, 0xFD,
+    0xEE, 0x08, 0x3B, 0x41, 0x9B, 0x52, 0xAF, 0x36, 0x08, 0xA7, 0x1C, 0x76, 0x82, 0x3A, 0xAD, 0x9D,
+    0xCA, 0x20, 0x06, 0xC5, 0x50, 0x09, 0xB5, 0xD3, 0xF6, 0x4C, 0x6C, 0xDC, 0x3A, 0xAE, 0x10, 0x24,
+    0x60, 0x51, 0x01, 0xA4, 0x09, 0x78, 0xE3, 0xC1, 0xF5, 0x0A, 0x5D, 0xD4, 0xC1, 0xED, 0xF8, 0x15,
+    0xAD, 0x88, 0x41, 0xD8, 0xCA, 0x52, 0xF1, 0x9B, 0xD5, 0x86, 0x08, 0x9A, 0x4C, 0x35, 0xAA, 0x8C,
+    0x5B, 0x50, 0x66, 0x79, 0xB9, 0x29, 0x9A, 0xEA, 0x3F, 0x39, 0x18, 0x3F, 0x55, 0xC8, 0x2C, 0x7F,
+    0xFD, 0xA9, 0x92, 0x39, 0xF4, 0x6A, 0xC3, 0x69, 0x0F, 0x99, 0x45, 0x3F, 0x50, 0x32, 0xAA, 0xAE,
+    0xE1, 0x94, 0xE6, 0xC2, 0x7C, 0xF4, 0x4A, 0xBD, 0x36, 0x27, 0x9C, 0x98, 0x77, 0x60, 0x4E, 0xCB,
+    0x46, 0x7F, 0xD8, 0x06, 0x2E, 0xCF, 0x19, 0xE6, 0x77, 0x04, 0xE6, 0x08, 0x19, 0xDC, 0x67, 0x02,
+    0x96, 0xFB, 0x05, 0x4C, 0xD3, 0x04, 0xA3, 0x76, 0x40, 0x8A, 0x60, 0xB4, 0x03, 0xFE, 0xD4, 0xAF,
+    0x06, 0x58, 0x35, 0xC0, 0xEB, 0x00, 0xA4, 0x03, 0x6C, 0x55, 0x85, 0xF0, 0xA9, 0x2A, 0xE8, 0x1D,
+    0x55, 0x86, 0xC3, 0x6A, 0x27, 0x64, 0xA7, 0x1D, 0x08, 0x52, 0xC2, 0x4A, 0x3B, 0x2C, 0xD2, 0x84,
+    0x6B, 0x4B, 0x06, 0xBD, 0x24, 0x18, 0xB3, 0xDF, 0xE8, 0x9B, 0x39, 0x20, 0xAC, 0x21, 0x61, 0xEB,
+    0x50, 0x61, 0x89, 0x8A, 0xB8, 0xE2, 0x32, 0x9D, 0x3A, 0x81, 0xDF, 0xFC, 0x86, 0xA9, 0xE6, 0x80,
+    0x39, 0xCD, 0x09, 0xB7, 0x0F, 0x95, 0xDB, 0x42, 0xB1, 0x53, 0x1E, 0x0B, 0xFE, 0xE8, 0x85, 0xD1,
+    0x14, 0xF2, 0x75, 0x91, 0xC7, 0x1D, 0x7B, 0xE0, 0x2B, 0xAE, 0x12, 0xAE, 0xCF, 0x79, 0x67, 0xA9,
+    0xA8, 0xA0, 0xC3, 0x28, 0xA3, 0x36, 0x28, 0x77, 0x6A, 0xA3, 0xB6, 0xBE, 0x29, 0x3C, 0x5D, 0xCD,
+    0xA1, 0x65, 0x49, 0xB6, 0x4A, 0x21, 0x0D, 0xBB, 0x8E, 0x39, 0xBA, 0xA2, 0x7D, 0x99, 0x5C, 0x56,
+    0x16, 0x63, 0xD6, 0x87, 0xC2, 0x6F, 0xFA, 0xA0, 0x11, 0xD6, 0x87, 0xE6, 0x60, 0x4E, 0x98, 0xCA,
+    0x92, 0x18, 0x2A, 0x6F, 0x4C, 0xDC, 0x7E, 0x0F, 0xCC, 0x41, 0xDF, 0xB0, 0x15, 0x73, 0x30, 0x54,
+    0xCC, 0x81, 0xDB, 0xB1, 0x15, 0x57, 0x18, 0x2A, 0x63, 0xC6, 0xED, 0x84, 0xCC, 0x58, 0x08, 0x1B,
+    0x3E, 0x33, 0xAF, 0x84, 0xCC, 0xB2, 0x12, 0x36, 0x94, 0x58, 0xD6, 0x4E, 0xFF, 0x74, 0xA3, 0xD4,
+    0x4B, 0x52, 0x32, 0x92, 0x14, 0xCF, 0x57, 0x2B, 0x49, 0x93, 0x93, 0x24, 0xDC, 0xC1, 0x20, 0xC6,
+    0x8A, 0x6B, 0xF8, 0xCA, 0x78, 0x10, 0xF6, 0xD3, 0x64, 0xBA, 0x65, 0x3F, 0xCF, 0xEE, 0x0A, 0x83,
+    0xD4, 0xC0, 0xE9, 0xEF, 0xB4, 0xE2, 0x1A, 0xE3, 0xCE, 0xD0, 0xE8, 0x85, 0x6D, 0x30, 0xAF, 0x46,
+    0xE0, 0x4A, 0xA7, 0x09, 0x73, 0xB0, 0x24, 0xD0, 0x14, 0x36, 0x98, 0xD3, 0x98, 0x61, 0xCC, 0x43,
+    0x05, 0xB7, 0xF7, 0x02, 0x73, 0xA0, 0x88, 0x11, 0x21, 0xD3, 0x2B, 0x3A, 0x3D, 0x78, 0x5D, 0xAB,
+    0x91, 0xA4, 0x8C, 0x24, 0x15, 0xBC, 0xA4, 0x1D, 0x23, 0x69, 0xE7, 0xB4, 0x59, 0xBA, 0x45, 0x0F,
+    0xFE, 0xD0, 0x84, 0xBD, 0x54, 0x4F, 0xAD, 0x0A, 0xD2, 0xCE, 0xFC, 0x37, 0xAF, 0x17, 0x34, 0x0D,
+    0x19, 0xE1, 0x72, 0x27, 0xDC, 0xD6, 0x37, 0xC6, 0xD5, 0x1C, 0xF8, 0x64, 0x2A, 0x21, 0xD9, 0xCA,
+    0x1C, 0x87, 0x9D, 0x65, 0x72, 0x05, 0x4D, 0x2E, 0x23, 0xC6, 0xDC, 0x89, 0xB0, 0xF5, 0x8D, 0xB0,
+    0x9A, 0x83, 0x39, 0xD9, 0xCA, 0x92, 0x86, 0xCA, 0x1B, 0xD3, 0xED, 0xF7, 0xAE, 0x23, 0xCD, 0xDA,
+    0x2E, 0x07, 0xD0, 0x49, 0x19, 0x5B, 0xBA, 0x03, 0x53, 0x09, 0x11, 0xE1, 0x36, 0xE6, 0xE8, 0x0A,
+    0xE1, 0x37, 0x8F, 0x2A, 0x4E, 0x6A, 0xD8, 0xAB, 0x75, 0x83, 0xD4, 0x60, 0xD6, 0x47, 0xE0, 0x33,
+    0xE0, 0x76, 0xC0, 0x36, 0xA0, 0xD7, 0x04, 0x28, 0x01, 0x73, 0x06, 0xFC, 0x0E, 0xB8, 0xF6, 0x7C,
+    0x78, 0xB7, 0xF5, 0x05, 0x0C, 0x3A, 0x2D, 0xB6, 0x72, 0xEA, 0xF3, 0xAC, 0xAF, 0x0A, 0x4E, 0x13,
+    0x18, 0x25, 0x60, 0xC9, 0x57, 0xF7, 0xEA, 0x15, 0x2F, 0xAE, 0x85, 0xD5, 0xA9, 0xDE, 0x80, 0x13,
+    0x80, 0x32, 0xE0, 0xF4, 0x9B, 0xD7, 0x57, 0x24, 0x1D, 0x0C, 0x97, 0x7B, 0xA9, 0x62, 0x24, 0x45,
+    0x9C, 0xB4, 0x83, 0x97, 0x26, 0x6E, 0xDD, 0xDC, 0xDC, 0xDC, 0x78, 0x49, 0x2D, 0x48, 0x3A, 0x82,
+    0xA4, 0x3A, 0x4B, 0xAA, 0xA7, 0x81, 0x98, 0x03, 0xB0, 0x95, 0x8B, 0x4B, 0xBA, 0xFD, 0xEA, 0xA5,
+    0x3E, 0x5F, 0x87, 0x0F, 0xDB, 0xC5, 0x5A, 0x59, 0xD2, 0x25, 0xC8, 0x4E, 0xF1, 0x12, 0xB3, 0x11,
+    0x97, 0x97, 0xE1, 0x44, 0xA0, 0xC4, 0xC2, 0x50, 0x08, 0xB1, 0x6B, 0xF8, 0x44, 0x48, 0xE3, 0x7A,
+    0x9E, 0x53, 0xD3, 0x6C, 0x81, 0xE5, 0xE7, 0x15, 0xC6, 0xDF, 0x56, 0x30, 0x6A, 0x80, 0x04, 0x78,
+    0x4D, 0xCF, 0xE8, 0x67, 0xBD, 0x8E, 0xE8, 0x9E, 0xAD, 0xF0, 0x58, 0xC1, 0xEA, 0x80, 0xFE, 0xFC,
+    0x49, 0x03, 0xC2, 0x0E, 0xDC, 0x9A, 0x7E, 0x4F, 0x70, 0xD2, 0xC1, 0x2C, 0x35, 0xBB, 0x87, 0xF4,
+    0x38, 0xF4, 0x8D, 0xCF, 0xB3, 0x2B, 0xC3, 0x2F, 0x53, 0x48, 0xC1, 0xBF, 0x2C, 0xBB, 0x2F, 0x92,
+    0x3E, 0x94, 0xD4, 0x8C, 0xA4, 0xAD, 0x97, 0xDA, 0x25, 0x3C, 0x45, 0xB0, 0xC7, 0x35, 0x58, 0xA5,
+    0xCB, 0x8E, 0xFA, 0xC2, 0x85, 0xFE, 0xC2, 0x8A, 0xDB, 0x71, 0x05, 0x96, 0x64, 0x0F, 0xB0, 0xAD,
+    0xD3, 0x04, 0x21, 0x9F, 0xB8, 0xF1, 0x68, 0x07, 0x9C, 0x4E, 0x37, 0x56, 0x04, 0x86, 0x53, 0xEC,
+    0xC3, 0x7E, 0xBA, 0x64, 0x04, 0xBA, 0xD3, 0x21, 0x67, 0xAD, 0xA7, 0x5F, 0x02, 0x46, 0xCA, 0x80,
+    0xFE, 0x43, 0x11, 0x42, 0x0D, 0x15, 0x9C, 0x7A, 0xAD, 0x18, 0xA5, 0x51, 0xB0, 0x14, 0x94, 0xF1,
+    0x8D, 0x41, 0x11, 0xBE, 0x16, 0xBB, 0xF7, 0x58, 0x70, 0xAB, 0xD9, 0x99, 0x71, 0x6B, 0x5F, 0x59,
+    0x70, 0x9B, 0xA9, 0x84, 0xC9, 0x6D, 0x5D, 0x65, 0x9E, 0x5C, 0xEE, 0x2B, 0x21, 0xBA, 0xDC, 0x1D,
+    0x84, 0x38, 0xE4, 0xEE, 0x20, 0x24, 0x97, 0xBB, 0x46, 0x48, 0x43, 0x39, 0xDF, 0xF6, 0x4E, 0x53,
+    0x90, 0x34, 0x49, 0xAA, 0x56, 0xD2, 0xE6, 0x4F, 0x67, 0x36, 0x3B, 0xE0, 0xD7, 0x8B, 0xF9, 0xDC,
+    0x7E, 0x0F, 0xEE, 0xF1, 0x75, 0x93, 0xA9, 0x26, 0x77, 0xD5, 0xAE, 0xFD, 0xEE, 0x92, 0x29, 0x6E,
+    0xB2, 0xD9, 0x33, 0xE4, 0xBB, 0xB8, 0xED, 0x3B, 0x84, 0xF5, 0xAD, 0x4E, 0x69, 0x3E, 0x29, 0x27,
+    0x7A, 0x69, 0xB2, 0x2D, 0x00, 0x01, 0x78, 0x0B, 0x38, 0x4E, 0xA7, 0xEE, 0x2A, 0xBC, 0x30, 0xD1,
+    0xBD, 0x86, 0xFA, 0xC3, 0x6D, 0xA6, 0xBA, 0x3C, 0x4F, 0xE3, 0x16, 0x7E, 0x50, 0x59, 0x5E, 0x3A,
+    0x5C, 0x36, 0x75, 0xC8, 0x21, 0xBA, 0x1C, 0x9E, 0x1C, 0xCC, 0xB1, 0x0D, 0xB9, 0x3F, 0x6C, 0x09,
+    0xD1, 0x65, 0x9F, 0x0E, 0xE6, 0x28, 0x9B, 0xFB, 0xC3, 0xEC, 0x3E, 0xB9, 0x3C, 0xA6, 0x46, 0x48,
+    0x8B, 0x29, 0x5D, 0x33, 0xFB, 0x98, 0x86, 0xE2, 0xD6, 0x85, 0x20, 0x69, 0x47, 0x92, 0x56, 0x2B,
+    0x49, 0xF8, 0x2B, 0x9F, 0x00, 0xE8, 0xA5, 0x9F, 0x3C, 0x1B, 0x32, 0x87, 0x0F, 0x2A, 0xCB, 0x4B,
+    0xCD, 0x65, 0x53, 0x87, 0xF2, 0x87, 0x43, 0x56, 0x5B, 0x42, 0x72, 0xD9, 0xA7, 0x46, 0x88, 0xB2,
+    0xA5, 0x3B, 0xCC, 0xEE, 0xD3, 0x90, 0xC7, 0x75, 0x21, 0xC4, 0xC5, 0xEC, 0x1C, 0xA6, 0xBA, 0xD5,
+    0x66, 0xB7, 0xCE, 0x78, 0x49, 0x8A, 0x92, 0x24, 0x23, 0x49, 0xC5, 0x4B, 0x52, 0xBA, 0xB9, 0xB9,
+    0xF9, 0xCB, 0x83, 0x6B, 0xE6, 0xB2, 0xC4, 0x67, 0xAC, 0x01, 0x04, 0x65, 0x46, 0x55, 0x06, 0x1D,
+    0x80, 0x07, 0x5C, 0x02, 0x93, 0xA1, 0xDB, 0x01, 0xB5, 0x48, 0x50, 0x65, 0x94, 0xD2, 0xB0, 0xB9,
+    0x6C, 0x4A, 0x57, 0xA9, 0x88, 0x99, 0x25, 0x86, 0x8F, 0xB5, 0x3A, 0x69, 0xB3, 0x67, 0xE2, 0x3E,
+    0x27, 0x9B, 0xC3, 0x09, 0xCA, 0xE1, 0x84, 0x0B, 0x4D, 0xB7, 0x23, 0x98, 0x4A, 0x00, 0xC6, 0xCC,
+    0x0E, 0x2C, 0xD1, 0xAE, 0x60, 0x0E, 0xC2, 0x39, 0xB1, 0x0A, 0xCC, 0xD1, 0x66, 0xE8, 0x0F, 0x7C,
+    0x04, 0x97, 0xCF, 0xC1, 0x93, 0x91, 0x52, 0xA7, 0x73, 0x06, 0x3B, 0xEF, 0x23, 0xC2, 0x6A, 0x4A,
+    0x57, 0x11, 0x2E, 0xB9, 0x3C, 0x54, 0x16, 0x96, 0x18, 0xB2, 0x69, 0x8F, 0x0E, 0x14, 0x9D, 0xB4,
+    0xD9, 0x83, 0x59, 0x8D, 0x50, 0x7A, 0xE9, 0xC1, 0xA9, 0x7E, 0xF4, 0xCB, 0x65, 0x6E, 0x15, 0xCC,
+    0x06, 0xE3, 0x04, 0x8F, 0xCF, 0x48, 0x5D, 0x82, 0xF7, 0xC1, 0xE8, 0x4B, 0x9C, 0xC4, 0x2C, 0xF5,
+    0xFB, 0xB9, 0xAA, 0x81, 0xF0, 0xA4, 0xF6, 0xCD, 0x7D, 0xB9, 0x94, 0x20, 0xBD, 0x2D, 0xED, 0x83,
+    0xDA, 0xF4, 0xBC, 0x7A, 0xDE, 0x39, 0x25, 0x42, 0x89, 0x93, 0x95, 0x87, 0x2F, 0xAC, 0x22, 0xCB,
+    0x64, 0x84, 0x2D, 0xD8, 0x4A, 0xB8, 0xD4, 0x6B, 0x84, 0x74, 0x2A, 0x36, 0x5E, 0xDA, 0x41, 0x17,
+    0x26, 0x15, 0xC0, 0x50, 0x3B, 0x6D, 0xDD, 0x72, 0xC9, 0x94, 0x51, 0x52, 0x61, 0x96, 0x14, 0x91,
+    0xB4, 0xD3, 0x49, 0x9A, 0xE0, 0x7F, 0x38, 0x13, 0x2F, 0x70, 0xE7, 0x0B, 0x98, 0x3B, 0x29, 0xF2,
+    0x33, 0x2B, 0xAD, 0xD4, 0xB1, 0x3D, 0xDA, 0xA8, 0x61, 0x1B, 0x72, 0xB7, 0xCF, 0xD1, 0xE4, 0xBE,
+    0x08, 0x93, 0x8D, 0x0E, 0x4C, 0x36, 0xAA, 0xD8, 0xCD, 0x6A, 0x67, 0x58, 0x07, 0x15, 0xDC, 0xEA,
+    0x94, 0xF1, 0xC9, 0xFD, 0xA8, 0x30, 0xC7, 0xF1, 0x2F, 0x6A, 0x2F, 0xFC, 0x20, 0x35, 0xEE, 0x5A,
+    0xA9, 0xF2, 0x1D, 0x23, 0x15, 0xDE, 0xEC, 0xA4, 0x95, 0xC7, 0xF8, 0x2F, 0x7E, 0x3F, 0x70, 0xB7,
+    0xE8, 0x12, 0xF6, 0x20, 0x65, 0x6C, 0xEE, 0x77, 0x4C, 0xE6, 0xA0, 0xAF, 0xCC, 0x70, 0x4A, 0x6C,
+    0x74, 0x99, 0xB1, 0x98, 0x1D, 0x23, 0x1D, 0x57, 0x80, 0x92, 0xD2, 0xE9, 0x6E, 0xAE, 0xCC, 0x3B,
+    0xAE, 0xD8, 0xC6, 0x50, 0x8D, 0x26, 0x23, 0x94, 0x7A, 0xC5, 0x39, 0x77, 0x5A, 0xC3, 0x8E, 0xB2,
+    0x6B, 0x2C, 0xD5, 0xEA, 0xF9, 0xE5, 0xBE, 0x7D, 0x80, 0x57, 0x63, 0xD1, 0x41, 0xB3, 0x87, 0xD9,
+    0xFB, 0x6A, 0x73, 0x5F, 0x87, 0xB5, 0xAF, 0x2E, 0xF5, 0xFB, 0x38, 0x99, 0xDD, 0x63, 0x4A, 0xC0,
+    0xE5, 0xF0, 0xB1, 0x72, 0x90, 0xB2, 0x97, 0xB2, 0x93, 0xB6, 0xFE, 0x8A, 0xD9, 0x00, 0x7F, 0x0A,
+    0xDC, 0x2E, 0x70, 0x47, 0x1B, 0xFD, 0x65, 0x46, 0x13, 0xA1, 0x1D, 0xA7, 0xD0, 0x5E, 0x1C, 0xE8,
+    0x8D, 0x09, 0x2B, 0x95, 0xB3, 0x78, 0x71, 0x92, 0x18, 0x9B, 0x15, 0xBE, 0xF4, 0xC2, 0x6F, 0xBD,
+    0x08, 0xAB, 0x69, 0x84, 0xD5, 0x55, 0xC2, 0x97, 0xCB, 0xCE, 0x28, 0xE5, 0x33, 0xC0, 0xD3, 0x43,
+    0x96, 0x77, 0x81, 0xA5, 0x4D, 0x46, 0x8A, 0xEE, 0xC3, 0x99, 0x99, 0xC7, 0x7D, 0x31, 0xD9, 0x25,
+    0x3F, 0x05, 0xED, 0x9D, 0xB4, 0xBA, 0x8F, 0x1F, 0xA5, 0x80, 0x7F, 0xA9, 0x72, 0x0C, 0x5F, 0x2A,
+    0x07, 0x29, 0x4A, 0xBB, 0x55, 0x9B, 0xCE, 0x5A, 0x25, 0x48, 0x69, 0x94, 0xF2, 0xB0, 0x5F, 0x1C,
+    0x51, 0x97, 0xAA, 0xCA, 0x6F, 0xA7, 0x1D, 0xDA, 0xE3, 0x52, 0x59, 0x2A, 0x9D, 0xC7, 0x6D, 0x2C,
+    0x30, 0xFC, 0xBE, 0x9D, 0x10, 0x94, 0xE9, 0xCE, 0x00, 0x1B, 0x84, 0x57, 0x0B, 0x7D, 0x0D, 0x09,
+    0xB7, 0x09, 0x66, 0xBB, 0x63, 0xAA, 0x5F, 0x71, 0x9B, 0x26, 0x64, 0x2A, 0x6E, 0x77, 0x99, 0x25,
+    0xCD, 0x31, 0x48, 0xDA, 0xAE, 0x3A, 0xB2, 0x3B, 0x49, 0x29, 0x44, 0x1A, 0x8D, 0x21, 0x3F, 0xCB,
+    0x80, 0x88, 0x51, 0xC5, 0x68, 0x49, 0xA6, 0x76, 0xA5, 0xAF, 0xB7, 0xDE, 0x47, 0x52, 0x5C, 0xA4,
+    0x2D, 0x48, 0xFB, 0xD8, 0x7E, 0x7C, 0x6F, 0x38, 0xCF, 0x33, 0x2C, 0x1F, 0xD9, 0x75, 0x94, 0xB2,
+    0x39, 0x31, 0xAA, 0xD1, 0x2D, 0x1F, 0xD1, 0x3D, 0x8C, 0x0F, 0xA7, 0x6F, 0xC6, 0x37, 0x1E, 0xB8,
+    0x63, 0xD8, 0x4D, 0x1D, 0x77, 0x42, 0x9E, 0xE3, 0xF2, 0x4A, 0xA3, 0xD3, 0x0F, 0xAB, 0xCB, 0x8A,
+    0x0C, 0x75, 0x7E, 0x72, 0x84, 0x0D, 0xC2, 0x67, 0x35, 0xFC, 0xC3, 0x0E, 0x9D, 0x96, 0x5F, 0x7C,
+    0x75, 0x56, 0x6A, 0x75, 0x39, 0x51, 0x44, 0xBF, 0xD6, 0x06, 0x74, 0x27, 0xC5, 0x71, 0xE9, 0x6E,
+    0x70, 0xC5, 0x3A, 0x3A, 0x49, 0xDA, 0x80, 0x45, 0x92, 0x22, 0x04, 0xF9, 0x36, 0x37, 0x18, 0xF5,
+    0x81, 0xFE, 0x51, 0x3B, 0x83, 0xB2, 0xAF, 0x4E, 0x9B, 0x55, 0x35, 0x8A, 0xB3, 0x22, 0xF7, 0xD7,
+    0x4E, 0x7B, 0x37, 0xBD, 0x08, 0x2F, 0x72, 0xAB, 0xA0, 0xB5, 0xD3, 0x8A, 0xC9, 0xF4, 0xF9, 0x8F,
+    0xBE, 0xB7, 0x79, 0xA5, 0xA0, 0xE8, 0xBF, 0x80, 0x83, 0x71, 0x73, 0xC9, 0x1E, 0x5D, 0xED, 0x94,
+    0x7C, 0x9C, 0xAB, 0xD9, 0x9D, 0xE2, 0xFC, 0x8A, 0xF6, 0x21, 0x6B, 0x9E, 0x14, 0xFE, 0x25, 0xBB,
+    0xA7, 0x45, 0x9D, 0x9A, 0xDB, 0xBC, 0xDE, 0x3E, 0x8C, 0xB6, 0x90, 0x42, 0x35, 0xD5, 0x8A, 0x39,
+    0x2E, 0x69, 0x28, 0xCF, 0xE5, 0xF6, 0xD1, 0x1D, 0x67, 0xF2, 0x2C, 0x2A, 0x18, 0x1D, 0x70, 0xFB,
+    0xA7, 0xE7, 0x37, 0x36, 0xDD, 0x9A, 0xA8, 0x7D, 0xC5, 0xC5, 0x39, 0x76, 0x65, 0x2C, 0x78, 0x23,
+    0x4C, 0x56, 0xE6, 0xAE, 0x6F, 0x0C, 0xBF, 0xFC, 0xF5, 0xCA, 0xF1, 0x79, 0xC5, 0xB5, 0x10, 0x3B,
+    0xFD, 0xBC, 0xE0, 0xF3, 0x82, 0x39, 0x5C, 0x66, 0x7E, 0xBB, 0x01, 0x36, 0x2F, 0x93, 0x29, 0xCB,
+    0xD4, 0xD5, 0x65, 0xE2, 0x98, 0x27, 0xC2, 0x32, 0xE1, 0x35, 0xE1, 0x34, 0x31, 0x68, 0xC2, 0x28,
+    0x9D, 0x24, 0x20, 0x25, 0xE6, 0xFB, 0x15, 0xFF, 0x73, 0x25, 0xB7, 0xCD, 0x15, 0x9C, 0x32, 0xB3,
+    0x52, 0xFF, 0xE5, 0xFB, 0xB8, 0x0F, 0x0A, 0xC1, 0xA5, 0xBE, 0xDC, 0xC5, 0x3D, 0x29, 0xDC, 0x75,
+    0xA9, 0x2F, 0x01, 0xF7, 0x64, 0xE7, 0xAD, 0x61, 0x1D, 0x4A, 0x20, 0x3C, 0xA9, 0xDD, 0x4F, 0x6E,
+    0x3F, 0xB8, 0x4A, 0x53, 0x77, 0xAF, 0x6B, 0x8C, 0xDB, 0x50, 0xD1, 0x14, 0xF2, 0x50, 0x3B, 0xA5,
+    0x39, 0x0F, 0x32, 0x8A, 0xE1, 0xF0, 0x07, 0x5F, 0x7D, 0xA1, 0x3C, 0x3C, 0x7D, 0xFA, 0x34, 0x85,
+    0xB9, 0x2D, 0x54, 0x7D, 0xB6, 0xDB, 0xFF, 0xD4, 0xDF, 0xAE, 0xE1, 0x97, 0x75, 0xA1, 0x8D, 0xBF,
+    0xAA, 0xB6, 0xCC, 0xE3, 0xE6, 0xD3, 0xBD, 0xAB, 0x00, 0x8C, 0xA9, 0xAF, 0xF8, 0x68, 0x76, 0xC2,
+    0x64, 0x0B, 0x33, 0x43, 0x66, 0xC1, 0x65, 0x1A, 0x6E, 0xEB, 0x0E, 0xFC, 0xDA, 0xD7, 0xD3, 0x2E,
+    0x94, 0xAC, 0xA4, 0x38, 0x5C, 0xCB, 0x0E, 0xC6, 0xDC, 0x0B, 0xBF, 0x99, 0x0B, 0x7C, 0xD3, 0x2D,
+    0x0F, 0x30, 0x27, 0x41, 0xAF, 0xA6, 0xD9, 0x6A, 0x0E, 0x16, 0x1A, 0x3E, 0x2D, 0x0C, 0x39, 0x44,
+    0x53, 0xDD, 0xD6, 0x35, 0x5B, 0x50, 0xA7, 0x93, 0x24, 0x56, 0x77, 0xF6, 0x7A, 0x32, 0x41, 0xDB,
+    0x89, 0xC0, 0x92, 0x36, 0x27, 0x1D, 0x9D, 0xA4, 0xE4, 0x93, 0xA9, 0xA6, 0x12, 0xE2, 0x1C, 0x6D,
+    0x19, 0x0A, 0x42, 0xB8, 0xEC, 0x72, 0xD7, 0xBA, 0x86, 0x5F, 0xFD, 0x6A, 0xAA, 0xA9, 0xCC, 0x29,
+    0xA4, 0x61, 0xB7, 0x15, 0x4D, 0x4B, 0x74, 0xCF, 0x0A, 0xBE, 0x5B, 0xF7, 0x60, 0xF8, 0x9D, 0xD2,
+    0xA5, 0x3D, 0xE1, 0xF4, 0xCF, 0x05, 0xB4, 0xB9, 0xC8, 0xB8, 0xF3, 0x98, 0x5E, 0xB8, 0x44, 0xD8,
+    0xD8, 0x31, 0x07, 0xE3, 0xC4, 0xBC, 0x9A, 0x8C, 0x6B, 0x5D, 0x03, 0x49, 0x09, 0x2F, 0x15, 0x8C,
+    0xD4, 0xAE, 0x12, 0x5B, 0xDE, 0x98, 0x2E, 0xED, 0xC1, 0xB0, 0x5D, 0x29, 0xFA, 0x6C, 0xE7, 0x8D,
+    0x19, 0x30, 0xED, 0xBF, 0xB9, 0xC8, 0x9D, 0x83, 0x51, 0xD9, 0xAA, 0xA1, 0x07, 0xF7, 0x42, 0xC2,
+    0x16, 0x58, 0xC0, 0x6D, 0x74, 0x07, 0xF8, 0x95, 0xBE, 0x75, 0x8C, 0x5F, 0xEE, 0x9C, 0x2C, 0xC3,
+    0xA0, 0x18, 0x4E, 0x6E, 0xAF, 0xB3, 0x54, 0x5F, 0x1B, 0xD3, 0xD7, 0xF1, 0x09, 0x42, 0x82, 0x10,
+    0x61, 0x99, 0x4E, 0xA1, 0x12, 0x74, 0xED, 0x14, 0x2E, 0x73, 0x9C, 0xF3, 0x18, 0x9E, 0x71, 0x47,
+    0x42, 0xB8, 0xCC, 0x82, 0x39, 0x08, 0x91, 0x25, 0xFA, 0xC4, 0x98, 0xC7, 0xF5, 0x4C, 0x5C, 0xF4,
+    0xC3, 0x02, 0xFE, 0xB3, 0x1D, 0xAC, 0xEA, 0x33, 0xB8, 0x3E, 0x79, 0x7E, 0xBA, 0x74, 0xCC, 0x08,
+    0xE9, 0xDA, 0x02, 0xF5, 0x19, 0x6E, 0x2D, 0x05, 0x9C, 0x76, 0x30, 0xAA, 0xD0, 0x69, 0xBF, 0x56,
+    0x27, 0x40, 0xBF, 0x01, 0x2F, 0x2C, 0x3F, 0x86, 0x59, 0x3A, 0xF0, 0x92, 0xB2, 0x3D, 0x5C, 0x9A,
+    0x27, 0x75, 0xD5, 0xEC, 0x3E, 0x85, 0x18, 0xDE, 0xD9, 0x4D, 0x31, 0x7B, 0x60, 0x66, 0x7E, 0x25,
+    0x0F, 0xD9, 0xE5, 0x30, 0x35, 0x23, 0x73, 0x7C, 0xEF, 0xDF, 0xB5, 0xFA, 0x2B, 0xCE, 0x1D, 0x74,
+    0xCB, 0x39, 0x99, 0x09, 0xB0, 0x27, 0x52, 0x01, 0xB8, 0x8D, 0x4B, 0xBB, 0xF2, 0x5A, 0x37, 0xAE,
+    0x08, 0x53, 0x11, 0x2C, 0x93, 0x60, 0xDC, 0x04, 0xE6, 0x38, 0xDB, 0x2B, 0x13, 0xD7, 0xF2, 0x6A,
+    0x82, 0x4E, 0x2B, 0xF4, 0xAA, 0xD0, 0x4B, 0x13, 0xBD, 0xE6, 0x8C, 0xD1, 0x77, 0x1B, 0x46, 0x93,
+    0x92, 0xD1, 0xE4, 0xF7, 0x67, 0x1D, 0x18, 0x9F, 0x5C, 0x36, 0xB5, 0x6B, 0x84, 0xE8, 0x57, 0x5B,
+    0x4C, 0x65, 0x21, 0x24, 0x97, 0xCD, 0x4E, 0x63, 0xC6, 0xAD, 0x43, 0xEE, 0x2A, 0x0D, 0x9F, 0xDC,
+    0x6A, 0xF6, 0xAE, 0x12, 0xA2, 0x97, 0xD4, 0x4B, 0xCA, 0xE1, 0xD2, 0xFF, 0x4B, 0x97, 0x1E, 0xEF,
+    0xA5, 0xC9, 0xDA, 0xF1, 0xF5, 0x6F, 0xF5, 0x6B, 0x76, 0x76, 0x7A, 0xF3, 0xC5, 0x7E, 0xDB, 0xC6,
+    0xEF, 0x3E, 0xA9, 0xA3, 0x72, 0x50, 0xFA, 0x93, 0x6F, 0x43, 0xC1, 0x24, 0x3C, 0xA8, 0x7B, 0xCD,
+    0x6D, 0x2E, 0x87, 0x27, 0x47, 0xD7, 0x4C, 0xF5, 0xC9, 0xAF, 0xF3, 0x2B, 0xF5, 0x64, 0xE4, 0x90,
+    0x64, 0x8B, 0xDD, 0xDD, 0xB6, 0xB0, 0xBC, 0x74, 0x0C, 0xF9, 0x24, 0x62, 0xF5, 0xD5, 0xAD, 0xE3,
+    0x16, 0xDE, 0xAE, 0x7D, 0x35, 0xC5, 0xA7, 0x20, 0x69, 0x37, 0x92, 0x34, 0xCD, 0x92, 0xF2, 0x70,
+    0xB6, 0xDC, 0xFE, 0x5F, 0xEE, 0xAB, 0x77, 0x24, 0xA9, 0xCC, 0x92, 0x34, 0xE8, 0x82, 0x56, 0x27,
+    0xE3, 0x2E, 0xF1, 0x5A, 0x39, 0xF6, 0x22, 0x08, 0xA7, 0x84, 0x59, 0x21, 0xC3, 0x9B, 0xE0, 0xC1,
+    0x69, 0x35, 0x3A, 0xBA, 0x3C, 0xC6, 0xC7, 0x66, 0xBB, 0x6B, 0x8A, 0x7B, 0x5A, 0x07, 0xD5, 0xB3,
+    0x73, 0x04, 0xC0, 0xB7, 0x27, 0x60, 0xD8, 0xBA, 0x09, 0x53, 0xBA, 0x0D, 0x2A, 0x05, 0xDE, 0xE2,
+    0x45, 0xF0, 0xD3, 0x08, 0x2E, 0x0D, 0x09, 0x93, 0x8D, 0x72, 0xB7, 0x23, 0xF1, 0x33, 0xDE, 0x1C,
+    0xD6, 0x30, 0xDD, 0xED, 0x8A, 0x4B, 0x6E, 0xAA, 0x43, 0xB6, 0x9F, 0x34, 0x53, 0x7B, 0x89, 0x86,
+    0x1A, 0xF3, 0xC4, 0xD9, 0x11, 0x7C, 0x17, 0x9B, 0xB8, 0x2E, 0xF0, 0x78, 0x0F, 0x1D, 0x46, 0xC7,
+    0xD8, 0xED, 0x8F, 0xCD, 0xBF, 0x6D, 0xE1, 0xD5, 0xA7, 0x75, 0xD6, 0xAF, 0x2E, 0x73, 0xF8, 0xF3,
+    0x8F, 0x18, 0x74, 0x70, 0x77, 0x3A, 0x98, 0xD8, 0xAF, 0xCC, 0x6A, 0x25, 0xBC, 0xEA, 0xD9, 0x5A,
+    0x94, 0x89, 0xF7, 0x8B, 0x93, 0xA6, 0x59, 0x05, 0xFF, 0xFC, 0xDF, 0x09, 0x66, 0xBD, 0xB3, 0x33,
+    0x1A, 0xED, 0x3C, 0x0E, 0x2A, 0xE6, 0x5F, 0x0F, 0xB3, 0x3A, 0x97, 0x5C, 0xFC, 0xFE, 0xCF, 0xB8,
+    0xDB, 0x2B, 0x53, 0x9C, 0x26, 0x9B, 0x42, 0x25, 0x74, 0xBF, 0xCB, 0xDD, 0x3E, 0xBC, 0xBA, 0xF9,
+    0xF4, 0x62, 0x50, 0x23, 0x2F, 0xCA, 0x36, 0x4A, 0x7C, 0xEB, 0xD9, 0x21, 0x62, 0x69, 0xCC, 0xCA,
+    0x2E, 0x86, 0xAE, 0x98, 0xEC, 0x27, 0xFF, 0x72, 0xE9, 0xCB, 0xB8, 0xFA, 0x78, 0xEE, 0x6C, 0x0A,
+    0xAA, 0x6E, 0x5B, 0x9E, 0x1C, 0xA6, 0x86, 0x35, 0xFC, 0xEA, 0x30, 0xC7, 0xBC, 0x85, 0x4F, 0x9A,
+    0x69, 0x30, 0xDB, 0x4C, 0x5F, 0x7D, 0xC2, 0x65, 0xC1, 0xF2, 0xA3, 0x1D, 0xD3, 0xC2, 0xC6, 0xFF,
+    0xF9, 0xB8, 0xBF, 0x9D, 0xF6, 0x83, 0x9E, 0x66, 0x5C, 0xB6, 0x2B, 0x4B, 0x77, 0x3F, 0x1A, 0xA9,
+    0x9D, 0x08, 0x2D, 0x69, 0xB3, 0xFA, 0xE9, 0x6B, 0xF8, 0xC4, 0x29, 0x3A, 0xBD, 0x1E, 0x8C, 0x93,
+    0x95, 0xEA, 0x85, 0x30, 0xA5, 0xC8, 0x6D, 0x3D, 0x80, 0xFF, 0x02, 0xD5, 0x9C, 0x3D, 0xEC, 0x27,
+    0xC7, 0x7D, 0xDE, 0x3F, 0xBB, 0xE3, 0xBB, 0x45, 0xB8, 0x30, 0x86, 0x85, 0x4E, 0x88, 0x45, 0x40,
+    0xDB, 0xA4, 0x88, 0x19, 0x58, 0xDB, 0xBA, 0x88, 0x34, 0x2B, 0x09, 0xB0, 0x0A, 0x17, 0xBA, 0xE2,
+    0xCE, 0x81, 0x23, 0x20, 0x6E, 0x54, 0x38, 0x34, 0x82, 0x0B, 0x02, 0x17, 0x02, 0x42, 0x72, 0x57,
+    0x56, 0xA1, 0x22, 0x85, 0x2E, 0x40, 0x9C, 0x00, 0x49, 0xE1, 0x2B, 0xC8, 0x40, 0x3A, 0x05, 0x38,
+    0x23, 0x70, 0x11, 0x03, 0xF4, 0xED, 0x88, 0x0C, 0xA0, 0x42, 0x85, 0x96, 0xB6, 0xE3, 0x20, 0x48,
+    0xE1, 0x95, 0x74, 0x8A, 0x2D, 0x0A, 0x08, 0x87, 0xD2, 0x4A, 0xDA, 0x23, 0x67, 0xF7, 0x49, 0x31,
+    0xB3, 0xBF, 0xFF, 0xEF, 0xDE, 0x48, 0xDA, 0xB0, 0x15, 0xF9, 0x5F, 0xFC, 0xDF, 0x7E, 0x6F, 0x33,
+    0xCF, 0x7C, 0xE7, 0xFB, 0xF2, 0x7C, 0x9F, 0x19, 0x1A, 0x51, 0xCB, 0x97, 0x9A, 0x50, 0xC0, 0xAD,
+    0xD8, 0x88, 0x11, 0x8F, 0xFB, 0x2A, 0x07, 0xAA, 0x09, 0x1B, 0x30, 0x91, 0x62, 0x87, 0xBE, 0xA3,
+    0xF5, 0xD8, 0x80, 0x59, 0x61, 0x83, 0xBE, 0xA3, 0xF1, 0xD4, 0xA7, 0xBF, 0x1D, 0x34, 0x70, 0xF9,
+    0xFC, 0x2D, 0x02, 0x34, 0x50, 0xCE, 0xF0, 0x51, 0x78, 0x66, 0xC3, 0x2A, 0x54, 0xDA, 0xD1, 0x7A,
+    0xD5, 0x7D, 0xB3, 0xAB, 0x96, 0x80, 0x2C, 0xF6, 0x5B, 0x73, 0xB1, 0x7D, 0x84, 0xE6, 0x4F, 0xA6,
+    0x72, 0xFF, 0x28, 0x8D, 0x56, 0xA4, 0xA9, 0x92, 0xA8, 0x35, 0x60, 0xD3, 0x9B, 0x7C, 0x18, 0x8A,
+    0x9B, 0xE7, 0x6F, 0x5C, 0x8C, 0x13, 0x38, 0x05, 0x2A, 0x69, 0xC6, 0x4D, 0x8D, 0x27, 0x02, 0x66,
+    0x06, 0xEC, 0x00, 0x7C, 0x0C, 0x48, 0xFF, 0x0A, 0x60, 0xA4, 0x8D, 0x46, 0x0A, 0x3C, 0xA7, 0xDB,
+    0x03, 0x66, 0x01, 0x9A, 0x09, 0x4A, 0x41, 0x31, 0x2E, 0x60, 0xA5, 0x7F, 0x47, 0x2F, 0x2D, 0xA5,
+    0xA4, 0xF0, 0xD4, 0xED, 0xDB, 0xB7, 0x87, 0xF4, 0x39, 0x75, 0x57, 0x52, 0xEB, 0x7F, 0xCE, 0xB5,
+    0xB4, 0x21, 0xED, 0xB8, 0x3F, 0xDE, 0x68, 0x27, 0xD7, 0xD9, 0xD0, 0x4C, 0x66, 0x6B, 0x03, 0xD2,
+    0x8A, 0xA4, 0x42, 0xD2, 0xEC, 0xA4, 0x50, 0xF9, 0x4F, 0x04, 0x3A, 0x9E, 0x06, 0x75, 0xF4, 0xBE,
+    0x8E, 0xB4, 0x01, 0x37, 0xD7, 0x91, 0x52, 0x9F, 0x14, 0x34, 0x9B, 0x3C, 0x48, 0x01, 0x2A, 0x45,
+    0xC0, 0x09, 0x28, 0xE4, 0x81, 0x26, 0x3D, 0xB4, 0x41, 0x2B, 0x4D, 0x54, 0xDA, 0xAF, 0x02, 0xBD,
+    0x07, 0x6C, 0xEC, 0xA0, 0xD7, 0x0E, 0x56, 0x0A, 0x18, 0x49, 0x80, 0x9B, 0x81, 0x6A, 0x03, 0x18,
+    0xFD, 0x05, 0x38, 0xB7, 0xF8, 0x28, 0x95, 0x67, 0xC5, 0x76, 0x45, 0xA0, 0xC5, 0x9C, 0x63, 0xF7,
+    0xFB, 0x38, 0xCC, 0xC4, 0xF3, 0xD4, 0x9E, 0x95, 0xA6, 0x2B, 0x03, 0x1F, 0xA3, 0xEC, 0x00, 0x9E,
+    0x03, 0x5A, 0x75, 0x94, 0x52, 0x87, 0x9D, 0x9E, 0x87, 0x57, 0xB8, 0x49, 0xB9, 0x02, 0xB5, 0x6E,
+    0x52, 0x48, 0x13, 0x8D, 0xE4, 0xD1, 0xAF, 0x88, 0x7A, 0xE6, 0x15, 0x1C, 0x65, 0x40, 0xB7, 0xC7,
+    0xC1, 0x48, 0x91, 0x4A, 0xF2, 0x5C, 0x56, 0x04, 0xDA, 0x19, 0x68, 0x3D, 0x2F, 0x14, 0x1B, 0x95,
+    0x14, 0x70, 0x12, 0xDC, 0xD0, 0x4D, 0x28, 0xAE, 0x5D, 0xBA, 0xDA, 0xFF, 0xCE, 0x66, 0x57, 0xF7,
+    0xBA, 0x3E, 0x15, 0xDB, 0x45, 0xAF, 0xA9, 0x89, 0xB4, 0x33, 0xBD, 0x78, 0xF1, 0x53, 0x93, 0x5B,
+    0x9F, 0x6F, 0xA7, 0xC6, 0x86, 0xEA, 0x0B, 0xD1, 0x4C, 0x3F, 0xF9, 0x41, 0x68, 0x3F, 0x15, 0x8C,
+    0x16, 0xDA, 0x09, 0xA0, 0xFE, 0x2F, 0xE6, 0x4D, 0xFF, 0xFB, 0x9F, 0xFB, 0xF9, 0xEA, 0xE3, 0xFE,
+    0xB7, 0x7F, 0xE9, 0x46, 0xA1, 0x50, 0xFF, 0x5F, 0xFE, 0xDE, 0x55, 0x0A, 0xE9, 0x7E, 0x2B, 0x7D,
+    0x47, 0xDA, 0xB8, 0xD2, 0x7B, 0x4C, 0x04, 0x37, 0x50, 0x2F, 0xA0, 0xAE, 0x95, 0x82, 0xA4, 0xD7,
+    0xA4, 0x1D, 0x80, 0x67, 0x56, 0x5A, 0x0D, 0xED, 0xFD, 0xA5, 0x79, 0xED, 0xC3, 0xF6, 0xBF, 0xFE,
+    0xEA, 0x17, 0xDE, 0x7C, 0x6D, 0xDE, 0xFF, 0x55, 0x70, 0xBF, 0xB1, 0x54, 0x5A, 0xE8, 0xE7, 0x0C,
+    0x93, 0xD3, 0x77, 0xA4, 0xFF, 0x75, 0xFD, 0x2A, 0x40, 0x71, 0xB7, 0x43, 0x1B, 0x4E, 0xC1, 0x2E,
+    0xEE, 0xE3, 0xD1, 0x2C, 0x8D, 0x1F, 0x4B, 0x69, 0xB6, 0x8A, 0x8C, 0x3B, 0xC5, 0xDD, 0x0E, 0xE0,
+    0x1A, 0x60, 0x67, 0xC0, 0x75, 0x50, 0x44, 0xF8, 0xD0, 0x9D, 0xB7, 0x6F, 0x22, 0x69, 0xA8, 0xA4,
+    0xED, 0xA1, 0xC7, 0xA8, 0xE7, 0x87, 0xF7, 0xDB, 0x73, 0x63, 0xA4, 0x92, 0x16, 0x9C, 0x34, 0xA5,
+    0x7F, 0x5D, 0x5E, 0xCD, 0xF7, 0x3B, 0x66, 0x42, 0xB1, 0x54, 0x8B, 0xD1, 0x27, 0x34, 0xF1, 0x01,
+    0xDA, 0xA5, 0x30, 0x03, 0xBF, 0xCC, 0x1D, 0xDA, 0x19, 0xCB, 0xBF, 0x0F, 0xCD, 0x56, 0xAA, 0x23,
+    0x96, 0x4B, 0x35, 0x5B, 0xEF, 0x06, 0xA0, 0x5A, 0x18, 0xA9, 0x03, 0x3B, 0x76, 0x2E, 0x36, 0xEC,
+    0x54, 0x46, 0xAC, 0x37, 0x91, 0xD6, 0x9B, 0x15, 0xE7, 0xEB, 0x95, 0x7E, 0xB0, 0x0B, 0x63, 0xD7,
+    0x04, 0xD4, 0xB9, 0x50, 0x68, 0x1A, 0x67, 0x23, 0x69, 0x32, 0x92, 0x7C, 0x2D, 0xC9, 0x5B, 0x49,
+    0x43, 0xF3, 0xF5, 0x1D, 0xDA, 0x01, 0x70, 0x67, 0x43, 0xBD, 0xF3, 0xF5, 0x40, 0xAB, 0xD6, 0x97,
+    0x5A, 0x76, 0x1A, 0xBD, 0xB6, 0xA0, 0xBD, 0xF1, 0x46, 0x4B, 0x8F, 0xD5, 0xAB, 0x2B, 0xED, 0x6E,
+    0x27, 0xDC, 0xE2, 0xA0, 0xFF, 0x5A, 0xC4, 0xEC, 0xF5, 0x4C, 0xB3, 0xB8, 0x0E, 0xF9, 0x88, 0xD9,
+    0xAB, 0x40, 0xBB, 0xB4, 0x03, 0xF2, 0x1B, 0xF5, 0x6E, 0x02, 0x6E, 0x69, 0x7C, 0x29, 0x7F, 0x17,
+    0xBB, 0x9B, 0x85, 0x7E, 0xB1, 0xBE, 0xB8, 0xDE, 0x5D, 0x81, 0x7A, 0x71, 0x5F, 0x93, 0x8D, 0xFD,
+    0x5B, 0xD7, 0xBB, 0x72, 0x36, 0xBE, 0x9E, 0xED, 0xFA, 0x81, 0x57, 0xDA, 0xD5, 0x85, 0x67, 0xBB,
+    0x22, 0x58, 0xFF, 0xCF, 0xF8, 0x6D, 0xE3, 0x2D, 0x9F, 0x6B, 0xB6, 0x31, 0x94, 0xAB, 0xF9, 0xFE,
+    0xAB, 0x73, 0x08, 0xFF, 0xF8, 0x73, 0x1F, 0x6E, 0xEE, 0x7C, 0x52, 0x43, 0xDF, 0x51, 0x7B, 0x80,
+    0x7A, 0x05, 0x40, 0x1D, 0x58, 0xFF, 0x0B, 0x01, 0x4C, 0xA0, 0x05, 0x36, 0xCC, 0x0C, 0xAE, 0xE3,
+    0x05, 0xA8, 0x67, 0x6A, 0x4F, 0x19, 0x21, 0xC2, 0x08, 0xCD, 0x40, 0xE3, 0x71, 0xF2, 0xD5, 0xD2,
+    0x18, 0x45, 0xB6, 0x2A, 0xF4, 0xEA, 0xDC, 0xE7, 0x77, 0xC0, 0xCE, 0xFF, 0x7A, 0x02, 0x13, 0x3F,
+    0xFC, 0x3C, 0xA0, 0xEA, 0x1B, 0x1E, 0xDA, 0xAF, 0x85, 0x0D, 0xEA, 0xA5, 0x57, 0xA0, 0xD8, 0xAC,
+    0x76, 0xE8, 0x07, 0x1C, 0x34, 0x33, 0x55, 0xC0, 0x44, 0xB8, 0x0B, 0xB7, 0xB3, 0x47, 0x49, 0xFB,
+    0x74, 0x1C, 0xCE, 0x86, 0x55, 0xFC, 0x5E, 0xB2, 0x8C, 0x34, 0x2E, 0x3E, 0x06, 0xE5, 0x4A, 0x1E,
+    0x18, 0xAF, 0x40, 0xEB, 0x8F, 0x91, 0x15, 0x2B, 0x45, 0x2C, 0x70, 0xF2, 0x55, 0x18, 0x83, 0x93,
+    0x6F, 0x5E, 0x57, 0xEC, 0xD5, 0xB9, 0x4F, 0xDE, 0x7C, 0x01, 0xD8, 0xE1, 0xA3, 0x60, 0x56, 0x88,
+    0x1C, 0x9E, 0xDA, 0x79, 0x9A, 0x19, 0x46, 0x0A, 0x0D, 0x94, 0x1B, 0xF5, 0x0E, 0xF5, 0x42, 0xAB,
+    0x99, 0x66, 0xC6, 0x69, 0xA6, 0x1F, 0x18, 0x35, 0x71, 0x3D, 0x0D, 0xF0, 0xC6, 0x0C, 0x60, 0xE5,
+    0x81, 0xA2, 0xFB, 0x28, 0x58, 0x8F, 0x99, 0x30, 0x81, 0xE2, 0x15, 0x48, 0xAF, 0x77, 0x1D, 0x9A,
+    0xA9, 0x67, 0x68, 0x29, 0x23, 0x14, 0x81, 0x11, 0xBE, 0x3B, 0xD2, 0x78, 0x5A, 0xCD, 0x17, 0xB0,
+    0xB5, 0x3B, 0x8F, 0x85, 0xED, 0xDF, 0x78, 0x68, 0xBF, 0xF6, 0x56, 0x7C, 0x04, 0xB6, 0x2B, 0x7D,
+    0x47, 0x33, 0x63, 0x1E, 0x86, 0x0D, 0x5C, 0x80, 0x42, 0x03, 0x54, 0x11, 0x68, 0x03, 0x30, 0x76,
+    0x50, 0x5C, 0x7B, 0x34, 0x72, 0x5D, 0x05, 0x6E, 0x78, 0xA8, 0xB7, 0xFC, 0x3A, 0x34, 0xE4, 0xBF,
+    0x14, 0xA0, 0xD1, 0x40, 0xA9, 0x19, 0x9A, 0x05, 0x10, 0x50, 0x2F, 0x80, 0xF3, 0x09, 0x7E, 0xAA,
+    0x00, 0x34, 0x9E, 0xA7, 0xE9, 0x31, 0x9E, 0xBD, 0x90, 0x2F, 0xA5, 0x8D, 0x52, 0x1A, 0x52, 0xE4,
+    0x79, 0xE0, 0x93, 0x68, 0x5E, 0x9F, 0x01, 0x7D, 0xC3, 0x43, 0xF5, 0xCD, 0x0D, 0xF8, 0x58, 0x1B,
+    0x80, 0xFF, 0xD6, 0x3E, 0x34, 0xAC, 0x6A, 0xE5, 0xF0, 0xD9, 0x65, 0xF6, 0xF7, 0x00, 0x8A, 0x40,
+    0xFD, 0x4E, 0x00, 0xFA, 0x1B, 0x13, 0x98, 0xD8, 0x77, 0xD0, 0xBE, 0xBE, 0x43, 0xB1, 0x57, 0x2B,
+    0xD8, 0xD0, 0x04, 0xD0, 0xD0, 0x7B, 0xAA, 0x88, 0xC0, 0xBD, 0xFD, 0xD5, 0x88, 0x91, 0xB4, 0xD0,
+    0x48, 0x9A, 0x90, 0xA4, 0xC1, 0x4A, 0xDA, 0xE9, 0x67, 0x6C, 0x34, 0x02, 0x17, 0xDC, 0x92, 0xE3,
+    0x0A, 0x6D, 0x07, 0xD8, 0x08, 0x14, 0x3F, 0xF1, 0xC0, 0x47, 0x9E, 0xBF, 0x18, 0xC3, 0x02, 0xF0,
+    0x9B, 0x0F, 0x0D, 0xB5, 0x1F, 0x00, 0xBB, 0x9E, 0x9E, 0xD5, 0xC7, 0xC3, 0x26, 0xCA, 0x3D, 0x1E,
+    0x03, 0xB5, 0x6F, 0x6D, 0x50, 0x6E, 0xCD, 0x0C, 0xFD, 0xE7, 0xF7, 0x3C, 0x4E, 0xB3, 0x17, 0x82,
+    0xDE, 0xDB, 0x80, 0xDD, 0x6F, 0x2B, 0x0F, 0xB3, 0x97, 0xD4, 0x59, 0x49, 0xAB, 0x91, 0xA4, 0xA1,
+    0x9F, 0xB1, 0xD1, 0x46, 0xD0, 0x6B, 0xEA, 0x68, 0x22, 0xC0, 0xA5, 0xDB, 0x5F, 0x55, 0x00, 0x18,
+    0x25, 0x75, 0x40, 0x2D, 0x29, 0x02, 0xF4, 0xD2, 0xED, 0x81, 0x23, 0x60, 0x92, 0x22, 0x3F, 0x80,
+    0xD9, 0x94, 0xF6, 0x91, 0xFB, 0xFA, 0x96, 0x72, 0x96, 0xAD, 0x95, 0x06, 0xA0, 0x99, 0x47, 0x6D,
+    0x40, 0x21, 0x23, 0x05, 0xC0, 0x06, 0xAB, 0xB7, 0x07, 0x40, 0x5D, 0x3F, 0x01, 0xD8, 0xFD, 0xAB,
+    0xEA, 0xF2, 0xC7, 0x6D, 0xE4, 0x8F, 0x7B, 0xFB, 0xF6, 0x2D, 0xE8, 0x25, 0x49, 0x1E, 0x23, 0x49,
+    0x12, 0xB8, 0x80, 0x93, 0x22, 0x46, 0x5D, 0x29, 0x29, 0xD0, 0x2E, 0x58, 0x49, 0xFE, 0x3C, 0x5B,
+    0x92, 0xEE, 0x01, 0x92, 0x66, 0x70, 0x92, 0xA0, 0x91, 0x34, 0x53, 0xC7, 0x2B, 0x63, 0xC4, 0xEC,
+    0x94, 0xEA, 0x0A, 0x81, 0x9B, 0x18, 0x3D, 0xF5, 0x82, 0x9B, 0x29, 0x63, 0x23, 0x2D, 0xA8, 0x96,
+    0x22, 0xEE, 0x0B, 0xD2, 0x4E, 0x3B, 0xA1, 0x81, 0x26, 0xE0, 0x26, 0xDA, 0x48, 0x13, 0x2E, 0x8D,
+    0x1B, 0xB5, 0xA4, 0x04, 0xA5, 0xBA, 0xB4, 0xD8, 0xF4, 0x92, 0x06, 0x9C, 0xA4, 0x0E, 0x2B, 0x7D,
+    0x2F, 0x87, 0xFE, 0x0E, 0xA0, 0x5A, 0x3E, 0x07, 0x18, 0x7D, 0x04, 0x28, 0x7F, 0xA8, 0x0E, 0x58,
+    0x47, 0x0F, 0x7C, 0xC4, 0xFA, 0x87, 0x16, 0xBA, 0x18, 0x57, 0xA0, 0x92, 0x26, 0xA8, 0x95, 0xF2,
+    0x8B, 0xFF, 0xAC, 0x09, 0xBB, 0xD3, 0xAC, 0xD4, 0x3B, 0xA5, 0xA8, 0x76, 0xE8, 0x27, 0x23, 0xB0,
+    0x4B, 0xA1, 0x0E, 0xB3, 0x31, 0x7A, 0x50, 0xE7, 0x66, 0xE8, 0x7D, 0x13, 0xA0, 0x09, 0x75, 0x04,
+    0xBB, 0x96, 0x02, 0xB3, 0xA1, 0x01, 0x23, 0x5C, 0xA0, 0xD4, 0x60, 0x75, 0xF3, 0x33, 0x29, 0xAC,
+    0x28, 0x20, 0x49, 0x0B, 0xAD, 0xA4, 0x15, 0x23, 0x69, 0x05, 0x27, 0x2D, 0x50, 0x8C, 0x7A, 0x20,
+    0xC1, 0x43, 0x5F, 0x88, 0xB8, 0x37, 0x03, 0x8D, 0x06, 0xEA, 0x3D, 0xED, 0x95, 0x51, 0xBE, 0xD2,
+    0x38, 0xB7, 0xD1, 0xAD, 0x67, 0xCF, 0xFC, 0xE0, 0x70, 0x66, 0xB7, 0xE1, 0xE2, 0xF7, 0x26, 0x5E,
+    0xFC, 0xFE, 0x40, 0x8A, 0x7B, 0xBE, 0x6E, 0xEE, 0xEC, 0x05, 0x76, 0x3B, 0x7F, 0x41, 0x77, 0xF6,
+    0x82, 0xB3, 0x2D, 0xEF, 0x96, 0x27, 0xBD, 0x60, 0x38, 0x41, 0x7A, 0x5F, 0x47, 0x70, 0x2F, 0xD2,
+    0x1C, 0xD3, 0xD7, 0x78, 0x64, 0x20, 0x80, 0xDB, 0xEF, 0x9C, 0x86, 0x61, 0x77, 0x0E, 0xC3, 0xA6,
+    0xD4, 0xD0, 0x9E, 0x1E, 0xE8, 0xE7, 0x5A, 0xC7, 0x47, 0xD8, 0x58, 0x9E, 0xD2, 0x82, 0x42, 0x5D,
+    0xFF, 0x93, 0xE3, 0x81, 0x36, 0x34, 0x9B, 0xCB, 0x0F, 0x98, 0xBD, 0xD2, 0x17, 0x8E, 0xB7, 0xEA,
+    0xBD, 0xE6, 0x3E, 0xBF, 0x55, 0x1D, 0x5D, 0xB4, 0xC7, 0x40, 0xC6, 0x2F, 0x89, 0x63, 0x7A, 0x56,
+    0xF2, 0x27, 0x0C, 0xA4, 0xA5, 0x3E, 0x46, 0x68, 0xB5, 0x7F, 0xE6, 0x34, 0x6F, 0x1D, 0x3B, 0x31,
+    0xBD, 0x42, 0x27, 0x70, 0x94, 0xEC, 0x3D, 0x0D, 0xE4, 0x6C, 0xAE, 0xB5, 0x74, 0x1A, 0x79, 0xA9,
+    0x3F, 0xD3, 0xFD, 0xD3, 0x02, 0x9D, 0xC1, 0xD7, 0xEC, 0x67, 0xBE, 0x51, 0x17, 0xAB, 0x58, 0xE8,
+    0x2C, 0x37, 0xEA, 0xCF, 0x56, 0xB1, 0xD1, 0xF9, 0x0B, 0xCE, 0x12, 0x5E, 0x9D, 0xAD, 0x62, 0x7F,
+    0xEF, 0xEC, 0x05, 0x67, 0xA6, 0x51, 0x3C, 0xAE, 0xC6, 0x69, 0x01, 0x5E, 0x3C, 0xD5, 0x0A, 0x0B,
+    0x50, 0x07, 0xFE, 0x4A, 0x5F, 0xBD, 0xA7, 0x8E, 0x6E, 0xA2, 0x09, 0x6E, 0xC6, 0x4D, 0x6D, 0x40,
+    0x43, 0x1B, 0x4A, 0xD1, 0x2C, 0x75, 0xC4, 0xAE, 0xCD, 0x82, 0x8D, 0x6E, 0xA6, 0xDE, 0xE4, 0xA9,
+    0x25, 0xA8, 0xB4, 0x81, 0xD1, 0x0A, 0x46, 0x21, 0x7B, 0xD8, 0x52, 0x43, 0x36, 0xBA, 0x4A, 0x40,
+    0xAD, 0x64, 0x17, 0xD0, 0x6C, 0x40, 0x1B, 0x01, 0x3E, 0xD4, 0x25, 0x4F, 0xEE, 0x72, 0x1E, 0xD9,
+    0x6F, 0x20, 0x0D, 0x48, 0x73, 0x11, 0x6D, 0x28, 0x17, 0xB3, 0x98, 0x50, 0x2D, 0x26, 0xD8, 0x50,
+    0xCD, 0xE3, 0x54, 0x4B, 0x83, 0xD5, 0x86, 0xD5, 0x4C, 0xF3, 0xBD, 0xB3, 0x97, 0x02, 0x77, 0x2F,
+    0x76, 0xCF, 0x4B, 0x60, 0x35, 0x53, 0x49, 0x03, 0xFA, 0x78, 0xA4, 0xF5, 0xD6, 0x9B, 0xB5, 0x8E,
+    0xF4, 0x46, 0xBE, 0x0E, 0xBA, 0xC5, 0xDE, 0x78, 0x9A, 0x3F, 0x5E, 0x28, 0x63, 0xDB, 0xE1, 0x5E,
+    0xDD, 0x31, 0xAB, 0x5D, 0xE9, 0xBB, 0x7E, 0xB2, 0x4B, 0x21, 0x84, 0x0D, 0xCD, 0xF6, 0x2B, 0x7B,
+    0x29, 0xC9, 0x3B, 0x69, 0xAD, 0xA4, 0x9D, 0x51, 0x3B, 0x97, 0x52, 0x6C, 0x6E, 0xAB, 0x01, 0xF7,
+    0x83, 0x99, 0x66, 0x5C, 0xB0, 0x5F, 0x5C, 0x29, 0x6E, 0x7E, 0xF6, 0x02, 0xBE, 0x7A, 0x81, 0x56,
+    0x3B, 0xAD, 0xD4, 0xD9, 0xB9, 0x9F, 0xEC, 0x5C, 0x87, 0x2A, 0x94, 0xB1, 0x5C, 0x18, 0x89, 0xB4,
+    0xC3, 0x0B, 0xD8, 0xB9, 0xC5, 0x2C, 0xD6, 0x9B, 0x68, 0xF6, 0x3B, 0x42, 0x92, 0x6F, 0xA5, 0x60,
+    0xA4, 0x95, 0xF6, 0xB4, 0xBB, 0xCA, 0x25, 0x85, 0xB8, 0xE6, 0xF9, 0x84, 0x57, 0xB3, 0xC0, 0xE5,
+    0xE1, 0x81, 0xA5, 0xBA, 0xBC, 0xA5, 0xCF, 0x1A, 0xB5, 0xB1, 0x57, 0x9B, 0x59, 0xCB, 0x58, 0x85,
+    0x32, 0xD6, 0x53, 0x19, 0xAD, 0x2F, 0xD7, 0xA6, 0x33, 0x6B, 0x8B, 0x59, 0x1C, 0x36, 0xB8, 0x37,
+    0x14, 0x9C, 0x14, 0x5A, 0x29, 0x58, 0x69, 0x2E, 0xCF, 0xEC, 0xF3, 0xC6, 0x54, 0x8C, 0x03, 0xAD,
+    0x24, 0x51, 0x4B, 0xFA, 0x7E, 0x64, 0xAF, 0x14, 0x6A, 0xEF, 0x86, 0x36, 0x5E, 0xFA, 0xA3, 0x2A,
+    0x94, 0x92, 0xA6, 0x3F, 0xA2, 0x95, 0x36, 0xEB, 0x4B, 0x49, 0xAF, 0x2F, 0xB8, 0xB7, 0x5F, 0xEE,
+    0x5A, 0x4C, 0x04, 0x13, 0x90, 0xE7, 0x69, 0xF7, 0x86, 0x74, 0xB3, 0x49, 0x31, 0x26, 0xB4, 0x29,
+    0xD2, 0x48, 0x4A, 0x9F, 0x55, 0x9D, 0x7B, 0xC3, 0x17, 0x2F, 0x3C, 0x58, 0xBB, 0x71, 0xD8, 0xA9,
+    0x93, 0x02, 0x48, 0xEA, 0xA8, 0xA4, 0x08, 0x4F, 0xDB, 0x09, 0xFA, 0xE8, 0xA0, 0xD6, 0xBE, 0x82,
+    0x24, 0x4F, 0xBD, 0xD5, 0x02, 0xE7, 0xED, 0x42, 0xB9, 0xE1, 0x3C, 0x36, 0x14, 0x1B, 0x38, 0xDF,
+    0x04, 0xD0, 0xF7, 0x05, 0x46, 0x5A, 0xA1, 0x96, 0x06, 0xA8, 0xB5, 0x02, 0x55, 0xDE, 0x97, 0x97,
+    0x80, 0x6A, 0xFD, 0x5C, 0x4A, 0x6D, 0x1A, 0xB7, 0x60, 0xDE, 0x12, 0xFC, 0xC2, 0xE5, 0xEE, 0x3C,
+    0x7C, 0xDC, 0x4C, 0x36, 0xD8, 0x6B, 0xC3, 0xAE, 0x4D, 0x30, 0x1B, 0x23, 0x6E, 0xA8, 0x43, 0x1D,
+    0x18, 0xD9, 0xB1, 0xC1, 0xCE, 0xC5, 0x5E, 0x6C, 0x38, 0xDF, 0x84, 0x26, 0x16, 0x39, 0x0F, 0x98,
+    0x49, 0xF1, 0x74, 0x87, 0xE4, 0x71, 0x2E, 0x75, 0x39, 0x15, 0xAB, 0xE2, 0x29, 0x67, 0xF3, 0xC7,
+    0x83, 0x00, 0x5C, 0xB9, 0x56, 0x1E, 0x48, 0xFD, 0xF1, 0x85, 0x0B, 0xBA, 0x74, 0x35, 0x67, 0x6E,
+    0xA5, 0x8E, 0x8C, 0xA5, 0x9F, 0x1F, 0x72, 0xDF, 0x00, 0xFC, 0xFD, 0x34, 0xDE, 0x64, 0x2E, 0x55,
+    0xDA, 0xE3, 0x36, 0xF9, 0x99, 0x26, 0x79, 0x12, 0x97, 0x5E, 0x32, 0xA6, 0xE7, 0xE7, 0x7C, 0x22,
+    0x79, 0x9F, 0x6A, 0x79, 0xDC, 0xF3, 0x87, 0xB3, 0xE7, 0xDF, 0xD8, 0xD3, 0x22, 0xED, 0xD9, 0x45,
+    0x76, 0x80, 0x7B, 0x53, 0x03, 0xA0, 0xDF, 0x90, 0x07, 0x76, 0xF7, 0xA6, 0x87, 0x32, 0xF6, 0x37,
+    0x3C, 0x98, 0x55, 0xCE, 0x83, 0xB9, 0xBF, 0xF5, 0x03, 0x54, 0xEF, 0x44, 0x01, 0x95, 0xDE, 0x49,
+    0x3F, 0xB4, 0x71, 0xAC, 0x0B, 0x65, 0x4A, 0x5F, 0x48, 0x69, 0x4D, 0x91, 0x3C, 0xAC, 0x89, 0x67,
+    0x09, 0x25, 0x36, 0xCD, 0xA6, 0x4D, 0xA3, 0x73, 0xB9, 0xC0, 0x48, 0xB3, 0x51, 0xCE, 0x93, 0xD2,
+    0xF3, 0xE3, 0xF9, 0x34, 0xDA, 0xF4, 0x8C, 0x5F, 0x4E, 0xF3, 0x3D, 0xC3, 0xEB, 0x63, 0x1C, 0xE5,
+    0x5E, 0xDB, 0x1D, 0x4E, 0xF4, 0x91, 0xC4, 0xE1, 0x7D, 0x7E, 0x09, 0x13, 0x71, 0xBE, 0x8C, 0xD8,
+    0x85, 0x9D, 0x72, 0x67, 0x84, 0xDE, 0xF7, 0x1D, 0x76, 0x71, 0x1E, 0xB3, 0x37, 0x13, 0x8C, 0xDF,
+    0x9C, 0xA1, 0x51, 0xC8, 0x5E, 0x31, 0x45, 0xC3, 0x76, 0x23, 0x3B, 0xC3, 0x34, 0x89, 0x71, 0xC8,
+    0x2C, 0xC7, 0x07, 0x35, 0x81, 0xD3, 0x0C, 0x36, 0xB1, 0x28, 0x73, 0x76, 0x9F, 0x69, 0x63, 0x14,
+    0x31, 0x2F, 0x8A, 0x1B, 0xC0, 0xDE, 0x83, 0x4A, 0x13, 0xA5, 0x76, 0x90, 0x26, 0xDC, 0xA7, 0x22,
+    0x8D, 0xEF, 0xA9, 0x83, 0x9D, 0xCC, 0x6A, 0x42, 0xB1, 0x95, 0x91, 0x91, 0x0D, 0xE7, 0x85, 0xFD,
+    0x96, 0xA8, 0xDE, 0x51, 0x57, 0x4A, 0x1D, 0xDA, 0xC1, 0xDD, 0x4F, 0x44, 0x51, 0x1D, 0x32, 0xE6,
+    0x3B, 0xD0, 0x77, 0xA9, 0x22, 0x03, 0xCC, 0xDA, 0xCC, 0x30, 0x7E, 0x61, 0x03, 0xBB, 0xF4, 0x13,
+    0xA5, 0x7E, 0x35, 0x82, 0x0B, 0xF2, 0x14, 0xD7, 0x2F, 0x5D, 0x7B, 0x6F, 0x78, 0x9C, 0x4F, 0x08,
+    0xB5, 0x1E, 0x37, 0x99, 0x35, 0xE3, 0xD3, 0x84, 0x66, 0x02, 0x7D, 0x32, 0x82, 0x5D, 0xFB, 0x2E,
+    0x03, 0x74, 0xD0, 0x45, 0x43, 0x8E, 0x1B, 0x09, 0xA1, 0x94, 0xE1, 0xDB, 0x00, 0x94, 0xFB, 0x41,
+    0x04, 0x5D, 0x1A, 0x97, 0xC3, 0x18, 0x9D, 0x7C, 0xC6, 0x88, 0xF1, 0x08, 0xAB, 0x97, 0x6E, 0xAB,
+    0x03, 0x7B, 0x24, 0x7D, 0x2B, 0x5C, 0xBE, 0xFD, 0xF2, 0xBB, 0x8E, 0x36, 0x59, 0x9A, 0xD9, 0x39,
+    0x55, 0x04, 0x39, 0xE6, 0xA6, 0xB4, 0x60, 0x1C, 0x39, 0x8A, 0x02, 0xDC, 0xD7, 0x17, 0x72, 0xF9,
+    0x42, 0x33, 0xF7, 0xC3, 0x51, 0xBF, 0xD8, 0xB5, 0x8A, 0xE4, 0x02, 0xC6, 0xE8, 0xF6, 0xE8, 0x73,
+    0x69, 0x50, 0xA4, 0x54, 0x21, 0x65, 0xB5, 0x29, 0x9F, 0xE8, 0x67, 0x6C, 0xC4, 0x05, 0x8C, 0x38,
+    0x15, 0x31, 0x97, 0xFE, 0xE9, 0x4B, 0x69, 0xC8, 0xA3, 0x34, 0x54, 0x7A, 0xE3, 0x2B, 0x4F, 0x1C,
+    0xEC, 0x33, 0x0B, 0x94, 0xD2, 0x4C, 0x2B, 0x75, 0xEC, 0xD5, 0x86, 0x9D, 0xEB, 0x40, 0x4F, 0xEB,
+    0xCB, 0x85, 0x11, 0xEB, 0xCB, 0x95, 0x17, 0xB0, 0x73, 0x19, 0x70, 0x9D, 0xF5, 0x26, 0xE2, 0xDE,
+    0x48, 0xC9, 0xA9, 0x2F, 0x73, 0xA2, 0xBD, 0x72, 0xEE, 0xF1, 0x81, 0x58, 0xA4, 0x12, 0x28, 0x6D,
+    0x69, 0x05, 0xA0, 0x4A, 0x9B, 0xF1, 0xF2, 0x4B, 0x4F, 0x4C, 0x0D, 0x06, 0x0E, 0xA7, 0x94, 0x51,
+    0xCB, 0xE9, 0x4C, 0xAA, 0xAE, 0x53, 0x29, 0x95, 0x61, 0xB3, 0x6F, 0x6D, 0x1C, 0xD5, 0x54, 0x2A,
+    0xA7, 0x32, 0x6E, 0xA9, 0xA0, 0x4A, 0x15, 0x55, 0x2A, 0xA9, 0x32, 0x70, 0xA9, 0xA8, 0xC2, 0x9E,
+    0x92, 0x69, 0x0D, 0x19, 0x39, 0x1B, 0x41, 0xDE, 0x1C, 0x95, 0xD5, 0x4A, 0xA4, 0xD0, 0x9D, 0x98,
+    0xC7, 0x3D, 0xCA, 0xC3, 0x33, 0xDB, 0xE3, 0x87, 0x7C, 0x79, 0x23, 0xC5, 0x48, 0x46, 0x6D, 0xB0,
+    0x57, 0x1B, 0x66, 0x2D, 0x23, 0x55, 0x28, 0x23, 0x75, 0xE2, 0x91, 0xCA, 0x95, 0xA6, 0x33, 0x2B,
+    0x2D, 0x66, 0xC1, 0x61, 0x43, 0x82, 0xCF, 0x49, 0x81, 0x56, 0x0A, 0x58, 0x69, 0x3E, 0xE1, 0x97,
+    0x4C, 0x47, 0xC3, 0x91, 0xC6, 0xA4, 0xC4, 0x2D, 0x6D, 0xF1, 0x37, 0x3D, 0x54, 0x3F, 0xDE, 0x00,
+    0x35, 0x53, 0x36, 0x9A, 0x6A, 0x6D, 0x66, 0x50, 0x21, 0x70, 0x73, 0x13, 0xB2, 0xC5, 0xE8, 0x8D,
+    0x3B, 0x21, 0x55, 0x3B, 0x95, 0xA4, 0x25, 0x99, 0x8B, 0x93, 0xB4, 0x56, 0x3B, 0xC8, 0xCB, 0x63,
+    0xE3, 0xC9, 0x56, 0x9A, 0xF9, 0xE4, 0xB4, 0xEF, 0x5E, 0x05, 0xAC, 0xBA, 0x53, 0x71, 0x30, 0xFE,
+    0x8D, 0x24, 0x04, 0xA1, 0xD4, 0x97, 0x02, 0xB8, 0x29, 0xBD, 0x61, 0xCC, 0x1B, 0x42, 0x73, 0x8A,
+    0x3F, 0x67, 0xEE, 0xB4, 0x9A, 0x8E, 0xF4, 0x32, 0xF9, 0xD4, 0x7A, 0x26, 0x3B, 0xA9, 0x47, 0xC1,
+    0xD7, 0x7D, 0xA8, 0xA5, 0x19, 0x23, 0x45, 0x0A, 0x49, 0x9E, 0x5E, 0xEF, 0x2C, 0x69, 0x02, 0x46,
+    0x1E, 0x18, 0xC3, 0x51, 0xCB, 0x27, 0x84, 0x5D, 0x38, 0xF9, 0xC9, 0x71, 0x06, 0x6C, 0x72, 0x99,
+    0x01, 0xB0, 0xFA, 0xEE, 0x67, 0x26, 0x24, 0xA5, 0x0A, 0xD2, 0xD3, 0xA7, 0xA8, 0x2B, 0x0D, 0x58,
+    0x69, 0x25, 0xED, 0x10, 0x28, 0x96, 0x44, 0x9B, 0xC7, 0x34, 0xBC, 0x3E, 0xEF, 0xA3, 0x8D, 0x4A,
+    0x91, 0x5E, 0xB3, 0xD9, 0x3F, 0xDE, 0x39, 0x4F, 0xB1, 0x25, 0x57, 0xE8, 0x86, 0xF4, 0xEB, 0x02,
+    0xED, 0xFC, 0x34, 0xFD, 0xF7, 0x67, 0xA4, 0xA9, 0x90, 0x3C, 0xE3, 0x0A, 0xD0, 0x74, 0x70, 0x38,
+    0xC9, 0x94, 0xF1, 0x6B, 0x07, 0x4C, 0xEC, 0x3D, 0xD4, 0xA1, 0x7A, 0xB7, 0x14, 0xFB, 0x86, 0x6E,
+    0x66, 0x10, 0x70, 0x92, 0xCF, 0x28, 0x54, 0xD2, 0xD8, 0xE5, 0x75, 0x74, 0xC9, 0xE7, 0x84, 0x53,
+    0x2D, 0x97, 0x80, 0x48, 0x19, 0x52, 0x42, 0xA2, 0xCE, 0x71, 0xF8, 0xFC, 0xFB, 0x77, 0x3F, 0x33,
+    0x61, 0x25, 0x4D, 0x19, 0x8C, 0xEA, 0x54, 0xE4, 0x0F, 0x90, 0xBE, 0xB7, 0x17, 0x95, 0x4D, 0x3D,
+    0x65, 0x7A, 0xAE, 0xDD, 0xF2, 0x4E, 0xDF, 0xEB, 0x80, 0x1B, 0x9A, 0xB3, 0x5A, 0xF0, 0x99, 0x2D,
+    0x85, 0xAD, 0x4A, 0x3B, 0xE8, 0xE6, 0x55, 0x9C, 0xCF, 0x66, 0x37, 0xE6, 0x30, 0x5B, 0x6C, 0x40,
+    0x3B, 0x41, 0xB9, 0x17, 0xD0, 0xBC, 0xBD, 0xA6, 0x28, 0x54, 0x49, 0x50, 0xE7, 0x0D, 0x72, 0x05,
+    0xC0, 0x2E, 0xA7, 0x40, 0xD7, 0x86, 0xD3, 0x64, 0xC6, 0xF0, 0xB3, 0x64, 0x25, 0x65, 0x4C, 0x51,
+    0xB0, 0x8E, 0x39, 0xD3, 0x5E, 0xE1, 0xCA, 0xB5, 0x53, 0x3F, 0xA6, 0x51, 0xA0, 0xD7, 0x8C, 0x6E,
+    0x5E, 0x35, 0x31, 0xE1, 0x50, 0x87, 0x04, 0x43, 0x33, 0x25, 0x14, 0xDA, 0xF9, 0x69, 0x9A, 0xB7,
+    0x57, 0xAC, 0xB6, 0x84, 0x41, 0x32, 0x97, 0xAB, 0x5C, 0x01, 0x7A, 0xFA, 0x0E, 0xEA, 0x45, 0x27,
+    0x7B, 0xC9, 0x05, 0x76, 0x91, 0x7C, 0xD5, 0x47, 0xDF, 0x35, 0x92, 0x16, 0xE3, 0xDE, 0x1D, 0x76,
+    0x63, 0x95, 0x68, 0x3E, 0x45, 0x68, 0xB4, 0x6F, 0x87, 0x03, 0x48, 0x93, 0xAE, 0x75, 0x91, 0x4F,
+    0x67, 0x27, 0x95, 0x7D, 0x73, 0x00, 0x72, 0x45, 0x61, 0xF3, 0x93, 0x7C, 0x1A, 0xCC, 0xF5, 0x3F,
+    0x22, 0x73, 0x2D, 0x09, 0xA2, 0x42, 0x52, 0x00, 0xA7, 0x54, 0xC5, 0x69, 0xE7, 0x84, 0xD2, 0x53,
+    0x37, 0x8B, 0x97, 0xA8, 0x16, 0x3B, 0x53, 0xEE, 0x63, 0x97, 0x3D, 0x9D, 0x0B, 0xC7, 0x7E, 0x78,
+    0x8A, 0x47, 0xFA, 0x58, 0x8D, 0x02, 0xF4, 0x9A, 0x93, 0x0D, 0x99, 0x78, 0xF8, 0xAE, 0x3A, 0x1C,
+    0xC9, 0x5A, 0x33, 0x65, 0x33, 0xA2, 0x9D, 0x9F, 0xCE, 0x76, 0x64, 0xB5, 0x91, 0x40, 0xCC, 0x28,
+    0x96, 0xB7, 0xF8, 0x0A, 0x14, 0x5B, 0x32, 0xC0, 0xD1, 0x03, 0x6E, 0xBF, 0x08, 0x40, 0xA9, 0xE1,
+    0x50, 0x76, 0x8F, 0x03, 0xAF, 0x96, 0x6E, 0x82, 0xCD, 0xFC, 0x8F, 0x34, 0x64, 0xEE, 0xAA, 0x0D,
+    0xBF, 0xA6, 0x80, 0x9B, 0x69, 0x03, 0x6E, 0xC2, 0x2E, 0xF4, 0x9E, 0x7A, 0xC9, 0x04, 0x96, 0x3A,
+    0xEA, 0x50, 0x08, 0x6C, 0x28, 0x05, 0xED, 0x6C, 0x76, 0xE8, 0xBD, 0xD9, 0x28, 0xE4, 0xAB, 0xAD,
+    0xB8, 0xA1, 0x2E, 0x11, 0x57, 0x56, 0xD2, 0x96, 0x03, 0x55, 0x7E, 0x63, 0x49, 0x1D, 0x4E, 0x7A,
+    0x89, 0xB3, 0x34, 0xD5, 0x7D, 0xC9, 0x03, 0xCD, 0x37, 0x02, 0x60, 0x7F, 0xB8, 0x02, 0xE6, 0xFE,
+    0x06, 0x94, 0x71, 0x84, 0x66, 0x91, 0x1B, 0x70, 0xD2, 0x7F, 0x1C, 0x92, 0x63, 0xC0, 0x7D, 0x5F,
+    0x01, 0xDC, 0xE4, 0x56, 0x68, 0xA6, 0x3A, 0x42, 0x3D, 0x97, 0x02, 0xB3, 0xA0, 0x81, 0x22, 0xE2,
+    0x3C, 0xF4, 0xB4, 0x01, 0x5A, 0xDF, 0x44, 0xA8, 0xD2, 0x42, 0xA5, 0xE2, 0x21, 0xBD, 0x47, 0x95,
+    0x42, 0x79, 0x7B, 0xEF, 0x67, 0x88, 0xC4, 0xCB, 0x68, 0xA4, 0xFC, 0x57, 0x11, 0x6A, 0x29, 0x92,
+    0xF7, 0xE2, 0xA5, 0xCF, 0xDC, 0xBF, 0x4A, 0xA1, 0x4F, 0x07, 0x52, 0x98, 0xCD, 0xF3, 0xD0, 0x1D,
+    0x79, 0xCC, 0x66, 0x34, 0x50, 0x2D, 0xA5, 0x0E, 0x28, 0xEC, 0x64, 0x76, 0x68, 0xBC, 0x89, 0xD0,
+    0xF8, 0x3A, 0x1E, 0x48, 0x34, 0xD2, 0x0A, 0x56, 0x5A, 0x8E, 0xDD, 0x92, 0x81, 0x18, 0x53, 0xDD,
+    0x59, 0xFC, 0xDA, 0x57, 0x67, 0x68, 0xD3, 0x5B, 0x4B, 0x50, 0xBF, 0xF1, 0x95, 0xF7, 0x48, 0x67,
+    0x9F, 0xBA, 0x3D, 0x2A, 0xB3, 0x79, 0x45, 0xF6, 0x1D, 0x6F, 0x7F, 0x39, 0x97, 0x23, 0x85, 0x2E,
+    0x5A, 0x31, 0x6E, 0x02, 0x0A, 0x7D, 0x35, 0x15, 0x9D, 0x13, 0xA9, 0x33, 0x48, 0xAA, 0x42, 0xE3,
+    0x89, 0x21, 0x4F, 0x0C, 0x55, 0xB5, 0xDF, 0xBE, 0x4D, 0x22, 0x5F, 0x91, 0x52, 0xBF, 0x57, 0x9E,
+    0x56, 0x12, 0x9C, 0x91, 0x52, 0xF0, 0x5B, 0xDA, 0x28, 0xA4, 0x2D, 0xED, 0xC6, 0x4B, 0xA9, 0x71,
+    0xF7, 0x9E, 0x5F, 0xC5, 0x38, 0xE4, 0x32, 0xC2, 0xBD, 0x13, 0x41, 0xBC, 0x40, 0x19, 0x2F, 0xDD,
+    0x4D, 0x6F, 0x52, 0x4B, 0x7B, 0xDA, 0x14, 0xCD, 0xFE, 0xF2, 0xD5, 0xB4, 0x7D, 0xD3, 0x26, 0xBC,
+    0x5F, 0x2C, 0xA9, 0x9F, 0x7C, 0x34, 0x63, 0x67, 0xB8, 0x71, 0x1F, 0xA0, 0x0C, 0xE5, 0x02, 0x76,
+    0x97, 0xCF, 0x69, 0x54, 0xAA, 0x54, 0xCE, 0x78, 0x8A, 0x9F, 0x35, 0xE0, 0xAC, 0x6F, 0x7C, 0x6A,
+    0xA3, 0x93, 0xDD, 0xE6, 0x0C, 0x3C, 0xD7, 0xBD, 0x3F, 0xEC, 0x8C, 0x22, 0x18, 0x8D, 0x1E, 0x13,
+    0x8B, 0x25, 0x81, 0x97, 0x82, 0xE9, 0x28, 0xCD, 0xC9, 0x41, 0x36, 0xFB, 0xCB, 0x57, 0x93, 0x33,
+    0x2B, 0x53, 0xAB, 0xFA, 0x5E, 0x35, 0x25, 0xF8, 0x8C, 0x14, 0xC1, 0x69, 0x87, 0x62, 0xCC, 0xBC,
+    0xDD, 0xF5, 0x53, 0x2D, 0x9B, 0xAA, 0xD6, 0x7E, 0x3A, 0xF5, 0x2E, 0xF4, 0xA4, 0x22, 0xB4, 0xBC,
+    0x7D, 0x47, 0x3E, 0x41, 0x98, 0xF6, 0xB8, 0x74, 0x7B, 0x48, 0x45, 0x51, 0x42, 0xF0, 0xFC, 0xFD,
+    0xDE, 0xD8, 0x0F, 0x00, 0x8F, 0x6D, 0x35, 0x24, 0xF6, 0x20, 0xE1, 0x77, 0x3C, 0xEB, 0xF6, 0x2D,
+    0xEC, 0x81, 0x56, 0xA0, 0x91, 0x44, 0x22, 0xFF, 0x93, 0x5F, 0xC8, 0x95, 0x76, 0x15, 0x73, 0xC9,
+    0x65, 0xD7, 0x1C, 0x4D, 0xAE, 0x5C, 0x7D, 0x4F, 0xD0, 0xA4, 0x64, 0x6F, 0x36, 0x54, 0x53, 0x19,
+    0x2F, 0xDD, 0xC5, 0x49, 0x73, 0x2D, 0xED, 0x48, 0x9A, 0x9B, 0xFD, 0xE5, 0xAB, 0x65, 0x3C, 0xF2,
+    0x06, 0xDD, 0x6C, 0xBA, 0x26, 0x53, 0xE7, 0xC9, 0xD2, 0x2E, 0xEB, 0xE6, 0xFF, 0x97, 0x19, 0x9B,
+    0x95, 0x5C, 0x01, 0x27, 0x4A, 0x20, 0xF7, 0x8F, 0xE2, 0x19, 0x97, 0x70, 0xCC, 0xD0, 0x28, 0x62,
+    0x34, 0x7A, 0x13, 0x8B, 0xA5, 0x8C, 0x97, 0xEE, 0x22, 0x69, 0x18, 0x93, 0x42, 0x62, 0x6D, 0xF6,
+    0x97, 0xAF, 0xD6, 0x21, 0x1B, 0xC3, 0x78, 0xAF, 0x9A, 0x9A, 0x44, 0xE6, 0x45, 0x9C, 0xF6, 0x0B,
+    0x3B, 0x28, 0x87, 0x14, 0x06, 0xAB, 0x25, 0x89, 0x38, 0x0A, 0xF9, 0x14, 0x47, 0xCB, 0x87, 0x73,
+    0xE7, 0x2A, 0x94, 0xEB, 0xA9, 0x74, 0xD2, 0x59, 0x8A, 0xD8, 0x04, 0xDE, 0x17, 0x75, 0x91, 0xC0,
+    0x34, 0x07, 0x97, 0xB6, 0x93, 0xB7, 0x60, 0x22, 0x56, 0xD2, 0xBB, 0x24, 0x76, 0x25, 0x11, 0xED,
+    0xFD, 0x1B, 0x3B, 0xB9, 0x40, 0x4A, 0x88, 0xA6, 0x4D, 0x98, 0x20, 0x4D, 0x45, 0x72, 0xC2, 0x34,
+    0xED, 0xC2, 0x04, 0xAA, 0x3D, 0x85, 0x13, 0xF2, 0x36, 0x3C, 0x0C, 0xE9, 0x1A, 0x97, 0x3A, 0x5A,
+    0xDF, 0x7A, 0xCC, 0xD6, 0x0F, 0xE0, 0x4E, 0x34, 0x70, 0x2A, 0x56, 0x9A, 0xF7, 0x4B, 0xB6, 0x3C,
+    0xB3, 0x1E, 0x05, 0xBF, 0x7B, 0x27, 0x82, 0xF3, 0x4D, 0x47, 0xEB, 0x3F, 0x33, 0xA7, 0xD0, 0x51,
+    0x4B, 0x7B, 0x4A, 0xEB, 0x0A, 0xBD, 0x71, 0x3D, 0xBF, 0x77, 0x3B, 0x01, 0xF5, 0xDE, 0xBD, 0x40,
+    0x71, 0x8C, 0xC9, 0x67, 0x87, 0xF6, 0xCC, 0x9E, 0x17, 0xF5, 0x9C, 0x35, 0xCA, 0x6D, 0x8E, 0x51,
+    0x00, 0xCD, 0xB7, 0x37, 0xC0, 0x2C, 0xE5, 0xFA, 0xBE, 0xF9, 0xA0, 0x62, 0xD4, 0x4B, 0x50, 0x4A,
+    0x1A, 0x8E, 0xE6, 0x48, 0x2A, 0x63, 0x1B, 0xFD, 0x69, 0xF1, 0x59, 0x4C, 0x6A, 0x39, 0xA4, 0xBC,
+    0xD7, 0xC6, 0xB3, 0x14, 0x2D, 0x35, 0x29, 0x8C, 0x78, 0xEA, 0x2A, 0xF4, 0x73, 0x21, 0x75, 0xF5,
+    0x96, 0xE4, 0x42, 0xBE, 0x90, 0x06, 0xBB, 0x41, 0xBF, 0xA0, 0x99, 0x7A, 0xC1, 0xEA, 0x4F, 0x3F,
+    0xA8, 0xD4, 0x48, 0x4C, 0x5A, 0x99, 0x8C, 0xF9, 0x0C, 0x7D, 0xA2, 0xD5, 0x6E, 0x3C, 0xD0, 0x6E,
+    0x5A, 0x2F, 0xBC, 0x6C, 0xBF, 0x92, 0xBD, 0x1A, 0xEE, 0xD5, 0x0D, 0xCA, 0xF5, 0x8C, 0x2C, 0x7F,
+    0x24, 0x6F, 0x5A, 0x5D, 0x47, 0xA1, 0x3D, 0x45, 0xD4, 0x00, 0x7B, 0xAD, 0x01, 0x3B, 0xD9, 0x0D,
+    0x5E, 0xC4, 0x05, 0xCA, 0x80, 0x06, 0xEC, 0x60, 0x36, 0x78, 0x81, 0x26, 0x50, 0x2C, 0xC8, 0x53,
+    0xCF, 0xCD, 0x4E, 0xAA, 0x95, 0xE9, 0x73, 0x90, 0xDD, 0xA1, 0x90, 0x2E, 0x72, 0xB7, 0xB4, 0xD3,
+    0x6C, 0x80, 0x5F, 0x2C, 0xD4, 0x65, 0x43, 0xAB, 0x53, 0xE2, 0xA3, 0x08, 0xDC, 0x78, 0x88, 0xE3,
+    0x6C, 0x86, 0xD6, 0x9F, 0xCC, 0xB2, 0x48, 0x7D, 0x99, 0x32, 0x77, 0x9C, 0x6E, 0x77, 0xEF, 0x6B,
+    0x75, 0x6E, 0xE8, 0x7B, 0x29, 0x91, 0x5D, 0xA1, 0x3A, 0xE1, 0xA5, 0x8E, 0x4A, 0x3F, 0xE2, 0xD7,
+    0xC1, 0x6D, 0x67, 0x54, 0x46, 0x5A, 0x9E, 0xCC, 0x2A, 0xE5, 0x06, 0x9B, 0x8D, 0xFC, 0x62, 0x77,
+    0xAC, 0x4F, 0xA9, 0xAE, 0xD2, 0x8E, 0x8D, 0x34, 0x5A, 0x13, 0x91, 0x33, 0xE5, 0x05, 0x32, 0xFA,
+    0xD1, 0xA5, 0xD1, 0xE7, 0x94, 0x08, 0x9B, 0x02, 0x52, 0x5E, 0xA1, 0x26, 0x65, 0x69, 0x97, 0x73,
+    0xD3, 0xE8, 0x3C, 0xA2, 0xBA, 0xF7, 0x17, 0x51, 0x19, 0xBF, 0xB0, 0x40, 0xA3, 0x37, 0x7D, 0xB6,
+    0x6A, 0x3B, 0x8F, 0x2B, 0x6C, 0x68, 0xA2, 0x9A, 0x8D, 0xA0, 0xC5, 0xAE, 0xB0, 0xE2, 0x26, 0xAA,
+    0xA9, 0x10, 0x34, 0x9D, 0x8D, 0x70, 0xB7, 0xD0, 0x4C, 0xA9, 0xD4, 0xA4, 0xC9, 0xAE, 0x32, 0x8D,
+    0xA8, 0x83, 0xFA, 0x9D, 0x78, 0xB1, 0x0F, 0x04, 0xE5, 0xCD, 0x26, 0x65, 0x4F, 0x1E, 0xC6, 0x14,
+    0x06, 0xE5, 0xE1, 0xB2, 0x8E, 0x16, 0x57, 0x62, 0x69, 0x9B, 0xF9, 0xC4, 0x7F, 0x24, 0xA5, 0x56,
+    0xEA, 0x20, 0x5E, 0xEF, 0xDE, 0xCF, 0x5A, 0xB4, 0xD2, 0x9A, 0x57, 0xA2, 0x4F, 0xE4, 0xC7, 0x8F,
+    0xF8, 0xF5, 0xB4, 0x0C, 0x69, 0x15, 0xD2, 0x22, 0x8C, 0xF3, 0x69, 0x09, 0xD2, 0x0A, 0xF4, 0x73,
+    0x21, 0x7D, 0x42, 0x5D, 0xA5, 0x3D, 0xC1, 0x9F, 0xD0, 0xD7, 0x4C, 0xBD, 0x24, 0xEC, 0x2F, 0x32,
+    0xF3, 0x98, 0x81, 0x4F, 0xB8, 0x1F, 0xB0, 0x73, 0xED, 0x88, 0xD7, 0x66, 0x23, 0x27, 0x18, 0x36,
+    0x3E, 0xD4, 0x56, 0x7D, 0xA0, 0x95, 0x36, 0x6F, 0x69, 0x2B, 0x54, 0x52, 0x4C, 0x88, 0xBB, 0xCE,
+    0x2D, 0x69, 0x1F, 0xBC, 0x82, 0x9B, 0x59, 0x71, 0x53, 0xB1, 0xD0, 0xFB, 0x62, 0x41, 0xBE, 0x5C,
+    0x2B, 0x0D, 0xA5, 0xA4, 0xBC, 0x46, 0xD2, 0x0E, 0xBD, 0xB6, 0x03, 0x68, 0xB3, 0x26, 0xF3, 0x7F,
+    0xAA, 0xEB, 0xA7, 0x84, 0x72, 0x9B, 0x1C, 0x54, 0x84, 0x67, 0xCE, 0x3B, 0xB2, 0x47, 0x57, 0x24,
+    0xF9, 0xFC, 0xE4, 0x27, 0x92, 0x8C, 0xEB, 0x11, 0x72, 0x20, 0xD5, 0x93, 0xEF, 0x87, 0x98, 0x3D,
+    0x73, 0x56, 0xAD, 0xB4, 0x66, 0x5F, 0x55, 0x65, 0xCD, 0xC5, 0x9F, 0x16, 0x9F, 0xCD, 0x7B, 0xE1,
+    0x09, 0x2C, 0x44, 0xF2, 0x53, 0xD5, 0x4E, 0xA3, 0x25, 0xB9, 0xA9, 0xB4, 0x0C, 0xC9, 0x4B, 0xD9,
+    0x1D, 0xC6, 0x2E, 0x39, 0xA9, 0xB3, 0xAA, 0x80, 0x52, 0x19, 0x04, 0xAD, 0x17, 0x0B, 0x71, 0xE9,
+    0xFA, 0xD1, 0x1E, 0x4D, 0x2B, 0xAE, 0xE9, 0x98, 0xA5, 0x5B, 0x48, 0x45, 0x78, 0x5A, 0x98, 0xB3,
+    0x5E, 0xC9, 0x69, 0x13, 0x14, 0xDA, 0x63, 0xC6, 0x77, 0xAF, 0x35, 0xA4, 0x2D, 0xF0, 0x22, 0x2E,
+    0xA4, 0x1D, 0x60, 0x07, 0xB3, 0xA5, 0x0D, 0x90, 0xFC, 0xD2, 0xDD, 0x22, 0xD5, 0x66, 0x21, 0x9B,
+    0xBF, 0xB4, 0x1F, 0xD6, 0x9F, 0x9C, 0x92, 0x9D, 0xD3, 0xA2, 0x24, 0xDB, 0x97, 0x62, 0x36, 0x7D,
+    0xA7, 0x78, 0x6E, 0xF9, 0x17, 0x0C, 0x4A, 0x8E, 0xA1, 0x69, 0x85, 0x7A, 0x0D, 0xC0, 0x6E, 0x03,
+    0x98, 0xA5, 0x78, 0x1C, 0x03, 0x69, 0x36, 0xCA, 0x9D, 0x2A, 0x62, 0x36, 0xEA, 0x88, 0xD9, 0xB0,
+    0x2B, 0x55, 0xC4, 0x2E, 0xD4, 0x91, 0x26, 0x60, 0x57, 0x5C, 0xA0, 0x59, 0x72, 0x51, 0xDA, 0x4F,
+    0xB8, 0xC0, 0x38, 0xE1, 0x66, 0xE4, 0x19, 0xA7, 0x42, 0xFF, 0xE3, 0x7A, 0x62, 0x71, 0xE5, 0x13,
+    0x27, 0x9A, 0xBE, 0x57, 0x3A, 0x14, 0x28, 0xC2, 0x6E, 0xD4, 0xA2, 0x89, 0xD8, 0x9D, 0x36, 0xD2,
+    0x6C, 0xB8, 0x35, 0x71, 0x93, 0xCF, 0xE7, 0x01, 0x97, 0xF2, 0xD0, 0xAB, 0xC3, 0xBE, 0xB5, 0x53,
+    0xAE, 0x8F, 0x64, 0x1C, 0x76, 0xCE, 0x14, 0x9E, 0x1B, 0x72, 0x37, 0xAE, 0x3F, 0xC0, 0xD9, 0xC6,
+    0x89, 0x26, 0x7D, 0x6C, 0xC4, 0x2D, 0xAD, 0xAF, 0x23, 0x11, 0x61, 0xBD, 0x9D, 0x8B, 0x58, 0x6E,
+    0xB4, 0x83, 0xF3, 0x66, 0xA9, 0x22, 0x3D, 0xE3, 0x50, 0x07, 0xBB, 0xA2, 0x42, 0x5D, 0x3B, 0xB7,
+    0x8B, 0xD9, 0x8C, 0xE8, 0xA7, 0xCB, 0xBF, 0x7F, 0xA9, 0x3B, 0x90, 0x28, 0x04, 0xEA, 0x18, 0x3D,
+    0x6E, 0xCA, 0x53, 0xB6, 0x0B, 0x36, 0xD2, 0xEE, 0xB7, 0xBF, 0x9A, 0x24, 0x3F, 0x0A, 0x95, 0x24,
+    0xAD, 0xA5, 0x24, 0x6D, 0xB4, 0x81, 0x66, 0xC5, 0x46, 0xEA, 0x8D, 0x4A, 0xD7, 0xFF, 0x49, 0xB2,
+    0x2A, 0xF9, 0x4C, 0xAD, 0xBB, 0x53, 0x11, 0x9E, 0x0A, 0x72, 0x25, 0x51, 0x8B, 0x2F, 0xE4, 0xD1,
+    0xCC, 0x18, 0xE8, 0x97, 0x13, 0x1C, 0xEC, 0x40, 0xF3, 0xB5, 0x8E, 0xDF, 0x52, 0x4C, 0x59, 0xA3,
+    0x7E, 0xD4, 0xA5, 0xFF, 0xDA, 0xFF, 0xBD, 0x51, 0x4A, 0x2B, 0x4E, 0xF2, 0x95, 0x3E, 0x11, 0x19,
+    0xBD, 0xF5, 0x36, 0x10, 0x8B, 0x9D, 0xC6, 0xB7, 0x53, 0xB9, 0x9A, 0x88, 0xEB, 0x7A, 0x5F, 0x85,
+    0x7A, 0x65, 0x44, 0x83, 0x0D, 0xCD, 0x52, 0xEE, 0xA5, 0x3A, 0x37, 0xB9, 0x50, 0x6D, 0xFC, 0x16,
+    0xD7, 0x80, 0x0F, 0x58, 0x70, 0x5F, 0xF4, 0xB8, 0x1F, 0x07, 0x9A, 0x76, 0xA1, 0x7E, 0x2D, 0xC2,
+    0xAD, 0x7F, 0xF0, 0x84, 0x1D, 0xD9, 0xDC, 0x4A, 0x29, 0x77, 0xB9, 0xE7, 0x42, 0xC7, 0xF9, 0x94,
+    0xA0, 0xD5, 0x6B, 0xF6, 0x56, 0xCA, 0x89, 0x79, 0x33, 0x27, 0x82, 0xD2, 0xC4, 0x9C, 0x11, 0x8F,
+    0x3E, 0xA5, 0xBB, 0x76, 0x49, 0x6F, 0x61, 0x94, 0x37, 0x6E, 0x3F, 0xA7, 0x60, 0xF2, 0xD4, 0x06,
+    0xF0, 0x62, 0xDD, 0xB9, 0xEF, 0x4C, 0xED, 0xDD, 0x60, 0x3F, 0xBD, 0x9A, 0xD7, 0x1F, 0x8A, 0x31,
+    0x1F, 0xE9, 0xB0, 0x49, 0x0A, 0x97, 0xC4, 0x69, 0xAE, 0xC3, 0x7A, 0xAA, 0x40, 0xB9, 0xC2, 0x03,
+    0x12, 0xE9, 0x48, 0x29, 0xB8, 0x31, 0x00, 0x5C, 0x79, 0x6E, 0x40, 0xDA, 0x68, 0xA5, 0xA9, 0xD2,
+    0xDB, 0x5F, 0x79, 0xD7, 0x46, 0xCB, 0x5F, 0x66, 0xC5, 0x6F, 0xBD, 0x1E, 0xF2, 0xC0, 0x90, 0x27,
+    0xD0, 0xCE, 0x79, 0x8A, 0xCE, 0xE7, 0xD8, 0xD2, 0x0F, 0x59, 0xBA, 0xA6, 0x9C, 0xA6, 0x96, 0x87,
+    0x28, 0xD8, 0x6C, 0xF9, 0x6D, 0x6C, 0xCC, 0xB3, 0x6C, 0x8E, 0xFA, 0xE4, 0x1F, 0x1D, 0x9B, 0xF4,
+    0xD9, 0x71, 0xB7, 0xD2, 0x5B, 0x92, 0x9E, 0xBD, 0xFE, 0xB0, 0x47, 0xAC, 0x6F, 0xC2, 0x06, 0xD6,
+    0x53, 0x44, 0x68, 0x93, 0x66, 0xDA, 0xA5, 0xC6, 0xE9, 0x5D, 0xB0, 0x33, 0xC5, 0x06, 0x6D, 0x56,
+    0xDA, 0x7A, 0xEA, 0x78, 0x4C, 0xF6, 0xC5, 0x81, 0x2A, 0xC2, 0x38, 0x60, 0x17, 0x10, 0x34, 0x81,
+    0x72, 0x87, 0x76, 0x3A, 0x9E, 0x5B, 0xAD, 0x30, 0x76, 0xD8, 0x40, 0x21, 0x68, 0x03, 0x66, 0x07,
+    0x37, 0x51, 0x45, 0x90, 0xC7, 0x46, 0x0A, 0x0D, 0xB4, 0x2B, 0xE6, 0x07, 0x1D, 0x11, 0xDA, 0xD4,
+    0xCE, 0x6D, 0x97, 0x13, 0x31, 0x0D, 0xC5, 0xD5, 0x94, 0xBA, 0xAA, 0xA3, 0x8E, 0xE0, 0xC2, 0xC3,
+    0xC5, 0x61, 0x7D, 0x33, 0x35, 0x74, 0x63, 0x1A, 0x73, 0x3B, 0xC0, 0x96, 0xEA, 0x88, 0xC6, 0xC3,
+    0xDD, 0x14, 0x5E, 0x9A, 0xC4, 0xDE, 0x9B, 0x24, 0x96, 0x64, 0xF4, 0x94, 0x3B, 0x34, 0x69, 0x72,
+    0x76, 0x4A, 0x21, 0x45, 0x21, 0xF5, 0x1E, 0x7F, 0x0E, 0x92, 0xDA, 0xF0, 0x44, 0x81, 0xAE, 0x09,
+    0x55, 0xB7, 0x3C, 0x71, 0x25, 0xAB, 0x98, 0x16, 0xD2, 0x2E, 0xE9, 0x13, 0x9A, 0x90, 0x96, 0xB1,
+    0x9D, 0xD2, 0x2A, 0x3A, 0x9F, 0x16, 0x71, 0xEC, 0x40, 0x69, 0x99, 0x4B, 0xA5, 0x12, 0xC2, 0x6C,
+    0xE9, 0xE5, 0xF6, 0x8C, 0x6C, 0x6D, 0xD7, 0xBC, 0x7C, 0x7F, 0xC8, 0x46, 0x2C, 0x62, 0xB9, 0x9A,
+    0xC5, 0x84, 0x2A, 0xD4, 0xB3, 0x9D, 0x9B, 0xA9, 0xF5, 0xCE, 0x3B, 0x3F, 0xFA, 0x1B, 0x03, 0xF6,
+    0x1E, 0xDC, 0xEE, 0xCC, 0x06, 0xBD, 0x27, 0x81, 0xDC, 0x7B, 0xEC, 0x4A, 0x3B, 0x53, 0x6D, 0xD8,
+    0x85, 0x52, 0x98, 0x08, 0x1A, 0x48, 0x6C, 0x56, 0x3F, 0xD0, 0x06, 0xDA, 0x09, 0xBB, 0x62, 0x03,
+    0x66, 0xC3, 0x44, 0x0A, 0x51, 0xEE, 0x20, 0x8F, 0x3A, 0xDC, 0x8C, 0x9B, 0x68, 0x02, 0x4D, 0xA0,
+    0x8E, 0xD4, 0x11, 0xB3, 0x63, 0x76, 0x0A, 0x75, 0x85, 0x06, 0x46, 0x9F, 0xDD, 0xB0, 0x3B, 0x5C,
+    0x54, 0x15, 0xB9, 0x3C, 0xE6, 0x72, 0x28, 0xEB, 0x8D, 0xE4, 0xA1, 0xEE, 0xC6, 0x24, 0xC9, 0x5F,
+    0xA0, 0x38, 0xAA, 0xA7, 0x8D, 0x23, 0xB9, 0x4B, 0xA4, 0x49, 0x71, 0xE7, 0x7C, 0xE7, 0x15, 0x1B,
+    0x44, 0xCC, 0x46, 0x11, 0xA9, 0x22, 0x26, 0x62, 0x23, 0xD5, 0x9A, 0x93, 0x9F, 0x2B, 0x8F, 0x84,
+    0xF3, 0x3F, 0x84, 0xC6, 0xB3, 0x81, 0x1B, 0x88, 0xE0, 0xBA, 0x22, 0x42, 0x4F, 0xB9, 0xC2, 0x5D,
+    0xCC, 0x02, 0x1B, 0x26, 0x40, 0xA4, 0x0A, 0x14, 0x91, 0x7A, 0xC6, 0x2C, 0xD8, 0x19, 0x13, 0x68,
+    0x26, 0xAA, 0x40, 0xEB, 0xA9, 0x67, 0x9C, 0xC7, 0x7A, 0x9C, 0xA7, 0xF1, 0x8C, 0x1E, 0x37, 0x70,
+    0x63, 0xA0, 0xEF, 0x2E, 0x88, 0xFA, 0xFD, 0x22, 0xED, 0xE8, 0x57, 0xCE, 0x3B, 0xAC, 0xE7, 0xB1,
+    0x62, 0xE0, 0xD4, 0x9B, 0xCD, 0x4F, 0xB3, 0x0A, 0x80, 0x89, 0xED, 0x04, 0x8C, 0x49, 0x5E, 0xFD,
+    0xD8, 0x94, 0x2A, 0x5C, 0x14, 0x94, 0xE9, 0x18, 0xC0, 0x91, 0x74, 0x27, 0x38, 0x1F, 0x7C, 0x3C,
+    0x09, 0xE4, 0xF3, 0xE3, 0xC3, 0x45, 0xE5, 0x5A, 0x66, 0xB6, 0x62, 0x3A, 0x93, 0x00, 0xA4, 0xC7,
+    0x53, 0xD3, 0xE1, 0x78, 0x7C, 0x3E, 0x7F, 0xDC, 0x83, 0xF9, 0xB7, 0xE3, 0x92, 0x54, 0x6B, 0x1C,
+    0xCD, 0xE2, 0x22, 0x15, 0x4F, 0x2E, 0x95, 0x18, 0x77, 0x1E, 0x17, 0xC1, 0xD7, 0x53, 0xAF, 0xBE,
+    0xBF, 0xA8, 0x46, 0x5F, 0xDD, 0xA0, 0x1D, 0xEA, 0xF9, 0x09, 0xF3, 0x7C, 0xF6, 0xA4, 0xAA, 0xA8,
+    0xE7, 0x43, 0xDE, 0x92, 0x3A, 0x64, 0x77, 0x4F, 0xC2, 0x8C, 0xF7, 0xF3, 0x70, 0xCA, 0x4E, 0x96,
+    0xA3, 0xCD, 0xDA, 0xEE, 0x07, 0x91, 0x5F, 0xED, 0x8F, 0x59, 0x17, 0x9D, 0x92, 0xF1, 0xE4, 0x3B,
+    0x12, 0x74, 0xFD, 0x45, 0x2A, 0xDD, 0xAE, 0xA7, 0xC7, 0x8A, 0xC7, 0xA6, 0x8C, 0x85, 0x4A, 0x0D,
+    0xD4, 0x4B, 0xB3, 0x82, 0xFB, 0x9A, 0x3C, 0xC5, 0x6E, 0x23, 0xD8, 0x45, 0x1E, 0xDC, 0x37, 0x23,
+    0x94, 0xDB, 0x38, 0x81, 0x7D, 0x67, 0x23, 0x33, 0xFC, 0xA9, 0x29, 0x6F, 0x53, 0x3F, 0x5E, 0x1C,
+    0x8A, 0x87, 0x46, 0x2B, 0x30, 0x6A, 0x39, 0x76, 0x46, 0xF3, 0x43, 0x05, 0xD0, 0xD7, 0x15, 0x30,
+    0xBB, 0x55, 0xA0, 0x5D, 0x1A, 0xCD, 0xC8, 0xA7, 0xE2, 0xC7, 0x4E, 0x99, 0x07, 0x39, 0x25, 0x20,
+    0xE3, 0x29, 0x01, 0xC9, 0x9D, 0x06, 0xB3, 0xF6, 0x03, 0x7D, 0x3B, 0x53, 0xBF, 0xB3, 0x82, 0x36,
+    0x68, 0xD4, 0x51, 0x26, 0xE2, 0x30, 0xAB, 0x09, 0x46, 0x05, 0xEC, 0x4F, 0x34, 0x14, 0x72, 0x3B,
+    0xED, 0xB7, 0xB4, 0x98, 0xAD, 0x7E, 0x30, 0xB5, 0x3E, 0xC4, 0x76, 0x5D, 0x4A, 0x75, 0xED, 0x96,
+    0x8D, 0xA3, 0x5D, 0x32, 0x45, 0x21, 0x9F, 0x80, 0x2A, 0x0F, 0xA1, 0xB6, 0xF9, 0x56, 0xE4, 0xF9,
+    0x1E, 0xFB, 0x4D, 0xCF, 0x4F, 0x02, 0xED, 0x86, 0x51, 0x47, 0x3F, 0x53, 0x47, 0xD0, 0x4C, 0xA3,
+    0xC1, 0xFC, 0x70, 0xC3, 0xB5, 0x4B, 0x3D, 0xC9, 0x27, 0x97, 0x5C, 0x2E, 0x59, 0x99, 0x73, 0x48,
+    0x2C, 0xCE, 0x65, 0x07, 0xE6, 0x88, 0xEA, 0xBD, 0x4F, 0x8E, 0xD3, 0x86, 0x87, 0x72, 0x80, 0xDE,
+    0x27, 0xAF, 0x7A, 0x44, 0xF6, 0x52, 0xD9, 0xC2, 0x7B, 0x0F, 0xED, 0x3B, 0xDA, 0xAC, 0xA4, 0x4A,
+    0xD2, 0xAB, 0x92, 0xE6, 0xD4, 0x3B, 0x07, 0xE0, 0x95, 0xD4, 0xF9, 0x34, 0x21, 0x01, 0xFA, 0x84,
+    0x7D, 0x58, 0xFC, 0x65, 0x8A, 0x16, 0xE6, 0xAC, 0xA1, 0x65, 0xA7, 0x04, 0xB2, 0x1B, 0xB2, 0x14,
+    0x2F, 0x8F, 0x71, 0x4F, 0x96, 0x59, 0xC6, 0xF4, 0x92, 0x53, 0x0F, 0x2C, 0x80, 0xFD, 0x6E, 0x5A,
+    0x81, 0x56, 0xC7, 0x99, 0x9F, 0x47, 0x72, 0x98, 0x07, 0xD2, 0x95, 0x21, 0x6D, 0xD9, 0x23, 0xB9,
+    0x31, 0xDB, 0x43, 0x79, 0x4C, 0x13, 0xA0, 0xDE, 0xA5, 0x4F, 0x4A, 0xFA, 0x9A, 0xA4, 0x30, 0x4A,
+    0xAB, 0xBB, 0x90, 0x5D, 0x9E, 0xFB, 0x91, 0x98, 0xC4, 0x84, 0x46, 0x59, 0x42, 0x2F, 0x0F, 0xE3,
+    0x94, 0xCA, 0x08, 0xB7, 0xC0, 0x53, 0x5F, 0x4E, 0x70, 0xDF, 0x4A, 0x33, 0xBA, 0x68, 0xF3, 0x3E,
+    0xF4, 0x6B, 0x15, 0xD2, 0x68, 0xF7, 0x1C, 0x55, 0xF3, 0xAF, 0x4B, 0xFA, 0x55, 0x60, 0xEE, 0x77,
+    0x34, 0xEA, 0x18, 0x63, 0xD6, 0xA8, 0x3C, 0xBA, 0xD7, 0xBF, 0x0C, 0x9A, 0xA9, 0x94, 0xCC, 0x46,
+    0x9E, 0x7A, 0x83, 0x3E, 0xA4, 0x18, 0x1F, 0x0F, 0x5C, 0xEC, 0xA1, 0xC8, 0x2F, 0x92, 0x3E, 0xDF,
+    0x04, 0x9C, 0x6F, 0x7C, 0x21, 0x76, 0xEA, 0xB5, 0x5A, 0x70, 0x53, 0x7B, 0xFC, 0x75, 0xF9, 0x25,
+    0xDC, 0x74, 0x3C, 0x33, 0x66, 0x57, 0x96, 0xFE, 0xDA, 0xA5, 0xCE, 0x49, 0xB1, 0x90, 0x14, 0xEA,
+    0xAC, 0x19, 0x48, 0x24, 0xC6, 0x4B, 0x07, 0x35, 0x38, 0x26, 0x9F, 0x52, 0xFC, 0x65, 0xE3, 0xB1,
+    0xB3, 0xC0, 0x7D, 0x72, 0x4D, 0x9B, 0xEB, 0x74, 0x62, 0xE7, 0xC1, 0xBF, 0x92, 0x12, 0x24, 0xE4,
+    0xDD, 0x97, 0x4E, 0xF3, 0x9C, 0xFE, 0xDA, 0x4E, 0x7F, 0x79, 0x60, 0xBF, 0x9A, 0xF4, 0x47, 0xB4,
+    0x3A, 0x89, 0x65, 0x1E, 0x99, 0x9F, 0xA8, 0x97, 0x2A, 0xE2, 0xBC, 0x9B, 0x0B, 0x15, 0xEA, 0xEA,
+    0xD5, 0x6E, 0xB8, 0xE9, 0xCA, 0xD5, 0x34, 0x87, 0x35, 0x3B, 0xEF, 0xBF, 0xCA, 0xFC, 0x8A, 0xF5,
+    0x31, 0x36, 0xFB, 0xFA, 0x46, 0xFB, 0xDA, 0x86, 0xFB, 0x62, 0xC4, 0x7D, 0x3A, 0x32, 0x36, 0x11,
+    0x5D, 0xB9, 0xC6, 0xF6, 0x57, 0xB0, 0xD9, 0x47, 0x98, 0xD3, 0xC8, 0x03, 0x3D, 0xAB, 0x0B, 0xFD,
+    0xD9, 0x49, 0x96, 0x76, 0x52, 0xAB, 0x9D, 0xC2, 0x16, 0xD5, 0x7A, 0x08, 0x96, 0xF5, 0xE9, 0xBC,
+    0x17, 0xED, 0x0F, 0xB7, 0x93, 0x62, 0xBA, 0x3B, 0xF4, 0xC4, 0x87, 0xAA, 0xF9, 0x24, 0x2B, 0xEE,
+    0xF7, 0x53, 0xC3, 0xF2, 0xD8, 0xAB, 0x27, 0xAD, 0x70, 0xB3, 0x3E, 0xA2, 0xF5, 0x3E, 0xB9, 0xB2,
+    0xFE, 0x42, 0xBC, 0xEC, 0x1F, 0x7E, 0x4F, 0xE9, 0x74, 0xE2, 0xEB, 0x9D, 0x64, 0x1A, 0x56, 0x59,
+    0xDB, 0x6F, 0xD4, 0xE7, 0x4E, 0x89, 0xBE, 0x91, 0x04, 0x02, 0xB8, 0x90, 0xFD, 0x47, 0x7D, 0xA1,
+    0xD8, 0x3E, 0x98, 0x9C, 0xD3, 0xC9, 0x90, 0xF6, 0x70, 0x30, 0xF5, 0xA1, 0x7B, 0x2E, 0x9F, 0x10,
+    0xFA, 0x3E, 0x9C, 0xA6, 0x91, 0xA6, 0x65, 0xD2, 0xCB, 0xB2, 0xB6, 0xEC, 0x3D, 0xFF, 0x97, 0x65,
+    0x88, 0x59, 0xE1, 0x97, 0xA6, 0xD3, 0xBC, 0x7E, 0x67, 0x80, 0x42, 0x7A, 0xBB, 0xBB, 0x74, 0x47,
+    0xFB, 0x4D, 0x4A, 0xE9, 0xCE, 0x04, 0x5C, 0xC9, 0xBA, 0x97, 0xBC, 0x16, 0xF6, 0xBB, 0x09, 0x97,
+    0xCC, 0xE7, 0x85, 0x07, 0xB0, 0x49, 0x47, 0x94, 0x92, 0x6E, 0xC5, 0x84, 0x8B, 0x4F, 0x7C, 0x4F,
+    0x9A, 0xD7, 0xF9, 0x9C, 0x3E, 0xD6, 0x3B, 0xD5, 0x8A, 0x91, 0x37, 0x91, 0x42, 0x01, 0xC1, 0xB8,
+    0x31, 0x0E, 0x38, 0x0D, 0xCE, 0xD3, 0x28, 0xD8, 0x40, 0xAD, 0x58, 0xAF, 0x98, 0x5D, 0x66, 0xA3,
+    0xD0, 0x8D, 0xD7, 0x05, 0xFA, 0xC6, 0x3A, 0x0E, 0xB8, 0xB7, 0xE4, 0x26, 0x9A, 0xD8, 0xFF, 0x79,
+    0xC0, 0xEE, 0x56, 0x2B, 0x46, 0x9F, 0xD4, 0x46, 0x29, 0x2F, 0x81, 0x42, 0xAB, 0x81, 0x7E, 0xAD,
+    0x34, 0xD1, 0x6E, 0x85, 0x02, 0x56, 0xE4, 0x13, 0x01, 0x66, 0xCE, 0xA2, 0xEE, 0x72, 0x3D, 0x10,
+    0xDA, 0x9E, 0x4C, 0xEF, 0xDC, 0x1F, 0x87, 0xC4, 0xA8, 0x3A, 0xA9, 0x2B, 0xF4, 0xFA, 0x4E, 0xBD,
+    0x16, 0x2B, 0xCE, 0xD7, 0x73, 0xB1, 0xE1, 0x86, 0x3A, 0x14, 0x1B, 0xCE, 0xD7, 0xA1, 0xD8, 0x71,
+    0xBE, 0x5E, 0x0B, 0xE1, 0xA6, 0xE3, 0x47, 0x2C, 0xD4, 0xB9, 0x70, 0x98, 0x81, 0xC0, 0xCD, 0x38,
+    0x4F, 0xBB, 0xD2, 0xCC, 0x58, 0x61, 0x03, 0x95, 0xBC, 0x89, 0x94, 0x5A, 0xCA, 0x1D, 0xB4, 0x23,
+    0xE8, 0xE5, 0x9D, 0xA7, 0x55, 0x68, 0x67, 0xEC, 0x3B, 0xD1, 0x2E, 0x54, 0xDB, 0xF8, 0xA9, 0x88,
+    0x51, 0xFB, 0xED, 0x1D, 0xF4, 0xF5, 0xA8, 0x8E, 0xFE, 0x2D, 0xF5, 0x1E, 0xB7, 0x3A, 0xCD, 0xD8,
+    0xCD, 0x6A, 0xA1, 0x56, 0x6A, 0xA9, 0xF8, 0x71, 0xA7, 0xD0, 0xDC, 0xA8, 0x63, 0x5C, 0x2A, 0x79,
+    0x5C, 0xE4, 0x4C, 0x2D, 0x9F, 0xB4, 0x36, 0xA9, 0x76, 0x4F, 0x5C, 0xD7, 0x21, 0x73, 0xE8, 0x2E,
+    0x64, 0x0E, 0x99, 0x62, 0x9F, 0x01, 0x9E, 0xBD, 0xF5, 0x20, 0x1A, 0x6D, 0xE2, 0xA2, 0x16, 0xFA,
+    0xA5, 0x1F, 0xEA, 0xB5, 0x58, 0x11, 0xED, 0xD0, 0x4C, 0x66, 0x2D, 0x23, 0x7D, 0xE7, 0x7C, 0x1D,
+    0xAA, 0x15, 0x31, 0x0E, 0x4D, 0xB0, 0x4B, 0xB9, 0x17, 0xC2, 0x4D, 0x6D, 0xA8, 0x36, 0xA3, 0xE3,
+    0x04, 0xAA, 0x91, 0x4F, 0x03, 0xA9, 0xF7, 0xB3, 0xD2, 0xD3, 0x28, 0x7F, 0x66, 0x13, 0xA1, 0xC8,
+    0x74, 0xF4, 0x15, 0x2E, 0x75, 0x50, 0xC6, 0x6A, 0x05, 0xEC, 0x8F, 0x13, 0x8B, 0xA7, 0xE4, 0x05,
+    0x86, 0x33, 0xA5, 0xEA, 0x6F, 0xBE, 0x17, 0x51, 0x67, 0xC3, 0x51, 0xCA, 0x24, 0xF8, 0x93, 0xE5,
+    0xD1, 0x47, 0x9C, 0xA7, 0xD6, 0x54, 0xAF, 0x07, 0xFE, 0xC9, 0xF4, 0x4A, 0xA9, 0xDC, 0xC1, 0xBD,
+    0x19, 0xDC, 0x94, 0x17, 0x20, 0xDB, 0x9E, 0x8D, 0xFD, 0x37, 0x17, 0x0A, 0x7D, 0x7D, 0x13, 0x79,
+    0x05, 0x92, 0xF1, 0x31, 0x06, 0x27, 0x8F, 0x55, 0xA9, 0xF5, 0x58, 0x82, 0x64, 0x7D, 0x46, 0xDE,
+    0xEE, 0x00, 0x1F, 0x1A, 0xCA, 0x5B, 0xE0, 0xFC, 0x08, 0xB8, 0x37, 0xE7, 0xD3, 0xFE, 0x4A, 0xC0,
+    0x24, 0xDF, 0x7F, 0xF3, 0x3D, 0x66, 0xD2, 0xFC, 0xA7, 0x94, 0x08, 0xC6, 0x53, 0x22, 0xB8, 0x35,
+    0x33, 0x8C, 0x43, 0x33, 0x60, 0x22, 0x77, 0xA1, 0x99, 0xCC, 0x0A, 0x23, 0xCD, 0x84, 0x89, 0x8C,
+    0xD0, 0xCC, 0x26, 0xC2, 0x38, 0x34, 0x01, 0xB3, 0x31, 0x0E, 0x34, 0xC1, 0x6C, 0x30, 0xFA, 0x66,
+    0xE1, 0x58, 0x96, 0x67, 0xB3, 0xBB, 0x3C, 0xFC, 0x6E, 0x9B, 0x7D, 0x73, 0x93, 0x7F, 0x1E, 0x67,
+    0x43, 0x6C, 0xFC, 0xEB, 0x88, 0x7C, 0x8B, 0xFB, 0xF9, 0x38, 0xE3, 0x98, 0xFB, 0xCA, 0x2E, 0x3B,
+    0xF1, 0x34, 0x78, 0xD2, 0xB6, 0x4A, 0xDE, 0xE7, 0x6E, 0x2E, 0xE8, 0x92, 0x7A, 0x7A, 0x4C, 0xD2,
+    0x16, 0x9C, 0x4F, 0xC7, 0x2E, 0xD2, 0x5C, 0xA0, 0x5E, 0x53, 0x17, 0x33, 0x4D, 0x08, 0x0A, 0xE5,
+    0xA1, 0x8F, 0x3E, 0x1D, 0x58, 0xFB, 0x19, 0xDA, 0x79, 0xFD, 0x02, 0x5C, 0xEA, 0x93, 0xB6, 0x71,
+    0x4F, 0xCA, 0xED, 0x0B, 0x09, 0x13, 0x7F, 0xB3, 0x1B, 0xCC, 0xC6, 0xD4, 0x1F, 0xAC, 0x14, 0x52,
+    0x3E, 0x51, 0xA4, 0x76, 0xF3, 0x95, 0xDB, 0xDB, 0x09, 0xF7, 0x56, 0x9A, 0xE1, 0xC3, 0xB7, 0x5F,
+    0xBE, 0xFA, 0xAE, 0xDC, 0xF6, 0xCF, 0xE8, 0xC1, 0x2F, 0x8A, 0xE7, 0xC6, 0x09, 0x27, 0x0D, 0xA5,
+    0xB4, 0xF3, 0xD4, 0xED, 0xDF, 0x7D, 0xEC, 0x34, 0x2E, 0xEF, 0x5D, 0x12, 0xC5, 0x37, 0x52, 0x87,
+    0x3E, 0x2F, 0xEC, 0x52, 0x46, 0xDC, 0x50, 0x87, 0x32, 0xD2, 0x7A, 0x3B, 0x23, 0xDC, 0x50, 0xAD,
+    0xC5, 0x86, 0xF3, 0x55, 0xAC, 0x44, 0x93, 0x0F, 0x57, 0x0F, 0x64, 0x72, 0x7B, 0x78, 0xA8, 0x62,
+    0xB7, 0xBE, 0x49, 0x92, 0xA0, 0xF9, 0xA4, 0xF1, 0x4D, 0x6A, 0x88, 0x27, 0xCA, 0x21, 0x6E, 0xEC,
+    0x1C, 0x6D, 0xBB, 0xD4, 0xD3, 0x34, 0xFA, 0xDE, 0xB8, 0x60, 0x34, 0x54, 0x3B, 0xA5, 0x06, 0x46,
+    0x5F, 0x68, 0xA0, 0x59, 0x90, 0xC7, 0x6C, 0xF4, 0x13, 0xA8, 0x6B, 0x03, 0xB8, 0xC9, 0xAE, 0xD0,
+    0x84, 0x24, 0x8A, 0xCE, 0xAC, 0xCF, 0x05, 0xBA, 0xF2, 0x36, 0xC2, 0x38, 0x1B, 0xDD, 0xFB, 0x60,
+    0x96, 0xBB, 0x46, 0xDC, 0x49, 0xA4, 0xB7, 0x83, 0x0E, 0xB5, 0xD6, 0x06, 0xDC, 0xD0, 0xBD, 0x87,
+    0x87, 0x16, 0x8B, 0x98, 0xFB, 0xD2, 0xB9, 0xCD, 0xE8, 0xE1, 0xF2, 0x97, 0x1F, 0x63, 0x07, 0x37,
+    0xC1, 0xA6, 0x3E, 0xEC, 0x06, 0xFA, 0xBC, 0x30, 0x1B, 0x23, 0x66, 0x4D, 0x47, 0xC8, 0x47, 0xEC,
+    0x8C, 0xB0, 0x73, 0xB1, 0xD3, 0x4C, 0x26, 0xD2, 0x84, 0x26, 0x26, 0x28, 0xAD, 0x34, 0xA7, 0xCE,
+    0x4C, 0xAA, 0x6A, 0x33, 0x96, 0x57, 0xE0, 0x1A, 0x14, 0x3B, 0x59, 0xEF, 0x9D, 0xCC, 0x84, 0x7E,
+    0x82, 0x71, 0x2A, 0xD4, 0xBD, 0xAB, 0x41, 0xE6, 0x6E, 0x43, 0x52, 0x8F, 0x64, 0x34, 0xB3, 0x4D,
+    0xD2, 0xAE, 0xD4, 0x11, 0xFA, 0x99, 0x6A, 0x23, 0x03, 0x9A, 0xCD, 0x32, 0x9B, 0x9F, 0xD9, 0xA1,
+    0x8A, 0xC7, 0x07, 0x67, 0x92, 0xAE, 0x8E, 0x60, 0x17, 0xEC, 0x0A, 0x2E, 0x90, 0x60, 0x25, 0x19,
+    0xE7, 0x91, 0xEA, 0xE5, 0x33, 0x6D, 0x19, 0xD9, 0x6C, 0x9F, 0x28, 0x1D, 0xB8, 0x7B, 0xE6, 0xE2,
+    0xF4, 0x5A, 0xEA, 0x8B, 0x15, 0x57, 0x69, 0x02, 0xCE, 0x17, 0xA2, 0x8A, 0x34, 0x0B, 0xFD, 0x54,
+    0xA8, 0x7B, 0x1C, 0xC7, 0x90, 0xD0, 0x4D, 0x0D, 0xCB, 0xB4, 0xD5, 0xDC, 0xDC, 0xFB, 0x04, 0x30,
+    0x76, 0x2E, 0x23, 0x09, 0x64, 0xB3, 0xE2, 0x7C, 0xC2, 0x98, 0xBE, 0xB3, 0x81, 0x42, 0x45, 0x52,
+    0xA8, 0x6E, 0x67, 0x32, 0xAF, 0xC7, 0xB7, 0x3E, 0xD3, 0x9D, 0x17, 0xFE, 0x10, 0x61, 0xF4, 0x3C,
+    0x92, 0xF3, 0x68, 0xEF, 0xD2, 0x31, 0x12, 0x23, 0xAD, 0x98, 0x50, 0x44, 0xEA, 0x50, 0xC4, 0x34,
+    0x00, 0x3B, 0x99, 0x95, 0xD6, 0x57, 0x0B, 0xCE, 0xB7, 0x21, 0xDD, 0x3D, 0x30, 0x26, 0x85, 0x5A,
+    0x52, 0xE5, 0x53, 0x6A, 0x12, 0x46, 0xA8, 0x33, 0x42, 0x43, 0xBD, 0xA3, 0xC1, 0x6E, 0xA5, 0x86,
+    0x66, 0x33, 0xF2, 0x6D, 0x34, 0xF2, 0x2E, 0x56, 0x0F, 0xD0, 0xAF, 0x6D, 0x96, 0x14, 0xFB, 0x93,
+    0xA4, 0x38, 0x6B, 0xF9, 0x1A, 0x2D, 0x8C, 0x9A, 0x8C, 0xDE, 0xE8, 0xEC, 0x0A, 0x7D, 0x3A, 0x75,
+    0x6F, 0x03, 0xF4, 0x03, 0xE5, 0x96, 0xEA, 0xA2, 0xDE, 0x63, 0x94, 0x5C, 0xDD, 0x18, 0x28, 0xEF,
+    0x9C, 0x95, 0xE5, 0x2E, 0x1E, 0x9C, 0x4D, 0x1F, 0x8E, 0x8C, 0x5B, 0xFE, 0x38, 0x39, 0xB7, 0x1F,
+    0x11, 0xEC, 0xD2, 0x63, 0x5C, 0xC6, 0x4F, 0x1D, 0x85, 0x42, 0x33, 0xB5, 0xD2, 0x70, 0x8F, 0x32,
+    0x77, 0xC6, 0xE4, 0xC2, 0xF7, 0xAC, 0xFF, 0x6B, 0xFF, 0x62, 0xA1, 0xD7, 0x54, 0x4A, 0x9D, 0xD5,
+    0x57, 0x70, 0x33, 0x85, 0x72, 0xD9, 0xED, 0x29, 0xD2, 0x71, 0x7D, 0xDC, 0x44, 0x91, 0x41, 0x71,
+    0x81, 0x52, 0x9E, 0xA7, 0xEE, 0xA6, 0x43, 0x81, 0xE5, 0x2D, 0x70, 0x43, 0xDF, 0x81, 0xFB, 0xF3,
+    0x70, 0x2A, 0x92, 0x52, 0x31, 0xB2, 0x3D, 0x39, 0xE9, 0xB0, 0xBA, 0x77, 0x96, 0x69, 0xAC, 0x60,
+    0x7D, 0x15, 0x60, 0xA4, 0xF1, 0x69, 0xF3, 0x27, 0x50, 0x8E, 0x4C, 0xA3, 0xD4, 0xA1, 0x17, 0x1C,
+    0xA5, 0x2E, 0x27, 0x27, 0x49, 0x3A, 0x38, 0x2E, 0xCE, 0x27, 0x68, 0xB0, 0xD1, 0xEC, 0x30, 0xCE,
+    0x76, 0xC5, 0xA8, 0x1B, 0x67, 0x9A, 0xCD, 0xC8, 0x33, 0x06, 0x2B, 0x8C, 0xFC, 0xC5, 0x61, 0xCE,
+    0x2B, 0x14, 0x5D, 0x19, 0xCB, 0x15, 0xFB, 0xE3, 0x3D, 0x45, 0xB4, 0x42, 0x3E, 0xD7, 0x8C, 0xCF,
+    0x9F, 0x0F, 0x73, 0xEF, 0x3B, 0x1A, 0x2D, 0xE9, 0x4E, 0x12, 0xB7, 0xBF, 0x94, 0xE8, 0xCE, 0xA4,
+    0x23, 0x3F, 0x3A, 0x1F, 0xA7, 0xC6, 0xC8, 0x94, 0x09, 0x4C, 0xE5, 0x48, 0x59, 0xCA, 0xC3, 0xB3,
+    0x0F, 0x94, 0x2D, 0x67, 0xE7, 0x9A, 0xFC, 0xB1, 0x71, 0xEC, 0x83, 0xD5, 0x59, 0x39, 0xDE, 0xCF,
+    0x7A, 0xA9, 0xEC, 0xE1, 0xBE, 0x1F, 0x92, 0x6D, 0x99, 0xFD, 0x24, 0xAF, 0xEA, 0xFD, 0xC5, 0x11,
+    0xA5, 0x9D, 0x0B, 0x61, 0xD5, 0x04, 0x7D, 0x56, 0x67, 0x0C, 0x27, 0x81, 0x75, 0x64, 0xA1, 0xDE,
+    0xD1, 0xBD, 0x46, 0x9D, 0x24, 0x0D, 0x92, 0x34, 0x24, 0x0D, 0xEC, 0xE1, 0xB9, 0x9F, 0xCC, 0x45,
+    0x95, 0xBA, 0x47, 0xA3, 0x88, 0xFB, 0xDD, 0x3F, 0xE0, 0x45, 0xE0, 0x85, 0x7C, 0x06, 0xC9, 0xED,
+    0x60, 0x35, 0xA5, 0x83, 0x07, 0xF5, 0x0A, 0x75, 0x34, 0x53, 0xB3, 0x5A, 0x29, 0x38, 0x69, 0xEE,
+    0xA5, 0xEE, 0xF2, 0x45, 0x58, 0x68, 0x2F, 0x8A, 0xC5, 0x24, 0x80, 0xEE, 0xD5, 0x81, 0x59, 0xC7,
+    0x0E, 0xDC, 0xF0, 0x58, 0xEA, 0xEB, 0x29, 0xDD, 0x83, 0x52, 0x5A, 0x48, 0x51, 0xD3, 0xE8, 0xED,
+    0x78, 0xD4, 0xD9, 0x49, 0xCF, 0x70, 0xA6, 0xB2, 0x1A, 0x13, 0x91, 0x9A, 0x4E, 0x27, 0xE9, 0x9C,
+    0xE1, 0x0F, 0xC0, 0x33, 0x9A, 0x4F, 0x72, 0x6A, 0x23, 0xCC, 0x44, 0xBB, 0xE2, 0xEE, 0x57, 0x29,
+    0x3F, 0xD8, 0x71, 0x92, 0xE6, 0x7C, 0x12, 0xFF, 0x01, 0x7F, 0xFB, 0xCA, 0x51, 0xB3, 0xBA, 0x0D,
+    0x4A, 0x6D, 0xD0, 0xBC, 0xBE, 0xC3, 0x76, 0xD1, 0x0A, 0xE2, 0x74, 0x39, 0x8D, 0xC7, 0x7E, 0xF7,
+    0x5F, 0xA4, 0xE3, 0x92, 0xC5, 0x72, 0x88, 0xA8, 0xAD, 0x86, 0x04, 0x53, 0x3E, 0x78, 0x32, 0x0E,
+    0x50, 0x0A, 0x33, 0x35, 0xA9, 0x77, 0x69, 0xA4, 0x9D, 0x46, 0x9A, 0x38, 0x03, 0xEB, 0xA7, 0x65,
+    0x02, 0xBD, 0xA4, 0xAE, 0x18, 0x75, 0x2F, 0x97, 0xDB, 0x66, 0x03, 0x8A, 0xDF, 0x1B, 0x4E, 0x6D,
+    0xFE, 0x19, 0x78, 0xAA, 0xFB, 0x6B, 0x5A, 0x42, 0x23, 0x85, 0x5E, 0x9A, 0x9F, 0x91, 0x3A, 0xA3,
+    0x7B, 0xD4, 0x3E, 0xAB, 0xF1, 0x17, 0x78, 0x7A, 0x49, 0xEC, 0x5F, 0x3F, 0xC1, 0x3F, 0x3F, 0x5A,
+    0x6A, 0xD7, 0xA0, 0x8C, 0x66, 0x05, 0x94, 0x8E, 0x72, 0x25, 0x95, 0x57, 0xBC, 0x60, 0x73, 0xAA,
+    0xC7, 0x53, 0xA4, 0xE5, 0x78, 0xFF, 0x24, 0x80, 0xCF, 0x21, 0xF4, 0xED, 0x78, 0xD0, 0xEE, 0xA9,
+    0xB6, 0x68, 0xCE, 0xB5, 0x74, 0x1B, 0x27, 0xCE, 0x3B, 0xE9, 0x67, 0x92, 0xB1, 0x64, 0xDC, 0x8A,
+    0x71, 0x3F, 0x97, 0xE0, 0x93, 0xA0, 0x33, 0xBA, 0xD9, 0x1F, 0x22, 0x72, 0x77, 0x26, 0x22, 0xCF,
+    0x09, 0x64, 0x79, 0x8B, 0xAF, 0x64, 0xF1, 0xFB, 0x38, 0xFA, 0x2C, 0x7D, 0xB7, 0xEB, 0xD1, 0x34,
+    0x78, 0x50, 0xF7, 0x5E, 0xEA, 0x1E, 0x34, 0x8A, 0xE0, 0x7E, 0xF7, 0x0F, 0xF2, 0x01, 0xDB, 0x17,
+    0xC8, 0x68, 0xE6, 0x97, 0xA6, 0x7E, 0x47, 0x38, 0x18, 0xB8, 0x3A, 0x26, 0x9B, 0xB1, 0x59, 0x10,
+    0x39, 0xD3, 0x4B, 0xDD, 0x99, 0xD1, 0x5C, 0xBA, 0x7E, 0xFD, 0xFA, 0xF5, 0x56, 0xD2, 0xEE, 0x24,
+    0x6D, 0x4E, 0x52, 0xEC, 0x25, 0xC5, 0x44, 0x54, 0x9B, 0xED, 0xD8, 0x30, 0x49, 0x4A, 0xB3, 0x1E,
+    0x24, 0x60, 0x1B, 0x4E, 0x7A, 0x8E, 0xF9, 0x68, 0xE3, 0x8C, 0x3E, 0x3B, 0xB1, 0x22, 0xE9, 0x3E,
+    0xBA, 0x5C, 0x40, 0x9B, 0xD3, 0xD9, 0xF0, 0x62, 0x3E, 0xC8, 0x99, 0x3A, 0x02, 0x3F, 0xF7, 0x3C,
+    0xF0, 0xA1, 0x78, 0x70, 0x4F, 0xEE, 0xC4, 0xE1, 0x17, 0x37, 0x29, 0x52, 0xDB, 0xD5, 0xAC, 0xD0,
+    0x53, 0x24, 0xEF, 0x60, 0xA5, 0x90, 0x2F, 0x49, 0xAA, 0x16, 0x52, 0x36, 0x02, 0xB9, 0xA5, 0xAB,
+    0x88, 0x93, 0xAF, 0xD2, 0x8F, 0x7A, 0x80, 0x1D, 0xDA, 0x85, 0xF2, 0x4E, 0x47, 0x1F, 0x8E, 0x0B,
+    0x75, 0x20, 0x1D, 0x0C, 0x43, 0xCD, 0x9C, 0x9D, 0x49, 0x7B, 0xE2, 0x45, 0xEB, 0x47, 0x24, 0x97,
+    0x3F, 0x5D, 0x74, 0x4E, 0xBD, 0xA1, 0xED, 0x68, 0x15, 0x99, 0x08, 0x9F, 0x35, 0x0B, 0x55, 0xA8,
+    0x03, 0x36, 0x3C, 0x75, 0x2B, 0x1F, 0xAC, 0x48, 0xF9, 0xBE, 0x4F, 0x66, 0x98, 0xA5, 0xF4, 0x07,
+    0xD3, 0x56, 0x6C, 0x07, 0xC3, 0x69, 0xD6, 0x07, 0x6E, 0x07, 0xB0, 0x0A, 0x8F, 0x7C, 0x7B, 0xF2,
+    0x04, 0xCD, 0x13, 0x26, 0xD8, 0xEA, 0x38, 0x34, 0xE7, 0x72, 0x6A, 0x78, 0x4C, 0x50, 0xEF, 0x6B,
+    0x82, 0xF0, 0x0B, 0x0F, 0x33, 0xF2, 0x55, 0x3A, 0x81, 0x9F, 0xB4, 0x27, 0xBE, 0x94, 0x64, 0xA5,
+    0xE8, 0xA4, 0xE9, 0x01, 0x9E, 0x5E, 0x18, 0x45, 0xAC, 0x42, 0x6A, 0xCF, 0x71, 0x29, 0x45, 0xC6,
+    0xD7, 0x3C, 0x30, 0xFE, 0xC5, 0x04, 0xDC, 0x97, 0x87, 0x22, 0xA8, 0x03, 0x6E, 0xFD, 0xC3, 0xF7,
+    0xAA, 0xFF, 0xDB, 0x48, 0x13, 0xB3, 0x6A, 0xC4, 0x05, 0xDC, 0x4A, 0x1F, 0x70, 0x81, 0x71, 0xA6,
+    0x0F, 0x68, 0x62, 0x9C, 0x91, 0x47, 0x1E, 0x0D, 0xC8, 0xA7, 0x8E, 0x71, 0x29, 0x4A, 0x75, 0x66,
+    0xC7, 0x28, 0xA7, 0xEE, 0x55, 0xA4, 0xDA, 0xA8, 0x63, 0x3E, 0xC2, 0xD8, 0xAE, 0x58, 0xBD, 0x99,
+    0xEA, 0x8C, 0x24, 0xB5, 0xCF, 0x09, 0x7B, 0xD2, 0x0D, 0x9E, 0xBA, 0x91, 0x0F, 0x7C, 0xBD, 0x60,
+    0xA1, 0x7F, 0xCD, 0xE3, 0x14, 0x68, 0x9A, 0x85, 0xEA, 0xD5, 0x47, 0xBB, 0xF3, 0x45, 0xA4, 0xF5,
+    0x77, 0xB1, 0xB3, 0xEB, 0xAA, 0xC5, 0x4E, 0x65, 0x34, 0x01, 0x15, 0x11, 0x37, 0x8C, 0xB4, 0x73,
+    0x3B, 0xD8, 0xC5, 0x4E, 0x55, 0x34, 0x8B, 0x11, 0xFA, 0x84, 0x06, 0x27, 0x4D, 0xF6, 0x90, 0x28,
+    0x8F, 0xDA, 0xB9, 0x9C, 0x33, 0xFD, 0xE2, 0xD7, 0x92, 0x94, 0x35, 0x89, 0x25, 0x57, 0xB0, 0x7A,
+    0xFB, 0xA5, 0xF7, 0x45, 0x98, 0xFC, 0x0C, 0x01, 0x06, 0x1D, 0x37, 0xD2, 0xF5, 0x78, 0xB3, 0x91,
+    0x76, 0xAE, 0x3C, 0xB6, 0x40, 0xEB, 0xA9, 0x43, 0x3D, 0xB3, 0xB3, 0xD1, 0x4C, 0x76, 0x2A, 0x23,
+    0x11, 0xE7, 0x1B, 0x6F, 0xD6, 0x32, 0x32, 0x0E, 0xED, 0x60, 0x17, 0xB3, 0x14, 0xC2, 0x75, 0x2E,
+    0x98, 0xAD, 0xDE, 0x71, 0xE9, 0x2E, 0xB1, 0x88, 0x4B, 0xA7, 0x6A, 0xD7, 0x13, 0x6C, 0x91, 0x57,
+    0x00, 0xBD, 0x99, 0x3A, 0xFF, 0xC9, 0xED, 0x4F, 0xE4, 0xFB, 0x99, 0xFE, 0xEE, 0xC0, 0x96, 0xE9,
+    0x82, 0x3E, 0xD5, 0xE2, 0x81, 0x42, 0xFB, 0xE3, 0x88, 0x82, 0xC6, 0x97, 0x91, 0xBB, 0xD8, 0xD9,
+    0x2C, 0xF4, 0x9D, 0x9D, 0xCA, 0x88, 0xC3, 0x86, 0x22, 0x53, 0x15, 0x3B, 0xED, 0x60, 0x17, 0x36,
+    0x7A, 0x6F, 0x16, 0x23, 0xEC, 0xD2, 0xAE, 0xC9, 0x1F, 0x64, 0x59, 0x60, 0x4C, 0x67, 0xDA, 0x0E,
+    0xF0, 0xCA, 0xE5, 0xA2, 0xCB, 0x6F, 0x5F, 0x38, 0x0B, 0xCF, 0x2B, 0x40, 0x35, 0xF3, 0x77, 0xCD,
+    0xFE, 0xEA, 0x29, 0x39, 0xF9, 0x8F, 0x2E, 0xF0, 0x4A, 0x48, 0x5D, 0x66, 0x37, 0xC1, 0x87, 0x1E,
+    0x6D, 0x42, 0x07, 0xC6, 0x7A, 0x66, 0xB7, 0x53, 0xB1, 0xD9, 0xA9, 0x8C, 0xD6, 0x9B, 0xD8, 0x78,
+    0xB3, 0xB6, 0xBE, 0x5E, 0xDB, 0xC1, 0x2E, 0xAE, 0x6B, 0x82, 0xEB, 0x5C, 0x70, 0xD3, 0x38, 0x3B,
+    0x69, 0x72, 0xC9, 0x19, 0xFA, 0x56, 0x1A, 0x12, 0x7C, 0x26, 0x1E, 0xA5, 0xD4, 0xD8, 0x61, 0xF6,
+    0x83, 0x12, 0x90, 0xA7, 0xB8, 0xF6, 0xD8, 0x9A, 0xF1, 0x5C, 0x4D, 0x19, 0x52, 0x93, 0x72, 0x28,
+    0x93, 0x46, 0xC9, 0xEE, 0x64, 0xD0, 0x4A, 0x0D, 0x85, 0x3C, 0x36, 0x5F, 0x8D, 0x16, 0x70, 0x99,
+    0x8D, 0xF6, 0x54, 0x1B, 0xD5, 0x0E, 0x6D, 0xA0, 0x5D, 0x8E, 0xFF, 0x65, 0x9A, 0xA2, 0x09, 0x34,
+    0x0B, 0x8C, 0x1E, 0x79, 0x8C, 0xA8, 0x77, 0x32, 0x7A, 0x38, 0x1D, 0xE7, 0xAE, 0xB6, 0x44, 0x46,
+    0x04, 0x32, 0x80, 0x07, 0x37, 0xF5, 0x90, 0x3F, 0xBB, 0xCA, 0xA5, 0x2E, 0xF1, 0x2D, 0xBD, 0x2F,
+    0x94, 0xC8, 0x96, 0x7A, 0xCB, 0x57, 0x7B, 0x3D, 0x82, 0x21, 0xDC, 0xC5, 0xCE, 0xD8, 0xA9, 0xD8,
+    0x60, 0xA3, 0xF5, 0xE9, 0x6A, 0xC0, 0x22, 0xE2, 0x06, 0x5A, 0x5F, 0xAF, 0x94, 0x2B, 0xEA, 0x70,
+    0x5D, 0x13, 0x30, 0x8B, 0x11, 0xB8, 0x69, 0x9C, 0xD3, 0x2D, 0x9A, 0xA7, 0x03, 0x02, 0x49, 0xAF,
+    0x3D, 0x1C, 0xF7, 0xC5, 0xBD, 0xBB, 0x45, 0x8D, 0x7F, 0x5B, 0x16, 0x55, 0x66, 0x8B, 0x4A, 0x4D,
+    0xC7, 0xBB, 0x17, 0x0A, 0x94, 0x2C, 0x07, 0xCB, 0xD7, 0x9F, 0x0D, 0x0F, 0xDB, 0x50, 0x3D, 0x3F,
+    0x68, 0x43, 0xCD, 0x61, 0x43, 0x83, 0x0D, 0xAE, 0x6B, 0x83, 0x1B, 0xFA, 0xD9, 0xBD, 0xAD, 0xA9,
+    0x3F, 0xB3, 0xA1, 0x6A, 0xCF, 0x1D, 0x52, 0x3B, 0xE5, 0xCB, 0x74, 0xB2, 0x24, 0xEB, 0xF2, 0xF2,
+    0x88, 0x63, 0xE0, 0xD4, 0xE8, 0x3D, 0x29, 0x84, 0xB2, 0xEA, 0x87, 0x32, 0x26, 0xCA, 0xBB, 0x7F,
+    0x9C, 0xDE, 0xE0, 0x7A, 0xD2, 0x27, 0x37, 0x49, 0x79, 0xF2, 0x3B, 0xB9, 0xE5, 0xD8, 0xA6, 0x5B,
+    0x59, 0x52, 0x17, 0x47, 0xBE, 0x4D, 0xBA, 0x5F, 0xA3, 0xEE, 0xA9, 0x9B, 0x46, 0xB8, 0xA5, 0x14,
+    0xFD, 0x6C, 0xD4, 0xF5, 0xC1, 0x46, 0xDC, 0x62, 0x55, 0x68, 0x30, 0xFA, 0xA4, 0x16, 0x17, 0x70,
+    0x61, 0xD4, 0x17, 0x77, 0x8C, 0x1A, 0xAD, 0xF2, 0xB8, 0x9F, 0x48, 0x7F, 0xBE, 0x62, 0xA4, 0x37,
+    0x25, 0xE8, 0x15, 0x95, 0x2E, 0xFF, 0xF9, 0xB4, 0x22, 0xF4, 0x9A, 0x47, 0x0D, 0x54, 0x8A, 0x75,
+    0xBA, 0x29, 0xA0, 0xEB, 0x77, 0xA8, 0x35, 0x57, 0xF2, 0x30, 0xC6, 0xAC, 0x5F, 0x62, 0x81, 0x7C,
+    0xC3, 0x88, 0x4B, 0x57, 0xD1, 0x0C, 0xD0, 0xFE, 0x49, 0x84, 0xC6, 0x37, 0xD3, 0xE3, 0xD5, 0x70,
+    0x2B, 0x54, 0xF7, 0x77, 0x30, 0xB1, 0x1F, 0x28, 0xB7, 0x66, 0x6E, 0x51, 0xB5, 0x36, 0xD3, 0xF8,
+    0xF1, 0xBD, 0x59, 0x7B, 0xDF, 0x7F, 0x49, 0x6E, 0x6A, 0xA4, 0x37, 0x43, 0x25, 0x69, 0x29, 0x24,
+    0x45, 0xFA, 0x74, 0x6F, 0xEB, 0xB8, 0x53, 0xE9, 0x4B, 0xA2, 0xD0, 0xAB, 0x1A, 0xE8, 0x7D, 0xFF,
+    0x60, 0x76, 0x69, 0xC2, 0x91, 0x5A, 0x59, 0x1D, 0x6D, 0xE3, 0xF1, 0x53, 0x2B, 0x45, 0x7C, 0xE0,
+    0xAC, 0xFF, 0xC3, 0x01, 0xED, 0xA7, 0x76, 0x6D, 0x53, 0x76, 0xDC, 0xE1, 0x54, 0x7F, 0x67, 0x59,
+    0xD5, 0x00, 0xFD, 0x17, 0x22, 0xB8, 0xAE, 0xF1, 0xEF, 0xDE, 0x54, 0x15, 0x36, 0x30, 0x62, 0x36,
+    0xDC, 0xC0, 0x38, 0xB4, 0x3E, 0xDD, 0x10, 0x62, 0x36, 0x1B, 0x40, 0x5F, 0x5C, 0xA0, 0xFD, 0xE1,
+    0x7A, 0x5C, 0x10, 0x92, 0x8F, 0x48, 0x00, 0xB5, 0xBA, 0x63, 0x23, 0x38, 0x7F, 0x1C, 0x61, 0x6A,
+    0x43, 0xBE, 0x1E, 0xC4, 0xA6, 0x99, 0xC4, 0xE3, 0x52, 0x99, 0xCC, 0xDE, 0x16, 0x5B, 0xBD, 0xA4,
+    0x77, 0xAE, 0x62, 0x13, 0xA8, 0xA3, 0x0B, 0xD8, 0xD8, 0x07, 0xAE, 0x5C, 0x7B, 0xAF, 0x33, 0x95,
+    0x3F, 0x55, 0x48, 0xD3, 0xA1, 0xA8, 0x1C, 0xF0, 0x72, 0xD7, 0xA9, 0x83, 0xC7, 0xDD, 0xDF, 0x65,
+    0x2F, 0x6E, 0x18, 0xF1, 0xC7, 0xA5, 0x82, 0xE9, 0xE4, 0x6D, 0x79, 0x27, 0xD1, 0x13, 0x45, 0xBE,
+    0x67, 0x70, 0x4F, 0xBA, 0x83, 0xE1, 0x24, 0xD1, 0xAA, 0xB4, 0x90, 0x79, 0x87, 0xE3, 0x68, 0x59,
+    0x9F, 0xAF, 0x6E, 0x0C, 0x40, 0xAD, 0x98, 0xFA, 0x3D, 0xD7, 0xAF, 0xA5, 0xF7, 0x9F, 0xF2, 0x87,
+    0x15, 0xE9, 0x8F, 0x56, 0xC7, 0x99, 0xAB, 0xE4, 0xB6, 0xAB, 0x89, 0x74, 0xBD, 0x8E, 0x09, 0x99,
+    0x85, 0x7A, 0xFC, 0x45, 0x10, 0x89, 0x46, 0xE8, 0xA5, 0xAE, 0x4C, 0xFC, 0xFE, 0x38, 0xE5, 0xA0,
+    0xFF, 0x80, 0x94, 0xB7, 0x5D, 0x32, 0x52, 0x7D, 0x80, 0x4A, 0x6F, 0xDC, 0xC2, 0x49, 0x73, 0x71,
+    0x5C, 0xDE, 0x9A, 0x88, 0xB6, 0xEE, 0xAC, 0xED, 0x7F, 0xAE, 0x21, 0xCC, 0x2D, 0x56, 0xF7, 0x48,
+    0x44, 0xBE, 0x98, 0x47, 0x4C, 0x47, 0xA8, 0xD2, 0x55, 0x09, 0x2B, 0x3C, 0x9B, 0xDF, 0xB4, 0x91,
+    0xE7, 0xB8, 0x54, 0xA6, 0x4C, 0x0E, 0x38, 0x35, 0xBB, 0x7A, 0x75, 0x27, 0xE1, 0x86, 0xD5, 0xC2,
+    0x61, 0x93, 0x45, 0x7A, 0xDD, 0x98, 0x6C, 0x51, 0x3F, 0xBA, 0xDE, 0x9D, 0x2F, 0xCA, 0x94, 0xF5,
+    0xE8, 0xE5, 0x85, 0x44, 0x3D, 0x79, 0xCE, 0x93, 0x8E, 0xE6, 0xE2, 0x72, 0xA7, 0x71, 0x86, 0xE2,
+    0xFA, 0xDF, 0x1E, 0x5C, 0x59, 0xDE, 0x5F, 0x2D, 0x80, 0x7B, 0x35, 0x8D, 0x7D, 0xE7, 0xD8, 0x4C,
+    0x47, 0x65, 0x5D, 0x2C, 0x4F, 0xD8, 0x02, 0x3F, 0x33, 0xD8, 0xB5, 0x5D, 0x3D, 0x81, 0xFB, 0xFC,
+    0x06, 0xF4, 0xA3, 0x07, 0xC6, 0x78, 0xE2, 0xED, 0x52, 0x33, 0xB6, 0x78, 0x97, 0x13, 0x48, 0xCA,
+    0x97, 0x0B, 0x2C, 0xF9, 0x2A, 0xEA, 0x23, 0x3B, 0x1F, 0xFD, 0xC5, 0x61, 0xDC, 0xE1, 0xE8, 0x44,
+    0xA4, 0xB8, 0xE4, 0xD2, 0x90, 0xD3, 0x3E, 0xBA, 0x7D, 0xDC, 0x8A, 0xD0, 0x5C, 0x9C, 0x40, 0x4E,
+    0xC6, 0x68, 0x34, 0xE3, 0xD4, 0x95, 0x8A, 0xD8, 0x15, 0xC6, 0x21, 0xC9, 0xAF, 0x67, 0xE8, 0xBB,
+    0xD4, 0x0C, 0x98, 0xC1, 0x5D, 0x34, 0x03, 0x9C, 0x4F, 0x6C, 0xF8, 0x7A, 0xA2, 0xC0, 0xEB, 0x98,
+    0x6A, 0xE5, 0x2B, 0x98, 0x0D, 0x9B, 0xBB, 0x2F, 0xF0, 0xC0, 0x05, 0xC8, 0xCF, 0x93, 0xF4, 0xE5,
+    0x13, 0x4E, 0x9D, 0x7D, 0x6B, 0x3F, 0xCE, 0x70, 0xD4, 0xAF, 0x87, 0xF1, 0xEB, 0xAF, 0xBD, 0xB9,
+    0xB7, 0x4D, 0x78, 0xBE, 0xED, 0x8A, 0xE7, 0xC6, 0x49, 0xDA, 0x5B, 0xE9, 0xDB, 0xB7, 0x5F, 0xBE,
+    0x06, 0x97, 0xAE, 0x0F, 0xBD, 0xB4, 0x37, 0x92, 0xFE, 0xCF, 0xED, 0xDB, 0xD7, 0xAF, 0x01, 0xF5,
+    0x5C, 0x7F, 0x5B, 0x0A, 0xBD, 0xD6, 0x5A, 0x0B, 0xCF, 0xDD, 0xA4, 0xB8, 0xEA, 0xBC, 0xEA, 0xE8,
+    0x7E, 0xA0, 0xC1, 0x84, 0xBE, 0x8C, 0xAD, 0x97, 0x0D, 0xE3, 0x37, 0xA2, 0xFB, 0xCE, 0xCE, 0xC7,
+    0x9A, 0xE9, 0x0F, 0xD6, 0xDF, 0x06, 0x68, 0x7F, 0x47, 0x9F, 0x7E, 0xA1, 0x0F, 0x1A, 0x5E, 0xCA,
+    0xFD, 0x30, 0x61, 0xA2, 0xD9, 0xB0, 0x8B, 0x5D, 0x71, 0xB3, 0x9B, 0xB9, 0xB8, 0x5D, 0xC8, 0xAC,
+    0xE5, 0x6A, 0xBF, 0xB5, 0xD3, 0xAB, 0x2B, 0xE5, 0xB1, 0x01, 0x5E, 0xC9, 0xAF, 0xB2, 0xB9, 0xCD,
+    0x64, 0xB6, 0x74, 0xD8, 0xA5, 0xD4, 0xA9, 0x4A, 0x7A, 0xEE, 0x16, 0x9A, 0x4B, 0x79, 0x23, 0xEA,
+    0x0D, 0x1B, 0x69, 0x56, 0xDC, 0x42, 0x1F, 0x50, 0x30, 0x1A, 0x6C, 0xA4, 0x9F, 0x8D, 0x68, 0x97,
+    0x42, 0xDE, 0x6E, 0x3C, 0x7B, 0x13, 0x17, 0x19, 0x03, 0xF2, 0xA5, 0x3A, 0x23, 0xAA, 0x1D, 0xBB,
+    0xD1, 0x44, 0x3E, 0x74, 0xAB, 0xB8, 0x6A, 0x5F, 0x1D, 0xDB, 0x45, 0xDE, 0xB1, 0xF2, 0x81, 0x62,
+    0x31, 0x6F, 0xDB, 0xAD, 0x59, 0x3F, 0x46, 0xC4, 0x7D, 0xE5, 0x6A, 0xAF, 0x38, 0x2A, 0x62, 0x56,
+    0xCC, 0x82, 0x09, 0xE9, 0xEA, 0xB4, 0xE2, 0x66, 0x35, 0xB5, 0x45, 0x74, 0xD3, 0x6E, 0xE6, 0x9F,
+    0x03, 0x7E, 0xC9, 0xFE, 0xF1, 0xD2, 0x7E, 0x62, 0xA9, 0xE1, 0x12, 0xED, 0xE5, 0x57, 0x9A, 0xA5,
+    0x8F, 0x37, 0x42, 0x31, 0x7C, 0xB6, 0xD0, 0x7F, 0xD0, 0xAB, 0xAA, 0xFF, 0x7B, 0x03, 0x98, 0xEE,
+    0x5F, 0x8E, 0xDF, 0xBA, 0xF7, 0xF3, 0x70, 0xE9, 0xB9, 0xF1, 0x6B, 0x89, 0x95, 0xF8, 0xB3, 0xDB,
+    0x2F, 0x5F, 0xAB, 0x83, 0x7B, 0x55, 0x36, 0x8E, 0xDF, 0xBA, 0xDE, 0xD5, 0x61, 0xB4, 0xF3, 0xDE,
+    0x7E, 0x7B, 0x77, 0x7F, 0xB2, 0xF5, 0xFF, 0x33, 0x3E, 0x88, 0x62, 0xBF, 0x96, 0xF2, 0x76, 0xC7,
+    0x85, 0x52, 0x9D, 0x8D, 0x68, 0xAA, 0xC4, 0x87, 0x6E, 0xF1, 0xF0, 0xC5, 0xD0, 0x7C, 0xA0, 0xD8,
+    0xEA, 0xB5, 0x99, 0x5C, 0xE7, 0xA2, 0x8B, 0xF5, 0xCA, 0xD3, 0x60, 0xA2, 0x59, 0xAB, 0xC5, 0x06,
+    0x1B, 0xDA, 0xD9, 0x4D, 0xCE, 0x37, 0x8A, 0xAD, 0xA2, 0xD3, 0xEA, 0x3E, 0xB5, 0xF4, 0x55, 0xB8,
+    0x5B, 0x87, 0xFF, 0x07, 0xCD, 0xBC, 0x41, 0xCC, 0x25, 0xD7, 0x75, 0xE7, 0xF7, 0xAB, 0xBA, 0x62,
+    0x97, 0xC1, 0x82, 0x7D, 0x19, 0x80, 0xB4, 0x21, 0xD2, 0x50, 0x65, 0xE1, 0xC5, 0x0C, 0x2D, 0xA9,
+    0x36, 0x46, 0x20, 0x18, 0x24, 0x6F, 0x51, 0x84, 0x41, 0x20, 0x02, 0xA2, 0x5E, 0x74, 0x6B, 0x11,
+    0x2D, 0x18, 0x20, 0x9B, 0x09, 0x05, 0xB8, 0x67, 0xA1, 0x85, 0x80, 0x34, 0xBB, 0x8A, 0x22, 0x10,
+    0x2D, 0xB4, 0x60, 0x0F, 0x22, 0xCD, 0x66, 0x80, 0x98, 0x0B, 0x39, 0x10, 0x9B, 0x93, 0xB4, 0x16,
+    0x02, 0xCC, 0x01, 0x9A, 0xAC, 0xCB, 0x66, 0x00, 0x2E, 0xB4, 0x50, 0x51, 0x1C, 0xC3, 0xC0, 0x30,
+    0x81, 0xCA, 0x12, 0x6D, 0x8D, 0x45, 0x20, 0xBC, 0x14, 0x4B, 0x66, 0x91, 0x7D, 0xAB, 0xFE, 0x59,
+    0xDC, 0x5B, 0xDF, 0xF7, 0x35, 0x49, 0x51, 0xF2, 0x8C, 0xC7, 0xC8, 0x23, 0xF8, 0xBE, 0xD7, 0xEF,
+    0xBD, 0x7A, 0x55, 0x75, 0xEF, 0xB9, 0xE7, 0xFC, 0xCF, 0xFF, 0xFC, 0xCF, 0x75, 0xBE, 0x8C, 0x36,
+    0xB4, 0x73, 0xB5, 0xAB, 0x2B, 0x15, 0x41, 0x01, 0x7A, 0x0F, 0x8E, 0xF4, 0x78, 0x08, 0x18, 0x3B,
+    0xD0, 0x8C, 0xD1, 0x4A, 0xBD, 0x8B, 0x26, 0xB8, 0xC9, 0x0D, 0xD5, 0x0A, 0x50, 0xCD, 0x97, 0x9B,
+    0xF5, 0x09, 0x17, 0x6F, 0x3C, 0xD1, 0xAF, 0x37, 0x5C, 0xB8, 0x5C, 0x7B, 0xA0, 0x94, 0x6E, 0x4A,
+    0x6F, 0xEF, 0xD7, 0xBE, 0xC3, 0x3D, 0x8F, 0x5F, 0xED, 0xB5, 0x59, 0xE9, 0x27, 0x7A, 0xFF, 0xD9,
+    0x72, 0x6D, 0x4B, 0x7D, 0xC1, 0xEB, 0x9D, 0xF9, 0xC6, 0xB8, 0x38, 0x1B, 0xEB, 0x97, 0x56, 0x9C,
+    0xF4, 0x57, 0x52, 0x1C, 0x25, 0x0F, 0xAB, 0x59, 0xCB, 0x60, 0x26, 0xD7, 0x45, 0x33, 0x01, 0x50,
+    0xAD, 0xCD, 0xE4, 0xFC, 0x6E, 0xA2, 0x0D, 0xAD, 0xD4, 0x49, 0xAB, 0x95, 0xFC, 0xE3, 0xD7, 0xBE,
+    0x5B, 0x5E, 0xBB, 0x56, 0x48, 0x7E, 0xD4, 0xEC, 0xCA, 0x60, 0x87, 0x58, 0x69, 0x37, 0x52, 0x27,
+    0xF9, 0xF2, 0xD6, 0xDC, 0x6A, 0x7A, 0x47, 0x8F, 0x3E, 0x7D, 0xF9, 0xC1, 0xCB, 0xE1, 0x17, 0x3F,
+    0x1B, 0x80, 0xEA, 0xBF, 0x63, 0xE7, 0xB3, 0x34, 0xFE, 0x33, 0xCB, 0x27, 0x3F, 0x49, 0xFD, 0x6A,
+    0x18, 0x5F, 0x79, 0xF9, 0xAD, 0xBD, 0x6D, 0xC2, 0xE5, 0xB6, 0xA3, 0x98, 0x9B, 0x9B, 0xB1, 0x7D,
+    0x79, 0xF9, 0x83, 0x7C, 0xC7, 0xD6, 0xC3, 0x0B, 0x50, 0xCD, 0xE0, 0xC0, 0x2C, 0x7C, 0xFC, 0xA3,
+    0xAF, 0x82, 0x89, 0xCE, 0x37, 0x6F, 0x8B, 0xF1, 0xE9, 0xD5, 0x6C, 0x6E, 0x02, 0xB0, 0xDA, 0xAD,
+    0xB6, 0x46, 0xB1, 0xFD, 0x7A, 0x74, 0x8F, 0xAC, 0xCE, 0x2C, 0x7C, 0xE9, 0xB9, 0x58, 0x48, 0xD1,
+    0x48, 0xF1, 0xCE, 0x6B, 0xDF, 0xBE, 0x90, 0x8E, 0x2E, 0xBA, 0x4A, 0x9A, 0xAC, 0x34, 0x3B, 0x69,
+    0xBE, 0xA7, 0x83, 0xE2, 0xFC, 0x3D, 0x45, 0xB4, 0xFE, 0xC5, 0x3A, 0xB8, 0x47, 0xD6, 0xC6, 0x6F,
+    0x75, 0x18, 0xCD, 0xEA, 0x9E, 0xDC, 0x9A, 0xE9, 0xCE, 0x8B, 0x0F, 0x6B, 0x6F, 0xF5, 0x9A, 0x22,
+    0xCE, 0x57, 0x2B, 0xE3, 0x00, 0xC0, 0x27, 0x00, 0x33, 0x00, 0x01, 0x9A, 0xED, 0x06, 0x95, 0xBE,
+    0x39, 0xA1, 0x35, 0xD2, 0x5E, 0xD7, 0x60, 0x6E, 0x29, 0xE0, 0xDE, 0xD9, 0x28, 0x9E, 0x00, 0x8C,
+    0x4F, 0x5F, 0xE3, 0xB3, 0x40, 0xE5, 0x81, 0xE5, 0x83, 0xFF, 0xF8, 0x0C, 0x50, 0x7C, 0xC4, 0x6D,
+    0x9A, 0x00, 0xC0, 0x98, 0x86, 0x28, 0x00, 0x14, 0x02, 0xE0, 0xDE, 0xAB, 0x1F, 0x37, 0x3C, 0xB5,
+    0xE6, 0x42, 0x43, 0x25, 0xF9, 0x36, 0x96, 0x92, 0x2A, 0x75, 0xFD, 0xEA, 0xA4, 0xD9, 0x0A, 0x69,
+    0x45, 0xA1, 0xD4, 0x86, 0x9D, 0x00, 0x8A, 0x08, 0x80, 0xF3, 0x00, 0xC5, 0x85, 0xD3, 0x1F, 0x29,
+    0xD4, 0xFD, 0x0B, 0xC6, 0xCD, 0x86, 0xF6, 0xCD, 0xB7, 0x37, 0x13, 0x9D, 0xBC, 0x7B, 0x52, 0x01,
+    0x8A, 0xEF, 0x9C, 0xFD, 0xB8, 0x0E, 0xCD, 0x9B, 0x6F, 0xEF, 0x26, 0x3A, 0xF9, 0x76, 0xC8, 0x1F,
+    0x7F, 0x02, 0xEA, 0x19, 0x33, 0xC1, 0x7F, 0xCD, 0x3F, 0xC6, 0xE3, 0x0E, 0xA8, 0xE6, 0x34, 0x18,
+    0xBF, 0x55, 0xFB, 0xEF, 0xFD, 0x7E, 0x1A, 0x9B, 0x09, 0xF8, 0x54, 0xDB, 0x41, 0x33, 0xEF, 0x1D,
+    0x97, 0xD6, 0x52, 0xD2, 0x7B, 0x9C, 0x93, 0xFE, 0xE3, 0x71, 0xDC, 0x7D, 0x7A, 0x0F, 0x1A, 0x49,
+    0x5D, 0xFD, 0xDE, 0xC5, 0x2F, 0xAB, 0x58, 0xA1, 0xDC, 0x1E, 0x02, 0xCA, 0xB9, 0x03, 0x7E, 0x0B,
+    0x80, 0xF3, 0xE9, 0xD7, 0x96, 0x52, 0x92, 0xB4, 0xD9, 0xF4, 0xC7, 0x49, 0x92, 0x06, 0x20, 0x0F,
+    0x13, 0x7F, 0x74, 0xE6, 0x82, 0x9C, 0x3F, 0x99, 0x89, 0x3A, 0x02, 0xB8, 0x00, 0x70, 0x4F, 0xF7,
+    0xAB, 0xEE, 0xE0, 0xE2, 0xC5, 0x67, 0xA8, 0xA4, 0x1D, 0x46, 0xC9, 0x63, 0xA5, 0x15, 0x04, 0xD0,
+    0x4E, 0x80, 0x89, 0x27, 0xBF, 0x5A, 0xED, 0xD7, 0x3C, 0x8C, 0x8A, 0x60, 0xA5, 0x81, 0x42, 0x5A,
+    0xA0, 0x9D, 0x01, 0xB3, 0x41, 0xF2, 0x13, 0xD4, 0xDB, 0xC5, 0x0B, 0x20, 0x69, 0xC2, 0x4A, 0x1B,
+    0x85, 0x24, 0x8F, 0x93, 0x22, 0x46, 0x92, 0x3F, 0xCE, 0x7B, 0xAF, 0xA4, 0xA1, 0x92, 0x24, 0x7A,
+    0x49, 0xB1, 0xD2, 0x5F, 0x9E, 0x3F, 0x0C, 0x2A, 0x9D, 0xB4, 0x99, 0xC9, 0xCE, 0x26, 0xBF, 0x61,
+    0xA5, 0x0E, 0x7A, 0xA9, 0xA3, 0x94, 0x04, 0x76, 0x33, 0x1B, 0xF4, 0xDE, 0xAC, 0x94, 0x3B, 0x76,
+    0xC6, 0x06, 0x5C, 0x87, 0xF3, 0x65, 0xA4, 0xD8, 0x69, 0x67, 0xEA, 0xA5, 0x51, 0x87, 0xF3, 0xE3,
+    0x4A, 0x21, 0xA3, 0x81, 0x73, 0xCF, 0xDF, 0x99, 0xED, 0xD3, 0xCC, 0x24, 0xB7, 0x56, 0x2E, 0x40,
+    0xE3, 0x81, 0xF8, 0xD1, 0x2B, 0x5A, 0x9A, 0x4B, 0x49, 0x83, 0x95, 0x36, 0xDC, 0x5F, 0x5E, 0x3C,
+    0x5F, 0xEE, 0x80, 0x5D, 0xF2, 0xC0, 0x14, 0x02, 0xEA, 0x15, 0x70, 0x13, 0x14, 0xEA, 0xF2, 0xD0,
+    0xBB, 0x00, 0x68, 0x80, 0x6A, 0x03, 0xDA, 0x00, 0xC8, 0x43, 0x25, 0xA0, 0x5D, 0x81, 0xC7, 0x87,
+    0x33, 0x67, 0xB9, 0xB4, 0x03, 0xBD, 0x36, 0x68, 0xA5, 0x40, 0xAD, 0x87, 0x35, 0x14, 0xEA, 0x4C,
+    0xC4, 0x4D, 0xB4, 0x53, 0xBD, 0x52, 0x6C, 0x69, 0x5E, 0x9A, 0x63, 0x2C, 0x07, 0x9C, 0xB4, 0x90,
+    0x3C, 0xEF, 0x38, 0x00, 0xF5, 0x4E, 0x23, 0x24, 0x69, 0xAE, 0x25, 0x45, 0x46, 0x49, 0x9D, 0x91,
+    0x34, 0xD3, 0x48, 0x0B, 0xDC, 0xA7, 0x37, 0x4E, 0x4E, 0x59, 0x8E, 0xEF, 0x41, 0x9D, 0x67, 0x6A,
+    0xC6, 0xEA, 0xCD, 0x40, 0xB5, 0x03, 0x66, 0x3F, 0x31, 0xA2, 0xDE, 0x03, 0xED, 0x06, 0x54, 0xDA,
+    0x01, 0xE5, 0xE9, 0x9F, 0xA0, 0x57, 0x04, 0x2E, 0x69, 0x20, 0x85, 0x09, 0x6C, 0x64, 0xA1, 0xDE,
+    0xD1, 0x1B, 0x8D, 0x3A, 0x49, 0x1A, 0x24, 0x69, 0x68, 0x25, 0x75, 0x5C, 0xD2, 0x1B, 0x40, 0xF5,
+    0x1F, 0xA9, 0x22, 0xF5, 0x8A, 0x5D, 0xB0, 0x81, 0x26, 0xD0, 0xCE, 0xB4, 0x13, 0xCE, 0xE3, 0x3C,
+    0xFD, 0xC0, 0xD8, 0x21, 0x0A, 0x51, 0x0A, 0xB3, 0x63, 0x36, 0xAA, 0x88, 0x8D, 0xD8, 0x48, 0xB3,
+    0xD2, 0xAE, 0xFC, 0xE1, 0x02, 0x55, 0xE8, 0x31, 0xD1, 0xF9, 0x62, 0x6F, 0x66, 0xF4, 0xF4, 0x8A,
+    0x7B, 0x6D, 0xFB, 0xF0, 0xB4, 0x15, 0xEF, 0xE7, 0xCB, 0x6F, 0xE7, 0x34, 0x59, 0x26, 0xE6, 0x9B,
+    0x1A, 0x87, 0x64, 0xDC, 0x36, 0xE4, 0x37, 0xF7, 0x6C, 0x67, 0xCE, 0x43, 0x13, 0xD2, 0xF4, 0x99,
+    0x1D, 0x50, 0x97, 0xA3, 0x5F, 0x00, 0x1B, 0xA1, 0xDA, 0xA1, 0xD4, 0x00, 0xD7, 0xD3, 0xCA, 0x4B,
+    0xB3, 0x8A, 0x06, 0xA0, 0x3A, 0xB3, 0xDC, 0xD4, 0x9D, 0xAE, 0xBF, 0x99, 0x6C, 0x14, 0xB7, 0xBF,
+    0x71, 0x66, 0x85, 0x4E, 0x27, 0x6F, 0xD8, 0xF5, 0xE4, 0x8D, 0xF2, 0xCC, 0x1B, 0xBD, 0x07, 0x8C,
+    0xC0, 0xFC, 0xAB, 0x71, 0x81, 0x56, 0xF2, 0x20, 0x6D, 0x50, 0x49, 0x33, 0x38, 0x6D, 0xC0, 0x57,
+    0xD4, 0xDD, 0x6E, 0xB5, 0x80, 0x91, 0x62, 0x5A, 0x39, 0x01, 0x70, 0x9D, 0xEB, 0xA0, 0x88, 0x44,
+    0xA0, 0x9E, 0x4D, 0x00, 0x1C, 0xCD, 0x00, 0x45, 0xE4, 0x85, 0xF4, 0x9E, 0xDE, 0x03, 0xD7, 0x35,
+    0x12, 0x45, 0x64, 0xD4, 0x4E, 0x3D, 0x9B, 0xC5, 0x44, 0x5C, 0x67, 0xBD, 0x0D, 0x45, 0xA4, 0xC7,
+    0x79, 0x3B, 0x97, 0xAB, 0xD9, 0x70, 0x9D, 0xFD, 0xB9, 0x42, 0x15, 0xE9, 0xA5, 0x61, 0x9C, 0x4B,
+    0x69, 0x35, 0xC2, 0x6A, 0xA7, 0xB9, 0x3D, 0x4C, 0xDE, 0xD1, 0x9D, 0xF1, 0xE7, 0xAD, 0x27, 0x82,
+    0x59, 0xB1, 0x03, 0xB8, 0xAE, 0x5C, 0xA0, 0x0A, 0x38, 0x60, 0xC4, 0x04, 0xB0, 0x33, 0x57, 0x00,
+    0x49, 0x21, 0xF9, 0xC8, 0xBD, 0x4B, 0x1E, 0x10, 0xE7, 0x4B, 0x69, 0x35, 0x0B, 0xAE, 0x73, 0xBE,
+    0xC7, 0x84, 0x32, 0xD6, 0x81, 0x1E, 0xE7, 0x77, 0xEA, 0xB9, 0x5E, 0xED, 0x84, 0x9E, 0x53, 0x11,
+    0xB1, 0xD2, 0xEC, 0x86, 0x22, 0x7F, 0x59, 0x2B, 0xF7, 0xE7, 0xE9, 0x92, 0xB4, 0xBB, 0xC3, 0x8B,
+    0xC6, 0x5E, 0x52, 0xBC, 0xF2, 0x9C, 0x9E, 0x5B, 0x31, 0x3A, 0xEC, 0xBE, 0xDA, 0x8E, 0x99, 0xB1,
+    0x11, 0xB0, 0xBB, 0x06, 0x1A, 0x29, 0xE0, 0xA4, 0x15, 0xB7, 0x3F, 0x1A, 0xE9, 0x43, 0x19, 0x19,
+    0xA7, 0x72, 0x45, 0xDE, 0xAC, 0xC8, 0x9B, 0xA5, 0xD0, 0x50, 0x85, 0x52, 0x9D, 0x0D, 0x26, 0x3D,
+    0xD1, 0xCC, 0xB5, 0x70, 0x13, 0x7F, 0xCA, 0xDD, 0x67, 0x22, 0x66, 0x0B, 0x50, 0xAC, 0x07, 0xB0,
+    0x80, 0x0F, 0x58, 0x6E, 0x13, 0xDA, 0x15, 0xC6, 0x87, 0x35, 0x60, 0x62, 0x13, 0xA1, 0x99, 0xE5,
+    0x41, 0x5F, 0x8C, 0x60, 0xA2, 0x3C, 0xB4, 0xAF, 0x6F, 0x80, 0xC6, 0xE9, 0x58, 0x92, 0x4E, 0x33,
+    0xA0, 0x1D, 0xA8, 0xD3, 0x34, 0x6B, 0x80, 0x42, 0x1A, 0xA0, 0x96, 0x3A, 0x70, 0x52, 0x47, 0x21,
+    0x27, 0xB0, 0xB1, 0x17, 0xB8, 0x59, 0xA2, 0xD4, 0xC3, 0xDA, 0xB1, 0xD1, 0x68, 0x07, 0xB8, 0x70,
+    0xEA, 0x79, 0x93, 0x29, 0x27, 0xEB, 0xB4, 0x1F, 0x70, 0x8A, 0x4A, 0x38, 0x0C, 0xBB, 0xD2, 0x4E,
+    0x68, 0x42, 0xD4, 0xA2, 0x8A, 0x8C, 0x91, 0x76, 0xAE, 0x34, 0x23, 0x9C, 0x3A, 0x13, 0x8D, 0x22,
+    0xCD, 0xEC, 0x14, 0x18, 0x3F, 0xBF, 0x6B, 0x30, 0xB1, 0x7D, 0x73, 0xA3, 0x79, 0x5B, 0x2E, 0x30,
+    0x3E, 0xFD, 0xB6, 0xBC, 0xD9, 0xF4, 0xC5, 0x1D, 0xAB, 0xD5, 0x05, 0x46, 0x7D, 0x5D, 0xDE, 0x28,
+    0xDA, 0x1D, 0x2B, 0xDF, 0x2F, 0xF4, 0x5B, 0x29, 0x5F, 0x6A, 0xB6, 0xC2, 0x8A, 0x7E, 0x05, 0x1C,
+    0x2D, 0xD8, 0x5D, 0x1E, 0x93, 0xDD, 0xCF, 0x04, 0xA5, 0xBA, 0x8F, 0x89, 0xCE, 0x26, 0x52, 0x05,
+    0xC6, 0xCE, 0xAC, 0x34, 0x73, 0x19, 0x31, 0xB1, 0xD8, 0x41, 0x9D, 0xC0, 0xCD, 0x7D, 0x47, 0x1D,
+    0x9D, 0xA7, 0xD0, 0x25, 0x9F, 0x07, 0xD1, 0x2A, 0x40, 0xA9, 0x05, 0xE8, 0x23, 0x60, 0xB7, 0xC3,
+    0x28, 0xD2, 0x6D, 0xA7, 0x71, 0xF5, 0xF9, 0xDC, 0x6D, 0x3A, 0x64, 0x06, 0xA3, 0xE1, 0x18, 0x40,
+    0x0E, 0x40, 0xD4, 0x7A, 0x13, 0xB1, 0xA1, 0xD8, 0x31, 0x2B, 0x63, 0x57, 0x6C, 0x38, 0x8F, 0xB0,
+    0x21, 0x81, 0xB5, 0x66, 0x2E, 0x37, 0xEA, 0x05, 0x61, 0x62, 0xFA, 0xA4, 0x99, 0xE9, 0x87, 0x7A,
+    0xA1, 0x9D, 0x4E, 0x0E, 0x8C, 0xF9, 0x40, 0x49, 0x58, 0x49, 0xBE, 0x92, 0x34, 0x17, 0x92, 0x96,
+    0x1C, 0xFC, 0xAB, 0x00, 0x94, 0x11, 0x60, 0x07, 0xB8, 0x27, 0x9D, 0xFF, 0x1E, 0xA0, 0xDC, 0x4E,
+    0x82, 0xD4, 0x04, 0x85, 0x86, 0x5F, 0x87, 0x65, 0x8A, 0x71, 0x00, 0x09, 0xDC, 0xAD, 0x88, 0x0D,
+    0xD5, 0x54, 0xC6, 0x3B, 0x5E, 0xC4, 0xA5, 0x58, 0xB2, 0x23, 0x69, 0x6E, 0xF6, 0x3F, 0x3F, 0x5F,
+    0xC6, 0x8C, 0x0D, 0x4A, 0x5D, 0x6D, 0xBA, 0x46, 0x0A, 0x48, 0xC2, 0x48, 0x33, 0xE7, 0x74, 0x35,
+    0x5F, 0x49, 0xF3, 0x52, 0xC7, 0x57, 0x14, 0x13, 0x52, 0xD0, 0x2F, 0xBB, 0xF4, 0xAE, 0x7D, 0x7D,
+    0xA3, 0x94, 0x56, 0x9C, 0xE4, 0x2B, 0x7D, 0x3E, 0x32, 0x7A, 0xEB, 0x6D, 0x20, 0x16, 0x3B, 0x8D,
+    0x6F, 0xA7, 0x72, 0x35, 0x11, 0xD7, 0xF5, 0xBE, 0x5A, 0xEA, 0x95, 0x11, 0x0D, 0x36, 0x34, 0x4B,
+    0xB9, 0x97, 0xEA, 0xDC, 0xEC, 0xC2, 0xEF, 0x6D, 0x7C, 0xA5, 0xD6, 0x04, 0xDA, 0xA0, 0xD1, 0x44,
+    0xA9, 0x08, 0xE7, 0x6E, 0x37, 0x82, 0x08, 0xDC, 0x00, 0xAE, 0x00, 0x3D, 0xE0, 0xD2, 0xA7, 0x46,
+    0x8A, 0x64, 0xB8, 0xE1, 0x3F, 0x32, 0x26, 0xB8, 0x09, 0x9A, 0x25, 0xBB, 0x7F, 0xE5, 0xF9, 0xEE,
+    0x27, 0x68, 0x6F, 0xF3, 0x66, 0xA5, 0x06, 0x1A, 0x05, 0xFA, 0x87, 0x63, 0x11, 0xB9, 0x61, 0x02,
+    0x77, 0x57, 0x12, 0xB5, 0x76, 0xAC, 0x4F, 0xCB, 0xDA, 0xBE, 0xF1, 0x58, 0xB0, 0xD2, 0x6C, 0xD3,
+    0x9C, 0x51, 0x8C, 0xCB, 0xD9, 0xE3, 0xDF, 0xA0, 0x51, 0xC4, 0x7D, 0xFB, 0xFB, 0x5C, 0x01, 0x9E,
+    0x00, 0xFA, 0x0E, 0xDC, 0x0E, 0x56, 0x13, 0x85, 0x42, 0xC2, 0x13, 0x75, 0x34, 0x53, 0xB3, 0x5A,
+    0x29, 0x38, 0x69, 0xEE, 0xA5, 0xEE, 0xDC, 0x49, 0xF4, 0xBE, 0x40, 0xB9, 0x61, 0x36, 0xEA, 0x14,
+    0x1B, 0xCF, 0x2C, 0xD2, 0x7F, 0x07, 0x1B, 0x44, 0x8A, 0x48, 0xB9, 0x62, 0x16, 0x4C, 0xA0, 0x0A,
+    0xD4, 0x33, 0x76, 0xA6, 0x99, 0x68, 0x7D, 0x8E, 0xB6, 0xA3, 0xE7, 0xD2, 0x40, 0xB9, 0xB4, 0x0F,
+    0x6F, 0xCD, 0x24, 0x1B, 0xDC, 0x2B, 0xB1, 0xFD, 0x85, 0xB8, 0xED, 0x97, 0x5C, 0x87, 0xF5, 0x54,
+    0x81, 0x72, 0x85, 0x0D, 0x1C, 0x34, 0x9E, 0x7A, 0xC6, 0xAC, 0x14, 0x1B, 0x8C, 0xE0, 0x3C, 0x36,
+    0x50, 0x47, 0x8A, 0x17, 0x01, 0x78, 0x21, 0x39, 0xB5, 0x32, 0x1E, 0xDE, 0xE4, 0xF6, 0x87, 0xF5,
+    0x09, 0x6C, 0xB9, 0x21, 0xCD, 0x4C, 0x0F, 0xBC, 0x98, 0x0E, 0x29, 0x22, 0x94, 0x6B, 0xCA, 0xB1,
+    0xAA, 0x00, 0xF5, 0x9C, 0xAC, 0xFC, 0xF8, 0xBA, 0x3A, 0x1A, 0x41, 0xBB, 0x83, 0x8B, 0xD0, 0xCF,
+    0xC7, 0x4F, 0x2A, 0x50, 0x6A, 0x03, 0x67, 0x3C, 0xC6, 0x3F, 0x00, 0x97, 0xAB, 0x81, 0x7A, 0xD0,
+    0x42, 0xB0, 0x9A, 0x9A, 0x22, 0x3C, 0x54, 0xCE, 0x9F, 0x35, 0xF3, 0x83, 0x66, 0xBA, 0x52, 0xF9,
+    0x87, 0x2E, 0xDD, 0x5C, 0x2B, 0xAD, 0x3D, 0xE3, 0x56, 0x9D, 0xA6, 0x2A, 0x77, 0x01, 0xB6, 0xFB,
+    0x67, 0x10, 0x8C, 0xA7, 0xE1, 0x6B, 0x94, 0x73, 0xDD, 0xF1, 0x10, 0x0B, 0x46, 0x7A, 0x8F, 0x5E,
+    0x8A, 0xF5, 0xF0, 0xD9, 0x6A, 0x5A, 0xCC, 0xF4, 0x60, 0xC3, 0x03, 0xF5, 0xCD, 0x50, 0xBD, 0x1E,
+    0x1F, 0x42, 0x7A, 0x64, 0xB2, 0x1A, 0x2E, 0xA7, 0x1F, 0xF9, 0x47, 0x31, 0xFC, 0xF0, 0x21, 0xC3,
+    0x9F, 0x5C, 0xA8, 0x36, 0xBE, 0x92, 0x3D, 0xF4, 0x9C, 0x4D, 0xBC, 0xED, 0xF2, 0xF2, 0x3F, 0x1B,
+    0x41, 0xFA, 0x7A, 0xC1, 0xFE, 0x68, 0xA3, 0x88, 0x63, 0x87, 0x7B, 0x6C, 0xC2, 0xDC, 0x5A, 0x60,
+    0xDC, 0xC0, 0xAA, 0xA3, 0xD4, 0x94, 0x86, 0xAE, 0x52, 0x00, 0xC9, 0xD3, 0xBC, 0x2E, 0xCA, 0xE8,
+    0x22, 0x29, 0x81, 0xE2, 0x9E, 0x23, 0x06, 0x34, 0x01, 0x18, 0xFD, 0x81, 0x43, 0x3E, 0x38, 0x89,
+    0x53, 0xB1, 0x13, 0xE9, 0xA7, 0xC6, 0x37, 0xB1, 0x5C, 0x2B, 0x79, 0x37, 0x68, 0xAD, 0x16, 0xA7,
+    0x61, 0xB4, 0xEF, 0x2E, 0xF6, 0x9D, 0xAD, 0x67, 0xD7, 0x17, 0x43, 0xA3, 0x79, 0x2F, 0xB5, 0x36,
+    0x93, 0xDB, 0x4D, 0x34, 0xF2, 0xCE, 0xF7, 0xA1, 0x5A, 0xEB, 0x98, 0x50, 0xFD, 0x59, 0xA3, 0x68,
+    0x3C, 0xF4, 0x19, 0x61, 0x06, 0x28, 0x52, 0x4C, 0x7A, 0xBC, 0xFB, 0x4D, 0x92, 0x30, 0xE7, 0x11,
+    0x88, 0x3A, 0x60, 0x36, 0xDC, 0x40, 0xBD, 0x96, 0x11, 0x9A, 0xD0, 0x4C, 0xE0, 0x26, 0x01, 0xFA,
+    0xC6, 0x02, 0xA5, 0xDC, 0x00, 0x55, 0x46, 0x44, 0x33, 0xE0, 0x04, 0x30, 0x2E, 0x64, 0xBF, 0x9E,
+    0x2D, 0xB6, 0x9D, 0x0F, 0x00, 0x76, 0xC7, 0xB8, 0x00, 0xD2, 0x00, 0x46, 0x11, 0x68, 0x34, 0x00,
+    0x63, 0x32, 0xBD, 0x1B, 0xDC, 0x20, 0x12, 0x8B, 0x95, 0xB5, 0x5C, 0x8A, 0xC5, 0x84, 0x32, 0x98,
+    0x60, 0x42, 0x35, 0x9B, 0xB9, 0x9E, 0xAA, 0xC9, 0xFA, 0xF4, 0x5F, 0xD3, 0x35, 0x43, 0x2B, 0x75,
+    0x4E, 0xC2, 0x49, 0x70, 0x39, 0x7B, 0xA8, 0x35, 0x27, 0x79, 0x9F, 0x1D, 0xC0, 0x79, 0x5C, 0x4A,
+    0xFB, 0xA7, 0x5E, 0xF2, 0xEC, 0x50, 0x1C, 0xCB, 0x48, 0xCF, 0x62, 0xA4, 0xA9, 0x92, 0x42, 0xBD,
+    0x95, 0xAB, 0x5D, 0x8A, 0xD5, 0x86, 0x72, 0xB1, 0xBF, 0xFC, 0x72, 0x68, 0xA4, 0xD0, 0x64, 0x4F,
+    0x53, 0x4B, 0x43, 0xA9, 0xF7, 0xD2, 0xA0, 0x7C, 0xB2, 0x4B, 0x8B, 0xA6, 0xEF, 0x52, 0x52, 0xB5,
+    0x83, 0x93, 0x86, 0x5E, 0xEA, 0x7E, 0x6F, 0xBB, 0x88, 0x89, 0x60, 0xA4, 0xAE, 0x92, 0xE6, 0x5A,
+    0xD7, 0x83, 0x5D, 0xCC, 0x62, 0x83, 0x09, 0xCD, 0x5C, 0x87, 0x56, 0x0A, 0xAD, 0x34, 0xB5, 0x92,
+    0x6F, 0xA4, 0xAE, 0xD2, 0xED, 0x20, 0xA5, 0xD2, 0x91, 0xD3, 0x49, 0x20, 0x49, 0x31, 0xBD, 0x37,
+    0x53, 0x0B, 0xB7, 0x81, 0xDD, 0x8D, 0x3C, 0x34, 0xD1, 0xAD, 0x40, 0x7B, 0x4B, 0x1D, 0xE0, 0xB4,
+    0xA4, 0x83, 0x3D, 0x39, 0xD9, 0xA4, 0x96, 0x46, 0x0F, 0xFD, 0x2B, 0xEB, 0x08, 0x26, 0xB6, 0xAF,
+    0x6E, 0xE0, 0x26, 0x99, 0x85, 0x42, 0x66, 0xB5, 0x33, 0x76, 0x69, 0x26, 0x37, 0x30, 0x7A, 0x15,
+    0xA2, 0xDA, 0x4C, 0xAC, 0x22, 0x2E, 0xB8, 0xB9, 0x09, 0x14, 0x1D, 0xD0, 0xC1, 0xFD, 0xD7, 0xAE,
+    0x7D, 0x87, 0x23, 0x38, 0x62, 0x97, 0x66, 0xC6, 0xFE, 0x62, 0x83, 0xE6, 0xAD, 0x29, 0x85, 0x71,
+    0xAB, 0x08, 0xFB, 0xB6, 0x52, 0xBF, 0xF6, 0x93, 0x40, 0xDF, 0x7C, 0xC1, 0x9B, 0x70, 0xA3, 0xA5,
+    0x7D, 0x39, 0xBC, 0x50, 0x6C, 0xED, 0xD7, 0x17, 0xEE, 0x3A, 0x52, 0xD2, 0x67, 0xCC, 0x0A, 0x85,
+    0xA2, 0xD9, 0xC0, 0x68, 0xAF, 0x52, 0xAA, 0x63, 0x57, 0x68, 0x16, 0x69, 0x01, 0x17, 0x7A, 0xCD,
+    0xE0, 0xE6, 0x56, 0x1E, 0xDA, 0xFD, 0xD1, 0x0D, 0xE8, 0xB5, 0xA4, 0xF0, 0xB2, 0x25, 0xA4, 0x2D,
+    0xC0, 0x6D, 0x95, 0x3A, 0x18, 0x67, 0x34, 0x80, 0x3C, 0x1A, 0x28, 0x05, 0x1A, 0x30, 0xE9, 0x4F,
+    0xB5, 0x51, 0xA8, 0xA3, 0x8E, 0x18, 0x81, 0x8D, 0x54, 0x02, 0xBB, 0xD1, 0x6C, 0x60, 0xF5, 0xAF,
+    0x73, 0x9A, 0xA5, 0x05, 0x6A, 0x49, 0x73, 0x1A, 0x75, 0x4F, 0xCE, 0x7C, 0x61, 0xD4, 0x0A, 0x70,
+    0xDF, 0x7E, 0x66, 0x89, 0x14, 0x2F, 0x12, 0xA1, 0x8F, 0x8D, 0xA7, 0xD1, 0x4F, 0x23, 0x26, 0xF6,
+    0xEA, 0x70, 0x5F, 0xD7, 0x4C, 0xA5, 0x7F, 0xB3, 0x50, 0x4A, 0x03, 0x8C, 0xDA, 0xA0, 0x59, 0x9B,
+    0x80, 0xD9, 0x18, 0xA1, 0x1F, 0xEA, 0x40, 0x1D, 0x18, 0x61, 0xC7, 0x06, 0xEC, 0x5C, 0xEC, 0x24,
+    0xBC, 0xD2, 0x84, 0x26, 0x52, 0x48, 0xEA, 0x52, 0x8A, 0x98, 0xD2, 0xBF, 0x04, 0x18, 0xEB, 0xFD,
+    0x38, 0xED, 0x27, 0x92, 0xEB, 0x99, 0x01, 0xB4, 0x00, 0x68, 0xED, 0x3D, 0x28, 0x36, 0x01, 0x46,
+    0x5F, 0x45, 0xE8, 0xA7, 0x42, 0x1D, 0x6E, 0xC6, 0x4D, 0xB4, 0x01, 0xBB, 0xD2, 0xAC, 0x18, 0x61,
+    0x23, 0xC8, 0xDB, 0x0D, 0x5C, 0xA8, 0x77, 0xB0, 0xB1, 0x12, 0x18, 0x3D, 0xA2, 0x0E, 0xF4, 0x23,
+    0x79, 0x70, 0xEF, 0x69, 0x22, 0x9F, 0xDF, 0xA4, 0x44, 0x66, 0xD4, 0x02, 0xB4, 0x8A, 0x40, 0xAD,
+    0x0D, 0x28, 0x93, 0xC3, 0x18, 0x13, 0x73, 0x71, 0x1B, 0x20, 0x28, 0x22, 0xA0, 0x6F, 0x4E, 0xB8,
+    0xF0, 0x22, 0xF5, 0x5C, 0xCF, 0x45, 0x64, 0xC4, 0x0D, 0x75, 0xA8, 0x03, 0x7D, 0xB1, 0x51, 0x05,
+    0x37, 0xD0, 0x7F, 0x31, 0x50, 0xFD, 0xFD, 0x0E, 0xBD, 0x3C, 0x95, 0x96, 0x14, 0x8F, 0x8D, 0x3C,
+    0xB8, 0x25, 0xE3, 0x01, 0xF8, 0x2E, 0x45, 0xA4, 0x8C, 0xF7, 0x3E, 0xB7, 0x3A, 0x2D, 0x4E, 0x81,
+    0x3A, 0x60, 0xE7, 0x4C, 0xC4, 0xDC, 0x7D, 0xC4, 0x80, 0x22, 0xA6, 0x24, 0xBD, 0xCD, 0x1E, 0x7F,
+    0xC1, 0xFD, 0xE5, 0xC5, 0xF3, 0x29, 0x45, 0x57, 0x97, 0xD1, 0x64, 0x21, 0xA0, 0xDC, 0x0F, 0xF6,
+    0xE4, 0x83, 0x69, 0xC7, 0x4A, 0x02, 0x23, 0x29, 0xC5, 0x74, 0x01, 0xE8, 0xC3, 0xE1, 0x7A, 0xCE,
+    0x32, 0x07, 0x45, 0x4C, 0x39, 0x15, 0x66, 0x45, 0x52, 0x67, 0xA5, 0x50, 0x48, 0xA2, 0x9D, 0xF3,
+    0x4F, 0x3B, 0x9F, 0x21, 0xFD, 0x38, 0x24, 0xD4, 0x53, 0xA8, 0x4B, 0xBF, 0x6B, 0x94, 0x13, 0xD2,
+    0x6A, 0x03, 0xC6, 0xE9, 0x24, 0x0B, 0x91, 0x56, 0x46, 0x69, 0x36, 0x92, 0xBA, 0xE6, 0x97, 0x17,
+    0x2F, 0x30, 0x0E, 0xE9, 0xD7, 0x8C, 0xA4, 0xC5, 0x4A, 0xF2, 0x63, 0x5A, 0x6F, 0x39, 0x3F, 0x2D,
+    0x75, 0x5C, 0xBA, 0x9B, 0xF3, 0x19, 0xEC, 0xC1, 0x82, 0x14, 0x1A, 0xA0, 0xDE, 0x80, 0x7B, 0xCE,
+    0x03, 0x48, 0xBE, 0x51, 0x2C, 0x7F, 0x79, 0xB1, 0x73, 0xE0, 0xB4, 0x57, 0x92, 0xAF, 0x27, 0x88,
+    0x60, 0x3D, 0x45, 0x04, 0x37, 0x60, 0x16, 0xE8, 0xA1, 0x0E, 0xC7, 0x45, 0xB5, 0x52, 0x4C, 0x44,
+    0x52, 0x1A, 0x52, 0x4F, 0xF2, 0x70, 0xF4, 0xC3, 0xC1, 0x13, 0x89, 0x93, 0xC1, 0x55, 0x48, 0x88,
+    0xCF, 0x48, 0xA2, 0xD2, 0xC3, 0xA2, 0x8E, 0xF4, 0x9D, 0x5D, 0xE8, 0x3B, 0x1B, 0xE8, 0x69, 0x66,
+    0x44, 0x3B, 0x95, 0x1B, 0xCE, 0x8F, 0x91, 0xDE, 0x6B, 0x61, 0xF4, 0x9A, 0xB8, 0x3E, 0x3C, 0x9B,
+    0xE3, 0x8A, 0x7C, 0xA3, 0x60, 0x07, 0xCC, 0x44, 0x11, 0x60, 0x5C, 0x71, 0xF2, 0xF6, 0xA5, 0xA5,
+    0xF6, 0x0F, 0x9A, 0xD9, 0xB2, 0x34, 0xFE, 0xB2, 0xF3, 0xAD, 0xCD, 0x28, 0x62, 0x9C, 0x9D, 0x66,
+    0xB7, 0x80, 0xBC, 0x54, 0xAA, 0xC3, 0xE8, 0x11, 0xC5, 0x66, 0x85, 0x6A, 0xB7, 0x7A, 0x55, 0x43,
+    0xCA, 0xBE, 0xD2, 0xA8, 0xBC, 0xAD, 0x55, 0x1E, 0xE8, 0xDF, 0xD4, 0x8F, 0x63, 0x1A, 0x13, 0x8D,
+    0x99, 0x2C, 0x4F, 0xEE, 0xB6, 0x92, 0x94, 0xB9, 0xE3, 0x64, 0xDB, 0xB4, 0x52, 0x8A, 0x3B, 0x07,
+    0xFF, 0xD7, 0x48, 0xEA, 0xF2, 0x31, 0xEA, 0x52, 0xD2, 0x2F, 0x01, 0xB5, 0xDE, 0x94, 0x13, 0xA0,
+    0xCD, 0xAD, 0xA3, 0xA0, 0xD1, 0xA4, 0x49, 0x7B, 0x57, 0x6A, 0xAB, 0x54, 0x4A, 0xF4, 0x9A, 0xDA,
+    0x68, 0x4E, 0x1C, 0xBB, 0x3D, 0xA6, 0xFE, 0xE0, 0xF9, 0x53, 0x8A, 0x0A, 0xD4, 0xD3, 0xD9, 0x38,
+    0x3D, 0x2B, 0xEC, 0x94, 0xD1, 0x2D, 0x23, 0xB8, 0x2F, 0xC6, 0x1E, 0xEC, 0xCF, 0xF6, 0x1E, 0x8A,
+    0x4D, 0xFD, 0x91, 0x68, 0x66, 0x9E, 0x2E, 0x25, 0xA0, 0xF4, 0xD9, 0xDD, 0xAF, 0xE9, 0xBA, 0x3B,
+    0x90, 0xDE, 0x5A, 0x28, 0xF4, 0xF4, 0x4F, 0x45, 0xA9, 0x6F, 0x2C, 0xE3, 0x62, 0xF4, 0xF5, 0x68,
+    0xD3, 0x2D, 0xDA, 0x14, 0x60, 0x06, 0x80, 0x62, 0x82, 0x7B, 0x35, 0xE0, 0xB4, 0xE0, 0x14, 0xF9,
+    0x83, 0x22, 0x26, 0xE8, 0x53, 0x46, 0xB8, 0x6F, 0xA5, 0xD5, 0x8C, 0xDB, 0xC1, 0xA9, 0x4B, 0x18,
+    0xD1, 0x4E, 0xD0, 0x4C, 0x77, 0xD1, 0x4F, 0x0F, 0x7D, 0x59, 0xDE, 0x49, 0x5D, 0xAF, 0x9D, 0x51,
+    0x2B, 0xF7, 0x69, 0xB8, 0x0D, 0x59, 0x16, 0xE7, 0x81, 0x4B, 0x53, 0xA1, 0xB5, 0xE8, 0x1E, 0x80,
+    0x07, 0xB8, 0x63, 0x41, 0x53, 0xA1, 0x09, 0x13, 0x28, 0xC3, 0xEF, 0x3C, 0x36, 0xB7, 0xF2, 0x4E,
+    0x5D, 0x2B, 0xF8, 0x0C, 0xF4, 0x1D, 0xF2, 0xC5, 0x73, 0xBE, 0x54, 0x67, 0x36, 0x60, 0x1C, 0x34,
+    0x61, 0xB6, 0x7A, 0x87, 0x26, 0xF4, 0x33, 0x8C, 0x8F, 0xEE, 0x60, 0xA2, 0x0B, 0xD0, 0xFC, 0x54,
+    0x80, 0xFA, 0x00, 0x66, 0x17, 0xD0, 0x2A, 0x41, 0x88, 0x0E, 0x2A, 0xAD, 0x40, 0x9B, 0x18, 0xB3,
+    0x1D, 0x48, 0x91, 0x35, 0xD1, 0x37, 0x52, 0x84, 0x3A, 0x2A, 0x82, 0xFB, 0x89, 0x22, 0x85, 0x1E,
+    0xD1, 0x4A, 0x1D, 0x6B, 0xAD, 0xDF, 0x75, 0xC1, 0xEA, 0xDD, 0x00, 0xD0, 0x0C, 0x07, 0xC6, 0xCE,
+    0x84, 0xC2, 0x9D, 0x03, 0x6D, 0x15, 0x88, 0xAE, 0xAB, 0x5E, 0x5B, 0x68, 0xDD, 0xC0, 0xFB, 0x91,
+    0x4A, 0x1E, 0x17, 0x41, 0x13, 0x75, 0x42, 0xCB, 0x85, 0x22, 0xF5, 0x5B, 0x2B, 0xAE, 0x5D, 0x8A,
+    0xE8, 0x16, 0x3B, 0x8F, 0xB7, 0x7C, 0xA2, 0xFA, 0x03, 0x94, 0x03, 0x45, 0x84, 0x36, 0x50, 0x07,
+    0x8C, 0xC0, 0x0D, 0xB4, 0x0B, 0xC5, 0x46, 0xA9, 0x0E, 0x1B, 0x68, 0x17, 0x70, 0xD7, 0x4B, 0x0D,
+    0x94, 0x5B, 0x6C, 0x57, 0xB0, 0xEF, 0xFC, 0x42, 0x1E, 0xDC, 0xD3, 0x6F, 0xC5, 0x64, 0x7E, 0x9E,
+    0x44, 0xF7, 0x42, 0x2F, 0x45, 0x28, 0xF7, 0x5E, 0x2B, 0xD8, 0x65, 0xD3, 0x02, 0xFD, 0x2B, 0xEF,
+    0x28, 0x60, 0xF6, 0x7B, 0x1F, 0x51, 0xC0, 0x2E, 0xD4, 0x9A, 0xE9, 0x3D, 0x56, 0x93, 0xD9, 0xA1,
+    0x91, 0xBF, 0xE3, 0x3C, 0xDC, 0x73, 0xB1, 0xE3, 0x5E, 0xCE, 0x3D, 0xC3, 0x8A, 0xA3, 0xF2, 0x66,
+    0xA1, 0xBD, 0xCB, 0x75, 0xDC, 0x7A, 0x79, 0xA5, 0xFA, 0xB1, 0x1B, 0x68, 0xC7, 0x98, 0x40, 0x6B,
+    0xF5, 0x96, 0x06, 0xDA, 0x87, 0xD4, 0x11, 0x7F, 0x21, 0xAA, 0xD9, 0xEC, 0x38, 0xEA, 0x8D, 0x98,
+    0x3C, 0x4E, 0xEF, 0xC7, 0x99, 0x72, 0xAF, 0x76, 0x18, 0xD5, 0x07, 0x0A, 0xBD, 0x2E, 0x30, 0x9B,
+    0x0B, 0x60, 0xDF, 0x11, 0x30, 0x5E, 0x5F, 0xC0, 0xEC, 0xEA, 0xA0, 0xC9, 0x86, 0x39, 0x80, 0xC9,
+    0xB3, 0xE3, 0x4F, 0x67, 0x67, 0x07, 0xDA, 0x3C, 0x3B, 0x1B, 0x54, 0x69, 0x76, 0xDE, 0x56, 0x04,
+    0x3D, 0xA5, 0x48, 0xBD, 0x55, 0x5A, 0x71, 0xC1, 0x6A, 0x85, 0x62, 0xA3, 0x48, 0xBE, 0x37, 0x94,
+    0xD2, 0x4C, 0x9D, 0xB8, 0x2C, 0xEC, 0x94, 0xFC, 0xB3, 0xFB, 0xC6, 0x8A, 0x6B, 0x67, 0xC6, 0x71,
+    0x40, 0x1B, 0x85, 0x16, 0x4A, 0x4D, 0x18, 0x05, 0x2A, 0xC5, 0x94, 0x3F, 0xDE, 0xD2, 0xD0, 0xBC,
+    0xA3, 0xB9, 0xFD, 0x6B, 0x2D, 0x6E, 0x1A, 0xB7, 0x5A, 0xF2, 0xE3, 0xEC, 0xB4, 0x55, 0x3B, 0x52,
+    0xE8, 0x03, 0xF4, 0x4F, 0xFD, 0x86, 0x37, 0x13, 0xFF, 0x73, 0x6E, 0xC6, 0xEA, 0x66, 0x6C, 0xF4,
+    0xCD, 0x40, 0xDB, 0x78, 0x9C, 0xEB, 0x78, 0x62, 0x03, 0xAD, 0xA0, 0x99, 0x42, 0x3E, 0x91, 0x91,
+    0x1A, 0xA8, 0x35, 0x63, 0xDF, 0x5A, 0x68, 0x7E, 0x18, 0x69, 0xBF, 0x21, 0xDC, 0x23, 0xF2, 0xD4,
+    0x2B, 0x26, 0x62, 0x17, 0xAA, 0x88, 0x4D, 0xB1, 0x3E, 0x60, 0x17, 0x5C, 0xA0, 0x09, 0xB8, 0x99,
+    0x36, 0xD0, 0x4F, 0xB8, 0xC0, 0xE8, 0xE9, 0x67, 0xE4, 0x19, 0xA7, 0x42, 0x03, 0xF2, 0xA5, 0xBA,
+    0x42, 0xDE, 0x48, 0xD2, 0x60, 0xA4, 0x04, 0x50, 0x33, 0xFB, 0x91, 0x9E, 0x77, 0x9A, 0xED, 0xE2,
+    0xA5, 0x8D, 0x76, 0xA5, 0xD9, 0x70, 0x2B, 0xED, 0x76, 0xBE, 0x5F, 0x70, 0x0A, 0x63, 0xC0, 0x29,
+    0x40, 0x4A, 0x1C, 0x0F, 0x9F, 0x66, 0x8F, 0x8A, 0xC3, 0x15, 0x1C, 0x6D, 0x67, 0xBD, 0xF5, 0xD5,
+    0x6C, 0x42, 0xB9, 0x96, 0x2B, 0x1B, 0x1B, 0x3D, 0xAE, 0x6B, 0x7D, 0xE3, 0xED, 0x5C, 0xBF, 0xFF,
+    0xDC, 0x62, 0xA4, 0x58, 0x48, 0x62, 0x94, 0x06, 0xE7, 0x9B, 0xD9, 0xCE, 0xF5, 0xFB, 0x8F, 0x2E,
+    0x46, 0x53, 0xAE, 0x94, 0x5D, 0x06, 0xB3, 0x65, 0x8B, 0xEF, 0x73, 0x5D, 0xA3, 0x3E, 0xE8, 0x78,
+    0x0D, 0x89, 0xAA, 0xB5, 0x4B, 0x8A, 0xE4, 0x85, 0x32, 0x37, 0xEC, 0x42, 0x8A, 0xE5, 0x66, 0xCF,
+    0xF9, 0x54, 0xBA, 0x7D, 0xA8, 0xB7, 0x83, 0x5F, 0xF2, 0x29, 0xFC, 0x36, 0xDB, 0xC5, 0xC7, 0xE2,
+    0xE1, 0xD2, 0x3D, 0xE0, 0x24, 0xAD, 0x09, 0x5F, 0x1E, 0x0E, 0x55, 0x5A, 0x32, 0xD2, 0x4C, 0xF1,
+    0x6E, 0x62, 0x0C, 0x40, 0x13, 0xB1, 0x3B, 0x50, 0xCA, 0x17, 0x9A, 0x00, 0xB7, 0xD2, 0xE6, 0x12,
+    0x5A, 0x22, 0x1C, 0x68, 0xB5, 0xF2, 0x22, 0x0E, 0xD8, 0xE8, 0x81, 0xC8, 0x8B, 0x50, 0x44, 0x36,
+    0x28, 0x57, 0x22, 0x98, 0xA5, 0x88, 0x50, 0x25, 0x5F, 0x24, 0xAD, 0x60, 0x13, 0xD9, 0xF4, 0xFE,
+    0xF5, 0x00, 0xCD, 0x64, 0x03, 0xB4, 0xDE, 0xCE, 0xE0, 0x7C, 0x3B, 0xE5, 0xAB, 0x98, 0x93, 0x6B,
+    0xDF, 0x73, 0x44, 0x9A, 0x4F, 0x83, 0x98, 0xF3, 0xA5, 0x3C, 0x98, 0x88, 0x8B, 0x40, 0x3F, 0x18,
+    0x0D, 0x50, 0x2F, 0xF4, 0x0B, 0x24, 0xE6, 0x10, 0x6C, 0x40, 0x52, 0x57, 0x28, 0x79, 0x90, 0x76,
+    0x2E, 0x25, 0x05, 0xB3, 0xE1, 0xD4, 0x69, 0x70, 0xDE, 0xC8, 0x9B, 0xB5, 0x8A, 0xF4, 0x2B, 0x6E,
+    0x18, 0x87, 0x5A, 0x98, 0xC5, 0x2E, 0x28, 0x30, 0x22, 0xEC, 0x4E, 0x13, 0x9A, 0x50, 0x68, 0xEA,
+    0xB7, 0x72, 0xA7, 0x8D, 0xB5, 0x06, 0x37, 0x1B, 0xF9, 0x71, 0x2E, 0xBF, 0xCB, 0xFD, 0x37, 0xEE,
+    0xBC, 0x0A, 0xF7, 0x5F, 0xBB, 0xF6, 0x0C, 0x8C, 0x4A, 0x59, 0xAF, 0x66, 0xD8, 0xD1, 0x44, 0xB9,
+    0x21, 0x8F, 0x89, 0x85, 0x3C, 0x26, 0x96, 0x1A, 0xA8, 0x56, 0xA3, 0x8E, 0x7A, 0x31, 0x02, 0x1B,
+    0x2A, 0x41, 0x13, 0xEA, 0x1D, 0xDA, 0xD9, 0x6A, 0xEF, 0x9C, 0x6F, 0xA4, 0xC9, 0xF9, 0x56, 0x0A,
+    0xE0, 0xDE, 0x7B, 0x6C, 0x01, 0x37, 0x99, 0x35, 0x97, 0xA0, 0x12, 0xD1, 0x88, 0xA8, 0x16, 0x12,
+    0xD3, 0x57, 0xEE, 0xE5, 0x38, 0x63, 0xB6, 0x4A, 0x1E, 0x13, 0x6B, 0x75, 0x54, 0xD1, 0xAE, 0x1F,
+    0x4C, 0x5F, 0x2F, 0x79, 0x80, 0x31, 0xD5, 0x02, 0xF4, 0xBF, 0x68, 0xC2, 0xEA, 0x96, 0xD4, 0x19,
+    0xFD, 0xAD, 0x14, 0xD1, 0xEC, 0xE6, 0xD6, 0x37, 0x4B, 0xBD, 0x14, 0xD1, 0xEC, 0xC5, 0x4E, 0xEB,
+    0x7B, 0xDF, 0x7A, 0xB3, 0xD4, 0x8B, 0x59, 0x11, 0xA2, 0xEF, 0xDC, 0x64, 0x43, 0x1D, 0xEC, 0x5A,
+    0x08, 0x19, 0x75, 0x4D, 0xB0, 0xEF, 0x6B, 0x2B, 0xD4, 0x8D, 0xD2, 0x6C, 0xF7, 0xC7, 0xA4, 0x54,
+    0x14, 0x52, 0xA8, 0x24, 0x69, 0xA5, 0x49, 0x36, 0x74, 0xDF, 0xFE, 0xF0, 0xE9, 0x65, 0xB4, 0x1E,
+    0xE8, 0xC3, 0x3D, 0x30, 0xBE, 0xA7, 0xC0, 0xF8, 0xA6, 0x44, 0xFF, 0xE4, 0x66, 0xBD, 0x1B, 0x62,
+    0x19, 0x1A, 0x7F, 0x83, 0xD5, 0x4E, 0x8E, 0x68, 0x42, 0x33, 0x8C, 0x45, 0xAC, 0xA7, 0x91, 0xBE,
+    0x5C, 0xC6, 0xAB, 0xAD, 0x1F, 0xB5, 0x56, 0xB1, 0xCD, 0xE7, 0xF0, 0xAD, 0xA4, 0xA9, 0x90, 0xF6,
+    0xEE, 0xB6, 0x9A, 0x2D, 0xE7, 0x94, 0xAA, 0x4D, 0x73, 0x4A, 0x95, 0x52, 0x5D, 0xB0, 0xD7, 0xAD,
+    0x05, 0x9B, 0x1C, 0x96, 0x3F, 0x20, 0xAE, 0x4D, 0x6B, 0x67, 0x20, 0x41, 0xEF, 0x54, 0x31, 0x4B,
+    0x36, 0x6E, 0x93, 0xC5, 0xA7, 0x97, 0xD3, 0xEF, 0x4E, 0x48, 0xDA, 0x12, 0x37, 0xCA, 0x78, 0x5A,
+    0x17, 0x6B, 0xA5, 0x15, 0x46, 0xA9, 0xCB, 0xC0, 0xFD, 0xF1, 0x70, 0x92, 0xB1, 0x9C, 0xE6, 0x06,
+    0xF7, 0x6D, 0x34, 0x0A, 0x95, 0x76, 0x74, 0xF5, 0xBC, 0xF3, 0x54, 0x0B, 0x8C, 0x60, 0x67, 0x8A,
+    0x0D, 0xDA, 0x89, 0x52, 0x25, 0xCD, 0x1E, 0x49, 0x25, 0x79, 0xFE, 0x4C, 0x43, 0x9B, 0x2A, 0x05,
+    0xF7, 0x77, 0x1F, 0x5D, 0x4B, 0xB8, 0xF8, 0xA5, 0xFD, 0xE2, 0x85, 0x04, 0xBA, 0x4D, 0x3C, 0xC1,
+    0xF3, 0xEB, 0x41, 0xC4, 0x36, 0xE1, 0x04, 0xCF, 0xCF, 0xC9, 0x09, 0x24, 0x8E, 0x05, 0x1D, 0x4F,
+    0x65, 0x1A, 0x8A, 0x3F, 0x01, 0xA3, 0x76, 0xA0, 0x92, 0x23, 0xB3, 0x98, 0xBC, 0x98, 0xAB, 0x05,
+    0x8D, 0x14, 0x46, 0xE9, 0x65, 0x69, 0xA7, 0x9A, 0x13, 0x0F, 0x14, 0x13, 0xAC, 0x69, 0x07, 0xD8,
+    0x12, 0x30, 0x68, 0x3C, 0xBC, 0x98, 0x00, 0x4F, 0xF3, 0x1F, 0x60, 0x7C, 0x00, 0x8A, 0x00, 0x75,
+    0x47, 0xEF, 0xA9, 0xA3, 0x9B, 0x68, 0x82, 0x9B, 0x71, 0x53, 0x1B, 0xD0, 0xD0, 0x86, 0x52, 0x34,
+    0x4B, 0x1D, 0xB1, 0x6B, 0xB3, 0x60, 0xA3, 0x9B, 0xA9, 0x37, 0x79, 0x6A, 0x29, 0xA3, 0x14, 0xA3,
+    0x15, 0x4C, 0x22, 0xC8, 0x4F, 0x2F, 0xB4, 0xCB, 0xB3, 0x93, 0x16, 0xF2, 0x0E, 0x34, 0x1B, 0x1C,
+    0x6E, 0x07, 0x9C, 0x37, 0xD1, 0xF9, 0x7A, 0x71, 0xBE, 0x99, 0xDD, 0xE4, 0x7C, 0x3B, 0x8D, 0x5D,
+    0x3B, 0x89, 0xF6, 0xA7, 0x91, 0xE6, 0x67, 0x2B, 0x8D, 0x02, 0x8D, 0x26, 0xAC, 0x06, 0x6C, 0x4A,
+    0x80, 0xB1, 0x31, 0x8D, 0x59, 0x13, 0xD2, 0x60, 0xB9, 0xF9, 0xA0, 0xB0, 0xA1, 0x0D, 0x66, 0xA3,
+    0x10, 0x76, 0xC5, 0x2E, 0xB4, 0x01, 0x0D, 0x8C, 0x93, 0x8D, 0x14, 0x1A, 0x46, 0x8F, 0x51, 0xBD,
+    0x81, 0x8D, 0xFD, 0x04, 0xED, 0xAD, 0x54, 0x51, 0x0D, 0x50, 0x48, 0x39, 0x71, 0xA1, 0x95, 0xE4,
+    0x0F, 0x6F, 0x35, 0x4E, 0x1C, 0x99, 0x5D, 0x62, 0x50, 0xC7, 0xC0, 0xC1, 0xE6, 0x37, 0xDB, 0xC9,
+    0x1B, 0xDC, 0xD3, 0x15, 0x17, 0x70, 0xDE, 0x44, 0x9C, 0xB7, 0x01, 0xE7, 0x9B, 0x99, 0x76, 0x72,
+    0x9E, 0x76, 0x1A, 0x3B, 0xDA, 0xBF, 0xDE, 0xA1, 0xF9, 0x69, 0x84, 0xE6, 0xCD, 0x05, 0x1A, 0x05,
+    0xB0, 0x09, 0x10, 0x0D, 0xC9, 0x62, 0x9D, 0xA4, 0xAE, 0xCF, 0xAB, 0x70, 0xFF, 0x90, 0x1D, 0xA4,
+    0x7A, 0xDF, 0x0E, 0xBD, 0xA7, 0x09, 0x34, 0x01, 0x34, 0xD4, 0x11, 0xEA, 0x58, 0x0A, 0xE8, 0x67,
+    0x79, 0x30, 0xEA, 0xC3, 0x49, 0x04, 0x2F, 0x12, 0xDE, 0xB7, 0x29, 0x43, 0x48, 0xEC, 0x72, 0xAD,
+    0xC4, 0x2E, 0xA7, 0x72, 0xB0, 0xFC, 0xC9, 0x97, 0xAB, 0x4C, 0xA9, 0xBD, 0x2E, 0xA0, 0x5F, 0xFA,
+    0x15, 0x9A, 0xDD, 0xC8, 0x63, 0xE4, 0xDB, 0x0D, 0x14, 0x0A, 0x05, 0x5C, 0xCC, 0xAB, 0x8B, 0x2B,
+    0x67, 0x81, 0x7F, 0x9A, 0xC9, 0x3B, 0x07, 0xC0, 0x61, 0xBD, 0x59, 0x4C, 0xA0, 0x1D, 0x22, 0x44,
+    0x07, 0xF6, 0xAD, 0x09, 0xC6, 0x35, 0x15, 0x46, 0x71, 0x3E, 0x59, 0x7C, 0xA9, 0x39, 0x65, 0xE2,
+    0xED, 0xEB, 0x0B, 0xF5, 0xDA, 0xFB, 0x62, 0x37, 0x91, 0xDE, 0xB7, 0x73, 0x32, 0x42, 0x3E, 0x0B,
+    0x14, 0x1D, 0x77, 0x5C, 0xBC, 0x78, 0x1E, 0x2B, 0xED, 0xCD, 0xCB, 0x92, 0xEA, 0xB7, 0x25, 0xBD,
+    0xBC, 0xD2, 0x4E, 0x6C, 0xD8, 0x40, 0x8F, 0x89, 0xB4, 0xBE, 0xD8, 0xB1, 0x33, 0x63, 0x67, 0x02,
+    0xCE, 0x17, 0x11, 0x1B, 0xD8, 0xA9, 0x56, 0x5C, 0x57, 0x6E, 0x34, 0x3E, 0xD1, 0x7E, 0xCE, 0x9B,
+    0xEC, 0xD4, 0x6A, 0x25, 0x4D, 0x4D, 0xF6, 0x46, 0xC3, 0xE3, 0xD7, 0xAE, 0x8D, 0xD3, 0x21, 0x51,
+    0x31, 0x91, 0x5C, 0xED, 0x65, 0xEC, 0xEE, 0xB8, 0x78, 0x81, 0x56, 0xF1, 0xB2, 0xD3, 0xBA, 0xF2,
+    0x04, 0x0B, 0x37, 0x8A, 0x40, 0x2C, 0x43, 0xB1, 0x9A, 0xB9, 0x5C, 0xCC, 0x64, 0x42, 0xE5, 0x4D,
+    0xA8, 0x7D, 0xF5, 0x37, 0x8F, 0x5D, 0xAD, 0x53, 0xCE, 0x1B, 0x52, 0x1D, 0xD5, 0xCC, 0x50, 0x4D,
+    0x50, 0x9F, 0x88, 0x19, 0xCA, 0xBF, 0xC3, 0x4D, 0xEA, 0x6C, 0x70, 0xBE, 0x8A, 0xCD, 0x5C, 0xEE,
+    0x75, 0x60, 0x2C, 0x23, 0xCE, 0xEF, 0x34, 0xB3, 0xC3, 0x2E, 0xD6, 0x57, 0xD1, 0xAC, 0xF7, 0x09,
+    0x49, 0x5D, 0x2B, 0xF9, 0x52, 0x6F, 0x05, 0xA8, 0xD6, 0x5C, 0xA8, 0x51, 0x4E, 0x66, 0x9B, 0xF7,
+    0xA0, 0x56, 0x97, 0x16, 0x99, 0x02, 0x98, 0x84, 0x2C, 0x0F, 0xA9, 0x4D, 0xDB, 0x5D, 0x69, 0xBB,
+    0x17, 0x1C, 0xF1, 0x21, 0xE2, 0xE5, 0x62, 0xBD, 0x6C, 0xC2, 0xE5, 0x3A, 0xF4, 0x9A, 0x5B, 0x4D,
+    0x58, 0x8F, 0xF5, 0x34, 0x03, 0x6D, 0x47, 0x3B, 0xE3, 0x26, 0x6A, 0x8F, 0xF5, 0xDC, 0xD9, 0x71,
+    0x9E, 0xBB, 0x4D, 0x20, 0x9A, 0x50, 0xC4, 0x6A, 0x2A, 0x57, 0xEB, 0xCD, 0x62, 0xBB, 0x2A, 0xB4,
+    0xAE, 0x0E, 0x0F, 0x39, 0x3B, 0x3F, 0x78, 0xC5, 0x4D, 0x57, 0x5E, 0x94, 0xEF, 0x25, 0xEF, 0x52,
+    0xC9, 0xBE, 0xAB, 0x76, 0x87, 0x09, 0x0E, 0x33, 0x5F, 0xA1, 0x9A, 0xB6, 0x64, 0x0A, 0x45, 0xA4,
+    0xE8, 0xEE, 0xFE, 0x4C, 0x39, 0x05, 0xFB, 0x68, 0x77, 0xF9, 0xD3, 0x3F, 0x09, 0x3F, 0xFB, 0xB3,
+    0xA7, 0xFE, 0xDF, 0xCD, 0x2A, 0x38, 0x79, 0xF7, 0xA7, 0x7C, 0x6F, 0x29, 0x9F, 0xF2, 0x34, 0x70,
+    0xE7, 0xD5, 0xE4, 0x7B, 0x8A, 0x98, 0xAF, 0xDC, 0xF9, 0x04, 0x86, 0xEB, 0x5C, 0x74, 0x41, 0x59,
+    0xEE, 0xD0, 0x26, 0xE7, 0xBA, 0x1A, 0x75, 0x63, 0x21, 0x1A, 0x3F, 0x76, 0xF5, 0xEC, 0xBC, 0x59,
+    0x9B, 0x99, 0xAD, 0x5E, 0x18, 0x4D, 0xC4, 0x79, 0x61, 0x43, 0xEF, 0xEB, 0xB5, 0x9D, 0xCD, 0x9E,
+    0xA3, 0xCA, 0x9E, 0x55, 0x1B, 0x66, 0xCD, 0x35, 0x9E, 0x2A, 0x70, 0x4A, 0xB6, 0x17, 0x07, 0xD9,
+    0x6E, 0xCE, 0x92, 0xED, 0xFC, 0x03, 0xC9, 0x76, 0x80, 0x2B, 0x1D, 0x34, 0x7B, 0xD7, 0x7B, 0x4A,
+    0x69, 0xEA, 0x27, 0xAC, 0xB4, 0x38, 0x7D, 0xC7, 0xA5, 0xA0, 0x27, 0x4F, 0x2C, 0x25, 0xBD, 0x3F,
+    0x46, 0xCE, 0x29, 0xE1, 0x1E, 0x7B, 0xFA, 0x27, 0x42, 0x23, 0xFD, 0xFC, 0x5B, 0x87, 0x54, 0xE0,
+    0xE4, 0xCF, 0x0A, 0xFF, 0x03, 0xB4, 0xFA, 0xD6, 0x97, 0xE7, 0x04, 0x9B, 0x12, 0xC7, 0x95, 0x14,
+    0x22, 0x92, 0x27, 0xF3, 0x6E, 0x70, 0x9F, 0xAE, 0xF2, 0xC7, 0x70, 0x69, 0xB2, 0x1E, 0xC9, 0xEC,
+    0x9D, 0xBE, 0x3C, 0x8D, 0xDA, 0x79, 0xBE, 0x90, 0x24, 0x8A, 0x51, 0xF2, 0xA9, 0x42, 0x6D, 0xDF,
+    0xBF, 0x78, 0x28, 0xD4, 0xD4, 0x9D, 0x4B, 0x84, 0x2F, 0x95, 0x34, 0xC1, 0xA8, 0x40, 0x2E, 0xCF,
+    0xA5, 0x44, 0xFB, 0x19, 0x38, 0xA7, 0xC9, 0x6C, 0xD0, 0x68, 0x27, 0xC5, 0xCC, 0xD9, 0xE9, 0x0D,
+    0xB7, 0x9D, 0x8B, 0x95, 0xA4, 0x05, 0xD7, 0xB5, 0x92, 0x9E, 0xD3, 0xCC, 0x7D, 0x09, 0x35, 0x50,
+    0x27, 0xF7, 0x75, 0xD0, 0x0D, 0x92, 0xAE, 0x75, 0xD9, 0x7D, 0x65, 0xA7, 0x96, 0x3C, 0xC1, 0xEF,
+    0x43, 0xA1, 0xF7, 0x1E, 0x1E, 0x33, 0x7C, 0x4D, 0x75, 0x68, 0x4D, 0x09, 0x26, 0x66, 0xEC, 0xBA,
+    0x82, 0x09, 0x97, 0xF6, 0xAB, 0x27, 0xB2, 0x80, 0x94, 0xD4, 0x9E, 0x30, 0x10, 0x09, 0xB7, 0xFF,
+    0x31, 0x5C, 0x9A, 0xAD, 0x67, 0x4C, 0xF7, 0x3D, 0xF7, 0x12, 0x37, 0x8A, 0x51, 0x12, 0xF4, 0x27,
+    0xF7, 0x5D, 0xFF, 0xDD, 0x85, 0xD3, 0xFB, 0xAE, 0xB2, 0x40, 0x22, 0x49, 0x23, 0x46, 0x2D, 0x98,
+    0x9B, 0xBA, 0x9A, 0x1C, 0x0F, 0xCF, 0x03, 0xFC, 0xB3, 0x74, 0xA1, 0xFF, 0x18, 0x52, 0x94, 0xB3,
+    0xAC, 0xF8, 0x54, 0x25, 0x76, 0x26, 0xD3, 0xDD, 0x87, 0x40, 0xE6, 0xC8, 0xC8, 0x00, 0xC6, 0x37,
+    0xFE, 0xB3, 0x15, 0x67, 0xA5, 0x06, 0xA9, 0x93, 0xC7, 0xC8, 0x28, 0xDA, 0x08, 0x76, 0xB3, 0x9A,
+    0x34, 0x41, 0xB3, 0x3A, 0xD5, 0x5B, 0x66, 0x97, 0xC6, 0x09, 0xD0, 0x2B, 0xFA, 0xAB, 0xA4, 0xE5,
+    0xB9, 0xAE, 0x7E, 0x4E, 0x59, 0xC4, 0xAD, 0x24, 0x3D, 0x49, 0xF2, 0x8A, 0x64, 0x7A, 0x99, 0xED,
+    0x52, 0xD6, 0xF4, 0x25, 0xB3, 0x3B, 0xB4, 0x23, 0x47, 0x46, 0x9F, 0x8E, 0x49, 0xD0, 0x2C, 0xE7,
+    0x24, 0xAD, 0xAE, 0xBF, 0x9F, 0x60, 0xC1, 0xAA, 0xD7, 0xB4, 0x40, 0xAF, 0x47, 0x54, 0x69, 0xA1,
+    0xD6, 0xD2, 0xAC, 0x56, 0xA1, 0x90, 0xBA, 0x71, 0x6A, 0x14, 0x3E, 0x50, 0x69, 0x5E, 0xCB, 0x78,
+    0x30, 0x5A, 0x5D, 0x1E, 0xA1, 0x39, 0xCB, 0x03, 0x33, 0x3C, 0xBE, 0xF3, 0x3B, 0xFF, 0x90, 0x41,
+    0xB9, 0xF7, 0xBB, 0x77, 0x7E, 0xA7, 0xFC, 0xEE, 0xB9, 0x67, 0xD1, 0x34, 0x0E, 0xEE, 0x25, 0x0D,
+    0x46, 0xD5, 0x5A, 0x2F, 0x6E, 0xA6, 0x59, 0x7B, 0x2F, 0xBB, 0xC2, 0xF8, 0x4A, 0x6C, 0x5E, 0xDB,
+    0xC1, 0xC8, 0xBD, 0x1C, 0x35, 0x40, 0x73, 0x2B, 0xF6, 0xE3, 0x0C, 0x8C, 0xFA, 0x41, 0xCE, 0xB0,
+    0xB6, 0x44, 0xB4, 0x35, 0x07, 0xBF, 0x76, 0x8C, 0x51, 0x36, 0xE2, 0x24, 0x46, 0xC9, 0x03, 0x91,
+    0xEE, 0xFB, 0x17, 0xFA, 0x99, 0x66, 0x0A, 0xC5, 0x76, 0x6B, 0x35, 0x30, 0xAA, 0x94, 0xD7, 0x4E,
+    0x2F, 0xEF, 0xD6, 0x4A, 0x2B, 0x98, 0x58, 0x47, 0xCC, 0xD2, 0x06, 0xEA, 0xD0, 0x4F, 0xD8, 0xA0,
+    0x0E, 0xFB, 0xD3, 0x0D, 0xDA, 0x1F, 0xAF, 0xE0, 0xDE, 0x9A, 0xA1, 0x4F, 0xA4, 0x3C, 0xA0, 0x08,
+    0x85, 0xF6, 0x8E, 0x52, 0x0A, 0x98, 0x6D, 0x8C, 0x54, 0xB1, 0x12, 0x76, 0x29, 0x84, 0x0D, 0x88,
+    0x36, 0x20, 0xDC, 0x5C, 0x08, 0x37, 0x99, 0x9D, 0xC7, 0x87, 0x2A, 0x02, 0x97, 0xD6, 0x2C, 0xFD,
+    0xC8, 0xB0, 0x03, 0xB0, 0x27, 0x96, 0x76, 0xF7, 0x1D, 0x9D, 0x79, 0x75, 0xE5, 0x72, 0x8F, 0xFD,
+    0xA1, 0xE7, 0x56, 0xA0, 0x89, 0x98, 0xC4, 0xC5, 0xD7, 0x9A, 0x89, 0xFD, 0xD0, 0x0C, 0xB1, 0x5C,
+    0x6A, 0xEF, 0x88, 0x55, 0x68, 0x3C, 0xD5, 0x42, 0xB5, 0xC3, 0x38, 0x50, 0x1F, 0xEE, 0xC2, 0xE5,
+    0x05, 0x75, 0x80, 0x6A, 0xBB, 0x8F, 0x01, 0xF4, 0xB0, 0xA0, 0x09, 0xED, 0x4C, 0xB9, 0x9B, 0x0D,
+    0xDC, 0xE4, 0x3C, 0x55, 0xAC, 0x23, 0x8C, 0x83, 0x06, 0xEC, 0x62, 0x03, 0x85, 0x0A, 0x41, 0x3B,
+    0xB7, 0x33, 0x26, 0x26, 0xB9, 0x5E, 0xEF, 0xB1, 0x6B, 0x1D, 0x39, 0x27, 0xB4, 0x17, 0x0A, 0x56,
+    0xBE, 0xDD, 0x4A, 0xAD, 0x46, 0x5D, 0x2E, 0xC8, 0x4D, 0x47, 0x16, 0x60, 0x12, 0xAD, 0x19, 0x80,
+    0x3B, 0xBF, 0x9B, 0x4B, 0xBD, 0xBD, 0x7C, 0xF9, 0xFE, 0x86, 0xBD, 0x19, 0xB8, 0x62, 0x7D, 0xB9,
+    0x3C, 0x84, 0xBD, 0xB9, 0xA4, 0x97, 0x0E, 0xFB, 0xD2, 0xCA, 0x15, 0x3B, 0xD5, 0x8B, 0x0B, 0xFD,
+    0x4B, 0x7A, 0xF2, 0xBB, 0x55, 0x4C, 0x44, 0xC0, 0x98, 0x1C, 0x84, 0xD9, 0x28, 0x77, 0xAA, 0x88,
+    0xD9, 0xA9, 0x23, 0x66, 0xC3, 0xAE, 0x54, 0x31, 0x67, 0xEC, 0x4D, 0xC0, 0xAE, 0x39, 0x59, 0xBF,
+    0x8D, 0xA6, 0x98, 0x70, 0x27, 0x34, 0xC5, 0x5F, 0x5E, 0x94, 0x4F, 0xD9, 0xB9, 0x39, 0x7D, 0x4E,
+    0x4A, 0xC6, 0x2E, 0xD3, 0x14, 0x1B, 0xB5, 0x68, 0x22, 0x56, 0x5D, 0x1B, 0x69, 0x34, 0xB8, 0x35,
+    0xD7, 0x24, 0x2A, 0xA5, 0xDC, 0x9E, 0xA3, 0x8A, 0x72, 0x54, 0x23, 0x17, 0xA0, 0xF8, 0x9F, 0xBA,
+    0xA4, 0xC7, 0xB2, 0xBE, 0x9E, 0xEA, 0xD9, 0x04, 0xB3, 0x14, 0x91, 0xC8, 0x8B, 0x89, 0xA4, 0x18,
+    0xEC, 0x64, 0xA7, 0x2A, 0x54, 0xFB, 0x73, 0xB1, 0xCC, 0x82, 0x8C, 0xCE, 0x49, 0xBE, 0x99, 0x6C,
+    0xA8, 0x83, 0xD9, 0x4C, 0x2C, 0x95, 0x45, 0x6C, 0x0A, 0xD0, 0x2F, 0x59, 0x66, 0xC8, 0xD9, 0xDB,
+    0xDE, 0xFE, 0x29, 0x6E, 0x7B, 0xA7, 0x8D, 0x07, 0x3B, 0xB3, 0x0F, 0x40, 0x95, 0xF4, 0x6F, 0x3A,
+    0x15, 0x14, 0x35, 0xEB, 0xA9, 0x5A, 0x2E, 0x55, 0x53, 0x95, 0xD8, 0xEF, 0x0E, 0x1C, 0x6D, 0xD7,
+    0x0C, 0x76, 0xAA, 0x27, 0x13, 0x4C, 0xC8, 0x43, 0x30, 0xE2, 0x3A, 0x37, 0x34, 0xDE, 0x4E, 0x75,
+    0xA8, 0xF6, 0xE7, 0xD6, 0x52, 0xDA, 0xC8, 0xB8, 0xDA, 0xB7, 0xDE, 0x06, 0x1B, 0xAA, 0xD5, 0xC4,
+    0x72, 0x3F, 0x0B, 0x36, 0x42, 0x9E, 0xF5, 0x78, 0x2A, 0xCF, 0x31, 0x7F, 0x87, 0x9B, 0x12, 0x9C,
+    0xA8, 0x62, 0x33, 0x97, 0x5B, 0x1D, 0x90, 0x89, 0x38, 0xBF, 0x9D, 0x81, 0x6A, 0xD5, 0x72, 0xDF,
+    0xFE, 0x6B, 0xA1, 0xDA, 0x74, 0x2A, 0x0C, 0xAC, 0xF7, 0x1C, 0x80, 0x8E, 0xC4, 0xA7, 0xE8, 0xEE,
+    0xFE, 0x4C, 0x39, 0x07, 0xFB, 0xE8, 0x70, 0xF9, 0xD3, 0x65, 0x08, 0xCD, 0x53, 0x2F, 0x6D, 0x56,
+    0xA1, 0x95, 0xFF, 0xE4, 0x9F, 0xC2, 0x86, 0x59, 0x68, 0x3C, 0x57, 0x28, 0x17, 0xAC, 0xE7, 0x9E,
+    0x94, 0x74, 0xB4, 0x2B, 0x76, 0xA7, 0xD0, 0x44, 0x1F, 0xB1, 0xA2, 0x54, 0x60, 0x8C, 0x58, 0xF9,
+    0x4A, 0x33, 0xBD, 0x3A, 0xA7, 0xAE, 0xD4, 0x56, 0x2A, 0x62, 0xB5, 0x36, 0x0A, 0xF4, 0x9A, 0xA5,
+    0xA1, 0xDC, 0xF5, 0x03, 0x6D, 0xD8, 0x77, 0xD5, 0xFF, 0x38, 0xE0, 0x7E, 0xA8, 0x7D, 0xF4, 0xA5,
+    0x9C, 0xDE, 0x11, 0x36, 0x8E, 0x7A, 0x6C, 0xC5, 0xFD, 0x44, 0x71, 0x9C, 0x0A, 0x7D, 0x41, 0xAF,
+    0x09, 0x1B, 0x1B, 0x35, 0x11, 0x17, 0xFA, 0xA0, 0xB9, 0x90, 0xD7, 0x53, 0xEA, 0xEA, 0xDD, 0xC4,
+    0x36, 0xE2, 0x96, 0x9C, 0x5C, 0x27, 0x99, 0x40, 0x22, 0x97, 0x4E, 0x32, 0xF0, 0xAC, 0x83, 0xC9,
+    0x52, 0xA2, 0x2C, 0x0C, 0x4B, 0x93, 0x97, 0xCB, 0x63, 0xF7, 0x5C, 0x00, 0xDC, 0x50, 0x85, 0x42,
+    0x38, 0x5F, 0xC7, 0x72, 0xC7, 0x85, 0x66, 0x41, 0x5E, 0x53, 0xAD, 0x2F, 0x08, 0xB7, 0xB9, 0x88,
+    0x6E, 0xDD, 0x9A, 0xAB, 0x37, 0x35, 0x76, 0xED, 0xA5, 0x2D, 0x12, 0xFB, 0x37, 0x43, 0xF5, 0xB6,
+    0xDC, 0xD0, 0xBE, 0xB2, 0xEC, 0xEC, 0xF6, 0x07, 0x8B, 0x59, 0xEE, 0x76, 0xFE, 0x10, 0x20, 0x8B,
+    0x3C, 0xB2, 0x6E, 0xC8, 0x50, 0x21, 0xB1, 0x4F, 0xD5, 0x4A, 0xDF, 0xD5, 0x01, 0xA5, 0x7A, 0x65,
+    0x3B, 0x99, 0x43, 0x06, 0xDF, 0xD9, 0x80, 0x92, 0xC0, 0x2A, 0xE5, 0x6C, 0xE9, 0x72, 0x87, 0xC6,
+    0x43, 0xA1, 0xEB, 0x6B, 0x72, 0xE4, 0xA7, 0x49, 0x52, 0xA1, 0x5F, 0xA5, 0x58, 0x4F, 0xCA, 0xDA,
+    0x44, 0xE1, 0xE5, 0x9C, 0xB6, 0x4A, 0x0A, 0xE6, 0x14, 0x10, 0xDB, 0xB7, 0x3C, 0x50, 0xFD, 0xFD,
+    0x06, 0xA0, 0x66, 0x02, 0xDA, 0x57, 0xF7, 0xD4, 0xA7, 0x30, 0x03, 0x2A, 0x52, 0x7D, 0xAD, 0x09,
+    0x50, 0x45, 0x04, 0xE8, 0xE7, 0xD7, 0x43, 0x4E, 0x08, 0x49, 0x30, 0x2B, 0xE5, 0x29, 0x99, 0xE7,
+    0xAB, 0xF6, 0x54, 0x2D, 0xF6, 0xD8, 0x88, 0x5B, 0xB2, 0x2A, 0x81, 0x94, 0xFF, 0xBF, 0x98, 0x6B,
+    0xB7, 0xBD, 0x56, 0x68, 0x35, 0xC1, 0xB9, 0x67, 0x3F, 0x74, 0xCD, 0xE7, 0x36, 0xA0, 0x4D, 0x7A,
+    0xEE, 0x0D, 0xF6, 0x6A, 0xC3, 0xAC, 0x65, 0xA4, 0x0A, 0x65, 0xA4, 0x9E, 0xCA, 0x88, 0xF5, 0xE5,
+    0x4A, 0xD3, 0x99, 0x95, 0x16, 0xB3, 0xE0, 0xB0, 0x01, 0xF7, 0xF3, 0x24, 0x70, 0x0C, 0x49, 0x7D,
+    0x6C, 0xA5, 0x39, 0xA5, 0xF8, 0x40, 0xF3, 0x52, 0x04, 0xDA, 0x9B, 0x11, 0x70, 0x2F, 0x47, 0x60,
+    0xFC, 0x41, 0x04, 0xF4, 0xF4, 0xFA, 0x91, 0xE3, 0x95, 0x18, 0xAE, 0x34, 0x5C, 0x7D, 0x3C, 0x19,
+    0xAD, 0x72, 0x8F, 0x27, 0x83, 0x65, 0xDF, 0xDE, 0x4E, 0xC6, 0xAA, 0x7F, 0x72, 0x3F, 0x86, 0xCA,
+    0xEC, 0x85, 0x8E, 0x91, 0xB2, 0xFB, 0xB5, 0x23, 0x73, 0xA6, 0x97, 0xD4, 0x71, 0x4A, 0x0A, 0x0F,
+    0x69, 0x98, 0x52, 0xED, 0xF8, 0x18, 0xA5, 0xFE, 0xF3, 0x11, 0xF4, 0x48, 0xA4, 0x50, 0x1D, 0x31,
+    0xB2, 0x91, 0x4A, 0xCD, 0xCA, 0x1D, 0x17, 0xEF, 0xB9, 0xF0, 0x5F, 0x7E, 0x90, 0xB8, 0xE3, 0xDA,
+    0x73, 0x69, 0xE5, 0x8C, 0x19, 0xB6, 0x1F, 0x68, 0x89, 0x5E, 0xBA, 0x36, 0x9C, 0xB8, 0x7A, 0x38,
+    0x58, 0x6A, 0xCC, 0x96, 0x0F, 0x76, 0xAF, 0xA4, 0x3A, 0x5C, 0xB9, 0xB5, 0x19, 0x68, 0xCC, 0x63,
+    0x4E, 0xF3, 0x73, 0xC1, 0xDB, 0x06, 0xAB, 0xF7, 0x53, 0xF9, 0xB8, 0x4F, 0xB4, 0xF6, 0xFE, 0x5C,
+    0x82, 0x4E, 0x63, 0x2E, 0x17, 0xD6, 0x92, 0xDE, 0xBF, 0xF6, 0x4C, 0xAE, 0x01, 0x26, 0x95, 0x64,
+    0x62, 0x88, 0x5D, 0x38, 0xE4, 0xF7, 0x5D, 0x29, 0x29, 0xD0, 0x2E, 0x47, 0xA6, 0xF1, 0x21, 0x2A,
+    0x72, 0x2A, 0xC6, 0x81, 0x56, 0x92, 0xA8, 0x25, 0xBD, 0x19, 0xD9, 0x2B, 0x85, 0xDA, 0xBB, 0xA1,
+    0x8D, 0x77, 0xBC, 0x50, 0x85, 0x52, 0xD2, 0xF4, 0x02, 0xAD, 0xB4, 0x59, 0x5F, 0x4A, 0x7A, 0x75,
+    0xC1, 0xBD, 0xFF, 0xE7, 0x5D, 0x9B, 0x04, 0x25, 0x01, 0x79, 0xEE, 0x72, 0x3F, 0x97, 0xAE, 0x36,
+    0xE9, 0xFC, 0xA1, 0xD5, 0x49, 0x32, 0xAE, 0xB9, 0xD4, 0x50, 0xA5, 0xD5, 0xF6, 0x04, 0x57, 0x80,
+    0xF1, 0xAD, 0xED, 0x04, 0x27, 0xA7, 0x51, 0xA9, 0xF7, 0x8F, 0x91, 0xFC, 0xDC, 0x71, 0xF1, 0x71,
+    0x72, 0xB3, 0x42, 0x7D, 0x08, 0xD1, 0xD7, 0xA3, 0xFD, 0xA4, 0x9D, 0x4E, 0x9B, 0x45, 0xD2, 0x73,
+    0xFF, 0xF3, 0x7F, 0x4B, 0x6E, 0x58, 0x40, 0x5A, 0xC9, 0x1D, 0x0B, 0xE5, 0xCE, 0x49, 0xCB, 0x42,
+    0x56, 0xBA, 0x6E, 0x17, 0x2F, 0x1C, 0xF5, 0xAB, 0xF4, 0xDC, 0x48, 0x91, 0x34, 0x6C, 0xF9, 0x19,
+    0xAE, 0x70, 0x05, 0xDA, 0x5B, 0x29, 0xA5, 0xF2, 0xA9, 0x14, 0x45, 0xB5, 0xFF, 0x7A, 0x89, 0xD2,
+    0xB9, 0x3D, 0x23, 0x17, 0xEC, 0x9E, 0x88, 0xE5, 0x89, 0x3A, 0xFC, 0xEE, 0x8A, 0x91, 0x76, 0xCA,
+    0x54, 0x3A, 0x90, 0x66, 0xFA, 0xF7, 0xBF, 0xDD, 0x25, 0x1E, 0xB6, 0x5E, 0xC8, 0x02, 0xCB, 0x94,
+    0xE6, 0xD8, 0xCC, 0x5D, 0xAF, 0xB7, 0x25, 0x71, 0x5C, 0xDF, 0xBB, 0x44, 0xD6, 0x1B, 0x49, 0x13,
+    0x92, 0x62, 0x5A, 0x2C, 0xED, 0xD5, 0xFB, 0x34, 0x7F, 0x22, 0x03, 0x80, 0x5C, 0x61, 0xE8, 0x24,
+    0xC9, 0xF7, 0x4A, 0x8A, 0x21, 0x2D, 0x95, 0xA4, 0x58, 0xEC, 0xDF, 0xFE, 0xC2, 0x86, 0xA3, 0xDA,
+    0xB1, 0x6B, 0x23, 0x8A, 0x44, 0x50, 0x69, 0xFB, 0x70, 0xB6, 0x72, 0x69, 0xA7, 0x92, 0xA6, 0xCC,
+    0x85, 0xAC, 0xBF, 0xD3, 0x35, 0x59, 0xE2, 0x57, 0xC6, 0x3F, 0x94, 0x56, 0x97, 0x75, 0x8A, 0xEE,
+    0xD9, 0x4B, 0xFE, 0x21, 0xC6, 0xAE, 0x7D, 0x73, 0xC7, 0x6A, 0xA1, 0x38, 0x19, 0xA1, 0x68, 0x3D,
+    0xF4, 0x75, 0xC8, 0x6E, 0xA4, 0x79, 0x5B, 0x60, 0xE3, 0x47, 0xD9, 0xE1, 0x3F, 0xFD, 0xCD, 0x71,
+    0x69, 0x4F, 0x7C, 0x44, 0x2D, 0x2D, 0x48, 0x1A, 0xD2, 0xFD, 0xE1, 0x3C, 0x94, 0xB1, 0xBC, 0x2E,
+    0x0D, 0x4E, 0x0A, 0x46, 0xDA, 0x71, 0xCF, 0x5E, 0xF2, 0x66, 0xAE, 0x17, 0xDA, 0x37, 0xF7, 0x54,
+    0xDA, 0x2D, 0xD4, 0x51, 0x87, 0x11, 0x64, 0x67, 0x9A, 0xBF, 0xDE, 0x31, 0xBB, 0x9B, 0x70, 0x7F,
+    0xB5, 0x9D, 0xB9, 0x73, 0x48, 0x5F, 0xE1, 0xC4, 0x8F, 0x42, 0xA9, 0xCC, 0x07, 0xD8, 0xF5, 0xD7,
+    0x0B, 0x74, 0x7F, 0xD5, 0xA3, 0x89, 0xB5, 0xD6, 0x24, 0xA1, 0x69, 0xE5, 0x35, 0xC1, 0x38, 0x6B,
+    0xAF, 0x37, 0x40, 0x2F, 0x6B, 0xE9, 0x67, 0x30, 0xB2, 0x7A, 0x65, 0x07, 0xEA, 0xCD, 0xED, 0x2E,
+    0x00, 0x76, 0xD3, 0xBB, 0x02, 0x70, 0xB7, 0x72, 0x96, 0xD3, 0x1F, 0x99, 0x60, 0x4E, 0xD2, 0x31,
+    0xD9, 0x93, 0x65, 0xE4, 0x9F, 0xF2, 0xB5, 0xE9, 0x36, 0x6D, 0xC2, 0x98, 0xFD, 0x88, 0xD5, 0xC1,
+    0x59, 0x6C, 0xFA, 0xB1, 0x3C, 0xB4, 0xFA, 0xE6, 0xEE, 0x34, 0x60, 0xB4, 0xBA, 0xE0, 0x34, 0x30,
+    0x6A, 0x90, 0x1F, 0xD5, 0x59, 0x2D, 0xD5, 0xCE, 0x91, 0xF7, 0xA5, 0xD8, 0x02, 0x65, 0x4C, 0x4B,
+    0xF6, 0x64, 0x60, 0xEA, 0x35, 0xB7, 0xB3, 0x7D, 0x38, 0xCA, 0x7C, 0xAC, 0x86, 0xF9, 0xDA, 0x70,
+    0xAD, 0xBB, 0x7F, 0x78, 0xFC, 0xAA, 0xDD, 0xEA, 0xD5, 0xC4, 0x66, 0xC5, 0x85, 0x7E, 0x18, 0x1F,
+    0xD9, 0x29, 0xF4, 0x8D, 0x68, 0x83, 0x06, 0xEA, 0xD8, 0xBF, 0xB4, 0xB9, 0x19, 0xDC, 0x3B, 0xD1,
+    0xFD, 0x70, 0x85, 0x42, 0xE3, 0x2B, 0xB7, 0x52, 0x5A, 0x17, 0xC7, 0x54, 0x75, 0xD0, 0x8F, 0x35,
+    0xE7, 0x44, 0x77, 0xE5, 0x54, 0xD5, 0x85, 0xC9, 0x6F, 0x14, 0xCA, 0x65, 0xAF, 0x31, 0x57, 0xE5,
+    0x9C, 0xDA, 0xBD, 0xDF, 0xA1, 0xD1, 0x4D, 0xFD, 0x48, 0x2B, 0xB5, 0x42, 0x1B, 0xAD, 0xE6, 0x4A,
+    0xD1, 0x68, 0xE8, 0x35, 0xC0, 0x6E, 0x67, 0xEC, 0xBC, 0x53, 0x6E, 0xED, 0x84, 0x7B, 0x6D, 0xA3,
+    0x8A, 0xBD, 0xFF, 0xB8, 0x5B, 0xB9, 0xBE, 0x26, 0xCD, 0x9C, 0x91, 0x7C, 0x16, 0x3F, 0x58, 0x9F,
+    0xD4, 0x0F, 0xC9, 0x4B, 0xCF, 0x98, 0xD4, 0xFD, 0xD1, 0x1D, 0xC8, 0x68, 0x82, 0x62, 0xE3, 0x2E,
+    0xFA, 0xC9, 0xFC, 0xCD, 0x18, 0x71, 0x09, 0xA1, 0xCF, 0x8C, 0x5A, 0x29, 0xC6, 0x93, 0x81, 0x2C,
+    0x97, 0xB6, 0x63, 0xB3, 0x13, 0xE3, 0x17, 0x16, 0xDC, 0xCB, 0x91, 0xB3, 0xBA, 0xDF, 0x62, 0xEC,
+    0x28, 0xB4, 0xC2, 0x79, 0x9B, 0x5B, 0x04, 0x7F, 0x6F, 0x4A, 0x38, 0xB0, 0x5F, 0x32, 0x3D, 0x53,
+    0x7B, 0x7E, 0xE7, 0xB1, 0x99, 0x5A, 0x21, 0x95, 0x05, 0x4E, 0xD6, 0xD2, 0xA8, 0x88, 0xF2, 0xFF,
+    0xD4, 0x2B, 0xB8, 0x40, 0xA1, 0x81, 0x7A, 0x4B, 0xE0, 0xD1, 0x6D, 0xF9, 0x72, 0x7B, 0x9F, 0x6B,
+    0xE2, 0xBE, 0xE8, 0xFA, 0xA1, 0xFE, 0x5B, 0x75, 0xBD, 0x84, 0xD3, 0x46, 0xA3, 0xE5, 0x54, 0xAC,
+    0xEE, 0xB4, 0xE3, 0xB4, 0x27, 0x65, 0x68, 0xB9, 0x25, 0x45, 0x94, 0x26, 0xAA, 0x3D, 0x95, 0x0A,
+    0x1A, 0x0D, 0xDC, 0xAB, 0x8C, 0xF6, 0xED, 0x0C, 0xCD, 0x54, 0xCE, 0xA3, 0x6F, 0x52, 0x19, 0x0A,
+    0xAB, 0x2D, 0xA9, 0xA9, 0x3F, 0x71, 0xC6, 0x19, 0x5F, 0x93, 0x87, 0x31, 0xD5, 0x35, 0x14, 0xE1,
+    0xFE, 0x3F, 0xBF, 0xD8, 0xFD, 0xFF, 0xA3, 0xC3, 0xE1, 0x4B, 0xCF, 0xAD, 0x94, 0x59, 0x4C, 0x19,
+    0xB9, 0xF3, 0xDA, 0x9F, 0x5F, 0xF8, 0x48, 0xC3, 0xD8, 0x68, 0x66, 0x22, 0xFD, 0x54, 0xC4, 0x42,
+    0xBE, 0x5C, 0x2B, 0x79, 0xB3, 0x5A, 0x0D, 0xD5, 0xE2, 0x34, 0xD4, 0x41, 0x7D, 0x67, 0xDF, 0xD9,
+    0x7A, 0xEC, 0x5B, 0x8B, 0x68, 0x34, 0xEF, 0xB4, 0x7A, 0x72, 0xC3, 0xED, 0x26, 0xE2, 0xA2, 0x89,
+    0xF4, 0xA1, 0x5A, 0x19, 0x7D, 0xBD, 0xDC, 0x66, 0x0E, 0xD8, 0x57, 0x37, 0x60, 0xFC, 0xC2, 0x02,
+    0x26, 0x3A, 0xCF, 0x59, 0xA3, 0x48, 0x5D, 0x85, 0x3B, 0x66, 0xA7, 0x5E, 0x70, 0x4B, 0x2A, 0xEC,
+    0x16, 0xA2, 0x15, 0xF5, 0x5A, 0x68, 0xC5, 0x79, 0xAB, 0x09, 0x21, 0x51, 0xAD, 0x56, 0x91, 0x76,
+    0x1A, 0xC7, 0x19, 0xD5, 0xEF, 0xAB, 0xAB, 0x62, 0xFF, 0xC3, 0x48, 0xFB, 0xD3, 0xD8, 0x07, 0xD4,
+    0xBF, 0xA6, 0xC1, 0x68, 0xB7, 0x91, 0x56, 0xF3, 0x18, 0x90, 0x8C, 0x06, 0xA3, 0xD0, 0x6C, 0x34,
+    0xEA, 0xC6, 0xC0, 0xB8, 0x1A, 0x79, 0x23, 0xDF, 0xEC, 0x90, 0x56, 0x4D, 0xF3, 0xEA, 0x86, 0xD9,
+    0xDC, 0x84, 0x7B, 0x39, 0x52, 0xC7, 0xD1, 0xFF, 0x97, 0xD0, 0x21, 0xF7, 0x55, 0x38, 0x71, 0x3F,
+    0x36, 0xE8, 0xC4, 0x05, 0x1D, 0x1D, 0xBC, 0xB7, 0x55, 0x32, 0xE7, 0x94, 0x43, 0xA4, 0x2A, 0xE0,
+    0x0A, 0x6E, 0xFF, 0x37, 0xEA, 0x70, 0x2B, 0xFD, 0x4C, 0xBB, 0x52, 0x47, 0x9A, 0x95, 0x42, 0x9D,
+    0x8D, 0xE0, 0xA6, 0x6A, 0x03, 0xBB, 0x94, 0x02, 0xB3, 0xA1, 0x81, 0x42, 0xF4, 0x1E, 0x7A, 0x9F,
+    0xAA, 0x5B, 0x75, 0x04, 0xBB, 0x98, 0x1D, 0x6C, 0x44, 0x9E, 0x7A, 0xC7, 0xED, 0x0F, 0x5F, 0xCA,
+    0x69, 0x75, 0x4A, 0xB4, 0x27, 0x46, 0xA5, 0x1E, 0xBD, 0x2C, 0xC3, 0xD4, 0x04, 0xE7, 0x74, 0x16,
+    0x7C, 0x6C, 0x76, 0x4A, 0x23, 0x15, 0x9D, 0xA7, 0x7F, 0x25, 0x9E, 0xBA, 0xD0, 0x8F, 0x6A, 0xF5,
+    0xB8, 0x9A, 0x58, 0xC9, 0x5E, 0x1B, 0x76, 0x6D, 0x82, 0xD9, 0x4E, 0x25, 0x91, 0x23, 0x3B, 0x36,
+    0xD8, 0xB9, 0xD8, 0x8B, 0x0D, 0xE7, 0x9B, 0xD0, 0xC4, 0x22, 0x67, 0xF9, 0x33, 0x29, 0x1E, 0xEF,
+    0x47, 0x31, 0xF5, 0x9C, 0x06, 0x28, 0x73, 0x13, 0x5A, 0x2A, 0xED, 0xCA, 0xE3, 0xB6, 0x52, 0x43,
+    0x29, 0x9F, 0xF4, 0x9D, 0x36, 0x26, 0x3E, 0x21, 0xF1, 0x06, 0x89, 0x43, 0x1B, 0x25, 0x2D, 0xA5,
+    0xBA, 0xA4, 0xFD, 0x6C, 0x76, 0xDC, 0xFE, 0x65, 0x05, 0x46, 0x49, 0x43, 0xA9, 0xD3, 0x66, 0xD1,
+    0xFA, 0x50, 0x22, 0x0C, 0x50, 0xEA, 0x6A, 0xBE, 0x74, 0xA3, 0x1D, 0x23, 0x4D, 0x66, 0xAF, 0x62,
+    0xB9, 0x31, 0xB2, 0xD3, 0xFA, 0xF1, 0x4F, 0x1E, 0x0B, 0x4E, 0x8A, 0x56, 0xDA, 0xAB, 0x15, 0x15,
+    0x2A, 0xE4, 0xFB, 0xDC, 0x4D, 0x6D, 0x52, 0x03, 0xD7, 0x81, 0xD7, 0xCB, 0xB5, 0x1D, 0xC0, 0xCE,
+    0xFB, 0x89, 0xC5, 0x6F, 0x6E, 0xCA, 0x88, 0xE4, 0x23, 0xF0, 0xDB, 0x3F, 0xF9, 0x4D, 0x12, 0xAD,
+    0xA7, 0xBD, 0x19, 0xD3, 0x64, 0x8E, 0x3F, 0x88, 0x1F, 0xC0, 0x07, 0xF7, 0xBD, 0x07, 0x56, 0x6B,
+    0xEA, 0x84, 0xD2, 0x93, 0xA2, 0x9D, 0xEA, 0x60, 0x56, 0x46, 0xC6, 0x3F, 0x79, 0x2C, 0xD8, 0x0C,
+    0xB8, 0xE7, 0x66, 0x36, 0xB1, 0x50, 0x21, 0xDF, 0x24, 0x50, 0xB3, 0x63, 0x93, 0x70, 0x7B, 0x3E,
+    0x91, 0xB0, 0x1F, 0x96, 0x93, 0xC2, 0xFB, 0xCD, 0x78, 0x34, 0x4E, 0xE5, 0x70, 0x9C, 0x53, 0xBD,
+    0xB3, 0x01, 0xF9, 0x3F, 0xED, 0x71, 0x69, 0x3B, 0xE9, 0x4B, 0x8C, 0x27, 0x72, 0xCE, 0x04, 0x7D,
+    0xEA, 0xF7, 0xAA, 0x74, 0x6F, 0xE5, 0x76, 0x90, 0x0A, 0x7D, 0x97, 0x84, 0x34, 0xD8, 0xF9, 0x4C,
+    0x13, 0x49, 0xBE, 0xA6, 0xE6, 0xE0, 0xA5, 0xCB, 0x83, 0xA7, 0x4D, 0x82, 0xD0, 0xB3, 0xEE, 0xFB,
+    0xB4, 0xD2, 0xD2, 0xEC, 0xDC, 0xB7, 0x71, 0xC4, 0x6C, 0x7F, 0xF0, 0xBB, 0xCB, 0xF1, 0x56, 0xD6,
+    0x1D, 0x9E, 0xFC, 0x54, 0x9F, 0x91, 0x0D, 0x8C, 0x1F, 0xE6, 0x05, 0xDA, 0x9B, 0x91, 0xDD, 0xCE,
+    0xD5, 0x3A, 0x0E, 0xEE, 0xB5, 0xAD, 0xD0, 0x63, 0x0B, 0x40, 0xF9, 0x62, 0xC7, 0xA8, 0xC9, 0xBC,
+    0x61, 0xA7, 0x4F, 0xA4, 0xA6, 0x46, 0x20, 0xD2, 0x2B, 0x94, 0x92, 0x87, 0x0D, 0x6C, 0xF8, 0xDC,
+    0x39, 0x75, 0x09, 0x97, 0x76, 0xA5, 0x6E, 0xF3, 0x28, 0x77, 0x4A, 0x43, 0x02, 0xF8, 0xB5, 0x14,
+    0x29, 0x2E, 0xFE, 0x06, 0x4D, 0x0F, 0xA2, 0x8C, 0xB4, 0x53, 0x2A, 0x85, 0x8E, 0x20, 0xFA, 0x2E,
+    0xF1, 0xAF, 0x76, 0x6D, 0x26, 0x4A, 0xD9, 0x00, 0xFD, 0xEB, 0x21, 0x99, 0x49, 0x56, 0x83, 0x8D,
+    0x1B, 0xD0, 0xE8, 0x84, 0x56, 0x4D, 0x58, 0xC7, 0x9F, 0xC8, 0x11, 0x02, 0x34, 0x49, 0x70, 0xBE,
+    0x1E, 0x6A, 0x38, 0xCD, 0xA7, 0x4D, 0x65, 0x50, 0x7C, 0xE9, 0x2A, 0x8C, 0x09, 0x43, 0xA7, 0x75,
+    0xF0, 0xEC, 0x3F, 0xC8, 0x08, 0x9C, 0x4F, 0xFD, 0x6E, 0xAD, 0x4F, 0xBA, 0x99, 0x72, 0x67, 0x3C,
+    0xFA, 0x34, 0xF4, 0x48, 0x04, 0xBB, 0xF6, 0x1D, 0x8C, 0x3F, 0x9C, 0x8F, 0x6C, 0xD9, 0x25, 0x99,
+    0x41, 0x38, 0x9A, 0x90, 0x13, 0x1F, 0x62, 0xC3, 0x21, 0x9D, 0x66, 0xF4, 0xB9, 0x49, 0xC3, 0xE4,
+    0x5E, 0x48, 0x0F, 0x55, 0x82, 0x66, 0xD9, 0xC0, 0xDB, 0xCF, 0x2F, 0xD0, 0xBC, 0xBA, 0x65, 0xB7,
+    0x6E, 0x62, 0xEF, 0x4F, 0x61, 0xF7, 0xAF, 0xEC, 0x1B, 0xAC, 0x4F, 0xFA, 0x06, 0x4D, 0xC4, 0xC4,
+    0x62, 0xCB, 0x7D, 0x83, 0xED, 0x3C, 0x76, 0x54, 0xD1, 0x0D, 0xF0, 0x31, 0x7D, 0x83, 0xF1, 0x3F,
+    0xA1, 0x6F, 0xD0, 0x2C, 0x0E, 0xCA, 0xD8, 0x7A, 0x90, 0x0D, 0x79, 0xE5, 0xB5, 0x3F, 0xDD, 0x7F,
+    0x03, 0x5B, 0x30, 0x31, 0xF5, 0xBC, 0xDB, 0x85, 0x3D, 0x0F, 0x6A, 0xEF, 0xFB, 0x0E, 0xBB, 0x38,
+    0x8F, 0xD9, 0x9B, 0x29, 0x8F, 0x69, 0xA3, 0x70, 0x32, 0xB1, 0xF1, 0xB4, 0xAF, 0xFB, 0xE4, 0x3A,
+    0xC7, 0x21, 0x8F, 0xE8, 0xEF, 0x6A, 0x3A, 0x7B, 0x6B, 0x55, 0xD2, 0x74, 0x0D, 0x47, 0x6F, 0xE1,
+    0x85, 0x7C, 0x52, 0xB3, 0x61, 0x17, 0xEC, 0x8A, 0x9B, 0x71, 0x33, 0xBF, 0x36, 0x83, 0xB9, 0x7F,
+    0xE0, 0x71, 0x70, 0x13, 0x82, 0x76, 0x4E, 0x3D, 0x3A, 0x66, 0x25, 0x15, 0x0A, 0x92, 0xE5, 0xA6,
+    0x9E, 0x4C, 0xAA, 0x38, 0x02, 0x66, 0xDF, 0x39, 0x8C, 0x37, 0x0D, 0x6F, 0x91, 0x7C, 0x46, 0x5A,
+    0x40, 0xB9, 0x48, 0xC3, 0xC9, 0x60, 0x37, 0xA9, 0x43, 0x27, 0xF5, 0x06, 0xCC, 0x87, 0xF9, 0xE0,
+    0xD6, 0x33, 0xAD, 0x91, 0xA9, 0x37, 0x33, 0x5F, 0x3A, 0x1A, 0xCC, 0x0E, 0x2E, 0x20, 0xCF, 0x1D,
+    0xE7, 0x3F, 0x66, 0x9B, 0x84, 0x8F, 0x30, 0x11, 0x1B, 0x48, 0xC3, 0x9E, 0xBB, 0x8E, 0x68, 0xE7,
+    0x3A, 0x40, 0xA1, 0x22, 0x75, 0x5E, 0x3A, 0x7F, 0x34, 0x1E, 0x51, 0xC7, 0x9D, 0x13, 0x2D, 0x74,
+    0x9A, 0x80, 0xDC, 0x7B, 0x94, 0x7D, 0x41, 0x6E, 0xE0, 0xCB, 0x34, 0xEB, 0x7C, 0xDA, 0x7E, 0xFB,
+    0xE5, 0xDC, 0x3A, 0x33, 0x9F, 0x0C, 0x04, 0xFD, 0xCE, 0x99, 0xF6, 0x0B, 0xEB, 0x23, 0xCD, 0xCD,
+    0x88, 0x7B, 0x39, 0xD2, 0xBF, 0x12, 0xD1, 0x0F, 0x23, 0x40, 0x71, 0x9E, 0x0B, 0x26, 0x10, 0xCD,
+    0x5C, 0xC4, 0xFA, 0x6C, 0xC5, 0x9F, 0x3A, 0x3C, 0x84, 0x9D, 0x1F, 0xC4, 0x4D, 0x57, 0x8A, 0x0F,
+    0x57, 0xFC, 0x93, 0xF3, 0xBA, 0x92, 0xDB, 0xCA, 0x52, 0xC5, 0x3F, 0xB7, 0x08, 0x8E, 0x5F, 0x5C,
+    0xDC, 0xCB, 0x47, 0x8B, 0xE0, 0x57, 0xCF, 0x75, 0x0F, 0x98, 0xC9, 0x12, 0xAA, 0xEE, 0xB2, 0xF1,
+    0x0F, 0x31, 0x37, 0xDD, 0xE5, 0xC6, 0x37, 0x0A, 0x46, 0x2B, 0x9F, 0xFC, 0x0C, 0xD8, 0x0E, 0xE3,
+    0x29, 0xC3, 0x07, 0x9B, 0x09, 0xEC, 0xD9, 0x66, 0x82, 0xB4, 0x92, 0x7B, 0x9F, 0x57, 0x73, 0x6A,
+    0x26, 0x98, 0x3E, 0xB2, 0x99, 0xA0, 0x3E, 0x6D, 0x26, 0x08, 0x50, 0x6B, 0x80, 0x7B, 0xB7, 0x43,
+    0x05, 0x6D, 0x3D, 0xF0, 0xCF, 0xF3, 0x7E, 0x16, 0x9D, 0x55, 0x44, 0xF2, 0x6D, 0x87, 0x09, 0xE0,
+    0xD2, 0xDE, 0x2D, 0x2F, 0x9C, 0xF4, 0x16, 0xB4, 0x1E, 0xB3, 0x82, 0xF3, 0x54, 0x31, 0x69, 0xCD,
+    0xBF, 0x7F, 0x32, 0x92, 0xC0, 0x58, 0x87, 0xD3, 0x08, 0xD8, 0xFE, 0x62, 0xFF, 0x87, 0x27, 0xA1,
+    0x40, 0xF9, 0x1E, 0xA7, 0x54, 0x28, 0x6E, 0x2A, 0x9E, 0x01, 0x84, 0x4D, 0x9D, 0x18, 0x0F, 0x01,
+    0xED, 0x5C, 0x2C, 0x80, 0x3A, 0x9B, 0x05, 0x92, 0x40, 0x33, 0x27, 0xBD, 0x44, 0x57, 0xCF, 0xE9,
+    0x3D, 0x3D, 0x93, 0xD4, 0x91, 0x81, 0xDE, 0x57, 0x52, 0x28, 0x77, 0xDA, 0xC1, 0x79, 0xBB, 0x24,
+    0xE1, 0xAA, 0x37, 0xC1, 0xC4, 0x52, 0xB4, 0xBE, 0x9D, 0x6D, 0x44, 0xCF, 0xA9, 0x73, 0xB3, 0x91,
+    0xD6, 0x42, 0x5D, 0x23, 0x0D, 0x76, 0x63, 0xD4, 0x1B, 0xB9, 0xCA, 0xC2, 0xF5, 0x44, 0x8D, 0x99,
+    0x70, 0xB8, 0x99, 0x04, 0x73, 0xFB, 0x1F, 0x44, 0x30, 0xBB, 0x9B, 0x7F, 0xED, 0x3D, 0xAD, 0x59,
+    0x5B, 0xFB, 0x07, 0xE0, 0xBA, 0x62, 0x86, 0x88, 0xED, 0xA8, 0x66, 0x1E, 0x80, 0xB6, 0x2B, 0x02,
+    0x44, 0x6A, 0x8F, 0x09, 0x38, 0xD1, 0x0C, 0x48, 0xBC, 0x40, 0xE5, 0x5F, 0x30, 0x0B, 0x0F, 0x15,
+    0x8B, 0xF5, 0x2C, 0xD6, 0x8F, 0x54, 0x6F, 0xEE, 0x26, 0xD2, 0x2A, 0xD8, 0x19, 0xED, 0xF4, 0xDD,
+    0xD1, 0xC3, 0x52, 0x08, 0xDC, 0x94, 0xA5, 0x5D, 0x8C, 0xBE, 0xDA, 0xA0, 0xDA, 0x0B, 0x75, 0xE0,
+    0x42, 0xB2, 0x8A, 0xEB, 0x6B, 0xDA, 0x4B, 0xE7, 0xB4, 0xA8, 0x5E, 0xA7, 0xC2, 0x71, 0x5A, 0xE2,
+    0x09, 0x47, 0x14, 0x07, 0xED, 0x9A, 0xF5, 0xA9, 0x9C, 0xB4, 0x0D, 0xE9, 0x67, 0x1A, 0xC0, 0x45,
+    0x17, 0xC1, 0x2A, 0x89, 0xAF, 0x7D, 0xA3, 0x99, 0x71, 0x41, 0xA2, 0xDD, 0xA9, 0x13, 0x30, 0xE8,
+    0xD5, 0x1D, 0x0D, 0xD1, 0x99, 0x62, 0x19, 0xAA, 0x19, 0xC7, 0x15, 0xD8, 0x4C, 0xA0, 0x88, 0x0E,
+    0xCC, 0xBB, 0x21, 0x75, 0x55, 0xA6, 0xB2, 0x48, 0x3F, 0x1C, 0xED, 0x34, 0x5B, 0x5E, 0xA9, 0xEE,
+    0x87, 0x81, 0x72, 0x6B, 0x67, 0xDA, 0xA9, 0x0F, 0xE5, 0x8E, 0xE6, 0xA3, 0x76, 0x72, 0xFE, 0xEC,
+    0x36, 0x47, 0x67, 0x5E, 0x5A, 0x49, 0xFA, 0x81, 0x24, 0xBD, 0xA6, 0xA3, 0xF6, 0x7C, 0x90, 0x2B,
+    0x8A, 0x89, 0x49, 0x8D, 0x69, 0xFF, 0x97, 0xE5, 0xFE, 0x6B, 0xD7, 0xAE, 0x5D, 0xBB, 0xF6, 0x0C,
+    0xE5, 0x5A, 0xCD, 0x38, 0x5E, 0xC0, 0x04, 0xEB, 0xB9, 0x52, 0x44, 0xEC, 0xD4, 0x0E, 0x44, 0x13,
+    0x68, 0x06, 0x47, 0xB9, 0x54, 0x33, 0x8E, 0x8D, 0x2A, 0x58, 0xCF, 0x8B, 0x45, 0xC4, 0xFA, 0xB6,
+    0x3B, 0xF9, 0xD8, 0x2C, 0x75, 0xFE, 0x78, 0xB6, 0x9E, 0x17, 0x8A, 0x15, 0xEB, 0xDB, 0xAE, 0x88,
+    0x26, 0xD0, 0x0E, 0x3D, 0x66, 0xA9, 0x27, 0xEE, 0xE7, 0xBB, 0xB9, 0xE7, 0x6F, 0x75, 0x92, 0xF4,
+    0x92, 0x4E, 0x60, 0xD3, 0x11, 0x81, 0x24, 0xE9, 0xCC, 0x37, 0x26, 0xFA, 0xB5, 0x94, 0xB7, 0x3B,
+    0x2E, 0x94, 0xEA, 0x6C, 0x44, 0x53, 0xBD, 0x73, 0xFF, 0x33, 0xF4, 0x0B, 0x9A, 0x0B, 0x79, 0x23,
+    0xAA, 0x9D, 0x7A, 0xC3, 0x46, 0xDA, 0x95, 0xFB, 0x9F, 0xF9, 0x95, 0x47, 0x8C, 0x4B, 0xBF, 0xA2,
+    0x79, 0x0C, 0x85, 0xBC, 0xBC, 0x51, 0xA9, 0xAE, 0xDA, 0x8D, 0xA8, 0xB7, 0x7A, 0xC7, 0x46, 0x1B,
+    0x69, 0xD7, 0x26, 0x72, 0xFF, 0x33, 0xF7, 0x3F, 0x03, 0xF7, 0x0E, 0x90, 0x2B, 0x71, 0x8D, 0x3F,
+    0x29, 0xFA, 0xDA, 0xFC, 0x72, 0x05, 0xFB, 0x37, 0xC3, 0x28, 0x3D, 0x9A, 0x94, 0x9B, 0xEB, 0xC5,
+    0xB1, 0xA3, 0x8C, 0xB9, 0xA2, 0xD4, 0x51, 0xC4, 0x54, 0x32, 0x3C, 0xFB, 0x32, 0x29, 0x2A, 0xAB,
+    0x90, 0x80, 0x52, 0x7E, 0xD9, 0xFA, 0xE4, 0x22, 0x17, 0x28, 0x3D, 0x54, 0xDC, 0xC6, 0x30, 0x70,
+    0x86, 0xA8, 0xC1, 0x0D, 0xB9, 0x7C, 0xD5, 0x1F, 0xBA, 0xF4, 0xED, 0xCC, 0xC7, 0x77, 0xF4, 0xF2,
+    0x55, 0xEE, 0x4B, 0xF7, 0x4E, 0xEF, 0x7F, 0x2B, 0x7D, 0xDC, 0x7C, 0xE4, 0xD1, 0x4D, 0xEE, 0xB4,
+    0x6F, 0xA5, 0x50, 0x69, 0xBB, 0xF8, 0x81, 0x8F, 0xED, 0xD9, 0x1F, 0x27, 0x1E, 0x6D, 0x34, 0x7F,
+    0x04, 0x98, 0x33, 0x10, 0x4C, 0x0A, 0x59, 0x7B, 0x6B, 0x0F, 0x15, 0xCD, 0x4A, 0x79, 0x92, 0x5C,
+    0x76, 0xA9, 0xA0, 0x60, 0x94, 0xCB, 0x1C, 0x49, 0x2C, 0x29, 0x2A, 0x65, 0x41, 0x55, 0xDA, 0x7F,
+    0x20, 0x25, 0xA7, 0x1B, 0xBD, 0x52, 0xB7, 0xC3, 0x61, 0xBC, 0x8C, 0x27, 0xFA, 0xBB, 0x39, 0xD1,
+    0xFC, 0x75, 0x44, 0x4B, 0xA3, 0x9B, 0x0A, 0xED, 0x1B, 0xE5, 0x9C, 0x76, 0x72, 0xB2, 0x61, 0x7C,
+    0x6A, 0x6F, 0x17, 0x4D, 0x67, 0x5E, 0x3A, 0xE7, 0x4E, 0x37, 0x3D, 0x6A, 0x3C, 0xE5, 0x4C, 0x84,
+    0x3F, 0xF2, 0xD6, 0x53, 0xBC, 0xDB, 0x6D, 0xF0, 0x3B, 0xFF, 0xB7, 0x9D, 0xE1, 0x73, 0xE1, 0x45,
+    0x40, 0x5F, 0x08, 0x50, 0x2E, 0x3D, 0xC7, 0x16, 0x08, 0xA9, 0xC9, 0xDF, 0xA4, 0xC0, 0x3A, 0x9C,
+    0x36, 0xF2, 0x7A, 0xA0, 0x8C, 0xE7, 0xCA, 0x81, 0x66, 0xFA, 0xF6, 0x7F, 0xD3, 0x15, 0x7B, 0xF5,
+    0xEC, 0xBF, 0xA3, 0x99, 0xEF, 0xFF, 0x0F, 0xDF, 0x43, 0x8C, 0xAD, 0xB7, 0xA1, 0x08, 0x97, 0xB3,
+    0xB4, 0x0E, 0x85, 0x4A, 0x5D, 0xBB, 0x22, 0x5F, 0x25, 0x3B, 0x1C, 0x9A, 0xC8, 0xE3, 0x57, 0x41,
+    0x41, 0xA1, 0xD2, 0x23, 0xEA, 0xDA, 0xB5, 0x89, 0xC8, 0x8F, 0x53, 0xB5, 0x1B, 0xE1, 0x82, 0x5B,
+    0x4A, 0x3D, 0xA9, 0xA1, 0x89, 0x36, 0xF2, 0xF8, 0xD5, 0xC7, 0x53, 0xBE, 0x50, 0x2C, 0xD6, 0xDF,
+    0x68, 0xFD, 0x66, 0x7F, 0xBA, 0x34, 0x7E, 0x73, 0xE5, 0xD2, 0x7C, 0x73, 0x72, 0x26, 0x7C, 0xCD,
+    0x4C, 0x9F, 0x3D, 0x76, 0x1E, 0x1A, 0xAB, 0xE0, 0x1E, 0x5E, 0xEB, 0x01, 0xE0, 0xF9, 0xB6, 0x7A,
+    0x3B, 0xDA, 0xD7, 0xD6, 0xF6, 0x1B, 0xC1, 0x59, 0x7F, 0xD9, 0x1E, 0x33, 0x75, 0xB9, 0x9A, 0x5A,
+    0xB3, 0xB8, 0x27, 0x63, 0x1D, 0x7A, 0xB3, 0x5A, 0xBF, 0x55, 0xA1, 0x7D, 0x78, 0xB5, 0xFE, 0xC1,
+    0x72, 0xCA, 0xDF, 0x29, 0x03, 0xB4, 0x13, 0x46, 0x9E, 0x5E, 0xDE, 0xAE, 0xF2, 0xD7, 0x9E, 0xBC,
+    0xD6, 0x01, 0xFC, 0x36, 0x95, 0x37, 0x6B, 0xB1, 0x33, 0x76, 0x6E, 0xA8, 0x57, 0xFA, 0xA9, 0x14,
+    0x76, 0xC1, 0x51, 0xCC, 0x69, 0x73, 0xA9, 0x89, 0x72, 0xC6, 0x2C, 0x54, 0x2B, 0xE5, 0x46, 0xB1,
+    0x61, 0x22, 0x2E, 0xA4, 0x6F, 0xB5, 0x03, 0x0F, 0xC0, 0x70, 0x5B, 0xD2, 0x95, 0x77, 0x63, 0x3A,
+    0x09, 0x69, 0xA9, 0x63, 0x10, 0xB7, 0x1A, 0x7D, 0x61, 0x83, 0x5A, 0x5C, 0x7C, 0x6C, 0x4B, 0xD2,
+    0xEC, 0x76, 0x03, 0xDA, 0x3D, 0x41, 0x61, 0x23, 0x9F, 0x94, 0xED, 0xDA, 0x92, 0x5B, 0x6E, 0x12,
+    0x83, 0x5A, 0xBD, 0x2B, 0xAD, 0x26, 0x62, 0xB6, 0x5E, 0x4B, 0x21, 0x0A, 0x59, 0x2D, 0x8C, 0x1E,
+    0xBD, 0xA2, 0x05, 0x37, 0xD3, 0xBF, 0xAB, 0x9D, 0x76, 0xE5, 0x9E, 0x4B, 0x92, 0xBF, 0xE3, 0xC2,
+    0xD1, 0x8E, 0x70, 0xCA, 0xC5, 0x5A, 0xBD, 0x99, 0x79, 0x98, 0x57, 0x95, 0xCA, 0x79, 0x93, 0x4B,
+    0xCC, 0xB3, 0x4F, 0xED, 0x9B, 0xF2, 0x69, 0x37, 0x0B, 0xF9, 0x54, 0x2C, 0x3D, 0x43, 0x7F, 0x9C,
+    0x3F, 0x01, 0x71, 0x9C, 0xD9, 0xB9, 0x2C, 0x8B, 0xB1, 0x4F, 0x74, 0x09, 0xA7, 0xFA, 0x09, 0x80,
+    0x73, 0x79, 0x37, 0xB4, 0xAC, 0xB5, 0xCE, 0x9E, 0xA1, 0xFE, 0xC0, 0x4B, 0x4F, 0xB1, 0xDF, 0xFE,
+    0x32, 0x3B, 0x20, 0xFB, 0x61, 0x27, 0x91, 0x07, 0x32, 0x66, 0x9A, 0xD4, 0x63, 0x05, 0x7D, 0xA4,
+    0xD4, 0x9C, 0xB4, 0xC3, 0xF9, 0x31, 0x00, 0x85, 0x07, 0xCA, 0xF9, 0x00, 0x3C, 0x55, 0x20, 0xB7,
+    0x46, 0xF6, 0xA9, 0x90, 0x3C, 0xD1, 0xEA, 0xAD, 0x40, 0xA3, 0x97, 0x57, 0xEE, 0x74, 0x4F, 0xAD,
+    0xD0, 0x3F, 0xB2, 0xC2, 0x68, 0x56, 0x50, 0xB5, 0xC0, 0x5E, 0x07, 0x8A, 0xCD, 0xCE, 0x94, 0xB1,
+    0xF7, 0xA9, 0x5F, 0xA8, 0x4A, 0x85, 0xB4, 0x25, 0x27, 0x22, 0xA7, 0xBB, 0xDF, 0xD8, 0x93, 0x24,
+    0xA6, 0xFD, 0x55, 0x90, 0x7E, 0xEC, 0xB2, 0x58, 0xC3, 0xA4, 0xA7, 0x13, 0x0D, 0xB8, 0x8E, 0x1C,
+    0xB3, 0xDD, 0x49, 0x3D, 0xB4, 0x38, 0xE9, 0x67, 0xD2, 0x96, 0x5A, 0xBE, 0xA9, 0xE7, 0xFA, 0x27,
+    0x52, 0xE8, 0xB5, 0xD4, 0x5A, 0x12, 0xE2, 0xBE, 0x13, 0xF8, 0xAF, 0xFE, 0xBA, 0xA3, 0xFE, 0x3F,
+    0x9F, 0x4F, 0xDD, 0x4A, 0xA5, 0x3A, 0x18, 0x77, 0x68, 0x6F, 0xCD, 0xF0, 0xF4, 0x7F, 0x3B, 0xF0,
+    0xB5, 0xE5, 0xF9, 0xF3, 0xDF, 0x7C, 0xEC, 0xAD, 0x17, 0x9C, 0xA4, 0xAF, 0x6B, 0x1E, 0x7D, 0xBD,
+    0xB5, 0xFA, 0xA6, 0xB4, 0xAF, 0x7F, 0xF1, 0x83, 0xFF, 0xF1, 0x25, 0x1E, 0xE0, 0x73, 0x67, 0xB6,
+    0xA9, 0x3B, 0x7F, 0x2A, 0x20, 0x8C, 0xA7, 0x9D, 0x40, 0xDB, 0x69, 0x6B, 0xD0, 0x78, 0xEA, 0x38,
+    0x7A, 0x0E, 0x81, 0xC1, 0x6D, 0x3E, 0xC4, 0x9F, 0xEC, 0xAB, 0x92, 0x7C, 0xC8, 0x06, 0x49, 0xF1,
+    0x91, 0xF5, 0xC3, 0xA9, 0xE6, 0xA8, 0x33, 0x2F, 0xBB, 0x0F, 0x16, 0xFD, 0x3A, 0xAA, 0xB4, 0x43,
+    0x13, 0x36, 0x79, 0xD4, 0xB5, 0x96, 0x02, 0xE3, 0x1B, 0xED, 0xA4, 0x7F, 0xDF, 0x0F, 0x66, 0x62,
+    0xAF, 0x87, 0x32, 0x72, 0x17, 0x76, 0xBE, 0x2B, 0x6D, 0x40, 0xB6, 0xE7, 0x93, 0x36, 0xD3, 0x51,
+    0x78, 0x3A, 0xF4, 0xAD, 0x29, 0x84, 0x61, 0x97, 0x24, 0xB4, 0xAC, 0xF6, 0x84, 0x88, 0x2B, 0x79,
+    0xEE, 0x53, 0x47, 0xA5, 0x39, 0x89, 0xC1, 0xB5, 0x50, 0x68, 0x4E, 0xCB, 0xB4, 0x0D, 0x09, 0x3B,
+    0x1B, 0x65, 0x36, 0x24, 0x55, 0x82, 0x72, 0x2B, 0xEE, 0x38, 0xC0, 0xDE, 0xC1, 0x1D, 0x69, 0x1B,
+    0xBB, 0x8F, 0x79, 0xDC, 0xD3, 0x9D, 0x6E, 0x0C, 0x51, 0x2F, 0x79, 0x99, 0x88, 0xB3, 0x27, 0x19,
+    0x32, 0xF6, 0x59, 0xB2, 0x58, 0xEB, 0x94, 0xA9, 0x5A, 0xA1, 0x84, 0x51, 0x33, 0xC5, 0x9C, 0xEA,
+    0x6F, 0x2F, 0xA0, 0x37, 0x9C, 0xC7, 0x61, 0x3B, 0xB3, 0xD0, 0xF8, 0x02, 0xB6, 0x14, 0xBD, 0x5C,
+    0x67, 0xD2, 0x5E, 0x6C, 0xA9, 0x9A, 0x11, 0x50, 0x62, 0xE2, 0x5D, 0x47, 0xA6, 0x0D, 0xA8, 0x36,
+    0x6C, 0x80, 0x76, 0xA7, 0x5A, 0x61, 0xDC, 0x29, 0xB7, 0x04, 0xB9, 0x94, 0x34, 0x45, 0xFD, 0x40,
+    0x1D, 0xA1, 0x9E, 0xD2, 0x05, 0x7D, 0x2F, 0x21, 0xAE, 0x4F, 0x9C, 0xCC, 0xCF, 0x1F, 0x7C, 0xDC,
+    0x8D, 0x5E, 0x4C, 0x8B, 0xA0, 0x1F, 0x28, 0x35, 0xE0, 0x66, 0xD0, 0x84, 0x4D, 0xF7, 0x54, 0x6F,
+    0xE0, 0x52, 0xB3, 0x7E, 0xA3, 0x0C, 0xCB, 0xCE, 0x94, 0x6F, 0x8A, 0xEE, 0xBE, 0x15, 0x30, 0x37,
+    0x73, 0xF7, 0x9D, 0x34, 0x41, 0xAD, 0x5F, 0x36, 0x01, 0xEC, 0x5B, 0x5D, 0x15, 0xC0, 0xFE, 0x5F,
+    0x98, 0x05, 0xDA, 0xD4, 0x68, 0xE2, 0x06, 0xEA, 0x00, 0x7D, 0x87, 0x0D, 0x30, 0xA6, 0x39, 0xDF,
+    0x93, 0xDB, 0x48, 0x5B, 0x03, 0x98, 0x48, 0xBB, 0x83, 0x89, 0xA5, 0x16, 0xA8, 0x56, 0x23, 0x0F,
+    0x76, 0xA9, 0x52, 0xD6, 0x93, 0xD2, 0xC3, 0x39, 0x11, 0x66, 0x77, 0x35, 0x39, 0xD1, 0xB8, 0xFA,
+    0xF1, 0x37, 0x59, 0x88, 0x8B, 0x80, 0x51, 0x91, 0xB4, 0x67, 0x29, 0x07, 0x53, 0xB5, 0x01, 0xCD,
+    0x9E, 0x12, 0xAE, 0xFC, 0xE7, 0xA3, 0x76, 0x54, 0xF3, 0x59, 0xE8, 0xCA, 0xE9, 0xF2, 0x39, 0x36,
+    0xC4, 0xCC, 0x82, 0xCE, 0x63, 0x33, 0x92, 0xF1, 0x36, 0x2D, 0xAF, 0x1B, 0xE0, 0x8E, 0xF3, 0x49,
+    0xAD, 0x1D, 0xB1, 0x33, 0x14, 0x4A, 0xC7, 0xCB, 0x9B, 0x15, 0xE8, 0xE7, 0x04, 0x77, 0xD6, 0x0F,
+    0x1C, 0xDF, 0x77, 0xB7, 0x11, 0x7F, 0x13, 0xA7, 0xEB, 0xED, 0xE4, 0xFC, 0xEB, 0x6D, 0xE7, 0xCF,
+    0xB8, 0x74, 0x4C, 0x6A, 0x80, 0xFE, 0xE9, 0x04, 0x0E, 0x5E, 0x49, 0xA1, 0xE7, 0xB5, 0xB4, 0x5E,
+    0xDF, 0x4E, 0x7E, 0x68, 0xB9, 0x78, 0xFE, 0x34, 0x06, 0x94, 0xDB, 0x6D, 0xEC, 0x61, 0xFE, 0xD3,
+    0x0F, 0xB7, 0x9D, 0x7F, 0x3E, 0x7B, 0xFE, 0x7A, 0xBD, 0xED, 0xFE, 0x73, 0x78, 0xCC, 0x71, 0xE6,
+    0x70, 0x06, 0x2F, 0xF0, 0xB6, 0xFF, 0xDE, 0x1F, 0x3D, 0xF8, 0xFF, 0x7C, 0xEA, 0x56, 0xFD, 0x3F,
+    0xDF, 0xFC, 0xD1, 0x3C, 0x86, 0x66, 0x29, 0x9E, 0x81, 0xDF, 0xE2, 0x01, 0xA2, 0x79, 0xFE, 0xB7,
+    0xBF, 0xFA, 0xE0, 0xAA, 0x58, 0xCE, 0x66, 0x2A, 0xAE, 0x75, 0x9A, 0xFE, 0x25, 0x9F, 0xC6, 0xAE,
+    0xE6, 0x7A, 0x57, 0xCC, 0xFF, 0x6A, 0x71, 0xB1, 0x89, 0xC5, 0x05, 0xB8, 0x7F, 0xE8, 0xE7, 0xAF,
+    0xF1, 0xE0, 0xD5, 0x66, 0xAB, 0x5F, 0x79, 0xD9, 0xCF, 0xE1, 0xFB, 0x2E, 0x96, 0x2B, 0xD0, 0x6F,
+    0x8F, 0xDF, 0xE0, 0x6B, 0x84, 0x32, 0x98, 0xA9, 0xF6, 0x76, 0x70, 0x69, 0x8F, 0xB3, 0xDE, 0x7F,
+    0xED, 0xAB, 0x9F, 0xFE, 0x74, 0xB5, 0x95, 0x6F, 0x3D, 0xE2, 0xE7, 0xF0, 0xBC, 0x8B, 0x49, 0x93,
+    0x73, 0x17, 0x1A, 0xC2, 0xF7, 0xFE, 0xE5, 0xEF, 0x7F, 0xDA, 0xD6, 0xF2, 0xE3, 0x4C, 0xE8, 0xD7,
+    0xD3, 0x4D, 0x8D, 0x8A, 0xF7, 0x92, 0xE8, 0x03, 0x23, 0x2D, 0xF4, 0x4B, 0x3F, 0xD4, 0x6B, 0xB1,
+    0x22, 0xDA, 0xA1, 0x99, 0xCC, 0x5A, 0x46, 0xFA, 0xCE, 0xF9, 0x3A, 0x54, 0x2B, 0x62, 0x1C, 0x9A,
+    0x60, 0x97, 0x72, 0x2F, 0x84, 0x9B, 0xDA, 0x50, 0x6D, 0x46, 0x8C, 0x9E, 0x2B, 0x7C, 0xE6, 0x73,
+    0xD5, 0x53, 0xC3, 0x5F, 0x7C, 0xCE, 0xFE, 0xC5, 0x93, 0x7F, 0xFB, 0xFD, 0x4F, 0x35, 0xA5, 0xE6,
+    0x26, 0xF2, 0x22, 0xFC, 0x0B, 0x3B, 0xBB, 0xEE, 0x81, 0x22, 0xD4, 0xC3, 0x03, 0x84, 0x7E, 0xD7,
+    0x0C, 0xC5, 0xB3, 0xF4, 0xCB, 0xB9, 0x6A, 0xE0, 0x6B, 0x58, 0xAA, 0xB9, 0x5C, 0x8B, 0x1D, 0xB7,
+    0xD5, 0x69, 0x39, 0x5D, 0xC0, 0x2D, 0x85, 0x19, 0xF8, 0x6A, 0xB9, 0xF1, 0x87, 0x33, 0x9F, 0x2A,
+    0xDF, 0x9C, 0x5D, 0xAC, 0x76, 0x28, 0x3B, 0xE3, 0x4D, 0x30, 0x97, 0xCD, 0xFF, 0x66, 0x5E, 0x7F,
+    0x4A, 0xCB, 0x97, 0x56, 0x9E, 0xE7, 0x21, 0x8A, 0x8B, 0x9D, 0xA6, 0xAF, 0xF2, 0x69, 0xEC, 0x5A,
+    0x5E, 0xEF, 0x8A, 0xF9, 0x7F, 0x0F, 0x6E, 0xB5, 0x0B, 0xDC, 0x3F, 0x34, 0xB1, 0x1A, 0xF8, 0xFB,
+    0xAE, 0xD9, 0xCB, 0x10, 0x1E, 0xB4, 0xE6, 0xE6, 0xDC, 0x46, 0x76, 0xEE, 0x7F, 0xB6, 0xDF, 0x78,
+    0x80, 0xEF, 0x13, 0xCC, 0x5C, 0x79, 0xEB, 0x9B, 0x2E, 0x75, 0x58, 0x75, 0x9F, 0xBD, 0x6C, 0x9E,
+    0xF2, 0x5F, 0xFB, 0x5A, 0x29, 0xFA, 0xF0, 0xA9, 0xDA, 0xBC, 0x1A, 0xDC, 0x9E, 0x09, 0xA6, 0xBB,
+    0x69, 0x96, 0xEA, 0x91, 0x61, 0x7E, 0xE0, 0xB7, 0xEB, 0x41, 0x4B, 0x25, 0x8A, 0xD9, 0x45, 0x73,
+    0x24, 0x40, 0x9F, 0xED, 0x92, 0x53, 0x2C, 0xF7, 0xEC, 0x53, 0x9B, 0x70, 0x74, 0x38, 0x74, 0xC9,
+    0x64, 0x4C, 0xCC, 0xF1, 0xF2, 0xE4, 0x1F, 0xFD, 0x90, 0x83, 0xF7, 0x9E, 0xAD, 0xDA, 0x1C, 0x60,
+    0xBF, 0x5A, 0xF3, 0x77, 0xEB, 0x90, 0xAD, 0xD0, 0x7E, 0xF8, 0xC5, 0x92, 0x7F, 0xBC, 0x5E, 0xB3,
+    0x2F, 0xAE, 0x62, 0xEE, 0x22, 0x32, 0x3A, 0x84, 0xF8, 0x05, 0x70, 0xDF, 0x70, 0x7C, 0x67, 0x38,
+    0x73, 0x94, 0x0D, 0x39, 0x86, 0xB5, 0xD3, 0x99, 0xCB, 0xB1, 0xC7, 0xE5, 0xB4, 0x47, 0x4B, 0x85,
+    0x8E, 0x6B, 0x3B, 0xFE, 0xD1, 0x7A, 0xA8, 0x96, 0x7C, 0xB0, 0x1B, 0x4E, 0xF7, 0x4F, 0x4C, 0x8A,
+    0x48, 0x9F, 0x6E, 0xB0, 0x5E, 0x3F, 0xB0, 0x77, 0x62, 0x1B, 0x52, 0xA0, 0x30, 0xDB, 0xB1, 0x2E,
+    0x8A, 0xF0, 0x3C, 0x60, 0x5F, 0x99, 0x80, 0x27, 0x5A, 0xC0, 0x84, 0x05, 0x68, 0x1E, 0xF5, 0xC0,
+    0x8D, 0x07, 0x81, 0xFB, 0xDE, 0x5B, 0x8F, 0xBD, 0x0D, 0x25, 0x75, 0x89, 0xF2, 0x2F, 0x72, 0x92,
+    0x12, 0x56, 0x90, 0x5E, 0x99, 0xA8, 0xF4, 0x82, 0x03, 0xF7, 0xEE, 0xDB, 0x0B, 0xA5, 0xFE, 0xEC,
+    0x8B, 0x1E, 0xBB, 0xDD, 0x78, 0x10, 0xFA, 0x77, 0x7E, 0x12, 0x28, 0x75, 0xDD, 0x0E, 0x58, 0xAD,
+    0x37, 0xC0, 0xE9, 0xE5, 0x19, 0xA4, 0xF6, 0xFF, 0xC8, 0x4D, 0x60, 0xB5, 0x72, 0xEB, 0x40, 0x52,
+    0x98, 0xAD, 0xB9, 0xAE, 0x93, 0x1B, 0x06, 0x7F, 0x14, 0x80, 0xD6, 0x0E, 0xC0, 0x7A, 0x03, 0xA8,
+    0x5F, 0x9E, 0x81, 0x7F, 0x7E, 0x2F, 0xBF, 0x41, 0x33, 0xE3, 0xFA, 0xE1, 0x66, 0xC6, 0x53, 0xDA,
+    0xDA, 0x2D, 0xF5, 0x5B, 0x83, 0x11, 0x5A, 0x19, 0x83, 0x7D, 0x7F, 0xB0, 0x7B, 0x11, 0x41, 0xC1,
+    0x81, 0xD5, 0x5F, 0xFD, 0xFD, 0x6D, 0xCD, 0x8C, 0xFD, 0x69, 0x33, 0x63, 0x42, 0xCC, 0x27, 0x52,
+    0xF9, 0x93, 0x12, 0xDE, 0x94, 0x34, 0x53, 0x95, 0x34, 0xE3, 0xA6, 0xC6, 0x13, 0xF3, 0xBE, 0x3A,
+    0x26, 0xF7, 0x4A, 0xAF, 0x09, 0xFE, 0x98, 0x90, 0x77, 0xA7, 0x69, 0xA4, 0xC0, 0xE3, 0xBA, 0x96,
+    0xF6, 0xD6, 0xA0, 0xC9, 0x44, 0x5B, 0x31, 0x2E, 0x60, 0xA5, 0x6F, 0xD1, 0x4B, 0x4B, 0x29, 0x29,
+    0xDC, 0x79, 0xED, 0xDA, 0xB5, 0xE1, 0x84, 0x2E, 0xC5, 0xEC, 0x49, 0xE7, 0xA3, 0xA1, 0xD8, 0x13,
+    0xC6, 0x57, 0xA2, 0xBA, 0x9D, 0x87, 0x56, 0x5D, 0x9B, 0x08, 0x6D, 0x1B, 0xA0, 0x52, 0x4C, 0x5F,
+    0x55, 0xB9, 0x03, 0x1A, 0x7D, 0x56, 0xEE, 0x49, 0x41, 0x99, 0xB9, 0xB8, 0xBE, 0x8F, 0x6F, 0xBD,
+    0xFF, 0x1D, 0x2A, 0x35, 0xEF, 0x46, 0x30, 0x7A, 0x2A, 0xED, 0xFB, 0x34, 0x49, 0x1D, 0x8C, 0xC1,
+    0xC9, 0x83, 0x8B, 0xB5, 0x66, 0x68, 0xF6, 0x22, 0x55, 0x24, 0xBA, 0x3E, 0x82, 0x91, 0xB7, 0xFB,
+    0xD9, 0x68, 0x96, 0x63, 0x6D, 0x38, 0x9A, 0x15, 0xAA, 0xA5, 0xDC, 0x92, 0x3A, 0x3F, 0xED, 0x96,
+    0x9B, 0xF7, 0xD9, 0xA3, 0xFD, 0x9B, 0xEB, 0xF1, 0x98, 0xEA, 0x5E, 0x0A, 0xC7, 0xFE, 0x43, 0xD2,
+    0x0E, 0x85, 0x74, 0xF5, 0xD8, 0xE7, 0x2A, 0x2D, 0xEB, 0x2A, 0x31, 0xAC, 0xDB, 0x19, 0xB9, 0x72,
+    0x3C, 0x4D, 0x07, 0x12, 0xD7, 0x94, 0x28, 0xC8, 0x63, 0x67, 0x87, 0xBC, 0xCB, 0x10, 0x14, 0x21,
+    0x75, 0x85, 0xB5, 0x5C, 0x4E, 0xA9, 0x5E, 0xFA, 0xE7, 0x13, 0x44, 0x0A, 0x0D, 0xB5, 0xEF, 0x3B,
+    0xFA, 0x0D, 0x29, 0x60, 0xFF, 0xB5, 0xB7, 0xDA, 0x29, 0x42, 0xBA, 0x8F, 0x26, 0xEF, 0x14, 0xB1,
+    0x60, 0xF6, 0x4B, 0x49, 0xFE, 0x39, 0x44, 0xE8, 0x97, 0x6A, 0xB1, 0x1E, 0x46, 0x3F, 0x3E, 0xBC,
+    0x01, 0xD1, 0x86, 0x76, 0x02, 0x3B, 0xC9, 0x6C, 0x54, 0x9F, 0xDF, 0x9A, 0xE0, 0xA6, 0x42, 0xBA,
+    0x29, 0xB3, 0xE3, 0xB4, 0xB8, 0xB9, 0x9F, 0x8D, 0xF6, 0xE2, 0x42, 0x71, 0x21, 0xDF, 0x45, 0xAE,
+    0xF0, 0x83, 0xA3, 0x9E, 0x29, 0x56, 0xDA, 0x8E, 0x7A, 0xE2, 0x05, 0x70, 0x94, 0x0B, 0xAC, 0xD4,
+    0x13, 0xF5, 0x44, 0xFB, 0x70, 0x70, 0x89, 0xE5, 0x49, 0x3B, 0x0C, 0x87, 0xEB, 0xD2, 0xF8, 0xF3,
+    0xCE, 0x7D, 0x71, 0x89, 0xB0, 0x8D, 0x3F, 0x9B, 0x31, 0xEF, 0xEA, 0x7A, 0x87, 0x4D, 0x9A, 0xB8,
+    0x5D, 0x33, 0xE8, 0x1D, 0x75, 0x18, 0x3D, 0x1D, 0xC1, 0x6E, 0x2E, 0x80, 0x0B, 0x1A, 0x40, 0x4F,
+    0x6D, 0x60, 0xA2, 0x0D, 0x60, 0x83, 0x1B, 0x80, 0x3F, 0xBE, 0x90, 0x58, 0xB5, 0x39, 0x6B, 0x44,
+    0x22, 0xD2, 0x4E, 0x44, 0x9D, 0x2B, 0xD6, 0x22, 0xD2, 0x96, 0x8B, 0x09, 0xB4, 0x26, 0x98, 0xB7,
+    0xBF, 0xE5, 0xAA, 0x50, 0xFD, 0x64, 0x7D, 0xA8, 0x9E, 0xEB, 0xD7, 0x96, 0x27, 0xEC, 0x64, 0x5F,
+    0x0E, 0x2F, 0x58, 0x6F, 0xBF, 0x11, 0xFE, 0x6D, 0xEB, 0x9B, 0x47, 0x03, 0x6E, 0x68, 0xD3, 0x9E,
+    0x9F, 0xF5, 0x5A, 0x88, 0x87, 0x2A, 0x5D, 0xDF, 0x79, 0xA2, 0x94, 0x36, 0xEE, 0xE6, 0x52, 0x9A,
+    0x83, 0xFF, 0x3E, 0x72, 0xB2, 0xA1, 0xA5, 0x1D, 0x80, 0x2F, 0xBD, 0xD7, 0xE5, 0x5E, 0x48, 0x93,
+    0x72, 0x90, 0x27, 0x80, 0xF6, 0xCF, 0x3C, 0x34, 0x4A, 0xED, 0xEE, 0x03, 0x45, 0xB4, 0x01, 0x1C,
+    0x02, 0x33, 0xD9, 0x19, 0x6E, 0x14, 0x1B, 0xD4, 0xDE, 0xF9, 0x2C, 0x21, 0xAC, 0xB2, 0xD0, 0x67,
+    0x01, 0xC6, 0x4B, 0x27, 0x90, 0xF1, 0xE2, 0xC5, 0xF3, 0xB4, 0x4A, 0x05, 0xE9, 0xDB, 0xB3, 0x4C,
+    0xCE, 0x25, 0xCF, 0x12, 0x93, 0x70, 0xCF, 0x48, 0x4B, 0x62, 0xED, 0xED, 0x7A, 0x81, 0x22, 0xAF,
+    0xEF, 0x98, 0x07, 0xB4, 0xEF, 0x0E, 0xD4, 0x93, 0xF7, 0xE3, 0x9D, 0x92, 0xD8, 0xAA, 0xD7, 0xF9,
+    0x6C, 0x9B, 0x65, 0xDA, 0xEF, 0x52, 0x6B, 0x96, 0x31, 0x4A, 0x21, 0x97, 0x39, 0x8A, 0x6B, 0x03,
+    0x77, 0x5C, 0xBC, 0x78, 0xF1, 0xE2, 0x47, 0xB5, 0x24, 0x53, 0xEE, 0x9F, 0x00, 0xB3, 0xDF, 0x20,
+    0xED, 0x6A, 0xD4, 0x28, 0x50, 0x4A, 0x57, 0xD3, 0x66, 0x24, 0xA9, 0x6B, 0xA4, 0xFF, 0x85, 0xCF,
+    0xA5, 0xB3, 0x5E, 0x03, 0xE7, 0x92, 0x5B, 0x3C, 0xED, 0x4C, 0xE9, 0xE0, 0x7F, 0x15, 0x67, 0xB3,
+    0xBC, 0xDB, 0x57, 0x20, 0xF5, 0xC9, 0x56, 0x05, 0x1E, 0x8A, 0xFD, 0x9C, 0xBA, 0xB4, 0x39, 0x98,
+    0x7C, 0xEA, 0xCC, 0xAC, 0x94, 0x16, 0x63, 0xFD, 0xDE, 0x57, 0xC4, 0xB1, 0x0E, 0x93, 0xCF, 0xCC,
+    0xC5, 0xEF, 0xD4, 0xAA, 0x96, 0x97, 0x62, 0x2E, 0x7D, 0xA4, 0xAA, 0xE4, 0x21, 0x06, 0x4A, 0xAB,
+    0x31, 0x67, 0xE6, 0x59, 0x16, 0x9D, 0x6B, 0x20, 0x79, 0x41, 0xFE, 0x7F, 0x65, 0x98, 0xBD, 0xCF,
+    0xDD, 0x46, 0x76, 0xC6, 0x7F, 0xE4, 0xD8, 0x66, 0x22, 0x22, 0x18, 0xA4, 0x70, 0x60, 0x58, 0xC0,
+    0x32, 0x65, 0x10, 0x64, 0xC3, 0x66, 0x6B, 0x0D, 0xED, 0x2D, 0xB6, 0x48, 0xB1, 0x6E, 0x36, 0x8D,
+    0x0B, 0xA7, 0x48, 0x11, 0xAF, 0x0B, 0x75, 0x29, 0x02, 0xC8, 0xA4, 0x56, 0x7F, 0x80, 0xDF, 0xC2,
+    0x8B, 0x94, 0x51, 0xE1, 0x05, 0x56, 0x37, 0x40, 0xA4, 0x22, 0x01, 0x82, 0x40, 0xAB, 0x99, 0x8D,
+    0x8B, 0x14, 0x2A, 0x4C, 0x40, 0x01, 0x54, 0xA4, 0x58, 0x06, 0x56, 0x8A, 0xC4, 0x85, 0x47, 0x12,
+    0x85, 0x50, 0xAF, 0x87, 0xF3, 0xA4, 0x98, 0x7B, 0x5F, 0xE9, 0xCD, 0x0E, 0x70, 0x71, 0x79, 0x39,
+    0x5F, 0xE7, 0xE3, 0x39, 0xE7, 0x3C, 0xE7, 0xC2, 0x71, 0xD8, 0x00, 0xE0, 0x00, 0xAA, 0x0D, 0xA0,
+    0x9D, 0x01, 0xDC, 0x00, 0xBC, 0xAB, 0xF3, 0x81, 0x56, 0xCA, 0x54, 0x92, 0x36, 0x3A, 0x49, 0x73,
+    0x25, 0xAD, 0xEF, 0x0E, 0x56, 0x3F, 0x0E, 0xE0, 0xE3, 0x08, 0x46, 0xEF, 0x6F, 0xD0, 0x25, 0x3B,
+    0x83, 0x66, 0x07, 0x46, 0x24, 0xE8, 0xB6, 0x46, 0xE7, 0x83, 0x9F, 0x7B, 0xE9, 0x67, 0x1A, 0xA4,
+    0x6C, 0x77, 0xF3, 0x9D, 0x56, 0xB7, 0xDA, 0x5F, 0xEB, 0x4C, 0xF1, 0x53, 0xBB, 0xD6, 0x52, 0x56,
+    0x68, 0x25, 0x09, 0x2B, 0x29, 0xD1, 0x49, 0x5A, 0xE8, 0xA4, 0x0C, 0x6F, 0xE9, 0xE5, 0x00, 0x24,
+    0x00, 0x13, 0x01, 0xBA, 0x00, 0xF0, 0x31, 0x00, 0xD7, 0xF3, 0x04, 0xE0, 0x94, 0x00, 0x1A, 0x29,
+    0x00, 0x3C, 0xE9, 0x57, 0x00, 0xEA, 0xBD, 0x28, 0x37, 0x0E, 0x00, 0xF4, 0x33, 0x34, 0x92, 0xA4,
+    0x64, 0x24, 0x49, 0x7B, 0x2D, 0x49, 0xD2, 0xC9, 0x08, 0xBD, 0x24, 0x29, 0x5A, 0x49, 0xD2, 0xDA,
+    0x96, 0xA5, 0x68, 0xE0, 0x1E, 0x30, 0x2E, 0xCD, 0x0E, 0x58, 0x49, 0x01, 0x6A, 0x49, 0x6B, 0xD9,
+    0x92, 0x01, 0xEE, 0xEA, 0x0B, 0x5E, 0x1F, 0x76, 0xA2, 0x5E, 0xC1, 0x41, 0x97, 0xE9, 0x14, 0x1B,
+    0xE5, 0x4A, 0xFB, 0x07, 0xEE, 0x37, 0xA1, 0x79, 0xB1, 0xA1, 0x7E, 0xB0, 0x5F, 0xC7, 0x6A, 0x77,
+    0xF4, 0x8F, 0x97, 0x5A, 0x0F, 0xE8, 0xB4, 0x21, 0xCD, 0x8D, 0x44, 0xAB, 0x09, 0x07, 0xCD, 0x52,
+    0x0E, 0x3A, 0x1C, 0x0E, 0x87, 0x3B, 0xA6, 0x48, 0xF2, 0x5B, 0xE3, 0xDD, 0xC3, 0xE1, 0x70, 0x07,
+    0x27, 0x69, 0xC7, 0x49, 0x4A, 0x8C, 0x65, 0xA1, 0xD9, 0x01, 0x4C, 0x02, 0x68, 0x13, 0x80, 0xDD,
+    0x00, 0xEC, 0x0A, 0xD0, 0x47, 0x00, 0x17, 0x01, 0xC6, 0x19, 0xC0, 0x07, 0x00, 0x05, 0xA0, 0xD2,
+    0x04, 0x18, 0x0D, 0x80, 0x51, 0x31, 0x2B, 0x14, 0x8D, 0x8D, 0x94, 0x8D, 0x94, 0xA8, 0x13, 0x90,
+    0xB0, 0xD2, 0x66, 0xA5, 0xB5, 0x93, 0x22, 0x63, 0xC4, 0x29, 0xE0, 0x04, 0x63, 0x06, 0xAF, 0x81,
+    0xC1, 0x4F, 0x30, 0x4E, 0xE5, 0x7C, 0x95, 0x4F, 0xA5, 0x80, 0x51, 0xA0, 0xFA, 0xC9, 0x00, 0x4D,
+    0x84, 0x36, 0x82, 0xFD, 0xCF, 0x7F, 0xA4, 0x53, 0xA4, 0x57, 0xAC, 0xA5, 0x33, 0xAB, 0x75, 0xB0,
+    0xFA, 0x30, 0x74, 0xD2, 0xF4, 0xFB, 0xD2, 0xD0, 0xEB, 0xE5, 0x1D, 0x97, 0xDF, 0xDB, 0xC7, 0xD4,
+    0x6E, 0xBF, 0xD8, 0xC6, 0x58, 0x4B, 0xC1, 0x68, 0xC7, 0x68, 0xA6, 0xBE, 0x30, 0x7C, 0x3B, 0x9F,
+    0x80, 0x6C, 0xC3, 0xD1, 0xDD, 0x46, 0x09, 0x3A, 0x09, 0x9C, 0x04, 0x3E, 0x0B, 0xB4, 0x8F, 0xD4,
+    0x39, 0x8D, 0x98, 0x94, 0x46, 0xCC, 0x8B, 0xED, 0x01, 0xCD, 0xB3, 0x75, 0xA7, 0xFD, 0x3A, 0x26,
+    0xEC, 0xA3, 0xA7, 0x09, 0xFB, 0x6F, 0xCF, 0x36, 0xBA, 0x87, 0x5F, 0xAF, 0xF4, 0x5F, 0x3D, 0x8E,
+    0xB8, 0xAF, 0x1E, 0x46, 0xDC, 0xDF, 0x7D, 0xB5, 0x50, 0x0D, 0x0C, 0xAF, 0xAC, 0x3F, 0x6A, 0xE1,
+    0x78, 0x30, 0x56, 0x8A, 0xD0, 0xAC, 0xD5, 0x0E, 0x26, 0xE1, 0x26, 0x10, 0x76, 0x81, 0x71, 0xB2,
+    0x2B, 0xB8, 0xFF, 0xBA, 0x9B, 0xB0, 0x92, 0x72, 0x41, 0x20, 0x55, 0xC1, 0xDD, 0x28, 0x65, 0xE8,
+    0xA5, 0x27, 0x27, 0xB7, 0x5C, 0xBC, 0xD7, 0x44, 0x5F, 0xB0, 0x56, 0xFC, 0xC2, 0x18, 0x01, 0xFA,
+    0xE2, 0xC7, 0x5C, 0x00, 0x3E, 0x1C, 0xC3, 0x75, 0x07, 0x1E, 0x00, 0x23, 0xE0, 0x86, 0xAB, 0x8B,
+    0xBB, 0xE9, 0xB7, 0xEE, 0x5B, 0x65, 0x2B, 0x3D, 0xB1, 0xCA, 0x43, 0xAB, 0x33, 0xD0, 0x02, 0x6D,
+    0x06, 0x7C, 0x84, 0x66, 0x07, 0x3E, 0x05, 0x9A, 0x4B, 0x88, 0xAA, 0x16, 0xC0, 0x4F, 0x30, 0xEE,
+    0xD0, 0x6B, 0xC5, 0x4A, 0x73, 0xA3, 0x2C, 0xA3, 0xFE, 0xB3, 0x34, 0xDE, 0x5A, 0xDD, 0xFB, 0xC1,
+    0x31, 0xD3, 0xC4, 0xE3, 0x8D, 0x76, 0x3E, 0x46, 0x67, 0x17, 0xC0, 0x6C, 0xA7, 0x24, 0x02, 0xC0,
+    0x1F, 0x02, 0xDD, 0x74, 0x14, 0xAF, 0x89, 0x40, 0x3F, 0x35, 0x4F, 0xD8, 0x19, 0xF3, 0x8F, 0x62,
+    0x23, 0xF9, 0xF0, 0x96, 0xB4, 0xC3, 0x75, 0x45, 0xB8, 0xAA, 0x50, 0x74, 0xEC, 0x12, 0xB4, 0x02,
+    0x34, 0x1D, 0xC3, 0xE0, 0x8F, 0x8E, 0xE7, 0xBD, 0x0D, 0x98, 0x15, 0xE8, 0x27, 0xA8, 0xD2, 0xC9,
+    0xD1, 0x3B, 0xD0, 0x2E, 0x30, 0x8C, 0x70, 0xCD, 0xAC, 0xDF, 0x6B, 0xF6, 0xFE, 0x56, 0xEA, 0x5E,
+    0x26, 0x4D, 0x4E, 0x8A, 0x8C, 0x4A, 0x20, 0x41, 0xAD, 0x19, 0x9A, 0x15, 0xF8, 0xDD, 0xE3, 0x81,
+    0x6F, 0x01, 0x7F, 0x01, 0x76, 0x82, 0x15, 0x7A, 0xE0, 0x3E, 0xDC, 0x28, 0x3A, 0xA4, 0xCA, 0x9F,
+    0x75, 0x93, 0x79, 0xEA, 0x95, 0xFF, 0x6C, 0x6E, 0xA4, 0xEF, 0xA4, 0x68, 0xF5, 0x92, 0xAB, 0xDA,
+    0xDC, 0x4B, 0xA0, 0xDF, 0xBB, 0x08, 0xB4, 0xA9, 0xD9, 0x81, 0x7E, 0x41, 0x03, 0x94, 0xD8, 0xE5,
+    0x57, 0xF0, 0x7B, 0xC0, 0x0F, 0x2E, 0x9B, 0x36, 0x40, 0x1F, 0x68, 0x14, 0xF0, 0x9A, 0xAC, 0x74,
+    0x33, 0xDF, 0xF0, 0x3F, 0xFE, 0xD7, 0x78, 0xFF, 0x1D, 0x1B, 0x06, 0xAE, 0x41, 0xB5, 0x42, 0x1B,
+    0x38, 0x3D, 0x36, 0x73, 0x91, 0xCC, 0x15, 0xB1, 0xAA, 0x15, 0xCC, 0xC2, 0xF7, 0x6D, 0x98, 0x73,
+    0x6F, 0x67, 0xFF, 0x40, 0x8C, 0x8A, 0x38, 0x0D, 0x74, 0x6B, 0x59, 0xF9, 0x06, 0xF0, 0xD6, 0x19,
+    0x7F, 0xA0, 0xAD, 0x91, 0x54, 0x49, 0x9F, 0x33, 0x66, 0xB0, 0x5A, 0x31, 0x52, 0x20, 0xF7, 0x19,
+    0x37, 0xF9, 0xCD, 0x2E, 0x8D, 0xBE, 0xDC, 0xE8, 0x96, 0x97, 0x70, 0xBB, 0xFE, 0x1C, 0x50, 0x1E,
+    0x70, 0xD2, 0xC2, 0x27, 0x4A, 0xE0, 0x04, 0x5E, 0xA1, 0x92, 0x62, 0xA3, 0x47, 0x5B, 0xAB, 0x21,
+    0x77, 0x19, 0x77, 0x2B, 0x61, 0x97, 0x1F, 0x50, 0xAF, 0x35, 0xC5, 0x5E, 0x01, 0x76, 0xBE, 0x68,
+    0xA3, 0x0D, 0xEE, 0xBD, 0xAD, 0x4E, 0xFD, 0x60, 0x1F, 0x45, 0xBC, 0xC3, 0x7C, 0xB7, 0xD0, 0xEF,
+    0x15, 0x0A, 0x4E, 0xA9, 0x91, 0x26, 0xAF, 0xB5, 0xFA, 0x44, 0xC0, 0x07, 0xC0, 0xEF, 0x40, 0x1D,
+    0xC1, 0xBD, 0x77, 0xBB, 0x8D, 0x8E, 0xBD, 0x8E, 0x5D, 0xE8, 0x7E, 0xB8, 0xB1, 0x8D, 0xD8, 0xAF,
+    0x16, 0x1E, 0x24, 0x1A, 0x4D, 0xB8, 0xF8, 0x86, 0x91, 0x42, 0xAF, 0xBD, 0x92, 0x16, 0x9B, 0x3F,
+    0xE7, 0x83, 0x93, 0x1D, 0x23, 0x47, 0xE7, 0xD7, 0xE9, 0x84, 0x87, 0x36, 0x02, 0xF6, 0xFC, 0x70,
+    0xB8, 0xDD, 0x4B, 0x8A, 0xA3, 0xA4, 0xD5, 0x4F, 0xC0, 0x78, 0x7E, 0x38, 0xFC, 0xD2, 0x4A, 0x4A,
+    0xB5, 0xA4, 0x1D, 0x3F, 0x9F, 0xE2, 0xAC, 0x8D, 0x40, 0x3D, 0xBF, 0x72, 0xCF, 0x1B, 0x00, 0xFF,
+    0x34, 0x03, 0xAE, 0x07, 0xBA, 0xE7, 0x09, 0x9A, 0xEC, 0x16, 0x6A, 0x3D, 0xD6, 0x80, 0x4F, 0x7E,
+    0xC7, 0x7D, 0xFB, 0xD9, 0xB7, 0xB1, 0x7B, 0xB1, 0x26, 0x7D, 0xB9, 0xF7, 0xDD, 0xAD, 0xE4, 0xCC,
+    0xB3, 0xF5, 0x7B, 0x4C, 0xD7, 0x1C, 0x03, 0xCD, 0xA3, 0x05, 0xB8, 0x7F, 0x03, 0xB0, 0x0F, 0x03,
+    0xB0, 0x25, 0xA0, 0xFB, 0x68, 0x82, 0xFA, 0xD9, 0x0A, 0x38, 0x07, 0x98, 0x47, 0xB1, 0x80, 0x01,
+    0xA0, 0x5E, 0x4E, 0xAA, 0xE0, 0x01, 0xEC, 0xF1, 0xF7, 0x4F, 0x0F, 0x07, 0x3F, 0xF5, 0x17, 0xA5,
+    0x08, 0xC0, 0xFD, 0xFA, 0x70, 0x38, 0xF8, 0x45, 0x92, 0x66, 0xF7, 0x7A, 0x5A, 0xF0, 0xE1, 0x54,
+    0x12, 0x4D, 0x38, 0xA9, 0x72, 0xE3, 0x53, 0xC0, 0x7C, 0x1D, 0x4F, 0x97, 0x96, 0xFB, 0xBB, 0x8F,
+    0xA6, 0x93, 0x54, 0x45, 0xC0, 0xFB, 0x37, 0xE0, 0x9D, 0xE6, 0xD1, 0xF2, 0x86, 0x59, 0xAE, 0xB9,
+    0x7A, 0x19, 0xBF, 0x7C, 0xB6, 0x8E, 0x37, 0xF5, 0x51, 0xF7, 0xD9, 0xDA, 0xE4, 0x55, 0x19, 0xAB,
+    0xCF, 0x14, 0xE8, 0x93, 0x8F, 0xE0, 0x1F, 0xEF, 0x50, 0x65, 0x37, 0x81, 0x79, 0xBE, 0x00, 0xF6,
+    0x4F, 0x5E, 0xC7, 0xF6, 0x80, 0x05, 0xFE, 0x94, 0x2A, 0x41, 0x1B, 0xE9, 0x03, 0x78, 0xCC, 0x0A,
+    0x66, 0xC3, 0x03, 0x7D, 0xB0, 0xE7, 0x87, 0xC3, 0xE1, 0x58, 0x70, 0xE3, 0x28, 0x49, 0x7A, 0xB8,
+    0x01, 0x4D, 0x1A, 0xCF, 0x0F, 0x87, 0x83, 0x26, 0x49, 0xD2, 0x5C, 0x4B, 0x52, 0xA4, 0xDD, 0xB1,
+    0x09, 0xFA, 0x58, 0x0B, 0xF0, 0x74, 0x01, 0xEA, 0x99, 0x78, 0x39, 0x4F, 0xB9, 0x19, 0xAC, 0x66,
+    0x6A, 0xE9, 0x09, 0x7E, 0xD4, 0xDC, 0x3D, 0xFF, 0x66, 0x6B, 0x75, 0xED, 0x4A, 0xAD, 0xE7, 0x0B,
+    0x4E, 0xD7, 0xE0, 0xAF, 0x9F, 0x2F, 0xD0, 0x5F, 0x83, 0xFA, 0xB7, 0x1E, 0xFE, 0xE5, 0xB8, 0xA6,
+    0xD6, 0xF3, 0x85, 0x46, 0xD7, 0x3A, 0xBA, 0xE7, 0x4A, 0x8C, 0x5E, 0x73, 0x2D, 0x3D, 0xA1, 0xD5,
+    0x19, 0xB8, 0x00, 0x2C, 0xAF, 0x14, 0x6D, 0x67, 0xA0, 0xDB, 0x00, 0x97, 0x2E, 0x9C, 0x97, 0x80,
+    0x7A, 0x2B, 0x60, 0xAC, 0xFD, 0x8F, 0x22, 0xBD, 0xFE, 0x63, 0xC1, 0x4B, 0xA1, 0xD6, 0xDF, 0x2A,
+    0x98, 0xBD, 0xD6, 0xD0, 0xAE, 0x95, 0xB0, 0xB1, 0xCA, 0xD8, 0xA5, 0x4E, 0x74, 0xB1, 0xDD, 0xE8,
+    0xB2, 0x8F, 0x58, 0x69, 0xA6, 0x95, 0x06, 0x8C, 0x76, 0xC0, 0x2F, 0x97, 0x6B, 0xFC, 0x15, 0xA0,
+    0xF2, 0x9B, 0x07, 0x46, 0x69, 0x83, 0x56, 0xD2, 0x04, 0x3A, 0xF7, 0x3B, 0xD8, 0x8C, 0x12, 0xF8,
+    0xC5, 0x2A, 0xD2, 0x64, 0xBC, 0x9F, 0x71, 0xB1, 0xDD, 0x34, 0x54, 0x1A, 0xFC, 0xAD, 0x9D, 0x36,
+    0xB5, 0x9B, 0x5D, 0x71, 0x8B, 0x9F, 0xC6, 0x50, 0xA9, 0x4D, 0x95, 0x68, 0x93, 0x0F, 0x76, 0xA3,
+    0xFF, 0xDF, 0x84, 0x9B, 0x91, 0x82, 0x11, 0x46, 0x89, 0x7E, 0xC3, 0xEA, 0xDF, 0x3F, 0xD4, 0x8C,
+    0x2B, 0xB8, 0x93, 0xA4, 0xB5, 0x54, 0xAC, 0x09, 0x2F, 0x69, 0xA3, 0x95, 0xA4, 0x81, 0xFE, 0xA6,
+    0xD7, 0x19, 0xBC, 0x73, 0x21, 0xE6, 0xDB, 0xC3, 0x11, 0x91, 0xB5, 0x02, 0x34, 0x9A, 0xC1, 0x6A,
+    0x01, 0xA7, 0x08, 0xFE, 0x37, 0x91, 0x4A, 0x36, 0x62, 0x76, 0xBB, 0x62, 0x93, 0xDD, 0xE8, 0xA3,
+    0x4D, 0x8C, 0xB3, 0x4D, 0x68, 0x6A, 0x93, 0x11, 0xED, 0xDE, 0xEE, 0x34, 0xB9, 0xDB, 0x68, 0xE4,
+    0x24, 0x69, 0x94, 0x94, 0xBD, 0xA4, 0xFD, 0x15, 0xFB, 0xB1, 0x27, 0xF4, 0xFC, 0xAC, 0x84, 0x33,
+    0xC2, 0x24, 0xB3, 0x61, 0x97, 0x7E, 0x66, 0x1C, 0x44, 0x9D, 0x4C, 0xC2, 0xC6, 0x6E, 0xC1, 0x4D,
+    0x9E, 0x6A, 0x37, 0x09, 0x1B, 0xED, 0x82, 0x0B, 0xE3, 0x50, 0xE5, 0x3A, 0xD1, 0xAE, 0x36, 0xE2,
+    0x82, 0x9B, 0xC8, 0xD5, 0x4E, 0xB3, 0xB6, 0x91, 0x77, 0xA7, 0x3F, 0x9E, 0x70, 0xC1, 0x0D, 0xF4,
+    0xC1, 0x05, 0xBA, 0xD9, 0x05, 0xEC, 0xD2, 0xCD, 0x65, 0x67, 0x1B, 0x6D, 0xA4, 0xD9, 0xDA, 0x88,
+    0x49, 0xCD, 0x5A, 0xAE, 0xAB, 0x77, 0x93, 0x20, 0xD7, 0x09, 0x54, 0xED, 0xE0, 0x11, 0x8C, 0x83,
+    0xC0, 0x4D, 0x7E, 0xC0, 0x85, 0x71, 0x32, 0x17, 0x49, 0xA7, 0xD2, 0x91, 0x23, 0x62, 0xA4, 0x9D,
+    0x51, 0x0A, 0xAD, 0x94, 0x18, 0x03, 0x98, 0x0C, 0xD8, 0x78, 0x8C, 0x63, 0x73, 0xAC, 0x24, 0x90,
+    0x8F, 0x95, 0xB5, 0x59, 0xCB, 0xDB, 0x5A, 0x50, 0x29, 0x80, 0x93, 0x66, 0x23, 0x25, 0xBC, 0x14,
+    0xAC, 0xB4, 0xC1, 0xDB, 0x3F, 0x9D, 0xA4, 0xBD, 0x97, 0x1E, 0xEB, 0x7F, 0xEE, 0x14, 0x16, 0x3C,
+    0x80, 0x91, 0x26, 0xA8, 0x95, 0x4F, 0xF5, 0xB7, 0x1C, 0x5A, 0x28, 0x02, 0xB8, 0x09, 0x4A, 0x06,
+    0x3F, 0xA6, 0x9D, 0x22, 0x05, 0xCD, 0xF6, 0x8A, 0x38, 0xD6, 0x65, 0x83, 0x80, 0x1A, 0x4D, 0x50,
+    0xC7, 0x31, 0x00, 0xDE, 0x2F, 0x40, 0xAF, 0x08, 0x34, 0xDA, 0x00, 0x8A, 0x7B, 0x5C, 0x86, 0x63,
+    0xED, 0x7E, 0x15, 0xA8, 0x7F, 0xC9, 0xC7, 0x30, 0xE6, 0x2E, 0x63, 0x95, 0x95, 0xF1, 0x92, 0x52,
+    0xB3, 0x37, 0xFA, 0x61, 0xEC, 0x83, 0x59, 0xDA, 0x90, 0xB0, 0xF4, 0x4D, 0xE4, 0x9F, 0x49, 0x7D,
+    0xB8, 0xBA, 0x76, 0xB3, 0x57, 0xA9, 0x5E, 0xD2, 0x66, 0x24, 0x69, 0x32, 0x8A, 0xDA, 0xA8, 0x3E,
+    0xE6, 0xC1, 0x91, 0x7D, 0xFD, 0xC3, 0x00, 0xE0, 0x53, 0x21, 0xED, 0x13, 0xD0, 0x6E, 0xEF, 0x9C,
+    0x64, 0x3D, 0xA9, 0x55, 0x94, 0x38, 0x92, 0xFF, 0xA2, 0x5D, 0xB5, 0xBF, 0x3E, 0xBF, 0x71, 0x91,
+    0x79, 0x2F, 0xCF, 0xBB, 0x4B, 0xF3, 0xAF, 0xED, 0x2F, 0x0D, 0xC5, 0x99, 0x0F, 0x50, 0x15, 0xFE,
+    0x5F, 0xD8, 0x5F, 0x5D, 0x12, 0xB2, 0xD5, 0x0A, 0x70, 0x75, 0x7B, 0xDD, 0x00, 0xFD, 0x62, 0x32,
+    0xE3, 0x6C, 0xF7, 0x4A, 0xC1, 0x5D, 0xE6, 0xF0, 0x63, 0xB0, 0x5B, 0xA5, 0xC9, 0xAD, 0x8D, 0xD0,
+    0x31, 0xB7, 0x55, 0x1A, 0xFE, 0x0A, 0xBF, 0xDB, 0xD8, 0x7F, 0xF3, 0x74, 0x37, 0xC9, 0x29, 0xB8,
+    0x9B, 0x8A, 0x50, 0x7D, 0xF1, 0xFA, 0x74, 0x1B, 0xBB, 0x6F, 0x9E, 0x66, 0x93, 0x9C, 0x42, 0x3F,
+    0xBD, 0x3E, 0x7D, 0x9B, 0x13, 0xE7, 0x2A, 0xA9, 0xA9, 0x34, 0x4B, 0x3B, 0x27, 0xA6, 0x46, 0x7E,
+    0x13, 0xBC, 0x94, 0x69, 0x25, 0x6D, 0x78, 0x49, 0x4B, 0x55, 0x94, 0x2C, 0xBE, 0x77, 0xE1, 0x27,
+    0x20, 0x69, 0xC7, 0x4A, 0xDA, 0x90, 0xA4, 0xA5, 0xA0, 0xB2, 0xCA, 0x00, 0x5D, 0xBC, 0xB0, 0x74,
+    0xB1, 0x8A, 0xBF, 0x9C, 0xB0, 0xBE, 0xFF, 0x0A, 0x3B, 0x7D, 0x31, 0x4E, 0x3E, 0x91, 0xE5, 0x46,
+    0x99, 0x63, 0x4A, 0xC0, 0x69, 0x00, 0x9C, 0xCE, 0x8A, 0x15, 0xCF, 0xE0, 0xAA, 0x4E, 0x5F, 0x09,
+    0xE8, 0x4B, 0xD0, 0x5C, 0x2F, 0x2E, 0xBD, 0x0E, 0xFA, 0x05, 0x15, 0x48, 0xFA, 0xEF, 0xE1, 0x28,
+    0xD4, 0x9B, 0x9F, 0x14, 0x27, 0xF0, 0xE7, 0xF7, 0x39, 0x12, 0xF3, 0x62, 0x7A, 0x4D, 0x40, 0x55,
+    0xA0, 0xE9, 0x35, 0x5D, 0xB8, 0xA6, 0x92, 0x06, 0x0A, 0xAF, 0x3D, 0xF6, 0x06, 0x65, 0x55, 0xE5,
+    0xB5, 0xC2, 0x75, 0x69, 0x3B, 0x36, 0x74, 0x5E, 0x79, 0x00, 0xE9, 0x8C, 0x42, 0x9B, 0xA9, 0x9E,
+    0x14, 0x86, 0xF0, 0xE6, 0xDD, 0x9D, 0xEA, 0xAE, 0x94, 0x8F, 0x6C, 0xBE, 0x97, 0xEE, 0x0C, 0xFC,
+    0xCD, 0xE7, 0x45, 0x75, 0x3F, 0x37, 0x19, 0xA3, 0xE0, 0x76, 0xAC, 0x82, 0x4F, 0x74, 0x0B, 0x1A,
+    0x70, 0x53, 0x9D, 0xC0, 0x61, 0x36, 0x1A, 0x49, 0x2F, 0xEE, 0xB5, 0xAF, 0xFA, 0xCC, 0xE5, 0x8A,
+    0x0E, 0x77, 0xCF, 0xCF, 0xEA, 0x9D, 0x6E, 0xC1, 0x24, 0xFA, 0x19, 0x93, 0x70, 0x81, 0x66, 0xC3,
+    0x05, 0xDA, 0x95, 0x31, 0x60, 0x57, 0xFC, 0x44, 0x17, 0xD1, 0x40, 0x1F, 0x2B, 0x81, 0x5B, 0x6A,
+    0x81, 0x9B, 0x4D, 0x86, 0x31, 0x98, 0x63, 0xA3, 0xFB, 0xE6, 0x70, 0x81, 0xFB, 0x31, 0xD0, 0xED,
+    0x6D, 0xA2, 0x51, 0x50, 0x40, 0xA9, 0xDF, 0xE8, 0xE6, 0x0B, 0x54, 0xBB, 0x01, 0x18, 0x9F, 0xDE,
+    0x83, 0x56, 0xD9, 0x9E, 0x21, 0xCD, 0x89, 0x2B, 0xFA, 0x65, 0x17, 0xE8, 0xE7, 0x7A, 0xC3, 0x24,
+    0xDC, 0x80, 0x0B, 0x4D, 0xA4, 0xD9, 0xF0, 0xE0, 0x07, 0xBB, 0x60, 0x57, 0x76, 0x2A, 0xD1, 0x07,
+    0xFA, 0x68, 0x12, 0x26, 0xE3, 0x02, 0x6E, 0x6E, 0x36, 0x9A, 0x84, 0x9F, 0x80, 0x2B, 0xEB, 0x45,
+    0xFF, 0xDB, 0xED, 0x75, 0xA2, 0x51, 0x70, 0x13, 0x4A, 0x4D, 0xA4, 0x9F, 0xF1, 0x98, 0x0D, 0xBB,
+    0x34, 0xFA, 0xB0, 0x4A, 0x78, 0x2D, 0x2E, 0x58, 0xED, 0x66, 0xE3, 0xEE, 0xF9, 0x34, 0x52, 0xEF,
+    0xB4, 0x11, 0x17, 0xC8, 0x98, 0x44, 0x37, 0x33, 0x4E, 0x75, 0xA2, 0x5D, 0x71, 0x13, 0x1A, 0x9A,
+    0x95, 0x2E, 0xE2, 0xA9, 0x85, 0x7D, 0x31, 0xB8, 0x05, 0x6D, 0x66, 0xA7, 0xD3, 0x30, 0x86, 0x5A,
+    0xEB, 0xFF, 0xEB, 0x8B, 0x4B, 0x00, 0x53, 0x09, 0xBA, 0x84, 0x7F, 0x98, 0xA8, 0xB5, 0x74, 0x72,
+    0x91, 0x4E, 0x83, 0xCE, 0x35, 0xA1, 0xA1, 0x5D, 0x4B, 0x53, 0xE2, 0x26, 0xA0, 0x0F, 0xD5, 0x4E,
+    0x29, 0xAD, 0x4F, 0x6F, 0x53, 0xCA, 0xDF, 0x83, 0xD2, 0xA4, 0xE5, 0xC4, 0x5B, 0x3A, 0xDC, 0x3D,
+    0xFF, 0xFB, 0x88, 0x49, 0xF4, 0xC1, 0x4D, 0x74, 0x0B, 0x62, 0x07, 0x3F, 0x34, 0xA9, 0x29, 0xAF,
+    0x97, 0x7E, 0xC2, 0x46, 0x34, 0xEC, 0x30, 0x86, 0x52, 0x29, 0x32, 0x5D, 0xEC, 0x8F, 0xCE, 0x53,
+    0x71, 0x93, 0x49, 0xD4, 0xA2, 0x8B, 0xFD, 0x82, 0xDD, 0xF0, 0x41, 0x53, 0xE9, 0xE3, 0x7E, 0x75,
+    0x21, 0xFA, 0x4B, 0x2A, 0xCD, 0x6D, 0xAE, 0x76, 0x1A, 0x05, 0xB7, 0xD7, 0x09, 0xAB, 0xA0, 0x64,
+    0x36, 0xFA, 0x50, 0x65, 0x9A, 0x88, 0x1B, 0x4C, 0xC2, 0xC6, 0x46, 0xD2, 0xCB, 0x7B, 0x76, 0x2E,
+    0x58, 0xEA, 0x42, 0x41, 0x93, 0x0B, 0x05, 0x4F, 0x6E, 0x28, 0x88, 0x1A, 0x8F, 0x98, 0xD2, 0x11,
+    0x55, 0xB9, 0xE0, 0xAA, 0xDA, 0x0B, 0xB2, 0xEA, 0x54, 0xC4, 0x33, 0x5B, 0x41, 0x57, 0xB3, 0x16,
+    0x7C, 0xB5, 0x2F, 0x06, 0xB7, 0xD4, 0xC2, 0x2A, 0xB8, 0xD9, 0x64, 0xAC, 0xC2, 0x18, 0xCC, 0x4E,
+    0x77, 0x14, 0xF8, 0x34, 0x8E, 0x24, 0x30, 0x5F, 0xFE, 0x9F, 0x25, 0xC0, 0xF5, 0x3C, 0xD8, 0x05,
+    0xBC, 0x16, 0x69, 0x65, 0xFC, 0xF9, 0x3D, 0xAF, 0x9D, 0x7E, 0x60, 0x94, 0x86, 0x36, 0x80, 0x9B,
+    0xA8, 0x5F, 0x96, 0xA5, 0x6E, 0xC7, 0x46, 0x68, 0x14, 0xCD, 0x06, 0xF4, 0x2A, 0x99, 0xCB, 0xCD,
+    0x85, 0x13, 0x6F, 0x6E, 0xA2, 0x5A, 0xDB, 0xDD, 0x6A, 0xAE, 0x24, 0xB5, 0x5A, 0x2B, 0x49, 0xEF,
+    0x97, 0x4A, 0x8A, 0xD7, 0x50, 0xF9, 0x4B, 0xF9, 0xF6, 0xFF, 0x00,
 };
 
 static const EpdGlyph opendyslexic_12_bolditalicGlyphs[] = {
@@ -2178,7 +2161,7 @@ static const EpdGlyph opendyslexic_12_bolditalicGlyphs[] = {
     { 11, 23, 10, 1, 18, 64, 9009 }, // |
     { 16, 26, 17, -1, 20, 104, 9073 }, // }
     { 11, 5, 12, 5, 19, 14, 9177 }, // ~
-    { 0, 0, 22, 0, 0, 0, 0 }, //  
+    { 0, 0, 22, 0, 0, 0, 9191 }, //  
     { 13, 32, 13, 3, 28, 104, 0 }, // ¡
     { 14, 24, 20, 2, 20, 84, 104 }, // ¢
     { 19, 23, 17, 1, 22, 110, 188 }, // £
@@ -2189,625 +2172,631 @@ static const EpdGlyph opendyslexic_12_bolditalicGlyphs[] = {
     { 14, 6, 13, 4, 21, 21, 643 }, // ¨
     { 13, 11, 17, 7, 24, 36, 664 }, // ©
     { 10, 9, 16, 7, 19, 23, 700 }, // ª
-    { 18, 14, 21, 2, 13, 63, 723 }, // «
-    { 14, 9, 15, 2, 10, 32, 786 }, // ¬
-    { 15, 3, 15, 2, 9, 12, 818 }, // ­
-    { 13, 12, 17, 8, 28, 39, 830 }, // ®
-    { 11, 4, 13, 5, 19, 11, 869 }, // ¯
-    { 14, 11, 17, 5, 19, 39, 880 }, // °
-    { 19, 18, 20, 0, 14, 86, 919 }, // ±
-    { 9, 8, 8, 9, 20, 18, 1005 }, // ²
-    { 10, 10, 8, 8, 21, 25, 1023 }, // ³
-    { 8, 6, 7, 4, 19, 12, 1048 }, // ´
-    { 20, 19, 21, -1, 15, 95, 1060 }, // µ
-    { 19, 22, 19, 2, 18, 105, 1155 }, // ¶
-    { 7, 6, 7, 2, 12, 11, 1260 }, // ·
-    { 8, 8, 8, -1, 1, 16, 1271 }, // ¸
-    { 7, 9, 8, 9, 21, 16, 1287 }, // ¹
-    { 9, 8, 17, 8, 18, 18, 1303 }, // º
-    { 18, 14, 19, -4, 13, 63, 1321 }, // »
-    { 26, 23, 32, 2, 21, 150, 1384 }, // ¼
-    { 28, 23, 32, 2, 21, 161, 1534 }, // ½
-    { 26, 23, 32, 2, 21, 150, 1695 }, // ¾
-    { 19, 31, 17, -2, 18, 148, 1845 }, // ¿
-    { 22, 28, 28, 1, 28, 154, 1993 }, // À
-    { 23, 32, 28, 1, 32, 184, 2147 }, // Á
-    { 23, 29, 28, 1, 29, 167, 2331 }, // Â
-    { 23, 29, 28, 1, 29, 167, 2498 }, // Ã
-    { 25, 30, 28, 1, 30, 188, 2665 }, // Ä
-    { 22, 30, 28, 1, 30, 165, 2853 }, // Å
-    { 35, 22, 34, 1, 21, 193, 3018 }, // Æ
-    { 22, 30, 24, 2, 23, 165, 3211 }, // Ç
-    { 22, 29, 22, 1, 29, 160, 3376 }, // È
-    { 22, 33, 22, 1, 33, 182, 3536 }, // É
-    { 22, 30, 22, 1, 30, 165, 3718 }, // Ê
-    { 22, 31, 22, 1, 31, 171, 3883 }, // Ë
-    { 15, 32, 13, 1, 31, 120, 4054 }, // Ì
-    { 16, 36, 13, 1, 35, 144, 4174 }, // Í
-    { 16, 33, 13, 1, 32, 132, 4318 }, // Î
-    { 18, 33, 13, 1, 32, 149, 4450 }, // Ï
-    { 25, 21, 26, 0, 21, 132, 4599 }, // Ð
-    { 25, 29, 25, 1, 29, 182, 4731 }, // Ñ
-    { 25, 31, 28, 2, 29, 194, 4913 }, // Ò
-    { 25, 35, 28, 2, 33, 219, 5107 }, // Ó
-    { 25, 32, 28, 2, 30, 200, 5326 }, // Ô
-    { 25, 32, 28, 2, 30, 200, 5526 }, // Õ
-    { 25, 33, 28, 2, 31, 207, 5726 }, // Ö
-    { 16, 9, 15, 0, 11, 36, 5933 }, // ×
-    { 50, 46, 28, -10, 34, 575, 5969 }, // Ø
-    { 24, 32, 25, 2, 30, 192, 6544 }, // Ù
-    { 24, 36, 25, 2, 34, 216, 6736 }, // Ú
-    { 24, 33, 25, 2, 31, 198, 6952 }, // Û
-    { 24, 33, 25, 2, 31, 198, 7150 }, // Ü
-    { 20, 36, 26, 7, 36, 180, 7348 }, // Ý
-    { 16, 21, 14, 1, 20, 84, 7528 }, // Þ
-    { 18, 22, 17, 1, 20, 99, 7612 }, // ß
-    { 16, 24, 21, 2, 23, 96, 7711 }, // à
-    { 17, 28, 21, 2, 27, 119, 7807 }, // á
-    { 17, 25, 21, 2, 24, 107, 7926 }, // â
-    { 17, 23, 21, 2, 22, 98, 8033 }, // ã
-    { 19, 26, 21, 2, 25, 124, 8131 }, // ä
-    { 16, 26, 21, 2, 25, 104, 8255 }, // å
-    { 26, 17, 31, 2, 16, 111, 8359 }, // æ
-    { 14, 23, 20, 2, 16, 81, 8470 }, // ç
-    { 17, 26, 21, 2, 25, 111, 8551 }, // è
-    { 18, 31, 21, 2, 30, 140, 8662 }, // é
-    { 18, 27, 21, 2, 26, 122, 8802 }, // ê
-    { 20, 28, 21, 2, 27, 140, 8924 }, // ë
-    { 11, 23, 11, 1, 22, 64, 9064 }, // ì
-    { 13, 28, 11, 1, 27, 91, 9128 }, // í
-    { 14, 24, 11, -1, 23, 84, 9219 }, // î
-    { 13, 24, 11, 1, 23, 78, 9303 }, // ï
-    { 23, 22, 17, 0, 21, 127, 9381 }, // ð
-    { 20, 24, 22, 1, 24, 120, 9508 }, // ñ
-    { 17, 23, 21, 2, 22, 98, 9628 }, // ò
-    { 17, 27, 21, 2, 26, 115, 9726 }, // ó
-    { 17, 24, 21, 2, 23, 102, 9841 }, // ô
-    { 18, 24, 21, 2, 23, 108, 9943 }, // õ
-    { 19, 25, 21, 2, 24, 119, 10051 }, // ö
-    { 19, 18, 22, 4, 17, 86, 10170 }, // ÷
-    { 28, 44, 21, -3, 30, 308, 10256 }, // ø
-    { 16, 24, 21, 3, 23, 96, 10564 }, // ù
-    { 16, 28, 21, 3, 27, 112, 10660 }, // ú
-    { 16, 24, 21, 3, 23, 96, 10772 }, // û
-    { 18, 25, 21, 3, 24, 113, 10868 }, // ü
-    { 21, 36, 23, 1, 29, 189, 10981 }, // ý
-    { 17, 26, 14, 0, 21, 111, 11170 }, // þ
-    { 22, 33, 23, 1, 26, 182, 11281 }, // ÿ
-    { 25, 29, 28, 1, 29, 182, 0 }, // Ā
-    { 19, 25, 21, 2, 24, 119, 182 }, // ā
-    { 26, 30, 28, 1, 30, 195, 301 }, // Ă
-    { 20, 25, 21, 2, 24, 125, 496 }, // ă
-    { 22, 28, 28, 1, 21, 154, 621 }, // Ą
-    { 16, 24, 21, 2, 16, 96, 775 }, // ą
-    { 22, 31, 24, 2, 31, 171, 871 }, // Ć
-    { 15, 21, 20, 2, 21, 79, 1042 }, // ć
-    { 24, 32, 24, 2, 32, 192, 1121 }, // Ĉ
-    { 18, 24, 20, 2, 24, 108, 1313 }, // ĉ
-    { 22, 31, 24, 2, 31, 171, 1421 }, // Ċ
-    { 16, 22, 20, 2, 22, 88, 1592 }, // ċ
-    { 25, 33, 24, 2, 33, 207, 1680 }, // Č
-    { 20, 24, 20, 2, 24, 120, 1887 }, // č
-    { 24, 31, 26, 1, 31, 186, 2007 }, // Ď
-    { 25, 22, 22, 2, 21, 138, 2193 }, // ď
-    { 25, 21, 26, 0, 21, 132, 2331 }, // Đ
-    { 24, 22, 22, 2, 21, 132, 2463 }, // đ
-    { 23, 30, 22, 1, 30, 173, 2595 }, // Ē
-    { 20, 28, 21, 2, 27, 140, 2768 }, // ē
-    { 23, 30, 22, 1, 30, 173, 2908 }, // Ĕ
-    { 21, 28, 21, 2, 27, 147, 3081 }, // ĕ
-    { 22, 31, 22, 1, 31, 171, 3228 }, // Ė
-    { 18, 28, 21, 2, 27, 126, 3399 }, // ė
-    { 22, 28, 22, 1, 21, 154, 3525 }, // Ę
-    { 17, 25, 21, 2, 15, 107, 3679 }, // ę
-    { 24, 33, 22, 1, 33, 198, 3786 }, // Ě
-    { 21, 30, 21, 2, 29, 158, 3984 }, // ě
-    { 26, 34, 28, 2, 33, 221, 4142 }, // Ĝ
-    { 23, 34, 21, 0, 26, 196, 4363 }, // ĝ
-    { 27, 33, 28, 2, 32, 223, 4559 }, // Ğ
-    { 23, 32, 21, 0, 24, 184, 4782 }, // ğ
-    { 23, 33, 28, 2, 32, 190, 4966 }, // Ġ
-    { 20, 33, 21, 0, 25, 165, 5156 }, // ġ
-    { 24, 38, 28, 2, 37, 228, 5321 }, // Ģ
-    { 21, 34, 21, 0, 26, 179, 5549 }, // ģ
-    { 24, 31, 26, 1, 31, 186, 5728 }, // Ĥ
-    { 18, 31, 22, 1, 30, 140, 5914 }, // ĥ
-    { 25, 21, 26, 1, 21, 132, 6054 }, // Ħ
-    { 18, 22, 22, 1, 21, 99, 6186 }, // ħ
-    { 17, 34, 13, 1, 33, 145, 6285 }, // Ĩ
-    { 13, 25, 11, 1, 24, 82, 6430 }, // ĩ
-    { 18, 33, 13, 1, 32, 149, 6512 }, // Ī
-    { 14, 25, 11, 1, 24, 88, 6661 }, // ī
-    { 14, 29, 13, -1, 22, 102, 6749 }, // Į
-    { 15, 32, 11, -2, 24, 120, 6851 }, // į
-    { 16, 34, 13, 1, 33, 136, 6971 }, // İ
-    { 8, 16, 11, 1, 15, 32, 7107 }, // ı
-    { 25, 33, 40, 7, 22, 207, 7139 }, // Ĳ
-    { 24, 30, 11, 1, 23, 180, 7346 }, // ĳ
-    { 26, 37, 22, 0, 31, 241, 7526 }, // Ĵ
-    { 21, 32, 16, 2, 25, 168, 7767 }, // ĵ
-    { 23, 34, 26, 1, 34, 196, 7935 }, // Ķ
-    { 18, 34, 22, -1, 21, 153, 8131 }, // ķ
-    { 14, 14, 16, -2, 14, 49, 8284 }, // ĸ
-    { 17, 28, 22, 1, 28, 119, 8333 }, // Ĺ
-    { 16, 33, 15, 1, 33, 132, 8452 }, // ĺ
-    { 17, 34, 22, 1, 21, 145, 8584 }, // Ļ
-    { 15, 36, 15, -2, 22, 135, 8729 }, // ļ
-    { 19, 21, 22, 1, 21, 100, 8864 }, // Ľ
-    { 19, 26, 15, 1, 26, 124, 8964 }, // ľ
-    { 19, 21, 22, 1, 21, 100, 9088 }, // Ŀ
-    { 16, 22, 15, 1, 22, 88, 9188 }, // ŀ
-    { 38, 35, 22, -12, 28, 333, 9276 }, // Ł
-    { 27, 22, 15, -9, 22, 149, 9609 }, // ł
-    { 25, 30, 25, 1, 30, 188, 9758 }, // Ń
-    { 19, 25, 22, 1, 25, 119, 9946 }, // ń
-    { 25, 31, 25, 1, 21, 194, 10065 }, // Ņ
-    { 18, 26, 22, 1, 16, 117, 10259 }, // ņ
-    { 26, 32, 25, 1, 32, 208, 10376 }, // Ň
-    { 23, 27, 22, 1, 27, 156, 10584 }, // ň
-    { 33, 26, 22, -14, 26, 215, 10740 }, // ŉ
-    { 25, 27, 25, 1, 21, 169, 10955 }, // Ŋ
-    { 18, 21, 22, 1, 16, 95, 11124 }, // ŋ
-    { 25, 32, 28, 2, 30, 200, 11219 }, // Ō
-    { 19, 25, 21, 2, 24, 119, 11419 }, // ō
-    { 25, 33, 28, 2, 31, 207, 11538 }, // Ŏ
-    { 20, 25, 21, 2, 24, 125, 11745 }, // ŏ
-    { 28, 32, 28, 2, 30, 224, 11870 }, // Ő
-    { 23, 24, 21, 2, 23, 138, 12094 }, // ő
-    { 35, 24, 30, 2, 22, 210, 12232 }, // Œ
-    { 27, 16, 27, 2, 15, 108, 12442 }, // œ
-    { 20, 30, 24, 1, 29, 150, 12550 }, // Ŕ
-    { 15, 23, 18, 1, 22, 87, 12700 }, // ŕ
-    { 20, 35, 24, 1, 34, 175, 12787 }, // Ŗ
-    { 15, 28, 18, 1, 27, 105, 12962 }, // ŗ
-    { 23, 32, 24, 1, 31, 184, 13067 }, // Ř
-    { 18, 25, 18, 1, 24, 113, 13251 }, // ř
-    { 21, 30, 26, 2, 29, 158, 13364 }, // Ś
-    { 16, 24, 21, 2, 22, 96, 13522 }, // ś
-    { 23, 31, 26, 2, 30, 179, 13618 }, // Ŝ
-    { 19, 26, 21, 2, 24, 124, 13797 }, // ŝ
-    { 21, 28, 26, 2, 21, 147, 13921 }, // Ş
-    { 16, 24, 21, 2, 16, 96, 14068 }, // ş
-    { 24, 32, 26, 2, 31, 192, 14164 }, // Š
-    { 20, 26, 21, 2, 24, 130, 14356 }, // š
-    { 20, 29, 26, 6, 22, 145, 14486 }, // Ţ
-    { 14, 26, 20, 3, 20, 91, 14631 }, // ţ
-    { 20, 32, 26, 6, 32, 160, 14722 }, // Ť
-    { 20, 23, 20, 4, 23, 115, 14882 }, // ť
-    { 20, 22, 26, 6, 22, 110, 14997 }, // Ŧ
-    { 15, 20, 20, 2, 20, 75, 15107 }, // ŧ
-    { 24, 34, 25, 2, 32, 204, 15182 }, // Ũ
-    { 17, 25, 21, 3, 24, 107, 15386 }, // ũ
-    { 24, 33, 25, 2, 31, 198, 15493 }, // Ū
-    { 18, 25, 21, 3, 24, 113, 15691 }, // ū
-    { 24, 33, 25, 2, 31, 198, 15804 }, // Ŭ
-    { 19, 25, 21, 3, 24, 119, 16002 }, // ŭ
-    { 24, 35, 25, 2, 33, 210, 16121 }, // Ů
-    { 16, 27, 21, 3, 26, 108, 16331 }, // ů
-    { 27, 32, 25, 2, 30, 216, 16439 }, // Ű
-    { 22, 24, 21, 3, 23, 132, 16655 }, // ű
-    { 24, 28, 25, 2, 21, 168, 16787 }, // Ų
-    { 16, 23, 21, 3, 15, 92, 16955 }, // ų
-    { 30, 31, 35, 6, 31, 233, 17047 }, // Ŵ
-    { 21, 26, 28, 5, 25, 137, 17280 }, // ŵ
-    { 20, 33, 26, 7, 33, 165, 17417 }, // Ŷ
-    { 21, 33, 23, 1, 26, 174, 17582 }, // ŷ
-    { 20, 33, 26, 7, 33, 165, 17756 }, // Ÿ
-    { 26, 28, 27, 1, 28, 182, 17921 }, // Ź
-    { 19, 24, 22, 1, 24, 114, 18103 }, // ź
-    { 26, 29, 27, 1, 29, 189, 18217 }, // Ż
-    { 19, 24, 22, 1, 24, 114, 18406 }, // ż
-    { 26, 31, 27, 1, 31, 202, 18520 }, // Ž
-    { 23, 26, 22, 1, 26, 150, 18722 }, // ž
-    { 15, 21, 15, 2, 21, 79, 18872 }, // ſ
-    { 10, 6, 0, 5, 20, 15, 0 }, // ̀
-    { 8, 6, 0, 4, 19, 12, 15 }, // ́
-    { 14, 7, 0, -1, 1, 25, 27 }, // ̂
-    { 11, 5, 0, 5, 19, 14, 52 }, // ̃
-    { 14, 4, 0, 5, 17, 14, 66 }, // ̄
-    { 18, 4, 0, 6, 23, 18, 80 }, // ̅
-    { 13, 6, 0, 5, 18, 20, 98 }, // ̆
-    { 7, 6, 0, 5, 21, 11, 118 }, // ̇
-    { 13, 5, 0, 3, 18, 17, 129 }, // ̈
-    { 5, 6, 0, 9, 16, 8, 146 }, // ̉
-    { 7, 7, 0, 5, 20, 13, 154 }, // ̊
-    { 20, 6, 0, 5, 20, 30, 167 }, // ̋
-    { 14, 7, 0, 5, 20, 25, 197 }, // ̌
-    { 21, 6, 0, -9, 20, 32, 222 }, // ̏
-    { 11, 9, 0, 3, 20, 25, 254 }, // ̒
-    { 11, 9, 0, 3, 19, 25, 279 }, // ̓
-    { 11, 9, 0, -6, 19, 25, 304 }, // ̔
-    { 7, 7, 0, 0, 0, 13, 329 }, // ̘
-    { 7, 7, 0, 1, 0, 13, 342 }, // ̙
-    { 12, 8, 0, 6, 21, 24, 355 }, // ̚
-    { 7, 8, 0, 3, 17, 14, 379 }, // ̛
-    { 6, 8, 0, -1, 0, 12, 393 }, // ̜
-    { 7, 7, 0, 2, 5, 13, 405 }, // ̝
-    { 7, 7, 0, -1, 0, 13, 418 }, // ̞
-    { 6, 6, 0, 0, -2, 9, 431 }, // ̟
-    { 14, 4, 0, -1, -3, 14, 440 }, // ̠
-    { 7, 6, 0, -3, 2, 11, 454 }, // ̣
-    { 12, 5, 0, -2, -2, 15, 465 }, // ̤
-    { 7, 7, 0, 5, 20, 13, 480 }, // ̥
-    { 11, 9, 0, -1, 4, 25, 493 }, // ̦
-    { 8, 8, 0, -1, 1, 16, 518 }, // ̧
-    { 8, 9, 0, 0, 1, 18, 534 }, // ̨
-    { 8, 9, 0, -2, 0, 18, 552 }, // ̩
-    { 12, 6, 0, -1, 0, 18, 570 }, // ̪
-    { 16, 8, 0, -1, 1, 32, 588 }, // ̬
-    { 16, 8, 0, -1, 1, 32, 620 }, // ̭
-    { 12, 6, 0, 6, 21, 18, 652 }, // ̰
-    { 13, 4, 0, 6, 21, 13, 670 }, // ̱
-    { 14, 4, 0, -2, -1, 14, 683 }, // ̲
-    { 13, 6, 0, 6, 21, 20, 697 }, // ̴
-    { 14, 3, 0, 2, 9, 11, 717 }, // ̵
-    { 7, 9, 0, 1, 0, 16, 728 }, // ̹
-    { 14, 8, 0, -4, 1, 28, 744 }, // ̺
-    { 13, 8, 0, -2, 1, 26, 772 }, // ̻
-    { 11, 7, 0, -1, 1, 20, 798 }, // ̼
-    { 9, 6, 0, 5, 19, 14, 818 }, // ̽
-    { 11, 5, 0, 5, 19, 14, 832 }, // ͂
-    { 6, 7, 0, 10, 22, 11, 846 }, // ̓
-    { 15, 19, 0, 4, 32, 72, 857 }, // ̈́
-    { 12, 7, 0, 4, 21, 21, 929 }, // ͆
-    { 16, 10, 0, -2, 0, 40, 950 }, // ͇
-    { 13, 8, 0, -1, 1, 26, 990 }, // ͈
-    { 10, 8, 0, -1, -1, 20, 1016 }, // ͉
-    { 18, 21, 0, 4, 27, 95, 1036 }, // ͊
-    { 26, 20, 0, 8, 30, 130, 1131 }, // ͋
-    { 18, 14, 0, 13, 14, 63, 1261 }, // ͌
-    { 13, 28, 0, 1, 9, 91, 1324 }, // ͍
-    { 5, 4, 0, 12, 3, 5, 1415 }, // ͎
-    { 22, 7, 0, 0, 1, 39, 1420 }, // ͜
-    { 22, 6, 0, 4, 20, 33, 1459 }, // ͡
-    { 27, 8, 0, -1, -1, 54, 1492 }, // ͢
-    { 22, 30, 22, 1, 30, 165, 0 }, // Ѐ
-    { 22, 31, 22, 1, 31, 171, 165 }, // Ё
-    { 23, 23, 17, 3, 22, 133, 336 }, // Ђ
-    { 19, 29, 16, 1, 28, 138, 469 }, // Ѓ
-    { 22, 22, 21, 1, 20, 121, 607 }, // Є
-    { 21, 22, 26, 2, 21, 116, 728 }, // Ѕ
-    { 12, 23, 13, 1, 22, 69, 844 }, // І
-    { 17, 32, 13, 1, 31, 136, 913 }, // Ї
-    { 23, 27, 22, 0, 21, 156, 1049 }, // Ј
-    { 27, 21, 29, 2, 19, 142, 1205 }, // Љ
-    { 26, 21, 15, -5, 20, 137, 1347 }, // Њ
-    { 20, 24, 26, 6, 23, 120, 1484 }, // Ћ
-    { 23, 28, 26, 1, 28, 161, 1604 }, // Ќ
-    { 23, 28, 24, 1, 28, 161, 1765 }, // Ѝ
-    { 21, 32, 20, 0, 29, 168, 1926 }, // Ў
-    { 21, 25, 20, 2, 19, 132, 2094 }, // Џ
-    { 22, 21, 28, 1, 21, 116, 2226 }, // А
-    { 18, 20, 16, 2, 19, 90, 2342 }, // Б
-    { 18, 19, 17, 1, 18, 86, 2432 }, // В
-    { 19, 20, 16, 1, 19, 95, 2518 }, // Г
-    { 22, 23, 21, 1, 19, 127, 2613 }, // Д
-    { 21, 21, 22, 1, 21, 111, 2740 }, // Е
-    { 35, 21, 37, 1, 21, 184, 2851 }, // Ж
-    { 16, 20, 16, 2, 18, 80, 3035 }, // З
-    { 23, 21, 24, 1, 21, 121, 3115 }, // И
-    { 23, 28, 24, 1, 28, 161, 3236 }, // Й
-    { 23, 21, 26, 1, 21, 121, 3397 }, // К
-    { 22, 21, 15, -1, 19, 116, 3518 }, // Л
-    { 24, 20, 21, 1, 19, 120, 3634 }, // М
-    { 24, 21, 26, 1, 21, 126, 3754 }, // Н
-    { 25, 24, 28, 2, 22, 150, 3880 }, // О
-    { 20, 21, 17, 1, 20, 105, 4030 }, // П
-    { 21, 22, 22, 1, 22, 116, 4135 }, // Р
-    { 22, 23, 24, 2, 23, 127, 4251 }, // С
-    { 20, 22, 26, 6, 22, 110, 4378 }, // Т
-    { 21, 22, 20, 0, 19, 116, 4488 }, // У
-    { 19, 19, 22, 5, 19, 91, 4604 }, // Ф
-    { 26, 21, 27, 1, 21, 137, 4695 }, // Х
-    { 19, 24, 18, 1, 19, 114, 4832 }, // Ц
-    { 16, 19, 17, 4, 19, 76, 4946 }, // Ч
-    { 23, 20, 20, 1, 19, 115, 5022 }, // Ш
-    { 23, 25, 23, 1, 20, 144, 5137 }, // Щ
-    { 17, 19, 16, -1, 18, 81, 5281 }, // Ъ
-    { 27, 23, 29, 1, 22, 156, 5362 }, // Ы
-    { 15, 20, 16, 1, 19, 75, 5518 }, // Ь
-    { 23, 22, 24, 1, 20, 127, 5593 }, // Э
-    { 24, 21, 23, 2, 20, 126, 5720 }, // Ю
-    { 21, 22, 22, 1, 21, 116, 5846 }, // Я
-    { 16, 17, 21, 2, 16, 68, 5962 }, // а
-    { 20, 23, 17, 2, 22, 115, 6030 }, // б
-    { 15, 15, 18, -1, 15, 57, 6145 }, // в
-    { 17, 16, 15, 1, 15, 68, 6202 }, // г
-    { 19, 19, 19, 1, 15, 91, 6270 }, // д
-    { 17, 16, 21, 2, 15, 68, 6361 }, // е
-    { 34, 18, 37, 1, 18, 153, 6429 }, // ж
-    { 12, 13, 11, -2, 13, 39, 6582 }, // з
-    { 18, 16, 17, 1, 15, 72, 6621 }, // и
-    { 18, 21, 16, 0, 21, 95, 6693 }, // й
-    { 17, 14, 20, -1, 14, 60, 6788 }, // к
-    { 15, 15, 10, -3, 13, 57, 6848 }, // л
-    { 19, 16, 21, -1, 16, 76, 6905 }, // м
-    { 20, 16, 21, -1, 16, 80, 6981 }, // н
-    { 17, 16, 21, 2, 15, 68, 7061 }, // о
-    { 18, 16, 17, 1, 15, 72, 7129 }, // п
-    { 22, 23, 23, -1, 15, 127, 7201 }, // р
-    { 14, 16, 20, 2, 16, 56, 7328 }, // с
-    { 16, 16, 17, 4, 15, 64, 7384 }, // т
-    { 21, 21, 23, 1, 14, 111, 7448 }, // у
-    { 22, 21, 22, 2, 15, 116, 7559 }, // ф
-    { 21, 16, 18, 0, 15, 84, 7675 }, // х
-    { 18, 19, 18, 1, 15, 86, 7759 }, // ц
-    { 11, 13, 11, 0, 13, 36, 7845 }, // ч
-    { 22, 16, 20, 1, 15, 88, 7881 }, // ш
-    { 22, 20, 22, 1, 15, 110, 7969 }, // щ
-    { 13, 15, 12, -3, 14, 49, 8079 }, // ъ
-    { 21, 17, 22, -2, 16, 90, 8128 }, // ы
-    { 11, 15, 12, -1, 14, 42, 8218 }, // ь
-    { 15, 15, 16, 2, 14, 57, 8260 }, // э
-    { 19, 17, 18, 0, 16, 81, 8317 }, // ю
-    { 14, 16, 21, 2, 16, 56, 8398 }, // я
-    { 18, 28, 21, 2, 27, 126, 8454 }, // ѐ
-    { 19, 27, 21, 2, 26, 129, 8580 }, // ё
-    { 18, 27, 22, 1, 21, 122, 8709 }, // ђ
-    { 17, 23, 15, 1, 22, 98, 8831 }, // ѓ
-    { 16, 16, 14, -2, 14, 64, 8929 }, // є
-    { 16, 18, 21, 2, 16, 72, 8993 }, // ѕ
-    { 12, 25, 11, 1, 24, 75, 9065 }, // і
-    { 13, 24, 11, 1, 23, 78, 9140 }, // ї
-    { 16, 29, 16, 2, 22, 116, 9218 }, // ј
-    { 18, 15, 20, -1, 13, 68, 9334 }, // љ
-    { 18, 15, 10, -6, 14, 68, 9402 }, // њ
-    { 18, 22, 22, 1, 21, 99, 9470 }, // ћ
-    { 18, 21, 20, -1, 21, 95, 9569 }, // ќ
-    { 18, 25, 17, 1, 24, 113, 9664 }, // ѝ
-    { 23, 33, 23, 1, 26, 190, 9777 }, // ў
-    { 16, 18, 15, -1, 13, 72, 9967 }, // џ
-    { 16, 21, 19, 4, 19, 84, 10039 }, // Ѣ
-    { 16, 21, 16, 3, 19, 84, 10123 }, // ѣ
-    { 27, 22, 22, -1, 20, 149, 10207 }, // Ѫ
-    { 19, 15, 15, -3, 13, 72, 10356 }, // ѫ
-    { 28, 27, 28, 2, 26, 189, 10428 }, // Ѳ
-    { 22, 22, 21, 2, 21, 121, 10617 }, // ѳ
-    { 25, 25, 28, 7, 25, 157, 10738 }, // Ѵ
-    { 18, 18, 22, 5, 18, 81, 10895 }, // ѵ
-    { 12, 9, 0, 7, 24, 27, 10976 }, // ҆
-    { 20, 23, 16, 1, 22, 115, 11003 }, // Ґ
-    { 18, 20, 15, 1, 19, 90, 11118 }, // ґ
-    { 19, 20, 16, 1, 19, 95, 11208 }, // Ғ
-    { 14, 14, 11, -2, 13, 49, 11303 }, // ғ
-    { 20, 23, 15, 0, 22, 115, 11352 }, // Ҕ
-    { 13, 15, 9, -3, 13, 49, 11467 }, // ҕ
-    { 35, 26, 38, 1, 21, 228, 11516 }, // Җ
-    { 25, 18, 25, -2, 15, 113, 11744 }, // җ
-    { 16, 23, 16, 2, 18, 92, 11857 }, // Ҙ
-    { 12, 19, 11, -2, 13, 57, 11949 }, // ҙ
-    { 23, 25, 18, 0, 21, 144, 12006 }, // Қ
-    { 15, 18, 13, -2, 15, 68, 12150 }, // қ
-    { 27, 20, 27, 1, 19, 135, 12218 }, // Ҝ
-    { 19, 14, 19, 0, 13, 67, 12353 }, // ҝ
-    { 23, 21, 26, 1, 21, 121, 12420 }, // Ҟ
-    { 16, 21, 22, 1, 21, 84, 12541 }, // ҟ
-    { 23, 21, 26, 1, 21, 121, 12625 }, // Ҡ
-    { 16, 15, 18, -2, 15, 60, 12746 }, // ҡ
-    { 24, 25, 19, -2, 21, 150, 12806 }, // Ң
-    { 17, 17, 13, -4, 15, 73, 12956 }, // ң
-    { 34, 21, 26, 1, 21, 179, 13029 }, // Ҥ
-    { 24, 15, 18, -2, 15, 90, 13208 }, // ҥ
-    { 30, 22, 32, 2, 21, 165, 13298 }, // Ҧ
-    { 24, 25, 32, 4, 17, 150, 13463 }, // ҧ
-    { 26, 21, 17, -3, 19, 137, 13613 }, // Ҩ
-    { 21, 18, 25, 1, 16, 95, 13750 }, // ҩ
-    { 22, 27, 24, 2, 23, 149, 13845 }, // Ҫ
-    { 14, 19, 20, 2, 16, 67, 13994 }, // ҫ
-    { 20, 24, 19, 3, 21, 120, 14061 }, // Ҭ
-    { 15, 17, 13, -1, 15, 64, 14181 }, // ҭ
-    { 20, 21, 26, 7, 21, 105, 14245 }, // Ү
-    { 16, 20, 19, 5, 14, 80, 14350 }, // ү
-    { 23, 21, 26, 4, 21, 121, 14430 }, // Ұ
-    { 20, 20, 19, 1, 14, 100, 14551 }, // ұ
-    { 26, 25, 20, 1, 21, 163, 14651 }, // Ҳ
-    { 18, 18, 20, 1, 15, 81, 14814 }, // ҳ
-    { 21, 24, 15, 0, 19, 126, 14895 }, // Ҵ
-    { 16, 18, 22, 3, 13, 72, 15021 }, // ҵ
-    { 17, 25, 17, 3, 19, 107, 15093 }, // Ҷ
-    { 12, 19, 12, 0, 14, 57, 15200 }, // ҷ
-    { 16, 19, 17, 4, 19, 76, 15257 }, // Ҹ
-    { 11, 13, 11, 0, 13, 36, 15333 }, // ҹ
-    { 17, 23, 17, 1, 21, 98, 15369 }, // Һ
-    { 18, 22, 22, 1, 21, 99, 15467 }, // һ
-    { 28, 20, 35, 5, 19, 140, 15566 }, // Ҽ
-    { 21, 14, 17, 1, 13, 74, 15706 }, // ҽ
-    { 29, 24, 22, 6, 19, 174, 15780 }, // Ҿ
-    { 21, 17, 16, 2, 13, 90, 15954 }, // ҿ
-    { 12, 23, 13, 1, 22, 69, 16044 }, // Ӏ
-    { 35, 34, 37, 1, 34, 298, 16113 }, // Ӂ
-    { 34, 29, 37, 1, 29, 247, 16411 }, // ӂ
-    { 20, 26, 18, 1, 19, 130, 16658 }, // Ӄ
-    { 14, 19, 12, -2, 13, 67, 16788 }, // ӄ
-    { 22, 25, 15, -1, 19, 138, 16855 }, // Ӆ
-    { 15, 17, 10, -1, 13, 64, 16993 }, // ӆ
-    { 24, 27, 26, 1, 21, 162, 17057 }, // Ӈ
-    { 17, 20, 18, -2, 15, 85, 17219 }, // ӈ
-    { 24, 29, 26, 1, 21, 174, 17304 }, // Ӊ
-    { 17, 21, 18, 0, 15, 90, 17478 }, // ӊ
-    { 17, 25, 17, 4, 19, 107, 17568 }, // Ӌ
-    { 11, 17, 15, 2, 13, 47, 17675 }, // ӌ
-    { 27, 30, 29, 1, 21, 203, 17722 }, // Ӎ
-    { 19, 21, 20, 0, 15, 100, 17925 }, // ӎ
-    { 10, 19, 15, 5, 18, 48, 18025 }, // ӏ
-    { 26, 29, 28, 1, 29, 189, 18073 }, // Ӑ
-    { 20, 25, 21, 2, 24, 125, 18262 }, // ӑ
-    { 24, 28, 28, 1, 28, 168, 18387 }, // Ӓ
-    { 20, 25, 21, 2, 24, 125, 18555 }, // ӓ
-    { 35, 22, 34, 1, 21, 193, 18680 }, // Ӕ
-    { 26, 17, 31, 2, 16, 111, 18873 }, // ӕ
-    { 24, 30, 22, 1, 30, 180, 18984 }, // Ӗ
-    { 21, 27, 21, 2, 26, 142, 19164 }, // ӗ
-    { 21, 21, 27, 8, 19, 111, 19306 }, // Ә
-    { 16, 17, 21, 8, 16, 68, 19417 }, // ә
-    { 21, 29, 27, 8, 27, 153, 19485 }, // Ӛ
-    { 18, 21, 21, 6, 16, 95, 19638 }, // ӛ
-    { 35, 32, 35, 4, 32, 280, 19733 }, // Ӝ
-    { 34, 28, 37, 1, 28, 238, 20013 }, // ӝ
-    { 18, 31, 16, 2, 29, 140, 20251 }, // Ӟ
-    { 17, 20, 11, -2, 20, 85, 20391 }, // ӟ
-    { 16, 20, 17, 3, 19, 80, 20476 }, // Ӡ
-    { 16, 20, 17, 1, 14, 80, 20556 }, // ӡ
-    { 23, 28, 23, 1, 28, 161, 20636 }, // Ӣ
-    { 20, 24, 17, 1, 23, 120, 20797 }, // ӣ
-    { 23, 27, 24, 1, 27, 156, 20917 }, // Ӥ
-    { 18, 23, 17, 1, 22, 104, 21073 }, // ӥ
-    { 25, 31, 28, 2, 29, 194, 21177 }, // Ӧ
-    { 18, 26, 21, 2, 25, 117, 21371 }, // ӧ
-    { 23, 20, 28, 3, 19, 115, 21488 }, // Ө
-    { 17, 16, 21, 2, 15, 68, 21603 }, // ө
-    { 23, 28, 28, 3, 27, 161, 21671 }, // Ӫ
-    { 18, 23, 21, 2, 22, 104, 21832 }, // ӫ
-    { 38, 32, 24, 1, 30, 304, 21936 }, // Ӭ
-    { 15, 21, 16, 2, 20, 79, 22240 }, // ӭ
-    { 21, 33, 20, 0, 30, 174, 22319 }, // Ӯ
-    { 22, 33, 23, 1, 26, 182, 22493 }, // ӯ
-    { 21, 32, 20, 0, 29, 168, 22675 }, // Ӱ
-    { 21, 32, 23, 1, 25, 168, 22843 }, // ӱ
-    { 24, 32, 20, 0, 29, 192, 23011 }, // Ӳ
-    { 26, 32, 23, 1, 25, 208, 23203 }, // ӳ
-    { 16, 25, 17, 4, 25, 100, 23411 }, // Ӵ
-    { 13, 19, 11, 0, 19, 62, 23511 }, // ӵ
-    { 19, 23, 16, 1, 19, 110, 23573 }, // Ӷ
-    { 14, 16, 11, -2, 13, 56, 23683 }, // ӷ
-    { 27, 34, 29, 1, 33, 230, 23739 }, // Ӹ
-    { 23, 27, 22, -2, 26, 156, 23969 }, // ӹ
-    { 26, 24, 27, 1, 21, 156, 24125 }, // Ӽ
-    { 19, 17, 19, -2, 15, 81, 24281 }, // ӽ
-    { 0, 0, 17, 0, 0, 0, 0 }, //  
-    { 0, 0, 29, 0, 0, 0, 0 }, //  
-    { 0, 0, 17, 0, 0, 0, 0 }, //  
-    { 0, 0, 29, 0, 0, 0, 0 }, //  
-    { 0, 0, 12, 0, 0, 0, 0 }, //  
-    { 0, 0, 10, 0, 0, 0, 0 }, //  
-    { 0, 0, 8, 0, 0, 0, 0 }, //  
-    { 0, 0, 18, 0, 0, 0, 0 }, //  
-    { 0, 0, 7, 0, 0, 0, 0 }, //  
-    { 0, 0, 9, 0, 0, 0, 0 }, //  
-    { 0, 0, 8, 0, 0, 0, 0 }, //  
-    { 0, 0, 4, 0, 0, 0, 0 }, // ​
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‍
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‎
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‏
-    { 14, 3, 14, 2, 9, 11, 0 }, // ‐
-    { 14, 3, 14, 2, 9, 11, 11 }, // ‑
-    { 21, 3, 14, -1, 9, 16, 22 }, // ‒
-    { 20, 5, 20, 2, 10, 25, 38 }, // –
-    { 28, 5, 29, 2, 10, 35, 63 }, // —
-    { 28, 5, 29, 2, 10, 35, 98 }, // ―
-    { 18, 23, 14, 1, 18, 104, 133 }, // ‖
-    { 23, 8, 14, -5, -2, 46, 237 }, // ‗
-    { 11, 9, 11, 5, 22, 25, 283 }, // ‘
-    { 11, 9, 11, 5, 22, 25, 308 }, // ’
-    { 11, 9, 8, -2, 4, 25, 333 }, // ‚
-    { 11, 9, 11, 5, 22, 25, 358 }, // ‛
-    { 19, 9, 19, 5, 22, 43, 383 }, // “
-    { 19, 9, 19, 5, 22, 43, 426 }, // ”
-    { 11, 9, 8, -2, 4, 25, 469 }, // „
-    { 19, 9, 19, 5, 22, 43, 494 }, // ‟
-    { 15, 35, 20, 6, 26, 132, 537 }, // †
-    { 18, 35, 22, 5, 26, 158, 669 }, // ‡
-    { 23, 19, 13, -3, 22, 110, 827 }, // •
-    { 10, 9, 15, 4, 11, 23, 937 }, // ‣
-    { 7, 6, 15, 4, 6, 11, 960 }, // ․
-    { 7, 6, 15, 4, 6, 11, 971 }, // ‥
-    { 24, 6, 24, 0, 6, 36, 982 }, // …
-    { 4, 3, 14, 5, 9, 3, 1018 }, // ‧
-    { 0, 0, 28, 0, 0, 0, 1021 }, //  
-    { 23, 22, 28, 3, 20, 127, 1021 }, // ‰
-    { 11, 9, 14, 8, 22, 25, 1148 }, // ′
-    { 19, 9, 20, 8, 22, 43, 1173 }, // ″
-    { 18, 8, 10, -2, 21, 36, 1216 }, // ‴
-    { 6, 8, 10, 7, 21, 12, 1252 }, // ‵
-    { 11, 8, 10, 5, 21, 22, 1264 }, // ‶
-    { 19, 8, 10, 0, 21, 38, 1286 }, // ‷
-    { 15, 6, 16, 5, 21, 23, 1324 }, // ‸
-    { 10, 14, 10, 3, 14, 35, 1347 }, // ‹
-    { 11, 14, 10, -3, 14, 39, 1382 }, // ›
-    { 33, 32, 34, 2, 25, 264, 1421 }, // ※
-    { 15, 32, 15, 2, 28, 120, 1685 }, // ‼
-    { 20, 40, 22, 4, 34, 200, 1805 }, // ‽
-    { 14, 3, 14, 5, 21, 11, 2005 }, // ‾
-    { 13, 6, 19, 5, 17, 20, 2016 }, // ‿
-    { 18, 17, 16, 2, 23, 77, 2036 }, // ⁂
-    { 23, 22, 32, 5, 20, 127, 2113 }, // ⁄
-    { 34, 31, 38, 6, 28, 264, 2240 }, // ⁇
-    { 29, 32, 30, 5, 28, 232, 2504 }, // ⁈
-    { 28, 32, 19, -2, 28, 224, 2736 }, // ⁉
-    { 29, 44, 23, -2, 30, 319, 2960 }, // ⁒
-    { 0, 0, 117, 0, 0, 0, 3279 }, //  
-    { 9, 10, 8, 9, 21, 23, 0 }, // ⁰
-    { 8, 9, 9, 10, 21, 18, 23 }, // ⁴
-    { 9, 11, 9, 9, 22, 25, 41 }, // ⁵
-    { 9, 10, 9, 9, 21, 23, 66 }, // ⁶
-    { 8, 11, 9, 11, 22, 22, 89 }, // ⁷
-    { 9, 11, 9, 9, 21, 25, 111 }, // ⁸
-    { 9, 11, 9, 9, 21, 25, 136 }, // ⁹
-    { 18, 16, 22, 1, 16, 72, 161 }, // ⁿ
-    { 10, 10, 9, -8, 6, 25, 233 }, // ₀
-    { 7, 11, 8, -8, 6, 20, 258 }, // ₁
-    { 10, 11, 9, -8, 6, 28, 278 }, // ₂
-    { 10, 10, 9, -8, 6, 25, 306 }, // ₃
-    { 9, 10, 9, -8, 6, 23, 331 }, // ₄
-    { 9, 10, 8, -8, 6, 23, 354 }, // ₅
-    { 10, 10, 9, -8, 6, 25, 377 }, // ₆
-    { 8, 11, 9, -6, 6, 22, 402 }, // ₇
-    { 10, 11, 9, -8, 6, 28, 424 }, // ₈
-    { 10, 11, 9, -8, 6, 28, 452 }, // ₉
-    { 18, 35, 12, 1, 26, 158, 480 }, // ₍
-    { 17, 35, 11, -8, 26, 149, 638 }, // ₎
-    { 23, 33, 24, 3, 28, 190, 0 }, // ₡
-    { 22, 23, 24, 2, 23, 127, 190 }, // ₢
-    { 19, 23, 17, 1, 22, 110, 317 }, // ₤
-    { 29, 21, 25, -1, 21, 153, 427 }, // ₦
-    { 24, 22, 22, 1, 22, 132, 580 }, // ₧
-    { 30, 23, 33, -1, 21, 173, 712 }, // ₨
-    { 23, 22, 21, -2, 22, 127, 885 }, // ₩
-    { 24, 19, 27, 4, 19, 114, 1012 }, // ₪
-    { 22, 22, 13, -2, 21, 121, 1126 }, // ₫
-    { 20, 24, 21, 2, 21, 120, 1247 }, // €
-    { 20, 22, 26, 6, 22, 110, 1367 }, // ₮
-    { 27, 22, 16, 0, 22, 149, 1477 }, // ₱
-    { 23, 33, 28, 2, 28, 190, 1626 }, // ₲
-    { 29, 21, 26, 7, 19, 153, 1816 }, // ₴
-    { 14, 21, 15, 2, 18, 74, 1969 }, // ₵
-    { 24, 23, 26, 6, 23, 138, 2043 }, // ₸
-    { 16, 21, 17, 4, 20, 84, 2181 }, // ₹
-    { 16, 19, 17, 2, 17, 76, 2265 }, // ₺
-    { 20, 21, 20, 3, 19, 105, 2341 }, // ₼
-    { 25, 22, 22, -3, 22, 138, 2446 }, // ₽
-    { 17, 18, 18, -4, 13, 77, 0 }, // ←
-    { 18, 18, 19, 3, 17, 81, 77 }, // ↑
-    { 18, 18, 19, 5, 13, 81, 158 }, // →
-    { 18, 18, 19, 7, 16, 81, 239 }, // ↓
-    { 28, 15, 26, -1, 12, 105, 320 }, // ↔
-    { 15, 28, 20, 4, 27, 105, 425 }, // ↕
-    { 17, 12, 20, -2, 11, 51, 530 }, // ↖
-    { 17, 12, 16, 3, 11, 51, 581 }, // ↗
-    { 14, 17, 16, 5, 15, 60, 632 }, // ↘
-    { 14, 17, 16, -3, 15, 60, 692 }, // ↙
-    { 20, 18, 24, 1, 16, 90, 752 }, // ⇐
-    { 22, 20, 27, 5, 19, 110, 842 }, // ⇑
-    { 21, 18, 24, 3, 16, 95, 952 }, // ⇒
-    { 22, 20, 27, 10, 18, 110, 1047 }, // ⇓
-    { 26, 18, 27, 1, 16, 117, 1157 }, // ⇔
-    { 18, 25, 22, 6, 14, 113, 1274 }, // ⇕
-    { 20, 22, 17, 1, 21, 110, 0 }, // ∂
-    { 27, 26, 28, 0, 24, 176, 110 }, // ∅
-    { 20, 20, 22, 1, 19, 100, 286 }, // ∆
-    { 19, 20, 18, 3, 19, 95, 386 }, // ∏
-    { 20, 19, 18, 7, 18, 95, 481 }, // ∐
-    { 18, 20, 15, 1, 19, 90, 576 }, // ∑
-    { 14, 4, 15, 2, 9, 14, 666 }, // −
-    { 25, 23, 24, 3, 21, 144, 680 }, // √
-    { 23, 14, 23, 2, 16, 81, 824 }, // ∞
-    { 26, 27, 21, 0, 20, 176, 905 }, // ∫
-    { 10, 17, 8, 1, 17, 43, 1081 }, // ∶
-    { 18, 14, 36, 13, 14, 63, 1124 }, // ≈
-    { 23, 22, 32, 5, 20, 127, 1187 }, // ≠
-    { 24, 21, 20, -3, 18, 126, 1314 }, // ≤
-    { 24, 22, 22, 0, 19, 132, 1440 }, // ≥
+    { 18, 14, 21, 2, 13, 63, 9191 }, // «
+    { 14, 9, 15, 2, 10, 32, 723 }, // ¬
+    { 15, 3, 15, 2, 9, 12, 755 }, // ­
+    { 13, 12, 17, 8, 28, 39, 767 }, // ®
+    { 11, 4, 13, 5, 19, 11, 806 }, // ¯
+    { 14, 11, 17, 5, 19, 39, 817 }, // °
+    { 19, 18, 20, 0, 14, 86, 856 }, // ±
+    { 9, 8, 8, 9, 20, 18, 942 }, // ²
+    { 10, 10, 8, 8, 21, 25, 960 }, // ³
+    { 8, 6, 7, 4, 19, 12, 985 }, // ´
+    { 20, 19, 21, -1, 15, 95, 997 }, // µ
+    { 19, 22, 19, 2, 18, 105, 1092 }, // ¶
+    { 7, 6, 7, 2, 12, 11, 1197 }, // ·
+    { 8, 8, 8, -1, 1, 16, 1208 }, // ¸
+    { 7, 9, 8, 9, 21, 16, 1224 }, // ¹
+    { 9, 8, 17, 8, 18, 18, 1240 }, // º
+    { 18, 14, 19, -4, 13, 63, 9254 }, // »
+    { 26, 23, 32, 2, 21, 150, 1258 }, // ¼
+    { 28, 23, 32, 2, 21, 161, 1408 }, // ½
+    { 26, 23, 32, 2, 21, 150, 1569 }, // ¾
+    { 19, 31, 17, -2, 18, 148, 1719 }, // ¿
+    { 22, 28, 28, 1, 28, 154, 9317 }, // À
+    { 23, 32, 28, 1, 32, 184, 9471 }, // Á
+    { 23, 29, 28, 1, 29, 167, 9655 }, // Â
+    { 23, 29, 28, 1, 29, 167, 1867 }, // Ã
+    { 25, 30, 28, 1, 30, 188, 9822 }, // Ä
+    { 22, 30, 28, 1, 30, 165, 2034 }, // Å
+    { 35, 22, 34, 1, 21, 193, 2199 }, // Æ
+    { 22, 30, 24, 2, 23, 165, 10010 }, // Ç
+    { 22, 29, 22, 1, 29, 160, 10175 }, // È
+    { 22, 33, 22, 1, 33, 182, 10335 }, // É
+    { 22, 30, 22, 1, 30, 165, 10517 }, // Ê
+    { 22, 31, 22, 1, 31, 171, 10682 }, // Ë
+    { 15, 32, 13, 1, 31, 120, 10853 }, // Ì
+    { 16, 36, 13, 1, 35, 144, 10973 }, // Í
+    { 16, 33, 13, 1, 32, 132, 11117 }, // Î
+    { 18, 33, 13, 1, 32, 149, 11249 }, // Ï
+    { 25, 21, 26, 0, 21, 132, 2392 }, // Ð
+    { 25, 29, 25, 1, 29, 182, 11398 }, // Ñ
+    { 25, 31, 28, 2, 29, 194, 11580 }, // Ò
+    { 25, 35, 28, 2, 33, 219, 11774 }, // Ó
+    { 25, 32, 28, 2, 30, 200, 11993 }, // Ô
+    { 25, 32, 28, 2, 30, 200, 2524 }, // Õ
+    { 25, 33, 28, 2, 31, 207, 12193 }, // Ö
+    { 16, 9, 15, 0, 11, 36, 2724 }, // ×
+    { 50, 46, 28, -10, 34, 575, 2760 }, // Ø
+    { 24, 32, 25, 2, 30, 192, 12400 }, // Ù
+    { 24, 36, 25, 2, 34, 216, 12592 }, // Ú
+    { 24, 33, 25, 2, 31, 198, 12808 }, // Û
+    { 24, 33, 25, 2, 31, 198, 13006 }, // Ü
+    { 20, 36, 26, 7, 36, 180, 3335 }, // Ý
+    { 16, 21, 14, 1, 20, 84, 3515 }, // Þ
+    { 18, 22, 17, 1, 20, 99, 3599 }, // ß
+    { 16, 24, 21, 2, 23, 96, 13204 }, // à
+    { 17, 28, 21, 2, 27, 119, 13300 }, // á
+    { 17, 25, 21, 2, 24, 107, 13419 }, // â
+    { 17, 23, 21, 2, 22, 98, 3698 }, // ã
+    { 19, 26, 21, 2, 25, 124, 13526 }, // ä
+    { 16, 26, 21, 2, 25, 104, 3796 }, // å
+    { 26, 17, 31, 2, 16, 111, 3900 }, // æ
+    { 14, 23, 20, 2, 16, 81, 13650 }, // ç
+    { 17, 26, 21, 2, 25, 111, 13731 }, // è
+    { 18, 31, 21, 2, 30, 140, 13842 }, // é
+    { 18, 27, 21, 2, 26, 122, 13982 }, // ê
+    { 20, 28, 21, 2, 27, 140, 14104 }, // ë
+    { 11, 23, 11, 1, 22, 64, 14244 }, // ì
+    { 13, 28, 11, 1, 27, 91, 14308 }, // í
+    { 14, 24, 11, -1, 23, 84, 14399 }, // î
+    { 13, 24, 11, 1, 23, 78, 14483 }, // ï
+    { 23, 22, 17, 0, 21, 127, 4011 }, // ð
+    { 20, 24, 22, 1, 24, 120, 14561 }, // ñ
+    { 17, 23, 21, 2, 22, 98, 14681 }, // ò
+    { 17, 27, 21, 2, 26, 115, 14779 }, // ó
+    { 17, 24, 21, 2, 23, 102, 14894 }, // ô
+    { 18, 24, 21, 2, 23, 108, 4138 }, // õ
+    { 19, 25, 21, 2, 24, 119, 14996 }, // ö
+    { 19, 18, 22, 4, 17, 86, 4246 }, // ÷
+    { 28, 44, 21, -3, 30, 308, 4332 }, // ø
+    { 16, 24, 21, 3, 23, 96, 15115 }, // ù
+    { 16, 28, 21, 3, 27, 112, 15211 }, // ú
+    { 16, 24, 21, 3, 23, 96, 15323 }, // û
+    { 18, 25, 21, 3, 24, 113, 15419 }, // ü
+    { 21, 36, 23, 1, 29, 189, 4640 }, // ý
+    { 17, 26, 14, 0, 21, 111, 4829 }, // þ
+    { 22, 33, 23, 1, 26, 182, 4940 }, // ÿ
+    { 25, 29, 28, 1, 29, 182, 5122 }, // Ā
+    { 19, 25, 21, 2, 24, 119, 5304 }, // ā
+    { 26, 30, 28, 1, 30, 195, 5423 }, // Ă
+    { 20, 25, 21, 2, 24, 125, 5618 }, // ă
+    { 22, 28, 28, 1, 21, 154, 5743 }, // Ą
+    { 16, 24, 21, 2, 16, 96, 5897 }, // ą
+    { 22, 31, 24, 2, 31, 171, 5993 }, // Ć
+    { 15, 21, 20, 2, 21, 79, 6164 }, // ć
+    { 24, 32, 24, 2, 32, 192, 6243 }, // Ĉ
+    { 18, 24, 20, 2, 24, 108, 6435 }, // ĉ
+    { 22, 31, 24, 2, 31, 171, 6543 }, // Ċ
+    { 16, 22, 20, 2, 22, 88, 6714 }, // ċ
+    { 25, 33, 24, 2, 33, 207, 6802 }, // Č
+    { 20, 24, 20, 2, 24, 120, 7009 }, // č
+    { 24, 31, 26, 1, 31, 186, 7129 }, // Ď
+    { 25, 22, 22, 2, 21, 138, 7315 }, // ď
+    { 25, 21, 26, 0, 21, 132, 7453 }, // Đ
+    { 24, 22, 22, 2, 21, 132, 7585 }, // đ
+    { 23, 30, 22, 1, 30, 173, 7717 }, // Ē
+    { 20, 28, 21, 2, 27, 140, 7890 }, // ē
+    { 23, 30, 22, 1, 30, 173, 8030 }, // Ĕ
+    { 21, 28, 21, 2, 27, 147, 8203 }, // ĕ
+    { 22, 31, 22, 1, 31, 171, 8350 }, // Ė
+    { 18, 28, 21, 2, 27, 126, 8521 }, // ė
+    { 22, 28, 22, 1, 21, 154, 8647 }, // Ę
+    { 17, 25, 21, 2, 15, 107, 8801 }, // ę
+    { 24, 33, 22, 1, 33, 198, 8908 }, // Ě
+    { 21, 30, 21, 2, 29, 158, 9106 }, // ě
+    { 26, 34, 28, 2, 33, 221, 9264 }, // Ĝ
+    { 23, 34, 21, 0, 26, 196, 9485 }, // ĝ
+    { 27, 33, 28, 2, 32, 223, 9681 }, // Ğ
+    { 23, 32, 21, 0, 24, 184, 9904 }, // ğ
+    { 23, 33, 28, 2, 32, 190, 10088 }, // Ġ
+    { 20, 33, 21, 0, 25, 165, 10278 }, // ġ
+    { 24, 38, 28, 2, 37, 228, 10443 }, // Ģ
+    { 21, 34, 21, 0, 26, 179, 10671 }, // ģ
+    { 24, 31, 26, 1, 31, 186, 10850 }, // Ĥ
+    { 18, 31, 22, 1, 30, 140, 11036 }, // ĥ
+    { 25, 21, 26, 1, 21, 132, 11176 }, // Ħ
+    { 18, 22, 22, 1, 21, 99, 11308 }, // ħ
+    { 17, 34, 13, 1, 33, 145, 11407 }, // Ĩ
+    { 13, 25, 11, 1, 24, 82, 11552 }, // ĩ
+    { 18, 33, 13, 1, 32, 149, 11634 }, // Ī
+    { 14, 25, 11, 1, 24, 88, 11783 }, // ī
+    { 14, 29, 13, -1, 22, 102, 11871 }, // Į
+    { 15, 32, 11, -2, 24, 120, 11973 }, // į
+    { 16, 34, 13, 1, 33, 136, 12093 }, // İ
+    { 8, 16, 11, 1, 15, 32, 12229 }, // ı
+    { 25, 33, 40, 7, 22, 207, 12261 }, // Ĳ
+    { 24, 30, 11, 1, 23, 180, 12468 }, // ĳ
+    { 26, 37, 22, 0, 31, 241, 12648 }, // Ĵ
+    { 21, 32, 16, 2, 25, 168, 12889 }, // ĵ
+    { 23, 34, 26, 1, 34, 196, 13057 }, // Ķ
+    { 18, 34, 22, -1, 21, 153, 13253 }, // ķ
+    { 14, 14, 16, -2, 14, 49, 13406 }, // ĸ
+    { 17, 28, 22, 1, 28, 119, 13455 }, // Ĺ
+    { 16, 33, 15, 1, 33, 132, 13574 }, // ĺ
+    { 17, 34, 22, 1, 21, 145, 13706 }, // Ļ
+    { 15, 36, 15, -2, 22, 135, 13851 }, // ļ
+    { 19, 21, 22, 1, 21, 100, 13986 }, // Ľ
+    { 19, 26, 15, 1, 26, 124, 14086 }, // ľ
+    { 19, 21, 22, 1, 21, 100, 14210 }, // Ŀ
+    { 16, 22, 15, 1, 22, 88, 14310 }, // ŀ
+    { 38, 35, 22, -12, 28, 333, 14398 }, // Ł
+    { 27, 22, 15, -9, 22, 149, 14731 }, // ł
+    { 25, 30, 25, 1, 30, 188, 14880 }, // Ń
+    { 19, 25, 22, 1, 25, 119, 15068 }, // ń
+    { 25, 31, 25, 1, 21, 194, 15187 }, // Ņ
+    { 18, 26, 22, 1, 16, 117, 15381 }, // ņ
+    { 26, 32, 25, 1, 32, 208, 15498 }, // Ň
+    { 23, 27, 22, 1, 27, 156, 15706 }, // ň
+    { 33, 26, 22, -14, 26, 215, 15862 }, // ŉ
+    { 25, 27, 25, 1, 21, 169, 16077 }, // Ŋ
+    { 18, 21, 22, 1, 16, 95, 16246 }, // ŋ
+    { 25, 32, 28, 2, 30, 200, 16341 }, // Ō
+    { 19, 25, 21, 2, 24, 119, 16541 }, // ō
+    { 25, 33, 28, 2, 31, 207, 16660 }, // Ŏ
+    { 20, 25, 21, 2, 24, 125, 16867 }, // ŏ
+    { 28, 32, 28, 2, 30, 224, 16992 }, // Ő
+    { 23, 24, 21, 2, 23, 138, 17216 }, // ő
+    { 35, 24, 30, 2, 22, 210, 15532 }, // Œ
+    { 27, 16, 27, 2, 15, 108, 15742 }, // œ
+    { 20, 30, 24, 1, 29, 150, 17354 }, // Ŕ
+    { 15, 23, 18, 1, 22, 87, 17504 }, // ŕ
+    { 20, 35, 24, 1, 34, 175, 17591 }, // Ŗ
+    { 15, 28, 18, 1, 27, 105, 17766 }, // ŗ
+    { 23, 32, 24, 1, 31, 184, 17871 }, // Ř
+    { 18, 25, 18, 1, 24, 113, 18055 }, // ř
+    { 21, 30, 26, 2, 29, 158, 18168 }, // Ś
+    { 16, 24, 21, 2, 22, 96, 18326 }, // ś
+    { 23, 31, 26, 2, 30, 179, 18422 }, // Ŝ
+    { 19, 26, 21, 2, 24, 124, 18601 }, // ŝ
+    { 21, 28, 26, 2, 21, 147, 18725 }, // Ş
+    { 16, 24, 21, 2, 16, 96, 18872 }, // ş
+    { 24, 32, 26, 2, 31, 192, 18968 }, // Š
+    { 20, 26, 21, 2, 24, 130, 19160 }, // š
+    { 20, 29, 26, 6, 22, 145, 19290 }, // Ţ
+    { 14, 26, 20, 3, 20, 91, 19435 }, // ţ
+    { 20, 32, 26, 6, 32, 160, 19526 }, // Ť
+    { 20, 23, 20, 4, 23, 115, 19686 }, // ť
+    { 20, 22, 26, 6, 22, 110, 19801 }, // Ŧ
+    { 15, 20, 20, 2, 20, 75, 19911 }, // ŧ
+    { 24, 34, 25, 2, 32, 204, 19986 }, // Ũ
+    { 17, 25, 21, 3, 24, 107, 20190 }, // ũ
+    { 24, 33, 25, 2, 31, 198, 20297 }, // Ū
+    { 18, 25, 21, 3, 24, 113, 20495 }, // ū
+    { 24, 33, 25, 2, 31, 198, 20608 }, // Ŭ
+    { 19, 25, 21, 3, 24, 119, 20806 }, // ŭ
+    { 24, 35, 25, 2, 33, 210, 20925 }, // Ů
+    { 16, 27, 21, 3, 26, 108, 21135 }, // ů
+    { 27, 32, 25, 2, 30, 216, 21243 }, // Ű
+    { 22, 24, 21, 3, 23, 132, 21459 }, // ű
+    { 24, 28, 25, 2, 21, 168, 21591 }, // Ų
+    { 16, 23, 21, 3, 15, 92, 21759 }, // ų
+    { 30, 31, 35, 6, 31, 233, 21851 }, // Ŵ
+    { 21, 26, 28, 5, 25, 137, 22084 }, // ŵ
+    { 20, 33, 26, 7, 33, 165, 22221 }, // Ŷ
+    { 21, 33, 23, 1, 26, 174, 22386 }, // ŷ
+    { 20, 33, 26, 7, 33, 165, 22560 }, // Ÿ
+    { 26, 28, 27, 1, 28, 182, 22725 }, // Ź
+    { 19, 24, 22, 1, 24, 114, 22907 }, // ź
+    { 26, 29, 27, 1, 29, 189, 23021 }, // Ż
+    { 19, 24, 22, 1, 24, 114, 23210 }, // ż
+    { 26, 31, 27, 1, 31, 202, 23324 }, // Ž
+    { 23, 26, 22, 1, 26, 150, 23526 }, // ž
+    { 15, 21, 15, 2, 21, 79, 23676 }, // ſ
+    { 10, 6, 0, 5, 20, 15, 23755 }, // ̀
+    { 8, 6, 0, 4, 19, 12, 23770 }, // ́
+    { 14, 7, 0, -1, 1, 25, 23782 }, // ̂
+    { 11, 5, 0, 5, 19, 14, 23807 }, // ̃
+    { 14, 4, 0, 5, 17, 14, 23821 }, // ̄
+    { 18, 4, 0, 6, 23, 18, 23835 }, // ̅
+    { 13, 6, 0, 5, 18, 20, 23853 }, // ̆
+    { 7, 6, 0, 5, 21, 11, 23873 }, // ̇
+    { 13, 5, 0, 3, 18, 17, 23884 }, // ̈
+    { 5, 6, 0, 9, 16, 8, 23901 }, // ̉
+    { 7, 7, 0, 5, 20, 13, 23909 }, // ̊
+    { 20, 6, 0, 5, 20, 30, 23922 }, // ̋
+    { 14, 7, 0, 5, 20, 25, 23952 }, // ̌
+    { 21, 6, 0, -9, 20, 32, 23977 }, // ̏
+    { 11, 9, 0, 3, 20, 25, 24009 }, // ̒
+    { 11, 9, 0, 3, 19, 25, 24034 }, // ̓
+    { 11, 9, 0, -6, 19, 25, 24059 }, // ̔
+    { 7, 7, 0, 0, 0, 13, 24084 }, // ̘
+    { 7, 7, 0, 1, 0, 13, 24097 }, // ̙
+    { 12, 8, 0, 6, 21, 24, 24110 }, // ̚
+    { 7, 8, 0, 3, 17, 14, 24134 }, // ̛
+    { 6, 8, 0, -1, 0, 12, 24148 }, // ̜
+    { 7, 7, 0, 2, 5, 13, 24160 }, // ̝
+    { 7, 7, 0, -1, 0, 13, 24173 }, // ̞
+    { 6, 6, 0, 0, -2, 9, 24186 }, // ̟
+    { 14, 4, 0, -1, -3, 14, 24195 }, // ̠
+    { 7, 6, 0, -3, 2, 11, 24209 }, // ̣
+    { 12, 5, 0, -2, -2, 15, 24220 }, // ̤
+    { 7, 7, 0, 5, 20, 13, 24235 }, // ̥
+    { 11, 9, 0, -1, 4, 25, 24248 }, // ̦
+    { 8, 8, 0, -1, 1, 16, 24273 }, // ̧
+    { 8, 9, 0, 0, 1, 18, 24289 }, // ̨
+    { 8, 9, 0, -2, 0, 18, 24307 }, // ̩
+    { 12, 6, 0, -1, 0, 18, 24325 }, // ̪
+    { 16, 8, 0, -1, 1, 32, 0 }, // ̬
+    { 16, 8, 0, -1, 1, 32, 32 }, // ̭
+    { 12, 6, 0, 6, 21, 18, 64 }, // ̰
+    { 13, 4, 0, 6, 21, 13, 82 }, // ̱
+    { 14, 4, 0, -2, -1, 14, 95 }, // ̲
+    { 13, 6, 0, 6, 21, 20, 109 }, // ̴
+    { 14, 3, 0, 2, 9, 11, 129 }, // ̵
+    { 7, 9, 0, 1, 0, 16, 140 }, // ̹
+    { 14, 8, 0, -4, 1, 28, 156 }, // ̺
+    { 13, 8, 0, -2, 1, 26, 184 }, // ̻
+    { 11, 7, 0, -1, 1, 20, 210 }, // ̼
+    { 9, 6, 0, 5, 19, 14, 230 }, // ̽
+    { 11, 5, 0, 5, 19, 14, 244 }, // ͂
+    { 6, 7, 0, 10, 22, 11, 258 }, // ̓
+    { 15, 19, 0, 4, 32, 72, 269 }, // ̈́
+    { 12, 7, 0, 4, 21, 21, 341 }, // ͆
+    { 16, 10, 0, -2, 0, 40, 362 }, // ͇
+    { 13, 8, 0, -1, 1, 26, 402 }, // ͈
+    { 10, 8, 0, -1, -1, 20, 428 }, // ͉
+    { 18, 21, 0, 4, 27, 95, 448 }, // ͊
+    { 26, 20, 0, 8, 30, 130, 543 }, // ͋
+    { 18, 14, 0, 13, 14, 63, 673 }, // ͌
+    { 13, 28, 0, 1, 9, 91, 736 }, // ͍
+    { 5, 4, 0, 12, 3, 5, 827 }, // ͎
+    { 22, 7, 0, 0, 1, 39, 832 }, // ͜
+    { 22, 6, 0, 4, 20, 33, 871 }, // ͡
+    { 27, 8, 0, -1, -1, 54, 904 }, // ͢
+    { 22, 30, 22, 1, 30, 165, 958 }, // Ѐ
+    { 22, 31, 22, 1, 31, 171, 0 }, // Ё
+    { 23, 23, 17, 3, 22, 133, 1123 }, // Ђ
+    { 19, 29, 16, 1, 28, 138, 1256 }, // Ѓ
+    { 22, 22, 21, 1, 20, 121, 1394 }, // Є
+    { 21, 22, 26, 2, 21, 116, 1515 }, // Ѕ
+    { 12, 23, 13, 1, 22, 69, 1631 }, // І
+    { 17, 32, 13, 1, 31, 136, 1700 }, // Ї
+    { 23, 27, 22, 0, 21, 156, 1836 }, // Ј
+    { 27, 21, 29, 2, 19, 142, 1992 }, // Љ
+    { 26, 21, 15, -5, 20, 137, 2134 }, // Њ
+    { 20, 24, 26, 6, 23, 120, 2271 }, // Ћ
+    { 23, 28, 26, 1, 28, 161, 2391 }, // Ќ
+    { 23, 28, 24, 1, 28, 161, 2552 }, // Ѝ
+    { 21, 32, 20, 0, 29, 168, 2713 }, // Ў
+    { 21, 25, 20, 2, 19, 132, 2881 }, // Џ
+    { 22, 21, 28, 1, 21, 116, 171 }, // А
+    { 18, 20, 16, 2, 19, 90, 287 }, // Б
+    { 18, 19, 17, 1, 18, 86, 377 }, // В
+    { 19, 20, 16, 1, 19, 95, 463 }, // Г
+    { 22, 23, 21, 1, 19, 127, 558 }, // Д
+    { 21, 21, 22, 1, 21, 111, 685 }, // Е
+    { 35, 21, 37, 1, 21, 184, 796 }, // Ж
+    { 16, 20, 16, 2, 18, 80, 980 }, // З
+    { 23, 21, 24, 1, 21, 121, 1060 }, // И
+    { 23, 28, 24, 1, 28, 161, 1181 }, // Й
+    { 23, 21, 26, 1, 21, 121, 1342 }, // К
+    { 22, 21, 15, -1, 19, 116, 1463 }, // Л
+    { 24, 20, 21, 1, 19, 120, 1579 }, // М
+    { 24, 21, 26, 1, 21, 126, 1699 }, // Н
+    { 25, 24, 28, 2, 22, 150, 1825 }, // О
+    { 20, 21, 17, 1, 20, 105, 1975 }, // П
+    { 21, 22, 22, 1, 22, 116, 2080 }, // Р
+    { 22, 23, 24, 2, 23, 127, 2196 }, // С
+    { 20, 22, 26, 6, 22, 110, 2323 }, // Т
+    { 21, 22, 20, 0, 19, 116, 2433 }, // У
+    { 19, 19, 22, 5, 19, 91, 2549 }, // Ф
+    { 26, 21, 27, 1, 21, 137, 2640 }, // Х
+    { 19, 24, 18, 1, 19, 114, 2777 }, // Ц
+    { 16, 19, 17, 4, 19, 76, 2891 }, // Ч
+    { 23, 20, 20, 1, 19, 115, 2967 }, // Ш
+    { 23, 25, 23, 1, 20, 144, 3082 }, // Щ
+    { 17, 19, 16, -1, 18, 81, 3226 }, // Ъ
+    { 27, 23, 29, 1, 22, 156, 3307 }, // Ы
+    { 15, 20, 16, 1, 19, 75, 3463 }, // Ь
+    { 23, 22, 24, 1, 20, 127, 3538 }, // Э
+    { 24, 21, 23, 2, 20, 126, 3665 }, // Ю
+    { 21, 22, 22, 1, 21, 116, 3791 }, // Я
+    { 16, 17, 21, 2, 16, 68, 3907 }, // а
+    { 20, 23, 17, 2, 22, 115, 3975 }, // б
+    { 15, 15, 18, -1, 15, 57, 4090 }, // в
+    { 17, 16, 15, 1, 15, 68, 4147 }, // г
+    { 19, 19, 19, 1, 15, 91, 4215 }, // д
+    { 17, 16, 21, 2, 15, 68, 4306 }, // е
+    { 34, 18, 37, 1, 18, 153, 4374 }, // ж
+    { 12, 13, 11, -2, 13, 39, 4527 }, // з
+    { 18, 16, 17, 1, 15, 72, 4566 }, // и
+    { 18, 21, 16, 0, 21, 95, 4638 }, // й
+    { 17, 14, 20, -1, 14, 60, 4733 }, // к
+    { 15, 15, 10, -3, 13, 57, 4793 }, // л
+    { 19, 16, 21, -1, 16, 76, 4850 }, // м
+    { 20, 16, 21, -1, 16, 80, 4926 }, // н
+    { 17, 16, 21, 2, 15, 68, 5006 }, // о
+    { 18, 16, 17, 1, 15, 72, 5074 }, // п
+    { 22, 23, 23, -1, 15, 127, 5146 }, // р
+    { 14, 16, 20, 2, 16, 56, 5273 }, // с
+    { 16, 16, 17, 4, 15, 64, 5329 }, // т
+    { 21, 21, 23, 1, 14, 111, 5393 }, // у
+    { 22, 21, 22, 2, 15, 116, 5504 }, // ф
+    { 21, 16, 18, 0, 15, 84, 5620 }, // х
+    { 18, 19, 18, 1, 15, 86, 5704 }, // ц
+    { 11, 13, 11, 0, 13, 36, 5790 }, // ч
+    { 22, 16, 20, 1, 15, 88, 5826 }, // ш
+    { 22, 20, 22, 1, 15, 110, 5914 }, // щ
+    { 13, 15, 12, -3, 14, 49, 6024 }, // ъ
+    { 21, 17, 22, -2, 16, 90, 6073 }, // ы
+    { 11, 15, 12, -1, 14, 42, 6163 }, // ь
+    { 15, 15, 16, 2, 14, 57, 6205 }, // э
+    { 19, 17, 18, 0, 16, 81, 6262 }, // ю
+    { 14, 16, 21, 2, 16, 56, 6343 }, // я
+    { 18, 28, 21, 2, 27, 126, 3013 }, // ѐ
+    { 19, 27, 21, 2, 26, 129, 6399 }, // ё
+    { 18, 27, 22, 1, 21, 122, 3139 }, // ђ
+    { 17, 23, 15, 1, 22, 98, 3261 }, // ѓ
+    { 16, 16, 14, -2, 14, 64, 3359 }, // є
+    { 16, 18, 21, 2, 16, 72, 3423 }, // ѕ
+    { 12, 25, 11, 1, 24, 75, 3495 }, // і
+    { 13, 24, 11, 1, 23, 78, 3570 }, // ї
+    { 16, 29, 16, 2, 22, 116, 3648 }, // ј
+    { 18, 15, 20, -1, 13, 68, 3764 }, // љ
+    { 18, 15, 10, -6, 14, 68, 3832 }, // њ
+    { 18, 22, 22, 1, 21, 99, 3900 }, // ћ
+    { 18, 21, 20, -1, 21, 95, 3999 }, // ќ
+    { 18, 25, 17, 1, 24, 113, 4094 }, // ѝ
+    { 23, 33, 23, 1, 26, 190, 4207 }, // ў
+    { 16, 18, 15, -1, 13, 72, 4397 }, // џ
+    { 16, 21, 19, 4, 19, 84, 4469 }, // Ѣ
+    { 16, 21, 16, 3, 19, 84, 4553 }, // ѣ
+    { 27, 22, 22, -1, 20, 149, 4637 }, // Ѫ
+    { 19, 15, 15, -3, 13, 72, 4786 }, // ѫ
+    { 28, 27, 28, 2, 26, 189, 4858 }, // Ѳ
+    { 22, 22, 21, 2, 21, 121, 5047 }, // ѳ
+    { 25, 25, 28, 7, 25, 157, 5168 }, // Ѵ
+    { 18, 18, 22, 5, 18, 81, 5325 }, // ѵ
+    { 12, 9, 0, 7, 24, 27, 5406 }, // ҆
+    { 20, 23, 16, 1, 22, 115, 5433 }, // Ґ
+    { 18, 20, 15, 1, 19, 90, 5548 }, // ґ
+    { 19, 20, 16, 1, 19, 95, 5638 }, // Ғ
+    { 14, 14, 11, -2, 13, 49, 5733 }, // ғ
+    { 20, 23, 15, 0, 22, 115, 5782 }, // Ҕ
+    { 13, 15, 9, -3, 13, 49, 5897 }, // ҕ
+    { 35, 26, 38, 1, 21, 228, 5946 }, // Җ
+    { 25, 18, 25, -2, 15, 113, 6174 }, // җ
+    { 16, 23, 16, 2, 18, 92, 6287 }, // Ҙ
+    { 12, 19, 11, -2, 13, 57, 6379 }, // ҙ
+    { 23, 25, 18, 0, 21, 144, 6436 }, // Қ
+    { 15, 18, 13, -2, 15, 68, 6580 }, // қ
+    { 27, 20, 27, 1, 19, 135, 6648 }, // Ҝ
+    { 19, 14, 19, 0, 13, 67, 6783 }, // ҝ
+    { 23, 21, 26, 1, 21, 121, 6850 }, // Ҟ
+    { 16, 21, 22, 1, 21, 84, 6971 }, // ҟ
+    { 23, 21, 26, 1, 21, 121, 7055 }, // Ҡ
+    { 16, 15, 18, -2, 15, 60, 7176 }, // ҡ
+    { 24, 25, 19, -2, 21, 150, 7236 }, // Ң
+    { 17, 17, 13, -4, 15, 73, 7386 }, // ң
+    { 34, 21, 26, 1, 21, 179, 7459 }, // Ҥ
+    { 24, 15, 18, -2, 15, 90, 7638 }, // ҥ
+    { 30, 22, 32, 2, 21, 165, 7728 }, // Ҧ
+    { 24, 25, 32, 4, 17, 150, 7893 }, // ҧ
+    { 26, 21, 17, -3, 19, 137, 8043 }, // Ҩ
+    { 21, 18, 25, 1, 16, 95, 8180 }, // ҩ
+    { 22, 27, 24, 2, 23, 149, 8275 }, // Ҫ
+    { 14, 19, 20, 2, 16, 67, 8424 }, // ҫ
+    { 20, 24, 19, 3, 21, 120, 8491 }, // Ҭ
+    { 15, 17, 13, -1, 15, 64, 8611 }, // ҭ
+    { 20, 21, 26, 7, 21, 105, 8675 }, // Ү
+    { 16, 20, 19, 5, 14, 80, 8780 }, // ү
+    { 23, 21, 26, 4, 21, 121, 8860 }, // Ұ
+    { 20, 20, 19, 1, 14, 100, 8981 }, // ұ
+    { 26, 25, 20, 1, 21, 163, 9081 }, // Ҳ
+    { 18, 18, 20, 1, 15, 81, 9244 }, // ҳ
+    { 21, 24, 15, 0, 19, 126, 9325 }, // Ҵ
+    { 16, 18, 22, 3, 13, 72, 9451 }, // ҵ
+    { 17, 25, 17, 3, 19, 107, 9523 }, // Ҷ
+    { 12, 19, 12, 0, 14, 57, 9630 }, // ҷ
+    { 16, 19, 17, 4, 19, 76, 9687 }, // Ҹ
+    { 11, 13, 11, 0, 13, 36, 9763 }, // ҹ
+    { 17, 23, 17, 1, 21, 98, 9799 }, // Һ
+    { 18, 22, 22, 1, 21, 99, 9897 }, // һ
+    { 28, 20, 35, 5, 19, 140, 9996 }, // Ҽ
+    { 21, 14, 17, 1, 13, 74, 10136 }, // ҽ
+    { 29, 24, 22, 6, 19, 174, 10210 }, // Ҿ
+    { 21, 17, 16, 2, 13, 90, 10384 }, // ҿ
+    { 12, 23, 13, 1, 22, 69, 10474 }, // Ӏ
+    { 35, 34, 37, 1, 34, 298, 10543 }, // Ӂ
+    { 34, 29, 37, 1, 29, 247, 10841 }, // ӂ
+    { 20, 26, 18, 1, 19, 130, 11088 }, // Ӄ
+    { 14, 19, 12, -2, 13, 67, 11218 }, // ӄ
+    { 22, 25, 15, -1, 19, 138, 11285 }, // Ӆ
+    { 15, 17, 10, -1, 13, 64, 11423 }, // ӆ
+    { 24, 27, 26, 1, 21, 162, 11487 }, // Ӈ
+    { 17, 20, 18, -2, 15, 85, 11649 }, // ӈ
+    { 24, 29, 26, 1, 21, 174, 11734 }, // Ӊ
+    { 17, 21, 18, 0, 15, 90, 11908 }, // ӊ
+    { 17, 25, 17, 4, 19, 107, 11998 }, // Ӌ
+    { 11, 17, 15, 2, 13, 47, 12105 }, // ӌ
+    { 27, 30, 29, 1, 21, 203, 12152 }, // Ӎ
+    { 19, 21, 20, 0, 15, 100, 12355 }, // ӎ
+    { 10, 19, 15, 5, 18, 48, 12455 }, // ӏ
+    { 26, 29, 28, 1, 29, 189, 12503 }, // Ӑ
+    { 20, 25, 21, 2, 24, 125, 12692 }, // ӑ
+    { 24, 28, 28, 1, 28, 168, 12817 }, // Ӓ
+    { 20, 25, 21, 2, 24, 125, 12985 }, // ӓ
+    { 35, 22, 34, 1, 21, 193, 13110 }, // Ӕ
+    { 26, 17, 31, 2, 16, 111, 13303 }, // ӕ
+    { 24, 30, 22, 1, 30, 180, 13414 }, // Ӗ
+    { 21, 27, 21, 2, 26, 142, 13594 }, // ӗ
+    { 21, 21, 27, 8, 19, 111, 13736 }, // Ә
+    { 16, 17, 21, 8, 16, 68, 13847 }, // ә
+    { 21, 29, 27, 8, 27, 153, 13915 }, // Ӛ
+    { 18, 21, 21, 6, 16, 95, 14068 }, // ӛ
+    { 35, 32, 35, 4, 32, 280, 14163 }, // Ӝ
+    { 34, 28, 37, 1, 28, 238, 14443 }, // ӝ
+    { 18, 31, 16, 2, 29, 140, 14681 }, // Ӟ
+    { 17, 20, 11, -2, 20, 85, 14821 }, // ӟ
+    { 16, 20, 17, 3, 19, 80, 14906 }, // Ӡ
+    { 16, 20, 17, 1, 14, 80, 14986 }, // ӡ
+    { 23, 28, 23, 1, 28, 161, 15066 }, // Ӣ
+    { 20, 24, 17, 1, 23, 120, 15227 }, // ӣ
+    { 23, 27, 24, 1, 27, 156, 15347 }, // Ӥ
+    { 18, 23, 17, 1, 22, 104, 15503 }, // ӥ
+    { 25, 31, 28, 2, 29, 194, 15607 }, // Ӧ
+    { 18, 26, 21, 2, 25, 117, 15801 }, // ӧ
+    { 23, 20, 28, 3, 19, 115, 15918 }, // Ө
+    { 17, 16, 21, 2, 15, 68, 16033 }, // ө
+    { 23, 28, 28, 3, 27, 161, 16101 }, // Ӫ
+    { 18, 23, 21, 2, 22, 104, 16262 }, // ӫ
+    { 38, 32, 24, 1, 30, 304, 16366 }, // Ӭ
+    { 15, 21, 16, 2, 20, 79, 16670 }, // ӭ
+    { 21, 33, 20, 0, 30, 174, 16749 }, // Ӯ
+    { 22, 33, 23, 1, 26, 182, 16923 }, // ӯ
+    { 21, 32, 20, 0, 29, 168, 17105 }, // Ӱ
+    { 21, 32, 23, 1, 25, 168, 17273 }, // ӱ
+    { 24, 32, 20, 0, 29, 192, 17441 }, // Ӳ
+    { 26, 32, 23, 1, 25, 208, 17633 }, // ӳ
+    { 16, 25, 17, 4, 25, 100, 17841 }, // Ӵ
+    { 13, 19, 11, 0, 19, 62, 17941 }, // ӵ
+    { 19, 23, 16, 1, 19, 110, 18003 }, // Ӷ
+    { 14, 16, 11, -2, 13, 56, 18113 }, // ӷ
+    { 27, 34, 29, 1, 33, 230, 18169 }, // Ӹ
+    { 23, 27, 22, -2, 26, 156, 18399 }, // ӹ
+    { 26, 24, 27, 1, 21, 156, 18555 }, // Ӽ
+    { 19, 17, 19, -2, 15, 81, 18711 }, // ӽ
+    { 0, 0, 17, 0, 0, 0, 18792 }, //  
+    { 0, 0, 29, 0, 0, 0, 18792 }, //  
+    { 0, 0, 17, 0, 0, 0, 18792 }, //  
+    { 0, 0, 29, 0, 0, 0, 18792 }, //  
+    { 0, 0, 12, 0, 0, 0, 18792 }, //  
+    { 0, 0, 10, 0, 0, 0, 18792 }, //  
+    { 0, 0, 8, 0, 0, 0, 18792 }, //  
+    { 0, 0, 18, 0, 0, 0, 18792 }, //  
+    { 0, 0, 7, 0, 0, 0, 18792 }, //  
+    { 0, 0, 9, 0, 0, 0, 18792 }, //  
+    { 0, 0, 8, 0, 0, 0, 18792 }, //  
+    { 0, 0, 4, 0, 0, 0, 18792 }, // ​
+    { 0, 0, 0, 0, 0, 0, 18792 }, // ‌
+    { 0, 0, 0, 0, 0, 0, 18792 }, // ‍
+    { 0, 0, 0, 0, 0, 0, 18792 }, // ‎
+    { 0, 0, 0, 0, 0, 0, 18792 }, // ‏
+    { 14, 3, 14, 2, 9, 11, 18792 }, // ‐
+    { 14, 3, 14, 2, 9, 11, 18803 }, // ‑
+    { 21, 3, 14, -1, 9, 16, 18814 }, // ‒
+    { 20, 5, 20, 2, 10, 25, 15850 }, // –
+    { 28, 5, 29, 2, 10, 35, 15875 }, // —
+    { 28, 5, 29, 2, 10, 35, 18830 }, // ―
+    { 18, 23, 14, 1, 18, 104, 18865 }, // ‖
+    { 23, 8, 14, -5, -2, 46, 18969 }, // ‗
+    { 11, 9, 11, 5, 22, 25, 15910 }, // ‘
+    { 11, 9, 11, 5, 22, 25, 15935 }, // ’
+    { 11, 9, 8, -2, 4, 25, 19015 }, // ‚
+    { 11, 9, 11, 5, 22, 25, 19040 }, // ‛
+    { 19, 9, 19, 5, 22, 43, 15960 }, // “
+    { 19, 9, 19, 5, 22, 43, 16003 }, // ”
+    { 11, 9, 8, -2, 4, 25, 19065 }, // „
+    { 19, 9, 19, 5, 22, 43, 19090 }, // ‟
+    { 15, 35, 20, 6, 26, 132, 19133 }, // †
+    { 18, 35, 22, 5, 26, 158, 19265 }, // ‡
+    { 23, 19, 13, -3, 22, 110, 19423 }, // •
+    { 10, 9, 15, 4, 11, 23, 19533 }, // ‣
+    { 7, 6, 15, 4, 6, 11, 19556 }, // ․
+    { 7, 6, 15, 4, 6, 11, 19567 }, // ‥
+    { 24, 6, 24, 0, 6, 36, 16046 }, // …
+    { 4, 3, 14, 5, 9, 3, 19578 }, // ‧
+    { 0, 0, 28, 0, 0, 0, 19581 }, //  
+    { 23, 22, 28, 3, 20, 127, 19581 }, // ‰
+    { 11, 9, 14, 8, 22, 25, 19708 }, // ′
+    { 19, 9, 20, 8, 22, 43, 19733 }, // ″
+    { 18, 8, 10, -2, 21, 36, 19776 }, // ‴
+    { 6, 8, 10, 7, 21, 12, 19812 }, // ‵
+    { 11, 8, 10, 5, 21, 22, 19824 }, // ‶
+    { 19, 8, 10, 0, 21, 38, 19846 }, // ‷
+    { 15, 6, 16, 5, 21, 23, 19884 }, // ‸
+    { 10, 14, 10, 3, 14, 35, 19907 }, // ‹
+    { 11, 14, 10, -3, 14, 39, 19942 }, // ›
+    { 33, 32, 34, 2, 25, 264, 19981 }, // ※
+    { 15, 32, 15, 2, 28, 120, 20245 }, // ‼
+    { 20, 40, 22, 4, 34, 200, 20365 }, // ‽
+    { 14, 3, 14, 5, 21, 11, 20565 }, // ‾
+    { 13, 6, 19, 5, 17, 20, 20576 }, // ‿
+    { 18, 17, 16, 2, 23, 77, 20596 }, // ⁂
+    { 23, 22, 32, 5, 20, 127, 20673 }, // ⁄
+    { 34, 31, 38, 6, 28, 264, 20800 }, // ⁇
+    { 29, 32, 30, 5, 28, 232, 21064 }, // ⁈
+    { 28, 32, 19, -2, 28, 224, 21296 }, // ⁉
+    { 29, 44, 23, -2, 30, 319, 21520 }, // ⁒
+    { 0, 0, 117, 0, 0, 0, 21839 }, //  
+    { 9, 10, 8, 9, 21, 23, 21839 }, // ⁰
+    { 8, 9, 9, 10, 21, 18, 21862 }, // ⁴
+    { 9, 11, 9, 9, 22, 25, 21880 }, // ⁵
+    { 9, 10, 9, 9, 21, 23, 21905 }, // ⁶
+    { 8, 11, 9, 11, 22, 22, 21928 }, // ⁷
+    { 9, 11, 9, 9, 21, 25, 21950 }, // ⁸
+    { 9, 11, 9, 9, 21, 25, 21975 }, // ⁹
+    { 18, 16, 22, 1, 16, 72, 22000 }, // ⁿ
+    { 10, 10, 9, -8, 6, 25, 22072 }, // ₀
+    { 7, 11, 8, -8, 6, 20, 22097 }, // ₁
+    { 10, 11, 9, -8, 6, 28, 22117 }, // ₂
+    { 10, 10, 9, -8, 6, 25, 22145 }, // ₃
+    { 9, 10, 9, -8, 6, 23, 22170 }, // ₄
+    { 9, 10, 8, -8, 6, 23, 22193 }, // ₅
+    { 10, 10, 9, -8, 6, 25, 22216 }, // ₆
+    { 8, 11, 9, -6, 6, 22, 22241 }, // ₇
+    { 10, 11, 9, -8, 6, 28, 22263 }, // ₈
+    { 10, 11, 9, -8, 6, 28, 22291 }, // ₉
+    { 18, 35, 12, 1, 26, 158, 22319 }, // ₍
+    { 17, 35, 11, -8, 26, 149, 22477 }, // ₎
+    { 23, 33, 24, 3, 28, 190, 22626 }, // ₡
+    { 22, 23, 24, 2, 23, 127, 22816 }, // ₢
+    { 19, 23, 17, 1, 22, 110, 22943 }, // ₤
+    { 29, 21, 25, -1, 21, 153, 23053 }, // ₦
+    { 24, 22, 22, 1, 22, 132, 23206 }, // ₧
+    { 30, 23, 33, -1, 21, 173, 23338 }, // ₨
+    { 23, 22, 21, -2, 22, 127, 23511 }, // ₩
+    { 24, 19, 27, 4, 19, 114, 23638 }, // ₪
+    { 22, 22, 13, -2, 21, 121, 23752 }, // ₫
+    { 20, 24, 21, 2, 21, 120, 23873 }, // €
+    { 20, 22, 26, 6, 22, 110, 23993 }, // ₮
+    { 27, 22, 16, 0, 22, 149, 24103 }, // ₱
+    { 23, 33, 28, 2, 28, 190, 0 }, // ₲
+    { 29, 21, 26, 7, 19, 153, 190 }, // ₴
+    { 14, 21, 15, 2, 18, 74, 343 }, // ₵
+    { 24, 23, 26, 6, 23, 138, 417 }, // ₸
+    { 16, 21, 17, 4, 20, 84, 555 }, // ₹
+    { 16, 19, 17, 2, 17, 76, 639 }, // ₺
+    { 20, 21, 20, 3, 19, 105, 715 }, // ₼
+    { 25, 22, 22, -3, 22, 138, 820 }, // ₽
+    { 17, 18, 18, -4, 13, 77, 958 }, // ←
+    { 18, 18, 19, 3, 17, 81, 1035 }, // ↑
+    { 18, 18, 19, 5, 13, 81, 1116 }, // →
+    { 18, 18, 19, 7, 16, 81, 1197 }, // ↓
+    { 28, 15, 26, -1, 12, 105, 1278 }, // ↔
+    { 15, 28, 20, 4, 27, 105, 1383 }, // ↕
+    { 17, 12, 20, -2, 11, 51, 1488 }, // ↖
+    { 17, 12, 16, 3, 11, 51, 1539 }, // ↗
+    { 14, 17, 16, 5, 15, 60, 1590 }, // ↘
+    { 14, 17, 16, -3, 15, 60, 1650 }, // ↙
+    { 20, 18, 24, 1, 16, 90, 1710 }, // ⇐
+    { 22, 20, 27, 5, 19, 110, 1800 }, // ⇑
+    { 21, 18, 24, 3, 16, 95, 1910 }, // ⇒
+    { 22, 20, 27, 10, 18, 110, 2005 }, // ⇓
+    { 26, 18, 27, 1, 16, 117, 2115 }, // ⇔
+    { 18, 25, 22, 6, 14, 113, 2232 }, // ⇕
+    { 20, 22, 17, 1, 21, 110, 2345 }, // ∂
+    { 27, 26, 28, 0, 24, 176, 2455 }, // ∅
+    { 20, 20, 22, 1, 19, 100, 2631 }, // ∆
+    { 19, 20, 18, 3, 19, 95, 2731 }, // ∏
+    { 20, 19, 18, 7, 18, 95, 2826 }, // ∐
+    { 18, 20, 15, 1, 19, 90, 2921 }, // ∑
+    { 14, 4, 15, 2, 9, 14, 3011 }, // −
+    { 25, 23, 24, 3, 21, 144, 3025 }, // √
+    { 23, 14, 23, 2, 16, 81, 3169 }, // ∞
+    { 26, 27, 21, 0, 20, 176, 3250 }, // ∫
+    { 10, 17, 8, 1, 17, 43, 3426 }, // ∶
+    { 18, 14, 36, 13, 14, 63, 3469 }, // ≈
+    { 23, 22, 32, 5, 20, 127, 3532 }, // ≠
+    { 24, 21, 20, -3, 18, 126, 3659 }, // ≤
+    { 24, 22, 22, 0, 19, 132, 3785 }, // ≥
+    { 24, 21, 27, 3, 21, 126, 3917 }, // ﬀ
+    { 22, 25, 24, 3, 24, 138, 4043 }, // ﬁ
+    { 22, 21, 27, 3, 21, 116, 4181 }, // ﬂ
+    { 31, 25, 33, 3, 24, 194, 4297 }, // ﬃ
+    { 32, 21, 37, 3, 21, 168, 4491 }, // ﬄ
+    { 29, 22, 30, 0, 20, 160, 4659 }, // ﬆ
 };
 
 static const EpdUnicodeInterval opendyslexic_12_bolditalicIntervals[] = {
@@ -2867,30 +2856,98 @@ static const EpdUnicodeInterval opendyslexic_12_bolditalicIntervals[] = {
     { 0x2248, 0x2248, 0x2D1 },
     { 0x2260, 0x2260, 0x2D2 },
     { 0x2264, 0x2265, 0x2D3 },
+    { 0xFB00, 0xFB04, 0x2D5 },
+    { 0xFB06, 0xFB06, 0x2DA },
 };
 
 static const EpdFontGroup opendyslexic_12_bolditalicGroups[] = {
-    { 0, 4563, 9191, 95, 0 },
-    { 4563, 4560, 11463, 96, 95 },
-    { 9123, 7068, 18951, 126, 191 },
-    { 16191, 939, 1546, 61, 317 },
-    { 17130, 10959, 24362, 213, 378 },
-    { 28089, 1518, 3279, 63, 591 },
-    { 29607, 514, 787, 20, 654 },
-    { 30121, 1368, 2584, 20, 674 },
-    { 31489, 826, 1387, 16, 694 },
-    { 32315, 817, 1572, 15, 710 },
+    { 0, 6541, 16082, 151, 0 },
+    { 6541, 3422, 6528, 66, 379 },
+    { 9963, 9385, 24343, 207, 96 },
+    { 19348, 11048, 24252, 262, 351 },
+    { 30396, 2463, 4819, 45, 686 },
+};
+
+static const uint8_t opendyslexic_12_bolditalicGlyphGroups[731] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 0,
+    0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 2, 2, 2, 0,
+    0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 1, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 3, 1, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 0, 0, 3, 3, 3, 0, 0, 3, 3, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+};
+
+static const EpdLigaturePair opendyslexic_12_bolditalicLigatures[] = {
+    { 0x66, 0x66, 0xFB00 },
+    { 0x66, 0x69, 0xFB01 },
+    { 0x66, 0x6C, 0xFB02 },
+    { 0xFB00, 0x69, 0xFB03 },
+    { 0xFB00, 0x6C, 0xFB04 },
+};
+
+static const uint16_t opendyslexic_12_bolditalicGlyphLookup[368] = {
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x005F, 0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E,
+    0x006F, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E,
+    0x007F, 0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E,
+    0x008F, 0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E,
+    0x009F, 0x00A0, 0x00A1, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE,
+    0x00AF, 0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE,
+    0x024F, 0x0250, 0x0251, 0x0252, 0x0253, 0x0254, 0x0255, 0x0256, 0x0257, 0x0258, 0x0259, 0x025A, 0x025B, 0x025C, 0x025D, 0x025E,
+    0x025F, 0x0260, 0x0261, 0x0262, 0x0263, 0x0264, 0x0265, 0x0266, 0x0267, 0x0268, 0x0269, 0x026A, 0x026B, 0x026C, 0x026D, 0x026E,
+    0x026F, 0x0270, 0x0271, 0x0272, 0x0273, 0x0274, 0x0275, 0x0276, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0277,
+    0x0278, 0xFFFF, 0x0279, 0x027A, 0x027B, 0x027C, 0x027D, 0x027E, 0x027F, 0x0280, 0x0281, 0x0282, 0x0283, 0x0284, 0x0285, 0x0286,
+    0xFFFF, 0xFFFF, 0x0287, 0xFFFF, 0x0288, 0xFFFF, 0xFFFF, 0x0289, 0x028A, 0x028B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x028C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x028D,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
 };
 
 static const EpdFontData opendyslexic_12_bolditalic = {
     opendyslexic_12_bolditalicBitmaps,
     opendyslexic_12_bolditalicGlyphs,
     opendyslexic_12_bolditalicIntervals,
-    56,
+    58,
     46,
     33,
     -13,
     true,
     opendyslexic_12_bolditalicGroups,
-    10,
+    5,
+    nullptr,
+    nullptr,
+    nullptr,
+    0,
+    opendyslexic_12_bolditalicLigatures,
+    5,
+    0x4000000001ull,
+    opendyslexic_12_bolditalicGlyphLookup,
+    opendyslexic_12_bolditalicGlyphGroups,
+    false,
+    nullptr,
 };
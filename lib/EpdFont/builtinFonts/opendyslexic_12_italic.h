@@ -3,1852 +3,1831 @@
  * name: opendyslexic_12_italic
  * size: 12
  * mode: 2-bit  compressed: true
- * Command used: fontconvert.py opendyslexic_12_italic 12 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Italic.otf --2bit --compress
+ * Command used: fontconvert.py opendyslexic_12_italic 12 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Italic.otf --2bit --compress --no-kerning --frequency-corpus ../../../test/hyphenation_eval/resources/english_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/french_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/german_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/italian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/russian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/spanish_hyphenation_tests.txt
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t opendyslexic_12_italicBitmaps[29437] = {
-    0x8D, 0x59, 0x4D, 0x8C, 0xDD, 0xD6, 0x75, 0x3E, 0x24, 0x35, 0xA2, 0x61, 0x36, 0xBA, 0xDE, 0x08,
-    0x48, 0xAC, 0x5A, 0xEC, 0xA6, 0x80, 0xDB, 0xC8, 0x66, 0x17, 0x59, 0x68, 0x31, 0xF3, 0x2E, 0x0B,
-    0x2F, 0xBC, 0x28, 0x0A, 0x67, 0x91, 0x49, 0x81, 0x76, 0xA1, 0x6E, 0xDD, 0xA2, 0x50, 0x17, 0x02,
-    0xA2, 0xC5, 0xCC, 0x90, 0x90, 0x17, 0x5E, 0x64, 0x11, 0x05, 0x88, 0xD1, 0x45, 0x36, 0x06, 0xEA,
-    0x02, 0x8D, 0x0C, 0x74, 0x84, 0x42, 0x8B, 0x59, 0xBC, 0x37, 0xA4, 0x2D, 0xA0, 0x5E, 0x18, 0xA8,
-    0x99, 0x06, 0x69, 0x36, 0x2D, 0xCA, 0x3A, 0x0E, 0x82, 0xC6, 0x0B, 0x31, 0x0D, 0x1D, 0x73, 0x64,
-    0x3E, 0xDE, 0x7C, 0xDF, 0xB9, 0x7C, 0x33, 0x23, 0x3B, 0x40, 0x2B, 0x48, 0x7C, 0xEF, 0x91, 0xBC,
-    0xF7, 0x9E, 0x9F, 0xEF, 0x7C, 0xE7, 0x47, 0x22, 0x5B, 0x22, 0xDB, 0x22, 0x7B, 0x22, 0x47, 0x22,
-    0xBD, 0x04, 0x9D, 0x84, 0x9D, 0x44, 0xAD, 0xC4, 0x8D, 0x24, 0xB5, 0x98, 0x5A, 0xD2, 0x52, 0xB2,
-    0x5C, 0xAC, 0xC8, 0x81, 0xC8, 0x4A, 0x64, 0xD4, 0xBF, 0xFA, 0xC7, 0xB4, 0x92, 0xB6, 0x62, 0x1B,
-    0x29, 0x1A, 0xA9, 0x6A, 0xA9, 0x5E, 0x1B, 0xD3, 0xB6, 0x7A, 0x69, 0xCC, 0x1A, 0x17, 0xF7, 0x59,
-    0x3D, 0xC5, 0xBD, 0xAD, 0xA7, 0xA4, 0xC3, 0x8B, 0x5D, 0xD0, 0xE2, 0x1A, 0x74, 0x51, 0x83, 0x8F,
-    0xB0, 0x8D, 0x6A, 0x7C, 0x44, 0x75, 0x52, 0xE2, 0x23, 0xA9, 0x4D, 0xCE, 0xAD, 0xCA, 0x14, 0x57,
-    0xC7, 0x3F, 0x63, 0xA4, 0x1F, 0xBD, 0xC8, 0xBE, 0x2C, 0x79, 0xCC, 0x52, 0x06, 0x7E, 0x0C, 0x01,
-    0xB7, 0x0A, 0xFB, 0x88, 0x1F, 0x51, 0x17, 0x73, 0xAF, 0xB8, 0x85, 0x8C, 0x62, 0x75, 0x81, 0x14,
-    0xBC, 0x4E, 0x22, 0x59, 0x69, 0xF9, 0xBE, 0xA5, 0xC0, 0x22, 0x05, 0x85, 0x16, 0x59, 0xAB, 0xD4,
-    0xC1, 0x18, 0x0E, 0xF2, 0xC5, 0x3F, 0x9D, 0x6E, 0xF9, 0x90, 0xF2, 0xA4, 0xD5, 0x5B, 0xD8, 0xD6,
-    0x39, 0xDC, 0xA9, 0x9C, 0xAB, 0x25, 0x71, 0xAF, 0xC0, 0x40, 0xC5, 0xD1, 0x75, 0xBC, 0x70, 0xF2,
-    0x43, 0x9C, 0x69, 0xDE, 0x4F, 0xB8, 0xEB, 0xF6, 0x36, 0xE5, 0xFD, 0x04, 0x7A, 0x85, 0xCE, 0x35,
-    0x7A, 0x85, 0xC4, 0xF2, 0x99, 0x1B, 0xB8, 0x13, 0xBF, 0x5F, 0xBA, 0xC4, 0x4D, 0x6E, 0x7D, 0x0B,
-    0x9B, 0x84, 0xEF, 0x3E, 0x72, 0x62, 0x0F, 0x0F, 0x5D, 0xAF, 0xBA, 0x95, 0x14, 0x78, 0x88, 0x54,
-    0xDA, 0xA0, 0x72, 0x53, 0x7E, 0x2A, 0xC2, 0x6B, 0x14, 0xE1, 0xA9, 0x2F, 0x9F, 0x97, 0xED, 0x1A,
-    0x2F, 0xB7, 0xE4, 0x58, 0x82, 0x36, 0xFA, 0x49, 0x1D, 0x95, 0x97, 0xA4, 0x36, 0xF2, 0xBB, 0x52,
-    0x6F, 0xCB, 0xB5, 0xA0, 0x7E, 0x20, 0xCF, 0x47, 0x77, 0x5A, 0xD9, 0xB9, 0xF2, 0x72, 0x29, 0xE9,
-    0x04, 0x13, 0x26, 0xFD, 0x3E, 0xDF, 0xE7, 0xC9, 0x51, 0x07, 0x99, 0x4D, 0x7D, 0x8D, 0x06, 0x79,
-    0x1E, 0xDA, 0xE4, 0x5F, 0x93, 0xE0, 0x57, 0xDF, 0xED, 0x24, 0x7E, 0x08, 0x89, 0x4C, 0x7E, 0x2C,
-    0xB2, 0x73, 0xEE, 0x98, 0x9B, 0x77, 0xF1, 0x32, 0x85, 0xB7, 0xF9, 0x1E, 0x4D, 0x8E, 0x67, 0x03,
-    0x1C, 0x00, 0xAB, 0xC3, 0x6E, 0x2B, 0x83, 0xFD, 0x6C, 0x05, 0xE1, 0xCC, 0x9A, 0xCA, 0x77, 0xD4,
-    0x17, 0xEF, 0x26, 0xC3, 0x4A, 0x9E, 0x49, 0xDB, 0x2C, 0x5F, 0xD9, 0xDA, 0xBC, 0x33, 0x16, 0x65,
-    0xF4, 0x69, 0x5F, 0xE5, 0xE2, 0x9A, 0xAA, 0x0E, 0x5C, 0x59, 0x9C, 0xDC, 0x74, 0x39, 0x54, 0xFD,
-    0xAC, 0x36, 0xCE, 0xDD, 0xC9, 0x83, 0xEA, 0xA3, 0xF9, 0xAC, 0xCB, 0xB9, 0x8B, 0xC6, 0xA4, 0x4B,
-    0x6B, 0x9B, 0x3B, 0xFE, 0x8E, 0x4A, 0x1E, 0x26, 0x2F, 0xC2, 0xF0, 0x35, 0x31, 0x28, 0x0B, 0xE2,
-    0x02, 0x36, 0xD1, 0x6F, 0xBC, 0x87, 0xA7, 0x50, 0x0E, 0xA8, 0x24, 0x54, 0x13, 0x7F, 0x03, 0xB8,
-    0x21, 0x22, 0x32, 0x22, 0x4A, 0x75, 0x21, 0xBA, 0xF8, 0x51, 0xEB, 0x5B, 0xFC, 0x38, 0x77, 0xB3,
-    0x25, 0x20, 0x24, 0xF2, 0x0B, 0xE4, 0x2F, 0xF5, 0x15, 0xAE, 0x33, 0xA5, 0x3E, 0xE7, 0x4E, 0x49,
-    0x7D, 0xF6, 0xD5, 0xDF, 0x45, 0x24, 0xF0, 0x18, 0x9E, 0x16, 0xFB, 0x87, 0x5C, 0x42, 0xA4, 0xCE,
-    0x0F, 0x8E, 0xFC, 0xAA, 0x3D, 0xFF, 0xFC, 0x0B, 0x1F, 0x7C, 0xB6, 0xA4, 0x13, 0xBC, 0x06, 0xA5,
-    0x04, 0x77, 0xA9, 0x6F, 0x08, 0x99, 0xEE, 0x5F, 0xB8, 0xBE, 0xFD, 0x42, 0xF6, 0xAF, 0xFB, 0x52,
-    0xF5, 0x12, 0x77, 0x92, 0xBA, 0xE6, 0xE0, 0xFA, 0xEA, 0xB9, 0x2F, 0x5D, 0x14, 0xA0, 0x2B, 0xC4,
-    0xE9, 0x41, 0xA3, 0x87, 0x40, 0xCA, 0xAB, 0xD8, 0x27, 0x87, 0x05, 0x7F, 0x42, 0x50, 0xDE, 0x16,
-    0x79, 0x01, 0x1B, 0xEA, 0x09, 0x7C, 0x65, 0x37, 0x5A, 0xC3, 0x94, 0xBD, 0xE9, 0xD2, 0xC6, 0xD6,
-    0x55, 0xFE, 0xEC, 0xBD, 0x7B, 0x78, 0xF3, 0x3D, 0xBE, 0x19, 0xFD, 0xEF, 0x30, 0x55, 0xB9, 0xDA,
-    0x3B, 0xD4, 0x6B, 0xA2, 0x3F, 0x34, 0xF6, 0x54, 0x02, 0xAF, 0xC5, 0xE9, 0xF5, 0xB6, 0x5E, 0xB7,
-    0xF5, 0xFA, 0xA2, 0x0F, 0x6F, 0xBF, 0xAC, 0x3C, 0x5B, 0xA6, 0xF1, 0xAB, 0x06, 0x12, 0xF5, 0x93,
-    0xA8, 0x96, 0xBF, 0x75, 0x99, 0xD1, 0x65, 0xB1, 0x5F, 0xD6, 0x7E, 0x61, 0x99, 0x06, 0xF6, 0x0C,
-    0x40, 0x8D, 0x56, 0x49, 0xF3, 0xDF, 0xBE, 0x2C, 0xF4, 0xCB, 0x86, 0x73, 0xCB, 0xF6, 0xCF, 0x2D,
-    0xBB, 0xAA, 0xD7, 0xDF, 0x79, 0x32, 0x9E, 0x6F, 0x42, 0xCE, 0x1E, 0x4F, 0xBA, 0xB0, 0xC6, 0x79,
-    0xB7, 0xB1, 0xEC, 0xAA, 0xEC, 0x5C, 0x88, 0xCB, 0x2C, 0xB9, 0xD3, 0x9A, 0xD7, 0xDA, 0x3E, 0x6E,
-    0xFA, 0xED, 0xB0, 0xDB, 0xCE, 0x64, 0x7C, 0xCA, 0x80, 0x2C, 0x92, 0xC6, 0xD4, 0x51, 0x17, 0xF5,
-    0xF1, 0x20, 0xEE, 0x70, 0x04, 0x9D, 0xAC, 0x11, 0xF6, 0x20, 0x12, 0xFE, 0x4B, 0x36, 0x7C, 0x91,
-    0xD5, 0xC4, 0xFD, 0xCE, 0x20, 0x17, 0xB6, 0x15, 0x02, 0x90, 0x14, 0xE6, 0xA0, 0x52, 0x4B, 0x85,
-    0x29, 0xE4, 0x87, 0xBB, 0x01, 0xB0, 0x60, 0x90, 0xCB, 0xD3, 0xF7, 0x52, 0xE7, 0x12, 0xE7, 0x1E,
-    0x3A, 0xD7, 0x22, 0xC4, 0x5B, 0x52, 0x5B, 0x23, 0xE9, 0xDD, 0x42, 0x82, 0x3C, 0xA0, 0x05, 0x08,
-    0x1E, 0x35, 0x08, 0xB5, 0x48, 0x5A, 0x32, 0x13, 0x03, 0x0B, 0x77, 0x33, 0x22, 0x8C, 0xB1, 0x35,
-    0x91, 0x87, 0x72, 0x04, 0x1A, 0x8C, 0x51, 0x9C, 0xBC, 0x8A, 0xE8, 0x74, 0x4D, 0x00, 0x7A, 0x24,
-    0xDD, 0xE1, 0xD6, 0x45, 0x57, 0x4A, 0xF2, 0x78, 0x2D, 0x81, 0xF7, 0xCD, 0x2D, 0xFC, 0x7B, 0x6E,
-    0xB6, 0x7E, 0x0C, 0x23, 0x5E, 0x41, 0x8C, 0xE3, 0x8D, 0xD8, 0x95, 0xF3, 0xDE, 0xB4, 0x2C, 0x2D,
-    0xCA, 0xE3, 0x71, 0xA3, 0x38, 0x5C, 0x63, 0xA3, 0x09, 0xC0, 0x23, 0x07, 0x7D, 0x74, 0x8E, 0x6D,
-    0xA0, 0x05, 0x49, 0x12, 0xD8, 0xC9, 0x3A, 0x49, 0x3E, 0x90, 0xF0, 0x97, 0x9D, 0x2C, 0x5F, 0x94,
-    0x2C, 0x6A, 0x92, 0x7A, 0x3F, 0x3C, 0xB9, 0xF1, 0x33, 0xAB, 0x58, 0x1C, 0xF5, 0x2D, 0x9B, 0x13,
-    0xBD, 0x52, 0x61, 0x7F, 0x7C, 0x3C, 0xFB, 0x36, 0xA5, 0x1B, 0x15, 0x0E, 0xC4, 0xD3, 0x03, 0x8F,
-    0xAE, 0xA0, 0xF5, 0x7C, 0x01, 0xC6, 0xCB, 0x83, 0x9C, 0xD1, 0x40, 0x20, 0x91, 0xC0, 0x13, 0xFC,
-    0x4B, 0xEB, 0xA7, 0xA4, 0x28, 0x33, 0x10, 0x38, 0x0D, 0x5F, 0x80, 0x3A, 0x33, 0x65, 0xC4, 0x2B,
-    0xE0, 0x86, 0x02, 0x9A, 0x1E, 0xE4, 0xDE, 0xE3, 0x04, 0xCB, 0x42, 0x7C, 0xF8, 0x25, 0xDF, 0x3F,
-    0xE1, 0x6E, 0xB0, 0x47, 0x3E, 0xE2, 0x70, 0x93, 0x5B, 0x6C, 0x09, 0x0D, 0x99, 0x61, 0x96, 0x4A,
-    0x5C, 0xF6, 0x0D, 0x07, 0x27, 0x3A, 0x1A, 0x1E, 0xAF, 0x9F, 0x78, 0x88, 0x39, 0xF7, 0xEF, 0x87,
-    0xA4, 0xC6, 0x5E, 0x71, 0xBB, 0xF0, 0x7E, 0xAC, 0x29, 0x05, 0xFC, 0x46, 0x75, 0x60, 0xA8, 0x49,
-    0xDD, 0x60, 0x91, 0xF7, 0x1A, 0xEA, 0x04, 0xFF, 0x47, 0x9A, 0xEF, 0xE0, 0xC4, 0xE0, 0x24, 0x85,
-    0xD3, 0xA0, 0x4D, 0x0F, 0x0D, 0xF7, 0xB0, 0x38, 0x85, 0x55, 0xE3, 0x1A, 0x3B, 0xAC, 0x81, 0x38,
-    0x9A, 0x3B, 0x81, 0xBB, 0xB3, 0xE6, 0x00, 0x8C, 0x8B, 0xBC, 0x56, 0x06, 0x3D, 0x76, 0xDE, 0xC7,
-    0xD6, 0x16, 0xBB, 0xDA, 0x32, 0x7B, 0x5C, 0xD5, 0x10, 0xBA, 0x94, 0x2B, 0x13, 0x71, 0x0D, 0xDF,
-    0x66, 0x8F, 0x5A, 0x59, 0x86, 0x3D, 0x80, 0x30, 0xC0, 0x89, 0x03, 0x60, 0x3F, 0x20, 0xDC, 0x06,
-    0x03, 0x8C, 0x98, 0x32, 0xEA, 0x92, 0x26, 0xED, 0x90, 0x8A, 0xDA, 0x80, 0xE0, 0xD9, 0x7A, 0xB9,
-    0xF6, 0xC1, 0x98, 0xE5, 0xBF, 0xBF, 0x3B, 0xA9, 0x99, 0x2B, 0xE8, 0x52, 0x61, 0x1B, 0xEC, 0x9F,
-    0xD5, 0xA6, 0x4B, 0x86, 0x60, 0xF7, 0x7C, 0x14, 0x7C, 0xE3, 0xF4, 0xBE, 0x1A, 0x7A, 0x8D, 0x1F,
-    0x50, 0xE5, 0x72, 0xFE, 0x44, 0xA8, 0xEC, 0x22, 0x7F, 0x47, 0x6A, 0xC3, 0x16, 0xA8, 0xB0, 0xE5,
-    0xC5, 0x37, 0x37, 0x4F, 0x48, 0x2F, 0x70, 0x0C, 0x8C, 0x34, 0x7A, 0x24, 0x06, 0xCC, 0x73, 0x05,
-    0x99, 0x97, 0xF2, 0x5B, 0x3E, 0xAE, 0x68, 0xD8, 0x9B, 0xEE, 0x23, 0xC2, 0xD1, 0xDD, 0xA5, 0xCF,
-    0x88, 0xE9, 0x8A, 0x8F, 0x2E, 0x6A, 0x24, 0x7F, 0xD5, 0xAD, 0x63, 0xF7, 0xF8, 0xEE, 0xD9, 0x79,
-    0x4F, 0x1F, 0xBA, 0x48, 0xB3, 0xEB, 0xF9, 0x53, 0x12, 0x86, 0x44, 0xC2, 0xD4, 0xC2, 0x73, 0xFC,
-    0x41, 0x52, 0xF0, 0x66, 0x46, 0xDB, 0xA7, 0x1D, 0x77, 0x2E, 0x71, 0x50, 0x8F, 0x74, 0xF9, 0x11,
-    0x74, 0xBF, 0x8B, 0x77, 0xB0, 0xE9, 0xD3, 0x67, 0xBA, 0x5C, 0x04, 0x66, 0x0A, 0xD7, 0x05, 0xEB,
-    0xBF, 0x18, 0xB0, 0xE5, 0x38, 0x73, 0x05, 0xFF, 0x8D, 0x9E, 0x3D, 0x48, 0xFD, 0x31, 0x63, 0x8B,
-    0xE1, 0x04, 0xF3, 0xE3, 0x36, 0xF0, 0x2D, 0x8C, 0x8F, 0xB5, 0x0F, 0x11, 0xDE, 0x8A, 0x7A, 0xFF,
-    0x66, 0x70, 0xCE, 0x4A, 0x04, 0x2C, 0x57, 0xD9, 0xD2, 0xDB, 0x83, 0x7F, 0xFE, 0x4A, 0xA9, 0xD1,
-    0x71, 0xEF, 0xCC, 0xD7, 0x20, 0xB9, 0x5C, 0xF7, 0xE9, 0xCA, 0xA3, 0xB4, 0x91, 0x45, 0xF2, 0x1F,
-    0xB8, 0x95, 0x5D, 0xBA, 0x2A, 0x97, 0xC4, 0xFC, 0x69, 0x94, 0x47, 0xB9, 0xF9, 0x17, 0x69, 0x82,
-    0x3A, 0xFA, 0x30, 0xBF, 0x2F, 0x6D, 0x30, 0xFC, 0xF7, 0x12, 0xB1, 0x71, 0x6C, 0x1D, 0x02, 0x32,
-    0x7B, 0xF8, 0xEB, 0xEF, 0xF7, 0x82, 0x52, 0x29, 0xA6, 0x62, 0x9E, 0xDD, 0x7A, 0xF8, 0x8F, 0x85,
-    0x08, 0x6D, 0x5D, 0x10, 0x35, 0x2C, 0x31, 0xC8, 0x88, 0x5B, 0x3F, 0xF0, 0xB2, 0xA5, 0x14, 0xC5,
-    0x32, 0xF6, 0x51, 0x7B, 0x61, 0x19, 0xC3, 0xEA, 0x63, 0x62, 0xE4, 0x7D, 0xCA, 0xFB, 0x32, 0x4C,
-    0xB8, 0x60, 0x88, 0x2D, 0xA1, 0x74, 0xD0, 0x23, 0xF2, 0xC1, 0x70, 0x80, 0x33, 0x88, 0x0E, 0x2B,
-    0x15, 0x93, 0x11, 0xD1, 0x03, 0x93, 0xB2, 0xD8, 0x62, 0x31, 0xD2, 0x27, 0x9F, 0xEC, 0xFE, 0xD9,
-    0x00, 0x4D, 0xA3, 0x01, 0xAA, 0x46, 0x23, 0x82, 0x3A, 0x9A, 0x4B, 0x3D, 0x46, 0x25, 0x8E, 0x1F,
-    0x60, 0x8B, 0xB0, 0x87, 0x7E, 0x51, 0x0B, 0xA9, 0x0D, 0x40, 0x8E, 0xA8, 0xE4, 0x46, 0xC1, 0x74,
-    0x4F, 0xC3, 0xAD, 0x21, 0x39, 0x35, 0x30, 0x77, 0xDA, 0xE0, 0x6C, 0x53, 0x66, 0xC4, 0x26, 0x2B,
-    0x46, 0x9C, 0x9F, 0xB4, 0xA0, 0xC8, 0x22, 0x5F, 0x02, 0x4F, 0x3C, 0xAD, 0x35, 0x73, 0xCD, 0xD6,
-    0xE1, 0xD7, 0xC9, 0x99, 0xB5, 0x83, 0x6A, 0x50, 0x55, 0xEB, 0xB9, 0xA4, 0x52, 0x2C, 0x28, 0xD8,
-    0x8C, 0x96, 0x48, 0xA3, 0x2F, 0xEA, 0xF8, 0x5B, 0xAB, 0x49, 0xFD, 0x6D, 0x69, 0x92, 0x58, 0x51,
-    0x55, 0xE9, 0x23, 0x65, 0x6D, 0x2C, 0xBD, 0x80, 0xB0, 0xFC, 0x9F, 0x9B, 0x35, 0x2B, 0xCB, 0x81,
-    0x02, 0x02, 0x5E, 0x96, 0xF0, 0xA3, 0xD2, 0x7A, 0xCC, 0x29, 0x34, 0xB7, 0x76, 0x15, 0x79, 0x34,
-    0x71, 0xC6, 0x2B, 0x65, 0x2C, 0xA1, 0xEA, 0x95, 0x35, 0x99, 0x0A, 0x67, 0x8F, 0x3C, 0x16, 0x58,
-    0x88, 0xFA, 0x80, 0xC4, 0x57, 0xA2, 0x28, 0x8E, 0x06, 0x62, 0xC5, 0xB2, 0xDE, 0x44, 0xF6, 0x68,
-    0xE7, 0x62, 0xD3, 0x74, 0x78, 0x2B, 0x98, 0xB8, 0xA0, 0x6A, 0xD2, 0x37, 0xFE, 0xDC, 0x8D, 0xA1,
-    0xD6, 0xA7, 0xAC, 0xFA, 0x48, 0x00, 0x38, 0xBE, 0xA0, 0x6A, 0xC6, 0x4D, 0xA7, 0xA7, 0xEB, 0x91,
-    0x7C, 0x09, 0xD1, 0xF2, 0x96, 0x96, 0x28, 0x8A, 0x5B, 0x4D, 0x81, 0x67, 0xBF, 0x28, 0x51, 0x0A,
-    0x92, 0xD4, 0xC8, 0xD7, 0x3A, 0x58, 0x41, 0xB0, 0x12, 0x0F, 0x5A, 0x45, 0xAA, 0x1C, 0xEF, 0xEE,
-    0xE6, 0x3C, 0x85, 0x09, 0x63, 0x54, 0x03, 0xF3, 0xF8, 0x5A, 0x36, 0x9E, 0x9C, 0xBC, 0xA3, 0xD6,
-    0x5F, 0xF7, 0xAB, 0xC3, 0x7E, 0xCE, 0x42, 0x7A, 0x56, 0xA5, 0x72, 0x29, 0x6D, 0x82, 0xC9, 0x4A,
-    0x1F, 0x10, 0xFA, 0x58, 0xAD, 0x3B, 0xCD, 0x66, 0xD7, 0x8C, 0x42, 0xEC, 0x45, 0xC3, 0x9C, 0xB6,
-    0x92, 0x39, 0xA4, 0x19, 0x38, 0x31, 0xF7, 0xCF, 0xA8, 0xA2, 0x3D, 0x41, 0x7B, 0x61, 0x4F, 0x3D,
-    0x98, 0xB6, 0xA7, 0x6E, 0xEC, 0x4F, 0x7D, 0x37, 0x79, 0x07, 0x06, 0xFF, 0xC0, 0x20, 0x2B, 0xDC,
-    0x9F, 0x74, 0xF2, 0xB4, 0xFB, 0x37, 0x3C, 0x31, 0x6F, 0x56, 0xAC, 0x04, 0x2C, 0x35, 0x4D, 0xDC,
-    0x2F, 0x0E, 0x87, 0x40, 0x0B, 0x66, 0x5A, 0x31, 0xF7, 0xCE, 0xB9, 0x72, 0x0E, 0x37, 0x56, 0xB5,
-    0x57, 0x1F, 0xC1, 0x11, 0xE0, 0x72, 0xB8, 0xC7, 0x28, 0x11, 0x58, 0x8A, 0x0E, 0x81, 0x91, 0xC0,
-    0xD1, 0xB0, 0x4C, 0x3C, 0x0B, 0xA7, 0xE3, 0x06, 0x8E, 0x83, 0xD4, 0x8E, 0x8A, 0xF8, 0x5A, 0x3C,
-    0xD5, 0xB6, 0xA3, 0xDA, 0xB8, 0xC9, 0x49, 0xFA, 0xF8, 0xDE, 0xE1, 0xC0, 0x4C, 0xA8, 0x1C, 0x89,
-    0x57, 0x21, 0x7B, 0x0C, 0x9B, 0xD6, 0x08, 0xFA, 0x70, 0xF2, 0xE4, 0x61, 0x1A, 0xDD, 0x1B, 0x27,
-    0x62, 0x5F, 0x78, 0x96, 0xD9, 0x9C, 0x7B, 0xFB, 0x1B, 0x3D, 0x6F, 0x74, 0x38, 0x35, 0x6D, 0x42,
-    0x24, 0xDC, 0x1A, 0xAB, 0x2B, 0xA5, 0x10, 0x12, 0x8A, 0xEA, 0x6F, 0x37, 0x46, 0xAE, 0x7C, 0x47,
-    0xA5, 0x74, 0xE4, 0x1F, 0x0F, 0x33, 0xB2, 0xD5, 0xF4, 0xC7, 0x1B, 0xC4, 0x8F, 0xBE, 0x18, 0xF9,
-    0x9C, 0x67, 0x8E, 0x67, 0xF7, 0x87, 0x73, 0x1D, 0x71, 0x81, 0xA4, 0x49, 0xF2, 0x48, 0x35, 0x92,
-    0x3A, 0x65, 0x14, 0x11, 0xA5, 0x0E, 0xF4, 0x50, 0x23, 0x8D, 0x0A, 0x65, 0xBA, 0x8C, 0xE9, 0x0F,
-    0xE1, 0x64, 0xDE, 0xC1, 0xB1, 0xE9, 0x7B, 0x78, 0x27, 0x7B, 0x85, 0xB5, 0xB2, 0x92, 0x1D, 0x5D,
-    0xA3, 0x1C, 0xC7, 0xF5, 0x01, 0x43, 0x23, 0xD2, 0xCE, 0x82, 0xF7, 0x92, 0x4F, 0xF1, 0xD4, 0xFC,
-    0x14, 0x01, 0x95, 0xBE, 0x83, 0x23, 0xB2, 0x1A, 0x8F, 0x6D, 0x59, 0x51, 0x61, 0xCB, 0x7C, 0x92,
-    0x79, 0x1E, 0x53, 0x8C, 0xAD, 0x3C, 0x3E, 0xCF, 0x7F, 0xAD, 0x9F, 0xF8, 0x7A, 0xEC, 0xD5, 0x31,
-    0x4F, 0x7E, 0x2D, 0x14, 0xF2, 0xEE, 0x15, 0xE0, 0x18, 0x30, 0xFE, 0x50, 0xA3, 0x77, 0x03, 0xE3,
-    0x46, 0x60, 0x4F, 0xA6, 0x0C, 0x7C, 0xC3, 0xC9, 0x66, 0x64, 0x56, 0x42, 0xAD, 0x44, 0x55, 0x91,
-    0xA3, 0x2C, 0xE1, 0x5F, 0x46, 0x8F, 0x80, 0xFD, 0x5E, 0x56, 0x2E, 0x2F, 0x10, 0xBA, 0x1F, 0xF4,
-    0xE6, 0x63, 0x84, 0x71, 0x75, 0x67, 0x74, 0x92, 0xBD, 0x37, 0x14, 0xAF, 0xB4, 0xD1, 0x50, 0x7C,
-    0xF0, 0x21, 0xDC, 0xF2, 0xD2, 0x34, 0xC2, 0x35, 0x9D, 0x75, 0x2F, 0x8D, 0x82, 0xF4, 0xD4, 0x55,
-    0xC8, 0x9A, 0x76, 0x34, 0x43, 0x30, 0x85, 0xAE, 0x44, 0x0F, 0xD3, 0x64, 0x5D, 0xD6, 0x45, 0x63,
-    0x00, 0xE2, 0xA2, 0xF3, 0x51, 0x08, 0x26, 0x73, 0x85, 0x36, 0x83, 0xFE, 0x1B, 0x74, 0x0B, 0x8C,
-    0x0A, 0x66, 0x80, 0x87, 0x21, 0x3F, 0xFA, 0x24, 0xE8, 0x86, 0x2B, 0xD0, 0x90, 0x4E, 0x74, 0x1C,
-    0x25, 0xAA, 0xC5, 0x16, 0xF4, 0x5D, 0x65, 0x73, 0xF8, 0x75, 0xB2, 0x25, 0x34, 0x5C, 0x67, 0x65,
-    0x05, 0xAF, 0xA5, 0x35, 0x56, 0x8C, 0xE9, 0x3B, 0xA3, 0xC4, 0x83, 0x01, 0xFC, 0x51, 0xD3, 0xFF,
-    0x14, 0xDB, 0x74, 0xC9, 0xCF, 0xC1, 0xD7, 0x5D, 0xFC, 0x59, 0x07, 0xC8, 0x45, 0x34, 0x71, 0x13,
-    0xC1, 0xDA, 0x45, 0xCD, 0x6B, 0x05, 0x6D, 0x09, 0xA6, 0x8B, 0xCE, 0x87, 0xAE, 0x56, 0x8C, 0xDF,
-    0x24, 0x47, 0xF4, 0x0C, 0x4E, 0xE4, 0x2A, 0xD4, 0x30, 0x8E, 0xA8, 0x22, 0x2A, 0x4C, 0x4B, 0xBB,
-    0x26, 0x2D, 0xE1, 0x82, 0x8A, 0x97, 0xAD, 0x2C, 0x4B, 0x17, 0x5C, 0xE9, 0x97, 0xB4, 0x64, 0xB4,
-    0xDB, 0x9C, 0x57, 0x38, 0x0F, 0x15, 0x11, 0xEA, 0x85, 0xF5, 0x6E, 0x35, 0xCE, 0x51, 0x41, 0xB6,
-    0x6E, 0x95, 0x41, 0x4B, 0xD2, 0xE6, 0x5A, 0x39, 0xEB, 0x2C, 0xAF, 0x47, 0x5A, 0x2B, 0x33, 0xEE,
-    0xCD, 0x8F, 0x6F, 0x40, 0x71, 0xD4, 0x3E, 0xAC, 0x88, 0x21, 0x07, 0x0B, 0xF8, 0x05, 0x8D, 0xB1,
-    0xCF, 0x5D, 0x75, 0xBD, 0xF6, 0xBD, 0xA4, 0x5E, 0x65, 0x0F, 0xC5, 0xB1, 0x62, 0x58, 0x99, 0x41,
-    0x43, 0x20, 0x25, 0xD0, 0xB3, 0x66, 0x93, 0xE0, 0x0A, 0xCD, 0x72, 0xE5, 0xB9, 0xB2, 0x25, 0xD0,
-    0xD0, 0x4F, 0x35, 0x2F, 0xBA, 0x92, 0xE2, 0x0E, 0xDC, 0x03, 0xD6, 0x06, 0x9F, 0xC1, 0xC2, 0x70,
-    0x44, 0xA1, 0x79, 0x9F, 0xB9, 0x5D, 0x7B, 0xD8, 0x60, 0x60, 0x3C, 0xF9, 0xF1, 0x81, 0xA6, 0x42,
-    0xCE, 0x10, 0x5A, 0x9A, 0x82, 0xE5, 0xB7, 0xA9, 0x11, 0x0D, 0x8D, 0x2D, 0x13, 0x66, 0x42, 0x55,
-    0x73, 0x4D, 0x1A, 0x83, 0xE2, 0x9A, 0xAB, 0xC4, 0x0B, 0x0E, 0xC6, 0x51, 0x22, 0x0D, 0xD5, 0xE0,
-    0xA2, 0x1D, 0xBF, 0x54, 0xCA, 0x62, 0x97, 0x01, 0x01, 0x2D, 0xBF, 0x0C, 0xEF, 0x56, 0xAC, 0x76,
-    0x99, 0x6A, 0x0D, 0x93, 0xC7, 0x11, 0x0A, 0x54, 0x14, 0xA6, 0x7B, 0xFC, 0xD5, 0xE1, 0xA3, 0xCA,
-    0xA3, 0xC7, 0xC8, 0x72, 0x86, 0x78, 0x2E, 0xC8, 0xE4, 0x4C, 0x09, 0xA6, 0x85, 0xE6, 0x4C, 0x30,
-    0x80, 0x91, 0xF5, 0xD5, 0x58, 0x91, 0x9B, 0x4E, 0x59, 0xC3, 0x74, 0x01, 0x81, 0x97, 0x8C, 0x20,
-    0x1D, 0xDB, 0x69, 0x92, 0x9C, 0xF2, 0x39, 0x3F, 0x56, 0x64, 0xEB, 0xEC, 0x44, 0x9E, 0xF1, 0xD6,
-    0xF4, 0x43, 0x0F, 0x4D, 0x04, 0x7E, 0x4E, 0x63, 0x94, 0x23, 0xAB, 0xB9, 0x80, 0xD0, 0xC6, 0x41,
-    0x7B, 0x02, 0x0D, 0x6E, 0x6D, 0xE5, 0x71, 0x3E, 0xE3, 0x0A, 0xA1, 0x8B, 0x58, 0x76, 0x24, 0x6E,
-    0xD7, 0xD0, 0x02, 0x43, 0xA8, 0xAC, 0x88, 0xD0, 0xC3, 0x61, 0xD5, 0x19, 0xD7, 0x12, 0x10, 0x23,
-    0xDF, 0x1A, 0xED, 0x34, 0x1D, 0x0E, 0xF3, 0x39, 0x83, 0xCC, 0xB9, 0x44, 0xFD, 0xA9, 0xE9, 0x28,
-    0x3E, 0xF5, 0xA7, 0x12, 0x17, 0x03, 0x5D, 0x99, 0x4B, 0x39, 0x4F, 0xB3, 0x86, 0xCF, 0xD6, 0x64,
-    0x8A, 0x40, 0x6B, 0xE2, 0xF5, 0x26, 0xC3, 0xFB, 0x34, 0xBF, 0x85, 0xA2, 0xF3, 0xEB, 0xC4, 0xB1,
-    0x25, 0x7B, 0x7A, 0xFE, 0xA5, 0x79, 0x08, 0xEC, 0x80, 0x69, 0x90, 0xDC, 0xCA, 0x1B, 0x1B, 0x6A,
-    0x2F, 0x78, 0x66, 0xA8, 0xD4, 0x8E, 0x1B, 0xC7, 0x67, 0x5C, 0xCF, 0x2A, 0x9F, 0xE6, 0xC5, 0x0D,
-    0x3C, 0xC6, 0x5F, 0xD3, 0xB3, 0xD3, 0xB2, 0xD3, 0xA1, 0xE6, 0x3A, 0xDF, 0x9C, 0xC0, 0x3A, 0xB1,
-    0x42, 0xDB, 0x9B, 0x48, 0x3E, 0x57, 0x02, 0x3E, 0x64, 0xD3, 0x8F, 0x30, 0xC5, 0x4E, 0xDA, 0xF6,
-    0x40, 0xA9, 0xA8, 0x8F, 0xB4, 0x3F, 0x00, 0x9E, 0xE9, 0x27, 0x7C, 0x1A, 0x66, 0x94, 0x90, 0xBE,
-    0x83, 0x74, 0x96, 0xBC, 0x88, 0xCC, 0x97, 0xF4, 0xC8, 0x7C, 0xE1, 0x9A, 0xF8, 0xAE, 0xBE, 0xD3,
-    0xD3, 0x82, 0x5A, 0x52, 0x13, 0x9B, 0x73, 0x7D, 0xA7, 0x66, 0xCD, 0xE9, 0x8A, 0xFA, 0xD4, 0x7D,
-    0xC7, 0xA9, 0xF7, 0xA2, 0x7E, 0x44, 0x83, 0x7E, 0xC4, 0x9D, 0x7E, 0x98, 0x56, 0x3F, 0xD2, 0x7A,
-    0x4E, 0x3C, 0x59, 0x1D, 0x13, 0xF0, 0xA8, 0xF6, 0x47, 0xAD, 0xF3, 0xED, 0x08, 0x11, 0xB2, 0xD2,
-    0xAD, 0xA1, 0xBD, 0xBD, 0xB3, 0xE6, 0x14, 0xCE, 0xBE, 0x3E, 0x3A, 0xD2, 0xD0, 0x77, 0x3A, 0x07,
-    0x1F, 0xD8, 0xAA, 0xA9, 0xD8, 0xE6, 0xB8, 0xBA, 0x62, 0x02, 0x74, 0x52, 0x41, 0x18, 0x8B, 0xF6,
-    0x8B, 0x09, 0x73, 0xD0, 0xDA, 0x1B, 0x40, 0x23, 0xD6, 0xC0, 0xAF, 0xB6, 0x39, 0x8B, 0xF3, 0x8E,
-    0xCD, 0x18, 0xFC, 0xCC, 0x36, 0x72, 0xD4, 0x82, 0x7A, 0xAD, 0xBC, 0x7E, 0xAC, 0xC0, 0xB3, 0xBE,
-    0x30, 0x78, 0x5D, 0x4B, 0x93, 0x47, 0x2A, 0xA9, 0xA6, 0x01, 0x1D, 0x1B, 0xCD, 0xBD, 0x74, 0xEA,
-    0x2B, 0x38, 0x1D, 0xC7, 0xA9, 0xF6, 0xF1, 0xA0, 0xEA, 0x77, 0x0C, 0xF0, 0xA2, 0x46, 0xAC, 0x03,
-    0xEC, 0x38, 0x12, 0x44, 0x8A, 0x02, 0x1D, 0x54, 0x86, 0xBF, 0x10, 0xC2, 0x30, 0x2C, 0x24, 0xF9,
-    0x11, 0x8E, 0x1E, 0x40, 0x52, 0x85, 0x3A, 0x35, 0xAD, 0xA1, 0xE0, 0x5A, 0xCD, 0x4E, 0x5A, 0x85,
-    0xF3, 0xE3, 0x4F, 0xA8, 0x08, 0xDC, 0xA7, 0x99, 0xCA, 0x8E, 0xBE, 0xD1, 0xD2, 0xCA, 0x23, 0xDC,
-    0x14, 0x2D, 0x2A, 0x07, 0xEF, 0x66, 0x9A, 0xCC, 0x28, 0x8D, 0xC6, 0xB3, 0xCE, 0x1F, 0xFD, 0x38,
-    0xB1, 0x54, 0x0E, 0x80, 0x28, 0xF7, 0xEE, 0x55, 0x5A, 0xD9, 0x64, 0x7A, 0xD5, 0xE0, 0xF3, 0x41,
-    0xC3, 0x86, 0x90, 0x4B, 0x74, 0xB2, 0xA9, 0x45, 0xAA, 0xBF, 0x6A, 0xBF, 0x3E, 0xFB, 0x51, 0xBB,
-    0x6F, 0xEC, 0xE4, 0xAF, 0x3A, 0xE7, 0x9C, 0xAF, 0x0C, 0x2C, 0x3F, 0x0B, 0x64, 0x55, 0x03, 0x51,
-    0x9D, 0x82, 0x50, 0x3B, 0x32, 0x14, 0x66, 0xD9, 0xC4, 0x2D, 0x1A, 0xDF, 0xF8, 0xB2, 0xBD, 0x90,
-    0x4D, 0x0B, 0x1F, 0x76, 0xE7, 0xCB, 0xB5, 0xD5, 0x06, 0x2C, 0xC3, 0x3C, 0x41, 0xD1, 0xB8, 0x63,
-    0xFF, 0xA1, 0xE3, 0xD1, 0xE5, 0xBC, 0x48, 0x47, 0x0E, 0xD9, 0x26, 0x2C, 0x9F, 0xD8, 0x33, 0xFD,
-    0x3F, 0xF6, 0x84, 0xBC, 0xDE, 0x92, 0xF4, 0xD4, 0x33, 0x7F, 0xF4, 0xB7, 0xF7, 0xEF, 0xDF, 0x7F,
-    0xF0, 0xE0, 0xE8, 0xE8, 0x68, 0x8F, 0x7F, 0xF6, 0xF7, 0x0F, 0x16, 0xDB, 0x5F, 0xFB, 0x3D, 0x25,
-    0x3F, 0x15, 0x37, 0x9B, 0x36, 0x13, 0x1B, 0x1D, 0xE7, 0x0C, 0x9B, 0xAD, 0xF6, 0x37, 0x9B, 0xDB,
-    0x0D, 0x4B, 0xE8, 0xA0, 0x67, 0xDC, 0x48, 0xB2, 0xD8, 0xC8, 0x46, 0x21, 0xFD, 0x80, 0xA4, 0x9E,
-    0xE5, 0x57, 0x45, 0x16, 0xFF, 0x8F, 0x6D, 0x83, 0xF3, 0xDB, 0x26, 0xB4, 0xBF, 0x55, 0x2B, 0x76,
-    0x51, 0x09, 0x6C, 0x9A, 0xA3, 0xA8, 0xE9, 0xEE, 0x07, 0xCD, 0x16, 0xAA, 0xE3, 0x50, 0xB9, 0xCB,
-    0xCD, 0x41, 0xBE, 0x83, 0x6D, 0x56, 0xF2, 0xAA, 0x9F, 0x94, 0x4D, 0xD7, 0x34, 0x38, 0x0F, 0x80,
-    0x95, 0x1E, 0x4D, 0x79, 0xA3, 0x4D, 0x79, 0x6F, 0xD0, 0xF6, 0x1B, 0x08, 0x78, 0x15, 0x7C, 0x93,
-    0x89, 0x6D, 0x59, 0xAD, 0x83, 0x05, 0x1B, 0xE3, 0x3E, 0x45, 0x0A, 0x7E, 0xBD, 0xD6, 0x56, 0x8D,
-    0xA3, 0xC5, 0xB3, 0x02, 0x87, 0xF2, 0x1D, 0x78, 0x5D, 0x93, 0x77, 0x4F, 0x10, 0x6F, 0x6B, 0x71,
-    0x3F, 0x5B, 0x01, 0xD3, 0x47, 0x59, 0x1D, 0x74, 0x93, 0xC4, 0x60, 0x93, 0x0C, 0x2F, 0x0D, 0x07,
-    0x78, 0x0E, 0x02, 0x49, 0xA6, 0xAA, 0xCB, 0xB4, 0x21, 0x42, 0xFD, 0x02, 0x08, 0x6F, 0x9D, 0xB6,
-    0x43, 0x6D, 0xE8, 0x86, 0x68, 0x7D, 0x81, 0xD9, 0x6B, 0xD8, 0xCC, 0x2D, 0x4C, 0xAE, 0xC3, 0xA7,
-    0x41, 0x1B, 0x52, 0x83, 0xB6, 0x57, 0x93, 0xD6, 0x86, 0xB3, 0xB6, 0x4F, 0x47, 0x65, 0xFD, 0x66,
-    0xBE, 0xA7, 0xC6, 0xA3, 0xA9, 0x5E, 0x8D, 0xD0, 0xC1, 0x38, 0xB4, 0x88, 0xA9, 0x7B, 0x04, 0xBB,
-    0x84, 0x8E, 0x76, 0x73, 0xDC, 0x6D, 0xE2, 0xD8, 0x6D, 0x8D, 0xAD, 0x19, 0x59, 0x39, 0x8E, 0x4B,
-    0xF3, 0x18, 0xC1, 0xD7, 0x30, 0x08, 0x35, 0x41, 0x39, 0x9F, 0xAA, 0xB0, 0x49, 0xF5, 0xA3, 0x53,
-    0x46, 0x40, 0xD0, 0x26, 0x28, 0x4E, 0x6C, 0x7E, 0x1D, 0x69, 0xEE, 0x5A, 0xD8, 0xCA, 0x5E, 0xF4,
-    0x0B, 0x37, 0x22, 0x78, 0x46, 0xF3, 0x46, 0xAE, 0xD3, 0x28, 0xBA, 0x8C, 0x6C, 0x65, 0x4E, 0xBE,
-    0xC9, 0xB4, 0x52, 0x6B, 0x16, 0xBA, 0x79, 0xE2, 0xC9, 0x1F, 0x5F, 0xBD, 0x52, 0x7E, 0xAA, 0x59,
-    0x20, 0x97, 0x6B, 0xFF, 0xC8, 0x69, 0x8F, 0x1F, 0xCE, 0x44, 0xAD, 0x7A, 0x76, 0xB5, 0x29, 0xF1,
-    0x41, 0xE3, 0x51, 0x3F, 0xE7, 0x9C, 0x2A, 0x2C, 0x41, 0x5C, 0x4B, 0xC9, 0xDE, 0x76, 0x65, 0x5C,
-    0x83, 0x27, 0xA8, 0xCA, 0x55, 0x56, 0x3A, 0xD4, 0x64, 0x1B, 0xC7, 0x46, 0x25, 0x08, 0x7A, 0x2F,
-    0xD0, 0x8E, 0xA1, 0xD3, 0x81, 0x97, 0x0E, 0x53, 0xE2, 0x93, 0xE5, 0x8C, 0x7D, 0xB8, 0xED, 0xCB,
-    0xB1, 0xC6, 0x62, 0xAD, 0xB6, 0xBF, 0xC8, 0x28, 0x44, 0xD2, 0x99, 0xA7, 0x9D, 0xD1, 0x3C, 0x74,
-    0xE1, 0xBC, 0xCE, 0xCC, 0x23, 0x4E, 0x0E, 0xA2, 0xB6, 0xBF, 0x92, 0xCB, 0xB1, 0x86, 0xED, 0xC0,
-    0x19, 0x14, 0xE0, 0xB2, 0x07, 0xAF, 0xDF, 0x06, 0x1F, 0x1E, 0x25, 0x04, 0x4C, 0x2D, 0x5D, 0x5A,
-    0x86, 0x5D, 0x96, 0x47, 0x2D, 0xFA, 0x8F, 0x16, 0x79, 0xBD, 0xA9, 0x28, 0xBD, 0xA9, 0x75, 0xCA,
-    0x12, 0x9F, 0xFF, 0x5F, 0x88, 0x07, 0xDC, 0xB9, 0x83, 0xDC, 0x61, 0x03, 0x99, 0xE1, 0x04, 0xD6,
-    0x0B, 0x01, 0xE0, 0x41, 0x20, 0x1D, 0xE8, 0x8C, 0xCC, 0x23, 0xBC, 0xF0, 0xDD, 0x52, 0x30, 0x3D,
-    0x39, 0xED, 0xE4, 0x1C, 0x91, 0x73, 0x69, 0x1D, 0xAA, 0x7D, 0x4E, 0xDE, 0xAB, 0x1B, 0x79, 0xE7,
-    0x51, 0xED, 0x66, 0x22, 0x37, 0x2F, 0x89, 0xFD, 0x68, 0xE3, 0x22, 0x67, 0x51, 0xEC, 0x8C, 0x36,
-    0x73, 0x40, 0x6C, 0x41, 0xBB, 0x9F, 0x0E, 0x37, 0x8D, 0x1F, 0x6E, 0xB6, 0x2B, 0xE9, 0x57, 0xB2,
-    0x5C, 0xC9, 0x62, 0x45, 0x3E, 0x8E, 0xD7, 0xCA, 0x73, 0x9F, 0x0D, 0xB2, 0x5F, 0xE5, 0x16, 0x6D,
-    0xEF, 0xBB, 0x2E, 0x6E, 0xED, 0x87, 0xBD, 0x4E, 0x72, 0xB0, 0x72, 0xA3, 0x85, 0x96, 0x3E, 0x25,
-    0x9C, 0x93, 0x72, 0xD7, 0x1D, 0x9E, 0x3A, 0xFA, 0x12, 0x51, 0x55, 0xB4, 0x6F, 0xC5, 0x2E, 0x47,
-    0xF5, 0x21, 0x2F, 0x64, 0x6D, 0x82, 0x4A, 0xB3, 0x70, 0x60, 0xC9, 0x78, 0xBA, 0xF1, 0x5F, 0x1F,
-    0xB7, 0x48, 0xAD, 0x2E, 0xBF, 0x4D, 0x93, 0xE5, 0x57, 0x01, 0x01, 0x54, 0x69, 0xE8, 0xB5, 0xE3,
-    0x26, 0x6A, 0x74, 0x84, 0x81, 0x3E, 0x1B, 0x7B, 0x2C, 0xF1, 0x6D, 0x29, 0x16, 0x80, 0x5D, 0xC0,
-    0xA3, 0x48, 0x1A, 0x39, 0x1B, 0x1A, 0x4E, 0x74, 0xF9, 0x8D, 0x09, 0xE9, 0xD6, 0x61, 0xA9, 0x1D,
-    0xB3, 0xFB, 0x6E, 0x8F, 0x9F, 0x43, 0xC8, 0xC8, 0xEE, 0xA4, 0x8F, 0x9B, 0xA0, 0x4F, 0xEA, 0xB0,
-    0xE3, 0xAB, 0x69, 0x1D, 0xB7, 0x59, 0xC9, 0xC4, 0x6E, 0x74, 0x71, 0x45, 0xB3, 0x84, 0x15, 0x07,
-    0xA8, 0xA8, 0xC5, 0x3F, 0xB9, 0x51, 0xE3, 0xE5, 0x8E, 0xC2, 0x43, 0x23, 0x93, 0xA3, 0xD6, 0xAC,
-    0x77, 0x20, 0x7A, 0x0A, 0x68, 0xC6, 0xAC, 0xD4, 0xDC, 0xA3, 0xB5, 0x4E, 0x2F, 0x23, 0xE6, 0xF4,
-    0x4C, 0xAD, 0x98, 0xFF, 0x13, 0x2A, 0xB4, 0x9F, 0xEB, 0x20, 0xE1, 0x87, 0x3D, 0xAB, 0xE9, 0xDB,
-    0xC4, 0xED, 0x6D, 0xA6, 0xCC, 0xDB, 0xF4, 0xE9, 0x11, 0xE1, 0xD0, 0x13, 0x10, 0x5A, 0xDA, 0xB3,
-    0x16, 0xB9, 0x49, 0x08, 0xC2, 0x15, 0x13, 0x76, 0x09, 0xFA, 0x8A, 0x8D, 0xEF, 0x96, 0x1F, 0x5A,
-    0x79, 0xBA, 0xD3, 0x9C, 0xAF, 0xA3, 0x0E, 0x7B, 0xCE, 0xFD, 0x17, 0x38, 0x82, 0xEB, 0x11, 0x04,
-    0x8F, 0x3E, 0x28, 0x39, 0x31, 0x0C, 0x59, 0x81, 0xEC, 0x00, 0x70, 0x09, 0xB1, 0x06, 0x1B, 0x97,
-    0x86, 0x33, 0x8B, 0x0E, 0xE1, 0x96, 0xB2, 0xE6, 0x99, 0x0E, 0xD7, 0x8C, 0x65, 0xD4, 0x00, 0xEE,
-    0x08, 0x21, 0xF4, 0xED, 0x7C, 0xA6, 0x88, 0xF4, 0x6F, 0xE6, 0xB4, 0xC5, 0x46, 0x31, 0xD9, 0x94,
-    0xF6, 0xDB, 0x5F, 0x95, 0xB4, 0xAA, 0x13, 0xB0, 0xE8, 0x5A, 0xBB, 0x7E, 0x1F, 0x87, 0xA9, 0x1F,
-    0x9A, 0x6A, 0x69, 0xC5, 0xF2, 0x4D, 0x3B, 0x62, 0x4D, 0x7E, 0x6F, 0x72, 0x22, 0x49, 0xC8, 0x6E,
-    0xFB, 0x6D, 0x59, 0x94, 0x9E, 0x8E, 0xB1, 0xC9, 0x8F, 0x07, 0x72, 0xF0, 0x76, 0x4F, 0x1E, 0x28,
-    0xA0, 0xE5, 0xCD, 0x99, 0xB3, 0xAE, 0x11, 0x18, 0x20, 0x8A, 0xA5, 0xFC, 0xF5, 0xE3, 0xBF, 0x83,
-    0x09, 0x96, 0xC4, 0x85, 0xFE, 0xD6, 0x71, 0x15, 0x4E, 0x65, 0x2D, 0xFD, 0x63, 0x04, 0x7B, 0xE4,
-    0xB0, 0xB8, 0x61, 0x5C, 0x0E, 0x40, 0x53, 0x03, 0xB5, 0xB1, 0x72, 0x44, 0x7D, 0xDD, 0xEE, 0x49,
-    0xFA, 0xC7, 0x40, 0x02, 0x27, 0x5C, 0x0B, 0x9C, 0x84, 0x5A, 0x19, 0x41, 0xDD, 0x53, 0x53, 0x4B,
-    0x5E, 0x5D, 0x0F, 0x72, 0x19, 0x27, 0x3D, 0x2F, 0xF2, 0x07, 0x08, 0x88, 0xE5, 0x02, 0xE8, 0x26,
-    0x34, 0x39, 0xC2, 0x45, 0xEF, 0x03, 0x03, 0x03, 0xA3, 0xF5, 0x80, 0x02, 0x03, 0x5D, 0xC4, 0xC7,
-    0xB5, 0xCA, 0x1C, 0x3B, 0xDF, 0xE4, 0x25, 0x50, 0xF2, 0x0F, 0xB1, 0xF6, 0x1F, 0x2D, 0xDB, 0x88,
-    0x05, 0x09, 0x9E, 0x83, 0xBE, 0x66, 0x21, 0xAD, 0xA9, 0x17, 0x51, 0x9F, 0xE6, 0x07, 0x66, 0xB0,
-    0x72, 0x60, 0xC7, 0x95, 0x1C, 0xB8, 0x69, 0xF4, 0xE3, 0x9D, 0x62, 0x0D, 0xE7, 0x17, 0x9D, 0x76,
-    0x6B, 0x00, 0x52, 0xA1, 0xE1, 0x6B, 0x00, 0x24, 0x19, 0x81, 0xDA, 0xB8, 0x45, 0xF2, 0xB2, 0x19,
-    0x0D, 0xC3, 0x19, 0x78, 0x3F, 0x0F, 0x42, 0x58, 0x60, 0xB0, 0x46, 0x88, 0x7E, 0x0D, 0xBB, 0xAD,
-    0x39, 0x10, 0xC9, 0x39, 0x3B, 0x48, 0x3A, 0x50, 0x31, 0xCA, 0xDE, 0x1D, 0x12, 0xF9, 0x40, 0x7A,
-    0x26, 0xE6, 0x63, 0x3F, 0x64, 0xB3, 0xAC, 0xBB, 0x48, 0x91, 0x1C, 0x3B, 0x0D, 0xCC, 0x3F, 0xBF,
-    0x9A, 0x77, 0xF1, 0xE3, 0xD3, 0x82, 0x03, 0x1B, 0x56, 0x39, 0x71, 0xBF, 0x99, 0xDA, 0x8C, 0xF3,
-    0x94, 0xD6, 0xB7, 0x8C, 0x4C, 0xDC, 0xFD, 0x59, 0xAD, 0xAB, 0x53, 0x28, 0x57, 0x07, 0xBB, 0x37,
-    0x5A, 0x5F, 0xBE, 0xA7, 0x8D, 0xC7, 0x5E, 0xB6, 0x19, 0x82, 0xE6, 0xFA, 0xDF, 0x03, 0x5A, 0xB7,
-    0xCF, 0xFF, 0x21, 0x91, 0x67, 0x7E, 0x38, 0xF9, 0xEC, 0x9B, 0x5A, 0xF4, 0x00, 0xA4, 0xE1, 0xDC,
-    0xC4, 0x2F, 0xE4, 0xF4, 0xEB, 0x81, 0xA6, 0x46, 0xF0, 0xA5, 0xF6, 0x03, 0x14, 0x84, 0xB9, 0x61,
-    0xC7, 0xA7, 0xEE, 0xF9, 0x5D, 0x7E, 0xD5, 0x79, 0x2A, 0x82, 0x88, 0x95, 0x57, 0x55, 0x9F, 0x0A,
-    0xB6, 0xCD, 0xFF, 0x28, 0xBC, 0x45, 0x5A, 0x6B, 0xE5, 0x39, 0x09, 0x6B, 0x92, 0x65, 0x2E, 0xF7,
-    0x37, 0x37, 0x00, 0x89, 0xEB, 0x9B, 0x1B, 0x41, 0x43, 0x48, 0x71, 0x1C, 0xF2, 0x03, 0x5F, 0xAE,
-    0xCD, 0x02, 0x65, 0x3E, 0x39, 0x1F, 0xF8, 0x33, 0x46, 0x7F, 0x2A, 0x3B, 0xDA, 0x51, 0x33, 0x99,
-    0xF5, 0xE5, 0xC6, 0xA8, 0x75, 0x04, 0xDF, 0xB7, 0x1A, 0x7E, 0xCF, 0x8E, 0x0A, 0x85, 0x19, 0xAB,
-    0xA6, 0xFC, 0xFB, 0xFF, 0xFC, 0xD2, 0xAD, 0x7F, 0x7E, 0x1F, 0xC8, 0xDE, 0x92, 0xDF, 0x00, 0xCD,
-    0x5A, 0x4D, 0x8C, 0x1C, 0xD7, 0x71, 0xAE, 0xEE, 0x26, 0xD9, 0x10, 0x9F, 0xC5, 0xF6, 0x81, 0x46,
-    0x14, 0x91, 0x54, 0xFB, 0xE0, 0x83, 0x91, 0x50, 0x6C, 0x22, 0xE0, 0x61, 0x03, 0xEC, 0x4E, 0x37,
-    0x29, 0x04, 0x06, 0x92, 0x43, 0x78, 0xE0, 0xC8, 0x07, 0x1D, 0x94, 0xB3, 0x83, 0x98, 0x3E, 0x30,
-    0x00, 0x0F, 0xBB, 0x9C, 0x16, 0x7D, 0xC8, 0x31, 0x04, 0x12, 0x9D, 0xCD, 0x83, 0x0F, 0x0E, 0x19,
-    0xC0, 0x3C, 0x2C, 0x10, 0x22, 0x59, 0x6E, 0x3F, 0x3A, 0x01, 0x74, 0xC8, 0x21, 0x6D, 0x5B, 0x82,
-    0x0F, 0x49, 0xC0, 0x96, 0x23, 0x21, 0x30, 0x15, 0x44, 0x9D, 0xA4, 0x85, 0xF4, 0x86, 0x33, 0xF3,
-    0xF2, 0x7D, 0xF5, 0x7A, 0x66, 0x67, 0xF9, 0x27, 0x47, 0x50, 0x0C, 0xF5, 0xEE, 0xF4, 0xCE, 0xF6,
-    0x74, 0xBF, 0x57, 0xF5, 0x55, 0xD5, 0x57, 0xF5, 0xEA, 0x8D, 0x38, 0x9B, 0xF4, 0xE2, 0x24, 0x69,
-    0x65, 0x26, 0x7A, 0x24, 0x36, 0x98, 0x4A, 0x56, 0x86, 0x9D, 0xE4, 0x12, 0xB5, 0x72, 0x4D, 0xE2,
-    0x5A, 0x76, 0x70, 0x55, 0x7A, 0x49, 0x8A, 0xA0, 0x95, 0x4C, 0xA2, 0x46, 0x36, 0x24, 0xB2, 0xF2,
-    0x12, 0x6F, 0x3F, 0x22, 0x7C, 0x2B, 0x8D, 0xC8, 0x15, 0x91, 0xD3, 0x12, 0x54, 0x4D, 0xE8, 0xFA,
-    0xE8, 0x91, 0x0D, 0xBB, 0x56, 0xFA, 0x35, 0xD9, 0x3C, 0x2D, 0xA3, 0x44, 0x92, 0xD7, 0xCA, 0xF8,
-    0xC7, 0x75, 0xD0, 0xB7, 0x32, 0xB9, 0x2B, 0x89, 0x6B, 0x03, 0xE7, 0xC4, 0xB8, 0x92, 0x4F, 0xDD,
-    0x11, 0x39, 0x2E, 0x07, 0x8E, 0xCB, 0x1F, 0x88, 0xA4, 0xAE, 0x97, 0x68, 0x7E, 0xBE, 0x93, 0xD4,
-    0x4A, 0x89, 0xE9, 0x45, 0xC2, 0x1A, 0x27, 0x53, 0xE0, 0xF4, 0x2A, 0x6F, 0xBA, 0x8B, 0x57, 0x80,
-    0xC7, 0x25, 0x2E, 0x71, 0x4A, 0x29, 0xB7, 0x73, 0x56, 0x26, 0x6E, 0x2E, 0xF2, 0xC6, 0x7B, 0x17,
-    0x05, 0xC2, 0xE3, 0x99, 0x1E, 0xA7, 0x1C, 0xD2, 0xA5, 0x78, 0x13, 0xB8, 0x5B, 0x7F, 0x8E, 0x49,
-    0x9D, 0x2B, 0x72, 0x9C, 0x74, 0xA6, 0xC0, 0x86, 0x36, 0x73, 0x55, 0x31, 0xC1, 0x6C, 0xBD, 0x29,
-    0x8D, 0x4D, 0xA1, 0xD8, 0x4E, 0xD0, 0x46, 0x4D, 0xDC, 0x4C, 0x24, 0x73, 0xD3, 0xC8, 0xB9, 0x3E,
-    0xFD, 0xDE, 0x47, 0xCD, 0xD7, 0xE4, 0x45, 0x2F, 0x1B, 0xC6, 0xE9, 0x02, 0x48, 0x55, 0x46, 0x6D,
-    0xD0, 0x4B, 0xDC, 0x64, 0xA5, 0x24, 0x3F, 0xED, 0x29, 0x2F, 0xC4, 0xC8, 0x39, 0x5D, 0x85, 0x37,
-    0xE1, 0x54, 0x38, 0x53, 0x29, 0x39, 0xC5, 0x01, 0x9C, 0x90, 0x8E, 0xB2, 0x52, 0xA6, 0xC0, 0xB5,
-    0x12, 0x51, 0xD4, 0xAC, 0xA2, 0x32, 0xFC, 0x2C, 0x6E, 0xF9, 0x59, 0xB9, 0x02, 0xC1, 0xBA, 0x44,
-    0x25, 0xF0, 0x4C, 0x88, 0xEB, 0x29, 0x09, 0xAD, 0x7C, 0x79, 0xF9, 0x51, 0x81, 0x0B, 0x00, 0x7C,
-    0x4D, 0xE2, 0x02, 0xD8, 0x25, 0x12, 0xD4, 0x40, 0x9D, 0x16, 0xF0, 0x53, 0x67, 0xB7, 0x2D, 0x2E,
-    0x85, 0xA5, 0x1C, 0xE3, 0x95, 0x73, 0x9C, 0xB0, 0xC3, 0x69, 0xE2, 0x6E, 0x48, 0xEC, 0x5C, 0x23,
-    0xA3, 0xE2, 0x44, 0x1D, 0x36, 0xB0, 0x24, 0xC6, 0xDE, 0x90, 0x91, 0xC0, 0xA0, 0xD5, 0x27, 0x97,
-    0x4B, 0xA9, 0x1C, 0x24, 0x89, 0x21, 0x96, 0x44, 0xD4, 0x02, 0xEE, 0xF0, 0xEB, 0x63, 0x57, 0xC0,
-    0x4E, 0x3D, 0x74, 0x83, 0x26, 0x19, 0x06, 0x58, 0x1E, 0x89, 0x1D, 0x65, 0xE5, 0x6E, 0x5E, 0xCE,
-    0x26, 0x17, 0x66, 0xF2, 0xB2, 0x1C, 0xBD, 0x50, 0xDC, 0x0E, 0x63, 0x7B, 0xF8, 0xB7, 0xE5, 0xF8,
-    0x1D, 0xB9, 0x5E, 0x87, 0x2F, 0x74, 0x67, 0x5F, 0x32, 0x72, 0x42, 0x1F, 0xB8, 0x56, 0x5E, 0x69,
-    0xCF, 0x9E, 0x7C, 0xE9, 0xE8, 0x0B, 0xD1, 0x77, 0x5F, 0xAB, 0x5D, 0x97, 0xFC, 0x93, 0xAA, 0x50,
-    0x04, 0x75, 0x50, 0x47, 0x4D, 0xD8, 0xC6, 0x75, 0xDC, 0x18, 0x6B, 0x6C, 0x52, 0x9A, 0x32, 0xEA,
-    0xE0, 0x6E, 0x13, 0xA9, 0xC4, 0xB4, 0x40, 0x6B, 0x8A, 0x9F, 0x17, 0xA1, 0x6B, 0x80, 0x9F, 0xFC,
-    0x2F, 0x2E, 0xC2, 0xBA, 0xF7, 0xC7, 0x7F, 0x08, 0x10, 0xA1, 0xCD, 0x26, 0xD4, 0xA4, 0x10, 0x18,
-    0xEA, 0xE5, 0x5B, 0xB7, 0xF0, 0xC9, 0x3B, 0x0E, 0xA0, 0xBE, 0x2C, 0xE6, 0x42, 0xF1, 0xD7, 0xE1,
-    0x91, 0xEB, 0x87, 0x7F, 0xEB, 0xCB, 0xC7, 0xBF, 0x57, 0xFE, 0xE8, 0xCF, 0x62, 0x73, 0xF2, 0xEC,
-    0x49, 0x95, 0x23, 0x18, 0x7F, 0x97, 0xEA, 0xE9, 0x61, 0xA8, 0x90, 0x4D, 0xCB, 0x2E, 0x29, 0x52,
-    0x63, 0xE3, 0xBF, 0x6D, 0xC2, 0xA6, 0x0F, 0xBA, 0xFC, 0xC2, 0xD4, 0xE0, 0x16, 0x68, 0x7B, 0xE4,
-    0xFB, 0xB8, 0xE9, 0x30, 0x95, 0xC4, 0xEB, 0x8C, 0xDA, 0x42, 0xC6, 0xF7, 0x2E, 0x85, 0x8E, 0x23,
-    0xD0, 0x50, 0x78, 0x01, 0xC0, 0x01, 0x72, 0x7F, 0x8C, 0xBF, 0x45, 0x90, 0xE4, 0x2B, 0x30, 0x68,
-    0x30, 0x93, 0xF3, 0x56, 0xBE, 0x03, 0xFB, 0xAC, 0x43, 0xCE, 0x5E, 0xAA, 0xE6, 0x37, 0xBE, 0x4F,
-    0x48, 0x0F, 0xE3, 0xE7, 0x24, 0xF4, 0x5B, 0x93, 0xAF, 0xCB, 0x95, 0x49, 0xFB, 0xED, 0x42, 0x9A,
-    0x75, 0x73, 0xBE, 0x59, 0xE7, 0x3C, 0x51, 0x03, 0x2B, 0x6C, 0x40, 0x27, 0x63, 0x23, 0x2A, 0xBE,
-    0x21, 0x80, 0xC3, 0xC2, 0x6E, 0x88, 0x43, 0x04, 0x40, 0xD4, 0xE2, 0xF9, 0x5D, 0xF8, 0x71, 0xD6,
-    0xC0, 0xA9, 0x66, 0x02, 0xEF, 0xB5, 0xA7, 0x20, 0x4E, 0xF8, 0x8E, 0x7B, 0x50, 0xAE, 0x1D, 0x2E,
-    0xE8, 0x09, 0x22, 0x7F, 0xB0, 0x12, 0x40, 0xE7, 0x6B, 0x71, 0xF6, 0x8E, 0x54, 0xED, 0xBA, 0xE4,
-    0xDD, 0x31, 0xC9, 0xA6, 0x71, 0x61, 0x5C, 0x68, 0x43, 0x57, 0xB4, 0x18, 0x06, 0xAE, 0xD3, 0xC2,
-    0xA9, 0x3A, 0x03, 0xEF, 0x83, 0x16, 0x15, 0x7C, 0x2C, 0x2F, 0xAE, 0x48, 0x66, 0x5F, 0x85, 0xD9,
-    0x13, 0x89, 0xBB, 0xC8, 0x46, 0xD3, 0xA0, 0x09, 0xE6, 0xB2, 0x2D, 0xAE, 0x58, 0x97, 0x89, 0x25,
-    0x14, 0xB2, 0x95, 0xFC, 0x78, 0x9A, 0xDB, 0x50, 0xBE, 0x1A, 0x7C, 0x20, 0x5F, 0x93, 0x1B, 0x6F,
-    0x1A, 0x7A, 0xF4, 0x86, 0xD8, 0x93, 0x61, 0x79, 0x2E, 0x96, 0x3B, 0xD5, 0xC3, 0x1F, 0x04, 0xD3,
-    0xF0, 0x27, 0xD6, 0x9E, 0xBD, 0xF9, 0xA5, 0x73, 0xF1, 0xB1, 0xF8, 0x82, 0x2B, 0xB3, 0xA2, 0x50,
-    0x77, 0x85, 0xC3, 0x02, 0x65, 0xC9, 0x8A, 0xB4, 0x00, 0x22, 0xBD, 0x6A, 0x17, 0xB5, 0x31, 0xD4,
-    0x8A, 0xBA, 0x70, 0x0A, 0xE5, 0x68, 0xEB, 0x93, 0xF8, 0xA1, 0xAD, 0xFD, 0xB1, 0x45, 0xC7, 0xFD,
-    0x37, 0xBE, 0x3B, 0x2D, 0xF2, 0x02, 0x50, 0xC3, 0xEF, 0x15, 0x62, 0x7F, 0x87, 0xD1, 0xD0, 0x82,
-    0x08, 0x02, 0x8D, 0x8C, 0x5A, 0xAE, 0xCA, 0xAF, 0xBD, 0x8B, 0x0B, 0x93, 0x39, 0x55, 0x99, 0x25,
-    0xBC, 0xEB, 0x55, 0xC0, 0x29, 0xDB, 0x88, 0xAA, 0xA0, 0x79, 0xE5, 0xA6, 0xC4, 0xF6, 0x6A, 0x23,
-    0x69, 0xF0, 0x7E, 0x2D, 0xEB, 0xF1, 0x8F, 0xDE, 0x95, 0xCE, 0x80, 0x9E, 0x9A, 0x23, 0xB7, 0x6B,
-    0x53, 0x8A, 0x29, 0xE9, 0x47, 0xC5, 0x71, 0x9E, 0xE4, 0xDB, 0x9C, 0x2D, 0xB5, 0xC3, 0x9C, 0x87,
-    0x18, 0x81, 0x98, 0xEA, 0x0A, 0x19, 0xCA, 0xE8, 0xA5, 0x96, 0x40, 0x1F, 0x23, 0xEB, 0x60, 0xDA,
-    0x35, 0x09, 0xB6, 0x8A, 0xE4, 0x30, 0xE7, 0x7D, 0x30, 0x37, 0xAE, 0xFE, 0xCF, 0x1B, 0xDB, 0x64,
-    0xA6, 0xA8, 0xC0, 0xA0, 0x78, 0x08, 0x37, 0x25, 0x74, 0xD4, 0xA8, 0x66, 0x88, 0xF6, 0xF4, 0x96,
-    0x5D, 0xFA, 0x2E, 0x62, 0x7E, 0x24, 0xD9, 0x87, 0x05, 0xBC, 0xDD, 0xF5, 0x21, 0xC4, 0x76, 0xC5,
-    0x2A, 0xFB, 0xE5, 0x8C, 0xD5, 0xE3, 0xB1, 0xBE, 0xB7, 0xE4, 0x9C, 0xEF, 0x60, 0xC2, 0xAF, 0x30,
-    0xCC, 0xD3, 0x86, 0x52, 0xA4, 0x3C, 0x85, 0x96, 0x06, 0x6F, 0x49, 0x7C, 0xDB, 0x10, 0xD2, 0xA9,
-    0x11, 0xFB, 0xC8, 0x9E, 0x0A, 0x2E, 0x46, 0x75, 0x4A, 0xA6, 0x84, 0x16, 0x21, 0x55, 0x0F, 0xDA,
-    0x57, 0xD6, 0x78, 0x3A, 0x85, 0xDB, 0x53, 0x73, 0x51, 0x75, 0x97, 0x3E, 0xB8, 0xD5, 0x91, 0x3E,
-    0xEF, 0x92, 0x56, 0x37, 0xC4, 0x2B, 0x2F, 0xC1, 0x40, 0x54, 0xA4, 0xCC, 0xB0, 0x5D, 0x11, 0xE9,
-    0xA2, 0xE7, 0xAE, 0xA4, 0xF6, 0xE0, 0x64, 0x56, 0xA9, 0x2A, 0x70, 0x50, 0x14, 0x09, 0x23, 0xC3,
-    0x65, 0x28, 0x06, 0x0D, 0x99, 0x15, 0xE0, 0xC0, 0xB8, 0xAB, 0xD4, 0xF0, 0x54, 0xB2, 0xE3, 0x2B,
-    0x2B, 0xC2, 0x22, 0x6D, 0x52, 0x0B, 0xDF, 0xC5, 0x63, 0xDD, 0x62, 0xDC, 0x4D, 0x19, 0x3E, 0xF7,
-    0x81, 0x1C, 0xDE, 0x91, 0x27, 0x0E, 0x8E, 0xA4, 0xF4, 0x2D, 0x95, 0x25, 0x71, 0x92, 0x9C, 0x3E,
-    0xC2, 0xC9, 0xFC, 0x3D, 0xA7, 0xF9, 0x06, 0xA6, 0x1E, 0x21, 0x37, 0xC9, 0x4E, 0xDC, 0x80, 0xE4,
-    0x30, 0x3D, 0x02, 0xA5, 0x65, 0x0C, 0xB5, 0xCA, 0xCF, 0x3E, 0x7D, 0x55, 0xCE, 0x75, 0x60, 0x31,
-    0xD7, 0x45, 0x3C, 0x99, 0x4F, 0xC6, 0xDF, 0xEC, 0xA1, 0x46, 0xD4, 0x43, 0x87, 0x68, 0x5A, 0x61,
-    0x40, 0xE5, 0x85, 0x88, 0x33, 0x69, 0x44, 0x6B, 0x9A, 0x09, 0x14, 0x80, 0x56, 0x3E, 0xFD, 0xB8,
-    0x26, 0x0B, 0x11, 0x33, 0xDE, 0x9E, 0x2A, 0xD5, 0x7F, 0x2C, 0x83, 0x8C, 0xD1, 0xFB, 0x50, 0x37,
-    0x6A, 0xB7, 0x48, 0xC2, 0x54, 0x66, 0x0A, 0x49, 0x81, 0x7A, 0xCF, 0xE7, 0x72, 0x6A, 0x0F, 0xD5,
-    0xB3, 0x02, 0x52, 0xE2, 0xEF, 0x94, 0x09, 0xCC, 0x15, 0x20, 0x69, 0x57, 0x53, 0xD6, 0x3E, 0x9C,
-    0x8D, 0xC7, 0x73, 0x9A, 0x24, 0x2F, 0xE7, 0x24, 0xE4, 0xA5, 0xB0, 0xCA, 0xEC, 0x1A, 0x7D, 0xF1,
-    0xBF, 0xAB, 0xD8, 0x80, 0x2E, 0x2C, 0x95, 0x04, 0x34, 0xA9, 0x91, 0xBF, 0x45, 0x13, 0x1C, 0x61,
-    0x93, 0x09, 0x05, 0x1B, 0x31, 0x85, 0x66, 0x34, 0x8B, 0xE2, 0x96, 0xBC, 0xD5, 0xD1, 0x58, 0x90,
-    0x3E, 0xAE, 0x93, 0xD2, 0x03, 0x07, 0xAB, 0x4F, 0xF9, 0x70, 0xCE, 0xA4, 0x04, 0x81, 0x88, 0x1C,
-    0xFC, 0x13, 0x84, 0xC3, 0x7C, 0x59, 0x64, 0xEF, 0x8D, 0xDF, 0x6C, 0x14, 0x3A, 0xBA, 0x83, 0x33,
-    0xED, 0xA0, 0xB7, 0x1E, 0x61, 0xFF, 0x25, 0x9C, 0xFF, 0xF8, 0x3E, 0x2E, 0x24, 0x86, 0xA9, 0xB9,
-    0x1E, 0x3D, 0x0D, 0x2D, 0x35, 0xA8, 0x57, 0x42, 0x45, 0x53, 0xB8, 0xD4, 0xA4, 0xB2, 0xB3, 0xB3,
-    0x90, 0x2D, 0x6A, 0x18, 0xFC, 0x34, 0xAA, 0xA4, 0xC5, 0x48, 0xBC, 0x70, 0x40, 0x2D, 0x17, 0x6F,
-    0x56, 0xB5, 0xAC, 0x97, 0x2E, 0xA5, 0x60, 0x6A, 0x58, 0xA9, 0xC6, 0xE3, 0x49, 0xA9, 0xE2, 0x31,
-    0x7F, 0xE5, 0x76, 0x89, 0xD6, 0x3D, 0x7A, 0x73, 0xD4, 0xD2, 0xC9, 0x52, 0x5E, 0x15, 0xA7, 0x09,
-    0xEE, 0x19, 0x87, 0x4A, 0xE8, 0xC1, 0x33, 0xFA, 0xB8, 0xA2, 0xE7, 0x45, 0x54, 0xF8, 0x82, 0x8E,
-    0xD2, 0x29, 0x7E, 0x5E, 0x46, 0x05, 0x10, 0x12, 0xE5, 0xE2, 0x11, 0xF4, 0x42, 0x7A, 0x08, 0xB5,
-    0xDA, 0xF0, 0x18, 0x7A, 0x29, 0x15, 0x44, 0x6F, 0x53, 0x45, 0x51, 0x96, 0x62, 0x6A, 0x41, 0x13,
-    0xFD, 0x0E, 0x4E, 0x47, 0x5F, 0xA0, 0x65, 0xB5, 0xE4, 0x69, 0x9E, 0x27, 0xE5, 0xAF, 0x24, 0x30,
-    0x96, 0x33, 0x32, 0xE9, 0xF8, 0x22, 0xCB, 0xD5, 0xFE, 0xEF, 0x43, 0xE6, 0x77, 0xE3, 0xBC, 0x0F,
-    0x98, 0x07, 0x3E, 0x5A, 0xE2, 0x9F, 0x79, 0x70, 0xA3, 0xF7, 0x7D, 0x35, 0x19, 0xB5, 0x13, 0xEF,
-    0x20, 0x6D, 0xC6, 0x52, 0x88, 0x59, 0x87, 0x90, 0xC0, 0xCF, 0x42, 0x3F, 0xE0, 0x74, 0x28, 0x3B,
-    0xA7, 0x9E, 0x0B, 0xF0, 0x9F, 0xA7, 0x60, 0x56, 0x01, 0x8A, 0xBF, 0xF3, 0x99, 0x1B, 0x7F, 0xDD,
-    0x78, 0x2C, 0xEA, 0x8B, 0x7C, 0x12, 0xDA, 0xE7, 0xCC, 0xFA, 0xE0, 0xA3, 0x84, 0xB7, 0xA4, 0xB5,
-    0xA2, 0xFD, 0x24, 0x56, 0x41, 0x45, 0x46, 0xE3, 0x23, 0x21, 0x2D, 0x20, 0x2A, 0x7E, 0x5E, 0xFB,
-    0x1A, 0x67, 0xA1, 0xA6, 0x0A, 0x49, 0x8A, 0xD3, 0xD2, 0x0D, 0x9F, 0x17, 0x8B, 0xB2, 0x8C, 0x16,
-    0xC2, 0x47, 0x3E, 0xA6, 0x6A, 0xA4, 0x85, 0xC4, 0xFD, 0xE2, 0xB2, 0x65, 0x0E, 0xEE, 0x07, 0xF3,
-    0xAA, 0x18, 0x81, 0xCE, 0x8D, 0x19, 0x08, 0xCA, 0x57, 0x15, 0x11, 0x2D, 0x7F, 0x22, 0x95, 0xE1,
-    0x2C, 0xE5, 0xD0, 0xFC, 0xE2, 0xAB, 0xBC, 0xA3, 0x1C, 0x3E, 0x2D, 0x94, 0x1C, 0x79, 0x2A, 0x1F,
-    0x93, 0x19, 0xE3, 0xCC, 0xA9, 0x16, 0xF3, 0xC3, 0xAD, 0x42, 0xE9, 0x58, 0x49, 0x72, 0x24, 0x03,
-    0x39, 0xEB, 0x7F, 0x39, 0x44, 0x08, 0x68, 0x0E, 0x32, 0xAB, 0xAF, 0x2D, 0x29, 0xA6, 0xA9, 0x17,
-    0xC4, 0x4A, 0x55, 0xCC, 0x87, 0xE3, 0x4B, 0x5E, 0x44, 0xC2, 0x46, 0x76, 0x41, 0x29, 0x37, 0x14,
-    0x43, 0x77, 0x16, 0xE5, 0xF3, 0x3A, 0x25, 0xAD, 0x87, 0x7A, 0xE7, 0x39, 0xC7, 0xAF, 0x44, 0x2E,
-    0x65, 0x60, 0x1D, 0xE8, 0x6F, 0xF0, 0x2E, 0x3E, 0xDF, 0xB0, 0x8C, 0xBD, 0xE9, 0x05, 0x80, 0xD3,
-    0x22, 0x71, 0xD2, 0xDC, 0x74, 0xBF, 0x1D, 0x75, 0x30, 0xDE, 0x4D, 0x25, 0xF6, 0xFF, 0xA3, 0xA7,
-    0x4D, 0x60, 0x6B, 0xB5, 0xBA, 0x8E, 0x74, 0x4D, 0x5D, 0x6F, 0x29, 0x20, 0xFF, 0xDB, 0x83, 0x37,
-    0xA9, 0xE7, 0x50, 0x08, 0x9A, 0xCF, 0x1E, 0xF0, 0x9F, 0x84, 0xE4, 0x98, 0x95, 0xF7, 0x68, 0x32,
-    0x78, 0xE8, 0xE4, 0xC2, 0xF4, 0x71, 0x30, 0x0C, 0x5D, 0x40, 0xC1, 0x50, 0x61, 0xB2, 0x65, 0x3E,
-    0x53, 0xEA, 0xDB, 0x59, 0x28, 0x2A, 0xAC, 0xBA, 0x15, 0x0E, 0x15, 0x47, 0x25, 0x24, 0x6F, 0x78,
-    0x3C, 0x54, 0x1E, 0x3D, 0x65, 0x6F, 0x8F, 0x2F, 0x7A, 0x40, 0x72, 0x0F, 0xB0, 0xD3, 0x18, 0x6D,
-    0xD5, 0x28, 0x50, 0x90, 0xE5, 0xCC, 0x0F, 0x0E, 0x08, 0x00, 0x7F, 0x45, 0xAC, 0x20, 0x00, 0xE0,
-    0x3F, 0x70, 0xD8, 0x5C, 0xDD, 0x78, 0x97, 0xB3, 0x82, 0x61, 0x90, 0xC7, 0xA3, 0x8E, 0xBF, 0x78,
-    0x0E, 0x91, 0x04, 0xB6, 0x41, 0x84, 0x20, 0x5B, 0x23, 0x6E, 0x26, 0x56, 0x57, 0x0A, 0x5C, 0x39,
-    0xB0, 0xB0, 0x4A, 0x3C, 0xD1, 0x6C, 0x3E, 0xDF, 0xF4, 0x33, 0x4D, 0xFF, 0x8C, 0x0E, 0xCC, 0x86,
-    0x61, 0x39, 0x1D, 0x03, 0x64, 0x57, 0xC5, 0x0F, 0x56, 0xAE, 0x17, 0x7A, 0xBD, 0xD2, 0xB2, 0x21,
-    0xF0, 0x25, 0x02, 0x83, 0x0C, 0xB3, 0x1A, 0xBA, 0x01, 0xF3, 0x14, 0xAE, 0x9E, 0xD9, 0x96, 0xF8,
-    0xAD, 0x46, 0xEA, 0xA0, 0xFC, 0xDC, 0x67, 0x50, 0xE4, 0x59, 0x5F, 0x66, 0x25, 0x52, 0x67, 0x30,
-    0x37, 0xDD, 0xE3, 0xCA, 0x60, 0x04, 0x8E, 0x47, 0x86, 0x61, 0xEC, 0xCD, 0xBC, 0xE3, 0x90, 0x78,
-    0x76, 0x0F, 0xBE, 0xED, 0x3C, 0x2B, 0x4C, 0x3C, 0x2F, 0x90, 0xB2, 0x27, 0x85, 0x84, 0x33, 0xCF,
-    0x1D, 0x98, 0x2F, 0x9C, 0x2B, 0xC5, 0xC0, 0x72, 0xA4, 0xC8, 0xF9, 0xE0, 0xA1, 0x4A, 0xF6, 0x58,
-    0x18, 0x96, 0x47, 0x40, 0x0F, 0x5B, 0xA4, 0x79, 0x04, 0x47, 0xA0, 0x19, 0x01, 0x23, 0x8E, 0x38,
-    0x26, 0x17, 0x65, 0xF9, 0xF5, 0x1F, 0xC2, 0x6F, 0xE6, 0x19, 0x7D, 0xBA, 0xF3, 0x1C, 0x46, 0x9F,
-    0xA8, 0x54, 0x71, 0x96, 0xC4, 0x52, 0xD5, 0xF1, 0x87, 0xE3, 0x4A, 0x23, 0xC3, 0x07, 0x8A, 0xCF,
-    0x76, 0xF4, 0x38, 0xA4, 0x14, 0x5C, 0xF8, 0x85, 0xD7, 0xE7, 0x4C, 0x40, 0x0F, 0xFA, 0xAB, 0xEB,
-    0xC4, 0xF2, 0xFD, 0x77, 0x48, 0xAF, 0xD6, 0x7B, 0xF2, 0xB2, 0xB6, 0x0C, 0x2E, 0xD1, 0x2F, 0x22,
-    0x4D, 0xF0, 0x18, 0x1B, 0x62, 0x24, 0x33, 0x6A, 0x8A, 0x33, 0x2A, 0x89, 0x6C, 0x4E, 0x35, 0x73,
-    0x47, 0x09, 0xF3, 0x09, 0x5D, 0xAA, 0xCA, 0x0B, 0x80, 0x34, 0xCF, 0x4B, 0xA8, 0x3E, 0xCB, 0xCA,
-    0x0A, 0xFA, 0xA7, 0x16, 0x4F, 0x4C, 0xD3, 0xFB, 0x53, 0x89, 0xFB, 0xE4, 0x27, 0x53, 0x31, 0x5D,
-    0xF2, 0x2F, 0x08, 0x80, 0xD6, 0xFC, 0x2B, 0xE4, 0x69, 0xE3, 0x47, 0xE0, 0xE2, 0x26, 0x82, 0xAF,
-    0xE7, 0x28, 0x5F, 0xE8, 0x64, 0x3C, 0x57, 0x58, 0x73, 0x94, 0x7E, 0xD5, 0xCA, 0xA3, 0x5B, 0xD6,
-    0xF6, 0x0B, 0xD2, 0x0B, 0x8A, 0xC7, 0x4C, 0x73, 0xC4, 0x35, 0x8A, 0xE2, 0x9C, 0xAB, 0xD1, 0xD7,
-    0xF1, 0x70, 0xDA, 0xA9, 0xCF, 0x96, 0xF4, 0x5F, 0x47, 0x1B, 0x78, 0x4B, 0xD0, 0x34, 0xA6, 0xA1,
-    0x1F, 0x98, 0x9A, 0x26, 0x4A, 0x2C, 0xA3, 0x28, 0xB1, 0x4C, 0x8D, 0x69, 0xC9, 0xC1, 0xF3, 0x82,
-    0xE7, 0x4A, 0xBD, 0x63, 0x26, 0xD9, 0x6C, 0x5C, 0x4D, 0x35, 0x8D, 0x75, 0x9A, 0xC4, 0x1A, 0x65,
-    0xEF, 0x92, 0x41, 0xC9, 0x04, 0x74, 0x60, 0x79, 0x3B, 0x94, 0x58, 0x4A, 0x8B, 0xA8, 0xB1, 0x65,
-    0x59, 0x11, 0xAE, 0xAE, 0xF9, 0x9E, 0x7B, 0x7C, 0x21, 0xB4, 0x58, 0xD3, 0xF3, 0x3D, 0x3D, 0x3F,
-    0xD2, 0xCA, 0xEB, 0x3E, 0xB5, 0x30, 0x58, 0x37, 0x7D, 0xB1, 0xD0, 0xD6, 0x63, 0x97, 0xA9, 0x32,
-    0xFC, 0xD9, 0xEF, 0x51, 0xCE, 0xEB, 0x9A, 0x07, 0x8A, 0x8B, 0x5F, 0x40, 0x54, 0xC3, 0x8E, 0x63,
-    0xF9, 0x7A, 0xD2, 0xB4, 0x5C, 0x0D, 0x25, 0x6D, 0x5E, 0x7E, 0x31, 0x7D, 0x00, 0xCB, 0x5F, 0x19,
-    0x9D, 0xE1, 0x33, 0x32, 0x67, 0xF5, 0x12, 0xCC, 0xA6, 0x61, 0x9F, 0xAE, 0xF8, 0xF0, 0xA1, 0x15,
-    0xB5, 0xF6, 0xF3, 0x5A, 0xBD, 0x7C, 0x9B, 0xED, 0x47, 0xE7, 0xEE, 0xFE, 0xAD, 0xFB, 0xE5, 0xB3,
-    0xD9, 0x2F, 0x50, 0x57, 0x6A, 0x98, 0x95, 0x5B, 0x17, 0x49, 0xF3, 0x84, 0xFB, 0x46, 0xBB, 0x2C,
-    0x21, 0x86, 0x92, 0x51, 0xD2, 0xD9, 0x1B, 0x8B, 0x7C, 0x3B, 0xA9, 0xC3, 0xE1, 0x2D, 0xD6, 0xA1,
-    0xC6, 0xF9, 0x69, 0xC1, 0x56, 0x99, 0x67, 0x0F, 0x32, 0x75, 0x35, 0xCC, 0x90, 0xD4, 0xE1, 0x74,
-    0x78, 0x8B, 0x35, 0x65, 0x3B, 0x88, 0x08, 0x88, 0x6C, 0x3E, 0x90, 0xBB, 0x67, 0x50, 0x5D, 0x9D,
-    0x41, 0x80, 0x6B, 0x83, 0x50, 0x66, 0xD9, 0xE0, 0xDC, 0xCD, 0xED, 0x42, 0x30, 0x70, 0x6B, 0x32,
-    0x68, 0x5E, 0xCD, 0x5E, 0x77, 0x83, 0x8C, 0x93, 0xA1, 0xC8, 0x15, 0x5F, 0x6E, 0x0E, 0x9A, 0x39,
-    0xA7, 0x04, 0x3F, 0xE8, 0x30, 0x3C, 0x65, 0xBA, 0x6A, 0x3E, 0x80, 0x94, 0xED, 0xE3, 0x56, 0x2D,
-    0x71, 0x0B, 0x67, 0xFB, 0x60, 0xED, 0xE3, 0x96, 0xED, 0xE3, 0x56, 0x2D, 0x71, 0x0B, 0xE7, 0x4F,
-    0xBB, 0xF5, 0x4C, 0xF1, 0x0C, 0x8A, 0xD1, 0xEB, 0x5A, 0xB4, 0xF9, 0x72, 0x62, 0x30, 0xC6, 0x63,
-    0x84, 0x1A, 0x20, 0x86, 0x2E, 0xB1, 0x79, 0x90, 0x68, 0xEF, 0x21, 0xB7, 0x4C, 0x94, 0x8E, 0x99,
-    0x2C, 0xEE, 0x98, 0xCB, 0x32, 0x85, 0x42, 0xDB, 0xBF, 0x58, 0x16, 0xC1, 0x91, 0x53, 0x76, 0x7F,
-    0x81, 0x60, 0xAC, 0x17, 0xD8, 0xDE, 0xAC, 0x89, 0xDB, 0x84, 0xC9, 0x02, 0x96, 0x87, 0xF7, 0xE0,
-    0x42, 0xC5, 0x3B, 0xE0, 0x56, 0x86, 0x05, 0xD0, 0x6D, 0xA7, 0xA5, 0xF8, 0x5C, 0x11, 0xF2, 0x95,
-    0x30, 0xD2, 0x6B, 0xE5, 0x9A, 0x27, 0x09, 0x55, 0xF1, 0xD5, 0x1E, 0xAE, 0x2F, 0x37, 0xA2, 0xFA,
-    0x97, 0x21, 0x53, 0xE6, 0xAE, 0xC7, 0x75, 0x08, 0x9E, 0xAD, 0x43, 0xF1, 0xFF, 0xA4, 0xC3, 0xDA,
-    0xFE, 0xE2, 0x3A, 0xB9, 0xAB, 0xDA, 0xAC, 0x1F, 0x64, 0x53, 0xAC, 0x4E, 0xC6, 0x45, 0xDC, 0x6B,
-    0x8C, 0xD6, 0x94, 0x06, 0x2E, 0x3D, 0x29, 0x21, 0x01, 0x9C, 0x80, 0xCB, 0x93, 0x96, 0x73, 0x7A,
-    0x0B, 0xCC, 0x28, 0x41, 0xCC, 0x6E, 0xE7, 0x20, 0xFD, 0x9C, 0xE6, 0x03, 0x13, 0xA8, 0xF4, 0x4C,
-    0xFD, 0xBB, 0x2A, 0x7D, 0xA7, 0xE5, 0x1D, 0x96, 0x1B, 0x05, 0xBC, 0x23, 0x72, 0x0F, 0x21, 0x5B,
-    0xE2, 0x7C, 0x63, 0x99, 0xB5, 0xF2, 0x44, 0xFD, 0xF4, 0xB2, 0x5B, 0x59, 0xD0, 0x06, 0x9D, 0x51,
-    0xF6, 0x60, 0x04, 0x4C, 0x38, 0x72, 0x34, 0x4D, 0xDA, 0xA7, 0x62, 0x1A, 0x3C, 0x81, 0xE9, 0x9C,
-    0x98, 0x9A, 0x27, 0x30, 0xED, 0x56, 0x31, 0x35, 0x9F, 0x2B, 0xA6, 0x1E, 0xC1, 0xA1, 0x93, 0xCF,
-    0x7F, 0x92, 0xE2, 0xD3, 0xBC, 0x01, 0x8A, 0x99, 0x9F, 0x76, 0x30, 0x04, 0x64, 0x98, 0x68, 0x51,
-    0x95, 0x5A, 0x88, 0x38, 0x03, 0x84, 0x09, 0xF9, 0xB8, 0x02, 0x6E, 0xF1, 0x27, 0x33, 0x86, 0x2E,
-    0x0B, 0x31, 0xB6, 0x29, 0xD8, 0xD6, 0x22, 0xA7, 0x40, 0x5D, 0x4F, 0x49, 0x5C, 0x3A, 0x6B, 0x8C,
-    0xF1, 0x2A, 0x1B, 0x37, 0x11, 0xD9, 0x67, 0xA2, 0x92, 0xA5, 0x43, 0x05, 0xBF, 0xC1, 0x2B, 0x58,
-    0x76, 0x54, 0x50, 0x60, 0x86, 0x52, 0xAF, 0x8B, 0xDB, 0xA0, 0x0D, 0x3A, 0x54, 0x72, 0xDB, 0x58,
-    0x51, 0x6F, 0x47, 0x75, 0xD8, 0xC6, 0xD6, 0xD4, 0xC6, 0x4E, 0xCA, 0xE4, 0x1F, 0x61, 0x4F, 0xE8,
-    0x95, 0xEE, 0xF9, 0xCE, 0xD7, 0x68, 0xF0, 0xEF, 0x1D, 0x59, 0x44, 0x24, 0x1B, 0xEB, 0xC8, 0x1C,
-    0xBC, 0x74, 0x8E, 0x0D, 0xDF, 0x22, 0x68, 0x82, 0x6D, 0xD9, 0x08, 0xF6, 0x50, 0x52, 0x5C, 0xC5,
-    0xCD, 0xC0, 0xC0, 0x94, 0x6C, 0x6E, 0x27, 0x14, 0x60, 0x07, 0xF5, 0x62, 0xDC, 0x6A, 0x7B, 0x08,
-    0xA1, 0xBD, 0x8E, 0x14, 0x1E, 0xD9, 0xE4, 0xEF, 0xD8, 0x25, 0x65, 0x1F, 0xE6, 0x4F, 0x5D, 0x1D,
-    0x75, 0x55, 0xE3, 0x07, 0x66, 0xD3, 0x4D, 0x97, 0x19, 0x93, 0xFD, 0xD8, 0x0F, 0xE7, 0xA7, 0x91,
-    0x1E, 0xA6, 0xCA, 0x7E, 0x9D, 0xF4, 0x08, 0xB2, 0x3E, 0xB6, 0x1C, 0x3A, 0x68, 0x31, 0x75, 0xFB,
-    0x0A, 0xF3, 0x96, 0xE4, 0x0D, 0x8A, 0xCA, 0x06, 0x59, 0xA4, 0x4E, 0xDC, 0x7F, 0xA3, 0x4A, 0xFB,
-    0x13, 0x3B, 0x58, 0x60, 0xDB, 0x5B, 0x83, 0xA5, 0xCE, 0x33, 0x8C, 0xF1, 0x99, 0xC7, 0x3F, 0x36,
-    0xB0, 0x14, 0xDB, 0x56, 0x91, 0x6D, 0xD9, 0xB4, 0x1A, 0xF8, 0xF0, 0xE7, 0xDC, 0xB9, 0x69, 0x75,
-    0x44, 0x6E, 0x4A, 0xB0, 0x01, 0x9E, 0x82, 0x1D, 0x38, 0x24, 0x04, 0x99, 0x42, 0xA0, 0x0A, 0xA8,
-    0xB8, 0x92, 0x63, 0xC6, 0x24, 0x5F, 0xE7, 0x36, 0xC5, 0xCC, 0x69, 0xAB, 0xFE, 0x98, 0x44, 0xFF,
-    0xFC, 0xA2, 0xC4, 0xE6, 0xB4, 0x24, 0xF0, 0x83, 0x43, 0x72, 0x71, 0xE0, 0xE8, 0xCF, 0x0A, 0x02,
-    0x83, 0x3C, 0x86, 0x73, 0xD3, 0xEF, 0xCF, 0x23, 0x05, 0xD9, 0x95, 0xA6, 0x82, 0x99, 0xDE, 0xD1,
-    0x51, 0x53, 0x54, 0xC4, 0x49, 0x91, 0x94, 0x49, 0x11, 0x35, 0x1C, 0x16, 0x42, 0x6E, 0x0A, 0x2D,
-    0x76, 0x15, 0xF7, 0x73, 0x5C, 0x2E, 0x0E, 0x03, 0xDF, 0x3B, 0x7B, 0x20, 0xC3, 0xC0, 0x0C, 0xCC,
-    0xAF, 0x9F, 0x15, 0x39, 0xCB, 0x57, 0xE3, 0xBD, 0xF0, 0xF0, 0xEA, 0xE2, 0xFA, 0x33, 0x4B, 0x7C,
-    0xA2, 0x23, 0x86, 0x0F, 0x1E, 0x35, 0x2C, 0x0B, 0xDA, 0xA8, 0x88, 0x9B, 0xAC, 0x83, 0x31, 0x3B,
-    0xC4, 0x44, 0x6C, 0x01, 0xE6, 0x43, 0x37, 0x8D, 0xB5, 0x67, 0x01, 0xD0, 0xD3, 0xB7, 0x0B, 0x7A,
-    0x60, 0xAB, 0x66, 0x66, 0x73, 0x23, 0xD3, 0x7D, 0x2B, 0xE6, 0xB4, 0xBD, 0xD7, 0x2D, 0xCB, 0x0A,
-    0xEE, 0x83, 0x38, 0x50, 0x4B, 0x89, 0xE1, 0xDF, 0x19, 0xAA, 0x89, 0x61, 0x5B, 0x6F, 0x76, 0x88,
-    0xD9, 0xBF, 0x57, 0xF7, 0x1E, 0xA9, 0x83, 0x00, 0x29, 0x72, 0x22, 0xAA, 0x9A, 0x61, 0x5B, 0x8F,
-    0x3B, 0x61, 0xC8, 0x69, 0xDF, 0xC2, 0x43, 0x37, 0xD8, 0xBF, 0x06, 0x9F, 0x04, 0x17, 0x17, 0x0D,
-    0xAE, 0xD1, 0xD0, 0xBC, 0x3A, 0x72, 0xF3, 0x49, 0xB7, 0x42, 0x26, 0x34, 0x58, 0x44, 0xE4, 0xC5,
-    0x1A, 0x6E, 0x3D, 0x8D, 0x25, 0xE9, 0x66, 0x04, 0xB9, 0x01, 0xE4, 0x34, 0x51, 0x91, 0x7D, 0xC7,
-    0x84, 0xE5, 0x4B, 0xB2, 0xF7, 0x7A, 0x8D, 0xEB, 0x56, 0x17, 0xD4, 0x97, 0xF7, 0x64, 0x58, 0x55,
-    0xB2, 0x89, 0x4B, 0xB7, 0x65, 0x03, 0x21, 0xF8, 0xD4, 0xE6, 0x2D, 0xA6, 0x0B, 0xE7, 0x5C, 0x09,
-    0x45, 0x25, 0xE6, 0xBA, 0xC3, 0xF9, 0xE4, 0x7F, 0x50, 0x0F, 0x60, 0x01, 0x67, 0x47, 0x63, 0xBF,
-    0xFD, 0xC3, 0x26, 0x9A, 0xEE, 0xDE, 0xE5, 0x1F, 0xBE, 0x51, 0x70, 0x46, 0x7C, 0xDA, 0xA2, 0xB0,
-    0x23, 0x26, 0xA7, 0x86, 0x8E, 0x91, 0x41, 0x81, 0xCD, 0x95, 0x6C, 0x54, 0x1C, 0x59, 0x0D, 0x11,
-    0x51, 0x65, 0x92, 0xFA, 0x18, 0x02, 0x3B, 0xB4, 0xA6, 0x84, 0x23, 0x43, 0x1B, 0xA2, 0x2C, 0x7B,
-    0x97, 0x7C, 0xA4, 0x51, 0x1D, 0xED, 0x31, 0xB9, 0xB7, 0xFF, 0x88, 0x4B, 0x3C, 0xDF, 0x20, 0x38,
-    0xB1, 0xA8, 0x27, 0xB8, 0xCB, 0x86, 0xD9, 0x11, 0x30, 0xEC, 0x40, 0xC4, 0x7D, 0xF6, 0xB4, 0x64,
-    0x49, 0x16, 0xE3, 0x44, 0x54, 0x83, 0xB0, 0xC9, 0x19, 0x58, 0x9C, 0x33, 0xA9, 0x1E, 0x04, 0x4E,
-    0x93, 0x2E, 0xA7, 0xF2, 0xDB, 0x90, 0x80, 0x4E, 0xF7, 0xFA, 0x74, 0x2E, 0x6A, 0x12, 0x70, 0x4F,
-    0x46, 0xF7, 0x7C, 0x07, 0xD1, 0x6B, 0x3C, 0xB1, 0x2E, 0x70, 0xB7, 0x22, 0xB2, 0x80, 0xF1, 0x2E,
-    0xA2, 0x31, 0xD5, 0xE6, 0x21, 0xEC, 0x7C, 0x6F, 0x20, 0xED, 0x6D, 0x3A, 0x0F, 0xB0, 0x7E, 0x2A,
-    0x43, 0x6C, 0xEB, 0x9C, 0xED, 0xB0, 0x51, 0x82, 0xBB, 0xE0, 0x7B, 0xA6, 0xE4, 0xBD, 0xA9, 0xF2,
-    0x63, 0xAE, 0xFD, 0x18, 0x0E, 0x75, 0x53, 0xB7, 0x46, 0x3E, 0x16, 0x73, 0xA1, 0x3E, 0xC9, 0x9D,
-    0x96, 0xFF, 0xCB, 0xB3, 0xEC, 0x38, 0x25, 0x76, 0x1A, 0xB7, 0x55, 0xD4, 0xE7, 0xF7, 0xE7, 0x2B,
-    0xF3, 0x5F, 0x51, 0x11, 0x13, 0xED, 0x6D, 0xD1, 0x17, 0x5A, 0x75, 0xD7, 0x33, 0xDE, 0x5D, 0xAD,
-    0x36, 0xAA, 0xA6, 0x3A, 0xCC, 0x50, 0x3B, 0x6A, 0x23, 0xCE, 0x17, 0x6A, 0xBE, 0xE3, 0xFA, 0x0A,
-    0x4B, 0x13, 0x6D, 0xBD, 0xE8, 0x76, 0xF2, 0x91, 0xDB, 0x0F, 0x4B, 0x2F, 0x9A, 0xE9, 0x39, 0xAA,
-    0xFB, 0x0F, 0x08, 0xD7, 0x9B, 0x1D, 0xED, 0xE2, 0x03, 0x03, 0x6E, 0x95, 0x63, 0x3D, 0x9F, 0x51,
-    0x40, 0x44, 0x6D, 0x48, 0xCC, 0x24, 0x7B, 0x4F, 0x7B, 0xCD, 0xCC, 0xCF, 0x46, 0x8B, 0xC5, 0x13,
-    0xFD, 0x50, 0x52, 0x43, 0xA7, 0xBF, 0x3C, 0x2D, 0xD2, 0x7C, 0x54, 0xC8, 0xA9, 0xF8, 0xB1, 0x0E,
-    0x6F, 0xFC, 0xBB, 0xBD, 0xA8, 0x8F, 0x25, 0x7B, 0x69, 0x01, 0x93, 0x20, 0xD3, 0x82, 0x65, 0x10,
-    0xAC, 0x1D, 0x56, 0xCD, 0x69, 0x61, 0xAC, 0xB6, 0x98, 0x73, 0x44, 0x41, 0xDC, 0x84, 0xBA, 0x29,
-    0x58, 0x24, 0x75, 0xCC, 0x6B, 0x95, 0x2C, 0x0B, 0x7B, 0x06, 0x99, 0xE6, 0x05, 0xE6, 0x84, 0xC3,
-    0x37, 0x9E, 0x62, 0xA1, 0x1F, 0x6A, 0x47, 0x0A, 0x3A, 0x7F, 0x13, 0x19, 0x4D, 0xB7, 0x29, 0x93,
-    0x82, 0x7B, 0x55, 0xDC, 0x0E, 0x06, 0x48, 0x24, 0x8B, 0x2D, 0x58, 0x66, 0x22, 0xF9, 0x23, 0x57,
-    0x24, 0xCC, 0xDB, 0x7C, 0x99, 0x3D, 0xEF, 0x72, 0x8B, 0x70, 0xB3, 0xBE, 0x80, 0x7B, 0x66, 0x97,
-    0xFA, 0x73, 0x9B, 0xF2, 0xF4, 0xD0, 0x23, 0x63, 0x47, 0x3E, 0xBE, 0x0E, 0xB7, 0x28, 0x8E, 0x3E,
-    0x96, 0x91, 0x10, 0xCC, 0x31, 0x9C, 0xDA, 0x7C, 0xF2, 0xA6, 0x8D, 0x6B, 0xEE, 0xDF, 0x23, 0xB7,
-    0x02, 0xC4, 0xA2, 0x57, 0xFE, 0x8B, 0xDA, 0x14, 0x06, 0x8A, 0xD9, 0x78, 0x77, 0x1F, 0x93, 0x92,
-    0xD9, 0x8E, 0x67, 0xDF, 0xE8, 0x83, 0x65, 0x7B, 0xDB, 0xDE, 0x94, 0x64, 0xED, 0x9C, 0xC4, 0x31,
-    0x72, 0xAF, 0xBD, 0xF7, 0x39, 0xCB, 0xDF, 0xC3, 0xCC, 0x19, 0x62, 0x38, 0xEA, 0x59, 0x23, 0x3D,
-    0xD9, 0x49, 0x5C, 0x1C, 0xBF, 0xA9, 0x5F, 0x24, 0x68, 0x55, 0x0D, 0x9D, 0x64, 0x84, 0x09, 0x30,
-    0xF0, 0x86, 0x50, 0x0F, 0xCE, 0x02, 0xA5, 0xD2, 0x22, 0x2D, 0x61, 0x71, 0x2A, 0x92, 0xF8, 0xF6,
-    0x33, 0x7B, 0x46, 0x37, 0x96, 0xE5, 0x9F, 0x6F, 0x60, 0x91, 0x57, 0x0E, 0xD6, 0x7D, 0x87, 0x4E,
-    0x80, 0x49, 0xE1, 0xCF, 0xFB, 0x3D, 0xC4, 0x2D, 0xDF, 0x74, 0x0B, 0xA6, 0x2B, 0xCD, 0x7E, 0xBF,
-    0xFF, 0xAA, 0xDF, 0xB0, 0x40, 0x2E, 0x5B, 0xD6, 0xEC, 0x5A, 0x9F, 0x0D, 0xED, 0x0F, 0xA3, 0x2B,
-    0x96, 0x64, 0xE5, 0xC6, 0xF5, 0xFD, 0xE6, 0x8E, 0xF2, 0x6E, 0x58, 0xD5, 0xE2, 0x35, 0x81, 0x64,
-    0x6F, 0x4E, 0x29, 0xD5, 0x99, 0x75, 0xFA, 0xE4, 0x26, 0x8A, 0xAA, 0xD8, 0x76, 0x8C, 0xCE, 0xB7,
-    0x5A, 0xC4, 0x64, 0xF2, 0x5A, 0xCD, 0x0D, 0x13, 0x73, 0x1F, 0xCF, 0xA6, 0xBF, 0xAF, 0x32, 0x6B,
-    0xC4, 0xA8, 0x62, 0xDE, 0x46, 0x20, 0xAA, 0x1B, 0xCB, 0x95, 0x82, 0xB1, 0xCB, 0x78, 0x1D, 0x96,
-    0x78, 0x5B, 0x8B, 0x6F, 0x65, 0x2C, 0x76, 0x2D, 0xA3, 0x66, 0xFF, 0x46, 0x6D, 0x0B, 0x6B, 0x21,
-    0x77, 0x60, 0x7B, 0xDC, 0x67, 0xDD, 0xD1, 0x30, 0xC6, 0x44, 0x56, 0xB3, 0x70, 0x2B, 0x23, 0x26,
-    0x5D, 0x6E, 0xC5, 0x63, 0x29, 0xC1, 0x1C, 0x9C, 0x22, 0x0B, 0x6C, 0x4A, 0xC6, 0xC0, 0x4B, 0x4A,
-    0xD3, 0x60, 0x75, 0x59, 0x22, 0xAF, 0x93, 0x1E, 0xF8, 0x85, 0x93, 0xD4, 0x5D, 0x93, 0xC3, 0xC5,
-    0xA2, 0x9B, 0xCE, 0xA5, 0xCD, 0x55, 0x8F, 0xD3, 0xE8, 0x59, 0x46, 0xFE, 0xCC, 0x33, 0x84, 0xD6,
-    0x47, 0xC1, 0x23, 0x4B, 0xBE, 0x04, 0xCB, 0x35, 0x1E, 0x7B, 0x40, 0x29, 0x1B, 0x64, 0x86, 0x11,
-    0x3E, 0xEE, 0x38, 0x7A, 0xD0, 0x91, 0xB0, 0x77, 0x30, 0x3A, 0x48, 0x22, 0xB1, 0x59, 0x83, 0x32,
-    0xBC, 0x70, 0xFA, 0x6D, 0x96, 0x36, 0x76, 0x0F, 0x4A, 0xCD, 0xC7, 0x49, 0xB9, 0x05, 0x72, 0x99,
-    0x69, 0x8D, 0x53, 0x1D, 0xDC, 0xEC, 0x81, 0xFC, 0x5A, 0x7A, 0x70, 0x50, 0xB2, 0x0F, 0xAB, 0x1C,
-    0x0A, 0xC9, 0x51, 0x33, 0x4D, 0x4B, 0x59, 0x49, 0x29, 0x73, 0xFF, 0x5D, 0x1A, 0x56, 0xF9, 0x42,
-    0x31, 0x83, 0xA1, 0x61, 0xD3, 0x2C, 0xFC, 0x63, 0x7B, 0x75, 0x83, 0xE1, 0x97, 0x3A, 0x3A, 0xFF,
-    0x1D, 0x88, 0x0D, 0x51, 0xAA, 0x4B, 0xF9, 0x8D, 0x81, 0x11, 0xD9, 0x7A, 0x8A, 0x54, 0x1C, 0x76,
-    0x6C, 0x8C, 0xFE, 0x9C, 0x3D, 0xD9, 0x7F, 0xE0, 0x2E, 0x34, 0xBD, 0xA3, 0x62, 0x1D, 0x43, 0x67,
-    0x89, 0xA9, 0x41, 0x5A, 0x0F, 0x9B, 0x77, 0x74, 0x7D, 0x96, 0xFC, 0x91, 0xD3, 0x90, 0x2A, 0xD8,
-    0x4A, 0x3D, 0x30, 0xCF, 0x86, 0xF7, 0x6C, 0x68, 0xA9, 0x7B, 0x1E, 0x73, 0xDE, 0x5A, 0xC3, 0x13,
-    0x1B, 0xB9, 0x8B, 0xFC, 0x59, 0x9B, 0x32, 0x41, 0xB5, 0xBA, 0x29, 0x57, 0xC2, 0x26, 0x44, 0xE0,
-    0xA5, 0xB2, 0x1E, 0x74, 0x41, 0x9B, 0x96, 0xE6, 0x7A, 0x2F, 0x23, 0xAC, 0x97, 0x50, 0xEC, 0xC7,
-    0xEF, 0xFA, 0x47, 0x3B, 0x6F, 0xEF, 0xD4, 0x57, 0x38, 0x43, 0x09, 0x9E, 0x51, 0xE6, 0x5C, 0x57,
-    0x4C, 0xBA, 0xE0, 0x7E, 0xDE, 0x96, 0xE3, 0x06, 0x3D, 0x97, 0x91, 0xAE, 0x5F, 0x00, 0xF1, 0x3A,
-    0x27, 0xC0, 0x17, 0x40, 0x6F, 0xB1, 0x1B, 0x33, 0x1D, 0x94, 0x8E, 0xFE, 0x4B, 0x17, 0x2A, 0x64,
-    0x5C, 0x67, 0x07, 0xAD, 0x03, 0x2A, 0xCB, 0x16, 0xB8, 0x8F, 0x60, 0x8D, 0x78, 0x6A, 0xCA, 0xB5,
-    0x8F, 0x4C, 0x66, 0xB2, 0xAA, 0xF7, 0xFF, 0x02, 0xCD, 0x5B, 0x3D, 0x8C, 0xDE, 0xE6, 0x7D, 0x7F,
-    0x48, 0x4A, 0x62, 0x23, 0xC6, 0xA2, 0x07, 0x1B, 0x4D, 0x6A, 0x5B, 0xEC, 0x90, 0x21, 0xA8, 0x25,
-    0x73, 0xC9, 0x20, 0x14, 0x77, 0x47, 0x3A, 0x19, 0x02, 0x34, 0x40, 0xAD, 0x41, 0x67, 0x0F, 0x19,
-    0xDC, 0x21, 0x4B, 0x6C, 0x14, 0xCA, 0xE0, 0x41, 0x08, 0x4E, 0x47, 0xDA, 0x05, 0xDA, 0x21, 0x43,
-    0x55, 0xA0, 0x4E, 0x86, 0x0E, 0xD5, 0xE0, 0x00, 0x89, 0x94, 0xE2, 0x34, 0x68, 0x10, 0xD0, 0xBB,
-    0x23, 0xED, 0xA5, 0x83, 0x87, 0x32, 0x75, 0x33, 0x65, 0x28, 0xEB, 0x24, 0x08, 0xAC, 0x02, 0x35,
-    0x91, 0xD2, 0xF0, 0x7B, 0x12, 0xDF, 0xF7, 0xE9, 0xEF, 0xF7, 0xFF, 0x3F, 0x7C, 0xDF, 0xF7, 0x4E,
-    0x77, 0xB2, 0x63, 0xB5, 0x96, 0x4E, 0x3A, 0x1E, 0xBF, 0x9F, 0xFF, 0xF7, 0x37, 0x8D, 0xD1, 0x9F,
-    0x93, 0x5B, 0xD6, 0x98, 0xC0, 0xDA, 0xD6, 0x1C, 0xF1, 0xE3, 0x4D, 0xB8, 0xCD, 0x6A, 0x6C, 0xA2,
-    0x81, 0xC7, 0x96, 0xBB, 0x6B, 0xDB, 0x3C, 0x7E, 0x17, 0xBB, 0x5E, 0x7F, 0x99, 0xC7, 0x61, 0x83,
-    0xE3, 0x7A, 0x93, 0xC7, 0x01, 0xDE, 0x95, 0xE1, 0x1F, 0x8E, 0x83, 0x8E, 0xCF, 0x67, 0x3C, 0xC6,
-    0x6E, 0x64, 0xAD, 0xCD, 0x3D, 0x6C, 0x7A, 0x93, 0x71, 0x37, 0xFA, 0x68, 0xFD, 0xA5, 0x89, 0x87,
-    0x97, 0x66, 0x65, 0x56, 0x9A, 0x60, 0x88, 0x3A, 0xB7, 0x90, 0x31, 0xFE, 0x75, 0x5B, 0xE3, 0xCE,
-    0x6E, 0x3F, 0x2C, 0xE9, 0xEF, 0x6A, 0x53, 0xE0, 0xE4, 0xA6, 0x3F, 0x98, 0x55, 0xB3, 0x86, 0xDF,
-    0xB8, 0x4C, 0x4C, 0xD0, 0xC4, 0xC6, 0xEB, 0x82, 0xDA, 0x0C, 0x5E, 0x6B, 0x2A, 0xB3, 0x6D, 0x6C,
-    0x99, 0x02, 0xA1, 0x90, 0xEB, 0x58, 0xBB, 0x61, 0xA2, 0x59, 0xC2, 0x87, 0xAF, 0x98, 0xF3, 0xC6,
-    0x9C, 0x32, 0x8F, 0x61, 0xB7, 0x0F, 0xB1, 0x4A, 0x24, 0x6F, 0x4F, 0x05, 0xBD, 0xC7, 0xCD, 0x91,
-    0x3F, 0x49, 0x89, 0x4D, 0x40, 0xCC, 0x4D, 0x45, 0xD8, 0x12, 0xEE, 0x06, 0xFF, 0xC5, 0xDD, 0x6D,
-    0x12, 0x21, 0xF9, 0x26, 0x30, 0x0F, 0x5A, 0x12, 0x61, 0x3B, 0x04, 0xE6, 0x49, 0xBE, 0x86, 0xE3,
-    0x0E, 0xE8, 0x02, 0x92, 0x8C, 0xCF, 0x63, 0x17, 0xFF, 0xB1, 0x5B, 0x11, 0xA2, 0x84, 0x98, 0x07,
-    0x42, 0x84, 0x6A, 0x7D, 0xBD, 0x28, 0x93, 0xDA, 0x04, 0x93, 0x60, 0x42, 0xCC, 0x2B, 0x5D, 0x28,
-    0x32, 0xA1, 0x09, 0xEA, 0xA0, 0x34, 0x3B, 0xDF, 0xAE, 0x4D, 0x4C, 0x72, 0x57, 0xF9, 0x7E, 0x98,
-    0xFC, 0xD9, 0x19, 0x03, 0xF4, 0x4C, 0xD8, 0xA6, 0x75, 0xD0, 0x04, 0x6D, 0xD0, 0x98, 0x89, 0xD7,
-    0x81, 0x1C, 0x9D, 0x49, 0xCC, 0x8A, 0x89, 0xEB, 0xD3, 0x26, 0xEA, 0xA2, 0x3A, 0x9E, 0xF8, 0xD6,
-    0xCE, 0x40, 0x31, 0x9B, 0xC7, 0xF6, 0xE3, 0xDA, 0x54, 0xFF, 0xD9, 0xCD, 0x31, 0x12, 0x3A, 0x13,
-    0x21, 0xE1, 0xA7, 0xE0, 0x23, 0xEC, 0x14, 0x74, 0x84, 0x9B, 0xC4, 0x46, 0x98, 0x29, 0xC8, 0x08,
-    0x2F, 0x05, 0x17, 0x61, 0x25, 0x51, 0x11, 0x4E, 0x0A, 0x26, 0xC2, 0x48, 0x41, 0x44, 0xF8, 0xE8,
-    0xF0, 0x30, 0x21, 0xC1, 0x3E, 0xCB, 0x25, 0x5F, 0xE3, 0xE6, 0x06, 0x37, 0x05, 0xCF, 0x9D, 0x58,
-    0xA0, 0x91, 0xD8, 0x41, 0xD8, 0xD9, 0x9B, 0x09, 0xB1, 0x00, 0x63, 0x7A, 0x72, 0x33, 0xC6, 0x22,
-    0x44, 0x22, 0x35, 0x59, 0x4B, 0x66, 0x82, 0x6A, 0x0D, 0x71, 0xF0, 0xED, 0x3F, 0x02, 0xC8, 0x4B,
-    0x78, 0x98, 0x02, 0x7B, 0x87, 0x0C, 0x9C, 0x53, 0xE5, 0x19, 0x6E, 0x02, 0x22, 0x67, 0x04, 0x4F,
-    0x59, 0x39, 0xAC, 0xCD, 0xA7, 0xF8, 0xF1, 0x2A, 0x30, 0x00, 0xC4, 0xAA, 0xB9, 0xE9, 0x8D, 0xB1,
-    0x0D, 0x49, 0xC4, 0x4D, 0xDC, 0xCD, 0xD9, 0x5F, 0x70, 0x13, 0xF3, 0xA4, 0x2F, 0xC7, 0x19, 0x51,
-    0x09, 0x65, 0xA9, 0x4A, 0x2E, 0x89, 0x28, 0xE1, 0xD1, 0x63, 0xE0, 0xDA, 0x07, 0x17, 0x6B, 0x08,
-    0x9F, 0x9D, 0xA8, 0xD0, 0x53, 0xDE, 0xA1, 0x0A, 0xD8, 0x95, 0x65, 0xAE, 0x2C, 0x56, 0x06, 0x65,
-    0x20, 0xB9, 0x60, 0x9A, 0xF1, 0x29, 0x3C, 0xF7, 0x40, 0xF6, 0xD4, 0x0C, 0x0F, 0x40, 0x85, 0x9A,
-    0xDC, 0xC7, 0xEB, 0x63, 0x60, 0xB7, 0x41, 0x71, 0xC3, 0x2E, 0x56, 0x5F, 0x55, 0xF5, 0x0C, 0x79,
-    0x05, 0xEF, 0x4F, 0x2C, 0x75, 0xAC, 0x74, 0x4F, 0x0A, 0xF5, 0xCD, 0x54, 0xF4, 0xE6, 0x16, 0x8F,
-    0x5F, 0x27, 0xC9, 0x1A, 0xAF, 0x7C, 0xE4, 0x88, 0x40, 0xC6, 0x45, 0x78, 0x65, 0x08, 0x60, 0x83,
-    0xB7, 0x21, 0x70, 0x65, 0xB4, 0x8F, 0x00, 0x26, 0x05, 0x52, 0xA0, 0x80, 0x49, 0x4B, 0x25, 0x01,
-    0x99, 0x4A, 0x1A, 0x40, 0x6A, 0x84, 0x08, 0x22, 0xD2, 0xA4, 0x82, 0xE1, 0xBB, 0x49, 0x06, 0x53,
-    0x4D, 0xE6, 0x6F, 0x08, 0x04, 0xBA, 0x4D, 0x81, 0x8E, 0x0F, 0x79, 0xD3, 0x4F, 0x23, 0x12, 0xE6,
-    0x29, 0x52, 0x32, 0x85, 0x78, 0x62, 0x03, 0xE0, 0x63, 0x3E, 0x15, 0xC8, 0xA3, 0x76, 0x6E, 0x11,
-    0x15, 0x71, 0xA5, 0x31, 0x8F, 0x83, 0x7E, 0x4E, 0xA3, 0x48, 0x2E, 0x09, 0x37, 0xF8, 0x68, 0x6E,
-    0xEC, 0xEC, 0x87, 0x03, 0x68, 0x62, 0x71, 0x4A, 0x0C, 0x41, 0x60, 0x15, 0x58, 0x42, 0x9B, 0xDA,
-    0xBD, 0xE5, 0xA5, 0x69, 0x36, 0xB1, 0x2E, 0x30, 0x2F, 0x96, 0xB8, 0x75, 0xC2, 0x96, 0x91, 0x6D,
-    0xE3, 0xFE, 0xF1, 0xA8, 0x25, 0xF6, 0x50, 0x78, 0x33, 0x11, 0xF4, 0x21, 0x0A, 0xD4, 0x55, 0xDC,
-    0x9E, 0xD9, 0x3A, 0x04, 0xC4, 0xE9, 0xCC, 0x3D, 0x61, 0xBE, 0x80, 0xED, 0x4A, 0xC8, 0x97, 0x7C,
-    0xDC, 0xCC, 0xE1, 0x5D, 0x31, 0x8F, 0xB2, 0x4E, 0x1C, 0x33, 0x4F, 0x98, 0x18, 0xC6, 0x22, 0x78,
-    0xB7, 0x54, 0x56, 0xF5, 0xF7, 0x1A, 0x68, 0x90, 0x42, 0x84, 0xC2, 0x3E, 0x6F, 0xA8, 0x16, 0x94,
-    0x05, 0xCA, 0x04, 0x65, 0x83, 0x7A, 0xC1, 0x5F, 0x8A, 0x44, 0xD2, 0xAA, 0x62, 0x90, 0x26, 0xCB,
-    0x12, 0x41, 0xEC, 0x1A, 0xEA, 0x47, 0xF4, 0x4D, 0x72, 0x2D, 0x6B, 0xE7, 0x7E, 0xEE, 0xE4, 0x61,
-    0x94, 0x58, 0xBF, 0x40, 0x11, 0x83, 0x25, 0x35, 0x62, 0x4F, 0x09, 0xF8, 0x04, 0x6B, 0x7A, 0x55,
-    0x63, 0x2E, 0x53, 0x1A, 0xE2, 0x9A, 0x28, 0xD3, 0x8F, 0xE5, 0x58, 0x35, 0x98, 0xF8, 0xBD, 0xB8,
-    0x34, 0x43, 0xC3, 0x4E, 0x97, 0x96, 0x6F, 0x92, 0x26, 0x94, 0x70, 0xCB, 0xBB, 0x92, 0x16, 0x0F,
-    0x44, 0x53, 0x6F, 0x6F, 0x7D, 0xCB, 0xD6, 0x90, 0x2D, 0xDB, 0x51, 0x14, 0x06, 0xF1, 0x89, 0x34,
-    0xEB, 0x20, 0x8D, 0xB5, 0x1F, 0xB8, 0xB5, 0x95, 0x57, 0xDB, 0xB2, 0xED, 0xC5, 0xA2, 0x75, 0x3C,
-    0xE5, 0x77, 0x1B, 0xE4, 0x41, 0x7B, 0xD3, 0x98, 0xEF, 0x06, 0x35, 0x1C, 0x8C, 0x7D, 0xB7, 0x3E,
-    0x0F, 0x18, 0x3F, 0x04, 0xD6, 0x9B, 0xBE, 0xA5, 0x1B, 0xA6, 0x98, 0xC2, 0xA4, 0xCE, 0x84, 0x34,
-    0x53, 0x12, 0x85, 0x32, 0x15, 0x8B, 0x1D, 0x49, 0xF2, 0x10, 0x30, 0x26, 0x4D, 0xDA, 0x8D, 0x12,
-    0x18, 0xCB, 0xD6, 0x05, 0x02, 0xD5, 0x7B, 0xCD, 0x82, 0x50, 0xEB, 0xE7, 0x47, 0xEC, 0x29, 0xB7,
-    0xA5, 0xC8, 0x6D, 0x09, 0x52, 0x9F, 0x00, 0x9C, 0x82, 0xBE, 0x2F, 0xD2, 0x0A, 0x9C, 0x20, 0xFD,
-    0x6B, 0x94, 0x06, 0x8F, 0xF8, 0xBF, 0xB1, 0x75, 0xFB, 0x8A, 0x99, 0x01, 0xBD, 0x32, 0xE8, 0x89,
-    0x5D, 0xD2, 0x90, 0x00, 0x15, 0xFD, 0x60, 0x38, 0x90, 0x0C, 0x55, 0x13, 0xFE, 0x66, 0xBD, 0xB2,
-    0x46, 0x28, 0x40, 0xB9, 0x50, 0xB7, 0x48, 0x33, 0x66, 0xA7, 0xE6, 0x20, 0x09, 0x7C, 0x91, 0x29,
-    0x32, 0xD6, 0xC8, 0xE5, 0x40, 0xE0, 0x3D, 0xB9, 0x75, 0x3B, 0x37, 0x27, 0xAE, 0xF0, 0x0E, 0xFB,
-    0x3B, 0xC1, 0x05, 0x04, 0xF0, 0x26, 0x0C, 0x54, 0x92, 0x9C, 0x62, 0x8A, 0x48, 0xA3, 0x74, 0xF8,
-    0xAF, 0x8A, 0x5C, 0xF6, 0x34, 0x22, 0x61, 0x43, 0xC1, 0x52, 0xF4, 0x0B, 0x4A, 0xB8, 0x11, 0x29,
-    0x34, 0xE4, 0xEB, 0x7E, 0xEC, 0xF5, 0xE7, 0x8F, 0xAA, 0x29, 0x6F, 0x3C, 0xDC, 0x6E, 0x44, 0x7C,
-    0x2A, 0x56, 0xC0, 0x81, 0xB2, 0xF8, 0xA3, 0x8C, 0x9B, 0xB5, 0x39, 0xE7, 0x44, 0x35, 0x48, 0x5A,
-    0x48, 0x7B, 0xA3, 0x3A, 0x25, 0x46, 0x89, 0xF1, 0x82, 0x58, 0x3E, 0x52, 0xCF, 0x6D, 0xD2, 0x37,
-    0x41, 0x70, 0x51, 0x0D, 0xD9, 0x14, 0xDC, 0x54, 0x8B, 0x48, 0x88, 0xA0, 0x04, 0xD6, 0x36, 0x47,
-    0x69, 0x6D, 0x05, 0x01, 0xA8, 0x2A, 0x0A, 0xDD, 0x39, 0x13, 0x95, 0x7E, 0x0D, 0xAF, 0xB2, 0x61,
-    0xD6, 0x20, 0x68, 0x11, 0x99, 0xB0, 0x07, 0x49, 0x8E, 0x8D, 0x48, 0x07, 0xF0, 0xE7, 0x72, 0xF6,
-    0xCD, 0xBF, 0x24, 0x06, 0xB5, 0x5A, 0xBA, 0x8B, 0x62, 0x86, 0x9E, 0xC6, 0x3F, 0x78, 0x4F, 0x50,
-    0x35, 0xF9, 0x61, 0x4F, 0xD1, 0x68, 0xE8, 0xAB, 0xCD, 0x43, 0xC6, 0xBE, 0x84, 0x0D, 0x7D, 0x06,
-    0x90, 0x79, 0x5D, 0x04, 0xF1, 0xA3, 0x9C, 0x66, 0xFD, 0x7D, 0x43, 0xB7, 0x08, 0xCC, 0x8C, 0xEE,
-    0x42, 0x37, 0x7A, 0x04, 0x05, 0xB7, 0xCC, 0x19, 0xF3, 0x1C, 0x24, 0x21, 0xB8, 0x0D, 0x3C, 0xF1,
-    0xC6, 0x3A, 0x7E, 0x33, 0xD7, 0x38, 0x21, 0xC1, 0x5F, 0x6A, 0x86, 0x89, 0xF7, 0x5E, 0x6C, 0x70,
-    0x69, 0x50, 0x10, 0x4F, 0x2C, 0x39, 0xA8, 0xED, 0xD1, 0x8B, 0x88, 0x91, 0xB7, 0x87, 0xAE, 0xC6,
-    0x28, 0xC5, 0xA8, 0x06, 0xDF, 0x79, 0x4B, 0xE9, 0x20, 0x91, 0x62, 0x3B, 0xC6, 0x28, 0x72, 0x44,
-    0xD5, 0x49, 0x28, 0x48, 0x95, 0xED, 0xF4, 0x95, 0x12, 0x8D, 0xED, 0x8C, 0x0B, 0x08, 0x11, 0x76,
-    0xD7, 0xD7, 0x45, 0x15, 0x48, 0xD7, 0x41, 0x68, 0x00, 0x88, 0xEC, 0x18, 0xC8, 0x90, 0x77, 0xBC,
-    0x97, 0xD2, 0x1C, 0x77, 0x47, 0x4A, 0x01, 0x31, 0xA7, 0x10, 0x00, 0x71, 0xCA, 0x00, 0xF1, 0xA6,
-    0x08, 0x10, 0xED, 0xD8, 0x61, 0x4D, 0x01, 0x20, 0xD2, 0xE4, 0xBF, 0xE0, 0x7C, 0x71, 0xEF, 0xF3,
-    0x43, 0xC6, 0xE7, 0xC5, 0x33, 0x7C, 0x57, 0x33, 0x7A, 0x13, 0xEF, 0xEA, 0x83, 0x02, 0x7F, 0xCA,
-    0x68, 0x70, 0x48, 0x81, 0xAD, 0x9D, 0xA7, 0xFF, 0xF2, 0x9C, 0x2A, 0x1D, 0x83, 0xC3, 0xEE, 0x26,
-    0x63, 0xDE, 0xD1, 0xA2, 0xF8, 0x47, 0xD0, 0x8F, 0x66, 0x4B, 0xAC, 0x16, 0x85, 0x7A, 0xCE, 0x7E,
-    0xFA, 0x97, 0xA5, 0x23, 0xDA, 0xC4, 0x02, 0xAE, 0x51, 0x96, 0x17, 0x64, 0x19, 0x64, 0xD0, 0xFA,
-    0xEB, 0x11, 0xF5, 0xC0, 0xDF, 0x5B, 0x5F, 0x57, 0xD4, 0x29, 0xD0, 0xF4, 0x76, 0xD4, 0x44, 0xAE,
-    0xEF, 0xE1, 0x9F, 0xB9, 0x09, 0x2F, 0x14, 0xBD, 0x90, 0xAB, 0x50, 0x25, 0x72, 0xF6, 0x88, 0x1F,
-    0x2A, 0x20, 0xC9, 0x12, 0x37, 0xA7, 0x44, 0xB1, 0xA3, 0x12, 0x39, 0x0F, 0xE8, 0x42, 0x6A, 0x8A,
-    0x5E, 0xAF, 0x38, 0xC2, 0x88, 0xF7, 0xA5, 0x5A, 0x83, 0x89, 0x0A, 0xDA, 0x53, 0xB3, 0x7C, 0x11,
-    0x1A, 0x6B, 0x1C, 0xC4, 0x80, 0x90, 0x7E, 0x03, 0x51, 0xB9, 0x77, 0xC0, 0x96, 0x3C, 0x21, 0xE6,
-    0x1E, 0xC6, 0x3D, 0xA5, 0xDB, 0x8F, 0x67, 0xB9, 0x97, 0xBB, 0xB0, 0x87, 0x6F, 0xA1, 0x4B, 0x75,
-    0xBE, 0x5F, 0x7C, 0xBD, 0x86, 0x39, 0x33, 0x17, 0x06, 0x7C, 0x97, 0x3E, 0x26, 0xB4, 0x3D, 0xF4,
-    0xE4, 0x59, 0xFB, 0x75, 0xBA, 0x9B, 0xAB, 0xD8, 0x05, 0xA0, 0x96, 0xD4, 0x48, 0xED, 0xB5, 0xAA,
-    0x25, 0x09, 0x66, 0x12, 0x07, 0x35, 0xEA, 0x48, 0xCD, 0x45, 0xFB, 0x6B, 0x41, 0x70, 0x6E, 0x09,
-    0xFE, 0x99, 0xB1, 0xE0, 0xF3, 0x58, 0xE8, 0x6B, 0xE6, 0xEA, 0xB2, 0x86, 0xD5, 0x57, 0x61, 0x6E,
-    0x7E, 0x59, 0x9B, 0xDD, 0xAD, 0x19, 0x34, 0x39, 0xE9, 0x61, 0xD2, 0xB3, 0x1A, 0x39, 0x1F, 0x5E,
-    0x47, 0xDF, 0xB3, 0x42, 0x99, 0xE0, 0x91, 0x5C, 0x8B, 0x89, 0x79, 0x36, 0xB2, 0xC8, 0x14, 0xFF,
-    0x30, 0xF2, 0x07, 0xF4, 0x39, 0xE1, 0x31, 0xA0, 0x04, 0x4F, 0x3C, 0xD5, 0x74, 0x5A, 0xFD, 0x0B,
-    0xAA, 0x5C, 0xB4, 0x32, 0x10, 0xCB, 0x33, 0x8C, 0xC7, 0x23, 0x86, 0x12, 0xE2, 0x10, 0x8B, 0xFE,
-    0xE8, 0x2C, 0xF1, 0x61, 0xD1, 0xAB, 0xC5, 0xBF, 0x53, 0x04, 0x74, 0xEF, 0x65, 0x28, 0x0C, 0xC1,
-    0x4C, 0x0E, 0x4D, 0xE2, 0xA3, 0xEE, 0xAB, 0x42, 0x36, 0xFF, 0x0E, 0x22, 0xA0, 0x0D, 0x0F, 0xB9,
-    0x20, 0x3C, 0xA3, 0x50, 0x0D, 0x99, 0x62, 0x13, 0xD4, 0x80, 0xE0, 0x1C, 0xBC, 0xA4, 0x10, 0x0D,
-    0x0B, 0x68, 0x0C, 0x20, 0x6A, 0x2D, 0x34, 0x93, 0xB8, 0xA8, 0x00, 0x61, 0x8A, 0x56, 0x48, 0xC6,
-    0xBC, 0x13, 0x20, 0x40, 0x96, 0x9E, 0x5C, 0x5E, 0x65, 0x7B, 0x6E, 0xF8, 0xC5, 0x46, 0x1E, 0x6A,
-    0x98, 0x3C, 0x4A, 0x27, 0xF1, 0x10, 0x4A, 0x65, 0x7B, 0xE6, 0xB8, 0xC6, 0x93, 0xB2, 0x11, 0xE0,
-    0x35, 0xB2, 0xEC, 0xE7, 0xE1, 0xE4, 0x4C, 0xE9, 0xE6, 0xFD, 0x98, 0xAC, 0x2D, 0xEC, 0xB7, 0x3A,
-    0x73, 0xD2, 0xFE, 0x9B, 0x90, 0xA9, 0x62, 0x58, 0x93, 0xD1, 0xEC, 0x44, 0xF6, 0xF6, 0xD6, 0x44,
-    0xA9, 0x94, 0x8D, 0x41, 0x44, 0x89, 0xE8, 0x5D, 0x6D, 0x19, 0xA1, 0x67, 0xDA, 0x20, 0x2F, 0x3D,
-    0x98, 0x47, 0x3B, 0x65, 0xF7, 0x11, 0x91, 0x4F, 0xB7, 0x4D, 0x7A, 0xDD, 0x2A, 0x15, 0x18, 0x3A,
-    0x9D, 0x46, 0xAE, 0x10, 0x30, 0x6E, 0xA0, 0x54, 0x05, 0x65, 0xA0, 0xA4, 0x0B, 0xD4, 0x33, 0xCD,
-    0xD4, 0x95, 0x85, 0x7B, 0xDB, 0x63, 0xEE, 0xD1, 0x99, 0x2F, 0x85, 0x33, 0x92, 0x4E, 0x0B, 0x14,
-    0x22, 0x52, 0xDE, 0xF9, 0x87, 0x87, 0xF6, 0x61, 0x3F, 0xE2, 0xB7, 0x84, 0x04, 0x92, 0xBB, 0x24,
-    0xF3, 0x50, 0x9E, 0xB1, 0xA0, 0x09, 0x26, 0x07, 0xA2, 0x08, 0x5E, 0x62, 0x4E, 0x21, 0x0C, 0x55,
-    0xF2, 0x8D, 0x4F, 0x7D, 0x4E, 0xA2, 0xE5, 0xB5, 0xF3, 0xEC, 0xC2, 0x6C, 0x8A, 0x1E, 0xBD, 0x4E,
-    0x70, 0xCF, 0x99, 0xEF, 0x99, 0x03, 0xD9, 0x92, 0xD1, 0xF8, 0xB3, 0xA3, 0x82, 0xA7, 0x25, 0x2D,
-    0xF0, 0xD4, 0x9D, 0x28, 0xE8, 0x29, 0x48, 0xD5, 0x5D, 0x26, 0x7F, 0x40, 0x03, 0x5A, 0x98, 0x10,
-    0x30, 0x60, 0x03, 0x0C, 0x03, 0x0D, 0xBB, 0x45, 0xCB, 0x6C, 0x1E, 0xCD, 0xE3, 0x70, 0x58, 0xEA,
-    0x6B, 0xD7, 0x90, 0x6F, 0xF5, 0x4C, 0xF9, 0x40, 0x2E, 0xDC, 0x0A, 0xD8, 0x8A, 0x1A, 0xA1, 0x2B,
-    0x0C, 0x71, 0xDA, 0x6A, 0x62, 0xD3, 0x2A, 0x0E, 0xC1, 0x7F, 0x03, 0xCA, 0x6F, 0xD4, 0xD0, 0xC5,
-    0xD7, 0x14, 0xA0, 0x46, 0x93, 0xFA, 0x68, 0x4C, 0x47, 0x70, 0xEE, 0x39, 0x97, 0xA9, 0xAE, 0x7C,
-    0x39, 0x37, 0xBB, 0x12, 0xEF, 0x82, 0x79, 0xF9, 0x00, 0xC8, 0x36, 0x00, 0xE5, 0x25, 0xC4, 0x42,
-    0xB7, 0x22, 0xD6, 0x3E, 0x6A, 0xD3, 0x25, 0xA5, 0xDF, 0xA5, 0x79, 0xD0, 0x66, 0x88, 0x90, 0x0A,
-    0xA0, 0x5F, 0x11, 0x15, 0x5C, 0xF4, 0xA5, 0x88, 0x14, 0x0B, 0xF0, 0x9B, 0x06, 0x49, 0xA0, 0x2F,
-    0xD8, 0xE0, 0xE2, 0x40, 0x32, 0x42, 0x06, 0xFD, 0x41, 0xF0, 0x98, 0x10, 0x0F, 0xDB, 0x44, 0x1F,
-    0xAD, 0xBF, 0x38, 0x25, 0xF7, 0x08, 0xFC, 0xB5, 0x6B, 0x55, 0xC9, 0xDC, 0x62, 0xBA, 0x14, 0x6F,
-    0xD7, 0x81, 0x88, 0x0F, 0xB0, 0x01, 0x9E, 0x4C, 0xC8, 0xEA, 0x80, 0x26, 0xD1, 0x24, 0x1D, 0x63,
-    0x27, 0xC8, 0x00, 0x13, 0xA3, 0x39, 0x32, 0xAF, 0x5F, 0x00, 0x6F, 0x7A, 0x53, 0xFD, 0x38, 0x7F,
-    0x60, 0x64, 0x24, 0x82, 0x88, 0xCC, 0xCA, 0xD5, 0x26, 0xFC, 0xC6, 0xCF, 0xCC, 0x8D, 0xE4, 0x10,
-    0xB5, 0x04, 0xD7, 0x89, 0x27, 0xA0, 0x67, 0xBE, 0x02, 0x34, 0xC9, 0x65, 0x30, 0x13, 0x68, 0x4B,
-    0x0E, 0xB5, 0x38, 0xDF, 0xEB, 0xF9, 0x4E, 0xD4, 0x06, 0xE2, 0xE9, 0x4F, 0x45, 0xC0, 0xC3, 0x41,
-    0xC5, 0x58, 0x94, 0xEA, 0xB1, 0xF0, 0xCF, 0xCF, 0xC4, 0x61, 0x7F, 0xD2, 0x2C, 0xAD, 0x74, 0x53,
-    0xC2, 0xBF, 0x8E, 0x52, 0x06, 0x1C, 0x81, 0x22, 0xD2, 0x04, 0x46, 0x96, 0x39, 0xFD, 0x70, 0x2A,
-    0xC6, 0x6C, 0x53, 0x83, 0x19, 0x8A, 0xE2, 0x75, 0xD6, 0x9F, 0xEC, 0x61, 0xF6, 0x83, 0xF2, 0x59,
-    0xA8, 0xE6, 0x12, 0x38, 0x5A, 0xF9, 0x41, 0xBD, 0x30, 0xED, 0xCE, 0xD2, 0xEE, 0x54, 0xD5, 0x88,
-    0x81, 0x4B, 0xA5, 0xFA, 0x46, 0x65, 0x82, 0x42, 0xD2, 0x3D, 0x24, 0xDD, 0x08, 0xAE, 0x07, 0x9F,
-    0xFD, 0x8E, 0x9D, 0x2D, 0x79, 0xBE, 0x13, 0xB9, 0x70, 0xA0, 0x93, 0xD8, 0xE6, 0xAC, 0xC8, 0x13,
-    0x60, 0x65, 0xBD, 0xA8, 0x97, 0x72, 0x50, 0x2A, 0x7E, 0x33, 0x6C, 0x35, 0xF4, 0x00, 0xD9, 0x00,
-    0x0B, 0xA8, 0x83, 0xC5, 0x40, 0x34, 0xAC, 0x0E, 0xB0, 0x00, 0x24, 0x6E, 0x01, 0x14, 0x00, 0x2F,
-    0x13, 0x78, 0x2B, 0xD2, 0x0B, 0x01, 0x12, 0xEE, 0xC5, 0xFA, 0xA0, 0x16, 0x58, 0x1E, 0xF7, 0x26,
-    0x92, 0xA0, 0x0C, 0x0A, 0xF6, 0xFD, 0x5C, 0xA3, 0x39, 0x09, 0xF6, 0xF0, 0x4E, 0xC0, 0x1B, 0x4E,
-    0xF6, 0x3B, 0x16, 0x09, 0xC6, 0xF0, 0xFF, 0xB4, 0x40, 0xB5, 0x22, 0xB0, 0xDC, 0x22, 0x50, 0x5E,
-    0x47, 0x61, 0xE5, 0xE2, 0x2D, 0x03, 0xFC, 0x58, 0x2E, 0x7E, 0x4D, 0xD8, 0x72, 0xC2, 0xBD, 0xF3,
-    0x32, 0xE9, 0xE1, 0x0D, 0xCE, 0x35, 0x1E, 0xA0, 0x27, 0x48, 0x94, 0xEE, 0x87, 0x76, 0xD7, 0x41,
-    0xE1, 0xD0, 0xEA, 0x05, 0xAD, 0x8E, 0x2A, 0x0D, 0x1A, 0xA6, 0x0D, 0xDF, 0x5C, 0xD4, 0x4A, 0x40,
-    0xBF, 0x89, 0xCD, 0x8A, 0x07, 0xE7, 0xBD, 0xC2, 0x4C, 0x61, 0x15, 0x9B, 0x3A, 0x43, 0x4A, 0xD8,
-    0x48, 0x66, 0x3A, 0xA8, 0x35, 0x48, 0x6B, 0xA0, 0x93, 0x96, 0x21, 0xA3, 0xCC, 0x88, 0x6A, 0x85,
-    0x17, 0x15, 0xA4, 0xD0, 0x2E, 0x17, 0x86, 0x09, 0x28, 0x71, 0x67, 0xC6, 0x54, 0xB9, 0xE0, 0x62,
-    0xBB, 0xDC, 0x4C, 0xB1, 0x26, 0xCE, 0x46, 0x1D, 0xCE, 0xC2, 0x37, 0xF4, 0x58, 0x19, 0xCF, 0xA7,
-    0x0D, 0xA8, 0x9B, 0xD5, 0x00, 0xBA, 0xA8, 0x13, 0x42, 0x90, 0x95, 0xCE, 0xCA, 0xFE, 0x88, 0x59,
-    0x38, 0x6D, 0x1D, 0xEB, 0x77, 0x30, 0x7D, 0xD4, 0xA3, 0x3B, 0x66, 0x8C, 0x71, 0x88, 0x54, 0xD8,
-    0x48, 0xDD, 0x37, 0x87, 0x0F, 0x90, 0x04, 0xE4, 0x50, 0xAF, 0x09, 0x31, 0x3D, 0x99, 0x6B, 0x89,
-    0x10, 0x74, 0x04, 0x65, 0x2F, 0xD1, 0xB0, 0x30, 0x58, 0x5A, 0x75, 0x27, 0x36, 0xE4, 0x44, 0x2B,
-    0x27, 0x24, 0xA7, 0xD1, 0x13, 0x9D, 0x9C, 0x10, 0xB9, 0x61, 0xFD, 0x41, 0xAC, 0xE2, 0xAA, 0x99,
-    0x57, 0x47, 0x23, 0x61, 0x04, 0xC5, 0xDB, 0xBB, 0xA8, 0xD1, 0x2C, 0x85, 0xBB, 0x5A, 0x0E, 0x21,
-    0xCE, 0xCE, 0xA1, 0x8D, 0x78, 0x9F, 0x84, 0x64, 0x41, 0xBE, 0x28, 0x91, 0xFC, 0x64, 0x5E, 0xE6,
-    0x11, 0xA4, 0xE3, 0x79, 0x85, 0xC9, 0x9F, 0xCC, 0xCB, 0x62, 0xC5, 0x22, 0x24, 0x58, 0x5C, 0x1E,
-    0xE6, 0x97, 0x25, 0x62, 0x90, 0x44, 0x54, 0x4A, 0x73, 0x12, 0x57, 0x2B, 0x2D, 0x76, 0x0F, 0x5C,
-    0xC6, 0xD3, 0xC7, 0x12, 0x29, 0x51, 0xD0, 0xB5, 0x32, 0x59, 0x35, 0x15, 0x37, 0x92, 0x04, 0x7A,
-    0x4B, 0xE5, 0x54, 0x87, 0x14, 0xD1, 0x61, 0x31, 0x51, 0x63, 0xA4, 0xA5, 0x20, 0x44, 0x20, 0x68,
-    0x9D, 0x99, 0xD6, 0xFA, 0xB0, 0xD0, 0x42, 0x6A, 0x0B, 0x34, 0xD5, 0x94, 0x67, 0x47, 0x2A, 0x29,
-    0x3D, 0x6C, 0x38, 0x36, 0x28, 0xE1, 0x16, 0xCF, 0xCB, 0xA3, 0x04, 0x8E, 0x95, 0x10, 0xAD, 0xB9,
-    0x65, 0xBF, 0x5E, 0xC4, 0xEB, 0x3D, 0x44, 0x1B, 0x6E, 0x9A, 0x1A, 0x08, 0xFC, 0xA3, 0x06, 0x94,
-    0x88, 0xDF, 0x66, 0xD9, 0xE1, 0x5F, 0x00, 0x71, 0xFA, 0x02, 0x4D, 0x05, 0xC9, 0x56, 0xF0, 0x39,
-    0x41, 0x87, 0x59, 0xAE, 0xC7, 0x38, 0x2E, 0xD0, 0x52, 0x0C, 0x0D, 0xCA, 0xC7, 0xB8, 0x1A, 0xFF,
-    0x0A, 0xEF, 0x4F, 0xDE, 0x66, 0x8E, 0x5E, 0xE3, 0x72, 0x56, 0x56, 0x3D, 0xC8, 0x9A, 0x21, 0x8D,
-    0x85, 0x2D, 0x9F, 0x57, 0x69, 0xC6, 0x30, 0x53, 0x94, 0x54, 0xA2, 0x4C, 0xA1, 0xA8, 0x90, 0x5E,
-    0x8A, 0xEE, 0xAF, 0x38, 0xAE, 0xBB, 0xD2, 0xE1, 0xB6, 0xA4, 0xE8, 0x40, 0x1A, 0x96, 0x3A, 0x68,
-    0x77, 0x4C, 0xBF, 0x63, 0xB6, 0x77, 0xCC, 0xDA, 0x8E, 0x89, 0x07, 0x16, 0x62, 0x03, 0x2C, 0x77,
-    0x77, 0x62, 0x2E, 0x57, 0x79, 0x16, 0x77, 0xF1, 0x3B, 0x36, 0x6C, 0xB3, 0xF7, 0xFB, 0xE8, 0x40,
-    0x05, 0x04, 0x2A, 0x47, 0xDF, 0xD8, 0x92, 0xAD, 0x10, 0x65, 0x7F, 0x70, 0xA1, 0x0B, 0x42, 0xE5,
-    0x63, 0xE6, 0xE6, 0xAA, 0xE9, 0x7A, 0xEF, 0xFD, 0xD6, 0xFF, 0x65, 0x19, 0xFC, 0x87, 0x18, 0x98,
-    0x8E, 0x02, 0x9E, 0x0C, 0x66, 0x75, 0xD7, 0xAC, 0x64, 0xF9, 0xA5, 0xAC, 0xEE, 0x19, 0xFD, 0xB0,
-    0x0E, 0x77, 0x4E, 0x7D, 0xCC, 0x73, 0x8E, 0xBC, 0x4B, 0xDC, 0x3A, 0xAF, 0x01, 0xD6, 0xA0, 0xB2,
-    0xC1, 0xDD, 0x9D, 0x7B, 0x77, 0x6B, 0x11, 0x17, 0xEE, 0xC6, 0x6E, 0xB7, 0xD7, 0xDD, 0x42, 0xB2,
-    0x54, 0xFB, 0x02, 0xDC, 0x3A, 0x32, 0xCF, 0xF7, 0xA5, 0xB6, 0x26, 0x99, 0xE1, 0x25, 0x61, 0x35,
-    0x25, 0x60, 0xFB, 0xA0, 0xC2, 0xDD, 0x92, 0x3C, 0x8F, 0x70, 0xA4, 0x7A, 0xC7, 0x86, 0xBE, 0xAB,
-    0x97, 0x04, 0x2D, 0x10, 0x3D, 0x13, 0xDE, 0x0F, 0x7A, 0x63, 0xAF, 0x37, 0xB2, 0xD0, 0xF7, 0x16,
-    0x42, 0x98, 0xDC, 0x54, 0xFD, 0x52, 0xEB, 0xE8, 0x70, 0x68, 0x0F, 0x00, 0xDE, 0x7F, 0x3A, 0xC0,
-    0xF7, 0x85, 0x72, 0xE1, 0x44, 0xE3, 0xB8, 0x99, 0x72, 0x3B, 0xCB, 0xF7, 0x99, 0x52, 0x30, 0x75,
-    0x95, 0x38, 0x8C, 0x7F, 0x01, 0xE8, 0xFE, 0xBF, 0x35, 0xB8, 0x0F, 0xD0, 0x71, 0x1D, 0x3A, 0x36,
-    0xBB, 0x02, 0xB8, 0xD3, 0xE9, 0xF2, 0xFB, 0xF1, 0xFA, 0x8C, 0xE1, 0x2F, 0xDE, 0x5D, 0xE4, 0x4B,
-    0x6F, 0x66, 0xD1, 0x46, 0x6C, 0x69, 0xAD, 0x48, 0xA5, 0x39, 0xA2, 0x59, 0x68, 0x4C, 0x81, 0xF7,
-    0xEE, 0x40, 0x5F, 0x06, 0x73, 0x0B, 0xFA, 0xDB, 0x4B, 0x55, 0xD6, 0x15, 0x2A, 0xE8, 0x15, 0xE3,
-    0xF1, 0x91, 0x5A, 0xCA, 0xA7, 0x3D, 0x93, 0x61, 0x20, 0xD6, 0x56, 0x5A, 0xCA, 0x7A, 0x5C, 0xD2,
-    0xBF, 0x6D, 0xA4, 0x71, 0xED, 0x86, 0x49, 0xA0, 0x5D, 0xDC, 0x6D, 0x34, 0x23, 0x9E, 0x98, 0xC3,
-    0x76, 0x07, 0x65, 0x05, 0x43, 0x87, 0x6D, 0xC7, 0xFA, 0x0F, 0x24, 0x4F, 0xF3, 0xE5, 0x85, 0x94,
-    0x1B, 0x09, 0x2F, 0x07, 0x67, 0x45, 0x08, 0x6B, 0xD4, 0xB0, 0x8B, 0x15, 0x74, 0xDE, 0x04, 0x92,
-    0xBA, 0x03, 0x24, 0x33, 0xA7, 0xC0, 0x84, 0x50, 0x4C, 0xCF, 0xE0, 0x0C, 0x0F, 0x9D, 0x38, 0xC1,
-    0x0D, 0xB5, 0x26, 0x6A, 0x73, 0x46, 0x4B, 0x84, 0x57, 0x42, 0xF8, 0x31, 0xE1, 0x81, 0xF2, 0x50,
-    0x4C, 0x32, 0x27, 0x48, 0x51, 0x13, 0x97, 0x40, 0x3D, 0xAD, 0xD3, 0x60, 0xF8, 0x7D, 0xC4, 0xE4,
-    0x60, 0x16, 0xB5, 0xD4, 0xD4, 0x8A, 0x5C, 0xD1, 0x47, 0xAB, 0x9F, 0x40, 0x62, 0xDB, 0xD9, 0x16,
-    0x77, 0x43, 0xE6, 0x6E, 0x08, 0xDF, 0x77, 0x6A, 0xB3, 0xB3, 0xE1, 0x9C, 0xE8, 0x87, 0x2A, 0x2F,
-    0xDE, 0x58, 0x29, 0x4C, 0xDD, 0x6A, 0xC1, 0xC8, 0xE5, 0xC2, 0x09, 0x54, 0xE4, 0x2C, 0xFE, 0xBC,
-    0x2B, 0x52, 0xB8, 0x35, 0x13, 0xE7, 0xED, 0x43, 0x3B, 0xBE, 0xCA, 0xAD, 0xB1, 0x59, 0xB8, 0x1B,
-    0xFE, 0x55, 0x2A, 0xB1, 0x20, 0x92, 0x56, 0xA7, 0xBC, 0x21, 0xD1, 0x02, 0x6A, 0xE1, 0xAB, 0xBC,
-    0x26, 0xEE, 0x4D, 0xA1, 0x7B, 0xD0, 0x1B, 0xC5, 0xA8, 0x18, 0x15, 0xC4, 0xC1, 0x70, 0x6F, 0xD1,
-    0x43, 0xF1, 0x5A, 0x9D, 0x1B, 0x6C, 0xE7, 0xAE, 0x96, 0x4E, 0xC4, 0x47, 0x9D, 0x00, 0xE7, 0xFD,
-    0xBB, 0xB3, 0xF3, 0xDE, 0xAB, 0xF6, 0xDF, 0x21, 0x0C, 0x7F, 0xBF, 0x36, 0xD6, 0xCC, 0xC6, 0x97,
-    0x8A, 0x4F, 0x81, 0xC8, 0xCF, 0x51, 0x1B, 0x05, 0xFF, 0x94, 0x6C, 0xD5, 0x59, 0x5C, 0x5A, 0x38,
-    0xCA, 0xE0, 0xC8, 0x5A, 0xEB, 0x05, 0xE3, 0xBF, 0x45, 0xFE, 0x06, 0x12, 0x97, 0x44, 0x03, 0x25,
-    0x3E, 0x66, 0x98, 0x60, 0xE2, 0x19, 0xE9, 0x0A, 0x97, 0x10, 0x33, 0x69, 0x27, 0x21, 0xB2, 0x82,
-    0xF1, 0x4C, 0x95, 0xE5, 0x10, 0xAD, 0x59, 0x56, 0x22, 0xEB, 0x99, 0xA6, 0xE5, 0x2E, 0x4C, 0x66,
-    0x52, 0xC3, 0xD8, 0x0E, 0xC9, 0xDB, 0xB0, 0xBA, 0x93, 0x18, 0x49, 0x5E, 0xD4, 0xC7, 0xBF, 0xC2,
-    0x6B, 0xBA, 0xE8, 0xB7, 0xB0, 0x95, 0x5D, 0x78, 0x17, 0x21, 0x46, 0x1B, 0xD0, 0xEC, 0x37, 0x34,
-    0xC9, 0x45, 0xCD, 0x6D, 0x55, 0xFB, 0xDA, 0xE6, 0x8B, 0x5C, 0x9F, 0x8F, 0xC6, 0x93, 0xBF, 0xFE,
-    0x11, 0x6D, 0xFC, 0xF0, 0xCF, 0x26, 0x5A, 0x0A, 0xB2, 0x7F, 0x47, 0xDF, 0xB1, 0x06, 0xB5, 0x8D,
-    0xCB, 0xB8, 0x0E, 0x9A, 0xB0, 0xF1, 0x7A, 0x08, 0xD7, 0x36, 0x63, 0x1E, 0x5C, 0x48, 0xCA, 0xB4,
-    0x8C, 0x5A, 0xA4, 0x6E, 0x3D, 0x1B, 0x1A, 0xD0, 0x92, 0x62, 0x6E, 0x88, 0x2F, 0x38, 0x4C, 0xA1,
-    0x55, 0xE1, 0x88, 0x29, 0xA4, 0x19, 0x5B, 0x60, 0x9A, 0x8C, 0x98, 0xC6, 0x8A, 0x69, 0xBD, 0x8C,
-    0xA9, 0x01, 0xA6, 0xD5, 0x83, 0x62, 0x3A, 0xC2, 0xE0, 0x1C, 0x9C, 0x0B, 0x95, 0xC4, 0xC5, 0xA9,
-    0x8F, 0xD3, 0xF2, 0x8A, 0x2B, 0xCE, 0xFE, 0x54, 0x83, 0x81, 0xAD, 0x52, 0x4A, 0x93, 0x40, 0x1A,
-    0xA2, 0xC7, 0xB6, 0x0C, 0xFB, 0x31, 0x3D, 0x71, 0x8E, 0x6A, 0xBF, 0x03, 0xFE, 0x5D, 0x52, 0x87,
-    0x2D, 0x51, 0xCE, 0xF2, 0xB8, 0x61, 0x00, 0x58, 0x8D, 0x42, 0xBB, 0xAE, 0xC9, 0x2F, 0x2D, 0x1F,
-    0x83, 0x34, 0x9A, 0x58, 0xDA, 0x30, 0x5A, 0xDC, 0x3F, 0x59, 0x32, 0xC5, 0x7E, 0x2D, 0xE1, 0x50,
-    0x27, 0xE1, 0x41, 0xD1, 0x2C, 0x74, 0xF7, 0x0F, 0x0E, 0xEF, 0xA9, 0x3D, 0x54, 0x2A, 0x7A, 0xB9,
-    0x97, 0x23, 0x3B, 0x2B, 0x4D, 0xF4, 0x83, 0x4F, 0xA8, 0x38, 0x3E, 0x88, 0xBC, 0x3C, 0xE1, 0x82,
-    0x46, 0xB1, 0x59, 0x9B, 0xCE, 0xC2, 0xFA, 0xE7, 0x3F, 0xA1, 0xDB, 0x18, 0xFC, 0xF5, 0x44, 0xEB,
-    0xC8, 0xF1, 0x1E, 0xAC, 0xC2, 0x14, 0x5E, 0x38, 0xCD, 0x23, 0x8E, 0x1B, 0x4C, 0xB0, 0x7A, 0x9C,
-    0x47, 0x0D, 0xB8, 0xC7, 0x35, 0xC9, 0x34, 0x28, 0xDB, 0x26, 0xC2, 0xA0, 0xA8, 0x95, 0xA8, 0x7C,
-    0xCE, 0xB2, 0x87, 0x2E, 0xA4, 0x81, 0x08, 0x5F, 0x28, 0x21, 0x50, 0x2A, 0x1D, 0x05, 0x1D, 0x31,
-    0xD9, 0x1B, 0xCB, 0x84, 0x9F, 0x51, 0x24, 0x29, 0xDF, 0x0C, 0x15, 0x91, 0x55, 0xC4, 0x76, 0x1C,
-    0x59, 0x59, 0x88, 0xA0, 0x18, 0xDF, 0xD8, 0xDE, 0x39, 0xB4, 0xB1, 0x7F, 0x42, 0x1B, 0x7A, 0xAC,
-    0x83, 0x86, 0xF6, 0x45, 0x16, 0xEC, 0x7B, 0x49, 0x96, 0x4A, 0x26, 0x4E, 0x96, 0x1A, 0xC4, 0xA8,
-    0x4D, 0xF2, 0x19, 0xD0, 0x88, 0x96, 0x1A, 0x6E, 0x4C, 0x9C, 0x35, 0x79, 0x18, 0xD7, 0xD2, 0x46,
-    0x2D, 0x99, 0xBE, 0x66, 0x39, 0xB7, 0x15, 0xB3, 0x2D, 0x38, 0x91, 0x74, 0xBA, 0x5E, 0x0D, 0x32,
-    0xCC, 0x22, 0xA5, 0x56, 0xAC, 0x12, 0x49, 0x01, 0xCA, 0x57, 0x9F, 0x90, 0x2E, 0x75, 0x4F, 0xBC,
-    0x57, 0xAA, 0x5A, 0xBA, 0x67, 0xDE, 0xA1, 0xE5, 0x37, 0xF3, 0xEC, 0x44, 0x7B, 0xF6, 0xD1, 0x47,
-    0x2F, 0xD7, 0x30, 0xD4, 0x1B, 0x60, 0x38, 0x04, 0x8D, 0x81, 0x0B, 0xB8, 0x58, 0xC3, 0xC9, 0x0E,
-    0x30, 0xF0, 0x49, 0x9E, 0x30, 0x5D, 0xB3, 0x1F, 0x4E, 0x4D, 0xAC, 0xCD, 0x63, 0xE6, 0xCE, 0x57,
-    0xB4, 0xAE, 0xED, 0xB3, 0xC0, 0x57, 0x8B, 0x21, 0xFC, 0xCD, 0xA6, 0xB8, 0x2A, 0x21, 0x51, 0x51,
-    0xDE, 0x47, 0xE0, 0x1E, 0x05, 0xC2, 0xB0, 0xD8, 0xCC, 0x5A, 0xB3, 0x94, 0x9A, 0xA5, 0xD2, 0x5C,
-    0xDC, 0xBF, 0xA5, 0xF5, 0xA0, 0xA4, 0x02, 0x07, 0x9E, 0x14, 0x3F, 0x28, 0x55, 0x03, 0xAD, 0x93,
-    0x31, 0x00, 0xC8, 0xCD, 0xB1, 0x47, 0x95, 0x48, 0xC6, 0x95, 0x71, 0xA3, 0x5A, 0x8A, 0x7C, 0xEC,
-    0x34, 0x37, 0xF0, 0xBC, 0xC7, 0xF3, 0xFB, 0x59, 0x93, 0x67, 0x25, 0x0C, 0x91, 0xD1, 0xA9, 0xF5,
-    0x81, 0xC5, 0x86, 0xC4, 0x08, 0xA9, 0xF8, 0xB7, 0x67, 0xA4, 0xB0, 0xC1, 0x83, 0xCC, 0x08, 0xB5,
-    0x60, 0x4C, 0x60, 0x41, 0xE2, 0x19, 0xC8, 0xA4, 0x9D, 0xD5, 0x4C, 0x1B, 0x9E, 0xB9, 0x52, 0xE0,
-    0xE7, 0xD7, 0xAE, 0xCF, 0xA4, 0x23, 0x44, 0xD8, 0x48, 0x05, 0x06, 0x39, 0xA4, 0x43, 0xA3, 0x95,
-    0x54, 0xA9, 0x88, 0x5A, 0xF5, 0x45, 0xD2, 0x56, 0x6E, 0xD5, 0x65, 0xA4, 0xAD, 0x46, 0x3E, 0xBC,
-    0x8F, 0x34, 0x2E, 0xD8, 0x28, 0x25, 0x44, 0xC4, 0x59, 0x5A, 0xCE, 0x1C, 0xA8, 0x32, 0x9E, 0x8C,
-    0x99, 0x10, 0x75, 0xF5, 0x64, 0xC1, 0x4C, 0xA3, 0x35, 0x99, 0x33, 0x63, 0xAD, 0x6E, 0x6F, 0xFD,
-    0xBC, 0x50, 0x8A, 0xA5, 0xC9, 0xC8, 0xFD, 0xF5, 0xDD, 0x5F, 0x73, 0xD1, 0x56, 0x1A, 0x73, 0x61,
-    0x6D, 0xC4, 0x22, 0x27, 0x67, 0x4C, 0x8A, 0x3D, 0x6B, 0x93, 0x66, 0xC5, 0xA4, 0xBF, 0x80, 0x34,
-    0xBD, 0x06, 0x31, 0x29, 0x72, 0xAF, 0x05, 0xCE, 0xD3, 0x57, 0x6D, 0xB9, 0x41, 0x14, 0x67, 0x88,
-    0x4E, 0x93, 0x9F, 0x5E, 0x60, 0xFC, 0x3A, 0x48, 0x7E, 0x1B, 0x68, 0x21, 0x93, 0xFE, 0x2B, 0xC0,
-    0x0B, 0x3F, 0x7A, 0xA9, 0x04, 0x53, 0x2A, 0x4B, 0xF9, 0xE9, 0xD9, 0x3D, 0x41, 0xDE, 0xA7, 0x46,
-    0x4C, 0xBB, 0x76, 0xCF, 0x8C, 0xB1, 0x51, 0xEC, 0xF2, 0xA5, 0xA5, 0x51, 0x09, 0xEA, 0x20, 0x79,
-    0x98, 0x52, 0x66, 0x38, 0x14, 0x11, 0x50, 0x50, 0x9F, 0x23, 0xB9, 0x81, 0x93, 0x91, 0x9A, 0x70,
-    0x42, 0x29, 0x98, 0x6D, 0xCD, 0x94, 0xDC, 0x9C, 0x00, 0x33, 0x44, 0x46, 0xC6, 0xE0, 0x12, 0xCE,
-    0x99, 0xD1, 0x44, 0x07, 0xAC, 0xBD, 0x24, 0x0D, 0x8C, 0x79, 0x95, 0xC7, 0x1D, 0xFE, 0x14, 0x75,
-    0xD2, 0x81, 0x48, 0x55, 0x19, 0x0F, 0x1A, 0xAC, 0xC5, 0x52, 0x82, 0x82, 0xF4, 0x07, 0xF3, 0x19,
-    0xAF, 0xEE, 0x67, 0x66, 0x93, 0x13, 0x05, 0x75, 0x2C, 0x15, 0x22, 0x0A, 0xB8, 0xD4, 0x46, 0xE1,
-    0x4C, 0x28, 0x36, 0xA1, 0x14, 0x7C, 0xD9, 0xFD, 0x93, 0x4A, 0x91, 0x24, 0xCD, 0x31, 0x03, 0xFA,
-    0x8A, 0x03, 0x1D, 0x5C, 0x39, 0x36, 0x61, 0x03, 0x8C, 0xE2, 0x1C, 0xF0, 0x6E, 0xF0, 0x88, 0xD5,
-    0x94, 0x2A, 0x0F, 0x58, 0xE0, 0x16, 0x65, 0x62, 0x75, 0x5F, 0xBA, 0x00, 0x71, 0xEB, 0x6A, 0x46,
-    0x81, 0xB8, 0xA5, 0x16, 0x78, 0x15, 0x00, 0xD4, 0x67, 0xB9, 0x38, 0xEE, 0xB0, 0x46, 0x51, 0x47,
-    0x83, 0x3F, 0x33, 0xD9, 0xE1, 0x2D, 0xDA, 0x27, 0x73, 0x17, 0xAC, 0x48, 0x38, 0x23, 0x05, 0xF9,
-    0xE9, 0x98, 0xB8, 0x33, 0x34, 0xF7, 0xA4, 0xB8, 0x12, 0xBC, 0x73, 0xC3, 0x24, 0xB0, 0x9E, 0x95,
-    0x95, 0xC0, 0xFD, 0x40, 0xEA, 0xB8, 0xB3, 0x28, 0x28, 0x5A, 0x99, 0xAA, 0x10, 0x99, 0x3B, 0xA2,
-    0x7D, 0x38, 0xD5, 0x98, 0xA9, 0x70, 0xE5, 0xC6, 0x66, 0x9E, 0x39, 0xCE, 0x23, 0x99, 0x10, 0xAF,
-    0xFB, 0x39, 0x13, 0x1E, 0x4A, 0x20, 0x27, 0x00, 0xF7, 0x4F, 0xC3, 0x7C, 0x5E, 0xD4, 0x62, 0x85,
-    0xE9, 0xD2, 0x69, 0xCA, 0x1C, 0x79, 0xF7, 0x8C, 0xF9, 0x6C, 0xBC, 0xC5, 0xCF, 0x63, 0x42, 0xC1,
-    0x7A, 0x5E, 0xBD, 0x39, 0xBD, 0x38, 0xBE, 0xDF, 0xD4, 0x13, 0xF4, 0x5E, 0x07, 0x9E, 0x2A, 0xB6,
-    0x23, 0x20, 0xF7, 0x8F, 0xBB, 0xDE, 0xC8, 0xE6, 0xA2, 0x78, 0xA7, 0xD5, 0xBA, 0x3D, 0x6D, 0x15,
-    0x97, 0xA3, 0x0F, 0x3E, 0x61, 0x25, 0xCA, 0x92, 0x8A, 0x8E, 0x29, 0xA4, 0xA7, 0xA3, 0x45, 0xB5,
-    0x1E, 0x06, 0x36, 0xD1, 0x49, 0x17, 0xF6, 0xAB, 0x2D, 0xE7, 0x32, 0x75, 0x30, 0x13, 0x8B, 0x55,
-    0xCB, 0x2D, 0x1B, 0xEA, 0xD7, 0x69, 0xD5, 0x2E, 0xD6, 0xA3, 0x6E, 0xDD, 0x9B, 0x18, 0xCD, 0x4A,
-    0x9F, 0x45, 0x7C, 0x1D, 0x5E, 0x20, 0x36, 0xB4, 0x3B, 0xC9, 0x94, 0x93, 0x18, 0x9A, 0xBC, 0x7A,
-    0x13, 0xEF, 0xCE, 0x56, 0x83, 0xB5, 0x3C, 0xCE, 0x68, 0x56, 0x5A, 0x90, 0xD1, 0xDE, 0xAF, 0xD4,
-    0xD4, 0x12, 0xED, 0xFD, 0x72, 0x1A, 0xF3, 0xEA, 0x81, 0xDE, 0xEF, 0x53, 0xEC, 0x2C, 0xCA, 0xB4,
-    0x5B, 0x44, 0xA6, 0xF9, 0xF6, 0x8A, 0xE7, 0x6A, 0x7B, 0x32, 0xAB, 0xE1, 0xD0, 0x16, 0x0A, 0x88,
-    0x85, 0x8E, 0xC4, 0xF4, 0xC8, 0xE4, 0x08, 0x2C, 0x11, 0xF7, 0xFF, 0x50, 0x1C, 0x46, 0xA8, 0x13,
-    0x72, 0xBD, 0xDC, 0x92, 0x1F, 0x63, 0xEA, 0xE8, 0x8B, 0xF9, 0xA4, 0x15, 0xE5, 0x70, 0xAE, 0x4C,
-    0xE7, 0x62, 0xB1, 0x68, 0x79, 0x0C, 0xF0, 0x35, 0xD5, 0x01, 0x1F, 0xA9, 0x2B, 0x67, 0x15, 0x1F,
-    0x33, 0x5F, 0x5A, 0x8A, 0x71, 0xAE, 0x62, 0x99, 0x46, 0x2A, 0x7B, 0x9D, 0xFB, 0x9D, 0xB9, 0xBE,
-    0xAC, 0xE0, 0x9D, 0x8A, 0xA3, 0x09, 0x6F, 0x57, 0x39, 0xBB, 0xDE, 0x0C, 0x36, 0x9E, 0x12, 0x48,
-    0x3E, 0x6F, 0x76, 0xF2, 0x05, 0x32, 0xB7, 0x24, 0xF4, 0x3E, 0x2D, 0x2E, 0xE4, 0x0B, 0x46, 0xC7,
-    0x8F, 0xF1, 0xAE, 0x8D, 0x39, 0x17, 0x88, 0x51, 0x65, 0x73, 0x96, 0x52, 0x56, 0x14, 0x21, 0x42,
-    0xC5, 0x84, 0xD4, 0xE7, 0xDA, 0xC4, 0x67, 0xD3, 0x6C, 0x5E, 0xEF, 0x23, 0x29, 0x3C, 0x4C, 0xA5,
-    0x2D, 0xE6, 0xE7, 0x9A, 0x57, 0x5C, 0x73, 0xC2, 0xFD, 0x3D, 0x09, 0x09, 0xBD, 0xA5, 0xD0, 0xFA,
-    0x9C, 0x30, 0xB4, 0x23, 0xE1, 0xC3, 0x61, 0x9E, 0xEC, 0x1E, 0x3D, 0xF2, 0xF9, 0x90, 0xC5, 0xFD,
-    0x2F, 0x40, 0x95, 0xEE, 0xAC, 0x31, 0x1F, 0xD7, 0x52, 0x1B, 0x38, 0x44, 0x37, 0x3F, 0x8B, 0xB8,
-    0xD3, 0x59, 0x0E, 0x5C, 0x7C, 0xC8, 0x66, 0xB3, 0xAD, 0x89, 0x03, 0x7F, 0x32, 0x8E, 0x66, 0x48,
-    0x2B, 0x53, 0x07, 0x90, 0xE6, 0x55, 0x52, 0xA9, 0x4D, 0x4B, 0x1A, 0x21, 0xB9, 0xA4, 0x88, 0xBC,
-    0x14, 0x48, 0xAA, 0x31, 0xA7, 0x94, 0x4E, 0xA8, 0x3F, 0x1D, 0xAB, 0xAC, 0x5A, 0x11, 0xFB, 0x63,
-    0x6E, 0xBE, 0x3F, 0x27, 0xF1, 0xB7, 0xE7, 0x63, 0x84, 0x52, 0x47, 0xA0, 0x97, 0xCD, 0x91, 0x2A,
-    0xBD, 0x7A, 0xE7, 0x47, 0x50, 0xA9, 0x6D, 0xAE, 0x29, 0xC7, 0x32, 0x48, 0x0D, 0x51, 0xA6, 0x01,
-    0xFD, 0x85, 0xA9, 0xA6, 0x81, 0x05, 0x97, 0x1B, 0x0F, 0xAA, 0xF7, 0x15, 0xE3, 0x71, 0x32, 0x8D,
-    0x71, 0x72, 0x44, 0xCB, 0xA7, 0x13, 0x1A, 0x77, 0xCB, 0x51, 0x68, 0xCE, 0xDD, 0x3B, 0x9D, 0xFE,
-    0xB9, 0xE1, 0x2A, 0xDD, 0xD8, 0xB3, 0xC2, 0x83, 0x1B, 0x88, 0x3B, 0xE3, 0x3C, 0x6C, 0xCE, 0x03,
-    0x19, 0x6F, 0xEB, 0x76, 0xCE, 0x10, 0xC1, 0xD5, 0xB6, 0x2E, 0x6B, 0x95, 0x65, 0x90, 0x82, 0x9B,
-    0xCC, 0x41, 0xE2, 0xFC, 0x47, 0xE0, 0xFA, 0x54, 0xC6, 0xC8, 0x38, 0x47, 0xF7, 0x49, 0x20, 0x77,
-    0x73, 0x90, 0xB1, 0xE0, 0x89, 0xAD, 0x3B, 0xA5, 0x8E, 0x72, 0x24, 0x22, 0x6D, 0xBF, 0x1F, 0xC8,
-    0x5A, 0xCE, 0x59, 0x93, 0x42, 0x13, 0xC0, 0x7A, 0xF5, 0xCE, 0x15, 0x82, 0xBA, 0x4D, 0xA8, 0x4E,
-    0x6E, 0xDD, 0xFE, 0x96, 0xB5, 0xEF, 0xD1, 0xCC, 0x4D, 0xC4, 0x93, 0xB2, 0xB5, 0xFA, 0x0B, 0x48,
-    0x15, 0xF2, 0xBA, 0x5E, 0xE0, 0x1C, 0x13, 0xD3, 0xC9, 0xD3, 0x6C, 0x85, 0xBC, 0x46, 0x7B, 0xD9,
-    0x72, 0xBD, 0x20, 0x3F, 0x2C, 0x97, 0x3D, 0x7E, 0xDE, 0x1C, 0xBF, 0xC0, 0xC0, 0x38, 0x6B, 0x08,
-    0x86, 0xA5, 0xB3, 0x65, 0x0D, 0xB5, 0x44, 0xAC, 0xC3, 0xA8, 0xB0, 0xA2, 0xAF, 0xA5, 0xF3, 0xAB,
-    0xC9, 0x80, 0xE9, 0xBC, 0x61, 0x2B, 0xFD, 0xD9, 0x96, 0xEC, 0xCD, 0x72, 0x70, 0x4B, 0x07, 0x29,
-    0x23, 0xFA, 0x4A, 0xF6, 0x9F, 0xA4, 0x95, 0x07, 0x7F, 0x07, 0xBF, 0x9E, 0xCD, 0xF8, 0xA5, 0x86,
-    0x04, 0x9F, 0x81, 0xD4, 0xDB, 0x42, 0x89, 0x95, 0x55, 0x09, 0xF7, 0x4D, 0xC9, 0x34, 0xDE, 0x7B,
-    0x3F, 0x30, 0x71, 0xD8, 0x9B, 0xAF, 0xEE, 0x4B, 0xB8, 0xC0, 0xB8, 0x09, 0x3F, 0x96, 0xD8, 0x36,
-    0x29, 0x24, 0x73, 0x80, 0xD3, 0x66, 0xAD, 0xF5, 0x79, 0x24, 0xF3, 0xAC, 0x8A, 0x22, 0xC5, 0x2F,
-    0xE1, 0x80, 0xF1, 0xEA, 0x9E, 0xE4, 0x66, 0xB7, 0xBE, 0x98, 0x4E, 0xF6, 0xCD, 0x78, 0x44, 0x6E,
-    0x46, 0xF2, 0x27, 0x47, 0x19, 0x13, 0xE0, 0xCB, 0xD8, 0xBE, 0x71, 0xDD, 0xF2, 0x8C, 0x31, 0x1C,
-    0x70, 0x47, 0xAC, 0x01, 0xDC, 0x2B, 0xA3, 0xFD, 0x65, 0x4E, 0xEB, 0x48, 0xC3, 0x20, 0x23, 0xAC,
-    0x3A, 0xE6, 0x1C, 0x2D, 0x3A, 0xF3, 0x46, 0x5A, 0xF5, 0x74, 0xE6, 0xBD, 0xF4, 0x00, 0x6B, 0x63,
-    0x73, 0x9F, 0x91, 0xE2, 0x6D, 0x46, 0x11, 0x92, 0x24, 0x64, 0x12, 0xF9, 0x16, 0x12, 0xAA, 0x17,
-    0x76, 0x39, 0x19, 0x3E, 0x26, 0xBE, 0xA8, 0xDA, 0x0F, 0x21, 0xF1, 0xE6, 0x67, 0x05, 0x92, 0x5F,
-    0x97, 0x41, 0x47, 0xC4, 0x13, 0x04, 0x2E, 0x09, 0x44, 0x22, 0x05, 0xB5, 0x89, 0x79, 0xC6, 0xC6,
-    0x1D, 0x94, 0x94, 0x68, 0xF3, 0x37, 0xB1, 0x9B, 0xCE, 0xAE, 0x6A, 0x72, 0x19, 0x4B, 0x1C, 0xB2,
-    0xF6, 0xA2, 0xCC, 0x02, 0xA9, 0xBD, 0xBB, 0x72, 0xA4, 0x4D, 0x45, 0x68, 0x77, 0x3C, 0xA7, 0x40,
-    0xC2, 0xBC, 0xF7, 0x8E, 0xE7, 0x49, 0x27, 0xD3, 0xDC, 0x1C, 0xBB, 0x75, 0x3C, 0x57, 0x12, 0x95,
-    0xCA, 0x73, 0xE0, 0x1D, 0xC9, 0xAC, 0x42, 0x56, 0xB2, 0x72, 0x3E, 0x75, 0x01, 0x0D, 0x49, 0xC4,
-    0x4E, 0xA4, 0xD6, 0xE1, 0xD9, 0xA8, 0x6C, 0x18, 0xDD, 0xD8, 0x3B, 0x08, 0xF2, 0x03, 0x49, 0x9B,
-    0xE2, 0x71, 0x88, 0xBC, 0xA7, 0xF7, 0x5E, 0xCC, 0x68, 0x9E, 0x31, 0x4F, 0xC3, 0xAF, 0x9C, 0x33,
-    0xE9, 0x8B, 0x9D, 0x7C, 0x42, 0xE2, 0xDF, 0x3B, 0xBB, 0xFA, 0x60, 0x74, 0x71, 0x25, 0xE9, 0x73,
-    0x34, 0x81, 0xDE, 0xDB, 0x52, 0xFD, 0xF8, 0x27, 0x33, 0xCE, 0x73, 0x3E, 0xBA, 0x74, 0xA1, 0x25,
-    0xF0, 0xFF, 0xCA, 0x98, 0x2F, 0x7E, 0xD1, 0x98, 0x3F, 0x6D, 0xC5, 0x5E, 0x1D, 0xE8, 0x3E, 0x4B,
-    0x0B, 0x22, 0xFE, 0x3A, 0xD4, 0x82, 0x44, 0x59, 0x35, 0xF1, 0xEB, 0x9D, 0xB9, 0x1C, 0x82, 0x46,
-    0xA4, 0xC9, 0xC4, 0xEC, 0x06, 0x5D, 0x34, 0xC1, 0xDB, 0x1B, 0x92, 0x03, 0x82, 0xE8, 0xD9, 0x8F,
-    0x5B, 0x9D, 0x1D, 0x83, 0xB2, 0x1D, 0x17, 0xEB, 0x77, 0x99, 0x21, 0xA9, 0x27, 0x56, 0xE5, 0x3E,
-    0xB9, 0xF5, 0x71, 0xF1, 0xDC, 0x48, 0x16, 0xA9, 0xDE, 0xA2, 0x32, 0x3A, 0x66, 0x92, 0x49, 0x6E,
-    0x0D, 0xEB, 0xC6, 0xFA, 0x94, 0x64, 0x06, 0x42, 0x0F, 0x21, 0x93, 0xD1, 0xB9, 0x15, 0x55, 0x1A,
-    0x25, 0x88, 0xD2, 0x09, 0xF6, 0x12, 0x87, 0xAA, 0x35, 0x4A, 0x11, 0x35, 0x1A, 0xB1, 0xBD, 0xCE,
-    0xD1, 0x44, 0x9D, 0xD8, 0x16, 0x92, 0xA8, 0xD5, 0xF0, 0xAA, 0xA5, 0x0F, 0xBE, 0xA0, 0xE3, 0xE7,
-    0x3D, 0x66, 0xC5, 0x49, 0xE9, 0x4D, 0x7C, 0xA6, 0x60, 0xC7, 0x8C, 0xC9, 0x0F, 0x91, 0x16, 0xE6,
-    0x6F, 0x0D, 0xCC, 0x67, 0x4A, 0xD7, 0x36, 0x30, 0xEC, 0xE7, 0x70, 0x71, 0x92, 0x7B, 0x2C, 0x08,
-    0xCA, 0x07, 0x42, 0x94, 0x19, 0x33, 0x88, 0xBE, 0xDA, 0xF9, 0x08, 0x1E, 0x07, 0x67, 0x60, 0x4A,
-    0x9C, 0x2D, 0x51, 0xBC, 0xF7, 0x1B, 0x4A, 0xCA, 0x02, 0xD1, 0x3E, 0x68, 0x28, 0x5B, 0xC5, 0x5A,
-    0x0D, 0x65, 0xF2, 0x7F, 0x63, 0x28, 0xDB, 0x45, 0xA9, 0x5F, 0xC7, 0x88, 0x54, 0x38, 0xBE, 0xF3,
-    0x99, 0x2D, 0xE4, 0x29, 0x7E, 0x4C, 0xA0, 0x01, 0xD9, 0x0D, 0xD7, 0x46, 0xF9, 0xCE, 0xA2, 0x91,
-    0xE0, 0xDA, 0x0D, 0xE6, 0x6E, 0xAD, 0x33, 0x8E, 0x37, 0xF5, 0xD3, 0x9C, 0x53, 0x0B, 0x81, 0x93,
-    0x0B, 0xBB, 0x5A, 0xC3, 0x1C, 0xE4, 0x4F, 0x30, 0x49, 0xF4, 0xE3, 0x12, 0xD7, 0x18, 0x4F, 0xB4,
-    0xD1, 0x9C, 0xD6, 0x60, 0x4E, 0x96, 0xA7, 0x75, 0xC8, 0xD4, 0x38, 0xAD, 0x91, 0x07, 0x73, 0xBC,
-    0x27, 0x63, 0xDD, 0x35, 0x2D, 0xED, 0x94, 0x26, 0xF4, 0x8D, 0xE9, 0x8C, 0xEA, 0xF0, 0x37, 0x83,
-    0x65, 0xA9, 0xF3, 0x6F, 0x3B, 0x0B, 0x29, 0xCA, 0xAA, 0xA6, 0x2A, 0x58, 0x06, 0xAA, 0x2B, 0x8A,
-    0x92, 0x15, 0xEF, 0x96, 0x4D, 0x4D, 0xC1, 0x2F, 0x16, 0x26, 0x12, 0x43, 0x23, 0xED, 0x62, 0x9E,
-    0x5A, 0x34, 0x5A, 0xD5, 0xE0, 0xAC, 0xC6, 0xD8, 0x46, 0x2F, 0x0F, 0x6D, 0xA3, 0x13, 0xAB, 0x21,
-    0xA3, 0xCB, 0x96, 0xAF, 0xDD, 0xD6, 0xA8, 0xF8, 0x6B, 0x5E, 0x07, 0xAB, 0x11, 0xF6, 0x69, 0xBE,
-    0x99, 0xE0, 0xDA, 0x66, 0x31, 0xDD, 0xA1, 0x95, 0x9E, 0xE8, 0x14, 0x77, 0xB1, 0x07, 0x91, 0x2B,
-    0x3A, 0x29, 0x9A, 0x42, 0x57, 0x0B, 0x6D, 0x2D, 0x74, 0x2E, 0x16, 0x09, 0x3E, 0xE4, 0xC1, 0x59,
-    0xCE, 0x9E, 0x7F, 0x65, 0xDF, 0x60, 0xD7, 0x0E, 0xBD, 0xC2, 0x1B, 0x13, 0x25, 0xC6, 0x20, 0x53,
-    0x19, 0x71, 0x03, 0x39, 0xB0, 0x3E, 0x1B, 0xCA, 0x78, 0x47, 0xF1, 0x72, 0xA3, 0x33, 0x01, 0x99,
-    0x7C, 0xC8, 0x58, 0x6B, 0xAB, 0x6B, 0x31, 0xB8, 0x36, 0x8C, 0xE3, 0x6C, 0xBD, 0xD1, 0x1A, 0x0B,
-    0x11, 0x0D, 0x97, 0xB2, 0x22, 0xC6, 0x96, 0x12, 0x63, 0xC5, 0xEC, 0xD6, 0xDD, 0xF0, 0x0E, 0x06,
-    0xA1, 0xAB, 0x34, 0x75, 0x13, 0x7E, 0x38, 0x41, 0x31, 0x0F, 0x1B, 0xA4, 0xBC, 0x31, 0x3F, 0xEE,
-    0xC8, 0xD8, 0x54, 0xDA, 0x01, 0xFB, 0xBC, 0x09, 0x13, 0xF1, 0xFF, 0xE9, 0xDC, 0x0C, 0x85, 0x54,
-    0x7E, 0x59, 0x4A, 0x91, 0x29, 0x63, 0x99, 0xAD, 0xCB, 0xE6, 0x80, 0xF0, 0x1B, 0x10, 0x29, 0xA6,
-    0x35, 0x8B, 0x96, 0xDC, 0xF8, 0x73, 0x19, 0xF1, 0x4F, 0xDC, 0x64, 0x10, 0x6D, 0xB2, 0xB0, 0x3E,
-    0x64, 0xCC, 0xFC, 0xFF, 0x9D, 0x20, 0x63, 0xBE, 0x1D, 0x9B, 0xF9, 0xD7, 0x16, 0xAE, 0xF3, 0x76,
-    0xFF, 0xEF, 0xE8, 0x32, 0x51, 0x34, 0xAD, 0xE4, 0xF9, 0x32, 0x5F, 0x66, 0x5E, 0xB9, 0xB6, 0x25,
-    0x41, 0x58, 0xA4, 0xC9, 0x83, 0x6C, 0xA5, 0xA6, 0xE5, 0xEA, 0xD7, 0x99, 0x96, 0x68, 0xFB, 0xC5,
-    0xB6, 0xD2, 0x2F, 0xA6, 0x64, 0xC8, 0x42, 0xCC, 0x93, 0xEF, 0xB6, 0x32, 0x20, 0xEE, 0xB6, 0x62,
-    0xCA, 0xAC, 0x2C, 0x54, 0xCC, 0xA7, 0xF5, 0x66, 0x73, 0xD0, 0x4F, 0x39, 0xE0, 0xA3, 0xF2, 0x70,
-    0x90, 0x39, 0xA1, 0x29, 0xDF, 0x95, 0xAE, 0xBF, 0x34, 0x71, 0x29, 0x57, 0xAF, 0xC1, 0xB1, 0x74,
-    0x78, 0x5A, 0xAD, 0x8C, 0xA4, 0xAE, 0xD3, 0x93, 0xE9, 0xD8, 0x7A, 0x13, 0xD9, 0x7D, 0x61, 0xC6,
-    0xB0, 0xD4, 0xC4, 0xD4, 0xEF, 0x55, 0x93, 0x23, 0xEA, 0x2E, 0x56, 0x6C, 0x6E, 0x26, 0x40, 0x47,
-    0x42, 0x23, 0xEF, 0xDA, 0x35, 0xC5, 0x33, 0x95, 0xAD, 0x56, 0x87, 0x0A, 0xFD, 0x60, 0x4A, 0x5E,
-    0xA2, 0x69, 0xAB, 0x36, 0xB1, 0x65, 0x2B, 0xF9, 0xA0, 0x32, 0x12, 0x72, 0x53, 0x4A, 0x20, 0xA6,
-    0xDB, 0x7C, 0x3E, 0xB6, 0x13, 0x0B, 0x11, 0x94, 0x3A, 0x32, 0x02, 0xA8, 0x03, 0x7E, 0x93, 0x51,
-    0x68, 0xA4, 0xF3, 0x3A, 0x3B, 0xA2, 0x24, 0x1E, 0xEB, 0x67, 0x47, 0xB5, 0xB7, 0xFE, 0x72, 0xBB,
-    0xA0, 0x01, 0xB5, 0x72, 0x6C, 0x3C, 0x30, 0xD6, 0xAE, 0x5C, 0xCB, 0xC8, 0xD1, 0x3C, 0x4F, 0xF5,
-    0x53, 0x21, 0x4F, 0xFB, 0x47, 0xAD, 0x7C, 0x6D, 0x18, 0xCB, 0xF7, 0x8B, 0x9E, 0xB2, 0x63, 0xCD,
-    0x7D, 0x82, 0xF6, 0xC8, 0x4A, 0xCC, 0x09, 0xD6, 0xB7, 0xBA, 0xD3, 0x58, 0xEA, 0xB2, 0xA3, 0xD0,
-    0x61, 0x1F, 0xC6, 0x3D, 0x90, 0xC4, 0xC0, 0x1B, 0x02, 0x83, 0xA0, 0xCD, 0x99, 0x64, 0x24, 0xDA,
-    0x9F, 0x75, 0x63, 0x01, 0xDB, 0xDA, 0xB1, 0x5E, 0x8C, 0x05, 0xAC, 0x69, 0xD1, 0x6D, 0x5B, 0x5C,
-    0x02, 0xC3, 0x87, 0x54, 0x87, 0x1B, 0xFF, 0x17, 0x55, 0x52, 0x3D, 0x4C, 0x1B, 0x31, 0x14, 0xFE,
-    0x7C, 0x86, 0x1C, 0xE4, 0x20, 0x66, 0x00, 0x09, 0xD1, 0x88, 0x63, 0xA0, 0x12, 0x52, 0x8B, 0x92,
-    0x81, 0x21, 0x03, 0xE1, 0x5C, 0x2A, 0x75, 0x8E, 0xAA, 0x66, 0xEA, 0xC0, 0x4A, 0x55, 0x55, 0x64,
-    0x60, 0x60, 0xE0, 0xC7, 0x08, 0xB5, 0x4B, 0x17, 0x96, 0x76, 0xAB, 0x8A, 0x54, 0x96, 0x66, 0x21,
-    0xAA, 0x32, 0xA0, 0x8A, 0x36, 0x86, 0x0E, 0x0C, 0x2C, 0x06, 0x66, 0xA4, 0x13, 0xA5, 0xEA, 0x7A,
-    0xC3, 0x0D, 0x01, 0xEE, 0xE2, 0xFA, 0x12, 0x54, 0xE0, 0x49, 0x77, 0x96, 0xFD, 0x9E, 0xFD, 0xBE,
-    0x9F, 0x57, 0xC4, 0x0A, 0x7E, 0xE0, 0x15, 0xFC, 0x69, 0xE7, 0x89, 0x3F, 0x0D, 0xF8, 0x70, 0x14,
-    0x56, 0x7D, 0x2A, 0x82, 0x09, 0x54, 0x98, 0xF8, 0x72, 0xD6, 0xBF, 0xF8, 0xED, 0x88, 0x36, 0xD1,
-    0x0D, 0x80, 0x58, 0x5A, 0x1F, 0xE8, 0xD6, 0x16, 0x3A, 0x61, 0x35, 0xB4, 0x3E, 0xBE, 0xAA, 0x56,
-    0x4B, 0x05, 0x4C, 0x04, 0xE4, 0xF4, 0xCF, 0xAA, 0xAD, 0x7D, 0xFB, 0x12, 0xA0, 0xE7, 0xCD, 0xB8,
-    0xC1, 0x4D, 0x01, 0x93, 0x33, 0x39, 0xF1, 0xD3, 0x13, 0xF1, 0xDA, 0x6C, 0x9C, 0x5B, 0xCF, 0x58,
-    0x2A, 0xE8, 0x81, 0xED, 0x57, 0x7E, 0x3D, 0xCD, 0xEC, 0x32, 0x41, 0x42, 0xB0, 0xF5, 0x26, 0xD8,
-    0x7E, 0x64, 0xBE, 0x6D, 0xA4, 0x79, 0x05, 0x5B, 0xF5, 0x51, 0x5C, 0x2B, 0x44, 0xB0, 0x24, 0x66,
-    0x60, 0x05, 0x30, 0x69, 0x69, 0xFB, 0xF0, 0x30, 0x22, 0x30, 0x5F, 0xE6, 0x9E, 0xCC, 0x29, 0xE6,
-    0xDB, 0x01, 0x8D, 0x10, 0x9B, 0xF6, 0x2D, 0x1A, 0xD9, 0xA1, 0x13, 0x30, 0xE5, 0xC9, 0x35, 0xDE,
-    0x10, 0x9E, 0x74, 0x6F, 0xB2, 0x24, 0x86, 0xCA, 0x7A, 0xFB, 0x4B, 0x94, 0x63, 0x2B, 0x4B, 0x9B,
-    0xE1, 0x63, 0x20, 0x57, 0x2D, 0x69, 0xAD, 0xC0, 0x80, 0x65, 0x58, 0x86, 0x23, 0x27, 0xA2, 0x36,
-    0xB5, 0x54, 0x00, 0xD2, 0xE3, 0xF9, 0x02, 0xBA, 0xA0, 0x3E, 0x39, 0xCD, 0x94, 0xDC, 0xB6, 0xA3,
-    0x8C, 0x50, 0x5D, 0xB0, 0x90, 0xCF, 0x89, 0xCD, 0x9E, 0x84, 0xE4, 0x03, 0xDD, 0xF2, 0xF4, 0xD7,
-    0x84, 0xCC, 0xD1, 0xEF, 0xCB, 0xB8, 0xCD, 0x9B, 0x84, 0x8E, 0x8A, 0x69, 0xB0, 0x66, 0x45, 0x9E,
-    0xD4, 0xB7, 0x84, 0x50, 0xA6, 0x31, 0x8D, 0x9C, 0x90, 0x05, 0xAE, 0x41, 0xD4, 0xE0, 0x16, 0xC6,
-    0xC8, 0x05, 0xC6, 0xB1, 0x39, 0xE7, 0xF8, 0xE6, 0x96, 0xCD, 0xEB, 0x36, 0x0A, 0x68, 0x60, 0x18,
-    0x96, 0x58, 0x76, 0x44, 0xE8, 0x52, 0xBF, 0x08, 0x57, 0xBF, 0xFF, 0x78, 0x2A, 0x6A, 0x6A, 0xA2,
-    0x82, 0xCD, 0xDA, 0x24, 0xAE, 0x25, 0x89, 0x40, 0x25, 0xA8, 0x80, 0x2B, 0xCC, 0xCE, 0x99, 0x95,
-    0x15, 0xA2, 0xEE, 0xD9, 0x40, 0xCA, 0x1B, 0x3A, 0x32, 0xEF, 0x75, 0x57, 0x83, 0x86, 0x96, 0x09,
-    0xB0, 0xBB, 0xD9, 0x91, 0x6A, 0x95, 0x69, 0x7D, 0xA8, 0x75, 0x50, 0xE9, 0xEB, 0xCD, 0xA2, 0x60,
-    0x5B, 0x72, 0x71, 0xF4, 0xA5, 0xD0, 0x11, 0xD3, 0xEF, 0x70, 0xC2, 0xF3, 0x32, 0x9B, 0x4F, 0xBB,
-    0xDA, 0x98, 0xE3, 0xBC, 0xA5, 0xFD, 0xCF, 0x9F, 0x8D, 0x1F, 0xF4, 0x8D, 0x6D, 0x20, 0x3D, 0xC6,
-    0x30, 0x45, 0x6B, 0xF9, 0xFB, 0x8D, 0x06, 0x1D, 0x51, 0xA9, 0x0F, 0x98, 0x06, 0x46, 0xBE, 0x25,
-    0x20, 0x00, 0x55, 0x70, 0x44, 0xC7, 0xFA, 0xBB, 0xCE, 0x0E, 0x95, 0x99, 0x3E, 0xE4, 0xE7, 0x72,
-    0xAA, 0xD4, 0xD5, 0xCE, 0x3D, 0xD2, 0xB1, 0xAD, 0xAF, 0x36, 0xF1, 0x3F, 0xD2, 0x3B, 0x9A, 0x1A,
-    0x40, 0xED, 0x7B, 0x7C, 0x77, 0x9A, 0x1E, 0x07, 0x2E, 0x13, 0xBB, 0x45, 0x7A, 0x12, 0xB8, 0x29,
-    0x3E, 0x6F, 0x4E, 0x3D, 0xED, 0xB5, 0x50, 0x34, 0xCE, 0xEC, 0x25, 0x35, 0xE6, 0x95, 0x41, 0x20,
-    0x0F, 0x48, 0x10, 0xC1, 0x36, 0xB6, 0x8A, 0x67, 0x6A, 0xF1, 0xBB, 0xAC, 0x79, 0xA2, 0xF4, 0x01,
-    0xC4, 0x48, 0x03, 0xF4, 0xC2, 0x88, 0xD8, 0x09, 0x83, 0x29, 0xD1, 0x56, 0x75, 0x40, 0xB5, 0xFD,
-    0x12, 0x88, 0x48, 0x6B, 0x4E, 0x59, 0xA1, 0x1D, 0x5A, 0xA1, 0xE3, 0x33, 0x85, 0x86, 0x16, 0xC6,
-    0x9E, 0xEE, 0x17, 0x46, 0xAA, 0xA4, 0x2E, 0x97, 0xCC, 0x26, 0x86, 0x6E, 0x01, 0x3A, 0x31, 0x0A,
-    0x34, 0xA8, 0x33, 0xBE, 0x47, 0xFF, 0xFA, 0x29, 0xEE, 0x34, 0x6F, 0x53, 0x39, 0x65, 0x71, 0xF7,
-    0x33, 0x5F, 0xA6, 0xAA, 0xE8, 0xF2, 0x3D, 0x98, 0x11, 0x02, 0x29, 0x25, 0x89, 0x87, 0x40, 0x1D,
-    0x18, 0xB8, 0x29, 0x33, 0x98, 0xDF, 0x98, 0xFF, 0xF0, 0x64, 0x5F, 0x67, 0x9F, 0x2C, 0x64, 0xDF,
-    0xE0, 0xB1, 0x65, 0x86, 0x63, 0x81, 0xE3, 0xB5, 0xDE, 0x36, 0x47, 0x0B, 0xFA, 0x02, 0x66, 0x26,
-    0x52, 0x21, 0x31, 0x40, 0x2C, 0x99, 0xE0, 0xCD, 0xDE, 0xF6, 0x42, 0x1B, 0x17, 0x56, 0x8C, 0x58,
-    0x26, 0x82, 0xAA, 0x89, 0x1D, 0xBF, 0x4D, 0x92, 0xDF, 0x14, 0xFC, 0x03, 0xCD, 0x7C, 0x4D, 0x8C,
-    0x1D, 0xD7, 0x75, 0xE6, 0xA9, 0x2A, 0x91, 0x35, 0x76, 0x45, 0x2C, 0x2D, 0xC4, 0x44, 0x16, 0x45,
-    0x56, 0x16, 0xC1, 0x40, 0x71, 0x48, 0xD6, 0x46, 0x0B, 0x06, 0x78, 0xDD, 0x55, 0x94, 0x16, 0x5A,
-    0x68, 0x21, 0x06, 0x60, 0xCB, 0x03, 0x68, 0xA1, 0x2C, 0xBC, 0xC8, 0x28, 0x93, 0xA1, 0x16, 0xC2,
-    0xA0, 0x17, 0xDD, 0xFD, 0x4A, 0x12, 0x06, 0x5A, 0x64, 0x41, 0x0E, 0x10, 0x62, 0x80, 0x6C, 0x44,
-    0x04, 0x36, 0x60, 0xB7, 0x90, 0xB0, 0x17, 0x04, 0xD2, 0x13, 0x74, 0x77, 0x15, 0xC5, 0x05, 0x17,
-    0x5A, 0xB8, 0x2C, 0x47, 0xF0, 0xC2, 0x0B, 0x96, 0x4C, 0x25, 0x76, 0x44, 0x04, 0x2C, 0x59, 0x25,
-    0xB3, 0x9A, 0xAC, 0x57, 0x77, 0xBE, 0xEF, 0xDC, 0x7A, 0xAF, 0x5F, 0x53, 0xA2, 0xE4, 0xB1, 0x6C,
-    0x4F, 0x9A, 0xE4, 0x6B, 0xBE, 0xF7, 0xEA, 0xD5, 0xBD, 0xF7, 0xDC, 0x73, 0xBE, 0xF3, 0x9D, 0x9F,
-    0xFB, 0x44, 0x8E, 0x09, 0x7E, 0xB6, 0xF0, 0xCF, 0xAB, 0xF1, 0x10, 0x14, 0xB2, 0xEF, 0xC7, 0x31,
-    0xA6, 0x93, 0xD8, 0x98, 0xC2, 0xAB, 0xF0, 0x6C, 0x01, 0xFF, 0xFC, 0x62, 0xB8, 0x3E, 0x4C, 0xF1,
-    0xC0, 0xB7, 0x23, 0x63, 0x32, 0xF7, 0xB3, 0x6F, 0x67, 0xFA, 0xF6, 0x84, 0x6F, 0x97, 0x2E, 0xAF,
-    0x4B, 0x70, 0x1B, 0xBC, 0xF6, 0xA4, 0x73, 0x41, 0xFC, 0x0C, 0xD7, 0x5E, 0xF1, 0xEE, 0x1B, 0x0C,
-    0x57, 0x16, 0x7A, 0xE5, 0x22, 0xA7, 0x53, 0xE2, 0x61, 0x65, 0x3A, 0xA5, 0x86, 0x77, 0xC4, 0xDB,
-    0x98, 0x4F, 0x2B, 0x27, 0x3F, 0xF3, 0x76, 0x6B, 0xDF, 0x2E, 0x1D, 0x0E, 0xA8, 0xD3, 0xE5, 0x6D,
-    0xF8, 0x93, 0x5E, 0xC6, 0xFF, 0x30, 0xF2, 0x7A, 0xB6, 0x37, 0x2B, 0xDE, 0x2C, 0xC2, 0x3F, 0x97,
-    0x2B, 0xE6, 0x58, 0xFE, 0xBF, 0xFE, 0x93, 0x48, 0x8E, 0x4F, 0x84, 0xBB, 0x7E, 0x25, 0x58, 0xB0,
-    0x44, 0xA9, 0xD4, 0x78, 0x3B, 0xC4, 0xDB, 0x4E, 0x8D, 0xB1, 0x4E, 0xE2, 0xD3, 0x7E, 0x19, 0x16,
-    0x07, 0x3B, 0xE9, 0x5C, 0x23, 0x51, 0x96, 0xA4, 0x2A, 0x1E, 0x0E, 0xBE, 0xCC, 0xFB, 0x4E, 0xA7,
-    0xB4, 0x25, 0x5F, 0xF4, 0x63, 0x8C, 0xE1, 0x3C, 0x6B, 0x1D, 0x39, 0xE1, 0x67, 0x28, 0xB7, 0x35,
-    0x2E, 0x83, 0x1F, 0xE6, 0x94, 0x23, 0xDC, 0xD2, 0xE5, 0x7A, 0x38, 0x82, 0xEE, 0xC9, 0x98, 0x6F,
-    0xF3, 0x3F, 0x3D, 0xDF, 0xC6, 0x75, 0x2E, 0xAF, 0x4B, 0xAC, 0xF0, 0x82, 0x3E, 0xE5, 0x6D, 0x2B,
-    0xF1, 0x1B, 0xA7, 0xC5, 0xBC, 0x64, 0x95, 0x2B, 0x5A, 0xE4, 0xAD, 0x0E, 0x3B, 0x5C, 0xA8, 0x7B,
-    0x77, 0xFD, 0x92, 0x40, 0x1C, 0xB5, 0xF8, 0xBC, 0x4C, 0xC5, 0x15, 0xEE, 0x3D, 0xD4, 0x12, 0xD7,
-    0xA1, 0xB9, 0x6D, 0x2A, 0x4C, 0xCB, 0x14, 0x01, 0x1E, 0x52, 0x8F, 0x42, 0x94, 0x73, 0xE6, 0xC2,
-    0x4C, 0x09, 0x72, 0x0C, 0x82, 0x8D, 0x69, 0x28, 0x24, 0x23, 0x12, 0xEF, 0xCA, 0x23, 0xE2, 0x71,
-    0x8E, 0x3A, 0x75, 0x7B, 0x27, 0x9D, 0x3C, 0x04, 0xC8, 0xC7, 0xDC, 0x40, 0xCC, 0xAE, 0x6E, 0xF7,
-    0x41, 0xC3, 0xFF, 0x3B, 0x63, 0xCE, 0x5D, 0xC6, 0x5C, 0x85, 0x67, 0x28, 0xBA, 0xBC, 0x91, 0x14,
-    0x1B, 0xCE, 0xCD, 0x32, 0x25, 0x87, 0x6D, 0x71, 0xBD, 0xE9, 0x65, 0x8C, 0x87, 0x14, 0x37, 0xD8,
-    0x9D, 0xC9, 0x2C, 0x2C, 0x1D, 0xEC, 0x48, 0x01, 0x99, 0x24, 0x29, 0xE4, 0x31, 0x96, 0x80, 0x5B,
-    0x14, 0x0D, 0x2F, 0x34, 0x7C, 0xA1, 0x86, 0x68, 0xA2, 0xD2, 0x9D, 0x40, 0x28, 0x7E, 0x27, 0x39,
-    0x06, 0x5C, 0x74, 0x1A, 0xB7, 0x0D, 0xCB, 0xB0, 0x1C, 0x4B, 0xFE, 0x4C, 0xF7, 0x79, 0x5B, 0x01,
-    0xF1, 0xE2, 0xBE, 0x2A, 0xD8, 0x18, 0x1F, 0x98, 0x58, 0x61, 0x53, 0xFA, 0x3B, 0xFB, 0xFF, 0xDB,
-    0x70, 0x0A, 0xBA, 0x0B, 0x94, 0x7B, 0x88, 0x0D, 0x1B, 0x43, 0x1A, 0x13, 0x95, 0x9D, 0x8C, 0x0B,
-    0x71, 0xFB, 0x41, 0x7B, 0x8B, 0xE9, 0xCE, 0x64, 0xF6, 0x53, 0x92, 0x8B, 0xBD, 0x9E, 0x37, 0xDF,
-    0xBF, 0xAF, 0x3E, 0x05, 0xB1, 0x23, 0xF6, 0xCE, 0x2A, 0xB9, 0xB8, 0x18, 0x3E, 0x44, 0xAD, 0xD8,
-    0x7B, 0x7B, 0x7A, 0x4F, 0x0C, 0xF9, 0x50, 0x84, 0x57, 0x21, 0x21, 0x48, 0x0D, 0x83, 0x62, 0x3F,
-    0x25, 0xE1, 0xF5, 0xAA, 0x87, 0x14, 0x1B, 0xF7, 0xFA, 0x5F, 0x96, 0xD4, 0x12, 0xC4, 0xE5, 0x6D,
-    0x47, 0xAA, 0x95, 0x4E, 0x65, 0xCD, 0x44, 0xD4, 0x44, 0x47, 0x6A, 0xB6, 0x78, 0x2D, 0xC1, 0xB6,
-    0x04, 0xA9, 0x73, 0xF7, 0x72, 0x89, 0xD7, 0x82, 0xCC, 0x2F, 0xF0, 0xDA, 0x02, 0x3E, 0x10, 0x40,
-    0xF1, 0xF1, 0x0A, 0x5E, 0x2B, 0x9C, 0x1A, 0xAF, 0x2D, 0xC2, 0x64, 0x70, 0x9B, 0xF6, 0xF7, 0x3B,
-    0x5A, 0x00, 0x34, 0x08, 0x0A, 0x18, 0x63, 0x16, 0x3D, 0xB5, 0x2E, 0x9B, 0x49, 0xF3, 0x80, 0x55,
-    0x94, 0x5A, 0x68, 0xD3, 0xB0, 0xCF, 0x4D, 0x35, 0x07, 0x8E, 0x35, 0x12, 0xDC, 0x90, 0xB0, 0x40,
-    0x8B, 0xDB, 0xD4, 0x59, 0x84, 0x16, 0x2A, 0xB0, 0xDF, 0xE6, 0xE7, 0x34, 0xFA, 0xFE, 0xED, 0x1A,
-    0x13, 0x0E, 0x33, 0x3F, 0x1B, 0xD1, 0x38, 0x47, 0x7A, 0xB1, 0x57, 0x6C, 0xD2, 0x40, 0x57, 0x70,
-    0x8F, 0x45, 0xE8, 0x35, 0xEE, 0x5C, 0xBE, 0x54, 0x47, 0x5C, 0xE9, 0x04, 0xF7, 0x80, 0xB6, 0x12,
-    0x42, 0xF6, 0xA6, 0x40, 0xF5, 0xED, 0xA8, 0x4C, 0x34, 0x76, 0xD3, 0x1E, 0x56, 0x99, 0xAB, 0x64,
-    0x1D, 0x8A, 0xC4, 0x6D, 0xA6, 0x08, 0xE7, 0x7F, 0xFC, 0x1D, 0x48, 0x83, 0x1F, 0x24, 0x60, 0x58,
-    0x8B, 0x8F, 0x2B, 0xD8, 0x61, 0x52, 0x60, 0x12, 0x49, 0x86, 0x69, 0x8F, 0x53, 0xAC, 0x22, 0xA7,
-    0xA9, 0xC0, 0x5A, 0x33, 0x07, 0xBA, 0x95, 0x62, 0xBF, 0xE3, 0xD4, 0x03, 0x86, 0x09, 0x1E, 0xC6,
-    0x3A, 0xA2, 0x45, 0xAF, 0x2B, 0x32, 0x80, 0xC9, 0xF0, 0x7C, 0xF3, 0xB3, 0x9A, 0xE6, 0x36, 0xF8,
-    0x0C, 0x3E, 0x99, 0x73, 0x63, 0xB9, 0xCF, 0xDB, 0xDC, 0xDF, 0xF0, 0x2A, 0x66, 0xE8, 0x74, 0xD8,
-    0x58, 0x89, 0x9F, 0x87, 0x50, 0xBC, 0x4F, 0x38, 0x4F, 0xB5, 0x93, 0x50, 0x71, 0x92, 0x3B, 0x2C,
-    0x51, 0xAF, 0x16, 0xA3, 0x70, 0xC1, 0x57, 0x83, 0x3B, 0x7C, 0xA1, 0xE7, 0xCE, 0x47, 0x57, 0xA9,
-    0x07, 0x5D, 0xD8, 0x53, 0xE3, 0x60, 0x4E, 0x7E, 0xED, 0x19, 0x4E, 0x3B, 0x36, 0xBA, 0x15, 0x6A,
-    0xBD, 0x0A, 0x77, 0xD6, 0x48, 0x55, 0xF7, 0x64, 0xCE, 0xAA, 0xE4, 0xC0, 0x19, 0xC8, 0x87, 0xAB,
-    0x2B, 0x24, 0x29, 0xF1, 0x76, 0x88, 0xE5, 0xA5, 0xAE, 0x29, 0x30, 0xBB, 0xBC, 0xC5, 0x8D, 0x22,
-    0x93, 0x86, 0x95, 0x77, 0xA7, 0xC6, 0x55, 0x13, 0x3C, 0x2B, 0x92, 0xF3, 0x95, 0xDB, 0x06, 0x1F,
-    0xC3, 0xCA, 0x4E, 0x77, 0x31, 0xAE, 0x1A, 0x63, 0x59, 0x39, 0x2C, 0x2C, 0x0B, 0x6F, 0xB6, 0x41,
-    0x23, 0x93, 0x1D, 0x88, 0x2B, 0xBA, 0x5D, 0x44, 0x15, 0x94, 0xD3, 0xC3, 0x55, 0x1D, 0xCD, 0xD1,
-    0xA4, 0x01, 0xAE, 0xAA, 0x44, 0x37, 0xEA, 0x82, 0x9C, 0x11, 0x2F, 0xF5, 0x53, 0x28, 0xC6, 0xCA,
-    0xB0, 0xA0, 0x84, 0xD3, 0x7A, 0xE8, 0x33, 0x32, 0x83, 0xAE, 0x41, 0xFF, 0xB0, 0xF3, 0x5E, 0x89,
-    0x5F, 0x50, 0xC1, 0x0C, 0xA0, 0x0C, 0x6C, 0xDD, 0xC6, 0x46, 0x39, 0x6D, 0x0C, 0x99, 0x7C, 0x8C,
-    0x0F, 0x86, 0x37, 0x70, 0x87, 0xB8, 0x9F, 0x22, 0x0B, 0xC7, 0xA0, 0xA8, 0xAD, 0xD1, 0xD1, 0xFA,
-    0x30, 0x2D, 0xB8, 0xB0, 0x0C, 0x12, 0xA4, 0xE9, 0x12, 0x78, 0xC6, 0xD5, 0xBC, 0xCE, 0x3E, 0x8A,
-    0xBB, 0xC2, 0x3C, 0x12, 0x6A, 0xCA, 0x22, 0xDD, 0xC8, 0xAA, 0x00, 0x34, 0xB7, 0xA8, 0x78, 0x2D,
-    0xB1, 0xB9, 0xB1, 0xE3, 0xFB, 0x05, 0x5E, 0x08, 0xE8, 0x03, 0xA1, 0xA4, 0x54, 0xEB, 0x80, 0x1A,
-    0x0A, 0xE3, 0x8C, 0x29, 0x61, 0xA8, 0xE7, 0xC5, 0xA5, 0x6D, 0x22, 0x99, 0xFA, 0x38, 0x8C, 0xE4,
-    0x73, 0xB1, 0x41, 0x3A, 0xF8, 0x05, 0xFB, 0xF0, 0x8D, 0x01, 0x25, 0xB2, 0x29, 0x76, 0xE7, 0x05,
-    0xE7, 0x46, 0xB3, 0xBF, 0xC5, 0x8D, 0x7D, 0x17, 0x0F, 0xD1, 0xB3, 0xB0, 0xDB, 0x45, 0x8C, 0x20,
-    0x5B, 0xD0, 0x4A, 0xA7, 0xC1, 0x80, 0x5E, 0xED, 0xE9, 0xD0, 0x35, 0x3E, 0x89, 0x87, 0x84, 0x4A,
-    0x0C, 0x10, 0x6E, 0xE0, 0xE9, 0x4C, 0xE3, 0xF1, 0x21, 0xF8, 0x74, 0xE9, 0x5B, 0x2D, 0xF6, 0xD0,
-    0x6B, 0x01, 0x3C, 0x5E, 0x97, 0xAB, 0x0C, 0x80, 0x07, 0x85, 0x4F, 0xE4, 0xDF, 0x9A, 0xE2, 0x33,
-    0xE5, 0x0C, 0xAF, 0x66, 0x9D, 0x5E, 0x02, 0x70, 0xF7, 0xEE, 0x5E, 0x2E, 0xB0, 0xDE, 0x63, 0xD4,
-    0x73, 0xEE, 0x71, 0x48, 0x5D, 0xAF, 0xB1, 0xE4, 0x6D, 0x89, 0xD6, 0xF3, 0x42, 0xF1, 0x3E, 0x81,
-    0x27, 0xF0, 0x4C, 0xBF, 0xE7, 0xA0, 0x3F, 0x94, 0xE0, 0xA3, 0xCB, 0x19, 0xE6, 0xC5, 0x0B, 0x8F,
-    0x43, 0x74, 0x21, 0x64, 0xE0, 0x17, 0x94, 0x08, 0x26, 0x93, 0x39, 0x34, 0xA9, 0x4D, 0xBC, 0xB4,
-    0x00, 0xC1, 0xC1, 0x2A, 0x5A, 0xDC, 0x7B, 0x07, 0x57, 0x8F, 0xD3, 0xFE, 0x6D, 0x53, 0x60, 0x52,
-    0x25, 0x9D, 0x73, 0x48, 0x88, 0xFF, 0x6D, 0x3A, 0x45, 0x0B, 0xF0, 0xDC, 0x89, 0x31, 0x1F, 0x36,
-    0xB9, 0xF8, 0x06, 0x7F, 0x80, 0x68, 0x35, 0x10, 0xC8, 0x25, 0x98, 0x78, 0xC4, 0x2A, 0x8F, 0x0E,
-    0x91, 0x3B, 0x9A, 0x61, 0xA2, 0x21, 0x05, 0x15, 0x71, 0x87, 0x16, 0x61, 0xEC, 0xD2, 0x59, 0x61,
-    0x27, 0x12, 0xDF, 0x5D, 0x37, 0x17, 0xC6, 0x74, 0x8F, 0x7C, 0xC8, 0x56, 0xA1, 0x72, 0x90, 0x1B,
-    0x2E, 0x7A, 0x94, 0x0A, 0xF4, 0x5B, 0xA2, 0x49, 0xB4, 0xE6, 0x14, 0x1B, 0x9A, 0x64, 0x49, 0x8D,
-    0x75, 0xBA, 0x9D, 0x6F, 0xAC, 0xFB, 0x19, 0x97, 0x5C, 0x7A, 0xEE, 0x77, 0x5C, 0xB4, 0xD7, 0xE4,
-    0xD7, 0xD5, 0x69, 0xBC, 0xDB, 0x50, 0x0E, 0xCE, 0xC4, 0xD0, 0xF9, 0x48, 0x08, 0x7F, 0x6E, 0xBD,
-    0x82, 0xBA, 0x3E, 0x4F, 0x9D, 0x03, 0x25, 0x52, 0x0D, 0x50, 0xC9, 0x5F, 0xBE, 0xA5, 0x48, 0x54,
-    0x24, 0x35, 0x97, 0xDB, 0xF7, 0x68, 0x1F, 0xF1, 0xC4, 0xBC, 0xA5, 0xB6, 0x12, 0xB7, 0x78, 0xD9,
-    0x33, 0xD7, 0xCC, 0x73, 0x78, 0xD9, 0xD4, 0xE3, 0x06, 0xF6, 0x3C, 0xEE, 0x02, 0xF3, 0xB4, 0x82,
-    0x91, 0xD0, 0xB3, 0x5F, 0xC0, 0x92, 0x5B, 0xF9, 0xE6, 0x9F, 0x75, 0xC3, 0xA2, 0xF8, 0x6F, 0xD5,
-    0xEE, 0x18, 0x30, 0x24, 0x86, 0xDD, 0x25, 0xFD, 0xB0, 0x8B, 0x5C, 0x38, 0xFF, 0x79, 0xD5, 0x23,
-    0xD8, 0xCC, 0xC5, 0x25, 0x93, 0x61, 0x99, 0x3A, 0xBF, 0x23, 0x73, 0x5E, 0xC4, 0xBA, 0xCA, 0x25,
-    0xDD, 0x87, 0x0A, 0xDE, 0x19, 0x28, 0x02, 0xDF, 0x0C, 0xA9, 0x36, 0x12, 0x13, 0x76, 0x03, 0x93,
-    0x05, 0xB5, 0x03, 0xBD, 0xEC, 0x25, 0x19, 0xE3, 0xAA, 0xF0, 0x27, 0xB5, 0xD3, 0x79, 0x6D, 0x8F,
-    0xAB, 0xF2, 0xA8, 0xF4, 0x9A, 0xE8, 0x1D, 0x5C, 0xE5, 0xD7, 0x49, 0x11, 0xD4, 0x13, 0xBF, 0x05,
-    0x4C, 0x66, 0x79, 0x1A, 0xFE, 0xA4, 0x0A, 0x6B, 0xA7, 0xEF, 0x00, 0x74, 0x40, 0xC6, 0xA4, 0x04,
-    0x48, 0xD2, 0x3E, 0x1A, 0xD8, 0x5F, 0xD0, 0x4B, 0xD8, 0x2A, 0x10, 0xD0, 0x7D, 0xD5, 0x42, 0xD7,
-    0x44, 0x60, 0xC2, 0xBC, 0x68, 0x28, 0x3A, 0x31, 0x67, 0xA6, 0xA9, 0x8F, 0x0E, 0xB0, 0x79, 0xF0,
-    0xD2, 0xE7, 0xC0, 0xA6, 0x37, 0x85, 0xCD, 0x1D, 0x85, 0xCD, 0xD2, 0xBF, 0x1F, 0x36, 0x3F, 0x00,
-    0x20, 0x3E, 0xBD, 0x0F, 0x36, 0xD3, 0xF0, 0x66, 0x83, 0x9D, 0xDD, 0x83, 0x4D, 0xEF, 0x01, 0xB0,
-    0xA9, 0xFE, 0xC3, 0xA3, 0x16, 0xA8, 0xFB, 0x08, 0xA8, 0x00, 0xEA, 0x3D, 0x22, 0xEE, 0xBD, 0x3A,
-    0x8F, 0x84, 0xDB, 0xAE, 0xBE, 0x43, 0xF7, 0x94, 0x5B, 0xE4, 0x70, 0x57, 0xD5, 0x73, 0x28, 0xF8,
-    0xA9, 0xE3, 0x08, 0x6F, 0x62, 0x61, 0xEA, 0x37, 0xE2, 0x02, 0x6F, 0xAB, 0xDB, 0x18, 0x73, 0xC4,
-    0xC1, 0x6B, 0x1C, 0x5E, 0x3A, 0x6B, 0xA9, 0x22, 0xDD, 0x2B, 0x2C, 0x70, 0x8B, 0x63, 0xD7, 0x14,
-    0x34, 0x6D, 0x62, 0x75, 0xF6, 0xAC, 0xC0, 0xB3, 0x35, 0x3C, 0x83, 0x57, 0x1D, 0x9E, 0x8D, 0xF9,
-    0xAC, 0xB5, 0xCF, 0xD6, 0xD4, 0x70, 0xF0, 0x0C, 0x96, 0x5E, 0xFA, 0x9D, 0x9A, 0xF4, 0x9C, 0x59,
-    0x62, 0x6F, 0xC1, 0xD3, 0x31, 0x49, 0x09, 0x26, 0x82, 0x55, 0x2E, 0x36, 0xB2, 0x56, 0xC9, 0x9D,
-    0xCA, 0xBB, 0x91, 0xFA, 0x3F, 0x28, 0x16, 0x57, 0x24, 0x4E, 0xDC, 0x5F, 0x00, 0x7F, 0xB7, 0xA2,
-    0xE7, 0x33, 0xFF, 0xBD, 0xBA, 0x83, 0x31, 0x06, 0x3F, 0xB9, 0xDA, 0x48, 0x17, 0xF5, 0x21, 0xEC,
-    0x6B, 0x5C, 0x27, 0x12, 0x9D, 0x36, 0xA7, 0x5B, 0x60, 0x64, 0x17, 0xC0, 0x8C, 0xC3, 0x22, 0x51,
-    0x54, 0xED, 0x00, 0x5C, 0xE0, 0x86, 0x44, 0x87, 0x64, 0xB6, 0x69, 0x89, 0xA2, 0x1F, 0x81, 0x40,
-    0x80, 0xA8, 0x98, 0x13, 0x0C, 0x1B, 0x7B, 0xA8, 0xFE, 0x18, 0x1B, 0xA6, 0xCC, 0x92, 0xEE, 0x82,
-    0x4E, 0x94, 0x64, 0xD2, 0x21, 0xB3, 0x24, 0xB0, 0x18, 0xCE, 0xD4, 0x53, 0x4A, 0x1A, 0x11, 0x65,
-    0x09, 0xBA, 0x1A, 0x56, 0x40, 0x6D, 0xA3, 0xBB, 0xEB, 0x97, 0xE1, 0x20, 0x53, 0x6A, 0x53, 0xC7,
-    0x85, 0x80, 0x09, 0x62, 0x9D, 0xE0, 0x82, 0x71, 0x45, 0x36, 0xA8, 0x8A, 0x73, 0xD0, 0x5A, 0x15,
-    0xC1, 0xD3, 0x37, 0x2F, 0xE0, 0xA5, 0xA8, 0xE1, 0xDA, 0xC7, 0x19, 0xD1, 0xCA, 0xD0, 0x92, 0xAD,
-    0x3D, 0x93, 0xF4, 0x05, 0x15, 0x19, 0x41, 0x50, 0x92, 0x0D, 0xAA, 0x08, 0xF1, 0xC8, 0x25, 0x45,
-    0x19, 0xA9, 0x69, 0x92, 0xF2, 0x11, 0x5B, 0x54, 0xAA, 0x41, 0x4C, 0x96, 0xF2, 0x6E, 0x98, 0x53,
-    0xA8, 0xB6, 0x4B, 0xF6, 0x9C, 0x91, 0x6E, 0x93, 0xF2, 0xC4, 0x7B, 0xB4, 0x7D, 0x0A, 0x83, 0x1A,
-    0x16, 0x19, 0xCA, 0x61, 0x8B, 0x0E, 0xB5, 0x82, 0x87, 0x53, 0x0F, 0x46, 0xBF, 0xA7, 0x8E, 0x4E,
-    0x9D, 0xDA, 0x2A, 0x50, 0xCD, 0x55, 0x3F, 0x40, 0x10, 0x23, 0x02, 0xE2, 0xBA, 0xCE, 0xBA, 0x1E,
-    0x0A, 0x18, 0x34, 0x6A, 0x5B, 0x28, 0x6F, 0x0B, 0xD1, 0x5C, 0x57, 0xA0, 0x04, 0xEA, 0xFD, 0x97,
-    0xE8, 0xA0, 0x71, 0x31, 0xBC, 0x4B, 0x63, 0x6F, 0xB9, 0x48, 0xE0, 0x5C, 0xE5, 0x84, 0x75, 0x6A,
-    0x14, 0x22, 0xA6, 0x70, 0xC1, 0xC6, 0x0C, 0xCA, 0x72, 0x95, 0xE1, 0x86, 0xF5, 0xD4, 0x57, 0x13,
-    0xCB, 0x78, 0xF9, 0x80, 0xE0, 0x63, 0xF5, 0x8F, 0xF3, 0xB8, 0xE0, 0xC0, 0xB4, 0x6C, 0x44, 0x61,
-    0xE3, 0x10, 0xA3, 0xD7, 0x96, 0xD3, 0x9B, 0xA8, 0xD7, 0xB7, 0xBC, 0x4C, 0x19, 0xB5, 0x3A, 0x03,
-    0xAB, 0x06, 0x3A, 0x92, 0x92, 0x01, 0x6B, 0xEC, 0xFC, 0xE8, 0x43, 0x90, 0xDC, 0xBF, 0x9D, 0x2B,
-    0x38, 0xBB, 0x56, 0xC5, 0x97, 0x52, 0x4C, 0xB5, 0x62, 0xA1, 0x0E, 0x73, 0x61, 0x2F, 0x22, 0x9D,
-    0xB2, 0xCA, 0xBE, 0xC7, 0x9E, 0xDB, 0x20, 0x67, 0x8F, 0x50, 0xEE, 0xB1, 0xCA, 0xD9, 0x52, 0x74,
-    0x7C, 0xFA, 0x2B, 0xA5, 0xF4, 0x1A, 0x0C, 0x90, 0xBD, 0x0F, 0x53, 0xA0, 0x95, 0x39, 0xB4, 0x53,
-    0x06, 0x10, 0x76, 0xDA, 0x5E, 0xF7, 0xA5, 0xAC, 0x67, 0x55, 0x59, 0x4F, 0xF2, 0x1B, 0x61, 0x3D,
-    0xFA, 0x73, 0x0E, 0x1E, 0xD8, 0xDF, 0xDD, 0x79, 0xB1, 0x0A, 0xD3, 0x55, 0xD9, 0x18, 0x61, 0x59,
-    0x57, 0x5E, 0xC5, 0xC3, 0xC6, 0x06, 0x76, 0xB9, 0xBE, 0x42, 0x33, 0xDF, 0x79, 0xE6, 0xD3, 0x73,
-    0xA5, 0xFA, 0xBB, 0x84, 0xDB, 0x77, 0x50, 0x9D, 0x84, 0x12, 0x09, 0x65, 0x30, 0x71, 0x3A, 0x95,
-    0x6F, 0x32, 0x13, 0x6F, 0xBF, 0x77, 0x7F, 0xCA, 0x84, 0x70, 0x41, 0x36, 0x85, 0xFB, 0xC2, 0xF4,
-    0x00, 0xEC, 0xFC, 0xE0, 0x8E, 0xFA, 0xF5, 0xC4, 0x51, 0x67, 0xFD, 0xA6, 0x32, 0xDC, 0xDB, 0x1A,
-    0x87, 0xAA, 0x4B, 0x0A, 0x95, 0xB4, 0x07, 0xBA, 0x4D, 0x91, 0xDD, 0x52, 0xEB, 0xA2, 0x78, 0x6B,
-    0xBF, 0xE5, 0x35, 0x51, 0x4D, 0xBD, 0x18, 0x17, 0x50, 0x11, 0x87, 0x70, 0x4E, 0xC3, 0x8B, 0x6B,
-    0x1A, 0x17, 0xFE, 0x8E, 0x4B, 0xA2, 0xB1, 0xFD, 0xA9, 0xC1, 0x6C, 0x22, 0x04, 0x42, 0xF0, 0x3A,
-    0x23, 0x78, 0x26, 0xBF, 0x00, 0x3F, 0xDF, 0x24, 0x61, 0x49, 0x07, 0x9A, 0x13, 0x33, 0xC8, 0x20,
-    0x17, 0x58, 0x80, 0xC0, 0xF1, 0x36, 0x51, 0x61, 0x45, 0x99, 0x00, 0x26, 0xDD, 0xF2, 0x6D, 0x2C,
-    0x9C, 0x41, 0x69, 0x61, 0x49, 0x9D, 0x7A, 0xF2, 0x59, 0xCA, 0xE0, 0x60, 0x46, 0xD7, 0xF0, 0x68,
-    0x08, 0x4E, 0xB1, 0x29, 0xC1, 0x1B, 0xA5, 0x2C, 0xF0, 0xBF, 0x2B, 0x12, 0xBC, 0x03, 0xE3, 0x09,
-    0x61, 0x3B, 0x88, 0xB4, 0x0A, 0x78, 0x04, 0xBF, 0x8A, 0xDA, 0xD0, 0xF2, 0x1E, 0x89, 0x9B, 0xCE,
-    0x92, 0x1B, 0x4A, 0xAF, 0x1B, 0xA2, 0xCC, 0xA9, 0x96, 0x47, 0xE9, 0x1F, 0xBB, 0x75, 0x50, 0x44,
-    0x69, 0x0B, 0xA8, 0x2F, 0x16, 0xA4, 0xF5, 0xAA, 0x08, 0x32, 0x6C, 0x82, 0x22, 0x96, 0x15, 0xAF,
-    0x0A, 0xF1, 0xAB, 0xF6, 0xCA, 0x30, 0x1B, 0x31, 0x1F, 0x71, 0x4C, 0xB6, 0x9C, 0x3A, 0x48, 0x17,
-    0x65, 0xCB, 0x03, 0xF7, 0x5A, 0x90, 0x1A, 0x14, 0x4C, 0x96, 0xDD, 0xDA, 0x2B, 0x4E, 0x48, 0xEB,
-    0x54, 0xA1, 0x24, 0xEB, 0xFD, 0xDB, 0x05, 0xB5, 0x57, 0xE3, 0xFA, 0xE6, 0x57, 0x1C, 0x23, 0x1B,
-    0xC6, 0x58, 0xE1, 0x18, 0x27, 0x39, 0x06, 0x6F, 0xBE, 0x89, 0x31, 0xE4, 0xC4, 0x74, 0x8C, 0x8A,
-    0x63, 0x34, 0x3A, 0x06, 0xED, 0x82, 0x63, 0x18, 0x8E, 0xA1, 0x51, 0xBD, 0x66, 0x17, 0x34, 0x0F,
-    0xA2, 0x82, 0x82, 0x94, 0xBF, 0xF9, 0xF7, 0x80, 0x3F, 0x44, 0xED, 0x13, 0x1B, 0x20, 0x2D, 0x5B,
-    0x5E, 0xDC, 0x68, 0xCC, 0xE4, 0x22, 0xCA, 0x4F, 0xDE, 0x6E, 0x41, 0xC3, 0xCA, 0x15, 0x39, 0x16,
-    0x64, 0x4E, 0xD5, 0xC8, 0xC9, 0x08, 0x22, 0xAC, 0x8F, 0x30, 0x8A, 0x03, 0xD8, 0x42, 0x03, 0xCB,
-    0xBD, 0xF4, 0x10, 0x03, 0x34, 0x9A, 0xF6, 0x48, 0x75, 0x8F, 0xB7, 0x83, 0x04, 0x97, 0xD5, 0xF0,
-    0x83, 0x8C, 0x28, 0xAA, 0x99, 0x9D, 0x4E, 0xC3, 0x31, 0x5C, 0x8C, 0xBB, 0x33, 0x47, 0xF0, 0xB6,
-    0xE6, 0x09, 0x0A, 0x65, 0x7C, 0x18, 0x86, 0x81, 0x1D, 0x46, 0x0A, 0x79, 0xF1, 0x49, 0x68, 0x25,
-    0x42, 0xDE, 0x22, 0x06, 0xBF, 0x3F, 0xD2, 0x79, 0xCA, 0xBD, 0x80, 0xD0, 0x1C, 0x18, 0x36, 0xC4,
-    0xB1, 0xCD, 0x3C, 0x51, 0xE5, 0xF0, 0xA3, 0xBD, 0x75, 0x64, 0x5F, 0xB8, 0x8E, 0xF0, 0xF3, 0xD7,
-    0xA1, 0xF9, 0x9A, 0x04, 0xB0, 0x43, 0x37, 0xC9, 0x9C, 0x94, 0xCE, 0x0A, 0xD0, 0xFA, 0xE8, 0xA0,
-    0x0B, 0x34, 0xF5, 0xF5, 0xF5, 0xC6, 0x92, 0x42, 0x9D, 0xD0, 0x94, 0x25, 0x32, 0x2E, 0xC0, 0xE5,
-    0xFE, 0x04, 0xA6, 0xE0, 0x9A, 0x1E, 0x5E, 0x20, 0x1F, 0x88, 0x63, 0x3F, 0xA0, 0xFF, 0x11, 0xF3,
-    0x9D, 0xFD, 0x76, 0xDE, 0xC8, 0xB9, 0x06, 0xEB, 0x0B, 0x31, 0x5E, 0x22, 0x13, 0xEA, 0x75, 0x98,
-    0xB9, 0xB5, 0x5F, 0xC2, 0x24, 0x8B, 0x58, 0xC3, 0x6C, 0xB8, 0x57, 0x6C, 0xFD, 0x0F, 0xC1, 0x30,
-    0xEB, 0x88, 0x1C, 0x38, 0xCB, 0xE1, 0x45, 0x17, 0x3C, 0xA8, 0x8C, 0x5B, 0x87, 0xCF, 0xF1, 0x85,
-    0x15, 0x78, 0x9F, 0xCE, 0xAD, 0xF2, 0x34, 0xAA, 0xC2, 0xA7, 0xCD, 0x6D, 0x23, 0x23, 0x52, 0x04,
-    0xA7, 0x02, 0x7F, 0xC4, 0x5E, 0xBA, 0xF3, 0xFE, 0xE6, 0xC0, 0x59, 0x3A, 0x85, 0x81, 0x76, 0x03,
-    0x4A, 0x96, 0xA9, 0x0B, 0x57, 0x6C, 0x80, 0x81, 0x25, 0x90, 0x3B, 0xC0, 0xF4, 0x10, 0x20, 0x22,
-    0x90, 0xEA, 0xDF, 0x2E, 0x49, 0x41, 0x0B, 0x8B, 0xEA, 0xCC, 0xED, 0x61, 0x9B, 0x20, 0x11, 0xB2,
-    0x29, 0x7C, 0x74, 0x4C, 0x70, 0x35, 0xD6, 0x13, 0x93, 0xBF, 0xD1, 0xB5, 0x82, 0x1C, 0x55, 0x24,
-    0x4F, 0x24, 0x15, 0x76, 0x43, 0xFA, 0xE3, 0x58, 0x7E, 0x27, 0x6B, 0x50, 0x0A, 0xAC, 0x0D, 0x83,
-    0xB5, 0x58, 0x54, 0x43, 0x4B, 0x0C, 0x21, 0x29, 0x84, 0x36, 0x75, 0x8C, 0xCF, 0xC4, 0x4C, 0x5B,
-    0x60, 0x13, 0x42, 0x73, 0x07, 0x5A, 0xF1, 0xE6, 0x34, 0x46, 0x38, 0x00, 0x74, 0xC5, 0xA8, 0x63,
-    0x53, 0x29, 0x40, 0xAF, 0x0D, 0x96, 0x1D, 0xC3, 0xAE, 0xC3, 0x73, 0x86, 0x5A, 0xD0, 0x02, 0x45,
-    0x0D, 0x14, 0x26, 0x2C, 0x49, 0x0E, 0x48, 0x24, 0x18, 0xCB, 0x60, 0x8A, 0xE3, 0x34, 0xB9, 0x98,
-    0x67, 0x01, 0x27, 0xCD, 0x5C, 0xD7, 0x41, 0xE2, 0x53, 0x0E, 0x36, 0xB9, 0xBE, 0x25, 0xB5, 0x03,
-    0xEB, 0x3C, 0xEA, 0x96, 0x3E, 0x60, 0x03, 0x94, 0x6E, 0x02, 0xD0, 0xD9, 0x0C, 0xA1, 0x7F, 0xD8,
-    0xE6, 0x63, 0x12, 0xBE, 0x53, 0xFA, 0x8D, 0x55, 0x89, 0x82, 0xE3, 0x6A, 0x80, 0x45, 0x61, 0x75,
-    0xD6, 0xAD, 0x10, 0x2E, 0xE9, 0x59, 0x88, 0x0C, 0xFC, 0x47, 0xE0, 0x24, 0x7D, 0xA6, 0x53, 0xA1,
-    0x4F, 0xA1, 0x4B, 0x51, 0x8F, 0x82, 0x61, 0x53, 0x0D, 0xA0, 0x8F, 0x91, 0x91, 0xA5, 0x08, 0x56,
-    0x0B, 0xE0, 0x6D, 0x85, 0x68, 0x16, 0x7C, 0x88, 0xB6, 0x2C, 0x0B, 0xB8, 0x17, 0xF0, 0x01, 0xFB,
-    0x9E, 0xC8, 0xF8, 0xE2, 0x4B, 0xFF, 0x0C, 0x2C, 0x9F, 0xD0, 0x58, 0x21, 0xA0, 0xF0, 0x34, 0x43,
-    0xCA, 0x47, 0x2D, 0xB7, 0x05, 0x9C, 0x06, 0xF7, 0xE0, 0xD4, 0xD3, 0x53, 0x98, 0xE9, 0x71, 0xEC,
-    0xCC, 0x8A, 0xF7, 0x91, 0x01, 0xCF, 0x37, 0x5D, 0x78, 0x31, 0xD5, 0xD0, 0x95, 0x51, 0x23, 0x07,
-    0x0F, 0x77, 0x5F, 0x60, 0xA6, 0xAE, 0xD0, 0x0D, 0x3B, 0xB7, 0x97, 0xA0, 0x0B, 0xCA, 0xA4, 0x86,
-    0xEA, 0x46, 0x19, 0x49, 0x99, 0x24, 0x5E, 0x47, 0x3D, 0xDE, 0x8E, 0x3E, 0x20, 0x8C, 0x77, 0x63,
-    0x7E, 0xD2, 0xFB, 0x45, 0xCB, 0x05, 0xFA, 0xB7, 0x07, 0xAC, 0xD7, 0xED, 0x8B, 0x35, 0xCB, 0x21,
-    0x36, 0xBA, 0x0C, 0xA7, 0xB1, 0x88, 0xE6, 0xC2, 0xE8, 0x96, 0xC5, 0xEB, 0xC7, 0x6F, 0x31, 0xC3,
-    0x76, 0xB3, 0x4F, 0x40, 0xAF, 0xFA, 0xA8, 0x01, 0x1D, 0xCE, 0x2B, 0x53, 0xD8, 0x8F, 0x31, 0xF9,
-    0x75, 0xE6, 0xA8, 0xC8, 0xD7, 0x44, 0x7E, 0x8F, 0xE6, 0x08, 0x4F, 0xF0, 0xFB, 0x10, 0xD6, 0x86,
-    0xFE, 0xAD, 0x0F, 0x5D, 0x06, 0xE0, 0x66, 0xD1, 0x30, 0xC7, 0x93, 0x70, 0xCF, 0xD8, 0x02, 0x1A,
-    0xE8, 0xBF, 0x03, 0xD9, 0x6E, 0x00, 0xD1, 0x6E, 0x16, 0x0B, 0xEE, 0x07, 0x55, 0xE8, 0x56, 0x57,
-    0xFC, 0xAB, 0xF5, 0xC8, 0xFD, 0xB8, 0x8E, 0x64, 0x97, 0x90, 0x88, 0x90, 0x3B, 0x6A, 0x9C, 0x06,
-    0x2E, 0x68, 0xCB, 0x6B, 0xD5, 0xB7, 0x5D, 0x78, 0xCC, 0x3A, 0x5B, 0x67, 0x2E, 0x7F, 0xF2, 0x55,
-    0x6E, 0x78, 0x30, 0xFD, 0xB6, 0x84, 0x40, 0xC7, 0x18, 0xFB, 0xBA, 0x00, 0x47, 0xB0, 0x02, 0x7B,
-    0xBB, 0x6B, 0x19, 0x8D, 0x8B, 0x3D, 0xF5, 0x0C, 0xF9, 0x62, 0x86, 0x10, 0x0E, 0xBE, 0xEC, 0x3C,
-    0x2F, 0x83, 0x41, 0x78, 0xBD, 0xAC, 0x3A, 0x78, 0xF3, 0xF1, 0xF5, 0x34, 0x34, 0xA5, 0x57, 0x6C,
-    0x38, 0xD5, 0x48, 0xAE, 0x1C, 0x93, 0x51, 0x90, 0x1E, 0xF3, 0x8A, 0xE0, 0x34, 0x70, 0x7F, 0xD3,
-    0xA9, 0xE0, 0x06, 0x42, 0x90, 0xE2, 0x6C, 0xCB, 0xB3, 0x58, 0x03, 0xBB, 0xDD, 0x06, 0x9F, 0x72,
-    0xC8, 0x4C, 0x69, 0x36, 0x05, 0x6E, 0x65, 0xCA, 0xA8, 0x75, 0xEE, 0x95, 0x8B, 0x8D, 0x7B, 0xAB,
-    0xDA, 0x6E, 0xBC, 0x1F, 0x7F, 0xF0, 0xCB, 0xDA, 0xFB, 0xF1, 0x27, 0x9F, 0xD4, 0xC1, 0xB5, 0x7B,
-    0xD7, 0xAB, 0x10, 0xC1, 0x5E, 0x15, 0xBE, 0x61, 0xC2, 0x32, 0x7E, 0xBA, 0x43, 0xE0, 0xE2, 0xB6,
-    0x71, 0x91, 0x38, 0x97, 0x92, 0x0C, 0xC4, 0x0A, 0xBC, 0x15, 0xFE, 0x6F, 0x81, 0x70, 0xB7, 0xB5,
-    0x2F, 0x5F, 0xE2, 0x92, 0x25, 0x7A, 0xB5, 0x3E, 0x40, 0x46, 0x20, 0xE0, 0x60, 0xC7, 0x25, 0x89,
-    0x32, 0xA2, 0x18, 0x0D, 0xF6, 0xC1, 0x21, 0xA0, 0x93, 0xE3, 0x34, 0x62, 0x76, 0x0A, 0xDA, 0xDB,
-    0xD3, 0xC2, 0x27, 0x03, 0xAD, 0xBB, 0x20, 0x79, 0x9E, 0xC6, 0xE9, 0x28, 0x00, 0xB8, 0x03, 0x35,
-    0xC1, 0x41, 0x6F, 0x42, 0x2E, 0x23, 0xF1, 0xAF, 0xC3, 0xDA, 0xD6, 0x64, 0xFC, 0x0C, 0xB0, 0x06,
-    0x91, 0x3C, 0x34, 0x03, 0xD6, 0x6E, 0xC1, 0x78, 0x7D, 0xFD, 0xFB, 0x50, 0xC1, 0x9E, 0x3A, 0x8E,
-    0x95, 0xAE, 0x40, 0xA1, 0xB7, 0x80, 0x30, 0x40, 0x36, 0x58, 0x7E, 0xEA, 0xC2, 0xE2, 0x3D, 0x84,
-    0x08, 0x5E, 0x05, 0xA7, 0x5E, 0xAE, 0x42, 0xCF, 0xB7, 0x80, 0x3A, 0x9D, 0x62, 0x6B, 0xFA, 0x0F,
-    0xA9, 0xB8, 0x3F, 0xD3, 0xB0, 0xF6, 0x87, 0x0D, 0xB9, 0xF4, 0x32, 0x41, 0x66, 0x99, 0x56, 0xB6,
-    0x4C, 0x33, 0xDB, 0x24, 0xC1, 0x69, 0x2C, 0x48, 0xD9, 0x94, 0x60, 0x7F, 0x8E, 0xF8, 0x00, 0xC9,
-    0xF7, 0xB0, 0x53, 0xA7, 0xC9, 0x6B, 0xDC, 0xFB, 0x80, 0x35, 0xCB, 0x81, 0x0C, 0x15, 0xFB, 0x78,
-    0xD0, 0x1C, 0x5F, 0xAD, 0x5C, 0xD3, 0x7A, 0x93, 0x87, 0x98, 0xB5, 0x68, 0xB5, 0x52, 0xB1, 0xA8,
-    0x0C, 0x02, 0x33, 0xA6, 0x26, 0x51, 0x9C, 0x00, 0x51, 0x42, 0xA8, 0x46, 0x0B, 0x18, 0xE4, 0xD6,
-    0x47, 0x77, 0x27, 0x4C, 0x9D, 0x7A, 0xD6, 0xCB, 0x30, 0x43, 0xD0, 0x29, 0xF2, 0x13, 0x14, 0x62,
-    0x8B, 0x07, 0x6B, 0x16, 0x0E, 0x26, 0x1A, 0x6C, 0x5B, 0xEE, 0x8E, 0x15, 0x6B, 0x6D, 0x42, 0xB3,
-    0x18, 0x09, 0xB9, 0x15, 0x2E, 0xDF, 0xC6, 0xE4, 0x9C, 0x76, 0x9B, 0x59, 0xC5, 0x7A, 0xA0, 0x80,
-    0xB1, 0xA6, 0x91, 0x4B, 0x1A, 0x19, 0x4D, 0xB1, 0x19, 0xB8, 0xB6, 0x32, 0xC7, 0xBC, 0xB4, 0x76,
-    0xE8, 0xD3, 0x4B, 0xC5, 0xCD, 0xDE, 0x32, 0xE8, 0xAB, 0x1F, 0x07, 0x57, 0xD4, 0x24, 0x81, 0xB7,
-    0x3B, 0x5E, 0x82, 0x84, 0x13, 0x39, 0x75, 0x14, 0x13, 0x19, 0x8D, 0x30, 0xEC, 0xF2, 0x29, 0xCC,
-    0x71, 0x73, 0xD9, 0x69, 0x9D, 0x7A, 0xD5, 0x45, 0x34, 0x3B, 0xBE, 0xD5, 0x9B, 0x92, 0xBC, 0x20,
-    0x8B, 0xEE, 0x63, 0x8D, 0x7B, 0xD4, 0xF1, 0x3E, 0x69, 0x3D, 0xCE, 0x54, 0x25, 0x97, 0x40, 0xF6,
-    0x21, 0x2B, 0xD8, 0x49, 0xEF, 0x3D, 0xE6, 0xE4, 0xB7, 0x06, 0xB6, 0x4C, 0xE8, 0xF3, 0x34, 0xE9,
-    0xC9, 0xC0, 0x0E, 0xF2, 0x8E, 0x0A, 0x38, 0xC0, 0xDA, 0x47, 0xE4, 0x4F, 0x3D, 0xBA, 0x24, 0x4F,
-    0x32, 0x4B, 0x8C, 0xCD, 0xDA, 0x84, 0xE0, 0x1A, 0x48, 0xAD, 0x66, 0xE6, 0x3A, 0xC8, 0x5C, 0x70,
-    0x5B, 0xB7, 0x84, 0x1B, 0x28, 0x98, 0x4B, 0x3E, 0x21, 0x7E, 0xB6, 0xF8, 0xF2, 0xE5, 0x0F, 0x49,
-    0xF3, 0xC7, 0x3A, 0x2B, 0xCA, 0x97, 0x74, 0x25, 0x9C, 0x7A, 0xF8, 0xA7, 0x9C, 0xAB, 0x45, 0x10,
-    0xC8, 0xA9, 0x53, 0x4E, 0x59, 0x06, 0xBE, 0x8C, 0x8E, 0xF9, 0x55, 0x62, 0xD2, 0xF1, 0x7F, 0x23,
-    0x95, 0xF4, 0x33, 0x10, 0x20, 0x0A, 0xF6, 0x24, 0xBC, 0x67, 0xB1, 0x40, 0xF6, 0x34, 0x22, 0x5F,
-    0x5A, 0x61, 0xEA, 0x6B, 0x13, 0x8C, 0x0A, 0xAA, 0x47, 0xF2, 0xA4, 0x5C, 0x2C, 0x92, 0x91, 0x03,
-    0x24, 0x5E, 0x71, 0xCB, 0x45, 0x59, 0xF6, 0x8A, 0xC5, 0xA5, 0xDD, 0x17, 0x0B, 0x46, 0x8F, 0x99,
-    0xB2, 0xA4, 0xAF, 0x70, 0x97, 0x9F, 0xF3, 0x2E, 0x2D, 0xEF, 0x52, 0xCF, 0xEA, 0x75, 0xE5, 0x3E,
-    0xD9, 0x6A, 0x3E, 0x35, 0xC0, 0x76, 0xBF, 0x50, 0x5B, 0x9D, 0xC1, 0x42, 0x17, 0xCF, 0x62, 0x5F,
-    0x27, 0x10, 0xF0, 0x66, 0x98, 0x79, 0x45, 0x23, 0xA3, 0x50, 0xC2, 0xD7, 0x3E, 0xFD, 0xCB, 0x3A,
-    0x36, 0x93, 0x59, 0x6A, 0xEF, 0x12, 0x80, 0x94, 0x8C, 0xED, 0x04, 0x6F, 0x3A, 0xE2, 0xA7, 0x46,
-    0x54, 0xC3, 0x65, 0xFF, 0x7D, 0x70, 0x88, 0x00, 0x9F, 0xAE, 0xC1, 0x8B, 0xC9, 0x06, 0xBD, 0xD7,
-    0xC1, 0x18, 0xFD, 0x37, 0x4A, 0xB0, 0xE3, 0x67, 0x8B, 0xE4, 0x05, 0x13, 0xC0, 0xCB, 0x75, 0xD0,
-    0x3B, 0x73, 0x61, 0x2A, 0xC7, 0x53, 0x36, 0xFD, 0x79, 0x45, 0xD3, 0x9E, 0x0E, 0xA7, 0xB1, 0xA4,
-    0x09, 0xA8, 0x11, 0xF3, 0xFA, 0x4E, 0xB9, 0x09, 0xA2, 0x9C, 0x06, 0x57, 0x77, 0xFF, 0xB2, 0x8D,
-    0x61, 0xC2, 0xD3, 0x44, 0xE0, 0x81, 0x14, 0xBA, 0xD2, 0xCA, 0x42, 0xBA, 0x25, 0x4C, 0xBC, 0xE9,
-    0xE7, 0x7C, 0xC6, 0x67, 0xE2, 0x7F, 0xD4, 0x59, 0xE6, 0x33, 0xF6, 0x10, 0xD7, 0x44, 0xB7, 0xB0,
-    0x23, 0xE0, 0x26, 0xF1, 0xD4, 0xFB, 0x9C, 0x91, 0x47, 0x48, 0x65, 0x3A, 0x39, 0xE9, 0x55, 0x2B,
-    0x02, 0xD2, 0xFD, 0xAA, 0xF7, 0x4E, 0xE9, 0x54, 0xC7, 0x8E, 0x61, 0x12, 0x57, 0x36, 0xE4, 0xA8,
-    0x77, 0xAD, 0x90, 0x8D, 0xB0, 0x87, 0x06, 0xAC, 0x01, 0x5D, 0xDC, 0x6B, 0x15, 0x16, 0x01, 0x78,
-    0xCB, 0x4E, 0xC5, 0xC0, 0x14, 0x68, 0x6A, 0x11, 0x48, 0xFC, 0xE1, 0xFE, 0x1A, 0x64, 0x21, 0x27,
-    0x30, 0xFC, 0x71, 0xA0, 0xC1, 0x21, 0xA6, 0x31, 0x53, 0x2C, 0xA3, 0xC2, 0x5C, 0x62, 0xD6, 0xD8,
-    0x30, 0x74, 0x80, 0x71, 0x02, 0x90, 0x63, 0xBF, 0x84, 0x34, 0x40, 0x86, 0x81, 0x7A, 0xCC, 0x5C,
-    0x32, 0xEF, 0xFF, 0xE4, 0x10, 0x18, 0x05, 0xE5, 0x10, 0x1A, 0x7E, 0xCE, 0xCF, 0x57, 0x70, 0xB7,
-    0x07, 0x10, 0xB7, 0x9E, 0xC0, 0x94, 0x16, 0x94, 0x00, 0x4F, 0x93, 0x70, 0xA9, 0x2C, 0x07, 0x95,
-    0x03, 0x95, 0xF7, 0x52, 0xEC, 0x52, 0xBF, 0x5E, 0x47, 0x8A, 0x98, 0xA6, 0x9A, 0x66, 0xE3, 0x58,
-    0x47, 0xCA, 0x2F, 0xB8, 0x5A, 0x22, 0x4A, 0xB0, 0xE1, 0x01, 0xC3, 0x81, 0x47, 0x07, 0x9E, 0x4E,
-    0x2E, 0x1B, 0xBC, 0x76, 0x16, 0x01, 0x61, 0x23, 0xF9, 0x77, 0x53, 0x2D, 0xAD, 0xF2, 0x83, 0xA3,
-    0x6F, 0xA4, 0xB2, 0x03, 0x35, 0x53, 0x0E, 0x94, 0x76, 0xE0, 0x57, 0x2B, 0xE4, 0xDA, 0x00, 0x3E,
-    0xE8, 0x29, 0xD4, 0x14, 0xE3, 0x45, 0x60, 0x92, 0x31, 0x44, 0x90, 0x40, 0x14, 0x63, 0x98, 0x69,
-    0x2E, 0x97, 0xE9, 0xC2, 0x88, 0xAE, 0xC0, 0xB8, 0x19, 0x71, 0xAE, 0x86, 0x41, 0xF0, 0xFC, 0x98,
-    0x16, 0xA0, 0xE6, 0x32, 0x13, 0xBF, 0x1E, 0xF7, 0x01, 0xDB, 0x72, 0xFF, 0x65, 0x85, 0x44, 0xEB,
-    0xB8, 0x7C, 0x9D, 0xBA, 0x46, 0xE6, 0x65, 0x2A, 0xA7, 0xD2, 0xCA, 0x93, 0xBB, 0xFB, 0xAD, 0x86,
-    0xC1, 0x96, 0x4A, 0xCE, 0x86, 0xBD, 0xAE, 0xB9, 0x44, 0xBE, 0x14, 0x58, 0x60, 0x65, 0x39, 0x8A,
-    0x89, 0x08, 0xDF, 0xB0, 0xA8, 0x59, 0xD8, 0xF2, 0xDF, 0x9A, 0xAC, 0xBD, 0xDD, 0x04, 0xCA, 0xCA,
-    0x26, 0x10, 0x46, 0x46, 0xA3, 0x22, 0xC0, 0x64, 0xFE, 0x7C, 0xD9, 0xE4, 0x0A, 0x37, 0x88, 0x81,
-    0xA5, 0xCB, 0xAA, 0x99, 0xCF, 0x80, 0x12, 0xA1, 0x1E, 0x9C, 0x05, 0x27, 0xBC, 0x66, 0x8D, 0x91,
-    0xBC, 0xB9, 0xE8, 0xFC, 0x3A, 0xF7, 0xDA, 0xE4, 0xEA, 0x5C, 0x48, 0x2C, 0xAF, 0xEA, 0xE8, 0xA1,
-    0x9A, 0x07, 0x23, 0x89, 0x5A, 0xBD, 0xC2, 0x49, 0x45, 0x20, 0xDC, 0x8A, 0xE6, 0xD7, 0x29, 0xC2,
-    0xC7, 0xE9, 0x34, 0x75, 0xA5, 0x19, 0x8D, 0x7E, 0xC8, 0x18, 0xCC, 0x7B, 0x97, 0x7A, 0xC8, 0xA6,
-    0x96, 0x03, 0x8E, 0x65, 0x16, 0xC7, 0xA8, 0x3E, 0xC7, 0xA6, 0x3B, 0x38, 0xD4, 0xC7, 0xAF, 0xD8,
-    0x15, 0x4F, 0x3F, 0xC2, 0xCB, 0x21, 0x4D, 0xEA, 0x0D, 0x59, 0x4D, 0xF2, 0xE1, 0xAC, 0x7E, 0x86,
-    0xCD, 0x7B, 0x1F, 0x60, 0x77, 0xCA, 0x05, 0x02, 0x43, 0x3B, 0xE5, 0x15, 0x28, 0xD4, 0xD7, 0x99,
-    0x28, 0x2D, 0x03, 0xA7, 0x7C, 0x42, 0xAA, 0xAF, 0xBB, 0xD9, 0xC3, 0x72, 0xE9, 0x29, 0xA7, 0x3C,
-    0xEA, 0xCB, 0x89, 0x23, 0xEF, 0x80, 0xDB, 0x36, 0x2B, 0x92, 0xEC, 0xD1, 0x40, 0x79, 0x18, 0x06,
-    0xE0, 0x16, 0x5E, 0x06, 0x08, 0x78, 0x8A, 0x65, 0x1E, 0xDC, 0x02, 0x64, 0x2C, 0xA0, 0x23, 0xF8,
-    0xF4, 0x85, 0x72, 0xE5, 0x61, 0x39, 0x0E, 0x84, 0xF5, 0x8A, 0x27, 0x8E, 0xCB, 0x29, 0xEF, 0x5A,
-    0xE6, 0xFF, 0xCF, 0xE6, 0x29, 0xEC, 0x8A, 0x6F, 0xBD, 0x93, 0x7C, 0x55, 0x7D, 0x94, 0x79, 0x7D,
-    0xAC, 0xAC, 0x3E, 0x2A, 0x2E, 0x9E, 0xB2, 0xEB, 0x77, 0x07, 0x51, 0x85, 0x73, 0xD1, 0x8A, 0x9C,
-    0x95, 0x10, 0x5A, 0x17, 0x03, 0x5E, 0x16, 0x60, 0x75, 0x2B, 0xB0, 0x96, 0xFF, 0x03, 0x05, 0xBC,
-    0x37, 0xCF, 0xC4, 0x52, 0x09, 0x3E, 0x8F, 0x89, 0xD9, 0x24, 0x7E, 0x35, 0x98, 0xD7, 0xC1, 0xFD,
-    0x39, 0x37, 0x97, 0x41, 0x42, 0x03, 0xE5, 0x19, 0xC9, 0x62, 0x19, 0xC9, 0x02, 0xBC, 0xD1, 0x22,
-    0xF0, 0xF4, 0xE4, 0x31, 0xA9, 0x4F, 0x06, 0xE9, 0x4A, 0xE4, 0x15, 0x71, 0x04, 0x1C, 0x7A, 0x0B,
-    0x94, 0xF0, 0x46, 0xBA, 0x88, 0xDB, 0x45, 0x29, 0x82, 0x89, 0x22, 0xC9, 0x14, 0xD2, 0xFF, 0x88,
-    0xC6, 0x59, 0x49, 0x69, 0x2B, 0x28, 0x01, 0xB1, 0x3E, 0xD4, 0xE4, 0xFE, 0x83, 0xDB, 0x0A, 0xB0,
-    0xF7, 0x9A, 0xDA, 0x2B, 0xF1, 0x2B, 0x86, 0x21, 0x61, 0x51, 0xCC, 0x18, 0x40, 0x00, 0x2C, 0x56,
-    0x3C, 0x43, 0xE2, 0xA0, 0x29, 0x07, 0xE6, 0x1C, 0xE8, 0xE2, 0x03, 0xCD, 0xA4, 0x34, 0x43, 0xA6,
-    0x4D, 0xB9, 0x98, 0xA6, 0xD1, 0xF8, 0x32, 0xDD, 0x3F, 0x8B, 0xC3, 0x4C, 0xB3, 0x33, 0x43, 0x3B,
-    0xFD, 0xD9, 0x00, 0xB4, 0x62, 0xF7, 0x0E, 0x41, 0x82, 0xAF, 0xCA, 0xB2, 0x5B, 0xD0, 0xB7, 0x86,
-    0xE0, 0x4D, 0xA7, 0xDC, 0xD2, 0xC1, 0x7F, 0x03, 0x02, 0x3C, 0x4C, 0xB0, 0xC2, 0x7E, 0xA7, 0x5A,
-    0x7A, 0xA1, 0x7E, 0x62, 0xD0, 0x27, 0x14, 0xA5, 0x19, 0x8A, 0x7E, 0x7D, 0x67, 0xFD, 0x4D, 0x63,
-    0x7E, 0xCA, 0xBA, 0xD5, 0x4C, 0xFD, 0x93, 0x8B, 0x60, 0xB4, 0x9D, 0xDF, 0x78, 0xEF, 0x34, 0xF2,
-    0x6A, 0x27, 0x47, 0x13, 0x09, 0xC2, 0x22, 0xB8, 0x6E, 0xCC, 0x07, 0x8A, 0x62, 0xAD, 0x37, 0xE4,
-    0x2E, 0x96, 0xE7, 0x2C, 0xE5, 0x4F, 0xEE, 0x7E, 0x9F, 0x25, 0x8C, 0x55, 0x8D, 0xBD, 0x83, 0xDD,
-    0x33, 0xF0, 0x2E, 0xE9, 0x44, 0x36, 0xD6, 0xE4, 0x10, 0xEC, 0xF0, 0x7C, 0xE1, 0xFE, 0xA8, 0xF9,
-    0x83, 0x1A, 0x7A, 0x02, 0x78, 0x09, 0xA1, 0x7A, 0x87, 0xCF, 0x6A, 0x01, 0x84, 0x9E, 0x97, 0x8F,
-    0xE0, 0xA0, 0xEF, 0x2F, 0x21, 0x92, 0xC0, 0x7A, 0x93, 0x8A, 0x86, 0xC5, 0x24, 0x22, 0x68, 0xAE,
-    0x96, 0xDF, 0x6D, 0xB2, 0x4E, 0x1F, 0x03, 0xD5, 0xCA, 0x31, 0x03, 0x11, 0xD9, 0x8E, 0xA9, 0x49,
-    0x5B, 0x21, 0x9C, 0x27, 0x99, 0xC6, 0x02, 0xDB, 0x0B, 0xB0, 0xA7, 0xCC, 0xCD, 0x61, 0xAB, 0xA3,
-    0x74, 0x51, 0x99, 0x63, 0x04, 0x66, 0x14, 0x94, 0xF8, 0x83, 0x6B, 0x5F, 0x5E, 0x5F, 0xCF, 0x18,
-    0x75, 0xFA, 0xF8, 0x03, 0x4A, 0x0E, 0x05, 0x7A, 0x13, 0xC3, 0xDC, 0xC9, 0xC8, 0x0B, 0xC5, 0xFD,
-    0xF1, 0x79, 0x71, 0xAF, 0xFE, 0x10, 0x6E, 0x6A, 0xE3, 0x94, 0xD4, 0xA3, 0x43, 0xF2, 0xEA, 0x21,
-    0x2F, 0x03, 0x95, 0xAF, 0xA7, 0x2E, 0x22, 0xC5, 0x5D, 0xF3, 0x09, 0xC9, 0xF6, 0xD5, 0x9A, 0xF9,
-    0xD7, 0x00, 0xC2, 0x59, 0x3B, 0x42, 0xE8, 0xBE, 0x4D, 0x2E, 0x1A, 0x30, 0xA1, 0xE3, 0xF6, 0x04,
-    0xC4, 0x9C, 0x98, 0x01, 0x80, 0x0C, 0x58, 0x88, 0x20, 0xDB, 0x27, 0x64, 0xFA, 0x8A, 0x24, 0x3B,
-    0x9A, 0x4A, 0x2E, 0x99, 0x02, 0x61, 0xB6, 0x3B, 0xC5, 0x7F, 0xB1, 0x66, 0x93, 0xFA, 0x13, 0x4D,
-    0x1B, 0x67, 0xF4, 0x07, 0xB5, 0xD8, 0x3E, 0x99, 0x40, 0x53, 0xC7, 0x8F, 0xFF, 0x9B, 0x52, 0x3E,
-    0xFA, 0xB4, 0x9F, 0x15, 0xCB, 0xB2, 0x79, 0x0C, 0x1B, 0x7C, 0x04, 0xEA, 0x32, 0xC6, 0x75, 0xC1,
-    0xA7, 0x2F, 0x31, 0x2D, 0xB6, 0xA2, 0x5A, 0x86, 0x3D, 0x58, 0x00, 0x62, 0x93, 0xB5, 0x48, 0xC7,
-    0x80, 0x3E, 0x8D, 0x32, 0x0C, 0x6A, 0x6E, 0xEB, 0xAD, 0x19, 0x97, 0x96, 0x74, 0x39, 0x0F, 0x70,
-    0x80, 0x17, 0x2C, 0x24, 0x0F, 0x95, 0xA9, 0xEE, 0x00, 0xDB, 0x21, 0x4C, 0xA7, 0x88, 0xDF, 0xFF,
-    0x17, 0x4D, 0x8B, 0xB5, 0x4A, 0x12, 0xF9, 0x0B, 0x93, 0x66, 0xAA, 0x90, 0xCE, 0x74, 0x62, 0xA1,
-    0xD0, 0xD8, 0x9C, 0xEA, 0xD8, 0xAA, 0x6C, 0x62, 0x73, 0x9F, 0xB6, 0x9E, 0x3A, 0x64, 0x91, 0x0B,
-    0x55, 0xE5, 0xA0, 0xD6, 0x5F, 0xEE, 0xC4, 0x66, 0x13, 0x87, 0x26, 0x90, 0xE8, 0xE6, 0x64, 0x28,
-    0x7D, 0x0D, 0x55, 0xBB, 0xD4, 0x96, 0xC9, 0xB2, 0xA9, 0xEB, 0x97, 0x81, 0x04, 0x4F, 0xEB, 0xEF,
-    0x7B, 0x4C, 0x18, 0x44, 0x22, 0x2C, 0x99, 0xC6, 0x18, 0xE9, 0xC2, 0xBD, 0x52, 0x13, 0x4A, 0xAD,
-    0xA6, 0x6B, 0x99, 0x42, 0x67, 0xFC, 0x03, 0x95, 0xEC, 0x48, 0xC1, 0xB9, 0x0D, 0x9A, 0x92, 0x2F,
-    0x2C, 0xB7, 0x8E, 0xEB, 0x21, 0x25, 0x49, 0x1E, 0x09, 0xDE, 0x7F, 0xF8, 0x5B, 0x05, 0x71, 0xFA,
-    0xCA, 0x5C, 0x65, 0xC9, 0xD1, 0x90, 0x22, 0xD5, 0xFD, 0x60, 0x31, 0x74, 0xAF, 0x25, 0x4B, 0x73,
-    0x3F, 0x6B, 0xD3, 0x94, 0xB3, 0x62, 0xDA, 0x78, 0x5A, 0xCF, 0xD7, 0x64, 0x33, 0x1D, 0x85, 0x26,
-    0x54, 0xB5, 0x1E, 0x4A, 0x91, 0xA8, 0x45, 0xDB, 0x67, 0xC5, 0x0C, 0x21, 0x14, 0x5B, 0x1D, 0x85,
-    0x50, 0x75, 0xBB, 0xC9, 0x70, 0x6F, 0x92, 0x2B, 0xB7, 0x19, 0x0A, 0xAD, 0xC9, 0xC0, 0x24, 0xA7,
-    0x14, 0x46, 0xEF, 0x9B, 0x4F, 0xF3, 0xD8, 0x5F, 0x56, 0xAF, 0x25, 0xBB, 0x66, 0xD0, 0x27, 0xE7,
-    0x3E, 0x5A, 0xBF, 0xF0, 0xAB, 0xD7, 0x6B, 0x97, 0x96, 0xA8, 0x32, 0x87, 0x30, 0x95, 0x94, 0x93,
-    0xF4, 0xD4, 0x7B, 0x67, 0xD6, 0xDE, 0xF1, 0x9C, 0xAE, 0xAB, 0xB5, 0x88, 0x2B, 0x7A, 0x77, 0x0D,
-    0x2E, 0xE5, 0xEE, 0xFA, 0xFA, 0x05, 0xF5, 0x70, 0x24, 0xBA, 0x83, 0x98, 0x34, 0xF2, 0x75, 0x54,
-    0xDA, 0xDB, 0x6F, 0x5F, 0xB0, 0x14, 0x03, 0x40, 0x07, 0xA1, 0x05, 0x15, 0x2B, 0xFA, 0x35, 0x51,
-    0xA4, 0xA1, 0xBF, 0x5C, 0xE1, 0xB5, 0x4C, 0x97, 0xF0, 0x83, 0x1D, 0x84, 0x70, 0x60, 0xC2, 0xF2,
-    0x16, 0x66, 0xD7, 0x69, 0xA4, 0x9F, 0x37, 0x40, 0xCA, 0x27, 0xF8, 0x3E, 0x1C, 0xDA, 0x51, 0x3C,
-    0x6F, 0xBD, 0x6A, 0xF9, 0x90, 0x5C, 0x7A, 0xC5, 0x7D, 0xBD, 0x78, 0xF8, 0x90, 0x5B, 0x2F, 0x33,
-    0x52, 0xC3, 0x35, 0x59, 0xCC, 0x62, 0x5A, 0xD2, 0xB0, 0x98, 0x04, 0x3E, 0xED, 0x68, 0x5F, 0x50,
-    0x52, 0x71, 0xDD, 0x63, 0x6F, 0xA2, 0xC1, 0x4B, 0x3B, 0xBE, 0xC6, 0x3B, 0xC6, 0xD7, 0x5B, 0x75,
-    0xE3, 0x7D, 0x7E, 0x8E, 0xAB, 0x0E, 0xEE, 0xDD, 0xAB, 0x67, 0x65, 0x6A, 0x85, 0xA8, 0xD4, 0x66,
-    0x45, 0xEA, 0xA1, 0x46, 0x9B, 0xDA, 0x57, 0xBB, 0x41, 0xE4, 0x2A, 0x44, 0xD3, 0x53, 0x55, 0xA3,
-    0xCE, 0xFC, 0x60, 0x42, 0x15, 0xC3, 0x7F, 0x6A, 0x68, 0xD9, 0x7B, 0xE6, 0x4D, 0x56, 0x59, 0x9A,
-    0xA4, 0x4D, 0x26, 0x4F, 0x26, 0x13, 0xDF, 0xBC, 0x66, 0xEE, 0x64, 0x33, 0xD2, 0xA1, 0xDA, 0x3B,
-    0x4B, 0x8A, 0xEB, 0xCF, 0x43, 0x22, 0xDF, 0x70, 0xBE, 0x77, 0x30, 0xF5, 0x8B, 0x1E, 0xB6, 0xDC,
-    0x26, 0xCF, 0x22, 0xAA, 0x0A, 0xAF, 0xC1, 0xE3, 0xFC, 0x08, 0xC1, 0xB7, 0x6C, 0xDF, 0x61, 0xD0,
-    0x46, 0xEE, 0xA4, 0x5D, 0x46, 0x6C, 0xD5, 0x62, 0xBE, 0x49, 0x6C, 0x9F, 0x99, 0xF4, 0x3D, 0xC6,
-    0xEE, 0xC7, 0x49, 0xE1, 0x98, 0xF8, 0x3A, 0x02, 0xF3, 0xB0, 0x36, 0xAA, 0xC8, 0xBF, 0xA7, 0xFB,
-    0x33, 0x67, 0x32, 0xBF, 0x76, 0x81, 0x38, 0x2C, 0x16, 0x4E, 0xE7, 0xC5, 0xBE, 0x02, 0xF1, 0x68,
-    0xE8, 0xB3, 0xFB, 0xB6, 0xFC, 0xAA, 0xC9, 0x1F, 0x84, 0x08, 0xFF, 0x09, 0x6C, 0x28, 0x65, 0xD7,
-    0x89, 0xC3, 0x9E, 0x1E, 0x6B, 0x66, 0x2D, 0xF5, 0x6E, 0x9B, 0x6A, 0x9D, 0x70, 0xAF, 0xA2, 0x8C,
-    0x82, 0x2C, 0x7B, 0x6A, 0xA9, 0x26, 0x79, 0x38, 0x9F, 0x89, 0x2A, 0x7C, 0xAE, 0xBB, 0x31, 0xAD,
-    0x4D, 0xB0, 0xB7, 0x06, 0xF2, 0x68, 0x54, 0x0A, 0xDC, 0x0A, 0xD6, 0x5E, 0xE2, 0x77, 0x59, 0x54,
-    0x2D, 0x01, 0x18, 0x7E, 0x9D, 0x74, 0x5A, 0xA4, 0xCF, 0x00, 0x54, 0x86, 0x55, 0xD5, 0xC8, 0xF8,
-    0xDC, 0x41, 0xB7, 0x98, 0xC9, 0xFD, 0x29, 0x79, 0xF2, 0x60, 0xE6, 0x5D, 0x45, 0xAC, 0xB0, 0x20,
-    0x21, 0x78, 0xE3, 0x27, 0x95, 0x9C, 0x6C, 0x95, 0x66, 0xC0, 0x0B, 0x13, 0xA6, 0x30, 0x44, 0x94,
-    0x8B, 0x77, 0x13, 0x81, 0x50, 0x0C, 0x90, 0x35, 0xD2, 0x06, 0xED, 0x9F, 0xEB, 0x2A, 0x65, 0x9A,
-    0xB3, 0x5C, 0xA0, 0xF0, 0x3C, 0xA6, 0x4A, 0x85, 0x61, 0x88, 0x84, 0x7F, 0x4B, 0x6D, 0xBD, 0x53,
-    0x93, 0x36, 0x26, 0x50, 0x73, 0xEF, 0xE6, 0x4D, 0x96, 0x5E, 0x56, 0x09, 0xEA, 0xEF, 0xDA, 0x2D,
-    0x23, 0x7D, 0xA6, 0x19, 0xB8, 0x1F, 0x6B, 0xCF, 0x58, 0x9C, 0x17, 0xE2, 0xDF, 0xFC, 0x14, 0xEF,
-    0x4D, 0x92, 0xE7, 0x01, 0x5C, 0xD7, 0xEA, 0xBC, 0x74, 0xDA, 0xC3, 0x98, 0x06, 0xEE, 0x89, 0x45,
-    0xC8, 0x63, 0x20, 0x46, 0x74, 0xED, 0x7E, 0x8A, 0x00, 0xFA, 0x06, 0x4C, 0xF0, 0xCE, 0xF9, 0x54,
-    0xFE, 0xC7, 0xAD, 0x54, 0x16, 0xA0, 0x92, 0x6C, 0x4D, 0x0A, 0xDE, 0x02, 0xBD, 0x78, 0xF7, 0x36,
-    0x16, 0x80, 0xB1, 0x36, 0x1B, 0x86, 0x76, 0x6C, 0x4D, 0x83, 0xF5, 0x10, 0x58, 0x02, 0xF6, 0xA7,
-    0xB0, 0x4C, 0x5D, 0xCD, 0xCA, 0xD4, 0xD7, 0x7E, 0xAD, 0x32, 0xF5, 0x3B, 0x0F, 0x2C, 0x53, 0xDB,
-    0xEA, 0x02, 0xBB, 0x53, 0x6A, 0x66, 0x7F, 0x61, 0xC0, 0x03, 0x7F, 0x6E, 0x11, 0x2F, 0x27, 0x10,
-    0x84, 0x84, 0x39, 0xE5, 0xEA, 0x6A, 0xE7, 0x82, 0x2C, 0xF6, 0x12, 0x9D, 0x2B, 0xC3, 0x6B, 0xF0,
-    0x31, 0xF9, 0xD5, 0x36, 0x6C, 0xB7, 0x5D, 0x32, 0x14, 0xFC, 0x7B, 0x03, 0x56, 0x15, 0xD4, 0xDF,
-    0x5C, 0xCF, 0xA9, 0x13, 0x5A, 0x56, 0x17, 0xED, 0xAA, 0xD0, 0x09, 0xBB, 0xDA, 0x51, 0xA1, 0x33,
-    0xF6, 0x35, 0x8E, 0xB0, 0x35, 0x20, 0x2D, 0xE0, 0xE9, 0xF3, 0xC4, 0xAA, 0x85, 0x02, 0x24, 0xEB,
-    0x6B, 0x3A, 0x6B, 0xA7, 0x63, 0x9E, 0x45, 0xA7, 0xED, 0xB5, 0xE4, 0x10, 0x3A, 0xEF, 0xA0, 0xA6,
-    0x25, 0xBD, 0xBC, 0xEE, 0xFC, 0x9D, 0xE9, 0x22, 0xA8, 0x79, 0x23, 0xE1, 0xF3, 0xA9, 0x8C, 0x5A,
-    0x71, 0x6F, 0x65, 0x5A, 0xB1, 0x1A, 0xDA, 0x08, 0x59, 0xFF, 0xC2, 0xD6, 0xB9, 0xD0, 0x80, 0xF0,
-    0x59, 0x78, 0xDB, 0x10, 0x18, 0x1B, 0xCF, 0xDC, 0x10, 0x28, 0x5C, 0x30, 0x94, 0xAE, 0x3D, 0x2D,
-    0x5D, 0x03, 0xA8, 0x01, 0x6B, 0x13, 0xB1, 0x8D, 0x91, 0x32, 0x2D, 0x5D, 0xE7, 0x44, 0x6B, 0x7A,
-    0xCF, 0x09, 0xFD, 0x83, 0xAF, 0x2F, 0xC4, 0x43, 0xE9, 0x3A, 0x34, 0x16, 0xFE, 0x6D, 0xB3, 0x09,
-    0x5F, 0xB8, 0xBB, 0x7E, 0xB9, 0x63, 0x3A, 0x4A, 0xF3, 0xEB, 0xE0, 0x07, 0x70, 0x9B, 0xD6, 0xA3,
-    0x46, 0xF5, 0x9F, 0x61, 0x85, 0xF9, 0xB5, 0x62, 0xD6, 0xC2, 0xA4, 0x16, 0x48, 0x26, 0x7D, 0x09,
-    0x4C, 0xBF, 0x06, 0xDD, 0xAB, 0x59, 0x0F, 0x12, 0xD2, 0xB9, 0xC6, 0x63, 0xD2, 0xA5, 0x40, 0xEC,
-    0x93, 0x79, 0x2C, 0x39, 0x95, 0xEC, 0xE5, 0x65, 0x43, 0x0C, 0x4B, 0xC7, 0x6B, 0x60, 0x08, 0xDB,
-    0x98, 0x3E, 0x6E, 0xFB, 0xC4, 0x10, 0x26, 0x3F, 0x25, 0xF3, 0x15, 0x7A, 0xE2, 0x4A, 0x67, 0x8B,
-    0x1D, 0xAC, 0xD2, 0xF7, 0xEB, 0xDF, 0x1B, 0xEA, 0xF4, 0x62, 0x97, 0x2B, 0x43, 0xAD, 0x5E, 0x83,
-    0xC0, 0xA0, 0xB2, 0x5E, 0x44, 0x5D, 0x4B, 0x63, 0x5F, 0xB6, 0x0B, 0x17, 0x5B, 0xB5, 0xB7, 0x7C,
-    0xAF, 0x1F, 0xCA, 0xB7, 0x16, 0xBC, 0xB4, 0xA7, 0xC6, 0x8A, 0x40, 0x86, 0xFA, 0xBD, 0xD8, 0x0A,
-    0xBE, 0x4D, 0x81, 0x19, 0xCB, 0x27, 0xB4, 0xB0, 0xA0, 0x75, 0x7C, 0x91, 0x59, 0x25, 0x1F, 0x20,
-    0x1A, 0x9B, 0x22, 0xD4, 0xBD, 0xD6, 0x62, 0x4D, 0x44, 0x07, 0xA2, 0xDD, 0x61, 0xDA, 0x32, 0x69,
-    0x8B, 0xB6, 0x36, 0x2D, 0xAA, 0x4B, 0xB1, 0xA5, 0x1B, 0xAE, 0x9E, 0x39, 0xD1, 0x4E, 0xB4, 0x81,
-    0x11, 0x2E, 0x86, 0x5E, 0x76, 0x7B, 0x5F, 0xA2, 0x50, 0xAB, 0xCE, 0x5A, 0x76, 0x66, 0xDC, 0xF3,
-    0xFE, 0xD2, 0x8E, 0xD6, 0x20, 0xD4, 0x73, 0x36, 0xBA, 0x7E, 0x38, 0xE7, 0xB1, 0x7A, 0x38, 0x75,
-    0x97, 0x9D, 0xD6, 0x78, 0x99, 0x98, 0xFC, 0xDB, 0x0F, 0x21, 0x53, 0x4D, 0x97, 0x6F, 0x81, 0xA4,
-    0x9F, 0x6E, 0x59, 0x96, 0x57, 0xE9, 0x63, 0xD3, 0x7D, 0xB0, 0x7E, 0xC8, 0x2B, 0x62, 0x92, 0x19,
-    0x8E, 0x0E, 0xA8, 0x00, 0xD7, 0x56, 0xA9, 0xD2, 0x44, 0xEC, 0x11, 0x2E, 0x0E, 0xB6, 0xD0, 0xA3,
-    0x1D, 0xE1, 0xE6, 0x78, 0x34, 0x5A, 0xD2, 0x55, 0xED, 0x22, 0x36, 0x5A, 0x9A, 0x8B, 0xD4, 0xBE,
-    0x12, 0x75, 0xDC, 0x8B, 0x3A, 0xDC, 0xAA, 0x4E, 0x64, 0x4B, 0x13, 0x66, 0x9D, 0x72, 0x10, 0x72,
-    0x33, 0xD6, 0xFC, 0x31, 0x0B, 0x4F, 0x53, 0x4D, 0xDE, 0x5D, 0x18, 0x94, 0x36, 0x88, 0x2E, 0x4A,
-    0xD0, 0xD0, 0x18, 0x31, 0xFD, 0x46, 0xDD, 0xB2, 0x2D, 0x92, 0xD9, 0x24, 0x66, 0xAD, 0xEB, 0xD3,
-    0xEA, 0xB0, 0xB6, 0xB9, 0x11, 0xF3, 0xE0, 0x71, 0x29, 0xFE, 0xEF, 0x39, 0x67, 0x66, 0x72, 0x39,
-    0xA2, 0x7E, 0x5C, 0xF9, 0x58, 0xA0, 0x8F, 0x71, 0x35, 0x14, 0xF8, 0xFF, 0xBB, 0x7A, 0x6B, 0xC3,
-    0x11, 0x92, 0x14, 0x3E, 0x19, 0x33, 0x61, 0xEE, 0xB8, 0x92, 0x51, 0x98, 0x01, 0x05, 0xAE, 0x44,
-    0x69, 0x90, 0x39, 0x75, 0x4C, 0xFC, 0xC2, 0x4C, 0x22, 0x36, 0x1B, 0x61, 0xDC, 0x31, 0xFE, 0xC4,
-    0xAC, 0x1F, 0x49, 0x7C, 0xB9, 0x79, 0x32, 0x81, 0x7F, 0xF8, 0x57, 0x2D, 0xEB, 0x9B, 0x4E, 0x4B,
-    0x97, 0x15, 0xCB, 0x69, 0x13, 0x4D, 0x43, 0xF1, 0xE7, 0x2F, 0xA8, 0x70, 0xAA, 0x56, 0x3F, 0x57,
-    0x62, 0x73, 0x80, 0x8D, 0x0D, 0x79, 0xED, 0x56, 0x5E, 0xB9, 0xCC, 0x5A, 0xE8, 0xA9, 0x20, 0x43,
-    0x0C, 0x8B, 0xDF, 0xB2, 0x11, 0xC9, 0x15, 0xB7, 0x3A, 0xC9, 0x9C, 0xE3, 0x49, 0x69, 0x70, 0x77,
-    0xB9, 0x3B, 0x79, 0x0C, 0xD6, 0xDF, 0xEB, 0x7D, 0x5B, 0x5F, 0x45, 0xFA, 0x72, 0xFA, 0x9B, 0xEE,
-    0x63, 0xD0, 0x98, 0xC8, 0xD8, 0x5A, 0xCA, 0xDF, 0xFC, 0xC1, 0x97, 0xF4, 0x31, 0xFC, 0xE7, 0x6C,
-    0xE6, 0x9D, 0x5F, 0xCC, 0xA6, 0x37, 0xFE, 0xA2, 0x14, 0xB5, 0xFF, 0x79, 0x29, 0x6A, 0x4F, 0x5D,
-    0x19, 0x8C, 0xEB, 0x80, 0x6A, 0xAD, 0xF9, 0x94, 0x72, 0x7B, 0xD7, 0xE4, 0x1F, 0xF5, 0x72, 0x1F,
-    0x55, 0xDD, 0x99, 0x36, 0x46, 0x84, 0xC5, 0x30, 0x61, 0x6F, 0x46, 0x55, 0xC7, 0x32, 0xDF, 0xAB,
-    0xC0, 0xAA, 0x9B, 0xAE, 0x50, 0xD7, 0x3E, 0xD6, 0x9E, 0xF1, 0x74, 0xDA, 0x05, 0xA0, 0xE2, 0xC8,
-    0x86, 0xD6, 0x62, 0x8C, 0x78, 0xD9, 0xB0, 0xF2, 0xA1, 0xAF, 0x03, 0x86, 0x4E, 0xCC, 0xA7, 0x4D,
-    0x2C, 0x39, 0x8C, 0x75, 0x44, 0x96, 0x4F, 0x3B, 0xE5, 0x21, 0xAC, 0x6E, 0x91, 0x88, 0xFF, 0xA8,
-    0x61, 0xC7, 0x28, 0x42, 0x06, 0x87, 0xBD, 0x2D, 0x11, 0x9B, 0xC9, 0x26, 0xC0, 0x8F, 0x90, 0xBD,
-    0x54, 0x39, 0xA4, 0xEA, 0x7F, 0x3A, 0xB1, 0x11, 0xAF, 0x7A, 0x21, 0x7A, 0x40, 0x9D, 0x45, 0x54,
-    0xCD, 0x71, 0x54, 0x0D, 0x22, 0x34, 0x8B, 0xAE, 0x8E, 0x4A, 0x86, 0x8E, 0x8A, 0x15, 0xC4, 0x75,
-    0xB0, 0xFD, 0x55, 0xF6, 0x6C, 0x06, 0xC5, 0x02, 0x1B, 0x36, 0x17, 0x65, 0x91, 0x8D, 0xA2, 0x0D,
-    0x83, 0x00, 0xEF, 0x0E, 0x90, 0x04, 0x20, 0x6F, 0x94, 0xF1, 0xF2, 0x66, 0xEC, 0xD0, 0xAC, 0x55,
-    0x0C, 0x81, 0x4D, 0x8C, 0xBB, 0x0D, 0x36, 0x37, 0xCA, 0x76, 0x30, 0x69, 0x9D, 0x1E, 0xDE, 0x05,
-    0x6A, 0xB3, 0x3A, 0x9D, 0x14, 0x10, 0x5D, 0x1E, 0x90, 0x56, 0x8E, 0x99, 0x8C, 0x68, 0x87, 0xBE,
-    0x60, 0x4E, 0x30, 0xE6, 0x4E, 0xD3, 0xF8, 0xDD, 0xCB, 0x77, 0x2F, 0xD8, 0x19, 0x6A, 0x17, 0xBA,
-    0x2A, 0x46, 0x5E, 0x0C, 0x53, 0x8C, 0x5A, 0x9B, 0x5F, 0x77, 0x2F, 0x61, 0xA2, 0x51, 0xAA, 0x5D,
-    0x0D, 0x9C, 0xA7, 0x30, 0xBF, 0x2C, 0x8B, 0x9C, 0x48, 0x1B, 0xD1, 0xBE, 0x79, 0x6B, 0xB6, 0x9F,
-    0x26, 0xE4, 0x66, 0xB9, 0xF2, 0x3E, 0xC5, 0x4E, 0x2D, 0x30, 0xD7, 0xEE, 0xBA, 0x01, 0x3A, 0xE8,
-    0x8E, 0x46, 0xD3, 0x1D, 0xBD, 0xAF, 0x57, 0x57, 0xB4, 0xFC, 0xC7, 0xBF, 0xC4, 0x18, 0xED, 0x9B,
-    0x8F, 0x34, 0xCF, 0xA4, 0xC5, 0xBF, 0xC6, 0x7E, 0xCC, 0x96, 0x01, 0x6E, 0x6B, 0x11, 0xDB, 0x86,
-    0x58, 0xB9, 0x1A, 0x75, 0x64, 0x09, 0xAF, 0x3D, 0x3E, 0xA0, 0xAC, 0x37, 0x54, 0xDA, 0x19, 0x7E,
-    0x62, 0xF3, 0x12, 0x4C, 0x51, 0x84, 0x0D, 0x55, 0x24, 0x6C, 0xD4, 0x49, 0x36, 0x44, 0xE8, 0xB0,
-    0x1D, 0xFE, 0xBA, 0x46, 0xB5, 0x84, 0x1C, 0xCF, 0xA6, 0x29, 0xC4, 0x26, 0xBF, 0xBE, 0x26, 0x0E,
-    0x2B, 0xCE, 0x57, 0x24, 0x48, 0x4F, 0xB0, 0xAE, 0x80, 0xB9, 0xBD, 0xC7, 0x0C, 0xE1, 0xD6, 0x50,
-    0x01, 0x99, 0xB5, 0xD6, 0x6B, 0x80, 0xC6, 0x1D, 0x79, 0x0F, 0x51, 0x75, 0x8B, 0x97, 0x77, 0x84,
-    0x6D, 0x87, 0x41, 0xC5, 0xF9, 0x3E, 0xC6, 0xD9, 0xA6, 0x2C, 0x01, 0xFD, 0x1D, 0x40, 0xDD, 0x2F,
-    0x34, 0x82, 0x50, 0x4C, 0x5B, 0x05, 0x0D, 0x83, 0xF2, 0x69, 0x1B, 0xF0, 0xA6, 0x6D, 0xD9, 0x69,
-    0xB4, 0x99, 0x40, 0x83, 0x64, 0xBA, 0x45, 0xC8, 0x19, 0x0A, 0x3A, 0x62, 0x46, 0x06, 0xBB, 0xBA,
-    0xF4, 0xE2, 0xDF, 0x68, 0xBB, 0x2E, 0x61, 0xA7, 0x18, 0xFC, 0x93, 0xF6, 0x2B, 0x68, 0x2B, 0x68,
-    0x3C, 0xED, 0x2B, 0x82, 0xD6, 0x1E, 0x5E, 0x4A, 0x7D, 0x33, 0x79, 0x58, 0x6A, 0x07, 0x58, 0x73,
-    0xDC, 0xA9, 0xBC, 0xEC, 0x84, 0x3C, 0xE5, 0x15, 0x01, 0xF0, 0xA6, 0xF2, 0xD3, 0x87, 0x65, 0x03,
-    0xAF, 0x2F, 0xFD, 0xD5, 0x69, 0xDB, 0x99, 0x34, 0x4B, 0xB5, 0x5B, 0x8E, 0x89, 0x8F, 0xFF, 0x57,
-    0xD8, 0xEF, 0x36, 0x81, 0x1A, 0xD3, 0x6C, 0x61, 0x24, 0x5A, 0x0E, 0x3F, 0x86, 0x9D, 0x39, 0x01,
-    0x48, 0x3C, 0x01, 0x3B, 0x3C, 0x09, 0xF9, 0xB1, 0x19, 0xD5, 0x37, 0x97, 0x53, 0x3B, 0x72, 0x32,
-    0x94, 0xBE, 0x57, 0x87, 0x9C, 0x21, 0x93, 0xD9, 0xBF, 0x84, 0xB0, 0x3E, 0x29, 0xE7, 0xEA, 0x24,
-    0x43, 0x44, 0xF1, 0x50, 0xC8, 0x56, 0x97, 0xD1, 0x21, 0x39, 0xF5, 0x84, 0xBC, 0x7A, 0x5C, 0xEA,
-    0x27, 0x9D, 0xFA, 0xC4, 0x8B, 0x55, 0x78, 0xAF, 0xD0, 0xD0, 0x2D, 0x63, 0x0C, 0x87, 0x68, 0x23,
-    0xDC, 0x90, 0xAF, 0xD5, 0xCC, 0x01, 0xD9, 0x6D, 0x61, 0xFE, 0x1C, 0x3B, 0xB0, 0x88, 0xE9, 0xAC,
-    0xB2, 0x82, 0x88, 0x41, 0xDB, 0x05, 0x71, 0x1A, 0x44, 0x61, 0xF5, 0xCA, 0x21, 0xBF, 0xDE, 0x3A,
-    0x1A, 0x56, 0xDB, 0x0B, 0x39, 0x1B, 0x8E, 0xC0, 0xFB, 0x6F, 0x17, 0x41, 0x0F, 0x5D, 0xAA, 0x61,
-    0x1A, 0x75, 0x82, 0xC8, 0x78, 0x0C, 0xCE, 0xD1, 0x0F, 0xC7, 0x28, 0x60, 0xD9, 0x87, 0x02, 0x39,
-    0x7A, 0x48, 0x8E, 0x1F, 0x95, 0xD1, 0xF1, 0x47, 0xAE, 0x8C, 0x5E, 0xA9, 0x47, 0xFF, 0x58, 0x27,
-    0xA6, 0x0A, 0x7E, 0x59, 0x3A, 0xD7, 0x0A, 0xF7, 0xCD, 0xC2, 0x7D, 0x4E, 0x5B, 0x73, 0x6C, 0x52,
-    0x74, 0x48, 0x8C, 0x46, 0x83, 0x88, 0x17, 0x87, 0x20, 0x84, 0x88, 0x35, 0x41, 0x80, 0x68, 0x58,
-    0x59, 0x4C, 0x57, 0x80, 0x80, 0x23, 0xEC, 0x2C, 0x6B, 0x1E, 0x3C, 0x7C, 0x40, 0x97, 0xB9, 0xC9,
-    0x4D, 0xA6, 0xD1, 0xC4, 0xA9, 0x5B, 0xAB, 0xEF, 0x9C, 0xA5, 0x27, 0xE7, 0x92, 0xAD, 0x5F, 0x31,
-    0x3D, 0x79, 0x46, 0xFC, 0x5D, 0xCC, 0x25, 0x37, 0xC5, 0xB6, 0xD7, 0x3F, 0x5D, 0x8F, 0x61, 0x1C,
-    0x9B, 0x47, 0xCC, 0x2E, 0xF6, 0xC0, 0x98, 0xBB, 0x5B, 0xCE, 0x6E, 0x6E, 0x3A, 0xEA, 0x0C, 0xC2,
-    0x8A, 0xFE, 0xFB, 0x67, 0xE7, 0x0E, 0xED, 0xCC, 0xFC, 0x45, 0xD8, 0xA7, 0x07, 0xB3, 0xE9, 0xA1,
-    0x1D, 0x63, 0x43, 0x73, 0x04, 0x4C, 0xB3, 0x6E, 0xAF, 0xB3, 0x21, 0x08, 0x70, 0xBB, 0xE6, 0x5E,
-    0x37, 0x17, 0x1E, 0xF6, 0xCD, 0x6E, 0xB5, 0x63, 0x7A, 0x38, 0xA6, 0xFF, 0x35, 0x64, 0xCA, 0xE9,
-    0xB8, 0xCB, 0x83, 0x8C, 0xEA, 0x58, 0x20, 0x0A, 0xFA, 0xF4, 0x8C, 0x04, 0xBB, 0x42, 0xAB, 0xCF,
-    0x3A, 0x7F, 0x98, 0xCF, 0x95, 0x08, 0xF3, 0x59, 0xC6, 0x35, 0xBB, 0x5B, 0xEE, 0xA7, 0xD3, 0xF9,
-    0x60, 0xC4, 0xF5, 0xB9, 0xF9, 0xA8, 0x7D, 0xDB, 0xE6, 0xB7, 0x89, 0x1C, 0x4C, 0xEF, 0x9F, 0x0F,
-    0xBB, 0xC6, 0x6D, 0x5E, 0x5A, 0x8E, 0xCB, 0xBE, 0x12, 0xC0, 0x59, 0xAF, 0x88, 0xBB, 0xF0, 0xCD,
-    0x0F, 0x8F, 0x63, 0x1D, 0x4F, 0x79, 0x98, 0x5F, 0x94, 0xB3, 0x4A, 0xB6, 0xEB, 0xDB, 0x43, 0x24,
-    0xDC, 0x26, 0x38, 0xED, 0x3F, 0xF7, 0xB4, 0x96, 0xCC, 0x26, 0x97, 0x0B, 0x96, 0x39, 0x16, 0x5F,
-    0xE1, 0x64, 0x90, 0x20, 0x2C, 0x7C, 0xC8, 0x9E, 0xDD, 0xB2, 0xB1, 0x59, 0x34, 0x9C, 0xD9, 0x18,
-    0x6A, 0x61, 0xFE, 0x90, 0x8E, 0xFE, 0x82, 0x74, 0x2B, 0x49, 0x3D, 0x79, 0x93, 0xD7, 0x7A, 0xC6,
-    0x92, 0xEB, 0xB1, 0x9E, 0xEB, 0xE8, 0xFD, 0x89, 0xF6, 0x71, 0xD6, 0x63, 0x86, 0x3D, 0x92, 0x3C,
-    0xA7, 0xA7, 0x3B, 0xBC, 0x2E, 0x7F, 0x5E, 0x7B, 0x1C, 0x6F, 0xE8, 0x09, 0x0F, 0xE9, 0xED, 0x40,
-    0xBE, 0x3D, 0x0D, 0xC7, 0x20, 0x46, 0xA6, 0x0D, 0x95, 0x1A, 0xAF, 0xD5, 0xC3, 0x79, 0x9E, 0xC2,
-    0x12, 0x58, 0x0D, 0x90, 0x7B, 0xC3, 0x20, 0xDC, 0x35, 0x37, 0x76, 0xF9, 0xB2, 0xF9, 0x85, 0x39,
-    0x4F, 0x02, 0xDC, 0x25, 0x4D, 0xCE, 0x26, 0x50, 0xDF, 0x3C, 0x43, 0x01, 0x15, 0x79, 0x63, 0xC3,
-    0xA3, 0x3F, 0x94, 0x47, 0x14, 0x10, 0x75, 0x7D, 0x7E, 0x71, 0xD2, 0x22, 0xAB, 0x05, 0xDB, 0xC9,
-    0x97, 0x2E, 0xCE, 0x86, 0x1A, 0x06, 0x3E, 0x49, 0x12, 0x6F, 0xC2, 0x1C, 0x77, 0x17, 0x32, 0xBE,
-    0x74, 0xDA, 0xF1, 0xB3, 0x64, 0x9F, 0xBF, 0xE8, 0xB4, 0x35, 0xFF, 0x27, 0x3F, 0xD3, 0x45, 0xE5,
-    0x3B, 0x73, 0x9D, 0xE5, 0x79, 0x6F, 0x97, 0xD2, 0xDA, 0x25, 0x34, 0x76, 0x99, 0x9A, 0x43, 0xC8,
-    0xB5, 0x12, 0xBC, 0xDB, 0x6B, 0xDF, 0xDE, 0xF9, 0x96, 0xA1, 0x6E, 0x3B, 0x7E, 0xCF, 0x64, 0xAE,
-    0x79, 0xC3, 0x78, 0x46, 0x66, 0xE1, 0x2D, 0xA3, 0x5B, 0x06, 0xB7, 0x8C, 0x6D, 0x5F, 0xC3, 0x0D,
-    0x1A, 0x46, 0xB6, 0xB0, 0x45, 0x4F, 0xE3, 0x5A, 0xC6, 0x69, 0xB7, 0x6D, 0x0F, 0x27, 0x64, 0x03,
-    0xBC, 0x6E, 0xCE, 0x69, 0x87, 0x7E, 0xA6, 0xC7, 0xF6, 0x26, 0x6C, 0x75, 0x2A, 0x64, 0xCB, 0x61,
-    0x23, 0xB2, 0x76, 0x11, 0x59, 0xEE, 0x44, 0x5F, 0x7B, 0x84, 0xA4, 0xC0, 0x0C, 0x6D, 0xA5, 0xCA,
-    0xF3, 0xFE, 0xF0, 0x1B, 0xB2, 0xB1, 0x22, 0x55, 0x2D, 0x3F, 0x2A, 0xDC, 0x77, 0x53, 0xEF, 0xDF,
-    0x59, 0x13, 0x87, 0xFA, 0x87, 0x41, 0x79, 0x4C, 0x80, 0x95, 0xF5, 0x48, 0xEA, 0x15, 0x51, 0xB3,
-    0x87, 0x7E, 0x63, 0x61, 0xDF, 0xF9, 0xEA, 0x0D, 0xD2, 0xCD, 0xBE, 0x06, 0x69, 0x53, 0xB2, 0x3B,
-    0x82, 0x0D, 0xD2, 0xD3, 0x62, 0xBC, 0xCD, 0xC4, 0x57, 0x73, 0x4E, 0xF6, 0xF1, 0x75, 0x98, 0x53,
-    0xC5, 0x8E, 0x8F, 0x7A, 0xBE, 0xE3, 0x23, 0x9D, 0x76, 0x7C, 0x34, 0xEC, 0xF8, 0x40, 0x44, 0xAB,
-    0x41, 0x06, 0x61, 0x6E, 0x56, 0xCE, 0xFE, 0xDD, 0x75, 0x3E, 0xF7, 0x1A, 0x31, 0x75, 0x1A, 0x2F,
-    0xA9, 0x1A, 0x58, 0x27, 0xDE, 0xCD, 0x3C, 0x39, 0x7B, 0x95, 0xC4, 0x66, 0xF2, 0x9D, 0xB3, 0x9A,
-    0xC4, 0xD1, 0xF0, 0x91, 0xC1, 0x14, 0x3C, 0xE3, 0xE6, 0x10, 0x42, 0xD6, 0x3C, 0x65, 0xC3, 0x74,
-    0x77, 0x68, 0xBB, 0x16, 0xCB, 0x21, 0x7C, 0x2C, 0x18, 0x3D, 0xAD, 0x62, 0xB6, 0xDB, 0x2A, 0x23,
-    0x4C, 0xD2, 0x01, 0x55, 0xE4, 0x5E, 0x06, 0xBB, 0xFB, 0x1A, 0x9D, 0xFF, 0xBF, 0xB5, 0x7A, 0x8B,
-    0x3D, 0x4F, 0xA1, 0x5A, 0xAF, 0x4D, 0xBF, 0xB6, 0x15, 0x36, 0xB0, 0xF9, 0xBD, 0x6C, 0xCA, 0x79,
-    0xBF, 0x2D, 0x7F, 0xCC, 0xD3, 0x6D, 0xF7, 0x2D, 0xBB, 0xF1, 0x35, 0x72, 0xDE, 0x5B, 0x36, 0x23,
-    0xE7, 0x24, 0xB5, 0xCB, 0x5E, 0xC3, 0x22, 0xB6, 0x67, 0x99, 0xDA, 0xA9, 0x07, 0xDB, 0x52, 0xE6,
-    0xF0, 0xFF, 0xE0, 0xEA, 0x8B, 0xCF, 0xBA, 0xFA, 0x85, 0xC1, 0xD5, 0xDB, 0x7B, 0xED, 0x55, 0x14,
-    0xC9, 0x8A, 0x52, 0x45, 0xC7, 0xE0, 0xB8, 0xDC, 0xCC, 0x8E, 0x3E, 0xE5, 0x5E, 0x97, 0xD1, 0x46,
-    0x70, 0xDE, 0x6D, 0x72, 0xE3, 0xEE, 0xB2, 0xF6, 0xA9, 0x39, 0x88, 0x43, 0x74, 0xEC, 0x4F, 0xEC,
-    0x01, 0x62, 0x49, 0xA0, 0x66, 0xB5, 0x08, 0xFF, 0x83, 0x12, 0x60, 0xF3, 0x43, 0xE2, 0x75, 0xC1,
-    0xBC, 0xC7, 0xB8, 0x65, 0xAE, 0x24, 0x34, 0x99, 0x77, 0xBB, 0x66, 0x06, 0x6D, 0xDB, 0xA4, 0x63,
-    0x78, 0xC0, 0x1F, 0x34, 0xE1, 0xAD, 0x5A, 0xBA, 0xFC, 0xF5, 0xCE, 0x30, 0x37, 0x3A, 0x7E, 0xBE,
-    0xF2, 0xDA, 0xF1, 0x0F, 0x7E, 0x0A, 0xA8, 0x7E, 0xA6, 0xEF, 0x00, 0xD7, 0x70, 0xEA, 0xCF, 0x74,
-    0x02, 0x70, 0xA8, 0xF3, 0x22, 0xAC, 0x93, 0x2E, 0x6C, 0x9D, 0xDE, 0x85, 0x7B, 0x48, 0x11, 0xBE,
-    0xD5, 0x71, 0xED, 0x81, 0x30, 0x03, 0x38, 0xC8, 0x0E, 0xC7, 0x35, 0xF9, 0x79, 0x60, 0x01, 0x74,
-    0x68, 0xA7, 0x1E, 0xEB, 0xC6, 0x84, 0xF5, 0xF4, 0x50, 0xC9, 0x6C, 0x6B, 0x7C, 0x5B, 0x50, 0xD2,
-    0xE3, 0x0E, 0x90, 0x21, 0x34, 0x63, 0x9B, 0x07, 0x30, 0x30, 0x84, 0x47, 0x2E, 0x90, 0x17, 0x8B,
-    0x4D, 0xB4, 0xE9, 0xDD, 0x78, 0xE3, 0x46, 0xBA, 0xD2, 0x6E, 0xD7, 0xC1, 0xF9, 0x1B, 0xB1, 0x34,
-    0xE6, 0x66, 0x1D, 0x05, 0xDD, 0x9A, 0x5B, 0xE7, 0xCF, 0x95, 0x8B, 0x7E, 0x05, 0x50, 0x5C, 0x89,
-    0xA0, 0x8E, 0x4A, 0x1F, 0x35, 0xF0, 0x59, 0x19, 0x76, 0x48, 0x53, 0xCF, 0x27, 0x99, 0xD1, 0xDF,
-    0x82, 0x90, 0x5A, 0x07, 0x61, 0xAA, 0x57, 0x7B, 0x15, 0x4B, 0x26, 0x80, 0xA6, 0x2C, 0x4C, 0x23,
-    0x6C, 0xC2, 0x22, 0x84, 0xBF, 0x62, 0x4B, 0xE3, 0x97, 0x48, 0x23, 0x8E, 0xE2, 0xBF, 0xBB, 0x2F,
-    0xCD, 0xF2, 0x4C, 0x51, 0xF5, 0x40, 0x58, 0xB6, 0x3D, 0x68, 0x9A, 0x34, 0x0F, 0xBA, 0x59, 0x84,
-    0xBC, 0xC8, 0x3D, 0xD4, 0xF3, 0x63, 0x4E, 0x43, 0x06, 0xA7, 0x07, 0xC8, 0x82, 0x82, 0x90, 0xCD,
-    0x13, 0x64, 0xDA, 0x01, 0x68, 0xFB, 0xF8, 0x1D, 0xED, 0x40, 0x53, 0x36, 0x13, 0x4C, 0x2B, 0x62,
-    0x8D, 0x86, 0x73, 0xA9, 0x9E, 0x22, 0xD3, 0xB4, 0x68, 0xA6, 0xC7, 0xC8, 0xA8, 0xBC, 0x1C, 0xE8,
-    0x10, 0xFE, 0xE0, 0x2F, 0x1C, 0x77, 0x78, 0x91, 0x42, 0xE6, 0x14, 0xEF, 0x2F, 0x47, 0xCF, 0xEA,
-    0x9E, 0xFD, 0x71, 0xD1, 0x7E, 0x4C, 0x6D, 0xC8, 0x64, 0x47, 0x26, 0xD1, 0x93, 0x85, 0x22, 0x92,
-    0x61, 0x0A, 0x87, 0x5D, 0x99, 0x54, 0x21, 0x96, 0xCC, 0x93, 0x8A, 0x71, 0x4C, 0xA5, 0x07, 0x9F,
-    0x84, 0xAD, 0x99, 0x32, 0xED, 0xCD, 0x64, 0x97, 0x25, 0x76, 0x84, 0x87, 0x6F, 0x5B, 0x3D, 0x6F,
-    0xFB, 0xFA, 0xE4, 0x81, 0x22, 0x89, 0x66, 0xE6, 0xA5, 0x81, 0x8F, 0x6D, 0x1B, 0xD7, 0x13, 0x75,
-    0xB2, 0x45, 0xB9, 0xE8, 0x91, 0x3A, 0xAF, 0xA2, 0x5C, 0x78, 0xA6, 0x4E, 0xAB, 0x75, 0xF6, 0x50,
-    0x9D, 0x4D, 0xD8, 0xE8, 0xA9, 0x3A, 0x7B, 0xA8, 0x81, 0xC7, 0xEA, 0x14, 0x01, 0x94, 0xBC, 0x00,
-    0x06, 0x96, 0x96, 0xC6, 0x99, 0x1E, 0xAC, 0xD3, 0x8A, 0x54, 0x91, 0x0F, 0x03, 0x05, 0x85, 0xE6,
-    0x46, 0x22, 0x9E, 0xBE, 0xA4, 0x98, 0x8C, 0xD7, 0x7E, 0x66, 0x5A, 0x41, 0xBB, 0x31, 0x88, 0x22,
-    0xFA, 0x21, 0x0F, 0x7B, 0xA4, 0x21, 0xFB, 0xE7, 0xB0, 0x2E, 0x95, 0x05, 0xDB, 0xD6, 0x48, 0xD8,
-    0x13, 0xC6, 0xB2, 0x2C, 0x20, 0x50, 0x18, 0x01, 0x83, 0x78, 0x67, 0xE8, 0xFA, 0xBD, 0x21, 0x32,
-    0xD7, 0xA9, 0x3A, 0x77, 0x1A, 0xA1, 0x18, 0xCE, 0xBA, 0x96, 0xF6, 0xF7, 0x47, 0x17, 0x66, 0x29,
-    0x12, 0xFC, 0xBE, 0x61, 0xD5, 0xDD, 0xFF, 0xB1, 0x9D, 0x90, 0xF7, 0xC1, 0x64, 0xE8, 0xC6, 0x1F,
-    0x0F, 0x59, 0xD3, 0x58, 0xE9, 0x84, 0xCB, 0x4E, 0x87, 0x54, 0x93, 0xE1, 0xF6, 0x86, 0xDD, 0x60,
-    0x21, 0xD3, 0xB3, 0x3A, 0x13, 0x4B, 0xE9, 0xD8, 0x2A, 0x3D, 0x65, 0x23, 0xDD, 0xF0, 0xDB, 0x2C,
-    0x2D, 0xD9, 0x04, 0x80, 0x36, 0xEC, 0x16, 0x36, 0xDF, 0x10, 0x6B, 0x03, 0x6F, 0xC7, 0x28, 0x37,
-    0x30, 0xC6, 0xEC, 0x9F, 0xF5, 0x11, 0x66, 0x7E, 0x7E, 0x7A, 0xE3, 0x9E, 0xEE, 0x74, 0xED, 0xA5,
-    0x7E, 0x15, 0x13, 0x05, 0x79, 0x88, 0xCB, 0x2F, 0x16, 0x24, 0xFC, 0x08, 0xFC, 0x56, 0x53, 0x18,
-    0x05, 0xA2, 0x29, 0xED, 0x81, 0xE1, 0xE6, 0x38, 0x95, 0xFA, 0xC0, 0x58, 0x0F, 0x88, 0x32, 0x55,
-    0xB9, 0xFB, 0x82, 0xF6, 0xB3, 0x63, 0x14, 0x63, 0xC6, 0x3C, 0x4A, 0x67, 0xDE, 0xBC, 0xAE, 0xF9,
-    0x8D, 0x0D, 0x79, 0x85, 0x27, 0xF9, 0x32, 0x09, 0xDE, 0xDF, 0x1A, 0x62, 0xE4, 0xE0, 0x33, 0xCD,
-    0x37, 0x91, 0x6D, 0xD5, 0x35, 0xB6, 0x56, 0xA5, 0x4E, 0x72, 0x65, 0xDA, 0xA5, 0xAE, 0xCF, 0x98,
-    0x7B, 0xD4, 0x2F, 0x17, 0x20, 0xBD, 0x57, 0x74, 0x74, 0x66, 0xDF, 0x87, 0xB0, 0x28, 0xC3, 0x19,
-    0x3D, 0x9F, 0x6A, 0xA1, 0x79, 0xBD, 0x61, 0x95, 0x99, 0xA4, 0x30, 0xDF, 0xE3, 0xA2, 0xE5, 0x60,
-    0xA5, 0x58, 0x63, 0x0E, 0xFD, 0xC8, 0x83, 0x5A, 0x7F, 0xC0, 0x83, 0x44, 0x7B, 0x7F, 0x82, 0xCC,
-    0x65, 0xD2, 0x0A, 0xA1, 0xE2, 0x65, 0x3D, 0x75, 0xDF, 0xC9, 0xEE, 0x59, 0x1B, 0x52, 0x38, 0xB3,
-    0x40, 0xDB, 0x5C, 0xFC, 0x2B, 0xD1, 0x16, 0xE3, 0x98, 0xD2, 0xD7, 0x86, 0x5B, 0x3C, 0xF0, 0x98,
-    0xA5, 0xC7, 0x6E, 0xBC, 0x8B, 0xE7, 0xEA, 0x21, 0xD1, 0xD2, 0x68, 0xF4, 0x77, 0xF8, 0x65, 0xB6,
-    0xFD, 0x94, 0x49, 0xFF, 0xBF, 0x8B, 0x53, 0x58, 0xD3, 0x29, 0x4C, 0xFB, 0xA8, 0xCB, 0xB4, 0x10,
-    0x54, 0xE5, 0xFB, 0x53, 0x5E, 0xA7, 0x07, 0x71, 0x98, 0xFA, 0xAD, 0xDD, 0x8B, 0xE7, 0xDA, 0xA1,
-    0xBE, 0xD7, 0xD9, 0x90, 0x6F, 0x89, 0xB1, 0x29, 0x54, 0xE4, 0x56, 0x75, 0x22, 0xF5, 0x8A, 0x27,
-    0x70, 0x8F, 0x43, 0xC0, 0x46, 0xFF, 0x36, 0x5C, 0x4D, 0x3E, 0xDF, 0x06, 0x2F, 0x2C, 0xD6, 0xFA,
-    0x75, 0x9C, 0x61, 0xFF, 0x71, 0xBF, 0xDE, 0x6F, 0xBE, 0x90, 0x4B, 0x1E, 0xE9, 0x53, 0x9D, 0xB4,
-    0xE5, 0x4C, 0x7F, 0xFA, 0x82, 0x99, 0x21, 0x72, 0x63, 0x4F, 0x4D, 0x3B, 0x2F, 0x5C, 0xE6, 0x7B,
-    0x00, 0x22, 0x4C, 0x5D, 0x78, 0x0C, 0xDD, 0xE3, 0x09, 0x53, 0x3F, 0xDD, 0x11, 0x3B, 0x7B, 0x77,
-    0xD6, 0xD5, 0xEE, 0x6A, 0x13, 0x96, 0x49, 0xB9, 0x00, 0xF9, 0xEE, 0x8B, 0xFD, 0x20, 0x2A, 0xC5,
-    0x60, 0xAC, 0xE0, 0xF0, 0x2A, 0x35, 0x05, 0xFB, 0x7C, 0x39, 0xE3, 0x12, 0x7C, 0xDE, 0xBD, 0x84,
-    0xBF, 0x32, 0x39, 0xBC, 0x50, 0x0E, 0xF0, 0xCB, 0xE0, 0xE2, 0xAB, 0x7D, 0x8B, 0x71, 0x5A, 0xDB,
-    0xB5, 0x93, 0xA4, 0x9D, 0xF5, 0x0E, 0x56, 0xF3, 0x8D, 0xD7, 0x3D, 0x70, 0x41, 0xFF, 0xF1, 0x8F,
-    0x66, 0xCE, 0x2D, 0x2C, 0x2C, 0xD5, 0xA4, 0xC7, 0xA7, 0x3B, 0x4D, 0x27, 0x86, 0xF5, 0x17, 0xEE,
-    0x55, 0x00, 0xD7, 0xBA, 0xBF, 0x95, 0x9B, 0xC7, 0xD5, 0xA3, 0x4A, 0xB5, 0x64, 0x1C, 0xFE, 0x36,
-    0x5A, 0xB9, 0xD9, 0x2E, 0xA5, 0x07, 0x82, 0x82, 0x1A, 0x70, 0xF2, 0x59, 0x2C, 0xA5, 0xDE, 0xB3,
-    0x8A, 0xE8, 0x7E, 0x57, 0x77, 0x66, 0x61, 0x5A, 0xE5, 0x5D, 0x1D, 0xA2, 0x4F, 0x9F, 0x15, 0x50,
-    0x4E, 0x56, 0x07, 0xDF, 0xB6, 0xED, 0x37, 0x36, 0x7C, 0xF4, 0x2A, 0x87, 0x0A, 0xCE, 0xD3, 0xA6,
-    0x4A, 0xDA, 0xF5, 0x54, 0x42, 0xBE, 0x7F, 0x80, 0x28, 0xDD, 0x12, 0x6D, 0xED, 0x1F, 0x63, 0x0F,
-    0xC3, 0x3A, 0xB9, 0x0F, 0x72, 0x49, 0xCD, 0x0F, 0x68, 0x0E, 0x83, 0x55, 0x38, 0x19, 0xBE, 0xEE,
-    0xC3, 0xA3, 0xFA, 0xB2, 0xE2, 0x68, 0x0B, 0xAB, 0x1B, 0xB6, 0x40, 0x72, 0x48, 0xFB, 0xDF, 0x70,
-    0x7B, 0xDB, 0x77, 0xAE, 0x74, 0xAE, 0xD7, 0xD9, 0xD2, 0xCA, 0x76, 0x34, 0x16, 0xA1, 0x3B, 0x69,
-    0x2C, 0x4A, 0x1C, 0x29, 0x74, 0x35, 0x04, 0xA4, 0x55, 0x3D, 0xF0, 0xF7, 0x2C, 0xE3, 0x6A, 0x6D,
-    0x9E, 0x60, 0x72, 0x11, 0xE1, 0x93, 0x6B, 0x8B, 0x77, 0xB6, 0xD6, 0x8F, 0x0F, 0x33, 0xB8, 0xDC,
-    0xB1, 0x0C, 0x86, 0x55, 0x26, 0xB5, 0xDD, 0xDA, 0x72, 0xB6, 0x58, 0x1E, 0xC2, 0xD3, 0xED, 0x73,
-    0x65, 0xA8, 0x45, 0x9E, 0x7A, 0xCA, 0x86, 0x6C, 0xC3, 0x34, 0xF5, 0x22, 0x9E, 0xE1, 0xB2, 0x3D,
-    0xD2, 0x8A, 0x25, 0xBC, 0xFC, 0x79, 0x07, 0x6D, 0x93, 0xE9, 0x41, 0xDB, 0x8A, 0x1D, 0x40, 0x13,
-    0x19, 0xDF, 0x77, 0xD0, 0x76, 0x87, 0x07, 0x6D, 0xE3, 0xF9, 0x83, 0xB6, 0x40, 0xF2, 0x24, 0xCD,
-    0x65, 0xEE, 0xA0, 0x6D, 0xF2, 0x80, 0x83, 0xB6, 0x1A, 0xD1, 0xE4, 0x3C, 0x52, 0x3E, 0x77, 0xAC,
-    0x47, 0xEC, 0xD7, 0x26, 0x44, 0x6C, 0xAA, 0x68, 0xB1, 0x9E, 0x7B, 0x29, 0x5B, 0xA6, 0xDC, 0x2A,
-    0x3C, 0x2F, 0x6C, 0xA9, 0x47, 0xA0, 0x73, 0x42, 0xD8, 0x33, 0x15, 0x5C, 0x2F, 0x56, 0xB4, 0xA7,
-    0x3E, 0x5C, 0x95, 0x56, 0x9B, 0xA6, 0x40, 0xC1, 0xEB, 0xA1, 0x4B, 0x5F, 0x7D, 0xB2, 0x74, 0x94,
-    0x50, 0x5C, 0x50, 0xE8, 0xED, 0x8C, 0x46, 0xFD, 0xC5, 0x90, 0x4D, 0xD7, 0xE4, 0x00, 0x38, 0x3B,
-    0xF4, 0x7B, 0x8C, 0x25, 0xE8, 0xB9, 0x5D, 0x99, 0x3B, 0xB7, 0x1B, 0xDF, 0x7F, 0x6E, 0x97, 0x84,
-    0x74, 0xDF, 0xB9, 0xDD, 0x96, 0x49, 0x4C, 0x3D, 0xB7, 0x1B, 0xFE, 0x2A, 0xE7, 0x76, 0xA5, 0x05,
-    0x11, 0x8B, 0xD3, 0x89, 0xCD, 0x80, 0xE6, 0xF7, 0x23, 0x4A, 0x90, 0x39, 0x9D, 0x76, 0x89, 0x85,
-    0x12, 0x5E, 0xD1, 0x53, 0x04, 0x27, 0xA5, 0xAD, 0xB5, 0x4D, 0x6C, 0x14, 0xBC, 0x5E, 0xF2, 0x18,
-    0x81, 0x6C, 0xB2, 0x35, 0xF8, 0x2D, 0x30, 0x95, 0x3B, 0x65, 0x98, 0xF1, 0x1C, 0x01, 0xDB, 0x7E,
-    0x64, 0x68, 0x14, 0x9B, 0x1E, 0xB5, 0xD3, 0x26, 0x0E, 0xC2, 0x31, 0x20, 0x28, 0xD1, 0xCC, 0xF5,
-    0x7E, 0xB8, 0xDE, 0xAB, 0xC7, 0xFF, 0x87, 0x38, 0x91, 0xAA, 0xE7, 0x75, 0x41, 0xEE, 0x08, 0xC6,
-    0xF7, 0x33, 0xBB, 0x23, 0xBB, 0x74, 0x91, 0x29, 0xC2, 0xE8, 0x82, 0x07, 0x02, 0xC2, 0x94, 0x47,
-    0x5A, 0xDC, 0x8A, 0xDF, 0x26, 0xC0, 0xB6, 0x9B, 0x15, 0x7C, 0x78, 0x8D, 0x87, 0x6F, 0xD4, 0x4E,
-    0x38, 0x66, 0x3D, 0x3B, 0x15, 0x60, 0x1D, 0x8D, 0xED, 0xD8, 0xCA, 0x39, 0x7C, 0x9E, 0x05, 0xCC,
-    0x09, 0xB1, 0xE2, 0x96, 0xDA, 0x79, 0xFB, 0xEC, 0x89, 0x73, 0xB5, 0x2A, 0x33, 0xC1, 0xE4, 0xD6,
-    0x73, 0x1A, 0x41, 0xC4, 0x74, 0x03, 0xBF, 0x29, 0x06, 0x00, 0x84, 0xC5, 0x44, 0x2D, 0x3F, 0xDD,
-    0xD9, 0xF4, 0xB7, 0x6D, 0xBF, 0x20, 0xFA, 0x88, 0xF3, 0x0F, 0x5C, 0x85, 0x9B, 0x33, 0xF2, 0xEC,
-    0xB4, 0x1D, 0xCA, 0x2F, 0xF5, 0x9B, 0x81, 0x16, 0xB4, 0x01, 0x8A, 0xF4, 0x65, 0x71, 0xE9, 0x5B,
-    0xFC, 0x82, 0x92, 0xC6, 0x67, 0x5A, 0x8A, 0xCD, 0x50, 0xF6, 0xDB, 0x13, 0x58, 0x0A, 0xFC, 0x70,
-    0x0E, 0x96, 0xC9, 0xCE, 0x27, 0x94, 0x71, 0x72, 0xDA, 0x96, 0x8A, 0xE5, 0x4B, 0x7F, 0x88, 0x81,
-    0x0E, 0x05, 0xEB, 0xEA, 0x59, 0x2F, 0xB6, 0x7E, 0x61, 0x08, 0x97, 0xE6, 0x29, 0x6B, 0x84, 0x84,
-    0x88, 0x9D, 0xFF, 0x41, 0xA5, 0x7B, 0x10, 0x98, 0x7E, 0xBD, 0x53, 0x90, 0xB1, 0xA5, 0x61, 0x2C,
-    0x2F, 0x2E, 0x98, 0x34, 0xAF, 0x5C, 0x63, 0x51, 0xD0, 0xE6, 0x2F, 0x6A, 0xCA, 0x09, 0x1A, 0x71,
-    0xF0, 0x9F, 0x34, 0xDE, 0x6B, 0x82, 0x42, 0x9D, 0xA0, 0x9E, 0x31, 0xFF, 0x02, 0xF7, 0xF7, 0x27,
-    0x04, 0xB8, 0xF9, 0x8E, 0xB0, 0x05, 0xDB, 0x11, 0xB6, 0xAA, 0x14, 0x2E, 0xBC, 0xB8, 0xC4, 0x8E,
-    0x30, 0x04, 0x3A, 0xE9, 0x17, 0x75, 0x84, 0x81, 0x03, 0xA6, 0x16, 0x76, 0x1D, 0x4D, 0x99, 0xE5,
-    0x9F, 0x37, 0xDE, 0xEF, 0xF2, 0xA8, 0x1C, 0x28, 0x8D, 0x0F, 0x46, 0x4F, 0xEC, 0xE8, 0xF7, 0x5A,
-    0x7E, 0x9D, 0x33, 0xFC, 0xEE, 0x23, 0x09, 0xCF, 0xC4, 0xA0, 0x74, 0x89, 0xE5, 0x8C, 0x58, 0x5D,
-    0x62, 0x0A, 0xE7, 0x6E, 0x6E, 0xA9, 0x5A, 0x54, 0x14, 0xEE, 0xC4, 0xBF, 0xCB, 0xB0, 0x7D, 0x62,
-    0x67, 0xBC, 0x17, 0x0E, 0x5D, 0x66, 0x83, 0x8B, 0xB9, 0x3F, 0x58, 0xC2, 0x4D, 0x0F, 0xD8, 0x32,
-    0x01, 0xCF, 0x9F, 0x42, 0x7C, 0x31, 0x19, 0x18, 0x1C, 0x1C, 0xA0, 0x0D, 0x13, 0x47, 0xD8, 0x16,
-    0x5E, 0xD3, 0xA3, 0x0E, 0xFC, 0x56, 0xA2, 0xCE, 0x72, 0x1E, 0x9B, 0xBA, 0x52, 0x0C, 0x55, 0x0F,
-    0xD5, 0x4F, 0xD3, 0x0B, 0xB4, 0x74, 0xD6, 0x79, 0x58, 0xBF, 0x62, 0xDF, 0x09, 0xB3, 0x31, 0xF7,
-    0x1D, 0x44, 0x61, 0x38, 0x6E, 0xEE, 0x66, 0x0F, 0xDA, 0xCF, 0xDF, 0xC9, 0x39, 0x12, 0x46, 0x74,
-    0x01, 0xF7, 0x3C, 0xC9, 0x26, 0xD8, 0xF2, 0xE0, 0x7E, 0x16, 0x72, 0x30, 0x95, 0x27, 0xED, 0xF9,
-    0x73, 0x1E, 0xD0, 0xC5, 0x74, 0xB8, 0xD9, 0x30, 0x2E, 0x85, 0xF5, 0xE8, 0x34, 0x8D, 0x85, 0x18,
-    0xC4, 0xCC, 0xA3, 0xCB, 0xB6, 0xA9, 0xC0, 0xB6, 0x41, 0x71, 0xEC, 0x6A, 0x08, 0xE6, 0x95, 0x38,
-    0x30, 0xC4, 0xD7, 0x93, 0xD5, 0xF4, 0xA0, 0xEA, 0x7C, 0xD5, 0x83, 0xDE, 0xCF, 0x29, 0x38, 0x1D,
-    0xA8, 0x60, 0x36, 0x9D, 0xCE, 0x03, 0x09, 0xAC, 0xF6, 0x88, 0x69, 0xB9, 0x27, 0xE6, 0x96, 0xAD,
-    0xD2, 0x53, 0xB7, 0x1A, 0x30, 0x46, 0x6C, 0xC6, 0x60, 0x78, 0xF7, 0xD7, 0xA5, 0x6D, 0xF8, 0x53,
-    0xE9, 0x6B, 0xC7, 0x9F, 0x3F, 0x99, 0x56, 0xB5, 0x6C, 0xFA, 0x77, 0x5A, 0x43, 0x9C, 0x0C, 0x59,
-    0x58, 0x9E, 0x85, 0x75, 0xE7, 0x0E, 0x96, 0xAA, 0xBD, 0x30, 0x67, 0x99, 0x69, 0xE2, 0xD2, 0xF9,
-    0xB9, 0x1C, 0x7A, 0xC0, 0x6E, 0x69, 0x25, 0xC9, 0x2F, 0xEC, 0xD7, 0x99, 0x68, 0xBD, 0x76, 0x91,
-    0xAE, 0x2F, 0xA6, 0x2A, 0x52, 0xEF, 0xD7, 0x14, 0xA8, 0xAF, 0x33, 0x8F, 0x73, 0x47, 0xB5, 0xA3,
-    0x9D, 0x45, 0xC4, 0xFD, 0x2C, 0x4F, 0xA5, 0x34, 0x54, 0x73, 0x21, 0x7A, 0xE0, 0x5E, 0x5B, 0x57,
-    0x6C, 0xFF, 0x4D, 0x69, 0x8F, 0x8D, 0xEF, 0xFD, 0x3C, 0xC6, 0xB3, 0x39, 0xFA, 0xBD, 0x01, 0x58,
-    0x33, 0x76, 0x6F, 0x62, 0x9B, 0x2F, 0xBE, 0xE4, 0x47, 0x35, 0x4A, 0x35, 0xDB, 0x4A, 0x4D, 0xFB,
-    0x91, 0xAD, 0x52, 0xC1, 0x43, 0x33, 0x37, 0x41, 0xC1, 0xD9, 0x96, 0x64, 0xD5, 0x2B, 0x49, 0x26,
-    0x32, 0xC8, 0xCE, 0x76, 0x25, 0xAB, 0x6A, 0xD9, 0x76, 0x4E, 0x0B, 0x0C, 0xFA, 0x9C, 0xDA, 0x65,
-    0x73, 0xCB, 0x63, 0xED, 0x6F, 0x9C, 0xEC, 0x73, 0x2A, 0x8B, 0x5A, 0x46, 0xE5, 0x86, 0x8E, 0x9F,
-    0xDE, 0xE7, 0x54, 0xDC, 0x4C, 0xFE, 0x08, 0x32, 0x5B, 0x0E, 0xF4, 0x7C, 0x18, 0xCF, 0xC8, 0x39,
-    0x80, 0x69, 0xB7, 0x3E, 0x29, 0x6C, 0xE5, 0xF5, 0x4B, 0x1E, 0xD4, 0x5E, 0x81, 0x40, 0xD6, 0x1C,
-    0x3D, 0xEB, 0x9E, 0x92, 0x28, 0x05, 0x93, 0x69, 0x9E, 0x6C, 0x7B, 0x88, 0x8F, 0xBA, 0xD9, 0x09,
-    0x40, 0x30, 0x46, 0x22, 0xD7, 0x98, 0x64, 0x7A, 0x3F, 0x5D, 0x7C, 0x44, 0x4A, 0x5F, 0x9E, 0x90,
-    0x0D, 0xB7, 0x38, 0x24, 0xA7, 0x9C, 0xD2, 0x4B, 0x8F, 0xCB, 0x2B, 0x7E, 0xE1, 0xBF, 0xC6, 0xFC,
-    0x57, 0xEA, 0x4C, 0x36, 0xEC, 0x91, 0x98, 0x4A, 0xAB, 0xD7, 0xBF, 0xD1, 0xAF, 0xBE, 0xD1, 0x6A,
-    0x43, 0x3D, 0x6D, 0xD3, 0xE1, 0x2D, 0x8E, 0xCE, 0x26, 0x75, 0x78, 0xD6, 0x5C, 0xF9, 0xD9, 0x63,
-    0x07, 0x43, 0x73, 0x65, 0x67, 0x6F, 0x5E, 0xB0, 0x61, 0x7F, 0x3F, 0xFB, 0xD5, 0x19, 0x10, 0x18,
-    0x29, 0x7E, 0x5B, 0xC6, 0xAF, 0xC6, 0xD9, 0x97, 0xEC, 0x3F, 0x14, 0xF8, 0x84, 0xAA, 0x98, 0x67,
-    0xBF, 0xD3, 0x4C, 0x8F, 0x6B, 0x6B, 0x1D, 0xD1, 0xB7, 0xE7, 0x64, 0x76, 0x6C, 0xFD, 0xAC, 0xD4,
-    0x73, 0x09, 0x9D, 0x12, 0x84, 0x38, 0xF3, 0xEE, 0xE6, 0x99, 0x5E, 0xBC, 0xA0, 0x17, 0x3B, 0x55,
-    0xC0, 0x8B, 0x8F, 0xB1, 0x52, 0x0F, 0x16, 0xA0, 0x17, 0x6F, 0x81, 0x9F, 0xC4, 0x4E, 0x5E, 0x68,
-    0xB6, 0xB6, 0xF6, 0x5B, 0x75, 0xB0, 0x39, 0x8B, 0xA5, 0x43, 0x4B, 0xC4, 0xBE, 0xA9, 0xB3, 0x85,
-    0x81, 0x82, 0xEB, 0x99, 0xEB, 0xED, 0x1F, 0x60, 0xE3, 0xBF, 0xC1, 0x83, 0x4F, 0x7B, 0xDF, 0x7C,
-    0xB0, 0xA6, 0xDF, 0x7C, 0xA0, 0x5D, 0x15, 0x5A, 0x3E, 0x19, 0x4A, 0xE2, 0xE3, 0xBD, 0x6F, 0x3E,
-    0x78, 0x56, 0xBF, 0xF9, 0xE0, 0x46, 0xB9, 0x57, 0xF2, 0x9E, 0xFF, 0xE6, 0x83, 0xF6, 0x41, 0xDF,
-    0x7C, 0x90, 0x3E, 0xE0, 0x9B, 0x0F, 0x7E, 0x99, 0xF1, 0x9B, 0x0F, 0x86, 0xDC, 0x90, 0xA6, 0x2D,
-    0x94, 0x5F, 0xBB, 0x33, 0x5F, 0xF0, 0xA4, 0x1C, 0x64, 0x47, 0x4C, 0xE6, 0xF0, 0x24, 0x13, 0x4B,
-    0x9C, 0xC1, 0x9B, 0xB8, 0xCB, 0x9D, 0x62, 0x40, 0xA6, 0xD2, 0x02, 0x39, 0x7D, 0x87, 0x7F, 0x0B,
-    0x4E, 0xE8, 0x03, 0x4E, 0x9C, 0x59, 0x73, 0xD2, 0x40, 0x85, 0x84, 0x64, 0x38, 0x90, 0x83, 0x9F,
-    0xFF, 0x0B, 0x7D, 0x55, 0x3F, 0x6C, 0xDE, 0x44, 0x14, 0xFF, 0x9D, 0x8F, 0xC6, 0xAD, 0x0E, 0x7A,
-    0x1D, 0x3A, 0x40, 0xA5, 0xD4, 0x08, 0x31, 0x64, 0x48, 0xEB, 0x22, 0x65, 0xE8, 0xD0, 0xF4, 0x2C,
-    0x3A, 0x30, 0x14, 0x89, 0x32, 0x64, 0x86, 0x81, 0x01, 0x26, 0x18, 0x18, 0x90, 0x08, 0x7C, 0x46,
-    0x0C, 0x45, 0x62, 0x40, 0x2C, 0x4C, 0x0C, 0x65, 0x24, 0x0C, 0x44, 0xA8, 0x43, 0x25, 0x92, 0xD8,
-    0x69, 0x25, 0xBA, 0x1A, 0x58, 0x2B, 0x61, 0x04, 0xEC, 0x47, 0x65, 0x21, 0xB7, 0xF2, 0xF7, 0x99,
-    0xDF, 0xBB, 0xFB, 0x9A, 0x7E, 0x69, 0x0B, 0x97, 0xF8, 0xE2, 0xBC, 0xBB, 0xF7, 0xEF, 0xF7, 0x7E,
-    0xEF, 0xF9, 0xD4, 0xD6, 0x96, 0x1D, 0xC7, 0xDB, 0xE3, 0xE8, 0x4F, 0x2D, 0xBE, 0x6D, 0x5D, 0x1B,
-    0xB9, 0xAE, 0xF2, 0x99, 0xE2, 0xC8, 0xC6, 0x46, 0xA1, 0xF9, 0x36, 0x38, 0x6E, 0x05, 0xB8, 0x28,
-    0xD9, 0xB8, 0x02, 0x91, 0xCD, 0xA5, 0xE3, 0x58, 0x02, 0xFF, 0x7F, 0x12, 0x97, 0x4F, 0x6A, 0x9C,
-    0x87, 0xC7, 0x32, 0xDE, 0x87, 0xC5, 0x2A, 0x74, 0x69, 0xA1, 0x1A, 0x5D, 0x62, 0x5B, 0x35, 0xB8,
-    0x80, 0x6D, 0x1E, 0x9C, 0x87, 0xE1, 0xAE, 0x6B, 0x03, 0xB4, 0xBA, 0xE6, 0xBD, 0x36, 0x1C, 0x1C,
-    0xE7, 0x9E, 0x16, 0xC7, 0x91, 0xD4, 0x69, 0x11, 0xCC, 0xC8, 0xC1, 0xEA, 0xDC, 0x0C, 0x12, 0x86,
-    0xBC, 0x95, 0x88, 0xBB, 0x5A, 0xB6, 0xE6, 0xA1, 0xC7, 0x25, 0x1E, 0x7C, 0x1B, 0x02, 0x7A, 0x39,
-    0x1C, 0x57, 0xA5, 0xAB, 0xB3, 0xC6, 0xB6, 0xA9, 0xD7, 0x83, 0x9A, 0x02, 0x7A, 0xAA, 0x07, 0xD3,
-    0x59, 0x9F, 0xD5, 0xAE, 0xAC, 0x80, 0x8D, 0x83, 0xFF, 0x1B, 0x57, 0x57, 0xC5, 0xE1, 0xDB, 0xD5,
-    0xE7, 0x9D, 0x1E, 0x28, 0xF8, 0x65, 0x8A, 0x99, 0xC8, 0x2A, 0xB8, 0x5B, 0xBD, 0x9A, 0x66, 0x8D,
-    0x9E, 0xBA, 0xC6, 0xDD, 0xA6, 0x5E, 0x85, 0xD1, 0xB6, 0xD9, 0xFE, 0xA0, 0x7B, 0x5A, 0x33, 0xFE,
-    0x31, 0x7B, 0x93, 0xDB, 0x7D, 0xB0, 0xF0, 0xFB, 0x8C, 0x17, 0xBD, 0xEE, 0x26, 0x45, 0x7E, 0x73,
-    0x10, 0x63, 0x21, 0xD6, 0xEB, 0x60, 0x36, 0x04, 0x09, 0x38, 0xCB, 0xC0, 0x98, 0xC4, 0x05, 0x20,
-    0xAD, 0x81, 0x1B, 0x94, 0x17, 0x22, 0xCF, 0xC6, 0xF1, 0x16, 0x81, 0xC5, 0x3A, 0x8F, 0x29, 0xDF,
-    0x04, 0x0C, 0xE1, 0xED, 0x82, 0x9A, 0xA2, 0x8D, 0x33, 0x51, 0x2E, 0x6A, 0xE5, 0xA2, 0xB9, 0xD3,
-    0x44, 0x88, 0xE6, 0x08, 0x94, 0xE2, 0xF1, 0xD1, 0x07, 0xD8, 0xC8, 0x25, 0x53, 0xC4, 0x5B, 0x19,
-    0x82, 0x57, 0x31, 0x2D, 0xFA, 0x62, 0x5B, 0xFC, 0x8A, 0x71, 0x7A, 0xD4, 0x42, 0x84, 0xA4, 0x8D,
-    0x51, 0x89, 0x0B, 0x09, 0x4B, 0x7C, 0xDB, 0x87, 0xEA, 0x8E, 0x81, 0x55, 0x7C, 0x82, 0xFA, 0x07,
-    0x31, 0x1D, 0x71, 0x2E, 0x8F, 0x04, 0xA7, 0xA4, 0x2A, 0x54, 0xC3, 0x22, 0x23, 0x14, 0x4B, 0x42,
-    0x07, 0x1E, 0x13, 0x6A, 0xBA, 0x71, 0x26, 0x29, 0x96, 0x86, 0x15, 0xA4, 0xC7, 0x2E, 0x91, 0x5C,
-    0x59, 0x34, 0x9A, 0x1D, 0x6B, 0xB2, 0xC9, 0xE7, 0xE3, 0xD8, 0x93, 0xA4, 0x33, 0x13, 0x99, 0xF8,
-    0x66, 0xD2, 0xDB, 0x61, 0xF2, 0xCF, 0x54, 0x72, 0x80, 0xBE, 0xDB, 0xCF, 0xAA, 0xE2, 0xC1, 0x9F,
-    0xB0, 0x06, 0x7C, 0x0C, 0x97, 0x97, 0xB6, 0x31, 0x7F, 0xB0, 0x4C, 0xA0, 0x3C, 0x67, 0x35, 0xDF,
-    0xDE, 0xD9, 0x39, 0x70, 0xBF, 0x8C, 0x63, 0x25, 0xD6, 0xF0, 0x7C, 0x41, 0x32, 0xBD, 0x54, 0x32,
-    0xB1, 0xB7, 0x6A, 0x66, 0xF3, 0x65, 0x49, 0xA4, 0x7E, 0x2C, 0x18, 0xFF, 0xBA, 0x04, 0x1E, 0x70,
-    0x0A, 0x59, 0x86, 0xD4, 0x04, 0x92, 0x00, 0x67, 0x00, 0x20, 0x00, 0x87, 0xCD, 0xD7, 0x5F, 0x60,
-    0x9E, 0xDF, 0x7C, 0x45, 0x7C, 0x3E, 0xFB, 0x09, 0xF6, 0x93, 0x3B, 0x77, 0x08, 0xA6, 0xBF, 0x8E,
-    0x93, 0xD1, 0xCD, 0x61, 0x92, 0xFD, 0x37, 0x5B, 0x64, 0x5D, 0xD3, 0xC5, 0x9A, 0x2D, 0x37, 0xD3,
-    0x9F, 0xBD, 0x2D, 0x77, 0x68, 0xC4, 0x5E, 0xAA, 0x4F, 0xC3, 0xAF, 0x25, 0xE5, 0xF2, 0xBC, 0x68,
-    0xBA, 0xB9, 0x61, 0x93, 0x66, 0x85, 0xAF, 0xEF, 0x2D, 0xEB, 0xB6, 0x37, 0xFB, 0xDE, 0xEA, 0xE6,
-    0x4C, 0x5A, 0xAE, 0x98, 0x88, 0x68, 0xBD, 0x8C, 0xED, 0x75, 0xDD, 0x66, 0x49, 0x9B, 0xA1, 0xB3,
-    0xF0, 0x69, 0x7D, 0x3D, 0x2D, 0x2F, 0xE8, 0x72, 0x45, 0xC5, 0xB6, 0x58, 0x45, 0xD2, 0x61, 0xB3,
-    0x33, 0xFB, 0xDD, 0x1C, 0x84, 0x46, 0xF9, 0xA4, 0x4D, 0x1B, 0x53, 0x6B, 0x8F, 0x0A, 0xE4, 0xE2,
-    0x40, 0x5C, 0x12, 0x1E, 0x3C, 0x23, 0x25, 0xCF, 0x0A, 0xF4, 0x30, 0x75, 0xD2, 0xAB, 0x01, 0x53,
-    0xEC, 0x11, 0x87, 0x04, 0x87, 0x96, 0x15, 0x14, 0x5C, 0x8D, 0xFC, 0x2A, 0x33, 0xC8, 0x1A, 0xB8,
-    0xEF, 0x59, 0x64, 0x4B, 0x53, 0x33, 0x89, 0xB6, 0x43, 0xDA, 0x0B, 0x02, 0x83, 0x1C, 0x11, 0xB7,
-    0x19, 0x62, 0x75, 0x46, 0x3D, 0x0D, 0xDA, 0xD5, 0x17, 0x21, 0xEF, 0x8B, 0x6E, 0x14, 0x6A, 0x60,
-    0xCF, 0x51, 0xEB, 0x23, 0x60, 0x9A, 0x91, 0x48, 0xA4, 0xDC, 0x74, 0x32, 0x80, 0x8E, 0x91, 0x90,
-    0x1A, 0xB4, 0x01, 0x56, 0x3F, 0xA8, 0x4D, 0xEE, 0x86, 0xC1, 0x92, 0xB0, 0xDF, 0x43, 0x25, 0x68,
-    0x56, 0xEC, 0xB8, 0x1E, 0xAE, 0x13, 0x56, 0x35, 0xC8, 0x79, 0xDB, 0x8C, 0x85, 0xA2, 0x22, 0xDC,
-    0x20, 0x33, 0x29, 0xC2, 0x37, 0x87, 0xD9, 0xFA, 0x43, 0x49, 0x1C, 0x09, 0xB5, 0xDD, 0x0C, 0x9C,
-    0xEF, 0xA0, 0x3C, 0x12, 0x0F, 0xDD, 0x22, 0x6D, 0x98, 0x3A, 0x6C, 0x8D, 0xAC, 0x44, 0x5E, 0xC0,
-    0x81, 0x8C, 0xC2, 0xAE, 0x30, 0x4B, 0x7E, 0xA3, 0x21, 0x42, 0xD4, 0xC2, 0x35, 0x98, 0x34, 0xA8,
-    0xEA, 0xB9, 0x50, 0x18, 0x29, 0x6D, 0xB2, 0x74, 0x9F, 0x90, 0x8C, 0x1D, 0x48, 0xDC, 0xC2, 0xBC,
-    0x76, 0x99, 0x06, 0xEB, 0x81, 0xA6, 0x69, 0xA7, 0x27, 0x6C, 0xEB, 0x34, 0x9F, 0x5D, 0xF2, 0x30,
-    0x37, 0x3B, 0xE8, 0xBF, 0x09, 0xD3, 0x7D, 0x1A, 0xAD, 0x86, 0x10, 0x2F, 0x6C, 0x1F, 0x83, 0x4D,
-    0xC4, 0x91, 0x60, 0xE5, 0x84, 0x6C, 0x75, 0x08, 0x35, 0xAC, 0x70, 0x20, 0x18, 0x57, 0x44, 0x82,
-    0xFE, 0x91, 0x31, 0x73, 0x23, 0xC2, 0x38, 0xCA, 0x39, 0x29, 0xFC, 0x8B, 0x38, 0xD9, 0xE2, 0xD7,
-    0x3F, 0xDF, 0x4D, 0x47, 0x9F, 0xDE, 0xE3, 0xC9, 0x53, 0x88, 0x3D, 0xA8, 0x5F, 0xDD, 0x06, 0x72,
-    0x21, 0x00, 0xB1, 0xC6, 0x87, 0xCC, 0xFB, 0xE8, 0x39, 0x86, 0xBC, 0xA4, 0x80, 0x73, 0xFC, 0x79,
-    0xE5, 0xD8, 0xAD, 0xD5, 0xB3, 0xDF, 0x5D, 0x9E, 0x32, 0xE7, 0xAC, 0x48, 0xEF, 0x9D, 0xFE, 0x4D,
-    0x7F, 0xFD, 0xC3, 0xD3, 0x27, 0x54, 0xA9, 0x4A, 0x9C, 0x38, 0xE8, 0x1C, 0xAE, 0xF3, 0xB2, 0x49,
-    0x87, 0x48, 0xAE, 0x30, 0x91, 0x5D, 0xF3, 0xCE, 0x7F, 0x52, 0xE7, 0x08, 0xE6, 0xFA, 0xA0, 0x73,
-    0xCE, 0x62, 0x3E, 0x67, 0x94, 0xC8, 0x65, 0xA2, 0x84, 0x71, 0x82, 0x8B, 0x8B, 0x85, 0x51, 0x55,
-    0x4F, 0x04, 0x0B, 0x8E, 0x00, 0x6F, 0x59, 0xCA, 0xBC, 0x9C, 0x7C, 0xDA, 0x99, 0x8E, 0x81, 0x0C,
-    0xCF, 0x4A, 0x51, 0xA4, 0x36, 0xA1, 0x14, 0x43, 0x7C, 0x25, 0xAA, 0x8A, 0xC0, 0x91, 0xE1, 0xC8,
-    0xA3, 0xA9, 0xB4, 0x3D, 0xB8, 0xA4, 0x29, 0x75, 0x05, 0x64, 0xEC, 0x93, 0x8C, 0x8A, 0x56, 0x05,
-    0x32, 0x72, 0xC5, 0xF2, 0x90, 0x45, 0x54, 0xB3, 0x88, 0x6A, 0xCE, 0xEB, 0xAE, 0x84, 0xEE, 0x0F,
-    0x54, 0x30, 0x89, 0xC5, 0x58, 0xBA, 0x02, 0xBC, 0x83, 0xC7, 0xD6, 0x10, 0xBB, 0x20, 0x2F, 0x91,
-    0x88, 0x4E, 0x3F, 0xD7, 0x29, 0x60, 0xBA, 0x47, 0xAF, 0x26, 0xC2, 0x5B, 0xC3, 0x69, 0x0A, 0xF3,
-    0xD7, 0xA4, 0x31, 0x09, 0x1B, 0x4B, 0xC0, 0x70, 0x02, 0x8B, 0xDD, 0xA7, 0x0B, 0xDD, 0xEE, 0x48,
-    0xFC, 0x02, 0xC2, 0x20, 0xB3, 0x65, 0x97, 0x04, 0xC4, 0x1E, 0xB9, 0x88, 0x3D, 0x45, 0x66, 0x8E,
-    0xD8, 0x41, 0x3A, 0x23, 0x19, 0xB8, 0x65, 0x25, 0xA3, 0x35, 0x0D, 0x49, 0xC0, 0xCE, 0x75, 0x05,
-    0xFB, 0x84, 0xFC, 0xD8, 0x03, 0x27, 0x49, 0x5E, 0xA8, 0x2B, 0x0B, 0x4E, 0x19, 0xBA, 0x2D, 0xB5,
-    0xDC, 0xA5, 0x3E, 0x53, 0x1A, 0x45, 0x71, 0xD2, 0x2E, 0xDC, 0x30, 0xB3, 0xB0, 0x4B, 0x5C, 0xD0,
-    0xF7, 0xDE, 0x90, 0x91, 0xBD, 0x22, 0xF9, 0x48, 0xC9, 0xFA, 0x50, 0x2A, 0x26, 0xC8, 0x18, 0x19,
-    0x82, 0x94, 0x92, 0xD8, 0x32, 0x2C, 0x09, 0xAA, 0x8F, 0xD9, 0x17, 0x92, 0x31, 0x7B, 0x46, 0xBE,
-    0x64, 0x0E, 0x46, 0x50, 0x68, 0x8D, 0x18, 0xDB, 0x55, 0xD2, 0x77, 0xB6, 0x16, 0x4C, 0xD1, 0x0B,
-    0x34, 0x0C, 0x4E, 0xD0, 0xD1, 0x3E, 0xB4, 0xA2, 0x63, 0xC0, 0x34, 0x16, 0x63, 0x79, 0x6E, 0x21,
-    0x22, 0xDD, 0x49, 0x21, 0x39, 0x90, 0xE4, 0xB2, 0xF5, 0x1C, 0x24, 0xC4, 0x0E, 0x62, 0xCC, 0xF9,
-    0x47, 0x41, 0x55, 0x31, 0xCB, 0x30, 0x58, 0x02, 0x15, 0xE3, 0x7C, 0x8E, 0x84, 0x8B, 0x03, 0x3B,
-    0x7E, 0x92, 0xE6, 0x3C, 0x94, 0x0F, 0x22, 0x53, 0x09, 0xC4, 0x9C, 0x06, 0x2E, 0x4E, 0x2E, 0x89,
-    0x9A, 0xBB, 0x19, 0xD4, 0xD4, 0xA2, 0xDA, 0x66, 0xD8, 0xD7, 0xC3, 0x9E, 0xC7, 0x8E, 0x0F, 0x7E,
-    0x82, 0xDA, 0xDC, 0x9B, 0x6E, 0x17, 0xD4, 0xFA, 0xDD, 0xA0, 0xE6, 0x82, 0x5A, 0x48, 0x3B, 0x0F,
-    0xC3, 0x66, 0xAE, 0x16, 0x14, 0xD2, 0xE0, 0x47, 0xFB, 0x45, 0xB5, 0xB0, 0xC7, 0x4F, 0xD3, 0xC5,
-    0xC7, 0xBC, 0x1D, 0x5F, 0xC8, 0x13, 0xFF, 0x02, 0x65, 0x50, 0xB1, 0x8E, 0xD3, 0x40, 0x10, 0x7D,
-    0xBB, 0xCB, 0x61, 0x45, 0xCE, 0xC5, 0x29, 0x29, 0xEE, 0xE2, 0x86, 0x22, 0x42, 0x86, 0xA4, 0x70,
-    0x91, 0x22, 0x89, 0x4D, 0x05, 0x12, 0x4D, 0x3E, 0x21, 0x05, 0xF5, 0xE1, 0x22, 0x45, 0x10, 0x20,
-    0x2F, 0xD4, 0x14, 0xC7, 0x1F, 0xE4, 0x0F, 0x48, 0x71, 0xC5, 0x15, 0x27, 0x65, 0xAE, 0xA4, 0x5B,
-    0xFE, 0x60, 0x8B, 0xEB, 0x28, 0xD8, 0xC2, 0x85, 0x25, 0xC2, 0x99, 0xB1, 0x1D, 0xE9, 0x22, 0xA1,
-    0x2D, 0xDE, 0xE8, 0xBD, 0x37, 0xB3, 0x33, 0x0F, 0x0B, 0xF9, 0xBA, 0x73, 0xD2, 0xED, 0x3C, 0xF9,
-    0x11, 0x7F, 0x8D, 0xA3, 0xC9, 0x55, 0xE2, 0x42, 0x8D, 0x47, 0x18, 0xE2, 0x5A, 0xDE, 0xF9, 0xE3,
-    0x28, 0x4B, 0xF6, 0xB0, 0x30, 0xD2, 0xA8, 0xFB, 0x13, 0x74, 0xD0, 0x45, 0x68, 0x11, 0x21, 0xEA,
-    0xAF, 0x73, 0xF7, 0x4E, 0x63, 0x07, 0xC3, 0xEF, 0x83, 0x99, 0x9D, 0x9D, 0x2A, 0xF5, 0x4A, 0xEF,
-    0xE8, 0x71, 0x8A, 0xBC, 0x84, 0xF1, 0x11, 0x4B, 0xEA, 0x61, 0xEB, 0xD1, 0x0C, 0x1B, 0xE0, 0x2D,
-    0x7E, 0xEA, 0xCD, 0x72, 0xB8, 0x52, 0xCE, 0x7B, 0xA3, 0x5E, 0xDE, 0xD2, 0x76, 0x7D, 0xE5, 0x17,
-    0x10, 0x7B, 0xF9, 0x45, 0x53, 0x96, 0x0D, 0xCF, 0x2F, 0x64, 0x05, 0x41, 0xBF, 0x4C, 0x62, 0x80,
-    0xD5, 0x77, 0x1E, 0x5B, 0x39, 0x54, 0xDF, 0x0A, 0xB1, 0x47, 0x29, 0x0B, 0x94, 0xCA, 0xA1, 0xF0,
-    0x8C, 0x28, 0x7C, 0x92, 0x2E, 0x20, 0xE5, 0x42, 0xF2, 0xEC, 0x48, 0xFB, 0x36, 0x49, 0x03, 0x93,
-    0x23, 0xA0, 0x1D, 0x42, 0xC2, 0x33, 0x0D, 0x3B, 0x56, 0x34, 0xF6, 0x10, 0x07, 0x67, 0x71, 0x6F,
-    0x9A, 0x3D, 0x9F, 0x6C, 0xA3, 0xBE, 0x9D, 0x2A, 0x33, 0x0F, 0x29, 0xA9, 0xD2, 0xD1, 0x5F, 0xF8,
-    0x77, 0xC0, 0x62, 0x0E, 0xD3, 0x95, 0x34, 0x51, 0x69, 0x96, 0xFF, 0xBE, 0x07, 0xC4, 0x0E, 0x8B,
-    0x0D, 0x5F, 0x7B, 0x8A, 0x01, 0x5E, 0xE0, 0x13, 0xF2, 0x82, 0x0F, 0x96, 0x25, 0x84, 0xC6, 0x65,
-    0x60, 0xF1, 0x14, 0x3E, 0xD4, 0xE7, 0x8A, 0x72, 0x0D, 0x0E, 0x25, 0x3A, 0x84, 0xB2, 0x6A, 0x42,
-    0xB1, 0x92, 0xD7, 0xF5, 0xF6, 0xDD, 0x36, 0x94, 0x18, 0x71, 0x7F, 0x9B, 0xDB, 0x8B, 0xF4, 0x28,
-    0x94, 0x9E, 0x52, 0x92, 0xFE, 0x98, 0x90, 0x7D, 0xA2, 0x32, 0x0A, 0x13, 0x41, 0x01, 0x56, 0x8A,
-    0x06, 0x70, 0x22, 0x6D, 0x62, 0xA1, 0x4D, 0x36, 0x8C, 0x55, 0xC1, 0xB1, 0xA4, 0xB7, 0x94, 0xBD,
-    0x5F, 0x3F, 0xC4, 0xB2, 0x1C, 0x9E, 0x0F, 0x8E, 0x62, 0x81, 0xE2, 0x0D, 0x4A, 0xF0, 0x8E, 0xF0,
-    0x08, 0x28, 0x80, 0x39, 0xE0, 0x73, 0xE5, 0x9A, 0xAA, 0xE6, 0x58, 0x0D, 0xD9, 0x67, 0x81, 0x69,
-    0x2B, 0x31, 0x11, 0xA4, 0x10, 0xEC, 0x18, 0x01, 0x92, 0xF9, 0x19, 0xCB, 0xA6, 0x05, 0x6A, 0x5C,
-    0x35, 0x1C, 0x91, 0x6C, 0x49, 0x18, 0xDA, 0x06, 0x2C, 0x1B, 0x4B, 0xDD, 0x17, 0xE8, 0x46, 0xAF,
-    0x27, 0xF9, 0xF4, 0x50, 0xB6, 0xAC, 0x74, 0xCD, 0x37, 0xF5, 0x6F, 0x5E, 0x2B, 0xD6, 0x2D, 0xBC,
-    0x09, 0x0E, 0xC2, 0x75, 0xDB, 0xF5, 0xB1, 0xD5, 0xFF, 0x83, 0x5A, 0xBB, 0x61, 0xE7, 0xE1, 0x02,
-    0x0D, 0x71, 0xF9, 0x0F, 0x6D, 0x56, 0x31, 0x8C, 0x15, 0x55, 0x14, 0x3D, 0x6F, 0x1E, 0x38, 0x09,
-    0x93, 0xEC, 0xDB, 0xC6, 0x44, 0x43, 0x60, 0x1A, 0x0B, 0x63, 0x76, 0xF9, 0x8D, 0x05, 0x31, 0x7F,
-    0x99, 0xA9, 0xB4, 0xA0, 0x80, 0xC2, 0xD5, 0x44, 0x12, 0xE9, 0x6D, 0xA0, 0x20, 0x86, 0x62, 0xF1,
-    0x8F, 0x52, 0xD8, 0x6E, 0x61, 0x2F, 0x0D, 0x09, 0x2E, 0x05, 0x14, 0x5B, 0x6C, 0x21, 0xFC, 0x81,
-    0x42, 0x4B, 0x46, 0x12, 0x6C, 0x2C, 0x9C, 0x08, 0x16, 0x42, 0x84, 0x97, 0x30, 0x84, 0x01, 0xE6,
-    0xCF, 0xF3, 0xDC, 0x3B, 0xFF, 0x2F, 0x1B, 0xF5, 0x15, 0xF7, 0xCD, 0x7F, 0xEF, 0xBE, 0xFB, 0xCE,
-    0xBD, 0xF7, 0xDC, 0xFB, 0x3E, 0x00, 0x9C, 0x3F, 0x4C, 0x01, 0x3F, 0xA6, 0x88, 0xEA, 0x1D, 0x4A,
-    0x5B, 0x7A, 0xCA, 0xE4, 0x9B, 0x9A, 0xD2, 0x05, 0x91, 0xD3, 0xC0, 0x95, 0x24, 0x84, 0x0A, 0xC8,
-    0xDA, 0x35, 0x2E, 0x04, 0xBF, 0x41, 0xBD, 0x50, 0x35, 0xD4, 0x78, 0x7E, 0x8B, 0x9B, 0xE9, 0x1D,
-    0x5B, 0x72, 0xF3, 0xF3, 0xA4, 0xA0, 0xF6, 0xD8, 0x51, 0x65, 0xB6, 0x73, 0x04, 0x30, 0x33, 0xB1,
-    0x1B, 0x85, 0x6A, 0x5B, 0xA4, 0x28, 0xDA, 0x70, 0xB1, 0x12, 0xF9, 0xEA, 0x57, 0x4F, 0x19, 0x68,
-    0x3E, 0x0A, 0x6A, 0x98, 0xB2, 0x84, 0x51, 0x69, 0x7F, 0x0B, 0x7D, 0xBE, 0x00, 0x20, 0x76, 0x71,
-    0x44, 0xEC, 0x42, 0xED, 0x62, 0x7B, 0x15, 0x7B, 0x86, 0x99, 0xB6, 0x62, 0x9A, 0xA7, 0x28, 0x1A,
-    0x1A, 0xD8, 0xE4, 0xE2, 0x84, 0xF6, 0x90, 0xCA, 0x71, 0xDB, 0x8A, 0xD2, 0x54, 0x44, 0x2A, 0x86,
-    0xA2, 0x16, 0x5F, 0x7A, 0x64, 0x79, 0x12, 0x10, 0x7B, 0xCC, 0x96, 0xB9, 0x45, 0xA3, 0xAE, 0x8D,
-    0xA8, 0x1C, 0xEA, 0xB5, 0x7D, 0x74, 0xF8, 0xD5, 0x93, 0x52, 0xC0, 0xB4, 0xE2, 0x70, 0xC8, 0x91,
-    0x05, 0x3A, 0x2F, 0xB8, 0xF4, 0x9A, 0x4D, 0xFC, 0x77, 0x9C, 0x79, 0x40, 0xE3, 0xD4, 0xB7, 0xFD,
-    0x87, 0x8D, 0xDC, 0x52, 0xE0, 0x47, 0xB9, 0x49, 0x30, 0x24, 0x39, 0xC5, 0xCD, 0xAD, 0x2B, 0x88,
-    0xC5, 0xD3, 0x91, 0xD8, 0x8B, 0xC5, 0x93, 0x54, 0x43, 0x4B, 0xD0, 0x93, 0xD0, 0x03, 0xA7, 0xEE,
-    0x9D, 0x64, 0xEC, 0x06, 0x74, 0xFC, 0x20, 0xCE, 0x94, 0x1F, 0x26, 0x6C, 0x7D, 0x37, 0x60, 0xC8,
-    0xF4, 0xF6, 0xF9, 0x78, 0x33, 0x87, 0x2B, 0xE1, 0x3C, 0xE2, 0x1A, 0x71, 0x07, 0xDB, 0x30, 0x8C,
-    0x39, 0x3A, 0xC2, 0xAF, 0x70, 0x93, 0xAE, 0xB7, 0xF4, 0x8E, 0xA0, 0x55, 0xE9, 0xF7, 0x32, 0xF1,
-    0x48, 0x9E, 0x36, 0xA2, 0xD4, 0xF6, 0xA6, 0x63, 0x3E, 0xB2, 0x62, 0x4A, 0xB0, 0x32, 0x4E, 0xA8,
-    0x2C, 0xD3, 0x3A, 0x3B, 0x4E, 0xA5, 0xC6, 0xDD, 0xA7, 0x52, 0x17, 0xBD, 0xA0, 0x52, 0xC0, 0x84,
-    0x11, 0x9B, 0x16, 0x2E, 0x14, 0xC8, 0x2A, 0x4B, 0x98, 0xA9, 0x67, 0xCA, 0x91, 0x74, 0x18, 0x09,
-    0x42, 0x2B, 0xA0, 0x8D, 0x84, 0x1B, 0xB3, 0x4F, 0x88, 0xEC, 0x18, 0x92, 0x0A, 0x69, 0x8E, 0x26,
-    0x16, 0x8B, 0xB7, 0xAF, 0xBD, 0xDC, 0x9A, 0x6E, 0x9A, 0x16, 0x93, 0x82, 0xC4, 0xE1, 0x61, 0xC2,
-    0x2F, 0x78, 0xE7, 0x8C, 0xE1, 0xD0, 0x94, 0x34, 0x92, 0xB6, 0x6E, 0x37, 0x2F, 0x99, 0x06, 0x44,
-    0xA3, 0x25, 0x3B, 0x56, 0x76, 0x8C, 0xFA, 0x3B, 0x2D, 0xD4, 0x63, 0xD7, 0xEB, 0x94, 0x0A, 0x4B,
-    0x80, 0xD5, 0x4F, 0xC5, 0x08, 0x8E, 0x42, 0x48, 0x8A, 0xF7, 0x87, 0xE9, 0xEC, 0x30, 0x5D, 0x8F,
-    0x74, 0xF2, 0x84, 0x93, 0xB4, 0x78, 0x39, 0xE5, 0xDD, 0x5D, 0x24, 0x41, 0xDF, 0x26, 0x66, 0xDA,
-    0xAD, 0x38, 0xCD, 0x64, 0x8A, 0x1B, 0x86, 0x9B, 0x19, 0xAE, 0x9C, 0xFA, 0x59, 0x32, 0x1F, 0x23,
-    0xAF, 0x13, 0x9A, 0xB4, 0x1C, 0xC9, 0x34, 0x2A, 0x32, 0xD8, 0x47, 0x4D, 0x96, 0x67, 0xCC, 0x94,
-    0xCF, 0x30, 0x61, 0xFA, 0xAA, 0x09, 0x21, 0x27, 0x6A, 0x8F, 0xB4, 0x21, 0x0F, 0xE3, 0x82, 0x19,
-    0x8E, 0x2A, 0xE1, 0xA8, 0x17, 0x08, 0xE7, 0x41, 0xBA, 0xAF, 0x72, 0xCF, 0x3B, 0x71, 0x3B, 0x74,
-    0x4C, 0x79, 0x98, 0xED, 0xBF, 0x70, 0xE6, 0xCF, 0x67, 0x70, 0xAE, 0xDD, 0x80, 0xFD, 0xF9, 0x31,
-    0x8F, 0x3D, 0x7D, 0x7E, 0x07, 0x58, 0x7B, 0xF6, 0x9C, 0x29, 0xEA, 0xBE, 0xAA, 0x49, 0x1C, 0xC6,
-    0x17, 0x41, 0x3C, 0xCF, 0x0A, 0x3A, 0xEB, 0x2A, 0xA6, 0x30, 0x26, 0x1E, 0x98, 0xD6, 0x8A, 0xB7,
-    0x1F, 0x7C, 0x2C, 0x6E, 0x4D, 0xE6, 0xB5, 0xD8, 0xF1, 0x92, 0x9E, 0x78, 0x36, 0xE8, 0x41, 0x8A,
-    0x1D, 0xE3, 0x79, 0x5F, 0x43, 0x3D, 0x67, 0xBC, 0xAD, 0xDE, 0x71, 0x91, 0x8F, 0xCB, 0x9D, 0xC3,
-    0xB6, 0x4E, 0xCA, 0x66, 0xD5, 0x56, 0xAE, 0xF0, 0x6B, 0x71, 0xE9, 0x72, 0xFF, 0x6E, 0x52, 0xA6,
-    0x86, 0x4A, 0xC5, 0x11, 0xCA, 0x14, 0x6B, 0x3C, 0x36, 0xA2, 0xA1, 0x96, 0xA4, 0xD9, 0xC0, 0xF4,
-    0xD1, 0x0C, 0xCB, 0x8C, 0xB0, 0x66, 0xE5, 0x33, 0x95, 0xFB, 0x84, 0x8F, 0x52, 0x32, 0x63, 0x49,
-    0x38, 0xF3, 0x91, 0xC9, 0xF5, 0x8C, 0x57, 0xEC, 0x89, 0x38, 0xFC, 0xCD, 0x10, 0x91, 0xA9, 0x63,
-    0xE6, 0x39, 0x91, 0xDC, 0xD7, 0x0C, 0xFD, 0x61, 0x32, 0x21, 0xF2, 0x4C, 0xA5, 0x1A, 0xD2, 0x4A,
-    0x0E, 0xEC, 0x13, 0x46, 0x92, 0x4C, 0xFE, 0x93, 0x1D, 0xB3, 0x5D, 0x1A, 0xAF, 0xAB, 0x2B, 0xE4,
-    0xB2, 0xAA, 0x9E, 0x3C, 0x89, 0x44, 0x52, 0x27, 0x45, 0x60, 0x1A, 0xAD, 0x34, 0xB1, 0xC2, 0x7D,
-    0xA3, 0xBD, 0xA8, 0xD4, 0xF6, 0x23, 0x36, 0xA9, 0x6D, 0xB5, 0xBA, 0xA5, 0xB2, 0x6E, 0x2C, 0x6A,
-    0x26, 0xE9, 0xD7, 0x31, 0xDC, 0x3A, 0x12, 0x94, 0x07, 0x43, 0x8E, 0x39, 0x67, 0xE6, 0x39, 0xE8,
-    0xB2, 0xBE, 0xBF, 0x46, 0x4D, 0x75, 0xAD, 0xD5, 0x5B, 0x96, 0x69, 0xE9, 0x55, 0xAD, 0x6D, 0x8C,
-    0x35, 0xFC, 0x42, 0x3E, 0xE4, 0xD7, 0xF7, 0x77, 0x73, 0x39, 0x47, 0x91, 0x11, 0x6D, 0x4C, 0xEA,
-    0x0E, 0xBF, 0xDE, 0x52, 0xB2, 0x0A, 0x2F, 0x8D, 0xF0, 0x31, 0x9A, 0x2D, 0xB8, 0xAA, 0x62, 0x20,
-    0xD6, 0xBC, 0x47, 0xBA, 0x7B, 0xA7, 0x88, 0xDA, 0x15, 0xF4, 0xC4, 0x49, 0x45, 0x74, 0xF4, 0x8B,
-    0xE1, 0xD1, 0xB2, 0x6B, 0x08, 0xFA, 0xCC, 0xD0, 0xEE, 0x0A, 0x91, 0xB3, 0xB9, 0xB3, 0xF3, 0x4E,
-    0xA5, 0xC5, 0x21, 0xAD, 0x49, 0x78, 0x3F, 0x48, 0xA5, 0xBB, 0xD6, 0x07, 0x8B, 0x11, 0xF3, 0x06,
-    0x41, 0x36, 0x94, 0x7B, 0x4A, 0x64, 0x08, 0x32, 0xB4, 0x57, 0x42, 0x0F, 0x9C, 0xD3, 0x5A, 0x21,
-    0xEE, 0x03, 0x62, 0x7D, 0x24, 0x17, 0x67, 0x2F, 0xEA, 0xFD, 0xC8, 0xEA, 0x73, 0x62, 0x67, 0x45,
-    0xFA, 0xA3, 0x74, 0x3E, 0x6F, 0x0B, 0x5E, 0x6A, 0x2A, 0x44, 0x1D, 0xAE, 0x83, 0xBC, 0xE2, 0x4E,
-    0x96, 0xBB, 0xCB, 0x6C, 0x64, 0xCC, 0xFA, 0x71, 0x6F, 0x1E, 0x86, 0xBB, 0xDC, 0x71, 0x97, 0x02,
-    0xC6, 0x71, 0x99, 0xF9, 0x25, 0xEB, 0x93, 0xF0, 0xE8, 0x49, 0x2B, 0x1D, 0xB1, 0x57, 0x8E, 0xE7,
-    0x56, 0x7D, 0x39, 0x18, 0xFE, 0x12, 0xE4, 0xF9, 0x82, 0x36, 0x43, 0x45, 0x0E, 0xE3, 0x60, 0x78,
-    0x80, 0x81, 0x04, 0xF3, 0x49, 0x50, 0x2F, 0x9B, 0x69, 0x89, 0xDD, 0xC6, 0x0C, 0x69, 0x58, 0x3A,
-    0x0D, 0x1E, 0x65, 0xF9, 0x90, 0x3D, 0x09, 0x5E, 0xD0, 0x76, 0xFC, 0xDE, 0x16, 0xC7, 0xA5, 0x85,
-    0xC9, 0x2F, 0xF4, 0x97, 0xD5, 0x1E, 0x56, 0xBB, 0xA1, 0x95, 0xB9, 0x81, 0x5E, 0x69, 0x0F, 0x53,
-    0x0C, 0xA7, 0x6B, 0x6D, 0xB3, 0xF2, 0x7A, 0xC5, 0x6A, 0x43, 0x1B, 0x79, 0xA7, 0x88, 0xFE, 0xDD,
-    0xCA, 0x89, 0x3C, 0xD2, 0x32, 0x7E, 0x23, 0x14, 0x09, 0x4D, 0x3E, 0x41, 0x72, 0xBF, 0xB4, 0x75,
-    0x6D, 0xFC, 0x59, 0xB4, 0x2B, 0x58, 0x5B, 0x42, 0xFA, 0x51, 0x1E, 0xFF, 0x51, 0x9A, 0x9E, 0xEF,
-    0x47, 0x28, 0x63, 0x9A, 0x19, 0xF5, 0xF3, 0x88, 0x43, 0x51, 0x98, 0x75, 0x8E, 0xBD, 0x26, 0x95,
-    0x7D, 0xD2, 0x03, 0x43, 0x1D, 0x5D, 0x3E, 0xFD, 0xCB, 0xFA, 0x9C, 0xE0, 0xAC, 0x6A, 0x75, 0x74,
-    0x48, 0x26, 0x16, 0x1C, 0x9E, 0x2F, 0x4C, 0x74, 0xA1, 0x7B, 0x9D, 0xFA, 0x49, 0xFE, 0x7A, 0xC1,
-    0xEF, 0x2E, 0xD8, 0x3D, 0x0B, 0xD8, 0xDA, 0xBA, 0xA2, 0x0F, 0x8C, 0xBC, 0xE4, 0x2B, 0xD2, 0x07,
-    0x71, 0xE0, 0xEA, 0xC3, 0x7C, 0x2A, 0xE4, 0x6A, 0x34, 0xBE, 0x7C, 0x15, 0x22, 0x06, 0xDD, 0x09,
-    0x91, 0x8F, 0x51, 0x81, 0x0F, 0x94, 0xF5, 0x43, 0xC8, 0x27, 0x83, 0xAD, 0xB9, 0x25, 0x2D, 0x2E,
-    0x79, 0x66, 0x37, 0xDE, 0x66, 0xF7, 0x23, 0x67, 0xFB, 0x3C, 0xE1, 0x5B, 0x3C, 0xE1, 0x13, 0x78,
-    0xE2, 0x5B, 0xB6, 0xD3, 0x5E, 0x2A, 0xC2, 0xD0, 0xFD, 0x13, 0x37, 0xB0, 0x61, 0xD8, 0xA2, 0x92,
-    0x9F, 0x5A, 0x79, 0x6D, 0xD0, 0xE7, 0x7B, 0x1C, 0x5F, 0xF4, 0x0D, 0x90, 0x5C, 0x30, 0x37, 0x25,
-    0xEC, 0x33, 0xE9, 0x5F, 0xEC, 0x54, 0x8F, 0x59, 0x0A, 0xCF, 0x6A, 0x8F, 0x63, 0x87, 0x1C, 0xE2,
-    0xDB, 0xFC, 0xA7, 0xB1, 0x3D, 0x5E, 0xE2, 0x23, 0xFF, 0x75, 0x05, 0x7F, 0x6E, 0x05, 0x87, 0x12,
-    0x5B, 0x46, 0xA5, 0x3F, 0x8A, 0xF1, 0x52, 0x92, 0xDB, 0x5B, 0x95, 0xC7, 0xF9, 0x95, 0x14, 0xF1,
-    0xC5, 0x5B, 0xF5, 0xE2, 0xD9, 0xD9, 0x2D, 0xB1, 0xD3, 0x8B, 0x12, 0xD3, 0x97, 0x07, 0x43, 0x89,
-    0xD1, 0x39, 0xF1, 0xEB, 0x02, 0x46, 0x15, 0xD6, 0x85, 0x96, 0x91, 0xD2, 0x54, 0xE4, 0x26, 0xCF,
-    0xBF, 0x2E, 0xB1, 0x03, 0x57, 0x5F, 0xFE, 0x20, 0xCD, 0x42, 0xC8, 0x90, 0x0D, 0x94, 0xD0, 0xFF,
-    0x0B, 0x72, 0xF0, 0xFF, 0x4A, 0xEC, 0x1F, 0x75, 0x94, 0x31, 0x6F, 0xD3, 0x40, 0x14, 0xC7, 0xFF,
-    0xF6, 0x51, 0x0E, 0xD5, 0x4D, 0xDD, 0x89, 0xA5, 0xA1, 0xEE, 0xC0, 0xD0, 0x21, 0x6D, 0x3A, 0x74,
-    0xF0, 0x60, 0x88, 0x45, 0xBF, 0x00, 0x3B, 0x03, 0xDD, 0x91, 0x20, 0x43, 0x06, 0x86, 0x34, 0xB1,
-    0xC2, 0x17, 0xE8, 0xC0, 0x07, 0xE8, 0x80, 0xC4, 0x86, 0x32, 0x30, 0x44, 0x10, 0x9A, 0x8B, 0xF8,
-    0x02, 0xAE, 0x18, 0x3A, 0x62, 0x04, 0x88, 0x81, 0xE5, 0x2A, 0xB9, 0xA8, 0x95, 0x5C, 0x1F, 0xEF,
-    0x9D, 0x9D, 0x8A, 0x05, 0x4B, 0xEF, 0x2E, 0xBE, 0x7B, 0xF7, 0xFE, 0xBF, 0xF7, 0xEE, 0x39, 0x70,
-    0x01, 0x78, 0x31, 0xB0, 0x41, 0x73, 0x44, 0xA6, 0xE1, 0x38, 0xA9, 0x73, 0x22, 0xE6, 0xB3, 0x2B,
-    0x7F, 0x56, 0xA2, 0x5D, 0xC6, 0xE8, 0xD0, 0xB6, 0xAF, 0x00, 0xA1, 0x69, 0xFF, 0x9A, 0xAC, 0x4D,
-    0xB6, 0x8C, 0xFA, 0xD9, 0x04, 0x9C, 0x82, 0x62, 0x18, 0x60, 0x68, 0x12, 0xF7, 0xCF, 0x59, 0xE6,
-    0xBF, 0x9A, 0xE7, 0x87, 0x42, 0xF5, 0xBB, 0x32, 0x59, 0xB3, 0xB1, 0x7D, 0x54, 0xC6, 0x1A, 0xDB,
-    0xB5, 0x4E, 0xC8, 0x67, 0x13, 0x3A, 0x9B, 0xD1, 0xFC, 0xDE, 0x2E, 0xC6, 0xE4, 0x70, 0x12, 0x7B,
-    0xF1, 0x8B, 0x72, 0x5F, 0x39, 0xB3, 0x32, 0x83, 0x33, 0xCB, 0x01, 0xB7, 0xA8, 0x94, 0x03, 0x22,
-    0x18, 0x90, 0xFF, 0x25, 0xF9, 0x1E, 0x55, 0xD2, 0x51, 0x6D, 0xDB, 0x75, 0xEC, 0x85, 0x0E, 0x69,
-    0xEE, 0x92, 0x36, 0x33, 0xF8, 0xA3, 0xF9, 0xA5, 0x7B, 0xF1, 0x25, 0x43, 0xC7, 0x24, 0x96, 0x91,
-    0x59, 0x99, 0xF9, 0x4E, 0x25, 0x3F, 0xA6, 0xE0, 0x09, 0x24, 0xBD, 0x88, 0xD8, 0x32, 0x79, 0x10,
-    0x6A, 0xFD, 0xEB, 0x91, 0x8F, 0x66, 0xFB, 0x6A, 0xBD, 0x6C, 0xC0, 0x5C, 0x11, 0x46, 0xE1, 0xFF,
-    0xA0, 0xAD, 0xDB, 0x45, 0x40, 0xC9, 0x40, 0xA6, 0x76, 0x3A, 0x84, 0x4F, 0x93, 0x54, 0x56, 0x31,
-    0xC2, 0xBF, 0x4F, 0x8B, 0x30, 0x34, 0xA4, 0x51, 0xEE, 0x59, 0xE0, 0xE8, 0xF1, 0x24, 0x5C, 0x75,
-    0x13, 0xA4, 0x40, 0x93, 0xB2, 0x51, 0x36, 0x75, 0x12, 0x43, 0x97, 0x60, 0x60, 0x27, 0x7E, 0x0B,
-    0xAB, 0xBD, 0x26, 0xAD, 0x65, 0x88, 0x7C, 0x91, 0xE4, 0xE3, 0xDC, 0xF9, 0xF5, 0x1C, 0x82, 0xB9,
-    0xB5, 0x3D, 0x8B, 0x67, 0xB8, 0x6B, 0x0A, 0x69, 0x5E, 0xC3, 0xA7, 0xBA, 0x3C, 0xA4, 0x42, 0xE8,
-    0x92, 0x68, 0x87, 0xB1, 0x8F, 0x76, 0x1A, 0xC1, 0xCB, 0x48, 0xF3, 0x94, 0xD1, 0xC4, 0x1B, 0x02,
-    0x30, 0x3F, 0x81, 0x27, 0x94, 0xB0, 0xA4, 0x84, 0x4B, 0x8D, 0xF6, 0x67, 0x25, 0x73, 0xDF, 0x29,
-    0x11, 0x75, 0x12, 0x9C, 0x6B, 0x06, 0xC7, 0x52, 0x0D, 0xBB, 0x6D, 0xCB, 0xE6, 0xC5, 0x2D, 0xA1,
-    0x22, 0x37, 0x0D, 0xA1, 0x7B, 0xC8, 0xC7, 0xE8, 0x6B, 0x3C, 0xC8, 0x10, 0xA4, 0x1F, 0x9E, 0x2A,
-    0x63, 0xD4, 0xD2, 0x2C, 0x59, 0xA4, 0xB7, 0x07, 0x4C, 0x48, 0xBB, 0xE7, 0x66, 0x21, 0x1D, 0x90,
-    0x49, 0xCB, 0x47, 0x63, 0x03, 0xAB, 0x44, 0xF0, 0x12, 0x52, 0x43, 0x5C, 0xBC, 0x13, 0xC6, 0xB8,
-    0xE5, 0xE3, 0xFA, 0x86, 0xB9, 0xC0, 0x55, 0xCF, 0x80, 0x1B, 0x48, 0x26, 0x75, 0xBD, 0x5C, 0x63,
-    0x4C, 0x11, 0xF0, 0xF2, 0x94, 0x87, 0x01, 0x0F, 0x43, 0x5A, 0xB3, 0xFD, 0x86, 0x0E, 0x16, 0x43,
-    0x78, 0x53, 0xD7, 0x5B, 0x3C, 0xF4, 0x48, 0xDE, 0xD1, 0x14, 0xC0, 0xD3, 0x43, 0xF2, 0xC8, 0x3E,
-    0x2A, 0x5C, 0xA6, 0xDF, 0x33, 0xF9, 0x4D, 0x9D, 0xE6, 0xC1, 0xA3, 0xB9, 0x9A, 0x46, 0x62, 0xA4,
-    0xC2, 0x35, 0xB1, 0x4F, 0x3A, 0x92, 0x2B, 0xEB, 0xF1, 0xED, 0x36, 0xF8, 0x96, 0x56, 0x56, 0x69,
-    0x68, 0xDE, 0xA3, 0x61, 0xAB, 0xC5, 0x79, 0x70, 0xE4, 0xDD, 0x3D, 0x1B, 0x7A, 0x8D, 0xCC, 0x49,
-    0xF9, 0xFE, 0x55, 0xDD, 0x44, 0xB6, 0xA3, 0x10, 0x09, 0xA6, 0xE4, 0x5F, 0x13, 0x46, 0xE6, 0x04,
-    0x06, 0x3E, 0x2D, 0xA5, 0xF5, 0xA7, 0xE0, 0xA5, 0x0B, 0xFE, 0xB4, 0x86, 0x3C, 0x38, 0xE0, 0x4B,
-    0xDD, 0x5B, 0xC4, 0x0F, 0x59, 0xA9, 0xC5, 0xB7, 0xB7, 0xD2, 0x60, 0x0E, 0x46, 0x58, 0xF6, 0xB8,
-    0x0E, 0x84, 0xD5, 0x13, 0x22, 0xD9, 0x1D, 0x88, 0x7D, 0x35, 0xF5, 0x47, 0xA3, 0x79, 0xEE, 0x9E,
-    0xCF, 0xA9, 0x53, 0x3F, 0xA5, 0xBF, 0x15, 0x82, 0x6C, 0xC6, 0x6D, 0xDF, 0xE7, 0xA2, 0x71, 0xAC,
-    0xFB, 0x9B, 0x75, 0xF8, 0xC4, 0x76, 0x4D, 0x68, 0x69, 0xDB, 0x16, 0xAB, 0xEA, 0x7A, 0x69, 0xBF,
-    0x25, 0xC1, 0xF4, 0x11, 0x57, 0xD6, 0x98, 0x39, 0xC3, 0x22, 0xB7, 0x70, 0x1D, 0x99, 0xD9, 0x12,
-    0x73, 0x7D, 0xAF, 0x21, 0x72, 0x0B, 0x4F, 0xD5, 0xAD, 0xBE, 0xAD, 0xA9, 0xAD, 0x72, 0xF3, 0xA6,
-    0xCE, 0x82, 0x23, 0x52, 0x3E, 0x3B, 0xE4, 0xD4, 0x9F, 0xA5, 0x8E, 0x7E, 0x5B, 0x48, 0x7D, 0xDC,
-    0x0D, 0xF4, 0x31, 0x06, 0xDD, 0x63, 0x6C, 0x91, 0xE1, 0x3F, 0xC6, 0x7B, 0xEC, 0xC3, 0xBE, 0x7C,
-    0x86, 0xCF, 0x72, 0x0C, 0xEC, 0x14, 0x55, 0x4C, 0xFA, 0xBF, 0xF9, 0x0B, 0x55, 0x54, 0x31, 0xAF,
-    0xD4, 0x46, 0x10, 0xFE, 0xD6, 0x2B, 0x9E, 0x25, 0x56, 0xCA, 0xA6, 0x80, 0x26, 0x0F, 0xC9, 0x94,
-    0x14, 0x28, 0x6E, 0x28, 0x28, 0xF2, 0xCE, 0x9B, 0x22, 0x3D, 0x05, 0x10, 0x09, 0x0A, 0x7E, 0x02,
-    0x4D, 0x0A, 0x8A, 0x07, 0x36, 0xBF, 0x00, 0x8A, 0xF4, 0xA1, 0x80, 0x02, 0x68, 0xE9, 0x72, 0x79,
-    0xDE, 0x3E, 0x8D, 0x25, 0x44, 0x6F, 0x24, 0x50, 0xCA, 0xE7, 0xE2, 0x0A, 0x23, 0xF9, 0x6E, 0xF2,
-    0xCD, 0xFA, 0xEE, 0xDD, 0xB1, 0xD2, 0x8E, 0xB5, 0x3B, 0x33, 0xDF, 0xCC, 0x7C, 0x33, 0x5E, 0x00,
-    0x45, 0x00, 0xD0, 0xAA, 0xF8, 0x99, 0x1B, 0x4F, 0xB8, 0xB3, 0x8E, 0xC2, 0xEB, 0xE9, 0x17, 0x6E,
-    0xD3, 0xC1, 0x8D, 0x1E, 0x46, 0xA6, 0x27, 0x28, 0x9B, 0xBF, 0xA3, 0x19, 0x21, 0xF0, 0x4D, 0xB6,
-    0xC2, 0x53, 0xB8, 0x98, 0x0D, 0x38, 0xD1, 0x4F, 0x8F, 0xF2, 0x53, 0x0B, 0x54, 0xB2, 0x22, 0x9A,
-    0x10, 0xEE, 0x71, 0x8F, 0xFD, 0x3A, 0x92, 0x57, 0x84, 0x72, 0x22, 0xE7, 0x01, 0xB9, 0xDC, 0x97,
-    0x8E, 0x70, 0xC1, 0x4E, 0x40, 0xDD, 0xA0, 0xEE, 0xE0, 0x07, 0x94, 0x1B, 0x64, 0x13, 0xDC, 0xBF,
-    0x3D, 0xAA, 0x90, 0xF5, 0x67, 0xC8, 0x07, 0x8C, 0xAE, 0xC3, 0x9A, 0xE8, 0x13, 0x7C, 0x2C, 0x82,
-    0x67, 0xE0, 0x5C, 0x83, 0x97, 0xCF, 0x07, 0xB5, 0x19, 0x97, 0x70, 0xC9, 0xCD, 0xAE, 0x91, 0xC9,
-    0xA7, 0x87, 0x12, 0x51, 0x88, 0x30, 0xBC, 0xA1, 0xDC, 0x68, 0x26, 0x22, 0x0D, 0xFC, 0x63, 0x61,
-    0x30, 0x1B, 0x4B, 0x79, 0x09, 0x5C, 0xC7, 0x77, 0xAB, 0x56, 0x21, 0xDC, 0x56, 0xF3, 0x75, 0xE7,
-    0x0D, 0xC9, 0x78, 0x41, 0x51, 0xF9, 0x08, 0xFC, 0x43, 0x61, 0x46, 0x4F, 0xDF, 0xC1, 0xF5, 0xF0,
-    0x9D, 0xC6, 0x6A, 0x98, 0x54, 0xCD, 0x0B, 0x66, 0x65, 0x57, 0x76, 0x84, 0x1D, 0x79, 0x6B, 0xA7,
-    0xE2, 0xEB, 0xBD, 0xDF, 0xA7, 0x92, 0xE1, 0x26, 0x8D, 0x39, 0xE6, 0x14, 0xB1, 0xE5, 0x09, 0x23,
-    0x56, 0xF0, 0xA1, 0x80, 0x19, 0xC8, 0x52, 0x89, 0x05, 0x6C, 0x6F, 0x3B, 0x16, 0x74, 0x8A, 0x3C,
-    0xBA, 0x88, 0x25, 0x0D, 0x7C, 0x43, 0x9E, 0x57, 0x66, 0x40, 0x41, 0xFA, 0xB3, 0x81, 0xEA, 0x05,
-    0xD5, 0xB6, 0xA3, 0xFA, 0x94, 0x6A, 0x17, 0x7D, 0xC0, 0x15, 0xDC, 0x50, 0xCF, 0x98, 0x20, 0x12,
-    0x96, 0x82, 0x26, 0x74, 0xEA, 0x1B, 0x1A, 0x2E, 0xE9, 0x91, 0x47, 0x6A, 0x4F, 0xA8, 0xB7, 0x4C,
-    0x37, 0x94, 0xD4, 0x13, 0x35, 0xF9, 0x2B, 0x90, 0x22, 0x5A, 0x26, 0xD6, 0x55, 0x4A, 0x0E, 0x89,
-    0x0A, 0x6C, 0x46, 0x67, 0xBA, 0x6D, 0x8F, 0x2D, 0xCB, 0xC6, 0x1F, 0xDC, 0x4E, 0x39, 0xD1, 0xCE,
-    0x5D, 0xDB, 0x1E, 0x74, 0x0C, 0x8A, 0xED, 0x70, 0x9C, 0x70, 0x3F, 0x55, 0xE2, 0xDE, 0xBD, 0x05,
-    0xEB, 0x0D, 0x9E, 0x85, 0xEE, 0xC8, 0xBC, 0xDC, 0x6E, 0x2A, 0xA5, 0x5D, 0x57, 0x26, 0x6B, 0xF5,
-    0x96, 0xD7, 0xEA, 0xAF, 0x93, 0xC5, 0xCC, 0x74, 0x9D, 0x26, 0x39, 0x26, 0x93, 0x41, 0x65, 0xAE,
-    0xF1, 0xE1, 0x13, 0x48, 0x19, 0x2E, 0x7A, 0x82, 0x75, 0x32, 0x99, 0x54, 0x5A, 0x35, 0xBC, 0xEE,
-    0x35, 0xA5, 0x65, 0xA1, 0x86, 0x67, 0x95, 0xE6, 0x5A, 0x6B, 0xDF, 0x50, 0xA5, 0x80, 0x55, 0x32,
-    0x2C, 0x57, 0xC9, 0xF5, 0x78, 0x75, 0x44, 0x56, 0xE5, 0xB3, 0xF4, 0xF6, 0xDB, 0xA3, 0x67, 0x8F,
-    0x48, 0x4D, 0x1D, 0x6E, 0x79, 0xD6, 0x6F, 0x7F, 0xED, 0x99, 0xC0, 0xAD, 0x9B, 0x70, 0x4D, 0x6E,
-    0xA3, 0x99, 0x4C, 0xBF, 0xF8, 0xAD, 0x95, 0x29, 0x13, 0xA9, 0xA5, 0xF1, 0xF2, 0x51, 0x38, 0xC1,
-    0xBD, 0xFB, 0x32, 0x57, 0x50, 0xA6, 0xE1, 0xCD, 0xE7, 0xF2, 0x9E, 0xA5, 0x2B, 0x3B, 0xCF, 0x73,
-    0x89, 0x7D, 0x11, 0xA4, 0x17, 0xFB, 0xEA, 0x4C, 0x2A, 0x69, 0x5B, 0x4D, 0xE2, 0x69, 0x57, 0xE6,
-    0x96, 0x04, 0xE6, 0x72, 0x00, 0x54, 0xCC, 0x77, 0x29, 0xF7, 0x2D, 0x11, 0xDF, 0x83, 0x6F, 0x81,
-    0xCE, 0x54, 0xDC, 0x70, 0x43, 0x62, 0x54, 0xB4, 0xF6, 0x4A, 0x92, 0x53, 0x3D, 0x67, 0x57, 0x8E,
-    0x87, 0x33, 0x5D, 0xA1, 0x8C, 0x7E, 0x70, 0xA3, 0xB9, 0x77, 0x78, 0x7B, 0xF7, 0xE2, 0x7E, 0x3E,
-    0xBB, 0x35, 0x6E, 0xDB, 0xE1, 0x83, 0x0F, 0x4B, 0xFB, 0x5F, 0x7F, 0x14, 0xDC, 0x01, 0x44, 0xD9,
-    0x65, 0xA1, 0xF8, 0x2B, 0x9C, 0xDA, 0xEE, 0xA4, 0x08, 0x4B, 0xF0, 0xE7, 0x81, 0xB9, 0xB3, 0x57,
-    0xEB, 0x58, 0xA4, 0x41, 0x41, 0xB7, 0x1B, 0x9B, 0xCB, 0x7A, 0xBA, 0x99, 0x32, 0x9A, 0x74, 0x2C,
-    0xD6, 0x68, 0xCF, 0xB5, 0xB6, 0x1F, 0x76, 0x0F, 0x08, 0x98, 0x7B, 0xC6, 0x1F, 0x22, 0x3A, 0xFD,
-    0x33, 0xE6, 0x67, 0x66, 0xB9, 0x23, 0x2C, 0x8F, 0x3B, 0x7E, 0x16, 0x87, 0x19, 0xFF, 0xB8, 0x33,
-    0xCA, 0xB4, 0xD1, 0x6E, 0xB3, 0x2B, 0xB4, 0xED, 0xF5, 0xAA, 0x53, 0xA1, 0x3E, 0x75, 0x7A, 0xA9,
-    0x44, 0xBB, 0x76, 0x2C, 0xDF, 0x12, 0x45, 0x9B, 0xA0, 0xCF, 0x8D, 0x72, 0x6C, 0x12, 0xDF, 0x06,
-    0x99, 0xE6, 0x6F, 0x64, 0xF3, 0x27, 0xF0, 0x53, 0x9B, 0x28, 0x34, 0x0F, 0x38, 0x2C, 0xE1, 0xA2,
-    0x0B, 0x33, 0x56, 0x7A, 0x05, 0xD8, 0xF3, 0xBD, 0x74, 0xB3, 0x54, 0xB6, 0x4D, 0x1B, 0x35, 0x04,
-    0x5F, 0x97, 0x96, 0xD1, 0xE6, 0x28, 0xFA, 0xD4, 0xA1, 0x78, 0x99, 0x62, 0x6C, 0xD7, 0x55, 0xE0,
-    0xD2, 0x7B, 0x19, 0xF8, 0x04, 0x6D, 0xDE, 0x60, 0xF1, 0x46, 0xAF, 0xFE, 0x07,
+static const uint8_t opendyslexic_12_italicBitmaps[29098] = {
+    0xCD, 0x9B, 0x3F, 0x8C, 0x27, 0xC7, 0x95, 0xDF, 0x3F, 0xD5, 0xC5, 0xDD, 0x16, 0xD4, 0x16, 0x4B,
+    0x81, 0x09, 0x9C, 0x45, 0x71, 0xFB, 0x12, 0x03, 0xB2, 0xB5, 0x62, 0x5F, 0xA0, 0x60, 0x83, 0x99,
+    0xA9, 0x92, 0x14, 0x08, 0xB0, 0x61, 0x88, 0xC1, 0x8E, 0x04, 0xF8, 0x02, 0x3A, 0x95, 0x0F, 0x77,
+    0x7B, 0x01, 0x01, 0x33, 0x98, 0x9D, 0x2E, 0x51, 0x81, 0x82, 0x0B, 0x6E, 0x0F, 0x30, 0xE1, 0xE0,
+    0x12, 0x01, 0x96, 0x81, 0x13, 0x65, 0x78, 0x17, 0x06, 0x01, 0x2F, 0xE0, 0x99, 0xED, 0xA2, 0x08,
+    0x58, 0x81, 0x00, 0xAB, 0x24, 0x81, 0x56, 0x62, 0x43, 0x2D, 0x8A, 0xC2, 0xC1, 0x24, 0x70, 0x2C,
+    0xFB, 0x9A, 0xA7, 0x1E, 0xB2, 0xBA, 0x9F, 0x83, 0xEA, 0xDF, 0xCC, 0x2C, 0x49, 0x89, 0xB2, 0x74,
+    0x3E, 0xAB, 0x83, 0xDF, 0xEF, 0x37, 0xFD, 0x9B, 0xEA, 0x7A, 0xF5, 0xFE, 0xBF, 0xEF, 0x7B, 0x3F,
+    0xB8, 0x02, 0x7B, 0x70, 0x04, 0xF7, 0x61, 0x42, 0x25, 0xAA, 0x84, 0x1E, 0xA9, 0x23, 0x4D, 0xC0,
+    0x04, 0x5A, 0x4F, 0xE7, 0xB0, 0x70, 0x0C, 0xA7, 0x90, 0x21, 0x53, 0x2E, 0x33, 0xD2, 0x8E, 0xD8,
+    0x48, 0x1F, 0x19, 0x02, 0xC3, 0x57, 0x73, 0x3B, 0x0E, 0x9F, 0xCB, 0x5D, 0x94, 0x7A, 0xEA, 0xC2,
+    0x5A, 0x4F, 0x36, 0xAC, 0x4D, 0x02, 0x92, 0x1A, 0x01, 0x95, 0x74, 0x04, 0xAA, 0x51, 0x07, 0x40,
+    0x87, 0xC6, 0x03, 0x4D, 0x30, 0x0E, 0x30, 0xBE, 0x05, 0x44, 0x44, 0x24, 0x6B, 0x11, 0x11, 0x99,
+    0xE0, 0x36, 0x27, 0x00, 0x27, 0xCC, 0x00, 0xB3, 0x4A, 0x40, 0x35, 0xE9, 0x04, 0xE8, 0x54, 0x47,
+    0xA0, 0x1E, 0x9B, 0x00, 0x56, 0x44, 0x44, 0xE8, 0x45, 0x44, 0x56, 0xE8, 0xBC, 0x05, 0xB0, 0x1C,
+    0x03, 0xF4, 0x9C, 0x02, 0x2C, 0x64, 0x40, 0xE5, 0x6A, 0xE6, 0xBD, 0x57, 0x4A, 0x80, 0x7E, 0xD9,
+    0x03, 0xED, 0xF0, 0x0D, 0xA8, 0x45, 0x12, 0x0C, 0x22, 0x81, 0x46, 0xBE, 0x70, 0x05, 0xFA, 0xFB,
+    0x37, 0x40, 0x9F, 0x7D, 0x3F, 0x82, 0xF9, 0x6E, 0x03, 0xF4, 0x7B, 0x7B, 0x80, 0xBC, 0x35, 0x42,
+    0x25, 0x12, 0xA1, 0x12, 0x99, 0x80, 0x77, 0x64, 0x06, 0xFD, 0xB2, 0x4C, 0xF0, 0xE8, 0xA3, 0x92,
+    0xE0, 0x99, 0x7F, 0x25, 0x81, 0xEA, 0xDB, 0x6F, 0x0A, 0xF6, 0xEE, 0x5D, 0x99, 0xB4, 0x88, 0x88,
+    0xB7, 0x22, 0x32, 0x6B, 0x11, 0x59, 0x51, 0x83, 0xAC, 0xEE, 0x9C, 0x84, 0xAF, 0x7A, 0xE0, 0x43,
+    0xBF, 0x73, 0x99, 0xB6, 0xEB, 0x00, 0xCF, 0xF0, 0x00, 0x35, 0xEA, 0x1F, 0x05, 0xED, 0x1F, 0x25,
+    0x18, 0x3E, 0x4E, 0xD8, 0xE3, 0xBA, 0x0A, 0x2F, 0xF2, 0x09, 0xFD, 0xDC, 0xC8, 0xFE, 0xE3, 0x9F,
+    0xF7, 0xB4, 0x6B, 0x0B, 0xCD, 0x74, 0x1B, 0x40, 0x12, 0xE8, 0x74, 0x03, 0x4C, 0xB8, 0x0E, 0x9D,
+    0xFF, 0x04, 0x0C, 0xEE, 0xD3, 0xA8, 0xBF, 0xFE, 0xB3, 0x44, 0xFD, 0xB2, 0x04, 0x8C, 0x7B, 0x00,
+    0xFB, 0x97, 0xB6, 0xB9, 0x75, 0x07, 0x8C, 0xCC, 0x60, 0xDD, 0x11, 0x9C, 0xB0, 0x0F, 0x33, 0xB7,
+    0x61, 0x56, 0x19, 0x4E, 0x4D, 0x02, 0x3B, 0x78, 0x30, 0x0B, 0xD0, 0x27, 0xA8, 0x64, 0x86, 0x66,
+    0x3E, 0xE5, 0xA3, 0xED, 0xD8, 0xB9, 0x53, 0x1B, 0xCC, 0x4B, 0xB9, 0xF7, 0xFA, 0xE7, 0xD3, 0xE0,
+    0x90, 0x38, 0x04, 0x25, 0xBE, 0x3F, 0xBB, 0x25, 0xCE, 0x8A, 0xBC, 0x13, 0x8C, 0xC8, 0x73, 0x4E,
+    0x0D, 0xAF, 0x6D, 0x7B, 0x3D, 0xE6, 0x44, 0xE7, 0x26, 0xB5, 0xC1, 0x3A, 0x01, 0xD0, 0x1E, 0x66,
+    0x78, 0x12, 0xEA, 0x00, 0x13, 0x1C, 0x40, 0x13, 0x20, 0xC1, 0x41, 0xB9, 0x37, 0x43, 0x0B, 0x7A,
+    0x84, 0xBD, 0xF2, 0xD5, 0x0C, 0xC6, 0xA1, 0x12, 0x74, 0x50, 0x8D, 0xB0, 0x0F, 0x3A, 0x96, 0xB7,
+    0x00, 0x7B, 0xE5, 0xED, 0xD2, 0xCD, 0x11, 0x2C, 0xE8, 0xB2, 0x80, 0x7F, 0x01, 0x7B, 0x65, 0x9D,
+    0xF1, 0xB0, 0x0F, 0x2A, 0x95, 0xE7, 0xEE, 0x3E, 0x96, 0xBB, 0x55, 0x02, 0xE3, 0x60, 0x2E, 0x54,
+    0xEC, 0x97, 0x25, 0x2D, 0xB0, 0x7D, 0x71, 0xBF, 0xAC, 0x3A, 0x2A, 0xDF, 0xBF, 0xE7, 0xAD, 0x09,
+    0x70, 0x02, 0x66, 0x3B, 0x81, 0x47, 0xDD, 0x01, 0xA8, 0x22, 0xDC, 0x7B, 0xE4, 0xC6, 0xDE, 0xA7,
+    0xBA, 0xFF, 0x7A, 0x9B, 0x61, 0xA2, 0x4E, 0xB4, 0x12, 0x8F, 0x6F, 0x9C, 0x3E, 0xF1, 0x91, 0xAB,
+    0x34, 0x50, 0x79, 0x50, 0x11, 0x12, 0xEC, 0xC1, 0x35, 0x68, 0x9C, 0x11, 0xF9, 0x91, 0x48, 0xE2,
+    0x59, 0xF8, 0x14, 0x18, 0xA8, 0x03, 0x2A, 0xC2, 0xA1, 0x5E, 0x74, 0x6E, 0x26, 0x93, 0xDA, 0x68,
+    0xC3, 0xE0, 0x3E, 0xF6, 0xC2, 0x0B, 0x46, 0xE4, 0x3B, 0x22, 0x09, 0xFD, 0xBF, 0xE7, 0x75, 0x70,
+    0x00, 0x54, 0x00, 0x34, 0x0E, 0x0A, 0x5B, 0x0A, 0x05, 0xE5, 0x14, 0xE7, 0xAF, 0xCF, 0x02, 0xB0,
+    0x07, 0xC0, 0x93, 0xC5, 0xBC, 0xCB, 0x32, 0x7F, 0xB1, 0x4C, 0x47, 0x28, 0x0C, 0x02, 0x26, 0x00,
+    0x8E, 0x7E, 0xC1, 0x32, 0xE3, 0xA1, 0xF0, 0xA1, 0x30, 0xFF, 0x5D, 0xCB, 0x4E, 0x80, 0x9D, 0x02,
+    0x5A, 0x00, 0x5A, 0xF7, 0xFE, 0xCB, 0xAA, 0xB2, 0x6C, 0xBE, 0xB4, 0xEC, 0xF6, 0xA5, 0x65, 0xD7,
+    0x00, 0xF8, 0x7B, 0x0F, 0xDB, 0xF3, 0xAD, 0x08, 0xD3, 0x35, 0x48, 0x55, 0x60, 0xE2, 0x59, 0x4E,
+    0xB8, 0xC6, 0xFE, 0x23, 0xB5, 0xEF, 0x9A, 0xE7, 0x46, 0xF3, 0xD5, 0x71, 0xAA, 0xE3, 0xB4, 0x57,
+    0xA5, 0xBD, 0x8E, 0xFC, 0x21, 0xE3, 0x2D, 0x4D, 0x34, 0x41, 0x27, 0x3D, 0xD5, 0x33, 0x72, 0x37,
+    0x63, 0x65, 0xA1, 0x91, 0x15, 0x64, 0x85, 0x66, 0xE7, 0x2F, 0xBA, 0x40, 0x9F, 0xD8, 0x9F, 0x79,
+    0x64, 0x0F, 0x5A, 0x30, 0x1E, 0x1D, 0x51, 0x09, 0x4E, 0xE0, 0x00, 0x5A, 0x47, 0x13, 0xD0, 0x09,
+    0x35, 0xF3, 0xD8, 0xFA, 0xAF, 0x5B, 0x91, 0x46, 0xE4, 0x65, 0x91, 0x11, 0x35, 0x8C, 0x20, 0x12,
+    0x69, 0xEF, 0xF4, 0x28, 0xA7, 0x26, 0x8A, 0xF2, 0xA8, 0xB4, 0x9D, 0xA2, 0x19, 0x41, 0x65, 0xA0,
+    0x77, 0xD0, 0x8D, 0xD0, 0xCE, 0xD0, 0xAC, 0x50, 0x8B, 0xA3, 0x92, 0x00, 0xFD, 0xD9, 0x97, 0x31,
+    0x22, 0x51, 0x89, 0x64, 0xAC, 0x48, 0x80, 0xAB, 0xE2, 0x69, 0xDE, 0x5E, 0x50, 0x45, 0x36, 0xCF,
+    0x00, 0x4F, 0x6C, 0xDC, 0xAF, 0x3D, 0x3C, 0x1E, 0x30, 0xE2, 0xA9, 0xC5, 0x6F, 0xCF, 0x36, 0xBE,
+    0x70, 0x54, 0x4D, 0xA0, 0x32, 0xFD, 0xDD, 0x05, 0x2B, 0x2B, 0xAD, 0xAC, 0x5C, 0x58, 0x26, 0xD7,
+    0xA1, 0x09, 0x54, 0x33, 0x0C, 0x8E, 0x2E, 0xD1, 0x7C, 0x8F, 0xEA, 0x7F, 0x25, 0x4E, 0x9E, 0xA4,
+    0xD3, 0xB1, 0x09, 0xB7, 0xAB, 0xB3, 0xA7, 0x7F, 0x66, 0x45, 0x7E, 0x24, 0x92, 0xA9, 0x66, 0xB0,
+    0x8E, 0x3A, 0xC1, 0x00, 0x26, 0xC1, 0xC7, 0xBE, 0x95, 0xB1, 0x92, 0xD9, 0xDB, 0xF4, 0xE9, 0xC5,
+    0xA2, 0x5D, 0x6A, 0x2C, 0xFE, 0x42, 0x8B, 0x38, 0xE5, 0x4C, 0x28, 0x8A, 0x54, 0x47, 0x68, 0x22,
+    0xB4, 0xE1, 0x43, 0xF4, 0xBE, 0x13, 0xC1, 0xCA, 0x42, 0x2F, 0x13, 0xDD, 0xEA, 0x80, 0xC7, 0x05,
+    0x7A, 0x09, 0x1C, 0xBB, 0x22, 0xF1, 0x7D, 0xE0, 0x80, 0x62, 0x7E, 0xCD, 0x9F, 0x9F, 0xA1, 0x45,
+    0xA2, 0x12, 0x97, 0x19, 0x30, 0xCE, 0xA2, 0xA3, 0xF1, 0x24, 0x1D, 0x39, 0x61, 0xE6, 0x36, 0xF6,
+    0x79, 0xA1, 0x11, 0x01, 0x11, 0x68, 0xCE, 0x8A, 0x8A, 0x89, 0xFC, 0xB7, 0xBB, 0x92, 0x60, 0x82,
+    0xA3, 0x22, 0x34, 0x30, 0x81, 0x26, 0xA2, 0x13, 0xD5, 0x0C, 0x19, 0x56, 0xE8, 0x1D, 0x36, 0xD0,
+    0x46, 0x4C, 0xA2, 0x99, 0xD1, 0x19, 0x60, 0x18, 0x51, 0x67, 0x2D, 0x2A, 0xA9, 0x91, 0x89, 0x3D,
+    0x8E, 0x68, 0x69, 0x31, 0xBE, 0x0E, 0x26, 0xB0, 0xDC, 0x8A, 0x18, 0xF1, 0x34, 0x32, 0xD2, 0xC5,
+    0x63, 0x3A, 0xDF, 0x04, 0xE3, 0xD5, 0xD4, 0x44, 0x6E, 0xEB, 0x84, 0x65, 0xC5, 0xFA, 0xEE, 0xED,
+    0x21, 0x68, 0x11, 0xCF, 0xE3, 0x2B, 0x50, 0x89, 0xA3, 0x7B, 0x73, 0xE4, 0xA4, 0x9A, 0x54, 0x62,
+    0xD6, 0x81, 0xB9, 0x0E, 0xCC, 0x8D, 0x67, 0x36, 0x4E, 0x4D, 0xC6, 0xEB, 0xD4, 0xC4, 0x36, 0xD5,
+    0x22, 0xA3, 0x12, 0x89, 0x5C, 0xF9, 0x7C, 0x28, 0xC6, 0xD8, 0xB9, 0x7F, 0x78, 0xB8, 0x62, 0x25,
+    0x33, 0x48, 0x62, 0x10, 0x07, 0x96, 0x2E, 0x98, 0xD4, 0xCC, 0xEA, 0xF0, 0xB2, 0x15, 0xDC, 0x3C,
+    0xBF, 0x0F, 0x4D, 0x64, 0xA1, 0x0B, 0x3A, 0xF3, 0x98, 0x7B, 0xC8, 0x54, 0x0E, 0xB1, 0x51, 0x67,
+    0x06, 0xCC, 0xA8, 0x32, 0xD6, 0x5F, 0xFD, 0xFA, 0xEE, 0x1B, 0x15, 0x81, 0xDE, 0x43, 0x9B, 0x8B,
+    0x26, 0x2A, 0x89, 0xD0, 0xCF, 0x60, 0x56, 0xC0, 0x46, 0x60, 0x38, 0x03, 0x6E, 0xC9, 0x6B, 0x70,
+    0x55, 0xE4, 0x0E, 0x3C, 0x2E, 0x09, 0x18, 0x22, 0x70, 0xD5, 0x03, 0x7C, 0x52, 0x96, 0x5A, 0xDE,
+    0xBE, 0x73, 0xB1, 0xDF, 0x87, 0xEF, 0x8A, 0x16, 0x49, 0x3C, 0xB4, 0x4B, 0x33, 0x01, 0xCD, 0x42,
+    0xD9, 0xA7, 0x6C, 0x44, 0x3F, 0x01, 0x5D, 0x06, 0xDA, 0x04, 0x8F, 0x8B, 0xE7, 0x96, 0x4C, 0x6A,
+    0x90, 0xD7, 0xB0, 0x72, 0x07, 0x25, 0x77, 0xE0, 0xC3, 0x17, 0x67, 0xB9, 0xBA, 0x3A, 0x7A, 0x49,
+    0x6A, 0xF9, 0xFD, 0x59, 0x45, 0xF2, 0xE6, 0x2B, 0x4E, 0x28, 0xD9, 0xCA, 0x5C, 0x5C, 0x7F, 0x3D,
+    0x42, 0x1B, 0xA0, 0x87, 0x2A, 0x43, 0x97, 0x40, 0x3C, 0x2C, 0xC5, 0x44, 0xAA, 0x0C, 0x7A, 0x2A,
+    0xFF, 0xA9, 0x2E, 0x71, 0xC9, 0x84, 0xB2, 0xCA, 0xFA, 0xC2, 0x0F, 0x80, 0x7F, 0x09, 0xD0, 0x48,
+    0x06, 0xBA, 0x92, 0x83, 0x38, 0x6E, 0x94, 0x70, 0x55, 0xB4, 0x34, 0x72, 0xD0, 0xFC, 0x77, 0x6E,
+    0xD0, 0x3D, 0x7A, 0x8D, 0x47, 0x31, 0xFF, 0x4C, 0x3B, 0xED, 0xCC, 0x7F, 0x21, 0xAA, 0xA0, 0x5F,
+    0x75, 0xF7, 0x18, 0xD5, 0xFC, 0x93, 0x13, 0x12, 0x0F, 0xAC, 0xA8, 0x89, 0xEE, 0xE5, 0xBF, 0xF9,
+    0xF3, 0x89, 0x26, 0x51, 0xDF, 0x41, 0x49, 0xF1, 0x6E, 0x13, 0x37, 0xA1, 0x16, 0x59, 0x81, 0x5E,
+    0xC4, 0x43, 0x25, 0x32, 0x02, 0x57, 0xBE, 0x59, 0x68, 0x6B, 0x3D, 0x60, 0x03, 0x30, 0x04, 0x50,
+    0x12, 0x40, 0xBF, 0x11, 0xA0, 0xF9, 0x6E, 0x80, 0xF6, 0xF3, 0x11, 0x0E, 0xEA, 0x08, 0x27, 0xF5,
+    0x88, 0x9A, 0xF4, 0x88, 0x4E, 0x3A, 0xD1, 0x04, 0x9D, 0x68, 0xBD, 0x4E, 0x58, 0x74, 0x62, 0x10,
+    0x99, 0x94, 0x48, 0xC9, 0x4B, 0xA6, 0xE6, 0xAD, 0xC3, 0x2F, 0xCD, 0x6D, 0x40, 0xCF, 0xD6, 0xA3,
+    0xF3, 0xC0, 0xA6, 0xFA, 0xD0, 0xCB, 0x44, 0x25, 0x32, 0x63, 0x42, 0x35, 0x71, 0x80, 0x1E, 0xD5,
+    0x84, 0xF1, 0x4D, 0x60, 0x1F, 0x8B, 0x4E, 0x6A, 0x7D, 0x41, 0x68, 0x44, 0x22, 0x56, 0x24, 0x32,
+    0xD3, 0xC6, 0x3A, 0x62, 0x7C, 0x07, 0x96, 0x0C, 0x59, 0x8F, 0x34, 0x63, 0xEB, 0xE8, 0xDD, 0x09,
+    0x6D, 0xD6, 0x22, 0x32, 0x9A, 0x2D, 0x67, 0x4B, 0x5A, 0xE4, 0xEC, 0x82, 0xDB, 0x6A, 0x98, 0xA1,
+    0x12, 0x09, 0x5B, 0x4A, 0x25, 0x71, 0xA7, 0x6C, 0x26, 0xB1, 0xA3, 0xA8, 0x07, 0x30, 0x91, 0x22,
+    0x34, 0xB0, 0x0E, 0xA8, 0x13, 0xC0, 0x00, 0x60, 0x66, 0x00, 0x89, 0x3C, 0x82, 0x91, 0xFF, 0x79,
+    0x2B, 0x20, 0x22, 0x33, 0x8D, 0x88, 0x38, 0xAC, 0x48, 0x42, 0x89, 0x08, 0x54, 0x22, 0xE7, 0xAA,
+    0x79, 0xE5, 0xD0, 0x81, 0x12, 0x19, 0xA1, 0x13, 0x19, 0xD1, 0x22, 0xE2, 0x39, 0xE0, 0xF1, 0x85,
+    0x3A, 0x62, 0x12, 0x19, 0x7A, 0x4C, 0x40, 0x4F, 0x6A, 0x06, 0xEB, 0x3B, 0x87, 0x9E, 0x75, 0x02,
+    0xEB, 0x2D, 0xE8, 0xA9, 0x1E, 0xB7, 0x64, 0xD3, 0x24, 0x13, 0x50, 0x2B, 0x19, 0x86, 0xD8, 0x3E,
+    0xFF, 0xCF, 0x25, 0x57, 0x22, 0x22, 0x58, 0x11, 0x09, 0x5A, 0x44, 0x12, 0xBD, 0xC8, 0x84, 0x91,
+    0xF5, 0x7C, 0xF7, 0x4E, 0x64, 0x44, 0x44, 0xA8, 0xE5, 0xED, 0x6F, 0xD0, 0xB1, 0xE9, 0xAD, 0x1E,
+    0xE1, 0xD2, 0x5F, 0x22, 0x9E, 0x56, 0x16, 0x18, 0x24, 0xA1, 0xD3, 0x4E, 0x09, 0x4E, 0x29, 0x4A,
+    0x8B, 0x09, 0xC0, 0x83, 0xC3, 0x43, 0xA7, 0x45, 0x04, 0x23, 0x92, 0xE9, 0x45, 0x52, 0x25, 0x22,
+    0x81, 0x9D, 0x24, 0xD7, 0x22, 0xA8, 0xE5, 0xA9, 0xB2, 0xBA, 0x9A, 0xB6, 0x28, 0xA4, 0x47, 0x60,
+    0x90, 0x09, 0x53, 0xDC, 0xE6, 0x48, 0xE7, 0x8B, 0x41, 0x60, 0x77, 0xDC, 0x5D, 0x37, 0xB6, 0xAB,
+    0xBC, 0xE9, 0x9E, 0x9E, 0xB7, 0xB0, 0xD5, 0x6C, 0x26, 0xAD, 0x1C, 0xD4, 0x22, 0x91, 0x4E, 0x64,
+    0xC2, 0x9E, 0x71, 0xA5, 0x08, 0xCF, 0x46, 0xA0, 0x1D, 0xCF, 0xC5, 0x38, 0x9D, 0xCB, 0x6E, 0x2D,
+    0x02, 0x54, 0xFF, 0x8E, 0x36, 0xD0, 0xCB, 0x3F, 0x4D, 0x7C, 0x58, 0x7E, 0x90, 0xC1, 0x7C, 0x7D,
+    0x80, 0x3A, 0xD8, 0x84, 0x4E, 0x8D, 0xBC, 0x7E, 0x77, 0x56, 0x22, 0xB2, 0x62, 0x45, 0xC4, 0x15,
+    0xE1, 0x3C, 0x7E, 0x49, 0x6F, 0x2C, 0x98, 0x50, 0x64, 0x54, 0x8F, 0x54, 0x33, 0x9D, 0xC3, 0x44,
+    0x32, 0x58, 0xEA, 0x84, 0xCA, 0x74, 0x01, 0x33, 0xB2, 0x82, 0x75, 0x7A, 0x42, 0x65, 0xDA, 0x40,
+    0x93, 0x10, 0xB0, 0xA1, 0xE4, 0xE2, 0xAD, 0x88, 0x4C, 0x0C, 0x3B, 0x31, 0x09, 0xED, 0xDB, 0x2F,
+    0xDC, 0x9D, 0x19, 0x5C, 0xF1, 0x91, 0x08, 0x26, 0x51, 0x67, 0xFA, 0x40, 0x37, 0x56, 0x6B, 0x71,
+    0x1E, 0x26, 0xAA, 0x4C, 0x17, 0xAA, 0x19, 0xEB, 0x74, 0xA2, 0xA7, 0x19, 0xC9, 0xB4, 0xDB, 0x8D,
+    0x89, 0x9E, 0x26, 0xB1, 0xD2, 0xC6, 0x6A, 0xC1, 0x86, 0x3A, 0x33, 0x78, 0x28, 0x0E, 0xA5, 0xCA,
+    0x14, 0xAF, 0xA2, 0xA7, 0x4D, 0x71, 0xCD, 0x08, 0x2C, 0xBB, 0xAF, 0xE7, 0x4D, 0xB3, 0xEB, 0x04,
+    0x3C, 0xD8, 0x69, 0x7C, 0x2E, 0xC9, 0xC8, 0xBB, 0x24, 0xF3, 0x60, 0x13, 0x7F, 0xB5, 0xE5, 0x11,
+    0x8F, 0xB4, 0xA9, 0x24, 0x30, 0xAD, 0x04, 0x2A, 0x49, 0x60, 0x27, 0xC0, 0x51, 0x6A, 0xA8, 0x8C,
+    0x4E, 0x4D, 0xA2, 0x4E, 0x5D, 0xA0, 0x89, 0x3D, 0x98, 0x97, 0x16, 0x68, 0xBF, 0x33, 0x41, 0xF7,
+    0x85, 0x11, 0xAC, 0xF5, 0xD0, 0xAF, 0x80, 0xE4, 0xAD, 0x9E, 0x50, 0x32, 0x82, 0x96, 0x04, 0x5A,
+    0x32, 0x34, 0x3F, 0x5F, 0xC1, 0xFC, 0x54, 0x1C, 0xED, 0x4B, 0x12, 0xE8, 0x82, 0x8C, 0x58, 0x3F,
+    0x4C, 0xF4, 0xD8, 0xCC, 0x40, 0x57, 0xFC, 0x18, 0xAD, 0x87, 0xD3, 0xA2, 0x9F, 0x97, 0x3F, 0x86,
+    0x87, 0x3E, 0x3E, 0x28, 0xC7, 0x31, 0x0F, 0x7F, 0xEC, 0x41, 0x8B, 0xC8, 0x17, 0x44, 0x72, 0x2F,
+    0xF2, 0xAA, 0x88, 0x9C, 0x7B, 0xE5, 0x3E, 0x52, 0x2D, 0x34, 0x0B, 0xF4, 0x11, 0x19, 0x31, 0x19,
+    0xB3, 0x52, 0x49, 0xA8, 0x24, 0xD1, 0xCF, 0x58, 0xC1, 0x88, 0xD7, 0x6F, 0xA6, 0x4A, 0x26, 0x4E,
+    0xC5, 0xF5, 0x3D, 0xE6, 0x7B, 0x93, 0x79, 0x23, 0x91, 0x87, 0xE7, 0xB2, 0xD0, 0x7D, 0x67, 0xEE,
+    0xBF, 0x30, 0xEA, 0xB9, 0xFF, 0xDE, 0xAB, 0x0B, 0xF6, 0x73, 0x6B, 0xB6, 0xA1, 0x4E, 0x56, 0x3E,
+    0x97, 0x11, 0x2D, 0x69, 0x08, 0x26, 0xD9, 0x6C, 0x66, 0xB5, 0x56, 0xE2, 0xC5, 0xD9, 0xD8, 0xA5,
+    0x2E, 0xE9, 0xAC, 0xB2, 0x16, 0xFA, 0x00, 0x7D, 0x89, 0xA9, 0xEB, 0xB9, 0xCF, 0xBA, 0x09, 0x19,
+    0x9D, 0x51, 0x33, 0x75, 0x46, 0x4F, 0x98, 0x05, 0x9D, 0x30, 0x0B, 0xCD, 0x48, 0xBB, 0x62, 0x22,
+    0x56, 0x30, 0x01, 0xDB, 0xD3, 0x05, 0x06, 0xEB, 0xAC, 0x63, 0xB5, 0xBE, 0x87, 0xA5, 0xF3, 0x03,
+    0x55, 0x6E, 0xC3, 0x82, 0xCE, 0xED, 0x4B, 0x99, 0x7A, 0x36, 0x3F, 0xC8, 0x34, 0x93, 0xF9, 0xE9,
+    0x84, 0x49, 0xCD, 0x5F, 0x26, 0xDA, 0x54, 0xBF, 0x93, 0xE8, 0x46, 0x2D, 0x23, 0x36, 0x6A, 0x09,
+    0xF4, 0x41, 0x4B, 0x60, 0x08, 0x95, 0x78, 0xE0, 0xAA, 0x14, 0xD3, 0x5D, 0xA1, 0x96, 0x2F, 0x8A,
+    0xA7, 0x9D, 0xB0, 0x81, 0xDE, 0xD3, 0x46, 0x04, 0xCC, 0x58, 0x65, 0x30, 0xA3, 0x9E, 0xA0, 0x19,
+    0xEB, 0x04, 0x4D, 0x34, 0x11, 0x4C, 0x30, 0x01, 0x4C, 0x68, 0x3D, 0xB4, 0xBE, 0xF3, 0x60, 0x5D,
+    0xE7, 0x61, 0xA0, 0x8B, 0xE8, 0x85, 0x6E, 0x39, 0x1C, 0xF2, 0x66, 0x15, 0x46, 0x44, 0x46, 0x1A,
+    0x11, 0xF1, 0x54, 0x22, 0x0B, 0xD0, 0x5D, 0x38, 0x4F, 0xB4, 0xAC, 0x14, 0xBF, 0x62, 0x5E, 0x79,
+    0x3A, 0x61, 0xBC, 0x9A, 0x68, 0x1D, 0x13, 0x96, 0x2A, 0x71, 0x80, 0x4E, 0xDC, 0xA6, 0x8B, 0x88,
+    0x88, 0x47, 0x64, 0x45, 0x89, 0xDC, 0x29, 0xDE, 0x43, 0x4F, 0x3B, 0x1D, 0x36, 0x69, 0x67, 0x02,
+    0x6D, 0x04, 0xBA, 0xB8, 0x0B, 0x70, 0x7D, 0x80, 0xCD, 0x6E, 0x76, 0x1C, 0x97, 0xB3, 0x92, 0xD0,
+    0x79, 0x10, 0xDF, 0x45, 0xF4, 0x4C, 0x9D, 0x68, 0x46, 0xAA, 0x89, 0x2E, 0xA0, 0x66, 0x7A, 0x60,
+    0x66, 0x01, 0x35, 0xAB, 0x0C, 0x6A, 0xAE, 0xE6, 0x1D, 0x7C, 0xA0, 0x53, 0x79, 0xAD, 0x47, 0x68,
+    0x62, 0x33, 0x82, 0x09, 0x4D, 0x22, 0x5A, 0xDF, 0x4C, 0x5A, 0x84, 0x46, 0x44, 0x16, 0x6A, 0x11,
+    0x99, 0xD0, 0x22, 0x32, 0x52, 0x08, 0xE7, 0xF1, 0xE2, 0x48, 0x2B, 0x19, 0x01, 0x64, 0x02, 0x18,
+    0x32, 0xC0, 0x63, 0x37, 0x41, 0x1D, 0x02, 0x46, 0x26, 0x18, 0x64, 0x46, 0x07, 0x9D, 0x30, 0xD4,
+    0x91, 0xFB, 0x18, 0xA7, 0x23, 0x47, 0x18, 0xEA, 0xC4, 0x11, 0x83, 0xD3, 0x6F, 0x0F, 0x33, 0x46,
+    0xC4, 0xD1, 0x4B, 0x42, 0x8B, 0x24, 0xCC, 0x68, 0x46, 0x7A, 0x4C, 0xD0, 0x19, 0x5B, 0xB2, 0xB1,
+    0xDE, 0x99, 0x54, 0x2D, 0xD8, 0x60, 0x92, 0x12, 0xFA, 0xD0, 0xE4, 0x6A, 0xC5, 0x26, 0x40, 0x0D,
+    0xAB, 0xDB, 0xE2, 0xE3, 0x20, 0x02, 0xDD, 0x19, 0x1F, 0x2D, 0xDC, 0x2C, 0xA0, 0x87, 0x09, 0xBB,
+    0x98, 0x81, 0x39, 0x03, 0x18, 0xB6, 0x04, 0x22, 0xC0, 0x55, 0x11, 0x0F, 0xAA, 0x5F, 0xD9, 0x4A,
+    0x79, 0xB4, 0x38, 0x60, 0x98, 0x70, 0xB4, 0x42, 0x27, 0x22, 0xB1, 0x11, 0x91, 0xB9, 0x12, 0x91,
+    0x95, 0x5E, 0x64, 0x75, 0x0C, 0x17, 0xBE, 0xB6, 0x15, 0x91, 0xDC, 0x89, 0x48, 0xB6, 0xEB, 0x7A,
+    0x77, 0xDE, 0xF6, 0x99, 0xD9, 0x62, 0x89, 0x9E, 0x76, 0xE1, 0xA8, 0x3E, 0x97, 0xA7, 0x89, 0x9B,
+    0x4F, 0xA3, 0x0B, 0x9B, 0xCF, 0xA3, 0x77, 0xBB, 0x68, 0x2D, 0x80, 0x5A, 0x81, 0x6A, 0xD9, 0x45,
+    0xF8, 0x12, 0xE6, 0xAF, 0x38, 0xD4, 0x53, 0xF4, 0x1E, 0x1B, 0xAB, 0x65, 0xF3, 0xBF, 0x3A, 0x63,
+    0x3D, 0x6D, 0x54, 0x0B, 0x0C, 0x34, 0xE5, 0xC6, 0xCE, 0xB5, 0xF7, 0xD4, 0x89, 0x2A, 0xD3, 0x06,
+    0xCC, 0xC8, 0x83, 0x0B, 0x5F, 0x6F, 0x02, 0xCD, 0x48, 0x0F, 0xD6, 0x55, 0x99, 0x2A, 0x63, 0x26,
+    0xBA, 0x11, 0xBB, 0xDE, 0x15, 0x4A, 0x72, 0xA0, 0x45, 0x24, 0x50, 0x8B, 0x2C, 0x3B, 0x16, 0xF1,
+    0xAE, 0x14, 0xF0, 0xE5, 0x04, 0x26, 0x2C, 0xD0, 0x8C, 0xD6, 0x51, 0x27, 0x13, 0xD1, 0x93, 0x9E,
+    0xD1, 0x99, 0x15, 0xB5, 0x60, 0x03, 0x2B, 0x26, 0x21, 0x54, 0x99, 0xDE, 0x31, 0x60, 0x03, 0x5D,
+    0xB0, 0x91, 0x66, 0x6A, 0x47, 0xAA, 0xC5, 0x24, 0x18, 0xFE, 0x74, 0x82, 0x56, 0x32, 0xD4, 0xB2,
+    0x80, 0xDA, 0xF2, 0x3B, 0xA0, 0x15, 0x07, 0x5A, 0xC2, 0xB9, 0xF8, 0x1E, 0xB4, 0x45, 0x8A, 0x6D,
+    0x00, 0xF4, 0xDC, 0x06, 0xA0, 0x4E, 0x6D, 0x00, 0xCC, 0xD8, 0x06, 0xA0, 0x0D, 0x5B, 0xE0, 0xE9,
+    0x42, 0x3D, 0xD3, 0xD3, 0x05, 0x93, 0x59, 0xE8, 0x82, 0xCD, 0x55, 0xA6, 0xF3, 0xB2, 0xE8, 0x09,
+    0xFB, 0xDC, 0xB2, 0x36, 0x09, 0xFB, 0xB5, 0x2C, 0x26, 0x62, 0xFF, 0x34, 0x49, 0x17, 0xB0, 0x43,
+    0x1C, 0x7A, 0x87, 0x95, 0x30, 0x08, 0x58, 0x61, 0x58, 0xC0, 0x2E, 0xF4, 0x19, 0xEC, 0x4C, 0x3F,
+    0x81, 0x4D, 0xD8, 0x04, 0x7D, 0x2C, 0xB1, 0x7B, 0xB3, 0xF3, 0x04, 0xB7, 0xA9, 0x26, 0xD4, 0x04,
+    0x99, 0x7A, 0x84, 0x85, 0xD6, 0xC3, 0x03, 0x8E, 0x01, 0x5B, 0x12, 0x83, 0xAF, 0x25, 0xA0, 0x7D,
+    0x33, 0x00, 0x46, 0x60, 0x83, 0x8D, 0xB6, 0x5A, 0xBA, 0x2D, 0x19, 0x5C, 0x66, 0x77, 0xFA, 0x7A,
+    0x16, 0xA0, 0x4D, 0x83, 0x87, 0x3E, 0xF4, 0x01, 0x25, 0xD8, 0x48, 0x9D, 0xE9, 0x12, 0xED, 0x44,
+    0x3B, 0xD1, 0x47, 0x4C, 0xC6, 0x42, 0xF3, 0xC3, 0x09, 0x35, 0x77, 0x9E, 0x5E, 0x65, 0x4C, 0x68,
+    0x83, 0x9E, 0x58, 0x58, 0x31, 0xA9, 0x0B, 0x0C, 0x75, 0xA2, 0x7E, 0x6B, 0x01, 0x2B, 0xBE, 0x44,
+    0x2A, 0x9B, 0x4B, 0xA1, 0x45, 0x3B, 0xEE, 0xC2, 0x6D, 0xD8, 0xE8, 0x10, 0x57, 0x0A, 0x00, 0x2D,
+    0x40, 0x3F, 0xC2, 0x86, 0x3F, 0x16, 0x38, 0xD1, 0xD3, 0x88, 0x48, 0x40, 0xBD, 0xF0, 0xC2, 0x90,
+    0xA0, 0xFC, 0x2B, 0xC5, 0xF8, 0x8A, 0xD1, 0x30, 0x14, 0x1F, 0x30, 0xB2, 0x2B, 0x58, 0xCA, 0x6B,
+    0x25, 0x81, 0x9D, 0x1C, 0x6B, 0xF1, 0x40, 0xB3, 0xBD, 0x3A, 0xC0, 0x6C, 0xAF, 0x22, 0x2B, 0x05,
+    0x0B, 0x54, 0x22, 0x22, 0x09, 0x11, 0x91, 0x02, 0x35, 0x1C, 0x3E, 0x05, 0xDD, 0x0A, 0x5A, 0x62,
+    0x29, 0x7C, 0x9B, 0xB0, 0xD9, 0xB2, 0xF1, 0x1B, 0x1C, 0x72, 0x9E, 0xAE, 0x9D, 0xEE, 0x94, 0x65,
+    0xDE, 0x10, 0x14, 0x9D, 0xB6, 0x2A, 0xB9, 0x8E, 0x5B, 0xF9, 0x63, 0x7C, 0xA9, 0xF9, 0xE9, 0x76,
+    0x66, 0xF9, 0xD0, 0x33, 0xDB, 0x0F, 0x78, 0xA6, 0xB8, 0x8D, 0x93, 0x2B, 0xF0, 0xD1, 0xDF, 0xFB,
+    0xE3, 0x7B, 0xF7, 0xEE, 0xBD, 0xF8, 0xE2, 0xFD, 0xFB, 0xF7, 0x8F, 0x8E, 0x8E, 0x8E, 0x8E, 0x6E,
+    0xDF, 0x3E, 0x3E, 0xD8, 0xFB, 0xF4, 0xEF, 0xF2, 0xD8, 0xCD, 0x8D, 0xDC, 0x6E, 0xDD, 0x21, 0x36,
+    0xAD, 0xDB, 0x9E, 0x60, 0xC2, 0xB6, 0xA5, 0x1E, 0xB7, 0x5D, 0xAA, 0x69, 0x07, 0xF4, 0xE4, 0x1D,
+    0x25, 0x07, 0x3B, 0xDA, 0x3A, 0x36, 0x6A, 0x4D, 0xD8, 0xE8, 0xAF, 0xE3, 0xF6, 0xFD, 0x07, 0x3D,
+    0x56, 0x5D, 0x7E, 0x6C, 0x23, 0xA1, 0xD0, 0xAC, 0x25, 0x69, 0xCF, 0x31, 0xE6, 0xBE, 0x8E, 0xE9,
+    0x9E, 0x8A, 0x57, 0x0E, 0x0F, 0x5D, 0x25, 0x22, 0xB9, 0x48, 0x19, 0xD8, 0xE7, 0x36, 0xA7, 0x7C,
+    0xB9, 0x20, 0x65, 0xEB, 0x75, 0x5A, 0xC9, 0x1C, 0x57, 0x99, 0x89, 0x59, 0x47, 0xE6, 0x3A, 0x30,
+    0x19, 0x54, 0x32, 0xE8, 0x74, 0x8D, 0x26, 0x75, 0xD8, 0xB1, 0x13, 0x19, 0x5B, 0x91, 0x68, 0xE4,
+    0xE7, 0xA1, 0x92, 0xAF, 0x05, 0x6E, 0x16, 0x67, 0xD7, 0x5D, 0x24, 0x38, 0x26, 0xC0, 0x71, 0x39,
+    0x6B, 0xF3, 0xED, 0x33, 0xEC, 0xB0, 0x20, 0x3F, 0x3B, 0xAD, 0x33, 0xF7, 0xBB, 0xA0, 0xD2, 0x4A,
+    0xFD, 0x72, 0xA2, 0x33, 0x81, 0xF9, 0x98, 0xE6, 0xDB, 0x99, 0xB5, 0x59, 0x87, 0xD4, 0x89, 0xD0,
+    0x4B, 0xA2, 0x5F, 0xE0, 0xCA, 0x79, 0x39, 0x34, 0x56, 0x32, 0xEB, 0xE5, 0x91, 0x6A, 0x86, 0x79,
+    0x87, 0x5B, 0x18, 0x87, 0x8E, 0xA8, 0x19, 0x7A, 0x8F, 0x91, 0xA4, 0x44, 0x36, 0x35, 0x3B, 0x47,
+    0xE3, 0x4E, 0xCE, 0xC1, 0xB6, 0xB4, 0x63, 0x9E, 0x1E, 0xE1, 0xCB, 0x3A, 0xA0, 0xE5, 0xBB, 0x81,
+    0x56, 0xDE, 0xF4, 0x1C, 0x57, 0x82, 0x9A, 0x10, 0x74, 0x64, 0xA5, 0x0E, 0x2C, 0x18, 0xA7, 0x32,
+    0xC6, 0x55, 0x33, 0xAD, 0xAB, 0x27, 0xDA, 0xD8, 0x25, 0x5A, 0x91, 0x84, 0x91, 0x12, 0xAA, 0x46,
+    0x18, 0x7E, 0x78, 0xEE, 0x11, 0x06, 0x4F, 0xF3, 0x4E, 0xC2, 0xBA, 0x1B, 0xDC, 0xE7, 0x7A, 0x35,
+    0x72, 0xA4, 0x5F, 0x97, 0xDC, 0x88, 0x64, 0xF3, 0xBC, 0xC3, 0x6C, 0x22, 0x6B, 0x03, 0x98, 0xB3,
+    0x2F, 0xC6, 0x46, 0x24, 0x54, 0x22, 0x81, 0x5B, 0x67, 0xC5, 0xF9, 0x4B, 0xD8, 0x0E, 0x55, 0x50,
+    0xCD, 0x5E, 0x7C, 0x27, 0x91, 0x19, 0xF6, 0x77, 0xE0, 0x8C, 0x1E, 0x51, 0x13, 0x9C, 0xEE, 0x52,
+    0xFC, 0x66, 0x44, 0x4F, 0x5B, 0xCC, 0x19, 0x2A, 0xCF, 0xB0, 0x9C, 0xD0, 0x7D, 0x4B, 0x7C, 0x1D,
+    0xDA, 0x89, 0x09, 0xE1, 0x1A, 0x66, 0xD4, 0x81, 0x85, 0x3D, 0xDA, 0xA0, 0xBD, 0x9E, 0x39, 0x52,
+    0xE2, 0xB4, 0x48, 0xC2, 0x96, 0xC4, 0x23, 0x52, 0x9F, 0x9D, 0x6C, 0xBA, 0x5F, 0x27, 0x7E, 0xA7,
+    0x5E, 0xD1, 0x22, 0x81, 0x5E, 0x12, 0x57, 0x65, 0x06, 0xF5, 0xD4, 0x0E, 0xED, 0xD4, 0x1B, 0xE8,
+    0x62, 0x5C, 0x81, 0xD6, 0x9E, 0xDC, 0x80, 0xA8, 0xBD, 0x7F, 0xE0, 0x78, 0x20, 0x09, 0x91, 0x59,
+    0x89, 0xCB, 0x55, 0xE6, 0x48, 0x27, 0x9E, 0xAD, 0x47, 0xEE, 0x37, 0x81, 0xC9, 0x04, 0x52, 0xEB,
+    0xAB, 0xD4, 0x39, 0x3D, 0x5A, 0xEA, 0xB1, 0xC7, 0xC4, 0x01, 0x13, 0x30, 0x41, 0x65, 0xAC, 0xAF,
+    0x2F, 0x77, 0x21, 0x5E, 0xC4, 0x40, 0xE2, 0x1A, 0x55, 0x64, 0x8F, 0x3A, 0x70, 0x1F, 0xE3, 0x54,
+    0xA2, 0x43, 0x27, 0x8E, 0x69, 0xE2, 0x0E, 0xED, 0xEC, 0x4B, 0xB5, 0xA4, 0xD6, 0x87, 0xD1, 0x4E,
+    0x95, 0x0A, 0x2E, 0xAD, 0x63, 0x41, 0x4E, 0x2F, 0xD3, 0x7B, 0x6D, 0x47, 0xEF, 0x06, 0xD5, 0xEE,
+    0x10, 0xB9, 0x6D, 0x49, 0x5D, 0xA0, 0x8D, 0xAB, 0xE2, 0xE8, 0x56, 0xB0, 0x3B, 0x1C, 0xB0, 0xF1,
+    0xE8, 0xF1, 0x12, 0xB8, 0x69, 0x0A, 0xB8, 0x39, 0x9E, 0x32, 0x9D, 0x72, 0x72, 0xCA, 0xC1, 0x29,
+    0x26, 0x53, 0x2F, 0x68, 0x09, 0xBC, 0x33, 0x73, 0x7B, 0x70, 0xD6, 0x24, 0xF3, 0x6D, 0xA9, 0x47,
+    0xFB, 0xEA, 0xD4, 0x2C, 0x45, 0x01, 0x77, 0xA7, 0x88, 0x1C, 0x61, 0x3C, 0x13, 0x2D, 0x7A, 0x64,
+    0x9F, 0x3A, 0x90, 0x4B, 0x8A, 0xD8, 0xA1, 0x13, 0xF6, 0x1B, 0xB5, 0xB8, 0x61, 0x82, 0x4F, 0x75,
+    0x63, 0x33, 0x61, 0x7A, 0x31, 0xE2, 0xEA, 0xF5, 0xE9, 0x1F, 0xBF, 0x31, 0xEA, 0x8C, 0xB8, 0x67,
+    0x55, 0xC6, 0xBA, 0x6B, 0x9C, 0x62, 0x42, 0xE3, 0x2D, 0x75, 0xD4, 0xB1, 0xF5, 0x3A, 0x91, 0x4C,
+    0x50, 0x13, 0x27, 0x3A, 0x71, 0x82, 0xAD, 0x66, 0x0E, 0x68, 0x7D, 0xA6, 0x73, 0x4D, 0xEC, 0x31,
+    0x41, 0xA7, 0xCE, 0x35, 0x51, 0x65, 0x78, 0xE6, 0xAE, 0x67, 0x90, 0x84, 0xFC, 0xD9, 0xA4, 0x32,
+    0x73, 0x35, 0x31, 0xEB, 0xC4, 0x54, 0x47, 0x35, 0x35, 0xA1, 0x4A, 0x26, 0xE8, 0xD4, 0x86, 0x7A,
+    0xEC, 0x7C, 0x33, 0x5A, 0x67, 0x62, 0x8F, 0x09, 0x03, 0x6D, 0xA0, 0x1A, 0x3C, 0xB5, 0x64, 0x9A,
+    0xB7, 0x9E, 0x0E, 0x75, 0x54, 0x49, 0x8F, 0xEC, 0xAB, 0x84, 0x71, 0x33, 0x75, 0xD8, 0x47, 0xA7,
+    0x16, 0x35, 0xD5, 0xA3, 0xCA, 0xC8, 0x9B, 0x0B, 0x56, 0x16, 0xB4, 0x2C, 0xD0, 0xBD, 0x06, 0xE0,
+    0xFE, 0x83, 0xA3, 0xFA, 0x4B, 0x19, 0xD1, 0xF2, 0xFD, 0x09, 0xBD, 0xF0, 0x2C, 0x7A, 0xE2, 0x59,
+    0xEA, 0x91, 0x67, 0x69, 0x22, 0xF7, 0x31, 0x81, 0x09, 0x13, 0x54, 0xA2, 0x1B, 0xF5, 0x88, 0x5D,
+    0x6F, 0x05, 0x7A, 0x11, 0xC7, 0x2A, 0x0B, 0x6A, 0x1A, 0x12, 0x3A, 0x5D, 0x29, 0xA0, 0x55, 0x71,
+    0x77, 0x6D, 0xD8, 0x41, 0x1D, 0xF6, 0x92, 0xF8, 0x1F, 0x01, 0x6E, 0x4D, 0x27, 0x74, 0x6F, 0x7E,
+    0xCF, 0x37, 0xB1, 0x4D, 0x55, 0x42, 0xD8, 0xC7, 0xC4, 0x26, 0xA8, 0xCC, 0x44, 0xE7, 0x0D, 0x7A,
+    0x52, 0x89, 0x81, 0x96, 0x6E, 0x64, 0xBD, 0xBB, 0x60, 0x44, 0x02, 0x56, 0xEE, 0xC3, 0xF0, 0x27,
+    0x6E, 0x73, 0x11, 0xED, 0x1F, 0x6E, 0x61, 0xCB, 0x4E, 0xD0, 0xEC, 0x52, 0xFB, 0xBD, 0x4F, 0xD2,
+    0x0E, 0xA1, 0x91, 0xA4, 0x17, 0x54, 0xDE, 0xD9, 0x61, 0x5B, 0x40, 0xD3, 0x09, 0x95, 0x41, 0x28,
+    0x15, 0x31, 0x50, 0xC9, 0xD7, 0x19, 0xC4, 0x35, 0xB1, 0x68, 0x5C, 0x2A, 0x00, 0xC1, 0x39, 0x8C,
+    0xDD, 0x79, 0x38, 0xE6, 0xF8, 0x5B, 0x53, 0x23, 0x12, 0x7A, 0x59, 0xB8, 0xB5, 0xF9, 0xAC, 0xEB,
+    0xE8, 0x91, 0xD6, 0x71, 0xC2, 0x1F, 0xBC, 0xFD, 0x6F, 0x44, 0xDC, 0x09, 0x3A, 0x95, 0xBF, 0x75,
+    0xA2, 0xF5, 0x9C, 0xA2, 0x13, 0xE6, 0x15, 0x86, 0x45, 0xCB, 0xD4, 0x48, 0x44, 0x07, 0xE6, 0x16,
+    0x1D, 0x4F, 0xE8, 0xF4, 0x48, 0x36, 0x4E, 0x8F, 0x47, 0xB4, 0x9F, 0x49, 0x9C, 0x34, 0x41, 0xA7,
+    0x03, 0x3A, 0x9F, 0xAB, 0x55, 0x8B, 0x4C, 0x46, 0x24, 0x58, 0x11, 0xFA, 0x65, 0xE6, 0x31, 0xE0,
+    0x13, 0xF0, 0x8F, 0xF6, 0xE1, 0xE4, 0x00, 0x95, 0x3A, 0x74, 0x6C, 0x31, 0xBE, 0xF5, 0x1D, 0x26,
+    0x1C, 0x61, 0xC2, 0x4C, 0xF3, 0xC3, 0x44, 0xF3, 0x46, 0xA0, 0x16, 0x47, 0x2D, 0xA5, 0xC8, 0x6B,
+    0x32, 0xFC, 0x63, 0xE0, 0x2F, 0x2C, 0xA8, 0xF9, 0x00, 0x74, 0x3A, 0x80, 0x3A, 0x1E, 0x30, 0x9A,
+    0x70, 0xA0, 0xA7, 0xD6, 0x1D, 0x9B, 0xD9, 0x72, 0x6C, 0xF3, 0x29, 0xC7, 0xB2, 0xE6, 0x02, 0xEF,
+    0xF4, 0x8B, 0x8C, 0xF4, 0x49, 0x02, 0x7D, 0x18, 0x3C, 0x3D, 0x3D, 0x60, 0x42, 0x1D, 0xC9, 0x6A,
+    0xA2, 0x1E, 0x6F, 0x83, 0xED, 0x1C, 0x95, 0x44, 0x68, 0xA7, 0x0D, 0x08, 0xB1, 0xA9, 0xE4, 0x08,
+    0xFA, 0x6F, 0x66, 0x58, 0xDA, 0x40, 0xEF, 0x56, 0xDA, 0xD8, 0xA4, 0x7A, 0xC2, 0x7A, 0xF6, 0xA9,
+    0x12, 0x33, 0xC6, 0x55, 0x89, 0x13, 0xEA, 0x02, 0xB2, 0x59, 0xB0, 0x6A, 0x82, 0x53, 0x13, 0x50,
+    0xF3, 0x29, 0xE8, 0xBF, 0xDE, 0x9E, 0x52, 0xE0, 0xD3, 0x3E, 0x52, 0x50, 0xC5, 0x7A, 0xDA, 0xA1,
+    0x36, 0x79, 0x43, 0x69, 0x4B, 0xC9, 0x18, 0xA1, 0x9B, 0x2E, 0x72, 0x5D, 0x11, 0x6A, 0x91, 0xA0,
+    0x0E, 0x9F, 0x1E, 0x4B, 0xFA, 0xDE, 0xC6, 0xA2, 0x7B, 0xDD, 0x0E, 0x04, 0x75, 0x30, 0xB8, 0x92,
+    0xB7, 0x6F, 0x0D, 0x09, 0xD7, 0x15, 0x70, 0xF2, 0x63, 0x5F, 0xA7, 0x16, 0x8F, 0x75, 0x54, 0x5B,
+    0x11, 0x7F, 0xC0, 0xF9, 0xC7, 0x63, 0xD0, 0x09, 0x25, 0x0E, 0x13, 0x0B, 0x21, 0xAD, 0x2B, 0x2D,
+    0xB7, 0x8B, 0xFF, 0x55, 0x53, 0x49, 0x09, 0xEC, 0x6B, 0x30, 0xA4, 0x82, 0x6D, 0x9E, 0x87, 0x35,
+    0xED, 0x79, 0x06, 0x03, 0x23, 0x4F, 0x50, 0x05, 0xF6, 0xA8, 0x1D, 0xF7, 0x76, 0x37, 0x74, 0xE0,
+    0xC6, 0xEE, 0x86, 0x8A, 0x5C, 0x47, 0x07, 0xA8, 0xBE, 0x59, 0xD2, 0xB5, 0x8D, 0xA0, 0xAE, 0x04,
+    0xE7, 0xE3, 0xB2, 0x47, 0x2E, 0xBB, 0x8A, 0xA7, 0xCA, 0x30, 0x78, 0x6C, 0x49, 0x37, 0x32, 0x18,
+    0x4F, 0x35, 0x81, 0x85, 0x7A, 0xE4, 0x63, 0x99, 0x5A, 0x0A, 0xDA, 0x03, 0x18, 0xFF, 0x6F, 0xFF,
+    0xC7, 0x47, 0x9E, 0xF9, 0x8F, 0xDF, 0xD5, 0x33, 0x57, 0x00, 0x87, 0x53, 0x51, 0x45, 0x3D, 0x56,
+    0xA9, 0x8E, 0xF5, 0xD8, 0x84, 0x26, 0x18, 0xDF, 0x78, 0x3D, 0xE9, 0x44, 0xCF, 0x40, 0x93, 0xCC,
+    0x48, 0x26, 0xF3, 0x11, 0x9E, 0x40, 0xA1, 0x70, 0x38, 0x9E, 0xE0, 0x09, 0xF4, 0x58, 0x8D, 0x74,
+    0xAE, 0x75, 0xCC, 0xCC, 0x18, 0xDF, 0x04, 0x9D, 0xEA, 0xA4, 0x67, 0x3D, 0x55, 0x59, 0xCF, 0x64,
+    0x32, 0x1F, 0xE7, 0xE3, 0x28, 0xD4, 0x79, 0x9F, 0xCD, 0x9E, 0xD7, 0x76, 0xD5, 0xBD, 0xF7, 0x76,
+    0xB1, 0xFF, 0xEE, 0x00, 0x61, 0xED, 0x77, 0x2D, 0xC1, 0x2A, 0x9E, 0x77, 0xF6, 0x12, 0x1F, 0x7C,
+    0x1D, 0xB3, 0x23, 0xB1, 0x4B, 0xBB, 0x52, 0xC0, 0xBC, 0xC9, 0x46, 0xA3, 0xFE, 0xC9, 0x04, 0x3A,
+    0xDD, 0x06, 0x35, 0xB5, 0x1E, 0x72, 0x3D, 0x6E, 0xDD, 0xFF, 0x63, 0x2C, 0x58, 0x4C, 0xA0, 0x73,
+    0x3A, 0x15, 0xA4, 0xCF, 0x88, 0x88, 0xAB, 0x45, 0x24, 0x6A, 0x11, 0x99, 0xAB, 0xE5, 0xF0, 0x70,
+    0x55, 0x19, 0xAC, 0x5F, 0xC1, 0xA4, 0x73, 0x62, 0x1F, 0x65, 0x6B, 0xB1, 0x51, 0xFF, 0x15, 0xA0,
+    0xC3, 0x3D, 0xA8, 0x7C, 0xBD, 0x83, 0x92, 0xD4, 0xBC, 0x2B, 0x41, 0x8B, 0xAE, 0xF5, 0x09, 0x38,
+    0x38, 0x01, 0xBA, 0x8E, 0x8D, 0x6F, 0xE6, 0x2B, 0x13, 0x34, 0xE1, 0x18, 0xEA, 0x68, 0x7C, 0x61,
+    0x5C, 0x95, 0xC8, 0xA8, 0x19, 0x0B, 0x19, 0x13, 0x18, 0x44, 0x26, 0x7A, 0x91, 0xA5, 0x20, 0x94,
+    0xDD, 0x2B, 0x87, 0x4F, 0x8F, 0x6D, 0x40, 0xCF, 0x66, 0x04, 0x69, 0xD2, 0x76, 0xEE, 0xD3, 0x2A,
+    0x81, 0x4E, 0xA5, 0xA7, 0x30, 0x00, 0xA2, 0xE7, 0x5F, 0xCC, 0xAF, 0xD6, 0x9F, 0x13, 0xD7, 0xE4,
+    0x8B, 0x7A, 0xFD, 0x8D, 0xB0, 0x23, 0x4F, 0x4D, 0xB7, 0xD9, 0xE8, 0xE3, 0xA4, 0x1E, 0x37, 0x02,
+    0xB1, 0x58, 0x0A, 0x85, 0x45, 0xB6, 0x85, 0xC4, 0x82, 0x7F, 0xF7, 0x22, 0x0B, 0x5A, 0x44, 0x26,
+    0xBA, 0x57, 0x0E, 0x9F, 0x1E, 0x0B, 0xCF, 0xCC, 0x08, 0xC2, 0x25, 0xC8, 0xFF, 0xFF, 0x0F, 0x14,
+    0xFF, 0xBB, 0xB0, 0x0B, 0x3E, 0x1A, 0x80, 0xDF, 0x03, 0xD4, 0x1F, 0xB1, 0x03, 0x0D, 0x4A, 0xCB,
+    0xA7, 0x75, 0x40, 0xE7, 0x28, 0x11, 0xE5, 0xA1, 0xAB, 0x12, 0x59, 0x4B, 0xAA, 0xDA, 0xCB, 0x0B,
+    0xAE, 0x3A, 0x47, 0xC5, 0xCF, 0x2B, 0x08, 0x13, 0x00, 0x2B, 0x73, 0x49, 0x04, 0x1B, 0x91, 0xAD,
+    0x7A, 0x98, 0x29, 0xED, 0xC8, 0x62, 0x64, 0x19, 0x68, 0x7E, 0x76, 0x78, 0xB3, 0x90, 0x28, 0x22,
+    0xA1, 0x16, 0x11, 0x3A, 0x91, 0xC2, 0x9E, 0x7B, 0x5B, 0x9B, 0x95, 0xBD, 0x5D, 0x5B, 0xFC, 0xC9,
+    0x5F, 0xAE, 0xF9, 0x7F, 0x27, 0x74, 0x55, 0x71, 0xF7, 0xA0, 0xFF, 0x1C, 0xA1, 0xFE, 0xCC, 0x08,
+    0x9F, 0x66, 0x6B, 0xE8, 0x0D, 0x22, 0x5E, 0x8B, 0x64, 0x5A, 0x79, 0xFD, 0x0E, 0x27, 0xE7, 0x2D,
+    0x03, 0xBF, 0xD5, 0x0A, 0xE5, 0x2F, 0x59, 0xCF, 0x9B, 0x3D, 0xA1, 0x3C, 0xE9, 0xF8, 0xBC, 0x62,
+    0x0B, 0xBB, 0xFA, 0xED, 0xEC, 0xF0, 0xB0, 0x34, 0x17, 0xAC, 0x48, 0x52, 0x22, 0x12, 0x1A, 0x11,
+    0xB9, 0x04, 0x96, 0x1C, 0x43, 0xE7, 0x4F, 0xC1, 0xFA, 0x05, 0xFA, 0xCF, 0xE6, 0x77, 0x33, 0xA3,
+    0x11, 0x99, 0x0B, 0x33, 0x5A, 0x79, 0xFD, 0x4E, 0x69, 0x70, 0x58, 0x36, 0x6E, 0x94, 0xCA, 0x25,
+    0x97, 0x7A, 0x7C, 0x2C, 0xEC, 0xA8, 0x44, 0xC2, 0x86, 0x29, 0x8D, 0x3B, 0x7E, 0x98, 0x73, 0xA4,
+    0xA4, 0x7B, 0xFE, 0xF0, 0xA9, 0xC2, 0x10, 0xBB, 0x35, 0x57, 0x12, 0x83, 0x48, 0x82, 0x27, 0xC1,
+    0x78, 0xEA, 0x84, 0xFA, 0x8B, 0x87, 0xF1, 0x9C, 0x48, 0x1B, 0xE8, 0x02, 0x9D, 0xC7, 0x3A, 0x2C,
+    0xF4, 0xF0, 0x00, 0x32, 0x2A, 0x53, 0xCD, 0xE8, 0x09, 0x3D, 0x51, 0x27, 0x9A, 0x84, 0x19, 0x69,
+    0x23, 0x5D, 0xC4, 0x06, 0xFA, 0x50, 0x60, 0x48, 0x15, 0xE1, 0x06, 0x98, 0x92, 0x45, 0x1F, 0xFD,
+    0x72, 0xD1, 0x2F, 0xD0, 0x86, 0xD2, 0x70, 0xF4, 0xE8, 0x2D, 0xAA, 0x24, 0x78, 0x00, 0x26, 0xA0,
+    0x2E, 0xDD, 0xBF, 0x68, 0xA6, 0x8F, 0xA8, 0x05, 0xBA, 0x88, 0xCE, 0xD0, 0x87, 0x02, 0x59, 0xD4,
+    0x0E, 0x16, 0x78, 0xF2, 0x45, 0xEA, 0xAF, 0x8C, 0x44, 0xE5, 0xFF, 0xD6, 0x77, 0x00, 0xC8, 0x3A,
+    0xD5, 0xA9, 0xF3, 0xD6, 0xAF, 0x6A, 0x6D, 0xA6, 0x77, 0x1F, 0xC6, 0x3A, 0x54, 0x2E, 0xED, 0x9E,
+    0xAE, 0xB4, 0x4E, 0x2F, 0x63, 0xF8, 0xEF, 0x82, 0xF3, 0xE3, 0x79, 0xAB, 0xD5, 0x8C, 0xD0, 0x3B,
+    0xAA, 0xA5, 0xF8, 0x8E, 0x3E, 0x50, 0x6D, 0x55, 0xCC, 0x93, 0x2A, 0x00, 0xFF, 0xE9, 0x39, 0x0F,
+    0xFC, 0xE4, 0x3B, 0x0E, 0x54, 0x28, 0xAA, 0xF4, 0xF7, 0x7F, 0x35, 0x74, 0xBD, 0xFB, 0x75, 0xD1,
+    0xF5, 0xF9, 0x57, 0x44, 0xD7, 0x4B, 0xCF, 0x64, 0x9B, 0x5B, 0x29, 0xA3, 0x27, 0xC5, 0xEB, 0x28,
+    0xF7, 0x2E, 0xDE, 0xFC, 0x16, 0xE0, 0xF0, 0xBB, 0x78, 0xB7, 0x4D, 0xE4, 0xBC, 0x78, 0x31, 0x78,
+    0xA3, 0x03, 0xBF, 0xDA, 0xF5, 0x5B, 0x71, 0x8A, 0x1B, 0xB0, 0x41, 0x51, 0xF0, 0x8E, 0x07, 0xF4,
+    0x4B, 0x09, 0x68, 0x78, 0xE2, 0xB7, 0x8A, 0xCE, 0x6A, 0x32, 0x61, 0x17, 0xCE, 0x9B, 0xD4, 0x05,
+    0x30, 0xC9, 0xFA, 0xDF, 0x5A, 0xAE, 0xBA, 0x8B, 0x21, 0xAE, 0x7A, 0x3C, 0x4F, 0x8B, 0xDE, 0xAD,
+    0xC8, 0xEA, 0x29, 0xB8, 0x49, 0x3B, 0x62, 0x26, 0x06, 0x87, 0x0D, 0x5B, 0xEF, 0x73, 0xA4, 0x9E,
+    0xE8, 0x1D, 0x5D, 0xA8, 0x76, 0xCD, 0x50, 0x3D, 0x63, 0x3D, 0x6D, 0x50, 0x19, 0x06, 0xEA, 0x84,
+    0x9E, 0xE9, 0x3C, 0x26, 0xB2, 0x40, 0xBF, 0x4D, 0xD5, 0xB4, 0x01, 0x13, 0x19, 0x60, 0x40, 0x2F,
+    0x34, 0x33, 0x46, 0xBE, 0x25, 0x01, 0x2B, 0xB2, 0x82, 0xEC, 0x52, 0x00, 0x87, 0x1A, 0x4A, 0x5B,
+    0xE5, 0x61, 0x45, 0x4E, 0x17, 0xB3, 0x6B, 0x47, 0x17, 0xE4, 0x7F, 0xD0, 0xA5, 0x6E, 0xBE, 0xF7,
+    0x0C, 0xEA, 0x17, 0x9F, 0xC1, 0xFD, 0x3F, 0x3A, 0xC3, 0x8D, 0x8B, 0x0C, 0xD3, 0xDC, 0x07, 0x48,
+    0x7B, 0x0F, 0x6B, 0xF1, 0x21, 0x1C, 0xBA, 0x7A, 0x46, 0x2F, 0x74, 0xB1, 0x34, 0x0F, 0xE8, 0xBD,
+    0x9E, 0xA9, 0x16, 0xDA, 0x48, 0x93, 0x18, 0xD8, 0x24, 0xB0, 0x60, 0x22, 0x75, 0xA2, 0x67, 0xA3,
+    0x7E, 0xDD, 0xB0, 0x30, 0xEB, 0x68, 0x03, 0x19, 0x1E, 0x50, 0x27, 0xF4, 0x44, 0x17, 0xE8, 0x02,
+    0xE2, 0xAA, 0x15, 0x2D, 0xAF, 0x17, 0xE8, 0x4E, 0x3C, 0x56, 0x24, 0x43, 0x2F, 0x12, 0xE1, 0x96,
+    0x5C, 0xCA, 0x3A, 0xD5, 0xD4, 0x04, 0x30, 0xC1, 0x02, 0x7D, 0x95, 0x41, 0x67, 0x93, 0xDE, 0x97,
+    0xA7, 0xEA, 0x3D, 0x3C, 0x5D, 0x31, 0x23, 0xCD, 0x7B, 0x78, 0x3A, 0x5D, 0xE6, 0x69, 0xF3, 0xB7,
+    0xC8, 0x53, 0xE5, 0x36, 0xC8, 0x37, 0x6F, 0xB9, 0xE7, 0xA6, 0xBC, 0xBF, 0x2E, 0x72, 0x5B, 0x3C,
+    0xE5, 0x8B, 0x65, 0x48, 0x4D, 0x87, 0x82, 0x9C, 0xBD, 0x5F, 0xFE, 0xF6, 0xEB, 0x3E, 0xFF, 0xD1,
+    0xCD, 0xCC, 0xEA, 0xBF, 0x02, 0x1D, 0x12, 0x95, 0xAF, 0xB7, 0x91, 0x8F, 0x57, 0x0B, 0xE2, 0x78,
+    0x5C, 0x65, 0xF6, 0x39, 0x60, 0x1F, 0xE3, 0x5B, 0x74, 0x34, 0xA8, 0xA4, 0x03, 0x59, 0x8D, 0x0C,
+    0x9C, 0x20, 0xBE, 0x13, 0x19, 0x6B, 0x91, 0x09, 0x91, 0x23, 0x9A, 0xB5, 0xDD, 0xD5, 0x2D, 0x75,
+    0x64, 0xD1, 0x13, 0xF6, 0x33, 0x99, 0x2E, 0xC8, 0xA5, 0xEC, 0x2A, 0xDF, 0xA3, 0x95, 0x4C, 0xEB,
+    0x07, 0x8C, 0x33, 0xDE, 0x38, 0x3D, 0xD6, 0x81, 0x49, 0x07, 0x8E, 0x48, 0x58, 0x9E, 0xA5, 0x0B,
+    0x1D, 0x76, 0x6C, 0x44, 0x66, 0x55, 0x2A, 0x96, 0x1F, 0xB3, 0x71, 0xE3, 0x97, 0x20, 0xCE, 0xF5,
+    0xBB, 0x11, 0xE7, 0x56, 0x3C, 0xBE, 0xCC, 0x42, 0xDD, 0x81, 0x3F, 0xA6, 0x99, 0x36, 0xE4, 0xF4,
+    0xFE, 0x6E, 0x54, 0xCF, 0xC3, 0xC5, 0x40, 0xD9, 0xC5, 0xF5, 0x9B, 0x80, 0xC6, 0xD4, 0xAE, 0x14,
+    0xA0, 0x3A, 0x94, 0x84, 0x57, 0x7D, 0x60, 0xE1, 0x39, 0x78, 0xAA, 0x35, 0xA3, 0x27, 0xED, 0xAB,
+    0x91, 0x7B, 0xD5, 0xC8, 0x11, 0x6F, 0x0F, 0xC2, 0x20, 0x12, 0x0E, 0x0E, 0xB7, 0x99, 0xC9, 0xF3,
+    0xA9, 0x96, 0x9F, 0xFD, 0xBE, 0x6B, 0x44, 0x02, 0x83, 0x24, 0xAE, 0xCA, 0x9D, 0xDD, 0x5C, 0x65,
+    0x84, 0xE6, 0x14, 0xEA, 0xAF, 0x8C, 0x68, 0x77, 0xF5, 0xB2, 0x62, 0x40, 0xF3, 0x4E, 0xC2, 0xC4,
+    0x47, 0x69, 0x7C, 0x15, 0x1A, 0xAF, 0x92, 0x7E, 0xBD, 0xCC, 0xFC, 0x70, 0x76, 0xB3, 0xE8, 0x57,
+    0xBB, 0x9B, 0xE2, 0x90, 0xE7, 0xFF, 0x90, 0x4E, 0xA4, 0x24, 0xB4, 0x8F, 0xAF, 0xEE, 0x3C, 0x65,
+    0x3E, 0x40, 0xE5, 0x66, 0xC4, 0xFA, 0x85, 0x7A, 0xEE, 0xDE, 0xCF, 0xC7, 0x35, 0x73, 0xD9, 0x48,
+    0x4F, 0xDA, 0x73, 0x9F, 0xEB, 0x3C, 0x49, 0x1D, 0xF4, 0xEB, 0x92, 0x19, 0x44, 0x82, 0x79, 0xDE,
+    0x6D, 0x30, 0x9E, 0xDB, 0x0D, 0x7C, 0x9E, 0x7D, 0x31, 0x32, 0x48, 0x2E, 0x7B, 0x5D, 0x95, 0x3B,
+    0x28, 0xC7, 0x5C, 0x10, 0xE8, 0x8D, 0xF4, 0x48, 0x62, 0x8F, 0x6B, 0x34, 0x4E, 0x07, 0x95, 0xB8,
+    0xCF, 0x3E, 0x2D, 0x4D, 0xD0, 0x49, 0xCD, 0x25, 0xF6, 0xEE, 0xC1, 0x8B, 0xA8, 0x11, 0x1D, 0xDE,
+    0xDF, 0x2E, 0x5E, 0x84, 0x04, 0x09, 0x35, 0x52, 0x45, 0x74, 0xA0, 0x0E, 0x34, 0x1E, 0xE3, 0x68,
+    0xA1, 0xE3, 0xE2, 0x57, 0x03, 0x7C, 0x1D, 0x35, 0xA3, 0xDF, 0xA4, 0xF9, 0x6C, 0xFC, 0x38, 0xCF,
+    0xFC, 0xDF, 0xAD, 0x85, 0x2A, 0x99, 0x90, 0xEB, 0x34, 0xE8, 0xD9, 0xBE, 0x74, 0x19, 0xFD, 0x7E,
+    0x06, 0xF6, 0xCA, 0x38, 0xB4, 0xA7, 0x2A, 0x13, 0xD3, 0x47, 0x25, 0xEB, 0x77, 0xD4, 0x81, 0x2A,
+    0x41, 0x86, 0xE3, 0xAD, 0x58, 0xA4, 0x73, 0x81, 0xFA, 0xDF, 0x5F, 0x87, 0xF1, 0x0D, 0xC7, 0x13,
+    0xF5, 0xF8, 0xF0, 0x61, 0xEA, 0x7F, 0x32, 0x97, 0xC9, 0x2A, 0x73, 0xD6, 0x3A, 0x95, 0x99, 0xE9,
+    0x9C, 0xF1, 0x3A, 0x31, 0x71, 0x9B, 0xD6, 0x35, 0xA1, 0x4A, 0x64, 0x2C, 0x6D, 0xA8, 0xC7, 0x6A,
+    0xE6, 0x01, 0xD6, 0x99, 0x58, 0x27, 0x32, 0x43, 0x81, 0x66, 0x77, 0x15, 0x8C, 0x1E, 0x37, 0xDF,
+    0x74, 0xE5, 0xCE, 0xFB, 0xF0, 0xEC, 0xEE, 0x88, 0x12, 0xA1, 0x5A, 0xBE, 0x94, 0xD4, 0xC4, 0x11,
+    0x33, 0xC6, 0x1D, 0xA1, 0xE3, 0x01, 0x2A, 0x19, 0x47, 0xAE, 0x03, 0xB7, 0xD5, 0x4C, 0x8F, 0x7D,
+    0x47, 0x9C, 0x11, 0x71, 0x88, 0xB8, 0xDD, 0x08, 0x6B, 0xB3, 0x33, 0x80, 0x6D, 0x88, 0xB6, 0x1A,
+    0x7F, 0x95, 0x68, 0xF8, 0x9B, 0x6C, 0x79, 0x7D, 0xAB, 0xB2, 0x9A, 0x0C, 0xF5, 0x73, 0x11, 0xED,
+    0x3E, 0xFC, 0x2E, 0xCF, 0xF8, 0x9B, 0xA0, 0xE4, 0x73, 0x3D, 0xD2, 0xF9, 0x05, 0x3D, 0x9B, 0xC8,
+    0xF0, 0xDE, 0x4A, 0x71, 0x77, 0x7D, 0x72, 0x86, 0x56, 0x12, 0xCD, 0x5B, 0x4F, 0x07, 0x35, 0x71,
+    0xC4, 0x01, 0x3A, 0xD6, 0x81, 0x7D, 0x66, 0xEA, 0x60, 0x1C, 0x59, 0x25, 0x5A, 0xD7, 0xFA, 0x3A,
+    0x21, 0x6F, 0x2E, 0x65, 0xB6, 0xC2, 0x4A, 0x84, 0xE1, 0x0E, 0xA5, 0x9B, 0x76, 0x70, 0xA9, 0x8B,
+    0x72, 0xE5, 0xE2, 0xA7, 0x1F, 0x1C, 0xD4, 0x81, 0xA9, 0xA3, 0x09, 0x33, 0x56, 0x47, 0xE6, 0x96,
+    0x3A, 0x1E, 0xD1, 0x55, 0x89, 0x6C, 0x7C, 0x33, 0x5A, 0x06, 0x2F, 0xB2, 0x68, 0x91, 0x64, 0x44,
+    0x42, 0x2B, 0xC7, 0x5C, 0x71, 0x3B, 0x0C, 0xA0, 0x71, 0xF0, 0x6C, 0x91, 0xC6, 0xC1, 0x2F, 0x22,
+    0xFD, 0xD7, 0xDE, 0xA1, 0x0A, 0x85, 0xF3, 0xEF, 0x04, 0x9A, 0xCF, 0x46, 0x9E, 0x61, 0x2C, 0x26,
+    0x69, 0xBE, 0x92, 0xD8, 0x6F, 0x42, 0x95, 0x0E, 0x30, 0x61, 0xE2, 0xA0, 0x0E, 0x6A, 0x6A, 0x69,
+    0xC2, 0x09, 0x56, 0x8F, 0xD5, 0x6C, 0x42, 0x37, 0x5A, 0x11, 0x57, 0x7E, 0x49, 0x93, 0x6A, 0xF9,
+    0xB1, 0x57, 0x4F, 0x01, 0xC6, 0xDF, 0xA6, 0x73, 0x0B, 0xF6, 0x33, 0x99, 0x41, 0x3F, 0xC4, 0xE9,
+    0x6D, 0xF8, 0xB8, 0x74, 0x43, 0xBC, 0x4E, 0xC6, 0xE9, 0xB1, 0xA5, 0x8E, 0x2D, 0x4D, 0xE8, 0x30,
+    0xE1, 0x80, 0xCE, 0x5B, 0x06, 0x6F, 0x45, 0x9C, 0x2D, 0x93, 0x8C, 0xB4, 0x72, 0xBC, 0x79, 0xFB,
+    0xAB, 0xF2, 0xFD, 0x17, 0xBE, 0xB5, 0xC2, 0x20, 0xDB, 0xD8, 0xCC, 0x17, 0x45, 0x64, 0xA6, 0x9D,
+    0xB6, 0xC9, 0xBF, 0x50, 0xC6, 0x79, 0xA4, 0x54, 0x81, 0x6A, 0x29, 0xDD, 0x78, 0x3D, 0x97, 0x59,
+    0xF7, 0x3A, 0x15, 0x4C, 0xA9, 0x19, 0xA1, 0x97, 0x19, 0x13, 0xB6, 0x29, 0xC4, 0x00, 0x22, 0x89,
+    0xD6, 0xA3, 0xC4, 0x43, 0xE7, 0xA9, 0xA4, 0x0C, 0x90, 0xE8, 0x15, 0xE8, 0xA6, 0x02, 0x1F, 0x76,
+    0x22, 0x72, 0x76, 0xF8, 0x14, 0x6D, 0xF9, 0xF1, 0x10, 0xCD, 0xF6, 0x5E, 0x6D, 0xEF, 0xDC, 0x92,
+    0x61, 0xD7, 0x5A, 0x57, 0xDF, 0x80, 0x0F, 0xAF, 0x0C, 0x19, 0x25, 0xD2, 0xC6, 0x3D, 0xBA, 0x57,
+    0xFA, 0x89, 0x67, 0xD4, 0x44, 0xEF, 0xD4, 0x68, 0x3C, 0xCB, 0x1F, 0x88, 0x3F, 0x42, 0x8B, 0xAC,
+    0x7A, 0xA4, 0xFD, 0xE6, 0x4D, 0x8C, 0x23, 0x03, 0x47, 0x65, 0x74, 0x7E, 0xA6, 0x8F, 0xA0, 0x65,
+    0x90, 0xB7, 0xBE, 0xE4, 0x8D, 0xC8, 0x20, 0x0B, 0x46, 0xA6, 0x5E, 0x26, 0x9A, 0x85, 0xEE, 0x0C,
+    0xAE, 0x6C, 0xC3, 0x97, 0xD9, 0xEE, 0xA6, 0xD5, 0xAE, 0x1C, 0x1E, 0x1E, 0x3E, 0x55, 0x7A, 0xFD,
+    0xE5, 0xEE, 0xF9, 0x6C, 0xC9, 0xE0, 0x6D, 0x68, 0xA3, 0x19, 0xEB, 0xA4, 0xB3, 0x5A, 0xE0, 0xFC,
+    0xA7, 0x1C, 0xC1, 0xFA, 0x81, 0xE1, 0x4F, 0x26, 0x9D, 0x6D, 0x68, 0x7F, 0xB0, 0xB0, 0x9A, 0xB1,
+    0x4E, 0x03, 0xF6, 0xE5, 0x59, 0x2D, 0x6D, 0xD4, 0x8B, 0x8D, 0xF6, 0x3B, 0xB9, 0x99, 0x06, 0xC4,
+    0x8C, 0xED, 0x4B, 0x59, 0xCF, 0xD6, 0x0F, 0xBB, 0xF9, 0x4B, 0x32, 0xC7, 0xD8, 0xCE, 0x9B, 0xD8,
+    0xFC, 0x74, 0x56, 0x0B, 0xEB, 0xE0, 0xBA, 0xD0, 0xC6, 0xFF, 0x03, 0xA5, 0x98, 0x31, 0xAC, 0x1D,
+    0xC7, 0x75, 0x86, 0xBF, 0xD9, 0x31, 0xB9, 0x30, 0x26, 0xF0, 0xB8, 0x60, 0x82, 0xC0, 0x82, 0xDE,
+    0xB6, 0x8E, 0x21, 0x72, 0x9B, 0x14, 0x2C, 0xEE, 0xBD, 0xB3, 0x92, 0x0B, 0x17, 0x2A, 0xEC, 0x00,
+    0xA2, 0x52, 0xB8, 0x70, 0x93, 0x2A, 0x0E, 0xC0, 0xC6, 0xC5, 0x2B, 0xEE, 0xE3, 0x4E, 0xA2, 0xC2,
+    0xA5, 0xD9, 0xB8, 0xB6, 0x8A, 0x34, 0x79, 0x42, 0x42, 0x16, 0x2C, 0x5E, 0x71, 0xC9, 0x3B, 0x92,
+    0x0A, 0x15, 0x2E, 0x32, 0x36, 0x62, 0xB8, 0x70, 0xE1, 0x11, 0x64, 0x20, 0x89, 0x84, 0x80, 0x63,
+    0x7B, 0x1C, 0x2D, 0xA9, 0xB9, 0x7B, 0x52, 0xEC, 0x7D, 0xA4, 0x68, 0x07, 0x41, 0x00, 0x2F, 0xB0,
+    0xC5, 0x62, 0x77, 0xE7, 0x9C, 0xF3, 0xCF, 0x39, 0xE7, 0xFF, 0xCF, 0xC0, 0x57, 0xD5, 0x5D, 0x5A,
+    0xBF, 0x86, 0x07, 0x3A, 0xF0, 0xC2, 0xD5, 0x89, 0x84, 0x46, 0xA4, 0xB2, 0x01, 0x74, 0x04, 0xB6,
+    0x80, 0x09, 0x40, 0x01, 0xAC, 0x48, 0x50, 0x22, 0x13, 0x37, 0xFE, 0xE0, 0xF5, 0xB4, 0xBC, 0x8E,
+    0x4A, 0xE4, 0x40, 0x2F, 0x12, 0xB4, 0x48, 0x05, 0xE8, 0x3C, 0xE0, 0x02, 0xB0, 0x0F, 0xA0, 0x24,
+    0x80, 0xFE, 0x24, 0x80, 0xF9, 0x71, 0x80, 0xEE, 0x1B, 0x11, 0x36, 0x6D, 0x84, 0x5D, 0x9B, 0x50,
+    0x45, 0x27, 0x74, 0xD6, 0x19, 0x13, 0x74, 0xA6, 0xF3, 0x3A, 0xE3, 0xD0, 0x99, 0xBD, 0x48, 0x51,
+    0x22, 0x52, 0xB4, 0x88, 0x14, 0xF3, 0xBB, 0x5B, 0x7F, 0x3D, 0x75, 0x01, 0x3D, 0x39, 0x8F, 0xAE,
+    0x7B, 0xD0, 0x95, 0x51, 0x24, 0xB4, 0x4F, 0xCF, 0xDF, 0x66, 0x07, 0xD8, 0x4B, 0x8F, 0xBA, 0x01,
+    0x9A, 0x0C, 0x38, 0xB9, 0x8B, 0x7E, 0x7A, 0x2F, 0x70, 0xC6, 0x09, 0x26, 0x90, 0xA9, 0x58, 0xAC,
+    0x57, 0x99, 0xC2, 0x43, 0xBA, 0xF3, 0x7D, 0x68, 0x44, 0x0A, 0x4E, 0x0E, 0x68, 0x99, 0x9F, 0xE3,
+    0xF1, 0x2B, 0xCC, 0xC7, 0xF7, 0xBC, 0x4E, 0x64, 0x0A, 0xAF, 0xB0, 0xC5, 0xD2, 0xD3, 0x06, 0x3B,
+    0x98, 0xA0, 0x45, 0xBC, 0x12, 0x89, 0x5C, 0xD0, 0xB3, 0x46, 0xC7, 0x0E, 0x26, 0x13, 0x78, 0xA4,
+    0x13, 0xE3, 0x30, 0xBF, 0x23, 0x61, 0x14, 0x89, 0xBD, 0x48, 0xB0, 0x32, 0x0F, 0x9F, 0x43, 0x59,
+    0x44, 0xB0, 0x22, 0x79, 0xF1, 0x0C, 0xD0, 0x09, 0xB8, 0x03, 0x98, 0x08, 0x54, 0xA0, 0x0B, 0xD0,
+    0x4C, 0x80, 0x1B, 0x40, 0x67, 0x60, 0x04, 0x4C, 0x06, 0x66, 0xA0, 0x8B, 0xD0, 0xD4, 0x4B, 0x60,
+    0x8F, 0x97, 0x93, 0x0A, 0xA3, 0x54, 0xB8, 0x60, 0x82, 0x42, 0x41, 0x65, 0x95, 0x69, 0x52, 0x93,
+    0xD1, 0x51, 0x67, 0x74, 0xD0, 0x09, 0x13, 0xDA, 0x88, 0xF5, 0x26, 0x60, 0xB1, 0x81, 0x8E, 0xCE,
+    0xB3, 0xA1, 0x1F, 0xA8, 0x0B, 0xD8, 0x8E, 0xFE, 0xE9, 0xB9, 0xDC, 0x1D, 0x45, 0x24, 0x8C, 0x22,
+    0xE2, 0xCF, 0xA0, 0xE7, 0x0C, 0x36, 0x5C, 0x83, 0x6B, 0x8B, 0x2D, 0x25, 0x52, 0x97, 0x6D, 0x4E,
+    0xC0, 0x1A, 0x68, 0x03, 0x2C, 0xE0, 0x0F, 0x80, 0x48, 0xA5, 0x13, 0xF1, 0xCD, 0x1F, 0xBE, 0xF6,
+    0x80, 0xC8, 0x81, 0x4E, 0x24, 0x36, 0x22, 0x15, 0x27, 0x12, 0xA0, 0xCD, 0x5A, 0x06, 0xE7, 0x71,
+    0xDE, 0x65, 0x93, 0x69, 0x6A, 0x2B, 0x4D, 0x05, 0x9B, 0xC6, 0x38, 0x02, 0xFB, 0xB6, 0x76, 0x11,
+    0x74, 0xD9, 0x7F, 0x50, 0x00, 0xF7, 0xE3, 0x32, 0x03, 0xEA, 0x20, 0xCE, 0x03, 0xF6, 0xB1, 0x24,
+    0x38, 0x46, 0x0F, 0x5A, 0xE4, 0x88, 0x48, 0x62, 0xC9, 0x4B, 0x80, 0x76, 0xC9, 0x48, 0x25, 0x22,
+    0x09, 0xD8, 0x3F, 0xFE, 0x4C, 0x06, 0xE8, 0x0F, 0xF2, 0xA3, 0x0A, 0x56, 0xFA, 0x49, 0x12, 0x5A,
+    0xDE, 0x97, 0xD7, 0x65, 0x40, 0xF2, 0x58, 0x5C, 0x65, 0xAC, 0x46, 0x5E, 0x93, 0xBC, 0xC4, 0x7C,
+    0x55, 0xEE, 0xD2, 0xCB, 0xC4, 0xD7, 0xFE, 0xAA, 0x1E, 0x83, 0x5A, 0x03, 0x67, 0xCB, 0x8E, 0xB5,
+    0x99, 0x5E, 0x3C, 0x6E, 0x3E, 0xEE, 0x62, 0x93, 0x96, 0x5B, 0xA7, 0x2F, 0xD3, 0x85, 0xCD, 0x2D,
+    0xF1, 0x4E, 0x84, 0x51, 0x2A, 0x2F, 0x89, 0xFF, 0x7C, 0xC9, 0x1D, 0xE0, 0x16, 0x36, 0xD0, 0x25,
+    0x55, 0xD1, 0x07, 0x7A, 0x8F, 0x04, 0x5D, 0xE8, 0x2B, 0x23, 0x46, 0xBC, 0xC9, 0x4A, 0x0A, 0x33,
+    0x6E, 0xC4, 0x06, 0xFB, 0x8B, 0xAC, 0xAA, 0x9E, 0x66, 0x7A, 0xBF, 0xEF, 0xA2, 0x2E, 0xDD, 0x7B,
+    0x95, 0xB1, 0xCD, 0x2E, 0x98, 0x7C, 0x68, 0x27, 0x66, 0xE7, 0xF7, 0x83, 0xFD, 0x45, 0xB2, 0x59,
+    0xCD, 0x55, 0xCD, 0xF4, 0x82, 0x8B, 0x5A, 0x82, 0xAE, 0x8C, 0x85, 0x7D, 0x30, 0x33, 0x76, 0x02,
+    0xAE, 0x70, 0x05, 0xC8, 0x24, 0xB0, 0xC3, 0x16, 0x18, 0x65, 0x80, 0x46, 0x3C, 0xA0, 0x9E, 0x65,
+    0xEA, 0x35, 0x00, 0x1B, 0xB9, 0xFA, 0x36, 0x15, 0x35, 0xD3, 0x05, 0x5C, 0x6C, 0x26, 0x6C, 0xC5,
+    0x0D, 0x5A, 0x42, 0x9B, 0xD9, 0x4F, 0x3C, 0xA2, 0x93, 0xC1, 0xC6, 0xF6, 0xD3, 0x4C, 0xE5, 0xB0,
+    0xA7, 0x0B, 0xEE, 0x07, 0xA9, 0x99, 0xCC, 0x87, 0x07, 0xDC, 0x6B, 0xB5, 0x0F, 0x6D, 0x1E, 0x75,
+    0x65, 0x6F, 0xE3, 0x38, 0xD8, 0x8F, 0x8A, 0xC9, 0x1C, 0x1E, 0x21, 0x74, 0x8F, 0x43, 0x97, 0xB4,
+    0x64, 0x7D, 0xC0, 0x55, 0x5C, 0x68, 0x65, 0x30, 0x95, 0x7D, 0x42, 0x3C, 0x34, 0x45, 0x57, 0x74,
+    0x36, 0x99, 0x36, 0xF7, 0x01, 0x13, 0x47, 0xB0, 0xEF, 0x1E, 0xA0, 0xFB, 0xA0, 0x40, 0xFF, 0xCD,
+    0x04, 0xCE, 0x79, 0x18, 0x67, 0x40, 0x2A, 0x20, 0x19, 0x94, 0x24, 0xD0, 0x92, 0x41, 0x4B, 0x05,
+    0xF3, 0xE9, 0x0C, 0xF6, 0x23, 0x19, 0xE8, 0xDE, 0x95, 0x40, 0x1F, 0x24, 0xE1, 0xFC, 0xBE, 0x30,
+    0xE2, 0x2A, 0x7B, 0x7A, 0x01, 0xFE, 0xF4, 0xD6, 0x1B, 0x68, 0x91, 0x8C, 0x15, 0xF1, 0xDC, 0x61,
+    0x47, 0x53, 0x74, 0xC6, 0x06, 0xEB, 0xD9, 0x70, 0xF6, 0xEC, 0x29, 0xB0, 0xE1, 0x0E, 0x4D, 0x69,
+    0xCA, 0xE5, 0xD3, 0x48, 0x53, 0x9A, 0x69, 0x79, 0xBA, 0x83, 0x43, 0xE7, 0x66, 0x42, 0x82, 0x8D,
+    0x6D, 0xC5, 0xBD, 0xD0, 0x53, 0x5D, 0xA0, 0x8B, 0x4A, 0x40, 0x30, 0x07, 0x4C, 0x65, 0x53, 0xB8,
+    0x93, 0xF8, 0x34, 0xE9, 0x5F, 0x0E, 0xED, 0xBF, 0x86, 0xCD, 0x96, 0xDE, 0x35, 0xBF, 0xC9, 0x4C,
+    0xBB, 0xEE, 0x9B, 0xBE, 0xFD, 0x69, 0xAE, 0x1B, 0x7A, 0xF3, 0x8B, 0x77, 0x0B, 0xB5, 0x9B, 0x6D,
+    0xD0, 0x69, 0xCC, 0x8E, 0xEE, 0x55, 0x79, 0x75, 0x62, 0xD7, 0x56, 0x13, 0x75, 0xB6, 0xC1, 0xD1,
+    0x79, 0xA8, 0x3C, 0x04, 0x93, 0x74, 0x5E, 0xBA, 0xC4, 0xD1, 0x1A, 0xD8, 0x40, 0x85, 0x91, 0x36,
+    0xD1, 0x4C, 0xF4, 0x03, 0x36, 0x52, 0xC1, 0xD1, 0x66, 0x54, 0xA5, 0x0F, 0xD8, 0xC4, 0x0C, 0x6E,
+    0xD0, 0x05, 0x55, 0xE9, 0x02, 0x26, 0x23, 0xE0, 0x82, 0x16, 0x91, 0x99, 0x4E, 0x44, 0x0A, 0x7B,
+    0x59, 0xBA, 0xB8, 0x08, 0xDD, 0xD3, 0xF3, 0x7B, 0x13, 0xFB, 0x01, 0x17, 0x75, 0x05, 0xC1, 0x66,
+    0xDA, 0xCA, 0x18, 0xE8, 0x53, 0x33, 0x83, 0x78, 0xE0, 0xEA, 0x52, 0x55, 0x32, 0x43, 0x2B, 0x6F,
+    0x8A, 0xA7, 0x2B, 0xB8, 0xC0, 0xE8, 0xE9, 0x22, 0x02, 0x36, 0x2D, 0xF5, 0xAC, 0x0B, 0x98, 0xD4,
+    0x66, 0x30, 0xD1, 0x46, 0x16, 0x08, 0xB1, 0xA1, 0xF3, 0xD0, 0xF9, 0xDE, 0x83, 0x1B, 0x7A, 0x0F,
+    0x7B, 0xFA, 0x88, 0x3E, 0xD0, 0x1F, 0x6E, 0xED, 0xEB, 0xD1, 0x27, 0x2B, 0x22, 0x09, 0x23, 0x22,
+    0x9E, 0x46, 0xE4, 0x00, 0xF4, 0x72, 0xF7, 0x45, 0x0E, 0x73, 0x0B, 0x0B, 0x09, 0x36, 0xB0, 0x63,
+    0x83, 0x4E, 0xAA, 0x60, 0x07, 0x13, 0xD8, 0xE2, 0x68, 0x32, 0x13, 0xD6, 0xB7, 0x91, 0x33, 0x7A,
+    0x9A, 0x4C, 0xC5, 0x06, 0x9D, 0xD8, 0xD0, 0x0F, 0xAA, 0x50, 0x17, 0xEA, 0x71, 0x74, 0x5E, 0x4D,
+    0x3C, 0xC4, 0x44, 0x9D, 0x97, 0x16, 0x2D, 0x33, 0x18, 0x91, 0x88, 0xFD, 0xD9, 0x77, 0x32, 0xD6,
+    0xAB, 0x42, 0x37, 0x50, 0x96, 0x25, 0x37, 0xE8, 0xCC, 0x19, 0x7D, 0x44, 0x44, 0x3C, 0x22, 0x33,
+    0x4A, 0xE4, 0x2E, 0x7A, 0x02, 0x74, 0x01, 0xDA, 0x0C, 0xD8, 0x0C, 0xD8, 0x74, 0x6C, 0xE0, 0xF4,
+    0xF1, 0xB2, 0x83, 0x8F, 0x01, 0xD8, 0x7F, 0xBE, 0x2F, 0xA8, 0xFD, 0x04, 0x8D, 0x48, 0xA0, 0x11,
+    0x29, 0x20, 0x11, 0x70, 0xF1, 0x72, 0x11, 0x5D, 0x39, 0x72, 0x02, 0x36, 0x72, 0x24, 0x83, 0x25,
+    0x0D, 0xDA, 0x0C, 0xB0, 0x07, 0x96, 0x62, 0x47, 0x22, 0x5F, 0xC0, 0xCA, 0x7F, 0xDE, 0x0E, 0x88,
+    0xC8, 0x84, 0x11, 0x91, 0x01, 0x27, 0x92, 0x51, 0x22, 0x02, 0x8D, 0x3C, 0xC3, 0xB0, 0x13, 0x91,
+    0xDA, 0x8B, 0x48, 0x75, 0xF3, 0x7C, 0x6F, 0x5A, 0xC8, 0x88, 0x09, 0x68, 0xCA, 0x65, 0x28, 0x3A,
+    0x3F, 0x8B, 0x27, 0x5D, 0xDA, 0xEF, 0x02, 0xD0, 0x07, 0xC0, 0x79, 0x60, 0x1C, 0x2E, 0x5D, 0x10,
+    0x40, 0xCD, 0x40, 0x73, 0xB8, 0x74, 0x7B, 0xF1, 0x1D, 0x80, 0x1D, 0x6D, 0x50, 0x99, 0x0D, 0x3A,
+    0xAA, 0x8C, 0xF5, 0xD6, 0xD3, 0xB3, 0x83, 0x33, 0x9D, 0x50, 0x93, 0x03, 0xFD, 0xEB, 0x09, 0xEC,
+    0x2F, 0x03, 0xF4, 0x33, 0x30, 0x66, 0x96, 0x6C, 0xD3, 0xF5, 0xD2, 0xFC, 0x1E, 0x30, 0x05, 0x94,
+    0xF8, 0xA5, 0xF0, 0xAD, 0x0C, 0x30, 0xA6, 0x17, 0x93, 0xE2, 0xB6, 0xCC, 0x43, 0xFB, 0xE4, 0xD1,
+    0xB7, 0x93, 0x1D, 0xCE, 0xB8, 0xBF, 0xA2, 0xF2, 0xE0, 0x7B, 0x54, 0xEE, 0xDF, 0x57, 0x13, 0xF9,
+    0x41, 0x53, 0x74, 0x7E, 0xF4, 0xF5, 0xDF, 0xDD, 0x8E, 0xA3, 0x88, 0x78, 0x27, 0x32, 0x73, 0x55,
+    0x24, 0x1D, 0x85, 0x44, 0xE7, 0x81, 0x7E, 0xB8, 0xC4, 0xD7, 0x3D, 0x83, 0x77, 0x7E, 0xBE, 0xBE,
+    0xCE, 0x70, 0x46, 0x53, 0x50, 0x05, 0x2A, 0x6D, 0x82, 0x03, 0x9D, 0x87, 0x47, 0xDC, 0x01, 0x9C,
+    0xAA, 0x80, 0xFB, 0x7E, 0x06, 0xBA, 0xC7, 0x01, 0xB0, 0x02, 0x60, 0x0F, 0x00, 0x66, 0x02, 0xE8,
+    0x96, 0x2D, 0x5D, 0x28, 0x6A, 0x06, 0xDA, 0x49, 0x80, 0x2E, 0xEF, 0x3D, 0x8C, 0x61, 0x0C, 0x28,
+    0xC1, 0x45, 0xDA, 0x4A, 0x9F, 0xE9, 0x0A, 0x5D, 0x61, 0x8C, 0xD8, 0x4B, 0x34, 0x33, 0x27, 0x74,
+    0x34, 0xB1, 0x49, 0xAC, 0x58, 0xD3, 0x06, 0x1D, 0xB8, 0x60, 0x8B, 0x1D, 0x8E, 0x32, 0xA7, 0xA7,
+    0x43, 0xA7, 0x26, 0xB3, 0x66, 0x43, 0x1B, 0x74, 0xA4, 0xB2, 0xC5, 0x7A, 0x13, 0x54, 0x61, 0xA2,
+    0xA7, 0x13, 0x99, 0x1B, 0x11, 0x09, 0x6E, 0x61, 0x4A, 0x7B, 0xA9, 0x9E, 0x36, 0xC0, 0x55, 0x8F,
+    0x1A, 0xB8, 0x66, 0x51, 0xF9, 0x02, 0xF3, 0x56, 0x64, 0x6D, 0x51, 0x79, 0x8B, 0x79, 0x2F, 0xB1,
+    0xB1, 0x83, 0x2A, 0x2B, 0x6C, 0xC8, 0xEC, 0xDB, 0xD4, 0x4D, 0x76, 0xD1, 0x3D, 0xF4, 0xA5, 0x2E,
+    0xE2, 0xA6, 0x1F, 0xA0, 0x2E, 0x28, 0x75, 0x97, 0x59, 0xDE, 0x0D, 0x7F, 0xD1, 0x64, 0x13, 0xBA,
+    0x61, 0xD2, 0xD9, 0x84, 0x35, 0x93, 0x4E, 0x1D, 0x67, 0x14, 0x13, 0x7A, 0xB6, 0x3A, 0xD9, 0xD0,
+    0x93, 0x75, 0xB4, 0x7E, 0xA5, 0xB2, 0x8E, 0x27, 0xEC, 0x54, 0x36, 0xC3, 0x86, 0x9D, 0x0E, 0x76,
+    0x58, 0x93, 0xDB, 0x60, 0x39, 0x6D, 0xB2, 0x0E, 0xD7, 0x99, 0x54, 0xB2, 0xB8, 0xF3, 0xF9, 0x9D,
+    0xD0, 0x89, 0x48, 0xB2, 0x22, 0x52, 0xFE, 0x9F, 0x36, 0xFC, 0xD1, 0xC6, 0x56, 0x65, 0x1D, 0x6F,
+    0xB0, 0x53, 0xD9, 0x0E, 0x6B, 0x2E, 0x74, 0xB0, 0x5C, 0xBF, 0xB4, 0x91, 0x74, 0xB8, 0x4E, 0x51,
+    0xC9, 0xE2, 0x44, 0xA4, 0x76, 0x22, 0x22, 0x56, 0x44, 0x64, 0xB8, 0xD4, 0xBE, 0x3A, 0x72, 0x04,
+    0x8A, 0xC2, 0xD7, 0xFE, 0x99, 0x56, 0x32, 0xE3, 0x01, 0x74, 0x80, 0x53, 0x30, 0x03, 0x14, 0xE8,
+    0xA0, 0x91, 0x27, 0xB8, 0x77, 0x26, 0x1D, 0x74, 0xDC, 0x72, 0x62, 0xBC, 0x4A, 0x85, 0x1B, 0x1D,
+    0xE6, 0xBD, 0xFC, 0x52, 0x75, 0x22, 0x5A, 0x24, 0x8E, 0x12, 0x9F, 0xAB, 0xF1, 0xD0, 0x2C, 0x3A,
+    0x6F, 0x05, 0xB8, 0x41, 0x07, 0xD0, 0x99, 0x53, 0x60, 0xC4, 0x78, 0x30, 0x89, 0x02, 0x54, 0xBA,
+    0xE5, 0x63, 0x79, 0x42, 0x33, 0xE1, 0xDE, 0x99, 0x70, 0x83, 0x0E, 0x3A, 0xEA, 0xCC, 0x96, 0x13,
+    0xF6, 0x18, 0xAF, 0x92, 0x4D, 0x14, 0x6E, 0x70, 0xC0, 0x62, 0x42, 0x1F, 0x9A, 0xFC, 0x52, 0xD5,
+    0x15, 0x27, 0xC2, 0xE8, 0xB5, 0x48, 0x34, 0x85, 0x51, 0x22, 0xF2, 0x79, 0xA1, 0xDA, 0x44, 0x58,
+    0x3D, 0x8F, 0xC3, 0xFF, 0x9F, 0x71, 0xD8, 0xFF, 0x3D, 0x0E, 0x33, 0x0F, 0xE0, 0x64, 0x82, 0x3B,
+    0x38, 0xCF, 0x0E, 0x9D, 0xD9, 0xC2, 0x43, 0xAE, 0x1D, 0x73, 0x41, 0x27, 0xD4, 0xF9, 0x79, 0x59,
+    0x44, 0x21, 0x6E, 0xD1, 0x6A, 0xD6, 0x03, 0x6D, 0x04, 0x74, 0x6E, 0x0F, 0xB4, 0x53, 0x23, 0xF3,
+    0xBE, 0xB2, 0x3F, 0x0A, 0xC7, 0xF9, 0xD8, 0xFD, 0x5F, 0x92, 0x7F, 0x7C, 0xB1, 0xCE, 0x0B, 0xB7,
+    0x0B, 0x26, 0x58, 0x99, 0x70, 0x1C, 0x54, 0x61, 0xB2, 0xBE, 0xC9, 0x6D, 0xAC, 0xB4, 0xA1, 0x6F,
+    0x03, 0x1D, 0x75, 0x03, 0x5B, 0xFD, 0x93, 0x4C, 0x93, 0x3B, 0x13, 0xB0, 0x7E, 0xFF, 0x10, 0xD6,
+    0x5A, 0x0A, 0x4D, 0xB6, 0xAF, 0x07, 0xAC, 0xDF, 0xF6, 0x9E, 0xDA, 0xA4, 0xFD, 0xD0, 0x25, 0xFB,
+    0x9A, 0x3C, 0x16, 0x56, 0x5A, 0x24, 0xAB, 0xD4, 0x8A, 0x60, 0x86, 0xE6, 0xF3, 0x7C, 0x73, 0xE5,
+    0x0D, 0x30, 0x97, 0xB2, 0x5B, 0x4D, 0x9C, 0xA2, 0x23, 0x0F, 0x96, 0x01, 0xC3, 0x7A, 0x32, 0x36,
+    0xA8, 0x4C, 0x97, 0x9A, 0x84, 0x9D, 0xDF, 0x89, 0xB4, 0xC7, 0x86, 0x1E, 0xB0, 0x22, 0x01, 0x37,
+    0x38, 0x4F, 0xC5, 0x0D, 0x6A, 0x62, 0x44, 0x17, 0x64, 0x61, 0x62, 0x9B, 0xD5, 0x4C, 0x9F, 0x9A,
+    0x03, 0x2E, 0xE9, 0xCA, 0x3E, 0xB6, 0xC7, 0x22, 0x6F, 0xE6, 0x57, 0xE8, 0xA4, 0x72, 0xA7, 0xA9,
+    0x14, 0x26, 0x1D, 0x99, 0xDA, 0x40, 0xB1, 0xA8, 0x6C, 0xD1, 0xF9, 0x04, 0x93, 0x7B, 0x5C, 0xEA,
+    0x45, 0x52, 0x27, 0x12, 0xAD, 0x7C, 0x1A, 0x1A, 0xF9, 0xFE, 0xE5, 0x8C, 0x70, 0xC5, 0xD3, 0x4B,
+    0x60, 0x94, 0xC4, 0x38, 0x2C, 0x03, 0xC7, 0x06, 0xE8, 0xD5, 0x80, 0xBD, 0x2D, 0x5E, 0x8B, 0x4C,
+    0x4A, 0xBC, 0xB0, 0xC7, 0x46, 0x37, 0xE8, 0x62, 0x03, 0x55, 0x27, 0x46, 0x2A, 0xE3, 0xE0, 0x7E,
+    0xB8, 0xF7, 0x46, 0x24, 0xB0, 0x17, 0xCF, 0xD5, 0x19, 0xD8, 0xCF, 0xD8, 0xF3, 0x1D, 0x59, 0xC5,
+    0x13, 0x5E, 0x6E, 0x62, 0x1B, 0x9C, 0x24, 0x2D, 0x07, 0x2E, 0xB8, 0xB0, 0x83, 0x0E, 0x99, 0xED,
+    0x09, 0xF6, 0xBD, 0xD8, 0x96, 0x25, 0x25, 0xC2, 0x28, 0x09, 0x9C, 0x1C, 0x18, 0xA5, 0x52, 0x17,
+    0x5A, 0x51, 0x65, 0x61, 0x16, 0x9D, 0x97, 0xBB, 0x4D, 0x8B, 0x7C, 0xB6, 0x71, 0xE1, 0x94, 0x3E,
+    0x1C, 0x19, 0x85, 0xBD, 0x0C, 0x38, 0x09, 0x9C, 0xE8, 0x8C, 0x1D, 0x26, 0x74, 0x38, 0xA3, 0x49,
+    0x3D, 0x64, 0x1B, 0xD8, 0xEA, 0xC4, 0x5A, 0x15, 0x36, 0xEC, 0x70, 0x38, 0xC6, 0x1F, 0x7E, 0xE7,
+    0xDF, 0x46, 0x91, 0x43, 0x27, 0x22, 0x6D, 0xC0, 0xBE, 0x9A, 0x31, 0xE1, 0xDA, 0xA2, 0x6D, 0xF7,
+    0x1E, 0xF3, 0x59, 0xC6, 0x0D, 0x37, 0xB9, 0xE0, 0x95, 0x26, 0xB1, 0xD5, 0x1F, 0x4B, 0x35, 0x22,
+    0xD5, 0xFE, 0x70, 0xC0, 0x1E, 0xA7, 0xC6, 0x2E, 0x80, 0x7D, 0xF2, 0x66, 0x34, 0xCB, 0x44, 0x1C,
+    0xB8, 0xFD, 0xE4, 0xD9, 0xAE, 0x9B, 0xE8, 0x72, 0xE7, 0xE9, 0xBC, 0xBC, 0x3A, 0x81, 0xD3, 0xB5,
+    0xF3, 0xF0, 0xB0, 0xFB, 0x70, 0x02, 0xEA, 0xD8, 0x05, 0xD0, 0xBF, 0x99, 0x2A, 0xD0, 0x3E, 0x3E,
+    0xF6, 0xFA, 0x0A, 0xD0, 0x4B, 0x00, 0x58, 0xA6, 0x4B, 0x7B, 0x39, 0x8B, 0x54, 0xA0, 0x17, 0x99,
+    0x40, 0xCF, 0xE3, 0x8F, 0x32, 0x8C, 0x1F, 0xCD, 0x2E, 0xD3, 0xCE, 0x5D, 0xD9, 0x27, 0xF6, 0x49,
+    0xC2, 0xF2, 0x1B, 0xAE, 0xF0, 0xAD, 0x97, 0xE1, 0x8B, 0xF0, 0x27, 0x70, 0x8A, 0x8B, 0xFC, 0x59,
+    0x82, 0xFB, 0x70, 0x1F, 0xF2, 0x97, 0xEE, 0xC5, 0x5E, 0x7C, 0x77, 0xF4, 0xF1, 0x06, 0x6D, 0xB6,
+    0x83, 0x9E, 0x74, 0xD0, 0xFF, 0xA5, 0xB2, 0xFE, 0x25, 0x17, 0xFA, 0xA3, 0xB0, 0x6E, 0x3E, 0x4C,
+    0xB6, 0x49, 0x0F, 0xDA, 0x77, 0xF3, 0xAA, 0xF9, 0x75, 0xEE, 0x78, 0x92, 0x4D, 0x58, 0x17, 0x9D,
+    0xBA, 0xA2, 0x8A, 0x99, 0xD8, 0xE9, 0x09, 0x07, 0xDC, 0xFD, 0xF3, 0x85, 0x6C, 0xD5, 0xF4, 0x3C,
+    0xCF, 0xFF, 0x98, 0x05, 0xAF, 0x0E, 0x7F, 0x83, 0x6D, 0x32, 0xBD, 0x89, 0xAC, 0xFB, 0x81, 0xED,
+    0x43, 0x78, 0xBA, 0x28, 0x9A, 0x46, 0x06, 0xB4, 0x40, 0x2B, 0x1E, 0xFB, 0x38, 0x62, 0x7F, 0x90,
+    0xE9, 0x4D, 0xC5, 0xE9, 0x99, 0x33, 0x25, 0x03, 0x5F, 0x39, 0x1F, 0xAC, 0x44, 0x1D, 0xEE, 0xAB,
+    0xB4, 0xE2, 0xC1, 0x09, 0x2B, 0x33, 0x9C, 0xE8, 0x60, 0x5E, 0xCD, 0x3A, 0x5C, 0xA8, 0xB4, 0x26,
+    0x5B, 0x76, 0xAD, 0xDF, 0xE9, 0xA5, 0xD7, 0xF4, 0x9E, 0x87, 0xB8, 0xA0, 0x2A, 0x63, 0xD0, 0x95,
+    0x7D, 0x30, 0x15, 0x89, 0xDD, 0xA4, 0x3E, 0x8B, 0x9B, 0xD2, 0x7C, 0x92, 0x1E, 0x16, 0xFD, 0xF3,
+    0x0F, 0xFF, 0x3B, 0xEB, 0x9F, 0xFF, 0xF6, 0xB7, 0xD9, 0xBC, 0xFF, 0xD9, 0x07, 0xC9, 0xBE, 0x2F,
+    0xAF, 0x27, 0xFB, 0x96, 0xD8, 0xD8, 0xBF, 0x56, 0xBB, 0xE0, 0x9A, 0xA9, 0x0F, 0x4E, 0xBD, 0xED,
+    0xFC, 0x08, 0xA3, 0xC7, 0x0E, 0xAC, 0xE9, 0x60, 0x87, 0x83, 0xCA, 0x06, 0xA6, 0x85, 0xE4, 0x2B,
+    0x3A, 0x53, 0xD1, 0x59, 0x4D, 0x98, 0xA4, 0x9F, 0x9E, 0xDF, 0x8B, 0x5A, 0x44, 0x42, 0x2B, 0x22,
+    0xC1, 0x8A, 0x88, 0xB7, 0x81, 0x71, 0xE8, 0x02, 0x7B, 0x9C, 0x67, 0xC6, 0x0D, 0xEA, 0x70, 0x94,
+    0x75, 0x77, 0xD9, 0xEF, 0x87, 0x7E, 0x58, 0x99, 0xD0, 0xC4, 0xC2, 0x8D, 0x9E, 0xE6, 0xA3, 0xC8,
+    0x7A, 0x45, 0xFB, 0x41, 0xA0, 0xDE, 0x61, 0xFC, 0xBA, 0x48, 0x76, 0x52, 0x95, 0x08, 0xCD, 0xF1,
+    0xD4, 0xE0, 0xFC, 0xFC, 0x9F, 0x1A, 0x91, 0x59, 0x27, 0xD6, 0x3A, 0xB2, 0x6D, 0x03, 0x3B, 0x13,
+    0x98, 0xAC, 0xA7, 0xD8, 0xA1, 0xC9, 0x3D, 0x3A, 0x3B, 0x74, 0xDA, 0xD0, 0xC6, 0x33, 0x4C, 0xD8,
+    0x61, 0x43, 0xA5, 0xF3, 0x30, 0xFC, 0xCB, 0x40, 0xF3, 0xEF, 0x92, 0xD0, 0xF2, 0x93, 0x82, 0x3E,
+    0x70, 0x8A, 0x2E, 0x9C, 0xD2, 0x26, 0x4E, 0x31, 0x91, 0x0B, 0x6C, 0xA0, 0x2C, 0x4D, 0xAA, 0x4F,
+    0x3A, 0xE1, 0xE6, 0xDB, 0x81, 0x51, 0x64, 0x60, 0x96, 0x03, 0xAA, 0xEC, 0x33, 0x3A, 0x5F, 0x59,
+    0xCA, 0xF2, 0x28, 0x86, 0xC2, 0x0B, 0x3A, 0xE8, 0x73, 0x7A, 0x35, 0x35, 0x32, 0xE9, 0xC3, 0x17,
+    0x9A, 0x09, 0x26, 0xD8, 0xC2, 0x06, 0xEC, 0x80, 0x8E, 0xA8, 0x69, 0x81, 0x53, 0xB2, 0x12, 0xC1,
+    0x88, 0x07, 0x46, 0x91, 0x4F, 0x3E, 0x7E, 0x7A, 0xE0, 0xC6, 0x42, 0x9F, 0xAB, 0xE5, 0x84, 0xA0,
+    0x82, 0xF5, 0xA8, 0x02, 0xFD, 0xD2, 0x0F, 0xEE, 0x2C, 0xED, 0xE0, 0x00, 0xAC, 0x8F, 0xDA, 0x7D,
+    0x68, 0x32, 0x3B, 0xDA, 0xD8, 0x46, 0xAC, 0x77, 0xE0, 0x54, 0x81, 0x87, 0x36, 0xA0, 0xA6, 0x87,
+    0xA0, 0x7F, 0x9B, 0x8F, 0x12, 0xB0, 0xAF, 0xC0, 0x18, 0x41, 0x09, 0xD0, 0x96, 0xA3, 0xD6, 0xD6,
+    0x15, 0xD8, 0xC7, 0xA5, 0x0E, 0x5B, 0x89, 0xD0, 0x97, 0xE7, 0x61, 0x98, 0x01, 0xBE, 0x22, 0xF3,
+    0xA0, 0x44, 0x24, 0xE9, 0x27, 0xE3, 0xAD, 0x62, 0x07, 0xC7, 0xCD, 0x97, 0xB9, 0xC3, 0x6A, 0xC5,
+    0x8E, 0xD3, 0x9B, 0x54, 0x2E, 0x4E, 0xD5, 0xA4, 0xF2, 0x59, 0x53, 0x4C, 0x1E, 0x3F, 0x99, 0x25,
+    0x3A, 0x11, 0xF1, 0xDD, 0xEF, 0xA9, 0xC6, 0xE7, 0xD2, 0xF1, 0xF7, 0xD0, 0xFA, 0x0A, 0xEA, 0x2E,
+    0x99, 0x1D, 0xD6, 0xF7, 0xB0, 0x35, 0x01, 0xFD, 0xD3, 0x0C, 0xFD, 0xEE, 0xA8, 0x96, 0x6D, 0x04,
+    0x3D, 0x03, 0x73, 0x06, 0xD7, 0x05, 0xBA, 0x70, 0xA0, 0xCD, 0x6D, 0x56, 0x15, 0x37, 0xA8, 0xB7,
+    0xF9, 0x6A, 0x93, 0xD9, 0xEA, 0xC4, 0x85, 0x8E, 0x94, 0x36, 0x90, 0x4D, 0x50, 0xD9, 0xF8, 0x26,
+    0xD9, 0xA1, 0x89, 0x16, 0x1D, 0x3A, 0x74, 0xB8, 0x4E, 0xEB, 0x37, 0x7F, 0x7B, 0xEF, 0x57, 0x4E,
+    0x24, 0x8F, 0x22, 0x69, 0xC1, 0xD7, 0x84, 0xE3, 0xF9, 0x0C, 0xC0, 0x5F, 0xAA, 0x77, 0x83, 0x31,
+    0xDC, 0xBC, 0xA9, 0x62, 0x34, 0x2D, 0xAB, 0x93, 0x36, 0x39, 0x19, 0xC6, 0xBF, 0x83, 0x4C, 0xEB,
+    0xB9, 0x8E, 0x2A, 0x70, 0xA3, 0xC9, 0x6D, 0x58, 0xEB, 0x6C, 0xC2, 0x4A, 0x27, 0xEB, 0xB7, 0x6D,
+    0xB0, 0xC3, 0x85, 0x09, 0x1D, 0xC5, 0xFA, 0x9E, 0x6C, 0x87, 0x35, 0xB9, 0x63, 0xA5, 0x52, 0xCF,
+    0xB6, 0x89, 0x1B, 0x4E, 0x75, 0xD8, 0xDC, 0x7A, 0xF2, 0xED, 0xB0, 0x17, 0x11, 0x2F, 0x22, 0x32,
+    0xFC, 0x11, 0xAB, 0xFC, 0xC7, 0x5E, 0x44, 0x26, 0x11, 0x91, 0x7C, 0x39, 0x77, 0x98, 0xF8, 0x02,
+    0xB6, 0xE0, 0x26, 0x8C, 0x0C, 0xBC, 0x99, 0x97, 0x9C, 0x49, 0xB0, 0x79, 0x83, 0x56, 0x0E, 0xEC,
+    0xB8, 0xB0, 0x5E, 0x87, 0xC2, 0xCA, 0x62, 0xFF, 0xFE, 0x77, 0xDF, 0xCD, 0xBD, 0x1C, 0x9E, 0x1D,
+    0xED, 0xBD, 0x0D, 0x5F, 0x6C, 0x32, 0x5C, 0xD7, 0x19, 0x56, 0x3A, 0xC1, 0x4A, 0x47, 0x38, 0x6D,
+    0x7F, 0x06, 0xC5, 0xC8, 0x81, 0x6C, 0xBD, 0x51, 0xD9, 0x0E, 0xFA, 0x1F, 0x52, 0x47, 0xFB, 0x56,
+    0xEC, 0xE9, 0xBE, 0x11, 0xDC, 0x9B, 0x62, 0x82, 0x93, 0x6A, 0xBD, 0x93, 0xBB, 0x97, 0x38, 0xDE,
+    0x84, 0xD6, 0xC3, 0x03, 0xB0, 0xA0, 0x32, 0xF4, 0xB7, 0xD0, 0x22, 0xAC, 0x58, 0xB5, 0x41, 0xC5,
+    0x0B, 0xD6, 0x76, 0x30, 0xEF, 0x3E, 0xF9, 0xEE, 0xD4, 0xCB, 0xAC, 0x2F, 0x0F, 0x02, 0xAF, 0x0C,
+    0x5C, 0x95, 0x89, 0xF5, 0xB0, 0x63, 0xA0, 0x2E, 0xFF, 0xB5, 0x01, 0x11, 0xDA, 0x8F, 0xEB, 0xA2,
+    0x7C, 0x46, 0x8D, 0x29, 0xDD, 0x27, 0x32, 0x8C, 0x52, 0xE8, 0x2F, 0xD9, 0xE7, 0x5B, 0x7C, 0x99,
+    0x36, 0xF4, 0x95, 0x1B, 0x3A, 0x6D, 0x29, 0x2B, 0xBE, 0xA7, 0xDF, 0x8B, 0x2A, 0x9D, 0x9C, 0xD0,
+    0xFA, 0x07, 0xF7, 0x79, 0x59, 0xBF, 0x1F, 0xB8, 0x6F, 0x67, 0x74, 0xB8, 0x53, 0xB8, 0xD1, 0xBC,
+    0x9F, 0x54, 0xB6, 0x36, 0xF6, 0xFE, 0x66, 0x2F, 0x55, 0x45, 0x27, 0xC1, 0xD0, 0xFF, 0xEA, 0xC5,
+    0x23, 0xDF, 0xC0, 0x75, 0x95, 0x79, 0x85, 0x0B, 0xBE, 0xC4, 0x1A, 0x3D, 0x58, 0x48, 0x6D, 0xA0,
+    0x97, 0x44, 0x2B, 0x05, 0x93, 0xB6, 0x98, 0x78, 0x83, 0x36, 0xDA, 0x41, 0x27, 0x1D, 0x74, 0x56,
+    0xB9, 0xC9, 0x5C, 0xC0, 0x15, 0xBE, 0xC0, 0x75, 0xD6, 0xAC, 0x59, 0x3D, 0x5B, 0xEE, 0xAA, 0x0C,
+    0x9C, 0x9A, 0xA4, 0x82, 0xCA, 0x7A, 0x20, 0xDB, 0xF9, 0x3C, 0x77, 0x22, 0xD9, 0x89, 0xA4, 0xCB,
+    0xD3, 0xB2, 0x47, 0xC0, 0xFE, 0x6E, 0xC3, 0x28, 0x82, 0x93, 0x19, 0x23, 0x05, 0xAE, 0xC1, 0xFF,
+    0x00, 0xCD, 0x9C, 0x4F, 0x8C, 0x1F, 0xC7, 0x75, 0xE7, 0x3F, 0xD5, 0x45, 0xB2, 0x23, 0x96, 0xC4,
+    0xD2, 0x41, 0x42, 0x1C, 0x93, 0x62, 0xFB, 0xE0, 0x05, 0x84, 0x98, 0x54, 0x13, 0x0B, 0x1D, 0xB8,
+    0x8B, 0x99, 0xE9, 0x92, 0x8C, 0xDD, 0x00, 0x1B, 0x60, 0x4D, 0x2C, 0x34, 0xF2, 0xC1, 0x07, 0xE5,
+    0x90, 0x43, 0x6C, 0x23, 0x91, 0x0E, 0x5C, 0x80, 0x08, 0x86, 0xD3, 0x25, 0x19, 0x9B, 0x1C, 0x72,
+    0x08, 0x83, 0x8D, 0x92, 0xC3, 0x62, 0x61, 0x02, 0xAB, 0x00, 0x0E, 0x95, 0x05, 0x89, 0x05, 0x0F,
+    0x44, 0x76, 0xC8, 0x2E, 0x39, 0x01, 0x7C, 0xF0, 0x21, 0x6D, 0xCB, 0x46, 0x0E, 0xDE, 0xC0, 0x1D,
+    0x45, 0xDE, 0xC0, 0xCC, 0x62, 0x5D, 0x9B, 0x6D, 0xC1, 0x4D, 0xB2, 0x7F, 0xBF, 0xB7, 0x87, 0xEA,
+    0xFE, 0xCD, 0x6F, 0xF8, 0xC7, 0x4E, 0xEC, 0xAC, 0xA5, 0x06, 0x66, 0xE6, 0x37, 0xBF, 0x5F, 0xFF,
+    0xBA, 0x5F, 0xBD, 0x7A, 0xF5, 0xEA, 0xFB, 0xBE, 0xEF, 0xBD, 0x46, 0x82, 0x1D, 0x10, 0x6C, 0x64,
+    0x01, 0x00, 0x36, 0xA8, 0x91, 0xD2, 0x67, 0x3D, 0x15, 0x3A, 0xB2, 0x4B, 0xDE, 0xB2, 0x87, 0x0D,
+    0x0C, 0x58, 0xA7, 0x22, 0x25, 0xBA, 0x63, 0x13, 0x1D, 0xF8, 0x18, 0xC0, 0x11, 0xD0, 0x01, 0x3A,
+    0x38, 0x0F, 0xA7, 0x50, 0x4D, 0x97, 0xC9, 0xA0, 0xEF, 0x85, 0xAC, 0x8F, 0x0C, 0x67, 0xD9, 0x39,
+    0xC5, 0x96, 0xC5, 0x7E, 0xDA, 0xE7, 0xDF, 0x68, 0xD5, 0x10, 0xA9, 0x6F, 0x60, 0x25, 0x2A, 0x11,
+    0x8C, 0x78, 0x3A, 0xB8, 0x06, 0x4F, 0x71, 0xE0, 0x78, 0xF5, 0x7D, 0x28, 0x64, 0x40, 0x2F, 0x5F,
+    0xE8, 0x29, 0x02, 0x9E, 0x3D, 0x20, 0x6B, 0x01, 0xE3, 0x80, 0xD3, 0x00, 0x37, 0x00, 0xD5, 0x01,
+    0xB9, 0x07, 0x0A, 0xC0, 0x8A, 0x04, 0x6A, 0x59, 0xC2, 0xE7, 0xBE, 0x7D, 0x0E, 0x2A, 0x20, 0x1B,
+    0x80, 0x2A, 0x40, 0x31, 0x80, 0x92, 0x2B, 0xBF, 0x8F, 0x11, 0x11, 0x57, 0x89, 0x08, 0x00, 0x2A,
+    0x64, 0xA1, 0x94, 0xC6, 0xD5, 0x32, 0x30, 0x18, 0x6F, 0x42, 0xC1, 0x26, 0x7B, 0x2A, 0xEA, 0x2E,
+    0xEF, 0x6A, 0x4A, 0x19, 0xB5, 0xC8, 0x50, 0x7C, 0xF9, 0xEF, 0xBA, 0x4F, 0xF2, 0x44, 0x92, 0x6D,
+    0x80, 0x5E, 0xF5, 0x14, 0x5E, 0x47, 0x35, 0x90, 0x77, 0xA5, 0xC7, 0xBE, 0x3B, 0x40, 0x21, 0x1E,
+    0xAA, 0x01, 0x68, 0x3C, 0x64, 0x23, 0x18, 0x11, 0x4F, 0x25, 0x4B, 0x50, 0x23, 0x60, 0x3B, 0x92,
+    0x4C, 0x4A, 0x22, 0x5A, 0x24, 0x50, 0x36, 0x0E, 0x18, 0x81, 0x3C, 0x02, 0x95, 0x5F, 0x53, 0xC1,
+    0x06, 0xDA, 0x73, 0x1E, 0x0B, 0x1D, 0xCF, 0x90, 0x05, 0x9E, 0x5C, 0x7D, 0xE4, 0x78, 0x06, 0x1D,
+    0x38, 0x4B, 0xEE, 0xB8, 0x86, 0x45, 0xB5, 0x9C, 0x42, 0x07, 0xA6, 0x5B, 0x97, 0x6F, 0x07, 0x54,
+    0x9B, 0x79, 0x8E, 0x01, 0x3C, 0x0F, 0xA8, 0x1E, 0xA8, 0xE5, 0x12, 0xB9, 0x48, 0xC7, 0x96, 0x3B,
+    0xDE, 0x66, 0x1D, 0xD6, 0x59, 0xD8, 0x64, 0x0B, 0x15, 0x69, 0x3E, 0x78, 0xD5, 0xD3, 0xC8, 0x08,
+    0xB9, 0x04, 0xD0, 0x03, 0x60, 0x23, 0xBF, 0xB0, 0x2D, 0x4E, 0x89, 0x0C, 0x14, 0x22, 0x9E, 0x52,
+    0x2E, 0xED, 0x8B, 0x67, 0xC3, 0x56, 0xE9, 0x6F, 0x55, 0x7E, 0x51, 0xBF, 0xB8, 0xE0, 0xE3, 0x1C,
+    0x7D, 0xD1, 0xBD, 0x9D, 0xE5, 0xE1, 0xF0, 0xBF, 0xE0, 0xA9, 0x6B, 0xBC, 0xD1, 0x66, 0x8F, 0xF5,
+    0x67, 0x3E, 0x66, 0x38, 0x7E, 0x09, 0x60, 0xD7, 0x9F, 0x8F, 0x67, 0x4E, 0x7C, 0xEC, 0xE8, 0x63,
+    0xFA, 0x4B, 0x9F, 0x6E, 0xA5, 0xB7, 0xFF, 0x83, 0xEA, 0x8F, 0xCF, 0x59, 0x91, 0x77, 0xB6, 0xBF,
+    0xD8, 0x41, 0x0F, 0x3B, 0x50, 0x82, 0x0D, 0xC0, 0xC7, 0xAF, 0x5C, 0xB1, 0x22, 0x5F, 0x13, 0x89,
+    0x7C, 0x1C, 0xF3, 0xA2, 0xFB, 0xD3, 0xEC, 0xC8, 0x1B, 0x87, 0xFF, 0xF9, 0x93, 0x4F, 0x7D, 0xD9,
+    0x7F, 0xF5, 0x3F, 0xE6, 0xE6, 0xC4, 0x99, 0x13, 0x86, 0xE3, 0x97, 0x50, 0xDB, 0x5F, 0x92, 0x71,
+    0x12, 0xC4, 0x0C, 0x14, 0x12, 0x0A, 0xDF, 0x5B, 0x57, 0x98, 0x90, 0xFF, 0x59, 0x97, 0x75, 0x83,
+    0xEA, 0xAB, 0x17, 0x47, 0x23, 0x23, 0x32, 0x70, 0xE4, 0x2D, 0xE0, 0x30, 0x60, 0x81, 0xE7, 0x80,
+    0x0D, 0xD8, 0xBE, 0xF9, 0x52, 0x26, 0x32, 0x42, 0x04, 0x22, 0x64, 0x1D, 0x93, 0xFE, 0xD2, 0xB1,
+    0xFD, 0x05, 0x0A, 0x11, 0x9E, 0x76, 0xA0, 0x16, 0xBC, 0x10, 0x78, 0x8D, 0xB3, 0x6C, 0xB0, 0xC3,
+    0x40, 0xD3, 0xFD, 0xE2, 0x5B, 0xE8, 0x81, 0xC3, 0x1C, 0xE6, 0x84, 0x8E, 0x9C, 0xE5, 0x59, 0xCE,
+    0xD7, 0xF1, 0x37, 0x1C, 0xDD, 0x86, 0x79, 0xA1, 0xDB, 0x00, 0x8B, 0xEE, 0x54, 0x64, 0x93, 0x12,
+    0x13, 0x74, 0xC7, 0xC8, 0x26, 0xD6, 0x9B, 0xA0, 0x7A, 0x46, 0x4A, 0x8A, 0xA0, 0xA3, 0x1E, 0xB8,
+    0x45, 0x15, 0xCA, 0xCE, 0x88, 0x2C, 0x10, 0x91, 0xF0, 0x8C, 0xC8, 0x98, 0x7D, 0x4D, 0xBE, 0xEB,
+    0xCF, 0x1E, 0x76, 0xE4, 0x0E, 0xF8, 0x95, 0xB5, 0xD5, 0xF0, 0x42, 0x8B, 0x84, 0x6B, 0x34, 0x71,
+    0x83, 0xAA, 0x3F, 0x46, 0x39, 0xE6, 0xCE, 0x48, 0x16, 0x32, 0x71, 0x91, 0x2A, 0x9C, 0x25, 0x8F,
+    0xCF, 0x90, 0xF5, 0x06, 0x46, 0x1D, 0x68, 0xE8, 0xA8, 0xDC, 0x79, 0xCA, 0x70, 0x1A, 0x1B, 0x2D,
+    0x79, 0xAF, 0x83, 0x1E, 0x55, 0xA7, 0x96, 0x5C, 0x47, 0xDC, 0x06, 0x75, 0xB0, 0x00, 0x17, 0xED,
+    0x37, 0xC6, 0x2A, 0x64, 0x7C, 0x42, 0xBD, 0xCF, 0x27, 0xB9, 0xF4, 0x8A, 0xE9, 0x80, 0x4D, 0xC2,
+    0x89, 0xCC, 0x3F, 0x9F, 0x73, 0xAD, 0xB9, 0xFD, 0x15, 0x35, 0x66, 0xDF, 0x0C, 0xE1, 0xCC, 0xE5,
+    0xC7, 0x9F, 0xCF, 0x8F, 0xE5, 0x2F, 0x8A, 0x2F, 0x5D, 0x92, 0xE7, 0x22, 0xA0, 0xFE, 0x17, 0xC0,
+    0x29, 0x78, 0x8C, 0xB3, 0x70, 0x96, 0xF3, 0x10, 0xB9, 0x46, 0x16, 0x88, 0x18, 0xA7, 0x3A, 0x9E,
+    0x21, 0x6B, 0xB9, 0xC0, 0xCF, 0x7F, 0x8B, 0x48, 0xBD, 0xD4, 0x81, 0x66, 0x61, 0x39, 0x0F, 0xA7,
+    0x55, 0x84, 0xEB, 0x79, 0x44, 0x75, 0x27, 0x2F, 0x93, 0x87, 0x0B, 0x1D, 0x85, 0xFA, 0xEB, 0x96,
+    0x8D, 0xFC, 0xAB, 0xDF, 0xA2, 0x37, 0x32, 0xE8, 0xEE, 0xC8, 0xDB, 0xAD, 0xF1, 0x18, 0x5F, 0x82,
+    0x75, 0x4F, 0x81, 0x75, 0xFC, 0x06, 0x40, 0x11, 0xA6, 0x7B, 0x1E, 0x42, 0x7B, 0xB2, 0xC0, 0x79,
+    0xB8, 0x86, 0x81, 0x53, 0x10, 0xC9, 0x1D, 0xC7, 0x50, 0x1D, 0x59, 0xCB, 0x59, 0xD4, 0x45, 0x67,
+    0x0F, 0x53, 0x2F, 0xF5, 0x77, 0x97, 0x46, 0xDA, 0xBF, 0xBF, 0x74, 0x1D, 0x4E, 0xA3, 0x1D, 0xC6,
+    0x73, 0x1E, 0xD5, 0x61, 0x61, 0x07, 0xDD, 0x62, 0x51, 0x03, 0x3A, 0x70, 0x0B, 0x7A, 0x1A, 0xC7,
+    0x16, 0xE5, 0xF7, 0x9C, 0xF1, 0x5A, 0x86, 0x2C, 0x52, 0x8B, 0x5B, 0xF7, 0x4B, 0x55, 0x0F, 0x3C,
+    0x95, 0x03, 0x10, 0x78, 0x02, 0x5E, 0xE3, 0x18, 0x4F, 0x5F, 0xC3, 0x52, 0x74, 0x18, 0x28, 0x30,
+    0x90, 0x85, 0xDC, 0x41, 0xCC, 0x3D, 0x5C, 0xD7, 0x1E, 0x19, 0x75, 0xA0, 0x19, 0x74, 0x78, 0x46,
+    0x9D, 0xD3, 0x6D, 0x01, 0x59, 0x5B, 0x04, 0xB2, 0xEE, 0xE4, 0x65, 0x54, 0x3C, 0x79, 0x16, 0x15,
+    0x4F, 0x3E, 0x03, 0xB1, 0x30, 0xE7, 0xE8, 0x8D, 0x0C, 0x0C, 0xEA, 0x4A, 0xCF, 0x0D, 0xB8, 0xC1,
+    0x1E, 0x6C, 0x92, 0x06, 0x8F, 0x9A, 0x5C, 0x48, 0x36, 0x40, 0x16, 0xD7, 0x44, 0x3A, 0x97, 0xBC,
+    0x8A, 0x6D, 0x93, 0x72, 0xCA, 0x00, 0x95, 0x47, 0x89, 0xC3, 0x2C, 0xA0, 0x6C, 0xE1, 0x16, 0xA8,
+    0x01, 0x74, 0x07, 0x26, 0x40, 0xE1, 0xA1, 0x9C, 0xDC, 0x50, 0x05, 0x94, 0x2E, 0x73, 0x45, 0x57,
+    0x04, 0x23, 0x82, 0x92, 0xFE, 0x80, 0x13, 0xCE, 0x86, 0xC7, 0x81, 0x7F, 0xFF, 0x4E, 0x00, 0x6B,
+    0x6E, 0x00, 0xED, 0x16, 0x0F, 0x39, 0x0A, 0x0F, 0xE8, 0x11, 0xA0, 0x09, 0x40, 0x31, 0x02, 0xFA,
+    0xEF, 0x02, 0xB0, 0xB7, 0x07, 0x14, 0xBF, 0xD4, 0x82, 0xEE, 0x2E, 0x02, 0x7B, 0x79, 0x07, 0x85,
+    0xDB, 0x02, 0x1D, 0x75, 0x84, 0x3D, 0x2A, 0x28, 0xBC, 0x8E, 0xE8, 0x48, 0x05, 0x8D, 0x48, 0x4F,
+    0x21, 0x22, 0x4E, 0x8B, 0x48, 0x4F, 0xB3, 0xBD, 0x5D, 0xFB, 0x22, 0xA0, 0x07, 0x3D, 0x40, 0x15,
+    0x9A, 0xF9, 0x46, 0xDC, 0x00, 0xF4, 0xBF, 0x02, 0x8E, 0x3E, 0x06, 0xE4, 0x7B, 0xA4, 0x45, 0xCC,
+    0x23, 0x05, 0xAC, 0xC2, 0x24, 0x9F, 0x92, 0x30, 0x89, 0x67, 0xBE, 0x1E, 0x26, 0xE9, 0xB6, 0xF2,
+    0x36, 0x09, 0xA7, 0x7A, 0xDD, 0x25, 0xD9, 0x4C, 0xD0, 0x31, 0x89, 0x56, 0xA1, 0x23, 0x8D, 0x48,
+    0xAF, 0x44, 0xA4, 0xD7, 0x22, 0xD2, 0x9B, 0x0F, 0xB6, 0x3F, 0x3B, 0x14, 0x01, 0x3D, 0x54, 0x1E,
+    0x3D, 0xEE, 0x8B, 0x35, 0xDF, 0x51, 0x44, 0x42, 0xDA, 0x8F, 0xA4, 0x4D, 0x7F, 0x6F, 0x5F, 0x02,
+    0x8C, 0x24, 0x27, 0x63, 0xBE, 0x9B, 0x26, 0x31, 0xFF, 0xCB, 0x01, 0x00, 0xFD, 0xD7, 0x69, 0xE3,
+    0xD5, 0xB1, 0x4E, 0x9A, 0x8F, 0xA5, 0x2C, 0x81, 0xAC, 0x37, 0x22, 0x0E, 0xD4, 0x90, 0xA5, 0x0B,
+    0x8E, 0xD3, 0x0E, 0x3D, 0x52, 0x01, 0xB0, 0x98, 0xD6, 0x44, 0x83, 0x89, 0x00, 0xB5, 0x24, 0xBF,
+    0x58, 0x8B, 0xC8, 0xF6, 0x36, 0x54, 0x22, 0x22, 0x12, 0xA8, 0x02, 0x95, 0x48, 0xA4, 0x0C, 0x58,
+    0x91, 0x91, 0xA2, 0xC5, 0xCC, 0x3B, 0x60, 0x3A, 0xD4, 0xF6, 0x39, 0xA0, 0x90, 0x25, 0xD0, 0x88,
+    0x78, 0xB4, 0x88, 0x78, 0xAC, 0x3F, 0x22, 0x8E, 0x8B, 0x20, 0x64, 0x11, 0x35, 0x62, 0x03, 0xBA,
+    0x67, 0x0B, 0x6C, 0xAB, 0x7A, 0xA8, 0xDE, 0xB8, 0x7A, 0xFB, 0x12, 0xCB, 0x52, 0xC4, 0xEB, 0x3E,
+    0x5D, 0xD9, 0xB4, 0xD0, 0x50, 0x41, 0x3E, 0x32, 0x42, 0xD3, 0xE6, 0xDF, 0xDB, 0x6E, 0x84, 0x52,
+    0x44, 0x22, 0x32, 0x4F, 0x6E, 0xA4, 0x10, 0x59, 0x80, 0xC8, 0xF7, 0xD7, 0x35, 0x77, 0x4B, 0x03,
+    0xD9, 0x5F, 0xFE, 0x32, 0xA0, 0xDF, 0x18, 0x81, 0xCC, 0x9D, 0xBB, 0x6F, 0x3A, 0x8F, 0x48, 0x07,
+    0x34, 0xB2, 0x84, 0x5C, 0x5E, 0x16, 0x4F, 0xD1, 0x53, 0x05, 0x6A, 0x4F, 0xD1, 0x22, 0x60, 0xBB,
+    0x6C, 0x04, 0xDB, 0xE9, 0x1E, 0x4C, 0x97, 0x47, 0x30, 0xAD, 0x6D, 0xC1, 0x06, 0x1B, 0xC0, 0x86,
+    0xC2, 0x43, 0xE1, 0x4B, 0x0F, 0x95, 0x2B, 0x3D, 0x34, 0x94, 0x2D, 0x7A, 0x41, 0xB9, 0xD8, 0x6E,
+    0x46, 0x0A, 0x11, 0xE9, 0xB1, 0x22, 0xD2, 0x61, 0x44, 0xC4, 0x93, 0x89, 0x2C, 0x60, 0x7D, 0xF7,
+    0x53, 0xDD, 0x49, 0xB6, 0x9E, 0x43, 0x2F, 0x60, 0x09, 0xD2, 0xAA, 0xC5, 0x98, 0x0D, 0xC5, 0xDA,
+    0xFE, 0x71, 0x68, 0x7F, 0x0D, 0xED, 0x2F, 0x29, 0xD3, 0xAE, 0x5E, 0xCE, 0x8E, 0x14, 0xB8, 0xB5,
+    0xB6, 0xDC, 0xF6, 0x4F, 0xDD, 0x37, 0xE5, 0xD2, 0x3F, 0xEC, 0xD4, 0xD9, 0xDA, 0x8E, 0xCB, 0x2F,
+    0x4D, 0xEE, 0x20, 0x9B, 0x4C, 0x0E, 0x28, 0x16, 0x9F, 0x9B, 0x67, 0xB6, 0x6E, 0xB3, 0xE9, 0xA5,
+    0x5A, 0x62, 0x24, 0xDD, 0x56, 0x8F, 0x94, 0x92, 0x2E, 0x6B, 0x22, 0xCD, 0x74, 0x07, 0xDB, 0x66,
+    0xE3, 0xF4, 0xB2, 0x08, 0x26, 0x4E, 0x22, 0x56, 0xAE, 0x0C, 0xD5, 0xE4, 0xFE, 0xD2, 0xAC, 0x02,
+    0xEC, 0x66, 0x23, 0xBB, 0x93, 0x50, 0x66, 0x85, 0x1A, 0x6F, 0x55, 0x61, 0x16, 0xAC, 0x11, 0xEC,
+    0x34, 0xF2, 0x66, 0xF1, 0xB2, 0x4C, 0x32, 0xD6, 0xD3, 0x72, 0x20, 0x19, 0xE6, 0x34, 0x32, 0x11,
+    0x59, 0xEE, 0x8F, 0x61, 0xFA, 0x96, 0xE9, 0x9B, 0xE5, 0xA4, 0xA4, 0x72, 0x5F, 0x6F, 0xCD, 0x4A,
+    0x6F, 0xD9, 0x62, 0x5F, 0x59, 0xFB, 0x7A, 0x2B, 0xF7, 0xF5, 0xD6, 0xAC, 0xF4, 0x96, 0x2D, 0x1F,
+    0x76, 0xEA, 0x73, 0xEE, 0x11, 0xDE, 0x62, 0x03, 0x30, 0x33, 0xB2, 0xDC, 0x20, 0x39, 0xE0, 0x1F,
+    0x7D, 0x54, 0x60, 0xDE, 0xED, 0x51, 0x43, 0xE9, 0xA9, 0xD5, 0x88, 0x0D, 0x45, 0xD0, 0x3D, 0x0B,
+    0x96, 0xD8, 0x58, 0x06, 0x9A, 0x3C, 0x92, 0x7F, 0xB0, 0x80, 0x4A, 0x3C, 0x5A, 0x22, 0x54, 0x23,
+    0x64, 0xE2, 0xA0, 0xE8, 0xA6, 0xD9, 0xAC, 0xC2, 0x24, 0x9E, 0x38, 0x28, 0x23, 0x68, 0x01, 0xEA,
+    0x8E, 0x09, 0xDA, 0x6E, 0x01, 0x9B, 0x40, 0x7D, 0x19, 0x9A, 0x25, 0x2C, 0xEA, 0x40, 0x9F, 0x47,
+    0x15, 0x55, 0x9F, 0x45, 0xAE, 0xEB, 0x8E, 0xEB, 0xBA, 0xCD, 0x62, 0x1E, 0x4C, 0x6B, 0x42, 0xED,
+    0xED, 0x77, 0x16, 0x58, 0xE9, 0x28, 0xEE, 0x24, 0x7F, 0xBF, 0x05, 0xEC, 0x00, 0x7B, 0xC9, 0x18,
+    0x5C, 0x02, 0x7A, 0x59, 0x6F, 0x61, 0x8F, 0xE7, 0xB1, 0x68, 0xA7, 0x3A, 0x75, 0x9D, 0x4D, 0x75,
+    0x07, 0x1D, 0x2E, 0xC0, 0x8E, 0x01, 0xE3, 0x3B, 0xE8, 0x2D, 0x14, 0xEC, 0x91, 0xC5, 0x3C, 0x52,
+    0x61, 0x43, 0xDE, 0xB1, 0xC1, 0x4D, 0x74, 0xB0, 0x7F, 0xCE, 0xC8, 0x28, 0xE2, 0xCA, 0xDF, 0x95,
+    0x56, 0xF7, 0x4D, 0x07, 0x0C, 0xC7, 0xD0, 0x7F, 0xF5, 0x04, 0xB9, 0x39, 0x85, 0xD5, 0x3D, 0x87,
+    0x38, 0x37, 0xCD, 0xEC, 0x29, 0x0A, 0x19, 0xD9, 0xCD, 0x46, 0x7A, 0x06, 0xDD, 0x32, 0xE4, 0x81,
+    0xDE, 0xA2, 0xA2, 0x45, 0xC7, 0x93, 0x98, 0x58, 0x52, 0x75, 0xA5, 0x48, 0x57, 0x88, 0xB4, 0x56,
+    0x7E, 0x18, 0x32, 0xF9, 0xED, 0x90, 0xF6, 0xAC, 0x67, 0xCF, 0xC0, 0x99, 0x33, 0x70, 0xA6, 0x4B,
+    0x6A, 0x3A, 0xBC, 0xB6, 0x45, 0xFD, 0xA4, 0xD7, 0x85, 0xE3, 0x3D, 0x94, 0xEF, 0x7D, 0xF7, 0x5E,
+    0x47, 0x21, 0x12, 0xB5, 0xCB, 0xBB, 0xB2, 0x67, 0x83, 0x9E, 0x25, 0x79, 0xD8, 0xC4, 0xDE, 0x96,
+    0x31, 0x0F, 0x88, 0x48, 0x88, 0x14, 0x6F, 0x3A, 0x2C, 0x3A, 0x82, 0xEA, 0x68, 0x80, 0x92, 0x6A,
+    0x48, 0xF6, 0x7A, 0xE7, 0xE5, 0x50, 0x88, 0x88, 0x8C, 0x88, 0xD4, 0x22, 0x3E, 0x93, 0xDF, 0xFE,
+    0x5A, 0xF2, 0x14, 0x85, 0x5B, 0xD9, 0x69, 0xDA, 0x9A, 0x4E, 0x02, 0x5A, 0x24, 0x92, 0x42, 0x94,
+    0x23, 0x6F, 0xDF, 0xF6, 0xC0, 0x75, 0x30, 0x83, 0x85, 0x5C, 0xFE, 0x4F, 0x47, 0x36, 0x98, 0x3D,
+    0xD8, 0xA5, 0x0A, 0x58, 0x9F, 0xF5, 0xA8, 0x9E, 0x12, 0x4A, 0x74, 0x4B, 0x16, 0xB9, 0x01, 0xE5,
+    0xB7, 0x1B, 0x40, 0xA4, 0x05, 0x23, 0x3D, 0x70, 0x7C, 0xDF, 0xA4, 0x8B, 0x70, 0x19, 0x7B, 0xF6,
+    0x79, 0xF2, 0x7C, 0x8F, 0x2C, 0xDC, 0x7C, 0x88, 0xA1, 0x5E, 0xED, 0x50, 0x22, 0x64, 0x8B, 0xCF,
+    0x46, 0xD5, 0xB3, 0xC3, 0x80, 0x75, 0x3B, 0xE8, 0x76, 0x0B, 0x15, 0xAD, 0x63, 0xCC, 0x03, 0x17,
+    0xD5, 0x40, 0x4D, 0x75, 0x4F, 0x9C, 0x15, 0x71, 0x88, 0x38, 0xCC, 0x9D, 0xD9, 0xEF, 0xF5, 0xA0,
+    0x63, 0x0A, 0x56, 0xEC, 0x3A, 0x0C, 0xE1, 0xD0, 0x71, 0x91, 0xB1, 0x96, 0xE5, 0x57, 0x56, 0xEF,
+    0x5C, 0x04, 0x16, 0x09, 0xB5, 0xAC, 0xF6, 0x46, 0x05, 0x73, 0xEC, 0xC6, 0x05, 0x48, 0xD8, 0x7B,
+    0x5A, 0x69, 0x13, 0xFE, 0x36, 0x9E, 0x09, 0xAA, 0xCF, 0x27, 0x6E, 0x00, 0xD0, 0x03, 0xA8, 0x08,
+    0x64, 0x4D, 0x0B, 0x14, 0x12, 0x81, 0xE6, 0x95, 0x11, 0x54, 0xFF, 0xDC, 0x06, 0xE8, 0x6E, 0x67,
+    0x13, 0xF2, 0xD0, 0x6F, 0x80, 0x7D, 0x3D, 0xEE, 0x80, 0xFD, 0x74, 0x3B, 0x42, 0x61, 0xDE, 0xE9,
+    0xA1, 0xF8, 0x4C, 0x1E, 0xC1, 0x8A, 0xB4, 0x60, 0x45, 0x1C, 0x68, 0x59, 0x00, 0x99, 0x5C, 0x02,
+    0x74, 0x0B, 0xC9, 0xD4, 0xA6, 0x59, 0x9B, 0xFC, 0xDC, 0xC5, 0x39, 0xDE, 0x9B, 0x51, 0x97, 0xEE,
+    0xF6, 0x4F, 0xB4, 0x9E, 0x69, 0x49, 0x1E, 0xC0, 0xEA, 0x00, 0x74, 0xF3, 0x18, 0xAE, 0xCF, 0xD1,
+    0xE9, 0x06, 0xFF, 0xC0, 0xA3, 0x4F, 0x41, 0xC3, 0x26, 0x26, 0x64, 0x91, 0xC2, 0x15, 0x8E, 0x2D,
+    0x46, 0x18, 0xF3, 0x96, 0xAC, 0xAF, 0x20, 0x7F, 0xAF, 0x07, 0xFB, 0x17, 0x01, 0xAA, 0x05, 0xD0,
+    0x44, 0x50, 0xE2, 0x20, 0x1F, 0x81, 0xA2, 0x05, 0x24, 0x05, 0x6F, 0x64, 0xE2, 0xD0, 0x32, 0x40,
+    0x21, 0x0E, 0x9A, 0xF6, 0xC0, 0x7D, 0x36, 0x93, 0xF6, 0xF3, 0x90, 0x82, 0xA2, 0xA5, 0x43, 0x4B,
+    0x4B, 0x61, 0x3A, 0x6E, 0xE4, 0x41, 0xB7, 0xC6, 0x5B, 0x8E, 0xB1, 0xC3, 0xF9, 0xAC, 0xCB, 0x82,
+    0x75, 0x05, 0x1B, 0xAA, 0x57, 0xB1, 0xF0, 0xE6, 0x8D, 0x81, 0xAD, 0xC6, 0x21, 0x1D, 0xF9, 0xB7,
+    0xD2, 0x57, 0xFB, 0x34, 0x77, 0x45, 0x42, 0x65, 0x2A, 0x79, 0xCB, 0x92, 0x11, 0x2A, 0x35, 0x42,
+    0xA3, 0x47, 0x10, 0x3D, 0x3C, 0x7A, 0xC8, 0x9B, 0x64, 0x91, 0x2D, 0x74, 0x4B, 0x89, 0x09, 0x69,
+    0xCC, 0xD6, 0x57, 0x60, 0xC3, 0x45, 0x30, 0xED, 0x38, 0x0D, 0x5A, 0xFF, 0xDF, 0x08, 0x5A, 0x5A,
+    0xC8, 0x24, 0x4C, 0xA3, 0x56, 0x02, 0xA8, 0xC5, 0x8C, 0x40, 0x6D, 0x24, 0x8D, 0xB4, 0x12, 0x0F,
+    0xF5, 0x82, 0x07, 0xC6, 0x0D, 0x1C, 0xBD, 0x2A, 0xA0, 0x45, 0x1E, 0x85, 0x17, 0x51, 0x03, 0x33,
+    0x62, 0x34, 0x23, 0x13, 0x64, 0x64, 0x6B, 0x8F, 0x09, 0x33, 0xAA, 0xFE, 0x22, 0x13, 0x68, 0x34,
+    0x61, 0x97, 0x84, 0x1A, 0xA9, 0xA8, 0x48, 0xB0, 0x51, 0x0D, 0x54, 0x24, 0xDC, 0x68, 0x44, 0xC4,
+    0x29, 0x11, 0xE9, 0xA9, 0x44, 0xC4, 0x99, 0x0F, 0xB6, 0x3F, 0x3B, 0xA8, 0x11, 0x2A, 0x5F, 0x79,
+    0xF4, 0x68, 0xE2, 0x74, 0x23, 0xC8, 0xDE, 0x96, 0xA0, 0x44, 0xE2, 0x41, 0x59, 0xCA, 0xBF, 0x0F,
+    0xD4, 0x12, 0xD9, 0xCD, 0x46, 0x36, 0xD9, 0x62, 0x13, 0xEB, 0x0B, 0x74, 0x6B, 0x51, 0x51, 0x07,
+    0x46, 0xD5, 0xD1, 0xB0, 0x87, 0xF8, 0x52, 0xA4, 0xCB, 0x45, 0x7A, 0x44, 0x76, 0x30, 0xCB, 0x02,
+    0xE0, 0x12, 0xE7, 0xE0, 0x18, 0x4F, 0x00, 0x7D, 0x1E, 0xC0, 0x48, 0x04, 0xCA, 0x01, 0x58, 0xA3,
+    0x13, 0x3E, 0x02, 0x88, 0xDE, 0x90, 0xA3, 0x83, 0xF6, 0xDC, 0xFC, 0x5C, 0xC0, 0x4A, 0x58, 0xDF,
+    0xEA, 0xE7, 0x5D, 0xFC, 0x14, 0xB9, 0x08, 0x79, 0x57, 0x06, 0xDD, 0xEA, 0x4E, 0xB7, 0x0C, 0x2A,
+    0xB2, 0x49, 0xA4, 0x60, 0x03, 0x1B, 0x4E, 0x62, 0xA2, 0x09, 0x76, 0xC8, 0x44, 0x96, 0xD4, 0x22,
+    0xCE, 0xCA, 0x0F, 0x03, 0xCD, 0x5F, 0xC7, 0x9F, 0x69, 0x08, 0x90, 0xAF, 0xD8, 0xA9, 0xF3, 0x00,
+    0xD7, 0x00, 0x6A, 0x97, 0x38, 0xB2, 0x79, 0x18, 0xFF, 0xE8, 0x0D, 0xEB, 0xCB, 0x21, 0xF9, 0xCB,
+    0x0E, 0xB8, 0x4B, 0xDA, 0xD0, 0xD3, 0xF1, 0x0C, 0x80, 0xF6, 0x2B, 0x57, 0x7A, 0x1A, 0xD2, 0x9A,
+    0xFE, 0xF1, 0x87, 0x6A, 0xD2, 0x0E, 0x16, 0xC8, 0x44, 0x7A, 0x90, 0x16, 0xA8, 0xDA, 0x79, 0x11,
+    0xA5, 0xE9, 0xAF, 0x13, 0x32, 0x5C, 0x41, 0xCE, 0xCA, 0xCD, 0x5C, 0x15, 0x0D, 0x80, 0x1D, 0x00,
+    0xA4, 0xE5, 0x10, 0x56, 0xBE, 0xFF, 0x6A, 0x40, 0x44, 0x86, 0x64, 0xF4, 0x29, 0xE0, 0x50, 0x22,
+    0x02, 0x99, 0xAC, 0x53, 0x47, 0xE7, 0x93, 0xC3, 0xD8, 0x48, 0xFB, 0x62, 0xF1, 0x80, 0x64, 0xC7,
+    0x97, 0x64, 0x32, 0x50, 0xB5, 0x2E, 0x1B, 0x92, 0x9F, 0xDD, 0x49, 0xAE, 0xD7, 0x3A, 0xD8, 0x4C,
+    0xCB, 0x33, 0x1F, 0xC0, 0x4A, 0xA4, 0x90, 0x88, 0x99, 0x91, 0x64, 0xD2, 0x7E, 0x82, 0xA3, 0xE5,
+    0x0D, 0x20, 0x7F, 0xBD, 0x03, 0x5A, 0xE5, 0x3F, 0x72, 0x4A, 0x78, 0x66, 0x0A, 0x08, 0xF2, 0x05,
+    0xE8, 0x77, 0x3A, 0xB4, 0x37, 0x07, 0x14, 0x40, 0x29, 0x9E, 0xAA, 0x75, 0x94, 0x3E, 0xA9, 0x20,
+    0x0F, 0xD3, 0xF6, 0xD3, 0x4F, 0xCE, 0xBB, 0xF0, 0x49, 0x0B, 0x88, 0x4C, 0xDB, 0x61, 0xB3, 0xEF,
+    0x63, 0x75, 0x04, 0x12, 0x44, 0xB7, 0xDD, 0xEC, 0x21, 0x7F, 0xFC, 0x71, 0x5C, 0x3C, 0x94, 0x32,
+    0x42, 0x29, 0xE2, 0xB0, 0x0B, 0x40, 0x2F, 0x98, 0xF6, 0x94, 0xB4, 0x80, 0xD2, 0xC0, 0x93, 0x8E,
+    0x03, 0xA0, 0xFB, 0x95, 0x8E, 0x52, 0x0C, 0x2A, 0x1E, 0xB0, 0x0B, 0x70, 0xC8, 0xF2, 0x0F, 0x46,
+    0xAC, 0x88, 0xF8, 0xE4, 0x08, 0xB4, 0x24, 0x61, 0x25, 0x42, 0x29, 0x77, 0xD6, 0x6F, 0xAD, 0x23,
+    0x6A, 0x84, 0x25, 0xD4, 0x7E, 0x3D, 0xD6, 0xF3, 0x46, 0x3A, 0xDB, 0x3F, 0x69, 0x3A, 0x74, 0x87,
+    0x8A, 0x30, 0xC0, 0x26, 0x58, 0x47, 0xDE, 0xA1, 0x96, 0x50, 0x49, 0xC8, 0x65, 0xA4, 0x9C, 0x50,
+    0xFE, 0x11, 0x1E, 0x03, 0x36, 0x72, 0x0F, 0xFC, 0xB0, 0x5D, 0xC9, 0xFB, 0x0F, 0xDB, 0x7F, 0x3F,
+    0x2C, 0x73, 0x38, 0xC4, 0x53, 0x58, 0xAE, 0xA1, 0xBF, 0xEE, 0xD3, 0x54, 0xF5, 0x0F, 0x3A, 0xE8,
+    0x23, 0xE2, 0x29, 0xC5, 0x23, 0x2F, 0x90, 0x4D, 0x84, 0x4E, 0x1E, 0x92, 0x6D, 0x58, 0x97, 0x7E,
+    0x0A, 0x9F, 0x02, 0x0A, 0x2B, 0x91, 0x5C, 0xC6, 0x03, 0x16, 0x01, 0xA8, 0x36, 0x77, 0x60, 0x7E,
+    0x29, 0x00, 0x55, 0xB7, 0xDA, 0xE7, 0x8E, 0x3E, 0x4C, 0x13, 0xDB, 0x2F, 0xCD, 0x6C, 0x40, 0x26,
+    0xB2, 0x84, 0x4A, 0x64, 0x40, 0x77, 0xAA, 0x69, 0x13, 0x19, 0x60, 0x03, 0x79, 0x64, 0x84, 0xCA,
+    0x15, 0x1E, 0x3D, 0x64, 0x3D, 0x54, 0xBE, 0x02, 0x3D, 0xE8, 0x08, 0x95, 0xDB, 0x85, 0x3C, 0x9A,
+    0x16, 0x84, 0x11, 0x8A, 0xCE, 0x06, 0xCC, 0x42, 0xDD, 0xD9, 0xBE, 0x2A, 0xA1, 0x14, 0x91, 0xA8,
+    0x45, 0x64, 0xA4, 0x12, 0x11, 0x72, 0x49, 0x48, 0xF3, 0xFB, 0x6B, 0x11, 0xD8, 0x1C, 0xA9, 0xF4,
+    0xA7, 0x01, 0xE2, 0x06, 0x90, 0xC5, 0x1D, 0x40, 0x77, 0xD7, 0xE1, 0xF3, 0x3A, 0x44, 0xB4, 0x7C,
+    0x3D, 0x9C, 0xA3, 0x90, 0x1F, 0x78, 0xD8, 0xCD, 0x04, 0x54, 0x8F, 0x80, 0x6E, 0x59, 0x42, 0x1E,
+    0x58, 0x80, 0x75, 0x6A, 0x04, 0xEB, 0xB2, 0x01, 0x0A, 0x97, 0xF7, 0x50, 0xB4, 0x65, 0x9C, 0x2D,
+    0xD0, 0x8A, 0xC4, 0x15, 0x10, 0x68, 0xDE, 0x6D, 0x3F, 0x42, 0x5C, 0xC8, 0xC6, 0x3E, 0xE6, 0xB4,
+    0x0E, 0x10, 0x59, 0xCC, 0xB1, 0xC3, 0xD1, 0xAB, 0xB7, 0x1D, 0x47, 0x2E, 0x6D, 0x00, 0xF2, 0xF7,
+    0x91, 0xA4, 0x00, 0x35, 0x98, 0x11, 0x0A, 0x67, 0x23, 0xF4, 0x54, 0x7E, 0x1A, 0xFF, 0x26, 0x79,
+    0x84, 0x9E, 0xD2, 0x93, 0xB7, 0x6A, 0x31, 0x0F, 0xBF, 0x16, 0x09, 0x90, 0xF8, 0x1F, 0x91, 0xE1,
+    0xBE, 0xD1, 0xA7, 0xE3, 0xE3, 0xCD, 0x02, 0x6A, 0x79, 0xB8, 0xDF, 0x30, 0x22, 0x43, 0x52, 0x5F,
+    0x21, 0xB7, 0x2F, 0xA5, 0xFD, 0xA8, 0x62, 0x0A, 0x33, 0xD3, 0xCC, 0x8D, 0x29, 0xB4, 0xEF, 0x50,
+    0x22, 0x6D, 0x5A, 0x53, 0x3A, 0x02, 0x79, 0x37, 0x53, 0x21, 0x36, 0xCC, 0xBF, 0xCA, 0x37, 0xB7,
+    0xCF, 0xA5, 0xA5, 0x51, 0x89, 0x44, 0x6A, 0x91, 0x48, 0xB3, 0x8F, 0x84, 0x3E, 0xDE, 0x2C, 0xD0,
+    0x2B, 0xE6, 0xE0, 0xC1, 0xA3, 0xF1, 0xD0, 0x34, 0x50, 0xB9, 0xB3, 0x18, 0x9F, 0x85, 0xAC, 0x63,
+    0x87, 0xAD, 0xAB, 0x12, 0x8C, 0xC8, 0xC8, 0x9D, 0x97, 0x12, 0x16, 0x57, 0xFD, 0xCC, 0x20, 0xCB,
+    0x9B, 0xBF, 0x8E, 0x11, 0x09, 0xC9, 0xD3, 0xBD, 0x7A, 0x07, 0xE0, 0x04, 0x27, 0xE0, 0x34, 0x1B,
+    0x50, 0xFC, 0x41, 0x0F, 0x56, 0xDA, 0x03, 0xC4, 0xC1, 0x87, 0x34, 0x7A, 0x8F, 0xE3, 0x19, 0x4E,
+    0xA0, 0xA2, 0xF1, 0x58, 0xE9, 0x26, 0x0E, 0xFA, 0xD1, 0xD0, 0xCD, 0x0C, 0x60, 0xEE, 0x45, 0x74,
+    0xAF, 0x3D, 0x37, 0x38, 0xC5, 0x73, 0xE4, 0x41, 0xDF, 0x96, 0x91, 0x46, 0x24, 0xD8, 0x37, 0x5D,
+    0xC2, 0x09, 0x85, 0x9B, 0x53, 0x52, 0x77, 0x5E, 0x6E, 0x69, 0x64, 0x4C, 0x22, 0x1E, 0x59, 0xDB,
+    0xA0, 0xF6, 0xE6, 0x5D, 0xA4, 0x0C, 0xB3, 0xFB, 0x7F, 0xE0, 0x28, 0x45, 0x3A, 0xD2, 0x0A, 0xBE,
+    0xFB, 0x56, 0xD2, 0xC3, 0x38, 0x47, 0x49, 0xFB, 0xFF, 0x89, 0x78, 0x0A, 0x59, 0x40, 0x23, 0x31,
+    0x5D, 0xB2, 0xF0, 0xC0, 0xCD, 0xF9, 0x06, 0x36, 0x00, 0xB7, 0xB6, 0xB7, 0x9D, 0x16, 0x91, 0x44,
+    0x4F, 0xD6, 0x22, 0x71, 0x8D, 0xD0, 0xFA, 0x11, 0x81, 0xE7, 0x01, 0x2B, 0x30, 0xF7, 0x22, 0x95,
+    0x3B, 0xCB, 0x0D, 0x4E, 0x65, 0x1D, 0x3B, 0xFA, 0xB6, 0x8C, 0x46, 0x64, 0xB4, 0x6F, 0x3A, 0xEC,
+    0x34, 0xEA, 0x22, 0xA4, 0x41, 0x1B, 0x91, 0x90, 0x89, 0x84, 0x69, 0xFA, 0x7F, 0x36, 0x83, 0xC9,
+    0x42, 0x4A, 0x5F, 0x40, 0x3B, 0xEF, 0x26, 0xEA, 0xF2, 0x4F, 0x2B, 0xFC, 0xB1, 0x29, 0x98, 0x6E,
+    0x21, 0x0B, 0xD3, 0x4E, 0xFF, 0x0B, 0x2B, 0xAD, 0x44, 0xED, 0x21, 0x5E, 0x9F, 0x02, 0xA5, 0x2C,
+    0x02, 0xD9, 0x23, 0xF4, 0x27, 0xE2, 0xB5, 0xC8, 0x98, 0x8C, 0x7A, 0x35, 0xFD, 0xD6, 0xAF, 0x1B,
+    0x83, 0x95, 0x25, 0xD4, 0xD2, 0x27, 0x7B, 0xB1, 0x61, 0x02, 0x19, 0x59, 0x3F, 0x0F, 0xBD, 0x02,
+    0xB2, 0x3B, 0xDB, 0xDB, 0x69, 0xE8, 0x95, 0x48, 0x54, 0x22, 0x12, 0x26, 0xB2, 0x59, 0xA1, 0xE0,
+    0x7A, 0xEE, 0x30, 0x9F, 0x71, 0xC9, 0xA8, 0x8A, 0x15, 0x2D, 0xF0, 0x90, 0x23, 0x5B, 0x26, 0x6B,
+    0xB6, 0xED, 0x31, 0x8C, 0xCF, 0x82, 0xF1, 0x2A, 0xEA, 0xDB, 0x32, 0x66, 0x22, 0xC2, 0x9D, 0x97,
+    0x92, 0x9B, 0x2C, 0xDC, 0xB4, 0xFB, 0xCA, 0x9B, 0xBF, 0x4E, 0x29, 0x92, 0x44, 0x3B, 0x9E, 0xD8,
+    0xC3, 0x04, 0x8D, 0x13, 0x0E, 0xBA, 0x01, 0xE8, 0x10, 0x81, 0x6B, 0xEA, 0x3E, 0x5F, 0xF2, 0x54,
+    0xE2, 0xEC, 0x1D, 0xA5, 0x48, 0x8F, 0x5D, 0x3A, 0xE5, 0x26, 0xD8, 0xE3, 0x48, 0x5B, 0xEA, 0xB4,
+    0xF7, 0x57, 0x6E, 0x05, 0x73, 0x96, 0x13, 0x0C, 0xF8, 0xBC, 0x53, 0x23, 0xB9, 0xF4, 0x65, 0xE0,
+    0x53, 0xF2, 0xE2, 0x08, 0xF6, 0x72, 0x19, 0x50, 0x51, 0x0B, 0x54, 0x94, 0x72, 0xA5, 0xE9, 0x94,
+    0x88, 0x2C, 0xA7, 0x64, 0x40, 0x25, 0x32, 0xC0, 0xAB, 0xF2, 0x3E, 0x73, 0x42, 0xDB, 0x06, 0xE0,
+    0xBF, 0xB7, 0x90, 0xBF, 0xD0, 0xC1, 0xF3, 0x5C, 0x5E, 0x5F, 0x61, 0xE1, 0x32, 0x46, 0xBE, 0x13,
+    0xB8, 0x75, 0x75, 0x49, 0x1E, 0x8A, 0x9E, 0x4D, 0xAA, 0xA0, 0x3A, 0x96, 0x58, 0x74, 0xCF, 0x06,
+    0x45, 0xA0, 0x63, 0xFA, 0xCC, 0x8A, 0x84, 0x94, 0x6F, 0xAE, 0xA5, 0x87, 0xFA, 0x3F, 0xCD, 0xF3,
+    0x93, 0x47, 0x8E, 0x28, 0xF1, 0x54, 0x32, 0xA2, 0xD2, 0x4A, 0x1F, 0x80, 0x97, 0xD2, 0xE2, 0xF2,
+    0x38, 0x38, 0xC5, 0x29, 0xC8, 0x3A, 0xE3, 0x48, 0x8E, 0x86, 0xBA, 0x7F, 0x74, 0x94, 0xF8, 0x61,
+    0xE9, 0xAB, 0xA3, 0xE3, 0x18, 0xA7, 0xE0, 0xCE, 0x2B, 0x1E, 0x23, 0xDD, 0x74, 0xAF, 0x07, 0xDD,
+    0x60, 0x7C, 0x16, 0x23, 0xDF, 0x09, 0xD9, 0xDD, 0x66, 0x60, 0x47, 0x89, 0xB3, 0xCE, 0x46, 0xD5,
+    0xB1, 0x64, 0x03, 0xDB, 0xEA, 0xA0, 0x46, 0xCE, 0x52, 0xF9, 0x3C, 0x14, 0x3D, 0x95, 0x48, 0xC2,
+    0x00, 0x85, 0x2C, 0x26, 0x9D, 0xA9, 0x01, 0xA8, 0x51, 0xBE, 0xEE, 0xA8, 0x64, 0x24, 0x17, 0x81,
+    0x57, 0xC5, 0xC3, 0xD3, 0xEB, 0x77, 0xD9, 0x5B, 0x39, 0xFE, 0x32, 0xF0, 0x08, 0xC7, 0x94, 0x98,
+    0x56, 0x69, 0x93, 0xA6, 0xAA, 0x3B, 0x1C, 0x4E, 0x78, 0xB2, 0x6A, 0x67, 0x45, 0x25, 0x64, 0xD9,
+    0xAF, 0xE0, 0xE4, 0x32, 0xE9, 0x4D, 0xFD, 0x11, 0x45, 0xA0, 0x96, 0x5F, 0x8E, 0x1C, 0x95, 0x6F,
+    0x8E, 0x60, 0x2F, 0x37, 0x90, 0x87, 0x2A, 0xA2, 0xA3, 0x91, 0xDB, 0x57, 0x87, 0xA4, 0xA5, 0x6A,
+    0x06, 0x11, 0x9E, 0xE3, 0x13, 0xA2, 0x1E, 0xA6, 0xB4, 0x81, 0xEE, 0x79, 0x30, 0x8E, 0x9E, 0x16,
+    0x7B, 0xE6, 0x69, 0x16, 0x7B, 0x94, 0x6F, 0x4B, 0xD2, 0x42, 0x8F, 0x70, 0x12, 0xDB, 0xE9, 0xC0,
+    0x82, 0x0D, 0x8A, 0xA0, 0xBD, 0x4E, 0xAA, 0xD3, 0x69, 0x67, 0x5A, 0xA6, 0xAD, 0x2C, 0xBF, 0xB3,
+    0x37, 0xC7, 0x1E, 0x91, 0x8F, 0xE5, 0xCB, 0x54, 0xC7, 0x50, 0x4B, 0x4C, 0x26, 0xA5, 0xCE, 0x7D,
+    0x78, 0xC3, 0x7E, 0xD8, 0x21, 0xAB, 0xAC, 0x41, 0x15, 0x66, 0x7A, 0xCC, 0x46, 0x20, 0xEF, 0x99,
+    0xCA, 0x1C, 0xD6, 0x51, 0x84, 0x8D, 0x29, 0xD7, 0x4A, 0x19, 0x66, 0xF5, 0xCD, 0xDF, 0xFA, 0x19,
+    0x99, 0x56, 0xE2, 0x42, 0x6D, 0x0B, 0xB0, 0xDB, 0x01, 0xFA, 0xF5, 0x08, 0x9C, 0xE5, 0x35, 0xEE,
+    0x8B, 0x96, 0x48, 0xF8, 0x33, 0xB2, 0x4B, 0x2A, 0xD5, 0x61, 0x31, 0xBD, 0x51, 0x43, 0x11, 0xB2,
+    0x11, 0x6E, 0x61, 0x3B, 0x74, 0x4F, 0xE5, 0x28, 0x82, 0x1A, 0xA1, 0xC1, 0x46, 0x74, 0x82, 0xDD,
+    0x9D, 0x12, 0x11, 0x71, 0x66, 0x85, 0xC3, 0xA3, 0x92, 0x2B, 0x57, 0xC4, 0x9B, 0x1E, 0xBD, 0xA0,
+    0x0A, 0xD8, 0x88, 0x40, 0x1D, 0xF2, 0x91, 0x6C, 0x49, 0xD9, 0xA5, 0xC0, 0xA6, 0x9B, 0xF2, 0xC9,
+    0xFF, 0x1B, 0xEC, 0xA7, 0x03, 0xA7, 0x12, 0xCF, 0x81, 0x6E, 0x53, 0x50, 0x6F, 0xE6, 0x70, 0x64,
+    0x2A, 0xB6, 0xD8, 0x04, 0x36, 0x7E, 0xC1, 0x71, 0x4B, 0x22, 0x22, 0x83, 0x12, 0x37, 0x66, 0x23,
+    0x3B, 0x3A, 0x72, 0x21, 0xEF, 0xB8, 0x61, 0x02, 0xBD, 0x0D, 0xC4, 0xC2, 0x67, 0xB1, 0x74, 0xBA,
+    0xAB, 0xC8, 0xBB, 0x1A, 0xDB, 0x36, 0xD8, 0x80, 0x09, 0x64, 0x91, 0x6A, 0x2A, 0x47, 0x62, 0x17,
+    0xD3, 0x91, 0xF5, 0x54, 0x0E, 0x1B, 0x18, 0xA1, 0x26, 0x8F, 0x64, 0xA3, 0x12, 0x11, 0x19, 0x8C,
+    0x88, 0x48, 0x6B, 0x3E, 0xD8, 0x7E, 0x79, 0x41, 0x99, 0x84, 0xBF, 0x72, 0xA5, 0xF1, 0xB9, 0x88,
+    0x2C, 0xD6, 0xF0, 0x76, 0xD0, 0x22, 0xB2, 0xA4, 0xEC, 0x30, 0x3D, 0xE2, 0xA8, 0x82, 0x1E, 0x51,
+    0x42, 0x11, 0x31, 0x03, 0x8D, 0xA7, 0xEA, 0xD6, 0x06, 0xF3, 0xFA, 0x4B, 0xBC, 0x2A, 0x3D, 0xCD,
+    0x1F, 0xB9, 0x9F, 0x7A, 0x30, 0x00, 0xA3, 0x61, 0xE3, 0x72, 0x9B, 0x7F, 0xFA, 0x4F, 0xB8, 0x56,
+    0x3C, 0x64, 0x59, 0xDA, 0x16, 0x35, 0x42, 0x19, 0xC8, 0x06, 0xA8, 0x1C, 0x3A, 0x42, 0x9D, 0xB2,
+    0x81, 0x23, 0x14, 0xFB, 0xEF, 0xF7, 0xE9, 0xFD, 0x08, 0x4B, 0x28, 0x5A, 0xB2, 0x05, 0x54, 0x81,
+    0x7C, 0x5C, 0xE5, 0xBD, 0xB2, 0xF1, 0x89, 0xFC, 0xDF, 0x9E, 0xB2, 0x79, 0x7F, 0x94, 0xB5, 0x3B,
+    0x5D, 0x87, 0x08, 0x11, 0xD5, 0xA1, 0x5B, 0x74, 0x20, 0x0F, 0x18, 0x8F, 0x75, 0x14, 0x50, 0x42,
+    0x05, 0xBB, 0x09, 0xCC, 0x00, 0xEA, 0x6D, 0x69, 0x13, 0x57, 0xFE, 0x30, 0x49, 0xA9, 0xA7, 0x1A,
+    0xA7, 0x2E, 0x79, 0xF9, 0x31, 0xED, 0xC2, 0xA5, 0x3F, 0xF0, 0x72, 0x91, 0x96, 0x51, 0x11, 0xA0,
+    0x49, 0xEB, 0xAD, 0x68, 0xA1, 0x71, 0xE8, 0x11, 0x8A, 0x38, 0x8B, 0xAB, 0x32, 0x91, 0xAF, 0xCA,
+    0x72, 0x6D, 0xE7, 0x3B, 0xE2, 0xD0, 0x01, 0x22, 0x5C, 0x80, 0xD3, 0x60, 0x21, 0x0F, 0x64, 0xF7,
+    0xD5, 0x0B, 0xE5, 0x5D, 0x82, 0x1E, 0x6A, 0x24, 0x1B, 0xC9, 0x06, 0x74, 0x8F, 0x8E, 0xE4, 0x11,
+    0xD3, 0x61, 0x5B, 0x6C, 0xA0, 0xF4, 0x54, 0x8E, 0x0A, 0x6A, 0x68, 0x60, 0x89, 0x5A, 0x90, 0x8D,
+    0xE8, 0x91, 0x7C, 0xC4, 0x0C, 0xD8, 0x7E, 0x2A, 0x20, 0x79, 0x0D, 0x7E, 0xD3, 0x25, 0x34, 0x07,
+    0x8C, 0xA8, 0x11, 0x3D, 0x24, 0x86, 0x65, 0x6D, 0xF5, 0x3B, 0x2C, 0x58, 0x38, 0x09, 0xA7, 0x61,
+    0x03, 0x76, 0xE0, 0x06, 0xF4, 0xA8, 0x48, 0x16, 0xD1, 0x91, 0xBC, 0xC3, 0xB4, 0x58, 0xD8, 0x80,
+    0xE7, 0xA1, 0x0A, 0x1C, 0xF1, 0xAB, 0x94, 0xC8, 0x02, 0x35, 0xDE, 0x57, 0x2B, 0x30, 0xE9, 0xB3,
+    0x08, 0x94, 0x07, 0xA5, 0xBD, 0x35, 0x49, 0x31, 0x0D, 0xAB, 0x27, 0x8F, 0x98, 0x88, 0xED, 0x28,
+    0x5A, 0xCA, 0x96, 0x2A, 0x50, 0x87, 0xA4, 0xC0, 0xAC, 0xB5, 0x6C, 0xA8, 0xCE, 0xB8, 0x0D, 0x15,
+    0x8D, 0xDF, 0x54, 0xD1, 0x84, 0x4A, 0x0D, 0xA6, 0x05, 0xDB, 0xAA, 0x31, 0x79, 0x83, 0x32, 0xE8,
+    0x81, 0xD2, 0xE7, 0x91, 0xCA, 0x99, 0x48, 0x85, 0xED, 0xA8, 0xB1, 0x81, 0x5B, 0x94, 0x81, 0x91,
+    0xCA, 0xAB, 0x91, 0xCA, 0x65, 0x03, 0x35, 0xBA, 0xE7, 0x16, 0xBA, 0x67, 0x41, 0x1E, 0xD5, 0x88,
+    0x89, 0xD9, 0x90, 0x12, 0xEA, 0x45, 0x9B, 0x47, 0xCA, 0xD6, 0x74, 0x54, 0xC1, 0xB6, 0xD4, 0xA1,
+    0x08, 0x34, 0xBE, 0xF2, 0x93, 0x97, 0xFD, 0x43, 0x01, 0x25, 0x0B, 0xC8, 0x64, 0x98, 0xA8, 0x7A,
+    0x7D, 0x97, 0x19, 0xE3, 0x50, 0x43, 0xDE, 0xEA, 0x01, 0x2A, 0x57, 0x74, 0x29, 0x00, 0x79, 0xE8,
+    0xAE, 0x79, 0x1D, 0x8E, 0xBA, 0x44, 0x11, 0x5A, 0x50, 0x91, 0x0B, 0x60, 0x7C, 0xD6, 0xC2, 0xE6,
+    0xF4, 0xC6, 0x0E, 0x18, 0x9F, 0x75, 0xB0, 0x89, 0x75, 0x30, 0xBF, 0x11, 0x61, 0x13, 0x1B, 0x20,
+    0xB2, 0x0B, 0xB9, 0xCF, 0xFA, 0x39, 0x43, 0x13, 0xF7, 0x93, 0x4B, 0x37, 0x01, 0xF5, 0x6A, 0x42,
+    0xB3, 0x0E, 0x68, 0xD6, 0x21, 0xC4, 0xE9, 0x95, 0xB4, 0xE6, 0x26, 0x13, 0x24, 0xD3, 0x6E, 0x9F,
+    0x22, 0xF9, 0xCA, 0x8A, 0xE6, 0xA9, 0xFC, 0xEC, 0xA8, 0xF3, 0xB8, 0xCA, 0xDE, 0x2F, 0x56, 0x04,
+    0x51, 0x82, 0x04, 0xFB, 0x1F, 0x8F, 0xAB, 0x8F, 0xAB, 0x55, 0x29, 0x93, 0xED, 0x66, 0x5C, 0x9D,
+    0x74, 0x71, 0xEB, 0xBE, 0x8F, 0x5B, 0x38, 0x54, 0x44, 0x52, 0x12, 0x47, 0xC9, 0x08, 0x34, 0xE3,
+    0x5C, 0x88, 0xA4, 0xD6, 0xE8, 0xD4, 0x69, 0x50, 0xE2, 0x12, 0x99, 0x98, 0x30, 0xD2, 0x1A, 0x08,
+    0x89, 0x73, 0x0E, 0x52, 0xB7, 0x33, 0x3F, 0x6C, 0xFC, 0xCC, 0x2D, 0xD8, 0x39, 0x37, 0x99, 0x54,
+    0xB5, 0xC1, 0x94, 0x2A, 0xE6, 0xFA, 0xAC, 0xB8, 0xFD, 0xEF, 0xE7, 0x61, 0x12, 0xEE, 0x88, 0x38,
+    0x12, 0xE7, 0x56, 0xBD, 0xBF, 0x56, 0xEC, 0xA0, 0x47, 0x74, 0x34, 0x91, 0x3C, 0x96, 0x01, 0xD3,
+    0xD6, 0x60, 0xDF, 0x59, 0x40, 0xF1, 0xB5, 0x1E, 0xCA, 0xCF, 0x74, 0x50, 0x55, 0x1E, 0xEA, 0x25,
+    0x20, 0x23, 0x20, 0x11, 0x94, 0x74, 0xA4, 0xAC, 0xB8, 0x96, 0x11, 0xCC, 0x0F, 0x97, 0x60, 0xFF,
+    0x46, 0x1C, 0xC5, 0x3B, 0x12, 0x28, 0x83, 0x74, 0x54, 0xBE, 0xE9, 0xA9, 0xA9, 0x46, 0x1A, 0x4A,
+    0x59, 0xB1, 0x34, 0x33, 0xCC, 0xCC, 0x87, 0x19, 0x65, 0xDA, 0x6E, 0x56, 0x7D, 0xED, 0x80, 0x2F,
+    0x4C, 0xB3, 0x3E, 0x51, 0x87, 0x7B, 0xB0, 0x05, 0xD6, 0x61, 0x02, 0xBA, 0xBB, 0x49, 0x7F, 0x93,
+    0xBD, 0x9B, 0x6C, 0xDD, 0xC4, 0x8E, 0xE4, 0x0B, 0xB4, 0x04, 0xEE, 0x0D, 0x5C, 0x6C, 0x5C, 0x65,
+    0xA3, 0xFD, 0xAA, 0xE4, 0x5D, 0xF5, 0x5E, 0x6F, 0xEE, 0x63, 0x40, 0xEA, 0x40, 0x15, 0xB0, 0x1D,
+    0x79, 0x44, 0x0F, 0x64, 0xE3, 0x04, 0x5D, 0xE0, 0xC9, 0x43, 0x5C, 0xDF, 0x24, 0xF6, 0xEA, 0xBD,
+    0x2E, 0xFB, 0x8E, 0xD7, 0xDF, 0x25, 0x1F, 0x31, 0x11, 0x1B, 0x29, 0x46, 0x36, 0x6F, 0xB1, 0x51,
+    0xB9, 0x0B, 0x55, 0xE8, 0x8B, 0x2E, 0xF1, 0xD4, 0x67, 0xD3, 0x1E, 0xF3, 0xDC, 0xA4, 0xDE, 0xB5,
+    0xD9, 0x3A, 0x97, 0x00, 0xD6, 0x98, 0x6C, 0xA3, 0xF0, 0x70, 0xF3, 0xC1, 0x97, 0x01, 0x6E, 0xA5,
+    0x97, 0x76, 0x7A, 0xD9, 0xA7, 0x97, 0x35, 0x68, 0x11, 0xF9, 0x8C, 0xC8, 0x58, 0x8B, 0xBC, 0x27,
+    0x22, 0x2E, 0x45, 0x86, 0x17, 0xC0, 0x26, 0x0B, 0xD8, 0xBB, 0x7F, 0xC1, 0xDD, 0x00, 0xEB, 0x51,
+    0x11, 0xCA, 0x74, 0xC6, 0x4E, 0xBA, 0x56, 0x0F, 0x45, 0x0A, 0x81, 0x37, 0xD3, 0xDC, 0x8F, 0xE9,
+    0xC4, 0x3E, 0x9D, 0x18, 0xA1, 0x7A, 0x8B, 0x5C, 0x1C, 0x4D, 0xBF, 0x96, 0x3A, 0x7A, 0xB8, 0xB4,
+    0xF7, 0x09, 0xDE, 0xFF, 0xC3, 0x04, 0x3F, 0x00, 0xE5, 0xF2, 0x21, 0xE1, 0xB8, 0x65, 0x9A, 0xED,
+    0xCA, 0x1D, 0x70, 0xA5, 0x26, 0xB0, 0x89, 0x8A, 0xAB, 0xBF, 0xD6, 0xDF, 0xF7, 0x37, 0xB0, 0x85,
+    0xEA, 0x31, 0x81, 0x0A, 0x96, 0x97, 0x72, 0x71, 0xE5, 0x62, 0xFD, 0xFA, 0xF9, 0x40, 0x15, 0x58,
+    0x60, 0x22, 0xB5, 0x5B, 0xBB, 0x72, 0xDE, 0x25, 0xCE, 0xC6, 0xCE, 0xF5, 0x73, 0xEE, 0x30, 0x15,
+    0x27, 0xA9, 0xD9, 0xE4, 0x26, 0x1B, 0x8C, 0xDC, 0x50, 0x23, 0x7D, 0x36, 0xA4, 0xB1, 0xE8, 0x98,
+    0x76, 0x45, 0x3B, 0x7F, 0x25, 0x40, 0x25, 0xD2, 0x57, 0x22, 0xB1, 0x16, 0xE9, 0x9A, 0x44, 0x65,
+    0x3D, 0x09, 0x59, 0xCB, 0x9E, 0x45, 0x77, 0x3B, 0x14, 0x59, 0xC7, 0x9E, 0x45, 0xB7, 0x29, 0x22,
+    0x1E, 0x78, 0xD8, 0xCB, 0x31, 0x4D, 0x45, 0xE1, 0x60, 0x6F, 0x9A, 0xFA, 0xEF, 0x43, 0xDD, 0x93,
+    0x49, 0x3B, 0xD9, 0x8D, 0x1A, 0x26, 0xA2, 0xA2, 0x9A, 0xE6, 0xC2, 0xB4, 0x26, 0xE8, 0xA8, 0xA3,
+    0x1A, 0xB2, 0x91, 0x9B, 0x48, 0xFA, 0x20, 0x24, 0x09, 0x75, 0x9C, 0xCE, 0xBE, 0x35, 0x85, 0x6A,
+    0x36, 0x24, 0x77, 0xA5, 0x45, 0xC4, 0x89, 0x48, 0xA8, 0x45, 0xBA, 0x72, 0x55, 0x94, 0xB3, 0x07,
+    0xD6, 0xA1, 0x22, 0x54, 0x93, 0x21, 0x99, 0xD6, 0xFA, 0x91, 0xBE, 0x0C, 0xA5, 0x1E, 0xFF, 0x31,
+    0x66, 0x72, 0x7F, 0x14, 0xB5, 0x96, 0xD4, 0x32, 0x13, 0xE9, 0x33, 0xD5, 0x39, 0x16, 0x7E, 0x6F,
+    0xF2, 0x2D, 0xD3, 0x09, 0xD5, 0x74, 0x42, 0xFE, 0xDE, 0xB4, 0x6C, 0x6E, 0xEE, 0x4C, 0x9B, 0xE8,
+    0x0F, 0x92, 0xBD, 0xA8, 0x99, 0x29, 0x2C, 0xA7, 0xBB, 0xE9, 0x79, 0x96, 0x6B, 0x77, 0xB0, 0xBC,
+    0x6A, 0x95, 0x15, 0xA9, 0xE7, 0xCA, 0xA9, 0x69, 0xB7, 0xCF, 0x65, 0xBE, 0xD4, 0x74, 0x8F, 0xDD,
+    0x7A, 0x3A, 0xE1, 0x2F, 0x52, 0x31, 0x58, 0x1E, 0x13, 0x3B, 0xA5, 0xC6, 0x22, 0x11, 0xA8, 0x75,
+    0x96, 0xEC, 0x75, 0xAE, 0x02, 0xCB, 0xA7, 0x2F, 0xAA, 0xD9, 0x8C, 0xEA, 0x79, 0x81, 0xB8, 0xF5,
+    0x5A, 0x88, 0x03, 0xD8, 0x22, 0xAC, 0x7C, 0xB0, 0x5A, 0xDB, 0xAE, 0xD6, 0xDE, 0xB0, 0x8F, 0x7A,
+    0xE3, 0x1C, 0x64, 0xF7, 0x96, 0xE7, 0xD4, 0x17, 0xE5, 0x5B, 0x64, 0xF2, 0xFB, 0x5B, 0x33, 0x67,
+    0x36, 0x5F, 0x34, 0x95, 0x33, 0x2C, 0x2F, 0xAD, 0x86, 0x36, 0x1B, 0xFE, 0x31, 0x98, 0x29, 0xA9,
+    0xF5, 0x8A, 0x0C, 0xFD, 0x48, 0xAE, 0xF5, 0x25, 0xB2, 0xB7, 0x60, 0x44, 0x8F, 0x64, 0x03, 0x66,
+    0x44, 0xF7, 0xD8, 0x05, 0x79, 0xC4, 0x2E, 0x31, 0x1D, 0xE5, 0x12, 0xDB, 0x52, 0x09, 0x45, 0xA0,
+    0xAA, 0x29, 0x3D, 0x4D, 0xE5, 0x2A, 0xC7, 0xB2, 0xF2, 0x35, 0x6A, 0x51, 0xFA, 0x5B, 0x64, 0x63,
+    0x11, 0x16, 0xE8, 0xB1, 0x78, 0x67, 0x24, 0x1F, 0xEC, 0x37, 0x47, 0x4C, 0x6F, 0xFF, 0xA6, 0xC7,
+    0x46, 0xF3, 0xB7, 0x91, 0x22, 0xE6, 0xF7, 0x22, 0x65, 0xA7, 0xA5, 0xA3, 0x6A, 0xB5, 0x04, 0xEA,
+    0xA0, 0x25, 0xD0, 0x84, 0x2C, 0xA5, 0xF9, 0xCC, 0x94, 0xE7, 0xD3, 0x21, 0xFD, 0x3C, 0xAA, 0xEC,
+    0x33, 0xFF, 0x37, 0x43, 0xA2, 0x82, 0xE4, 0xF7, 0x7A, 0x6A, 0xB6, 0x28, 0x9D, 0xF5, 0x36, 0xE8,
+    0x36, 0x6F, 0x55, 0x9F, 0x45, 0xF6, 0x18, 0xA9, 0xA8, 0x29, 0x7C, 0xE9, 0x4D, 0x67, 0x5B, 0xDD,
+    0xE7, 0x91, 0x31, 0x1B, 0x57, 0x33, 0x85, 0x7A, 0x69, 0x1A, 0xA9, 0x1A, 0xC8, 0xE7, 0x91, 0xEA,
+    0x88, 0x5D, 0x60, 0x3A, 0x8A, 0x79, 0xA4, 0x36, 0x8D, 0x34, 0xAC, 0x8F, 0x94, 0x45, 0xE9, 0x9B,
+    0x9F, 0x76, 0xA4, 0xB3, 0x0C, 0xD3, 0x06, 0x37, 0x41, 0x25, 0xDB, 0xAD, 0xE0, 0x45, 0xA2, 0x57,
+    0x26, 0x72, 0xF6, 0x8F, 0x13, 0x18, 0xB8, 0xEA, 0x69, 0x24, 0x22, 0xBF, 0xD7, 0xAB, 0x91, 0x21,
+    0xEB, 0x19, 0x74, 0xA4, 0xCF, 0x5B, 0xD5, 0x9B, 0x90, 0x45, 0x1B, 0x74, 0x2C, 0x42, 0xDE, 0x95,
+    0xDE, 0x74, 0x95, 0xB3, 0x6D, 0x8D, 0x0D, 0xCD, 0x6C, 0xB4, 0xDB, 0x29, 0xF8, 0xD5, 0x63, 0x42,
+    0xEA, 0x26, 0x26, 0x1F, 0x56, 0x05, 0xF8, 0xC5, 0x35, 0x57, 0x9C, 0x85, 0xA3, 0x90, 0x48, 0x45,
+    0xA8, 0xDB, 0xFD, 0xB5, 0xFB, 0x73, 0x0F, 0xCF, 0xA9, 0x7D, 0xA8, 0x5A, 0x54, 0x4E, 0x39, 0x2E,
+    0xE4, 0x1E, 0xF3, 0x3B, 0x3F, 0x86, 0x71, 0xFC, 0x69, 0xEC, 0xE5, 0xA9, 0x09, 0x34, 0x66, 0x71,
+    0x22, 0xDC, 0x8A, 0x00, 0xD9, 0xB9, 0x1F, 0x93, 0x6D, 0xD4, 0xBF, 0x35, 0x24, 0x1E, 0xD9, 0xDE,
+    0x29, 0x1C, 0x0B, 0x6E, 0x50, 0x3A, 0xE3, 0x75, 0x64, 0x60, 0x0B, 0xEB, 0x4C, 0x9B, 0xF5, 0x8C,
+    0x54, 0xD8, 0xA0, 0x63, 0x36, 0xB0, 0x4B, 0xE5, 0x4D, 0xA7, 0x7B, 0x16, 0xAC, 0xA6, 0xEC, 0x43,
+    0x37, 0x52, 0x2D, 0x00, 0xF9, 0x12, 0xA0, 0x1C, 0x49, 0xB9, 0x47, 0x28, 0xEF, 0xCC, 0x34, 0xE1,
+    0x4F, 0x68, 0x92, 0x53, 0x25, 0x3B, 0x8D, 0xC3, 0xCA, 0x5C, 0xB2, 0xB2, 0x56, 0xF6, 0x27, 0x01,
+    0xAC, 0xDC, 0x7D, 0x68, 0x62, 0xFF, 0xC3, 0x2F, 0x10, 0x46, 0x7D, 0xA1, 0x09, 0xD4, 0xB2, 0x98,
+    0xCB, 0xA1, 0xEE, 0x3F, 0x3E, 0x35, 0xA4, 0x9C, 0xBD, 0xF9, 0xE0, 0x95, 0xA0, 0x7A, 0x76, 0xD8,
+    0x42, 0xB7, 0x79, 0x60, 0x93, 0x81, 0x3C, 0x58, 0xC7, 0xA8, 0x22, 0x85, 0x2B, 0x7C, 0x1E, 0x91,
+    0x1F, 0x2C, 0x52, 0xCD, 0x5A, 0x25, 0x2D, 0x34, 0x97, 0x12, 0xAF, 0x9D, 0x79, 0xD0, 0x21, 0x77,
+    0xA0, 0xBF, 0xB7, 0x0B, 0x28, 0x19, 0xE0, 0x60, 0xF2, 0xFC, 0x23, 0xA9, 0x18, 0x8F, 0xE3, 0x14,
+    0xA7, 0x12, 0xD5, 0x6C, 0xA5, 0x9B, 0x88, 0xE6, 0x47, 0xA7, 0xB4, 0x7E, 0x5A, 0x55, 0x29, 0xC7,
+    0xD3, 0x60, 0x42, 0x62, 0x0D, 0x12, 0x4F, 0x66, 0x3A, 0x70, 0x6B, 0x55, 0xDA, 0x1F, 0x31, 0x25,
+    0xCD, 0x7D, 0x66, 0x26, 0x30, 0x26, 0xF2, 0xCB, 0xB6, 0xBC, 0xC4, 0xE1, 0x1F, 0x59, 0x88, 0xFC,
+    0xA9, 0x01, 0xA8, 0x25, 0x40, 0xB3, 0x3D, 0xC2, 0x45, 0x0A, 0x52, 0x51, 0x5D, 0x01, 0x3D, 0xD6,
+    0xA7, 0x7E, 0x97, 0x0A, 0x15, 0x29, 0x1C, 0xBB, 0x14, 0x01, 0xBB, 0x94, 0x76, 0xCA, 0xAC, 0x56,
+    0x29, 0xE1, 0xE9, 0x26, 0x0F, 0x3F, 0x97, 0x16, 0xC5, 0x39, 0x3E, 0xBC, 0x71, 0xA0, 0x38, 0x60,
+    0xAE, 0x9F, 0x2C, 0x65, 0x09, 0x91, 0x11, 0x1D, 0x54, 0xCF, 0x73, 0xE8, 0x96, 0x9E, 0x02, 0x1D,
+    0xD4, 0x48, 0x41, 0xD9, 0xB2, 0xBC, 0xBA, 0x4C, 0x37, 0x28, 0x64, 0x04, 0x91, 0x31, 0x15, 0x7E,
+    0x15, 0x41, 0x47, 0x04, 0x1B, 0xF4, 0x40, 0x4D, 0xD1, 0xEA, 0x91, 0xC6, 0xD9, 0xA8, 0x47, 0xEA,
+    0x50, 0xC4, 0x4C, 0x68, 0xBC, 0x1D, 0x13, 0x3C, 0xB1, 0x60, 0x1C, 0x79, 0x58, 0xEB, 0xCF, 0x8A,
+    0x7F, 0xC2, 0xAE, 0x50, 0x4A, 0xB0, 0x3D, 0x79, 0x24, 0xEB, 0x49, 0x6C, 0x20, 0xA5, 0xC3, 0xB6,
+    0xE4, 0x91, 0xC4, 0xE9, 0x25, 0x6E, 0x44, 0x6D, 0x03, 0x56, 0x7A, 0x68, 0x64, 0x40, 0x07, 0x1D,
+    0xB1, 0xE4, 0x2D, 0x37, 0xB0, 0x4E, 0xB7, 0xEC, 0x60, 0xC9, 0x23, 0x3B, 0x34, 0x4E, 0xDF, 0x6D,
+    0x86, 0x64, 0x3E, 0x75, 0x6A, 0xD0, 0x8B, 0xD8, 0x6E, 0x62, 0x49, 0xF4, 0x48, 0x85, 0xED, 0xD4,
+    0x48, 0xED, 0x6C, 0xCC, 0x16, 0x54, 0xC1, 0x46, 0x25, 0xD4, 0xC1, 0x8C, 0xD9, 0x92, 0xEA, 0xE1,
+    0x49, 0xC9, 0xA7, 0xDD, 0xB4, 0x3D, 0xE7, 0x73, 0x17, 0x22, 0x8B, 0x39, 0x54, 0xAD, 0x1D, 0xA8,
+    0xAF, 0x00, 0xE8, 0xAF, 0x5E, 0xA3, 0x68, 0x02, 0x8D, 0xA0, 0x17, 0x0F, 0x04, 0x4B, 0x37, 0xF7,
+    0x29, 0x34, 0x49, 0x55, 0x9E, 0xE5, 0x23, 0x0B, 0x17, 0xB3, 0x45, 0x42, 0x09, 0xF5, 0x44, 0xB0,
+    0xB5, 0xAB, 0x58, 0x69, 0xB5, 0x77, 0xE7, 0xA0, 0xBF, 0x11, 0x41, 0x2F, 0x81, 0xBC, 0xBD, 0xBF,
+    0xFE, 0xE3, 0x67, 0xA5, 0x2D, 0xED, 0x8E, 0x72, 0xE1, 0x24, 0x66, 0x01, 0xE3, 0x64, 0x6B, 0x3F,
+    0xC1, 0xDC, 0x42, 0x6A, 0xCA, 0x4C, 0xB6, 0x71, 0x7D, 0x45, 0x64, 0xE8, 0xF0, 0xE3, 0xEA, 0x7C,
+    0x96, 0x6E, 0x2A, 0xF1, 0x69, 0x44, 0xA0, 0xBC, 0xC3, 0x93, 0x53, 0x36, 0x60, 0x77, 0x9F, 0xAE,
+    0x4A, 0xFC, 0xD4, 0x9D, 0x94, 0x1C, 0xF5, 0xF3, 0xAE, 0x73, 0x44, 0xC4, 0x83, 0xAA, 0x97, 0x00,
+    0x75, 0x04, 0x74, 0xA2, 0x91, 0x7A, 0x1C, 0x45, 0xAA, 0xED, 0x68, 0x8D, 0x88, 0x0C, 0x99, 0x4C,
+    0xA5, 0x88, 0x4B, 0x47, 0xB3, 0x9E, 0xA4, 0xC8, 0x42, 0x92, 0x33, 0x26, 0x06, 0xE6, 0xC6, 0x83,
+    0xA1, 0xC0, 0xD2, 0x67, 0xB2, 0xA0, 0x4C, 0xE9, 0x7A, 0x1D, 0x12, 0xEA, 0x2B, 0x16, 0x60, 0x84,
+    0xA9, 0xA7, 0x4B, 0xDD, 0xBD, 0xDA, 0x96, 0x22, 0x4A, 0xA4, 0x57, 0x4D, 0xA2, 0x20, 0x52, 0xB6,
+    0xF3, 0x16, 0x40, 0x91, 0xB2, 0x9D, 0xD7, 0x80, 0xCB, 0xF7, 0x65, 0x3B, 0x8F, 0xCB, 0xFB, 0x53,
+    0x7D, 0x97, 0x11, 0x89, 0x64, 0x72, 0x49, 0x4D, 0x6C, 0x56, 0xDE, 0xED, 0x0F, 0x3B, 0x00, 0x48,
+    0x6A, 0x5A, 0x1A, 0x98, 0xAA, 0xC2, 0x78, 0x55, 0x06, 0xE0, 0xE7, 0xA5, 0x03, 0x72, 0x59, 0x35,
+    0xC5, 0x19, 0x71, 0x87, 0x50, 0x29, 0xCD, 0xBD, 0xA0, 0x11, 0x11, 0x5F, 0x4A, 0xAA, 0x47, 0x95,
+    0xF7, 0x31, 0xEB, 0x85, 0x6F, 0xE7, 0xD3, 0x1A, 0xC8, 0x7E, 0xE0, 0xC8, 0x5F, 0xEF, 0x78, 0x22,
+    0x75, 0x10, 0x4F, 0xBB, 0xFA, 0x65, 0x4A, 0x69, 0xB9, 0xC9, 0xAA, 0x31, 0x93, 0xE5, 0x94, 0x89,
+    0x34, 0x32, 0x25, 0xB5, 0x0A, 0x9F, 0xDF, 0x6E, 0x5C, 0x29, 0x42, 0x2D, 0x0B, 0x8E, 0x4B, 0xF7,
+    0x21, 0x4C, 0x27, 0x34, 0xA9, 0x52, 0xC7, 0x03, 0x9C, 0x74, 0x00, 0x8F, 0x91, 0x0A, 0x6E, 0x41,
+    0xED, 0xAC, 0x66, 0x21, 0x93, 0xCB, 0x34, 0xE2, 0x4C, 0x9B, 0x68, 0xB5, 0x98, 0x80, 0x75, 0x2E,
+    0x2E, 0x55, 0x30, 0x97, 0x1E, 0x76, 0xD9, 0x7D, 0xBB, 0x37, 0x22, 0xA1, 0x96, 0x05, 0xAF, 0x8A,
+    0x27, 0x73, 0x09, 0x49, 0x5F, 0x99, 0x8C, 0xFB, 0x35, 0x68, 0xDC, 0x2A, 0xB1, 0x06, 0x70, 0x56,
+    0xB5, 0x40, 0xEC, 0x99, 0x8A, 0xBE, 0x53, 0x78, 0xF7, 0xE8, 0x22, 0xC7, 0x0F, 0xD9, 0xDC, 0x7F,
+    0x85, 0x4B, 0xC4, 0xD3, 0xF0, 0xC3, 0x90, 0xBA, 0x01, 0xC2, 0x3F, 0x89, 0xB9, 0x17, 0x22, 0x32,
+    0x96, 0x22, 0x32, 0x56, 0xCB, 0xE5, 0xD5, 0x61, 0x12, 0x7F, 0x98, 0x8B, 0x11, 0x74, 0x3F, 0x53,
+    0xAB, 0xF9, 0x8A, 0x17, 0xB4, 0xED, 0xCC, 0xAC, 0x96, 0x61, 0x26, 0x70, 0x6B, 0x37, 0xF3, 0xB9,
+    0xC2, 0x94, 0xFB, 0xCB, 0x56, 0xD5, 0xE4, 0x89, 0x03, 0xFA, 0x04, 0xC0, 0x6F, 0xAE, 0x54, 0xFC,
+    0xB9, 0x55, 0xE1, 0x1C, 0x70, 0x0A, 0xDD, 0x51, 0x38, 0xF6, 0xF8, 0xE2, 0xDD, 0x3F, 0x14, 0x71,
+    0x7B, 0xE8, 0x98, 0xFE, 0xD7, 0x91, 0xC2, 0x73, 0x13, 0x1D, 0xB1, 0xDF, 0xA6, 0x59, 0x68, 0xE9,
+    0x8D, 0xB4, 0xEA, 0x7D, 0xF8, 0x24, 0xAA, 0x55, 0x09, 0x19, 0x1A, 0x9E, 0x99, 0x6B, 0x12, 0xEE,
+    0xF9, 0xD9, 0x68, 0xCE, 0x3E, 0x58, 0x8F, 0xFD, 0x33, 0x1B, 0x2B, 0xAA, 0x83, 0xD3, 0xA0, 0x03,
+    0xD7, 0x76, 0xD8, 0xB2, 0x2E, 0x6F, 0xCF, 0xB1, 0x87, 0xBA, 0x7A, 0xDB, 0xD5, 0xD2, 0xCF, 0x6C,
+    0xCE, 0xC5, 0xC4, 0x2B, 0x8C, 0x50, 0x78, 0xB2, 0x3E, 0xD1, 0x41, 0x1F, 0x38, 0x9A, 0x05, 0x56,
+    0x5A, 0x9A, 0xC5, 0x8F, 0x17, 0x39, 0xAE, 0x44, 0xEE, 0xE0, 0xC8, 0xD5, 0xBB, 0x3E, 0x15, 0x2F,
+    0x14, 0x22, 0xFE, 0x1F, 0x2B, 0x72, 0x22, 0x30, 0xB6, 0xA0, 0x70, 0x98, 0xC0, 0x17, 0xEF, 0x5E,
+    0xAA, 0xA5, 0x67, 0x0F, 0x2A, 0x8E, 0x5E, 0xBD, 0xFD, 0xCB, 0x22, 0xEF, 0x8A, 0x44, 0x06, 0xB8,
+    0x09, 0x15, 0xD8, 0x6F, 0x63, 0xA4, 0xD5, 0xD2, 0xD3, 0xEC, 0xB3, 0x7F, 0x7A, 0x38, 0x01, 0x9C,
+    0x3E, 0x7F, 0x0D, 0xE8, 0x1A, 0x40, 0xBB, 0x87, 0x45, 0x6F, 0x87, 0xCF, 0x71, 0xF8, 0x25, 0x6A,
+    0x4F, 0xD5, 0x66, 0x0B, 0xD2, 0x23, 0x13, 0xF2, 0x81, 0xCA, 0x53, 0xB6, 0x6A, 0x31, 0xB5, 0x61,
+    0xEA, 0x91, 0x2A, 0x60, 0x5B, 0x16, 0xAB, 0x14, 0x25, 0x65, 0xC0, 0x76, 0xDC, 0x82, 0xCA, 0xE9,
+    0x7E, 0x2A, 0x1D, 0x34, 0x1D, 0x35, 0x54, 0x2E, 0x1B, 0xC9, 0x46, 0x6C, 0x4F, 0xD9, 0x51, 0x2D,
+    0xAF, 0x0A, 0xA9, 0x60, 0x54, 0x8B, 0x48, 0x20, 0x17, 0x59, 0xCC, 0x8B, 0xF0, 0x40, 0x5D, 0x48,
+    0xAB, 0xDE, 0xFD, 0x1D, 0x6C, 0xDE, 0xF3, 0xEC, 0x81, 0x10, 0x43, 0x07, 0x86, 0x02, 0xDD, 0xEE,
+    0x51, 0xEA, 0x8E, 0xD1, 0x3A, 0xDD, 0xED, 0x50, 0xBC, 0x10, 0xD9, 0x33, 0x41, 0xC7, 0x2D, 0x4A,
+    0x3F, 0x66, 0x4B, 0x2D, 0xD2, 0x5B, 0x91, 0x50, 0x89, 0x50, 0x2F, 0x86, 0x03, 0x55, 0x0D, 0x66,
+    0xAA, 0x0A, 0xFC, 0xCA, 0xA3, 0x9C, 0x49, 0x3E, 0xA0, 0x17, 0x94, 0xED, 0x94, 0x1F, 0xAE, 0x82,
+    0x1E, 0x50, 0x0B, 0x8A, 0x16, 0x13, 0x69, 0x48, 0x19, 0x55, 0x96, 0x13, 0x45, 0x5E, 0x41, 0x19,
+    0x52, 0x61, 0xAF, 0xD9, 0xCF, 0x45, 0x33, 0xC2, 0x2D, 0xF2, 0x88, 0xEE, 0x29, 0x03, 0x65, 0x40,
+    0x5C, 0xB6, 0x44, 0xCB, 0x6D, 0x89, 0x53, 0xBD, 0x70, 0x25, 0x32, 0x42, 0x2D, 0xD2, 0x42, 0x2D,
+    0xEB, 0xE1, 0xDF, 0x21, 0x4A, 0x19, 0x69, 0x0E, 0x4A, 0xA8, 0x43, 0x2A, 0xA4, 0x37, 0x21, 0x8B,
+    0xD6, 0xEB, 0x68, 0x9D, 0xEE, 0x0A, 0xF2, 0xB6, 0xC0, 0x84, 0x12, 0x1B, 0xB6, 0x28, 0x7D, 0x45,
+    0xE3, 0xAB, 0xF4, 0xEC, 0x07, 0x2A, 0x11, 0x0A, 0xD9, 0x9D, 0xFC, 0x6A, 0x0A, 0xA7, 0x2C, 0xCF,
+    0x00, 0x5B, 0x2F, 0x77, 0x4C, 0x29, 0x0A, 0xEA, 0x4B, 0x8F, 0xF4, 0xA9, 0x4F, 0x3B, 0x0E, 0x3B,
+    0xB5, 0x04, 0x71, 0xA6, 0x9F, 0xE6, 0xBC, 0x88, 0x2C, 0xA1, 0x76, 0x79, 0x3F, 0xCF, 0x79, 0x52,
+    0x91, 0x4F, 0x73, 0x5E, 0x04, 0x4C, 0xA4, 0x86, 0xCA, 0x67, 0x03, 0x2C, 0x26, 0x40, 0x53, 0x41,
+    0xE9, 0xD5, 0x48, 0x62, 0x9E, 0x4D, 0xA4, 0x6A, 0x69, 0x3C, 0x72, 0xB7, 0x19, 0xD1, 0x22, 0xD2,
+    0x61, 0xE7, 0xB2, 0xE9, 0x1E, 0x8E, 0xCB, 0x7E, 0x55, 0xE2, 0x29, 0x4E, 0xB0, 0xC1, 0x59, 0xCA,
+    0x97, 0x23, 0x56, 0xC2, 0x7A, 0x53, 0xE4, 0x3F, 0x8D, 0x5E, 0x26, 0x12, 0xF6, 0xEC, 0x27, 0x00,
+    0xF5, 0x8E, 0x07, 0xF4, 0x7F, 0xBD, 0xAF, 0x95, 0xF5, 0xA3, 0xA8, 0x17, 0x0A, 0x47, 0xF6, 0x25,
+    0x78, 0xFC, 0x71, 0xF8, 0x97, 0xDD, 0xDC, 0xC7, 0xB5, 0x9E, 0x6F, 0x45, 0x77, 0x3B, 0xD8, 0x17,
+    0x23, 0x7B, 0xD6, 0xEB, 0xB8, 0x89, 0x7D, 0x3D, 0x72, 0x31, 0x0F, 0x59, 0x2C, 0xB1, 0x61, 0xE0,
+    0x96, 0x8E, 0x66, 0xB0, 0x22, 0x6D, 0x25, 0x82, 0xC8, 0xA8, 0xE4, 0x87, 0x5D, 0xAA, 0x96, 0x52,
+    0x8E, 0xC3, 0x60, 0x02, 0x17, 0xA1, 0x74, 0x6A, 0x80, 0x9B, 0x3F, 0x2A, 0x9A, 0x3C, 0xEC, 0x50,
+    0xE7, 0x28, 0x3A, 0x6C, 0x3F, 0x2D, 0x99, 0x54, 0x58, 0x51, 0x79, 0x8A, 0x96, 0xDA, 0x51, 0x86,
+    0xB4, 0x66, 0x92, 0x3E, 0x58, 0x42, 0x4D, 0xAA, 0xD4, 0x48, 0x8B, 0x26, 0x29, 0x24, 0xE9, 0x49,
+    0x47, 0xB2, 0x61, 0x5A, 0x35, 0x49, 0x23, 0xC9, 0x69, 0x58, 0x79, 0x5B, 0xC2, 0xB4, 0x6C, 0x92,
+    0x4A, 0x92, 0xD7, 0x50, 0xCD, 0x5A, 0x8B, 0xD3, 0xD3, 0x70, 0x4E, 0xF5, 0x58, 0x5F, 0x78, 0x35,
+    0x64, 0x03, 0x45, 0x38, 0x04, 0xEE, 0x21, 0xD6, 0x42, 0x81, 0x6E, 0xD9, 0x4B, 0xCF, 0x78, 0x19,
+    0xB1, 0x4E, 0x77, 0xEC, 0x50, 0x38, 0x15, 0xD9, 0x4B, 0x2D, 0x31, 0x5B, 0x94, 0x9E, 0x31, 0x5B,
+    0xA2, 0xA7, 0x58, 0x36, 0x50, 0x89, 0x40, 0xBD, 0x18, 0xE6, 0x32, 0x96, 0x34, 0xEE, 0x83, 0x8E,
+    0x52, 0x8F, 0x69, 0xD8, 0xF7, 0x3B, 0xCA, 0x2E, 0x8D, 0x3A, 0x39, 0xCA, 0xE2, 0x9F, 0xC6, 0x51,
+    0x76, 0xFB, 0xE4, 0x76, 0x2A, 0x9C, 0x49, 0xC6, 0xF1, 0xAB, 0x3F, 0xB1, 0x87, 0x3C, 0x06, 0xAA,
+    0x4D, 0x80, 0xEC, 0xDA, 0x94, 0x38, 0xF8, 0xD5, 0x7D, 0xEA, 0x7C, 0xEE, 0x8B, 0xBE, 0x17, 0x52,
+    0x55, 0xDF, 0xF5, 0xD4, 0x8C, 0x72, 0x6C, 0xDF, 0xE0, 0x02, 0xC0, 0xAD, 0xC4, 0xDA, 0x8D, 0x45,
+    0x00, 0x74, 0xEA, 0x18, 0xCF, 0xE3, 0x94, 0x0A, 0x2E, 0x52, 0x6A, 0xB5, 0x0C, 0xD9, 0x40, 0xE5,
+    0xCA, 0x90, 0x0F, 0xD4, 0x94, 0xC1, 0x8E, 0x2C, 0x28, 0x43, 0x35, 0x66, 0x23, 0xA5, 0x97, 0x85,
+    0xEE, 0xA9, 0xDE, 0x58, 0x2C, 0x4D, 0xA4, 0xFA, 0xED, 0x51, 0x6C, 0x4B, 0xF5, 0xBB, 0x51, 0xCA,
+    0x40, 0xD5, 0xB4, 0x4D, 0xED, 0xA8, 0x24, 0x34, 0x02, 0x95, 0xD0, 0x2C, 0xA0, 0x5A, 0x50, 0x8F,
+    0x50, 0x0D, 0xD4, 0x3D, 0x54, 0x91, 0x2A, 0x42, 0xDD, 0xA6, 0x32, 0x2C, 0x9E, 0xDF, 0x4F, 0x1C,
+    0xFB, 0x87, 0x26, 0x8E, 0x2B, 0x60, 0xAC, 0x20, 0xEB, 0xB7, 0x40, 0xC7, 0x2D, 0x30, 0xED, 0x96,
+    0x8A, 0x36, 0x6C, 0xE5, 0x7D, 0xE9, 0x76, 0x8B, 0xB1, 0x62, 0xB7, 0x5E, 0xDC, 0xA4, 0x16, 0x19,
+    0x52, 0xDD, 0x72, 0x7D, 0x47, 0x3A, 0xEA, 0x28, 0x81, 0x3A, 0x34, 0x9E, 0x3A, 0x91, 0xE9, 0x71,
+    0xC2, 0x22, 0xFA, 0x07, 0x40, 0x3C, 0x0D, 0x27, 0xF8, 0xE4, 0x81, 0x52, 0xA6, 0x9B, 0x95, 0xA3,
+    0x78, 0x63, 0x48, 0xCA, 0x18, 0xD5, 0x48, 0xE5, 0x6C, 0x6B, 0x3B, 0x24, 0x1B, 0x31, 0xB1, 0x86,
+    0xFA, 0x95, 0x36, 0x65, 0xC1, 0x2B, 0x01, 0x2D, 0x21, 0x25, 0x77, 0xF6, 0x4B, 0xB5, 0xC6, 0xB9,
+    0x80, 0xAB, 0x87, 0x4C, 0x80, 0x2A, 0xCE, 0xAC, 0x64, 0x8A, 0x8A, 0x4A, 0x37, 0x61, 0x2C, 0x9B,
+    0x07, 0xB8, 0xA6, 0xC2, 0xC3, 0x7A, 0x10, 0x07, 0xAC, 0xCB, 0x22, 0x7B, 0xE4, 0x6D, 0xDE, 0xA6,
+    0x16, 0xC4, 0x4A, 0xF5, 0x70, 0xD3, 0x06, 0xD4, 0x70, 0x73, 0xEA, 0x40, 0xB4, 0xE2, 0x26, 0xAE,
+    0xB3, 0x6E, 0xA7, 0xBA, 0xDA, 0xBC, 0x9F, 0xC2, 0xFB, 0x24, 0x48, 0x0B, 0x89, 0x3E, 0x6A, 0xF7,
+    0x93, 0x50, 0xAB, 0xBE, 0xD8, 0xAC, 0xC7, 0xB6, 0x15, 0x6A, 0x34, 0x91, 0x2A, 0x3C, 0xA4, 0xB0,
+    0xFA, 0xFF, 0xBB, 0x42, 0xE6, 0x78, 0x3B, 0x75, 0xD9, 0xA6, 0xF6, 0xF6, 0x94, 0x6B, 0xFA, 0xD1,
+    0x9D, 0x63, 0x95, 0xC8, 0xE4, 0x67, 0x3A, 0x32, 0x11, 0x89, 0xF0, 0x85, 0x2B, 0x57, 0x47, 0xE6,
+    0x36, 0x49, 0xEC, 0xC8, 0xDC, 0x2D, 0x38, 0x31, 0xB6, 0x55, 0x22, 0x25, 0xFB, 0xFD, 0xDF, 0x4D,
+    0xEA, 0x11, 0x8A, 0x4C, 0x89, 0x7F, 0xB2, 0xE9, 0x77, 0xCB, 0x54, 0x31, 0x82, 0x16, 0x11, 0xF1,
+    0x88, 0x88, 0x74, 0xD4, 0xAB, 0xFA, 0xB4, 0xE5, 0x4A, 0xF4, 0x63, 0x93, 0xF0, 0xC6, 0x3F, 0x5C,
+    0x64, 0x2D, 0x53, 0x27, 0xE5, 0xF6, 0x67, 0x87, 0x29, 0xE4, 0xEA, 0x13, 0x38, 0x36, 0x71, 0x8A,
+    0x2D, 0xDA, 0xF4, 0x5C, 0x81, 0x2A, 0xE5, 0x66, 0xB1, 0x29, 0x88, 0x59, 0x87, 0x19, 0xE3, 0x5A,
+    0xDA, 0x2E, 0x75, 0x68, 0x16, 0x8F, 0xE0, 0x5D, 0x44, 0x44, 0xE6, 0x27, 0x1A, 0x18, 0x11, 0x09,
+    0xA8, 0x2B, 0x57, 0xD2, 0x38, 0xCB, 0xC8, 0xA4, 0xFB, 0x29, 0x78, 0x9A, 0xAA, 0x4D, 0x52, 0xD8,
+    0x9A, 0xD2, 0xB6, 0xD2, 0x32, 0x75, 0xB4, 0xA6, 0x89, 0x24, 0x17, 0x0F, 0x53, 0x57, 0x5B, 0x7A,
+    0x66, 0x83, 0x9D, 0x7E, 0x8B, 0x2C, 0x27, 0xED, 0x28, 0x59, 0x95, 0xB4, 0x0D, 0xB3, 0xD1, 0xA8,
+    0x71, 0x0E, 0x98, 0x1F, 0x12, 0x0A, 0xDA, 0xD4, 0x68, 0x13, 0xD4, 0xF6, 0x2B, 0xDD, 0xBE, 0x0E,
+    0xD6, 0x1E, 0x1A, 0x43, 0xED, 0x52, 0x11, 0x4F, 0xC2, 0x7F, 0x23, 0x95, 0x88, 0x2B, 0x53, 0x73,
+    0x8C, 0x4A, 0x19, 0x93, 0x2E, 0x77, 0x80, 0x2D, 0x98, 0xB1, 0xF8, 0xD4, 0xF2, 0x30, 0x37, 0x37,
+    0x7E, 0x14, 0x2D, 0xE6, 0x08, 0x47, 0x21, 0x9E, 0x04, 0x7B, 0x71, 0xD2, 0xD0, 0xC3, 0x5A, 0xC1,
+    0x7E, 0x2A, 0x8B, 0x29, 0x3D, 0xC5, 0x88, 0xEE, 0x1C, 0x03, 0x14, 0x29, 0x23, 0x39, 0x25, 0xC2,
+    0xF7, 0x52, 0x8E, 0x76, 0x3F, 0x11, 0xBE, 0x95, 0x48, 0xB7, 0x3D, 0xB0, 0x01, 0x35, 0x40, 0x99,
+    0xCA, 0xF9, 0x36, 0xB9, 0xC8, 0x4D, 0x3E, 0xBF, 0x7A, 0x88, 0x54, 0x87, 0x69, 0xD9, 0xED, 0xB4,
+    0x8F, 0xCF, 0xF2, 0x9A, 0xF5, 0xFF, 0xE5, 0xAF, 0x9E, 0x38, 0xFF, 0xDF, 0xBE, 0xAE, 0x07, 0x0E,
+    0x3F, 0x58, 0x2D, 0x97, 0x35, 0x22, 0xDF, 0xB8, 0x7B, 0xE5, 0xCA, 0xB9, 0xB3, 0x3C, 0x1B, 0xD5,
+    0xBB, 0xDF, 0xDB, 0xCD, 0xA5, 0xCB, 0xEF, 0x80, 0x7E, 0x6F, 0x58, 0x34, 0x8E, 0x83, 0x8F, 0xEA,
+    0x2A, 0x5F, 0x3F, 0x96, 0xB5, 0xF1, 0xE7, 0xC8, 0xBB, 0xD7, 0xFE, 0xEC, 0xD3, 0xC7, 0x6E, 0x58,
+    0xAF, 0x7A, 0xEC, 0xEB, 0x03, 0xF6, 0x9D, 0x11, 0xFB, 0xCE, 0x5B, 0x1C, 0x75, 0xAF, 0x71, 0xF9,
+    0xFA, 0x49, 0xEE, 0xB5, 0x8C, 0x64, 0x81, 0xAD, 0xC9, 0x2F, 0x86, 0xBC, 0xA3, 0xE2, 0xE3, 0x9E,
+    0x5F, 0xDB, 0x76, 0x55, 0x28, 0x5B, 0xDB, 0xE5, 0x51, 0x8F, 0x2C, 0x20, 0x5B, 0xEA, 0x31, 0xEF,
+    0x4D, 0xB4, 0x6D, 0x15, 0x6A, 0xD7, 0xF8, 0x2A, 0x14, 0xD3, 0xA7, 0x6A, 0x41, 0x7B, 0xA2, 0x7A,
+    0xE7, 0x82, 0x76, 0x5C, 0x3E, 0xA1, 0x87, 0xFE, 0x14, 0x94, 0x57, 0xCE, 0x89, 0xB4, 0xE9, 0xE9,
+    0x4B, 0x59, 0x87, 0x71, 0xCA, 0x5F, 0x7B, 0xFE, 0xC2, 0x59, 0x38, 0xFA, 0xC9, 0x33, 0x67, 0x39,
+    0x44, 0xFB, 0x9F, 0xCD, 0x70, 0x24, 0xBC, 0x95, 0x8F, 0xC7, 0x7C, 0x7B, 0x88, 0x8C, 0x33, 0xA5,
+    0xBF, 0xF4, 0x73, 0x89, 0xB4, 0x5A, 0x56, 0xF2, 0xC7, 0x80, 0xFD, 0xFA, 0xDF, 0xDC, 0x59, 0x4C,
+    0x4D, 0x21, 0xA6, 0x5D, 0xE8, 0x58, 0x67, 0x63, 0x15, 0x64, 0x7F, 0x40, 0x6C, 0xEB, 0x85, 0x1E,
+    0x4D, 0x6F, 0x63, 0xD1, 0x56, 0xA1, 0x71, 0xF7, 0x3D, 0xE0, 0x2A, 0x77, 0xD7, 0x73, 0xCE, 0xD2,
+    0xF0, 0x31, 0x32, 0xBF, 0x63, 0x7C, 0x5F, 0xE8, 0x6E, 0x93, 0x42, 0x7E, 0xE7, 0x0F, 0xDE, 0xF5,
+    0xD7, 0xDA, 0x67, 0x5F, 0xE3, 0xD2, 0xB5, 0xD3, 0xDC, 0x0B, 0x6A, 0x44, 0x07, 0xB4, 0xA7, 0xF0,
+    0xDC, 0x0B, 0xE6, 0xC5, 0xF0, 0x9A, 0x6A, 0x0F, 0x4C, 0xC3, 0xFC, 0x08, 0xB2, 0xC3, 0x57, 0x62,
+    0x93, 0x9E, 0xF5, 0xB3, 0xFE, 0xE9, 0xFE, 0x63, 0xCC, 0x5E, 0x7B, 0xFC, 0xB1, 0x13, 0x9C, 0xCD,
+    0xB3, 0x70, 0xFE, 0xE4, 0xE7, 0xBC, 0x8C, 0x56, 0x7E, 0x8B, 0x6F, 0xBA, 0x33, 0xE1, 0xC4, 0x99,
+    0xA3, 0x85, 0x38, 0x30, 0xFF, 0x41, 0x3F, 0xF1, 0xEF, 0xFE, 0xF5, 0x27, 0xBF, 0xFA, 0xF8, 0x27,
+    0xBE, 0xC4, 0xD1, 0x4F, 0x58, 0x9E, 0xD7, 0xD7, 0xCE, 0x1C, 0xBC, 0xD1, 0x53, 0xC6, 0xBF, 0x76,
+    0xFD, 0xC9, 0x04, 0x35, 0x2E, 0x40, 0x44, 0xB7, 0x93, 0xB7, 0x3E, 0x38, 0xB3, 0x4F, 0x6F, 0x5B,
+    0xF9, 0x9A, 0x7B, 0x2F, 0x3C, 0x7F, 0x2E, 0x21, 0xD1, 0x4F, 0xC9, 0x22, 0x97, 0xBB, 0x97, 0x0E,
+    0xB4, 0xBD, 0xEB, 0xA9, 0xA9, 0xCA, 0xBA, 0x1B, 0x1B, 0xFA, 0x1B, 0xB1, 0xB0, 0xFE, 0xC6, 0xA6,
+    0xFE, 0x66, 0x2C, 0x8E, 0xB8, 0x5F, 0x03, 0x2A, 0xA9, 0x96, 0x6C, 0xB2, 0x93, 0x4A, 0x32, 0x0E,
+    0xC1, 0x53, 0x70, 0x06, 0x02, 0xCA, 0xDB, 0x2F, 0x5D, 0xDE, 0xFC, 0xAB, 0xF6, 0xFC, 0x9F, 0x86,
+    0x6B, 0x95, 0x3F, 0xF7, 0x26, 0x2A, 0xA0, 0xE1, 0x31, 0x56, 0xE4, 0x5D, 0x2A, 0x18, 0xC8, 0xDB,
+    0x15, 0xD6, 0x39, 0x2E, 0x9E, 0x51, 0x2D, 0x5F, 0x69, 0xB3, 0x3E, 0xEF, 0xB3, 0xDE, 0x74, 0xB6,
+    0xA5, 0x11, 0x6F, 0x3D, 0x87, 0x5F, 0x9A, 0xCA, 0x16, 0xD2, 0x13, 0x66, 0xD6, 0x62, 0x4F, 0xB3,
+    0xE0, 0xAC, 0x8E, 0xD7, 0xAD, 0xDB, 0xD3, 0x7F, 0xDB, 0x1D, 0x71, 0x6B, 0x0F, 0x6B, 0xA1, 0x6C,
+    0x33, 0x57, 0x7C, 0xD9, 0xED, 0xE8, 0x76, 0xB3, 0x70, 0x7B, 0x48, 0x3B, 0x97, 0x9A, 0xFF, 0x33,
+    0xB8, 0xBE, 0x9F, 0x3D, 0x3A, 0x04, 0xBF, 0x0E, 0x87, 0x3E, 0x76, 0xFA, 0xF1, 0xF4, 0xFF, 0xE3,
+    0x80, 0x7A, 0x27, 0x40, 0x1E, 0x8E, 0x39, 0x5E, 0x75, 0x7C, 0x51, 0xDE, 0x22, 0x75, 0x13, 0xA8,
+    0xF7, 0x39, 0xD2, 0x2B, 0x0F, 0x59, 0x08, 0xC0, 0x89, 0x35, 0x67, 0x90, 0x50, 0xF1, 0x45, 0x2D,
+    0x22, 0x22, 0xF1, 0xCA, 0x95, 0x2B, 0x57, 0xAE, 0x76, 0x00, 0x7A, 0x1F, 0x2E, 0x9F, 0x3C, 0xD0,
+    0x22, 0x65, 0xEE, 0xDB, 0x83, 0x94, 0xC8, 0x48, 0x29, 0x12, 0x74, 0x37, 0xD5, 0x6B, 0xE4, 0x61,
+    0x3A, 0x7F, 0xEA, 0xE6, 0x1B, 0x29, 0x44, 0x7C, 0xF6, 0xE0, 0xC7, 0x7E, 0x6A, 0xF6, 0x2B, 0x44,
+    0xDA, 0x6C, 0xF2, 0x63, 0xE9, 0xEA, 0xEE, 0xAA, 0xC8, 0x58, 0x89, 0x5C, 0xF1, 0xFB, 0x67, 0xF6,
+    0x53, 0x3E, 0x3B, 0x8B, 0x93, 0x2B, 0xCE, 0xFF, 0xE7, 0x9F, 0x42, 0x23, 0x23, 0xF6, 0x4E, 0xDE,
+    0xA5, 0xC7, 0xCD, 0x39, 0x62, 0x16, 0xB1, 0x6C, 0xA1, 0xA2, 0x6E, 0x79, 0x8E, 0x3D, 0xF2, 0xD6,
+    0x86, 0x23, 0x23, 0x63, 0x26, 0x14, 0xBE, 0x72, 0xFC, 0x3F, 0xBD, 0xBC, 0x5F, 0x8C, 0x1F, 0xD7,
+    0x95, 0xE7, 0xF7, 0xB9, 0xF7, 0x8A, 0xAC, 0x91, 0xCB, 0xE2, 0xD5, 0x83, 0x35, 0x6B, 0x0F, 0x45,
+    0x96, 0x11, 0x18, 0x01, 0x33, 0xDB, 0x64, 0x39, 0x00, 0x1F, 0xB8, 0x8B, 0x5F, 0xF7, 0xBD, 0xB2,
+    0x80, 0x28, 0x80, 0x02, 0x88, 0x03, 0x88, 0x76, 0x10, 0x03, 0xB1, 0x1F, 0xFC, 0x30, 0xEB, 0x64,
+    0x87, 0x7C, 0x10, 0x16, 0x5C, 0x6C, 0x37, 0xAB, 0x6C, 0x23, 0x50, 0x80, 0x04, 0x10, 0x07, 0x18,
+    0x65, 0x81, 0x45, 0x00, 0x2B, 0x0B, 0x1B, 0xB0, 0xDB, 0xC0, 0x92, 0x08, 0x08, 0x84, 0xBB, 0x69,
+    0x76, 0x5D, 0x4A, 0xC0, 0x0A, 0x81, 0x1F, 0x5C, 0xB6, 0xE1, 0xCC, 0xC3, 0x2C, 0xA0, 0xF2, 0x48,
+    0xDE, 0x99, 0xB5, 0xB0, 0xCB, 0x6B, 0xAB, 0x64, 0x55, 0x53, 0x55, 0x75, 0xF2, 0x70, 0xEB, 0xD7,
+    0x6C, 0x52, 0x23, 0x7B, 0x83, 0x09, 0xF2, 0x03, 0xC9, 0xEE, 0xAA, 0x1F, 0xAB, 0xEA, 0xFE, 0x3D,
+    0xE7, 0x7C, 0xBF, 0xE7, 0x7B, 0x0A, 0x50, 0x01, 0xB8, 0x0A, 0x58, 0xC0, 0xB4, 0xC0, 0x1E, 0xBF,
+    0xED, 0x23, 0x22, 0x58, 0x91, 0xA8, 0x23, 0xE0, 0x00, 0xD3, 0x01, 0xD7, 0x80, 0xBC, 0x05, 0x46,
+    0xA0, 0x08, 0xA0, 0x07, 0xC0, 0x79, 0x30, 0x11, 0xA8, 0x80, 0x3C, 0x02, 0x33, 0x50, 0xB4, 0xA0,
+    0x47, 0xC0, 0x05, 0x00, 0xF2, 0xD9, 0x83, 0x48, 0x47, 0xD6, 0xAB, 0x81, 0xA2, 0x66, 0x87, 0x2D,
+    0xD8, 0x62, 0x84, 0xA7, 0x54, 0x0F, 0xE8, 0xFB, 0xBB, 0xAF, 0x61, 0x44, 0x22, 0x99, 0x48, 0x47,
+    0x1E, 0x00, 0xFB, 0xE0, 0x9F, 0x48, 0x19, 0xAD, 0xDC, 0x93, 0xCE, 0x8A, 0x48, 0xC8, 0x45, 0xC4,
+    0x1B, 0x91, 0x09, 0x2E, 0xCB, 0xF5, 0x75, 0xAB, 0x55, 0x33, 0x7B, 0xB4, 0x48, 0x0F, 0x8D, 0x08,
+    0x94, 0x07, 0x3C, 0x89, 0x19, 0x58, 0x9A, 0x9E, 0xEE, 0xC4, 0x08, 0x60, 0x0F, 0x00, 0x1A, 0xA9,
+    0x41, 0x8B, 0x04, 0x38, 0x2E, 0x52, 0x83, 0xAA, 0x66, 0x80, 0x2A, 0x02, 0x46, 0x3C, 0xD0, 0xF4,
+    0x78, 0x0A, 0xA1, 0x14, 0x91, 0x36, 0x17, 0x91, 0x41, 0x8B, 0xC8, 0x4C, 0x25, 0x32, 0x7B, 0x1A,
+    0x39, 0x38, 0x1C, 0x33, 0xDB, 0xAA, 0x91, 0x32, 0xE8, 0x01, 0xE7, 0x4D, 0xA4, 0x22, 0xEF, 0x18,
+    0x29, 0x96, 0x13, 0x3D, 0x15, 0x79, 0x64, 0xA6, 0x68, 0xF5, 0x84, 0x0B, 0xD9, 0x48, 0x53, 0xC3,
+    0x96, 0xEA, 0xF5, 0x60, 0x5B, 0xDB, 0x56, 0x34, 0xCF, 0x8E, 0x7F, 0xD3, 0x54, 0x38, 0x8F, 0x1A,
+    0xD3, 0xC0, 0x96, 0x35, 0x4C, 0x69, 0xB0, 0x8B, 0x00, 0xFB, 0x0F, 0xFF, 0xDA, 0x83, 0x6D, 0xA1,
+    0x4A, 0xE3, 0x6E, 0x3B, 0xA8, 0x3C, 0x7A, 0x02, 0x1B, 0xA1, 0x0A, 0xE8, 0x39, 0xDD, 0xB0, 0x08,
+    0xEB, 0x99, 0xA9, 0xD3, 0x55, 0x34, 0xA4, 0xFF, 0xCF, 0xF4, 0xE8, 0xBC, 0x66, 0x11, 0xD8, 0x27,
+    0xDD, 0x99, 0x11, 0x28, 0xC3, 0x72, 0x91, 0xE3, 0xE8, 0xD7, 0xEB, 0x7B, 0x56, 0x9E, 0xC7, 0x8A,
+    0x08, 0x32, 0x43, 0x21, 0x01, 0x2D, 0x11, 0x5C, 0x0F, 0x78, 0x00, 0x2A, 0x11, 0x40, 0xFF, 0xE2,
+    0xD2, 0x00, 0x58, 0x74, 0x0B, 0xAC, 0xB0, 0x80, 0xEA, 0xD8, 0x06, 0x72, 0x74, 0x97, 0xCE, 0x79,
+    0x50, 0x1D, 0x4E, 0x6A, 0x72, 0xAF, 0xEE, 0xDF, 0x68, 0x59, 0x91, 0xD7, 0x59, 0x50, 0x1D, 0x9B,
+    0x58, 0x72, 0x4F, 0x64, 0xC5, 0x8A, 0x3C, 0xA8, 0xA8, 0x3A, 0xB6, 0xB0, 0xB5, 0x85, 0xE1, 0xF7,
+    0x47, 0xF6, 0xC8, 0x44, 0xBA, 0xA2, 0xA5, 0x94, 0x99, 0x19, 0x44, 0xEA, 0xC3, 0xD1, 0x3C, 0x96,
+    0x16, 0x4A, 0xC4, 0x04, 0x38, 0x07, 0xB7, 0xC1, 0xB4, 0x58, 0x0F, 0x2B, 0x88, 0x90, 0x05, 0x0A,
+    0xE0, 0x36, 0xBA, 0x03, 0x0B, 0x9B, 0x69, 0x33, 0xC8, 0x5F, 0x53, 0x88, 0xCC, 0x3F, 0x88, 0xBA,
+    0xC5, 0xD6, 0x59, 0xBD, 0x82, 0x9E, 0x55, 0x16, 0x28, 0x30, 0xE1, 0x36, 0x3A, 0xB2, 0x6D, 0x3D,
+    0x5B, 0x14, 0x75, 0xC4, 0xB4, 0x5F, 0x89, 0x05, 0x54, 0x32, 0xE9, 0x0E, 0x2B, 0x52, 0x6F, 0x1E,
+    0x6D, 0x82, 0x15, 0x91, 0xB1, 0x14, 0x91, 0xD1, 0x89, 0xC8, 0xF0, 0x14, 0xD3, 0x7A, 0x4D, 0xAA,
+    0x01, 0xD0, 0x3D, 0xCB, 0x6E, 0xCA, 0x7E, 0xF5, 0x1D, 0xC8, 0x45, 0x6A, 0xAC, 0x48, 0x8B, 0x3D,
+    0xC8, 0x3A, 0xCA, 0xCE, 0x74, 0xB8, 0xA0, 0x5B, 0x5C, 0x6D, 0x5A, 0x2A, 0x6F, 0x02, 0x0D, 0x79,
+    0x40, 0xB0, 0xB5, 0x9A, 0x29, 0xBC, 0x9E, 0x28, 0xBD, 0x19, 0x71, 0x98, 0x91, 0x0A, 0x00, 0x13,
+    0x00, 0x6E, 0x01, 0x14, 0x0F, 0x8E, 0x6F, 0x7F, 0x74, 0xA5, 0xE9, 0xDE, 0x8C, 0xE0, 0x68, 0x20,
+    0x8B, 0x65, 0x80, 0x3B, 0x59, 0x04, 0x7B, 0x77, 0x02, 0x35, 0x56, 0x1E, 0xCA, 0x17, 0x3A, 0x30,
+    0xEF, 0x0D, 0x40, 0x35, 0x03, 0x56, 0x02, 0x20, 0x11, 0x28, 0x66, 0xC0, 0x48, 0x04, 0x9C, 0x04,
+    0xC8, 0x3F, 0x98, 0x81, 0xD9, 0xF5, 0x50, 0xDC, 0x95, 0x80, 0x1E, 0xED, 0x0C, 0xAE, 0x6E, 0x7A,
+    0xB2, 0x68, 0x24, 0xD0, 0x50, 0x0A, 0x80, 0xBA, 0x0E, 0x60, 0xEB, 0xC3, 0x4D, 0xAA, 0x87, 0x87,
+    0x1A, 0x65, 0x5B, 0x8E, 0x5D, 0x64, 0x44, 0xCD, 0x14, 0x01, 0xD7, 0xEA, 0x01, 0x3B, 0xE2, 0xBC,
+    0x96, 0x90, 0x45, 0x9A, 0x81, 0x86, 0x42, 0xBC, 0xED, 0xCC, 0x07, 0x91, 0x91, 0xA9, 0xA1, 0x08,
+    0xEE, 0x95, 0x4E, 0x0F, 0xF9, 0xAF, 0x26, 0xDC, 0x33, 0x63, 0x19, 0xB2, 0x58, 0x99, 0x91, 0xC6,
+    0xB6, 0x55, 0x6D, 0xDF, 0x1E, 0xF2, 0x9E, 0x69, 0x1F, 0xA1, 0xB8, 0x17, 0x8A, 0x4E, 0x4B, 0x34,
+    0x13, 0x6E, 0xC4, 0x85, 0x4C, 0x7C, 0x3E, 0xD2, 0x74, 0x48, 0x0D, 0x5C, 0xE7, 0x22, 0xC6, 0x67,
+    0x1E, 0xEB, 0xB7, 0x97, 0x0E, 0xB9, 0x01, 0x78, 0xEC, 0x23, 0x63, 0xB6, 0x47, 0x16, 0x54, 0x64,
+    0x0B, 0xD3, 0xAA, 0x88, 0xAD, 0x6D, 0x4D, 0xC9, 0x1E, 0xDC, 0x31, 0x1D, 0x6A, 0x28, 0xC1, 0xFC,
+    0x6A, 0x00, 0xFB, 0x56, 0x80, 0x72, 0x5E, 0x5B, 0x16, 0xA9, 0xC1, 0x8C, 0xEB, 0x4D, 0xD7, 0x00,
+    0x79, 0x0F, 0x4A, 0x6A, 0x8C, 0x8C, 0x60, 0xC5, 0x43, 0xD5, 0x1D, 0x5D, 0xB3, 0x9F, 0xA2, 0x84,
+    0x6D, 0x1C, 0x8C, 0x6C, 0xC1, 0xC0, 0x0E, 0xAA, 0x67, 0x0F, 0x1D, 0x19, 0x30, 0x1D, 0x7D, 0x7A,
+    0x7E, 0x16, 0x74, 0x24, 0x0F, 0xA6, 0xC3, 0xD6, 0x59, 0x8B, 0xF5, 0x79, 0xA0, 0xC0, 0x06, 0x4A,
+    0x6C, 0xCD, 0x16, 0xC5, 0xAB, 0x97, 0xEE, 0x50, 0x8A, 0x8C, 0x38, 0x91, 0x11, 0xB2, 0x1A, 0xC8,
+    0xFD, 0xE2, 0x17, 0xD2, 0x3F, 0x9F, 0x01, 0xE0, 0x0C, 0x50, 0xFA, 0x64, 0xEE, 0x4D, 0xFF, 0x37,
+    0x3B, 0x89, 0xA6, 0x26, 0xFF, 0x30, 0xE2, 0xFC, 0x05, 0x6E, 0xB3, 0xA1, 0x3B, 0xB6, 0xCD, 0x2F,
+    0x65, 0xCC, 0x45, 0x46, 0xFB, 0xAA, 0xC7, 0x02, 0x85, 0x4F, 0xF6, 0xC4, 0x1E, 0x7C, 0xB1, 0xCD,
+    0x45, 0x82, 0x16, 0x09, 0x5C, 0x3E, 0x48, 0x2E, 0xC8, 0x04, 0xC8, 0xBF, 0xF1, 0x22, 0x97, 0xA5,
+    0xA7, 0xF9, 0xAE, 0xE7, 0x1C, 0x69, 0xBB, 0xAD, 0x3E, 0xE3, 0xD9, 0x97, 0x88, 0xC8, 0xA0, 0xC4,
+    0x8F, 0x7A, 0x64, 0xDB, 0x44, 0xAE, 0x66, 0x1D, 0xB7, 0xF3, 0x40, 0x6F, 0x83, 0x8A, 0x45, 0xAD,
+    0x63, 0xE9, 0x4D, 0xE7, 0xC8, 0xDA, 0x0A, 0xDB, 0x36, 0xDC, 0x68, 0xD1, 0xD2, 0x61, 0xA4, 0x45,
+    0x89, 0x5F, 0x1A, 0xD8, 0x2D, 0x0F, 0xF1, 0x70, 0x1A, 0x58, 0x1D, 0x31, 0xAA, 0x32, 0x51, 0xC9,
+    0xC8, 0x08, 0x0C, 0xA0, 0xFA, 0xB4, 0xF3, 0x4C, 0x4C, 0x7F, 0xB3, 0x2E, 0xF5, 0xDC, 0xB6, 0xA9,
+    0xFD, 0x65, 0x48, 0xD6, 0x92, 0xE3, 0x33, 0xFA, 0x17, 0xDB, 0x44, 0xD5, 0x6E, 0xF0, 0x89, 0xAC,
+    0x86, 0x66, 0xC6, 0x4A, 0xA7, 0x3A, 0x38, 0x07, 0xFA, 0xE0, 0x4B, 0x7D, 0x29, 0x82, 0x48, 0xD0,
+    0x92, 0xE6, 0x4F, 0xCB, 0x6B, 0x34, 0xE2, 0xF3, 0x36, 0x3D, 0x3E, 0x82, 0x19, 0x20, 0x13, 0x8F,
+    0x96, 0x90, 0x2C, 0xFA, 0x35, 0xAE, 0xFD, 0xA0, 0xCF, 0x45, 0x42, 0x25, 0x13, 0x97, 0xA5, 0x06,
+    0x1B, 0xD4, 0x88, 0xAB, 0xB3, 0xA3, 0x3B, 0xE1, 0x16, 0x16, 0x22, 0xA7, 0xD1, 0x2D, 0x2B, 0xB2,
+    0xC0, 0x6D, 0xAC, 0x57, 0x91, 0x12, 0x13, 0xB9, 0x96, 0xDC, 0x32, 0x3A, 0xDA, 0x30, 0x66, 0xB1,
+    0x31, 0x83, 0xBB, 0x3B, 0x1F, 0xB9, 0xF8, 0x25, 0x58, 0x81, 0x85, 0xAC, 0x46, 0xB7, 0x10, 0x61,
+    0x1B, 0xCE, 0x81, 0xF5, 0x64, 0x01, 0x1D, 0x61, 0x84, 0x6B, 0x69, 0xCA, 0x17, 0xDB, 0x5E, 0x25,
+    0x47, 0xAE, 0xE6, 0x87, 0x27, 0x5D, 0x45, 0xD0, 0x5D, 0x9A, 0xC1, 0x2C, 0x40, 0x5E, 0x83, 0xF5,
+    0x69, 0xED, 0x9C, 0x5E, 0xCF, 0x20, 0xB0, 0xBD, 0xD8, 0x9C, 0xF8, 0xE0, 0x92, 0x2C, 0x40, 0x11,
+    0x38, 0x2E, 0x9E, 0x72, 0x06, 0xF7, 0xCE, 0xA1, 0x49, 0x6C, 0xD1, 0x3F, 0xFB, 0xEF, 0xE1, 0x82,
+    0x0E, 0x18, 0x7F, 0x01, 0xAE, 0x18, 0xCF, 0x27, 0xA8, 0x7A, 0xDA, 0x5C, 0xB5, 0x4F, 0xD3, 0x7D,
+    0x42, 0xD7, 0x4F, 0xF0, 0xDA, 0x79, 0xD5, 0x9E, 0xCA, 0x38, 0x7B, 0xF2, 0xF5, 0xCE, 0x48, 0xBF,
+    0x8D, 0x7B, 0xE0, 0x7A, 0x79, 0x82, 0x33, 0xE8, 0x60, 0x6A, 0x2E, 0x70, 0x1E, 0xE3, 0x33, 0xB8,
+    0xC2, 0x4D, 0x72, 0x91, 0x99, 0xF7, 0xBF, 0xD8, 0x6E, 0x3F, 0xC1, 0x86, 0xBA, 0x1B, 0x4C, 0x78,
+    0x7A, 0x83, 0x0B, 0xE6, 0x8D, 0x3A, 0xFB, 0x1F, 0xFA, 0xF3, 0x34, 0x92, 0xA5, 0x9D, 0x06, 0x7F,
+    0xCB, 0xF5, 0xC8, 0xD1, 0xF5, 0xD8, 0xA5, 0xF5, 0x68, 0x03, 0x70, 0x21, 0xF5, 0x5F, 0x2F, 0x43,
+    0x65, 0x39, 0xB2, 0xA5, 0x5F, 0xC4, 0xAA, 0x9E, 0x32, 0x6B, 0xD9, 0x2C, 0x3C, 0xDB, 0x3B, 0xF0,
+    0x2F, 0x7B, 0xF8, 0xB0, 0x45, 0x8B, 0xC7, 0x48, 0x5A, 0x23, 0xF9, 0xBD, 0x16, 0xFB, 0x4A, 0xA4,
+    0xCC, 0x47, 0x9C, 0x99, 0xD9, 0x51, 0xE2, 0x53, 0xA3, 0xB2, 0x6E, 0xF1, 0xBC, 0xC7, 0xAF, 0x3F,
+    0x6C, 0xC3, 0x3B, 0x2A, 0x7A, 0x5C, 0xBD, 0x62, 0xAB, 0x2D, 0xD8, 0x8C, 0x79, 0xBD, 0xB5, 0x32,
+    0xED, 0xB9, 0xD3, 0xC4, 0x73, 0xB9, 0xDF, 0x2E, 0x4C, 0x28, 0x0B, 0x15, 0xED, 0xB7, 0xD9, 0x33,
+    0x6F, 0xF9, 0x2D, 0x25, 0xBE, 0xF0, 0x4D, 0x9D, 0x07, 0x57, 0x9B, 0x08, 0x7C, 0x8E, 0x4F, 0x41,
+    0x47, 0x8B, 0x69, 0x0B, 0xC8, 0x25, 0x82, 0x9D, 0x01, 0xF5, 0xF1, 0x91, 0xA2, 0xF5, 0xEC, 0xB1,
+    0x85, 0x69, 0xD9, 0xA3, 0x44, 0xF5, 0xAA, 0xC7, 0x74, 0x36, 0x60, 0xC3, 0x0E, 0x94, 0xCF, 0x46,
+    0xB8, 0x56, 0x7A, 0x18, 0x47, 0x30, 0xD2, 0x42, 0x2E, 0x40, 0xD1, 0x03, 0x55, 0x00, 0x35, 0xA5,
+    0xD8, 0x0E, 0x04, 0x28, 0x7B, 0x70, 0x52, 0xA3, 0xA4, 0x87, 0x7C, 0x3A, 0x7C, 0xC6, 0x4D, 0x5E,
+    0x32, 0xC1, 0x84, 0x13, 0x58, 0x5E, 0xE2, 0xAA, 0x0E, 0xBA, 0xB5, 0x58, 0xAE, 0x72, 0x41, 0xB7,
+    0xAA, 0xB5, 0xE4, 0xAC, 0x58, 0xA9, 0x8E, 0x2E, 0x17, 0xF1, 0x4E, 0xC6, 0xB4, 0xF1, 0x3D, 0x3C,
+    0x0D, 0x5C, 0x04, 0x7A, 0x3E, 0xB1, 0xBF, 0xFB, 0xB2, 0xC8, 0x5F, 0x8A, 0xF4, 0xE6, 0x70, 0xF9,
+    0xBB, 0x57, 0xBD, 0x95, 0x31, 0xEB, 0xCD, 0xEB, 0x3D, 0x2F, 0x8D, 0x9C, 0x72, 0xE4, 0x36, 0xE4,
+    0x6F, 0x8A, 0xFC, 0x5C, 0x24, 0x3A, 0x19, 0x8C, 0x24, 0xBB, 0x77, 0xF5, 0xC8, 0x4E, 0xF9, 0xBB,
+    0xF7, 0xBF, 0x6F, 0x45, 0xD8, 0x81, 0x02, 0xF2, 0x83, 0x8B, 0x46, 0xC4, 0x4F, 0xDC, 0xBC, 0xC6,
+    0x89, 0x12, 0xF3, 0x4A, 0xD0, 0x3F, 0xED, 0xFF, 0x4E, 0x14, 0x19, 0x9C, 0x4C, 0x56, 0x66, 0x9E,
+    0x7A, 0x11, 0x8C, 0x88, 0x88, 0x57, 0x22, 0x22, 0x81, 0xE6, 0x67, 0x97, 0x9A, 0x0E, 0x1B, 0x71,
+    0x1D, 0x6A, 0xC6, 0xB5, 0x50, 0x06, 0x17, 0xC0, 0xF4, 0xAE, 0x06, 0x2A, 0x57, 0x03, 0xB9, 0x78,
+    0xA0, 0x92, 0x01, 0xB8, 0x53, 0xDA, 0x00, 0x7B, 0x36, 0xF4, 0xB0, 0x6D, 0xBA, 0x4D, 0xD8, 0x52,
+    0x31, 0xAF, 0x29, 0xD9, 0xD3, 0x1D, 0x85, 0xDF, 0xE2, 0x36, 0x36, 0x14, 0xDE, 0x91, 0xB7, 0x79,
+    0x9B, 0x07, 0xF8, 0xFA, 0xEE, 0x6E, 0x5D, 0x8A, 0x74, 0x59, 0x97, 0x75, 0xEC, 0x65, 0x2D, 0xF6,
+    0xE5, 0x16, 0x3E, 0xA8, 0x51, 0x4D, 0x87, 0xFE, 0xF3, 0x57, 0xD0, 0x77, 0x7F, 0xDC, 0xAA, 0xEE,
+    0xE6, 0x05, 0xE2, 0xEA, 0x04, 0x2F, 0x9D, 0x30, 0xF5, 0x2A, 0xF7, 0x71, 0x6D, 0xD2, 0xBD, 0xEE,
+    0x68, 0x26, 0x36, 0x29, 0xEE, 0xC6, 0x3C, 0x98, 0x98, 0xBF, 0xDE, 0x73, 0xED, 0xA4, 0xCC, 0xE4,
+    0xF7, 0x44, 0x3C, 0xB9, 0x48, 0x8F, 0x9E, 0x29, 0x03, 0x0D, 0x8C, 0xD8, 0x96, 0xBC, 0xD5, 0x03,
+    0xDC, 0xC1, 0x41, 0xDE, 0x66, 0x11, 0x46, 0xF6, 0xC1, 0x06, 0xDB, 0xA2, 0x07, 0x46, 0x70, 0xDE,
+    0xB6, 0xD8, 0x88, 0xF8, 0x6C, 0xC2, 0x8A, 0x48, 0x4D, 0x25, 0x12, 0x31, 0x22, 0x23, 0xE4, 0x32,
+    0x01, 0x7F, 0xF0, 0xEF, 0x00, 0xF2, 0xCE, 0x04, 0xF3, 0x57, 0xE1, 0x2A, 0xB7, 0x4F, 0x5B, 0xEC,
+    0x49, 0x69, 0xA9, 0x24, 0x92, 0xBF, 0xFF, 0x95, 0xA0, 0x7A, 0xB6, 0xD9, 0xC2, 0xB4, 0x59, 0x60,
+    0x93, 0x81, 0x2C, 0x58, 0xCF, 0xA8, 0x22, 0x85, 0x2F, 0xEA, 0x2C, 0x22, 0xF7, 0x26, 0xAC, 0x88,
+    0xC7, 0x49, 0x0B, 0xCD, 0xF5, 0x8F, 0x71, 0x58, 0xD7, 0x93, 0x49, 0x1E, 0x01, 0x8C, 0x8C, 0xC7,
+    0x3C, 0x64, 0x32, 0x9A, 0x08, 0xD9, 0xFC, 0x5F, 0x33, 0x26, 0xE3, 0xEC, 0x3C, 0x66, 0x00, 0xDB,
+    0xA2, 0xC6, 0xE4, 0xFC, 0xA6, 0x64, 0x0A, 0x25, 0xC5, 0xCC, 0x55, 0x5A, 0xB2, 0x2E, 0x39, 0x71,
+    0x17, 0x80, 0x86, 0xA2, 0x05, 0xCA, 0x60, 0x23, 0x90, 0x47, 0x1B, 0x01, 0x3D, 0xE5, 0x03, 0xB0,
+    0x8E, 0xEB, 0x8B, 0xB7, 0x27, 0x80, 0x4C, 0x52, 0xD8, 0x23, 0xC9, 0xF4, 0x54, 0x29, 0x30, 0x2C,
+    0x24, 0xA4, 0x2F, 0xDB, 0x04, 0xBF, 0xE2, 0xD1, 0x66, 0xE7, 0x6F, 0x04, 0x6C, 0x1B, 0xB1, 0xF5,
+    0x8A, 0x2C, 0x58, 0x6F, 0x5A, 0xD3, 0x9A, 0xC8, 0xA0, 0x22, 0x5B, 0x0C, 0xD8, 0x7A, 0xC4, 0xC4,
+    0x1D, 0x18, 0x1D, 0x38, 0x07, 0xB9, 0xD4, 0xC9, 0xBB, 0x34, 0x2D, 0x94, 0xE9, 0x56, 0x91, 0xAC,
+    0xE6, 0xAC, 0x95, 0xF8, 0xD4, 0x97, 0x02, 0xA7, 0x97, 0x70, 0x10, 0xF8, 0x54, 0x8A, 0xBC, 0xC1,
+    0x7A, 0x23, 0x32, 0x62, 0x45, 0x22, 0x7B, 0xEB, 0x18, 0xD4, 0xD6, 0x4B, 0x54, 0xA6, 0xFB, 0x35,
+    0x7C, 0xAA, 0xD6, 0x21, 0x9A, 0x6D, 0x17, 0x47, 0xA1, 0xC6, 0x35, 0xEE, 0x73, 0xF5, 0xB2, 0xA3,
+    0xD3, 0x51, 0x38, 0xB4, 0x10, 0x98, 0x00, 0x2A, 0x22, 0x32, 0x50, 0xC9, 0x88, 0x5B, 0xEE, 0x9D,
+    0xB5, 0xCB, 0xAD, 0xC7, 0xE5, 0x5E, 0x45, 0xFD, 0x20, 0xE4, 0x50, 0xE3, 0x12, 0x1C, 0xB9, 0xFA,
+    0x3F, 0x02, 0x97, 0x3A, 0x91, 0x98, 0x89, 0x08, 0x97, 0x7F, 0xB9, 0x7B, 0xFD, 0x3F, 0x1E, 0x97,
+    0x5E, 0xBA, 0x84, 0x93, 0xF6, 0x04, 0x64, 0x1E, 0x13, 0x30, 0x22, 0x88, 0xD4, 0x69, 0xBF, 0x9B,
+    0x80, 0x8A, 0x30, 0x24, 0x8B, 0x4B, 0x26, 0x22, 0x18, 0x11, 0x09, 0xDC, 0xDF, 0xDD, 0xBD, 0xCE,
+    0x36, 0x40, 0x79, 0x18, 0xBD, 0x9A, 0x76, 0xF1, 0x8E, 0x70, 0xE7, 0x07, 0xD7, 0x53, 0x88, 0x41,
+    0xD1, 0xDB, 0x40, 0xDE, 0x31, 0x60, 0x22, 0xE7, 0xA0, 0x27, 0xAF, 0xD9, 0xC6, 0xB4, 0x94, 0x10,
+    0xB1, 0x35, 0x23, 0x59, 0x7B, 0x6C, 0x42, 0xF7, 0x66, 0x86, 0x51, 0x0D, 0x40, 0xD3, 0x1B, 0x69,
+    0x9F, 0x86, 0x88, 0xA9, 0x39, 0x05, 0xCD, 0x60, 0xBA, 0xAB, 0x27, 0x78, 0xED, 0x8A, 0xFE, 0x66,
+    0x78, 0xE2, 0x84, 0x8E, 0x57, 0xCF, 0x81, 0xE9, 0x8D, 0xD4, 0x65, 0xA0, 0x0C, 0xAE, 0xCF, 0x22,
+    0x6A, 0x32, 0xA2, 0x26, 0xB0, 0xD1, 0x75, 0xCE, 0x43, 0x65, 0x26, 0xDB, 0x82, 0x19, 0xAA, 0x37,
+    0x06, 0xA0, 0x7C, 0x73, 0x98, 0x01, 0xE6, 0xE6, 0x72, 0x00, 0xF2, 0x0F, 0x3F, 0x8C, 0x29, 0x0A,
+    0x5A, 0x76, 0x42, 0x5A, 0x8B, 0x65, 0x5A, 0x76, 0x36, 0x1D, 0xA6, 0xED, 0x09, 0x22, 0x12, 0x81,
+    0x4A, 0x66, 0xA9, 0xA1, 0x18, 0xE5, 0x47, 0x13, 0xE4, 0x52, 0x8C, 0x12, 0xD1, 0xF2, 0x13, 0x79,
+    0x59, 0x6A, 0xA4, 0x77, 0x83, 0x9B, 0xCE, 0xB8, 0x29, 0x93, 0x6F, 0xC8, 0x07, 0xF5, 0x61, 0xD0,
+    0x01, 0x90, 0x2F, 0x53, 0xB7, 0x2C, 0xE9, 0xC7, 0xE0, 0x33, 0xEA, 0x7B, 0xC7, 0x7D, 0x16, 0xE6,
+    0x2C, 0x30, 0xB8, 0xE7, 0x02, 0x85, 0x7D, 0xA3, 0xC5, 0xFC, 0xF4, 0xED, 0x16, 0xEE, 0x7C, 0xD0,
+    0x81, 0x95, 0x8E, 0x04, 0x1C, 0x69, 0x7A, 0xA0, 0x11, 0x12, 0x75, 0xC0, 0x3C, 0x4F, 0x30, 0x57,
+    0x2E, 0x28, 0x29, 0xDF, 0x1C, 0x95, 0xD8, 0x28, 0xB7, 0x00, 0x3E, 0x09, 0x90, 0x1D, 0xD9, 0x32,
+    0xC7, 0xE5, 0x3A, 0xA5, 0x0C, 0xFC, 0xE1, 0x1F, 0x8D, 0x8B, 0x17, 0xDF, 0x04, 0x76, 0xD2, 0x4A,
+    0xCB, 0x22, 0xA5, 0xD4, 0xB8, 0x79, 0xA1, 0x33, 0x74, 0xB7, 0x84, 0x34, 0xDD, 0x93, 0xD8, 0xB0,
+    0xF9, 0x4C, 0x13, 0x9C, 0x08, 0x95, 0x8C, 0x9C, 0x94, 0x3A, 0x45, 0x33, 0x57, 0x81, 0xAF, 0x2D,
+    0xA1, 0x63, 0xCF, 0xC5, 0x53, 0xF0, 0x38, 0x7C, 0x12, 0xAE, 0xE2, 0x5A, 0x7E, 0xBF, 0x83, 0x9B,
+    0x70, 0x13, 0xE2, 0x89, 0x1B, 0x6D, 0x29, 0x75, 0x79, 0xC0, 0xEF, 0xC1, 0x69, 0x0F, 0xD7, 0x51,
+    0x2D, 0x95, 0x4F, 0xDB, 0x6C, 0xD0, 0x23, 0xDC, 0x51, 0x23, 0x38, 0x35, 0x41, 0x51, 0x4F, 0x90,
+    0xB7, 0x33, 0x98, 0x38, 0x83, 0x1A, 0x66, 0x60, 0x6A, 0x00, 0xD7, 0x40, 0x82, 0x47, 0x56, 0x00,
+    0x23, 0x01, 0xB4, 0xF4, 0x80, 0x08, 0x50, 0x55, 0x11, 0xCA, 0x1F, 0xCE, 0x60, 0x5B, 0x69, 0xC9,
+    0xA2, 0x1B, 0xD1, 0x63, 0x26, 0x35, 0x13, 0xD2, 0x53, 0x51, 0x48, 0xE6, 0x01, 0x1D, 0x0E, 0xC7,
+    0xFD, 0x3C, 0x67, 0x8E, 0xD7, 0xE6, 0x6E, 0xE4, 0xF6, 0x26, 0xD6, 0x7A, 0xF5, 0x5E, 0xC7, 0xB9,
+    0x01, 0x23, 0x50, 0x05, 0xF2, 0x01, 0x24, 0x50, 0x34, 0x98, 0xB7, 0x07, 0x36, 0xCB, 0x36, 0x0B,
+    0xC2, 0x90, 0x0F, 0x5F, 0x85, 0xC7, 0x81, 0x65, 0x1B, 0xB3, 0x09, 0x23, 0x26, 0xE0, 0x3C, 0xDB,
+    0xE4, 0x2D, 0xF6, 0x9F, 0xA9, 0x01, 0x3E, 0x88, 0xD7, 0xA0, 0x74, 0x36, 0x60, 0xDE, 0x7E, 0x3B,
+    0xC2, 0xCE, 0xCE, 0x08, 0xF9, 0x0F, 0xD3, 0x94, 0xB5, 0x50, 0xC8, 0x04, 0xFA, 0x57, 0x12, 0xC1,
+    0x95, 0x4D, 0x20, 0x7B, 0xFB, 0x7D, 0x81, 0xC9, 0xBD, 0x30, 0x60, 0xDF, 0x88, 0x4D, 0xAB, 0x86,
+    0xA7, 0x8C, 0xE0, 0x3C, 0x6E, 0x84, 0x4F, 0x73, 0x0C, 0x8B, 0x25, 0xF3, 0xD6, 0xEB, 0xB7, 0xAC,
+    0xE7, 0x83, 0x57, 0x3C, 0xFF, 0xE8, 0x5D, 0xCF, 0xA6, 0x78, 0xAC, 0x04, 0xF2, 0x6F, 0xF7, 0x98,
+    0x1F, 0xDE, 0xF3, 0xEA, 0xBD, 0xB7, 0x23, 0xB7, 0x7B, 0x61, 0x45, 0x11, 0x41, 0xF7, 0x66, 0xA0,
+    0x92, 0x3C, 0xD2, 0x48, 0x19, 0xC8, 0xBB, 0x6A, 0xC1, 0xAD, 0xC5, 0x1B, 0xFD, 0x02, 0x5B, 0x9D,
+    0xAB, 0x17, 0xD4, 0x2A, 0xE3, 0x62, 0x61, 0x95, 0x74, 0x0B, 0x66, 0x35, 0x32, 0x2E, 0x90, 0xD5,
+    0xBE, 0x2D, 0x9E, 0xE2, 0x75, 0x09, 0x94, 0x41, 0xBA, 0x04, 0x58, 0x2B, 0xDC, 0x78, 0x88, 0x57,
+    0xD1, 0x11, 0x7A, 0x9C, 0xC4, 0x42, 0x46, 0x6C, 0xBD, 0x8E, 0x9F, 0x87, 0x92, 0x6D, 0x47, 0xE9,
+    0xB0, 0x0D, 0x46, 0xD0, 0xE2, 0x91, 0xC8, 0xD6, 0x4C, 0x71, 0xB9, 0xB5, 0x6F, 0x8C, 0x26, 0x36,
+    0x77, 0x07, 0x3B, 0xDC, 0xD1, 0xE2, 0x9D, 0x88, 0x77, 0xDF, 0x12, 0x89, 0x79, 0xFC, 0xC3, 0xDD,
+    0x46, 0x8F, 0x90, 0xB7, 0x15, 0x30, 0x16, 0xED, 0xD2, 0x60, 0xDD, 0xCF, 0x2C, 0x2D, 0xCE, 0xA4,
+    0x5B, 0x37, 0xD9, 0x0A, 0x4B, 0x9B, 0x71, 0x69, 0x59, 0x8C, 0x40, 0x53, 0x75, 0x4B, 0xAB, 0xD5,
+    0x58, 0x8E, 0xA4, 0x66, 0x9B, 0x21, 0x17, 0x9F, 0xDA, 0x9D, 0x47, 0x2D, 0x91, 0xAF, 0xEF, 0xAA,
+    0x7F, 0x2E, 0x63, 0x81, 0xEE, 0x7A, 0xEC, 0x0B, 0x9E, 0xD5, 0x80, 0x7E, 0xB7, 0xC6, 0x8E, 0x87,
+    0xCC, 0x90, 0x9D, 0x60, 0x67, 0x44, 0xBF, 0x3D, 0x60, 0x9F, 0xEB, 0xD9, 0xB6, 0x51, 0xC7, 0xF2,
+    0xD0, 0x0D, 0x95, 0x9E, 0xBC, 0x65, 0x04, 0x87, 0x89, 0xA8, 0x91, 0xA2, 0x26, 0xEF, 0x98, 0x48,
+    0x5C, 0x17, 0x23, 0x45, 0x20, 0x8F, 0x34, 0xE0, 0x6A, 0x33, 0xC0, 0x84, 0x6D, 0xC9, 0x22, 0x0D,
+    0x94, 0xC1, 0xC8, 0x62, 0xB7, 0x65, 0xA0, 0x12, 0x91, 0x56, 0xA7, 0x13, 0xF7, 0x77, 0x6F, 0x8C,
+    0x54, 0x35, 0x65, 0xA7, 0x27, 0x10, 0x6F, 0xE3, 0xE2, 0x51, 0x8B, 0xF8, 0x47, 0x02, 0xCD, 0x1B,
+    0xE1, 0x10, 0x95, 0x72, 0x15, 0x40, 0xB7, 0xBC, 0xC6, 0x19, 0x22, 0x2B, 0x15, 0xB9, 0xAA, 0x3B,
+    0x7A, 0xD3, 0xD2, 0x9B, 0xA0, 0x62, 0x1E, 0x74, 0xB4, 0xB5, 0xE9, 0xAC, 0x48, 0x5B, 0x88, 0x84,
+    0x52, 0x24, 0x38, 0x8A, 0xFA, 0x1A, 0x85, 0xBF, 0x43, 0xE9, 0x47, 0xDC, 0xD3, 0x0B, 0xAC, 0x3D,
+    0xFF, 0x00, 0x05, 0x82, 0x15, 0xE9, 0x18, 0xC1, 0x89, 0x90, 0x75, 0xE8, 0x79, 0xF7, 0x7B, 0x94,
+    0xFE, 0x90, 0xEE, 0x5A, 0x48, 0x2E, 0xB5, 0x30, 0x5F, 0x79, 0x97, 0xBC, 0x88, 0xF3, 0x60, 0xFA,
+    0x74, 0x3A, 0x75, 0x1C, 0x24, 0xB9, 0x14, 0x23, 0x22, 0x33, 0x50, 0x88, 0x48, 0x32, 0x5E, 0x22,
+    0xCB, 0x69, 0x01, 0x8A, 0xFB, 0xBB, 0x37, 0x06, 0xA0, 0xF1, 0xB8, 0x36, 0xB1, 0x00, 0x92, 0xE2,
+    0x89, 0x6C, 0x4C, 0x31, 0x71, 0xD9, 0x81, 0x9E, 0x13, 0x49, 0x00, 0x2F, 0x51, 0x4A, 0xB0, 0x18,
+    0x19, 0x89, 0x6C, 0x43, 0x41, 0x5E, 0x27, 0xC0, 0xCF, 0x26, 0x96, 0xC4, 0x3E, 0xB0, 0x77, 0xD8,
+    0x15, 0x44, 0x26, 0x28, 0x45, 0x02, 0x26, 0xAA, 0x11, 0xB6, 0x28, 0x6A, 0xB2, 0x56, 0xF7, 0x4B,
+    0x8C, 0x76, 0x04, 0x02, 0xA7, 0x3D, 0x20, 0x12, 0x20, 0xFF, 0xD9, 0xA5, 0x7D, 0x60, 0x2B, 0xB9,
+    0xF6, 0x1E, 0xDB, 0x42, 0xD6, 0x52, 0x01, 0x65, 0x72, 0x97, 0x23, 0xB6, 0x03, 0xD3, 0xE1, 0xFE,
+    0xD9, 0x3B, 0x14, 0x5E, 0x89, 0x8C, 0xEC, 0x91, 0x4F, 0xCF, 0x0C, 0x26, 0xE2, 0x82, 0x8E, 0xB6,
+    0x66, 0x22, 0x0B, 0x3B, 0x64, 0x91, 0x42, 0x47, 0xCA, 0x9A, 0x6D, 0x1B, 0x98, 0xD0, 0x9D, 0xC3,
+    0x44, 0x0A, 0x35, 0x50, 0x84, 0xE3, 0x43, 0xDE, 0xB2, 0x8F, 0x04, 0x87, 0xE9, 0xCD, 0x00, 0x5F,
+    0xDF, 0xDD, 0xF5, 0x20, 0x22, 0x1E, 0x7A, 0x0A, 0xD0, 0x11, 0x07, 0x26, 0xB2, 0x05, 0xA6, 0x63,
+    0x07, 0xB2, 0x96, 0x3D, 0xC8, 0x03, 0x23, 0xD8, 0xC0, 0x00, 0xB6, 0x56, 0x3D, 0x14, 0xDE, 0x44,
+    0x28, 0x31, 0xF7, 0xC5, 0x3B, 0x32, 0x91, 0x6E, 0x8B, 0xBC, 0xD7, 0x11, 0x6C, 0x4B, 0x0F, 0xB6,
+    0xA6, 0x87, 0x02, 0x7A, 0x92, 0xBB, 0x65, 0x0B, 0x1D, 0x61, 0x87, 0xAC, 0x85, 0x3D, 0x24, 0xC0,
+    0xA8, 0x04, 0xF8, 0x9E, 0xBA, 0x78, 0x38, 0x2E, 0x27, 0x5B, 0x40, 0x49, 0x00, 0x72, 0x09, 0x40,
+    0xD9, 0x91, 0x82, 0x88, 0x3F, 0xA9, 0x19, 0xC9, 0xA4, 0xD7, 0x11, 0xE7, 0x07, 0xD3, 0x31, 0xB0,
+    0xCA, 0x83, 0xEE, 0x58, 0xD9, 0x3A, 0x0B, 0xDC, 0x2A, 0x7C, 0x5E, 0xAB, 0x58, 0x62, 0xC9, 0xBA,
+    0x2D, 0x0A, 0x8A, 0xB0, 0x45, 0x49, 0x45, 0x45, 0xA9, 0x27, 0x1C, 0xE5, 0x8D, 0xFE, 0x8C, 0x6B,
+    0x4B, 0xF9, 0xB7, 0x63, 0x29, 0x22, 0x32, 0x5A, 0x11, 0x91, 0x4E, 0xCB, 0xDC, 0x4C, 0x70, 0x2C,
+    0x21, 0xD1, 0x3F, 0x86, 0xB4, 0x12, 0x8A, 0xBF, 0x06, 0xAE, 0x71, 0xCC, 0xD3, 0xD3, 0x44, 0xDD,
+    0x99, 0xF6, 0xAA, 0x09, 0x96, 0x0B, 0x79, 0xBD, 0xC1, 0x05, 0xCB, 0x05, 0x6E, 0x16, 0xDC, 0xD2,
+    0xDD, 0x39, 0x62, 0x1E, 0xCE, 0xD1, 0x3B, 0x4A, 0xEE, 0x4F, 0x9F, 0x2E, 0x83, 0xCC, 0xA3, 0x15,
+    0x91, 0x21, 0x13, 0x11, 0xCF, 0xD7, 0xFD, 0x11, 0xE4, 0xDE, 0x0C, 0x0B, 0xD9, 0x9D, 0x28, 0x72,
+    0x69, 0x01, 0xD7, 0xAE, 0x01, 0x98, 0x19, 0x97, 0x6E, 0x2E, 0xA1, 0x9D, 0x1E, 0x17, 0xF6, 0x79,
+    0xA1, 0x79, 0x69, 0x00, 0x6C, 0x0F, 0x20, 0x01, 0xB0, 0xF2, 0x67, 0x7F, 0x27, 0x20, 0x22, 0x03,
+    0xB9, 0xA4, 0xD8, 0x5B, 0x22, 0x4A, 0x44, 0x40, 0x8B, 0x5C, 0x07, 0xFE, 0xD3, 0xFA, 0xD0, 0x3B,
+    0x7F, 0xB9, 0x5E, 0xDF, 0x18, 0x50, 0x4D, 0xA7, 0x65, 0x30, 0xD3, 0x63, 0x7A, 0x80, 0x01, 0xB6,
+    0x61, 0x2B, 0x41, 0xAC, 0x16, 0x35, 0x40, 0x55, 0x63, 0x25, 0x2A, 0x11, 0x72, 0xA9, 0x31, 0xA0,
+    0x03, 0x2E, 0x70, 0x0C, 0x9C, 0x88, 0xBC, 0x2F, 0x22, 0xF2, 0x43, 0x69, 0x7E, 0x39, 0xF3, 0x48,
+    0xA8, 0xBA, 0xCF, 0xC2, 0x56, 0xD9, 0xB0, 0x34, 0xD8, 0x1C, 0x86, 0xAA, 0x15, 0x47, 0x49, 0xB7,
+    0xCA, 0x2F, 0x3D, 0xB4, 0x11, 0xA8, 0x6A, 0xD0, 0xE2, 0x93, 0x15, 0x4C, 0x2E, 0xD3, 0xD4, 0x0B,
+    0x5B, 0xEC, 0x44, 0x6E, 0x88, 0xB4, 0x26, 0x40, 0x84, 0xAB, 0x70, 0xF6, 0x28, 0x6D, 0x92, 0x82,
+    0xC3, 0x12, 0x6C, 0xC0, 0x74, 0xA8, 0x11, 0x32, 0x50, 0x1E, 0x1C, 0xE4, 0x3F, 0xED, 0x51, 0x43,
+    0x59, 0x53, 0xA9, 0x11, 0x1B, 0x8A, 0x60, 0x7A, 0x26, 0x66, 0x6C, 0x2C, 0x03, 0x4D, 0x16, 0xC9,
+    0xDE, 0x9F, 0x12, 0xE2, 0x35, 0x12, 0xC1, 0x8D, 0x4B, 0x2B, 0x8A, 0xEE, 0x48, 0x8C, 0x9A, 0x0F,
+    0x80, 0xF8, 0x14, 0xC9, 0x1B, 0x61, 0xA1, 0x06, 0xB7, 0xB1, 0x2F, 0x07, 0x15, 0x77, 0xD8, 0xCA,
+    0xDA, 0x3C, 0x6C, 0xAA, 0xDE, 0x74, 0x5B, 0x6C, 0xE5, 0xC1, 0x74, 0x3D, 0xCE, 0x61, 0x3E, 0x08,
+    0x94, 0x03, 0x5A, 0xA0, 0x68, 0xD1, 0x23, 0xB8, 0x1A, 0x13, 0xA1, 0x82, 0xBC, 0x03, 0x1B, 0xD0,
+    0xBD, 0xF3, 0x14, 0xF5, 0x3E, 0x6A, 0x54, 0x23, 0x36, 0x98, 0xC8, 0x84, 0xED, 0x6C, 0x87, 0x0B,
+    0x0D, 0x34, 0x79, 0x44, 0x4D, 0x95, 0xC7, 0xC8, 0xB0, 0x50, 0xBD, 0x6E, 0x84, 0x52, 0xC4, 0x23,
+    0x32, 0xA2, 0x6F, 0xDC, 0xBF, 0x9E, 0x5A, 0xA8, 0xE7, 0xF5, 0xC2, 0x68, 0xC2, 0xD2, 0xC4, 0x62,
+    0x00, 0xF8, 0x03, 0xF4, 0x6B, 0x6C, 0x53, 0x78, 0xD5, 0x33, 0x90, 0xB5, 0x79, 0xC0, 0xFA, 0x4D,
+    0xD8, 0x32, 0x11, 0x86, 0x02, 0x4C, 0x37, 0x80, 0xFD, 0x61, 0x00, 0xB7, 0x03, 0x34, 0x1D, 0xA9,
+    0xC5, 0x22, 0x23, 0x8D, 0x48, 0xD4, 0xBB, 0xB2, 0xEB, 0xD3, 0x8C, 0x16, 0xEB, 0x19, 0x7D, 0x84,
+    0x7E, 0xA5, 0xA8, 0x97, 0x3F, 0x26, 0x2E, 0xA9, 0x90, 0x22, 0x40, 0x11, 0x8A, 0x00, 0xA6, 0x4F,
+    0x97, 0xA5, 0x14, 0xD2, 0xBD, 0x96, 0x85, 0x84, 0x48, 0x8F, 0x82, 0x22, 0x05, 0xBC, 0x29, 0x23,
+    0x24, 0x1E, 0xB0, 0x12, 0x01, 0xFB, 0x5E, 0xE2, 0x25, 0xAA, 0x00, 0xB6, 0xB7, 0x11, 0x6C, 0xAF,
+    0x67, 0xB0, 0x3D, 0x55, 0xC0, 0x0E, 0xCB, 0x1F, 0x2D, 0xA6, 0x06, 0x50, 0xED, 0x42, 0x53, 0x90,
+    0xC8, 0xAF, 0xC7, 0x51, 0x35, 0x91, 0x5B, 0xE4, 0xFE, 0x2C, 0x6C, 0xE7, 0x35, 0xE6, 0x27, 0x1D,
+    0x9C, 0xDB, 0x03, 0x25, 0x47, 0xB3, 0x25, 0x4D, 0x0B, 0x65, 0x05, 0xF9, 0x4F, 0x7A, 0xF4, 0x60,
+    0x03, 0xFB, 0x4C, 0x94, 0x75, 0xDE, 0x05, 0xE0, 0xD3, 0x80, 0xF1, 0x95, 0x88, 0xFF, 0xE7, 0x22,
+    0x53, 0x16, 0x4C, 0xE4, 0x5C, 0xB2, 0x69, 0x3B, 0x98, 0xA0, 0x63, 0x62, 0x76, 0x6F, 0x27, 0xEE,
+    0xB9, 0xC7, 0x92, 0x07, 0xB6, 0xD9, 0x42, 0x77, 0xF4, 0x58, 0x9F, 0x05, 0x56, 0x94, 0xA8, 0xC8,
+    0x74, 0xE9, 0xCB, 0x7F, 0x66, 0x44, 0xA4, 0x2F, 0x45, 0x24, 0x2C, 0xFE, 0x89, 0x9E, 0xC4, 0x4A,
+    0x25, 0x08, 0x33, 0x00, 0xCA, 0xF3, 0xD4, 0x25, 0x9F, 0xC9, 0xF4, 0x04, 0x51, 0x05, 0xCB, 0x86,
+    0xEA, 0x4C, 0x7D, 0x96, 0xF3, 0x26, 0xE4, 0x5C, 0xA0, 0xCB, 0xFC, 0x13, 0xDC, 0x54, 0xC1, 0x5E,
+    0xFA, 0x87, 0xCF, 0xA4, 0x14, 0x46, 0x0D, 0xB7, 0x92, 0x7B, 0x8E, 0xA4, 0xCB, 0xFF, 0x41, 0xD6,
+    0x72, 0x27, 0x0F, 0x8C, 0xB6, 0x66, 0xB0, 0x9E, 0xDE, 0xA2, 0xE2, 0x69, 0x4C, 0x3C, 0x4B, 0xD6,
+    0x9D, 0xC5, 0xB6, 0xE7, 0xA8, 0x42, 0x21, 0x52, 0x67, 0x72, 0xC3, 0xA7, 0x27, 0x3B, 0x60, 0x6B,
+    0x89, 0xCD, 0xB7, 0x97, 0xBC, 0xC4, 0x6F, 0x3A, 0x78, 0x6F, 0xCD, 0x2F, 0x86, 0x75, 0x76, 0x00,
+    0x1E, 0xB3, 0x6C, 0x5A, 0x56, 0x27, 0xB8, 0xF0, 0x34, 0x2F, 0x6D, 0x10, 0xCF, 0xA8, 0x78, 0xF6,
+    0xCB, 0x9D, 0xFD, 0x30, 0x60, 0x02, 0xA6, 0x26, 0xF3, 0xE4, 0x60, 0x6F, 0xF2, 0x78, 0x84, 0x6E,
+    0x99, 0x96, 0x2C, 0x50, 0xE6, 0x35, 0x5B, 0xD6, 0xB3, 0x53, 0xC0, 0x5E, 0x09, 0xC3, 0x26, 0xAA,
+    0xDF, 0xC6, 0xC4, 0xED, 0x13, 0x59, 0xDC, 0x3B, 0x65, 0xBB, 0x3B, 0x9B, 0x4D, 0x5B, 0x89, 0x04,
+    0x27, 0xF7, 0x42, 0x3E, 0x17, 0x35, 0xD1, 0x79, 0xA2, 0x43, 0x75, 0x15, 0xBA, 0x9D, 0x97, 0xCC,
+    0x18, 0x19, 0x27, 0x72, 0x4E, 0x9D, 0x60, 0xE3, 0x14, 0xAB, 0x8D, 0x27, 0x6F, 0xAD, 0xAE, 0xC4,
+    0xD5, 0xFF, 0x11, 0x9D, 0x74, 0xF9, 0x6F, 0x5A, 0xF5, 0x46, 0xD0, 0x2F, 0x07, 0xFD, 0x7C, 0x8D,
+    0xF2, 0x0B, 0x29, 0xBA, 0x10, 0xA3, 0xC5, 0x32, 0xC4, 0x5B, 0x0B, 0x08, 0xD9, 0x03, 0xA6, 0x1F,
+    0x5C, 0x47, 0x64, 0x54, 0xE2, 0xB7, 0xF5, 0xC0, 0xCA, 0x44, 0x56, 0xA6, 0x65, 0x95, 0x05, 0xB6,
+    0x6D, 0xE0, 0xB6, 0xAD, 0xE9, 0x0B, 0xAF, 0xFA, 0xD2, 0xEB, 0xE8, 0x30, 0xF1, 0x01, 0x3D, 0x79,
+    0x84, 0x6C, 0xFD, 0x5B, 0xD2, 0x93, 0x17, 0xC9, 0x0E, 0xD8, 0xA3, 0x91, 0x70, 0xC7, 0xCC, 0x5F,
+    0x88, 0xD5, 0xBD, 0x96, 0xDB, 0x27, 0xE5, 0x80, 0x6D, 0x44, 0xEE, 0xEF, 0xA9, 0x83, 0x46, 0x46,
+    0x23, 0x22, 0x63, 0x26, 0xF3, 0xF7, 0x5F, 0x3C, 0x92, 0x87, 0x3D, 0xF4, 0x17, 0x76, 0xF6, 0xC7,
+    0xEB, 0x75, 0x1E, 0x56, 0x12, 0x34, 0xE7, 0xA4, 0x1C, 0xA6, 0x2D, 0x5E, 0xB4, 0x48, 0x1C, 0xAE,
+    0xE9, 0x37, 0xE5, 0xFA, 0x13, 0x99, 0x1C, 0x74, 0xFB, 0x32, 0x5B, 0x91, 0x3F, 0x5D, 0x98, 0xF2,
+    0x08, 0x65, 0x7B, 0x1C, 0x91, 0x2E, 0x93, 0x89, 0x7C, 0xF6, 0x17, 0xC9, 0x0F, 0x18, 0x69, 0xA4,
+    0x1E, 0xB3, 0xA5, 0x3D, 0xB7, 0x0A, 0x39, 0xE0, 0x2A, 0x22, 0x07, 0x7B, 0xFA, 0xFD, 0x75, 0x7B,
+    0x72, 0x91, 0xDD, 0x23, 0xED, 0x29, 0xC2, 0xDA, 0xA2, 0xDB, 0x89, 0xE3, 0xFE, 0xD1, 0xF6, 0x14,
+    0xF2, 0xCE, 0xC2, 0x4B, 0xB3, 0xC1, 0x43, 0x29, 0x80, 0x17, 0x4D, 0x28, 0x47, 0xFB, 0xF2, 0x3B,
+    0x1B, 0x76, 0xF6, 0xE7, 0x8D, 0x1C, 0x74, 0x45, 0x23, 0xB5, 0xC8, 0x41, 0x96, 0xF2, 0x82, 0xEC,
+    0x81, 0x9E, 0xF8, 0xAA, 0x11, 0x09, 0x99, 0xCC, 0x68, 0xB9, 0x9E, 0x22, 0xC7, 0xF0, 0xB7, 0x48,
+    0xF6, 0xC2, 0xEF, 0xA5, 0x14, 0x92, 0x0A, 0x09, 0x9B, 0x15, 0x4B, 0x1A, 0x2E, 0xED, 0x48, 0xB2,
+    0x85, 0x8E, 0xFE, 0x2D, 0x74, 0x2B, 0x15, 0xAE, 0x37, 0x03, 0x66, 0x30, 0x92, 0x82, 0xEB, 0x2A,
+    0x96, 0x01, 0xE6, 0x6C, 0xCA, 0x22, 0xE4, 0xB1, 0xBA, 0x3B, 0x01, 0xEE, 0xF9, 0xB1, 0xF2, 0x60,
+    0xC6, 0xE6, 0x85, 0x0E, 0x28, 0xDE, 0x7A, 0x6F, 0x00, 0x98, 0xD3, 0x83, 0x32, 0x49, 0x74, 0x93,
+    0x4B, 0x80, 0xDF, 0x2C, 0x8F, 0x4F, 0x40, 0x9F, 0x2A, 0x7D, 0x5B, 0x24, 0x3B, 0x91, 0xCF, 0xD2,
+    0xF4, 0xA0, 0xE5, 0xAD, 0x03, 0x09, 0x20, 0xBF, 0x96, 0x57, 0x66, 0x70, 0xA3, 0xEB, 0x9B, 0x1E,
+    0x2B, 0x99, 0x3C, 0x2B, 0x21, 0x93, 0xD0, 0xF4, 0x09, 0x1E, 0x7D, 0x96, 0x27, 0x01, 0xD5, 0xEA,
+    0x00, 0x64, 0xE1, 0x5C, 0xB2, 0xAC, 0xC9, 0xD8, 0x4E, 0xBF, 0xB3, 0x73, 0x09, 0x6A, 0x48, 0xBD,
+    0x0F, 0xCE, 0x4C, 0x59, 0x07, 0xA3, 0x8D, 0xD7, 0x40, 0x0D, 0xD5, 0x73, 0x1D, 0x98, 0x5F, 0x8F,
+    0xD7, 0x80, 0xFC, 0x2F, 0xFE, 0xAA, 0x03, 0x8A, 0x66, 0x3F, 0x75, 0xA2, 0x03, 0x68, 0xE6, 0xD4,
+    0x95, 0x21, 0x75, 0xA1, 0x4F, 0xDD, 0x8C, 0x40, 0xD3, 0x48, 0x07, 0xF6, 0x60, 0xAE, 0x02, 0x4A,
+    0x5E, 0x19, 0x24, 0x50, 0x0C, 0xD5, 0x4F, 0xA4, 0xD6, 0xF2, 0x2D, 0x31, 0xC2, 0x21, 0xBC, 0x1D,
+    0x31, 0xC1, 0x79, 0xB6, 0xF3, 0x16, 0xFB, 0x8D, 0x1E, 0xFA, 0x6B, 0x50, 0xDA, 0x1A, 0xF3, 0x76,
+    0x84, 0x9D, 0x11, 0xF2, 0x7B, 0xA4, 0xB0, 0xA9, 0x90, 0x1E, 0xDD, 0x5F, 0x8E, 0x38, 0xCA, 0x3A,
+    0xEB, 0x18, 0x99, 0xC8, 0x83, 0x0D, 0xEC, 0xA9, 0x01, 0x1B, 0x9C, 0x57, 0x6B, 0x02, 0x2A, 0xEF,
+    0xE0, 0xE4, 0x08, 0x99, 0xA4, 0x84, 0x59, 0x8A, 0xF3, 0x3E, 0xFB, 0x19, 0x6E, 0x6E, 0xD3, 0x45,
+    0x7E, 0x1A, 0xF4, 0x0F, 0xBD, 0xF9, 0xF7, 0x64, 0x3D, 0xF9, 0x01, 0x36, 0x6F, 0x4F, 0x13, 0xCF,
+    0x12, 0x57, 0xC4, 0x6D, 0x22, 0xA6, 0xA5, 0x08, 0xCC, 0xF0, 0x1D, 0xE0, 0xA9, 0x4B, 0x2F, 0x26,
+    0x79, 0x84, 0x15, 0xA9, 0xB9, 0xC6, 0x1E, 0xBA, 0x37, 0x11, 0x1B, 0x6C, 0xCD, 0x16, 0x3B, 0x87,
+    0x47, 0x81, 0x2D, 0xAE, 0xA1, 0x7B, 0xDD, 0xAF, 0x8F, 0xAA, 0x23, 0x47, 0xD7, 0x70, 0x98, 0xA8,
+    0xA5, 0x95, 0x60, 0x25, 0x1B, 0x53, 0x6A, 0xDE, 0x1D, 0x32, 0xF1, 0xDD, 0x11, 0x27, 0xFB, 0x07,
+    0xBB, 0x3E, 0x97, 0xCE, 0x84, 0x9B, 0x2A, 0xAE, 0xB8, 0x75, 0x9A, 0x55, 0xEE, 0x4F, 0x9B, 0x90,
+    0xFB, 0x68, 0xC2, 0x6D, 0xD5, 0x6D, 0xD2, 0x5B, 0xF6, 0xB2, 0xE1, 0x8E, 0x1E, 0x61, 0x0B, 0x8A,
+    0x64, 0x99, 0x0E, 0x71, 0x55, 0x60, 0x84, 0x8A, 0xAC, 0x43, 0x0F, 0x0B, 0xA2, 0x1A, 0xC1, 0x2D,
+    0x68, 0xAA, 0x0C, 0xD8, 0x2E, 0x21, 0xA9, 0x84, 0xA3, 0x12, 0x8A, 0x12, 0x70, 0x21, 0x21, 0xA8,
+    0x84, 0x9F, 0x1A, 0x11, 0x59, 0xE0, 0x63, 0x42, 0x4E, 0x8D, 0xC7, 0xB5, 0x09, 0x35, 0xD9, 0x48,
+    0x36, 0x53, 0x05, 0xCA, 0x51, 0xCF, 0x90, 0x96, 0x41, 0x72, 0xE2, 0xE3, 0xA1, 0x27, 0x6F, 0xC4,
+    0x43, 0x62, 0xF2, 0xD5, 0x8B, 0xC0, 0xD7, 0x12, 0x7C, 0x24, 0xB2, 0xAD, 0x22, 0xB7, 0x17, 0x08,
+    0x19, 0xB3, 0xA0, 0x63, 0x1E, 0x4C, 0xB4, 0x22, 0x9D, 0x15, 0x69, 0x17, 0xF8, 0x18, 0xB6, 0x28,
+    0xEA, 0x1D, 0xCA, 0x70, 0x07, 0x97, 0x92, 0x57, 0xAA, 0xAA, 0xC9, 0x04, 0xF2, 0x83, 0x87, 0x34,
+    0x1A, 0xFF, 0xBF, 0x75, 0x78, 0x4C, 0x10, 0xF1, 0x01, 0x40, 0x14, 0x80, 0x94, 0x29, 0x2C, 0x03,
+    0x0B, 0xC9, 0x99, 0x10, 0x69, 0x22, 0x4E, 0xCD, 0x08, 0x7C, 0x8D, 0xFF, 0x8C, 0xFE, 0x23, 0xDD,
+    0xEE, 0xB3, 0xA0, 0x1E, 0xEA, 0x76, 0x21, 0x12, 0x9C, 0x4F, 0xDD, 0xBE, 0x46, 0xE9, 0xEF, 0x1C,
+    0x32, 0xB5, 0x6B, 0x0F, 0xB6, 0x07, 0xF4, 0xFF, 0x6F, 0x5C, 0x7D, 0xF8, 0xA8, 0xAB, 0xDF, 0x5C,
+    0x5C, 0x7D, 0xBA, 0xD7, 0x83, 0x8C, 0x62, 0x00, 0xED, 0x01, 0x15, 0xF2, 0x0D, 0xDE, 0xAE, 0x4F,
+    0x9D, 0xD7, 0x6F, 0xB2, 0xBA, 0x99, 0xBF, 0xA2, 0xFB, 0x46, 0xF4, 0x41, 0xE4, 0x74, 0xE2, 0x20,
+    0x4E, 0xA0, 0x5A, 0x9E, 0x7E, 0x60, 0x10, 0x5B, 0xF4, 0x44, 0x3E, 0x41, 0xD5, 0x22, 0x1D, 0x76,
+    0xC4, 0xCE, 0x68, 0x09, 0x5A, 0x22, 0xD5, 0x80, 0x13, 0xAC, 0xD4, 0xE6, 0x5E, 0xD4, 0xD2, 0x73,
+    0x47, 0x7C, 0x55, 0x61, 0x7F, 0xD4, 0xDB, 0x77, 0x23, 0x63, 0xF3, 0xCD, 0x51, 0x28, 0xDF, 0x1C,
+    0xAA, 0x17, 0x3A, 0x33, 0x54, 0x3F, 0xFA, 0xCB, 0x09, 0xF7, 0xEC, 0x3C, 0xBA, 0x90, 0x45, 0x27,
+    0xCF, 0x8E, 0x88, 0x91, 0xD8, 0x04, 0x1B, 0xDD, 0x68, 0x07, 0x35, 0x6B, 0xA9, 0xC5, 0xBB, 0xB6,
+    0x8C, 0x65, 0x34, 0xA3, 0x1A, 0x8D, 0x50, 0x05, 0xA8, 0x62, 0x3E, 0x40, 0x9E, 0x0C, 0x68, 0x82,
+    0x50, 0x54, 0x35, 0x6B, 0x27, 0xB9, 0x04, 0x0E, 0xCB, 0xD4, 0x64, 0x29, 0xA1, 0x24, 0xC0, 0x53,
+    0x28, 0x9F, 0x45, 0xEE, 0x20, 0x14, 0xC1, 0x46, 0x33, 0x2A, 0xF1, 0x4D, 0xD8, 0xEA, 0x8B, 0xDB,
+    0xE6, 0xAD, 0x6F, 0xBD, 0xE5, 0xB7, 0x87, 0x3B, 0x31, 0x7F, 0xE5, 0xAD, 0x92, 0x5E, 0xDE, 0x8E,
+    0x45, 0x3E, 0x5E, 0xD3, 0xB1, 0x79, 0xBE, 0xDD, 0xCA, 0xBA, 0x29, 0xEB, 0xB6, 0x8B, 0x70, 0x27,
+    0x85, 0x8F, 0x26, 0x2E, 0x23, 0x69, 0xEB, 0x85, 0x7A, 0x3E, 0x07, 0x9F, 0x62, 0x8F, 0x91, 0x41,
+    0xF5, 0x3A, 0x9A, 0x68, 0x3A, 0xD3, 0x66, 0x21, 0x0F, 0xB6, 0xB6, 0xBE, 0xA0, 0x64, 0x8B, 0xCD,
+    0xC4, 0x5B, 0x77, 0xBC, 0x06, 0x96, 0x53, 0xC0, 0xC1, 0x57, 0x0E, 0x79, 0xA6, 0xA2, 0xFB, 0x58,
+    0xB3, 0xAC, 0x06, 0xD6, 0xA4, 0x79, 0x3E, 0x1E, 0x22, 0xE4, 0xAD, 0x3D, 0x20, 0xFF, 0x61, 0x00,
+    0xD5, 0xEF, 0x00, 0x5B, 0x59, 0x0B, 0x79, 0xB8, 0x06, 0xAA, 0x37, 0x1D, 0x38, 0x1C, 0xE4, 0xC1,
+    0x44, 0xD4, 0x80, 0x5B, 0xE8, 0xA3, 0x7C, 0x9D, 0x11, 0xEB, 0x71, 0x22, 0xE2, 0xF3, 0xF7, 0x2F,
+    0x7D, 0x69, 0x50, 0x23, 0xB8, 0xDA, 0xD5, 0x98, 0x31, 0x8F, 0xE9, 0x41, 0x27, 0x38, 0x01, 0x27,
+    0xD8, 0x00, 0xFB, 0xEA, 0x00, 0xB9, 0x74, 0x1F, 0x4D, 0x47, 0x1F, 0xE6, 0x3D, 0xE7, 0x0D, 0x28,
+    0x64, 0x84, 0x6B, 0x7A, 0x84, 0x9E, 0x01, 0xD3, 0x32, 0x90, 0x05, 0x7A, 0x2C, 0x2A, 0x62, 0x31,
+    0x91, 0xD3, 0xE4, 0x91, 0x12, 0xD7, 0x51, 0x8A, 0x74, 0x14, 0x22, 0x2D, 0x56, 0x3E, 0x08, 0x68,
+    0x79, 0x39, 0x89, 0xC3, 0x4C, 0x07, 0x45, 0xD8, 0x07, 0x33, 0xD8, 0x0E, 0xAA, 0x6F, 0x4E, 0x1F,
+    0x3B, 0x24, 0xC5, 0xE1, 0xF6, 0xA2, 0x09, 0x40, 0x31, 0x02, 0xE6, 0xDD, 0x00, 0xEC, 0xED, 0x01,
+    0xC5, 0x73, 0x2D, 0x98, 0x6E, 0x07, 0xD8, 0xCB, 0x3A, 0x28, 0xFC, 0x16, 0x98, 0x68, 0xD6, 0x84,
+    0x4D, 0x51, 0x9B, 0x88, 0x89, 0x38, 0x68, 0x44, 0x7A, 0x8A, 0x75, 0xF0, 0xD2, 0xD3, 0x5C, 0xBA,
+    0x54, 0xD5, 0x45, 0xC0, 0x0C, 0x66, 0x20, 0xE1, 0x31, 0x33, 0x02, 0x79, 0x70, 0x60, 0x62, 0x11,
+    0xD0, 0x63, 0x1E, 0x41, 0xCC, 0xF0, 0x91, 0x66, 0xE5, 0xC3, 0xCD, 0x65, 0x28, 0x8A, 0x1F, 0x0B,
+    0x58, 0x6F, 0x6B, 0xAC, 0x37, 0x5D, 0x1A, 0x0B, 0xD3, 0xB2, 0x0D, 0x11, 0x07, 0x57, 0x29, 0x43,
+    0x1A, 0x8C, 0x5C, 0x64, 0x40, 0x89, 0x4C, 0xE0, 0xE4, 0x2D, 0x0E, 0x47, 0xE3, 0x48, 0x5F, 0x13,
+    0x4F, 0x84, 0x15, 0x91, 0x36, 0xFD, 0xFC, 0xE5, 0xF5, 0x43, 0x8A, 0x04, 0xF2, 0xB7, 0xD2, 0x72,
+    0xCF, 0xFE, 0x3C, 0x35, 0xC8, 0xFC, 0x3C, 0x8D, 0x9B, 0x89, 0xD5, 0xC2, 0x9A, 0x96, 0x32, 0x03,
+    0xBA, 0xCF, 0x45, 0x3C, 0xA8, 0x21, 0xC9, 0xEE, 0x18, 0x97, 0x1D, 0x32, 0x2E, 0xE4, 0xD4, 0x94,
+    0x42, 0x3A, 0x9A, 0xC5, 0x86, 0x55, 0x4B, 0x1A, 0xA2, 0x12, 0x91, 0x4B, 0x97, 0x12, 0x01, 0x20,
+    0x12, 0x70, 0x21, 0xF1, 0x0D, 0x65, 0xC0, 0x8A, 0x8C, 0x14, 0x2D, 0x79, 0xA2, 0xD8, 0x8E, 0x7C,
+    0x4E, 0xF6, 0x50, 0xFE, 0xE5, 0x5B, 0x1F, 0x76, 0x14, 0x22, 0xD1, 0xF8, 0xAC, 0x2B, 0x7B, 0x56,
+    0xF4, 0xCC, 0x64, 0x61, 0x13, 0xFB, 0x4B, 0x19, 0xB3, 0x80, 0x88, 0x84, 0x48, 0xF1, 0xAA, 0x4F,
+    0x6B, 0x04, 0xD5, 0xD1, 0x00, 0x25, 0x2E, 0x11, 0x26, 0x72, 0xF0, 0xC5, 0x50, 0x88, 0x88, 0x8C,
+    0x88, 0x54, 0x22, 0xB5, 0x96, 0x97, 0xDF, 0x94, 0xEB, 0xC0, 0x4D, 0xAE, 0x60, 0x82, 0xA9, 0xC9,
+    0x7F, 0xB6, 0xB7, 0x60, 0xE4, 0xFC, 0x23, 0x62, 0x99, 0x42, 0x24, 0xD0, 0x88, 0xA4, 0x5C, 0x95,
+    0xF5, 0xCB, 0x9E, 0xD5, 0x71, 0x7D, 0xE4, 0x44, 0x50, 0x22, 0x03, 0x79, 0xBD, 0x58, 0x47, 0x15,
+    0x49, 0xC8, 0x87, 0xAD, 0x14, 0x98, 0x4D, 0x64, 0x22, 0x7D, 0xE2, 0xF5, 0x96, 0x5E, 0xD6, 0x78,
+    0x4E, 0xB1, 0x81, 0x8A, 0x79, 0x9D, 0x42, 0xAC, 0xAA, 0x07, 0x9E, 0xFC, 0x38, 0xA9, 0x0E, 0x4D,
+    0x03, 0xCE, 0x5F, 0x20, 0xAF, 0x75, 0xD0, 0x1D, 0xDB, 0x6C, 0xDD, 0x90, 0x90, 0x8B, 0x8C, 0x1C,
+    0xBC, 0x98, 0x20, 0x85, 0x3A, 0x04, 0xDA, 0xF2, 0xEA, 0x3F, 0x24, 0x17, 0x09, 0x94, 0x32, 0xC2,
+    0xE5, 0x03, 0xE0, 0xF2, 0x01, 0x46, 0xA4, 0x36, 0x22, 0x9D, 0x79, 0xF5, 0x72, 0x5C, 0x88, 0x96,
+    0x1E, 0x88, 0x3C, 0xF5, 0xF5, 0xE8, 0x44, 0x5A, 0x37, 0xFF, 0xD3, 0x70, 0x01, 0xEB, 0x2F, 0xB0,
+    0xC5, 0x29, 0x3D, 0x90, 0x4B, 0x0B, 0xDF, 0x5F, 0xC7, 0x75, 0x33, 0x2A, 0x51, 0xBF, 0x51, 0xBF,
+    0x7A, 0x79, 0x58, 0xF2, 0x7B, 0x63, 0x82, 0x7C, 0x97, 0xFA, 0x52, 0x24, 0x96, 0xF2, 0x6E, 0x77,
+    0xD6, 0x9B, 0xF0, 0x34, 0xD6, 0x9F, 0xE0, 0x0E, 0xD9, 0xBD, 0x1E, 0xD5, 0xF8, 0xA3, 0x1D, 0x19,
+    0x4D, 0x24, 0x8B, 0x65, 0x8D, 0x0B, 0x33, 0x6A, 0xCE, 0xFA, 0xDF, 0x1A, 0x4B, 0x9E, 0x9C, 0x3D,
+    0x66, 0x91, 0xD0, 0xD5, 0xFC, 0xBD, 0x2F, 0xCA, 0xA1, 0x45, 0xEE, 0x93, 0x10, 0x4E, 0x7D, 0xF1,
+    0x06, 0x56, 0xA4, 0xC7, 0xCD, 0xFF, 0x34, 0xD0, 0xB1, 0x89, 0xA9, 0x4D, 0x47, 0xE6, 0xF7, 0x49,
+    0xAD, 0xD7, 0xDF, 0x39, 0xB4, 0x30, 0xD2, 0x91, 0x89, 0x78, 0x2D, 0x12, 0xF9, 0xEE, 0x97, 0xE7,
+    0x65, 0xA8, 0x4C, 0x4C, 0x3D, 0x78, 0x6A, 0x47, 0x8B, 0x08, 0x8D, 0xDC, 0xA8, 0xCF, 0x7A, 0x13,
+    0x32, 0x4C, 0xA0, 0xCD, 0x5B, 0xA4, 0x89, 0x54, 0xCD, 0x80, 0xAB, 0x67, 0x8A, 0xEE, 0xA1, 0xCE,
+    0xA8, 0x21, 0xA9, 0x76, 0x9C, 0x1F, 0x93, 0x77, 0x48, 0x2B, 0x5F, 0xCC, 0xF8, 0xB1, 0x1D, 0xCA,
+    0xA2, 0x11, 0xEF, 0x6A, 0x5C, 0xED, 0x62, 0x1E, 0xD1, 0x63, 0x26, 0x49, 0xEC, 0x59, 0xB5, 0x15,
+    0xD0, 0x64, 0x63, 0xD1, 0x82, 0xE9, 0x9B, 0x37, 0x7B, 0xC0, 0xFD, 0xB0, 0x9F, 0x01, 0x35, 0x89,
+    0xAB, 0x01, 0x7B, 0x2F, 0xC5, 0x48, 0xD5, 0x61, 0xDA, 0x8F, 0x23, 0x01, 0xB4, 0x4D, 0x87, 0x59,
+    0xDA, 0x6F, 0x4A, 0x44, 0x3A, 0xA0, 0xB9, 0xF7, 0xA1, 0x78, 0x28, 0x27, 0xF9, 0xF6, 0x08, 0x56,
+    0xCA, 0x41, 0x3A, 0x8C, 0xBC, 0x21, 0xCF, 0x8B, 0x47, 0x62, 0xD5, 0xBB, 0x91, 0x6A, 0xCC, 0xE5,
+    0x0B, 0x47, 0x53, 0xD6, 0x4B, 0xC7, 0x6C, 0xEB, 0x00, 0xAA, 0x67, 0x46, 0x40, 0x8F, 0x36, 0xFE,
+    0xD6, 0xB9, 0xCA, 0xDB, 0x32, 0x16, 0x35, 0x45, 0x2D, 0xCF, 0x0C, 0xE0, 0xCC, 0x58, 0x04, 0xB8,
+    0x53, 0x74, 0x23, 0x30, 0x56, 0x36, 0x80, 0xF9, 0xF5, 0x30, 0x02, 0xD9, 0xBD, 0x7B, 0xC9, 0x12,
+    0x8D, 0x29, 0x69, 0x19, 0x1E, 0x20, 0x28, 0xBB, 0x6E, 0xFB, 0x08, 0x94, 0x22, 0x03, 0x98, 0xB9,
+    0xFA, 0x76, 0x84, 0xEA, 0xED, 0xD9, 0x45, 0xB2, 0xB9, 0xE8, 0x9B, 0x8E, 0xA6, 0x93, 0x20, 0x21,
+    0xC9, 0xA5, 0x70, 0x6A, 0x24, 0x8F, 0x2E, 0xFC, 0x0D, 0xB6, 0xF4, 0xF2, 0x01, 0x94, 0x32, 0xA0,
+    0xBF, 0x5B, 0x84, 0x65, 0x67, 0x9A, 0x76, 0xE1, 0x2A, 0x6C, 0x80, 0x2C, 0xA2, 0x65, 0x20, 0x65,
+    0x12, 0xB9, 0x93, 0xE4, 0x37, 0x09, 0x3E, 0x9A, 0x4E, 0xA1, 0x46, 0xB6, 0x2E, 0x49, 0x6D, 0x44,
+    0x22, 0x95, 0x8C, 0x89, 0x80, 0x3D, 0x6A, 0x18, 0xFC, 0x1E, 0xA6, 0xB7, 0x81, 0x4A, 0x8F, 0xD8,
+    0xE8, 0x1E, 0x31, 0xB9, 0xAE, 0x87, 0x63, 0xAA, 0x25, 0x65, 0xE1, 0x58, 0x14, 0xDC, 0x66, 0x02,
+    0x7E, 0xBF, 0x5B, 0x27, 0x56, 0x6F, 0xA6, 0x04, 0xC9, 0x89, 0x1B, 0x6D, 0x6A, 0x4A, 0x71, 0x90,
+    0x0C, 0x46, 0x67, 0x65, 0x06, 0x93, 0x34, 0x0C, 0xFB, 0xE0, 0x3C, 0x45, 0xC0, 0xF4, 0xC9, 0x4A,
+    0x9C, 0x0C, 0xB0, 0x99, 0x92, 0xE7, 0x3B, 0x60, 0x43, 0xF1, 0xDC, 0x98, 0x8B, 0xE0, 0xA4, 0xA5,
+    0xEA, 0xA0, 0x92, 0x5E, 0xA7, 0xE4, 0x5D, 0xCA, 0xF5, 0x3B, 0x4F, 0x16, 0x61, 0x3F, 0x45, 0x30,
+    0xE5, 0xB8, 0xEC, 0xDD, 0x98, 0x62, 0xB6, 0x92, 0xC7, 0xD4, 0xC8, 0x9D, 0xCB, 0xAD, 0x15, 0xC1,
+    0x4A, 0x5C, 0x47, 0x43, 0x00, 0xEC, 0x4A, 0x84, 0xF2, 0xD0, 0x2E, 0x2B, 0xBF, 0xEC, 0xC0, 0xAF,
+    0x63, 0x03, 0x45, 0xA7, 0x46, 0xCC, 0x44, 0x59, 0x23, 0xC1, 0xF4, 0xB8, 0x91, 0x8A, 0x5C, 0xEA,
+    0xBC, 0x53, 0xD2, 0x33, 0x51, 0x55, 0xD8, 0x60, 0xFF, 0x22, 0xAA, 0xD1, 0x0C, 0x33, 0x65, 0xBD,
+    0x5F, 0xB4, 0xA6, 0x2F, 0x5F, 0x1F, 0xA9, 0xB2, 0xE8, 0x42, 0x1E, 0xA7, 0xAC, 0x67, 0x76, 0xBE,
+    0xC1, 0xFE, 0x45, 0x67, 0xA3, 0x9A, 0x47, 0x35, 0xE3, 0x04, 0xD7, 0x1A, 0x09, 0x66, 0xA4, 0xEA,
+    0x69, 0x42, 0x3E, 0x63, 0xD7, 0xC3, 0xFE, 0x07, 0xCD, 0x84, 0x91, 0x45, 0x63, 0x71, 0xF8, 0xB9,
+    0x4D, 0x11, 0xAC, 0x37, 0x03, 0x91, 0x0F, 0x7D, 0xC1, 0x66, 0xD4, 0x9D, 0x7D, 0x85, 0x4D, 0xFD,
+    0xF3, 0xCE, 0x84, 0xDB, 0x67, 0xD9, 0x2E, 0x4C, 0xC8, 0xDF, 0x0C, 0xDB, 0x1C, 0xC4, 0x3C, 0xD8,
+    0x1D, 0x06, 0x25, 0xBE, 0xF0, 0x65, 0xA7, 0xA3, 0x19, 0x70, 0x6B, 0x9F, 0xCC, 0x98, 0x45, 0x28,
+    0xC3, 0x0C, 0x66, 0x38, 0x0C, 0xA3, 0xFE, 0x78, 0x61, 0xD3, 0xF3, 0x8E, 0x11, 0x3D, 0x53, 0xD4,
+    0x54, 0xAD, 0xE9, 0xB1, 0x23, 0x0E, 0xB3, 0x56, 0xB0, 0xEE, 0x53, 0x8A, 0xB7, 0x6D, 0x76, 0x44,
+    0xC1, 0xFA, 0x42, 0x67, 0x86, 0xFC, 0xE7, 0x13, 0xEE, 0x0B, 0x8B, 0x82, 0x75, 0xA0, 0xB1, 0xA1,
+    0xF2, 0xF6, 0xED, 0xDE, 0xC6, 0x23, 0x0A, 0x56, 0xF3, 0x71, 0x0A, 0xD6, 0x21, 0x6B, 0x29, 0xFD,
+    0x94, 0x18, 0xD0, 0xE6, 0x51, 0x8B, 0x92, 0xD7, 0x6A, 0xA4, 0xC7, 0xD5, 0x16, 0x7B, 0x4B, 0x45,
+    0xF3, 0x16, 0xE7, 0x18, 0xA2, 0x69, 0xCF, 0x9D, 0x66, 0x95, 0x7F, 0xB3, 0xCD, 0xEE, 0xC6, 0x15,
+    0xB7, 0xB7, 0xB3, 0x60, 0xBF, 0xCD, 0x1E, 0x1F, 0xB4, 0xB6, 0x2E, 0x7A, 0xD5, 0xEB, 0x99, 0x92,
+    0x45, 0x28, 0xB6, 0xA8, 0xE6, 0xA2, 0xAD, 0x49, 0xE6, 0x18, 0xDB, 0x39, 0xCF, 0xA3, 0x16, 0xEE,
+    0x48, 0x3E, 0xBE, 0x03, 0x1A, 0x99, 0x21, 0x93, 0x2F, 0x4A, 0x4D, 0xD1, 0xE3, 0x02, 0x55, 0x4D,
+    0xD1, 0x22, 0x60, 0xBB, 0x64, 0xC6, 0x4C, 0x0F, 0x79, 0x97, 0x45, 0xC8, 0x5B, 0xDB, 0x92, 0x30,
+    0x2B, 0x36, 0x14, 0x35, 0x14, 0x75, 0x59, 0x83, 0xF3, 0x65, 0x0D, 0x0D, 0x65, 0x8B, 0x99, 0x28,
+    0xA7, 0x4B, 0xCD, 0xB8, 0x40, 0x27, 0x2B, 0x22, 0x1D, 0xB9, 0x88, 0xD4, 0x68, 0x91, 0x09, 0x28,
+    0xE5, 0x61, 0x25, 0x90, 0x0D, 0x8E, 0x22, 0xEC, 0xE3, 0xEA, 0xF9, 0x23, 0x91, 0xDD, 0xC9, 0x03,
+    0x68, 0x1A, 0xAF, 0x7B, 0x13, 0xF2, 0xA0, 0x5B, 0xEB, 0x75, 0x57, 0xA2, 0xBB, 0x4D, 0x4C, 0xBB,
+    0x22, 0x0B, 0xDB, 0xD8, 0x70, 0x8D, 0xCA, 0x3B, 0x11, 0x9C, 0x8C, 0x14, 0x12, 0xD1, 0xB3, 0x3F,
+    0xE2, 0x68, 0x92, 0x62, 0xAB, 0x11, 0xA9, 0x69, 0xEA, 0x3C, 0x52, 0xC1, 0x1D, 0x9C, 0x4F, 0xED,
+    0xCE, 0x3A, 0x1B, 0xD0, 0x43, 0x26, 0x22, 0x93, 0x16, 0xD9, 0x6D, 0x98, 0xA0, 0x08, 0xCE, 0x63,
+    0x5B, 0xDB, 0x92, 0x47, 0x33, 0x51, 0x0C, 0x34, 0x22, 0x63, 0xA2, 0xBF, 0x93, 0xFC, 0xA2, 0x94,
+    0x01, 0xD4, 0xBF, 0xB8, 0x0E, 0xE8, 0xA6, 0x26, 0x93, 0x91, 0xFC, 0xFD, 0xAF, 0x84, 0xAC, 0x55,
+    0xD1, 0xB4, 0x6C, 0xAA, 0x48, 0xE1, 0x45, 0x24, 0x6C, 0x5D, 0xFA, 0x52, 0x2C, 0xA0, 0xCF, 0x5A,
+    0x35, 0x22, 0xF7, 0x26, 0x9C, 0x4C, 0x18, 0x99, 0xA0, 0x7C, 0xE7, 0x88, 0x59, 0xCE, 0x5A, 0x98,
+    0x4C, 0x0F, 0xEE, 0x99, 0x94, 0x2A, 0xE6, 0x77, 0x7E, 0x2E, 0x1F, 0x80, 0x12, 0xE9, 0xD0, 0x22,
+    0x73, 0x92, 0x7E, 0xA9, 0x11, 0xDD, 0x33, 0xC1, 0x35, 0xF6, 0xA1, 0xA8, 0x1D, 0xE4, 0x5D, 0x21,
+    0x22, 0x7D, 0x2E, 0xF3, 0xEE, 0x68, 0x7A, 0xA8, 0x52, 0x6A, 0xD8, 0x79, 0xCA, 0x60, 0x7B, 0xAA,
+    0x4E, 0x4B, 0xB2, 0x82, 0x89, 0xBF, 0x88, 0xD0, 0x48, 0x07, 0xC7, 0xFF, 0x95, 0x07, 0x54, 0x9F,
+    0x07, 0x9C, 0x1F, 0x93, 0xEA, 0xFC, 0xB7, 0xB8, 0xBF, 0xBF, 0x3B, 0x40, 0x71, 0x54, 0x11, 0xB6,
+    0x99, 0x14, 0x61, 0x3B, 0x88, 0x48, 0xB0, 0xAF, 0x5E, 0x1A, 0x55, 0xC4, 0xFA, 0xC2, 0xFF, 0x36,
+    0x45, 0x58, 0xD6, 0x95, 0x3E, 0x99, 0x5D, 0x35, 0x65, 0x91, 0x8F, 0x6E, 0x8E, 0xC3, 0x6A, 0x15,
+    0x27, 0x03, 0x5C, 0xC3, 0xD5, 0xEC, 0x61, 0x22, 0xDB, 0x70, 0x87, 0x4F, 0xAD, 0xC3, 0xFE, 0x0E,
+    0xB5, 0xBB, 0xDB, 0x2F, 0xF9, 0x56, 0x97, 0x0C, 0x9C, 0xAD, 0x49, 0x9A, 0x26, 0x4C, 0xCC, 0x26,
+    0xB2, 0x41, 0xCB, 0xDC, 0x8C, 0x34, 0x22, 0x53, 0xA2, 0xD3, 0xD2, 0xB2, 0x3C, 0x29, 0xDF, 0x79,
+    0x24, 0xA4, 0xC9, 0x62, 0x11, 0xCA, 0x30, 0x33, 0x3F, 0x90, 0xFC, 0xAA, 0x8B, 0xA8, 0x66, 0xC6,
+    0x5E, 0x2C, 0x79, 0x12, 0x97, 0x62, 0x46, 0x15, 0x71, 0x12, 0xD4, 0xFD, 0x26, 0x85, 0x6A, 0x45,
+    0x08, 0x7A, 0xCA, 0xEE, 0x4B, 0x5B, 0x24, 0x0A, 0xF5, 0x28, 0x1C, 0xBA, 0x21, 0x35, 0x4E, 0x1E,
+    0x05, 0x4B, 0xEA, 0x22, 0xC7, 0x52, 0x9A, 0xA0, 0xC0, 0x74, 0x6C, 0x52, 0xC2, 0xC8, 0x80, 0x8E,
+    0x79, 0x20, 0x6B, 0xAF, 0x81, 0x7D, 0x23, 0x82, 0x2B, 0x6A, 0x98, 0xC6, 0x14, 0xF3, 0x24, 0xEA,
+    0xCA, 0x0E, 0x6B, 0xF4, 0x37, 0xAF, 0xE9, 0x85, 0xC6, 0xA7, 0x3C, 0x8F, 0x93, 0x1A, 0xA4, 0x87,
+    0xEC, 0x51, 0xA9, 0x70, 0x23, 0x1D, 0x56, 0xEE, 0xD7, 0x1F, 0x37, 0x9F, 0x9B, 0x49, 0xBF, 0x6E,
+    0xBD, 0x8E, 0xEC, 0x91, 0xB5, 0x59, 0x8B, 0xAD, 0x1D, 0x38, 0xD5, 0xC3, 0x1D, 0x1B, 0x50, 0xC3,
+    0x1D, 0x30, 0xEF, 0xC5, 0x25, 0x3B, 0x53, 0x8E, 0x09, 0xEF, 0xA7, 0x2C, 0x4A, 0xB6, 0xA6, 0xAE,
+    0xCC, 0x3A, 0x95, 0x92, 0xCC, 0x4B, 0x9B, 0x84, 0xA4, 0x0F, 0x86, 0xB7, 0x23, 0xEF, 0x4A, 0x8F,
+    0xAB, 0x27, 0xD4, 0x94, 0x3F, 0x1A, 0x85, 0x1C, 0xF7, 0x9C, 0xA1, 0x44, 0x47, 0xB6, 0xB1, 0x9E,
+    0x81, 0x3D, 0x4C, 0x34, 0x6D, 0x32, 0xEB, 0xC5, 0x33, 0x3D, 0x38, 0x1B, 0x60, 0xBC, 0x06, 0xFA,
+    0xC3, 0x98, 0xD4, 0x75, 0x09, 0xEA, 0xB9, 0x6E, 0x01, 0xF3, 0x66, 0x58, 0x20, 0xBE, 0x9E, 0x96,
+    0xF4, 0x9C, 0xCC, 0x4B, 0xA6, 0xA9, 0x78, 0x34, 0xA6, 0x18, 0x4D, 0x47, 0xD6, 0x95, 0xF5, 0xBA,
+    0x39, 0x1F, 0x1B, 0xC0, 0x9A, 0x36, 0xA9, 0xF6, 0x7B, 0x4A, 0xF2, 0xC0, 0x0E, 0x3B, 0x30, 0x98,
+    0x88, 0x89, 0x85, 0x27, 0x6F, 0x47, 0x28, 0xFE, 0xA7, 0x36, 0x09, 0xFE, 0x90, 0x9E, 0xA4, 0xF8,
+    0xCB, 0xA6, 0x75, 0x56, 0x2B, 0xD1, 0xBF, 0xEB, 0x1C, 0xE2, 0xB4, 0xB0, 0xB0, 0xD5, 0xB4, 0xA4,
+    0x18, 0x1F, 0xA8, 0xB9, 0xAD, 0x57, 0x03, 0xB6, 0x56, 0x03, 0x36, 0xA8, 0xBF, 0xE6, 0xC4, 0xC7,
+    0xCC, 0x56, 0x89, 0x8A, 0x64, 0x81, 0x01, 0xFA, 0x94, 0xAF, 0xDD, 0x82, 0x3C, 0x94, 0xA0, 0x7A,
+    0x5B, 0xC3, 0x35, 0x1B, 0xC0, 0xBE, 0xD9, 0x81, 0xF9, 0x20, 0x02, 0xCD, 0x70, 0x88, 0x88, 0xE7,
+    0x43, 0x9E, 0xCA, 0xD5, 0x6B, 0x2E, 0xA4, 0x6C, 0x97, 0x91, 0xB2, 0x49, 0x7F, 0xD3, 0xA6, 0xFA,
+    0x87, 0x07, 0x9F, 0x4F, 0xA3, 0xAE, 0x63, 0x43, 0xDA, 0x7A, 0xA5, 0x67, 0x4A, 0xE2, 0x8B, 0xDF,
+    0xF1, 0xD9, 0x44, 0xC7, 0xB4, 0xB2, 0xD3, 0xA8, 0xA9, 0x5E, 0xF5, 0xA4, 0x45, 0xC5, 0x98, 0xB5,
+    0xA4, 0x81, 0x4B, 0x92, 0x64, 0xF3, 0x5E, 0x04, 0xDC, 0xC4, 0x32, 0x76, 0x49, 0x95, 0xAC, 0x84,
+    0x45, 0x25, 0xB8, 0x40, 0x7B, 0x61, 0x59, 0x5D, 0x89, 0x5B, 0xAE, 0x26, 0x1E, 0xD2, 0x26, 0x83,
+    0x0D, 0x5B, 0x14, 0xF5, 0x3E, 0xAE, 0x9E, 0xA8, 0xBE, 0xF0, 0x90, 0x53, 0xD1, 0x35, 0x9F, 0xCB,
+    0x02, 0x57, 0xF3, 0x9A, 0xDE, 0x7A, 0xA2, 0x45, 0xC5, 0x02, 0x1D, 0xCF, 0x61, 0xBA, 0x4D, 0xB2,
+    0x76, 0x85, 0x0D, 0xDB, 0x94, 0xE1, 0x9A, 0x92, 0xDA, 0x89, 0xF8, 0x52, 0x84, 0x7C, 0x5A, 0xF3,
+    0x64, 0x77, 0x16, 0x7C, 0x34, 0xAE, 0xD9, 0x17, 0x0A, 0xBF, 0x67, 0x7A, 0x1B, 0x2A, 0x3D, 0x3E,
+    0x1A, 0x2E, 0x3E, 0x49, 0x9B, 0xF1, 0x34, 0x37, 0x75, 0x38, 0xC1, 0x05, 0xD5, 0x1A, 0xBF, 0xC1,
+    0x95, 0x2C, 0x64, 0xDF, 0x18, 0x70, 0xE2, 0xD5, 0x74, 0x13, 0x6C, 0x12, 0x7A, 0x9E, 0xFD, 0xFF,
+    0xB8, 0xC4, 0x6F, 0x02, 0x5C, 0x5C, 0xCB, 0x74, 0x3A, 0xE0, 0xD4, 0x61, 0xA3, 0x9E, 0x3A, 0x14,
+    0x57, 0x7E, 0xB4, 0xEC, 0x60, 0x11, 0x57, 0x8E, 0xE9, 0xE6, 0x01, 0xAE, 0x3C, 0x12, 0xFD, 0x32,
+    0x02, 0x59, 0x4C, 0x09, 0xDC, 0x94, 0xC6, 0xEF, 0xAA, 0xFA, 0x77, 0xCC, 0xBF, 0xFA, 0x6B, 0xCE,
+    0x02, 0x65, 0x30, 0xA9, 0x4C, 0x6D, 0x05, 0x38, 0xB2, 0x14, 0xAB, 0xDF, 0x06, 0xF6, 0x53, 0xFE,
+    0xAC, 0x25, 0x82, 0x1A, 0x29, 0xE5, 0x3A, 0x65, 0x6D, 0xEE, 0x37, 0xB5, 0xE9, 0x59, 0xB1, 0x89,
+    0x23, 0x0B, 0xAA, 0xCB, 0x23, 0xB7, 0x39, 0xCD, 0x8C, 0xF5, 0xBA, 0xB3, 0x2D, 0x91, 0x3D, 0x3D,
+    0x52, 0xAA, 0x26, 0xB8, 0x60, 0x44, 0x62, 0x36, 0xE0, 0x64, 0xA2, 0xF1, 0x99, 0x4C, 0x8B, 0x24,
+    0xE2, 0xA1, 0xA6, 0x0F, 0x50, 0xE9, 0x01, 0x66, 0xD3, 0xA3, 0xE6, 0x8F, 0xD9, 0xE3, 0xAF, 0xC1,
+    0xE3, 0x3A, 0xC2, 0x59, 0x13, 0x61, 0x65, 0x3A, 0x58, 0x99, 0x16, 0xAE, 0x66, 0x3F, 0x83, 0x3E,
+    0x97, 0x89, 0x68, 0xEB, 0x5C, 0x45, 0xEB, 0xCD, 0x37, 0xBB, 0x82, 0xEC, 0x5B, 0x6D, 0x49, 0xF1,
+    0x5C, 0x70, 0x5F, 0x94, 0x3C, 0x38, 0x19, 0x6D, 0xED, 0xE4, 0xBA, 0x7D, 0x28, 0xD8, 0x32, 0x11,
+    0xAE, 0xA1, 0x7B, 0xD4, 0x00, 0x03, 0x59, 0xB7, 0xE8, 0xB2, 0xD8, 0xA7, 0x02, 0x9C, 0x1A, 0x01,
+    0xF7, 0x5C, 0x04, 0x8A, 0xB7, 0xDA, 0x07, 0x29, 0xEF, 0x29, 0xB1, 0x46, 0x1C, 0xE6, 0xED, 0xAB,
+    0x84, 0xA2, 0x66, 0x20, 0x1B, 0x04, 0x28, 0x62, 0xE3, 0xA1, 0x0A, 0x55, 0x40, 0x09, 0xAE, 0x25,
+    0x1B, 0x29, 0x23, 0x45, 0x4F, 0xF1, 0x9B, 0xBA, 0x6A, 0x97, 0x42, 0xB0, 0xC4, 0xB8, 0xE7, 0xD2,
+    0xC2, 0x61, 0xB1, 0x21, 0x9C, 0xE1, 0x38, 0x96, 0xAC, 0x56, 0x5D, 0x16, 0x58, 0x65, 0x81, 0xFC,
+    0xE5, 0x80, 0xFA, 0x20, 0x2C, 0x96, 0xA9, 0x4D, 0x86, 0x3C, 0x9B, 0x21, 0x7B, 0x37, 0x90, 0xFD,
+    0x7C, 0x20, 0xEB, 0x1C, 0x59, 0xCC, 0xBB, 0x2C, 0x2A, 0xA9, 0xD3, 0xEA, 0xCA, 0xBA, 0x25, 0x25,
+    0xB1, 0x6B, 0x45, 0xDE, 0x14, 0x89, 0x0F, 0xFD, 0xB6, 0xFB, 0x9A, 0x88, 0xC8, 0xCB, 0x22, 0x32,
+    0x71, 0xEC, 0xD2, 0xA5, 0x4B, 0x17, 0x93, 0xDC, 0x2A, 0x95, 0xD8, 0xC9, 0x43, 0x66, 0x85, 0xA8,
+    0x03, 0x17, 0x88, 0x9C, 0xE2, 0x25, 0x2C, 0x1B, 0x98, 0xDA, 0xA2, 0x5A, 0x53, 0x73, 0x53, 0xB5,
+    0xAC, 0xB8, 0xC9, 0x29, 0x2E, 0x90, 0x73, 0x0A, 0x13, 0x72, 0xE8, 0x4C, 0xE0, 0x25, 0x3A, 0x56,
+    0xDC, 0xE4, 0x04, 0x2B, 0x32, 0x7F, 0x02, 0x1D, 0x32, 0x4F, 0xD4, 0xE9, 0x8B, 0x8D, 0xE5, 0x36,
+    0xE8, 0xDD, 0xDD, 0xDD, 0x5D, 0x2D, 0x4B, 0x86, 0xFD, 0x28, 0xC6, 0x38, 0xBE, 0xBB, 0xBB, 0xFB,
+    0x7D, 0x23, 0x22, 0xF2, 0x85, 0x44, 0x5D, 0x5D, 0x32, 0x93, 0x19, 0xF3, 0xDE, 0xC6, 0xA2, 0x75,
+    0xA1, 0xF1, 0x4D, 0xED, 0x42, 0xD1, 0xDA, 0x2E, 0x8B, 0x66, 0x54, 0xD3, 0xA3, 0xDF, 0x56, 0x6F,
+    0x0E, 0x66, 0x74, 0xA1, 0xF8, 0xF9, 0x8C, 0xD8, 0x68, 0xFA, 0xCA, 0x97, 0xAF, 0x8F, 0xCC, 0xB6,
+    0x5B, 0xAA, 0x82, 0xD6, 0xF9, 0xF7, 0x73, 0x09, 0x9B, 0xAE, 0x52, 0xD6, 0xFC, 0x76, 0xA2, 0x96,
+    0x22, 0x85, 0xC8, 0x1B, 0x22, 0x23, 0x9B, 0x09, 0xAB, 0x6D, 0xA7, 0x1C, 0x72, 0x7F, 0xD4, 0x1C,
+    0x98, 0x90, 0x2E, 0x7B, 0x28, 0x9D, 0x7F, 0x3A, 0x95, 0xAD, 0x6C, 0xA4, 0xD2, 0xE1, 0xDF, 0x3B,
+    0x0C, 0x9E, 0xEA, 0x54, 0x4E, 0x65, 0x97, 0x62, 0xC2, 0x73, 0x8F, 0x54, 0xFC, 0xDC, 0x4E, 0xD4,
+    0x8A, 0xC8, 0x68, 0x44, 0xA6, 0xC3, 0x42, 0x21, 0x13, 0x3E, 0x5A, 0x2C, 0x54, 0x24, 0xFD, 0x71,
+    0x23, 0xE3, 0x03, 0x89, 0xED, 0x52, 0x30, 0x44, 0x22, 0xE1, 0x52, 0x02, 0x3F, 0x00, 0x47, 0x67,
+    0x50, 0x25, 0x0E, 0x2C, 0x41, 0x6A, 0x97, 0x12, 0x27, 0x75, 0x2E, 0xD2, 0x1A, 0x91, 0x5E, 0x27,
+    0x92, 0x4E, 0x68, 0x44, 0x82, 0x13, 0x89, 0xA5, 0xC8, 0x60, 0x45, 0xE6, 0xA4, 0x50, 0xE2, 0xAB,
+    0x7A, 0xB0, 0x63, 0xF5, 0x9B, 0x29, 0xF7, 0x80, 0xF9, 0xF5, 0x30, 0x37, 0x7E, 0xF9, 0xF1, 0xC7,
+    0x7B, 0x0F, 0x2A, 0xA2, 0x4F, 0xF1, 0x78, 0xCD, 0x79, 0x3E, 0xEB, 0xE9, 0xF8, 0xCF, 0x6B, 0x13,
+    0xF8, 0x5A, 0xB0, 0xF0, 0xA7, 0xF5, 0x06, 0xFC, 0x9F, 0xFE, 0x16, 0x6C, 0xAA, 0x6E, 0x19, 0x8B,
+    0x64, 0xF5, 0x56, 0x6B, 0x46, 0x49, 0xB7, 0xA4, 0x4E, 0xA6, 0x4A, 0xCB, 0xED, 0x3F, 0xFA, 0x4F,
+    0x20, 0xFE, 0x6F, 0xFF, 0x0B, 0xA6, 0xFD, 0x1F, 0xFF, 0x35, 0xF6, 0x1B, 0xFF, 0xE6, 0xDF, 0x70,
+    0x8E, 0x78, 0x8B, 0x4F, 0x2D, 0xFB, 0x75, 0x3D, 0xD1, 0xC1, 0xD5, 0x0D, 0x66, 0x72, 0xAD, 0x7B,
+    0x73, 0xCC, 0xFB, 0x06, 0xB1, 0x5D, 0x71, 0x77, 0x34, 0x83, 0xAB, 0x9B, 0x75, 0xB8, 0xF2, 0x9A,
+    0xF1, 0xE7, 0x6D, 0xBD, 0x9D, 0xFD, 0x38, 0xDA, 0x7A, 0xEF, 0x1C, 0xD1, 0x3E, 0x1B, 0x4E, 0x13,
+    0xCF, 0xEB, 0x7A, 0xB1, 0xB6, 0x99, 0x69, 0x6F, 0x5B, 0xDD, 0x9E, 0x01, 0xAE, 0x9C, 0x32, 0xDD,
+    0x90, 0xDF, 0x8D, 0xD6, 0xB4, 0x67, 0xB3, 0xFA, 0x4C, 0xD2, 0x5F, 0xAB, 0x70, 0x8A, 0x9B, 0x9B,
+    0xA6, 0x2B, 0x74, 0x57, 0xD0, 0x5B, 0x62, 0x16, 0x6E, 0x65, 0xF5, 0xCA, 0xD4, 0x67, 0x16, 0xF1,
+    0xCA, 0x06, 0xBA, 0x67, 0xBB, 0xCF, 0xEF, 0xAE, 0x8D, 0x55, 0xAB, 0xA2, 0xEE, 0xB2, 0x36, 0x0F,
+    0x26, 0xD2, 0x60, 0x3B, 0x46, 0x4E, 0xA1, 0x81, 0x27, 0xD0, 0x1D, 0x85, 0x67, 0x20, 0x0F, 0x7A,
+    0x50, 0x23, 0x13, 0xFB, 0x58, 0xF4, 0x23, 0x75, 0x41, 0x75, 0x8A, 0x3D, 0xCA, 0x97, 0x23, 0x14,
+    0x2D, 0xEE, 0x46, 0x00, 0x1B, 0x53, 0x9E, 0x36, 0xEB, 0x53, 0xCA, 0xCA, 0x8C, 0xC9, 0xD3, 0xEA,
+    0x99, 0x84, 0x1B, 0xC5, 0x24, 0xFF, 0xD9, 0xBC, 0x12, 0x01, 0xB6, 0x5C, 0x62, 0x77, 0xF6, 0xDD,
+    0x0C, 0x3B, 0x30, 0x15, 0x23, 0x4C, 0xE8, 0xA9, 0x1A, 0x51, 0x23, 0x68, 0x99, 0x31, 0xE3, 0x21,
+    0x77, 0x45, 0xF5, 0x6B, 0xA9, 0x93, 0x3B, 0x97, 0x16, 0xC8, 0x67, 0x9A, 0x08, 0xB8, 0x01, 0xD7,
+    0x83, 0x92, 0x96, 0x72, 0x84, 0x5C, 0xBC, 0x92, 0x19, 0xDC, 0x78, 0xC8, 0x81, 0x65, 0xCB, 0x30,
+    0x3F, 0xC2, 0x51, 0x1D, 0x83, 0x15, 0x6C, 0xC3, 0x6D, 0xE8, 0x51, 0x71, 0x89, 0x2E, 0xB2, 0x96,
+    0x3C, 0x60, 0x03, 0x45, 0x4D, 0xE9, 0x71, 0x70, 0x0D, 0xEE, 0xC0, 0xB8, 0x14, 0x97, 0xA7, 0x4C,
+    0x6A, 0xD1, 0xE1, 0x5A, 0xAA, 0x36, 0x25, 0x07, 0x58, 0x2A, 0x2D, 0x4D, 0x80, 0xE3, 0xF7, 0x53,
+    0x0A, 0xB9, 0x14, 0xF1, 0xF9, 0x0B, 0xCF, 0x77, 0x64, 0x61, 0x44, 0x47, 0x07, 0x83, 0xAD, 0xD9,
+    0xCC, 0x5A, 0x8A, 0x67, 0x23, 0xF9, 0xEB, 0x7D, 0xAA, 0x1E, 0xBD, 0x3F, 0x42, 0x33, 0x26, 0xF9,
+    0x95, 0x1D, 0x52, 0x63, 0xF5, 0xB8, 0x30, 0x99, 0x6E, 0xF1, 0xD3, 0xC7, 0xD6, 0x21, 0xC7, 0xB8,
+    0x78, 0xE7, 0xA6, 0x4E, 0xEA, 0xBE, 0xA2, 0x5F, 0x32, 0x36, 0xC9, 0x64, 0xBE, 0x21, 0x12, 0x3F,
+    0xC7, 0xA7, 0x3A, 0x7E, 0xFA, 0xCE, 0xE5, 0x4C, 0x62, 0x76, 0xB0, 0x2E, 0x6B, 0x0D, 0x60, 0xFE,
+    0xAB, 0x9B, 0x4B, 0xEC, 0xBC, 0x03, 0xFC, 0x93, 0x6D, 0xF8, 0xBD, 0xCF, 0x7B, 0x38, 0xAE, 0xE0,
+    0xF3, 0x7C, 0x9E, 0xE7, 0x1E, 0x7F, 0x63, 0xE3, 0xDC, 0x0F, 0x9E, 0x9F, 0x28, 0x7D, 0xE1, 0xB3,
+    0x83, 0xD3, 0x6F, 0x99, 0xFF, 0xF5, 0x7F, 0xFF, 0xE4, 0x93, 0xAA, 0x56, 0xF5, 0x21, 0xEB, 0x7C,
+    0x8A, 0xA5, 0xEC, 0x8D, 0x6E, 0x5D, 0x69, 0x9C, 0x1F, 0x8A, 0x2F, 0x6E, 0xAD, 0x6B, 0x4D, 0x1E,
+    0xD9, 0x39, 0x71, 0xCD, 0xAB, 0xE5, 0xF5, 0x62, 0x52, 0xD8, 0x5E, 0x93, 0xE0, 0x59, 0x58, 0xB3,
+    0xE4, 0x5B, 0x0F, 0x43, 0x8B, 0x81, 0x42, 0x3C, 0x8D, 0x44, 0x2B, 0x33, 0x65, 0x5D, 0x7D, 0xAB,
+    0xCF, 0x7B, 0x55, 0x33, 0x7E, 0x9A, 0xA2, 0x4E, 0xEC, 0xDC, 0x12, 0x3A, 0xD9, 0x24, 0x20, 0x52,
+    0x43, 0x2A, 0x35, 0x59, 0x12, 0x99, 0x59, 0x77, 0xF8, 0x9F, 0x4C, 0x9F, 0x8A, 0xEC, 0x27, 0x28,
+    0x52, 0xF5, 0x68, 0x91, 0xD4, 0x91, 0x76, 0x84, 0xA2, 0x43, 0xCD, 0x69, 0x54, 0x97, 0x22, 0x50,
+    0x33, 0x1C, 0x5E, 0x42, 0x95, 0x26, 0xE3, 0xF8, 0x45, 0xF8, 0x07, 0x1F, 0x75, 0xF0, 0xE3, 0x92,
+    0x3A, 0xAD, 0xD1, 0xC3, 0x61, 0x69, 0x11, 0x95, 0xFF, 0x1B, 0x72, 0x04, 0x5A, 0xEA, 0xA5, 0x14,
+    0x2A, 0xFF, 0x45, 0xD5, 0xE6, 0x3A, 0xE8, 0x21, 0xAF, 0xC1, 0x99, 0x16, 0xEC, 0xDD, 0x08, 0xA6,
+    0xDB, 0x03, 0xDD, 0x6F, 0x01, 0x63, 0x01, 0xDC, 0xC9, 0x03, 0xEC, 0x9B, 0x0E, 0xF6, 0x55, 0x8F,
+    0x12, 0xF6, 0xC8, 0x66, 0x1C, 0xD9, 0x4C, 0x51, 0xEB, 0x91, 0xBC, 0x65, 0xC6, 0x44, 0x9C, 0x4F,
+    0xB9, 0xE6, 0x7D, 0xF2, 0x48, 0xE9, 0x8F, 0xE8, 0x5C, 0x21, 0x8B, 0xD8, 0xDA, 0x8C, 0xE4, 0xAD,
+    0x12, 0x4C, 0x8F, 0xD4, 0x7A, 0x3C, 0x5A, 0x77, 0xBC, 0xCE, 0x6B, 0xA6, 0x12, 0x2D, 0x73, 0xF0,
+    0x95, 0x08, 0xEA, 0x0C, 0x65, 0x0D, 0x49, 0xF9, 0x78, 0x0E, 0x6C, 0x8D, 0x69, 0x51, 0x3D, 0xAC,
+    0xA0, 0x84, 0x3C, 0x60, 0x3A, 0x18, 0x52, 0xEF, 0x3D, 0xCE, 0xA3, 0x23, 0xB6, 0x03, 0x47, 0x3E,
+    0x80, 0xE9, 0xF2, 0x09, 0xB8, 0xB3, 0xE8, 0xE0, 0xCA, 0x00, 0x0C, 0x09, 0x3F, 0xF9, 0x14, 0x65,
+    0x66, 0x29, 0x1E, 0xDD, 0x87, 0x75, 0xC4, 0xFF, 0x99, 0xA3, 0x31, 0x4E, 0x9F, 0x4A, 0x64, 0x70,
+    0x1E, 0x6C, 0xCC, 0x7A, 0xD0, 0x92, 0x2A, 0xB3, 0x3E, 0x42, 0x2F, 0x27, 0xA5, 0x49, 0xE6, 0x1F,
+    0x14, 0xBD, 0xEB, 0xF6, 0x48, 0x29, 0x4A, 0xFF, 0x40, 0x57, 0xBE, 0xE8, 0x82, 0x4E, 0x03, 0xAA,
+    0xB7, 0x00, 0x53, 0x5E, 0x03, 0xD5, 0xB3, 0x01, 0x70, 0xAF, 0xB7, 0x1C, 0xD6, 0xF6, 0x2C, 0x97,
+    0x6D, 0xAF, 0x4B, 0x22, 0xD6, 0x02, 0xBA, 0x45, 0xFD, 0x90, 0xD7, 0x0F, 0x9E, 0x66, 0xBA, 0x23,
+    0x97, 0x0D, 0x77, 0x00, 0xB6, 0x1D, 0xC0, 0x66, 0x82, 0x40, 0x36, 0x3E, 0xB8, 0x2C, 0xE5, 0x87,
+    0xDB, 0x75, 0x18, 0xF7, 0xE0, 0xB2, 0xB5, 0xCC, 0xF1, 0x70, 0x07, 0x1C, 0x7D, 0xDA, 0x89, 0x87,
+    0x14, 0x35, 0x17, 0xF5, 0x7F, 0xF9, 0xF8, 0xB1, 0x4F, 0x3E, 0xFE, 0xE9, 0xFF, 0xEB, 0xFC, 0xFF,
+    0x7C, 0x7E, 0xE3, 0xC2, 0x2D, 0x17, 0x8B, 0x9A, 0xC7, 0x38, 0xC3, 0x6D, 0xFD, 0x4E, 0xFE, 0xF9,
+    0x8D, 0x2B, 0x6E, 0xA4, 0xA3, 0xD5, 0xAD, 0x99, 0x8F, 0xF1, 0x38, 0x9F, 0xA4, 0xE8, 0xD8, 0x60,
+    0xE3, 0xC9, 0xAB, 0x55, 0xBC, 0x5C, 0xD3, 0xD0, 0xD2, 0xF2, 0x4F, 0xDA, 0xCD, 0xA7, 0x9F, 0x30,
+    0xE6, 0xB9, 0xBA, 0x09, 0xC7, 0x3D, 0xD5, 0x40, 0x9B, 0x73, 0x5E, 0x87, 0x13, 0xDC, 0xCC, 0xC2,
+    0x26, 0xAF, 0xC1, 0xD7, 0xF8, 0x71, 0xFD, 0xDA, 0x57, 0xCF, 0xBC, 0x64, 0x62, 0xF6, 0xBC, 0x79,
+    0xE6, 0x6E, 0xB8, 0x79, 0xF5, 0x56, 0xDE, 0xA3, 0x46, 0xFD, 0xCD, 0x3A, 0x5C, 0xB9, 0x72, 0xE6,
+    0xD4, 0x9F, 0x68, 0x41, 0x85, 0x77, 0x5B, 0xD7, 0xC2, 0x4B, 0x37, 0x6A, 0x1A, 0x89, 0xC8, 0x9F,
+    0xF6, 0x6A, 0x64, 0xD0, 0x3D, 0x83, 0x89, 0xF4, 0x59, 0xAB, 0xFA, 0x3C, 0xE8, 0x68, 0x83, 0x89,
+    0x45, 0xC8, 0xBA, 0xB2, 0xCE, 0x3B, 0xE7, 0x6D, 0x5B, 0x61, 0x43, 0x43, 0x11, 0xF8, 0xC3, 0x9A,
+    0xEE, 0xF3, 0x26, 0x7C, 0x3E, 0xE3, 0xBC, 0x7D, 0xFA, 0xFC, 0x89, 0xD5, 0x95, 0xB3, 0x17, 0x6E,
+    0x6E, 0x3C, 0xD9, 0xAD, 0x4C, 0xBB, 0x55, 0x04, 0x27, 0xBE, 0x9C, 0xC8, 0xDF, 0x81, 0x8B, 0x5B,
+    0xB4, 0x9F, 0xD4, 0xE1, 0x82, 0xF1, 0x57, 0xAA, 0x7B, 0x33, 0xA8, 0x86, 0x8B, 0xAF, 0x71, 0x86,
+    0x27, 0x38, 0xCD, 0x39, 0x76, 0xA8, 0x7A, 0x37, 0xA2, 0x07, 0x54, 0xCD, 0x75, 0xDB, 0xF1, 0x39,
+    0x72, 0xCC, 0x37, 0x24, 0x54, 0x35, 0x3C, 0xC6, 0xC6, 0x32, 0x28, 0x2F, 0xB9, 0x91, 0x8E, 0x4E,
+    0xB7, 0x90, 0x8D, 0x9F, 0x4C, 0x83, 0x72, 0x9E, 0xF3, 0x4F, 0xDE, 0xAC, 0xBA, 0x3F, 0xF1, 0x47,
+    0x06, 0xE5, 0x84, 0x31, 0x3A, 0x7C, 0xD8, 0x16, 0x2D, 0x28, 0x69, 0x0D, 0x17, 0x54, 0xB0, 0xBC,
+    0x64, 0xC2, 0x69, 0xA2, 0xF2, 0xF0, 0x35, 0x7E, 0x1C, 0x5E, 0xBB, 0x72, 0xE6, 0xBC, 0xE9, 0xB3,
+    0xE7, 0x8D, 0xBF, 0x1B, 0xAE, 0xFC, 0xE3, 0xAB, 0x0F, 0x86, 0xE5, 0xAB, 0x67, 0x4E, 0x9D, 0x3E,
+    0x32, 0x2C, 0x98, 0x7A, 0xBD, 0x79, 0xB2, 0x00, 0x3D, 0x09, 0x48, 0x2F, 0xFA, 0x74, 0xB2, 0x00,
+    0x03, 0x14, 0x69, 0xF9, 0xAC, 0xD2, 0x57, 0x03, 0x58, 0x8F, 0x8A, 0x50, 0xA6, 0x1C, 0xC3, 0x66,
+    0xB2, 0x98, 0x9B, 0x87, 0xD1, 0x9B, 0x09, 0x0F, 0x9D, 0xEC, 0x58, 0x44, 0xF4, 0x94, 0xC0, 0x57,
+    0x61, 0x95, 0xAE, 0xB3, 0x35, 0x6C, 0xA6, 0xC5, 0x95, 0x87, 0x07, 0xBF, 0xA6, 0xB3, 0x3A, 0xA6,
+    0x75, 0x35, 0xA4, 0x56, 0x6C, 0xA6, 0x4B, 0x8A, 0xB4, 0x61, 0xAC, 0x87, 0xDB, 0xE9, 0xAA, 0xED,
+    0xF4, 0xFD, 0x47, 0x7E, 0xE4, 0x01, 0xF6, 0x92, 0x59, 0x1D, 0xA0, 0xA8, 0x97, 0x77, 0x3B, 0x5C,
+    0x3D, 0x0D, 0x10, 0x57, 0x80, 0xEE, 0x6E, 0x03, 0x26, 0x44, 0x20, 0xFF, 0x66, 0x77, 0xA8, 0x0D,
+    0x6B, 0x24, 0x42, 0x2E, 0xD2, 0x82, 0x1B, 0x36, 0x01, 0x89, 0xDB, 0x60, 0xA4, 0xED, 0xC1, 0x7E,
+    0x70, 0x37, 0x42, 0xF1, 0x23, 0x13, 0xC0, 0xFD, 0xB7, 0x79, 0x0D, 0xCD, 0xCA, 0x02, 0xD3, 0xED,
+    0x73, 0xA0, 0xA6, 0xB8, 0x02, 0x2D, 0xED, 0x2D, 0xD0, 0x72, 0x37, 0x82, 0x91, 0x6F, 0xB5, 0x60,
+    0xE4, 0xC3, 0xFF, 0x3B, 0x62, 0x64, 0x21, 0x2E, 0xA5, 0x05, 0x11, 0x09, 0x4B, 0xB9, 0x83, 0xF9,
+    0x0B, 0x99, 0xFD, 0xBA, 0x01, 0x26, 0x00, 0xE7, 0xF2, 0x1A, 0x58, 0x59, 0x80, 0x5B, 0x67, 0x1F,
+    0xF5, 0x34, 0x47, 0x54, 0xF3, 0x4A, 0xAE, 0x2F, 0x1C, 0x54, 0x12, 0x4B, 0xA4, 0x9C, 0x51, 0xB3,
+    0x7E, 0xAF, 0x0A, 0x7A, 0xE0, 0x1F, 0x45, 0x9C, 0xCF, 0x85, 0x2C, 0x32, 0x3D, 0x49, 0x83, 0x05,
+    0x3B, 0xE8, 0x0E, 0xA4, 0xDB, 0x7C, 0x0C, 0x2B, 0x1F, 0xDE, 0xFB, 0x1D, 0xAA, 0xF9, 0x8F, 0x50,
+    0xB0, 0xEF, 0x40, 0x21, 0x03, 0x66, 0xFE, 0x2F, 0x7A, 0x8A, 0x40, 0xCD, 0xDE, 0x61, 0xAC, 0xE9,
+    0x81, 0xFD, 0xDD, 0xEF, 0xA5, 0x77, 0xE6, 0x94, 0x22, 0x3E, 0x39, 0xD7, 0x22, 0x25, 0xF4, 0x02,
+    0x95, 0xCC, 0xF0, 0xE5, 0x9F, 0x5D, 0x4C, 0x81, 0x82, 0x5E, 0xB3, 0x78, 0xC5, 0x00, 0x4A, 0x76,
+    0xFF, 0x2C, 0xB5, 0xC1, 0x1D, 0x4D, 0x9C, 0x3F, 0xE5, 0xB1, 0x01, 0x1B, 0xC9, 0x3A, 0xB2, 0x11,
+    0xD3, 0x63, 0xC4, 0x33, 0x82, 0xB4, 0xEC, 0x43, 0x35, 0xE0, 0x3C, 0x4E, 0xB0, 0x01, 0xFB, 0x56,
+    0xC8, 0x23, 0xF9, 0x7B, 0xBD, 0xE9, 0x31, 0xC3, 0xAC, 0x46, 0xD4, 0xE4, 0xEA, 0x86, 0x42, 0x44,
+    0x44, 0x5E, 0x48, 0x99, 0xFA, 0xA2, 0x73, 0xCF, 0x47, 0xF2, 0xDE, 0xBE, 0xDD, 0x63, 0x46, 0x7D,
+    0x30, 0xA2, 0x84, 0xAA, 0x81, 0xA6, 0xB6, 0x52, 0xA7, 0x64, 0x0D, 0x45, 0x44, 0x22, 0xF9, 0x48,
+    0x39, 0xAC, 0x05, 0x89, 0x4A, 0xA4, 0x87, 0xE9, 0x8B, 0x02, 0x5B, 0xE4, 0x2D, 0x85, 0xA7, 0xCF,
+    0x44, 0x44, 0x5E, 0xBF, 0x71, 0x7F, 0xB7, 0xB9, 0xAE, 0x06, 0xAA, 0x9A, 0x46, 0x24, 0xE0, 0x44,
+    0xEA, 0x54, 0x67, 0x96, 0x77, 0xEB, 0x02, 0x00, 0x35, 0x1E, 0xCE, 0x8B, 0xAB, 0xD7, 0x84, 0x4E,
+    0xDE, 0xAF, 0x59, 0x9D, 0xC4, 0xF2, 0x24, 0x4D, 0x66, 0x2A, 0x71, 0x87, 0x22, 0x81, 0xB6, 0xB3,
+    0x5F, 0xEA, 0x52, 0x10, 0xB3, 0x14, 0xCE, 0x45, 0x80, 0x2B, 0xE9, 0xC7, 0x4D, 0x1D, 0x01, 0x62,
+    0xDE, 0x92, 0x0F, 0xDC, 0x6F, 0x02, 0x6E, 0xD4, 0x22, 0x9E, 0x5B, 0xA9, 0x1A, 0xAB, 0x4D, 0x9C,
+    0x7B, 0x4B, 0xD6, 0x3B, 0x18, 0xC8, 0x5B, 0x0B, 0x4D, 0x6D, 0x43, 0x01, 0x65, 0xB4, 0xA1, 0x00,
+    0xFA, 0x22, 0x94, 0x40, 0x5F, 0xD6, 0x0E, 0xF3, 0x6E, 0xEF, 0xBC, 0xC3, 0x4A, 0x74, 0x54, 0x94,
+    0xD2, 0x56, 0x34, 0xE4, 0xE2, 0x13, 0x10, 0x3B, 0x0B, 0x59, 0x9D, 0x7B, 0xF4, 0x52, 0x7C, 0x10,
+    0xE1, 0x2A, 0x2B, 0x38, 0x8B, 0x25, 0x5A, 0xDC, 0xFA, 0x4D, 0x32, 0xD3, 0xB1, 0x9D, 0xCB, 0xBF,
+    0x78, 0x1F, 0x6B, 0x87, 0x6D, 0xCC, 0x9B, 0xFF, 0xE1, 0x2C, 0xBC, 0xF7, 0xC1, 0x8F, 0x60, 0xF3,
+    0xFD, 0x0F, 0x02, 0x76, 0xBC, 0xD6, 0x61, 0xE6, 0x22, 0x2E, 0x79, 0x65, 0x57, 0xCF, 0x60, 0x5B,
+    0xE7, 0xC9, 0xA2, 0x0D, 0xA8, 0xC1, 0x74, 0xC0, 0xDF, 0x7F, 0x31, 0xE5, 0x85, 0xD3, 0x5E, 0x1C,
+    0x59, 0x31, 0x53, 0xB1, 0xCD, 0x40, 0xC1, 0x6D, 0x15, 0xB1, 0xF4, 0xA6, 0xC3, 0xAA, 0x68, 0xDA,
+    0xCF, 0x59, 0x1D, 0xB3, 0x70, 0xFB, 0xB4, 0xE9, 0xF2, 0xD0, 0x9F, 0x35, 0xAD, 0xAD, 0xE3, 0x66,
+    0x16, 0xAC, 0x8F, 0x67, 0xF2, 0x50, 0xA8, 0x0E, 0x5B, 0x9F, 0x53, 0x1D, 0x05, 0x9B, 0x2A, 0x52,
+    0xB2, 0x62, 0x60, 0x9F, 0x6D, 0x9A, 0x77, 0x27, 0x9E, 0x4C, 0xA2, 0x14, 0xF8, 0x6F, 0xC6, 0xA5,
+    0x10, 0x34, 0x55, 0x28, 0xAE, 0x96, 0x54, 0xB4, 0x93, 0xF4, 0xCA, 0x9D, 0x2C, 0x76, 0x18, 0xF9,
+    0xF7, 0xD0, 0xBB, 0xC0, 0x4A, 0x0D, 0xE4, 0x14, 0x9E, 0x4E, 0x47, 0x4E, 0xB3, 0x85, 0x8E, 0x45,
+    0x9B, 0x6E, 0x24, 0x12, 0x30, 0xB2, 0x9D, 0xFC, 0x9F, 0x13, 0xE9, 0xB2, 0x94, 0xF4, 0x49, 0x9F,
+    0x4B, 0x8B, 0xF8, 0xCF, 0xCA, 0x08, 0x72, 0xF1, 0xE2, 0x52, 0x93, 0xBC, 0xA8, 0x1C, 0xB4, 0x48,
+    0x4B, 0x21, 0xE2, 0x1F, 0x48, 0x2D, 0xF2, 0x24, 0x1A, 0x1E, 0x97, 0x58, 0xB4, 0xF0, 0xEB, 0x94,
+    0xEE, 0x00, 0xE4, 0xF3, 0xA5, 0x45, 0x53, 0x53, 0x4A, 0x07, 0x27, 0xD7, 0x14, 0x6A, 0xF1, 0xE0,
+    0x6D, 0x3E, 0xF3, 0x7C, 0x63, 0x58, 0xE2, 0xFF, 0x01, 0x50, 0xFD, 0x93, 0x60, 0x3E, 0xEC, 0x16,
+    0x72, 0xF3, 0xF2, 0x01, 0x18, 0xE9, 0xC0, 0x7C, 0xFB, 0x27, 0x1E, 0x0A, 0xF1, 0x89, 0x7A, 0xCC,
+    0xA4, 0x5E, 0x8E, 0x3E, 0xDD, 0xAC, 0xD9, 0x46, 0x35, 0xB3, 0x10, 0x6B, 0x66, 0x3C, 0xA4, 0x21,
+    0x8D, 0x4C, 0xAC, 0x6D, 0xA4, 0xFD, 0xD9, 0x97, 0xE3, 0x52, 0x04, 0x65, 0x93, 0x2E, 0xC5, 0xA1,
+    0x63, 0xDA, 0x76, 0x3D, 0x77, 0xB8, 0x9C, 0xCC, 0x5D, 0xBD, 0x64, 0x27, 0x52, 0x2E, 0x37, 0x59,
+    0xAA, 0xF4, 0x2E, 0x97, 0x04, 0x77, 0x12, 0xD8, 0x49, 0x4C, 0x42, 0x91, 0x94, 0x08, 0xED, 0xA1,
+    0xC8, 0x8B, 0x2A, 0x1C, 0xD9, 0x22, 0x4B, 0x90, 0x91, 0xE2, 0x9A, 0xEE, 0xB0, 0xBA, 0xF7, 0xAC,
+    0x87, 0x4F, 0x88, 0xB4, 0x94, 0x22, 0x3D, 0xEE, 0xA0, 0x3B, 0x86, 0xEB, 0x5E, 0x02, 0xD7, 0x6E,
+    0x40, 0xD1, 0x59, 0xB0, 0xD1, 0xD4, 0x98, 0x5E, 0xB5, 0xE8, 0x91, 0x9B, 0x30, 0xB3, 0x01, 0xCE,
+    0xDB, 0xEF, 0x52, 0x04, 0x23, 0xF2, 0x7C, 0x54, 0xBF, 0x94, 0x9F, 0x8C, 0xDC, 0xB4, 0xAF, 0x09,
+    0xAB, 0x2C, 0xB8, 0x78, 0xC2, 0xC4, 0x5C, 0xDE, 0xBD, 0x37, 0x28, 0x11, 0x99, 0x93, 0x3E, 0xCC,
+    0x88, 0x48, 0xCD, 0x49, 0xF9, 0x77, 0xEB, 0x68, 0xEE, 0x48, 0x61, 0xEB, 0x92, 0x7E, 0x93, 0x77,
+    0x96, 0x92, 0xB6, 0xE5, 0x47, 0x0D, 0x3C, 0xA9, 0x16, 0xE0, 0x95, 0x64, 0x15, 0xCB, 0xDB, 0xBF,
+    0xD6, 0xC5, 0x04, 0xCE, 0xA7, 0xD9, 0x4B, 0xEF, 0xC2, 0x11, 0x19, 0xF8, 0xC3, 0xDD, 0xDD, 0xDD,
+    0xDD, 0xD7, 0xD6, 0xB7, 0xFC, 0xFA, 0xEE, 0xEE, 0xEE, 0xEE, 0x6B, 0x89, 0x47, 0xEA, 0x6C, 0x32,
+    0x65, 0x89, 0x29, 0xA3, 0x98, 0x51, 0x75, 0xBA, 0xBA, 0x4B, 0x8A, 0xA8, 0x98, 0xAA, 0xC3, 0x87,
+    0xA4, 0x9B, 0x18, 0x81, 0x93, 0x1F, 0x31, 0xE5, 0x99, 0x47, 0x07, 0x88, 0x1C, 0x97, 0x3A, 0x97,
+    0xCE, 0xDE, 0x23, 0x7F, 0x3B, 0x98, 0xAE, 0x53, 0xF1, 0x0A, 0xC3, 0x06, 0x9B, 0x27, 0x28, 0x9E,
+    0xF3, 0xD9, 0x5F, 0x06, 0x35, 0x47, 0x9C, 0x84, 0x4C, 0x46, 0xCA, 0x79, 0x19, 0x71, 0x44, 0x44,
+    0x3A, 0x75, 0xE9, 0xD2, 0xA5, 0x4B, 0x8F, 0x8A, 0xB2, 0x46, 0x1A, 0x11, 0xE9, 0xF4, 0x77, 0xBF,
+    0xF2, 0xE3, 0x4B, 0xCB, 0x02, 0x5F, 0xD8, 0xE2, 0x54, 0x6C, 0xE5, 0x1E, 0xBC, 0x53, 0x29, 0x9D,
+    0xA8, 0x0E, 0x51, 0xE2, 0x32, 0xF5, 0x95, 0x7F, 0x70, 0x22, 0x1E, 0x9E, 0x30, 0x47, 0x4E, 0xB0,
+    0xBB, 0xFB, 0xBD, 0x4C, 0xA4, 0xE3, 0xF4, 0x02, 0xE5, 0x6E, 0xF2, 0x89, 0x1F, 0xFC, 0xD2, 0x37,
+    0x32, 0x41, 0x0F, 0x45, 0xA0, 0x1A, 0xD0, 0x52, 0x27, 0x42, 0x71, 0x91, 0x89, 0x9A, 0x98, 0x86,
+    0xBC, 0x4A, 0xF7, 0x5A, 0x23, 0x6B, 0xD3, 0x26, 0xE8, 0xB7, 0xFD, 0x19, 0xCC, 0xBB, 0x91, 0x62,
+    0xF6, 0xF9, 0xEC, 0xA9, 0x22, 0xEA, 0x85, 0x97, 0x03, 0x6E, 0x26, 0x93, 0x5A, 0x49, 0xC8, 0x5E,
+    0xB8, 0xC3, 0xB6, 0x8A, 0x36, 0xE4, 0xFF, 0x7A, 0xC0, 0x09, 0x3C, 0x9C, 0xDE, 0x5A, 0xEC, 0x06,
+    0xA6, 0x06, 0xB5, 0x0F, 0x4A, 0x26, 0xA8, 0x24, 0x62, 0xFF, 0x83, 0x43, 0xBF, 0xDF, 0x45, 0xB6,
+    0x4E, 0x59, 0xB2, 0xD7, 0x43, 0xE4, 0xD6, 0xEA, 0x04, 0xD6, 0x7C, 0xA3, 0x25, 0xBE, 0xB4, 0xC1,
+    0xA9, 0xDC, 0x04, 0x1D, 0xE2, 0x05, 0x56, 0x27, 0x72, 0x6F, 0xEE, 0xB6, 0x91, 0xAB, 0x1B, 0x05,
+    0xD9, 0xB7, 0xEE, 0x76, 0x87, 0x3A, 0xF8, 0xF5, 0x16, 0xFB, 0x4A, 0x7C, 0x50, 0x67, 0x48, 0x4F,
+    0xDA, 0x62, 0x6C, 0x61, 0x22, 0xEC, 0x50, 0xB6, 0x5C, 0x12, 0x91, 0x3A, 0xBD, 0x0C, 0x4E, 0x8B,
+    0xC8, 0xF5, 0xB5, 0xF8, 0xDC, 0xF4, 0xC0, 0x27, 0x7E, 0x70, 0xFF, 0xFB, 0xA4, 0x57, 0x2D, 0x2D,
+    0xEF, 0x5A, 0x5A, 0xC4, 0x95, 0xE5, 0xC7, 0x6C, 0x31, 0xCD, 0xC3, 0x2F, 0x2A, 0x8A, 0x28, 0xD5,
+    0xAA, 0x7D, 0x73, 0xB7, 0x39, 0xB0, 0xCD, 0x4C, 0x39, 0xFB, 0x04, 0x79, 0xD6, 0x92, 0xA3, 0x69,
+    0x81, 0x02, 0x9F, 0x58, 0x8F, 0xC9, 0x67, 0x93, 0xD3, 0xCB, 0x05, 0x2A, 0xA9, 0xF5, 0x6F, 0xFE,
+    0xBC, 0xB3, 0xDF, 0xBA, 0xDB, 0xEF, 0x98, 0xB0, 0x7D, 0x25, 0xAB, 0x9F, 0x3C, 0x64, 0xED, 0xD6,
+    0xEF, 0xE9, 0x39, 0xBB, 0x3C, 0xE7, 0x42, 0xD2, 0x92, 0x25, 0x60, 0x7E, 0x0B, 0x58, 0xE1, 0x39,
+    0xCD, 0xBE, 0xCF, 0xFD, 0xE5, 0xF9, 0xD9, 0xA0, 0x9A, 0xB9, 0x43, 0x35, 0x7D, 0x5A, 0x21, 0xEB,
+    0xD7, 0xCD, 0x5D, 0x5B, 0xD6, 0xD8, 0xB2, 0xC4, 0x57, 0xCB, 0xDF, 0xB3, 0xCB, 0xBD, 0xD7, 0xCF,
+    0xC9, 0x3D, 0x9F, 0xCF, 0xEA, 0x27, 0x77, 0x4C, 0xD8, 0xB6, 0xDF, 0xBC, 0x3B, 0xE8, 0xF7, 0x7F,
+    0xBA, 0xBC, 0xCF, 0x4D, 0x16, 0x07, 0xFD, 0xD9, 0x44, 0x2D, 0xD6, 0x70, 0x13, 0x4C, 0x4D, 0x06,
+    0x18, 0xCF, 0x05, 0x20, 0xC7, 0x84, 0x93, 0x6F, 0x5D, 0xB7, 0x3C, 0x5D, 0x1E, 0x9C, 0x9C, 0x9F,
+    0x40, 0x0E, 0x50, 0xCD, 0x68, 0xDF, 0x01, 0x8E, 0x8F, 0x85, 0x07, 0xB2, 0xB6, 0xF0, 0xC0, 0x0E,
+    0xD6, 0x43, 0x16, 0xB0, 0x0F, 0xBF, 0xE2, 0x29, 0x2D, 0x55, 0x1B, 0xC9, 0x24, 0xE8, 0x3F, 0x2F,
+    0x54, 0xBC, 0x79, 0xFB, 0xC2, 0x09, 0x5D, 0xD3, 0xC2, 0xD3, 0x69, 0x05, 0x5D, 0x48, 0x6F, 0x89,
+    0xB9, 0x92, 0x8C, 0xDB, 0x95, 0x74, 0x74, 0x21, 0x7D, 0xF7, 0x34, 0x8A, 0x8E, 0x95, 0x35, 0x75,
+    0x7F, 0xB3, 0x57, 0x7F, 0xF5, 0x27, 0x18, 0xA9, 0xC9, 0x63, 0x7A, 0xA7, 0xCC, 0x7F, 0xC7, 0xEF,
+    0xCB, 0x98, 0xC9, 0x9F, 0x61, 0x7B, 0xD8, 0x1A, 0x20, 0xCE, 0x98, 0x50, 0x79, 0x4B, 0xD9, 0xAE,
+    0xC8, 0xBB, 0x48, 0xF6, 0x63, 0x0F, 0x98, 0xEF, 0x80, 0x95, 0x5F, 0xC0, 0x97, 0x25, 0x55, 0x75,
+    0xCE, 0x91, 0xF2, 0x8D, 0x90, 0xF5, 0x56, 0xCD, 0xAC, 0x5C, 0xCD, 0xAF, 0x22, 0xD9, 0x9A, 0xBB,
+    0xD9, 0x48, 0x95, 0x85, 0x90, 0xFB, 0x0D, 0x13, 0x56, 0xBA, 0xBD, 0x40, 0x7C, 0x89, 0xFE, 0x26,
+    0xDB, 0x91, 0xCD, 0x8E, 0xA2, 0xFD, 0x57, 0x5F, 0x09, 0x22, 0xE1, 0xD8, 0xA1, 0x45, 0xE6, 0x3C,
+    0xDC, 0x86, 0xF8, 0x92, 0xEE, 0x2E, 0x98, 0xB0, 0xCA, 0xEA, 0x0D, 0xCB, 0x13, 0xA7, 0x39, 0xB1,
+    0x22, 0xBF, 0x4A, 0x16, 0x31, 0xEF, 0xFF, 0x0B, 0x23, 0xA2, 0xE7, 0x8B, 0xC0, 0xFF, 0x03, 0x75,
+    0x95, 0xB1, 0x8F, 0x1C, 0xB7, 0x15, 0xC6, 0x7F, 0x24, 0x63, 0x0D, 0x20, 0x5A, 0xA2, 0x8A, 0xA4,
+    0xC9, 0x5D, 0x3C, 0x2A, 0x52, 0x5C, 0x71, 0xB8, 0x71, 0x71, 0xC5, 0x15, 0xBB, 0x3B, 0x4C, 0x84,
+    0xF4, 0x2E, 0xAC, 0x18, 0x48, 0x0A, 0xB9, 0x4C, 0x15, 0x5F, 0xA1, 0xC2, 0xC5, 0xDE, 0xED, 0x48,
+    0xFF, 0x80, 0x5D, 0x24, 0x75, 0xAE, 0x88, 0x61, 0x24, 0x2E, 0xD2, 0xA8, 0x30, 0xE0, 0xD5, 0x0D,
+    0x55, 0xA7, 0x61, 0x60, 0xA8, 0xA7, 0x11, 0x05, 0x01, 0x92, 0x42, 0x0C, 0x30, 0x01, 0x46, 0xF2,
+    0xEC, 0xBE, 0x14, 0xB3, 0xA3, 0x3B, 0x15, 0x21, 0x40, 0x62, 0xC8, 0xE1, 0x7C, 0xF3, 0xBE, 0xEF,
+    0x7B, 0x7C, 0xA4, 0x01, 0x4C, 0x03, 0x54, 0x00, 0x19, 0x28, 0x1A, 0x60, 0x06, 0x68, 0x11, 0x19,
+    0x4A, 0x80, 0x35, 0xC0, 0x39, 0xC0, 0x4A, 0x44, 0xA8, 0x3D, 0x50, 0x33, 0x0D, 0x27, 0x4C, 0xED,
+    0x07, 0x00, 0x0F, 0x8F, 0x41, 0xE5, 0x19, 0xD8, 0xBC, 0x82, 0x3A, 0x7D, 0x13, 0xE8, 0xE3, 0xDF,
+    0x53, 0xF1, 0x5D, 0xF8, 0x5B, 0x57, 0xFE, 0xFC, 0x59, 0x58, 0xCF, 0xCC, 0xE3, 0x70, 0x72, 0xC7,
+    0xDC, 0x6B, 0xA0, 0x30, 0x1E, 0x6C, 0x01, 0xDC, 0x72, 0xC0, 0xBB, 0xB7, 0x81, 0xFD, 0x9F, 0x00,
+    0x07, 0x87, 0xC0, 0xF1, 0x09, 0xF0, 0xFE, 0x31, 0x00, 0x77, 0x00, 0x15, 0x01, 0x1B, 0x00, 0x07,
+    0xF0, 0x1E, 0xC0, 0xCC, 0x88, 0xC8, 0x00, 0xF0, 0x35, 0xA0, 0x33, 0x70, 0xEE, 0x44, 0x24, 0x02,
+    0x1B, 0xC0, 0xC6, 0x29, 0xFE, 0xB8, 0x0B, 0xF2, 0xE3, 0x8F, 0x81, 0xD3, 0xE3, 0x09, 0xFF, 0xE4,
+    0x10, 0x38, 0xDC, 0x07, 0xDE, 0xBD, 0x05, 0xDC, 0xBA, 0x0D, 0xDC, 0xB4, 0x40, 0x51, 0xC0, 0x43,
+    0x63, 0x9A, 0xF7, 0xCF, 0xCD, 0xBD, 0xB0, 0x76, 0x8F, 0x1F, 0x3F, 0xEB, 0xF4, 0x7F, 0x9E, 0x7D,
+    0x9B, 0x78, 0x1A, 0xFF, 0x1D, 0x28, 0x53, 0x0B, 0x26, 0x2F, 0x81, 0x7C, 0x0C, 0xFC, 0xF4, 0xEE,
+    0x0E, 0xBE, 0x01, 0x05, 0x27, 0xA0, 0x22, 0x15, 0xF0, 0x35, 0x0E, 0x70, 0x14, 0x0D, 0xA8, 0x64,
+    0x02, 0x30, 0xD3, 0x22, 0x22, 0xF2, 0x2C, 0x03, 0x74, 0x6B, 0x80, 0xBA, 0x48, 0xC0, 0x39, 0x2B,
+    0x11, 0xD9, 0x60, 0x3A, 0xD8, 0x40, 0x0D, 0x03, 0x98, 0xCC, 0x1A, 0x38, 0x61, 0xFF, 0x8D, 0xCE,
+    0x06, 0x70, 0x11, 0x8E, 0x36, 0xB0, 0x6C, 0xA3, 0xCA, 0x5F, 0x0E, 0x45, 0xBE, 0x38, 0x2D, 0xF3,
+    0x05, 0xE7, 0xA7, 0x17, 0x1C, 0x9C, 0x5E, 0xC0, 0xFF, 0xE9, 0x07, 0xA7, 0xE3, 0x9E, 0x32, 0x5F,
+    0x50, 0xE4, 0x8B, 0x53, 0x95, 0xBF, 0x1C, 0x58, 0xB6, 0x91, 0xA3, 0x61, 0xC4, 0xD4, 0x00, 0x94,
+    0x1E, 0x68, 0x3D, 0x70, 0x04, 0xF0, 0x29, 0xA0, 0xE3, 0x24, 0xFC, 0x6C, 0xF4, 0xC2, 0xF6, 0x0E,
+    0x25, 0xC3, 0xA7, 0x54, 0xCD, 0x37, 0x41, 0xF5, 0x08, 0xAE, 0xD1, 0x1D, 0x67, 0xD8, 0xA0, 0x33,
+    0x73, 0x6C, 0xD0, 0x89, 0xEA, 0x79, 0x0B, 0xB5, 0x74, 0xD0, 0x8A, 0x87, 0x4F, 0x12, 0x57, 0xED,
+    0x86, 0x5C, 0xCC, 0xC0, 0x8A, 0xBC, 0xF4, 0x14, 0xF2, 0x4B, 0x89, 0x28, 0xF1, 0x66, 0x80, 0x55,
+    0xC3, 0x2A, 0xE2, 0x32, 0xD5, 0x16, 0x3D, 0x60, 0xFF, 0x9A, 0xA8, 0xBD, 0x4E, 0x97, 0x14, 0x99,
+    0xDE, 0x46, 0x36, 0xCC, 0x19, 0x70, 0xA1, 0xF4, 0x2E, 0xA8, 0xBE, 0x08, 0xAA, 0xA7, 0x7A, 0x94,
+    0xA9, 0xBD, 0xEE, 0xD7, 0xD8, 0x4C, 0xB5, 0xC5, 0x6C, 0xD0, 0xF2, 0xFC, 0xD7, 0x12, 0x28, 0x45,
+    0xA4, 0x43, 0x89, 0xC8, 0x16, 0x6A, 0x11, 0x69, 0x70, 0x9F, 0x88, 0x44, 0x4C, 0xA8, 0xE4, 0x73,
+    0xB8, 0xCB, 0x5B, 0x6D, 0x05, 0x20, 0x80, 0x11, 0x0F, 0xF6, 0x65, 0x03, 0xE5, 0x67, 0x0D, 0xD4,
+    0x2E, 0xC0, 0x53, 0x17, 0x50, 0xBD, 0x8B, 0x98, 0x6C, 0x13, 0x2E, 0xDA, 0x4C, 0xD5, 0x14, 0x99,
+    0x15, 0x26, 0xB3, 0xC1, 0x74, 0xA6, 0xC7, 0xF4, 0x36, 0x63, 0x86, 0xF2, 0x1F, 0xF7, 0x3F, 0x1A,
+    0x2A, 0x11, 0x19, 0x6A, 0x11, 0xE9, 0x0B, 0x11, 0x09, 0xAD, 0xC8, 0x40, 0x4F, 0x87, 0xF3, 0x25,
+    0x2A, 0xEB, 0x4C, 0xC5, 0x02, 0x93, 0x4C, 0x64, 0xCE, 0x92, 0x22, 0xD8, 0xC0, 0x9A, 0x1E, 0xD7,
+    0x38, 0xE8, 0x54, 0xA6, 0xE4, 0x08, 0x9D, 0x4D, 0x64, 0xC1, 0x12, 0x13, 0x6D, 0x60, 0x49, 0x8F,
+    0x0D, 0xCE, 0xF3, 0x43, 0x0E, 0x30, 0xC9, 0x04, 0x2A, 0x16, 0x23, 0x96, 0xF3, 0x25, 0xF4, 0x74,
+    0xD8, 0xE0, 0x1A, 0x96, 0xAC, 0x31, 0xB1, 0x08, 0x2C, 0x98, 0xA3, 0xB2, 0x49, 0x38, 0x5F, 0x41,
+    0xAF, 0xF2, 0xF8, 0xFD, 0x92, 0x1E, 0x13, 0x6D, 0x30, 0x22, 0x12, 0x6B, 0x91, 0x2D, 0xA5, 0x88,
+    0xB7, 0x22, 0x51, 0xC5, 0x9D, 0xC7, 0xA6, 0x01, 0x1E, 0x02, 0x16, 0x20, 0x01, 0xFB, 0xBB, 0x89,
+    0x03, 0xCA, 0x5D, 0x72, 0xCC, 0x81, 0x33, 0x60, 0xF5, 0xE7, 0x3F, 0x51, 0x89, 0x78, 0x27, 0x12,
+    0x26, 0x31, 0x6F, 0xB6, 0xDB, 0x5A, 0xB6, 0xE3, 0xB3, 0x96, 0x0D, 0x60, 0xE5, 0x8F, 0x80, 0xF3,
+    0x00, 0x0B, 0x00, 0x96, 0x00, 0xF4, 0x4C, 0xC7, 0x97, 0x22, 0x02, 0xB8, 0x00, 0x50, 0xF9, 0x37,
+    0x9E, 0xB0, 0x01, 0xD0, 0x03, 0x80, 0xC9, 0xC0, 0x5D, 0x97, 0x80, 0x75, 0x19, 0x80, 0xCB, 0xBA,
+    0x01, 0x56, 0x02, 0x50, 0x6F, 0x01, 0xEA, 0x01, 0xA0, 0xEA, 0x00, 0xD8, 0xEB, 0x6E, 0xF4, 0x38,
+    0xF9, 0x4E, 0x92, 0x79, 0xF5, 0xE0, 0xFC, 0x01, 0x6B, 0x56, 0xFE, 0xD8, 0x61, 0xA2, 0xF9, 0x59,
+    0x62, 0xC9, 0xF1, 0x21, 0xB6, 0x29, 0x4C, 0x50, 0x83, 0x4A, 0x8B, 0x5F, 0xB4, 0x32, 0x68, 0x91,
+    0x95, 0x34, 0x4E, 0xBE, 0x95, 0x44, 0x95, 0xEC, 0x8B, 0x91, 0x41, 0x95, 0x00, 0x8A, 0x91, 0xDE,
+    0xF9, 0x78, 0x12, 0xC7, 0x7C, 0xAE, 0xB8, 0x22, 0x31, 0x56, 0xA8, 0x89, 0x9D, 0xCA, 0x5C, 0xB1,
+    0xE1, 0x8C, 0x2B, 0x9A, 0x3B, 0x11, 0xC6, 0xE2, 0x34, 0x01, 0x95, 0xE3, 0xDA, 0xC0, 0x95, 0x10,
+    0x6F, 0x83, 0xEF, 0x80, 0x2E, 0x01, 0x0E, 0x6C, 0x06, 0xAC, 0x48, 0x03, 0xD4, 0x63, 0x15, 0x5C,
+    0x8D, 0xD1, 0x55, 0xFD, 0xF5, 0x9C, 0xAE, 0xA9, 0x82, 0xCB, 0xB6, 0x57, 0xF7, 0xAF, 0xAF, 0x7E,
+    0xF8, 0x66, 0x7D, 0x9C, 0xDB, 0x0D, 0x27, 0x26, 0x3F, 0x71, 0x7E, 0x6D, 0xFE, 0x99, 0x6E, 0x78,
+    0x7B, 0x0D, 0xA2, 0x8A, 0xDA, 0x97, 0x7F, 0xF0, 0x4B, 0x13, 0xE7, 0xA5, 0x5F, 0x23, 0x11, 0xD4,
+    0x07, 0x57, 0xAF, 0xF7, 0xD9, 0x25, 0x0A, 0x71, 0x4A, 0x9B, 0x9B, 0x00, 0x87, 0x00, 0xAB, 0x81,
+    0x4A, 0x64, 0x43, 0xFB, 0xD2, 0x03, 0xB7, 0xA7, 0x02, 0x42, 0x06, 0xDD, 0x8A, 0x04, 0x2B, 0x22,
+    0x61, 0x2C, 0x33, 0xEB, 0x49, 0xB0, 0x22, 0x4C, 0xFA, 0x2C, 0xAE, 0x47, 0x7C, 0x67, 0xDA, 0xA4,
+    0x05, 0xB0, 0xDB, 0x89, 0x68, 0x9B, 0x40, 0x4B, 0x04, 0x2D, 0x1E, 0x58, 0x45, 0xC0, 0xC9, 0x0B,
+    0x60, 0x4F, 0x5E, 0x01, 0x56, 0xB6, 0x1E, 0x6E, 0x48, 0x02, 0xD4, 0x1A, 0x40, 0xA1, 0x3F, 0x00,
+    0x94, 0x6C, 0x7F, 0x07, 0x3F, 0x6E, 0x45, 0x1A, 0x50, 0xBF, 0xEA, 0xC0, 0xBF, 0x71, 0x61, 0xC4,
+    0x32, 0xE2, 0x81, 0xE2, 0xDA, 0x68, 0xC7, 0x71, 0x00, 0x54, 0x1B, 0x60, 0x4F, 0x3A, 0x54, 0x2B,
+    0x2F, 0x76, 0x7F, 0x91, 0x0E, 0x28, 0x3F, 0x07, 0xD4, 0x14, 0xF6, 0x8F, 0xE0, 0x9D, 0xAF, 0x24,
+    0x2B, 0x91, 0xED, 0x17, 0x2C, 0xBE, 0x18, 0x17, 0x5B, 0xAA, 0xC0, 0x2A, 0xBB, 0x01, 0xD7, 0x98,
+    0x84, 0x4A, 0x2C, 0x61, 0x8E, 0xF5, 0x98, 0x40, 0xA6, 0x10, 0x11, 0xA1, 0x15, 0x91, 0xF4, 0xCE,
+    0xAB, 0xFB, 0xAB, 0x0F, 0x71, 0xDE, 0x24, 0x74, 0xE6, 0x0C, 0x6A, 0x6C, 0xC0, 0x24, 0x06, 0x38,
+    0xC3, 0x35, 0xD8, 0xA0, 0x3B, 0x18, 0xA8, 0xA1, 0x6C, 0x4C, 0x46, 0xF7, 0x9C, 0x43, 0xED, 0x6D,
+    0xC4, 0xE4, 0x5D, 0x2E, 0xCD, 0x81, 0xA7, 0xD0, 0x6E, 0x28, 0x64, 0xC0, 0x35, 0xE3, 0xF5, 0x39,
+    0x1B, 0x7B, 0x21, 0xDF, 0x07, 0x2B, 0xDF, 0x37, 0xF4, 0xD6, 0xAB, 0xCE, 0xA1, 0xB3, 0xC3, 0xE4,
+    0x23, 0x4C, 0x9A, 0x53, 0xC4, 0x19, 0x36, 0x2C, 0x71, 0x61, 0xA0, 0x6C, 0x7A, 0xAA, 0x47, 0x1D,
+    0xF5, 0xBD, 0x4C, 0x6D, 0xF2, 0xC4, 0xAF, 0x65, 0x49, 0x21, 0xF4, 0xB8, 0x86, 0x8E, 0xF7, 0xD0,
+    0x99, 0x19, 0x26, 0x31, 0xA3, 0x08, 0x85, 0xF4, 0x36, 0x58, 0xE9, 0x5C, 0x43, 0x4F, 0x89, 0xEA,
+    0xA8, 0xD0, 0x99, 0x05, 0x26, 0x73, 0x86, 0x49, 0xAC, 0x29, 0x22, 0x3D, 0x36, 0xD0, 0xE1, 0x82,
+    0xCA, 0x94, 0x8D, 0xCE, 0x54, 0x8D, 0x79, 0xDD, 0xD4, 0xDE, 0x48, 0x53, 0xEF, 0x64, 0x07, 0xD7,
+    0x00, 0xD8, 0x84, 0xCD, 0x5A, 0x3A, 0xCA, 0xC1, 0xC8, 0x66, 0x14, 0x8F, 0xA2, 0x51, 0x19, 0x4C,
+    0xE4, 0x09, 0x90, 0x47, 0x4A, 0x22, 0x92, 0xB5, 0x88, 0xC8, 0x9A, 0x07, 0xBF, 0xFF, 0xE8, 0xBF,
+    0xBF, 0xC5, 0x44, 0x7A, 0xEB, 0x75, 0xE6, 0xCC, 0x04, 0x06, 0x2A, 0x95, 0x59, 0xE0, 0xC2, 0x13,
+    0x4A, 0x6F, 0xD2, 0x1C, 0x1B, 0x74, 0x57, 0x62, 0x32, 0x83, 0x0D, 0xAA, 0xA7, 0x36, 0x99, 0x4B,
+    0xCA, 0x47, 0x3D, 0xB5, 0xB7, 0xF1, 0x29, 0x2E, 0x98, 0x5C, 0x5D, 0xCB, 0xC5, 0x2A, 0xD8, 0x6C,
+    0x46, 0x07, 0x75, 0x66, 0x31, 0x71, 0x2F, 0x02, 0x4B, 0x9C, 0xD7, 0x91, 0x7A, 0x34, 0xD2, 0xF9,
+    0x52, 0x44, 0x86, 0x22, 0x58, 0x11, 0xD9, 0x9A, 0xA4, 0xCE, 0xEF, 0x3F, 0x78, 0x4E, 0x37, 0xFA,
+    0xB9, 0xC4, 0x06, 0xD5, 0x8D, 0x6A, 0xAC, 0x71, 0x9E, 0x9E, 0x9A, 0x22, 0x70, 0xB6, 0x53, 0x01,
+    0x1B, 0xE9, 0x71, 0xC1, 0x64, 0xCE, 0x28, 0x12, 0x03, 0xD5, 0xE8, 0xAE, 0xFB, 0x17, 0x1B, 0x2A,
+    0x6F, 0x24, 0xD4, 0xB8, 0x80, 0xA4, 0xB7, 0xEE, 0xB0, 0xDF, 0x8C, 0x25, 0x65, 0x2C, 0x1F, 0x25,
+    0x53, 0x49, 0xD9, 0xDB, 0x36, 0x5F, 0xBD, 0x6E, 0xB4, 0x6C, 0x0A, 0x11, 0x7F, 0xE4, 0x61, 0x80,
+    0x0C, 0x26, 0x51, 0x04, 0x28, 0x3D, 0x2E, 0xC1, 0x00, 0xD5, 0x06, 0x93, 0x60, 0x4F, 0xC6, 0x83,
+    0x70, 0xC9, 0x00, 0xE8, 0xDE, 0x64, 0xD4, 0xEB, 0xBF, 0xC4, 0xF2, 0x39, 0x95, 0x08, 0xED, 0x46,
+    0x89, 0x74, 0x46, 0x3A, 0xD5, 0x6E, 0x71, 0x12, 0xF8, 0x1F,
 };
 
 static const EpdGlyph opendyslexic_12_italicGlyphs[] = {
@@ -1947,7 +1926,7 @@ static const EpdGlyph opendyslexic_12_italicGlyphs[] = {
     { 10, 22, 6, 0, 18, 55, 7847 }, // |
     { 14, 24, 16, 0, 19, 84, 7902 }, // }
     { 10, 5, 15, 5, 19, 13, 7986 }, // ~
-    { 0, 0, 21, 0, 0, 0, 0 }, //  
+    { 0, 0, 21, 0, 0, 0, 7999 }, //  
     { 10, 25, 11, 2, 19, 63, 0 }, // ¡
     { 13, 22, 17, 1, 19, 72, 63 }, // ¢
     { 19, 24, 17, 1, 24, 114, 135 }, // £
@@ -1958,625 +1937,631 @@ static const EpdGlyph opendyslexic_12_italicGlyphs[] = {
     { 12, 5, 13, 5, 20, 15, 562 }, // ¨
     { 11, 10, 13, 6, 23, 28, 577 }, // ©
     { 9, 9, 10, 4, 19, 21, 605 }, // ª
-    { 17, 12, 20, 2, 12, 51, 626 }, // «
-    { 13, 8, 15, 3, 9, 26, 677 }, // ¬
-    { 13, 3, 14, 3, 9, 10, 703 }, // ­
-    { 11, 10, 13, 7, 27, 28, 713 }, // ®
-    { 10, 3, 13, 6, 18, 8, 741 }, // ¯
-    { 13, 12, 13, 4, 20, 39, 749 }, // °
-    { 16, 15, 18, 0, 14, 60, 788 }, // ±
-    { 9, 9, 7, 2, 20, 21, 848 }, // ²
-    { 8, 10, 8, 3, 20, 20, 869 }, // ³
-    { 6, 5, 7, 5, 19, 8, 889 }, // ´
-    { 18, 17, 18, -1, 14, 77, 897 }, // µ
-    { 17, 21, 15, 1, 18, 90, 974 }, // ¶
-    { 6, 5, 7, 2, 11, 8, 1064 }, // ·
-    { 7, 7, 8, 0, 1, 13, 1072 }, // ¸
-    { 6, 10, 7, 3, 21, 15, 1085 }, // ¹
-    { 9, 8, 11, 4, 18, 18, 1100 }, // º
-    { 17, 12, 16, -3, 12, 51, 1118 }, // »
-    { 20, 24, 28, 6, 22, 120, 1169 }, // ¼
-    { 22, 23, 28, 6, 21, 127, 1289 }, // ½
-    { 21, 24, 28, 5, 22, 126, 1416 }, // ¾
-    { 16, 28, 14, -2, 15, 112, 1542 }, // ¿
-    { 20, 28, 25, 1, 28, 140, 1654 }, // À
-    { 21, 33, 25, 1, 33, 174, 1794 }, // Á
-    { 21, 27, 25, 1, 27, 142, 1968 }, // Â
-    { 22, 29, 25, 1, 29, 160, 2110 }, // Ã
-    { 23, 29, 25, 1, 29, 167, 2270 }, // Ä
-    { 20, 30, 25, 1, 30, 150, 2437 }, // Å
-    { 33, 23, 36, 1, 22, 190, 2587 }, // Æ
-    { 22, 28, 22, 1, 22, 154, 2777 }, // Ç
-    { 19, 28, 20, 1, 28, 133, 2931 }, // È
-    { 19, 32, 20, 1, 32, 152, 3064 }, // É
-    { 19, 27, 20, 1, 27, 129, 3216 }, // Ê
-    { 20, 29, 20, 1, 29, 145, 3345 }, // Ë
-    { 12, 29, 10, 1, 29, 87, 3490 }, // Ì
-    { 14, 34, 10, 1, 34, 119, 3577 }, // Í
-    { 14, 28, 10, 1, 28, 98, 3696 }, // Î
-    { 15, 30, 10, 1, 30, 113, 3794 }, // Ï
-    { 23, 22, 24, 0, 22, 127, 3907 }, // Ð
-    { 24, 27, 23, 1, 27, 162, 4034 }, // Ñ
-    { 24, 29, 25, 2, 28, 174, 4196 }, // Ò
-    { 24, 33, 25, 2, 32, 198, 4370 }, // Ó
-    { 24, 28, 25, 2, 27, 168, 4568 }, // Ô
-    { 24, 29, 25, 2, 28, 174, 4736 }, // Õ
-    { 24, 29, 25, 2, 28, 174, 4910 }, // Ö
-    { 13, 7, 15, 2, 10, 23, 5084 }, // ×
-    { 44, 41, 25, -9, 31, 451, 5107 }, // Ø
-    { 23, 30, 23, 1, 29, 173, 5558 }, // Ù
-    { 23, 34, 23, 1, 33, 196, 5731 }, // Ú
-    { 23, 29, 23, 1, 28, 167, 5927 }, // Û
-    { 23, 30, 23, 1, 29, 173, 6094 }, // Ü
-    { 18, 33, 23, 6, 33, 149, 6267 }, // Ý
-    { 16, 20, 14, 1, 20, 80, 6416 }, // Þ
-    { 18, 20, 17, 1, 20, 90, 6496 }, // ß
-    { 16, 20, 19, 1, 20, 80, 6586 }, // à
-    { 16, 24, 19, 1, 24, 96, 6666 }, // á
-    { 17, 20, 19, 1, 20, 85, 6762 }, // â
-    { 16, 20, 19, 1, 20, 80, 6847 }, // ã
-    { 17, 21, 19, 1, 21, 90, 6927 }, // ä
-    { 16, 22, 19, 1, 22, 88, 7017 }, // å
-    { 26, 15, 31, 1, 15, 98, 7105 }, // æ
-    { 13, 21, 17, 1, 15, 69, 7203 }, // ç
-    { 16, 23, 19, 1, 23, 92, 7272 }, // è
-    { 17, 27, 19, 1, 27, 115, 7364 }, // é
-    { 17, 22, 19, 1, 22, 94, 7479 }, // ê
-    { 18, 24, 19, 1, 24, 108, 7573 }, // ë
-    { 9, 21, 9, 1, 21, 48, 7681 }, // ì
-    { 12, 25, 9, 1, 25, 75, 7729 }, // í
-    { 12, 20, 9, 1, 20, 60, 7804 }, // î
-    { 13, 22, 9, 1, 22, 72, 7864 }, // ï
-    { 22, 20, 21, 2, 20, 110, 7936 }, // ð
-    { 18, 21, 19, 1, 21, 95, 8046 }, // ñ
-    { 17, 23, 19, 1, 23, 98, 8141 }, // ò
-    { 17, 27, 19, 1, 27, 115, 8239 }, // ó
-    { 17, 22, 19, 1, 22, 94, 8354 }, // ô
-    { 17, 23, 19, 1, 23, 98, 8448 }, // õ
-    { 18, 23, 19, 1, 23, 104, 8546 }, // ö
-    { 16, 16, 19, 4, 16, 64, 8650 }, // ÷
-    { 24, 39, 19, -3, 26, 234, 8714 }, // ø
-    { 15, 22, 18, 2, 21, 83, 8948 }, // ù
-    { 15, 26, 18, 2, 25, 98, 9031 }, // ú
-    { 15, 21, 18, 2, 20, 79, 9129 }, // û
-    { 16, 22, 18, 2, 21, 88, 9208 }, // ü
-    { 19, 34, 19, 0, 27, 162, 9296 }, // ý
-    { 15, 26, 14, 1, 21, 98, 9458 }, // þ
-    { 20, 30, 19, 0, 23, 150, 9556 }, // ÿ
-    { 22, 28, 25, 1, 28, 154, 0 }, // Ā
-    { 17, 20, 19, 1, 20, 85, 154 }, // ā
-    { 22, 31, 25, 1, 31, 171, 239 }, // Ă
-    { 17, 22, 19, 1, 22, 94, 410 }, // ă
-    { 20, 27, 25, 1, 21, 135, 504 }, // Ą
-    { 16, 20, 19, 1, 15, 80, 639 }, // ą
-    { 22, 33, 22, 1, 32, 182, 719 }, // Ć
-    { 15, 24, 17, 1, 23, 90, 901 }, // ć
-    { 22, 31, 22, 1, 30, 171, 991 }, // Ĉ
-    { 17, 22, 17, 1, 21, 94, 1162 }, // ĉ
-    { 22, 32, 22, 1, 31, 176, 1256 }, // Ċ
-    { 13, 23, 17, 1, 22, 75, 1432 }, // ċ
-    { 22, 33, 22, 1, 32, 182, 1507 }, // Č
-    { 16, 24, 17, 1, 23, 96, 1689 }, // č
-    { 22, 31, 24, 1, 31, 171, 1785 }, // Ď
-    { 24, 22, 19, 1, 21, 132, 1956 }, // ď
-    { 23, 22, 24, 0, 22, 127, 2088 }, // Đ
-    { 23, 22, 19, 1, 21, 127, 2215 }, // đ
-    { 20, 28, 20, 1, 28, 140, 2342 }, // Ē
-    { 18, 23, 19, 1, 23, 104, 2482 }, // ē
-    { 20, 30, 20, 1, 30, 150, 2586 }, // Ĕ
-    { 18, 26, 19, 1, 26, 117, 2736 }, // ĕ
-    { 19, 30, 20, 1, 30, 143, 2853 }, // Ė
-    { 16, 25, 19, 1, 25, 100, 2996 }, // ė
-    { 19, 27, 20, 1, 22, 129, 3096 }, // Ę
-    { 16, 21, 19, 1, 15, 84, 3225 }, // ę
-    { 19, 31, 20, 1, 31, 148, 3309 }, // Ě
-    { 17, 26, 19, 1, 26, 111, 3457 }, // ě
-    { 22, 29, 25, 2, 29, 160, 3568 }, // Ĝ
-    { 19, 28, 18, 0, 21, 133, 3728 }, // ĝ
-    { 22, 31, 25, 2, 31, 171, 3861 }, // Ğ
-    { 18, 30, 18, 0, 23, 135, 4032 }, // ğ
-    { 21, 30, 25, 2, 30, 158, 4167 }, // Ġ
-    { 18, 29, 18, 0, 22, 131, 4325 }, // ġ
-    { 21, 34, 25, 2, 22, 179, 4456 }, // Ģ
-    { 18, 30, 18, 0, 23, 135, 4635 }, // ģ
-    { 23, 28, 23, 1, 28, 161, 4770 }, // Ĥ
-    { 16, 27, 19, 1, 27, 108, 4931 }, // ĥ
-    { 23, 21, 23, 1, 21, 121, 5039 }, // Ħ
-    { 16, 21, 19, 1, 21, 84, 5160 }, // ħ
-    { 14, 31, 10, 1, 31, 109, 5244 }, // Ĩ
-    { 12, 22, 9, 1, 22, 66, 5353 }, // ĩ
-    { 15, 29, 10, 1, 29, 109, 5419 }, // Ī
-    { 13, 20, 9, 1, 20, 65, 5528 }, // ī
-    { 12, 27, 15, 3, 21, 81, 5593 }, // Į
-    { 12, 27, 9, -1, 22, 81, 5674 }, // į
-    { 12, 31, 10, 1, 31, 93, 5755 }, // İ
-    { 7, 15, 9, 1, 15, 27, 5848 }, // ı
-    { 20, 27, 23, 1, 21, 135, 5875 }, // Ĳ
-    { 23, 29, 9, 1, 22, 167, 6010 }, // ĳ
-    { 21, 34, 15, -1, 28, 179, 6177 }, // Ĵ
-    { 20, 28, 16, 2, 21, 140, 6356 }, // ĵ
-    { 20, 30, 22, 1, 21, 150, 6496 }, // Ķ
-    { 13, 32, 19, 1, 20, 104, 6646 }, // ķ
-    { 12, 14, 14, 0, 14, 42, 6750 }, // ĸ
-    { 15, 30, 19, 1, 30, 113, 6792 }, // Ĺ
-    { 14, 29, 12, 1, 29, 102, 6905 }, // ĺ
-    { 15, 33, 19, 1, 22, 124, 7007 }, // Ļ
-    { 11, 32, 12, 0, 21, 88, 7131 }, // ļ
-    { 16, 22, 19, 1, 22, 88, 7219 }, // Ľ
-    { 15, 22, 12, 1, 22, 83, 7307 }, // ľ
-    { 17, 22, 19, 1, 22, 94, 7390 }, // Ŀ
-    { 14, 21, 12, 1, 21, 74, 7484 }, // ŀ
-    { 34, 32, 19, -12, 26, 272, 7558 }, // Ł
-    { 23, 21, 12, -8, 21, 121, 7830 }, // ł
-    { 24, 30, 23, 1, 30, 180, 7951 }, // Ń
-    { 17, 24, 19, 1, 24, 102, 8131 }, // ń
-    { 24, 31, 23, 1, 22, 186, 8233 }, // Ņ
-    { 16, 23, 19, 1, 14, 92, 8419 }, // ņ
-    { 24, 30, 23, 1, 30, 180, 8511 }, // Ň
-    { 17, 24, 19, 1, 24, 102, 8691 }, // ň
-    { 18, 26, 17, -3, 26, 117, 8793 }, // ŉ
-    { 24, 28, 23, 1, 22, 168, 8910 }, // Ŋ
-    { 16, 19, 19, 1, 14, 76, 9078 }, // ŋ
-    { 24, 28, 25, 2, 27, 168, 9154 }, // Ō
-    { 18, 21, 19, 1, 21, 95, 9322 }, // ō
-    { 24, 31, 25, 2, 30, 186, 9417 }, // Ŏ
-    { 18, 25, 19, 1, 25, 113, 9603 }, // ŏ
-    { 24, 30, 25, 2, 29, 180, 9716 }, // Ő
-    { 21, 24, 19, 1, 24, 126, 9896 }, // ő
-    { 32, 21, 30, 2, 21, 168, 10022 }, // Œ
-    { 27, 15, 27, 1, 15, 102, 10190 }, // œ
-    { 19, 29, 21, 1, 29, 138, 10292 }, // Ŕ
-    { 13, 21, 15, 1, 21, 69, 10430 }, // ŕ
-    { 19, 34, 21, 1, 22, 162, 10499 }, // Ŗ
-    { 15, 27, 15, -1, 14, 102, 10661 }, // ŗ
-    { 19, 30, 21, 1, 30, 143, 10763 }, // Ř
-    { 13, 21, 15, 1, 21, 69, 10906 }, // ř
-    { 22, 33, 25, 1, 32, 182, 10975 }, // Ś
-    { 15, 23, 18, 1, 23, 87, 11157 }, // ś
-    { 22, 30, 25, 1, 29, 165, 11244 }, // Ŝ
-    { 16, 21, 18, 1, 21, 84, 11409 }, // ŝ
-    { 22, 28, 25, 1, 22, 154, 11493 }, // Ş
-    { 15, 21, 18, 1, 14, 79, 11647 }, // ş
-    { 22, 33, 25, 1, 32, 182, 11726 }, // Š
-    { 15, 23, 18, 1, 23, 87, 11908 }, // š
-    { 20, 26, 23, 5, 21, 130, 11995 }, // Ţ
-    { 11, 24, 16, 4, 19, 66, 12125 }, // ţ
-    { 20, 29, 23, 5, 29, 145, 12191 }, // Ť
-    { 14, 21, 16, 4, 21, 74, 12336 }, // ť
-    { 20, 21, 23, 5, 21, 105, 12410 }, // Ŧ
-    { 13, 19, 16, 2, 19, 62, 12515 }, // ŧ
-    { 23, 31, 23, 1, 30, 179, 12577 }, // Ũ
-    { 15, 23, 18, 2, 22, 87, 12756 }, // ũ
-    { 23, 29, 23, 1, 28, 167, 12843 }, // Ū
-    { 16, 21, 18, 2, 20, 84, 13010 }, // ū
-    { 23, 32, 23, 1, 31, 184, 13094 }, // Ŭ
-    { 16, 24, 18, 2, 23, 96, 13278 }, // ŭ
-    { 23, 32, 23, 1, 31, 184, 13374 }, // Ů
-    { 15, 24, 18, 2, 23, 90, 13558 }, // ů
-    { 24, 31, 23, 1, 30, 186, 13648 }, // Ű
-    { 19, 23, 18, 2, 22, 110, 13834 }, // ű
-    { 23, 27, 23, 1, 22, 156, 13944 }, // Ų
-    { 15, 20, 18, 2, 14, 75, 14100 }, // ų
-    { 28, 27, 32, 5, 27, 189, 14175 }, // Ŵ
-    { 20, 21, 24, 4, 21, 105, 14364 }, // ŵ
-    { 18, 28, 23, 6, 28, 126, 14469 }, // Ŷ
-    { 19, 29, 19, 0, 22, 138, 14595 }, // ŷ
-    { 18, 30, 23, 6, 30, 135, 14733 }, // Ÿ
-    { 25, 30, 25, 1, 30, 188, 14868 }, // Ź
-    { 17, 23, 19, 1, 23, 98, 15056 }, // ź
-    { 25, 29, 25, 1, 29, 182, 15154 }, // Ż
-    { 17, 22, 19, 1, 22, 94, 15336 }, // ż
-    { 25, 30, 25, 1, 30, 188, 15430 }, // Ž
-    { 17, 23, 19, 1, 23, 98, 15618 }, // ž
-    { 14, 20, 13, 3, 20, 70, 15716 }, // ſ
-    { 7, 4, 0, 6, 19, 7, 0 }, // ̀
-    { 6, 5, 0, 5, 19, 8, 7 }, // ́
-    { 11, 5, 0, -1, 0, 14, 15 }, // ̂
-    { 10, 5, 0, 5, 19, 13, 29 }, // ̃
-    { 13, 4, 0, 4, 17, 13, 42 }, // ̄
-    { 17, 3, 0, 7, 22, 13, 55 }, // ̅
-    { 11, 5, 0, 5, 18, 14, 68 }, // ̆
-    { 5, 5, 0, 5, 20, 7, 82 }, // ̇
-    { 12, 5, 0, 5, 20, 15, 89 }, // ̈
-    { 6, 5, 0, 4, 16, 8, 104 }, // ̉
-    { 7, 5, 0, 5, 19, 9, 112 }, // ̊
-    { 17, 4, 0, 5, 19, 17, 121 }, // ̋
-    { 11, 5, 0, 5, 19, 14, 138 }, // ̌
-    { 18, 4, 0, -8, 20, 18, 152 }, // ̏
-    { 8, 8, 0, 4, 19, 16, 170 }, // ̒
-    { 8, 7, 0, 4, 18, 14, 186 }, // ̓
-    { 8, 7, 0, -4, 18, 14, 200 }, // ̔
-    { 6, 6, 0, 0, -1, 9, 214 }, // ̘
-    { 5, 6, 0, 2, -1, 8, 223 }, // ̙
-    { 11, 6, 0, 6, 20, 17, 231 }, // ̚
-    { 5, 6, 0, 4, 16, 8, 248 }, // ̛
-    { 4, 5, 0, 0, -2, 5, 256 }, // ̜
-    { 6, 5, 0, 3, 4, 8, 261 }, // ̝
-    { 6, 5, 0, 0, -1, 8, 269 }, // ̞
-    { 6, 5, 0, 0, -2, 8, 277 }, // ̟
-    { 12, 4, 0, 0, -3, 12, 285 }, // ̠
-    { 5, 5, 0, 0, 1, 7, 297 }, // ̣
-    { 13, 5, 0, -1, 0, 17, 304 }, // ̤
-    { 7, 5, 0, 5, 19, 9, 321 }, // ̥
-    { 8, 8, 0, 0, 4, 16, 330 }, // ̦
-    { 7, 7, 0, 0, 1, 13, 346 }, // ̧
-    { 7, 7, 0, 0, 1, 13, 359 }, // ̨
-    { 6, 7, 0, -1, -1, 11, 372 }, // ̩
-    { 9, 4, 0, 0, -1, 9, 383 }, // ̪
-    { 11, 5, 0, 0, 0, 14, 392 }, // ̬
-    { 11, 5, 0, -1, -1, 14, 406 }, // ̭
-    { 10, 5, 0, 5, 19, 13, 420 }, // ̰
-    { 10, 3, 0, 6, 18, 8, 433 }, // ̱
-    { 11, 3, 0, 0, -2, 9, 441 }, // ̲
-    { 10, 5, 0, 5, 19, 13, 450 }, // ̴
-    { 13, 3, 0, 3, 9, 10, 463 }, // ̵
-    { 4, 5, 0, 2, -2, 5, 473 }, // ̹
-    { 10, 4, 0, -2, -1, 10, 478 }, // ̺
-    { 9, 7, 0, 0, 0, 16, 488 }, // ̻
-    { 9, 5, 0, 0, 0, 12, 504 }, // ̼
-    { 7, 5, 0, 5, 19, 9, 516 }, // ̽
-    { 10, 5, 0, 5, 19, 13, 525 }, // ͂
-    { 5, 5, 0, 5, 21, 7, 538 }, // ̓
-    { 12, 11, 0, 5, 26, 33, 545 }, // ̈́
-    { 9, 5, 0, 6, 20, 12, 578 }, // ͆
-    { 14, 9, 0, -1, 0, 32, 590 }, // ͇
-    { 11, 7, 0, 0, 0, 20, 622 }, // ͈
-    { 8, 7, 0, 0, -1, 14, 642 }, // ͉
-    { 12, 15, 0, 5, 24, 45, 656 }, // ͊
-    { 24, 11, 0, 8, 22, 66, 701 }, // ͋
-    { 18, 12, 0, 5, 13, 54, 767 }, // ͌
-    { 12, 8, 0, 2, 0, 24, 821 }, // ͍
-    { 4, 4, 0, 3, 3, 4, 845 }, // ͎
-    { 21, 5, 0, 1, 0, 27, 849 }, // ͜
-    { 21, 5, 0, 5, 19, 27, 876 }, // ͡
-    { 25, 6, 0, 0, -2, 38, 903 }, // ͢
-    { 18, 25, 16, 1, 25, 113, 0 }, // Ѐ
-    { 18, 24, 16, 1, 24, 108, 113 }, // Ё
-    { 18, 21, 26, 8, 21, 95, 221 }, // Ђ
-    { 18, 29, 16, 1, 29, 131, 316 }, // Ѓ
-    { 20, 20, 23, 1, 19, 100, 447 }, // Є
-    { 22, 23, 25, 1, 22, 127, 547 }, // Ѕ
-    { 10, 21, 10, 1, 21, 53, 674 }, // І
-    { 15, 30, 10, 1, 30, 113, 727 }, // Ї
-    { 18, 28, 15, -1, 22, 126, 840 }, // Ј
-    { 27, 19, 29, 2, 18, 129, 966 }, // Љ
-    { 26, 20, 28, 2, 19, 130, 1095 }, // Њ
-    { 20, 22, 23, 5, 22, 110, 1225 }, // Ћ
-    { 22, 29, 22, 1, 29, 160, 1335 }, // Ќ
-    { 22, 27, 23, 2, 27, 149, 1495 }, // Ѝ
-    { 19, 30, 17, -1, 28, 143, 1644 }, // Ў
-    { 20, 23, 18, 1, 18, 115, 1787 }, // Џ
-    { 20, 21, 25, 1, 21, 105, 1902 }, // А
-    { 18, 19, 16, 2, 18, 86, 2007 }, // Б
-    { 17, 19, 17, 1, 18, 81, 2093 }, // В
-    { 18, 19, 16, 1, 19, 86, 2174 }, // Г
-    { 20, 22, 21, 2, 19, 110, 2260 }, // Д
-    { 18, 19, 16, 1, 19, 86, 2370 }, // Е
-    { 30, 21, 32, 1, 21, 158, 2456 }, // Ж
-    { 16, 21, 18, 1, 20, 84, 2614 }, // З
-    { 22, 22, 23, 2, 22, 121, 2698 }, // И
-    { 22, 29, 23, 2, 29, 160, 2819 }, // Й
-    { 20, 21, 22, 1, 21, 105, 2979 }, // К
-    { 19, 20, 19, 2, 19, 95, 3084 }, // Л
-    { 23, 19, 21, 1, 19, 110, 3179 }, // М
-    { 23, 22, 23, 1, 22, 127, 3289 }, // Н
-    { 24, 22, 25, 2, 21, 132, 3416 }, // О
-    { 19, 19, 17, 1, 19, 91, 3548 }, // П
-    { 20, 21, 20, 1, 21, 105, 3639 }, // Р
-    { 22, 23, 22, 1, 22, 127, 3744 }, // С
-    { 20, 21, 23, 5, 21, 105, 3871 }, // Т
-    { 19, 22, 17, -1, 20, 105, 3976 }, // У
-    { 20, 19, 22, 5, 19, 95, 4081 }, // Ф
-    { 24, 22, 25, 1, 22, 132, 4176 }, // Х
-    { 18, 23, 18, 1, 19, 104, 4308 }, // Ц
-    { 15, 19, 17, 4, 19, 72, 4412 }, // Ч
-    { 21, 19, 20, 2, 19, 100, 4484 }, // Ш
-    { 21, 23, 23, 2, 19, 121, 4584 }, // Щ
-    { 14, 20, 17, 2, 19, 70, 4705 }, // Ъ
-    { 26, 20, 27, 2, 19, 130, 4775 }, // Ы
-    { 14, 20, 17, 2, 19, 70, 4905 }, // Ь
-    { 21, 20, 23, 1, 19, 105, 4975 }, // Э
-    { 23, 20, 25, 3, 19, 115, 5080 }, // Ю
-    { 20, 22, 21, 1, 22, 110, 5195 }, // Я
-    { 16, 15, 19, 1, 15, 60, 5305 }, // а
-    { 17, 20, 18, 3, 20, 85, 5365 }, // б
-    { 14, 15, 16, 0, 15, 53, 5450 }, // в
-    { 16, 14, 15, 1, 14, 56, 5503 }, // г
-    { 17, 17, 19, 2, 14, 73, 5559 }, // д
-    { 16, 15, 19, 1, 15, 60, 5632 }, // е
-    { 27, 18, 27, 0, 18, 122, 5692 }, // ж
-    { 12, 14, 11, 0, 14, 42, 5814 }, // з
-    { 17, 15, 17, 1, 15, 64, 5856 }, // и
-    { 17, 19, 17, 1, 19, 81, 5920 }, // й
-    { 16, 15, 17, 0, 15, 60, 6001 }, // к
-    { 13, 14, 13, 1, 13, 46, 6061 }, // л
-    { 20, 16, 21, 0, 16, 80, 6107 }, // м
-    { 20, 16, 20, 0, 16, 80, 6187 }, // н
-    { 14, 16, 20, 3, 15, 56, 6267 }, // о
-    { 16, 14, 17, 2, 14, 56, 6323 }, // п
-    { 20, 21, 20, -1, 14, 105, 6379 }, // р
-    { 13, 16, 17, 1, 15, 52, 6484 }, // с
-    { 14, 14, 17, 5, 14, 49, 6536 }, // т
-    { 19, 21, 19, 0, 14, 100, 6585 }, // у
-    { 20, 20, 22, 3, 14, 100, 6685 }, // ф
-    { 18, 14, 18, 1, 14, 63, 6785 }, // х
-    { 16, 18, 18, 2, 14, 72, 6848 }, // ц
-    { 11, 13, 11, 2, 13, 36, 6920 }, // ч
-    { 20, 14, 20, 2, 14, 70, 6956 }, // ш
-    { 20, 19, 22, 2, 14, 95, 7026 }, // щ
-    { 14, 15, 19, 5, 14, 53, 7121 }, // ъ
-    { 20, 15, 20, 2, 14, 75, 7174 }, // ы
-    { 14, 15, 15, 1, 14, 53, 7249 }, // ь
-    { 15, 15, 16, 2, 14, 57, 7302 }, // э
-    { 19, 16, 20, 2, 15, 76, 7359 }, // ю
-    { 17, 15, 16, 1, 15, 64, 7435 }, // я
-    { 16, 24, 19, 1, 24, 96, 7499 }, // ѐ
-    { 16, 20, 17, 3, 19, 80, 7595 }, // ё
-    { 16, 25, 19, 1, 21, 100, 7675 }, // ђ
-    { 16, 21, 15, 1, 21, 84, 7775 }, // ѓ
-    { 14, 14, 16, 0, 13, 49, 7859 }, // є
-    { 15, 14, 18, 1, 14, 53, 7908 }, // ѕ
-    { 10, 22, 9, 1, 22, 55, 7961 }, // і
-    { 13, 22, 9, 1, 22, 72, 8016 }, // ї
-    { 16, 28, 16, 2, 21, 112, 8088 }, // ј
-    { 18, 14, 20, 1, 13, 63, 8200 }, // љ
-    { 18, 15, 19, 1, 14, 68, 8263 }, // њ
-    { 16, 21, 19, 1, 21, 84, 8331 }, // ћ
-    { 16, 22, 17, 0, 22, 88, 8415 }, // ќ
-    { 17, 21, 17, 1, 21, 90, 8503 }, // ѝ
-    { 19, 32, 19, 0, 25, 152, 8593 }, // ў
-    { 15, 17, 13, 0, 13, 64, 8745 }, // џ
-    { 13, 19, 21, 7, 18, 62, 8809 }, // Ѣ
-    { 13, 19, 18, 5, 18, 62, 8871 }, // ѣ
-    { 25, 18, 25, 2, 18, 113, 8933 }, // Ѫ
-    { 17, 14, 18, 1, 13, 60, 9046 }, // ѫ
-    { 22, 23, 24, 2, 22, 127, 9106 }, // Ѳ
-    { 18, 17, 19, 1, 17, 77, 9233 }, // ѳ
-    { 29, 27, 25, 6, 27, 196, 9310 }, // Ѵ
-    { 17, 17, 20, 4, 17, 73, 9506 }, // ѵ
-    { 11, 8, 0, 6, 23, 22, 9579 }, // ҆
-    { 19, 21, 16, 1, 21, 100, 9601 }, // Ґ
-    { 17, 17, 15, 1, 17, 73, 9701 }, // ґ
-    { 18, 19, 16, 1, 19, 86, 9774 }, // Ғ
-    { 13, 13, 11, 0, 13, 43, 9860 }, // ғ
-    { 21, 20, 17, 1, 20, 105, 9903 }, // Ҕ
-    { 11, 13, 11, 0, 13, 36, 10008 }, // ҕ
-    { 30, 25, 32, -1, 21, 188, 10044 }, // Җ
-    { 21, 18, 22, -2, 15, 95, 10232 }, // җ
-    { 16, 23, 18, 2, 20, 92, 10327 }, // Ҙ
-    { 12, 20, 11, 0, 14, 60, 10419 }, // ҙ
-    { 21, 24, 22, -1, 21, 126, 10479 }, // Қ
-    { 14, 17, 15, -1, 15, 60, 10605 }, // қ
-    { 22, 19, 24, 2, 19, 105, 10665 }, // Ҝ
-    { 17, 13, 18, 1, 13, 56, 10770 }, // ҝ
-    { 20, 21, 22, 1, 21, 105, 10826 }, // Ҟ
-    { 13, 21, 19, 1, 21, 69, 10931 }, // ҟ
-    { 22, 21, 22, -1, 21, 116, 11000 }, // Ҡ
-    { 15, 15, 15, -1, 15, 57, 11116 }, // ҡ
-    { 23, 25, 23, -1, 22, 144, 11173 }, // Ң
-    { 16, 17, 16, -1, 15, 68, 11317 }, // ң
-    { 31, 22, 23, 1, 22, 171, 11385 }, // Ҥ
-    { 22, 15, 16, 0, 15, 83, 11556 }, // ҥ
-    { 27, 21, 29, 2, 21, 142, 11639 }, // Ҧ
-    { 24, 23, 27, 2, 16, 138, 11781 }, // ҧ
-    { 24, 22, 30, 4, 21, 132, 11919 }, // Ҩ
-    { 20, 17, 23, 2, 16, 85, 12051 }, // ҩ
-    { 22, 26, 22, 1, 22, 143, 12136 }, // Ҫ
-    { 13, 19, 17, 1, 15, 62, 12279 }, // ҫ
-    { 19, 24, 23, 4, 21, 114, 12341 }, // Ҭ
-    { 13, 17, 16, 2, 15, 56, 12455 }, // ҭ
-    { 18, 21, 23, 6, 21, 95, 12511 }, // Ү
-    { 14, 18, 17, 5, 13, 63, 12606 }, // ү
-    { 19, 21, 23, 5, 21, 100, 12669 }, // Ұ
-    { 19, 19, 17, 0, 13, 91, 12769 }, // ұ
-    { 25, 25, 25, -1, 22, 157, 12860 }, // Ҳ
-    { 18, 17, 17, -2, 15, 77, 13017 }, // ҳ
-    { 19, 23, 27, 7, 18, 110, 13094 }, // Ҵ
-    { 14, 17, 19, 4, 13, 60, 13204 }, // ҵ
-    { 16, 24, 21, 4, 18, 96, 13264 }, // Ҷ
-    { 12, 17, 15, 2, 13, 51, 13360 }, // ҷ
-    { 16, 19, 18, 5, 19, 76, 13411 }, // Ҹ
-    { 12, 13, 12, 2, 13, 39, 13487 }, // ҹ
-    { 16, 21, 19, 2, 21, 84, 13526 }, // Һ
-    { 16, 21, 19, 1, 21, 84, 13610 }, // һ
-    { 20, 19, 24, 2, 18, 95, 13694 }, // Ҽ
-    { 14, 14, 17, 1, 14, 49, 13789 }, // ҽ
-    { 20, 22, 27, 5, 18, 110, 13838 }, // Ҿ
-    { 15, 17, 20, 3, 14, 64, 13948 }, // ҿ
-    { 10, 21, 10, 1, 21, 53, 14012 }, // Ӏ
-    { 30, 30, 32, 1, 30, 225, 14065 }, // Ӂ
-    { 27, 27, 27, 0, 27, 183, 14290 }, // ӂ
-    { 18, 25, 20, 2, 19, 113, 14473 }, // Ӄ
-    { 12, 17, 13, 1, 13, 51, 14586 }, // ӄ
-    { 19, 24, 19, 2, 19, 114, 14637 }, // Ӆ
-    { 13, 16, 13, 1, 13, 52, 14751 }, // ӆ
-    { 23, 28, 23, 1, 22, 161, 14803 }, // Ӈ
-    { 16, 20, 16, 0, 15, 80, 14964 }, // ӈ
-    { 23, 29, 23, 1, 22, 167, 15044 }, // Ӊ
-    { 16, 20, 16, 0, 15, 80, 15211 }, // ӊ
-    { 16, 23, 17, 3, 18, 92, 15291 }, // Ӌ
-    { 10, 16, 13, 3, 13, 40, 15383 }, // ӌ
-    { 26, 29, 31, 1, 22, 189, 15423 }, // Ӎ
-    { 18, 20, 21, 0, 15, 90, 15612 }, // ӎ
-    { 8, 18, 7, 2, 18, 36, 15702 }, // ӏ
-    { 22, 30, 25, 1, 30, 165, 15738 }, // Ӑ
-    { 20, 23, 19, 1, 23, 115, 15903 }, // ӑ
-    { 22, 29, 25, 1, 29, 160, 16018 }, // Ӓ
-    { 21, 21, 19, 1, 21, 111, 16178 }, // ӓ
-    { 33, 23, 36, 1, 22, 190, 16289 }, // Ӕ
-    { 26, 15, 31, 1, 15, 98, 16479 }, // ӕ
-    { 19, 26, 16, 1, 26, 124, 16577 }, // Ӗ
-    { 18, 25, 19, 1, 25, 113, 16701 }, // ӗ
-    { 16, 15, 19, 2, 14, 60, 16814 }, // Ә
-    { 16, 17, 21, 8, 16, 68, 16874 }, // ә
-    { 19, 26, 19, 2, 25, 124, 16942 }, // Ӛ
-    { 17, 18, 21, 7, 16, 77, 17066 }, // ӛ
-    { 30, 29, 33, 1, 29, 218, 17143 }, // Ӝ
-    { 27, 26, 27, 0, 26, 176, 17361 }, // ӝ
-    { 18, 27, 18, 1, 26, 122, 17537 }, // Ӟ
-    { 18, 21, 11, 0, 21, 95, 17659 }, // ӟ
-    { 14, 18, 15, 3, 18, 63, 17754 }, // Ӡ
-    { 15, 18, 15, 1, 13, 68, 17817 }, // ӡ
-    { 22, 26, 23, 2, 26, 143, 17885 }, // Ӣ
-    { 18, 20, 17, 1, 20, 90, 18028 }, // ӣ
-    { 22, 27, 23, 2, 27, 149, 18118 }, // Ӥ
-    { 18, 21, 17, 1, 21, 95, 18267 }, // ӥ
-    { 24, 30, 25, 2, 29, 180, 18362 }, // Ӧ
-    { 16, 23, 20, 3, 22, 92, 18542 }, // ӧ
-    { 21, 19, 25, 2, 18, 100, 18634 }, // Ө
-    { 17, 14, 19, 1, 14, 60, 18734 }, // ө
-    { 21, 30, 25, 2, 29, 158, 18794 }, // Ӫ
-    { 18, 23, 19, 1, 23, 104, 18952 }, // ӫ
-    { 21, 28, 23, 1, 27, 147, 19056 }, // Ӭ
-    { 15, 22, 16, 2, 21, 83, 19203 }, // ӭ
-    { 19, 28, 17, -1, 26, 133, 19286 }, // Ӯ
-    { 19, 29, 19, 0, 22, 138, 19419 }, // ӯ
-    { 19, 29, 17, -1, 27, 138, 19557 }, // Ӱ
-    { 19, 31, 19, 0, 24, 148, 19695 }, // ӱ
-    { 21, 29, 17, -1, 27, 153, 19843 }, // Ӳ
-    { 22, 31, 19, 0, 24, 171, 19996 }, // ӳ
-    { 16, 26, 17, 4, 26, 104, 20167 }, // Ӵ
-    { 14, 21, 11, 2, 21, 74, 20271 }, // ӵ
-    { 18, 23, 16, 1, 19, 104, 20345 }, // Ӷ
-    { 13, 16, 11, 0, 13, 52, 20449 }, // ӷ
-    { 26, 29, 27, 2, 28, 189, 20501 }, // Ӹ
-    { 20, 24, 20, 2, 23, 120, 20690 }, // ӹ
-    { 24, 26, 25, 1, 22, 156, 20810 }, // Ӽ
-    { 17, 18, 17, 0, 15, 77, 20966 }, // ӽ
-    { 0, 0, 21, 0, 0, 0, 0 }, //  
-    { 0, 0, 33, 0, 0, 0, 0 }, //  
-    { 0, 0, 21, 0, 0, 0, 0 }, //  
-    { 0, 0, 33, 0, 0, 0, 0 }, //  
-    { 0, 0, 16, 0, 0, 0, 0 }, //  
-    { 0, 0, 14, 0, 0, 0, 0 }, //  
-    { 0, 0, 12, 0, 0, 0, 0 }, //  
-    { 0, 0, 17, 0, 0, 0, 0 }, //  
-    { 0, 0, 7, 0, 0, 0, 0 }, //  
-    { 0, 0, 13, 0, 0, 0, 0 }, //  
-    { 0, 0, 12, 0, 0, 0, 0 }, //  
-    { 0, 0, 8, 0, 0, 0, 0 }, // ​
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‍
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‎
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‏
-    { 13, 3, 14, 3, 9, 10, 0 }, // ‐
-    { 13, 3, 14, 3, 9, 10, 10 }, // ‑
-    { 19, 3, 19, 4, 9, 15, 20 }, // ‒
-    { 18, 4, 20, 3, 9, 18, 35 }, // –
-    { 26, 4, 28, 3, 9, 26, 53 }, // —
-    { 26, 4, 28, 3, 9, 26, 79 }, // ―
-    { 17, 22, 14, 0, 18, 94, 105 }, // ‖
-    { 21, 8, 20, 0, -2, 42, 199 }, // ‗
-    { 8, 7, 8, 5, 21, 14, 241 }, // ‘
-    { 8, 8, 8, 5, 22, 16, 255 }, // ’
-    { 8, 8, 8, 0, 4, 16, 271 }, // ‚
-    { 8, 7, 8, 5, 21, 14, 287 }, // ‛
-    { 14, 7, 14, 5, 21, 25, 301 }, // “
-    { 14, 7, 14, 5, 21, 25, 326 }, // ”
-    { 8, 8, 8, 0, 4, 16, 351 }, // „
-    { 14, 8, 14, 5, 21, 28, 367 }, // ‟
-    { 14, 32, 15, 4, 25, 112, 395 }, // †
-    { 16, 32, 15, 2, 25, 128, 507 }, // ‡
-    { 17, 15, 13, 0, 18, 64, 635 }, // •
-    { 7, 8, 10, 3, 11, 14, 699 }, // ‣
-    { 5, 5, 7, 1, 5, 7, 713 }, // ․
-    { 5, 5, 7, 1, 5, 7, 720 }, // ‥
-    { 22, 5, 24, 1, 5, 28, 727 }, // …
-    { 4, 3, 6, 2, 9, 3, 755 }, // ‧
-    { 0, 0, 32, 0, 0, 0, 758 }, //  
-    { 20, 22, 28, 6, 20, 110, 758 }, // ‰
-    { 8, 8, 8, 5, 22, 16, 868 }, // ′
-    { 14, 7, 14, 5, 21, 25, 884 }, // ″
-    { 18, 8, 21, -3, 21, 36, 909 }, // ‴
-    { 5, 7, 8, 6, 21, 9, 945 }, // ‵
-    { 11, 7, 13, 5, 21, 20, 954 }, // ‶
-    { 18, 8, 21, 6, 21, 36, 974 }, // ‷
-    { 11, 5, 14, 6, 20, 14, 1010 }, // ‸
-    { 9, 12, 10, 3, 13, 27, 1024 }, // ‹
-    { 9, 12, 10, -2, 13, 27, 1051 }, // ›
-    { 32, 26, 33, 1, 23, 208, 1078 }, // ※
-    { 12, 25, 8, 1, 25, 75, 1286 }, // ‼
-    { 17, 31, 19, 5, 30, 132, 1361 }, // ‽
-    { 13, 3, 14, 6, 21, 10, 1493 }, // ‾
-    { 11, 5, 16, 5, 17, 14, 1503 }, // ‿
-    { 18, 16, 20, 4, 22, 72, 1517 }, // ⁂
-    { 20, 20, 28, 6, 19, 100, 1589 }, // ⁄
-    { 30, 28, 32, 6, 28, 210, 1689 }, // ⁇
-    { 21, 28, 25, 6, 28, 147, 1899 }, // ⁈
-    { 26, 30, 20, 0, 28, 195, 2046 }, // ⁉
-    { 25, 39, 19, -1, 27, 244, 2241 }, // ⁒
-    { 0, 0, 121, 0, 0, 0, 2485 }, //  
-    { 8, 10, 8, 3, 21, 20, 0 }, // ⁰
-    { 8, 10, 8, 3, 21, 20, 20 }, // ⁴
-    { 8, 10, 8, 3, 21, 20, 40 }, // ⁵
-    { 9, 9, 8, 3, 20, 21, 60 }, // ⁶
-    { 7, 10, 8, 5, 21, 18, 81 }, // ⁷
-    { 9, 10, 8, 3, 21, 23, 99 }, // ⁸
-    { 9, 9, 8, 3, 20, 21, 122 }, // ⁹
-    { 16, 14, 19, 1, 14, 56, 143 }, // ⁿ
-    { 12, 13, 11, 1, 13, 39, 199 }, // ₀
-    { 6, 10, 8, -1, 6, 15, 238 }, // ₁
-    { 9, 10, 8, -1, 6, 23, 253 }, // ₂
-    { 9, 9, 8, -1, 5, 21, 276 }, // ₃
-    { 8, 10, 8, -1, 6, 20, 297 }, // ₄
-    { 8, 10, 8, -1, 6, 20, 317 }, // ₅
-    { 9, 9, 8, -1, 5, 21, 337 }, // ₆
-    { 7, 11, 8, 1, 6, 20, 358 }, // ₇
-    { 9, 10, 8, -1, 6, 23, 378 }, // ₈
-    { 9, 9, 8, -1, 5, 21, 401 }, // ₉
-    { 14, 34, 11, 3, 25, 119, 422 }, // ₍
-    { 14, 34, 11, -6, 25, 119, 541 }, // ₎
-    { 24, 31, 22, 0, 26, 186, 0 }, // ₡
-    { 22, 23, 22, 1, 22, 127, 186 }, // ₢
-    { 19, 24, 17, 1, 24, 114, 313 }, // ₤
-    { 25, 22, 23, 0, 22, 138, 427 }, // ₦
-    { 21, 21, 20, 1, 21, 111, 565 }, // ₧
-    { 28, 21, 28, 0, 21, 147, 676 }, // ₨
-    { 21, 21, 19, -1, 21, 111, 823 }, // ₩
-    { 24, 19, 27, 4, 19, 114, 934 }, // ₪
-    { 18, 20, 17, 2, 20, 90, 1048 }, // ₫
-    { 19, 23, 21, 2, 20, 110, 1138 }, // €
-    { 20, 21, 23, 5, 21, 105, 1248 }, // ₮
-    { 24, 21, 16, 1, 21, 126, 1353 }, // ₱
-    { 21, 30, 25, 2, 26, 158, 1479 }, // ₲
-    { 28, 23, 23, 2, 22, 161, 1637 }, // ₴
-    { 13, 20, 17, 1, 18, 65, 1798 }, // ₵
-    { 23, 22, 23, 5, 22, 127, 1863 }, // ₸
-    { 15, 20, 15, 3, 19, 75, 1990 }, // ₹
-    { 15, 17, 17, 2, 16, 64, 2065 }, // ₺
-    { 18, 20, 16, 2, 20, 90, 2129 }, // ₼
-    { 24, 21, 20, -3, 21, 126, 2219 }, // ₽
-    { 16, 16, 19, -3, 12, 64, 0 }, // ←
-    { 16, 15, 19, 4, 15, 60, 64 }, // ↑
-    { 16, 16, 19, 6, 12, 64, 124 }, // →
-    { 16, 15, 19, 8, 15, 60, 188 }, // ↓
-    { 27, 13, 22, -2, 11, 88, 248 }, // ↔
-    { 14, 26, 16, 3, 24, 91, 336 }, // ↕
-    { 15, 11, 16, -3, 11, 42, 427 }, // ↖
-    { 15, 11, 16, 4, 11, 42, 469 }, // ↗
-    { 12, 16, 16, 6, 14, 48, 511 }, // ↘
-    { 12, 16, 16, -2, 14, 48, 559 }, // ↙
-    { 19, 16, 21, 0, 15, 76, 607 }, // ⇐
-    { 20, 18, 23, 4, 18, 90, 683 }, // ⇑
-    { 19, 16, 21, 3, 15, 76, 773 }, // ⇒
-    { 20, 19, 23, 9, 18, 95, 849 }, // ⇓
-    { 25, 16, 24, 0, 15, 100, 944 }, // ⇔
-    { 16, 24, 19, 6, 15, 96, 1044 }, // ⇕
-    { 19, 20, 17, 2, 20, 95, 0 }, // ∂
-    { 26, 23, 25, 0, 22, 150, 95 }, // ∅
-    { 20, 19, 22, 1, 19, 95, 245 }, // ∆
-    { 18, 18, 18, 4, 18, 81, 340 }, // ∏
-    { 18, 18, 18, 8, 18, 81, 421 }, // ∐
-    { 17, 19, 15, 1, 18, 81, 502 }, // ∑
-    { 12, 4, 15, 3, 9, 12, 583 }, // −
-    { 24, 21, 23, 3, 20, 126, 595 }, // √
-    { 22, 12, 23, 3, 15, 66, 721 }, // ∞
-    { 27, 28, 21, 0, 22, 189, 787 }, // ∫
-    { 9, 15, 7, 1, 15, 34, 976 }, // ∶
-    { 18, 12, 19, 5, 13, 54, 1010 }, // ≈
-    { 20, 22, 28, 6, 20, 110, 1064 }, // ≠
-    { 21, 19, 22, -1, 18, 100, 1174 }, // ≤
-    { 22, 19, 22, 1, 18, 105, 1274 }, // ≥
+    { 17, 12, 20, 2, 12, 51, 7999 }, // «
+    { 13, 8, 15, 3, 9, 26, 626 }, // ¬
+    { 13, 3, 14, 3, 9, 10, 652 }, // ­
+    { 11, 10, 13, 7, 27, 28, 662 }, // ®
+    { 10, 3, 13, 6, 18, 8, 690 }, // ¯
+    { 13, 12, 13, 4, 20, 39, 698 }, // °
+    { 16, 15, 18, 0, 14, 60, 737 }, // ±
+    { 9, 9, 7, 2, 20, 21, 797 }, // ²
+    { 8, 10, 8, 3, 20, 20, 818 }, // ³
+    { 6, 5, 7, 5, 19, 8, 838 }, // ´
+    { 18, 17, 18, -1, 14, 77, 846 }, // µ
+    { 17, 21, 15, 1, 18, 90, 923 }, // ¶
+    { 6, 5, 7, 2, 11, 8, 1013 }, // ·
+    { 7, 7, 8, 0, 1, 13, 1021 }, // ¸
+    { 6, 10, 7, 3, 21, 15, 1034 }, // ¹
+    { 9, 8, 11, 4, 18, 18, 1049 }, // º
+    { 17, 12, 16, -3, 12, 51, 8050 }, // »
+    { 20, 24, 28, 6, 22, 120, 1067 }, // ¼
+    { 22, 23, 28, 6, 21, 127, 1187 }, // ½
+    { 21, 24, 28, 5, 22, 126, 1314 }, // ¾
+    { 16, 28, 14, -2, 15, 112, 1440 }, // ¿
+    { 20, 28, 25, 1, 28, 140, 8101 }, // À
+    { 21, 33, 25, 1, 33, 174, 8241 }, // Á
+    { 21, 27, 25, 1, 27, 142, 8415 }, // Â
+    { 22, 29, 25, 1, 29, 160, 1552 }, // Ã
+    { 23, 29, 25, 1, 29, 167, 8557 }, // Ä
+    { 20, 30, 25, 1, 30, 150, 1712 }, // Å
+    { 33, 23, 36, 1, 22, 190, 1862 }, // Æ
+    { 22, 28, 22, 1, 22, 154, 8724 }, // Ç
+    { 19, 28, 20, 1, 28, 133, 8878 }, // È
+    { 19, 32, 20, 1, 32, 152, 9011 }, // É
+    { 19, 27, 20, 1, 27, 129, 9163 }, // Ê
+    { 20, 29, 20, 1, 29, 145, 9292 }, // Ë
+    { 12, 29, 10, 1, 29, 87, 9437 }, // Ì
+    { 14, 34, 10, 1, 34, 119, 9524 }, // Í
+    { 14, 28, 10, 1, 28, 98, 9643 }, // Î
+    { 15, 30, 10, 1, 30, 113, 9741 }, // Ï
+    { 23, 22, 24, 0, 22, 127, 2052 }, // Ð
+    { 24, 27, 23, 1, 27, 162, 9854 }, // Ñ
+    { 24, 29, 25, 2, 28, 174, 10016 }, // Ò
+    { 24, 33, 25, 2, 32, 198, 10190 }, // Ó
+    { 24, 28, 25, 2, 27, 168, 10388 }, // Ô
+    { 24, 29, 25, 2, 28, 174, 2179 }, // Õ
+    { 24, 29, 25, 2, 28, 174, 10556 }, // Ö
+    { 13, 7, 15, 2, 10, 23, 2353 }, // ×
+    { 44, 41, 25, -9, 31, 451, 2376 }, // Ø
+    { 23, 30, 23, 1, 29, 173, 10730 }, // Ù
+    { 23, 34, 23, 1, 33, 196, 10903 }, // Ú
+    { 23, 29, 23, 1, 28, 167, 11099 }, // Û
+    { 23, 30, 23, 1, 29, 173, 11266 }, // Ü
+    { 18, 33, 23, 6, 33, 149, 2827 }, // Ý
+    { 16, 20, 14, 1, 20, 80, 2976 }, // Þ
+    { 18, 20, 17, 1, 20, 90, 3056 }, // ß
+    { 16, 20, 19, 1, 20, 80, 11439 }, // à
+    { 16, 24, 19, 1, 24, 96, 11519 }, // á
+    { 17, 20, 19, 1, 20, 85, 11615 }, // â
+    { 16, 20, 19, 1, 20, 80, 3146 }, // ã
+    { 17, 21, 19, 1, 21, 90, 11700 }, // ä
+    { 16, 22, 19, 1, 22, 88, 3226 }, // å
+    { 26, 15, 31, 1, 15, 98, 3314 }, // æ
+    { 13, 21, 17, 1, 15, 69, 11790 }, // ç
+    { 16, 23, 19, 1, 23, 92, 11859 }, // è
+    { 17, 27, 19, 1, 27, 115, 11951 }, // é
+    { 17, 22, 19, 1, 22, 94, 12066 }, // ê
+    { 18, 24, 19, 1, 24, 108, 12160 }, // ë
+    { 9, 21, 9, 1, 21, 48, 12268 }, // ì
+    { 12, 25, 9, 1, 25, 75, 12316 }, // í
+    { 12, 20, 9, 1, 20, 60, 12391 }, // î
+    { 13, 22, 9, 1, 22, 72, 12451 }, // ï
+    { 22, 20, 21, 2, 20, 110, 3412 }, // ð
+    { 18, 21, 19, 1, 21, 95, 12523 }, // ñ
+    { 17, 23, 19, 1, 23, 98, 12618 }, // ò
+    { 17, 27, 19, 1, 27, 115, 12716 }, // ó
+    { 17, 22, 19, 1, 22, 94, 12831 }, // ô
+    { 17, 23, 19, 1, 23, 98, 3522 }, // õ
+    { 18, 23, 19, 1, 23, 104, 12925 }, // ö
+    { 16, 16, 19, 4, 16, 64, 3620 }, // ÷
+    { 24, 39, 19, -3, 26, 234, 3684 }, // ø
+    { 15, 22, 18, 2, 21, 83, 13029 }, // ù
+    { 15, 26, 18, 2, 25, 98, 13112 }, // ú
+    { 15, 21, 18, 2, 20, 79, 13210 }, // û
+    { 16, 22, 18, 2, 21, 88, 13289 }, // ü
+    { 19, 34, 19, 0, 27, 162, 3918 }, // ý
+    { 15, 26, 14, 1, 21, 98, 4080 }, // þ
+    { 20, 30, 19, 0, 23, 150, 4178 }, // ÿ
+    { 22, 28, 25, 1, 28, 154, 4328 }, // Ā
+    { 17, 20, 19, 1, 20, 85, 4482 }, // ā
+    { 22, 31, 25, 1, 31, 171, 4567 }, // Ă
+    { 17, 22, 19, 1, 22, 94, 4738 }, // ă
+    { 20, 27, 25, 1, 21, 135, 4832 }, // Ą
+    { 16, 20, 19, 1, 15, 80, 4967 }, // ą
+    { 22, 33, 22, 1, 32, 182, 5047 }, // Ć
+    { 15, 24, 17, 1, 23, 90, 5229 }, // ć
+    { 22, 31, 22, 1, 30, 171, 5319 }, // Ĉ
+    { 17, 22, 17, 1, 21, 94, 5490 }, // ĉ
+    { 22, 32, 22, 1, 31, 176, 5584 }, // Ċ
+    { 13, 23, 17, 1, 22, 75, 5760 }, // ċ
+    { 22, 33, 22, 1, 32, 182, 5835 }, // Č
+    { 16, 24, 17, 1, 23, 96, 6017 }, // č
+    { 22, 31, 24, 1, 31, 171, 6113 }, // Ď
+    { 24, 22, 19, 1, 21, 132, 6284 }, // ď
+    { 23, 22, 24, 0, 22, 127, 6416 }, // Đ
+    { 23, 22, 19, 1, 21, 127, 6543 }, // đ
+    { 20, 28, 20, 1, 28, 140, 6670 }, // Ē
+    { 18, 23, 19, 1, 23, 104, 6810 }, // ē
+    { 20, 30, 20, 1, 30, 150, 6914 }, // Ĕ
+    { 18, 26, 19, 1, 26, 117, 7064 }, // ĕ
+    { 19, 30, 20, 1, 30, 143, 7181 }, // Ė
+    { 16, 25, 19, 1, 25, 100, 7324 }, // ė
+    { 19, 27, 20, 1, 22, 129, 7424 }, // Ę
+    { 16, 21, 19, 1, 15, 84, 7553 }, // ę
+    { 19, 31, 20, 1, 31, 148, 7637 }, // Ě
+    { 17, 26, 19, 1, 26, 111, 7785 }, // ě
+    { 22, 29, 25, 2, 29, 160, 7896 }, // Ĝ
+    { 19, 28, 18, 0, 21, 133, 8056 }, // ĝ
+    { 22, 31, 25, 2, 31, 171, 8189 }, // Ğ
+    { 18, 30, 18, 0, 23, 135, 8360 }, // ğ
+    { 21, 30, 25, 2, 30, 158, 8495 }, // Ġ
+    { 18, 29, 18, 0, 22, 131, 8653 }, // ġ
+    { 21, 34, 25, 2, 22, 179, 8784 }, // Ģ
+    { 18, 30, 18, 0, 23, 135, 8963 }, // ģ
+    { 23, 28, 23, 1, 28, 161, 9098 }, // Ĥ
+    { 16, 27, 19, 1, 27, 108, 9259 }, // ĥ
+    { 23, 21, 23, 1, 21, 121, 9367 }, // Ħ
+    { 16, 21, 19, 1, 21, 84, 9488 }, // ħ
+    { 14, 31, 10, 1, 31, 109, 9572 }, // Ĩ
+    { 12, 22, 9, 1, 22, 66, 9681 }, // ĩ
+    { 15, 29, 10, 1, 29, 109, 9747 }, // Ī
+    { 13, 20, 9, 1, 20, 65, 9856 }, // ī
+    { 12, 27, 15, 3, 21, 81, 9921 }, // Į
+    { 12, 27, 9, -1, 22, 81, 10002 }, // į
+    { 12, 31, 10, 1, 31, 93, 10083 }, // İ
+    { 7, 15, 9, 1, 15, 27, 10176 }, // ı
+    { 20, 27, 23, 1, 21, 135, 10203 }, // Ĳ
+    { 23, 29, 9, 1, 22, 167, 10338 }, // ĳ
+    { 21, 34, 15, -1, 28, 179, 10505 }, // Ĵ
+    { 20, 28, 16, 2, 21, 140, 10684 }, // ĵ
+    { 20, 30, 22, 1, 21, 150, 10824 }, // Ķ
+    { 13, 32, 19, 1, 20, 104, 10974 }, // ķ
+    { 12, 14, 14, 0, 14, 42, 11078 }, // ĸ
+    { 15, 30, 19, 1, 30, 113, 11120 }, // Ĺ
+    { 14, 29, 12, 1, 29, 102, 11233 }, // ĺ
+    { 15, 33, 19, 1, 22, 124, 11335 }, // Ļ
+    { 11, 32, 12, 0, 21, 88, 11459 }, // ļ
+    { 16, 22, 19, 1, 22, 88, 11547 }, // Ľ
+    { 15, 22, 12, 1, 22, 83, 11635 }, // ľ
+    { 17, 22, 19, 1, 22, 94, 11718 }, // Ŀ
+    { 14, 21, 12, 1, 21, 74, 11812 }, // ŀ
+    { 34, 32, 19, -12, 26, 272, 11886 }, // Ł
+    { 23, 21, 12, -8, 21, 121, 12158 }, // ł
+    { 24, 30, 23, 1, 30, 180, 12279 }, // Ń
+    { 17, 24, 19, 1, 24, 102, 12459 }, // ń
+    { 24, 31, 23, 1, 22, 186, 12561 }, // Ņ
+    { 16, 23, 19, 1, 14, 92, 12747 }, // ņ
+    { 24, 30, 23, 1, 30, 180, 12839 }, // Ň
+    { 17, 24, 19, 1, 24, 102, 13019 }, // ň
+    { 18, 26, 17, -3, 26, 117, 13121 }, // ŉ
+    { 24, 28, 23, 1, 22, 168, 13238 }, // Ŋ
+    { 16, 19, 19, 1, 14, 76, 13406 }, // ŋ
+    { 24, 28, 25, 2, 27, 168, 13482 }, // Ō
+    { 18, 21, 19, 1, 21, 95, 13650 }, // ō
+    { 24, 31, 25, 2, 30, 186, 13745 }, // Ŏ
+    { 18, 25, 19, 1, 25, 113, 13931 }, // ŏ
+    { 24, 30, 25, 2, 29, 180, 14044 }, // Ő
+    { 21, 24, 19, 1, 24, 126, 14224 }, // ő
+    { 32, 21, 30, 2, 21, 168, 13377 }, // Œ
+    { 27, 15, 27, 1, 15, 102, 13545 }, // œ
+    { 19, 29, 21, 1, 29, 138, 14350 }, // Ŕ
+    { 13, 21, 15, 1, 21, 69, 14488 }, // ŕ
+    { 19, 34, 21, 1, 22, 162, 14557 }, // Ŗ
+    { 15, 27, 15, -1, 14, 102, 14719 }, // ŗ
+    { 19, 30, 21, 1, 30, 143, 14821 }, // Ř
+    { 13, 21, 15, 1, 21, 69, 14964 }, // ř
+    { 22, 33, 25, 1, 32, 182, 15033 }, // Ś
+    { 15, 23, 18, 1, 23, 87, 15215 }, // ś
+    { 22, 30, 25, 1, 29, 165, 15302 }, // Ŝ
+    { 16, 21, 18, 1, 21, 84, 15467 }, // ŝ
+    { 22, 28, 25, 1, 22, 154, 15551 }, // Ş
+    { 15, 21, 18, 1, 14, 79, 15705 }, // ş
+    { 22, 33, 25, 1, 32, 182, 15784 }, // Š
+    { 15, 23, 18, 1, 23, 87, 15966 }, // š
+    { 20, 26, 23, 5, 21, 130, 16053 }, // Ţ
+    { 11, 24, 16, 4, 19, 66, 16183 }, // ţ
+    { 20, 29, 23, 5, 29, 145, 16249 }, // Ť
+    { 14, 21, 16, 4, 21, 74, 16394 }, // ť
+    { 20, 21, 23, 5, 21, 105, 16468 }, // Ŧ
+    { 13, 19, 16, 2, 19, 62, 16573 }, // ŧ
+    { 23, 31, 23, 1, 30, 179, 16635 }, // Ũ
+    { 15, 23, 18, 2, 22, 87, 16814 }, // ũ
+    { 23, 29, 23, 1, 28, 167, 16901 }, // Ū
+    { 16, 21, 18, 2, 20, 84, 17068 }, // ū
+    { 23, 32, 23, 1, 31, 184, 17152 }, // Ŭ
+    { 16, 24, 18, 2, 23, 96, 17336 }, // ŭ
+    { 23, 32, 23, 1, 31, 184, 17432 }, // Ů
+    { 15, 24, 18, 2, 23, 90, 17616 }, // ů
+    { 24, 31, 23, 1, 30, 186, 17706 }, // Ű
+    { 19, 23, 18, 2, 22, 110, 17892 }, // ű
+    { 23, 27, 23, 1, 22, 156, 18002 }, // Ų
+    { 15, 20, 18, 2, 14, 75, 18158 }, // ų
+    { 28, 27, 32, 5, 27, 189, 18233 }, // Ŵ
+    { 20, 21, 24, 4, 21, 105, 18422 }, // ŵ
+    { 18, 28, 23, 6, 28, 126, 18527 }, // Ŷ
+    { 19, 29, 19, 0, 22, 138, 18653 }, // ŷ
+    { 18, 30, 23, 6, 30, 135, 18791 }, // Ÿ
+    { 25, 30, 25, 1, 30, 188, 18926 }, // Ź
+    { 17, 23, 19, 1, 23, 98, 19114 }, // ź
+    { 25, 29, 25, 1, 29, 182, 19212 }, // Ż
+    { 17, 22, 19, 1, 22, 94, 19394 }, // ż
+    { 25, 30, 25, 1, 30, 188, 19488 }, // Ž
+    { 17, 23, 19, 1, 23, 98, 19676 }, // ž
+    { 14, 20, 13, 3, 20, 70, 19774 }, // ſ
+    { 7, 4, 0, 6, 19, 7, 19844 }, // ̀
+    { 6, 5, 0, 5, 19, 8, 19851 }, // ́
+    { 11, 5, 0, -1, 0, 14, 19859 }, // ̂
+    { 10, 5, 0, 5, 19, 13, 19873 }, // ̃
+    { 13, 4, 0, 4, 17, 13, 19886 }, // ̄
+    { 17, 3, 0, 7, 22, 13, 19899 }, // ̅
+    { 11, 5, 0, 5, 18, 14, 19912 }, // ̆
+    { 5, 5, 0, 5, 20, 7, 19926 }, // ̇
+    { 12, 5, 0, 5, 20, 15, 19933 }, // ̈
+    { 6, 5, 0, 4, 16, 8, 19948 }, // ̉
+    { 7, 5, 0, 5, 19, 9, 19956 }, // ̊
+    { 17, 4, 0, 5, 19, 17, 19965 }, // ̋
+    { 11, 5, 0, 5, 19, 14, 19982 }, // ̌
+    { 18, 4, 0, -8, 20, 18, 19996 }, // ̏
+    { 8, 8, 0, 4, 19, 16, 20014 }, // ̒
+    { 8, 7, 0, 4, 18, 14, 20030 }, // ̓
+    { 8, 7, 0, -4, 18, 14, 20044 }, // ̔
+    { 6, 6, 0, 0, -1, 9, 20058 }, // ̘
+    { 5, 6, 0, 2, -1, 8, 20067 }, // ̙
+    { 11, 6, 0, 6, 20, 17, 20075 }, // ̚
+    { 5, 6, 0, 4, 16, 8, 20092 }, // ̛
+    { 4, 5, 0, 0, -2, 5, 20100 }, // ̜
+    { 6, 5, 0, 3, 4, 8, 20105 }, // ̝
+    { 6, 5, 0, 0, -1, 8, 20113 }, // ̞
+    { 6, 5, 0, 0, -2, 8, 20121 }, // ̟
+    { 12, 4, 0, 0, -3, 12, 20129 }, // ̠
+    { 5, 5, 0, 0, 1, 7, 20141 }, // ̣
+    { 13, 5, 0, -1, 0, 17, 20148 }, // ̤
+    { 7, 5, 0, 5, 19, 9, 20165 }, // ̥
+    { 8, 8, 0, 0, 4, 16, 20174 }, // ̦
+    { 7, 7, 0, 0, 1, 13, 20190 }, // ̧
+    { 7, 7, 0, 0, 1, 13, 20203 }, // ̨
+    { 6, 7, 0, -1, -1, 11, 20216 }, // ̩
+    { 9, 4, 0, 0, -1, 9, 20227 }, // ̪
+    { 11, 5, 0, 0, 0, 14, 20236 }, // ̬
+    { 11, 5, 0, -1, -1, 14, 20250 }, // ̭
+    { 10, 5, 0, 5, 19, 13, 20264 }, // ̰
+    { 10, 3, 0, 6, 18, 8, 20277 }, // ̱
+    { 11, 3, 0, 0, -2, 9, 20285 }, // ̲
+    { 10, 5, 0, 5, 19, 13, 20294 }, // ̴
+    { 13, 3, 0, 3, 9, 10, 20307 }, // ̵
+    { 4, 5, 0, 2, -2, 5, 20317 }, // ̹
+    { 10, 4, 0, -2, -1, 10, 20322 }, // ̺
+    { 9, 7, 0, 0, 0, 16, 20332 }, // ̻
+    { 9, 5, 0, 0, 0, 12, 20348 }, // ̼
+    { 7, 5, 0, 5, 19, 9, 20360 }, // ̽
+    { 10, 5, 0, 5, 19, 13, 20369 }, // ͂
+    { 5, 5, 0, 5, 21, 7, 20382 }, // ̓
+    { 12, 11, 0, 5, 26, 33, 20389 }, // ̈́
+    { 9, 5, 0, 6, 20, 12, 20422 }, // ͆
+    { 14, 9, 0, -1, 0, 32, 20434 }, // ͇
+    { 11, 7, 0, 0, 0, 20, 20466 }, // ͈
+    { 8, 7, 0, 0, -1, 14, 20486 }, // ͉
+    { 12, 15, 0, 5, 24, 45, 20500 }, // ͊
+    { 24, 11, 0, 8, 22, 66, 20545 }, // ͋
+    { 18, 12, 0, 5, 13, 54, 20611 }, // ͌
+    { 12, 8, 0, 2, 0, 24, 20665 }, // ͍
+    { 4, 4, 0, 3, 3, 4, 20689 }, // ͎
+    { 21, 5, 0, 1, 0, 27, 20693 }, // ͜
+    { 21, 5, 0, 5, 19, 27, 20720 }, // ͡
+    { 25, 6, 0, 0, -2, 38, 20747 }, // ͢
+    { 18, 25, 16, 1, 25, 113, 20785 }, // Ѐ
+    { 18, 24, 16, 1, 24, 108, 0 }, // Ё
+    { 18, 21, 26, 8, 21, 95, 20898 }, // Ђ
+    { 18, 29, 16, 1, 29, 131, 0 }, // Ѓ
+    { 20, 20, 23, 1, 19, 100, 131 }, // Є
+    { 22, 23, 25, 1, 22, 127, 231 }, // Ѕ
+    { 10, 21, 10, 1, 21, 53, 358 }, // І
+    { 15, 30, 10, 1, 30, 113, 411 }, // Ї
+    { 18, 28, 15, -1, 22, 126, 524 }, // Ј
+    { 27, 19, 29, 2, 18, 129, 650 }, // Љ
+    { 26, 20, 28, 2, 19, 130, 779 }, // Њ
+    { 20, 22, 23, 5, 22, 110, 909 }, // Ћ
+    { 22, 29, 22, 1, 29, 160, 1019 }, // Ќ
+    { 22, 27, 23, 2, 27, 149, 1179 }, // Ѝ
+    { 19, 30, 17, -1, 28, 143, 1328 }, // Ў
+    { 20, 23, 18, 1, 18, 115, 1471 }, // Џ
+    { 20, 21, 25, 1, 21, 105, 108 }, // А
+    { 18, 19, 16, 2, 18, 86, 213 }, // Б
+    { 17, 19, 17, 1, 18, 81, 299 }, // В
+    { 18, 19, 16, 1, 19, 86, 380 }, // Г
+    { 20, 22, 21, 2, 19, 110, 466 }, // Д
+    { 18, 19, 16, 1, 19, 86, 576 }, // Е
+    { 30, 21, 32, 1, 21, 158, 662 }, // Ж
+    { 16, 21, 18, 1, 20, 84, 820 }, // З
+    { 22, 22, 23, 2, 22, 121, 904 }, // И
+    { 22, 29, 23, 2, 29, 160, 1025 }, // Й
+    { 20, 21, 22, 1, 21, 105, 1185 }, // К
+    { 19, 20, 19, 2, 19, 95, 1290 }, // Л
+    { 23, 19, 21, 1, 19, 110, 1385 }, // М
+    { 23, 22, 23, 1, 22, 127, 1495 }, // Н
+    { 24, 22, 25, 2, 21, 132, 1622 }, // О
+    { 19, 19, 17, 1, 19, 91, 1754 }, // П
+    { 20, 21, 20, 1, 21, 105, 1845 }, // Р
+    { 22, 23, 22, 1, 22, 127, 1950 }, // С
+    { 20, 21, 23, 5, 21, 105, 2077 }, // Т
+    { 19, 22, 17, -1, 20, 105, 2182 }, // У
+    { 20, 19, 22, 5, 19, 95, 2287 }, // Ф
+    { 24, 22, 25, 1, 22, 132, 2382 }, // Х
+    { 18, 23, 18, 1, 19, 104, 2514 }, // Ц
+    { 15, 19, 17, 4, 19, 72, 2618 }, // Ч
+    { 21, 19, 20, 2, 19, 100, 2690 }, // Ш
+    { 21, 23, 23, 2, 19, 121, 2790 }, // Щ
+    { 14, 20, 17, 2, 19, 70, 2911 }, // Ъ
+    { 26, 20, 27, 2, 19, 130, 2981 }, // Ы
+    { 14, 20, 17, 2, 19, 70, 3111 }, // Ь
+    { 21, 20, 23, 1, 19, 105, 3181 }, // Э
+    { 23, 20, 25, 3, 19, 115, 3286 }, // Ю
+    { 20, 22, 21, 1, 22, 110, 3401 }, // Я
+    { 16, 15, 19, 1, 15, 60, 3511 }, // а
+    { 17, 20, 18, 3, 20, 85, 3571 }, // б
+    { 14, 15, 16, 0, 15, 53, 3656 }, // в
+    { 16, 14, 15, 1, 14, 56, 3709 }, // г
+    { 17, 17, 19, 2, 14, 73, 3765 }, // д
+    { 16, 15, 19, 1, 15, 60, 3838 }, // е
+    { 27, 18, 27, 0, 18, 122, 3898 }, // ж
+    { 12, 14, 11, 0, 14, 42, 4020 }, // з
+    { 17, 15, 17, 1, 15, 64, 4062 }, // и
+    { 17, 19, 17, 1, 19, 81, 4126 }, // й
+    { 16, 15, 17, 0, 15, 60, 4207 }, // к
+    { 13, 14, 13, 1, 13, 46, 4267 }, // л
+    { 20, 16, 21, 0, 16, 80, 4313 }, // м
+    { 20, 16, 20, 0, 16, 80, 4393 }, // н
+    { 14, 16, 20, 3, 15, 56, 4473 }, // о
+    { 16, 14, 17, 2, 14, 56, 4529 }, // п
+    { 20, 21, 20, -1, 14, 105, 4585 }, // р
+    { 13, 16, 17, 1, 15, 52, 4690 }, // с
+    { 14, 14, 17, 5, 14, 49, 4742 }, // т
+    { 19, 21, 19, 0, 14, 100, 4791 }, // у
+    { 20, 20, 22, 3, 14, 100, 4891 }, // ф
+    { 18, 14, 18, 1, 14, 63, 4991 }, // х
+    { 16, 18, 18, 2, 14, 72, 5054 }, // ц
+    { 11, 13, 11, 2, 13, 36, 5126 }, // ч
+    { 20, 14, 20, 2, 14, 70, 5162 }, // ш
+    { 20, 19, 22, 2, 14, 95, 5232 }, // щ
+    { 14, 15, 19, 5, 14, 53, 5327 }, // ъ
+    { 20, 15, 20, 2, 14, 75, 5380 }, // ы
+    { 14, 15, 15, 1, 14, 53, 5455 }, // ь
+    { 15, 15, 16, 2, 14, 57, 5508 }, // э
+    { 19, 16, 20, 2, 15, 76, 5565 }, // ю
+    { 17, 15, 16, 1, 15, 64, 5641 }, // я
+    { 16, 24, 19, 1, 24, 96, 1586 }, // ѐ
+    { 16, 20, 17, 3, 19, 80, 5705 }, // ё
+    { 16, 25, 19, 1, 21, 100, 1682 }, // ђ
+    { 16, 21, 15, 1, 21, 84, 1782 }, // ѓ
+    { 14, 14, 16, 0, 13, 49, 1866 }, // є
+    { 15, 14, 18, 1, 14, 53, 1915 }, // ѕ
+    { 10, 22, 9, 1, 22, 55, 1968 }, // і
+    { 13, 22, 9, 1, 22, 72, 2023 }, // ї
+    { 16, 28, 16, 2, 21, 112, 2095 }, // ј
+    { 18, 14, 20, 1, 13, 63, 2207 }, // љ
+    { 18, 15, 19, 1, 14, 68, 2270 }, // њ
+    { 16, 21, 19, 1, 21, 84, 2338 }, // ћ
+    { 16, 22, 17, 0, 22, 88, 2422 }, // ќ
+    { 17, 21, 17, 1, 21, 90, 2510 }, // ѝ
+    { 19, 32, 19, 0, 25, 152, 2600 }, // ў
+    { 15, 17, 13, 0, 13, 64, 2752 }, // џ
+    { 13, 19, 21, 7, 18, 62, 2816 }, // Ѣ
+    { 13, 19, 18, 5, 18, 62, 2878 }, // ѣ
+    { 25, 18, 25, 2, 18, 113, 2940 }, // Ѫ
+    { 17, 14, 18, 1, 13, 60, 3053 }, // ѫ
+    { 22, 23, 24, 2, 22, 127, 3113 }, // Ѳ
+    { 18, 17, 19, 1, 17, 77, 3240 }, // ѳ
+    { 29, 27, 25, 6, 27, 196, 3317 }, // Ѵ
+    { 17, 17, 20, 4, 17, 73, 3513 }, // ѵ
+    { 11, 8, 0, 6, 23, 22, 3586 }, // ҆
+    { 19, 21, 16, 1, 21, 100, 3608 }, // Ґ
+    { 17, 17, 15, 1, 17, 73, 3708 }, // ґ
+    { 18, 19, 16, 1, 19, 86, 3781 }, // Ғ
+    { 13, 13, 11, 0, 13, 43, 3867 }, // ғ
+    { 21, 20, 17, 1, 20, 105, 3910 }, // Ҕ
+    { 11, 13, 11, 0, 13, 36, 4015 }, // ҕ
+    { 30, 25, 32, -1, 21, 188, 4051 }, // Җ
+    { 21, 18, 22, -2, 15, 95, 4239 }, // җ
+    { 16, 23, 18, 2, 20, 92, 4334 }, // Ҙ
+    { 12, 20, 11, 0, 14, 60, 4426 }, // ҙ
+    { 21, 24, 22, -1, 21, 126, 4486 }, // Қ
+    { 14, 17, 15, -1, 15, 60, 4612 }, // қ
+    { 22, 19, 24, 2, 19, 105, 4672 }, // Ҝ
+    { 17, 13, 18, 1, 13, 56, 4777 }, // ҝ
+    { 20, 21, 22, 1, 21, 105, 4833 }, // Ҟ
+    { 13, 21, 19, 1, 21, 69, 4938 }, // ҟ
+    { 22, 21, 22, -1, 21, 116, 5007 }, // Ҡ
+    { 15, 15, 15, -1, 15, 57, 5123 }, // ҡ
+    { 23, 25, 23, -1, 22, 144, 5180 }, // Ң
+    { 16, 17, 16, -1, 15, 68, 5324 }, // ң
+    { 31, 22, 23, 1, 22, 171, 5392 }, // Ҥ
+    { 22, 15, 16, 0, 15, 83, 5563 }, // ҥ
+    { 27, 21, 29, 2, 21, 142, 5646 }, // Ҧ
+    { 24, 23, 27, 2, 16, 138, 5788 }, // ҧ
+    { 24, 22, 30, 4, 21, 132, 5926 }, // Ҩ
+    { 20, 17, 23, 2, 16, 85, 6058 }, // ҩ
+    { 22, 26, 22, 1, 22, 143, 6143 }, // Ҫ
+    { 13, 19, 17, 1, 15, 62, 6286 }, // ҫ
+    { 19, 24, 23, 4, 21, 114, 6348 }, // Ҭ
+    { 13, 17, 16, 2, 15, 56, 6462 }, // ҭ
+    { 18, 21, 23, 6, 21, 95, 6518 }, // Ү
+    { 14, 18, 17, 5, 13, 63, 6613 }, // ү
+    { 19, 21, 23, 5, 21, 100, 6676 }, // Ұ
+    { 19, 19, 17, 0, 13, 91, 6776 }, // ұ
+    { 25, 25, 25, -1, 22, 157, 6867 }, // Ҳ
+    { 18, 17, 17, -2, 15, 77, 7024 }, // ҳ
+    { 19, 23, 27, 7, 18, 110, 7101 }, // Ҵ
+    { 14, 17, 19, 4, 13, 60, 7211 }, // ҵ
+    { 16, 24, 21, 4, 18, 96, 7271 }, // Ҷ
+    { 12, 17, 15, 2, 13, 51, 7367 }, // ҷ
+    { 16, 19, 18, 5, 19, 76, 7418 }, // Ҹ
+    { 12, 13, 12, 2, 13, 39, 7494 }, // ҹ
+    { 16, 21, 19, 2, 21, 84, 7533 }, // Һ
+    { 16, 21, 19, 1, 21, 84, 7617 }, // һ
+    { 20, 19, 24, 2, 18, 95, 7701 }, // Ҽ
+    { 14, 14, 17, 1, 14, 49, 7796 }, // ҽ
+    { 20, 22, 27, 5, 18, 110, 7845 }, // Ҿ
+    { 15, 17, 20, 3, 14, 64, 7955 }, // ҿ
+    { 10, 21, 10, 1, 21, 53, 8019 }, // Ӏ
+    { 30, 30, 32, 1, 30, 225, 8072 }, // Ӂ
+    { 27, 27, 27, 0, 27, 183, 8297 }, // ӂ
+    { 18, 25, 20, 2, 19, 113, 8480 }, // Ӄ
+    { 12, 17, 13, 1, 13, 51, 8593 }, // ӄ
+    { 19, 24, 19, 2, 19, 114, 8644 }, // Ӆ
+    { 13, 16, 13, 1, 13, 52, 8758 }, // ӆ
+    { 23, 28, 23, 1, 22, 161, 8810 }, // Ӈ
+    { 16, 20, 16, 0, 15, 80, 8971 }, // ӈ
+    { 23, 29, 23, 1, 22, 167, 9051 }, // Ӊ
+    { 16, 20, 16, 0, 15, 80, 9218 }, // ӊ
+    { 16, 23, 17, 3, 18, 92, 9298 }, // Ӌ
+    { 10, 16, 13, 3, 13, 40, 9390 }, // ӌ
+    { 26, 29, 31, 1, 22, 189, 9430 }, // Ӎ
+    { 18, 20, 21, 0, 15, 90, 9619 }, // ӎ
+    { 8, 18, 7, 2, 18, 36, 9709 }, // ӏ
+    { 22, 30, 25, 1, 30, 165, 9745 }, // Ӑ
+    { 20, 23, 19, 1, 23, 115, 9910 }, // ӑ
+    { 22, 29, 25, 1, 29, 160, 10025 }, // Ӓ
+    { 21, 21, 19, 1, 21, 111, 10185 }, // ӓ
+    { 33, 23, 36, 1, 22, 190, 10296 }, // Ӕ
+    { 26, 15, 31, 1, 15, 98, 10486 }, // ӕ
+    { 19, 26, 16, 1, 26, 124, 10584 }, // Ӗ
+    { 18, 25, 19, 1, 25, 113, 10708 }, // ӗ
+    { 16, 15, 19, 2, 14, 60, 10821 }, // Ә
+    { 16, 17, 21, 8, 16, 68, 10881 }, // ә
+    { 19, 26, 19, 2, 25, 124, 10949 }, // Ӛ
+    { 17, 18, 21, 7, 16, 77, 11073 }, // ӛ
+    { 30, 29, 33, 1, 29, 218, 11150 }, // Ӝ
+    { 27, 26, 27, 0, 26, 176, 11368 }, // ӝ
+    { 18, 27, 18, 1, 26, 122, 11544 }, // Ӟ
+    { 18, 21, 11, 0, 21, 95, 11666 }, // ӟ
+    { 14, 18, 15, 3, 18, 63, 11761 }, // Ӡ
+    { 15, 18, 15, 1, 13, 68, 11824 }, // ӡ
+    { 22, 26, 23, 2, 26, 143, 11892 }, // Ӣ
+    { 18, 20, 17, 1, 20, 90, 12035 }, // ӣ
+    { 22, 27, 23, 2, 27, 149, 12125 }, // Ӥ
+    { 18, 21, 17, 1, 21, 95, 12274 }, // ӥ
+    { 24, 30, 25, 2, 29, 180, 12369 }, // Ӧ
+    { 16, 23, 20, 3, 22, 92, 12549 }, // ӧ
+    { 21, 19, 25, 2, 18, 100, 12641 }, // Ө
+    { 17, 14, 19, 1, 14, 60, 12741 }, // ө
+    { 21, 30, 25, 2, 29, 158, 12801 }, // Ӫ
+    { 18, 23, 19, 1, 23, 104, 12959 }, // ӫ
+    { 21, 28, 23, 1, 27, 147, 13063 }, // Ӭ
+    { 15, 22, 16, 2, 21, 83, 13210 }, // ӭ
+    { 19, 28, 17, -1, 26, 133, 13293 }, // Ӯ
+    { 19, 29, 19, 0, 22, 138, 13426 }, // ӯ
+    { 19, 29, 17, -1, 27, 138, 13564 }, // Ӱ
+    { 19, 31, 19, 0, 24, 148, 13702 }, // ӱ
+    { 21, 29, 17, -1, 27, 153, 13850 }, // Ӳ
+    { 22, 31, 19, 0, 24, 171, 14003 }, // ӳ
+    { 16, 26, 17, 4, 26, 104, 14174 }, // Ӵ
+    { 14, 21, 11, 2, 21, 74, 14278 }, // ӵ
+    { 18, 23, 16, 1, 19, 104, 14352 }, // Ӷ
+    { 13, 16, 11, 0, 13, 52, 14456 }, // ӷ
+    { 26, 29, 27, 2, 28, 189, 14508 }, // Ӹ
+    { 20, 24, 20, 2, 23, 120, 14697 }, // ӹ
+    { 24, 26, 25, 1, 22, 156, 14817 }, // Ӽ
+    { 17, 18, 17, 0, 15, 77, 14973 }, // ӽ
+    { 0, 0, 21, 0, 0, 0, 15050 }, //  
+    { 0, 0, 33, 0, 0, 0, 15050 }, //  
+    { 0, 0, 21, 0, 0, 0, 15050 }, //  
+    { 0, 0, 33, 0, 0, 0, 15050 }, //  
+    { 0, 0, 16, 0, 0, 0, 15050 }, //  
+    { 0, 0, 14, 0, 0, 0, 15050 }, //  
+    { 0, 0, 12, 0, 0, 0, 15050 }, //  
+    { 0, 0, 17, 0, 0, 0, 15050 }, //  
+    { 0, 0, 7, 0, 0, 0, 15050 }, //  
+    { 0, 0, 13, 0, 0, 0, 15050 }, //  
+    { 0, 0, 12, 0, 0, 0, 15050 }, //  
+    { 0, 0, 8, 0, 0, 0, 15050 }, // ​
+    { 0, 0, 0, 0, 0, 0, 15050 }, // ‌
+    { 0, 0, 0, 0, 0, 0, 15050 }, // ‍
+    { 0, 0, 0, 0, 0, 0, 15050 }, // ‎
+    { 0, 0, 0, 0, 0, 0, 15050 }, // ‏
+    { 13, 3, 14, 3, 9, 10, 15050 }, // ‐
+    { 13, 3, 14, 3, 9, 10, 15060 }, // ‑
+    { 19, 3, 19, 4, 9, 15, 15070 }, // ‒
+    { 18, 4, 20, 3, 9, 18, 13647 }, // –
+    { 26, 4, 28, 3, 9, 26, 13665 }, // —
+    { 26, 4, 28, 3, 9, 26, 15085 }, // ―
+    { 17, 22, 14, 0, 18, 94, 15111 }, // ‖
+    { 21, 8, 20, 0, -2, 42, 15205 }, // ‗
+    { 8, 7, 8, 5, 21, 14, 13691 }, // ‘
+    { 8, 8, 8, 5, 22, 16, 13705 }, // ’
+    { 8, 8, 8, 0, 4, 16, 15247 }, // ‚
+    { 8, 7, 8, 5, 21, 14, 15263 }, // ‛
+    { 14, 7, 14, 5, 21, 25, 13721 }, // “
+    { 14, 7, 14, 5, 21, 25, 13746 }, // ”
+    { 8, 8, 8, 0, 4, 16, 15277 }, // „
+    { 14, 8, 14, 5, 21, 28, 15293 }, // ‟
+    { 14, 32, 15, 4, 25, 112, 15321 }, // †
+    { 16, 32, 15, 2, 25, 128, 15433 }, // ‡
+    { 17, 15, 13, 0, 18, 64, 15561 }, // •
+    { 7, 8, 10, 3, 11, 14, 15625 }, // ‣
+    { 5, 5, 7, 1, 5, 7, 15639 }, // ․
+    { 5, 5, 7, 1, 5, 7, 15646 }, // ‥
+    { 22, 5, 24, 1, 5, 28, 13771 }, // …
+    { 4, 3, 6, 2, 9, 3, 15653 }, // ‧
+    { 0, 0, 32, 0, 0, 0, 15656 }, //  
+    { 20, 22, 28, 6, 20, 110, 15656 }, // ‰
+    { 8, 8, 8, 5, 22, 16, 15766 }, // ′
+    { 14, 7, 14, 5, 21, 25, 15782 }, // ″
+    { 18, 8, 21, -3, 21, 36, 15807 }, // ‴
+    { 5, 7, 8, 6, 21, 9, 15843 }, // ‵
+    { 11, 7, 13, 5, 21, 20, 15852 }, // ‶
+    { 18, 8, 21, 6, 21, 36, 15872 }, // ‷
+    { 11, 5, 14, 6, 20, 14, 15908 }, // ‸
+    { 9, 12, 10, 3, 13, 27, 15922 }, // ‹
+    { 9, 12, 10, -2, 13, 27, 15949 }, // ›
+    { 32, 26, 33, 1, 23, 208, 15976 }, // ※
+    { 12, 25, 8, 1, 25, 75, 16184 }, // ‼
+    { 17, 31, 19, 5, 30, 132, 16259 }, // ‽
+    { 13, 3, 14, 6, 21, 10, 16391 }, // ‾
+    { 11, 5, 16, 5, 17, 14, 16401 }, // ‿
+    { 18, 16, 20, 4, 22, 72, 16415 }, // ⁂
+    { 20, 20, 28, 6, 19, 100, 16487 }, // ⁄
+    { 30, 28, 32, 6, 28, 210, 16587 }, // ⁇
+    { 21, 28, 25, 6, 28, 147, 16797 }, // ⁈
+    { 26, 30, 20, 0, 28, 195, 16944 }, // ⁉
+    { 25, 39, 19, -1, 27, 244, 17139 }, // ⁒
+    { 0, 0, 121, 0, 0, 0, 17383 }, //  
+    { 8, 10, 8, 3, 21, 20, 17383 }, // ⁰
+    { 8, 10, 8, 3, 21, 20, 17403 }, // ⁴
+    { 8, 10, 8, 3, 21, 20, 17423 }, // ⁵
+    { 9, 9, 8, 3, 20, 21, 17443 }, // ⁶
+    { 7, 10, 8, 5, 21, 18, 17464 }, // ⁷
+    { 9, 10, 8, 3, 21, 23, 17482 }, // ⁸
+    { 9, 9, 8, 3, 20, 21, 17505 }, // ⁹
+    { 16, 14, 19, 1, 14, 56, 17526 }, // ⁿ
+    { 12, 13, 11, 1, 13, 39, 17582 }, // ₀
+    { 6, 10, 8, -1, 6, 15, 17621 }, // ₁
+    { 9, 10, 8, -1, 6, 23, 17636 }, // ₂
+    { 9, 9, 8, -1, 5, 21, 17659 }, // ₃
+    { 8, 10, 8, -1, 6, 20, 17680 }, // ₄
+    { 8, 10, 8, -1, 6, 20, 17700 }, // ₅
+    { 9, 9, 8, -1, 5, 21, 17720 }, // ₆
+    { 7, 11, 8, 1, 6, 20, 17741 }, // ₇
+    { 9, 10, 8, -1, 6, 23, 17761 }, // ₈
+    { 9, 9, 8, -1, 5, 21, 17784 }, // ₉
+    { 14, 34, 11, 3, 25, 119, 17805 }, // ₍
+    { 14, 34, 11, -6, 25, 119, 17924 }, // ₎
+    { 24, 31, 22, 0, 26, 186, 18043 }, // ₡
+    { 22, 23, 22, 1, 22, 127, 18229 }, // ₢
+    { 19, 24, 17, 1, 24, 114, 18356 }, // ₤
+    { 25, 22, 23, 0, 22, 138, 18470 }, // ₦
+    { 21, 21, 20, 1, 21, 111, 18608 }, // ₧
+    { 28, 21, 28, 0, 21, 147, 18719 }, // ₨
+    { 21, 21, 19, -1, 21, 111, 18866 }, // ₩
+    { 24, 19, 27, 4, 19, 114, 18977 }, // ₪
+    { 18, 20, 17, 2, 20, 90, 19091 }, // ₫
+    { 19, 23, 21, 2, 20, 110, 19181 }, // €
+    { 20, 21, 23, 5, 21, 105, 19291 }, // ₮
+    { 24, 21, 16, 1, 21, 126, 19396 }, // ₱
+    { 21, 30, 25, 2, 26, 158, 19522 }, // ₲
+    { 28, 23, 23, 2, 22, 161, 19680 }, // ₴
+    { 13, 20, 17, 1, 18, 65, 19841 }, // ₵
+    { 23, 22, 23, 5, 22, 127, 19906 }, // ₸
+    { 15, 20, 15, 3, 19, 75, 20033 }, // ₹
+    { 15, 17, 17, 2, 16, 64, 20108 }, // ₺
+    { 18, 20, 16, 2, 20, 90, 20172 }, // ₼
+    { 24, 21, 20, -3, 21, 126, 20262 }, // ₽
+    { 16, 16, 19, -3, 12, 64, 20388 }, // ←
+    { 16, 15, 19, 4, 15, 60, 20452 }, // ↑
+    { 16, 16, 19, 6, 12, 64, 20512 }, // →
+    { 16, 15, 19, 8, 15, 60, 20576 }, // ↓
+    { 27, 13, 22, -2, 11, 88, 20636 }, // ↔
+    { 14, 26, 16, 3, 24, 91, 20724 }, // ↕
+    { 15, 11, 16, -3, 11, 42, 20815 }, // ↖
+    { 15, 11, 16, 4, 11, 42, 20857 }, // ↗
+    { 12, 16, 16, 6, 14, 48, 20899 }, // ↘
+    { 12, 16, 16, -2, 14, 48, 20947 }, // ↙
+    { 19, 16, 21, 0, 15, 76, 0 }, // ⇐
+    { 20, 18, 23, 4, 18, 90, 76 }, // ⇑
+    { 19, 16, 21, 3, 15, 76, 166 }, // ⇒
+    { 20, 19, 23, 9, 18, 95, 242 }, // ⇓
+    { 25, 16, 24, 0, 15, 100, 337 }, // ⇔
+    { 16, 24, 19, 6, 15, 96, 437 }, // ⇕
+    { 19, 20, 17, 2, 20, 95, 533 }, // ∂
+    { 26, 23, 25, 0, 22, 150, 628 }, // ∅
+    { 20, 19, 22, 1, 19, 95, 778 }, // ∆
+    { 18, 18, 18, 4, 18, 81, 873 }, // ∏
+    { 18, 18, 18, 8, 18, 81, 954 }, // ∐
+    { 17, 19, 15, 1, 18, 81, 1035 }, // ∑
+    { 12, 4, 15, 3, 9, 12, 1116 }, // −
+    { 24, 21, 23, 3, 20, 126, 1128 }, // √
+    { 22, 12, 23, 3, 15, 66, 1254 }, // ∞
+    { 27, 28, 21, 0, 22, 189, 1320 }, // ∫
+    { 9, 15, 7, 1, 15, 34, 1509 }, // ∶
+    { 18, 12, 19, 5, 13, 54, 1543 }, // ≈
+    { 20, 22, 28, 6, 20, 110, 1597 }, // ≠
+    { 21, 19, 22, -1, 18, 100, 1707 }, // ≤
+    { 22, 19, 22, 1, 18, 105, 1807 }, // ≥
+    { 22, 20, 25, 2, 20, 110, 1912 }, // ﬀ
+    { 16, 22, 22, 2, 22, 88, 2022 }, // ﬁ
+    { 20, 21, 25, 2, 21, 105, 2110 }, // ﬂ
+    { 25, 22, 32, 2, 22, 138, 2215 }, // ﬃ
+    { 29, 21, 34, 2, 21, 153, 2353 }, // ﬄ
+    { 27, 19, 31, 1, 19, 129, 2506 }, // ﬆ
 };
 
 static const EpdUnicodeInterval opendyslexic_12_italicIntervals[] = {
@@ -2636,30 +2621,98 @@ static const EpdUnicodeInterval opendyslexic_12_italicIntervals[] = {
     { 0x2248, 0x2248, 0x2D1 },
     { 0x2260, 0x2260, 0x2D2 },
     { 0x2264, 0x2265, 0x2D3 },
+    { 0xFB00, 0xFB04, 0x2D5 },
+    { 0xFB06, 0xFB06, 0x2DA },
 };
 
 static const EpdFontGroup opendyslexic_12_italicGroups[] = {
-    { 0, 4223, 7999, 95, 0 },
-    { 4223, 4169, 9706, 96, 95 },
-    { 8392, 5920, 15786, 126, 191 },
-    { 14312, 676, 941, 61, 317 },
-    { 14988, 9942, 21043, 213, 378 },
-    { 24930, 1302, 2485, 63, 591 },
-    { 26232, 444, 660, 20, 654 },
-    { 26676, 1315, 2345, 20, 674 },
-    { 27991, 693, 1140, 16, 694 },
-    { 28684, 753, 1379, 15, 710 },
+    { 0, 5995, 13799, 151, 0 },
+    { 5995, 3110, 5785, 66, 379 },
+    { 9105, 8169, 20993, 236, 96 },
+    { 17274, 10421, 20995, 251, 381 },
+    { 27695, 1403, 2635, 27, 704 },
+};
+
+static const uint8_t opendyslexic_12_italicGlyphGroups[731] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 0,
+    0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 2, 2, 2, 0,
+    0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 2, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 3, 1, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 0, 0, 3, 3, 3, 0, 0, 3, 3, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+};
+
+static const EpdLigaturePair opendyslexic_12_italicLigatures[] = {
+    { 0x66, 0x66, 0xFB00 },
+    { 0x66, 0x69, 0xFB01 },
+    { 0x66, 0x6C, 0xFB02 },
+    { 0xFB00, 0x69, 0xFB03 },
+    { 0xFB00, 0x6C, 0xFB04 },
+};
+
+static const uint16_t opendyslexic_12_italicGlyphLookup[368] = {
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x005F, 0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E,
+    0x006F, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E,
+    0x007F, 0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E,
+    0x008F, 0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E,
+    0x009F, 0x00A0, 0x00A1, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE,
+    0x00AF, 0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE,
+    0x024F, 0x0250, 0x0251, 0x0252, 0x0253, 0x0254, 0x0255, 0x0256, 0x0257, 0x0258, 0x0259, 0x025A, 0x025B, 0x025C, 0x025D, 0x025E,
+    0x025F, 0x0260, 0x0261, 0x0262, 0x0263, 0x0264, 0x0265, 0x0266, 0x0267, 0x0268, 0x0269, 0x026A, 0x026B, 0x026C, 0x026D, 0x026E,
+    0x026F, 0x0270, 0x0271, 0x0272, 0x0273, 0x0274, 0x0275, 0x0276, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0277,
+    0x0278, 0xFFFF, 0x0279, 0x027A, 0x027B, 0x027C, 0x027D, 0x027E, 0x027F, 0x0280, 0x0281, 0x0282, 0x0283, 0x0284, 0x0285, 0x0286,
+    0xFFFF, 0xFFFF, 0x0287, 0xFFFF, 0x0288, 0xFFFF, 0xFFFF, 0x0289, 0x028A, 0x028B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x028C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x028D,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
 };
 
 static const EpdFontData opendyslexic_12_italic = {
     opendyslexic_12_italicBitmaps,
     opendyslexic_12_italicGlyphs,
     opendyslexic_12_italicIntervals,
-    56,
+    58,
     46,
     33,
     -13,
     true,
     opendyslexic_12_italicGroups,
-    10,
+    5,
+    nullptr,
+    nullptr,
+    nullptr,
+    0,
+    opendyslexic_12_italicLigatures,
+    5,
+    0x4000000001ull,
+    opendyslexic_12_italicGlyphLookup,
+    opendyslexic_12_italicGlyphGroups,
+    false,
+    nullptr,
 };
@@ -3,1587 +3,1563 @@
  * name: opendyslexic_12_regular
  * size: 12
  * mode: 2-bit  compressed: true
- * Command used: fontconvert.py opendyslexic_12_regular 12 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Regular.otf --2bit --compress
+ * Command used: fontconvert.py opendyslexic_12_regular 12 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Regular.otf --2bit --compress --no-kerning --frequency-corpus ../../../test/hyphenation_eval/resources/english_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/french_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/german_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/italian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/russian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/spanish_hyphenation_tests.txt
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t opendyslexic_12_regularBitmaps[25190] = {
-    0x65, 0x58, 0x4D, 0x8C, 0xDD, 0xD6, 0x75, 0x3E, 0x24, 0xAD, 0x61, 0x6A, 0xD6, 0xB9, 0x5A, 0x44,
-    0x08, 0x0A, 0x45, 0x62, 0x96, 0xAE, 0x23, 0x8B, 0x59, 0x64, 0xE1, 0x02, 0x6F, 0x1E, 0x69, 0x6B,
-    0xA1, 0x85, 0x17, 0x4E, 0x01, 0x8F, 0xB3, 0xC8, 0xC2, 0xDD, 0x14, 0x68, 0x9B, 0x16, 0xE3, 0x85,
-    0x80, 0x78, 0x31, 0x33, 0xA4, 0x3C, 0x0B, 0x2D, 0xB2, 0x88, 0x82, 0x36, 0x7B, 0x2F, 0x5A, 0x20,
-    0x19, 0x07, 0x98, 0x14, 0xF0, 0x42, 0x05, 0x66, 0x86, 0x57, 0x33, 0x0B, 0x2F, 0x0C, 0xA4, 0x94,
-    0x07, 0x81, 0x17, 0x5E, 0x88, 0xB2, 0xD4, 0xA4, 0xB5, 0x81, 0xE8, 0x3A, 0xA6, 0x62, 0xCE, 0x88,
-    0xE4, 0xED, 0xF7, 0x5D, 0x72, 0x9E, 0x34, 0xED, 0x0C, 0xDF, 0xE5, 0xCF, 0xE3, 0xBB, 0xF7, 0xFC,
-    0x7C, 0xE7, 0x3B, 0xE7, 0x5C, 0xAF, 0x98, 0x85, 0x7A, 0x2D, 0xD4, 0x3B, 0x11, 0x8F, 0x4E, 0x9D,
-    0x1C, 0xF1, 0xED, 0x4E, 0x32, 0x49, 0x37, 0xDB, 0xFC, 0xC3, 0xCE, 0xEA, 0x72, 0xB3, 0x2B, 0xAF,
-    0x74, 0x65, 0x80, 0xA3, 0x2D, 0x83, 0xC6, 0xF2, 0x68, 0x45, 0x66, 0xF2, 0xBE, 0x88, 0x84, 0x5A,
-    0x65, 0x38, 0xED, 0x48, 0x83, 0x31, 0x2A, 0x14, 0x46, 0x69, 0xC5, 0x60, 0x54, 0x45, 0x8C, 0xC1,
-    0xF2, 0xAF, 0x72, 0x63, 0x27, 0x5E, 0x13, 0xF0, 0x9B, 0x44, 0xE6, 0x18, 0x7D, 0x13, 0xD4, 0x38,
-    0xA5, 0xB2, 0x8C, 0x31, 0x30, 0x61, 0xE5, 0x6E, 0xD6, 0x45, 0x62, 0xF7, 0xF6, 0x3B, 0x6E, 0x6C,
-    0x24, 0xAA, 0x95, 0xC6, 0x37, 0xBD, 0x74, 0x9C, 0xB3, 0x1A, 0x6F, 0x3C, 0x77, 0xA3, 0xE3, 0x42,
-    0x4E, 0xFF, 0x5D, 0xBB, 0x86, 0xE1, 0xC2, 0x05, 0x0C, 0xE7, 0xED, 0x03, 0x91, 0xDC, 0xDA, 0x8C,
-    0x83, 0x96, 0x74, 0xB8, 0x70, 0x56, 0xE2, 0x8F, 0xAF, 0x66, 0x12, 0xDD, 0xBB, 0x53, 0x89, 0xDF,
-    0xF2, 0xCD, 0x9C, 0x6F, 0x2A, 0xFB, 0x93, 0x4C, 0x3C, 0x6B, 0x21, 0x4B, 0x04, 0x49, 0x21, 0x9D,
-    0x1D, 0xA0, 0xD6, 0xAB, 0xD6, 0x88, 0x77, 0xE7, 0x21, 0x2E, 0xAF, 0xFD, 0x18, 0xBF, 0xBF, 0x70,
-    0xD1, 0x9A, 0xF8, 0xE1, 0xB6, 0xED, 0xA8, 0x50, 0xCF, 0x61, 0x88, 0x78, 0x25, 0xAB, 0x96, 0x0B,
-    0x79, 0x77, 0xAA, 0x93, 0xD5, 0x9F, 0xF9, 0xDA, 0x42, 0x9A, 0x10, 0x96, 0x09, 0x8A, 0xB8, 0xF2,
-    0xF5, 0xC5, 0x7F, 0x92, 0xFA, 0x39, 0x4F, 0x9B, 0x40, 0xBE, 0x7B, 0xCD, 0xD3, 0xCF, 0xCD, 0xE4,
-    0x7B, 0xC1, 0x8B, 0xA2, 0xAE, 0xDE, 0xC5, 0xC2, 0x0F, 0xA1, 0xF0, 0xC7, 0xD0, 0x23, 0xB8, 0xDB,
-    0x8A, 0xFF, 0x87, 0xA0, 0x90, 0xAF, 0xE4, 0x2D, 0x79, 0xA4, 0xBF, 0x25, 0x6B, 0x6F, 0x85, 0xB2,
-    0xFC, 0xF5, 0xAB, 0x3A, 0xF1, 0x6D, 0x15, 0x4B, 0x52, 0x29, 0xA7, 0xEC, 0x79, 0xAC, 0xE6, 0x53,
-    0xC2, 0xA8, 0x82, 0xF6, 0x2A, 0x8B, 0xF4, 0x34, 0xD0, 0x18, 0x51, 0x5D, 0xF2, 0x5B, 0x1A, 0xA7,
-    0xA4, 0x6D, 0x21, 0xB8, 0x04, 0x50, 0x44, 0x94, 0xE9, 0xE4, 0x1B, 0x71, 0x95, 0x4A, 0x97, 0x6A,
-    0x75, 0x07, 0x83, 0xFF, 0x55, 0x93, 0x6A, 0x29, 0x4D, 0x62, 0x24, 0xD7, 0xF1, 0xF0, 0x03, 0x5B,
-    0x41, 0x9D, 0xA1, 0xF1, 0xAD, 0x35, 0xDF, 0x96, 0xEF, 0x0C, 0xD9, 0xA8, 0xC0, 0xCA, 0xEA, 0x27,
-    0x5F, 0x75, 0x36, 0xFD, 0x4F, 0xCC, 0xF0, 0xA2, 0xF3, 0xB7, 0xF1, 0xEB, 0x40, 0xC3, 0xCB, 0x99,
-    0x92, 0xCB, 0x70, 0xE2, 0x32, 0x1E, 0xAE, 0x9D, 0xFA, 0x9F, 0xE1, 0xD9, 0x1C, 0x0E, 0x8E, 0x21,
-    0x95, 0xD2, 0x91, 0x0E, 0xAB, 0xC0, 0xF8, 0x0D, 0x7C, 0xB7, 0x2B, 0xE7, 0xAE, 0xE1, 0xDB, 0xCB,
-    0xA2, 0x80, 0x92, 0x40, 0x07, 0x95, 0x67, 0x80, 0x92, 0x46, 0x6E, 0x2D, 0x7E, 0x36, 0xFE, 0xCF,
-    0xDC, 0x94, 0x3B, 0x78, 0xDE, 0x4A, 0x43, 0x88, 0x04, 0x55, 0xA4, 0xA1, 0x5C, 0x96, 0xCA, 0x86,
-    0xBC, 0x3E, 0x9A, 0x15, 0x86, 0xA8, 0xCF, 0x5E, 0x7B, 0xE9, 0xC5, 0xE4, 0x37, 0xEB, 0x92, 0x37,
-    0x70, 0xA6, 0x84, 0xF6, 0x41, 0xFC, 0x9B, 0x64, 0x73, 0x53, 0x17, 0x84, 0xDE, 0x4B, 0xB0, 0x0E,
-    0x14, 0x87, 0xF2, 0x86, 0x30, 0xC5, 0x92, 0x70, 0xD8, 0x21, 0xC1, 0xE4, 0x6E, 0x4E, 0xBE, 0xB9,
-    0x24, 0x67, 0xFE, 0x7A, 0x48, 0x3E, 0xEA, 0x92, 0x83, 0x36, 0x7F, 0xD5, 0xBC, 0xB0, 0xB5, 0x85,
-    0xB7, 0x0E, 0x60, 0x00, 0x51, 0x07, 0x5F, 0x74, 0x25, 0x4D, 0xF0, 0xED, 0x71, 0xB1, 0x17, 0xC5,
-    0xBD, 0x1F, 0xEA, 0xC5, 0x25, 0x67, 0xB8, 0x88, 0xCB, 0x66, 0xBC, 0x04, 0xD0, 0x21, 0xB0, 0x04,
-    0xD5, 0xA9, 0x4B, 0xC6, 0xC2, 0x1A, 0x2E, 0xE1, 0x09, 0xC6, 0xC8, 0x1A, 0x21, 0x7F, 0xFA, 0x12,
-    0x73, 0x2F, 0x4F, 0x97, 0x98, 0x05, 0x41, 0xE1, 0x61, 0xC2, 0xE8, 0xF4, 0x25, 0xA3, 0x63, 0x01,
-    0xF3, 0xA4, 0x96, 0x8B, 0xA1, 0x46, 0xCC, 0x61, 0xE5, 0xF7, 0x95, 0x04, 0xFB, 0x46, 0x66, 0x97,
-    0xA3, 0xE0, 0xB0, 0x6E, 0x97, 0xE7, 0x6A, 0xF3, 0x7E, 0xDD, 0xCC, 0xD3, 0x30, 0xB8, 0x6F, 0x64,
-    0x3D, 0xC9, 0xA2, 0x8F, 0x3A, 0xAF, 0x8B, 0x8F, 0xAD, 0xB6, 0xB6, 0x0D, 0xAD, 0x05, 0xAC, 0x2B,
-    0x59, 0x25, 0x28, 0xC4, 0xEB, 0x25, 0xEA, 0x45, 0xAD, 0xCB, 0x33, 0xCB, 0x6E, 0xFA, 0xC5, 0xB1,
-    0x7E, 0xFA, 0x80, 0xCB, 0x86, 0x7F, 0x49, 0x6D, 0x3F, 0x1E, 0x5E, 0x79, 0x13, 0x10, 0xF1, 0x1F,
-    0x9C, 0xAF, 0x33, 0xB8, 0x87, 0x6A, 0x50, 0xB1, 0xD6, 0xBD, 0x99, 0xE2, 0xD0, 0x92, 0x20, 0xCC,
-    0x2A, 0xC9, 0x6B, 0x62, 0x0F, 0xE1, 0x94, 0x1F, 0xFF, 0x32, 0xB1, 0xF6, 0x43, 0x6B, 0xBF, 0x44,
-    0xE8, 0x2F, 0xD9, 0x9B, 0xC1, 0xB1, 0x95, 0xCC, 0x77, 0x50, 0x62, 0x64, 0x78, 0xB0, 0xD0, 0xFB,
-    0x24, 0x0E, 0xDB, 0x4A, 0xDA, 0xE3, 0x91, 0x71, 0x6A, 0xC3, 0x10, 0xE0, 0x08, 0xAF, 0x4D, 0xB7,
-    0x07, 0xF0, 0x00, 0x3C, 0x22, 0xE5, 0xD1, 0x14, 0x4D, 0xA3, 0xBD, 0x53, 0x84, 0x70, 0x23, 0xDE,
-    0xE3, 0x42, 0xE6, 0x6F, 0x8B, 0xFA, 0xA0, 0xF0, 0xCD, 0x8E, 0x6C, 0x10, 0x22, 0x3B, 0xC1, 0xA3,
-    0x37, 0x7F, 0x9B, 0x5A, 0x7B, 0xDF, 0x32, 0x3C, 0x7A, 0x92, 0xC5, 0x78, 0x82, 0x98, 0x83, 0x3C,
-    0xFB, 0x5E, 0x0F, 0x2B, 0x5C, 0xC7, 0xF5, 0xDB, 0xCE, 0x75, 0x51, 0x21, 0x3E, 0x6E, 0xCA, 0x01,
-    0x86, 0xE9, 0xCE, 0x48, 0xAC, 0x9D, 0xC1, 0xE7, 0xCE, 0x29, 0xE1, 0xBD, 0x22, 0x6C, 0x72, 0xDB,
-    0x81, 0x09, 0x94, 0x1D, 0xBC, 0xB2, 0x25, 0x35, 0x64, 0x91, 0x6D, 0x80, 0x64, 0xFA, 0x0E, 0xBA,
-    0x03, 0xBD, 0xC0, 0xB2, 0x04, 0x9F, 0x0E, 0x59, 0x6A, 0x87, 0x60, 0xF0, 0xDB, 0xB4, 0x88, 0x0E,
-    0x8C, 0x2C, 0x27, 0x78, 0x86, 0x53, 0x5C, 0x44, 0xD5, 0xF0, 0x46, 0x87, 0x25, 0xB3, 0x04, 0xB6,
-    0x18, 0x0D, 0x0F, 0x6D, 0x3E, 0xDD, 0x06, 0x0A, 0x69, 0xEB, 0xD8, 0x79, 0x97, 0x74, 0x88, 0xD9,
-    0x37, 0xE0, 0xD9, 0x8C, 0xF2, 0xE2, 0xDE, 0x47, 0xF4, 0x5A, 0xA8, 0x59, 0x48, 0x5C, 0x53, 0xD3,
-    0x60, 0xBC, 0x5F, 0x7D, 0x20, 0xD1, 0xCF, 0x6E, 0x41, 0xF8, 0x5B, 0x80, 0x96, 0x81, 0xEB, 0xF5,
-    0x32, 0xE6, 0xD8, 0xC1, 0xAF, 0xFB, 0x37, 0x11, 0xC8, 0x0C, 0x81, 0x46, 0xF6, 0xFC, 0x36, 0xAC,
-    0xFD, 0x06, 0x32, 0x20, 0xDE, 0x15, 0xC4, 0x49, 0x55, 0xED, 0x77, 0xEA, 0xB8, 0xD4, 0x31, 0xA8,
-    0xEA, 0xD9, 0x01, 0x38, 0x82, 0x24, 0xE9, 0x36, 0xB8, 0x24, 0x85, 0x06, 0x2D, 0x38, 0xE8, 0xA0,
-    0x92, 0x9D, 0x65, 0x09, 0x0F, 0x2B, 0x60, 0x06, 0xFC, 0xD1, 0x79, 0xE4, 0xB5, 0x9A, 0xAF, 0x9F,
-    0xB9, 0x52, 0x39, 0x49, 0x23, 0xFD, 0xB7, 0x6F, 0x90, 0xF6, 0x32, 0x3C, 0x8F, 0x40, 0x76, 0xA9,
-    0xFA, 0xF8, 0x4F, 0xC3, 0xCA, 0xC8, 0x10, 0xDE, 0xF7, 0xBB, 0x7C, 0xF5, 0x93, 0x56, 0xDD, 0x46,
-    0x10, 0xF5, 0xE7, 0x26, 0xD6, 0x38, 0x15, 0x56, 0x0B, 0x66, 0x26, 0x27, 0xE1, 0x85, 0xB2, 0x02,
-    0xE7, 0x8D, 0x1F, 0x7F, 0xFA, 0x10, 0x35, 0xA0, 0xA9, 0x07, 0x24, 0xED, 0x9E, 0xFC, 0x65, 0x6F,
-    0x42, 0x4E, 0x72, 0xD7, 0x79, 0x32, 0x99, 0x4F, 0xC6, 0x5F, 0xB2, 0x76, 0xD3, 0x0E, 0xEF, 0x3E,
-    0x61, 0xFA, 0x2D, 0x5B, 0x97, 0x8E, 0xE8, 0xC6, 0x3F, 0xD2, 0x2F, 0x1D, 0x4D, 0xF8, 0x09, 0x49,
-    0x61, 0x1A, 0x56, 0x5B, 0x46, 0x0D, 0x87, 0x1C, 0x1E, 0x2E, 0x3B, 0x4C, 0x34, 0x64, 0xAB, 0xF6,
-    0x48, 0x52, 0x2C, 0x1C, 0x90, 0xE7, 0xFE, 0xEA, 0x64, 0x8A, 0xF3, 0x47, 0x70, 0x50, 0x1F, 0x1C,
-    0xAD, 0x9A, 0x4B, 0x84, 0x32, 0x41, 0xCE, 0x9C, 0xB4, 0x3E, 0x9E, 0x76, 0x1C, 0x34, 0x09, 0x80,
-    0x5C, 0x88, 0x96, 0x18, 0x9E, 0xE9, 0x1D, 0x1A, 0xE9, 0xC3, 0x54, 0x4E, 0x4E, 0x5E, 0xB6, 0x90,
-    0x69, 0x7A, 0x98, 0x67, 0x12, 0x52, 0x94, 0xA5, 0x5F, 0x12, 0xC4, 0xD4, 0x30, 0x38, 0xF2, 0x5A,
-    0xFA, 0xDD, 0xAF, 0x9C, 0x7D, 0x1D, 0x0F, 0xBC, 0xE4, 0x19, 0xF5, 0xDF, 0xBE, 0x9E, 0x07, 0x37,
-    0xF4, 0xB7, 0x02, 0xFD, 0x37, 0x97, 0xA4, 0xDA, 0xF9, 0x33, 0x5F, 0x5F, 0x88, 0x74, 0x75, 0xC9,
-    0xD7, 0xBB, 0xEA, 0x55, 0x3D, 0x8B, 0xEA, 0xBC, 0x57, 0x59, 0xEE, 0xB5, 0x9F, 0x57, 0xC0, 0x04,
-    0xC0, 0x9B, 0x38, 0xE3, 0xDA, 0x07, 0xDE, 0xBB, 0xB0, 0x1E, 0x02, 0x85, 0xF9, 0xAB, 0xA1, 0x11,
-    0x2D, 0xE6, 0x5B, 0xDA, 0xA2, 0x20, 0x1B, 0x7C, 0xA3, 0x74, 0xAF, 0xE1, 0xD6, 0x73, 0xF9, 0xE0,
-    0xF7, 0xD0, 0x26, 0x3C, 0x64, 0xBA, 0xDB, 0x27, 0xF1, 0x5C, 0xC7, 0x4F, 0xE2, 0xAC, 0xA3, 0xB8,
-    0x3B, 0x0C, 0x80, 0x0D, 0x06, 0x3E, 0x44, 0xEF, 0x00, 0x49, 0x88, 0xA9, 0x0A, 0xCE, 0xAD, 0x39,
-    0xD4, 0xCC, 0x78, 0x46, 0xFD, 0xD7, 0xCA, 0x0F, 0x1A, 0x18, 0x20, 0x68, 0x61, 0x24, 0xBF, 0x03,
-    0x4E, 0xC1, 0x27, 0xB4, 0x2F, 0xE2, 0x98, 0xF9, 0x76, 0x03, 0xD6, 0xD9, 0x00, 0x37, 0x6C, 0x80,
-    0xD7, 0xF0, 0xA9, 0x79, 0x9D, 0x6F, 0x6D, 0xEB, 0x1C, 0x51, 0x89, 0xEF, 0x8B, 0x0D, 0x58, 0x03,
-    0x6B, 0x74, 0x5C, 0x67, 0xFA, 0xEC, 0xE1, 0x33, 0x6C, 0x80, 0x94, 0xF0, 0x3D, 0x3F, 0x1D, 0x3E,
-    0x06, 0xEF, 0x4F, 0xA6, 0xF4, 0xB6, 0x5B, 0x26, 0x68, 0x2D, 0x2C, 0x21, 0x52, 0xB2, 0x29, 0x44,
-    0xF6, 0xB9, 0x28, 0xAC, 0xEF, 0x78, 0x43, 0xF6, 0x64, 0x0C, 0xF7, 0xA9, 0x48, 0x10, 0x46, 0xFC,
-    0xF8, 0x1E, 0x99, 0xE8, 0x19, 0x65, 0x8F, 0x7F, 0xA4, 0x39, 0xB1, 0xD3, 0x25, 0x76, 0xF3, 0x70,
-    0xC2, 0x9C, 0xA0, 0xC3, 0xDF, 0xB9, 0x15, 0xA7, 0xC0, 0x91, 0xAB, 0x18, 0x2A, 0x0E, 0x0D, 0xEC,
-    0x70, 0xBE, 0xA7, 0x31, 0x2C, 0x87, 0x14, 0x2A, 0x49, 0x5C, 0x6D, 0x10, 0x64, 0x18, 0x22, 0x68,
-    0x86, 0x85, 0x39, 0x34, 0xA7, 0x06, 0xC5, 0x21, 0x31, 0xF9, 0xCA, 0x0F, 0xA9, 0x00, 0xE6, 0xE2,
-    0xC0, 0x95, 0x87, 0x71, 0xD2, 0xDC, 0xFE, 0xCF, 0xA8, 0x13, 0xEE, 0xF6, 0x5D, 0x0D, 0xF1, 0xD9,
-    0xBB, 0x89, 0x2B, 0x9F, 0x1C, 0x54, 0x98, 0x05, 0x52, 0xCA, 0x6C, 0x0D, 0x24, 0xD5, 0x64, 0x3F,
-    0xAA, 0xD8, 0x9D, 0xFE, 0xB6, 0x5F, 0x59, 0xC1, 0xB7, 0xA0, 0x26, 0xDB, 0x41, 0x0B, 0xC3, 0x15,
-    0x58, 0x41, 0xC1, 0x41, 0xA0, 0xFA, 0xFC, 0xFB, 0x82, 0x42, 0x20, 0xAC, 0x1D, 0x9D, 0xAD, 0xB3,
-    0x9A, 0xE9, 0xE1, 0xB6, 0x57, 0x20, 0xCA, 0x9E, 0xB3, 0x17, 0x49, 0xA6, 0x71, 0xBC, 0x08, 0xCF,
-    0x21, 0x62, 0x58, 0xC9, 0x0D, 0x27, 0x37, 0x2E, 0xA2, 0x47, 0x04, 0x79, 0x9C, 0x36, 0x1C, 0x32,
-    0xAF, 0x70, 0x56, 0x8C, 0x5D, 0x75, 0xC6, 0x75, 0xD2, 0x62, 0x32, 0xFC, 0xA9, 0xC1, 0xFB, 0x37,
-    0x0E, 0x76, 0xC0, 0xED, 0xEA, 0x40, 0x4C, 0x1C, 0xE3, 0x65, 0xCF, 0x24, 0xC8, 0xCE, 0x26, 0xB6,
-    0x5B, 0xDB, 0xC6, 0x61, 0x27, 0x70, 0x15, 0x5D, 0xC9, 0x62, 0x6B, 0xC9, 0x4E, 0xB4, 0xBE, 0x8B,
-    0x9F, 0x33, 0xAC, 0x3A, 0x47, 0x7F, 0x4E, 0x42, 0x0A, 0x77, 0x85, 0x42, 0x3A, 0x61, 0x29, 0x5A,
-    0x45, 0x11, 0xAF, 0x50, 0x54, 0x27, 0x72, 0x6A, 0x9D, 0xB2, 0xE4, 0x84, 0xD1, 0x10, 0xB6, 0x4D,
-    0x3F, 0xDB, 0x2A, 0x0D, 0x62, 0x20, 0x3F, 0x40, 0x99, 0x69, 0x95, 0x91, 0x10, 0x55, 0x8E, 0xC4,
-    0x5F, 0x58, 0x17, 0xF9, 0xF1, 0x81, 0xE9, 0x52, 0xB5, 0x18, 0x5E, 0x3B, 0x6C, 0xFA, 0xF4, 0xA7,
-    0xBF, 0x3F, 0xB2, 0xF9, 0x5D, 0x43, 0x00, 0x01, 0xCE, 0x25, 0x89, 0x37, 0x32, 0x8C, 0xFC, 0x92,
-    0x15, 0x45, 0x84, 0xF8, 0x2A, 0x60, 0x19, 0xD8, 0x07, 0x4B, 0x42, 0xAC, 0x9E, 0x76, 0x83, 0x40,
-    0xB8, 0xEC, 0xE8, 0x0E, 0x78, 0xA3, 0xF4, 0x22, 0x10, 0x63, 0x95, 0x5A, 0xB1, 0x4D, 0x60, 0x19,
-    0xFA, 0x61, 0x1D, 0xA1, 0xDC, 0xC1, 0x8C, 0xBB, 0xF8, 0x5D, 0xF2, 0x0A, 0x48, 0x58, 0xE3, 0x77,
-    0x94, 0xAB, 0x03, 0x6D, 0xA4, 0x54, 0xE5, 0xA1, 0x06, 0x09, 0x90, 0x00, 0x49, 0x0D, 0x2D, 0x1D,
-    0x84, 0x84, 0x06, 0xAB, 0xF8, 0xC7, 0xB8, 0x18, 0xD2, 0x06, 0x65, 0xB7, 0xCD, 0x54, 0x9D, 0x37,
-    0x41, 0x83, 0xA4, 0xD3, 0x63, 0xEA, 0x34, 0x53, 0x8C, 0x5E, 0x21, 0x69, 0xC0, 0xB7, 0x4F, 0x9D,
-    0x20, 0xA1, 0xDF, 0xBA, 0xDC, 0x41, 0x0B, 0xE2, 0x14, 0x8C, 0x09, 0xF2, 0xE9, 0x93, 0xC3, 0x8E,
-    0x97, 0xBA, 0x34, 0x6C, 0xA7, 0xD3, 0xC4, 0x4F, 0xA0, 0xDF, 0x81, 0x35, 0xA2, 0x42, 0x81, 0x40,
-    0xE6, 0x8C, 0xA1, 0x2E, 0xD0, 0x0A, 0xA9, 0xAD, 0x47, 0x3F, 0x75, 0xE1, 0x43, 0x13, 0x3C, 0x36,
-    0x49, 0x5E, 0xC5, 0x77, 0xF5, 0x6E, 0x5E, 0xD8, 0xD4, 0x6F, 0x6D, 0xF0, 0xA8, 0x8F, 0x3E, 0x1D,
-    0x92, 0x0F, 0x9A, 0xE4, 0x46, 0x67, 0xE3, 0x6A, 0x50, 0x8F, 0x1B, 0x34, 0x08, 0xB1, 0xDD, 0x1F,
-    0x94, 0x49, 0x87, 0xA8, 0x4D, 0x75, 0xD9, 0x24, 0xD0, 0x18, 0x85, 0xC7, 0x41, 0x17, 0x0C, 0x01,
-    0x7C, 0x11, 0x1A, 0x45, 0x67, 0x48, 0x4A, 0x43, 0xB8, 0xA2, 0x94, 0x31, 0x07, 0x4F, 0x6B, 0x64,
-    0x84, 0x34, 0x18, 0xE8, 0xFC, 0x0E, 0x7E, 0x48, 0x5B, 0x78, 0x02, 0x76, 0xC9, 0x03, 0xCB, 0xB4,
-    0x75, 0x57, 0x83, 0xF2, 0xD2, 0x22, 0xB9, 0x0E, 0xDB, 0xED, 0x85, 0x66, 0x00, 0xE3, 0xDC, 0xEE,
-    0x54, 0x8D, 0x16, 0x24, 0x7D, 0xA5, 0x0B, 0x4D, 0x1F, 0x19, 0x75, 0x88, 0x2A, 0x36, 0xB9, 0x5B,
-    0xD9, 0x2C, 0x2D, 0xAF, 0xF4, 0x10, 0x18, 0x58, 0xB5, 0x26, 0xAD, 0x7C, 0x2C, 0x9E, 0xC1, 0x23,
-    0x40, 0xD9, 0xD8, 0x05, 0x20, 0xA9, 0xFC, 0xDC, 0x56, 0x61, 0x27, 0xB1, 0x21, 0x34, 0xDA, 0x78,
-    0xA2, 0x2E, 0xE9, 0x19, 0x50, 0x7B, 0x1C, 0x36, 0x38, 0xE4, 0x24, 0xCC, 0x94, 0x57, 0xF3, 0xF1,
-    0x19, 0xEC, 0x3E, 0xD0, 0x4E, 0x7D, 0x3C, 0xAC, 0xAC, 0xBA, 0xE2, 0x9F, 0xC5, 0x94, 0x35, 0x3E,
-    0x83, 0x9B, 0x48, 0xCE, 0xC6, 0x35, 0xF8, 0x17, 0x3B, 0x06, 0x1C, 0xBC, 0x47, 0x6F, 0xF4, 0x48,
-    0xED, 0x5D, 0x82, 0x10, 0xDC, 0x91, 0xF0, 0x23, 0x60, 0xEA, 0x35, 0xED, 0x33, 0x54, 0xD1, 0x06,
-    0xC1, 0x1E, 0xB6, 0x60, 0xA4, 0x71, 0x66, 0xA6, 0x82, 0x76, 0xCC, 0x5B, 0x39, 0x1C, 0xCA, 0xB6,
-    0x03, 0xA1, 0x1E, 0x1B, 0x07, 0xD9, 0xE9, 0xCF, 0x63, 0x9C, 0x84, 0x8C, 0x98, 0xF0, 0xC8, 0xB3,
-    0xCC, 0x24, 0x51, 0xED, 0x02, 0x98, 0x2D, 0x50, 0xAC, 0x39, 0x85, 0xA1, 0xA8, 0xBB, 0x50, 0x49,
-    0x92, 0x1B, 0x98, 0x2A, 0xBC, 0xD7, 0x12, 0x2B, 0xD4, 0x64, 0xC3, 0x3D, 0xBC, 0x4A, 0xEE, 0x40,
-    0x04, 0xFD, 0x05, 0xDE, 0xAC, 0x95, 0xED, 0xC6, 0xC6, 0x85, 0xE1, 0xE3, 0x5A, 0x2D, 0x72, 0x2B,
-    0x32, 0xC6, 0x92, 0x4B, 0x1E, 0x78, 0xE2, 0x12, 0x85, 0x6B, 0xD3, 0xE8, 0x2D, 0x6F, 0x25, 0x3B,
-    0xF3, 0x3A, 0x4B, 0x97, 0x96, 0xE5, 0x0B, 0x6A, 0xDA, 0x18, 0xC5, 0x67, 0xA8, 0x63, 0x54, 0xB8,
-    0xF8, 0xD4, 0x31, 0x20, 0x1F, 0x83, 0x1D, 0x92, 0x2D, 0xAB, 0xD9, 0x38, 0x81, 0x6E, 0xF0, 0x81,
-    0x3F, 0x74, 0xA2, 0x51, 0x11, 0xD5, 0xA9, 0x86, 0x5B, 0xC7, 0x0F, 0x5C, 0x15, 0x02, 0x1D, 0x8C,
-    0x4B, 0xF7, 0xE9, 0x47, 0x0E, 0x48, 0x59, 0xAD, 0x91, 0x20, 0x7D, 0x7B, 0xF3, 0x19, 0x67, 0x0F,
-    0x47, 0x76, 0x4F, 0x0F, 0x2E, 0x11, 0xB8, 0x74, 0x90, 0x33, 0xE5, 0x87, 0x2E, 0xC1, 0x7D, 0xD3,
-    0xC9, 0x98, 0xF2, 0xFD, 0x98, 0xAC, 0x1F, 0xF7, 0x88, 0xBF, 0xB4, 0x27, 0xC5, 0x38, 0x3F, 0x35,
-    0x09, 0x49, 0x82, 0x4C, 0x91, 0x41, 0xB5, 0x77, 0x17, 0xB4, 0x6B, 0xBF, 0xA0, 0xE6, 0x1F, 0xD8,
-    0xED, 0xCF, 0xEC, 0x48, 0xA7, 0x2E, 0x67, 0xB8, 0x85, 0x5C, 0x6F, 0x79, 0xFA, 0x11, 0x0D, 0xC8,
-    0x8C, 0x2F, 0xAE, 0xE3, 0x0C, 0x17, 0x8F, 0x98, 0x53, 0x5D, 0x0A, 0x8A, 0x68, 0xB4, 0xA4, 0x9A,
-    0xAA, 0x1B, 0x3E, 0x3A, 0x87, 0x02, 0xE8, 0x0A, 0x12, 0x34, 0x69, 0x30, 0xB9, 0x8F, 0x2C, 0xDF,
-    0xF3, 0xE2, 0x10, 0x39, 0x8C, 0x17, 0xF1, 0xE2, 0xE2, 0x00, 0x55, 0x6C, 0x07, 0x18, 0xFC, 0xDF,
-    0x0B, 0x7C, 0xB5, 0x8F, 0x9F, 0x77, 0xA8, 0xF5, 0xF3, 0xDB, 0xF6, 0xB3, 0xB2, 0xA5, 0x93, 0x32,
-    0x82, 0x2E, 0xA4, 0xDF, 0xA2, 0x45, 0x5E, 0x94, 0x49, 0xE4, 0x78, 0x9F, 0x05, 0x6A, 0x0D, 0x29,
-    0x83, 0x06, 0x04, 0xE5, 0x75, 0x23, 0xA7, 0xE7, 0x2C, 0x3D, 0x70, 0x9F, 0x68, 0x94, 0x0B, 0xC0,
-    0x58, 0x49, 0x59, 0x55, 0x8D, 0x9B, 0xA0, 0x23, 0xD6, 0xCA, 0x0C, 0x12, 0xC7, 0xF0, 0x10, 0xEE,
-    0x13, 0x96, 0xC2, 0xAF, 0xB1, 0x12, 0xA0, 0x81, 0x03, 0xBA, 0x04, 0xE0, 0xCE, 0x78, 0xEF, 0x5A,
-    0x48, 0xA6, 0x86, 0xB2, 0x99, 0x8C, 0xE3, 0xB7, 0x2E, 0xE1, 0xAB, 0x8F, 0x5A, 0xC7, 0x22, 0x91,
-    0x71, 0xE6, 0x71, 0x66, 0x81, 0xC3, 0xC7, 0x7C, 0x30, 0x50, 0xB2, 0x0E, 0x94, 0x9A, 0x17, 0x21,
-    0xE2, 0x1F, 0xB1, 0x98, 0x16, 0xAA, 0x02, 0xC1, 0xF4, 0xB8, 0xB0, 0x88, 0x5E, 0x29, 0xA3, 0xC7,
-    0xA8, 0x20, 0x10, 0x17, 0x1F, 0x9A, 0x41, 0xC2, 0x3F, 0x0E, 0xEA, 0x3E, 0xA4, 0x7B, 0xD8, 0xA4,
-    0x77, 0xD1, 0x45, 0x30, 0x65, 0x62, 0xC1, 0x9E, 0xBD, 0x81, 0xC7, 0x60, 0x03, 0xE9, 0xDB, 0x22,
-    0x84, 0x40, 0x0A, 0x8D, 0x0B, 0x6B, 0x15, 0x33, 0x55, 0x3F, 0xCE, 0x02, 0x6E, 0x5B, 0x01, 0x7D,
-    0x66, 0xEB, 0x16, 0x25, 0x2B, 0xE6, 0xD4, 0x3E, 0x29, 0xFA, 0x49, 0xCA, 0xF0, 0x31, 0x7B, 0x36,
-    0x96, 0x9A, 0x23, 0xFB, 0x3C, 0x29, 0x86, 0xA8, 0x99, 0x22, 0xF0, 0x93, 0xFB, 0x98, 0x36, 0xDF,
-    0x27, 0x16, 0x33, 0x9B, 0xF9, 0x16, 0x21, 0x88, 0x60, 0x4C, 0x8C, 0xC2, 0xA4, 0x2D, 0x96, 0x0B,
-    0xC9, 0x14, 0xD1, 0xA7, 0x2D, 0xB9, 0x0A, 0xAD, 0x4E, 0x51, 0x62, 0x41, 0xC4, 0x21, 0x10, 0xAF,
-    0xA1, 0x79, 0x0F, 0x93, 0x47, 0x06, 0xA0, 0x48, 0x7F, 0x5A, 0x8F, 0x0D, 0xB8, 0x22, 0x46, 0x4B,
-    0x2E, 0x3B, 0x4C, 0x99, 0x93, 0x85, 0xFC, 0x93, 0x0B, 0x46, 0x78, 0xD4, 0x4D, 0x02, 0x29, 0x67,
-    0x74, 0x00, 0xD7, 0x73, 0xDB, 0x24, 0x6E, 0xF8, 0x87, 0xAD, 0x6D, 0x57, 0xBB, 0x12, 0x5F, 0x28,
-    0x9A, 0x31, 0x2B, 0x26, 0x8C, 0x86, 0x93, 0x72, 0x96, 0x53, 0xFB, 0xFC, 0x6D, 0xC4, 0x28, 0x4D,
-    0xBA, 0xC9, 0x41, 0xAE, 0x9E, 0x8E, 0xF8, 0x6A, 0x32, 0x4C, 0x78, 0x6F, 0x38, 0xB4, 0x1C, 0x58,
-    0x57, 0xA1, 0x91, 0x5B, 0x79, 0x19, 0xC5, 0x09, 0xE8, 0x29, 0xD2, 0xE8, 0xC6, 0x76, 0xD0, 0xAC,
-    0x2B, 0x0D, 0xFB, 0xA1, 0x24, 0xE2, 0x45, 0x8D, 0xBA, 0x74, 0xCE, 0xAA, 0xAF, 0x46, 0x01, 0xB1,
-    0x8E, 0xCA, 0x30, 0xAC, 0x70, 0xC1, 0xB7, 0xA6, 0xD7, 0xD3, 0xC5, 0xEB, 0xE8, 0xCE, 0x36, 0x6D,
-    0x7D, 0x56, 0xBE, 0x26, 0x41, 0x86, 0xA6, 0xF8, 0x12, 0x7B, 0x65, 0x83, 0xEE, 0xCE, 0x9D, 0x96,
-    0xD9, 0xDE, 0x18, 0x4C, 0x15, 0x69, 0xFC, 0x7E, 0x71, 0x52, 0x19, 0xCA, 0x79, 0xB4, 0xD5, 0xE7,
-    0x5E, 0x57, 0x16, 0xB9, 0xE6, 0xE9, 0x35, 0xC6, 0x55, 0xC7, 0xE5, 0x9F, 0x08, 0x34, 0x89, 0xE8,
-    0x16, 0x5F, 0xBC, 0xBA, 0xBE, 0x78, 0x95, 0x22, 0x18, 0x58, 0xEB, 0x79, 0x66, 0xC0, 0xB8, 0xF1,
-    0xEA, 0xF7, 0x2F, 0xC9, 0xB5, 0x33, 0x2B, 0x2B, 0x6E, 0xE3, 0x89, 0xA9, 0xCE, 0x61, 0x74, 0x99,
-    0xEF, 0x1B, 0xF9, 0x3B, 0x5E, 0x2F, 0xF5, 0x6F, 0x81, 0xBC, 0xB3, 0xBD, 0x1F, 0x36, 0x2A, 0x8B,
-    0xDF, 0xC1, 0x24, 0x33, 0x34, 0x41, 0x5A, 0x76, 0xC6, 0x53, 0x37, 0x47, 0x05, 0x01, 0x23, 0x21,
-    0xE6, 0xAA, 0xD2, 0xAE, 0x7B, 0xE5, 0x66, 0x3D, 0xF1, 0xC1, 0xD3, 0x15, 0xD8, 0x74, 0xCB, 0xF6,
-    0x3C, 0x89, 0x1E, 0xC8, 0x9E, 0xED, 0x7C, 0xFB, 0xBB, 0x0E, 0x78, 0x41, 0x62, 0xF1, 0x4C, 0x2E,
-    0xC1, 0x3D, 0x44, 0xDC, 0x0D, 0x68, 0xAF, 0xA0, 0x61, 0x5A, 0x20, 0xA9, 0x7D, 0x4E, 0xE2, 0x67,
-    0xFD, 0x33, 0x42, 0xEE, 0x1B, 0x23, 0x76, 0xCB, 0x3A, 0x44, 0x41, 0x5D, 0x9F, 0x45, 0xE6, 0x4E,
-    0x5D, 0xF3, 0x39, 0xF6, 0xE1, 0x73, 0x97, 0x1E, 0x10, 0x93, 0x40, 0x66, 0x08, 0xE5, 0x56, 0xA7,
-    0x52, 0x69, 0xDA, 0x78, 0xE0, 0xBE, 0xC2, 0x6C, 0xB1, 0x25, 0xF1, 0xAF, 0xB1, 0x24, 0xFD, 0x1A,
-    0x42, 0xD6, 0x24, 0x2F, 0x5B, 0x6D, 0xC4, 0x46, 0x85, 0xDF, 0xC1, 0xFA, 0x35, 0xEC, 0xB1, 0x59,
-    0xC9, 0x1E, 0x34, 0x6F, 0xD3, 0x9B, 0x79, 0xCD, 0x6D, 0x30, 0xB2, 0x7D, 0x69, 0x77, 0x64, 0xF5,
-    0x9E, 0x39, 0xD9, 0x4E, 0x88, 0x91, 0x16, 0xAB, 0x08, 0x8D, 0xF5, 0xEC, 0xA2, 0x04, 0xFB, 0xC7,
-    0xA8, 0xE0, 0xD0, 0x41, 0xFF, 0xD6, 0x89, 0xC1, 0xFE, 0x9E, 0x39, 0xD2, 0xFE, 0xFC, 0x1F, 0x23,
-    0x57, 0x36, 0x77, 0xF2, 0x1D, 0x44, 0xD4, 0x6A, 0x91, 0xD7, 0x70, 0x11, 0x45, 0x81, 0x42, 0x9D,
-    0xB5, 0x68, 0x8F, 0x1A, 0xBC, 0xEF, 0x7C, 0xD3, 0xA2, 0x5A, 0x8E, 0x8B, 0xB0, 0x76, 0x17, 0x08,
-    0xC4, 0xF2, 0x4A, 0x95, 0x0E, 0x6B, 0xEA, 0x73, 0x7B, 0xDB, 0x44, 0x90, 0x2A, 0x3D, 0xD0, 0x5E,
-    0x37, 0x03, 0xD3, 0xB9, 0x53, 0x72, 0x50, 0x87, 0xA8, 0x1C, 0x28, 0x17, 0x2B, 0xF3, 0x22, 0x6A,
-    0x58, 0xDA, 0xB0, 0x6E, 0x79, 0x0E, 0xA9, 0xCE, 0xB5, 0xA1, 0x9D, 0x87, 0x0E, 0x9D, 0x94, 0x8A,
-    0x7E, 0x9D, 0xDD, 0x3F, 0x77, 0x4F, 0xA6, 0x93, 0x19, 0x2D, 0x61, 0xFE, 0x5E, 0xE2, 0xBC, 0x47,
-    0xE0, 0x34, 0xB1, 0x89, 0xAF, 0x77, 0xB2, 0x96, 0x64, 0x6E, 0x5B, 0x04, 0x4D, 0xF0, 0x21, 0x60,
-    0x98, 0x9E, 0x9C, 0x42, 0xF0, 0xCB, 0x5E, 0x9A, 0x45, 0x75, 0xA2, 0x0E, 0x1F, 0x0D, 0x4E, 0xFD,
-    0x8B, 0xE1, 0xF5, 0xFA, 0x6D, 0x0E, 0xB7, 0x92, 0xC8, 0xD5, 0x86, 0x15, 0x5B, 0xBD, 0x3D, 0x92,
-    0xA5, 0x5D, 0x30, 0xEC, 0xF3, 0x54, 0x74, 0xF6, 0xD4, 0x00, 0x9B, 0xAF, 0x4D, 0x43, 0x81, 0x7E,
-    0x1C, 0x82, 0xDD, 0x82, 0x3C, 0x61, 0x13, 0x13, 0xD0, 0xAC, 0x6A, 0x46, 0x11, 0xD1, 0xE0, 0x73,
-    0x93, 0xE0, 0xC9, 0xC9, 0x37, 0x73, 0x49, 0x00, 0xE8, 0x2F, 0xC1, 0x5D, 0xBB, 0x2E, 0x9C, 0x41,
-    0x2B, 0x01, 0xF7, 0x26, 0x01, 0x8A, 0x2F, 0x81, 0xF6, 0xD8, 0x04, 0xA6, 0xD4, 0xA9, 0x6F, 0x03,
-    0x43, 0x42, 0x58, 0xF3, 0x4C, 0xA4, 0x13, 0x69, 0x83, 0x5A, 0x15, 0xCB, 0xD2, 0x04, 0x95, 0xCA,
-    0xD6, 0xBD, 0x26, 0xAC, 0x62, 0x77, 0xB2, 0x71, 0x9F, 0xB7, 0xD1, 0x8D, 0x16, 0x4C, 0x7E, 0xB9,
-    0xEC, 0x11, 0xEC, 0xF6, 0x77, 0xFD, 0xF1, 0x2E, 0x98, 0xDD, 0xCA, 0x2D, 0x84, 0x4F, 0x23, 0xA8,
-    0x0A, 0x22, 0x1D, 0xDC, 0x6E, 0x19, 0xDF, 0x21, 0x63, 0x65, 0x06, 0xC3, 0xD4, 0x9E, 0xD9, 0x45,
-    0x2C, 0x84, 0x07, 0x8C, 0x21, 0x96, 0x25, 0x8D, 0xEC, 0xBA, 0x80, 0x6E, 0x5C, 0xB4, 0x55, 0x5F,
-    0x8F, 0x6B, 0x58, 0xB2, 0x8A, 0x9B, 0x1C, 0xF9, 0xAE, 0x4D, 0xB2, 0xE8, 0x1D, 0x84, 0x5F, 0xE2,
-    0x3A, 0xC5, 0x1D, 0x94, 0xA1, 0xF8, 0x19, 0x12, 0x15, 0xAA, 0x2E, 0xD4, 0x4D, 0xE3, 0x89, 0xFB,
-    0x09, 0x89, 0xAD, 0xD5, 0x83, 0xD5, 0x97, 0x8D, 0xAC, 0xCD, 0x61, 0xEC, 0x4A, 0xE6, 0xCB, 0xE2,
-    0x7F, 0x89, 0xBC, 0x83, 0x3B, 0xD8, 0x7C, 0x37, 0x1E, 0xE8, 0xE0, 0xC6, 0x47, 0xEE, 0x0A, 0x07,
-    0xF1, 0xFC, 0xFF, 0x90, 0xCB, 0xE9, 0x00, 0xB2, 0xDA, 0x80, 0xA8, 0x33, 0x24, 0x82, 0x5B, 0x8C,
-    0x19, 0x74, 0x85, 0xB7, 0x51, 0x9D, 0xE1, 0x76, 0x0D, 0x66, 0xA8, 0xCB, 0xA3, 0xF2, 0x15, 0xE6,
-    0xF1, 0x87, 0x56, 0xCF, 0x93, 0xCE, 0x6B, 0x3D, 0x89, 0x2A, 0x57, 0xE0, 0x9E, 0x84, 0x5E, 0x7C,
-    0x52, 0x20, 0x79, 0x8E, 0x10, 0x41, 0x4B, 0xDB, 0xDB, 0xD0, 0x00, 0x28, 0x15, 0x65, 0x08, 0xF9,
-    0xA0, 0x02, 0x37, 0x1B, 0xC4, 0xD1, 0x8C, 0x9B, 0xC6, 0xA8, 0x9B, 0x02, 0x66, 0xBE, 0xFC, 0x3D,
-    0xCB, 0x2E, 0x19, 0xA5, 0x7B, 0x6F, 0x64, 0xE9, 0x88, 0x51, 0x44, 0x0C, 0x85, 0x9F, 0x14, 0x6E,
-    0x47, 0x42, 0x72, 0x6E, 0xEB, 0x8C, 0xE9, 0x55, 0x3D, 0x5B, 0x3D, 0xEE, 0x15, 0xDA, 0x8C, 0x31,
-    0xA9, 0xB8, 0x01, 0x92, 0x22, 0x27, 0x20, 0x69, 0x81, 0xC7, 0xD9, 0xFD, 0x97, 0x2D, 0x50, 0x4A,
-    0x67, 0xCF, 0x1C, 0x24, 0x99, 0xFD, 0xA1, 0x9A, 0x57, 0x8E, 0xBB, 0x04, 0xAA, 0xDA, 0x78, 0x8F,
-    0xDB, 0x48, 0x29, 0xF7, 0x90, 0xC6, 0x10, 0xFE, 0x35, 0x39, 0xC3, 0x35, 0xD7, 0x3F, 0x3A, 0xFE,
-    0x67, 0xC8, 0x31, 0xE7, 0x36, 0x00, 0xE2, 0x4C, 0x15, 0x08, 0x17, 0xC4, 0x0C, 0xE0, 0x87, 0xD2,
-    0x3E, 0x7F, 0xDD, 0xB3, 0x6D, 0x44, 0xF8, 0x6B, 0x30, 0x17, 0x82, 0xB8, 0x1D, 0x4F, 0x20, 0x27,
-    0x75, 0x50, 0xBB, 0x13, 0x1C, 0x02, 0x06, 0x57, 0xFB, 0x4D, 0x70, 0x12, 0x40, 0xCA, 0x3E, 0xD6,
-    0x69, 0xBF, 0xC3, 0x58, 0x79, 0x5E, 0xE4, 0x2F, 0xD1, 0x55, 0xAE, 0x41, 0xA4, 0x16, 0x72, 0x9B,
-    0xB0, 0xF2, 0x01, 0xAD, 0x00, 0xCC, 0xC9, 0xBA, 0x14, 0x4F, 0x77, 0xF1, 0x6D, 0x3A, 0x1F, 0xD3,
-    0x06, 0x8B, 0x27, 0xC2, 0x0D, 0x89, 0xEE, 0x05, 0x48, 0xF8, 0x0B, 0xC7, 0x6F, 0xB0, 0xB4, 0xD7,
-    0x42, 0x12, 0xBF, 0x51, 0x7A, 0x06, 0x38, 0xEA, 0xBD, 0xC0, 0x44, 0x77, 0xEC, 0xD5, 0x3A, 0xBC,
-    0x6F, 0x3F, 0xAC, 0x16, 0x3B, 0x02, 0xDA, 0xB7, 0x9F, 0xB3, 0x55, 0x3C, 0x40, 0xB8, 0xD8, 0x97,
-    0x2D, 0xFB, 0x70, 0xB4, 0x10, 0x06, 0xFE, 0x6A, 0xE1, 0xA4, 0x1E, 0x6B, 0xA7, 0x98, 0x09, 0x59,
-    0xDF, 0xAD, 0xC0, 0x5D, 0x10, 0x9E, 0x99, 0x99, 0xCA, 0x3C, 0xF3, 0x3A, 0x54, 0x26, 0x8D, 0xAA,
-    0x55, 0xCD, 0xD2, 0x90, 0x9C, 0xE5, 0x99, 0x35, 0xD8, 0x07, 0xAC, 0xEE, 0x35, 0x4C, 0xE9, 0xDC,
-    0x3D, 0x06, 0x28, 0x01, 0xE1, 0xF8, 0x27, 0xE8, 0xBB, 0x58, 0xCF, 0x74, 0xAE, 0x9F, 0xF7, 0x90,
-    0xBF, 0x99, 0x44, 0x95, 0x71, 0x04, 0x45, 0xB3, 0xC3, 0x71, 0xB9, 0x75, 0x75, 0x6B, 0xD8, 0x8F,
-    0xC0, 0x80, 0x7C, 0x15, 0xB7, 0x2D, 0x57, 0xDE, 0xFC, 0xFF, 0x1D, 0x2F, 0xCB, 0x9F, 0xDC, 0x6D,
-    0xB0, 0x71, 0xC3, 0x3B, 0x75, 0x7D, 0x64, 0x27, 0x4B, 0xBF, 0x90, 0xB4, 0x63, 0xB7, 0xBF, 0xE3,
-    0x60, 0xB6, 0x38, 0x5A, 0xF6, 0xD2, 0x09, 0xB1, 0xC4, 0x96, 0x89, 0xDD, 0x54, 0x33, 0x1D, 0x3E,
-    0xDB, 0x5B, 0x77, 0x3D, 0xDC, 0xA4, 0x60, 0x63, 0x4D, 0x72, 0x01, 0x7F, 0x97, 0xA6, 0xBF, 0xD9,
-    0xF4, 0xF7, 0xD2, 0x0B, 0x37, 0x39, 0x39, 0xBB, 0xDD, 0xF9, 0xB8, 0x5F, 0x7A, 0x72, 0x24, 0x8E,
-    0xF2, 0x60, 0x7D, 0x40, 0x2B, 0x74, 0x38, 0xC3, 0xED, 0x78, 0x00, 0x15, 0x38, 0xE2, 0xEC, 0x4C,
-    0x99, 0x21, 0xCB, 0x2B, 0x97, 0xCA, 0xE2, 0xEC, 0xE0, 0x57, 0x7F, 0xFE, 0xD6, 0xBF, 0x7F, 0x10,
-    0xB4, 0x67, 0xCF, 0xC8, 0xFF, 0x02, 0xC5, 0x59, 0x4D, 0x6C, 0xDC, 0xC6, 0x15, 0x7E, 0x24, 0x2D,
-    0x31, 0x11, 0x25, 0x51, 0x40, 0x93, 0x22, 0xA8, 0x23, 0xB1, 0x28, 0x72, 0x28, 0x12, 0x4B, 0x74,
-    0x0B, 0x1F, 0x84, 0x76, 0x77, 0xC9, 0xC4, 0x48, 0x7B, 0x29, 0x12, 0x03, 0xB1, 0x92, 0x43, 0xCF,
-    0x3D, 0x14, 0x49, 0x2B, 0x1F, 0x72, 0x70, 0x5B, 0xC9, 0x4B, 0xDB, 0x40, 0xD2, 0x4B, 0x1B, 0xF5,
-    0x10, 0xF4, 0x6A, 0x14, 0x29, 0xD0, 0xBA, 0x28, 0xAC, 0x83, 0x0F, 0x4A, 0xB0, 0x12, 0x47, 0xD2,
-    0xA1, 0x68, 0x73, 0xA1, 0x6B, 0xA4, 0x05, 0x9A, 0xA2, 0x61, 0xAD, 0x38, 0x29, 0x9C, 0x16, 0x9E,
-    0x20, 0x44, 0x42, 0x27, 0x24, 0xA7, 0xDF, 0x1B, 0x72, 0xE5, 0x95, 0x62, 0x27, 0xB1, 0xE3, 0xD8,
-    0x5C, 0x2E, 0x87, 0x4B, 0xCE, 0xBC, 0xF7, 0xE6, 0xCD, 0xFB, 0xF9, 0xDE, 0xAC, 0x7A, 0xB5, 0xE8,
-    0x6E, 0xE6, 0x41, 0x44, 0xF4, 0x70, 0xE1, 0x89, 0xC2, 0xED, 0x9F, 0x8E, 0xE8, 0xE1, 0xB4, 0xC5,
-    0x82, 0x2D, 0x5A, 0x46, 0x44, 0x43, 0x44, 0xEE, 0xC0, 0x19, 0x4B, 0x5B, 0x49, 0xF7, 0x8D, 0x09,
-    0xFF, 0x31, 0x0A, 0xC6, 0xA9, 0xDD, 0x3F, 0x3B, 0xE3, 0x14, 0x3C, 0x46, 0xFE, 0xFF, 0xC8, 0x55,
-    0x99, 0xA5, 0x0A, 0xEA, 0x5E, 0xA1, 0x49, 0xE2, 0x73, 0x0F, 0x6D, 0x1F, 0x7E, 0x4E, 0xA6, 0x52,
-    0xA1, 0x7B, 0x65, 0x6F, 0xE2, 0x46, 0x14, 0x81, 0x18, 0xE9, 0x6F, 0x48, 0xE4, 0x40, 0x0A, 0x4B,
-    0xE0, 0x9B, 0x10, 0x99, 0x29, 0x91, 0x21, 0xD1, 0x1D, 0x7D, 0xF9, 0x3B, 0xB4, 0x3A, 0x47, 0xB4,
-    0x88, 0x8E, 0x05, 0xDE, 0xE3, 0x3B, 0x8F, 0xF7, 0xEA, 0xD2, 0x6F, 0x49, 0x29, 0x25, 0xF1, 0x2D,
-    0x98, 0xF4, 0x11, 0x3A, 0xE2, 0x5E, 0x3E, 0x23, 0x62, 0x30, 0x4F, 0x3B, 0xB4, 0x60, 0x48, 0x47,
-    0xB8, 0x61, 0xCF, 0x90, 0xB6, 0xEC, 0x52, 0x57, 0x49, 0x4F, 0xA9, 0x8D, 0x0F, 0xCB, 0xD5, 0x11,
-    0x32, 0x43, 0x96, 0x83, 0xA8, 0x63, 0x49, 0x0A, 0xF0, 0xF1, 0x43, 0x3B, 0xF5, 0x23, 0x5A, 0xF3,
-    0x05, 0x04, 0x07, 0x7F, 0x05, 0xFE, 0x1E, 0xE8, 0xE3, 0x35, 0xE8, 0xA3, 0x8F, 0x2A, 0xF1, 0x00,
-    0x2F, 0x6C, 0x3C, 0x30, 0x98, 0x55, 0xB7, 0x40, 0x4F, 0x15, 0x59, 0x97, 0xB7, 0x1F, 0x50, 0xDD,
-    0x43, 0x1F, 0x93, 0x38, 0xEE, 0xDF, 0xB7, 0x8F, 0x27, 0xBD, 0xA7, 0xD5, 0x1C, 0xB3, 0x64, 0x2C,
-    0x41, 0x6F, 0x05, 0x26, 0xB9, 0x40, 0x07, 0xE8, 0xAB, 0x94, 0xD4, 0x73, 0x75, 0x32, 0x9E, 0x63,
-    0x64, 0x29, 0x25, 0xBC, 0x25, 0x2F, 0x5A, 0x21, 0xCF, 0x4C, 0x68, 0xC1, 0x79, 0xD3, 0x92, 0x60,
-    0x20, 0x1C, 0x4C, 0xCC, 0xE8, 0x42, 0x14, 0x88, 0x46, 0xDD, 0xE8, 0x07, 0x4F, 0x95, 0xE8, 0x28,
-    0x03, 0xA5, 0x68, 0x5E, 0x2D, 0xF5, 0x35, 0x1A, 0x50, 0x1E, 0x18, 0x45, 0xD7, 0x2C, 0xE2, 0x83,
-    0x05, 0xFD, 0x90, 0x26, 0x47, 0xE8, 0x4F, 0xCF, 0xDD, 0x75, 0x64, 0xF4, 0x9B, 0xE1, 0x03, 0x7F,
-    0xA6, 0x27, 0x26, 0xCD, 0x61, 0x7F, 0x74, 0xC4, 0x10, 0xC3, 0x6F, 0xA2, 0xA7, 0xFD, 0xDF, 0xC9,
-    0xD6, 0x03, 0xA3, 0xFB, 0x47, 0xF7, 0x8F, 0x1D, 0x68, 0xFB, 0x95, 0xF3, 0x0F, 0x2C, 0x6B, 0x68,
-    0x87, 0xCB, 0x8E, 0xC8, 0x71, 0xBA, 0xC7, 0x33, 0x47, 0x64, 0x56, 0xDE, 0xA5, 0xE0, 0x79, 0x69,
-    0xA2, 0xF1, 0xED, 0xD4, 0x14, 0xCF, 0xD2, 0x04, 0x05, 0xBF, 0x3F, 0x04, 0x61, 0xD6, 0xE7, 0x9E,
-    0xC6, 0x6C, 0x17, 0x30, 0x4F, 0x10, 0x12, 0x7A, 0x71, 0xE8, 0xC1, 0xD3, 0xA7, 0xF1, 0x66, 0x93,
-    0x95, 0xA4, 0x19, 0xFF, 0xE5, 0xD1, 0xBB, 0xBF, 0xF6, 0xBD, 0xFD, 0x3F, 0x7F, 0x60, 0x53, 0x3E,
-    0x31, 0xFA, 0x9B, 0xE1, 0x6F, 0xFC, 0x73, 0xC4, 0xD4, 0x8C, 0xE7, 0x4E, 0xA8, 0xAA, 0x96, 0xD5,
-    0x58, 0x83, 0xE2, 0x12, 0xDF, 0x90, 0x2D, 0x5A, 0x59, 0xA0, 0x56, 0x8F, 0x16, 0x16, 0xA9, 0x17,
-    0x3C, 0x92, 0xFB, 0x4A, 0x3A, 0x4A, 0x18, 0x2F, 0x6B, 0x63, 0x60, 0xBD, 0x80, 0x7A, 0x0B, 0x8A,
-    0x57, 0x8F, 0x3E, 0x75, 0x31, 0xAC, 0x7F, 0x68, 0x33, 0xA9, 0x89, 0x3C, 0xF9, 0x12, 0x4C, 0x62,
-    0xE8, 0x10, 0xD4, 0x92, 0x3C, 0x2C, 0x2C, 0x1A, 0xA5, 0xD4, 0x33, 0xA4, 0x5B, 0x3E, 0x78, 0x0A,
-    0xAB, 0xB6, 0x44, 0xD1, 0xDD, 0x76, 0x4A, 0xA9, 0x21, 0x1C, 0x3F, 0xFB, 0x71, 0x68, 0x1F, 0x5C,
-    0x97, 0x67, 0x5B, 0x58, 0x62, 0x2B, 0x5D, 0x25, 0xF7, 0x44, 0x46, 0x1D, 0x37, 0xA1, 0x22, 0x88,
-    0x2C, 0x59, 0x91, 0xBB, 0x99, 0x53, 0xE0, 0x4A, 0xFC, 0x14, 0x96, 0x54, 0x61, 0x80, 0x79, 0x28,
-    0x4C, 0xA7, 0xF8, 0xB6, 0xAA, 0xE4, 0x96, 0x7A, 0x7D, 0x33, 0x3A, 0x4C, 0xE3, 0x60, 0xF7, 0x40,
-    0xC3, 0x36, 0xB6, 0x84, 0x12, 0x32, 0x96, 0xAD, 0xA0, 0x70, 0xDD, 0xCA, 0xDA, 0x54, 0x91, 0xEC,
-    0xA6, 0x2D, 0x27, 0x77, 0x69, 0xD5, 0x12, 0x41, 0x28, 0xDD, 0x64, 0x9F, 0x25, 0x1D, 0xA3, 0x30,
-    0x45, 0x4C, 0xCB, 0x81, 0x98, 0x76, 0xA5, 0x73, 0xB0, 0x30, 0xCF, 0x29, 0x3A, 0x1B, 0x47, 0xD3,
-    0x7E, 0xEA, 0x84, 0x60, 0xF8, 0x6E, 0x11, 0x87, 0x77, 0x99, 0xE1, 0xB7, 0xC2, 0x51, 0xFA, 0xD5,
-    0x33, 0x01, 0xEC, 0x70, 0xC1, 0xD8, 0x4F, 0x7A, 0x0A, 0x47, 0x0C, 0x11, 0xC8, 0xD3, 0x91, 0x2D,
-    0x27, 0xEF, 0x3F, 0x30, 0x76, 0x60, 0xE4, 0xC0, 0xC8, 0xEC, 0x98, 0x57, 0xD8, 0xE9, 0xC4, 0x1E,
-    0x1A, 0x37, 0x12, 0x4B, 0x76, 0xC8, 0xB7, 0x52, 0x23, 0xF3, 0xC9, 0xB3, 0x52, 0x77, 0xA3, 0x70,
-    0xFF, 0x8A, 0x33, 0x77, 0x92, 0xDC, 0x48, 0x66, 0xB7, 0xDD, 0x0B, 0xD3, 0x86, 0xF2, 0x56, 0xF8,
-    0x16, 0x72, 0x8F, 0x91, 0x15, 0x91, 0x43, 0x94, 0x92, 0x1D, 0xD2, 0x2C, 0x2B, 0x75, 0x8A, 0x60,
-    0x5B, 0x76, 0x84, 0x27, 0x46, 0x4A, 0xCB, 0x64, 0xBC, 0x1C, 0x1E, 0x85, 0x2F, 0x66, 0x2D, 0x0A,
-    0xE3, 0x72, 0x1A, 0x46, 0x09, 0x0D, 0xB7, 0xD9, 0x13, 0xE1, 0x0B, 0xB6, 0x98, 0x4C, 0xE1, 0x87,
-    0xE3, 0xB3, 0x70, 0x44, 0x17, 0xC4, 0xA4, 0x73, 0x32, 0xA1, 0xDC, 0xC2, 0x32, 0x2E, 0xD0, 0xA1,
-    0x45, 0xDD, 0x8D, 0x3D, 0xC8, 0x12, 0x43, 0xEC, 0xA6, 0xEC, 0xB8, 0x64, 0xE5, 0xCC, 0xF8, 0x4B,
-    0x11, 0x19, 0xCC, 0x0E, 0xF4, 0xC1, 0x1E, 0x23, 0x41, 0x41, 0x30, 0xD3, 0x67, 0x89, 0x8E, 0xF2,
-    0x12, 0xDA, 0x11, 0x84, 0x00, 0xEB, 0xD9, 0x21, 0x8A, 0x4B, 0xD7, 0xAB, 0x1C, 0x75, 0xEE, 0x42,
-    0x74, 0x96, 0x17, 0x18, 0x12, 0x42, 0x47, 0x2D, 0xB6, 0x2C, 0xDC, 0x82, 0x45, 0xC6, 0x76, 0xE6,
-    0xB3, 0x2D, 0xB8, 0x82, 0x66, 0xC8, 0x91, 0xF8, 0x6D, 0x54, 0x87, 0xF1, 0xDC, 0x57, 0xC2, 0x27,
-    0x44, 0x18, 0x23, 0xDC, 0x8E, 0x2B, 0xA6, 0xE2, 0xFB, 0x89, 0x49, 0xAA, 0x23, 0xC1, 0xDD, 0x44,
-    0xC3, 0xCC, 0xF9, 0xCB, 0x11, 0x26, 0xE6, 0xE6, 0xCC, 0xD9, 0x94, 0x46, 0xC2, 0x72, 0xC3, 0x94,
-    0x68, 0x19, 0x8A, 0x99, 0xF0, 0xA0, 0x06, 0x5B, 0xA5, 0x3C, 0xFF, 0xDC, 0x8E, 0xC6, 0xE8, 0x30,
-    0x49, 0x0E, 0x3D, 0xD3, 0xB4, 0x46, 0xB5, 0x02, 0x28, 0xB3, 0x7E, 0x49, 0xE0, 0x2C, 0xA1, 0x0B,
-    0x31, 0x83, 0x10, 0xB5, 0xC2, 0x1A, 0xF0, 0xE8, 0x1E, 0x2F, 0xE4, 0x8E, 0x92, 0x7A, 0x4C, 0x4F,
-    0xAB, 0x80, 0x60, 0x47, 0x04, 0x23, 0x87, 0x75, 0xF1, 0xD3, 0xFE, 0x71, 0xA8, 0x7E, 0x98, 0x0E,
-    0x36, 0x7E, 0xCA, 0x02, 0x99, 0x08, 0x1B, 0xC7, 0x88, 0x67, 0x66, 0x64, 0xEC, 0xC3, 0x3A, 0xDA,
-    0x74, 0xD0, 0xA4, 0xFA, 0x97, 0x99, 0xD3, 0x7D, 0x6E, 0xB6, 0x37, 0xE9, 0xAA, 0x9C, 0xE2, 0x2B,
-    0x9A, 0x16, 0x87, 0x48, 0xB2, 0x13, 0x76, 0x00, 0xAD, 0xEA, 0x87, 0xE8, 0xE3, 0xC7, 0x31, 0x6D,
-    0xA8, 0x7C, 0x61, 0x75, 0x18, 0x1C, 0xCD, 0xAC, 0xB7, 0x31, 0xC4, 0x3E, 0x0F, 0xB2, 0xCE, 0x06,
-    0x58, 0xC0, 0xCD, 0xE1, 0xC2, 0x61, 0xC1, 0x5C, 0x7A, 0xCC, 0x11, 0x43, 0x56, 0x99, 0x63, 0x01,
-    0x27, 0x01, 0x61, 0x97, 0x63, 0x91, 0x12, 0x7C, 0x49, 0x1D, 0x8E, 0xAE, 0xEE, 0xC5, 0xB9, 0xA7,
-    0x32, 0xC4, 0x36, 0x2B, 0x47, 0x10, 0x32, 0xE1, 0x3A, 0x64, 0x20, 0x1C, 0x5A, 0xBC, 0xE4, 0x4E,
-    0xD8, 0x44, 0x6F, 0xE8, 0x08, 0x47, 0x9B, 0x3E, 0xF5, 0xB8, 0x96, 0x7C, 0x1F, 0xF1, 0x65, 0x8B,
-    0xE5, 0xDB, 0x64, 0xF9, 0x36, 0x58, 0xBE, 0x28, 0xE7, 0x08, 0xAD, 0x85, 0x5C, 0xE5, 0x51, 0x5A,
-    0xBE, 0x5A, 0xC8, 0x88, 0x85, 0x14, 0x9F, 0x49, 0xC8, 0xFB, 0x98, 0xD1, 0xA2, 0xE6, 0xC6, 0x06,
-    0xBA, 0x29, 0x38, 0x19, 0x2D, 0xDF, 0x41, 0xAD, 0x69, 0x2F, 0x95, 0xEC, 0x69, 0xB3, 0xB8, 0x8C,
-    0x8D, 0x43, 0x96, 0x31, 0x5E, 0xF0, 0x3B, 0x25, 0x90, 0x17, 0x62, 0xAC, 0x1F, 0x41, 0xB2, 0x40,
-    0x5F, 0xD6, 0xAB, 0x1B, 0x58, 0xB7, 0x2F, 0x44, 0x43, 0x9A, 0xD1, 0x06, 0xF3, 0x58, 0x67, 0x0B,
-    0x7B, 0x27, 0xEC, 0x33, 0xBF, 0xA3, 0x52, 0xF5, 0x8F, 0x1A, 0x69, 0x70, 0x6F, 0xD8, 0xA7, 0xAD,
-    0xD4, 0xA5, 0x97, 0xA8, 0x86, 0x0C, 0x60, 0xD2, 0xD5, 0x4D, 0x10, 0xE8, 0x66, 0xD1, 0xD7, 0x4D,
-    0xA1, 0x31, 0x81, 0x99, 0x21, 0xAB, 0xB0, 0x83, 0xEB, 0xC6, 0x49, 0x74, 0xE3, 0x0A, 0x0E, 0x07,
-    0x90, 0x42, 0x37, 0x81, 0x8E, 0x1F, 0x88, 0x0E, 0xDC, 0x18, 0xA0, 0x9F, 0xD5, 0x6C, 0xAE, 0xCC,
-    0x1D, 0x02, 0x1B, 0xE6, 0x87, 0x17, 0x9C, 0x9B, 0xBC, 0x44, 0x37, 0x01, 0x43, 0x15, 0x55, 0xEE,
-    0xD0, 0x86, 0x71, 0x26, 0xE7, 0xA1, 0x82, 0x58, 0xC8, 0x00, 0x54, 0x5D, 0x10, 0x31, 0xB9, 0x0F,
-    0x27, 0x1A, 0xC6, 0x2E, 0x1C, 0xD8, 0x74, 0x84, 0x62, 0xCF, 0xAA, 0x6F, 0x78, 0xC1, 0xB9, 0x1F,
-    0x29, 0x1E, 0xA0, 0x2E, 0x3D, 0x2D, 0xBA, 0x18, 0xAE, 0x95, 0xE2, 0x69, 0x3A, 0x4C, 0xB0, 0xAB,
-    0xFE, 0x03, 0x4A, 0xCC, 0xE3, 0x27, 0x7C, 0xF9, 0x3A, 0x33, 0xC3, 0xC4, 0x86, 0x56, 0x34, 0x01,
-    0x06, 0x36, 0x1C, 0xBC, 0xAC, 0x4C, 0x87, 0xAD, 0x81, 0x03, 0xA2, 0x17, 0xC8, 0xD4, 0x69, 0x5C,
-    0x9D, 0x36, 0xD1, 0xC1, 0x11, 0x3A, 0xB4, 0x69, 0x08, 0xC7, 0x6B, 0x03, 0x35, 0x04, 0x60, 0x01,
-    0xAD, 0xF3, 0x50, 0x77, 0xD7, 0xDB, 0xD7, 0xE6, 0x0E, 0x81, 0x79, 0xAA, 0x34, 0xBE, 0xD0, 0x79,
-    0x99, 0xE3, 0xBA, 0x06, 0x07, 0x53, 0xA4, 0x01, 0x82, 0x2D, 0xAE, 0x63, 0x17, 0xB7, 0x9A, 0xAF,
-    0x51, 0xE3, 0x45, 0x03, 0xCA, 0x9A, 0x9A, 0x21, 0x23, 0x99, 0x42, 0xC6, 0xDD, 0x86, 0xB4, 0x50,
-    0x93, 0x8C, 0x95, 0x3A, 0xA1, 0x3E, 0xFC, 0x1D, 0x33, 0xF2, 0x07, 0x48, 0x31, 0xE5, 0x86, 0x11,
-    0xD4, 0xC8, 0xFA, 0x0E, 0x76, 0xBD, 0x9D, 0x9B, 0x0B, 0xC1, 0xE4, 0x64, 0xC3, 0x28, 0x60, 0x20,
-    0xC5, 0x0B, 0x22, 0x18, 0x96, 0x16, 0x54, 0xDA, 0xD2, 0xCE, 0xFC, 0x64, 0x60, 0x66, 0xB7, 0x98,
-    0xD9, 0x04, 0x3C, 0xC2, 0x49, 0xCC, 0x8C, 0xEE, 0xDD, 0x36, 0xA2, 0x82, 0xAE, 0xF5, 0x29, 0x9B,
-    0x4F, 0x45, 0x95, 0x51, 0x19, 0x8A, 0x3F, 0xD6, 0xF1, 0x44, 0x1E, 0x1D, 0x08, 0xF9, 0xDE, 0xA6,
-    0x2C, 0x02, 0x77, 0xFB, 0xF2, 0xF8, 0xF9, 0xAC, 0x0C, 0x5E, 0x78, 0xFB, 0x8A, 0xEA, 0xBE, 0x21,
-    0x75, 0x96, 0x80, 0x69, 0xBC, 0x92, 0x4E, 0xDB, 0xCF, 0x71, 0x6A, 0x1E, 0xE0, 0x06, 0xC9, 0xAE,
-    0x73, 0x49, 0xC0, 0xAF, 0xBE, 0xA4, 0xE0, 0xEB, 0xA5, 0x86, 0x22, 0x4F, 0xF2, 0x25, 0x5C, 0x45,
-    0xC8, 0x0A, 0x44, 0x85, 0x73, 0xC7, 0xB2, 0xDF, 0xAB, 0x71, 0x78, 0xF0, 0xC9, 0x67, 0x38, 0x70,
-    0x46, 0x7C, 0x76, 0x71, 0x8A, 0xE6, 0x9C, 0x3B, 0x5C, 0x5B, 0xCF, 0x92, 0xD6, 0x34, 0x8C, 0xA3,
-    0xCB, 0x57, 0xC4, 0x89, 0xF9, 0x8C, 0xD1, 0x15, 0x7C, 0xD0, 0x8B, 0x58, 0x9C, 0x63, 0x8C, 0xC8,
-    0x39, 0x0B, 0x07, 0x11, 0x83, 0xAE, 0x78, 0xF8, 0xCC, 0xA5, 0xC8, 0x60, 0x8D, 0x86, 0x76, 0xC6,
-    0x6E, 0xE9, 0x25, 0xFC, 0xB8, 0x1B, 0xA2, 0x37, 0x1C, 0x90, 0x7B, 0x4B, 0xA3, 0x9C, 0x9B, 0x57,
-    0x82, 0x9D, 0xB9, 0x64, 0xDA, 0x58, 0x68, 0xD0, 0xAE, 0xB4, 0xAF, 0x03, 0x94, 0xA9, 0x8A, 0xE1,
-    0xBC, 0x95, 0x22, 0x2B, 0x4C, 0x27, 0x58, 0xBA, 0x73, 0xE7, 0x43, 0xB2, 0x1E, 0x29, 0x18, 0xDA,
-    0x35, 0x10, 0x07, 0xE5, 0x4F, 0xC0, 0xCE, 0x5C, 0xB8, 0x05, 0x56, 0x34, 0x80, 0x24, 0x02, 0x2E,
-    0xDB, 0xB5, 0x80, 0x9A, 0x0B, 0x57, 0x45, 0x8E, 0x0C, 0x80, 0xD8, 0x8F, 0x17, 0x15, 0xAD, 0xD9,
-    0xEF, 0x16, 0x66, 0xEE, 0x6D, 0xE6, 0x6E, 0x1A, 0xDB, 0x32, 0x38, 0x51, 0xB8, 0x49, 0xE9, 0x48,
-    0x6F, 0x33, 0xF3, 0x45, 0xF0, 0x78, 0xA2, 0x28, 0xEE, 0x1E, 0xC4, 0x3A, 0x96, 0x6E, 0x66, 0xA2,
-    0x92, 0x48, 0x30, 0x5E, 0x85, 0x8E, 0xB2, 0xA0, 0x65, 0x70, 0x1B, 0xA1, 0x9D, 0x10, 0x23, 0x08,
-    0x07, 0xF5, 0x3B, 0xAC, 0xDE, 0xD4, 0x1A, 0x01, 0xD6, 0x7A, 0x51, 0x25, 0x76, 0x81, 0xE5, 0x80,
-    0x46, 0xEC, 0xDC, 0x6B, 0x22, 0x25, 0x95, 0x6C, 0x71, 0x6B, 0x7C, 0x39, 0xC6, 0x97, 0xEE, 0x31,
-    0x1D, 0x10, 0x71, 0xE9, 0xD4, 0xCF, 0x40, 0xAD, 0x0A, 0x12, 0xA8, 0xC4, 0xAB, 0xE6, 0xE6, 0x21,
-    0x35, 0xC2, 0x1A, 0x2B, 0x44, 0x9A, 0x5A, 0x09, 0xB0, 0xEB, 0xB0, 0xE6, 0x51, 0x1F, 0xEC, 0xE9,
-    0x8C, 0x1C, 0x1B, 0x88, 0xE1, 0x6D, 0xE3, 0x8C, 0xEB, 0x1D, 0xB7, 0x59, 0xBE, 0x3D, 0xDB, 0x98,
-    0x87, 0x53, 0x90, 0xB9, 0xC5, 0xD5, 0x1C, 0xA3, 0x8B, 0xAB, 0xB1, 0xE1, 0xF6, 0x0A, 0x64, 0xA6,
-    0xFB, 0xA0, 0xAF, 0xA3, 0x88, 0xCE, 0x0E, 0x70, 0x3B, 0x8D, 0xDB, 0xD9, 0x80, 0xF9, 0xDC, 0x6E,
-    0xE5, 0xE8, 0x30, 0x16, 0x2D, 0x72, 0x55, 0xBC, 0xC6, 0xCE, 0x82, 0x8C, 0x17, 0xF0, 0xE5, 0x0E,
-    0xAD, 0x96, 0x1B, 0x2E, 0x5B, 0x5B, 0x09, 0x29, 0xF8, 0x3A, 0xE3, 0x04, 0xFB, 0x03, 0xE9, 0xAD,
-    0x17, 0x3B, 0xAD, 0xC7, 0x4C, 0xFB, 0xE5, 0x74, 0xFD, 0x33, 0x6B, 0x46, 0x36, 0x49, 0xA6, 0x37,
-    0x50, 0x63, 0x5D, 0xBF, 0x57, 0x31, 0xD8, 0x6B, 0xBE, 0xEA, 0x36, 0x31, 0x9B, 0x7B, 0x19, 0x3C,
-    0x4D, 0xFE, 0x29, 0x49, 0x23, 0x06, 0x45, 0x0E, 0xB7, 0x58, 0xA5, 0x2E, 0xDB, 0x8F, 0x2F, 0xAC,
-    0x8C, 0x73, 0x75, 0x49, 0xFE, 0x89, 0x9C, 0x83, 0xB6, 0x51, 0xD8, 0x3A, 0x70, 0xBB, 0x49, 0x9D,
-    0xA1, 0xE2, 0x3A, 0x9E, 0x23, 0x65, 0xE9, 0x98, 0x8E, 0xC8, 0xC3, 0xAF, 0x2F, 0x14, 0x1C, 0xC3,
-    0xC8, 0xBF, 0x9C, 0xE8, 0x4C, 0xDF, 0x55, 0x73, 0xB1, 0xAC, 0x81, 0x0A, 0x13, 0x37, 0x54, 0x0D,
-    0x12, 0x34, 0xBE, 0xA9, 0x45, 0xD1, 0x98, 0x41, 0xCD, 0x57, 0x6C, 0x17, 0x8E, 0x6C, 0x26, 0x13,
-    0xD5, 0x0E, 0xD7, 0x48, 0xEF, 0x35, 0x19, 0xA7, 0x59, 0xAE, 0x7E, 0xAF, 0xEE, 0xCE, 0x5E, 0xFD,
-    0xBC, 0xD4, 0x80, 0x90, 0x91, 0x70, 0x97, 0x37, 0x4E, 0x50, 0x5D, 0xCC, 0xD4, 0xBA, 0xD1, 0x91,
-    0xE4, 0x9E, 0x81, 0xC8, 0x8F, 0xCA, 0xE8, 0x30, 0x50, 0x8C, 0xBF, 0x85, 0x52, 0xA8, 0x82, 0x00,
-    0xFE, 0x79, 0xDC, 0x94, 0xB8, 0xF1, 0x70, 0x63, 0x6C, 0xDF, 0x14, 0x18, 0x88, 0xD8, 0xF5, 0xB1,
-    0x1B, 0x7E, 0x05, 0x8C, 0xE5, 0x6F, 0x54, 0x64, 0x17, 0x5E, 0xF5, 0x07, 0x75, 0x9C, 0x41, 0x13,
-    0x1B, 0x01, 0xDB, 0x14, 0x2F, 0x7F, 0xDF, 0x14, 0xB9, 0x84, 0x37, 0x59, 0x56, 0xAE, 0xFB, 0x74,
-    0xA5, 0x9A, 0x7D, 0x52, 0x10, 0x31, 0x0E, 0xDF, 0x2E, 0xC1, 0xA8, 0x89, 0x6C, 0x1A, 0x33, 0xBD,
-    0x02, 0x4D, 0x4D, 0x23, 0xD8, 0x0D, 0x0F, 0xA6, 0x47, 0x24, 0xB4, 0xA1, 0x83, 0x45, 0x23, 0xC6,
-    0x56, 0x23, 0x86, 0xBF, 0x43, 0x0C, 0x7D, 0x73, 0x0D, 0x31, 0xF4, 0x0D, 0x5E, 0x6D, 0x60, 0x78,
-    0x81, 0x8A, 0xB3, 0xBB, 0xAE, 0x2E, 0xC5, 0x39, 0x27, 0x1E, 0xC6, 0x00, 0xD2, 0x66, 0x43, 0x70,
-    0x54, 0xD5, 0x2C, 0xDA, 0x22, 0x60, 0x92, 0x93, 0x62, 0x60, 0x05, 0xF3, 0x72, 0x65, 0xB3, 0xD2,
-    0x03, 0x2A, 0x31, 0x6E, 0xA9, 0x4A, 0xA2, 0x5B, 0xB4, 0x56, 0x7D, 0x4F, 0x74, 0x2E, 0xE4, 0x9C,
-    0x18, 0xC1, 0x22, 0x8A, 0xE1, 0x1A, 0x98, 0x43, 0x05, 0x7F, 0x42, 0x20, 0x29, 0xAD, 0x1C, 0xE6,
-    0x0B, 0xF7, 0x0A, 0x5E, 0x48, 0x11, 0x67, 0x0A, 0x06, 0x7F, 0x11, 0x6F, 0x5F, 0xC2, 0x34, 0x19,
-    0x3B, 0x30, 0x58, 0xD7, 0xF6, 0xBC, 0x7D, 0xC3, 0x28, 0xDE, 0xE1, 0x1B, 0x76, 0x1F, 0x4E, 0x89,
-    0xBD, 0xFE, 0x19, 0x2F, 0x51, 0x5C, 0xD1, 0x6A, 0x37, 0xE9, 0xD9, 0x59, 0x8F, 0x8A, 0x1E, 0xB5,
-    0x7B, 0x34, 0xA5, 0xAF, 0x45, 0xCF, 0xC9, 0xD6, 0xE2, 0x04, 0x6F, 0xD1, 0xA7, 0x37, 0x30, 0x84,
-    0x81, 0xA3, 0x85, 0x09, 0xB6, 0xCD, 0xC4, 0x4A, 0x4C, 0xE1, 0x92, 0x15, 0xB6, 0xE8, 0x47, 0x86,
-    0x74, 0x96, 0x6C, 0xF1, 0x2C, 0x79, 0xA6, 0xA0, 0x05, 0xE0, 0x22, 0x39, 0x03, 0x84, 0x1A, 0x00,
-    0xCB, 0x75, 0x51, 0x8D, 0x05, 0x8F, 0x48, 0xF2, 0x31, 0x93, 0x85, 0x60, 0xC2, 0x94, 0x65, 0xAC,
-    0x4E, 0xBE, 0xAF, 0x0A, 0xF7, 0x6F, 0x7A, 0x6F, 0x43, 0x57, 0xB2, 0x79, 0x8D, 0xE7, 0x9A, 0x8D,
-    0x8F, 0xF9, 0xBF, 0x93, 0xAF, 0x32, 0xE7, 0x62, 0x1C, 0x66, 0x46, 0x3E, 0x43, 0xEE, 0x49, 0x00,
-    0xA7, 0x16, 0xEA, 0x68, 0xDD, 0xB8, 0x9B, 0xA9, 0xCD, 0x98, 0xE4, 0x1C, 0xD6, 0xDA, 0x51, 0x1F,
-    0x24, 0x7B, 0xF3, 0x0E, 0xF1, 0x0E, 0x48, 0xAB, 0xCE, 0xAA, 0x59, 0x93, 0x52, 0x77, 0x1F, 0x37,
-    0x4C, 0x93, 0x8F, 0x54, 0x7B, 0xB8, 0xBB, 0x8A, 0xA4, 0x7D, 0x96, 0x4E, 0x19, 0x3A, 0x1A, 0x0E,
-    0x97, 0x47, 0x78, 0xA7, 0x77, 0xED, 0xFB, 0x99, 0x1B, 0x7A, 0x27, 0x52, 0xCA, 0x79, 0xB8, 0xA0,
-    0x5E, 0xDD, 0x14, 0x1D, 0xEA, 0x02, 0x60, 0x97, 0x30, 0xC9, 0x24, 0x56, 0x8B, 0x46, 0x7C, 0x52,
-    0xC7, 0x4C, 0x3F, 0x12, 0xD6, 0x2F, 0x46, 0xE9, 0xC8, 0xCF, 0x84, 0x6D, 0xD4, 0x6B, 0x3F, 0xFF,
-    0x3C, 0xE4, 0x39, 0xFB, 0xD9, 0xE5, 0x61, 0x5D, 0x96, 0xA8, 0xB5, 0x92, 0xAE, 0x51, 0x39, 0xD9,
-    0x4D, 0xCF, 0xEA, 0x2B, 0x50, 0xF4, 0x28, 0xD1, 0xA9, 0x25, 0x1A, 0x19, 0x23, 0xFA, 0x69, 0xBD,
-    0x4D, 0xD3, 0x27, 0xF6, 0xEB, 0x1B, 0x56, 0x91, 0xF1, 0x12, 0xCB, 0x00, 0xEB, 0x83, 0x4A, 0xD6,
-    0x1E, 0x96, 0x18, 0x9B, 0xD1, 0x01, 0xE8, 0x25, 0xA5, 0x16, 0x08, 0xBC, 0x75, 0xA6, 0x6C, 0x71,
-    0x5D, 0x52, 0x81, 0xCA, 0xC5, 0x43, 0x58, 0x21, 0x8E, 0x99, 0x2D, 0xBD, 0x61, 0x04, 0x35, 0xF1,
-    0xFE, 0x10, 0x9C, 0xE5, 0xC5, 0x67, 0xD8, 0x7D, 0x55, 0x01, 0xA2, 0xB8, 0x42, 0x61, 0x17, 0xEA,
-    0x3D, 0xE0, 0x38, 0xE5, 0xCD, 0xF8, 0x74, 0xC2, 0x0F, 0xD9, 0x17, 0x3A, 0x1A, 0x93, 0xB4, 0xF5,
-    0x0D, 0x96, 0x84, 0x37, 0x9B, 0x54, 0x66, 0xC3, 0xF4, 0xE3, 0x2B, 0x74, 0x17, 0xEA, 0x17, 0xA1,
-    0xAB, 0xA8, 0x65, 0xDE, 0x51, 0xBE, 0x57, 0xEF, 0xB4, 0xBB, 0x51, 0x1D, 0x9D, 0xFF, 0xB8, 0xDB,
-    0x10, 0x30, 0xD4, 0x43, 0x62, 0x4E, 0x1C, 0x98, 0x4A, 0x6B, 0x8A, 0xAC, 0x8D, 0x0F, 0x55, 0x05,
-    0x39, 0xB6, 0x5E, 0xD3, 0xE4, 0xF5, 0x3E, 0x15, 0x86, 0x42, 0x2C, 0x47, 0x17, 0x8B, 0x05, 0x3D,
-    0x54, 0xD6, 0x75, 0xD9, 0x54, 0x8D, 0xDD, 0x16, 0x6A, 0xDA, 0xD7, 0x3B, 0x6E, 0x8A, 0xFC, 0x70,
-    0xED, 0x02, 0x48, 0xFB, 0xAE, 0x13, 0x5A, 0xD1, 0xE4, 0x2E, 0x9A, 0x26, 0x03, 0xEA, 0x12, 0x8E,
-    0xB2, 0xEC, 0x86, 0xD6, 0x3A, 0x74, 0xEB, 0x9F, 0x51, 0x5B, 0x50, 0x6B, 0xFB, 0x90, 0x9E, 0x6A,
-    0xA7, 0xDE, 0xA5, 0x74, 0xAF, 0x3C, 0x29, 0x62, 0x68, 0x10, 0x74, 0xCD, 0x58, 0x67, 0xB1, 0x8E,
-    0x91, 0xD9, 0x12, 0xC1, 0xC3, 0x2A, 0x5C, 0x19, 0x88, 0xCF, 0x4F, 0xF3, 0x1E, 0x06, 0xD1, 0xC7,
-    0xB8, 0xE6, 0x1E, 0xA2, 0xC6, 0x3F, 0x8E, 0x42, 0x2D, 0x76, 0x64, 0xD4, 0x37, 0x4E, 0x64, 0xF2,
-    0xE6, 0x61, 0xC0, 0x1B, 0x59, 0x12, 0x19, 0xD4, 0x14, 0x2D, 0x27, 0x92, 0xFE, 0x55, 0xA6, 0xE9,
-    0x94, 0xD1, 0x9C, 0x33, 0xA6, 0xF4, 0x91, 0xED, 0x71, 0xB2, 0xCB, 0x63, 0x3C, 0x4C, 0xE3, 0x23,
-    0x31, 0x6E, 0x8A, 0x25, 0xA3, 0x51, 0xEE, 0x2C, 0x3F, 0x85, 0x47, 0x4F, 0xF1, 0x0E, 0x6B, 0x7D,
-    0x3B, 0xC3, 0xE1, 0xC7, 0xD4, 0xFB, 0xA6, 0x7A, 0xAF, 0xC3, 0xD2, 0xB6, 0xEB, 0x45, 0x28, 0x9C,
-    0x56, 0x75, 0xE1, 0x34, 0x80, 0xC4, 0xC6, 0xF5, 0x82, 0xED, 0x3A, 0x67, 0x74, 0x6D, 0xE9, 0xEF,
-    0x2C, 0x9C, 0x68, 0x8A, 0x45, 0x88, 0xA3, 0x3E, 0x18, 0x6F, 0x69, 0x80, 0x91, 0x73, 0xC1, 0x94,
-    0xD2, 0xC8, 0x99, 0xD3, 0xA1, 0x7E, 0x74, 0x26, 0x42, 0x6D, 0xA2, 0xCE, 0x23, 0xF8, 0xDA, 0xFF,
-    0x42, 0x60, 0x03, 0xEB, 0x0E, 0x57, 0xE0, 0x39, 0xC6, 0x60, 0x51, 0x17, 0xF8, 0x51, 0x42, 0xDE,
-    0x45, 0xAE, 0xD4, 0x78, 0x17, 0x25, 0xE0, 0x40, 0xBB, 0x97, 0xE5, 0x5B, 0xB4, 0x42, 0xF7, 0xE8,
-    0x01, 0x3A, 0xF7, 0x0E, 0x4D, 0xDA, 0x83, 0x7B, 0x62, 0xFF, 0x46, 0xF1, 0xA7, 0x4A, 0x43, 0x7D,
-    0x57, 0x7A, 0x82, 0x77, 0xF0, 0x57, 0x7C, 0xBD, 0xB7, 0xD3, 0x43, 0x83, 0x1C, 0x83, 0x14, 0xE3,
-    0xA2, 0x29, 0xD1, 0x9C, 0xAF, 0x9B, 0x7A, 0x45, 0x9B, 0xDA, 0x17, 0x84, 0x87, 0x96, 0x76, 0xD7,
-    0x09, 0x15, 0x72, 0x01, 0x2A, 0xD9, 0xEF, 0x64, 0x1E, 0xD9, 0x9B, 0x29, 0xB5, 0xDB, 0xC4, 0xE0,
-    0xD0, 0x6F, 0x93, 0xF9, 0x5E, 0x0A, 0x74, 0x19, 0x3A, 0xE7, 0xD4, 0x65, 0x06, 0x94, 0xA1, 0x8F,
-    0xE0, 0xCD, 0x7F, 0xBF, 0x70, 0x7C, 0x9B, 0xBC, 0x6A, 0xD5, 0xE1, 0x27, 0x26, 0xA4, 0x1B, 0x27,
-    0xEF, 0xD4, 0xF5, 0x16, 0x6E, 0xA7, 0xEC, 0xC8, 0x0E, 0xC7, 0x3F, 0xBF, 0xBC, 0x8C, 0xBA, 0x4E,
-    0x99, 0xAF, 0x8E, 0xD0, 0x6C, 0x27, 0xB1, 0xA2, 0x95, 0xCF, 0x4B, 0xD0, 0x4E, 0xBD, 0x70, 0xCD,
-    0xCC, 0x50, 0x64, 0x46, 0xCA, 0x2A, 0x6E, 0xC5, 0x94, 0xA9, 0x5F, 0x63, 0xAE, 0x51, 0xFD, 0xEF,
-    0x96, 0x2B, 0x77, 0xA2, 0x47, 0x47, 0x87, 0x4F, 0x75, 0xE9, 0x6A, 0x04, 0x61, 0xA3, 0xD0, 0x58,
-    0x29, 0x6E, 0x12, 0xB6, 0xC6, 0x98, 0xCD, 0xB2, 0x5C, 0x4D, 0x6A, 0xAE, 0xF6, 0x12, 0x9A, 0xDE,
-    0x5E, 0x2E, 0xE0, 0x88, 0x79, 0xFE, 0xCB, 0x20, 0x75, 0xDF, 0x52, 0xC7, 0x65, 0x7B, 0xA1, 0x63,
-    0x6D, 0x9E, 0x4F, 0x16, 0x66, 0xDA, 0xCE, 0x89, 0xF7, 0x92, 0xCC, 0xEF, 0x78, 0xD6, 0xD6, 0xFB,
-    0xE9, 0x2A, 0x42, 0xAB, 0x50, 0xFC, 0xAF, 0x25, 0x0A, 0xE1, 0xAA, 0x9F, 0x1C, 0x9B, 0x2D, 0x79,
-    0xDE, 0x67, 0xEA, 0xE9, 0x60, 0xC6, 0x39, 0xC0, 0xAF, 0x9F, 0xA3, 0xC2, 0x6A, 0x7C, 0x5B, 0xB7,
-    0x8B, 0xF5, 0x74, 0xEC, 0xAB, 0xB9, 0x59, 0xFF, 0x8F, 0x99, 0xB7, 0x91, 0x1D, 0xEA, 0x06, 0x6A,
-    0x41, 0xCE, 0xD3, 0x8D, 0x4F, 0x2E, 0x0C, 0xB8, 0xF0, 0xC3, 0x60, 0x1D, 0x91, 0xDC, 0xD5, 0xAC,
-    0x7B, 0x96, 0x7A, 0x5D, 0x30, 0x2A, 0x36, 0xEB, 0xD9, 0xF0, 0xDE, 0xBA, 0xAC, 0x77, 0x78, 0xAE,
-    0x71, 0xDC, 0x1C, 0x69, 0xD6, 0x79, 0xBD, 0x2F, 0xE4, 0xF6, 0xC8, 0x82, 0x9F, 0x26, 0xFD, 0x18,
-    0x42, 0x57, 0x89, 0xA1, 0xE9, 0x13, 0xEB, 0x34, 0xC4, 0x78, 0x53, 0xDE, 0x2A, 0x6A, 0x15, 0x81,
-    0xE6, 0x47, 0x22, 0x28, 0x7B, 0x0C, 0x4E, 0x5D, 0xD1, 0x21, 0x54, 0x29, 0x9E, 0x88, 0xCD, 0x72,
-    0x70, 0xFD, 0x6E, 0x52, 0xBA, 0xE5, 0x7A, 0xC9, 0xA6, 0xEB, 0x2C, 0xE2, 0x88, 0x4F, 0x01, 0x7E,
-    0x19, 0xD9, 0xEB, 0x92, 0xFF, 0x16, 0xA3, 0xDC, 0x46, 0x1E, 0x71, 0x85, 0xAF, 0x77, 0x7A, 0x03,
-    0xD8, 0xC9, 0x31, 0xE4, 0xC2, 0xB2, 0x40, 0x74, 0x92, 0xC0, 0x5F, 0x11, 0xD9, 0x65, 0x6D, 0x5F,
-    0x6C, 0x34, 0x95, 0xFE, 0xCF, 0x15, 0x35, 0xA0, 0x81, 0x94, 0x62, 0x23, 0xF8, 0x78, 0x57, 0xF3,
-    0x7A, 0xAB, 0x7F, 0x22, 0x01, 0x05, 0x4B, 0x14, 0x54, 0xD4, 0xF6, 0x45, 0xDB, 0x92, 0x6D, 0xCA,
-    0xDA, 0xD4, 0x1A, 0x38, 0x57, 0xDA, 0x86, 0x6C, 0xDB, 0xC9, 0xCC, 0x7C, 0xE4, 0xA3, 0x5E, 0x5B,
-    0x62, 0x91, 0x67, 0x06, 0xCE, 0x49, 0xBD, 0xD9, 0x1B, 0xB9, 0xA2, 0x4B, 0x5D, 0xB3, 0x30, 0x4B,
-    0x47, 0x7E, 0xF1, 0xE2, 0xFF, 0x1F, 0xC5, 0x5A, 0x3D, 0x90, 0xDD, 0xD6, 0x75, 0x3E, 0x00, 0xC8,
-    0x85, 0x24, 0x58, 0x0B, 0x16, 0x92, 0xE3, 0x88, 0xD6, 0xA2, 0x71, 0x91, 0x51, 0xB8, 0x84, 0x0A,
-    0x15, 0x9A, 0xCC, 0xBE, 0x05, 0x24, 0xCE, 0x44, 0xA5, 0x39, 0x13, 0xAE, 0x5C, 0xB8, 0xB0, 0x8B,
-    0x34, 0xB6, 0x32, 0xA1, 0x32, 0xC3, 0x42, 0x05, 0xC9, 0x07, 0x8A, 0x85, 0x8B, 0x34, 0x4C, 0xA1,
-    0x5E, 0x85, 0x92, 0xB1, 0xC8, 0x64, 0xC8, 0x42, 0x05, 0x27, 0xB3, 0x5C, 0x80, 0xDC, 0xC2, 0x85,
-    0x1B, 0x50, 0x1C, 0x4D, 0x8A, 0x14, 0x82, 0x45, 0x31, 0x8E, 0xA8, 0xC9, 0x10, 0x91, 0xE0, 0x08,
-    0xA4, 0x00, 0xDC, 0x7C, 0xDF, 0x01, 0xF0, 0xB8, 0x6F, 0x77, 0xA5, 0x11, 0x29, 0xFE, 0xBC, 0x05,
-    0x2E, 0xB0, 0xC0, 0x7B, 0xF7, 0x9E, 0x73, 0xEE, 0xB9, 0xE7, 0x7C, 0xE7, 0x9C, 0x2B, 0xC2, 0xCF,
-    0x73, 0x69, 0x2B, 0x12, 0x99, 0x4E, 0x76, 0xFF, 0x9C, 0x64, 0x93, 0xB2, 0x31, 0xB1, 0x88, 0x65,
-    0x32, 0x11, 0xE7, 0x8F, 0xB9, 0x88, 0x7B, 0xAD, 0x10, 0xF1, 0xAE, 0x94, 0x22, 0xFE, 0xA9, 0x4A,
-    0x24, 0x88, 0x1B, 0xF4, 0x22, 0xEB, 0x22, 0xAB, 0xFC, 0xC9, 0x25, 0xDC, 0x4B, 0x23, 0x61, 0x6C,
-    0xD5, 0xE2, 0x27, 0x8E, 0x31, 0x26, 0x63, 0x53, 0x78, 0x68, 0x4A, 0xFF, 0xC6, 0xDA, 0xCF, 0xAA,
-    0x20, 0x13, 0xA7, 0x0E, 0x33, 0xB1, 0x9B, 0x28, 0x11, 0xAB, 0xD5, 0x51, 0x4C, 0x19, 0x98, 0x9B,
-    0xE3, 0xC0, 0x0B, 0xED, 0x9B, 0xB6, 0x31, 0xF1, 0xC6, 0xCF, 0x2B, 0x3F, 0x0E, 0xDE, 0x2E, 0xA4,
-    0x5E, 0x11, 0x7F, 0x33, 0x93, 0xF5, 0xFE, 0xD2, 0xAC, 0xCA, 0x74, 0xD3, 0x98, 0x36, 0x30, 0x26,
-    0x4F, 0xCD, 0x09, 0x2B, 0x3D, 0x5D, 0xC8, 0x72, 0x7C, 0x40, 0xE4, 0xC7, 0x82, 0x66, 0x51, 0x3E,
-    0x00, 0x71, 0x06, 0x14, 0xDA, 0xA4, 0x5A, 0x9E, 0x91, 0xC7, 0xCB, 0xDD, 0x22, 0x28, 0x2A, 0xA5,
-    0x70, 0x3F, 0x5A, 0x97, 0x10, 0x03, 0x4D, 0x93, 0xAD, 0x34, 0x1C, 0xFD, 0x0F, 0x3C, 0xAC, 0xBC,
-    0x1B, 0x69, 0x5C, 0x59, 0xF5, 0x41, 0xF1, 0x4F, 0x83, 0xBB, 0x15, 0xF1, 0x36, 0xF5, 0xE2, 0x6F,
-    0x16, 0x6E, 0x13, 0x19, 0x73, 0x15, 0xBC, 0x7A, 0xE6, 0xAB, 0x7C, 0x7F, 0xBD, 0xFA, 0x28, 0xE7,
-    0xC4, 0x42, 0xD7, 0xE2, 0x72, 0xA4, 0xA7, 0x67, 0x8D, 0x57, 0xF2, 0xC5, 0xBB, 0xF7, 0x37, 0x47,
-    0x02, 0x32, 0x31, 0x41, 0xF6, 0x67, 0xE8, 0xB6, 0x50, 0xF6, 0x5D, 0x4E, 0x10, 0xBB, 0x5C, 0xC2,
-    0xE9, 0xE0, 0xB5, 0x1C, 0x97, 0x6F, 0xFD, 0x58, 0xE7, 0x6B, 0xF0, 0x0C, 0xA6, 0x8D, 0x69, 0x24,
-    0x42, 0x27, 0x3E, 0x78, 0xB5, 0x49, 0x6D, 0x84, 0xAE, 0x5C, 0x76, 0xB5, 0x81, 0xD3, 0x67, 0x57,
-    0xCD, 0x78, 0x43, 0xF5, 0xE6, 0xF7, 0x04, 0x4A, 0xB1, 0xC7, 0x37, 0x77, 0xDE, 0xC8, 0xA6, 0xF8,
-    0xB9, 0x0A, 0x21, 0xD0, 0x7E, 0xD8, 0xE1, 0xD4, 0x7C, 0xDA, 0x0F, 0x61, 0x43, 0x10, 0x89, 0x78,
-    0xB1, 0xF8, 0x22, 0x07, 0xE7, 0x47, 0x4F, 0x0B, 0x17, 0xD2, 0x2A, 0xF6, 0x85, 0x31, 0xC5, 0x89,
-    0xC9, 0x98, 0xE8, 0xB1, 0xAA, 0xA3, 0x87, 0x85, 0xF8, 0xA6, 0x72, 0xD1, 0xDF, 0xD1, 0xDB, 0xFA,
-    0xED, 0x97, 0x29, 0x2F, 0x8C, 0x6F, 0xDF, 0x02, 0x69, 0x1F, 0x2C, 0x8B, 0xFC, 0x85, 0x1C, 0x7B,
-    0x4C, 0x3C, 0x3D, 0x41, 0x5D, 0x10, 0x93, 0x38, 0x57, 0x8B, 0x45, 0xA5, 0xEB, 0xDE, 0xB9, 0x39,
-    0x41, 0x6E, 0x8A, 0x71, 0xE4, 0xF2, 0xDB, 0xA7, 0xE9, 0x39, 0x93, 0x48, 0x80, 0xDF, 0xFA, 0xD4,
-    0xB3, 0x6E, 0xD0, 0xD5, 0x10, 0x74, 0x3B, 0x24, 0x79, 0x3A, 0x76, 0x45, 0x1E, 0xFD, 0x6C, 0xBC,
-    0x29, 0x86, 0xEF, 0xF9, 0xF8, 0x41, 0x6C, 0xCC, 0xBF, 0xAC, 0xBB, 0xE4, 0x06, 0x8C, 0x34, 0xD6,
-    0xA0, 0xAF, 0x8D, 0xB8, 0xA6, 0x8B, 0xC7, 0x41, 0xA2, 0xFE, 0x98, 0x5F, 0x52, 0xF7, 0xC4, 0xD4,
-    0x8F, 0xE4, 0x27, 0x50, 0x3F, 0xE8, 0x9E, 0xFD, 0x79, 0x32, 0x10, 0xB0, 0xF2, 0xB8, 0xF5, 0xEF,
-    0x09, 0x79, 0xC2, 0x8D, 0x8F, 0x59, 0x5F, 0xE4, 0x32, 0x05, 0xC1, 0x22, 0x7B, 0xEE, 0x5B, 0xFF,
-    0xF8, 0x29, 0xA0, 0xCA, 0xB2, 0xC2, 0xD5, 0xE5, 0xD7, 0x5C, 0x62, 0xE5, 0xB8, 0xAE, 0xE7, 0x3F,
-    0xCF, 0xAE, 0x71, 0x5A, 0xCC, 0x6D, 0x36, 0x26, 0x67, 0x53, 0xC1, 0x6A, 0xEC, 0x6F, 0x69, 0x3A,
-    0x0C, 0x9B, 0x28, 0x43, 0x13, 0xE4, 0x27, 0x29, 0xA5, 0x93, 0x34, 0x03, 0x27, 0xC9, 0x2D, 0x9B,
-    0x6A, 0xAE, 0xF1, 0xD9, 0x84, 0xE5, 0x74, 0xED, 0xE7, 0xA6, 0x44, 0x2F, 0x26, 0x67, 0x43, 0x76,
-    0xBB, 0xBE, 0xD3, 0xA9, 0xF9, 0x4C, 0x07, 0x2C, 0xEF, 0x36, 0x2B, 0x5B, 0x1B, 0xAB, 0x3C, 0x2E,
-    0x4F, 0xBD, 0x82, 0x26, 0xFD, 0x53, 0xF9, 0x8C, 0x63, 0xBA, 0x12, 0x2B, 0x68, 0x5A, 0x62, 0x29,
-    0x42, 0xE3, 0x0E, 0xD2, 0xFA, 0x4C, 0xA8, 0x39, 0x13, 0xDA, 0x0F, 0xBD, 0x5B, 0xE5, 0xAC, 0x45,
-    0x67, 0xA6, 0x05, 0xD4, 0xCD, 0x94, 0xD4, 0xB7, 0x12, 0x66, 0x1F, 0x3F, 0x93, 0xA3, 0x7F, 0x18,
-    0x75, 0x74, 0xED, 0x08, 0x2D, 0x8D, 0x31, 0x67, 0x84, 0x5F, 0xAA, 0xA4, 0xA7, 0x04, 0x86, 0xF0,
-    0x68, 0xC5, 0x7E, 0xD0, 0x73, 0x90, 0xB0, 0x1B, 0x52, 0x9E, 0xE1, 0xB1, 0x44, 0x09, 0xCD, 0x53,
-    0xBA, 0x70, 0xFE, 0x66, 0x62, 0xD1, 0xFE, 0xC6, 0x6E, 0x05, 0x4B, 0x06, 0xF6, 0xF9, 0x78, 0x1A,
-    0xE3, 0xDB, 0xB6, 0x4A, 0x26, 0x2C, 0xAD, 0x76, 0xED, 0xA8, 0xC9, 0xA8, 0xA7, 0x2D, 0xFB, 0xC6,
-    0xE0, 0xCA, 0x2A, 0xF5, 0x35, 0xA7, 0xAE, 0x9E, 0x99, 0x31, 0xEB, 0x50, 0xE8, 0x3E, 0x75, 0x00,
-    0x13, 0xE4, 0xF0, 0x9B, 0x0B, 0xE7, 0x6E, 0x26, 0xF2, 0x5E, 0x80, 0x6E, 0xDA, 0xE3, 0xA2, 0xAC,
-    0x86, 0xAF, 0x40, 0x0F, 0x4A, 0x08, 0xDC, 0x4B, 0xEC, 0xA6, 0xE7, 0xAF, 0x02, 0x6D, 0xB0, 0x8B,
-    0x1B, 0x34, 0xDA, 0x75, 0xCF, 0xE8, 0xB4, 0x57, 0x3F, 0x43, 0x9F, 0xB9, 0xBE, 0x95, 0x4F, 0x7C,
-    0x9E, 0x3A, 0x6F, 0xF0, 0xBE, 0xD9, 0x36, 0xBB, 0xA0, 0xAF, 0x09, 0x61, 0xEC, 0xD3, 0xEE, 0xAC,
-    0x8D, 0x2F, 0x7B, 0x99, 0x2E, 0x1C, 0xEA, 0x27, 0xF5, 0x01, 0x32, 0x83, 0x06, 0x36, 0xE8, 0xB2,
-    0xE4, 0xEA, 0xF4, 0xB7, 0xBD, 0xFD, 0x68, 0xED, 0x30, 0x44, 0x50, 0x60, 0x40, 0x98, 0x73, 0xE3,
-    0x9B, 0xBE, 0xF7, 0x17, 0x4C, 0x8D, 0xDB, 0x64, 0xE7, 0x02, 0x09, 0x39, 0x13, 0xB9, 0x9B, 0x7B,
-    0x20, 0x1D, 0x7A, 0xE7, 0x5C, 0xB9, 0x63, 0x3A, 0xFC, 0xFE, 0xFA, 0x47, 0xAA, 0xA9, 0x4E, 0x41,
-    0xE9, 0x42, 0x08, 0xEF, 0xFC, 0x9D, 0xA7, 0xDA, 0xDF, 0xC8, 0x5F, 0xB6, 0x30, 0xB7, 0x4E, 0xE2,
-    0xC3, 0xBF, 0x04, 0xAF, 0x97, 0xEA, 0x22, 0x83, 0x62, 0x7B, 0xAF, 0xE0, 0xF9, 0x0A, 0x04, 0xEB,
-    0x99, 0x9B, 0xEF, 0x62, 0x49, 0xD0, 0xAB, 0x29, 0x6D, 0x03, 0xA9, 0xA4, 0x1C, 0xBD, 0x29, 0x23,
-    0xF1, 0x5D, 0xCA, 0x87, 0xB7, 0xED, 0xDA, 0x1A, 0xDE, 0x76, 0xA4, 0x1C, 0x84, 0x94, 0xD4, 0x47,
-    0x81, 0xBA, 0x1F, 0x93, 0x63, 0x4E, 0x1E, 0x60, 0x3C, 0x48, 0xB4, 0xDE, 0x1D, 0x25, 0xD8, 0x9C,
-    0xC9, 0x16, 0x96, 0xEF, 0x82, 0x1F, 0x3B, 0x97, 0x0B, 0x59, 0x09, 0xCF, 0x9B, 0xEB, 0xE8, 0x6A,
-    0x72, 0x58, 0x7D, 0x15, 0x96, 0x1D, 0xE6, 0x44, 0xFC, 0xDB, 0xAF, 0x67, 0xA9, 0xDA, 0xA8, 0xCC,
-    0x4E, 0xF3, 0x5E, 0x08, 0x31, 0x3D, 0x6E, 0xFF, 0xB6, 0x7C, 0xD8, 0xBC, 0x48, 0x3F, 0x59, 0xF8,
-    0x8A, 0xD5, 0xF4, 0x46, 0xF6, 0x81, 0x4C, 0xCA, 0xC3, 0x20, 0x95, 0x08, 0x65, 0xB0, 0xB1, 0xB4,
-    0xD9, 0x7F, 0x4E, 0x8D, 0x8D, 0x81, 0xD5, 0x12, 0xA7, 0x0A, 0xE4, 0xA2, 0xBC, 0x1C, 0x88, 0x7D,
-    0xE5, 0xBF, 0xCE, 0xB7, 0x24, 0xED, 0xC6, 0xE1, 0x91, 0xB4, 0x10, 0x70, 0x64, 0x20, 0x2D, 0x04,
-    0x69, 0x61, 0xA7, 0x9E, 0x75, 0x51, 0x1D, 0x35, 0xEF, 0x2C, 0x3C, 0xB0, 0xCE, 0x0C, 0x70, 0xE2,
-    0x80, 0xB8, 0x80, 0x50, 0x6E, 0xD3, 0x6B, 0xF9, 0x93, 0x3B, 0xCC, 0x37, 0xC8, 0x40, 0x47, 0x75,
-    0x68, 0xCE, 0x26, 0xE0, 0xC6, 0x2E, 0xE7, 0xF5, 0x7D, 0xE4, 0x06, 0xC3, 0xB4, 0xF3, 0xDC, 0xF0,
-    0xED, 0x9F, 0xD6, 0x8E, 0xE0, 0x6D, 0x3D, 0x70, 0xC3, 0xD5, 0x20, 0x16, 0xFE, 0x96, 0xAD, 0x5C,
-    0x2E, 0x7E, 0xA0, 0x4E, 0xC0, 0x03, 0x53, 0xFB, 0x1E, 0x98, 0x22, 0xA9, 0xE5, 0x0F, 0x64, 0x10,
-    0x96, 0xF5, 0x05, 0x64, 0xE1, 0x26, 0x6F, 0xA9, 0x87, 0x98, 0xF1, 0x73, 0x58, 0x64, 0x3F, 0xD6,
-    0xA1, 0x3A, 0x48, 0xB7, 0x8B, 0xAD, 0x44, 0xFD, 0x4C, 0x40, 0x25, 0x88, 0xA8, 0x1A, 0x9C, 0x57,
-    0x9D, 0x9D, 0xB9, 0xC6, 0xFA, 0x67, 0x36, 0xD0, 0x81, 0x58, 0x8E, 0x76, 0x84, 0x7B, 0x77, 0xF0,
-    0x65, 0xAB, 0x0C, 0x2B, 0x48, 0x24, 0x30, 0x67, 0xCF, 0x97, 0x0A, 0x0B, 0xE9, 0xA0, 0x2A, 0x18,
-    0x19, 0xAC, 0x90, 0x05, 0xBA, 0x06, 0x4C, 0x1D, 0xAD, 0xE3, 0xC9, 0x42, 0x96, 0xDC, 0xC4, 0x95,
-    0xA7, 0x46, 0x22, 0xBC, 0x6A, 0xE2, 0x98, 0x3F, 0x66, 0x5D, 0xDA, 0x04, 0x92, 0x6E, 0xE6, 0x0E,
-    0x90, 0x6B, 0xB0, 0x99, 0x59, 0xFD, 0xC5, 0x26, 0x10, 0xBC, 0x0C, 0x25, 0xF0, 0xD5, 0x97, 0xD7,
-    0x92, 0xFE, 0x14, 0xE3, 0x55, 0xA4, 0x22, 0x0F, 0x4A, 0xDF, 0x74, 0x64, 0x77, 0x3F, 0x86, 0x20,
-    0x2B, 0x42, 0x4B, 0x4D, 0xBC, 0x2C, 0x7E, 0xBC, 0xCC, 0xF9, 0x68, 0x38, 0x65, 0x5C, 0x41, 0x7B,
-    0xE3, 0x5D, 0x7C, 0xF1, 0x23, 0x64, 0xDE, 0xC5, 0xDF, 0x31, 0xB9, 0xE0, 0xDC, 0xF8, 0x7B, 0xAC,
-    0xA4, 0x6C, 0xE7, 0x2A, 0x7B, 0x80, 0x32, 0x98, 0x59, 0x90, 0x81, 0xE0, 0x64, 0x6C, 0x1E, 0x23,
-    0xFB, 0xA3, 0x75, 0x09, 0x18, 0x1F, 0x6C, 0x27, 0x24, 0x3D, 0x94, 0x47, 0xDD, 0x71, 0xFF, 0x73,
-    0x73, 0xB9, 0xF4, 0x9A, 0x89, 0x44, 0x33, 0xBE, 0x79, 0x09, 0x19, 0xC3, 0xC0, 0x35, 0x66, 0x3D,
-    0xE2, 0x49, 0xBC, 0xAA, 0x66, 0x70, 0x02, 0x20, 0xF8, 0xB4, 0x65, 0x60, 0x42, 0x0A, 0x98, 0x1B,
-    0x2B, 0xC5, 0x12, 0x7E, 0xF6, 0x91, 0xF3, 0xB4, 0xEB, 0xA7, 0x1F, 0x65, 0x7E, 0xA8, 0xA9, 0x46,
-    0x5B, 0xB2, 0x05, 0xC9, 0x99, 0xDE, 0xB0, 0xB7, 0x33, 0x89, 0xDC, 0x9D, 0xA0, 0x07, 0xAC, 0x09,
-    0x36, 0x59, 0xC7, 0x20, 0x62, 0x7D, 0x85, 0xE6, 0x79, 0xDA, 0xBC, 0xC4, 0xDA, 0xA2, 0x0D, 0x50,
-    0x14, 0x3F, 0x83, 0xAF, 0x89, 0xE8, 0xBB, 0x1B, 0xC0, 0x4D, 0xA7, 0x02, 0xCD, 0x7E, 0xCE, 0xB8,
-    0xFE, 0x10, 0x1E, 0xB5, 0x00, 0x36, 0x78, 0x04, 0x80, 0x93, 0x83, 0xF8, 0xE8, 0x34, 0xA4, 0x4F,
-    0x9B, 0xAC, 0x66, 0x4C, 0xBD, 0xBA, 0x39, 0x6D, 0x68, 0xA6, 0xEF, 0x9C, 0x3D, 0xDF, 0x80, 0xED,
-    0xA0, 0x04, 0x6B, 0xD3, 0xCD, 0x06, 0xCB, 0x0E, 0x0C, 0xBA, 0xCD, 0x94, 0x8F, 0x74, 0x20, 0x04,
-    0xD5, 0xD4, 0x00, 0xF7, 0x16, 0x82, 0x35, 0x80, 0x99, 0x97, 0x04, 0x41, 0xE0, 0x45, 0x3C, 0xAF,
-    0xB6, 0x9D, 0xE5, 0x78, 0xFE, 0x0A, 0x24, 0x9B, 0x1C, 0x0C, 0x55, 0x96, 0xB1, 0x6A, 0xFC, 0xF6,
-    0xB8, 0x0D, 0xEF, 0x03, 0x93, 0xCB, 0x73, 0xE2, 0xCC, 0x9F, 0x27, 0x41, 0xFE, 0x06, 0x4F, 0x98,
-    0x6D, 0xBB, 0x44, 0xD4, 0xE4, 0xF4, 0x8D, 0x32, 0xB4, 0xAD, 0x21, 0xA4, 0xEC, 0x52, 0x62, 0xAE,
-    0x00, 0x81, 0x6B, 0x4D, 0x06, 0x6B, 0xD0, 0x7F, 0xAE, 0x56, 0xBE, 0xE6, 0x9B, 0x46, 0xB9, 0xD8,
-    0xD6, 0x04, 0x6C, 0x94, 0xF8, 0xBA, 0x27, 0xFA, 0x0D, 0xD8, 0x18, 0xD3, 0xBD, 0xFB, 0x8D, 0xC4,
-    0xDB, 0xDF, 0x91, 0x78, 0x8A, 0x68, 0x71, 0xA5, 0xBC, 0x76, 0xFA, 0x7F, 0x5E, 0xF2, 0xE7, 0x56,
-    0x2C, 0xB8, 0xC7, 0x1C, 0x36, 0x5C, 0x46, 0x3B, 0x9B, 0x1C, 0x7A, 0xD4, 0x37, 0x05, 0x14, 0x2C,
-    0x28, 0xB0, 0x2E, 0x82, 0xD2, 0xA2, 0xBE, 0x39, 0xF5, 0x8F, 0xFF, 0xE1, 0x93, 0xDF, 0xBB, 0xF5,
-    0x2F, 0xF7, 0xCE, 0x3A, 0x82, 0xF1, 0x9D, 0x6F, 0x0E, 0xD2, 0x8B, 0x85, 0x74, 0x56, 0x91, 0x36,
-    0x50, 0xD8, 0x3D, 0xFB, 0x0D, 0x7C, 0xE8, 0x67, 0x3B, 0x80, 0xC7, 0x2C, 0x64, 0xFA, 0xA6, 0x23,
-    0xDE, 0x72, 0x24, 0x3C, 0xE0, 0x78, 0xA0, 0x01, 0xFD, 0x01, 0x5D, 0x33, 0x4D, 0x6A, 0x7E, 0x7B,
-    0xB7, 0x43, 0x04, 0x4F, 0x6F, 0xED, 0x38, 0x2E, 0x2A, 0x4E, 0x58, 0x57, 0x97, 0x39, 0x3B, 0xEC,
-    0x26, 0xB8, 0xBC, 0xDB, 0x71, 0xB5, 0x0D, 0x3F, 0xEC, 0xC2, 0x4F, 0xBA, 0x45, 0x27, 0x79, 0xD1,
-    0xF9, 0x6F, 0xCC, 0xBD, 0x97, 0xB5, 0xFE, 0xD5, 0x21, 0x1D, 0x05, 0x67, 0x37, 0x1E, 0x17, 0xBD,
-    0x6C, 0xDD, 0xCF, 0x1A, 0x3F, 0x6B, 0x9F, 0x1E, 0xBF, 0x19, 0x05, 0xBF, 0xFB, 0x62, 0x30, 0x45,
-    0x7B, 0x5F, 0x2B, 0x9B, 0xC8, 0xDF, 0x9C, 0x35, 0xD7, 0xAA, 0x36, 0xFA, 0xE9, 0xF5, 0xDB, 0xDD,
-    0xF4, 0xE3, 0xAF, 0x9A, 0x45, 0xF7, 0x54, 0xF1, 0xD6, 0x12, 0x9A, 0x8B, 0xA1, 0xA7, 0x2F, 0xF3,
-    0x5E, 0x14, 0x00, 0xF6, 0xBB, 0x9E, 0xF6, 0xF6, 0xB3, 0x8E, 0xE2, 0xAD, 0xA7, 0x53, 0x47, 0x09,
-    0xD7, 0x13, 0xD4, 0x90, 0x67, 0x36, 0x3B, 0x4B, 0x4D, 0x8E, 0x3C, 0xC9, 0x60, 0x05, 0xD8, 0xDF,
-    0x87, 0x93, 0xF0, 0x8D, 0x46, 0x5D, 0x44, 0x4E, 0xB4, 0x14, 0xFE, 0x26, 0xD7, 0x39, 0xB0, 0x2D,
-    0x97, 0x11, 0xCC, 0xC4, 0xFC, 0xE4, 0x2C, 0x11, 0xC4, 0x40, 0x7C, 0x1E, 0xE0, 0x81, 0x1C, 0x74,
-    0xA1, 0x3D, 0x17, 0x19, 0x97, 0x16, 0x7C, 0x74, 0x0A, 0x8F, 0x96, 0x89, 0x2D, 0xAA, 0x90, 0x59,
-    0x12, 0xC8, 0xD6, 0x3F, 0x84, 0xE1, 0x26, 0x04, 0x27, 0x65, 0xC4, 0xD8, 0xA2, 0xED, 0x63, 0x0B,
-    0x45, 0x56, 0x56, 0x39, 0x44, 0xD5, 0x3F, 0xD4, 0xC0, 0x1B, 0xFF, 0xB9, 0x63, 0x7E, 0xEF, 0x09,
-    0xC5, 0x1A, 0x69, 0x6C, 0x7F, 0x98, 0xFB, 0x72, 0x6C, 0x8F, 0x5B, 0x31, 0x62, 0xF5, 0x76, 0x1E,
-    0x05, 0x0F, 0x7F, 0x76, 0xE4, 0xF3, 0x47, 0x36, 0x1C, 0x61, 0xB6, 0x2F, 0x85, 0x11, 0x8B, 0x23,
-    0x20, 0xA6, 0x56, 0xA2, 0x52, 0xA8, 0xA5, 0x36, 0x82, 0x23, 0x04, 0x57, 0x80, 0x46, 0x45, 0x69,
-    0x67, 0xEE, 0xC8, 0x9E, 0x1F, 0x6B, 0x04, 0x54, 0x2A, 0x89, 0xBE, 0x8C, 0xFF, 0x1C, 0x57, 0x80,
-    0xE3, 0x66, 0x4A, 0xF4, 0x5B, 0x2A, 0x05, 0xF0, 0x69, 0x17, 0x5C, 0x95, 0x16, 0x43, 0x2A, 0x0A,
-    0xD1, 0x3A, 0xC2, 0x7C, 0x91, 0x57, 0xDA, 0x15, 0xA8, 0xBD, 0x04, 0xA4, 0x14, 0xBE, 0xCA, 0xA5,
-    0x83, 0xB8, 0x81, 0xC6, 0xAA, 0xA1, 0x5A, 0xD3, 0xBE, 0xDD, 0x02, 0xEE, 0x83, 0xE4, 0x15, 0x2F,
-    0x10, 0xD1, 0x33, 0x92, 0xF0, 0x60, 0xF0, 0xED, 0x3B, 0xB8, 0xE9, 0xA2, 0x0A, 0xC6, 0xCF, 0xC4,
-    0x7E, 0x31, 0xAD, 0x9C, 0xCA, 0x33, 0x71, 0x2B, 0x06, 0x86, 0xD2, 0xD7, 0x0C, 0xA1, 0x8E, 0xA0,
-    0x0B, 0x8E, 0x40, 0x8B, 0xBE, 0x9D, 0x69, 0x2E, 0xA7, 0x19, 0x0C, 0xFE, 0x34, 0x56, 0xFA, 0x69,
-    0x28, 0x82, 0x5E, 0xBC, 0x77, 0x2F, 0x76, 0xB9, 0x2A, 0xA1, 0x9F, 0xD9, 0x5F, 0x62, 0x0D, 0x5E,
-    0x42, 0xE4, 0x99, 0x50, 0x0E, 0x0E, 0x26, 0x1F, 0x42, 0x71, 0xBE, 0x44, 0x68, 0x1F, 0x94, 0x4E,
-    0x09, 0x29, 0xD9, 0x06, 0xB6, 0x6C, 0xBB, 0xE7, 0xC4, 0x88, 0x54, 0x87, 0x39, 0x2F, 0x82, 0x39,
-    0x11, 0xCB, 0x8A, 0x7D, 0x37, 0xF3, 0xFD, 0xD8, 0x3F, 0x28, 0x8B, 0x2B, 0xB2, 0x54, 0xD1, 0x06,
-    0xC3, 0x07, 0x02, 0xC6, 0x87, 0xB5, 0x2C, 0x6F, 0xC8, 0x24, 0x4A, 0x26, 0x7E, 0x31, 0x71, 0x6B,
-    0xBA, 0x83, 0x95, 0x1E, 0x77, 0x82, 0x9E, 0x70, 0xAE, 0x77, 0x40, 0x26, 0xC2, 0x35, 0x44, 0xAB,
-    0x5B, 0x2E, 0x00, 0xD3, 0x76, 0xAD, 0x5E, 0x03, 0xB3, 0xC4, 0x8B, 0xA3, 0xCE, 0x67, 0xEE, 0xA2,
-    0xC8, 0xD7, 0x82, 0x7F, 0xF8, 0x12, 0x06, 0x74, 0xB8, 0x48, 0xE9, 0x26, 0xCB, 0x52, 0x7A, 0xA3,
-    0x55, 0x3B, 0x6E, 0x95, 0x5E, 0x16, 0x4A, 0xED, 0x14, 0x7E, 0x32, 0x91, 0xCA, 0xC9, 0xFD, 0xF8,
-    0x84, 0x55, 0xB9, 0x79, 0xA0, 0x17, 0x13, 0xB4, 0x9C, 0x81, 0x07, 0x39, 0xFE, 0x8E, 0x80, 0x86,
-    0x78, 0x1B, 0x0E, 0x8B, 0xB3, 0x84, 0x1F, 0x32, 0xF3, 0x62, 0xBE, 0x3B, 0x61, 0x74, 0xDF, 0xD3,
-    0xCB, 0xAD, 0x5B, 0x86, 0x59, 0xE7, 0xF6, 0x2B, 0x71, 0x07, 0xAD, 0x87, 0xC3, 0xC4, 0x07, 0xAD,
-    0x65, 0x18, 0xFB, 0x76, 0x05, 0x30, 0x11, 0x07, 0xDF, 0x99, 0xD6, 0x58, 0x96, 0x03, 0xFB, 0x6A,
-    0x39, 0x09, 0x9D, 0x0F, 0xCB, 0x95, 0x55, 0x46, 0x31, 0xAB, 0x04, 0xFA, 0x93, 0xBE, 0x71, 0x73,
-    0x44, 0x02, 0x5B, 0x1A, 0x84, 0xEC, 0xA0, 0x2C, 0xD9, 0x65, 0xBE, 0xAC, 0x3A, 0x4C, 0xC2, 0xB7,
-    0xE1, 0x7E, 0xC2, 0x38, 0xBA, 0x72, 0xAF, 0xF2, 0x3A, 0x4E, 0x1D, 0x85, 0xA1, 0x0C, 0xE9, 0xE6,
-    0x9C, 0x22, 0xF2, 0x93, 0x66, 0xE2, 0x96, 0x55, 0x78, 0x2D, 0xA7, 0x36, 0x9F, 0x20, 0xEC, 0xC0,
-    0xF8, 0xC1, 0x78, 0x0B, 0xA7, 0xD3, 0xCA, 0x20, 0x1C, 0xE9, 0xFD, 0x4D, 0x9F, 0x0B, 0x53, 0xF1,
-    0xA8, 0x51, 0xE9, 0x93, 0x18, 0xAA, 0x6D, 0x56, 0x1D, 0xA8, 0xCC, 0x26, 0xDA, 0xAE, 0x6B, 0xCB,
-    0x2F, 0x5A, 0x5F, 0x33, 0x76, 0xB7, 0x35, 0x2C, 0xED, 0xD3, 0xEF, 0xB6, 0x4E, 0x8B, 0xA6, 0xC8,
-    0x74, 0xEA, 0x87, 0x1C, 0xE0, 0xD0, 0xF6, 0x66, 0x30, 0xD0, 0x36, 0xD2, 0x36, 0xD5, 0x91, 0xBE,
-    0x06, 0x47, 0x58, 0x40, 0xE4, 0xC4, 0xBD, 0xC6, 0xD6, 0xD7, 0x78, 0x2B, 0x24, 0x86, 0xEB, 0x53,
-    0xE0, 0x9A, 0x5E, 0x53, 0x2D, 0x1A, 0xD2, 0x5A, 0x7D, 0xAE, 0x8D, 0x0C, 0xF5, 0xAE, 0x69, 0xF6,
-    0x09, 0x86, 0x33, 0x1C, 0xCE, 0xD5, 0x2D, 0x27, 0xE9, 0x9F, 0x20, 0x0E, 0x5D, 0xAD, 0x75, 0xF1,
-    0x93, 0xCC, 0xB0, 0x01, 0x9D, 0x27, 0x60, 0x06, 0x4E, 0x0C, 0x59, 0x4F, 0x9E, 0x53, 0x1A, 0x95,
-    0xAA, 0x37, 0x2C, 0x4C, 0xA9, 0xC9, 0xF2, 0x98, 0xD8, 0xD1, 0x25, 0x31, 0xD9, 0x2D, 0x55, 0x78,
-    0xF8, 0x39, 0x58, 0xA5, 0x2C, 0x85, 0x2F, 0x75, 0x68, 0xA7, 0xFC, 0x16, 0x5A, 0x1A, 0x11, 0x08,
-    0x30, 0x4D, 0xE4, 0x98, 0xC2, 0x6E, 0xFC, 0x8F, 0x33, 0xAF, 0x98, 0x46, 0x49, 0x78, 0x0A, 0x56,
-    0xAC, 0x73, 0xCB, 0xCE, 0xA9, 0xC3, 0xCB, 0x8D, 0x5F, 0xA4, 0xF0, 0x32, 0xAF, 0x36, 0x6E, 0xD9,
-    0xFA, 0x25, 0x9C, 0x59, 0x94, 0x05, 0x1F, 0xE7, 0x30, 0xB3, 0xE9, 0xA1, 0x56, 0xD2, 0x06, 0xF0,
-    0xD3, 0x94, 0x51, 0x0E, 0x11, 0x9B, 0x98, 0xFD, 0x02, 0x89, 0x69, 0x50, 0x5D, 0x2A, 0x4D, 0xCE,
-    0xCE, 0xDC, 0x9E, 0x2C, 0x12, 0x52, 0x98, 0x3C, 0xA8, 0xA6, 0xF0, 0x3C, 0x75, 0x18, 0x7B, 0x6F,
-    0x97, 0xB2, 0x1E, 0x6A, 0xAD, 0x60, 0x1D, 0x26, 0x10, 0x6E, 0xA9, 0xC1, 0xE5, 0x5A, 0x25, 0xED,
-    0x70, 0xE9, 0x53, 0x82, 0xF1, 0x48, 0x7C, 0x47, 0xE2, 0x1B, 0x12, 0x5F, 0x7F, 0x23, 0xF1, 0x1B,
-    0x5B, 0x89, 0xAF, 0x7A, 0xE2, 0xBD, 0x9E, 0xF8, 0xF0, 0xDB, 0x88, 0xD7, 0xFC, 0x9C, 0x0C, 0xC6,
-    0x56, 0x13, 0xB0, 0xB4, 0xB6, 0xEA, 0x21, 0x35, 0x73, 0x12, 0xC5, 0xDF, 0x87, 0x09, 0xDA, 0x75,
-    0xD8, 0x08, 0xB7, 0xD6, 0x6E, 0x69, 0x23, 0xBA, 0x21, 0x98, 0x18, 0x3F, 0x2F, 0x23, 0x78, 0x97,
-    0x15, 0x4E, 0x66, 0x94, 0x0F, 0x2A, 0x21, 0xBF, 0xDC, 0x91, 0x1D, 0x7D, 0x04, 0xA2, 0xB0, 0x62,
-    0x2B, 0x5E, 0x94, 0x0B, 0x32, 0x39, 0xAE, 0x86, 0x8C, 0xF3, 0xF8, 0xCC, 0xF7, 0x9F, 0x47, 0xAC,
-    0x63, 0xAC, 0x71, 0xDA, 0x93, 0x69, 0xEF, 0x64, 0xE2, 0xDD, 0xA3, 0x9E, 0xC5, 0xFD, 0x9F, 0x32,
-    0x16, 0xF3, 0xAB, 0x90, 0x5D, 0x07, 0x89, 0x77, 0xB9, 0x92, 0xF5, 0x20, 0xF6, 0x60, 0x74, 0x2E,
-    0x61, 0xA0, 0x0F, 0x71, 0x89, 0x12, 0xEF, 0x5A, 0x2D, 0x1B, 0xB8, 0x5C, 0xAF, 0x35, 0xC7, 0xFD,
-    0xA8, 0x54, 0x24, 0xA8, 0x19, 0x13, 0x42, 0x1E, 0x4C, 0x90, 0x2F, 0x9C, 0xB9, 0x77, 0x39, 0x74,
-    0x6A, 0x1A, 0xB0, 0xB4, 0xD5, 0x2F, 0x7F, 0xBA, 0x25, 0x5B, 0xCA, 0xB8, 0x73, 0xB7, 0xEA, 0xE7,
-    0x02, 0x87, 0x42, 0x98, 0x01, 0xE3, 0xF5, 0x8E, 0xC9, 0x11, 0x2B, 0x20, 0x36, 0x43, 0xCC, 0x50,
-    0x07, 0x43, 0x79, 0x0C, 0x3D, 0x33, 0xD1, 0xCF, 0xE6, 0x24, 0x9B, 0x29, 0x2D, 0x52, 0xC4, 0xBB,
-    0xD5, 0xFE, 0x19, 0xC4, 0xDC, 0x45, 0x1C, 0x33, 0xE8, 0xD6, 0x8E, 0x36, 0x1A, 0x8D, 0x30, 0x49,
-    0x5C, 0xDA, 0x9A, 0x18, 0x46, 0xEC, 0x12, 0xF7, 0x63, 0xA8, 0x92, 0x9E, 0x35, 0x31, 0xDE, 0xEF,
-    0xDD, 0x49, 0x45, 0xC7, 0x54, 0xB6, 0x74, 0x7F, 0x5D, 0x05, 0xE2, 0x6E, 0x16, 0x32, 0x81, 0xFF,
-    0xB8, 0x0E, 0x14, 0x30, 0x11, 0xFB, 0x4B, 0x78, 0x94, 0x28, 0xF6, 0xAE, 0x9A, 0x5B, 0xEC, 0x3C,
-    0x0E, 0x99, 0xB3, 0xC7, 0xE2, 0x79, 0x1E, 0x7F, 0xB2, 0xC8, 0x1A, 0x9B, 0xFF, 0xCE, 0x45, 0xE6,
-    0x4F, 0xB8, 0x84, 0xD2, 0xF8, 0xF1, 0xF2, 0xE7, 0x1E, 0x76, 0xE5, 0x4D, 0xB9, 0xE0, 0x64, 0x4B,
-    0x80, 0x64, 0x99, 0xD2, 0xB9, 0x5B, 0x8E, 0xEC, 0xDE, 0xB9, 0xB5, 0xCF, 0xC8, 0x73, 0xF4, 0xAD,
-    0x21, 0xB3, 0xF8, 0x11, 0x21, 0xEB, 0xC9, 0x9D, 0xDD, 0xEE, 0x67, 0xDA, 0x7F, 0xAA, 0xD9, 0xF2,
-    0x1B, 0x30, 0xE0, 0xD3, 0x0C, 0x38, 0x8F, 0x71, 0x6E, 0xA1, 0xBC, 0xD2, 0xE2, 0x44, 0xC4, 0xD2,
-    0x5E, 0xC1, 0x54, 0x53, 0xAD, 0xCC, 0x06, 0xAC, 0x05, 0x6D, 0x12, 0x01, 0x0E, 0x0F, 0xC9, 0x2D,
-    0xA3, 0xFE, 0xF4, 0x15, 0x73, 0xE3, 0x75, 0xAD, 0x48, 0x99, 0x42, 0xD9, 0x25, 0xA7, 0x15, 0x40,
-    0x26, 0x8B, 0x0A, 0x3A, 0xD0, 0x16, 0xEB, 0x0F, 0xC4, 0x16, 0x87, 0xA2, 0x98, 0x35, 0x8A, 0x9F,
-    0xD9, 0x92, 0xDA, 0xD9, 0xE9, 0x28, 0x52, 0xA2, 0x4E, 0x04, 0xFD, 0xCE, 0xED, 0xFD, 0x70, 0xC8,
-    0x84, 0xC3, 0x35, 0x5C, 0x34, 0xB0, 0xC2, 0x2A, 0x3D, 0xF5, 0x3A, 0xBC, 0x0B, 0x42, 0x3C, 0xAD,
-    0xDB, 0x62, 0x1D, 0xC2, 0x53, 0xA7, 0x5A, 0xE8, 0xE8, 0xD1, 0x6D, 0x0F, 0xEE, 0x17, 0xCC, 0x1F,
-    0xCE, 0x9E, 0xEB, 0xB4, 0x04, 0x61, 0x4C, 0x12, 0xDE, 0xFE, 0x05, 0xE7, 0x21, 0xC4, 0x32, 0xCC,
-    0xD5, 0xAA, 0x32, 0xBB, 0xE8, 0xF5, 0x08, 0x89, 0xB7, 0x34, 0x75, 0x4D, 0x5F, 0x11, 0x8A, 0x86,
-    0xAC, 0x67, 0xD6, 0xA7, 0x73, 0x29, 0x0E, 0xD3, 0xE8, 0xCB, 0xA6, 0x7F, 0xD9, 0xF5, 0x66, 0x19,
-    0xA3, 0x39, 0x6D, 0xFF, 0xCB, 0xE9, 0xED, 0xB5, 0xB4, 0x2F, 0x1B, 0x98, 0x76, 0xED, 0x88, 0x65,
-    0x86, 0x31, 0xF5, 0x52, 0xF6, 0xFF, 0x36, 0x20, 0xE8, 0xF3, 0x11, 0xB5, 0xFD, 0x0A, 0xB2, 0xB9,
-    0x6D, 0x83, 0xD4, 0xD0, 0x7C, 0x52, 0x79, 0x71, 0xF4, 0x4F, 0xF8, 0xF5, 0x85, 0x80, 0xD6, 0x78,
-    0x09, 0x41, 0x72, 0xFB, 0x86, 0xD9, 0xC4, 0x2C, 0xE3, 0xA7, 0x10, 0xE4, 0x47, 0x31, 0x31, 0x12,
-    0x3B, 0x4F, 0x34, 0xE3, 0x5A, 0x69, 0xDC, 0x39, 0xFD, 0xDA, 0x98, 0x77, 0xDE, 0xC2, 0x78, 0x29,
-    0xF4, 0x23, 0x35, 0xBF, 0xC1, 0x68, 0x60, 0x7A, 0x3F, 0x0B, 0x81, 0xA5, 0x46, 0xC4, 0x9A, 0x44,
-    0x85, 0xD4, 0xC4, 0xBB, 0x1B, 0x74, 0xEF, 0x3D, 0x42, 0x12, 0x6B, 0xAD, 0x6E, 0xF8, 0xB0, 0x49,
-    0x3E, 0xBE, 0x10, 0x08, 0x33, 0xFE, 0x4E, 0x81, 0xC1, 0x71, 0x06, 0x79, 0x78, 0x96, 0x29, 0xE5,
-    0x0E, 0xA3, 0xB7, 0xA4, 0x20, 0x86, 0x21, 0xCA, 0x60, 0xDF, 0x8A, 0x28, 0x83, 0x21, 0xEB, 0x4F,
-    0x18, 0x27, 0xB7, 0xC6, 0xD9, 0x0C, 0x67, 0x0B, 0x50, 0xE4, 0xC6, 0x18, 0x77, 0xA9, 0x2F, 0x57,
-    0xD3, 0xF1, 0xFE, 0x9B, 0x9F, 0xE6, 0xA6, 0xC3, 0x02, 0x9A, 0x45, 0xF5, 0x1A, 0xEE, 0x03, 0xD0,
-    0x87, 0x19, 0xFC, 0x1A, 0x64, 0xF6, 0xD0, 0x88, 0xD9, 0xFE, 0xD9, 0x7B, 0x58, 0xB1, 0xB1, 0xC6,
-    0x30, 0x4C, 0x62, 0xE9, 0x99, 0xF4, 0x4E, 0x35, 0x85, 0x9C, 0xAE, 0x7C, 0x00, 0x5A, 0x23, 0x93,
-    0x18, 0x4A, 0x19, 0xC4, 0xEA, 0xA6, 0x00, 0xCC, 0x04, 0x16, 0x43, 0xCA, 0x08, 0x04, 0x4C, 0x44,
-    0x3B, 0x0B, 0x08, 0xD0, 0x7D, 0x74, 0xD4, 0x71, 0x3E, 0xF0, 0x45, 0xA3, 0x3A, 0xA4, 0xB0, 0x2B,
-    0x79, 0x0A, 0xF0, 0x10, 0x61, 0x9B, 0x16, 0x42, 0xB9, 0x11, 0x21, 0x7E, 0xE8, 0xF2, 0x7F, 0x49,
-    0xDE, 0x7D, 0x79, 0x49, 0x56, 0xB9, 0xE0, 0x61, 0x55, 0xC6, 0x19, 0x70, 0x6E, 0x55, 0xBE, 0xC1,
-    0xEF, 0xC0, 0xCD, 0xC8, 0x98, 0xA5, 0x8C, 0x85, 0x64, 0x0C, 0x93, 0xA0, 0x69, 0x44, 0x4F, 0x5D,
-    0x9D, 0x8C, 0xE8, 0x4D, 0xE1, 0xED, 0xC5, 0x6F, 0xAB, 0xF6, 0x6A, 0x9A, 0x50, 0x1D, 0x04, 0xAB,
-    0x7A, 0xB6, 0x39, 0xB3, 0xA7, 0xE7, 0x5D, 0xF1, 0xE6, 0x96, 0x46, 0x6B, 0xD2, 0x5A, 0x99, 0xD6,
-    0xE2, 0x9B, 0xAB, 0x95, 0xB1, 0x3F, 0x53, 0xEB, 0x1B, 0xF1, 0xFB, 0x01, 0xF1, 0x4C, 0xD0, 0x5A,
-    0x70, 0x95, 0xAD, 0x63, 0xFA, 0xF4, 0x9F, 0xA9, 0xB8, 0x64, 0x0A, 0x1A, 0x93, 0x78, 0xC1, 0x98,
-    0x77, 0x47, 0x63, 0x90, 0x8F, 0x81, 0xF1, 0xF2, 0x10, 0xD3, 0x6F, 0x0D, 0x7B, 0x3A, 0x50, 0x93,
-    0x4D, 0xFA, 0x08, 0x3A, 0x57, 0xD3, 0xEE, 0x63, 0xA8, 0xA3, 0x7D, 0x04, 0xE9, 0x54, 0xC1, 0x59,
-    0xEE, 0xB7, 0x60, 0x61, 0xEE, 0x28, 0x89, 0xD9, 0x37, 0x32, 0xA8, 0xE8, 0xDB, 0xFB, 0x47, 0x3C,
-    0x62, 0xB1, 0x02, 0xCF, 0xF7, 0x3D, 0x66, 0x2E, 0x9F, 0xD4, 0xF5, 0x0A, 0xC7, 0xE3, 0x9E, 0xCE,
-    0x58, 0xB4, 0x19, 0x72, 0x9D, 0xA6, 0x70, 0x4C, 0xE3, 0xF4, 0x12, 0x98, 0xF4, 0xC1, 0x01, 0x54,
-    0x68, 0x81, 0x51, 0x3D, 0xCD, 0xD1, 0x2B, 0x77, 0xCE, 0x5F, 0xD5, 0xE2, 0x4B, 0xAD, 0xCE, 0xE5,
-    0x11, 0xD2, 0x4D, 0x57, 0xF6, 0x22, 0x49, 0xFC, 0x2B, 0x99, 0x15, 0xD0, 0xD9, 0xFC, 0x30, 0x1B,
-    0xD2, 0xC3, 0x69, 0x0D, 0x22, 0x18, 0x2A, 0xAD, 0x68, 0xAE, 0x40, 0x83, 0xD3, 0x0E, 0x96, 0xBD,
-    0xD2, 0xD7, 0x7E, 0x7E, 0xF2, 0x5C, 0x35, 0x65, 0x21, 0xAC, 0x63, 0x1D, 0x48, 0xCE, 0x68, 0x6F,
-    0x8B, 0x60, 0xF4, 0x07, 0xBA, 0xC3, 0x06, 0xCB, 0x73, 0xE6, 0xFE, 0x0F, 0x68, 0x95, 0xEC, 0xB5,
-    0x44, 0xAB, 0x46, 0x7D, 0xD1, 0x6D, 0x3E, 0x9C, 0x79, 0xBC, 0x53, 0xB7, 0x17, 0x7F, 0x85, 0x27,
-    0x7E, 0xD0, 0x27, 0xC1, 0x21, 0x8C, 0xF8, 0x7E, 0x15, 0x94, 0x79, 0xDC, 0xFF, 0xA5, 0xBB, 0xF8,
-    0x9D, 0x39, 0x7F, 0xD3, 0xF4, 0x75, 0x36, 0x8D, 0xEA, 0x9C, 0x31, 0x83, 0xB5, 0xED, 0x51, 0x30,
-    0x4A, 0x5B, 0xE3, 0x03, 0x77, 0xF6, 0x28, 0x9D, 0xA9, 0x38, 0x57, 0xB9, 0xD6, 0x66, 0x08, 0x7A,
-    0xFA, 0x98, 0x93, 0x68, 0xDE, 0x7A, 0x9F, 0x77, 0x3F, 0x20, 0xF9, 0xC5, 0xB0, 0x43, 0x43, 0x25,
-    0x3D, 0x4B, 0x53, 0x3E, 0xD7, 0xBD, 0x47, 0xBF, 0x57, 0xCB, 0xEC, 0xB0, 0xFA, 0x43, 0xF7, 0x09,
-    0x58, 0xED, 0x61, 0xCB, 0xD4, 0xB6, 0xA9, 0x2D, 0x7C, 0xC7, 0x3B, 0xC3, 0x8D, 0x3C, 0x38, 0xE0,
-    0x50, 0x11, 0xB2, 0xBF, 0x04, 0xCC, 0x2E, 0x2B, 0x0C, 0x2F, 0x57, 0xCB, 0x91, 0xE0, 0x63, 0xBB,
-    0x94, 0x7C, 0x1F, 0x01, 0xA7, 0xBE, 0x1E, 0x81, 0x1C, 0x08, 0x64, 0xFD, 0xA0, 0x34, 0x7B, 0xEE,
-    0x89, 0xAF, 0x7B, 0x20, 0xD1, 0x3E, 0x77, 0xE7, 0x8C, 0xEE, 0xEC, 0xE1, 0xC6, 0x95, 0x7B, 0x23,
-    0x51, 0x6D, 0x70, 0x38, 0xE4, 0x9B, 0x17, 0xD2, 0xF7, 0xE9, 0x1D, 0x56, 0x19, 0x76, 0xBD, 0x90,
-    0xBE, 0x1F, 0x69, 0xF2, 0x82, 0x18, 0xEE, 0x84, 0xEE, 0x72, 0x9B, 0x1E, 0x91, 0x29, 0xFC, 0x3D,
-    0x37, 0x8E, 0x0C, 0x39, 0xF4, 0xA7, 0x11, 0xAF, 0x5D, 0xC8, 0xC5, 0x39, 0x84, 0x11, 0x7F, 0xB2,
-    0x77, 0x67, 0x90, 0xF6, 0xEC, 0xDF, 0x20, 0x74, 0x67, 0xFD, 0x27, 0x44, 0xA4, 0x62, 0xB7, 0xC3,
-    0x8D, 0xC5, 0x9B, 0x60, 0x76, 0x83, 0xF0, 0xC0, 0x42, 0x7C, 0xB0, 0xE3, 0x06, 0xAF, 0xAE, 0xE0,
-    0xE7, 0x0D, 0xDC, 0xE7, 0xF4, 0xB2, 0xB9, 0x99, 0x6A, 0xF9, 0x20, 0x26, 0xA6, 0x71, 0xB9, 0xBB,
-    0xC3, 0xDB, 0xB2, 0xF1, 0x48, 0xA2, 0x53, 0x99, 0xBB, 0x74, 0x40, 0x2E, 0x4C, 0xE3, 0x05, 0xD9,
-    0x8A, 0xEB, 0x26, 0xE2, 0x9F, 0xCE, 0xA5, 0xEE, 0x2F, 0xCD, 0x2A, 0x37, 0xF0, 0xE9, 0x05, 0x91,
-    0x49, 0x13, 0xE2, 0x52, 0x39, 0x63, 0x29, 0xCC, 0x37, 0x5F, 0x67, 0x51, 0xBB, 0xDE, 0x57, 0xBD,
-    0x60, 0x8E, 0x3D, 0xE2, 0x39, 0xD3, 0xBD, 0xB7, 0x73, 0x89, 0x3B, 0x23, 0x4F, 0xD7, 0x1F, 0x00,
-    0x4F, 0xC1, 0x37, 0xF3, 0x94, 0x9A, 0x32, 0xBC, 0xBB, 0x01, 0xF3, 0xBE, 0x99, 0xB9, 0x80, 0x3F,
-    0x37, 0x86, 0x1E, 0xAE, 0xFE, 0x8C, 0xB9, 0xD8, 0xFA, 0xEE, 0xCC, 0xCF, 0x63, 0x5E, 0xC0, 0x83,
-    0x23, 0xF0, 0xD7, 0xCA, 0xD5, 0xDC, 0x94, 0x05, 0x73, 0xEC, 0xED, 0xC6, 0x15, 0x6F, 0xF8, 0x0A,
-    0xBE, 0x3D, 0xBC, 0xD2, 0xB1, 0x9E, 0xD3, 0x9D, 0x33, 0xA7, 0x68, 0xB0, 0x38, 0x65, 0xFD, 0x0E,
-    0xA6, 0x74, 0x88, 0x3E, 0x9E, 0xC6, 0x5F, 0x61, 0xE5, 0xDE, 0x3B, 0xEB, 0xCC, 0xC8, 0x4A, 0xBA,
-    0xAD, 0x8E, 0xEA, 0xCC, 0x18, 0xE4, 0x65, 0x60, 0x90, 0x97, 0x70, 0xE0, 0x33, 0x8E, 0xC6, 0x6A,
-    0x9D, 0x31, 0xEB, 0x8E, 0xF9, 0xCF, 0x8C, 0x38, 0x9E, 0xF1, 0xB4, 0xBC, 0x08, 0x3B, 0xE0, 0x2E,
-    0xD0, 0x25, 0xE4, 0xC3, 0x93, 0xC7, 0xC5, 0x23, 0x17, 0xD4, 0x53, 0x30, 0x6E, 0x79, 0x26, 0xDE,
-    0xBF, 0x6E, 0xCF, 0x02, 0xDF, 0x2F, 0x8F, 0x7B, 0x59, 0x8C, 0x47, 0xFC, 0x52, 0x5A, 0x04, 0xB4,
-    0x88, 0xAD, 0xA6, 0xDC, 0x8F, 0xB0, 0x23, 0x94, 0x7C, 0x96, 0x79, 0x66, 0xF2, 0x58, 0x90, 0x3F,
-    0x6D, 0xF2, 0xB1, 0x09, 0xB6, 0x35, 0x19, 0xB9, 0xDA, 0xBD, 0xE1, 0x5B, 0xB2, 0x9A, 0x51, 0x53,
-    0x33, 0xF2, 0x9A, 0xA8, 0xAA, 0x2A, 0xB3, 0xAA, 0xAB, 0x77, 0xB9, 0x25, 0x69, 0x87, 0x61, 0xC0,
-    0xFC, 0x24, 0x8C, 0xAD, 0x0A, 0x98, 0x34, 0x8C, 0xF7, 0x89, 0x25, 0xBB, 0x70, 0xCD, 0x20, 0x8A,
-    0xFB, 0xC4, 0x10, 0x4D, 0x54, 0xAC, 0x8E, 0x15, 0x04, 0xE7, 0x09, 0x0C, 0xDA, 0x2A, 0x0D, 0x1A,
-    0x34, 0x82, 0x71, 0x15, 0x2C, 0x7A, 0xCE, 0x2D, 0x60, 0x33, 0x7B, 0x66, 0xB8, 0xAB, 0xCA, 0xFC,
-    0x5F, 0xD9, 0x97, 0xA4, 0xC9, 0xE0, 0xA1, 0x87, 0xBD, 0x04, 0xB5, 0x4C, 0x92, 0x8F, 0x7B, 0x6C,
-    0xD3, 0x7E, 0x8B, 0xED, 0x7D, 0xAC, 0xBF, 0xE5, 0x7E, 0x47, 0x6D, 0xD1, 0xA3, 0x5C, 0x82, 0xFE,
-    0xBF, 0x9D, 0xB9, 0xA3, 0x3E, 0x47, 0xDA, 0x7B, 0x29, 0x20, 0x77, 0xBD, 0xA8, 0xF3, 0x9A, 0x87,
-    0xFA, 0x0A, 0x6D, 0x36, 0x34, 0xED, 0xE6, 0x54, 0xEA, 0x28, 0xFD, 0x2B, 0x9A, 0x69, 0x9D, 0xAA,
-    0x89, 0xB7, 0x6B, 0xCD, 0xB2, 0xFA, 0x98, 0x50, 0xAD, 0x38, 0xA6, 0xAC, 0x57, 0x36, 0xD0, 0x11,
-    0xC4, 0x90, 0x85, 0xC3, 0x34, 0x76, 0x14, 0xFB, 0xC0, 0x0C, 0x78, 0x02, 0xBD, 0xED, 0xE0, 0x23,
-    0x53, 0xFF, 0x0B, 0x48, 0xC1, 0x6A, 0xD2, 0xD3, 0x75, 0x2B, 0xCE, 0xD7, 0xAD, 0xFF, 0x15, 0xA3,
-    0xD7, 0x52, 0x77, 0x51, 0x00, 0xF2, 0x03, 0xBA, 0x4C, 0x1B, 0xC2, 0x27, 0x31, 0x85, 0x05, 0xA5,
-    0x76, 0xFA, 0xAC, 0x0F, 0xC2, 0x4F, 0xAF, 0x19, 0xF6, 0xD0, 0x72, 0x2B, 0x95, 0xD8, 0xB7, 0xE8,
-    0x3C, 0x5E, 0xCD, 0xE8, 0x79, 0xDF, 0xDC, 0x3E, 0xD9, 0x2F, 0xE0, 0xFC, 0xAD, 0x6E, 0xD3, 0x09,
-    0x99, 0x44, 0xE7, 0x06, 0xBD, 0xCA, 0xCF, 0x56, 0x9C, 0xD2, 0xCF, 0x36, 0x9C, 0xD2, 0xBB, 0x6A,
-    0x5E, 0x2B, 0xDC, 0xEB, 0xE6, 0xF7, 0xF9, 0x6C, 0xDF, 0x73, 0x66, 0x23, 0x3E, 0x4D, 0x2C, 0xB3,
-    0xC9, 0xF9, 0x7E, 0xC5, 0x10, 0x12, 0x8C, 0x59, 0x20, 0x7F, 0xCC, 0x53, 0xFF, 0x3B, 0xAB, 0x6E,
-    0x6E, 0x22, 0x0B, 0xDB, 0xB7, 0x11, 0x51, 0x92, 0x1B, 0x21, 0x73, 0xBB, 0xCC, 0x14, 0x7B, 0x14,
-    0x03, 0x99, 0xB6, 0x29, 0x06, 0x0A, 0x46, 0x52, 0x3C, 0x73, 0xEA, 0x4E, 0x34, 0xDF, 0x41, 0x04,
-    0x8B, 0x69, 0x96, 0x3E, 0x4A, 0xD2, 0x3C, 0x27, 0xA3, 0xB2, 0xD9, 0x0D, 0xF7, 0x2A, 0x49, 0x9A,
-    0xF5, 0x11, 0xB7, 0x0C, 0xFB, 0xB9, 0xB4, 0x1C, 0x48, 0xD0, 0x74, 0x02, 0xF1, 0xED, 0x32, 0x08,
-    0xF8, 0xD1, 0x4E, 0xF5, 0x0E, 0x80, 0xA0, 0xD7, 0xA1, 0xCE, 0x45, 0x10, 0x07, 0x31, 0x77, 0x7A,
-    0x9F, 0x00, 0x61, 0x4D, 0x90, 0x58, 0xF5, 0x25, 0x71, 0x20, 0x64, 0x97, 0x25, 0xC8, 0xAE, 0x4F,
-    0xAE, 0x73, 0xA0, 0x21, 0xF8, 0x0F, 0xB9, 0x31, 0x11, 0x07, 0x55, 0x5E, 0x34, 0x41, 0x70, 0x77,
-    0x9F, 0x60, 0x0E, 0xF1, 0xB1, 0x90, 0xED, 0x97, 0xE0, 0xC2, 0x38, 0xBB, 0x18, 0xB5, 0x87, 0xCE,
-    0xBB, 0x37, 0xCE, 0x41, 0xBF, 0xF7, 0x5A, 0x63, 0xB4, 0x6F, 0xD8, 0x13, 0xAE, 0x40, 0xD5, 0xD2,
-    0x74, 0x83, 0x36, 0xBF, 0x3E, 0x7B, 0x9E, 0x14, 0x87, 0xC4, 0x1D, 0xDC, 0x3F, 0xC5, 0x6A, 0x9C,
-    0x78, 0x9C, 0xD7, 0xB0, 0x1E, 0x0A, 0x0B, 0x5A, 0x98, 0x50, 0x82, 0x42, 0x1D, 0x9A, 0x9B, 0x77,
-    0x0D, 0xEB, 0x7D, 0xFC, 0x6A, 0xD8, 0x0D, 0x50, 0x4D, 0x77, 0x18, 0xD4, 0x6C, 0x14, 0x16, 0xB5,
-    0x1A, 0x8F, 0x2C, 0xF5, 0x88, 0x76, 0x65, 0x2E, 0xCB, 0x30, 0xC0, 0x01, 0x43, 0xD0, 0x9C, 0x3F,
-    0xBB, 0xD6, 0x6A, 0xC2, 0x9A, 0x9B, 0x14, 0x6A, 0x4D, 0x35, 0x73, 0xF5, 0x17, 0x4C, 0x3F, 0x5B,
-    0x2A, 0x10, 0xE3, 0xF4, 0xFB, 0x2E, 0xC6, 0x1C, 0xFD, 0xA5, 0xA1, 0x32, 0xDC, 0x97, 0x19, 0xA5,
-    0x7B, 0x8C, 0x1C, 0x72, 0xDD, 0x37, 0x9A, 0x27, 0xB5, 0xDA, 0x9D, 0x44, 0xE4, 0xE0, 0xD0, 0x5A,
-    0xFB, 0x45, 0xAE, 0x45, 0x9B, 0x56, 0xF9, 0xEA, 0xB3, 0x4A, 0xE4, 0x6B, 0xAA, 0x4C, 0xDA, 0xB0,
-    0x68, 0x91, 0x6E, 0x26, 0x69, 0xFA, 0xF8, 0xF2, 0x79, 0x0A, 0xCD, 0xFD, 0x4D, 0x36, 0x54, 0x56,
-    0xFB, 0x49, 0x7C, 0xE6, 0xF1, 0xB1, 0x68, 0x03, 0xAB, 0x2D, 0xDA, 0x99, 0x4C, 0x4A, 0xE5, 0xD4,
-    0xFD, 0xFE, 0x93, 0xB8, 0x01, 0x8D, 0x5D, 0xDF, 0xB7, 0x02, 0xC4, 0xED, 0x25, 0x76, 0x81, 0x40,
-    0xFB, 0x20, 0xC4, 0xC8, 0x35, 0x88, 0x45, 0xB1, 0xFD, 0xE6, 0xFF, 0x01, 0x55, 0x52, 0xBF, 0x6F,
-    0xD3, 0x40, 0x18, 0x7D, 0x77, 0x6E, 0xEB, 0xD6, 0x76, 0xEB, 0x0C, 0x54, 0x2A, 0x2D, 0x25, 0x1D,
-    0x58, 0x80, 0x26, 0xF6, 0xE0, 0x21, 0xAA, 0x92, 0x9E, 0x51, 0xD9, 0xBA, 0x14, 0x89, 0x8A, 0x05,
-    0xB1, 0xB0, 0x30, 0x20, 0xDA, 0xA1, 0x0B, 0x12, 0x25, 0x0E, 0x59, 0x19, 0xC2, 0x7F, 0x50, 0x09,
-    0x06, 0x6A, 0x81, 0x28, 0x12, 0x03, 0x48, 0x45, 0x6E, 0x9B, 0xA1, 0xAB, 0x05, 0x82, 0xD9, 0xFC,
-    0x18, 0x40, 0x62, 0xB8, 0x22, 0x57, 0x32, 0x95, 0x93, 0xE3, 0xEC, 0x04, 0xD1, 0xBC, 0x93, 0x3E,
-    0x9F, 0xBF, 0x5F, 0xF7, 0xDE, 0x77, 0x57, 0x83, 0xE9, 0x29, 0x1C, 0x77, 0xD4, 0xA5, 0x7D, 0xFE,
-    0xA6, 0x0A, 0x54, 0x41, 0x13, 0x94, 0x63, 0x1A, 0x6E, 0x4C, 0xC1, 0x29, 0xBA, 0xED, 0x17, 0xC6,
-    0xFA, 0xEB, 0x43, 0x25, 0x29, 0x0C, 0x43, 0xC2, 0x12, 0x69, 0x20, 0x9E, 0xA3, 0x07, 0x2A, 0x84,
-    0x38, 0x38, 0xF1, 0xFD, 0x95, 0x0A, 0x2A, 0x1C, 0x5F, 0x8E, 0xD7, 0xA8, 0x88, 0x49, 0x17, 0x30,
-    0xDB, 0x47, 0x69, 0xE0, 0xCA, 0x04, 0x86, 0x84, 0x91, 0xB4, 0x4E, 0xD3, 0x60, 0x29, 0xB5, 0x1A,
-    0x13, 0x08, 0x1D, 0x82, 0x62, 0x53, 0x5B, 0xBF, 0xFD, 0xB2, 0xE8, 0x61, 0x13, 0x4A, 0xA4, 0x87,
-    0x78, 0x88, 0x0E, 0xF4, 0x48, 0x73, 0xB1, 0x0D, 0x79, 0x5E, 0x49, 0xF5, 0xCA, 0x09, 0x2C, 0x4F,
-    0xB2, 0xC8, 0xE2, 0x58, 0x84, 0xA4, 0xC6, 0xA0, 0xC4, 0x98, 0x06, 0x79, 0xB6, 0xAA, 0xC7, 0xF5,
-    0x66, 0xC2, 0x1A, 0xA9, 0x19, 0xA1, 0x78, 0xD4, 0xB5, 0x3E, 0xA4, 0xAC, 0x19, 0x07, 0x10, 0xCB,
-    0x99, 0xDB, 0xDA, 0x97, 0x6E, 0xEA, 0x3D, 0x4D, 0x6E, 0x51, 0x0F, 0xCE, 0xB8, 0x92, 0x7C, 0x77,
-    0x24, 0x83, 0xED, 0x15, 0x21, 0x42, 0xE8, 0x2E, 0xCA, 0xC0, 0x5B, 0xD0, 0x48, 0x55, 0xB5, 0x79,
-    0x07, 0x86, 0x6D, 0x9F, 0x03, 0x85, 0x41, 0xEE, 0x9B, 0x29, 0xE3, 0xF7, 0x5C, 0x1B, 0x1E, 0x85,
-    0x7D, 0xB9, 0x65, 0xD3, 0x4C, 0xD7, 0x88, 0x10, 0x4D, 0xD1, 0xDD, 0xCA, 0x04, 0x98, 0x87, 0xBF,
-    0x3B, 0xB9, 0xD6, 0xD3, 0x52, 0xFE, 0x49, 0x18, 0xBE, 0x96, 0x51, 0xB0, 0xDA, 0x49, 0x7D, 0x99,
-    0x8F, 0x52, 0x77, 0xC1, 0x35, 0xF0, 0xE4, 0x2E, 0x93, 0xC2, 0x9D, 0x71, 0xEA, 0x55, 0x68, 0x87,
-    0xB4, 0xCE, 0x96, 0x6A, 0x19, 0x98, 0x30, 0x6F, 0xB4, 0xBD, 0x9D, 0x68, 0x7E, 0x50, 0x21, 0x9C,
-    0x4C, 0x5D, 0x99, 0xD3, 0x90, 0x57, 0xB0, 0x33, 0x38, 0xEA, 0xD5, 0x47, 0x42, 0x4E, 0x12, 0xC3,
-    0x3E, 0x0F, 0xC4, 0x9E, 0xDC, 0x0C, 0x44, 0x2F, 0xF9, 0xBE, 0x29, 0x44, 0x5B, 0x08, 0xEE, 0x18,
-    0x46, 0xA5, 0x50, 0xD1, 0x27, 0x68, 0xFB, 0x13, 0x17, 0x29, 0xEB, 0x3A, 0x9A, 0x9D, 0x2F, 0x26,
-    0x8B, 0xCF, 0x5F, 0x1D, 0xBB, 0xD0, 0x1C, 0xB5, 0x0F, 0x8C, 0xB9, 0x25, 0x4C, 0xB5, 0x7E, 0xA8,
-    0xF8, 0xE5, 0x84, 0x03, 0x6D, 0x0A, 0x55, 0x6D, 0xB6, 0x00, 0xD5, 0x85, 0x29, 0x93, 0x81, 0x1A,
-    0xF0, 0xA0, 0x7F, 0xB3, 0xA7, 0xD5, 0x4E, 0xAE, 0x9A, 0x22, 0x27, 0x7F, 0x86, 0x0C, 0x0E, 0xA7,
-    0x0F, 0x5F, 0x44, 0x81, 0x48, 0xB3, 0x5D, 0x89, 0x7E, 0x0D, 0xCB, 0x35, 0xFA, 0x2D, 0x5C, 0xAC,
-    0x29, 0xD2, 0x5C, 0xA4, 0x2D, 0xD9, 0xA9, 0x2B, 0xA9, 0xB0, 0x7C, 0xE5, 0x98, 0xC3, 0x08, 0xB0,
-    0x27, 0x27, 0x7F, 0xFC, 0x78, 0x21, 0x3E, 0xD4, 0x6F, 0xAE, 0xD7, 0x3D, 0x6D, 0x05, 0x21, 0x0C,
-    0xC8, 0x5B, 0x9B, 0xEB, 0xB7, 0xDC, 0xCD, 0x4C, 0xDA, 0x33, 0xAA, 0xF0, 0xAE, 0x33, 0xEB, 0x73,
-    0x02, 0x56, 0x07, 0xF3, 0xDE, 0x07, 0xD2, 0x91, 0xA0, 0x88, 0x49, 0x17, 0x56, 0x8F, 0xA9, 0xC4,
-    0x64, 0xBF, 0xAE, 0x18, 0x91, 0xC6, 0x31, 0xD7, 0x97, 0x1B, 0xBC, 0x5A, 0x23, 0x27, 0x7C, 0x8B,
-    0xE4, 0xAF, 0x30, 0x83, 0xD9, 0xC1, 0xC6, 0xEE, 0x22, 0xFD, 0x18, 0x5A, 0x6B, 0x1A, 0x66, 0xE2,
-    0x9E, 0x73, 0x48, 0x56, 0xB4, 0x81, 0x2B, 0xF2, 0xA4, 0x82, 0xFC, 0x1D, 0x9D, 0x35, 0x86, 0x72,
-    0xFF, 0x58, 0x66, 0xC2, 0x08, 0x20, 0xA1, 0xDA, 0xC2, 0x8C, 0x87, 0x69, 0xF1, 0x53, 0x7A, 0x66,
-    0xC4, 0x1F, 0xE0, 0x1D, 0xC8, 0x2E, 0xF2, 0x90, 0x14, 0x87, 0xF1, 0xFF, 0x63, 0x20, 0xBD, 0xCF,
-    0xA6, 0x22, 0x32, 0x70, 0x5F, 0xE2, 0x55, 0x7E, 0x0E, 0x09, 0xFB, 0x19, 0x7F, 0x01, 0xCD, 0x7C,
-    0x4B, 0x8C, 0x1D, 0xD7, 0x99, 0xDE, 0xA9, 0x2A, 0x91, 0x85, 0x51, 0xD9, 0x2A, 0x2D, 0x86, 0xB1,
-    0x65, 0x59, 0xAC, 0x2C, 0xBC, 0x90, 0x35, 0x22, 0x6B, 0x16, 0x4A, 0xC0, 0x0C, 0xEE, 0xBD, 0x55,
-    0x14, 0x81, 0xF1, 0x42, 0x0B, 0x33, 0x08, 0x5B, 0x06, 0x46, 0x08, 0xB4, 0xF1, 0x22, 0x7E, 0xCC,
-    0xB4, 0x16, 0x44, 0xD0, 0x01, 0xBA, 0xBB, 0x4A, 0xE2, 0x42, 0x40, 0xB4, 0x20, 0x11, 0x44, 0xC8,
-    0x22, 0x08, 0x44, 0x04, 0x06, 0x32, 0x6E, 0x05, 0xD3, 0x5C, 0x70, 0xD1, 0x36, 0x6E, 0x77, 0x15,
-    0xD9, 0xC1, 0x68, 0xE1, 0x05, 0x8B, 0x6A, 0x2B, 0x5A, 0x18, 0x01, 0xCB, 0xA2, 0x34, 0xF2, 0x50,
-    0x08, 0x78, 0x24, 0x96, 0xAC, 0x22, 0x59, 0xB7, 0x4E, 0xBE, 0xEF, 0x3F, 0xD5, 0x0F, 0x8A, 0xA4,
-    0x2C, 0xCB, 0x8F, 0x49, 0xE3, 0xDE, 0x53, 0x8F, 0x7B, 0xEF, 0xA9, 0xFF, 0x9C, 0xF3, 0x3F, 0xBE,
-    0xFF, 0x71, 0xDA, 0xAD, 0x94, 0x9A, 0x28, 0xE5, 0x69, 0xA5, 0xE2, 0x54, 0xED, 0xFC, 0x19, 0xD3,
-    0x27, 0xC6, 0x9C, 0x4E, 0x95, 0x87, 0xCF, 0x1B, 0xA5, 0xC6, 0x4A, 0x85, 0xB8, 0x30, 0x46, 0x1B,
-    0xD3, 0x4D, 0xEC, 0xC5, 0xEE, 0x27, 0xC6, 0x5C, 0x35, 0xA6, 0xB5, 0xBF, 0xC9, 0xDD, 0xF4, 0xAB,
-    0x4E, 0x1D, 0xA6, 0x8B, 0xFC, 0x7C, 0xF8, 0xF3, 0xEC, 0xA7, 0xE3, 0xBB, 0x7F, 0xB7, 0x89, 0x1E,
-    0xDB, 0x9D, 0xEE, 0xED, 0x27, 0x7C, 0xF0, 0x4E, 0x8F, 0xF8, 0xB5, 0xA3, 0x1E, 0x35, 0xE8, 0x37,
-    0x33, 0x66, 0x25, 0x57, 0x5E, 0xC9, 0xFE, 0xAA, 0xED, 0xC6, 0xDF, 0x6D, 0x6A, 0x36, 0xFF, 0xF0,
-    0x13, 0x34, 0xC6, 0x54, 0xCA, 0x9F, 0x79, 0x8D, 0xF2, 0xB5, 0xEA, 0xF8, 0xE9, 0x88, 0xCD, 0x58,
-    0xF9, 0xA5, 0x3A, 0xC4, 0x66, 0x3C, 0x34, 0xD5, 0x3E, 0x7E, 0x1A, 0xB6, 0x2A, 0xA8, 0x43, 0x74,
-    0x81, 0x0E, 0x0E, 0x29, 0x79, 0xC0, 0x9A, 0x90, 0x73, 0xAF, 0x3F, 0x17, 0xC3, 0x8F, 0x8D, 0x79,
-    0x93, 0xD3, 0x85, 0x2B, 0x1C, 0x12, 0x3B, 0x79, 0x3C, 0x90, 0xF6, 0xF4, 0x8E, 0x03, 0xE8, 0x6D,
-    0x77, 0x0F, 0x24, 0xFD, 0xD1, 0x9E, 0xE3, 0xEE, 0xF1, 0xB1, 0xD3, 0x81, 0x38, 0xAF, 0xC6, 0xAC,
-    0x47, 0x1E, 0x1E, 0x7D, 0x62, 0x4C, 0xFA, 0xAF, 0xAD, 0x9C, 0x51, 0x05, 0x3E, 0x0E, 0x8C, 0xA9,
-    0xD5, 0x74, 0x7B, 0x6C, 0x19, 0x87, 0x3B, 0x53, 0x7E, 0x97, 0x98, 0x55, 0x73, 0x11, 0x93, 0xD1,
-    0x60, 0xEA, 0x0C, 0x27, 0xAA, 0x54, 0xF3, 0xE6, 0x8C, 0x25, 0x6D, 0xBF, 0xB9, 0xC9, 0xB9, 0xEB,
-    0x65, 0xF1, 0x40, 0xE8, 0x99, 0x07, 0xE4, 0xA9, 0x42, 0xDD, 0xDE, 0xA6, 0xE7, 0xC8, 0x0C, 0xDB,
-    0xCC, 0x74, 0x32, 0x5B, 0xB9, 0x52, 0x5F, 0x31, 0xFC, 0x2C, 0xE1, 0xF7, 0xA3, 0x8E, 0xCD, 0xCC,
-    0x49, 0x55, 0x32, 0xC3, 0xC2, 0x99, 0x8E, 0xCF, 0x6A, 0x30, 0x68, 0x53, 0xE3, 0x81, 0x26, 0xDD,
-    0x6F, 0xCC, 0xD9, 0x61, 0x36, 0xA2, 0x4D, 0xDD, 0x25, 0xE1, 0x4E, 0xF3, 0xED, 0xAD, 0x66, 0x96,
-    0x9C, 0x7E, 0xFF, 0xA6, 0xC9, 0xAE, 0x48, 0x6F, 0xAA, 0xE3, 0xEB, 0x68, 0x97, 0xBD, 0x34, 0xFB,
-    0xF4, 0x3C, 0x66, 0x32, 0x63, 0x9F, 0xF5, 0x4A, 0xF7, 0xBC, 0x72, 0xBE, 0x32, 0xBC, 0xCA, 0xE1,
-    0x85, 0x85, 0x8D, 0x4A, 0x55, 0x28, 0xB7, 0x53, 0x81, 0x56, 0xB1, 0x9C, 0x72, 0x19, 0x55, 0x9C,
-    0xAB, 0x9E, 0xC3, 0x0E, 0x6B, 0xFE, 0x70, 0xC6, 0x55, 0xC0, 0xD2, 0xE2, 0xB4, 0xE3, 0xE8, 0x43,
-    0x7C, 0xD1, 0x09, 0x30, 0xA0, 0x2A, 0x31, 0xCA, 0x34, 0x9E, 0x51, 0x18, 0x25, 0xA6, 0x8B, 0x23,
-    0xC6, 0xD8, 0xD0, 0x86, 0xB2, 0xFE, 0x78, 0x73, 0x00, 0x9A, 0x7C, 0x09, 0xE6, 0x21, 0x2F, 0x84,
-    0xC2, 0x6F, 0x5E, 0x2E, 0x33, 0x87, 0xCE, 0x5F, 0xEF, 0xD4, 0x11, 0x7C, 0x10, 0xE6, 0x07, 0xF9,
-    0x81, 0xF6, 0x73, 0x70, 0xEE, 0x21, 0x87, 0x5C, 0x16, 0xA4, 0xE7, 0xF1, 0x81, 0x57, 0x1D, 0xC2,
-    0xE2, 0x3E, 0xAA, 0xF1, 0x5B, 0xB2, 0x4C, 0x89, 0xFE, 0x3B, 0x10, 0x15, 0x9A, 0x77, 0x87, 0x19,
-    0x78, 0x58, 0xDA, 0x11, 0x9F, 0xF2, 0xB9, 0x5A, 0xCE, 0x7D, 0x9F, 0xA2, 0xBD, 0xB5, 0x5A, 0xCB,
-    0x9D, 0x76, 0x44, 0x69, 0x19, 0xED, 0x69, 0xC7, 0xD2, 0x2E, 0xB1, 0xFD, 0x67, 0xDD, 0x88, 0x03,
-    0x6B, 0xA5, 0xD5, 0x23, 0x59, 0x70, 0xF6, 0xA0, 0x23, 0xAE, 0x28, 0xD6, 0x1C, 0xA3, 0x3D, 0x2E,
-    0xFC, 0xA0, 0x38, 0x78, 0xCE, 0xB8, 0xE2, 0xF4, 0x0C, 0x4C, 0xA2, 0xBA, 0x47, 0x30, 0xE6, 0xA4,
-    0xC0, 0xBA, 0x45, 0x64, 0x32, 0xBF, 0x77, 0x1B, 0xE5, 0xF4, 0xD4, 0x14, 0x19, 0x85, 0x27, 0x2A,
-    0x1D, 0xCD, 0x45, 0x58, 0xE4, 0x0A, 0x44, 0x4A, 0x15, 0x29, 0x6E, 0xC6, 0x15, 0xE4, 0x21, 0x68,
-    0xC0, 0xB6, 0xEE, 0x8C, 0x53, 0x5E, 0xA4, 0x94, 0xAA, 0x73, 0x76, 0x94, 0xEA, 0xA0, 0xCC, 0xAE,
-    0xE2, 0xAF, 0xEF, 0xF8, 0xF3, 0xEB, 0x40, 0xBB, 0x0D, 0xFA, 0x5A, 0xC7, 0xB2, 0xC5, 0x4F, 0x77,
-    0xA0, 0x02, 0xCB, 0xA6, 0xB1, 0x18, 0x1D, 0x99, 0x04, 0x0B, 0x1F, 0x5E, 0x07, 0x01, 0x10, 0x69,
-    0x87, 0x3C, 0x9A, 0x81, 0x45, 0x63, 0x93, 0x42, 0x40, 0x1A, 0xE5, 0xDE, 0xC2, 0x49, 0x9F, 0x34,
-    0x2A, 0x39, 0x65, 0xD2, 0xB0, 0xCE, 0x1A, 0xAF, 0x09, 0x4C, 0x3A, 0xC3, 0xCA, 0x26, 0x69, 0x88,
-    0x8F, 0xD6, 0x76, 0x86, 0x27, 0xFC, 0xF7, 0xBD, 0x4F, 0x33, 0x21, 0xC6, 0xBB, 0x2F, 0xC5, 0xC8,
-    0xB3, 0x1C, 0xDC, 0xD1, 0x63, 0xE0, 0x51, 0x87, 0x5B, 0x46, 0x27, 0xA9, 0x6F, 0x40, 0x44, 0x6C,
-    0xC0, 0x3D, 0x33, 0xAC, 0x5A, 0x70, 0x55, 0x27, 0x79, 0xF2, 0xED, 0x72, 0xC3, 0xED, 0xB2, 0xA7,
-    0xBB, 0xF0, 0xF2, 0x2C, 0xD0, 0x85, 0xDF, 0xC4, 0x9B, 0x4D, 0x54, 0x67, 0x71, 0x99, 0xBD, 0xD8,
-    0xCD, 0x9C, 0xDE, 0xBF, 0xAD, 0xFD, 0x2E, 0x32, 0x69, 0xA4, 0xB3, 0x0E, 0x1C, 0x6A, 0x6A, 0xC7,
-    0x80, 0xBD, 0xFC, 0xCE, 0xCB, 0xBD, 0x3C, 0x50, 0x0F, 0xA9, 0xE8, 0x59, 0x2D, 0x74, 0x47, 0xF5,
-    0x5E, 0x0A, 0xFE, 0x54, 0xA9, 0xE3, 0xE0, 0xDB, 0x0B, 0x5A, 0x4D, 0x3C, 0xED, 0x34, 0x7E, 0x15,
-    0x94, 0x61, 0x99, 0xA8, 0x28, 0x6F, 0x55, 0x02, 0xC9, 0x5F, 0x06, 0x71, 0xB3, 0x0E, 0x03, 0xAF,
-    0xA1, 0x42, 0x31, 0x66, 0x0C, 0x23, 0xD4, 0x56, 0x91, 0x40, 0xCC, 0xC1, 0xF9, 0x0E, 0xD4, 0x2D,
-    0xB8, 0x37, 0xC0, 0x12, 0xC5, 0x8D, 0xED, 0xF2, 0x00, 0x54, 0x49, 0xAB, 0xBC, 0xAB, 0xE0, 0xB5,
-    0xD3, 0xB9, 0x9A, 0x60, 0xC5, 0xDA, 0xCF, 0x77, 0xF9, 0xD6, 0xDC, 0x72, 0x22, 0x3A, 0x17, 0x4F,
-    0x1B, 0x09, 0xF7, 0x8B, 0x2C, 0x70, 0xCD, 0x1E, 0x67, 0xC7, 0xCB, 0x6C, 0x0A, 0x31, 0x0E, 0xE0,
-    0x0D, 0xC7, 0x50, 0x4E, 0xDE, 0xC7, 0x02, 0xFB, 0x5B, 0x18, 0x52, 0x70, 0x11, 0x5F, 0x0F, 0x5F,
-    0x04, 0x0D, 0x51, 0xDA, 0x91, 0x9D, 0xA6, 0x34, 0x2B, 0xF8, 0xC9, 0x3A, 0x59, 0xAB, 0x83, 0x6D,
-    0x71, 0x20, 0x94, 0x39, 0xF5, 0x49, 0xC9, 0xA6, 0x0E, 0xC8, 0x8C, 0xE1, 0x7B, 0x73, 0xDF, 0x69,
-    0x20, 0xC8, 0x5E, 0x0B, 0x01, 0x71, 0x3B, 0xAC, 0xB5, 0x33, 0x03, 0x0D, 0x9B, 0xB7, 0x56, 0xFE,
-    0x76, 0x8F, 0x5A, 0x1D, 0x74, 0x2D, 0x94, 0x5A, 0x7C, 0xAD, 0x07, 0x8B, 0x35, 0xB1, 0xF2, 0xF0,
-    0xB8, 0x51, 0x94, 0x7A, 0x97, 0xC1, 0x6D, 0xD1, 0x4A, 0x71, 0x01, 0x74, 0x83, 0x4F, 0x1D, 0x61,
-    0xF2, 0x5A, 0xF5, 0xAF, 0x37, 0x5E, 0xE5, 0x40, 0xF4, 0xDC, 0x0A, 0x5A, 0x3E, 0x87, 0x60, 0x7A,
-    0x60, 0x4D, 0x6A, 0xDD, 0xC4, 0xCC, 0x20, 0x21, 0x19, 0x24, 0x76, 0x02, 0xC1, 0x9C, 0x8E, 0xD1,
-    0x79, 0x03, 0x2D, 0x76, 0xEB, 0x75, 0x03, 0x25, 0xD7, 0xE0, 0xD1, 0x29, 0x47, 0xFF, 0xFB, 0xD0,
-    0xF3, 0x43, 0x27, 0x15, 0x16, 0x1D, 0xEC, 0x5C, 0x43, 0xC3, 0x8F, 0x31, 0x21, 0x5E, 0x75, 0xCF,
-    0x93, 0x11, 0xBA, 0xF5, 0x4A, 0x74, 0xCF, 0x93, 0x00, 0x27, 0x98, 0xAC, 0x84, 0xF7, 0x74, 0x7C,
-    0x6B, 0xA5, 0xF8, 0xEF, 0x94, 0x7C, 0xCA, 0x6D, 0x85, 0xCE, 0x17, 0xC3, 0x1C, 0xDF, 0x38, 0x81,
-    0x45, 0x56, 0x3B, 0x86, 0xB7, 0xB9, 0xDB, 0x80, 0xD2, 0xB4, 0xD6, 0x7B, 0x2D, 0x77, 0xB5, 0x63,
-    0xD3, 0xED, 0x6F, 0x9C, 0x19, 0x84, 0x82, 0x0A, 0xD4, 0xA3, 0xEC, 0x79, 0x6D, 0x58, 0x81, 0x7A,
-    0x5F, 0x27, 0x10, 0x40, 0x28, 0xCF, 0x19, 0x25, 0x37, 0xDC, 0x6A, 0xA8, 0x12, 0xE3, 0x4B, 0xEF,
-    0x8B, 0x36, 0x2F, 0x68, 0x27, 0xAC, 0xCD, 0x60, 0x5F, 0x95, 0x3D, 0x58, 0xF3, 0xDE, 0x8A, 0x0E,
-    0x31, 0x8D, 0xB5, 0xF5, 0x8D, 0x55, 0xA7, 0x8D, 0x5C, 0xF0, 0x90, 0xDC, 0x36, 0x45, 0x83, 0x8B,
-    0x4B, 0x7D, 0x06, 0x61, 0xED, 0x92, 0xB6, 0x80, 0xEE, 0xAD, 0x4C, 0x0D, 0xB3, 0xD2, 0x7B, 0xA6,
-    0x34, 0xCD, 0x7E, 0x73, 0x06, 0x3A, 0xC9, 0x79, 0xF5, 0x51, 0x3C, 0x69, 0x69, 0x9B, 0x60, 0x07,
-    0x2A, 0xA7, 0x73, 0xD1, 0x77, 0x01, 0x66, 0x07, 0x91, 0xD4, 0x3E, 0x01, 0xF8, 0xE4, 0x43, 0xDC,
-    0xBE, 0xF9, 0x6C, 0x6F, 0x47, 0xA9, 0x8A, 0x9B, 0x76, 0xB2, 0x41, 0xD6, 0x09, 0xCC, 0xA0, 0xDF,
-    0x42, 0x84, 0x93, 0x3A, 0x21, 0x83, 0x42, 0x97, 0x50, 0x84, 0xB3, 0x2E, 0xAC, 0x5C, 0x4A, 0x75,
-    0x78, 0xA5, 0xEC, 0xD5, 0x46, 0xE2, 0xB5, 0x5E, 0xD3, 0x05, 0x75, 0xFC, 0x46, 0x13, 0x97, 0xB3,
-    0xA8, 0x2A, 0x02, 0x0D, 0xA9, 0x4E, 0x8E, 0xF6, 0xFE, 0x47, 0x9D, 0xDF, 0x46, 0x97, 0x2A, 0x48,
-    0x75, 0xA1, 0xB2, 0x0B, 0xA6, 0x71, 0x0C, 0xF4, 0x80, 0xDF, 0x85, 0xBD, 0x8A, 0x74, 0xA2, 0x21,
-    0xD5, 0xDE, 0xCF, 0x5D, 0xCC, 0x3E, 0xA4, 0x19, 0xDA, 0xEC, 0x3C, 0xC7, 0x88, 0x19, 0x11, 0xB9,
-    0x7B, 0x60, 0xAF, 0x50, 0x1F, 0xB8, 0x2F, 0x39, 0x01, 0xC9, 0x49, 0x3E, 0x45, 0x8E, 0xDB, 0x7A,
-    0xFA, 0x8B, 0x91, 0xF3, 0x07, 0x54, 0x9D, 0x73, 0x73, 0xC7, 0xB1, 0x20, 0x25, 0xB8, 0x0E, 0x42,
-    0x3C, 0x75, 0x5A, 0x57, 0x53, 0x37, 0xC5, 0xD0, 0x96, 0xEB, 0xAA, 0x73, 0xB5, 0xA7, 0xA9, 0xA8,
-    0x62, 0x9A, 0x78, 0xD5, 0x79, 0xB8, 0x0C, 0x45, 0x6F, 0x25, 0xE0, 0x5B, 0x0C, 0x05, 0x24, 0xA4,
-    0xE1, 0x1B, 0xAD, 0x35, 0x2A, 0xF2, 0x57, 0xC0, 0x88, 0x5F, 0x84, 0xB5, 0x35, 0x01, 0x88, 0xEC,
-    0x0E, 0xB7, 0x6A, 0x59, 0xFF, 0x54, 0xBB, 0x1F, 0x6C, 0x5E, 0xAD, 0xC2, 0xF9, 0xF0, 0x52, 0x39,
-    0x9D, 0x26, 0xD1, 0xB1, 0x77, 0x74, 0x37, 0x89, 0x9F, 0x01, 0x8E, 0xE8, 0xE2, 0xF0, 0x82, 0xA9,
-    0xBB, 0xC4, 0x33, 0xC7, 0x74, 0x17, 0x76, 0x80, 0x16, 0x51, 0x9D, 0xA0, 0xFB, 0xB4, 0x13, 0x19,
-    0x24, 0x83, 0x6E, 0x6A, 0xB5, 0xDD, 0xFB, 0x3A, 0xCE, 0x60, 0x9C, 0x14, 0x66, 0x15, 0x1F, 0x42,
-    0x20, 0xC3, 0x0A, 0x6A, 0x32, 0x39, 0x86, 0x5B, 0xE4, 0x62, 0xAF, 0xE1, 0x34, 0x54, 0x3D, 0x6F,
-    0x61, 0xFC, 0x3D, 0x6C, 0xB0, 0xD7, 0xD2, 0x12, 0xD6, 0xB4, 0x81, 0xA7, 0x28, 0x5A, 0xC4, 0x37,
-    0x6D, 0x72, 0x6D, 0xA5, 0xE0, 0xCC, 0x65, 0x9B, 0xD4, 0xB7, 0xD0, 0xB2, 0x00, 0x5B, 0xB0, 0x73,
-    0x1F, 0xF2, 0x56, 0x09, 0x6C, 0xF5, 0x2E, 0x59, 0xDF, 0x40, 0xA4, 0x5F, 0x35, 0x95, 0x0F, 0x9B,
-    0xA7, 0xF9, 0x95, 0x36, 0x1A, 0xD4, 0x96, 0x9A, 0x91, 0x9A, 0x0D, 0x36, 0xD4, 0xD9, 0x2A, 0xA3,
-    0xB2, 0x4C, 0x78, 0x36, 0xB1, 0xF7, 0xA0, 0x31, 0xFB, 0xA4, 0x82, 0x61, 0x8C, 0xFA, 0xB9, 0x79,
-    0x41, 0x54, 0x2D, 0x8D, 0xB0, 0x76, 0x29, 0xD6, 0x40, 0x7C, 0x98, 0xF2, 0xFD, 0x3B, 0xD0, 0x40,
-    0xE4, 0x86, 0xFC, 0x0D, 0xBD, 0x7C, 0x78, 0x22, 0xEA, 0x79, 0xC2, 0x83, 0x66, 0x6F, 0xDE, 0x0D,
-    0xCD, 0x9E, 0x3F, 0xF3, 0x00, 0x2B, 0xDF, 0x82, 0xDC, 0xDE, 0xF9, 0xF8, 0xD9, 0x19, 0x24, 0xA6,
-    0x8B, 0x21, 0x4B, 0x53, 0xE5, 0x43, 0x9B, 0xC5, 0xDF, 0x2E, 0x41, 0x30, 0x9E, 0x89, 0x07, 0xE0,
-    0x21, 0x39, 0xA6, 0x83, 0x4A, 0x8C, 0x06, 0x92, 0xAA, 0x8B, 0x97, 0xC0, 0x59, 0x0E, 0x05, 0x0E,
-    0xF3, 0x1C, 0x69, 0x19, 0xFD, 0xF0, 0xE7, 0xAC, 0xB6, 0x98, 0x1A, 0xE8, 0x7D, 0x02, 0xA6, 0x04,
-    0xDF, 0x0C, 0x31, 0xC7, 0x2E, 0x4D, 0x2B, 0x7B, 0xA0, 0x80, 0xAA, 0x0D, 0x2A, 0xA5, 0x6A, 0xB0,
-    0xBA, 0x72, 0x42, 0x00, 0xCF, 0xEF, 0x29, 0xE8, 0xD5, 0x07, 0x42, 0x73, 0xEB, 0x07, 0x25, 0xA6,
-    0xB1, 0x13, 0x3B, 0x10, 0x49, 0x3F, 0xEC, 0x30, 0x1B, 0x86, 0x8E, 0x8F, 0xCC, 0x87, 0x5C, 0x97,
-    0x37, 0xCC, 0xEA, 0x35, 0x33, 0x2C, 0x71, 0xB7, 0x0D, 0x4A, 0x04, 0x9E, 0xDC, 0x79, 0x2B, 0x2A,
-    0x07, 0x74, 0xEC, 0xF0, 0x96, 0xBF, 0x73, 0x8B, 0x66, 0x4A, 0x28, 0x0B, 0xF8, 0xE8, 0xB8, 0xB2,
-    0x2C, 0x68, 0x6F, 0xE1, 0x6F, 0xDB, 0xE4, 0xD6, 0x6A, 0xD7, 0xE4, 0xA6, 0xD6, 0xE4, 0x6E, 0x58,
-    0x93, 0xEB, 0x8A, 0xC9, 0xCD, 0xEF, 0x69, 0x72, 0xCB, 0x4F, 0x9B, 0xDC, 0x6D, 0x65, 0x0F, 0xB6,
-    0x7E, 0xFE, 0xAD, 0x75, 0x3F, 0x8F, 0xD5, 0xE8, 0x49, 0x18, 0xC0, 0x93, 0xDA, 0xD5, 0xCE, 0xD5,
-    0x32, 0x28, 0xFD, 0xD3, 0x69, 0xAC, 0x26, 0xF1, 0xCF, 0x67, 0x5F, 0xA1, 0x89, 0x31, 0x32, 0x03,
-    0x90, 0x44, 0x42, 0x70, 0x19, 0x49, 0xB3, 0x3D, 0x59, 0x9C, 0x47, 0xC1, 0x2A, 0xBB, 0xB7, 0x06,
-    0x9C, 0xE2, 0x34, 0x18, 0xAF, 0xA7, 0x01, 0x72, 0x71, 0xD1, 0x11, 0xE6, 0x66, 0x1C, 0x77, 0x9C,
-    0x93, 0xBE, 0x37, 0xB1, 0x72, 0xC0, 0x1F, 0x64, 0x1B, 0xFE, 0x84, 0x96, 0x79, 0x8F, 0x8D, 0xA6,
-    0x41, 0x0B, 0xA9, 0x85, 0xE3, 0xAB, 0x78, 0x5A, 0x76, 0x91, 0x0E, 0x42, 0x6A, 0x52, 0xD7, 0x50,
-    0x83, 0xA0, 0x2B, 0x0D, 0x07, 0x28, 0x6C, 0xA1, 0x50, 0x7C, 0x99, 0x1D, 0x00, 0x66, 0xE8, 0xDE,
-    0x11, 0x54, 0xB0, 0x06, 0xCF, 0x95, 0xAD, 0x78, 0x27, 0xB0, 0x3A, 0x0E, 0x2E, 0xFD, 0x3B, 0x2F,
-    0x03, 0x5C, 0xC6, 0xB8, 0x9C, 0x86, 0xB9, 0xAB, 0x31, 0xB2, 0x0E, 0x83, 0xBB, 0x61, 0xC4, 0x9F,
-    0x18, 0x4B, 0x4F, 0x02, 0xF6, 0xBE, 0x06, 0x94, 0xE3, 0x1C, 0x2B, 0x89, 0x51, 0xBD, 0xCD, 0xBD,
-    0x07, 0x7F, 0xB3, 0x52, 0x8B, 0xC0, 0xCB, 0xC0, 0x0F, 0xB3, 0x38, 0xCF, 0xC0, 0x92, 0xB3, 0xC0,
-    0xDC, 0xAE, 0x1E, 0x6D, 0x97, 0xAC, 0xDB, 0x83, 0x43, 0x50, 0x09, 0x4F, 0x05, 0x62, 0x93, 0x3D,
-    0xBD, 0x3F, 0x5D, 0x84, 0xC6, 0xF1, 0x36, 0xA1, 0x6E, 0x46, 0x13, 0x35, 0xF5, 0x36, 0xEB, 0xE0,
-    0x33, 0x4E, 0x72, 0x9C, 0xAC, 0xE1, 0xC4, 0xE7, 0xC9, 0x82, 0x3D, 0x49, 0x56, 0xFA, 0xD7, 0x37,
-    0x09, 0x81, 0x65, 0x21, 0x94, 0x85, 0xBE, 0xDF, 0xF5, 0xCB, 0x09, 0xBA, 0xDD, 0x6E, 0xA6, 0x9F,
-    0xD1, 0x8C, 0x6D, 0xB3, 0xC6, 0x66, 0xE1, 0xAE, 0x86, 0x9D, 0xCE, 0x76, 0x1A, 0x31, 0x94, 0xD3,
-    0x1D, 0x0C, 0x2A, 0x36, 0xB2, 0x59, 0x59, 0xA3, 0xDD, 0xE0, 0x8A, 0xE0, 0xE9, 0x0E, 0x19, 0x76,
-    0x91, 0x4C, 0x3B, 0x00, 0x63, 0xB9, 0x91, 0x61, 0x02, 0xA3, 0x15, 0xB8, 0x7B, 0xA5, 0x4F, 0x98,
-    0xBD, 0x80, 0x6F, 0x84, 0xF8, 0x86, 0x87, 0x4B, 0x30, 0x94, 0xFE, 0x0A, 0xF0, 0x25, 0x30, 0x45,
-    0x24, 0x5E, 0xA2, 0x74, 0xAA, 0x82, 0x5F, 0x72, 0x82, 0xE2, 0x37, 0x68, 0xA0, 0x0B, 0xF6, 0xE5,
-    0x76, 0xEC, 0xD5, 0xFF, 0x50, 0x04, 0xE2, 0x0D, 0x11, 0x92, 0x48, 0xA4, 0x84, 0x7D, 0xFB, 0x1F,
-    0xDE, 0x5A, 0xAD, 0x78, 0x1B, 0x4F, 0xC4, 0x6D, 0x3F, 0x77, 0x3A, 0x3E, 0x81, 0xDF, 0x1E, 0xF1,
-    0x36, 0xD0, 0x4E, 0x11, 0x39, 0x59, 0xE9, 0xCE, 0xF8, 0x9C, 0xE0, 0x63, 0x42, 0xA2, 0xE4, 0x17,
-    0x7C, 0x94, 0x20, 0x00, 0x00, 0x79, 0x78, 0x3B, 0xA4, 0x74, 0x51, 0x08, 0x47, 0x2F, 0xBC, 0x40,
-    0xCF, 0x20, 0x1A, 0x34, 0x43, 0xB2, 0x16, 0xD0, 0x1F, 0x08, 0x46, 0x57, 0x1F, 0x82, 0x5C, 0xF4,
-    0x02, 0x62, 0x85, 0xD6, 0xA0, 0xA7, 0xF9, 0x81, 0x1A, 0x25, 0xFE, 0x58, 0xC7, 0x8A, 0x02, 0xCD,
-    0x84, 0xF9, 0x71, 0xB5, 0xED, 0xEA, 0x7E, 0x7F, 0x65, 0xDD, 0xBA, 0xBE, 0x85, 0x78, 0xFE, 0xF4,
-    0x8B, 0x05, 0x77, 0x86, 0x5B, 0x98, 0x8E, 0x59, 0x0C, 0xEF, 0xF7, 0x02, 0x55, 0xE7, 0xDD, 0xDE,
-    0x2F, 0x98, 0xB1, 0x47, 0x4F, 0x11, 0x9C, 0xBA, 0x3A, 0xCA, 0xE3, 0xB4, 0x25, 0x4B, 0x4E, 0xE8,
-    0xE6, 0x87, 0x2F, 0x01, 0xDC, 0x9E, 0xAA, 0x61, 0xF2, 0x74, 0x0B, 0xAE, 0x9C, 0x4E, 0x00, 0x68,
-    0xA3, 0xF0, 0x03, 0xD8, 0xC5, 0x4D, 0xDA, 0x41, 0x7D, 0x13, 0xFD, 0x77, 0x63, 0x48, 0xD5, 0x72,
-    0x78, 0x6C, 0xA6, 0xB2, 0x63, 0x15, 0x94, 0x71, 0x49, 0xFF, 0x1A, 0xD8, 0x11, 0x4D, 0x08, 0x7F,
-    0x97, 0xA3, 0x3E, 0x70, 0x1C, 0x33, 0xDE, 0xE0, 0x4E, 0x03, 0x19, 0x3C, 0x0F, 0xC2, 0xD6, 0x20,
-    0x25, 0x6B, 0x20, 0x79, 0x4D, 0xCE, 0x5B, 0xB5, 0xE6, 0x9A, 0x6B, 0x1D, 0xE8, 0xA6, 0x64, 0x77,
-    0x54, 0x91, 0xDE, 0xCC, 0xED, 0x7C, 0xED, 0xC0, 0x1E, 0xBA, 0xF0, 0x21, 0xE4, 0x3D, 0x8B, 0xF0,
-    0x8E, 0xF1, 0x4E, 0x6A, 0x6F, 0x96, 0x68, 0xAF, 0x17, 0xBF, 0x7D, 0xF6, 0x02, 0x74, 0x47, 0xBA,
-    0xF1, 0x5C, 0x13, 0xA6, 0x11, 0x88, 0x85, 0xCF, 0x16, 0x42, 0x40, 0xA6, 0xF6, 0xD0, 0x4D, 0x60,
-    0x92, 0x0C, 0x67, 0xD0, 0x80, 0xB2, 0x25, 0xA7, 0x38, 0x35, 0x38, 0x10, 0xFB, 0x95, 0x2B, 0x4A,
-    0x3E, 0x67, 0xE0, 0x63, 0x62, 0x31, 0x2A, 0xA7, 0x72, 0x9C, 0xF5, 0x78, 0x3A, 0x9C, 0x8F, 0xA7,
-    0xFB, 0x10, 0x4F, 0x4F, 0x52, 0x80, 0x1D, 0x15, 0xBC, 0x09, 0x4B, 0xFF, 0x2D, 0x5C, 0x86, 0x1F,
-    0xCF, 0xD7, 0x44, 0x4D, 0x11, 0x00, 0x01, 0x74, 0x5B, 0xD6, 0xA7, 0xCB, 0xAF, 0xD7, 0x0B, 0xEA,
-    0xDC, 0x82, 0x3A, 0xB9, 0xA0, 0x74, 0x66, 0x2A, 0xBC, 0x16, 0xD4, 0x74, 0x41, 0x8D, 0x17, 0xD4,
-    0xE1, 0x05, 0x35, 0x59, 0x50, 0x1B, 0x58, 0x3E, 0x80, 0x3E, 0xDC, 0x8F, 0xC5, 0x26, 0xFD, 0x06,
-    0x6F, 0x5D, 0x5C, 0x75, 0x70, 0x77, 0x0D, 0xDC, 0xD1, 0x2A, 0xB7, 0x06, 0x65, 0xE7, 0x31, 0xB9,
-    0x63, 0x7A, 0xDF, 0xF0, 0x0C, 0x20, 0x23, 0xF0, 0x2C, 0x70, 0x63, 0x8A, 0x1B, 0x40, 0x16, 0xF8,
-    0x71, 0xAC, 0xE6, 0xDF, 0x7A, 0xFE, 0xE7, 0x14, 0x18, 0x5A, 0xC4, 0x1C, 0x6A, 0x0E, 0x33, 0xAF,
-    0xF4, 0x3E, 0xF1, 0x8E, 0xE2, 0x1A, 0xA4, 0x56, 0x50, 0xD2, 0x74, 0x72, 0xE1, 0x6A, 0x5F, 0xBC,
-    0x65, 0x0D, 0xE3, 0x5B, 0xA2, 0x62, 0xC8, 0x1F, 0x7C, 0x9C, 0x79, 0xF5, 0x87, 0x81, 0x18, 0x94,
-    0x4E, 0xFD, 0xD9, 0x6C, 0xC7, 0xAF, 0x8C, 0xD2, 0x75, 0x68, 0xCB, 0x25, 0xCC, 0x4F, 0x78, 0x41,
-    0xE3, 0xB1, 0xF1, 0xB7, 0x2E, 0x12, 0x8B, 0xC6, 0xCF, 0x43, 0x1E, 0x96, 0xD7, 0x29, 0x93, 0x85,
-    0xD5, 0x97, 0x04, 0xB1, 0x82, 0x90, 0x04, 0x2B, 0x91, 0x95, 0xAB, 0x21, 0x8A, 0x44, 0x8B, 0x54,
-    0xC1, 0xFB, 0x35, 0x45, 0xA5, 0xB2, 0xB7, 0x67, 0x45, 0x15, 0xF4, 0x71, 0x83, 0x85, 0xD0, 0x45,
-    0xC5, 0x4F, 0x83, 0xDE, 0x81, 0x7F, 0xFB, 0x65, 0xE5, 0xA5, 0x6E, 0x99, 0xE5, 0xFB, 0xD6, 0xE0,
-    0xFB, 0xAB, 0x5A, 0x2D, 0x5C, 0xC3, 0x84, 0x3D, 0x2A, 0x74, 0xC0, 0x81, 0x9A, 0x41, 0xA6, 0xB6,
-    0x4A, 0xEF, 0xFF, 0x8E, 0xD4, 0x4F, 0xB6, 0xCA, 0xE8, 0xD0, 0xC8, 0x7B, 0x73, 0xAB, 0x9A, 0x1E,
-    0x1E, 0x87, 0xEE, 0xD5, 0xAD, 0x7A, 0x32, 0x5E, 0xF4, 0xAE, 0x5E, 0x49, 0x27, 0x60, 0x05, 0xE8,
-    0xE6, 0x49, 0x92, 0x7B, 0xB5, 0x9B, 0x7F, 0x17, 0x23, 0xB6, 0xC1, 0xB8, 0xF4, 0x8B, 0x75, 0xF1,
-    0xA0, 0xFA, 0xAE, 0x6A, 0xA2, 0x34, 0xC4, 0xEC, 0x00, 0x2C, 0x45, 0x51, 0xEA, 0xDC, 0xA8, 0x55,
-    0x4C, 0x9B, 0x96, 0x42, 0xDB, 0xC3, 0x20, 0x94, 0x6A, 0x52, 0x00, 0x4E, 0xCC, 0xE0, 0x04, 0x41,
-    0x5C, 0x92, 0x6A, 0x89, 0x6E, 0xE4, 0xCA, 0xD9, 0xC4, 0x78, 0xA5, 0x1E, 0x85, 0x7E, 0xAE, 0x17,
-    0xD8, 0x9C, 0x0C, 0x83, 0x54, 0x9F, 0x0F, 0xC3, 0xF4, 0x23, 0x1D, 0x4E, 0xE8, 0x0D, 0xC2, 0xE8,
-    0xAC, 0xC3, 0x00, 0x26, 0x4F, 0x03, 0x80, 0xD6, 0xA6, 0x84, 0xCD, 0x68, 0xFC, 0x3E, 0x2C, 0xDC,
-    0xDB, 0x9B, 0x57, 0xCA, 0x5B, 0xFA, 0xD7, 0xED, 0xD2, 0x74, 0x9C, 0x24, 0x49, 0xF8, 0xCA, 0xF5,
-    0xD3, 0x9B, 0xBF, 0x34, 0x9B, 0x1A, 0x26, 0x65, 0xB6, 0xEC, 0x37, 0xC9, 0xF3, 0x65, 0x17, 0xBE,
-    0xAD, 0x9F, 0xF0, 0x6F, 0x02, 0x58, 0xF5, 0x8B, 0xCA, 0xF9, 0x08, 0x9C, 0xF7, 0x33, 0x18, 0x4F,
-    0xF8, 0x55, 0xD3, 0xA9, 0x72, 0xE5, 0xB2, 0x52, 0xC9, 0x7C, 0xAA, 0x66, 0x1B, 0x2B, 0xAF, 0x7F,
-    0x02, 0x1E, 0xB8, 0x82, 0x37, 0x26, 0xBE, 0xEF, 0x95, 0x77, 0x1B, 0xB6, 0xE9, 0x3A, 0xD4, 0x4F,
-    0xC1, 0xB8, 0xCE, 0x3C, 0x86, 0x71, 0x9D, 0x30, 0x14, 0xFA, 0x66, 0x7A, 0x18, 0x66, 0xA4, 0x52,
-    0x63, 0xB8, 0x70, 0x5B, 0x38, 0xC0, 0x54, 0xC1, 0x0A, 0x12, 0x58, 0x95, 0x05, 0x51, 0xD5, 0x4C,
-    0xED, 0xEF, 0xD5, 0x13, 0x2B, 0x2B, 0x00, 0x78, 0x33, 0x7C, 0x06, 0x13, 0x33, 0xBE, 0xE3, 0xB0,
-    0x34, 0x11, 0xBF, 0x75, 0x29, 0xC1, 0x41, 0xCB, 0x01, 0xE8, 0x6A, 0xD9, 0x71, 0x7F, 0xA2, 0x0E,
-    0x27, 0xBD, 0x2A, 0x9A, 0x65, 0xC7, 0xA8, 0x11, 0xF0, 0xC4, 0x1A, 0x23, 0x1D, 0xCB, 0xCA, 0xBF,
-    0x80, 0x89, 0x64, 0xBC, 0x23, 0xD2, 0x5E, 0x5D, 0xDC, 0x2C, 0x9E, 0x66, 0x58, 0xEC, 0xBA, 0x29,
-    0x27, 0x71, 0xE7, 0xB4, 0x8E, 0x98, 0xA9, 0xD8, 0x5A, 0x73, 0xC2, 0x92, 0x68, 0x4F, 0x88, 0xA3,
-    0xA8, 0x7D, 0xF8, 0xB9, 0xF5, 0xC3, 0xF8, 0x38, 0x11, 0x39, 0x1D, 0xCB, 0x6B, 0x22, 0x32, 0x13,
-    0x33, 0x20, 0xD4, 0xF8, 0x60, 0xDB, 0xF9, 0x9B, 0xD6, 0x67, 0xD2, 0xFD, 0xEA, 0x6A, 0xC9, 0xC0,
-    0x85, 0x4B, 0xA7, 0x3A, 0x17, 0xEF, 0x93, 0xCA, 0x91, 0xDD, 0x12, 0xFF, 0x24, 0x6A, 0xE7, 0x29,
-    0xC3, 0xE5, 0x18, 0xDA, 0x77, 0x51, 0x4C, 0xF1, 0xC4, 0x69, 0x08, 0x13, 0x80, 0x37, 0xAA, 0x04,
-    0x2C, 0x0F, 0x53, 0xFD, 0x0A, 0xE6, 0x15, 0x28, 0x21, 0xEB, 0x04, 0x7E, 0x39, 0x58, 0x7F, 0xAF,
-    0x1B, 0xF0, 0x4C, 0x2E, 0x60, 0x28, 0x83, 0x1B, 0x61, 0x84, 0xF7, 0xFD, 0x9D, 0x10, 0xDD, 0x02,
-    0x91, 0x1E, 0x00, 0x19, 0x0D, 0xBA, 0xF7, 0x71, 0xF6, 0x6C, 0x7B, 0x10, 0x04, 0x34, 0xE7, 0x76,
-    0xB0, 0x0C, 0x48, 0x3A, 0x38, 0xC2, 0xAD, 0x76, 0xDD, 0xD5, 0xC1, 0x65, 0x73, 0xFD, 0xB6, 0x21,
-    0x9A, 0x6B, 0x05, 0xD2, 0xB9, 0x05, 0x91, 0x9C, 0x05, 0x6A, 0xF7, 0xC4, 0x32, 0x0F, 0x2A, 0x75,
-    0x36, 0x86, 0x26, 0x80, 0x31, 0xC5, 0xFC, 0x96, 0x74, 0xC1, 0x15, 0x91, 0x8B, 0xB1, 0xF8, 0x33,
-    0xD2, 0x42, 0x0C, 0xF1, 0xFD, 0x2C, 0xA8, 0x19, 0x96, 0x2D, 0xF0, 0xD3, 0x6F, 0xAA, 0x07, 0x81,
-    0xCE, 0x0E, 0x53, 0xD1, 0x42, 0xAD, 0x43, 0xA5, 0x04, 0xF9, 0x70, 0x19, 0xE4, 0x4E, 0x7D, 0x18,
-    0xE6, 0x68, 0x4D, 0x1D, 0xC4, 0x84, 0x2D, 0x06, 0xFF, 0x7B, 0xE5, 0x16, 0xBC, 0xF6, 0xB6, 0x10,
-    0xD9, 0x65, 0xD8, 0x6E, 0xD1, 0x2A, 0x46, 0xFE, 0x3D, 0xA9, 0x3E, 0x50, 0x7F, 0x51, 0x3E, 0x74,
-    0xCE, 0xFB, 0x9F, 0x38, 0xF9, 0x0F, 0x75, 0x96, 0x98, 0x8B, 0x2D, 0x2D, 0x1E, 0x43, 0x7E, 0x8C,
-    0x80, 0x0F, 0xA8, 0xA2, 0xFB, 0x7C, 0x60, 0xE2, 0xE3, 0xE7, 0xDE, 0x5A, 0xA4, 0xCE, 0x12, 0x30,
-    0xC1, 0x9F, 0x97, 0xC9, 0x6F, 0x80, 0x10, 0x6B, 0x3B, 0xCD, 0xC2, 0xD0, 0x24, 0x73, 0xEB, 0xDF,
-    0xF9, 0x55, 0xB2, 0x8D, 0x46, 0xBA, 0x3B, 0x90, 0x82, 0xC3, 0xC6, 0xB5, 0x00, 0x33, 0x66, 0x44,
-    0x05, 0xEF, 0x03, 0x8B, 0x03, 0x5C, 0xE0, 0x7B, 0x7C, 0x82, 0x0C, 0xC3, 0xD8, 0x01, 0x66, 0x52,
-    0x3D, 0x06, 0x3E, 0x38, 0x88, 0xF7, 0x61, 0x35, 0x79, 0x76, 0x86, 0xFB, 0x00, 0xB3, 0xE6, 0xCC,
-    0x37, 0xD1, 0xC3, 0x29, 0x06, 0x10, 0x13, 0x19, 0xDE, 0xF6, 0xC9, 0xC7, 0xA9, 0x1A, 0xC5, 0x30,
-    0x94, 0x17, 0xB5, 0x5B, 0x8F, 0x62, 0x15, 0x30, 0x98, 0x72, 0x7E, 0x14, 0xA9, 0xF0, 0xD8, 0xE5,
-    0x8F, 0x9F, 0xD3, 0xE3, 0xC8, 0xCC, 0xFC, 0xCB, 0x30, 0xBF, 0x4B, 0x4F, 0x4A, 0xF0, 0x87, 0x31,
-    0xA0, 0x21, 0x8C, 0xF0, 0x6A, 0x8A, 0x45, 0x4E, 0x1B, 0x75, 0x7E, 0xAC, 0xA0, 0x16, 0x20, 0x7E,
-    0x8E, 0xBE, 0xF9, 0x5C, 0xC7, 0xC0, 0x26, 0xE1, 0xE5, 0x09, 0x2C, 0x5D, 0xAF, 0xFE, 0x95, 0xD3,
-    0x39, 0x83, 0x2D, 0x22, 0xE3, 0x26, 0xE0, 0x89, 0x95, 0xCE, 0x42, 0xD8, 0xF6, 0x29, 0x95, 0x79,
-    0x3D, 0x63, 0xAF, 0x8D, 0x9A, 0xFF, 0x95, 0x7A, 0x18, 0xFA, 0x7D, 0x0D, 0xCA, 0x68, 0x2D, 0x3C,
-    0xAA, 0xD7, 0x9E, 0x54, 0x0B, 0x6B, 0x47, 0xD4, 0x68, 0xED, 0xA4, 0x3A, 0xB4, 0x76, 0x4E, 0x3D,
-    0x86, 0xF7, 0xC1, 0x42, 0xAB, 0x83, 0x1B, 0x8D, 0x3A, 0x74, 0x7E, 0xAA, 0xC6, 0x27, 0x8B, 0xA3,
-    0xDD, 0x49, 0x8C, 0xEA, 0x64, 0x64, 0xEA, 0x17, 0x5C, 0x80, 0x88, 0xC8, 0xE4, 0x23, 0xB7, 0xFE,
-    0x3A, 0x38, 0x40, 0x1D, 0x76, 0xCB, 0x20, 0x5F, 0x70, 0x61, 0xD6, 0x5A, 0x05, 0x02, 0x60, 0xF9,
-    0xA7, 0x5E, 0x3D, 0x56, 0x6D, 0xCC, 0x18, 0x4F, 0xF8, 0x4A, 0xE9, 0xD5, 0xCE, 0x59, 0x09, 0x1C,
-    0x88, 0x88, 0x6E, 0xDC, 0x2B, 0xA8, 0xDF, 0x83, 0xF4, 0x19, 0xF0, 0xE6, 0x39, 0x8C, 0xEA, 0x02,
-    0xA6, 0x34, 0x5E, 0x65, 0x8C, 0xA4, 0x1F, 0x1F, 0x97, 0xB8, 0xC9, 0x64, 0xF0, 0x8D, 0x6E, 0x3E,
-    0x0B, 0xDD, 0xD2, 0x39, 0xC2, 0xE6, 0x95, 0x93, 0x3A, 0xE9, 0xA2, 0x5A, 0x00, 0xDE, 0xC9, 0x87,
-    0x5E, 0xF6, 0xF7, 0xA9, 0x5B, 0xC7, 0xEA, 0xBC, 0x5A, 0x08, 0x95, 0x7B, 0xF1, 0xD6, 0xCA, 0x3A,
-    0x16, 0x75, 0x0B, 0xEA, 0x67, 0xB0, 0x53, 0x10, 0x64, 0x60, 0x9E, 0xAF, 0x52, 0x43, 0x61, 0xC6,
-    0x20, 0x76, 0x29, 0xA3, 0x06, 0x6B, 0x82, 0x5D, 0x84, 0x57, 0x21, 0x74, 0x70, 0xAD, 0xFA, 0xB3,
-    0x36, 0x5C, 0xCA, 0xB0, 0x9B, 0x77, 0xE1, 0x47, 0xCA, 0xF9, 0x04, 0xAC, 0x2C, 0x78, 0x4F, 0x47,
-    0x79, 0x00, 0xF8, 0x07, 0x9E, 0xE0, 0x92, 0x87, 0xE8, 0xD0, 0xAB, 0x30, 0xAD, 0x74, 0x0C, 0xC6,
-    0xE0, 0x9B, 0x30, 0x87, 0x12, 0xD3, 0x61, 0xE5, 0x30, 0xF1, 0x01, 0xC8, 0xE2, 0x12, 0x60, 0x52,
-    0x0C, 0x92, 0x81, 0xC0, 0x40, 0x31, 0x70, 0x71, 0x48, 0xBA, 0x5F, 0x1B, 0x68, 0xFE, 0xFC, 0x26,
-    0xDD, 0x29, 0xF2, 0xE0, 0x55, 0x7D, 0x90, 0xB8, 0xFD, 0xB1, 0x93, 0xB4, 0x8B, 0x30, 0x9E, 0x8C,
-    0x81, 0x80, 0x15, 0xB3, 0xB9, 0x22, 0x21, 0x40, 0xE9, 0x5C, 0x1B, 0x3B, 0x2B, 0x5A, 0x9A, 0xD4,
-    0x46, 0x1E, 0x84, 0x71, 0x51, 0xCF, 0x40, 0xA7, 0x3A, 0x45, 0x23, 0xAE, 0x5A, 0x58, 0x2D, 0xBF,
-    0xDE, 0x64, 0x64, 0xF9, 0xDE, 0x29, 0x6E, 0xAA, 0x38, 0xDC, 0xFA, 0x58, 0x60, 0x90, 0x3A, 0xE8,
-    0xBF, 0x58, 0x2F, 0xB0, 0x59, 0x8B, 0x03, 0x49, 0x29, 0x50, 0x65, 0x44, 0xF9, 0x7A, 0x9C, 0xAF,
-    0x27, 0x65, 0x9F, 0x94, 0x66, 0x77, 0xC1, 0x24, 0x00, 0xF3, 0xE9, 0xD7, 0x61, 0x99, 0xE3, 0xF8,
-    0xCE, 0x21, 0xD0, 0xA3, 0xA3, 0x57, 0xBB, 0xFB, 0xE3, 0xC7, 0xC9, 0xD1, 0xA3, 0x3D, 0x0D, 0xB4,
-    0xD0, 0xE2, 0xD0, 0xE4, 0x50, 0x7E, 0x50, 0xBA, 0x6B, 0x20, 0xDB, 0x6F, 0x22, 0xE8, 0xB5, 0xF2,
-    0x40, 0x0A, 0x0D, 0x0D, 0x9B, 0xF9, 0x16, 0xC6, 0x09, 0x10, 0xA2, 0x9E, 0x72, 0x4B, 0xD8, 0xFB,
-    0x73, 0xB0, 0xF8, 0xF1, 0x4C, 0x95, 0x81, 0x5B, 0xFD, 0xB9, 0x5B, 0x3E, 0xF9, 0x25, 0x75, 0xCE,
-    0xF7, 0xD5, 0x93, 0xCE, 0x85, 0x32, 0xD8, 0xFF, 0x21, 0x8C, 0x4F, 0x8B, 0x05, 0xD8, 0x75, 0x0D,
-    0x6B, 0xA7, 0xBC, 0xEB, 0xCD, 0xF8, 0xC3, 0x7B, 0xCF, 0x56, 0x8B, 0x38, 0xFF, 0x72, 0xED, 0x54,
-    0x7C, 0x3F, 0x54, 0x3B, 0x97, 0x97, 0x6A, 0xC7, 0x74, 0x35, 0xC3, 0xBD, 0x6B, 0x83, 0x1A, 0x40,
-    0x37, 0x3F, 0xC0, 0xF3, 0x85, 0x2D, 0x6C, 0x4A, 0x02, 0xEF, 0xEF, 0x09, 0x57, 0x80, 0x11, 0x1B,
-    0xC7, 0x38, 0xAD, 0xDB, 0xA9, 0x45, 0x32, 0x05, 0x84, 0x8E, 0x6F, 0x22, 0xAD, 0xBD, 0xEF, 0x65,
-    0xB0, 0xC3, 0x06, 0xDF, 0x4C, 0x5E, 0x30, 0x1A, 0x1F, 0x5A, 0xE3, 0x32, 0xDA, 0x21, 0xF0, 0xF8,
-    0xBE, 0x34, 0x3C, 0xDA, 0xD0, 0xDD, 0x0B, 0x83, 0xD2, 0xF9, 0xB0, 0x51, 0xD1, 0x44, 0xB8, 0x07,
-    0xEE, 0xAD, 0x6B, 0x44, 0xF3, 0x78, 0x86, 0xA1, 0x87, 0xCA, 0xAB, 0x4D, 0x3A, 0xF1, 0x67, 0x7E,
-    0x15, 0xB5, 0x44, 0xFC, 0xF4, 0xD1, 0x22, 0xF4, 0xF9, 0xFD, 0x3D, 0xA2, 0xF4, 0xDB, 0xA3, 0x15,
-    0x86, 0xCB, 0x42, 0xAC, 0xE8, 0x21, 0x70, 0x13, 0xB4, 0x85, 0x4A, 0xC0, 0x2E, 0xFB, 0xEE, 0x95,
-    0x7C, 0x03, 0x2B, 0x2D, 0x46, 0x50, 0x2D, 0x20, 0x33, 0x5F, 0x82, 0xB0, 0x76, 0xB0, 0x48, 0x4D,
-    0x58, 0x7A, 0x34, 0xCF, 0xEF, 0xC0, 0x6B, 0xBD, 0x52, 0x0A, 0x70, 0x62, 0x0E, 0x2B, 0xAB, 0xAC,
-    0x45, 0xE9, 0x6C, 0x44, 0x03, 0xAE, 0x7F, 0x04, 0xFB, 0xCD, 0x40, 0x43, 0x27, 0x56, 0x90, 0x7F,
-    0x27, 0xD5, 0xBF, 0xAF, 0x9C, 0x5F, 0xA4, 0xFE, 0x5F, 0xAB, 0xC7, 0xCE, 0xDF, 0x7D, 0x3A, 0x6F,
-    0x66, 0x05, 0xA6, 0x17, 0x5E, 0x82, 0x52, 0x5F, 0x67, 0xB2, 0xC6, 0x41, 0x3F, 0xAB, 0xD7, 0x7E,
-    0x04, 0x54, 0x58, 0x03, 0x8A, 0xE7, 0xBC, 0xF4, 0x07, 0xF3, 0x5C, 0xBC, 0x4A, 0xE7, 0x3F, 0x0F,
-    0x1A, 0xBF, 0x8C, 0x52, 0x3F, 0x5D, 0x52, 0x0F, 0x39, 0x0D, 0xC1, 0x03, 0x55, 0x92, 0xC9, 0x99,
-    0x91, 0xCB, 0x8C, 0x16, 0x81, 0xE7, 0xDF, 0x59, 0xB5, 0x67, 0x25, 0x95, 0x7A, 0xE2, 0xD6, 0x8F,
-    0x25, 0x2A, 0xED, 0x34, 0x76, 0xB5, 0x55, 0x3F, 0x67, 0xA3, 0xAB, 0x0C, 0x54, 0x77, 0x58, 0xA5,
-    0x16, 0x86, 0x8B, 0xC7, 0x99, 0x23, 0x5E, 0x85, 0x78, 0x18, 0xD4, 0xA0, 0xFB, 0xE6, 0x52, 0xBA,
-    0x41, 0x8C, 0xE2, 0xE0, 0x29, 0xC5, 0x5B, 0x73, 0x45, 0x1D, 0x36, 0x0C, 0xCB, 0x18, 0x81, 0x15,
-    0x35, 0x13, 0x0D, 0x33, 0x8E, 0x3E, 0xBC, 0x54, 0x2B, 0x49, 0x21, 0xD8, 0x54, 0x5F, 0xF0, 0x26,
-    0x40, 0xA1, 0x5F, 0xC2, 0x67, 0xF7, 0x6A, 0x02, 0x29, 0xE0, 0x05, 0x38, 0xB5, 0x30, 0xE5, 0xB4,
-    0x53, 0x0C, 0x9A, 0xC7, 0x6A, 0x1C, 0x54, 0x8C, 0xE7, 0x59, 0xF8, 0xD4, 0xC5, 0x69, 0x9C, 0x4F,
-    0xFD, 0xDA, 0xD5, 0x8D, 0x0A, 0xD6, 0x21, 0xC6, 0xB5, 0x3A, 0xFF, 0x51, 0xF9, 0x50, 0x18, 0xBA,
-    0xA5, 0x3E, 0x39, 0x0A, 0xBD, 0x97, 0x73, 0x3D, 0x3A, 0x1F, 0xBA, 0x15, 0xC4, 0x3C, 0x3C, 0x0A,
-    0x15, 0xDC, 0xC4, 0x5E, 0x1D, 0x1E, 0xAB, 0xC3, 0x97, 0xF4, 0x24, 0x30, 0xBD, 0xFF, 0x0B, 0x3C,
-    0xD3, 0x23, 0xDD, 0xD9, 0x99, 0x48, 0x33, 0x15, 0xF7, 0x22, 0x16, 0x05, 0x7D, 0xC2, 0xA5, 0xD3,
-    0x36, 0x62, 0x16, 0x5C, 0xDD, 0x39, 0xC1, 0xF8, 0xFB, 0x18, 0xCB, 0x78, 0xD9, 0xA4, 0x81, 0x04,
-    0xC9, 0x98, 0xF4, 0x65, 0x8C, 0x0C, 0x14, 0xD3, 0x21, 0xDC, 0xFF, 0x53, 0xC6, 0x02, 0xBC, 0x8B,
-    0xEF, 0x57, 0xA3, 0x51, 0xF8, 0xAD, 0x97, 0xFF, 0xDE, 0x34, 0x7F, 0x86, 0xDB, 0xFD, 0x7F, 0x05,
-    0xDA, 0x0D, 0x36, 0x6B, 0x01, 0x83, 0x57, 0x2B, 0x15, 0x8F, 0x95, 0x0B, 0xC4, 0x3B, 0x49, 0x52,
-    0xC2, 0x13, 0xF6, 0x93, 0xC6, 0x54, 0xA2, 0x77, 0x64, 0x5E, 0xE8, 0x5C, 0x10, 0xEA, 0xD7, 0xDB,
-    0x06, 0x56, 0x49, 0x48, 0x87, 0x33, 0xD5, 0xD8, 0x60, 0x36, 0x31, 0x96, 0xDF, 0x12, 0xF5, 0xAA,
-    0x42, 0xE2, 0x4B, 0xA0, 0x1E, 0x2F, 0x9E, 0xF5, 0xA2, 0x55, 0x81, 0x07, 0x7D, 0x9B, 0x03, 0x28,
-    0x84, 0xD7, 0x38, 0xD9, 0x71, 0x29, 0x31, 0xA6, 0x5E, 0x02, 0x46, 0xA1, 0xF6, 0x5B, 0x89, 0x3C,
-    0x31, 0xF6, 0xE4, 0xB7, 0xA1, 0x84, 0xD1, 0x19, 0x7F, 0x81, 0x4E, 0x4C, 0x44, 0xBB, 0x6D, 0x07,
-    0xD3, 0x73, 0x79, 0x7C, 0x63, 0x63, 0x60, 0x36, 0x00, 0x68, 0x09, 0xDB, 0x93, 0x38, 0x9D, 0x9E,
-    0x80, 0xDB, 0xBC, 0xA8, 0x68, 0xDB, 0xFC, 0xEA, 0x30, 0x0C, 0x1A, 0x2C, 0x76, 0x0E, 0x97, 0x51,
-    0x31, 0x7C, 0xC5, 0x08, 0x86, 0x57, 0x4F, 0x25, 0x3C, 0xEA, 0xFC, 0x9A, 0xAE, 0xBA, 0xB6, 0xEF,
-    0xA2, 0xB6, 0xC1, 0x2B, 0x49, 0x69, 0x8E, 0x8C, 0x39, 0xF0, 0x1D, 0x39, 0x91, 0x1E, 0x53, 0xEB,
-    0x44, 0xBD, 0x09, 0x23, 0xF5, 0xBB, 0xE5, 0x3A, 0x22, 0xFB, 0x42, 0x27, 0x9F, 0xD7, 0x41, 0x14,
-    0xDB, 0x43, 0xAC, 0x6E, 0x9E, 0xD6, 0xD6, 0x38, 0x0F, 0xC8, 0x36, 0xB4, 0x68, 0x48, 0x17, 0x2B,
-    0x2B, 0x8C, 0x6D, 0xF1, 0x89, 0xE1, 0x60, 0xC4, 0xFA, 0xDD, 0x18, 0xA5, 0x38, 0x7D, 0xF8, 0xC1,
-    0xBE, 0xB9, 0x7F, 0x6D, 0xCC, 0x63, 0xCA, 0xA9, 0x60, 0x00, 0xC0, 0x21, 0x99, 0x79, 0xB3, 0x86,
-    0x1D, 0xC0, 0x10, 0x62, 0xDB, 0xA8, 0x01, 0x0D, 0xBE, 0x73, 0x6B, 0x65, 0xE5, 0x99, 0x7B, 0xC0,
-    0xE7, 0xBF, 0x7A, 0x97, 0x49, 0x52, 0x0F, 0xB2, 0x05, 0xC3, 0xD9, 0x24, 0x50, 0x8C, 0xE0, 0x34,
-    0x70, 0x52, 0x08, 0xF4, 0xB2, 0x08, 0x2D, 0x88, 0xD9, 0x9C, 0x3F, 0xA5, 0xC1, 0x8B, 0x65, 0x9C,
-    0x67, 0x6D, 0xDC, 0x07, 0x0A, 0xFA, 0xFF, 0x1C, 0x24, 0x32, 0x30, 0x2F, 0xE9, 0xD1, 0x39, 0xFF,
-    0x87, 0xEA, 0x17, 0xEA, 0x5F, 0x96, 0x53, 0x3D, 0x26, 0x75, 0x1B, 0x34, 0x6F, 0x19, 0x0E, 0x34,
-    0x78, 0x4C, 0x16, 0x92, 0xF4, 0x0D, 0xB2, 0x48, 0xA0, 0x37, 0x48, 0xB5, 0xD7, 0x6E, 0xC4, 0x0C,
-    0xF2, 0x74, 0x46, 0xC0, 0xB1, 0xB1, 0xD9, 0x93, 0xC4, 0x32, 0x41, 0x6C, 0x63, 0x39, 0xA1, 0xF8,
-    0xA1, 0xE8, 0x5F, 0xEF, 0xB9, 0x69, 0xA3, 0x21, 0xAE, 0x0D, 0xAD, 0x05, 0x92, 0xA1, 0x53, 0x31,
-    0x9C, 0x52, 0x7C, 0x58, 0x7C, 0x64, 0x2E, 0x31, 0xDB, 0xBF, 0x65, 0xDE, 0x80, 0x0A, 0x32, 0xA7,
-    0xCC, 0x45, 0x53, 0xC7, 0xB4, 0x5C, 0x43, 0x68, 0xC8, 0xA9, 0xEE, 0x71, 0x50, 0xE9, 0x83, 0xE9,
-    0xD9, 0xAF, 0xA9, 0xC5, 0x90, 0xD9, 0x27, 0x3D, 0x55, 0x51, 0xC8, 0x6C, 0x18, 0x64, 0xC6, 0xBB,
-    0x3E, 0x25, 0x57, 0xA6, 0x96, 0x77, 0x82, 0x5E, 0x49, 0x90, 0x01, 0xCF, 0xAF, 0x39, 0x93, 0x79,
-    0xF0, 0xC9, 0xAC, 0x77, 0xFA, 0xE4, 0x67, 0x6D, 0xB6, 0xD9, 0x09, 0x03, 0x7F, 0x9D, 0x7D, 0x96,
-    0xB6, 0xFA, 0xE0, 0xB7, 0xCD, 0xE0, 0xEC, 0x1F, 0x32, 0x38, 0x44, 0x01, 0x43, 0x9A, 0x3B, 0x94,
-    0xA1, 0xDF, 0xDF, 0xA9, 0x8E, 0x66, 0x6E, 0xAA, 0xFE, 0x11, 0x96, 0x58, 0x3D, 0x05, 0x4E, 0x00,
-    0x3A, 0xD3, 0x3E, 0xA3, 0x08, 0x33, 0x38, 0xFB, 0x98, 0x58, 0x38, 0x9B, 0xF0, 0xC4, 0xF0, 0xA4,
-    0x75, 0x5C, 0x84, 0x5B, 0x4C, 0x00, 0x30, 0xD0, 0x76, 0x9D, 0x38, 0x88, 0x7C, 0xC3, 0xD9, 0xE6,
-    0xB0, 0x80, 0x1D, 0x05, 0xAA, 0xAA, 0xE8, 0x4A, 0xAB, 0xDC, 0x0E, 0x12, 0x12, 0x6F, 0xC2, 0x01,
-    0x66, 0x62, 0x25, 0xC1, 0x2A, 0x7B, 0x2D, 0x70, 0x4C, 0x92, 0x4B, 0x80, 0x0E, 0x2B, 0xAD, 0xB8,
-    0xE4, 0x38, 0xF9, 0xAA, 0x9B, 0x8F, 0xC3, 0x1C, 0x30, 0x79, 0x34, 0x56, 0x23, 0x40, 0x52, 0x4D,
-    0x5D, 0x3B, 0x14, 0x24, 0x68, 0xB5, 0xD1, 0xAA, 0x69, 0xAF, 0xD6, 0x92, 0xBC, 0x8D, 0xEA, 0x36,
-    0xC0, 0x82, 0x7E, 0x49, 0x5E, 0x43, 0x28, 0x02, 0xB6, 0x34, 0xC5, 0xB8, 0x33, 0x82, 0x8B, 0x4E,
-    0x05, 0xFF, 0xF1, 0x28, 0xBC, 0xDA, 0xD3, 0x40, 0xE6, 0xE1, 0x69, 0x78, 0x68, 0xE1, 0x6B, 0xA7,
-    0x41, 0xEE, 0x6B, 0xAB, 0xA0, 0xF0, 0xB5, 0x7E, 0xD0, 0x09, 0xC0, 0xE0, 0x68, 0xE6, 0xA1, 0x37,
-    0xE2, 0xF9, 0xD7, 0x40, 0xDF, 0xFC, 0x2B, 0x50, 0x44, 0xF3, 0xA7, 0x40, 0xE0, 0xFC, 0x8B, 0x30,
-    0x29, 0x07, 0x20, 0xD6, 0x14, 0xAA, 0xF6, 0xAB, 0xEA, 0x11, 0xB7, 0xF4, 0xAA, 0x11, 0x80, 0xF4,
-    0xA5, 0x48, 0x8D, 0x6F, 0x54, 0xDE, 0x95, 0x05, 0x35, 0x31, 0x90, 0x05, 0xF8, 0xB6, 0x26, 0xF7,
-    0x57, 0x13, 0xF5, 0xD3, 0x0F, 0xBB, 0xE0, 0xEF, 0x02, 0xBD, 0x06, 0x96, 0xF4, 0xAB, 0x40, 0xC7,
-    0xE6, 0xE5, 0x26, 0x34, 0x57, 0xE1, 0x1F, 0x30, 0x5F, 0x54, 0xFD, 0xBE, 0xF2, 0x45, 0x83, 0x81,
-    0x1E, 0xF2, 0x8C, 0xAC, 0x76, 0xE0, 0x44, 0xA7, 0x7B, 0xA2, 0x9A, 0x53, 0x40, 0x85, 0x18, 0x42,
-    0x17, 0x5C, 0x02, 0x03, 0xDC, 0xC6, 0xD7, 0x0A, 0x8A, 0xB5, 0xB6, 0xEB, 0x42, 0x80, 0xA1, 0x3A,
-    0x5A, 0x6F, 0x78, 0x80, 0xE1, 0x05, 0xC3, 0xCC, 0xA7, 0x86, 0x2B, 0x65, 0x84, 0xF5, 0x0B, 0x70,
-    0x7E, 0xE3, 0x37, 0xFB, 0x57, 0x56, 0x99, 0xA4, 0x94, 0x4C, 0x97, 0xCD, 0xF7, 0x58, 0xE2, 0x55,
-    0xF8, 0x86, 0x68, 0x56, 0xD1, 0x2B, 0x7D, 0xB7, 0x13, 0xC6, 0x89, 0x44, 0xBC, 0x32, 0x71, 0xA4,
-    0x44, 0xB7, 0x5A, 0x0D, 0x1B, 0xAF, 0x8A, 0x99, 0x4D, 0x98, 0x9E, 0x6C, 0xD9, 0x72, 0x38, 0xD4,
-    0x50, 0x04, 0xA8, 0x1C, 0x11, 0x95, 0x8E, 0x69, 0x9E, 0x58, 0x49, 0xCF, 0x86, 0x92, 0x72, 0x3D,
-    0x0F, 0xEC, 0x37, 0xA6, 0xFF, 0x03, 0x7D, 0xE2, 0x5D, 0x49, 0x6D, 0x18, 0xD4, 0xEA, 0x77, 0x3E,
-    0x0A, 0xE3, 0xA3, 0x07, 0xBB, 0xC8, 0xA0, 0x0D, 0xEE, 0x04, 0xA0, 0x1E, 0x7E, 0x80, 0x35, 0x36,
-    0xCB, 0xB8, 0x87, 0xC5, 0x56, 0xEB, 0x41, 0x0D, 0xE5, 0x0D, 0x53, 0x12, 0xD4, 0x70, 0x40, 0xE2,
-    0x97, 0x70, 0x6B, 0x23, 0xA8, 0x6D, 0xDE, 0x3B, 0xAC, 0x0B, 0x9A, 0x05, 0xFA, 0xE8, 0x01, 0x90,
-    0xA6, 0xF8, 0x82, 0xDA, 0x0C, 0xAE, 0x25, 0x05, 0x04, 0x0A, 0xF1, 0xDA, 0xCA, 0x2A, 0x47, 0x9A,
-    0x6C, 0xF2, 0x5B, 0xA1, 0x7C, 0x0B, 0x3F, 0x6C, 0x31, 0xF1, 0x89, 0xB6, 0xA8, 0x6B, 0x10, 0x9E,
-    0xD1, 0x77, 0xD5, 0x23, 0xB0, 0x0D, 0xCF, 0xE4, 0x2E, 0x34, 0x61, 0xBB, 0xA6, 0x26, 0x87, 0x55,
-    0xF8, 0x4A, 0xEE, 0xBD, 0xA3, 0xD5, 0x50, 0x9E, 0x75, 0xC9, 0x98, 0x1B, 0xDA, 0xE9, 0x3A, 0xE6,
-    0x89, 0xC2, 0x4B, 0x25, 0xF5, 0xEB, 0x97, 0xD1, 0xC1, 0x00, 0xB8, 0xE8, 0x70, 0xE2, 0x7B, 0x34,
-    0xCF, 0xC6, 0x88, 0x39, 0x5E, 0xF9, 0xB1, 0xA4, 0xD4, 0x44, 0x11, 0xCF, 0x44, 0x8F, 0xEF, 0xB9,
-    0xC8, 0xE5, 0xA2, 0xDD, 0xB9, 0xA8, 0xE5, 0xA2, 0xB7, 0xC5, 0x2A, 0xB5, 0x64, 0x7F, 0xEF, 0xBA,
-    0x60, 0x9E, 0x8D, 0xD6, 0xD2, 0x31, 0x32, 0x89, 0xD1, 0xA7, 0x2E, 0x7C, 0x7B, 0xB1, 0x80, 0xD5,
-    0x7B, 0x3B, 0x77, 0xCD, 0x6C, 0x11, 0xFA, 0xDC, 0x2F, 0xE9, 0xDC, 0xDB, 0x13, 0x0D, 0xDF, 0x07,
-    0x3E, 0xAB, 0x04, 0xA9, 0xA1, 0x3F, 0xA1, 0x0C, 0x87, 0x93, 0xCA, 0xD3, 0x12, 0x4E, 0x64, 0xFA,
-    0x5C, 0x4E, 0xB6, 0x61, 0xA3, 0x78, 0xD6, 0x9E, 0x55, 0xB6, 0xB3, 0x39, 0x06, 0xFF, 0x26, 0xD6,
-    0x00, 0xE4, 0x62, 0x0A, 0xA4, 0x50, 0x88, 0xFE, 0x13, 0xD9, 0xD1, 0xDA, 0x9B, 0x52, 0xF5, 0x3F,
-    0x38, 0x83, 0xAF, 0xB0, 0x1E, 0x00, 0x1F, 0xB4, 0xBE, 0x4E, 0x48, 0x64, 0x82, 0x0F, 0xA0, 0x6A,
-    0xE0, 0x48, 0xA3, 0xF3, 0x86, 0xD9, 0x56, 0x35, 0x4E, 0xA4, 0xAC, 0xE8, 0xDB, 0xCC, 0xC9, 0x78,
-    0xF2, 0xC1, 0xA3, 0x9A, 0x5D, 0x85, 0x0D, 0xBB, 0xF2, 0xDE, 0x55, 0x2B, 0x2B, 0x2B, 0xF2, 0xF0,
-    0x99, 0x3C, 0xAF, 0x91, 0x67, 0x57, 0x84, 0xF6, 0x54, 0x90, 0x52, 0x5F, 0x44, 0x17, 0x4E, 0x9E,
-    0x5C, 0x93, 0x0A, 0x08, 0x89, 0x04, 0x46, 0x71, 0x9B, 0x11, 0x00, 0x18, 0xF6, 0xDB, 0x7D, 0x4A,
-    0xEC, 0x6A, 0xA0, 0x2E, 0xB2, 0x1C, 0x0B, 0x03, 0xFC, 0x11, 0x2B, 0x5B, 0xCF, 0x46, 0x01, 0x13,
-    0x17, 0xCC, 0x15, 0x55, 0x1B, 0x8A, 0xBB, 0x43, 0x05, 0x9E, 0x26, 0xA2, 0x85, 0x29, 0x97, 0x27,
-    0x9C, 0xE3, 0x3B, 0xF9, 0xBB, 0xA9, 0x45, 0x16, 0xB6, 0x2D, 0x6D, 0x4D, 0x99, 0xCD, 0x9D, 0x39,
-    0x1B, 0x7C, 0x38, 0x23, 0xB6, 0x13, 0xF4, 0x11, 0x4B, 0xB6, 0xC1, 0xAD, 0x03, 0xCE, 0xFB, 0x11,
-    0xD0, 0x03, 0x4F, 0x5C, 0x30, 0x68, 0x90, 0x4F, 0xF0, 0x91, 0x0F, 0x6C, 0xE8, 0x97, 0xCC, 0xFA,
-    0x3A, 0x0D, 0x2B, 0x64, 0x54, 0x82, 0xC9, 0x89, 0xCA, 0xF0, 0x83, 0xEE, 0x41, 0xAF, 0x3F, 0x6A,
-    0x66, 0xF3, 0x4C, 0x70, 0x41, 0x62, 0x03, 0x69, 0x01, 0x68, 0x3E, 0x60, 0x90, 0x7E, 0x4E, 0x68,
-    0xF8, 0x26, 0xC5, 0x50, 0x40, 0xD1, 0x19, 0x99, 0xFB, 0x13, 0x58, 0xD5, 0xA8, 0x57, 0x8D, 0x53,
-    0x1F, 0xF2, 0xCB, 0x87, 0xD4, 0x91, 0x83, 0xC0, 0xE5, 0xF5, 0x82, 0x5B, 0xFA, 0x2F, 0xD5, 0xA1,
-    0x1A, 0x05, 0x70, 0xF2, 0x75, 0xA4, 0xD6, 0xE2, 0x74, 0xC9, 0xF9, 0xA4, 0xFD, 0xE7, 0xC0, 0xBA,
-    0x1F, 0xFC, 0x92, 0x9D, 0x1E, 0x95, 0xAC, 0xE9, 0x5F, 0x9D, 0xF9, 0x43, 0x65, 0x26, 0xC3, 0x9D,
-    0xCC, 0xE4, 0x3C, 0x2D, 0x87, 0x2F, 0xC0, 0xAC, 0x1C, 0xEC, 0x5D, 0xC6, 0xCC, 0x5A, 0xFA, 0x39,
-    0x83, 0x7B, 0xDA, 0x63, 0x42, 0x00, 0x06, 0xEE, 0xCF, 0x95, 0x7A, 0x41, 0x45, 0x95, 0xDA, 0x27,
-    0xE2, 0xD0, 0x70, 0x14, 0x5B, 0xE6, 0xFA, 0x35, 0x86, 0x64, 0xEF, 0x93, 0xE4, 0x9C, 0xFD, 0xA6,
-    0xD4, 0xA0, 0x10, 0xC2, 0x51, 0x08, 0xCA, 0x94, 0xC2, 0xA2, 0x22, 0x67, 0x81, 0xDF, 0x8E, 0x32,
-    0xD8, 0x29, 0xE6, 0x24, 0x2E, 0x2B, 0xA9, 0x25, 0x76, 0xEC, 0xEC, 0x1D, 0x17, 0x4C, 0xE1, 0x34,
-    0x62, 0xB7, 0xC1, 0x51, 0x41, 0xA5, 0x5C, 0x74, 0x73, 0x46, 0xC8, 0x08, 0xDE, 0x69, 0xA9, 0x6A,
-    0x61, 0xC0, 0xF2, 0x02, 0x04, 0xE2, 0xE1, 0x3D, 0x30, 0x6E, 0x04, 0x41, 0x80, 0xA4, 0x07, 0x9A,
-    0x9A, 0xEB, 0x34, 0x54, 0x9B, 0x11, 0xE4, 0x46, 0xA4, 0xAC, 0x07, 0x02, 0x04, 0x73, 0x76, 0x7B,
-    0x4F, 0x98, 0x48, 0xA6, 0x65, 0x94, 0xFC, 0x64, 0xD8, 0x89, 0x28, 0x00, 0x73, 0x4E, 0x59, 0x44,
-    0xD7, 0x29, 0x38, 0x4F, 0x31, 0x33, 0xB2, 0x9E, 0x5E, 0x52, 0x11, 0xA0, 0x5A, 0x8B, 0xEE, 0xAF,
-    0x48, 0x80, 0x92, 0xDD, 0x41, 0x4D, 0x12, 0x77, 0x47, 0x7B, 0x0F, 0x9F, 0x45, 0x5D, 0x7F, 0x5F,
-    0xEA, 0x1C, 0xA6, 0x69, 0xE9, 0xC1, 0xA9, 0xD7, 0xFB, 0x1F, 0x7D, 0x16, 0x75, 0x4F, 0x28, 0xF7,
-    0x3F, 0x69, 0x40, 0xA4, 0x34, 0x2C, 0x41, 0x5D, 0x00, 0xEA, 0xC6, 0xA4, 0x6E, 0xAC, 0xA2, 0x40,
-    0xA8, 0x0B, 0x61, 0x09, 0x2C, 0x75, 0x50, 0x3F, 0xB7, 0x31, 0xC5, 0xDF, 0x5F, 0xBD, 0x76, 0x76,
-    0x0F, 0x91, 0x3B, 0xC1, 0x25, 0x11, 0x7A, 0x41, 0xC1, 0x60, 0x44, 0x70, 0xCA, 0x3A, 0xBF, 0x41,
-    0xFF, 0x4A, 0x31, 0x37, 0x84, 0xFB, 0x2F, 0x73, 0xCE, 0x3E, 0x69, 0x6C, 0xE4, 0xC4, 0x3E, 0x9C,
-    0x21, 0xA9, 0x9D, 0x4C, 0xAE, 0xCD, 0x54, 0x80, 0xFC, 0xEC, 0x12, 0x35, 0xC5, 0x65, 0x1A, 0x1A,
-    0x1A, 0x98, 0x48, 0x43, 0x7E, 0xC1, 0xC1, 0x59, 0x19, 0xB2, 0xAA, 0x22, 0xB0, 0x51, 0x5E, 0xFC,
-    0x1D, 0x19, 0x62, 0x24, 0x52, 0xAF, 0xC8, 0xBF, 0x6F, 0xA8, 0xFD, 0x50, 0x11, 0x1A, 0x12, 0xA5,
-    0x16, 0x83, 0xDC, 0xFD, 0x25, 0x54, 0xD6, 0x92, 0x24, 0xFA, 0x05, 0xE5, 0xA7, 0x7C, 0xA4, 0xFB,
-    0x09, 0xD4, 0x4E, 0xC4, 0xC1, 0x42, 0x6F, 0xE9, 0x0D, 0xC9, 0x99, 0xFF, 0x89, 0x12, 0x36, 0xB0,
-    0x92, 0x40, 0x27, 0x0E, 0xF0, 0x25, 0x94, 0xE8, 0x74, 0xA7, 0x7E, 0x87, 0xD3, 0xB7, 0xE6, 0x7E,
-    0xC2, 0xA2, 0x48, 0x58, 0x83, 0x50, 0x2C, 0x83, 0x35, 0x0C, 0x43, 0xB6, 0x4F, 0xA2, 0x61, 0x7B,
-    0x4F, 0x9D, 0x74, 0x6E, 0x8E, 0x71, 0x47, 0x96, 0xDD, 0x3C, 0x89, 0xA1, 0x9D, 0x53, 0x35, 0x20,
-    0x4F, 0x7E, 0xD7, 0x65, 0x38, 0xB7, 0xC4, 0x0A, 0xC7, 0xA1, 0x9A, 0x73, 0x4F, 0xF1, 0x9A, 0x3A,
-    0xA0, 0x9C, 0xE3, 0xCC, 0x9A, 0x53, 0xA3, 0x53, 0xD1, 0x97, 0x87, 0x31, 0x6E, 0x22, 0x31, 0x38,
-    0xF1, 0x09, 0x2C, 0x0D, 0xD6, 0x02, 0x4B, 0xE3, 0x55, 0xBE, 0xD4, 0x4C, 0x40, 0x0B, 0xAE, 0xE6,
-    0x03, 0x05, 0xED, 0x76, 0x74, 0xEE, 0x8E, 0x1B, 0x50, 0xA3, 0xC1, 0xAA, 0xB2, 0x5E, 0x8B, 0x04,
-    0x97, 0xA7, 0xC3, 0x52, 0xAF, 0x39, 0xF5, 0xC9, 0xED, 0xD7, 0x53, 0x4E, 0x7D, 0xC4, 0xAD, 0x0F,
-    0x3D, 0x57, 0x07, 0x18, 0x21, 0xD4, 0x28, 0x90, 0xF7, 0xF0, 0x02, 0x57, 0xBF, 0x26, 0x94, 0x91,
-    0x38, 0x90, 0x31, 0x5E, 0x53, 0xDE, 0x2F, 0xEC, 0xE1, 0x7A, 0xAE, 0x26, 0xAD, 0x1C, 0x96, 0xBB,
-    0x91, 0xFF, 0xC1, 0x66, 0xD9, 0x67, 0xA3, 0xEC, 0xAA, 0x54, 0x7F, 0xDD, 0xD6, 0x71, 0x9B, 0x31,
-    0xAA, 0xE0, 0x95, 0x3B, 0x07, 0xD1, 0x6C, 0xBE, 0x7A, 0xE8, 0x05, 0xF5, 0x3E, 0x9B, 0x0F, 0x1E,
-    0x38, 0x78, 0xF2, 0xE2, 0xFB, 0xFF, 0x67, 0x19, 0xD8, 0xAB, 0x78, 0x5E, 0x5D, 0xD0, 0x5F, 0x8A,
-    0xD4, 0x8B, 0xFA, 0x01, 0x1B, 0xED, 0x39, 0x6C, 0x0F, 0xF1, 0x1D, 0x55, 0x75, 0x3C, 0x7C, 0xFC,
-    0x77, 0x39, 0x66, 0x0D, 0x8C, 0xD4, 0x26, 0x29, 0x2D, 0xD8, 0x28, 0xD9, 0x49, 0x93, 0xB0, 0xEC,
-    0x24, 0x91, 0xB2, 0x13, 0xA9, 0x29, 0x61, 0x36, 0xA2, 0xB1, 0x28, 0x6F, 0x38, 0x68, 0x3B, 0x06,
-    0xFD, 0x3D, 0x15, 0x65, 0x33, 0x86, 0xA3, 0x22, 0x1D, 0xC1, 0xBD, 0x5F, 0x8C, 0x53, 0xA9, 0xCF,
-    0x8B, 0xD1, 0x93, 0x16, 0x13, 0x69, 0x0F, 0x3E, 0x00, 0xC5, 0x06, 0x9C, 0xF2, 0x1D, 0x3F, 0x3C,
-    0x7B, 0x57, 0xFC, 0xDD, 0x9A, 0xCA, 0x0B, 0x93, 0xE9, 0xC3, 0x77, 0xA3, 0xB0, 0xA9, 0x66, 0x16,
-    0xA5, 0xCE, 0xF3, 0xAF, 0x50, 0x47, 0xB2, 0x08, 0x0F, 0xBA, 0xDE, 0xEB, 0x7F, 0x7C, 0x62, 0x50,
-    0x8B, 0xB6, 0x3E, 0x55, 0xB0, 0x9E, 0x15, 0x92, 0xB0, 0x4F, 0xF7, 0xA7, 0x14, 0xC2, 0x46, 0xAC,
-    0xBC, 0x24, 0x98, 0xE9, 0x73, 0xED, 0x96, 0xD3, 0x9C, 0x20, 0x4C, 0x83, 0xA2, 0x3D, 0x5A, 0x1F,
-    0x5F, 0x50, 0x27, 0xB5, 0x56, 0x47, 0xF0, 0xED, 0xEE, 0x51, 0x63, 0x7E, 0xC5, 0x39, 0x11, 0x74,
-    0x2A, 0x76, 0x20, 0xFD, 0x53, 0x89, 0x9C, 0xB3, 0x78, 0xC6, 0x2D, 0x76, 0x8C, 0x4B, 0x20, 0x35,
-    0xE8, 0xE2, 0x7A, 0xC5, 0x15, 0x26, 0x01, 0x76, 0x39, 0xC8, 0x5B, 0x26, 0xAE, 0xBD, 0x66, 0x5D,
-    0xED, 0x5B, 0x0E, 0x85, 0x4E, 0x31, 0x76, 0x98, 0xA9, 0x6B, 0xAF, 0xA6, 0x36, 0x76, 0x3F, 0x10,
-    0x6A, 0x13, 0x1F, 0xE2, 0x2C, 0xA9, 0xEC, 0xA6, 0x7A, 0x44, 0x59, 0x4A, 0x95, 0x58, 0x30, 0x5B,
-    0xF8, 0x03, 0x90, 0x7D, 0x66, 0x5B, 0x65, 0x5B, 0xD9, 0x55, 0x7B, 0x42, 0x15, 0x42, 0x7C, 0xAE,
-    0x22, 0x10, 0xBF, 0xA8, 0x9E, 0xD2, 0xE7, 0xD4, 0x88, 0xC4, 0x7F, 0xCD, 0x98, 0x7F, 0x74, 0xB6,
-    0x89, 0x6F, 0x85, 0xF8, 0xAF, 0x4A, 0x6D, 0x1E, 0xDD, 0x07, 0x97, 0x5D, 0xC3, 0xE0, 0xC8, 0xFB,
-    0x37, 0x95, 0x69, 0x0F, 0xF8, 0xE0, 0x9C, 0x14, 0xEA, 0x3A, 0xB5, 0x94, 0xE7, 0x7A, 0x66, 0x66,
-    0x4B, 0x5A, 0xEA, 0x6D, 0x12, 0xEE, 0xF9, 0xE7, 0xC3, 0xFC, 0x4B, 0x05, 0x76, 0x58, 0x51, 0xA5,
-    0xD5, 0x49, 0x4A, 0xFF, 0xA5, 0x9C, 0x05, 0xE4, 0xAD, 0x53, 0x0D, 0x4D, 0x16, 0x1E, 0x26, 0xEA,
-    0x2B, 0x79, 0x8D, 0xFD, 0xF6, 0x66, 0x98, 0x4B, 0x6D, 0x6B, 0x9C, 0x52, 0x39, 0x74, 0x16, 0xA6,
-    0xD5, 0xBB, 0x75, 0x85, 0xA1, 0x19, 0x12, 0xB3, 0x92, 0xC6, 0xB1, 0x07, 0x73, 0xBD, 0xC7, 0x21,
-    0x34, 0xC9, 0x4D, 0x1C, 0x00, 0x90, 0xDF, 0x31, 0x55, 0x68, 0x8E, 0xC1, 0xE1, 0xAD, 0x8A, 0x36,
-    0x34, 0x52, 0xF9, 0x72, 0x20, 0x95, 0x30, 0x77, 0x20, 0x11, 0x89, 0x45, 0x71, 0x9F, 0xD9, 0x4D,
-    0x2C, 0x6C, 0xB2, 0x2F, 0x55, 0xF7, 0xFB, 0x8B, 0xF2, 0x25, 0x2C, 0x56, 0x7C, 0xB4, 0x01, 0xFA,
-    0x4A, 0x7C, 0x72, 0xE0, 0x72, 0xF4, 0x0C, 0x7E, 0xD9, 0xAD, 0xB3, 0xF6, 0xA0, 0x27, 0xBA, 0x77,
-    0x85, 0x58, 0x4B, 0xAB, 0x2F, 0x6A, 0x99, 0x9E, 0xD1, 0x70, 0x3B, 0x66, 0xEB, 0x0A, 0xEF, 0xC5,
-    0xB7, 0x67, 0x2C, 0xAD, 0x79, 0xFE, 0xD7, 0x26, 0x8D, 0xDB, 0x62, 0xCB, 0x3C, 0x0D, 0x7F, 0xFC,
-    0x98, 0xF5, 0x8F, 0x22, 0x68, 0xFE, 0x29, 0xA3, 0x82, 0x10, 0x81, 0x17, 0x01, 0xB4, 0xA0, 0x92,
-    0xDA, 0x75, 0x11, 0xAF, 0x10, 0xDA, 0x64, 0xD2, 0x4A, 0xB9, 0x8E, 0xCF, 0x48, 0xFF, 0x5F, 0x9A,
-    0x74, 0x5D, 0x65, 0x30, 0x1C, 0x19, 0x6C, 0xF1, 0x34, 0x49, 0x1D, 0x80, 0x4D, 0xE6, 0x27, 0x19,
-    0x6C, 0x5D, 0x17, 0xA9, 0x77, 0x60, 0xE8, 0x59, 0xA7, 0xCF, 0x5A, 0xAD, 0x33, 0xEA, 0x1B, 0x0F,
-    0x7A, 0x2F, 0x55, 0x47, 0x46, 0xDE, 0xE9, 0xF4, 0x5F, 0xD4, 0xFE, 0x22, 0x70, 0x81, 0x7F, 0x2B,
-    0x3D, 0xBF, 0x1C, 0xA4, 0x6B, 0xE7, 0xBD, 0x4B, 0xE9, 0x21, 0xED, 0x72, 0x03, 0x44, 0x94, 0xE3,
-    0x67, 0xDF, 0x55, 0x2C, 0xEC, 0xA3, 0xF9, 0xB3, 0x8B, 0x10, 0xE5, 0xB1, 0x62, 0x6D, 0x1F, 0xCC,
-    0x7E, 0x0C, 0x43, 0xC5, 0x49, 0x48, 0x13, 0xC5, 0xF2, 0x3E, 0xC5, 0xDA, 0x3E, 0x39, 0xB1, 0x75,
-    0xA8, 0x7B, 0x4F, 0x96, 0x89, 0xB2, 0x6B, 0xCF, 0x6C, 0x02, 0xF9, 0xB5, 0x59, 0xCE, 0xCA, 0x64,
-    0x16, 0x46, 0xD9, 0x88, 0x0C, 0xF9, 0xDD, 0xB5, 0xE6, 0xCF, 0x5D, 0x39, 0x4B, 0xE3, 0x35, 0x0A,
-    0x21, 0x29, 0x00, 0x1F, 0xDA, 0xA9, 0x47, 0xCC, 0x8D, 0x1C, 0xF4, 0xCA, 0x20, 0x05, 0x51, 0x23,
-    0xD5, 0x84, 0x6A, 0xEA, 0x75, 0x13, 0x22, 0x31, 0x62, 0xD7, 0x52, 0x54, 0x94, 0x92, 0x3C, 0x4D,
-    0x58, 0x4A, 0x93, 0x6C, 0x37, 0xD5, 0xA7, 0x9B, 0x7C, 0x6F, 0x53, 0xDB, 0x66, 0x7B, 0x8B, 0xC2,
-    0xDE, 0x86, 0xEE, 0x86, 0x78, 0x16, 0x3B, 0x4D, 0xCB, 0xA6, 0xCB, 0x4A, 0xBB, 0xD1, 0xC1, 0xEF,
-    0x06, 0x93, 0xEB, 0x59, 0x37, 0x81, 0x70, 0x6F, 0x60, 0xFB, 0x6F, 0xA8, 0x47, 0xFC, 0xDC, 0xA9,
-    0xE1, 0x78, 0xD0, 0x01, 0xB1, 0x07, 0x0D, 0xEF, 0x83, 0xCE, 0x07, 0x64, 0x90, 0xAE, 0x07, 0x0F,
-    0x70, 0x3C, 0xE0, 0x6E, 0xC0, 0xED, 0xE8, 0xA6, 0x02, 0x27, 0x3A, 0x81, 0x2B, 0x71, 0x6B, 0x71,
-    0x90, 0xFA, 0x23, 0x8C, 0xC8, 0x36, 0x99, 0xF8, 0x4F, 0x03, 0x9C, 0x11, 0x48, 0x28, 0xB8, 0x55,
-    0xD0, 0xAF, 0x2C, 0x0F, 0x43, 0x50, 0x80, 0xA0, 0x8F, 0xAB, 0x47, 0x0E, 0x2A, 0xFF, 0xE5, 0x92,
-    0x30, 0x60, 0x6D, 0x51, 0xC5, 0x11, 0xD3, 0xF1, 0x4C, 0xC3, 0x4F, 0x31, 0x1A, 0xB0, 0xF2, 0xCF,
-    0x8C, 0xF9, 0xA8, 0x51, 0x1C, 0x4C, 0xAC, 0xC2, 0x9F, 0x95, 0x83, 0xA1, 0x80, 0xBE, 0x83, 0xE3,
-    0x42, 0x73, 0xB7, 0x06, 0x7B, 0xFA, 0x6F, 0x76, 0xCB, 0x0D, 0x61, 0x4C, 0x3F, 0x82, 0x1D, 0x3D,
-    0xA8, 0xBC, 0x0F, 0x71, 0xA0, 0x25, 0x6D, 0x9C, 0x5E, 0xC2, 0xE4, 0xFD, 0x86, 0xB5, 0x9A, 0x93,
-    0xFB, 0x1D, 0x2A, 0xC1, 0x9F, 0x04, 0x9B, 0x5E, 0xFA, 0xA5, 0xA7, 0x9C, 0xAD, 0xF4, 0xB1, 0x23,
-    0xCE, 0x56, 0xFE, 0xD8, 0x11, 0x77, 0xAB, 0x5A, 0x8F, 0x4C, 0x95, 0xFD, 0x5B, 0x3A, 0x36, 0x3D,
-    0xE9, 0xAE, 0x09, 0x67, 0x06, 0xA5, 0x48, 0xA7, 0x05, 0xE8, 0xC7, 0xD0, 0x01, 0x26, 0x02, 0xF3,
-    0x7B, 0x7A, 0x10, 0x70, 0x68, 0x28, 0x97, 0x46, 0x33, 0x7E, 0x5B, 0x74, 0x6A, 0xD9, 0xA8, 0xA4,
-    0x50, 0x71, 0x56, 0x45, 0x57, 0xCA, 0xE0, 0xED, 0x36, 0xBC, 0xA1, 0xDD, 0xD6, 0x78, 0x1F, 0xCF,
-    0xD4, 0x46, 0xFC, 0x66, 0x97, 0xA5, 0xF1, 0xCB, 0x9D, 0x89, 0xAA, 0xB0, 0x36, 0xC5, 0x33, 0xAD,
-    0xD7, 0x45, 0xE6, 0x62, 0xAF, 0xA0, 0x43, 0xEA, 0x22, 0x4F, 0xCA, 0xA2, 0x89, 0x75, 0xA8, 0xC3,
-    0x2E, 0xEC, 0xBC, 0xCE, 0x83, 0xCB, 0x01, 0xB6, 0xCE, 0xF0, 0x34, 0x2E, 0x6D, 0xC2, 0xAA, 0x4F,
-    0x0B, 0xD0, 0x6C, 0x71, 0xE4, 0x30, 0xD1, 0xDB, 0x85, 0x85, 0x85, 0x2D, 0x28, 0x2B, 0x77, 0x15,
-    0x3F, 0x26, 0x5E, 0xE0, 0x47, 0xE5, 0x74, 0x80, 0xA4, 0x05, 0xFA, 0x4A, 0xCA, 0xA4, 0x8A, 0xF4,
-    0xC1, 0x2E, 0x9C, 0xFA, 0x57, 0xBE, 0x75, 0xC5, 0xB9, 0xF1, 0xCE, 0x8D, 0x6A, 0x71, 0x7A, 0xB3,
-    0x89, 0xA2, 0x6E, 0x29, 0xD8, 0x34, 0xD1, 0x4B, 0x3A, 0x7B, 0xA6, 0x9E, 0x86, 0x17, 0xDB, 0xD8,
-    0xAD, 0x0B, 0x88, 0x3F, 0x03, 0x86, 0xE2, 0x1D, 0x0C, 0x59, 0x42, 0x09, 0xA8, 0xB8, 0xF5, 0x81,
-    0xF0, 0x54, 0xDD, 0x4E, 0xC2, 0x53, 0xD4, 0xE9, 0x17, 0xF5, 0x34, 0x0E, 0xA4, 0x29, 0xE1, 0xA0,
-    0xC0, 0x45, 0x79, 0x8C, 0x61, 0xAB, 0xF0, 0xD5, 0xB5, 0x6D, 0x56, 0xDE, 0xB8, 0x9F, 0xEA, 0xFB,
-    0x23, 0x95, 0xF4, 0x7B, 0xFF, 0xD9, 0x4B, 0x8F, 0xA8, 0x17, 0xBC, 0x2A, 0x92, 0xB2, 0x37, 0xC6,
-    0xDC, 0x1F, 0xDE, 0x4B, 0xC6, 0x6F, 0x5F, 0x01, 0x45, 0x1C, 0xA7, 0x12, 0xC2, 0xEC, 0xEC, 0x28,
-    0x9B, 0xA7, 0xBB, 0x7F, 0xE2, 0x11, 0xD6, 0x51, 0x9A, 0xB9, 0x6D, 0x00, 0x49, 0x34, 0xDE, 0x5E,
-    0x5A, 0xF6, 0xDF, 0xFC, 0x42, 0xC5, 0x5D, 0x83, 0xD7, 0x36, 0x04, 0x2E, 0x44, 0x27, 0x99, 0x6B,
-    0x3F, 0x1A, 0xAA, 0x06, 0x41, 0xAE, 0x2D, 0xCA, 0x4D, 0x2C, 0xA7, 0x2D, 0x09, 0x8F, 0xA8, 0x4E,
-    0xCA, 0x4E, 0x5C, 0x96, 0xAE, 0x11, 0x7C, 0xC8, 0x21, 0xA8, 0xE4, 0x00, 0x84, 0x2B, 0x05, 0x82,
-    0xA9, 0x1C, 0x12, 0x09, 0x5C, 0x51, 0xB0, 0xB4, 0x18, 0xE3, 0xED, 0x42, 0xFD, 0x9B, 0x52, 0xF3,
-    0x2D, 0xF5, 0x75, 0x5A, 0xC2, 0x26, 0x51, 0x65, 0xC3, 0xF1, 0x25, 0x0F, 0x7B, 0x32, 0x11, 0x0E,
-    0x28, 0x99, 0x7F, 0x3B, 0xE4, 0xDE, 0x13, 0xB3, 0x71, 0x54, 0x07, 0xEF, 0x15, 0x8D, 0x7A, 0x0A,
-    0xE3, 0xAB, 0xD5, 0xE8, 0xB0, 0x0A, 0xFF, 0x61, 0x75, 0x36, 0xE2, 0x0F, 0xFA, 0x91, 0x0A, 0xDE,
-    0x3B, 0xCE, 0x02, 0x8B, 0x52, 0x36, 0x51, 0x89, 0xD0, 0x67, 0x76, 0x7B, 0x82, 0x79, 0xF5, 0x87,
-    0xD1, 0x00, 0x9B, 0x3E, 0x41, 0x8B, 0x81, 0xBF, 0x63, 0xCE, 0xC0, 0x72, 0x13, 0xCA, 0x4F, 0xBE,
-    0x53, 0x11, 0x33, 0xCF, 0xE7, 0xBB, 0x0F, 0x1C, 0xB6, 0x2D, 0x54, 0x77, 0x6D, 0x68, 0x60, 0xB0,
-    0xCC, 0x6A, 0xA6, 0x3B, 0x36, 0x29, 0xB6, 0x3B, 0x5B, 0x1D, 0x6A, 0xF2, 0xDE, 0x53, 0x96, 0xF7,
-    0xA2, 0x7B, 0xF1, 0x9E, 0x68, 0xE7, 0x2F, 0x50, 0x64, 0xE6, 0x9A, 0x33, 0x98, 0xBA, 0x0A, 0xA3,
-    0x38, 0xFA, 0xDE, 0xBC, 0x4D, 0x0E, 0x0D, 0x55, 0x78, 0x07, 0xE6, 0xF9, 0x5B, 0x73, 0x6D, 0xE9,
-    0x31, 0xB8, 0x20, 0x5A, 0x9D, 0xF7, 0xF2, 0x4C, 0x42, 0xCE, 0x5F, 0x63, 0x89, 0xB7, 0xFC, 0x08,
-    0x4A, 0xD6, 0x95, 0x1F, 0x45, 0x3B, 0x3F, 0x52, 0xF6, 0x47, 0xFD, 0x3A, 0xD4, 0x69, 0x59, 0xAB,
-    0x35, 0x1F, 0x06, 0x39, 0x2E, 0x4A, 0x35, 0xBF, 0x5D, 0x03, 0xEC, 0xB4, 0x7E, 0x15, 0xE5, 0x1B,
-    0x2C, 0x23, 0xBC, 0x23, 0x15, 0x7E, 0xC7, 0x38, 0x6E, 0x32, 0x70, 0x4C, 0x20, 0x7E, 0xF0, 0x59,
-    0x32, 0xCA, 0x6C, 0xBB, 0xF2, 0xC0, 0x79, 0xF6, 0x06, 0x67, 0xA4, 0xFF, 0x1F, 0x97, 0x59, 0xD9,
-    0xAB, 0x82, 0xF4, 0x88, 0x0F, 0x3D, 0xD9, 0x72, 0x21, 0x3F, 0x3F, 0x49, 0x01, 0x48, 0x32, 0x45,
-    0x1D, 0x5E, 0x37, 0xF0, 0x5B, 0x75, 0x5C, 0x15, 0xBB, 0x0F, 0xEE, 0xC4, 0x39, 0xF2, 0xB4, 0x70,
-    0x60, 0x54, 0xCA, 0x27, 0xC5, 0xB1, 0xFB, 0xC8, 0xE4, 0xFF, 0x5F, 0x3B, 0x4F, 0x76, 0x4A, 0xAC,
-    0xA9, 0x5F, 0x45, 0xA3, 0x70, 0x74, 0x2C, 0x1C, 0x4F, 0xCA, 0xFB, 0xE1, 0xC5, 0xFB, 0x97, 0x16,
-    0x7E, 0x7B, 0x4F, 0x69, 0x61, 0xBD, 0x5B, 0x5A, 0xD8, 0x7C, 0x9E, 0xD2, 0x42, 0x7F, 0x4F, 0x69,
-    0x61, 0x94, 0x4E, 0x83, 0x3A, 0x39, 0x86, 0xB9, 0x31, 0xD6, 0xC0, 0xD8, 0xBF, 0x47, 0xFB, 0x14,
-    0xEC, 0xB7, 0xFF, 0xC4, 0xBC, 0x8D, 0xD7, 0x58, 0x7E, 0xF7, 0xD1, 0x8B, 0x86, 0xC4, 0x48, 0xA6,
-    0x86, 0x2B, 0xD0, 0x8A, 0x9F, 0x17, 0xFC, 0x2F, 0xE5, 0xDF, 0x78, 0xEF, 0xB9, 0x56, 0x84, 0xA4,
-    0x73, 0xAD, 0x37, 0x14, 0xAB, 0x8E, 0xDB, 0x28, 0x8E, 0xCE, 0xF6, 0x6E, 0xC9, 0x04, 0x54, 0x79,
-    0x38, 0x90, 0x18, 0x30, 0x5E, 0x01, 0x2D, 0x9A, 0xF3, 0x37, 0x8A, 0x59, 0x17, 0x0F, 0xEB, 0x92,
-    0xFF, 0x45, 0x91, 0x66, 0x46, 0xCD, 0xC3, 0xA8, 0x12, 0xEE, 0x34, 0x14, 0x34, 0xBB, 0x93, 0x52,
-    0x54, 0xA4, 0x77, 0x53, 0x42, 0x89, 0x04, 0x19, 0xAD, 0x38, 0xC2, 0xDD, 0x03, 0x50, 0x44, 0xFF,
-    0xA5, 0xCB, 0xB8, 0x21, 0x4B, 0xBB, 0xB2, 0x70, 0x5F, 0xF8, 0x87, 0xD6, 0xFD, 0xE2, 0x1C, 0x66,
-    0xE6, 0xC7, 0x9F, 0x5A, 0x03, 0x74, 0x25, 0x5E, 0x7D, 0xC4, 0x44, 0x88, 0xC9, 0x19, 0xBC, 0x24,
-    0x46, 0x65, 0x1E, 0x8F, 0x7B, 0x6B, 0x02, 0x6E, 0xE0, 0x4B, 0x32, 0xAF, 0x75, 0x5B, 0x48, 0x4C,
-    0xB8, 0xA5, 0xE3, 0xBC, 0x88, 0xAA, 0xC2, 0x6B, 0x60, 0x2A, 0xE2, 0x0B, 0xF0, 0x50, 0x66, 0x7E,
-    0x1B, 0xFD, 0x4C, 0x47, 0x75, 0x96, 0xA4, 0xD9, 0x8B, 0x7D, 0xC7, 0xBD, 0x35, 0x15, 0x37, 0xF0,
-    0x11, 0x4D, 0xB5, 0xDC, 0xC0, 0x57, 0x3A, 0x56, 0xCA, 0x9E, 0x90, 0x72, 0xE3, 0x3D, 0xCA, 0x08,
-    0xAA, 0x6C, 0xAB, 0x74, 0xA0, 0xE3, 0x26, 0x5B, 0x65, 0xF0, 0xDF, 0x46, 0xCE, 0x47, 0x5B, 0xE5,
-    0xF8, 0xD0, 0x38, 0xB8, 0x78, 0xB5, 0xD2, 0x87, 0xC7, 0x13, 0xEF, 0xEA, 0xDB, 0xE5, 0x64, 0xDC,
-    0x78, 0x57, 0x0D, 0x9C, 0xE7, 0xD2, 0xBB, 0xDA, 0x72, 0x67, 0x1F, 0x54, 0x54, 0x54, 0xC2, 0xAE,
-    0x64, 0x40, 0xC6, 0x90, 0x60, 0xFD, 0x4F, 0xB0, 0x0F, 0x31, 0x28, 0x13, 0x35, 0x03, 0x25, 0x74,
-    0xD2, 0xFC, 0xE6, 0x77, 0x2A, 0xD8, 0x18, 0x10, 0x2D, 0x2D, 0xA6, 0x34, 0xCC, 0xD3, 0x26, 0x2F,
-    0xF6, 0x77, 0x58, 0xF4, 0x3F, 0xF2, 0x7E, 0x19, 0xB5, 0xE4, 0xEA, 0x80, 0x43, 0x83, 0x3A, 0xD1,
-    0xD9, 0x9E, 0xC5, 0xFA, 0xAD, 0x6B, 0x46, 0xC1, 0x6F, 0x12, 0x41, 0x80, 0x13, 0xC7, 0xCC, 0x53,
-    0x1E, 0x34, 0x50, 0x48, 0xF1, 0x05, 0xE6, 0x38, 0x80, 0xDF, 0x87, 0x5A, 0x05, 0xBB, 0xCF, 0x61,
-    0x85, 0x69, 0x5C, 0xFF, 0x2A, 0x73, 0x39, 0x4C, 0xE3, 0x5C, 0x36, 0xA9, 0xBF, 0x5B, 0xB4, 0xE0,
-    0xD0, 0x62, 0xFA, 0xE4, 0xDD, 0xFD, 0x3F, 0x4D, 0x2D, 0x19, 0xA6, 0x0E, 0xDF, 0x9D, 0x3F, 0xAA,
-    0x99, 0x58, 0xE6, 0xF3, 0x27, 0xE8, 0xE6, 0xC6, 0x7B, 0x73, 0x19, 0x23, 0x2D, 0x8D, 0x5A, 0x8F,
-    0x7A, 0xA8, 0x23, 0xD3, 0x90, 0x0C, 0x7F, 0x98, 0x4B, 0xAE, 0x19, 0x17, 0x0D, 0xC6, 0x25, 0x4B,
-    0x9D, 0x3E, 0x68, 0xD4, 0x67, 0xFD, 0x31, 0x7D, 0x45, 0x39, 0x8B, 0x09, 0x54, 0x80, 0x35, 0x53,
-    0x18, 0xA9, 0x0E, 0x2E, 0x63, 0xF8, 0x66, 0xB3, 0x5D, 0x5F, 0x61, 0x24, 0x12, 0x7C, 0x6B, 0xF5,
-    0x46, 0xC3, 0x39, 0xCE, 0x55, 0xF0, 0x0E, 0xD6, 0x6F, 0x16, 0x31, 0x84, 0xB8, 0x3D, 0xC3, 0x74,
-    0x0E, 0x2B, 0x29, 0x58, 0x51, 0x3F, 0xF8, 0x91, 0xDA, 0xE6, 0x9A, 0x2A, 0xBB, 0xF7, 0xE3, 0xF7,
-    0xF7, 0xB2, 0x2F, 0xB3, 0xFF, 0xCB, 0x26, 0x92, 0xBC, 0xB9, 0x54, 0x60, 0xA0, 0x97, 0xC9, 0xDC,
-    0x77, 0x3E, 0xA3, 0x02, 0xA3, 0x83, 0xDE, 0x8C, 0xCA, 0x0D, 0x90, 0xC7, 0x72, 0xE2, 0xBB, 0xAD,
-    0xD9, 0x1F, 0x6C, 0x97, 0x80, 0xE8, 0x8D, 0x30, 0x87, 0x9A, 0xF7, 0x75, 0x5C, 0xEE, 0xB1, 0x50,
-    0xFB, 0x58, 0x51, 0x58, 0x7B, 0x67, 0xA2, 0xF2, 0x61, 0x89, 0xC7, 0x73, 0xAB, 0x42, 0x49, 0x8F,
-    0xF0, 0x89, 0x55, 0xEB, 0xD1, 0x45, 0xA7, 0x52, 0x98, 0xA8, 0xEB, 0xDC, 0x10, 0x9F, 0xEE, 0xEF,
-    0x2D, 0x83, 0x3D, 0xB8, 0x6A, 0xB6, 0x8D, 0xD2, 0xB6, 0x69, 0x4B, 0xD5, 0x3E, 0xD0, 0x3A, 0x8D,
-    0x40, 0x13, 0xB7, 0x14, 0x2D, 0x81, 0xE2, 0x8E, 0xBB, 0x39, 0x01, 0x22, 0xF5, 0x92, 0xF8, 0xF0,
-    0x52, 0xA6, 0xC4, 0x3C, 0x58, 0x63, 0x33, 0xA0, 0x7B, 0xCB, 0x94, 0xF0, 0x98, 0x16, 0xCB, 0x57,
-    0xD2, 0x7F, 0x71, 0xCD, 0x2E, 0x68, 0xE7, 0x5C, 0x14, 0xE6, 0x6F, 0xEF, 0xB1, 0xE6, 0xBF, 0xE7,
-    0xE2, 0x5F, 0xC2, 0x58, 0x80, 0x0C, 0x55, 0x78, 0x70, 0x8A, 0xEE, 0x50, 0x53, 0x0F, 0x2A, 0xF5,
-    0xEF, 0x58, 0x0F, 0xB1, 0xA4, 0x18, 0xAC, 0x5F, 0x72, 0x1A, 0x57, 0x36, 0xFD, 0xF9, 0xF5, 0x44,
-    0x85, 0x30, 0x7D, 0xD1, 0xE9, 0xD2, 0x3E, 0xAC, 0x95, 0x9A, 0x43, 0x67, 0x7B, 0x54, 0xC3, 0xC3,
-    0x3A, 0x29, 0xB4, 0x29, 0xA8, 0x0E, 0x64, 0xDB, 0xC1, 0x9E, 0xC8, 0xCB, 0xBA, 0xDA, 0x70, 0x1B,
-    0x8F, 0x3A, 0x5A, 0xDF, 0xCB, 0xE0, 0x02, 0xD9, 0x45, 0x2C, 0x13, 0x66, 0xB5, 0x12, 0x68, 0x4B,
-    0x89, 0xD1, 0x19, 0xAC, 0x01, 0x63, 0x3B, 0x8C, 0x9E, 0x7C, 0xA2, 0x25, 0x1C, 0x13, 0x32, 0xF0,
-    0xD4, 0x58, 0xD7, 0x6B, 0x28, 0x25, 0x8E, 0x2B, 0xE6, 0x66, 0x7D, 0x46, 0x39, 0x8C, 0xAD, 0x08,
-    0xB3, 0x7A, 0x0B, 0x33, 0x26, 0xE1, 0x8D, 0x8C, 0xFB, 0x89, 0xCE, 0xDE, 0x51, 0xBC, 0xB6, 0xAB,
-    0x90, 0xB1, 0x86, 0xCC, 0x81, 0x81, 0x85, 0x69, 0x61, 0x97, 0xC4, 0x3E, 0xD1, 0xE2, 0x34, 0x04,
-    0x9B, 0x7A, 0x69, 0x28, 0x5A, 0xE2, 0x5A, 0xDA, 0xE8, 0x92, 0xFC, 0xE3, 0x84, 0xA2, 0x1A, 0x62,
-    0x20, 0xE2, 0x01, 0x08, 0xD4, 0x2E, 0x86, 0xFF, 0xA7, 0xC0, 0x45, 0xE5, 0xAA, 0xEE, 0x5D, 0xD6,
-    0x3F, 0x51, 0xEA, 0x2C, 0xAC, 0x38, 0x77, 0xAB, 0x48, 0xE8, 0x25, 0x49, 0x3F, 0x53, 0xBC, 0x1B,
-    0x25, 0xBB, 0x81, 0x62, 0x52, 0xD5, 0x42, 0x0A, 0x20, 0x07, 0xDC, 0x81, 0x39, 0xB8, 0x2E, 0xDC,
-    0x04, 0xB2, 0xCC, 0xFA, 0xD6, 0x59, 0x37, 0xEC, 0x65, 0xE0, 0xEE, 0x35, 0xBB, 0xB0, 0xB6, 0xEE,
-    0xA8, 0x1C, 0x52, 0x5E, 0x14, 0x63, 0xFA, 0x41, 0x8E, 0xFD, 0xE7, 0x0F, 0xA5, 0x9D, 0xB8, 0x5D,
-    0x85, 0x73, 0x2F, 0x71, 0x77, 0x72, 0xF5, 0xF8, 0xA7, 0x77, 0x6F, 0xF1, 0xB0, 0x38, 0x86, 0x23,
-    0x55, 0xA9, 0xF5, 0x09, 0xF7, 0xA0, 0xF9, 0xB3, 0x50, 0xDC, 0x98, 0x75, 0xA7, 0x78, 0xD9, 0xEE,
-    0xDE, 0x62, 0x81, 0xE0, 0xBA, 0xDD, 0xBD, 0xB5, 0x71, 0x3F, 0xF0, 0x21, 0x11, 0xBB, 0x23, 0x77,
-    0xBE, 0x16, 0xFC, 0x17, 0x3B, 0x0A, 0xDF, 0xC6, 0x48, 0x02, 0x04, 0xF6, 0xF5, 0xC5, 0xB7, 0x64,
-    0x77, 0xB6, 0xCE, 0x20, 0x90, 0x28, 0xA7, 0x1C, 0x98, 0x14, 0x98, 0x7B, 0xDE, 0x7C, 0x92, 0x3A,
-    0x95, 0x5A, 0x60, 0xE9, 0x50, 0xEE, 0xD6, 0xBB, 0x79, 0xE5, 0x0D, 0x96, 0xB4, 0xBC, 0xA0, 0xF6,
-    0x6A, 0x0C, 0xDA, 0x68, 0x6E, 0x33, 0xA4, 0x01, 0x87, 0xEC, 0xDC, 0x65, 0xC1, 0xEF, 0xFC, 0x7B,
-    0xE2, 0x65, 0x81, 0x3D, 0x07, 0x77, 0x36, 0x62, 0x05, 0x77, 0x6F, 0xC4, 0xB2, 0xFB, 0xB3, 0xA4,
-    0x0A, 0xE5, 0x8D, 0x6B, 0x45, 0xCA, 0xDB, 0x91, 0xDC, 0x3E, 0xB8, 0xBB, 0x11, 0x4B, 0x69, 0xDE,
-    0x06, 0x4D, 0xDD, 0xE2, 0x3E, 0x23, 0x1B, 0xB1, 0xA0, 0xDD, 0xDF, 0x26, 0x18, 0x31, 0xF3, 0xCC,
-    0xA8, 0xF7, 0x77, 0x59, 0x09, 0x75, 0x6F, 0x35, 0xED, 0x42, 0xFD, 0x3D, 0x7E, 0x67, 0x11, 0xB8,
-    0x9C, 0x9C, 0x80, 0xAF, 0x03, 0x85, 0x36, 0x8A, 0xD5, 0x61, 0x46, 0xEC, 0xCF, 0xB1, 0x1A, 0xFC,
-    0xD8, 0x05, 0xAD, 0x9A, 0x71, 0x34, 0x57, 0x78, 0x97, 0xB1, 0x9C, 0x4B, 0x50, 0x8B, 0x7E, 0xB5,
-    0x03, 0x53, 0xC0, 0x79, 0x60, 0x3F, 0x3C, 0xCB, 0x6D, 0x64, 0xD3, 0x43, 0x27, 0x80, 0x73, 0x59,
-    0x22, 0xF3, 0x71, 0x2A, 0x39, 0xD6, 0x0B, 0x12, 0x7E, 0xBA, 0xD1, 0xEC, 0x16, 0xB1, 0x59, 0x9F,
-    0x55, 0x18, 0xDF, 0x11, 0x20, 0xE5, 0x0D, 0x41, 0x5E, 0x4E, 0x8A, 0x6C, 0x4A, 0x54, 0xD9, 0xC5,
-    0x99, 0x7C, 0xC5, 0x70, 0x99, 0xE5, 0x1F, 0x7C, 0x74, 0xD0, 0x90, 0x0F, 0x73, 0x67, 0xA2, 0x69,
-    0xB0, 0x78, 0x81, 0xA8, 0x59, 0x1B, 0x96, 0x76, 0xB6, 0x43, 0xF3, 0x8F, 0xAB, 0xFD, 0xA9, 0xCF,
-    0xAC, 0xE6, 0x9A, 0x0B, 0x59, 0x80, 0x6C, 0x38, 0x5A, 0x4B, 0x20, 0xD5, 0x0A, 0xE0, 0xFA, 0x90,
-    0x26, 0xE0, 0x2E, 0xCD, 0x28, 0xB3, 0x9B, 0x86, 0x43, 0x58, 0x9D, 0xA0, 0x0E, 0x0D, 0xDD, 0x1F,
-    0xAD, 0xB6, 0xFF, 0x19, 0xC3, 0xFF, 0x03, 0x9D, 0x55, 0x3D, 0x6C, 0x1C, 0x45, 0x14, 0x7E, 0xBB,
-    0x43, 0x34, 0x51, 0x56, 0xF1, 0xA4, 0x08, 0x52, 0x0A, 0x9C, 0x4D, 0xE1, 0xC2, 0x44, 0x0E, 0x4B,
-    0xE1, 0xC2, 0x12, 0x67, 0xCF, 0x26, 0x41, 0x0A, 0x52, 0x24, 0x08, 0x85, 0x25, 0x44, 0x43, 0x93,
-    0x48, 0x74, 0xA6, 0x70, 0x41, 0x11, 0xFB, 0x56, 0x4A, 0x61, 0xBA, 0x44, 0x4A, 0x43, 0x99, 0x22,
-    0x95, 0xD3, 0x5C, 0x41, 0xE1, 0xE2, 0x60, 0x27, 0x76, 0x41, 0x91, 0x66, 0xED, 0x06, 0x21, 0x51,
-    0x2C, 0x21, 0x50, 0x8F, 0xC5, 0x46, 0x6C, 0x31, 0x7B, 0xC3, 0xF7, 0x76, 0xCF, 0xE7, 0x73, 0x64,
-    0x52, 0x30, 0xBA, 0xBB, 0x37, 0xF3, 0xE6, 0xE7, 0xBD, 0xF7, 0x7D, 0xEF, 0xBD, 0xBB, 0xBA, 0xBD,
-    0xAD, 0xBC, 0xDF, 0xF3, 0xDE, 0x5E, 0x9D, 0x9E, 0x6D, 0x3F, 0xF6, 0xDE, 0x8F, 0x34, 0x7E, 0xCA,
-    0x33, 0xAB, 0xAB, 0x84, 0x0D, 0xFF, 0x37, 0xBE, 0x35, 0x61, 0x40, 0xB1, 0x7A, 0x87, 0x84, 0xE7,
-    0xE1, 0x74, 0x2B, 0x0C, 0xD1, 0xDB, 0x77, 0x30, 0xD6, 0xE9, 0xF7, 0x42, 0x6C, 0xA5, 0x33, 0xB3,
-    0xB4, 0x3E, 0x08, 0x0E, 0x8C, 0xBC, 0x4D, 0xB3, 0x0B, 0x27, 0xA6, 0x36, 0xDC, 0x33, 0x91, 0xA2,
-    0x85, 0x1E, 0x0D, 0xA6, 0xA6, 0xA5, 0x30, 0xEC, 0xCF, 0x53, 0x7E, 0xEC, 0x0F, 0xFE, 0xC9, 0x26,
-    0x2F, 0x6E, 0x8F, 0xFD, 0xF4, 0x0F, 0xD9, 0xD9, 0x7C, 0xAB, 0xD6, 0x7B, 0x2E, 0x31, 0x8D, 0xB2,
-    0xF1, 0xE1, 0x28, 0x39, 0x70, 0xFA, 0x41, 0x95, 0xD3, 0x99, 0xCF, 0x79, 0x9A, 0xEC, 0xD5, 0xFD,
-    0xDB, 0x76, 0xEA, 0x44, 0xFE, 0xB0, 0xEA, 0xF3, 0x8A, 0x3F, 0xC9, 0xAE, 0x53, 0xFB, 0xD0, 0x8D,
-    0xE2, 0x43, 0x1F, 0xBF, 0x6C, 0xF8, 0xF8, 0x2E, 0x2E, 0xD7, 0xFA, 0x56, 0x95, 0x47, 0x76, 0xFA,
-    0x81, 0xFE, 0x8B, 0x5A, 0x59, 0x2F, 0x9C, 0x36, 0xD8, 0x88, 0xF7, 0x9D, 0xA8, 0x75, 0xE6, 0x95,
-    0x1D, 0xBB, 0x13, 0x94, 0x44, 0x97, 0x8F, 0x05, 0xD4, 0xF1, 0x09, 0xA1, 0x28, 0x00, 0x2C, 0x89,
-    0xF7, 0x05, 0xB5, 0x2B, 0xFA, 0x5F, 0x42, 0x40, 0x5C, 0x99, 0x40, 0x00, 0xA5, 0x30, 0xAD, 0xBE,
-    0x77, 0xEA, 0x02, 0x06, 0xFB, 0x80, 0xEC, 0x3F, 0x8F, 0x45, 0xDE, 0x0B, 0x26, 0xA9, 0x22, 0x5A,
-    0xC6, 0x4E, 0x4A, 0xA2, 0xA0, 0xF1, 0x22, 0x4A, 0x89, 0xB0, 0xB8, 0x38, 0xB1, 0x15, 0xF9, 0x11,
-    0x69, 0xEF, 0xF0, 0xA6, 0x95, 0xB8, 0x83, 0x40, 0x30, 0x6D, 0x70, 0xBD, 0x46, 0x7A, 0x94, 0x30,
-    0xB3, 0x0B, 0x1A, 0x54, 0xC7, 0xFC, 0x6B, 0x4C, 0x7F, 0xE9, 0xC8, 0x7A, 0x22, 0x2A, 0xD5, 0xE8,
-    0x6A, 0x24, 0x98, 0x38, 0xB5, 0x77, 0xE8, 0xF2, 0xF4, 0x48, 0xF0, 0x10, 0x96, 0x6A, 0x72, 0x9A,
-    0x62, 0xA3, 0x7E, 0xB6, 0xA1, 0x0B, 0xA0, 0xD7, 0x26, 0x29, 0xDE, 0x5F, 0x59, 0x19, 0x9B, 0x5D,
-    0x7C, 0x17, 0xBE, 0x5E, 0xC9, 0x82, 0x62, 0x2E, 0x13, 0xD9, 0xBD, 0x2C, 0xA2, 0x0F, 0xCD, 0x0C,
-    0x7D, 0x64, 0x7A, 0x14, 0xA7, 0xEB, 0x1D, 0x24, 0x61, 0xD1, 0x45, 0x04, 0xF7, 0x19, 0x79, 0x8E,
-    0x91, 0x76, 0x78, 0xEB, 0xE3, 0xEF, 0xC4, 0xCB, 0x2F, 0x9E, 0xCA, 0xDD, 0xF3, 0x9F, 0xA8, 0xEB,
-    0xDF, 0xFF, 0x96, 0x90, 0xDD, 0xE1, 0x68, 0xA6, 0xB2, 0xE3, 0x54, 0xC6, 0x5B, 0xAB, 0xE7, 0x68,
-    0x29, 0xCC, 0x56, 0xC2, 0x2A, 0xBE, 0x61, 0x55, 0x56, 0xC7, 0xB4, 0x13, 0x99, 0x4A, 0x9A, 0x9E,
-    0xCC, 0xE6, 0xD9, 0x5A, 0x4B, 0xB7, 0xD9, 0x0C, 0xB1, 0xB7, 0x4C, 0xE0, 0x9B, 0xDE, 0x93, 0xE9,
-    0x8A, 0x32, 0xF1, 0xCD, 0x22, 0x7A, 0x6E, 0x45, 0xB1, 0x43, 0x83, 0x85, 0xF6, 0xCC, 0x37, 0x92,
-    0xE6, 0x65, 0xA9, 0xC3, 0x2A, 0x32, 0x1B, 0x02, 0x87, 0x87, 0xA2, 0x50, 0x84, 0x77, 0x66, 0x68,
-    0x20, 0xBB, 0xF0, 0x7B, 0x14, 0xD6, 0x74, 0xED, 0x5B, 0x51, 0x0E, 0xBB, 0x57, 0xCF, 0xD3, 0x46,
-    0x80, 0xD3, 0x09, 0xE9, 0x54, 0x15, 0xA2, 0x22, 0x87, 0x13, 0x67, 0x2F, 0xD0, 0x22, 0xAD, 0x90,
-    0xCA, 0x42, 0x4B, 0x43, 0x6A, 0x44, 0xAD, 0xCA, 0x24, 0x9D, 0xA5, 0x77, 0xE8, 0x38, 0x0D, 0x10,
-    0x7D, 0x7B, 0x78, 0x44, 0x71, 0x11, 0x1B, 0x6D, 0x28, 0xBF, 0xD1, 0x20, 0x12, 0xE1, 0x28, 0x6C,
-    0xB0, 0x6D, 0x89, 0xD1, 0x06, 0xAE, 0xF0, 0x35, 0xF0, 0xD2, 0x31, 0x9B, 0x8D, 0x07, 0x14, 0xA9,
-    0x46, 0x36, 0xC2, 0x03, 0x5F, 0x85, 0x95, 0xCE, 0xA4, 0x27, 0x7D, 0x13, 0x04, 0x57, 0x02, 0x85,
-    0x8E, 0x1D, 0x9D, 0x71, 0xE5, 0x33, 0x49, 0xFE, 0x33, 0xBE, 0x03, 0x96, 0x81, 0x4E, 0xE2, 0x42,
-    0x64, 0x4C, 0xE4, 0xB1, 0x47, 0x3C, 0xD3, 0x35, 0xE5, 0x55, 0x82, 0xCD, 0x78, 0x24, 0x90, 0x19,
-    0xA0, 0x59, 0xB7, 0xB1, 0xC9, 0x7A, 0xE2, 0x5F, 0x90, 0xF5, 0xA4, 0xB9, 0x2F, 0xCD, 0x30, 0xE2,
-    0x8F, 0x53, 0x47, 0x9F, 0xF8, 0xB9, 0xA3, 0x94, 0x80, 0x7C, 0xFF, 0x85, 0xC3, 0x4B, 0xC1, 0x24,
-    0xD3, 0x13, 0x04, 0x82, 0xDC, 0x2A, 0xBD, 0x9D, 0x53, 0x6B, 0x19, 0x59, 0x47, 0x71, 0x64, 0x02,
-    0x3B, 0xEC, 0x84, 0xA3, 0x24, 0x4E, 0xC3, 0x7F, 0x2C, 0x25, 0x0D, 0x3C, 0xC8, 0xA8, 0x5F, 0x52,
-    0x04, 0x63, 0x39, 0xA2, 0xB2, 0x13, 0xF1, 0x53, 0x67, 0xFA, 0x62, 0xB7, 0xF2, 0x2D, 0x0A, 0x2C,
-    0xE2, 0x0A, 0x77, 0x52, 0x3A, 0x6E, 0x77, 0xCB, 0xE9, 0xD2, 0x80, 0xF6, 0x5F, 0x7D, 0x15, 0x78,
-    0x4B, 0xF7, 0x70, 0x83, 0x9D, 0x7F, 0x02, 0xF7, 0x2F, 0xE1, 0x27, 0x07, 0xD9, 0x12, 0xA0, 0x45,
-    0xCF, 0x32, 0x0A, 0x2F, 0x5D, 0xC0, 0x02, 0x3E, 0x3E, 0x42, 0x5D, 0xCC, 0x7D, 0x39, 0x77, 0xF0,
-    0xEB, 0x20, 0x2F, 0xA2, 0x42, 0x16, 0xB2, 0x51, 0xCF, 0x6E, 0xDD, 0xFD, 0x6B, 0x3E, 0x3D, 0x87,
-    0xB4, 0x09, 0x3A, 0x5E, 0x17, 0xBB, 0x94, 0x9C, 0xED, 0x22, 0x8A, 0x20, 0x96, 0x4E, 0x6A, 0x70,
-    0xEC, 0x7E, 0xA7, 0xF9, 0x60, 0x1C, 0x75, 0xD6, 0x69, 0x60, 0x31, 0x39, 0xD6, 0x8C, 0x47, 0xE8,
-    0x4B, 0x5A, 0x6B, 0x31, 0x09, 0x51, 0x7A, 0x9B, 0xD7, 0xBD, 0x7C, 0x15, 0xDB, 0x39, 0x4A, 0x1E,
-    0xA4, 0x20, 0xAF, 0xA5, 0x1F, 0xFC, 0x44, 0x27, 0xC4, 0x58, 0xC9, 0x8F, 0xD4, 0xCC, 0x34, 0x85,
-    0xA8, 0x6B, 0xDD, 0x86, 0x13, 0x40, 0x1F, 0x83, 0x42, 0x28, 0x90, 0x17, 0xFD, 0x02, 0xC9, 0xF0,
-    0x26, 0x7A, 0xA7, 0x8A, 0xBB, 0xA8, 0x8B, 0x94, 0xDE, 0x18, 0xA8, 0x53, 0x01, 0x84, 0xFA, 0x1D,
-    0x50, 0xF9, 0x09, 0xB8, 0xA7, 0x86, 0x1C, 0xA5, 0xDC, 0xFF, 0x0C, 0xA9, 0x3F, 0x73, 0x33, 0xBB,
-    0x84, 0x1C, 0x61, 0x77, 0x38, 0xDA, 0x21, 0xEA, 0x36, 0xB4, 0xDC, 0x71, 0xCC, 0x58, 0x15, 0xD4,
-    0x70, 0x57, 0x99, 0x0D, 0x90, 0x18, 0x54, 0x78, 0x2F, 0x2A, 0x42, 0x4F, 0x49, 0x9A, 0x58, 0xFA,
-    0x11, 0x06, 0xC2, 0x2A, 0x74, 0xA4, 0x0A, 0x98, 0xD1, 0x69, 0x62, 0xA8, 0x69, 0x55, 0xC1, 0x9D,
-    0x63, 0x53, 0xD8, 0x46, 0xB5, 0x58, 0x44, 0xA9, 0x4D, 0x64, 0x03, 0x8F, 0x86, 0x22, 0x9B, 0x23,
-    0x1C, 0x1F, 0xC1, 0x55, 0x80, 0x29, 0x5F, 0xAF, 0x59, 0xFA, 0x14, 0xCF, 0x28, 0x46, 0x0A, 0xB8,
-    0x6B, 0x6E, 0xD1, 0x4E, 0x1A, 0x34, 0xA4, 0x98, 0x51, 0x43, 0x3D, 0x6E, 0xA0, 0xDE, 0x84, 0x05,
-    0x9C, 0x3A, 0xD5, 0x9C, 0xCD, 0x2E, 0xF0, 0x19, 0xD6, 0x35, 0x2E, 0xC0, 0xAE, 0xE6, 0x58, 0x1D,
-    0x6C, 0x41, 0x65, 0x01, 0x67, 0x92, 0x31, 0x06, 0x44, 0x5F, 0x1F, 0xB9, 0xA1, 0xB3, 0x38, 0x43,
-    0x41, 0x6E, 0x92, 0xE4, 0x53, 0x89, 0x05, 0x20, 0x53, 0x7F, 0x87, 0x6D, 0x17, 0x97, 0x20, 0xE7,
-    0xDA, 0xB8, 0xAF, 0x8F, 0x33, 0xA1, 0xEA, 0xA6, 0x97, 0x61, 0xE4, 0x07, 0x80, 0x61, 0x02, 0x17,
-    0x83, 0xA8, 0x9D, 0x2E, 0x31, 0xF8, 0x3F, 0x60, 0xD8, 0xE1, 0xCD, 0x53, 0xB8, 0x1D, 0x96, 0x5D,
-    0xDF, 0xE3, 0x29, 0xA7, 0xCC, 0x56, 0x41, 0xCB, 0x09, 0x1A, 0xC5, 0x08, 0x3D, 0xD6, 0x71, 0x1B,
-    0xE7, 0xB0, 0x38, 0x23, 0x40, 0x13, 0xB0, 0x6C, 0xA7, 0x48, 0x02, 0x4E, 0x09, 0x59, 0xB4, 0x5A,
-    0x6E, 0xF2, 0x6D, 0x2B, 0xF9, 0x17, 0x55, 0x90, 0x31, 0x6B, 0x14, 0x41, 0x18, 0x86, 0xDF, 0xDD,
-    0x91, 0x1B, 0x71, 0x66, 0x6E, 0x2D, 0x0C, 0x1C, 0x61, 0x97, 0xB5, 0x48, 0x31, 0xC5, 0x6E, 0x36,
-    0x48, 0x8A, 0x05, 0x2F, 0xB7, 0x13, 0x1B, 0x2B, 0x3B, 0x6B, 0xF1, 0x07, 0x28, 0x1C, 0x68, 0x61,
-    0x11, 0xCC, 0x12, 0x2D, 0x2D, 0xEE, 0x1F, 0x68, 0x91, 0x52, 0xE4, 0x8A, 0x14, 0x81, 0x9C, 0xDC,
-    0x60, 0xB0, 0xCE, 0x4A, 0xAA, 0x60, 0xE1, 0x80, 0x7F, 0x60, 0xC0, 0x29, 0xB6, 0xB8, 0x73, 0x9D,
-    0xC4, 0x78, 0x20, 0xEF, 0xC0, 0x0B, 0xEF, 0x37, 0xF3, 0x7D, 0xDF, 0x33, 0x81, 0xBA, 0x7B, 0xB0,
-    0xFB, 0xA8, 0x77, 0xEF, 0xDD, 0xD7, 0x17, 0x0F, 0xCE, 0x9E, 0xA4, 0xAE, 0x50, 0x00, 0x9A, 0xD0,
-    0xD0, 0x0F, 0xE2, 0x69, 0x36, 0xAD, 0x16, 0x98, 0x5E, 0x6A, 0x7E, 0x81, 0x89, 0x40, 0x57, 0xF7,
-    0x71, 0x14, 0x75, 0xDF, 0x1D, 0x69, 0x39, 0x36, 0x70, 0xDF, 0x0C, 0xB3, 0x92, 0x67, 0x59, 0xE4,
-    0x82, 0x49, 0x67, 0x03, 0xCD, 0x50, 0xC2, 0x50, 0x95, 0xC3, 0x12, 0x7D, 0x0B, 0xC1, 0x84, 0x6F,
-    0xC8, 0x38, 0x91, 0xD4, 0x24, 0x65, 0x19, 0x97, 0x62, 0x67, 0x8F, 0x59, 0x66, 0xA4, 0xDC, 0x8A,
-    0xB7, 0x79, 0xFE, 0x9C, 0x2D, 0xC1, 0xD7, 0x67, 0xA9, 0xE9, 0xA7, 0x26, 0xE8, 0xBA, 0x26, 0x75,
-    0xFB, 0xC1, 0x02, 0x6D, 0xA1, 0xD8, 0x81, 0xC5, 0xAC, 0x00, 0xFB, 0xE2, 0xAD, 0x52, 0xD1, 0xA9,
-    0xC3, 0xC2, 0xDB, 0xB9, 0xC3, 0xF2, 0xDA, 0x7A, 0x87, 0x34, 0x7C, 0x53, 0x6F, 0x35, 0xFD, 0xF1,
-    0xF9, 0xC7, 0xED, 0x13, 0x31, 0xFA, 0x16, 0xBD, 0xA2, 0xEF, 0x1F, 0xFE, 0xEC, 0xEC, 0x7E, 0xDB,
-    0x6B, 0x71, 0x83, 0x36, 0x02, 0xD7, 0x67, 0xFE, 0x63, 0x89, 0xE0, 0xF7, 0xCD, 0x3E, 0x62, 0x4C,
-    0xA9, 0x3A, 0x8E, 0xEA, 0xF9, 0xAF, 0x4E, 0xA7, 0x06, 0x03, 0x0C, 0xA8, 0xF1, 0xEB, 0xC7, 0xC8,
-    0x8A, 0xB6, 0x30, 0xB8, 0x0D, 0xE3, 0x71, 0xC7, 0x62, 0x9C, 0x8D, 0xAB, 0xE5, 0x15, 0xEE, 0x11,
-    0x30, 0x3F, 0x05, 0x47, 0xD5, 0x04, 0x9A, 0xBC, 0x4D, 0x2A, 0xFB, 0x09, 0x61, 0x2B, 0x56, 0xC4,
-    0x92, 0xA7, 0x33, 0xDF, 0x81, 0x74, 0x9A, 0x42, 0xC2, 0x10, 0x95, 0x60, 0x4A, 0x74, 0x8A, 0x3B,
-    0x97, 0xCC, 0x72, 0xC0, 0x85, 0xA4, 0x36, 0x91, 0x25, 0x2F, 0x45, 0xFE, 0x8C, 0xB9, 0x15, 0x73,
-    0xFE, 0x8F, 0x19, 0x39, 0x86, 0x7E, 0x86, 0x0D, 0x0D, 0xD1, 0xAC, 0x8E, 0x54, 0x84, 0x4D, 0x8C,
-    0xB0, 0xE3, 0xC3, 0xBD, 0xFF, 0x34, 0xF4, 0xD9, 0x08, 0x05, 0x52, 0xF8, 0x3B, 0x9A, 0x69, 0xDA,
-    0x10, 0x1B, 0xFA, 0x0F, 0xC1, 0x67, 0xAC, 0xBD, 0xF4, 0xD5, 0x4D, 0x44, 0x60, 0x35, 0xD1, 0xA4,
-    0x09, 0x2C, 0x2C, 0x1C, 0x8E, 0x57, 0xCF, 0xFE, 0x6A, 0x78, 0xD5, 0x72, 0xE6, 0xF3, 0x16, 0x2E,
-    0xB4, 0xC4, 0x90, 0x86, 0xE9, 0x48, 0xA7, 0xAA, 0xC2, 0x6B, 0x3C, 0xC6, 0x1F, 0x65, 0x55, 0x31,
-    0x6C, 0x1C, 0x45, 0x14, 0x7D, 0xBB, 0x4B, 0x32, 0x52, 0x56, 0xBA, 0xA1, 0x48, 0x03, 0x81, 0x6C,
-    0x45, 0x63, 0x92, 0x6C, 0x1B, 0xA1, 0x3B, 0xCF, 0x0A, 0x17, 0xE9, 0x08, 0x8D, 0xD3, 0x20, 0xE1,
-    0x1E, 0x09, 0x99, 0x92, 0x22, 0xF6, 0x1E, 0xA1, 0xA0, 0x24, 0x42, 0x50, 0xD1, 0xA4, 0x20, 0x8D,
-    0x53, 0x5C, 0x8A, 0x14, 0x29, 0x6C, 0x6E, 0x82, 0x04, 0x2E, 0x59, 0x81, 0x52, 0x67, 0xA5, 0x44,
-    0x20, 0x19, 0x09, 0x4F, 0xA4, 0x13, 0x59, 0xDB, 0x7B, 0x3B, 0xBC, 0x3F, 0x7B, 0x76, 0x30, 0x19,
-    0xDD, 0x3C, 0xCD, 0xCD, 0xCE, 0xFE, 0xFF, 0xE7, 0xFD, 0xF7, 0xFF, 0x02, 0x97, 0xD3, 0x02, 0x3A,
-    0xB1, 0x50, 0x8F, 0x1C, 0xE2, 0xFA, 0x21, 0x30, 0x1B, 0x01, 0xC6, 0x8F, 0x51, 0x7A, 0x87, 0xA9,
-    0x6F, 0xE1, 0xAB, 0x19, 0xBC, 0x1B, 0xA2, 0xDC, 0xCE, 0x60, 0x3E, 0x4D, 0x8B, 0xEC, 0xD7, 0xC4,
-    0xA6, 0x7F, 0x3E, 0x72, 0xC9, 0x3F, 0x3C, 0xDD, 0xF2, 0xB4, 0xB9, 0xA9, 0xA1, 0xBD, 0xB2, 0x89,
-    0xBF, 0x55, 0xC3, 0xD7, 0x33, 0xBE, 0xBD, 0xB3, 0xAE, 0xBC, 0xF7, 0x96, 0xD3, 0x65, 0xDE, 0xB7,
-    0x09, 0x17, 0xF1, 0x1F, 0xBE, 0x2B, 0xC4, 0xF6, 0x50, 0x03, 0x99, 0xB2, 0x48, 0x79, 0x3A, 0xA1,
-    0xED, 0xC5, 0x88, 0x26, 0x0D, 0x22, 0xBE, 0x03, 0x9E, 0x87, 0x79, 0x06, 0x68, 0x3E, 0x8A, 0xE6,
-    0x7C, 0x62, 0xC6, 0x80, 0x72, 0x5C, 0xFC, 0xC8, 0xA9, 0x2B, 0x42, 0x8B, 0xCB, 0xAD, 0xAE, 0x62,
-    0x6F, 0x3B, 0xE4, 0xD0, 0x2E, 0xAE, 0xE8, 0x76, 0xC4, 0x18, 0x8E, 0xFE, 0xB2, 0xE5, 0xC2, 0x9D,
-    0x15, 0xBF, 0xBC, 0x03, 0x0D, 0x96, 0xFE, 0x19, 0x4E, 0x8D, 0xBC, 0x41, 0xEC, 0x7D, 0xA1, 0x0F,
-    0x2E, 0x54, 0x7A, 0x8C, 0xB1, 0x16, 0xB3, 0x32, 0x0B, 0x3E, 0xDA, 0xDB, 0x62, 0xF8, 0x3E, 0xCC,
-    0xB8, 0x66, 0x00, 0xF4, 0x9B, 0xF3, 0xAC, 0xCC, 0x33, 0x3B, 0xAB, 0xC0, 0x46, 0x70, 0x8F, 0x84,
-    0x73, 0x9D, 0xCF, 0xFD, 0xDE, 0x5D, 0xC8, 0x2D, 0xBD, 0x78, 0xEB, 0x07, 0x0F, 0x19, 0x60, 0x5A,
-    0x08, 0x92, 0x46, 0x41, 0xC6, 0x40, 0xAC, 0x03, 0xBA, 0x80, 0x0D, 0xA6, 0xC0, 0xBC, 0x25, 0x46,
-    0x6D, 0xC7, 0x8B, 0x45, 0x6D, 0x89, 0x0E, 0xF1, 0xDC, 0x8C, 0x3B, 0x92, 0xCE, 0x31, 0xEF, 0x31,
-    0x6E, 0x95, 0x9B, 0xD3, 0x5B, 0x32, 0x23, 0xCE, 0xE3, 0xB9, 0x20, 0xBA, 0x80, 0xD3, 0x56, 0xD0,
-    0x04, 0xCC, 0x03, 0x6A, 0x86, 0x50, 0xFA, 0xDB, 0x02, 0xE4, 0x6D, 0xE3, 0x86, 0x2F, 0xB0, 0x0D,
-    0x6D, 0x09, 0xAA, 0x2A, 0x25, 0xC2, 0x25, 0xBF, 0x45, 0x96, 0xB7, 0x91, 0x09, 0xCB, 0x8C, 0x8D,
-    0xC0, 0x58, 0x84, 0x9E, 0x4E, 0x22, 0x9F, 0x9F, 0x40, 0x77, 0x0C, 0xD1, 0x4B, 0xF0, 0xA7, 0x20,
-    0x0B, 0x47, 0x94, 0x97, 0xFC, 0x45, 0x8F, 0xD7, 0xE5, 0xCF, 0x67, 0x42, 0x18, 0xDE, 0xC2, 0x55,
-    0x62, 0x1A, 0x18, 0x8D, 0x2D, 0xF3, 0x0C, 0xDC, 0x4F, 0x1C, 0xB2, 0xE6, 0x0A, 0x5D, 0x67, 0x5D,
-    0x4A, 0x9E, 0x06, 0x48, 0x88, 0x49, 0x01, 0x89, 0xA1, 0x86, 0xF9, 0x86, 0x92, 0x29, 0xB4, 0xCD,
-    0x91, 0x74, 0x89, 0xE3, 0x1B, 0xB9, 0x6B, 0x23, 0xDA, 0xDD, 0x34, 0xD8, 0xA4, 0xA5, 0xAF, 0x6D,
-    0x66, 0xD3, 0x7B, 0x4F, 0x9D, 0x72, 0xCA, 0x37, 0x6D, 0xD4, 0xC6, 0xBE, 0x35, 0xA4, 0x37, 0x3F,
-    0x10, 0x17, 0x51, 0x3D, 0xE4, 0x91, 0x82, 0x59, 0x1A, 0x52, 0x05, 0x70, 0x14, 0x73, 0x62, 0x2F,
-    0x32, 0x3C, 0xDC, 0x54, 0xE3, 0xCF, 0x99, 0x35, 0xDF, 0x09, 0x91, 0xCD, 0xDA, 0xF7, 0x07, 0x1B,
-    0xC5, 0xE5, 0xDC, 0x39, 0x3C, 0x38, 0xDA, 0xB5, 0xD1, 0xD3, 0x27, 0x1F, 0x43, 0xED, 0x5F, 0x79,
-    0x48, 0xCA, 0xCA, 0x0A, 0xA6, 0x26, 0x53, 0x7E, 0x85, 0x21, 0xB5, 0xDA, 0x21, 0x75, 0x39, 0x43,
-    0x18, 0x6F, 0x4A, 0xAE, 0x1B, 0xBC, 0xF7, 0xAD, 0x28, 0x50, 0xAE, 0x29, 0x92, 0xC8, 0x4D, 0xB1,
-    0x3E, 0xCE, 0x97, 0xC9, 0x67, 0x3E, 0xA2, 0x3E, 0x08, 0x91, 0xCB, 0x47, 0x71, 0x41, 0x50, 0xF6,
-    0x14, 0x24, 0xF6, 0x4E, 0x3E, 0x64, 0x59, 0x2D, 0x20, 0x76, 0x30, 0x43, 0x72, 0x5B, 0xB2, 0x8E,
-    0x8E, 0xFC, 0x79, 0xA4, 0xC2, 0x3C, 0xDE, 0x14, 0x45, 0x53, 0x75, 0x78, 0xC0, 0x79, 0x49, 0xE8,
-    0x9C, 0x4B, 0x0D, 0x70, 0xE7, 0x3E, 0xD5, 0x7E, 0x89, 0xEB, 0x7D, 0xD6, 0x63, 0x69, 0x03, 0x83,
-    0x57, 0x99, 0xB8, 0x8B, 0xD4, 0x7B, 0x62, 0x99, 0xD2, 0x26, 0x75, 0xD4, 0x25, 0x23, 0x16, 0x3B,
-    0xF9, 0x0B, 0x2B, 0x66, 0xB8, 0xEE, 0xFA, 0xBC, 0x86, 0x7A, 0xFA, 0xA4, 0xA0, 0x92, 0xC6, 0x29,
-    0xF7, 0xCC, 0xED, 0xF3, 0x71, 0x03, 0x51, 0x02, 0x96, 0xE5, 0x1E, 0x6D, 0x74, 0xC4, 0x0B, 0x89,
-    0xDC, 0x47, 0xA2, 0xEE, 0x86, 0xC5, 0xE0, 0xC0, 0x4A, 0x10, 0xAD, 0x62, 0x87, 0xAF, 0x8A, 0xC0,
-    0xBB, 0xEF, 0x0A, 0x79, 0x57, 0x53, 0xAA, 0x67, 0xBD, 0x24, 0x56, 0x8A, 0xC9, 0x3F, 0x17, 0x55,
-    0xEE, 0xFA, 0xC9, 0x9E, 0xEF, 0x4F, 0x4B, 0x2D, 0x20, 0x71, 0x34, 0xA5, 0xF7, 0x09, 0x86, 0xEA,
-    0x49, 0xBB, 0x82, 0x81, 0x33, 0x23, 0x6A, 0xF2, 0x0B, 0xB7, 0x4A, 0x6E, 0xC5, 0x62, 0x60, 0x3A,
-    0x93, 0x0B, 0x32, 0x86, 0x37, 0xA6, 0x22, 0x0D, 0xD1, 0x59, 0x2A, 0xEA, 0xC9, 0xA5, 0xA2, 0x59,
-    0x2E, 0xFD, 0x56, 0x26, 0x6A, 0x24, 0x07, 0x7C, 0x92, 0xAD, 0xB2, 0xC2, 0x84, 0xB8, 0xE0, 0xD9,
-    0xD7, 0x5C, 0x66, 0x45, 0x58, 0x56, 0xA4, 0x63, 0x1A, 0x32, 0x52, 0xCB, 0xAD, 0x1B, 0x59, 0x12,
-    0x92, 0x46, 0x22, 0x32, 0x42, 0x68, 0x12, 0xFA, 0x8A, 0x74, 0x8E, 0xC5, 0x6E, 0x29, 0x4B, 0xD5,
-    0x2F, 0x45, 0x93, 0xAA, 0x3D, 0x59, 0x2E, 0x86, 0x7E, 0x15, 0xCE, 0x4E, 0x3B, 0x21, 0xD1, 0xB3,
-    0xB5, 0x4D, 0x6E, 0x58, 0xDD, 0x48, 0xE7, 0xAA, 0x09, 0xB9, 0xD5, 0x62, 0x3C, 0xC0, 0x40, 0x3C,
-    0xBE, 0x04, 0xFD, 0xA1, 0x80, 0x9F, 0xF3, 0xEF, 0xA4, 0x33, 0x76, 0x10, 0x1D, 0x9A, 0x6A, 0x40,
-    0x91, 0xCC, 0x06, 0x31, 0x5B, 0xE1, 0xFE, 0xC4, 0x69, 0x69, 0x17, 0xD2, 0xA1, 0x66, 0x92, 0xAB,
-    0x9A, 0x4A, 0x38, 0xA0, 0xA7, 0xB7, 0x71, 0x0A, 0x64, 0xBC, 0x1B, 0x58, 0x0F, 0xB7, 0x4B, 0x02,
-    0x1F, 0xAF, 0x61, 0x5D, 0xBA, 0x20, 0xB2, 0x2A, 0x34, 0xB1, 0x90, 0xE6, 0x4D, 0x01, 0x26, 0xD7,
-    0x08, 0x2D, 0x33, 0x01, 0xFF, 0xDB, 0x96, 0x8C, 0x22, 0xD8, 0x58, 0x92, 0xE5, 0x9D, 0xB0, 0xFD,
-    0x7B, 0xC0, 0xEB, 0x3E, 0xF0, 0x42, 0xA6, 0xC7, 0x81, 0xD5, 0xD0, 0x03, 0x44, 0xFD, 0xA1, 0x15,
-    0xF0, 0xAA, 0x7C, 0x72, 0xE1, 0x58, 0x42, 0x7D, 0x34, 0xFD, 0x6F, 0x5A, 0x2B, 0xEF, 0xF4, 0xDF,
-    0xAF, 0xE7, 0x1F, 0xC0, 0x0C, 0x30, 0x3A, 0xFE, 0x2D, 0x0F, 0x60, 0x34, 0xF2, 0x27, 0xD4, 0xC9,
-    0x4C, 0x49, 0xC3, 0x3D, 0x60, 0xE9, 0x8B, 0x61, 0xB7, 0xCA, 0x51, 0x9C, 0x90, 0x7B, 0xA2, 0x9D,
-    0x9F, 0xEE, 0x5E, 0xFF, 0x79, 0xF5, 0x94, 0x76, 0xD0, 0x2B, 0x33, 0x6C, 0x89, 0xF2, 0xFA, 0x5E,
-    0x9F, 0xC9, 0x56, 0x79, 0xBC, 0x95, 0xBA, 0x57, 0x84, 0x22, 0xDA, 0xE1, 0xF5, 0x48, 0xA7, 0x95,
-    0xCA, 0x67, 0x1B, 0x50, 0xC5, 0xB9, 0x7B, 0x87, 0x5F, 0x8A, 0x96, 0x47, 0xF2, 0xAA, 0xF6, 0xE4,
-    0x8D, 0x37, 0x9B, 0x05, 0xD3, 0xAA, 0x0A, 0xFE, 0x4C, 0xF8, 0x82, 0xB0, 0x7B, 0x87, 0x26, 0x16,
-    0x06, 0xEB, 0x33, 0x24, 0x7B, 0x78, 0x0E, 0x78, 0xD1, 0x52, 0xA2, 0xB7, 0x63, 0x5F, 0xB1, 0x31,
-    0x44, 0x78, 0xE7, 0x39, 0x3B, 0xA7, 0xB4, 0xED, 0x06, 0x7A, 0x8E, 0xE1, 0xB2, 0x8B, 0x6B, 0xC5,
-    0x2E, 0x95, 0x31, 0x1A, 0xAA, 0x3A, 0xEA, 0x16, 0xD7, 0x4B, 0x17, 0x53, 0x15, 0x7D, 0x6E, 0xC8,
-    0x21, 0x13, 0x56, 0xA8, 0xA3, 0x35, 0x9B, 0xEE, 0x5E, 0xB3, 0xFA, 0xAB, 0x95, 0x4A, 0x5F, 0x7B,
-    0xBF, 0xD2, 0x8A, 0x33, 0xF9, 0xE2, 0x7F, 0xF3, 0x56, 0x3F, 0x57, 0x6E, 0x55, 0x29, 0x27, 0xDD,
-    0x75, 0x52, 0x25, 0x74, 0xAA, 0x1E, 0x7F, 0x34, 0x43, 0x6A, 0x19, 0x34, 0x61, 0xE3, 0x04, 0x76,
-    0x48, 0x56, 0xDC, 0x9E, 0x59, 0x63, 0xB6, 0x45, 0x49, 0xB5, 0xF6, 0xA1, 0x48, 0xEB, 0xC5, 0xA7,
-    0x71, 0x69, 0x72, 0xF8, 0x83, 0x88, 0xA1, 0xE9, 0x81, 0x72, 0xC5, 0x31, 0xB8, 0xFF, 0xC2, 0xBF,
-    0x8D, 0x53, 0x31, 0x6F, 0x13, 0x31, 0x14, 0xFE, 0x7C, 0x6E, 0x75, 0x15, 0x57, 0xE2, 0x0C, 0x48,
-    0x2C, 0xA5, 0xE9, 0xD8, 0x21, 0xE4, 0x18, 0x18, 0x3A, 0xA4, 0xB9, 0x43, 0x0C, 0x0C, 0x0C, 0x2C,
-    0x4C, 0x0C, 0x88, 0x9F, 0x90, 0xA1, 0x43, 0x86, 0xA4, 0x39, 0x94, 0x81, 0xBF, 0xD1, 0x39, 0x03,
-    0x42, 0x22, 0x43, 0x87, 0x48, 0x35, 0x30, 0x30, 0xE2, 0xAA, 0x03, 0x23, 0x96, 0xF8, 0x01, 0xB8,
-    0x28, 0x80, 0x87, 0x24, 0xE6, 0xBD, 0xBB, 0xB4, 0x05, 0x06, 0x54, 0x5B, 0xEF, 0x9D, 0xF5, 0xFC,
-    0xFC, 0xDE, 0xE7, 0xEF, 0x3E, 0x23, 0x02, 0x90, 0x14, 0x40, 0x83, 0xBE, 0x7D, 0xB2, 0x19, 0x20,
-    0x6D, 0x15, 0x4A, 0x43, 0x08, 0x6C, 0xBC, 0xE6, 0x18, 0xEF, 0x61, 0x1F, 0x55, 0x6E, 0x8C, 0xD5,
-    0xA0, 0x4D, 0x2C, 0xC8, 0x82, 0x81, 0x08, 0x4B, 0x88, 0x1F, 0x5F, 0x6D, 0x34, 0xEB, 0x65, 0x91,
-    0xDB, 0x8E, 0x6C, 0x37, 0x2E, 0x76, 0x20, 0xF8, 0x68, 0x8F, 0x6C, 0x9B, 0x8F, 0x51, 0xFA, 0x5F,
-    0x01, 0xBC, 0xF8, 0xB7, 0xB0, 0x06, 0x22, 0x47, 0x0B, 0x9F, 0x85, 0xB0, 0x60, 0xE3, 0x35, 0xC5,
-    0x18, 0x95, 0xBE, 0x02, 0x7A, 0x50, 0xB5, 0xFF, 0x6F, 0x75, 0xEA, 0x5F, 0x4F, 0x85, 0x6D, 0x31,
-    0x20, 0x34, 0x9E, 0x77, 0x4A, 0x84, 0x50, 0x8B, 0x15, 0xE4, 0x8D, 0x8B, 0x3B, 0x6C, 0xE2, 0x1E,
-    0xD0, 0xA6, 0x89, 0x09, 0x14, 0x22, 0x03, 0xA9, 0xA9, 0x94, 0xB0, 0x8D, 0xF1, 0x78, 0xEC, 0x99,
-    0x82, 0xB9, 0xA2, 0x2C, 0x27, 0x35, 0xEF, 0x39, 0x24, 0x39, 0x35, 0xA0, 0xF2, 0x5B, 0xD8, 0xC3,
-    0xD5, 0x98, 0x10, 0x63, 0x06, 0xEA, 0xA4, 0x88, 0x3F, 0xB6, 0x84, 0xEB, 0xF6, 0x77, 0x63, 0xA1,
-    0xD1, 0xAD, 0x98, 0xBA, 0xFC, 0xAC, 0xC5, 0x44, 0x65, 0xB7, 0x99, 0xBC, 0x4A, 0xF2, 0xF4, 0xAD,
-    0xC1, 0xD0, 0x41, 0xCC, 0xE9, 0x6E, 0x04, 0xFB, 0xD9, 0xEB, 0x38, 0x84, 0x97, 0x8B, 0x1C, 0x27,
-    0x05, 0xEE, 0x7A, 0x24, 0xAA, 0x88, 0xB4, 0x87, 0x53, 0x45, 0x1B, 0x5E, 0x41, 0xBD, 0xCF, 0x99,
-    0x84, 0x0D, 0x35, 0x7E, 0x2A, 0x03, 0x51, 0x7D, 0x7B, 0x06, 0xB9, 0x80, 0xFC, 0x55, 0xC8, 0x73,
-    0x2B, 0xDD, 0x9E, 0x74, 0x35, 0xE9, 0xE4, 0x07, 0x87, 0xEF, 0x0E, 0xB7, 0x76, 0x4A, 0x38, 0x71,
-    0x49, 0x63, 0xBD, 0x03, 0x25, 0xAD, 0x2C, 0xF6, 0x85, 0x89, 0xCD, 0x01, 0xFA, 0x4D, 0x24, 0x9F,
-    0x80, 0x13, 0x0D, 0x65, 0xB3, 0xE0, 0x55, 0x49, 0x2E, 0x0F, 0x22, 0xD6, 0x3B, 0xF8, 0x36, 0xA6,
-    0x09, 0xA6, 0xC2, 0xF4, 0xD1, 0x1B, 0xA0, 0xB6, 0x0F, 0x49, 0x74, 0x2D, 0x59, 0x09, 0xF3, 0x24,
-    0x04, 0x60, 0x9D, 0x53, 0xDB, 0xCC, 0x3A, 0xFF, 0x20, 0x95, 0x93, 0x3B, 0x46, 0xF5, 0x5B, 0x30,
-    0x24, 0x9A, 0x1E, 0x19, 0x5A, 0xA4, 0x9C, 0x94, 0x95, 0x8E, 0x42, 0x79, 0xB9, 0xEA, 0xB0, 0x1B,
-    0xB0, 0x7B, 0x83, 0x3F, 0x85, 0x13, 0x69, 0xCD, 0xC7, 0xA9, 0x5A, 0xAA, 0x89, 0x87, 0x43, 0xFD,
-    0x8D, 0x04, 0xA4, 0x3F, 0x9B, 0xF8, 0x54, 0x9F, 0xCE, 0x1A, 0x0F, 0xB4, 0x19, 0xB4, 0x84, 0x36,
-    0x77, 0xD6, 0xC8, 0x51, 0xD3, 0x6B, 0x3A, 0x80, 0x81, 0xA9, 0xCB, 0xBE, 0x0C, 0xB8, 0x94, 0x0C,
-    0xA6, 0xC4, 0x5D, 0xF0, 0xA8, 0x04, 0x55, 0xA9, 0x2C, 0xE5, 0x90, 0x5B, 0xC1, 0x16, 0x2C, 0x44,
-    0xC5, 0xC0, 0x9A, 0x9C, 0x54, 0x67, 0x94, 0xC5, 0xB5, 0x1B, 0x6F, 0x91, 0xDB, 0x4C, 0xC9, 0x75,
-    0x92, 0x77, 0xDA, 0xF8, 0xE8, 0x5C, 0x9F, 0x59, 0x2C, 0xF5, 0x97, 0x02, 0x99, 0x26, 0x9E, 0x95,
-    0xE6, 0xB7, 0x55, 0x02, 0xD4, 0xF9, 0x8A, 0x83, 0x75, 0x08, 0x16, 0x16, 0x4D, 0xD2, 0x35, 0x35,
-    0x96, 0x86, 0xD1, 0x1E, 0x33, 0xBF, 0x29, 0x3F, 0x42, 0x92, 0x44, 0x58, 0x96, 0xA8, 0x7C, 0x5A,
-    0x12, 0xCD, 0x62, 0x71, 0x0C, 0x79, 0x4E, 0xF5, 0x38, 0xA7, 0x83, 0xD8, 0x30, 0x6E, 0xBA, 0x50,
-    0x42, 0xF3, 0x02, 0x36, 0x2A, 0xD1, 0x61, 0x48, 0x76, 0x48, 0xE7, 0xA7, 0x59, 0x8E, 0x65, 0x6D,
-    0x1E, 0x85, 0xD1, 0x63, 0xDB, 0x3E, 0x32, 0x13, 0xEC, 0xDE, 0x07, 0x6E, 0xDC, 0xA4, 0x6A, 0x23,
-    0xC2, 0x72, 0x44, 0xA0, 0xAA, 0x80, 0x10, 0x3F, 0x47, 0x0F, 0xED, 0xD0, 0x9E, 0xCD, 0x22, 0x9F,
-    0x59, 0x34, 0x9E, 0xF0, 0xAB, 0xD6, 0x0C, 0x9E, 0xEE, 0x48, 0x54, 0xFC, 0x06, 0xA5, 0x53, 0xBD,
-    0x6E, 0xD4, 0x40, 0x10, 0xFE, 0xD6, 0x06, 0x59, 0x62, 0x15, 0xB6, 0x02, 0x09, 0x45, 0x8A, 0x1F,
-    0x00, 0x14, 0xBF, 0x40, 0x72, 0xB6, 0x68, 0x53, 0x10, 0x8A, 0xD0, 0xD0, 0xF0, 0x06, 0xD7, 0xA4,
-    0x04, 0xEC, 0xF0, 0x04, 0x3C, 0x02, 0x2D, 0x69, 0x8E, 0x1A, 0x45, 0x78, 0xA9, 0x29, 0xB0, 0x14,
-    0x45, 0x14, 0x48, 0xC8, 0x45, 0xAE, 0x80, 0x06, 0x17, 0x07, 0x5C, 0x82, 0xCF, 0xC3, 0x37, 0x9B,
-    0x5C, 0x08, 0xB4, 0x59, 0xDD, 0x7E, 0xB7, 0xEB, 0xF9, 0xFD, 0x66, 0x76, 0x80, 0xB5, 0x02, 0xA8,
-    0x2B, 0x20, 0x05, 0xB0, 0xC1, 0xFD, 0x06, 0x88, 0x3C, 0x60, 0xC3, 0x75, 0x52, 0x75, 0xA9, 0x1C,
-    0xFA, 0x45, 0xF2, 0xC5, 0xFA, 0x78, 0x36, 0x82, 0xF5, 0x73, 0xA4, 0x71, 0x8B, 0xA7, 0xBC, 0x36,
-    0xE9, 0xB4, 0x44, 0x2E, 0x73, 0x6E, 0x8F, 0xD5, 0x19, 0x96, 0x6B, 0x55, 0x5E, 0xC6, 0x1E, 0xA5,
-    0x08, 0xF5, 0xEA, 0x69, 0xF9, 0xAB, 0x45, 0xE9, 0x8D, 0xB4, 0xC8, 0x3D, 0xD2, 0x0E, 0xA9, 0x47,
-    0xD2, 0xC3, 0xB5, 0x48, 0xA4, 0x88, 0x3B, 0x24, 0x1F, 0x5A, 0xF4, 0x48, 0xDE, 0xD3, 0x0B, 0x9D,
-    0x8F, 0xE0, 0x2A, 0xEB, 0x9D, 0x8F, 0x3B, 0x5B, 0xD1, 0xBA, 0x77, 0x95, 0xA1, 0xE0, 0x41, 0x85,
-    0x01, 0x4E, 0x0A, 0xD4, 0x85, 0x91, 0xE9, 0x23, 0x46, 0xCB, 0x45, 0xE8, 0xD0, 0x11, 0xBB, 0x80,
-    0x33, 0xB8, 0xAD, 0x80, 0x1A, 0x1C, 0x11, 0x2E, 0xAD, 0x58, 0x13, 0x4B, 0x5B, 0x02, 0xED, 0x90,
-    0x7C, 0x27, 0xD3, 0x3C, 0x03, 0x4C, 0xFF, 0x1C, 0x70, 0x4D, 0xCF, 0x5B, 0x34, 0x47, 0x34, 0x63,
-    0x2A, 0xCE, 0xDB, 0x16, 0xEF, 0x98, 0x20, 0xCF, 0x79, 0x95, 0x91, 0x02, 0x16, 0xC0, 0x60, 0x3B,
-    0x44, 0x7D, 0x7E, 0xB4, 0xF3, 0x78, 0xC6, 0x40, 0x72, 0xA8, 0x50, 0x30, 0xFE, 0x42, 0x77, 0xDC,
-    0xC6, 0xCD, 0x55, 0xB6, 0xD9, 0x8E, 0xAA, 0xAB, 0xD8, 0x2F, 0xF3, 0xC8, 0x65, 0xE0, 0xDF, 0xBD,
-    0xD0, 0x35, 0x6D, 0x1E, 0x7B, 0xC8, 0x8B, 0x23, 0xFB, 0x0A, 0x51, 0xA5, 0x87, 0x4D, 0x60, 0x86,
-    0xB8, 0x81, 0x2B, 0x90, 0xEF, 0xEF, 0x53, 0x99, 0xBF, 0xB3, 0x02, 0x45, 0x13, 0x79, 0xA1, 0x75,
-    0x0C, 0x2B, 0x7C, 0x2C, 0x4F, 0x59, 0xA4, 0x75, 0xBD, 0x52, 0x9B, 0x35, 0xF3, 0x5A, 0xC6, 0xA0,
-    0x10, 0x9A, 0x7C, 0xA0, 0x90, 0x2B, 0xA4, 0xD4, 0x83, 0x6D, 0x96, 0x62, 0xD3, 0xEB, 0xC7, 0x81,
-    0x87, 0x2A, 0xA7, 0xE1, 0x9C, 0x25, 0x44, 0xFA, 0x91, 0xA5, 0x8F, 0x45, 0x0D, 0x4B, 0x15, 0x3B,
-    0x0D, 0x60, 0x44, 0x0D, 0xF9, 0xEA, 0xB2, 0x2A, 0x91, 0x4E, 0x66, 0xEE, 0xE8, 0xED, 0xC9, 0xC1,
-    0x3A, 0x32, 0xBF, 0xB2, 0xC1, 0x07, 0x70, 0x93, 0x50, 0xD8, 0x25, 0xF8, 0xB5, 0xEC, 0x61, 0x2D,
-    0x0B, 0x27, 0xA7, 0xD2, 0x07, 0xE5, 0x60, 0xA6, 0x4E, 0x06, 0xC6, 0x88, 0x06, 0xBA, 0x37, 0x21,
-    0xAD, 0xB9, 0xC2, 0xA6, 0x42, 0xA6, 0x60, 0x43, 0xD6, 0xED, 0xBF, 0x92, 0xF4, 0x42, 0x12, 0x05,
-    0x3E, 0x21, 0xE1, 0x51, 0x60, 0xAA, 0x2E, 0x13, 0xA5, 0x62, 0xFE, 0x23, 0xE9, 0x54, 0x9D, 0x2F,
-    0x03, 0x77, 0x12, 0x4A, 0x4A, 0xA1, 0x4D, 0x26, 0x24, 0x19, 0x85, 0x5A, 0xD9, 0x61, 0xF9, 0xD0,
-    0x72, 0xF7, 0xE9, 0xE7, 0xB0, 0x53, 0x84, 0xB3, 0xD9, 0xEE, 0xCB, 0xF1, 0xE7, 0x10, 0x37, 0x6D,
-    0xCD, 0xDE, 0x8F, 0xCE, 0x6E, 0xED, 0x75, 0x1B, 0x9B, 0xE6, 0xB4, 0x7B, 0x65, 0xEA, 0xE2, 0xDC,
-    0xC0, 0x2D, 0xB0, 0x7B, 0x30, 0x8A, 0x0E, 0x9B, 0x6C, 0x7C, 0xE3, 0xF2, 0xFC, 0x00, 0xBB, 0xDC,
-    0xCA, 0xCB, 0x87, 0x06, 0x86, 0x51, 0x5C, 0x51, 0x5E, 0xBD, 0xF6, 0xBA, 0xFC, 0xDD, 0x9D, 0x35,
-    0x39, 0xA9, 0x42, 0x8B, 0xEF, 0x8A, 0xF4, 0x1C, 0xB6, 0x85, 0xD2, 0x34, 0x14, 0xB1, 0xC9, 0x81,
-    0xA2, 0xF6, 0x6E, 0xF4, 0xD7, 0xA7, 0x51, 0x78, 0xA6, 0x5E, 0xA8, 0xB3, 0xCA, 0x87, 0xCD, 0xF9,
-    0x23, 0x07, 0x2A, 0xD7, 0x0C, 0xED, 0x4E, 0x94, 0xC1, 0xB1, 0x36, 0x85, 0x03, 0xC4, 0x29, 0xE2,
-    0xDD, 0xD4, 0x9C, 0x31, 0x58, 0x1D, 0x1B, 0x8C, 0xD5, 0xFA, 0x9A, 0xD9, 0x0E, 0x1D, 0xFC, 0x5A,
-    0xE0, 0x76, 0x2D, 0xDA, 0xC3, 0x5B, 0x93, 0xC2, 0x5C, 0x54, 0x2F, 0x53, 0x0A, 0x76, 0xA1, 0xC5,
-    0x0D, 0xFD, 0xAD, 0xD5, 0x5D, 0xA6, 0xF7, 0x44, 0x21, 0xA5, 0x78, 0x2C, 0x0D, 0xBD, 0x1E, 0x1B,
-    0x61, 0x5C, 0xAB, 0x81, 0x32, 0x6E, 0x9C, 0x17, 0xC4, 0x3C, 0xC1, 0xF5, 0x89, 0xB4, 0xE4, 0xF2,
-    0xFA, 0xFE, 0x37, 0x8D, 0xF4, 0x07,
+static const uint8_t opendyslexic_12_regularBitmaps[24811] = {
+    0xC5, 0x9A, 0x4D, 0x8C, 0x1E, 0xC7, 0x99, 0xDF, 0x7F, 0xDD, 0x45, 0xB2, 0xBD, 0xEE, 0x58, 0xC5,
+    0x83, 0x89, 0x4D, 0xC0, 0x25, 0xDB, 0x47, 0xC7, 0x16, 0xD9, 0x7B, 0xF0, 0x41, 0x01, 0x66, 0xA6,
+    0xDA, 0x12, 0x10, 0x1D, 0x7C, 0x90, 0x02, 0x68, 0xBC, 0x87, 0x3D, 0x38, 0x97, 0x00, 0xD9, 0x38,
+    0x01, 0x75, 0x20, 0x10, 0x2E, 0xC0, 0x99, 0x6E, 0x8A, 0xC0, 0xF2, 0xB0, 0x07, 0x73, 0x91, 0xF8,
+    0xAE, 0x43, 0x02, 0x78, 0xA9, 0x04, 0x54, 0x00, 0x1D, 0x98, 0xC5, 0x0C, 0xBB, 0xC8, 0x39, 0xE8,
+    0x60, 0x60, 0xD3, 0x14, 0x61, 0xF8, 0xE0, 0x83, 0x5A, 0x22, 0xF7, 0x23, 0x12, 0x10, 0x95, 0xA2,
+    0x56, 0xDC, 0x24, 0xAB, 0xFB, 0x9F, 0x43, 0xBF, 0x33, 0x1C, 0xEA, 0x63, 0xB3, 0x96, 0x15, 0x6D,
+    0xBD, 0xD5, 0xF5, 0x54, 0xBF, 0x6F, 0xBF, 0x55, 0x4F, 0x3D, 0x5D, 0xF5, 0x7C, 0xFC, 0xAB, 0x92,
+    0x66, 0x2D, 0xF3, 0x17, 0x33, 0xBF, 0x93, 0xFB, 0x9D, 0xDC, 0x47, 0xBB, 0x9F, 0x8B, 0x5B, 0x91,
+    0x0A, 0x77, 0x79, 0xAC, 0x7F, 0x1E, 0xE5, 0xDB, 0xCB, 0xB1, 0x7D, 0x2E, 0xB6, 0x26, 0xB6, 0x66,
+    0x6C, 0xCD, 0x20, 0x33, 0xC8, 0x8C, 0xB0, 0xC6, 0x1B, 0x40, 0xE6, 0x6D, 0x05, 0xEC, 0x30, 0x00,
+    0x79, 0x63, 0x01, 0x46, 0x02, 0x60, 0x9B, 0x02, 0xAC, 0x24, 0xA9, 0x93, 0x24, 0x45, 0x92, 0xC1,
+    0x04, 0xA0, 0x64, 0x03, 0x48, 0x83, 0xE9, 0x01, 0xC7, 0x3A, 0x60, 0x42, 0xD6, 0x01, 0x8E, 0x2D,
+    0x28, 0x24, 0x49, 0xAF, 0x48, 0x92, 0x06, 0xF2, 0xDE, 0x7A, 0x60, 0x22, 0x02, 0xB6, 0x5B, 0x6E,
+    0x92, 0x08, 0x58, 0x5F, 0x34, 0x3C, 0x99, 0xCE, 0x9F, 0x07, 0x4E, 0x9D, 0x02, 0x4E, 0xEA, 0x3E,
+    0xD4, 0x52, 0x45, 0x2D, 0x79, 0xDC, 0x7C, 0xEA, 0x38, 0xC5, 0x2F, 0x9F, 0xAF, 0xC8, 0xDF, 0xB9,
+    0xD3, 0x91, 0x8E, 0xE7, 0xCF, 0x43, 0x7D, 0xEA, 0x14, 0x58, 0xFD, 0x69, 0x45, 0x22, 0xF5, 0x90,
+    0x4B, 0x1D, 0x94, 0x9A, 0x21, 0xFB, 0x81, 0x02, 0xC9, 0x9D, 0x0F, 0x66, 0x38, 0xFF, 0xEF, 0xE5,
+    0x39, 0x75, 0x5A, 0xA1, 0xF8, 0xE0, 0xBA, 0xA2, 0x95, 0x34, 0x59, 0x49, 0x73, 0x2E, 0x69, 0xE2,
+    0x9C, 0x74, 0x1F, 0x92, 0x3B, 0xDD, 0x7E, 0xEF, 0x47, 0xBE, 0x76, 0xC0, 0x4D, 0x56, 0x81, 0x69,
+    0x8A, 0x2E, 0xF5, 0xA7, 0xFF, 0x1D, 0xFD, 0x37, 0x12, 0x1F, 0x0C, 0xBF, 0x7F, 0x3E, 0xF1, 0xDF,
+    0x58, 0xE3, 0x7B, 0xE6, 0x0C, 0xF6, 0xF9, 0xB7, 0x49, 0xF4, 0x01, 0x14, 0xBF, 0x6C, 0xC0, 0xBC,
+    0x3D, 0x92, 0xFE, 0x2F, 0xD3, 0xF0, 0x6B, 0x5E, 0xE6, 0x63, 0xFF, 0x7B, 0x5C, 0x7C, 0x39, 0x63,
+    0xFD, 0xA9, 0xE7, 0x7D, 0x99, 0xAA, 0x2B, 0x28, 0x3B, 0xDB, 0x00, 0x9C, 0xBC, 0x0F, 0xA9, 0x66,
+    0xC8, 0xBB, 0xA2, 0xC1, 0x56, 0xB9, 0x5F, 0x15, 0xBE, 0x68, 0xC8, 0xFB, 0x16, 0x52, 0x45, 0xA0,
+    0xED, 0x01, 0x79, 0x30, 0x0A, 0x60, 0x43, 0xE4, 0x9B, 0x45, 0xE7, 0x88, 0xCE, 0xDB, 0x3B, 0xD1,
+    0xF9, 0xF4, 0xD7, 0x83, 0xF3, 0xB4, 0xA1, 0x0C, 0xD4, 0xBE, 0x98, 0xFF, 0x40, 0x5D, 0x2E, 0xCD,
+    0x43, 0x2A, 0x85, 0x6F, 0xF1, 0xDD, 0xB9, 0x5A, 0x06, 0xB0, 0x79, 0xEE, 0x57, 0xBF, 0x8E, 0x72,
+    0xFF, 0x23, 0xC0, 0x19, 0xD6, 0x78, 0x83, 0x90, 0xF6, 0xC6, 0xE7, 0x8D, 0xAD, 0x2C, 0x67, 0xD9,
+    0x60, 0x9D, 0x35, 0x2E, 0x3E, 0xF1, 0x59, 0x63, 0x9D, 0x0D, 0x4A, 0x0A, 0x6C, 0x65, 0x7D, 0xEE,
+    0xB3, 0xCE, 0x84, 0x74, 0x20, 0xB2, 0xCB, 0x89, 0xF3, 0xAC, 0x71, 0x16, 0x4B, 0xDE, 0x18, 0x6F,
+    0xBA, 0x24, 0x10, 0x18, 0xB8, 0x71, 0xF0, 0xB7, 0xE5, 0xB3, 0xC6, 0x1A, 0x17, 0xD9, 0xE1, 0x06,
+    0x23, 0x43, 0x1A, 0x4C, 0x6F, 0xBA, 0xDC, 0x5B, 0x5F, 0x54, 0x8E, 0x6D, 0x5E, 0x5A, 0xC4, 0xDA,
+    0x40, 0x7F, 0xFC, 0xFC, 0x33, 0x67, 0xCA, 0xBF, 0xDC, 0xA2, 0x1E, 0x48, 0x47, 0x32, 0xDD, 0x2F,
+    0xFE, 0xB2, 0xBC, 0x7C, 0xD9, 0x37, 0x04, 0x78, 0x06, 0x72, 0x30, 0x1E, 0x02, 0xAC, 0x81, 0xC5,
+    0x4A, 0x77, 0xA5, 0x61, 0xB9, 0xD9, 0xFF, 0xE5, 0x69, 0x8E, 0xFE, 0x8B, 0xB9, 0x7C, 0x2B, 0x96,
+    0x7B, 0x63, 0xFD, 0x83, 0xF0, 0x9D, 0x6B, 0xD7, 0xAC, 0xB4, 0x27, 0x05, 0xEC, 0xDE, 0x87, 0xB1,
+    0xAD, 0x80, 0x6F, 0x2D, 0x9D, 0x9D, 0x01, 0x02, 0x64, 0xFE, 0xA0, 0x6A, 0x3C, 0x9C, 0x06, 0x86,
+    0xA5, 0x5A, 0x00, 0x37, 0xC0, 0x74, 0x4F, 0x54, 0x2D, 0x70, 0x11, 0x4C, 0x0F, 0xB6, 0x82, 0x8B,
+    0x90, 0x86, 0x27, 0xAB, 0x0D, 0xAC, 0xAF, 0xAA, 0x1E, 0x36, 0x20, 0x19, 0x20, 0x7F, 0xB2, 0xBA,
+    0x0E, 0x1C, 0x4C, 0xF3, 0xB2, 0xE7, 0x74, 0xE6, 0x33, 0x6F, 0x19, 0x78, 0xC3, 0x62, 0x6E, 0x07,
+    0xD6, 0xCE, 0xE6, 0xE6, 0x6E, 0x3F, 0xAE, 0x6F, 0xD8, 0xCB, 0xF7, 0xFA, 0x61, 0xC3, 0x65, 0xE6,
+    0x5E, 0x60, 0xAB, 0xAC, 0xF2, 0xB7, 0x62, 0x12, 0x8B, 0x87, 0xF2, 0xD2, 0x98, 0x49, 0x94, 0xEA,
+    0x38, 0xD7, 0x03, 0x24, 0x13, 0xF9, 0x84, 0xDD, 0xE2, 0xC8, 0x3A, 0x1C, 0xCE, 0x5B, 0x4F, 0xE6,
+    0x5D, 0x4E, 0xCC, 0xFF, 0xD1, 0x69, 0x5A, 0x72, 0xD2, 0x5E, 0xCD, 0xA5, 0xF4, 0xFE, 0xC9, 0xBE,
+    0x62, 0x07, 0x6C, 0x85, 0xE9, 0x61, 0x84, 0x2D, 0x70, 0xE0, 0x3C, 0xA5, 0xC7, 0x75, 0xD4, 0x3D,
+    0x6D, 0x8F, 0x7A, 0xEA, 0x87, 0x7F, 0x5E, 0x4A, 0x3F, 0x97, 0x3E, 0x92, 0xE2, 0x31, 0x5D, 0x35,
+    0x0F, 0x45, 0x95, 0x06, 0x38, 0x03, 0x59, 0x45, 0xD2, 0xC1, 0x1B, 0xB0, 0x83, 0x46, 0xDC, 0x04,
+    0x59, 0x80, 0x0D, 0xB0, 0x1E, 0x13, 0x48, 0x46, 0x77, 0x7D, 0x2E, 0x24, 0x2B, 0xD1, 0x3E, 0x58,
+    0xAD, 0xA6, 0x45, 0xDE, 0xAE, 0x22, 0x1F, 0x48, 0x1E, 0x35, 0x6C, 0x5C, 0xC0, 0xBE, 0xD9, 0xA4,
+    0x61, 0x87, 0xED, 0xDC, 0x5B, 0xBF, 0x63, 0x3E, 0xFE, 0xD1, 0x2F, 0x9C, 0x74, 0x4F, 0x9A, 0x61,
+    0x02, 0xDB, 0x2D, 0xA4, 0x87, 0x99, 0xAF, 0xBF, 0x36, 0x65, 0xD2, 0xA5, 0x1E, 0x2E, 0xC0, 0x69,
+    0xC8, 0x1B, 0xD2, 0x1E, 0xDA, 0x99, 0x52, 0xF1, 0x28, 0x85, 0x27, 0x19, 0x16, 0x06, 0x1A, 0xB2,
+    0x77, 0x9A, 0x6C, 0xA8, 0x15, 0x4B, 0xCD, 0x56, 0x73, 0xD2, 0x8E, 0x90, 0xAB, 0xCA, 0x35, 0xA4,
+    0x03, 0x5C, 0x04, 0x5B, 0x91, 0x04, 0x38, 0x0B, 0xE6, 0xDD, 0xB9, 0x72, 0x9A, 0xCD, 0x9C, 0x8E,
+    0xAE, 0xC9, 0xF7, 0x02, 0xEB, 0x25, 0xE6, 0xDD, 0xC0, 0x7A, 0xD1, 0xE4, 0xDD, 0xFC, 0xC3, 0x98,
+    0x49, 0x55, 0xA9, 0x7E, 0x25, 0x78, 0x2B, 0xBD, 0x7B, 0x5D, 0x03, 0xAC, 0x43, 0x01, 0xB9, 0xC7,
+    0x04, 0x18, 0x61, 0x1B, 0xCA, 0x0A, 0xDB, 0x61, 0x02, 0x69, 0x04, 0x81, 0x6B, 0x28, 0x7A, 0xF2,
+    0x01, 0xB3, 0xDC, 0x9F, 0xBB, 0x4F, 0xFE, 0x67, 0x37, 0xB8, 0xC0, 0x0D, 0xD3, 0x11, 0x2C, 0xC6,
+    0xAF, 0x53, 0xB0, 0xC3, 0xC8, 0xF4, 0x23, 0x4F, 0x3B, 0x92, 0x69, 0xE0, 0x66, 0x3A, 0x66, 0x7D,
+    0x3A, 0x94, 0x98, 0x10, 0xB1, 0x7B, 0x01, 0x67, 0xFB, 0x34, 0xDA, 0x87, 0xAD, 0x2F, 0x34, 0xF1,
+    0xF5, 0xB9, 0x81, 0x73, 0x3D, 0xEE, 0x7A, 0x67, 0x1B, 0x97, 0x04, 0xC6, 0x33, 0xD8, 0xBD, 0x8E,
+    0x9D, 0x75, 0xB2, 0xBB, 0x1D, 0x5B, 0x25, 0x79, 0x1F, 0x93, 0x39, 0x97, 0xFA, 0x42, 0x13, 0x47,
+    0x9F, 0xEB, 0x60, 0x1D, 0x72, 0xFF, 0xAF, 0x7E, 0x18, 0xAD, 0x54, 0x49, 0x7D, 0xAE, 0xFB, 0x38,
+    0xFB, 0xCB, 0xFF, 0x33, 0x6F, 0x2E, 0x1A, 0x22, 0x79, 0x31, 0xD6, 0xE7, 0x7E, 0x35, 0xDA, 0x5B,
+    0xB1, 0xDC, 0x9B, 0x4E, 0xAC, 0xB4, 0xC6, 0x13, 0xCB, 0xEA, 0x40, 0x33, 0x03, 0x6D, 0x05, 0x6D,
+    0x47, 0xA2, 0xE5, 0x4A, 0x57, 0x17, 0xAE, 0x03, 0xA3, 0xFB, 0x70, 0x52, 0x13, 0xA4, 0xD2, 0x55,
+    0x38, 0x27, 0x0F, 0x27, 0x23, 0x90, 0x7A, 0xE0, 0x98, 0x74, 0x59, 0xF3, 0xAB, 0x8F, 0x35, 0xFD,
+    0x35, 0xF5, 0xAD, 0xE2, 0xC1, 0x6D, 0xC7, 0xF2, 0xA2, 0xA9, 0x7B, 0xA0, 0x1E, 0xF6, 0x8B, 0x73,
+    0x23, 0x50, 0x8E, 0x40, 0xED, 0x49, 0xDA, 0xC8, 0x31, 0xCD, 0xD5, 0x39, 0x3D, 0xC0, 0xA9, 0xC3,
+    0xCC, 0x15, 0xFC, 0xB3, 0xFD, 0x26, 0x4E, 0x3E, 0xC0, 0x6A, 0x32, 0x0F, 0xCE, 0x85, 0xA7, 0x29,
+    0x3D, 0xEC, 0x40, 0xD6, 0xC1, 0xD6, 0x42, 0x76, 0xC0, 0x7A, 0xD2, 0x01, 0x6A, 0x28, 0x3C, 0xC5,
+    0x80, 0x99, 0xC0, 0x55, 0x98, 0x00, 0x8E, 0x7D, 0x92, 0x54, 0x07, 0x3C, 0xAD, 0xBE, 0xAC, 0x2B,
+    0xB2, 0x01, 0x38, 0xF6, 0xE7, 0x40, 0xA6, 0x09, 0xCC, 0x83, 0x64, 0x84, 0x91, 0xB4, 0x63, 0x1D,
+    0x72, 0x6C, 0x03, 0xCF, 0x24, 0xC1, 0xFE, 0x6D, 0xEA, 0x37, 0xCC, 0x15, 0xFF, 0x7B, 0xC6, 0xFF,
+    0xCB, 0xA7, 0xE9, 0x76, 0x7E, 0x27, 0xF5, 0xA7, 0x72, 0xDF, 0x3D, 0x9D, 0xFA, 0x5D, 0xFB, 0x03,
+    0xBF, 0x96, 0xF7, 0xF5, 0x64, 0xAB, 0x3A, 0x19, 0xDF, 0xEF, 0x4C, 0x24, 0xED, 0x29, 0x03, 0x80,
+    0xEE, 0x27, 0xAF, 0x62, 0x24, 0x41, 0x2E, 0x0D, 0x70, 0x52, 0x6A, 0xE0, 0xD8, 0xB5, 0x0A, 0xD8,
+    0x06, 0x68, 0x01, 0x54, 0x41, 0x22, 0x0F, 0xE6, 0x6F, 0x3A, 0xC8, 0xEE, 0xF6, 0x90, 0xDF, 0x0E,
+    0x60, 0x2F, 0x0D, 0x50, 0x54, 0x11, 0x1C, 0x3B, 0xB0, 0xC1, 0x36, 0xEC, 0xE2, 0x20, 0x52, 0x56,
+    0xC9, 0x88, 0x6D, 0x8C, 0x24, 0x6F, 0x24, 0xF5, 0xB9, 0xA4, 0x60, 0xFF, 0x6A, 0xF3, 0x0F, 0x86,
+    0xC2, 0x63, 0xC6, 0xD2, 0x93, 0x46, 0xD7, 0x90, 0x4C, 0x00, 0xB5, 0x46, 0x6A, 0xA9, 0xDA, 0xA6,
+    0xF0, 0xDB, 0x98, 0x7E, 0x9B, 0x34, 0x6C, 0x93, 0xF6, 0xDB, 0x98, 0xBE, 0xBE, 0x76, 0xDD, 0xD7,
+    0x9A, 0xA9, 0xA5, 0x66, 0x9B, 0x6C, 0xD8, 0x86, 0xB8, 0x0D, 0xBB, 0xAB, 0xEB, 0xE6, 0x36, 0xCC,
+    0xDB, 0xE4, 0x53, 0x2D, 0x4D, 0xB5, 0x14, 0x6B, 0x29, 0xD4, 0xDA, 0xB7, 0x42, 0xC9, 0xF5, 0x91,
+    0x44, 0xF2, 0x48, 0x11, 0xD7, 0x83, 0x1D, 0x20, 0x9D, 0x00, 0x57, 0x2D, 0x7A, 0x83, 0x9B, 0x2C,
+    0xCB, 0x7D, 0xE5, 0x24, 0x00, 0x33, 0xCB, 0x73, 0xA8, 0xE7, 0x88, 0xD5, 0xC3, 0x1F, 0xFB, 0x5A,
+    0x8A, 0x46, 0x92, 0x2F, 0xA4, 0x88, 0x93, 0x3C, 0xB5, 0xEE, 0x03, 0x70, 0x62, 0x13, 0xA8, 0xF5,
+    0x00, 0x6A, 0xA9, 0xA3, 0x96, 0x06, 0xB6, 0x39, 0x39, 0xB1, 0x0D, 0x62, 0x1B, 0x9C, 0xDF, 0x86,
+    0xA2, 0xDB, 0x06, 0xDB, 0x6F, 0x43, 0x1E, 0xB6, 0x21, 0x0B, 0xDB, 0x2C, 0x63, 0x79, 0x5C, 0xD8,
+    0x61, 0x1B, 0xCA, 0x50, 0x6F, 0xFE, 0xA1, 0x42, 0x2D, 0xA9, 0xAB, 0x25, 0xF9, 0x5A, 0xCB, 0xD8,
+    0x07, 0x6A, 0xFD, 0xCF, 0x65, 0x4C, 0xB5, 0x74, 0x5B, 0x9A, 0x73, 0xBD, 0xF7, 0x6A, 0x09, 0xEC,
+    0x2C, 0x53, 0xC5, 0x7A, 0x70, 0x80, 0x14, 0x8C, 0xE4, 0xAD, 0x84, 0xAB, 0x20, 0x3E, 0xF9, 0xEB,
+    0xB4, 0xB9, 0x69, 0xA4, 0xD9, 0x4A, 0xD1, 0x49, 0x41, 0x92, 0x07, 0x8C, 0xD4, 0x4B, 0x63, 0xFD,
+    0x22, 0x45, 0x43, 0xD6, 0x93, 0x0C, 0xB0, 0x05, 0xA5, 0xA6, 0x5C, 0x7A, 0x56, 0xEA, 0x6E, 0x82,
+    0x5B, 0x94, 0xCC, 0x00, 0x13, 0xB8, 0x06, 0xDB, 0x63, 0x46, 0x98, 0xF7, 0x6F, 0x80, 0xE4, 0xC5,
+    0x65, 0x06, 0x25, 0x92, 0x7C, 0x36, 0x57, 0x49, 0x63, 0x07, 0xA0, 0xE8, 0x00, 0xE7, 0x01, 0xD7,
+    0xAC, 0x04, 0xFF, 0x44, 0x91, 0xFC, 0x67, 0x5C, 0x95, 0x68, 0x76, 0x15, 0xE7, 0x66, 0xD7, 0x90,
+    0x3C, 0x74, 0x9E, 0x24, 0x94, 0x03, 0x69, 0x28, 0x74, 0xED, 0x7A, 0xC8, 0xB5, 0x0C, 0x4A, 0x03,
+    0xAD, 0xD4, 0x73, 0x4C, 0x2B, 0xB5, 0xBE, 0x0B, 0x2E, 0x1D, 0x20, 0xDA, 0x0E, 0x13, 0x5C, 0x85,
+    0xED, 0x26, 0x70, 0xCF, 0x0D, 0x30, 0xD9, 0x0E, 0x33, 0xB8, 0x06, 0xDB, 0xCD, 0xE0, 0x9E, 0x1B,
+    0x61, 0xB6, 0x3D, 0x66, 0x74, 0x92, 0x7A, 0x49, 0xBA, 0xAC, 0x45, 0x10, 0x1A, 0xDD, 0x7B, 0xD7,
+    0xDA, 0x20, 0xA8, 0xF7, 0x22, 0x89, 0x6C, 0x20, 0x8B, 0xCE, 0x53, 0x7C, 0x28, 0xA8, 0x3D, 0xC5,
+    0x5E, 0x88, 0xCE, 0x1E, 0x14, 0x2F, 0xDC, 0x1D, 0x26, 0xF7, 0x93, 0xBF, 0x79, 0xA0, 0xFA, 0xED,
+    0x40, 0x16, 0x28, 0x3C, 0x2D, 0x69, 0x24, 0x0F, 0x94, 0x9E, 0x96, 0x74, 0x24, 0xEF, 0x29, 0x1B,
+    0x66, 0xCC, 0x88, 0xED, 0x71, 0x15, 0x13, 0x66, 0xC0, 0x76, 0xB8, 0x8A, 0x88, 0x09, 0x58, 0x4F,
+    0x9B, 0xE4, 0xD1, 0xAA, 0x73, 0x42, 0x83, 0x11, 0x49, 0x45, 0xD6, 0xE7, 0x21, 0x1D, 0xB2, 0xC0,
+    0xAE, 0x19, 0x29, 0x9F, 0x8D, 0x58, 0x3F, 0x61, 0x82, 0x20, 0xD6, 0xE0, 0x5C, 0x83, 0xFD, 0xC0,
+    0x93, 0xA9, 0x23, 0x51, 0x80, 0x7A, 0x84, 0x52, 0x15, 0xB9, 0x06, 0xD2, 0x87, 0xAA, 0x98, 0xDD,
+    0x80, 0xBB, 0xAC, 0xCA, 0xF6, 0xF5, 0x60, 0x86, 0x5C, 0xD5, 0x84, 0x06, 0x57, 0x59, 0x55, 0x40,
+    0x32, 0x42, 0xD1, 0x1C, 0x26, 0x65, 0x43, 0x3A, 0x42, 0x59, 0x91, 0x0E, 0x50, 0x56, 0x98, 0xC5,
+    0x40, 0x1E, 0x26, 0x60, 0x02, 0x89, 0x93, 0x3E, 0x92, 0xB4, 0x22, 0x2B, 0xFD, 0xD4, 0x91, 0xCE,
+    0xC8, 0x63, 0xC7, 0x4C, 0x50, 0xF7, 0xC5, 0x8C, 0x91, 0xAF, 0x23, 0x56, 0x89, 0x06, 0xDA, 0x98,
+    0x7D, 0x10, 0xCC, 0xA3, 0x50, 0xD6, 0x5D, 0xF1, 0xB6, 0xDF, 0xAD, 0x1B, 0xB9, 0x74, 0x94, 0xF9,
+    0x78, 0xCA, 0xDF, 0x9D, 0xCB, 0x37, 0x87, 0xF2, 0x4A, 0x54, 0xD1, 0xCD, 0xF6, 0xD1, 0xD0, 0x5E,
+    0x8E, 0x85, 0x6E, 0xCF, 0x36, 0xB8, 0x39, 0x1F, 0x9D, 0x6F, 0x87, 0x32, 0x08, 0x79, 0xED, 0x45,
+    0x33, 0x1B, 0xD9, 0x90, 0x05, 0x1B, 0x9D, 0x07, 0x17, 0xB4, 0x72, 0x4A, 0x81, 0x13, 0x15, 0xD6,
+    0xB7, 0x15, 0xCE, 0xCC, 0x10, 0x6D, 0x24, 0x0B, 0x6E, 0xA4, 0xF0, 0x0A, 0xD4, 0x46, 0x7D, 0x1A,
+    0xED, 0xDB, 0x3E, 0xEF, 0x6B, 0xD7, 0x94, 0x97, 0x62, 0xCD, 0xCD, 0x2C, 0xCC, 0x66, 0x2C, 0x6F,
+    0x45, 0xDB, 0xB7, 0x66, 0x70, 0xCF, 0xC6, 0x2C, 0x4C, 0x79, 0xB0, 0x77, 0x07, 0xE7, 0xCB, 0xB7,
+    0x3B, 0x55, 0xAE, 0x7D, 0x6E, 0xA2, 0x8D, 0x76, 0x40, 0xC1, 0x75, 0xA9, 0xBC, 0x2A, 0x23, 0x38,
+    0xB6, 0x8A, 0x02, 0x48, 0xF5, 0x53, 0x75, 0x59, 0xA4, 0x08, 0x36, 0x90, 0x8D, 0xC5, 0x4A, 0x75,
+    0x31, 0x39, 0xE0, 0xA6, 0x03, 0xB6, 0x1D, 0x50, 0x6F, 0x03, 0xCE, 0x01, 0x1B, 0xCB, 0x77, 0x15,
+    0xCC, 0xAE, 0x23, 0x9D, 0x8A, 0x79, 0xF3, 0x5C, 0xB4, 0x5A, 0x9C, 0x29, 0x85, 0x54, 0x52, 0x47,
+    0x2B, 0x55, 0x4B, 0x1F, 0x00, 0x85, 0x46, 0x6A, 0xCD, 0xC9, 0xC7, 0x3F, 0x9C, 0x72, 0x4F, 0x2C,
+    0x49, 0x86, 0x1D, 0xB2, 0xB7, 0x02, 0xE5, 0x0B, 0x3E, 0x8D, 0x4E, 0xEA, 0xA4, 0xD9, 0x48, 0x8D,
+    0xED, 0x97, 0x75, 0x33, 0x81, 0x19, 0x17, 0xBB, 0x55, 0x37, 0x24, 0x33, 0x64, 0x11, 0x8A, 0x00,
+    0xB5, 0xDF, 0x37, 0x22, 0x89, 0x1E, 0x40, 0x26, 0xF5, 0x64, 0x0F, 0x12, 0x91, 0x0D, 0xE4, 0xBD,
+    0x19, 0x56, 0x21, 0x50, 0xE1, 0x27, 0x30, 0xC1, 0x01, 0xBB, 0x85, 0x87, 0xF2, 0x4A, 0x0F, 0xD9,
+    0x3B, 0x23, 0x24, 0xE3, 0x36, 0xB0, 0x5D, 0x78, 0x28, 0x9F, 0x0F, 0x60, 0xBB, 0x99, 0x7F, 0x62,
+    0x82, 0xEB, 0xAD, 0xE2, 0x12, 0xB8, 0x48, 0x12, 0x85, 0x24, 0x12, 0x49, 0x0D, 0xC7, 0xA4, 0x01,
+    0x28, 0x16, 0x43, 0x11, 0x80, 0x52, 0x40, 0xB2, 0x59, 0x1D, 0x7D, 0x09, 0xAC, 0x46, 0xAC, 0x84,
+    0xA5, 0xF0, 0x96, 0xCC, 0x17, 0x98, 0xAE, 0xC0, 0xF4, 0x05, 0x59, 0x5F, 0x50, 0x74, 0xE5, 0x35,
+    0xF9, 0x52, 0x33, 0xA5, 0x26, 0x4A, 0xA9, 0x72, 0xBE, 0xF4, 0xAE, 0xC9, 0x7B, 0xE7, 0xB3, 0xB0,
+    0xBA, 0x06, 0xE7, 0xB3, 0xD1, 0xF9, 0x2C, 0xAE, 0xAE, 0x69, 0xD1, 0x01, 0x4E, 0x33, 0x48, 0x33,
+    0xA9, 0xAE, 0x1E, 0xC1, 0x8C, 0x2C, 0xCA, 0xEE, 0x70, 0x31, 0x57, 0x80, 0xE6, 0x0A, 0x6A, 0x45,
+    0xC8, 0xA4, 0x06, 0x7E, 0x57, 0x01, 0x70, 0x23, 0x50, 0x44, 0xA0, 0x98, 0x92, 0x0A, 0x37, 0x19,
+    0x69, 0x09, 0xD2, 0x86, 0x52, 0x52, 0xEF, 0x24, 0x55, 0xC7, 0xA4, 0x57, 0x0F, 0xD4, 0xAE, 0x3E,
+    0x94, 0xA4, 0x37, 0x75, 0xFD, 0x3D, 0x2D, 0xEA, 0x94, 0xB8, 0xDF, 0x91, 0xF5, 0x7C, 0xF2, 0xAB,
+    0xC2, 0x03, 0x35, 0x90, 0x44, 0x56, 0xB6, 0xA6, 0xF0, 0x2B, 0x9B, 0x9A, 0x4E, 0x40, 0x3E, 0x00,
+    0x65, 0xB7, 0xF2, 0x6E, 0xD2, 0x09, 0x4E, 0xC0, 0xD1, 0xE7, 0x22, 0xE9, 0xEC, 0x1A, 0xCA, 0x7B,
+    0x23, 0xE9, 0xE4, 0x1A, 0xCA, 0xBB, 0x23, 0xC9, 0xE4, 0x1A, 0x8A, 0x83, 0xCA, 0xDE, 0x40, 0x12,
+    0x5D, 0xF5, 0xA9, 0x4A, 0x43, 0x71, 0x3B, 0x92, 0xC6, 0xB2, 0xA7, 0xBE, 0xA5, 0xF7, 0xDA, 0xB1,
+    0x90, 0x54, 0x49, 0x0A, 0x99, 0x34, 0x91, 0x1F, 0xD8, 0x45, 0x56, 0x2C, 0x17, 0xB7, 0x47, 0xC8,
+    0xFB, 0x1A, 0xCC, 0x60, 0x3B, 0x92, 0xB8, 0xE8, 0xF4, 0x1A, 0xEA, 0xCA, 0x76, 0x94, 0xDE, 0x44,
+    0x6C, 0x4F, 0x4B, 0x3E, 0x60, 0x7B, 0x13, 0x31, 0x31, 0x99, 0xA1, 0xAD, 0xDA, 0x8A, 0xA2, 0x77,
+    0x1E, 0x13, 0xCB, 0x1E, 0xDA, 0x17, 0x06, 0x28, 0x14, 0xC1, 0x68, 0x06, 0x5A, 0x55, 0x50, 0x2C,
+    0x21, 0x64, 0x0F, 0xB4, 0xC3, 0x4A, 0x38, 0xE9, 0x38, 0x01, 0xD8, 0xB7, 0x46, 0x00, 0x97, 0x07,
+    0x20, 0x89, 0x85, 0x07, 0xF2, 0x7E, 0x65, 0x0F, 0x66, 0xAC, 0x27, 0xA6, 0x91, 0xBA, 0xC9, 0x42,
+    0x16, 0x8C, 0x70, 0x8D, 0xED, 0x8A, 0x99, 0x09, 0xD7, 0x28, 0x66, 0x81, 0x36, 0x7F, 0x34, 0x96,
+    0x3E, 0x8D, 0xEE, 0xE7, 0x61, 0x26, 0xFB, 0xDF, 0xB3, 0xBD, 0x37, 0x60, 0x3F, 0x18, 0xDC, 0xDB,
+    0x1E, 0x27, 0x5F, 0x0B, 0xDA, 0x09, 0x8D, 0x24, 0x0A, 0xA9, 0x7A, 0x8C, 0x9A, 0x4C, 0x15, 0x76,
+    0xC2, 0x46, 0x70, 0x61, 0xE5, 0xFD, 0x80, 0xF5, 0x0B, 0xAC, 0x60, 0x42, 0x3A, 0x62, 0x3D, 0x91,
+    0xB2, 0xA1, 0xA6, 0x86, 0xB2, 0x99, 0x56, 0x5C, 0x66, 0x8F, 0x02, 0x18, 0x75, 0xFB, 0xDA, 0xE7,
+    0xB1, 0x33, 0xA4, 0x1E, 0xAC, 0x06, 0x28, 0xEF, 0x45, 0xA8, 0x6F, 0xCF, 0xA0, 0x4A, 0x55, 0x2A,
+    0x6A, 0x9F, 0x45, 0xCA, 0x60, 0x47, 0xEC, 0xE8, 0x02, 0xD9, 0xE4, 0x20, 0x7F, 0x77, 0x84, 0x68,
+    0x3D, 0x65, 0xD3, 0x62, 0x82, 0x19, 0x98, 0x29, 0x7D, 0xE1, 0x99, 0xCC, 0x48, 0x1E, 0x5A, 0x70,
+    0x3F, 0xE9, 0x97, 0x00, 0xDC, 0xAA, 0x81, 0x36, 0x80, 0x99, 0x57, 0x96, 0xD3, 0xC4, 0xC3, 0x95,
+    0xDA, 0x43, 0x1E, 0x57, 0x0C, 0xD9, 0x08, 0x46, 0x52, 0x4C, 0x24, 0x45, 0x24, 0x45, 0xFE, 0xCD,
+    0xB5, 0xEB, 0x23, 0x50, 0x0E, 0x40, 0xDB, 0x41, 0xAA, 0x06, 0xF2, 0x79, 0xDF, 0x9D, 0x6D, 0x03,
+    0xA4, 0xF2, 0x90, 0x0B, 0x28, 0xE3, 0xEA, 0x05, 0xA5, 0xEA, 0x20, 0x57, 0x03, 0xE5, 0xBC, 0x9A,
+    0xEF, 0x43, 0x2D, 0x69, 0xAC, 0xB5, 0xF8, 0x55, 0x9A, 0x92, 0xCD, 0xEF, 0x2B, 0xD4, 0xB1, 0x24,
+    0xF7, 0x69, 0x60, 0x87, 0x12, 0xEB, 0x4D, 0x20, 0xE2, 0xB0, 0xDE, 0xF4, 0x8C, 0x6C, 0x60, 0x1B,
+    0xD3, 0x27, 0x03, 0x5B, 0x14, 0x55, 0xD6, 0x25, 0x03, 0x3B, 0x1C, 0x3C, 0xEE, 0x0E, 0x1E, 0x97,
+    0xD5, 0x65, 0xF5, 0xC7, 0xF9, 0x1A, 0xA6, 0x22, 0xF0, 0x34, 0x59, 0x43, 0xE0, 0xCC, 0x42, 0xD6,
+    0xC9, 0x3D, 0x81, 0x0D, 0x72, 0x9F, 0x0C, 0x8F, 0x89, 0xAD, 0x52, 0xCF, 0xB7, 0xE0, 0xC4, 0x4B,
+    0x56, 0x46, 0xFE, 0x70, 0x1F, 0x4B, 0xAF, 0x4B, 0xF7, 0x8F, 0x19, 0x5A, 0xB1, 0x98, 0xFB, 0x34,
+    0x3C, 0x7E, 0x74, 0xEB, 0xE0, 0x51, 0xAB, 0xCB, 0x0A, 0x8A, 0x7C, 0x9B, 0x74, 0xA0, 0x18, 0x92,
+    0xFE, 0x8D, 0xA7, 0x39, 0x7F, 0x74, 0x73, 0x13, 0xAB, 0xC5, 0xD4, 0x8D, 0x00, 0xEB, 0xD8, 0xC6,
+    0x04, 0xFE, 0x35, 0xC0, 0xB1, 0xE9, 0xE5, 0x54, 0xAA, 0x6E, 0xFE, 0xE1, 0x60, 0xAB, 0xE2, 0x95,
+    0x9E, 0x71, 0x0D, 0xBB, 0xE7, 0xD9, 0x59, 0x48, 0xDC, 0xA0, 0xDE, 0x93, 0xA6, 0x42, 0xEA, 0x5A,
+    0x6D, 0x25, 0xED, 0xE5, 0x7E, 0xA5, 0x0F, 0x0E, 0x7B, 0x60, 0xAB, 0xDB, 0xDC, 0x43, 0x99, 0xDF,
+    0xE7, 0xA6, 0x62, 0xAA, 0xBF, 0x8E, 0x59, 0x64, 0x2C, 0x7C, 0x12, 0x6A, 0xCC, 0x3B, 0x11, 0x7B,
+    0x25, 0xB0, 0x61, 0x7D, 0x32, 0xB8, 0xA6, 0xF0, 0x7A, 0x7F, 0x36, 0x8B, 0xFF, 0xB3, 0x4C, 0xB9,
+    0x6F, 0x2E, 0x73, 0xB7, 0xED, 0x33, 0x05, 0xDB, 0x1F, 0x2F, 0x2B, 0x1C, 0x6C, 0xEC, 0xC7, 0xE1,
+    0x1B, 0xE0, 0x2A, 0xCA, 0x1E, 0xAB, 0x21, 0x53, 0xE4, 0xDC, 0xCA, 0x55, 0x5A, 0x01, 0x0F, 0x16,
+    0x58, 0x3B, 0x80, 0x24, 0xFE, 0x53, 0x41, 0x39, 0x5D, 0x34, 0x9A, 0x43, 0xF9, 0x7D, 0xF9, 0x80,
+    0xF2, 0x26, 0x8D, 0xEB, 0xE4, 0xFD, 0x40, 0x71, 0xB9, 0xE3, 0xA6, 0x6D, 0xCC, 0xE8, 0xAE, 0xD6,
+    0x7D, 0x2D, 0x79, 0x49, 0xB4, 0xDA, 0xE1, 0xDC, 0x3B, 0x61, 0x1F, 0x4E, 0x28, 0xD4, 0x65, 0x5D,
+    0xCE, 0xC0, 0xDA, 0x69, 0xCC, 0xED, 0x87, 0x9A, 0x9D, 0x74, 0xEF, 0x17, 0xB0, 0xBE, 0x00, 0x17,
+    0xAE, 0x01, 0xFD, 0xF4, 0xDF, 0xE6, 0x92, 0x2F, 0x14, 0xF9, 0xEE, 0x04, 0xE7, 0x9A, 0xBA, 0xDF,
+    0xC0, 0x62, 0x3C, 0xC1, 0x28, 0x4A, 0x59, 0xC7, 0xC0, 0xFA, 0xF2, 0x6E, 0x46, 0xB6, 0x29, 0x9A,
+    0xAC, 0x4F, 0x46, 0xB6, 0x29, 0x1B, 0xDA, 0xE7, 0x3A, 0x37, 0x5F, 0xB4, 0xEF, 0xEB, 0x56, 0xC8,
+    0xE3, 0x3A, 0x6E, 0xCF, 0x27, 0x71, 0x8D, 0x62, 0x21, 0xE5, 0x5E, 0x9F, 0xC5, 0x42, 0xF2, 0x8B,
+    0x67, 0xDE, 0xE4, 0xC3, 0x08, 0x45, 0x85, 0x19, 0xBE, 0x91, 0x08, 0xA9, 0x2F, 0x14, 0x93, 0x76,
+    0x86, 0x13, 0x90, 0x37, 0x30, 0x2C, 0xE8, 0xC9, 0x8A, 0x84, 0x45, 0x12, 0xE1, 0x8F, 0x28, 0xEA,
+    0x29, 0x91, 0x86, 0x22, 0x14, 0x97, 0x22, 0x17, 0xCB, 0xCA, 0xDC, 0x0E, 0xAC, 0x95, 0x98, 0xBB,
+    0x81, 0x75, 0xB7, 0x4F, 0xB2, 0x7B, 0x03, 0x37, 0x5D, 0x95, 0xF7, 0xA5, 0xBD, 0xFB, 0xF1, 0x0C,
+    0xC0, 0xE9, 0xEC, 0x52, 0x7F, 0xE1, 0x74, 0x76, 0xA9, 0xBF, 0x51, 0xE6, 0x7B, 0x21, 0x3A, 0xDB,
+    0x91, 0x75, 0xDC, 0xC4, 0xF6, 0xE8, 0x40, 0xC3, 0x7E, 0x1B, 0xE3, 0x59, 0x3B, 0x54, 0x64, 0x9E,
+    0x8B, 0xAB, 0xA2, 0xE1, 0x02, 0x79, 0xC3, 0x0D, 0x6C, 0x95, 0x0D, 0x85, 0x8C, 0xFC, 0x89, 0x6A,
+    0x9F, 0xC5, 0x02, 0x92, 0x70, 0x98, 0xA4, 0x61, 0x83, 0xD2, 0xFA, 0xF4, 0xA3, 0x40, 0xB9, 0x4B,
+    0xAA, 0x06, 0x17, 0x30, 0xF2, 0x38, 0x61, 0x3E, 0x8A, 0xB8, 0x22, 0x98, 0xD0, 0x7A, 0x97, 0xCA,
+    0x04, 0x1B, 0xE1, 0x62, 0x12, 0x72, 0x5F, 0x32, 0x9A, 0xDE, 0x36, 0xEB, 0x0C, 0xA6, 0xB3, 0xD5,
+    0x56, 0x32, 0x64, 0x5D, 0x51, 0x6D, 0x25, 0x43, 0xA6, 0x62, 0xAA, 0xC7, 0xFC, 0xCA, 0x98, 0xCC,
+    0x9C, 0x6D, 0xA7, 0x72, 0x46, 0x7F, 0x3D, 0x3D, 0xDC, 0x35, 0x31, 0x11, 0x37, 0xAC, 0x37, 0x03,
+    0xC1, 0x91, 0x7B, 0x73, 0x6B, 0xA4, 0xC4, 0x66, 0x3D, 0x23, 0x6B, 0x65, 0x65, 0xFA, 0x24, 0xEC,
+    0x62, 0x9B, 0x6C, 0x6F, 0x60, 0x8B, 0xF2, 0x05, 0x9F, 0x0E, 0xEC, 0x3A, 0xAC, 0x37, 0x43, 0xC4,
+    0x61, 0xBB, 0xA7, 0x8A, 0x3E, 0x91, 0xBA, 0x62, 0xA8, 0x93, 0xC8, 0x58, 0x56, 0xF9, 0x2B, 0x81,
+    0x9D, 0x92, 0xFC, 0x76, 0x60, 0xC7, 0x55, 0x76, 0x6F, 0x20, 0xBA, 0xCA, 0xDE, 0x1D, 0x98, 0x56,
+    0x84, 0x73, 0x3D, 0xA5, 0x7A, 0x7B, 0xFF, 0xDC, 0xF7, 0x03, 0x17, 0x37, 0x30, 0x77, 0x3B, 0x36,
+    0xD6, 0x49, 0x3F, 0xEA, 0x28, 0x37, 0x30, 0xF7, 0x06, 0x76, 0x8B, 0x59, 0x5E, 0x1A, 0x52, 0x4D,
+    0x64, 0x33, 0x49, 0xFA, 0xDF, 0x39, 0xEB, 0x66, 0xDA, 0x61, 0x3B, 0x11, 0x6B, 0x59, 0xE0, 0x46,
+    0xE1, 0x93, 0xB0, 0x4D, 0x76, 0x2B, 0x52, 0x64, 0x81, 0x8B, 0x45, 0x30, 0x7D, 0xFB, 0xA0, 0x7D,
+    0x56, 0x8A, 0xF6, 0x03, 0xF9, 0x8D, 0x32, 0x26, 0x63, 0x42, 0xDE, 0x41, 0xF9, 0x38, 0x16, 0x2A,
+    0xF6, 0x1D, 0xA4, 0x04, 0x28, 0xC7, 0x1D, 0xDC, 0xF5, 0xEB, 0x38, 0xE4, 0x0B, 0x6C, 0xB0, 0x8D,
+    0x19, 0x4D, 0xC7, 0x4C, 0xC0, 0x55, 0x6B, 0xD8, 0xCE, 0x92, 0x0D, 0xA6, 0x37, 0x91, 0xFA, 0x35,
+    0x91, 0x4B, 0x9E, 0x76, 0x0A, 0x1C, 0x7B, 0xB0, 0xC6, 0x32, 0x87, 0xB2, 0x5F, 0x35, 0x24, 0xEA,
+    0xA0, 0x0E, 0x70, 0x76, 0x31, 0xAF, 0xF6, 0xEB, 0xDD, 0xA3, 0xC9, 0xAA, 0xD7, 0x62, 0x54, 0xAC,
+    0x27, 0x52, 0xF8, 0x24, 0x52, 0xFA, 0x34, 0xE2, 0xBC, 0x99, 0xA0, 0x1D, 0x91, 0x18, 0x16, 0x90,
+    0xB1, 0x22, 0x9D, 0xC0, 0xCD, 0x24, 0xED, 0x82, 0x12, 0xD8, 0x6E, 0xFB, 0xB5, 0xA1, 0x56, 0x74,
+    0x9A, 0x93, 0x15, 0x88, 0xF5, 0x3A, 0xB9, 0x5F, 0x82, 0xEB, 0x1F, 0x3F, 0xFC, 0x0F, 0x92, 0xDF,
+    0x80, 0x11, 0xD3, 0x63, 0x1B, 0xB6, 0x49, 0x46, 0xB2, 0x8E, 0xA2, 0xA1, 0x7E, 0x29, 0xD1, 0x98,
+    0xAB, 0x2F, 0xE4, 0xD7, 0xB1, 0x97, 0x3B, 0xC6, 0x85, 0xC4, 0x0D, 0xEC, 0x5E, 0x4F, 0xDC, 0xC0,
+    0xDE, 0x0E, 0xC4, 0x12, 0x7B, 0x7B, 0x30, 0xFB, 0x0B, 0xC8, 0xEA, 0x91, 0x77, 0xD3, 0x0E, 0x27,
+    0xE0, 0xDB, 0xF0, 0x4F, 0x4B, 0xB8, 0x68, 0x2B, 0x46, 0xEB, 0x09, 0x59, 0x97, 0x06, 0x13, 0x4C,
+    0x97, 0x0C, 0xB9, 0x27, 0xDA, 0x8A, 0xDD, 0x12, 0xDC, 0xC6, 0x62, 0x36, 0x8A, 0xB8, 0xD8, 0x1F,
+    0x3B, 0xF2, 0x1D, 0xE0, 0x67, 0x0E, 0x88, 0x65, 0x45, 0x32, 0x16, 0x0D, 0xE9, 0x60, 0xFD, 0x9A,
+    0x09, 0xD6, 0xDF, 0x34, 0x21, 0xBF, 0xA3, 0xE7, 0xFB, 0xEC, 0x9E, 0x7E, 0xDE, 0x1D, 0x20, 0x02,
+    0x3E, 0xD5, 0xFB, 0x6A, 0x12, 0xED, 0x09, 0xF4, 0x7D, 0xC1, 0x4D, 0x66, 0x4C, 0x48, 0xC6, 0x64,
+    0x34, 0x81, 0xC9, 0x7A, 0x5C, 0x59, 0x51, 0xCC, 0x4B, 0x0F, 0xD9, 0xB0, 0xD0, 0x72, 0x86, 0xB6,
+    0xAE, 0x92, 0x58, 0x7A, 0x33, 0xD8, 0xDE, 0xF6, 0xD9, 0xE0, 0x7C, 0x1A, 0xD7, 0x49, 0xC2, 0x45,
+    0x72, 0x3F, 0xB2, 0x91, 0x0C, 0xC9, 0x60, 0x42, 0xEE, 0xB3, 0xCE, 0x61, 0x6F, 0x8D, 0x14, 0x7F,
+    0xDA, 0xE1, 0x6A, 0xA8, 0x23, 0xA8, 0x27, 0x51, 0x85, 0x89, 0x60, 0x03, 0xB8, 0x86, 0x74, 0x82,
+    0x3A, 0x50, 0x8B, 0x44, 0x81, 0x6C, 0x5A, 0x26, 0x86, 0x91, 0x3A, 0xA7, 0x29, 0xD9, 0xFC, 0xD1,
+    0xA7, 0x23, 0xDE, 0x64, 0x86, 0xBA, 0xA1, 0xE8, 0x49, 0xA5, 0xE0, 0xA4, 0xCB, 0x52, 0xE4, 0xD8,
+    0xCF, 0x70, 0x91, 0x6D, 0xD8, 0x81, 0x78, 0x28, 0x8F, 0x24, 0x03, 0x65, 0xC0, 0x55, 0xB8, 0x0E,
+    0x13, 0x48, 0x86, 0x55, 0x4E, 0x07, 0xD2, 0xE5, 0x76, 0xBE, 0x8A, 0xF6, 0x11, 0x99, 0x53, 0xA7,
+    0x4E, 0x9D, 0x7A, 0x7A, 0x95, 0xD6, 0x56, 0xE9, 0x99, 0xEF, 0x5C, 0xC5, 0x45, 0xD8, 0x5D, 0xB4,
+    0xFB, 0xA1, 0x5C, 0x42, 0x51, 0x61, 0x47, 0x92, 0x48, 0x16, 0xB1, 0x9E, 0xA2, 0x5A, 0x65, 0xDB,
+    0x60, 0x1B, 0x8A, 0xEA, 0x68, 0x5B, 0xE5, 0xC2, 0x8E, 0x00, 0x45, 0xB5, 0xF7, 0x5F, 0xFE, 0xD1,
+    0xCB, 0xFF, 0xED, 0x4D, 0x33, 0x1E, 0x3F, 0x0A, 0x47, 0xA9, 0xB2, 0xEA, 0xF5, 0xDC, 0x8F, 0xB9,
+    0x1F, 0xED, 0xA5, 0x21, 0xF7, 0x83, 0x19, 0x6B, 0xDC, 0x95, 0x90, 0x8E, 0x35, 0x65, 0xD6, 0xA7,
+    0xFE, 0x3C, 0xC7, 0x39, 0x7E, 0x84, 0xA7, 0x92, 0xCE, 0x84, 0x0D, 0x4A, 0xD3, 0x27, 0x43, 0x49,
+    0x61, 0x7A, 0x7B, 0x3B, 0xDA, 0xB7, 0xA2, 0x7D, 0x6B, 0xCC, 0xBB, 0x31, 0xE9, 0x9E, 0x81, 0x23,
+    0x8B, 0x56, 0x25, 0xEB, 0x56, 0xA1, 0x26, 0x7C, 0x97, 0x4F, 0xA7, 0xAF, 0x0C, 0x51, 0x32, 0x0D,
+    0x90, 0x57, 0xAB, 0x15, 0xCA, 0xD9, 0xC5, 0x8E, 0xFF, 0x3F, 0xD3, 0x67, 0xF1, 0xF7, 0xC8, 0x83,
+    0xB9, 0xD7, 0x43, 0xBE, 0x17, 0xC0, 0xDE, 0x1E, 0xA0, 0x68, 0x46, 0x28, 0x89, 0xE0, 0xD8, 0x85,
+    0xED, 0x85, 0xBF, 0x85, 0xC9, 0x26, 0x19, 0xB1, 0xFE, 0xEF, 0xC5, 0xE4, 0x3F, 0x06, 0xD8, 0x02,
+    0x10, 0x60, 0xF6, 0x3C, 0x9C, 0xE2, 0xF5, 0x7F, 0x38, 0xA9, 0x15, 0xD5, 0xCE, 0xCA, 0xEF, 0x75,
+    0xCD, 0x04, 0xEE, 0xD6, 0xFC, 0x1B, 0x88, 0xE9, 0xFF, 0x13, 0x30, 0xF8, 0x25, 0x00, 0x78, 0x58,
+    0xBD, 0xF7, 0x39, 0x00, 0xDE, 0xDF, 0x42, 0x0A, 0xF0, 0xC7, 0x8B, 0xAD, 0x86, 0xC4, 0xC3, 0xD1,
+    0x1B, 0xC0, 0x4C, 0x72, 0x75, 0x31, 0x16, 0x66, 0x80, 0x74, 0x3C, 0x3C, 0xFC, 0x4C, 0x8A, 0xA5,
+    0xD4, 0xB7, 0xF3, 0xB5, 0x74, 0xE5, 0xC8, 0x1D, 0xF2, 0xEB, 0xAC, 0x84, 0x53, 0x44, 0x0A, 0x66,
+    0xF8, 0x94, 0xD7, 0x67, 0x7F, 0xB1, 0xF9, 0xA2, 0x5B, 0xF0, 0xA7, 0x3D, 0x49, 0x56, 0x8A, 0xF0,
+    0xF2, 0xE3, 0x3D, 0xA1, 0xD5, 0x4E, 0xD1, 0x67, 0xA6, 0x2F, 0xBB, 0xDF, 0x04, 0x28, 0x21, 0x99,
+    0xE1, 0xF4, 0x59, 0x92, 0xEE, 0x34, 0x47, 0x38, 0xB2, 0xDF, 0x59, 0x21, 0x85, 0x56, 0x7A, 0x45,
+    0x0F, 0x7F, 0x96, 0x7B, 0x28, 0x3F, 0xE1, 0xC7, 0xAE, 0x3A, 0x92, 0xBC, 0xED, 0x9E, 0xEC, 0xC8,
+    0x83, 0xDB, 0xDC, 0xAC, 0x56, 0xF8, 0xDA, 0x3E, 0xCE, 0xB8, 0x04, 0x5B, 0x0E, 0x47, 0x64, 0xCA,
+    0x42, 0x36, 0x94, 0xDD, 0xA1, 0x91, 0x7D, 0xC9, 0x9D, 0x1D, 0x67, 0x83, 0xBC, 0x4B, 0x07, 0x4E,
+    0x1C, 0x00, 0x21, 0x91, 0xCF, 0xFA, 0x4C, 0xAB, 0xCF, 0xCC, 0x9C, 0xCC, 0x89, 0x12, 0x25, 0x32,
+    0x97, 0xBA, 0x70, 0xE1, 0x90, 0xAA, 0xF8, 0xBB, 0xC0, 0x3F, 0xB0, 0xA4, 0x23, 0x7F, 0xD1, 0x9F,
+    0xC9, 0xFE, 0x84, 0xDF, 0x79, 0xFC, 0x9F, 0x24, 0x1E, 0x32, 0xFB, 0x9F, 0x2C, 0x3A, 0xA6, 0x55,
+    0xD1, 0x33, 0x53, 0xF4, 0x89, 0x28, 0x42, 0x22, 0x8A, 0x6A, 0xB7, 0x6C, 0x26, 0xE7, 0x67, 0xE7,
+    0x9F, 0x5C, 0x77, 0x27, 0xA0, 0x7E, 0x52, 0xEB, 0x7F, 0x46, 0xAE, 0x0E, 0xE5, 0x06, 0xD7, 0x50,
+    0x37, 0xD4, 0x7E, 0x95, 0x4D, 0xFF, 0x3D, 0x38, 0xD3, 0x75, 0x70, 0xE7, 0x6E, 0x85, 0x79, 0x36,
+    0xC2, 0x11, 0xF6, 0x77, 0x69, 0xC1, 0xA5, 0xD3, 0x02, 0xA2, 0x99, 0xE0, 0x02, 0x85, 0x57, 0x4F,
+    0x6D, 0xE4, 0x93, 0x68, 0xD5, 0xE4, 0xC1, 0xD5, 0x94, 0x97, 0xE2, 0xCC, 0xCD, 0xEC, 0xC3, 0x98,
+    0x8E, 0xC5, 0xDE, 0x68, 0xFB, 0x36, 0x0B, 0xEE, 0x95, 0x68, 0xBB, 0x29, 0x0F, 0xC5, 0xDE, 0x50,
+    0x7A, 0xF7, 0x42, 0x27, 0xDA, 0xFA, 0xB9, 0x89, 0x79, 0xB2, 0x43, 0xAA, 0xE0, 0x3A, 0x23, 0xAF,
+    0x2A, 0x97, 0x59, 0x22, 0xEE, 0xAF, 0xF3, 0xA4, 0x6D, 0x70, 0xD5, 0xE1, 0x01, 0x7E, 0xA5, 0x38,
+    0xDB, 0xB2, 0xD4, 0xC8, 0x9A, 0x7D, 0xDB, 0x50, 0x1C, 0x18, 0x88, 0xCF, 0x4B, 0x5F, 0x31, 0x7F,
+    0x47, 0x0E, 0x8C, 0x55, 0x0B, 0xA4, 0xF7, 0x3C, 0xE4, 0xBC, 0xCE, 0xA1, 0xC5, 0xF9, 0x15, 0x33,
+    0x04, 0x60, 0x9B, 0x2D, 0x28, 0xFC, 0x4D, 0x28, 0xBD, 0xC0, 0x79, 0xFD, 0xC3, 0x49, 0xE8, 0x38,
+    0x4B, 0x78, 0xB9, 0x82, 0xDC, 0x2A, 0x0E, 0x42, 0xE2, 0xFD, 0x3D, 0x88, 0x97, 0x9C, 0x5F, 0xD0,
+    0xB3, 0x79, 0x85, 0x9E, 0xA5, 0x4F, 0xA2, 0x67, 0x77, 0xC7, 0xCF, 0x46, 0xCF, 0x2A, 0x8A, 0xBD,
+    0x91, 0x24, 0x96, 0x9E, 0xF2, 0xF6, 0x4C, 0x16, 0x8B, 0xF9, 0x35, 0x5D, 0x92, 0x34, 0x58, 0x49,
+    0xCB, 0xFE, 0x4E, 0x7B, 0xC0, 0xC7, 0x53, 0x40, 0xDA, 0xAD, 0xE2, 0xE9, 0xBC, 0x59, 0x76, 0x98,
+    0x3F, 0x3F, 0x25, 0x2F, 0x7D, 0x55, 0x8C, 0xB1, 0x9A, 0xDB, 0xE9, 0x08, 0xFC, 0x45, 0x0F, 0x67,
+    0xB2, 0x86, 0x63, 0x87, 0x35, 0xD4, 0x57, 0x06, 0x33, 0x6E, 0xA5, 0x61, 0xC1, 0xF5, 0x66, 0x33,
+    0x60, 0x43, 0xDD, 0x7C, 0x52, 0x24, 0xC9, 0x97, 0x2A, 0x92, 0xE6, 0xF3, 0x45, 0xB2, 0x05, 0x8C,
+    0x8B, 0xD9, 0x58, 0x6D, 0xB3, 0x9E, 0xFB, 0x25, 0xA5, 0x86, 0xFC, 0xAF, 0xDA, 0x6A, 0x48, 0xC6,
+    0xB3, 0xD8, 0xCB, 0x9E, 0xB8, 0x46, 0xBE, 0xE7, 0x89, 0x6B, 0xD8, 0xBD, 0x3E, 0x8B, 0x4E, 0xBA,
+    0x23, 0x4D, 0xB9, 0x7E, 0xDD, 0x9D, 0x1C, 0x37, 0x48, 0x3A, 0x58, 0x5B, 0x74, 0xC7, 0xB0, 0x52,
+    0x1C, 0x9F, 0x4C, 0xBF, 0x71, 0x9B, 0x00, 0x0B, 0xA2, 0x6F, 0x77, 0x31, 0xFE, 0x0D, 0x5E, 0x4D,
+    0xFC, 0x17, 0x42, 0x9A, 0x72, 0xEF, 0x98, 0x4C, 0xB0, 0x5D, 0x9D, 0xCC, 0xF9, 0xF0, 0xDB, 0xF0,
+    0xF3, 0xF7, 0x04, 0x96, 0xDA, 0x07, 0x7C, 0x0D, 0x4E, 0x7B, 0x78, 0x19, 0x5E, 0xA7, 0xF4, 0x9C,
+    0x58, 0x4E, 0xAE, 0x34, 0xCB, 0xA2, 0xFC, 0xAF, 0x9F, 0x94, 0xCD, 0x17, 0x02, 0x8C, 0x08, 0x70,
+    0x7A, 0x51, 0xDA, 0x17, 0x97, 0xB6, 0x3F, 0x2F, 0x7D, 0xA1, 0xE6, 0x8F, 0x2D, 0xB3, 0xC2, 0x75,
+    0xD8, 0xBC, 0x32, 0xCD, 0xA9, 0x4F, 0xB4, 0x99, 0xCE, 0x24, 0x9A, 0xD8, 0xE2, 0x75, 0x5B, 0x99,
+    0x5B, 0x3D, 0x6B, 0xE5, 0x75, 0xDD, 0x93, 0xE6, 0xF5, 0x17, 0x31, 0x1D, 0x6C, 0xAC, 0xF6, 0x60,
+    0x1E, 0xFC, 0xD0, 0xB7, 0x8A, 0x89, 0xE4, 0xD3, 0xB6, 0x03, 0xD8, 0x48, 0x86, 0x2C, 0x94, 0x4D,
+    0x6B, 0xA2, 0x0D, 0xCE, 0xFF, 0xF6, 0x6D, 0x7E, 0x93, 0xAC, 0x63, 0x9B, 0x2C, 0x70, 0x94, 0xD5,
+    0x94, 0xB9, 0xC0, 0x69, 0xB2, 0x26, 0x59, 0x2A, 0x79, 0x73, 0x18, 0x5E, 0x9D, 0x48, 0xFD, 0x5A,
+    0xDE, 0x84, 0xF2, 0x71, 0xA7, 0xFD, 0xE9, 0x64, 0x95, 0xCF, 0xA6, 0xA1, 0x34, 0xC1, 0x99, 0xE0,
+    0x2A, 0x20, 0xE9, 0xB1, 0x9E, 0x47, 0xFE, 0xA9, 0xD4, 0x5F, 0x4D, 0x56, 0xC2, 0x7D, 0x86, 0xA4,
+    0x27, 0x6B, 0x38, 0x0D, 0x17, 0x56, 0xD5, 0xB3, 0xB0, 0x43, 0x1A, 0xB0, 0x2B, 0x00, 0xC2, 0x0C,
+    0x00, 0x45, 0xB3, 0x5B, 0x36, 0xBB, 0xCE, 0xCF, 0x4F, 0x98, 0x83, 0xA7, 0xE0, 0xF4, 0xA7, 0xF2,
+    0x59, 0x28, 0xA1, 0x7C, 0xD2, 0x65, 0xD9, 0x32, 0x95, 0xBD, 0xF0, 0x3D, 0xEE, 0xBC, 0xCF, 0xA9,
+    0xAC, 0x3F, 0x24, 0xA1, 0x77, 0x66, 0x0A, 0x4D, 0x89, 0x9E, 0x0F, 0x85, 0xB7, 0xAF, 0x0C, 0xDC,
+    0x58, 0x81, 0x48, 0x25, 0xF9, 0x0A, 0x44, 0xDA, 0x7B, 0x0C, 0x22, 0xB9, 0xCA, 0x2E, 0x22, 0x5F,
+    0xB9, 0x85, 0x03, 0x1C, 0xBD, 0xFA, 0x49, 0x0B, 0x3E, 0x93, 0x6A, 0x66, 0xFE, 0xE7, 0x43, 0x41,
+    0xB6, 0xD7, 0xB3, 0xBE, 0x8E, 0xB9, 0xD7, 0x51, 0xAE, 0x93, 0x7E, 0xD4, 0xB3, 0xE1, 0xAA, 0xFC,
+    0x8E, 0x3E, 0x88, 0x56, 0xAA, 0x4A, 0x75, 0xCB, 0x29, 0x90, 0x1E, 0x4E, 0x3D, 0x9E, 0x76, 0xD5,
+    0xDF, 0x19, 0x36, 0xFE, 0xE6, 0xCD, 0xE7, 0x8B, 0x27, 0x54, 0xF7, 0x9C, 0xCE, 0x9A, 0xAC, 0x7A,
+    0xEA, 0xB7, 0x6D, 0x30, 0xEB, 0x8B, 0xEA, 0x66, 0x3A, 0xE4, 0xC1, 0x35, 0x32, 0xF1, 0x4B, 0xE0,
+    0xF0, 0xE8, 0xA2, 0x31, 0x93, 0x71, 0x09, 0xB1, 0x0E, 0x0E, 0xA6, 0x98, 0x03, 0x3C, 0x69, 0x5C,
+    0x3F, 0xC0, 0x93, 0xF6, 0xFA, 0x05, 0x4F, 0x0A, 0xC4, 0xB2, 0x72, 0xB7, 0x96, 0x3D, 0x34, 0x2F,
+    0xED, 0x18, 0xFD, 0xCA, 0x27, 0x2F, 0x2E, 0xA7, 0x70, 0xD6, 0x96, 0x80, 0x3C, 0x2C, 0xEE, 0xFD,
+    0x67, 0xA4, 0x2F, 0xD6, 0x34, 0x90, 0x2C, 0x41, 0x81, 0xDD, 0xC1, 0x34, 0x81, 0x6E, 0x7F, 0x1A,
+    0xF3, 0x85, 0xE0, 0x2F, 0xEB, 0x37, 0x88, 0x59, 0x28, 0x7C, 0x9B, 0x4E, 0x36, 0xFC, 0xB6, 0xDC,
+    0x1D, 0xD3, 0x3B, 0xD7, 0x5E, 0x9B, 0x57, 0x87, 0x52, 0x9B, 0xF2, 0xC1, 0x8F, 0x24, 0x75, 0x65,
+    0xA0, 0xEE, 0xD8, 0x3F, 0x3F, 0x91, 0x07, 0xD0, 0xB2, 0xE6, 0x5D, 0x07, 0x0B, 0x98, 0x86, 0x03,
+    0x23, 0x79, 0xEB, 0x97, 0xF3, 0x1C, 0xFD, 0x12, 0x05, 0xAD, 0xD0, 0x36, 0xB7, 0x6C, 0x0C, 0xD9,
+    0x1E, 0x54, 0x2D, 0x27, 0x89, 0x3A, 0xA8, 0x1F, 0x6C, 0xB6, 0x4B, 0x1C, 0xA8, 0x69, 0xF3, 0xA5,
+    0x44, 0xAB, 0x3E, 0x25, 0x49, 0x21, 0x59, 0x1D, 0xA2, 0x3D, 0xA6, 0xF7, 0xF7, 0xB7, 0xF0, 0xFF,
+    0x08, 0x4E, 0x3E, 0x48, 0x35, 0x50, 0xEA, 0xDD, 0x21, 0xAF, 0xDC, 0x9F, 0xB5, 0x81, 0xD7, 0x0B,
+    0xB2, 0xC0, 0x69, 0xDB, 0x30, 0xFD, 0x58, 0x7B, 0x1D, 0xA5, 0x14, 0x06, 0xF2, 0x5F, 0x54, 0xAC,
+    0x2F, 0x01, 0x57, 0xB3, 0x5A, 0x63, 0xB5, 0x87, 0xFA, 0x91, 0xF4, 0xD3, 0x0B, 0x56, 0x6A, 0x35,
+    0xD3, 0xEA, 0x8A, 0xD4, 0x64, 0x33, 0x27, 0xE7, 0xEA, 0x53, 0x5B, 0x28, 0x47, 0x37, 0x37, 0x37,
+    0x5F, 0xC4, 0x2C, 0x3C, 0x38, 0x69, 0x75, 0xEA, 0x04, 0x68, 0xAF, 0x8C, 0x6E, 0x2F, 0x96, 0x7E,
+    0xB2, 0xA1, 0xF8, 0x70, 0x2E, 0xDF, 0x8A, 0xEE, 0xF2, 0xD0, 0xD2, 0xFE, 0x64, 0xA8, 0xAF, 0x8C,
+    0x6E, 0x6F, 0x74, 0x7B, 0x63, 0x79, 0x3B, 0xDA, 0x3B, 0x93, 0x0D, 0x73, 0xF1, 0xA1, 0x8A, 0x77,
+    0xA7, 0xF2, 0xAD, 0x58, 0xDE, 0x8E, 0xEE, 0xF2, 0xE8, 0x9E, 0x1F, 0xDA, 0x7C, 0x79, 0x41, 0x26,
+    0x30, 0x12, 0x1D, 0x85, 0xB7, 0x6F, 0x86, 0x34, 0x26, 0xB1, 0xAD, 0x9C, 0x2F, 0xBB, 0xFF, 0x0B,
+    0x9D, 0x98, 0x31, 0x90, 0xDD, 0xD6, 0x75, 0x86, 0x3F, 0xE0, 0xCA, 0xC4, 0x8C, 0x30, 0xF1, 0x75,
+    0x21, 0x8D, 0x3C, 0x51, 0x4C, 0xD4, 0x76, 0x24, 0xA2, 0x71, 0x91, 0x78, 0xDE, 0x7B, 0x17, 0x22,
+    0x0B, 0x17, 0x29, 0xA2, 0x42, 0x92, 0x0B, 0x15, 0x6A, 0x54, 0x25, 0x99, 0xA1, 0x0B, 0x16, 0x9B,
+    0x99, 0xE5, 0x02, 0x31, 0x4B, 0x15, 0x52, 0xA3, 0xDE, 0x93, 0x2A, 0xB3, 0xCA, 0x0C, 0x59, 0xB0,
+    0x58, 0x67, 0xDE, 0xF2, 0x5D, 0xF2, 0x15, 0x2C, 0x5C, 0x08, 0xE2, 0x4A, 0x71, 0x91, 0x42, 0x70,
+    0x56, 0x19, 0x7B, 0xA4, 0xC9, 0xF0, 0x52, 0x02, 0x13, 0x90, 0xBC, 0xC0, 0x9F, 0x02, 0xBB, 0xA4,
+    0x69, 0xCB, 0x76, 0xC6, 0x18, 0xBC, 0x73, 0xCE, 0xBD, 0xC0, 0xC3, 0x3D, 0xF7, 0x9C, 0x83, 0xFF,
+    0xFC, 0xEF, 0xA5, 0xD5, 0xB7, 0x93, 0xCE, 0x56, 0xBB, 0xA6, 0xE5, 0xF4, 0x30, 0xD2, 0x20, 0x4D,
+    0x4B, 0xB0, 0x15, 0xA6, 0x85, 0x1E, 0x96, 0x60, 0xA5, 0xAD, 0x14, 0x86, 0x79, 0xF0, 0xF8, 0x8A,
+    0x93, 0xDE, 0x95, 0x8E, 0xE7, 0xEF, 0xC0, 0x1E, 0xC0, 0x06, 0x40, 0x15, 0x24, 0xF2, 0x60, 0x7E,
+    0xD5, 0x42, 0x76, 0xD4, 0x41, 0x7E, 0x2B, 0x80, 0xFD, 0xA7, 0x1E, 0x8A, 0x2A, 0x82, 0x63, 0x0D,
+    0x2B, 0xF6, 0xE0, 0x10, 0x07, 0x91, 0xB2, 0x4A, 0x06, 0x6C, 0x63, 0x24, 0x79, 0x23, 0xA9, 0xCB,
+    0x25, 0x05, 0xFB, 0x5F, 0xAF, 0xFF, 0xA8, 0x2F, 0x3C, 0x66, 0x28, 0x3D, 0x69, 0x74, 0x0D, 0xC9,
+    0xE8, 0xA4, 0xED, 0xC3, 0xFD, 0x7F, 0x71, 0x60, 0x02, 0x9C, 0xA8, 0x12, 0x52, 0x4D, 0x94, 0x9F,
+    0x4F, 0x69, 0xA0, 0x2F, 0x31, 0xB7, 0x02, 0x8B, 0xA2, 0x32, 0x1F, 0xF5, 0xAC, 0x8B, 0xFD, 0xCD,
+    0x4D, 0x69, 0x28, 0xA4, 0x44, 0x53, 0xE5, 0xD4, 0x31, 0x7D, 0xD0, 0x9B, 0x36, 0x09, 0xB6, 0x4A,
+    0xDB, 0x25, 0x59, 0xD3, 0xF3, 0xB2, 0x69, 0xD3, 0x60, 0x35, 0xE1, 0x34, 0xD2, 0x53, 0x9B, 0x96,
+    0x95, 0xAD, 0x58, 0x2F, 0x31, 0xA1, 0xA7, 0xD8, 0x3E, 0xFC, 0x40, 0x56, 0xEA, 0x9D, 0x54, 0x49,
+    0x1D, 0x40, 0x2A, 0xC5, 0x52, 0xBA, 0x73, 0xB2, 0xF6, 0x13, 0x4F, 0x1C, 0x98, 0x1E, 0x5C, 0xF5,
+    0x94, 0x6A, 0x30, 0xC3, 0x13, 0xE5, 0x4F, 0xC2, 0x9D, 0x4A, 0x2D, 0xA5, 0x46, 0x4C, 0x67, 0x3A,
+    0x96, 0xAC, 0x30, 0xED, 0xD7, 0x1A, 0x0B, 0x1C, 0xC6, 0x9B, 0xC0, 0x02, 0x47, 0xEE, 0x4D, 0x48,
+    0x06, 0x1C, 0x0E, 0x13, 0xCA, 0x87, 0xFB, 0x9B, 0x7F, 0x96, 0x34, 0x15, 0x92, 0xDA, 0x01, 0x76,
+    0x6D, 0x43, 0xEE, 0x5F, 0x83, 0xD7, 0x00, 0x3B, 0xA7, 0xA7, 0xFF, 0xDD, 0xC4, 0x59, 0x69, 0xDB,
+    0x3D, 0xCE, 0xEF, 0x7C, 0x45, 0x9A, 0x9E, 0xA4, 0x34, 0x19, 0x19, 0xD9, 0x90, 0x46, 0xD3, 0x67,
+    0x01, 0x33, 0xD8, 0xD6, 0x35, 0x64, 0xC1, 0x9D, 0x8F, 0x60, 0xBB, 0xD1, 0xB6, 0x60, 0x8F, 0x7A,
+    0x01, 0xE5, 0x87, 0xBF, 0x0A, 0x80, 0xDB, 0xA8, 0x01, 0x6A, 0x45, 0x00, 0xA9, 0x9D, 0xD5, 0x5C,
+    0x56, 0x03, 0x80, 0x53, 0x3F, 0xD7, 0x58, 0x0F, 0x38, 0xA9, 0x07, 0x23, 0xA9, 0x07, 0xF7, 0x48,
+    0x9B, 0x1E, 0xA3, 0x0F, 0xA7, 0xBA, 0xC7, 0x45, 0x37, 0x6C, 0x7A, 0xA3, 0x56, 0x9D, 0xFA, 0x72,
+    0x32, 0xF2, 0xEA, 0xCF, 0xE8, 0xBD, 0x4C, 0x4A, 0xDE, 0x7F, 0x31, 0xC0, 0xE5, 0x53, 0x87, 0x93,
+    0x9E, 0x24, 0xA6, 0x1A, 0xD8, 0x4C, 0x90, 0x05, 0x58, 0x41, 0xEE, 0x49, 0xEF, 0x91, 0xC4, 0x07,
+    0x6F, 0x4C, 0xF3, 0x2E, 0xD9, 0x3C, 0x98, 0x83, 0x1D, 0xE1, 0x35, 0x13, 0xC8, 0x06, 0xEB, 0x71,
+    0x9D, 0x23, 0x91, 0x8F, 0x58, 0x99, 0x9E, 0x3A, 0xDA, 0x36, 0x55, 0x70, 0x95, 0xFD, 0xD4, 0x4F,
+    0xDC, 0x70, 0x66, 0x30, 0x7D, 0xCC, 0xBB, 0xF2, 0x76, 0x5F, 0xFA, 0xB1, 0x68, 0x37, 0x79, 0xA8,
+    0xCF, 0x47, 0xF7, 0xCA, 0x94, 0x7D, 0x19, 0xB3, 0xA1, 0xF8, 0xB0, 0x2D, 0xBA, 0x7A, 0x43, 0x7D,
+    0x53, 0x7D, 0xA2, 0x4C, 0x3E, 0x8B, 0x76, 0xA2, 0x08, 0x2E, 0x50, 0x7B, 0xF3, 0x71, 0xDA, 0x90,
+    0xF3, 0x4D, 0x38, 0xCB, 0x75, 0x70, 0x6A, 0xA0, 0xEC, 0x81, 0x67, 0xF8, 0x8D, 0xE3, 0xF9, 0xDF,
+    0xEB, 0x4E, 0x2E, 0xD3, 0xE3, 0x7E, 0xCB, 0x9D, 0x74, 0x30, 0xE1, 0x4F, 0x73, 0x27, 0xEB, 0xF2,
+    0x90, 0xF6, 0x59, 0xE0, 0xD0, 0x0C, 0x94, 0xE7, 0x23, 0xD6, 0x8F, 0x98, 0x20, 0x88, 0x35, 0x38,
+    0xD7, 0x60, 0xEF, 0x7A, 0x32, 0xB5, 0x24, 0x0A, 0x50, 0x0F, 0x50, 0xAA, 0x22, 0x57, 0x4F, 0xFA,
+    0x50, 0x15, 0x93, 0xEB, 0x71, 0x57, 0x54, 0xD9, 0xAE, 0xEE, 0x4D, 0x9F, 0xAB, 0x1A, 0x51, 0xEF,
+    0x2A, 0xAB, 0x8A, 0xD7, 0x5F, 0x7F, 0x35, 0x93, 0x7C, 0x21, 0xB1, 0xC7, 0x3A, 0x19, 0xD2, 0x90,
+    0xB5, 0xB9, 0x2F, 0x2B, 0xC7, 0x21, 0x31, 0x0D, 0x26, 0xE4, 0xDE, 0xFA, 0x12, 0x47, 0x24, 0x9A,
+    0x60, 0x82, 0xF5, 0xD6, 0x3B, 0x5C, 0x32, 0x10, 0xF3, 0xCE, 0x04, 0x55, 0xF6, 0xF6, 0x80, 0x7B,
+    0x1C, 0x92, 0x4D, 0x85, 0xBB, 0x25, 0x12, 0xE5, 0x11, 0x1B, 0xCF, 0x0D, 0xEC, 0x85, 0x7F, 0x0B,
+    0xE9, 0x17, 0xDB, 0xE3, 0xD6, 0x5E, 0xB4, 0x1F, 0xFA, 0xF5, 0xDA, 0x15, 0x17, 0xFE, 0x33, 0xC4,
+    0x55, 0xF9, 0x37, 0xDB, 0x10, 0x63, 0x69, 0x6F, 0xAA, 0x8B, 0xCE, 0xE8, 0x42, 0x88, 0x36, 0xDA,
+    0x6D, 0x28, 0x3A, 0x67, 0xBD, 0xAB, 0xA2, 0x03, 0x13, 0x22, 0xD8, 0xED, 0xFC, 0x26, 0x02, 0x1C,
+    0x82, 0x4B, 0x7B, 0x88, 0xB6, 0xC5, 0x04, 0x57, 0x61, 0xDB, 0x11, 0xDC, 0x85, 0x1E, 0x46, 0xDB,
+    0x62, 0x7A, 0xD7, 0x60, 0xDB, 0x09, 0xDC, 0x85, 0x01, 0x26, 0xDB, 0x61, 0x06, 0x27, 0xA9, 0x93,
+    0xA4, 0x2B, 0x92, 0x26, 0x2B, 0x69, 0x70, 0x9F, 0xEF, 0x6F, 0x82, 0xA0, 0xDE, 0x46, 0x12, 0xD9,
+    0x40, 0x16, 0x9D, 0xA7, 0xB8, 0x27, 0xA8, 0x3D, 0x67, 0xF4, 0x19, 0xD4, 0x12, 0xA9, 0xDE, 0x57,
+    0x9B, 0x45, 0x8A, 0x60, 0x03, 0xD9, 0x50, 0x9C, 0xC0, 0x16, 0xA3, 0x03, 0x6E, 0x38, 0x60, 0xCF,
+    0x01, 0xF5, 0x1E, 0xE0, 0x1C, 0xB0, 0x9A, 0xE7, 0x2A, 0x98, 0x5C, 0x4B, 0x3A, 0x16, 0xD3, 0xEB,
+    0x17, 0xA3, 0x95, 0x34, 0x64, 0x92, 0x42, 0x2A, 0xA9, 0x65, 0x23, 0x55, 0xF3, 0x1A, 0x4F, 0x80,
+    0x7A, 0x72, 0xD2, 0x71, 0xC7, 0xB9, 0x15, 0xE6, 0xB8, 0x63, 0xB5, 0xC2, 0x1C, 0x07, 0x56, 0x0E,
+    0xF3, 0x55, 0xC0, 0xFD, 0x11, 0x15, 0x0A, 0x0D, 0xD4, 0x9A, 0x92, 0xFB, 0x6F, 0x8C, 0xB9, 0x27,
+    0x96, 0x24, 0xFD, 0x9A, 0xEC, 0x4E, 0xA0, 0xFC, 0x5B, 0x9F, 0x46, 0x27, 0xB5, 0xD2, 0x64, 0xA4,
+    0xC6, 0x76, 0xE0, 0x2A, 0x18, 0xC1, 0x0C, 0x60, 0x3B, 0xA8, 0x1B, 0x92, 0x09, 0xB2, 0x08, 0x45,
+    0x80, 0xFA, 0x14, 0xCD, 0x48, 0xAE, 0x0E, 0x24, 0x92, 0x47, 0x8A, 0xB8, 0x0E, 0x6C, 0x0F, 0xE9,
+    0xC8, 0xFC, 0x84, 0x2C, 0x00, 0x37, 0x00, 0xDB, 0xCE, 0xE5, 0x3F, 0x1B, 0x13, 0xF3, 0x7D, 0xA8,
+    0xE3, 0x19, 0xAB, 0x87, 0x7F, 0xEF, 0x6B, 0x29, 0x1A, 0xCD, 0xC5, 0x15, 0x71, 0x92, 0xA7, 0x3E,
+    0xD9, 0x7A, 0x2D, 0xE9, 0x9E, 0x24, 0xDD, 0xD6, 0xD5, 0xCF, 0x75, 0x92, 0xE2, 0xC8, 0x8C, 0xBC,
+    0x58, 0xCF, 0x6F, 0x4F, 0x15, 0x1E, 0xA8, 0x81, 0x24, 0x72, 0xE2, 0x42, 0xE1, 0x4F, 0xDA, 0x54,
+    0x3A, 0x02, 0x79, 0x0F, 0x94, 0xED, 0x5C, 0x82, 0xF3, 0x14, 0x30, 0x90, 0xDF, 0x0C, 0xAC, 0x4C,
+    0x47, 0x9F, 0xB5, 0xB9, 0xB7, 0xDE, 0x51, 0x54, 0x03, 0x2E, 0x6B, 0xB9, 0xE1, 0x60, 0x8C, 0xA4,
+    0xEA, 0x30, 0x6A, 0xC8, 0x47, 0xB0, 0x61, 0xC6, 0xF4, 0x09, 0xF2, 0x40, 0x22, 0x9F, 0x2A, 0x92,
+    0xCB, 0xCF, 0xAF, 0x3E, 0x4F, 0xC0, 0x7E, 0x60, 0xEF, 0xAD, 0x4F, 0x0E, 0xB3, 0xA6, 0x64, 0xF1,
+    0x12, 0x6B, 0x2E, 0x85, 0x34, 0x24, 0xC7, 0x3E, 0xF7, 0xD9, 0xBB, 0x55, 0xC9, 0xAA, 0xFC, 0x78,
+    0x7C, 0xA1, 0x77, 0x92, 0x7C, 0x2D, 0x45, 0x4A, 0x4D, 0xD5, 0xC9, 0x4E, 0xFA, 0xD3, 0x60, 0xB9,
+    0x0A, 0x18, 0x9F, 0x9A, 0x62, 0xDE, 0x78, 0xD2, 0x9B, 0x80, 0x09, 0xE9, 0x80, 0xF5, 0x44, 0xCA,
+    0x86, 0x9A, 0x1A, 0xCA, 0x66, 0x04, 0x7B, 0x67, 0x80, 0xEC, 0x51, 0x00, 0xA3, 0x16, 0x90, 0x7F,
+    0xAA, 0x47, 0xAB, 0x03, 0xAB, 0x1E, 0xCA, 0xE3, 0x08, 0xF5, 0xAD, 0x09, 0x54, 0xA9, 0x4A, 0x45,
+    0xED, 0xB3, 0x48, 0x19, 0xEC, 0x80, 0x1D, 0x5C, 0x20, 0x1B, 0x01, 0x7A, 0xAC, 0x69, 0x59, 0xD8,
+    0x8A, 0xB0, 0xC2, 0xF8, 0x81, 0xC2, 0x74, 0xEC, 0xDA, 0x26, 0x09, 0x2B, 0xB2, 0xA7, 0x87, 0xB9,
+    0x1F, 0x28, 0x4D, 0xC7, 0xDA, 0x36, 0x69, 0x70, 0x52, 0x94, 0xF4, 0x95, 0xA4, 0x06, 0x96, 0x40,
+    0x0F, 0x99, 0x87, 0x3F, 0xE7, 0x39, 0x92, 0x0B, 0x9E, 0xC5, 0x02, 0xB3, 0xFD, 0x4D, 0x95, 0x6D,
+    0x5B, 0x76, 0x97, 0xE4, 0x47, 0x1D, 0x63, 0xD9, 0xD4, 0xAD, 0x34, 0xE6, 0x7A, 0xD4, 0xBE, 0x38,
+    0x5C, 0x86, 0xAC, 0x85, 0xCB, 0x90, 0xB7, 0x70, 0x03, 0xF2, 0x0E, 0xC0, 0x84, 0x33, 0xD5, 0xAE,
+    0x23, 0x9A, 0x6D, 0xB0, 0x7E, 0xB1, 0x62, 0x6D, 0xB6, 0x5D, 0xFE, 0x07, 0x8C, 0x66, 0xB1, 0xE2,
+    0xC0, 0x6C, 0xBB, 0xAC, 0x59, 0xAC, 0xD8, 0x99, 0x0D, 0xB7, 0x3F, 0x7D, 0xB0, 0x95, 0x14, 0x9D,
+    0xA4, 0xB9, 0xB2, 0x1D, 0x6F, 0x67, 0x7E, 0x45, 0x34, 0xA7, 0x62, 0xFD, 0x07, 0xC4, 0x72, 0x16,
+    0x07, 0xC6, 0x2F, 0xD9, 0xF9, 0x1D, 0xE1, 0x24, 0x8D, 0x8F, 0x45, 0x04, 0x58, 0x9F, 0xD6, 0x2B,
+    0x03, 0x40, 0xBF, 0x7F, 0x00, 0x4E, 0x60, 0xE5, 0x21, 0x09, 0xC0, 0x2E, 0x50, 0x30, 0xC7, 0x2A,
+    0x09, 0x40, 0xAD, 0x86, 0x62, 0x7F, 0x24, 0xF3, 0x99, 0x4F, 0x02, 0x3B, 0xEC, 0x62, 0x29, 0x30,
+    0x3E, 0xF3, 0x69, 0x48, 0xC2, 0x0B, 0x91, 0x5A, 0x23, 0x85, 0x26, 0xF2, 0xB9, 0xF1, 0x92, 0xFF,
+    0xB2, 0x03, 0xCA, 0xDB, 0x0D, 0xB0, 0x29, 0x80, 0x34, 0xEE, 0x02, 0xD9, 0xBD, 0x00, 0x14, 0xB7,
+    0x3D, 0x50, 0x17, 0x40, 0x12, 0x6B, 0x35, 0x64, 0xF7, 0x1E, 0x5E, 0x6D, 0x29, 0x6E, 0xFB, 0xCC,
+    0x53, 0x17, 0x64, 0x4D, 0x12, 0x77, 0xB1, 0x64, 0xF7, 0x02, 0x0B, 0x8A, 0xDB, 0x3E, 0x0D, 0x6C,
+    0x8A, 0xA4, 0xF6, 0xE9, 0x58, 0x6B, 0x24, 0xBF, 0x2F, 0x75, 0xB8, 0xFF, 0xD0, 0x00, 0x6A, 0x80,
+    0xB3, 0x90, 0x35, 0x24, 0x01, 0x76, 0xA1, 0x80, 0xCC, 0x93, 0x04, 0xA8, 0xD5, 0x14, 0xFB, 0x63,
+    0xE6, 0xB3, 0x9B, 0x81, 0x9D, 0x5D, 0x6C, 0x81, 0xB9, 0xED, 0xD3, 0x7B, 0xE1, 0x85, 0x58, 0x6B,
+    0x2C, 0x34, 0xE5, 0x1A, 0x20, 0x9F, 0x2A, 0x72, 0x89, 0x74, 0x48, 0x46, 0x0E, 0x31, 0xC1, 0x36,
+    0xD8, 0xE6, 0xD5, 0x39, 0x4C, 0x59, 0xCB, 0xDF, 0xED, 0x1F, 0x92, 0x4B, 0x1D, 0x1B, 0x4D, 0x80,
+    0xE9, 0x98, 0x79, 0xA7, 0x3D, 0x1A, 0xC9, 0xC6, 0x52, 0x57, 0x75, 0x53, 0xD2, 0x60, 0x25, 0xCD,
+    0xC8, 0x71, 0x51, 0xEF, 0x01, 0xB0, 0x22, 0x9F, 0xB0, 0x4D, 0xA1, 0xDE, 0x74, 0x45, 0x53, 0x56,
+    0x83, 0x6D, 0xD2, 0xB0, 0xCA, 0x3C, 0x4B, 0xFB, 0x93, 0x0E, 0x7B, 0xA5, 0xEB, 0x49, 0xC3, 0xB0,
+    0x84, 0xF5, 0xCA, 0x42, 0x61, 0xBF, 0xF0, 0x64, 0x5B, 0xF5, 0xA4, 0xE1, 0xC1, 0x1E, 0xC4, 0xA5,
+    0xF5, 0xEC, 0xD9, 0x0B, 0x23, 0xF5, 0x85, 0x76, 0x23, 0xF9, 0xDE, 0x4A, 0xED, 0x12, 0xA9, 0xB5,
+    0xD5, 0x19, 0x35, 0xC0, 0xF3, 0xAF, 0x52, 0xA8, 0x47, 0xEA, 0xD3, 0x81, 0xEB, 0xA6, 0xE3, 0xC0,
+    0xB4, 0x1C, 0x64, 0x2D, 0x07, 0xA6, 0xE3, 0xC0, 0x0C, 0x1C, 0xA4, 0xFA, 0x3C, 0xB2, 0x51, 0xA4,
+    0x54, 0x44, 0x8A, 0x66, 0x4C, 0x63, 0x16, 0x92, 0x98, 0x77, 0x69, 0xB4, 0xF3, 0x67, 0x2C, 0xBA,
+    0x74, 0x2C, 0xBB, 0x74, 0x74, 0x9D, 0x19, 0x5D, 0x30, 0x13, 0xC0, 0x99, 0xF1, 0xC7, 0xA9, 0x54,
+    0xDD, 0x78, 0xB3, 0xB7, 0x55, 0xF1, 0x93, 0x8E, 0x61, 0x81, 0xDD, 0x7A, 0xD6, 0xB3, 0x8A, 0x2B,
+    0xEA, 0xAD, 0x34, 0x16, 0x52, 0xBB, 0xD1, 0xE5, 0x64, 0x73, 0xA5, 0x9B, 0x41, 0xE1, 0x0C, 0xA9,
+    0x06, 0x6A, 0x35, 0x59, 0x07, 0xAB, 0x99, 0xA3, 0xDA, 0xE6, 0x55, 0x96, 0xF5, 0x84, 0x24, 0xA3,
+    0xF3, 0x93, 0x0D, 0x49, 0x74, 0x95, 0xE9, 0x23, 0xF9, 0x9D, 0x1E, 0xF7, 0xC3, 0x90, 0x44, 0x7B,
+    0xFF, 0x62, 0x67, 0x25, 0x0A, 0x05, 0xF2, 0x91, 0x7A, 0xAA, 0xF6, 0x3E, 0xE8, 0x76, 0xB8, 0xB6,
+    0xC3, 0xA5, 0x1D, 0x42, 0xAD, 0xB6, 0x56, 0xBB, 0xC3, 0x7A, 0x87, 0xE5, 0x0E, 0xE7, 0x76, 0x58,
+    0xED, 0x70, 0xA3, 0xD6, 0x58, 0x2B, 0xD6, 0x6A, 0x4B, 0x4D, 0x4E, 0x72, 0xF0, 0x35, 0x67, 0x75,
+    0x7A, 0x36, 0xB8, 0x06, 0xAC, 0x3A, 0x32, 0x0D, 0xA4, 0xDD, 0x0A, 0xAE, 0x5B, 0xCF, 0xD2, 0x04,
+    0x6C, 0x15, 0x31, 0xDE, 0x41, 0xB0, 0x9E, 0xB5, 0x09, 0xEC, 0xB1, 0xC6, 0x51, 0x72, 0xF1, 0x93,
+    0xB7, 0x3E, 0x76, 0x92, 0x32, 0x49, 0x4D, 0xC0, 0xB4, 0x4B, 0x08, 0xDF, 0x80, 0xE7, 0xA0, 0xEC,
+    0x28, 0xD4, 0x66, 0x6D, 0x4E, 0xCF, 0xE2, 0x2C, 0xE6, 0xD6, 0xC3, 0xB9, 0x31, 0x7E, 0x02, 0xCB,
+    0xB9, 0x3E, 0x5C, 0x03, 0x7A, 0xFF, 0x1F, 0x72, 0xC9, 0x17, 0x8A, 0xFC, 0xE5, 0x09, 0xC4, 0x93,
+    0x75, 0x45, 0x75, 0x88, 0xF5, 0x97, 0xB3, 0x0E, 0x7B, 0x33, 0x38, 0x28, 0x7F, 0x78, 0xAB, 0x07,
+    0x57, 0xBE, 0xE5, 0x61, 0xEF, 0x30, 0x02, 0x9B, 0x19, 0x2F, 0x05, 0x33, 0x43, 0x22, 0x53, 0x0B,
+    0xD4, 0x6A, 0x21, 0x93, 0x5A, 0xA8, 0xA5, 0x96, 0x6C, 0xD2, 0xA6, 0xA5, 0xFE, 0xC5, 0xB8, 0x69,
+    0xF3, 0xA9, 0xEC, 0xD5, 0x6E, 0xC2, 0xA6, 0x55, 0x0B, 0xF9, 0x94, 0x70, 0x8D, 0x3F, 0xC3, 0x54,
+    0xA9, 0xAF, 0x9B, 0x6F, 0x1C, 0x90, 0x57, 0x74, 0xEC, 0x7C, 0x3E, 0xD6, 0x7A, 0x71, 0x04, 0x30,
+    0x9E, 0x71, 0x41, 0x71, 0xE4, 0xCD, 0x7F, 0x2F, 0xF8, 0xD9, 0x91, 0x2F, 0x5E, 0x5E, 0x98, 0x3B,
+    0x47, 0xED, 0xFA, 0xDC, 0xD2, 0xA6, 0xC7, 0x47, 0xDD, 0x6A, 0xB9, 0x6B, 0x8E, 0x3F, 0xAD, 0x56,
+    0x2E, 0x98, 0xE3, 0xC8, 0xCA, 0x35, 0xA6, 0x4B, 0x9B, 0xB7, 0x29, 0x04, 0x65, 0x05, 0xD5, 0x9F,
+    0xF6, 0x88, 0x67, 0x79, 0x9B, 0xBE, 0xA8, 0xAC, 0xE9, 0x08, 0x91, 0xA2, 0xA8, 0x92, 0xAF, 0x3A,
+    0xCA, 0x48, 0xAA, 0x8A, 0x32, 0x60, 0xE4, 0x59, 0x6D, 0x30, 0xC7, 0x23, 0x2B, 0xDB, 0x9B, 0xCE,
+    0xB5, 0x97, 0x13, 0x35, 0xE9, 0xFE, 0x4F, 0x9D, 0x8C, 0x0F, 0x0B, 0x9B, 0x35, 0x61, 0xC7, 0x66,
+    0x4D, 0xB8, 0x64, 0xF3, 0x2A, 0x5C, 0xB7, 0xB6, 0xFA, 0x32, 0xD8, 0x15, 0x01, 0xCA, 0x86, 0xC3,
+    0x3C, 0xE0, 0xCE, 0x4F, 0x14, 0x9D, 0xBC, 0x1D, 0x5C, 0x9F, 0x4D, 0x76, 0x93, 0x3E, 0xDA, 0x7E,
+    0xEA, 0x1F, 0x86, 0xFF, 0x19, 0x2E, 0xAF, 0x97, 0xCE, 0x39, 0xFB, 0xCE, 0xDD, 0x77, 0xB7, 0xBF,
+    0xD4, 0x36, 0x0C, 0x2E, 0x8C, 0x7B, 0x59, 0xEF, 0xDE, 0xF2, 0xD1, 0xFE, 0x22, 0x7C, 0x2F, 0x7B,
+    0x10, 0x49, 0xA6, 0x5D, 0x92, 0x2F, 0x03, 0xF9, 0xCF, 0x3D, 0x65, 0x09, 0xEB, 0x35, 0xE9, 0x97,
+    0x81, 0xFC, 0xE7, 0x2D, 0xEE, 0x62, 0xC5, 0x78, 0x63, 0xFF, 0x83, 0xFF, 0x95, 0xF4, 0xA9, 0xA4,
+    0x5A, 0x9A, 0x26, 0xCC, 0xA3, 0x01, 0x7B, 0xB7, 0xC3, 0x6D, 0x1A, 0x26, 0x2E, 0x76, 0x94, 0x77,
+    0xDB, 0xDC, 0x97, 0x49, 0x60, 0x7D, 0x0E, 0xB3, 0x6D, 0x59, 0x2E, 0x31, 0x47, 0x2D, 0xCB, 0x15,
+    0xE6, 0xCE, 0x40, 0xB4, 0x92, 0xDF, 0x28, 0xA4, 0x1A, 0x39, 0x33, 0xF1, 0xBD, 0xFD, 0xFD, 0x2B,
+    0xD2, 0xB8, 0xC2, 0x1C, 0x75, 0x2C, 0x9F, 0x52, 0x97, 0x57, 0x64, 0x47, 0x1D, 0x97, 0x1D, 0xD9,
+    0x51, 0xE0, 0xB2, 0x23, 0x3B, 0x0E, 0xEC, 0x25, 0xE9, 0xCF, 0x38, 0xE7, 0x26, 0x36, 0xFD, 0x5E,
+    0x22, 0x16, 0x59, 0xE0, 0xA0, 0xF0, 0x49, 0xD8, 0x23, 0xBB, 0x19, 0x29, 0xB2, 0xC0, 0x6E, 0x11,
+    0x4C, 0xB7, 0x79, 0xB0, 0x39, 0x2F, 0x45, 0x7B, 0x57, 0x7E, 0x55, 0xC6, 0x64, 0x48, 0xC8, 0xDB,
+    0x39, 0x61, 0x71, 0xA6, 0x25, 0x85, 0x7F, 0x42, 0x0B, 0x36, 0x5D, 0xA6, 0x60, 0xBB, 0x6F, 0x95,
+    0x15, 0x0E, 0x56, 0xB0, 0x84, 0x25, 0xAC, 0xC0, 0x55, 0x94, 0x1D, 0x56, 0x7D, 0xA6, 0xC8, 0xC5,
+    0x07, 0xF3, 0x6F, 0xA6, 0x30, 0x5D, 0xBD, 0xEA, 0x39, 0x80, 0xB4, 0x83, 0xBC, 0x81, 0x72, 0xEE,
+    0x21, 0x26, 0xCC, 0xFC, 0xC7, 0xF1, 0x78, 0x95, 0x93, 0xE1, 0x92, 0x24, 0xEC, 0x92, 0xFB, 0x81,
+    0x55, 0xD2, 0x27, 0xBD, 0x09, 0xB9, 0xCF, 0x5A, 0x87, 0xBD, 0x39, 0x50, 0xBC, 0xD3, 0xE2, 0x6A,
+    0xA8, 0x23, 0xA8, 0x23, 0x51, 0x85, 0x89, 0x27, 0x7C, 0xA6, 0x21, 0x1D, 0xA1, 0x0E, 0xD4, 0x22,
+    0xD1, 0x69, 0xF3, 0x07, 0xD8, 0x81, 0xE4, 0xAA, 0x3E, 0xC3, 0x49, 0xD1, 0xDC, 0xAF, 0xDF, 0x18,
+    0xCE, 0xB2, 0xA6, 0xBF, 0xF6, 0x98, 0xCB, 0x50, 0x72, 0x76, 0xC1, 0x9A, 0xE1, 0x30, 0x0D, 0xF9,
+    0x47, 0xBA, 0xFB, 0x48, 0x46, 0xD2, 0x60, 0x24, 0xF9, 0x74, 0xA3, 0xCF, 0x4E, 0x89, 0xDA, 0xD7,
+    0x72, 0x99, 0x67, 0xE1, 0xA7, 0x25, 0xB6, 0x5A, 0xB1, 0x66, 0x91, 0x79, 0xD6, 0x4B, 0x78, 0x14,
+    0x40, 0x33, 0xFF, 0x2C, 0x02, 0x89, 0x02, 0x76, 0x1B, 0x18, 0xF3, 0x2E, 0xEF, 0x6C, 0xBB, 0xC1,
+    0xB6, 0xDF, 0xE5, 0xD9, 0x6A, 0xE0, 0x9C, 0xE9, 0x38, 0xB0, 0x4D, 0xDA, 0xAD, 0xC8, 0x9B, 0x93,
+    0x61, 0xDE, 0x24, 0xDD, 0x39, 0xB2, 0xE6, 0x80, 0xB3, 0x69, 0xC7, 0x6E, 0xFE, 0xEF, 0xFB, 0x0F,
+    0x4B, 0x69, 0xD8, 0x48, 0x2D, 0xD8, 0x0A, 0x76, 0x67, 0x60, 0x04, 0x78, 0x89, 0x2F, 0xF8, 0x81,
+    0xFF, 0xE6, 0x35, 0xF3, 0xAF, 0x7C, 0xC1, 0x3F, 0x76, 0xB5, 0xD3, 0xAD, 0x21, 0xB0, 0xC0, 0x62,
+    0xFC, 0x0A, 0x4E, 0x59, 0x45, 0xFC, 0xFF, 0x91, 0x89, 0xFB, 0x6F, 0x7E, 0xB2, 0xEB, 0x24, 0x6D,
+    0x25, 0xC5, 0x15, 0x18, 0xEF, 0xFE, 0x08, 0x85, 0x38, 0x78, 0x2C, 0x76, 0x4E, 0x84, 0x7B, 0xFD,
+    0xF0, 0x47, 0xBF, 0x76, 0xA7, 0x6C, 0x24, 0x3E, 0xC5, 0x14, 0x92, 0x01, 0x48, 0x67, 0x82, 0x59,
+    0x46, 0x70, 0x11, 0x9E, 0xDF, 0x3D, 0xA1, 0x0B, 0xBB, 0xC0, 0xF2, 0x35, 0x70, 0xEA, 0x58, 0xB0,
+    0x66, 0xC1, 0x77, 0x58, 0x72, 0x96, 0x25, 0xE7, 0x58, 0xBD, 0x31, 0xE2, 0x34, 0xE0, 0xF4, 0xDE,
+    0x77, 0x21, 0xBD, 0x12, 0x60, 0xE1, 0xC0, 0x6C, 0x1F, 0x1B, 0xF7, 0x2B, 0x16, 0xA5, 0x7A, 0x73,
+    0x2B, 0xA4, 0xDD, 0xA2, 0x24, 0x37, 0xB7, 0x02, 0xD7, 0x17, 0x05, 0xF6, 0xC2, 0x47, 0xF7, 0xDF,
+    0x0C, 0xCB, 0x42, 0x63, 0xF6, 0x91, 0x26, 0x2E, 0xBF, 0x04, 0x16, 0x8C, 0x7F, 0xFC, 0x37, 0xC2,
+    0xFB, 0x95, 0x91, 0xAA, 0x9E, 0xEB, 0x4B, 0xAC, 0xAD, 0xCC, 0xB6, 0x4D, 0xC2, 0x83, 0x37, 0xA3,
+    0x53, 0xB4, 0xEA, 0xE1, 0x35, 0x12, 0x4D, 0xFC, 0x75, 0x12, 0x93, 0x93, 0x5E, 0x04, 0x6B, 0x9C,
+    0x7C, 0xBA, 0x1F, 0x67, 0x0A, 0x3B, 0x7C, 0x9F, 0xDA, 0x4C, 0x6A, 0x9D, 0x7A, 0x2E, 0xFE, 0x9A,
+    0x6F, 0xF1, 0x1C, 0x07, 0x46, 0xFE, 0xC0, 0xBE, 0x12, 0x0E, 0x5E, 0x62, 0xE7, 0xE0, 0xAF, 0x58,
+    0x1C, 0x5C, 0xE2, 0xE5, 0x83, 0x6B, 0x7C, 0xE7, 0xE0, 0x1A, 0x67, 0x37, 0x81, 0xB3, 0x37, 0x7A,
+    0x5E, 0xBE, 0xBE, 0x66, 0x79, 0x69, 0xF3, 0x4A, 0xBC, 0xE4, 0x34, 0x5C, 0x2A, 0xD4, 0xFD, 0x38,
+    0x9D, 0x2A, 0x0A, 0x35, 0x8B, 0xB4, 0xFB, 0x0B, 0x0E, 0x72, 0xCE, 0xA5, 0x3E, 0x6F, 0x76, 0xD2,
+    0xCE, 0x6A, 0x40, 0x13, 0x83, 0x6D, 0xD6, 0xA6, 0x5B, 0x32, 0x94, 0xAC, 0x6C, 0x65, 0xDF, 0xF1,
+    0xA6, 0x4B, 0xAA, 0xA4, 0xDA, 0x65, 0x27, 0xF3, 0x59, 0x73, 0x52, 0xE3, 0x67, 0xA6, 0x2A, 0xED,
+    0x4A, 0xAE, 0xB3, 0x63, 0x49, 0x6F, 0x3D, 0xDC, 0x3F, 0x74, 0xD2, 0x91, 0x34, 0x9E, 0xF4, 0x94,
+    0x12, 0x92, 0x91, 0x6F, 0x5B, 0xC9, 0x3B, 0x45, 0x6A, 0x55, 0x3C, 0xC3, 0xFF, 0x01, 0xCD, 0x9C,
+    0x5D, 0x8C, 0x1D, 0xC7, 0x95, 0xDF, 0x7F, 0xD5, 0xC5, 0x61, 0x4B, 0xD3, 0xE4, 0x14, 0x81, 0x48,
+    0x8E, 0x2C, 0x9A, 0x6C, 0x23, 0xD0, 0x83, 0xE3, 0xE5, 0xB0, 0x99, 0x60, 0x1E, 0x06, 0xCE, 0xBD,
+    0x53, 0x2D, 0x2B, 0x1B, 0x3F, 0x6C, 0xB0, 0x66, 0x60, 0xD2, 0x7A, 0xD8, 0x20, 0x31, 0x90, 0x04,
+    0xC8, 0xC6, 0x8E, 0xC9, 0x00, 0x7A, 0x50, 0x12, 0x92, 0xDD, 0x14, 0x81, 0x6C, 0x80, 0x7C, 0x78,
+    0xF2, 0x20, 0xE4, 0x55, 0x48, 0xB4, 0xC1, 0x8A, 0xDA, 0x05, 0xB9, 0x80, 0x1E, 0xE8, 0x60, 0x38,
+    0xB7, 0xC8, 0x79, 0x10, 0x12, 0xBF, 0xB4, 0x44, 0x78, 0x17, 0xC8, 0x06, 0x71, 0xAF, 0x28, 0xD9,
+    0x6B, 0x79, 0x17, 0x2A, 0x5B, 0x6D, 0xAB, 0x29, 0x57, 0xF7, 0xC9, 0x43, 0xF7, 0x9D, 0x0F, 0x92,
+    0xF2, 0x5A, 0xB2, 0x3E, 0xB6, 0x50, 0x5D, 0xDD, 0xD3, 0xB7, 0xE7, 0xF6, 0x39, 0x55, 0xA7, 0x4E,
+    0x9D, 0xF3, 0x3F, 0xA7, 0xAE, 0x7C, 0x27, 0x14, 0x5B, 0xAD, 0x2D, 0xE1, 0xF1, 0x90, 0xBA, 0x60,
+    0xE6, 0x35, 0x71, 0x1B, 0x89, 0xDB, 0x88, 0xDD, 0xB9, 0xD8, 0x4D, 0x54, 0xC9, 0x02, 0x98, 0x5D,
+    0x75, 0xE6, 0x63, 0xF1, 0xE6, 0x7B, 0x87, 0xB2, 0xDF, 0xC4, 0x2E, 0x31, 0x9D, 0xD7, 0xB5, 0x25,
+    0xEC, 0x6F, 0x92, 0xFD, 0x05, 0x46, 0x1A, 0x2D, 0x81, 0xE2, 0x0E, 0x47, 0xE0, 0x08, 0xEC, 0x63,
+    0xBB, 0x64, 0x2D, 0x91, 0x48, 0x6E, 0xEE, 0x1C, 0xAE, 0x4C, 0x49, 0x69, 0x00, 0x03, 0x98, 0x1C,
+    0x92, 0x12, 0xB4, 0x03, 0x5D, 0x41, 0x54, 0x83, 0xF2, 0x90, 0x89, 0xE4, 0x99, 0x48, 0xBE, 0x70,
+    0xFD, 0x34, 0x9C, 0x07, 0x02, 0xE8, 0x00, 0x67, 0x6A, 0x90, 0x37, 0x7F, 0x17, 0x11, 0xF1, 0x22,
+    0x12, 0x00, 0xCE, 0x72, 0xD6, 0xBC, 0x75, 0xC5, 0xCD, 0xA4, 0xD1, 0xF5, 0x1A, 0xE7, 0x94, 0x4F,
+    0x9C, 0xC9, 0x37, 0x94, 0x8F, 0x7D, 0x41, 0x21, 0x3E, 0x15, 0xB9, 0xF9, 0x6E, 0x77, 0x7D, 0x91,
+    0x28, 0x07, 0x32, 0x58, 0xD3, 0x1E, 0x8B, 0x25, 0xCB, 0xE3, 0x3A, 0x2B, 0xD9, 0xCC, 0x1C, 0x46,
+    0x1C, 0x48, 0x05, 0x69, 0x0D, 0xDA, 0x83, 0x88, 0xC7, 0x4A, 0x07, 0xA9, 0x83, 0xD8, 0x83, 0x0A,
+    0x40, 0x11, 0x30, 0x22, 0xA5, 0x7E, 0x6B, 0xFB, 0x06, 0xC3, 0x13, 0x00, 0x1C, 0x39, 0x72, 0xE4,
+    0xC8, 0x67, 0x8E, 0x1D, 0xDB, 0x07, 0xEC, 0x9B, 0x8C, 0x65, 0x15, 0xB5, 0x0E, 0xB3, 0x40, 0x52,
+    0x9E, 0x63, 0x85, 0xCF, 0x52, 0x0D, 0xBC, 0x26, 0x0D, 0x64, 0x52, 0x6A, 0x11, 0x97, 0xAE, 0xA7,
+    0xE5, 0x35, 0xD2, 0xA8, 0xE2, 0x5C, 0xF2, 0xBA, 0xF6, 0x46, 0xC4, 0x25, 0x12, 0x50, 0x45, 0x0D,
+    0x99, 0x83, 0xA2, 0xFC, 0x67, 0x4F, 0x76, 0x5A, 0xC4, 0x5B, 0x11, 0xCE, 0xC8, 0xFA, 0xBC, 0x47,
+    0x2D, 0xAD, 0x55, 0xA1, 0x88, 0xC2, 0xEC, 0x89, 0xC0, 0x6F, 0x73, 0x64, 0x91, 0x97, 0xFF, 0xDD,
+    0x03, 0x67, 0x0F, 0xFC, 0xED, 0xFC, 0xB1, 0xFF, 0xC5, 0x57, 0x8E, 0x44, 0xFB, 0xB3, 0x03, 0x8B,
+    0xCA, 0xED, 0x7F, 0x1D, 0x88, 0xFF, 0xFC, 0xC8, 0xE4, 0xB1, 0x03, 0x27, 0x0E, 0x9C, 0x38, 0xB8,
+    0x32, 0xCD, 0xFA, 0xE4, 0xFF, 0xD8, 0x17, 0x4E, 0x1A, 0x91, 0x1B, 0xA7, 0xBF, 0xEE, 0xE1, 0x1C,
+    0xA4, 0x10, 0x3B, 0x94, 0x07, 0x3E, 0x7F, 0xF9, 0xB2, 0x11, 0xD9, 0x12, 0xF1, 0xC3, 0x37, 0xFE,
+    0xEF, 0x5F, 0x7F, 0xF0, 0x6F, 0xFC, 0xFD, 0x13, 0xFF, 0xFE, 0xB1, 0x2D, 0xFF, 0x95, 0x03, 0xFF,
+    0x6D, 0xFF, 0xDF, 0xFA, 0xBF, 0x8B, 0x91, 0xDB, 0xFF, 0x3A, 0x9C, 0x7E, 0x46, 0xFA, 0x81, 0x08,
+    0xB5, 0x89, 0x91, 0x2A, 0x53, 0x7E, 0xC2, 0xB5, 0x73, 0x4C, 0x36, 0x38, 0x77, 0x9E, 0x0D, 0xFB,
+    0xC5, 0x36, 0x13, 0x9F, 0x88, 0x53, 0xDF, 0x06, 0x33, 0x30, 0xEC, 0x61, 0x82, 0x15, 0xF9, 0xF5,
+    0x27, 0xDF, 0xC8, 0x87, 0x3F, 0x30, 0x73, 0x4E, 0xD4, 0x57, 0x9F, 0xCF, 0x44, 0x16, 0x4E, 0x42,
+    0x56, 0x3D, 0xEE, 0x34, 0x07, 0xA8, 0x53, 0xE5, 0x4D, 0xF7, 0xF9, 0xE7, 0xD2, 0x9A, 0x75, 0xCA,
+    0x07, 0xE3, 0x9A, 0x5A, 0xB9, 0x24, 0x6B, 0xBE, 0x99, 0xC7, 0x4F, 0xDC, 0xF0, 0x2F, 0x4D, 0xC8,
+    0x72, 0x5D, 0x5F, 0xC7, 0x3C, 0xD3, 0xB0, 0x66, 0x2A, 0x82, 0x2D, 0xB5, 0xEF, 0x31, 0x5B, 0x2D,
+    0xD6, 0x78, 0x82, 0x75, 0xDA, 0x4B, 0x6E, 0xB7, 0x44, 0xC4, 0x88, 0x84, 0xBF, 0x23, 0xBD, 0xBF,
+    0x2D, 0x7F, 0xB2, 0x55, 0x9E, 0x62, 0x09, 0x78, 0x6C, 0x7C, 0xED, 0x4C, 0x3B, 0x71, 0x7E, 0xE6,
+    0x27, 0x36, 0x18, 0xD3, 0xEB, 0x2D, 0x29, 0x7D, 0x51, 0x4F, 0x92, 0xD6, 0x70, 0x5D, 0x3B, 0x9B,
+    0x7B, 0x53, 0x1D, 0xD3, 0x3E, 0x51, 0x21, 0x72, 0x33, 0xAE, 0x5A, 0xB7, 0x6C, 0x7C, 0xF2, 0x44,
+    0x88, 0x5E, 0x11, 0x5E, 0x9A, 0x95, 0xCB, 0x59, 0x9D, 0xE4, 0x98, 0xAD, 0x1F, 0x87, 0x59, 0xFE,
+    0x40, 0x94, 0x7F, 0x21, 0x3F, 0xC0, 0x7F, 0xF9, 0x86, 0xCD, 0xE1, 0x9C, 0x3A, 0x81, 0xD3, 0x1C,
+    0xE0, 0xAC, 0x72, 0xD6, 0x5F, 0x2E, 0x63, 0x7F, 0xE4, 0x33, 0x2B, 0x07, 0x57, 0x16, 0x57, 0x16,
+    0x57, 0x0F, 0xA6, 0x21, 0xAE, 0x01, 0x88, 0x6B, 0x40, 0x5F, 0x03, 0x58, 0x82, 0x83, 0xE8, 0x92,
+    0x04, 0x6A, 0xE2, 0x9C, 0x55, 0xB4, 0xE3, 0x28, 0x51, 0x45, 0x5C, 0x52, 0xA3, 0x6A, 0xAE, 0xA2,
+    0xBE, 0x9D, 0x3F, 0x4D, 0x24, 0xCD, 0x84, 0x7C, 0xD6, 0x2D, 0xB3, 0x02, 0x86, 0x29, 0x98, 0x3C,
+    0x2B, 0x89, 0xDD, 0x91, 0x1A, 0x5D, 0x2D, 0xAD, 0x12, 0xD5, 0x66, 0x09, 0x7C, 0x72, 0xA9, 0xA2,
+    0xD5, 0xD2, 0x73, 0x8E, 0x93, 0xE7, 0x99, 0x82, 0x21, 0x03, 0xED, 0x16, 0x40, 0xF9, 0xA4, 0x04,
+    0x74, 0x0B, 0xF0, 0xD7, 0x4A, 0x54, 0xCE, 0x2A, 0x5C, 0x45, 0x97, 0x2C, 0xC1, 0x2A, 0x91, 0x23,
+    0x2E, 0x79, 0x0A, 0x9E, 0xC6, 0x40, 0x5C, 0x46, 0x15, 0xEA, 0xDB, 0xF9, 0xEA, 0x02, 0xB3, 0xCE,
+    0xA4, 0x7D, 0x22, 0xAF, 0xBC, 0x56, 0xBE, 0x04, 0x13, 0xB4, 0x23, 0xC9, 0x99, 0xA0, 0x3C, 0xDA,
+    0x31, 0x85, 0x86, 0xD8, 0x91, 0x81, 0xC7, 0x38, 0x8E, 0x93, 0x78, 0x62, 0xA7, 0xFA, 0x53, 0x34,
+    0x64, 0xE2, 0x32, 0xB4, 0x04, 0x95, 0x6F, 0x6B, 0x82, 0x48, 0x72, 0xE0, 0xD0, 0x11, 0x86, 0xB9,
+    0xFB, 0x20, 0xEC, 0x27, 0x72, 0x7C, 0xAA, 0x64, 0x05, 0xD3, 0x62, 0x20, 0xF2, 0xAA, 0x02, 0xC3,
+    0x04, 0xB8, 0x9A, 0xC0, 0xA1, 0x54, 0xD5, 0xC4, 0x52, 0x4F, 0xC8, 0x67, 0x6D, 0x5C, 0x1E, 0xE4,
+    0x14, 0x5E, 0x57, 0xB0, 0xCC, 0x26, 0x43, 0x07, 0xD0, 0xE8, 0xFF, 0x0C, 0xC7, 0xF1, 0x35, 0xDA,
+    0x1D, 0x37, 0x39, 0xD7, 0xB4, 0xF4, 0xA4, 0x3C, 0x94, 0xE6, 0xBA, 0x02, 0xCF, 0x06, 0x18, 0x16,
+    0x40, 0x79, 0x8C, 0x87, 0x1E, 0x4C, 0x05, 0x1B, 0x3B, 0xFA, 0xE9, 0xE4, 0x70, 0xB3, 0xDE, 0x7D,
+    0xCA, 0x6A, 0x4C, 0x4B, 0x14, 0xE0, 0x02, 0x18, 0x87, 0x6A, 0xC0, 0x0E, 0xFA, 0x61, 0x0D, 0x74,
+    0x0D, 0x16, 0xA2, 0x96, 0x47, 0x4C, 0x73, 0xB8, 0x2A, 0xA4, 0x65, 0x76, 0x67, 0xE7, 0x0B, 0x63,
+    0xBF, 0x02, 0x66, 0x75, 0x05, 0x0E, 0x2E, 0x5D, 0x85, 0x83, 0xBA, 0xE6, 0x9E, 0x72, 0x01, 0x60,
+    0x06, 0x20, 0x39, 0x28, 0x71, 0xA0, 0x7F, 0x50, 0x41, 0x7C, 0xAB, 0x86, 0xE4, 0xA6, 0x07, 0x73,
+    0xB1, 0x81, 0x34, 0x0F, 0x60, 0xD9, 0x80, 0x35, 0x2E, 0xC0, 0x75, 0x2C, 0x04, 0xB2, 0x5C, 0xB5,
+    0x98, 0x52, 0x8B, 0x88, 0xD3, 0x22, 0x52, 0x27, 0x22, 0xE2, 0xCD, 0x1B, 0xA7, 0x9F, 0x6C, 0x52,
+    0x87, 0x6E, 0x33, 0x47, 0x14, 0x6C, 0x89, 0xEA, 0xC6, 0x17, 0xDD, 0xCC, 0x41, 0xDD, 0x28, 0x81,
+    0x1F, 0xE5, 0xF3, 0x97, 0xDF, 0xAF, 0x7C, 0x6C, 0x54, 0xCD, 0xCB, 0xA0, 0xC8, 0xB5, 0x88, 0xB4,
+    0x10, 0x8B, 0xBC, 0xF9, 0x3C, 0x83, 0x46, 0x86, 0xB4, 0x70, 0x00, 0xD6, 0x3A, 0x80, 0xF3, 0x99,
+    0x03, 0x08, 0xA9, 0x03, 0xA2, 0xC6, 0x88, 0x80, 0xF6, 0x46, 0x04, 0x92, 0xCA, 0x88, 0x80, 0x71,
+    0xA6, 0x06, 0xB2, 0xDC, 0xD4, 0x80, 0xC5, 0x78, 0xA0, 0xC7, 0x78, 0x50, 0x22, 0xD2, 0x0C, 0xAF,
+    0xB9, 0x73, 0xFA, 0x64, 0x2C, 0x22, 0x22, 0xAD, 0xF1, 0x18, 0x91, 0x90, 0x56, 0x18, 0x91, 0x60,
+    0x1D, 0x46, 0x64, 0x9B, 0xB2, 0xD3, 0xA7, 0x80, 0x58, 0x64, 0x1D, 0x52, 0x91, 0x06, 0x0A, 0x91,
+    0x06, 0xD5, 0x72, 0xA6, 0x21, 0xAE, 0x31, 0x9E, 0xB4, 0xC4, 0xD4, 0x5C, 0x80, 0xCC, 0xA9, 0x16,
+    0x6C, 0x19, 0xD7, 0x30, 0xDB, 0x7F, 0xE5, 0xCD, 0x52, 0x05, 0x2B, 0x92, 0xC7, 0x8D, 0x48, 0x47,
+    0x5A, 0xC5, 0x35, 0x14, 0x79, 0x5A, 0x12, 0x75, 0x5C, 0x80, 0xCC, 0xAB, 0xEE, 0xF4, 0x19, 0x71,
+    0xB1, 0x88, 0x74, 0xA4, 0x22, 0xE2, 0x29, 0x44, 0x7A, 0x94, 0x88, 0x54, 0xC4, 0xD2, 0xAF, 0x03,
+    0x51, 0x7D, 0x0C, 0xE2, 0xA7, 0x3F, 0x07, 0xC9, 0xD2, 0x2A, 0x2C, 0xC5, 0x0D, 0xEC, 0x63, 0x3E,
+    0x91, 0xF6, 0xCB, 0xEB, 0x50, 0x88, 0x10, 0xC9, 0xB3, 0x52, 0xC5, 0x81, 0xD4, 0x1B, 0x4F, 0xDC,
+    0xA6, 0x63, 0x07, 0xD3, 0x59, 0x60, 0xD3, 0x02, 0x17, 0x2C, 0x50, 0x5C, 0x00, 0xAC, 0x05, 0xD6,
+    0x86, 0x7B, 0x39, 0xF4, 0xB6, 0x22, 0xEA, 0xD2, 0xFE, 0xF4, 0x99, 0x60, 0x44, 0xA4, 0x8D, 0x45,
+    0xC4, 0x47, 0x22, 0x52, 0x31, 0x13, 0xC9, 0x87, 0x77, 0x00, 0x98, 0xFC, 0xAA, 0xBE, 0x5D, 0x21,
+    0x25, 0x05, 0x4A, 0x5C, 0xFC, 0x8E, 0x4F, 0x6F, 0x84, 0xBD, 0x52, 0x13, 0xD5, 0xF3, 0x65, 0x69,
+    0xF8, 0xB3, 0x19, 0xFF, 0x73, 0x5C, 0x1D, 0xC7, 0xA9, 0x16, 0xFF, 0xE2, 0xA7, 0xC2, 0xEE, 0xA7,
+    0xCE, 0xF4, 0x05, 0xCC, 0xBB, 0x1E, 0x25, 0xCF, 0x4A, 0x05, 0xA4, 0x1E, 0x71, 0x80, 0x90, 0x88,
+    0x83, 0xB8, 0xA1, 0x98, 0x01, 0x99, 0xD3, 0x4D, 0x07, 0x74, 0x64, 0xCF, 0xB4, 0xA0, 0xBD, 0x0A,
+    0xB1, 0x07, 0xE3, 0x4C, 0x65, 0x1C, 0x58, 0x66, 0x58, 0x20, 0xE8, 0x86, 0x00, 0xDA, 0xDB, 0x32,
+    0xF6, 0x60, 0x5E, 0x0B, 0xD8, 0x12, 0xB2, 0xB7, 0xAA, 0xA8, 0x03, 0x0A, 0x39, 0x3D, 0xF3, 0x83,
+    0x44, 0x8A, 0x1B, 0x44, 0xA6, 0x63, 0x90, 0x99, 0x7A, 0x20, 0xA5, 0x03, 0x90, 0x33, 0x7D, 0x0E,
+    0x24, 0x7E, 0x64, 0xA6, 0x04, 0x06, 0xFB, 0x04, 0x20, 0xAD, 0x46, 0xB1, 0x1E, 0x4E, 0xF3, 0xA7,
+    0x8A, 0xBD, 0x4F, 0x65, 0xE3, 0x53, 0xA3, 0xB4, 0x2D, 0xE6, 0x77, 0x4F, 0xC3, 0x25, 0x20, 0xAA,
+    0x80, 0x09, 0x83, 0x8D, 0x44, 0xC3, 0x5F, 0x56, 0x2C, 0x24, 0xAF, 0xB5, 0x10, 0x8C, 0x23, 0x2B,
+    0x67, 0x68, 0xAF, 0x1B, 0x7A, 0x32, 0x97, 0x3A, 0x3A, 0xDD, 0x92, 0xF8, 0x19, 0xD8, 0x6F, 0xD5,
+    0x44, 0x12, 0xC0, 0x48, 0x09, 0x33, 0x0F, 0xBA, 0x07, 0xAC, 0x1B, 0x89, 0xDB, 0xBE, 0x28, 0x1C,
+    0x24, 0x01, 0x10, 0x07, 0x26, 0xC0, 0xC6, 0xBC, 0xCE, 0xD6, 0x99, 0xF5, 0x5C, 0x2F, 0xAA, 0x8D,
+    0xB8, 0xD9, 0x20, 0x6C, 0x30, 0xDD, 0xE0, 0xE8, 0x06, 0xD3, 0x0D, 0xC2, 0x46, 0xD2, 0x6C, 0xCE,
+    0xAA, 0x59, 0xCF, 0x6C, 0x7D, 0xE7, 0xF9, 0x0D, 0x40, 0x81, 0x96, 0x8A, 0x69, 0x54, 0xE9, 0x2A,
+    0x72, 0x06, 0x9D, 0x4F, 0xF8, 0x97, 0xCA, 0x27, 0xEB, 0xB1, 0x7B, 0x8A, 0x34, 0x72, 0x9C, 0x33,
+    0x44, 0xFE, 0x38, 0x89, 0xB3, 0x64, 0x14, 0xF9, 0x06, 0xF6, 0x8B, 0x9E, 0xCC, 0x38, 0xCE, 0xD9,
+    0x43, 0x91, 0xEF, 0x66, 0x72, 0xE9, 0x67, 0x12, 0xCC, 0x1F, 0x49, 0x0E, 0x90, 0x95, 0x4E, 0xFF,
+    0xA7, 0x03, 0x9C, 0xFD, 0xB7, 0x2E, 0x56, 0x43, 0xBF, 0x9C, 0xF9, 0x1D, 0x32, 0x79, 0x29, 0x79,
+    0x63, 0x96, 0x37, 0xAA, 0x3D, 0x8E, 0xB9, 0xE4, 0x08, 0x13, 0x92, 0x2D, 0x47, 0x98, 0x60, 0xB6,
+    0xEA, 0x38, 0x58, 0x91, 0x57, 0x44, 0xBA, 0x44, 0xDE, 0xA9, 0x0E, 0xB7, 0x6B, 0x3C, 0x0A, 0xFA,
+    0x00, 0x3C, 0xB7, 0xCE, 0xE2, 0x41, 0xF8, 0x37, 0x83, 0x7E, 0x1F, 0xCB, 0x99, 0xFF, 0x4A, 0x26,
+    0xCD, 0xFB, 0xF8, 0x32, 0x50, 0xCF, 0xC3, 0x99, 0x3F, 0x36, 0x52, 0x46, 0x22, 0x9B, 0x8F, 0xFB,
+    0xE4, 0x8D, 0x59, 0xC3, 0x8A, 0xC9, 0xD3, 0x9A, 0xC9, 0x71, 0xCC, 0xF7, 0xAF, 0x74, 0x13, 0x8C,
+    0x48, 0x3F, 0x21, 0x79, 0xE3, 0x24, 0x13, 0x8C, 0x83, 0x09, 0xA6, 0x86, 0x35, 0x8A, 0x06, 0xAC,
+    0x88, 0x3C, 0xFB, 0x8D, 0x54, 0x44, 0x24, 0x24, 0xF2, 0x8E, 0x48, 0x50, 0xB3, 0x4B, 0xAF, 0xC9,
+    0x3A, 0x1C, 0xCD, 0x81, 0x59, 0x09, 0xA4, 0x0C, 0xE2, 0xA0, 0x44, 0x5A, 0x62, 0x91, 0x9A, 0xC5,
+    0x2B, 0x97, 0x73, 0x98, 0xC0, 0x95, 0xD2, 0x93, 0xCA, 0x2D, 0x47, 0x17, 0xFF, 0x3F, 0x12, 0xA7,
+    0x1B, 0xD6, 0x48, 0x1C, 0x2D, 0x29, 0xBA, 0xE6, 0x1C, 0x89, 0xD3, 0x15, 0xE9, 0x1B, 0x05, 0x58,
+    0x69, 0xC1, 0x8A, 0x83, 0xC3, 0xDB, 0xB3, 0xEF, 0xB9, 0xE8, 0x3B, 0x8B, 0xAC, 0xAE, 0x55, 0xBA,
+    0xBC, 0x76, 0x97, 0x44, 0xED, 0xEF, 0x89, 0xA4, 0xA7, 0xFF, 0x7B, 0x4D, 0x4A, 0xBC, 0x55, 0x33,
+    0x9D, 0xA2, 0x6F, 0x57, 0x64, 0x53, 0xA2, 0xB7, 0x6B, 0xD6, 0x6C, 0x9E, 0xBC, 0x22, 0x6F, 0x05,
+    0x23, 0x92, 0x67, 0x52, 0x51, 0x8C, 0xD3, 0x5B, 0xB5, 0xC0, 0x26, 0x83, 0x01, 0x6B, 0xFC, 0x9E,
+    0x6F, 0x3C, 0x94, 0x88, 0x74, 0x89, 0xC8, 0x9B, 0xE5, 0xCE, 0x5A, 0x59, 0x43, 0xD4, 0x8E, 0xAB,
+    0xCE, 0xA0, 0xEA, 0x0F, 0xC1, 0x91, 0xC1, 0x72, 0x9C, 0x40, 0x5C, 0x42, 0x03, 0x06, 0x54, 0x0D,
+    0xCB, 0xC3, 0xFD, 0x73, 0x90, 0x94, 0x9C, 0x69, 0xC8, 0xA4, 0x36, 0xDF, 0x97, 0x8B, 0x7E, 0x7A,
+    0x6E, 0x4D, 0x6F, 0xDD, 0xAA, 0xCE, 0x1D, 0x9F, 0x26, 0xCF, 0xBC, 0x5D, 0x35, 0xD9, 0x5A, 0xAA,
+    0x6F, 0xFF, 0xAC, 0xBE, 0x9E, 0x8A, 0x38, 0x91, 0x46, 0x4B, 0x87, 0xE9, 0xA1, 0x81, 0x74, 0x7B,
+    0x0D, 0x8F, 0x1D, 0x6C, 0x80, 0x29, 0x51, 0x0D, 0x64, 0xC3, 0xFD, 0x55, 0x58, 0xD8, 0x26, 0xED,
+    0xEA, 0xF0, 0xB2, 0x65, 0xC0, 0x43, 0xE2, 0xFE, 0x92, 0x09, 0xD8, 0x10, 0xDF, 0xF0, 0x64, 0xBA,
+    0xA6, 0x8D, 0xAB, 0xB8, 0x32, 0x2E, 0x23, 0xCD, 0x03, 0x36, 0xAE, 0xB9, 0x90, 0xE5, 0x74, 0x01,
+    0x25, 0x1E, 0x2D, 0x25, 0x71, 0x37, 0xF4, 0x8C, 0x75, 0xD0, 0x43, 0xD2, 0xA0, 0xC4, 0x29, 0x09,
+    0xC4, 0xE2, 0x48, 0x77, 0x24, 0x71, 0x32, 0xAF, 0x53, 0xB0, 0xEB, 0xD8, 0x9E, 0x69, 0xE6, 0xA6,
+    0xDA, 0x4F, 0x69, 0xA6, 0x4C, 0x76, 0xD5, 0x6B, 0x53, 0xE5, 0xA7, 0x71, 0x75, 0xFC, 0x4C, 0x99,
+    0x75, 0x64, 0xEB, 0x2C, 0xC3, 0xF1, 0x5D, 0xF5, 0x08, 0x68, 0x6F, 0x4A, 0xE3, 0x0A, 0x8A, 0x28,
+    0x44, 0x5D, 0xE2, 0x3F, 0x16, 0xF2, 0x81, 0x47, 0x67, 0x1D, 0xD8, 0xB9, 0xC7, 0xF0, 0x49, 0x9A,
+    0x1B, 0x33, 0xF1, 0xA9, 0xBC, 0xB9, 0x2D, 0xDA, 0xDD, 0xD9, 0x48, 0x24, 0xDF, 0xFC, 0xAD, 0xC6,
+    0xE4, 0xE9, 0x33, 0x35, 0xED, 0x04, 0xB3, 0xE5, 0xD8, 0x18, 0x4E, 0x61, 0x8D, 0x62, 0x4B, 0xA4,
+    0x4B, 0x45, 0xAA, 0x99, 0x9C, 0x57, 0xB3, 0x4B, 0x35, 0xCB, 0xF9, 0x31, 0xF8, 0x0C, 0xC7, 0x60,
+    0x89, 0x97, 0x20, 0x91, 0x7A, 0x6E, 0xCE, 0x3E, 0xF4, 0x09, 0x1B, 0x53, 0x4B, 0x2C, 0xE1, 0xA9,
+    0xE3, 0xEF, 0x6E, 0x90, 0x49, 0x3E, 0x5F, 0x6B, 0xE6, 0xCA, 0xEC, 0x8F, 0xDF, 0xAF, 0x32, 0xFB,
+    0xF8, 0xC6, 0x44, 0x39, 0x20, 0x06, 0x38, 0xB8, 0xDD, 0x24, 0x1E, 0x50, 0xCF, 0x7D, 0xB0, 0x31,
+    0xA2, 0x82, 0x63, 0x10, 0xFD, 0x70, 0xDB, 0xD8, 0x88, 0xF3, 0x61, 0xF2, 0x72, 0x94, 0x01, 0x64,
+    0xE0, 0xDC, 0x2F, 0x9E, 0xC4, 0xEA, 0x4A, 0x8B, 0x12, 0x71, 0x88, 0x04, 0x6C, 0x0D, 0xA6, 0x81,
+    0xA8, 0x03, 0x6C, 0x3E, 0xA0, 0x01, 0x6C, 0x32, 0x78, 0x10, 0x84, 0xF9, 0x45, 0xCF, 0xF0, 0x1C,
+    0x52, 0xB3, 0xCF, 0xC8, 0xBB, 0x5F, 0x77, 0x85, 0x48, 0xD0, 0x22, 0xE2, 0x52, 0x91, 0x80, 0x15,
+    0x71, 0x14, 0x73, 0x83, 0x2A, 0x72, 0xE8, 0x92, 0x24, 0xC7, 0xC0, 0xF1, 0xBD, 0x6F, 0x9F, 0xD5,
+    0xB1, 0x78, 0x53, 0x1F, 0xCA, 0x72, 0x2C, 0xAC, 0xC1, 0x14, 0xA6, 0xB0, 0x06, 0x36, 0x27, 0xAB,
+    0x31, 0xD2, 0xC4, 0x12, 0x38, 0x33, 0xF8, 0x1A, 0xAB, 0x40, 0x52, 0x41, 0xF4, 0x56, 0x0E, 0x2F,
+    0x2D, 0xC3, 0xE7, 0x78, 0xEA, 0x13, 0xE2, 0xE9, 0x01, 0xB0, 0x20, 0xA5, 0x7E, 0xA5, 0x5E, 0x62,
+    0xF5, 0x03, 0x71, 0x73, 0x1E, 0x48, 0xEA, 0xF9, 0x9B, 0xFD, 0x2F, 0x1E, 0xA6, 0x47, 0xA5, 0x24,
+    0x95, 0x80, 0x11, 0x71, 0xBA, 0x1F, 0x65, 0x35, 0xAB, 0x40, 0x37, 0x23, 0x34, 0x93, 0xD4, 0xA3,
+    0x81, 0x65, 0xDC, 0xFC, 0xA2, 0x1E, 0x9F, 0x33, 0x3D, 0xE4, 0x22, 0xFF, 0x63, 0x23, 0x16, 0x11,
+    0x67, 0x45, 0x82, 0x1A, 0xE5, 0x35, 0x10, 0x4B, 0x9F, 0xEF, 0xB2, 0xA8, 0x2C, 0xD8, 0xBD, 0x53,
+    0xEA, 0x7D, 0x31, 0xF5, 0x08, 0x8F, 0x81, 0x3F, 0x0A, 0xD1, 0x8F, 0xCA, 0x91, 0x80, 0xC9, 0x27,
+    0x2D, 0x7F, 0x0F, 0xF0, 0x40, 0x9C, 0x3F, 0xA5, 0x7E, 0x52, 0x51, 0xE4, 0x64, 0x7B, 0x80, 0xBA,
+    0xF7, 0x39, 0x62, 0x00, 0xB5, 0x2E, 0x61, 0x72, 0x14, 0x30, 0x2D, 0xC3, 0x1A, 0x3A, 0xCC, 0xEB,
+    0xBD, 0xE5, 0xE1, 0xD3, 0x40, 0x21, 0x77, 0xA0, 0x10, 0xA9, 0x06, 0x67, 0xEA, 0x02, 0x87, 0x3B,
+    0x2E, 0x80, 0x70, 0x01, 0xAC, 0xBB, 0x00, 0x69, 0x75, 0x01, 0x4C, 0x7D, 0x01, 0x12, 0x7F, 0x01,
+    0x62, 0x7F, 0x01, 0xE2, 0x66, 0x4F, 0x63, 0x9A, 0x0B, 0x90, 0xF9, 0xE2, 0xF4, 0x6F, 0x89, 0x2F,
+    0x44, 0xA4, 0x2A, 0x44, 0xC4, 0x15, 0x22, 0xFD, 0xF0, 0xA5, 0x85, 0xFC, 0x10, 0xC6, 0x39, 0x3F,
+    0x36, 0x93, 0xDD, 0x8D, 0xF2, 0xE7, 0x58, 0x7C, 0xDC, 0x9F, 0x63, 0xF6, 0x53, 0xFF, 0x90, 0x96,
+    0xDE, 0x93, 0x54, 0x85, 0xC7, 0x60, 0xFC, 0x80, 0x5E, 0x4C, 0x49, 0x6A, 0xA6, 0xC4, 0xF5, 0x70,
+    0xB5, 0x86, 0xA9, 0xB1, 0xEB, 0x45, 0x4D, 0x2A, 0xE2, 0x31, 0x22, 0x9E, 0x48, 0x7A, 0x0F, 0x67,
+    0xFE, 0xD4, 0xFF, 0xD5, 0xF0, 0x15, 0x07, 0x3E, 0xB5, 0x1B, 0x61, 0x55, 0x91, 0x80, 0x16, 0xF1,
+    0xEC, 0x7F, 0xF1, 0xCD, 0x92, 0xE7, 0x53, 0xC8, 0xBA, 0x73, 0x68, 0xE9, 0x3D, 0xD9, 0xE3, 0xE2,
+    0xF0, 0x08, 0x49, 0x19, 0x85, 0x81, 0xBF, 0x86, 0xB4, 0xD4, 0x15, 0x9B, 0x98, 0x52, 0xB7, 0x03,
+    0xA3, 0xC5, 0x20, 0x7E, 0x02, 0x33, 0xD9, 0xD8, 0xCD, 0x27, 0xB0, 0x78, 0x45, 0x28, 0xE4, 0x2E,
+    0xF7, 0x8F, 0x58, 0x24, 0x64, 0x22, 0xF5, 0xAC, 0xBF, 0x1C, 0x8D, 0x96, 0x92, 0x1D, 0x71, 0x5B,
+    0x0F, 0x46, 0x04, 0x2B, 0x01, 0x11, 0xAF, 0x9B, 0x61, 0x3E, 0xEE, 0xFE, 0xF4, 0xBB, 0xA7, 0x4F,
+    0x5A, 0x91, 0x5A, 0x44, 0xE6, 0x98, 0x1D, 0xC0, 0xE7, 0xA5, 0x35, 0x22, 0xE5, 0xBD, 0x13, 0x24,
+    0xAB, 0x49, 0xA5, 0x8A, 0xAB, 0x84, 0x86, 0xC9, 0x51, 0xF4, 0xCD, 0x77, 0xA5, 0xB7, 0x22, 0xB7,
+    0xBF, 0x0B, 0xD3, 0x11, 0x98, 0x29, 0x41, 0x9E, 0xFD, 0x46, 0x22, 0xE2, 0x52, 0x09, 0xFC, 0x5A,
+    0x87, 0x2E, 0x75, 0x69, 0x38, 0x48, 0xFA, 0x55, 0x4F, 0x26, 0x39, 0xE9, 0x3D, 0x78, 0x4C, 0x21,
+    0x72, 0x53, 0xA4, 0x4F, 0xE4, 0xCD, 0xE7, 0xB2, 0xC1, 0x63, 0xD5, 0x7E, 0x87, 0x54, 0x11, 0xAF,
+    0x45, 0x9C, 0x11, 0xC1, 0xE6, 0x3B, 0x94, 0x8F, 0x9F, 0x76, 0xA7, 0x4F, 0x6B, 0x91, 0xDE, 0x88,
+    0x04, 0x3B, 0x40, 0xD3, 0x8E, 0xD3, 0xF0, 0x14, 0x4F, 0xE9, 0x2A, 0x25, 0x93, 0x9A, 0xA2, 0xBD,
+    0xBF, 0x95, 0x10, 0xF5, 0x28, 0xE9, 0x38, 0xCF, 0x55, 0x93, 0xEB, 0x1B, 0x35, 0x93, 0xEC, 0x8A,
+    0xDC, 0x16, 0xE9, 0xA7, 0x27, 0xD1, 0xD5, 0x00, 0x34, 0xB5, 0x60, 0xEE, 0x7C, 0xD5, 0xCD, 0x24,
+    0x28, 0x11, 0x17, 0xCD, 0x06, 0xCF, 0x31, 0xCB, 0xE1, 0xFA, 0xF8, 0xA9, 0xFF, 0xA8, 0x79, 0x19,
+    0x9D, 0x73, 0xE3, 0x50, 0x61, 0xC7, 0x77, 0xFD, 0x95, 0x07, 0xE5, 0xA3, 0x20, 0xB5, 0x86, 0x64,
+    0xD4, 0xB1, 0x45, 0x09, 0x9F, 0x1E, 0x9C, 0xEB, 0x44, 0x4A, 0xDD, 0xA4, 0x5C, 0x63, 0x35, 0x25,
+    0xBA, 0xF9, 0xFD, 0x2B, 0x9D, 0x15, 0xB9, 0xFD, 0xC6, 0xC9, 0x39, 0x69, 0x59, 0x89, 0x1A, 0x49,
+    0xCB, 0x24, 0x90, 0xF5, 0xB0, 0x0A, 0x4B, 0x10, 0x39, 0x58, 0x05, 0xD5, 0x83, 0x5A, 0x1F, 0xCD,
+    0x89, 0x63, 0xC4, 0x97, 0x1C, 0x71, 0x18, 0xA4, 0xFC, 0xC1, 0x7B, 0xD4, 0xB7, 0x88, 0x24, 0x22,
+    0x6D, 0x26, 0x97, 0xCB, 0x0D, 0x88, 0xFC, 0x5E, 0x79, 0x9F, 0x73, 0x23, 0x81, 0x6E, 0x2F, 0x37,
+    0x01, 0xF4, 0x4F, 0x4F, 0x9F, 0x32, 0x22, 0xED, 0xC8, 0xCD, 0x96, 0x88, 0xA0, 0x50, 0x2C, 0xAB,
+    0x8A, 0x6B, 0x2F, 0x11, 0x75, 0x03, 0x14, 0x70, 0xE8, 0x43, 0x13, 0xA4, 0x7D, 0xCC, 0xFD, 0xCA,
+    0xA2, 0x04, 0xF5, 0x93, 0x1A, 0xE2, 0xF2, 0x69, 0x78, 0x80, 0x07, 0xB6, 0xF9, 0x39, 0x09, 0x87,
+    0x45, 0x4A, 0x25, 0x22, 0x2E, 0xEE, 0x73, 0x55, 0x9A, 0x66, 0x0E, 0x73, 0x58, 0x37, 0xC7, 0x3F,
+    0x6C, 0x7E, 0x57, 0xA3, 0x7E, 0x17, 0x9B, 0x2B, 0xE9, 0x6D, 0xCE, 0x99, 0xDE, 0x96, 0xA8, 0x77,
+    0xAD, 0x43, 0xF9, 0xAC, 0x21, 0xF2, 0xA9, 0x5C, 0xBE, 0xE2, 0x13, 0x19, 0x06, 0x57, 0x1A, 0x66,
+    0x22, 0x35, 0xFB, 0xE5, 0x0E, 0x24, 0x83, 0xF3, 0x78, 0xA1, 0xE6, 0x68, 0x5C, 0xC6, 0x2C, 0xCE,
+    0x89, 0x48, 0x9A, 0xA9, 0x96, 0x1F, 0xB8, 0x7E, 0x16, 0x52, 0x66, 0x5B, 0x95, 0x0E, 0x13, 0xD2,
+    0x2D, 0xA7, 0x86, 0x53, 0x14, 0xD6, 0x28, 0x6E, 0x88, 0x04, 0x23, 0xE2, 0xAC, 0xB4, 0xCC, 0xBE,
+    0x3C, 0x78, 0x74, 0x36, 0xAF, 0x52, 0x6F, 0xA4, 0x57, 0x22, 0xEE, 0xB0, 0xD4, 0xA8, 0x93, 0xC0,
+    0x29, 0x60, 0x89, 0x25, 0x30, 0xF9, 0x32, 0x68, 0x09, 0xA0, 0xC4, 0x03, 0x0B, 0xF9, 0x7D, 0xD6,
+    0xE2, 0x8F, 0x91, 0xF9, 0x98, 0x98, 0xA7, 0xB8, 0xAA, 0xDF, 0xF8, 0x26, 0xA9, 0xB8, 0x7B, 0x67,
+    0xD9, 0x87, 0xD8, 0x07, 0xDB, 0x1A, 0x64, 0x24, 0xB8, 0xDC, 0x81, 0xB1, 0x3E, 0x31, 0xF6, 0xE7,
+    0xDA, 0x25, 0x75, 0x44, 0x77, 0xAF, 0x2E, 0xCC, 0x9E, 0xA8, 0x6C, 0x7F, 0xCE, 0xFC, 0x48, 0x6E,
+    0xF8, 0x24, 0x4C, 0xB1, 0xDB, 0x7C, 0xAB, 0x30, 0x21, 0xDB, 0xAA, 0xE3, 0x30, 0xF8, 0xF9, 0x41,
+    0x8B, 0x94, 0x49, 0xD3, 0x42, 0x9A, 0xA3, 0x9B, 0x83, 0x4A, 0x10, 0xA9, 0x53, 0x09, 0x6A, 0xD6,
+    0xC3, 0xC3, 0x1F, 0x3B, 0x4F, 0xF7, 0x87, 0xE9, 0xDC, 0xBD, 0xAF, 0x2A, 0xB6, 0x21, 0xC3, 0xB9,
+    0x25, 0x27, 0x83, 0x62, 0xEF, 0xB6, 0x7B, 0x64, 0x67, 0x80, 0x3E, 0x64, 0x49, 0x88, 0xAA, 0x31,
+    0x8E, 0xA9, 0xDE, 0x71, 0x70, 0x24, 0x72, 0x50, 0xAA, 0x5D, 0xD2, 0x90, 0xE5, 0x18, 0x77, 0x1D,
+    0xAC, 0x6E, 0x20, 0x98, 0x0A, 0xDD, 0xD8, 0x1C, 0x53, 0x75, 0x60, 0x9F, 0x68, 0xA0, 0x33, 0x35,
+    0xBA, 0xB1, 0x25, 0xA6, 0xEA, 0xC1, 0x5E, 0x6A, 0xA1, 0x37, 0x32, 0xA8, 0x31, 0xA9, 0x45, 0x44,
+    0x2E, 0x89, 0x48, 0x6F, 0xDE, 0xBD, 0x7C, 0x25, 0x58, 0x47, 0xEA, 0x05, 0x8A, 0xAD, 0x80, 0x12,
+    0xE3, 0x89, 0x43, 0xE1, 0x48, 0x87, 0x15, 0xEC, 0xA5, 0x21, 0xAE, 0x1A, 0xBF, 0x05, 0x47, 0xB5,
+    0x63, 0x85, 0xE7, 0xE0, 0xDA, 0x88, 0x7C, 0xEE, 0x3E, 0xFC, 0xFC, 0xF8, 0x6D, 0xD4, 0x3B, 0x52,
+    0x29, 0x91, 0x46, 0x89, 0x6A, 0x55, 0xE0, 0x5C, 0xD4, 0x30, 0x89, 0x3C, 0x93, 0xC8, 0x33, 0xD5,
+    0x7B, 0x8F, 0x0B, 0xBA, 0x61, 0x53, 0x37, 0x6C, 0x26, 0x8E, 0xC8, 0x27, 0x15, 0x7A, 0x68, 0x4C,
+    0x85, 0x6E, 0xEE, 0x6A, 0x0A, 0x11, 0xE9, 0x67, 0x22, 0xD2, 0xA5, 0x6F, 0x9C, 0x7E, 0xB2, 0x35,
+    0x35, 0xBA, 0x35, 0xEF, 0x5E, 0x7E, 0xB1, 0x35, 0x22, 0x72, 0x57, 0x13, 0x8C, 0x27, 0xBE, 0xBB,
+    0x49, 0x3D, 0x71, 0xE0, 0x1A, 0xD0, 0x0E, 0x44, 0x7F, 0x5D, 0x3C, 0xD2, 0x3F, 0xF7, 0x9E, 0xC4,
+    0x47, 0xBF, 0x24, 0xF1, 0xA0, 0xC2, 0xD2, 0xC4, 0xDF, 0xBA, 0xF4, 0x17, 0x2B, 0x66, 0xCF, 0x8C,
+    0x55, 0x81, 0xD4, 0x11, 0x30, 0xF7, 0x6B, 0x2A, 0xBA, 0xB1, 0xA9, 0xE9, 0x49, 0x6B, 0x25, 0xA4,
+    0x5E, 0x09, 0xA0, 0xDB, 0xCF, 0xFC, 0xAB, 0xD7, 0xBE, 0x13, 0xB7, 0x5F, 0xDB, 0x06, 0xBD, 0x54,
+    0xCD, 0xD1, 0xBD, 0xCD, 0x71, 0x22, 0x4F, 0x86, 0xF6, 0x58, 0xB4, 0xC7, 0xE6, 0xB0, 0xEF, 0xB0,
+    0x74, 0x76, 0x34, 0xB4, 0x77, 0x1B, 0x1E, 0xDB, 0x2E, 0xD3, 0x7B, 0xD5, 0x7C, 0x57, 0x2D, 0xB1,
+    0x25, 0x45, 0x49, 0xE1, 0xC6, 0x0A, 0x99, 0x84, 0x99, 0xFC, 0xDE, 0xCE, 0x17, 0x3E, 0x06, 0x4F,
+    0xDF, 0x53, 0xAF, 0xCD, 0x51, 0xE5, 0xB0, 0xAB, 0x46, 0x21, 0xBD, 0x71, 0xBF, 0xFA, 0x4A, 0x97,
+    0xBD, 0xDA, 0x67, 0xAF, 0xF5, 0x4B, 0xBA, 0x3C, 0xA1, 0xFF, 0x2C, 0x71, 0x24, 0xAE, 0x33, 0xAF,
+    0x8C, 0x70, 0x54, 0x5C, 0x3E, 0x3D, 0xAF, 0xD7, 0x12, 0xB7, 0x61, 0x5C, 0x30, 0xAE, 0x3B, 0x38,
+    0x7F, 0xD2, 0xA6, 0x2F, 0xFF, 0x64, 0x54, 0x45, 0x0B, 0x5F, 0xF2, 0xC1, 0x9A, 0xAD, 0xED, 0xE6,
+    0x56, 0xD3, 0xD9, 0x2F, 0xDF, 0xBE, 0xD3, 0x17, 0xDF, 0x7B, 0x27, 0x2C, 0xC5, 0x17, 0xEB, 0xA7,
+    0x8F, 0xC6, 0x17, 0xEB, 0x6B, 0x59, 0xB2, 0xE5, 0x83, 0x35, 0xD5, 0xD0, 0x15, 0x2A, 0xD8, 0xFB,
+    0x1E, 0xD1, 0xDD, 0x47, 0x6B, 0xF3, 0xDD, 0x87, 0x6E, 0x6D, 0xA9, 0x1B, 0x5B, 0xEA, 0xA6, 0x28,
+    0x75, 0x53, 0xB8, 0xED, 0xC3, 0x43, 0xE2, 0x79, 0xB0, 0xF0, 0x18, 0xA9, 0x30, 0xE2, 0x30, 0x02,
+    0xA6, 0x25, 0x1B, 0x43, 0x09, 0x66, 0xAB, 0x01, 0x9B, 0xD6, 0x43, 0x7A, 0x42, 0x72, 0x57, 0xC4,
+    0xE0, 0x28, 0xA8, 0xF5, 0xA7, 0x21, 0xB9, 0x51, 0xC3, 0xF1, 0xB8, 0x84, 0x6B, 0x47, 0x21, 0xAA,
+    0x9F, 0x86, 0xE4, 0x62, 0x0D, 0xCB, 0x49, 0x09, 0x4D, 0x06, 0xBA, 0xDA, 0x00, 0xF3, 0x84, 0x87,
+    0xA9, 0x71, 0xE0, 0x2D, 0x68, 0xD7, 0x8D, 0x21, 0xFB, 0x09, 0x43, 0x8E, 0x06, 0xC6, 0xC1, 0xA7,
+    0x7A, 0x40, 0x3C, 0xC4, 0x73, 0x7C, 0xEF, 0x01, 0x58, 0x83, 0x59, 0x1E, 0xBD, 0x5A, 0x19, 0x9E,
+    0xDA, 0x17, 0x37, 0xC4, 0x9E, 0xE4, 0xDE, 0x5A, 0x93, 0xD4, 0x98, 0xED, 0x5A, 0xED, 0xAD, 0x6E,
+    0xAC, 0x99, 0x3B, 0x34, 0x73, 0x56, 0x72, 0x2B, 0xD8, 0x0E, 0xEB, 0x59, 0x00, 0xA2, 0x92, 0xA8,
+    0x41, 0x09, 0xAA, 0xF6, 0x91, 0x8B, 0xE7, 0xEC, 0x99, 0x7C, 0x27, 0xD5, 0x60, 0x57, 0xDE, 0xC1,
+    0x9E, 0x14, 0x87, 0xA7, 0xE1, 0x28, 0x24, 0x25, 0x51, 0x0D, 0x0D, 0xAA, 0x23, 0x15, 0x8C, 0xA0,
+    0x4E, 0x41, 0x5C, 0x27, 0x3E, 0x6A, 0x62, 0xCF, 0x75, 0xDD, 0x92, 0x7D, 0x31, 0x60, 0x5C, 0x87,
+    0xF6, 0x02, 0xA1, 0x00, 0x6B, 0x4B, 0xCC, 0x5B, 0x8E, 0x58, 0xAA, 0xC1, 0x5E, 0x28, 0x5A, 0xC8,
+    0x24, 0x27, 0x91, 0x86, 0xE8, 0x5D, 0xC9, 0xE9, 0x6D, 0x83, 0xBD, 0x24, 0xB9, 0xA9, 0x8B, 0x46,
+    0x37, 0x89, 0xE4, 0x1D, 0xD2, 0xD8, 0xDC, 0x0C, 0x11, 0x0B, 0x75, 0x0A, 0x94, 0x8C, 0x86, 0x56,
+    0x56, 0x0D, 0x30, 0x97, 0x0E, 0xA3, 0xC2, 0x2F, 0xF2, 0x21, 0x19, 0x66, 0x80, 0xA7, 0x95, 0xDF,
+    0x7D, 0x8A, 0xFC, 0x1A, 0x99, 0x71, 0xD1, 0xDB, 0x9E, 0xEC, 0x3A, 0x91, 0x94, 0x58, 0x8F, 0x16,
+    0x87, 0x15, 0xF4, 0xDB, 0x01, 0x9B, 0x7A, 0xED, 0x67, 0xCE, 0x46, 0xA2, 0xBD, 0xB9, 0x7B, 0xE5,
+    0x14, 0x48, 0x6B, 0xD4, 0x9E, 0x55, 0x24, 0x6E, 0x40, 0xA9, 0xDC, 0xC4, 0xCE, 0x98, 0xDC, 0x1C,
+    0x67, 0x69, 0xC2, 0xD1, 0x86, 0xD4, 0x93, 0x56, 0x64, 0x35, 0x59, 0xCB, 0xF2, 0x26, 0x53, 0x5B,
+    0x4E, 0x4D, 0x3D, 0x8D, 0xDB, 0x68, 0x00, 0xE1, 0x93, 0x12, 0x3C, 0x83, 0xA4, 0x6D, 0x97, 0x85,
+    0x1C, 0xD5, 0x42, 0x5A, 0xEE, 0x3E, 0x65, 0x25, 0x51, 0x0B, 0x59, 0x4E, 0xD4, 0x40, 0x96, 0xA3,
+    0x1B, 0xB0, 0x7B, 0x4F, 0xA0, 0x3D, 0xCA, 0x8A, 0xBC, 0x2D, 0x22, 0xE3, 0x09, 0x1F, 0x97, 0xCB,
+    0x0C, 0x49, 0x0A, 0xC0, 0x90, 0xCA, 0x93, 0xD1, 0xEA, 0xDA, 0x94, 0x53, 0x1A, 0x5D, 0x99, 0xFC,
+    0xBC, 0x6A, 0xE2, 0x2A, 0xCD, 0xCF, 0xAB, 0x26, 0x96, 0xB4, 0x2B, 0xDA, 0x31, 0xD6, 0xF0, 0x21,
+    0xBD, 0xFF, 0x1E, 0x87, 0x26, 0xEA, 0xC0, 0x3A, 0x74, 0x00, 0x9B, 0x13, 0xFB, 0x71, 0x85, 0xFE,
+    0xE5, 0x08, 0x03, 0xE3, 0x8B, 0x1B, 0x5D, 0xEC, 0x33, 0xD7, 0xC7, 0xCD, 0x76, 0x5C, 0x64, 0x0F,
+    0xAD, 0x27, 0xB3, 0xD2, 0x44, 0x2D, 0x3E, 0xCB, 0x4D, 0xD4, 0x28, 0x9F, 0xE5, 0xE9, 0x2F, 0x4D,
+    0x6B, 0xCE, 0x72, 0x1A, 0xBD, 0xE2, 0xA7, 0x99, 0x7E, 0xD5, 0x4F, 0xD6, 0xD0, 0x35, 0x6B, 0xE8,
+    0x8A, 0xE9, 0xD0, 0xC4, 0x15, 0xE7, 0x77, 0x37, 0x42, 0xD1, 0xC4, 0x52, 0xDE, 0x67, 0xBC, 0x54,
+    0x9B, 0x95, 0xD9, 0x33, 0x6D, 0x14, 0xB2, 0xDC, 0xDE, 0x7C, 0xBF, 0xFD, 0x75, 0x0E, 0xE5, 0x49,
+    0x1C, 0x19, 0xB4, 0xE8, 0xDA, 0x9A, 0x32, 0x4C, 0x63, 0xDF, 0x64, 0xB7, 0x2A, 0x4C, 0xCE, 0x79,
+    0x54, 0x43, 0x5C, 0x91, 0xCE, 0x2F, 0x85, 0xB4, 0x63, 0xEC, 0x9C, 0x31, 0xC8, 0x32, 0x19, 0x03,
+    0x0F, 0x73, 0xA5, 0x32, 0x80, 0x18, 0x24, 0x25, 0xA8, 0x36, 0x05, 0x54, 0x3B, 0x05, 0x54, 0xBB,
+    0x01, 0xA8, 0xB6, 0x01, 0xD4, 0xCF, 0x6B, 0x20, 0x12, 0xB7, 0x9D, 0x4D, 0x12, 0x09, 0x8C, 0x10,
+    0xD9, 0x10, 0x48, 0x1A, 0x30, 0xC0, 0xB1, 0x1D, 0xD4, 0xE0, 0x10, 0x94, 0xB0, 0x0D, 0x0C, 0x41,
+    0x4F, 0xF8, 0xB9, 0x47, 0xA1, 0xDF, 0x16, 0x11, 0xE2, 0x5B, 0x22, 0x82, 0xD9, 0x12, 0x11, 0x32,
+    0x2D, 0x22, 0x63, 0x7A, 0x44, 0xD8, 0x89, 0x52, 0x6B, 0xCF, 0x1C, 0x6B, 0x23, 0xCD, 0xD9, 0x95,
+    0x48, 0x34, 0x77, 0xA1, 0xD2, 0x21, 0xBF, 0x8C, 0x0C, 0x58, 0xDB, 0x75, 0x4C, 0x81, 0xE9, 0xA7,
+    0x61, 0xAD, 0x85, 0xA2, 0x24, 0xEA, 0x20, 0x0B, 0x44, 0xED, 0x79, 0xB2, 0xEA, 0xFC, 0x88, 0x7A,
+    0x9E, 0x07, 0x0A, 0x0F, 0x45, 0x33, 0x28, 0x16, 0x5D, 0x32, 0x44, 0x9D, 0xF0, 0xF3, 0xF0, 0xEF,
+    0xF4, 0x7E, 0x50, 0xE1, 0xC9, 0x47, 0x4B, 0x8C, 0x9B, 0xE5, 0x58, 0x2D, 0x10, 0x4C, 0x47, 0xEC,
+    0x6D, 0x20, 0x75, 0xE2, 0x29, 0xB4, 0xD4, 0x51, 0x30, 0xDF, 0x73, 0x49, 0x5D, 0xD8, 0x32, 0xBB,
+    0x18, 0x0A, 0xFA, 0xD8, 0xF7, 0xBA, 0xCD, 0x6E, 0x04, 0x53, 0xCF, 0x74, 0x6B, 0xBF, 0x18, 0x62,
+    0xDF, 0x19, 0x6F, 0x6E, 0x35, 0xD6, 0xA5, 0xDF, 0xAB, 0x24, 0xB7, 0xB3, 0x27, 0x3A, 0x66, 0xC1,
+    0x34, 0x88, 0xB7, 0x55, 0x24, 0x4E, 0x72, 0x2D, 0xC0, 0xCA, 0xE0, 0x54, 0xFB, 0xED, 0xE8, 0xDB,
+    0x3D, 0xD1, 0xEA, 0xB4, 0x56, 0x22, 0x55, 0xDA, 0x14, 0x2A, 0xD0, 0x66, 0x79, 0xF2, 0x8C, 0x67,
+    0x23, 0x23, 0xB9, 0xE9, 0xD9, 0xB0, 0xB9, 0xD9, 0x6A, 0x08, 0x36, 0x37, 0xB7, 0x1A, 0xBA, 0xF1,
+    0x34, 0x40, 0x82, 0xF9, 0x9C, 0xF8, 0x1E, 0x82, 0x09, 0xC4, 0xDE, 0xB6, 0xEF, 0x49, 0xFC, 0xE6,
+    0x6E, 0xE2, 0x9B, 0x81, 0xF8, 0x64, 0x20, 0x3E, 0xFB, 0x45, 0xC4, 0x03, 0x9C, 0x9E, 0x87, 0xDE,
+    0x4D, 0x3D, 0x6A, 0x5B, 0x15, 0xE6, 0x18, 0xB3, 0xCD, 0x7F, 0x15, 0x26, 0xD4, 0x29, 0xB0, 0x8E,
+    0xB8, 0x85, 0x62, 0xD0, 0x11, 0xFD, 0x4E, 0x0E, 0xC0, 0x80, 0xD1, 0xAB, 0x0A, 0x26, 0xCB, 0x80,
+    0xAD, 0x46, 0x91, 0xE0, 0x6B, 0xF7, 0xA0, 0xA3, 0x1F, 0x43, 0x57, 0xA8, 0x5C, 0xE5, 0x4B, 0x5C,
+    0x65, 0x7A, 0x0E, 0x64, 0x18, 0xC7, 0x87, 0x7E, 0xF5, 0x71, 0x5C, 0x80, 0xB8, 0x42, 0xB5, 0x50,
+    0x0C, 0x8B, 0x4C, 0x7E, 0x7F, 0xAF, 0x67, 0xE9, 0xF0, 0xEB, 0x88, 0xD4, 0xA6, 0xC9, 0x54, 0xA0,
+    0x4D, 0xCB, 0xE4, 0x46, 0xC3, 0x46, 0x9A, 0x27, 0x37, 0x1B, 0xAE, 0x67, 0x79, 0xF2, 0x6A, 0xC3,
+    0x75, 0x5B, 0x26, 0xB7, 0x5A, 0x36, 0x6D, 0x99, 0xDC, 0x6E, 0xD9, 0xFC, 0x18, 0x45, 0x24, 0x6D,
+    0xE1, 0xB0, 0x38, 0x90, 0xD7, 0x61, 0xFF, 0xFA, 0xFB, 0xEF, 0x87, 0x21, 0xA3, 0x2C, 0xEA, 0x86,
+    0x75, 0xF9, 0xF5, 0x5D, 0x68, 0xE9, 0xAC, 0xBF, 0x7F, 0xF4, 0xF3, 0x63, 0x4D, 0xE0, 0x51, 0x97,
+    0x25, 0x17, 0x69, 0x17, 0xEE, 0xA5, 0xE2, 0x7D, 0xC7, 0xF7, 0x8F, 0x70, 0x04, 0x96, 0x38, 0x06,
+    0xE6, 0xD9, 0x6B, 0xA0, 0xC5, 0x03, 0xB3, 0xFC, 0x93, 0xE5, 0x2F, 0x3E, 0x19, 0x73, 0x96, 0xAB,
+    0xDA, 0x1D, 0x25, 0x13, 0x47, 0x51, 0xDF, 0x1F, 0x23, 0x7B, 0xFF, 0xDC, 0x46, 0xEB, 0x3C, 0x8A,
+    0xAE, 0xC9, 0x88, 0x6B, 0x2C, 0x49, 0x7D, 0xBF, 0xBC, 0xB9, 0xC3, 0xB2, 0x3E, 0xB0, 0xCA, 0xEC,
+    0x8D, 0xA2, 0xA1, 0x70, 0x4A, 0xB0, 0x8E, 0xB4, 0x4E, 0x1D, 0x51, 0x30, 0x35, 0xD8, 0x27, 0x3C,
+    0x24, 0x75, 0x00, 0xD5, 0x5A, 0xA0, 0x48, 0x4B, 0x30, 0x5B, 0x1E, 0xF4, 0x78, 0x33, 0x87, 0xDE,
+    0x34, 0x30, 0x7B, 0x5C, 0xDE, 0xF8, 0xAA, 0x38, 0x2B, 0x22, 0x75, 0x2C, 0x22, 0x9E, 0x99, 0x48,
+    0x43, 0x22, 0xD2, 0x8C, 0x2F, 0xDA, 0xA5, 0xFD, 0x3D, 0x69, 0x9E, 0x11, 0x35, 0xB1, 0xC7, 0xE6,
+    0x0F, 0xED, 0x82, 0x76, 0xEE, 0x5D, 0x28, 0x66, 0x25, 0x64, 0x52, 0xA3, 0xEF, 0x1C, 0xAE, 0x48,
+    0x89, 0x1D, 0x2D, 0x26, 0xD7, 0x15, 0x6B, 0x98, 0x9C, 0x0D, 0xA6, 0x44, 0x9E, 0x16, 0x53, 0xEA,
+    0x86, 0xEB, 0xC4, 0x32, 0xF3, 0x18, 0x19, 0xAD, 0xDB, 0xD1, 0xB8, 0xF7, 0x43, 0xFE, 0x85, 0xAE,
+    0x86, 0xC4, 0x89, 0x64, 0xC7, 0xFB, 0x5C, 0x38, 0x05, 0x46, 0x5A, 0x8C, 0x08, 0x86, 0xD4, 0x19,
+    0x62, 0x97, 0xA2, 0xAB, 0x14, 0x5D, 0xA7, 0xC4, 0x75, 0x4A, 0x5A, 0x65, 0x97, 0xC5, 0x65, 0xD2,
+    0x93, 0x49, 0x47, 0x26, 0x92, 0x5B, 0x97, 0x39, 0x5B, 0x26, 0xB5, 0x75, 0xB1, 0x1F, 0x8F, 0xC6,
+    0xBA, 0xB8, 0xB5, 0x2E, 0x0E, 0xE3, 0xD1, 0x31, 0x21, 0xCE, 0xF1, 0x1C, 0x1D, 0xE2, 0xB6, 0x80,
+    0xFF, 0x03, 0x33, 0xAB, 0xA4, 0x37, 0x7E, 0xC7, 0xBD, 0x55, 0x81, 0xD4, 0x45, 0x81, 0xCC, 0xE9,
+    0x80, 0xAD, 0x3E, 0x3A, 0x62, 0xEE, 0x2E, 0x0B, 0x27, 0x21, 0xAB, 0x07, 0x63, 0xDE, 0xBA, 0xF1,
+    0x28, 0x87, 0xD5, 0x65, 0x06, 0xFA, 0xE6, 0x4B, 0x66, 0x56, 0x59, 0x29, 0x05, 0xED, 0x31, 0x6E,
+    0x88, 0x8E, 0xC7, 0x9E, 0xD4, 0x31, 0x23, 0x0A, 0x18, 0x3F, 0x2C, 0x08, 0x7B, 0x8B, 0x69, 0xB0,
+    0x8E, 0x1E, 0xDD, 0x90, 0x3A, 0x64, 0x4C, 0xD7, 0x05, 0x5D, 0x2E, 0x42, 0xF3, 0x34, 0x43, 0x44,
+    0xD0, 0x81, 0xCE, 0x3F, 0xF2, 0xFE, 0x5F, 0xE1, 0xB9, 0xD5, 0xA3, 0xAC, 0xD5, 0x58, 0x38, 0xCB,
+    0x7C, 0x04, 0xF4, 0x5B, 0x8D, 0x91, 0xDA, 0x3A, 0xC2, 0x36, 0x63, 0x2A, 0x10, 0x7B, 0x32, 0xC7,
+    0x0C, 0x1D, 0x86, 0x38, 0x64, 0x32, 0x4F, 0x62, 0x1B, 0xCC, 0x98, 0x09, 0x0C, 0x58, 0xCE, 0x7B,
+    0x96, 0xFD, 0x72, 0x67, 0xD4, 0x94, 0x22, 0x3D, 0x91, 0xAC, 0xEF, 0x1B, 0x78, 0xD7, 0x7E, 0x6F,
+    0xD3, 0xE7, 0x80, 0xF4, 0x39, 0x43, 0x14, 0x2A, 0x16, 0x29, 0xE1, 0xAF, 0x8B, 0x07, 0x6C, 0x0B,
+    0xA4, 0x01, 0x48, 0x3B, 0x95, 0x63, 0x3B, 0x2D, 0x03, 0x0E, 0x26, 0x4D, 0x26, 0x22, 0xB5, 0x15,
+    0x91, 0x7C, 0xBF, 0xC8, 0x73, 0xF3, 0x59, 0x51, 0xCD, 0x3D, 0xC4, 0xE5, 0x5D, 0xF9, 0xE8, 0x73,
+    0xFB, 0xBF, 0xC7, 0x8A, 0x9B, 0x0E, 0xAE, 0x64, 0x05, 0xB3, 0x1C, 0x23, 0x25, 0x67, 0x06, 0x57,
+    0x4A, 0x37, 0xE9, 0xE5, 0x2E, 0x15, 0x31, 0x22, 0xE5, 0x99, 0x3E, 0x1F, 0xF5, 0xCD, 0xB5, 0xB9,
+    0x19, 0x9A, 0xFC, 0x87, 0x1C, 0x96, 0x55, 0x05, 0x87, 0xF6, 0x6A, 0xA2, 0x4F, 0x80, 0xCB, 0x07,
+    0x21, 0x76, 0xC4, 0x81, 0xF8, 0x92, 0x8B, 0xF3, 0x63, 0xDB, 0x79, 0xD8, 0xB5, 0x96, 0x30, 0xA4,
+    0x47, 0x33, 0x1D, 0xAC, 0x64, 0x69, 0xD9, 0x2F, 0x15, 0x2A, 0x80, 0x7D, 0xFC, 0xDD, 0x2B, 0xAF,
+    0x88, 0x78, 0x91, 0x76, 0xBF, 0xBC, 0xFE, 0xB1, 0xD2, 0xFD, 0x3A, 0x70, 0x02, 0xE0, 0x0B, 0x6C,
+    0x47, 0x92, 0x1D, 0xF0, 0x29, 0x37, 0xE2, 0xA4, 0xB3, 0x16, 0x11, 0x9A, 0xC1, 0xCF, 0xCF, 0x07,
+    0x2F, 0xAD, 0x47, 0xCD, 0x1A, 0x28, 0xC0, 0x54, 0x17, 0x5E, 0x6C, 0x0A, 0x09, 0x56, 0x7A, 0x25,
+    0x1D, 0xAC, 0xC3, 0x09, 0x58, 0xAA, 0xE0, 0x00, 0xC4, 0x50, 0xE4, 0x3B, 0xF9, 0x5D, 0xC7, 0xA8,
+    0x21, 0xF9, 0x52, 0x09, 0x51, 0xBF, 0x9D, 0xA6, 0xFA, 0xD8, 0x5F, 0x19, 0x01, 0x5D, 0x60, 0x81,
+    0x3A, 0xC1, 0xA4, 0x03, 0x1A, 0x0C, 0x2A, 0xFF, 0xA0, 0x02, 0x5A, 0x88, 0xC8, 0x8F, 0x45, 0x44,
+    0x5E, 0x96, 0x2B, 0x6F, 0xCA, 0x98, 0x81, 0x1B, 0xE6, 0x34, 0x1B, 0xC7, 0xDD, 0xB7, 0xD2, 0x79,
+    0x6F, 0xAB, 0xC0, 0x98, 0x75, 0x90, 0xBA, 0x31, 0x2D, 0x68, 0x10, 0xF1, 0x66, 0x9E, 0xC6, 0x3A,
+    0xCB, 0xE7, 0xCE, 0xD7, 0xD7, 0x00, 0xF5, 0x02, 0xC0, 0x01, 0x60, 0xA1, 0x1E, 0x53, 0x15, 0x80,
+    0x63, 0x3B, 0x78, 0xDD, 0xA3, 0xFD, 0xF3, 0x56, 0x02, 0x2D, 0xDB, 0x55, 0x0D, 0xB5, 0x41, 0xB5,
+    0xA8, 0xEE, 0xA4, 0x92, 0x36, 0x92, 0x56, 0x49, 0x20, 0x59, 0x87, 0xCF, 0xC1, 0xE7, 0x48, 0x3C,
+    0x0B, 0x39, 0x2B, 0x5C, 0x85, 0x49, 0x0A, 0xAC, 0xF9, 0x39, 0xC1, 0x4F, 0xDD, 0x27, 0xF6, 0xF9,
+    0x31, 0x70, 0x3A, 0xEC, 0x88, 0x4A, 0x39, 0x96, 0xB2, 0x71, 0x9C, 0xB0, 0xEF, 0x7D, 0xF1, 0xF5,
+    0x3E, 0x48, 0x8C, 0x5E, 0x7C, 0x77, 0x1D, 0x23, 0xE2, 0xB0, 0x22, 0xEF, 0x8F, 0x44, 0x48, 0x20,
+    0x1B, 0x81, 0xD7, 0xFD, 0xB3, 0x17, 0x8C, 0x08, 0x6B, 0xB0, 0xC6, 0xE7, 0x67, 0x2F, 0x58, 0x11,
+    0x3B, 0x78, 0xB9, 0xE7, 0xE1, 0x02, 0x14, 0xA7, 0x28, 0x7A, 0x66, 0x3D, 0x85, 0x8C, 0x60, 0xF2,
+    0x41, 0x58, 0xBD, 0x5A, 0xA1, 0x9F, 0x08, 0xF0, 0xD8, 0xC2, 0xBD, 0xDE, 0xCA, 0xC3, 0x5F, 0x09,
+    0x44, 0xBD, 0x2D, 0xC9, 0x6E, 0xB5, 0x44, 0xDD, 0x78, 0xA1, 0x3A, 0x5B, 0x92, 0x6E, 0x5F, 0x6C,
+    0x35, 0xA8, 0x60, 0xF3, 0x7B, 0x2E, 0x4A, 0xD2, 0x9B, 0x81, 0x28, 0x64, 0x35, 0xC5, 0x0D, 0x79,
+    0x73, 0xD6, 0x1A, 0x11, 0xC9, 0x45, 0xC4, 0xC7, 0x22, 0x1D, 0xC9, 0xAE, 0x0C, 0x1C, 0xEC, 0x45,
+    0x17, 0x1F, 0x3D, 0xC6, 0xD5, 0x22, 0xDF, 0xCF, 0x6E, 0x03, 0x67, 0x8A, 0xB9, 0x54, 0xD1, 0x0E,
+    0xA7, 0xB0, 0x86, 0xD9, 0xAA, 0x09, 0x6B, 0x98, 0x9B, 0x9E, 0x90, 0x61, 0x6E, 0x36, 0x7A, 0x1E,
+    0x13, 0x32, 0xF2, 0x73, 0x67, 0xBB, 0x8D, 0x21, 0xFC, 0xC3, 0x21, 0x12, 0x91, 0x1C, 0xE9, 0x9F,
+    0xBF, 0x77, 0x8A, 0xEB, 0x39, 0x4F, 0xB7, 0x3F, 0x04, 0x9E, 0xD2, 0xF7, 0xE6, 0x69, 0x26, 0x3E,
+    0xDB, 0xC9, 0x44, 0xFC, 0xC0, 0xCC, 0x5C, 0xE5, 0x2A, 0x71, 0x6E, 0x60, 0xED, 0xC9, 0x0A, 0x25,
+    0xED, 0xCE, 0xC8, 0xEF, 0x35, 0xFE, 0x4E, 0xC1, 0x29, 0xEB, 0x06, 0xAE, 0xF6, 0x0C, 0x59, 0xBA,
+    0x87, 0xBD, 0xFB, 0x71, 0x95, 0x93, 0x6E, 0xB5, 0xA8, 0x90, 0x39, 0xB2, 0x9B, 0x3D, 0x71, 0x48,
+    0xFB, 0x17, 0xE5, 0xA2, 0x88, 0x34, 0x46, 0x44, 0x86, 0x54, 0x9E, 0xD9, 0x68, 0x86, 0x1F, 0xE4,
+    0x20, 0xB5, 0xAA, 0x92, 0x67, 0x37, 0xB0, 0x32, 0xE6, 0x2C, 0xEF, 0xEE, 0xDC, 0x6D, 0x06, 0xDB,
+    0xE9, 0x36, 0x83, 0x5B, 0xF5, 0xC0, 0xA0, 0x27, 0x64, 0xB9, 0x9D, 0x87, 0xAD, 0x44, 0x36, 0xB4,
+    0xFC, 0x89, 0x53, 0x27, 0xC7, 0x5C, 0xE2, 0x13, 0xEB, 0x10, 0xEF, 0x07, 0xBE, 0x50, 0x8D, 0x77,
+    0x3E, 0x29, 0x1E, 0xC9, 0x60, 0xF1, 0x00, 0x54, 0x8E, 0xE4, 0xF7, 0xEF, 0x86, 0x43, 0x3F, 0x28,
+    0x8F, 0x0B, 0x70, 0x8A, 0x8C, 0xC8, 0xAB, 0x80, 0x71, 0x49, 0x4D, 0xC1, 0x3E, 0xB8, 0xC7, 0xA7,
+    0x7A, 0x18, 0x16, 0x72, 0xEB, 0xC8, 0x6A, 0x5B, 0x8E, 0x4D, 0x35, 0x6F, 0xD2, 0xBB, 0x1A, 0x67,
+    0xF3, 0xF7, 0x6A, 0x4A, 0x52, 0x97, 0x39, 0x32, 0x97, 0xD5, 0x14, 0x2E, 0xED, 0x5F, 0x94, 0x32,
+    0x15, 0x91, 0xDC, 0x88, 0x08, 0xB1, 0x48, 0xC7, 0x0E, 0xB7, 0x2C, 0xC0, 0x49, 0xD5, 0x60, 0xCA,
+    0x2C, 0x57, 0x8D, 0x6E, 0xC8, 0xF2, 0x43, 0x28, 0xEE, 0xC3, 0x35, 0x26, 0xD7, 0x35, 0x53, 0x4C,
+    0x49, 0x83, 0x45, 0xD7, 0x04, 0x4C, 0xA9, 0x3D, 0x6B, 0x18, 0xC7, 0x06, 0x96, 0xC8, 0x13, 0x48,
+    0x2A, 0xE3, 0x49, 0xB7, 0xF5, 0x99, 0xC8, 0x06, 0xC8, 0xCF, 0xFC, 0x10, 0x9B, 0x7D, 0x18, 0x16,
+    0x9E, 0xF8, 0xA8, 0xA7, 0x60, 0x0C, 0x50, 0xCD, 0x93, 0x4D, 0x67, 0x43, 0xAE, 0xE9, 0x07, 0x98,
+    0x7F, 0xCB, 0x43, 0x6A, 0x69, 0x3D, 0x58, 0xB9, 0x45, 0x0E, 0xFF, 0x74, 0x7B, 0x39, 0x1A, 0xC0,
+    0xC2, 0x61, 0x95, 0x42, 0x97, 0x1E, 0x18, 0x16, 0xAF, 0xBD, 0xA6, 0xBE, 0x03, 0xD8, 0xB4, 0x39,
+    0xA0, 0x9B, 0x4D, 0x00, 0x73, 0x33, 0x00, 0x14, 0xB1, 0x07, 0xA2, 0xD6, 0x54, 0x80, 0xA9, 0x6C,
+    0xA9, 0x3D, 0x96, 0x19, 0x69, 0xAD, 0x82, 0x0A, 0x88, 0x33, 0xB5, 0x6E, 0x62, 0x29, 0x6D, 0x6E,
+    0x6A, 0x2B, 0x2A, 0x90, 0xDD, 0xEC, 0xFB, 0xC4, 0x33, 0x33, 0x3F, 0x09, 0xB6, 0x54, 0x61, 0x76,
+    0xA9, 0xED, 0xD0, 0x3F, 0xEF, 0xCC, 0x3B, 0x1E, 0x23, 0x3E, 0x15, 0x47, 0x26, 0xB9, 0xED, 0xA1,
+    0x08, 0xCC, 0x5A, 0x90, 0x5A, 0x49, 0x85, 0x1E, 0xE0, 0x0F, 0x13, 0x86, 0x7D, 0x1E, 0xAB, 0x00,
+    0xD7, 0x81, 0xE8, 0x2D, 0x20, 0xF9, 0xA2, 0x83, 0xCF, 0x6D, 0xDB, 0xFD, 0xDB, 0xE5, 0xF3, 0xC0,
+    0xEF, 0x59, 0x20, 0x64, 0x39, 0xAA, 0x4D, 0x4B, 0xA2, 0xC6, 0xB8, 0x89, 0xF6, 0xC6, 0x6D, 0x6A,
+    0x9F, 0xBC, 0x22, 0x5F, 0xAA, 0xE3, 0xDB, 0xF2, 0x9D, 0x6A, 0x3B, 0x01, 0xD8, 0x45, 0xF2, 0x23,
+    0x29, 0x95, 0x6C, 0x09, 0xC8, 0xE3, 0x02, 0x9B, 0xCC, 0xE1, 0x10, 0x33, 0x07, 0x6C, 0xFF, 0x67,
+    0x0D, 0xCB, 0x71, 0xC9, 0xFE, 0xBB, 0xF3, 0x69, 0xB4, 0x87, 0xCD, 0xAC, 0xC4, 0xB8, 0x40, 0xD4,
+    0x26, 0x1E, 0x8B, 0xCD, 0x4D, 0x1D, 0x05, 0x15, 0x30, 0x95, 0x2D, 0x99, 0x25, 0x1E, 0xDD, 0xF6,
+    0x90, 0x89, 0x03, 0x69, 0x21, 0x11, 0x06, 0x2F, 0x69, 0xEF, 0x76, 0x16, 0xEB, 0x20, 0x0E, 0xC0,
+    0x6C, 0xDC, 0xCE, 0xC2, 0x98, 0xD8, 0xC4, 0x51, 0x86, 0x00, 0xC9, 0x79, 0x54, 0xBD, 0xCC, 0x83,
+    0x3C, 0x72, 0xAF, 0x78, 0xA7, 0xB1, 0x63, 0xC3, 0x94, 0xBA, 0x4E, 0xF3, 0x34, 0xB7, 0x6C, 0x70,
+    0x5E, 0x7B, 0x42, 0x5A, 0xAA, 0xF6, 0x3A, 0xFA, 0x1D, 0x4F, 0x2C, 0x0E, 0xD3, 0x0F, 0x28, 0xB3,
+    0x75, 0x03, 0xBC, 0xD6, 0x42, 0x56, 0x11, 0x0B, 0xB1, 0x78, 0x52, 0x81, 0x62, 0xB7, 0xB7, 0x17,
+    0x57, 0x59, 0xCE, 0xA6, 0x6E, 0x30, 0xDE, 0x96, 0x88, 0xBE, 0x8F, 0x52, 0xFB, 0xC8, 0x79, 0x4F,
+    0xE6, 0x63, 0x30, 0x24, 0x21, 0x4F, 0x78, 0xEF, 0xE4, 0x68, 0x2D, 0x63, 0x8E, 0x6C, 0x18, 0xF6,
+    0xEB, 0xFD, 0x8B, 0xCB, 0x57, 0x5A, 0x20, 0x6B, 0x80, 0x59, 0x05, 0x91, 0x94, 0x90, 0xF4, 0xC3,
+    0x56, 0xEF, 0x01, 0x61, 0x8F, 0xC4, 0x8D, 0x04, 0x65, 0x01, 0x98, 0x35, 0x10, 0x49, 0x05, 0x89,
+    0x94, 0x90, 0xF5, 0xA3, 0xA9, 0xD6, 0x14, 0x22, 0xD2, 0x16, 0x22, 0x83, 0x59, 0xD4, 0x81, 0x87,
+    0xA3, 0x83, 0x45, 0x3B, 0xD9, 0x83, 0x32, 0x8C, 0xE6, 0x80, 0x74, 0x5A, 0xA4, 0x7A, 0xF8, 0x74,
+    0x07, 0x36, 0xC7, 0x54, 0xE8, 0x16, 0x7A, 0xB0, 0x25, 0x69, 0x4D, 0xDC, 0xA2, 0x7A, 0xC8, 0x44,
+    0xF4, 0x90, 0x80, 0x30, 0x07, 0xAB, 0xAF, 0x6F, 0xEF, 0xB6, 0xEA, 0xB7, 0x9B, 0x4F, 0x88, 0x43,
+    0xE3, 0x86, 0x6C, 0xBA, 0x6A, 0xCF, 0x36, 0xC8, 0x39, 0x11, 0x95, 0x95, 0x4E, 0x9D, 0xFE, 0xC7,
+    0x15, 0xBA, 0x81, 0x0E, 0x6C, 0x89, 0xA9, 0xD1, 0x03, 0x5F, 0x45, 0x49, 0x5A, 0x13, 0x0D, 0xDB,
+    0xC1, 0x2F, 0x89, 0x84, 0xC1, 0xBF, 0x3C, 0x82, 0x87, 0xF8, 0x77, 0xDC, 0x18, 0x62, 0x1C, 0x06,
+    0xF1, 0xA1, 0x4F, 0x8E, 0xC5, 0x28, 0xDF, 0xCF, 0x52, 0xE4, 0x98, 0x7A, 0x08, 0xC3, 0x06, 0x9E,
+    0x5F, 0x71, 0x10, 0x37, 0x11, 0xB7, 0x71, 0x68, 0x42, 0x4A, 0x52, 0x46, 0x35, 0xD7, 0x38, 0x8E,
+    0x71, 0xDA, 0x13, 0xB0, 0xF7, 0x5C, 0x4C, 0x87, 0x85, 0xE7, 0x9F, 0x8F, 0x9B, 0xC5, 0x99, 0x10,
+    0xB5, 0x1C, 0x6F, 0xA2, 0xEA, 0xA9, 0x47, 0x58, 0x49, 0xF3, 0xAD, 0xDF, 0x3F, 0x70, 0xF6, 0x0F,
+    0x5F, 0xD6, 0xED, 0xA1, 0x05, 0xEE, 0x4E, 0x38, 0x88, 0x44, 0xE4, 0xE6, 0xBB, 0x97, 0x2F, 0x9F,
+    0x5C, 0x65, 0xD5, 0xF3, 0xA7, 0x3F, 0x3D, 0x13, 0x49, 0xA3, 0x7A, 0xC6, 0x9D, 0xDE, 0x77, 0xED,
+    0xBA, 0xCF, 0x2E, 0x2E, 0x51, 0xAD, 0x28, 0xD2, 0x4B, 0x8B, 0x67, 0xFF, 0xC9, 0x1F, 0xA4, 0x25,
+    0xE7, 0xD1, 0x75, 0x52, 0x71, 0x81, 0x8E, 0xA4, 0x5E, 0xCC, 0x79, 0x81, 0x47, 0x58, 0x59, 0x8E,
+    0xCB, 0xE3, 0x2D, 0x59, 0xC9, 0x84, 0xF3, 0x63, 0x94, 0xCE, 0x63, 0xD1, 0x0D, 0x8F, 0xA2, 0x9E,
+    0x3F, 0x9D, 0x34, 0xC5, 0xA5, 0xD6, 0x5E, 0x0C, 0xA6, 0x26, 0xFD, 0x71, 0x9F, 0xBD, 0x1A, 0xEC,
+    0xA5, 0x66, 0x86, 0xFC, 0x46, 0x53, 0x5C, 0x1A, 0x70, 0xEC, 0xA8, 0xFC, 0xEF, 0xED, 0x3F, 0x8A,
+    0x4A, 0x56, 0x0E, 0xEA, 0xF6, 0xF5, 0x15, 0xB0, 0x2F, 0x9C, 0x14, 0xA9, 0x48, 0x72, 0x8E, 0xC3,
+    0x35, 0xA2, 0x3A, 0x8E, 0x17, 0x8F, 0xAD, 0x70, 0xE0, 0xC4, 0x89, 0xCF, 0x10, 0x71, 0x40, 0xFD,
+    0x6B, 0x13, 0xAC, 0xFF, 0x66, 0x7E, 0x82, 0x32, 0xE2, 0xC4, 0xAF, 0xAD, 0x9F, 0x88, 0x06, 0xD7,
+    0x55, 0x2E, 0x49, 0xFF, 0x1C, 0x60, 0xCD, 0xCB, 0x3F, 0xE9, 0xEE, 0xF9, 0x01, 0x81, 0x39, 0x0B,
+    0x0B, 0xFF, 0xA0, 0xCF, 0x5E, 0x0D, 0xD9, 0x56, 0x5B, 0xFC, 0x86, 0xDF, 0xB3, 0xAF, 0x7D, 0xE5,
+    0x60, 0x54, 0xAE, 0x46, 0x9D, 0x5A, 0xFF, 0xF4, 0xF2, 0x74, 0x3A, 0x9D, 0x4E, 0xAD, 0x98, 0x27,
+    0xB7, 0xCA, 0xAB, 0xF5, 0xB1, 0xBD, 0x1C, 0xB2, 0x82, 0xF6, 0x1C, 0xF7, 0x51, 0xE5, 0x57, 0xB9,
+    0xBA, 0xB7, 0xAB, 0xC7, 0x5F, 0x0D, 0x58, 0xB8, 0xEC, 0x67, 0xE2, 0x80, 0x3D, 0x9F, 0xEE, 0xFC,
+    0xF2, 0xC0, 0xCA, 0x81, 0x03, 0xAB, 0x87, 0x56, 0x93, 0xA5, 0x68, 0xEB, 0xBB, 0x5E, 0x82, 0xED,
+    0x57, 0x16, 0x4F, 0x2C, 0x9E, 0x58, 0x3C, 0xB1, 0x68, 0x7B, 0x38, 0xFA, 0x77, 0x1F, 0x7C, 0xEC,
+    0xD2, 0x03, 0x27, 0x6E, 0x1E, 0xF8, 0xEC, 0x13, 0x3C, 0xB2, 0xFE, 0x67, 0x31, 0x7F, 0xBE, 0x52,
+    0xED, 0xF9, 0x9A, 0x43, 0x93, 0xC5, 0x23, 0x87, 0x88, 0x73, 0x0C, 0x1C, 0x85, 0xE9, 0x8E, 0x3A,
+    0xDB, 0xCD, 0xED, 0xC3, 0xA7, 0x8D, 0x6C, 0x95, 0x57, 0xEB, 0x63, 0x0F, 0xA9, 0xBD, 0x9D, 0x33,
+    0x96, 0xCB, 0x52, 0xCF, 0x86, 0x14, 0xE4, 0xE5, 0xE8, 0xB5, 0xEA, 0xF8, 0x34, 0xBA, 0x5D, 0xAD,
+    0x4D, 0xF5, 0xED, 0x6A, 0xED, 0x6F, 0x46, 0xEB, 0x60, 0x7B, 0xDB, 0x63, 0xB1, 0xF3, 0x4D, 0xAC,
+    0x9F, 0x65, 0x3F, 0x38, 0x0E, 0xA8, 0x9F, 0xFE, 0xC7, 0x2F, 0x34, 0x2F, 0x27, 0xFF, 0xF0, 0x6C,
+    0x51, 0x2E, 0x9E, 0xA4, 0xE2, 0x00, 0x51, 0xC9, 0x67, 0xD9, 0xB5, 0xFF, 0x35, 0x0C, 0x4D, 0x2C,
+    0xE5, 0x29, 0x9B, 0xFD, 0x51, 0x8B, 0x2D, 0xB0, 0xE5, 0xF5, 0x19, 0xB1, 0xB4, 0xA4, 0x3C, 0x9C,
+    0x0F, 0xD6, 0xA4, 0x1D, 0x4D, 0xBD, 0x21, 0xAE, 0x58, 0xAB, 0x8B, 0x3F, 0xF5, 0xC9, 0x6F, 0x5C,
+    0xF4, 0x93, 0xA9, 0x7A, 0xD7, 0x3F, 0xA7, 0xB6, 0x91, 0x76, 0xD3, 0xF1, 0xD4, 0xC6, 0x5A, 0x74,
+    0xAB, 0xCA, 0xCE, 0x2C, 0x6E, 0x6F, 0xE5, 0xDB, 0x07, 0xE9, 0x16, 0x3C, 0x1E, 0x06, 0x3C, 0xEA,
+    0x81, 0x23, 0x07, 0xF6, 0xCD, 0x21, 0x20, 0xA8, 0x6A, 0x50, 0x55, 0xBC, 0xCE, 0xE1, 0x92, 0x47,
+    0xE5, 0x87, 0xC0, 0x61, 0xB9, 0x03, 0xDF, 0x46, 0x6D, 0x50, 0x83, 0xAA, 0xD6, 0xE7, 0x46, 0xD1,
+    0x68, 0x52, 0x0F, 0xA7, 0xF3, 0x5A, 0x44, 0x44, 0xFC, 0xE5, 0xCB, 0x97, 0x2F, 0x5F, 0x69, 0xE6,
+    0xB0, 0xD9, 0x76, 0xE2, 0xD8, 0xDA, 0xB0, 0x4E, 0x65, 0xF9, 0xEE, 0x0D, 0xDD, 0xBD, 0x15, 0xF9,
+    0x56, 0x8E, 0xAE, 0xA0, 0x61, 0xF8, 0xB1, 0x02, 0xB4, 0x88, 0x17, 0x09, 0x6B, 0xC3, 0x1F, 0x3B,
+    0x9F, 0x88, 0xDC, 0x16, 0x69, 0x87, 0xFF, 0x29, 0x01, 0xC5, 0x61, 0x11, 0x29, 0x0B, 0x91, 0xCB,
+    0xE5, 0x10, 0x6B, 0xD4, 0xD5, 0xBC, 0x89, 0x77, 0x9A, 0x1A, 0x88, 0xBF, 0xFF, 0x6D, 0x88, 0x45,
+    0x2A, 0xE2, 0x4E, 0x37, 0xC4, 0x9E, 0x40, 0x5C, 0x31, 0x21, 0xAE, 0x98, 0x12, 0x3B, 0x96, 0x89,
+    0xDD, 0x70, 0x35, 0x25, 0xAE, 0x16, 0x02, 0x71, 0x65, 0x5A, 0x92, 0xDA, 0x54, 0xB0, 0xB3, 0x95,
+    0xF0, 0xDA, 0x90, 0x7B, 0x71, 0xBF, 0xA4, 0xDA, 0x21, 0xAB, 0xFD, 0xD5, 0x21, 0xF1, 0x21, 0xF2,
+    0xDB, 0x3F, 0x00, 0x60, 0xB9, 0x5F, 0x94, 0xBC, 0x44, 0xB7, 0x3B, 0x27, 0x07, 0x1C, 0xEE, 0xC1,
+    0x48, 0x8F, 0x6E, 0x54, 0x20, 0xA0, 0xEB, 0x2C, 0x27, 0xD5, 0x35, 0x9C, 0x9A, 0x02, 0xF1, 0x9B,
+    0x97, 0xD7, 0x99, 0x49, 0x4F, 0x22, 0x52, 0xB3, 0x31, 0xE7, 0xAD, 0x00, 0x74, 0x47, 0x1C, 0xAC,
+    0x5C, 0x91, 0x9B, 0xDB, 0x7E, 0x88, 0x15, 0x71, 0x3B, 0xBF, 0x00, 0xF2, 0x09, 0x00, 0x89, 0xE9,
+    0xD6, 0x9E, 0x1C, 0xA8, 0x2F, 0xDF, 0x6A, 0x3A, 0xFB, 0xAD, 0x1F, 0xDC, 0x91, 0xE2, 0x7B, 0x03,
+    0x1A, 0x13, 0x2C, 0xC1, 0x3E, 0x1E, 0x8A, 0x67, 0xBA, 0x0F, 0x39, 0x2D, 0x6C, 0x17, 0x68, 0x9E,
+    0x8C, 0x30, 0x73, 0xD4, 0x92, 0xD4, 0x64, 0x25, 0x3D, 0xBA, 0xC5, 0xD4, 0xD8, 0x9C, 0x0E, 0xDD,
+    0x60, 0x2A, 0x6C, 0xBE, 0x0D, 0x4D, 0xCF, 0x54, 0x12, 0x8C, 0x54, 0x56, 0x90, 0x46, 0x0B, 0x2A,
+    0xE7, 0xFF, 0x03, 0xC5, 0xBC, 0x5B, 0x8C, 0x1D, 0x47, 0x9A, 0xDF, 0xF9, 0xCB, 0x0C, 0x91, 0x39,
+    0x56, 0x92, 0x0C, 0x3D, 0xB4, 0xD6, 0x7D, 0x11, 0x99, 0xFD, 0x20, 0x03, 0xB4, 0x86, 0x64, 0x36,
+    0x0C, 0xD9, 0x20, 0xEC, 0x53, 0x27, 0x82, 0x92, 0x61, 0x2D, 0x20, 0xD8, 0xD2, 0x60, 0xC5, 0x9E,
+    0xC5, 0x0C, 0x76, 0xE4, 0x87, 0x31, 0xE0, 0xB9, 0x99, 0x04, 0x2C, 0x2C, 0xF8, 0x50, 0x55, 0x99,
+    0x12, 0x0D, 0xC8, 0x70, 0x1B, 0x10, 0x61, 0x8F, 0x60, 0x03, 0xC6, 0xA2, 0xF9, 0x20, 0x63, 0x77,
+    0xAA, 0x8D, 0x21, 0x01, 0xF3, 0x81, 0x9E, 0x3D, 0x55, 0x19, 0x24, 0x77, 0x46, 0x0F, 0xFD, 0xA0,
+    0x14, 0x89, 0x46, 0xC3, 0xE8, 0xDD, 0x65, 0x8C, 0x28, 0x4D, 0xAF, 0xD5, 0xB0, 0x15, 0x6A, 0x65,
+    0x8F, 0x92, 0x52, 0x64, 0x7E, 0xFB, 0x90, 0xE7, 0x54, 0x15, 0x75, 0x19, 0xF4, 0xD8, 0x86, 0x9D,
+    0xCC, 0x13, 0x11, 0x19, 0xE4, 0x39, 0x71, 0xC9, 0x88, 0xEF, 0xF2, 0xFF, 0xFE, 0x41, 0x44, 0x22,
+    0x60, 0x44, 0x00, 0x8D, 0x72, 0xA0, 0x1C, 0x01, 0x08, 0xAC, 0x01, 0x33, 0xB4, 0x05, 0x8D, 0x6A,
+    0x41, 0xD5, 0xC8, 0x68, 0xF1, 0x98, 0xEF, 0x45, 0x4E, 0xA3, 0xAD, 0xAE, 0x8F, 0xA1, 0x5A, 0x42,
+    0x56, 0xD3, 0x71, 0x32, 0x69, 0x59, 0x23, 0xB7, 0xD7, 0xD0, 0x56, 0xB5, 0x27, 0x51, 0xFE, 0x1B,
+    0x41, 0x5B, 0x44, 0x62, 0xE9, 0x30, 0x12, 0xB5, 0x47, 0xCB, 0xBB, 0x4C, 0xD7, 0x23, 0x00, 0xCC,
+    0x20, 0xFC, 0x7C, 0xA9, 0x11, 0x91, 0xD1, 0x1A, 0x91, 0x4F, 0xAE, 0xF8, 0x19, 0x04, 0xFA, 0x19,
+    0x74, 0xCC, 0xF6, 0xA5, 0x6B, 0x33, 0xE8, 0xD8, 0x98, 0x41, 0xF7, 0x3F, 0xC4, 0x19, 0x88, 0xF4,
+    0x33, 0x10, 0x09, 0x33, 0x98, 0xBE, 0x2B, 0xA1, 0x10, 0x91, 0x98, 0x89, 0x88, 0xF0, 0xBC, 0x0A,
+    0x00, 0x11, 0xC0, 0x00, 0x68, 0x07, 0x2C, 0x2B, 0xBF, 0x66, 0xC1, 0x34, 0x03, 0x14, 0x22, 0x8E,
+    0x6C, 0x4C, 0x3B, 0x92, 0x91, 0x39, 0x54, 0x64, 0x8E, 0xC2, 0x25, 0x81, 0x2C, 0xB0, 0x4E, 0x1A,
+    0x29, 0xA0, 0xB1, 0x99, 0xA3, 0x6C, 0xD3, 0x40, 0xDE, 0xB1, 0x20, 0x1D, 0x30, 0x96, 0xC6, 0xEA,
+    0x16, 0xAE, 0x4E, 0xA3, 0xE4, 0x18, 0xA0, 0x81, 0xCC, 0xF1, 0xC0, 0x95, 0xF9, 0x3C, 0xA4, 0x5D,
+    0x16, 0xD8, 0x56, 0x3D, 0xE5, 0x53, 0x11, 0xED, 0x06, 0x54, 0x10, 0x88, 0x15, 0x18, 0x53, 0xA3,
+    0x3F, 0x70, 0x64, 0xD2, 0x92, 0x48, 0x80, 0xAA, 0x87, 0x52, 0x2C, 0xB9, 0x74, 0xA4, 0x9F, 0x88,
+    0x65, 0x34, 0x1D, 0xE6, 0xA2, 0x58, 0xED, 0xAB, 0x4E, 0x75, 0xB9, 0xD8, 0x01, 0xE9, 0x8C, 0xD5,
+    0x62, 0xB9, 0xBE, 0x3B, 0xBC, 0x01, 0xE0, 0x37, 0xF8, 0xCC, 0xA5, 0x1D, 0x07, 0xAC, 0x81, 0xAA,
+    0x8E, 0xA8, 0x51, 0x05, 0x8A, 0xA8, 0x1D, 0x12, 0x8C, 0xCD, 0xC4, 0x0D, 0x94, 0xA2, 0x3A, 0x86,
+    0xA8, 0x7D, 0x7E, 0x2F, 0x98, 0xDA, 0x3C, 0xE7, 0x76, 0xD2, 0x58, 0x3D, 0x15, 0xF5, 0xDB, 0x43,
+    0x1E, 0x9A, 0xAC, 0x2B, 0x6F, 0x75, 0x85, 0xAF, 0x4A, 0x57, 0xBD, 0x1C, 0x87, 0x64, 0xCC, 0x3E,
+    0x0D, 0x59, 0x2C, 0xC4, 0x16, 0xA1, 0x8A, 0x54, 0x4E, 0x7C, 0x22, 0x4A, 0xC8, 0xA2, 0xAA, 0x55,
+    0x9D, 0x73, 0x84, 0xE2, 0xDB, 0x81, 0x52, 0x2C, 0x85, 0xDF, 0xDF, 0x83, 0xAF, 0xC0, 0xF3, 0x3D,
+    0xF9, 0x8D, 0xC0, 0x5C, 0x85, 0xA4, 0xCB, 0xDA, 0xDC, 0x69, 0x67, 0x28, 0xEA, 0x1E, 0x93, 0xB5,
+    0x6C, 0x1A, 0x18, 0x22, 0x89, 0x78, 0x94, 0x58, 0xF2, 0x01, 0x74, 0x00, 0xE3, 0x60, 0x84, 0x3C,
+    0x90, 0x48, 0x9D, 0x4A, 0x24, 0x17, 0x47, 0xD9, 0x4D, 0x3F, 0xF9, 0x28, 0xBC, 0xD0, 0xA3, 0xEE,
+    0x79, 0xF4, 0x6B, 0x35, 0xF3, 0x39, 0xF4, 0x3F, 0xDF, 0xE3, 0x0F, 0xCE, 0x6E, 0x1A, 0x91, 0x5E,
+    0x44, 0x3C, 0x33, 0x20, 0x80, 0x72, 0xD3, 0x3B, 0x3B, 0x0E, 0xC9, 0x65, 0xC8, 0x1D, 0x94, 0x16,
+    0x76, 0xF8, 0xFC, 0x95, 0x8E, 0x24, 0x32, 0xB0, 0xC1, 0x55, 0x6D, 0xD5, 0x0D, 0xCF, 0xAC, 0xBC,
+    0x22, 0xF7, 0x44, 0xC6, 0xB5, 0xE7, 0x51, 0x2D, 0xCC, 0x41, 0xF5, 0xA0, 0xEF, 0x7F, 0xDB, 0x35,
+    0x12, 0x13, 0x11, 0x97, 0x36, 0x2D, 0xD7, 0x81, 0x39, 0xA0, 0x2D, 0xC9, 0x15, 0x71, 0xC8, 0x78,
+    0x79, 0x5A, 0x2C, 0x1A, 0x50, 0x37, 0xDE, 0x20, 0xF9, 0x58, 0x5A, 0x2A, 0x19, 0x28, 0x42, 0x51,
+    0xE7, 0x21, 0x09, 0x69, 0xC7, 0x8C, 0x05, 0x9A, 0x12, 0xD5, 0x6A, 0x47, 0xA7, 0x02, 0x6B, 0x44,
+    0x74, 0x6D, 0xC8, 0x82, 0x6E, 0x93, 0x41, 0x75, 0x48, 0x4D, 0x2A, 0x0E, 0xA4, 0x05, 0x53, 0x4F,
+    0xFD, 0xCB, 0xE1, 0x08, 0x9C, 0x84, 0x19, 0xD3, 0xBA, 0x00, 0x4A, 0x19, 0x8D, 0x88, 0x81, 0x2F,
+    0xB8, 0xED, 0xEA, 0xAE, 0x31, 0x35, 0x49, 0x53, 0xE7, 0xAF, 0x87, 0x63, 0xCC, 0x66, 0x1C, 0x7D,
+    0x09, 0x2A, 0xA1, 0x11, 0xAE, 0xC1, 0x3A, 0x54, 0x67, 0x1B, 0x23, 0x43, 0x21, 0x31, 0x15, 0x0F,
+    0xD0, 0xF4, 0x88, 0xD0, 0xC1, 0x0C, 0xB4, 0x25, 0x1D, 0xC0, 0x8C, 0x24, 0x4D, 0x07, 0x15, 0xE8,
+    0x76, 0xF3, 0x7B, 0x5D, 0x25, 0xD1, 0xC8, 0x98, 0x34, 0xF7, 0x29, 0xF5, 0x9D, 0x9F, 0x8D, 0x00,
+    0x1C, 0xCB, 0x5E, 0xF6, 0x17, 0x8E, 0x65, 0x2F, 0xFB, 0xEB, 0x65, 0x7E, 0x2B, 0x44, 0xA3, 0x5B,
+    0xA0, 0xA8, 0xB7, 0xCB, 0x7A, 0xDB, 0xB8, 0xD1, 0x38, 0xD9, 0x9B, 0xEA, 0x23, 0x70, 0xEC, 0x73,
+    0xF7, 0x29, 0x28, 0xA1, 0x7C, 0x70, 0x08, 0x59, 0xCB, 0x0E, 0xDA, 0xB3, 0xF7, 0xE5, 0xE3, 0x28,
+    0xC7, 0x6C, 0x5F, 0x92, 0x39, 0xD6, 0x97, 0x49, 0xCD, 0x05, 0xF2, 0x9A, 0xEB, 0x68, 0x9B, 0x75,
+    0x85, 0x28, 0x71, 0x8F, 0x5A, 0xB4, 0x04, 0xD4, 0x0F, 0xD6, 0xA1, 0xCD, 0xE1, 0xC9, 0xD4, 0x71,
+    0x98, 0xAB, 0x28, 0x5B, 0x0E, 0xB8, 0x3C, 0x6D, 0xBF, 0x95, 0xBA, 0x13, 0x87, 0xB8, 0x9A, 0x65,
+    0x9C, 0x48, 0x6E, 0xB8, 0xFC, 0xE0, 0x87, 0x21, 0x95, 0xBE, 0x43, 0xBA, 0xDD, 0x06, 0x7D, 0xE2,
+    0x3E, 0xF7, 0x11, 0x11, 0xFF, 0xDE, 0xB7, 0xDB, 0x75, 0x9F, 0xB8, 0xC3, 0x3E, 0x69, 0x0F, 0xFB,
+    0xA4, 0x3D, 0xE2, 0x93, 0xB7, 0x37, 0x7C, 0x22, 0xD1, 0x27, 0xE2, 0xB9, 0x0E, 0xF4, 0x40, 0x07,
+    0xBF, 0x25, 0x61, 0x5A, 0x16, 0x93, 0x40, 0x86, 0xF0, 0x1B, 0x24, 0x1F, 0x4B, 0x9B, 0x88, 0x74,
+    0x89, 0x24, 0x7D, 0x1A, 0x59, 0x4F, 0x3B, 0x66, 0x69, 0x60, 0x96, 0x06, 0xD6, 0xD4, 0x83, 0x9F,
+    0x4D, 0xD5, 0xB1, 0xA3, 0x3A, 0x76, 0x50, 0x35, 0x5C, 0x05, 0x0D, 0xA9, 0x9F, 0x16, 0xD9, 0x74,
+    0x3D, 0x7F, 0xC0, 0xEA, 0x33, 0x1D, 0x61, 0x8E, 0xCE, 0x5D, 0xF2, 0x61, 0x47, 0x31, 0x27, 0x9D,
+    0xF6, 0x53, 0x2A, 0x60, 0x22, 0x4A, 0x02, 0x73, 0xD3, 0x2A, 0x2F, 0x76, 0x9E, 0x0D, 0x59, 0x5B,
+    0xF4, 0x49, 0x80, 0xAC, 0x85, 0xA2, 0x86, 0xDF, 0xDC, 0xB7, 0x09, 0x94, 0x63, 0x98, 0x51, 0xDC,
+    0x71, 0xEA, 0x3F, 0xCE, 0xF8, 0x77, 0x77, 0x5C, 0x71, 0x72, 0xA6, 0x6E, 0xDF, 0x69, 0x17, 0xA7,
+    0xD6, 0x74, 0x7A, 0xEF, 0x8E, 0x9F, 0xAF, 0xAD, 0xAB, 0x7B, 0x77, 0xED, 0xDC, 0x04, 0x75, 0x2F,
+    0x32, 0x37, 0xB5, 0xF2, 0x3C, 0x0A, 0x9A, 0x23, 0x9C, 0xE4, 0x1A, 0x46, 0x1C, 0x66, 0x80, 0x03,
+    0xF6, 0x0B, 0xF6, 0x97, 0xB6, 0xAC, 0x17, 0xA4, 0x61, 0x8E, 0xAE, 0x37, 0xD8, 0x20, 0xA6, 0x21,
+    0xE9, 0xB4, 0x53, 0x61, 0x93, 0xEC, 0x9D, 0x0E, 0x7D, 0xD7, 0x51, 0x08, 0x98, 0x1E, 0xAA, 0x16,
+    0x04, 0x54, 0x04, 0xED, 0xA1, 0xB1, 0x14, 0x91, 0x42, 0x1C, 0x55, 0x24, 0x91, 0xE9, 0xC7, 0x5F,
+    0xE2, 0x7F, 0x6D, 0x93, 0x1F, 0xD9, 0xEC, 0x77, 0x38, 0x7A, 0xED, 0xF3, 0xC5, 0x73, 0x32, 0x34,
+    0xD2, 0x25, 0x8E, 0x0C, 0x1E, 0x83, 0x47, 0x48, 0x3C, 0x5C, 0x79, 0xFF, 0x8D, 0x4C, 0xC4, 0x17,
+    0x22, 0x75, 0xE2, 0x21, 0xAB, 0xA1, 0x04, 0x9A, 0xD7, 0x49, 0x45, 0xEA, 0xBC, 0xCB, 0x5C, 0x61,
+    0x33, 0xBB, 0xC1, 0x91, 0xA4, 0x63, 0x96, 0x85, 0xD4, 0x6B, 0x91, 0xDA, 0xC8, 0x48, 0x25, 0x81,
+    0x6A, 0xD9, 0xEE, 0x65, 0xF6, 0xBD, 0x49, 0x78, 0xE2, 0x93, 0xDF, 0xC3, 0xC8, 0x40, 0xD2, 0x4D,
+    0x6F, 0x9B, 0xF1, 0x2C, 0x88, 0xB4, 0x0C, 0x74, 0x44, 0x66, 0xF4, 0x9C, 0x20, 0x32, 0x63, 0x48,
+    0x22, 0x22, 0x91, 0x46, 0x22, 0x46, 0x3A, 0x0E, 0x9C, 0xB5, 0x5A, 0x44, 0x46, 0x25, 0x22, 0x52,
+    0x37, 0x3F, 0x38, 0xDB, 0x78, 0xDD, 0x61, 0x3C, 0x42, 0xE9, 0xD1, 0xBE, 0xF0, 0x30, 0x68, 0x0F,
+    0xFA, 0x2D, 0x0F, 0x89, 0x78, 0xC8, 0x44, 0x6A, 0xF2, 0xDB, 0x21, 0x92, 0xB9, 0x85, 0xAE, 0x95,
+    0x2F, 0x93, 0x40, 0xC8, 0xDD, 0x1A, 0x8B, 0x34, 0xE4, 0x6E, 0xCE, 0x22, 0x09, 0xDA, 0x96, 0xAC,
+    0xE5, 0xAD, 0x76, 0xDA, 0x3D, 0xB1, 0xB5, 0x75, 0x51, 0x24, 0x96, 0xB6, 0xAC, 0x17, 0x99, 0x4F,
+    0x43, 0x47, 0xBE, 0x4D, 0xD2, 0x78, 0xAE, 0xFD, 0xD4, 0x1D, 0xD1, 0x3A, 0x75, 0xE1, 0xA5, 0x99,
+    0x56, 0xAF, 0xD6, 0x61, 0x76, 0x4D, 0xA7, 0x6D, 0x3A, 0xA0, 0xCF, 0x48, 0x4F, 0x57, 0x2A, 0xAF,
+    0x9F, 0xF6, 0xFA, 0x95, 0x30, 0xCF, 0x65, 0xCC, 0x7E, 0x24, 0x52, 0x2B, 0x91, 0x48, 0x75, 0xA9,
+    0x08, 0xBA, 0xC5, 0xBC, 0x1C, 0x21, 0x96, 0x16, 0x7D, 0x27, 0xC0, 0x8E, 0x81, 0xFC, 0xDE, 0x6E,
+    0xA1, 0x83, 0xB1, 0x74, 0x14, 0x6F, 0x8B, 0xCD, 0xA3, 0x16, 0x91, 0xBA, 0x12, 0x09, 0xA9, 0x48,
+    0x24, 0x93, 0x11, 0x0E, 0xFE, 0x01, 0xE4, 0x5E, 0xDD, 0xFC, 0x71, 0x3B, 0x9B, 0xE9, 0x67, 0x5E,
+    0xFD, 0x23, 0xE9, 0x7E, 0x51, 0x46, 0xC6, 0x7F, 0xD5, 0x15, 0x36, 0xBF, 0xE5, 0x59, 0x5B, 0x43,
+    0xDD, 0x6B, 0x29, 0xD7, 0x48, 0x3F, 0xF2, 0xCC, 0x8D, 0xCD, 0xDF, 0x96, 0x0F, 0xA2, 0x16, 0xB1,
+    0xA5, 0xB4, 0x54, 0x0F, 0xE8, 0x1D, 0xBE, 0x02, 0xB0, 0xAC, 0x2C, 0x23, 0x40, 0x2E, 0x0E, 0x48,
+    0xA6, 0xAD, 0x6B, 0x44, 0x05, 0xC8, 0x7A, 0xCA, 0x1A, 0x1A, 0x92, 0x08, 0xBA, 0x45, 0xB7, 0x24,
+    0x11, 0x46, 0x30, 0x35, 0x59, 0x20, 0xEB, 0xC0, 0x58, 0x1A, 0x50, 0x11, 0xED, 0xA1, 0x74, 0xE9,
+    0x00, 0x8C, 0x18, 0x07, 0x3A, 0x64, 0x3D, 0xD0, 0xD8, 0xC6, 0x42, 0xD6, 0xEB, 0x00, 0x98, 0x9B,
+    0x23, 0x90, 0x0E, 0xA6, 0x05, 0x0A, 0x89, 0x00, 0x22, 0x35, 0x90, 0x4F, 0x0D, 0x57, 0x02, 0xA0,
+    0x26, 0x51, 0x5A, 0x0E, 0x7B, 0x1D, 0x5E, 0xBC, 0x40, 0xDA, 0xAF, 0xA3, 0xFC, 0x1A, 0x59, 0x7B,
+    0x8A, 0xDC, 0x15, 0xE8, 0x5A, 0xDB, 0x02, 0xED, 0x0C, 0x99, 0x9B, 0xA3, 0xFC, 0x02, 0x15, 0x22,
+    0xC9, 0x9F, 0xF6, 0x20, 0x61, 0xFA, 0x34, 0x7E, 0xD2, 0x96, 0xCA, 0x11, 0x98, 0x89, 0x3C, 0xFA,
+    0xCB, 0x8E, 0xB0, 0xDC, 0xFC, 0x16, 0xD6, 0x40, 0xDD, 0x16, 0x19, 0x4A, 0x91, 0xDB, 0x01, 0x4A,
+    0x48, 0x03, 0x98, 0xC9, 0x08, 0x32, 0xA0, 0xA6, 0x01, 0xEE, 0xCF, 0x6A, 0x54, 0xBF, 0x97, 0x39,
+    0x80, 0x62, 0xBA, 0x4B, 0x91, 0x9F, 0x53, 0x9B, 0x4C, 0xBA, 0x47, 0x5C, 0x23, 0xF2, 0x54, 0x98,
+    0xD4, 0xAA, 0x99, 0x2C, 0x15, 0x2D, 0x12, 0x8D, 0x48, 0x68, 0xB6, 0xB6, 0xEA, 0x61, 0x6A, 0x5F,
+    0x2F, 0x95, 0xD8, 0xB8, 0xD4, 0xA0, 0x7E, 0x7A, 0x14, 0xE0, 0xC0, 0xD9, 0x5F, 0x12, 0x39, 0x4A,
+    0xD2, 0x72, 0x8C, 0x4C, 0xC6, 0x4A, 0x6E, 0x7B, 0x4E, 0x91, 0x06, 0xCA, 0x29, 0xA1, 0x14, 0xE9,
+    0x1B, 0x91, 0x77, 0x3E, 0xD9, 0xDA, 0x7A, 0x76, 0xAF, 0x11, 0x15, 0x26, 0x53, 0xCF, 0xFC, 0xCA,
+    0xBB, 0x88, 0xF4, 0x6A, 0x48, 0xA2, 0x6E, 0x93, 0xCE, 0x90, 0xFA, 0x48, 0x76, 0xCB, 0xA3, 0x75,
+    0xCD, 0xFA, 0x9C, 0x34, 0x44, 0xCE, 0x5D, 0x0C, 0x79, 0xD4, 0xAE, 0xAC, 0xAB, 0xBE, 0x1C, 0x73,
+    0x52, 0xC7, 0x55, 0x4E, 0x90, 0xCB, 0x2B, 0x61, 0x76, 0x35, 0xFB, 0x6D, 0x7E, 0xC4, 0x5F, 0x73,
+    0x8B, 0xB0, 0x06, 0x23, 0x3B, 0x54, 0x50, 0xB1, 0xC3, 0x00, 0xC6, 0xED, 0xA4, 0x11, 0x74, 0xBB,
+    0x93, 0x75, 0x90, 0x87, 0x1D, 0xED, 0x41, 0xF5, 0x3B, 0xA5, 0x83, 0x24, 0x8A, 0xB1, 0x80, 0x88,
+    0x4C, 0x2B, 0x2D, 0x4E, 0xD3, 0xD1, 0x03, 0x68, 0x09, 0xD3, 0x5A, 0x0C, 0xFB, 0x2A, 0x1B, 0x19,
+    0x81, 0x54, 0x44, 0x6A, 0xC8, 0x45, 0xC4, 0x43, 0x39, 0x4A, 0xD3, 0x43, 0xF3, 0x53, 0x79, 0x6B,
+    0x24, 0x95, 0x3B, 0xF2, 0xA6, 0xD4, 0xB9, 0x5C, 0x94, 0x9B, 0xE2, 0x4B, 0x51, 0xE2, 0xA6, 0x6F,
+    0x92, 0xB4, 0x5F, 0x90, 0x61, 0x1F, 0xB6, 0x97, 0xBF, 0xCE, 0xBA, 0x56, 0xAD, 0xF2, 0x61, 0x41,
+    0xA1, 0xB5, 0x65, 0xF1, 0x91, 0x47, 0x7D, 0xB0, 0x80, 0x42, 0xEC, 0xB4, 0x76, 0xF2, 0x11, 0x52,
+    0xE9, 0xA1, 0x11, 0x4F, 0x29, 0x52, 0xE7, 0x1F, 0x0F, 0x63, 0x32, 0x9A, 0xEF, 0xF7, 0xD5, 0xAD,
+    0x68, 0x5A, 0xE0, 0x31, 0x20, 0x71, 0x00, 0x07, 0xE5, 0x52, 0x26, 0x92, 0xBC, 0xFE, 0x8D, 0x00,
+    0x1B, 0xA0, 0x2D, 0xAA, 0x25, 0xE9, 0x48, 0x62, 0x2A, 0x3D, 0xCD, 0x08, 0x59, 0x80, 0x39, 0xE4,
+    0x8E, 0xF4, 0x43, 0x92, 0x78, 0xFF, 0xE0, 0x68, 0x44, 0xB4, 0x48, 0xD2, 0xDC, 0x5F, 0x19, 0xF9,
+    0x1A, 0x20, 0x1F, 0x13, 0xAE, 0x72, 0x18, 0x65, 0x53, 0x57, 0xD5, 0x07, 0xAE, 0x93, 0x5B, 0x3C,
+    0x17, 0xDE, 0x1F, 0x2A, 0x29, 0x86, 0xD4, 0xF2, 0x1F, 0xA0, 0xE5, 0x49, 0xD5, 0xF3, 0x3C, 0x2A,
+    0x64, 0x81, 0x4D, 0x06, 0x32, 0x5F, 0x3A, 0x36, 0xB3, 0x8E, 0xBC, 0x1D, 0x61, 0xBB, 0x74, 0xE8,
+    0x3B, 0x1D, 0x0C, 0x02, 0xFA, 0x03, 0x07, 0xD2, 0x83, 0x16, 0xA6, 0x61, 0x15, 0x52, 0x93, 0xC8,
+    0x08, 0xC5, 0xDD, 0x9E, 0x34, 0x36, 0x9E, 0xF2, 0x96, 0xD4, 0x69, 0xD4, 0x23, 0xA6, 0xAE, 0x7A,
+    0xD5, 0xA7, 0xE2, 0x4D, 0xAD, 0xC5, 0x01, 0x27, 0x80, 0xD4, 0x01, 0x27, 0xBE, 0x9A, 0xD6, 0x6B,
+    0xBA, 0x9E, 0x15, 0xCC, 0xD6, 0x98, 0x2D, 0x58, 0x0B, 0x18, 0x4F, 0xE5, 0xA8, 0x1C, 0x55, 0x60,
+    0xA7, 0x67, 0x31, 0x72, 0xDD, 0xD4, 0x7D, 0xE1, 0xFB, 0x3C, 0xC2, 0x21, 0x38, 0xB4, 0x6B, 0xE0,
+    0x3B, 0x4A, 0x9B, 0x3B, 0x2A, 0xF2, 0x9A, 0x48, 0xFE, 0x4F, 0xCE, 0xF4, 0xE8, 0xD7, 0x2E, 0x06,
+    0xF4, 0x6B, 0xDF, 0x69, 0xD1, 0xDF, 0x7D, 0xCD, 0xA1, 0xBF, 0x7B, 0x05, 0xF4, 0x77, 0xC7, 0xA5,
+    0x4C, 0x28, 0x64, 0x80, 0xE2, 0x5C, 0x63, 0x29, 0xCF, 0x7D, 0xD7, 0x53, 0x9E, 0xFB, 0x4E, 0x4F,
+    0x79, 0xEE, 0xE2, 0x88, 0x39, 0xF7, 0xB2, 0xD4, 0xE6, 0x51, 0x1A, 0x6F, 0xC0, 0xF4, 0x5F, 0xE5,
+    0x6B, 0xA9, 0x53, 0xED, 0x8C, 0xEB, 0xEA, 0xAD, 0x82, 0xB5, 0x8F, 0x5A, 0x75, 0xF7, 0x02, 0x73,
+    0x21, 0x13, 0xCF, 0x86, 0xD4, 0xD9, 0x15, 0xC3, 0x1F, 0x7C, 0x18, 0xF3, 0xDF, 0xCF, 0xC3, 0x75,
+    0x8C, 0xCB, 0xDA, 0x3C, 0x94, 0xF2, 0x6A, 0xA7, 0xE5, 0x5E, 0x8F, 0x79, 0x2A, 0xA2, 0xDB, 0xFF,
+    0x5A, 0x8E, 0xC6, 0x52, 0x41, 0xA3, 0x5A, 0x10, 0x71, 0x18, 0x09, 0x50, 0xD8, 0xC9, 0xD9, 0x49,
+    0x02, 0xB0, 0x28, 0x6A, 0x4A, 0xED, 0xC8, 0xDF, 0x72, 0xA4, 0x9F, 0xB6, 0xD0, 0xB4, 0x60, 0xC2,
+    0xF4, 0x5E, 0x94, 0x04, 0x88, 0x02, 0xA6, 0x08, 0xE8, 0x1B, 0x82, 0x0A, 0x65, 0x20, 0x2A, 0xA1,
+    0x91, 0x91, 0x26, 0x15, 0xE9, 0xB2, 0xEE, 0xE0, 0xD6, 0x95, 0xD6, 0xD4, 0x50, 0x3E, 0x15, 0x81,
+    0xA8, 0x5B, 0xA6, 0xCE, 0xA3, 0xDF, 0x0C, 0x4C, 0xFD, 0x87, 0x31, 0x02, 0x99, 0x4C, 0xD2, 0x15,
+    0xA6, 0x51, 0x90, 0x4A, 0xB7, 0x2B, 0x61, 0xCB, 0x2B, 0x1D, 0x30, 0x9A, 0x0E, 0x54, 0x6F, 0x3A,
+    0xD0, 0xBE, 0xEA, 0xC0, 0xD8, 0xA6, 0x83, 0x01, 0xE9, 0x50, 0x1D, 0xD2, 0x3D, 0xB1, 0x65, 0x2F,
+    0x6B, 0x69, 0x7B, 0xB8, 0xB6, 0x0E, 0x6B, 0x6B, 0xA0, 0x4B, 0x50, 0x77, 0x2D, 0x48, 0xCD, 0x52,
+    0xBE, 0x43, 0x26, 0x90, 0x7C, 0x1A, 0x60, 0x5D, 0xA0, 0xD4, 0x81, 0xFC, 0x86, 0x90, 0xFA, 0x72,
+    0x52, 0x36, 0x9B, 0x50, 0x9E, 0xE9, 0x61, 0x3B, 0xF7, 0xA4, 0x7D, 0x59, 0x93, 0xFB, 0x1D, 0x28,
+    0x5F, 0xE9, 0x61, 0x27, 0xF7, 0xA8, 0xBE, 0x74, 0x68, 0xDF, 0x80, 0xB9, 0x19, 0x41, 0xF2, 0x80,
+    0x8A, 0x46, 0x44, 0x82, 0x88, 0xC8, 0x2D, 0x11, 0x11, 0x2D, 0x22, 0xD1, 0xBC, 0xBF, 0x75, 0x25,
+    0x08, 0x98, 0x5B, 0x11, 0x44, 0x07, 0x54, 0x34, 0x0E, 0xDD, 0x8B, 0xC5, 0x84, 0xC9, 0xEA, 0x5A,
+    0x6E, 0x9E, 0xD9, 0xAF, 0xF3, 0xB5, 0x53, 0xE4, 0xCF, 0xD6, 0xE9, 0x6D, 0x4F, 0x7F, 0x9D, 0xF9,
+    0x29, 0xF4, 0x77, 0x6A, 0xF5, 0x4E, 0xA0, 0x17, 0x19, 0x8D, 0xC8, 0x5B, 0x22, 0x1F, 0x85, 0x24,
+    0x46, 0x8C, 0x41, 0xBF, 0xE5, 0x54, 0x07, 0x87, 0x41, 0x2D, 0x0D, 0xAE, 0xB4, 0x03, 0x91, 0xB1,
+    0xB4, 0x68, 0x91, 0x7B, 0x1D, 0x8C, 0x5B, 0xBF, 0x67, 0x2C, 0xBA, 0x45, 0x75, 0x30, 0xC0, 0x83,
+    0x0F, 0x35, 0xBA, 0x45, 0xF5, 0xBB, 0x0F, 0x1E, 0xD5, 0x4F, 0xDA, 0x51, 0x44, 0x3C, 0x4A, 0x44,
+    0x3E, 0xF7, 0xF0, 0xFE, 0x56, 0x13, 0x50, 0x91, 0x44, 0xC0, 0x38, 0x8A, 0xCF, 0x3C, 0x64, 0xD3,
+    0xC3, 0x05, 0x0A, 0xF9, 0x61, 0x9D, 0xCA, 0xB0, 0xCE, 0x29, 0x32, 0x97, 0x7A, 0x96, 0x85, 0xC0,
+    0x82, 0x92, 0xDC, 0xA5, 0x81, 0x46, 0x84, 0x5C, 0x64, 0x59, 0x68, 0x55, 0x60, 0x81, 0x21, 0x77,
+    0xCB, 0xC2, 0xCA, 0x6C, 0x14, 0x89, 0xA0, 0x26, 0x61, 0x3B, 0x9C, 0x7D, 0xD1, 0xC1, 0x7C, 0x52,
+    0x00, 0x35, 0x11, 0x94, 0xC7, 0x58, 0x88, 0x93, 0x96, 0x99, 0xF4, 0x8D, 0x63, 0xFC, 0xAD, 0x4B,
+    0x2A, 0x60, 0x44, 0x6C, 0x44, 0xF7, 0x59, 0x30, 0xA8, 0x88, 0xD1, 0x8E, 0x81, 0xEC, 0x56, 0xC0,
+    0x40, 0x17, 0xD1, 0x8E, 0x35, 0x83, 0x0A, 0xE8, 0xE7, 0x1C, 0x11, 0x75, 0x2B, 0x60, 0xF8, 0x46,
+    0x88, 0xE8, 0x56, 0x77, 0x06, 0xD5, 0xA9, 0x77, 0xD9, 0xDA, 0xDA, 0x02, 0x25, 0x32, 0x80, 0xAE,
+    0xE9, 0x60, 0x8E, 0x6A, 0xA1, 0x47, 0x5B, 0x54, 0x60, 0x0D, 0xB4, 0xA3, 0x03, 0x83, 0xF2, 0x10,
+    0x29, 0x6A, 0x54, 0x60, 0x13, 0xB4, 0x4B, 0x7A, 0x30, 0x64, 0x9F, 0x8E, 0x36, 0x52, 0x88, 0x5C,
+    0x0C, 0x54, 0x75, 0x69, 0x49, 0x22, 0x25, 0x64, 0x2D, 0x6B, 0x50, 0xD8, 0xC9, 0x05, 0x4B, 0x5B,
+    0x92, 0x0E, 0x6D, 0xC9, 0x5A, 0x16, 0x50, 0x58, 0x13, 0x60, 0x03, 0xB1, 0xF0, 0x42, 0xF2, 0xFC,
+    0x6A, 0x26, 0x92, 0xC5, 0x64, 0x59, 0x4C, 0xA9, 0x03, 0xD4, 0x00, 0x90, 0x44, 0x92, 0x1D, 0x88,
+    0x64, 0xD2, 0x33, 0x27, 0x6B, 0x4B, 0x0A, 0x94, 0x4B, 0x7D, 0xEE, 0x52, 0xCF, 0x69, 0x15, 0x08,
+    0x1C, 0x23, 0x32, 0x23, 0xAF, 0xE7, 0x14, 0x64, 0x4E, 0xBB, 0xCC, 0xA9, 0xA0, 0x42, 0xD2, 0xA9,
+    0x8E, 0x01, 0xA3, 0x22, 0x85, 0xD3, 0x3F, 0x89, 0x0F, 0xAB, 0xF1, 0x8C, 0x0C, 0xE7, 0x5C, 0x25,
+    0x22, 0xD2, 0xE5, 0x22, 0x22, 0x1D, 0x95, 0xFC, 0x44, 0x2E, 0xC1, 0x59, 0x00, 0xFE, 0x32, 0x90,
+    0xF7, 0x40, 0x73, 0x09, 0x94, 0xE7, 0x05, 0x4E, 0x51, 0x8C, 0x74, 0x89, 0x3F, 0x99, 0xB9, 0x23,
+    0x9C, 0x3E, 0xC6, 0x4B, 0xF8, 0x0B, 0xA9, 0xCB, 0x5E, 0xF1, 0x9A, 0x59, 0x5E, 0xCF, 0xD2, 0x50,
+    0x70, 0xBD, 0xB4, 0x1B, 0xC9, 0xC7, 0xFD, 0x37, 0x47, 0x25, 0x3F, 0xF9, 0x63, 0x11, 0x91, 0x33,
+    0x22, 0xD2, 0xF2, 0x2B, 0x97, 0x76, 0x47, 0x76, 0xA5, 0x27, 0x11, 0x71, 0x88, 0x44, 0x8C, 0x07,
+    0xDD, 0x41, 0x3A, 0x00, 0xC6, 0x4E, 0x8A, 0x87, 0x1D, 0x26, 0x43, 0x82, 0xB8, 0x2A, 0x8C, 0x4C,
+    0xFF, 0x0E, 0xF1, 0x3C, 0xA4, 0xE5, 0x93, 0xDF, 0x72, 0x95, 0x48, 0x54, 0x22, 0xE2, 0xB4, 0x48,
+    0xC4, 0x88, 0x38, 0xCE, 0x49, 0x0F, 0x59, 0x07, 0xE0, 0x96, 0xFA, 0xAE, 0xB2, 0x90, 0x4C, 0xFB,
+    0xA5, 0xF1, 0x99, 0x04, 0xED, 0x1F, 0x29, 0x2D, 0x06, 0xE6, 0xB0, 0x06, 0x6B, 0x30, 0x07, 0x63,
+    0x29, 0x3D, 0x5A, 0x82, 0x92, 0x48, 0x79, 0x1F, 0xBE, 0x05, 0xE7, 0x29, 0x5A, 0x0E, 0x60, 0x44,
+    0xA4, 0x13, 0x11, 0xB9, 0x23, 0x1F, 0xBC, 0x2F, 0x96, 0x72, 0x85, 0xD1, 0xA8, 0xB0, 0x42, 0xA0,
+    0xCC, 0x0A, 0xB1, 0x51, 0xDD, 0xAA, 0xB7, 0xC6, 0x7E, 0xAE, 0xAA, 0xB2, 0x90, 0x8C, 0x40, 0xD6,
+    0xC3, 0x04, 0xAB, 0x34, 0x35, 0xA8, 0x71, 0x57, 0x18, 0x2C, 0xA7, 0x47, 0x44, 0x8C, 0x88, 0x53,
+    0x6E, 0x9F, 0x9E, 0x7D, 0xE0, 0x21, 0x73, 0x24, 0x1D, 0x6C, 0x40, 0x61, 0xC9, 0x5B, 0xD2, 0x1A,
+    0x2E, 0x81, 0x81, 0xFC, 0x9D, 0x1E, 0xA2, 0x76, 0x94, 0x75, 0x83, 0x0A, 0xAA, 0x63, 0xA4, 0x74,
+    0x85, 0x63, 0x50, 0x3D, 0x79, 0x68, 0xC0, 0xBC, 0xE6, 0x49, 0x25, 0x82, 0x96, 0x1A, 0x9A, 0xB0,
+    0xEC, 0x80, 0x71, 0x93, 0xFF, 0xB5, 0x57, 0xA8, 0x1C, 0xE4, 0x11, 0x10, 0x07, 0x3A, 0xC2, 0x1C,
+    0x75, 0x3B, 0xB0, 0xD0, 0x56, 0xD7, 0x91, 0x2E, 0x73, 0x25, 0x73, 0xE5, 0x55, 0xD8, 0xA0, 0x78,
+    0xD6, 0xD1, 0xF7, 0xE4, 0x77, 0xA1, 0x0A, 0xA8, 0x11, 0x4A, 0x47, 0x12, 0xA1, 0xD8, 0x9F, 0xFD,
+    0x59, 0xBD, 0x1B, 0xBF, 0xB4, 0x77, 0x89, 0x48, 0x4F, 0x21, 0x52, 0xF3, 0xBD, 0xF1, 0x8D, 0x3F,
+    0xAB, 0x77, 0x4F, 0x90, 0xFE, 0xB3, 0xC0, 0xBA, 0xB6, 0xDA, 0x45, 0xBA, 0xDC, 0x95, 0xAC, 0x29,
+    0xAF, 0xC2, 0x1A, 0x45, 0xEE, 0xE8, 0x7B, 0xF4, 0x5D, 0xBB, 0xEC, 0x5D, 0x23, 0xF2, 0xA9, 0x88,
+    0xFC, 0xE6, 0x95, 0xF7, 0x2F, 0xEF, 0xEB, 0xE4, 0x2E, 0x2C, 0xD4, 0xC1, 0x7C, 0xB2, 0x82, 0xB3,
+    0x40, 0x69, 0xD9, 0xA6, 0x70, 0x68, 0xA7, 0x1D, 0x49, 0xCC, 0x3D, 0x98, 0x57, 0x03, 0xA8, 0x8F,
+    0xBB, 0x09, 0x39, 0x99, 0x1A, 0x27, 0x1D, 0x59, 0xF6, 0x05, 0x89, 0x40, 0x23, 0x35, 0x54, 0x6F,
+    0x75, 0x60, 0xDE, 0x16, 0x28, 0x7D, 0xE9, 0x29, 0x82, 0x1A, 0xD0, 0x1D, 0x95, 0xD3, 0x11, 0x1D,
+    0xF3, 0x08, 0x93, 0xD7, 0x70, 0x7A, 0x89, 0x91, 0x80, 0x9A, 0x4C, 0xED, 0xC7, 0x39, 0x98, 0xB6,
+    0x04, 0xCD, 0x8C, 0xF5, 0xBC, 0x4E, 0xFF, 0x38, 0xA0, 0x37, 0xA0, 0xAA, 0x27, 0x2B, 0xDF, 0xA2,
+    0x23, 0xE9, 0xC7, 0x81, 0xCD, 0xC2, 0x6A, 0x17, 0x55, 0xA7, 0xC2, 0x0E, 0x65, 0x0B, 0x7F, 0x01,
+    0xB8, 0x34, 0x01, 0xC3, 0x0E, 0x25, 0x12, 0xF3, 0x1A, 0xED, 0xB8, 0x0E, 0x91, 0xFF, 0x82, 0xE2,
+    0x0F, 0xCE, 0xFE, 0x3B, 0x8B, 0x88, 0x8C, 0x68, 0x11, 0xF1, 0x53, 0x11, 0x50, 0x9E, 0x25, 0x1A,
+    0xB6, 0xBF, 0x98, 0xD8, 0xB3, 0x67, 0xAD, 0x12, 0xC9, 0x39, 0xC2, 0x09, 0x4E, 0x73, 0x15, 0x9F,
+    0xBA, 0x09, 0x51, 0x7C, 0xE0, 0x51, 0x9F, 0xDD, 0xB0, 0x46, 0x84, 0x09, 0xCB, 0xDE, 0x07, 0xDD,
+    0xF1, 0x28, 0xC9, 0xF3, 0xDA, 0x11, 0x55, 0xC0, 0x10, 0xD1, 0xEE, 0x14, 0x2A, 0xE4, 0x35, 0x31,
+    0xF1, 0x18, 0x2E, 0xA0, 0x9D, 0x26, 0x0B, 0xAA, 0xCD, 0x7A, 0x2A, 0x19, 0xC9, 0xE4, 0x4A, 0xBD,
+    0xEC, 0x41, 0xBF, 0x42, 0xE7, 0x1E, 0xA8, 0x58, 0x40, 0x7E, 0x85, 0xC9, 0x6B, 0x49, 0x03, 0xB0,
+    0x58, 0xBE, 0xEA, 0xEB, 0x89, 0x7F, 0x69, 0x75, 0x3F, 0x99, 0xF8, 0xD3, 0xA9, 0x3F, 0xF9, 0xAB,
+    0x3E, 0x17, 0x4F, 0xEA, 0x49, 0xDA, 0xD5, 0x7D, 0x17, 0xBE, 0x0B, 0x7A, 0xEA, 0x5C, 0x5E, 0xB3,
+    0x76, 0x1D, 0xF5, 0xA3, 0x29, 0xFB, 0xA0, 0x66, 0xDE, 0xA3, 0x3E, 0xA8, 0xD9, 0x8C, 0xB3, 0xEC,
+    0x27, 0xB7, 0xDC, 0x58, 0xCD, 0xAA, 0x7B, 0x22, 0x63, 0x21, 0x9F, 0x86, 0xB2, 0xAF, 0x98, 0x65,
+    0x41, 0xB9, 0xDD, 0x8C, 0x2C, 0x40, 0xC6, 0x91, 0xF3, 0xFC, 0x98, 0x23, 0xE7, 0xF9, 0xC9, 0x43,
+    0xC7, 0x5E, 0xBA, 0xF9, 0xE3, 0xFF, 0x67, 0xD3, 0x48, 0x68, 0x5E, 0xE4, 0x46, 0x38, 0x54, 0xF0,
+    0x72, 0x78, 0x68, 0x42, 0x7B, 0x4E, 0x4D, 0x59, 0xB9, 0xE7, 0xD8, 0x2D, 0xB3, 0x9F, 0xFD, 0x7E,
+    0x6D, 0x44, 0xD4, 0x40, 0x6F, 0xAC, 0xBA, 0x15, 0x98, 0x19, 0xD4, 0x1D, 0xCF, 0xDA, 0x1C, 0x75,
+    0xCF, 0x33, 0x37, 0xA8, 0x7B, 0x01, 0x63, 0xA6, 0x19, 0xA3, 0x9B, 0xAC, 0xBC, 0x65, 0x16, 0xA6,
+    0x31, 0x84, 0xDF, 0xA0, 0xA8, 0x86, 0x44, 0xA4, 0x2B, 0x42, 0xF1, 0x72, 0x64, 0xBD, 0xB4, 0xEA,
+    0x66, 0x60, 0x56, 0xA2, 0xEE, 0x04, 0xD6, 0xCC, 0x2A, 0xCB, 0xEE, 0x75, 0xEC, 0x18, 0x9B, 0xEF,
+    0xFA, 0xE1, 0xD5, 0xBB, 0x40, 0x25, 0x1E, 0x0A, 0x9F, 0x3B, 0x32, 0xCF, 0x29, 0xED, 0x22, 0x74,
+    0x43, 0x61, 0x93, 0x17, 0xBF, 0x23, 0x22, 0x12, 0x4B, 0x11, 0x91, 0x56, 0x8D, 0xBF, 0xF7, 0xC2,
+    0x52, 0x2C, 0x4E, 0xE8, 0xBC, 0xA9, 0x77, 0x37, 0x89, 0x1E, 0xED, 0x41, 0x4B, 0x23, 0xD2, 0xA1,
+    0x44, 0xC4, 0x92, 0x8B, 0x74, 0x90, 0xEF, 0xC6, 0x19, 0x78, 0x01, 0x32, 0xB1, 0x94, 0x67, 0xFC,
+    0xF3, 0x17, 0x78, 0x29, 0x04, 0x4E, 0x37, 0x22, 0xF1, 0x1B, 0x22, 0xFF, 0x5F, 0xEA, 0x97, 0xD6,
+    0x69, 0x07, 0x88, 0xFD, 0x0A, 0x46, 0x7A, 0x0A, 0xE9, 0x49, 0x9B, 0x5D, 0xE5, 0x92, 0x8F, 0x40,
+    0x22, 0x52, 0x43, 0xD9, 0xE6, 0x35, 0x49, 0x4F, 0x5E, 0xF7, 0xBA, 0x46, 0xAB, 0x6E, 0x9B, 0x03,
+    0x9B, 0x5A, 0x44, 0x24, 0xE6, 0x22, 0x22, 0x01, 0xF3, 0xFE, 0xEB, 0x96, 0xA4, 0xDF, 0xEB, 0xA8,
+    0x6E, 0x01, 0x4C, 0x0B, 0x50, 0xDD, 0xE7, 0x6B, 0x4C, 0x3D, 0x45, 0x44, 0x5A, 0x68, 0x44, 0x2C,
+    0x94, 0x72, 0x69, 0x25, 0xB2, 0xA7, 0xBD, 0xCB, 0x3E, 0xA8, 0xE2, 0x05, 0xC8, 0xA4, 0xA6, 0x38,
+    0xE3, 0x9F, 0x5F, 0xE7, 0xC9, 0x70, 0x95, 0x59, 0x23, 0x12, 0xBF, 0x2E, 0xF2, 0x1F, 0x92, 0x55,
+    0xE7, 0x7B, 0x40, 0xEC, 0x57, 0xA9, 0x24, 0x52, 0x48, 0x24, 0x95, 0x16, 0xBE, 0xC5, 0xF4, 0x01,
+    0x8A, 0x5B, 0x21, 0x1A, 0xBD, 0x9B, 0x3C, 0x77, 0xA7, 0x1B, 0xCC, 0x6B, 0x3F, 0xBE, 0x2F, 0xD5,
+    0xDD, 0x00, 0x4B, 0xFB, 0xE0, 0x2A, 0x57, 0x81, 0xC4, 0x67, 0x0E, 0x50, 0x32, 0x00, 0x2C, 0xF1,
+    0x5C, 0x5E, 0xE0, 0x8B, 0xAF, 0xAC, 0x53, 0x5D, 0x1A, 0xC9, 0x83, 0x6E, 0x0B, 0x87, 0xF6, 0xC6,
+    0x8E, 0x50, 0xB8, 0x21, 0x0F, 0x60, 0x2E, 0x76, 0xC6, 0x82, 0x79, 0xEE, 0x4E, 0x04, 0x1A, 0xF3,
+    0x5D, 0x07, 0x8C, 0xB2, 0x9C, 0xCB, 0x00, 0x28, 0x11, 0x0B, 0xA8, 0xC9, 0xFD, 0xD5, 0x53, 0x5B,
+    0x22, 0xED, 0x64, 0xB3, 0xB5, 0xAC, 0xE6, 0x48, 0x4F, 0x99, 0x7C, 0x30, 0x4A, 0x8B, 0x16, 0x73,
+    0x5F, 0x5A, 0x24, 0xC8, 0x3B, 0xD2, 0x6A, 0x79, 0x5A, 0x2E, 0x4A, 0xDB, 0xF4, 0x5A, 0x94, 0xB4,
+    0xF0, 0xA8, 0x05, 0x72, 0x72, 0xA0, 0x60, 0x1D, 0x28, 0xA5, 0x05, 0xCA, 0x11, 0xBE, 0x04, 0x53,
+    0x5C, 0xCE, 0x4F, 0xBD, 0xA1, 0x02, 0xE5, 0x99, 0xAE, 0xA8, 0x31, 0x99, 0x8B, 0xB0, 0x59, 0x3C,
+    0xDB, 0x42, 0xDC, 0xDE, 0x04, 0xC6, 0x4F, 0x03, 0xA4, 0x22, 0x76, 0xD5, 0xD7, 0x4C, 0x1C, 0x93,
+    0x67, 0xB4, 0xAC, 0x2E, 0x45, 0x2C, 0xA9, 0x88, 0x58, 0xCA, 0x4F, 0x07, 0xB1, 0xA9, 0xBC, 0xF8,
+    0xA7, 0x62, 0xCB, 0xBE, 0xB9, 0x23, 0x4F, 0xC9, 0x4D, 0x79, 0x7A, 0xF2, 0x8F, 0x0A, 0xB6, 0x59,
+    0x64, 0x21, 0xF5, 0xC6, 0xE6, 0x2F, 0xF7, 0xCC, 0xB5, 0xA3, 0xDF, 0x46, 0xDD, 0x0B, 0xE8, 0x2B,
+    0x30, 0xEF, 0x49, 0xC4, 0x91, 0xC9, 0x40, 0xF1, 0xB7, 0xC4, 0x6E, 0x53, 0xA5, 0x1D, 0x55, 0xDE,
+    0xB2, 0x30, 0x36, 0xE9, 0x22, 0xD9, 0xBD, 0x40, 0x51, 0xC3, 0x36, 0x64, 0x81, 0xA4, 0xA9, 0x29,
+    0x22, 0x54, 0x35, 0xC9, 0x25, 0x1E, 0x7F, 0x58, 0xBD, 0xD2, 0x9E, 0x9E, 0xA9, 0xD7, 0xEC, 0x5F,
+    0xF5, 0xD9, 0x3A, 0x95, 0xCD, 0x3E, 0xB1, 0xD7, 0x36, 0x73, 0x7B, 0xFD, 0x9A, 0x7A, 0xCB, 0x9E,
+    0x0C, 0x69, 0xCB, 0x8C, 0xA2, 0xCE, 0x02, 0xBF, 0x0E, 0x67, 0xCF, 0x3E, 0x4F, 0x21, 0x32, 0xBD,
+    0x84, 0xA2, 0x2E, 0x49, 0xFA, 0x34, 0x50, 0xD8, 0x92, 0xB4, 0x53, 0x81, 0xD2, 0x1A, 0xD2, 0xA0,
+    0x02, 0x25, 0xCB, 0x82, 0xC1, 0xA0, 0x1E, 0x28, 0x6C, 0x62, 0xC8, 0xBD, 0x92, 0x5B, 0x03, 0xA6,
+    0xAF, 0x6A, 0x25, 0x16, 0xF2, 0xC0, 0x84, 0xC8, 0xE8, 0x16, 0xD2, 0x49, 0xFD, 0xA5, 0x5B, 0x97,
+    0x91, 0xC8, 0x4C, 0xA3, 0x95, 0x53, 0x2E, 0x24, 0x7E, 0xC6, 0x05, 0xCD, 0x31, 0xE5, 0x72, 0x1B,
+    0xD2, 0x76, 0x46, 0xA7, 0x59, 0xA8, 0x38, 0x67, 0x04, 0x6D, 0xC9, 0x1C, 0xE9, 0xB4, 0xDE, 0x4A,
+    0x8B, 0x76, 0xA5, 0x45, 0x3B, 0xB3, 0x4A, 0xDA, 0xCF, 0x26, 0xF5, 0xFE, 0xC4, 0x4F, 0x89, 0x88,
+    0x7C, 0x2E, 0x79, 0x7F, 0xAB, 0x09, 0xC6, 0x51, 0xEC, 0x25, 0xBD, 0x71, 0x14, 0xB1, 0x72, 0x14,
+    0x11, 0xC8, 0xE2, 0x52, 0xE5, 0xAA, 0xC9, 0x4D, 0xE8, 0x21, 0x5B, 0x2E, 0xFB, 0xC7, 0xF9, 0x5A,
+    0x56, 0x27, 0x7E, 0x9D, 0x53, 0x99, 0x4B, 0x97, 0x59, 0x58, 0x50, 0xE6, 0x2E, 0x0D, 0x8D, 0x48,
+    0x2E, 0x12, 0x1A, 0x91, 0xBC, 0x55, 0x61, 0x81, 0xC9, 0x9D, 0x8A, 0x0B, 0x8C, 0x83, 0x08, 0xA5,
+    0xA3, 0xEC, 0x27, 0x3B, 0x88, 0xFF, 0x06, 0x23, 0x9A, 0x92, 0xCA, 0x51, 0x04, 0x96, 0xE6, 0x4C,
+    0xD6, 0xB3, 0xB4, 0x5B, 0xB3, 0xC0, 0xF2, 0xF5, 0x68, 0x0F, 0x14, 0xED, 0x71, 0xBE, 0x76, 0x8C,
+    0xEC, 0x55, 0x97, 0xFE, 0x71, 0xE0, 0xFA, 0x3A, 0x65, 0x41, 0xFE, 0x7D, 0x97, 0xFE, 0x34, 0xB0,
+    0x68, 0x44, 0x4A, 0x91, 0xEF, 0x8B, 0xFC, 0xB4, 0x23, 0x2E, 0x30, 0x25, 0xFA, 0xFB, 0x6E, 0xA9,
+    0x28, 0x74, 0x8D, 0x6A, 0x49, 0x03, 0x5C, 0x7F, 0x94, 0xE4, 0x7F, 0x9A, 0x74, 0xC2, 0x47, 0x01,
+    0x73, 0x0A, 0xF5, 0x53, 0x8F, 0x39, 0x86, 0xFA, 0xD0, 0x63, 0x34, 0x59, 0xE8, 0x92, 0x31, 0x13,
+    0xF1, 0xC5, 0xB8, 0x33, 0x69, 0xCD, 0xF9, 0x97, 0x65, 0x2D, 0xCC, 0x20, 0xAD, 0x41, 0xD9, 0x43,
+    0x4F, 0x26, 0x77, 0xEC, 0xD1, 0xD3, 0xC9, 0x9D, 0xFA, 0xE8, 0xE9, 0xF4, 0x4E, 0xBB, 0x5D, 0x48,
+    0x5B, 0xFD, 0x2F, 0xA4, 0x2D, 0x23, 0xDA, 0xE3, 0x39, 0xB2, 0x2B, 0x14, 0xD5, 0x00, 0xA5, 0x47,
+    0x1C, 0xBA, 0xA7, 0x0A, 0x64, 0x23, 0xC5, 0x88, 0x12, 0x97, 0x89, 0x43, 0x42, 0x22, 0x1D, 0x4D,
+    0x64, 0x53, 0x30, 0x0D, 0x65, 0xD5, 0x16, 0x77, 0x5D, 0xFE, 0xC3, 0x5E, 0x7F, 0x14, 0xD2, 0x5E,
+    0xD4, 0xCF, 0x06, 0x76, 0xCA, 0xDB, 0xB1, 0xB2, 0xE5, 0xAB, 0x51, 0x8A, 0x56, 0x7B, 0x69, 0x9E,
+    0xED, 0x55, 0x2C, 0xE4, 0xE6, 0x88, 0x28, 0xF1, 0x4D, 0x6D, 0x5C, 0xD3, 0x95, 0x41, 0x07, 0x1D,
+    0x75, 0x54, 0x51, 0x8D, 0x4A, 0x10, 0x2A, 0xC4, 0x19, 0x07, 0x26, 0xE8, 0xB0, 0x34, 0xD0, 0x98,
+    0x26, 0x7B, 0x9A, 0xE8, 0xC9, 0xD7, 0x80, 0x06, 0x58, 0x61, 0xA2, 0x93, 0xE0, 0xCF, 0xC3, 0x64,
+    0x7E, 0xB4, 0x49, 0x54, 0x3D, 0x0D, 0x82, 0x71, 0xA6, 0x2D, 0xC2, 0xB1, 0xA8, 0x17, 0xD9, 0xDD,
+    0x67, 0xEE, 0x26, 0x1F, 0xBD, 0xF3, 0x51, 0xBB, 0xBE, 0xB8, 0xDF, 0x15, 0x45, 0xDC, 0xC8, 0x6F,
+    0x49, 0xF1, 0x4A, 0xA8, 0x9E, 0xF5, 0x0B, 0x7D, 0xB3, 0x2F, 0x53, 0xDF, 0xE4, 0x2D, 0xA5, 0x5B,
+    0x7A, 0x07, 0xCB, 0x28, 0x21, 0x99, 0x83, 0xD4, 0x3F, 0xAA, 0x2F, 0xFA, 0x7E, 0xAE, 0x2F, 0x86,
+    0x68, 0xF4, 0xCD, 0xB0, 0x28, 0xF3, 0x9B, 0x61, 0x51, 0xE6, 0x8E, 0xC7, 0x78, 0x0C, 0x8E, 0x72,
+    0x02, 0xF4, 0xEB, 0xD7, 0x57, 0x4B, 0x79, 0xE7, 0xCB, 0x44, 0xDF, 0xE6, 0x6E, 0xA7, 0xC5, 0x42,
+    0x22, 0x0E, 0xD4, 0x8F, 0x5B, 0xC8, 0xEE, 0x78, 0xC8, 0x6F, 0x06, 0xD0, 0x2F, 0x77, 0x50, 0xD8,
+    0x08, 0x86, 0x05, 0xCC, 0xD9, 0x84, 0x6D, 0x0C, 0x44, 0x4A, 0x9B, 0xF4, 0xE8, 0x5A, 0x89, 0x88,
+    0x53, 0x22, 0xE2, 0x73, 0x11, 0x09, 0xFA, 0xBD, 0xB3, 0xBF, 0xDC, 0x15, 0x6E, 0x82, 0x36, 0xD2,
+    0x68, 0x6A, 0x92, 0x41, 0xFD, 0xAE, 0xB2, 0xA7, 0x39, 0xAF, 0xDA, 0x02, 0x2D, 0x8E, 0xCA, 0xAF,
+    0x62, 0xFF, 0xCB, 0xEB, 0xE0, 0x70, 0x3E, 0x15, 0xB1, 0x3B, 0xBF, 0xDA, 0x69, 0x5B, 0xBC, 0xE2,
+    0xE9, 0x67, 0xE8, 0x5B, 0x8E, 0xC5, 0x94, 0xC5, 0x39, 0xD5, 0x2D, 0x91, 0xA1, 0x10, 0x69, 0x1B,
+    0xD9, 0x48, 0x9A, 0x8B, 0x1E, 0x43, 0x04, 0x93, 0x44, 0xA8, 0xCE, 0x44, 0xA8, 0x9E, 0x8A, 0xFF,
+    0x9D, 0x47, 0xE8, 0x0B, 0x5B, 0xA5, 0x7D, 0x1E, 0x8C, 0x13, 0xB5, 0xBF, 0x2F, 0x07, 0xEF, 0xFF,
+    0x79, 0x87, 0xB6, 0x7B, 0xC9, 0x2E, 0x70, 0xD1, 0x43, 0x26, 0xF2, 0xFE, 0x1B, 0x30, 0x81, 0x92,
+    0x14, 0x95, 0x03, 0x30, 0xD3, 0x4A, 0xDB, 0x28, 0x1D, 0x40, 0x2C, 0x1C, 0x90, 0x76, 0x5A, 0x04,
+    0x54, 0xD0, 0x22, 0x90, 0xB7, 0x5A, 0x04, 0xB4, 0xD3, 0x1E, 0x28, 0xAD, 0xF6, 0x80, 0x41, 0x07,
+    0x60, 0x44, 0x07, 0x48, 0x44, 0xA4, 0x9B, 0x9A, 0xB9, 0x7F, 0xF6, 0xF9, 0x4C, 0x44, 0x44, 0x7A,
+    0x1D, 0xD0, 0x22, 0xB1, 0x68, 0x27, 0x38, 0xDE, 0xA1, 0x45, 0xF6, 0x45, 0x22, 0x92, 0x37, 0xE0,
+    0xDC, 0x0F, 0xB5, 0xD4, 0xA9, 0xC8, 0xCE, 0x99, 0x90, 0xBF, 0xD7, 0x74, 0x3C, 0xA9, 0x6D, 0xE1,
+    0x99, 0x9D, 0x42, 0xFF, 0xC9, 0x95, 0x61, 0x86, 0x16, 0x19, 0x67, 0xE4, 0xEF, 0x3D, 0xCF, 0x0C,
+    0xED, 0x60, 0x86, 0xF6, 0x30, 0xA7, 0xEA, 0x26, 0x3C, 0xE8, 0xF5, 0xDF, 0x2E, 0x96, 0x66, 0xD3,
+    0xC7, 0x22, 0x31, 0x69, 0x2E, 0xBE, 0x23, 0x97, 0x72, 0xF2, 0xD4, 0xA9, 0x7A, 0xFE, 0xCB, 0x6D,
+    0x2E, 0x9E, 0x73, 0xF5, 0x5E, 0x83, 0x46, 0xE4, 0x35, 0x91, 0x7B, 0x2D, 0x74, 0xB0, 0xB6, 0x42,
+    0x97, 0x99, 0x42, 0x05, 0x93, 0x64, 0xDA, 0xF7, 0x37, 0x22, 0x4B, 0xAC, 0xEB, 0x35, 0x11, 0xAF,
+    0x7E, 0x57, 0xD9, 0x27, 0xA7, 0xB5, 0x57, 0x7C, 0xD1, 0xDA, 0x03, 0x28, 0x3D, 0x85, 0xB4, 0x59,
+    0x9B, 0xD3, 0x31, 0x3B, 0x86, 0xBA, 0xF9, 0x89, 0x8C, 0x46, 0xE4, 0xDE, 0x0F, 0xA6, 0xF8, 0xC8,
+    0x2A, 0xDE, 0xF0, 0xFA, 0x6F, 0xE7, 0x22, 0xAE, 0x90, 0xC8, 0x2F, 0x0E, 0xA4, 0x72, 0x29, 0x11,
+    0x69, 0x0B, 0x91, 0x33, 0xEF, 0x9D, 0x9B, 0x82, 0x43, 0xCC, 0x21, 0x0D, 0x3C, 0x7A, 0xCE, 0x88,
+    0xDC, 0x93, 0xF7, 0x37, 0x8E, 0xA2, 0x5C, 0xE0, 0x9A, 0xAA, 0x2B, 0x0A, 0xA9, 0xF9, 0xBA, 0xE5,
+    0xE0, 0xF4, 0xA5, 0x52, 0x24, 0x7D, 0xEF, 0x5C, 0x84, 0x62, 0xF7, 0x4B, 0x4C, 0x5F, 0x1A, 0xB7,
+    0x4F, 0xA1, 0x9C, 0xE7, 0x7A, 0x66, 0x4B, 0xCA, 0xC6, 0x71, 0xAE, 0x5D, 0xCD, 0x79, 0x9F, 0xB5,
+    0x45, 0xBD, 0x93, 0x46, 0xED, 0x1F, 0x08, 0x85, 0x3F, 0x30, 0x8E, 0xFB, 0x14, 0x32, 0x24, 0x22,
+    0xDD, 0xB1, 0x6F, 0x8B, 0x83, 0x61, 0xEA, 0x7C, 0x49, 0xF2, 0xED, 0x8F, 0x44, 0x46, 0x33, 0xFE,
+    0xEF, 0x6F, 0xB7, 0xCC, 0x34, 0xB9, 0x3D, 0x9D, 0x85, 0x44, 0x7A, 0x92, 0x37, 0xFE, 0x1C, 0x5D,
+    0xCA, 0x6D, 0x89, 0x34, 0x5E, 0x7F, 0x20, 0x49, 0xCC, 0x43, 0xD9, 0x36, 0x7B, 0x0D, 0x47, 0xE5,
+    0x01, 0x15, 0x0A, 0x07, 0x14, 0xAE, 0x01, 0x68, 0x9E, 0xFE, 0x92, 0x3D, 0x99, 0x0C, 0x0C, 0x34,
+    0xA4, 0x51, 0x75, 0x59, 0x40, 0xF5, 0xBA, 0x35, 0x35, 0x59, 0x30, 0x4F, 0x45, 0xD0, 0x7E, 0xD0,
+    0x2D, 0xE8, 0x3B, 0x9D, 0x00, 0xE5, 0x5B, 0x3F, 0x0E, 0x80, 0x69, 0xA4, 0x06, 0xAA, 0x55, 0xB0,
+    0xAC, 0x9D, 0xB2, 0x09, 0xC6, 0xEA, 0xA7, 0xF5, 0xD1, 0x4D, 0x06, 0x65, 0x37, 0x2D, 0x96, 0xE5,
+    0x82, 0xEE, 0xC0, 0x7C, 0x2A, 0x4D, 0x87, 0x92, 0xB7, 0xC6, 0xAA, 0xC3, 0x44, 0xD3, 0x37, 0x9D,
+    0x92, 0x56, 0xBC, 0x74, 0xE5, 0xA8, 0xC4, 0xED, 0x86, 0xE9, 0xB5, 0x9B, 0xB3, 0x94, 0x28, 0x49,
+    0xCC, 0x03, 0xE4, 0x9D, 0x71, 0x5F, 0x66, 0x2F, 0x66, 0xBE, 0xB0, 0xDB, 0x68, 0xB7, 0x91, 0x79,
+    0xF4, 0x8D, 0x60, 0xA0, 0x7C, 0xE6, 0x66, 0x07, 0xA6, 0x7C, 0xCE, 0xC1, 0xE6, 0xF6, 0xE4, 0xB0,
+    0xFB, 0x55, 0x2F, 0xA7, 0x88, 0xE2, 0x84, 0x49, 0x57, 0xD2, 0x42, 0x26, 0xD2, 0x42, 0x25, 0xD2,
+    0x92, 0x8D, 0xD2, 0xB4, 0x54, 0x3F, 0x1C, 0x9A, 0x36, 0x1B, 0xCB, 0x4E, 0xDA, 0x26, 0x34, 0xAD,
+    0xB4, 0x85, 0x5D, 0xE4, 0xDE, 0x3C, 0xDD, 0xEB, 0x56, 0x26, 0x05, 0x33, 0x5D, 0xDF, 0x18, 0x6D,
+    0x21, 0xF1, 0xE0, 0x0B, 0xE7, 0x26, 0xBC, 0x66, 0x5A, 0xEF, 0x59, 0x4B, 0x16, 0x72, 0xF1, 0xA9,
+    0xF4, 0x50, 0x38, 0xE8, 0xA1, 0x84, 0xFC, 0xFF, 0x22, 0xFB, 0xE8, 0xBD, 0x5F, 0xED, 0x45, 0xA2,
+    0x91, 0x98, 0x4E, 0xDE, 0x50, 0x49, 0x34, 0x36, 0x9A, 0x33, 0x43, 0xF5, 0xCA, 0xDE, 0x7E, 0x2E,
+    0x7B, 0x1E, 0xC9, 0x41, 0x59, 0x94, 0x25, 0x27, 0xEB, 0x49, 0xFE, 0x01, 0xE4, 0x16, 0x55, 0x93,
+    0xD5, 0x7F, 0xBD, 0xB1, 0x95, 0x70, 0xAE, 0xA3, 0x91, 0xD0, 0x48, 0x07, 0x1D, 0x2A, 0xA0, 0xDD,
+    0x24, 0x22, 0xD5, 0x7D, 0x94, 0x38, 0xB2, 0x00, 0x3D, 0x2C, 0x20, 0x3E, 0x44, 0x2C, 0xFE, 0x45,
+    0xAC, 0xA4, 0x2F, 0x24, 0xA4, 0x52, 0xC3, 0x7F, 0xFE, 0x17, 0x27, 0xF7, 0x4B, 0x04, 0x2A, 0xF9,
+    0xBD, 0xCF, 0xBC, 0x03, 0x15, 0x26, 0xAF, 0xBE, 0xF0, 0x06, 0xA4, 0x8E, 0x64, 0xA2, 0x02, 0x26,
+    0xEA, 0x36, 0x91, 0x60, 0x6C, 0x2E, 0x6E, 0xC0, 0x54, 0xAA, 0x4F, 0xFB, 0xA8, 0xBD, 0xBE, 0x13,
+    0xCA, 0xBA, 0x29, 0xDA, 0x46, 0x75, 0xD5, 0x53, 0xB1, 0xBC, 0x31, 0xE4, 0x61, 0xC8, 0xFA, 0xE2,
+    0xFB, 0xA1, 0xF0, 0x95, 0xB1, 0xD5, 0xCB, 0x63, 0x4C, 0x24, 0x93, 0x36, 0x8B, 0x85, 0x50, 0x04,
+    0xD3, 0x53, 0x39, 0x71, 0xC9, 0xB4, 0xCB, 0x9E, 0x90, 0x5E, 0x8B, 0xEC, 0x13, 0x46, 0x33, 0xF4,
+    0x1D, 0x97, 0x0C, 0x33, 0xE6, 0x77, 0x5C, 0xFE, 0xBF, 0xCD, 0x92, 0x9F, 0xDE, 0x71, 0x6B, 0x27,
+    0xD7, 0xF2, 0x9B, 0xF7, 0xDA, 0x70, 0x6A, 0x6D, 0xAE, 0xEE, 0xFD, 0xD0, 0xCD, 0xD7, 0x3A, 0x75,
+    0x4F, 0x98, 0x1B, 0xA7, 0xEE, 0xF5, 0xCC, 0x55, 0xD0, 0x35, 0x85, 0xDB, 0x84, 0x2A, 0x8D, 0xA4,
+    0x51, 0x87, 0xFF, 0x0E, 0x2C, 0xAC, 0xDC, 0x19, 0x06, 0x15, 0xB4, 0x37, 0x76, 0xCC, 0xBA, 0xFF,
+    0x22, 0xC2, 0xC6, 0xD2, 0xA2, 0x8D, 0x60, 0x6C, 0x04, 0x53, 0x0F, 0x60, 0x5E, 0x1E, 0x1F, 0xD0,
+    0xE8, 0xF2, 0x2E, 0x54, 0x22, 0xA4, 0xF2, 0xBA, 0xB4, 0x59, 0xA4, 0x08, 0x3A, 0x90, 0xF5, 0xC5,
+    0x52, 0x63, 0x32, 0x18, 0xA6, 0xA0, 0x3F, 0x9B, 0x06, 0xA8, 0x36, 0x01, 0x63, 0x80, 0xF9, 0x54,
+    0x67, 0x61, 0x34, 0x2D, 0xE9, 0x50, 0x8C, 0x67, 0xCF, 0x45, 0x2D, 0x22, 0x7D, 0x26, 0x13, 0x17,
+    0x40, 0xDA, 0xC9, 0x6D, 0x3E, 0xB8, 0xE7, 0xE0, 0xC3, 0x46, 0x1A, 0x72, 0x6F, 0xEC, 0xA8, 0x7A,
+    0x1D, 0xAA, 0x7D, 0x2F, 0x8B, 0x73, 0x9E, 0xF2, 0x83, 0x36, 0x77, 0x65, 0x12, 0x58, 0x9C, 0x42,
+    0xDD, 0x6A, 0x59, 0x5B, 0x43, 0xDD, 0x69, 0x59, 0x9B, 0xA3, 0x6E, 0xF7, 0x44, 0x2D, 0xE2, 0x1A,
+    0x09, 0xA9, 0x0C, 0x1C, 0x1C, 0x21, 0x9F, 0x10, 0x04, 0x9B, 0x8A, 0x8C, 0x34, 0x75, 0xDE, 0xE9,
+    0x96, 0xF2, 0x46, 0x0F, 0x43, 0x69, 0x57, 0x5C, 0x05, 0x11, 0xF9, 0x48, 0x64, 0x4B, 0x8C, 0x25,
+    0xBB, 0xD7, 0xC3, 0x4E, 0xE9, 0xD0, 0x6F, 0x8B, 0xCD, 0xF6, 0x48, 0x0B, 0x89, 0xC8, 0x40, 0x26,
+    0x02, 0x07, 0xFF, 0xC0, 0x4E, 0xDD, 0x10, 0xAF, 0xDF, 0x3D, 0x77, 0x26, 0xB0, 0x3E, 0x47, 0xDD,
+    0x69, 0x99, 0x1B, 0x91, 0x8F, 0xDE, 0x3B, 0x5B, 0xCD, 0x51, 0xF7, 0x3A, 0xB6, 0x8B, 0x51, 0x9C,
+    0x48, 0x97, 0xCA, 0x40, 0xB6, 0x9C, 0xCB, 0xDC, 0x19, 0x18, 0x54, 0x40, 0xB7, 0x95, 0x4D, 0xC6,
+    0xBC, 0xE3, 0xCF, 0xBA, 0x9A, 0x0E, 0x1A, 0xE9, 0x28, 0x45, 0x7C, 0xDE, 0xD3, 0xD8, 0x81, 0x34,
+    0x16, 0x35, 0xFA, 0x76, 0xB7, 0xE2, 0x57, 0x88, 0x88, 0x18, 0xF9, 0xE4, 0xCA, 0x47, 0x1D, 0x6C,
+    0x9A, 0x9A, 0xFC, 0x9D, 0x08, 0x43, 0xD1, 0x51, 0xB9, 0xD5, 0x0C, 0x53, 0x88, 0xB4, 0x54, 0x12,
+    0xE0, 0xB7, 0xDE, 0x60, 0xB5, 0x6A, 0xDA, 0xEA, 0x8B, 0x9B, 0x3F, 0x38, 0x92, 0xCA, 0xC8, 0xF8,
+    0xB7, 0xBA, 0x82, 0x6C, 0xC5, 0xC0, 0x10, 0x91, 0xF9, 0xD9, 0x5F, 0xFE, 0x33, 0x18, 0x18, 0x31,
+    0xF3, 0x14, 0x6E, 0x87, 0x34, 0xE6, 0x81, 0x2F, 0xD0, 0x66, 0xF9, 0x68, 0xC9, 0x45, 0x48, 0xFB,
+    0x64, 0x60, 0x1B, 0x15, 0x74, 0x8D, 0xAE, 0x9F, 0x9F, 0x80, 0xB6, 0xAC, 0xE5, 0x37, 0xB7, 0xB6,
+    0xC9, 0x45, 0xFC, 0x32, 0x2E, 0xAE, 0xFC, 0xD2, 0xD0, 0xD3, 0x77, 0x06, 0xB2, 0xA1, 0x94, 0x2B,
+    0x72, 0x43, 0x44, 0x7A, 0x2D, 0x22, 0x2B, 0x14, 0xFF, 0xD2, 0x9E, 0xDC, 0xD0, 0xB5, 0x49, 0x62,
+    0x16, 0x4A, 0xB7, 0x4F, 0x43, 0x1D, 0xB0, 0x14, 0xE2, 0xD5, 0xA5, 0xC2, 0x3D, 0x42, 0x39, 0x21,
+    0x2A, 0xB9, 0x53, 0x12, 0x79, 0xE2, 0xCA, 0xE4, 0xD1, 0x15, 0x17, 0x6D, 0x16, 0xCC, 0x07, 0x83,
+    0x12, 0xB1, 0x07, 0xC7, 0x69, 0x81, 0x3D, 0x7C, 0x45, 0x56, 0x4A, 0x69, 0xA5, 0xDA, 0x2C, 0x07,
+    0x74, 0xCD, 0xA2, 0x40, 0x79, 0x43, 0x61, 0x37, 0x58, 0x10, 0x55, 0x48, 0x7A, 0x5D, 0xAB, 0xB0,
+    0x41, 0x76, 0x2F, 0x4C, 0x34, 0xA5, 0x11, 0x4C, 0x37, 0x45, 0x40, 0xF7, 0xD3, 0x94, 0xA0, 0xE8,
+    0x29, 0xC5, 0xD1, 0x44, 0x52, 0xD9, 0x33, 0xDA, 0x73, 0x11, 0x1A, 0xF9, 0x3F, 0xBE, 0xE0, 0x9D,
+    0xAF, 0x91, 0x84, 0x75, 0x72, 0xD7, 0x33, 0x4F, 0xBA, 0xA4, 0x53, 0x21, 0x77, 0x59, 0x6B, 0xD0,
+    0x37, 0x7A, 0x8A, 0xEF, 0xB4, 0x98, 0x0A, 0xAA, 0x09, 0x16, 0x4E, 0xC4, 0x4E, 0x0D, 0x05, 0x30,
+    0x35, 0xE9, 0x00, 0x55, 0xA0, 0x12, 0x12, 0x09, 0x64, 0x4B, 0x65, 0xA0, 0x7C, 0x61, 0x8B, 0x7A,
+    0x87, 0x46, 0xF5, 0xEA, 0x41, 0x31, 0xF5, 0x30, 0xFC, 0xFD, 0x39, 0x69, 0xD8, 0x40, 0xD7, 0x91,
+    0x8D, 0xA4, 0x4B, 0x83, 0x0A, 0xDA, 0x65, 0x7E, 0x8E, 0xBE, 0xD9, 0x51, 0xBC, 0xE6, 0xA6, 0xC6,
+    0x7A, 0x90, 0x96, 0x64, 0x35, 0xAA, 0x65, 0x63, 0x11, 0x2A, 0x4F, 0x23, 0xA4, 0x12, 0xC8, 0x87,
+    0xFD, 0xC8, 0xCB, 0x36, 0x3B, 0x69, 0xA7, 0xA2, 0xF6, 0x3A, 0x7C, 0x91, 0xC2, 0x55, 0x2D, 0x45,
+    0xE6, 0x58, 0xE8, 0x5A, 0xF9, 0xC2, 0x16, 0xD6, 0xB0, 0x60, 0x43, 0x05, 0x62, 0x51, 0x27, 0xFD,
+    0x36, 0xEA, 0xE3, 0x40, 0x26, 0x0E, 0x3D, 0x42, 0xD1, 0x4D, 0xAE, 0x97, 0x4C, 0x34, 0x91, 0xB2,
+    0x25, 0x13, 0x32, 0x09, 0x14, 0x32, 0x31, 0xC2, 0x26, 0xB9, 0x45, 0x32, 0xC1, 0x1B, 0x15, 0x2A,
+    0x1C, 0xBC, 0xFC, 0x00, 0x79, 0x6D, 0x4F, 0x20, 0xD7, 0x2C, 0x28, 0x50, 0x9E, 0x39, 0xDA, 0xB2,
+    0xC1, 0x02, 0xA2, 0x0A, 0x24, 0x9D, 0xAE, 0x51, 0x61, 0x63, 0x49, 0x5A, 0xD2, 0x77, 0xDD, 0x12,
+    0x5D, 0x32, 0x3D, 0xD3, 0xEB, 0x44, 0x56, 0x1E, 0xB8, 0xF6, 0x4B, 0xCF, 0xA3, 0x88, 0x50, 0x8A,
+    0x83, 0x26, 0xB2, 0xFF, 0xB5, 0xFE, 0x05, 0xB8, 0x9C, 0x74, 0x14, 0x75, 0x69, 0xD3, 0x4E, 0x85,
+    0x29, 0xC2, 0xF3, 0xE5, 0x57, 0x47, 0xE6, 0x92, 0x40, 0x89, 0xF2, 0xF4, 0x64, 0x6D, 0xD6, 0xA2,
+    0x5D, 0xB9, 0x72, 0x5D, 0x32, 0x0F, 0x9B, 0xA5, 0x85, 0x21, 0x32, 0x45, 0xEF, 0x95, 0xD4, 0x4C,
+    0x2F, 0x76, 0xE2, 0x1D, 0xB9, 0x65, 0xC8, 0x2B, 0xEF, 0x26, 0x3F, 0x28, 0x91, 0xB8, 0x84, 0xB2,
+    0x8A, 0xDD, 0x8D, 0xFD, 0x65, 0xDB, 0x3D, 0xA9, 0x39, 0x3E, 0x43, 0xDD, 0x72, 0xCC, 0x1E, 0xC8,
+    0xD6, 0xD7, 0xC8, 0xEE, 0xB4, 0x6C, 0xCF, 0xD1, 0xB7, 0xFB, 0x6C, 0xD0, 0x22, 0x6D, 0x23, 0xDB,
+    0x49, 0xF3, 0x6A, 0x0B, 0x1B, 0x13, 0x41, 0x70, 0x1B, 0x72, 0x3F, 0x85, 0xDF, 0xBE, 0xD0, 0xF8,
+    0x00, 0x72, 0x4E, 0x3F, 0x78, 0x5F, 0xC8, 0x5E, 0x8E, 0x4A, 0x22, 0x3B, 0x33, 0xD8, 0xBD, 0x49,
+    0x27, 0x34, 0xF8, 0xCF, 0x4F, 0x53, 0x8A, 0x13, 0xCF, 0x20, 0x07, 0xAE, 0x4E, 0x19, 0xF0, 0xE8,
+    0xD9, 0x17, 0xE5, 0x63, 0x9B, 0xB4, 0x5C, 0xE0, 0x18, 0x59, 0x9D, 0xFA, 0xBD, 0xB8, 0xF2, 0x0E,
+    0x89, 0xE3, 0x3C, 0xFB, 0x25, 0x06, 0x68, 0x57, 0x31, 0x29, 0x70, 0xD2, 0xE1, 0x73, 0x1A, 0xFC,
+    0xC1, 0xEB, 0x89, 0x57, 0x6B, 0xA0, 0x39, 0x06, 0xA4, 0x71, 0x1D, 0xC8, 0x3F, 0x0C, 0x40, 0xF1,
+    0xA6, 0x03, 0xAA, 0x02, 0x48, 0xE2, 0x3A, 0x90, 0x7D, 0x28, 0x23, 0x14, 0x6F, 0xBE, 0xDF, 0x58,
+    0xAA, 0x82, 0x82, 0x24, 0xAE, 0x73, 0x8C, 0xEC, 0xC3, 0xC0, 0x8C, 0xE2, 0x4D, 0x47, 0xA0, 0x2A,
+    0xC8, 0x5D, 0x1A, 0xD7, 0x0F, 0x08, 0xF9, 0xCF, 0x44, 0x3A, 0xCA, 0x1F, 0x8A, 0xD4, 0xC8, 0x39,
+    0xF1, 0x2B, 0x7C, 0x69, 0xBF, 0x96, 0xE0, 0x8B, 0xC5, 0x74, 0x7A, 0x09, 0x8E, 0x1B, 0x50, 0xB7,
+    0x02, 0xCC, 0xF6, 0x0A, 0x2F, 0xA0, 0x6E, 0x8A, 0xD8, 0x59, 0xC9, 0x29, 0x75, 0x33, 0x70, 0x75,
+    0x56, 0x92, 0x3F, 0x7D, 0x23, 0xD0, 0xAD, 0x15, 0x67, 0x1B, 0xF5, 0xB6, 0x48, 0xBB, 0x51, 0x88,
+    0xCF, 0xDA, 0x5D, 0x33, 0x85, 0x1E, 0xE5, 0x51, 0x81, 0xB4, 0x23, 0x6F, 0x21, 0x52, 0x38, 0xD8,
+    0xC4, 0x00, 0xA5, 0xDD, 0x01, 0xF4, 0x8D, 0x08, 0x64, 0x1F, 0x75, 0x7B, 0x24, 0xB6, 0xC9, 0x67,
+    0x15, 0x0B, 0x24, 0x52, 0x03, 0x6A, 0x09, 0xF2, 0x06, 0xA0, 0xBC, 0x17, 0x81, 0xEA, 0xE6, 0x00,
+    0x88, 0x15, 0x48, 0x85, 0xCA, 0x91, 0x45, 0x4C, 0xF7, 0x88, 0xEE, 0xD1, 0xD2, 0x99, 0x40, 0x2E,
+    0x71, 0x17, 0x96, 0x4E, 0x56, 0xD0, 0xFC, 0x71, 0x0E, 0xDA, 0xCC, 0x29, 0xC7, 0xF5, 0xB4, 0x45,
+    0x27, 0x81, 0x24, 0x04, 0x98, 0xF7, 0xCB, 0x0D, 0xB8, 0xBD, 0x0C, 0x13, 0x94, 0x1D, 0x14, 0x15,
+    0xE8, 0x5B, 0x01, 0xED, 0x76, 0xC8, 0xBD, 0x96, 0x2C, 0x24, 0x12, 0x58, 0x51, 0xD1, 0x9F, 0xD8,
+    0xDA, 0xD2, 0x22, 0xB7, 0x44, 0xC2, 0x03, 0xA5, 0xAD, 0x7F, 0x2E, 0x93, 0x1F, 0x29, 0xFE, 0xC0,
+    0xD9, 0xB3, 0x67, 0x9F, 0x47, 0x89, 0xC8, 0xE4, 0x73, 0x8A, 0xC8, 0x9E, 0xB0, 0x7A, 0x89, 0x3F,
+    0x6E, 0xD5, 0xAB, 0xF6, 0xC8, 0x51, 0x5E, 0xBA, 0x9A, 0xDC, 0x76, 0xD9, 0xB3, 0x1C, 0x3D, 0xF1,
+    0x40, 0x31, 0xA4, 0xB7, 0x5C, 0xAE, 0x39, 0x31, 0xE3, 0xEA, 0xBE, 0xA2, 0x57, 0xEE, 0x89, 0xAD,
+    0xAD, 0xAD, 0x37, 0x44, 0x44, 0xEE, 0x89, 0xEC, 0xB7, 0x31, 0xB7, 0x96, 0x8D, 0xCB, 0x6B, 0x22,
+    0x32, 0x1E, 0xF8, 0xA5, 0xB1, 0xBC, 0x1D, 0xCB, 0x5B, 0x7D, 0xF5, 0x6C, 0x68, 0x5E, 0xED, 0xCD,
+    0xAD, 0x58, 0xBA, 0x41, 0x87, 0xFD, 0xD5, 0xD5, 0xF7, 0x7B, 0x1D, 0x44, 0x45, 0xE3, 0x9A, 0x3C,
+    0x14, 0x6F, 0x47, 0xD5, 0x9B, 0x5A, 0x76, 0x57, 0x69, 0xE2, 0xE1, 0xD8, 0x5E, 0x16, 0xA0, 0x78,
+    0x20, 0xD3, 0x24, 0xD3, 0xDE, 0x6A, 0x77, 0x43, 0x3A, 0xFF, 0x19, 0x99, 0x02, 0xBE, 0xB9, 0x27,
+    0x42, 0x3F, 0x13, 0x62, 0xFE, 0xEC, 0x83, 0x48, 0xAC, 0x44, 0xEA, 0x2F, 0xFD, 0x67, 0xB9, 0x88,
+    0x12, 0x71, 0x0F, 0x3A, 0xFC, 0xD3, 0x43, 0x6E, 0xA1, 0x5D, 0x11, 0x38, 0x27, 0xFD, 0x38, 0x62,
+    0x24, 0x22, 0x12, 0x32, 0x11, 0x57, 0x8A, 0x20, 0x32, 0xA8, 0xC9, 0x04, 0xF0, 0x95, 0xC8, 0xCD,
+    0x89, 0x48, 0x13, 0x8D, 0xC8, 0xCF, 0x44, 0xE4, 0x87, 0xD3, 0x64, 0x5F, 0x56, 0x9D, 0x1E, 0x4C,
+    0x37, 0xAA, 0x1A, 0xD0, 0xB7, 0x3E, 0x8C, 0x8D, 0x5D, 0x66, 0x7F, 0x79, 0x3E, 0x5F, 0xFE, 0xF4,
+    0x93, 0x8F, 0x42, 0xF8, 0x66, 0x9D, 0xB4, 0x8F, 0xD7, 0xAA, 0xFE, 0x7B, 0x75, 0xCE, 0xB7, 0xDC,
+    0x11, 0xFE, 0x86, 0x9B, 0x51, 0xD8, 0x97, 0xA6, 0x61, 0xA7, 0xED, 0x32, 0xD4, 0x68, 0xA7, 0x13,
+    0x1E, 0x33, 0x26, 0x7A, 0x7D, 0xF8, 0x9B, 0xFF, 0x58, 0xBD, 0xF3, 0x3F, 0xBF, 0x91, 0xDD, 0x3C,
+    0xFC, 0x3F, 0xEA, 0x33, 0xFF, 0xF2, 0xFF, 0x2E, 0x09, 0xD7, 0xBF, 0x02, 0x14, 0x1F, 0x8E, 0xE5,
+    0xED, 0x68, 0x2E, 0x76, 0x0D, 0xC5, 0x87, 0x52, 0xBC, 0x33, 0x94, 0xB7, 0x63, 0x79, 0x33, 0x9A,
+    0x8B, 0xBD, 0x79, 0xA6, 0x6B, 0xF2, 0xB0, 0xD4, 0xB6, 0xA7, 0xD3, 0x7A, 0x9E, 0x76, 0xC5, 0x53,
+    0x41, 0xD7, 0x7D, 0xC1, 0xF5, 0xDC, 0x75, 0x99, 0x9B, 0x65, 0xF5, 0xF1, 0x74, 0xB9, 0x17, 0x13,
+    0xB7, 0x99, 0x06, 0x5D, 0xAF, 0xE1, 0x81, 0xC7, 0x32, 0x3B, 0xD7, 0xAE, 0x78, 0xBA, 0xCD, 0x6F,
+    0x04, 0xD5, 0x5E, 0xE7, 0xEA, 0x09, 0x00, 0xCE, 0x67, 0x1C, 0xCF, 0xBC, 0x49, 0xBB, 0xDC, 0x6D,
+    0xA8, 0xA0, 0xEB, 0x85, 0x6A, 0x35, 0x5D, 0xE6, 0x8E, 0x70, 0x35, 0xB3, 0x4B, 0x57, 0x26, 0xED,
+    0x39, 0x79, 0x41, 0xF9, 0x65, 0x04, 0xF3, 0x30, 0x1B, 0x49, 0x97, 0xBB, 0x12, 0x63, 0x75, 0xAB,
+    0x26, 0xFE, 0xF1, 0x2F, 0x3C, 0xC2, 0x93, 0xCC, 0xD1, 0x75, 0x1A, 0x58, 0x30, 0xA8, 0x5E, 0xFB,
+    0xD2, 0x1E, 0xE5, 0xA1, 0x07, 0xDC, 0x17, 0x54, 0x47, 0x64, 0xA4, 0x68, 0x0B, 0x67, 0x1C, 0xCD,
+    0x53, 0x43, 0x1E, 0x50, 0x91, 0x74, 0x3A, 0xAF, 0xD1, 0x58, 0x30, 0xAE, 0xF4, 0x90, 0x48, 0x16,
+    0x81, 0x7C, 0x10, 0x28, 0xAC, 0x91, 0x96, 0xB4, 0x47, 0xBA, 0xB4, 0x33, 0x75, 0x26, 0x98, 0xA7,
+    0x23, 0xD2, 0xA9, 0x1E, 0x8C, 0xB4, 0xA6, 0x46, 0x8B, 0x00, 0x4A, 0x9E, 0x8B, 0x80, 0xF8, 0x2A,
+    0x40, 0x19, 0x53, 0x71, 0xE4, 0x82, 0x16, 0x52, 0x71, 0x98, 0x9E, 0xA6, 0x2B, 0x11, 0x5F, 0x8C,
+    0x2A, 0x64, 0x52, 0x2F, 0x99, 0x12, 0xEC, 0x73, 0x9B, 0x93, 0x7A, 0x96, 0xB9, 0xF5, 0xCC, 0x2D,
+    0x72, 0xB7, 0xC8, 0x5D, 0xD4, 0xAB, 0xBB, 0xB8, 0x11, 0xB1, 0x98, 0x8B, 0x7D, 0xF5, 0xFD, 0x28,
+    0x8E, 0x64, 0x77, 0x35, 0x97, 0x23, 0x85, 0x0C, 0xCA, 0x4B, 0x78, 0x5C, 0x9F, 0xAB, 0x09, 0x91,
+    0x22, 0x77, 0x49, 0x58, 0x4C, 0x59, 0xA4, 0x2C, 0x6C, 0xFA, 0x71, 0xA0, 0x1C, 0x48, 0xA5, 0xA6,
+    0xF2, 0xE4, 0x3D, 0x34, 0x13, 0xCA, 0xBE, 0xCC, 0x76, 0x76, 0x49, 0xC6, 0x79, 0x00, 0x99, 0x94,
+    0xB0, 0x40, 0xD1, 0x91, 0x8A, 0xDD, 0x27, 0x71, 0xD6, 0xEC, 0xE9, 0xAB, 0xBC, 0xFD, 0xEE, 0x8B,
+    0x89, 0x04, 0xFE, 0xDE, 0xC4, 0xC9, 0xE5, 0x32, 0x64, 0x5F, 0xBD, 0x3C, 0x19, 0x14, 0x99, 0x87,
+    0xFC, 0x7B, 0x35, 0xE9, 0x57, 0x1F, 0x81, 0x2C, 0x81, 0x4B, 0xB4, 0x3C, 0xFE, 0x2B, 0x8F, 0xDF,
+    0xFE, 0xF7, 0x57, 0x9B, 0x36, 0x6F, 0xB3, 0x36, 0x1B, 0xF4, 0xF7, 0x9E, 0xF9, 0xF5, 0x3F, 0x39,
+    0x6E, 0x1F, 0xE6, 0xE1, 0x15, 0x2F, 0xE5, 0xC9, 0x69, 0x49, 0x1E, 0x9D, 0x46, 0x94, 0x4F, 0x61,
+    0xC5, 0xFD, 0x35, 0x16, 0xD6, 0xA7, 0x9A, 0x53, 0xCB, 0x51, 0xD7, 0x53, 0x4D, 0x3B, 0x51, 0xDA,
+    0x97, 0x35, 0x2B, 0xF5, 0x21, 0x9E, 0x73, 0x23, 0x85, 0x0C, 0xA9, 0x88, 0xDB, 0x3C, 0x23, 0xD9,
+    0xBB, 0x45, 0x78, 0x9C, 0xF2, 0xA2, 0x4D, 0xFB, 0xE9, 0xF5, 0xC7, 0x29, 0x1A, 0xBE, 0x97, 0x2D,
+    0x2B, 0x75, 0x0D, 0x3D, 0x14, 0x96, 0xB4, 0x03, 0x03, 0x99, 0x5F, 0x31, 0x38, 0xF2, 0x0E, 0x1A,
+    0x4B, 0xD5, 0x92, 0x0F, 0x9F, 0x9D, 0xBD, 0x2F, 0xCC, 0x7E, 0x1D, 0x1E, 0xFE, 0x9C, 0x89, 0xB4,
+    0x8C, 0x26, 0x54, 0xD3, 0x44, 0x35, 0x0F, 0x4C, 0xF7, 0x7E, 0xC4, 0x66, 0xB4, 0x13, 0x41, 0x48,
+    0xBF, 0xD7, 0xB8, 0xA3, 0xA7, 0x31, 0xB6, 0x03, 0xA3, 0x5A, 0x58, 0x68, 0x4B, 0x1A, 0xD6, 0x20,
+    0x77, 0xCB, 0xAA, 0xA4, 0x2F, 0x2C, 0xDA, 0x6D, 0xC0, 0x4E, 0xD2, 0x91, 0x87, 0xBC, 0x4D, 0x85,
+    0xD2, 0x96, 0x81, 0x6D, 0x1A, 0xD2, 0x2E, 0x8D, 0xE8, 0x36, 0x0F, 0x18, 0x5B, 0xBA, 0x09, 0xC9,
+    0xEA, 0xF6, 0x38, 0x56, 0x90, 0x46, 0xE6, 0xE8, 0x90, 0x44, 0x8C, 0xCB, 0x43, 0x22, 0xD6, 0xB8,
+    0x95, 0x79, 0x9D, 0xCA, 0xA5, 0x29, 0xDE, 0x9D, 0xFD, 0xEC, 0x5C, 0xE0, 0xEF, 0xA0, 0x5B, 0x0D,
+    0xDA, 0xAD, 0x83, 0x49, 0x02, 0xC4, 0xCC, 0xA1, 0x42, 0x01, 0xBA, 0x5E, 0xC0, 0x46, 0x1A, 0x50,
+    0x21, 0x77, 0x18, 0x6B, 0xC8, 0x7A, 0x62, 0x22, 0xB5, 0x0A, 0x79, 0x8F, 0x76, 0xA5, 0xC3, 0xD0,
+    0x40, 0x4C, 0x23, 0x2A, 0xE4, 0x81, 0xC2, 0x95, 0x35, 0x15, 0xC0, 0xDF, 0xDF, 0x85, 0x4C, 0xEB,
+    0xA2, 0x66, 0x64, 0x93, 0x2C, 0xA6, 0x91, 0x32, 0xE8, 0x80, 0xEC, 0xB7, 0xAF, 0xBF, 0x39, 0x9D,
+    0x5F, 0x38, 0xB9, 0xC7, 0x95, 0x38, 0x35, 0x85, 0xC1, 0x95, 0x83, 0x63, 0x68, 0x77, 0x0D, 0xA3,
+    0x5C, 0x12, 0x0B, 0xF2, 0xEE, 0xFA, 0xB4, 0x30, 0xF4, 0x44, 0x75, 0x50, 0x7E, 0x2A, 0xAE, 0x4F,
+    0x94, 0x02, 0x3D, 0xAD, 0xA5, 0x34, 0x80, 0x7E, 0xB5, 0x65, 0xAD, 0xAC, 0xD3, 0x30, 0xA2, 0x6F,
+    0x45, 0xD6, 0x26, 0xED, 0x92, 0x3B, 0x98, 0x43, 0xD2, 0xED, 0xF1, 0xBC, 0xFB, 0xC9, 0x36, 0x9C,
+    0x03, 0x2D, 0x93, 0x28, 0x49, 0xEC, 0x37, 0x5F, 0x39, 0xF3, 0xB7, 0x0F, 0xFE, 0x95, 0x7F, 0xFA,
+    0x87, 0xFF, 0xF0, 0xA9, 0xB7, 0x7E, 0xAD, 0xE8, 0x4A, 0x0B, 0xB4, 0xA9, 0xCF, 0x2E, 0x1F, 0xFE,
+    0xBB, 0x27, 0xAE, 0x9A, 0xC8, 0x55, 0xAE, 0x72, 0xB5, 0xF9, 0xF7, 0x5C, 0x3A, 0x8C, 0xD4, 0x47,
+    0xB8, 0xA6, 0xE5, 0x47, 0x9D, 0xEA, 0x0F, 0xF1, 0x38, 0x7F, 0xC3, 0xCF, 0x4E, 0x9C, 0x3E, 0x74,
+    0xE2, 0x84, 0xEE, 0x92, 0x4B, 0x12, 0x12, 0x97, 0x73, 0x1A, 0x9F, 0xD9, 0x93, 0x04, 0xE5, 0x1E,
+    0x26, 0xB9, 0x74, 0xE8, 0xF1, 0xE3, 0x8F, 0x1D, 0x3D, 0x9E, 0xF9, 0xA3, 0xA7, 0x4F, 0x3F, 0x76,
+    0xFA, 0xF0, 0xDA, 0x7A, 0x1E, 0x72, 0x7F, 0xFC, 0xF8, 0xB7, 0x1E, 0x7B, 0xF2, 0xD0, 0xC9, 0xDF,
+    0xC9, 0x07, 0x0E, 0x7D, 0x7D, 0x51, 0xF8, 0x23, 0x85, 0x4F, 0x44, 0xDA, 0xA2, 0xAB, 0x92, 0x48,
+    0x5F, 0xDA, 0xFC, 0x95, 0xC0, 0xA2, 0x24, 0xBF, 0x19, 0x58, 0x18, 0xAB, 0x6F, 0x75, 0x44, 0x63,
+    0xF5, 0x9D, 0x8E, 0x61, 0x99, 0x1D, 0x7C, 0x23, 0x4B, 0x2F, 0xD6, 0xDF, 0x6A, 0x8F, 0x9C, 0xBF,
+    0xF3, 0x6F, 0x9E, 0xFC, 0x3F, 0x0F, 0xCF, 0xDF, 0xD6, 0x17, 0xB2, 0xEF, 0x3E, 0x73, 0x4F, 0x42,
+    0xD5, 0x1F, 0xEC, 0x79, 0x28, 0x6B, 0x0F, 0xB3, 0xBC, 0x9B, 0xBB, 0x03, 0xC9, 0xF8, 0x0B, 0x47,
+    0x78, 0x8C, 0xAB, 0x99, 0xBD, 0xAE, 0xEB, 0xE6, 0x23, 0x71, 0x85, 0xE7, 0xAB, 0x7C, 0x35, 0xF3,
+    0x3C, 0xCE, 0x63, 0x9C, 0x28, 0xFB, 0xD2, 0xF3, 0x08, 0x3E, 0xF5, 0xD9, 0xF9, 0xC3, 0xE7, 0x4F,
+    0x9C, 0x37, 0x03, 0x57, 0xB9, 0xCA, 0x35, 0x68, 0x6E, 0x71, 0x08, 0xD3, 0x26, 0x4E, 0xFD, 0xA3,
+    0xA3, 0x26, 0xFC, 0x3E, 0x69, 0x7F, 0x78, 0x77, 0xC4, 0xC7, 0x0F, 0x15, 0x8B, 0xCC, 0xA3, 0xC4,
+    0x65, 0x1C, 0xC7, 0x2B, 0x7B, 0x94, 0xAB, 0xCA, 0x15, 0x7C, 0x85, 0xE4, 0xD2, 0xA1, 0xE3, 0x5F,
+    0x3D, 0x74, 0xF8, 0x78, 0x16, 0x8E, 0x1E, 0x3F, 0x7D, 0xE8, 0xF4, 0xE1, 0x93, 0xBF, 0x9D, 0x77,
+    0xBB, 0x63, 0x3E, 0xB9, 0x1A, 0x33, 0x27, 0x99, 0x71, 0x8D, 0x90, 0x7A, 0xE5, 0xF2, 0x5A, 0x5B,
+    0xCD, 0x29, 0xE6, 0xAC, 0x31, 0x63, 0xFD, 0x81, 0x3F, 0x33, 0xD6, 0x98, 0x53, 0x52, 0xA0, 0xAD,
+    0x76, 0xB9, 0xCB, 0x5A, 0x15, 0xD2, 0x8E, 0xC8, 0x36, 0x8F, 0xBE, 0xC4, 0x8C, 0x53, 0x68, 0xF2,
+    0x5A, 0x39, 0xD5, 0x26, 0x81, 0x40, 0xC7, 0xF5, 0xDD, 0xAF, 0x4D, 0x7F, 0x66, 0xCC, 0x58, 0x67,
+    0xC1, 0x75, 0x7A, 0xBA, 0x34, 0x28, 0xAF, 0xDA, 0xDC, 0x69, 0x57, 0x58, 0xC3, 0x26, 0x2F, 0x00,
+    0x27, 0x73, 0x8B, 0x56, 0x8E, 0xEC, 0x46, 0x20, 0xF5, 0xD7, 0xA1, 0x5B, 0x03, 0x23, 0x35, 0x95,
+    0x04, 0x1A, 0x89, 0x48, 0xDB, 0x21, 0x61, 0x46, 0xB5, 0x28, 0x30, 0xBF, 0x93, 0xDB, 0xE2, 0x2D,
+    0xE5, 0xF2, 0x1F, 0xDF, 0x08, 0xEA, 0x4F, 0xFD, 0x75, 0x62, 0xB7, 0x86, 0x59, 0xD7, 0x68, 0xC9,
+    0x9C, 0x92, 0x57, 0x3C, 0xE2, 0x3B, 0x8C, 0x6C, 0x9F, 0xCB, 0x44, 0xC4, 0x2D, 0x8F, 0x7C, 0x46,
+    0x25, 0x22, 0xE9, 0x9F, 0xC8, 0x68, 0xBB, 0x35, 0x98, 0x69, 0x28, 0x32, 0x47, 0xFE, 0x8A, 0x47,
+    0xB5, 0xDD, 0x17, 0xF3, 0x08, 0xDF, 0x9D, 0xF8, 0x81, 0xC9, 0xB0, 0x34, 0x24, 0x3F, 0xCB, 0x23,
+    0x3C, 0x19, 0x75, 0x9B, 0x8A, 0x1B, 0x29, 0xD1, 0x21, 0x6D, 0x11, 0xBF, 0x86, 0x96, 0x4F, 0x7F,
+    0xB2, 0xC7, 0x23, 0x2C, 0x44, 0x22, 0x95, 0x88, 0xA3, 0xDA, 0x0F, 0x56, 0x2D, 0x41, 0xD7, 0x54,
+    0xC4, 0xEA, 0xFB, 0xDF, 0x68, 0x75, 0x4D, 0xAD, 0x97, 0x04, 0x10, 0x6D, 0xA1, 0x7C, 0x7F, 0x0B,
+    0x33, 0x41, 0x17, 0xAC, 0x08, 0x2A, 0xA5, 0x88, 0x2D, 0x45, 0xEC, 0x81, 0xED, 0xB3, 0xB0, 0xB1,
+    0x3C, 0xC5, 0x10, 0xE1, 0x9C, 0x07, 0x79, 0xFF, 0x5F, 0xB3, 0xE4, 0x0C, 0xAF, 0xC0, 0x88, 0xB3,
+    0x60, 0xA0, 0xB1, 0x18, 0x90, 0x1A, 0x03, 0xE2, 0xA8, 0x40, 0x3C, 0x15, 0x48, 0xA0, 0x02, 0xE9,
+    0x69, 0x60, 0x88, 0x34, 0x24, 0x71, 0x64, 0x87, 0x24, 0x56, 0x8C, 0xA4, 0x83, 0xA9, 0x47, 0x1A,
+    0x11, 0x91, 0x61, 0x4A, 0xD3, 0x98, 0x85, 0x01, 0x15, 0x55, 0x37, 0xA0, 0x86, 0x74, 0x18, 0x50,
+    0x03, 0xE3, 0x80, 0x1A, 0x68, 0x22, 0x6A, 0xC0, 0x44, 0xD4, 0x40, 0x19, 0x51, 0x03, 0x3A, 0x42,
+    0x35, 0xC9, 0xB9, 0x01, 0x36, 0xBE, 0x2D, 0x96, 0x05, 0xDA, 0xB1, 0x20, 0x6B, 0x2B, 0x11, 0x89,
+    0x4F, 0xC8, 0xD6, 0x95, 0x9E, 0x05, 0x85, 0x43, 0x44, 0xEA, 0xE9, 0x14, 0x84, 0xC8, 0xBB, 0x93,
+    0x77, 0x3A, 0x9D, 0x53, 0x1D, 0x58, 0x3A, 0xAB, 0x8C, 0x2C, 0x39, 0x8E, 0x53, 0x22, 0x0F, 0x24,
+    0xC5, 0x08, 0x90, 0x49, 0x07, 0x24, 0x3F, 0x38, 0x07, 0x70, 0x3E, 0xF5, 0xC0, 0x63, 0x9C, 0x06,
+    0x72, 0x34, 0x90, 0xBA, 0xCC, 0x01, 0x57, 0x55, 0xA0, 0xE8, 0x4F, 0x5D, 0xE9, 0x29, 0xC6, 0x5C,
+    0x22, 0x47, 0x50, 0x12, 0x51, 0x16, 0x91, 0x1A, 0x8F, 0xF9, 0x67, 0x1D, 0xC6, 0x6A, 0x57, 0xA2,
+    0x46, 0x15, 0x32, 0x47, 0x19, 0x62, 0xD2, 0xC1, 0xA6, 0x61, 0x13, 0xF2, 0xD7, 0x5C, 0xE1, 0xF2,
+    0xEF, 0xDD, 0x0B, 0x59, 0xC8, 0xA4, 0x8F, 0x49, 0x4C, 0x25, 0x1A, 0x1A, 0x5B, 0xDE, 0x47, 0x43,
+    0xE2, 0x67, 0x90, 0xDB, 0x00, 0xB3, 0xB4, 0x85, 0x90, 0x5B, 0x94, 0x3B, 0x06, 0x05, 0xEB, 0x59,
+    0x7D, 0xA1, 0x14, 0x91, 0xB1, 0x11, 0x91, 0xFE, 0xC5, 0x7F, 0x75, 0x7F, 0xC3, 0x9E, 0x2C, 0x43,
+    0xE0, 0xDA, 0xA7, 0x6F, 0xBA, 0xE4, 0xDE, 0xDD, 0x5F, 0x23, 0xFB, 0xE0, 0xD4, 0x75, 0x74, 0xAC,
+    0x5A, 0x8C, 0x17, 0x8B, 0x3C, 0x1D, 0x51, 0x51, 0x07, 0xF2, 0x50, 0x3A, 0xCA, 0x7A, 0x13, 0x36,
+    0xE8, 0xF9, 0xEB, 0xBF, 0xBB, 0x8A, 0x71, 0x18, 0x11, 0x4A, 0x63, 0xCF, 0xD5, 0xE5, 0x9C, 0xAC,
+    0x2D, 0xD7, 0x48, 0x7D, 0xB9, 0x46, 0x12, 0xCA, 0xB5, 0xD4, 0x86, 0x72, 0x2D, 0x73, 0x0F, 0x24,
+    0xCA, 0x5D, 0x2E, 0x67, 0xCA, 0xB1, 0x4C, 0xD2, 0x80, 0x99, 0x31, 0x50, 0xCD, 0xA8, 0x3E, 0x95,
+    0xAF, 0x4C, 0xC8, 0x3A, 0x5F, 0xDF, 0x59, 0x5A, 0x1D, 0xD7, 0xA6, 0xE3, 0x0E, 0x99, 0x0C, 0x24,
+    0x22, 0x16, 0xAE, 0xC2, 0xCE, 0x09, 0x12, 0xF9, 0x00, 0xBA, 0xCA, 0x71, 0x55, 0x05, 0x4E, 0xB3,
+    0xE0, 0x18, 0x25, 0xCA, 0x69, 0x47, 0x9F, 0x07, 0x4A, 0x89, 0x28, 0x11, 0x28, 0x3F, 0x76, 0x60,
+    0x51, 0x22, 0x23, 0xBB, 0xBE, 0x4C, 0xF2, 0x9B, 0x96, 0x46, 0xEA, 0x5C, 0x46, 0xCC, 0xA5, 0xAF,
+    0xAC, 0x8C, 0x85, 0x39, 0x18, 0x89, 0xC9, 0xA7, 0xD2, 0xA1, 0xA7, 0x23, 0x48, 0xA5, 0xF4, 0xA9,
+    0x48, 0x40, 0xD7, 0x93, 0x7E, 0xD8, 0x86, 0x24, 0x82, 0x1A, 0x5F, 0xB7, 0xB9, 0x8C, 0x68, 0xE9,
+    0x39, 0x38, 0xF9, 0x92, 0x95, 0x88, 0x7C, 0x28, 0x22, 0xF2, 0xA6, 0x5C, 0x79, 0x5F, 0x96, 0x94,
+    0xB0, 0x89, 0x3C, 0x6B, 0x41, 0x7F, 0x60, 0xC1, 0x0C, 0x13, 0x82, 0x98, 0x48, 0x80, 0xEC, 0xCA,
+    0x1F, 0x59, 0xA8, 0x86, 0x25, 0x99, 0xA9, 0xE9, 0x96, 0x98, 0xC7, 0xD7, 0x9A, 0x55, 0xD4, 0x3E,
+    0xEF, 0x80, 0xB2, 0x05, 0x1A, 0xBB, 0xAC, 0x2A, 0xE4, 0x5D, 0x48, 0x44, 0x3A, 0x28, 0xCE, 0x9E,
+    0xF3, 0xA4, 0x01, 0x43, 0x25, 0x22, 0xE2, 0xD3, 0x40, 0x61, 0xAB, 0x89, 0x93, 0x16, 0x68, 0xC0,
+    0x2C, 0xB9, 0xED, 0x3D, 0x18, 0xE9, 0x27, 0xE8, 0x69, 0x69, 0x83, 0xAA, 0x6E, 0x97, 0xA9, 0x36,
+    0xD5, 0x56, 0xF5, 0xAE, 0x61, 0x5A, 0xB9, 0x15, 0xF7, 0x64, 0x2A, 0xEE, 0x79, 0x4D, 0x9F, 0x4D,
+    0x0E, 0x36, 0xA3, 0xA5, 0x11, 0x71, 0x4A, 0xAE, 0x7C, 0xDB, 0xE9, 0x5E, 0x43, 0xE1, 0x35, 0x94,
+    0x4E, 0x83, 0xA9, 0x35, 0x98, 0xFA, 0x08, 0x18, 0xBB, 0x97, 0xE8, 0xE7, 0x31, 0x56, 0xCB, 0x60,
+    0xEC, 0x91, 0x2B, 0xA3, 0x71, 0x47, 0x92, 0x4F, 0x4C, 0x7B, 0x24, 0x09, 0x65, 0x77, 0x24, 0x0D,
+    0x85, 0x7C, 0x70, 0x25, 0x68, 0x11, 0x09, 0x53, 0x84, 0x4C, 0x44, 0x3C, 0xB9, 0xDC, 0x67, 0x32,
+    0x0E, 0xF7, 0x25, 0x00, 0xBF, 0xB8, 0x8C, 0x62, 0xF5, 0xAB, 0xE8, 0xDA, 0x43, 0x9C, 0x0B, 0x30,
+    0x85, 0x09, 0xA1, 0xAC, 0x77, 0x63, 0xEC, 0x69, 0x8F, 0x91, 0x15, 0xB3, 0x59, 0x6E, 0x6F, 0x6D,
+    0x6D, 0x6D, 0x6D, 0xD9, 0x95, 0x77, 0xBD, 0xB5, 0x75, 0x59, 0x26, 0xC6, 0xB3, 0x88, 0xC8, 0x73,
+    0xD3, 0xB1, 0xA7, 0x01, 0x6A, 0xAA, 0x95, 0x0C, 0x10, 0x8B, 0x88, 0x08, 0x34, 0x22, 0x03, 0x7C,
+    0x63, 0x9F, 0x3B, 0x7C, 0x74, 0x75, 0x4F, 0x74, 0xEB, 0xFF, 0xF4, 0x48, 0xF9, 0x77, 0x30, 0x47,
+    0x58, 0x5B, 0xDD, 0xF3, 0x23, 0x18, 0x4D, 0x79, 0x17, 0x2D, 0x5D, 0x26, 0x91, 0xEA, 0x3E, 0x39,
+    0x95, 0x88, 0x84, 0xB3, 0x67, 0xCF, 0x9E, 0xDD, 0x33, 0x19, 0x77, 0xD7, 0xCE, 0xCD, 0x7F, 0xFD,
+    0xDC, 0x1F, 0x9E, 0x7D, 0x60, 0xED, 0xEC, 0x27, 0x5E, 0x27, 0x71, 0xC5, 0x9A, 0x29, 0x1C, 0x50,
+    0xAD, 0xAA, 0xF2, 0xF0, 0xB9, 0x85, 0x92, 0x77, 0x2B, 0xF0, 0xC0, 0xA5, 0x13, 0x99, 0x25, 0xB3,
+    0x0F, 0x7F, 0xEF, 0x93, 0x8B, 0x22, 0x81, 0x35, 0xA8, 0xD0, 0x82, 0x12, 0x8B, 0x2C, 0x8D, 0xDF,
+    0x16, 0xE2, 0xC4, 0xA6, 0x69, 0x57, 0xA7, 0x1E, 0x76, 0xA3, 0x30, 0x68, 0x60, 0xF6, 0x30, 0x7C,
+    0x1C, 0xC9, 0xE4, 0x52, 0x2A, 0x2D, 0x3A, 0x26, 0xFC, 0xA5, 0x0F, 0x17, 0x64, 0xE2, 0xA9, 0x7A,
+    0xF4, 0xC0, 0x6C, 0x1E, 0x52, 0x9F, 0xB9, 0x92, 0x22, 0x0F, 0x54, 0x03, 0xC9, 0x68, 0x77, 0x0F,
+    0x77, 0x93, 0x03, 0x99, 0x9D, 0xDE, 0x8D, 0x0C, 0x28, 0x11, 0x9B, 0x7D, 0xFA, 0xA2, 0xCB, 0xDF,
+    0x7C, 0xC6, 0xE9, 0x57, 0x9F, 0x6E, 0xF5, 0x33, 0x4F, 0xB5, 0x3A, 0x7B, 0xAA, 0xD5, 0xEA, 0xE5,
+    0xCF, 0x7C, 0x5E, 0x99, 0x3E, 0x4F, 0xBF, 0xD2, 0xE6, 0x4F, 0xBF, 0xD2, 0x4E, 0x47, 0x2D, 0x33,
+    0x11, 0x4F, 0xF6, 0x83, 0x5F, 0xED, 0xC8, 0x1D, 0x91, 0xDC, 0xB1, 0xB1, 0x9B, 0x6C, 0xA3, 0x5D,
+    0x1A, 0x0F, 0xBC, 0x28, 0xD2, 0x69, 0x11, 0xF1, 0x7A, 0xE2, 0xF2, 0xFA, 0xA5, 0x6A, 0x7C, 0xE2,
+    0xCA, 0x27, 0x6F, 0x60, 0x44, 0xFA, 0x29, 0x99, 0x50, 0x96, 0x29, 0x09, 0x0F, 0x24, 0xE9, 0x44,
+    0x80, 0xA5, 0x98, 0xAC, 0x49, 0xBA, 0xC9, 0xB8, 0xCC, 0x6B, 0x28, 0x45, 0xA4, 0x14, 0x91, 0x7C,
+    0xC5, 0xBC, 0xED, 0x80, 0xB5, 0xE9, 0xA8, 0x21, 0xD9, 0x6A, 0xDA, 0xEA, 0xA5, 0xAE, 0x90, 0x96,
+    0x44, 0x46, 0x92, 0x9F, 0xDD, 0xF3, 0x69, 0x77, 0xC1, 0xA4, 0xE1, 0x58, 0xEA, 0xCF, 0x67, 0xF5,
+    0x37, 0x49, 0x3C, 0x70, 0x61, 0xF9, 0x7F, 0x2F, 0x64, 0x35, 0x0F, 0x56, 0xF0, 0x77, 0x3F, 0xFB,
+    0xC3, 0x2B, 0x46, 0x6F, 0x6F, 0x44, 0x06, 0x33, 0x91, 0x1E, 0xFA, 0xC9, 0xCE, 0xCD, 0xDD, 0x5E,
+    0x47, 0x5F, 0xDA, 0xC3, 0x55, 0xBE, 0xF4, 0xD7, 0xCF, 0x67, 0xF5, 0x23, 0x65, 0xE2, 0x4F, 0xA5,
+    0xDD, 0x05, 0x43, 0xF1, 0x6B, 0xF3, 0xE9, 0xC8, 0x99, 0x1E, 0x96, 0x5D, 0xFE, 0x85, 0xD5, 0x18,
+    0x0E, 0xF1, 0x2D, 0x98, 0x31, 0x83, 0x6B, 0x68, 0xD2, 0x16, 0xE5, 0xB2, 0x9A, 0xC4, 0x17, 0x5B,
+    0x5B, 0x5B, 0x7D, 0x29, 0x22, 0x51, 0x03, 0x41, 0x39, 0xD2, 0x96, 0x40, 0x6E, 0xB9, 0xC0, 0xB1,
+    0x95, 0x8A, 0x5B, 0x5D, 0xD7, 0xA0, 0x6C, 0xD1, 0x4D, 0x9D, 0xBD, 0x79, 0x2A, 0x09, 0xE7, 0xD7,
+    0x8F, 0x67, 0x13, 0x84, 0x99, 0xC1, 0x5E, 0xF6, 0x50, 0x86, 0xF2, 0xE7, 0x4F, 0xE4, 0xAF, 0xE6,
+    0xB6, 0xFC, 0xB7, 0x2D, 0x55, 0x20, 0x89, 0x90, 0x42, 0xF2, 0x2B, 0xBF, 0x9F, 0x89, 0xBC, 0x3C,
+    0x58, 0x9A, 0x9A, 0x93, 0x3D, 0xB9, 0xAE, 0x53, 0xD7, 0x13, 0x74, 0x3D, 0xA3, 0xD7, 0xE8, 0x9B,
+    0x96, 0x1E, 0x7E, 0x41, 0x6F, 0xBD, 0xA0, 0x44, 0x5A, 0xFE, 0x62, 0x87, 0x1A, 0x50, 0x1F, 0xD7,
+    0xEA, 0x43, 0xAF, 0xC2, 0x69, 0x15, 0x8E, 0xA8, 0xA0, 0x6E, 0x05, 0x7E, 0x1A, 0xF8, 0xCA, 0x04,
+    0x00, 0x65, 0x90, 0x06, 0x1E, 0x99, 0xA3, 0x95, 0x57, 0xF5, 0x5A, 0xD2, 0x66, 0xED, 0x4B, 0xAC,
+    0x9F, 0x20, 0x7F, 0x0B, 0x1A, 0x87, 0xF6, 0x46, 0x7A, 0xBD, 0xCB, 0x28, 0x71, 0xD0, 0x07, 0xFA,
+    0x19, 0x8B, 0x9C, 0x45, 0xD2, 0xAE, 0x73, 0x61, 0x83, 0x23, 0x6B, 0xA8, 0x11, 0x46, 0x28, 0x25,
+    0xE6, 0x22, 0x70, 0x60, 0x75, 0xA2, 0x21, 0x09, 0x4B, 0x3B, 0x89, 0xEB, 0x4B, 0x12, 0x36, 0x95,
+    0x88, 0x3C, 0xD3, 0x32, 0xF9, 0xAE, 0xD3, 0xBE, 0x36, 0x22, 0x62, 0xCD, 0x2E, 0x8B, 0x7C, 0x63,
+    0xE2, 0xB8, 0xEE, 0x5F, 0x38, 0xA9, 0x73, 0x90, 0xBB, 0x00, 0xA5, 0x8B, 0xB0, 0xE9, 0x3E, 0x20,
+    0xF9, 0x99, 0xFB, 0x61, 0x9B, 0xBD, 0xED, 0xDE, 0xEE, 0x8A, 0x33, 0xAE, 0xDD, 0x38, 0x95, 0xB8,
+    0xF6, 0xE8, 0x43, 0x89, 0x6B, 0xE1, 0xE7, 0x4D, 0x26, 0x55, 0xAA, 0x77, 0xDB, 0x9D, 0xB1, 0x5C,
+    0x32, 0x2C, 0x96, 0x4C, 0x9E, 0x89, 0xAE, 0x9B, 0x06, 0xA0, 0x54, 0x32, 0x51, 0x61, 0x4B, 0x26,
+    0xFF, 0x68, 0x72, 0xBA, 0x4F, 0xAC, 0xFE, 0x73, 0x94, 0xBA, 0xFE, 0xB9, 0x1B, 0x7E, 0x2C, 0x71,
+    0xED, 0xA1, 0x32, 0x71, 0xED, 0x3C, 0xBF, 0xE1, 0xDA, 0x3E, 0xFD, 0xD0, 0xDD, 0xF1, 0x8C, 0xEE,
+    0x6E, 0x8D, 0x71, 0x03, 0x68, 0xD7, 0x81, 0x72, 0x2D, 0xE0, 0x56, 0x02, 0xF1, 0xC0, 0x12, 0xF1,
+    0x08, 0x50, 0x2C, 0xE9, 0x7D, 0x33, 0xB8, 0x4E, 0x12, 0x28, 0x21, 0xAF, 0x33, 0x11, 0x19, 0x93,
+    0x0E, 0xE8, 0x4B, 0x20, 0x77, 0x11, 0xD2, 0xA0, 0x44, 0x24, 0xA2, 0x1D, 0x25, 0xCC, 0xC9, 0x5A,
+    0x92, 0x8E, 0x7E, 0xC5, 0xBA, 0xDD, 0xE3, 0xD6, 0x9C, 0x5F, 0x4A, 0xCE, 0xCD, 0x0E, 0x16, 0xC6,
+    0x32, 0x1E, 0x89, 0xA9, 0x5C, 0x7C, 0xD6, 0xCF, 0x2E, 0xB7, 0xD7, 0x38, 0xFE, 0x24, 0x3C, 0x7C,
+    0x18, 0xD2, 0x8B, 0x16, 0x2E, 0xB7, 0x2C, 0x2B, 0x92, 0xE4, 0x4F, 0x2F, 0x3E, 0xED, 0x2B, 0x7F,
+    0xA7, 0x4B, 0x7B, 0xE3, 0x29, 0x9E, 0x6B, 0x27, 0xC2, 0x96, 0x76, 0x90, 0xD4, 0x00, 0xC7, 0xEC,
+    0x74, 0xC4, 0xA5, 0x58, 0xCE, 0xEC, 0xD5, 0xE9, 0x70, 0x66, 0x0E, 0xCC, 0xB8, 0x52, 0x87, 0x42,
+    0xEE, 0xB8, 0x21, 0xFB, 0x7F, 0x73, 0xA7, 0xBA, 0x39, 0xB9, 0xEB, 0x29, 0x94, 0x67, 0x3D, 0x77,
+    0xAA, 0x2D, 0xDE, 0xAB, 0x30, 0xD2, 0x63, 0xC4, 0xF1, 0x8D, 0x8E, 0xFF, 0x1F, 0xA5, 0x94, 0xB1,
+    0x8E, 0x1D, 0x35, 0x14, 0x86, 0x3F, 0x8F, 0x21, 0x96, 0xB0, 0x82, 0x2B, 0x88, 0xD0, 0x4A, 0xCC,
+    0x03, 0x10, 0x65, 0x5E, 0xE0, 0xEE, 0x7A, 0x44, 0x9B, 0x82, 0x45, 0x62, 0x69, 0x28, 0xE0, 0x0D,
+    0x6E, 0x93, 0x32, 0x77, 0xC7, 0x21, 0x2F, 0xB0, 0x8F, 0x40, 0x9B, 0x34, 0xA1, 0x8C, 0xD0, 0x6A,
+    0xC7, 0x28, 0x25, 0x05, 0x23, 0x45, 0x11, 0x05, 0x8D, 0x8B, 0xDD, 0x82, 0x34, 0xB8, 0x18, 0x88,
+    0x13, 0xE6, 0xDE, 0x43, 0x31, 0xF7, 0xEE, 0x6E, 0x10, 0x5D, 0x8E, 0xF4, 0xFB, 0xB7, 0x7D, 0x64,
+    0xEB, 0xFC, 0xC7, 0xE7, 0x18, 0x66, 0xDB, 0x93, 0x13, 0x1D, 0xE9, 0x44, 0x74, 0xA2, 0xBF, 0xE8,
+    0x5E, 0x25, 0xBA, 0xA8, 0x24, 0xE1, 0x23, 0x75, 0xA6, 0x8E, 0x98, 0x09, 0x97, 0x30, 0xD2, 0xEA,
+    0x8C, 0xF9, 0x25, 0x31, 0x61, 0x7E, 0x2E, 0x78, 0x6C, 0x3C, 0xC0, 0x05, 0x1B, 0x5D, 0xD4, 0xD9,
+    0x06, 0x9D, 0x98, 0x5C, 0x50, 0x05, 0xFF, 0x45, 0x60, 0x83, 0x93, 0x96, 0xBE, 0x55, 0x72, 0xF1,
+    0xB5, 0x44, 0xBC, 0x88, 0x24, 0x9C, 0x88, 0x64, 0x9C, 0x88, 0x8C, 0xB8, 0xBB, 0x22, 0x23, 0x8E,
+    0x3D, 0x39, 0xA1, 0xE2, 0x9A, 0xE9, 0x11, 0xA8, 0x13, 0x20, 0x11, 0xCC, 0x9F, 0x01, 0x7C, 0x03,
+    0x6A, 0x3A, 0x06, 0x37, 0x4C, 0xE0, 0xAB, 0x42, 0x35, 0xEA, 0x8C, 0x8B, 0x36, 0x71, 0x46, 0x1D,
+    0x75, 0xC6, 0x87, 0x26, 0xD2, 0xB1, 0x86, 0x8D, 0xCD, 0x54, 0x93, 0x7F, 0x71, 0xF4, 0xCD, 0x28,
+    0x22, 0xF2, 0x5C, 0x44, 0xA4, 0xF5, 0x22, 0x6B, 0x2F, 0xB2, 0xD6, 0x49, 0x0F, 0xEF, 0x02, 0x75,
+    0x58, 0x85, 0x77, 0x39, 0xBF, 0x8B, 0xC3, 0xCB, 0xC6, 0x8B, 0xDC, 0x06, 0x0B, 0x55, 0x84, 0x1F,
+    0xE1, 0x36, 0x38, 0xD0, 0x81, 0x2A, 0xE0, 0x60, 0x1F, 0x46, 0xF4, 0x80, 0x6B, 0xF1, 0x8F, 0x1F,
+    0x7B, 0x11, 0x2F, 0x32, 0x27, 0xA8, 0x7A, 0x22, 0xDF, 0x8B, 0xE4, 0x79, 0x21, 0x02, 0x74, 0x6F,
+    0x02, 0xDC, 0x01, 0x70, 0x2D, 0x60, 0x22, 0xA0, 0x33, 0xC0, 0x08, 0x70, 0x0A, 0xE0, 0x01, 0xEA,
+    0x00, 0xD8, 0x61, 0xE7, 0x56, 0x13, 0xC0, 0x06, 0x54, 0xF0, 0x2D, 0x94, 0x26, 0x42, 0xFD, 0x6B,
+    0x02, 0x2D, 0x23, 0xD0, 0x4D, 0x80, 0x13, 0x40, 0x49, 0x00, 0xE8, 0x43, 0x13, 0x8C, 0x64, 0x19,
+    0xDD, 0x8B, 0x9F, 0x5E, 0x9F, 0xDE, 0xA1, 0x89, 0x37, 0x17, 0xB8, 0xF0, 0xE1, 0x02, 0xD7, 0xDA,
+    0xDD, 0x10, 0x3F, 0x6D, 0xBE, 0xEC, 0x65, 0xED, 0xE4, 0x8D, 0x4C, 0x46, 0xB2, 0x8C, 0xF4, 0xA1,
+    0x09, 0x80, 0xDA, 0xB4, 0x50, 0x6D, 0x12, 0xA8, 0x11, 0xA0, 0x00, 0xEC, 0x03, 0x34, 0x00, 0x36,
+    0x02, 0x3A, 0xBD, 0xED, 0xA9, 0x2F, 0x3D, 0x55, 0x06, 0x98, 0x00, 0x0E, 0x00, 0x5C, 0x00, 0xCC,
+    0xC0, 0xEE, 0xB6, 0x2B, 0x91, 0x2E, 0x02, 0x36, 0xC1, 0x27, 0x66, 0x84, 0x4E, 0x26, 0x68, 0x64,
+    0x03, 0x95, 0x08, 0x60, 0x37, 0xBB, 0x42, 0xF3, 0xEE, 0xB7, 0xBF, 0x37, 0x47, 0x2D, 0x00, 0xEA,
+    0x70, 0xEA, 0x96, 0xBF, 0x17, 0x80, 0x3A, 0xA9, 0x07, 0x7F, 0x65, 0x7B, 0xF7, 0x41, 0x5E, 0xEC,
+    0xAB, 0x37, 0xF9, 0x07, 0xD5, 0xB7, 0xDB, 0x03, 0x6E, 0xCD, 0xBD, 0xD3, 0x83, 0xEA, 0xF9, 0xD0,
+    0x2C, 0x3F, 0x60, 0x6F, 0xBC, 0x56, 0xB3, 0xF7, 0x80, 0x04, 0x2A, 0x82, 0x0E, 0x60, 0x81, 0x9B,
+    0x40, 0x33, 0x79, 0x91, 0x75, 0xF7, 0x4F, 0x9E, 0x1F, 0xD9, 0x04, 0x70, 0xF0, 0x99, 0xC8, 0xD4,
+    0x89, 0xAC, 0x29, 0xA0, 0x32, 0xE8, 0x61, 0x96, 0xE8, 0xDA, 0xAD, 0xB4, 0xD9, 0x14, 0xC0, 0x0A,
+    0x68, 0x32, 0xEC, 0xAD, 0xC1, 0x48, 0x4B, 0x25, 0x03, 0xF4, 0x23, 0xB8, 0xD7, 0x80, 0x3F, 0x07,
+    0x7A, 0x39, 0x81, 0x3D, 0x79, 0x0D, 0xAA, 0x97, 0x04, 0x56, 0x22, 0xB0, 0x04, 0x78, 0x4F, 0x1D,
+    0x02, 0x4E, 0xFE, 0x68, 0xF9, 0xB8, 0x17, 0x09, 0xF0, 0xD1, 0x93, 0x56, 0x5D, 0x66, 0xAF, 0x19,
+    0x01, 0xBB, 0x06, 0x2A, 0x09, 0x40, 0x7F, 0x0E, 0x34, 0x6B, 0xC0, 0xAC, 0x81, 0x7A, 0x84, 0xA5,
+    0x0C, 0xAA, 0x97, 0x73, 0x25, 0x32, 0x60, 0xE5, 0x04, 0x9A, 0x13, 0x60, 0x9B, 0x10, 0xF5, 0x1D,
+    0xEF, 0x3F, 0x91, 0xD4, 0x89, 0x3C, 0xFA, 0xFC, 0xE5, 0x21, 0xC0, 0x32, 0xD8, 0x54, 0x17, 0x23,
+    0x3A, 0xF1, 0x94, 0x05, 0x0E, 0x1D, 0xC9, 0xDC, 0xC7, 0xD1, 0x89, 0xC8, 0x2B, 0x11, 0x91, 0x5B,
+    0x17, 0x47, 0x85, 0x15, 0xAE, 0x35, 0x03, 0x23, 0x2B, 0x5C, 0x30, 0x03, 0x85, 0x15, 0x75, 0x30,
+    0x83, 0xDA, 0x4E, 0x92, 0x2A, 0x9C, 0x51, 0x07, 0xBB, 0x9D, 0x44, 0x50, 0x05, 0xAA, 0xC2, 0xF2,
+    0xE1, 0xA4, 0xE4, 0xE1, 0xA4, 0x07, 0xD0, 0xF1, 0x0A, 0x9D, 0xC4, 0xDC, 0x49, 0xCC, 0x66, 0xE0,
+    0x7F, 0xA0, 0xAE, 0x90, 0xD4, 0x68, 0x53, 0xB5, 0x43, 0x99, 0x75, 0x9C, 0x51, 0xA8, 0x8B, 0x1E,
+    0x18, 0x71, 0xAD, 0x8E, 0xDC, 0xC7, 0xA1, 0x32, 0x0B, 0x4C, 0xAC, 0x25, 0x37, 0x74, 0x12, 0x4F,
+    0xA9, 0xDB, 0x2A, 0xB3, 0xC2, 0x46, 0x35, 0x72, 0x80, 0x19, 0x28, 0xD4, 0xAD, 0x4E, 0xAC, 0x70,
+    0xE1, 0xDA, 0x56, 0xD0, 0x89, 0x33, 0xDC, 0xA6, 0x2A, 0xF8, 0xC9, 0x26, 0xB6, 0x8D, 0x3A, 0x3F,
+    0x6C, 0x1D, 0x6F, 0x14, 0xCE, 0x6C, 0x36, 0x1B, 0x25, 0xCF, 0x26, 0x9D, 0x78, 0x0A, 0x64, 0x16,
+    0xC0, 0x02, 0x07, 0xD4, 0x5B, 0x35, 0x22, 0x79, 0x51, 0x8B, 0xC8, 0xE4, 0xD4, 0xF1, 0xD1, 0xB7,
+    0x41, 0xC7, 0xBA, 0xD5, 0xB3, 0x9C, 0x91, 0x85, 0x1A, 0x39, 0xC0, 0xB1, 0xC2, 0x05, 0x1D, 0xEB,
+    0xD6, 0x24, 0xB2, 0x19, 0x54, 0x61, 0x5F, 0x8D, 0x1C, 0xE3, 0xDA, 0x63, 0xEA, 0x60, 0x86, 0x26,
+    0x98, 0xA4, 0x8A, 0x4D, 0xAA, 0x70, 0x5C, 0x15, 0x3A, 0x9A, 0xB0, 0x2B, 0xAD, 0x65, 0xB0, 0xC9,
+    0x06, 0x25, 0xA1, 0xCB, 0x2E, 0xE8, 0xC4, 0xD3, 0x59, 0x76, 0xBE, 0x22, 0x13, 0xC9, 0xD4, 0x73,
+    0x20, 0x97, 0x74, 0xEB, 0xE2, 0xA8, 0xD0, 0x60, 0x06, 0xC6, 0xB7, 0xA8, 0x5C, 0x27, 0x55, 0xF0,
+    0xFF, 0xA5, 0xA4, 0x0A, 0x1E, 0x9B, 0x54, 0xC1, 0xCF, 0x11, 0xF9, 0xC9, 0x26, 0x35, 0xD1, 0x4C,
+    0x57, 0xF5, 0x6E, 0xB9, 0xFC, 0x0A, 0xE6, 0x3E, 0xE6, 0x00, 0xFA, 0x72, 0xA3, 0x7F, 0x64, 0x64,
+    0x72, 0x22, 0x73, 0x7B, 0x38, 0xE0, 0x60, 0xDB, 0x2A, 0x6E, 0x84, 0x63, 0xB4, 0x0C, 0xAC, 0xA0,
+    0x5F, 0xB3, 0x02, 0xD5, 0xB3, 0x02, 0x7C, 0xBB, 0xC2, 0xBE, 0xEC, 0xDB, 0xFE, 0xAB, 0x5A, 0x84,
+    0x7E, 0xED, 0x65, 0x43, 0xBF, 0xB1, 0x72, 0x4E, 0x27, 0xFF, 0x02,
 };
 
 static const EpdGlyph opendyslexic_12_regularGlyphs[] = {
@@ -1682,7 +1658,7 @@ static const EpdGlyph opendyslexic_12_regularGlyphs[] = {
     { 4, 22, 6, 1, 18, 22, 6485 }, // |
     { 12, 24, 14, 1, 19, 72, 6507 }, // }
     { 10, 5, 12, 1, 19, 13, 6579 }, // ~
-    { 0, 0, 21, 0, 0, 0, 0 }, //  
+    { 0, 0, 21, 0, 0, 0, 6592 }, //  
     { 6, 25, 8, 1, 19, 38, 0 }, // ¡
     { 12, 22, 19, 3, 19, 66, 38 }, // ¢
     { 16, 24, 17, 1, 24, 96, 104 }, // £
@@ -1693,625 +1669,631 @@ static const EpdGlyph opendyslexic_12_regularGlyphs[] = {
     { 12, 5, 13, 1, 20, 15, 448 }, // ¨
     { 11, 10, 13, 1, 23, 28, 463 }, // ©
     { 8, 9, 10, 2, 19, 18, 491 }, // ª
-    { 13, 12, 16, 1, 12, 39, 509 }, // «
-    { 13, 8, 15, 1, 9, 26, 548 }, // ¬
-    { 13, 3, 14, 1, 9, 10, 574 }, // ­
-    { 11, 10, 13, 1, 27, 28, 584 }, // ®
-    { 10, 3, 13, 1, 18, 8, 612 }, // ¯
-    { 12, 12, 13, 1, 20, 36, 620 }, // °
-    { 13, 14, 16, 1, 13, 46, 656 }, // ±
-    { 7, 9, 7, 0, 20, 16, 702 }, // ²
-    { 7, 10, 8, 0, 20, 18, 718 }, // ³
-    { 5, 5, 7, 1, 19, 7, 736 }, // ´
-    { 15, 17, 20, 2, 14, 64, 743 }, // µ
-    { 13, 21, 15, 1, 18, 69, 807 }, // ¶
-    { 5, 5, 7, 1, 11, 7, 876 }, // ·
-    { 6, 7, 8, 1, 1, 11, 883 }, // ¸
-    { 7, 10, 7, 0, 21, 18, 894 }, // ¹
-    { 8, 8, 11, 2, 18, 16, 912 }, // º
-    { 13, 12, 16, 1, 12, 39, 928 }, // »
-    { 21, 24, 28, 4, 22, 126, 967 }, // ¼
-    { 22, 23, 28, 4, 21, 127, 1093 }, // ½
-    { 22, 24, 28, 3, 22, 132, 1220 }, // ¾
-    { 14, 28, 14, 0, 15, 98, 1352 }, // ¿
-    { 20, 28, 28, 4, 28, 140, 1450 }, // À
-    { 20, 33, 28, 4, 33, 165, 1590 }, // Á
-    { 20, 29, 28, 4, 29, 145, 1755 }, // Â
-    { 20, 29, 28, 4, 29, 145, 1900 }, // Ã
-    { 20, 29, 28, 4, 29, 145, 2045 }, // Ä
-    { 20, 30, 28, 4, 30, 150, 2190 }, // Å
-    { 28, 23, 36, 4, 22, 161, 2340 }, // Æ
-    { 18, 28, 25, 3, 22, 126, 2501 }, // Ç
-    { 15, 28, 23, 4, 28, 105, 2627 }, // È
-    { 15, 32, 23, 4, 32, 120, 2732 }, // É
-    { 15, 29, 23, 4, 29, 109, 2852 }, // Ê
-    { 15, 29, 23, 4, 29, 109, 2961 }, // Ë
-    { 8, 30, 11, 0, 30, 60, 3070 }, // Ì
-    { 5, 34, 11, 3, 34, 43, 3130 }, // Í
-    { 10, 31, 11, 0, 31, 78, 3173 }, // Î
-    { 12, 30, 11, -1, 30, 90, 3251 }, // Ï
-    { 23, 22, 27, 1, 22, 127, 3341 }, // Ð
-    { 19, 27, 27, 4, 27, 129, 3468 }, // Ñ
-    { 20, 28, 29, 4, 27, 140, 3597 }, // Ò
-    { 20, 32, 29, 4, 31, 160, 3737 }, // Ó
-    { 20, 29, 29, 4, 28, 145, 3897 }, // Ô
-    { 20, 28, 29, 4, 27, 140, 4042 }, // Õ
-    { 20, 29, 29, 4, 28, 145, 4182 }, // Ö
-    { 12, 7, 15, 1, 10, 21, 4327 }, // ×
-    { 31, 45, 30, -1, 33, 349, 4348 }, // Ø
-    { 18, 30, 26, 4, 29, 135, 4697 }, // Ù
-    { 18, 34, 26, 4, 33, 153, 4832 }, // Ú
-    { 18, 31, 26, 4, 30, 140, 4985 }, // Û
-    { 18, 30, 26, 4, 29, 135, 5125 }, // Ü
-    { 18, 33, 27, 4, 33, 149, 5260 }, // Ý
-    { 12, 20, 14, 1, 20, 60, 5409 }, // Þ
-    { 15, 20, 17, 1, 20, 75, 5469 }, // ß
-    { 14, 20, 21, 3, 20, 70, 5544 }, // à
-    { 14, 24, 21, 3, 24, 84, 5614 }, // á
-    { 14, 21, 21, 3, 21, 74, 5698 }, // â
-    { 14, 20, 21, 3, 20, 70, 5772 }, // ã
-    { 14, 20, 21, 3, 20, 70, 5842 }, // ä
-    { 14, 22, 21, 3, 22, 77, 5912 }, // å
-    { 24, 15, 31, 3, 15, 90, 5989 }, // æ
-    { 12, 21, 19, 3, 15, 63, 6079 }, // ç
-    { 14, 23, 21, 3, 23, 81, 6142 }, // è
-    { 14, 27, 21, 3, 27, 95, 6223 }, // é
-    { 14, 24, 21, 3, 24, 84, 6318 }, // ê
-    { 14, 24, 21, 3, 24, 84, 6402 }, // ë
-    { 9, 21, 11, 0, 21, 48, 6486 }, // ì
-    { 6, 25, 11, 3, 25, 38, 6534 }, // í
-    { 11, 22, 11, 0, 22, 61, 6572 }, // î
-    { 12, 22, 11, -1, 22, 66, 6633 }, // ï
-    { 19, 20, 21, 1, 20, 95, 6699 }, // ð
-    { 14, 21, 20, 3, 21, 74, 6794 }, // ñ
-    { 14, 23, 21, 3, 23, 81, 6868 }, // ò
-    { 14, 27, 21, 3, 27, 95, 6949 }, // ó
-    { 14, 23, 21, 3, 23, 81, 7044 }, // ô
-    { 14, 23, 21, 3, 23, 81, 7125 }, // õ
-    { 14, 23, 21, 3, 23, 81, 7206 }, // ö
-    { 17, 16, 19, 1, 16, 68, 7287 }, // ÷
-    { 14, 39, 21, 3, 26, 137, 7355 }, // ø
-    { 14, 22, 20, 3, 21, 77, 7492 }, // ù
-    { 14, 26, 20, 3, 25, 91, 7569 }, // ú
-    { 14, 23, 20, 3, 22, 81, 7660 }, // û
-    { 14, 22, 20, 3, 21, 77, 7741 }, // ü
-    { 15, 34, 21, 3, 27, 128, 7818 }, // ý
-    { 12, 26, 14, 1, 21, 78, 7946 }, // þ
-    { 15, 30, 21, 3, 23, 113, 8024 }, // ÿ
-    { 20, 28, 28, 4, 28, 140, 0 }, // Ā
-    { 14, 19, 21, 3, 19, 67, 140 }, // ā
-    { 20, 31, 28, 4, 31, 155, 207 }, // Ă
-    { 14, 22, 21, 3, 22, 77, 362 }, // ă
-    { 20, 27, 28, 4, 21, 135, 439 }, // Ą
-    { 14, 20, 21, 3, 15, 70, 574 }, // ą
-    { 18, 33, 25, 3, 32, 149, 644 }, // Ć
-    { 12, 24, 19, 3, 23, 72, 793 }, // ć
-    { 18, 31, 25, 3, 30, 140, 865 }, // Ĉ
-    { 12, 22, 19, 3, 21, 66, 1005 }, // ĉ
-    { 18, 32, 25, 3, 31, 144, 1071 }, // Ċ
-    { 12, 23, 19, 3, 22, 69, 1215 }, // ċ
-    { 18, 33, 25, 3, 32, 149, 1284 }, // Č
-    { 12, 24, 19, 3, 23, 72, 1433 }, // č
-    { 20, 31, 27, 4, 31, 155, 1505 }, // Ď
-    { 20, 22, 21, 3, 21, 110, 1660 }, // ď
-    { 23, 22, 27, 1, 22, 127, 1770 }, // Đ
-    { 19, 22, 21, 3, 21, 105, 1897 }, // đ
-    { 15, 28, 23, 4, 28, 105, 2002 }, // Ē
-    { 14, 23, 21, 3, 23, 81, 2107 }, // ē
-    { 15, 30, 23, 4, 30, 113, 2188 }, // Ĕ
-    { 14, 26, 21, 3, 26, 91, 2301 }, // ĕ
-    { 15, 30, 23, 4, 30, 113, 2392 }, // Ė
-    { 14, 25, 21, 3, 25, 88, 2505 }, // ė
-    { 15, 27, 23, 4, 22, 102, 2593 }, // Ę
-    { 14, 21, 21, 3, 15, 74, 2695 }, // ę
-    { 15, 31, 23, 4, 31, 117, 2769 }, // Ě
-    { 14, 26, 21, 3, 26, 91, 2886 }, // ě
-    { 20, 29, 29, 4, 29, 145, 2977 }, // Ĝ
-    { 14, 28, 20, 3, 21, 98, 3122 }, // ĝ
-    { 20, 31, 29, 4, 31, 155, 3220 }, // Ğ
-    { 14, 30, 20, 3, 23, 105, 3375 }, // ğ
-    { 20, 30, 29, 4, 30, 150, 3480 }, // Ġ
-    { 14, 29, 20, 3, 22, 102, 3630 }, // ġ
-    { 20, 33, 29, 4, 22, 165, 3732 }, // Ģ
-    { 14, 30, 20, 3, 23, 105, 3897 }, // ģ
-    { 19, 29, 27, 4, 29, 138, 4002 }, // Ĥ
-    { 16, 27, 21, 1, 27, 108, 4140 }, // ĥ
-    { 20, 21, 27, 3, 21, 105, 4248 }, // Ħ
-    { 16, 21, 21, 1, 21, 84, 4353 }, // ħ
-    { 10, 31, 11, 0, 31, 78, 4437 }, // Ĩ
-    { 10, 22, 11, 1, 22, 55, 4515 }, // ĩ
-    { 12, 29, 11, -1, 29, 87, 4570 }, // Ī
-    { 12, 20, 11, 0, 20, 60, 4657 }, // ī
-    { 6, 28, 15, 6, 22, 42, 4717 }, // Į
-    { 6, 28, 11, 2, 22, 42, 4759 }, // į
-    { 5, 31, 11, 3, 31, 39, 4801 }, // İ
-    { 5, 14, 11, 3, 14, 18, 4840 }, // ı
-    { 16, 28, 23, 3, 22, 112, 4858 }, // Ĳ
-    { 19, 29, 11, 3, 22, 138, 4970 }, // ĳ
-    { 12, 33, 19, 4, 27, 99, 5108 }, // Ĵ
-    { 13, 27, 16, 3, 21, 88, 5207 }, // ĵ
-    { 17, 30, 26, 4, 21, 128, 5295 }, // Ķ
-    { 14, 31, 20, 3, 20, 109, 5423 }, // ķ
-    { 12, 14, 16, 2, 14, 42, 5532 }, // ĸ
-    { 14, 30, 23, 4, 30, 105, 5574 }, // Ĺ
-    { 7, 29, 14, 3, 29, 51, 5679 }, // ĺ
-    { 14, 33, 23, 4, 22, 116, 5730 }, // Ļ
-    { 7, 32, 14, 3, 21, 56, 5846 }, // ļ
-    { 14, 22, 23, 4, 22, 77, 5902 }, // Ľ
-    { 10, 22, 14, 3, 22, 55, 5979 }, // ľ
-    { 14, 22, 23, 4, 22, 77, 6034 }, // Ŀ
-    { 11, 21, 14, 3, 21, 58, 6111 }, // ŀ
-    { 24, 34, 23, -6, 27, 204, 6169 }, // Ł
-    { 16, 21, 14, -5, 21, 84, 6373 }, // ł
-    { 19, 30, 27, 4, 30, 143, 6457 }, // Ń
-    { 14, 24, 20, 3, 24, 84, 6600 }, // ń
-    { 19, 31, 27, 4, 22, 148, 6684 }, // Ņ
-    { 14, 23, 20, 3, 14, 81, 6832 }, // ņ
-    { 19, 30, 27, 4, 30, 143, 6913 }, // Ň
-    { 14, 24, 20, 3, 24, 84, 7056 }, // ň
-    { 14, 26, 17, 1, 26, 91, 7140 }, // ŉ
-    { 19, 26, 27, 4, 22, 124, 7231 }, // Ŋ
-    { 14, 19, 20, 3, 14, 67, 7355 }, // ŋ
-    { 20, 28, 29, 4, 27, 140, 7422 }, // Ō
-    { 14, 21, 21, 3, 21, 74, 7562 }, // ō
-    { 20, 30, 29, 4, 29, 150, 7636 }, // Ŏ
-    { 14, 25, 21, 3, 25, 88, 7786 }, // ŏ
-    { 21, 29, 29, 4, 28, 153, 7874 }, // Ő
-    { 19, 24, 21, 2, 24, 114, 8027 }, // ő
-    { 29, 21, 30, 4, 21, 153, 8141 }, // Œ
-    { 25, 15, 27, 3, 15, 94, 8294 }, // œ
-    { 16, 29, 24, 4, 29, 116, 8388 }, // Ŕ
-    { 10, 21, 16, 3, 21, 53, 8504 }, // ŕ
-    { 16, 34, 24, 4, 22, 136, 8557 }, // Ŗ
-    { 11, 27, 16, 2, 14, 75, 8693 }, // ŗ
-    { 16, 30, 24, 4, 30, 120, 8768 }, // Ř
-    { 11, 21, 16, 2, 21, 58, 8888 }, // ř
-    { 20, 33, 28, 4, 32, 165, 8946 }, // Ś
-    { 13, 23, 19, 3, 23, 75, 9111 }, // ś
-    { 20, 31, 28, 4, 30, 155, 9186 }, // Ŝ
-    { 13, 21, 19, 3, 21, 69, 9341 }, // ŝ
-    { 20, 28, 28, 4, 22, 140, 9410 }, // Ş
-    { 13, 21, 19, 3, 14, 69, 9550 }, // ş
-    { 20, 33, 28, 4, 32, 165, 9619 }, // Š
-    { 13, 23, 19, 3, 23, 75, 9784 }, // š
-    { 19, 26, 27, 4, 21, 124, 9859 }, // Ţ
-    { 12, 24, 18, 3, 19, 72, 9983 }, // ţ
-    { 19, 29, 27, 4, 29, 138, 10055 }, // Ť
-    { 12, 21, 18, 3, 21, 63, 10193 }, // ť
-    { 19, 21, 27, 4, 21, 100, 10256 }, // Ŧ
-    { 12, 19, 18, 2, 19, 57, 10356 }, // ŧ
-    { 18, 31, 26, 4, 30, 140, 10413 }, // Ũ
-    { 14, 23, 20, 3, 22, 81, 10553 }, // ũ
-    { 18, 29, 26, 4, 28, 131, 10634 }, // Ū
-    { 14, 21, 20, 3, 20, 74, 10765 }, // ū
-    { 18, 32, 26, 4, 31, 144, 10839 }, // Ŭ
-    { 14, 24, 20, 3, 23, 84, 10983 }, // ŭ
-    { 18, 32, 26, 4, 31, 144, 11067 }, // Ů
-    { 14, 24, 20, 3, 23, 84, 11211 }, // ů
-    { 20, 31, 26, 4, 30, 155, 11295 }, // Ű
-    { 19, 23, 20, 1, 22, 110, 11450 }, // ű
-    { 18, 27, 26, 4, 22, 122, 11560 }, // Ų
-    { 14, 20, 20, 3, 14, 70, 11682 }, // ų
-    { 27, 28, 36, 4, 28, 189, 11752 }, // Ŵ
-    { 20, 22, 26, 3, 22, 110, 11941 }, // ŵ
-    { 18, 30, 27, 4, 30, 135, 12051 }, // Ŷ
-    { 15, 31, 21, 3, 24, 117, 12186 }, // ŷ
-    { 18, 30, 27, 4, 30, 135, 12303 }, // Ÿ
-    { 20, 30, 28, 4, 30, 150, 12438 }, // Ź
-    { 14, 23, 20, 3, 23, 81, 12588 }, // ź
-    { 20, 29, 28, 4, 29, 145, 12669 }, // Ż
-    { 14, 22, 20, 3, 22, 77, 12814 }, // ż
-    { 20, 30, 28, 4, 30, 150, 12891 }, // Ž
-    { 14, 23, 20, 3, 23, 81, 13041 }, // ž
-    { 9, 20, 13, 3, 20, 45, 13122 }, // ſ
-    { 8, 4, 0, 1, 19, 8, 0 }, // ̀
-    { 5, 5, 0, 1, 19, 7, 8 }, // ́
-    { 11, 5, 0, 1, 0, 14, 15 }, // ̂
-    { 10, 5, 0, 1, 19, 13, 29 }, // ̃
-    { 12, 4, 0, 2, 17, 12, 42 }, // ̄
-    { 17, 3, 0, 1, 22, 13, 54 }, // ̅
-    { 11, 5, 0, 1, 18, 14, 67 }, // ̆
-    { 5, 5, 0, 1, 20, 7, 81 }, // ̇
-    { 12, 5, 0, 1, 20, 15, 88 }, // ̈
-    { 6, 5, 0, 0, 16, 8, 103 }, // ̉
-    { 6, 5, 0, 1, 19, 8, 111 }, // ̊
-    { 19, 4, 0, 1, 19, 19, 119 }, // ̋
-    { 11, 5, 0, 1, 19, 14, 138 }, // ̌
-    { 19, 4, 0, -5, 20, 19, 152 }, // ̏
-    { 6, 8, 0, 1, 19, 12, 171 }, // ̒
-    { 6, 7, 0, 1, 18, 11, 183 }, // ̓
-    { 6, 7, 0, 1, 18, 11, 194 }, // ̔
-    { 5, 6, 0, 1, -1, 8, 205 }, // ̘
-    { 5, 6, 0, 1, -1, 8, 213 }, // ̙
-    { 11, 6, 0, 1, 20, 17, 221 }, // ̚
-    { 4, 6, 0, 1, 16, 6, 238 }, // ̛
-    { 4, 5, 0, 1, -2, 5, 244 }, // ̜
-    { 7, 4, 0, 1, 3, 7, 249 }, // ̝
-    { 7, 4, 0, 1, -1, 7, 256 }, // ̞
-    { 6, 5, 0, 1, -2, 8, 263 }, // ̟
-    { 13, 4, 0, 1, -3, 13, 271 }, // ̠
-    { 5, 5, 0, 1, 1, 7, 284 }, // ̣
-    { 12, 5, 0, 1, 0, 15, 291 }, // ̤
-    { 6, 5, 0, 1, 19, 8, 306 }, // ̥
-    { 6, 8, 0, 1, 4, 12, 314 }, // ̦
-    { 6, 7, 0, 1, 1, 11, 326 }, // ̧
-    { 6, 7, 0, 1, 1, 11, 337 }, // ̨
-    { 4, 7, 0, 1, -1, 7, 348 }, // ̩
-    { 9, 4, 0, 1, -1, 9, 355 }, // ̪
-    { 11, 5, 0, 1, 0, 14, 364 }, // ̬
-    { 11, 5, 0, 1, -1, 14, 378 }, // ̭
-    { 10, 5, 0, 1, 19, 13, 392 }, // ̰
-    { 10, 3, 0, 1, 18, 8, 405 }, // ̱
-    { 11, 3, 0, 1, -2, 9, 413 }, // ̲
-    { 10, 5, 0, 1, 19, 13, 422 }, // ̴
-    { 13, 3, 0, 1, 9, 10, 435 }, // ̵
-    { 4, 5, 0, 1, -2, 5, 445 }, // ̹
-    { 9, 4, 0, 1, -1, 9, 450 }, // ̺
-    { 8, 7, 0, 1, 0, 14, 459 }, // ̻
-    { 9, 5, 0, 1, 0, 12, 473 }, // ̼
-    { 6, 5, 0, 2, 19, 8, 485 }, // ̽
-    { 10, 5, 0, 1, 19, 13, 493 }, // ͂
-    { 4, 5, 0, 1, 21, 5, 506 }, // ̓
-    { 12, 11, 0, 1, 26, 33, 511 }, // ̈́
-    { 9, 5, 0, 1, 20, 12, 544 }, // ͆
-    { 13, 9, 0, 1, 0, 30, 556 }, // ͇
-    { 10, 7, 0, 1, 0, 18, 586 }, // ͈
-    { 8, 7, 0, 1, -1, 14, 604 }, // ͉
-    { 10, 15, 0, 1, 24, 38, 618 }, // ͊
-    { 20, 11, 0, 1, 22, 55, 656 }, // ͋
-    { 15, 13, 0, 2, 14, 49, 711 }, // ͌
-    { 13, 5, 0, 2, -3, 17, 760 }, // ͍
-    { 4, 4, 0, 1, 3, 4, 777 }, // ͎
-    { 21, 5, 0, 1, 0, 27, 781 }, // ͜
-    { 21, 5, 0, 1, 19, 27, 808 }, // ͡
-    { 25, 6, 0, 1, -2, 38, 835 }, // ͢
-    { 13, 25, 16, 1, 25, 82, 0 }, // Ѐ
-    { 13, 24, 16, 1, 24, 78, 82 }, // Ё
-    { 20, 21, 26, 3, 21, 105, 160 }, // Ђ
-    { 14, 29, 16, 1, 29, 102, 265 }, // Ѓ
-    { 18, 20, 23, 3, 19, 90, 367 }, // Є
-    { 20, 23, 28, 4, 22, 115, 457 }, // Ѕ
-    { 5, 22, 11, 3, 22, 28, 572 }, // І
-    { 12, 31, 11, -1, 31, 93, 600 }, // Ї
-    { 11, 28, 19, 4, 22, 77, 693 }, // Ј
-    { 25, 19, 29, 2, 18, 119, 770 }, // Љ
-    { 24, 19, 28, 2, 19, 114, 889 }, // Њ
-    { 21, 22, 27, 4, 22, 116, 1003 }, // Ћ
-    { 17, 29, 26, 4, 29, 124, 1119 }, // Ќ
-    { 19, 28, 27, 4, 28, 133, 1243 }, // Ѝ
-    { 15, 30, 17, 1, 28, 113, 1376 }, // Ў
-    { 15, 23, 18, 1, 18, 87, 1489 }, // Џ
-    { 20, 21, 28, 4, 21, 105, 1576 }, // А
-    { 14, 18, 16, 1, 18, 63, 1681 }, // Б
-    { 15, 18, 17, 1, 18, 68, 1744 }, // В
-    { 14, 19, 16, 1, 19, 67, 1812 }, // Г
-    { 18, 22, 21, 1, 19, 99, 1879 }, // Д
-    { 13, 19, 16, 1, 19, 62, 1978 }, // Е
-    { 27, 21, 36, 4, 21, 142, 2040 }, // Ж
-    { 13, 19, 16, 1, 19, 62, 2182 }, // З
-    { 19, 22, 27, 4, 22, 105, 2244 }, // И
-    { 19, 30, 27, 4, 30, 143, 2349 }, // Й
-    { 17, 21, 26, 4, 21, 90, 2492 }, // К
-    { 15, 20, 19, 2, 19, 75, 2582 }, // Л
-    { 19, 19, 21, 1, 19, 91, 2657 }, // М
-    { 19, 22, 27, 4, 22, 105, 2748 }, // Н
-    { 20, 22, 29, 4, 21, 110, 2853 }, // О
-    { 14, 19, 17, 1, 19, 67, 2963 }, // П
-    { 15, 21, 23, 4, 21, 79, 3030 }, // Р
-    { 18, 23, 25, 3, 22, 104, 3109 }, // С
-    { 19, 21, 27, 4, 21, 100, 3213 }, // Т
-    { 15, 22, 17, 1, 20, 83, 3313 }, // У
-    { 19, 19, 22, 1, 19, 91, 3396 }, // Ф
-    { 20, 22, 28, 4, 22, 110, 3487 }, // Х
-    { 15, 23, 18, 1, 19, 87, 3597 }, // Ц
-    { 14, 19, 17, 1, 19, 67, 3684 }, // Ч
-    { 18, 19, 20, 1, 19, 86, 3751 }, // Ш
-    { 20, 23, 23, 1, 19, 115, 3837 }, // Щ
-    { 17, 19, 17, -2, 19, 81, 3952 }, // Ъ
-    { 23, 19, 28, 2, 19, 110, 4033 }, // Ы
-    { 13, 19, 17, 2, 19, 62, 4143 }, // Ь
-    { 18, 20, 23, 2, 19, 90, 4205 }, // Э
-    { 21, 18, 25, 2, 18, 95, 4295 }, // Ю
-    { 16, 22, 24, 4, 22, 88, 4390 }, // Я
-    { 14, 15, 21, 3, 15, 53, 4478 }, // а
-    { 15, 20, 18, 1, 20, 75, 4531 }, // б
-    { 12, 15, 18, 3, 15, 45, 4606 }, // в
-    { 12, 14, 15, 1, 14, 42, 4651 }, // г
-    { 17, 17, 19, 1, 14, 73, 4693 }, // д
-    { 14, 15, 21, 3, 15, 53, 4766 }, // е
-    { 23, 18, 30, 3, 18, 104, 4819 }, // ж
-    { 9, 14, 11, 1, 14, 32, 4923 }, // з
-    { 14, 15, 17, 1, 15, 53, 4955 }, // и
-    { 14, 19, 17, 1, 19, 67, 5008 }, // й
-    { 14, 15, 20, 3, 15, 53, 5075 }, // к
-    { 10, 14, 13, 1, 13, 35, 5128 }, // л
-    { 17, 16, 23, 3, 16, 68, 5163 }, // м
-    { 15, 16, 23, 4, 16, 60, 5231 }, // н
-    { 14, 14, 17, 1, 14, 49, 5291 }, // о
-    { 14, 14, 17, 1, 14, 49, 5340 }, // п
-    { 15, 21, 20, 2, 14, 79, 5389 }, // р
-    { 12, 16, 19, 3, 15, 48, 5468 }, // с
-    { 15, 14, 17, 1, 14, 53, 5516 }, // т
-    { 15, 21, 21, 3, 14, 79, 5569 }, // у
-    { 19, 20, 22, 1, 14, 95, 5648 }, // ф
-    { 15, 14, 18, 1, 14, 53, 5743 }, // х
-    { 15, 18, 18, 1, 14, 68, 5796 }, // ц
-    { 9, 13, 11, 1, 13, 30, 5864 }, // ч
-    { 18, 14, 20, 1, 14, 63, 5894 }, // ш
-    { 20, 19, 22, 1, 14, 95, 5957 }, // щ
-    { 16, 14, 19, 1, 14, 56, 6052 }, // ъ
-    { 18, 14, 20, 1, 14, 63, 6108 }, // ы
-    { 13, 14, 15, 1, 14, 46, 6171 }, // ь
-    { 14, 14, 16, 1, 14, 49, 6217 }, // э
-    { 16, 15, 20, 2, 15, 60, 6266 }, // ю
-    { 13, 14, 16, 1, 14, 46, 6326 }, // я
-    { 14, 24, 21, 3, 24, 84, 6372 }, // ѐ
-    { 14, 20, 17, 1, 19, 70, 6456 }, // ё
-    { 17, 25, 21, 1, 21, 107, 6526 }, // ђ
-    { 12, 21, 15, 1, 21, 63, 6633 }, // ѓ
-    { 12, 14, 16, 2, 13, 42, 6696 }, // є
-    { 13, 14, 19, 3, 14, 46, 6738 }, // ѕ
-    { 5, 22, 11, 3, 22, 28, 6784 }, // і
-    { 12, 22, 11, -1, 22, 66, 6812 }, // ї
-    { 10, 27, 16, 3, 21, 68, 6878 }, // ј
-    { 17, 14, 20, 2, 13, 60, 6946 }, // љ
-    { 16, 14, 19, 2, 14, 56, 7006 }, // њ
-    { 16, 21, 21, 1, 21, 84, 7062 }, // ћ
-    { 14, 22, 20, 3, 22, 77, 7146 }, // ќ
-    { 14, 21, 17, 1, 21, 74, 7223 }, // ѝ
-    { 15, 32, 21, 3, 25, 120, 7297 }, // ў
-    { 11, 17, 13, 1, 13, 47, 7417 }, // џ
-    { 15, 19, 21, 3, 18, 72, 7464 }, // Ѣ
-    { 16, 19, 18, 1, 18, 76, 7536 }, // ѣ
-    { 21, 18, 25, 2, 18, 95, 7612 }, // Ѫ
-    { 14, 13, 18, 2, 13, 46, 7707 }, // ѫ
-    { 18, 23, 27, 4, 22, 104, 7753 }, // Ѳ
-    { 14, 17, 21, 3, 17, 60, 7857 }, // ѳ
-    { 26, 28, 29, 4, 28, 182, 7917 }, // Ѵ
-    { 16, 17, 20, 3, 17, 68, 8099 }, // ѵ
-    { 9, 8, 0, 1, 23, 18, 8167 }, // ҆
-    { 14, 21, 16, 1, 21, 74, 8185 }, // Ґ
-    { 12, 17, 15, 1, 17, 51, 8259 }, // ґ
-    { 15, 19, 16, 0, 19, 72, 8310 }, // Ғ
-    { 10, 13, 11, 0, 13, 33, 8382 }, // ғ
-    { 15, 20, 17, 1, 20, 75, 8415 }, // Ҕ
-    { 9, 13, 11, 1, 13, 30, 8490 }, // ҕ
-    { 28, 25, 32, 2, 21, 175, 8520 }, // Җ
-    { 18, 18, 22, 2, 15, 81, 8695 }, // җ
-    { 13, 22, 18, 2, 19, 72, 8776 }, // Ҙ
-    { 9, 20, 11, 1, 14, 45, 8848 }, // ҙ
-    { 18, 24, 22, 2, 21, 108, 8893 }, // Қ
-    { 12, 18, 15, 2, 15, 54, 9001 }, // қ
-    { 20, 19, 24, 2, 19, 95, 9055 }, // Ҝ
-    { 14, 13, 18, 2, 13, 46, 9150 }, // ҝ
-    { 17, 21, 26, 4, 21, 90, 9196 }, // Ҟ
-    { 17, 21, 20, 0, 21, 90, 9286 }, // ҟ
-    { 23, 21, 26, -2, 21, 121, 9376 }, // Ҡ
-    { 17, 15, 17, -2, 15, 64, 9497 }, // ҡ
-    { 19, 25, 23, 2, 22, 119, 9561 }, // Ң
-    { 13, 17, 16, 2, 15, 56, 9680 }, // ң
-    { 26, 22, 27, 4, 22, 143, 9736 }, // Ҥ
-    { 18, 15, 18, 3, 15, 68, 9879 }, // ҥ
-    { 25, 21, 29, 2, 21, 132, 9947 }, // Ҧ
-    { 23, 23, 27, 2, 16, 133, 10079 }, // ҧ
-    { 25, 22, 30, 2, 21, 138, 10212 }, // Ҩ
-    { 19, 17, 23, 2, 16, 81, 10350 }, // ҩ
-    { 18, 27, 25, 3, 22, 122, 10431 }, // Ҫ
-    { 12, 19, 19, 3, 15, 57, 10553 }, // ҫ
-    { 19, 24, 23, 2, 21, 114, 10610 }, // Ҭ
-    { 13, 17, 16, 2, 15, 56, 10724 }, // ҭ
-    { 18, 21, 27, 4, 21, 95, 10780 }, // Ү
-    { 14, 18, 17, 1, 13, 63, 10875 }, // ү
-    { 18, 21, 27, 4, 21, 95, 10938 }, // Ұ
-    { 14, 19, 17, 1, 13, 67, 11033 }, // ұ
-    { 21, 26, 25, 2, 22, 137, 11100 }, // Ҳ
-    { 14, 18, 17, 2, 15, 63, 11237 }, // ҳ
-    { 22, 23, 27, 2, 18, 127, 11300 }, // Ҵ
-    { 15, 17, 19, 2, 13, 64, 11427 }, // ҵ
-    { 17, 24, 21, 1, 18, 102, 11491 }, // Ҷ
-    { 12, 17, 15, 1, 13, 51, 11593 }, // ҷ
-    { 14, 19, 18, 2, 19, 67, 11644 }, // Ҹ
-    { 10, 13, 12, 1, 13, 33, 11711 }, // ҹ
-    { 14, 21, 19, 2, 21, 74, 11744 }, // Һ
-    { 14, 21, 21, 3, 21, 74, 11818 }, // һ
-    { 22, 20, 24, 0, 19, 110, 11892 }, // Ҽ
-    { 16, 14, 17, 0, 14, 56, 12002 }, // ҽ
-    { 23, 23, 27, 2, 19, 133, 12058 }, // Ҿ
-    { 16, 17, 20, 2, 14, 68, 12191 }, // ҿ
-    { 5, 22, 11, 3, 22, 28, 12259 }, // Ӏ
-    { 27, 30, 36, 4, 30, 203, 12287 }, // Ӂ
-    { 23, 27, 30, 3, 27, 156, 12490 }, // ӂ
-    { 15, 25, 20, 2, 19, 94, 12646 }, // Ӄ
-    { 10, 17, 13, 2, 13, 43, 12740 }, // ӄ
-    { 18, 24, 19, 2, 19, 108, 12783 }, // Ӆ
-    { 13, 16, 13, 1, 13, 52, 12891 }, // ӆ
-    { 20, 28, 27, 4, 22, 140, 12943 }, // Ӈ
-    { 14, 20, 18, 3, 15, 70, 13083 }, // ӈ
-    { 20, 29, 27, 4, 22, 145, 13153 }, // Ӊ
-    { 13, 20, 19, 3, 15, 65, 13298 }, // ӊ
-    { 14, 23, 17, 0, 18, 81, 13363 }, // Ӌ
-    { 10, 16, 13, 1, 13, 40, 13444 }, // ӌ
-    { 25, 29, 31, 4, 22, 182, 13484 }, // Ӎ
-    { 17, 20, 21, 3, 15, 85, 13666 }, // ӎ
-    { 5, 18, 7, 1, 18, 23, 13751 }, // ӏ
-    { 20, 30, 28, 4, 30, 150, 13774 }, // Ӑ
-    { 14, 23, 21, 3, 23, 81, 13924 }, // ӑ
-    { 20, 29, 28, 4, 29, 145, 14005 }, // Ӓ
-    { 14, 21, 21, 3, 21, 74, 14150 }, // ӓ
-    { 28, 23, 36, 4, 22, 161, 14224 }, // Ӕ
-    { 24, 15, 31, 3, 15, 90, 14385 }, // ӕ
-    { 13, 26, 16, 1, 26, 85, 14475 }, // Ӗ
-    { 14, 25, 21, 3, 25, 88, 14560 }, // ӗ
-    { 14, 15, 21, 3, 14, 53, 14648 }, // Ә
-    { 14, 16, 21, 4, 15, 56, 14701 }, // ә
-    { 14, 26, 21, 3, 25, 91, 14757 }, // Ӛ
-    { 14, 17, 21, 4, 15, 60, 14848 }, // ӛ
-    { 27, 29, 33, 4, 29, 196, 14908 }, // Ӝ
-    { 23, 26, 30, 3, 26, 150, 15104 }, // ӝ
-    { 13, 26, 16, 1, 26, 85, 15254 }, // Ӟ
-    { 12, 21, 11, 1, 21, 63, 15339 }, // ӟ
-    { 12, 19, 15, 2, 18, 57, 15402 }, // Ӡ
-    { 12, 19, 15, 2, 13, 57, 15459 }, // ӡ
-    { 19, 27, 27, 4, 27, 129, 15516 }, // Ӣ
-    { 14, 20, 17, 1, 20, 70, 15645 }, // ӣ
-    { 19, 28, 27, 4, 28, 133, 15715 }, // Ӥ
-    { 14, 21, 17, 1, 21, 74, 15848 }, // ӥ
-    { 20, 29, 29, 4, 28, 145, 15922 }, // Ӧ
-    { 14, 22, 17, 1, 22, 77, 16067 }, // ӧ
-    { 18, 19, 27, 4, 18, 86, 16144 }, // Ө
-    { 14, 14, 21, 3, 14, 49, 16230 }, // ө
-    { 18, 30, 27, 4, 29, 135, 16279 }, // Ӫ
-    { 14, 23, 21, 3, 23, 81, 16414 }, // ӫ
-    { 18, 28, 23, 2, 27, 126, 16495 }, // Ӭ
-    { 14, 21, 16, 1, 21, 74, 16621 }, // ӭ
-    { 15, 28, 17, 1, 26, 105, 16695 }, // Ӯ
-    { 15, 29, 21, 3, 22, 109, 16800 }, // ӯ
-    { 15, 29, 17, 1, 27, 109, 16909 }, // Ӱ
-    { 15, 31, 21, 3, 24, 117, 17018 }, // ӱ
-    { 19, 29, 17, 0, 27, 138, 17135 }, // Ӳ
-    { 19, 31, 21, 2, 24, 148, 17273 }, // ӳ
-    { 14, 26, 17, 1, 26, 91, 17421 }, // Ӵ
-    { 12, 21, 11, -1, 21, 63, 17512 }, // ӵ
-    { 14, 23, 16, 1, 19, 81, 17575 }, // Ӷ
-    { 9, 16, 11, 1, 13, 36, 17656 }, // ӷ
-    { 23, 28, 28, 2, 28, 161, 17692 }, // Ӹ
-    { 18, 23, 20, 1, 23, 104, 17853 }, // ӹ
-    { 24, 25, 28, 4, 22, 150, 17957 }, // Ӽ
-    { 17, 17, 20, 3, 15, 73, 18107 }, // ӽ
-    { 0, 0, 21, 0, 0, 0, 0 }, //  
-    { 0, 0, 33, 0, 0, 0, 0 }, //  
-    { 0, 0, 21, 0, 0, 0, 0 }, //  
-    { 0, 0, 33, 0, 0, 0, 0 }, //  
-    { 0, 0, 16, 0, 0, 0, 0 }, //  
-    { 0, 0, 14, 0, 0, 0, 0 }, //  
-    { 0, 0, 12, 0, 0, 0, 0 }, //  
-    { 0, 0, 17, 0, 0, 0, 0 }, //  
-    { 0, 0, 7, 0, 0, 0, 0 }, //  
-    { 0, 0, 13, 0, 0, 0, 0 }, //  
-    { 0, 0, 12, 0, 0, 0, 0 }, //  
-    { 0, 0, 8, 0, 0, 0, 0 }, // ​
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‍
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‎
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‏
-    { 13, 3, 14, 1, 9, 10, 0 }, // ‐
-    { 13, 3, 14, 1, 9, 10, 10 }, // ‑
-    { 18, 3, 19, 1, 9, 14, 20 }, // ‒
-    { 17, 4, 20, 1, 9, 17, 34 }, // –
-    { 26, 4, 28, 1, 9, 26, 51 }, // —
-    { 26, 4, 28, 1, 9, 26, 77 }, // ―
-    { 11, 22, 14, 1, 18, 61, 103 }, // ‖
-    { 19, 8, 20, 1, -2, 38, 164 }, // ‗
-    { 6, 7, 8, 1, 21, 11, 202 }, // ‘
-    { 6, 7, 8, 1, 21, 11, 213 }, // ’
-    { 6, 8, 8, 1, 4, 12, 224 }, // ‚
-    { 6, 7, 8, 1, 21, 11, 236 }, // ‛
-    { 12, 7, 14, 1, 21, 21, 247 }, // “
-    { 12, 7, 14, 1, 21, 21, 268 }, // ”
-    { 6, 8, 8, 1, 4, 12, 289 }, // „
-    { 13, 8, 14, 1, 21, 26, 301 }, // ‟
-    { 14, 33, 15, 0, 26, 116, 327 }, // †
-    { 13, 33, 15, 1, 26, 108, 443 }, // ‡
-    { 15, 15, 13, -1, 18, 57, 551 }, // •
-    { 7, 8, 10, 1, 11, 14, 608 }, // ‣
-    { 5, 5, 7, 1, 5, 7, 622 }, // ․
-    { 5, 5, 7, 1, 5, 7, 629 }, // ‥
-    { 22, 5, 24, 1, 5, 28, 636 }, // …
-    { 4, 3, 6, 1, 9, 3, 664 }, // ‧
-    { 0, 0, 32, 0, 0, 0, 667 }, //  
-    { 16, 22, 28, 6, 20, 88, 667 }, // ‰
-    { 6, 7, 8, 1, 21, 11, 755 }, // ′
-    { 12, 7, 14, 1, 21, 21, 766 }, // ″
-    { 19, 8, 21, 1, 21, 38, 787 }, // ‴
-    { 6, 7, 8, 1, 21, 11, 825 }, // ‵
-    { 12, 7, 13, 0, 21, 21, 836 }, // ‶
-    { 19, 8, 21, 1, 21, 38, 857 }, // ‷
-    { 11, 5, 14, 1, 20, 14, 895 }, // ‸
-    { 8, 12, 10, 1, 13, 24, 909 }, // ‹
-    { 8, 12, 10, 1, 13, 24, 933 }, // ›
-    { 26, 26, 33, 5, 23, 169, 957 }, // ※
-    { 6, 25, 8, 1, 25, 38, 1126 }, // ‼
-    { 14, 31, 19, 2, 30, 109, 1164 }, // ‽
-    { 13, 3, 14, 1, 21, 10, 1273 }, // ‾
-    { 11, 5, 14, 1, 17, 14, 1283 }, // ‿
-    { 17, 16, 20, 1, 22, 68, 1297 }, // ⁂
-    { 15, 20, 28, 6, 19, 75, 1365 }, // ⁄
-    { 28, 28, 32, 2, 28, 196, 1440 }, // ⁇
-    { 19, 28, 25, 2, 28, 133, 1636 }, // ⁈
-    { 19, 30, 20, 1, 28, 143, 1769 }, // ⁉
-    { 15, 39, 19, 2, 27, 147, 1912 }, // ⁒
-    { 0, 0, 121, 0, 0, 0, 2059 }, //  
-    { 7, 10, 8, 0, 21, 18, 0 }, // ⁰
-    { 8, 10, 8, 0, 21, 20, 18 }, // ⁴
-    { 6, 10, 8, 1, 21, 15, 38 }, // ⁵
-    { 8, 9, 8, 0, 20, 18, 53 }, // ⁶
-    { 7, 10, 8, 1, 21, 18, 71 }, // ⁷
-    { 8, 10, 8, 0, 21, 20, 89 }, // ⁸
-    { 8, 9, 8, 0, 20, 18, 109 }, // ⁹
-    { 14, 14, 20, 3, 14, 49, 127 }, // ⁿ
-    { 9, 13, 11, 1, 13, 30, 176 }, // ₀
-    { 6, 10, 8, 1, 6, 15, 206 }, // ₁
-    { 7, 10, 8, 1, 6, 18, 221 }, // ₂
-    { 8, 9, 8, 0, 5, 18, 239 }, // ₃
-    { 8, 10, 8, 0, 6, 20, 257 }, // ₄
-    { 7, 10, 8, 0, 6, 18, 277 }, // ₅
-    { 8, 9, 8, 0, 5, 18, 295 }, // ₆
-    { 7, 11, 8, 1, 6, 20, 313 }, // ₇
-    { 8, 10, 8, 0, 6, 20, 333 }, // ₈
-    { 8, 9, 8, 0, 5, 18, 353 }, // ₉
-    { 8, 34, 11, 2, 25, 68, 371 }, // ₍
-    { 8, 34, 11, 1, 25, 68, 439 }, // ₎
-    { 17, 31, 25, 4, 26, 132, 0 }, // ₡
-    { 18, 23, 25, 3, 22, 104, 132 }, // ₢
-    { 16, 24, 17, 1, 24, 96, 236 }, // ₤
-    { 24, 22, 27, 2, 22, 132, 332 }, // ₦
-    { 20, 21, 23, 1, 21, 105, 464 }, // ₧
-    { 25, 21, 28, 3, 21, 132, 569 }, // ₨
-    { 19, 21, 21, 1, 21, 100, 701 }, // ₩
-    { 20, 19, 27, 3, 19, 95, 801 }, // ₪
-    { 17, 20, 17, 1, 20, 85, 896 }, // ₫
-    { 15, 23, 19, 2, 20, 87, 981 }, // €
-    { 19, 21, 27, 4, 21, 100, 1068 }, // ₮
-    { 22, 21, 16, 0, 21, 116, 1168 }, // ₱
-    { 20, 30, 29, 4, 26, 150, 1284 }, // ₲
-    { 23, 23, 23, 1, 22, 133, 1434 }, // ₴
-    { 12, 18, 19, 3, 17, 54, 1567 }, // ₵
-    { 19, 22, 27, 4, 22, 105, 1621 }, // ₸
-    { 13, 20, 15, 1, 19, 65, 1726 }, // ₹
-    { 15, 18, 17, 1, 17, 68, 1791 }, // ₺
-    { 16, 19, 16, 0, 19, 76, 1859 }, // ₼
-    { 20, 21, 23, -1, 21, 105, 1935 }, // ₽
-    { 16, 16, 19, 1, 14, 64, 0 }, // ←
-    { 17, 15, 19, 1, 15, 64, 64 }, // ↑
-    { 16, 16, 19, 1, 14, 64, 128 }, // →
-    { 17, 15, 19, 1, 15, 64, 192 }, // ↓
-    { 20, 14, 22, 1, 14, 70, 256 }, // ↔
-    { 14, 19, 16, 1, 20, 67, 326 }, // ↕
-    { 13, 12, 16, 1, 13, 39, 393 }, // ↖
-    { 13, 12, 16, 1, 13, 39, 432 }, // ↗
-    { 13, 13, 16, 1, 14, 43, 471 }, // ↘
-    { 13, 13, 16, 1, 14, 43, 514 }, // ↙
-    { 19, 16, 21, 1, 15, 76, 557 }, // ⇐
-    { 20, 18, 23, 1, 18, 90, 633 }, // ⇑
-    { 19, 16, 21, 1, 15, 76, 723 }, // ⇒
-    { 20, 19, 23, 1, 18, 95, 799 }, // ⇓
-    { 22, 16, 24, 1, 15, 88, 894 }, // ⇔
-    { 17, 21, 19, 1, 14, 90, 982 }, // ⇕
-    { 15, 20, 17, 1, 20, 75, 0 }, // ∂
-    { 25, 23, 29, 2, 22, 144, 75 }, // ∅
-    { 19, 19, 22, 1, 19, 91, 219 }, // ∆
-    { 16, 18, 18, 1, 18, 72, 310 }, // ∏
-    { 16, 18, 18, 1, 18, 72, 382 }, // ∐
-    { 12, 19, 15, 1, 18, 57, 454 }, // ∑
-    { 13, 4, 15, 1, 9, 13, 511 }, // −
-    { 21, 21, 23, 1, 20, 111, 524 }, // √
-    { 20, 12, 23, 1, 15, 60, 635 }, // ∞
-    { 21, 28, 21, 0, 22, 147, 695 }, // ∫
-    { 5, 15, 7, 1, 15, 19, 842 }, // ∶
-    { 15, 13, 19, 2, 14, 49, 861 }, // ≈
-    { 16, 22, 28, 6, 20, 88, 910 }, // ≠
-    { 19, 19, 22, 1, 18, 91, 998 }, // ≤
-    { 19, 19, 22, 1, 18, 91, 1089 }, // ≥
+    { 13, 12, 16, 1, 12, 39, 6592 }, // «
+    { 13, 8, 15, 1, 9, 26, 509 }, // ¬
+    { 13, 3, 14, 1, 9, 10, 535 }, // ­
+    { 11, 10, 13, 1, 27, 28, 545 }, // ®
+    { 10, 3, 13, 1, 18, 8, 573 }, // ¯
+    { 12, 12, 13, 1, 20, 36, 581 }, // °
+    { 13, 14, 16, 1, 13, 46, 617 }, // ±
+    { 7, 9, 7, 0, 20, 16, 663 }, // ²
+    { 7, 10, 8, 0, 20, 18, 679 }, // ³
+    { 5, 5, 7, 1, 19, 7, 697 }, // ´
+    { 15, 17, 20, 2, 14, 64, 704 }, // µ
+    { 13, 21, 15, 1, 18, 69, 768 }, // ¶
+    { 5, 5, 7, 1, 11, 7, 837 }, // ·
+    { 6, 7, 8, 1, 1, 11, 844 }, // ¸
+    { 7, 10, 7, 0, 21, 18, 855 }, // ¹
+    { 8, 8, 11, 2, 18, 16, 873 }, // º
+    { 13, 12, 16, 1, 12, 39, 6631 }, // »
+    { 21, 24, 28, 4, 22, 126, 889 }, // ¼
+    { 22, 23, 28, 4, 21, 127, 1015 }, // ½
+    { 22, 24, 28, 3, 22, 132, 1142 }, // ¾
+    { 14, 28, 14, 0, 15, 98, 1274 }, // ¿
+    { 20, 28, 28, 4, 28, 140, 6670 }, // À
+    { 20, 33, 28, 4, 33, 165, 6810 }, // Á
+    { 20, 29, 28, 4, 29, 145, 6975 }, // Â
+    { 20, 29, 28, 4, 29, 145, 1372 }, // Ã
+    { 20, 29, 28, 4, 29, 145, 7120 }, // Ä
+    { 20, 30, 28, 4, 30, 150, 1517 }, // Å
+    { 28, 23, 36, 4, 22, 161, 1667 }, // Æ
+    { 18, 28, 25, 3, 22, 126, 7265 }, // Ç
+    { 15, 28, 23, 4, 28, 105, 7391 }, // È
+    { 15, 32, 23, 4, 32, 120, 7496 }, // É
+    { 15, 29, 23, 4, 29, 109, 7616 }, // Ê
+    { 15, 29, 23, 4, 29, 109, 7725 }, // Ë
+    { 8, 30, 11, 0, 30, 60, 7834 }, // Ì
+    { 5, 34, 11, 3, 34, 43, 7894 }, // Í
+    { 10, 31, 11, 0, 31, 78, 7937 }, // Î
+    { 12, 30, 11, -1, 30, 90, 8015 }, // Ï
+    { 23, 22, 27, 1, 22, 127, 1828 }, // Ð
+    { 19, 27, 27, 4, 27, 129, 8105 }, // Ñ
+    { 20, 28, 29, 4, 27, 140, 8234 }, // Ò
+    { 20, 32, 29, 4, 31, 160, 8374 }, // Ó
+    { 20, 29, 29, 4, 28, 145, 8534 }, // Ô
+    { 20, 28, 29, 4, 27, 140, 1955 }, // Õ
+    { 20, 29, 29, 4, 28, 145, 8679 }, // Ö
+    { 12, 7, 15, 1, 10, 21, 2095 }, // ×
+    { 31, 45, 30, -1, 33, 349, 2116 }, // Ø
+    { 18, 30, 26, 4, 29, 135, 8824 }, // Ù
+    { 18, 34, 26, 4, 33, 153, 8959 }, // Ú
+    { 18, 31, 26, 4, 30, 140, 9112 }, // Û
+    { 18, 30, 26, 4, 29, 135, 9252 }, // Ü
+    { 18, 33, 27, 4, 33, 149, 2465 }, // Ý
+    { 12, 20, 14, 1, 20, 60, 2614 }, // Þ
+    { 15, 20, 17, 1, 20, 75, 2674 }, // ß
+    { 14, 20, 21, 3, 20, 70, 9387 }, // à
+    { 14, 24, 21, 3, 24, 84, 9457 }, // á
+    { 14, 21, 21, 3, 21, 74, 9541 }, // â
+    { 14, 20, 21, 3, 20, 70, 2749 }, // ã
+    { 14, 20, 21, 3, 20, 70, 9615 }, // ä
+    { 14, 22, 21, 3, 22, 77, 2819 }, // å
+    { 24, 15, 31, 3, 15, 90, 2896 }, // æ
+    { 12, 21, 19, 3, 15, 63, 9685 }, // ç
+    { 14, 23, 21, 3, 23, 81, 9748 }, // è
+    { 14, 27, 21, 3, 27, 95, 9829 }, // é
+    { 14, 24, 21, 3, 24, 84, 9924 }, // ê
+    { 14, 24, 21, 3, 24, 84, 10008 }, // ë
+    { 9, 21, 11, 0, 21, 48, 10092 }, // ì
+    { 6, 25, 11, 3, 25, 38, 10140 }, // í
+    { 11, 22, 11, 0, 22, 61, 10178 }, // î
+    { 12, 22, 11, -1, 22, 66, 10239 }, // ï
+    { 19, 20, 21, 1, 20, 95, 2986 }, // ð
+    { 14, 21, 20, 3, 21, 74, 10305 }, // ñ
+    { 14, 23, 21, 3, 23, 81, 10379 }, // ò
+    { 14, 27, 21, 3, 27, 95, 10460 }, // ó
+    { 14, 23, 21, 3, 23, 81, 10555 }, // ô
+    { 14, 23, 21, 3, 23, 81, 3081 }, // õ
+    { 14, 23, 21, 3, 23, 81, 10636 }, // ö
+    { 17, 16, 19, 1, 16, 68, 3162 }, // ÷
+    { 14, 39, 21, 3, 26, 137, 3230 }, // ø
+    { 14, 22, 20, 3, 21, 77, 10717 }, // ù
+    { 14, 26, 20, 3, 25, 91, 10794 }, // ú
+    { 14, 23, 20, 3, 22, 81, 10885 }, // û
+    { 14, 22, 20, 3, 21, 77, 10966 }, // ü
+    { 15, 34, 21, 3, 27, 128, 3367 }, // ý
+    { 12, 26, 14, 1, 21, 78, 3495 }, // þ
+    { 15, 30, 21, 3, 23, 113, 3573 }, // ÿ
+    { 20, 28, 28, 4, 28, 140, 3686 }, // Ā
+    { 14, 19, 21, 3, 19, 67, 3826 }, // ā
+    { 20, 31, 28, 4, 31, 155, 3893 }, // Ă
+    { 14, 22, 21, 3, 22, 77, 4048 }, // ă
+    { 20, 27, 28, 4, 21, 135, 4125 }, // Ą
+    { 14, 20, 21, 3, 15, 70, 4260 }, // ą
+    { 18, 33, 25, 3, 32, 149, 4330 }, // Ć
+    { 12, 24, 19, 3, 23, 72, 4479 }, // ć
+    { 18, 31, 25, 3, 30, 140, 4551 }, // Ĉ
+    { 12, 22, 19, 3, 21, 66, 4691 }, // ĉ
+    { 18, 32, 25, 3, 31, 144, 4757 }, // Ċ
+    { 12, 23, 19, 3, 22, 69, 4901 }, // ċ
+    { 18, 33, 25, 3, 32, 149, 4970 }, // Č
+    { 12, 24, 19, 3, 23, 72, 5119 }, // č
+    { 20, 31, 27, 4, 31, 155, 5191 }, // Ď
+    { 20, 22, 21, 3, 21, 110, 5346 }, // ď
+    { 23, 22, 27, 1, 22, 127, 5456 }, // Đ
+    { 19, 22, 21, 3, 21, 105, 5583 }, // đ
+    { 15, 28, 23, 4, 28, 105, 5688 }, // Ē
+    { 14, 23, 21, 3, 23, 81, 5793 }, // ē
+    { 15, 30, 23, 4, 30, 113, 5874 }, // Ĕ
+    { 14, 26, 21, 3, 26, 91, 5987 }, // ĕ
+    { 15, 30, 23, 4, 30, 113, 6078 }, // Ė
+    { 14, 25, 21, 3, 25, 88, 6191 }, // ė
+    { 15, 27, 23, 4, 22, 102, 6279 }, // Ę
+    { 14, 21, 21, 3, 15, 74, 6381 }, // ę
+    { 15, 31, 23, 4, 31, 117, 6455 }, // Ě
+    { 14, 26, 21, 3, 26, 91, 6572 }, // ě
+    { 20, 29, 29, 4, 29, 145, 6663 }, // Ĝ
+    { 14, 28, 20, 3, 21, 98, 6808 }, // ĝ
+    { 20, 31, 29, 4, 31, 155, 6906 }, // Ğ
+    { 14, 30, 20, 3, 23, 105, 7061 }, // ğ
+    { 20, 30, 29, 4, 30, 150, 7166 }, // Ġ
+    { 14, 29, 20, 3, 22, 102, 7316 }, // ġ
+    { 20, 33, 29, 4, 22, 165, 7418 }, // Ģ
+    { 14, 30, 20, 3, 23, 105, 7583 }, // ģ
+    { 19, 29, 27, 4, 29, 138, 7688 }, // Ĥ
+    { 16, 27, 21, 1, 27, 108, 7826 }, // ĥ
+    { 20, 21, 27, 3, 21, 105, 7934 }, // Ħ
+    { 16, 21, 21, 1, 21, 84, 8039 }, // ħ
+    { 10, 31, 11, 0, 31, 78, 8123 }, // Ĩ
+    { 10, 22, 11, 1, 22, 55, 8201 }, // ĩ
+    { 12, 29, 11, -1, 29, 87, 8256 }, // Ī
+    { 12, 20, 11, 0, 20, 60, 8343 }, // ī
+    { 6, 28, 15, 6, 22, 42, 8403 }, // Į
+    { 6, 28, 11, 2, 22, 42, 8445 }, // į
+    { 5, 31, 11, 3, 31, 39, 8487 }, // İ
+    { 5, 14, 11, 3, 14, 18, 8526 }, // ı
+    { 16, 28, 23, 3, 22, 112, 8544 }, // Ĳ
+    { 19, 29, 11, 3, 22, 138, 8656 }, // ĳ
+    { 12, 33, 19, 4, 27, 99, 8794 }, // Ĵ
+    { 13, 27, 16, 3, 21, 88, 8893 }, // ĵ
+    { 17, 30, 26, 4, 21, 128, 8981 }, // Ķ
+    { 14, 31, 20, 3, 20, 109, 9109 }, // ķ
+    { 12, 14, 16, 2, 14, 42, 9218 }, // ĸ
+    { 14, 30, 23, 4, 30, 105, 9260 }, // Ĺ
+    { 7, 29, 14, 3, 29, 51, 9365 }, // ĺ
+    { 14, 33, 23, 4, 22, 116, 9416 }, // Ļ
+    { 7, 32, 14, 3, 21, 56, 9532 }, // ļ
+    { 14, 22, 23, 4, 22, 77, 9588 }, // Ľ
+    { 10, 22, 14, 3, 22, 55, 9665 }, // ľ
+    { 14, 22, 23, 4, 22, 77, 9720 }, // Ŀ
+    { 11, 21, 14, 3, 21, 58, 9797 }, // ŀ
+    { 24, 34, 23, -6, 27, 204, 9855 }, // Ł
+    { 16, 21, 14, -5, 21, 84, 10059 }, // ł
+    { 19, 30, 27, 4, 30, 143, 10143 }, // Ń
+    { 14, 24, 20, 3, 24, 84, 10286 }, // ń
+    { 19, 31, 27, 4, 22, 148, 10370 }, // Ņ
+    { 14, 23, 20, 3, 14, 81, 10518 }, // ņ
+    { 19, 30, 27, 4, 30, 143, 10599 }, // Ň
+    { 14, 24, 20, 3, 24, 84, 10742 }, // ň
+    { 14, 26, 17, 1, 26, 91, 10826 }, // ŉ
+    { 19, 26, 27, 4, 22, 124, 10917 }, // Ŋ
+    { 14, 19, 20, 3, 14, 67, 11041 }, // ŋ
+    { 20, 28, 29, 4, 27, 140, 11108 }, // Ō
+    { 14, 21, 21, 3, 21, 74, 11248 }, // ō
+    { 20, 30, 29, 4, 29, 150, 11322 }, // Ŏ
+    { 14, 25, 21, 3, 25, 88, 11472 }, // ŏ
+    { 21, 29, 29, 4, 28, 153, 11560 }, // Ő
+    { 19, 24, 21, 2, 24, 114, 11713 }, // ő
+    { 29, 21, 30, 4, 21, 153, 11043 }, // Œ
+    { 25, 15, 27, 3, 15, 94, 11196 }, // œ
+    { 16, 29, 24, 4, 29, 116, 11827 }, // Ŕ
+    { 10, 21, 16, 3, 21, 53, 11943 }, // ŕ
+    { 16, 34, 24, 4, 22, 136, 11996 }, // Ŗ
+    { 11, 27, 16, 2, 14, 75, 12132 }, // ŗ
+    { 16, 30, 24, 4, 30, 120, 12207 }, // Ř
+    { 11, 21, 16, 2, 21, 58, 12327 }, // ř
+    { 20, 33, 28, 4, 32, 165, 12385 }, // Ś
+    { 13, 23, 19, 3, 23, 75, 12550 }, // ś
+    { 20, 31, 28, 4, 30, 155, 12625 }, // Ŝ
+    { 13, 21, 19, 3, 21, 69, 12780 }, // ŝ
+    { 20, 28, 28, 4, 22, 140, 12849 }, // Ş
+    { 13, 21, 19, 3, 14, 69, 12989 }, // ş
+    { 20, 33, 28, 4, 32, 165, 13058 }, // Š
+    { 13, 23, 19, 3, 23, 75, 13223 }, // š
+    { 19, 26, 27, 4, 21, 124, 13298 }, // Ţ
+    { 12, 24, 18, 3, 19, 72, 13422 }, // ţ
+    { 19, 29, 27, 4, 29, 138, 13494 }, // Ť
+    { 12, 21, 18, 3, 21, 63, 13632 }, // ť
+    { 19, 21, 27, 4, 21, 100, 13695 }, // Ŧ
+    { 12, 19, 18, 2, 19, 57, 13795 }, // ŧ
+    { 18, 31, 26, 4, 30, 140, 13852 }, // Ũ
+    { 14, 23, 20, 3, 22, 81, 13992 }, // ũ
+    { 18, 29, 26, 4, 28, 131, 14073 }, // Ū
+    { 14, 21, 20, 3, 20, 74, 14204 }, // ū
+    { 18, 32, 26, 4, 31, 144, 14278 }, // Ŭ
+    { 14, 24, 20, 3, 23, 84, 14422 }, // ŭ
+    { 18, 32, 26, 4, 31, 144, 14506 }, // Ů
+    { 14, 24, 20, 3, 23, 84, 14650 }, // ů
+    { 20, 31, 26, 4, 30, 155, 14734 }, // Ű
+    { 19, 23, 20, 1, 22, 110, 14889 }, // ű
+    { 18, 27, 26, 4, 22, 122, 14999 }, // Ų
+    { 14, 20, 20, 3, 14, 70, 15121 }, // ų
+    { 27, 28, 36, 4, 28, 189, 15191 }, // Ŵ
+    { 20, 22, 26, 3, 22, 110, 15380 }, // ŵ
+    { 18, 30, 27, 4, 30, 135, 15490 }, // Ŷ
+    { 15, 31, 21, 3, 24, 117, 15625 }, // ŷ
+    { 18, 30, 27, 4, 30, 135, 15742 }, // Ÿ
+    { 20, 30, 28, 4, 30, 150, 15877 }, // Ź
+    { 14, 23, 20, 3, 23, 81, 16027 }, // ź
+    { 20, 29, 28, 4, 29, 145, 16108 }, // Ż
+    { 14, 22, 20, 3, 22, 77, 16253 }, // ż
+    { 20, 30, 28, 4, 30, 150, 16330 }, // Ž
+    { 14, 23, 20, 3, 23, 81, 16480 }, // ž
+    { 9, 20, 13, 3, 20, 45, 16561 }, // ſ
+    { 8, 4, 0, 1, 19, 8, 16606 }, // ̀
+    { 5, 5, 0, 1, 19, 7, 16614 }, // ́
+    { 11, 5, 0, 1, 0, 14, 16621 }, // ̂
+    { 10, 5, 0, 1, 19, 13, 16635 }, // ̃
+    { 12, 4, 0, 2, 17, 12, 16648 }, // ̄
+    { 17, 3, 0, 1, 22, 13, 16660 }, // ̅
+    { 11, 5, 0, 1, 18, 14, 16673 }, // ̆
+    { 5, 5, 0, 1, 20, 7, 16687 }, // ̇
+    { 12, 5, 0, 1, 20, 15, 16694 }, // ̈
+    { 6, 5, 0, 0, 16, 8, 16709 }, // ̉
+    { 6, 5, 0, 1, 19, 8, 16717 }, // ̊
+    { 19, 4, 0, 1, 19, 19, 16725 }, // ̋
+    { 11, 5, 0, 1, 19, 14, 16744 }, // ̌
+    { 19, 4, 0, -5, 20, 19, 16758 }, // ̏
+    { 6, 8, 0, 1, 19, 12, 16777 }, // ̒
+    { 6, 7, 0, 1, 18, 11, 16789 }, // ̓
+    { 6, 7, 0, 1, 18, 11, 16800 }, // ̔
+    { 5, 6, 0, 1, -1, 8, 16811 }, // ̘
+    { 5, 6, 0, 1, -1, 8, 16819 }, // ̙
+    { 11, 6, 0, 1, 20, 17, 16827 }, // ̚
+    { 4, 6, 0, 1, 16, 6, 16844 }, // ̛
+    { 4, 5, 0, 1, -2, 5, 16850 }, // ̜
+    { 7, 4, 0, 1, 3, 7, 16855 }, // ̝
+    { 7, 4, 0, 1, -1, 7, 16862 }, // ̞
+    { 6, 5, 0, 1, -2, 8, 16869 }, // ̟
+    { 13, 4, 0, 1, -3, 13, 16877 }, // ̠
+    { 5, 5, 0, 1, 1, 7, 16890 }, // ̣
+    { 12, 5, 0, 1, 0, 15, 16897 }, // ̤
+    { 6, 5, 0, 1, 19, 8, 16912 }, // ̥
+    { 6, 8, 0, 1, 4, 12, 16920 }, // ̦
+    { 6, 7, 0, 1, 1, 11, 16932 }, // ̧
+    { 6, 7, 0, 1, 1, 11, 16943 }, // ̨
+    { 4, 7, 0, 1, -1, 7, 16954 }, // ̩
+    { 9, 4, 0, 1, -1, 9, 16961 }, // ̪
+    { 11, 5, 0, 1, 0, 14, 16970 }, // ̬
+    { 11, 5, 0, 1, -1, 14, 16984 }, // ̭
+    { 10, 5, 0, 1, 19, 13, 16998 }, // ̰
+    { 10, 3, 0, 1, 18, 8, 17011 }, // ̱
+    { 11, 3, 0, 1, -2, 9, 17019 }, // ̲
+    { 10, 5, 0, 1, 19, 13, 17028 }, // ̴
+    { 13, 3, 0, 1, 9, 10, 17041 }, // ̵
+    { 4, 5, 0, 1, -2, 5, 17051 }, // ̹
+    { 9, 4, 0, 1, -1, 9, 17056 }, // ̺
+    { 8, 7, 0, 1, 0, 14, 17065 }, // ̻
+    { 9, 5, 0, 1, 0, 12, 17079 }, // ̼
+    { 6, 5, 0, 2, 19, 8, 17091 }, // ̽
+    { 10, 5, 0, 1, 19, 13, 17099 }, // ͂
+    { 4, 5, 0, 1, 21, 5, 17112 }, // ̓
+    { 12, 11, 0, 1, 26, 33, 17117 }, // ̈́
+    { 9, 5, 0, 1, 20, 12, 17150 }, // ͆
+    { 13, 9, 0, 1, 0, 30, 17162 }, // ͇
+    { 10, 7, 0, 1, 0, 18, 17192 }, // ͈
+    { 8, 7, 0, 1, -1, 14, 17210 }, // ͉
+    { 10, 15, 0, 1, 24, 38, 17224 }, // ͊
+    { 20, 11, 0, 1, 22, 55, 17262 }, // ͋
+    { 15, 13, 0, 2, 14, 49, 17317 }, // ͌
+    { 13, 5, 0, 2, -3, 17, 17366 }, // ͍
+    { 4, 4, 0, 1, 3, 4, 17383 }, // ͎
+    { 21, 5, 0, 1, 0, 27, 17387 }, // ͜
+    { 21, 5, 0, 1, 19, 27, 17414 }, // ͡
+    { 25, 6, 0, 1, -2, 38, 17441 }, // ͢
+    { 13, 25, 16, 1, 25, 82, 17479 }, // Ѐ
+    { 13, 24, 16, 1, 24, 78, 0 }, // Ё
+    { 20, 21, 26, 3, 21, 105, 17561 }, // Ђ
+    { 14, 29, 16, 1, 29, 102, 17666 }, // Ѓ
+    { 18, 20, 23, 3, 19, 90, 17768 }, // Є
+    { 20, 23, 28, 4, 22, 115, 17858 }, // Ѕ
+    { 5, 22, 11, 3, 22, 28, 17973 }, // І
+    { 12, 31, 11, -1, 31, 93, 18001 }, // Ї
+    { 11, 28, 19, 4, 22, 77, 18094 }, // Ј
+    { 25, 19, 29, 2, 18, 119, 0 }, // Љ
+    { 24, 19, 28, 2, 19, 114, 119 }, // Њ
+    { 21, 22, 27, 4, 22, 116, 233 }, // Ћ
+    { 17, 29, 26, 4, 29, 124, 349 }, // Ќ
+    { 19, 28, 27, 4, 28, 133, 473 }, // Ѝ
+    { 15, 30, 17, 1, 28, 113, 606 }, // Ў
+    { 15, 23, 18, 1, 18, 87, 719 }, // Џ
+    { 20, 21, 28, 4, 21, 105, 78 }, // А
+    { 14, 18, 16, 1, 18, 63, 183 }, // Б
+    { 15, 18, 17, 1, 18, 68, 246 }, // В
+    { 14, 19, 16, 1, 19, 67, 314 }, // Г
+    { 18, 22, 21, 1, 19, 99, 381 }, // Д
+    { 13, 19, 16, 1, 19, 62, 480 }, // Е
+    { 27, 21, 36, 4, 21, 142, 542 }, // Ж
+    { 13, 19, 16, 1, 19, 62, 684 }, // З
+    { 19, 22, 27, 4, 22, 105, 746 }, // И
+    { 19, 30, 27, 4, 30, 143, 851 }, // Й
+    { 17, 21, 26, 4, 21, 90, 994 }, // К
+    { 15, 20, 19, 2, 19, 75, 1084 }, // Л
+    { 19, 19, 21, 1, 19, 91, 1159 }, // М
+    { 19, 22, 27, 4, 22, 105, 1250 }, // Н
+    { 20, 22, 29, 4, 21, 110, 1355 }, // О
+    { 14, 19, 17, 1, 19, 67, 1465 }, // П
+    { 15, 21, 23, 4, 21, 79, 1532 }, // Р
+    { 18, 23, 25, 3, 22, 104, 1611 }, // С
+    { 19, 21, 27, 4, 21, 100, 1715 }, // Т
+    { 15, 22, 17, 1, 20, 83, 1815 }, // У
+    { 19, 19, 22, 1, 19, 91, 1898 }, // Ф
+    { 20, 22, 28, 4, 22, 110, 1989 }, // Х
+    { 15, 23, 18, 1, 19, 87, 2099 }, // Ц
+    { 14, 19, 17, 1, 19, 67, 2186 }, // Ч
+    { 18, 19, 20, 1, 19, 86, 2253 }, // Ш
+    { 20, 23, 23, 1, 19, 115, 2339 }, // Щ
+    { 17, 19, 17, -2, 19, 81, 2454 }, // Ъ
+    { 23, 19, 28, 2, 19, 110, 2535 }, // Ы
+    { 13, 19, 17, 2, 19, 62, 2645 }, // Ь
+    { 18, 20, 23, 2, 19, 90, 2707 }, // Э
+    { 21, 18, 25, 2, 18, 95, 2797 }, // Ю
+    { 16, 22, 24, 4, 22, 88, 2892 }, // Я
+    { 14, 15, 21, 3, 15, 53, 2980 }, // а
+    { 15, 20, 18, 1, 20, 75, 3033 }, // б
+    { 12, 15, 18, 3, 15, 45, 3108 }, // в
+    { 12, 14, 15, 1, 14, 42, 3153 }, // г
+    { 17, 17, 19, 1, 14, 73, 3195 }, // д
+    { 14, 15, 21, 3, 15, 53, 3268 }, // е
+    { 23, 18, 30, 3, 18, 104, 3321 }, // ж
+    { 9, 14, 11, 1, 14, 32, 3425 }, // з
+    { 14, 15, 17, 1, 15, 53, 3457 }, // и
+    { 14, 19, 17, 1, 19, 67, 3510 }, // й
+    { 14, 15, 20, 3, 15, 53, 3577 }, // к
+    { 10, 14, 13, 1, 13, 35, 3630 }, // л
+    { 17, 16, 23, 3, 16, 68, 3665 }, // м
+    { 15, 16, 23, 4, 16, 60, 3733 }, // н
+    { 14, 14, 17, 1, 14, 49, 3793 }, // о
+    { 14, 14, 17, 1, 14, 49, 3842 }, // п
+    { 15, 21, 20, 2, 14, 79, 3891 }, // р
+    { 12, 16, 19, 3, 15, 48, 3970 }, // с
+    { 15, 14, 17, 1, 14, 53, 4018 }, // т
+    { 15, 21, 21, 3, 14, 79, 4071 }, // у
+    { 19, 20, 22, 1, 14, 95, 4150 }, // ф
+    { 15, 14, 18, 1, 14, 53, 4245 }, // х
+    { 15, 18, 18, 1, 14, 68, 4298 }, // ц
+    { 9, 13, 11, 1, 13, 30, 4366 }, // ч
+    { 18, 14, 20, 1, 14, 63, 4396 }, // ш
+    { 20, 19, 22, 1, 14, 95, 4459 }, // щ
+    { 16, 14, 19, 1, 14, 56, 4554 }, // ъ
+    { 18, 14, 20, 1, 14, 63, 4610 }, // ы
+    { 13, 14, 15, 1, 14, 46, 4673 }, // ь
+    { 14, 14, 16, 1, 14, 49, 4719 }, // э
+    { 16, 15, 20, 2, 15, 60, 4768 }, // ю
+    { 13, 14, 16, 1, 14, 46, 4828 }, // я
+    { 14, 24, 21, 3, 24, 84, 806 }, // ѐ
+    { 14, 20, 17, 1, 19, 70, 4874 }, // ё
+    { 17, 25, 21, 1, 21, 107, 890 }, // ђ
+    { 12, 21, 15, 1, 21, 63, 997 }, // ѓ
+    { 12, 14, 16, 2, 13, 42, 1060 }, // є
+    { 13, 14, 19, 3, 14, 46, 1102 }, // ѕ
+    { 5, 22, 11, 3, 22, 28, 1148 }, // і
+    { 12, 22, 11, -1, 22, 66, 1176 }, // ї
+    { 10, 27, 16, 3, 21, 68, 1242 }, // ј
+    { 17, 14, 20, 2, 13, 60, 1310 }, // љ
+    { 16, 14, 19, 2, 14, 56, 1370 }, // њ
+    { 16, 21, 21, 1, 21, 84, 1426 }, // ћ
+    { 14, 22, 20, 3, 22, 77, 1510 }, // ќ
+    { 14, 21, 17, 1, 21, 74, 1587 }, // ѝ
+    { 15, 32, 21, 3, 25, 120, 1661 }, // ў
+    { 11, 17, 13, 1, 13, 47, 1781 }, // џ
+    { 15, 19, 21, 3, 18, 72, 1828 }, // Ѣ
+    { 16, 19, 18, 1, 18, 76, 1900 }, // ѣ
+    { 21, 18, 25, 2, 18, 95, 1976 }, // Ѫ
+    { 14, 13, 18, 2, 13, 46, 2071 }, // ѫ
+    { 18, 23, 27, 4, 22, 104, 2117 }, // Ѳ
+    { 14, 17, 21, 3, 17, 60, 2221 }, // ѳ
+    { 26, 28, 29, 4, 28, 182, 2281 }, // Ѵ
+    { 16, 17, 20, 3, 17, 68, 2463 }, // ѵ
+    { 9, 8, 0, 1, 23, 18, 2531 }, // ҆
+    { 14, 21, 16, 1, 21, 74, 2549 }, // Ґ
+    { 12, 17, 15, 1, 17, 51, 2623 }, // ґ
+    { 15, 19, 16, 0, 19, 72, 2674 }, // Ғ
+    { 10, 13, 11, 0, 13, 33, 2746 }, // ғ
+    { 15, 20, 17, 1, 20, 75, 2779 }, // Ҕ
+    { 9, 13, 11, 1, 13, 30, 2854 }, // ҕ
+    { 28, 25, 32, 2, 21, 175, 2884 }, // Җ
+    { 18, 18, 22, 2, 15, 81, 3059 }, // җ
+    { 13, 22, 18, 2, 19, 72, 3140 }, // Ҙ
+    { 9, 20, 11, 1, 14, 45, 3212 }, // ҙ
+    { 18, 24, 22, 2, 21, 108, 3257 }, // Қ
+    { 12, 18, 15, 2, 15, 54, 3365 }, // қ
+    { 20, 19, 24, 2, 19, 95, 3419 }, // Ҝ
+    { 14, 13, 18, 2, 13, 46, 3514 }, // ҝ
+    { 17, 21, 26, 4, 21, 90, 3560 }, // Ҟ
+    { 17, 21, 20, 0, 21, 90, 3650 }, // ҟ
+    { 23, 21, 26, -2, 21, 121, 3740 }, // Ҡ
+    { 17, 15, 17, -2, 15, 64, 3861 }, // ҡ
+    { 19, 25, 23, 2, 22, 119, 3925 }, // Ң
+    { 13, 17, 16, 2, 15, 56, 4044 }, // ң
+    { 26, 22, 27, 4, 22, 143, 4100 }, // Ҥ
+    { 18, 15, 18, 3, 15, 68, 4243 }, // ҥ
+    { 25, 21, 29, 2, 21, 132, 4311 }, // Ҧ
+    { 23, 23, 27, 2, 16, 133, 4443 }, // ҧ
+    { 25, 22, 30, 2, 21, 138, 4576 }, // Ҩ
+    { 19, 17, 23, 2, 16, 81, 4714 }, // ҩ
+    { 18, 27, 25, 3, 22, 122, 4795 }, // Ҫ
+    { 12, 19, 19, 3, 15, 57, 4917 }, // ҫ
+    { 19, 24, 23, 2, 21, 114, 4974 }, // Ҭ
+    { 13, 17, 16, 2, 15, 56, 5088 }, // ҭ
+    { 18, 21, 27, 4, 21, 95, 5144 }, // Ү
+    { 14, 18, 17, 1, 13, 63, 5239 }, // ү
+    { 18, 21, 27, 4, 21, 95, 5302 }, // Ұ
+    { 14, 19, 17, 1, 13, 67, 5397 }, // ұ
+    { 21, 26, 25, 2, 22, 137, 5464 }, // Ҳ
+    { 14, 18, 17, 2, 15, 63, 5601 }, // ҳ
+    { 22, 23, 27, 2, 18, 127, 5664 }, // Ҵ
+    { 15, 17, 19, 2, 13, 64, 5791 }, // ҵ
+    { 17, 24, 21, 1, 18, 102, 5855 }, // Ҷ
+    { 12, 17, 15, 1, 13, 51, 5957 }, // ҷ
+    { 14, 19, 18, 2, 19, 67, 6008 }, // Ҹ
+    { 10, 13, 12, 1, 13, 33, 6075 }, // ҹ
+    { 14, 21, 19, 2, 21, 74, 6108 }, // Һ
+    { 14, 21, 21, 3, 21, 74, 6182 }, // һ
+    { 22, 20, 24, 0, 19, 110, 6256 }, // Ҽ
+    { 16, 14, 17, 0, 14, 56, 6366 }, // ҽ
+    { 23, 23, 27, 2, 19, 133, 6422 }, // Ҿ
+    { 16, 17, 20, 2, 14, 68, 6555 }, // ҿ
+    { 5, 22, 11, 3, 22, 28, 6623 }, // Ӏ
+    { 27, 30, 36, 4, 30, 203, 6651 }, // Ӂ
+    { 23, 27, 30, 3, 27, 156, 6854 }, // ӂ
+    { 15, 25, 20, 2, 19, 94, 7010 }, // Ӄ
+    { 10, 17, 13, 2, 13, 43, 7104 }, // ӄ
+    { 18, 24, 19, 2, 19, 108, 7147 }, // Ӆ
+    { 13, 16, 13, 1, 13, 52, 7255 }, // ӆ
+    { 20, 28, 27, 4, 22, 140, 7307 }, // Ӈ
+    { 14, 20, 18, 3, 15, 70, 7447 }, // ӈ
+    { 20, 29, 27, 4, 22, 145, 7517 }, // Ӊ
+    { 13, 20, 19, 3, 15, 65, 7662 }, // ӊ
+    { 14, 23, 17, 0, 18, 81, 7727 }, // Ӌ
+    { 10, 16, 13, 1, 13, 40, 7808 }, // ӌ
+    { 25, 29, 31, 4, 22, 182, 7848 }, // Ӎ
+    { 17, 20, 21, 3, 15, 85, 8030 }, // ӎ
+    { 5, 18, 7, 1, 18, 23, 8115 }, // ӏ
+    { 20, 30, 28, 4, 30, 150, 8138 }, // Ӑ
+    { 14, 23, 21, 3, 23, 81, 8288 }, // ӑ
+    { 20, 29, 28, 4, 29, 145, 8369 }, // Ӓ
+    { 14, 21, 21, 3, 21, 74, 8514 }, // ӓ
+    { 28, 23, 36, 4, 22, 161, 8588 }, // Ӕ
+    { 24, 15, 31, 3, 15, 90, 8749 }, // ӕ
+    { 13, 26, 16, 1, 26, 85, 8839 }, // Ӗ
+    { 14, 25, 21, 3, 25, 88, 8924 }, // ӗ
+    { 14, 15, 21, 3, 14, 53, 9012 }, // Ә
+    { 14, 16, 21, 4, 15, 56, 9065 }, // ә
+    { 14, 26, 21, 3, 25, 91, 9121 }, // Ӛ
+    { 14, 17, 21, 4, 15, 60, 9212 }, // ӛ
+    { 27, 29, 33, 4, 29, 196, 9272 }, // Ӝ
+    { 23, 26, 30, 3, 26, 150, 9468 }, // ӝ
+    { 13, 26, 16, 1, 26, 85, 9618 }, // Ӟ
+    { 12, 21, 11, 1, 21, 63, 9703 }, // ӟ
+    { 12, 19, 15, 2, 18, 57, 9766 }, // Ӡ
+    { 12, 19, 15, 2, 13, 57, 9823 }, // ӡ
+    { 19, 27, 27, 4, 27, 129, 9880 }, // Ӣ
+    { 14, 20, 17, 1, 20, 70, 10009 }, // ӣ
+    { 19, 28, 27, 4, 28, 133, 10079 }, // Ӥ
+    { 14, 21, 17, 1, 21, 74, 10212 }, // ӥ
+    { 20, 29, 29, 4, 28, 145, 10286 }, // Ӧ
+    { 14, 22, 17, 1, 22, 77, 10431 }, // ӧ
+    { 18, 19, 27, 4, 18, 86, 10508 }, // Ө
+    { 14, 14, 21, 3, 14, 49, 10594 }, // ө
+    { 18, 30, 27, 4, 29, 135, 10643 }, // Ӫ
+    { 14, 23, 21, 3, 23, 81, 10778 }, // ӫ
+    { 18, 28, 23, 2, 27, 126, 10859 }, // Ӭ
+    { 14, 21, 16, 1, 21, 74, 10985 }, // ӭ
+    { 15, 28, 17, 1, 26, 105, 11059 }, // Ӯ
+    { 15, 29, 21, 3, 22, 109, 11164 }, // ӯ
+    { 15, 29, 17, 1, 27, 109, 11273 }, // Ӱ
+    { 15, 31, 21, 3, 24, 117, 11382 }, // ӱ
+    { 19, 29, 17, 0, 27, 138, 11499 }, // Ӳ
+    { 19, 31, 21, 2, 24, 148, 11637 }, // ӳ
+    { 14, 26, 17, 1, 26, 91, 11785 }, // Ӵ
+    { 12, 21, 11, -1, 21, 63, 11876 }, // ӵ
+    { 14, 23, 16, 1, 19, 81, 11939 }, // Ӷ
+    { 9, 16, 11, 1, 13, 36, 12020 }, // ӷ
+    { 23, 28, 28, 2, 28, 161, 12056 }, // Ӹ
+    { 18, 23, 20, 1, 23, 104, 12217 }, // ӹ
+    { 24, 25, 28, 4, 22, 150, 12321 }, // Ӽ
+    { 17, 17, 20, 3, 15, 73, 12471 }, // ӽ
+    { 0, 0, 21, 0, 0, 0, 12544 }, //  
+    { 0, 0, 33, 0, 0, 0, 12544 }, //  
+    { 0, 0, 21, 0, 0, 0, 12544 }, //  
+    { 0, 0, 33, 0, 0, 0, 12544 }, //  
+    { 0, 0, 16, 0, 0, 0, 12544 }, //  
+    { 0, 0, 14, 0, 0, 0, 12544 }, //  
+    { 0, 0, 12, 0, 0, 0, 12544 }, //  
+    { 0, 0, 17, 0, 0, 0, 12544 }, //  
+    { 0, 0, 7, 0, 0, 0, 12544 }, //  
+    { 0, 0, 13, 0, 0, 0, 12544 }, //  
+    { 0, 0, 12, 0, 0, 0, 12544 }, //  
+    { 0, 0, 8, 0, 0, 0, 12544 }, // ​
+    { 0, 0, 0, 0, 0, 0, 12544 }, // ‌
+    { 0, 0, 0, 0, 0, 0, 12544 }, // ‍
+    { 0, 0, 0, 0, 0, 0, 12544 }, // ‎
+    { 0, 0, 0, 0, 0, 0, 12544 }, // ‏
+    { 13, 3, 14, 1, 9, 10, 12544 }, // ‐
+    { 13, 3, 14, 1, 9, 10, 12554 }, // ‑
+    { 18, 3, 19, 1, 9, 14, 12564 }, // ‒
+    { 17, 4, 20, 1, 9, 17, 11290 }, // –
+    { 26, 4, 28, 1, 9, 26, 11307 }, // —
+    { 26, 4, 28, 1, 9, 26, 12578 }, // ―
+    { 11, 22, 14, 1, 18, 61, 12604 }, // ‖
+    { 19, 8, 20, 1, -2, 38, 12665 }, // ‗
+    { 6, 7, 8, 1, 21, 11, 11333 }, // ‘
+    { 6, 7, 8, 1, 21, 11, 11344 }, // ’
+    { 6, 8, 8, 1, 4, 12, 12703 }, // ‚
+    { 6, 7, 8, 1, 21, 11, 12715 }, // ‛
+    { 12, 7, 14, 1, 21, 21, 11355 }, // “
+    { 12, 7, 14, 1, 21, 21, 11376 }, // ”
+    { 6, 8, 8, 1, 4, 12, 12726 }, // „
+    { 13, 8, 14, 1, 21, 26, 12738 }, // ‟
+    { 14, 33, 15, 0, 26, 116, 12764 }, // †
+    { 13, 33, 15, 1, 26, 108, 12880 }, // ‡
+    { 15, 15, 13, -1, 18, 57, 12988 }, // •
+    { 7, 8, 10, 1, 11, 14, 13045 }, // ‣
+    { 5, 5, 7, 1, 5, 7, 13059 }, // ․
+    { 5, 5, 7, 1, 5, 7, 13066 }, // ‥
+    { 22, 5, 24, 1, 5, 28, 11397 }, // …
+    { 4, 3, 6, 1, 9, 3, 13073 }, // ‧
+    { 0, 0, 32, 0, 0, 0, 13076 }, //  
+    { 16, 22, 28, 6, 20, 88, 13076 }, // ‰
+    { 6, 7, 8, 1, 21, 11, 13164 }, // ′
+    { 12, 7, 14, 1, 21, 21, 13175 }, // ″
+    { 19, 8, 21, 1, 21, 38, 13196 }, // ‴
+    { 6, 7, 8, 1, 21, 11, 13234 }, // ‵
+    { 12, 7, 13, 0, 21, 21, 13245 }, // ‶
+    { 19, 8, 21, 1, 21, 38, 13266 }, // ‷
+    { 11, 5, 14, 1, 20, 14, 13304 }, // ‸
+    { 8, 12, 10, 1, 13, 24, 13318 }, // ‹
+    { 8, 12, 10, 1, 13, 24, 13342 }, // ›
+    { 26, 26, 33, 5, 23, 169, 13366 }, // ※
+    { 6, 25, 8, 1, 25, 38, 13535 }, // ‼
+    { 14, 31, 19, 2, 30, 109, 13573 }, // ‽
+    { 13, 3, 14, 1, 21, 10, 13682 }, // ‾
+    { 11, 5, 14, 1, 17, 14, 13692 }, // ‿
+    { 17, 16, 20, 1, 22, 68, 13706 }, // ⁂
+    { 15, 20, 28, 6, 19, 75, 13774 }, // ⁄
+    { 28, 28, 32, 2, 28, 196, 13849 }, // ⁇
+    { 19, 28, 25, 2, 28, 133, 14045 }, // ⁈
+    { 19, 30, 20, 1, 28, 143, 14178 }, // ⁉
+    { 15, 39, 19, 2, 27, 147, 14321 }, // ⁒
+    { 0, 0, 121, 0, 0, 0, 14468 }, //  
+    { 7, 10, 8, 0, 21, 18, 14468 }, // ⁰
+    { 8, 10, 8, 0, 21, 20, 14486 }, // ⁴
+    { 6, 10, 8, 1, 21, 15, 14506 }, // ⁵
+    { 8, 9, 8, 0, 20, 18, 14521 }, // ⁶
+    { 7, 10, 8, 1, 21, 18, 14539 }, // ⁷
+    { 8, 10, 8, 0, 21, 20, 14557 }, // ⁸
+    { 8, 9, 8, 0, 20, 18, 14577 }, // ⁹
+    { 14, 14, 20, 3, 14, 49, 14595 }, // ⁿ
+    { 9, 13, 11, 1, 13, 30, 14644 }, // ₀
+    { 6, 10, 8, 1, 6, 15, 14674 }, // ₁
+    { 7, 10, 8, 1, 6, 18, 14689 }, // ₂
+    { 8, 9, 8, 0, 5, 18, 14707 }, // ₃
+    { 8, 10, 8, 0, 6, 20, 14725 }, // ₄
+    { 7, 10, 8, 0, 6, 18, 14745 }, // ₅
+    { 8, 9, 8, 0, 5, 18, 14763 }, // ₆
+    { 7, 11, 8, 1, 6, 20, 14781 }, // ₇
+    { 8, 10, 8, 0, 6, 20, 14801 }, // ₈
+    { 8, 9, 8, 0, 5, 18, 14821 }, // ₉
+    { 8, 34, 11, 2, 25, 68, 14839 }, // ₍
+    { 8, 34, 11, 1, 25, 68, 14907 }, // ₎
+    { 17, 31, 25, 4, 26, 132, 14975 }, // ₡
+    { 18, 23, 25, 3, 22, 104, 15107 }, // ₢
+    { 16, 24, 17, 1, 24, 96, 15211 }, // ₤
+    { 24, 22, 27, 2, 22, 132, 15307 }, // ₦
+    { 20, 21, 23, 1, 21, 105, 15439 }, // ₧
+    { 25, 21, 28, 3, 21, 132, 15544 }, // ₨
+    { 19, 21, 21, 1, 21, 100, 15676 }, // ₩
+    { 20, 19, 27, 3, 19, 95, 15776 }, // ₪
+    { 17, 20, 17, 1, 20, 85, 15871 }, // ₫
+    { 15, 23, 19, 2, 20, 87, 15956 }, // €
+    { 19, 21, 27, 4, 21, 100, 16043 }, // ₮
+    { 22, 21, 16, 0, 21, 116, 16143 }, // ₱
+    { 20, 30, 29, 4, 26, 150, 16259 }, // ₲
+    { 23, 23, 23, 1, 22, 133, 16409 }, // ₴
+    { 12, 18, 19, 3, 17, 54, 16542 }, // ₵
+    { 19, 22, 27, 4, 22, 105, 16596 }, // ₸
+    { 13, 20, 15, 1, 19, 65, 16701 }, // ₹
+    { 15, 18, 17, 1, 17, 68, 16766 }, // ₺
+    { 16, 19, 16, 0, 19, 76, 16834 }, // ₼
+    { 20, 21, 23, -1, 21, 105, 16910 }, // ₽
+    { 16, 16, 19, 1, 14, 64, 17015 }, // ←
+    { 17, 15, 19, 1, 15, 64, 17079 }, // ↑
+    { 16, 16, 19, 1, 14, 64, 17143 }, // →
+    { 17, 15, 19, 1, 15, 64, 17207 }, // ↓
+    { 20, 14, 22, 1, 14, 70, 17271 }, // ↔
+    { 14, 19, 16, 1, 20, 67, 17341 }, // ↕
+    { 13, 12, 16, 1, 13, 39, 17408 }, // ↖
+    { 13, 12, 16, 1, 13, 39, 17447 }, // ↗
+    { 13, 13, 16, 1, 14, 43, 17486 }, // ↘
+    { 13, 13, 16, 1, 14, 43, 17529 }, // ↙
+    { 19, 16, 21, 1, 15, 76, 17572 }, // ⇐
+    { 20, 18, 23, 1, 18, 90, 17648 }, // ⇑
+    { 19, 16, 21, 1, 15, 76, 17738 }, // ⇒
+    { 20, 19, 23, 1, 18, 95, 17814 }, // ⇓
+    { 22, 16, 24, 1, 15, 88, 17909 }, // ⇔
+    { 17, 21, 19, 1, 14, 90, 17997 }, // ⇕
+    { 15, 20, 17, 1, 20, 75, 18087 }, // ∂
+    { 25, 23, 29, 2, 22, 144, 0 }, // ∅
+    { 19, 19, 22, 1, 19, 91, 144 }, // ∆
+    { 16, 18, 18, 1, 18, 72, 235 }, // ∏
+    { 16, 18, 18, 1, 18, 72, 307 }, // ∐
+    { 12, 19, 15, 1, 18, 57, 379 }, // ∑
+    { 13, 4, 15, 1, 9, 13, 436 }, // −
+    { 21, 21, 23, 1, 20, 111, 449 }, // √
+    { 20, 12, 23, 1, 15, 60, 560 }, // ∞
+    { 21, 28, 21, 0, 22, 147, 620 }, // ∫
+    { 5, 15, 7, 1, 15, 19, 767 }, // ∶
+    { 15, 13, 19, 2, 14, 49, 786 }, // ≈
+    { 16, 22, 28, 6, 20, 88, 835 }, // ≠
+    { 19, 19, 22, 1, 18, 91, 923 }, // ≤
+    { 19, 19, 22, 1, 18, 91, 1014 }, // ≥
+    { 18, 20, 25, 3, 20, 90, 1105 }, // ﬀ
+    { 16, 22, 22, 3, 22, 88, 1195 }, // ﬁ
+    { 19, 21, 25, 3, 21, 100, 1283 }, // ﬂ
+    { 25, 22, 32, 3, 22, 138, 1383 }, // ﬃ
+    { 28, 21, 34, 3, 21, 147, 1521 }, // ﬄ
+    { 24, 19, 31, 3, 19, 114, 1668 }, // ﬆ
 };
 
 static const EpdUnicodeInterval opendyslexic_12_regularIntervals[] = {
@@ -2371,30 +2353,90 @@ static const EpdUnicodeInterval opendyslexic_12_regularIntervals[] = {
     { 0x2248, 0x2248, 0x2D1 },
     { 0x2260, 0x2260, 0x2D2 },
     { 0x2264, 0x2265, 0x2D3 },
+    { 0xFB00, 0xFB04, 0x2D5 },
+    { 0xFB06, 0xFB06, 0x2DA },
 };
 
 static const EpdFontGroup opendyslexic_12_regularGroups[] = {
-    { 0, 3814, 6592, 95, 0 },
-    { 3814, 3344, 8137, 96, 95 },
-    { 7158, 4694, 13167, 126, 191 },
-    { 11852, 610, 873, 61, 317 },
-    { 12462, 8809, 18180, 213, 378 },
-    { 21271, 1119, 2059, 63, 591 },
-    { 22390, 407, 507, 20, 654 },
-    { 22797, 1155, 2040, 20, 674 },
-    { 23952, 605, 1072, 16, 694 },
-    { 24557, 633, 1180, 15, 710 },
+    { 0, 5040, 11425, 151, 0 },
+    { 5040, 2750, 4944, 66, 379 },
+    { 7790, 6853, 18171, 242, 96 },
+    { 14643, 9258, 18162, 252, 387 },
+    { 23901, 910, 1782, 20, 711 },
+};
+
+static const uint8_t opendyslexic_12_regularGlyphGroups[731] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 0,
+    0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 2, 2, 2, 0,
+    0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 2, 2, 2, 2,
+    2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 3, 1, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 0, 0, 3, 3, 3, 0, 0, 3, 3, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+};
+
+static const uint16_t opendyslexic_12_regularGlyphLookup[368] = {
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x005F, 0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E,
+    0x006F, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E,
+    0x007F, 0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E,
+    0x008F, 0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E,
+    0x009F, 0x00A0, 0x00A1, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE,
+    0x00AF, 0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE,
+    0x024F, 0x0250, 0x0251, 0x0252, 0x0253, 0x0254, 0x0255, 0x0256, 0x0257, 0x0258, 0x0259, 0x025A, 0x025B, 0x025C, 0x025D, 0x025E,
+    0x025F, 0x0260, 0x0261, 0x0262, 0x0263, 0x0264, 0x0265, 0x0266, 0x0267, 0x0268, 0x0269, 0x026A, 0x026B, 0x026C, 0x026D, 0x026E,
+    0x026F, 0x0270, 0x0271, 0x0272, 0x0273, 0x0274, 0x0275, 0x0276, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0277,
+    0x0278, 0xFFFF, 0x0279, 0x027A, 0x027B, 0x027C, 0x027D, 0x027E, 0x027F, 0x0280, 0x0281, 0x0282, 0x0283, 0x0284, 0x0285, 0x0286,
+    0xFFFF, 0xFFFF, 0x0287, 0xFFFF, 0x0288, 0xFFFF, 0xFFFF, 0x0289, 0x028A, 0x028B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x028C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x028D,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
 };
 
 static const EpdFontData opendyslexic_12_regular = {
     opendyslexic_12_regularBitmaps,
     opendyslexic_12_regularGlyphs,
     opendyslexic_12_regularIntervals,
-    56,
+    58,
     46,
     33,
     -13,
     true,
     opendyslexic_12_regularGroups,
-    10,
+    5,
+    nullptr,
+    nullptr,
+    nullptr,
+    0,
+    nullptr,
+    0,
+    0,
+    opendyslexic_12_regularGlyphLookup,
+    opendyslexic_12_regularGlyphGroups,
+    false,
+    nullptr,
 };
@@ -3,2213 +3,2210 @@
  * name: opendyslexic_14_bold
  * size: 14
  * mode: 2-bit  compressed: true
- * Command used: fontconvert.py opendyslexic_14_bold 14 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Bold.otf --2bit --compress
+ * Command used: fontconvert.py opendyslexic_14_bold 14 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Bold.otf --2bit --compress --no-kerning --frequency-corpus ../../../test/hyphenation_eval/resources/english_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/french_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/german_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/italian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/russian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/spanish_hyphenation_tests.txt
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t opendyslexic_14_boldBitmaps[35214] = {
-    0x7D, 0x5A, 0x3D, 0x90, 0xDD, 0xD6, 0x75, 0xBE, 0x78, 0x10, 0x17, 0x33, 0xC2, 0x8C, 0xE1, 0xC2,
-    0x52, 0x41, 0xCE, 0x04, 0x29, 0x52, 0x64, 0x94, 0x02, 0x29, 0x5D, 0x58, 0xBA, 0x90, 0x54, 0xA8,
-    0x50, 0x41, 0x16, 0xA4, 0x0B, 0xB9, 0x50, 0x9A, 0x14, 0x56, 0xB3, 0x29, 0x53, 0x58, 0x01, 0x2C,
-    0xCE, 0xC4, 0x45, 0x0A, 0x6E, 0x21, 0xD7, 0x64, 0xA1, 0x78, 0xC4, 0xF5, 0x8C, 0xD9, 0xB8, 0x48,
-    0xC1, 0xE8, 0x82, 0xDC, 0x62, 0x0B, 0x16, 0x79, 0x96, 0xAC, 0x61, 0xE1, 0xC2, 0x50, 0x28, 0x8D,
-    0x64, 0xB9, 0x20, 0x48, 0x81, 0x16, 0x96, 0x02, 0x70, 0xF2, 0x7D, 0xE7, 0x5E, 0xBC, 0xF7, 0x76,
-    0x25, 0x67, 0x17, 0x3F, 0x17, 0x7F, 0xF7, 0x9E, 0x7B, 0x7E, 0xBF, 0x73, 0xEE, 0x33, 0xC6, 0xFC,
-    0xA3, 0xC9, 0x4D, 0xD2, 0x45, 0x93, 0x71, 0x65, 0xD1, 0x64, 0x5D, 0x3C, 0x1A, 0x31, 0x56, 0x1B,
-    0x91, 0x98, 0xAA, 0xC9, 0xBB, 0x74, 0x5C, 0x89, 0x11, 0x34, 0xCC, 0x68, 0x52, 0x63, 0x4A, 0xB3,
-    0xFB, 0x17, 0xCB, 0xCB, 0xD2, 0xBA, 0xA1, 0x90, 0x4C, 0x8E, 0xE4, 0x91, 0x8C, 0x95, 0x94, 0xD5,
-    0x94, 0xC9, 0x3D, 0x69, 0x64, 0x70, 0x63, 0x26, 0xAF, 0x4B, 0x29, 0x9D, 0xEB, 0x32, 0x49, 0xD1,
-    0x47, 0xE7, 0x7A, 0x36, 0x4A, 0xDF, 0xC8, 0xD8, 0x30, 0x26, 0xED, 0x31, 0x24, 0xFE, 0xB2, 0xE5,
-    0xDC, 0x2D, 0xE7, 0x44, 0xCF, 0x24, 0x20, 0x9C, 0x07, 0x9E, 0x8B, 0x2E, 0xC3, 0x39, 0x11, 0xFD,
-    0x9B, 0x52, 0x7F, 0xC6, 0x48, 0xFA, 0x37, 0xE4, 0xFE, 0xDC, 0x1B, 0x53, 0xAD, 0x41, 0xB1, 0xE1,
-    0xB9, 0xD0, 0xB3, 0x5B, 0xCE, 0x8D, 0xD5, 0xB3, 0x9C, 0x3A, 0x87, 0xEF, 0xFB, 0xF0, 0x7D, 0x57,
-    0x84, 0xB3, 0xF5, 0xE7, 0xD6, 0xAC, 0xA4, 0x76, 0x6B, 0x9D, 0x70, 0x2D, 0x8D, 0x9E, 0xCB, 0x53,
-    0xE7, 0x84, 0x3C, 0xD2, 0x73, 0xA4, 0xE7, 0xF0, 0x97, 0x74, 0xDB, 0x63, 0xBA, 0x73, 0xDC, 0x9F,
-    0xDF, 0x45, 0x13, 0x13, 0x00, 0x81, 0x20, 0xDF, 0x44, 0x4A, 0x74, 0x2C, 0xF2, 0x97, 0x1B, 0x38,
-    0xFE, 0x47, 0xC7, 0x8E, 0xD2, 0x9D, 0xE3, 0xB5, 0x8E, 0x43, 0x91, 0x5F, 0x2B, 0x91, 0x13, 0x92,
-    0xAD, 0x93, 0x24, 0x99, 0xA5, 0xD9, 0x53, 0x0A, 0x39, 0x07, 0xDC, 0xCA, 0xBE, 0x41, 0x77, 0x26,
-    0x6B, 0xDD, 0x64, 0xDA, 0xAC, 0xB5, 0x53, 0x2C, 0xD7, 0xDA, 0x8A, 0x7C, 0xC2, 0x7D, 0x9D, 0x55,
-    0x5F, 0xE9, 0x8C, 0xD8, 0x9E, 0x41, 0x88, 0xC8, 0x01, 0xB9, 0xBD, 0x36, 0xFF, 0xCF, 0x11, 0xA3,
-    0xBE, 0xA7, 0xD2, 0x56, 0x49, 0x40, 0x57, 0x28, 0x0A, 0xC1, 0x80, 0x8D, 0x71, 0x26, 0xFB, 0xDD,
-    0x60, 0x6C, 0x1D, 0xAF, 0x0B, 0xA8, 0x4D, 0xD4, 0x25, 0x4D, 0xDE, 0x9A, 0xB7, 0xA3, 0x2E, 0xEB,
-    0x4C, 0x56, 0x8F, 0x29, 0xE7, 0x34, 0x53, 0x90, 0x95, 0xC4, 0x13, 0x27, 0xF2, 0x0A, 0xC6, 0x34,
-    0x3F, 0x30, 0xA2, 0xC2, 0x74, 0xD7, 0xC8, 0xAB, 0xEA, 0x1E, 0x7A, 0x30, 0xF6, 0xA3, 0xB6, 0xA0,
-    0x74, 0xFB, 0xA4, 0x81, 0x2E, 0xBC, 0x18, 0xF5, 0x26, 0x1B, 0xB3, 0xFA, 0x67, 0x26, 0x19, 0xE3,
-    0x13, 0x67, 0xE2, 0xD9, 0x38, 0xA9, 0x57, 0x7E, 0x4C, 0xA9, 0x8D, 0xAB, 0xCD, 0x2E, 0x9B, 0xFD,
-    0x5F, 0xC1, 0xBE, 0x2B, 0x41, 0x67, 0x55, 0xED, 0x4A, 0x63, 0x4B, 0xF0, 0x3D, 0x6B, 0xCC, 0x7F,
-    0x9B, 0xB8, 0x33, 0x45, 0x6D, 0x26, 0xCE, 0xA6, 0x58, 0x83, 0xB2, 0x78, 0x2A, 0x86, 0xF0, 0x66,
-    0xC2, 0xC3, 0xCA, 0x33, 0x16, 0x9F, 0x47, 0xF2, 0xB0, 0x4D, 0x47, 0xB9, 0x2B, 0xAB, 0xD9, 0xB6,
-    0x79, 0x27, 0xD7, 0xFB, 0x48, 0xDC, 0xB1, 0x98, 0x5C, 0x3E, 0x91, 0x7E, 0xE5, 0xF5, 0x61, 0x54,
-    0xA5, 0x5B, 0x63, 0xFF, 0xA6, 0x43, 0xB3, 0xFD, 0x17, 0x48, 0x13, 0x56, 0x51, 0xCD, 0xD5, 0x54,
-    0x8D, 0xD5, 0x50, 0xF5, 0xFA, 0x3F, 0x38, 0xFC, 0x1B, 0xF3, 0xD4, 0x90, 0xDC, 0xAA, 0x31, 0x16,
-    0x63, 0x83, 0x9C, 0xCE, 0x40, 0x9D, 0xC1, 0x0A, 0x4C, 0xC5, 0x40, 0x74, 0x78, 0xC0, 0xBB, 0x3D,
-    0x59, 0x0B, 0x7B, 0xE3, 0xBC, 0x8A, 0x56, 0xAF, 0x27, 0x7D, 0x8E, 0xAF, 0xA0, 0xEE, 0x98, 0x3D,
-    0x7B, 0x29, 0xF4, 0xE3, 0x88, 0xB7, 0xF1, 0xCE, 0x88, 0x3E, 0xD0, 0x41, 0x68, 0x61, 0x0C, 0xF4,
-    0x33, 0xE3, 0xE9, 0xDA, 0xD8, 0x11, 0xD3, 0x2A, 0x61, 0x6F, 0xE6, 0xD9, 0x9B, 0x69, 0xA7, 0x5D,
-    0xD9, 0x86, 0x9F, 0xB2, 0xC7, 0xC2, 0xDF, 0x70, 0xE4, 0xB2, 0x52, 0x51, 0xF9, 0xD6, 0xEC, 0x5B,
-    0xDD, 0x32, 0x32, 0xC8, 0x80, 0x8C, 0x56, 0x9E, 0x26, 0x8E, 0x17, 0xC8, 0xC0, 0x90, 0x7E, 0x26,
-    0x23, 0xAF, 0x49, 0x02, 0x04, 0x81, 0xB1, 0x6D, 0x6F, 0xF2, 0x91, 0x14, 0xC0, 0xD2, 0x63, 0x8A,
-    0xAA, 0x89, 0xA0, 0x94, 0x87, 0x37, 0xC0, 0xD3, 0x7F, 0x0A, 0x9A, 0x23, 0x51, 0xF3, 0x43, 0x7B,
-    0xB7, 0xB3, 0x7F, 0xFE, 0x7A, 0xA2, 0xF6, 0xBD, 0x42, 0x05, 0xDC, 0xA3, 0xB6, 0x82, 0x9B, 0x50,
-    0x6B, 0xB9, 0x4A, 0x8B, 0x73, 0xD7, 0xEF, 0x75, 0xD9, 0x6B, 0xDD, 0xDF, 0x99, 0x97, 0x27, 0x4A,
-    0x13, 0xFB, 0x33, 0xD8, 0xF7, 0x7E, 0x4B, 0x4F, 0xF1, 0xAD, 0x1D, 0xAA, 0x3C, 0x2F, 0xFB, 0x5B,
-    0xB7, 0xE6, 0x9B, 0xDF, 0xF5, 0x8E, 0x89, 0x2E, 0x51, 0x6B, 0x64, 0x50, 0x87, 0x93, 0xC1, 0x3E,
-    0xDB, 0x02, 0x56, 0xD1, 0x54, 0xBC, 0xF1, 0xDC, 0x95, 0x2B, 0x97, 0xF1, 0xF1, 0xB4, 0xEC, 0xE7,
-    0x2E, 0x55, 0x77, 0xE5, 0xE2, 0x6C, 0x07, 0xF9, 0xDA, 0xEB, 0x17, 0x07, 0x37, 0x3F, 0xA3, 0xEE,
-    0x53, 0x61, 0xD9, 0x1D, 0x79, 0x14, 0x0E, 0x50, 0x75, 0x68, 0x1D, 0x4D, 0xC4, 0xF2, 0xE5, 0xAA,
-    0xA6, 0x4E, 0xD3, 0x41, 0x8A, 0x09, 0x07, 0xB2, 0x55, 0x39, 0xEA, 0x39, 0xA0, 0x2E, 0x4D, 0x55,
-    0x3F, 0xEB, 0xD5, 0xA7, 0xF1, 0x7B, 0x76, 0x62, 0x37, 0x9D, 0x38, 0x1E, 0x84, 0x3D, 0x81, 0xB5,
-    0xAA, 0x13, 0x2A, 0x04, 0x65, 0x7E, 0xF8, 0x9E, 0x87, 0xEC, 0x74, 0x27, 0xEA, 0xCB, 0x6C, 0xAB,
-    0xFE, 0x6E, 0xD3, 0x49, 0x63, 0x54, 0x59, 0xC2, 0xF7, 0xDB, 0x4E, 0x48, 0x4E, 0xB6, 0xE9, 0x24,
-    0xE7, 0x07, 0x05, 0x09, 0xFE, 0x21, 0x0F, 0xDF, 0x57, 0x53, 0xDA, 0x83, 0xBD, 0xE7, 0x90, 0x1F,
-    0xE4, 0x64, 0xF2, 0x1E, 0x3E, 0xB7, 0x5B, 0x4D, 0xC9, 0x60, 0xAA, 0xAB, 0xD3, 0x33, 0x59, 0x27,
-    0x17, 0x8F, 0x26, 0x7B, 0x3C, 0xB8, 0x37, 0x1F, 0x4B, 0xF1, 0xF9, 0xE8, 0xEE, 0x3D, 0x95, 0xE2,
-    0xF1, 0xEC, 0x8E, 0x07, 0x58, 0xCB, 0x6D, 0xFB, 0xF9, 0x6C, 0xF2, 0x13, 0x69, 0xB2, 0xD9, 0xC2,
-    0x4E, 0x2E, 0x42, 0xA2, 0x77, 0x83, 0x1F, 0xED, 0x53, 0x3A, 0x3A, 0xEE, 0x19, 0xDD, 0xDE, 0x7E,
-    0xAF, 0x03, 0x45, 0x34, 0xD4, 0x09, 0xD4, 0xC1, 0xDE, 0xA1, 0xBA, 0x88, 0x1F, 0xD1, 0x83, 0xC9,
-    0xCF, 0x8C, 0x3C, 0x01, 0xF9, 0xF1, 0xF6, 0x92, 0xB3, 0x21, 0xF5, 0xB9, 0xFA, 0x77, 0x5E, 0x32,
-    0x0E, 0x80, 0xC6, 0xC9, 0xC1, 0x73, 0xA2, 0xF9, 0x07, 0xF5, 0x87, 0xFB, 0x27, 0x8C, 0x0F, 0x1D,
-    0xFC, 0xA5, 0xD0, 0x4F, 0xB6, 0xF6, 0x20, 0x1F, 0xBF, 0xE7, 0xF9, 0x49, 0x16, 0x71, 0xEA, 0x64,
-    0x04, 0x75, 0x97, 0xCE, 0x9A, 0x26, 0x43, 0x0F, 0x90, 0x60, 0x4F, 0x95, 0x8E, 0x41, 0x77, 0x9A,
-    0xF9, 0x11, 0x89, 0xA7, 0xCD, 0xD3, 0xF0, 0x19, 0x1C, 0x9A, 0xC8, 0x9D, 0xD0, 0x13, 0xF7, 0xF4,
-    0xD8, 0xC6, 0x1D, 0x3A, 0x68, 0xEA, 0x8A, 0x0C, 0xB5, 0x35, 0xBD, 0x2E, 0xB8, 0x3B, 0x28, 0x87,
-    0x73, 0xA1, 0x25, 0xCC, 0x7C, 0x75, 0x6D, 0xD4, 0xCF, 0xAF, 0x28, 0x0F, 0xCA, 0x29, 0x1D, 0x33,
-    0xD0, 0x4D, 0xEA, 0xEE, 0x84, 0xDE, 0x07, 0xF4, 0x3E, 0xE6, 0x64, 0xCD, 0xBE, 0x7C, 0xBA, 0x78,
-    0x33, 0xD1, 0x60, 0xA7, 0x91, 0xC5, 0xD0, 0x96, 0x8D, 0x15, 0x86, 0x8C, 0x0E, 0xFE, 0x17, 0x0D,
-    0x8B, 0x88, 0x90, 0x76, 0x82, 0x0B, 0xF0, 0xC6, 0xD6, 0x52, 0x66, 0x5D, 0xD6, 0xAF, 0xE6, 0x37,
-    0xE4, 0x0B, 0xBA, 0xF7, 0x7B, 0x24, 0xD9, 0x71, 0x84, 0xC3, 0x5F, 0xD3, 0xC0, 0x72, 0x75, 0x72,
-    0xA0, 0xB0, 0x18, 0x03, 0x21, 0xC5, 0xB8, 0x75, 0x9B, 0x98, 0x4D, 0xD8, 0x87, 0xE2, 0xCB, 0xC3,
-    0xF7, 0x8A, 0xC6, 0xAB, 0x22, 0xF9, 0xAF, 0xBB, 0xBC, 0x87, 0x5D, 0x6A, 0xEB, 0xE5, 0x38, 0x3E,
-    0x67, 0xB2, 0xC9, 0xEB, 0x53, 0x2C, 0xCF, 0x80, 0xBC, 0xBC, 0xCC, 0x29, 0x83, 0x19, 0xCF, 0x26,
-    0xEB, 0x27, 0xD3, 0x81, 0x88, 0x7A, 0x4F, 0xBE, 0x80, 0x22, 0x61, 0xEA, 0x08, 0x4C, 0x25, 0xF6,
-    0x35, 0x03, 0x54, 0x3A, 0x79, 0x53, 0x88, 0xA6, 0x30, 0x45, 0x7B, 0x3C, 0xF3, 0x85, 0x21, 0x09,
-    0xFC, 0xE8, 0xDD, 0x98, 0x08, 0xA8, 0xAB, 0xEE, 0xE3, 0xFE, 0x89, 0x94, 0xF1, 0x0C, 0x17, 0x27,
-    0xD7, 0x70, 0xE3, 0x81, 0x7C, 0xA9, 0xC1, 0x6B, 0x54, 0x45, 0x72, 0x42, 0xB7, 0xE7, 0xB9, 0x75,
-    0xCA, 0x0D, 0x1C, 0x92, 0xD9, 0x34, 0x14, 0xDA, 0x09, 0x65, 0x4D, 0x2D, 0x27, 0x03, 0x0A, 0x2A,
-    0x11, 0x35, 0x07, 0xBC, 0x74, 0x9D, 0xE7, 0x29, 0x54, 0xDC, 0x8B, 0x7F, 0x8D, 0xC9, 0x34, 0x98,
-    0x0C, 0xFC, 0x24, 0xF6, 0x0C, 0xBC, 0xE2, 0x7E, 0x01, 0x8E, 0x1D, 0x72, 0xA1, 0x14, 0xA1, 0xBA,
-    0x4D, 0xD5, 0x66, 0x5D, 0x24, 0x11, 0x08, 0xEB, 0x72, 0x34, 0x60, 0xA6, 0x55, 0xA7, 0x41, 0x1C,
-    0xD3, 0x87, 0x03, 0x46, 0x87, 0xA0, 0x60, 0x9D, 0x63, 0x2E, 0xAF, 0x22, 0x52, 0x0D, 0x50, 0x51,
-    0x77, 0x8C, 0x60, 0x39, 0x3A, 0xCC, 0xE0, 0x18, 0x2F, 0xAB, 0x16, 0xD1, 0x1E, 0x00, 0x7F, 0xA0,
-    0x1B, 0x05, 0x95, 0xF5, 0x1F, 0x18, 0x3B, 0x0A, 0xC5, 0x01, 0x3D, 0x26, 0x25, 0xA5, 0xFD, 0xCC,
-    0x75, 0xB6, 0x89, 0x67, 0x04, 0x2B, 0x7B, 0x0C, 0x3F, 0xFB, 0x08, 0xF3, 0x9C, 0xE0, 0x07, 0xDD,
-    0x75, 0x04, 0x91, 0x07, 0x03, 0xA6, 0x22, 0x1F, 0xBB, 0xB9, 0x08, 0xFE, 0x92, 0x71, 0x7C, 0x30,
-    0xEE, 0xEB, 0x29, 0x38, 0x0C, 0x77, 0x67, 0xFE, 0xA5, 0xEB, 0xD0, 0x4F, 0x6F, 0x3D, 0x2C, 0x1A,
-    0xA3, 0x5B, 0x81, 0x4B, 0xF9, 0x50, 0x0C, 0xC5, 0x68, 0xF1, 0x8F, 0x40, 0x35, 0xED, 0x06, 0xCE,
-    0x6F, 0x3D, 0xB1, 0x1D, 0xB4, 0x8E, 0x73, 0x2B, 0x49, 0x6A, 0x2D, 0xC3, 0x99, 0x48, 0xBB, 0x77,
-    0x78, 0xE0, 0x20, 0x06, 0xF8, 0xD0, 0xC4, 0x3B, 0x55, 0x30, 0xD0, 0x42, 0x6E, 0xCD, 0x73, 0x97,
-    0xFC, 0x0B, 0x7A, 0xCA, 0xE9, 0x0A, 0x53, 0xBA, 0x9C, 0x3D, 0xF6, 0x10, 0xD1, 0x14, 0x30, 0x45,
-    0xC5, 0x2D, 0xB4, 0x62, 0x4E, 0x3F, 0xD1, 0x9B, 0x96, 0x37, 0x0D, 0xAF, 0xC9, 0xEA, 0x13, 0x0F,
-    0x6C, 0x5A, 0xF3, 0x3C, 0x31, 0x8A, 0x4A, 0x80, 0xA6, 0xEA, 0xF8, 0x91, 0xB9, 0xA0, 0xAF, 0x1A,
-    0x05, 0x63, 0x66, 0xAF, 0x3C, 0xF7, 0xC6, 0x2D, 0x82, 0x35, 0xB5, 0x20, 0xCC, 0x7A, 0xBC, 0xB2,
-    0xA1, 0x31, 0xBA, 0x74, 0xC1, 0x73, 0x61, 0xA0, 0xCE, 0xB8, 0xA7, 0x87, 0xEF, 0xFE, 0x40, 0xEF,
-    0xBF, 0xAD, 0x0F, 0xD5, 0xC3, 0xA6, 0xCA, 0x99, 0x5C, 0xFB, 0x4D, 0x28, 0x42, 0xD2, 0xA8, 0x4E,
-    0x54, 0x6F, 0x29, 0x81, 0x7C, 0xA0, 0x8F, 0x47, 0x8E, 0x0D, 0x11, 0x2B, 0x69, 0x80, 0x4D, 0xF2,
-    0x59, 0xA2, 0x44, 0xE6, 0x8A, 0xA0, 0x2A, 0x1E, 0x7C, 0xAF, 0x7B, 0xBB, 0x10, 0xF9, 0x90, 0x3E,
-    0x86, 0x80, 0x05, 0x7D, 0x91, 0x8E, 0x84, 0x3A, 0x53, 0x20, 0x68, 0x96, 0x6B, 0xEF, 0xC8, 0x11,
-    0x74, 0xBD, 0x5B, 0xB7, 0x4B, 0x83, 0xCE, 0x3B, 0x1B, 0x16, 0xFF, 0xD4, 0xE1, 0x3C, 0x92, 0x6D,
-    0x46, 0xB1, 0x8F, 0x51, 0xA4, 0x47, 0x9E, 0x6E, 0x1B, 0x60, 0x45, 0x4E, 0x10, 0x57, 0x9A, 0xEF,
-    0xFA, 0xA3, 0xEF, 0x54, 0xC2, 0xBC, 0x13, 0xA0, 0x61, 0xD3, 0x01, 0xB2, 0xF1, 0xDC, 0x65, 0x2F,
-    0xCD, 0x9B, 0x0A, 0x4C, 0xC5, 0x07, 0x1C, 0xE5, 0x43, 0x71, 0x12, 0x21, 0xEC, 0x33, 0x7A, 0xD9,
-    0x52, 0x23, 0x9C, 0x35, 0x86, 0x2C, 0x79, 0x09, 0x3E, 0x2E, 0x7D, 0x68, 0x6E, 0x23, 0x30, 0x43,
-    0xB3, 0xBA, 0xD5, 0x98, 0x5E, 0xED, 0xE2, 0x75, 0xD6, 0xFE, 0x28, 0x69, 0xB2, 0xD2, 0xD6, 0x6D,
-    0x66, 0x5E, 0x8C, 0xE6, 0xA4, 0x7C, 0x11, 0x40, 0x70, 0xF8, 0x9B, 0xA8, 0xCF, 0x90, 0x36, 0x58,
-    0x69, 0x3F, 0xC0, 0x2C, 0x9D, 0x5C, 0xEF, 0x60, 0x30, 0xEE, 0x16, 0x4C, 0x9A, 0x08, 0x86, 0xBE,
-    0x96, 0x48, 0x10, 0xB3, 0x2A, 0xBD, 0x17, 0xFA, 0xFD, 0x1E, 0x0D, 0xD4, 0x63, 0x59, 0x9E, 0x1A,
-    0xAF, 0x06, 0x2A, 0x73, 0x95, 0x47, 0xE4, 0xE6, 0x4B, 0xA7, 0xE7, 0x15, 0xBC, 0xA3, 0x9F, 0x0D,
-    0x38, 0xA1, 0x7A, 0xEA, 0xF4, 0x96, 0x25, 0x5B, 0x4C, 0xFE, 0x8D, 0x8F, 0x73, 0x1A, 0xFC, 0x26,
-    0x7A, 0xFF, 0x95, 0x28, 0xDB, 0xE5, 0xE7, 0x1C, 0xB6, 0x5A, 0xD3, 0x21, 0xDB, 0xCE, 0xBB, 0x0A,
-    0x72, 0x09, 0xFE, 0x09, 0xB7, 0x62, 0xF9, 0xE5, 0x9B, 0x93, 0xF2, 0xC2, 0x8B, 0x0E, 0x52, 0xB0,
-    0x12, 0x4C, 0x16, 0x84, 0x69, 0xB6, 0xD0, 0x27, 0x74, 0x12, 0x33, 0x39, 0x8A, 0xE1, 0xE9, 0x4C,
-    0x1C, 0x50, 0x1F, 0xB5, 0x06, 0xCA, 0x00, 0xAD, 0xAD, 0x08, 0xC7, 0xE9, 0x91, 0x78, 0x80, 0xF0,
-    0xDB, 0x88, 0x0E, 0x04, 0x9C, 0xC0, 0xC1, 0x6E, 0x0E, 0xBC, 0x7C, 0x1E, 0x3A, 0xC1, 0x89, 0x12,
-    0x80, 0xE8, 0xCB, 0x7A, 0xD9, 0xE1, 0x29, 0x7A, 0x84, 0x82, 0x8D, 0x0A, 0xF2, 0x7C, 0xEB, 0xB3,
-    0x2B, 0x6E, 0xE4, 0xD3, 0xED, 0x61, 0xF0, 0x2F, 0x87, 0xCF, 0xB6, 0x96, 0xBA, 0x0F, 0xB7, 0xCD,
-    0xDE, 0x1A, 0x92, 0x3E, 0x6A, 0x86, 0x53, 0xC7, 0x9A, 0x36, 0x38, 0xF9, 0xF2, 0x56, 0xC9, 0x68,
-    0xEB, 0x81, 0xAF, 0xEA, 0x83, 0x49, 0x54, 0x77, 0x9D, 0x02, 0x1C, 0x0F, 0x5F, 0xBA, 0xEF, 0x6C,
-    0x2A, 0xEE, 0x50, 0xDE, 0x8A, 0xFC, 0xFE, 0xDC, 0x6F, 0x35, 0x11, 0x2B, 0xC9, 0x9C, 0x7E, 0xA5,
-    0x4D, 0x8E, 0x33, 0x28, 0xB7, 0x6A, 0xA3, 0xCD, 0x28, 0x50, 0x76, 0xA0, 0x49, 0xDB, 0xA7, 0x3A,
-    0xC1, 0x56, 0x3F, 0x6B, 0x34, 0x13, 0x81, 0x04, 0x13, 0xF8, 0x75, 0xC6, 0xDF, 0x63, 0x2A, 0xF9,
-    0x48, 0xFF, 0x5C, 0xDD, 0x67, 0x78, 0x99, 0xD9, 0x2C, 0xBE, 0x16, 0x12, 0xBA, 0x69, 0xC6, 0xDA,
-    0xB4, 0x6C, 0x26, 0x7C, 0x21, 0x92, 0xCF, 0x05, 0x9E, 0x62, 0xD2, 0xCE, 0x8E, 0x65, 0x61, 0x8B,
-    0xBC, 0x26, 0x0B, 0x5F, 0xC6, 0x44, 0x82, 0x18, 0xFE, 0x44, 0xD7, 0x75, 0x4B, 0xD6, 0xBC, 0xBB,
-    0x5A, 0xA0, 0x7C, 0x5B, 0x3C, 0xBD, 0x52, 0xAA, 0xD5, 0x29, 0x50, 0x52, 0xF5, 0xD0, 0x5C, 0xD1,
-    0x7D, 0xFC, 0x63, 0xE5, 0x18, 0x79, 0x37, 0x72, 0x4A, 0x1D, 0x67, 0xD4, 0x50, 0x7D, 0x3D, 0x7E,
-    0x52, 0xD4, 0x45, 0xD5, 0x83, 0xBE, 0x5C, 0xB9, 0x9C, 0x2D, 0x09, 0x63, 0xC3, 0x91, 0x5F, 0xE5,
-    0x98, 0xD9, 0x46, 0x3E, 0xCF, 0x1E, 0x3A, 0xE1, 0xD5, 0x66, 0x9F, 0x2E, 0xFB, 0xC0, 0xD4, 0x87,
-    0xBD, 0x53, 0x7F, 0xC3, 0x04, 0xB4, 0x2F, 0x76, 0xF7, 0xCE, 0x13, 0x63, 0xFB, 0xEF, 0xD8, 0x87,
-    0xD3, 0x7B, 0xA5, 0xC2, 0x3F, 0xFF, 0xC1, 0x7F, 0x96, 0x21, 0xAB, 0x54, 0x5E, 0x37, 0xEA, 0x3F,
-    0x09, 0xB1, 0xC4, 0x63, 0x91, 0x03, 0xF3, 0x53, 0x0D, 0x6E, 0x8B, 0xF8, 0x89, 0xBF, 0xB6, 0x36,
-    0x64, 0x07, 0x7F, 0x51, 0x87, 0x8B, 0xF3, 0x97, 0xA8, 0x1A, 0x10, 0xE2, 0x0D, 0x4B, 0x58, 0x84,
-    0x79, 0x21, 0x01, 0x83, 0xBF, 0x1D, 0x99, 0x76, 0x5E, 0xA5, 0xAD, 0x3A, 0xE4, 0x95, 0xA5, 0x9A,
-    0x8F, 0x5C, 0xDA, 0x0B, 0xC6, 0x31, 0xEA, 0xD0, 0xCC, 0x01, 0xF4, 0xC2, 0x8B, 0x5B, 0x11, 0xD5,
-    0x9A, 0xD1, 0xE0, 0x69, 0xA9, 0xD1, 0x18, 0xB1, 0x90, 0x1F, 0x86, 0x66, 0xCD, 0xE6, 0x10, 0x9A,
-    0xF9, 0x68, 0xA9, 0x3A, 0x47, 0x67, 0x9A, 0x93, 0x65, 0x02, 0xF4, 0x11, 0x27, 0xB5, 0x34, 0x3F,
-    0xBE, 0xB2, 0x3F, 0x69, 0x9A, 0xFE, 0x11, 0x0F, 0xB3, 0x36, 0x1F, 0x7C, 0xAB, 0x49, 0xB0, 0xF0,
-    0x40, 0x6D, 0x01, 0xCD, 0x58, 0xBE, 0x62, 0x9A, 0x24, 0x15, 0xB9, 0xD2, 0xD9, 0x9D, 0xFF, 0xE2,
-    0xEC, 0x7F, 0xAF, 0xFF, 0x83, 0xF5, 0xFF, 0xA3, 0xFF, 0xA7, 0x6E, 0xEC, 0x7A, 0xDF, 0x6C, 0x5A,
-    0x1A, 0x44, 0x36, 0xE4, 0x63, 0xBE, 0x34, 0x8A, 0x05, 0x79, 0x91, 0xAF, 0xAA, 0x39, 0x94, 0x9C,
-    0x82, 0x71, 0xDB, 0x85, 0x46, 0xB5, 0xA0, 0x3C, 0x76, 0xAA, 0xF1, 0xD2, 0x6D, 0x3B, 0xCD, 0x0F,
-    0x2A, 0x72, 0x56, 0x1A, 0x46, 0x39, 0xD5, 0x46, 0x4C, 0x6B, 0x1D, 0xD3, 0xB2, 0x9E, 0x77, 0xC1,
-    0xDA, 0xA1, 0xB7, 0x30, 0x5C, 0x8B, 0x38, 0x8C, 0x0E, 0x89, 0x65, 0x6C, 0x57, 0x31, 0x5D, 0xA3,
-    0xC9, 0xDA, 0x4F, 0x70, 0x9D, 0x90, 0x01, 0xA6, 0xFA, 0x03, 0xC6, 0x4F, 0x27, 0x95, 0x19, 0xB5,
-    0xC3, 0x7B, 0x7C, 0xAD, 0x2A, 0x28, 0x24, 0x37, 0xEA, 0xFA, 0x33, 0xE9, 0x97, 0x58, 0xAD, 0x01,
-    0x30, 0xD2, 0x3A, 0x81, 0xC2, 0x8C, 0x95, 0xDC, 0xA2, 0x27, 0x1C, 0x1C, 0x8D, 0xE0, 0x2A, 0x49,
-    0x41, 0x0E, 0x35, 0xC6, 0x34, 0xEF, 0xDE, 0x0E, 0xFC, 0x46, 0xCD, 0x82, 0xF3, 0xDE, 0x36, 0x86,
-    0x90, 0xCF, 0xE4, 0xC3, 0x4E, 0x1C, 0xDA, 0x09, 0x48, 0xF5, 0x0E, 0x93, 0x8A, 0xFE, 0x14, 0x93,
-    0x36, 0x8D, 0xC3, 0x5F, 0xAB, 0x88, 0x29, 0xE1, 0x6D, 0x83, 0x1A, 0xB6, 0xCE, 0x35, 0x2E, 0x46,
-    0xA4, 0x59, 0xBA, 0x9C, 0x49, 0x32, 0xF2, 0x4A, 0x4A, 0x18, 0xD6, 0xC3, 0x74, 0x02, 0x49, 0x26,
-    0x41, 0x7D, 0x81, 0x17, 0x34, 0xE3, 0xAC, 0x0B, 0x5E, 0x80, 0x66, 0x79, 0x07, 0x96, 0x5F, 0x29,
-    0x70, 0x48, 0xA9, 0xC8, 0x55, 0x2F, 0x0F, 0x07, 0xFB, 0x95, 0x5C, 0x9F, 0x71, 0x81, 0xD9, 0xDE,
-    0x1A, 0xEC, 0x13, 0x91, 0xC7, 0x50, 0x3B, 0x24, 0x31, 0x10, 0x7A, 0xEF, 0xA0, 0x3F, 0x47, 0xF2,
-    0x0B, 0x10, 0x00, 0x7D, 0xB4, 0x68, 0x1E, 0xA1, 0x0B, 0xAA, 0x04, 0x78, 0xF0, 0x1A, 0x2E, 0x10,
-    0x02, 0x00, 0xF0, 0xE0, 0x51, 0x12, 0x5E, 0xD8, 0x35, 0xFC, 0xB4, 0xF2, 0xD8, 0x5B, 0xD5, 0xFA,
-    0xAD, 0x1B, 0x08, 0x40, 0x74, 0xB2, 0x15, 0x9E, 0x20, 0x43, 0x48, 0x49, 0x1E, 0xA2, 0x22, 0xD3,
-    0x01, 0xFA, 0x64, 0x38, 0x8D, 0x86, 0xCD, 0xC9, 0xD0, 0x7F, 0x74, 0x19, 0xB1, 0x5B, 0x89, 0xE6,
-    0xC3, 0x31, 0x1B, 0xF3, 0x09, 0x8F, 0xEF, 0xC8, 0x83, 0x19, 0xCD, 0xD9, 0x76, 0x18, 0xF7, 0x13,
-    0xB9, 0x3E, 0x14, 0x73, 0x36, 0xA3, 0xD9, 0x3A, 0xC0, 0xF6, 0x39, 0x56, 0x63, 0x2C, 0x08, 0x78,
-    0x22, 0x1A, 0x29, 0x74, 0x01, 0x4D, 0x30, 0xE0, 0x55, 0x26, 0x42, 0x70, 0x4B, 0x60, 0x8C, 0xD6,
-    0x9D, 0x7C, 0x8C, 0xD7, 0x7C, 0x44, 0x14, 0x5C, 0x50, 0xA5, 0x56, 0x8C, 0x66, 0x2D, 0x13, 0x76,
-    0x20, 0x51, 0xC7, 0xBB, 0x5A, 0x15, 0xB3, 0x3D, 0xD3, 0x84, 0x74, 0xA6, 0x2A, 0xD2, 0x00, 0x55,
-    0x69, 0xBD, 0x74, 0xBD, 0xF2, 0xBE, 0xA9, 0x52, 0xBE, 0xAF, 0x0F, 0x7A, 0x7D, 0x30, 0xF9, 0x07,
-    0x99, 0xFA, 0xEC, 0x23, 0x85, 0xD7, 0xC8, 0x70, 0xDE, 0xFD, 0x49, 0x28, 0x3E, 0xCD, 0xEA, 0x85,
-    0xA4, 0x74, 0xDB, 0x38, 0x4A, 0x97, 0xC4, 0x98, 0x1F, 0x9C, 0xC3, 0x05, 0x3A, 0x07, 0xFF, 0xF7,
-    0xEC, 0xE1, 0x4D, 0x45, 0x02, 0x1A, 0x48, 0xA8, 0xF2, 0xD0, 0x2F, 0xE4, 0x5D, 0xE0, 0x2D, 0xE0,
-    0x93, 0x94, 0xAB, 0x39, 0x21, 0xB8, 0xCE, 0xA9, 0xF9, 0xD5, 0x67, 0x3F, 0xD1, 0xEC, 0x61, 0x4E,
-    0x97, 0xEA, 0x5D, 0x8D, 0x21, 0x06, 0xCE, 0xAE, 0x4C, 0xE9, 0xF2, 0xD4, 0xAD, 0x51, 0xF3, 0xD5,
-    0xCD, 0x69, 0x2C, 0x53, 0x3B, 0x96, 0x6E, 0xF7, 0x56, 0x35, 0xEE, 0x00, 0xA7, 0x88, 0x7A, 0xAF,
-    0x3E, 0xB4, 0x56, 0x5B, 0xE1, 0x5B, 0x2E, 0xF8, 0xB1, 0x35, 0x55, 0xCD, 0x32, 0x47, 0x2C, 0x57,
-    0x7A, 0x43, 0xCD, 0x15, 0x4A, 0xAF, 0x61, 0xAA, 0x5F, 0x29, 0xB8, 0x68, 0x3D, 0xDF, 0x9A, 0x60,
-    0xE8, 0x9E, 0x71, 0xC1, 0xF4, 0x83, 0x7D, 0x04, 0x67, 0x00, 0xDE, 0x23, 0x6D, 0x40, 0x4F, 0xD9,
-    0x13, 0x59, 0x27, 0xF2, 0x59, 0xE5, 0x83, 0x0E, 0x5D, 0x67, 0xE1, 0x79, 0xA4, 0xBE, 0xCC, 0x3B,
-    0xF4, 0x6E, 0xF1, 0xEB, 0x21, 0xCA, 0x2A, 0x6D, 0xB5, 0x87, 0xB0, 0xE5, 0xA9, 0x93, 0x67, 0xE2,
-    0x21, 0x13, 0xD1, 0xD2, 0x97, 0x07, 0x33, 0x8A, 0x3E, 0x7B, 0xF2, 0x63, 0x61, 0x01, 0xC3, 0xD5,
-    0x38, 0xB0, 0xD6, 0xBB, 0x1C, 0x10, 0x84, 0x58, 0xF1, 0x65, 0xB5, 0xF7, 0x29, 0x70, 0x1A, 0xE3,
-    0x06, 0xC7, 0x1F, 0x37, 0x07, 0x5E, 0xBE, 0x86, 0x70, 0x3F, 0x72, 0x56, 0xCC, 0x88, 0x78, 0x68,
-    0x79, 0xE8, 0x10, 0x44, 0xFC, 0x61, 0xE0, 0x61, 0xB4, 0x33, 0x0E, 0x2F, 0xDC, 0x34, 0x87, 0xEF,
-    0x2F, 0x95, 0x50, 0x4A, 0xC1, 0xA3, 0x4B, 0xCD, 0x74, 0x4D, 0x10, 0xFA, 0xFA, 0xC2, 0x12, 0x73,
-    0x42, 0x3D, 0x55, 0xB1, 0xDD, 0xE4, 0xEB, 0x79, 0xA5, 0xF2, 0xFF, 0x44, 0x41, 0x1D, 0x95, 0x63,
-    0x33, 0xFB, 0x3E, 0x80, 0x71, 0xC2, 0x9C, 0xCE, 0x2C, 0x66, 0x06, 0x69, 0xBC, 0xC4, 0x64, 0x6A,
-    0x45, 0x5D, 0xF6, 0xB5, 0xDC, 0x3B, 0x5A, 0x26, 0xF6, 0x8A, 0x96, 0x7A, 0x3C, 0xB2, 0xAF, 0x1D,
-    0x2E, 0x89, 0xA3, 0xC8, 0x23, 0xD9, 0x20, 0x07, 0x4D, 0xF1, 0x03, 0x7E, 0xE8, 0x4E, 0x53, 0xA4,
-    0x9A, 0xB1, 0x94, 0x8C, 0x37, 0xC0, 0x33, 0xD7, 0xDB, 0x14, 0xBA, 0x77, 0xF7, 0x7F, 0xED, 0x76,
-    0xAA, 0x22, 0x29, 0x74, 0x5A, 0x8A, 0xB1, 0x56, 0x0A, 0xA1, 0xCE, 0xDE, 0xAE, 0xE8, 0xB9, 0x18,
-    0xDD, 0xEC, 0x64, 0xCF, 0x34, 0x8F, 0xD8, 0x1C, 0xBF, 0xDD, 0xAC, 0xD9, 0x1C, 0xD4, 0xD8, 0xE0,
-    0xFC, 0xBE, 0xBB, 0x89, 0xE4, 0x0E, 0xEF, 0xBE, 0x43, 0x8F, 0x33, 0x14, 0xF2, 0xA5, 0x93, 0x97,
-    0x25, 0x24, 0xA1, 0xBE, 0x42, 0x22, 0x5D, 0x22, 0x21, 0x8D, 0xD5, 0x3C, 0x56, 0x42, 0xD5, 0x37,
-    0xD8, 0xB2, 0x6A, 0xF1, 0x5D, 0x4D, 0x3E, 0x02, 0x5E, 0x66, 0xE4, 0x2B, 0x46, 0x6A, 0x3E, 0x5A,
-    0x55, 0xAF, 0xFA, 0xCF, 0xD8, 0xD3, 0x84, 0xB2, 0x1F, 0xA2, 0x0F, 0xF8, 0x87, 0x5B, 0x15, 0xE3,
-    0xEE, 0x9A, 0x85, 0x59, 0x2D, 0xB7, 0x19, 0xD6, 0xFF, 0x89, 0x97, 0x1F, 0xD0, 0x14, 0xAB, 0x59,
-    0x0B, 0xD6, 0xAA, 0x0D, 0xB1, 0x46, 0x19, 0x4D, 0x93, 0xF4, 0x96, 0x82, 0x2A, 0xCD, 0xC5, 0x34,
-    0x61, 0x84, 0xCE, 0x8C, 0x2A, 0x8B, 0xD9, 0x23, 0x7C, 0xBC, 0xF4, 0x82, 0x6A, 0xD6, 0xEA, 0xF0,
-    0x9A, 0xF8, 0x72, 0xC9, 0x03, 0xEF, 0x69, 0xAB, 0x5E, 0xF9, 0x0B, 0xF2, 0x72, 0x7D, 0x37, 0x93,
-    0x38, 0x88, 0xB1, 0x16, 0x2F, 0x8F, 0x35, 0xF8, 0x4D, 0xED, 0x47, 0x7A, 0x5B, 0x83, 0x7C, 0x2A,
-    0x33, 0xE6, 0xDF, 0x68, 0x33, 0xA6, 0x23, 0x2C, 0x19, 0x50, 0x10, 0x47, 0x31, 0x9B, 0x35, 0x0B,
-    0xBD, 0xB0, 0x0A, 0x80, 0x38, 0xF2, 0x33, 0x17, 0x98, 0xDC, 0x9B, 0x44, 0x0D, 0x0F, 0x59, 0x50,
-    0x57, 0x85, 0xBC, 0x45, 0x62, 0xC1, 0xB9, 0xFB, 0x24, 0x37, 0xD1, 0x82, 0x0E, 0x83, 0x11, 0x9C,
-    0x32, 0x49, 0xB6, 0x1A, 0x6B, 0x48, 0xC6, 0xAC, 0xE1, 0x15, 0x1E, 0x09, 0x76, 0xB5, 0xA6, 0xEA,
-    0x21, 0x86, 0x6A, 0xE4, 0x6D, 0x8D, 0x2C, 0x95, 0x8A, 0x91, 0xEA, 0x53, 0x74, 0x5A, 0xCE, 0x6D,
-    0x89, 0x28, 0x58, 0x61, 0xEF, 0x34, 0x5F, 0x1A, 0x98, 0x2E, 0xE5, 0x53, 0xAE, 0x31, 0xA5, 0x1A,
-    0x76, 0x96, 0x03, 0xD6, 0x4B, 0xE4, 0x46, 0x9F, 0x2A, 0xB5, 0xE0, 0xB6, 0x94, 0x2B, 0xA2, 0xB0,
-    0x96, 0x8C, 0x4C, 0x64, 0xCB, 0x6D, 0x40, 0x1F, 0x8A, 0x64, 0x22, 0x70, 0x63, 0x61, 0x94, 0xA4,
-    0xA4, 0xD2, 0xA6, 0xF4, 0xB2, 0x50, 0x0B, 0xC8, 0x70, 0xB4, 0x7C, 0x34, 0xFB, 0x28, 0xE0, 0xE8,
-    0xC6, 0x1B, 0x0C, 0x94, 0x4D, 0x2B, 0xAD, 0xF6, 0xC6, 0x4C, 0xE2, 0x6A, 0x50, 0x04, 0x72, 0xF2,
-    0x89, 0x7E, 0xD5, 0x2A, 0xE9, 0x55, 0x4F, 0x53, 0x86, 0x45, 0xB1, 0xAA, 0xF6, 0xC7, 0x59, 0x89,
-    0xEC, 0xD5, 0x41, 0x35, 0x0B, 0xC6, 0x28, 0x7C, 0xCA, 0xA1, 0x8A, 0xEF, 0x46, 0x15, 0x48, 0xBB,
-    0x49, 0x3F, 0x0A, 0x2F, 0xDE, 0x61, 0x83, 0x4D, 0x35, 0xE5, 0xD5, 0xCA, 0x97, 0x51, 0x2E, 0x25,
-    0xDB, 0xD5, 0x1E, 0xBF, 0x46, 0xD3, 0x78, 0xC7, 0xE8, 0xD4, 0x57, 0xBE, 0x05, 0x90, 0xBD, 0xE6,
-    0xA0, 0x5A, 0xC3, 0x10, 0xCD, 0xF6, 0x64, 0x19, 0x73, 0xA5, 0xAA, 0x45, 0x20, 0xC0, 0x26, 0xC1,
-    0x86, 0x68, 0x31, 0xCC, 0xE7, 0x99, 0xE3, 0xC2, 0xCA, 0xC2, 0x2F, 0x03, 0xC8, 0x93, 0x2B, 0x97,
-    0xB2, 0x4D, 0x06, 0xE1, 0xDD, 0x88, 0x4F, 0x29, 0x76, 0x7D, 0x44, 0xBF, 0x77, 0xF8, 0x7E, 0xCA,
-    0x2C, 0x82, 0x1B, 0x90, 0x0E, 0xB7, 0xFE, 0xF4, 0xD6, 0x6D, 0xB7, 0xFC, 0xF4, 0x56, 0xF8, 0xAD,
-    0xDD, 0x6E, 0xC8, 0x4F, 0x11, 0xDB, 0xCE, 0x6E, 0x4D, 0xD8, 0x2A, 0xE2, 0x99, 0x6E, 0x77, 0xF3,
-    0xE5, 0xDA, 0xBF, 0x35, 0xE6, 0xEF, 0x8D, 0xF9, 0x91, 0x31, 0x2F, 0x32, 0x3F, 0x67, 0xC9, 0xBC,
-    0x2A, 0xF9, 0x7E, 0xD1, 0xB0, 0x40, 0x9D, 0xE9, 0xF2, 0x42, 0x3A, 0xB0, 0xEA, 0xE6, 0xD7, 0x1D,
-    0x58, 0x53, 0x66, 0x5A, 0xDB, 0xE8, 0xB2, 0x44, 0x4B, 0x2B, 0x47, 0x0C, 0x25, 0xE9, 0x23, 0x93,
-    0x9F, 0x64, 0xE0, 0x7A, 0xC9, 0x0A, 0x89, 0x15, 0xB8, 0x01, 0xDE, 0x94, 0x6F, 0x1D, 0x02, 0xDF,
-    0xAD, 0xFD, 0xA6, 0x04, 0xB5, 0xA7, 0x88, 0xF6, 0xD3, 0x38, 0x33, 0xB7, 0xDD, 0x69, 0x9F, 0xE5,
-    0x88, 0xB2, 0x29, 0xDD, 0x6C, 0x7E, 0xD0, 0xED, 0x96, 0x4B, 0xD8, 0x32, 0xDD, 0x36, 0xE1, 0x78,
-    0x0A, 0xA5, 0x91, 0x4A, 0xF3, 0x1A, 0x10, 0xFF, 0xC7, 0x11, 0x11, 0xCC, 0x35, 0xAE, 0xF4, 0xCB,
-    0x52, 0x3E, 0x60, 0x7E, 0xA5, 0xC2, 0xD9, 0xC2, 0x7F, 0x6A, 0xD5, 0x95, 0xD2, 0xAF, 0x97, 0xD0,
-    0x8E, 0x08, 0x71, 0x36, 0x7D, 0x5E, 0x18, 0x14, 0xD8, 0xD6, 0x90, 0x68, 0x9B, 0x9D, 0xB8, 0x31,
-    0xE9, 0x63, 0x89, 0x07, 0xB0, 0x85, 0x0E, 0xC2, 0x9A, 0xD5, 0x94, 0x83, 0x4D, 0xAF, 0x23, 0xEF,
-    0xFE, 0xA4, 0x07, 0x5B, 0xFE, 0x0D, 0xCC, 0xCB, 0x81, 0x33, 0xB4, 0x26, 0xEC, 0x82, 0x1A, 0xC2,
-    0x93, 0xBA, 0x75, 0x3A, 0x97, 0xDB, 0x3A, 0xCE, 0xA9, 0x82, 0x4E, 0x7C, 0xBA, 0x71, 0x17, 0xAE,
-    0x63, 0x82, 0x76, 0xB2, 0x1C, 0x1E, 0x7B, 0x50, 0xFF, 0xEF, 0x33, 0xBC, 0x4C, 0xD2, 0x81, 0x28,
-    0xFB, 0x8A, 0xD4, 0xAB, 0x01, 0xA2, 0x28, 0xEE, 0xC0, 0xBC, 0x88, 0x6B, 0xAA, 0x3B, 0x00, 0x1A,
-    0x3A, 0x4C, 0x2D, 0xBE, 0x80, 0x3E, 0x2F, 0x78, 0x08, 0xB2, 0xF9, 0xE7, 0x25, 0xD1, 0x3F, 0x81,
-    0x5F, 0x22, 0xFA, 0x6E, 0x33, 0xD1, 0x55, 0x4A, 0x56, 0xCC, 0x99, 0x4F, 0x82, 0x12, 0x66, 0xB4,
-    0x4C, 0x68, 0xF3, 0x50, 0xF7, 0x94, 0xF6, 0x5F, 0x57, 0x7E, 0x6C, 0xA6, 0xEB, 0x70, 0x82, 0x27,
-    0x26, 0xAC, 0x3E, 0xC4, 0x7F, 0x85, 0x64, 0xDF, 0xC8, 0x3F, 0xAD, 0x88, 0xD6, 0xC6, 0x38, 0xA4,
-    0xB7, 0x20, 0xB3, 0x90, 0xAB, 0xC0, 0x8A, 0x83, 0x85, 0xEF, 0xF8, 0x45, 0xCF, 0xA4, 0x00, 0x48,
-    0xE8, 0x35, 0x10, 0xDF, 0x57, 0xF0, 0x0D, 0xAF, 0x8E, 0xF4, 0x05, 0x00, 0x11, 0xEF, 0xF0, 0xE5,
-    0x6C, 0x07, 0x8F, 0xB9, 0x5A, 0xC1, 0xD1, 0x85, 0x13, 0x6F, 0x96, 0x96, 0xD5, 0x83, 0x3E, 0xEF,
-    0x40, 0xEF, 0x94, 0x3D, 0x3D, 0x54, 0xE6, 0x3E, 0x5A, 0xD0, 0xFD, 0xFE, 0xC9, 0x65, 0x65, 0xA5,
-    0xAE, 0x62, 0x00, 0x56, 0xA4, 0x69, 0x18, 0xBE, 0xCB, 0xFD, 0x5A, 0x02, 0xD7, 0x8F, 0x3E, 0x45,
-    0x67, 0xD0, 0x04, 0x78, 0x71, 0x50, 0x37, 0x52, 0xCB, 0x75, 0x73, 0x5C, 0x14, 0x08, 0x5B, 0x42,
-    0xB6, 0xB3, 0x2A, 0x1F, 0xB6, 0x79, 0xBB, 0xA5, 0x9B, 0x8D, 0x9E, 0xF7, 0x53, 0x07, 0x55, 0x77,
-    0x2D, 0xEB, 0x28, 0xF6, 0x1B, 0x99, 0x0A, 0xC8, 0xE7, 0x22, 0x5C, 0xE2, 0x7D, 0x44, 0x80, 0x27,
-    0x50, 0xDB, 0xE9, 0x03, 0xE8, 0xD0, 0x3E, 0xD8, 0x7F, 0x8C, 0x1B, 0x8F, 0x10, 0xF9, 0xB4, 0xA0,
-    0x7B, 0x8A, 0x28, 0x5D, 0x16, 0xD8, 0xFB, 0x82, 0x4B, 0x41, 0x5C, 0xD8, 0xC9, 0xFA, 0xEF, 0x29,
-    0xE6, 0x73, 0x73, 0x14, 0xDC, 0x14, 0xCB, 0xE8, 0xF5, 0x39, 0x37, 0x87, 0x02, 0x96, 0x86, 0xBB,
-    0x4D, 0xA3, 0x0B, 0x45, 0x71, 0x36, 0x74, 0xE9, 0x27, 0x7F, 0x2C, 0x07, 0x0A, 0x9A, 0xD0, 0x37,
-    0x7C, 0xEF, 0x2C, 0x54, 0x14, 0x84, 0x26, 0x93, 0xF4, 0x30, 0x5B, 0xFB, 0x2A, 0x82, 0xEE, 0xC0,
-    0xC6, 0x55, 0xDC, 0x61, 0xA3, 0x3A, 0x62, 0x42, 0x81, 0x06, 0x6B, 0x29, 0x5A, 0x4A, 0x41, 0xA3,
-    0xCC, 0x47, 0x07, 0x71, 0x37, 0xBA, 0xB8, 0xF5, 0xFA, 0xCE, 0xE2, 0x16, 0x45, 0x0B, 0x45, 0x6F,
-    0x64, 0xE7, 0x04, 0x9D, 0x83, 0x0D, 0xF6, 0xEE, 0x7F, 0x99, 0x8F, 0xC3, 0xD8, 0x91, 0xFA, 0x53,
-    0x83, 0xFC, 0xE2, 0xF9, 0x0E, 0x38, 0x9E, 0xE9, 0x28, 0xE0, 0x5F, 0xAA, 0x72, 0x35, 0x71, 0x5D,
-    0xAC, 0x58, 0x1B, 0x67, 0x56, 0x23, 0xD7, 0xB7, 0x0B, 0x2E, 0x0B, 0x43, 0x04, 0x8A, 0x29, 0xCD,
-    0xCC, 0xA5, 0xB3, 0xA2, 0xFD, 0x3E, 0x20, 0xFB, 0x14, 0x33, 0x2F, 0x69, 0x90, 0x76, 0xFF, 0xB4,
-    0x0C, 0xB3, 0x36, 0x67, 0x66, 0xAD, 0x0D, 0x2A, 0x6F, 0x34, 0x87, 0x05, 0xB6, 0xD5, 0x7C, 0xEE,
-    0xB2, 0x29, 0x3E, 0x04, 0xD0, 0x9E, 0x10, 0x13, 0x8B, 0x87, 0xB4, 0x63, 0xE6, 0xB5, 0x8A, 0x23,
-    0x7A, 0x1F, 0x4A, 0xD4, 0xE3, 0x5B, 0x80, 0x3B, 0xC5, 0x0C, 0xF6, 0xA1, 0xD4, 0x09, 0x14, 0xC8,
-    0x54, 0x1F, 0xCA, 0x98, 0x20, 0x0B, 0xEE, 0x5C, 0x6B, 0x61, 0x49, 0x5D, 0x32, 0xA0, 0x57, 0x57,
-    0x16, 0xEB, 0xB4, 0x87, 0x3E, 0x2C, 0xBF, 0x73, 0x38, 0xFB, 0x83, 0x87, 0x24, 0x34, 0xE4, 0x9E,
-    0xFC, 0x45, 0x66, 0xB7, 0x59, 0x67, 0x4E, 0x07, 0x77, 0x90, 0x12, 0xEB, 0x30, 0x69, 0xA4, 0xB7,
-    0x99, 0x35, 0x85, 0xF9, 0x33, 0xDE, 0x21, 0x20, 0xC2, 0xD4, 0x7A, 0x38, 0x19, 0xD7, 0x26, 0x03,
-    0x12, 0xDB, 0x6A, 0x0D, 0x2E, 0xFA, 0x53, 0xC1, 0xEC, 0x4E, 0x4F, 0x82, 0x93, 0xE5, 0xC9, 0x8B,
-    0xA8, 0xE6, 0x09, 0x99, 0x30, 0xB3, 0x29, 0x18, 0x05, 0x4F, 0x70, 0x51, 0xD9, 0xC4, 0xF8, 0x0A,
-    0x65, 0xAB, 0xDA, 0x58, 0x02, 0x12, 0x4E, 0x1E, 0xB9, 0x1B, 0x51, 0x28, 0x11, 0x32, 0xEE, 0x4D,
-    0x50, 0x58, 0x77, 0x97, 0x20, 0x5E, 0xEA, 0x78, 0x64, 0x3E, 0x74, 0x11, 0x26, 0xF8, 0xD1, 0x0C,
-    0xA6, 0xE2, 0xC6, 0x6C, 0xC3, 0x8A, 0xC9, 0xE7, 0xA2, 0x6B, 0x71, 0xC0, 0x0B, 0xE8, 0x1F, 0x8C,
-    0x43, 0x66, 0x77, 0x21, 0xAC, 0x34, 0x54, 0xB4, 0x3B, 0x10, 0x5E, 0xF4, 0x60, 0x10, 0xE8, 0x3C,
-    0x82, 0xB8, 0x9E, 0x08, 0x4B, 0x6E, 0x10, 0xDE, 0x2D, 0xC8, 0xF0, 0xF3, 0x31, 0x2C, 0xBF, 0x90,
-    0xA8, 0x65, 0x1D, 0xAF, 0xB5, 0x1E, 0x2B, 0xF6, 0xDA, 0x47, 0xA4, 0xD0, 0xE3, 0x7C, 0x89, 0x97,
-    0x7D, 0x8F, 0xBA, 0x28, 0x86, 0xE7, 0x6D, 0x06, 0x57, 0x64, 0xB2, 0x06, 0x60, 0xA0, 0xA8, 0xF1,
-    0xD2, 0x07, 0x98, 0x56, 0x34, 0x62, 0x2A, 0x49, 0xE7, 0x6F, 0xF5, 0x91, 0x26, 0x82, 0x0A, 0xD1,
-    0x91, 0x03, 0x53, 0xB5, 0x99, 0xF3, 0xCE, 0xF4, 0x6F, 0xDD, 0x6F, 0x6A, 0xAD, 0x0E, 0xA4, 0x8A,
-    0x16, 0xFA, 0x4D, 0x85, 0x6D, 0x81, 0xD5, 0xEE, 0x8C, 0x26, 0xC2, 0xE1, 0xB0, 0x3C, 0xE5, 0xEA,
-    0x44, 0xCB, 0x8F, 0x27, 0x00, 0x87, 0x05, 0xC4, 0x52, 0x5A, 0x24, 0x7E, 0x08, 0x86, 0x71, 0x38,
-    0xB8, 0xCD, 0xA1, 0xE2, 0xEA, 0x5F, 0x55, 0x83, 0x85, 0x76, 0xF6, 0x25, 0xDD, 0xD9, 0xE7, 0x45,
-    0xBA, 0x94, 0x03, 0x4A, 0xA6, 0xC8, 0x14, 0x27, 0xD3, 0xBE, 0xC2, 0x80, 0x90, 0x06, 0xEA, 0x61,
-    0xE5, 0x0F, 0x07, 0x38, 0x84, 0x55, 0xBA, 0xEC, 0x89, 0x8B, 0xD5, 0xF8, 0x91, 0x6B, 0x23, 0xC9,
-    0x78, 0x39, 0x96, 0xCD, 0xAA, 0x7D, 0x4F, 0x4F, 0x43, 0xC7, 0x05, 0x87, 0x5C, 0x0C, 0xC4, 0xC9,
-    0xC4, 0xA1, 0xC4, 0x92, 0x4B, 0xF8, 0xE1, 0xEA, 0x03, 0x2B, 0x2C, 0xD9, 0x53, 0xD7, 0xC4, 0xBD,
-    0xB9, 0x64, 0xC6, 0xB0, 0x8C, 0xC8, 0x70, 0xA2, 0x88, 0x2E, 0xF5, 0x95, 0x97, 0x56, 0x67, 0x0E,
-    0xF7, 0x5A, 0xFF, 0x17, 0xD4, 0xAB, 0x7A, 0xEA, 0x74, 0x45, 0xC3, 0xFA, 0x9F, 0xBF, 0x4C, 0xE6,
-    0xFC, 0x66, 0xCD, 0x10, 0x94, 0xED, 0xEF, 0x2C, 0x98, 0x36, 0x6A, 0x4D, 0x3E, 0x29, 0xE6, 0xEB,
-    0xDD, 0xA1, 0x1C, 0xD6, 0xF4, 0xA7, 0x21, 0x38, 0x44, 0x21, 0x38, 0xD0, 0xB6, 0x1D, 0x63, 0xC5,
-    0xAF, 0xCA, 0x54, 0x19, 0x42, 0xEF, 0xD9, 0x79, 0xEC, 0xA8, 0x0B, 0xDA, 0x92, 0x03, 0x7A, 0x1C,
-    0xF7, 0x26, 0x87, 0xCF, 0x4B, 0x46, 0xB2, 0x3B, 0x83, 0xE1, 0x1F, 0xC1, 0xFE, 0x3B, 0x75, 0x37,
-    0x00, 0xCA, 0xB0, 0x5D, 0x39, 0x9A, 0x58, 0x05, 0x00, 0xBC, 0x2E, 0x02, 0x56, 0xE2, 0x6F, 0x24,
-    0x58, 0xC5, 0x9C, 0x28, 0xEC, 0x5A, 0x55, 0x8F, 0xA3, 0xB2, 0x24, 0x24, 0x3F, 0xD7, 0x9F, 0x1E,
-    0x10, 0x7E, 0xB4, 0x90, 0xB4, 0x26, 0x9D, 0xB0, 0x1E, 0xA8, 0x23, 0xD1, 0xB5, 0xF2, 0xF1, 0x77,
-    0x60, 0x1E, 0x3C, 0x17, 0xCD, 0x9C, 0x85, 0xB1, 0xCA, 0xA3, 0x65, 0x2D, 0x15, 0xE9, 0x4F, 0x03,
-    0x7C, 0xA6, 0xA0, 0xBA, 0xE1, 0xE7, 0x83, 0x86, 0x46, 0x32, 0xEA, 0x3F, 0xB8, 0x5F, 0x74, 0x51,
-    0xC9, 0xF2, 0x40, 0xDA, 0x65, 0x43, 0x06, 0x9B, 0xCC, 0x61, 0x9E, 0x76, 0x2C, 0xBA, 0x74, 0xAC,
-    0xA0, 0xD4, 0x09, 0xAC, 0xD7, 0xB5, 0xBE, 0x28, 0xAA, 0xC7, 0x66, 0xB5, 0xAD, 0x58, 0x32, 0xC2,
-    0x32, 0xC9, 0x60, 0xB5, 0x89, 0x30, 0x95, 0x55, 0x26, 0x9F, 0xF5, 0xBC, 0x70, 0xB0, 0xF7, 0x3E,
-    0x95, 0x88, 0xA9, 0x7E, 0x4B, 0xEC, 0x32, 0x51, 0x4F, 0xE5, 0xDE, 0x6C, 0x74, 0xC9, 0x37, 0x00,
-    0x4E, 0x2B, 0x0B, 0xA4, 0x8D, 0x7D, 0x81, 0x41, 0x02, 0x0A, 0x87, 0x19, 0xF2, 0x37, 0x1A, 0x1F,
-    0xCA, 0x3A, 0x62, 0xDE, 0x1C, 0xB1, 0x38, 0xD3, 0xF8, 0x04, 0x83, 0x3A, 0x43, 0x58, 0x73, 0x07,
-    0x28, 0x60, 0xE6, 0x08, 0x3D, 0x75, 0xB5, 0x49, 0xA7, 0xD5, 0xCC, 0x9F, 0xC2, 0xC0, 0xC3, 0x0E,
-    0xC4, 0x6B, 0x8F, 0xE7, 0x90, 0x12, 0x51, 0x3C, 0xAA, 0x91, 0xB1, 0x87, 0xD8, 0x4D, 0x28, 0x48,
-    0xAA, 0xC9, 0x10, 0x28, 0x25, 0xB3, 0xCF, 0x2A, 0xA9, 0xA1, 0x1E, 0x7C, 0x2B, 0x24, 0xF6, 0x9F,
-    0xD4, 0x9B, 0x1F, 0x70, 0xF9, 0x90, 0xE4, 0x23, 0xFB, 0xF9, 0x43, 0x62, 0xEF, 0x6C, 0x79, 0x43,
-    0x57, 0x9D, 0x47, 0x5F, 0x1B, 0x49, 0x14, 0xD3, 0x77, 0x1E, 0x7F, 0xE5, 0x72, 0xE5, 0xB2, 0xD6,
-    0x63, 0x18, 0xFF, 0xE2, 0xE5, 0x47, 0x45, 0x18, 0xF3, 0x8D, 0x1B, 0x50, 0x9F, 0x86, 0x64, 0xE5,
-    0x2C, 0x6A, 0xB5, 0x0A, 0x40, 0x98, 0xDA, 0x58, 0x9F, 0x4E, 0xC7, 0xE1, 0x92, 0x2B, 0x1F, 0x2C,
-    0x9D, 0x8C, 0x4A, 0x78, 0xA1, 0x59, 0xA7, 0x37, 0xF9, 0xED, 0xDA, 0xBE, 0x5E, 0xAA, 0x6E, 0x72,
-    0x81, 0xF6, 0x4F, 0xA0, 0x60, 0xD2, 0xE2, 0x24, 0xD3, 0x27, 0x9F, 0x38, 0x9B, 0x73, 0xAF, 0x3F,
-    0x1E, 0xC5, 0xFE, 0xCF, 0x57, 0xC3, 0x6C, 0xAF, 0x3D, 0xD0, 0x43, 0x3F, 0xD9, 0x8B, 0x1F, 0x3D,
-    0x99, 0xAA, 0x37, 0xEF, 0x3F, 0x1A, 0xAB, 0xFC, 0xB8, 0x7B, 0xEB, 0x40, 0xD7, 0xF5, 0x2D, 0x53,
-    0x9C, 0x59, 0x31, 0x50, 0xAC, 0x29, 0x96, 0x12, 0x16, 0x4E, 0x79, 0xAF, 0xF5, 0x48, 0x66, 0x62,
-    0x4E, 0x34, 0xF1, 0xA8, 0xC4, 0xE7, 0x65, 0x8D, 0x12, 0x7B, 0xF6, 0xB4, 0xE7, 0x88, 0x3D, 0x6A,
-    0xD2, 0x42, 0xD7, 0xA1, 0x55, 0x0A, 0x93, 0xAE, 0x6F, 0x17, 0xFD, 0x6D, 0x3B, 0xDD, 0x7E, 0xBB,
-    0x1A, 0xDF, 0x2E, 0xFA, 0x97, 0x92, 0xF5, 0xFF, 0x01, 0xDD, 0x5A, 0x3D, 0xB0, 0xDD, 0xC6, 0x75,
-    0x5E, 0x00, 0x26, 0x31, 0x13, 0x14, 0x60, 0x61, 0x7A, 0x1C, 0x33, 0x09, 0x7A, 0x4D, 0x2C, 0xB4,
-    0x29, 0x24, 0x2E, 0x44, 0x4E, 0x86, 0x85, 0x0A, 0xBE, 0xCC, 0xBC, 0xEB, 0x64, 0x46, 0x85, 0x92,
-    0xCE, 0x51, 0x26, 0xF3, 0xDA, 0x14, 0xA4, 0x70, 0x45, 0x16, 0x2C, 0x52, 0x88, 0x45, 0x94, 0x56,
-    0x2A, 0xE4, 0x19, 0xEB, 0xB9, 0xA0, 0x27, 0xA3, 0xC2, 0x05, 0xED, 0x05, 0xC9, 0x49, 0x58, 0xA8,
-    0x20, 0x4C, 0x66, 0xA2, 0xC2, 0x85, 0x60, 0x4B, 0x1C, 0x65, 0xAC, 0x82, 0xA0, 0x0C, 0x49, 0x78,
-    0x24, 0x80, 0x93, 0xEF, 0x3B, 0x8B, 0x7B, 0xDF, 0x0F, 0x1F, 0x29, 0xCB, 0x43, 0x8F, 0xE5, 0xE0,
-    0xBD, 0x7B, 0xEF, 0xE2, 0x6F, 0xF7, 0x9C, 0xB3, 0xE7, 0xE7, 0x3B, 0x67, 0xB7, 0x94, 0x97, 0xE5,
-    0x86, 0xB4, 0x32, 0xE4, 0x92, 0xC8, 0x6B, 0xD2, 0xD8, 0xCE, 0xEC, 0x3F, 0x0A, 0xF3, 0x63, 0x33,
-    0x04, 0x62, 0xA4, 0xCA, 0xDB, 0x84, 0x8D, 0xB2, 0xCA, 0xDA, 0x68, 0x30, 0x62, 0x6C, 0x95, 0xFA,
-    0x46, 0x5E, 0x27, 0x5D, 0x30, 0x9A, 0xD2, 0x64, 0x26, 0xD2, 0x77, 0xC2, 0xD6, 0x98, 0xA4, 0x32,
-    0x26, 0x47, 0xFB, 0xAA, 0x3F, 0xDD, 0xDA, 0x31, 0x99, 0xF4, 0x81, 0x48, 0x93, 0x8A, 0x2C, 0xDD,
-    0xAD, 0x65, 0x34, 0x9E, 0x34, 0x69, 0xDB, 0x9B, 0xF2, 0x46, 0x13, 0x48, 0xBA, 0x8C, 0x87, 0x93,
-    0x26, 0xEB, 0x7A, 0x63, 0x3F, 0x6C, 0x8C, 0xDC, 0x7B, 0x1B, 0x0F, 0x76, 0x11, 0x3E, 0xA1, 0x48,
-    0x1B, 0xB8, 0x1D, 0x63, 0x9E, 0x47, 0x57, 0x20, 0x2D, 0xAA, 0x8D, 0x49, 0x0B, 0x63, 0xBE, 0xB9,
-    0x97, 0xC4, 0x40, 0x7A, 0x63, 0xAC, 0x8C, 0x06, 0x6F, 0x4C, 0x26, 0xEF, 0x4E, 0x8C, 0x20, 0x2A,
-    0x2C, 0x42, 0x5C, 0x35, 0x09, 0xC6, 0x36, 0x29, 0x68, 0x31, 0x76, 0x89, 0x2F, 0xC7, 0xC7, 0x47,
-    0xC3, 0x27, 0xA5, 0x05, 0x25, 0x52, 0x59, 0x7C, 0xE1, 0x26, 0x9F, 0xC0, 0xAF, 0x01, 0x43, 0xA0,
-    0x1B, 0x2F, 0xC5, 0x52, 0xA1, 0xE3, 0xA9, 0x40, 0x43, 0xE4, 0xAD, 0x0C, 0x5F, 0x4D, 0x89, 0xAF,
-    0x9F, 0x0B, 0x5F, 0xD2, 0x61, 0xBF, 0x61, 0x62, 0xD0, 0x13, 0x40, 0x02, 0x4E, 0x5A, 0x76, 0xF3,
-    0x02, 0x1F, 0x8A, 0xC5, 0x0D, 0x90, 0x91, 0xAB, 0x92, 0x9E, 0xC2, 0x59, 0xDA, 0x3A, 0x19, 0x53,
-    0x5C, 0xC1, 0x5B, 0x18, 0x6F, 0xE2, 0xC0, 0x3D, 0x3B, 0xBA, 0x3E, 0xB9, 0x7B, 0x6D, 0xB2, 0x34,
-    0xCF, 0x99, 0x63, 0xE8, 0xEB, 0xF8, 0x06, 0x3E, 0xA7, 0x64, 0x69, 0xB2, 0x21, 0x25, 0x1F, 0x06,
-    0xF3, 0x20, 0x75, 0x20, 0xB5, 0xED, 0x4D, 0x2A, 0x67, 0x49, 0xA1, 0x28, 0x41, 0x02, 0x21, 0x24,
-    0xE0, 0x92, 0x17, 0x94, 0x66, 0xF2, 0x97, 0x08, 0xA8, 0x76, 0x22, 0xB5, 0xE1, 0x10, 0x26, 0x24,
-    0x73, 0xE6, 0x99, 0x2B, 0x7C, 0xCA, 0x48, 0x43, 0x01, 0xB0, 0xF9, 0x0A, 0x7B, 0xC0, 0x03, 0x23,
-    0xBB, 0xC1, 0x03, 0x9E, 0x73, 0x0C, 0xC3, 0x07, 0x46, 0xB3, 0x6A, 0xFE, 0xC9, 0x0F, 0x8D, 0x39,
-    0x61, 0x79, 0x9C, 0x3C, 0xF9, 0x2A, 0x69, 0x33, 0x7F, 0xF1, 0x53, 0x7F, 0x5C, 0xBD, 0x3A, 0x14,
-    0x26, 0x41, 0x57, 0x25, 0x1E, 0xE4, 0xE4, 0x8C, 0x67, 0xBA, 0xB0, 0x33, 0x6D, 0xD4, 0x9B, 0x8D,
-    0x50, 0x2E, 0xE3, 0x7D, 0x29, 0xF0, 0x69, 0xC1, 0x63, 0x9F, 0x8C, 0x2F, 0x0D, 0x69, 0x1B, 0x8E,
-    0x69, 0x83, 0x8F, 0xDC, 0x1B, 0x13, 0x91, 0x81, 0xD7, 0x03, 0x8E, 0x9C, 0x93, 0xEA, 0x12, 0x34,
-    0xC7, 0x03, 0xA6, 0x69, 0x4C, 0xBA, 0x78, 0x80, 0x80, 0x7B, 0x10, 0xD4, 0x66, 0xEC, 0xE3, 0xB8,
-    0x31, 0x59, 0x9B, 0xB5, 0xAE, 0x76, 0xB7, 0xE5, 0x94, 0x9C, 0x9D, 0xD2, 0xC9, 0xF6, 0xB6, 0x97,
-    0xFB, 0x72, 0x7F, 0xF1, 0xC2, 0xA2, 0x30, 0xEE, 0x32, 0x68, 0x5F, 0xA6, 0x0F, 0xA6, 0xB0, 0x8B,
-    0xBA, 0x93, 0xF6, 0xEC, 0xCD, 0x5B, 0xE6, 0xEA, 0xB9, 0x26, 0xBE, 0xF9, 0xC1, 0xC6, 0x55, 0x9B,
-    0xBF, 0x79, 0x61, 0x8C, 0x31, 0xB3, 0x23, 0x06, 0x29, 0xCC, 0x9F, 0xEA, 0x44, 0xD9, 0x77, 0x53,
-    0x39, 0x55, 0xF7, 0xCF, 0x25, 0x17, 0x97, 0xE7, 0xFE, 0x2A, 0xBE, 0x21, 0x18, 0xAC, 0x2A, 0xBF,
-    0x0F, 0xD5, 0x0E, 0x4C, 0x58, 0xFD, 0x39, 0xB4, 0xE3, 0xBC, 0xB1, 0xD7, 0xC7, 0x40, 0x5E, 0x1C,
-    0xE2, 0xD1, 0xB6, 0x79, 0x2B, 0xCB, 0xF2, 0xC6, 0x68, 0xDC, 0x1D, 0xE8, 0xFA, 0xE7, 0x98, 0xB5,
-    0xD1, 0x81, 0xA3, 0x2D, 0xCC, 0xE5, 0x8B, 0x83, 0xB1, 0x50, 0xAA, 0xD4, 0xBC, 0x6B, 0x42, 0x73,
-    0xAC, 0x7C, 0x67, 0x83, 0xB3, 0x3A, 0xAC, 0x3E, 0xC7, 0xBF, 0x77, 0x45, 0x39, 0x3A, 0xF0, 0x51,
-    0xC1, 0x2E, 0x16, 0x8B, 0x4D, 0xCC, 0xCF, 0xB0, 0xFA, 0xEC, 0x61, 0x41, 0x3E, 0xEF, 0x4E, 0xFE,
-    0xC3, 0xAD, 0x4B, 0xFF, 0xF3, 0x67, 0x57, 0xCF, 0xB9, 0x33, 0x37, 0xDF, 0xFB, 0xC9, 0xD5, 0x93,
-    0xFF, 0x71, 0xEB, 0x82, 0xE4, 0x5D, 0xFA, 0x70, 0x42, 0xF7, 0x4B, 0x73, 0xE5, 0xB2, 0x5A, 0xD4,
-    0xB6, 0x5C, 0x14, 0x08, 0x40, 0xB4, 0x3B, 0x73, 0x04, 0x02, 0x12, 0x4C, 0xFB, 0x48, 0x71, 0xDA,
-    0xC6, 0x5D, 0x1A, 0xA2, 0xA1, 0x5C, 0xDA, 0x9B, 0xF8, 0xB1, 0x0F, 0xF8, 0x64, 0x97, 0xCA, 0xEE,
-    0xEB, 0x47, 0xDF, 0x86, 0x8A, 0x74, 0xFB, 0x3E, 0x20, 0x78, 0x5A, 0x7D, 0x0E, 0xDE, 0x33, 0xC1,
-    0x06, 0x49, 0xFE, 0x7B, 0x4C, 0x45, 0x67, 0x57, 0x04, 0xE3, 0x38, 0xB1, 0x74, 0xDD, 0x5B, 0x3F,
-    0x81, 0xC2, 0x9E, 0x0B, 0xBA, 0xA4, 0xB1, 0x95, 0x1B, 0xA0, 0xE9, 0xE6, 0x5B, 0x97, 0x6D, 0x7F,
-    0xEC, 0x2F, 0xCD, 0x77, 0x93, 0x3E, 0xED, 0xCD, 0xF9, 0x63, 0xCF, 0xDA, 0xD1, 0x0D, 0x65, 0x47,
-    0x9B, 0xFB, 0x59, 0xD4, 0xE5, 0xD5, 0x84, 0x0E, 0x61, 0x5C, 0x16, 0x02, 0x8D, 0x07, 0x5B, 0xC3,
-    0xDC, 0x27, 0x36, 0x9A, 0xB9, 0x51, 0xA2, 0x71, 0x13, 0x9C, 0x0C, 0x65, 0x6B, 0x1C, 0x1A, 0x29,
-    0xDF, 0x95, 0xF7, 0xA5, 0xCE, 0x47, 0x1A, 0xC9, 0x2F, 0xF0, 0x19, 0xDD, 0xDE, 0xC6, 0x27, 0xF7,
-    0x5D, 0xAD, 0x56, 0x9C, 0xB6, 0xB3, 0xC5, 0xFA, 0xC3, 0xB5, 0x70, 0x51, 0x83, 0xAD, 0x44, 0xD2,
-    0xD6, 0xC9, 0x8D, 0xC1, 0xC2, 0xA7, 0xA5, 0xB8, 0x70, 0x43, 0x26, 0x5E, 0xB8, 0x88, 0x39, 0x6F,
-    0x24, 0x84, 0x8E, 0x55, 0xD9, 0x98, 0x60, 0x3E, 0x4F, 0x61, 0x3E, 0x6B, 0x67, 0x30, 0xDD, 0x55,
-    0x36, 0x24, 0x6D, 0x22, 0x21, 0xD4, 0xB3, 0x72, 0xB0, 0xA7, 0xBC, 0xB2, 0xB8, 0x90, 0x09, 0xF4,
-    0x12, 0x8E, 0xEA, 0xB4, 0x34, 0x79, 0x0D, 0x75, 0xEE, 0xEC, 0x14, 0x8C, 0x99, 0x14, 0x65, 0x01,
-    0xBD, 0xBC, 0x0D, 0x9D, 0xA4, 0x3E, 0x2E, 0x8A, 0xB4, 0xC8, 0x8C, 0x45, 0x2F, 0x65, 0x7F, 0x6C,
-    0xB0, 0xA0, 0x1D, 0xC4, 0x99, 0xF3, 0x51, 0xF7, 0x9D, 0x3A, 0x29, 0xBE, 0x6B, 0xBA, 0xA8, 0x4E,
-    0x4F, 0xCB, 0x3D, 0x79, 0x63, 0x33, 0x84, 0x47, 0xEA, 0x9E, 0x8D, 0x6F, 0xD4, 0xCF, 0x3D, 0x1F,
-    0xDD, 0x69, 0xCE, 0xE5, 0x52, 0xD1, 0x7A, 0xD4, 0xBB, 0x1A, 0xF3, 0x56, 0x54, 0x98, 0xAB, 0x51,
-    0x63, 0xDC, 0x69, 0x78, 0x43, 0x28, 0x5D, 0xD6, 0xBB, 0x2A, 0x9A, 0x32, 0xC8, 0xE1, 0x0C, 0xFC,
-    0xED, 0x7B, 0x63, 0x0C, 0xE5, 0xCB, 0x46, 0x69, 0xA1, 0x8C, 0x4B, 0x7B, 0x7B, 0x32, 0x36, 0xE8,
-    0xCD, 0x73, 0x41, 0x03, 0xBF, 0x01, 0x8F, 0xB6, 0xA9, 0xDC, 0x67, 0xAD, 0xFE, 0xD0, 0x23, 0x64,
-    0x75, 0x44, 0xA9, 0x4C, 0xE6, 0xDB, 0x83, 0x7A, 0xBF, 0xA8, 0x55, 0xD7, 0x07, 0x17, 0x48, 0xD7,
-    0x66, 0xF9, 0x80, 0x31, 0x83, 0x8A, 0x0E, 0xB7, 0x38, 0xDD, 0x59, 0x05, 0x7F, 0x05, 0x7B, 0xC4,
-    0x03, 0x41, 0x01, 0xB9, 0xE5, 0x4D, 0x5E, 0xC0, 0x55, 0x48, 0x30, 0xC2, 0x60, 0x31, 0xAD, 0x8C,
-    0x08, 0x70, 0x68, 0xF0, 0x23, 0xD1, 0x18, 0x7F, 0xB0, 0xA4, 0x7B, 0x7C, 0xFE, 0x24, 0x47, 0x8B,
-    0x7E, 0x09, 0x0F, 0x9B, 0xF6, 0x79, 0x8C, 0x27, 0xCA, 0x6B, 0x30, 0x60, 0x13, 0x4D, 0xB0, 0xF3,
-    0x06, 0x0F, 0x1C, 0xF9, 0xA7, 0xA9, 0x08, 0x60, 0x80, 0x20, 0x00, 0xCE, 0xCF, 0xE4, 0x18, 0xA2,
-    0xA6, 0xF7, 0x0D, 0x27, 0x3F, 0x5D, 0x9E, 0x6C, 0x1D, 0x97, 0x73, 0x49, 0xFD, 0x7A, 0xC7, 0xD3,
-    0x0F, 0x65, 0x21, 0xE5, 0x71, 0xE7, 0xDD, 0x36, 0x79, 0xF1, 0x1D, 0xF0, 0x34, 0xEE, 0xCD, 0x8A,
-    0x78, 0x9E, 0xE6, 0xE8, 0x13, 0xFE, 0x57, 0x7D, 0x36, 0xB8, 0x70, 0x2F, 0xFC, 0x23, 0xAC, 0xAA,
-    0xCD, 0xEE, 0x0B, 0x29, 0x8F, 0x10, 0xD2, 0xA0, 0xBF, 0xAD, 0xBB, 0xF0, 0x51, 0x7E, 0x6D, 0xB1,
-    0x48, 0xDB, 0x63, 0x7C, 0x33, 0x1A, 0x7D, 0xBF, 0x1C, 0x19, 0xA7, 0x64, 0x0E, 0x23, 0x86, 0xE2,
-    0x9B, 0xB8, 0x1A, 0x4F, 0xE4, 0x09, 0x57, 0xFC, 0x55, 0x7A, 0x2A, 0xA8, 0x6D, 0x06, 0xC3, 0x03,
-    0x95, 0xF0, 0xAC, 0x35, 0xD9, 0xB2, 0xB0, 0x1A, 0xE8, 0x70, 0xB0, 0x58, 0x14, 0x47, 0xA5, 0x30,
-    0x6B, 0x6F, 0x1C, 0xDC, 0xDD, 0x5A, 0x92, 0x12, 0x44, 0x42, 0x43, 0x4E, 0xCF, 0xA9, 0x9A, 0x42,
-    0xCE, 0x65, 0x41, 0x83, 0x25, 0xA1, 0x6E, 0x24, 0xD9, 0xC1, 0x8F, 0x86, 0x80, 0x0F, 0x44, 0x1D,
-    0x1F, 0xD8, 0x48, 0x6B, 0xB7, 0x64, 0x4C, 0x3A, 0x3D, 0xC4, 0x75, 0x06, 0xAD, 0xAD, 0x2D, 0x66,
-    0xE0, 0xE7, 0x53, 0x34, 0x22, 0xF6, 0xA5, 0x6D, 0xCE, 0x19, 0x70, 0xAF, 0x7D, 0xD1, 0xD0, 0xA5,
-    0xA4, 0x67, 0x97, 0xA4, 0xA8, 0x7F, 0x15, 0x4E, 0x41, 0x92, 0x6B, 0x3D, 0x27, 0xBF, 0x64, 0x40,
-    0x90, 0x0B, 0x9C, 0x81, 0x64, 0x38, 0xBA, 0x0D, 0xEF, 0x0C, 0x92, 0xC3, 0x81, 0x71, 0x84, 0x33,
-    0x00, 0x55, 0xA2, 0x00, 0xDD, 0xD2, 0x0B, 0x9B, 0x04, 0x3B, 0x46, 0x68, 0x4A, 0xB1, 0x64, 0xA8,
-    0xD3, 0x70, 0x42, 0x59, 0x6E, 0x9A, 0xC3, 0x0E, 0xE8, 0x9A, 0x39, 0x3A, 0x31, 0xCE, 0xE2, 0x99,
-    0x6C, 0x64, 0x83, 0x2C, 0x0E, 0x46, 0xA5, 0x64, 0xE8, 0x1D, 0xAC, 0x86, 0x16, 0x0C, 0xCA, 0x47,
-    0x6C, 0xEB, 0x7D, 0x9F, 0x71, 0x95, 0xCA, 0x12, 0x8F, 0x60, 0xE8, 0x84, 0x0D, 0xD2, 0xC0, 0x5B,
-    0x15, 0x5D, 0x41, 0x08, 0x47, 0xDB, 0x33, 0x08, 0x2F, 0x2D, 0x63, 0x97, 0x63, 0xA8, 0x7A, 0xE5,
-    0xF2, 0x3C, 0xA8, 0xBE, 0xE7, 0x55, 0x62, 0x15, 0x9E, 0x7C, 0x7C, 0xF2, 0xC1, 0xEC, 0xB0, 0x43,
-    0x35, 0x15, 0xF1, 0x9A, 0xDF, 0x91, 0x7F, 0x51, 0xB4, 0x17, 0x27, 0x7E, 0x8A, 0xF8, 0x7A, 0xF6,
-    0x70, 0xD0, 0xDE, 0x35, 0xD8, 0x8F, 0x98, 0x44, 0x8A, 0x91, 0x97, 0x80, 0x7E, 0x20, 0x98, 0xB2,
-    0x26, 0xF5, 0xB6, 0xE5, 0xA5, 0x14, 0xE6, 0xB7, 0x34, 0xC9, 0x48, 0x86, 0x22, 0x79, 0xE3, 0x65,
-    0x1F, 0x38, 0x71, 0xC9, 0xAD, 0xE3, 0x27, 0xE0, 0x86, 0x02, 0x02, 0x72, 0x21, 0x5D, 0x8C, 0x7B,
-    0xE9, 0x44, 0xA1, 0x60, 0x78, 0x6A, 0x8E, 0xEB, 0xCA, 0x5E, 0x5D, 0x35, 0x8E, 0x9F, 0xF9, 0x58,
-    0xA4, 0xDF, 0xB9, 0xE7, 0x8A, 0xA1, 0x59, 0x4D, 0x70, 0xC6, 0x1D, 0x5F, 0xE9, 0x88, 0x46, 0x8F,
-    0x7D, 0x3C, 0x9F, 0xEA, 0x00, 0xAC, 0x4A, 0x26, 0xD7, 0x4B, 0x29, 0x91, 0x02, 0xA6, 0x56, 0xF9,
-    0x9C, 0x3C, 0xBE, 0x39, 0xAB, 0x53, 0x70, 0x9D, 0x97, 0x6C, 0x43, 0x83, 0xCC, 0xBA, 0x54, 0xF9,
-    0xA4, 0xA6, 0x43, 0x59, 0xE0, 0x8D, 0x43, 0x29, 0x78, 0x49, 0xEE, 0xFE, 0x2D, 0xA4, 0x41, 0x17,
-    0xDC, 0x28, 0x87, 0x83, 0x51, 0x0E, 0x97, 0x09, 0xBF, 0x19, 0xE0, 0x85, 0xB1, 0xA7, 0xC1, 0x4B,
-    0x4B, 0xAA, 0x12, 0x82, 0x10, 0x8D, 0x74, 0xCC, 0x26, 0x0F, 0x9C, 0x4C, 0xE8, 0x61, 0xA4, 0xF7,
-    0xCF, 0x0A, 0x41, 0x8C, 0x78, 0x38, 0xA2, 0x27, 0x72, 0x6A, 0xD2, 0xBB, 0x19, 0x4E, 0x8E, 0xAF,
-    0xBD, 0xC1, 0xEE, 0xE1, 0x6D, 0xAA, 0xF4, 0x4C, 0x0D, 0x5E, 0x6B, 0x97, 0x0A, 0x74, 0x5A, 0x9D,
-    0xDB, 0x51, 0x39, 0x77, 0xCA, 0xD4, 0xEB, 0xBC, 0x64, 0xEF, 0x4C, 0x8A, 0xDB, 0xBC, 0xC6, 0x51,
-    0xE1, 0xE3, 0x31, 0xF2, 0x4C, 0xF1, 0x92, 0x54, 0x19, 0x58, 0x77, 0xEA, 0x1A, 0xED, 0xCE, 0x42,
-    0x68, 0xD0, 0x6A, 0x2D, 0x64, 0x44, 0xC1, 0xA0, 0x34, 0x44, 0x4D, 0xE0, 0x93, 0xDF, 0x70, 0xF3,
-    0x3D, 0xC9, 0xCE, 0xA9, 0xD9, 0x43, 0x4A, 0x2B, 0x92, 0x33, 0x20, 0x20, 0xE0, 0xF0, 0xFF, 0x1C,
-    0x73, 0xD8, 0xB2, 0x21, 0x87, 0xF9, 0x74, 0x9E, 0xB4, 0xDD, 0x52, 0x21, 0xDF, 0x57, 0xB9, 0x0F,
-    0x59, 0xF5, 0xC7, 0x37, 0x5F, 0x29, 0x83, 0x37, 0x6E, 0x6A, 0xE8, 0x80, 0xEA, 0xD2, 0x41, 0xB6,
-    0x14, 0x7F, 0x3E, 0x52, 0x06, 0x09, 0x10, 0x68, 0x01, 0x6F, 0x47, 0xF0, 0x75, 0xE8, 0xF1, 0x75,
-    0x9E, 0xAF, 0xB8, 0xD9, 0xE3, 0x15, 0x1E, 0xEA, 0xC9, 0x8E, 0x7A, 0x05, 0x3B, 0xEE, 0xDE, 0x30,
-    0xAF, 0x3E, 0xCE, 0xCC, 0xBE, 0xCE, 0xAC, 0x99, 0x23, 0x7F, 0xB3, 0xBD, 0xAD, 0xE0, 0x2C, 0xFF,
-    0x8D, 0x76, 0x02, 0x42, 0xBF, 0x10, 0xCD, 0x11, 0x8C, 0x3C, 0x54, 0x27, 0xA5, 0x2E, 0xEB, 0x07,
-    0x1B, 0x4A, 0xAA, 0xB7, 0x40, 0x26, 0x34, 0xBE, 0x91, 0x7E, 0x31, 0x37, 0xF2, 0x4F, 0xE7, 0x86,
-    0xBD, 0x2D, 0xD3, 0xE2, 0xEF, 0xA8, 0x74, 0xD7, 0xC4, 0x63, 0x4D, 0x29, 0x7C, 0x03, 0xE4, 0xFA,
-    0x06, 0x82, 0x85, 0x6F, 0x40, 0xED, 0x9C, 0xBE, 0x05, 0x7E, 0xCA, 0xC9, 0x3B, 0xD8, 0xB9, 0x67,
-    0xB7, 0x6A, 0x28, 0x07, 0x8B, 0xC5, 0x86, 0x32, 0xB4, 0xD6, 0x44, 0x52, 0x98, 0xE0, 0x32, 0xD5,
-    0xB5, 0xA7, 0x0A, 0xAA, 0xC6, 0x52, 0xB8, 0x14, 0xC5, 0xE0, 0x5D, 0xE6, 0x0A, 0xEA, 0xEE, 0x3D,
-    0xB6, 0xE4, 0x6D, 0xA3, 0x99, 0x14, 0x87, 0xF2, 0x2A, 0xBE, 0x8C, 0x94, 0x5F, 0x27, 0xBF, 0xBE,
-    0x52, 0x30, 0x00, 0xC1, 0x20, 0xDA, 0xD5, 0x4C, 0xC5, 0x3A, 0x51, 0xAE, 0xD3, 0x39, 0x5B, 0x5B,
-    0xDD, 0x9E, 0xA6, 0x77, 0xCC, 0x2A, 0x37, 0x7D, 0x17, 0xF4, 0xFE, 0xF7, 0x91, 0x77, 0x75, 0x26,
-    0x0A, 0x32, 0xD3, 0x29, 0xDD, 0x45, 0xAA, 0xB2, 0x2D, 0xD5, 0xF5, 0x6B, 0x33, 0xD0, 0xA6, 0x49,
-    0xD9, 0x7D, 0xA0, 0x9E, 0x4E, 0x43, 0xB4, 0x8F, 0x39, 0xC7, 0x7E, 0x4A, 0xBC, 0xAE, 0xDD, 0xD9,
-    0x5E, 0x8D, 0x79, 0x6F, 0x44, 0x53, 0xA8, 0xA3, 0xE1, 0x4C, 0xC3, 0x58, 0x22, 0x87, 0x2A, 0xDD,
-    0x2B, 0xDB, 0x32, 0x32, 0xEF, 0x6C, 0x29, 0x99, 0x0A, 0xE2, 0x44, 0x50, 0xF9, 0xC1, 0xA6, 0x49,
-    0x56, 0xC9, 0xA9, 0x6A, 0x12, 0x9D, 0x00, 0xA2, 0xD3, 0xE2, 0xFB, 0x94, 0x46, 0x4B, 0xCA, 0x2A,
-    0x0A, 0x83, 0x62, 0x19, 0x8C, 0xE6, 0xF1, 0xA4, 0x47, 0x4D, 0x5A, 0x47, 0x85, 0xB6, 0x2D, 0x38,
-    0x9B, 0xC2, 0xA7, 0x06, 0x32, 0x45, 0x78, 0x0F, 0x58, 0x8C, 0xE3, 0x92, 0xF8, 0x64, 0x30, 0x27,
-    0x4B, 0xA4, 0x2E, 0x6E, 0xE7, 0x94, 0x39, 0x18, 0x57, 0x60, 0xFB, 0xB7, 0x3A, 0xFE, 0x60, 0x94,
-    0x9F, 0x5F, 0x05, 0x51, 0xAB, 0x9E, 0x4C, 0x2B, 0x02, 0x00, 0xA4, 0x23, 0x60, 0x87, 0xAD, 0x00,
-    0x39, 0x36, 0x7D, 0x5A, 0xB3, 0x17, 0xD6, 0x6C, 0xFF, 0x48, 0xBA, 0x6C, 0x26, 0x53, 0x38, 0xD5,
-    0x7D, 0x32, 0xBD, 0xB1, 0x71, 0x90, 0x4C, 0xA5, 0xFC, 0xB3, 0xC5, 0x5B, 0x07, 0xC9, 0x54, 0xCA,
-    0xEB, 0x7D, 0x64, 0x6A, 0x4A, 0x72, 0x77, 0xB1, 0x58, 0x93, 0xA9, 0x65, 0x81, 0x9A, 0x14, 0x5E,
-    0xA4, 0x49, 0xA8, 0x7A, 0x87, 0x02, 0x8D, 0x48, 0x07, 0xBC, 0x61, 0x5B, 0xDB, 0x06, 0x72, 0x4D,
-    0xAA, 0x58, 0x5E, 0x94, 0x02, 0xAE, 0x76, 0x34, 0x8B, 0x8D, 0xC5, 0xC6, 0x61, 0x08, 0xEC, 0x0F,
-    0x43, 0xEA, 0xDC, 0x27, 0x92, 0x1A, 0x66, 0xFD, 0x08, 0x1C, 0xB1, 0x3C, 0x1A, 0x00, 0x68, 0x8D,
-    0x8A, 0xF2, 0xD9, 0xBB, 0x3F, 0x49, 0x06, 0x25, 0x08, 0x84, 0xE5, 0x07, 0x4F, 0x46, 0x46, 0x2C,
-    0xF6, 0x98, 0xF7, 0xB4, 0x80, 0x88, 0x26, 0xD5, 0xD0, 0x5C, 0x53, 0x51, 0xFB, 0x51, 0xBB, 0x1C,
-    0xC2, 0x3E, 0xEA, 0x92, 0x36, 0x6D, 0xF2, 0xFA, 0x51, 0x59, 0x50, 0x6A, 0xAB, 0xBF, 0xFC, 0xE0,
-    0x5F, 0xA7, 0x7F, 0xBD, 0xF5, 0x7F, 0x83, 0xFF, 0xF3, 0x5E, 0xAF, 0xF5, 0x16, 0x48, 0xAF, 0x0F,
-    0x9B, 0x8E, 0xC4, 0xD5, 0x69, 0x97, 0x76, 0xB6, 0x0A, 0xC7, 0x43, 0x15, 0xD9, 0xC3, 0xC0, 0x47,
-    0x3F, 0xF9, 0x97, 0x7D, 0xBA, 0x3D, 0x9F, 0xDE, 0xAB, 0xE3, 0xFA, 0x33, 0xEC, 0xFB, 0x1C, 0xD9,
-    0x38, 0xB2, 0x81, 0xC4, 0xEA, 0x3A, 0x6B, 0x1C, 0x63, 0x3A, 0x6A, 0x8D, 0xA3, 0x91, 0x8F, 0xE5,
-    0xA6, 0x54, 0x8F, 0x0B, 0x46, 0x95, 0x4A, 0x99, 0x53, 0x48, 0x5A, 0xE6, 0x53, 0xCE, 0x11, 0x87,
-    0x76, 0x3E, 0x65, 0x39, 0x78, 0x3A, 0x7A, 0x62, 0x1C, 0xD1, 0xF9, 0x52, 0xDD, 0x8E, 0xD5, 0x90,
-    0xA2, 0xF2, 0xA6, 0x37, 0x24, 0x39, 0x94, 0x3B, 0xE6, 0xFC, 0x23, 0xA3, 0x0E, 0x76, 0x2A, 0x56,
-    0x50, 0x37, 0xF6, 0xF5, 0xAE, 0xCC, 0xFF, 0x20, 0x0C, 0x96, 0x52, 0x04, 0x7A, 0x41, 0x23, 0x27,
-    0x28, 0x61, 0x1E, 0x80, 0x28, 0xC7, 0x08, 0x69, 0x1B, 0x85, 0x37, 0xF2, 0x9F, 0x2F, 0xC9, 0xA2,
-    0x08, 0xC5, 0x6A, 0x71, 0x61, 0x50, 0x97, 0x69, 0x7F, 0xA3, 0xD8, 0x84, 0xBA, 0xAE, 0x31, 0x84,
-    0x6F, 0xC1, 0xD1, 0x97, 0x6D, 0xB0, 0xC5, 0x94, 0x4A, 0x8D, 0x38, 0xF6, 0x61, 0x4F, 0xC7, 0xAA,
-    0xD5, 0xDF, 0x8A, 0x27, 0xA3, 0xD5, 0x5B, 0x93, 0x52, 0xF8, 0x80, 0x1A, 0xA8, 0x18, 0x2C, 0xEB,
-    0x9F, 0xA7, 0xE2, 0x7F, 0xCC, 0x8C, 0x83, 0x2C, 0x78, 0x00, 0x66, 0xE3, 0xF6, 0x31, 0xF0, 0xEB,
-    0xE8, 0x36, 0xB3, 0x1C, 0x0C, 0x1A, 0x23, 0xB3, 0x67, 0x42, 0xEA, 0x58, 0x93, 0x60, 0x1C, 0x77,
-    0x15, 0x34, 0x22, 0x81, 0x19, 0x0C, 0xDA, 0xAC, 0x53, 0x5A, 0x04, 0x71, 0x90, 0x00, 0x6F, 0xA5,
-    0x13, 0x1A, 0xD7, 0xE4, 0x17, 0xB0, 0xD8, 0x6C, 0xB2, 0x0D, 0x9A, 0x1F, 0x0A, 0x92, 0xDE, 0x29,
-    0xDB, 0x41, 0xC6, 0xD5, 0xC8, 0x3D, 0x34, 0x11, 0x31, 0xD0, 0x84, 0xBF, 0xB1, 0xF0, 0x76, 0x72,
-    0x9A, 0x55, 0x2C, 0x38, 0x28, 0xA3, 0xCD, 0x58, 0x9B, 0x16, 0xAE, 0xAB, 0x65, 0x68, 0xDA, 0x97,
-    0xD6, 0x24, 0x5E, 0xF5, 0x9C, 0xCF, 0x03, 0xE4, 0x31, 0x93, 0xBE, 0x85, 0xD9, 0xA0, 0x1C, 0x46,
-    0x33, 0x57, 0xF6, 0x34, 0x2A, 0xE1, 0x1B, 0xF9, 0x46, 0x43, 0x50, 0x07, 0xBF, 0xE1, 0x78, 0xB5,
-    0x52, 0x1D, 0xED, 0x14, 0xB1, 0x4D, 0xA9, 0xE6, 0x69, 0x37, 0x14, 0x3B, 0xB6, 0x1C, 0x2E, 0x1D,
-    0x78, 0x3B, 0x92, 0x97, 0x35, 0xD9, 0x79, 0x5F, 0x6F, 0x74, 0x7A, 0x63, 0xF4, 0x37, 0xA8, 0x0A,
-    0x21, 0xDE, 0x68, 0x08, 0x2E, 0x44, 0xFE, 0xED, 0x25, 0x16, 0x85, 0x65, 0xAE, 0x59, 0x42, 0x40,
-    0x6E, 0x37, 0xD3, 0xA9, 0x35, 0xB2, 0x37, 0x0A, 0x5A, 0x20, 0xFE, 0x13, 0x7E, 0x56, 0xE6, 0xA3,
-    0xF4, 0xF6, 0xA3, 0xD9, 0xA6, 0x07, 0xC3, 0x3E, 0x7C, 0x68, 0xF2, 0xFE, 0x3B, 0x24, 0x3A, 0x27,
-    0x58, 0x5A, 0xA4, 0x3A, 0x14, 0x8A, 0x2C, 0x7C, 0xA9, 0x13, 0x84, 0xBB, 0x91, 0x85, 0xDF, 0x92,
-    0xD0, 0xA9, 0x20, 0xCF, 0xAE, 0x55, 0x70, 0x3C, 0x26, 0xCA, 0xC7, 0x45, 0xCD, 0xE6, 0xF6, 0x71,
-    0x9E, 0xEE, 0xE1, 0xFC, 0xB3, 0xBD, 0x9C, 0x9F, 0xD5, 0x1B, 0x37, 0x78, 0xC9, 0xB5, 0x0C, 0x1D,
-    0xE5, 0x60, 0xE5, 0xEE, 0xB7, 0x44, 0x14, 0x0A, 0xC8, 0x52, 0xBF, 0xEB, 0x7C, 0x17, 0xC1, 0x74,
-    0x8A, 0x75, 0x7A, 0x9D, 0x09, 0x98, 0xD6, 0x51, 0x99, 0x2E, 0xEF, 0x71, 0xD6, 0xFD, 0x9E, 0xDC,
-    0xC7, 0xB5, 0xBB, 0x09, 0xA8, 0x53, 0xE7, 0x06, 0x55, 0x51, 0x5C, 0x45, 0xA1, 0x1C, 0x92, 0xFB,
-    0x1C, 0x55, 0x1B, 0xCC, 0x54, 0xAE, 0xB9, 0x86, 0xB6, 0x5C, 0x7C, 0xCD, 0xB4, 0x00, 0xCA, 0xCA,
-    0x58, 0xDD, 0xAD, 0xC9, 0x61, 0x3E, 0x78, 0x50, 0x79, 0x4A, 0xA9, 0x6E, 0x34, 0x35, 0xDF, 0xC7,
-    0xE7, 0x8D, 0xBD, 0x7C, 0x96, 0x7B, 0xF8, 0xBC, 0x33, 0xEB, 0x04, 0x9D, 0xD5, 0x60, 0xD5, 0xAA,
-    0x52, 0xD9, 0xF9, 0x6B, 0x27, 0xD7, 0x95, 0xCF, 0xC6, 0xCE, 0x00, 0x6D, 0x8D, 0x41, 0x47, 0x45,
-    0x5A, 0x93, 0xCA, 0x9D, 0x5A, 0xE5, 0x08, 0xC3, 0x56, 0xC7, 0xB3, 0x91, 0x22, 0x9D, 0xB6, 0x57,
-    0xAA, 0x59, 0x17, 0x4A, 0x6E, 0x51, 0xF4, 0x61, 0xEB, 0xD3, 0xA1, 0xA4, 0xFE, 0x7F, 0x31, 0xAB,
-    0xC9, 0x90, 0x68, 0xBD, 0xC3, 0x67, 0x48, 0xB5, 0x7A, 0x9A, 0x8E, 0x50, 0x25, 0x9D, 0x58, 0x11,
-    0x89, 0x81, 0x43, 0xA0, 0xF0, 0x8F, 0x09, 0xDF, 0x7F, 0x6C, 0xB3, 0x9A, 0xF5, 0x2C, 0x7D, 0xBC,
-    0x4E, 0x57, 0x3C, 0xC0, 0x19, 0x30, 0x9E, 0x68, 0x87, 0xCC, 0x55, 0x26, 0x72, 0xD1, 0xC0, 0xFD,
-    0xC9, 0x91, 0x45, 0x70, 0x28, 0xB7, 0x27, 0xEA, 0xDD, 0xA2, 0xEC, 0xDA, 0x27, 0xAC, 0x5B, 0xB6,
-    0x5F, 0xB5, 0xF2, 0xB5, 0x27, 0xC8, 0xD6, 0x21, 0x38, 0x5D, 0x3B, 0xC1, 0x5D, 0xA8, 0x11, 0xC9,
-    0x72, 0x6E, 0x85, 0xEB, 0xC0, 0x18, 0xC8, 0x7A, 0x10, 0x59, 0x77, 0xED, 0xBA, 0x47, 0x07, 0xB1,
-    0xBB, 0x83, 0x4C, 0x2B, 0xC5, 0x7B, 0x73, 0x1E, 0x84, 0x11, 0xC6, 0x0F, 0xE2, 0xD6, 0x8B, 0x3A,
-    0xCE, 0x7B, 0x34, 0xB6, 0xC6, 0xD0, 0xD7, 0xBD, 0xA9, 0x8C, 0xE2, 0x69, 0x00, 0xC9, 0xDE, 0x88,
-    0x19, 0xF8, 0xAC, 0xCF, 0x50, 0x12, 0x7A, 0x77, 0xBD, 0x1D, 0x49, 0x91, 0x89, 0xE7, 0x94, 0x7E,
-    0x52, 0xE7, 0x05, 0x53, 0x12, 0x63, 0xD2, 0x0A, 0x7D, 0x25, 0x82, 0xE2, 0xD4, 0xCA, 0x5B, 0x38,
-    0xAF, 0xB4, 0x05, 0xAC, 0x13, 0xF9, 0xEA, 0x96, 0x6D, 0x5D, 0x1F, 0xCD, 0x0F, 0x96, 0x83, 0x8F,
-    0x10, 0x40, 0x29, 0xD3, 0x2C, 0x45, 0x2A, 0x4D, 0x39, 0xCC, 0x69, 0xD6, 0xBF, 0x2B, 0xE4, 0x35,
-    0xB3, 0x22, 0xAF, 0x33, 0xAD, 0x7A, 0x95, 0x85, 0x79, 0x1A, 0x67, 0xA5, 0x5E, 0xDD, 0xEE, 0xD7,
-    0x0C, 0x76, 0x2B, 0xF6, 0x67, 0x05, 0xB7, 0x6B, 0xA9, 0xE7, 0x6B, 0xA9, 0xA7, 0x6B, 0x59, 0xEF,
-    0xB6, 0x62, 0x5F, 0xC9, 0xD1, 0xAE, 0xDB, 0xF5, 0x9C, 0xAC, 0xA5, 0x2E, 0xC3, 0xA3, 0xAD, 0x72,
-    0x5D, 0xAC, 0xDB, 0x33, 0xC8, 0xFA, 0x5A, 0xB6, 0x7E, 0x37, 0x5D, 0x9B, 0xDA, 0x91, 0x3D, 0xAA,
-    0xC4, 0x9A, 0x87, 0x09, 0x66, 0xE1, 0xEE, 0x16, 0x02, 0x77, 0xA7, 0xF7, 0xD0, 0xA3, 0x24, 0x16,
-    0xBD, 0x43, 0x28, 0x3A, 0xDA, 0x03, 0x4D, 0x7A, 0x03, 0x85, 0x84, 0x07, 0x9A, 0x4B, 0x36, 0x7B,
-    0x0D, 0x7F, 0x4B, 0xDA, 0xCF, 0x61, 0xCD, 0x3E, 0xE7, 0xB3, 0x17, 0x08, 0x4D, 0xFA, 0x5C, 0x7E,
-    0xED, 0x74, 0xBD, 0x8F, 0x2B, 0x2D, 0x9C, 0x1A, 0x15, 0x7A, 0xAC, 0x66, 0x95, 0xEB, 0x9C, 0x94,
-    0xB2, 0xAB, 0xA2, 0xBE, 0x1A, 0xA6, 0xA5, 0x3F, 0x5D, 0x8F, 0xD4, 0x0C, 0xCB, 0x17, 0x01, 0xBF,
-    0x7A, 0x38, 0x34, 0xBE, 0x64, 0xF3, 0x28, 0x6F, 0x77, 0x1E, 0xC3, 0x5B, 0xE5, 0x79, 0x8B, 0x9E,
-    0xC4, 0x9B, 0x6F, 0x5E, 0xE0, 0xB3, 0x3D, 0xE0, 0x44, 0x8C, 0xE6, 0x34, 0xA7, 0x1C, 0x5A, 0x01,
-    0xF0, 0x8B, 0xA5, 0xA2, 0x26, 0x53, 0x6B, 0xFE, 0x41, 0x48, 0xB6, 0x8B, 0x9C, 0x13, 0xAD, 0x7E,
-    0xCB, 0x7A, 0x72, 0x52, 0x6A, 0x4A, 0x3C, 0x69, 0xA1, 0xE2, 0x34, 0x57, 0x0C, 0x97, 0xC8, 0xC3,
-    0x82, 0xC2, 0x1C, 0x29, 0xFE, 0x38, 0xA6, 0xCC, 0x36, 0x16, 0xF8, 0x78, 0x62, 0xEE, 0xAE, 0x85,
-    0xB0, 0x58, 0xE8, 0x9D, 0x5D, 0x0B, 0x5B, 0xF4, 0xCB, 0xB1, 0x8F, 0xF5, 0xF4, 0x5F, 0x57, 0x1D,
-    0xF4, 0xA8, 0x24, 0xAD, 0xD7, 0x08, 0x2D, 0xD2, 0x0B, 0x59, 0x6D, 0xF6, 0xAD, 0xA3, 0xFD, 0xCE,
-    0x87, 0x02, 0xFF, 0xDB, 0x9A, 0x31, 0xD0, 0x8B, 0x59, 0x84, 0x1A, 0x7A, 0x37, 0x18, 0x2C, 0x32,
-    0x0E, 0x50, 0xCD, 0xD4, 0xA1, 0xD3, 0x74, 0xAF, 0xCD, 0x18, 0x54, 0x6A, 0x4D, 0x40, 0x6E, 0x32,
-    0x1B, 0x10, 0x56, 0x7C, 0xD2, 0x55, 0x6C, 0x54, 0x57, 0xA1, 0x2B, 0x1E, 0x7E, 0x81, 0x7B, 0x34,
-    0xAB, 0xA2, 0x8E, 0xAF, 0xE7, 0x78, 0x3F, 0xEE, 0x7A, 0xBD, 0xDC, 0xA8, 0x17, 0xAC, 0xD6, 0xEE,
-    0x45, 0x1D, 0xCF, 0xCA, 0x39, 0x31, 0x13, 0x28, 0xE7, 0x9F, 0x42, 0x9D, 0x57, 0xC9, 0xF5, 0x79,
-    0xA9, 0x21, 0x97, 0x18, 0x54, 0x94, 0xC6, 0xBE, 0xDF, 0x86, 0x13, 0x7E, 0x3E, 0x6E, 0x93, 0xB1,
-    0x3C, 0x03, 0x6A, 0xA4, 0x2D, 0x65, 0x88, 0x31, 0x66, 0x39, 0xEA, 0x12, 0x54, 0xB9, 0xAF, 0x97,
-    0xD9, 0xE1, 0x11, 0x20, 0xFB, 0x04, 0xA5, 0x48, 0xFB, 0x98, 0x7B, 0x22, 0xD2, 0x2A, 0x6B, 0xE2,
-    0x31, 0x44, 0xC4, 0x40, 0xCA, 0x5A, 0x0E, 0xE1, 0x98, 0x02, 0x4B, 0xD4, 0x23, 0x34, 0x28, 0xC5,
-    0x04, 0x37, 0x13, 0x1B, 0x3D, 0x6B, 0xB8, 0x2D, 0x74, 0x4A, 0x6A, 0xDB, 0x64, 0x04, 0x12, 0x96,
-    0x91, 0xDD, 0x21, 0xA2, 0x47, 0xA3, 0x9D, 0x8A, 0xF2, 0xA6, 0xF8, 0x95, 0x64, 0x92, 0x41, 0x3A,
-    0x64, 0x0C, 0x16, 0x27, 0x76, 0x66, 0x77, 0x3B, 0xD7, 0x98, 0x98, 0xC1, 0x69, 0xE0, 0x0C, 0xE5,
-    0x00, 0xAE, 0x3A, 0xD1, 0xAB, 0xF4, 0x96, 0x8C, 0xCE, 0xE9, 0x8E, 0x1B, 0x62, 0x08, 0x1B, 0x53,
-    0x5C, 0x56, 0x98, 0x80, 0xD6, 0x9A, 0x70, 0xCC, 0x96, 0xC6, 0xBD, 0xD8, 0x98, 0xEC, 0x97, 0x1D,
-    0x90, 0xF8, 0xAB, 0xE8, 0x20, 0xBB, 0xFB, 0x12, 0x94, 0x0A, 0x43, 0xB9, 0xB9, 0x04, 0x00, 0x5D,
-    0x72, 0x75, 0xC2, 0x6C, 0x43, 0x35, 0xC4, 0x16, 0x1E, 0xBF, 0x13, 0xA8, 0x12, 0xBB, 0x7F, 0xB9,
-    0xAB, 0x7A, 0xAA, 0x34, 0xA8, 0xC2, 0xCA, 0x8C, 0x22, 0xA8, 0x16, 0x5A, 0xC5, 0x00, 0x78, 0x26,
-    0x74, 0xDE, 0x07, 0x9C, 0xB9, 0x36, 0x95, 0xE8, 0xD6, 0x0B, 0xE9, 0xA3, 0x69, 0x4B, 0x82, 0x11,
-    0xDA, 0x08, 0x9C, 0xD2, 0xDA, 0x22, 0x1A, 0x30, 0x01, 0xEE, 0x0C, 0x72, 0xA4, 0xDB, 0xF0, 0x58,
-    0xFD, 0x79, 0x13, 0x4C, 0xA4, 0xE1, 0xE6, 0xCE, 0xF7, 0x98, 0xE2, 0xF8, 0x04, 0x87, 0x61, 0x12,
-    0x2A, 0x71, 0xAF, 0xD3, 0x3D, 0x0C, 0xC4, 0xB3, 0x44, 0xB3, 0xD9, 0x74, 0x52, 0x91, 0x6C, 0x44,
-    0xB0, 0x79, 0x35, 0xF9, 0x3D, 0x4A, 0x9B, 0xD0, 0x52, 0x81, 0x25, 0x0B, 0xEF, 0x04, 0x95, 0x19,
-    0x20, 0x65, 0x2C, 0xFF, 0x2A, 0xCB, 0x47, 0x9C, 0xCC, 0x53, 0xE5, 0x34, 0xEA, 0x14, 0xB2, 0x98,
-    0xF0, 0x21, 0x04, 0x3C, 0xCC, 0x20, 0x4F, 0x11, 0x88, 0x3D, 0xE0, 0xA5, 0x9F, 0xEA, 0xB0, 0xBB,
-    0x12, 0x3C, 0xEA, 0x4B, 0xBF, 0x6F, 0x22, 0x98, 0x64, 0x1E, 0xC9, 0x40, 0x94, 0xC0, 0xA8, 0x1D,
-    0xA5, 0xD9, 0x19, 0x47, 0x81, 0x4E, 0xDB, 0xAE, 0xF6, 0x48, 0xB5, 0xB7, 0x3E, 0xF1, 0xCD, 0xFC,
-    0xFA, 0xDB, 0x7B, 0x10, 0xEE, 0x83, 0x4D, 0x96, 0x5F, 0x75, 0x8B, 0xC5, 0xAB, 0x1E, 0x1C, 0x52,
-    0xCA, 0x93, 0x89, 0x2F, 0xFA, 0x2A, 0x73, 0xA3, 0x29, 0xAB, 0xE8, 0x1A, 0x23, 0xC0, 0x0E, 0xAC,
-    0x96, 0x17, 0x0A, 0x0A, 0xDD, 0xFD, 0xEF, 0x9C, 0x5C, 0xEF, 0xDF, 0x97, 0x54, 0xEB, 0x32, 0x0D,
-    0x97, 0xD3, 0x4B, 0x5F, 0x3D, 0x89, 0x7D, 0x75, 0x43, 0x01, 0xAC, 0x34, 0xFF, 0xF2, 0xC8, 0xBE,
-    0xA4, 0xF3, 0x46, 0x0B, 0x5A, 0xC4, 0xAD, 0xC7, 0xAE, 0x2A, 0x18, 0xA5, 0x8F, 0x83, 0xF9, 0x6B,
-    0x31, 0x8E, 0xDB, 0x01, 0x58, 0x3A, 0x9B, 0xD7, 0x5B, 0x29, 0xD6, 0x63, 0x4F, 0xB2, 0x9F, 0x1D,
-    0xA3, 0x7B, 0x63, 0x2C, 0xEB, 0xCF, 0x1D, 0xB7, 0xC0, 0x98, 0x31, 0x7D, 0xB0, 0xAD, 0x7A, 0x73,
-    0x9F, 0x7E, 0x9D, 0xDE, 0x61, 0x6B, 0x67, 0x53, 0xA9, 0x0A, 0x74, 0xA6, 0x46, 0x93, 0x10, 0x05,
-    0x56, 0xE2, 0xF7, 0xCE, 0x10, 0xDA, 0x4F, 0x73, 0xB6, 0x61, 0xE7, 0x7A, 0x2E, 0x7D, 0x3E, 0x61,
-    0x07, 0x1D, 0xFE, 0x63, 0x8A, 0x5D, 0x4F, 0x3A, 0x8E, 0x52, 0x45, 0x7D, 0xB5, 0xBD, 0x4E, 0xC7,
-    0x78, 0xC0, 0xD8, 0xF6, 0x34, 0xA6, 0xA5, 0x5D, 0xB9, 0xAB, 0x97, 0xB9, 0x3F, 0x63, 0x5A, 0xF8,
-    0xF0, 0x4F, 0xC4, 0x96, 0x4A, 0x11, 0x5E, 0x9F, 0x4B, 0x8A, 0x03, 0xE3, 0x91, 0x02, 0x64, 0x15,
-    0x97, 0xE9, 0xE7, 0x25, 0x15, 0x0A, 0x84, 0x59, 0x31, 0xE1, 0xB4, 0x7B, 0x4D, 0x8C, 0x3B, 0x68,
-    0xD4, 0x8F, 0xD6, 0x40, 0xDD, 0x65, 0x2A, 0x00, 0x51, 0x2D, 0xA6, 0xE0, 0x05, 0xA1, 0xDB, 0xAD,
-    0x65, 0xFB, 0xCA, 0x40, 0xC0, 0x4B, 0xFD, 0x79, 0x1F, 0x9F, 0xCF, 0xE5, 0x8D, 0x42, 0xD7, 0xF6,
-    0x33, 0x55, 0xEE, 0xDA, 0xFC, 0x78, 0x65, 0x6E, 0xC1, 0x5C, 0xBC, 0x68, 0x58, 0x4F, 0x09, 0x36,
-    0xF1, 0x07, 0x10, 0x8E, 0x09, 0x72, 0x6A, 0x72, 0xE9, 0x94, 0xC2, 0x31, 0x5F, 0x92, 0xD7, 0x20,
-    0xE7, 0x2F, 0xA9, 0x75, 0x3F, 0x4D, 0x3A, 0x20, 0x2D, 0x3C, 0x10, 0x4F, 0xBA, 0x2C, 0xC8, 0x5D,
-    0x33, 0xDF, 0x98, 0x07, 0x79, 0xA6, 0xD0, 0x5D, 0x33, 0x8F, 0xFF, 0x2F, 0xFD, 0x7F, 0xCD, 0x7F,
-    0xD7, 0xE0, 0x3F, 0x6A, 0xB3, 0x6A, 0x8A, 0x5B, 0x7B, 0x6D, 0xFF, 0xEA, 0xF8, 0x36, 0x0C, 0xB4,
-    0xB5, 0x95, 0xEC, 0xF9, 0x29, 0xAF, 0x49, 0x3C, 0x66, 0x9D, 0xFB, 0x15, 0x14, 0x95, 0xBB, 0x43,
-    0xC2, 0x79, 0x69, 0x3F, 0xD0, 0x9D, 0x61, 0xAE, 0x0E, 0x70, 0x3B, 0x40, 0xCC, 0xAE, 0x37, 0xF7,
-    0xCD, 0xC7, 0x3B, 0xC6, 0x6F, 0x93, 0xD3, 0x1D, 0x0D, 0xC3, 0xEC, 0x9B, 0x1F, 0x7B, 0xC1, 0x6B,
-    0xE8, 0xAC, 0x10, 0x14, 0x02, 0xCD, 0x80, 0xD1, 0x2B, 0xAF, 0xDD, 0xA9, 0x29, 0xE9, 0x6D, 0x83,
-    0x5C, 0x1E, 0x89, 0xCE, 0x7D, 0xF9, 0xAF, 0xED, 0xEF, 0xFC, 0x70, 0x6F, 0x9D, 0x6E, 0xD0, 0x4E,
-    0x9E, 0xF4, 0xC3, 0xBE, 0xCB, 0xF9, 0x67, 0x2E, 0x4D, 0x13, 0x07, 0x84, 0x1B, 0xBB, 0x29, 0x85,
-    0x26, 0x3B, 0xF1, 0xBC, 0xCA, 0x5A, 0xFB, 0x54, 0xA8, 0xF1, 0x0B, 0x46, 0x46, 0xCB, 0x92, 0x66,
-    0xB1, 0x75, 0x77, 0xD3, 0x6C, 0x5D, 0x2E, 0x99, 0xD7, 0x7E, 0x3A, 0xCC, 0x95, 0xB5, 0xD4, 0x97,
-    0x20, 0x9A, 0x52, 0xB8, 0x6C, 0x03, 0xD8, 0x05, 0x0B, 0x84, 0x0D, 0x97, 0x55, 0xC0, 0x7A, 0x1B,
-    0x47, 0x84, 0xB3, 0xC9, 0xE1, 0x79, 0xC6, 0x50, 0x77, 0x81, 0x10, 0x6E, 0x94, 0xBA, 0xA4, 0xED,
-    0x17, 0x21, 0x7C, 0x72, 0xE8, 0x73, 0x1E, 0x0F, 0x75, 0x93, 0xBA, 0x47, 0xD2, 0x92, 0x83, 0x80,
-    0xF7, 0xAA, 0xE0, 0x33, 0xDC, 0x3E, 0x8F, 0x30, 0x9E, 0x5E, 0x78, 0x34, 0x81, 0x09, 0x86, 0xAD,
-    0x8F, 0x74, 0x6D, 0x8B, 0x56, 0x4C, 0x93, 0x3E, 0x25, 0x4B, 0x2E, 0x22, 0x46, 0xDC, 0x2C, 0x25,
-    0xC4, 0x13, 0x77, 0xE0, 0x07, 0x3B, 0x59, 0xEA, 0xA6, 0x05, 0x79, 0x9D, 0x5B, 0x25, 0xC5, 0x64,
-    0x3B, 0x52, 0xC5, 0x53, 0xD9, 0x86, 0xF2, 0x01, 0x52, 0xD3, 0x87, 0x02, 0x6C, 0xE0, 0x37, 0x5C,
-    0x54, 0x73, 0x75, 0x91, 0x92, 0x79, 0xA4, 0xB2, 0x78, 0x62, 0x24, 0xD9, 0xBA, 0x0B, 0xAC, 0xB0,
-    0x93, 0x6B, 0xF3, 0x2E, 0x26, 0x3E, 0x29, 0x6F, 0xC0, 0xCA, 0x3F, 0x23, 0xEB, 0x90, 0xAE, 0xBB,
-    0xD2, 0x9A, 0xFC, 0x63, 0x5C, 0xD8, 0x41, 0x0C, 0x9C, 0x6C, 0x1B, 0x01, 0xF6, 0x8A, 0x16, 0x13,
-    0x58, 0x4A, 0x20, 0xCC, 0xEC, 0xB4, 0x0F, 0x9F, 0x89, 0x97, 0x73, 0xC5, 0x6F, 0x2F, 0x5E, 0x08,
-    0xBF, 0x14, 0x2F, 0x70, 0xEF, 0x0C, 0x77, 0xD6, 0xB0, 0x2E, 0x92, 0xCA, 0x95, 0x21, 0x19, 0x03,
-    0xB9, 0xC8, 0xB8, 0x42, 0x48, 0x04, 0x1A, 0xE4, 0x4D, 0xD0, 0xF0, 0xC9, 0x60, 0x92, 0x1D, 0x25,
-    0xAA, 0x36, 0xAC, 0x49, 0x00, 0x4A, 0xFB, 0x28, 0x4A, 0xB7, 0x3E, 0x68, 0x5D, 0x94, 0x7D, 0xA8,
-    0xF9, 0xEC, 0xC3, 0x0C, 0x2B, 0xF7, 0x72, 0x28, 0x66, 0x08, 0x30, 0xAD, 0xE0, 0xA1, 0x88, 0xD5,
-    0x8A, 0x3F, 0x81, 0x2F, 0x28, 0xCA, 0x46, 0x96, 0xF1, 0x00, 0xFD, 0x92, 0x97, 0xE1, 0x82, 0xC1,
-    0x7A, 0xF2, 0x00, 0xB3, 0x3E, 0x29, 0x1D, 0x9D, 0x4A, 0xDB, 0x76, 0x73, 0x48, 0xD3, 0x92, 0xA8,
-    0x8A, 0x8F, 0x7D, 0xF8, 0xFA, 0xC5, 0x1A, 0x38, 0x88, 0x07, 0x0E, 0xE1, 0xA1, 0xC0, 0xE1, 0x69,
-    0xB3, 0xBC, 0x0B, 0x1E, 0x6A, 0x99, 0x3D, 0x19, 0xC1, 0xC3, 0xA5, 0x43, 0xC0, 0xC3, 0xD3, 0x67,
-    0xD9, 0x1C, 0x2F, 0x56, 0x0B, 0x4A, 0xBE, 0x5E, 0xA1, 0x4D, 0xBF, 0xC5, 0x21, 0x1F, 0xD7, 0x00,
-    0x7D, 0x75, 0x7C, 0xD3, 0x3C, 0xB3, 0xCE, 0x24, 0x35, 0x6F, 0x81, 0xCB, 0x7C, 0xB0, 0xBD, 0xBD,
-    0x02, 0x1B, 0xBF, 0x75, 0x67, 0x74, 0x92, 0xC1, 0x4A, 0xEB, 0xFC, 0xE6, 0x2F, 0xDE, 0x71, 0xC5,
-    0x7C, 0xA6, 0xE5, 0x66, 0xEE, 0x34, 0x8A, 0xD6, 0x6B, 0x97, 0xE5, 0x72, 0x8E, 0x7D, 0xFE, 0xAC,
-    0xF2, 0x5E, 0x4F, 0x77, 0x0C, 0x9D, 0xC0, 0x08, 0xCA, 0x52, 0xA9, 0xCB, 0x42, 0x60, 0x32, 0xFF,
-    0x0C, 0x0E, 0x02, 0xF8, 0x8B, 0xBB, 0x29, 0xEF, 0x21, 0x0C, 0x8B, 0xAD, 0xCB, 0x9B, 0x83, 0xBB,
-    0x20, 0xF9, 0xAF, 0xA6, 0x78, 0x90, 0xB3, 0x7D, 0xF6, 0x70, 0x28, 0x61, 0x05, 0x5F, 0x68, 0x6A,
-    0x3C, 0xD0, 0x75, 0x34, 0xD1, 0xBC, 0x80, 0xD1, 0xF9, 0xBE, 0x58, 0x2B, 0xD3, 0x85, 0x39, 0xBF,
-    0xE4, 0xD6, 0xCF, 0x58, 0x60, 0xF7, 0xAC, 0xAC, 0xE7, 0x45, 0x3B, 0xE5, 0xB2, 0x6C, 0x56, 0x67,
-    0x24, 0x8F, 0x45, 0xD4, 0xB0, 0x32, 0xBB, 0xD1, 0x60, 0xBE, 0xF9, 0xC4, 0x04, 0x20, 0x87, 0xF6,
-    0xDD, 0xEC, 0x4C, 0x76, 0x9F, 0x8B, 0x1A, 0xE5, 0x32, 0x90, 0x8C, 0x7B, 0x2C, 0xE9, 0xC1, 0x74,
-    0xC3, 0x65, 0x15, 0x4A, 0xCA, 0x64, 0x83, 0xAB, 0x8E, 0x30, 0x86, 0x91, 0xF9, 0xD9, 0x8B, 0xF3,
-    0x7E, 0x66, 0x2E, 0xA6, 0x72, 0x83, 0xAE, 0xB2, 0xD3, 0x1C, 0x5D, 0x97, 0x80, 0xD4, 0x98, 0x1B,
-    0x9F, 0xFA, 0xA8, 0x31, 0x4F, 0xF3, 0x0E, 0xEA, 0x27, 0x1D, 0x09, 0xDC, 0x9B, 0xA7, 0xA1, 0xF0,
-    0x34, 0xDC, 0x5C, 0xD3, 0x00, 0xA2, 0x66, 0x1A, 0xF2, 0x96, 0x5B, 0x3D, 0x6D, 0x0D, 0xA7, 0x02,
-    0x4F, 0x7A, 0x9B, 0x34, 0x30, 0xDF, 0x49, 0xD5, 0xED, 0xC1, 0x32, 0x2C, 0x77, 0x0A, 0xBB, 0x7A,
-    0xCF, 0x82, 0x02, 0x9D, 0x38, 0x97, 0xEE, 0xB8, 0x89, 0xCB, 0x7E, 0x32, 0xE2, 0x1C, 0x7F, 0x07,
-    0xD6, 0xEE, 0x70, 0x16, 0xF9, 0x61, 0x6B, 0x3F, 0xEC, 0xFD, 0xF5, 0xB0, 0x8D, 0x3A, 0x37, 0x0E,
-    0x9B, 0x40, 0x16, 0x11, 0xFD, 0x29, 0x8C, 0xAA, 0x70, 0x1D, 0x8B, 0x9F, 0x0C, 0xDA, 0xA7, 0x39,
-    0xAC, 0xF3, 0xA9, 0xF4, 0x64, 0xB6, 0xE8, 0x4B, 0x80, 0x11, 0x42, 0xC5, 0x08, 0xD5, 0xCA, 0xB2,
-    0xD2, 0xD1, 0x63, 0x84, 0x4F, 0xF7, 0xA9, 0xF5, 0xEF, 0x61, 0xEC, 0x55, 0x15, 0xA2, 0xD0, 0xFD,
-    0x8D, 0x10, 0x6A, 0x33, 0x9F, 0x85, 0xC3, 0x57, 0x5A, 0x8D, 0xDF, 0x5F, 0x35, 0xE2, 0xCA, 0xE7,
-    0x59, 0x84, 0xB0, 0x21, 0xEB, 0x11, 0xC4, 0x90, 0x7B, 0xC2, 0xFB, 0xB7, 0x88, 0x69, 0xAE, 0xCE,
-    0xB9, 0x32, 0x07, 0x97, 0x25, 0x97, 0x58, 0x5E, 0xC8, 0x75, 0x61, 0x87, 0xA0, 0x96, 0x49, 0x01,
-    0x79, 0xB5, 0x0A, 0xD9, 0x86, 0x79, 0x2F, 0x17, 0x63, 0x9F, 0xC7, 0xB7, 0x65, 0xE3, 0x61, 0xAD,
-    0xE5, 0x93, 0xCC, 0x89, 0x23, 0x86, 0x56, 0x2D, 0xFE, 0xEC, 0xAB, 0xD1, 0x31, 0x1C, 0xC0, 0x04,
-    0x57, 0x3F, 0x83, 0xC6, 0xC8, 0x58, 0xB7, 0x28, 0x0F, 0xF1, 0x84, 0x64, 0xF7, 0x3A, 0x46, 0x4E,
-    0x86, 0xB2, 0x62, 0xC4, 0x81, 0xFB, 0x49, 0x3F, 0xC4, 0x8F, 0xAD, 0xF2, 0x3B, 0x03, 0x55, 0x57,
-    0x2E, 0x0E, 0x25, 0xB0, 0x24, 0x37, 0x75, 0x16, 0x98, 0x7F, 0xC2, 0xA9, 0xC7, 0x41, 0x03, 0x6E,
-    0x35, 0x44, 0x88, 0x64, 0xE1, 0x26, 0x1B, 0x32, 0x56, 0x1D, 0x1C, 0x62, 0xE3, 0x75, 0x2D, 0xC7,
-    0x8A, 0x39, 0xBE, 0x79, 0x7C, 0xF3, 0x6B, 0x2B, 0xA6, 0xFF, 0x03, 0xDD, 0x5C, 0x31, 0x90, 0xDD,
-    0xD6, 0x75, 0x7D, 0x00, 0xCC, 0xFD, 0x33, 0x42, 0x01, 0x15, 0xA6, 0x0A, 0x72, 0x26, 0x68, 0xD2,
-    0x84, 0x85, 0xD1, 0x66, 0x32, 0x13, 0x01, 0x16, 0xC7, 0xC3, 0x82, 0x85, 0xB7, 0xE0, 0xAA, 0xB0,
-    0x0A, 0x36, 0x6E, 0xA2, 0x64, 0x66, 0x5B, 0x37, 0x32, 0x60, 0xA9, 0x50, 0x91, 0xC2, 0x9C, 0x8C,
-    0x35, 0x99, 0x24, 0x85, 0x99, 0x19, 0x39, 0x23, 0x2D, 0x8B, 0x75, 0xE9, 0x49, 0x64, 0x02, 0x14,
-    0x27, 0x61, 0xE1, 0xC2, 0xB0, 0x34, 0x8A, 0x0A, 0x15, 0x82, 0x22, 0x3A, 0x1A, 0xCB, 0x85, 0x40,
-    0x1B, 0x54, 0xB0, 0x2B, 0x00, 0x2F, 0xF7, 0x9C, 0xFB, 0xF0, 0xFF, 0xFE, 0xDD, 0xFD, 0x24, 0x9D,
-    0xC8, 0x0E, 0x99, 0x4F, 0x7E, 0xFC, 0xF7, 0xF1, 0xFF, 0x07, 0xDE, 0xBB, 0xEF, 0xBE, 0x7B, 0xCF,
-    0x3D, 0xF7, 0xBE, 0x35, 0xC6, 0x98, 0xA7, 0x8D, 0xF1, 0xF7, 0xED, 0x28, 0x47, 0x6B, 0x6D, 0x65,
-    0x8C, 0x1C, 0x5B, 0x63, 0x4A, 0xFB, 0xE9, 0x1B, 0xE6, 0xE1, 0x0F, 0x9B, 0xE1, 0x98, 0xB7, 0x38,
-    0xA6, 0x03, 0x8E, 0x91, 0x2D, 0xE4, 0x18, 0xE2, 0x1A, 0x26, 0xC0, 0x65, 0x8D, 0x67, 0xCB, 0x0A,
-    0x5F, 0xFD, 0x3E, 0x4E, 0xA5, 0xEF, 0x4E, 0x72, 0x4C, 0x5A, 0x9C, 0x8A, 0xFA, 0xB8, 0x33, 0x66,
-    0x31, 0x06, 0x16, 0x5F, 0x35, 0x38, 0x65, 0xAB, 0xB8, 0x97, 0x9B, 0xD7, 0x38, 0x95, 0x1E, 0xEC,
-    0xD8, 0xDA, 0xC4, 0xD2, 0x9F, 0x5E, 0xAE, 0x27, 0x0F, 0xF9, 0x92, 0x3C, 0x1A, 0xF4, 0xD3, 0x0E,
-    0xE8, 0xA7, 0xB5, 0x59, 0x2E, 0x5F, 0xB7, 0x4D, 0x32, 0xE0, 0xF6, 0x91, 0xC5, 0x8D, 0x2F, 0x49,
-    0x07, 0x3C, 0xDE, 0xDE, 0x78, 0x7B, 0x76, 0xF2, 0x30, 0x2A, 0x79, 0x76, 0xB9, 0xB5, 0x6F, 0x6E,
-    0x1E, 0x88, 0x57, 0x16, 0x10, 0x40, 0x2F, 0x5F, 0x9F, 0x8C, 0xFD, 0x07, 0x5B, 0xE5, 0x59, 0xDA,
-    0xA6, 0xC5, 0x62, 0x88, 0x6A, 0x63, 0x83, 0xD6, 0x24, 0xBF, 0x90, 0x4E, 0x74, 0x37, 0x8D, 0x37,
-    0xC5, 0x99, 0xC9, 0x5F, 0x6D, 0x4C, 0x72, 0x6F, 0xDA, 0x29, 0x87, 0x54, 0xAE, 0x1C, 0xCE, 0x77,
-    0x88, 0xED, 0x17, 0xA3, 0x29, 0xEF, 0xCA, 0xD5, 0x9E, 0xFA, 0x81, 0x2F, 0xD2, 0x0B, 0x06, 0x0F,
-    0x83, 0x45, 0x37, 0x65, 0xC8, 0x16, 0x82, 0xF1, 0x29, 0x62, 0x73, 0x7E, 0xCA, 0x9E, 0x50, 0xB1,
-    0x3E, 0xF5, 0xBA, 0xF7, 0x46, 0x30, 0x7A, 0x16, 0xDF, 0x2B, 0xE4, 0x22, 0x15, 0x47, 0x14, 0x9E,
-    0x36, 0x9E, 0xAD, 0x09, 0xBF, 0xB3, 0xCD, 0x42, 0xEE, 0x14, 0x4C, 0xBB, 0xD6, 0x1B, 0xA5, 0x1F,
-    0x93, 0x89, 0xDB, 0x34, 0x0B, 0x86, 0xA8, 0x32, 0xE5, 0x25, 0x91, 0xE2, 0x3B, 0xBD, 0x59, 0xF4,
-    0x2F, 0x41, 0xAC, 0x85, 0x29, 0xEF, 0x1C, 0x3C, 0x6F, 0x5B, 0xF4, 0x42, 0x84, 0x65, 0xD1, 0xAB,
-    0x3A, 0xB7, 0x9F, 0x75, 0xBE, 0xBD, 0x06, 0x01, 0x74, 0xB8, 0xE6, 0xC2, 0x1A, 0x0A, 0xA0, 0xA2,
-    0x94, 0x7A, 0x1C, 0x4B, 0x9E, 0x4A, 0x65, 0x4C, 0xC6, 0xC4, 0x5F, 0x40, 0x58, 0x51, 0x8F, 0x53,
-    0xC1, 0x98, 0x36, 0x10, 0x78, 0x88, 0x53, 0xF6, 0x7B, 0x10, 0x69, 0x5E, 0xA7, 0x22, 0xAC, 0xB4,
-    0xC5, 0xA9, 0x68, 0xF0, 0x64, 0x44, 0xE1, 0x28, 0x6F, 0xE5, 0x7A, 0xAF, 0x5D, 0x1D, 0x0D, 0x34,
-    0x45, 0x4E, 0x95, 0x5C, 0x00, 0x98, 0xD8, 0x09, 0x93, 0x26, 0xC3, 0x8B, 0x70, 0xEC, 0x16, 0xF2,
-    0x59, 0x34, 0xF9, 0x72, 0x6B, 0xB9, 0x3D, 0x97, 0x48, 0x07, 0x29, 0xC5, 0xBC, 0xFD, 0x82, 0x93,
-    0x14, 0xF0, 0xE8, 0x8D, 0x1C, 0x7E, 0x6E, 0x75, 0xDE, 0x2A, 0xCE, 0x15, 0xA7, 0x32, 0xEC, 0x8F,
-    0xAB, 0x1C, 0xD5, 0x82, 0x3A, 0x17, 0x1D, 0x94, 0x83, 0x81, 0xD2, 0x05, 0xBD, 0xC9, 0x2B, 0x68,
-    0x9D, 0x49, 0x8D, 0x3F, 0x7A, 0x50, 0xBB, 0xB0, 0x31, 0x71, 0x03, 0xBD, 0x2B, 0xBE, 0x2B, 0x03,
-    0xF2, 0xA0, 0x78, 0x90, 0x4E, 0x1B, 0xCE, 0xBD, 0x33, 0x54, 0xBD, 0x70, 0xBA, 0x84, 0x0E, 0x60,
-    0xD8, 0x01, 0xD4, 0x21, 0x6E, 0x20, 0x1E, 0x03, 0x21, 0x0C, 0x10, 0x5A, 0x0B, 0xF9, 0x49, 0x77,
-    0xBC, 0x9B, 0xB8, 0xFD, 0x4F, 0xD9, 0x3D, 0xF4, 0xCE, 0x67, 0xB7, 0x53, 0x4C, 0x61, 0xC8, 0x7E,
-    0xDA, 0xCD, 0x9A, 0xB9, 0x65, 0x0F, 0x33, 0xB9, 0x8A, 0x5C, 0x30, 0xA0, 0xB9, 0xA0, 0x1A, 0x41,
-    0x58, 0x59, 0x68, 0xA7, 0xBD, 0xCE, 0x50, 0x35, 0x13, 0xBB, 0x9C, 0x24, 0x88, 0x48, 0xB4, 0x00,
-    0xD7, 0xA6, 0x0C, 0x22, 0x5E, 0xFB, 0x64, 0x13, 0xDA, 0xCD, 0xDF, 0x46, 0x76, 0xCC, 0x5E, 0xC8,
-    0x72, 0x48, 0x9C, 0x7A, 0x99, 0x61, 0x0E, 0x3A, 0xAA, 0x65, 0x11, 0xF0, 0x6E, 0x11, 0xA7, 0x29,
-    0x46, 0xD3, 0xC3, 0x44, 0xCA, 0x28, 0x53, 0x1D, 0x04, 0x9A, 0xE5, 0xAA, 0xAF, 0xB2, 0xCA, 0x16,
-    0x22, 0xD9, 0x5C, 0xD4, 0x4F, 0xD4, 0x30, 0xE9, 0xB8, 0xAE, 0x30, 0x53, 0x31, 0x66, 0xAF, 0x12,
-    0xB1, 0x60, 0x99, 0xC8, 0x5B, 0xA8, 0x79, 0xFF, 0x47, 0x32, 0xF3, 0xA2, 0xA1, 0xF2, 0x2C, 0x65,
-    0x74, 0xC9, 0x4A, 0xA3, 0x73, 0x0A, 0xAA, 0xE7, 0x90, 0x6A, 0xAE, 0x67, 0xF9, 0x28, 0x15, 0x79,
-    0x8B, 0x4E, 0x8A, 0x56, 0xCA, 0xA4, 0x27, 0xF5, 0x93, 0x21, 0x2E, 0x3E, 0xF0, 0x2B, 0xD8, 0x04,
-    0xDC, 0x2A, 0x87, 0xBE, 0x7F, 0x38, 0x98, 0xB2, 0x28, 0xAB, 0x32, 0x53, 0x25, 0xD6, 0xC7, 0xEE,
-    0x01, 0xD6, 0x03, 0x54, 0xB3, 0x31, 0xF8, 0x69, 0x29, 0x43, 0x4C, 0x6B, 0x15, 0x1D, 0xBE, 0x07,
-    0xD9, 0xF1, 0x32, 0xB4, 0x35, 0x78, 0x63, 0x9B, 0xEF, 0x40, 0x9B, 0xB3, 0x00, 0xF7, 0x97, 0x86,
-    0x7C, 0x7C, 0x80, 0xC1, 0xF0, 0xA2, 0x1C, 0x5C, 0xA4, 0x4D, 0x2E, 0xD4, 0x91, 0x6A, 0x09, 0x05,
-    0x3D, 0xBB, 0xF3, 0xF8, 0x0B, 0xEE, 0xCC, 0x36, 0x8C, 0x87, 0x48, 0x24, 0x93, 0x45, 0x06, 0x65,
-    0xE1, 0xF5, 0x9C, 0x19, 0x9A, 0xE5, 0x15, 0xD3, 0x7B, 0x34, 0xF2, 0xB3, 0x42, 0xA4, 0x15, 0x8C,
-    0x2A, 0xAC, 0x5C, 0xF5, 0x0C, 0x62, 0x80, 0xA8, 0x60, 0xD3, 0x45, 0x52, 0xBE, 0xDE, 0x56, 0x6C,
-    0x9B, 0x5C, 0x07, 0x72, 0x4A, 0x6A, 0xF8, 0x0A, 0x99, 0x07, 0xB8, 0xA1, 0xBC, 0xC1, 0x58, 0x30,
-    0xA2, 0x64, 0x32, 0x4E, 0xCE, 0x26, 0xE0, 0xD2, 0xFC, 0xCA, 0x93, 0xB2, 0x34, 0x71, 0x83, 0x42,
-    0xEC, 0x7C, 0x17, 0xB7, 0xC1, 0xC4, 0xDE, 0xA8, 0x2B, 0x83, 0x4C, 0xC2, 0x66, 0xBD, 0xE7, 0xB2,
-    0x50, 0xA1, 0x6C, 0xD2, 0xF7, 0x02, 0xD2, 0xC3, 0x4A, 0x85, 0xAE, 0xE5, 0x95, 0x3E, 0x4B, 0xF7,
-    0xCC, 0x6B, 0x95, 0x1F, 0xD6, 0x2A, 0x34, 0x4D, 0xBE, 0x5B, 0x53, 0x80, 0xB2, 0x58, 0xBD, 0x6D,
-    0x73, 0x26, 0x13, 0x29, 0xC2, 0x04, 0x97, 0xB7, 0xEC, 0xEC, 0x69, 0xD5, 0x61, 0x26, 0xC3, 0xD2,
-    0xA9, 0x06, 0xCD, 0x26, 0xF1, 0xC9, 0xB8, 0xAE, 0x41, 0x7C, 0xF6, 0x2E, 0x9A, 0x74, 0x5B, 0x72,
-    0x09, 0x34, 0xAD, 0xE8, 0xF7, 0x42, 0x00, 0x44, 0x2B, 0xC7, 0x3B, 0x16, 0x7A, 0x8C, 0x5E, 0xE4,
-    0xEF, 0xC3, 0xBF, 0x4E, 0x68, 0x26, 0xFF, 0xC5, 0x1B, 0x2E, 0x9B, 0x01, 0x9B, 0x29, 0x9A, 0x0B,
-    0x7C, 0xC1, 0xB3, 0x9F, 0x58, 0xF3, 0x8C, 0x1D, 0x79, 0xB1, 0x3B, 0xF4, 0xB3, 0x6C, 0x5E, 0xC2,
-    0xA1, 0x45, 0x73, 0x58, 0xD0, 0xDF, 0x48, 0xF3, 0x57, 0xEC, 0x4C, 0x5A, 0x2F, 0xED, 0x70, 0x30,
-    0xA4, 0x70, 0xEA, 0x2D, 0x34, 0x21, 0xBD, 0x03, 0xC1, 0x5A, 0x18, 0xF6, 0x60, 0x80, 0xFB, 0x88,
-    0x7E, 0x23, 0x0E, 0xF5, 0x6E, 0xFE, 0x73, 0x4E, 0x48, 0x5A, 0xA7, 0xF3, 0xEC, 0x8B, 0xC3, 0xE8,
-    0x12, 0x99, 0x0A, 0x99, 0xA3, 0x09, 0x16, 0x4A, 0x34, 0x36, 0x16, 0x97, 0xD2, 0x98, 0x32, 0xF3,
-    0x6D, 0x26, 0x1E, 0x4A, 0x1C, 0xDF, 0xA2, 0x33, 0x69, 0x27, 0x17, 0xF6, 0x64, 0x45, 0xA6, 0x87,
-    0xFB, 0xEA, 0xFA, 0x26, 0xA3, 0x7A, 0xE3, 0xF3, 0x22, 0x72, 0xC4, 0x5D, 0x4A, 0xF6, 0x26, 0x86,
-    0x68, 0x28, 0x27, 0xB1, 0x8D, 0xCE, 0x59, 0xAA, 0x90, 0x88, 0x26, 0xE4, 0x45, 0x86, 0x9A, 0xCB,
-    0xD5, 0x79, 0x82, 0x46, 0x41, 0x56, 0x7C, 0xAC, 0x8A, 0x4F, 0x81, 0x34, 0x1E, 0x01, 0xE6, 0xBF,
-    0xBE, 0x60, 0x77, 0xA4, 0x1B, 0x29, 0xEE, 0x16, 0x0E, 0xAA, 0xA6, 0xBF, 0xE5, 0xFD, 0x6C, 0xB5,
-    0xA0, 0xCC, 0xF8, 0x2B, 0xD1, 0xCF, 0xBC, 0xF5, 0x76, 0x6D, 0xCD, 0x7B, 0x59, 0xBD, 0xD7, 0xA0,
-    0xF7, 0xAA, 0x39, 0x47, 0x56, 0xBB, 0xD1, 0x1A, 0x95, 0x1E, 0x3E, 0x3A, 0xCC, 0x96, 0xE2, 0x53,
-    0x6F, 0x0C, 0xE1, 0xA5, 0x33, 0xCA, 0x51, 0xBF, 0x6E, 0xBC, 0x9D, 0xFC, 0xBD, 0x6D, 0xFD, 0x82,
-    0x08, 0xAF, 0x82, 0xDA, 0xAE, 0x2D, 0x1A, 0xCA, 0x4E, 0x16, 0x70, 0x29, 0x1D, 0xAB, 0x02, 0x51,
-    0xCC, 0x0E, 0x02, 0xA4, 0xE8, 0xA4, 0x29, 0xEA, 0x99, 0x8B, 0x95, 0x13, 0x10, 0x63, 0xF2, 0x4E,
-    0x25, 0xE7, 0x1F, 0xD1, 0xFE, 0xD2, 0x89, 0x8F, 0x2B, 0x59, 0x9D, 0xC8, 0x57, 0x81, 0x83, 0x3A,
-    0x7C, 0xD2, 0xF2, 0x2E, 0x89, 0xDD, 0x7B, 0xF3, 0x81, 0xF8, 0xCF, 0xDB, 0xBB, 0x01, 0x38, 0x29,
-    0x5F, 0x05, 0x1A, 0xE1, 0xD5, 0xC3, 0xE9, 0xB5, 0x6D, 0x01, 0x78, 0xCE, 0x1A, 0xD0, 0xFC, 0xD2,
-    0xB4, 0x26, 0xF7, 0x77, 0xAE, 0xA3, 0xD7, 0x15, 0xAE, 0xAC, 0x23, 0x49, 0x31, 0x50, 0x98, 0x59,
-    0xC0, 0x3D, 0xB5, 0xBA, 0xC0, 0x3D, 0xC6, 0xFE, 0x72, 0x67, 0x07, 0xDF, 0x1A, 0xD0, 0xD1, 0x16,
-    0x92, 0xA8, 0x21, 0xBE, 0x57, 0x20, 0xBC, 0x98, 0xB2, 0xC5, 0xAD, 0x5F, 0xDC, 0x9F, 0x8C, 0xBB,
-    0x73, 0xC7, 0x29, 0x7A, 0xB4, 0x87, 0x57, 0x5E, 0xC3, 0xA8, 0x21, 0x46, 0x51, 0xC6, 0xAF, 0x5B,
-    0x81, 0x88, 0x51, 0x6D, 0xF7, 0xF6, 0x09, 0x91, 0x71, 0xF5, 0xF7, 0xE5, 0xF9, 0xB9, 0x7D, 0x2D,
-    0xE3, 0x92, 0x86, 0x29, 0x84, 0x37, 0xFD, 0x71, 0xE9, 0xBA, 0xE3, 0x39, 0x28, 0xD3, 0x98, 0xDD,
-    0x29, 0xF3, 0xDF, 0x34, 0x7B, 0xA2, 0x98, 0x0B, 0x0E, 0x85, 0x53, 0x0D, 0x98, 0x87, 0xD5, 0x75,
-    0xF0, 0xD8, 0x89, 0xEC, 0x0C, 0x90, 0xA6, 0xA0, 0x0E, 0x9D, 0x57, 0xDB, 0x04, 0xAA, 0x65, 0x8D,
-    0x74, 0x28, 0xFB, 0x03, 0x8A, 0x4C, 0x11, 0xDF, 0xB2, 0xE3, 0x9E, 0x1A, 0x3F, 0xBC, 0x83, 0xE5,
-    0xDE, 0xD9, 0x7E, 0x9C, 0x44, 0x16, 0xCE, 0xF8, 0x01, 0x9D, 0x14, 0x13, 0x64, 0xE2, 0x09, 0x18,
-    0xA2, 0xD8, 0xD4, 0xCF, 0xDF, 0x93, 0xC8, 0xB6, 0xF6, 0xF6, 0x11, 0x60, 0xE8, 0xC8, 0x07, 0x60,
-    0xE9, 0x26, 0x39, 0xDC, 0xC9, 0x8E, 0x8F, 0x9C, 0xC2, 0x78, 0xEF, 0xF9, 0xE2, 0xF8, 0xC8, 0x29,
-    0x8C, 0x6C, 0x6D, 0xE4, 0x15, 0x6E, 0xF7, 0xDA, 0xCE, 0x95, 0xE5, 0xC8, 0x11, 0x16, 0xDA, 0x8B,
-    0x18, 0x39, 0x4E, 0xF5, 0xB9, 0x9A, 0x20, 0x19, 0x68, 0x00, 0x3B, 0x1E, 0xD3, 0x0B, 0x0F, 0xB3,
-    0xA7, 0x25, 0x30, 0x3A, 0x0B, 0x77, 0x08, 0x3C, 0xA0, 0xB6, 0x2A, 0x4B, 0xC5, 0x7F, 0x8A, 0xCB,
-    0x1C, 0xA3, 0xC3, 0x3D, 0x7B, 0x5B, 0x7E, 0x7E, 0x4F, 0x9E, 0xF4, 0x23, 0xBB, 0x07, 0x57, 0x08,
-    0xC4, 0x3C, 0xA2, 0x51, 0x31, 0xE8, 0x73, 0x18, 0xDA, 0xC6, 0x1A, 0xC6, 0x4D, 0x02, 0x08, 0xEE,
-    0x3A, 0xB1, 0x6D, 0x3B, 0xDC, 0x67, 0x5D, 0x40, 0x00, 0xAC, 0x1F, 0x7F, 0xEA, 0x80, 0x40, 0x29,
-    0x52, 0xDA, 0x72, 0xD0, 0x4F, 0x10, 0x74, 0x9E, 0x45, 0x9D, 0x04, 0x2A, 0xD1, 0x01, 0xE2, 0x1D,
-    0x38, 0x72, 0x22, 0x80, 0x68, 0xD9, 0xE1, 0xB3, 0x9B, 0x67, 0xE7, 0xDC, 0x5E, 0x29, 0x73, 0xE2,
-    0x84, 0xD9, 0x02, 0x1D, 0x14, 0xE5, 0xAF, 0x76, 0x4E, 0x08, 0x93, 0xF2, 0xDD, 0xF9, 0xD6, 0x09,
-    0x61, 0x42, 0xBE, 0xE3, 0xBA, 0x30, 0xD1, 0xA5, 0x69, 0x67, 0x67, 0x7B, 0x29, 0x4C, 0x7C, 0x6B,
-    0xA4, 0x30, 0x71, 0xEA, 0x23, 0xFA, 0x9D, 0x73, 0x85, 0x79, 0x51, 0xD6, 0xA0, 0x08, 0xEB, 0x23,
-    0xC2, 0xCF, 0x4C, 0x2E, 0xEA, 0x7E, 0x0C, 0x59, 0x6F, 0x15, 0x8F, 0x62, 0xBF, 0xBE, 0x64, 0xA1,
-    0xAB, 0x3C, 0x93, 0x46, 0x83, 0xD6, 0x8C, 0x31, 0x20, 0xE3, 0xC2, 0xFC, 0x33, 0x04, 0xB2, 0x71,
-    0x0B, 0x30, 0xB3, 0x80, 0x53, 0x31, 0xE6, 0x0A, 0xFF, 0x3F, 0xEA, 0xE3, 0xDC, 0xCD, 0x1F, 0x65,
-    0xF4, 0xC2, 0x03, 0x8F, 0xCE, 0xFB, 0x8E, 0x1A, 0xC5, 0x8B, 0x8F, 0x17, 0x14, 0xF3, 0x17, 0x0E,
-    0xB5, 0xF9, 0x1A, 0x76, 0xD2, 0x04, 0xCC, 0x68, 0x35, 0xED, 0xF5, 0x4D, 0xE1, 0xDE, 0x9C, 0xDB,
-    0xC6, 0xD2, 0x93, 0x85, 0x71, 0x3D, 0xA5, 0x07, 0xBB, 0x48, 0x27, 0xD8, 0x0B, 0x54, 0xDB, 0xC2,
-    0xA2, 0x45, 0x44, 0x25, 0xE1, 0x78, 0xC6, 0x78, 0xD9, 0x6E, 0x6F, 0xB9, 0x68, 0x78, 0x50, 0xFF,
-    0x5B, 0x79, 0xFA, 0xC6, 0xC1, 0x80, 0x90, 0x3D, 0x50, 0x20, 0xEA, 0xF4, 0xA9, 0x9E, 0x43, 0x85,
-    0x1E, 0xE2, 0x6D, 0x04, 0x77, 0x88, 0xB7, 0x9C, 0xFC, 0x49, 0x06, 0xBE, 0xE8, 0x37, 0x8C, 0xD0,
-    0x9F, 0x2E, 0x0B, 0x92, 0x9E, 0x6C, 0x21, 0xF7, 0xE8, 0xA3, 0xC9, 0xDA, 0xE7, 0x06, 0x5F, 0x7C,
-    0x91, 0xE0, 0xBD, 0x4B, 0x02, 0x30, 0xBA, 0xEF, 0x4A, 0xEF, 0x2F, 0x37, 0x62, 0x38, 0x6E, 0x4A,
-    0x63, 0x21, 0x67, 0xDA, 0xBC, 0x88, 0xA9, 0x18, 0x54, 0x39, 0x12, 0x58, 0x0B, 0x0D, 0x8A, 0x65,
-    0xFC, 0xE7, 0xFF, 0x71, 0x72, 0x13, 0x21, 0x2A, 0x02, 0x84, 0x21, 0x17, 0x04, 0x4E, 0xB7, 0xC6,
-    0x59, 0xEB, 0x5E, 0x90, 0x19, 0x7A, 0xE2, 0xBF, 0x61, 0x2E, 0x80, 0xA7, 0xB9, 0x7F, 0xB5, 0x55,
-    0x2E, 0x8C, 0x88, 0x97, 0x8B, 0x32, 0xB7, 0x24, 0x1F, 0xF2, 0xDE, 0xFC, 0xBF, 0x9B, 0x26, 0xEF,
-    0xCD, 0xEC, 0x42, 0x56, 0x16, 0x49, 0x1D, 0x2B, 0x38, 0x11, 0x40, 0x83, 0xB8, 0xBA, 0xDC, 0x04,
-    0x93, 0xCB, 0xBF, 0x99, 0x30, 0x35, 0xDF, 0x83, 0xB5, 0xB4, 0x9F, 0xD9, 0xAE, 0x34, 0xE5, 0x88,
-    0x99, 0xB9, 0x2A, 0xF7, 0x78, 0x5F, 0x26, 0xE5, 0x73, 0xE9, 0xDD, 0x88, 0x89, 0x89, 0xE5, 0xC4,
-    0x1D, 0x11, 0xF4, 0x1A, 0x9F, 0x03, 0x38, 0xDD, 0x32, 0x44, 0xD1, 0x69, 0x01, 0xB8, 0x4C, 0xEB,
-    0x3F, 0x95, 0x15, 0x8F, 0x59, 0xC1, 0x07, 0x3E, 0xF9, 0x37, 0x79, 0x3E, 0xE3, 0xE2, 0x55, 0x8D,
-    0x0E, 0x63, 0x4A, 0xC8, 0xE1, 0xA9, 0xB4, 0x5B, 0x97, 0x8D, 0x71, 0xBC, 0xC6, 0xA3, 0x3E, 0xBC,
-    0x1B, 0x9F, 0x5E, 0x31, 0x14, 0x46, 0xC5, 0xE3, 0xA0, 0x30, 0xB2, 0x26, 0x38, 0x1C, 0x45, 0xBA,
-    0x07, 0x66, 0xEB, 0x9A, 0x63, 0x97, 0x12, 0x47, 0x38, 0xD5, 0x2B, 0x2A, 0x6E, 0xED, 0xC6, 0xF2,
-    0xC6, 0xFB, 0x11, 0x55, 0x23, 0xB6, 0x87, 0xF8, 0x04, 0xA8, 0x69, 0xC0, 0x0C, 0xBD, 0x22, 0x57,
-    0xDF, 0x95, 0x19, 0x22, 0x0B, 0xF6, 0x36, 0x34, 0xC8, 0x56, 0xB1, 0xBD, 0x6F, 0x76, 0x1D, 0xC7,
-    0x56, 0x1D, 0xC5, 0xB3, 0x15, 0x27, 0x0A, 0xB1, 0x8B, 0xA5, 0x99, 0xD8, 0xB5, 0xAF, 0xD3, 0x64,
-    0x18, 0x8D, 0x7A, 0x10, 0x11, 0x45, 0x93, 0x53, 0x0E, 0x68, 0xCB, 0xD9, 0x2B, 0x8F, 0xC1, 0xDC,
-    0x9C, 0xD9, 0xC9, 0x56, 0x34, 0x5C, 0xA4, 0x73, 0xA3, 0xAA, 0xAC, 0xF1, 0xA3, 0x61, 0x7C, 0x6F,
-    0x92, 0xA3, 0x7A, 0xAD, 0x6B, 0x48, 0xA3, 0x4E, 0xB3, 0x77, 0xDD, 0xFC, 0xCE, 0x8F, 0x27, 0xC9,
-    0xFC, 0x79, 0x10, 0x4D, 0x3E, 0x2A, 0x49, 0x18, 0x90, 0x40, 0x95, 0xCF, 0xCB, 0xD6, 0x45, 0xC2,
-    0x93, 0x4A, 0xED, 0x28, 0x8D, 0x60, 0xC2, 0x83, 0xA4, 0x89, 0xED, 0x67, 0x7D, 0x0C, 0xCC, 0x20,
-    0xA6, 0xEF, 0x72, 0x1B, 0xDA, 0x77, 0x25, 0xC6, 0xBE, 0x2F, 0x8A, 0x32, 0xC2, 0xF2, 0xED, 0x8A,
-    0x8A, 0x7D, 0x20, 0x93, 0x79, 0x0F, 0xA1, 0x15, 0x0C, 0x1F, 0x3A, 0xF4, 0xB6, 0x03, 0x1C, 0x0C,
-    0x23, 0xD1, 0xB7, 0xCA, 0xFB, 0x67, 0x04, 0x89, 0x20, 0x1C, 0x83, 0x31, 0x10, 0xEC, 0x62, 0x44,
-    0x21, 0x60, 0x4F, 0x89, 0x51, 0x81, 0x80, 0x24, 0xB0, 0x5A, 0xFA, 0x45, 0x6F, 0x58, 0x06, 0x4D,
-    0x9C, 0x46, 0x25, 0x98, 0xED, 0x3E, 0xE3, 0x70, 0x39, 0x1D, 0xB5, 0xF4, 0x53, 0xA7, 0x3D, 0xC8,
-    0xAA, 0xBD, 0x4D, 0x01, 0xB9, 0x66, 0x81, 0x66, 0xEF, 0x9A, 0xF1, 0x20, 0x62, 0xF5, 0xC4, 0x89,
-    0xAE, 0x37, 0xC7, 0x14, 0x6B, 0xEE, 0x5D, 0x4C, 0xDE, 0xDC, 0x7C, 0x6F, 0x67, 0x77, 0xC4, 0xFA,
-    0x93, 0x26, 0xF0, 0x12, 0x9B, 0x1F, 0x9F, 0x68, 0x0E, 0x32, 0xA9, 0x1F, 0xCB, 0xCF, 0x52, 0x9B,
-    0x22, 0x62, 0xFB, 0x2D, 0x17, 0x6D, 0x3E, 0x92, 0xDC, 0xD4, 0xD0, 0x9E, 0x9A, 0xC5, 0x80, 0x9F,
-    0xB1, 0xBF, 0xD2, 0x00, 0xE5, 0xF7, 0xAC, 0x51, 0x72, 0x40, 0x79, 0x82, 0xA3, 0x0F, 0x25, 0x96,
-    0xF9, 0xB3, 0xA3, 0xCD, 0x15, 0x11, 0xCA, 0x26, 0x97, 0xA2, 0x89, 0x7F, 0x23, 0xEA, 0xE5, 0xCD,
-    0x24, 0xC7, 0x28, 0x57, 0x9F, 0x40, 0x3F, 0xC8, 0x8A, 0x86, 0x97, 0x43, 0x98, 0x28, 0x00, 0x42,
-    0x20, 0x08, 0xF0, 0x1D, 0x9A, 0x10, 0xFC, 0x82, 0xCD, 0x5C, 0xF0, 0x0D, 0x30, 0x90, 0x34, 0x19,
-    0xE4, 0x0A, 0x6A, 0xCC, 0xB5, 0x99, 0x49, 0xAC, 0x5B, 0x76, 0xBE, 0xAD, 0x24, 0x24, 0x97, 0x8F,
-    0x7D, 0xCA, 0x12, 0x21, 0xB7, 0xFC, 0x80, 0x72, 0xAC, 0x48, 0x39, 0xC9, 0x07, 0x90, 0x2C, 0xD6,
-    0xD4, 0x82, 0x20, 0x6B, 0x26, 0x11, 0x08, 0x7B, 0xAD, 0xFD, 0x19, 0x8F, 0x2D, 0xA5, 0x59, 0x63,
-    0xFD, 0xE5, 0x02, 0x90, 0x21, 0x54, 0xC7, 0xE8, 0x53, 0x8A, 0x0D, 0xB5, 0xB7, 0xE7, 0x5A, 0x99,
-    0xF4, 0x83, 0x62, 0xFE, 0x00, 0x3E, 0x3A, 0xA0, 0x68, 0xB1, 0x88, 0x23, 0x5B, 0xA5, 0x14, 0x6B,
-    0x2C, 0xFD, 0xC1, 0x5A, 0x3B, 0x2E, 0xA6, 0x33, 0xD0, 0x11, 0x86, 0x67, 0x01, 0x4D, 0xD6, 0x9F,
-    0xED, 0xFF, 0xA1, 0xC4, 0x54, 0x74, 0xF6, 0xF6, 0x6F, 0xED, 0xCF, 0x3F, 0xDC, 0x9D, 0xDE, 0x4A,
-    0x3F, 0xEF, 0x92, 0xD3, 0xD0, 0x5D, 0xE4, 0xAE, 0x10, 0x58, 0xD7, 0x2C, 0x2B, 0x9F, 0xD7, 0x4D,
-    0xD6, 0x9B, 0xB5, 0x48, 0x5B, 0xC4, 0x2E, 0x62, 0x06, 0x14, 0x28, 0xC4, 0xC4, 0x8A, 0xFC, 0xE0,
-    0x07, 0x65, 0x99, 0x9B, 0xF0, 0xDA, 0x4F, 0x92, 0xEE, 0xAD, 0x74, 0x78, 0xEB, 0xA5, 0x7C, 0x78,
-    0x29, 0xE9, 0x9F, 0x3D, 0xC6, 0x5A, 0xED, 0x50, 0x3D, 0x36, 0xFF, 0xF7, 0x56, 0xFF, 0x33, 0x1F,
-    0x14, 0x01, 0xE2, 0x9B, 0xD7, 0x81, 0x79, 0x21, 0x13, 0x44, 0xD6, 0x17, 0xF6, 0x1E, 0x12, 0xEF,
-    0x44, 0xC3, 0xE9, 0xCF, 0xF0, 0x61, 0xCF, 0xF1, 0xC8, 0x73, 0x52, 0xD7, 0xB1, 0x7C, 0xDA, 0xF5,
-    0x27, 0x1E, 0xDF, 0xDA, 0x27, 0x6A, 0x42, 0x30, 0x04, 0x58, 0x3D, 0x6D, 0x20, 0x19, 0xCF, 0x66,
-    0xBA, 0x18, 0x48, 0xAC, 0x58, 0xC7, 0xAD, 0x6C, 0x3C, 0xA1, 0xCE, 0xAB, 0x72, 0x94, 0x31, 0xF3,
-    0x8B, 0xA0, 0x92, 0x1A, 0x19, 0x01, 0xCC, 0x51, 0x25, 0x7E, 0x65, 0x60, 0x7A, 0x2A, 0x69, 0x43,
-    0x71, 0x2D, 0x47, 0x1A, 0x75, 0xD2, 0x85, 0xA3, 0x7C, 0xDB, 0x36, 0xA9, 0xC0, 0x3F, 0x66, 0x5B,
-    0x90, 0x85, 0x5A, 0x74, 0x41, 0x27, 0x96, 0xAA, 0x14, 0xF9, 0x49, 0x78, 0xEB, 0x6D, 0x9F, 0xD9,
-    0x8E, 0xDB, 0xA4, 0x4B, 0xFA, 0x54, 0xAC, 0x75, 0xBE, 0xA4, 0xAE, 0xA3, 0xF6, 0xE4, 0xBF, 0x58,
-    0xFF, 0xC9, 0x77, 0x93, 0x3E, 0xEC, 0x93, 0x36, 0xAD, 0xCA, 0x4C, 0xBA, 0x30, 0x96, 0x53, 0x32,
-    0xF9, 0xE3, 0x99, 0x6D, 0x39, 0xD3, 0xA6, 0x5D, 0xDA, 0xE5, 0x7D, 0xB9, 0x06, 0xF1, 0xD2, 0x76,
-    0xF5, 0x2F, 0x39, 0xFE, 0xAF, 0xE3, 0x3F, 0xDC, 0x9D, 0x3D, 0xD0, 0x7F, 0x67, 0x2F, 0x0E, 0xE9,
-    0xED, 0x23, 0xFF, 0xEF, 0x0C, 0xB9, 0xFC, 0xFF, 0x60, 0x2A, 0x1B, 0x20, 0xAA, 0xF4, 0x73, 0x88,
-    0xC0, 0xFE, 0x8C, 0xE1, 0x2E, 0x32, 0x72, 0x62, 0xC1, 0xC1, 0x69, 0xDE, 0x93, 0x65, 0xE5, 0xDB,
-    0x3B, 0x9C, 0x2D, 0xC4, 0xAC, 0x72, 0xD5, 0x1A, 0xDE, 0x93, 0xCE, 0xE1, 0x22, 0x26, 0x6D, 0x44,
-    0xFC, 0x25, 0xDD, 0x68, 0x60, 0x0F, 0xE4, 0x22, 0x02, 0x7C, 0xC1, 0x77, 0x0D, 0xE4, 0xC9, 0x5A,
-    0x52, 0x8C, 0xB7, 0x98, 0x87, 0x03, 0x7F, 0x96, 0xF4, 0x38, 0x5D, 0xD6, 0x25, 0x28, 0xEA, 0xE7,
-    0xE4, 0x74, 0x34, 0xC2, 0xE1, 0xCA, 0x18, 0x46, 0xFE, 0xBC, 0xD3, 0xD8, 0x88, 0x24, 0x1B, 0xDD,
-    0x91, 0x7F, 0x97, 0xC9, 0x2D, 0x92, 0x3D, 0xA9, 0x25, 0x54, 0x71, 0xD8, 0x88, 0xBE, 0x4B, 0xF3,
-    0xC1, 0xF8, 0xC9, 0xB7, 0x98, 0x8A, 0xA3, 0xEF, 0xDF, 0x36, 0xC9, 0xD7, 0xB1, 0x80, 0xC1, 0x86,
-    0x89, 0xA5, 0x5F, 0xC0, 0xBA, 0x97, 0xB7, 0x61, 0x6C, 0xF3, 0xE1, 0x34, 0x76, 0xB5, 0xC0, 0x12,
-    0x17, 0xDD, 0x58, 0x35, 0x32, 0x98, 0x02, 0xD7, 0x08, 0xD1, 0x28, 0x45, 0x87, 0xC2, 0x16, 0x0D,
-    0x0F, 0x8D, 0x58, 0x1B, 0x32, 0x7D, 0xE2, 0xFF, 0x44, 0x1D, 0xA2, 0x26, 0xE9, 0xBD, 0x19, 0xCC,
-    0xFF, 0x0B, 0x55, 0x19, 0x52, 0x1A, 0x34, 0xC9, 0xE6, 0xD9, 0x79, 0x79, 0x86, 0xF5, 0x0C, 0x18,
-    0xE9, 0xEC, 0x2D, 0x71, 0x13, 0xC6, 0xD7, 0xC9, 0x0F, 0xD3, 0x4A, 0x0C, 0xCD, 0xD9, 0x53, 0x03,
-    0x2E, 0x62, 0x5E, 0x5E, 0x45, 0xD3, 0x3C, 0xAB, 0x43, 0xE5, 0x08, 0x95, 0xD5, 0xC1, 0xD7, 0x64,
-    0x6E, 0xE1, 0xA0, 0x44, 0xA0, 0x5E, 0x33, 0x73, 0x51, 0xE7, 0xEA, 0xB0, 0x58, 0x1E, 0xB0, 0x0E,
-    0xDD, 0x81, 0x5C, 0xBA, 0x3B, 0xC4, 0xD7, 0x72, 0x42, 0xC0, 0x01, 0xE1, 0x48, 0xAF, 0xD1, 0x70,
-    0xEA, 0xB0, 0x68, 0x61, 0x9E, 0x59, 0xE9, 0x23, 0xE8, 0x7F, 0x09, 0x9B, 0x08, 0x21, 0x10, 0x4A,
-    0x7A, 0xB6, 0xAC, 0x3D, 0xBB, 0x18, 0x45, 0x22, 0x49, 0xBD, 0x39, 0x82, 0xF4, 0xF6, 0x28, 0x7C,
-    0x4D, 0x06, 0x8A, 0xE5, 0x35, 0x3E, 0xF3, 0x3F, 0x08, 0x74, 0x6A, 0x4D, 0xF7, 0x31, 0xFB, 0x07,
-    0x52, 0x20, 0xA9, 0xF4, 0xC4, 0xFA, 0x6A, 0x6E, 0x94, 0xAC, 0xC0, 0xAD, 0x9F, 0x86, 0x6B, 0xA2,
-    0xC1, 0x6F, 0x55, 0xEE, 0x80, 0x36, 0x5B, 0x3F, 0xE0, 0x6D, 0x68, 0xC9, 0x52, 0x1D, 0x77, 0x33,
-    0x83, 0x2E, 0x45, 0x36, 0x9C, 0x85, 0xC5, 0xB1, 0x3C, 0x83, 0xE6, 0x7E, 0x2E, 0x6C, 0xAE, 0x31,
-    0x10, 0x63, 0x80, 0x60, 0x1E, 0x3F, 0xA1, 0xE2, 0x8A, 0xC6, 0x8B, 0x40, 0xD2, 0x06, 0x8E, 0x7E,
-    0x42, 0xFA, 0x28, 0x07, 0x0E, 0x58, 0x8C, 0x60, 0x2F, 0xCA, 0x0F, 0x35, 0xD5, 0x0C, 0x4F, 0x0F,
-    0xED, 0x8D, 0xA8, 0xAC, 0x04, 0x63, 0x64, 0x30, 0x34, 0x65, 0x17, 0x43, 0x9B, 0x3D, 0xAA, 0x77,
-    0xEC, 0xC8, 0x6D, 0xB9, 0x62, 0x72, 0x48, 0x3A, 0xE9, 0xAF, 0x41, 0x45, 0x88, 0xF1, 0x13, 0xDB,
-    0x5F, 0xC8, 0x85, 0x52, 0x00, 0xDE, 0x8B, 0xC8, 0x70, 0x8F, 0xF4, 0x76, 0x76, 0xC6, 0x01, 0x6B,
-    0x0D, 0x28, 0x99, 0x37, 0x67, 0x5A, 0xFD, 0xE9, 0xCC, 0x15, 0x93, 0xBC, 0x23, 0xC6, 0x7E, 0xCC,
-    0x1B, 0x93, 0x7C, 0x46, 0x46, 0x19, 0x32, 0x41, 0xC2, 0x18, 0x48, 0x8A, 0xAB, 0x99, 0x4E, 0xB3,
-    0xC7, 0x47, 0xA2, 0x8B, 0x02, 0xC9, 0x16, 0x63, 0x2E, 0x80, 0xED, 0x1D, 0x41, 0x6E, 0x53, 0x64,
-    0xDB, 0xB2, 0xD1, 0x3C, 0xF6, 0xA9, 0x35, 0x01, 0x83, 0x43, 0x67, 0x10, 0x62, 0x64, 0x9D, 0xAE,
-    0x62, 0x49, 0x53, 0xCC, 0x00, 0xD6, 0x84, 0xD5, 0x80, 0x97, 0xDE, 0xF6, 0x8E, 0x89, 0x5F, 0xE9,
-    0xCD, 0x4F, 0x93, 0xCA, 0xBF, 0x2F, 0x11, 0xCD, 0xCF, 0x45, 0x88, 0x39, 0x91, 0x7A, 0x40, 0xCC,
-    0xC5, 0x3C, 0x0A, 0x92, 0xD2, 0xC0, 0x48, 0x89, 0x88, 0x70, 0x4A, 0xBB, 0xA0, 0xCF, 0xFB, 0xA8,
-    0x71, 0x31, 0x2E, 0xE2, 0x76, 0xA2, 0x42, 0x10, 0x28, 0x8B, 0x59, 0x02, 0xF1, 0x9A, 0x07, 0xC4,
-    0x5D, 0x49, 0x7E, 0xAD, 0x1A, 0x8E, 0x28, 0x42, 0x66, 0xDD, 0xC4, 0x27, 0x1A, 0x40, 0x33, 0xFE,
-    0xAA, 0x91, 0x69, 0x24, 0x17, 0xAC, 0x37, 0x0E, 0xF7, 0x4A, 0x20, 0x40, 0x62, 0xC1, 0x65, 0xE3,
-    0x7D, 0xAB, 0x61, 0x51, 0x92, 0x45, 0x55, 0xD8, 0x06, 0x9D, 0x3F, 0x1C, 0xCF, 0x51, 0x2F, 0x50,
-    0x6B, 0x91, 0x4B, 0x1C, 0x1B, 0x76, 0x3E, 0xA9, 0xA0, 0x2A, 0x6A, 0x03, 0x7C, 0x6B, 0xD9, 0xC8,
-    0xAB, 0xB8, 0x95, 0x6F, 0xB9, 0x86, 0xFD, 0x8D, 0x98, 0x7F, 0xBB, 0x8F, 0x88, 0x07, 0xEB, 0x00,
-    0x43, 0x58, 0xE8, 0xA1, 0x70, 0xCA, 0x1A, 0xD9, 0x59, 0x57, 0x19, 0xC0, 0x30, 0xF6, 0x4B, 0x87,
-    0x8D, 0x15, 0x1B, 0xD5, 0x29, 0x87, 0xC2, 0x1D, 0xBC, 0x4D, 0x07, 0xFF, 0xF8, 0x21, 0x5B, 0xB7,
-    0x25, 0xAB, 0xC3, 0xDE, 0x8D, 0x91, 0xD4, 0xD7, 0xB1, 0x03, 0xF0, 0x3E, 0xAA, 0x31, 0xC4, 0xA8,
-    0xC5, 0x4C, 0xEE, 0x8C, 0x62, 0x4A, 0x81, 0xE4, 0x2D, 0x96, 0xB1, 0x28, 0xAA, 0xAC, 0xE1, 0x55,
-    0x13, 0x5F, 0x1C, 0xA0, 0xB5, 0xF9, 0xDC, 0x04, 0xF5, 0xFB, 0x9C, 0x9D, 0x42, 0x7B, 0x62, 0x60,
-    0xBE, 0xED, 0x42, 0x44, 0x0B, 0xA2, 0x58, 0x3E, 0x01, 0x65, 0xEA, 0x5E, 0xC5, 0x5E, 0x1D, 0x9B,
-    0xF5, 0xCA, 0xD1, 0x83, 0x62, 0xA2, 0x5B, 0x99, 0x6C, 0xF1, 0xCE, 0x45, 0xDC, 0xC4, 0x62, 0xAB,
-    0xA5, 0x21, 0xD1, 0x4C, 0xEF, 0x4F, 0x32, 0xBA, 0xB4, 0x4E, 0xFA, 0x60, 0xD4, 0xE9, 0x3F, 0x39,
-    0xEB, 0x6C, 0xEC, 0xED, 0xAF, 0xCF, 0xFA, 0xBB, 0x33, 0xED, 0x56, 0xD3, 0x38, 0xC1, 0x2E, 0xA5,
-    0xEE, 0xE5, 0x96, 0x5D, 0x0C, 0x71, 0x93, 0xDF, 0x9A, 0xC2, 0x41, 0xEC, 0x18, 0x6C, 0x5A, 0xA2,
-    0x29, 0xD7, 0x74, 0xFD, 0x7B, 0x6B, 0x2F, 0x02, 0x46, 0x16, 0x27, 0x5F, 0xC4, 0xD5, 0x30, 0x37,
-    0x53, 0x40, 0x08, 0xC7, 0x47, 0x76, 0x66, 0x3B, 0xEA, 0x51, 0xEC, 0x52, 0x24, 0x9D, 0x8C, 0x43,
-    0x42, 0xEB, 0x22, 0xED, 0x63, 0x81, 0xC9, 0xB7, 0x24, 0x98, 0x1A, 0xE2, 0x75, 0x7D, 0x7E, 0xD0,
-    0xC8, 0x6E, 0x6C, 0x1A, 0x99, 0x4C, 0x06, 0x2C, 0x88, 0x4C, 0x9E, 0x1B, 0x04, 0xF0, 0x48, 0x5A,
-    0xDB, 0x57, 0xE4, 0xEA, 0x32, 0xCA, 0xDB, 0x43, 0x22, 0x38, 0x42, 0x5E, 0xD2, 0x61, 0x35, 0x96,
-    0xC5, 0xA9, 0x63, 0x41, 0x22, 0x19, 0xA9, 0x5E, 0x71, 0xC3, 0x27, 0xC8, 0x10, 0xEF, 0x27, 0xE6,
-    0x08, 0x8D, 0x32, 0xA7, 0x17, 0x5D, 0x62, 0x79, 0x59, 0x6F, 0xA4, 0x39, 0x84, 0x65, 0x35, 0x8B,
-    0x9B, 0xD5, 0x99, 0xB6, 0x45, 0xDA, 0xB3, 0xD6, 0x57, 0xBD, 0x7E, 0x34, 0xEA, 0x1A, 0x8C, 0x5C,
-    0x8E, 0x28, 0x72, 0x4A, 0x14, 0x29, 0x5B, 0x26, 0xCA, 0xD5, 0xBA, 0xD7, 0xDA, 0xBD, 0x16, 0xEE,
-    0xD5, 0x75, 0xC6, 0xDD, 0x2D, 0x71, 0x77, 0x4B, 0xDC, 0xDD, 0x52, 0xF7, 0xEA, 0x2E, 0xE3, 0xB9,
-    0xD7, 0xC0, 0xBD, 0x86, 0xCB, 0xCB, 0xEB, 0x6B, 0x6A, 0xC5, 0x64, 0xD4, 0x4A, 0x06, 0x10, 0x10,
-    0xE8, 0xAB, 0x6F, 0x4B, 0xBE, 0x2E, 0xAC, 0x6A, 0x50, 0xE4, 0x34, 0x69, 0xBE, 0x5B, 0xEA, 0x44,
-    0xE1, 0x60, 0x83, 0xE7, 0x64, 0x16, 0x38, 0x51, 0x84, 0x76, 0x05, 0xC1, 0x8D, 0xB3, 0x83, 0x78,
-    0x7C, 0xFB, 0xA4, 0x87, 0x55, 0x2C, 0x85, 0xCB, 0xD0, 0x17, 0x68, 0x35, 0x08, 0xDD, 0xAC, 0x36,
-    0x83, 0x71, 0xCE, 0x43, 0x1E, 0x49, 0x49, 0xCE, 0xCD, 0x0F, 0xA8, 0x1F, 0xD3, 0xEC, 0x3C, 0x63,
-    0x75, 0x54, 0x40, 0xCD, 0x90, 0x66, 0xAC, 0xFC, 0xC6, 0xAB, 0x12, 0xD4, 0xED, 0x16, 0xC0, 0xD2,
-    0x6E, 0x6A, 0x58, 0x5B, 0xA4, 0x82, 0x28, 0x21, 0x55, 0xB7, 0x7E, 0x79, 0x20, 0x49, 0x1F, 0xF4,
-    0xAB, 0xCA, 0x95, 0x76, 0xD9, 0xB3, 0x4D, 0x8F, 0xB4, 0x7E, 0xF1, 0xBA, 0x74, 0x13, 0xB6, 0x2F,
-    0xAF, 0xCB, 0x41, 0xBC, 0x6A, 0x88, 0xB4, 0x9B, 0xD8, 0x06, 0x09, 0x27, 0x30, 0x9D, 0x65, 0x25,
-    0x1D, 0x41, 0x13, 0x25, 0x5C, 0x02, 0x51, 0x22, 0x64, 0x53, 0x32, 0x69, 0x7E, 0x36, 0x44, 0x43,
-    0x3C, 0xCA, 0xC7, 0xB7, 0xEC, 0xC7, 0x93, 0x34, 0xA7, 0xB4, 0xB5, 0x2F, 0xDB, 0x8F, 0xEC, 0x0F,
-    0xFB, 0x04, 0xF4, 0xC5, 0xCB, 0xB6, 0x29, 0xAD, 0x34, 0x03, 0x72, 0x29, 0x09, 0x12, 0x8A, 0x1E,
-    0xFC, 0x6A, 0x1B, 0xA1, 0x29, 0xC3, 0xB8, 0x08, 0x87, 0xDB, 0xA6, 0xD6, 0xF1, 0x6C, 0x18, 0x20,
-    0x00, 0x47, 0xE7, 0xBC, 0x0F, 0x7A, 0x9D, 0x67, 0x4E, 0x62, 0xA7, 0x3C, 0xE2, 0x7F, 0x43, 0x89,
-    0x8F, 0x1D, 0xBC, 0x39, 0x61, 0x99, 0xF4, 0x2C, 0xF8, 0x4A, 0x6F, 0x4F, 0x32, 0x6E, 0xC1, 0x0F,
-    0x23, 0x4C, 0xE1, 0x37, 0x7B, 0xD6, 0xC7, 0x45, 0xBD, 0x2D, 0x02, 0xE9, 0xA0, 0x67, 0x7F, 0x28,
-    0x51, 0xE5, 0x27, 0x72, 0xCF, 0x51, 0x06, 0x65, 0xCB, 0xD6, 0x77, 0xD4, 0xD0, 0x63, 0x24, 0x05,
-    0xB3, 0xF7, 0xC6, 0xAA, 0xF6, 0xA2, 0x5B, 0xAF, 0xC8, 0xE0, 0xBA, 0xD1, 0x3E, 0xD3, 0x1F, 0x2D,
-    0x56, 0xDF, 0x3A, 0x33, 0xD7, 0xD2, 0x2C, 0xEE, 0x95, 0xD7, 0x3D, 0xC7, 0x05, 0x81, 0x15, 0x1F,
-    0x05, 0x79, 0x96, 0x6F, 0x03, 0x4C, 0x8B, 0x0C, 0x06, 0x0A, 0xA5, 0x53, 0xA1, 0x74, 0x14, 0x4A,
-    0x63, 0xEC, 0xF7, 0x55, 0x28, 0xF1, 0x01, 0x84, 0x92, 0x8B, 0x50, 0x04, 0xC1, 0x94, 0xBA, 0x48,
-    0x94, 0xC2, 0xCA, 0xE8, 0x21, 0x59, 0xCA, 0x96, 0x77, 0xBA, 0x6C, 0xD1, 0x2B, 0xDC, 0xDE, 0xE7,
-    0xC2, 0x6B, 0xD7, 0xFC, 0xC7, 0x88, 0x59, 0x0B, 0x7B, 0x98, 0x9C, 0x84, 0xEA, 0x59, 0xDA, 0x65,
-    0xBF, 0x95, 0x4C, 0x78, 0xF6, 0xA1, 0x64, 0x5F, 0x30, 0x6E, 0xED, 0x61, 0x62, 0x04, 0x95, 0x60,
-    0x36, 0x2A, 0x4C, 0xCC, 0x28, 0x6B, 0x00, 0xB0, 0x05, 0xB3, 0x91, 0x61, 0x36, 0x06, 0x36, 0x6B,
-    0xCE, 0x06, 0x27, 0xA6, 0x93, 0xE6, 0x64, 0x31, 0x1B, 0x1F, 0x0C, 0x9C, 0x8D, 0x06, 0x13, 0x63,
-    0x23, 0x99, 0x02, 0x19, 0xDD, 0xCB, 0x20, 0x47, 0xA5, 0x29, 0x78, 0x51, 0x9A, 0x29, 0x18, 0x5A,
-    0x9F, 0xB3, 0x11, 0x73, 0x36, 0xD8, 0x5C, 0xB0, 0x99, 0x5A, 0x99, 0x15, 0xDF, 0xB6, 0x5B, 0xD7,
-    0xCD, 0x39, 0x41, 0x16, 0xD2, 0xE9, 0xF2, 0x0E, 0xC8, 0x0C, 0x54, 0x01, 0x59, 0xC7, 0xCA, 0x52,
-    0x45, 0x1F, 0x9C, 0x61, 0x12, 0x25, 0x2D, 0x3C, 0x97, 0x8F, 0x00, 0x87, 0x6A, 0x6B, 0x68, 0xA9,
-    0x8F, 0xC9, 0x80, 0xDC, 0xC5, 0x3C, 0x44, 0x1D, 0x66, 0xE4, 0x22, 0x66, 0x03, 0x67, 0x5E, 0x81,
-    0xAE, 0x42, 0x4F, 0x5F, 0x95, 0xDF, 0xF4, 0x98, 0x8A, 0x3B, 0xA2, 0x1A, 0x83, 0x53, 0xD4, 0xA7,
-    0xAE, 0x1F, 0x23, 0x04, 0xC6, 0x55, 0x60, 0x7F, 0x66, 0x53, 0xCA, 0xF9, 0x4B, 0xD5, 0x87, 0xFF,
-    0xF9, 0x42, 0xF9, 0xF0, 0x77, 0x5E, 0x28, 0xE6, 0x01, 0x0B, 0x45, 0xAB, 0x2A, 0x13, 0xC5, 0xFA,
-    0x2D, 0x54, 0x54, 0x43, 0x3D, 0x11, 0xD2, 0xB9, 0xC3, 0x6B, 0xBF, 0x97, 0xC1, 0xCF, 0x4A, 0x8F,
-    0xC8, 0x21, 0x65, 0x19, 0x6D, 0x23, 0xB1, 0xCF, 0x52, 0xE7, 0xF7, 0x2D, 0x23, 0xB4, 0xB9, 0x8E,
-    0x1A, 0xF5, 0x5E, 0xF6, 0xF0, 0xCD, 0x87, 0x93, 0xDA, 0x9A, 0x34, 0x8C, 0x15, 0xE9, 0x30, 0xF5,
-    0x94, 0x30, 0x55, 0x9C, 0xD8, 0x2C, 0x9F, 0xB0, 0xE0, 0x65, 0x81, 0xC1, 0x23, 0x25, 0x83, 0x16,
-    0xF5, 0x3E, 0xC7, 0x50, 0xA7, 0xC1, 0xD7, 0xE3, 0x01, 0x9E, 0x2C, 0xB0, 0x0A, 0x58, 0x6E, 0x33,
-    0x6E, 0xBB, 0x4F, 0x04, 0x33, 0xE6, 0xFC, 0xE0, 0x9B, 0xFC, 0xE0, 0x5D, 0x7E, 0xD0, 0xB2, 0x88,
-    0x62, 0x48, 0x59, 0x2B, 0x13, 0xD9, 0x83, 0x6F, 0x94, 0xA4, 0x8E, 0x2D, 0xD6, 0x01, 0xFA, 0x1B,
-    0xAE, 0x6A, 0x80, 0x47, 0x96, 0xB3, 0x4C, 0x73, 0x46, 0xC2, 0x2B, 0x99, 0x91, 0x98, 0x1F, 0x4F,
-    0x63, 0xA8, 0x47, 0x4A, 0xAB, 0x37, 0xD5, 0xB3, 0x78, 0x25, 0x3C, 0xB0, 0x85, 0x91, 0xEE, 0x02,
-    0xFB, 0x6B, 0xD1, 0xFA, 0x2C, 0x6F, 0xC8, 0x16, 0x08, 0x2E, 0xBD, 0x2A, 0x98, 0xF4, 0x93, 0xC1,
-    0x84, 0x87, 0x56, 0x82, 0x27, 0xF1, 0x6E, 0xF6, 0x87, 0x32, 0x0D, 0x1F, 0xCB, 0xBA, 0xEB, 0x5C,
-    0x5E, 0x62, 0x0A, 0xDC, 0xAC, 0xE1, 0xF7, 0x99, 0x16, 0x0D, 0xA2, 0x00, 0x99, 0x3E, 0x55, 0xA7,
-    0x9D, 0x01, 0x86, 0xD5, 0xB8, 0x9C, 0xA6, 0x25, 0x7C, 0x70, 0x69, 0xF5, 0x93, 0x25, 0x69, 0xAD,
-    0xB6, 0x36, 0xAB, 0x6A, 0x6B, 0x6F, 0x63, 0xB5, 0xF5, 0x97, 0x2F, 0xE9, 0x65, 0x20, 0x40, 0x9C,
-    0x28, 0x63, 0x8F, 0x90, 0xE9, 0x20, 0x52, 0x2A, 0xC9, 0xE6, 0x8A, 0xD5, 0x09, 0x6C, 0xB1, 0x69,
-    0xE2, 0x0F, 0x5C, 0x51, 0x5D, 0xC6, 0xD0, 0x5C, 0x63, 0x73, 0xCD, 0x92, 0xD4, 0x40, 0x82, 0x39,
-    0xAA, 0xCF, 0x33, 0x9F, 0x27, 0x66, 0x3B, 0xC6, 0x15, 0xD6, 0x13, 0x82, 0xE5, 0xAD, 0x43, 0xE0,
-    0x2A, 0x73, 0xC5, 0xE4, 0x23, 0x99, 0x94, 0xB4, 0x23, 0x71, 0x65, 0x6B, 0xFD, 0x28, 0x53, 0xB8,
-    0xAE, 0xA5, 0x0C, 0x6D, 0xC4, 0xA2, 0xB4, 0x2A, 0xB5, 0xBF, 0x7C, 0x46, 0x06, 0x54, 0x92, 0xEE,
-    0x76, 0x90, 0xD0, 0xB7, 0xAB, 0x6A, 0xF7, 0x4E, 0x5F, 0x58, 0xF3, 0x4F, 0xCF, 0xB9, 0xEB, 0x0A,
-    0xEF, 0xCC, 0xF1, 0x81, 0x43, 0x0D, 0x48, 0x45, 0x7B, 0x30, 0x05, 0xF0, 0x5F, 0x0F, 0x18, 0xF6,
-    0x6E, 0x47, 0xB3, 0x04, 0x6D, 0xF1, 0x34, 0x62, 0xB5, 0x87, 0xEC, 0x57, 0x8D, 0x58, 0x01, 0xF5,
-    0x6F, 0xC4, 0x63, 0x62, 0x72, 0x04, 0xC7, 0x45, 0x48, 0x87, 0x90, 0x58, 0x11, 0xF1, 0x96, 0x05,
-    0xC0, 0xB9, 0x98, 0x9E, 0xC5, 0x48, 0xD8, 0x2D, 0xB7, 0x19, 0x5D, 0xE1, 0x1A, 0xC5, 0x57, 0x38,
-    0x4E, 0xCE, 0xA9, 0xAE, 0xDE, 0xC3, 0xB1, 0x2A, 0x66, 0x77, 0xD2, 0x22, 0x0F, 0xCD, 0x04, 0x68,
-    0x39, 0x1A, 0x15, 0x2B, 0xD1, 0x86, 0xD8, 0xAF, 0x8E, 0x39, 0xAA, 0x22, 0xC2, 0x08, 0xEE, 0x2A,
-    0xEB, 0x17, 0x68, 0x89, 0x45, 0xA6, 0x57, 0x49, 0x5C, 0x46, 0x8A, 0xC5, 0x7E, 0xF9, 0xA0, 0xFC,
-    0x15, 0x2D, 0x2C, 0x26, 0x82, 0x54, 0x60, 0x4A, 0x1B, 0x8B, 0x8A, 0x4F, 0x9D, 0xCC, 0x7A, 0xA1,
-    0x75, 0x96, 0x36, 0x23, 0x29, 0x6D, 0x7F, 0x75, 0x85, 0x5F, 0x49, 0x66, 0x92, 0xA2, 0x1C, 0x94,
-    0x0D, 0xF2, 0x95, 0xB1, 0x98, 0xFE, 0x9E, 0x81, 0x89, 0xF6, 0x69, 0x67, 0x47, 0x33, 0x12, 0x76,
-    0x9E, 0x25, 0x6B, 0x5D, 0xA6, 0x62, 0x39, 0x61, 0x2C, 0x8D, 0xD5, 0x46, 0x65, 0xCE, 0x6B, 0x63,
-    0xA5, 0xF8, 0xE7, 0xE7, 0x2A, 0xFB, 0xCE, 0x97, 0xE5, 0x90, 0x63, 0x1B, 0x86, 0xF4, 0x70, 0x22,
-    0xE8, 0x4F, 0x64, 0xB4, 0x63, 0x30, 0x88, 0x1C, 0x65, 0x20, 0xE9, 0x2B, 0x48, 0xC7, 0xEE, 0x95,
-    0xF7, 0x74, 0xEA, 0x07, 0x51, 0x7F, 0x7C, 0x69, 0xB7, 0x65, 0x4F, 0x3E, 0x81, 0x1A, 0xEF, 0x80,
-    0xA3, 0xD7, 0x7A, 0x91, 0x96, 0xF4, 0x15, 0xD3, 0x24, 0x99, 0xFF, 0x8E, 0xDE, 0xB4, 0xD3, 0x9E,
-    0x22, 0xD8, 0xFE, 0x82, 0x9B, 0x23, 0xB8, 0x99, 0x44, 0xD6, 0x62, 0xAD, 0x5A, 0x7E, 0x73, 0x2E,
-    0xAB, 0x26, 0x66, 0x25, 0xF4, 0x26, 0x65, 0x12, 0xB5, 0x27, 0x14, 0x24, 0x44, 0xED, 0x64, 0x04,
-    0x19, 0x46, 0x5C, 0xF8, 0xF7, 0x9F, 0xB7, 0xCC, 0xAE, 0x15, 0x8C, 0xCF, 0x57, 0x07, 0xC6, 0xE8,
-    0x31, 0x52, 0x18, 0xF1, 0xE1, 0xBE, 0xCD, 0x62, 0x57, 0xAF, 0x30, 0x2C, 0x0F, 0x78, 0x7B, 0xC9,
-    0x66, 0xA9, 0x40, 0xDF, 0x0A, 0x39, 0x0B, 0x1E, 0x1A, 0x66, 0x2F, 0xD2, 0xD1, 0x1D, 0x7A, 0x1C,
-    0x60, 0x82, 0xEC, 0x70, 0xE1, 0x4D, 0x45, 0x94, 0x20, 0x47, 0x83, 0x96, 0x9C, 0xDF, 0x48, 0xD6,
-    0x4F, 0x91, 0x75, 0x74, 0xBF, 0x0C, 0x68, 0xCB, 0x65, 0xA8, 0x63, 0x64, 0xBF, 0x4E, 0xA5, 0xCF,
-    0xA0, 0xA7, 0x02, 0x7A, 0x16, 0x23, 0xEB, 0x5D, 0x44, 0x2F, 0x24, 0x42, 0xA3, 0xF2, 0x57, 0x98,
-    0x5E, 0xD2, 0xBC, 0xCC, 0x43, 0xA7, 0xD3, 0x4C, 0xF8, 0xAD, 0x48, 0x12, 0xF2, 0x48, 0x65, 0xE7,
-    0x30, 0x2B, 0xC9, 0x59, 0x82, 0x44, 0x7F, 0x6F, 0x83, 0xC1, 0xF8, 0x3F, 0x95, 0xCC, 0x42, 0xFA,
-    0x27, 0x20, 0x17, 0xF8, 0x16, 0x50, 0x13, 0xA3, 0x45, 0x0A, 0x8C, 0xFD, 0x66, 0x1A, 0x6C, 0x2D,
-    0xFE, 0x48, 0xFF, 0x1D, 0xDB, 0x2F, 0xC4, 0xC6, 0x80, 0x83, 0xA9, 0xD3, 0xF1, 0x2B, 0xDC, 0x56,
-    0xE3, 0xF8, 0x87, 0x9A, 0xB9, 0x0E, 0x89, 0x94, 0x41, 0xF3, 0x22, 0xDB, 0x31, 0x19, 0xCD, 0xA7,
-    0xCD, 0x9B, 0x40, 0x10, 0x2B, 0x4A, 0x38, 0x26, 0xA0, 0x09, 0xEB, 0x1F, 0xA4, 0x73, 0x4E, 0x27,
-    0x36, 0xCD, 0xD1, 0x9D, 0xDF, 0x3D, 0x86, 0x12, 0x4A, 0x0A, 0x73, 0x93, 0xFB, 0x7E, 0xE0, 0x36,
-    0x1C, 0xB1, 0x39, 0xD7, 0x58, 0x65, 0xEB, 0xC0, 0x33, 0x18, 0x77, 0x2B, 0xA3, 0x3C, 0x36, 0x5D,
-    0x9B, 0xAC, 0xAC, 0x3A, 0xD3, 0x5A, 0xBF, 0x5A, 0xA1, 0x7F, 0x30, 0xBA, 0x12, 0xAA, 0xB9, 0xB6,
-    0x21, 0x9C, 0x1C, 0x91, 0x6E, 0xE7, 0xDC, 0xF8, 0x11, 0x7A, 0x2F, 0xD4, 0xDA, 0x0B, 0xB3, 0xDC,
-    0xA9, 0x12, 0xF1, 0x44, 0xB9, 0xDA, 0x71, 0x73, 0x12, 0x72, 0x43, 0x54, 0x0B, 0x3A, 0x55, 0x60,
-    0x3E, 0x2E, 0xFC, 0x02, 0x86, 0xE9, 0xAF, 0x5C, 0xC0, 0xAF, 0x09, 0x10, 0x0D, 0xEE, 0xB5, 0x9C,
-    0x84, 0x2B, 0xD9, 0x63, 0x89, 0x33, 0x4D, 0x9A, 0xAB, 0x07, 0xF6, 0x94, 0x54, 0xD8, 0x55, 0x88,
-    0xA1, 0xCC, 0x8A, 0x46, 0x69, 0xC9, 0x68, 0xB0, 0xA7, 0x4A, 0x3C, 0x79, 0xB1, 0xD0, 0x3A, 0x42,
-    0xBB, 0x58, 0x59, 0x0B, 0xD6, 0xC6, 0x37, 0xE6, 0x4C, 0xB9, 0xAC, 0xC1, 0xD3, 0x21, 0x20, 0x5D,
-    0x19, 0x39, 0xE6, 0x9D, 0xBC, 0xFA, 0x78, 0x94, 0xF3, 0xB6, 0xD7, 0xA4, 0xBF, 0x62, 0xC6, 0x3E,
-    0x45, 0x59, 0xA3, 0x97, 0xB1, 0xE4, 0x9F, 0x19, 0x8F, 0x03, 0xC7, 0x12, 0x24, 0xA0, 0xB3, 0x19,
-    0xF2, 0xE7, 0xAD, 0x27, 0x62, 0xF3, 0x1B, 0x90, 0x52, 0x9F, 0xB2, 0x10, 0x0E, 0xD5, 0x1C, 0x5D,
-    0x02, 0xFD, 0xF8, 0xCB, 0x65, 0x9A, 0x26, 0xAA, 0x96, 0xF4, 0x8E, 0x32, 0x1A, 0xA5, 0x32, 0x07,
-    0x2C, 0xC9, 0x42, 0x52, 0x3C, 0xEC, 0x00, 0xA4, 0xCE, 0x6E, 0xC8, 0x1F, 0xE4, 0xF6, 0xC0, 0xB8,
-    0x9D, 0x36, 0x94, 0x86, 0xA6, 0x88, 0xCA, 0xD1, 0xFB, 0xB1, 0x73, 0x81, 0x4E, 0x82, 0xED, 0x72,
-    0x63, 0x87, 0x7A, 0x97, 0x05, 0xCA, 0x30, 0x70, 0x9B, 0x51, 0x6D, 0xA9, 0x56, 0xDB, 0x64, 0x10,
-    0xA0, 0x25, 0x08, 0xD3, 0xBE, 0x68, 0xFE, 0xA9, 0x0B, 0xE0, 0x22, 0xEA, 0x44, 0xE0, 0x97, 0x26,
-    0xB6, 0x07, 0x2D, 0xF1, 0x56, 0x9F, 0x50, 0x72, 0xEA, 0x9E, 0xB1, 0xF6, 0xDA, 0x5A, 0xCF, 0x46,
-    0x97, 0x5C, 0xCC, 0x49, 0xE1, 0xC9, 0xB2, 0x15, 0x80, 0x2E, 0x11, 0x48, 0x85, 0x3D, 0x07, 0x47,
-    0x3C, 0xF8, 0x01, 0x6E, 0x5C, 0x07, 0xD3, 0x7E, 0x2B, 0xBF, 0xF8, 0x2A, 0x67, 0x20, 0xA2, 0x29,
-    0xBA, 0x66, 0x58, 0xA4, 0xEB, 0xE3, 0xE2, 0xDC, 0x6A, 0x21, 0xBE, 0xEC, 0x69, 0x59, 0xAF, 0x5F,
-    0x43, 0xF6, 0x6C, 0xDA, 0x67, 0xA5, 0x2A, 0x7A, 0xFE, 0x1C, 0xFA, 0xBD, 0x55, 0xAE, 0xD7, 0x1D,
-    0x73, 0x78, 0xCB, 0xFC, 0xF6, 0x40, 0xD7, 0xDC, 0x00, 0xD8, 0x9C, 0x9F, 0xD9, 0x2B, 0xEA, 0x89,
-    0x53, 0x32, 0x65, 0x82, 0x88, 0xD9, 0x28, 0x4F, 0xBA, 0xCE, 0x79, 0x9F, 0x65, 0x4E, 0xF8, 0x71,
-    0x9E, 0x6D, 0xD1, 0xB2, 0xD6, 0x38, 0x32, 0x1A, 0xE0, 0xE8, 0x59, 0x28, 0x99, 0xF8, 0x23, 0xCF,
-    0xE9, 0x14, 0x01, 0xE4, 0x48, 0xE4, 0x58, 0x7B, 0x2C, 0x33, 0x97, 0xDB, 0xE3, 0x82, 0x6F, 0xAD,
-    0x98, 0x2B, 0xE5, 0x09, 0x9E, 0x7E, 0x6B, 0xC9, 0x16, 0xE8, 0xE9, 0xB8, 0x5B, 0x59, 0x91, 0xBB,
-    0xE8, 0x74, 0x16, 0x1D, 0x0A, 0xB6, 0xE9, 0x04, 0x34, 0xCC, 0x2C, 0x3F, 0x51, 0xA5, 0x8A, 0x63,
-    0xD2, 0x5A, 0x3D, 0x24, 0x08, 0x91, 0xBA, 0xFE, 0x8E, 0xC8, 0x25, 0x3F, 0x2C, 0x91, 0x1A, 0x46,
-    0x9D, 0xED, 0x48, 0xF3, 0xB3, 0x2B, 0xD7, 0xF1, 0x1B, 0xA7, 0x5C, 0x30, 0xF4, 0x7F, 0x72, 0x53,
-    0xF1, 0x08, 0x83, 0xD4, 0x23, 0xB5, 0x25, 0x13, 0xF2, 0x75, 0x9E, 0x0D, 0x18, 0x19, 0x95, 0xF5,
-    0x5C, 0x08, 0xE9, 0xA9, 0xBA, 0x4C, 0x66, 0xB9, 0xB5, 0x65, 0x03, 0x90, 0xE4, 0x92, 0xCC, 0x2D,
-    0xEB, 0x1E, 0xD4, 0xEE, 0xB0, 0xBE, 0xBE, 0xDB, 0xAA, 0x68, 0x5B, 0x97, 0xDA, 0x57, 0x2D, 0x07,
-    0x1B, 0x52, 0x57, 0x68, 0x03, 0x0C, 0xD7, 0x83, 0xE1, 0xBE, 0x08, 0xAD, 0x45, 0x80, 0xF2, 0x61,
-    0xC8, 0xE7, 0x79, 0xD4, 0x12, 0x21, 0x10, 0xDB, 0x18, 0x77, 0x56, 0x0A, 0x62, 0x20, 0xA7, 0xAE,
-    0xBB, 0x32, 0x58, 0xBA, 0xCB, 0x4D, 0x3A, 0x10, 0xC9, 0x0B, 0x76, 0x0D, 0x77, 0x63, 0x57, 0x45,
-    0x95, 0xD6, 0x79, 0x15, 0x4C, 0x80, 0xC7, 0xBA, 0x2F, 0x50, 0x6D, 0xDC, 0xE2, 0x78, 0xF5, 0x5C,
-    0xC9, 0x0D, 0x2E, 0xB2, 0xD4, 0x6E, 0xC8, 0x8F, 0xB2, 0x33, 0x5C, 0x96, 0xC4, 0x09, 0xD8, 0x2D,
-    0x1A, 0xE9, 0x9A, 0x86, 0x32, 0x52, 0x46, 0xD5, 0x57, 0x44, 0x07, 0xC3, 0x02, 0xB9, 0xDC, 0x1B,
-    0xF6, 0x55, 0xB9, 0x37, 0x4A, 0x50, 0x6B, 0x28, 0x8D, 0xB7, 0xEF, 0x7A, 0xC0, 0xCE, 0xDD, 0xB3,
-    0xCB, 0xED, 0x24, 0x5A, 0x03, 0xA2, 0xF5, 0x20, 0xED, 0xBA, 0xF6, 0x0D, 0xC7, 0x44, 0xB4, 0x38,
-    0x92, 0xFA, 0xCD, 0xDB, 0x25, 0xF3, 0xB9, 0xE1, 0xB4, 0x16, 0x6A, 0x69, 0x05, 0x17, 0xBD, 0x39,
-    0x9D, 0xF8, 0xC9, 0xD3, 0xE6, 0xCF, 0x39, 0x57, 0xED, 0x8A, 0x35, 0xD6, 0x75, 0xF0, 0xB7, 0xED,
-    0x32, 0x0D, 0xA8, 0xEB, 0x40, 0x29, 0x64, 0x99, 0x9F, 0xDD, 0x8C, 0x6E, 0x00, 0xEE, 0x00, 0x18,
-    0x84, 0x31, 0x35, 0x38, 0x19, 0x68, 0x58, 0xBB, 0x67, 0xF7, 0x8A, 0x79, 0xA3, 0x5E, 0x5E, 0x91,
-    0x62, 0x45, 0x5D, 0x43, 0x32, 0xEF, 0xDB, 0xFB, 0x27, 0x6C, 0x69, 0x22, 0xAD, 0x54, 0xB2, 0x7A,
-    0xB8, 0x5A, 0xD4, 0x9A, 0x16, 0x96, 0x77, 0xFE, 0x0B, 0x35, 0x57, 0x01, 0x37, 0x69, 0xA1, 0xE6,
-    0xC2, 0x78, 0x57, 0xA0, 0x85, 0xBC, 0xCE, 0xE5, 0x61, 0x0E, 0x14, 0x3D, 0xCE, 0xBF, 0x8E, 0x52,
-    0x8D, 0xF0, 0xE6, 0xAD, 0x41, 0x8F, 0xA1, 0xBC, 0x8D, 0xDF, 0xCF, 0x08, 0x33, 0xAD, 0x1C, 0x09,
-    0xBD, 0x90, 0x75, 0x91, 0x25, 0x8D, 0xF7, 0x53, 0x60, 0x82, 0x4E, 0x16, 0x1C, 0x69, 0x7E, 0xEB,
-    0xDC, 0x24, 0x4B, 0x5D, 0x93, 0xB9, 0xDA, 0xDA, 0xBF, 0x31, 0xED, 0xB9, 0x7C, 0x40, 0xBE, 0xFC,
-    0xFD, 0xB1, 0x12, 0x6D, 0x46, 0xD3, 0x7F, 0xB7, 0x74, 0x3A, 0xAD, 0x16, 0x53, 0x05, 0xD6, 0xFE,
-    0xAF, 0x85, 0xC2, 0xD3, 0x67, 0x77, 0xC7, 0x2B, 0x8E, 0x26, 0x09, 0x94, 0xA2, 0x57, 0x80, 0x7F,
-    0x8A, 0xAC, 0x1E, 0x51, 0x28, 0x7F, 0x2C, 0xAB, 0xBB, 0x53, 0x9D, 0xE2, 0xB3, 0xE5, 0x13, 0x03,
-    0x0F, 0x75, 0x03, 0xC0, 0xF0, 0xD4, 0xFE, 0xE1, 0x1B, 0x18, 0x35, 0x36, 0x04, 0xCC, 0xCF, 0x9D,
-    0xFC, 0xFE, 0x15, 0x0E, 0x9B, 0xCF, 0xC3, 0x6F, 0x73, 0xBC, 0x09, 0xA1, 0xD2, 0xB0, 0x4C, 0x6A,
-    0xF8, 0x7D, 0x8C, 0x4E, 0x7D, 0xC4, 0xEC, 0xF2, 0x55, 0x69, 0xF6, 0x0C, 0x6A, 0x5E, 0x85, 0x05,
-    0x1A, 0xE2, 0x47, 0xA8, 0x30, 0xCF, 0x91, 0x0F, 0x46, 0xC5, 0x5B, 0x3A, 0xA6, 0xC7, 0x9A, 0xA8,
-    0x9A, 0x40, 0xF1, 0xC8, 0xF1, 0x66, 0x81, 0x26, 0x6C, 0x1D, 0x9A, 0xC9, 0xE9, 0xCD, 0x3E, 0xC1,
-    0x77, 0x5F, 0x06, 0xFF, 0xD6, 0x27, 0xF6, 0x53, 0xAD, 0xBF, 0xB7, 0x1D, 0x03, 0x18, 0x86, 0x51,
-    0x2C, 0x85, 0xD6, 0x48, 0xB0, 0xC0, 0x94, 0xCD, 0xE9, 0xE5, 0xAF, 0x05, 0xB5, 0xCC, 0x08, 0x52,
-    0x80, 0xCF, 0x9A, 0xF0, 0x67, 0x12, 0x33, 0xB6, 0xF2, 0xD1, 0x4B, 0xE1, 0xE9, 0xD9, 0x67, 0x59,
-    0x20, 0xC1, 0x90, 0x8B, 0x0D, 0x8B, 0xE5, 0x3E, 0x77, 0x7A, 0x13, 0xDF, 0x13, 0x00, 0x3B, 0xA4,
-    0x85, 0x67, 0xB1, 0x61, 0xE0, 0x36, 0x8A, 0xA9, 0xC0, 0xFD, 0x61, 0xB3, 0x94, 0x08, 0x5E, 0xC6,
-    0x96, 0x95, 0x1D, 0xD8, 0x8C, 0xD8, 0xD9, 0x50, 0x58, 0xAF, 0x8E, 0xE0, 0x61, 0xD7, 0x39, 0xA2,
-    0xCC, 0x6C, 0xED, 0x2F, 0x3D, 0x27, 0x21, 0xAA, 0x28, 0xD7, 0x23, 0xD7, 0x83, 0x3E, 0x6E, 0xC2,
-    0xF4, 0x9E, 0x7F, 0x3D, 0x70, 0x1B, 0x49, 0x00, 0x5B, 0xFA, 0x0B, 0xAF, 0x6D, 0x28, 0xC7, 0x10,
-    0xB8, 0x15, 0xDD, 0x03, 0x83, 0x4D, 0x61, 0x36, 0x2A, 0xCC, 0x76, 0x29, 0x4C, 0x51, 0x4C, 0x27,
-    0xCC, 0x68, 0x48, 0xEB, 0xC0, 0x7E, 0x73, 0xF4, 0xED, 0x3B, 0xEE, 0x8F, 0x17, 0x8C, 0x33, 0x1C,
-    0xC1, 0x2E, 0xBF, 0x1E, 0x74, 0x8F, 0x79, 0x71, 0xFB, 0xA9, 0x6B, 0xB2, 0xEA, 0xBD, 0xC9, 0x55,
-    0xE2, 0xF9, 0x56, 0xF7, 0x6B, 0x4C, 0xDC, 0x53, 0xF9, 0x04, 0xCA, 0x51, 0x4D, 0x55, 0x69, 0xEC,
-    0x6B, 0xE5, 0x6A, 0x33, 0x55, 0xBE, 0x61, 0x33, 0xD5, 0x97, 0xAD, 0x94, 0x49, 0x36, 0x7B, 0x29,
-    0xEF, 0x0B, 0x12, 0xCB, 0xC9, 0x12, 0x20, 0x28, 0xD0, 0xC8, 0x0B, 0xF3, 0xA4, 0xEA, 0x67, 0xA6,
-    0x41, 0x17, 0xB1, 0xD9, 0x81, 0x8C, 0xF6, 0xD9, 0xEF, 0x6A, 0x31, 0x09, 0x0D, 0xEC, 0x26, 0xF3,
-    0x95, 0x88, 0x85, 0xB8, 0xD3, 0x89, 0x5C, 0xA9, 0xB0, 0x85, 0x2A, 0xEC, 0xED, 0xA5, 0xC2, 0x56,
-    0xFE, 0xAC, 0xB0, 0x69, 0x2B, 0x78, 0x72, 0x4C, 0x25, 0x14, 0xBA, 0x2C, 0x77, 0xFE, 0x85, 0x0B,
-    0x82, 0x88, 0x54, 0x33, 0x2C, 0xF0, 0xAD, 0x23, 0xBC, 0x4D, 0xDA, 0xA0, 0x20, 0x24, 0x26, 0xAD,
-    0x10, 0x22, 0x9B, 0x82, 0xAD, 0x94, 0x06, 0x9B, 0x3C, 0x6B, 0xA6, 0x95, 0x1E, 0xF2, 0x58, 0x50,
-    0x92, 0x86, 0x42, 0xAB, 0x83, 0x13, 0x6F, 0x06, 0x7D, 0x53, 0x9D, 0xFA, 0xA6, 0xD7, 0x37, 0x90,
-    0xA9, 0xA1, 0x50, 0x37, 0xBF, 0x29, 0x20, 0x29, 0x69, 0x25, 0x20, 0x05, 0xE4, 0xCD, 0x74, 0x43,
-    0xBC, 0x54, 0xAC, 0x0C, 0x94, 0xFA, 0x37, 0x15, 0xBA, 0xC9, 0x5D, 0xB2, 0xD9, 0x6A, 0x0C, 0x61,
-    0x8F, 0x84, 0x73, 0x21, 0x8A, 0x95, 0xE1, 0xFB, 0xC4, 0xDB, 0xC5, 0xA4, 0x4E, 0xE5, 0xEA, 0xE1,
-    0x7C, 0xDC, 0xF8, 0xA0, 0x5A, 0x23, 0xED, 0x09, 0x9F, 0x0C, 0xD5, 0xAE, 0x58, 0xDD, 0xC1, 0x3A,
-    0x01, 0x78, 0x68, 0x28, 0xB8, 0x6E, 0xD4, 0x62, 0x41, 0x00, 0x9C, 0x16, 0xEB, 0x59, 0xB9, 0x55,
-    0x95, 0x8E, 0x8F, 0x25, 0x5A, 0x19, 0x0B, 0xA3, 0xE6, 0x0A, 0x3E, 0x17, 0xCF, 0xD6, 0x3C, 0xA5,
-    0x15, 0x52, 0xD3, 0xCC, 0x57, 0x3E, 0x4E, 0xCA, 0x1A, 0x35, 0xCB, 0xE4, 0x75, 0xBA, 0xDA, 0xD7,
-    0xA1, 0x15, 0xFC, 0xBA, 0x0B, 0xF9, 0x0A, 0x8A, 0xD7, 0x74, 0xC9, 0x1F, 0x55, 0xCD, 0x48, 0x55,
-    0x73, 0x5E, 0xF2, 0x2B, 0xD5, 0xEC, 0x6C, 0x11, 0x8F, 0xC9, 0x78, 0x95, 0xAA, 0x59, 0xBB, 0x10,
-    0x99, 0xC5, 0x33, 0xC5, 0xF9, 0x69, 0x72, 0xB5, 0x70, 0xCC, 0x31, 0x23, 0x32, 0xFF, 0xCF, 0x4C,
-    0xEB, 0xD7, 0x10, 0x56, 0x7A, 0xE3, 0xC9, 0x75, 0x6D, 0xD6, 0xEB, 0x27, 0x52, 0xF7, 0x95, 0xB9,
-    0x6A, 0x2B, 0xFD, 0xF5, 0xE8, 0x3E, 0x57, 0x9C, 0x9B, 0x16, 0xFE, 0xF8, 0x08, 0xE6, 0x42, 0xB1,
-    0xB2, 0x6F, 0xBF, 0xEF, 0xB6, 0x4D, 0x7C, 0xEC, 0xF6, 0x4A, 0x74, 0x0A, 0x6B, 0x92, 0x41, 0x4B,
-    0x25, 0x22, 0x1B, 0x38, 0xF4, 0x54, 0x58, 0x45, 0x47, 0xB5, 0xE8, 0x27, 0x06, 0xDA, 0x86, 0xAE,
-    0x78, 0xD9, 0x83, 0x54, 0x2B, 0x36, 0x03, 0x6C, 0xDA, 0xC8, 0x22, 0x88, 0xDD, 0xC7, 0x9F, 0x69,
-    0xA9, 0x31, 0x7C, 0xB1, 0xA6, 0x7D, 0x6E, 0x31, 0x4B, 0x31, 0xF6, 0x5F, 0x5F, 0x05, 0xB7, 0xF5,
-    0x19, 0x68, 0x4D, 0x7A, 0xE2, 0x7D, 0xE0, 0xBB, 0x84, 0xE5, 0x56, 0x8C, 0xB6, 0x5A, 0x57, 0x0B,
-    0xDA, 0x33, 0x81, 0x9B, 0xDA, 0x81, 0xD8, 0x2F, 0x62, 0xE9, 0x38, 0xA9, 0xF3, 0x8C, 0xB5, 0x1D,
-    0x39, 0xD6, 0x0E, 0x29, 0xDE, 0xC6, 0x1C, 0x2D, 0x24, 0x0A, 0x3A, 0xB3, 0xFC, 0x03, 0x10, 0x4A,
-    0xE8, 0xE4, 0x8A, 0xBC, 0x73, 0xFE, 0x11, 0x09, 0xFE, 0x49, 0x84, 0xFA, 0x41, 0x7F, 0x6C, 0x44,
-    0x65, 0x4E, 0x96, 0x1A, 0x12, 0x67, 0x6A, 0x4E, 0xEC, 0x46, 0xD2, 0x7A, 0x59, 0x38, 0xC4, 0x5D,
-    0xD8, 0x46, 0x7D, 0xD4, 0xC7, 0x7D, 0xDC, 0x89, 0xB7, 0x1C, 0x50, 0x3D, 0x9C, 0x4F, 0x69, 0xBB,
-    0x98, 0xAC, 0x2D, 0x1B, 0xDD, 0x0E, 0xC2, 0x63, 0xE5, 0xAF, 0xF6, 0x6A, 0x60, 0x7F, 0x4E, 0x89,
-    0x35, 0x3C, 0x82, 0xBE, 0x42, 0x29, 0xB1, 0xE1, 0x06, 0x17, 0x63, 0x2E, 0x5C, 0xDB, 0x7A, 0xC3,
-    0xCC, 0xA1, 0x9B, 0x56, 0x68, 0xA8, 0xEE, 0x29, 0x4B, 0xCE, 0xD0, 0xAE, 0x11, 0x5C, 0x2C, 0x66,
-    0x54, 0x7A, 0x74, 0x26, 0x7B, 0xD0, 0x3E, 0xC8, 0x95, 0x04, 0xC8, 0x91, 0x5D, 0x66, 0xA9, 0x2E,
-    0x3C, 0x8B, 0x4C, 0x18, 0x0D, 0x41, 0xAA, 0x1B, 0xCA, 0x5B, 0x8F, 0x2C, 0xB2, 0x72, 0xAA, 0xFC,
-    0xF3, 0x02, 0x17, 0x59, 0x87, 0xCB, 0x3D, 0xF3, 0x23, 0xF4, 0x30, 0x25, 0x22, 0x2E, 0x29, 0x55,
-    0xAE, 0x10, 0xDF, 0xDA, 0x65, 0x2D, 0x8C, 0x12, 0x05, 0xAA, 0x1B, 0xE4, 0x5B, 0xB5, 0xA8, 0x32,
-    0x64, 0xF0, 0xAD, 0x24, 0x15, 0x7F, 0x18, 0xB8, 0xB2, 0xCB, 0x6A, 0x8D, 0x3D, 0xE1, 0xBC, 0xE4,
-    0xE4, 0xF6, 0x61, 0x6E, 0x3E, 0xC4, 0xBE, 0x5C, 0x39, 0x57, 0x66, 0xC1, 0xF0, 0xD0, 0x71, 0x89,
-    0xF9, 0x0E, 0x46, 0xC1, 0xF3, 0x71, 0x9B, 0x37, 0x12, 0x6C, 0xC8, 0xFC, 0x23, 0xD3, 0x1B, 0x63,
-    0xF3, 0x42, 0x59, 0x04, 0x48, 0x69, 0x87, 0x53, 0x8C, 0x84, 0x51, 0x09, 0xD6, 0x8D, 0x89, 0x8C,
-    0xD6, 0xF1, 0x56, 0xFA, 0x97, 0xA6, 0x5A, 0xC7, 0xF7, 0xB1, 0x16, 0x36, 0x69, 0xE7, 0x02, 0xC1,
-    0x51, 0x33, 0xB9, 0xDC, 0xC3, 0xC9, 0xB0, 0x38, 0xE5, 0x4F, 0x9A, 0x55, 0x51, 0x28, 0xCD, 0x5D,
-    0xC5, 0x30, 0x84, 0xD6, 0x6E, 0x44, 0x6C, 0x91, 0x77, 0xE2, 0x39, 0x7C, 0xFB, 0x1F, 0x20, 0xDC,
-    0x76, 0xBE, 0xB1, 0xF3, 0xC8, 0x7B, 0x89, 0x1E, 0xD7, 0xE9, 0x71, 0x7F, 0x20, 0x83, 0x7F, 0x91,
-    0xC7, 0x51, 0x9E, 0x3C, 0x91, 0x67, 0xA7, 0x50, 0x9E, 0xB1, 0x9D, 0x77, 0x1B, 0xEB, 0x3E, 0x6E,
-    0x35, 0xAE, 0x2C, 0x34, 0xB0, 0xAD, 0xB7, 0xB7, 0x67, 0xB5, 0x98, 0x91, 0x54, 0xFC, 0xAA, 0x56,
-    0xA8, 0xD4, 0x0D, 0xE2, 0x2C, 0x06, 0xD6, 0x0A, 0x48, 0xDA, 0x42, 0x74, 0xC5, 0xB1, 0x83, 0xAE,
-    0xC9, 0xF1, 0xA9, 0x6F, 0x7B, 0xCF, 0xE5, 0x6C, 0x6E, 0xD9, 0x25, 0xD9, 0x39, 0x1E, 0x89, 0xF9,
-    0xEE, 0xB9, 0xCA, 0xAB, 0x55, 0x78, 0x9A, 0xCE, 0x7F, 0x51, 0x68, 0x72, 0xE5, 0xC5, 0xA7, 0xAB,
-    0x56, 0xEA, 0xB6, 0xA4, 0x54, 0xA0, 0x69, 0xB0, 0x29, 0xDD, 0xCD, 0x79, 0xDA, 0x2B, 0x9F, 0xB5,
-    0xDC, 0xF5, 0x96, 0x3B, 0x66, 0x58, 0xEB, 0x50, 0xEE, 0xB3, 0x3B, 0x34, 0xE5, 0x1C, 0xFE, 0x25,
-    0xDD, 0x41, 0xA7, 0x35, 0x6E, 0xE5, 0x8A, 0x0E, 0x52, 0xE2, 0x81, 0x36, 0x56, 0x8B, 0xC4, 0xBD,
-    0x9D, 0xEC, 0xF1, 0x96, 0xA0, 0x6F, 0x5D, 0xB8, 0xAC, 0xFC, 0x7A, 0xE7, 0x42, 0x60, 0x28, 0xD1,
-    0xF1, 0xBE, 0xFF, 0x1E, 0x24, 0xF8, 0xA2, 0x41, 0x86, 0xDD, 0x66, 0xDC, 0x83, 0xF0, 0xEA, 0x38,
-    0xAB, 0xB6, 0xFE, 0x0D, 0x18, 0x65, 0x79, 0x39, 0xA1, 0xC6, 0xBB, 0x7E, 0x3A, 0x5F, 0xE7, 0x36,
-    0x14, 0xEA, 0x36, 0x70, 0x14, 0x6F, 0xB8, 0xBF, 0x8D, 0x20, 0x52, 0x39, 0xB7, 0xB7, 0xEF, 0xE4,
-    0x98, 0xCD, 0xB5, 0xD9, 0x4E, 0x8E, 0xC3, 0x4A, 0x8E, 0x2A, 0xD2, 0xE6, 0xB8, 0x1C, 0x8D, 0xAB,
-    0xEE, 0x0E, 0x39, 0x09, 0xB9, 0x1D, 0x77, 0xAE, 0x04, 0x2B, 0xBA, 0x58, 0x09, 0xBB, 0x5F, 0x1C,
-    0xA7, 0x23, 0x46, 0x16, 0xEF, 0xA4, 0xB5, 0x78, 0x49, 0xFB, 0xD7, 0xAE, 0x24, 0x9B, 0x4B, 0x2D,
-    0x9D, 0x6B, 0xB7, 0x37, 0x17, 0xEF, 0x7C, 0x99, 0x52, 0xF5, 0xEC, 0xB5, 0x04, 0x2E, 0xF8, 0xB2,
-    0x78, 0x9E, 0x83, 0xA7, 0x69, 0x30, 0x8F, 0x57, 0xE7, 0x8A, 0xC8, 0x05, 0x13, 0x0B, 0x38, 0xCE,
-    0x1B, 0xB1, 0x86, 0xF8, 0x23, 0x28, 0xFC, 0x03, 0x28, 0x4C, 0x3B, 0x4B, 0xF3, 0xBF, 0x01, 0x85,
-    0x54, 0x3D, 0x6C, 0x1D, 0x45, 0x10, 0x9E, 0x7B, 0x17, 0xEB, 0x90, 0x4F, 0xD1, 0xD2, 0x58, 0x48,
-    0x2F, 0xC5, 0xB5, 0x08, 0x45, 0x2C, 0x05, 0xB5, 0xF7, 0x64, 0x0A, 0x0A, 0x0A, 0xBF, 0xC2, 0x2F,
-    0x45, 0x1A, 0x53, 0x50, 0xA0, 0x34, 0x34, 0x94, 0x38, 0x7B, 0x92, 0x0B, 0x0A, 0x1A, 0x17, 0x91,
-    0x68, 0x5D, 0x04, 0xC9, 0x79, 0x29, 0xA0, 0x46, 0xCF, 0xB9, 0xC3, 0x96, 0xF2, 0x24, 0xDC, 0x9C,
-    0xA0, 0x48, 0xC9, 0x61, 0xCA, 0x14, 0x5E, 0x5B, 0x17, 0xB4, 0x09, 0x7B, 0x37, 0x7C, 0x7B, 0x77,
-    0x76, 0xEC, 0xC8, 0x81, 0x7D, 0xEF, 0x7E, 0x66, 0x6F, 0x66, 0x76, 0xE6, 0x9B, 0x6F, 0x46, 0x55,
-    0x24, 0x1C, 0x85, 0x9C, 0x12, 0x57, 0x24, 0x1D, 0xF9, 0x25, 0x8A, 0x27, 0x61, 0x2D, 0x8B, 0x36,
-    0xAE, 0x89, 0xA2, 0x0A, 0xB2, 0xA1, 0xEE, 0x53, 0xCE, 0x34, 0x62, 0x2E, 0x84, 0x95, 0x46, 0x95,
-    0xA1, 0x5B, 0x21, 0xDA, 0x88, 0xCB, 0xB9, 0xAC, 0xE7, 0xAA, 0x99, 0x6F, 0x69, 0xB7, 0x25, 0xEB,
-    0xD5, 0xA8, 0x84, 0xFD, 0x64, 0x99, 0xB9, 0x96, 0xCC, 0x4E, 0xE1, 0xCA, 0xDB, 0xD9, 0x43, 0xA2,
-    0x95, 0x3B, 0x7B, 0x30, 0x85, 0xB1, 0xBF, 0xD5, 0xFE, 0xF6, 0xAA, 0x3B, 0x8A, 0xEE, 0x4D, 0x96,
-    0xBF, 0xB7, 0xA3, 0x46, 0x33, 0x1F, 0xE2, 0x83, 0xE0, 0x96, 0x6E, 0xB5, 0x24, 0x4D, 0x7E, 0xC8,
-    0xA2, 0xD1, 0x2F, 0xF8, 0xCF, 0x69, 0x2A, 0xCB, 0x7C, 0xAD, 0x8D, 0xAD, 0xAA, 0x78, 0x9B, 0x85,
-    0xD3, 0xA7, 0xFC, 0x74, 0x36, 0xDE, 0x5B, 0x0D, 0x5D, 0x50, 0x7E, 0x93, 0xAC, 0xE1, 0xB8, 0x20,
-    0x4D, 0x8C, 0x72, 0x5B, 0xF3, 0xAD, 0x7D, 0xE5, 0xA4, 0x8D, 0x2B, 0x8A, 0x1D, 0xC2, 0xEC, 0xB3,
-    0xA2, 0xC4, 0x51, 0xC4, 0x3E, 0xF8, 0x98, 0x49, 0x59, 0x12, 0x2D, 0x0D, 0x4B, 0x65, 0xA3, 0x46,
-    0xD4, 0x49, 0x1D, 0xB6, 0x79, 0x49, 0x8C, 0xF4, 0x55, 0x83, 0x44, 0x7D, 0xC2, 0xC6, 0xBB, 0x24,
-    0x55, 0x7A, 0x29, 0x84, 0x3E, 0x67, 0xA4, 0xCC, 0x05, 0x48, 0xE5, 0x15, 0x37, 0x79, 0x13, 0x71,
-    0xA9, 0x9A, 0x90, 0x0B, 0xD9, 0x00, 0x40, 0xC1, 0x94, 0xD7, 0x11, 0x67, 0xCA, 0x45, 0x5C, 0x69,
-    0xBF, 0xED, 0xDF, 0xB2, 0xDC, 0x08, 0x0E, 0xB8, 0x92, 0x7E, 0x43, 0xB7, 0x21, 0x57, 0xAA, 0x85,
-    0x08, 0x27, 0x6C, 0x62, 0x4E, 0xB5, 0xED, 0xCD, 0x49, 0x94, 0x6A, 0xD3, 0xE7, 0x5C, 0xAA, 0x14,
-    0x12, 0x05, 0x2E, 0x32, 0x89, 0x97, 0x9F, 0x99, 0xA4, 0x20, 0xD2, 0x8F, 0x26, 0x11, 0xE0, 0x04,
-    0x50, 0x07, 0xB3, 0xC7, 0x28, 0x86, 0x2A, 0x28, 0x7C, 0xFD, 0xF0, 0x2B, 0x29, 0x14, 0xC1, 0x26,
-    0x3F, 0x6C, 0xE2, 0xEA, 0x26, 0xD1, 0xE8, 0xD8, 0x36, 0x5B, 0xC9, 0x5F, 0x76, 0x15, 0xAF, 0xBB,
-    0xA1, 0x09, 0x8D, 0x66, 0xFF, 0x5B, 0x99, 0xF6, 0xCF, 0xF7, 0x5E, 0x44, 0x26, 0x32, 0x01, 0xDD,
-    0xA6, 0x9F, 0x94, 0xDB, 0x9C, 0xDC, 0xA6, 0xCF, 0xBD, 0x8F, 0xC9, 0x18, 0x55, 0x40, 0xD9, 0xAC,
-    0xEE, 0x4B, 0xF7, 0x60, 0x69, 0x92, 0x00, 0x25, 0x69, 0x95, 0x55, 0x0E, 0xF8, 0x5E, 0x57, 0x8B,
-    0x37, 0x0B, 0x20, 0x50, 0x65, 0x2B, 0x38, 0xE5, 0xCB, 0x69, 0xFB, 0x0D, 0x91, 0x26, 0xA4, 0x00,
-    0xA6, 0xB6, 0xEF, 0xC2, 0x97, 0xAE, 0x81, 0xFC, 0x97, 0x94, 0x53, 0x5E, 0xE8, 0x42, 0x15, 0xA2,
-    0x0A, 0xD9, 0x70, 0x03, 0xB5, 0xAF, 0x0A, 0x75, 0xE8, 0xD4, 0xC2, 0xE9, 0x85, 0xCB, 0x8F, 0x5C,
-    0xFE, 0xEB, 0xDE, 0x07, 0xB3, 0x99, 0xE8, 0xF8, 0x61, 0x3C, 0xA7, 0x0A, 0x16, 0x06, 0x0A, 0xB8,
-    0x95, 0xA4, 0x4B, 0xCE, 0x64, 0x1D, 0xF2, 0x7A, 0x43, 0xA2, 0x2B, 0x22, 0xEA, 0x43, 0x8C, 0x2A,
-    0xFA, 0xC2, 0x91, 0x2C, 0x86, 0x32, 0x05, 0x1E, 0x21, 0xA8, 0x43, 0x09, 0x9F, 0x18, 0x12, 0x7C,
-    0x91, 0x7A, 0x09, 0x2E, 0xBB, 0x90, 0xA1, 0x1B, 0xF5, 0x10, 0x46, 0x75, 0xF2, 0x29, 0x47, 0xC7,
-    0x7C, 0x6A, 0x1B, 0xDE, 0x57, 0x09, 0xAF, 0x1F, 0xF0, 0xA1, 0x19, 0xBC, 0x2C, 0xA5, 0x80, 0x65,
-    0x0D, 0xC4, 0xC5, 0x41, 0x03, 0xE0, 0x1D, 0xD1, 0x8D, 0x3C, 0x47, 0x0C, 0x68, 0xBD, 0xDD, 0xC1,
-    0xCA, 0x74, 0xBA, 0x01, 0x4C, 0x9B, 0xF3, 0x8B, 0x3E, 0x8C, 0xCF, 0x5A, 0x71, 0xF2, 0xCF, 0xDF,
-    0xF6, 0x0B, 0xB4, 0x11, 0xA2, 0xAB, 0x94, 0x07, 0x0D, 0xEC, 0xB8, 0xB2, 0x3A, 0xAA, 0x72, 0x3B,
-    0xFC, 0xD3, 0xF3, 0xFF, 0xF9, 0xCE, 0xCA, 0x74, 0x23, 0x7E, 0x5E, 0x32, 0x2F, 0x4E, 0x78, 0x53,
-    0xDE, 0x9F, 0xCF, 0x7F, 0x3E, 0x3E, 0x7B, 0xFE, 0xDD, 0x51, 0x8A, 0x44, 0x45, 0x70, 0x42, 0x32,
-    0x8D, 0xCB, 0xC8, 0x45, 0x47, 0x07, 0x3B, 0x0F, 0xAF, 0xE9, 0xD3, 0x38, 0xCB, 0x63, 0xAB, 0x17,
-    0xF6, 0xC9, 0x52, 0x9F, 0x8C, 0x4C, 0x29, 0x04, 0xF7, 0x73, 0x4F, 0x44, 0x1A, 0xF5, 0xD4, 0xFA,
-    0x9F, 0x75, 0x2D, 0x1D, 0xDE, 0x52, 0xAD, 0xA5, 0xBB, 0x3F, 0x7A, 0xA8, 0x6C, 0x37, 0x13, 0x00,
-    0xC0, 0xF4, 0xC2, 0x4B, 0x30, 0xB9, 0x75, 0x99, 0x74, 0xAF, 0x66, 0x0F, 0xC6, 0xE9, 0xBD, 0xC1,
-    0x8A, 0xC3, 0xC1, 0xC5, 0xC2, 0x89, 0x53, 0x8E, 0x9C, 0xFE, 0xC5, 0x43, 0x12, 0x30, 0x7F, 0xCB,
-    0x9C, 0xF8, 0x6E, 0x30, 0xA0, 0x0F, 0xBA, 0x1D, 0x3D, 0x3F, 0xDE, 0xED, 0xDD, 0xBD, 0x8F, 0x12,
-    0x97, 0x94, 0x27, 0x0E, 0x51, 0xD4, 0x9A, 0xFF, 0xF8, 0x0D, 0x30, 0xAE, 0x1F, 0x23, 0x94, 0x6D,
-    0xAE, 0xF2, 0x04, 0xBC, 0x98, 0x43, 0x01, 0x53, 0x2D, 0x49, 0xFB, 0x57, 0xE4, 0x2C, 0x32, 0xA2,
-    0xFD, 0xE1, 0x15, 0x49, 0xDF, 0xEF, 0x3C, 0xD0, 0x3B, 0xAF, 0x13, 0xDD, 0xE8, 0xE7, 0x62, 0xD5,
-    0x85, 0xCB, 0x7D, 0xEE, 0xC6, 0xDF, 0x47, 0xBD, 0xA0, 0xEA, 0xFF, 0xC4, 0x69, 0xFC, 0x88, 0x46,
-    0x33, 0xF0, 0xA7, 0x21, 0xD9, 0x7A, 0xFA, 0x04, 0x7C, 0xEC, 0xC7, 0xA0, 0x6C, 0x95, 0x17, 0xF9,
-    0x19, 0x97, 0x7E, 0x5A, 0xEA, 0x96, 0xB4, 0xA7, 0xD8, 0x19, 0xA2, 0xCE, 0xFC, 0x84, 0xF2, 0xA6,
-    0xA1, 0xED, 0x3C, 0xE8, 0xAE, 0x16, 0xB1, 0xBB, 0x40, 0xBE, 0x0A, 0x26, 0x02, 0x93, 0xE2, 0x80,
-    0x79, 0xDB, 0xA9, 0xDF, 0x1B, 0x80, 0x95, 0xB0, 0x95, 0xA5, 0xF6, 0xF1, 0xE4, 0xD9, 0x9B, 0x3A,
-    0x9F, 0xA0, 0x9F, 0x1A, 0xF4, 0xD3, 0x85, 0x4E, 0x30, 0xE8, 0xF4, 0x2B, 0x4C, 0x33, 0xE2, 0xCF,
-    0x76, 0x83, 0x39, 0x8E, 0xC9, 0x3E, 0x1A, 0x36, 0x6F, 0x44, 0xDB, 0xF6, 0xE3, 0x9B, 0x57, 0xF2,
-    0x58, 0xF8, 0xE9, 0x4E, 0xD6, 0xF7, 0x56, 0xD0, 0x26, 0x88, 0x2C, 0xC2, 0x20, 0xE3, 0xC7, 0x18,
-    0xDA, 0x31, 0xD2, 0x80, 0xBC, 0xCC, 0xED, 0x0E, 0x3E, 0xDE, 0xFD, 0x01, 0xD8, 0xFA, 0xAD, 0x1D,
-    0x92, 0x1D, 0x8B, 0xD5, 0x4B, 0x9C, 0x58, 0x4B, 0x6F, 0x9E, 0x6F, 0xFA, 0x54, 0xA2, 0xB3, 0xEE,
-    0xFC, 0xAF, 0x2F, 0x39, 0xBF, 0x31, 0x3C, 0x57, 0x29, 0x98, 0xFA, 0xC5, 0x3B, 0x49, 0xDF, 0x03,
-    0x80, 0xA3, 0x5B, 0xA7, 0xFD, 0xA3, 0xE9, 0xD5, 0xD0, 0xED, 0x5D, 0xE8, 0xE5, 0x85, 0xF5, 0xBF,
-    0xDD, 0x7D, 0x4D, 0x8C, 0xDD, 0x56, 0x96, 0xDE, 0xE5, 0x63, 0x24, 0x22, 0x22, 0x10, 0x7A, 0x31,
-    0xEA, 0x20, 0xF2, 0x20, 0xDC, 0x76, 0x14, 0x64, 0xB8, 0x1F, 0xA4, 0x4D, 0xDA, 0x42, 0x22, 0x20,
-    0x5E, 0x48, 0x03, 0xE8, 0x59, 0x89, 0xB5, 0xF0, 0x26, 0x9B, 0xB8, 0x17, 0xB5, 0x9D, 0x85, 0x6D,
-    0x3E, 0xB7, 0x80, 0xD1, 0xC2, 0x0B, 0x15, 0x92, 0x71, 0x16, 0xC9, 0x42, 0x5A, 0xB8, 0x03, 0xF9,
-    0x19, 0x88, 0xB2, 0xC8, 0x62, 0x06, 0xB0, 0x45, 0xCA, 0x02, 0xA2, 0x85, 0x16, 0xA2, 0x5B, 0x6D,
-    0x18, 0x68, 0x2F, 0x44, 0xB7, 0x6D, 0x68, 0xC6, 0xBD, 0x10, 0x25, 0x51, 0x16, 0xAB, 0x44, 0xF2,
-    0xE6, 0xFB, 0xCE, 0xB9, 0x7C, 0xF5, 0xAA, 0xF4, 0x63, 0xB9, 0xDD, 0x9D, 0xE9, 0x8E, 0x54, 0x24,
-    0x6F, 0x91, 0xEF, 0x91, 0x97, 0xE7, 0x9E, 0x7B, 0xCE, 0x77, 0xFE, 0x6E, 0x19, 0x83, 0x7F, 0x69,
-    0x8D, 0x9D, 0x2D, 0x8D, 0xF1, 0x6D, 0x66, 0x4C, 0x34, 0xE2, 0xB7, 0xA4, 0x37, 0x4F, 0xF9, 0x77,
-    0xC8, 0x5A, 0xFB, 0x33, 0x6C, 0x6D, 0x82, 0xDD, 0x0C, 0x5B, 0x9D, 0x36, 0xFC, 0x36, 0xEF, 0xB5,
-    0xBB, 0x61, 0x07, 0x93, 0x5A, 0x5B, 0xAD, 0x35, 0xDE, 0x7D, 0xE4, 0x33, 0xF3, 0xF9, 0x71, 0x5C,
-    0xB2, 0x01, 0x6F, 0x98, 0x63, 0x77, 0x06, 0x5B, 0xCF, 0xC6, 0x55, 0x6C, 0xC3, 0xCC, 0xFA, 0xA3,
-    0x89, 0xFA, 0xA8, 0xC7, 0xA7, 0xD3, 0xC6, 0xB3, 0x97, 0x6D, 0x19, 0xD8, 0x97, 0x6D, 0x96, 0x0C,
-    0xC9, 0x60, 0xE6, 0xC7, 0xE7, 0xC7, 0x1F, 0xD3, 0x3F, 0x6F, 0xF9, 0x81, 0x6D, 0x63, 0x7C, 0xBB,
-    0x2C, 0x5C, 0x07, 0xBB, 0x70, 0x7C, 0xF7, 0xB8, 0x49, 0xF0, 0x3C, 0x53, 0xE0, 0x45, 0x67, 0x7C,
-    0x7A, 0xC8, 0x77, 0x4C, 0xEE, 0xCF, 0xCF, 0x1B, 0x7E, 0x12, 0x5D, 0xB4, 0x26, 0xC2, 0x93, 0xD9,
-    0xCF, 0xC6, 0xD8, 0xCA, 0xF5, 0x31, 0xEA, 0x5D, 0x47, 0x8D, 0xFD, 0x7A, 0x3E, 0xE7, 0xA7, 0x7A,
-    0x7C, 0xCA, 0x36, 0xEC, 0x72, 0x85, 0xCD, 0x9E, 0xC6, 0x36, 0xF2, 0x61, 0x42, 0x32, 0xEF, 0x38,
-    0xEF, 0x86, 0xB7, 0xE5, 0x93, 0x6D, 0xC9, 0xD7, 0xB0, 0xED, 0xE1, 0xA5, 0xFD, 0x66, 0xF9, 0x73,
-    0xA3, 0xCF, 0xD7, 0xE7, 0x6A, 0x17, 0xB4, 0x37, 0x7B, 0x2F, 0x5C, 0xDC, 0xE2, 0x05, 0x50, 0x15,
-    0x17, 0xD8, 0x2B, 0x13, 0xDA, 0x87, 0xF8, 0x65, 0x66, 0xCB, 0x68, 0xC0, 0x85, 0xCA, 0xD8, 0x05,
-    0xBF, 0x81, 0x1F, 0x74, 0x2E, 0xE8, 0xA5, 0x9F, 0x56, 0x46, 0x10, 0x77, 0x4B, 0x9B, 0x7D, 0x45,
-    0x8D, 0x0B, 0xBE, 0x6D, 0x79, 0x81, 0xBD, 0xB2, 0x65, 0x8A, 0xEF, 0xA5, 0x6D, 0xD4, 0xAD, 0x28,
-    0x94, 0xF2, 0xA1, 0x78, 0x74, 0x84, 0xD7, 0x0C, 0x39, 0x0A, 0xF8, 0x98, 0x37, 0x3C, 0x61, 0xB8,
-    0xF9, 0x6E, 0x7C, 0xDD, 0x63, 0xD8, 0x6E, 0x90, 0x98, 0x78, 0xBE, 0x30, 0x0D, 0x6F, 0x28, 0x44,
-    0x22, 0xF3, 0x90, 0x46, 0x24, 0x56, 0x80, 0x13, 0x1E, 0x4F, 0xE4, 0x38, 0x11, 0xEF, 0x3A, 0xD1,
-    0xE2, 0xC4, 0xC0, 0x13, 0x19, 0x4E, 0xE0, 0xC9, 0x79, 0xA7, 0x27, 0xC8, 0x52, 0x9B, 0xD8, 0xE5,
-    0xE8, 0x33, 0xC9, 0x5F, 0x73, 0x20, 0xEC, 0xC2, 0xB7, 0x55, 0x32, 0x1A, 0xBC, 0x0D, 0xBA, 0xDE,
-    0xE3, 0x1B, 0x3F, 0xC3, 0xF7, 0xC2, 0x9E, 0xCF, 0x39, 0xFC, 0x5F, 0x46, 0x79, 0x0B, 0x7C, 0x2A,
-    0xE3, 0x90, 0xB4, 0x86, 0x84, 0xCE, 0x82, 0x11, 0xBC, 0xA4, 0xEC, 0x2C, 0xAC, 0x6C, 0xD2, 0x31,
-    0xDB, 0x6F, 0xBF, 0xE4, 0x18, 0x8C, 0xA4, 0xA4, 0x0E, 0x58, 0x1F, 0x72, 0x9F, 0xF1, 0xCB, 0x35,
-    0xC9, 0x8C, 0x4E, 0x6C, 0xD8, 0xAF, 0x76, 0xBF, 0x32, 0x98, 0x71, 0x13, 0x4F, 0x44, 0x27, 0x4C,
-    0x2C, 0x23, 0x2B, 0x1F, 0x0E, 0x6D, 0xF5, 0x3C, 0x6E, 0x2A, 0x64, 0xE4, 0x0B, 0xE9, 0xCB, 0x9B,
-    0x48, 0x5E, 0x21, 0x19, 0x33, 0x79, 0x05, 0x37, 0x78, 0x95, 0x7C, 0xA7, 0xE1, 0x19, 0xBE, 0xD5,
-    0xF3, 0xD2, 0xC6, 0x83, 0xB8, 0x0F, 0xE5, 0xCB, 0xA1, 0xCD, 0x5E, 0xC0, 0xD7, 0xC0, 0xE1, 0xB5,
-    0xA7, 0xEC, 0x0A, 0xE6, 0x26, 0xEF, 0x44, 0xD2, 0x55, 0xF6, 0xB2, 0x33, 0xDE, 0x86, 0xDC, 0x50,
-    0x07, 0xAD, 0xD9, 0xF9, 0x9F, 0xEC, 0xFD, 0xDF, 0xCA, 0xFF, 0x2E, 0xD5, 0xFF, 0xBD, 0xFE, 0x3F,
-    0xB4, 0x78, 0x3D, 0x6A, 0xD3, 0x1B, 0x43, 0xD4, 0xDA, 0xD3, 0x63, 0xFE, 0x85, 0xBD, 0xD8, 0x17,
-    0xCD, 0xDE, 0xD1, 0xF5, 0x95, 0x75, 0x52, 0xE1, 0x26, 0xF7, 0x0B, 0x58, 0x0B, 0xCC, 0x48, 0x16,
-    0x2D, 0xF6, 0xFE, 0xD2, 0x9A, 0x70, 0xC0, 0x2F, 0x99, 0x8C, 0x4B, 0x47, 0x69, 0xE1, 0x83, 0x48,
-    0x78, 0xAD, 0xB4, 0xC7, 0xA8, 0xE1, 0x17, 0xBE, 0x5A, 0x51, 0x3B, 0x39, 0x42, 0x32, 0x08, 0x79,
-    0xA4, 0xD1, 0x3B, 0x46, 0x88, 0xA7, 0x46, 0xD2, 0x91, 0xDF, 0x17, 0x4A, 0x53, 0x19, 0xB2, 0xB4,
-    0xDD, 0x2B, 0x48, 0xC8, 0x46, 0x64, 0x21, 0xB9, 0x69, 0xC8, 0x9B, 0x16, 0x3B, 0x37, 0x8D, 0x37,
-    0xF3, 0x9E, 0xC3, 0x54, 0x62, 0x78, 0x3B, 0x99, 0xC2, 0x4E, 0xDC, 0x74, 0xE6, 0x47, 0xC5, 0xC4,
-    0xEE, 0xB9, 0x4C, 0x25, 0x37, 0x90, 0x1C, 0x5A, 0x2B, 0xD3, 0xCC, 0x4A, 0x57, 0xF3, 0x45, 0x40,
-    0x92, 0xC4, 0x95, 0x27, 0x17, 0xC1, 0x49, 0x46, 0xA6, 0x42, 0x2C, 0x17, 0x33, 0xB9, 0x98, 0x94,
-    0x78, 0xC6, 0x79, 0x4E, 0x14, 0x0C, 0xEC, 0x62, 0xD6, 0x73, 0x5A, 0xB6, 0xA6, 0x30, 0xE1, 0xD6,
-    0x06, 0x1E, 0x58, 0xE2, 0x44, 0x5E, 0x45, 0xB8, 0x88, 0x09, 0x81, 0x89, 0x94, 0x94, 0xB3, 0x11,
-    0xF3, 0x11, 0x9F, 0xB6, 0x0B, 0x5C, 0x1C, 0xC0, 0xEA, 0xB1, 0x30, 0x5A, 0x83, 0xB7, 0x64, 0x3F,
-    0x21, 0xB8, 0x42, 0x8A, 0x24, 0xCB, 0x4E, 0xD4, 0xCA, 0xA9, 0xC6, 0x9C, 0xD8, 0x35, 0x28, 0x2A,
-    0x7F, 0x71, 0xD3, 0x10, 0x5D, 0x4F, 0x41, 0xF7, 0x85, 0xCC, 0xF1, 0x4B, 0x72, 0x69, 0xD6, 0xED,
-    0xBA, 0x54, 0xCA, 0xA5, 0x42, 0xE4, 0x2D, 0x24, 0x8F, 0x4C, 0x1E, 0x3B, 0x0A, 0x83, 0x3B, 0x96,
-    0xB7, 0xF6, 0x0A, 0xC6, 0x76, 0x38, 0x65, 0xAF, 0x63, 0x94, 0x9B, 0x99, 0xC5, 0xB7, 0xD2, 0xD2,
-    0x1F, 0x44, 0x6E, 0x44, 0x0F, 0x7B, 0xDE, 0x33, 0xBD, 0xC9, 0x4B, 0x81, 0x5C, 0x02, 0xA1, 0xAC,
-    0xB0, 0xEF, 0x0D, 0x72, 0x84, 0x1D, 0xF1, 0xAC, 0xC8, 0x8E, 0x8B, 0xA4, 0x9C, 0xC8, 0x89, 0x77,
-    0xF1, 0xE4, 0xB6, 0x65, 0x20, 0x07, 0x23, 0xDC, 0xDB, 0xBB, 0x4B, 0x66, 0x39, 0xB7, 0x5F, 0x2F,
-    0x17, 0xD3, 0x24, 0x74, 0xF3, 0x43, 0x86, 0xD6, 0x71, 0x82, 0x11, 0xA6, 0x21, 0xD9, 0x47, 0xBD,
-    0xE5, 0xC8, 0x09, 0xE8, 0x09, 0xC7, 0xCB, 0x00, 0x51, 0x52, 0xD8, 0x51, 0xA6, 0xCF, 0xC0, 0x77,
-    0xF4, 0x38, 0x55, 0x33, 0x4A, 0x8E, 0xD9, 0x20, 0x32, 0x23, 0xC4, 0x07, 0x8B, 0xD6, 0x24, 0x14,
-    0x8B, 0x95, 0x29, 0x16, 0x9C, 0x4D, 0x64, 0x51, 0xD0, 0x96, 0x6C, 0x86, 0xB1, 0x07, 0x03, 0x61,
-    0x66, 0x91, 0x9B, 0x43, 0x4A, 0xF7, 0x5D, 0xA2, 0x4F, 0x48, 0x67, 0x8C, 0xCE, 0x5B, 0x99, 0xC8,
-    0xC2, 0x2B, 0x45, 0xB6, 0x6B, 0x66, 0x24, 0x4D, 0x48, 0xF1, 0x22, 0xCC, 0xDD, 0xE0, 0xC6, 0x3E,
-    0x74, 0xD4, 0x02, 0xE2, 0x05, 0xBF, 0xFB, 0x23, 0xE5, 0x56, 0xFE, 0x25, 0xEE, 0x1E, 0x0C, 0xE8,
-    0x87, 0x29, 0x6E, 0x8E, 0x9C, 0xD1, 0x64, 0xA9, 0x82, 0xBD, 0x8F, 0x84, 0xC9, 0x44, 0x0C, 0x44,
-    0x7C, 0x29, 0x34, 0x33, 0xBE, 0xD3, 0x20, 0xAF, 0x29, 0xAF, 0x27, 0x22, 0x9D, 0x12, 0x26, 0xD9,
-    0xB6, 0x9C, 0x38, 0xEF, 0x50, 0xF7, 0x74, 0xA9, 0x6D, 0x40, 0x1B, 0xDC, 0x28, 0xED, 0x40, 0x88,
-    0x23, 0x76, 0x21, 0xDF, 0x11, 0x5A, 0x09, 0xFD, 0xF2, 0x7A, 0x4D, 0xFA, 0xB0, 0xBF, 0xD1, 0x68,
-    0x9E, 0xF1, 0x5F, 0x20, 0x37, 0x4A, 0x2B, 0x73, 0xE0, 0x7D, 0xE8, 0x54, 0x90, 0x14, 0x92, 0x32,
-    0x1D, 0xD1, 0x0C, 0xC0, 0x9A, 0xE4, 0x50, 0x9F, 0x1A, 0x10, 0xC2, 0x05, 0xDD, 0xF2, 0x39, 0x93,
-    0xD0, 0x0C, 0xA9, 0x3F, 0x0D, 0x55, 0x7D, 0x93, 0x3C, 0xB0, 0x2F, 0xA1, 0x43, 0x39, 0xE4, 0x4C,
-    0xF1, 0x19, 0x84, 0xF1, 0xB1, 0x3E, 0xEF, 0xE2, 0xFB, 0x50, 0xD7, 0x6F, 0xDB, 0xA2, 0xC9, 0x7B,
-    0x8C, 0x57, 0x40, 0x01, 0x56, 0xB1, 0x09, 0x19, 0x5B, 0xE2, 0x8D, 0x0B, 0xE8, 0xCA, 0x86, 0x4D,
-    0x88, 0x71, 0x88, 0xB5, 0x12, 0x02, 0x14, 0x2F, 0x59, 0x0C, 0xDE, 0x05, 0x73, 0x38, 0x0B, 0x86,
-    0x93, 0x03, 0xC9, 0xD0, 0x90, 0xE1, 0x32, 0xEC, 0x40, 0xA6, 0xE7, 0xBF, 0xE3, 0x65, 0x20, 0x81,
-    0xE2, 0x06, 0x24, 0x2B, 0x3E, 0x06, 0xC5, 0x06, 0xF6, 0xB7, 0x81, 0x38, 0x2A, 0x4A, 0xE8, 0xBB,
-    0x11, 0xD2, 0x24, 0xE2, 0x48, 0xE5, 0xD0, 0x83, 0x5F, 0xE2, 0x3E, 0xF6, 0x66, 0x4B, 0x02, 0x97,
-    0xA0, 0x93, 0x8C, 0x8D, 0x10, 0x9D, 0x8A, 0x8A, 0xCF, 0xA0, 0x2E, 0x52, 0xCC, 0x23, 0x70, 0xA7,
-    0x25, 0xDB, 0x95, 0xE4, 0x39, 0xF2, 0x77, 0xC3, 0x31, 0x22, 0xB7, 0xF1, 0x2B, 0xDB, 0x8A, 0x90,
-    0x20, 0x42, 0x31, 0xF6, 0x37, 0x78, 0xDF, 0x63, 0x1D, 0x9E, 0xFD, 0x03, 0x4F, 0x7D, 0x3A, 0x2F,
-    0xA8, 0x4A, 0x45, 0xA7, 0x0E, 0x9C, 0xA9, 0xAD, 0x4C, 0x56, 0x13, 0xD7, 0x22, 0x93, 0xC0, 0x25,
-    0xEC, 0x57, 0x40, 0xCE, 0x91, 0x53, 0x07, 0x65, 0xA8, 0x5B, 0xD5, 0x4D, 0x3A, 0x81, 0x64, 0x36,
-    0x5A, 0x65, 0x5C, 0xAB, 0xEA, 0x90, 0x53, 0x2B, 0x7E, 0x48, 0xD9, 0x11, 0x75, 0x3C, 0x25, 0x4F,
-    0x03, 0x11, 0x04, 0x59, 0x60, 0x9C, 0x70, 0x93, 0xBC, 0xA2, 0x64, 0xC5, 0xC0, 0xF6, 0x14, 0xC8,
-    0x1E, 0xFA, 0x06, 0x02, 0xE2, 0x14, 0x90, 0xD9, 0x6B, 0x83, 0x4C, 0x41, 0x92, 0xD7, 0xBA, 0x61,
-    0x01, 0x3D, 0x44, 0x71, 0x96, 0x22, 0x53, 0x5A, 0xF2, 0x7F, 0x34, 0xCE, 0x84, 0xA6, 0x25, 0x67,
-    0x67, 0xD1, 0x8A, 0x0E, 0xB7, 0xFC, 0xC6, 0xB7, 0xF8, 0xC4, 0x3B, 0x90, 0x02, 0x04, 0x33, 0x39,
-    0xA7, 0xAC, 0x21, 0x38, 0x31, 0xF1, 0xFD, 0x8C, 0x5A, 0x11, 0x77, 0x1E, 0x55, 0x96, 0xCC, 0x7A,
-    0xC8, 0x1E, 0x74, 0x2F, 0xFA, 0x12, 0xFC, 0x7E, 0xB6, 0x09, 0xC6, 0x54, 0xDF, 0xFE, 0x0A, 0xAF,
-    0x12, 0x4B, 0xDA, 0xBF, 0xD3, 0xB1, 0x56, 0x14, 0x55, 0x5E, 0xC2, 0x90, 0x5F, 0x32, 0x7E, 0xBB,
-    0xB3, 0x85, 0x0D, 0xD1, 0x51, 0x41, 0x06, 0xD3, 0xCF, 0x54, 0x38, 0xD7, 0x5D, 0x32, 0xB3, 0x1E,
-    0xF2, 0x71, 0xD4, 0xCD, 0x1F, 0x8B, 0xF9, 0xC5, 0x11, 0xD7, 0x06, 0x6C, 0x3D, 0xB6, 0x96, 0xB2,
-    0x7B, 0x42, 0x0D, 0x91, 0x83, 0x32, 0x7C, 0xEE, 0xB8, 0x82, 0x32, 0xE3, 0x1E, 0x28, 0xE3, 0x3F,
-    0x19, 0xCA, 0x34, 0x7B, 0xA1, 0x4C, 0xAB, 0xC2, 0x2C, 0x90, 0x39, 0xA9, 0xAA, 0x26, 0xB7, 0xCA,
-    0x49, 0x22, 0x82, 0x28, 0x0F, 0x92, 0x86, 0x04, 0x29, 0x16, 0x31, 0x44, 0xD3, 0x48, 0x1A, 0x85,
-    0x1D, 0xA9, 0x94, 0xD6, 0x3C, 0x8D, 0x99, 0x0E, 0xC4, 0x36, 0x60, 0x80, 0x30, 0xCE, 0x1E, 0x27,
-    0x44, 0xC5, 0x09, 0x6B, 0xB3, 0xD5, 0xE9, 0xB8, 0xE5, 0x70, 0x41, 0xE6, 0x8E, 0x9C, 0xF4, 0x49,
-    0x27, 0xB2, 0x57, 0xA0, 0xA7, 0xED, 0x44, 0xD8, 0xD7, 0x22, 0x8C, 0x5F, 0x12, 0x59, 0xCC, 0xEF,
-    0xA6, 0x0D, 0x5F, 0x0B, 0x5A, 0xA8, 0x76, 0x73, 0xDF, 0x78, 0x17, 0xA9, 0x7F, 0xDC, 0x87, 0x9A,
-    0x44, 0xC6, 0xE4, 0x51, 0xD4, 0xAE, 0x44, 0xAA, 0xF6, 0xC0, 0xF7, 0xAD, 0xE3, 0x7B, 0x3F, 0x73,
-    0x5F, 0x01, 0x71, 0x43, 0xB1, 0x7F, 0x94, 0xBD, 0x98, 0x50, 0xBB, 0xC0, 0xF7, 0x0A, 0x12, 0x26,
-    0xE2, 0x0F, 0xBA, 0xD0, 0x44, 0xB6, 0x02, 0x40, 0x00, 0x48, 0x40, 0x83, 0x2C, 0x93, 0x50, 0x1C,
-    0x90, 0x83, 0x22, 0x1B, 0x42, 0x6A, 0x54, 0xA4, 0xDC, 0xCB, 0x60, 0x01, 0xB1, 0x42, 0xAE, 0xDA,
-    0x6B, 0xC2, 0xD0, 0xF6, 0x96, 0xBD, 0x2E, 0x02, 0xA1, 0x78, 0x00, 0xE8, 0x32, 0x8D, 0x9D, 0x4C,
-    0x82, 0x58, 0xC1, 0x95, 0x2A, 0xBB, 0x52, 0x27, 0x84, 0x1B, 0xDF, 0x99, 0x2A, 0x78, 0xD5, 0x27,
-    0x13, 0x9A, 0x73, 0xEA, 0x66, 0xFA, 0x56, 0xE1, 0xF0, 0xFA, 0x4C, 0xD5, 0x97, 0x88, 0x6E, 0x99,
-    0x7F, 0x78, 0xC2, 0x03, 0x7B, 0x93, 0xCF, 0xB0, 0xE8, 0xC4, 0x35, 0x4B, 0xA9, 0x8F, 0x1E, 0x7E,
-    0x6C, 0x45, 0x10, 0x8B, 0x54, 0xAB, 0x73, 0xDB, 0xF1, 0x75, 0x6C, 0xB7, 0x1F, 0x90, 0x44, 0x71,
-    0x47, 0x17, 0x7D, 0x43, 0x2D, 0x90, 0xA8, 0x46, 0xE6, 0xDC, 0x8D, 0x5B, 0x9C, 0x5E, 0x44, 0xD0,
-    0x6B, 0x29, 0x04, 0xFD, 0x2B, 0xC4, 0x5D, 0xBC, 0x2A, 0x13, 0xE3, 0x39, 0xCC, 0xB9, 0xBF, 0xF5,
-    0x8A, 0xBB, 0x96, 0xCF, 0x10, 0x68, 0x4A, 0x86, 0x06, 0x38, 0xDC, 0xE4, 0x30, 0x73, 0xDA, 0x1A,
-    0xB3, 0xDC, 0xC4, 0xA8, 0xC5, 0x94, 0xCE, 0xBE, 0x08, 0xEA, 0x9C, 0x76, 0x50, 0x48, 0x91, 0x6C,
-    0x44, 0x3A, 0x27, 0x6C, 0xFA, 0xD2, 0x2C, 0x30, 0x92, 0x20, 0x30, 0xC6, 0x74, 0x26, 0xD2, 0x39,
-    0xA5, 0xA0, 0x7E, 0x79, 0xC8, 0xBB, 0xA4, 0x05, 0x29, 0xDF, 0xB6, 0xAF, 0x75, 0x10, 0xD4, 0x0F,
-    0xAD, 0x48, 0xE7, 0x9A, 0xD2, 0x79, 0x90, 0x66, 0x49, 0xE9, 0xDC, 0xCA, 0x2B, 0x19, 0x36, 0xEB,
-    0x49, 0x3A, 0xAB, 0xA0, 0x36, 0x9E, 0x10, 0xBC, 0x8C, 0x1B, 0xC1, 0x00, 0xCA, 0x12, 0xA4, 0xA9,
-    0xA8, 0x68, 0x0E, 0xCB, 0xFE, 0xF7, 0xFF, 0xA8, 0x94, 0x0E, 0x6E, 0x89, 0x31, 0xC2, 0x9C, 0xA0,
-    0xB2, 0x25, 0x6A, 0x80, 0xAA, 0x80, 0x40, 0x1E, 0xC9, 0xA0, 0xE9, 0x17, 0xF8, 0x1D, 0x92, 0x88,
-    0xB3, 0xF6, 0x73, 0x9A, 0x19, 0x03, 0x21, 0x63, 0x41, 0x1E, 0x09, 0x45, 0x73, 0x5B, 0xE5, 0x55,
-    0x41, 0x9D, 0xE4, 0xA5, 0x88, 0x2C, 0xE2, 0x09, 0xC7, 0xC4, 0x56, 0x84, 0x00, 0x49, 0x42, 0x74,
-    0x47, 0x03, 0x8E, 0xC2, 0xB3, 0x2B, 0x08, 0x3B, 0x4E, 0x13, 0x92, 0x82, 0x5D, 0x60, 0x8F, 0x2D,
-    0x60, 0xDE, 0xA4, 0x9D, 0x7C, 0x87, 0x36, 0x01, 0xB9, 0xB3, 0x22, 0x67, 0x66, 0x31, 0xA7, 0x57,
-    0x7E, 0x7F, 0x83, 0xD3, 0x3B, 0xAF, 0x82, 0x11, 0x93, 0x3F, 0xEE, 0x40, 0xB7, 0xA2, 0x8A, 0x5B,
-    0x20, 0xED, 0xBC, 0x0A, 0xD1, 0xF7, 0x2C, 0xA1, 0xA6, 0x03, 0xD0, 0x6D, 0x39, 0xE2, 0x55, 0xD4,
-    0xE3, 0x54, 0x3A, 0x9D, 0x82, 0x44, 0x00, 0xC8, 0x04, 0x23, 0x1E, 0xC5, 0x7C, 0x1B, 0x12, 0x5C,
-    0x69, 0xD1, 0x75, 0x48, 0xB8, 0x85, 0x60, 0x84, 0x7D, 0x27, 0xF8, 0x62, 0x96, 0xC0, 0x25, 0x40,
-    0x8F, 0x6A, 0xD8, 0x2A, 0xA0, 0x8B, 0xA1, 0x55, 0x97, 0x81, 0xA5, 0x04, 0x35, 0x5F, 0xB1, 0x00,
-    0xAA, 0x90, 0x8B, 0xEC, 0x6B, 0xCA, 0x29, 0xDD, 0xD8, 0x02, 0x96, 0xD3, 0x95, 0xC1, 0xDE, 0xDC,
-    0xB6, 0x11, 0x64, 0xFB, 0xCD, 0x3E, 0xFF, 0xCC, 0xDA, 0xF4, 0x8E, 0x3D, 0x0B, 0x03, 0xF0, 0x2A,
-    0x98, 0xF6, 0x86, 0x8D, 0x31, 0xE1, 0xA3, 0x3E, 0xAF, 0x21, 0x7E, 0xEE, 0x60, 0x6C, 0x2A, 0x9C,
-    0x0E, 0x30, 0x88, 0x71, 0xB7, 0xEF, 0x04, 0x4F, 0x83, 0xAC, 0x77, 0x38, 0x37, 0x71, 0x5A, 0x24,
-    0x06, 0xB5, 0x2C, 0x66, 0x52, 0x06, 0xD9, 0xEA, 0x9A, 0x0B, 0x36, 0x3B, 0xD7, 0x8C, 0x7B, 0xE0,
-    0x63, 0x0F, 0x1D, 0xD9, 0xDD, 0x1C, 0x52, 0xDA, 0x7E, 0x37, 0xA8, 0x9D, 0xA7, 0xE6, 0xA7, 0xF3,
-    0x0D, 0xD1, 0x99, 0x22, 0xC2, 0xED, 0x28, 0xCD, 0x2F, 0x1F, 0x69, 0xD2, 0x66, 0x21, 0x40, 0x4B,
-    0x6D, 0x4A, 0x18, 0x7B, 0x8F, 0x23, 0x6E, 0x73, 0x4E, 0x68, 0x0C, 0xE5, 0x06, 0xAD, 0x35, 0x4F,
-    0xE0, 0xF2, 0x4C, 0x84, 0x82, 0x48, 0x02, 0xEC, 0xA1, 0xE3, 0x6A, 0xA2, 0x4D, 0xE0, 0xBD, 0x82,
-    0x67, 0x4B, 0x51, 0x97, 0x2D, 0x1D, 0x22, 0xE1, 0x18, 0x09, 0x7C, 0xBB, 0xA2, 0x52, 0x90, 0xAF,
-    0x16, 0xF5, 0x2A, 0x0D, 0x5F, 0x13, 0x05, 0xFB, 0x99, 0x5C, 0x68, 0xE5, 0xC2, 0xA0, 0x17, 0xC8,
-    0x5C, 0x33, 0x7C, 0xA3, 0xC6, 0xF7, 0x40, 0xE8, 0xBF, 0x3E, 0x05, 0xFD, 0x28, 0xDD, 0xF3, 0x45,
-    0xE0, 0x64, 0xC5, 0x8E, 0x76, 0xAD, 0xC4, 0x73, 0x50, 0x8B, 0x28, 0xAA, 0x68, 0x31, 0x6E, 0x67,
-    0xBB, 0x2D, 0xD2, 0x1D, 0xAF, 0x88, 0x36, 0x80, 0x82, 0x7B, 0xC8, 0x8B, 0x7C, 0x6A, 0x14, 0xDF,
-    0xD9, 0xC0, 0x7C, 0xC3, 0x58, 0x3C, 0xDA, 0x88, 0x06, 0x34, 0xEC, 0x67, 0x3C, 0x73, 0x60, 0xF9,
-    0xBE, 0x4C, 0xF5, 0x05, 0x7B, 0x43, 0xC9, 0x6F, 0x2B, 0xAA, 0xA3, 0x12, 0x33, 0xD8, 0x66, 0xC0,
-    0xD8, 0x63, 0xC0, 0x3B, 0xC5, 0x9C, 0x48, 0xF9, 0xD7, 0xA7, 0xC4, 0x62, 0x1D, 0x43, 0xA7, 0x4C,
-    0xEC, 0x82, 0xE6, 0x34, 0x29, 0x09, 0xB6, 0x82, 0x30, 0x13, 0x4B, 0x99, 0x13, 0x49, 0xC0, 0x4A,
-    0x24, 0xD4, 0x11, 0x42, 0x35, 0xEB, 0xA7, 0xF2, 0x75, 0x5F, 0xD3, 0x86, 0x7D, 0x4F, 0x14, 0xA7,
-    0x5A, 0x21, 0x93, 0x1F, 0x40, 0xCC, 0x2D, 0xFB, 0xCD, 0xC5, 0x2C, 0x22, 0x65, 0x66, 0x22, 0xC3,
-    0x53, 0x35, 0xE6, 0x28, 0xD7, 0x29, 0x7A, 0xF5, 0x5E, 0x72, 0xEB, 0xC7, 0x34, 0x3B, 0x69, 0x56,
-    0x32, 0x7B, 0x7F, 0xB9, 0xEF, 0x7F, 0x07, 0x2B, 0x0F, 0x40, 0x2B, 0xE3, 0x9E, 0x45, 0x62, 0x7A,
-    0xA4, 0xD6, 0xBD, 0x77, 0xA7, 0xB6, 0xBF, 0x98, 0x33, 0x77, 0x64, 0xA0, 0xAE, 0xCA, 0x5E, 0xCD,
-    0x1C, 0x67, 0xE5, 0xEC, 0x72, 0x01, 0xA8, 0x76, 0x6A, 0x56, 0xD8, 0x5C, 0x41, 0x5A, 0x2C, 0xA7,
-    0x09, 0x16, 0x14, 0x36, 0x3C, 0xE9, 0x74, 0x28, 0xA8, 0x21, 0x11, 0x51, 0x29, 0x2F, 0x33, 0x93,
-    0xBE, 0xEE, 0x3D, 0xFD, 0xFA, 0xC2, 0x1C, 0x38, 0x3F, 0xA1, 0x5F, 0xCA, 0xD0, 0x5D, 0xE8, 0xB7,
-    0x05, 0xFA, 0xCD, 0x89, 0x7E, 0xED, 0x97, 0x14, 0xB4, 0x37, 0xE9, 0xFF, 0xA1, 0x7D, 0x42, 0xC1,
-    0x14, 0xFD, 0x10, 0xF4, 0xAB, 0xFF, 0x0E, 0x58, 0xBB, 0x25, 0xBC, 0x09, 0xC9, 0x73, 0x71, 0xBC,
-    0xD8, 0xA4, 0x19, 0x98, 0xE2, 0x0C, 0x04, 0x91, 0xD7, 0x7F, 0x88, 0x7B, 0x45, 0xD7, 0x6A, 0x36,
-    0xF3, 0x85, 0x2D, 0xF3, 0xAB, 0x3B, 0x90, 0x24, 0x13, 0x9E, 0x16, 0xE6, 0xE5, 0x1D, 0xFE, 0x7E,
-    0x32, 0x00, 0xC5, 0x26, 0xF4, 0x14, 0xB0, 0x3E, 0xBE, 0x39, 0x2A, 0x55, 0xA3, 0x3E, 0x10, 0xE4,
-    0x44, 0x37, 0x01, 0x99, 0xB4, 0x12, 0x3F, 0x57, 0x43, 0xB9, 0x96, 0xD2, 0x84, 0xC6, 0x77, 0x62,
-    0x91, 0xD2, 0xB9, 0xB8, 0x10, 0x38, 0x2E, 0x33, 0xEB, 0x46, 0x7A, 0x21, 0xD6, 0xAA, 0x8C, 0xCC,
-    0x68, 0x56, 0x6D, 0xC1, 0x0B, 0x33, 0xF1, 0x09, 0x04, 0xD6, 0xD9, 0x6A, 0x84, 0x26, 0x36, 0xE7,
-    0xEB, 0x53, 0x7A, 0x1A, 0x4A, 0x41, 0x08, 0x6F, 0x68, 0x11, 0x2A, 0x45, 0xDF, 0xB6, 0xF8, 0xD5,
-    0x13, 0x71, 0x69, 0x20, 0x58, 0x40, 0x61, 0xFC, 0xF7, 0x7B, 0x58, 0xCD, 0x51, 0x43, 0x93, 0xA3,
-    0x5C, 0x9D, 0x0A, 0x78, 0x2A, 0xE6, 0x29, 0x8E, 0x83, 0xB7, 0x7E, 0x2A, 0xC7, 0x29, 0x8F, 0xA7,
-    0x02, 0x9E, 0x8A, 0x1B, 0x4C, 0xA1, 0xBC, 0xCA, 0x01, 0x92, 0x5E, 0xB4, 0x30, 0x85, 0x84, 0x23,
-    0x5F, 0xA3, 0x31, 0x90, 0x4F, 0x3C, 0x77, 0x75, 0x82, 0x26, 0x9D, 0xF3, 0xD1, 0x12, 0x14, 0x12,
-    0xAD, 0xAF, 0x2C, 0xD9, 0xCC, 0xEF, 0x65, 0x33, 0xBA, 0xE5, 0xD8, 0xDE, 0xC2, 0xF6, 0x26, 0xB6,
-    0x8F, 0x64, 0x0B, 0xFA, 0x02, 0x04, 0x2C, 0x16, 0x39, 0x79, 0x96, 0x3E, 0x3C, 0x2A, 0x4C, 0xA8,
-    0xA2, 0x3B, 0xBD, 0x39, 0x38, 0xC3, 0x3B, 0xCB, 0x36, 0xAC, 0x6F, 0x79, 0x75, 0x30, 0x83, 0x40,
-    0xF1, 0xC7, 0x00, 0x62, 0x23, 0xAD, 0xBF, 0xB3, 0x99, 0x5E, 0x05, 0xEF, 0xE1, 0xD1, 0xE5, 0xDE,
-    0xE6, 0x6C, 0x60, 0x33, 0xA9, 0x1E, 0xD3, 0x5C, 0xBD, 0xDC, 0x23, 0xCD, 0xF2, 0xF5, 0x4D, 0x72,
-    0xB9, 0x3C, 0xA3, 0x7C, 0xCC, 0xBE, 0x7C, 0xF2, 0x3E, 0x7D, 0xEC, 0x1E, 0x0F, 0x7D, 0xF2, 0x9E,
-    0x4F, 0xDC, 0x96, 0xBD, 0x95, 0xFD, 0x28, 0x7B, 0x19, 0x00, 0x75, 0xE6, 0xAA, 0x43, 0x56, 0xE7,
-    0xB6, 0x3A, 0x4F, 0xD5, 0x06, 0xDF, 0x77, 0x7C, 0xFE, 0xEA, 0x79, 0x72, 0x4C, 0xEF, 0x0C, 0x7D,
-    0x5F, 0x31, 0xA8, 0x38, 0x8B, 0x3C, 0x9D, 0xDC, 0xF2, 0xE9, 0x9D, 0x93, 0xF4, 0x1F, 0x51, 0xAE,
-    0x89, 0x3F, 0xB1, 0x33, 0xC1, 0xD6, 0x4F, 0x2D, 0xBD, 0x4C, 0xE0, 0xE8, 0x3C, 0xC3, 0x00, 0xC7,
-    0x15, 0xD0, 0x49, 0xD0, 0x02, 0xAB, 0x7B, 0x03, 0xB5, 0x8F, 0x38, 0x0D, 0x05, 0x4D, 0x84, 0x0A,
-    0x29, 0xC4, 0x83, 0xB5, 0xE3, 0x4B, 0x99, 0x9C, 0x46, 0x45, 0x25, 0x6E, 0xA3, 0xA4, 0x95, 0xE7,
-    0x85, 0x83, 0x3C, 0x71, 0x66, 0x8F, 0x8A, 0x20, 0xCA, 0x3F, 0xE9, 0xB5, 0xCF, 0xB9, 0x02, 0x31,
-    0xB9, 0xE8, 0x3D, 0x72, 0x91, 0xE6, 0x16, 0x2E, 0x5A, 0xD1, 0x51, 0x47, 0x05, 0xC7, 0xE4, 0x5F,
-    0x8C, 0xAF, 0x52, 0x20, 0x74, 0x39, 0x90, 0x08, 0x70, 0x11, 0xBA, 0x47, 0x91, 0x72, 0xA6, 0xA5,
-    0x01, 0x5E, 0xDC, 0x19, 0xC8, 0x8E, 0x49, 0x9F, 0x67, 0x39, 0xFB, 0x27, 0xF0, 0xC5, 0x17, 0x24,
-    0x8B, 0xC9, 0x75, 0x57, 0xB1, 0x22, 0x2C, 0x2E, 0x3A, 0xA9, 0xA4, 0x9B, 0xA4, 0x08, 0xA9, 0xC0,
-    0xE7, 0xE7, 0x8F, 0xFE, 0x0A, 0xD2, 0x80, 0xFB, 0x3B, 0xD2, 0x25, 0xFF, 0xAF, 0xBC, 0x79, 0x7E,
-    0x0B, 0xCF, 0x39, 0x07, 0x8A, 0xE4, 0x59, 0xB4, 0x05, 0x72, 0xDC, 0xC2, 0x78, 0x6C, 0xE0, 0x6A,
-    0x21, 0x51, 0x07, 0x12, 0xE2, 0xD5, 0xE3, 0x82, 0xE1, 0x6B, 0x21, 0x69, 0x25, 0xB0, 0x1E, 0x5A,
-    0x62, 0x73, 0x63, 0xA0, 0x7C, 0xC8, 0x9B, 0x98, 0x14, 0x7B, 0xC9, 0x72, 0xE8, 0x0E, 0x6F, 0x3A,
-    0x1F, 0x3B, 0xD4, 0x56, 0x24, 0xEA, 0x55, 0x8C, 0x5A, 0x6D, 0xCE, 0xE7, 0xA7, 0xC6, 0x95, 0x4F,
-    0x25, 0x1A, 0x73, 0xFA, 0xE5, 0x04, 0x52, 0x88, 0xBB, 0x9B, 0xA0, 0x9F, 0xC8, 0x5E, 0xA6, 0x21,
-    0x99, 0x82, 0x5E, 0x40, 0x4A, 0xC7, 0x82, 0x63, 0x29, 0xFF, 0x0E, 0xE2, 0x39, 0x9B, 0x98, 0x44,
-    0x40, 0xE0, 0x21, 0x11, 0x78, 0x93, 0x30, 0xE2, 0xD0, 0x14, 0xBE, 0x7D, 0xB1, 0xF8, 0x05, 0x41,
-    0x4E, 0xF1, 0x0E, 0xBD, 0x15, 0x36, 0xB9, 0x02, 0x30, 0xD2, 0x17, 0xB7, 0x81, 0xBF, 0xBE, 0x25,
-    0xAB, 0xC4, 0x9F, 0x0B, 0x95, 0x37, 0xA8, 0x68, 0x60, 0xA3, 0x4E, 0xA7, 0x93, 0xCF, 0x6B, 0x7E,
-    0x7A, 0xE3, 0x34, 0x0C, 0x87, 0xFE, 0xAD, 0xC8, 0x3E, 0xB4, 0x77, 0xC4, 0x58, 0x3B, 0x5A, 0xCB,
-    0xD4, 0xA5, 0x3E, 0xAA, 0xDE, 0x42, 0x57, 0x06, 0xAF, 0x05, 0x3C, 0xC8, 0xC4, 0x9C, 0xA3, 0x6B,
-    0x0E, 0x3B, 0xB1, 0x35, 0xED, 0xA7, 0xAF, 0x35, 0x1E, 0x3D, 0x8F, 0x98, 0xCB, 0x61, 0x2B, 0x3B,
-    0x5F, 0x5A, 0x23, 0x77, 0x96, 0x92, 0xC4, 0x6E, 0x5F, 0xEC, 0xD4, 0xE9, 0x9D, 0x38, 0x8D, 0xC7,
-    0xDE, 0x13, 0x2C, 0x7E, 0x52, 0x40, 0xB0, 0x2F, 0x52, 0x48, 0x87, 0x2C, 0xA5, 0xCC, 0x4D, 0x01,
-    0xA7, 0xC5, 0x5E, 0xC3, 0xAF, 0x31, 0x76, 0x02, 0x2B, 0x01, 0xBB, 0xB2, 0x7C, 0x38, 0xBC, 0x34,
-    0x87, 0x2F, 0x08, 0x01, 0x9E, 0xEF, 0x04, 0xF4, 0x2E, 0xC8, 0x3D, 0xD1, 0x56, 0xD1, 0x07, 0x40,
-    0xA7, 0x7E, 0x07, 0x59, 0x07, 0x6A, 0x37, 0x29, 0xE4, 0x49, 0x0C, 0x6D, 0xF5, 0x32, 0x0C, 0x99,
-    0x2F, 0x5A, 0x13, 0x74, 0x6F, 0x81, 0x5C, 0x31, 0x40, 0xC3, 0x15, 0xAB, 0x16, 0x8F, 0x44, 0x52,
-    0x5E, 0xB4, 0xB6, 0xA8, 0xC2, 0x71, 0x07, 0xEB, 0xEC, 0x23, 0x0B, 0x63, 0xC8, 0xF6, 0x77, 0x66,
-    0x3F, 0x28, 0x0F, 0xDE, 0xA8, 0x05, 0xA8, 0x71, 0xF6, 0xD0, 0xD9, 0x35, 0x13, 0x3F, 0x31, 0x51,
-    0xC5, 0xB0, 0xD1, 0xF1, 0xAC, 0x18, 0xC2, 0x8D, 0x86, 0x8E, 0xBE, 0x2E, 0x60, 0x20, 0x90, 0x65,
-    0x80, 0xD6, 0xA0, 0x8E, 0xF3, 0x7B, 0xBC, 0x01, 0x1A, 0xC5, 0xAF, 0x6D, 0x95, 0x88, 0x67, 0x9D,
-    0x23, 0xD4, 0x4D, 0xD1, 0x1E, 0x4E, 0x47, 0xE8, 0x8A, 0x7D, 0x74, 0x51, 0xF0, 0x29, 0x6D, 0xB0,
-    0x7D, 0xB1, 0x8D, 0xCB, 0xB0, 0xCE, 0x4D, 0xFC, 0x76, 0x6F, 0x28, 0x96, 0x9B, 0x58, 0x91, 0xC0,
-    0x65, 0x10, 0xEA, 0x0C, 0x6E, 0x14, 0x97, 0xB3, 0x3E, 0x9F, 0x6F, 0xDC, 0x71, 0x92, 0x2B, 0x96,
-    0x47, 0x6F, 0x91, 0x92, 0x5B, 0xF8, 0x95, 0xBC, 0x7A, 0x73, 0x5C, 0x2E, 0x73, 0x9A, 0x4A, 0x0B,
-    0x4C, 0x1D, 0xF0, 0x79, 0x27, 0xBA, 0xDE, 0x13, 0x5D, 0xAC, 0xCA, 0x7F, 0xFD, 0xD7, 0x41, 0xD4,
-    0xB1, 0xB7, 0xDC, 0x54, 0x63, 0xB6, 0xDC, 0xBB, 0x8B, 0xEB, 0xC2, 0xED, 0x12, 0xD9, 0x55, 0x0C,
-    0xF2, 0xAC, 0x76, 0x45, 0x89, 0x1D, 0x54, 0x2E, 0xB4, 0x55, 0x96, 0x97, 0xA7, 0xEC, 0xBB, 0xC5,
-    0xD7, 0x22, 0xBF, 0xD2, 0x09, 0x0D, 0x0F, 0x64, 0xA0, 0x3E, 0xA6, 0x0F, 0x9F, 0x6E, 0xDC, 0xEE,
-    0xC0, 0x79, 0x73, 0xE0, 0x3D, 0xF3, 0xFC, 0x16, 0xC7, 0x4D, 0x3D, 0x6F, 0x69, 0x1B, 0x53, 0x3F,
-    0x0D, 0xD1, 0xF6, 0x52, 0x46, 0xE6, 0xCE, 0x24, 0x04, 0x37, 0xB6, 0x4E, 0x88, 0x07, 0x47, 0xF4,
-    0x4E, 0x0A, 0x46, 0xA2, 0xF6, 0x2F, 0xAD, 0x92, 0x04, 0x1C, 0x03, 0x1E, 0xDE, 0x4F, 0xBF, 0xED,
-    0x72, 0xF3, 0xD0, 0xD2, 0xBC, 0x7E, 0x1E, 0x93, 0x07, 0x18, 0x97, 0x02, 0x2A, 0xC5, 0x64, 0x26,
-    0xBE, 0x83, 0x26, 0x07, 0x71, 0x1A, 0x6A, 0xE7, 0xC8, 0x8A, 0xE4, 0x4A, 0x3B, 0x40, 0x72, 0x7A,
-    0xB7, 0xEC, 0xB5, 0x31, 0xD7, 0x50, 0x48, 0x71, 0x7B, 0x98, 0x2C, 0xFB, 0x85, 0x8B, 0x36, 0x69,
-    0x34, 0xCC, 0x3A, 0xC7, 0x67, 0xBA, 0x63, 0xD7, 0x77, 0x53, 0x3C, 0xAA, 0x9E, 0x1C, 0xD1, 0x9C,
-    0xDA, 0x02, 0xA8, 0x33, 0x67, 0xC3, 0x8B, 0xA9, 0x31, 0x62, 0xEA, 0xD0, 0x54, 0x80, 0x46, 0x7D,
-    0x4D, 0xA0, 0xE3, 0x2F, 0xE8, 0xFE, 0x81, 0xC9, 0xDE, 0x26, 0x14, 0x21, 0x0B, 0xF3, 0x1C, 0x14,
-    0xFD, 0xCC, 0x0E, 0xFF, 0xD8, 0x7C, 0x68, 0x0C, 0x66, 0x5F, 0x79, 0xA8, 0x30, 0xF4, 0xBB, 0x82,
-    0x51, 0x21, 0x4D, 0xFE, 0x2A, 0x83, 0x75, 0xD3, 0x72, 0x78, 0xC7, 0xFD, 0x76, 0x33, 0x5F, 0x40,
-    0x2A, 0x62, 0xA6, 0x74, 0xF9, 0x22, 0xB4, 0x67, 0xC0, 0x5B, 0x68, 0xA4, 0x68, 0x84, 0x6C, 0x80,
-    0xE5, 0xBA, 0xF4, 0x41, 0x97, 0x5F, 0x1B, 0xF2, 0x33, 0xBD, 0xBD, 0x0A, 0x2D, 0xD6, 0x00, 0xFD,
-    0x8C, 0x00, 0xD6, 0xE0, 0xB3, 0xAB, 0x90, 0x0A, 0x3D, 0x40, 0x05, 0x1A, 0x80, 0x68, 0x18, 0x64,
-    0xFB, 0x7F, 0x96, 0xE6, 0xC0, 0x05, 0x35, 0xAB, 0x83, 0x36, 0xF9, 0x7A, 0x83, 0xA0, 0xB9, 0x8E,
-    0x24, 0xFA, 0x88, 0x7E, 0xBF, 0xFE, 0xD7, 0x8F, 0xB5, 0xA0, 0x23, 0x89, 0xD3, 0x05, 0x5D, 0x54,
-    0x45, 0x5D, 0x08, 0x2B, 0x2F, 0xAC, 0x30, 0x35, 0x6B, 0x6E, 0x98, 0x6F, 0xF5, 0xD8, 0x07, 0x77,
-    0xB7, 0xFB, 0xE0, 0xDE, 0xDD, 0x3E, 0x78, 0xF8, 0x25, 0xF8, 0xF5, 0xCA, 0xE0, 0xCB, 0x76, 0x04,
-    0x16, 0x06, 0xD4, 0x31, 0x5A, 0x78, 0x52, 0x33, 0xEB, 0x23, 0x90, 0x01, 0x3A, 0x2C, 0xBD, 0x06,
-    0x38, 0x72, 0x0F, 0xF2, 0xFA, 0x21, 0x85, 0xB5, 0x55, 0x4C, 0x14, 0xD3, 0xE2, 0xC5, 0x3C, 0x98,
-    0x89, 0x04, 0x27, 0x5B, 0xDC, 0x04, 0x24, 0x6E, 0x30, 0x4D, 0x30, 0x43, 0x2F, 0x63, 0x54, 0x87,
-    0x99, 0xCC, 0x1B, 0x74, 0xB7, 0x0F, 0x9B, 0x7C, 0xD6, 0xC7, 0x65, 0x11, 0x34, 0xC9, 0xDB, 0xEC,
-    0x82, 0xDF, 0x25, 0xE5, 0x10, 0x36, 0xE9, 0x4B, 0x7D, 0x54, 0x15, 0x7E, 0x93, 0x5C, 0xED, 0xC3,
-    0x7B, 0xD6, 0xEF, 0x2D, 0xE3, 0x11, 0x32, 0x4D, 0xD3, 0x8A, 0x82, 0xF3, 0x08, 0x6E, 0x88, 0xE9,
-    0x07, 0xEB, 0x28, 0x85, 0x98, 0xA9, 0x29, 0x56, 0x4F, 0x83, 0x56, 0xB0, 0x43, 0x6F, 0x80, 0x8E,
-    0xC5, 0xF5, 0xDB, 0x5F, 0x0C, 0xD0, 0xC2, 0x67, 0xBE, 0xB5, 0x83, 0x8D, 0x3F, 0xB3, 0xB7, 0xFA,
-    0xFC, 0xAC, 0x7D, 0xED, 0xCE, 0x98, 0xF4, 0xC5, 0xD5, 0x2E, 0xBD, 0x6B, 0x93, 0xC6, 0xBE, 0xDC,
-    0x17, 0x97, 0x7B, 0x34, 0x89, 0x5B, 0x0F, 0x2D, 0xCC, 0xE1, 0x23, 0x3D, 0x04, 0x0A, 0x8C, 0x92,
-    0xFC, 0xCA, 0x00, 0x26, 0xDD, 0xDD, 0xA0, 0x1D, 0x43, 0xDF, 0x82, 0x36, 0xD4, 0xB5, 0x68, 0x57,
-    0x8D, 0x21, 0x05, 0xA3, 0xDF, 0xB0, 0x6A, 0xA2, 0xD1, 0x66, 0x03, 0x67, 0x3E, 0x3F, 0x68, 0xF4,
-    0x31, 0xE7, 0x7C, 0x18, 0x8B, 0x86, 0x26, 0x35, 0xA8, 0x95, 0x43, 0x6E, 0x47, 0xF7, 0x09, 0xB6,
-    0xE9, 0x54, 0xBE, 0xD8, 0x98, 0xE4, 0x16, 0x4E, 0x6C, 0xD9, 0xCC, 0x1F, 0xE9, 0x7C, 0x39, 0xE6,
-    0x94, 0x04, 0xC5, 0x73, 0x13, 0x68, 0x18, 0xB2, 0x15, 0xFC, 0x9A, 0x3B, 0x34, 0x07, 0x8B, 0xD9,
-    0xDE, 0xB7, 0xEF, 0x9E, 0x1C, 0x08, 0x07, 0x5F, 0x03, 0x61, 0x57, 0xDF, 0x87, 0x80, 0xB0, 0xE7,
-    0x60, 0x45, 0xDD, 0x1A, 0x1E, 0x7F, 0x22, 0xB0, 0xC4, 0x86, 0xBF, 0x7A, 0xCF, 0x1C, 0x86, 0xB2,
-    0x39, 0x94, 0xE1, 0xC9, 0xDA, 0x3D, 0xF1, 0x1B, 0xE0, 0x61, 0x75, 0x44, 0xCF, 0x5A, 0x54, 0x32,
-    0xA6, 0xB4, 0xC0, 0x13, 0x2F, 0x41, 0x00, 0x78, 0x3D, 0x5E, 0x25, 0x68, 0xF4, 0x54, 0xEB, 0x89,
-    0x8D, 0xB9, 0x8A, 0x83, 0x0F, 0x62, 0xE7, 0x46, 0x23, 0xC6, 0x38, 0x6D, 0xFE, 0xE7, 0x82, 0xD2,
-    0x49, 0xC1, 0x64, 0xB2, 0x32, 0x06, 0xEC, 0x64, 0x9B, 0xEC, 0x89, 0x12, 0x6E, 0x6C, 0x81, 0x45,
-    0xE8, 0xB9, 0x20, 0xAF, 0x2E, 0x8A, 0x4A, 0x1C, 0x54, 0xB1, 0xBA, 0x79, 0x19, 0x74, 0x21, 0x4E,
-    0x22, 0x32, 0xE2, 0x8C, 0xB6, 0xF5, 0x5F, 0xE2, 0x41, 0x74, 0x7E, 0xD1, 0xB4, 0x82, 0xBC, 0xDC,
-    0x12, 0x62, 0x7C, 0x36, 0x09, 0x95, 0xCF, 0xB6, 0xF3, 0x5F, 0x0D, 0x1A, 0xDF, 0x4A, 0x4B, 0x17,
-    0xE8, 0xC2, 0x6D, 0xD4, 0x4F, 0x44, 0xEF, 0xD7, 0xEE, 0x06, 0x63, 0x7D, 0x1A, 0xF4, 0x9B, 0xA2,
-    0x7F, 0xAF, 0x6F, 0xAA, 0x8B, 0x14, 0x3D, 0xCE, 0x2F, 0xDB, 0xC5, 0x8C, 0x1E, 0xCC, 0x88, 0x4E,
-    0x91, 0xBC, 0x0C, 0x87, 0x99, 0xE4, 0x0A, 0x00, 0x3A, 0x75, 0xB8, 0x67, 0x7A, 0x77, 0x74, 0xD1,
-    0x18, 0xCA, 0x89, 0x99, 0x8A, 0x86, 0xD6, 0x85, 0x5F, 0xA3, 0xC9, 0xF2, 0x11, 0x78, 0x10, 0x8C,
-    0x6A, 0x62, 0xF9, 0x2A, 0x76, 0x29, 0xC3, 0x28, 0x63, 0xF4, 0x2B, 0x8B, 0x9D, 0xA9, 0xB8, 0x98,
-    0x26, 0xA4, 0xD9, 0x10, 0x18, 0x27, 0xEE, 0x72, 0x41, 0x08, 0x75, 0xDA, 0xC4, 0x55, 0xD2, 0xA6,
-    0x65, 0x5C, 0x87, 0x84, 0x4D, 0x35, 0xB0, 0x37, 0xF6, 0xFE, 0xDA, 0x1E, 0x88, 0x19, 0x57, 0xA3,
-    0x1E, 0x02, 0xB7, 0x4E, 0x45, 0xB1, 0xD3, 0x2F, 0x6A, 0x25, 0x06, 0x28, 0x12, 0x0C, 0xF7, 0xFC,
-    0x4A, 0x62, 0x91, 0x66, 0x72, 0xFB, 0xBB, 0x7D, 0xF2, 0xC8, 0xDE, 0x41, 0xD2, 0xB0, 0xF7, 0x68,
-    0x3D, 0xC0, 0x3E, 0xA2, 0xA3, 0x50, 0x9C, 0xB9, 0xF9, 0x2F, 0xD4, 0x7F, 0xB5, 0x70, 0x96, 0x4E,
-    0xAC, 0x26, 0x73, 0x3D, 0x99, 0x96, 0x12, 0x2B, 0xA0, 0x95, 0x47, 0xC1, 0x4A, 0xA4, 0x86, 0x4B,
-    0xD0, 0xF0, 0xA3, 0x44, 0xA2, 0x2B, 0x1C, 0xD3, 0xFE, 0xC0, 0xD2, 0xEC, 0x5F, 0x66, 0x39, 0x40,
-    0x1F, 0xD1, 0x44, 0x07, 0x1D, 0x90, 0xD4, 0x18, 0x6E, 0xD8, 0x11, 0xE5, 0x4C, 0x2D, 0x18, 0x9F,
-    0x16, 0x0C, 0xED, 0x4D, 0x98, 0x3E, 0x1E, 0x4D, 0x9F, 0x9D, 0x53, 0x93, 0x35, 0xF4, 0xDF, 0x3E,
-    0x50, 0x2C, 0x15, 0x4D, 0x73, 0xAF, 0xD1, 0xD8, 0x82, 0xDA, 0x9C, 0x12, 0xCA, 0xE0, 0xB8, 0x9B,
-    0xB9, 0xF9, 0xB1, 0x39, 0xDF, 0xFA, 0x37, 0xCA, 0xE8, 0x98, 0x79, 0xE1, 0x0D, 0xB3, 0x55, 0x07,
-    0xB7, 0x16, 0xC9, 0xB9, 0xB7, 0xA1, 0xBC, 0x00, 0xF8, 0xEA, 0xE2, 0xEC, 0xC2, 0xBC, 0x60, 0x4C,
-    0x6F, 0x7C, 0x28, 0xAF, 0xF2, 0x99, 0xAC, 0x93, 0x94, 0xCD, 0x1D, 0x93, 0xE4, 0x71, 0x76, 0xC8,
-    0x78, 0x72, 0x3C, 0xF9, 0x24, 0x3B, 0x84, 0x8F, 0x28, 0x9F, 0x68, 0x81, 0xAC, 0xF6, 0xE9, 0xB4,
-    0x9F, 0xEC, 0x8D, 0xC7, 0xDB, 0x18, 0x5F, 0xE3, 0xFF, 0xDF, 0xAF, 0xD9, 0x15, 0xCE, 0xBA, 0xD8,
-    0xB1, 0x31, 0xA2, 0xB5, 0x7D, 0x2C, 0xFA, 0x2D, 0xD1, 0x7D, 0xCB, 0x81, 0x4A, 0x30, 0x82, 0xFB,
-    0x3F, 0xE0, 0x6C, 0xFC, 0x90, 0xE7, 0x1C, 0xF3, 0xF9, 0xCC, 0x09, 0xA0, 0x12, 0x4C, 0x3F, 0x18,
-    0x28, 0x02, 0x4A, 0xBF, 0x01, 0xA0, 0x86, 0xF5, 0x6D, 0x52, 0x4F, 0x61, 0x8D, 0xF0, 0xB1, 0x55,
-    0x23, 0x61, 0x2E, 0xB7, 0x13, 0x7F, 0xC2, 0xB7, 0xE7, 0x19, 0xDB, 0xFE, 0x1B, 0x92, 0xFE, 0xCF,
-    0xF8, 0xBC, 0x6B, 0x64, 0xFD, 0x7B, 0x0D, 0x31, 0xB9, 0xCC, 0xC3, 0xF4, 0xFD, 0xCC, 0xC4, 0xD7,
-    0xC1, 0xFE, 0xC1, 0x03, 0xC2, 0xDD, 0xA1, 0x0F, 0x20, 0x03, 0x73, 0x88, 0xF2, 0xF8, 0x76, 0x19,
-    0x97, 0xC1, 0xC3, 0x26, 0xAE, 0x67, 0xA3, 0x38, 0x63, 0x0A, 0x45, 0x90, 0x5F, 0xA1, 0xE7, 0xCF,
-    0x49, 0xE7, 0xD6, 0x7F, 0xE8, 0x6C, 0x1C, 0x61, 0xF9, 0x37, 0xE3, 0xC5, 0x16, 0x7C, 0x81, 0x8E,
-    0xF1, 0x27, 0xE8, 0x99, 0x3A, 0x42, 0x36, 0xC8, 0xA0, 0x56, 0x05, 0x6C, 0xFD, 0x72, 0xA3, 0xFD,
-    0x13, 0x46, 0xB2, 0x85, 0xCD, 0x29, 0x0E, 0x0A, 0x46, 0x74, 0x66, 0x62, 0x95, 0xB3, 0xC7, 0xF6,
-    0x4F, 0xC1, 0xE4, 0xF9, 0x6F, 0x28, 0x64, 0x09, 0xC5, 0x2A, 0xAF, 0xE0, 0xFC, 0xF8, 0x97, 0x9D,
-    0x01, 0x40, 0x1D, 0xFC, 0x06, 0x06, 0x58, 0x74, 0x7A, 0x3C, 0xD5, 0xBD, 0x10, 0xD5, 0x41, 0xD3,
-    0xE5, 0x26, 0xBA, 0x71, 0x17, 0xBD, 0x3A, 0x46, 0x69, 0x08, 0x9C, 0xEA, 0x75, 0x7C, 0x91, 0x2F,
-    0x69, 0x48, 0x9D, 0x05, 0xF2, 0x1E, 0x7E, 0x92, 0xD4, 0x61, 0xDB, 0xE6, 0xDB, 0xF6, 0x4A, 0xC5,
-    0x48, 0xD3, 0x4B, 0xE8, 0xCA, 0x4F, 0xF0, 0xA8, 0xAC, 0x15, 0xD9, 0x62, 0x0E, 0x9E, 0xE0, 0x74,
-    0x5E, 0x10, 0x6E, 0xFA, 0xED, 0xAC, 0x27, 0xAA, 0x37, 0x97, 0x4C, 0x52, 0xA6, 0x0B, 0x40, 0x7B,
-    0x28, 0x50, 0xCF, 0xBE, 0x2B, 0xD9, 0x05, 0xA5, 0x13, 0x6D, 0x30, 0x4C, 0x02, 0x7A, 0xC4, 0xF2,
-    0x3A, 0xAF, 0x92, 0x2E, 0x69, 0xE9, 0x1D, 0x9C, 0x01, 0x81, 0x66, 0xF6, 0x1E, 0x84, 0xC1, 0x8E,
-    0x4F, 0x4B, 0xBC, 0xC5, 0xBD, 0xF3, 0x7B, 0xA8, 0x28, 0x6B, 0x9E, 0xC1, 0x6F, 0xEE, 0x15, 0x9B,
-    0x44, 0x3C, 0x94, 0x48, 0x10, 0x6E, 0x2F, 0x72, 0xDA, 0x45, 0x95, 0x5D, 0x5E, 0x94, 0xA9, 0x14,
-    0x3B, 0x89, 0xFA, 0xAD, 0x7D, 0x37, 0x93, 0x59, 0x14, 0x4B, 0xDA, 0x44, 0x65, 0xFE, 0xD7, 0x84,
-    0xAA, 0x3D, 0xE7, 0x56, 0xAC, 0xE9, 0xE9, 0xF4, 0x09, 0xFD, 0xEC, 0x11, 0x9A, 0x6D, 0x74, 0x2D,
-    0xE7, 0x75, 0x60, 0x93, 0xDE, 0x5B, 0xFE, 0xD5, 0xF2, 0x29, 0xCF, 0xFF, 0x9D, 0x22, 0x44, 0x0D,
-    0x5C, 0xA6, 0x22, 0xD7, 0x84, 0x29, 0xFF, 0xA9, 0xCB, 0xF4, 0xD1, 0x2C, 0x99, 0xCC, 0xF8, 0x4B,
-    0x71, 0xCD, 0x04, 0x3A, 0x0D, 0xEE, 0xDA, 0x4D, 0x97, 0xB5, 0x21, 0x4E, 0x72, 0xC9, 0x7F, 0x2A,
-    0x99, 0x93, 0x26, 0x39, 0x28, 0x1E, 0xAD, 0x4D, 0x1A, 0xCB, 0xA0, 0x2A, 0xF8, 0x86, 0x28, 0x9F,
-    0x51, 0x31, 0x6F, 0x94, 0xD3, 0x3D, 0x4F, 0x27, 0x8C, 0x03, 0xF3, 0x1C, 0x47, 0x0B, 0x43, 0xCA,
-    0x08, 0x65, 0x3C, 0x84, 0xB4, 0x75, 0xDA, 0x54, 0xE0, 0xA5, 0xCC, 0x0D, 0xD1, 0x06, 0x2E, 0x80,
-    0x7E, 0x38, 0xDB, 0x41, 0x5B, 0x4C, 0xA5, 0x68, 0xCD, 0x94, 0x58, 0x11, 0xB6, 0x13, 0x0C, 0xFD,
-    0xE1, 0x00, 0x7F, 0x9F, 0xFA, 0xD5, 0x30, 0x7B, 0x82, 0x2E, 0x6C, 0xC1, 0x5A, 0x77, 0xD0, 0xDF,
-    0xCF, 0x6B, 0x95, 0xC5, 0x20, 0x99, 0xBF, 0x35, 0x3F, 0xCE, 0xF9, 0x90, 0x7C, 0x35, 0xA3, 0x37,
-    0x02, 0xD3, 0x05, 0xD0, 0xD5, 0x8E, 0xA2, 0x49, 0x2F, 0xBA, 0x44, 0xA0, 0x10, 0x14, 0x65, 0xCC,
-    0x21, 0xDA, 0x2E, 0x4A, 0x74, 0xF3, 0xB8, 0x11, 0x5D, 0x4A, 0x6D, 0x3E, 0x66, 0xEA, 0xF5, 0x0A,
-    0x35, 0x16, 0x51, 0x4B, 0x5F, 0x32, 0x58, 0x75, 0x7F, 0x03, 0x16, 0xCF, 0xB7, 0x8B, 0xCE, 0x79,
-    0x81, 0x06, 0xC1, 0xD6, 0x87, 0x5C, 0xD2, 0xD3, 0xBE, 0xE3, 0xF9, 0xC7, 0xF6, 0xE5, 0x11, 0xD0,
-    0xFC, 0x81, 0x46, 0xD2, 0xA8, 0x95, 0x61, 0xBD, 0x95, 0x76, 0xED, 0x00, 0x55, 0x1B, 0xF4, 0x71,
-    0x0B, 0x33, 0x6A, 0x01, 0x0B, 0xE4, 0xA5, 0x31, 0xEC, 0xC0, 0x4B, 0xA7, 0xE9, 0xFD, 0xBF, 0x03,
-    0x54, 0x7B, 0xE8, 0xC2, 0x9E, 0xDC, 0x15, 0xCC, 0xE5, 0xA7, 0x1D, 0x38, 0xCE, 0xB9, 0x3B, 0x54,
-    0x32, 0x29, 0x24, 0x63, 0xA8, 0xC2, 0x6B, 0x50, 0xE3, 0xF4, 0x2E, 0x21, 0x6E, 0x6D, 0x36, 0x8C,
-    0x8C, 0x85, 0xC7, 0xF4, 0x96, 0x88, 0x59, 0x4B, 0xE9, 0x50, 0xD0, 0x7D, 0x15, 0x36, 0x1C, 0xA6,
-    0xC2, 0x88, 0x2F, 0x8E, 0xB7, 0x1E, 0x99, 0xCB, 0x91, 0xD4, 0xCF, 0x61, 0x1E, 0x02, 0xFB, 0x42,
-    0xBF, 0x96, 0x30, 0xEB, 0xFF, 0x13, 0xC9, 0x2E, 0x89, 0x74, 0xDC, 0x6D, 0x63, 0x7C, 0x83, 0xF2,
-    0xCF, 0xDC, 0x2E, 0xD4, 0x5D, 0x62, 0x17, 0xDC, 0x35, 0xD8, 0x9D, 0xEC, 0xA2, 0x32, 0x31, 0xBD,
-    0xEE, 0x16, 0xA9, 0xC7, 0x1D, 0x94, 0x11, 0x76, 0x4D, 0x91, 0xA5, 0x76, 0xF1, 0xB7, 0xAB, 0x6E,
-    0xFD, 0x09, 0xBB, 0xD6, 0x9A, 0xF3, 0x26, 0xA8, 0x7C, 0x18, 0x0E, 0x59, 0x94, 0x99, 0x37, 0xCD,
-    0x4F, 0x78, 0x0A, 0xE6, 0xEE, 0x36, 0xE4, 0x36, 0x27, 0x6A, 0x25, 0x1E, 0xBD, 0xD6, 0x0C, 0x1B,
-    0x9F, 0x55, 0x7E, 0x1D, 0x9F, 0xCB, 0x70, 0xBB, 0x37, 0xCD, 0x0B, 0xB3, 0x01, 0x06, 0x81, 0xBD,
-    0x45, 0x17, 0x3B, 0xBE, 0x68, 0xEB, 0x37, 0x95, 0xFD, 0xDA, 0xD5, 0x1C, 0x91, 0xE6, 0x3E, 0xC5,
-    0x22, 0x98, 0x04, 0x12, 0x84, 0x35, 0x7F, 0x7E, 0x51, 0xDD, 0x49, 0xAB, 0x79, 0xB2, 0x4A, 0x52,
-    0x63, 0x56, 0x16, 0x33, 0x66, 0x64, 0x9A, 0xA8, 0x37, 0x09, 0x73, 0x20, 0x65, 0x02, 0x8B, 0x2F,
-    0xD9, 0x30, 0xE9, 0x82, 0xF3, 0x43, 0x9A, 0x34, 0x17, 0x49, 0x66, 0x99, 0x24, 0x60, 0x52, 0x4C,
-    0x99, 0x5C, 0x9B, 0x59, 0xCC, 0x39, 0x32, 0x9B, 0x18, 0x21, 0xCD, 0xD4, 0x4F, 0x13, 0xD5, 0x92,
-    0x1B, 0xA5, 0x79, 0x82, 0x6B, 0x39, 0x1A, 0xDE, 0x80, 0xBB, 0x14, 0x80, 0x83, 0x09, 0xB0, 0x76,
-    0x74, 0x97, 0xFE, 0x4E, 0xF4, 0x7D, 0x64, 0xC6, 0x83, 0x38, 0x94, 0x39, 0x05, 0x68, 0x57, 0x30,
-    0x43, 0x46, 0x4E, 0x62, 0x98, 0x1E, 0xD8, 0xCA, 0xEF, 0xD3, 0xD1, 0xC0, 0x44, 0x6C, 0xA0, 0x4B,
-    0x89, 0x7D, 0x57, 0x79, 0x96, 0xAD, 0x43, 0x7A, 0xDA, 0x01, 0xEF, 0x31, 0x72, 0xE9, 0x77, 0x6F,
-    0x8E, 0x79, 0x19, 0x13, 0x2D, 0xF0, 0x56, 0x31, 0xF5, 0x0E, 0x25, 0xBC, 0xA4, 0x1E, 0x60, 0x07,
-    0xE9, 0x74, 0xE8, 0xBD, 0x67, 0x0B, 0x71, 0xDA, 0x63, 0x4C, 0xC5, 0x8C, 0xC9, 0x7A, 0x24, 0x6A,
-    0x96, 0x32, 0xD4, 0x5F, 0x54, 0x09, 0x13, 0x90, 0x98, 0x99, 0x74, 0x86, 0x21, 0xA8, 0xA4, 0xD6,
-    0x68, 0x62, 0x44, 0xD5, 0x2F, 0xF3, 0x93, 0x1E, 0x65, 0x53, 0xF4, 0x2E, 0x4C, 0x22, 0x9E, 0x0D,
-    0x71, 0x3A, 0xD2, 0x23, 0x15, 0x4A, 0x52, 0x4C, 0xAF, 0x59, 0x44, 0xBE, 0x7A, 0xF1, 0xEB, 0x29,
-    0xFD, 0x70, 0x82, 0x80, 0xB5, 0xD7, 0xA3, 0xE3, 0xD7, 0x9F, 0xE1, 0xF0, 0xF5, 0x2B, 0xD0, 0xBF,
-    0xF6, 0x3A, 0x73, 0xBB, 0xA8, 0xC4, 0x1A, 0xC9, 0x84, 0x72, 0x07, 0x33, 0x65, 0x98, 0x50, 0x44,
-    0x1F, 0xCC, 0xBF, 0x9E, 0x93, 0x0C, 0xE3, 0xDA, 0x4E, 0x65, 0xF7, 0xDA, 0xAE, 0x55, 0x89, 0x98,
-    0x69, 0xB6, 0xAC, 0xB8, 0x91, 0x52, 0xFA, 0x99, 0xF0, 0xF2, 0xB2, 0x2B, 0x00, 0x60, 0x3C, 0xAB,
-    0xF9, 0xAB, 0xB1, 0xDB, 0x89, 0xDB, 0x4D, 0x02, 0xEA, 0xBD, 0xC2, 0x17, 0x8A, 0x43, 0xF7, 0xDC,
-    0xF2, 0xD1, 0x1D, 0xF5, 0x1A, 0x65, 0xA0, 0xEE, 0x0E, 0xE6, 0x9F, 0x1E, 0x9F, 0x1E, 0xCE, 0x30,
-    0x82, 0xCC, 0x89, 0x54, 0x46, 0x6C, 0xEB, 0x14, 0x39, 0x79, 0x26, 0x69, 0x2C, 0xDC, 0x61, 0x28,
-    0xD3, 0xED, 0x8B, 0x92, 0xBA, 0xE0, 0x76, 0x89, 0x8B, 0x25, 0x75, 0x7C, 0xB8, 0xE2, 0x67, 0xEF,
-    0x3F, 0xCC, 0xE7, 0xF3, 0x77, 0x25, 0xF0, 0xA3, 0x59, 0x83, 0xAA, 0xB0, 0xD4, 0xB8, 0xB2, 0x9A,
-    0x11, 0xDC, 0x78, 0x96, 0xC3, 0x06, 0xAB, 0x67, 0x41, 0xED, 0x6A, 0x25, 0xC2, 0x70, 0x5D, 0x30,
-    0xAC, 0xFA, 0x22, 0x02, 0x75, 0x4D, 0xD8, 0x29, 0x0E, 0x2C, 0xFA, 0xEC, 0xF6, 0xC8, 0x84, 0x8F,
-    0x3E, 0x6D, 0x34, 0x59, 0xEC, 0x63, 0x8B, 0x39, 0xEA, 0xB2, 0x98, 0x43, 0xC9, 0x63, 0xAE, 0x93,
-    0x46, 0x02, 0xBB, 0x45, 0x99, 0xD7, 0x8C, 0xE3, 0xD2, 0x7F, 0xD3, 0x30, 0x63, 0xF7, 0x34, 0x1B,
-    0xA1, 0x4B, 0x55, 0x9B, 0xE2, 0x69, 0x62, 0xC5, 0xE1, 0x22, 0x75, 0xD9, 0xC8, 0x14, 0xCD, 0xA1,
-    0x60, 0xFA, 0x0D, 0x4D, 0x2E, 0xCD, 0x20, 0x6B, 0x4D, 0x7C, 0xF3, 0x37, 0x78, 0xF3, 0xF4, 0x58,
-    0x15, 0x34, 0x43, 0x5C, 0x26, 0xA7, 0xDB, 0xD4, 0x0C, 0x61, 0x35, 0x06, 0xB4, 0xCA, 0xD3, 0x72,
-    0xC0, 0x9C, 0xF7, 0x8E, 0x8B, 0xD4, 0xE8, 0x98, 0x4E, 0x42, 0xEF, 0x17, 0x75, 0x0D, 0x23, 0x2B,
-    0xB6, 0x4B, 0x9B, 0x84, 0x8E, 0xD5, 0xB2, 0xA8, 0x0A, 0x3E, 0x6A, 0x21, 0x36, 0x22, 0xD5, 0x23,
-    0x2C, 0x45, 0x28, 0x08, 0x8D, 0xF7, 0x0B, 0xFD, 0x66, 0x42, 0xA2, 0xD8, 0xFE, 0x86, 0x84, 0xC2,
-    0xEC, 0x69, 0x99, 0xEB, 0x22, 0x50, 0x07, 0xB3, 0x15, 0x5D, 0x09, 0x68, 0xE4, 0xC3, 0x98, 0x16,
-    0x0F, 0x50, 0x4B, 0x0E, 0x81, 0x9D, 0x5F, 0xA3, 0xAB, 0x47, 0xA8, 0xBC, 0x61, 0xFC, 0x63, 0xE6,
-    0x36, 0x89, 0xFD, 0xA6, 0xD0, 0xB4, 0xE8, 0x51, 0xA8, 0xDD, 0x6A, 0xC6, 0x91, 0xDE, 0x5B, 0x73,
-    0x32, 0xF5, 0x91, 0x66, 0x63, 0x10, 0x07, 0x2B, 0xE3, 0x5F, 0x7E, 0x1F, 0x5A, 0x58, 0x56, 0xCC,
-    0x47, 0x84, 0x8C, 0xB1, 0x97, 0x47, 0xFC, 0x1A, 0x37, 0x09, 0xEE, 0x10, 0x0F, 0x99, 0x71, 0x01,
-    0x75, 0x0C, 0xE5, 0x45, 0x06, 0xC5, 0xF3, 0x3A, 0xAD, 0x3D, 0x4B, 0x7D, 0xD0, 0xD2, 0xE8, 0x3E,
-    0x0A, 0x1D, 0xD1, 0xD1, 0x51, 0x86, 0x19, 0x08, 0x2C, 0x09, 0x23, 0xFB, 0xB4, 0x78, 0x21, 0xA6,
-    0xCC, 0xF5, 0xC8, 0xE5, 0x2D, 0x66, 0x9E, 0xA6, 0x37, 0x54, 0xBB, 0xE7, 0xF6, 0x73, 0xAA, 0x72,
-    0xD5, 0x13, 0x95, 0xA8, 0xE4, 0x2B, 0xF4, 0x37, 0xEB, 0x62, 0xBF, 0x5D, 0x2A, 0xF1, 0x33, 0xC9,
-    0x99, 0x8F, 0x46, 0x17, 0xB4, 0x12, 0x54, 0x81, 0x33, 0x1C, 0xCD, 0xB4, 0x93, 0xB4, 0x20, 0x31,
-    0x2F, 0x4B, 0x23, 0xB1, 0xE6, 0xD2, 0x13, 0x70, 0x53, 0xFB, 0xC2, 0x31, 0x4D, 0x20, 0x79, 0x83,
-    0x6D, 0x48, 0x6E, 0xCA, 0x3B, 0xF1, 0x9A, 0xA7, 0x7D, 0x22, 0xF1, 0xD2, 0x51, 0x42, 0x57, 0xB1,
-    0x95, 0x87, 0x6A, 0xA4, 0x4A, 0x39, 0x59, 0xB4, 0x59, 0x6B, 0xA6, 0xA0, 0xD7, 0xC4, 0xD9, 0x2E,
-    0xF8, 0xE5, 0xB9, 0xAC, 0x18, 0xE7, 0x3B, 0x2B, 0xEC, 0x5A, 0x2C, 0x59, 0x22, 0x14, 0xA1, 0x66,
-    0x89, 0x15, 0xF4, 0xD1, 0x40, 0xCA, 0xE7, 0x99, 0x58, 0x6D, 0x09, 0x61, 0x14, 0x40, 0x3E, 0xDD,
-    0xB7, 0x20, 0x61, 0xD8, 0x86, 0xE8, 0x3B, 0x0D, 0x6A, 0x7F, 0x48, 0x98, 0xB4, 0x94, 0xB2, 0xD7,
-    0x45, 0xE5, 0x4C, 0xCB, 0x42, 0xFA, 0x2B, 0xBD, 0xB5, 0x53, 0x90, 0x4D, 0x43, 0x78, 0x27, 0xA8,
-    0x29, 0xE4, 0xA7, 0xB0, 0xEE, 0x67, 0x75, 0x86, 0x57, 0x61, 0xC6, 0x67, 0x6A, 0xCA, 0x86, 0xDD,
-    0xE4, 0xA9, 0x3C, 0xEB, 0x42, 0xF7, 0xBF, 0x8F, 0xF4, 0xF2, 0xD9, 0x7B, 0x2B, 0x87, 0x85, 0x47,
-    0xDF, 0xE8, 0x80, 0xE7, 0x3C, 0xF8, 0x41, 0x48, 0x6E, 0x92, 0x17, 0xC3, 0x6A, 0x37, 0x1A, 0x15,
-    0x06, 0xD3, 0xEE, 0x47, 0xF6, 0xD3, 0xF9, 0xF1, 0x7C, 0xAA, 0x6A, 0xD0, 0x9D, 0x74, 0xF4, 0x29,
-    0xBB, 0xEA, 0x49, 0xBB, 0xC9, 0xE8, 0x0F, 0xC5, 0x99, 0xD3, 0x87, 0xDB, 0xCB, 0xC5, 0x25, 0x49,
-    0x63, 0x8D, 0x34, 0x89, 0xED, 0xDF, 0x58, 0x05, 0x8E, 0x56, 0x32, 0x83, 0x1F, 0x3D, 0x4C, 0x8E,
-    0x53, 0xBB, 0x53, 0xC1, 0x90, 0x6C, 0xCD, 0xE7, 0x59, 0x5E, 0x3A, 0x34, 0x21, 0xDE, 0x16, 0x09,
-    0x6F, 0xE5, 0x95, 0x03, 0xF4, 0x81, 0x05, 0xCB, 0xC6, 0x6E, 0x7E, 0xC0, 0xDC, 0x19, 0x0B, 0x48,
-    0x8C, 0x2C, 0xE9, 0x62, 0x62, 0x08, 0x4C, 0x29, 0xC0, 0x46, 0xDC, 0x33, 0xE4, 0x98, 0x82, 0x39,
-    0x62, 0x9C, 0xFA, 0x11, 0xA5, 0x1D, 0xF4, 0x2D, 0x91, 0x57, 0xD2, 0x82, 0x8F, 0x8B, 0x3A, 0x75,
-    0x3D, 0x9F, 0x9F, 0x98, 0x31, 0xD9, 0xA8, 0x4A, 0x32, 0xF3, 0x91, 0x99, 0xB5, 0x26, 0xFC, 0x84,
-    0x1A, 0xB0, 0xB0, 0xBF, 0x1E, 0xA2, 0xCF, 0xAB, 0xE8, 0xA2, 0x79, 0xE1, 0x43, 0xB3, 0xDD, 0x26,
-    0xB7, 0x3F, 0xB1, 0xE9, 0x51, 0xCD, 0x70, 0x05, 0x74, 0x1B, 0x39, 0x59, 0x42, 0xC6, 0x90, 0x6B,
-    0x06, 0xC1, 0x19, 0x8C, 0x18, 0x18, 0xF1, 0x07, 0x4D, 0x0A, 0xBA, 0x96, 0x35, 0x7B, 0xAC, 0x8F,
-    0xD5, 0xB3, 0x9C, 0x6B, 0xFA, 0xD8, 0x0C, 0x86, 0x7C, 0xAF, 0x19, 0x01, 0x60, 0x2B, 0xCD, 0x1F,
-    0xCB, 0x1F, 0xD8, 0x6D, 0x17, 0xAD, 0x9F, 0x12, 0xC8, 0x22, 0x3B, 0x65, 0x87, 0x15, 0x2A, 0xB7,
-    0xF5, 0xA2, 0x2A, 0xD7, 0x78, 0xBA, 0xB6, 0xF2, 0x46, 0x8B, 0x86, 0x28, 0xA7, 0x6B, 0x76, 0xCA,
-    0xC8, 0x90, 0xE9, 0xA8, 0xA9, 0xD0, 0x52, 0x5B, 0x62, 0xCF, 0x59, 0xC9, 0xC2, 0x4C, 0x60, 0x23,
-    0xDD, 0x71, 0xAA, 0x3E, 0x86, 0x9D, 0x28, 0x5A, 0xEF, 0x45, 0x8A, 0xBF, 0x8E, 0xF2, 0x2A, 0xA6,
-    0x00, 0xAE, 0x53, 0xFA, 0xD4, 0x1A, 0x17, 0x3B, 0x5C, 0x45, 0x0E, 0x57, 0x81, 0xC3, 0x27, 0x9D,
-    0xBA, 0x40, 0xA0, 0x61, 0x8F, 0x00, 0x24, 0xD3, 0xBB, 0x0E, 0xD3, 0x27, 0xB2, 0x18, 0xE4, 0xA0,
-    0xB3, 0x77, 0x49, 0xA3, 0xEB, 0x56, 0x12, 0xD0, 0x8A, 0xDF, 0x88, 0xDB, 0x5D, 0xF2, 0xB4, 0x04,
-    0xD2, 0xB8, 0xB4, 0x63, 0x97, 0x98, 0xEC, 0x7E, 0xD9, 0x29, 0x32, 0x59, 0xE0, 0x42, 0x7E, 0x93,
-    0x26, 0xD4, 0x95, 0x3E, 0xA5, 0x7C, 0x4F, 0x2F, 0xDB, 0x26, 0x1D, 0x29, 0x79, 0xE5, 0xC1, 0xA1,
-    0x3E, 0xFE, 0x43, 0xB3, 0xF6, 0x8B, 0x31, 0xBF, 0x6D, 0x02, 0xDC, 0x09, 0x48, 0xD4, 0x8F, 0xF6,
-    0x26, 0xC0, 0x8D, 0x66, 0x83, 0xB6, 0x8B, 0x33, 0xFD, 0x8B, 0x4C, 0x22, 0xD2, 0x4F, 0xF7, 0xD4,
-    0x9F, 0x79, 0x71, 0xF2, 0xD4, 0x0F, 0x1E, 0xCC, 0xDC, 0x8A, 0x4F, 0x20, 0xCB, 0x54, 0x0C, 0x5D,
-    0x75, 0x46, 0xD4, 0x36, 0x4F, 0x44, 0x1D, 0xC1, 0x54, 0x5E, 0x4B, 0xFE, 0xD0, 0x4B, 0x4C, 0xF5,
-    0x1A, 0x44, 0x3E, 0xB7, 0x92, 0xC3, 0x7A, 0x95, 0x06, 0x28, 0x93, 0x84, 0xA0, 0xBC, 0x34, 0x05,
-    0x50, 0x12, 0x41, 0x35, 0x4B, 0x45, 0xD3, 0xB6, 0x05, 0x93, 0xA9, 0x23, 0xCD, 0x65, 0x0B, 0x1A,
-    0xE7, 0x3F, 0x73, 0xF6, 0xAB, 0xEC, 0xF1, 0x75, 0x22, 0xA2, 0xC6, 0x52, 0xD5, 0x5D, 0x16, 0x67,
-    0x82, 0xC7, 0xE0, 0x18, 0xD4, 0x12, 0x26, 0x4F, 0xE3, 0x40, 0x83, 0x80, 0x69, 0xB5, 0xD8, 0x8C,
-    0x11, 0xF6, 0xD4, 0xEC, 0xF3, 0x7D, 0x59, 0x54, 0x15, 0x59, 0xF4, 0x09, 0xE0, 0x38, 0xDD, 0xCE,
-    0x57, 0x61, 0xEF, 0x5C, 0xC7, 0xB4, 0xBA, 0x5D, 0x89, 0x17, 0x88, 0xDA, 0x20, 0x1D, 0x35, 0xED,
-    0x45, 0x8E, 0x02, 0xA7, 0x01, 0xE5, 0x73, 0x4C, 0xCF, 0x63, 0xD6, 0x14, 0x47, 0xEC, 0x2F, 0x8B,
-    0x17, 0xA5, 0xE7, 0x2F, 0x4C, 0xDB, 0x7E, 0x48, 0xBD, 0x03, 0x4B, 0x21, 0x29, 0xE6, 0x08, 0xED,
-    0x09, 0x56, 0x6C, 0xB4, 0xE2, 0x81, 0x88, 0x5A, 0x91, 0x2A, 0x91, 0x2A, 0xA5, 0xA8, 0x65, 0xA0,
-    0x0F, 0x73, 0xB8, 0xA7, 0x8E, 0x8B, 0xEF, 0x90, 0x07, 0x78, 0x10, 0xE5, 0x7F, 0x47, 0x12, 0xF1,
-    0x13, 0x9D, 0x26, 0x89, 0xCE, 0x83, 0x74, 0xCA, 0x96, 0x14, 0x46, 0x4A, 0xEF, 0x0E, 0x62, 0xA7,
-    0xDC, 0xED, 0xA9, 0x68, 0x70, 0x48, 0xA8, 0x93, 0xEF, 0x5C, 0x60, 0xDA, 0x49, 0xCE, 0xFC, 0xC1,
-    0x41, 0x7D, 0xC3, 0x00, 0x34, 0x52, 0x11, 0x53, 0x13, 0xE3, 0xC7, 0x76, 0x0D, 0xC9, 0x1E, 0xA4,
-    0xE1, 0x9D, 0x67, 0x11, 0x95, 0x50, 0xB4, 0xA0, 0x2F, 0x71, 0xC1, 0xB0, 0xF8, 0x39, 0x08, 0xED,
-    0xF8, 0x1C, 0x50, 0x5F, 0x72, 0x8E, 0xB1, 0x2F, 0x49, 0xA2, 0x15, 0xAF, 0xA5, 0x64, 0x08, 0x5D,
-    0xC4, 0x4D, 0xD3, 0x0D, 0x68, 0xD9, 0x34, 0x63, 0x68, 0x21, 0x63, 0x8E, 0x1D, 0xF4, 0x78, 0x9D,
-    0x43, 0xD9, 0x76, 0x6B, 0xE9, 0x7E, 0xA9, 0xBD, 0x2B, 0xA9, 0x4C, 0x4C, 0xF7, 0xB3, 0xBF, 0x83,
-    0x74, 0xBF, 0xC5, 0xF7, 0x4C, 0xF7, 0x13, 0xD4, 0x1A, 0x29, 0x3B, 0x69, 0x2D, 0x11, 0x5E, 0xB8,
-    0xF8, 0x34, 0xD3, 0x93, 0xEA, 0xF5, 0x50, 0xAB, 0x8A, 0x99, 0xDF, 0x60, 0xE2, 0x39, 0xBA, 0xD4,
-    0x42, 0xCD, 0xCE, 0x98, 0x97, 0x65, 0x8A, 0x42, 0x2C, 0x05, 0xE9, 0x51, 0x33, 0x79, 0x2D, 0xA4,
-    0x6F, 0xA9, 0xD6, 0x17, 0x8C, 0x93, 0xF6, 0xB7, 0x05, 0xC3, 0xCA, 0x9F, 0xE1, 0x53, 0x31, 0xDD,
-    0x87, 0xC1, 0x88, 0x2F, 0xCC, 0x88, 0xE9, 0x98, 0x86, 0x03, 0x72, 0x44, 0xE2, 0x71, 0x36, 0x82,
-    0x7D, 0xAA, 0x7D, 0xF3, 0xBC, 0x91, 0xA4, 0x99, 0x51, 0x33, 0xB3, 0xBE, 0x90, 0x2C, 0x5C, 0x21,
-    0x8A, 0x52, 0xC5, 0x91, 0x45, 0xE9, 0xE2, 0x08, 0xA3, 0x94, 0x71, 0xA4, 0x71, 0xE8, 0x42, 0x88,
-    0xE3, 0xA8, 0xA3, 0xD9, 0x90, 0x8E, 0x3E, 0x4A, 0x20, 0x47, 0x21, 0x25, 0x91, 0x51, 0x1A, 0x29,
-    0x91, 0x8C, 0x52, 0xC9, 0x28, 0x99, 0x2C, 0x64, 0x5A, 0x44, 0x89, 0x36, 0x2F, 0x28, 0xCF, 0x28,
-    0xCD, 0x72, 0xC8, 0x92, 0x90, 0x92, 0xAC, 0x10, 0xEB, 0x87, 0xFE, 0x98, 0xD6, 0xE5, 0x74, 0x69,
-    0x43, 0x3C, 0x44, 0x30, 0x7F, 0x21, 0xB9, 0x66, 0xE4, 0xD9, 0x04, 0x52, 0x6B, 0x46, 0x99, 0x95,
-    0x52, 0x6D, 0x2F, 0x52, 0x32, 0x79, 0xF9, 0x4C, 0xFB, 0x4E, 0x72, 0xFD, 0x9E, 0xB4, 0x1F, 0xE6,
-    0x27, 0x19, 0x3E, 0x24, 0xD3, 0x3F, 0xBA, 0xCF, 0x77, 0xF6, 0x75, 0x2E, 0x06, 0xC3, 0xDA, 0xBE,
-    0x93, 0x7D, 0xAF, 0x7B, 0x81, 0x22, 0x8F, 0xEC, 0xBD, 0x13, 0x60, 0xDD, 0x76, 0x7D, 0xCB, 0xB3,
-    0x80, 0x1B, 0x2C, 0xDA, 0xB5, 0x4D, 0xF3, 0xAB, 0xC5, 0x87, 0xC3, 0xAD, 0xF8, 0xF4, 0x54, 0x5F,
-    0x94, 0x21, 0x37, 0xCB, 0xCD, 0xF9, 0x87, 0xB9, 0x1D, 0x94, 0xF4, 0x4A, 0xFC, 0x7B, 0xE4, 0xD8,
-    0x69, 0x19, 0xA3, 0x1C, 0xB5, 0xFE, 0x4A, 0x80, 0x47, 0xFA, 0xB4, 0x63, 0x25, 0x42, 0xE7, 0xF1,
-    0xC7, 0x61, 0xFE, 0xCA, 0x24, 0x06, 0x56, 0xC7, 0xFA, 0x19, 0x8E, 0xBD, 0x46, 0x24, 0x24, 0x31,
-    0xB3, 0x59, 0x3B, 0xBA, 0xEC, 0xCC, 0x29, 0x4B, 0x33, 0xA7, 0x92, 0xBD, 0xC5, 0xEC, 0x86, 0x11,
-    0xCD, 0xAD, 0xF9, 0x49, 0x88, 0x13, 0x62, 0xD5, 0xA0, 0x95, 0x4A, 0x2D, 0x36, 0x43, 0x69, 0x42,
-    0x5B, 0x14, 0x6C, 0x86, 0x53, 0xF9, 0x42, 0xB7, 0xAB, 0x39, 0xCC, 0xD9, 0x5C, 0x48, 0xC0, 0x44,
-    0xEB, 0x24, 0xA3, 0x1D, 0x07, 0xAD, 0xE7, 0x3A, 0x15, 0xB8, 0xF8, 0x44, 0xAC, 0x51, 0x64, 0x09,
-    0x5B, 0x89, 0x6F, 0xF3, 0xDD, 0x57, 0xD8, 0x17, 0x00, 0x24, 0x81, 0xE9, 0x31, 0x31, 0x91, 0xC2,
-    0xA4, 0x42, 0x5D, 0x9F, 0x33, 0x77, 0x39, 0x74, 0x97, 0x13, 0x56, 0x70, 0xF2, 0x32, 0xEE, 0x23,
-    0x97, 0x59, 0xDD, 0x2A, 0x35, 0x5F, 0xC5, 0x28, 0x97, 0xE9, 0x7E, 0x90, 0x6F, 0x47, 0x5B, 0x34,
-    0x7D, 0x18, 0x56, 0x1C, 0xE5, 0xDB, 0xF9, 0x4D, 0x7A, 0xD5, 0x71, 0x4F, 0xE6, 0x65, 0x02, 0x7E,
-    0xEB, 0xE5, 0x7D, 0x85, 0x5E, 0x4E, 0xED, 0x6B, 0x72, 0xD9, 0x32, 0x6D, 0x93, 0x22, 0xE6, 0x32,
-    0x1D, 0xFD, 0xAD, 0xBA, 0x8C, 0x76, 0x55, 0xC9, 0x68, 0x3C, 0x7C, 0xCF, 0xA1, 0xF4, 0x1F, 0x7F,
-    0x58, 0xF0, 0x20, 0x89, 0x94, 0x79, 0xF5, 0xF4, 0x03, 0x6D, 0x71, 0x4D, 0x59, 0xD6, 0x43, 0x75,
-    0x30, 0x0B, 0xB4, 0x4A, 0x4B, 0x70, 0xA1, 0x84, 0xD1, 0x68, 0x57, 0x04, 0x1A, 0xE0, 0x0B, 0xFA,
-    0x3D, 0x87, 0x40, 0x0E, 0x1E, 0x93, 0x65, 0x09, 0x11, 0x3B, 0x3D, 0x30, 0x22, 0x37, 0x52, 0xA3,
-    0xF3, 0x30, 0x66, 0x8F, 0xF8, 0xC1, 0x5D, 0xE6, 0xBE, 0xB3, 0x63, 0x16, 0xF9, 0x57, 0x54, 0xC2,
-    0x67, 0x58, 0xEE, 0x69, 0x21, 0x58, 0xE8, 0xE5, 0xA6, 0x99, 0x5C, 0xC7, 0x40, 0xA8, 0x8B, 0xB8,
-    0x11, 0x2F, 0x44, 0xC4, 0xDC, 0x78, 0x7A, 0x04, 0xD1, 0x4F, 0x1E, 0x30, 0x3F, 0x40, 0x39, 0x3D,
-    0xA4, 0x35, 0x67, 0x8D, 0xA1, 0xC5, 0x1B, 0x42, 0x31, 0xC3, 0x06, 0x0F, 0x86, 0xD0, 0x1E, 0xCF,
-    0x61, 0x84, 0xE5, 0x80, 0x3C, 0xBD, 0xA0, 0xC0, 0x44, 0x0A, 0x24, 0x7A, 0xF5, 0x0E, 0x8C, 0x5A,
-    0x1C, 0x30, 0x68, 0xB1, 0x80, 0x24, 0x67, 0x91, 0x41, 0xF6, 0xDB, 0xAD, 0x7D, 0x8F, 0x74, 0x76,
-    0x95, 0x78, 0x9A, 0x5A, 0x96, 0x69, 0xD8, 0x7B, 0x04, 0xCE, 0x15, 0x6B, 0xFF, 0xEA, 0xA4, 0xCC,
-    0x83, 0x3E, 0x68, 0x66, 0x6D, 0x91, 0x5D, 0x32, 0xE9, 0xCB, 0x4D, 0x54, 0xF9, 0x8D, 0x35, 0x83,
-    0x81, 0xB4, 0x8B, 0xEA, 0xB8, 0xC6, 0xB8, 0x06, 0x7D, 0xD8, 0x46, 0xF7, 0x61, 0x2A, 0x30, 0x5E,
-    0x7B, 0x05, 0x76, 0xB3, 0x66, 0x6F, 0x68, 0x5D, 0x87, 0x64, 0xAA, 0x7E, 0x85, 0xA7, 0x6E, 0xFE,
-    0x3E, 0xB2, 0x65, 0x3D, 0x69, 0xC6, 0x8F, 0xCD, 0x96, 0xDD, 0xA9, 0x97, 0x6D, 0x35, 0x50, 0x19,
-    0x0B, 0x50, 0x2E, 0x26, 0xC3, 0xBD, 0x73, 0x05, 0x16, 0x89, 0x7E, 0xBB, 0x9E, 0xAC, 0xC0, 0xD9,
-    0x6A, 0x30, 0x9F, 0x35, 0x80, 0x4C, 0x23, 0xCF, 0xB6, 0x7F, 0xE9, 0xE9, 0xDB, 0xC2, 0x5C, 0xB0,
-    0xCD, 0x41, 0x06, 0x90, 0x45, 0x08, 0x6B, 0xCD, 0x1F, 0x3B, 0xF0, 0x1B, 0x19, 0x95, 0xBD, 0xCD,
-    0xDA, 0x99, 0xE9, 0x45, 0xB5, 0xB2, 0xD8, 0x25, 0xB0, 0x13, 0x8E, 0x7B, 0x9A, 0xB6, 0x5E, 0x79,
-    0xFD, 0xD7, 0x9B, 0xCD, 0x77, 0x25, 0x11, 0x33, 0x1F, 0x7B, 0x2A, 0xE6, 0x5B, 0xAC, 0x60, 0x5B,
-    0xBA, 0xAB, 0x99, 0xAA, 0x31, 0x2B, 0xDB, 0xE1, 0x53, 0xF7, 0xDF, 0x97, 0xEA, 0xEA, 0xA7, 0x6D,
-    0xD1, 0xFA, 0x66, 0xDD, 0xB3, 0x62, 0xB7, 0x1D, 0x32, 0x9A, 0x7D, 0x5E, 0x50, 0xCF, 0x95, 0x18,
-    0x11, 0x86, 0x98, 0x20, 0x26, 0x98, 0xFE, 0x8A, 0x89, 0x0B, 0xA1, 0x0F, 0x13, 0x15, 0xB4, 0x96,
-    0x10, 0x2E, 0x4D, 0xD4, 0xBC, 0xA5, 0x7B, 0xD0, 0xDE, 0x11, 0x37, 0xCA, 0x4D, 0xC5, 0x05, 0xED,
-    0x54, 0x98, 0xA8, 0x4A, 0x3B, 0x71, 0xEC, 0xC9, 0xB1, 0x29, 0xD4, 0x7C, 0xA9, 0x57, 0xBC, 0xA1,
-    0x1E, 0x0E, 0xA9, 0x9C, 0x9D, 0xB9, 0x57, 0x17, 0x7F, 0x9C, 0x12, 0xA0, 0x17, 0xBB, 0x3C, 0xBF,
-    0x61, 0x35, 0x03, 0x1C, 0xC0, 0x62, 0x11, 0xB7, 0x9C, 0x44, 0xAC, 0x2A, 0xAB, 0xFD, 0x51, 0x02,
-    0xD1, 0xF4, 0x6D, 0x1C, 0xEB, 0x88, 0x85, 0x39, 0x5A, 0xAC, 0x38, 0x10, 0x0F, 0x36, 0x07, 0xBA,
-    0x77, 0x19, 0x81, 0x56, 0x6C, 0x13, 0x17, 0x09, 0x7B, 0xB4, 0xB1, 0x6F, 0x6E, 0xA6, 0xF7, 0x6E,
-    0x9E, 0xF2, 0xDE, 0xD1, 0xA3, 0xEF, 0x7D, 0x57, 0xDE, 0xFB, 0xF6, 0x38, 0x39, 0x45, 0xC4, 0x3F,
-    0x77, 0x70, 0xC3, 0x8E, 0x27, 0x84, 0x71, 0x34, 0xD9, 0xBB, 0x52, 0x7E, 0xFE, 0x7E, 0xEF, 0x0D,
-    0xD5, 0x11, 0xB7, 0xF4, 0x6B, 0x96, 0x79, 0xE5, 0x8F, 0x52, 0xAC, 0x45, 0x80, 0x59, 0x06, 0x03,
-    0x1D, 0x7B, 0x1D, 0xC5, 0x3A, 0x0B, 0x02, 0x72, 0xA9, 0xF3, 0xBB, 0xD9, 0x68, 0xE1, 0x61, 0xA0,
-    0xD5, 0xB8, 0x02, 0x9E, 0x4B, 0x6F, 0x5E, 0x8C, 0xF3, 0x63, 0x53, 0x6E, 0x56, 0xAF, 0x26, 0x63,
-    0x32, 0x65, 0x5B, 0x88, 0xC3, 0x5B, 0x28, 0x70, 0xF0, 0x84, 0x3A, 0x1E, 0xE2, 0x56, 0x1C, 0x69,
-    0x8D, 0x96, 0x64, 0xCF, 0xF8, 0x03, 0x5B, 0xAF, 0xD6, 0xB7, 0x95, 0x4B, 0x2C, 0x92, 0x00, 0xF3,
-    0x2A, 0xED, 0x34, 0xCD, 0xDE, 0x19, 0x7A, 0x02, 0xD4, 0x14, 0x50, 0xF6, 0xAB, 0xFA, 0x40, 0xCF,
-    0xC5, 0xBC, 0x94, 0x15, 0x1C, 0xA4, 0xE7, 0xA4, 0x1B, 0xC8, 0x06, 0x0C, 0x0C, 0xF1, 0xDD, 0x13,
-    0x5A, 0x2D, 0x98, 0xA6, 0xA5, 0x54, 0xCE, 0xE0, 0xD7, 0x8C, 0x9E, 0x75, 0x8C, 0xB8, 0x82, 0x40,
-    0x4D, 0xCD, 0x7A, 0x64, 0x6F, 0x24, 0x7A, 0x93, 0x33, 0x02, 0x9D, 0xA5, 0x65, 0x52, 0xFA, 0x1D,
-    0xEC, 0xD5, 0xE2, 0x58, 0x2D, 0x6F, 0xEF, 0x59, 0xB5, 0x3C, 0x44, 0xFE, 0xCF, 0x04, 0x3D, 0xB7,
-    0x9A, 0x7C, 0x64, 0xD1, 0x77, 0x96, 0x26, 0xE4, 0x55, 0x01, 0xC4, 0x16, 0xF7, 0x49, 0x23, 0xE6,
-    0x3D, 0x6F, 0xF9, 0x86, 0x4C, 0x01, 0x92, 0xEA, 0x88, 0xFA, 0x59, 0xA2, 0x46, 0x24, 0x5B, 0x2A,
-    0xC5, 0x12, 0x95, 0x95, 0x3C, 0x02, 0x5F, 0x47, 0x86, 0x73, 0x87, 0x99, 0x46, 0xA5, 0x38, 0x5E,
-    0x7E, 0xFB, 0x4B, 0x76, 0x7E, 0x72, 0x38, 0xAE, 0x9E, 0x81, 0x5A, 0xB1, 0x8A, 0x54, 0x03, 0xD8,
-    0x51, 0xFD, 0x06, 0xDD, 0x74, 0x69, 0x0A, 0xEB, 0xBA, 0x5C, 0x86, 0x29, 0x39, 0xD8, 0xA4, 0xEB,
-    0x97, 0x8C, 0x59, 0x2E, 0x2F, 0x1C, 0x24, 0x1F, 0x52, 0x8D, 0x5C, 0xC1, 0x58, 0x2F, 0x60, 0xDD,
-    0x40, 0xF2, 0xB3, 0x7C, 0x1B, 0xBA, 0xBD, 0xF6, 0x9F, 0x7C, 0xAA, 0x70, 0xBC, 0x2A, 0xAC, 0x9A,
-    0x25, 0x9A, 0x09, 0xE7, 0xB7, 0x4A, 0x65, 0x8D, 0xCA, 0x98, 0xF7, 0x0F, 0x66, 0x66, 0x9E, 0xD1,
-    0x00, 0x2F, 0x73, 0xD9, 0x55, 0xD3, 0x0E, 0xE6, 0x46, 0xC1, 0x24, 0x8C, 0x3D, 0x3B, 0x5B, 0x26,
-    0x15, 0x66, 0x53, 0x4C, 0x6F, 0xA3, 0x24, 0x42, 0x4A, 0xB0, 0x56, 0x7D, 0xAE, 0x87, 0x7E, 0x2E,
-    0xFC, 0xFE, 0xC4, 0x9D, 0xA4, 0xD0, 0x8A, 0x0B, 0x72, 0x67, 0x97, 0x0F, 0xAE, 0x54, 0x6D, 0x6D,
-    0x17, 0x36, 0x61, 0x53, 0x98, 0x3C, 0x6C, 0x82, 0x26, 0x37, 0x69, 0x80, 0x17, 0x7A, 0xC1, 0xA4,
-    0x7E, 0x1D, 0x34, 0xE9, 0x8B, 0x74, 0xB7, 0x32, 0xDD, 0xC5, 0x1C, 0xFA, 0xEF, 0x82, 0xEC, 0x24,
-    0x07, 0x18, 0x07, 0x7F, 0xCB, 0x68, 0xFD, 0xA9, 0x4E, 0x7A, 0x77, 0xE1, 0x29, 0xD9, 0xED, 0xA9,
-    0xDF, 0x7F, 0x24, 0x5B, 0xD0, 0x17, 0x69, 0x04, 0x8B, 0xF3, 0x31, 0xD9, 0xED, 0xF9, 0x4B, 0xE0,
-    0xC4, 0x19, 0xB7, 0x41, 0x36, 0x97, 0xDD, 0xFE, 0x2F, 0xCC, 0x7B, 0xAD, 0xFF, 0x65, 0x19, 0x9D,
-    0x35, 0x2F, 0xBC, 0x71, 0x7C, 0xEB, 0xD6, 0xD5, 0x5B, 0x37, 0x93, 0x73, 0x83, 0xCB, 0x34, 0xC9,
-    0xCF, 0x2E, 0xDE, 0x48, 0xBD, 0xA6, 0xF7, 0x8E, 0x34, 0x92, 0x53, 0x61, 0xD6, 0x92, 0x94, 0x06,
-    0x17, 0xF7, 0xD8, 0x69, 0x8C, 0x6E, 0xB8, 0xB5, 0xF1, 0xD0, 0x6E, 0x06, 0xAE, 0x60, 0x64, 0x10,
-    0x44, 0xC4, 0xE8, 0x12, 0xC1, 0x50, 0x4B, 0x9C, 0x77, 0x94, 0xE5, 0xEA, 0x4C, 0x20, 0x3B, 0xB3,
-    0x56, 0x8D, 0x23, 0x05, 0x52, 0xAC, 0x8C, 0x42, 0x83, 0xA1, 0x37, 0x41, 0x71, 0xB2, 0xFE, 0xCA,
-    0xAA, 0x21, 0x71, 0x6A, 0x67, 0x39, 0x8A, 0x8F, 0x8E, 0x01, 0x3F, 0x89, 0xF7, 0xC5, 0x82, 0x46,
-    0xF0, 0x1C, 0x06, 0xFB, 0x24, 0xD6, 0xC7, 0xF8, 0xDE, 0x11, 0x46, 0xFA, 0xD8, 0x38, 0xCD, 0x38,
-    0x1F, 0xC3, 0x7C, 0x57, 0xAC, 0x2E, 0x98, 0x61, 0xAF, 0x5A, 0xF7, 0x9C, 0xAB, 0x8C, 0xF0, 0xAD,
-    0x02, 0x7C, 0xDE, 0xEB, 0x99, 0x2B, 0x2E, 0x72, 0x7C, 0xBC, 0x56, 0x5D, 0xA9, 0xBF, 0x67, 0x8C,
-    0x4C, 0x50, 0x6F, 0x4A, 0xB5, 0xB5, 0x6F, 0x21, 0xC5, 0x4A, 0x5D, 0x51, 0x40, 0x97, 0x40, 0xD9,
-    0x81, 0x47, 0x1A, 0xAD, 0x50, 0xB1, 0xB6, 0xEF, 0x94, 0xB5, 0xCB, 0x13, 0xAB, 0xF2, 0x96, 0x55,
-    0x69, 0xCC, 0xA4, 0x4A, 0x9D, 0x11, 0xFB, 0x63, 0x11, 0x4D, 0x5F, 0x79, 0x97, 0x26, 0x7F, 0xDC,
-    0xC2, 0x55, 0x64, 0xD6, 0xCE, 0xE1, 0xD6, 0xB9, 0x12, 0xCD, 0xD1, 0x75, 0x4A, 0x9D, 0xB9, 0x1B,
-    0xA3, 0x40, 0xA0, 0xE4, 0x2B, 0xB1, 0x4A, 0x45, 0x1F, 0xDF, 0xEE, 0x0E, 0x2D, 0xC2, 0xD6, 0x6F,
-    0x0B, 0x93, 0xBE, 0x7D, 0xEA, 0xEE, 0x5A, 0xC5, 0xCE, 0x51, 0x5D, 0x8D, 0xC5, 0xD8, 0xF9, 0x6A,
-    0x55, 0x05, 0x80, 0x0D, 0x8F, 0x77, 0x7B, 0xF7, 0x23, 0xA3, 0x01, 0x24, 0x97, 0x88, 0x20, 0x8E,
-    0x05, 0x73, 0x48, 0xF1, 0x95, 0xB7, 0xCC, 0x5C, 0x14, 0xA6, 0x75, 0xB9, 0xA7, 0xA3, 0x73, 0xBF,
-    0x3A, 0x7D, 0xE1, 0x15, 0x55, 0x21, 0xC9, 0x07, 0x71, 0x83, 0x63, 0x51, 0xCF, 0x5F, 0x6B, 0xDD,
-    0xEB, 0x77, 0x5A, 0x52, 0xE0, 0x92, 0xC8, 0x57, 0x28, 0x12, 0xBD, 0xF0, 0x4E, 0x5A, 0xFB, 0xCD,
-    0x7C, 0x2D, 0x7D, 0x7F, 0xE6, 0x44, 0xC5, 0xCC, 0x85, 0x1D, 0x18, 0xA1, 0x31, 0x7F, 0x2A, 0x00,
-    0x63, 0x53, 0x5C, 0x7F, 0x53, 0x9D, 0x6A, 0xEA, 0x8E, 0xD3, 0x3A, 0x33, 0xC1, 0x94, 0x3E, 0x64,
-    0x35, 0x65, 0x0C, 0x1D, 0x73, 0xD9, 0x01, 0x85, 0x79, 0xFA, 0xF1, 0x75, 0xB3, 0x46, 0x3B, 0x7D,
-    0x44, 0x7F, 0x08, 0xE6, 0xE5, 0xAC, 0x03, 0xED, 0x2E, 0x9F, 0x54, 0xDA, 0x49, 0xE2, 0x96, 0x2C,
-    0xC4, 0x23, 0x19, 0xA1, 0xEF, 0xAE, 0x4C, 0x55, 0xD2, 0x2E, 0x23, 0xED, 0x2E, 0x4D, 0xC6, 0x7D,
-    0x3A, 0x19, 0x76, 0x19, 0x4B, 0xD6, 0x48, 0xBB, 0x40, 0xD3, 0xD7, 0xE4, 0x0D, 0xDF, 0xFC, 0x6D,
-    0x56, 0x2D, 0xD9, 0x9D, 0x4B, 0xA0, 0x1D, 0xF7, 0xC7, 0x57, 0xAC, 0x23, 0xD5, 0xB4, 0x1E, 0xC2,
-    0xE4, 0xAC, 0xA5, 0x3F, 0xC9, 0xB9, 0x23, 0x9F, 0xA5, 0x20, 0xF5, 0x3B, 0x13, 0x6F, 0xFE, 0x7F,
-    0xAF, 0x5A, 0x5E, 0x0F, 0xA6, 0x67, 0xEA, 0x8B, 0x94, 0xA5, 0x18, 0xCC, 0xCA, 0x55, 0x6C, 0x34,
-    0xAC, 0xA8, 0x7C, 0x35, 0xFC, 0x40, 0xDA, 0x46, 0x30, 0x80, 0x1A, 0x49, 0xF1, 0x68, 0x62, 0xEB,
-    0x49, 0x28, 0xFB, 0x6D, 0xDA, 0x59, 0x34, 0x12, 0x48, 0x46, 0x01, 0x40, 0xB6, 0xD1, 0x05, 0x97,
-    0xCE, 0x8E, 0x12, 0xDE, 0x8E, 0x86, 0xE2, 0x96, 0x10, 0xA1, 0x78, 0x38, 0xCA, 0xD4, 0x58, 0xB9,
-    0xE6, 0xA3, 0x89, 0x3A, 0xF9, 0x8E, 0xD3, 0xBE, 0x9B, 0xE2, 0xA5, 0x0B, 0xF7, 0x89, 0xD1, 0xAC,
-    0x4D, 0x91, 0xD9, 0xE4, 0xF2, 0x2F, 0x56, 0x4E, 0x88, 0xDB, 0xB6, 0x90, 0xEC, 0x84, 0xFB, 0xF8,
-    0x4F, 0x7C, 0x03, 0x2B, 0xEB, 0x65, 0x66, 0x8B, 0xC0, 0xE8, 0x83, 0xE5, 0xD7, 0x79, 0x27, 0xBC,
-    0x79, 0x16, 0x31, 0x93, 0x1D, 0x86, 0x58, 0xE3, 0x59, 0x49, 0x2B, 0x62, 0x52, 0x2D, 0x61, 0x75,
-    0x71, 0x7D, 0x80, 0x61, 0x93, 0x37, 0xEA, 0x48, 0x17, 0x72, 0xEA, 0x1A, 0x13, 0x83, 0x33, 0x0E,
-    0x72, 0xF1, 0xFE, 0xB2, 0xB6, 0x77, 0xDC, 0xB0, 0x55, 0xD2, 0x06, 0xB4, 0x34, 0x7D, 0x2E, 0x5E,
-    0xE4, 0x33, 0x07, 0x9E, 0xE9, 0x9F, 0x74, 0x3C, 0x43, 0x0B, 0xDC, 0xA0, 0x40, 0xDD, 0x77, 0xC2,
-    0xAD, 0x8B, 0x53, 0x4F, 0x65, 0x77, 0xBD, 0xAB, 0xD4, 0x23, 0xC3, 0xAD, 0x72, 0x2D, 0x0E, 0xBC,
-    0x78, 0x21, 0xA8, 0x46, 0xD8, 0x8E, 0xE6, 0xA3, 0x3C, 0x4B, 0xF2, 0x32, 0xBA, 0x5D, 0xD2, 0x64,
-    0xA6, 0xE7, 0x91, 0x85, 0x2D, 0x6D, 0xB0, 0x6D, 0xDF, 0x86, 0xF5, 0x98, 0x9B, 0x22, 0x29, 0xE3,
-    0x6B, 0x8D, 0x7F, 0x97, 0xD9, 0x80, 0x4C, 0xD5, 0x64, 0x60, 0x73, 0x41, 0xBF, 0xE2, 0x3E, 0xE3,
-    0xD6, 0x22, 0x12, 0x39, 0x2A, 0x56, 0xBC, 0x66, 0x57, 0xB1, 0xF2, 0xD8, 0x48, 0xC1, 0xB1, 0x94,
-    0x1E, 0x4B, 0x11, 0xB2, 0xD4, 0x1E, 0xA3, 0x9B, 0x74, 0x5B, 0xB0, 0xF8, 0x98, 0x58, 0xB7, 0x92,
-    0x52, 0x63, 0x23, 0x45, 0xC7, 0x52, 0x7E, 0xEC, 0xEF, 0x9C, 0xCC, 0x6B, 0xBC, 0x1A, 0x0B, 0x90,
-    0x17, 0x39, 0xC0, 0xF1, 0xC8, 0x52, 0x11, 0x7B, 0x8C, 0x30, 0xE3, 0x0A, 0x0D, 0x52, 0x32, 0x2F,
-    0xDF, 0x46, 0x4B, 0x19, 0x45, 0x05, 0x04, 0x2A, 0xEB, 0x39, 0x84, 0xCB, 0xF3, 0x82, 0x96, 0xE9,
-    0x53, 0x4F, 0x98, 0xA1, 0x05, 0x13, 0xB9, 0x8F, 0xCB, 0x10, 0x00, 0x22, 0x79, 0xBB, 0x37, 0x97,
-    0x82, 0x86, 0x60, 0x32, 0xAA, 0x20, 0x9E, 0xA0, 0xD4, 0x87, 0xB0, 0xF1, 0xDB, 0xA4, 0x2C, 0xCA,
-    0xE2, 0x4B, 0x28, 0xBE, 0xE8, 0xBC, 0x58, 0x8E, 0xB5, 0x84, 0x0B, 0x7C, 0x69, 0x8A, 0xAB, 0xAB,
-    0xDC, 0xB5, 0xEF, 0x76, 0xED, 0xD5, 0xD9, 0xF7, 0xB8, 0x7D, 0xA5, 0x6E, 0xAD, 0x5D, 0x7B, 0x71,
-    0x70, 0xAD, 0x39, 0xFB, 0xEA, 0x27, 0xEE, 0xC5, 0xA5, 0x25, 0x8E, 0xAC, 0x56, 0xF6, 0xBD, 0x38,
-    0xB3, 0x7A, 0x71, 0x65, 0xA9, 0x14, 0xE0, 0x7E, 0x9F, 0x98, 0x5C, 0x89, 0x13, 0xEA, 0xBA, 0x97,
-    0xFA, 0x3E, 0xB5, 0xCA, 0xA6, 0x92, 0xDF, 0xDC, 0x10, 0x40, 0xB9, 0x4D, 0x9D, 0x81, 0x6E, 0x0B,
-    0x65, 0x2B, 0xB2, 0x90, 0x51, 0xFB, 0xDD, 0xDB, 0xA7, 0xAF, 0x75, 0xC5, 0x02, 0x53, 0xA7, 0x84,
-    0x4D, 0x50, 0x4A, 0xA5, 0xCC, 0xE8, 0x62, 0x05, 0x83, 0xD2, 0xFF, 0x60, 0xF6, 0x07, 0x40, 0x9D,
-    0xC6, 0xED, 0xC5, 0xC5, 0x27, 0xD4, 0x19, 0x77, 0x2A, 0x34, 0xD3, 0x61, 0x45, 0x29, 0x97, 0xE8,
-    0x92, 0xB7, 0x2B, 0x33, 0x5C, 0xF7, 0x9A, 0xCA, 0xEC, 0x4F, 0x81, 0x7A, 0x52, 0x28, 0x2E, 0xBD,
-    0x9E, 0xFE, 0xC0, 0x17, 0xC1, 0x83, 0x15, 0xC9, 0x14, 0x57, 0xDE, 0xE0, 0x4E, 0x24, 0x15, 0x69,
-    0x95, 0x38, 0x98, 0xC2, 0x55, 0xEB, 0xB8, 0x70, 0x48, 0x97, 0xDC, 0x3F, 0x39, 0x86, 0x9D, 0x54,
-    0xD2, 0x32, 0x96, 0x29, 0x2E, 0x00, 0x82, 0x5C, 0x09, 0x49, 0x4F, 0x89, 0x4E, 0x22, 0x9B, 0x16,
-    0x8C, 0xCC, 0x10, 0x6B, 0x1F, 0x1D, 0xD7, 0x41, 0x1B, 0x41, 0xF6, 0x15, 0xE2, 0xB9, 0x9D, 0x06,
-    0x84, 0xC3, 0xC7, 0x9C, 0x1A, 0x09, 0x26, 0xC5, 0x65, 0x20, 0xA7, 0x7E, 0x2A, 0x37, 0xEA, 0x05,
-    0x64, 0x7B, 0x4B, 0xAD, 0x12, 0x2F, 0xA7, 0x7C, 0xD0, 0xD2, 0x45, 0xE1, 0x0B, 0xD7, 0x90, 0x92,
-    0xE8, 0x74, 0x57, 0x43, 0x58, 0x63, 0xF1, 0xCF, 0xCC, 0x7F, 0x4C, 0xCC, 0x87, 0x7F, 0x66, 0x3E,
-    0xFC, 0x57, 0xE6, 0xC3, 0x7F, 0xCD, 0x9F, 0x1E, 0x3F, 0x80, 0xC0, 0x09, 0xB1, 0x45, 0xEF, 0x0F,
-    0x6F, 0x30, 0x30, 0x17, 0x49, 0xE6, 0x23, 0x25, 0x4C, 0xBD, 0xF3, 0xA3, 0x2E, 0x9D, 0xC8, 0x4A,
-    0x89, 0x87, 0x1C, 0xE8, 0xA6, 0xC9, 0x12, 0xF1, 0x18, 0x65, 0x12, 0xA5, 0xE1, 0x81, 0x0B, 0x5B,
-    0x65, 0x84, 0x3A, 0x62, 0x6D, 0xB0, 0x82, 0x1B, 0x07, 0x7A, 0xC2, 0x16, 0x09, 0x17, 0x58, 0xB0,
-    0x8B, 0x94, 0xEA, 0x04, 0x87, 0x07, 0xF6, 0xD8, 0x88, 0xC3, 0x3D, 0x7B, 0x8E, 0x07, 0x80, 0x85,
-    0x6D, 0x1C, 0x20, 0x44, 0xEF, 0xD2, 0x8F, 0x6E, 0xED, 0x3D, 0x1E, 0x0A, 0x56, 0xDD, 0x33, 0x1C,
-    0x7B, 0x83, 0x07, 0xAE, 0x2C, 0x50, 0x32, 0xDB, 0xFD, 0x34, 0x0F, 0x11, 0x00, 0x59, 0x49, 0x75,
-    0x1A, 0xF0, 0x10, 0xEA, 0xC1, 0xA7, 0x86, 0xCA, 0xFB, 0x69, 0x5D, 0xB4, 0xC9, 0xEC, 0x76, 0x2C,
-    0xE1, 0x78, 0xC2, 0x31, 0xC5, 0x94, 0xFE, 0x94, 0xBB, 0xC5, 0xA4, 0x9A, 0xB5, 0x83, 0x72, 0x06,
-    0xA9, 0xA7, 0x19, 0xE8, 0x8B, 0x60, 0x90, 0x55, 0x07, 0xE8, 0x20, 0xA9, 0xF2, 0x3E, 0x60, 0x00,
-    0x36, 0x05, 0x3E, 0xAF, 0x59, 0x14, 0x71, 0x0D, 0x1A, 0xB1, 0xC8, 0x8B, 0xB7, 0x7B, 0x3B, 0x8C,
-    0xE1, 0x3D, 0x7B, 0xAF, 0x4B, 0xAE, 0xDA, 0x73, 0x75, 0x11, 0x0D, 0xF9, 0xC7, 0x43, 0x7A, 0xC7,
-    0x62, 0x9A, 0xBD, 0x83, 0x81, 0x1C, 0x92, 0xA6, 0x58, 0xA8, 0x09, 0xA4, 0xAB, 0x24, 0x66, 0x0E,
-    0x45, 0x0A, 0x38, 0x27, 0x6F, 0x88, 0x49, 0x10, 0x35, 0xF6, 0x6C, 0x6F, 0xAF, 0xF7, 0xC5, 0xB5,
-    0xB5, 0x9F, 0xAB, 0x7D, 0xAE, 0x3F, 0x9F, 0x0D, 0xF9, 0x8D, 0xA9, 0x6A, 0x37, 0xE8, 0x18, 0xF2,
-    0xF3, 0xEC, 0xBB, 0xFC, 0xAE, 0x6A, 0xDB, 0x40, 0x35, 0x59, 0xA1, 0x79, 0x1B, 0xCB, 0xEC, 0x49,
-    0xAB, 0xF0, 0x65, 0xAB, 0xA2, 0x71, 0x47, 0x8B, 0x48, 0x14, 0x5E, 0xE8, 0xB2, 0x3F, 0xB4, 0x74,
-    0x5A, 0x0C, 0x35, 0x7B, 0x56, 0x84, 0xC9, 0x0D, 0x09, 0xC1, 0x30, 0x52, 0xAF, 0x1E, 0x0A, 0x23,
-    0xF4, 0xA0, 0xA5, 0xC5, 0x53, 0xB0, 0x04, 0xE9, 0x4F, 0xAB, 0xC4, 0xF0, 0xDA, 0x9A, 0xBB, 0x32,
-    0x4A, 0xF5, 0x9B, 0x5B, 0x35, 0x78, 0xEB, 0xD9, 0x5A, 0x5A, 0x14, 0x8B, 0x3D, 0x8D, 0xAD, 0x13,
-    0x87, 0x87, 0xF8, 0xE0, 0xA3, 0x62, 0xCB, 0x37, 0x87, 0xB3, 0x03, 0xE7, 0xE3, 0xAD, 0x53, 0x9D,
-    0xAF, 0xEB, 0x1E, 0x8E, 0x1A, 0x91, 0xDA, 0xD8, 0xDA, 0x9B, 0x51, 0xFC, 0xBB, 0xAC, 0x15, 0x9C,
-    0xBD, 0x77, 0x60, 0x93, 0xEF, 0x2B, 0xB1, 0xB3, 0xFC, 0xB2, 0xDD, 0x79, 0xD3, 0x41, 0x97, 0x90,
-    0x3B, 0xF6, 0x84, 0xD5, 0x0C, 0x65, 0xBC, 0x26, 0xBB, 0x44, 0xF9, 0x46, 0xF9, 0x2C, 0x91, 0x53,
-    0x1A, 0xCB, 0x0A, 0x46, 0x59, 0x3D, 0x69, 0x94, 0x3C, 0x34, 0x7A, 0xB3, 0x8C, 0x48, 0x0A, 0x32,
-    0x01, 0xB3, 0x23, 0xE2, 0x56, 0x93, 0x7C, 0x66, 0x4A, 0xCD, 0x9C, 0x69, 0x58, 0x19, 0x4F, 0xD9,
-    0xAF, 0x4F, 0x32, 0xCE, 0x2C, 0x38, 0x43, 0xEA, 0xEE, 0x9C, 0x59, 0x23, 0x34, 0x15, 0xFF, 0x85,
-    0x95, 0xF2, 0x5E, 0x5F, 0x03, 0xA1, 0x0A, 0x83, 0x92, 0x41, 0x17, 0x0E, 0x2A, 0x0F, 0x1E, 0x3F,
-    0x88, 0xBB, 0x44, 0xA0, 0x23, 0xA3, 0xD6, 0x97, 0x99, 0x0C, 0x96, 0x37, 0xC9, 0x90, 0xE0, 0xD5,
-    0x8F, 0xD9, 0xDD, 0x6C, 0xB1, 0x5F, 0x57, 0x1B, 0x63, 0x61, 0x7D, 0xE7, 0x03, 0x67, 0x78, 0x5C,
-    0x07, 0x64, 0x84, 0x2D, 0x42, 0x8B, 0x99, 0x0E, 0x84, 0xA3, 0xE8, 0xC0, 0x2F, 0x3A, 0xD0, 0xF1,
-    0x4D, 0x60, 0x08, 0x12, 0xF6, 0xEA, 0xD6, 0x2B, 0x52, 0x81, 0x21, 0xCB, 0x4F, 0xF8, 0x1A, 0xB0,
-    0xBA, 0x0D, 0x3B, 0x50, 0xAC, 0x9D, 0x7D, 0x7F, 0xB1, 0x5C, 0x8A, 0x32, 0x4A, 0xEE, 0x39, 0xA0,
-    0x95, 0x3F, 0x70, 0xA8, 0xC9, 0x3E, 0x54, 0xF4, 0x49, 0xAC, 0xF0, 0xF3, 0xE3, 0x0A, 0xB8, 0xC6,
-    0x09, 0x9F, 0x3A, 0xAB, 0xF1, 0x81, 0x6B, 0x24, 0x77, 0x5D, 0x23, 0xFD, 0x85, 0x1D, 0xE7, 0xFF,
-    0x9E, 0x54, 0xBB, 0xAC, 0xE6, 0x97, 0x91, 0x08, 0xE4, 0x20, 0xE4, 0xD2, 0x46, 0x30, 0xBA, 0x06,
-    0xE8, 0x56, 0x8C, 0xAE, 0xFA, 0x21, 0x5F, 0x2D, 0xEB, 0x38, 0x4E, 0x78, 0x77, 0x9C, 0x12, 0x57,
-    0xB8, 0x4E, 0xE8, 0x6C, 0x32, 0x3D, 0x7D, 0xD7, 0x68, 0x43, 0x9C, 0x26, 0xBD, 0xBB, 0x58, 0xE3,
-    0xB1, 0x56, 0x23, 0xD7, 0x52, 0x63, 0xD1, 0x69, 0xE3, 0x51, 0x46, 0x00, 0x27, 0xEE, 0xD7, 0x8F,
-    0x9F, 0xC3, 0xCB, 0xC6, 0x6A, 0xBC, 0x82, 0x25, 0x71, 0xBB, 0x96, 0x5C, 0xD9, 0x9A, 0x82, 0x8C,
-    0x39, 0x2E, 0x8B, 0x4A, 0xAB, 0x86, 0xBB, 0x54, 0x61, 0x64, 0xAC, 0x4B, 0x63, 0x5D, 0x03, 0x93,
-    0x6E, 0x9F, 0x60, 0x9A, 0xAF, 0x64, 0xCD, 0xBC, 0xA5, 0xDE, 0x3B, 0x72, 0xEB, 0x68, 0x82, 0xD3,
-    0xDA, 0xB3, 0x5A, 0xAD, 0xC1, 0xCE, 0x85, 0x10, 0x40, 0x3E, 0x89, 0xC3, 0x90, 0x79, 0x8B, 0xBF,
-    0x33, 0x07, 0xDE, 0xF3, 0x2E, 0x18, 0x96, 0x2C, 0x45, 0x2E, 0xC1, 0x51, 0x1D, 0x86, 0xB3, 0x75,
-    0xE7, 0xFE, 0x6E, 0xAB, 0xE4, 0xFF, 0xE5, 0xC2, 0x4D, 0x07, 0xCE, 0x7B, 0x17, 0xC4, 0xE0, 0x2A,
-    0xB4, 0xBA, 0xA9, 0x94, 0xD8, 0x6E, 0x38, 0x66, 0xDF, 0x01, 0xF5, 0xF7, 0x8F, 0x99, 0x18, 0x95,
-    0x11, 0x17, 0x0D, 0x19, 0x64, 0x9D, 0x83, 0xF4, 0x08, 0xA8, 0xD8, 0x4C, 0x77, 0x66, 0x49, 0xDC,
-    0xE7, 0xE3, 0x5C, 0x35, 0x6B, 0x2E, 0xB1, 0xEB, 0x6C, 0xF6, 0xB1, 0xF3, 0x25, 0xF4, 0x81, 0xCB,
-    0xC4, 0x5C, 0x78, 0xC5, 0x24, 0x3B, 0x66, 0x6C, 0x85, 0x13, 0x56, 0x1D, 0x75, 0x60, 0x35, 0x60,
-    0x27, 0xC3, 0xE6, 0x7D, 0x65, 0x4E, 0xB9, 0x5C, 0xB8, 0x72, 0xB5, 0x6C, 0xAD, 0xFD, 0x78, 0x59,
-    0x4C, 0xE6, 0xF7, 0x15, 0x3B, 0xF1, 0x3C, 0xAC, 0x0E, 0x32, 0x4C, 0x24, 0xAE, 0x26, 0x0A, 0xF5,
-    0xDA, 0x67, 0xAD, 0x13, 0xB8, 0xA0, 0xB0, 0x6E, 0xC5, 0x4E, 0x4F, 0xEC, 0x03, 0xAF, 0x58, 0x55,
-    0x58, 0xFD, 0xF4, 0x3D, 0x72, 0xB9, 0x70, 0x5B, 0x36, 0x79, 0x3C, 0xFE, 0x49, 0xA6, 0x61, 0xC0,
-    0x4E, 0xF1, 0xD5, 0xBE, 0xE2, 0x9D, 0x55, 0xDE, 0x9A, 0xC4, 0x6B, 0xBE, 0xB1, 0x01, 0x4B, 0xA5,
-    0x98, 0xDE, 0x19, 0xE9, 0xA2, 0x2E, 0xA5, 0x10, 0x46, 0x97, 0x39, 0x5D, 0xBC, 0x4E, 0x3F, 0x14,
-    0x11, 0x46, 0x5A, 0x4B, 0x7A, 0x0A, 0xC5, 0x86, 0x2C, 0x93, 0x13, 0xD8, 0xF8, 0xA9, 0x8B, 0xEE,
-    0xFE, 0x71, 0xD2, 0xC2, 0x7F, 0x84, 0x16, 0x01, 0x68, 0x91, 0x96, 0x5C, 0xB9, 0x2F, 0x2D, 0x83,
-    0x81, 0x6E, 0xF4, 0x97, 0x07, 0x96, 0x67, 0x2F, 0x0E, 0xBF, 0x27, 0x89, 0x75, 0x87, 0x17, 0xAE,
-    0x2C, 0x85, 0x1F, 0x50, 0x41, 0xC3, 0xF2, 0x65, 0x55, 0xF0, 0x2F, 0x3B, 0x12, 0x01, 0x5B, 0x64,
-    0x0E, 0x0E, 0xAC, 0x52, 0xE3, 0x7E, 0xD0, 0xBF, 0x04, 0x72, 0xD9, 0x89, 0x66, 0xA6, 0xA4, 0x4B,
-    0xF0, 0x99, 0x8B, 0x80, 0x14, 0x92, 0x66, 0xA0, 0xA8, 0x55, 0x12, 0x5A, 0x7B, 0xA1, 0x6B, 0x02,
-    0x8A, 0x0A, 0x66, 0xE4, 0xBA, 0x07, 0x67, 0x05, 0xAE, 0xE4, 0xDF, 0xC2, 0xF0, 0x97, 0xBC, 0x7D,
-    0x9B, 0x3F, 0x98, 0x92, 0x2F, 0x9D, 0x39, 0x9D, 0x4C, 0x6E, 0x63, 0x7F, 0x95, 0x4F, 0x96, 0x4F,
-    0x16, 0xB6, 0xCB, 0xE9, 0xDC, 0xF1, 0x31, 0x89, 0xA8, 0xA9, 0xCD, 0xBA, 0xEB, 0x6B, 0xE5, 0x14,
-    0xF3, 0x27, 0xCB, 0xDF, 0x9F, 0x72, 0xCE, 0x00, 0x9F, 0x0B, 0xAE, 0x1F, 0x49, 0x1F, 0x5E, 0xC2,
-    0x6C, 0x28, 0x8E, 0x12, 0xED, 0x2E, 0x89, 0x8F, 0xB2, 0xE3, 0x12, 0x47, 0xCB, 0x64, 0x7A, 0x11,
-    0x2F, 0xBC, 0x3F, 0xD3, 0x94, 0xF6, 0xB8, 0xCE, 0x9D, 0xE3, 0x21, 0x74, 0xC8, 0xAA, 0x99, 0x5C,
-    0x12, 0x2E, 0x38, 0x9E, 0xB6, 0x7B, 0xB3, 0x61, 0x9F, 0xF5, 0x1F, 0x33, 0xDC, 0xB2, 0xA2, 0xD1,
-    0x8A, 0xF0, 0x78, 0x55, 0x11, 0xBE, 0xD0, 0x8A, 0xF0, 0xE2, 0x71, 0x15, 0xE1, 0x06, 0x82, 0xE1,
-    0x3B, 0x2A, 0xC2, 0x83, 0xA7, 0x55, 0x84, 0x37, 0x8F, 0xAB, 0x08, 0x8F, 0x9E, 0xB9, 0x22, 0x9C,
-    0x1C, 0x69, 0xFD, 0x9E, 0x0C, 0x99, 0xB4, 0x45, 0x05, 0x7E, 0xFC, 0xD9, 0xF2, 0xDF, 0xBD, 0xFF,
-    0xD4, 0x35, 0xB0, 0x19, 0x69, 0xAD, 0x65, 0xC1, 0xC2, 0x25, 0xE9, 0x54, 0xE8, 0x0A, 0xAD, 0x5C,
-    0xB2, 0x31, 0xAF, 0x22, 0x49, 0x9C, 0xDF, 0x64, 0xA0, 0xD0, 0x7B, 0x55, 0x52, 0x65, 0x17, 0x6E,
-    0x41, 0xC4, 0xCC, 0x24, 0xDF, 0x7E, 0xB5, 0x9F, 0x69, 0x6F, 0x36, 0x51, 0xC3, 0xED, 0x63, 0x4E,
-    0xE3, 0x02, 0xB3, 0x02, 0xC2, 0xC1, 0x1F, 0xA2, 0x96, 0x85, 0x35, 0x63, 0xD4, 0xE5, 0x77, 0xF0,
-    0x21, 0xB7, 0x0E, 0xF7, 0x73, 0x12, 0x32, 0x01, 0x5C, 0x9F, 0x65, 0xCC, 0xEF, 0x60, 0xE6, 0xAB,
-    0xF1, 0x3E, 0x68, 0x34, 0x6F, 0x82, 0x49, 0x75, 0x99, 0xF1, 0x3A, 0x6F, 0x33, 0x05, 0x5C, 0x67,
-    0x88, 0x56, 0x16, 0x33, 0x28, 0xBE, 0x9A, 0x68, 0x25, 0xE5, 0xC9, 0xDC, 0x0E, 0x2D, 0x25, 0xFD,
-    0x6A, 0x4F, 0x82, 0x6B, 0xAB, 0xE9, 0x35, 0x74, 0x89, 0xFC, 0x94, 0x64, 0x24, 0x52, 0x64, 0xA8,
-    0x15, 0x6C, 0xB1, 0x09, 0x30, 0xD2, 0x25, 0xD4, 0x61, 0x5C, 0xCD, 0x47, 0x56, 0xB8, 0x10, 0x3D,
-    0xF5, 0xBC, 0x8E, 0xC3, 0x8F, 0x96, 0xCB, 0xC5, 0x74, 0x6F, 0xA9, 0x03, 0xD0, 0x00, 0x6E, 0x25,
-    0xFE, 0xCD, 0x68, 0x70, 0xF7, 0xDE, 0xD2, 0x44, 0x61, 0x59, 0xAE, 0x83, 0x75, 0x3D, 0x72, 0xEF,
-    0xCE, 0x2C, 0xA2, 0x6E, 0xD6, 0x3E, 0xE6, 0xDE, 0xC9, 0x6A, 0xC9, 0xA1, 0x7F, 0x04, 0x61, 0xA0,
-    0xE5, 0x5F, 0xD6, 0xBA, 0x31, 0x4E, 0xEC, 0xF6, 0xF2, 0x7B, 0x71, 0xE2, 0x1F, 0xCE, 0xF2, 0x73,
-    0x1A, 0x12, 0xD2, 0xAA, 0xBC, 0x5E, 0x17, 0x4D, 0xB7, 0xDB, 0x4F, 0xE2, 0xB0, 0xDF, 0x7D, 0x95,
-    0x8B, 0x15, 0xF7, 0x48, 0x23, 0x01, 0x77, 0x4E, 0x78, 0x41, 0xCB, 0x0A, 0x93, 0x9D, 0xE0, 0xFD,
-    0xA3, 0x58, 0x37, 0x76, 0xFF, 0x79, 0x2E, 0x28, 0x90, 0xF9, 0x63, 0xD4, 0x8A, 0x06, 0x15, 0xAD,
-    0x59, 0xDC, 0x9D, 0xC2, 0x0C, 0x3B, 0x56, 0x56, 0xDC, 0xE6, 0x98, 0xA0, 0x67, 0x60, 0xE2, 0x83,
-    0x62, 0x31, 0x1A, 0x4C, 0xC5, 0x5A, 0x14, 0x68, 0x44, 0x68, 0x9C, 0xB6, 0x20, 0x5D, 0xF1, 0x59,
-    0x97, 0x5F, 0xEF, 0xB9, 0x5A, 0x55, 0xD0, 0x33, 0x27, 0xF1, 0x2A, 0x1E, 0x8F, 0x06, 0x49, 0x57,
-    0x87, 0xCC, 0xD8, 0x62, 0xB4, 0x24, 0xEA, 0x5F, 0x3F, 0x6F, 0x96, 0x98, 0xBD, 0x17, 0x0E, 0x70,
-    0xD5, 0x17, 0xAB, 0x41, 0xA1, 0x4A, 0xD2, 0x42, 0x19, 0xDD, 0x01, 0x2C, 0xD2, 0x55, 0xAC, 0xDF,
-    0x79, 0xC2, 0xD2, 0xB5, 0xEA, 0x14, 0xCF, 0xA7, 0x54, 0x9C, 0x5E, 0x61, 0x6D, 0xC9, 0xB7, 0x21,
-    0xF4, 0xA3, 0xC1, 0x95, 0x71, 0x9A, 0x17, 0x8D, 0x18, 0x15, 0x43, 0x28, 0x2B, 0xC6, 0x9D, 0x96,
-    0xB5, 0x5A, 0x77, 0xAD, 0x31, 0x17, 0xAD, 0xAD, 0x31, 0x77, 0x7F, 0x7D, 0x8D, 0xB9, 0x63, 0x72,
-    0x41, 0xBC, 0xD0, 0x80, 0x5A, 0x94, 0x3F, 0xD0, 0x4E, 0x5F, 0xFF, 0x48, 0x4C, 0x76, 0xCA, 0x50,
-    0x75, 0x12, 0x27, 0x3B, 0xC0, 0xB9, 0x75, 0xC1, 0x95, 0x99, 0x62, 0xFC, 0xFD, 0x76, 0x5C, 0x8D,
-    0x3F, 0xE5, 0x20, 0x85, 0x90, 0xBC, 0x62, 0x30, 0x42, 0xB3, 0x53, 0x35, 0xEF, 0x7F, 0xFF, 0x3B,
-    0xEA, 0xA0, 0xF6, 0x8B, 0xE7, 0x52, 0x90, 0x09, 0x00, 0xE7, 0x58, 0x34, 0x21, 0xB3, 0x71, 0x30,
-    0x3C, 0xAC, 0x3C, 0x4D, 0x3F, 0xE1, 0x0A, 0x0A, 0xD0, 0xE1, 0xC9, 0xAF, 0x81, 0x73, 0xD9, 0x48,
-    0xBF, 0x90, 0x21, 0x04, 0x85, 0xAB, 0x69, 0x41, 0x76, 0x11, 0x24, 0x9E, 0x73, 0x4D, 0x66, 0x6E,
-    0x1D, 0xD5, 0x83, 0xC7, 0x27, 0xF7, 0xBE, 0x84, 0x19, 0xE2, 0x69, 0xA1, 0xFE, 0x51, 0x96, 0x73,
-    0x64, 0x2A, 0x63, 0xC0, 0x75, 0x07, 0x8D, 0x44, 0x0D, 0xB8, 0x32, 0xE0, 0xC2, 0xC4, 0x8F, 0x2C,
-    0x07, 0x78, 0xCF, 0x7E, 0xB3, 0xDC, 0x18, 0xE5, 0x03, 0x5F, 0x32, 0x7B, 0x67, 0x90, 0x1A, 0x94,
-    0xCB, 0x3B, 0xA1, 0x99, 0x8C, 0x6A, 0xA3, 0xD1, 0x12, 0x14, 0x95, 0x35, 0x92, 0xE3, 0x89, 0x91,
-    0xE3, 0xEE, 0xF1, 0x2B, 0x43, 0x14, 0x3B, 0x2B, 0x43, 0x58, 0x49, 0x43, 0x82, 0xF2, 0xDF, 0xBE,
-    0xF8, 0x0C, 0x2B, 0x43, 0x98, 0x03, 0x9B, 0x87, 0x33, 0x67, 0xB8, 0xAE, 0x4D, 0x47, 0xD1, 0xB5,
-    0x4F, 0xB0, 0x5A, 0xBD, 0xF9, 0x14, 0xA2, 0x13, 0xDB, 0xCB, 0xB3, 0xEE, 0xAF, 0x14, 0xC8, 0xE2,
-    0x64, 0x89, 0x24, 0x38, 0xE7, 0x9D, 0xAC, 0x4F, 0x7D, 0x45, 0x57, 0x49, 0xEC, 0xE4, 0x55, 0x77,
-    0xAF, 0x87, 0x68, 0xD3, 0x71, 0xF9, 0x3F, 0x64, 0x3D, 0xC4, 0x98, 0x25, 0x25, 0x01, 0x14, 0xE0,
-    0xF8, 0x01, 0x23, 0xA6, 0xAE, 0x62, 0x97, 0xE5, 0x3C, 0xD6, 0x5A, 0x97, 0xDF, 0x5B, 0xB8, 0xA5,
-    0x6B, 0xE9, 0x82, 0x66, 0x56, 0x84, 0x70, 0x3F, 0x79, 0x9F, 0x6C, 0x41, 0xBE, 0x27, 0xD7, 0x3F,
-    0xCA, 0xF3, 0x64, 0x03, 0xAE, 0x57, 0x1D, 0xD3, 0x00, 0xB0, 0x17, 0x7B, 0x72, 0xC1, 0xE9, 0x91,
-    0xA9, 0x11, 0x60, 0x2A, 0x56, 0xE3, 0x9C, 0x73, 0x29, 0x3B, 0x5B, 0x78, 0xB8, 0xAC, 0x78, 0x71,
-    0x56, 0x96, 0xA9, 0x54, 0x13, 0x9F, 0xBA, 0xA0, 0x17, 0x16, 0x90, 0x35, 0xAF, 0xA9, 0x3C, 0x14,
-    0x03, 0xCA, 0xA4, 0x8B, 0x5A, 0x29, 0xD4, 0x38, 0x43, 0xC3, 0xAD, 0x63, 0x42, 0xCC, 0xF2, 0xDF,
-    0x3E, 0x53, 0x48, 0xE2, 0x0F, 0x65, 0xAD, 0x28, 0x8E, 0x3B, 0x07, 0x9C, 0x82, 0x97, 0x50, 0x4B,
-    0xB6, 0x35, 0x84, 0x45, 0x85, 0xCD, 0xE4, 0xD9, 0xF8, 0x2F, 0x8A, 0x4A, 0x8B, 0xE2, 0x09, 0x25,
-    0x7C, 0x5D, 0xA1, 0x4D, 0xD7, 0x39, 0x76, 0x71, 0x6C, 0xBF, 0x67, 0x59, 0x7C, 0xBC, 0x2D, 0x76,
-    0x60, 0xC5, 0xEF, 0x88, 0xB2, 0x3F, 0xF8, 0xEA, 0x45, 0x5D, 0x34, 0x27, 0x75, 0x0A, 0xA6, 0xD9,
-    0x37, 0xCF, 0x9E, 0x81, 0x40, 0xFF, 0x60, 0xAB, 0x0A, 0xEE, 0x7B, 0x55, 0x21, 0x1D, 0xFA, 0xDB,
-    0x09, 0xB9, 0x0E, 0x2C, 0x7F, 0x3E, 0xFF, 0x9E, 0xBA, 0xFD, 0x1F, 0xA4, 0xEE, 0xF2, 0x70, 0xF6,
-    0xBE, 0xF1, 0xC6, 0x80, 0xD9, 0xA4, 0x52, 0x69, 0xCE, 0xAA, 0xAE, 0x2B, 0x76, 0x07, 0x38, 0x7F,
-    0xE7, 0xEA, 0xE5, 0x0C, 0x06, 0xD1, 0x17, 0x17, 0xAF, 0x28, 0x3D, 0x4C, 0xAB, 0x97, 0xB3, 0x54,
-    0xED, 0xDE, 0x7A, 0x12, 0xD1, 0xCE, 0xEA, 0xE5, 0x92, 0x93, 0x94, 0xFC, 0x16, 0x94, 0x96, 0xFE,
-    0xDA, 0xC7, 0xF4, 0xF7, 0x49, 0x4E, 0xB2, 0x5D, 0xE1, 0x50, 0x50, 0xE3, 0x06, 0x73, 0x52, 0x99,
-    0xCF, 0xD0, 0xB1, 0x7E, 0x91, 0x6B, 0x3E, 0xD2, 0xAF, 0xCA, 0x64, 0xCA, 0x86, 0xEE, 0xEF, 0x2F,
-    0x08, 0xCF, 0xAE, 0x75, 0x5A, 0x7B, 0xE6, 0x6B, 0xA1, 0x75, 0xE7, 0x52, 0x08, 0xB5, 0x8A, 0xAD,
-    0x73, 0x79, 0x79, 0xF2, 0x57, 0x4F, 0xC4, 0x5C, 0x64, 0x52, 0x97, 0x46, 0xD0, 0x5A, 0xCD, 0xA7,
-    0x93, 0x7C, 0xD0, 0x47, 0x17, 0xB3, 0x97, 0x75, 0xAF, 0xDD, 0x9F, 0x9D, 0x08, 0x29, 0xE3, 0x32,
-    0x09, 0x69, 0x55, 0xB2, 0xCA, 0x4E, 0xFB, 0xAC, 0xAC, 0x72, 0xE8, 0xBC, 0x99, 0x5D, 0x90, 0xCC,
-    0x9C, 0x82, 0xB5, 0x99, 0x92, 0xB0, 0x03, 0xE8, 0x22, 0xAA, 0x36, 0x4B, 0xA4, 0xB4, 0xCC, 0xD7,
-    0x3F, 0x2D, 0x91, 0x8A, 0x47, 0x56, 0xDC, 0x8A, 0x69, 0xA7, 0x4B, 0x55, 0xDD, 0xDC, 0xA9, 0x9B,
-    0x71, 0xB1, 0x66, 0xF5, 0xB6, 0x2A, 0xEB, 0x4F, 0x6B, 0xB0, 0xAB, 0xC6, 0x72, 0x89, 0x0E, 0x2E,
-    0x2F, 0x48, 0x52, 0x11, 0x35, 0x07, 0x2B, 0x98, 0x96, 0xA3, 0x94, 0x8C, 0x7F, 0xFD, 0xBE, 0x94,
-    0xCE, 0xC1, 0x20, 0x5E, 0x98, 0xE9, 0x3B, 0x56, 0xD6, 0xE5, 0x61, 0xF6, 0x6F, 0xCD, 0xE4, 0xEC,
-    0xB4, 0x25, 0x8C, 0x8E, 0x07, 0x09, 0xE3, 0xE1, 0x23, 0xD9, 0xF7, 0xB4, 0xC3, 0x74, 0x19, 0x71,
-    0xF7, 0x67, 0x62, 0xE4, 0xB6, 0x52, 0x11, 0xC3, 0x14, 0x13, 0x19, 0x43, 0xA3, 0x53, 0x05, 0xE7,
-    0xC4, 0x2D, 0x2A, 0xAB, 0xE6, 0xE8, 0x50, 0xAE, 0xF2, 0xFD, 0x53, 0x17, 0x74, 0x19, 0xCD, 0x2A,
-    0x29, 0x54, 0x27, 0xCE, 0xB4, 0x30, 0x4E, 0xD2, 0xAE, 0xFD, 0x39, 0x1B, 0xFD, 0xEB, 0x04, 0x12,
-    0xE6, 0x73, 0x75, 0x4D, 0xA9, 0xAB, 0x51, 0x74, 0x9E, 0xBD, 0x85, 0xD9, 0xBD, 0xA2, 0x8E, 0xD9,
-    0x7F, 0xFE, 0xD0, 0x02, 0x36, 0x4F, 0x25, 0x5B, 0x97, 0xD6, 0x5C, 0x9E, 0x22, 0x71, 0x7F, 0xA6,
-    0xE4, 0xB9, 0xEF, 0xB3, 0xC8, 0x65, 0xF5, 0xC4, 0x45, 0x2E, 0x87, 0xBD, 0x1B, 0xFF, 0x2C, 0x4A,
-    0x93, 0x5E, 0x19, 0xA0, 0xC0, 0xCF, 0xAC, 0xFD, 0x59, 0x94, 0x1F, 0x9B, 0xF3, 0x51, 0xF6, 0x13,
-    0xBF, 0x8C, 0xB2, 0xC6, 0xAF, 0xDF, 0x30, 0xDD, 0x3F, 0x37, 0x6F, 0x05, 0x8B, 0xE4, 0xED, 0x2E,
-    0x66, 0xA5, 0x16, 0xD7, 0x54, 0xE0, 0x62, 0x34, 0x7E, 0x2D, 0xEB, 0x9B, 0xA4, 0x5C, 0x29, 0xE2,
-    0xF7, 0xB3, 0x92, 0xBC, 0x35, 0xAE, 0x70, 0xBE, 0x71, 0x59, 0x17, 0x85, 0xFB, 0x2B, 0x15, 0xC0,
-    0xBE, 0xE6, 0xF5, 0xE5, 0x05, 0x2D, 0xA7, 0xBC, 0x24, 0x7F, 0x0C, 0xE4, 0x92, 0xFE, 0xE5, 0x9F,
-    0xC7, 0xFE, 0x30, 0xE3, 0xCB, 0x04, 0xF2, 0x33, 0x63, 0xB0, 0xF5, 0x3D, 0xF9, 0x1B, 0x3B, 0xB3,
-    0x31, 0xD4, 0xBF, 0x5F, 0x73, 0x7A, 0x5C, 0x33, 0xFA, 0x15, 0x63, 0x7E, 0xB7, 0x0F, 0xEA, 0xA9,
-    0xFF, 0xA6, 0xAC, 0x16, 0xA7, 0xD3, 0x92, 0xF6, 0xE0, 0x63, 0x16, 0xA5, 0x2C, 0x9E, 0x6D, 0x51,
-    0x4A, 0x77, 0xD1, 0x6E, 0x1B, 0x5D, 0x94, 0x92, 0xA8, 0xF6, 0x13, 0x5D, 0xEA, 0x80, 0xAB, 0x44,
-    0x36, 0xB2, 0x28, 0x65, 0x30, 0x2D, 0x4A, 0x89, 0x29, 0xF3, 0xC5, 0x20, 0x7F, 0x13, 0xA9, 0xCF,
-    0xB3, 0x48, 0x16, 0xA5, 0xE4, 0x4A, 0x46, 0x33, 0xF1, 0x69, 0x66, 0xB2, 0x28, 0x25, 0xCB, 0xA5,
-    0xFA, 0x42, 0x0B, 0xDD, 0x12, 0xC5, 0x52, 0x95, 0x02, 0x8B, 0x94, 0xD1, 0x03, 0x81, 0x62, 0xE1,
-    0x90, 0xB4, 0x4E, 0x2A, 0x2E, 0xFF, 0xF3, 0xF2, 0x3B, 0x26, 0x9B, 0x54, 0xB1, 0xEA, 0x9F, 0x0C,
-    0x49, 0x7E, 0x05, 0xFA, 0x06, 0xDF, 0xD2, 0x5F, 0xD6, 0xCB, 0xE2, 0x3A, 0x34, 0xD2, 0xE3, 0xEB,
-    0x3B, 0x8B, 0xEB, 0x8C, 0x3F, 0x67, 0x2D, 0x8B, 0x54, 0x6A, 0x73, 0x45, 0xC3, 0x07, 0x4D, 0x5C,
-    0x7B, 0x03, 0x97, 0x98, 0xC9, 0x0B, 0x93, 0x73, 0x71, 0x1D, 0x98, 0x79, 0x0F, 0x21, 0x3C, 0xB9,
-    0xB8, 0x8E, 0xFC, 0xA9, 0x98, 0x4D, 0x16, 0x2E, 0x69, 0x21, 0x31, 0x47, 0x84, 0xB5, 0x4F, 0x9D,
-    0x54, 0xA8, 0xA6, 0xB2, 0xAA, 0x83, 0x5B, 0x00, 0xD7, 0x85, 0x63, 0x3C, 0xFB, 0x89, 0x16, 0x3E,
-    0xDE, 0x1C, 0x77, 0xCA, 0x81, 0xDD, 0xF4, 0xD5, 0x7C, 0xE5, 0x49, 0x52, 0x69, 0xA4, 0xC3, 0x73,
-    0x2B, 0x0F, 0x59, 0x97, 0x1B, 0xEA, 0x2A, 0xD9, 0x5D, 0x49, 0xBF, 0x98, 0x14, 0x0F, 0x64, 0xF1,
-    0x10, 0xFB, 0xB2, 0x94, 0x27, 0x03, 0xD6, 0x7C, 0x4C, 0xE5, 0x13, 0xB3, 0x86, 0x48, 0xD4, 0xB5,
-    0x2F, 0x2B, 0x4E, 0x8E, 0xB2, 0x1E, 0xAE, 0x3E, 0xC0, 0xAD, 0x35, 0xF4, 0xFA, 0x44, 0x34, 0xF0,
-    0x2B, 0x3E, 0xB9, 0x08, 0xF1, 0xB9, 0x2C, 0x27, 0x82, 0xE3, 0x4A, 0x97, 0x29, 0xD1, 0xAE, 0x04,
-    0x01, 0x6A, 0xB7, 0x14, 0xB2, 0x24, 0x4E, 0xE6, 0xF2, 0xC8, 0x46, 0xD7, 0xDC, 0x9A, 0xB1, 0xBC,
-    0x38, 0xE6, 0xEA, 0x5E, 0x80, 0xE8, 0x3D, 0x93, 0x8B, 0xFB, 0xBC, 0x96, 0xAB, 0xBE, 0x73, 0x0A,
-    0xFF, 0x5F, 0x8D, 0x57, 0x31, 0x8F, 0xDE, 0x44, 0x10, 0x5D, 0xDB, 0xB9, 0x58, 0xC8, 0x09, 0x9B,
-    0x82, 0x6B, 0x90, 0x12, 0x37, 0x29, 0x02, 0x0A, 0x71, 0x45, 0x07, 0xB2, 0xB9, 0x96, 0x22, 0x29,
-    0xF2, 0x49, 0x94, 0x88, 0x82, 0x82, 0x02, 0x81, 0x84, 0x44, 0x83, 0xB0, 0x51, 0x84, 0x52, 0xD0,
-    0x20, 0xF1, 0x03, 0x68, 0x28, 0x28, 0x10, 0x4A, 0x81, 0x04, 0x45, 0x24, 0x3B, 0xB9, 0xE2, 0x4A,
-    0x2C, 0xA5, 0x88, 0x28, 0x50, 0x2C, 0xA5, 0xA0, 0xC4, 0x41, 0x2E, 0x36, 0xCA, 0xFA, 0x1B, 0xDE,
-    0x9B, 0xF5, 0x77, 0xF7, 0xDD, 0x91, 0x90, 0x58, 0xFA, 0x76, 0xF7, 0xD6, 0xE3, 0xDD, 0xD9, 0x37,
-    0x6F, 0xDE, 0xEC, 0xED, 0xAE, 0x56, 0xD7, 0x6B, 0x91, 0x79, 0xF3, 0xDB, 0xFD, 0xEF, 0xDF, 0x98,
-    0x29, 0x05, 0x8F, 0xDF, 0x6E, 0x0D, 0x1F, 0xCB, 0xE1, 0x5F, 0x6C, 0x1E, 0xB3, 0xE1, 0x07, 0x22,
-    0x95, 0xD9, 0x7E, 0x24, 0x3C, 0xF7, 0x97, 0x3E, 0x0F, 0x9D, 0xAF, 0x43, 0x3F, 0x9A, 0x13, 0xCF,
-    0x0B, 0x9A, 0xEF, 0x54, 0x3B, 0x7B, 0x3E, 0x9A, 0x8B, 0x2E, 0xBF, 0x87, 0xAE, 0xEC, 0xF2, 0x7D,
-    0x1F, 0xF9, 0xB2, 0xC9, 0xF7, 0x1D, 0xBB, 0x62, 0xDF, 0xC5, 0x27, 0xBB, 0xAA, 0xD8, 0x9F, 0xD8,
-    0x95, 0xFB, 0x53, 0xC2, 0xEE, 0x00, 0x5D, 0x5D, 0x95, 0x37, 0xA7, 0xC4, 0xD5, 0xA6, 0xBC, 0x39,
-    0x6E, 0x77, 0xCD, 0x4A, 0x9F, 0x96, 0x5B, 0xAE, 0xB7, 0xDB, 0x6D, 0x4F, 0x9F, 0x65, 0x53, 0x4A,
-    0x22, 0x63, 0x21, 0x91, 0x8C, 0x56, 0x4C, 0x3B, 0xA6, 0xD2, 0x94, 0x3E, 0x91, 0xBE, 0x58, 0xA7,
-    0x32, 0xD4, 0x73, 0x22, 0x5D, 0xE9, 0x31, 0xD7, 0xE2, 0x6D, 0x24, 0x43, 0xC1, 0x09, 0x2B, 0x9D,
-    0x38, 0x2B, 0x95, 0x6C, 0xCD, 0xD5, 0x9C, 0x78, 0xE6, 0x52, 0xA5, 0x64, 0xD2, 0x97, 0x92, 0x62,
-    0x0C, 0x93, 0x3E, 0x97, 0x58, 0x7A, 0x7E, 0xDB, 0x67, 0x62, 0x64, 0x80, 0x9D, 0x8C, 0x58, 0xA3,
-    0x9D, 0xF0, 0xAE, 0xF6, 0xB1, 0x0C, 0xDC, 0x72, 0x68, 0xD1, 0xF4, 0xAD, 0xE7, 0x0B, 0xA7, 0x6F,
-    0xD5, 0x0D, 0x7E, 0x11, 0xF6, 0xCD, 0xD7, 0x98, 0x2D, 0x82, 0x87, 0x99, 0x34, 0xFF, 0xE3, 0xD5,
-    0x0B, 0x6F, 0x5E, 0x86, 0xCD, 0x03, 0x60, 0x65, 0x67, 0x4C, 0xE2, 0x5F, 0x7C, 0x90, 0x01, 0xCD,
-    0x88, 0x41, 0x27, 0xE1, 0x6E, 0x28, 0xE7, 0x0E, 0x6D, 0x52, 0x0E, 0xEA, 0xC3, 0x41, 0x83, 0x81,
-    0x7B, 0xEA, 0xA0, 0xC5, 0x20, 0x7B, 0xF6, 0x20, 0x99, 0x30, 0xC8, 0xC9, 0x58, 0x0E, 0x52, 0x0E,
-    0x2E, 0xD2, 0xD7, 0x0D, 0x87, 0xA3, 0xF7, 0xC8, 0xC9, 0x65, 0x53, 0x3B, 0x2E, 0xCE, 0x9D, 0x9C,
-    0x88, 0x64, 0xF1, 0x26, 0x27, 0x62, 0x22, 0xF4, 0xFC, 0x5E, 0x48, 0x8A, 0x21, 0xF8, 0x11, 0xAD,
-    0x17, 0xA7, 0xF2, 0x21, 0xEC, 0x1E, 0xAF, 0x17, 0x0F, 0x0A, 0xE2, 0x2B, 0x33, 0x3F, 0xD9, 0xC7,
-    0xEF, 0xD1, 0xBA, 0xA5, 0x05, 0xBC, 0x49, 0x66, 0xEE, 0x04, 0x47, 0xCA, 0x1E, 0x3B, 0x6D, 0x26,
-    0x6A, 0x4C, 0xD8, 0x7E, 0xF1, 0xF7, 0x32, 0x7E, 0xC9, 0xB6, 0xBB, 0x60, 0xE0, 0x6C, 0x12, 0x2C,
-    0xE3, 0x34, 0x35, 0x47, 0x43, 0xE8, 0x3A, 0x82, 0x28, 0x0A, 0xA7, 0xD7, 0x89, 0x49, 0xB3, 0xAC,
-    0xA7, 0x9D, 0x34, 0xB9, 0xF2, 0x9A, 0xF9, 0x85, 0x58, 0xF1, 0x1B, 0xCD, 0xE9, 0x4E, 0x93, 0xBC,
-    0xD2, 0xA4, 0x4E, 0xD9, 0xBA, 0x82, 0xED, 0xA0, 0x59, 0xB8, 0xAF, 0xAD, 0x3D, 0x4A, 0xCC, 0x7F,
-    0x74, 0xA2, 0x0F, 0x3E, 0xBC, 0x42, 0x50, 0x6B, 0x90, 0x6B, 0xAC, 0xE5, 0x40, 0x5C, 0x3D, 0xA7,
-    0xB3, 0x79, 0x5B, 0x73, 0xF6, 0x5A, 0x7D, 0x57, 0xAE, 0xCE, 0xA5, 0x83, 0x62, 0x74, 0x27, 0xFE,
-    0x30, 0x2B, 0xBE, 0xEE, 0x12, 0x78, 0x72, 0x57, 0xAA, 0xDC, 0xC5, 0x72, 0x15, 0xC3, 0xD1, 0xC2,
-    0x20, 0x86, 0x33, 0x4E, 0x33, 0x80, 0xA6, 0x64, 0x72, 0xB7, 0x6A, 0xDB, 0x16, 0x0B, 0xC6, 0x8C,
-    0x45, 0x34, 0x9B, 0x82, 0x11, 0xB9, 0x7C, 0x0B, 0xD8, 0x9C, 0xFD, 0x13, 0x71, 0x49, 0x3E, 0xAF,
-    0x8A, 0xCE, 0xFC, 0xD1, 0x03, 0xEA, 0xB7, 0x7E, 0x41, 0x88, 0xAC, 0x07, 0xE0, 0xD1, 0x9A, 0x81,
-    0xDA, 0x89, 0x89, 0xA1, 0x86, 0x4B, 0xA1, 0xD5, 0x08, 0x68, 0x28, 0x4D, 0x39, 0x90, 0x09, 0x14,
-    0x18, 0x3B, 0x5D, 0x3A, 0xDD, 0x64, 0xFE, 0xCD, 0xFD, 0x8B, 0xC9, 0xFC, 0xF2, 0xA7, 0xBF, 0x26,
-    0x92, 0xFE, 0xF4, 0xF3, 0x1D, 0x31, 0x07, 0x97, 0x6F, 0x21, 0xFF, 0x0E, 0x5C, 0xDB, 0xA5, 0xFD,
-    0xED, 0x7A, 0x38, 0xD4, 0x01, 0xE6, 0x89, 0xB7, 0x60, 0xFD, 0x44, 0x17, 0x97, 0x3C, 0x09, 0x09,
-    0x74, 0x47, 0x9C, 0xE6, 0x09, 0x59, 0xA1, 0xD9, 0xA0, 0x16, 0xA5, 0xCB, 0x64, 0x2F, 0xFC, 0x85,
-    0xBC, 0xA2, 0xE9, 0xDE, 0x51, 0x92, 0x98, 0xA4, 0xC9, 0x9A, 0xF3, 0x70, 0xA9, 0xEC, 0xF0, 0x36,
-    0x91, 0xCC, 0x5B, 0x97, 0x8F, 0x65, 0xDF, 0x36, 0xB2, 0x87, 0x23, 0xA4, 0xCE, 0x8E, 0x79, 0x57,
-    0x34, 0x35, 0x60, 0x36, 0xE6, 0x9A, 0x92, 0xB7, 0xEE, 0xCA, 0x21, 0x1F, 0x53, 0x88, 0x9C, 0xB9,
-    0xAD, 0x4B, 0xC4, 0x53, 0x51, 0xD5, 0x07, 0x3E, 0x99, 0x31, 0xFF, 0x08, 0xC2, 0xF1, 0x8D, 0x83,
-    0xE2, 0x75, 0x59, 0x77, 0xFB, 0x48, 0xBC, 0x4E, 0x37, 0xB9, 0x39, 0x6F, 0x8A, 0xBE, 0x6E, 0x5A,
-    0x53, 0x8C, 0x75, 0x07, 0x11, 0x9A, 0x8A, 0xA1, 0xEC, 0x53, 0x6F, 0xA7, 0x7C, 0x24, 0x58, 0xA0,
-    0x60, 0x1B, 0xF9, 0xD8, 0x99, 0x53, 0x30, 0x3F, 0x67, 0xA2, 0x6F, 0x15, 0x6A, 0xC0, 0x06, 0xB0,
-    0xC0, 0x23, 0x70, 0xAA, 0x8F, 0xE5, 0x77, 0x4A, 0x06, 0x55, 0xF9, 0x9C, 0x39, 0x6B, 0xD2, 0x1E,
-    0xE8, 0xB6, 0x5D, 0x39, 0x5A, 0x07, 0x76, 0x97, 0x23, 0x02, 0x07, 0x45, 0x28, 0x3C, 0xE6, 0xB0,
-    0x0C, 0x72, 0xEB, 0x1C, 0x4E, 0x57, 0x81, 0x0B, 0x89, 0xC3, 0x5B, 0xCE, 0x4A, 0x95, 0xF2, 0x6D,
-    0xE1, 0x2D, 0xD6, 0x69, 0x8A, 0x21, 0x72, 0xE6, 0x82, 0x31, 0x8D, 0xA2, 0xEA, 0x16, 0x74, 0x97,
-    0x3E, 0xF7, 0xC7, 0xFB, 0x82, 0x3D, 0xA0, 0x2D, 0x09, 0x77, 0x2C, 0xE3, 0xEB, 0x3F, 0x42, 0x99,
-    0x4C, 0x8B, 0xD9, 0x12, 0x99, 0x55, 0x8A, 0x3A, 0xC9, 0xD8, 0xC4, 0x74, 0x0F, 0xEA, 0x97, 0x91,
-    0x9F, 0x31, 0x79, 0xCC, 0xF5, 0x29, 0xD6, 0xAA, 0x49, 0x4C, 0x18, 0x44, 0x1C, 0x59, 0xE0, 0x00,
-    0x34, 0x22, 0x03, 0xA6, 0xA1, 0x47, 0x6E, 0x74, 0xB9, 0x2F, 0x3C, 0x8E, 0x59, 0x15, 0x9E, 0xAA,
-    0xCB, 0x93, 0x50, 0x17, 0x49, 0xC1, 0xDD, 0xEB, 0xC8, 0x86, 0x71, 0xF7, 0xBA, 0x61, 0xDE, 0x28,
-    0x09, 0x97, 0xE2, 0x90, 0xCA, 0x5A, 0xB8, 0xBE, 0x05, 0xEF, 0x99, 0xFA, 0xA5, 0x8C, 0x39, 0xD2,
-    0x0D, 0xF9, 0x06, 0x28, 0x34, 0x33, 0x2B, 0xFE, 0x38, 0xC6, 0x1C, 0xF4, 0xD3, 0x71, 0x89, 0xED,
-    0x22, 0xB8, 0xBB, 0xA4, 0x72, 0xDB, 0x2D, 0xF5, 0x70, 0xD3, 0xF7, 0xC7, 0xFA, 0x48, 0x02, 0x01,
-    0xE3, 0xA5, 0x37, 0x9F, 0x98, 0xDC, 0x64, 0x23, 0x28, 0xD0, 0x82, 0x3B, 0x76, 0x04, 0xD9, 0x05,
-    0x03, 0xD0, 0x02, 0x47, 0x20, 0xC4, 0x63, 0x86, 0x33, 0x60, 0x35, 0x04, 0xD7, 0x1B, 0x7B, 0xA4,
-    0x18, 0xE1, 0x49, 0xA9, 0xE1, 0xAD, 0x2B, 0xD7, 0x16, 0xC9, 0xFD, 0x48, 0x3C, 0xC1, 0x89, 0xF8,
-    0xE2, 0x12, 0xF7, 0xE0, 0x96, 0x65, 0x75, 0x42, 0xA1, 0x4F, 0x63, 0xE7, 0x54, 0x49, 0x80, 0x13,
-    0x53, 0x77, 0x92, 0xB9, 0xFE, 0x7B, 0xBC, 0x90, 0x3A, 0xA9, 0x2A, 0x30, 0x0E, 0x22, 0x07, 0x41,
-    0x6C, 0x6F, 0xFA, 0x30, 0x10, 0x0C, 0xAC, 0x43, 0xB6, 0xC9, 0xF7, 0x13, 0xA5, 0x49, 0x8F, 0x4F,
-    0x98, 0x18, 0x0A, 0xE2, 0x55, 0x85, 0xA3, 0xD9, 0xD9, 0x1C, 0x0D, 0x22, 0xCE, 0x5E, 0x31, 0x4F,
-    0x7D, 0x56, 0x0B, 0x07, 0x62, 0x02, 0xC4, 0xE4, 0x49, 0xF8, 0x55, 0x39, 0x2B, 0x29, 0x00, 0x2A,
-    0x16, 0xCD, 0x88, 0x0D, 0xB7, 0xB2, 0x40, 0xF8, 0xE4, 0x15, 0x07, 0x00, 0xA4, 0x2E, 0x5A, 0xD7,
-    0x2A, 0xD4, 0x1E, 0xE1, 0x87, 0x45, 0x63, 0x76, 0x0E, 0xD7, 0x7F, 0x43, 0xC9, 0xB7, 0x87, 0xE6,
-    0xE1, 0xFD, 0x8E, 0xC2, 0x3A, 0x52, 0xAA, 0x29, 0xBA, 0xF5, 0xA8, 0xBC, 0xA9, 0x18, 0x39, 0xB8,
-    0x6F, 0xBF, 0x44, 0x5A, 0xC5, 0x57, 0xBF, 0x7E, 0xDF, 0x44, 0x0F, 0x87, 0xDB, 0xAF, 0x18, 0xF7,
-    0x61, 0x7E, 0xC5, 0x7E, 0x5C, 0x3F, 0x91, 0x77, 0x45, 0x5A, 0x68, 0xD8, 0x1A, 0xC8, 0xA6, 0xF2,
-    0x5D, 0xD0, 0xCB, 0x07, 0x37, 0x9E, 0x3C, 0xF8, 0x6C, 0xAA, 0x3E, 0x18, 0xAB, 0xB7, 0x8C, 0xF9,
-    0xED, 0xD8, 0x81, 0x78, 0x70, 0x05, 0x38, 0xE5, 0x26, 0x96, 0x61, 0x2D, 0xBA, 0xA5, 0x68, 0x68,
-    0xC1, 0x89, 0x0F, 0x2D, 0xB2, 0x69, 0x23, 0x55, 0xAA, 0x5C, 0xED, 0xC6, 0x22, 0x51, 0x0A, 0x7A,
-    0x13, 0xCA, 0x05, 0xF2, 0x7A, 0xA9, 0x4A, 0x86, 0x94, 0x8C, 0x0E, 0x2D, 0x32, 0x5A, 0xE4, 0xB4,
-    0x28, 0x8F, 0x5F, 0xBF, 0x4E, 0xFF, 0x80, 0xE6, 0xA3, 0xCA, 0x44, 0xAD, 0xB0, 0xFA, 0x7A, 0x96,
-    0x0C, 0xC7, 0x9A, 0xD2, 0x30, 0x4D, 0x58, 0x2E, 0xFA, 0xDA, 0xA5, 0x10, 0xB4, 0xA6, 0x1E, 0x73,
-    0x84, 0xF2, 0x2B, 0x54, 0x19, 0xF7, 0x12, 0xF7, 0xF8, 0x36, 0x6C, 0xFB, 0x94, 0x32, 0xDE, 0x2F,
-    0x75, 0xEB, 0x70, 0x70, 0x58, 0xB4, 0xC9, 0xF0, 0x4C, 0x8B, 0x67, 0x13, 0xDC, 0xC9, 0x49, 0x3A,
-    0xE0, 0x1C, 0x31, 0x3B, 0x72, 0x44, 0x31, 0x25, 0xDE, 0x35, 0x90, 0xD6, 0xDC, 0x6D, 0x67, 0x86,
-    0x94, 0x1F, 0x8E, 0x4F, 0x1B, 0x58, 0x0E, 0x18, 0x25, 0xCB, 0x33, 0x32, 0xF4, 0x5A, 0x26, 0xB9,
-    0xE5, 0xA9, 0xED, 0x12, 0xF9, 0xBC, 0x47, 0x05, 0x47, 0x73, 0x78, 0x33, 0xC8, 0xD5, 0xC9, 0x6E,
-    0x6B, 0x70, 0x44, 0xBC, 0x79, 0x21, 0x1E, 0xB5, 0x20, 0x5A, 0x6D, 0xED, 0xF1, 0xEA, 0x0F, 0x2A,
-    0x9B, 0xA9, 0xCA, 0x42, 0x4F, 0x7D, 0x80, 0xE5, 0x90, 0x6B, 0x9F, 0xF7, 0xED, 0x94, 0xAD, 0x59,
-    0xCB, 0x67, 0x42, 0x01, 0x59, 0xED, 0x18, 0x31, 0x0D, 0x6B, 0x31, 0x40, 0x95, 0x03, 0x3A, 0xA4,
-    0x18, 0xA2, 0xA6, 0xA8, 0x01, 0x28, 0xBB, 0xBC, 0xD6, 0x98, 0xE3, 0x1D, 0xCF, 0x6B, 0xFD, 0x72,
-    0xFF, 0x18, 0x94, 0x0F, 0xB5, 0x28, 0xBE, 0x56, 0x41, 0x0C, 0x2A, 0x48, 0x84, 0x09, 0x06, 0xC8,
-    0x90, 0x70, 0x41, 0x70, 0x4A, 0x73, 0x2C, 0x87, 0x25, 0x17, 0x3C, 0x03, 0xCB, 0x20, 0x29, 0xD9,
-    0xA2, 0xB4, 0xAF, 0xBD, 0x18, 0x4E, 0x8C, 0x23, 0xA0, 0x8E, 0xF5, 0x86, 0x82, 0x74, 0x9F, 0x43,
-    0xF0, 0x30, 0x44, 0x4C, 0x3A, 0x13, 0xD4, 0x0F, 0xE7, 0x0F, 0xE5, 0x62, 0x67, 0x45, 0xA0, 0xA6,
-    0x20, 0xE1, 0x1B, 0x2D, 0x83, 0xD2, 0x83, 0x6D, 0x06, 0xA8, 0xA0, 0x3E, 0x3B, 0xF0, 0xAC, 0xD2,
-    0x9B, 0x0A, 0xEF, 0x2B, 0x60, 0x58, 0x0C, 0x73, 0x3B, 0xC5, 0x73, 0x8F, 0x33, 0x90, 0xFB, 0xA9,
-    0x4F, 0xB6, 0x5B, 0xBF, 0x69, 0x33, 0x6D, 0xAD, 0x23, 0xA9, 0x8A, 0x89, 0x78, 0x0A, 0x54, 0x0F,
-    0xC9, 0xDA, 0xE1, 0xEC, 0x10, 0x32, 0xB4, 0xA4, 0xB2, 0xA7, 0x4B, 0xB1, 0xB6, 0xE6, 0x0B, 0x6D,
-    0xCF, 0x98, 0x20, 0x9E, 0xEA, 0x4E, 0xF4, 0xD8, 0x3C, 0x87, 0x25, 0x80, 0x0D, 0x67, 0xCD, 0xD7,
-    0xE4, 0x6B, 0x2E, 0x6C, 0x0B, 0x21, 0x09, 0x78, 0x49, 0x3F, 0x6A, 0xDF, 0x01, 0x09, 0xEA, 0xE3,
-    0xFF, 0x02, 0x45, 0xBA, 0xBE, 0xDF, 0x5C, 0x81, 0xC3, 0xBD, 0xD4, 0xB4, 0xB4, 0xE1, 0x05, 0x72,
-    0xB9, 0x8E, 0x68, 0xD4, 0x93, 0x63, 0x56, 0xF4, 0x1F, 0x71, 0xEE, 0xF4, 0x0E, 0x43, 0x2B, 0x54,
-    0x0C, 0x04, 0x1A, 0x4A, 0x4B, 0xDD, 0x87, 0xD5, 0xEE, 0x4A, 0x73, 0x39, 0x5C, 0x65, 0xB6, 0xD7,
-    0xE2, 0xB9, 0x94, 0x37, 0x21, 0xFF, 0x17, 0xAB, 0x66, 0xA3, 0x0C, 0xC1, 0xAA, 0x1C, 0xA3, 0xEB,
-    0x54, 0x04, 0x50, 0xAD, 0x26, 0x56, 0x84, 0xA8, 0x87, 0x15, 0xA2, 0x6A, 0x27, 0x50, 0x2A, 0x16,
-    0xA6, 0xA4, 0x6A, 0x84, 0xEA, 0x86, 0xA9, 0xFB, 0xA3, 0xB5, 0xB8, 0x6C, 0xEE, 0xB4, 0x02, 0x55,
-    0x1B, 0x25, 0xD9, 0xB2, 0xB2, 0x6A, 0xA5, 0x7F, 0xEB, 0xED, 0x3A, 0xD6, 0x32, 0x76, 0x4E, 0xF1,
-    0xF8, 0x17, 0x35, 0x92, 0xB1, 0x6E, 0x14, 0x31, 0x10, 0x86, 0x67, 0x6F, 0x05, 0x16, 0xB8, 0x30,
-    0x05, 0x15, 0x12, 0x2C, 0x1D, 0x12, 0x82, 0xF3, 0x0B, 0xEC, 0x65, 0x2F, 0x44, 0x88, 0x22, 0x45,
-    0xF2, 0x04, 0xC0, 0x1B, 0x5C, 0x93, 0xE2, 0x8A, 0x04, 0x2F, 0x50, 0xA4, 0xCC, 0xF5, 0x08, 0x91,
-    0x12, 0x90, 0x50, 0xA8, 0x48, 0x84, 0x4E, 0xB1, 0x73, 0x29, 0x52, 0x50, 0xDC, 0x92, 0xF4, 0x91,
-    0x41, 0x08, 0x90, 0x28, 0x30, 0xC9, 0xA2, 0x1C, 0xC1, 0xBB, 0xC3, 0x78, 0x2F, 0xAC, 0x9B, 0xF1,
-    0x8C, 0xE7, 0x9F, 0xDF, 0x9F, 0x97, 0xDB, 0x4E, 0xBF, 0x7F, 0xEB, 0xDD, 0xF3, 0xCD, 0xC3, 0x93,
-    0xC3, 0xDF, 0xED, 0xE1, 0x8C, 0xAA, 0x32, 0x2F, 0x1C, 0x84, 0xEF, 0x2A, 0x88, 0x5C, 0x58, 0xDE,
-    0x67, 0xF7, 0xE3, 0xBD, 0x11, 0x7A, 0x8D, 0x20, 0x81, 0x9B, 0xCC, 0x2B, 0xDF, 0x87, 0x3E, 0x28,
-    0xAB, 0x3D, 0xCC, 0x40, 0xFB, 0xFA, 0x23, 0x55, 0x69, 0xDF, 0xB3, 0xAC, 0xE2, 0x38, 0x67, 0xA2,
-    0x1F, 0xB9, 0xF6, 0xD9, 0xC2, 0x5A, 0x7E, 0x64, 0xD3, 0x95, 0x9E, 0xC0, 0xAE, 0xEE, 0x02, 0x48,
-    0xFC, 0x80, 0x0E, 0x96, 0xA1, 0x4D, 0x82, 0xAC, 0x68, 0x95, 0xE0, 0x21, 0x83, 0xC4, 0x08, 0x1B,
-    0x2D, 0x02, 0x2F, 0xC5, 0xC6, 0xDC, 0x8E, 0x75, 0x5B, 0xD2, 0x33, 0x64, 0xA3, 0x63, 0x9B, 0x6E,
-    0xAB, 0x04, 0x1F, 0xEB, 0x9C, 0x5B, 0x81, 0xF7, 0x66, 0x3F, 0x9B, 0xF4, 0xAD, 0x68, 0xF3, 0x03,
-    0x2C, 0xA5, 0xBF, 0x94, 0x24, 0xB8, 0x8A, 0x79, 0xE3, 0x0D, 0xD8, 0x2F, 0xBD, 0x1E, 0x21, 0x22,
-    0x28, 0x44, 0x27, 0x11, 0x2B, 0x5E, 0x83, 0x1E, 0x21, 0x08, 0x87, 0x79, 0xEC, 0xB3, 0x02, 0x70,
-    0xA1, 0x84, 0xEC, 0xA0, 0x06, 0x51, 0x52, 0xA2, 0xCE, 0x2C, 0xE0, 0x9A, 0x07, 0xF5, 0x0D, 0x21,
-    0xF9, 0x83, 0x86, 0xA3, 0x72, 0x2D, 0xFC, 0xE9, 0x41, 0x3B, 0x6E, 0xF9, 0x8B, 0x78, 0x67, 0xFF,
-    0x6B, 0xBA, 0x39, 0xEE, 0x9C, 0x8C, 0xDF, 0x1C, 0xB9, 0xE1, 0xB6, 0x12, 0x78, 0x07, 0x8D, 0xCC,
-    0xA3, 0xAE, 0x34, 0x99, 0xB9, 0x61, 0x58, 0xB3, 0x38, 0xAD, 0xDE, 0x77, 0x5D, 0xE9, 0x2A, 0xB1,
-    0x09, 0xCE, 0xCF, 0x85, 0x1B, 0x25, 0x01, 0x51, 0x21, 0x6C, 0xE2, 0xC4, 0xE9, 0x2A, 0x1E, 0xA1,
-    0xBF, 0x32, 0x10, 0x18, 0x45, 0x16, 0x52, 0xB8, 0x16, 0x23, 0x60, 0x01, 0xC3, 0xCB, 0x89, 0xC0,
-    0x3D, 0xFC, 0xA4, 0x0B, 0x32, 0x2D, 0x40, 0x18, 0xEE, 0xD8, 0x30, 0x1E, 0xC7, 0xBB, 0xA3, 0xBF,
-    0x15, 0xE2, 0xDD, 0x1E, 0x01, 0x89, 0xCA, 0x9B, 0x2F, 0x95, 0x5F, 0x82, 0x25, 0xD0, 0x03, 0x62,
-    0xDA, 0x81, 0x99, 0x87, 0x2B, 0xC4, 0x74, 0xD2, 0x1B, 0xB4, 0x6A, 0x86, 0x4F, 0x0B, 0x92, 0x7B,
-    0xFF, 0x45, 0xE2, 0xC2, 0xFE, 0xB1, 0x4B, 0x87, 0xE2, 0xC1, 0xB3, 0x5D, 0xB4, 0xD2, 0x6A, 0x94,
-    0x68, 0x22, 0x07, 0x43, 0x7A, 0x83, 0xA4, 0xCB, 0x8B, 0xD8, 0x11, 0x55, 0x05, 0x32, 0x3F, 0xB7,
-    0x18, 0x2D, 0x32, 0x8C, 0xF7, 0x9D, 0x4B, 0x3B, 0x92, 0xE3, 0x2C, 0x7E, 0x74, 0xCB, 0x5B, 0xA2,
-    0xB7, 0x71, 0x40, 0x98, 0xEC, 0xF9, 0x01, 0x47, 0xF6, 0xA4, 0x81, 0x7A, 0x9B, 0x11, 0xD4, 0xAC,
-    0x02, 0x71, 0x61, 0x9E, 0xEC, 0x61, 0xD1, 0x50, 0x3D, 0x05, 0x20, 0xC0, 0xCA, 0x00, 0x01, 0x94,
-    0x8E, 0x60, 0x02, 0xF7, 0x10, 0x57, 0xD0, 0x42, 0x2A, 0x74, 0x43, 0x21, 0x64, 0x4B, 0x88, 0x3D,
-    0x44, 0x94, 0xD2, 0x39, 0x48, 0xDB, 0xEC, 0xAB, 0xA6, 0x4E, 0x5D, 0x62, 0x02, 0x71, 0xDD, 0xA8,
-    0xC8, 0xA6, 0x39, 0x0A, 0x69, 0x3A, 0xE3, 0x49, 0x83, 0x04, 0xCE, 0x22, 0x9A, 0x41, 0x3A, 0x35,
-    0x55, 0x0B, 0xC8, 0x3C, 0x30, 0x2A, 0xD1, 0x1F, 0x72, 0xF1, 0x15, 0x77, 0x8D, 0x54, 0x66, 0x42,
-    0x6B, 0x50, 0x94, 0xD3, 0x84, 0x36, 0x61, 0x4A, 0x70, 0xA1, 0xA6, 0x51, 0x3D, 0x8D, 0xDC, 0xFF,
-    0xC9, 0x64, 0x83, 0x4F, 0x9A, 0x03, 0xE4, 0x29, 0xCC, 0x3B, 0xB3, 0x41, 0x23, 0xA7, 0x37, 0xF1,
-    0x61, 0x1F, 0x2C, 0xA0, 0x09, 0xB3, 0xB3, 0x12, 0x12, 0x1F, 0x1C, 0x70, 0x84, 0x18, 0xF3, 0x16,
-    0xB1, 0x44, 0x0B, 0xAF, 0xD7, 0xE1, 0x1F, 0x8D, 0x56, 0xBF, 0x6F, 0xDD, 0x54, 0x14, 0x3E, 0xB6,
-    0x49, 0x2D, 0xE1, 0xC1, 0x1D, 0x08, 0x4B, 0x07, 0x4F, 0x2C, 0x45, 0xC2, 0x2B, 0x9B, 0x5D, 0x55,
-    0x82, 0xB1, 0x19, 0x92, 0x76, 0x4C, 0xE7, 0x2E, 0xD9, 0x91, 0xC0, 0x4F, 0x74, 0xE8, 0xC0, 0x40,
-    0x06, 0xDA, 0x85, 0xA1, 0x4B, 0x91, 0xAA, 0x30, 0xE4, 0x1F, 0x68, 0x63, 0x43, 0x86, 0x0C, 0x2C,
-    0x86, 0x0A, 0x15, 0x89, 0x81, 0x07, 0x2D, 0x2A, 0xA2, 0x43, 0x5C, 0xF5, 0xB5, 0x7D, 0x69, 0xAF,
-    0x7D, 0xF8, 0xBE, 0x73, 0xFD, 0x92, 0x26, 0x95, 0x2A, 0xAC, 0xF7, 0xCE, 0xB9, 0xBF, 0xEF, 0x39,
-    0xDF, 0xF9, 0x71, 0x8F, 0x88, 0xDC, 0x3E, 0x2B, 0x22, 0x55, 0xDA, 0x88, 0xE4, 0xD7, 0x3A, 0x91,
-    0xF4, 0xE7, 0xB9, 0x48, 0xD4, 0xDD, 0xC5, 0xA0, 0x2B, 0x16, 0x33, 0xD5, 0x8B, 0xB9, 0x04, 0xAA,
-    0x2A, 0x11, 0x48, 0x43, 0x32, 0x25, 0x99, 0x85, 0xAA, 0x8F, 0x7B, 0x51, 0xC5, 0x9E, 0x5A, 0xBB,
-    0x1D, 0x29, 0x7A, 0x57, 0x94, 0xD9, 0x80, 0x3D, 0x89, 0xAE, 0x5F, 0xED, 0x22, 0xFD, 0x09, 0x33,
-    0xFA, 0x74, 0x86, 0x19, 0xC7, 0x19, 0x2D, 0x52, 0xEC, 0xDE, 0xBF, 0xDA, 0x61, 0xCF, 0x9F, 0x4E,
-    0x0A, 0x9D, 0xED, 0xBC, 0x93, 0xA8, 0xD6, 0xFB, 0xE7, 0x70, 0x9A, 0xB6, 0x05, 0xCF, 0x44, 0x5F,
-    0x07, 0x61, 0x7F, 0x92, 0xF2, 0x22, 0x36, 0xE7, 0x92, 0x71, 0x30, 0xC1, 0x1E, 0x09, 0x67, 0x5F,
-    0x50, 0xB6, 0x7C, 0x22, 0x52, 0xA4, 0xAD, 0x48, 0xB6, 0x0B, 0xA9, 0x83, 0x72, 0x55, 0x0E, 0xBF,
-    0x0D, 0xFD, 0x07, 0x22, 0x43, 0x50, 0x5C, 0xA0, 0x4E, 0x78, 0xCA, 0xC4, 0xC4, 0x85, 0x90, 0xFF,
-    0x6E, 0x43, 0x0A, 0xEC, 0x8A, 0x14, 0xBB, 0x20, 0x15, 0x48, 0xA2, 0x38, 0x4A, 0x30, 0x0B, 0xE5,
-    0x15, 0xBB, 0x45, 0xBB, 0x58, 0x67, 0x68, 0x56, 0x7A, 0x0E, 0xCD, 0x9E, 0xA3, 0x15, 0x16, 0xCC,
-    0xE3, 0x0E, 0xCD, 0xB6, 0x8A, 0xCB, 0x5A, 0x1F, 0xEB, 0x2C, 0xA6, 0x88, 0x65, 0x31, 0xC2, 0x30,
-    0x4A, 0x3B, 0xE7, 0x95, 0x38, 0xCF, 0x9A, 0x81, 0x35, 0x8F, 0xBE, 0xA0, 0xDE, 0x04, 0xC8, 0x90,
-    0x88, 0xD3, 0x65, 0xA8, 0x37, 0x00, 0xA5, 0x93, 0x8F, 0xCA, 0x68, 0x2E, 0x26, 0x6F, 0xFF, 0x1A,
-    0x59, 0xD6, 0x35, 0x68, 0x54, 0x73, 0x5B, 0x55, 0x8A, 0x9D, 0xFA, 0x1A, 0x91, 0x94, 0xD2, 0x1F,
-    0x91, 0x9C, 0x10, 0x50, 0xA3, 0x4C, 0x1F, 0x8A, 0x61, 0x35, 0xC9, 0x88, 0x1D, 0xC9, 0x8C, 0xC4,
-    0x99, 0x00, 0x29, 0x74, 0x0C, 0xB6, 0x26, 0x9E, 0x03, 0xD9, 0x0C, 0x3C, 0xC4, 0x36, 0xCF, 0x67,
-    0x23, 0x77, 0x76, 0x5C, 0x04, 0x21, 0x3C, 0xD7, 0x05, 0x2F, 0x0B, 0xCF, 0x9B, 0xE3, 0xBC, 0x9E,
-    0x82, 0x53, 0x2C, 0x7C, 0xFD, 0x49, 0x0E, 0x74, 0xAF, 0x0D, 0xD5, 0x94, 0x28, 0x5F, 0x55, 0xCF,
-    0xBF, 0xA4, 0x51, 0x81, 0xE4, 0x64, 0xC1, 0x6B, 0x1A, 0x24, 0xD5, 0xA6, 0x1A, 0x79, 0x31, 0xF2,
-    0x6C, 0xE4, 0xF8, 0x19, 0x4F, 0xC8, 0xCF, 0x6E, 0xDD, 0x32, 0x43, 0x71, 0x2F, 0x8D, 0x5A, 0x1A,
-    0x9A, 0x10, 0xBC, 0x68, 0x63, 0x1D, 0xC5, 0xF8, 0xC3, 0xE8, 0xB3, 0x8B, 0x7A, 0xFD, 0x92, 0xAE,
-    0x4A, 0xD5, 0x0A, 0x36, 0x66, 0x07, 0x17, 0xA1, 0x69, 0x6C, 0x86, 0x09, 0x3D, 0x22, 0x35, 0x7D,
-    0x0A, 0x06, 0x21, 0x4D, 0x28, 0x2B, 0x27, 0x1E, 0xD2, 0x17, 0xA6, 0x44, 0xAB, 0x98, 0xCB, 0xE8,
-    0x12, 0xBC, 0xA9, 0x21, 0x33, 0xA7, 0xF1, 0x5E, 0x73, 0x6C, 0x22, 0xF0, 0x13, 0xA9, 0xDF, 0x08,
-    0x3E, 0x8C, 0x9C, 0xE2, 0x81, 0xFF, 0x5A, 0xD9, 0xF6, 0xB4, 0x49, 0x8D, 0x67, 0x4D, 0xD2, 0x8E,
-    0x7C, 0xFA, 0x06, 0x8F, 0x87, 0x32, 0x6B, 0xD2, 0x29, 0x54, 0x69, 0xF2, 0x26, 0x6F, 0xA5, 0xDA,
-    0x6E, 0x72, 0xFA, 0xF2, 0x9D, 0xA0, 0xCC, 0x79, 0xDE, 0x1D, 0x13, 0x59, 0xE4, 0x73, 0xE3, 0x25,
-    0xF4, 0x96, 0x62, 0xC0, 0x7C, 0x3E, 0x48, 0xD1, 0xA1, 0x93, 0x20, 0x8E, 0xBA, 0x6C, 0x4A, 0x99,
-    0xC0, 0x21, 0x57, 0x32, 0xF7, 0x3C, 0x72, 0xE0, 0x33, 0xF9, 0xD8, 0x38, 0x02, 0x76, 0x9B, 0xDC,
-    0xC1, 0x49, 0x39, 0xEF, 0x80, 0x25, 0xD7, 0xF7, 0x80, 0xA0, 0x59, 0x5E, 0x59, 0x5A, 0x95, 0x33,
-    0x07, 0x72, 0xE2, 0x83, 0x52, 0x01, 0x82, 0x16, 0x2E, 0x5D, 0x99, 0xDB, 0xE5, 0x4D, 0x08, 0x24,
-    0x20, 0x2A, 0xDC, 0x14, 0x3E, 0x9C, 0x41, 0xB7, 0x5E, 0xE2, 0xD9, 0x52, 0x59, 0x94, 0xD2, 0x47,
-    0x5D, 0x46, 0xB9, 0xF1, 0xFD, 0x6E, 0xF4, 0xF9, 0xE8, 0x0F, 0x75, 0xD6, 0xE3, 0x84, 0x7C, 0x4F,
-    0x2F, 0xB4, 0x12, 0x3F, 0xD7, 0x07, 0x33, 0x09, 0x7A, 0xED, 0x9D, 0xB9, 0x78, 0x4D, 0xC8, 0xF6,
-    0xA1, 0x4B, 0xA4, 0x4F, 0x09, 0xA5, 0xBA, 0x1A, 0x36, 0xC8, 0x87, 0xAC, 0xF7, 0xFE, 0x53, 0x42,
-    0xA9, 0x96, 0x80, 0x57, 0x1D, 0x5D, 0x2F, 0x75, 0x09, 0xF6, 0x45, 0x43, 0x30, 0x2C, 0x02, 0xEC,
-    0xE5, 0x37, 0xA0, 0xB0, 0x71, 0x6B, 0x41, 0xD0, 0xC9, 0x80, 0x58, 0xEA, 0xA2, 0x03, 0xFD, 0xBB,
-    0xEE, 0xD2, 0x47, 0xF0, 0xEB, 0xA6, 0xB8, 0x89, 0xA4, 0x50, 0x0E, 0x08, 0xE7, 0x9D, 0xE8, 0xC0,
-    0x7D, 0x10, 0xCE, 0xD3, 0x47, 0x9D, 0x26, 0xD3, 0xE2, 0xE6, 0xAE, 0xCB, 0x1B, 0xE4, 0xAD, 0xAE,
-    0xC6, 0x70, 0xF1, 0xA3, 0xE3, 0x70, 0x70, 0xB9, 0xC2, 0xB0, 0x04, 0x43, 0x95, 0xCC, 0x25, 0x3E,
-    0x70, 0xC0, 0xAC, 0x78, 0xD4, 0x15, 0xC3, 0x25, 0xBD, 0x09, 0x57, 0x55, 0x1C, 0x52, 0xD1, 0x99,
-    0xE4, 0x8C, 0xF9, 0xA2, 0xBC, 0xBF, 0xCD, 0x58, 0x5F, 0x32, 0x83, 0xF7, 0x66, 0xED, 0xD6, 0x1C,
-    0xCA, 0x99, 0x9D, 0x1A, 0x09, 0xBE, 0xD7, 0xDB, 0xE6, 0x03, 0xD0, 0xE5, 0xA1, 0x33, 0x31, 0x1B,
-    0xA6, 0x08, 0xAA, 0x7E, 0x1F, 0xCD, 0xB8, 0x4B, 0xD1, 0xBC, 0x2B, 0x70, 0x95, 0xB4, 0x89, 0xD1,
-    0x74, 0x6C, 0x26, 0x2D, 0x75, 0xAC, 0x6F, 0x18, 0x28, 0x87, 0x67, 0xC1, 0x75, 0x1D, 0xBD, 0x6E,
-    0xBD, 0xF1, 0x8A, 0xD7, 0x4C, 0xCB, 0x89, 0x79, 0xB5, 0x35, 0x0F, 0x33, 0xCE, 0x95, 0x15, 0x9F,
-    0x71, 0xEC, 0x1E, 0x3B, 0x20, 0xF1, 0x29, 0xB1, 0x7C, 0x4F, 0x32, 0xBA, 0x71, 0xCE, 0xF0, 0x1F,
-    0xF3, 0x96, 0xF3, 0xA9, 0x67, 0xAB, 0xA6, 0x3A, 0xC5, 0x82, 0xBC, 0x5B, 0x23, 0xBA, 0x8A, 0xC3,
-    0x25, 0xB5, 0xE9, 0x9C, 0x31, 0x36, 0xB2, 0xC1, 0x7C, 0xFC, 0xE5, 0x6D, 0x3A, 0xBA, 0xA3, 0x42,
-    0x6E, 0x54, 0xB8, 0x22, 0x39, 0x35, 0x66, 0x9D, 0x8A, 0x86, 0x7F, 0x62, 0xE6, 0xDF, 0x33, 0xCA,
-    0x84, 0xA4, 0xCE, 0x86, 0x61, 0x45, 0x6D, 0x4A, 0x86, 0x51, 0x6E, 0x67, 0x71, 0x47, 0xC1, 0x51,
-    0x43, 0x27, 0xB4, 0xC0, 0x4E, 0x19, 0x99, 0x7E, 0x14, 0xA1, 0xFE, 0xC3, 0x44, 0xC2, 0x4F, 0xE9,
-    0x29, 0x10, 0xDB, 0x99, 0xEA, 0x9D, 0x81, 0x32, 0xA1, 0x7A, 0xED, 0xD1, 0x6A, 0xA6, 0xF3, 0xE7,
-    0x1C, 0x08, 0x12, 0x0B, 0xC2, 0xDC, 0x6C, 0x52, 0x73, 0x38, 0xDC, 0xDA, 0x32, 0x2B, 0xA9, 0x0F,
-    0xD3, 0x42, 0xC7, 0xDC, 0xCF, 0xA8, 0x5A, 0xBB, 0x34, 0x5C, 0xD4, 0x67, 0x6B, 0x63, 0xFA, 0x6A,
-    0x18, 0x5D, 0xB5, 0x3D, 0x1E, 0x06, 0x6E, 0x3C, 0x18, 0x6A, 0x81, 0x5E, 0xDF, 0xD6, 0x51, 0xB3,
-    0x89, 0xDD, 0x4E, 0xC8, 0x13, 0x7B, 0xAD, 0x2C, 0xB9, 0x4C, 0xBD, 0x4D, 0x5A, 0x03, 0x78, 0xE0,
-    0x65, 0xA9, 0xF7, 0xD1, 0x68, 0x7C, 0x10, 0x7C, 0xBE, 0x18, 0x33, 0xC9, 0x98, 0x4A, 0x16, 0x49,
-    0xE6, 0xC4, 0x64, 0xA6, 0xC7, 0xA3, 0x30, 0xB7, 0x45, 0xA1, 0x7B, 0x7B, 0xE7, 0x94, 0xEA, 0x2D,
-    0x2F, 0x52, 0x63, 0x49, 0xCF, 0x5C, 0x80, 0x12, 0x15, 0x16, 0x85, 0xA9, 0xBE, 0x70, 0xC1, 0x26,
-    0xDE, 0xB4, 0x82, 0xEF, 0xBE, 0x46, 0x8C, 0x23, 0xE4, 0x8D, 0x86, 0xB7, 0xFA, 0xCE, 0x84, 0x71,
-    0x5E, 0xCC, 0xF9, 0x36, 0xB1, 0x03, 0x55, 0xAA, 0x39, 0x70, 0xF8, 0x8E, 0x1D, 0xA6, 0x0A, 0x76,
-    0xF4, 0x3C, 0x93, 0x35, 0x0E, 0xE9, 0xA3, 0x83, 0x0D, 0xDD, 0xC5, 0xE8, 0xA4, 0xFE, 0x2D, 0xD7,
-    0xDD, 0x39, 0x3C, 0x19, 0xB3, 0xDF, 0x32, 0x75, 0xDB, 0xDD, 0x06, 0x67, 0x13, 0x8C, 0x20, 0x7A,
-    0x64, 0x53, 0x13, 0x07, 0x22, 0x1A, 0x3E, 0xF1, 0x4C, 0x16, 0x6F, 0xDD, 0x89, 0x4E, 0xB0, 0x62,
-    0x74, 0x7B, 0x98, 0x8C, 0xC6, 0x9A, 0x58, 0xC2, 0x55, 0x83, 0x25, 0x79, 0xA9, 0x96, 0xA5, 0x4F,
-    0x87, 0x23, 0x76, 0x49, 0xEF, 0x51, 0x82, 0xC0, 0xC1, 0xDA, 0x1A, 0xAC, 0xB9, 0xB6, 0x3A, 0xDA,
-    0xF2, 0xDE, 0xF1, 0x97, 0xA9, 0x1D, 0xE1, 0x5C, 0x5E, 0xB3, 0xEF, 0xFC, 0xF1, 0xD9, 0xC5, 0xE2,
-    0x80, 0x5E, 0x48, 0x23, 0x20, 0xB1, 0x11, 0x57, 0x1D, 0x36, 0x74, 0xEA, 0x71, 0xA5, 0x57, 0xE5,
-    0xE3, 0xD3, 0x5A, 0xF9, 0xAE, 0x7C, 0xA8, 0x07, 0xE5, 0x71, 0x6B, 0x11, 0x52, 0xF5, 0x46, 0xC9,
-    0xB5, 0x84, 0xB2, 0x58, 0x4B, 0xE8, 0xA6, 0xF9, 0x2B, 0x14, 0x41, 0x1B, 0x08, 0xF4, 0x4A, 0xB2,
-    0x27, 0x88, 0xBC, 0xBD, 0x2E, 0xD0, 0xAC, 0x89, 0x7B, 0xA4, 0xD6, 0x83, 0x1E, 0x6A, 0xB2, 0x0E,
-    0x60, 0x69, 0xD5, 0x5B, 0xAC, 0x6F, 0xE0, 0x78, 0xE6, 0x13, 0x1A, 0xA5, 0xF4, 0x11, 0xA5, 0x46,
-    0x07, 0x79, 0xE3, 0xF3, 0xE1, 0xF5, 0x26, 0x5D, 0x5A, 0x49, 0x5D, 0xB0, 0xCA, 0xB4, 0x69, 0x3E,
-    0xF7, 0x06, 0xCD, 0xFE, 0x07, 0xF5, 0x51, 0xF4, 0x36, 0x0A, 0x3C, 0x89, 0x78, 0xBF, 0xF8, 0x4B,
-    0x32, 0xE3, 0xD3, 0x23, 0xAF, 0x8F, 0x9D, 0xDD, 0x1E, 0x6E, 0x17, 0x96, 0x55, 0x58, 0x38, 0xB0,
-    0x4C, 0x9B, 0x5A, 0xC4, 0x9E, 0xE6, 0x25, 0xB4, 0x20, 0xE2, 0x0C, 0x6E, 0x42, 0x9C, 0x7D, 0x79,
-    0xC6, 0x97, 0x9F, 0xFF, 0x53, 0x28, 0x5E, 0xB6, 0x17, 0x45, 0x8F, 0xCA, 0x8A, 0xA4, 0x4F, 0x76,
-    0x18, 0xC7, 0x53, 0x7B, 0x72, 0x91, 0x88, 0x51, 0x03, 0x60, 0x79, 0xA5, 0x9F, 0x4C, 0x63, 0x7D,
-    0x35, 0xC8, 0x67, 0x9C, 0x42, 0x04, 0xE2, 0xF4, 0x61, 0xFD, 0xBE, 0xF6, 0x61, 0x5F, 0xA1, 0x96,
-    0xDB, 0x7B, 0xDC, 0xE5, 0xF3, 0xCB, 0xD5, 0xBA, 0xFA, 0x2C, 0x53, 0x61, 0x4D, 0x4C, 0xAB, 0x56,
-    0x9B, 0x0B, 0x08, 0xAF, 0xF8, 0xD7, 0x98, 0xAE, 0xC8, 0x9B, 0x02, 0xD3, 0x9D, 0xD5, 0x5B, 0x48,
-    0x3B, 0x5B, 0x5A, 0x0A, 0xCD, 0x03, 0x2D, 0xD6, 0x2B, 0xDD, 0x77, 0x92, 0xBD, 0x7A, 0xA6, 0x92,
-    0xB8, 0xBE, 0x68, 0xC2, 0xA1, 0xB8, 0x80, 0x52, 0xF3, 0xC2, 0x2F, 0x28, 0xA0, 0xEE, 0xCD, 0xEB,
-    0x32, 0xE9, 0x86, 0xBC, 0x0D, 0x5D, 0xF1, 0x15, 0x06, 0xD3, 0xBF, 0x30, 0xB8, 0xCB, 0xC1, 0x19,
-    0x07, 0x7B, 0x1B, 0xFC, 0xFA, 0x01, 0x06, 0x9F, 0x3A, 0x2D, 0x63, 0xA7, 0x0C, 0x34, 0x5F, 0xE2,
-    0x44, 0x96, 0x68, 0xC7, 0xEC, 0x14, 0x79, 0x8F, 0xB5, 0x1A, 0x47, 0xA2, 0xDE, 0x2A, 0x38, 0x4B,
-    0x4D, 0x82, 0xFA, 0x94, 0x2F, 0x84, 0x2F, 0x72, 0xE2, 0x61, 0xAD, 0xB6, 0xD0, 0x1B, 0xCB, 0x51,
-    0xED, 0xC4, 0x3B, 0x89, 0x75, 0xAC, 0x2C, 0xD5, 0xD6, 0xBC, 0x77, 0x73, 0x2C, 0x73, 0x2C, 0xB5,
-    0x4D, 0x2D, 0x40, 0x87, 0x45, 0x67, 0x99, 0x19, 0xF0, 0x28, 0x2D, 0x2D, 0x6A, 0x1B, 0x39, 0x2C,
-    0x74, 0xFE, 0x03, 0x95, 0x55, 0xBD, 0xAE, 0xDD, 0x44, 0x10, 0x1E, 0xDB, 0x10, 0x83, 0x2C, 0xE2,
-    0x3C, 0x00, 0xC2, 0x14, 0x54, 0x08, 0x69, 0x79, 0x00, 0xD0, 0x9E, 0xBC, 0xC1, 0xAD, 0x69, 0x0E,
-    0x35, 0x4D, 0xDE, 0x20, 0x36, 0x15, 0xC5, 0x29, 0xC8, 0x23, 0xA4, 0x84, 0x5B, 0x51, 0x50, 0xD0,
-    0xDC, 0xEB, 0x0D, 0x14, 0x29, 0x71, 0x68, 0x28, 0x59, 0x9D, 0x17, 0xC0, 0x44, 0x46, 0xB2, 0x12,
-    0xAF, 0x87, 0xEF, 0x1B, 0x9F, 0x73, 0x12, 0x09, 0x24, 0xC0, 0x3A, 0xFB, 0x69, 0xEF, 0xFE, 0xCC,
-    0x7C, 0xF3, 0xCD, 0xEC, 0x5C, 0x91, 0xF7, 0x05, 0xDF, 0x82, 0x91, 0xAF, 0x80, 0x2A, 0x01, 0x9A,
-    0x09, 0xD0, 0x46, 0x80, 0x76, 0x22, 0x85, 0x62, 0x52, 0xAB, 0xEA, 0xEA, 0x01, 0x6A, 0xD0, 0x10,
-    0x4A, 0x5E, 0xC8, 0x75, 0x07, 0xEC, 0x07, 0x80, 0x1B, 0x79, 0x90, 0xA6, 0x0A, 0x5A, 0x11, 0x5A,
-    0x91, 0x2B, 0xC2, 0x1B, 0x84, 0xBA, 0x23, 0xCC, 0xB4, 0xAF, 0x81, 0x80, 0x93, 0x4E, 0x75, 0x20,
-    0x24, 0xF1, 0x2F, 0x92, 0x46, 0x3F, 0xF7, 0xF5, 0xDA, 0x4C, 0x2E, 0xE8, 0xFD, 0xA9, 0x1A, 0xAB,
-    0xDD, 0xBD, 0x9C, 0xD6, 0xA4, 0x27, 0xB8, 0x40, 0x7A, 0x74, 0xF1, 0x8F, 0x8B, 0xD9, 0x37, 0xFC,
-    0xFB, 0x6D, 0x42, 0x43, 0x46, 0x2D, 0x77, 0xFC, 0x2B, 0x46, 0xE4, 0x9A, 0x31, 0x1C, 0x69, 0x87,
-    0x16, 0xE4, 0x27, 0xC2, 0x42, 0x48, 0x04, 0xD2, 0xF2, 0x16, 0x71, 0x38, 0x47, 0xCC, 0x6B, 0x8E,
-    0x31, 0xF8, 0xE1, 0xCC, 0x3E, 0x97, 0xF3, 0xF7, 0x2F, 0x6C, 0x2E, 0x8B, 0x45, 0x70, 0xE1, 0xDD,
-    0x62, 0xA9, 0xC6, 0xE6, 0x89, 0xFE, 0xB2, 0xB8, 0xA5, 0x49, 0xBD, 0x5B, 0xC4, 0x1C, 0xD6, 0xE6,
-    0x15, 0x4C, 0x70, 0x87, 0x20, 0x3D, 0x6F, 0x96, 0x04, 0xF9, 0x7C, 0x73, 0x06, 0x9F, 0x65, 0x28,
-    0xE0, 0xBE, 0x89, 0x15, 0x4E, 0xF8, 0x50, 0xC0, 0xAE, 0xF2, 0xC7, 0x89, 0x0F, 0x5C, 0x6C, 0xA2,
-    0x63, 0x32, 0x66, 0x46, 0xA1, 0x69, 0x9B, 0xD7, 0x5C, 0x1F, 0xB7, 0x33, 0xDB, 0x79, 0x69, 0xBB,
-    0x1C, 0x49, 0x71, 0x43, 0x09, 0x9F, 0x55, 0x28, 0xE2, 0xD9, 0xBE, 0x3C, 0xC2, 0xB8, 0x65, 0xE0,
-    0x91, 0x64, 0xA0, 0x91, 0x8E, 0x18, 0x9A, 0xAB, 0xDB, 0x4F, 0x5A, 0x3D, 0x4B, 0xEF, 0xE5, 0xD3,
-    0x3B, 0x22, 0x37, 0x0C, 0x0F, 0xBA, 0x56, 0x20, 0x93, 0x93, 0xEC, 0x8D, 0x64, 0xD1, 0xED, 0x06,
-    0xAD, 0x86, 0xE4, 0x9E, 0xFF, 0xA9, 0xF7, 0x71, 0x65, 0x87, 0xAA, 0x30, 0x1B, 0x52, 0x53, 0xED,
-    0xF5, 0x9C, 0x0F, 0x7C, 0x6F, 0x7E, 0xF6, 0x43, 0x65, 0x46, 0x55, 0x3B, 0x8C, 0xE8, 0xF5, 0x0A,
-    0xF1, 0x47, 0x28, 0x8D, 0x53, 0x2B, 0x26, 0xFE, 0xEB, 0x55, 0xEA, 0xA8, 0xB1, 0x9C, 0xEA, 0x35,
-    0x4B, 0x20, 0xD3, 0xEE, 0x50, 0x09, 0xC1, 0xD2, 0x51, 0x53, 0xD6, 0xEE, 0xEE, 0xB7, 0x57, 0x38,
-    0x0E, 0xEB, 0x18, 0x83, 0xA7, 0x6C, 0x59, 0x8B, 0x88, 0x3C, 0x72, 0xEA, 0x69, 0xE0, 0xE5, 0x2C,
-    0x7E, 0x5A, 0x31, 0x7C, 0xF0, 0x53, 0x3D, 0xFA, 0xA9, 0x58, 0xFC, 0x24, 0x3D, 0x6A, 0xD9, 0xFD,
-    0x48, 0xC2, 0x1F, 0x60, 0xDC, 0x91, 0x2D, 0x02, 0x54, 0xF9, 0x9D, 0x47, 0x0A, 0x35, 0x91, 0x64,
-    0x18, 0x0C, 0xBE, 0x6B, 0x96, 0x3A, 0x66, 0xFA, 0x15, 0x0E, 0xBF, 0x58, 0x50, 0xD3, 0x4A, 0xC3,
-    0x01, 0xFE, 0x46, 0xC4, 0x34, 0x83, 0x7A, 0x22, 0xF5, 0xDD, 0x17, 0xD7, 0xD7, 0xE4, 0xF2, 0x31,
-    0x8B, 0x22, 0x7B, 0x2C, 0xEE, 0x8F, 0x84, 0x0A, 0x69, 0x77, 0x6E, 0xAE, 0x63, 0x33, 0x17, 0x4B,
-    0x03, 0x6B, 0xB0, 0xE8, 0x7E, 0x5E, 0x90, 0xD1, 0x05, 0x52, 0x92, 0x5F, 0xB2, 0xC7, 0xB3, 0x9C,
-    0xA9, 0x87, 0x0F, 0xAF, 0xAF, 0x1F, 0x9F, 0x54, 0xA9, 0x0D, 0x5B, 0xB9, 0xBC, 0x18, 0x7B, 0x78,
-    0xF6, 0xE8, 0xB6, 0xF2, 0x93, 0x9E, 0xEE, 0x4A, 0xE6, 0x74, 0xB4, 0xFC, 0xFE, 0xA4, 0xF6, 0xFA,
-    0x66, 0xAB, 0x36, 0x5B, 0xB6, 0x97, 0x18, 0x6C, 0x2E, 0xCE, 0xD6, 0xBD, 0x19, 0xB1, 0xA2, 0x95,
-    0x87, 0xE6, 0xE1, 0x3B, 0x79, 0xED, 0x7B, 0x8B, 0x90, 0x1F, 0x69, 0x38, 0x9F, 0x6F, 0xEC, 0xDD,
-    0x3B, 0x26, 0x55, 0x0F, 0x89, 0x78, 0xC4, 0x83, 0xCC, 0x74, 0xEE, 0x13, 0x70, 0x75, 0x3A, 0x64,
-    0xFA, 0xFB, 0xE1, 0xE5, 0x9A, 0xE9, 0xD3, 0xE3, 0xDC, 0x47, 0x7D, 0x36, 0xDF, 0xD6, 0xC9, 0x0F,
-    0x0F, 0x5D, 0xB7, 0x16, 0x43, 0x73, 0x88, 0x77, 0xE5, 0x5E, 0x79, 0xA4, 0xD7, 0x6C, 0xBE, 0x35,
-    0x7F, 0x8E, 0xDC, 0xB1, 0x41, 0xDA, 0xFF, 0x69, 0xE3, 0xF4, 0x7D, 0x2F, 0x97, 0xDA, 0xDF, 0x98,
-    0x33, 0xF1, 0x27, 0x29, 0x32, 0x6B, 0x31, 0xB9, 0x8A, 0x49, 0x90, 0x99, 0x04, 0xA6, 0xC9, 0x6A,
-    0x9A, 0xD9, 0x23, 0xD6, 0x27, 0x84, 0xC5, 0x96, 0xC3, 0x45, 0x3E, 0x1D, 0xCE, 0x4F, 0x5F, 0x0A,
-    0xB3, 0x5D, 0xEE, 0x2E, 0x1E, 0xFF, 0x0F, 0xC9, 0xD7, 0x36, 0xAE, 0x6C, 0xE3, 0x53, 0x6E, 0x8C,
-    0x9B, 0x10, 0x75, 0xC2, 0x86, 0x0E, 0xFA, 0xEB, 0x71, 0xD6, 0xA1, 0x86, 0x74, 0xF0, 0x6A, 0xD2,
-    0xA1, 0xC5, 0x1D, 0x4C, 0xCD, 0xA3, 0xF5, 0xBB, 0x99, 0xC9, 0xCC, 0x56, 0x6B, 0x12, 0xCD, 0x21,
-    0x5C, 0xB2, 0x20, 0xF2, 0x8A, 0x94, 0x7C, 0x82, 0x8E, 0x61, 0x42, 0xB0, 0x1E, 0xF0, 0xA2, 0x46,
-    0x16, 0x05, 0x05, 0x40, 0x14, 0xD5, 0x62, 0xB2, 0xA0, 0xA9, 0xB1, 0xD3, 0x6A, 0x67, 0xC1, 0xA6,
-    0x4D, 0x8F, 0xC9, 0xDA, 0xB2, 0x3E, 0xDD, 0x7A, 0xB8, 0x95, 0x83, 0x76, 0x26, 0xCC, 0x90, 0x5B,
-    0x4B, 0x90, 0x6A, 0xE5, 0x0F, 0xD5, 0x61, 0x5D, 0x70, 0x33, 0x5D, 0x46, 0x7B, 0xD8, 0x1F, 0x49,
-    0xD1, 0x9D, 0x72, 0xB0, 0xFD, 0x13, 0xE0, 0x09, 0xB7, 0x35, 0x84, 0x05, 0xE5, 0xF7, 0x9B, 0x76,
-    0x4E, 0xF7, 0x6C, 0x31, 0x7B, 0x4D, 0x5E, 0xF7, 0x87, 0xA5, 0x7A, 0xB0, 0xFF, 0x32, 0x8A, 0xDB,
-    0xF3, 0xDC, 0xDF, 0xC1, 0x76, 0xED, 0x9C, 0xDD, 0xB0, 0xBB, 0x66, 0x45, 0xFA, 0xAD, 0xE9, 0xC7,
-    0x93, 0x0F, 0xF3, 0x46, 0xBF, 0x7F, 0x01, 0xAD, 0x55, 0x31, 0x8F, 0xDC, 0x44, 0x14, 0x7E, 0xB6,
-    0x09, 0x2B, 0xB2, 0xC5, 0x54, 0x34, 0x5C, 0xB1, 0x75, 0xD2, 0xF8, 0x27, 0x8C, 0x11, 0x05, 0x05,
-    0xCD, 0x15, 0x5C, 0x13, 0x8A, 0xF4, 0xA0, 0x28, 0x3D, 0x52, 0x34, 0x8B, 0x52, 0xA4, 0xBD, 0xE2,
-    0xE8, 0x53, 0x80, 0x90, 0xB6, 0x49, 0x4B, 0xC5, 0x58, 0xB9, 0xE2, 0x5A, 0x4B, 0x88, 0x86, 0x06,
-    0x17, 0x91, 0x50, 0x48, 0x71, 0x46, 0xB2, 0xC0, 0x17, 0x79, 0xFC, 0xF2, 0x7D, 0x6F, 0x2E, 0xBB,
-    0x70, 0x4A, 0x99, 0xB9, 0xF3, 0xF3, 0x78, 0xE6, 0xCD, 0x37, 0xEF, 0x7D, 0xF3, 0xCD, 0x5B, 0x91,
-    0xF2, 0x58, 0x44, 0x42, 0x2F, 0xE2, 0x74, 0x2B, 0x85, 0xCE, 0xF8, 0xF2, 0x9D, 0x48, 0xB1, 0xA0,
-    0xB3, 0x61, 0x27, 0x59, 0xA7, 0xF8, 0xE5, 0xD3, 0x54, 0xA8, 0xD6, 0x6D, 0x50, 0x9D, 0x9D, 0xAA,
-    0x3E, 0xD7, 0xEF, 0x74, 0xF6, 0x7D, 0xA5, 0x4F, 0x92, 0xD4, 0x63, 0x68, 0x0B, 0xFD, 0x7C, 0x16,
-    0x37, 0x84, 0xAE, 0xD0, 0x4A, 0x9B, 0xD8, 0x79, 0xF8, 0x61, 0x81, 0x6E, 0xD7, 0xAA, 0x83, 0xD4,
-    0x04, 0x0E, 0xC4, 0xFC, 0x58, 0xAE, 0xDB, 0x47, 0x78, 0x8E, 0xF4, 0xB4, 0x1C, 0x01, 0xAF, 0xDA,
-    0xC7, 0x4E, 0xE0, 0xA9, 0x97, 0x93, 0x94, 0x78, 0x29, 0x5C, 0x23, 0x37, 0xDC, 0xCA, 0x66, 0xC1,
-    0x48, 0x8F, 0xA7, 0x05, 0x0A, 0x82, 0x1B, 0xE0, 0x37, 0xE2, 0xA1, 0xDF, 0x56, 0xB4, 0x93, 0x00,
-    0x6C, 0x37, 0xCB, 0x66, 0x86, 0x87, 0xB6, 0x2B, 0x75, 0x09, 0x9F, 0x85, 0xB6, 0x8A, 0x50, 0xDA,
-    0x30, 0xAC, 0x13, 0xA6, 0x36, 0x33, 0x3D, 0xF5, 0x42, 0x85, 0xB3, 0xC9, 0x3C, 0xC5, 0x02, 0xC3,
-    0x5A, 0xAC, 0x5F, 0xD9, 0xE7, 0xD9, 0x57, 0xE8, 0x32, 0x0A, 0x22, 0x07, 0xBE, 0x46, 0x71, 0xF6,
-    0x09, 0x07, 0xB6, 0xAE, 0xB0, 0xD7, 0x84, 0x28, 0xA2, 0x6A, 0x92, 0x72, 0x96, 0x87, 0xFA, 0x52,
-    0x64, 0x2D, 0x37, 0xDA, 0xDD, 0xA7, 0xB4, 0x08, 0x1B, 0x73, 0x80, 0x46, 0xD8, 0x40, 0x64, 0xC4,
-    0x42, 0xA2, 0x49, 0x69, 0xBC, 0x04, 0x23, 0x95, 0xD6, 0x48, 0xBF, 0x9E, 0xC2, 0x00, 0xE7, 0x4E,
-    0x49, 0x01, 0xF3, 0xF4, 0x23, 0x28, 0x44, 0xC7, 0x2D, 0x82, 0x7F, 0xC4, 0x1E, 0x07, 0xF1, 0x53,
-    0x85, 0x99, 0x38, 0x6C, 0x12, 0x71, 0x11, 0x79, 0x85, 0x6C, 0x7E, 0x3B, 0xB9, 0xAF, 0xF7, 0x8D,
-    0x2E, 0x8B, 0xF6, 0xCA, 0xA2, 0xFB, 0x33, 0x27, 0xC0, 0x91, 0xC4, 0xDE, 0xBF, 0x34, 0xBF, 0xEB,
-    0x5F, 0xF1, 0x75, 0xB5, 0x88, 0x36, 0x6E, 0xAA, 0x92, 0xF8, 0xDE, 0x8D, 0xA2, 0x5B, 0xDF, 0xBD,
-    0x87, 0x21, 0x6B, 0xC5, 0x97, 0x72, 0x22, 0xEF, 0x1D, 0x9A, 0x43, 0x1B, 0x86, 0xBF, 0x4F, 0xE6,
-    0x9F, 0x1D, 0x1A, 0x73, 0x4B, 0xD7, 0x99, 0xFD, 0xB1, 0xEC, 0x76, 0x24, 0xD1, 0x8F, 0xA6, 0x0D,
-    0x7B, 0x48, 0x67, 0x04, 0xF7, 0x11, 0xCC, 0x83, 0xF1, 0x8A, 0xDA, 0x6B, 0x65, 0x8D, 0x17, 0x28,
-    0x04, 0x81, 0x85, 0xBE, 0xDE, 0xFD, 0xC4, 0xB5, 0x19, 0x99, 0x50, 0x58, 0x21, 0xC7, 0x9F, 0xE0,
-    0xC0, 0xA1, 0xDB, 0x89, 0xDA, 0x8D, 0xCB, 0xEE, 0x8C, 0x47, 0x48, 0x25, 0xC2, 0x62, 0x6D, 0xC1,
-    0x83, 0x07, 0xED, 0x3F, 0x4A, 0x86, 0x14, 0x59, 0x4D, 0xB4, 0xEB, 0x91, 0xD6, 0x99, 0xDD, 0x10,
-    0x47, 0x6A, 0xB3, 0x9E, 0xA7, 0x2F, 0xA1, 0xA3, 0x65, 0x24, 0xB6, 0x3B, 0x61, 0xA0, 0x04, 0x48,
-    0xA1, 0x11, 0x69, 0x2A, 0xEA, 0xE1, 0xE7, 0x15, 0x6D, 0xFC, 0x82, 0x1B, 0x85, 0xCB, 0x64, 0x62,
-    0xB1, 0x4B, 0x67, 0x97, 0xD1, 0x99, 0x5D, 0x71, 0x6B, 0xEC, 0xCD, 0x4D, 0x8A, 0xDD, 0xD3, 0x83,
-    0xD0, 0xEA, 0x85, 0x99, 0x7A, 0x1D, 0x10, 0xA7, 0x27, 0x41, 0x7D, 0x4D, 0x3B, 0xBB, 0xF4, 0xA1,
-    0x76, 0xE1, 0xF1, 0x2C, 0x75, 0xBB, 0xFA, 0x3B, 0x49, 0xD5, 0xCB, 0x1C, 0x1A, 0x81, 0x70, 0x71,
-    0xA7, 0x7D, 0x53, 0x9F, 0xCF, 0xD4, 0xF7, 0x90, 0xD5, 0x9C, 0x57, 0x54, 0xF9, 0xDA, 0x05, 0x1D,
-    0x61, 0x2B, 0x1D, 0xD6, 0x57, 0x22, 0xB7, 0x9A, 0xB7, 0xFB, 0x3C, 0xEC, 0x2D, 0x96, 0xCE, 0xC8,
-    0xC0, 0xE8, 0x7A, 0x79, 0x60, 0x95, 0xE2, 0x03, 0x31, 0x8A, 0x11, 0xA1, 0x31, 0x52, 0x5B, 0xCE,
-    0x74, 0x90, 0xAC, 0x0C, 0x67, 0x54, 0x84, 0x9C, 0xB8, 0xB1, 0x35, 0x1D, 0xB8, 0x79, 0xB7, 0x5F,
-    0x79, 0xD3, 0xAF, 0xA0, 0xDF, 0x23, 0x5C, 0x71, 0xB1, 0x5A, 0x62, 0x55, 0x05, 0x11, 0xAA, 0x5D,
-    0x20, 0xDE, 0xB1, 0xD2, 0x0E, 0x49, 0xBE, 0x3E, 0x3D, 0xD0, 0x32, 0xFA, 0xD1, 0x4F, 0x7E, 0x0E,
-    0x73, 0xC4, 0xDF, 0x7F, 0x6F, 0xE6, 0x3B, 0x66, 0xEA, 0xBE, 0x38, 0x46, 0x6A, 0xFE, 0xB9, 0xEA,
-    0xE3, 0xD9, 0xFF, 0x9A, 0xFC, 0xF9, 0xBC, 0x01, 0x2B, 0x5D, 0xB0, 0x73, 0xD9, 0xDE, 0xF4, 0xF9,
-    0x6C, 0xF6, 0x17, 0x29, 0x5C, 0x1C, 0x7C, 0x8A, 0x6B, 0x1F, 0xB6, 0x3B, 0xFB, 0x64, 0xAC, 0x82,
-    0x8A, 0x6F, 0xDF, 0x2A, 0x24, 0xA7, 0xCF, 0xDA, 0x4A, 0x25, 0x5A, 0x95, 0xB1, 0x6A, 0x32, 0xDA,
-    0xB1, 0x5D, 0x2C, 0x3B, 0x4B, 0xC8, 0x04, 0x94, 0xD5, 0x15, 0x5F, 0xE1, 0x6C, 0xE9, 0x60, 0x37,
-    0xE0, 0xDC, 0x0E, 0xE9, 0xDB, 0x67, 0x84, 0x2A, 0x0F, 0xD0, 0x6E, 0x3A, 0x40, 0xF7, 0x19, 0x1A,
-    0xED, 0x64, 0x7F, 0x6E, 0xD6, 0x29, 0x8D, 0xDC, 0x23, 0x9B, 0xB2, 0xA4, 0x50, 0x88, 0x5A, 0x63,
-    0xB3, 0xE1, 0x40, 0x32, 0x6D, 0xBF, 0xB0, 0x81, 0x2D, 0xB5, 0xB6, 0x18, 0xE6, 0x92, 0xDD, 0x97,
-    0x46, 0x4C, 0x59, 0xA7, 0xC8, 0xD3, 0x5E, 0x56, 0x19, 0x29, 0x09, 0x03, 0xC1, 0xCB, 0xD0, 0x51,
-    0xA5, 0xEE, 0xE0, 0xA7, 0xE4, 0x08, 0x22, 0x59, 0xCE, 0x24, 0xD7, 0xCB, 0x1F, 0xAA, 0x5C, 0x3C,
-    0x6F, 0x7D, 0xC3, 0xDA, 0xC9, 0xE2, 0xFF, 0x6C, 0xFA, 0x5F, 0x99, 0x2C, 0x8D, 0xB8, 0xAC, 0x80,
-    0xCA, 0x3C, 0xAA, 0xBC, 0x6D, 0xBC, 0x2E, 0x9D, 0xA6, 0x90, 0x68, 0xB2, 0xCF, 0xC1, 0xED, 0x3F,
-    0x08, 0x54, 0xB3, 0x7F, 0xC4, 0x6B, 0x49, 0x3A, 0xA1, 0x78, 0x08, 0xB8, 0x71, 0x16, 0xA4, 0xB3,
-    0x0D, 0x1D, 0xB3, 0x12, 0x77, 0x45, 0xC8, 0xDB, 0x80, 0xBA, 0x07, 0x84, 0x7B, 0x08, 0xFB, 0xF6,
-    0xE1, 0xA6, 0x0C, 0xC8, 0x6D, 0xF9, 0x5E, 0xE2, 0xCB, 0xE3, 0x7D, 0x54, 0x6F, 0x00,
+static const uint8_t opendyslexic_14_boldBitmaps[35159] = {
+    0xD5, 0x9C, 0x3F, 0xAC, 0x25, 0xC7, 0x75, 0xE6, 0x7F, 0xDD, 0x2D, 0xBE, 0x06, 0xDC, 0x80, 0x8B,
+    0x81, 0xA5, 0x40, 0x83, 0xDD, 0xDE, 0xC0, 0xC1, 0x42, 0x1B, 0xF4, 0x86, 0x0E, 0x2C, 0x55, 0x93,
+    0xC4, 0x82, 0x01, 0x83, 0x99, 0x60, 0x9E, 0x17, 0xB0, 0x03, 0x6E, 0xB2, 0xC0, 0x5A, 0xC0, 0x62,
+    0x36, 0xDC, 0xC0, 0xDC, 0x6A, 0xCD, 0x00, 0x56, 0xE0, 0x80, 0x13, 0x48, 0xC9, 0x26, 0x64, 0x20,
+    0x2F, 0xA4, 0x67, 0x60, 0x67, 0x03, 0x07, 0x1B, 0xD0, 0xAA, 0x9A, 0x19, 0x60, 0x27, 0x60, 0xB0,
+    0x2D, 0x8E, 0x0D, 0x06, 0x0A, 0xDC, 0xDA, 0x21, 0x41, 0x5B, 0x0A, 0x58, 0x43, 0x35, 0xA5, 0x7E,
+    0x64, 0x75, 0x7F, 0x1B, 0x54, 0xDF, 0xF7, 0x67, 0x66, 0x48, 0xD9, 0x06, 0x0D, 0xCB, 0xF7, 0x55,
+    0x77, 0x55, 0xDF, 0x77, 0x6F, 0x77, 0xFD, 0x3D, 0xE7, 0x3B, 0xE7, 0x3B, 0x75, 0x81, 0x7F, 0x4B,
+    0x4B, 0x1D, 0x8B, 0x15, 0xDF, 0x77, 0xC1, 0xC4, 0x2A, 0x21, 0x6C, 0x30, 0xB1, 0x4A, 0x85, 0x70,
+    0xA1, 0x8D, 0x4D, 0x2A, 0x85, 0x42, 0x1B, 0x49, 0x34, 0xD0, 0x73, 0xF1, 0x55, 0xE9, 0x05, 0x4D,
+    0x7E, 0xE9, 0x64, 0x74, 0x5F, 0x8F, 0x95, 0x9C, 0x7A, 0xB7, 0x1A, 0xBD, 0xAD, 0xA0, 0xC5, 0x27,
+    0xA3, 0x57, 0xD4, 0x2B, 0xFA, 0x68, 0xD4, 0x08, 0x45, 0x3F, 0x1B, 0x35, 0xEA, 0x73, 0xC1, 0xA8,
+    0x57, 0x84, 0x66, 0xAE, 0x12, 0x80, 0x39, 0xE4, 0xF1, 0x90, 0xD7, 0x09, 0xA0, 0x8D, 0xCD, 0x21,
+    0x5F, 0x00, 0xBA, 0x68, 0x16, 0xA8, 0x25, 0x49, 0x5A, 0x9B, 0x9C, 0x27, 0x93, 0xF3, 0xA5, 0xCD,
+    0xF9, 0x0C, 0x6E, 0x6C, 0x23, 0x80, 0x1B, 0xBB, 0x08, 0xE0, 0x0F, 0x79, 0xB0, 0x11, 0x40, 0x97,
+    0xF2, 0xFD, 0xFB, 0xF3, 0xFE, 0xFD, 0xD8, 0xED, 0xB9, 0xCD, 0xF9, 0x44, 0xA9, 0xC1, 0x8F, 0x40,
+    0xA5, 0x41, 0x01, 0xA8, 0xD4, 0x5F, 0xCA, 0x6B, 0xB1, 0xE7, 0x85, 0xC2, 0x79, 0xFF, 0xD4, 0xF1,
+    0xFC, 0xDC, 0x5C, 0x38, 0xDF, 0xD8, 0xBE, 0x03, 0x8D, 0xB4, 0x82, 0x93, 0x12, 0x85, 0xA4, 0x99,
+    0x4A, 0xFA, 0xC5, 0x9B, 0x54, 0xFA, 0x93, 0x08, 0xB5, 0x9A, 0x0B, 0xE7, 0xD7, 0x23, 0x54, 0x52,
+    0x84, 0x52, 0x3A, 0x05, 0x72, 0x23, 0x3B, 0x49, 0x3D, 0x47, 0x92, 0x26, 0x30, 0xD2, 0x0C, 0xE6,
+    0x53, 0x25, 0x30, 0x93, 0x5F, 0x99, 0xCC, 0x64, 0xD7, 0x4A, 0xAF, 0x4F, 0x6E, 0x6D, 0xA4, 0x4F,
+    0x95, 0x3A, 0x49, 0x9A, 0x9D, 0x24, 0x4D, 0x9D, 0xA4, 0x0D, 0x6E, 0x48, 0xB7, 0x01, 0x33, 0xF2,
+    0x39, 0x67, 0x28, 0xBF, 0x07, 0x90, 0x47, 0xA6, 0x58, 0x69, 0x16, 0x10, 0x46, 0x01, 0x8F, 0xF9,
+    0xD1, 0x82, 0x1D, 0xAA, 0xB1, 0xC3, 0x86, 0x22, 0xD6, 0xA1, 0x9D, 0x78, 0xAD, 0x88, 0x26, 0x62,
+    0x86, 0xD4, 0xCC, 0x54, 0xDA, 0xEA, 0x04, 0x4E, 0xD5, 0x0A, 0xB5, 0x5E, 0xDC, 0x80, 0xDF, 0x42,
+    0xCD, 0x02, 0xF8, 0xD7, 0x15, 0xC0, 0xBD, 0xFD, 0xA3, 0x05, 0xEC, 0xC3, 0xA9, 0x83, 0x2E, 0xCE,
+    0x75, 0xC0, 0xCC, 0x5F, 0x2F, 0x66, 0x4C, 0x32, 0xC3, 0x1F, 0x51, 0xA7, 0xEA, 0xD4, 0x53, 0x6D,
+    0x78, 0x0D, 0x65, 0x7E, 0xA6, 0x06, 0xFC, 0xC0, 0xC5, 0x6E, 0xCE, 0xAF, 0x6E, 0x03, 0x9C, 0x16,
+    0x70, 0x83, 0xEF, 0xB1, 0x7D, 0x1D, 0x31, 0x81, 0xBF, 0xA0, 0x8A, 0x74, 0x03, 0x2B, 0x66, 0xA4,
+    0x1B, 0x4D, 0xA4, 0x5A, 0xBB, 0x65, 0xFF, 0x64, 0xAD, 0x05, 0xCA, 0xDC, 0xB1, 0x1B, 0x14, 0xFA,
+    0x70, 0x6A, 0x92, 0xEE, 0xA9, 0xDC, 0xEC, 0xD4, 0x46, 0xBD, 0x31, 0x17, 0xF2, 0x0F, 0x44, 0xAB,
+    0x9F, 0x68, 0x2E, 0xF3, 0x7C, 0x48, 0x8D, 0x24, 0x8D, 0x92, 0x3E, 0x8D, 0x8D, 0x34, 0xFD, 0x17,
+    0x6E, 0x6C, 0x3D, 0xB8, 0xCD, 0xAD, 0x2E, 0xB9, 0xC5, 0xCD, 0x6E, 0x76, 0xB3, 0x5B, 0xFC, 0xE2,
+    0x17, 0xF8, 0x04, 0x34, 0xE0, 0x02, 0x76, 0xA4, 0x8B, 0x98, 0x48, 0x93, 0xA8, 0x56, 0x4A, 0x81,
+    0x7A, 0x5C, 0xA0, 0x8B, 0x98, 0x99, 0x2A, 0x51, 0x08, 0xFC, 0x40, 0x37, 0x61, 0x66, 0xAA, 0x15,
+    0xD4, 0x63, 0x47, 0xCC, 0x42, 0xB5, 0x81, 0x06, 0xBA, 0x48, 0x93, 0x28, 0xD4, 0x63, 0x27, 0x4C,
+    0xA2, 0x54, 0x8F, 0xDB, 0x4B, 0x03, 0x2E, 0x62, 0x36, 0x0A, 0x8D, 0xD8, 0x44, 0xAD, 0x1E, 0x45,
+    0x7E, 0xE3, 0x07, 0x4D, 0xA4, 0x5A, 0xC1, 0x06, 0x9A, 0x04, 0xEA, 0xE9, 0xF2, 0x1B, 0x3E, 0x60,
+    0x66, 0x4A, 0x81, 0xCB, 0xA5, 0x2D, 0x97, 0xE2, 0xE1, 0xC9, 0xDD, 0x44, 0xB3, 0x50, 0xE6, 0x3A,
+    0xD9, 0xE9, 0xAC, 0x1A, 0x3D, 0x2E, 0xB7, 0x24, 0x51, 0x6D, 0x94, 0xEA, 0x51, 0xC0, 0x45, 0xEC,
+    0x4C, 0x9B, 0x30, 0x1B, 0x8D, 0xA8, 0x34, 0x94, 0x0A, 0x85, 0x26, 0x4E, 0xDE, 0x84, 0xE2, 0x3F,
+    0xEC, 0x33, 0x47, 0x45, 0xF8, 0x1D, 0x7B, 0x2F, 0xDA, 0x9F, 0xFD, 0x72, 0xED, 0x24, 0xBD, 0x28,
+    0x6D, 0x1C, 0x29, 0x81, 0x34, 0x96, 0x92, 0x6E, 0x49, 0x8A, 0xFE, 0x8D, 0xB7, 0xA3, 0x79, 0x39,
+    0xFE, 0x36, 0x2F, 0xAC, 0x80, 0x03, 0xBE, 0x04, 0x1C, 0xFD, 0x39, 0x34, 0xF3, 0x53, 0x87, 0x93,
+    0xB6, 0xC3, 0xF1, 0xCD, 0x3B, 0xDB, 0x0F, 0x9E, 0xF5, 0x19, 0x8A, 0x6B, 0x18, 0x05, 0x2D, 0x46,
+    0xBD, 0xA2, 0x51, 0xA1, 0xA9, 0x5B, 0x2B, 0x05, 0xB7, 0x18, 0xF5, 0x5F, 0x3E, 0x3E, 0xBE, 0xEE,
+    0xA4, 0xF5, 0x70, 0x3C, 0x77, 0xCD, 0xDD, 0xD3, 0xD5, 0xCD, 0x2E, 0xFA, 0x65, 0x9E, 0x5F, 0x5F,
+    0x02, 0xF8, 0x23, 0xA0, 0x5A, 0xC8, 0xB7, 0xC3, 0xC4, 0xC3, 0xA9, 0x9D, 0x80, 0x6E, 0x04, 0x6C,
+    0x00, 0xDC, 0x00, 0xF8, 0x1E, 0x10, 0xFB, 0xA9, 0xDC, 0x80, 0x6A, 0x3D, 0xAC, 0x9D, 0x3A, 0x01,
+    0xCD, 0x02, 0x98, 0x19, 0x68, 0x23, 0xD0, 0x4D, 0x80, 0x3D, 0xBB, 0x89, 0x0F, 0x80, 0x06, 0x40,
+    0x3D, 0x14, 0x02, 0x4A, 0x01, 0xD5, 0x76, 0xF6, 0xFD, 0x04, 0x98, 0xCB, 0x37, 0xB1, 0x11, 0xB0,
+    0x13, 0xE0, 0xC6, 0xB3, 0x9B, 0x04, 0x28, 0xD4, 0x1F, 0xBE, 0x7F, 0x7E, 0x93, 0x15, 0x30, 0x67,
+    0x37, 0x69, 0x47, 0xA0, 0x03, 0xF8, 0x1D, 0x80, 0xE7, 0x01, 0x38, 0xFA, 0x1E, 0xB4, 0x9A, 0xE8,
+    0x24, 0xDA, 0xB9, 0x8B, 0x26, 0x96, 0x6B, 0xBD, 0xE0, 0x6E, 0xAD, 0x5F, 0x32, 0x51, 0x57, 0xEF,
+    0xAF, 0xF6, 0xC1, 0xE2, 0x5F, 0xFD, 0x48, 0xDD, 0x07, 0xC9, 0xBF, 0xFD, 0x89, 0xBA, 0x8F, 0x36,
+    0xFF, 0x60, 0xD1, 0x1B, 0xF3, 0x5B, 0xF6, 0x83, 0x8D, 0xF6, 0x54, 0xC1, 0x6C, 0x36, 0x35, 0xBA,
+    0x2A, 0xE9, 0xDE, 0x2E, 0x47, 0xE7, 0x46, 0x4A, 0x48, 0x09, 0xA3, 0x15, 0x6E, 0xCC, 0x00, 0x14,
+    0xBE, 0xC7, 0xAE, 0x54, 0x9A, 0x31, 0x1A, 0x71, 0xEA, 0x8B, 0x47, 0x6B, 0x6E, 0x99, 0x1D, 0x41,
+    0x3D, 0xD5, 0xF9, 0x65, 0xA1, 0x9E, 0x7A, 0x85, 0x76, 0x06, 0x37, 0x52, 0xA8, 0xAF, 0x25, 0x75,
+    0xD2, 0xEA, 0xA5, 0x5F, 0x48, 0xFA, 0xB1, 0xA4, 0x9E, 0x1B, 0xA7, 0xD4, 0x52, 0xAC, 0x24, 0x21,
+    0x69, 0xB2, 0xB7, 0xDB, 0xF4, 0x9B, 0xB9, 0x3F, 0xED, 0x94, 0x9B, 0x5E, 0x6D, 0x50, 0xAA, 0xA7,
+    0x50, 0xA0, 0xD0, 0x48, 0xA9, 0x48, 0xAD, 0x48, 0xA3, 0x19, 0xA3, 0x05, 0xA3, 0x85, 0x46, 0xD2,
+    0x7D, 0x49, 0x51, 0x52, 0xB2, 0x92, 0x5A, 0x49, 0xA1, 0xF0, 0xA7, 0x54, 0xD2, 0x5C, 0x48, 0xC2,
+    0x9F, 0xF8, 0xF8, 0xDB, 0x94, 0x2B, 0x60, 0x07, 0x30, 0x13, 0xD4, 0x0B, 0xD4, 0x2B, 0xAD, 0x36,
+    0x1A, 0x6D, 0x54, 0xD2, 0x88, 0xB4, 0x42, 0xA9, 0x90, 0xC7, 0xA9, 0x49, 0xA6, 0xAF, 0x55, 0x49,
+    0xBA, 0xBB, 0xDF, 0x7D, 0xB1, 0x52, 0x6A, 0xA5, 0xC4, 0x0D, 0xBD, 0x77, 0x90, 0x66, 0x02, 0xBA,
+    0x08, 0xB5, 0x00, 0x45, 0xB0, 0x82, 0x46, 0x91, 0x62, 0x15, 0xD8, 0xD7, 0x23, 0x4D, 0x14, 0xC5,
+    0x6A, 0x66, 0xEC, 0xA0, 0xDE, 0x44, 0x33, 0x97, 0xDB, 0xEF, 0xEB, 0x6F, 0x9C, 0xA4, 0xB7, 0x25,
+    0x25, 0x2F, 0xE9, 0xEE, 0xC9, 0x9F, 0x29, 0x41, 0xBB, 0x40, 0xA9, 0x01, 0xBA, 0xB4, 0x57, 0xA4,
+    0x4B, 0xE7, 0x62, 0x53, 0x9A, 0xF7, 0x63, 0xE9, 0x7E, 0x7A, 0xF2, 0xBD, 0x2E, 0xE4, 0xA9, 0x68,
+    0xC7, 0xFD, 0xD0, 0xF7, 0xB0, 0xD2, 0x60, 0xF3, 0x38, 0xA6, 0x2F, 0x63, 0xD6, 0x3C, 0x9F, 0x2A,
+    0x7D, 0x89, 0x5A, 0x6D, 0xDF, 0xAA, 0x93, 0x36, 0x2B, 0xAD, 0x36, 0x37, 0x26, 0x3A, 0x69, 0x38,
+    0xD2, 0xDF, 0xC0, 0x91, 0x56, 0x8C, 0xD4, 0x1B, 0x69, 0x34, 0xD2, 0xDC, 0xAC, 0x79, 0x29, 0x14,
+    0xEB, 0xDE, 0x44, 0xFB, 0x60, 0xC3, 0x48, 0x4B, 0xBD, 0xF7, 0xC7, 0xEC, 0x53, 0xAD, 0x2E, 0xE1,
+    0xDE, 0xDD, 0x30, 0xA7, 0xEA, 0xAB, 0xCD, 0x4D, 0xE8, 0xF5, 0x84, 0x7B, 0xA4, 0x9F, 0x6A, 0x76,
+    0x59, 0xFE, 0x26, 0xBC, 0x12, 0xE5, 0xDE, 0x5B, 0x97, 0xC4, 0xC0, 0x89, 0xD6, 0xBC, 0x50, 0x9A,
+    0x94, 0xC7, 0xDA, 0x2C, 0xB9, 0x03, 0xBA, 0x19, 0xEC, 0x0C, 0x2E, 0x82, 0x8F, 0xB9, 0x4F, 0x35,
+    0xED, 0xC3, 0x3F, 0x52, 0x29, 0x50, 0x2B, 0xD0, 0x28, 0x60, 0x34, 0x60, 0x34, 0x70, 0x65, 0xEB,
+    0x69, 0x25, 0x2A, 0x29, 0xA1, 0xE0, 0x26, 0x13, 0x0B, 0x15, 0x1B, 0x26, 0xB6, 0xB1, 0x10, 0x1A,
+    0x5C, 0x6C, 0xA4, 0x95, 0x4E, 0x1A, 0x70, 0x8A, 0x38, 0x69, 0x6C, 0x97, 0x5A, 0x2F, 0x09, 0xB3,
+    0xB8, 0x11, 0xFF, 0x60, 0xA5, 0x49, 0x7E, 0x42, 0x0F, 0x34, 0xB8, 0x64, 0xF7, 0xF5, 0x30, 0x1B,
+    0x69, 0xA3, 0x93, 0x7A, 0xFE, 0xCD, 0xD6, 0x43, 0xB7, 0x82, 0xD3, 0x8C, 0x97, 0x7A, 0xFB, 0xBE,
+    0x8F, 0x36, 0x54, 0x9B, 0x19, 0xB1, 0x0F, 0x22, 0xE6, 0x71, 0xA2, 0x5C, 0x1D, 0xF8, 0x37, 0x02,
+    0xF6, 0xD1, 0x42, 0xBB, 0xE8, 0xAF, 0xFC, 0xD6, 0xED, 0xF2, 0x72, 0xEA, 0xA4, 0x05, 0xFF, 0xCB,
+    0x75, 0x17, 0x18, 0xFE, 0xEE, 0xF6, 0x5D, 0x1F, 0xBD, 0x34, 0xDB, 0x0C, 0x8B, 0x52, 0x71, 0x67,
+    0xEF, 0xA5, 0x76, 0xE9, 0x96, 0x2E, 0xD9, 0x64, 0x93, 0x5B, 0xDD, 0x7A, 0x51, 0x71, 0x3E, 0xF5,
+    0x1F, 0x1B, 0x6B, 0xE1, 0x62, 0xA3, 0x5E, 0xB3, 0xD1, 0xA0, 0xE5, 0x09, 0x4D, 0x7B, 0x74, 0x72,
+    0xDB, 0xA7, 0x46, 0xC1, 0x2D, 0x75, 0x16, 0xAA, 0xA5, 0x46, 0x9B, 0x6A, 0x85, 0x2F, 0x5F, 0xCB,
+    0x1F, 0xB8, 0x06, 0xD0, 0xF6, 0x40, 0xB3, 0x01, 0x47, 0x5A, 0xA0, 0x90, 0x46, 0xF0, 0x19, 0xB7,
+    0xAC, 0xD0, 0x4A, 0x3D, 0xB5, 0x34, 0x82, 0xD5, 0x0C, 0x48, 0x3D, 0x54, 0xD2, 0x69, 0x06, 0x36,
+    0x13, 0x5F, 0x91, 0x94, 0x47, 0x40, 0x3D, 0x85, 0xD7, 0x0A, 0x5C, 0xD1, 0x9C, 0xE1, 0x1C, 0xC0,
+    0x51, 0xFF, 0xDC, 0xEF, 0xDF, 0x89, 0xDD, 0xBE, 0x82, 0xBC, 0x94, 0x8E, 0xCF, 0xEA, 0x58, 0x5C,
+    0xBB, 0x92, 0x7B, 0x61, 0x71, 0x52, 0xF2, 0x9F, 0x9C, 0x7C, 0xE7, 0xB7, 0x00, 0x78, 0x0D, 0xA0,
+    0xD0, 0x00, 0x34, 0x7A, 0x0F, 0x68, 0xB5, 0x02, 0xB5, 0x34, 0x40, 0x21, 0x4D, 0x80, 0xD3, 0xCA,
+    0x5E, 0x41, 0x6A, 0x09, 0xA8, 0x95, 0xE0, 0x8A, 0x14, 0x73, 0xD5, 0x6E, 0x48, 0x7A, 0xBF, 0x96,
+    0x34, 0xD1, 0x4A, 0xB7, 0xC1, 0xE9, 0xF6, 0xE1, 0xAE, 0x47, 0x17, 0x21, 0xF2, 0x49, 0x4F, 0x21,
+    0x0D, 0x78, 0xA9, 0x77, 0x52, 0xAA, 0x35, 0xB8, 0xD8, 0xF5, 0xA8, 0x1F, 0xB3, 0x20, 0x77, 0x61,
+    0x17, 0xEB, 0xF6, 0x50, 0xF0, 0x21, 0xCF, 0xD9, 0x2C, 0x9F, 0x22, 0xA5, 0x12, 0x78, 0x81, 0x51,
+    0x00, 0x4D, 0x60, 0x36, 0x2E, 0x16, 0x46, 0x68, 0x6F, 0xF3, 0x24, 0x34, 0x3F, 0xBC, 0xCC, 0xBC,
+    0x57, 0x2C, 0x0B, 0x81, 0x00, 0x36, 0x41, 0xA5, 0x00, 0x5F, 0xBE, 0x9E, 0x47, 0xF3, 0x07, 0x00,
+    0x8D, 0xB2, 0xC2, 0x91, 0x06, 0xE8, 0x4E, 0x0B, 0x3F, 0x50, 0x6E, 0x60, 0x7B, 0xBA, 0x11, 0x2C,
+    0xAC, 0xC0, 0x37, 0x30, 0x53, 0xF3, 0x21, 0x6F, 0xE1, 0x50, 0x2A, 0x62, 0x99, 0x9A, 0x5B, 0xB1,
+    0x1A, 0xCD, 0xF4, 0xBB, 0x75, 0x30, 0xBD, 0x1D, 0x26, 0xC3, 0xD7, 0x8B, 0xAD, 0xEE, 0xBF, 0x5E,
+    0xC4, 0x7A, 0xF9, 0x97, 0xC5, 0x6C, 0x42, 0x1B, 0xAD, 0xA6, 0x1F, 0xE2, 0x82, 0xD7, 0x1B, 0x11,
+    0x0D, 0xFE, 0x8E, 0xFA, 0x4A, 0x3D, 0x36, 0xD2, 0x08, 0x7E, 0x0B, 0x8C, 0xFA, 0x2C, 0x85, 0xFE,
+    0xF2, 0x68, 0x06, 0x9B, 0xB1, 0xAC, 0x95, 0x14, 0xF2, 0x34, 0x00, 0xAE, 0x48, 0x2B, 0x50, 0xF8,
+    0xED, 0xDA, 0xE5, 0x76, 0xED, 0xD2, 0x31, 0xB7, 0x06, 0xF2, 0x3C, 0xF5, 0x02, 0xB0, 0x1A, 0x81,
+    0xF6, 0xD3, 0xAC, 0xE7, 0x04, 0x54, 0xAB, 0x9D, 0xA0, 0x54, 0x93, 0x00, 0x7D, 0x4B, 0x3D, 0xB8,
+    0xD1, 0x46, 0xB0, 0x31, 0x8B, 0x8A, 0x42, 0x03, 0xCD, 0x8A, 0x8D, 0x54, 0xFA, 0xEE, 0xAB, 0x2B,
+    0x85, 0xB4, 0x0F, 0x9D, 0x22, 0x56, 0xFB, 0x92, 0x95, 0x82, 0x91, 0xA4, 0xB9, 0xD6, 0x80, 0xD9,
+    0x4A, 0x05, 0x2A, 0x05, 0x45, 0xF0, 0xB3, 0x5B, 0xA0, 0x15, 0x4E, 0x5B, 0x8F, 0x93, 0x32, 0x40,
+    0xC1, 0x49, 0xEA, 0xDD, 0x54, 0x28, 0xB8, 0x09, 0x17, 0xDC, 0x84, 0x3D, 0x3B, 0xB9, 0xE0, 0xA6,
+    0xAF, 0x68, 0x70, 0x92, 0x70, 0xD2, 0x8A, 0x93, 0xF2, 0x65, 0x74, 0x13, 0x7E, 0x76, 0x13, 0x6D,
+    0x72, 0x13, 0x26, 0xE5, 0xD2, 0xFB, 0xC7, 0x3E, 0x39, 0x49, 0xE7, 0xA7, 0x25, 0x7F, 0x78, 0xFF,
+    0xDA, 0xF9, 0x4A, 0xBD, 0xA1, 0xEF, 0x81, 0x93, 0x02, 0x36, 0x2B, 0x5D, 0x69, 0xA8, 0x24, 0xCD,
+    0x78, 0xFD, 0xF4, 0x4E, 0x6F, 0x34, 0xEE, 0xC0, 0x17, 0x9B, 0x80, 0x5A, 0x03, 0xE0, 0x67, 0xC0,
+    0x64, 0xF8, 0x12, 0x9F, 0x59, 0x5C, 0x00, 0xA3, 0x11, 0x90, 0xFE, 0xF2, 0xB9, 0x3F, 0xAF, 0x25,
+    0xA9, 0xB7, 0x92, 0xE6, 0x52, 0xCA, 0x82, 0x5E, 0x0B, 0x56, 0xD2, 0x80, 0xA4, 0x25, 0xCF, 0x28,
+    0x27, 0xDD, 0xA6, 0x96, 0xF4, 0x1E, 0x4E, 0xD2, 0x54, 0x4B, 0x52, 0x70, 0x92, 0x54, 0x8B, 0x5A,
+    0xB3, 0x8B, 0xD4, 0x7A, 0x20, 0x30, 0xC9, 0x45, 0x70, 0xEF, 0x0A, 0xAA, 0xCD, 0x45, 0xE8, 0x7E,
+    0x29, 0x28, 0x75, 0x56, 0xAC, 0xE4, 0x22, 0xD8, 0x5F, 0x0A, 0xEA, 0xCD, 0x45, 0x0A, 0x7D, 0x20,
+    0xBE, 0xA2, 0xD5, 0x49, 0xD2, 0x03, 0x1D, 0xBA, 0x45, 0x2F, 0xEB, 0xD0, 0x2F, 0xA9, 0xD6, 0x3E,
+    0x0C, 0x7F, 0x0B, 0x47, 0x27, 0x77, 0x34, 0x3A, 0x49, 0xE5, 0x01, 0xCA, 0x4F, 0xDD, 0x27, 0xC7,
+    0x3D, 0x3E, 0xEC, 0x40, 0xA9, 0x49, 0xBB, 0xE2, 0xC5, 0xFF, 0xD5, 0xEF, 0x0D, 0x95, 0x24, 0x8C,
+    0x94, 0xB0, 0x52, 0x44, 0x52, 0xA8, 0xD4, 0xEF, 0xF8, 0xC9, 0xC6, 0x1D, 0x66, 0x55, 0xFA, 0xEE,
+    0xF1, 0x75, 0x73, 0x30, 0x18, 0x83, 0x24, 0xBD, 0x24, 0x69, 0x33, 0x67, 0xE3, 0xF3, 0x1B, 0x27,
+    0x5E, 0x46, 0x3A, 0x3F, 0xD6, 0xEB, 0x59, 0x31, 0xCD, 0xFB, 0x11, 0xA1, 0xCD, 0x06, 0xE8, 0xDC,
+    0x5D, 0x3C, 0x62, 0xAE, 0x8C, 0x9D, 0x9F, 0x71, 0x2C, 0x97, 0x0F, 0xB7, 0x00, 0x7C, 0xF5, 0x87,
+    0x7F, 0xDA, 0xEF, 0x56, 0x25, 0x4E, 0x52, 0xA0, 0x95, 0xB4, 0x52, 0x49, 0x19, 0x8B, 0xDC, 0xE6,
+    0x0F, 0x31, 0x1A, 0x38, 0x0C, 0x3F, 0x76, 0xBD, 0xB0, 0x86, 0xEC, 0x92, 0x2F, 0x86, 0xFD, 0xE2,
+    0xAB, 0xD7, 0xA8, 0x35, 0x14, 0xD2, 0x9B, 0x76, 0xC1, 0x48, 0x2F, 0x29, 0x20, 0x2D, 0x36, 0x71,
+    0x24, 0xDD, 0xD2, 0x04, 0x3E, 0x75, 0xEA, 0x31, 0xA9, 0x90, 0xAE, 0x1D, 0xED, 0x8B, 0x23, 0xE1,
+    0x24, 0x29, 0x14, 0xF9, 0x22, 0x0F, 0x37, 0x8D, 0xA4, 0x11, 0x8E, 0xF4, 0x49, 0x4F, 0x37, 0x83,
+    0xEE, 0xA9, 0xC7, 0xA4, 0xBD, 0x38, 0x60, 0x52, 0xB7, 0xEC, 0xC5, 0x36, 0xD9, 0x85, 0x42, 0xF7,
+    0x9F, 0x28, 0xAE, 0x36, 0x51, 0xE8, 0xA1, 0xC2, 0x79, 0xF1, 0xAF, 0x8E, 0x6F, 0xAC, 0x56, 0x92,
+    0x1E, 0x4A, 0x19, 0x85, 0x48, 0x8F, 0x9E, 0x2A, 0x26, 0x4A, 0x3D, 0x52, 0xC0, 0xCA, 0x26, 0x2A,
+    0xFD, 0x5C, 0x23, 0x56, 0x6E, 0xA5, 0x52, 0xB4, 0x17, 0xFE, 0xBA, 0x27, 0xFF, 0xE6, 0x6E, 0xEE,
+    0xE6, 0x6E, 0xB1, 0xF9, 0x2F, 0xE5, 0x3F, 0xC0, 0x5F, 0x94, 0xBE, 0x66, 0x3D, 0x14, 0x12, 0x14,
+    0x0A, 0xD0, 0x1E, 0x0A, 0xDD, 0x01, 0x79, 0xD9, 0x05, 0x2A, 0xF5, 0x79, 0xE4, 0x2A, 0xED, 0xB3,
+    0xA7, 0x12, 0x19, 0x90, 0xD4, 0xDA, 0x6F, 0xDA, 0x6C, 0xBB, 0x76, 0xDB, 0x6F, 0xDA, 0xDE, 0x76,
+    0xA9, 0x90, 0x14, 0x3A, 0x69, 0xA9, 0x24, 0x61, 0xA5, 0xB1, 0x92, 0x16, 0xBE, 0xE2, 0xF7, 0xD5,
+    0x5E, 0x0A, 0x3F, 0x63, 0xA3, 0x11, 0x95, 0x4A, 0x8D, 0xD8, 0xE8, 0x16, 0xAA, 0xCD, 0x08, 0xEC,
+    0x4F, 0x34, 0x52, 0x6F, 0x36, 0x81, 0xFB, 0xB1, 0x7A, 0x9A, 0x55, 0x13, 0x78, 0xA5, 0x83, 0xC4,
+    0x97, 0x22, 0x19, 0x92, 0x23, 0x0D, 0x60, 0x34, 0x1F, 0x74, 0x75, 0x2B, 0xF5, 0x14, 0xD2, 0x06,
+    0x9D, 0xB4, 0x50, 0xEA, 0x8E, 0x22, 0x76, 0xF1, 0x0A, 0x95, 0x6E, 0x49, 0xD8, 0xC5, 0x28, 0x55,
+    0x1A, 0x9C, 0x66, 0xBB, 0x14, 0xD2, 0x68, 0xD2, 0xBE, 0x22, 0xCE, 0x0B, 0xCB, 0x6E, 0xCF, 0xB4,
+    0xCB, 0x05, 0x3D, 0x74, 0x41, 0x21, 0x0D, 0x17, 0x3A, 0xA9, 0x9B, 0x2F, 0x75, 0xD2, 0x59, 0xE1,
+    0xE4, 0xCF, 0x56, 0xBB, 0x8F, 0xF0, 0x79, 0xC1, 0x49, 0x1A, 0x5B, 0x81, 0x51, 0xA1, 0x19, 0x14,
+    0x5B, 0x0D, 0x74, 0x7A, 0x51, 0x89, 0x4A, 0x73, 0xA7, 0x11, 0xA7, 0x17, 0x25, 0x1A, 0xCD, 0x9D,
+    0x66, 0xA4, 0x17, 0xA5, 0xA1, 0xD3, 0xDC, 0x29, 0x55, 0xD2, 0x4D, 0x69, 0x72, 0x5A, 0xAC, 0xD4,
+    0x48, 0xB7, 0xE4, 0x66, 0x7D, 0xB8, 0xD8, 0x9F, 0xEB, 0x8D, 0x4D, 0xB7, 0xD4, 0x49, 0x77, 0x16,
+    0xFB, 0xB1, 0xF4, 0x91, 0xEE, 0xEB, 0xAA, 0x64, 0x93, 0x9D, 0xBD, 0x1E, 0xE9, 0xBE, 0xBE, 0xAD,
+    0xD5, 0x26, 0xBB, 0x58, 0xDD, 0xD7, 0x7D, 0xDD, 0xD4, 0x62, 0x93, 0x5D, 0x8C, 0x5E, 0xD6, 0x7D,
+    0x05, 0x45, 0x97, 0x6C, 0x6A, 0x54, 0xEB, 0xBE, 0x82, 0x1D, 0x7D, 0x72, 0x09, 0x9A, 0x7D, 0x55,
+    0x8D, 0xDF, 0x7C, 0x93, 0x6A, 0xAD, 0x35, 0xE0, 0x46, 0x9F, 0xA8, 0xD7, 0x46, 0x23, 0x2E, 0x78,
+    0xD1, 0x24, 0xA3, 0x19, 0x1F, 0xA4, 0xD0, 0x24, 0xA3, 0x15, 0x05, 0x29, 0x9A, 0x64, 0xA4, 0x5E,
+    0x41, 0x1F, 0x26, 0x93, 0xDA, 0xD5, 0x07, 0xDD, 0xD5, 0xA3, 0xCD, 0xA4, 0x76, 0xB3, 0x51, 0x37,
+    0xF5, 0x13, 0xBD, 0xB1, 0x74, 0x9B, 0xD9, 0x74, 0x53, 0x93, 0xD7, 0xD2, 0x6D, 0x95, 0x74, 0x4B,
+    0x53, 0xA7, 0xD9, 0xAA, 0x90, 0x5E, 0x52, 0x34, 0x9A, 0xAD, 0x70, 0x7A, 0x49, 0xB1, 0x52, 0xB4,
+    0xA2, 0x13, 0x64, 0x4F, 0x45, 0xB1, 0xDB, 0x23, 0x52, 0xA4, 0x94, 0x24, 0x4A, 0xCD, 0xB5, 0xA6,
+    0x42, 0x13, 0xDD, 0x8A, 0x8F, 0x94, 0xD9, 0x2B, 0x66, 0xE7, 0x2E, 0x41, 0xB3, 0x99, 0x15, 0x0A,
+    0xDD, 0xCF, 0x93, 0x36, 0x8F, 0x6E, 0x9E, 0xBC, 0xAF, 0x26, 0x40, 0xEF, 0x0A, 0xB0, 0xB3, 0x02,
+    0x98, 0x35, 0xFF, 0xC3, 0x08, 0x4A, 0xDD, 0xD7, 0x44, 0xA1, 0x28, 0x7D, 0xE7, 0x0F, 0x76, 0xE7,
+    0xD3, 0x56, 0x49, 0x92, 0x7A, 0x7F, 0xAE, 0x47, 0x47, 0xB2, 0x87, 0x6D, 0x17, 0x0E, 0x57, 0xF4,
+    0xC9, 0x01, 0xC7, 0xFC, 0xC6, 0xC9, 0x0F, 0xC0, 0xEE, 0x8A, 0x64, 0xAC, 0x24, 0x8D, 0x66, 0x2E,
+    0x14, 0xEC, 0x88, 0x7A, 0xF5, 0xE5, 0x56, 0xAF, 0x34, 0xA9, 0x9D, 0xB1, 0xD1, 0xBD, 0xFF, 0x07,
+    0xBA, 0x2B, 0x69, 0x6B, 0x0E, 0xDE, 0xBB, 0xC1, 0x4B, 0x4B, 0x29, 0xA9, 0x6F, 0xA4, 0xDB, 0x59,
+    0xAC, 0x69, 0xDA, 0xC5, 0x9C, 0xD1, 0x41, 0xED, 0x29, 0x5E, 0x7C, 0xCB, 0xA5, 0x0B, 0xC0, 0xA9,
+    0xD0, 0xB6, 0x1B, 0x17, 0x03, 0x34, 0x19, 0x90, 0xF8, 0x5D, 0x8E, 0x8D, 0xAD, 0x06, 0xEC, 0x42,
+    0xA3, 0xBE, 0x54, 0xA0, 0x11, 0x66, 0x05, 0x93, 0x70, 0x11, 0xBA, 0xB9, 0x54, 0x0F, 0x6E, 0xCA,
+    0xFD, 0x16, 0xF6, 0x85, 0x9E, 0x3B, 0x6E, 0x5F, 0xFA, 0xFB, 0xFA, 0xD8, 0x85, 0x81, 0xA6, 0x62,
+    0x6C, 0x97, 0x52, 0xC1, 0x7C, 0xAC, 0xB1, 0xD6, 0xFB, 0x2E, 0x2B, 0x1D, 0x29, 0x65, 0xC4, 0x31,
+    0x62, 0x25, 0x29, 0x0B, 0xF4, 0x78, 0x90, 0xEB, 0xBB, 0x96, 0xA5, 0xC9, 0x19, 0xB5, 0xD4, 0x5F,
+    0xCA, 0x72, 0x27, 0x9E, 0xD0, 0x68, 0xEB, 0xB3, 0x7B, 0xD0, 0x48, 0x2B, 0xE6, 0xE3, 0xDF, 0x13,
+    0x26, 0xE2, 0x07, 0x13, 0xB1, 0xE1, 0xFC, 0xD4, 0x46, 0x5C, 0x68, 0x23, 0x0A, 0xED, 0x27, 0x77,
+    0xD4, 0xB7, 0x92, 0xE8, 0xF6, 0x4A, 0xE4, 0x9A, 0xD0, 0xE9, 0x65, 0xF5, 0x36, 0x15, 0x0A, 0x36,
+    0x91, 0x4F, 0x93, 0x4D, 0x28, 0xDA, 0x75, 0x3F, 0x2D, 0x76, 0x45, 0xC9, 0x6E, 0x28, 0x7D, 0xED,
+    0x07, 0x9C, 0x7C, 0xFF, 0xE0, 0x09, 0x95, 0x6E, 0xEF, 0xE8, 0xB2, 0x55, 0x76, 0xFA, 0x68, 0xA2,
+    0xD1, 0x78, 0xE5, 0xA0, 0x73, 0x76, 0x7F, 0x2A, 0xEC, 0xB2, 0x8F, 0x6E, 0xEB, 0x01, 0xA7, 0x53,
+    0xC0, 0x4B, 0x23, 0x9C, 0xB5, 0x7E, 0xDE, 0xC1, 0x38, 0xDC, 0x50, 0xE4, 0xB0, 0xCC, 0x1A, 0xF5,
+    0xDF, 0x80, 0x6E, 0x2D, 0x35, 0x15, 0xBB, 0x2F, 0xF7, 0xAE, 0x24, 0xAD, 0x79, 0xA2, 0x35, 0x19,
+    0x8F, 0xDC, 0xD0, 0xE9, 0x61, 0x88, 0x9D, 0x24, 0x3D, 0xD6, 0x19, 0x72, 0x50, 0x7B, 0x8E, 0x1F,
+    0xE2, 0xE5, 0x1A, 0x25, 0x0E, 0x0A, 0xFF, 0xE0, 0xE8, 0x85, 0x2C, 0xE7, 0xB3, 0x00, 0xCF, 0xE2,
+    0xFE, 0xB3, 0xDE, 0x6E, 0xD4, 0x93, 0xCD, 0xBC, 0x1D, 0x63, 0x95, 0x1A, 0x9F, 0xF1, 0xB6, 0x4B,
+    0x54, 0x7A, 0xA8, 0x80, 0x5D, 0xED, 0x13, 0xC5, 0xFB, 0x0A, 0xD8, 0xF4, 0x74, 0x71, 0xC0, 0x26,
+    0xBB, 0x50, 0xEA, 0xBE, 0x06, 0xBA, 0x67, 0x17, 0x97, 0x2E, 0x51, 0xE9, 0xA6, 0x46, 0xDC, 0xD2,
+    0xE9, 0xA7, 0x5E, 0x2F, 0x68, 0x37, 0x42, 0xB3, 0x87, 0x44, 0xB1, 0xD6, 0x6E, 0xC6, 0x6A, 0xC0,
+    0x49, 0xBB, 0xD7, 0x77, 0x5F, 0xCB, 0x2B, 0x14, 0xBA, 0xA7, 0x00, 0xDA, 0xF1, 0xB2, 0xD9, 0xA0,
+    0x4B, 0xA5, 0x02, 0x66, 0xC3, 0xCD, 0x34, 0xC2, 0x88, 0x4A, 0x61, 0x77, 0xFB, 0xB9, 0x05, 0x45,
+    0x8C, 0x70, 0x89, 0x52, 0x63, 0xB7, 0x81, 0x5B, 0x8C, 0x7A, 0x8C, 0x1A, 0x05, 0x2A, 0x3D, 0xD2,
+    0x04, 0x6E, 0xD3, 0x4C, 0x06, 0x57, 0x54, 0xD2, 0x96, 0x87, 0xB9, 0x07, 0xA3, 0x0C, 0xAA, 0x34,
+    0xB1, 0x1B, 0x8C, 0xB4, 0x4A, 0x40, 0x95, 0x97, 0xA4, 0x57, 0x0F, 0x5F, 0xFB, 0x3E, 0x40, 0x79,
+    0xF2, 0xBA, 0xB2, 0xBB, 0xE4, 0x51, 0x96, 0xB4, 0x6E, 0xF6, 0x33, 0x40, 0x97, 0xDA, 0x0D, 0xC0,
+    0xA8, 0xDA, 0x87, 0x71, 0x50, 0x1E, 0x8F, 0xB1, 0x5B, 0x31, 0x11, 0x1F, 0x1B, 0x0D, 0x66, 0xC3,
+    0xA6, 0x42, 0xB1, 0x56, 0x30, 0x1B, 0x36, 0x55, 0x9A, 0x6B, 0xF5, 0x46, 0x85, 0x54, 0x2A, 0x94,
+    0x1A, 0xA5, 0x51, 0x11, 0xB7, 0x38, 0x25, 0xBB, 0xD0, 0xCA, 0x4A, 0xAF, 0xAE, 0x54, 0xFA, 0x50,
+    0xFA, 0x54, 0x20, 0xE9, 0x8E, 0x14, 0xE8, 0xA4, 0x77, 0xA5, 0x89, 0x5A, 0x8A, 0xD2, 0x0C, 0xD2,
+    0xD2, 0x29, 0x81, 0x55, 0xAA, 0x24, 0x30, 0xDA, 0x90, 0x06, 0x4A, 0xA9, 0x6F, 0x35, 0x82, 0x53,
+    0xA8, 0xB2, 0xE6, 0x9D, 0xD0, 0xC1, 0x53, 0x91, 0x6A, 0x41, 0x17, 0x4B, 0x0D, 0xB8, 0x09, 0x8D,
+    0x28, 0xE0, 0x63, 0xA5, 0x1E, 0xBB, 0x34, 0x82, 0x76, 0x6D, 0x13, 0x34, 0x72, 0xCB, 0x05, 0x3A,
+    0x60, 0x3C, 0x68, 0x6E, 0x5C, 0xB6, 0x7C, 0x76, 0xB1, 0x05, 0x20, 0x05, 0x28, 0xA5, 0x09, 0x6A,
+    0x9D, 0xF7, 0xB6, 0x95, 0xDB, 0xC0, 0xAD, 0x9D, 0x7A, 0xB4, 0x18, 0x85, 0x4A, 0xB1, 0xD1, 0xD4,
+    0x68, 0xAC, 0x34, 0x1B, 0x85, 0x42, 0xC9, 0xAA, 0x47, 0x5B, 0xD6, 0x02, 0x7E, 0xA2, 0x50, 0xD0,
+    0x88, 0x59, 0x4B, 0x05, 0x5C, 0xAC, 0xD4, 0x57, 0x1A, 0x1A, 0xD1, 0x26, 0xDA, 0x15, 0x4D, 0xD8,
+    0x54, 0x0B, 0xDC, 0x6C, 0x17, 0xD0, 0x63, 0x05, 0x0A, 0xFD, 0xF5, 0x06, 0x95, 0x34, 0x43, 0xA3,
+    0x2C, 0x61, 0x57, 0xA0, 0xCB, 0x26, 0x87, 0x7A, 0xC0, 0x27, 0xA0, 0xD0, 0x74, 0x66, 0x7E, 0x74,
+    0x79, 0x78, 0x97, 0x33, 0x6C, 0x6A, 0x14, 0xC8, 0x9E, 0x2F, 0x50, 0xDA, 0x79, 0x9F, 0xCC, 0xF6,
+    0x64, 0x8E, 0x26, 0x64, 0xC1, 0xE8, 0x25, 0x25, 0xBE, 0x79, 0xE2, 0x35, 0x42, 0xA5, 0x15, 0xB0,
+    0x9A, 0xA0, 0x94, 0x0E, 0xCF, 0x2C, 0xA5, 0x1E, 0x3A, 0xCD, 0x50, 0x66, 0x1B, 0x57, 0x09, 0xCA,
+    0xDD, 0xCE, 0x4C, 0x87, 0xAE, 0xEC, 0x32, 0x0D, 0xA0, 0x8F, 0x8F, 0xAF, 0x99, 0x33, 0x0B, 0x22,
+    0x8B, 0x91, 0x6C, 0x52, 0x5C, 0x94, 0x11, 0xF3, 0xD1, 0xC9, 0xF7, 0x1B, 0xA5, 0x9C, 0xCC, 0x82,
+    0x59, 0x30, 0xF3, 0xE5, 0x14, 0xCF, 0x53, 0x7B, 0x39, 0x75, 0x39, 0x4D, 0xE7, 0xC9, 0x4E, 0xD8,
+    0xF1, 0xA9, 0x14, 0xF6, 0xE4, 0x46, 0x9C, 0xE2, 0xC5, 0x94, 0xDD, 0xB5, 0xFF, 0x0A, 0xFE, 0x35,
+    0xFC, 0x2E, 0x7C, 0x1D, 0xBE, 0x01, 0x0E, 0x5C, 0x8F, 0x0D, 0x74, 0x81, 0x76, 0xC2, 0x44, 0xCC,
+    0x4C, 0xB3, 0x50, 0x1D, 0x78, 0x87, 0x42, 0xA0, 0x01, 0x1F, 0x70, 0x01, 0x3B, 0x61, 0x23, 0xED,
+    0x8C, 0x59, 0x30, 0x89, 0x26, 0x51, 0x2F, 0x54, 0x91, 0x32, 0x52, 0x8C, 0x10, 0xA0, 0xFF, 0xE6,
+    0xC9, 0xE0, 0x34, 0xE6, 0x84, 0x1D, 0xB1, 0xD3, 0xA5, 0x4A, 0xE7, 0x66, 0x3C, 0xD1, 0xB6, 0x8B,
+    0xCD, 0x7E, 0xB2, 0x47, 0x16, 0xCC, 0x42, 0x73, 0x96, 0xF2, 0x43, 0xCF, 0x53, 0xAB, 0x3D, 0x19,
+    0x25, 0xA3, 0x73, 0x85, 0xBC, 0xEE, 0xAE, 0x11, 0x97, 0xC0, 0x29, 0xE0, 0xFE, 0x3A, 0xE1, 0x07,
+    0x1F, 0x7C, 0x9F, 0x69, 0xA9, 0xAC, 0x30, 0x7F, 0x2E, 0x49, 0xE9, 0x1C, 0xFE, 0x0F, 0xC0, 0x71,
+    0x9F, 0xF9, 0x92, 0x4A, 0x3D, 0x9A, 0x2E, 0xB8, 0x3E, 0xAF, 0x2C, 0xD0, 0x49, 0x43, 0x2B, 0x4D,
+    0xE6, 0xD4, 0xA7, 0x7A, 0xAE, 0x54, 0x2D, 0xB8, 0xB0, 0x62, 0xA2, 0xA5, 0x5C, 0xDB, 0x01, 0xFF,
+    0xCA, 0x44, 0xFB, 0x93, 0x99, 0x7A, 0xF9, 0x6F, 0x94, 0x6A, 0xDF, 0xFF, 0x83, 0xEC, 0x13, 0xF6,
+    0xFB, 0x34, 0x7C, 0x41, 0xF2, 0x63, 0xB3, 0xF5, 0xE7, 0x7E, 0x9C, 0x4B, 0x0E, 0x9D, 0xEA, 0x72,
+    0xE1, 0xDE, 0x4A, 0xB5, 0x6A, 0xC5, 0x4A, 0x73, 0x95, 0x41, 0xFD, 0x1F, 0x6F, 0xA5, 0xC6, 0x3A,
+    0x76, 0x09, 0xFB, 0xA2, 0x86, 0x72, 0x69, 0x67, 0xBA, 0xBB, 0xEA, 0xAB, 0xD4, 0xCE, 0xB8, 0xBB,
+    0x1A, 0xDB, 0x64, 0x24, 0x0D, 0xCA, 0x0E, 0xF4, 0xED, 0x80, 0x87, 0x46, 0xF8, 0x8F, 0x07, 0x43,
+    0xFF, 0x94, 0x56, 0x4B, 0x21, 0x4D, 0x46, 0x1A, 0xFC, 0x48, 0xB5, 0x66, 0x7B, 0xD2, 0x05, 0x4A,
+    0x65, 0x83, 0xB6, 0xDD, 0xFD, 0x9E, 0x9A, 0xFE, 0x6B, 0x99, 0x9F, 0x3D, 0x97, 0x52, 0xC4, 0x9F,
+    0xB2, 0xB3, 0x0F, 0xD5, 0x67, 0x54, 0x39, 0x17, 0xDA, 0xF7, 0x5C, 0x30, 0x52, 0xAA, 0x76, 0xF3,
+    0x76, 0x69, 0xE7, 0x4E, 0xB7, 0x56, 0xFC, 0x62, 0x43, 0xA5, 0x6F, 0xCF, 0xD8, 0xC5, 0xF7, 0xA5,
+    0x5E, 0x9E, 0xE9, 0x66, 0xD7, 0x57, 0x7A, 0x29, 0xE1, 0x66, 0xFB, 0xC9, 0x1D, 0xDD, 0x94, 0xB4,
+    0x98, 0x0B, 0x78, 0xCC, 0x0F, 0xA5, 0x7A, 0xB8, 0x72, 0x9A, 0x97, 0xA5, 0x95, 0x7A, 0x3B, 0xB7,
+    0xB1, 0x8D, 0xAC, 0xE6, 0x93, 0x13, 0xDD, 0xDF, 0x15, 0xF2, 0xEA, 0x24, 0xDD, 0x38, 0xBD, 0x4E,
+    0x9D, 0x76, 0x16, 0xC3, 0xAE, 0x34, 0xCD, 0xFE, 0xF8, 0xD8, 0x66, 0x2E, 0x61, 0xE3, 0x48, 0xEF,
+    0xC1, 0x95, 0x84, 0x4F, 0x85, 0x52, 0xA5, 0x54, 0x25, 0x72, 0xF2, 0x5A, 0xCF, 0x52, 0xBD, 0x52,
+    0xAD, 0xD4, 0x67, 0x69, 0x3B, 0x4F, 0xCD, 0x59, 0x12, 0x74, 0xEF, 0xF9, 0xC1, 0xC9, 0x4F, 0x4E,
+    0x5A, 0xEC, 0xA7, 0x5A, 0xBB, 0xD0, 0xE9, 0xEA, 0x58, 0xE9, 0xDD, 0x88, 0xFB, 0x78, 0xC1, 0xAC,
+    0x3F, 0xA4, 0xD2, 0x8D, 0x01, 0x3D, 0x88, 0xB8, 0xC7, 0x1B, 0xD9, 0xA1, 0x7B, 0xA9, 0x52, 0x85,
+    0x24, 0x8E, 0xFE, 0xC6, 0x0D, 0x99, 0xD8, 0x31, 0xF3, 0x6F, 0x62, 0x52, 0x25, 0xBF, 0x15, 0xBB,
+    0x98, 0x1A, 0xAC, 0x34, 0x3C, 0xE7, 0xB7, 0xDD, 0x81, 0xA5, 0xFE, 0x62, 0x21, 0xEE, 0x4E, 0x71,
+    0x13, 0x77, 0xEA, 0xA7, 0xFD, 0x48, 0xB7, 0x0B, 0xE5, 0x29, 0xBA, 0x96, 0xDA, 0x14, 0xBB, 0x84,
+    0x4A, 0x51, 0xCF, 0x36, 0x62, 0x5F, 0x12, 0xD5, 0x62, 0x23, 0xF6, 0x96, 0xA8, 0x17, 0x1B, 0x71,
+    0xF7, 0x45, 0x93, 0x6C, 0x44, 0x0F, 0x94, 0x5D, 0x29, 0x7A, 0xA0, 0xBE, 0x4D, 0x7E, 0x2E, 0x15,
+    0x9E, 0xBB, 0xE6, 0xEE, 0xE9, 0x95, 0x0B, 0xE4, 0x16, 0x54, 0xC9, 0x44, 0x1B, 0x74, 0x21, 0x73,
+    0x77, 0x55, 0xA7, 0x76, 0xF6, 0xFF, 0x4F, 0x03, 0x66, 0xC4, 0x0E, 0x85, 0x68, 0x52, 0x76, 0x88,
+    0x5C, 0x04, 0xC7, 0x1B, 0xF5, 0x42, 0x3B, 0xE1, 0xFA, 0x72, 0xA5, 0x99, 0xE9, 0x46, 0x3C, 0x65,
+    0xA2, 0x89, 0x74, 0x01, 0x4F, 0x95, 0x30, 0x11, 0x1B, 0xD8, 0xA8, 0x16, 0xBA, 0xE9, 0x79, 0xF5,
+    0x5A, 0x2B, 0x45, 0xA3, 0xE0, 0x56, 0xFE, 0xB0, 0xDF, 0x5B, 0xCD, 0x13, 0xAD, 0x46, 0x3B, 0xA5,
+    0x55, 0x6C, 0x3B, 0xC1, 0x56, 0x6E, 0xCF, 0x5D, 0xA7, 0x7B, 0x47, 0x7D, 0xB9, 0xBA, 0x89, 0xEE,
+    0xC3, 0x44, 0x25, 0x81, 0x55, 0xA0, 0xD2, 0x9C, 0x55, 0x49, 0xA5, 0x15, 0xAC, 0x96, 0x8C, 0x19,
+    0xEC, 0x87, 0x1A, 0xEA, 0xD5, 0x09, 0xF7, 0x8E, 0x52, 0xBD, 0x19, 0x45, 0x3F, 0x59, 0x8D, 0x6D,
+    0xAC, 0x97, 0x62, 0xC3, 0xF7, 0xDD, 0xD8, 0xCC, 0xD5, 0x7A, 0x16, 0xE7, 0xF0, 0x64, 0xC0, 0x43,
+    0xBD, 0x17, 0xF4, 0xB6, 0x7E, 0xA1, 0xCD, 0x9F, 0xF1, 0xCC, 0xCD, 0xE2, 0x6F, 0x37, 0x33, 0x8D,
+    0xB4, 0x58, 0x61, 0xA4, 0x4D, 0x0A, 0x46, 0x3F, 0xD3, 0xE6, 0xA3, 0xD9, 0x50, 0x34, 0xB3, 0x49,
+    0xF8, 0xA9, 0x5E, 0xDA, 0x05, 0x37, 0xD6, 0x69, 0xCF, 0xBA, 0x19, 0x1F, 0xEA, 0xD4, 0xCD, 0x28,
+    0xD4, 0xC9, 0xCE, 0x28, 0xE4, 0x21, 0x1A, 0x9A, 0x64, 0x63, 0xA1, 0xC1, 0x24, 0x1B, 0x4B, 0xF5,
+    0x26, 0xD9, 0x58, 0xA9, 0x37, 0xAB, 0x8B, 0x95, 0x30, 0xAB, 0x9B, 0x2A, 0xED, 0x48, 0xB8, 0x7E,
+    0xEC, 0xDF, 0x2C, 0x76, 0x17, 0x61, 0xEC, 0xA4, 0xB5, 0xD9, 0xF0, 0xF7, 0x84, 0x89, 0x1A, 0xAA,
+    0x64, 0x47, 0x74, 0x75, 0xC6, 0x3E, 0xDC, 0x30, 0xB3, 0x86, 0x6A, 0xB3, 0x3B, 0x63, 0xF2, 0x81,
+    0x68, 0x4F, 0x15, 0x1A, 0xB9, 0x58, 0xEA, 0xC3, 0x84, 0x8F, 0x5C, 0xD9, 0x99, 0x06, 0x27, 0xF5,
+    0x76, 0xF3, 0xB1, 0x9B, 0xEB, 0xCD, 0x2C, 0xB8, 0xFB, 0x09, 0xF3, 0xB1, 0xA8, 0x36, 0x17, 0xF0,
+    0x77, 0x22, 0xDD, 0x07, 0x69, 0xA7, 0x5F, 0x6C, 0xAC, 0xCE, 0x78, 0xBC, 0xC9, 0x66, 0xAC, 0x38,
+    0xE3, 0x34, 0x53, 0x68, 0x04, 0xBE, 0xDA, 0xD3, 0x7D, 0x90, 0xEF, 0x38, 0x17, 0x19, 0x4B, 0x4E,
+    0x66, 0x32, 0xC2, 0x04, 0xBB, 0xD0, 0x0D, 0x1A, 0xF9, 0x61, 0xA5, 0xBE, 0x48, 0x66, 0xA5, 0x8E,
+    0xF9, 0xAD, 0xB9, 0xD8, 0xAA, 0x43, 0xB8, 0x45, 0xF0, 0xD2, 0x5A, 0x4A, 0x8A, 0x66, 0xD3, 0x86,
+    0x8D, 0xFF, 0x73, 0x28, 0x34, 0x40, 0xB3, 0x92, 0x1D, 0x02, 0xBB, 0x87, 0xED, 0x00, 0xAB, 0xFD,
+    0x13, 0x33, 0xB1, 0x9B, 0xDD, 0x50, 0x48, 0x7E, 0xA8, 0x25, 0xF5, 0xE6, 0xD4, 0xAB, 0xEF, 0x82,
+    0x51, 0x6F, 0xFB, 0x46, 0x38, 0xAA, 0xFD, 0xE4, 0xCF, 0x4E, 0x8E, 0x6A, 0xC3, 0x0D, 0xCD, 0x86,
+    0xDD, 0xB2, 0x4B, 0x77, 0xCB, 0x76, 0x51, 0x23, 0xAD, 0x94, 0xD2, 0x5A, 0xD0, 0x9D, 0xAE, 0x37,
+    0xA0, 0x90, 0x76, 0x33, 0xB0, 0xD0, 0xB6, 0x47, 0x08, 0x94, 0xBA, 0x0D, 0xE5, 0xCE, 0xD2, 0x99,
+    0x8F, 0x7D, 0x25, 0x05, 0x69, 0xB6, 0x5A, 0x8D, 0x5E, 0xA8, 0x74, 0xC6, 0xDA, 0xCF, 0xD4, 0x2B,
+    0x85, 0x7A, 0xFC, 0x48, 0xB7, 0x60, 0x36, 0x2A, 0x05, 0x14, 0xCF, 0x6D, 0xCC, 0x46, 0xEF, 0xD1,
+    0x4A, 0xBD, 0xF9, 0xC4, 0x87, 0x6A, 0xE6, 0x1A, 0x69, 0xA7, 0x11, 0x9B, 0xAD, 0xCF, 0x88, 0xAE,
+    0xC9, 0x9E, 0x97, 0x09, 0xDA, 0x44, 0x5F, 0x6A, 0xF8, 0xDF, 0xF8, 0xC9, 0x7D, 0xE2, 0x17, 0x97,
+    0x19, 0xC9, 0xB5, 0x91, 0x56, 0xBE, 0x7A, 0xC6, 0x19, 0xDE, 0x86, 0x1B, 0x17, 0x08, 0xD3, 0x00,
+    0x82, 0x6C, 0x14, 0x27, 0x2B, 0xC5, 0x13, 0x9D, 0x0C, 0x75, 0x3A, 0x53, 0x0E, 0xC5, 0xAE, 0x1C,
+    0xBA, 0x08, 0x3E, 0x50, 0xEA, 0x7F, 0xF4, 0x8D, 0x36, 0x3A, 0x25, 0xBC, 0x62, 0xC6, 0x8E, 0xE0,
+    0x7B, 0xD4, 0x8E, 0xB8, 0x07, 0x33, 0xED, 0xE3, 0x8D, 0x3A, 0xB9, 0xA1, 0x90, 0x99, 0x70, 0xF7,
+    0x17, 0xDA, 0x28, 0x9A, 0x64, 0x43, 0x29, 0x13, 0xD1, 0xFD, 0x15, 0x3B, 0x6B, 0xEC, 0xD6, 0x6E,
+    0xC7, 0x4A, 0xA3, 0xB2, 0x17, 0x73, 0xAD, 0x24, 0x0D, 0x57, 0xD6, 0xFD, 0xA9, 0x66, 0x01, 0x7D,
+    0x4B, 0xE0, 0x82, 0x9D, 0xB0, 0x53, 0xB3, 0xD2, 0x46, 0x14, 0x4C, 0xA2, 0x9B, 0xEB, 0x95, 0x4A,
+    0x95, 0x40, 0x3F, 0x52, 0x4F, 0x9B, 0x7C, 0xA0, 0x92, 0x9F, 0xC0, 0x65, 0xB4, 0xBC, 0x40, 0xA9,
+    0x15, 0x70, 0xD9, 0x52, 0x08, 0x50, 0x29, 0xB7, 0x87, 0x4A, 0x76, 0x84, 0x6A, 0xB3, 0x13, 0xD4,
+    0x6B, 0x17, 0x8B, 0xBE, 0x49, 0xED, 0xDC, 0x44, 0xB3, 0x98, 0xA5, 0x5D, 0xDA, 0xD9, 0x24, 0x9B,
+    0xBA, 0xD8, 0x24, 0xB7, 0xD9, 0x58, 0x6F, 0x92, 0x9F, 0xB2, 0x53, 0xB4, 0x92, 0xA4, 0x50, 0x9E,
+    0x7B, 0x2C, 0x07, 0x24, 0xAF, 0x1E, 0xAD, 0x56, 0xE0, 0x53, 0xAB, 0x83, 0xD5, 0xF3, 0xB5, 0xDB,
+    0x47, 0xDF, 0xA7, 0x12, 0x26, 0xE1, 0xA6, 0x26, 0xD1, 0xAC, 0xCD, 0x0A, 0x7A, 0x7B, 0x83, 0x36,
+    0x4F, 0x0F, 0x1D, 0x00, 0x6B, 0xAD, 0x61, 0xAF, 0x5B, 0x25, 0xED, 0x28, 0xBC, 0xD4, 0x87, 0x1B,
+    0x85, 0xDE, 0xD1, 0x58, 0x68, 0xB2, 0xA9, 0x50, 0xCC, 0xDC, 0x81, 0x5B, 0xDC, 0x88, 0x99, 0x15,
+    0x70, 0x77, 0x35, 0x94, 0x5B, 0x25, 0xCC, 0x5C, 0x09, 0x17, 0x9A, 0xB5, 0xDC, 0x30, 0xC9, 0xCC,
+    0x74, 0x8B, 0x0B, 0xD8, 0x8F, 0xB6, 0xDD, 0x24, 0x92, 0x42, 0x9E, 0x91, 0x55, 0x86, 0xD8, 0x61,
+    0x77, 0x48, 0x76, 0xF3, 0x0E, 0x94, 0xEA, 0x2D, 0x5B, 0x95, 0x95, 0x14, 0x32, 0xF8, 0xB6, 0x9A,
+    0x20, 0x7F, 0x65, 0x38, 0x0B, 0xE0, 0xCA, 0x2A, 0x29, 0x6B, 0xF6, 0xAF, 0x9E, 0xF8, 0x25, 0xDF,
+    0xA6, 0xD2, 0xB0, 0xB3, 0xCE, 0x29, 0xFB, 0x46, 0x6A, 0x05, 0x0A, 0xC5, 0x8C, 0xBF, 0x5A, 0x1D,
+    0x5F, 0xAF, 0x24, 0x8D, 0x56, 0x52, 0x75, 0x08, 0x2A, 0x0A, 0xF0, 0xFB, 0x6F, 0xD2, 0x29, 0x94,
+    0xDA, 0x68, 0x35, 0xE3, 0x27, 0x4A, 0x65, 0xD3, 0xC6, 0x66, 0x73, 0xBA, 0xDA, 0x2F, 0xDD, 0x84,
+    0x53, 0x5F, 0x2A, 0xD1, 0x28, 0xD0, 0x69, 0xC0, 0x29, 0x2F, 0xF9, 0x73, 0x6E, 0x9F, 0x66, 0xDD,
+    0xE7, 0xE6, 0x48, 0xA9, 0xBF, 0xA5, 0xD6, 0x8A, 0xD1, 0x4C, 0xAB, 0x71, 0x37, 0x9C, 0x79, 0xEE,
+    0x95, 0x8F, 0x92, 0xEC, 0xFF, 0xFD, 0xF9, 0xB2, 0xD9, 0xD7, 0x1F, 0x2D, 0x9B, 0x7D, 0xFD, 0xD1,
+    0xBC, 0xDA, 0xAB, 0x0F, 0x3F, 0x5E, 0xDD, 0xAB, 0xEF, 0x3E, 0x4E, 0xAE, 0x7D, 0x10, 0xBF, 0x79,
+    0x9B, 0x5A, 0x11, 0xAB, 0x50, 0x69, 0x03, 0x17, 0xA9, 0x04, 0x5D, 0xA4, 0x3C, 0xCF, 0xDA, 0x99,
+    0x42, 0x03, 0x46, 0x13, 0x5E, 0x94, 0x8A, 0x38, 0x65, 0xBB, 0x2C, 0x60, 0x12, 0x4F, 0x65, 0x47,
+    0x3E, 0x21, 0x0D, 0x46, 0x33, 0xDA, 0x30, 0x5B, 0x0F, 0xD0, 0x8C, 0x6F, 0x75, 0xF3, 0x5B, 0x76,
+    0x7D, 0xEB, 0x35, 0x97, 0x5E, 0xEB, 0xE6, 0x6F, 0xD4, 0x23, 0xF4, 0x05, 0x65, 0xF8, 0x17, 0x98,
+    0xF0, 0x1A, 0xF6, 0xDE, 0x5A, 0xE8, 0x95, 0x54, 0xAF, 0x36, 0x76, 0x51, 0x83, 0xBB, 0xBF, 0xE2,
+    0x1F, 0x0A, 0xF7, 0x0B, 0x05, 0xB3, 0xFA, 0x58, 0xE9, 0x46, 0x42, 0xAF, 0x24, 0x6C, 0xB9, 0x60,
+    0xF8, 0x73, 0x4A, 0x9E, 0xEF, 0x81, 0x37, 0xAB, 0x9E, 0xB7, 0xAA, 0x09, 0xFF, 0xD2, 0x82, 0x7B,
+    0x28, 0xDA, 0xC5, 0x87, 0x6A, 0x6B, 0x67, 0xF4, 0x72, 0x2A, 0xF4, 0xF6, 0x5A, 0xEB, 0x46, 0x6A,
+    0x57, 0x45, 0xF7, 0x0B, 0x0D, 0xF6, 0x9D, 0x0D, 0x5B, 0x2C, 0xFC, 0x6E, 0x31, 0xF1, 0x3C, 0xC3,
+    0xEE, 0x7A, 0xDD, 0xDD, 0x15, 0xBB, 0x22, 0x21, 0x9B, 0xF6, 0x66, 0x83, 0xCF, 0x24, 0x0B, 0x7F,
+    0x4D, 0x49, 0x35, 0xE0, 0x87, 0xD9, 0x2B, 0x91, 0xC5, 0x7E, 0x6E, 0xD5, 0xC4, 0x21, 0x2C, 0x67,
+    0x8F, 0x4E, 0xFB, 0xFB, 0xBC, 0xAA, 0x95, 0x33, 0x0F, 0x0D, 0x3B, 0x17, 0xB2, 0x65, 0x32, 0x32,
+    0xB0, 0x7B, 0xC2, 0xA9, 0xB7, 0x1C, 0x39, 0x63, 0x03, 0xA0, 0xAB, 0x0B, 0xE0, 0xEF, 0x09, 0xB0,
+    0x93, 0x1B, 0xA1, 0x9D, 0xB3, 0xE5, 0x5E, 0x0A, 0x2A, 0xE1, 0x26, 0x4A, 0xF5, 0x26, 0x81, 0xDE,
+    0xFF, 0xF7, 0xEA, 0x33, 0xDB, 0x45, 0xA7, 0x03, 0x05, 0xA7, 0xA1, 0x91, 0xF6, 0xE0, 0x14, 0xAD,
+    0x85, 0x26, 0x2A, 0x0D, 0x39, 0x1A, 0xC1, 0x26, 0xE8, 0xD6, 0x76, 0xCB, 0x6B, 0x8D, 0x72, 0x3E,
+    0x0B, 0x03, 0xC9, 0x9E, 0xCB, 0xBC, 0x74, 0x21, 0xBB, 0x45, 0x72, 0x24, 0x9D, 0x68, 0x27, 0xF8,
+    0x32, 0x5C, 0x7F, 0xB2, 0x6D, 0x79, 0x81, 0xB8, 0xDC, 0xA8, 0x1C, 0x51, 0xB9, 0x73, 0xDE, 0x91,
+    0x83, 0x89, 0x5C, 0x28, 0x07, 0x0A, 0xBD, 0x1E, 0x01, 0xFB, 0x70, 0x03, 0xBA, 0x98, 0xE9, 0xE7,
+    0x76, 0x86, 0x7A, 0xCD, 0x41, 0x1E, 0xF8, 0x00, 0x0A, 0xED, 0x02, 0x7E, 0xAC, 0x04, 0xF6, 0xF4,
+    0x58, 0x23, 0xAD, 0xB4, 0x47, 0xC9, 0x28, 0x93, 0x4B, 0x53, 0x99, 0x5D, 0x96, 0xD9, 0xC5, 0xEB,
+    0x16, 0xD0, 0xD4, 0x25, 0xB0, 0xC9, 0x08, 0x1A, 0xBD, 0xAC, 0x81, 0x42, 0x11, 0xB3, 0x98, 0x85,
+    0x5D, 0xCA, 0xA3, 0xA0, 0x00, 0x2E, 0xBA, 0x08, 0xDD, 0xDA, 0x25, 0x68, 0x74, 0x55, 0x3D, 0xC5,
+    0xF1, 0x0B, 0xC7, 0xCF, 0x26, 0xB4, 0x7F, 0x9D, 0x9B, 0xF6, 0x8F, 0xC4, 0xBD, 0xB6, 0xCF, 0xE4,
+    0x5E, 0x9B, 0x67, 0x73, 0xAF, 0xEE, 0x09, 0xEE, 0x15, 0xCC, 0x00, 0x14, 0xD9, 0x2D, 0x36, 0x9F,
+    0xAD, 0xEC, 0xE7, 0xFF, 0xE2, 0xCC, 0x0F, 0x69, 0x97, 0x43, 0x70, 0x18, 0x67, 0xB1, 0x65, 0xE9,
+    0x20, 0x34, 0xCC, 0x06, 0x34, 0x7A, 0xE6, 0x50, 0x7C, 0xF3, 0x44, 0x6B, 0x7D, 0x70, 0xC6, 0x04,
+    0x2F, 0x6D, 0xA5, 0xFE, 0xF4, 0xFA, 0x45, 0x0E, 0xF5, 0x8C, 0x56, 0x5D, 0x8F, 0xFF, 0xD3, 0x45,
+    0x0E, 0xF5, 0x8C, 0x56, 0xBD, 0x84, 0xF0, 0x32, 0xAD, 0x7A, 0x7A, 0x7C, 0xDC, 0x6B, 0xD7, 0x2C,
+    0xC9, 0x28, 0x87, 0x71, 0x68, 0x92, 0xA4, 0x6F, 0x67, 0x3F, 0x38, 0xDD, 0xB0, 0xBB, 0x04, 0xEA,
+    0xB8, 0xA3, 0xA6, 0x62, 0x3D, 0x98, 0x10, 0x7F, 0xA7, 0xD7, 0x3F, 0x59, 0xCD, 0x5F, 0x3B, 0x88,
+    0xAA, 0xCC, 0x08, 0x2E, 0xBB, 0xE1, 0xB2, 0x36, 0x0B, 0x36, 0xD4, 0x89, 0xEB, 0x14, 0xD7, 0x9E,
+    0xB0, 0xB5, 0x4E, 0xFE, 0xEC, 0x1C, 0x2A, 0xAB, 0x94, 0xB4, 0x34, 0xDB, 0x77, 0xAF, 0x3D, 0x59,
+    0xCD, 0x04, 0x74, 0x1F, 0x1F, 0xBF, 0xF9, 0x64, 0x35, 0xA5, 0x48, 0x76, 0x8B, 0x71, 0x89, 0xB7,
+    0x7E, 0xFF, 0xF8, 0xF8, 0xAC, 0x9A, 0xD1, 0xEE, 0x70, 0x4D, 0xB7, 0x24, 0x6D, 0xAD, 0xA4, 0x54,
+    0xAA, 0xDA, 0x30, 0xC9, 0x24, 0x6C, 0xB4, 0xB1, 0xD0, 0x5D, 0x85, 0x5A, 0xAF, 0xA8, 0xEF, 0xD6,
+    0x6E, 0xE5, 0xF8, 0xDA, 0xF1, 0xB5, 0x67, 0xF4, 0xEA, 0x3F, 0x51, 0x55, 0xF7, 0x7B, 0xFA, 0x91,
+    0x66, 0x03, 0x1F, 0xA9, 0xF5, 0xB4, 0xEC, 0x50, 0xC0, 0xE6, 0xB8, 0x55, 0x1D, 0x2E, 0x9A, 0x94,
+    0x23, 0x5C, 0xC3, 0x1E, 0x5B, 0x7B, 0xE1, 0x62, 0xA5, 0xBC, 0x0C, 0xDE, 0x87, 0xEC, 0xE6, 0xDC,
+    0x1D, 0xDD, 0x79, 0x5D, 0xA6, 0x72, 0xA9, 0xE6, 0x26, 0x9A, 0xA9, 0x1B, 0x9F, 0xEE, 0x8B, 0x7F,
+    0x10, 0xAF, 0x9C, 0x27, 0xB4, 0x59, 0x32, 0x2B, 0x2F, 0xF5, 0x95, 0xFC, 0x68, 0x66, 0x33, 0xDB,
+    0x50, 0xAE, 0xCF, 0x9C, 0xC8, 0x59, 0xD9, 0x3E, 0x7D, 0x74, 0xBF, 0xEA, 0x98, 0x2F, 0x1C, 0x4F,
+    0x44, 0x12, 0xD8, 0x74, 0xE9, 0x78, 0xEE, 0xDA, 0x73, 0xD7, 0x5C, 0xF0, 0xF7, 0xF4, 0xA2, 0xAE,
+    0xAE, 0x66, 0xB5, 0x8B, 0x5D, 0x34, 0xE9, 0x03, 0x3D, 0x78, 0x3A, 0x06, 0xFB, 0xBC, 0xAF, 0xAB,
+    0xA7, 0x91, 0xDF, 0x25, 0x63, 0xE3, 0xE9, 0xCB, 0x35, 0x57, 0xC6, 0x8F, 0x94, 0x1A, 0x30, 0x5B,
+    0xAE, 0x8B, 0x26, 0x2A, 0x05, 0x8C, 0x72, 0x75, 0x14, 0x81, 0xFF, 0x5C, 0x07, 0x68, 0x97, 0xAF,
+    0x43, 0xA9, 0x0F, 0x46, 0xB0, 0x36, 0x41, 0xF5, 0x58, 0x01, 0x6C, 0x1D, 0x3F, 0x43, 0xD7, 0x1F,
+    0x9D, 0x80, 0x1D, 0xDD, 0x42, 0xBD, 0x36, 0x0A, 0xB8, 0xD1, 0xAF, 0xD4, 0xA9, 0x51, 0xC4, 0x07,
+    0xA9, 0x6F, 0x92, 0x51, 0xC2, 0x07, 0x69, 0x34, 0xC9, 0x48, 0x28, 0x48, 0xB3, 0x49, 0x66, 0x53,
+    0xD0, 0x5D, 0xFD, 0x38, 0x99, 0xD4, 0x6E, 0x76, 0xD2, 0x5D, 0x3D, 0x92, 0x59, 0xBA, 0xAD, 0x3D,
+    0xD5, 0x4D, 0x4D, 0xFA, 0x70, 0xE9, 0xB6, 0x46, 0xBA, 0xA9, 0xC9, 0x6A, 0xB1, 0x5B, 0x29, 0xBD,
+    0xA4, 0xD8, 0x6A, 0xB6, 0x42, 0x7A, 0x49, 0xB1, 0xD6, 0x6C, 0x85, 0x55, 0xA5, 0x58, 0x2A, 0x5E,
+    0xC6, 0x64, 0x4D, 0x1E, 0x51, 0x9F, 0x41, 0x8C, 0x3E, 0xA3, 0x2F, 0xFF, 0x59, 0x71, 0xB6, 0x7B,
+    0xCC, 0x76, 0x16, 0xC9, 0xD0, 0x66, 0x94, 0x96, 0x77, 0x41, 0x2C, 0xFF, 0x30, 0x94, 0x76, 0x45,
+    0xB7, 0x33, 0x55, 0xD7, 0x83, 0x57, 0x0E, 0x86, 0x93, 0x02, 0x7E, 0x2D, 0xB4, 0xE0, 0x16, 0x1A,
+    0xF5, 0x5D, 0x02, 0x1F, 0x4D, 0x02, 0xB3, 0x36, 0x82, 0x52, 0xB7, 0xD4, 0x83, 0xBB, 0xD4, 0x72,
+    0x73, 0xA1, 0xE5, 0x1F, 0x5F, 0x6C, 0xF9, 0xD5, 0x04, 0xE8, 0xBE, 0x02, 0xF8, 0xA8, 0x05, 0x5C,
+    0xB2, 0x7A, 0xFF, 0x2B, 0xD9, 0xB5, 0x97, 0x9D, 0xAF, 0xD2, 0xD8, 0x9D, 0x03, 0xB7, 0x19, 0xAB,
+    0x1C, 0x10, 0x21, 0xCD, 0x70, 0xA4, 0xED, 0xF6, 0x05, 0x19, 0xB8, 0x5C, 0x00, 0x6E, 0xD9, 0x5B,
+    0x91, 0xD1, 0xB3, 0x57, 0x04, 0x74, 0x53, 0x80, 0x7A, 0x13, 0x9F, 0x09, 0xDC, 0x8E, 0xF6, 0x98,
+    0xC4, 0xCC, 0x45, 0x48, 0xF9, 0x1C, 0xE9, 0xD4, 0xBB, 0x8D, 0x76, 0xA3, 0xD4, 0xD8, 0x08, 0xBA,
+    0x94, 0x11, 0xCC, 0x8B, 0x0A, 0xE0, 0x27, 0x8D, 0xD0, 0x5E, 0x6A, 0xE7, 0xFD, 0x8B, 0xED, 0x74,
+    0x17, 0xDA, 0xF9, 0x70, 0x9F, 0x13, 0x11, 0xBA, 0x64, 0x37, 0x68, 0x65, 0x74, 0xFA, 0xEF, 0xBC,
+    0xEE, 0xE5, 0xBD, 0x2E, 0x56, 0xBB, 0xB3, 0xF9, 0x00, 0x78, 0x56, 0x4C, 0xDE, 0x2C, 0xE2, 0xA5,
+    0x15, 0x0A, 0xAF, 0xEF, 0x9D, 0x55, 0xB7, 0x49, 0x4D, 0x82, 0x72, 0xC7, 0x72, 0xA3, 0x02, 0xD8,
+    0xD9, 0xCE, 0x60, 0xB6, 0x76, 0x85, 0x5A, 0xDF, 0xD6, 0xC0, 0x67, 0x69, 0x8B, 0x7F, 0x76, 0xAD,
+    0x75, 0xE3, 0x59, 0xEC, 0xE8, 0x45, 0xA2, 0xDA, 0x2E, 0x9F, 0x3B, 0x81, 0x7F, 0xCD, 0x58, 0xDD,
+    0x83, 0x69, 0x61, 0xCF, 0xB7, 0x23, 0xAD, 0x67, 0x16, 0xD5, 0xDF, 0x7F, 0x79, 0x92, 0xED, 0x95,
+    0xA7, 0xDB, 0xF6, 0xF0, 0x33, 0xDA, 0x16, 0x72, 0xDB, 0xAA, 0xCF, 0x6B, 0x5B, 0x2E, 0xDE, 0x54,
+    0xC0, 0x2E, 0xDD, 0x4A, 0xAD, 0x9B, 0xDA, 0x76, 0x64, 0xA1, 0x5E, 0x92, 0x62, 0x6E, 0xA6, 0xD3,
+    0xBE, 0x77, 0x64, 0xA1, 0xCE, 0x41, 0xA2, 0xFB, 0xB4, 0x0C, 0xEC, 0x1E, 0xF4, 0x3C, 0x38, 0x46,
+    0x13, 0xD4, 0x9B, 0x06, 0x0A, 0xBD, 0xB4, 0x81, 0x1B, 0x9A, 0x85, 0xA2, 0xE7, 0xB9, 0xFE, 0x9F,
+    0xC7, 0x90, 0xD9, 0xC9, 0x4E, 0x54, 0x5B, 0xB5, 0xED, 0xA6, 0x52, 0xAD, 0x46, 0xE0, 0xA3, 0x8F,
+    0x18, 0x5D, 0xD5, 0xE7, 0xAC, 0xB0, 0x5F, 0xD7, 0x39, 0xB8, 0xAF, 0xA0, 0x6E, 0xBE, 0xB4, 0x33,
+    0xE1, 0x09, 0x18, 0xF5, 0x45, 0x12, 0x74, 0x59, 0x31, 0xD9, 0x3E, 0x2B, 0x25, 0x13, 0xB3, 0x42,
+    0xFA, 0xD5, 0xF3, 0xFD, 0x0B, 0xAD, 0x43, 0xB1, 0xEC, 0x9A, 0xC1, 0x47, 0x90, 0x72, 0xF4, 0x9D,
+    0x6E, 0x0A, 0xF5, 0x26, 0x5E, 0xD2, 0x06, 0x47, 0x1B, 0x34, 0x39, 0x52, 0x76, 0xA9, 0xB6, 0x1B,
+    0x2A, 0x56, 0x14, 0x36, 0xDA, 0x68, 0xFB, 0x2A, 0x99, 0x80, 0x7F, 0x79, 0xA2, 0x7B, 0x67, 0xA1,
+    0x5E, 0x5E, 0xA3, 0xD8, 0xDA, 0x01, 0xFF, 0xE0, 0xF4, 0xF7, 0xF2, 0x5E, 0x95, 0x6E, 0x37, 0x40,
+    0x46, 0xA7, 0x0F, 0xE7, 0x52, 0xB7, 0x69, 0x52, 0x93, 0x4A, 0x55, 0x42, 0x41, 0xC1, 0xCE, 0x76,
+    0x6E, 0xB7, 0x76, 0xAD, 0xF5, 0x27, 0x1A, 0x9E, 0x9A, 0x36, 0x5F, 0xE4, 0x63, 0xFF, 0x4E, 0xEC,
+    0x64, 0x7D, 0x99, 0x9D, 0x2C, 0x2E, 0xB0, 0x93, 0x85, 0x3F, 0x85, 0xD7, 0x72, 0x20, 0xBC, 0x11,
+    0x3C, 0xFF, 0x16, 0x28, 0x52, 0x69, 0xC0, 0xCC, 0xD9, 0x88, 0xF0, 0xE3, 0x21, 0x62, 0x32, 0x1E,
+    0xA2, 0x69, 0x9E, 0xFF, 0xBC, 0xB1, 0xFC, 0x22, 0x59, 0x47, 0xEC, 0x6E, 0x87, 0x9A, 0x31, 0xCB,
+    0xD1, 0x6A, 0x81, 0xCF, 0x00, 0xE9, 0x9F, 0xF7, 0x3A, 0xDA, 0x7A, 0x9A, 0xEC, 0x25, 0x18, 0xCD,
+    0x5A, 0xA7, 0x3A, 0x61, 0x5F, 0xDA, 0x4E, 0x7C, 0x3C, 0x84, 0x19, 0xBC, 0x2A, 0xE9, 0xC7, 0xDB,
+    0x71, 0x96, 0x67, 0x6E, 0x04, 0xA3, 0xBE, 0x3C, 0x6C, 0xAB, 0x4A, 0xF5, 0x1E, 0x13, 0x3A, 0x14,
+    0xFE, 0x14, 0x58, 0x0E, 0x1B, 0x41, 0x62, 0x86, 0x1D, 0x5E, 0x11, 0xFF, 0x2D, 0xE1, 0x9F, 0x9C,
+    0x60, 0x4F, 0xDB, 0x6E, 0xFE, 0x36, 0x65, 0x76, 0x78, 0xCC, 0x95, 0x5E, 0x50, 0x21, 0xCC, 0xA8,
+    0x93, 0x3B, 0x67, 0x7B, 0x9F, 0xDE, 0x95, 0xF4, 0x0B, 0x7D, 0x37, 0x73, 0xDD, 0xED, 0x0C, 0x95,
+    0x46, 0xFE, 0xD7, 0x61, 0x92, 0x17, 0x3B, 0x3A, 0x9C, 0xB8, 0xB1, 0xF5, 0xC5, 0xF5, 0xE2, 0x7A,
+    0xA1, 0x52, 0xF8, 0xD1, 0x07, 0x3B, 0xDB, 0xD9, 0x6C, 0x66, 0xAB, 0xF4, 0x6D, 0x7D, 0x4B, 0x8F,
+    0xF5, 0x2B, 0x6C, 0xF4, 0x2F, 0xB2, 0x1E, 0x6E, 0xA4, 0x9D, 0xA9, 0x37, 0x0A, 0x05, 0xDC, 0xBC,
+    0xEF, 0xE7, 0x03, 0xBE, 0xD6, 0x9F, 0x07, 0x56, 0x3C, 0x33, 0xB9, 0x9C, 0x46, 0xDC, 0x88, 0x9F,
+    0xF0, 0x53, 0x15, 0xDB, 0xB0, 0xD5, 0xD1, 0xDE, 0xBD, 0xEC, 0x3B, 0x3D, 0x79, 0x36, 0x85, 0xBA,
+    0xEE, 0x14, 0x6A, 0x15, 0xF3, 0x26, 0xC0, 0x42, 0x23, 0x85, 0x56, 0x0A, 0xF9, 0xB1, 0x50, 0xBD,
+    0x16, 0x1B, 0xDD, 0x78, 0xFD, 0xD2, 0x78, 0xFC, 0x60, 0xA7, 0xDB, 0x4D, 0x3C, 0xEC, 0x97, 0xFC,
+    0xBC, 0x37, 0xF2, 0x0C, 0xDD, 0x27, 0x44, 0x3B, 0xE7, 0x65, 0x50, 0x6A, 0xA0, 0x1B, 0xFD, 0x8B,
+    0x5B, 0xB3, 0xD8, 0x49, 0xB7, 0x64, 0x92, 0x7B, 0xAC, 0xFF, 0x73, 0xF2, 0xD5, 0xEF, 0x5F, 0x34,
+    0x84, 0x12, 0xD8, 0xF0, 0xB9, 0x59, 0x9D, 0xC0, 0xED, 0xD9, 0x6E, 0x52, 0x4F, 0xD0, 0x8C, 0x0B,
+    0x66, 0xED, 0xA8, 0xF4, 0x76, 0x28, 0x3E, 0x56, 0xE4, 0xB5, 0x6E, 0xC6, 0xDC, 0x7C, 0x1A, 0xFB,
+    0x14, 0xE9, 0xC6, 0x7B, 0x38, 0x29, 0xB4, 0x7B, 0x84, 0xFD, 0x8B, 0x1A, 0xBA, 0xE8, 0x43, 0x95,
+    0xEC, 0x84, 0xCC, 0x8C, 0x7D, 0xB8, 0x66, 0xA6, 0x72, 0xB5, 0x13, 0x7A, 0x7D, 0xC1, 0x3E, 0xCA,
+    0x4C, 0x65, 0xBD, 0xB9, 0x58, 0xEA, 0xAF, 0x13, 0xFE, 0x53, 0xD1, 0xA5, 0x1C, 0x3B, 0x1C, 0x76,
+    0x43, 0xC9, 0x4F, 0xCF, 0x30, 0x92, 0xBE, 0x78, 0x3E, 0xD3, 0xED, 0xC6, 0xCB, 0x45, 0x2D, 0x51,
+    0xFE, 0x4A, 0x2D, 0x71, 0xA4, 0x9E, 0x56, 0x2B, 0xAD, 0x34, 0x1A, 0xDD, 0x49, 0xCD, 0x5A, 0xE8,
+    0xD6, 0x46, 0x1B, 0x45, 0xB5, 0xBA, 0x80, 0xDE, 0x88, 0x74, 0x3F, 0x4B, 0x34, 0xA7, 0xA2, 0xDA,
+    0xDC, 0x88, 0x5E, 0x4F, 0xE8, 0xE1, 0xAE, 0x25, 0x16, 0x93, 0x43, 0x07, 0xD6, 0xBC, 0x19, 0xC9,
+    0xCD, 0x4F, 0x68, 0x8A, 0xC3, 0x42, 0x7E, 0xA6, 0xA6, 0x28, 0xFC, 0x48, 0x2D, 0xF5, 0xB5, 0x34,
+    0x57, 0xFA, 0x99, 0x4A, 0xF5, 0x6E, 0xD2, 0x50, 0x27, 0x1B, 0xD0, 0xAB, 0x11, 0xFB, 0x41, 0xA2,
+    0xF9, 0x44, 0x94, 0x9B, 0x0B, 0xE8, 0x8D, 0x19, 0xFB, 0x48, 0xD8, 0x79, 0x17, 0xD9, 0x5B, 0xB5,
+    0xE3, 0xA8, 0xBE, 0x96, 0x7A, 0xDA, 0x95, 0x0B, 0xEA, 0x62, 0xD4, 0xBE, 0x78, 0xDB, 0xB5, 0xD6,
+    0xB7, 0x9F, 0xA1, 0x2E, 0xBE, 0xF0, 0x67, 0x73, 0xD8, 0xEF, 0xFA, 0xB9, 0xC0, 0xA0, 0x1B, 0xB1,
+    0x0F, 0x66, 0xDA, 0xC7, 0xEB, 0xCE, 0x47, 0xB6, 0x07, 0x3E, 0x72, 0xA3, 0x3E, 0xF0, 0x91, 0xFE,
+    0x7E, 0xC2, 0x46, 0xF5, 0x66, 0xB5, 0x73, 0xA3, 0x57, 0x24, 0xFD, 0x68, 0x77, 0xC8, 0xAD, 0xCD,
+    0x0E, 0x23, 0xA7, 0xA3, 0x33, 0x3F, 0x51, 0x1B, 0xF6, 0xFD, 0x9B, 0x71, 0x1F, 0xEE, 0x0D, 0xF0,
+    0xBF, 0x62, 0xD4, 0x9B, 0x19, 0x93, 0xEB, 0xD0, 0xE7, 0x3A, 0x3C, 0x38, 0xAB, 0xC3, 0x50, 0x1C,
+    0xEA, 0xD0, 0x45, 0x61, 0x92, 0x1D, 0x2B, 0x5D, 0x5D, 0x4B, 0xBD, 0xB3, 0xB3, 0x65, 0xAB, 0xC9,
+    0x5B, 0xA0, 0x35, 0x5A, 0x69, 0x29, 0xFC, 0x78, 0xC1, 0x7A, 0xB6, 0x63, 0x76, 0xFF, 0x58, 0x8D,
+    0xD8, 0x9F, 0xAD, 0xD8, 0xD1, 0x8E, 0x4F, 0xFA, 0x7F, 0xCA, 0x95, 0x2A, 0x3F, 0x76, 0xCC, 0x8F,
+    0x7D, 0x7C, 0xF6, 0xD8, 0x09, 0xB7, 0x3F, 0xB6, 0x49, 0x36, 0x54, 0x32, 0x33, 0x7A, 0xA8, 0xDE,
+    0xCF, 0x5E, 0x5A, 0xDB, 0x7D, 0x6F, 0xCA, 0xE8, 0x0F, 0xDB, 0x10, 0x6F, 0xCC, 0x50, 0x5C, 0x2F,
+    0xAE, 0x97, 0x2A, 0x85, 0x0F, 0x87, 0x21, 0x37, 0x6B, 0x96, 0xD7, 0x1F, 0x65, 0xEE, 0xE1, 0x1F,
+    0xEF, 0xD9, 0x70, 0x63, 0xCB, 0x7B, 0x06, 0xF7, 0x5F, 0x5F, 0x18, 0xCA, 0xFD, 0xD7, 0x1D, 0x38,
+    0xFC, 0x0C, 0x43, 0xA9, 0xB9, 0x96, 0xA4, 0xC1, 0x68, 0xDF, 0xF4, 0xE9, 0x63, 0xF6, 0x62, 0x57,
+    0xEA, 0xB3, 0xB3, 0xAF, 0x4B, 0xD0, 0x1E, 0xF6, 0x4E, 0xB8, 0x94, 0xE1, 0x65, 0xA1, 0x98, 0x9D,
+    0x50, 0xB5, 0xB4, 0x62, 0xF7, 0x3D, 0x36, 0xEC, 0x91, 0xDC, 0x63, 0x9D, 0x69, 0xD9, 0xCC, 0xD7,
+    0x34, 0xFA, 0xDB, 0xEB, 0xD9, 0x71, 0xA6, 0x3E, 0xBB, 0x99, 0x7C, 0x82, 0x4A, 0x53, 0xF6, 0xD4,
+    0x1B, 0x6D, 0xFF, 0xDD, 0x1F, 0xF6, 0xA4, 0x49, 0xC7, 0xC7, 0xFD, 0xFE, 0xDB, 0x10, 0x39, 0xF8,
+    0x50, 0xD2, 0xCA, 0xFE, 0xC6, 0x72, 0x28, 0xC4, 0xC3, 0xBF, 0x02, 0x57, 0x72, 0xA1, 0xBF, 0x24,
+    0xB8, 0x00, 0xA7, 0xB9, 0xCC, 0x9B, 0xC5, 0x1A, 0xAD, 0xD8, 0xCD, 0x4B, 0x1A, 0xBB, 0xB9, 0xD6,
+    0x5A, 0x25, 0xB3, 0xE0, 0x12, 0xF6, 0x56, 0xC2, 0xE8, 0xC4, 0x3F, 0xCE, 0x54, 0x44, 0x72, 0x01,
+    0x2F, 0xE9, 0x46, 0xDE, 0x89, 0xF8, 0x41, 0xC2, 0x6C, 0xC7, 0x14, 0xEA, 0xF7, 0xC0, 0xF2, 0x6A,
+    0xFF, 0x29, 0x08, 0xA9, 0x2F, 0xDF, 0xD9, 0x7F, 0xD5, 0x22, 0xD7, 0x74, 0xAD, 0xA5, 0x4F, 0x25,
+    0xF5, 0x4E, 0xB3, 0x93, 0x42, 0xA1, 0x31, 0x43, 0x86, 0x43, 0xEC, 0xDC, 0x07, 0x92, 0x74, 0xAA,
+    0x03, 0x0E, 0x7A, 0xC2, 0x85, 0xBA, 0xB7, 0xE9, 0xDD, 0x3D, 0xDF, 0xC7, 0x2A, 0xC7, 0x41, 0xEA,
+    0x5C, 0xA7, 0x5B, 0x55, 0x8A, 0x9D, 0x0A, 0x45, 0x23, 0x7C, 0xAC, 0x35, 0xD8, 0x54, 0x69, 0xEC,
+    0xB6, 0x5A, 0x93, 0x5B, 0x2B, 0x05, 0x9B, 0x6A, 0x0D, 0xFE, 0xC2, 0x46, 0x7C, 0xAB, 0x46, 0xA3,
+    0x55, 0xAD, 0xB1, 0x53, 0xA5, 0xB1, 0x55, 0xA9, 0xD1, 0xA8, 0xD0, 0xD8, 0x08, 0x4D, 0xB5, 0x06,
+    0xC5, 0x4A, 0xC1, 0xCF, 0x95, 0x46, 0x97, 0x4A, 0x4D, 0x36, 0xD5, 0x9A, 0x7C, 0xAA, 0x35, 0xFA,
+    0x54, 0x29, 0xF8, 0xA5, 0x52, 0xF0, 0x73, 0xAD, 0xC1, 0xC7, 0x46, 0xEC, 0x5B, 0xFC, 0xDB, 0xAD,
+    0x52, 0xC8, 0xB7, 0x4F, 0x8D, 0x86, 0xE7, 0xAE, 0x71, 0xCC, 0x73, 0xD7, 0x5C, 0xA8, 0x36, 0xDC,
+    0x3D, 0xF5, 0xED, 0x52, 0xEA, 0xEA, 0x86, 0x8B, 0x66, 0xB5, 0x4B, 0xA9, 0x60, 0x17, 0x45, 0x23,
+    0xF4, 0x41, 0xAE, 0x5F, 0xF8, 0xFF, 0xAD, 0x99, 0xB1, 0xAF, 0x1D, 0xC7, 0x75, 0xC6, 0xBF, 0xDD,
+    0x85, 0xB8, 0x08, 0xB7, 0x18, 0x17, 0x51, 0x23, 0x05, 0xD8, 0x36, 0x50, 0x80, 0xEC, 0x5F, 0x60,
+    0xCF, 0x5A, 0x2A, 0x54, 0xA8, 0x90, 0x0A, 0x31, 0x06, 0xAC, 0x82, 0xBD, 0x52, 0xBC, 0x36, 0x45,
+    0xA2, 0x59, 0x49, 0x80, 0x59, 0xB8, 0x10, 0x8B, 0x28, 0x45, 0x1A, 0xB3, 0x70, 0x61, 0x3D, 0x01,
+    0x61, 0x93, 0x22, 0x01, 0x64, 0xCE, 0x50, 0x04, 0xF2, 0x0A, 0x16, 0x5E, 0x9B, 0x36, 0x08, 0xD8,
+    0x85, 0x56, 0xA1, 0x08, 0xDA, 0x4E, 0xA1, 0x21, 0xB5, 0x92, 0x96, 0xD4, 0xCC, 0xFC, 0x52, 0xEC,
+    0x7D, 0x24, 0x2D, 0xD1, 0x76, 0x8A, 0x5C, 0xDC, 0x3D, 0xF8, 0xEE, 0xD9, 0xDD, 0x7B, 0x77, 0xE6,
+    0x9C, 0x39, 0xE7, 0xFB, 0xE6, 0xD6, 0x34, 0x45, 0x26, 0x99, 0x24, 0x1B, 0x6D, 0xAC, 0xB8, 0x4A,
+    0x68, 0x79, 0x89, 0x71, 0xC8, 0x43, 0xD6, 0xB9, 0x57, 0xCE, 0xBD, 0xA2, 0x6F, 0xBE, 0xAA, 0xE3,
+    0xF7, 0x59, 0x7B, 0x20, 0x78, 0xA0, 0x06, 0xB6, 0xAE, 0xBC, 0xFB, 0x8A, 0x86, 0x28, 0xC9, 0x07,
+    0xA9, 0x46, 0x52, 0x97, 0x24, 0x0D, 0x9F, 0x9F, 0xBB, 0x24, 0x20, 0x34, 0x80, 0x0C, 0x24, 0x59,
+    0x88, 0x62, 0x96, 0x1A, 0x24, 0x99, 0x24, 0xC9, 0x46, 0x49, 0xDC, 0x3E, 0x77, 0xAE, 0x01, 0x92,
+    0x01, 0xA2, 0x05, 0x66, 0x80, 0xB7, 0x81, 0xD2, 0x03, 0x49, 0x32, 0xAB, 0x24, 0xB5, 0x48, 0x52,
+    0x43, 0x90, 0x24, 0x36, 0x49, 0xF2, 0x48, 0x92, 0x65, 0x96, 0xD4, 0x7F, 0x95, 0x24, 0x99, 0x0D,
+    0x49, 0x4D, 0xB6, 0x8B, 0x54, 0xD3, 0x25, 0x49, 0xBC, 0xC9, 0x28, 0xB9, 0xD9, 0x46, 0xC9, 0xC6,
+    0x2E, 0x49, 0x26, 0x55, 0x4C, 0xEA, 0xB2, 0x6C, 0x54, 0xC3, 0xBB, 0xE7, 0xB3, 0x2A, 0x80, 0x49,
+    0x1E, 0x88, 0xB2, 0x40, 0xD1, 0x00, 0x10, 0x0C, 0xC0, 0xDA, 0x32, 0xC9, 0x94, 0x9A, 0xA0, 0x86,
+    0x40, 0x94, 0xFC, 0xEA, 0x36, 0xA9, 0x47, 0x1E, 0xBE, 0x00, 0x7E, 0x08, 0x69, 0x88, 0x92, 0x0B,
+    0xAA, 0x90, 0xDA, 0x24, 0xF5, 0x9F, 0x8F, 0x72, 0xDC, 0xAF, 0xA0, 0x34, 0x50, 0x4C, 0xAC, 0x93,
+    0x0D, 0xCD, 0x86, 0xCC, 0xAD, 0x24, 0xFB, 0x4E, 0x6C, 0x8B, 0x85, 0x15, 0xB8, 0x06, 0xC5, 0xC0,
+    0x62, 0xF9, 0xAD, 0xF6, 0x41, 0x65, 0x79, 0x08, 0x57, 0xD4, 0xC7, 0x2B, 0x6A, 0xD6, 0x47, 0x47,
+    0x17, 0x3D, 0x2C, 0x1E, 0xC6, 0xC3, 0x35, 0xF3, 0x15, 0x75, 0xDB, 0x15, 0xD5, 0xE9, 0x8A, 0x54,
+    0xF6, 0xA3, 0x29, 0xFE, 0xDC, 0xE5, 0xE2, 0x21, 0x7B, 0x48, 0x1E, 0x56, 0x0F, 0xD3, 0x3E, 0x4D,
+    0x60, 0x80, 0x1B, 0xEC, 0xBF, 0x5B, 0xEC, 0x22, 0x99, 0x4D, 0x6A, 0x8A, 0x24, 0xC2, 0x1E, 0x0F,
+    0x93, 0xF6, 0x08, 0x55, 0x04, 0xC9, 0x45, 0xA9, 0x4F, 0xFB, 0xD4, 0x3F, 0x72, 0x64, 0xA9, 0x65,
+    0x54, 0xC5, 0x2C, 0xB9, 0x55, 0xEA, 0xCB, 0xEE, 0x90, 0x7A, 0x48, 0x92, 0x83, 0xA8, 0x0A, 0x08,
+    0xEA, 0x00, 0x69, 0x88, 0x6D, 0x92, 0xFC, 0xD4, 0x47, 0xD5, 0x45, 0x2E, 0xA8, 0xDB, 0x2A, 0x24,
+    0xBB, 0xB4, 0x49, 0x62, 0xEA, 0x57, 0x35, 0x59, 0x6E, 0x96, 0x59, 0x2B, 0x46, 0xD9, 0xB9, 0xCD,
+    0x12, 0xE3, 0x43, 0x77, 0xBF, 0x56, 0x4C, 0x22, 0xB4, 0x45, 0xA6, 0x68, 0xD8, 0x5A, 0x4E, 0x73,
+    0x83, 0xCD, 0x02, 0x2C, 0x00, 0x3C, 0x0F, 0x90, 0xDA, 0x2C, 0xD9, 0x68, 0x36, 0x89, 0xC9, 0x2E,
+    0x6A, 0xF3, 0x9E, 0xBA, 0x97, 0x61, 0x1B, 0x0E, 0x17, 0xC5, 0x01, 0x4A, 0xC3, 0x21, 0x01, 0xBF,
+    0x06, 0x60, 0x6E, 0x20, 0x3F, 0x06, 0xEE, 0xBF, 0xF2, 0xF5, 0x6B, 0x3E, 0xDF, 0x33, 0x36, 0x3A,
+    0xE0, 0x45, 0x60, 0x73, 0xC0, 0x09, 0x90, 0x1C, 0x30, 0x57, 0x2C, 0x86, 0xC5, 0x20, 0x11, 0x0D,
+    0xB3, 0x4D, 0x92, 0x4D, 0x86, 0xD9, 0x6D, 0xD2, 0x90, 0xCD, 0x9E, 0x41, 0x86, 0x8E, 0xAB, 0xCC,
+    0x52, 0xCB, 0x4B, 0x5C, 0x23, 0x48, 0x0D, 0x27, 0x5C, 0x47, 0x92, 0xB8, 0xC3, 0xCF, 0x8A, 0x24,
+    0xF9, 0x2F, 0xB9, 0x9C, 0x4E, 0x63, 0xB7, 0x6A, 0x9F, 0x61, 0xA2, 0x24, 0x19, 0xD8, 0x57, 0x42,
+    0xC3, 0x21, 0xBE, 0x35, 0xB0, 0x0F, 0xF6, 0x14, 0xB4, 0xA7, 0xA7, 0x1E, 0xDE, 0xE5, 0xF7, 0x05,
+    0xA5, 0x1A, 0xF6, 0x8B, 0x3A, 0x00, 0x66, 0xC9, 0xF2, 0x25, 0x1F, 0xB1, 0x4A, 0x70, 0x9D, 0xEB,
+    0x64, 0x35, 0xD0, 0xF1, 0x21, 0x4C, 0x3D, 0xB9, 0x23, 0xC0, 0xE2, 0xD8, 0x0C, 0xB3, 0x65, 0x3B,
+    0xE3, 0x17, 0xC1, 0xD6, 0xC0, 0x66, 0x7E, 0xEF, 0x57, 0x69, 0x58, 0x24, 0x1B, 0x54, 0x15, 0xA9,
+    0x5F, 0x1B, 0x98, 0x0C, 0x9F, 0xC8, 0xB2, 0xE8, 0xEF, 0x7C, 0xDC, 0xCF, 0xBA, 0xA0, 0x8A, 0x6F,
+    0xA9, 0xCB, 0xFF, 0x59, 0xF9, 0x7B, 0xC0, 0x75, 0x28, 0x03, 0x44, 0x0F, 0x3A, 0xE2, 0xA2, 0xDC,
+    0x2C, 0xA9, 0xC9, 0xD2, 0xF1, 0x45, 0xBB, 0xA8, 0x2F, 0x4D, 0x51, 0xC3, 0x62, 0x17, 0x39, 0x9A,
+    0xA2, 0x8E, 0x68, 0xA3, 0xA0, 0x41, 0x03, 0xD1, 0xC6, 0x06, 0x1A, 0xE4, 0x89, 0x43, 0x34, 0xF0,
+    0x3C, 0x35, 0x6E, 0x1D, 0x56, 0xFB, 0x25, 0xCF, 0xF3, 0x52, 0x76, 0xDB, 0xB0, 0x72, 0xC2, 0x9B,
+    0x9C, 0xDF, 0xDC, 0xD6, 0x7F, 0x45, 0xCB, 0x55, 0x58, 0x5C, 0xEA, 0xC9, 0x2D, 0x57, 0x21, 0xF8,
+    0x64, 0x58, 0x3B, 0x02, 0xC8, 0x27, 0xC3, 0xD2, 0x31, 0x93, 0xE4, 0xB3, 0x21, 0x74, 0xCC, 0xAA,
+    0x24, 0xC9, 0x86, 0x3E, 0xAA, 0x81, 0xB2, 0xA7, 0x84, 0x2A, 0xD8, 0xA4, 0x96, 0x22, 0xE9, 0xCC,
+    0x7B, 0xFA, 0xF3, 0xAF, 0x3D, 0xF1, 0xEC, 0xAC, 0xB3, 0xEF, 0x35, 0x45, 0x15, 0x8B, 0x5D, 0x64,
+    0x4B, 0x53, 0xD4, 0x12, 0xED, 0x22, 0x4F, 0x83, 0x0C, 0xD1, 0xC6, 0x1A, 0x1A, 0x64, 0x89, 0x36,
+    0x76, 0x50, 0x23, 0x58, 0x87, 0x38, 0x7C, 0xC9, 0xF3, 0xBC, 0x80, 0x5B, 0x87, 0xD5, 0xDF, 0xE4,
+    0x2D, 0x5E, 0x4E, 0x6E, 0xEB, 0x3F, 0xE7, 0x02, 0x6F, 0xE2, 0xA3, 0x4B, 0x3D, 0xA5, 0xE5, 0x2A,
+    0xCC, 0x2E, 0xF5, 0xA4, 0x8E, 0x00, 0xA3, 0x4F, 0x86, 0xD8, 0x11, 0x28, 0x0F, 0xC7, 0x42, 0x92,
+    0xCF, 0x35, 0xF2, 0xAB, 0x6C, 0x34, 0xA8, 0xA1, 0x66, 0x96, 0x8D, 0x6E, 0x53, 0x53, 0x0C, 0x92,
+    0xFD, 0x98, 0x59, 0x6D, 0xB1, 0x49, 0x72, 0xBF, 0x61, 0x54, 0x97, 0x59, 0x24, 0x4F, 0x92, 0x3A,
+    0x18, 0x25, 0xF6, 0x5C, 0xCD, 0x92, 0x60, 0x92, 0x0C, 0xAB, 0x54, 0xC1, 0x2C, 0xF5, 0x30, 0xAA,
+    0x82, 0x22, 0x0D, 0xB0, 0xA9, 0xE6, 0x32, 0x51, 0x76, 0xF3, 0x84, 0x86, 0xB7, 0x41, 0x76, 0x33,
+    0xA4, 0x86, 0xC9, 0xB1, 0xDA, 0xAD, 0x82, 0x59, 0x0E, 0xD6, 0x0A, 0x98, 0x5B, 0x60, 0xEC, 0x21,
+    0xCB, 0x7D, 0x7E, 0xB4, 0x56, 0x4C, 0x6E, 0x6E, 0x4B, 0xC5, 0xD8, 0x6F, 0x6D, 0x96, 0x9F, 0xFB,
+    0xB5, 0x66, 0x74, 0x73, 0x97, 0x6B, 0xC6, 0x21, 0x76, 0x59, 0x84, 0x61, 0x6D, 0x90, 0x9F, 0x4D,
+    0xAA, 0x19, 0xED, 0xA9, 0xAB, 0x2D, 0x62, 0xEE, 0xB7, 0x86, 0x17, 0x59, 0x4C, 0x1E, 0x18, 0xED,
+    0x4A, 0x12, 0x37, 0x98, 0x1A, 0x46, 0xE9, 0xA9, 0x57, 0x6D, 0x92, 0x58, 0x88, 0x6A, 0x79, 0x9B,
+    0x45, 0x43, 0x31, 0x04, 0x91, 0x2C, 0x63, 0x47, 0x04, 0x59, 0xAE, 0x91, 0x2B, 0x30, 0x6C, 0x86,
+    0x64, 0x89, 0x8E, 0x88, 0xBF, 0x05, 0xD7, 0x32, 0x1F, 0x3D, 0xC0, 0x7C, 0x01, 0x1F, 0x25, 0x77,
+    0x13, 0xEC, 0x5D, 0xDE, 0x61, 0xE3, 0xA4, 0x0C, 0xDC, 0xA0, 0xDF, 0x1C, 0x26, 0xB9, 0x85, 0xCD,
+    0xDE, 0xE5, 0x2D, 0x66, 0x4E, 0x4A, 0x4B, 0x43, 0xBF, 0x3D, 0xF5, 0xAA, 0x49, 0x6E, 0x91, 0xEC,
+    0x5D, 0x82, 0xC4, 0x49, 0x91, 0x1A, 0x34, 0xAC, 0x12, 0x1F, 0x32, 0xCA, 0xA4, 0x03, 0x9C, 0x64,
+    0xD2, 0xB0, 0x1D, 0x60, 0x9F, 0xEC, 0xA6, 0x8A, 0x6B, 0x5F, 0x83, 0xD9, 0x26, 0x55, 0xDC, 0x20,
+    0x3C, 0x82, 0xBF, 0x3A, 0x77, 0x94, 0x2D, 0x87, 0x12, 0x4E, 0xB1, 0x00, 0xB7, 0xBE, 0x01, 0x93,
+    0x6A, 0x6E, 0x11, 0x64, 0xB1, 0x49, 0x0D, 0x9F, 0x31, 0xCB, 0xE2, 0xB2, 0x1A, 0xA2, 0x74, 0x54,
+    0x46, 0xA9, 0x82, 0xBC, 0xD7, 0x80, 0xB8, 0x57, 0x02, 0xD5, 0xAC, 0x2D, 0x4B, 0xC5, 0xA2, 0x21,
+    0xCB, 0x47, 0xD5, 0x04, 0x1B, 0x25, 0xBB, 0x0E, 0x49, 0xEA, 0x8A, 0xC9, 0x52, 0xC5, 0xB5, 0xBD,
+    0x0A, 0x12, 0x24, 0x93, 0xF6, 0x6A, 0x78, 0x3E, 0x49, 0xE2, 0x26, 0x92, 0xEC, 0x4A, 0x90, 0x4C,
+    0xDE, 0x4F, 0x18, 0xA4, 0x9A, 0x6B, 0x2C, 0xAA, 0x88, 0xF0, 0xCF, 0xAF, 0x91, 0x06, 0xD8, 0x7B,
+    0x21, 0x30, 0xFA, 0x47, 0xDD, 0x75, 0x16, 0xC0, 0xA2, 0x6E, 0x2F, 0x44, 0xCF, 0xF2, 0x60, 0x7C,
+    0x7C, 0x1D, 0x9D, 0x96, 0xD5, 0x87, 0xF5, 0xF5, 0x24, 0xAB, 0x4B, 0x6E, 0x96, 0x3B, 0x05, 0xFE,
+    0xCF, 0x82, 0x45, 0xFE, 0xA4, 0x3C, 0x01, 0x98, 0xEC, 0x16, 0x71, 0xB3, 0xA8, 0x4B, 0x67, 0x8F,
+    0xDF, 0x93, 0x2C, 0x4C, 0x62, 0xAF, 0xFC, 0xCC, 0x66, 0xAD, 0x08, 0x76, 0x16, 0x23, 0x63, 0x5D,
+    0xDA, 0xAC, 0x2E, 0xF5, 0xAB, 0x6C, 0x74, 0xB7, 0x5F, 0xE3, 0x2A, 0x50, 0xBA, 0x43, 0x33, 0x61,
+    0xF2, 0xB0, 0xD5, 0xC0, 0xD8, 0xC1, 0x45, 0xD9, 0x4D, 0x12, 0xCB, 0x81, 0xAC, 0x18, 0x24, 0xD9,
+    0x24, 0x89, 0xF8, 0xB8, 0xCB, 0xA5, 0xC7, 0x86, 0x79, 0xC4, 0x8F, 0x25, 0x07, 0x41, 0x16, 0x92,
+    0x0C, 0x30, 0x35, 0xC0, 0x2A, 0xCF, 0xEF, 0x2F, 0x8F, 0x86, 0x59, 0xAA, 0x89, 0xA7, 0xDF, 0xD4,
+    0x32, 0x49, 0xF2, 0xAB, 0x0E, 0xDF, 0x25, 0xE2, 0x13, 0xE1, 0x26, 0xC9, 0x30, 0x4B, 0x82, 0x5F,
+    0x3E, 0xF5, 0xEF, 0x2D, 0xC0, 0x68, 0x81, 0xB5, 0x06, 0x18, 0x0D, 0xB0, 0xC9, 0x72, 0x18, 0xF7,
+    0xA6, 0x0A, 0x98, 0x1C, 0xC0, 0x5D, 0x38, 0xCC, 0x3A, 0xF4, 0x9C, 0x4E, 0x3E, 0x71, 0xA7, 0x0A,
+    0x7B, 0x27, 0xDC, 0x69, 0xDC, 0xCE, 0xE3, 0x76, 0xF7, 0x4E, 0xD2, 0xFA, 0x24, 0xED, 0x64, 0x61,
+    0xA7, 0x0D, 0x7F, 0xCC, 0xDD, 0x31, 0x4A, 0x1A, 0xB2, 0x4E, 0x07, 0x53, 0x33, 0x3F, 0xC1, 0xFD,
+    0xFA, 0xA4, 0xB3, 0x97, 0x98, 0xE4, 0x3F, 0x44, 0x4D, 0x69, 0x8A, 0x4C, 0xEC, 0xB2, 0x7C, 0x30,
+    0xA9, 0x29, 0x1A, 0x56, 0x13, 0xE5, 0xA2, 0x0B, 0xE2, 0x56, 0x51, 0xC5, 0x47, 0xAB, 0x1A, 0x08,
+    0x7B, 0xAD, 0x36, 0xAC, 0x52, 0x4F, 0x90, 0x6C, 0xD1, 0xCE, 0x56, 0x44, 0x38, 0x50, 0x9E, 0x61,
+    0x95, 0x5A, 0x82, 0x7A, 0x8A, 0xE4, 0x76, 0xCE, 0x32, 0xAA, 0x65, 0x95, 0xFA, 0x07, 0x0F, 0x23,
+    0x73, 0x16, 0xEE, 0xAB, 0x03, 0x52, 0xCD, 0xE5, 0x72, 0x39, 0xDA, 0x91, 0x60, 0x2F, 0xCC, 0x26,
+    0x55, 0xE9, 0x03, 0x11, 0xCC, 0xF5, 0xC5, 0xA4, 0x2A, 0xB9, 0x89, 0xE0, 0x4E, 0x1E, 0x51, 0x92,
+    0x11, 0x60, 0x69, 0x81, 0xA4, 0xB3, 0xF0, 0x3B, 0x49, 0xCC, 0x92, 0x4C, 0x96, 0x76, 0xE6, 0xA4,
+    0xFE, 0xC9, 0xB0, 0xEC, 0xB3, 0x6A, 0x52, 0x8B, 0x34, 0xC4, 0x9A, 0x49, 0x6E, 0x11, 0xB3, 0x08,
+    0xF2, 0xB1, 0x61, 0x94, 0xDD, 0x3A, 0xA4, 0x3E, 0xF7, 0x49, 0xEA, 0x70, 0x9B, 0xD4, 0x40, 0x94,
+    0x6A, 0x0E, 0x91, 0x9E, 0x24, 0xB9, 0x9D, 0x1A, 0x17, 0x3D, 0xC4, 0x10, 0xA4, 0x1A, 0x16, 0xA9,
+    0x85, 0x55, 0x3B, 0x2D, 0x97, 0xC5, 0x15, 0xC9, 0xE5, 0x81, 0x51, 0x6C, 0x86, 0xD0, 0x10, 0x3B,
+    0x96, 0x8E, 0xB9, 0x61, 0x35, 0x84, 0x8A, 0x64, 0x19, 0x45, 0xB1, 0x41, 0x08, 0x35, 0xA9, 0x49,
+    0x32, 0xD1, 0x44, 0xD9, 0xF0, 0xD0, 0xD5, 0x26, 0x99, 0xD8, 0x47, 0xD9, 0xE0, 0x82, 0xA8, 0x1E,
+    0x77, 0xB9, 0xE0, 0x42, 0x45, 0x85, 0xDA, 0xD4, 0x26, 0xF5, 0xB1, 0x5F, 0xE5, 0x66, 0x37, 0x57,
+    0x7C, 0x97, 0xB1, 0xCD, 0x2D, 0xC0, 0x79, 0x20, 0xBB, 0xD3, 0x9C, 0x3B, 0x39, 0xA5, 0x26, 0x9B,
+    0x24, 0xBB, 0x48, 0x15, 0xA3, 0xD4, 0xE5, 0x87, 0x11, 0xB1, 0x63, 0x93, 0xEC, 0xD8, 0x24, 0xAB,
+    0xFD, 0x70, 0x6A, 0xD2, 0x1B, 0x6A, 0xD2, 0x3F, 0xA9, 0x49, 0x3F, 0x55, 0x93, 0x7E, 0xAA, 0x36,
+    0x79, 0x99, 0xE4, 0x27, 0x97, 0x1C, 0x24, 0x0B, 0xA9, 0xA7, 0xA4, 0x86, 0xBB, 0x49, 0x4F, 0xD7,
+    0x49, 0xAA, 0x93, 0x54, 0xE7, 0xC7, 0x0F, 0x37, 0x3F, 0x3D, 0xBA, 0x93, 0xDC, 0x94, 0x36, 0xB9,
+    0xD9, 0x2E, 0x7F, 0x16, 0xDA, 0x93, 0xD4, 0x94, 0x26, 0xB9, 0xF0, 0x75, 0x58, 0xE7, 0x26, 0xB9,
+    0x30, 0xCC, 0x4F, 0x80, 0x0F, 0x07, 0xF7, 0x0D, 0x18, 0x5E, 0xBF, 0x28, 0xBD, 0x3E, 0xB9, 0xD9,
+    0x2E, 0x2E, 0x3C, 0xC1, 0x86, 0x3F, 0x6E, 0xED, 0x13, 0xED, 0x30, 0xFF, 0x09, 0x0B, 0xF0, 0xC0,
+    0x01, 0xE0, 0x00, 0x8A, 0xE3, 0x34, 0x00, 0x24, 0x9D, 0x4A, 0xB8, 0xC3, 0xDA, 0x36, 0x9B, 0x24,
+    0xF5, 0xAB, 0x24, 0x3D, 0xF5, 0xCA, 0xB9, 0xEF, 0x5F, 0x92, 0x2C, 0x49, 0x32, 0xA0, 0x7D, 0xA1,
+    0x49, 0x6D, 0x94, 0x54, 0xED, 0x8B, 0x5B, 0x92, 0xFA, 0x47, 0x4E, 0xB8, 0x24, 0x39, 0x98, 0xD4,
+    0xC3, 0xA6, 0xF6, 0xFE, 0xDF, 0xA3, 0x2A, 0xCB, 0x2D, 0x72, 0x63, 0xB7, 0xA9, 0x9F, 0x6B, 0xD4,
+    0xAE, 0x62, 0xAA, 0x72, 0xC5, 0x22, 0x07, 0xEB, 0xCE, 0x26, 0xBA, 0x9D, 0x52, 0xB0, 0xEC, 0x31,
+    0x37, 0x7B, 0xF8, 0x1B, 0xF6, 0xDE, 0xE0, 0xE7, 0x57, 0x25, 0x69, 0x58, 0x9D, 0x24, 0x75, 0xB9,
+    0x0F, 0x92, 0x6A, 0x5E, 0x8C, 0x92, 0xE4, 0x7E, 0x9E, 0xF6, 0x67, 0x76, 0x3B, 0x11, 0xEB, 0x83,
+    0xA4, 0xEA, 0x1B, 0x27, 0xF9, 0xAD, 0xD4, 0xE6, 0x1E, 0x16, 0x55, 0xBC, 0x08, 0x45, 0x72, 0x1F,
+    0x97, 0xEF, 0x13, 0xD4, 0x6F, 0x6E, 0xEC, 0x37, 0xB5, 0xA5, 0x9F, 0xEB, 0xA2, 0x8A, 0x0B, 0xAB,
+    0x7C, 0x90, 0xBF, 0x9B, 0x65, 0x17, 0x0D, 0xC9, 0x8D, 0x6E, 0x53, 0x47, 0x0F, 0x59, 0x0D, 0xD7,
+    0xA1, 0x48, 0xDC, 0xDB, 0xB9, 0x62, 0xF2, 0x6C, 0x92, 0x61, 0x3C, 0xCC, 0x48, 0x1B, 0xF7, 0xE9,
+    0x70, 0xDF, 0xFC, 0x08, 0x97, 0x5A, 0xD8, 0x7A, 0xD8, 0xDC, 0xBF, 0xF8, 0xBB, 0x59, 0xEE, 0xCE,
+    0x2A, 0xFF, 0xA3, 0xB9, 0xC6, 0x8D, 0xE6, 0x7E, 0xAE, 0xB8, 0x03, 0x1C, 0xC1, 0xE6, 0xE1, 0xAD,
+    0x7D, 0x22, 0xBE, 0xFF, 0x8A, 0x24, 0xCF, 0x22, 0x39, 0x98, 0xD5, 0xEF, 0x5D, 0xE2, 0xE2, 0x51,
+    0x16, 0xB3, 0x5C, 0xEC, 0x37, 0xD5, 0x3C, 0x8F, 0x64, 0xD2, 0x73, 0x17, 0x77, 0x49, 0xAE, 0x36,
+    0xCB, 0x00, 0x8B, 0x80, 0x72, 0x80, 0xE7, 0xCE, 0xBD, 0xB6, 0xD7, 0x85, 0x45, 0x92, 0x29, 0x2E,
+    0xAB, 0xDB, 0x29, 0x45, 0xB2, 0x00, 0x1F, 0x02, 0x6C, 0x06, 0x40, 0x0E, 0x08, 0x15, 0x10, 0x55,
+    0x79, 0x2E, 0x1D, 0x56, 0xE0, 0xD3, 0xAA, 0xB9, 0x58, 0x27, 0x79, 0x62, 0x17, 0x0D, 0xC4, 0x21,
+    0x78, 0x88, 0xBE, 0xE1, 0xBB, 0xFE, 0x17, 0x69, 0x58, 0xE5, 0x7F, 0x18, 0x99, 0xC4, 0x70, 0x2D,
+    0xA9, 0x4E, 0xFE, 0xD3, 0xA8, 0xF6, 0x0B, 0x08, 0xEA, 0x7F, 0x43, 0x91, 0xDC, 0x11, 0x9B, 0xAA,
+    0xE2, 0x39, 0x75, 0x0F, 0xBF, 0x59, 0x98, 0xC4, 0xD1, 0xDB, 0x4C, 0x26, 0xBD, 0x61, 0xF8, 0x8A,
+    0xBB, 0xDB, 0x00, 0xBC, 0xB8, 0x58, 0x48, 0xFD, 0xE4, 0x60, 0x7E, 0x43, 0x8E, 0x5C, 0xAD, 0x7A,
+    0x96, 0x51, 0xAA, 0x2E, 0x13, 0x65, 0x20, 0xEE, 0x5A, 0x93, 0x5F, 0x9D, 0x8F, 0x15, 0xEA, 0x62,
+    0x9D, 0xD5, 0xAD, 0x75, 0x56, 0xB7, 0x36, 0x59, 0xDD, 0x5A, 0x17, 0x75, 0x6B, 0x8D, 0xBA, 0x4D,
+    0x3C, 0xB8, 0xBC, 0xC9, 0xC3, 0xB6, 0x67, 0x97, 0x85, 0x24, 0x0F, 0x49, 0xFC, 0xDC, 0xA7, 0x9A,
+    0xC9, 0xA6, 0x86, 0xD1, 0xA6, 0x16, 0xD9, 0xD4, 0x21, 0x9B, 0x0C, 0xA3, 0x4D, 0x3D, 0xA3, 0xCD,
+    0x03, 0xA3, 0xCD, 0x96, 0xD1, 0xE5, 0xE7, 0x8E, 0xF5, 0xDC, 0x4F, 0x24, 0x49, 0xCF, 0x6E, 0xD2,
+    0x00, 0x53, 0x0F, 0x8B, 0xB9, 0xEF, 0x53, 0xBB, 0x36, 0x34, 0x9B, 0x5C, 0xC8, 0x32, 0xD1, 0xAA,
+    0xCE, 0xFD, 0x24, 0xFF, 0xD2, 0xA2, 0xFE, 0xE3, 0x55, 0xED, 0xF6, 0x86, 0x6A, 0xFA, 0xDB, 0xAF,
+    0x71, 0x8D, 0x5D, 0xF1, 0x24, 0x03, 0x7C, 0x17, 0xFC, 0xDC, 0x95, 0x47, 0x5C, 0xE7, 0x29, 0x49,
+    0x75, 0x90, 0xCE, 0x6C, 0x3A, 0x03, 0x6A, 0x61, 0xA9, 0x20, 0xCB, 0xC1, 0x64, 0x8A, 0x54, 0x33,
+    0xEE, 0xF5, 0xB0, 0xC9, 0x47, 0x9B, 0x1C, 0x6C, 0xED, 0xA9, 0x08, 0xBD, 0xC0, 0x6D, 0x9F, 0xDC,
+    0x56, 0x71, 0x07, 0x75, 0xC5, 0x46, 0xB9, 0xCF, 0x50, 0x8B, 0x8D, 0xF2, 0xFF, 0xCD, 0x3C, 0x64,
+    0x73, 0xD8, 0xB4, 0xD9, 0x4E, 0xB7, 0x63, 0x26, 0xF5, 0xCC, 0xD2, 0x53, 0xA3, 0x1C, 0x4B, 0x05,
+    0x6B, 0xFB, 0xE0, 0xF2, 0xDA, 0x87, 0x6E, 0x71, 0xEA, 0xDF, 0x4C, 0xCA, 0x2D, 0xC4, 0x7E, 0x67,
+    0x02, 0x57, 0x93, 0xFC, 0x85, 0x28, 0xDF, 0x87, 0x3A, 0xB9, 0x73, 0x47, 0x77, 0x0F, 0x95, 0xAB,
+    0x87, 0xE8, 0xB8, 0x2F, 0x0B, 0xF7, 0x81, 0x3B, 0xC0, 0x47, 0xE5, 0xF8, 0xD8, 0xCD, 0xAA, 0x98,
+    0xD4, 0x16, 0xA9, 0xDF, 0x24, 0x17, 0x55, 0x11, 0xD4, 0xB2, 0x37, 0xFF, 0xC7, 0x3F, 0x66, 0xC9,
+    0xAD, 0xAA, 0x8E, 0x2F, 0xEE, 0x62, 0x36, 0x7C, 0xDD, 0xF4, 0x8B, 0x3F, 0x98, 0x61, 0xF1, 0x41,
+    0xC3, 0xEC, 0x83, 0xEC, 0x43, 0xE3, 0x83, 0x0F, 0x22, 0xB8, 0xD0, 0x30, 0xBA, 0xF0, 0x1A, 0xEF,
+    0xFA, 0xDB, 0x0E, 0xC0, 0x9E, 0xB2, 0xE1, 0x3C, 0x00, 0xA9, 0x8F, 0xEA, 0x92, 0x89, 0x32, 0xDB,
+    0xD9, 0x4B, 0x3A, 0xFB, 0x63, 0x3D, 0x7B, 0x5F, 0x1A, 0xF6, 0x2D, 0x9E, 0xD1, 0xAE, 0x7D, 0xEC,
+    0xA3, 0xB2, 0x79, 0x70, 0xCC, 0xB5, 0x43, 0xF3, 0xC9, 0x0E, 0x38, 0xBA, 0xFF, 0xAA, 0xDA, 0x74,
+    0xE8, 0x3B, 0x36, 0xAB, 0xEB, 0x80, 0xC0, 0x3E, 0x25, 0x49, 0x50, 0x74, 0x86, 0x4F, 0xA4, 0xE3,
+    0x8B, 0xCF, 0x1C, 0xEB, 0xF5, 0x4B, 0xEA, 0xA8, 0x88, 0x26, 0x4B, 0x76, 0xEB, 0x69, 0x08, 0xAA,
+    0x98, 0x89, 0x2E, 0x4A, 0x1D, 0x06, 0x93, 0x25, 0xD9, 0x8D, 0x5B, 0x4C, 0x52, 0xC5, 0xF5, 0xE2,
+    0xA2, 0xA4, 0x0E, 0xFF, 0x69, 0x3E, 0x55, 0xF6, 0xD3, 0xDE, 0x9E, 0x77, 0x89, 0xDE, 0xC1, 0x5E,
+    0xEB, 0xEC, 0x23, 0x5D, 0xBF, 0xE9, 0x70, 0xC5, 0xB2, 0xB7, 0xF3, 0xBD, 0xEC, 0x0E, 0x00, 0xE3,
+    0x41, 0xC3, 0x17, 0xA9, 0xA1, 0xF0, 0x15, 0x49, 0x15, 0x9C, 0xE7, 0x3C, 0xAB, 0x3C, 0xBF, 0x60,
+    0xF5, 0xCC, 0x96, 0x75, 0xE0, 0x2D, 0x98, 0xF4, 0x2D, 0xB9, 0x5C, 0x93, 0xFF, 0x42, 0x1F, 0x48,
+    0x51, 0x6D, 0x78, 0xC6, 0x8B, 0xD8, 0xB0, 0xA8, 0x9F, 0xD5, 0xFF, 0x60, 0x2C, 0x03, 0x2B, 0x9C,
+    0x50, 0xCE, 0x70, 0xD1, 0x4D, 0x15, 0x2F, 0x6E, 0xB2, 0x9B, 0x9B, 0x3A, 0x2E, 0x6C, 0x15, 0x9B,
+    0x9B, 0x2C, 0x17, 0xB6, 0x8E, 0xCD, 0x4D, 0x70, 0x61, 0xB3, 0x5F, 0x6E, 0xEE, 0x7A, 0x76, 0x17,
+    0x12, 0x27, 0xC9, 0x11, 0xDD, 0x09, 0xA5, 0x4B, 0x8E, 0xE0, 0x4F, 0x88, 0x5D, 0x72, 0x45, 0xFE,
+    0x84, 0x60, 0x92, 0x5B, 0xC5, 0x7F, 0x1D, 0xEB, 0xEC, 0x4F, 0x76, 0x59, 0xDD, 0xAE, 0xC3, 0xED,
+    0xA3, 0x38, 0xC0, 0x62, 0x20, 0x34, 0x14, 0xE9, 0xF5, 0x7F, 0x7E, 0xA2, 0x82, 0x36, 0x41, 0x32,
+    0x73, 0xBB, 0x99, 0xD9, 0x6C, 0xDD, 0xDC, 0x6F, 0xDD, 0x6C, 0x53, 0xB7, 0xD8, 0xD4, 0x2D, 0x3E,
+    0xB5, 0x4B, 0x49, 0xED, 0xBD, 0x07, 0xA9, 0xFD, 0xEC, 0x5E, 0x6A, 0xBF, 0xBA, 0x95, 0x5B, 0xAE,
+    0xE5, 0x86, 0x6B, 0xB9, 0xE1, 0x85, 0xD2, 0xD0, 0x94, 0x26, 0x37, 0xB4, 0xEB, 0x10, 0xEB, 0x64,
+    0x56, 0x79, 0xB3, 0xC9, 0x5E, 0x4F, 0x32, 0x9F, 0x65, 0x35, 0x5F, 0x15, 0x09, 0x76, 0x4E, 0xD4,
+    0x33, 0xAA, 0x63, 0x56, 0x4D, 0xD9, 0x95, 0xAE, 0xFD, 0x88, 0xD1, 0x44, 0xB6, 0x26, 0x19, 0xAE,
+    0x52, 0x91, 0x6B, 0x08, 0x9E, 0x38, 0x90, 0xBA, 0xE8, 0xEA, 0xD4, 0x07, 0xDF, 0xC6, 0xE1, 0xCD,
+    0xD4, 0x2D, 0xBE, 0xD9, 0x86, 0x90, 0xBB, 0x68, 0x9F, 0x4F, 0x66, 0xF6, 0x4D, 0x1C, 0x4E, 0x52,
+    0xF7, 0x19, 0x4D, 0x42, 0x5E, 0x3B, 0x6D, 0xB1, 0x33, 0xA1, 0xE2, 0x05, 0x46, 0x93, 0x0D, 0xB2,
+    0xAB, 0x4D, 0x35, 0x0B, 0x9B, 0xE1, 0x6D, 0xA2, 0x2B, 0x86, 0x1B, 0x6C, 0xCE, 0xFF, 0xEC, 0xD3,
+    0x8F, 0x33, 0xB8, 0x0B, 0x5F, 0x90, 0xE9, 0x6F, 0x72, 0x27, 0xB9, 0x77, 0x38, 0x7F, 0xB7, 0x0C,
+    0xC9, 0x9F, 0x6C, 0xF6, 0x1E, 0x43, 0xE4, 0xA5, 0xE4, 0xAF, 0x26, 0x7B, 0x0F, 0x89, 0xF0, 0xCC,
+    0xA4, 0xE7, 0x5E, 0x48, 0x6A, 0x37, 0x3B, 0xCB, 0x5D, 0xCB, 0x6A, 0xD3, 0x1F, 0x82, 0xA2, 0x2E,
+    0xD9, 0x45, 0x7E, 0x07, 0xFB, 0xD6, 0x22, 0x0F, 0x41, 0xB6, 0x0F, 0x8E, 0xB9, 0xC1, 0x2E, 0xD1,
+    0xB8, 0x89, 0x4C, 0xD6, 0xB3, 0x59, 0x72, 0xAC, 0x72, 0x30, 0xDA, 0xE2, 0xE3, 0xB0, 0xB6, 0xC5,
+    0x6C, 0x72, 0xD7, 0x92, 0xCC, 0xE7, 0xA8, 0x29, 0x2E, 0xC8, 0x5F, 0x8E, 0x1A, 0xEE, 0x24, 0x99,
+    0xFB, 0x8C, 0x4D, 0xB1, 0xB1, 0xE1, 0xE5, 0x43, 0x93, 0x58, 0x2C, 0xC4, 0x16, 0x56, 0x39, 0x56,
+    0x55, 0xBB, 0xC0, 0xE7, 0x3C, 0x70, 0x13, 0xF8, 0x9C, 0x77, 0xBF, 0x97, 0x5D, 0x10, 0xE7, 0xA3,
+    0xEC, 0xC3, 0xFB, 0xDD, 0x2C, 0x7E, 0xB4, 0xCA, 0xDE, 0xC9, 0x4F, 0x76, 0xB4, 0xB8, 0xB9, 0xE2,
+    0xD7, 0x3F, 0xD6, 0x73, 0x97, 0xA4, 0x67, 0x46, 0x0D, 0x77, 0xF6, 0xC7, 0x5B, 0x2B, 0x20, 0xB6,
+    0x2C, 0x66, 0x31, 0xC8, 0x04, 0xBB, 0x69, 0x98, 0x98, 0x75, 0xA5, 0x61, 0xAC, 0x92, 0xC9, 0x6A,
+    0xE3, 0xEE, 0x5A, 0xAB, 0xD2, 0xC0, 0xA3, 0x8D, 0xEA, 0x5C, 0x03, 0xD1, 0x14, 0x8A, 0x6C, 0xFC,
+    0xB7, 0xA9, 0x62, 0x3A, 0x90, 0xC9, 0xE1, 0xA1, 0x18, 0xE0, 0x54, 0x9B, 0xF8, 0xF8, 0x07, 0x19,
+    0x78, 0x74, 0x5F, 0x3D, 0x5B, 0xB5, 0xE7, 0xEA, 0xE4, 0x67, 0x35, 0x59, 0xEA, 0xF7, 0x6D, 0xDE,
+    0x9A, 0x9D, 0x27, 0xF5, 0xEB, 0xAE, 0x68, 0x58, 0xFE, 0xA1, 0x86, 0xB5, 0xD9, 0xA5, 0x55, 0x94,
+    0xBF, 0x2F, 0x77, 0x98, 0x88, 0xEC, 0x80, 0x9B, 0x0F, 0xDC, 0xAF, 0xB3, 0x9A, 0x24, 0xC9, 0x06,
+    0xED, 0xC0, 0x85, 0xC3, 0x3E, 0x91, 0x9B, 0xBF, 0x0E, 0xFC, 0x2C, 0x75, 0x45, 0x92, 0x5F, 0x0E,
+    0xE0, 0xF5, 0x8B, 0xFB, 0x16, 0x29, 0x41, 0xEE, 0x2A, 0x53, 0x5D, 0x1A, 0x64, 0xD6, 0x06, 0xB9,
+    0xD0, 0xE5, 0xBA, 0xC8, 0x24, 0xB3, 0x6A, 0xD8, 0x5C, 0x90, 0xBD, 0x57, 0x24, 0xBF, 0xEF, 0xE5,
+    0x85, 0x3D, 0xB9, 0x1B, 0x56, 0xA9, 0x23, 0x48, 0xE6, 0x54, 0xF9, 0xC8, 0x07, 0xA9, 0x2D, 0xBB,
+    0xC4, 0x6A, 0xF6, 0xB2, 0x9B, 0x25, 0xCB, 0x22, 0xED, 0xB7, 0x4C, 0x8F, 0x96, 0xE2, 0x74, 0xBA,
+    0x20, 0x75, 0x04, 0x9B, 0x5A, 0x80, 0xC9, 0x00, 0x2C, 0x36, 0xF6, 0xF3, 0xB0, 0xDA, 0xD0, 0x2F,
+    0xDD, 0xE6, 0xC6, 0x7E, 0x69, 0x93, 0x1F, 0xFB, 0xA5, 0x79, 0xCC, 0xB6, 0xC9, 0x85, 0x7E, 0x31,
+    0xC9, 0xAE, 0xFD, 0x62, 0xB7, 0x01, 0x20, 0xEE, 0xF7, 0x36, 0x7B, 0x05, 0x3B, 0x82, 0x4F, 0x24,
+    0xF5, 0xB3, 0x24, 0xF5, 0xCB, 0x23, 0x3B, 0x7C, 0xC3, 0x1E, 0x28, 0x69, 0x97, 0x2A, 0xC6, 0x36,
+    0x6B, 0x88, 0x4D, 0x51, 0x53, 0x1A, 0x24, 0xF7, 0x8B, 0x7D, 0xFF, 0x6A, 0x3A, 0x28, 0x9D, 0x7E,
+    0x97, 0xCC, 0xCB, 0xA9, 0xB4, 0xF4, 0x68, 0x57, 0x79, 0xB2, 0x20, 0xD9, 0xC4, 0x22, 0x9B, 0xFA,
+    0xA2, 0x21, 0xD7, 0xCC, 0x7D, 0x91, 0x4D, 0x67, 0x8F, 0x75, 0xE6, 0x78, 0x74, 0x73, 0x5D, 0x2A,
+    0xD4, 0x6D, 0x6D, 0xD2, 0xB0, 0xF4, 0x51, 0x7E, 0x72, 0xA1, 0xDE, 0x15, 0x4C, 0x93, 0xD4, 0x47,
+    0x13, 0xE5, 0x82, 0x0D, 0x15, 0x7A, 0xDC, 0x75, 0xAA, 0x86, 0xFE, 0xF5, 0xFD, 0x9D, 0x4B, 0x99,
+    0xD3, 0xB5, 0x17, 0xF7, 0xFF, 0x16, 0x76, 0xCD, 0x69, 0xD6, 0x43, 0xDC, 0x75, 0x4E, 0x7F, 0xAD,
+    0x4B, 0x6B, 0x73, 0x23, 0x98, 0x97, 0xF5, 0x9D, 0x7F, 0xD4, 0xFD, 0xA5, 0xBD, 0x33, 0x0D, 0x3F,
+    0x7A, 0xB3, 0x58, 0x36, 0xCF, 0xE2, 0xDF, 0x99, 0xF4, 0x1D, 0x29, 0xA9, 0x89, 0x32, 0xE1, 0xFF,
+    0xA4, 0x4E, 0xEC, 0x49, 0x7E, 0x5C, 0x92, 0x3C, 0x49, 0x87, 0x94, 0xEF, 0x95, 0xEF, 0xFD, 0x31,
+    0x1D, 0x32, 0x3F, 0x3D, 0x3E, 0x51, 0x7B, 0x7C, 0xCD, 0xDA, 0x53, 0x7B, 0xAA, 0x37, 0x9E, 0xAC,
+    0x31, 0x6E, 0xBB, 0xDB, 0xEE, 0x77, 0x8F, 0xE9, 0x8A, 0x83, 0xBA, 0x78, 0xA4, 0x31, 0xCC, 0x63,
+    0xB6, 0xDF, 0x24, 0x69, 0xD8, 0xED, 0xEA, 0x91, 0x06, 0x82, 0xCE, 0xBC, 0x1F, 0x25, 0x7D, 0x20,
+    0x69, 0x38, 0x24, 0x5F, 0xC3, 0x7D, 0x09, 0x16, 0xD9, 0xF7, 0xB3, 0x4C, 0xB0, 0xA1, 0x89, 0x6D,
+    0x54, 0xAA, 0x92, 0x6C, 0xB5, 0xD3, 0x9A, 0x06, 0x82, 0xD8, 0x45, 0xC2, 0x39, 0x49, 0x1A, 0x66,
+    0x49, 0xDD, 0x17, 0x97, 0xA4, 0x2A, 0xFF, 0x87, 0x24, 0xF7, 0xB7, 0x92, 0xFA, 0xEB, 0x41, 0x6A,
+    0x3F, 0x8B, 0x52, 0x95, 0x92, 0x24, 0x67, 0xDF, 0x1B, 0xD5, 0xFF, 0x8C, 0xAC, 0xF6, 0x4B, 0x08,
+    0x55, 0x4E, 0xED, 0x26, 0xE7, 0xE4, 0xD5, 0x7F, 0x1A, 0xFA, 0xD0, 0x7E, 0x15, 0xFB, 0xA5, 0x2E,
+    0xB0, 0xCA, 0xFB, 0x9D, 0x41, 0x7E, 0x22, 0x93, 0xBE, 0x25, 0x7D, 0xF0, 0x87, 0xEF, 0x24, 0x51,
+    0x46, 0x88, 0xE5, 0xF2, 0x9A, 0x9A, 0x94, 0xAA, 0x94, 0xAA, 0x94, 0xDA, 0x04, 0x1B, 0x44, 0x18,
+    0xCF, 0x70, 0xB1, 0x82, 0xB5, 0xFD, 0xE5, 0xD1, 0xFA, 0x97, 0x32, 0x71, 0x4F, 0x73, 0x1B, 0x24,
+    0x3F, 0x7A, 0x72, 0x0D, 0xEB, 0xFE, 0xC4, 0xFC, 0x95, 0xCC, 0xE6, 0xFE, 0x87, 0x0F, 0x21, 0xB7,
+    0x30, 0x57, 0xFE, 0x13, 0x49, 0x7F, 0xB3, 0x29, 0xB5, 0xE4, 0x26, 0x5A, 0x92, 0x79, 0xBB, 0xBC,
+    0xB6, 0x7D, 0xC7, 0x2C, 0x6D, 0xDC, 0x9C, 0xCC, 0x8D, 0x7B, 0x9B, 0x86, 0x97, 0x99, 0x75, 0xC5,
+    0x32, 0x56, 0x1B, 0x59, 0xED, 0x2D, 0x56, 0x0D, 0xEF, 0x7C, 0x1A, 0x95, 0xBF, 0x3D, 0x2C, 0xDD,
+    0xBA, 0xBA, 0x07, 0x5C, 0x9B, 0xA1, 0x98, 0xE7, 0x21, 0x7E, 0xBB, 0x86, 0x71, 0x95, 0x5F, 0x24,
+    0x3D, 0xFD, 0xAA, 0x5A, 0x98, 0x5A, 0x58, 0x9A, 0xB5, 0x4E, 0x75, 0x92, 0xD7, 0x15, 0x0D, 0xC1,
+    0x4E, 0x5D, 0x34, 0xB1, 0x4E, 0x15, 0xEF, 0x22, 0xBB, 0xFF, 0x95, 0xB7, 0xD6, 0x90, 0x2B, 0x5A,
+    0x46, 0x46, 0xB7, 0xB8, 0x79, 0xD8, 0x86, 0xB5, 0x2B, 0x26, 0xD7, 0x5C, 0x60, 0xE4, 0x33, 0x16,
+    0x9B, 0x24, 0xA9, 0x49, 0x26, 0x8A, 0x17, 0xB2, 0xEC, 0xC2, 0xD8, 0x6F, 0x6E, 0x69, 0x19, 0x52,
+    0x75, 0xFC, 0x83, 0xE3, 0x3F, 0xB1, 0x5F, 0xFE, 0xFF, 0xC9, 0xCC, 0xFE, 0x17, 0xDD, 0xBD, 0x4F,
+    0x8C, 0x25, 0xD7, 0x95, 0xE6, 0xF7, 0x8B, 0xB8, 0xAA, 0x0A, 0x83, 0x81, 0xC1, 0xE5, 0xA2, 0x4B,
+    0x1E, 0x93, 0x46, 0xC7, 0xC6, 0x0B, 0x9B, 0xE8, 0x51, 0x78, 0xE1, 0xC5, 0xC0, 0xE8, 0xAE, 0x1B,
+    0x24, 0x31, 0xE0, 0x82, 0x0B, 0xA6, 0x81, 0x4A, 0xD9, 0x90, 0x16, 0x1C, 0x03, 0xBD, 0x98, 0xE1,
+    0x8C, 0x51, 0x1B, 0x2F, 0x7A, 0x21, 0x32, 0x42, 0xAC, 0x05, 0x17, 0xBD, 0x50, 0xC1, 0x90, 0x3C,
+    0x30, 0xBC, 0x10, 0x0D, 0x50, 0x06, 0x99, 0x5C, 0x54, 0xC3, 0xF0, 0xA2, 0x31, 0x2E, 0x31, 0x82,
+    0x4C, 0xB8, 0x0B, 0xB0, 0x16, 0x8C, 0x26, 0xA1, 0xE1, 0x42, 0x0B, 0x85, 0x44, 0xCA, 0xF2, 0x48,
+    0x8B, 0xBA, 0xC5, 0x0E, 0x4A, 0x91, 0xC5, 0x1B, 0xF1, 0x79, 0x71, 0xEF, 0x7B, 0x99, 0x59, 0x7F,
+    0x48, 0xF6, 0x58, 0xDD, 0x43, 0x39, 0x32, 0x5F, 0xBC, 0xFB, 0xDE, 0xCB, 0x17, 0x11, 0xF7, 0xDC,
+    0x13, 0xF7, 0x9E, 0xF3, 0x9D, 0xEF, 0x9C, 0x6C, 0xF5, 0xBC, 0x8E, 0xE5, 0x15, 0x6A, 0x95, 0xFA,
+    0xB6, 0x26, 0x37, 0x73, 0x7E, 0x6B, 0xF8, 0x0B, 0x42, 0x26, 0x34, 0xD4, 0xBE, 0x0C, 0x99, 0x68,
+    0x87, 0xCA, 0x9B, 0x80, 0x70, 0x83, 0x8D, 0x8D, 0x7A, 0x2C, 0xE7, 0x6C, 0xA5, 0xA5, 0xC2, 0x00,
+    0x90, 0x7B, 0x28, 0x07, 0xA8, 0x81, 0x9B, 0xF1, 0xE5, 0xD5, 0x13, 0x2A, 0x2D, 0x99, 0x34, 0x59,
+    0xA9, 0xEB, 0xDF, 0xED, 0xCC, 0x7A, 0x19, 0xEB, 0x17, 0xDA, 0xE3, 0x29, 0x93, 0xED, 0x8A, 0x70,
+    0x99, 0x6A, 0x5E, 0x70, 0x1F, 0x4E, 0xE8, 0xF6, 0x6B, 0x99, 0x34, 0x1B, 0x69, 0xCE, 0x25, 0x9F,
+    0xF5, 0x27, 0xF0, 0x27, 0xC0, 0x0C, 0x66, 0x04, 0xDB, 0xC0, 0x1F, 0x9C, 0xBD, 0xC4, 0x4C, 0x0B,
+    0x38, 0xAD, 0x18, 0x69, 0xA3, 0x9E, 0x1F, 0x5F, 0x11, 0x79, 0x93, 0x2F, 0x40, 0xE9, 0x01, 0x3B,
+    0x00, 0xAE, 0x03, 0x7A, 0x20, 0x5B, 0xC1, 0x48, 0xF2, 0x56, 0xD2, 0xE0, 0x24, 0x81, 0x1B, 0x00,
+    0x01, 0x26, 0x00, 0xB5, 0x87, 0x42, 0x03, 0x99, 0xB6, 0x86, 0x42, 0xD2, 0xAB, 0x95, 0xA4, 0xA9,
+    0x95, 0xF4, 0xD7, 0x92, 0x34, 0x00, 0xF0, 0x15, 0x0A, 0xCC, 0x98, 0x05, 0xD4, 0xCB, 0x3B, 0x49,
+    0x4F, 0x4A, 0x9A, 0x0A, 0xF5, 0x81, 0x76, 0xE8, 0x87, 0x72, 0x31, 0x01, 0x75, 0x6E, 0x2C, 0x57,
+    0x1B, 0x68, 0xA5, 0xC1, 0x4A, 0x9B, 0x91, 0xB4, 0xB4, 0x92, 0xDE, 0xD9, 0xFA, 0xDB, 0xBE, 0xEC,
+    0xF8, 0x63, 0x1E, 0x05, 0x2E, 0x1D, 0xC0, 0xA5, 0xA7, 0xD4, 0x51, 0x05, 0xBB, 0x62, 0x84, 0x9B,
+    0xD1, 0x98, 0x69, 0x74, 0x0B, 0x56, 0xCF, 0x09, 0x9C, 0x34, 0x90, 0x49, 0x33, 0x94, 0xDA, 0x00,
+    0xA7, 0x01, 0x90, 0x07, 0x4A, 0x05, 0xE8, 0xA5, 0x11, 0x2B, 0x6D, 0xE4, 0x92, 0x3C, 0x4F, 0xDC,
+    0xD8, 0x00, 0x34, 0x01, 0x76, 0x03, 0x5E, 0x90, 0x06, 0xAC, 0xB4, 0x92, 0x49, 0xF2, 0xC4, 0x9E,
+    0xA3, 0x11, 0xB0, 0x2B, 0xBB, 0xE6, 0x23, 0xAF, 0xC3, 0xE3, 0xCE, 0x39, 0xE7, 0x2E, 0x5F, 0x7E,
+    0xE9, 0x51, 0x80, 0x3F, 0xFC, 0x61, 0xDC, 0x6E, 0xDE, 0x0C, 0x0D, 0xE5, 0x06, 0xAD, 0x46, 0xA4,
+    0x39, 0x5F, 0x9F, 0x99, 0xF3, 0x19, 0x6F, 0x16, 0x0E, 0x72, 0x5D, 0x07, 0xA9, 0x41, 0xF2, 0x46,
+    0x5A, 0xCA, 0xF5, 0x9B, 0xC1, 0xFA, 0x7C, 0xB5, 0x53, 0xBE, 0x5A, 0xDD, 0x5E, 0x4B, 0x29, 0x18,
+    0x69, 0xC9, 0x24, 0x4F, 0x2D, 0x0F, 0x6D, 0x80, 0x22, 0xE4, 0x4D, 0xBE, 0x96, 0x73, 0x11, 0x2A,
+    0x69, 0x71, 0x92, 0xAF, 0xA4, 0x86, 0x4B, 0x50, 0xF9, 0xCA, 0xF7, 0x63, 0xFF, 0x9E, 0x9E, 0xD2,
+    0x73, 0x9B, 0xDD, 0xDC, 0xE2, 0x16, 0xDD, 0xD1, 0x9D, 0xC3, 0x27, 0x0F, 0x1B, 0xFA, 0xEB, 0x38,
+    0x75, 0xF6, 0xEE, 0x96, 0xCF, 0x66, 0xBE, 0xEC, 0x9E, 0xBB, 0xF5, 0x2E, 0x37, 0xBF, 0x35, 0x15,
+    0xB7, 0x7E, 0x7A, 0x70, 0xD3, 0xD5, 0xDF, 0x7F, 0x79, 0x2D, 0xBC, 0xD5, 0x4A, 0xAD, 0x86, 0xFF,
+    0x08, 0x00, 0xF7, 0xBF, 0x5B, 0x3D, 0x35, 0x2E, 0x7F, 0x5C, 0x5E, 0xEB, 0xBE, 0xF5, 0x8F, 0x8B,
+    0x63, 0x85, 0x4A, 0x43, 0xFB, 0xCF, 0xDA, 0x37, 0x0E, 0x68, 0xA5, 0xB0, 0x7B, 0x5C, 0xFA, 0xFA,
+    0x8D, 0x00, 0xC5, 0xBD, 0x8F, 0x15, 0xE0, 0xF0, 0xF0, 0xF0, 0x4A, 0x2F, 0x85, 0xDD, 0xE3, 0xCC,
+    0x25, 0xE8, 0x37, 0xF3, 0xE5, 0xFF, 0xF6, 0xDD, 0x57, 0xFE, 0xCD, 0x7F, 0x7C, 0xF3, 0x5B, 0xFD,
+    0x33, 0xB7, 0x7E, 0xF4, 0x97, 0x37, 0x2F, 0xFF, 0x6F, 0xEF, 0xBE, 0xAC, 0x7A, 0xB6, 0x9F, 0x6E,
+    0xB4, 0xEA, 0xB8, 0x71, 0x1D, 0x20, 0x3F, 0xD2, 0x35, 0xE9, 0x8E, 0xB4, 0x02, 0x70, 0x01, 0x2A,
+    0x51, 0x6A, 0xCD, 0x24, 0xEF, 0xA6, 0xFE, 0x95, 0x60, 0x42, 0xDB, 0xB9, 0x5B, 0xC1, 0x04, 0x77,
+    0x57, 0xD7, 0xA4, 0xD9, 0xEA, 0xF4, 0xEB, 0x17, 0x5F, 0x83, 0x72, 0x3E, 0xF7, 0x68, 0xA5, 0x6D,
+    0xF7, 0xB8, 0xF7, 0x33, 0xB2, 0x03, 0xE0, 0xF0, 0x9F, 0x56, 0xD2, 0xEC, 0x76, 0x17, 0x0C, 0x3C,
+    0xDE, 0xF5, 0xF3, 0xAB, 0x7F, 0xC9, 0x1F, 0xF3, 0xAD, 0x6C, 0x2E, 0x27, 0x37, 0xF4, 0xA1, 0x0F,
+    0xF0, 0xD5, 0xEB, 0x6E, 0x79, 0xF4, 0x8F, 0xF8, 0x47, 0xE5, 0x62, 0x17, 0x5E, 0x7C, 0xF4, 0x6B,
+    0x6E, 0xED, 0x43, 0x3B, 0x83, 0x1D, 0xDE, 0x32, 0x73, 0x3D, 0x6C, 0xE5, 0x8C, 0x1B, 0x70, 0xC7,
+    0x2B, 0x45, 0x70, 0x23, 0xED, 0xF1, 0x46, 0x11, 0xDC, 0x94, 0x1A, 0xED, 0x44, 0x7B, 0x4B, 0x94,
+    0xA1, 0xF5, 0xF4, 0xB7, 0x84, 0x0D, 0xED, 0x8C, 0x3E, 0xD0, 0x58, 0xAF, 0xAD, 0xA4, 0x9F, 0x48,
+    0x5A, 0xFB, 0xB3, 0x8D, 0x5F, 0xDF, 0xE9, 0x47, 0x7A, 0xC0, 0xFA, 0x74, 0xC7, 0xC5, 0xAD, 0xF7,
+    0x42, 0xC1, 0x0D, 0x92, 0xF5, 0xBD, 0x8E, 0x83, 0x93, 0x97, 0x55, 0x70, 0xC7, 0xDA, 0xAC, 0xEF,
+    0x75, 0x2D, 0x54, 0x9A, 0x94, 0x6B, 0x71, 0x43, 0xB5, 0x96, 0xDE, 0xE8, 0xA9, 0x80, 0xC6, 0x1E,
+    0xE7, 0xEB, 0xA1, 0x0A, 0xA5, 0x2F, 0x95, 0x07, 0xA3, 0xA1, 0x47, 0xBE, 0x1E, 0x5C, 0x28, 0x7D,
+    0xA5, 0x7C, 0x2D, 0xD5, 0xF5, 0x4F, 0x6B, 0xAA, 0x47, 0x2D, 0xE5, 0xEC, 0xB6, 0x6C, 0xAD, 0xD4,
+    0xB4, 0x4D, 0xE5, 0xFB, 0xF7, 0xF4, 0xDC, 0xE6, 0x16, 0xDD, 0x39, 0x6C, 0x6C, 0x53, 0xE1, 0x70,
+    0xBE, 0x5D, 0x1E, 0x0D, 0x2E, 0xB4, 0x73, 0x3F, 0xC2, 0x8B, 0x66, 0x7E, 0x6C, 0x2C, 0x9B, 0x7F,
+    0xC4, 0x6C, 0x46, 0xFB, 0xB4, 0x6E, 0xEB, 0x7B, 0x57, 0xF2, 0x15, 0xCD, 0x5F, 0x2B, 0x8E, 0xC7,
+    0x3F, 0xFE, 0x13, 0xF3, 0xFE, 0xF4, 0xAD, 0x5A, 0x83, 0xE6, 0x7C, 0x05, 0xB8, 0x02, 0x40, 0xE5,
+    0x01, 0xD0, 0x00, 0xD5, 0x68, 0x04, 0x6C, 0xFC, 0xC3, 0x00, 0xA5, 0xC7, 0x78, 0x70, 0x1D, 0x76,
+    0xC0, 0x04, 0x70, 0x50, 0x8D, 0x10, 0x40, 0x60, 0x3C, 0xE5, 0x0C, 0xD5, 0x40, 0x3B, 0x40, 0x8B,
+    0x09, 0x59, 0xE3, 0xE4, 0xEB, 0xA9, 0x6E, 0xA4, 0x41, 0xD9, 0x6A, 0xA4, 0x72, 0xB1, 0x33, 0xD0,
+    0x0E, 0xFD, 0x04, 0x66, 0x2D, 0x7E, 0xDA, 0x41, 0xED, 0xFF, 0xE4, 0x32, 0x20, 0xF3, 0xB3, 0x05,
+    0xEC, 0x52, 0x17, 0x33, 0xB4, 0x6F, 0x4B, 0x0B, 0x66, 0x2B, 0xA5, 0x89, 0xDA, 0x5F, 0xF8, 0x17,
+    0x5B, 0x93, 0xA9, 0xA1, 0xF4, 0xD8, 0x00, 0xF5, 0x40, 0x3B, 0x42, 0x4F, 0xBE, 0x45, 0x71, 0xC7,
+    0xCB, 0xA6, 0x8D, 0x33, 0x99, 0x0D, 0xC0, 0x1B, 0xF1, 0xFA, 0xDD, 0xC0, 0x3F, 0x0C, 0x50, 0xCC,
+    0x71, 0xDA, 0x14, 0x10, 0x0F, 0x80, 0x1D, 0x28, 0x16, 0x76, 0x17, 0x8F, 0x1D, 0xA8, 0x47, 0xC8,
+    0x42, 0x9C, 0x33, 0xAB, 0x81, 0xFE, 0xC9, 0x7F, 0x8E, 0x93, 0xAF, 0xEE, 0x68, 0x35, 0x92, 0x09,
+    0xB5, 0x66, 0x27, 0xDF, 0xBF, 0xFC, 0x51, 0xFD, 0xF6, 0xE1, 0xA1, 0xF5, 0x8F, 0x12, 0xC0, 0xAC,
+    0xF1, 0xB8, 0xED, 0x00, 0x01, 0xEC, 0x0C, 0x6E, 0x20, 0x57, 0x6C, 0xB6, 0x03, 0xC5, 0x06, 0x76,
+    0x21, 0x57, 0x7C, 0x57, 0x1E, 0xDC, 0x48, 0xA5, 0x15, 0x1B, 0xC8, 0xA5, 0x31, 0x53, 0x83, 0xD3,
+    0x86, 0x9B, 0xC8, 0x0E, 0x0F, 0x9B, 0x8B, 0x6A, 0xD8, 0xCF, 0x86, 0xD9, 0x2F, 0xAE, 0x76, 0x54,
+    0x03, 0x54, 0xB0, 0x01, 0xDF, 0xC2, 0x7A, 0x30, 0x9E, 0xB6, 0xA1, 0x12, 0x26, 0x40, 0xBF, 0x52,
+    0x8F, 0x64, 0x6F, 0x86, 0x6C, 0x03, 0xCC, 0x6C, 0x3D, 0x1C, 0xD8, 0xB1, 0xEF, 0x30, 0xD2, 0xD3,
+    0xA1, 0x18, 0x2B, 0x05, 0x37, 0xBA, 0x46, 0xFA, 0xEB, 0xCD, 0xAC, 0x59, 0x7F, 0x62, 0x7D, 0x3D,
+    0x03, 0xFD, 0xB7, 0x7F, 0x3B, 0x41, 0x11, 0xEC, 0x73, 0x1D, 0xB8, 0x71, 0x79, 0x09, 0x72, 0x95,
+    0x6F, 0x2F, 0x50, 0xF9, 0x56, 0x1B, 0xE8, 0x65, 0x69, 0xA1, 0x0C, 0x17, 0x8F, 0x34, 0xE2, 0x46,
+    0xF2, 0x80, 0x11, 0x94, 0x9E, 0x6A, 0x86, 0x7A, 0xA0, 0xEF, 0xA2, 0xB0, 0xD5, 0x40, 0xEF, 0xA1,
+    0x14, 0xD0, 0x7A, 0x28, 0x36, 0xC0, 0x8D, 0x90, 0x5D, 0xE1, 0x41, 0x5B, 0x36, 0xC1, 0xC5, 0x0D,
+    0x32, 0x8D, 0x50, 0xAD, 0x90, 0x69, 0x80, 0x2A, 0x40, 0xAE, 0x01, 0x14, 0x62, 0xF7, 0xAD, 0x46,
+    0x72, 0x8D, 0xE0, 0x7C, 0x9C, 0xBB, 0xE8, 0x07, 0xB0, 0x0B, 0xA0, 0x0E, 0xCA, 0x05, 0xE8, 0xBB,
+    0xF8, 0xD1, 0xE0, 0x46, 0xDA, 0x5C, 0x5D, 0xBB, 0x58, 0x49, 0x9D, 0x93, 0x46, 0x7A, 0x4D, 0xF0,
+    0xC2, 0xF5, 0xDD, 0x59, 0xFF, 0xBB, 0x62, 0x00, 0xDA, 0x69, 0x06, 0xEA, 0xED, 0x45, 0xC0, 0xBE,
+    0x2B, 0xC0, 0xDC, 0xD1, 0x00, 0x84, 0x6A, 0x78, 0xE0, 0xC5, 0x62, 0xD6, 0xB8, 0x26, 0x0F, 0xEC,
+    0x96, 0x27, 0xDC, 0x06, 0x50, 0x6B, 0x00, 0xAC, 0x66, 0xA0, 0xD8, 0x04, 0x98, 0x2D, 0xAE, 0xBB,
+    0xCF, 0x2D, 0x40, 0xFF, 0x8E, 0x00, 0x37, 0xB5, 0x23, 0x54, 0xB3, 0x0D, 0x60, 0x43, 0x2E, 0x30,
+    0xA2, 0x9D, 0xC8, 0xD5, 0xD8, 0x00, 0xFA, 0xC5, 0x7F, 0xAD, 0x86, 0x56, 0xD2, 0x44, 0x2D, 0x29,
+    0x60, 0x25, 0xA9, 0x2B, 0xA5, 0xB8, 0xF0, 0x48, 0x6B, 0xA6, 0x09, 0xA3, 0xAE, 0xF7, 0x20, 0xEF,
+    0x02, 0xD4, 0x6B, 0xB5, 0xC5, 0x05, 0x9D, 0x62, 0x02, 0x28, 0x04, 0x60, 0x3E, 0x9D, 0x00, 0x4E,
+    0x16, 0x00, 0xB7, 0x9E, 0x7E, 0xC0, 0x4B, 0x3C, 0x64, 0x8B, 0xBA, 0xD6, 0xC6, 0x4E, 0x85, 0x38,
+    0x9A, 0x1D, 0x50, 0xCA, 0x03, 0x46, 0x2B, 0x90, 0xA9, 0x1F, 0x00, 0x7D, 0xC7, 0x03, 0xEE, 0xFD,
+    0x0D, 0xA8, 0x7D, 0x1C, 0x89, 0x6A, 0x86, 0x62, 0x35, 0xB1, 0x53, 0xFD, 0x00, 0x1A, 0xAA, 0x05,
+    0xFA, 0xD1, 0x08, 0xDC, 0xC9, 0xA1, 0x46, 0x2A, 0x49, 0x0B, 0xA5, 0x24, 0x61, 0x24, 0x69, 0xCA,
+    0x25, 0x29, 0x20, 0x49, 0x6A, 0xDA, 0x05, 0x34, 0xD5, 0x01, 0x5C, 0xB0, 0x82, 0x52, 0xCF, 0xA8,
+    0x23, 0x93, 0x07, 0x2E, 0xFC, 0x57, 0x47, 0x47, 0x0A, 0x40, 0xFD, 0x37, 0x92, 0x16, 0xA0, 0xFD,
+    0xAD, 0xA4, 0x19, 0xD0, 0xA7, 0x92, 0x3C, 0x64, 0x92, 0x7E, 0x70, 0x00, 0xD1, 0x52, 0x8A, 0x3D,
+    0x4E, 0x0D, 0xFB, 0xDB, 0xD4, 0xA8, 0x3F, 0x4E, 0x0D, 0xF7, 0x9E, 0xB6, 0xC3, 0xFF, 0x06, 0xE8,
+    0xDF, 0x56, 0x5C, 0xB8, 0xD4, 0xC4, 0x86, 0x11, 0xB1, 0x51, 0x6C, 0xA9, 0x61, 0x03, 0xFD, 0x06,
+    0x50, 0x2D, 0xB4, 0x5B, 0xBC, 0x21, 0xD3, 0x91, 0xFB, 0x5D, 0x43, 0x92, 0x74, 0x78, 0x78, 0x90,
+    0x2B, 0x6E, 0x71, 0xB8, 0x24, 0xCD, 0xA5, 0x0E, 0x0F, 0x5B, 0x49, 0x4B, 0xB5, 0x11, 0x87, 0xD5,
+    0x05, 0xA8, 0x24, 0x85, 0x76, 0x89, 0x8D, 0xF5, 0x74, 0x10, 0x2A, 0xE9, 0x23, 0xA0, 0x95, 0xB6,
+    0x86, 0x4C, 0x92, 0x3A, 0x8A, 0x68, 0x96, 0x55, 0xF1, 0xA9, 0xF5, 0xB4, 0x6A, 0x32, 0x0D, 0x54,
+    0xA2, 0x10, 0xD8, 0x40, 0x15, 0xA0, 0x9A, 0x69, 0x3D, 0xB8, 0x29, 0xD3, 0x00, 0xFA, 0x3F, 0xBF,
+    0xA9, 0xC3, 0x26, 0x97, 0x93, 0x36, 0xCA, 0x20, 0x69, 0xC1, 0xFD, 0x8D, 0xA4, 0x09, 0x0D, 0x85,
+    0xA0, 0xD8, 0xA8, 0x02, 0xB4, 0x0B, 0xAD, 0xCF, 0xAE, 0x6A, 0xCC, 0x24, 0x49, 0xF1, 0x5C, 0x21,
+    0x9E, 0x6B, 0xA4, 0x95, 0xA4, 0x78, 0x19, 0x9E, 0x22, 0xF6, 0xB5, 0x92, 0xEE, 0x36, 0xC0, 0xD7,
+    0xCC, 0x08, 0x38, 0xBF, 0x00, 0x95, 0x2E, 0x03, 0xE5, 0xBB, 0x6A, 0x20, 0xF7, 0xF1, 0x16, 0x2A,
+    0xC7, 0x07, 0xAB, 0xD9, 0xE3, 0xBA, 0x1E, 0x3B, 0xD8, 0x40, 0x5C, 0xBD, 0x7B, 0x49, 0x03, 0xFD,
+    0x9A, 0x69, 0xA1, 0x5D, 0x28, 0xD5, 0xD4, 0x01, 0x7A, 0x6F, 0x03, 0xD8, 0xB5, 0x14, 0xE4, 0xBA,
+    0xA6, 0x06, 0x5A, 0xAF, 0x01, 0x6C, 0x70, 0x1E, 0x8C, 0x6C, 0x00, 0xF4, 0x81, 0x00, 0xF7, 0x89,
+    0x06, 0xB0, 0x6B, 0xFC, 0xE0, 0xB9, 0x00, 0xE8, 0x58, 0x03, 0xF4, 0x5E, 0x0B, 0xB4, 0xC1, 0xE9,
+    0x17, 0x5F, 0x95, 0x4A, 0x49, 0x52, 0x27, 0x49, 0x1A, 0xEB, 0xD3, 0x61, 0x9A, 0x71, 0x92, 0x16,
+    0xF2, 0xA8, 0x51, 0x17, 0xB5, 0xED, 0x27, 0x8A, 0x6A, 0xB1, 0x21, 0xD3, 0x77, 0x02, 0x95, 0x02,
+    0x99, 0x02, 0xD4, 0x1B, 0x54, 0x1A, 0xA9, 0xB4, 0x51, 0x49, 0x53, 0xBD, 0x55, 0xBA, 0x70, 0x98,
+    0x1D, 0x1E, 0x3C, 0xA8, 0xAF, 0xE3, 0xA9, 0x09, 0xB0, 0x6B, 0xB5, 0xFB, 0x96, 0x5B, 0x76, 0xAD,
+    0x3A, 0xEC, 0xCF, 0xB7, 0xD7, 0x05, 0xBB, 0xB7, 0x1F, 0x8A, 0x78, 0x67, 0x02, 0x46, 0x5D, 0x6A,
+    0xE5, 0x1A, 0xF6, 0x0E, 0xC2, 0xFE, 0x24, 0xDA, 0x1F, 0xBA, 0x9F, 0xEF, 0x3F, 0x89, 0x3B, 0x3D,
+    0xC9, 0xB6, 0x1B, 0x8A, 0xEF, 0xA7, 0x93, 0xB4, 0x52, 0x3A, 0x49, 0xBF, 0x77, 0x01, 0x7A, 0x29,
+    0x1D, 0xBA, 0x5F, 0xF3, 0x68, 0x65, 0xD1, 0x2E, 0x28, 0x5E, 0x43, 0x1D, 0xE8, 0xE3, 0xF9, 0x6C,
+    0xC0, 0x45, 0x15, 0x2E, 0x85, 0x8B, 0x1F, 0x1B, 0x35, 0x95, 0x62, 0x4F, 0x35, 0xD8, 0x38, 0x22,
+    0x38, 0x5F, 0xE8, 0x58, 0x0D, 0x60, 0x83, 0xD1, 0xA8, 0x11, 0x28, 0x94, 0x27, 0xBF, 0x2C, 0xD3,
+    0x20, 0x1F, 0x4D, 0x75, 0xE7, 0xFB, 0xC5, 0xA4, 0x3F, 0x6C, 0x03, 0x1A, 0x00, 0xA3, 0x7E, 0x4B,
+    0x52, 0x94, 0x44, 0x1B, 0xD2, 0x7D, 0xF8, 0x3F, 0x4A, 0xF1, 0xD4, 0xF1, 0x5E, 0xD9, 0xDD, 0x8A,
+    0xE3, 0xEE, 0x36, 0x8D, 0xD7, 0x98, 0x86, 0x79, 0xF7, 0xF1, 0xB2, 0xEF, 0xE0, 0xBC, 0xEB, 0x7E,
+    0x1A, 0x72, 0xB7, 0x97, 0x7A, 0xBD, 0x97, 0xBA, 0xDD, 0xCB, 0xFA, 0xB4, 0x55, 0x68, 0xDA, 0x8F,
+    0x89, 0xDF, 0x8F, 0xC9, 0x5E, 0xEA, 0x0A, 0xF7, 0xB7, 0xDA, 0x6D, 0x3F, 0x12, 0xA7, 0x27, 0xD9,
+    0xBF, 0x57, 0xED, 0xBF, 0x6B, 0xF7, 0xCA, 0x77, 0xE1, 0xDC, 0x42, 0xB9, 0x00, 0xD8, 0x11, 0xA0,
+    0x05, 0x30, 0x0B, 0x44, 0x8B, 0xEB, 0xAC, 0xAD, 0xF9, 0xEF, 0xBC, 0x69, 0x00, 0xBD, 0xA7, 0x8E,
+    0x42, 0x46, 0x0D, 0x6E, 0x2E, 0x45, 0xA6, 0xC1, 0xAE, 0xD8, 0x8D, 0x3A, 0xD0, 0x7A, 0xDA, 0xD9,
+    0xA8, 0x43, 0xBE, 0x0A, 0x64, 0x1A, 0x35, 0x61, 0x74, 0x4B, 0x50, 0xA8, 0x5D, 0xC0, 0x4A, 0x23,
+    0xD4, 0x12, 0xE0, 0x34, 0x03, 0x7D, 0x74, 0xE2, 0x56, 0x20, 0x97, 0x07, 0x0A, 0x75, 0x7B, 0xED,
+    0xEB, 0x17, 0x20, 0xD7, 0x04, 0x94, 0x1A, 0xF6, 0x42, 0x51, 0x38, 0x23, 0xD2, 0xC2, 0x43, 0x9B,
+    0x9E, 0x1A, 0x0A, 0x4D, 0xB4, 0x9A, 0x0A, 0x69, 0x6C, 0xA5, 0xC2, 0x57, 0xA1, 0xC5, 0x7D, 0xE0,
+    0xF3, 0xAD, 0xC5, 0xFD, 0xD2, 0x97, 0x6B, 0xFB, 0x8C, 0x6E, 0x49, 0xBE, 0x55, 0x28, 0xB4, 0xD2,
+    0xAE, 0x14, 0xF3, 0xE9, 0xD7, 0xE3, 0x53, 0x1A, 0xA6, 0x89, 0x2C, 0xCD, 0x6E, 0x8D, 0x5D, 0x8A,
+    0x90, 0x09, 0x3B, 0x54, 0x53, 0xB1, 0xE6, 0x6B, 0xAE, 0xA9, 0x1E, 0xDB, 0x90, 0xAF, 0x76, 0xC6,
+    0x8D, 0x2B, 0x66, 0xB3, 0x03, 0x6E, 0xDA, 0x30, 0x9B, 0x5D, 0x70, 0x53, 0xEB, 0xCD, 0x66, 0x34,
+    0xBA, 0xA9, 0x92, 0x11, 0x2E, 0x38, 0x4F, 0x7F, 0x2C, 0xCC, 0xEA, 0xB6, 0xA6, 0xBD, 0xA5, 0xE8,
+    0x6D, 0xE9, 0x96, 0x24, 0xDF, 0x4A, 0x6B, 0x76, 0xF8, 0xF8, 0x49, 0x9C, 0x29, 0x9D, 0x5F, 0xA8,
+    0xB6, 0xCB, 0x94, 0xEF, 0xAA, 0x31, 0x5E, 0x03, 0x37, 0xEF, 0x9D, 0x1F, 0x1F, 0x5F, 0xA0, 0x96,
+    0xBA, 0x4A, 0x9A, 0xEC, 0x49, 0x1F, 0x8A, 0xD9, 0xC8, 0x2C, 0xB4, 0xC3, 0x8A, 0xF5, 0x8E, 0x7C,
+    0xAD, 0x3A, 0xFA, 0x67, 0x27, 0xAA, 0x9F, 0xCD, 0x14, 0xCB, 0x4B, 0xE4, 0xAA, 0x7E, 0xF1, 0x4D,
+    0x1D, 0x4B, 0xF2, 0xBD, 0x14, 0x6C, 0xF4, 0xD1, 0xFB, 0xB1, 0xDC, 0x1A, 0x30, 0x33, 0x18, 0x35,
+    0xE4, 0x9F, 0x7A, 0x08, 0x69, 0xD6, 0x32, 0x6A, 0xC0, 0x35, 0xE7, 0x4F, 0x7B, 0x71, 0x83, 0x52,
+    0x9A, 0x0A, 0x69, 0x31, 0xDB, 0x55, 0x65, 0x2B, 0x1A, 0x36, 0x2A, 0xEF, 0x1A, 0x13, 0xEC, 0x40,
+    0xFF, 0xCC, 0x44, 0xFD, 0xDE, 0x42, 0xB1, 0xBC, 0x48, 0xB6, 0x55, 0x1D, 0xFD, 0xAD, 0x93, 0xAF,
+    0xCB, 0x4B, 0x0A, 0xB5, 0x24, 0x23, 0x69, 0x6C, 0x75, 0x7B, 0xCE, 0x75, 0xFD, 0x6C, 0x57, 0x2E,
+    0xC6, 0xC5, 0xEE, 0xFB, 0x5A, 0xE2, 0x5A, 0xA2, 0xCE, 0x9E, 0xF4, 0x9A, 0xCB, 0xB9, 0x98, 0x8D,
+    0x66, 0x7A, 0xB3, 0xD0, 0x6E, 0x47, 0xFD, 0xB8, 0x62, 0x25, 0x2D, 0x8E, 0x5C, 0x92, 0xAA, 0x8E,
+    0x5E, 0xD2, 0x8F, 0x26, 0xAA, 0xBB, 0x57, 0xC8, 0xE6, 0xE8, 0xA1, 0xBE, 0x14, 0x67, 0xBB, 0xEA,
+    0x17, 0xDF, 0xD4, 0x46, 0x71, 0x2D, 0xAE, 0xAB, 0x53, 0x2F, 0x49, 0x5A, 0xAC, 0x24, 0x69, 0xCB,
+    0xA4, 0x5E, 0x52, 0x53, 0x6E, 0x0D, 0xFD, 0xFF, 0x03, 0xE4, 0x07, 0xA7, 0x77, 0x95, 0x16, 0xA0,
+    0x48, 0xE6, 0xDA, 0x18, 0x67, 0x83, 0x09, 0x2B, 0xA9, 0xC3, 0x49, 0x1B, 0x1C, 0x5E, 0xFD, 0xC5,
+    0x15, 0xAE, 0x5E, 0x6F, 0xA1, 0xD2, 0xC7, 0x21, 0x81, 0x0C, 0x36, 0xAE, 0x4B, 0x53, 0x2B, 0xCC,
+    0x86, 0x5B, 0xA8, 0x3C, 0xFD, 0x48, 0x3B, 0x64, 0x22, 0x17, 0x45, 0xA0, 0x58, 0xA9, 0x27, 0xAA,
+    0x35, 0x57, 0x83, 0x93, 0x02, 0xB4, 0xD2, 0x14, 0x67, 0x28, 0xD2, 0xFC, 0x18, 0x6F, 0xFB, 0x0B,
+    0x0D, 0x9C, 0xD1, 0x04, 0x45, 0x4D, 0xC8, 0x1F, 0xA8, 0x09, 0x17, 0xD5, 0x50, 0x69, 0xA5, 0x92,
+    0x46, 0xAB, 0x1B, 0xA1, 0x5C, 0x33, 0x5D, 0xDB, 0xA8, 0xBC, 0x30, 0x6B, 0x3B, 0xA0, 0xEF, 0x7B,
+    0xEA, 0x5F, 0x07, 0xCA, 0x13, 0x61, 0xB6, 0x76, 0x44, 0xDF, 0x09, 0xE8, 0xFD, 0xA4, 0x09, 0x8B,
+    0x95, 0x42, 0x26, 0xAD, 0x54, 0x5A, 0xA1, 0x9D, 0x81, 0x4B, 0xCD, 0xCE, 0x11, 0x8A, 0x93, 0xA9,
+    0x0D, 0x7B, 0x2B, 0xB6, 0x5E, 0xF7, 0xF7, 0xE1, 0x6E, 0xFB, 0x03, 0x9E, 0xD8, 0x21, 0x48, 0x7A,
+    0x52, 0x92, 0x82, 0xD3, 0xDD, 0xA3, 0xA3, 0x9D, 0xE2, 0x7C, 0xE1, 0x83, 0x7D, 0x05, 0xC8, 0xC6,
+    0x34, 0x5D, 0x45, 0x3F, 0x6A, 0x02, 0xFA, 0x26, 0xBD, 0xB2, 0x3E, 0x19, 0xED, 0x66, 0xDD, 0xBD,
+    0x6A, 0x3B, 0xC8, 0x4F, 0x5F, 0x0D, 0x44, 0xA7, 0xCE, 0xCE, 0xF0, 0xB8, 0x06, 0x0A, 0x45, 0x03,
+    0xB9, 0x31, 0x92, 0xA8, 0x3F, 0xD1, 0x86, 0xFE, 0x5C, 0xC1, 0x04, 0x77, 0x7B, 0xAE, 0xBC, 0xDC,
+    0xD8, 0xDE, 0x0A, 0xFD, 0xCB, 0xAA, 0x7F, 0xBE, 0x15, 0x41, 0xCF, 0x2D, 0xD5, 0xA7, 0xA1, 0x9D,
+    0x9C, 0x7E, 0xAB, 0x46, 0x52, 0xC8, 0x25, 0x4D, 0x26, 0x19, 0x39, 0x73, 0x3C, 0x56, 0xA5, 0x31,
+    0x7A, 0x12, 0x46, 0x24, 0x77, 0xA2, 0x1F, 0xCF, 0xBE, 0x6A, 0x47, 0xC8, 0xB5, 0xEB, 0x65, 0x3B,
+    0xED, 0x5E, 0x79, 0xE0, 0x32, 0x90, 0x0F, 0xA9, 0xA3, 0xFB, 0xCD, 0x35, 0x90, 0x05, 0xA0, 0x9C,
+    0xD2, 0xAB, 0x7C, 0xDF, 0xD9, 0xBF, 0xFD, 0x56, 0xAC, 0xA0, 0xE7, 0x02, 0x45, 0xA8, 0x16, 0xEA,
+    0xC9, 0x79, 0xD4, 0x38, 0x5F, 0x04, 0xFA, 0xB1, 0x9E, 0xD0, 0xA0, 0x26, 0xD7, 0x2B, 0x01, 0xA3,
+    0x7A, 0xA2, 0x94, 0x1A, 0xAC, 0x02, 0xD4, 0x9A, 0xC0, 0xA9, 0x81, 0x3E, 0x24, 0x98, 0x2C, 0x57,
+    0x03, 0xE5, 0xAE, 0x13, 0xA5, 0x1A, 0x9C, 0x02, 0x48, 0x23, 0x46, 0x1B, 0x58, 0x4D, 0x67, 0x8D,
+    0x05, 0xA0, 0x58, 0xA0, 0xED, 0xF6, 0x4F, 0x01, 0xDA, 0x8D, 0x42, 0x1B, 0xAD, 0x42, 0xB1, 0xC9,
+    0xB7, 0xEF, 0xE8, 0x95, 0x50, 0x86, 0x76, 0xA8, 0x7F, 0x19, 0xD8, 0xDA, 0xC1, 0x7E, 0x18, 0xD8,
+    0xDC, 0x50, 0xBF, 0x1F, 0x8A, 0xE0, 0x06, 0x5D, 0x0B, 0xAD, 0x77, 0x5A, 0x8D, 0xD4, 0x38, 0x8D,
+    0x46, 0x23, 0x2E, 0xC1, 0x04, 0xF7, 0x3E, 0x81, 0x3A, 0x75, 0x66, 0x33, 0x1B, 0x55, 0xA8, 0x02,
+    0xAD, 0xEF, 0x7D, 0xAE, 0x77, 0x34, 0x58, 0x3D, 0x27, 0x2E, 0x5D, 0xB9, 0x74, 0xE5, 0xCB, 0x2C,
+    0x26, 0x1E, 0x85, 0xFC, 0x86, 0x56, 0xC8, 0xA3, 0xE9, 0x14, 0x6D, 0x8E, 0x5E, 0xBF, 0x7A, 0xFD,
+    0x8B, 0xAC, 0xBA, 0x5F, 0x66, 0xA7, 0x8B, 0xEC, 0x48, 0x5B, 0x26, 0x69, 0x90, 0x34, 0xB7, 0xD2,
+    0x1B, 0x0F, 0xEF, 0x48, 0xD6, 0x77, 0xE4, 0x11, 0x03, 0xDD, 0xD0, 0xFF, 0xAC, 0xA1, 0x6D, 0x9C,
+    0x77, 0x5D, 0x11, 0xEC, 0x88, 0x8C, 0xA7, 0xFE, 0xEB, 0x85, 0x72, 0x7E, 0x8B, 0x6C, 0xAB, 0x1A,
+    0xDA, 0x57, 0x26, 0xEA, 0x3B, 0xDB, 0x61, 0x1F, 0x9C, 0xA2, 0x59, 0x3E, 0x48, 0x9A, 0x2B, 0x7D,
+    0xBA, 0xD2, 0x7F, 0x04, 0x3C, 0xF2, 0xDD, 0xFC, 0x75, 0x30, 0x11, 0xC7, 0x88, 0xB6, 0x69, 0x2D,
+    0x75, 0x90, 0x47, 0xEB, 0xF4, 0xF1, 0xAD, 0xF9, 0x3D, 0x15, 0xEB, 0x23, 0xAF, 0x65, 0xAF, 0x9B,
+    0x35, 0x13, 0x8A, 0x6B, 0xFD, 0x90, 0x4B, 0x03, 0xE5, 0x83, 0xFA, 0xF3, 0xBB, 0x5D, 0x9A, 0xED,
+    0x7C, 0x06, 0x1D, 0x48, 0x00, 0xC6, 0x12, 0xCD, 0xE0, 0x68, 0x93, 0x8E, 0x40, 0xF5, 0x69, 0x00,
+    0xEC, 0x22, 0xC0, 0xAC, 0x6E, 0x82, 0x5C, 0x65, 0x00, 0xF4, 0x6D, 0x35, 0xD0, 0x8E, 0xCE, 0x83,
+    0xF3, 0x65, 0x00, 0x1B, 0x32, 0x75, 0x94, 0x2B, 0xCE, 0x63, 0xF4, 0xBD, 0xE7, 0xD7, 0x9D, 0xBB,
+    0xDA, 0xEF, 0x01, 0xF8, 0x8D, 0x5A, 0x8A, 0xB1, 0x01, 0x69, 0x2E, 0xD4, 0x61, 0xB7, 0x5C, 0x03,
+    0x46, 0x83, 0x3C, 0xF4, 0x73, 0x74, 0x80, 0x21, 0x41, 0x3A, 0x71, 0x59, 0x20, 0x5B, 0x93, 0x51,
+    0x7E, 0x6A, 0x72, 0x27, 0x7D, 0x2C, 0x97, 0x7B, 0x55, 0x8E, 0x5A, 0xEA, 0x32, 0x69, 0xC3, 0x9E,
+    0xF4, 0x81, 0xB6, 0x71, 0xDE, 0x2C, 0xB4, 0x83, 0x1D, 0x11, 0x8E, 0x7C, 0xCD, 0x16, 0xCA, 0xB9,
+    0x9C, 0xA8, 0xA6, 0xAA, 0xA1, 0xED, 0x5E, 0x22, 0x57, 0xB6, 0x1D, 0xF6, 0xC1, 0x48, 0xF2, 0xE5,
+    0xEE, 0xEA, 0xA8, 0xF4, 0xE9, 0x4A, 0xB9, 0x3D, 0x13, 0x00, 0x37, 0x81, 0xD9, 0xF6, 0xCB, 0x15,
+    0x90, 0x2B, 0x24, 0xAB, 0xB4, 0xD0, 0x00, 0xD9, 0x5B, 0x00, 0x3F, 0x64, 0x17, 0x7D, 0xC9, 0xC3,
+    0x6E, 0xE2, 0x8F, 0x21, 0x99, 0xCF, 0x32, 0xC7, 0x2F, 0xEA, 0x6E, 0x43, 0x21, 0x05, 0x8C, 0xA4,
+    0x81, 0xE8, 0x99, 0x4B, 0x6A, 0x4A, 0x6D, 0x47, 0x73, 0x34, 0x97, 0x6B, 0xED, 0x07, 0xA9, 0x5D,
+    0x88, 0xF3, 0x50, 0x72, 0xEF, 0xA2, 0x5B, 0x78, 0x7F, 0xB3, 0xDB, 0x99, 0xDA, 0x56, 0x6B, 0xF3,
+    0xCD, 0xA6, 0x55, 0x0C, 0x32, 0x49, 0x4D, 0x2D, 0x69, 0x46, 0x92, 0x3A, 0x23, 0x69, 0x49, 0x86,
+    0x4F, 0x25, 0x2D, 0x64, 0x01, 0xEC, 0x04, 0x2E, 0x76, 0xC2, 0x4E, 0xB1, 0xBF, 0x3B, 0x3B, 0x6E,
+    0x6B, 0xE2, 0x7C, 0xBF, 0x18, 0x69, 0xAA, 0x67, 0x50, 0x43, 0x11, 0x22, 0x24, 0xDC, 0x47, 0x0C,
+    0xB3, 0x58, 0x23, 0x5A, 0xE7, 0x96, 0x3F, 0xA4, 0xD7, 0x8A, 0xB4, 0xD2, 0x2B, 0x50, 0x9F, 0x6A,
+    0x74, 0xCB, 0x6E, 0x35, 0x35, 0x1A, 0x89, 0x91, 0x14, 0xDC, 0xA7, 0x2B, 0xD8, 0xD9, 0xCE, 0x98,
+    0x40, 0x3D, 0xFE, 0x7E, 0x88, 0x0B, 0x80, 0x35, 0x81, 0x8F, 0xED, 0x02, 0xAD, 0x3A, 0xFA, 0x9F,
+    0x06, 0xFA, 0xAE, 0x1F, 0xFA, 0xA6, 0x08, 0xA7, 0x17, 0x7E, 0xF5, 0x84, 0x2C, 0xAA, 0xE6, 0x84,
+    0xB4, 0xD0, 0x8F, 0xD1, 0xF6, 0xAC, 0x12, 0x7E, 0x99, 0x2B, 0x1D, 0xA6, 0x9A, 0xD3, 0x5D, 0xA9,
+    0xE9, 0xCF, 0xA8, 0xA3, 0x6D, 0x33, 0x47, 0x3F, 0xAA, 0x3F, 0x21, 0x2D, 0x46, 0x67, 0x2C, 0xAD,
+    0x18, 0xC8, 0xAA, 0x4E, 0x2D, 0xAD, 0x4B, 0x87, 0x5F, 0x7E, 0xC1, 0x5D, 0x38, 0x80, 0x76, 0x24,
+    0x53, 0x8C, 0xB1, 0xB9, 0x05, 0xE4, 0x77, 0xD3, 0xD0, 0x4E, 0x5E, 0x67, 0x63, 0xA8, 0x23, 0x66,
+    0x8D, 0xC2, 0x6A, 0xA3, 0x9E, 0x95, 0x11, 0xE2, 0xA2, 0xF5, 0xA0, 0xE9, 0xCF, 0xF2, 0x33, 0x31,
+    0x54, 0xFA, 0x13, 0xA8, 0xC7, 0x6C, 0x83, 0xBE, 0xEB, 0x3B, 0x72, 0xC5, 0xB5, 0x7B, 0xD9, 0x3B,
+    0xD8, 0xFD, 0x00, 0x18, 0xCF, 0xBD, 0xB6, 0xDA, 0x97, 0x5C, 0xD7, 0xDA, 0xCE, 0x04, 0x3B, 0x57,
+    0xDE, 0x6C, 0x1A, 0x90, 0xE2, 0x52, 0x56, 0xF9, 0x64, 0x5A, 0x72, 0xEE, 0x46, 0xCD, 0xA4, 0xAE,
+    0x90, 0x3A, 0x2B, 0x75, 0xF5, 0x1C, 0x75, 0xAD, 0x4D, 0xB1, 0x88, 0x3E, 0x3D, 0xDA, 0x31, 0xCA,
+    0xCF, 0x2D, 0x7F, 0x48, 0x2D, 0x35, 0x56, 0x1A, 0x73, 0xC9, 0x53, 0x6F, 0x4D, 0x76, 0xC0, 0x85,
+    0x86, 0x7A, 0x34, 0x01, 0xFA, 0xB7, 0xB5, 0x5B, 0x69, 0xE3, 0x82, 0x19, 0xF1, 0x29, 0x35, 0x80,
+    0x99, 0x1E, 0x26, 0xBE, 0x56, 0xBA, 0x4E, 0x21, 0xE9, 0xA3, 0x88, 0x61, 0x47, 0xD8, 0xB2, 0x95,
+    0xA4, 0x42, 0x14, 0x9A, 0x5B, 0x4F, 0xA1, 0x5B, 0x02, 0x1B, 0x5A, 0x0F, 0xED, 0x07, 0x02, 0xB3,
+    0xB5, 0x1E, 0xEA, 0xDF, 0x0A, 0x72, 0xED, 0x9B, 0x46, 0xAD, 0x07, 0xF7, 0x5B, 0x41, 0xB1, 0xB5,
+    0x9E, 0x4C, 0xBF, 0x14, 0x5F, 0xD5, 0xDA, 0x2A, 0x79, 0xD7, 0xD1, 0xCF, 0xD6, 0x33, 0x4A, 0x9E,
+    0xB6, 0x42, 0x44, 0x27, 0x5B, 0xE9, 0xDF, 0xB2, 0x73, 0xF3, 0xD2, 0x3C, 0x6C, 0x82, 0x1B, 0xC0,
+    0xFA, 0x0D, 0x70, 0xB7, 0x16, 0x40, 0xD5, 0x04, 0x26, 0xF4, 0x1D, 0xD8, 0x8F, 0x37, 0xAA, 0x8F,
+    0xDA, 0x77, 0x67, 0x23, 0xC9, 0x8D, 0x6E, 0x37, 0xFA, 0x13, 0xD5, 0x5C, 0xAB, 0x43, 0x4D, 0xBD,
+    0x61, 0x02, 0x6E, 0xA1, 0x1A, 0xD1, 0x44, 0xDF, 0xE4, 0x6A, 0xB2, 0x95, 0x72, 0xA5, 0x98, 0x71,
+    0x33, 0xD6, 0x67, 0x1A, 0x71, 0x77, 0x6F, 0xC4, 0xA5, 0x6F, 0x83, 0x3D, 0x96, 0x38, 0x91, 0x4B,
+    0x7D, 0x17, 0x7D, 0x8A, 0xDF, 0x27, 0x6C, 0x37, 0x8A, 0x2F, 0xAE, 0xC6, 0x6E, 0x88, 0x40, 0x5A,
+    0xA4, 0x15, 0xC4, 0x66, 0x76, 0xD8, 0xFE, 0xF8, 0x20, 0xFE, 0x41, 0xF5, 0x51, 0x3B, 0x60, 0xEF,
+    0xB9, 0x69, 0xAA, 0xB9, 0x56, 0x67, 0x56, 0xFA, 0x05, 0x37, 0x18, 0x75, 0xC5, 0x8C, 0x5B, 0xA2,
+    0xE8, 0x8A, 0x99, 0x7A, 0xA6, 0x6D, 0x8C, 0x1A, 0x13, 0x68, 0xE7, 0x28, 0xB9, 0xFC, 0x8C, 0xF6,
+    0xF7, 0x49, 0x7C, 0x7D, 0x17, 0xAD, 0x71, 0xE0, 0x0F, 0x28, 0xA5, 0x99, 0x3E, 0x01, 0xB6, 0x43,
+    0xAD, 0xA3, 0x37, 0x3E, 0xD3, 0xFE, 0xCB, 0x8E, 0xDE, 0xD4, 0x5C, 0x49, 0x1A, 0x7A, 0x49, 0xB9,
+    0xA4, 0xA5, 0xDC, 0xBE, 0x77, 0x40, 0xED, 0xD3, 0x6C, 0x90, 0x6B, 0x37, 0xB5, 0xD6, 0x9F, 0x1C,
+    0xBE, 0x8A, 0xA4, 0xC1, 0x48, 0x8A, 0x3D, 0x71, 0x92, 0x47, 0x7B, 0x3F, 0x30, 0x10, 0xC3, 0x4E,
+    0xE8, 0x17, 0x87, 0x87, 0x46, 0x09, 0x6C, 0xF1, 0x4E, 0xD2, 0x28, 0x49, 0xD7, 0x24, 0x6D, 0x95,
+    0x52, 0x24, 0x3A, 0x7B, 0xE1, 0xC6, 0x46, 0x3A, 0xF3, 0xEC, 0x76, 0x11, 0x88, 0xCF, 0xDF, 0xB2,
+    0xFE, 0x3A, 0x79, 0x14, 0xF3, 0x6C, 0xF4, 0xA4, 0x32, 0x61, 0x47, 0x1D, 0xDD, 0x08, 0x4E, 0x52,
+    0x25, 0xE9, 0x03, 0x49, 0xBF, 0xD1, 0xF7, 0x1A, 0xDA, 0xB4, 0x6A, 0x18, 0x8D, 0xFC, 0xC5, 0x0E,
+    0xFB, 0xC9, 0x92, 0x29, 0x33, 0x71, 0x75, 0x6B, 0xF2, 0x37, 0x38, 0xC2, 0xFA, 0x22, 0xE0, 0xD2,
+    0x50, 0x27, 0x34, 0xA2, 0x3E, 0xF9, 0xD2, 0x89, 0xEC, 0x02, 0x98, 0x95, 0x9E, 0x38, 0xAE, 0x9A,
+    0x4C, 0xD4, 0xB2, 0x89, 0xEC, 0xA8, 0xF9, 0x7B, 0x14, 0x59, 0xB4, 0xF8, 0xF6, 0x17, 0x9E, 0xC5,
+    0xC9, 0x6F, 0x17, 0x3C, 0x7B, 0x20, 0xBA, 0xFF, 0xEF, 0x4D, 0x64, 0xE5, 0xCE, 0x7E, 0xD0, 0x00,
+    0x6E, 0x8E, 0x90, 0x6A, 0xA1, 0xEE, 0x61, 0xD7, 0xF9, 0x77, 0x24, 0xB2, 0x8B, 0x47, 0x37, 0x34,
+    0xB6, 0xA9, 0xE7, 0xA1, 0x94, 0x34, 0xD5, 0x77, 0x0F, 0x9B, 0x7B, 0x7B, 0xEE, 0x81, 0xFE, 0xC7,
+    0x5F, 0xEF, 0xEE, 0xED, 0xB9, 0x34, 0x18, 0x35, 0xE7, 0x7A, 0x3E, 0x80, 0xD1, 0xF7, 0x0E, 0xAF,
+    0xEC, 0x7B, 0x3E, 0x48, 0xD2, 0xD3, 0x92, 0x36, 0xBB, 0xE3, 0x16, 0x79, 0x5C, 0x97, 0xC0, 0xEF,
+    0x6A, 0x20, 0x52, 0x6D, 0xE2, 0x4A, 0xAB, 0x11, 0xB8, 0x04, 0x3C, 0x7E, 0x02, 0x75, 0x9C, 0xAB,
+    0x1A, 0x37, 0x57, 0xBE, 0xF2, 0xAC, 0xF6, 0xEE, 0x91, 0x8E, 0x25, 0xDD, 0x91, 0xE2, 0x3A, 0x72,
+    0xF5, 0xE4, 0x0A, 0x45, 0x80, 0x4C, 0x0D, 0xB8, 0x95, 0x72, 0xE7, 0x86, 0xFA, 0x2A, 0xBA, 0x71,
+    0x1B, 0x17, 0xF5, 0x51, 0x12, 0xDB, 0x41, 0xB2, 0xFB, 0x94, 0x1C, 0x02, 0xD7, 0x40, 0xF5, 0xAB,
+    0x64, 0x08, 0xF4, 0x33, 0x5C, 0x4C, 0xA6, 0x9F, 0x9D, 0x68, 0x1B, 0x3B, 0x97, 0x0B, 0xF6, 0x44,
+    0x1D, 0x56, 0x4B, 0xB2, 0x00, 0xEC, 0xFE, 0x82, 0x2F, 0x3D, 0x7C, 0x74, 0x1E, 0x3B, 0xEA, 0xF5,
+    0xE4, 0x4E, 0x98, 0xBE, 0x96, 0xD4, 0xF5, 0xFF, 0xF6, 0xF0, 0x3E, 0x61, 0x0E, 0x90, 0xEB, 0xF0,
+    0x1B, 0xF7, 0x09, 0x53, 0x8A, 0x5C, 0xA7, 0x33, 0xC2, 0x04, 0xEC, 0x76, 0x78, 0x78, 0xB0, 0x17,
+    0xA6, 0x91, 0xB4, 0x46, 0xCC, 0x55, 0xD2, 0xCF, 0x24, 0x69, 0x78, 0xAC, 0xE3, 0x05, 0xB3, 0xA2,
+    0xC6, 0xFD, 0x4C, 0x8D, 0x91, 0x1A, 0x9C, 0xD2, 0x97, 0x5D, 0x07, 0x17, 0xBB, 0x2F, 0x32, 0x7F,
+    0xFD, 0x8E, 0x85, 0x1E, 0xE5, 0x59, 0x4F, 0xA7, 0x01, 0xB0, 0x2C, 0x06, 0x99, 0xDA, 0xDB, 0x33,
+    0x50, 0xF9, 0x76, 0x84, 0x62, 0xA1, 0x6F, 0xE0, 0xCA, 0x9E, 0xF3, 0xF1, 0x45, 0xB6, 0xC7, 0xDE,
+    0xFA, 0x41, 0x03, 0xED, 0x0E, 0xAE, 0x4D, 0xAB, 0xEF, 0x1A, 0xBD, 0xF8, 0x11, 0xE9, 0x3A, 0xFF,
+    0x3C, 0x59, 0x6D, 0x79, 0xC2, 0x8C, 0xD7, 0x33, 0x4E, 0x73, 0x04, 0x7F, 0x52, 0x24, 0xCE, 0x2D,
+    0x3C, 0x76, 0x40, 0xA1, 0x2E, 0x93, 0x5E, 0x75, 0x0B, 0x56, 0x7A, 0x5A, 0x03, 0xD2, 0xE2, 0x02,
+    0x17, 0xA5, 0x6B, 0x9A, 0xA0, 0x0F, 0xB5, 0x1A, 0x6C, 0xC8, 0xA4, 0x83, 0x8B, 0xC9, 0x1B, 0x0E,
+    0x71, 0xFD, 0x1D, 0xB2, 0xF8, 0x22, 0x99, 0x01, 0x65, 0x8C, 0x5C, 0x5D, 0x4C, 0xAB, 0x70, 0x8A,
+    0xF7, 0x44, 0x57, 0x61, 0x89, 0x78, 0x55, 0xB9, 0xAA, 0xCB, 0xB7, 0x7C, 0xA3, 0x6F, 0x8A, 0xE5,
+    0x21, 0x3D, 0xCC, 0xB7, 0x67, 0x97, 0x4C, 0x9B, 0xBA, 0x56, 0x5A, 0xEC, 0x26, 0x3D, 0x15, 0x72,
+    0xCD, 0xAE, 0xB1, 0x7A, 0xC6, 0xD3, 0xCE, 0x2F, 0x61, 0xF4, 0xEC, 0x84, 0x9B, 0xDF, 0xC2, 0xA8,
+    0xF0, 0xB4, 0xBE, 0xED, 0x2A, 0x99, 0x9D, 0xCA, 0x21, 0xC9, 0x17, 0xD1, 0x29, 0x96, 0xE7, 0xF1,
+    0xFF, 0x65, 0x4B, 0x03, 0x61, 0x56, 0x26, 0x34, 0xD8, 0x4D, 0x4B, 0x26, 0x89, 0x34, 0x5B, 0x2F,
+    0x7C, 0x55, 0x0B, 0x90, 0xBF, 0xCE, 0x13, 0x0D, 0xD4, 0x9F, 0x3C, 0xEF, 0x23, 0x16, 0xC6, 0x2E,
+    0x28, 0x44, 0x1B, 0x23, 0x63, 0xED, 0xC2, 0xFF, 0xEF, 0x86, 0x29, 0x7B, 0xA3, 0x79, 0xA2, 0xE9,
+    0xBB, 0x7A, 0xAC, 0xA2, 0x71, 0x32, 0xE3, 0xB4, 0x90, 0xF5, 0x0F, 0x33, 0x93, 0xFB, 0xFF, 0x61,
+    0xCB, 0xB4, 0xE9, 0xDB, 0x92, 0x26, 0xDD, 0xD6, 0xDC, 0xD3, 0xAF, 0xAE, 0xB1, 0x7A, 0x7E, 0xC8,
+    0xF4, 0xC1, 0x84, 0xFB, 0xCD, 0x82, 0x5D, 0xDF, 0xC2, 0xA8, 0x1A, 0x32, 0xDD, 0x5A, 0xB2, 0xF3,
+    0x78, 0xCE, 0xD0, 0xC6, 0xB1, 0x09, 0x69, 0x58, 0xFA, 0x0E, 0xDC, 0xF8, 0x8F, 0x71, 0xDE, 0x6E,
+    0x5A, 0x8A, 0x88, 0x72, 0x6F, 0x48, 0x5B, 0x1A, 0x14, 0x38, 0x3C, 0x43, 0xE2, 0x4A, 0xF6, 0x54,
+    0xE4, 0xC1, 0x9E, 0xCA, 0x86, 0x84, 0x6B, 0x7C, 0xD1, 0x2D, 0x7B, 0xF3, 0x57, 0x57, 0xA0, 0x90,
+    0x22, 0x24, 0xAF, 0x10, 0xCD, 0xC8, 0x11, 0x27, 0x69, 0xC5, 0xEA, 0x84, 0x8B, 0xD7, 0x13, 0xBA,
+    0x54, 0x27, 0xC0, 0x69, 0x3C, 0x85, 0xE2, 0xCE, 0x9D, 0xD8, 0xA8, 0xCB, 0x7E, 0x00, 0xED, 0x42,
+    0xA5, 0xBB, 0x46, 0x1D, 0xD2, 0xEC, 0x02, 0x56, 0xBA, 0xA6, 0x81, 0xAB, 0x5A, 0xDC, 0x06, 0xA5,
+    0xDE, 0xD1, 0x0C, 0x1A, 0x2A, 0x7D, 0xC2, 0xD5, 0x84, 0xB1, 0x0D, 0x67, 0xED, 0xD9, 0x81, 0x56,
+    0x3B, 0x32, 0xC1, 0x0A, 0x5C, 0xD5, 0x6B, 0x40, 0xA6, 0x04, 0xE1, 0xD7, 0x73, 0xE4, 0x89, 0x1A,
+    0x0D, 0x71, 0xB1, 0x78, 0x20, 0xA6, 0xFC, 0xF7, 0x3D, 0x36, 0x17, 0x0E, 0x9B, 0x53, 0x18, 0xCE,
+    0xC6, 0xB1, 0x49, 0x31, 0xF5, 0x88, 0x20, 0xC5, 0x48, 0x4A, 0x7D, 0x56, 0xAF, 0xE3, 0x3D, 0x14,
+    0xBD, 0x4E, 0x8E, 0x5E, 0xFD, 0xDB, 0x47, 0x14, 0x7E, 0x9F, 0xA6, 0xBF, 0x4C, 0x0B, 0xB4, 0x6B,
+    0x04, 0x09, 0x8D, 0xBA, 0x48, 0x76, 0xE8, 0x7D, 0xF2, 0x84, 0xB7, 0x28, 0xB5, 0xB3, 0x30, 0x02,
+    0xE5, 0x49, 0x3D, 0x55, 0xBA, 0xBD, 0x54, 0xD2, 0x66, 0x37, 0xE9, 0x59, 0x5F, 0xEA, 0xFD, 0x19,
+    0x7D, 0x12, 0xA8, 0xD6, 0x97, 0x30, 0xBA, 0xDA, 0xA1, 0x9F, 0x4C, 0xB8, 0x3B, 0x81, 0x2A, 0xB4,
+    0x5D, 0x25, 0x2B, 0xE9, 0x9D, 0x64, 0x70, 0x84, 0x42, 0x12, 0xAD, 0x34, 0x64, 0xFF, 0xBA, 0x9A,
+    0x22, 0xE0, 0x68, 0x56, 0xD3, 0x19, 0xA1, 0xDB, 0xEA, 0xDA, 0x64, 0xA3, 0x5A, 0x69, 0xCA, 0xAE,
+    0xEE, 0xC9, 0x18, 0x31, 0xDE, 0x13, 0x9D, 0x26, 0xAB, 0x66, 0x07, 0x30, 0xEB, 0xC6, 0x0C, 0x6E,
+    0x74, 0x23, 0xD6, 0xD3, 0x3F, 0xC4, 0x98, 0xAD, 0x67, 0xD0, 0x3B, 0x6A, 0xB0, 0x21, 0x35, 0x3B,
+    0x6C, 0xA8, 0x97, 0xD4, 0xAC, 0x82, 0x5B, 0xC8, 0x74, 0x7C, 0x4F, 0x73, 0x75, 0x81, 0x4C, 0xEF,
+    0x6B, 0x38, 0x6D, 0xFE, 0xF8, 0xF0, 0xEA, 0xEA, 0x24, 0xE9, 0x7D, 0x49, 0xDA, 0x9C, 0x24, 0x7D,
+    0x78, 0x5F, 0x33, 0x90, 0xEB, 0x43, 0x0D, 0x38, 0xB9, 0x80, 0xD1, 0xDF, 0x68, 0xC4, 0xA9, 0x5D,
+    0x31, 0xF2, 0xC9, 0xB5, 0x57, 0xB3, 0x73, 0xF8, 0x4B, 0xF9, 0x1D, 0x0C, 0xD0, 0x7F, 0x5B, 0x44,
+    0x70, 0x20, 0xE2, 0x04, 0x67, 0xB7, 0x08, 0x2C, 0x47, 0xBA, 0xC6, 0x99, 0xE6, 0x29, 0x10, 0x6A,
+    0xFD, 0xEE, 0x56, 0xA4, 0xFA, 0x58, 0xD7, 0xC9, 0x76, 0x20, 0xC7, 0x4A, 0xAE, 0x4D, 0x9E, 0x3A,
+    0x10, 0x23, 0xAA, 0x33, 0xCE, 0xE3, 0x1A, 0x23, 0xCC, 0x82, 0xF3, 0xB8, 0xCE, 0x88, 0x62, 0xC1,
+    0x79, 0xDA, 0xC1, 0x88, 0x32, 0xE0, 0x7C, 0x74, 0x72, 0x6D, 0xA0, 0x8D, 0xCD, 0xA6, 0x0A, 0xF4,
+    0x73, 0xAE, 0xA1, 0x5C, 0xC1, 0xF9, 0x5C, 0x0D, 0x36, 0xD0, 0x8F, 0x18, 0x51, 0x2F, 0xA0, 0xA1,
+    0xDC, 0xE2, 0x07, 0x1D, 0x36, 0xA0, 0x89, 0x22, 0x86, 0x35, 0x13, 0x88, 0xA0, 0x18, 0xA0, 0xFE,
+    0x51, 0xE4, 0x6D, 0xB9, 0x40, 0xA6, 0xD1, 0x0A, 0xDA, 0xD9, 0xE8, 0xC7, 0x87, 0x57, 0xD7, 0x84,
+    0xE8, 0x3B, 0x29, 0x8E, 0xBC, 0xB4, 0x18, 0x29, 0xDE, 0xCA, 0x89, 0x5F, 0x28, 0x4D, 0x56, 0xD0,
+    0x2F, 0x46, 0x03, 0x4E, 0xC8, 0x63, 0x35, 0xB8, 0x15, 0x23, 0x5F, 0xA9, 0x41, 0xE1, 0x7E, 0x31,
+    0x5D, 0xD0, 0x4A, 0x74, 0xCF, 0x8C, 0xB4, 0xC2, 0x7F, 0x79, 0xE3, 0xEF, 0x4B, 0x4C, 0xDD, 0xAC,
+    0xE3, 0xBF, 0xD1, 0xBB, 0x3F, 0xBD, 0xBA, 0xDD, 0x74, 0xBF, 0x99, 0xEB, 0x07, 0x59, 0x77, 0x36,
+    0x1D, 0xC1, 0x28, 0x35, 0xFB, 0x21, 0x17, 0x65, 0xA0, 0x3E, 0xDF, 0x1C, 0x73, 0x35, 0xE5, 0x4A,
+    0xBD, 0xA0, 0xC9, 0xA8, 0xB3, 0x1B, 0x2E, 0x20, 0x6F, 0x34, 0x58, 0x51, 0x5E, 0xFF, 0xCB, 0x7A,
+    0xBE, 0xE9, 0xC2, 0xCD, 0x17, 0xDB, 0xF0, 0x62, 0xBD, 0x5C, 0xBE, 0x07, 0xB5, 0x3A, 0x04, 0x7D,
+    0xD6, 0x6F, 0x76, 0xFA, 0xDB, 0xE4, 0xEA, 0x72, 0x75, 0x70, 0xF8, 0x9A, 0x95, 0x42, 0x25, 0xAD,
+    0x4E, 0xDA, 0x9E, 0x38, 0xFA, 0x1C, 0x7F, 0x27, 0x12, 0x2D, 0xEF, 0x7F, 0x94, 0x9F, 0xF7, 0x58,
+    0xCF, 0x3C, 0xB6, 0xB8, 0x74, 0xEC, 0x1F, 0x3A, 0xFF, 0x00, 0xF8, 0xC6, 0x0D, 0x11, 0xA3, 0x2D,
+    0x5A, 0x9C, 0xB4, 0x3D, 0x04, 0x64, 0xBC, 0xD4, 0xC4, 0x9B, 0xC1, 0x84, 0x74, 0x6B, 0x44, 0x60,
+    0xEA, 0x21, 0x6F, 0xC4, 0xC5, 0x6B, 0x48, 0x90, 0xF1, 0x0A, 0xB9, 0x3A, 0xE8, 0x27, 0x6C, 0x30,
+    0x42, 0x83, 0xF3, 0x36, 0x18, 0xD1, 0x0F, 0xB5, 0x2F, 0x43, 0x7E, 0xB6, 0x31, 0xD6, 0x73, 0xB9,
+    0xE6, 0xEA, 0x34, 0xB9, 0xC5, 0x6E, 0x46, 0x83, 0xBC, 0x0B, 0x56, 0xC5, 0x6C, 0xE6, 0x2C, 0xD0,
+    0x87, 0x4A, 0x99, 0x86, 0xEC, 0xE0, 0xC2, 0x41, 0xE5, 0xEB, 0xB9, 0x5E, 0xDC, 0xE2, 0x42, 0xBB,
+    0x87, 0xAE, 0xAD, 0xBF, 0xFF, 0xA7, 0x8A, 0x3F, 0x73, 0xBD, 0xD4, 0x4B, 0xB9, 0xD4, 0xDE, 0x0D,
+    0x7D, 0x23, 0xB4, 0xF6, 0x5B, 0xBD, 0xE5, 0xEB, 0x85, 0x83, 0xDA, 0x3B, 0xEF, 0x66, 0x37, 0xB7,
+    0x4B, 0x7F, 0xCE, 0xC4, 0x73, 0xFE, 0xF4, 0xA7, 0xBE, 0xF7, 0x67, 0xAE, 0xE7, 0x74, 0xF6, 0xC5,
+    0x2D, 0x2E, 0xC4, 0x9F, 0x4B, 0x4F, 0x07, 0x77, 0x7C, 0xE6, 0xF7, 0x56, 0x68, 0x6F, 0x85, 0xF6,
+    0x27, 0x5B, 0x3F, 0xF5, 0x13, 0xB8, 0xDF, 0xA8, 0x03, 0xFD, 0x68, 0x83, 0x42, 0xD5, 0x02, 0x55,
+    0x68, 0x47, 0x68, 0xEF, 0xA8, 0x21, 0xD7, 0xAD, 0x15, 0xCA, 0xAD, 0x9A, 0xA1, 0x5E, 0xDC, 0x08,
+    0x9A, 0xD4, 0x60, 0xF4, 0xF4, 0x06, 0x76, 0xB5, 0x0B, 0x38, 0xEF, 0x26, 0xD0, 0xA0, 0x0E, 0xA3,
+    0x62, 0x23, 0x86, 0x9B, 0x69, 0x7D, 0xEB, 0xC9, 0xF4, 0xB6, 0x06, 0xCA, 0xAD, 0x10, 0xD4, 0x4B,
+    0x15, 0xA0, 0x1F, 0x7B, 0x8F, 0xD1, 0x53, 0x1A, 0xB0, 0x6B, 0xA9, 0x06, 0xE7, 0xEB, 0x15, 0x34,
+    0x68, 0x8E, 0xBE, 0x11, 0x55, 0x48, 0xD4, 0xBE, 0xFC, 0xA3, 0x42, 0x5D, 0xCC, 0x4F, 0xC1, 0x49,
+    0x33, 0xEC, 0x6C, 0xA3, 0x95, 0x68, 0x45, 0xD3, 0x4B, 0xC0, 0x37, 0xF6, 0x2C, 0x99, 0x0B, 0x07,
+    0xD4, 0x4F, 0x0A, 0xB3, 0xD4, 0x33, 0xED, 0x3B, 0xEA, 0x8A, 0xE0, 0x16, 0xFA, 0x63, 0x0D, 0xC9,
+    0xA3, 0xBD, 0x0F, 0x5D, 0xED, 0x44, 0xB1, 0x58, 0x7F, 0xA6, 0xD1, 0x88, 0x62, 0x4E, 0x8D, 0x72,
+    0xB6, 0x9E, 0x1E, 0x51, 0x7A, 0xEB, 0xE9, 0x33, 0x51, 0xFA, 0x2A, 0x36, 0xAC, 0xAF, 0x66, 0x94,
+    0xAB, 0xB3, 0x53, 0xBD, 0x64, 0x3B, 0x63, 0xFE, 0xFF, 0xD8, 0xC0, 0x6A, 0x8C, 0x8C, 0x2B, 0xAB,
+    0x81, 0x6C, 0xCF, 0x01, 0x29, 0xC7, 0x9D, 0xC1, 0xE8, 0x16, 0x40, 0x1B, 0x18, 0xA9, 0xC3, 0xCE,
+    0xF5, 0x84, 0x1B, 0x8A, 0x85, 0x4B, 0x0F, 0x74, 0xB8, 0xFA, 0x69, 0x67, 0xB2, 0xC4, 0x30, 0xCF,
+    0xE9, 0x6E, 0x48, 0x80, 0xCA, 0xE9, 0x2E, 0x8F, 0xC1, 0xDC, 0x2E, 0x99, 0x12, 0x26, 0xAE, 0x9A,
+    0x4D, 0xF2, 0x3A, 0x4F, 0x77, 0xC5, 0x7E, 0x57, 0x6E, 0xFB, 0xDD, 0xBA, 0x4B, 0xEA, 0xB1, 0x2B,
+    0xD5, 0xF5, 0x36, 0x50, 0x49, 0x81, 0x3A, 0xC1, 0xF5, 0x3E, 0xCE, 0xAA, 0x4E, 0xEA, 0xF8, 0xEA,
+    0xA9, 0x3E, 0x1A, 0x1F, 0xC9, 0x24, 0x99, 0x46, 0x32, 0xAD, 0x64, 0xEA, 0xC7, 0x4C, 0xC5, 0x9A,
+    0x6D, 0xD4, 0xE3, 0xC3, 0x3D, 0xC8, 0xEC, 0x28, 0xD1, 0x52, 0xAA, 0x29, 0x26, 0x0E, 0xE4, 0x6B,
+    0xE2, 0xB0, 0xD4, 0x63, 0x0C, 0xF7, 0xE5, 0x21, 0x81, 0x02, 0xF5, 0x10, 0xDF, 0x38, 0x7F, 0x37,
+    0x4F, 0x11, 0xAC, 0xC8, 0x37, 0x78, 0x54, 0x0D, 0x56, 0x63, 0x8C, 0x24, 0x2A, 0x44, 0xD3, 0xE6,
+    0xE2, 0x77, 0x01, 0x22, 0x7F, 0xD4, 0xC5, 0x7E, 0x4F, 0x3B, 0xA3, 0x2B, 0x5A, 0x36, 0x6E, 0xD9,
+    0xFB, 0xC0, 0xA7, 0xC1, 0x85, 0x18, 0xFB, 0x79, 0xE2, 0xE1, 0x1C, 0x83, 0xDA, 0x97, 0x6A, 0x8C,
+    0x90, 0x8F, 0x8A, 0x6B, 0x54, 0xA8, 0xC3, 0x4D, 0xF2, 0x98, 0xAD, 0x5A, 0xA1, 0xFD, 0x50, 0x03,
+    0xC5, 0xDA, 0xCF, 0xD0, 0xFF, 0x34, 0x86, 0x9A, 0x07, 0xE8, 0x35, 0x83, 0x8D, 0xC9, 0x53, 0x1A,
+    0x89, 0x08, 0x46, 0x0C, 0xD9, 0x55, 0x5A, 0x49, 0x59, 0x5A, 0x55, 0x02, 0xB7, 0xD5, 0x51, 0xDF,
+    0x95, 0x30, 0xFA, 0x73, 0x05, 0xDC, 0xE2, 0xE4, 0x8D, 0x3A, 0x69, 0x70, 0x4B, 0x21, 0x3D, 0xAD,
+    0xAE, 0xD2, 0x6A, 0xE7, 0x24, 0x8E, 0x7D, 0x56, 0xCC, 0xBE, 0x51, 0x79, 0xC8, 0x76, 0x91, 0xD6,
+    0x7C, 0xBB, 0x70, 0x85, 0xFA, 0x3D, 0x35, 0xF9, 0xDA, 0x4E, 0xD4, 0xB7, 0x03, 0x46, 0x8A, 0xEC,
+    0x7F, 0xA3, 0x39, 0x12, 0x35, 0x4C, 0x5C, 0x34, 0x17, 0x8C, 0x34, 0xE1, 0x6E, 0xAB, 0x2B, 0xD6,
+    0x56, 0xB4, 0xEF, 0x29, 0x14, 0x9B, 0x95, 0xEF, 0x27, 0xA7, 0x87, 0xC5, 0x12, 0xA3, 0xA2, 0x37,
+    0x51, 0x88, 0x56, 0x49, 0x57, 0xEB, 0x35, 0x89, 0xB9, 0x5D, 0x92, 0x59, 0xDD, 0x7B, 0xC8, 0x0E,
+    0x0E, 0xA9, 0xAE, 0x2D, 0xFC, 0xB0, 0x1E, 0xF2, 0x4F, 0x56, 0xEC, 0xBB, 0x1E, 0xD7, 0x82, 0x16,
+    0x8C, 0x06, 0xAA, 0x15, 0x5A, 0x4F, 0x26, 0x4F, 0x29, 0x4F, 0xDD, 0xCF, 0x6C, 0x6E, 0x36, 0x4B,
+    0xBB, 0xD8, 0x29, 0xF9, 0xB8, 0x76, 0x4C, 0x56, 0xA1, 0xEB, 0xA2, 0xDA, 0xC4, 0xFE, 0x4E, 0xF7,
+    0x32, 0x2E, 0x23, 0x89, 0x79, 0xDF, 0x48, 0x40, 0x51, 0xA6, 0x0E, 0xAA, 0xFB, 0x1A, 0xF5, 0x92,
+    0xEE, 0x99, 0xD8, 0x68, 0xA2, 0x27, 0x67, 0xCE, 0x37, 0xEE, 0x1E, 0xF5, 0xEF, 0x2B, 0x2E, 0x90,
+    0xDA, 0x37, 0x3E, 0x48, 0x2C, 0xF3, 0xBA, 0xB1, 0x43, 0xE9, 0xCD, 0x9C, 0x87, 0x7B, 0x63, 0xD4,
+    0x45, 0xC8, 0x36, 0xDA, 0xAE, 0x1E, 0xCB, 0x39, 0x5F, 0x51, 0xB3, 0x4F, 0x80, 0xDC, 0x37, 0xDA,
+    0xA1, 0xF2, 0xC5, 0x2E, 0x49, 0xB2, 0xD0, 0xC7, 0x5A, 0x7B, 0xDD, 0x90, 0x2F, 0x34, 0x26, 0x0A,
+    0x67, 0x4C, 0x42, 0x50, 0x97, 0x94, 0xD5, 0x6A, 0xA7, 0xAB, 0xF5, 0xBA, 0xF3, 0xFD, 0x5C, 0xF8,
+    0x2C, 0xFA, 0xE9, 0x7D, 0xBB, 0x2E, 0xED, 0xB2, 0x87, 0xED, 0xF2, 0x7B, 0x77, 0xCD, 0xF9, 0xB9,
+    0xE4, 0x74, 0x77, 0xF4, 0xE6, 0x6A, 0x24, 0xDD, 0xBB, 0x2B, 0x62, 0x52, 0x05, 0xC5, 0x42, 0x35,
+    0xD1, 0x37, 0xF9, 0x4A, 0x39, 0xE3, 0x46, 0x84, 0x09, 0x58, 0x8F, 0x1B, 0xCE, 0x34, 0x33, 0x51,
+    0x04, 0x2A, 0x1F, 0x39, 0x80, 0x45, 0xA0, 0xD2, 0xD0, 0xEB, 0x29, 0x6D, 0xA5, 0xEE, 0xEB, 0x58,
+    0xAE, 0xB9, 0xD4, 0x50, 0x8B, 0x76, 0xC9, 0x35, 0x5A, 0xE1, 0xD2, 0x73, 0x1B, 0xEE, 0x1D, 0xF5,
+    0xD3, 0x4C, 0x16, 0xEB, 0xAB, 0x05, 0x65, 0xEA, 0xAA, 0xA9, 0x5A, 0xB2, 0x2D, 0x53, 0x57, 0x4F,
+    0xD5, 0x92, 0x6F, 0xB9, 0x3A, 0x37, 0xD6, 0x8B, 0x59, 0xE3, 0xF0, 0xDF, 0x3F, 0xEA, 0x33, 0x18,
+    0x1D, 0xDD, 0x38, 0x3F, 0xEA, 0xEF, 0xEF, 0x60, 0xB7, 0x11, 0xEA, 0xF3, 0xAC, 0xAB, 0xB7, 0x55,
+    0x84, 0x6A, 0x6A, 0xDF, 0xDE, 0xCA, 0x50, 0x8F, 0xE4, 0x2B, 0xD4, 0x31, 0xE4, 0xFA, 0x30, 0x92,
+    0x96, 0x09, 0x31, 0x83, 0xE9, 0xFE, 0x27, 0x51, 0x6A, 0xA6, 0x57, 0x57, 0xEA, 0xFE, 0x9E, 0x5D,
+    0x38, 0xB0, 0x4B, 0x26, 0xD4, 0xD5, 0x73, 0xB5, 0xE4, 0xFA, 0xB6, 0x3A, 0xB7, 0x54, 0x8B, 0xD1,
+    0xDB, 0xEA, 0xDA, 0x50, 0x9D, 0xD7, 0xE7, 0xCF, 0xEA, 0xD9, 0x9B, 0x0F, 0xEB, 0x59, 0xE5, 0xC9,
+    0x36, 0xA8, 0xA6, 0x5D, 0x27, 0xF2, 0xF5, 0xC2, 0x81, 0x1B, 0x75, 0x2D, 0x54, 0x8B, 0x7B, 0x5B,
+    0xC7, 0xA1, 0x0E, 0xEE, 0x58, 0xC7, 0xC1, 0x85, 0xD3, 0xBE, 0x14, 0x0F, 0xEC, 0x8B, 0x3C, 0xBD,
+    0x9A, 0x52, 0x4B, 0x22, 0x2E, 0x9F, 0x5B, 0x05, 0xFE, 0x92, 0xB3, 0xB9, 0x70, 0x29, 0xBC, 0x98,
+    0x02, 0xCB, 0x7B, 0xBE, 0x51, 0x8C, 0x21, 0xEC, 0xD9, 0x2C, 0x69, 0x54, 0x77, 0xB0, 0x2D, 0x36,
+    0xB4, 0x63, 0x7C, 0x8E, 0xC7, 0xB7, 0xAB, 0x12, 0xAB, 0x3C, 0x65, 0xA9, 0x24, 0x25, 0xB2, 0x89,
+    0x47, 0x5E, 0x25, 0x1A, 0x74, 0x95, 0xA6, 0xB4, 0x2A, 0x39, 0x9C, 0x95, 0xCE, 0xD3, 0xF8, 0x77,
+    0xD9, 0x03, 0xF5, 0x72, 0x9E, 0xF2, 0x9F, 0x0E, 0x93, 0xA5, 0x67, 0x93, 0x9E, 0xCB, 0xFD, 0xE1,
+    0xE7, 0xC4, 0x46, 0xBF, 0x7B, 0xD4, 0x8F, 0x11, 0x0C, 0xD0, 0xB8, 0xE7, 0xCF, 0xE7, 0x8A, 0x09,
+    0x00, 0x85, 0xA2, 0x06, 0xD9, 0xA4, 0x49, 0xBB, 0xB3, 0xB9, 0x24, 0x8A, 0x64, 0x36, 0xA4, 0x9C,
+    0xA8, 0x38, 0x68, 0xA4, 0xD8, 0xC9, 0x9E, 0xB3, 0x90, 0x32, 0x94, 0x81, 0x3F, 0xBD, 0x7F, 0x85,
+    0x8D, 0xB6, 0xD4, 0x44, 0x5A, 0x0B, 0x22, 0x1B, 0x24, 0x66, 0x20, 0xD6, 0xE3, 0x3E, 0xE9, 0xCA,
+    0x0D, 0xE7, 0x42, 0x92, 0xBB, 0xE6, 0x4F, 0x66, 0x22, 0x33, 0x2F, 0x2E, 0x9E, 0x55, 0x5C, 0xA8,
+    0x06, 0xA8, 0x14, 0xD3, 0x6C, 0x06, 0x2A, 0xBD, 0x12, 0xC8, 0xAE, 0x76, 0xED, 0xB0, 0x1F, 0x9A,
+    0x56, 0x7B, 0x41, 0xF4, 0xEA, 0x52, 0x92, 0x71, 0x02, 0x9D, 0xAB, 0x61, 0x4F, 0xAE, 0x6F, 0x4F,
+    0xDD, 0xD7, 0xCF, 0x0C, 0xE3, 0xB9, 0xF1, 0x85, 0x57, 0x31, 0x6B, 0xA1, 0x8E, 0x76, 0xEC, 0x03,
+    0xC5, 0x5A, 0x6A, 0xA4, 0x1D, 0x7A, 0x51, 0x06, 0xAB, 0x99, 0x7E, 0x90, 0x86, 0x32, 0x58, 0xAD,
+    0x68, 0x90, 0xBC, 0x0D, 0x56, 0x6A, 0x34, 0xE8, 0x76, 0xB0, 0xA1, 0x5A, 0xFB, 0x41, 0x6F, 0xEB,
+    0xC3, 0xCD, 0x86, 0x6A, 0x73, 0x5E, 0x2F, 0xEB, 0x67, 0xFA, 0xFE, 0x52, 0x6F, 0x76, 0xD3, 0xCB,
+    0x9A, 0x7A, 0x2D, 0xF5, 0x66, 0xA4, 0x6B, 0x9A, 0x6A, 0xCD, 0x4E, 0x99, 0xF4, 0xB4, 0xBC, 0xD5,
+    0xEC, 0x44, 0xAB, 0xA7, 0xE5, 0x8D, 0xBC, 0x53, 0xC2, 0xD9, 0x88, 0x59, 0x60, 0x66, 0x4E, 0xAB,
+    0xCF, 0x06, 0xB4, 0x4D, 0x92, 0xD8, 0x03, 0xB6, 0xEA, 0xAF, 0xB6, 0xA6, 0x88, 0x7C, 0xE1, 0x18,
+    0xB0, 0xAC, 0x97, 0x5C, 0x65, 0xC0, 0x1D, 0x6F, 0x58, 0xAF, 0xC6, 0xAC, 0x6E, 0x44, 0xCF, 0x2D,
+    0xB8, 0xF7, 0x37, 0xEC, 0xA2, 0xCE, 0x6C, 0xCE, 0x67, 0xFA, 0x7E, 0xA0, 0xFD, 0xA5, 0xA8, 0x57,
+    0x0D, 0xA5, 0x7A, 0x9F, 0x92, 0x51, 0xBE, 0x4C, 0x52, 0xE0, 0xE8, 0xF5, 0x53, 0xEE, 0xC5, 0x7C,
+    0x9E, 0x91, 0x51, 0x6D, 0xFB, 0x04, 0x1A, 0x17, 0xF6, 0x69, 0x09, 0x9A, 0x81, 0x0B, 0x3B, 0x2E,
+    0x4D, 0x71, 0xA7, 0x7F, 0x35, 0x4B, 0x58, 0x90, 0xAF, 0xA5, 0xB5, 0xDC, 0xE8, 0xDF, 0x11, 0xD6,
+    0xAB, 0x33, 0xC1, 0x8D, 0xE8, 0xB9, 0x39, 0x0A, 0x65, 0x56, 0x67, 0x36, 0x37, 0xA1, 0xEF, 0x44,
+    0xA1, 0x54, 0x27, 0x1A, 0x4A, 0xB5, 0x3E, 0xD7, 0xED, 0xB0, 0x4B, 0xFB, 0x89, 0x10, 0x56, 0x93,
+    0xF2, 0xEE, 0x7D, 0x64, 0x65, 0xD7, 0x21, 0x5E, 0x55, 0xA1, 0x2E, 0xA6, 0x36, 0xEA, 0x1C, 0x45,
+    0x38, 0x5F, 0x71, 0x03, 0xE5, 0x52, 0x79, 0xA8, 0x15, 0x76, 0x44, 0xBD, 0x78, 0xDD, 0x11, 0x4C,
+    0xB8, 0xFC, 0xB9, 0x60, 0x9F, 0x59, 0x2F, 0x1E, 0x81, 0x1B, 0xDB, 0x85, 0x62, 0x2D, 0x35, 0xD0,
+    0x8E, 0xFD, 0x4A, 0x11, 0x4A, 0x79, 0xFA, 0x41, 0x6A, 0xCA, 0x60, 0x15, 0xE8, 0x07, 0x69, 0xB4,
+    0xC1, 0x4A, 0x68, 0x90, 0x66, 0x1B, 0xEC, 0xA6, 0x41, 0x6F, 0xEB, 0x27, 0xC1, 0x86, 0x6A, 0x73,
+    0x93, 0xDE, 0xD6, 0x87, 0xB2, 0x4B, 0xBD, 0x55, 0x27, 0x7A, 0x59, 0x93, 0x6E, 0x2F, 0xF5, 0x56,
+    0x4A, 0x2F, 0x6B, 0x72, 0x5A, 0xDC, 0x96, 0x4B, 0x4F, 0xCB, 0x57, 0x9A, 0x9D, 0x90, 0x9E, 0x96,
+    0x2F, 0x34, 0x3B, 0xE1, 0x64, 0xE4, 0x73, 0xF9, 0x8B, 0xAF, 0xF2, 0x58, 0x57, 0x8F, 0x76, 0xA6,
+    0xBF, 0xB5, 0x92, 0x4B, 0x0D, 0xA5, 0x12, 0x2A, 0xCB, 0xC6, 0xE7, 0x45, 0x98, 0xAA, 0xBF, 0xDA,
+    0xBA, 0x2C, 0xC5, 0x23, 0x42, 0x2E, 0x69, 0xAC, 0x97, 0x5C, 0xB9, 0xB0, 0xDE, 0x4D, 0xC8, 0xAC,
+    0xD8, 0xD9, 0x8D, 0xE8, 0xE9, 0x0D, 0x3B, 0xBB, 0x09, 0x5D, 0xDB, 0xB0, 0x8B, 0xF3, 0x99, 0x5E,
+    0x11, 0xD5, 0xD2, 0xFA, 0x5C, 0xB7, 0x44, 0x1D, 0x92, 0xA2, 0x3E, 0xF2, 0xEA, 0x3D, 0x80, 0xC0,
+    0x7A, 0xEA, 0xD8, 0x5F, 0x78, 0x58, 0xC8, 0xF9, 0x77, 0xAA, 0x0F, 0xFF, 0xEE, 0x37, 0xCA, 0x4F,
+    0xFF, 0xD6, 0x37, 0x0A, 0x9F, 0x71, 0xA3, 0x44, 0x56, 0x65, 0x1D, 0x6D, 0x7D, 0x0F, 0x55, 0x72,
+    0xF5, 0x06, 0x78, 0xEC, 0xEE, 0xF5, 0xBF, 0x93, 0xCE, 0xEF, 0x94, 0x3E, 0xA6, 0x5E, 0x8C, 0x54,
+    0x9A, 0xC8, 0xF6, 0x04, 0xB6, 0xFC, 0x86, 0xB6, 0x98, 0xC8, 0x19, 0x79, 0xD4, 0x33, 0xB4, 0xBA,
+    0xFB, 0xC6, 0xE7, 0x83, 0xDA, 0x31, 0x68, 0x58, 0xED, 0x52, 0x90, 0x14, 0xF7, 0x9E, 0x5A, 0x4D,
+    0xBB, 0x51, 0x6D, 0xE4, 0x1A, 0x4B, 0x41, 0x1D, 0x22, 0xA9, 0xF7, 0x29, 0x0D, 0xD0, 0x4F, 0x1A,
+    0xA1, 0x3A, 0x97, 0x4E, 0x78, 0x7C, 0x36, 0x9D, 0xB0, 0x3D, 0x93, 0x4E, 0xF8, 0xBE, 0x00, 0xE7,
+    0xE5, 0xA1, 0x0E, 0x6E, 0x83, 0x4A, 0x56, 0x27, 0xFF, 0xA4, 0xD7, 0x3B, 0x31, 0x1D, 0xC5, 0xA5,
+    0x64, 0xCF, 0x3D, 0x07, 0x38, 0x66, 0xB6, 0x6C, 0xBB, 0x88, 0x44, 0xD6, 0xEB, 0xB5, 0xB3, 0xA4,
+    0xF1, 0xFC, 0xC6, 0x39, 0x6A, 0xF5, 0xC3, 0xF8, 0x2C, 0x59, 0x3F, 0x52, 0x48, 0x4D, 0x21, 0xCD,
+    0x46, 0xBF, 0x56, 0xAE, 0xA6, 0x9D, 0xD4, 0x15, 0xC1, 0x0D, 0xE8, 0x79, 0x8F, 0xFB, 0x65, 0xA0,
+    0xBC, 0x2B, 0xF2, 0xAD, 0x1D, 0xD0, 0xF7, 0x67, 0xDC, 0x87, 0xC2, 0xCD, 0x29, 0x2E, 0xB1, 0x99,
+    0x34, 0x6A, 0x4D, 0xCC, 0x76, 0x58, 0x81, 0x47, 0x5E, 0xCB, 0x5E, 0x07, 0xB3, 0x12, 0x87, 0x5D,
+    0x5D, 0x5A, 0x25, 0xC9, 0x22, 0xB5, 0xBA, 0xFC, 0x6C, 0x6A, 0xF5, 0xEF, 0x97, 0xA4, 0x23, 0xDB,
+    0x9A, 0x53, 0xB6, 0x75, 0xF6, 0x50, 0xB6, 0xF5, 0xEF, 0x5E, 0xD2, 0x7B, 0x47, 0x00, 0xFA, 0x01,
+    0xE7, 0xB1, 0x81, 0x42, 0x64, 0x1A, 0xE8, 0x3D, 0x75, 0xC0, 0x6E, 0x67, 0x32, 0x3A, 0xEF, 0xBB,
+    0x9C, 0x13, 0xF6, 0x79, 0xB2, 0xA5, 0x92, 0x6F, 0x1E, 0xA3, 0x24, 0x63, 0xA5, 0x2E, 0x65, 0xCA,
+    0xE6, 0x1A, 0x28, 0xB5, 0x9B, 0xC7, 0x7A, 0x0F, 0x75, 0x4C, 0x9D, 0x6C, 0x7D, 0xB2, 0xC0, 0xA3,
+    0xCC, 0xA3, 0x4D, 0xBE, 0x16, 0x02, 0xDC, 0x5C, 0x05, 0x40, 0x63, 0xFC, 0xA8, 0x89, 0xE6, 0x7A,
+    0xA4, 0x32, 0x78, 0xAB, 0x8E, 0x42, 0x43, 0x4C, 0x98, 0xA5, 0x8F, 0xD9, 0x92, 0xD1, 0x24, 0x8C,
+    0xB9, 0xCD, 0xBB, 0x5C, 0x4A, 0x13, 0x09, 0x6C, 0x29, 0x67, 0x96, 0xAB, 0x89, 0x78, 0xC7, 0xBD,
+    0x1D, 0x37, 0x22, 0x42, 0xD1, 0x99, 0x86, 0x52, 0xE4, 0x1A, 0x3E, 0xA3, 0xDB, 0x57, 0x63, 0x26,
+    0xA8, 0x46, 0xC8, 0x52, 0x5A, 0xF6, 0x5D, 0x0D, 0xD0, 0x8F, 0xD5, 0x12, 0xF9, 0x6F, 0x60, 0x3D,
+    0x6E, 0xA4, 0x08, 0xD8, 0x85, 0x4C, 0xE4, 0x1B, 0xF4, 0x03, 0x7D, 0x47, 0xE5, 0x71, 0x13, 0xC5,
+    0x8A, 0x5D, 0x40, 0x83, 0x5D, 0x13, 0x71, 0x8D, 0x32, 0xAA, 0x79, 0x14, 0x62, 0xB5, 0x3B, 0xFA,
+    0x78, 0x9A, 0x5A, 0xFB, 0xD6, 0x8E, 0xD7, 0x9B, 0x85, 0x9D, 0xED, 0x57, 0xCC, 0x0F, 0x4E, 0xDA,
+    0x29, 0xB5, 0x35, 0x58, 0x69, 0x8E, 0xD5, 0x66, 0xEC, 0x27, 0x5F, 0x17, 0xD6, 0xD3, 0x77, 0xD6,
+    0xE3, 0x86, 0xD3, 0x5D, 0xE5, 0x69, 0x87, 0xCA, 0xA3, 0xA1, 0xBA, 0x7B, 0x43, 0x4D, 0x95, 0x02,
+    0xE6, 0x61, 0xBF, 0x13, 0xB5, 0x9E, 0x51, 0xE3, 0x42, 0xA6, 0xC1, 0x05, 0xE2, 0x6E, 0x72, 0x01,
+    0x79, 0xB7, 0xA6, 0xDD, 0xE2, 0x56, 0x14, 0xDC, 0x86, 0xC2, 0x13, 0x6F, 0x44, 0x93, 0x86, 0x72,
+    0xC4, 0x78, 0xF2, 0x00, 0x2B, 0xF4, 0x3B, 0xD3, 0xCE, 0x7E, 0xD2, 0x1B, 0x69, 0x90, 0x66, 0xA7,
+    0xD5, 0xEA, 0x49, 0x23, 0x50, 0x83, 0x1B, 0xB1, 0x33, 0xC5, 0x4A, 0xA6, 0x86, 0x7E, 0xA4, 0x5E,
+    0xA2, 0xD2, 0x0D, 0xC8, 0x47, 0x9C, 0xF1, 0xD2, 0x95, 0x5D, 0x0D, 0x03, 0x77, 0xDE, 0x4B, 0x6F,
+    0x97, 0x5D, 0x1E, 0x71, 0x4C, 0xAE, 0x9F, 0x88, 0x56, 0x4A, 0x7E, 0xF4, 0x10, 0x8D, 0xFD, 0xF7,
+    0x2A, 0x99, 0x42, 0x13, 0xED, 0x4A, 0xA1, 0x81, 0x76, 0xA1, 0x50, 0x43, 0xEF, 0xB1, 0x22, 0xD3,
+    0x84, 0x5B, 0xCF, 0x87, 0x08, 0xC1, 0xFD, 0x9B, 0x60, 0xA4, 0x21, 0xA6, 0x27, 0x8D, 0x6E, 0xFD,
+    0x8A, 0x11, 0xB8, 0xE4, 0x00, 0x8F, 0x14, 0x2B, 0xB4, 0x23, 0xE5, 0x1A, 0xE1, 0xF6, 0x8D, 0x18,
+    0xD0, 0xD9, 0x65, 0x21, 0x40, 0x35, 0x65, 0x1B, 0xC5, 0x5A, 0x2E, 0x64, 0xEA, 0xA7, 0x48, 0x03,
+    0x8F, 0x66, 0x65, 0x11, 0x80, 0x7C, 0xFE, 0x12, 0x4A, 0xA8, 0xEE, 0x78, 0xCB, 0xAC, 0x99, 0x70,
+    0x1F, 0x6A, 0x87, 0xAC, 0xED, 0x48, 0x3E, 0xCD, 0x79, 0xCB, 0xC7, 0xAC, 0x57, 0x07, 0x22, 0x90,
+    0xBA, 0x62, 0xA5, 0xC6, 0x68, 0x6C, 0x22, 0xD9, 0x6C, 0x8C, 0xB6, 0xA7, 0x59, 0x13, 0x87, 0x67,
+    0x17, 0x5C, 0x2F, 0xB7, 0x84, 0xE4, 0x6A, 0x17, 0x9C, 0x3D, 0x83, 0x2F, 0xC5, 0x04, 0x47, 0xC7,
+    0x3E, 0x55, 0x22, 0x66, 0x31, 0xF7, 0xA7, 0x29, 0x1F, 0xF7, 0xDB, 0x7C, 0xA9, 0x3A, 0xD5, 0x06,
+    0xAD, 0xE4, 0x31, 0x11, 0x6B, 0x54, 0xF3, 0x2F, 0x93, 0xC7, 0x19, 0x11, 0xF8, 0xE8, 0x5D, 0x46,
+    0x3E, 0x43, 0x7F, 0x12, 0xE7, 0x8E, 0x8F, 0x22, 0xFB, 0xA4, 0x49, 0x84, 0xD4, 0x2C, 0x7A, 0xB5,
+    0x57, 0xE3, 0x1A, 0x17, 0x5D, 0xFB, 0xE8, 0x26, 0xD4, 0x2B, 0x0B, 0xF4, 0x73, 0xA9, 0xAE, 0x88,
+    0x44, 0x36, 0x15, 0x52, 0x64, 0x6D, 0x26, 0x72, 0xF6, 0xC4, 0x85, 0x7E, 0x4F, 0x02, 0x8B, 0x5D,
+    0xA8, 0xBB, 0x78, 0xFD, 0xA5, 0x4F, 0xC0, 0xEE, 0x7A, 0x16, 0x74, 0xD5, 0x75, 0x5A, 0xAD, 0xB8,
+    0x5F, 0x09, 0x3B, 0x66, 0x8D, 0xF1, 0xC9, 0xC2, 0xAD, 0x4F, 0x92, 0x9B, 0x5A, 0x6B, 0x49, 0x3E,
+    0x67, 0xEB, 0x33, 0xCA, 0x2D, 0x9F, 0x72, 0x7D, 0x5B, 0xBF, 0xD2, 0xCF, 0x24, 0x79, 0x49, 0x73,
+    0x2D, 0xCD, 0xFC, 0x8B, 0x7D, 0x9C, 0xC0, 0x0E, 0x7B, 0x7C, 0x21, 0xBA, 0xD4, 0x7D, 0x74, 0x5D,
+    0x45, 0x8A, 0xCA, 0x96, 0x33, 0xE2, 0x21, 0x88, 0x3C, 0xB4, 0x3A, 0x21, 0xA5, 0x7A, 0x28, 0x95,
+    0xC8, 0xDA, 0xA0, 0x5F, 0xB3, 0xBF, 0x48, 0x73, 0x70, 0x92, 0xA0, 0xDF, 0x67, 0x16, 0xE4, 0xFA,
+    0x28, 0x96, 0xCE, 0xB8, 0x0E, 0x65, 0xAC, 0x7F, 0x21, 0x29, 0xD2, 0x3D, 0x1A, 0xB2, 0x18, 0xC7,
+    0xB8, 0x18, 0xB3, 0xEE, 0xFB, 0x18, 0x00, 0x99, 0xCD, 0x44, 0xAE, 0xB1, 0xDE, 0xA8, 0x52, 0xC2,
+    0x68, 0xE4, 0x18, 0xC7, 0xC5, 0xB9, 0x97, 0xD4, 0xF1, 0x55, 0x9D, 0x49, 0x10, 0xDE, 0x4D, 0xB7,
+    0x6D, 0x8A, 0x76, 0xB4, 0x1A, 0x68, 0x6F, 0xC7, 0xD2, 0x62, 0x6D, 0x77, 0x46, 0x25, 0x72, 0x9D,
+    0x50, 0x48, 0xA3, 0xD9, 0x6E, 0x78, 0x56, 0xFE, 0x00, 0x17, 0x39, 0x76, 0xE4, 0xBA, 0x0E, 0x2E,
+    0x82, 0xD0, 0x5D, 0xE4, 0xFA, 0x17, 0xE2, 0x51, 0xFA, 0xE9, 0x6B, 0xD4, 0x4B, 0xB5, 0xDD, 0xD8,
+    0x2A, 0x49, 0x56, 0xD2, 0x53, 0x92, 0x9A, 0x8B, 0xFD, 0x79, 0xE2, 0x6B, 0xA1, 0xB3, 0x01, 0xD6,
+    0x00, 0x92, 0x26, 0x4A, 0x8D, 0x8F, 0xEF, 0xE0, 0x93, 0x54, 0x74, 0x80, 0x7D, 0xFD, 0xB0, 0x98,
+    0xD0, 0xD2, 0xEA, 0x84, 0x54, 0x8E, 0x2C, 0x25, 0xFA, 0xB5, 0xD2, 0x0C, 0x8F, 0xC7, 0x42, 0x03,
+    0x57, 0x53, 0xC9, 0xB2, 0x21, 0x72, 0x34, 0x2E, 0x43, 0xBD, 0x1A, 0x4D, 0x59, 0xD2, 0xA9, 0x77,
+    0x24, 0x69, 0x2D, 0x25, 0x69, 0xCC, 0x7A, 0x69, 0x81, 0x4A, 0x27, 0xB1, 0x90, 0xDC, 0x0E, 0x3A,
+    0x89, 0x8E, 0xEA, 0xA3, 0x37, 0xF7, 0xEE, 0x6A, 0x7C, 0xFB, 0xB4, 0x3E, 0x40, 0xA9, 0x8F, 0xA8,
+    0xA4, 0xC6, 0xDE, 0xED, 0x07, 0x33, 0x73, 0xC0, 0x0E, 0x66, 0x2E, 0xB7, 0x26, 0x1A, 0xD6, 0x65,
+    0x54, 0xB4, 0x09, 0xAA, 0x40, 0x93, 0xAB, 0xFB, 0x33, 0xFA, 0xA9, 0xBD, 0xDB, 0x2F, 0x4E, 0x0A,
+    0x2E, 0xF2, 0xFF, 0x56, 0xAE, 0xEA, 0x23, 0xF2, 0x29, 0x29, 0x57, 0x3F, 0xC3, 0x7F, 0xF6, 0x56,
+    0x5C, 0x10, 0x63, 0xE1, 0x9D, 0x53, 0x72, 0xC3, 0x46, 0x3D, 0x91, 0xC9, 0x6C, 0x90, 0xA9, 0x1F,
+    0x77, 0x4C, 0xBC, 0x58, 0x78, 0x22, 0x16, 0x5D, 0x32, 0x9F, 0x91, 0xDD, 0x1A, 0x6F, 0xC9, 0x56,
+    0x9A, 0x28, 0x62, 0x3D, 0xBA, 0x48, 0xF0, 0x9E, 0x2F, 0x0E, 0xB1, 0x76, 0xDB, 0x4E, 0xFB, 0x86,
+    0x7D, 0x67, 0x4B, 0x5D, 0xDF, 0xCD, 0x01, 0xD4, 0x8A, 0xE0, 0x7F, 0x82, 0x73, 0x56, 0xB8, 0x18,
+    0x99, 0xD6, 0x8F, 0x2B, 0xEC, 0x39, 0x2A, 0xB9, 0x46, 0xDB, 0x51, 0xAA, 0xE9, 0x17, 0xDA, 0xB5,
+    0xD8, 0xA7, 0x05, 0xE8, 0x69, 0x29, 0x66, 0x89, 0x68, 0x83, 0x6F, 0xEA, 0x9C, 0xE1, 0x67, 0x02,
+    0x6E, 0x70, 0x63, 0x3B, 0x98, 0xAD, 0x1F, 0x52, 0x9C, 0x21, 0xCD, 0x71, 0xC5, 0xBD, 0xF4, 0xAD,
+    0x7E, 0x6B, 0x32, 0x69, 0x46, 0x6F, 0x06, 0x5C, 0x73, 0x01, 0x3B, 0x24, 0x3B, 0xA1, 0xFF, 0x28,
+    0xC5, 0x48, 0x7A, 0x4D, 0xE4, 0xD1, 0x7D, 0x19, 0xBE, 0x42, 0xBD, 0x94, 0x5D, 0xB9, 0x15, 0x7A,
+    0x53, 0xAF, 0x48, 0x3A, 0x96, 0x34, 0xF6, 0xD2, 0x98, 0xDD, 0x48, 0x57, 0xD0, 0x2A, 0xD1, 0x22,
+    0x53, 0x3E, 0x43, 0x24, 0x21, 0x44, 0x42, 0x82, 0x3F, 0xAF, 0x7D, 0xE1, 0x1E, 0x11, 0x15, 0x67,
+    0x62, 0x8F, 0xAD, 0xDF, 0x43, 0x6F, 0x0F, 0x79, 0x3B, 0x32, 0x85, 0x22, 0x85, 0xA8, 0x9F, 0x49,
+    0x8B, 0xF8, 0xFD, 0x6F, 0xF3, 0x27, 0x00, 0x99, 0x3F, 0x85, 0x2D, 0xE3, 0x7D, 0xF0, 0xAF, 0xFC,
+    0x3E, 0x0E, 0x15, 0xEF, 0x83, 0x88, 0x61, 0x5E, 0x87, 0xAB, 0x4D, 0x2C, 0x78, 0x15, 0xAB, 0x5C,
+    0x21, 0x90, 0xB6, 0x32, 0x6A, 0x98, 0x3F, 0xD2, 0x51, 0xB7, 0xCB, 0x14, 0x6B, 0x07, 0xB2, 0x94,
+    0xC1, 0x53, 0xEF, 0x12, 0xC7, 0xFE, 0xD7, 0xA6, 0xD4, 0x46, 0xAD, 0x58, 0x45, 0x44, 0x1A, 0x8A,
+    0x31, 0xC6, 0x25, 0xE5, 0xC9, 0xBF, 0x39, 0x62, 0x95, 0xB2, 0x84, 0x3A, 0x38, 0x24, 0xBB, 0x42,
+    0xB6, 0xC5, 0xE3, 0x3C, 0x1B, 0x76, 0x9E, 0x4A, 0xA6, 0xD3, 0xC4, 0xF3, 0x38, 0x09, 0x3F, 0x3C,
+    0x37, 0xE5, 0x4B, 0x28, 0x6F, 0xF2, 0x65, 0x67, 0x61, 0xBA, 0x21, 0xA1, 0xA0, 0xC5, 0x42, 0xDE,
+    0xD4, 0x53, 0xF6, 0x43, 0xFA, 0xCE, 0xCE, 0x66, 0x8B, 0x38, 0xF3, 0xAE, 0x74, 0xA3, 0x91, 0x16,
+    0xEA, 0x1D, 0xDD, 0x37, 0x7F, 0x73, 0x3B, 0x4A, 0x80, 0x74, 0xBB, 0xFF, 0xFE, 0x3D, 0x1C, 0x61,
+    0xA0, 0xDC, 0xFE, 0xA7, 0xFD, 0xA2, 0xE3, 0x23, 0x9B, 0xC7, 0x48, 0xFF, 0x9F, 0x85, 0x62, 0x04,
+    0x5C, 0xBA, 0xBA, 0x5E, 0x49, 0x7E, 0xBA, 0x51, 0xAA, 0xD0, 0xA8, 0xE6, 0x81, 0xB2, 0xFA, 0x82,
+    0x42, 0xF9, 0x4F, 0xE0, 0xE2, 0x1C, 0x75, 0xCA, 0xCE, 0x51, 0x3A, 0xD6, 0x63, 0xA4, 0xA5, 0x8C,
+    0x0C, 0xF4, 0xF0, 0xC8, 0x8D, 0xBB, 0xAF, 0x53, 0x79, 0xCE, 0x56, 0x2C, 0x3C, 0x6C, 0x3F, 0xB9,
+    0x42, 0xED, 0x63, 0xD7, 0xEB, 0xBB, 0x7F, 0x4A, 0xAD, 0x85, 0x5A, 0x81, 0x5A, 0x61, 0x8F, 0xAA,
+    0xE7, 0x4B, 0x05, 0xB4, 0x3F, 0x9B, 0xC1, 0xEA, 0x79, 0x60, 0x91, 0x07, 0xFB, 0xCA, 0x06, 0x84,
+    0xEA, 0x0B, 0x50, 0x9C, 0xDB, 0x80, 0xD1, 0xFB, 0x1A, 0x70, 0xAB, 0xBB, 0xA7, 0x79, 0xAC, 0x01,
+    0x17, 0xEE, 0x6F, 0x76, 0xB8, 0xE0, 0x16, 0x72, 0x1D, 0xAB, 0xA3, 0x7E, 0x70, 0x73, 0xA9, 0x03,
+    0x46, 0x2F, 0x6B, 0xA4, 0x5D, 0x6A, 0xFD, 0x2A, 0x12, 0xC0, 0x35, 0x5B, 0x25, 0x2A, 0x6E, 0xE4,
+    0xE2, 0xAE, 0xD4, 0x92, 0x3A, 0x5A, 0xED, 0xE3, 0x9B, 0xB1, 0x98, 0x44, 0x88, 0xC5, 0x24, 0x7E,
+    0xA4, 0x2E, 0xF7, 0x1A, 0x79, 0xF1, 0x21, 0x65, 0x97, 0xF2, 0x15, 0x13, 0xDA, 0x26, 0x53, 0x35,
+    0xD2, 0xDE, 0x5A, 0xA8, 0xEE, 0x6C, 0x14, 0xC1, 0x75, 0x99, 0xEC, 0x44, 0x7B, 0x1C, 0xA8, 0xBD,
+    0x28, 0x83, 0x1B, 0x8C, 0xEC, 0x8C, 0xDE, 0x57, 0xD3, 0xCF, 0xBD, 0xB4, 0x56, 0x69, 0x0E, 0x1D,
+    0xFB, 0x78, 0x4D, 0x5B, 0x74, 0xD1, 0x80, 0x86, 0x8B, 0x37, 0xF6, 0x2B, 0x67, 0x25, 0x89, 0x5C,
+    0xFA, 0xC2, 0x84, 0xC4, 0x2F, 0x9B, 0x30, 0xB3, 0xAF, 0xBF, 0x66, 0x52, 0x26, 0xC3, 0x28, 0x69,
+    0x79, 0xE2, 0x7B, 0x0F, 0xE1, 0x03, 0x94, 0x33, 0xF6, 0xCE, 0x4A, 0x11, 0x85, 0x39, 0x45, 0x61,
+    0xFA, 0xBD, 0x30, 0x3D, 0x7D, 0x12, 0xA6, 0x0D, 0x6E, 0x34, 0x7A, 0x6E, 0xCD, 0xF5, 0x5E, 0xCA,
+    0x9E, 0x5F, 0x77, 0xE6, 0xC8, 0xE8, 0xA4, 0x25, 0xEB, 0x47, 0x78, 0xE1, 0xE0, 0x91, 0xEB, 0x14,
+    0x4B, 0xB6, 0x25, 0x2A, 0x58, 0xAE, 0x98, 0x30, 0xB0, 0x01, 0x8F, 0x6F, 0xBF, 0x87, 0x72, 0x8C,
+    0x53, 0x55, 0x8F, 0xBE, 0xD7, 0x9F, 0x66, 0xF3, 0xB4, 0x0F, 0xC9, 0xE6, 0xF9, 0x5D, 0x2B, 0x65,
+    0xDD, 0xEC, 0x56, 0xA9, 0xEC, 0x53, 0x0F, 0xD4, 0xF5, 0xDE, 0x40, 0x88, 0x86, 0x46, 0xDB, 0xF1,
+    0xFB, 0xAA, 0x9F, 0x4D, 0x74, 0xBA, 0x72, 0x0D, 0x70, 0x32, 0xC3, 0xE5, 0x97, 0x22, 0x9B, 0x21,
+    0x96, 0x4B, 0x7C, 0x48, 0xBF, 0xEA, 0x11, 0x77, 0x6B, 0xA6, 0x8A, 0x0A, 0xDB, 0x45, 0x85, 0x3D,
+    0xDE, 0x2B, 0xEC, 0x90, 0xEF, 0x14, 0xD6, 0x79, 0x35, 0x76, 0x75, 0x73, 0xA9, 0x67, 0x53, 0x1D,
+    0xE0, 0xD9, 0x25, 0x4B, 0xB5, 0x91, 0x34, 0x5D, 0xD4, 0xE9, 0xE8, 0xB9, 0x89, 0x6A, 0xA1, 0x9A,
+    0x29, 0x56, 0xCA, 0x95, 0x5C, 0x8D, 0x51, 0x13, 0x0B, 0xFA, 0xC6, 0x6A, 0x33, 0x9F, 0x53, 0xAA,
+    0x43, 0x03, 0x6E, 0xC5, 0x05, 0x8C, 0x46, 0x73, 0xDF, 0x8B, 0x10, 0x5F, 0x0C, 0x0F, 0x7C, 0xB1,
+    0xC4, 0x17, 0x1D, 0x75, 0xC0, 0x2D, 0xE4, 0x9F, 0xF1, 0xA2, 0xCB, 0x35, 0xE0, 0x16, 0xEA, 0x95,
+    0x42, 0x5D, 0xAE, 0xED, 0x4D, 0xCD, 0x91, 0x2A, 0xDE, 0x44, 0x41, 0xC7, 0xE2, 0x8A, 0x71, 0x11,
+    0x1C, 0x89, 0x09, 0x88, 0x89, 0xB1, 0xB5, 0xBF, 0xD7, 0x03, 0xB9, 0xB0, 0x01, 0x23, 0xAA, 0x40,
+    0x21, 0xEA, 0x40, 0xB9, 0xDB, 0x3F, 0x74, 0xCB, 0xD7, 0x18, 0x2D, 0x6F, 0x32, 0x41, 0x35, 0xD2,
+    0x0E, 0x14, 0x0B, 0x31, 0x50, 0x5D, 0x04, 0x70, 0x5D, 0xA6, 0x98, 0x29, 0x34, 0x60, 0x02, 0xB5,
+    0x07, 0x51, 0x06, 0x70, 0x83, 0x89, 0xB5, 0x42, 0x35, 0x62, 0xD4, 0xF4, 0xF3, 0x0E, 0xD2, 0xAC,
+    0xF6, 0xFE, 0xEC, 0x08, 0xBD, 0x12, 0x45, 0x67, 0xDB, 0x01, 0x66, 0x5F, 0x26, 0x65, 0xB5, 0xD3,
+    0x3E, 0x7A, 0xEA, 0x4E, 0x13, 0x0B, 0x22, 0x85, 0x3C, 0xA6, 0xC1, 0x5E, 0xA1, 0x6F, 0x88, 0xB7,
+    0xFC, 0x59, 0xD5, 0xB4, 0x51, 0x35, 0x77, 0xB7, 0xFC, 0xA9, 0x6A, 0xCE, 0xEA, 0xAA, 0xB5, 0x5E,
+    0x9F, 0xD7, 0xB3, 0x69, 0x72, 0x9E, 0xEB, 0xC4, 0xDE, 0xE8, 0x1E, 0xDF, 0xB6, 0x44, 0xC6, 0x6A,
+    0x9B, 0xE8, 0x03, 0xD9, 0xFF, 0xBB, 0x89, 0x04, 0xAA, 0x36, 0xEC, 0x0B, 0x49, 0x9C, 0xBB, 0xAF,
+    0x39, 0x1F, 0xC0, 0x77, 0xEB, 0xAE, 0x24, 0x5B, 0x7C, 0xC3, 0xFD, 0x7A, 0x4D, 0x9F, 0x47, 0x3B,
+    0xD7, 0x75, 0xF9, 0xFA, 0x05, 0xA6, 0x8B, 0x68, 0x2B, 0xE7, 0xFA, 0x4E, 0xE2, 0xED, 0x7F, 0x98,
+    0xC8, 0xFA, 0x73, 0x34, 0x6B, 0xEA, 0x10, 0x63, 0xF5, 0x56, 0x26, 0x59, 0x4F, 0x9D, 0xA2, 0x75,
+    0x34, 0xD6, 0x2B, 0xD6, 0xD3, 0xFB, 0x32, 0xB1, 0x67, 0x33, 0xF9, 0x42, 0x83, 0xDD, 0x70, 0xC1,
+    0x68, 0x29, 0xD4, 0x58, 0x3D, 0x29, 0xE5, 0x1A, 0x72, 0x8D, 0xD2, 0x28, 0x4F, 0xBB, 0xB4, 0x0A,
+    0x6E, 0xA1, 0x92, 0x93, 0x9E, 0x5F, 0x31, 0xBA, 0x2D, 0x7D, 0x2A, 0x90, 0x74, 0x43, 0x1A, 0xA8,
+    0xA5, 0x0F, 0x92, 0xB7, 0xE5, 0x13, 0x19, 0x71, 0xA9, 0x63, 0x21, 0xD5, 0x60, 0xA4, 0xB8, 0xBE,
+    0x24, 0xEC, 0xB6, 0xA9, 0x34, 0x42, 0xAB, 0xC1, 0x44, 0x56, 0xD4, 0xC4, 0x59, 0x26, 0x8B, 0x99,
+    0xD9, 0x57, 0x20, 0x88, 0x80, 0x4E, 0x1B, 0x2D, 0xEF, 0xD6, 0x43, 0x11, 0xCA, 0x00, 0xD5, 0xF8,
+    0xB9, 0xC5, 0xE7, 0xDA, 0x01, 0x8C, 0xDC, 0x08, 0x66, 0x73, 0x13, 0x14, 0x6B, 0xED, 0xB3, 0xA6,
+    0x0C, 0xD5, 0x5C, 0x7A, 0xBB, 0xD8, 0xA5, 0x5A, 0xAA, 0xD9, 0x06, 0x17, 0x6A, 0x5F, 0x86, 0x76,
+    0x73, 0xBE, 0xD8, 0xA4, 0x7E, 0x8A, 0xF9, 0x08, 0x46, 0x8A, 0x35, 0x52, 0x76, 0xC9, 0x02, 0x1D,
+    0x52, 0xAF, 0x06, 0xAD, 0x4E, 0xD0, 0x87, 0x4A, 0xE0, 0xBC, 0xDD, 0xE0, 0x89, 0xEB, 0x17, 0x5F,
+    0x67, 0xE7, 0xBA, 0x45, 0x8A, 0x40, 0x2A, 0x2C, 0x37, 0xEC, 0xA2, 0x5A, 0x6E, 0xEA, 0x07, 0xCC,
+    0x4A, 0x3B, 0x70, 0xA1, 0xF9, 0xAC, 0x44, 0xBC, 0x53, 0x09, 0x08, 0x8C, 0x9E, 0xDD, 0x88, 0xC5,
+    0xCB, 0xD1, 0x58, 0x07, 0x0A, 0xE1, 0x62, 0x46, 0xB3, 0xCF, 0x34, 0x64, 0x1A, 0x23, 0xA6, 0xDA,
+    0x7A, 0x0A, 0x3D, 0xAD, 0x0E, 0xAB, 0x2A, 0x40, 0xB5, 0xC6, 0xF2, 0x42, 0xB1, 0xD0, 0x65, 0xD8,
+    0x11, 0xEA, 0x72, 0x69, 0x4F, 0xC6, 0x88, 0x40, 0x41, 0xD4, 0x8D, 0xF6, 0x6C, 0x41, 0xBC, 0x6E,
+    0x0F, 0x52, 0x9D, 0x29, 0x88, 0x67, 0xCF, 0x80, 0x98, 0xEB, 0x6E, 0x5C, 0xDA, 0x00, 0x85, 0x02,
+    0xB4, 0x3F, 0x0D, 0x94, 0xA1, 0x0C, 0xF4, 0x8D, 0x09, 0x9F, 0xDB, 0xAF, 0x6A, 0xC6, 0xAC, 0xCE,
+    0x53, 0xF9, 0x76, 0xA2, 0xEF, 0x34, 0x98, 0x15, 0x0D, 0x95, 0xCF, 0xD5, 0xF4, 0x9D, 0x91, 0x59,
+    0x29, 0xB7, 0xCA, 0x63, 0x43, 0xDF, 0x51, 0x47, 0xD2, 0x9D, 0x4F, 0xB8, 0x55, 0x2C, 0x75, 0xE4,
+    0x13, 0xDE, 0x57, 0xAE, 0xC9, 0xE5, 0x88, 0x0C, 0xB5, 0x35, 0x86, 0x12, 0x4D, 0xAC, 0xB1, 0xB4,
+    0x80, 0x53, 0xB7, 0xE7, 0x88, 0x00, 0xB5, 0xAF, 0x3D, 0x68, 0xD0, 0x80, 0x91, 0x11, 0xD8, 0xD5,
+    0x06, 0x68, 0xE7, 0x76, 0x26, 0xD7, 0xCF, 0x35, 0x71, 0xE1, 0xF0, 0x9F, 0x1C, 0x7E, 0xE1, 0x64,
+    0x96, 0x2F, 0xEB, 0xF0, 0xA4, 0x0A, 0x0D, 0xAE, 0x39, 0x85, 0x3C, 0x27, 0x12, 0x17, 0xE3, 0x3E,
+    0xC8, 0xB3, 0xD2, 0x2E, 0xDD, 0x35, 0x26, 0x12, 0xC7, 0xC9, 0x35, 0xE4, 0x92, 0xE4, 0xB3, 0xA3,
+    0x23, 0x45, 0x36, 0xDD, 0x4C, 0x44, 0x77, 0x12, 0x59, 0xA5, 0x8F, 0x19, 0xCA, 0x2B, 0xD0, 0x47,
+    0x0A, 0xDE, 0xB6, 0xAB, 0x39, 0x57, 0x9E, 0x96, 0x9F, 0x2B, 0x53, 0xFF, 0xE2, 0xDA, 0xF6, 0xE3,
+    0xC3, 0x98, 0xC6, 0xF0, 0xB6, 0xF6, 0x60, 0xE7, 0x7A, 0xC6, 0xE7, 0xBB, 0x73, 0x5A, 0x3A, 0x33,
+    0xB9, 0xA7, 0x6E, 0x57, 0xD2, 0x66, 0x4B, 0xFC, 0xD6, 0x07, 0xAB, 0x96, 0x4B, 0x39, 0x11, 0x83,
+    0x93, 0x42, 0x76, 0xF4, 0xE6, 0x6E, 0xCC, 0xDD, 0x12, 0xF1, 0xAC, 0x7D, 0xDA, 0x55, 0x9B, 0x90,
+    0xE1, 0x48, 0x84, 0xF8, 0xE4, 0xB0, 0x71, 0x69, 0x2A, 0xF7, 0x2E, 0x95, 0x73, 0x08, 0x3B, 0x92,
+    0x55, 0x7F, 0x0A, 0x07, 0xA5, 0xAA, 0xA0, 0x0B, 0x29, 0x0E, 0x41, 0x76, 0xD8, 0x7C, 0xB9, 0x25,
+    0x98, 0x2B, 0xB9, 0xCB, 0x11, 0x5F, 0x9F, 0x93, 0x0B, 0xDC, 0x2E, 0xF7, 0x5F, 0xFB, 0xDF, 0x81,
+    0x04, 0x5F, 0x20, 0x7B, 0x1D, 0xD4, 0xB8, 0x11, 0xF4, 0xCA, 0xBA, 0x53, 0xED, 0x58, 0x84, 0x24,
+    0xA2, 0xBC, 0x6C, 0x00, 0xD9, 0xAB, 0x0F, 0xC6, 0xEB, 0x52, 0x46, 0x5B, 0xCC, 0x43, 0x4E, 0x95,
+    0x00, 0x87, 0x5A, 0x92, 0x78, 0xEC, 0xE8, 0x46, 0x92, 0x63, 0xB3, 0x23, 0x07, 0x27, 0x39, 0x86,
+    0x53, 0x39, 0x46, 0x91, 0x4E, 0xF7, 0xCA, 0x91, 0x44, 0x2F, 0x2E, 0xA5, 0x0E, 0x5A, 0xAD, 0x87,
+    0x57, 0xCC, 0x29, 0x5C, 0x1C, 0x01, 0xBB, 0xBF, 0xBE, 0x17, 0x8E, 0x58, 0x2F, 0xBE, 0xCA, 0x63,
+    0x9D, 0x1B, 0xAD, 0x47, 0x7F, 0x9E, 0x38, 0xC1, 0x56, 0x43, 0x4A, 0xD3, 0xFF, 0x6C, 0xF6, 0xC8,
+    0xEF, 0x52, 0xAA, 0x99, 0xAE, 0xD7, 0x1A, 0xA5, 0x67, 0xB5, 0xBA, 0x93, 0x47, 0x35, 0x98, 0xF5,
+    0x3E, 0x7A, 0x28, 0x6A, 0x8A, 0x95, 0x6A, 0xA1, 0x9D, 0x32, 0x75, 0xC5, 0x46, 0xB5, 0xD0, 0xFA,
+    0x18, 0xF7, 0xAC, 0x16, 0xDC, 0x14, 0x6D, 0xC9, 0x06, 0x4D, 0x3B, 0x1A, 0xDD, 0x99, 0xFF, 0x44,
+    0x40, 0x31, 0x45, 0xC4, 0xA3, 0x0E, 0xD0, 0x8B, 0x5C, 0x1A, 0xEC, 0x52, 0x7B, 0x37, 0x9A, 0x70,
+    0x09, 0xAE, 0x94, 0xE3, 0xCD, 0x7A, 0xBE, 0xE9, 0xD6, 0x98, 0x4E, 0x33, 0x5F, 0x2E, 0x46, 0xE0,
+    0xE0, 0x91, 0x68, 0x0F, 0x05, 0x27, 0x85, 0x7E, 0x3B, 0x7A, 0x0D, 0x2E, 0x7D, 0xFD, 0xF5, 0xB8,
+    0x5E, 0x4A, 0xD2, 0x2C, 0x49, 0x77, 0xA3, 0x34, 0x5E, 0x38, 0x78, 0xE4, 0x5F, 0x2D, 0xF9, 0xDA,
+    0x4A, 0xC7, 0xE9, 0x9F, 0x30, 0x3C, 0xBE, 0x51, 0xFB, 0xFE, 0x58, 0x76, 0x6D, 0x3F, 0xD1, 0xCF,
+    0x0E, 0x9B, 0x7A, 0xEC, 0x9F, 0xDA, 0xCA, 0xC5, 0x4D, 0xBA, 0x26, 0x1B, 0xDA, 0x3B, 0xFA, 0xAB,
+    0xA3, 0xC7, 0x5E, 0xBF, 0x6C, 0x42, 0x36, 0x7E, 0xAB, 0x7A, 0x6A, 0x84, 0xAC, 0xA9, 0xBC, 0x0B,
+    0x2F, 0xDE, 0x7C, 0xF1, 0x87, 0x2E, 0xD4, 0x4B, 0x39, 0x3D, 0xD4, 0x42, 0x76, 0x4B, 0xF2, 0xB8,
+    0x76, 0x36, 0x94, 0x9D, 0xAB, 0xD9, 0x6C, 0xFD, 0x88, 0xD4, 0xE0, 0x12, 0x6C, 0x58, 0x78, 0xC8,
+    0x76, 0x41, 0x4A, 0xB3, 0x81, 0xBA, 0x14, 0x26, 0x8F, 0x1E, 0xC5, 0xB9, 0xC3, 0xF4, 0x6B, 0xA1,
+    0xD1, 0xAD, 0x46, 0x43, 0xBD, 0xA2, 0xC9, 0x8A, 0x7E, 0x2E, 0xD4, 0xB9, 0x50, 0x68, 0x6A, 0x57,
+    0xA3, 0xC1, 0x85, 0x42, 0x5D, 0xEF, 0xAD, 0x32, 0x4D, 0xF5, 0x6A, 0x34, 0xB4, 0x9B, 0xD1, 0xE4,
+    0xB6, 0x4C, 0x93, 0xDD, 0x90, 0x2F, 0xD5, 0xB4, 0x4B, 0xFC, 0x3A, 0x76, 0x74, 0xCF, 0xAF, 0xED,
+    0x27, 0x1A, 0x5D, 0x13, 0xC3, 0xBE, 0x85, 0xAF, 0xD6, 0xF6, 0x13, 0x7D, 0xE0, 0xAB, 0x01, 0xDA,
+    0x37, 0x0E, 0x8A, 0x78, 0x47, 0xBF, 0x73, 0xF4, 0xE6, 0x7D, 0x2C, 0xD8, 0xC8, 0x11, 0x74, 0x84,
+    0xC2, 0xF7, 0xC7, 0x6B, 0x39, 0xFD, 0x03, 0xC8, 0x7F, 0xBE, 0xAC, 0x2F, 0x56, 0x1F, 0x2E, 0x97,
+    0x21, 0x7F, 0xD5, 0x78, 0xE3, 0x5B, 0xB5, 0x6A, 0x75, 0xE9, 0x30, 0x3E, 0xFF, 0x87, 0x9F, 0x14,
+    0xBE, 0xF0, 0x19, 0x7F, 0xC4, 0x5F, 0xB8, 0xF0, 0xFC, 0xC1, 0x1F, 0xF1, 0x4F, 0x01, 0x0E, 0x1E,
+    0x8B, 0x5E, 0xD6, 0xD2, 0xC6, 0xA1, 0xFB, 0xEE, 0x85, 0x83, 0x6A, 0xAE, 0x52, 0x3E, 0x8E, 0x0B,
+    0x0F, 0x1C, 0x8B, 0x7B, 0x07, 0xC0, 0x6A, 0xD0, 0x62, 0xD5, 0xE8, 0x6C, 0xB7, 0x17, 0xAB, 0x07,
+    0xFD, 0xEF, 0x87, 0x7F, 0x46, 0x4F, 0x3F, 0xB4, 0x83, 0x1B, 0xEC, 0x64, 0xE4, 0xB5, 0x5A, 0x35,
+    0x57, 0x87, 0x7D, 0x92, 0x4D, 0xFF, 0xA3, 0xD0, 0xFF, 0x5F, 0xAF, 0x3F, 0x71, 0x74, 0x64, 0xA5,
+    0x63, 0xC9, 0x4B, 0xC1, 0x0D, 0xB2, 0xDE, 0x1D, 0x07, 0xEB, 0xDD, 0x48, 0x3B, 0xAA, 0xAB, 0x67,
+    0xA3, 0xE7, 0x62, 0x48, 0x30, 0x5A, 0xCC, 0x9A, 0x13, 0xE9, 0xB5, 0x1E, 0xCE, 0xA6, 0x42, 0xBA,
+    0x71, 0x77, 0x7F, 0x85, 0x68, 0x0F, 0xB8, 0x13, 0x0D, 0x36, 0x18, 0x99, 0x6D, 0xC7, 0x8D, 0x2D,
+    0xE6, 0xEA, 0x19, 0x15, 0x3F, 0xD7, 0x9D, 0x65, 0xD5, 0x0F, 0x5D, 0xA5, 0xE7, 0xDE, 0xD1, 0xB1,
+    0x4F, 0x47, 0xB9, 0xD0, 0xB8, 0x08, 0x94, 0x58, 0xED, 0xAD, 0xD1, 0x83, 0x47, 0x22, 0xF7, 0x28,
+    0x4A, 0x6C, 0x3B, 0xFA, 0xEE, 0xC3, 0x0F, 0x70, 0xE9, 0xF0, 0xF0, 0x4A, 0x1B, 0xF9, 0xC1, 0x6B,
+    0x2B, 0xAD, 0x7C, 0xAD, 0xFC, 0x78, 0xB3, 0xB7, 0x3F, 0xFD, 0xCD, 0xF2, 0xA7, 0x70, 0x05, 0xDC,
+    0xE4, 0xB4, 0xD8, 0x48, 0xD9, 0x38, 0xB3, 0xC5, 0x09, 0x63, 0x4B, 0xBF, 0xCD, 0xEE, 0x77, 0xF7,
+    0xCE, 0xA5, 0xC3, 0x2B, 0xE5, 0xAF, 0x47, 0xE9, 0xD6, 0x6D, 0x3D, 0x5F, 0xBF, 0x74, 0xF3, 0xE6,
+    0xBF, 0xFE, 0xF9, 0xC7, 0xBF, 0xFE, 0xF3, 0x1F, 0x35, 0x60, 0x6D, 0x76, 0x9B, 0xBA, 0x29, 0xC7,
+    0x22, 0x14, 0x3F, 0x7A, 0xE7, 0xFA, 0x6B, 0x0F, 0xB8, 0x4F, 0xCB, 0xAE, 0x2F, 0x97, 0xF6, 0xD6,
+    0xF2, 0x56, 0xAA, 0xE8, 0x5C, 0x37, 0x18, 0x0F, 0x3D, 0xD8, 0x91, 0x3C, 0x3C, 0x9C, 0x9F, 0x79,
+    0xD6, 0x95, 0x7F, 0x80, 0x3A, 0x3C, 0x64, 0xB4, 0x2E, 0x7C, 0xE3, 0x86, 0xAF, 0x63, 0x2A, 0x5A,
+    0xE8, 0xA5, 0xF5, 0xD4, 0x9E, 0xCA, 0x0E, 0x1E, 0x3F, 0xAB, 0x74, 0x77, 0x8F, 0xBE, 0xFB, 0x58,
+    0xF3, 0x42, 0xFA, 0x96, 0x4C, 0x3A, 0xC4, 0xAD, 0x60, 0xEF, 0xA8, 0x08, 0xED, 0xDB, 0x91, 0x23,
+    0xA6, 0x57, 0xA4, 0x4A, 0xA1, 0xD5, 0x69, 0xEA, 0xDF, 0x63, 0x69, 0xDD, 0xF8, 0x4F, 0xC1, 0x8C,
+    0xF4, 0x55, 0xB0, 0xD2, 0xDC, 0xEA, 0xA7, 0xEF, 0x49, 0x7A, 0xEE, 0xE7, 0x0A, 0xEE, 0x9A, 0xA6,
+    0xBE, 0xDA, 0xE0, 0x66, 0x04, 0xE5, 0xAB, 0x26, 0x36, 0x3D, 0xD8, 0x0E, 0x7E, 0x98, 0x9A, 0x03,
+    0xBC, 0x14, 0xFF, 0xED, 0xD1, 0x7F, 0x70, 0xDA, 0xD1, 0x2B, 0x9C, 0x9A, 0x4B, 0x91, 0x1A, 0x9C,
+    0xE8, 0xD3, 0x79, 0x7C, 0xE1, 0x3E, 0x1B, 0x62, 0x78, 0xEC, 0x0D, 0xF2, 0xA3, 0xC6, 0x69, 0xA5,
+    0xDE, 0x62, 0x25, 0xDC, 0x9F, 0x4B, 0x9A, 0xEB, 0xCD, 0x6D, 0x56, 0xD2, 0x07, 0x1A, 0x6B, 0x29,
+    0xB4, 0x1B, 0xAD, 0xF4, 0x94, 0x3E, 0x9E, 0x5B, 0x75, 0x3B, 0x72, 0x72, 0xF4, 0x5A, 0xD3, 0xFF,
+    0x0D, 0x29, 0xF7, 0x86, 0x4E, 0x3D, 0x65, 0x07, 0x56, 0xA3, 0x7B, 0x47, 0xBA, 0x16, 0xDC, 0xFB,
+    0xAB, 0x3B, 0x0E, 0x95, 0x96, 0x7A, 0x6C, 0x95, 0x92, 0xBC, 0xCF, 0xFF, 0xCD, 0xD3, 0xC1, 0xDD,
+    0x5A, 0xDB, 0x5B, 0xA7, 0x7F, 0x93, 0xF5, 0x67, 0xD7, 0x27, 0xD3, 0x74, 0xE8, 0xD9, 0x57, 0xB3,
+    0x9B, 0xED, 0x40, 0xF7, 0x9F, 0xA7, 0x37, 0xBF, 0x52, 0x5C, 0x5B, 0xFE, 0x8B, 0x7F, 0x70, 0xAE,
+    0x1F, 0xB7, 0x46, 0x80, 0x65, 0x03, 0xB2, 0xAD, 0x5A, 0xA0, 0xD8, 0x32, 0xE9, 0x4D, 0x6D, 0x94,
+    0x11, 0xAA, 0x78, 0x24, 0x96, 0x2C, 0xFF, 0xC6, 0x0F, 0x12, 0x3F, 0xE8, 0x7A, 0x2C, 0xB6, 0x88,
+    0x3B, 0x21, 0xEB, 0xE7, 0x7A, 0x04, 0xFA, 0xE7, 0x07, 0xA0, 0xF8, 0xB8, 0x03, 0xF8, 0xEF, 0xCF,
+    0x1C, 0x7C, 0x97, 0x9F, 0x78, 0x99, 0xEC, 0xF0, 0xF0, 0xF0, 0xF0, 0x50, 0xD7, 0xAB, 0xF4, 0xDF,
+    0x0A, 0x62, 0x46, 0x6C, 0xB2, 0x63, 0x76, 0x58, 0xC8, 0x8E, 0xDD, 0x3E, 0x9E, 0xFF, 0xB6, 0x9B,
+    0xF6, 0x65, 0x46, 0x9A, 0x84, 0xB0, 0xD5, 0x9F, 0xE9, 0x79, 0x3C, 0x26, 0xE9, 0xE5, 0xE4, 0xC0,
+    0x2B, 0x97, 0x34, 0x9D, 0x9A, 0x48, 0xE7, 0x1B, 0x5A, 0x71, 0xD1, 0xFB, 0xDB, 0x35, 0xBE, 0x77,
+    0xDF, 0xDF, 0xA4, 0xAA, 0x26, 0xC5, 0xEE, 0xB2, 0x5F, 0x39, 0x5B, 0x7E, 0x3B, 0xFE, 0x9F, 0x8E,
+    0x03, 0x4E, 0x43, 0xD0, 0xA9, 0x14, 0xD9, 0xFC, 0xC4, 0x91, 0x7E, 0x75, 0xF4, 0x83, 0x9D, 0x52,
+    0xC5, 0x61, 0x4E, 0xAA, 0x15, 0xD9, 0xFC, 0xE7, 0x3F, 0xB8, 0x91, 0xE2, 0xBD, 0xD3, 0x8E, 0xEE,
+    0x56, 0xEA, 0x53, 0x4D, 0xE4, 0x91, 0x5F, 0xD4, 0x8F, 0xA8, 0xA3, 0xF6, 0xD4, 0x91, 0xDD, 0x15,
+    0xFF, 0x2D, 0x8A, 0x40, 0x43, 0xE4, 0x7C, 0x5D, 0x48, 0xF9, 0x9A, 0x33, 0x46, 0x28, 0x80, 0x06,
+    0xB7, 0x82, 0x9B, 0x77, 0xA9, 0x01, 0xFC, 0xBF, 0xD5, 0xBD, 0x5F, 0xAC, 0x1D, 0x47, 0x9A, 0x1F,
+    0xF6, 0xEB, 0xAE, 0x25, 0x1B, 0xAB, 0xB6, 0x5D, 0x7A, 0x18, 0x4E, 0x10, 0xCA, 0xBB, 0xED, 0x07,
+    0x07, 0x59, 0xCB, 0xBB, 0xAA, 0x27, 0x03, 0x41, 0xA0, 0x51, 0xB5, 0x24, 0xD8, 0x02, 0xA2, 0x07,
+    0xD2, 0x00, 0xAF, 0x64, 0xAF, 0x80, 0x68, 0x11, 0x04, 0x01, 0x2C, 0x03, 0x61, 0x02, 0x2C, 0x90,
+    0x81, 0x21, 0x4D, 0xB5, 0x44, 0x04, 0x7C, 0x98, 0x07, 0x11, 0x71, 0x66, 0x5F, 0x16, 0x81, 0xF4,
+    0xA0, 0x09, 0xA8, 0x3B, 0x49, 0x38, 0x0F, 0x46, 0x76, 0x12, 0x50, 0xAA, 0x22, 0x09, 0x98, 0x0F,
+    0x7A, 0x50, 0x4B, 0xF4, 0x40, 0x71, 0x06, 0xB6, 0x5A, 0xFF, 0xA2, 0xCD, 0xE8, 0x41, 0x45, 0xAA,
+    0x35, 0x2A, 0x52, 0x55, 0xF5, 0xCB, 0x43, 0x55, 0x9F, 0x7B, 0x49, 0x4A, 0x1A, 0x8D, 0x27, 0x41,
+    0xEC, 0x73, 0x4F, 0x57, 0xD5, 0xE9, 0x3E, 0xF7, 0x9C, 0xEE, 0xEA, 0xAA, 0xAF, 0xBE, 0xEF, 0xF7,
+    0xFD, 0xBE, 0xEF, 0x00, 0x1A, 0x80, 0x72, 0x80, 0x9C, 0x81, 0xDE, 0x03, 0x22, 0x02, 0x4D, 0xC2,
+    0x57, 0x3F, 0x48, 0x46, 0x4D, 0xF2, 0x04, 0xC9, 0x6B, 0x24, 0x03, 0x27, 0x40, 0x2F, 0x80, 0x0C,
+    0x80, 0x20, 0x00, 0x3A, 0x40, 0x7B, 0x40, 0x46, 0xA0, 0x23, 0xD0, 0xD0, 0x01, 0xC6, 0x03, 0xC3,
+    0x6D, 0x3B, 0x56, 0x60, 0x48, 0x40, 0xC7, 0x11, 0x0D, 0x67, 0xC0, 0x84, 0xB2, 0x03, 0xC0, 0xF1,
+    0x73, 0x00, 0x0C, 0x57, 0x40, 0x93, 0x0B, 0x24, 0xC9, 0x49, 0x70, 0x56, 0x19, 0x76, 0x81, 0x5E,
+    0x65, 0x44, 0xC3, 0x17, 0x38, 0xA2, 0x8F, 0xDA, 0x03, 0xF7, 0xFF, 0xD3, 0x0C, 0x00, 0x9A, 0xE4,
+    0x28, 0x48, 0xAE, 0x30, 0x24, 0xC7, 0x2E, 0xEF, 0xED, 0x9D, 0x84, 0x5E, 0x00, 0x08, 0x8E, 0x00,
+    0x74, 0x1E, 0x8F, 0xF2, 0x03, 0x92, 0xCC, 0x8A, 0x24, 0x67, 0x92, 0x8C, 0x3D, 0x49, 0x8E, 0x9A,
+    0xE4, 0x02, 0x4B, 0x06, 0xE0, 0x34, 0x3F, 0xBC, 0xFD, 0x92, 0x3B, 0xF2, 0x1C, 0x1A, 0x92, 0x13,
+    0x06, 0x32, 0x02, 0x24, 0x17, 0xF4, 0x9C, 0xEF, 0x03, 0x74, 0x40, 0xBD, 0xE4, 0x72, 0xF1, 0x90,
+    0x09, 0x00, 0x54, 0x1E, 0x01, 0x18, 0xDE, 0x04, 0x60, 0xC9, 0x19, 0x20, 0xE9, 0x01, 0x43, 0xAE,
+    0xC0, 0x7D, 0xA4, 0x07, 0x70, 0x9A, 0x1E, 0x40, 0x4F, 0x07, 0xA0, 0xE7, 0xF8, 0x10, 0xA0, 0x52,
+    0xCB, 0xA5, 0xE1, 0x3A, 0x90, 0xE4, 0x25, 0x92, 0x4C, 0x92, 0x24, 0xE7, 0x9E, 0x64, 0x40, 0x73,
+    0x9A, 0x37, 0xB7, 0x93, 0xD2, 0xFE, 0xE0, 0x4F, 0xDD, 0xF9, 0xB7, 0xAA, 0x55, 0xAD, 0x2A, 0xE8,
+    0xF2, 0x17, 0xCB, 0xDF, 0xF1, 0xE9, 0x19, 0xB9, 0xEA, 0x6B, 0x49, 0xAE, 0x3C, 0x93, 0xCD, 0x7B,
+    0xBC, 0x10, 0xAD, 0xBF, 0xF3, 0xEE, 0x0A, 0x02, 0x74, 0xD0, 0x1E, 0x32, 0x6E, 0x2F, 0x94, 0x47,
+    0x1F, 0xD1, 0x12, 0xB0, 0x77, 0xBE, 0x58, 0xD1, 0x27, 0xB4, 0x1C, 0x61, 0x17, 0xE8, 0x00, 0x99,
+    0x21, 0x38, 0x81, 0x1E, 0x3A, 0x42, 0x12, 0x82, 0x0E, 0x80, 0x5D, 0x00, 0x99, 0x01, 0x70, 0xAE,
+    0xDD, 0xC3, 0xB9, 0x8C, 0x8E, 0x86, 0xAE, 0x8C, 0x8A, 0x86, 0x0E, 0x50, 0x01, 0x68, 0x39, 0x95,
+    0x3E, 0x15, 0x1C, 0x01, 0xBD, 0xD6, 0x5E, 0xD5, 0xBE, 0x36, 0x8C, 0x2F, 0x43, 0x08, 0x76, 0x01,
+    0xFA, 0x0C, 0xC0, 0x1E, 0x7C, 0xE8, 0x70, 0xCE, 0xC4, 0x86, 0xA4, 0x53, 0x64, 0x10, 0x24, 0xA1,
+    0xC9, 0x59, 0x90, 0x01, 0xDF, 0xB5, 0xA1, 0x5E, 0xA1, 0x21, 0x17, 0xA0, 0xDE, 0x48, 0x74, 0x24,
+    0x01, 0xB4, 0x24, 0x1D, 0x00, 0x33, 0x75, 0x1E, 0xC0, 0x30, 0x37, 0x11, 0x40, 0xB7, 0xC2, 0x00,
+    0x68, 0x12, 0x06, 0x07, 0xC0, 0x8C, 0x9D, 0x07, 0xA0, 0x5C, 0x43, 0xBE, 0x8C, 0xDE, 0xC3, 0x92,
+    0x53, 0x1B, 0xA1, 0xC8, 0x15, 0x16, 0xFD, 0xCD, 0xD3, 0x84, 0x76, 0x6D, 0x84, 0x99, 0xA5, 0x87,
+    0x85, 0x0C, 0x22, 0x42, 0xB9, 0x36, 0x83, 0xE8, 0x3D, 0x38, 0x69, 0xD7, 0xA6, 0x86, 0xF3, 0xB0,
+    0xC0, 0x92, 0x5E, 0x07, 0x28, 0x32, 0xA8, 0x84, 0x9E, 0x0C, 0x3D, 0xD1, 0x92, 0x4B, 0x19, 0xA9,
+    0xC0, 0xA9, 0xDB, 0x6E, 0x4A, 0x04, 0x00, 0x48, 0x8F, 0x7E, 0x01, 0xB4, 0x83, 0x9A, 0x00, 0x02,
+    0xAF, 0x03, 0x22, 0xA2, 0x0D, 0xB7, 0x1D, 0x72, 0x00, 0x01, 0x0B, 0x08, 0x92, 0x09, 0x90, 0x24,
+    0x99, 0x47, 0xCD, 0xDD, 0x90, 0x27, 0xAF, 0x44, 0x88, 0xF4, 0x14, 0xDF, 0xF4, 0x90, 0xBE, 0xA5,
+    0x76, 0xD0, 0x4E, 0x24, 0x02, 0x84, 0xFC, 0x32, 0x42, 0x44, 0xE8, 0x77, 0x3D, 0xA4, 0xEF, 0xA8,
+    0x1D, 0x34, 0x19, 0x09, 0x90, 0xBC, 0x16, 0x21, 0xC8, 0x2C, 0x3D, 0x24, 0xF3, 0xA4, 0xDC, 0xD6,
+    0x9D, 0xA4, 0x6F, 0x48, 0x92, 0xAE, 0x23, 0x49, 0x62, 0x20, 0xC9, 0x58, 0x0F, 0x61, 0x7F, 0x8F,
+    0x1F, 0xED, 0x4F, 0xDB, 0x24, 0xAC, 0xF3, 0x03, 0x7A, 0x2D, 0xD2, 0x64, 0x2E, 0xA3, 0x6E, 0x02,
+    0x80, 0x21, 0x97, 0x8F, 0xCC, 0xFC, 0x10, 0x68, 0x48, 0x86, 0x72, 0x83, 0x56, 0x60, 0x60, 0xA6,
+    0x07, 0x4C, 0x82, 0x76, 0x68, 0xB8, 0xC0, 0x8E, 0xE8, 0x38, 0xB6, 0x09, 0x18, 0x12, 0xFA, 0x00,
+    0xD8, 0x15, 0x6A, 0x41, 0xCB, 0x19, 0x76, 0x42, 0xCF, 0xB1, 0x25, 0xA0, 0x12, 0x64, 0x04, 0x6C,
+    0x80, 0xF6, 0x68, 0xB9, 0x80, 0x0E, 0x3D, 0x5D, 0x99, 0xA8, 0xE5, 0x34, 0x00, 0xA0, 0x5F, 0x00,
+    0xA0, 0xCC, 0x5B, 0x07, 0x40, 0x04, 0x00, 0xB0, 0xE3, 0x6D, 0x33, 0x43, 0xF9, 0x9E, 0xA3, 0x20,
+    0xE8, 0xA1, 0xBD, 0x4A, 0x10, 0xEC, 0x38, 0x41, 0x2F, 0xF4, 0x10, 0x79, 0x48, 0x80, 0xF9, 0x80,
+    0x0E, 0x5D, 0xB2, 0x2B, 0x60, 0xDF, 0xCD, 0x40, 0x4F, 0x3A, 0xC0, 0x72, 0x05, 0x24, 0x09, 0x80,
+    0x9C, 0x01, 0xC9, 0x00, 0x80, 0x1C, 0x81, 0x81, 0x09, 0x68, 0xEA, 0xE5, 0x71, 0x41, 0x4B, 0x72,
+    0x82, 0xBA, 0x45, 0x42, 0xF0, 0x87, 0x8C, 0xD0, 0x41, 0xD3, 0x0B, 0x4E, 0xA4, 0xD3, 0xA1, 0x23,
+    0x1F, 0xE5, 0x34, 0xB0, 0xCA, 0xE5, 0x61, 0x05, 0x00, 0xB3, 0x1C, 0x92, 0x3E, 0x23, 0xEA, 0x3C,
+    0xFB, 0x56, 0x8F, 0x2E, 0x01, 0x80, 0x9E, 0x71, 0xCF, 0xAB, 0x22, 0xA3, 0xE1, 0xA2, 0x17, 0xE8,
+    0x2C, 0x32, 0x3A, 0x7A, 0xBD, 0xC0, 0x52, 0x10, 0x92, 0x5E, 0xFB, 0x96, 0x14, 0x84, 0xA6, 0xD7,
+    0xBE, 0x27, 0x5B, 0x82, 0x5C, 0x95, 0x57, 0x5F, 0xF0, 0x11, 0x3E, 0x4A, 0xB3, 0xAA, 0xD5, 0xBE,
+    0xC3, 0x17, 0x78, 0x22, 0x9A, 0x30, 0x7C, 0xCE, 0xB3, 0x7C, 0x9E, 0xD6, 0x9B, 0x38, 0x30, 0x77,
+    0xBC, 0x44, 0xCE, 0x26, 0x0E, 0x8C, 0x3D, 0x1D, 0x39, 0xDA, 0x28, 0xE9, 0x7B, 0x3A, 0x66, 0xD8,
+    0x24, 0xE9, 0x7A, 0xCE, 0x8C, 0xB0, 0xA9, 0x39, 0x8F, 0xFB, 0xC7, 0x2E, 0x3D, 0x99, 0x30, 0x90,
+    0x1E, 0x9A, 0x1C, 0xA1, 0x19, 0x80, 0xFB, 0x7E, 0xCD, 0xC5, 0x58, 0x87, 0xC1, 0x73, 0x82, 0xBD,
+    0x4C, 0x88, 0x24, 0x08, 0xE9, 0xFB, 0x04, 0xEB, 0x64, 0x14, 0x19, 0x2A, 0x48, 0x0F, 0xED, 0x8D,
+    0x83, 0xFD, 0x20, 0x03, 0x7C, 0x77, 0x45, 0x4B, 0x3A, 0x08, 0x66, 0xA0, 0x2F, 0x9D, 0xEE, 0x00,
+    0x9D, 0x51, 0xD6, 0x22, 0xD0, 0x01, 0x22, 0x03, 0x50, 0x2B, 0xD0, 0xD1, 0x61, 0x60, 0x06, 0x0C,
+    0x3D, 0x1A, 0x72, 0x44, 0xC7, 0x15, 0x18, 0x6E, 0x01, 0xD0, 0x0B, 0xE4, 0xCA, 0x09, 0xFA, 0x5A,
+    0x06, 0x78, 0x22, 0x40, 0xA4, 0xDF, 0x72, 0xD7, 0xCF, 0xF7, 0xEC, 0x35, 0xD6, 0x35, 0x35, 0x69,
+    0x92, 0x2B, 0x49, 0xCE, 0x18, 0x16, 0x00, 0x66, 0x02, 0x9A, 0x0C, 0xA0, 0x0B, 0x40, 0xD9, 0x75,
+    0xAC, 0x0E, 0x4D, 0x4E, 0x45, 0x8E, 0x82, 0xF3, 0x26, 0x0D, 0xFD, 0xB7, 0xB8, 0xF5, 0x8D, 0x3D,
+    0x87, 0x96, 0x84, 0x20, 0x57, 0xC1, 0x87, 0xD9, 0x10, 0x72, 0xE6, 0xFE, 0x85, 0xA8, 0x49, 0x0E,
+    0x24, 0xDF, 0x21, 0xF9, 0x2B, 0xFE, 0x68, 0x84, 0x71, 0x65, 0xA4, 0x09, 0xCE, 0xF8, 0xA9, 0x25,
+    0xA3, 0x24, 0xD9, 0x90, 0x74, 0x92, 0x5C, 0x70, 0x3A, 0x8F, 0x90, 0x6B, 0x1D, 0x47, 0x00, 0x38,
+    0x02, 0xF8, 0xF7, 0xEA, 0xBA, 0x5D, 0xD6, 0xBC, 0x11, 0x62, 0x9F, 0x00, 0xD0, 0x45, 0x00, 0x18,
+    0x6E, 0xF0, 0x5C, 0x95, 0xC1, 0x0D, 0xC9, 0x19, 0x3D, 0xBF, 0xA4, 0x83, 0x8A, 0x20, 0x60, 0x5D,
+    0x93, 0x20, 0x88, 0x6E, 0x85, 0x8C, 0x18, 0x16, 0x68, 0x0F, 0x33, 0x81, 0xAE, 0xC9, 0x10, 0x44,
+    0x17, 0x21, 0x23, 0x94, 0x87, 0xF6, 0xA0, 0x6B, 0xE8, 0x04, 0xA7, 0x8E, 0x18, 0x88, 0x21, 0xF5,
+    0x8C, 0xB0, 0xAB, 0xA6, 0xDF, 0x26, 0x97, 0xE0, 0xBA, 0x9B, 0x0E, 0xF7, 0xD7, 0xEE, 0x92, 0xAE,
+    0x08, 0xC6, 0x15, 0x9B, 0x98, 0xEC, 0x8B, 0x14, 0xD2, 0xE4, 0x4D, 0x92, 0x1F, 0x93, 0x7C, 0x37,
+    0xEF, 0xEF, 0x9B, 0x19, 0x0D, 0x27, 0x74, 0x19, 0x18, 0x02, 0x60, 0x3C, 0x1A, 0x3A, 0x74, 0x2C,
+    0x6B, 0xD5, 0xE1, 0x97, 0x09, 0x30, 0x2B, 0x9A, 0xFD, 0x73, 0x00, 0x8E, 0x94, 0x31, 0x62, 0x19,
+    0xBA, 0xD0, 0xAF, 0x7A, 0xEA, 0xAF, 0x47, 0xC8, 0x5F, 0x2C, 0x80, 0x26, 0x41, 0x46, 0x71, 0x73,
+    0xEF, 0xA4, 0xF4, 0x80, 0xFA, 0xB0, 0xCD, 0x86, 0x0C, 0x24, 0xDF, 0x26, 0x73, 0x4B, 0x7A, 0x5C,
+    0xA8, 0xCB, 0x7A, 0xCF, 0x0F, 0x31, 0x90, 0xA3, 0xBC, 0x65, 0x9D, 0x58, 0x71, 0x12, 0x11, 0x80,
+    0x9E, 0x80, 0x3E, 0x8F, 0x00, 0x39, 0xA1, 0x67, 0x06, 0x14, 0x17, 0x60, 0x88, 0x18, 0x5B, 0x4E,
+    0x3F, 0x83, 0x5D, 0xCC, 0x2D, 0x1B, 0x4C, 0xD1, 0xCB, 0x52, 0x4F, 0x26, 0x1C, 0xAF, 0x2A, 0xCC,
+    0x91, 0x93, 0xE6, 0x32, 0x1F, 0xCF, 0x3A, 0xF0, 0x0B, 0xBA, 0x6D, 0x31, 0x91, 0x5E, 0x3B, 0x1E,
+    0xAA, 0xCC, 0x25, 0x76, 0x71, 0x58, 0xED, 0xFB, 0x9C, 0xD4, 0x6C, 0x1F, 0xC9, 0x7D, 0xD0, 0x0B,
+    0xCF, 0x50, 0x46, 0x73, 0x9D, 0xFF, 0x7C, 0xFF, 0xF8, 0xF9, 0x3B, 0x56, 0x22, 0xED, 0xBE, 0xB1,
+    0xEA, 0x22, 0x60, 0x6A, 0x35, 0xA3, 0xCF, 0x75, 0xFD, 0x9F, 0xA1, 0xA7, 0x86, 0xE8, 0x23, 0xD4,
+    0x1D, 0x43, 0xB4, 0xC9, 0xE8, 0x02, 0x86, 0x05, 0x66, 0x6C, 0x13, 0xFA, 0x15, 0x6A, 0x86, 0x45,
+    0x1B, 0xD1, 0x7B, 0x28, 0x07, 0x0B, 0x11, 0x21, 0x3D, 0xB4, 0x43, 0x86, 0x08, 0x50, 0xCB, 0xBD,
+    0x1C, 0x99, 0x04, 0xBD, 0xA4, 0x33, 0x09, 0xFF, 0x68, 0x44, 0x47, 0x02, 0x3D, 0x09, 0xF4, 0xB7,
+    0x2C, 0xD0, 0xB9, 0x07, 0x6A, 0xD1, 0x97, 0x42, 0x71, 0xEA, 0x9D, 0xA2, 0xEF, 0x9D, 0x7A, 0x32,
+    0x48, 0xA7, 0x10, 0x4B, 0x31, 0xE9, 0x26, 0xCA, 0x49, 0x33, 0xD8, 0x49, 0xD3, 0xDB, 0x51, 0x73,
+    0xFA, 0xDF, 0x76, 0xA7, 0xF5, 0x1D, 0x00, 0xCD, 0x8A, 0x97, 0xD1, 0xCD, 0x62, 0xC6, 0x30, 0xCA,
+    0x11, 0xCF, 0xE1, 0x7B, 0x68, 0x56, 0xAC, 0xE8, 0x6E, 0xFD, 0xC4, 0x63, 0x20, 0x39, 0x1B, 0x92,
+    0xD7, 0x57, 0xA4, 0xD3, 0xEF, 0xCC, 0x62, 0x19, 0x5E, 0x1A, 0xE5, 0xA4, 0x9F, 0xC3, 0x43, 0x6D,
+    0x5A, 0x41, 0x7E, 0x3C, 0x0B, 0x72, 0x18, 0x25, 0x97, 0xE7, 0xCA, 0xF0, 0x5B, 0x77, 0x73, 0x44,
+    0xAE, 0x00, 0x8E, 0x30, 0xD5, 0x89, 0x22, 0xC8, 0x04, 0xFC, 0xC7, 0x17, 0x3C, 0x80, 0x86, 0xBB,
+    0x79, 0xB2, 0x53, 0x39, 0x13, 0x5A, 0x66, 0xFA, 0x32, 0x4D, 0x5A, 0xA2, 0x5B, 0xA1, 0x3D, 0xF4,
+    0x28, 0x08, 0x11, 0xA0, 0x3D, 0xF4, 0x24, 0x88, 0x2E, 0x40, 0x7B, 0x18, 0x27, 0x88, 0x3E, 0x96,
+    0x49, 0xD2, 0x11, 0x32, 0xC2, 0x94, 0xE6, 0x38, 0x44, 0xD8, 0xB5, 0xDD, 0x06, 0x82, 0x1E, 0x81,
+    0xC1, 0x01, 0x72, 0x01, 0xBA, 0xB5, 0x6A, 0xFD, 0x87, 0x24, 0x6E, 0x93, 0xFA, 0x08, 0x2B, 0x12,
+    0xD4, 0x95, 0x0C, 0x79, 0x83, 0x10, 0x91, 0x23, 0x32, 0x27, 0x68, 0x3A, 0x0C, 0x74, 0xE8, 0x38,
+    0xA3, 0xE5, 0x0A, 0x58, 0x4E, 0xD0, 0x8C, 0x90, 0x5F, 0x70, 0x16, 0x51, 0x67, 0x50, 0xD0, 0x1B,
+    0x67, 0x38, 0x8A, 0x8C, 0x2A, 0xA2, 0xF4, 0x5A, 0xB5, 0xB6, 0x72, 0x02, 0xCD, 0x57, 0xC8, 0x25,
+    0x33, 0x35, 0x7C, 0x2C, 0x40, 0x07, 0x33, 0xF5, 0x3C, 0x1B, 0x1A, 0x06, 0x33, 0x69, 0x9E, 0x0D,
+    0x3D, 0x83, 0x99, 0xC8, 0xB3, 0x41, 0x7F, 0x11, 0xCC, 0x1B, 0xC9, 0x9C, 0x8D, 0xBC, 0x1A, 0x0D,
+    0xBD, 0xB9, 0xCA, 0xDC, 0x47, 0x43, 0x67, 0xAF, 0xD2, 0xF7, 0xD1, 0x64, 0xD8, 0xAB, 0x74, 0x32,
+    0x9A, 0x15, 0xFC, 0xE7, 0xFB, 0xB8, 0xE7, 0x3C, 0x9A, 0x11, 0xE8, 0x42, 0x93, 0x31, 0x90, 0x2B,
+    0x34, 0xE9, 0x60, 0x99, 0x00, 0xCB, 0x19, 0x38, 0xFE, 0xCA, 0xB7, 0x5B, 0x25, 0x79, 0x22, 0xA2,
+    0x8B, 0x43, 0x80, 0x5A, 0xB4, 0x07, 0x47, 0xED, 0xBB, 0x08, 0x3B, 0xAB, 0x05, 0x74, 0x1C, 0x5B,
+    0x9E, 0x8D, 0x10, 0x54, 0x0B, 0x7A, 0x72, 0x84, 0x64, 0xAC, 0xF3, 0x53, 0x73, 0x04, 0x6C, 0x04,
+    0xC0, 0x05, 0x68, 0x39, 0x02, 0x7D, 0xAC, 0x6B, 0x76, 0xCF, 0x11, 0xBA, 0x58, 0x12, 0x73, 0x59,
+    0x91, 0x24, 0x97, 0xCD, 0x98, 0xA8, 0x0F, 0xB9, 0x34, 0x31, 0x63, 0x78, 0xF3, 0x5B, 0x54, 0x1F,
+    0x3D, 0x11, 0x49, 0xBE, 0x49, 0x46, 0x92, 0x4E, 0x78, 0x40, 0x03, 0xB5, 0xC2, 0xB6, 0x5E, 0xE8,
+    0x19, 0x38, 0x66, 0x3E, 0xDA, 0x83, 0x26, 0xF3, 0xA1, 0xA2, 0xC8, 0xEE, 0x43, 0xC5, 0x5A, 0x24,
+    0xE2, 0x08, 0x5D, 0x97, 0xE3, 0x08, 0xBD, 0xB6, 0x19, 0xDA, 0x23, 0x43, 0x7B, 0x58, 0xA8, 0xB5,
+    0x21, 0xD4, 0xA6, 0xEA, 0x61, 0x20, 0x33, 0x24, 0x99, 0x20, 0xAA, 0x79, 0xB4, 0x00, 0x47, 0xC6,
+    0xED, 0x7B, 0xDD, 0xDD, 0x85, 0x71, 0x80, 0x21, 0x43, 0x29, 0x8E, 0x99, 0x9F, 0x9F, 0xDC, 0xBE,
+    0x9C, 0xFF, 0x77, 0x9D, 0x13, 0x9A, 0x5C, 0xA1, 0x6F, 0x3E, 0x15, 0xA1, 0x7D, 0x9B, 0xA0, 0x3D,
+    0x12, 0xB4, 0x6F, 0x32, 0xF4, 0xAD, 0x0B, 0x09, 0x9A, 0xAC, 0x85, 0x22, 0x23, 0x24, 0x19, 0x20,
+    0x8A, 0x66, 0x0F, 0x34, 0xFF, 0x70, 0x6F, 0x6F, 0xEF, 0x47, 0xA3, 0x2C, 0xDA, 0xA8, 0x2E, 0xDA,
+    0x28, 0x49, 0xD2, 0x17, 0x0D, 0xD5, 0x09, 0xFA, 0x86, 0x11, 0x82, 0x8B, 0xE4, 0x04, 0xC1, 0x99,
+    0x01, 0x10, 0x7C, 0x93, 0x13, 0x20, 0xC8, 0x50, 0x2C, 0x83, 0xA9, 0x98, 0xBB, 0x33, 0xCA, 0x5C,
+    0x07, 0xF8, 0x69, 0xA6, 0x43, 0x1F, 0xB5, 0x2F, 0xAA, 0xDF, 0x65, 0xA2, 0x61, 0x4B, 0x91, 0x21,
+    0x63, 0x1F, 0x65, 0x84, 0x5E, 0x94, 0x1F, 0xD6, 0x96, 0xA3, 0x75, 0x66, 0x91, 0xB1, 0x25, 0xE8,
+    0x8C, 0x97, 0x51, 0xF0, 0x0C, 0x9D, 0xF1, 0x7D, 0x55, 0x3C, 0x15, 0xC9, 0xC9, 0x92, 0x59, 0x90,
+    0x8C, 0x82, 0x0D, 0x9D, 0xC8, 0x32, 0x42, 0x24, 0xEB, 0x20, 0x18, 0x81, 0xA1, 0xE8, 0x83, 0x2B,
+    0x86, 0x77, 0x3F, 0xF1, 0x48, 0xFA, 0xC4, 0xDC, 0xF9, 0x34, 0x38, 0x75, 0x66, 0xD5, 0x48, 0xFD,
+    0x9C, 0x3B, 0xAF, 0x1F, 0x89, 0xDA, 0xA5, 0x2E, 0xA0, 0x39, 0x09, 0xA0, 0x61, 0x00, 0xC7, 0x81,
+    0x41, 0x10, 0x64, 0x94, 0xB1, 0x23, 0x83, 0xF6, 0x2A, 0x58, 0xD2, 0xD9, 0xD9, 0x32, 0x0B, 0x4E,
+    0xA4, 0x97, 0x19, 0xE4, 0x28, 0x33, 0xF9, 0x21, 0x1A, 0x32, 0xA0, 0xF4, 0x5F, 0x4B, 0x32, 0x62,
+    0xE0, 0x27, 0x8C, 0xE0, 0x0A, 0xAE, 0x1D, 0x47, 0x70, 0xD1, 0x11, 0x2D, 0x1D, 0x17, 0x74, 0x7C,
+    0x94, 0x23, 0x64, 0x92, 0x09, 0xD0, 0xAB, 0x5E, 0x01, 0x2E, 0x5C, 0x20, 0xF8, 0x28, 0x1D, 0x54,
+    0x92, 0x9C, 0x1A, 0x7A, 0xC5, 0x5F, 0x5A, 0x3A, 0x43, 0x32, 0x83, 0x24, 0xD7, 0x86, 0x24, 0xA7,
+    0xF2, 0xD9, 0xC5, 0xC2, 0x2A, 0x5F, 0x89, 0xD3, 0x09, 0xC0, 0x31, 0x00, 0x2A, 0x89, 0xD8, 0x73,
+    0xD5, 0x8E, 0xBC, 0x16, 0xE5, 0x0D, 0xF2, 0x52, 0xEE, 0xB9, 0x0E, 0x5E, 0x65, 0x70, 0x48, 0x23,
+    0xC8, 0x19, 0x86, 0x1C, 0x25, 0x2F, 0xC4, 0x96, 0xA3, 0x59, 0xF4, 0xD2, 0x50, 0x44, 0xC8, 0xD5,
+    0x38, 0xF0, 0xB1, 0x88, 0x3E, 0x58, 0x07, 0x7B, 0x36, 0x42, 0x06, 0x33, 0x83, 0x67, 0x08, 0xBD,
+    0x6A, 0x92, 0x2D, 0xC9, 0x45, 0x56, 0x2B, 0x64, 0x6C, 0xC8, 0xB9, 0x80, 0x0C, 0x87, 0x1F, 0xF7,
+    0x96, 0x25, 0xB7, 0x28, 0xD4, 0xAA, 0x48, 0x3E, 0x5B, 0x5E, 0x31, 0x16, 0x8B, 0x33, 0xE8, 0x15,
+    0xE8, 0x08, 0x15, 0x01, 0x99, 0x21, 0x23, 0x20, 0x23, 0x64, 0x06, 0x54, 0x44, 0x4F, 0x40, 0x07,
+    0x74, 0x1C, 0x61, 0x57, 0x08, 0x3A, 0xD0, 0xA3, 0xA5, 0x6B, 0xB8, 0xA0, 0xE1, 0x22, 0x38, 0x03,
+    0xF4, 0x1D, 0x1D, 0x60, 0xD7, 0x9E, 0x13, 0x60, 0x82, 0xE4, 0x08, 0xE8, 0xA8, 0x08, 0x40, 0x67,
+    0x9D, 0x01, 0x0C, 0xB4, 0x09, 0x80, 0x2C, 0x06, 0xA9, 0x2C, 0x3D, 0xD4, 0x93, 0x2B, 0x00, 0x51,
+    0x80, 0x82, 0x3A, 0xB2, 0x5B, 0x72, 0x06, 0xD0, 0x14, 0x5B, 0x15, 0x65, 0x80, 0xC2, 0xF2, 0x90,
+    0xA1, 0xD2, 0x44, 0x54, 0x31, 0x23, 0x83, 0x05, 0xF4, 0xA2, 0x47, 0x98, 0x51, 0x3B, 0x10, 0xCA,
+    0x35, 0x19, 0xC3, 0xD2, 0x26, 0x48, 0x2F, 0x22, 0xFA, 0xB5, 0x0F, 0xE8, 0xA2, 0x5C, 0x21, 0x92,
+    0xF2, 0x68, 0xB3, 0x5E, 0xD0, 0xD0, 0xCE, 0x40, 0xB5, 0x5B, 0x26, 0xC0, 0x70, 0x04, 0x74, 0x39,
+    0x57, 0x54, 0x74, 0xA6, 0x39, 0x05, 0x11, 0xCB, 0xD3, 0xB2, 0x3E, 0x77, 0x7B, 0xD0, 0x9C, 0x02,
+    0xF0, 0xCC, 0x08, 0xA8, 0x05, 0xE8, 0x03, 0xC9, 0xAC, 0x49, 0xBE, 0x48, 0xF2, 0x83, 0xFF, 0x8F,
+    0xC0, 0xA2, 0xF6, 0x15, 0x60, 0xF0, 0x80, 0x71, 0x68, 0xA8, 0xC9, 0x44, 0xF2, 0x8B, 0xDF, 0x4A,
+    0x93, 0xDB, 0xE4, 0x45, 0xDA, 0x15, 0x19, 0x45, 0x18, 0x6C, 0xC5, 0x77, 0xF9, 0xF3, 0xBD, 0x93,
+    0x86, 0xE4, 0x7A, 0x50, 0x34, 0x74, 0xF5, 0x6C, 0xBF, 0xBA, 0x98, 0xBF, 0xAE, 0x58, 0xB0, 0x29,
+    0x7F, 0x74, 0x96, 0xB1, 0xBF, 0xB5, 0x3F, 0xBD, 0x0E, 0xF4, 0x0B, 0x64, 0x31, 0x04, 0xFE, 0x2E,
+    0x8B, 0xE2, 0x48, 0xE0, 0x2B, 0xAB, 0x0D, 0x96, 0xA3, 0x60, 0xD5, 0xD0, 0xBD, 0xBA, 0xB9, 0xB7,
+    0x37, 0x1A, 0x57, 0xB5, 0x89, 0x2E, 0x6D, 0x06, 0xA3, 0x99, 0x81, 0x86, 0x23, 0xD0, 0xD1, 0xAE,
+    0x05, 0x03, 0x31, 0x64, 0x6A, 0x98, 0x6D, 0xEC, 0x38, 0xAA, 0x30, 0x04, 0x68, 0x6F, 0x1D, 0xCC,
+    0x65, 0x02, 0xEC, 0x23, 0x44, 0x54, 0x1E, 0x83, 0xB7, 0xEE, 0xBB, 0xBC, 0x4C, 0x30, 0xF7, 0x49,
+    0xD0, 0xAB, 0x55, 0x72, 0xB4, 0x8B, 0xAE, 0x67, 0xBE, 0x77, 0xAA, 0xE5, 0xDA, 0x73, 0x56, 0x23,
+    0x5E, 0x43, 0xBB, 0xA2, 0x7F, 0x0B, 0x8A, 0x8B, 0xE5, 0xFB, 0x49, 0xFE, 0x62, 0x96, 0x17, 0xF0,
+    0xD0, 0x45, 0xDC, 0x5A, 0xD5, 0xA7, 0x6F, 0x51, 0x3F, 0x56, 0xEC, 0x55, 0x2F, 0x99, 0x41, 0x8F,
+    0x9E, 0x23, 0xB9, 0xA8, 0x04, 0xE8, 0x28, 0x99, 0x3A, 0x4E, 0x68, 0x38, 0x5B, 0xCE, 0xF4, 0x80,
+    0x64, 0xCF, 0x38, 0x24, 0x00, 0x3A, 0x18, 0x5E, 0xA1, 0x03, 0x5A, 0x5E, 0x65, 0xB4, 0x45, 0xB1,
+    0xD7, 0x7C, 0x33, 0x03, 0x80, 0xF9, 0x82, 0xB7, 0xAA, 0x01, 0x5C, 0xA0, 0x82, 0x0A, 0x79, 0x94,
+    0xE9, 0x5C, 0xE4, 0x76, 0x39, 0x58, 0x16, 0xD7, 0x61, 0x3B, 0x56, 0x11, 0xB9, 0x8A, 0x1C, 0xBA,
+    0xED, 0x18, 0x2B, 0xE2, 0x57, 0xA6, 0x63, 0x01, 0x36, 0x3C, 0x00, 0xCB, 0x97, 0xA8, 0x39, 0x03,
+    0x8A, 0xD7, 0x79, 0xBD, 0x2E, 0xF5, 0x03, 0xBB, 0xB2, 0xEA, 0x3D, 0x4C, 0xAF, 0x18, 0x40, 0xCE,
+    0x03, 0x41, 0x2E, 0x9A, 0xA1, 0xA1, 0x17, 0xDC, 0x94, 0xAD, 0x26, 0x6E, 0x33, 0x74, 0x70, 0xF8,
+    0xFA, 0x5D, 0xE7, 0xD1, 0xC5, 0x81, 0x8F, 0x46, 0xA8, 0x99, 0xDE, 0x4C, 0xA0, 0xA4, 0xF4, 0xE8,
+    0x02, 0x6F, 0x24, 0x40, 0xBF, 0x49, 0xED, 0xD0, 0x64, 0xFB, 0x89, 0x07, 0x7A, 0x32, 0x97, 0x53,
+    0x77, 0x1B, 0x88, 0x50, 0x61, 0x86, 0xFA, 0xC2, 0x92, 0x4B, 0x5D, 0x69, 0x20, 0x69, 0xDE, 0xCD,
+    0x10, 0xBC, 0x12, 0x75, 0x04, 0x57, 0x7D, 0x89, 0x5E, 0x67, 0x11, 0x0B, 0xF2, 0x88, 0xBE, 0x7C,
+    0xFD, 0x45, 0x1C, 0x7A, 0x01, 0x1C, 0xB5, 0x0B, 0x0A, 0x8C, 0x16, 0xE4, 0x2F, 0xED, 0x5A, 0x66,
+    0xB4, 0x76, 0x68, 0x32, 0x30, 0xAC, 0x82, 0x9C, 0x24, 0x3F, 0x84, 0xE6, 0x82, 0x27, 0xAC, 0x2F,
+    0x47, 0x8D, 0x43, 0xC3, 0x53, 0xE8, 0xD3, 0x6B, 0x8D, 0xBD, 0x41, 0xF2, 0x8D, 0x82, 0xB4, 0x7A,
+    0xCB, 0x8C, 0xD3, 0x9C, 0xD0, 0xAF, 0x80, 0x9A, 0x01, 0x3B, 0xA2, 0x4D, 0x00, 0xEE, 0x85, 0x49,
+    0x2D, 0xD3, 0xEF, 0xE2, 0x22, 0xE0, 0xD1, 0xB9, 0xE3, 0x16, 0xF4, 0x82, 0x0B, 0x86, 0x19, 0xC3,
+    0xD9, 0x87, 0xB3, 0xE2, 0x4A, 0x5E, 0x65, 0x6A, 0xF2, 0x28, 0x66, 0xA8, 0x05, 0xF4, 0xE8, 0xE7,
+    0x9E, 0xD0, 0x01, 0x9C, 0x50, 0xC0, 0x18, 0x19, 0x7A, 0x8E, 0x30, 0x8B, 0x8E, 0x68, 0xF8, 0x08,
+    0x67, 0x74, 0x49, 0x66, 0x40, 0xAD, 0xF4, 0x80, 0xBD, 0xCA, 0x11, 0x82, 0x3A, 0x02, 0x32, 0x71,
+    0x06, 0x34, 0x33, 0x00, 0xD2, 0x03, 0xA2, 0x82, 0x30, 0x11, 0x80, 0xE1, 0x0C, 0xB4, 0x24, 0xAA,
+    0x1D, 0x01, 0x5D, 0x11, 0x1B, 0x8E, 0x10, 0x24, 0x47, 0xC8, 0x44, 0x8E, 0xD0, 0x9E, 0x9C, 0x1A,
+    0x5E, 0x22, 0xA7, 0x8E, 0x0D, 0x39, 0x0D, 0xB1, 0x25, 0xB3, 0xF5, 0x55, 0x69, 0x80, 0x5C, 0x50,
+    0x2D, 0x36, 0x20, 0x63, 0x87, 0x25, 0x1D, 0x19, 0xE5, 0x6C, 0x47, 0xF9, 0x16, 0x21, 0xAF, 0x44,
+    0xC8, 0xAB, 0x01, 0xC3, 0x9B, 0x1E, 0xC3, 0xA7, 0x33, 0x14, 0x1D, 0x14, 0x8B, 0x80, 0xD5, 0xB1,
+    0xD6, 0x9C, 0xA0, 0xE9, 0x61, 0x4C, 0x84, 0x39, 0x41, 0xD8, 0x47, 0xF9, 0x2F, 0xEC, 0xC3, 0xCC,
+    0x00, 0x1E, 0xDA, 0xB6, 0xA3, 0xAF, 0x00, 0xF7, 0xEC, 0xA3, 0x2F, 0x82, 0x51, 0xAE, 0x80, 0x0E,
+    0x90, 0x2B, 0x60, 0x3D, 0xE4, 0x8A, 0x86, 0x0B, 0x64, 0x59, 0x94, 0xE4, 0x1A, 0x25, 0x47, 0x0C,
+    0x3E, 0xAA, 0x0C, 0x0C, 0xD7, 0xA3, 0x8E, 0xC0, 0x70, 0x3D, 0x32, 0x00, 0xEA, 0x7A, 0xA6, 0x2F,
+    0xA3, 0x64, 0x2E, 0x95, 0x2B, 0xD3, 0x61, 0x2E, 0xD5, 0x0A, 0xE8, 0x1B, 0x89, 0x09, 0xD0, 0x37,
+    0xA2, 0xE5, 0x08, 0x7D, 0x23, 0x2A, 0xCE, 0x30, 0xD7, 0xCF, 0x4B, 0xAE, 0x30, 0x1E, 0x82, 0x09,
+    0xC6, 0x03, 0xE4, 0x64, 0x3D, 0x60, 0xB8, 0xD8, 0x05, 0x18, 0x78, 0x48, 0x93, 0x3D, 0x06, 0xE9,
+    0x60, 0x46, 0xE9, 0x40, 0xC8, 0x49, 0x44, 0x0C, 0x53, 0x1F, 0x30, 0xBC, 0x34, 0x78, 0x0C, 0x2F,
+    0xE9, 0x19, 0xEA, 0x25, 0xEB, 0xA0, 0x48, 0x94, 0x42, 0x93, 0x0E, 0xFA, 0x82, 0xF1, 0xD0, 0xA7,
+    0x55, 0x84, 0x1E, 0x25, 0xA1, 0x47, 0xC1, 0xC9, 0x8C, 0x0D, 0x17, 0x33, 0xC2, 0x86, 0x96, 0xB0,
+    0x2B, 0xB4, 0x97, 0x84, 0xE6, 0x0D, 0xCE, 0x82, 0x34, 0x01, 0x82, 0x92, 0x80, 0x7E, 0x8F, 0x33,
+    0xBA, 0xAC, 0x23, 0x60, 0x7E, 0xC1, 0x11, 0x7D, 0xE2, 0x02, 0x58, 0x46, 0x14, 0x05, 0xBD, 0xDC,
+    0x7C, 0xC9, 0xB4, 0xAD, 0xA0, 0x92, 0x2B, 0xD0, 0x6C, 0x6A, 0xDE, 0x84, 0x86, 0xC5, 0xC4, 0x66,
+    0x40, 0xCB, 0x0B, 0xF4, 0xD0, 0xC1, 0xD2, 0x09, 0x9E, 0x21, 0xA1, 0x83, 0x64, 0x14, 0x9C, 0x0C,
+    0x57, 0x1D, 0x1A, 0x72, 0x2E, 0x5A, 0xAB, 0x2C, 0xC3, 0xA9, 0x78, 0x06, 0x80, 0x63, 0xF6, 0xE7,
+    0x63, 0xD9, 0x59, 0x50, 0x8F, 0x62, 0x55, 0x99, 0x09, 0x80, 0x5A, 0xF6, 0x46, 0xF4, 0xAB, 0x9D,
+    0xD1, 0x26, 0xB3, 0x00, 0xD6, 0x2E, 0x80, 0x2E, 0x67, 0xE4, 0x37, 0xD4, 0x82, 0x09, 0x80, 0x2E,
+    0x68, 0x61, 0xDE, 0x56, 0x7F, 0xDA, 0x0C, 0x98, 0x77, 0xE8, 0x31, 0xAC, 0x96, 0xE8, 0xB2, 0xA4,
+    0x6F, 0x39, 0x91, 0x23, 0x49, 0xD8, 0x55, 0x92, 0x5E, 0x12, 0x24, 0x5B, 0xCE, 0x47, 0xF6, 0x8C,
+    0x37, 0x01, 0x10, 0x59, 0x12, 0xB5, 0x4F, 0x6A, 0xA7, 0x94, 0x5E, 0xA9, 0xDD, 0x52, 0xFA, 0xA5,
+    0x76, 0x4C, 0xE9, 0x99, 0xDA, 0x35, 0x55, 0xBB, 0x90, 0x5C, 0xB1, 0xF5, 0x0E, 0x06, 0x72, 0x44,
+    0xED, 0x9F, 0xD2, 0x41, 0xB5, 0x87, 0x4A, 0x17, 0xA1, 0xF4, 0x51, 0xE9, 0x24, 0x94, 0x5E, 0x42,
+    0xE9, 0x26, 0xF2, 0xD1, 0x28, 0xE9, 0xCD, 0xB4, 0x67, 0xA5, 0x47, 0x77, 0x23, 0x01, 0x46, 0x3B,
+    0xF4, 0x9F, 0x78, 0xC0, 0x66, 0x40, 0xD2, 0x01, 0x05, 0x29, 0xC5, 0xD6, 0x58, 0xD0, 0x90, 0x13,
+    0x86, 0x77, 0x33, 0xDA, 0xA8, 0x23, 0xD4, 0x25, 0xFA, 0x36, 0xF6, 0x74, 0xDA, 0xA3, 0xE1, 0xA4,
+    0x57, 0x34, 0x74, 0xDF, 0xAA, 0x0C, 0x68, 0xBF, 0xA1, 0x4C, 0x7B, 0x4F, 0x72, 0xD6, 0x24, 0xBF,
+    0xAA, 0x34, 0x07, 0xE5, 0x62, 0x22, 0xC4, 0x6D, 0x65, 0x30, 0x11, 0x82, 0xB1, 0x94, 0x00, 0xD0,
+    0xDE, 0x55, 0x36, 0xA7, 0xF4, 0x28, 0xD6, 0xC3, 0x9B, 0x19, 0xBB, 0xD5, 0x8C, 0x5D, 0x30, 0xD3,
+    0xA1, 0x8D, 0xDC, 0xB6, 0x68, 0xC8, 0x68, 0x7F, 0xFE, 0x54, 0xB4, 0xAE, 0x8F, 0xD6, 0xF5, 0xB4,
+    0xAE, 0x27, 0x00, 0x55, 0xB7, 0x63, 0x6A, 0x2D, 0x8B, 0xFD, 0x5D, 0x75, 0x00, 0xF8, 0xD1, 0xDE,
+    0x9E, 0x0A, 0x45, 0xA9, 0x52, 0xA1, 0x28, 0x1E, 0xFA, 0x9B, 0xEA, 0x19, 0xD0, 0xF1, 0x6B, 0xEA,
+    0xB4, 0xF7, 0xC4, 0x26, 0x06, 0x76, 0xF5, 0xF2, 0x2D, 0xEA, 0x88, 0xB6, 0xD6, 0x82, 0xFE, 0x50,
+    0x9D, 0x4A, 0x6D, 0xB6, 0x1A, 0x1D, 0xF9, 0xB1, 0x87, 0x61, 0x36, 0xE8, 0x6E, 0xEE, 0x3D, 0xB9,
+    0xC2, 0x8C, 0x30, 0x63, 0xB7, 0xA2, 0xAB, 0xCD, 0x7E, 0x45, 0xB7, 0xC2, 0x8E, 0xB0, 0x63, 0xBF,
+    0xA2, 0x27, 0x39, 0x15, 0x17, 0xDD, 0xE1, 0x66, 0xDA, 0xE3, 0x04, 0x3B, 0xC9, 0x80, 0x3E, 0x82,
+    0x0E, 0xD6, 0xC9, 0x78, 0xA0, 0x0E, 0xD7, 0x93, 0xEA, 0x48, 0x72, 0x2A, 0x0B, 0x7C, 0xAE, 0x5E,
+    0x8B, 0x08, 0x34, 0xFC, 0xD1, 0x13, 0xF4, 0x40, 0x97, 0xD0, 0xB1, 0x40, 0x9D, 0x03, 0x8B, 0x9A,
+    0x64, 0x23, 0xD0, 0x70, 0x6C, 0xEB, 0xE1, 0xBE, 0x1E, 0x56, 0xBC, 0x70, 0x13, 0x66, 0x86, 0x25,
+    0x73, 0xC3, 0xB1, 0x25, 0xC9, 0x2E, 0xA1, 0x27, 0x6D, 0x1E, 0x56, 0x28, 0x3A, 0x19, 0xCB, 0x7F,
+    0xCB, 0x9B, 0x9C, 0x5A, 0x7A, 0xA8, 0x8F, 0x33, 0x7A, 0x3A, 0x98, 0x77, 0x03, 0x14, 0xD1, 0xD0,
+    0x2C, 0xB0, 0x11, 0x7D, 0x39, 0x7C, 0xC4, 0x96, 0xC3, 0x9A, 0x4F, 0x07, 0x28, 0x82, 0xD1, 0x2C,
+    0x60, 0x14, 0xBC, 0xC4, 0x49, 0x70, 0x2D, 0x90, 0xD1, 0x6D, 0x98, 0x37, 0xC9, 0xF1, 0xAE, 0xCA,
+    0x89, 0xAF, 0xAE, 0x26, 0xC0, 0xBA, 0x8E, 0x13, 0x60, 0xE6, 0x6F, 0xAE, 0x18, 0x4A, 0xC5, 0xB1,
+    0x54, 0xF3, 0xB1, 0xB1, 0x2B, 0x3E, 0x97, 0x8E, 0xA3, 0x0A, 0x40, 0x97, 0xD1, 0x47, 0xA0, 0x4B,
+    0x10, 0x11, 0xE8, 0xE2, 0x1D, 0x55, 0x17, 0x81, 0x2E, 0x36, 0x4F, 0x47, 0xA0, 0x4F, 0x82, 0xA1,
+    0x54, 0x2B, 0xD0, 0x67, 0xC1, 0x05, 0xE8, 0xB3, 0xC8, 0xE3, 0x5D, 0x38, 0x74, 0x71, 0xFB, 0x6C,
+    0x76, 0xCC, 0x64, 0x3E, 0x44, 0x4B, 0x9E, 0x25, 0xC7, 0x8E, 0xBC, 0x40, 0x3A, 0xC9, 0xC9, 0x92,
+    0xCB, 0x90, 0x1A, 0x4E, 0x83, 0xD7, 0x6B, 0x9B, 0x21, 0xBD, 0xF6, 0x22, 0x42, 0x7A, 0x33, 0x77,
+    0x11, 0xD2, 0x5B, 0xD7, 0x07, 0xA8, 0x52, 0xE9, 0xC5, 0xBA, 0x3E, 0x82, 0xCE, 0xCE, 0x7D, 0x6C,
+    0xE9, 0xCC, 0xD2, 0xA5, 0x9E, 0x27, 0x8D, 0xEF, 0x68, 0xE8, 0x75, 0x14, 0x24, 0x83, 0xE2, 0x23,
+    0x9B, 0x9E, 0x4C, 0xE6, 0x9E, 0x24, 0x99, 0x5A, 0x96, 0x91, 0x52, 0xAC, 0x57, 0x1C, 0xE5, 0xCD,
+    0x23, 0x77, 0x9D, 0x6C, 0x51, 0x5D, 0x01, 0x68, 0x76, 0x19, 0x92, 0x9F, 0x31, 0x35, 0x9C, 0x49,
+    0xAF, 0x17, 0xE5, 0x4C, 0x17, 0x3B, 0xDF, 0xAE, 0x76, 0x7C, 0x1D, 0xFA, 0x71, 0x2F, 0x67, 0xE1,
+    0x89, 0x04, 0x2B, 0xBD, 0x5C, 0x86, 0x85, 0x60, 0x17, 0xFB, 0x55, 0x7E, 0xCE, 0xD5, 0x38, 0x4B,
+    0x5E, 0xE1, 0xA3, 0x64, 0x52, 0x24, 0xB9, 0x90, 0xE4, 0xDA, 0x92, 0xFC, 0x10, 0x47, 0x79, 0xEE,
+    0xE0, 0xFB, 0x4E, 0xF3, 0x15, 0xC0, 0x90, 0xC5, 0x03, 0xB7, 0xF9, 0xC0, 0xC9, 0x15, 0x96, 0xBF,
+    0xBC, 0x30, 0xCA, 0xA2, 0xB1, 0x78, 0x14, 0xB5, 0x01, 0x1D, 0x27, 0x00, 0x45, 0x37, 0xE6, 0xEE,
+    0x4C, 0x65, 0x51, 0x08, 0x3D, 0x50, 0x06, 0x36, 0x18, 0x00, 0x48, 0xCE, 0x00, 0xC8, 0x7F, 0x71,
+    0xE4, 0x9F, 0x1D, 0x78, 0xBF, 0x57, 0x41, 0x92, 0xE3, 0x40, 0x32, 0xC0, 0x6E, 0x86, 0x7B, 0x40,
+    0x57, 0xBC, 0x52, 0xE5, 0xBF, 0x97, 0xCD, 0x0A, 0x6C, 0x77, 0x37, 0xF3, 0xF4, 0x4D, 0x0C, 0x0C,
+    0x4D, 0x31, 0xB7, 0x27, 0x3B, 0x43, 0xA4, 0x9D, 0x3D, 0xD6, 0xB2, 0x18, 0xA3, 0xC3, 0x5A, 0x8C,
+    0x3C, 0xAE, 0xDF, 0x6F, 0xCA, 0xD5, 0xAE, 0x3D, 0xE9, 0x8F, 0xD9, 0x9B, 0x30, 0x01, 0x2D, 0x5D,
+    0xF1, 0xE0, 0x91, 0xE4, 0x27, 0x24, 0x99, 0xEF, 0x6C, 0x2E, 0xD5, 0x4C, 0xB7, 0xF3, 0xCE, 0x62,
+    0xB7, 0x0B, 0xAA, 0xCF, 0xE3, 0x70, 0x93, 0xCB, 0x0E, 0xF5, 0x3F, 0xDC, 0xF4, 0x5F, 0xD1, 0x2D,
+    0xB7, 0x35, 0x6F, 0x8D, 0x07, 0xAE, 0xB9, 0x69, 0xA7, 0xB6, 0xE9, 0xDB, 0x9A, 0xBA, 0x18, 0xB3,
+    0x59, 0x93, 0xF9, 0xFE, 0xA7, 0x3E, 0x7F, 0x15, 0xBD, 0xC7, 0x37, 0x6E, 0xF2, 0xF0, 0xC6, 0xFA,
+    0x5D, 0x43, 0xDD, 0x8E, 0x43, 0x7B, 0x40, 0xAF, 0x76, 0x41, 0x43, 0xC7, 0x19, 0x32, 0xB5, 0x74,
+    0x30, 0x5E, 0x70, 0x14, 0x9C, 0x7A, 0x62, 0x88, 0x18, 0x12, 0xB8, 0x40, 0xC7, 0x8E, 0x80, 0x59,
+    0x75, 0x00, 0x78, 0x9D, 0x0E, 0x0D, 0xDF, 0x2D, 0x7A, 0xC1, 0xBA, 0xB9, 0x19, 0xCB, 0xA2, 0xAD,
+    0xEA, 0xF0, 0x1C, 0x51, 0x91, 0xC7, 0x62, 0x5C, 0x96, 0xB1, 0x51, 0x10, 0x0E, 0x1B, 0xB0, 0x8D,
+    0x1B, 0x49, 0x87, 0x6A, 0xDE, 0x83, 0x11, 0xD0, 0x0B, 0xCC, 0x35, 0xA2, 0x8F, 0xC3, 0x0A, 0x4E,
+    0x9C, 0x86, 0xB5, 0x8F, 0x2D, 0x61, 0x66, 0xBD, 0x88, 0xDC, 0x25, 0x28, 0x4F, 0xD7, 0xF0, 0x44,
+    0x80, 0x4C, 0x04, 0x2C, 0x3D, 0xBA, 0x82, 0x60, 0x3B, 0xB4, 0x8C, 0x80, 0xE4, 0x58, 0x3A, 0xB5,
+    0x67, 0xF5, 0x44, 0xDD, 0xDD, 0x38, 0xB2, 0x87, 0xED, 0xBA, 0xFD, 0x37, 0x5C, 0xB7, 0xBC, 0xFB,
+    0xBA, 0x6F, 0xD0, 0xA1, 0xE1, 0xA7, 0x79, 0x03, 0x45, 0x3A, 0x72, 0xC2, 0xB1, 0xD3, 0xCC, 0xA7,
+    0x60, 0xB7, 0x29, 0x54, 0x78, 0x12, 0x1C, 0x7F, 0xB3, 0xEB, 0x96, 0x01, 0xC3, 0xAA, 0x3D, 0xAC,
+    0x33, 0xB3, 0xC8, 0xE0, 0x34, 0xAC, 0x2D, 0x61, 0x5D, 0x97, 0x44, 0x86, 0x0C, 0xC3, 0x0A, 0xE5,
+    0xE9, 0x60, 0xAE, 0x65, 0x80, 0xEF, 0xFA, 0xE2, 0x46, 0xEC, 0x8A, 0x6F, 0xDD, 0x03, 0x8A, 0xAE,
+    0xD9, 0xB3, 0x79, 0xEF, 0x04, 0x49, 0x6A, 0x16, 0x10, 0xB6, 0x80, 0xF5, 0xE5, 0x9A, 0x5B, 0xBA,
+    0xDA, 0x03, 0xC7, 0x4E, 0x15, 0xE0, 0x61, 0x58, 0x65, 0x02, 0xB4, 0x2F, 0x04, 0x8B, 0x96, 0xAE,
+    0xE5, 0x04, 0x2E, 0xE5, 0x6A, 0x65, 0x02, 0x74, 0xD4, 0x01, 0x90, 0xB9, 0xF4, 0x1D, 0x17, 0x40,
+    0x6C, 0x86, 0xDE, 0x08, 0x80, 0x45, 0xA1, 0x8C, 0x45, 0x6C, 0x62, 0xDB, 0x2F, 0xEA, 0x50, 0xA8,
+    0x2A, 0xFD, 0x0A, 0xE8, 0x64, 0x23, 0xC0, 0xA8, 0x89, 0x96, 0x5E, 0x71, 0xEA, 0xB8, 0x48, 0x3A,
+    0x49, 0xD7, 0xD3, 0x2B, 0x8E, 0x3D, 0x83, 0x21, 0xFA, 0xA2, 0x04, 0x7A, 0x7C, 0x65, 0x09, 0x40,
+    0xCE, 0x30, 0x4D, 0x84, 0x1E, 0xB5, 0x53, 0x4E, 0x84, 0xC1, 0xC1, 0x9E, 0x58, 0x20, 0xE9, 0xD1,
+    0xB0, 0x58, 0x1E, 0xE8, 0x62, 0x21, 0x6F, 0x34, 0x5C, 0x01, 0x12, 0xA0, 0xF5, 0xB0, 0x57, 0x13,
+    0xCC, 0x6C, 0x9D, 0xF6, 0x43, 0x54, 0xBE, 0xE3, 0x84, 0xC6, 0x03, 0x78, 0x16, 0xC0, 0x00, 0x4D,
+    0xF2, 0xD1, 0x82, 0xB3, 0x48, 0x2F, 0x48, 0xAE, 0xDA, 0x49, 0x92, 0x33, 0x01, 0x91, 0x21, 0xCA,
+    0x9D, 0x91, 0x1E, 0xD0, 0x0B, 0xB4, 0x03, 0x38, 0xE1, 0xDF, 0xFC, 0x10, 0xF7, 0x9E, 0x4C, 0x27,
+    0x0B, 0x32, 0xB0, 0x14, 0x5D, 0x65, 0x02, 0x49, 0xE6, 0x82, 0x1B, 0x84, 0xED, 0xD0, 0xE6, 0x56,
+    0xAD, 0xBE, 0xE0, 0x82, 0x54, 0x15, 0xA7, 0xEF, 0xC1, 0x21, 0x60, 0x7F, 0xFF, 0xFC, 0x31, 0x41,
+    0xFA, 0x28, 0xC9, 0x2B, 0x1E, 0x6A, 0x92, 0x0E, 0xAF, 0x43, 0xA3, 0x0D, 0x88, 0xE8, 0x17, 0xF1,
+    0xF5, 0xBB, 0x6C, 0x1D, 0xAB, 0x73, 0x4F, 0x72, 0x54, 0x64, 0x42, 0x71, 0x49, 0x42, 0xCE, 0xD5,
+    0x2B, 0x83, 0x57, 0x8F, 0x8D, 0xD8, 0x1B, 0xED, 0x02, 0x3A, 0xB3, 0x80, 0xCE, 0xCC, 0x5B, 0xA1,
+    0x67, 0x58, 0xA7, 0xDD, 0x9D, 0x05, 0x9D, 0x9A, 0x1B, 0xBA, 0xC1, 0x77, 0x74, 0x92, 0xA4, 0xEB,
+    0x49, 0xBA, 0x82, 0xB9, 0x1E, 0xFF, 0x31, 0xDD, 0x46, 0x12, 0xF8, 0xAA, 0xC2, 0xBA, 0x0D, 0xF7,
+    0x3C, 0x28, 0x4C, 0x02, 0x20, 0x6E, 0x2F, 0x7A, 0xDF, 0x7B, 0x0B, 0xD3, 0xFB, 0xCE, 0x1B, 0xE8,
+    0x6E, 0x11, 0xFE, 0x21, 0x68, 0xB1, 0x74, 0x5E, 0x3F, 0xCC, 0x96, 0xF4, 0x92, 0xC4, 0xF1, 0x3F,
+    0xF7, 0x80, 0x01, 0xBA, 0x52, 0x89, 0x9B, 0x80, 0xF6, 0x10, 0x2C, 0x93, 0xBE, 0x1E, 0x00, 0xF4,
+    0x28, 0xA2, 0x1E, 0x45, 0xD4, 0x28, 0x9B, 0x81, 0x88, 0x3F, 0x80, 0x88, 0xCF, 0x69, 0x11, 0x5F,
+    0xD3, 0x22, 0xBE, 0xA6, 0xBB, 0x68, 0xB5, 0x8C, 0x96, 0x26, 0x56, 0xBF, 0x66, 0x1C, 0x98, 0xA3,
+    0xE0, 0xF5, 0x08, 0xF3, 0x48, 0x84, 0x6E, 0x23, 0x74, 0x9B, 0xA0, 0xDB, 0x04, 0x94, 0xED, 0x6F,
+    0xE1, 0x95, 0x55, 0x7C, 0xE0, 0xE4, 0x8B, 0x78, 0xE8, 0xD9, 0x93, 0x37, 0x3F, 0xBE, 0xFA, 0xF1,
+    0xBB, 0xEA, 0xA5, 0x94, 0x35, 0x83, 0xE5, 0x62, 0x5E, 0x9C, 0x9E, 0xD5, 0x8D, 0x8F, 0xCD, 0xA3,
+    0x1E, 0xD2, 0x69, 0x57, 0x29, 0x35, 0xDA, 0xD5, 0x4B, 0xD3, 0xF3, 0xE1, 0x46, 0xAE, 0xB7, 0xBB,
+    0x34, 0xBE, 0xE4, 0xB9, 0x8E, 0xE4, 0x64, 0xC8, 0xD4, 0x31, 0xD3, 0x9B, 0x15, 0xEC, 0x32, 0xFA,
+    0xD5, 0xCC, 0xB0, 0x8F, 0x25, 0xF4, 0xC1, 0x38, 0xD8, 0xB3, 0x09, 0x7D, 0x34, 0x33, 0xEC, 0xD5,
+    0x04, 0x19, 0xCD, 0x02, 0x5E, 0xCD, 0x90, 0xD1, 0x78, 0xD0, 0xC9, 0xB5, 0xFA, 0xFD, 0x0E, 0x1A,
+    0x1E, 0x05, 0xBA, 0x93, 0xBE, 0x62, 0x74, 0xC3, 0x0D, 0x9E, 0x6B, 0x48, 0x4E, 0x03, 0x99, 0x5A,
+    0x66, 0x7A, 0x15, 0xC1, 0x96, 0xE8, 0x56, 0xED, 0xA1, 0x1F, 0x25, 0x44, 0xD0, 0x1E, 0xFA, 0x0C,
+    0xD1, 0x05, 0xED, 0x61, 0xAE, 0xB0, 0xD0, 0xDF, 0x78, 0x95, 0xF5, 0x7B, 0xAE, 0x72, 0x1C, 0xE2,
+    0xCE, 0xC1, 0xD7, 0x3C, 0x33, 0x56, 0xF2, 0x5A, 0x1D, 0xC7, 0x15, 0x1C, 0xDB, 0xF0, 0x2F, 0xC9,
+    0xD1, 0x78, 0x19, 0xD1, 0xE7, 0xC2, 0x9D, 0x10, 0x6C, 0xF6, 0xAC, 0x2B, 0xFC, 0x20, 0xFA, 0x42,
+    0x17, 0xDA, 0xD4, 0xA3, 0xE2, 0xAD, 0x28, 0x62, 0xED, 0xC8, 0x53, 0xE4, 0xFE, 0x29, 0x54, 0x58,
+    0x13, 0x95, 0x9C, 0x85, 0xDD, 0x52, 0x5A, 0x8D, 0xD8, 0x3F, 0x00, 0x60, 0xF9, 0x61, 0xF3, 0xFA,
+    0x86, 0xC7, 0x4D, 0x85, 0x65, 0xC5, 0xA5, 0x02, 0x6E, 0xA1, 0xD2, 0xAE, 0x72, 0x3D, 0xA9, 0x02,
+    0xE6, 0x9E, 0xCE, 0xE7, 0x00, 0x40, 0x7D, 0x08, 0xA0, 0x2F, 0xEB, 0xF1, 0xA7, 0xE1, 0xF8, 0xD4,
+    0xAF, 0x62, 0xB5, 0xD0, 0xCF, 0x3F, 0x75, 0x83, 0x24, 0x79, 0x95, 0x24, 0xF9, 0x18, 0x0B, 0xC3,
+    0x89, 0x7B, 0x3B, 0x8E, 0x54, 0x1F, 0xD1, 0x00, 0x03, 0x7F, 0xF4, 0x1A, 0x8A, 0x03, 0xA9, 0x12,
+    0x11, 0x14, 0x09, 0xE0, 0x78, 0xD1, 0xAF, 0x9A, 0xFD, 0xB1, 0x7A, 0x61, 0x56, 0x94, 0x93, 0xC8,
+    0x15, 0x7E, 0xAD, 0xEB, 0x45, 0x63, 0x67, 0xBB, 0x40, 0x7B, 0x0C, 0xDE, 0x2E, 0xB0, 0xCB, 0xDE,
+    0xD3, 0x6B, 0xBD, 0xFC, 0x60, 0x4A, 0x1D, 0x6B, 0xFF, 0x54, 0x2D, 0x92, 0x09, 0xCD, 0x93, 0xE4,
+    0x2F, 0xF7, 0x76, 0x3C, 0x9C, 0xCA, 0x64, 0x03, 0xD0, 0x56, 0xB7, 0x43, 0xC3, 0x00, 0xFC, 0x75,
+    0x00, 0xE4, 0xB9, 0x26, 0x56, 0x4D, 0x3E, 0xD6, 0xCE, 0x88, 0xF5, 0xC6, 0x6C, 0x94, 0xB4, 0x58,
+    0xF1, 0xC9, 0x0F, 0xCB, 0x89, 0x55, 0x76, 0x80, 0xC5, 0x37, 0xD7, 0xCF, 0xE0, 0x50, 0xDF, 0x95,
+    0xAF, 0x88, 0xC7, 0xA7, 0x2E, 0xB4, 0xC1, 0x42, 0x5F, 0x7A, 0xB2, 0xF4, 0xDD, 0x35, 0x92, 0xE4,
+    0xD9, 0x22, 0xFB, 0xC0, 0x1F, 0xED, 0x4C, 0xD5, 0x3E, 0xA2, 0x19, 0x31, 0xF0, 0x47, 0xAF, 0x6F,
+    0xC6, 0xBD, 0xDE, 0x0C, 0xBB, 0x11, 0xB8, 0x8F, 0xE7, 0x00, 0x74, 0x33, 0x00, 0x0C, 0x23, 0x00,
+    0x3C, 0xF7, 0x6F, 0xC2, 0x41, 0xBC, 0x9D, 0x4B, 0x50, 0x4E, 0x5C, 0xE4, 0x27, 0x58, 0xBB, 0x6A,
+    0x63, 0x37, 0x6D, 0x60, 0x2D, 0xCC, 0x86, 0x8E, 0x1F, 0x7D, 0x15, 0xBF, 0xFD, 0xA3, 0xE1, 0x22,
+    0xB9, 0x48, 0x16, 0x08, 0x7A, 0xD6, 0xB1, 0x00, 0xCF, 0xB3, 0x09, 0x80, 0x4A, 0x92, 0x6E, 0xC3,
+    0x9D, 0x2F, 0x71, 0x06, 0x3A, 0x3E, 0x5E, 0x60, 0x67, 0xC1, 0xAB, 0x7C, 0xA3, 0xA8, 0x0B, 0x1F,
+    0x57, 0xD4, 0xD9, 0x7E, 0xC1, 0x0B, 0x71, 0xC3, 0x8E, 0x77, 0xF3, 0xCA, 0x6F, 0xE8, 0xB3, 0xDB,
+    0x30, 0xE7, 0xA9, 0x5E, 0x17, 0x77, 0xE6, 0xE8, 0xC6, 0x28, 0xAD, 0x94, 0xB7, 0xED, 0xBF, 0xB6,
+    0xD1, 0x50, 0x0C, 0x91, 0x3A, 0x1C, 0xAB, 0xE1, 0xFD, 0x05, 0xDF, 0x2D, 0xAB, 0xEA, 0x1B, 0x7C,
+    0xA3, 0xC0, 0xCD, 0x3D, 0x2F, 0x93, 0xD3, 0xC0, 0xD4, 0xD3, 0x91, 0x8B, 0x61, 0x90, 0x9C, 0xF5,
+    0x61, 0xD0, 0x0D, 0x66, 0x2C, 0x58, 0x64, 0x97, 0x9E, 0x4C, 0x1B, 0xCA, 0xED, 0xEA, 0xD9, 0xAC,
+    0xD5, 0xDF, 0x90, 0x7E, 0xCB, 0xBE, 0x95, 0xA9, 0xA1, 0xEF, 0x33, 0x60, 0xFD, 0xC0, 0x86, 0x33,
+    0x04, 0x9F, 0xA7, 0xD7, 0x11, 0x18, 0x92, 0x64, 0x55, 0xFA, 0xE8, 0x39, 0x03, 0x82, 0x2F, 0x66,
+    0x1D, 0x00, 0xC8, 0x64, 0x3F, 0x26, 0x00, 0xD8, 0x2F, 0x33, 0xE7, 0xC3, 0xD0, 0xBC, 0xDC, 0x7A,
+    0xC7, 0x1C, 0x80, 0xF6, 0x61, 0xF3, 0x97, 0x4E, 0xF5, 0x1D, 0x19, 0x87, 0xA6, 0x48, 0xBB, 0x41,
+    0xFE, 0x76, 0x07, 0x42, 0x7C, 0x4A, 0x4B, 0x87, 0x81, 0x9F, 0xF3, 0x73, 0x72, 0xEC, 0x99, 0x14,
+    0x1F, 0x67, 0x12, 0xE4, 0x23, 0x0C, 0x8A, 0xA1, 0x39, 0xD5, 0xEC, 0x8D, 0xD2, 0xCB, 0x04, 0xE3,
+    0xAC, 0x6F, 0x28, 0x88, 0x2E, 0xEA, 0x00, 0x75, 0x9D, 0x0E, 0xF6, 0xCD, 0x84, 0x36, 0x1B, 0x5F,
+    0x80, 0x74, 0xCD, 0x50, 0x7C, 0x61, 0xA2, 0xA8, 0x7A, 0x01, 0x30, 0xE4, 0xD4, 0x90, 0x9C, 0xBB,
+    0x7C, 0x9A, 0xB3, 0x5A, 0x3B, 0x3A, 0x3B, 0x0B, 0xBE, 0xC0, 0x51, 0x50, 0x26, 0xC8, 0xA8, 0x57,
+    0xA8, 0x95, 0x33, 0xEC, 0x35, 0x42, 0xF0, 0xC8, 0xA9, 0xCA, 0x72, 0x5D, 0x36, 0x0A, 0x59, 0xAC,
+    0xAC, 0x33, 0x13, 0x0E, 0x71, 0x2D, 0xEE, 0x79, 0xF8, 0x7C, 0x37, 0xE7, 0x76, 0xB5, 0x78, 0xCD,
+    0x8C, 0xCA, 0x38, 0xF9, 0xA9, 0x13, 0x5C, 0x40, 0x0F, 0x9D, 0x20, 0xB9, 0x76, 0xB7, 0xF8, 0x7C,
+    0xEC, 0x57, 0x03, 0xAB, 0xDC, 0xF0, 0x86, 0x17, 0x37, 0x62, 0x13, 0xD1, 0x10, 0x1D, 0xC7, 0x86,
+    0x13, 0xCC, 0x84, 0x23, 0xA8, 0xCC, 0xE2, 0x81, 0x4C, 0xE8, 0x58, 0x5C, 0x9E, 0x9C, 0x61, 0x3E,
+    0x3F, 0xBD, 0x62, 0x08, 0x5D, 0x42, 0x97, 0x1B, 0x8E, 0x0D, 0x27, 0x33, 0xC3, 0xCE, 0xC3, 0x0A,
+    0xB5, 0x76, 0x09, 0x7D, 0x6A, 0x39, 0xB6, 0x84, 0x9D, 0x41, 0xA7, 0x56, 0x68, 0xDF, 0x27, 0xC8,
+    0xD8, 0x72, 0x14, 0x07, 0x3B, 0xCD, 0x22, 0x13, 0x86, 0x20, 0x38, 0x99, 0x0C, 0x66, 0xC5, 0x51,
+    0xF3, 0x04, 0x9D, 0xE4, 0x15, 0x4E, 0x82, 0x1E, 0xE5, 0x6A, 0xA0, 0xD2, 0xB6, 0x04, 0x74, 0x45,
+    0xD6, 0xCF, 0x00, 0xF6, 0x5F, 0x46, 0x5B, 0xB4, 0x11, 0x28, 0x46, 0xD8, 0xCE, 0xB7, 0x71, 0x70,
+    0xBD, 0x37, 0x50, 0xCF, 0x47, 0xBC, 0xDE, 0x79, 0x11, 0x06, 0x27, 0x67, 0x0B, 0xFD, 0x48, 0x44,
+    0xEA, 0xBD, 0x58, 0x95, 0xB3, 0xCE, 0x7E, 0xC0, 0x96, 0xF2, 0xE5, 0x3E, 0x16, 0xBA, 0x9B, 0x1D,
+    0x21, 0x22, 0x30, 0x2C, 0x6A, 0x45, 0x39, 0xA5, 0x83, 0x32, 0xDC, 0x56, 0x16, 0xB0, 0xEF, 0xAB,
+    0xCA, 0xB9, 0xC0, 0x5A, 0xB7, 0x95, 0x69, 0xEF, 0x89, 0xDB, 0xC0, 0xBE, 0xE5, 0x6B, 0xCB, 0x88,
+    0x96, 0x8B, 0x8E, 0x10, 0x5C, 0x75, 0x84, 0x60, 0xD4, 0x09, 0x82, 0xD1, 0xA4, 0x0D, 0xF8, 0xD3,
+    0x11, 0xC0, 0x11, 0x1B, 0x01, 0xA8, 0x2A, 0xD4, 0x4B, 0x19, 0x50, 0xE1, 0x5D, 0xE8, 0x5B, 0xD5,
+    0x62, 0x36, 0xE8, 0xFC, 0x6E, 0x2B, 0x60, 0x60, 0xDD, 0xFA, 0xD5, 0x8C, 0xFD, 0x6A, 0xC7, 0x3E,
+    0x58, 0xF2, 0xF6, 0xED, 0xE7, 0x4F, 0x07, 0x3B, 0xC9, 0x64, 0x9D, 0xCC, 0xD6, 0xC9, 0x0C, 0xB4,
+    0xB9, 0xFA, 0x0A, 0x52, 0xE9, 0xFF, 0x63, 0xE3, 0xBF, 0x05, 0xBD, 0xE3, 0x6B, 0x99, 0x20, 0xE8,
+    0x4D, 0x2A, 0xCC, 0x96, 0xEA, 0x3C, 0x86, 0x4E, 0xBB, 0x9E, 0xAA, 0x44, 0x17, 0xB3, 0xEE, 0xCC,
+    0xF0, 0x52, 0xB6, 0x2C, 0x6C, 0xFD, 0xF9, 0xA0, 0xA7, 0x06, 0xD7, 0xC4, 0x6E, 0x85, 0x79, 0x38,
+    0x61, 0x98, 0xCD, 0xD8, 0xAD, 0xC3, 0xDC, 0xA4, 0xBA, 0x43, 0xCD, 0x76, 0xEC, 0x83, 0xAA, 0x6A,
+    0xCA, 0x0B, 0x24, 0x17, 0x4B, 0x06, 0xF5, 0xF9, 0x93, 0xB9, 0x0F, 0xB0, 0x97, 0x09, 0xED, 0x4B,
+    0x6F, 0xC1, 0xBA, 0xEA, 0x92, 0xDE, 0x88, 0x4E, 0x04, 0x60, 0x27, 0xE0, 0xC8, 0x78, 0x6C, 0xC4,
+    0xDE, 0x63, 0xF9, 0xB0, 0xD2, 0xA6, 0x67, 0xD8, 0x2B, 0x09, 0xFD, 0xA1, 0x86, 0x83, 0xBD, 0x9C,
+    0x20, 0xA3, 0x9A, 0xC1, 0x4B, 0x1C, 0x4D, 0x94, 0x24, 0x9D, 0x25, 0x63, 0x4B, 0xD2, 0x35, 0xFB,
+    0x4F, 0xC7, 0xAA, 0x4F, 0xCB, 0xAD, 0xD1, 0xC7, 0xFA, 0xBD, 0x7D, 0x44, 0x61, 0xC2, 0xEB, 0xDB,
+    0x1A, 0x01, 0x80, 0x9E, 0xFE, 0x7D, 0xFC, 0xE7, 0x0A, 0x17, 0x1F, 0xC0, 0xC5, 0x3F, 0xC2, 0xC5,
+    0x07, 0x71, 0xF1, 0x41, 0xC4, 0x07, 0x11, 0xB5, 0x88, 0x8A, 0x51, 0x32, 0x8A, 0xF4, 0x2C, 0x70,
+    0x11, 0x32, 0x42, 0x46, 0xC8, 0x04, 0xB9, 0x1C, 0x3C, 0x0B, 0xA4, 0x23, 0x89, 0x81, 0x63, 0xA9,
+    0x26, 0x28, 0x8E, 0x8A, 0x0E, 0x9A, 0xA3, 0xE2, 0x0C, 0xC3, 0x51, 0xD1, 0xC3, 0x72, 0x54, 0x5C,
+    0x41, 0x8E, 0x8A, 0xA1, 0x25, 0x47, 0xC5, 0x28, 0xC8, 0x49, 0x31, 0x77, 0xE4, 0xA4, 0xC9, 0x9E,
+    0x9C, 0xF4, 0x17, 0x3C, 0x91, 0x39, 0xE9, 0xCF, 0xF8, 0x52, 0xE6, 0xA4, 0x6F, 0x90, 0xB7, 0x38,
+    0xE9, 0xCF, 0xC9, 0x1B, 0x74, 0x7A, 0x25, 0x3F, 0xA3, 0xD3, 0xAB, 0xE5, 0x07, 0x74, 0x3A, 0x18,
+    0x5E, 0xA3, 0xD3, 0x41, 0xF3, 0x0A, 0x9D, 0x0E, 0x8A, 0x67, 0xE8, 0x74, 0x90, 0x7C, 0x8C, 0x4E,
+    0x47, 0xC9, 0x8E, 0x4E, 0xC7, 0xBE, 0x54, 0x22, 0xF5, 0x74, 0x26, 0x6E, 0x51, 0x0E, 0x9B, 0xD9,
+    0x5D, 0x87, 0x44, 0x1D, 0x13, 0x75, 0x50, 0x6C, 0xF4, 0x27, 0x53, 0xA9, 0xE1, 0xFE, 0x50, 0x55,
+    0x46, 0x06, 0x04, 0x9D, 0x76, 0x20, 0x38, 0x75, 0x49, 0x10, 0x6A, 0x1D, 0x12, 0x38, 0x9B, 0xD8,
+    0xF1, 0x61, 0x7A, 0x9D, 0x3A, 0x2E, 0x5C, 0x07, 0xBE, 0xC1, 0xC5, 0x58, 0x63, 0x9F, 0x8F, 0x4C,
+    0xB9, 0xFF, 0x8C, 0x9F, 0x05, 0x75, 0x95, 0x2F, 0x2D, 0x56, 0x26, 0x73, 0x39, 0xE9, 0xEB, 0xEC,
+    0x57, 0xF3, 0xC3, 0xA8, 0xE6, 0xA4, 0xBC, 0x9D, 0x8A, 0x09, 0xA4, 0x97, 0xAA, 0x97, 0x8B, 0x58,
+    0x75, 0x72, 0xD8, 0xA9, 0x9A, 0x04, 0xD2, 0xF3, 0xC5, 0xC8, 0x37, 0xA3, 0x7D, 0xE3, 0xD0, 0xF3,
+    0x6A, 0x34, 0xE5, 0xF9, 0x4E, 0x32, 0xD7, 0xB6, 0x48, 0x99, 0x2E, 0x20, 0x03, 0x0D, 0x7F, 0x64,
+    0xA7, 0x6D, 0xB5, 0xED, 0xCA, 0x4A, 0x66, 0x0B, 0x6F, 0x63, 0x7F, 0xFC, 0xBA, 0x98, 0x9A, 0x11,
+    0x35, 0xB6, 0x61, 0xEB, 0x0B, 0xC9, 0x09, 0x40, 0x5F, 0xD9, 0x1F, 0x09, 0x40, 0x43, 0xEB, 0x00,
+    0xF0, 0x45, 0x0F, 0x14, 0x06, 0x31, 0x94, 0xB7, 0x0E, 0x05, 0xA1, 0x40, 0x97, 0x04, 0x01, 0x41,
+    0x58, 0x07, 0xD0, 0x0D, 0x01, 0xB0, 0xB3, 0x20, 0xA0, 0x6F, 0xEE, 0x71, 0x46, 0x81, 0xF5, 0x7A,
+    0xB2, 0xD0, 0x7E, 0xC9, 0xA5, 0x3D, 0x44, 0x8B, 0x1A, 0x4D, 0x00, 0xB8, 0xA8, 0xAA, 0x0F, 0x01,
+    0x3D, 0x1F, 0xE3, 0x84, 0x86, 0xFE, 0xFE, 0xF1, 0x9E, 0x97, 0x87, 0x9B, 0x4F, 0x05, 0x41, 0x26,
+    0x58, 0xE6, 0xE2, 0x91, 0x3A, 0x7D, 0xF3, 0x8E, 0x0B, 0xB8, 0xAF, 0x10, 0x89, 0xA6, 0x81, 0x5C,
+    0xE4, 0x4D, 0x1B, 0xBB, 0x55, 0x50, 0x04, 0x18, 0x97, 0x20, 0xBD, 0x46, 0x9B, 0x86, 0x09, 0xF6,
+    0xF1, 0x05, 0xC3, 0x7B, 0x2B, 0xBA, 0xF0, 0x03, 0xB4, 0x1C, 0x3E, 0x7A, 0x8A, 0x57, 0x48, 0xFA,
+    0x8D, 0x55, 0xFC, 0x30, 0x69, 0xE7, 0x3E, 0x8F, 0x40, 0xFB, 0xCA, 0x3D, 0xE7, 0x80, 0x86, 0x5D,
+    0x04, 0x60, 0x2E, 0xF1, 0xE0, 0x4A, 0x53, 0x09, 0x08, 0x39, 0xF1, 0x35, 0xB1, 0x49, 0x22, 0xE1,
+    0xC0, 0x2E, 0x29, 0xE3, 0xA6, 0x8C, 0x33, 0x45, 0xB7, 0xF3, 0x65, 0x75, 0x99, 0x00, 0x44, 0xD6,
+    0x0E, 0x85, 0x84, 0x0D, 0xD8, 0xCB, 0x04, 0xA0, 0x17, 0x33, 0x03, 0xC3, 0x5A, 0x48, 0x3E, 0x6D,
+    0xE9, 0x4D, 0xB3, 0xA0, 0xE5, 0x28, 0x23, 0xC0, 0x8F, 0x9E, 0xE4, 0x08, 0x43, 0x72, 0x81, 0xE2,
+    0x06, 0xC9, 0x72, 0xEA, 0x49, 0xD2, 0x0B, 0x92, 0x4C, 0x0D, 0x17, 0x88, 0xE2, 0x08, 0x2D, 0x6A,
+    0x90, 0x4A, 0x43, 0x06, 0x3A, 0xBA, 0x63, 0x27, 0x8F, 0x8D, 0x32, 0xCA, 0x20, 0x28, 0x08, 0x5E,
+    0xA2, 0x33, 0xDE, 0x78, 0x95, 0x54, 0x94, 0x3C, 0xC1, 0xDB, 0x87, 0xC5, 0xD1, 0x12, 0x3B, 0xB0,
+    0x74, 0x64, 0x10, 0xF9, 0x34, 0x9B, 0x04, 0xBA, 0x8C, 0xC1, 0xEB, 0x51, 0x44, 0xE9, 0x60, 0x1F,
+    0x5B, 0xA0, 0xDE, 0x0E, 0xE8, 0xC2, 0x73, 0x68, 0xF2, 0x30, 0xC1, 0x5E, 0xBD, 0xF9, 0x04, 0x3D,
+    0xC9, 0xA8, 0x2A, 0x09, 0x64, 0x36, 0xFC, 0x74, 0x6D, 0x8B, 0xB5, 0x73, 0xE4, 0xEF, 0xEF, 0xEF,
+    0x33, 0x02, 0x50, 0x9F, 0x55, 0x45, 0xCB, 0x7C, 0x51, 0xB5, 0x26, 0x7E, 0x59, 0xB4, 0xCF, 0x86,
+    0xE4, 0x8F, 0x4F, 0x16, 0x85, 0x2B, 0x6F, 0xFA, 0x69, 0xB5, 0x1A, 0xBF, 0xA8, 0x0D, 0x75, 0xA3,
+    0x36, 0xF4, 0xDB, 0xCC, 0x7B, 0xFF, 0x00, 0x80, 0xBD, 0x54, 0xCC, 0x2F, 0x70, 0x2C, 0x0D, 0xC1,
+    0xC2, 0x97, 0x41, 0x97, 0x6B, 0x43, 0x46, 0xD8, 0x62, 0xDF, 0x05, 0x98, 0x5D, 0x90, 0x56, 0xDE,
+    0xF4, 0xDD, 0xBC, 0x11, 0x57, 0xB8, 0xB7, 0x77, 0xB2, 0xDD, 0x4C, 0x4F, 0x51, 0x1B, 0x6B, 0xCF,
+    0xBD, 0x3D, 0x43, 0x32, 0x0C, 0xC5, 0x1F, 0xCB, 0xE2, 0xB9, 0x26, 0x19, 0x4D, 0x28, 0x8D, 0xBB,
+    0x07, 0xC2, 0x7D, 0x01, 0x47, 0xCB, 0xDB, 0x5F, 0x62, 0x28, 0x84, 0x0E, 0x4E, 0xF2, 0xA6, 0xE5,
+    0xDA, 0xAF, 0xDD, 0x2A, 0xB8, 0xC2, 0x8A, 0x00, 0x93, 0xF7, 0xED, 0x9C, 0x20, 0x49, 0x06, 0x5D,
+    0xD4, 0xC8, 0x61, 0x82, 0x25, 0xF9, 0xC6, 0x82, 0xE1, 0xD6, 0x29, 0x34, 0x6B, 0x61, 0xCD, 0xFC,
+    0xA0, 0xA0, 0x77, 0xC3, 0x47, 0x4F, 0x31, 0xA3, 0x3B, 0x53, 0xCE, 0x6C, 0x29, 0xD6, 0x60, 0xA8,
+    0x2E, 0x84, 0x86, 0xB4, 0x24, 0xC7, 0x3E, 0x8F, 0xB0, 0x7F, 0x89, 0x7B, 0x5E, 0x69, 0xCE, 0x83,
+    0x30, 0x4E, 0x56, 0x82, 0x63, 0x01, 0x0C, 0xDB, 0xC3, 0xE0, 0xFE, 0xED, 0x56, 0xC9, 0x05, 0x32,
+    0x28, 0x92, 0x8F, 0x90, 0xF4, 0x8A, 0xCC, 0xB7, 0xC7, 0x3C, 0x1D, 0x34, 0x4A, 0x34, 0x53, 0x3A,
+    0xD4, 0xB8, 0x79, 0xF2, 0xCE, 0xF7, 0x7C, 0xBE, 0xB7, 0x27, 0x48, 0x7A, 0x53, 0x2D, 0xE4, 0x60,
+    0xAA, 0xC1, 0x1C, 0x0D, 0xC9, 0xF9, 0x9E, 0x97, 0x9B, 0xF3, 0x22, 0x3F, 0x41, 0x58, 0x72, 0x92,
+    0xA4, 0x6B, 0xC8, 0xB9, 0xD0, 0xCB, 0xBF, 0xF1, 0x71, 0x34, 0x8F, 0xE8, 0xCB, 0xA0, 0x9F, 0x65,
+    0xEA, 0x62, 0x17, 0xA1, 0x1F, 0xCD, 0xFB, 0xD6, 0x6F, 0x9F, 0xFC, 0x34, 0xC9, 0x5F, 0xE4, 0xBD,
+    0xB2, 0xB2, 0x9A, 0x19, 0x90, 0x1C, 0xDB, 0xCB, 0x15, 0x4B, 0x88, 0x5D, 0x65, 0x62, 0x4E, 0x8D,
+    0xDD, 0x64, 0x47, 0x6B, 0x6F, 0x16, 0x2B, 0x67, 0x6C, 0x48, 0xE6, 0x72, 0x63, 0x8B, 0xC3, 0x6E,
+    0x20, 0xC9, 0xE6, 0x43, 0x3C, 0x55, 0xB9, 0x70, 0x0E, 0x28, 0x70, 0x2A, 0x78, 0x79, 0xDF, 0x6E,
+    0xE6, 0xF7, 0x15, 0x6E, 0x63, 0x9E, 0xCF, 0x93, 0xE4, 0x2A, 0x3D, 0x04, 0x61, 0x27, 0x70, 0x11,
+    0x19, 0x3A, 0x42, 0xD1, 0xB2, 0xC6, 0xDF, 0x35, 0xE4, 0x02, 0x34, 0x76, 0x23, 0x5B, 0xE1, 0x1F,
+    0xBF, 0x82, 0xAE, 0x8E, 0xB6, 0x71, 0x43, 0x3C, 0xFE, 0xDA, 0x58, 0xDC, 0x80, 0xA1, 0xE8, 0x57,
+    0x47, 0xEC, 0x0F, 0x77, 0xBC, 0x35, 0x32, 0x29, 0xFE, 0x92, 0x9D, 0x87, 0x9D, 0x38, 0x5A, 0x27,
+    0xC9, 0x19, 0xA4, 0xC3, 0xD1, 0xAD, 0xEB, 0x8E, 0x4F, 0xCF, 0x00, 0x6D, 0xEA, 0x57, 0x40, 0x2F,
+    0x9C, 0x20, 0x28, 0x23, 0xA0, 0xAF, 0xD3, 0xA1, 0xE3, 0x10, 0xBF, 0xB1, 0x77, 0xFF, 0x9D, 0xEC,
+    0x0B, 0x71, 0x57, 0x5F, 0x74, 0x79, 0x84, 0x76, 0x84, 0xF4, 0xDA, 0x75, 0x69, 0x58, 0x5B, 0x3E,
+    0x9E, 0x60, 0xDF, 0xE7, 0x74, 0xFF, 0x2B, 0xFB, 0xE7, 0x00, 0xDC, 0x3F, 0xED, 0x57, 0xC3, 0xD1,
+    0xEB, 0xA2, 0x0E, 0x74, 0x71, 0xF0, 0xD5, 0xF6, 0x7F, 0xBC, 0x76, 0x11, 0xAF, 0x55, 0x81, 0xA8,
+    0xC3, 0x8E, 0x1A, 0xF7, 0x5B, 0x3D, 0x54, 0x6A, 0x36, 0xD1, 0xEC, 0x0C, 0x47, 0xFA, 0x42, 0xC4,
+    0x74, 0x76, 0x05, 0x24, 0x8B, 0xD6, 0x0A, 0x70, 0x61, 0x54, 0x11, 0x80, 0x8A, 0x9A, 0x32, 0x03,
+    0x10, 0x7C, 0x83, 0x2F, 0x12, 0x00, 0xCC, 0xAF, 0xF8, 0x71, 0xE1, 0xED, 0xD3, 0x7C, 0xB1, 0x91,
+    0x2F, 0xAB, 0x39, 0xAD, 0x36, 0xD8, 0x58, 0xEC, 0xF8, 0x64, 0x66, 0xB3, 0xB0, 0x2B, 0xA7, 0xF3,
+    0x00, 0x63, 0x42, 0xBB, 0xBD, 0x7B, 0x07, 0x7D, 0xED, 0x40, 0x31, 0xB1, 0x59, 0xFE, 0x62, 0xE3,
+    0x9C, 0x09, 0x66, 0x7B, 0x8B, 0x04, 0x3A, 0x66, 0x95, 0x15, 0x57, 0x74, 0xA4, 0xE4, 0x95, 0xE2,
+    0x1F, 0x15, 0xF4, 0x9A, 0x6B, 0x4F, 0x8E, 0x8C, 0x95, 0xAC, 0xFC, 0x6A, 0x5B, 0x28, 0xED, 0xC3,
+    0x62, 0x2A, 0xF0, 0xD0, 0x57, 0xCD, 0xCA, 0x6F, 0x90, 0x44, 0x75, 0x8E, 0xEB, 0xF5, 0x4E, 0x36,
+    0xEC, 0xB7, 0x7D, 0x70, 0x1E, 0x38, 0x5A, 0x8F, 0x9E, 0x0D, 0xFD, 0x90, 0x00, 0x1D, 0x06, 0x8A,
+    0xC2, 0xDC, 0xA3, 0x2F, 0x0E, 0x0B, 0x49, 0x59, 0x78, 0x7B, 0xFC, 0xA0, 0x50, 0x26, 0x7F, 0x91,
+    0x4D, 0x09, 0x75, 0xB5, 0x9F, 0xA6, 0x6D, 0x19, 0x98, 0x0E, 0x73, 0xF0, 0xBA, 0x4D, 0x96, 0xEB,
+    0x03, 0xCC, 0x24, 0xDC, 0xC6, 0xD2, 0x33, 0xB5, 0xC3, 0x55, 0xF1, 0xF0, 0xD4, 0xB8, 0x46, 0x40,
+    0x30, 0xF3, 0x4B, 0x46, 0x34, 0xE4, 0xD3, 0x7C, 0x9A, 0x2B, 0x2C, 0xDF, 0xE6, 0x6A, 0x39, 0x6B,
+    0xAE, 0x8A, 0x2F, 0x90, 0x93, 0x76, 0x04, 0x45, 0xEC, 0xD2, 0xB0, 0xAA, 0xD5, 0xCE, 0xF6, 0x7D,
+    0xBE, 0xB0, 0xFF, 0x9F, 0x7C, 0x13, 0xE4, 0x71, 0x9C, 0x93, 0x28, 0xFE, 0xCC, 0x45, 0xEF, 0x73,
+    0x2E, 0xCA, 0x20, 0x4B, 0x00, 0x96, 0x99, 0x25, 0x33, 0x34, 0xCF, 0x81, 0x9C, 0x9A, 0x3F, 0xA6,
+    0x03, 0xEC, 0x84, 0x86, 0x40, 0x17, 0x47, 0xA8, 0x5F, 0x7D, 0x78, 0x94, 0x6F, 0x90, 0x54, 0xC5,
+    0x70, 0xBB, 0x4C, 0xC6, 0xC6, 0xE6, 0x11, 0xC7, 0xA7, 0x67, 0x44, 0x92, 0xAB, 0x5E, 0x78, 0x26,
+    0xCB, 0x60, 0xAE, 0xF3, 0x0D, 0x96, 0x49, 0x8C, 0x7B, 0xD1, 0x70, 0x85, 0xE2, 0xDC, 0x8E, 0x0A,
+    0x80, 0x07, 0x06, 0x34, 0x3F, 0xF1, 0x85, 0x37, 0xB1, 0x00, 0x66, 0x44, 0x13, 0x9A, 0x73, 0x7A,
+    0x52, 0x5C, 0x05, 0x09, 0xC3, 0xA5, 0xB1, 0x1F, 0x6E, 0x7D, 0xB5, 0xE8, 0x32, 0x5D, 0xFD, 0xF1,
+    0x7D, 0xEB, 0xEF, 0x26, 0xB8, 0xAE, 0x85, 0x5E, 0x63, 0xE9, 0xF0, 0x8F, 0xE9, 0x8B, 0x23, 0xB6,
+    0x0F, 0x40, 0x1F, 0x71, 0x4E, 0x06, 0x11, 0x54, 0x90, 0x64, 0xD0, 0x05, 0xBD, 0xF7, 0x2D, 0xE9,
+    0x70, 0x5F, 0xB9, 0x0F, 0xDF, 0xDD, 0xDF, 0x9F, 0xB6, 0xCF, 0xD6, 0xA4, 0xAF, 0x0E, 0xDC, 0x19,
+    0x82, 0x23, 0x64, 0xAA, 0x9F, 0x7D, 0xB3, 0x10, 0x85, 0x2D, 0x17, 0x40, 0xF9, 0xFA, 0xD9, 0x01,
+    0x93, 0x0C, 0xED, 0xFA, 0x15, 0x9F, 0xAD, 0x6E, 0x6D, 0x5D, 0xFC, 0x3B, 0xC0, 0xFD, 0x25, 0xFC,
+    0x8B, 0xAC, 0xF7, 0x58, 0xF1, 0xD6, 0xFE, 0x6F, 0x34, 0x12, 0xFF, 0xED, 0x89, 0x60, 0x2C, 0x2E,
+    0xA1, 0x12, 0x15, 0x17, 0xDB, 0x62, 0x1A, 0xDF, 0xFA, 0xBA, 0x11, 0xF6, 0xFF, 0x7E, 0x94, 0x0B,
+    0x45, 0x04, 0x06, 0x6F, 0x5C, 0x9D, 0xF0, 0xCA, 0x5B, 0x57, 0xD5, 0xE4, 0x2A, 0x78, 0xFF, 0x9D,
+    0x88, 0x02, 0x3D, 0xFA, 0x32, 0xF4, 0xCC, 0x51, 0x64, 0xB9, 0x42, 0x2F, 0x9C, 0x3A, 0x0E, 0x11,
+    0xF6, 0xC6, 0xE6, 0x66, 0x38, 0xB0, 0xB2, 0x86, 0xD5, 0x4C, 0x82, 0x67, 0x03, 0x6C, 0x30, 0xD3,
+    0xC0, 0xB3, 0x41, 0x30, 0x98, 0xC9, 0xF2, 0x6C, 0x90, 0x0C, 0xE6, 0x0C, 0xCD, 0xD9, 0x68, 0xDF,
+    0x09, 0xE6, 0xCD, 0x68, 0xAE, 0x92, 0x5D, 0x34, 0x5C, 0xEC, 0x55, 0xC6, 0x3E, 0x1A, 0xC2, 0x5E,
+    0xE5, 0xD2, 0x47, 0x13, 0xC1, 0xAB, 0x1C, 0x65, 0x7C, 0xE6, 0x65, 0xEC, 0x4F, 0x68, 0xCE, 0xDF,
+    0xF3, 0x32, 0x50, 0xBA, 0x11, 0x7A, 0xE6, 0x08, 0x0C, 0xAB, 0x99, 0x81, 0x3E, 0x97, 0x98, 0xF4,
+    0x1F, 0x7E, 0x4D, 0x20, 0x6A, 0x01, 0xC5, 0xCD, 0x46, 0xC5, 0x89, 0x45, 0xAD, 0x75, 0xB0, 0xA9,
+    0x61, 0x80, 0x09, 0xE8, 0x39, 0xAA, 0x08, 0x58, 0x2F, 0x23, 0x20, 0x53, 0x4F, 0xA0, 0xE5, 0x19,
+    0x8E, 0x80, 0xF1, 0x05, 0x2C, 0x28, 0x8A, 0x5B, 0x01, 0x0D, 0xDE, 0x29, 0x0A, 0x1C, 0x8B, 0xA9,
+    0xE3, 0x01, 0xC1, 0x13, 0x11, 0x40, 0x41, 0xA1, 0xAD, 0x67, 0x00, 0x4C, 0xD4, 0xFC, 0xE8, 0xBB,
+    0x64, 0x81, 0x87, 0xA7, 0x02, 0x12, 0xAB, 0x03, 0xC5, 0x79, 0xAD, 0xCE, 0x95, 0xB6, 0xE8, 0xF8,
+    0x47, 0x99, 0x77, 0xF7, 0x5F, 0x3B, 0x42, 0x24, 0xB9, 0x42, 0xCF, 0x1C, 0xBB, 0x3C, 0x04, 0xD8,
+    0xF7, 0x39, 0x1D, 0x7D, 0xF5, 0xD7, 0xC4, 0x41, 0x1D, 0xE5, 0x88, 0xAE, 0x68, 0x26, 0x09, 0x3A,
+    0x5B, 0xDF, 0xA7, 0x86, 0x13, 0xA7, 0x2E, 0x4A, 0x0F, 0xFD, 0x16, 0x21, 0xF2, 0xE0, 0xA1, 0xDE,
+    0x27, 0xDA, 0x3C, 0x78, 0xE8, 0xF7, 0x38, 0x8A, 0x2C, 0x23, 0x38, 0x6F, 0xE9, 0x15, 0x26, 0x5D,
+    0x42, 0xC4, 0x13, 0xBA, 0x02, 0x83, 0x8E, 0x00, 0x8E, 0x9D, 0xDC, 0xE0, 0x7D, 0x4D, 0x2E, 0x18,
+    0x4A, 0x58, 0x0E, 0x99, 0x61, 0x53, 0x4B, 0x2F, 0x89, 0x8E, 0x2F, 0x70, 0x86, 0x8E, 0x3A, 0xA2,
+    0xE1, 0x35, 0x4E, 0x18, 0xB2, 0x66, 0x55, 0x42, 0x4A, 0x58, 0x01, 0x3F, 0xE3, 0x2F, 0xF7, 0x4F,
+    0x67, 0x1D, 0xD1, 0xF0, 0x03, 0x2E, 0x30, 0x49, 0xF1, 0x97, 0xB6, 0x24, 0x4E, 0x28, 0xAE, 0x99,
+    0xD1, 0xB0, 0x08, 0x1F, 0xC6, 0x2A, 0x6B, 0x06, 0x72, 0x02, 0xEE, 0xE3, 0x04, 0xDC, 0x97, 0x4A,
+    0x96, 0x09, 0x43, 0x8E, 0x3A, 0x5B, 0xAF, 0xD6, 0x2E, 0xCB, 0x00, 0x7B, 0x25, 0x42, 0x7E, 0x4E,
+    0x88, 0x6C, 0x48, 0x5E, 0x20, 0xF9, 0x31, 0x6F, 0x5D, 0xB8, 0xC9, 0x51, 0x64, 0xED, 0x05, 0x4F,
+    0x90, 0xBC, 0x5C, 0xE1, 0x2F, 0xDF, 0x95, 0x74, 0x13, 0x6B, 0xE1, 0xCC, 0xDD, 0x73, 0xEE, 0xFE,
+    0xB1, 0x1A, 0xAE, 0x87, 0xA6, 0xA3, 0x5E, 0x39, 0x7F, 0x9D, 0xD5, 0xDA, 0xEC, 0x6D, 0x2E, 0x3A,
+    0x41, 0x66, 0x34, 0x24, 0x23, 0x34, 0xC9, 0xA5, 0xE7, 0xAC, 0x08, 0x7A, 0x98, 0xA0, 0x12, 0x04,
+    0xAF, 0xD0, 0x61, 0x48, 0x3A, 0xA0, 0x39, 0xDC, 0x01, 0x1F, 0x90, 0x24, 0x75, 0xDE, 0xFF, 0x1F,
+    0xF9, 0x01, 0x1D, 0x86, 0xAC, 0x33, 0x3A, 0xBE, 0xCD, 0xFC, 0x13, 0xC6, 0x81, 0x24, 0x1D, 0x49,
+    0xAE, 0x1D, 0x49, 0x56, 0x7E, 0xAF, 0x65, 0x09, 0x69, 0x0E, 0x40, 0x63, 0x03, 0xCA, 0xE8, 0xA7,
+    0x88, 0xD0, 0x33, 0xC7, 0x61, 0x35, 0x73, 0x9F, 0x55, 0xB8, 0x7B, 0xCC, 0x1F, 0xE5, 0x88, 0x81,
+    0x09, 0x03, 0x39, 0x4B, 0x5E, 0x88, 0x7D, 0x6A, 0x78, 0x26, 0x43, 0x79, 0x42, 0x24, 0xE3, 0xC0,
+    0x97, 0x2A, 0x65, 0xE7, 0x26, 0xF3, 0x4F, 0xB2, 0x99, 0xC1, 0x17, 0x23, 0x78, 0xAD, 0x9A, 0xF8,
+    0x41, 0x16, 0x85, 0x36, 0x95, 0xA8, 0x77, 0xB3, 0x6E, 0x3A, 0x20, 0x45, 0x04, 0xE4, 0x6A, 0x66,
+    0x34, 0x3C, 0x9B, 0x01, 0x15, 0xEC, 0x82, 0x66, 0xFF, 0xEF, 0x7D, 0x2B, 0x97, 0xC4, 0x1F, 0x9F,
+    0x04, 0xCA, 0xE2, 0x63, 0x58, 0x41, 0x8E, 0x49, 0xF0, 0xDC, 0xE9, 0x04, 0xCE, 0x30, 0x7E, 0x08,
+    0x68, 0xF9, 0x08, 0x01, 0x19, 0xEF, 0x3F, 0x57, 0x1D, 0xDD, 0x5D, 0xB1, 0xFA, 0x96, 0x12, 0xD5,
+    0x51, 0x9A, 0x7B, 0x7B, 0x4F, 0xE5, 0x5D, 0x34, 0xBD, 0xCC, 0x26, 0xA1, 0x2F, 0x6E, 0xB2, 0xA2,
+    0x5B, 0x5F, 0x3E, 0x30, 0xF6, 0x8A, 0x16, 0xD2, 0x90, 0xF4, 0x68, 0x2C, 0x5F, 0xDE, 0x10, 0xFC,
+    0x73, 0xF7, 0x8F, 0x83, 0x37, 0x4E, 0x79, 0xEB, 0xB4, 0x67, 0xD9, 0x0E, 0x69, 0x58, 0x8D, 0x2D,
+    0x61, 0xBD, 0xC3, 0xDF, 0xB7, 0xF3, 0x77, 0x20, 0x7D, 0x51, 0x25, 0x44, 0x04, 0xDA, 0x04, 0xCB,
+    0xB2, 0xA1, 0x4D, 0x80, 0x88, 0x7F, 0x1D, 0x32, 0x0C, 0xB7, 0xE8, 0x15, 0x39, 0x0F, 0xE4, 0xD8,
+    0xD8, 0x0F, 0x81, 0x63, 0x7F, 0x7C, 0x01, 0x7D, 0xB5, 0xFC, 0x62, 0x4B, 0xD2, 0x1F, 0xD9, 0x1B,
+    0xBF, 0x45, 0x07, 0x3D, 0x33, 0xE1, 0x9E, 0x97, 0xB7, 0x08, 0xF9, 0x2C, 0xF2, 0xED, 0x11, 0xF2,
+    0xAB, 0xF4, 0x30, 0xDE, 0x38, 0xF0, 0x83, 0x8C, 0x86, 0xEF, 0xAE, 0x85, 0x41, 0xD2, 0x95, 0x78,
+    0xC4, 0xDF, 0x22, 0x42, 0x1E, 0x38, 0xF2, 0xC7, 0x45, 0xA5, 0xD3, 0x64, 0x68, 0x48, 0xFA, 0x7B,
+    0xF6, 0x7F, 0xBC, 0xF7, 0x1B, 0xAE, 0xED, 0xFF, 0xBF, 0xC4, 0x5D, 0xDE, 0x3F, 0xBE, 0x8A, 0x26,
+    0x77, 0x01, 0x7D, 0x54, 0xBE, 0xE8, 0xCD, 0xBC, 0xC2, 0x03, 0xC5, 0xF9, 0xD7, 0xE6, 0x22, 0x78,
+    0x81, 0xA3, 0x48, 0x82, 0x18, 0x76, 0x3D, 0x9D, 0xB6, 0x5C, 0x04, 0xD6, 0xC1, 0x7E, 0x76, 0x98,
+    0x44, 0x74, 0x90, 0x8B, 0x40, 0xD2, 0x55, 0xA6, 0xD2, 0x6F, 0xD8, 0xD3, 0xF7, 0x8F, 0xAF, 0xA2,
+    0xE1, 0x57, 0x9C, 0xEF, 0xD7, 0x81, 0x64, 0xB7, 0xB9, 0x43, 0x47, 0xE8, 0x6B, 0x44, 0xC3, 0x2E,
+    0xA3, 0x0F, 0x32, 0x42, 0xCF, 0x32, 0x36, 0x84, 0x5A, 0xFB, 0x00, 0xED, 0xF5, 0x0C, 0xFB, 0x1E,
+    0x01, 0xBE, 0x11, 0x4A, 0xEC, 0x99, 0x28, 0x81, 0xD6, 0xA1, 0x52, 0x08, 0x4B, 0x14, 0x5B, 0xA8,
+    0xBC, 0xBC, 0x96, 0xA8, 0xE6, 0x22, 0xE7, 0xCD, 0x83, 0xB6, 0x16, 0x3E, 0x9D, 0x60, 0xF8, 0xAA,
+    0xD4, 0x14, 0x66, 0xC6, 0xB0, 0xD6, 0x24, 0x32, 0x7D, 0x82, 0xE0, 0xD8, 0x71, 0x6C, 0x38, 0x37,
+    0x9C, 0x37, 0x10, 0xF8, 0x5B, 0x3C, 0x8E, 0xBF, 0x8C, 0xF6, 0x3C, 0xC0, 0x09, 0xD6, 0xA1, 0x8F,
+    0x90, 0x01, 0xD0, 0x0B, 0x08, 0xB4, 0x1C, 0x95, 0x07, 0x64, 0x14, 0x25, 0x51, 0x8C, 0x76, 0x40,
+    0x57, 0x60, 0x45, 0x1D, 0x38, 0xA1, 0x8C, 0xF9, 0x2D, 0x6E, 0xA6, 0xFA, 0x9A, 0x0B, 0xDA, 0x5A,
+    0x86, 0x7E, 0xE5, 0x4B, 0xD6, 0x15, 0xAB, 0x12, 0x1D, 0x2A, 0x2F, 0xC8, 0xCE, 0x3B, 0x0E, 0x56,
+    0xB5, 0xBE, 0x0C, 0x3D, 0x50, 0x88, 0x61, 0x35, 0x74, 0x0E, 0x5D, 0x9E, 0xB0, 0xFD, 0x0F, 0xA7,
+    0x86, 0x13, 0xCC, 0x02, 0xBB, 0x40, 0x05, 0xE8, 0x15, 0x32, 0x61, 0x48, 0xE8, 0x38, 0x36, 0x00,
+    0xC6, 0xDF, 0xD0, 0x0E, 0x6B, 0x38, 0x42, 0xCF, 0x90, 0x85, 0x7A, 0x6B, 0x16, 0xD8, 0x09, 0x82,
+    0x90, 0x2B, 0x20, 0x63, 0x71, 0x6F, 0xCC, 0x6A, 0x01, 0x04, 0x45, 0x02, 0xA0, 0x82, 0x71, 0x28,
+    0xB7, 0x72, 0xC7, 0xF7, 0xD7, 0xD5, 0xE9, 0x92, 0xB1, 0x23, 0x85, 0x96, 0x89, 0xB3, 0x25, 0x64,
+    0x51, 0x95, 0x20, 0x81, 0x83, 0x5C, 0x23, 0x2A, 0x61, 0x23, 0x9A, 0x95, 0xFB, 0xBB, 0x73, 0xF2,
+    0x14, 0xDE, 0xE4, 0x46, 0x90, 0x02, 0x80, 0xA3, 0x2F, 0x1F, 0x9F, 0xE4, 0xAA, 0x67, 0xB9, 0xEA,
+    0x59, 0x06, 0xBD, 0x0C, 0xC1, 0x2C, 0xAA, 0x26, 0x1D, 0xBA, 0xF7, 0x9B, 0x68, 0x40, 0x10, 0xF1,
+    0x35, 0x88, 0xF8, 0x1A, 0xBA, 0x68, 0x21, 0xA3, 0x9D, 0xBF, 0x82, 0x06, 0x74, 0xAC, 0x8D, 0x1B,
+    0xF5, 0xE7, 0xF0, 0x76, 0x7C, 0x7A, 0x46, 0x7A, 0x7D, 0x25, 0xC9, 0xCF, 0x79, 0xF6, 0x50, 0x92,
+    0xA3, 0x3F, 0xC0, 0xCB, 0x72, 0xFC, 0x9E, 0x70, 0x72, 0xF4, 0x62, 0x79, 0x16, 0xE1, 0xF7, 0xF1,
+    0x83, 0x6E, 0x52, 0xCF, 0x87, 0x61, 0xD1, 0x0C, 0x3D, 0x33, 0xEC, 0x8B, 0x13, 0xC4, 0x02, 0x44,
+    0x40, 0x03, 0xD2, 0x69, 0x92, 0xB2, 0xD2, 0x25, 0x56, 0x92, 0x79, 0x17, 0xB5, 0x98, 0xEF, 0x88,
+    0x5A, 0x14, 0x5F, 0x1F, 0xB5, 0xE8, 0xEF, 0x8C, 0x5A, 0x24, 0x6A, 0xE0, 0xBC, 0xAF, 0xAC, 0x0B,
+    0x5B, 0x73, 0xCE, 0x1C, 0x7D, 0x19, 0x78, 0x66, 0xFF, 0x7C, 0x09, 0xA7, 0x7C, 0x1D, 0x28, 0x4F,
+    0x7E, 0xDD, 0xD3, 0x81, 0x0E, 0x9D, 0x43, 0xE7, 0xD0, 0x4E, 0x40, 0xFB, 0xCA, 0xF1, 0x73, 0x00,
+    0xDA, 0xDC, 0x97, 0x6C, 0x54, 0x67, 0xF2, 0x21, 0xA3, 0xBF, 0xE8, 0x98, 0xBF, 0x1E, 0x83, 0xFA,
+    0xC6, 0xC7, 0xC6, 0x6A, 0xA9, 0x6B, 0x9A, 0x5A, 0x8F, 0x95, 0xD8, 0xD9, 0xC1, 0x01, 0x68, 0xF9,
+    0x58, 0xE1, 0x30, 0xBC, 0x55, 0x72, 0x7C, 0xAC, 0xA6, 0x88, 0xF0, 0xC1, 0x01, 0x68, 0xEA, 0x41,
+    0x73, 0xE7, 0x41, 0xDE, 0x02, 0x1A, 0x3E, 0x46, 0x06, 0xC0, 0xBC, 0x55, 0x52, 0x1D, 0x04, 0xF3,
+    0x67, 0xD6, 0xA3, 0xCB, 0xC3, 0xDC, 0x65, 0x34, 0x3C, 0xBB, 0xC2, 0x4E, 0x30, 0xEF, 0x25, 0x28,
+    0x0F, 0x15, 0xCD, 0x28, 0x03, 0x7A, 0x0E, 0xF3, 0x90, 0xD1, 0xF2, 0x2A, 0xC9, 0x11, 0xBC, 0x41,
+    0x72, 0x82, 0x8E, 0xB6, 0x04, 0xBA, 0xA9, 0xA2, 0x4B, 0xCD, 0x45, 0xB1, 0xD0, 0x97, 0x58, 0x55,
+    0xB1, 0x3E, 0xA9, 0xB5, 0x4A, 0xC5, 0xFD, 0xFF, 0x6E, 0xFF, 0xD7, 0x4C, 0xB6, 0xE6, 0xD4, 0x2E,
+    0x01, 0x90, 0xFA, 0x3F, 0x27, 0xA0, 0xFB, 0xD5, 0x02, 0x34, 0xF1, 0x67, 0x00, 0x8C, 0x02, 0x30,
+    0xBC, 0xE9, 0x80, 0xEE, 0x33, 0x0F, 0x34, 0x31, 0xFF, 0x18, 0x30, 0x9A, 0x2B, 0x86, 0x77, 0x49,
+    0x74, 0x5F, 0xF8, 0x61, 0x69, 0x52, 0x6C, 0x23, 0x8C, 0x85, 0xC1, 0xF0, 0xA9, 0x33, 0x53, 0xFF,
+    0x25, 0x39, 0xB7, 0xB9, 0x66, 0x18, 0x3B, 0x07, 0xED, 0x6B, 0x20, 0xF1, 0x10, 0x4B, 0x1A, 0xAD,
+    0x80, 0x2E, 0x03, 0x7A, 0x85, 0xF6, 0x80, 0xF5, 0x82, 0xE3, 0xE6, 0x8E, 0x69, 0xF8, 0x56, 0x09,
+    0x7C, 0x7C, 0x37, 0x1F, 0x84, 0x03, 0xD7, 0xE9, 0x5B, 0xF8, 0xCA, 0x9B, 0xA4, 0x2A, 0x9E, 0x8E,
+    0x86, 0xD5, 0x7D, 0x54, 0xB9, 0xA1, 0x35, 0x92, 0xBD, 0x86, 0xF4, 0x7B, 0x40, 0xF0, 0x0B, 0x2E,
+    0xC0, 0xC0, 0xC7, 0x39, 0x03, 0x0C, 0x92, 0x97, 0x21, 0xE9, 0x06, 0x12, 0x36, 0x41, 0x93, 0x82,
+    0x1E, 0x86, 0x59, 0x73, 0xDC, 0x58, 0x38, 0xE5, 0xDB, 0xF0, 0xCC, 0xD6, 0x69, 0xCA, 0x21, 0x41,
+    0x4F, 0xBD, 0x87, 0x19, 0x0D, 0x40, 0x11, 0xD0, 0x64, 0xED, 0xD0, 0x16, 0x27, 0xC0, 0x52, 0x33,
+    0x74, 0xC9, 0x50, 0x7D, 0x5A, 0x25, 0xFC, 0x83, 0x0B, 0x5A, 0xDA, 0x19, 0xC3, 0x4A, 0x07, 0x5E,
+    0x62, 0xEC, 0x63, 0xCB, 0x68, 0x16, 0x41, 0x5F, 0x88, 0x82, 0x00, 0x70, 0x6C, 0x6F, 0xEF, 0x94,
+    0x21, 0xD3, 0xB6, 0x7D, 0xC5, 0xEB, 0xBD, 0xBD, 0x53, 0xFA, 0x40, 0x37, 0xAB, 0xE5, 0xA1, 0xE4,
+    0x74, 0xAC, 0xF9, 0x6B, 0x58, 0x73, 0xD9, 0x6C, 0xF8, 0xF4, 0x0E, 0x9D, 0x03, 0x70, 0x64, 0x3C,
+    0xF2, 0x48, 0x6C, 0x92, 0x72, 0xC3, 0xB5, 0xD8, 0x24, 0xED, 0x86, 0x2B, 0xB1, 0x89, 0x7A, 0x1A,
+    0xAE, 0x84, 0x26, 0xEA, 0x49, 0x5D, 0x09, 0xED, 0x9D, 0xD5, 0xA8, 0xAE, 0xAC, 0x6D, 0xD4, 0xA3,
+    0xBE, 0xB2, 0x8A, 0xA8, 0x47, 0x7D, 0x75, 0x15, 0xD1, 0x8C, 0xFA, 0xEC, 0x2A, 0x82, 0x81, 0x3E,
+    0xEB, 0x0F, 0x57, 0xD3, 0xDE, 0xDE, 0xDE, 0xDE, 0xDE, 0x9E, 0x3D, 0xA0, 0xAF, 0xD7, 0xF2, 0xF0,
+    0x10, 0xFB, 0xBA, 0xF7, 0x48, 0x3A, 0x06, 0xC9, 0x91, 0x5E, 0xB2, 0xE1, 0xA2, 0x92, 0xA0, 0x33,
+    0x41, 0x72, 0xD4, 0x14, 0xF4, 0x8A, 0x0D, 0xBD, 0x24, 0xAC, 0xEF, 0x38, 0xE9, 0x28, 0x38, 0xAB,
+    0x6F, 0xFA, 0x8F, 0x9E, 0xB3, 0x66, 0xC7, 0x59, 0x51, 0x70, 0x1E, 0xD8, 0x72, 0x96, 0x6C, 0x38,
+    0xF7, 0x04, 0x97, 0x8E, 0x13, 0xBD, 0xA0, 0xB3, 0xAB, 0xE0, 0xAC, 0x63, 0x71, 0xE1, 0x57, 0x3B,
+    0xF1, 0x30, 0x3F, 0xF2, 0xD7, 0x37, 0xFA, 0x9A, 0x13, 0xC8, 0x6B, 0x92, 0x67, 0xC8, 0x12, 0x0F,
+    0x5E, 0xDE, 0x53, 0x7C, 0x78, 0xBB, 0xC6, 0x54, 0xB3, 0x18, 0xDD, 0xDD, 0xB0, 0x53, 0x41, 0x8F,
+    0xBE, 0xA6, 0x21, 0xD6, 0x8D, 0x77, 0xB6, 0x02, 0xE8, 0x46, 0x00, 0x7F, 0x13, 0x87, 0x56, 0xCD,
+    0xE6, 0x1F, 0x54, 0x42, 0xA5, 0x76, 0x35, 0x1C, 0x2F, 0x7E, 0xC5, 0x8E, 0xE2, 0x9B, 0x70, 0xC0,
+    0x50, 0xF4, 0xF9, 0xBE, 0x0A, 0xF8, 0x9B, 0x25, 0x48, 0x68, 0x23, 0xE5, 0x98, 0xA9, 0x10, 0x4F,
+    0xFA, 0x8A, 0x7D, 0xC3, 0x4E, 0x80, 0xA2, 0x97, 0x25, 0xBD, 0x0E, 0xAF, 0x90, 0xBC, 0x9E, 0xED,
+    0x46, 0x27, 0x48, 0xD5, 0x83, 0xAB, 0xE7, 0xC2, 0xF0, 0x14, 0x09, 0x80, 0x19, 0x2B, 0xA1, 0x77,
+    0x05, 0xF0, 0x87, 0x00, 0xC4, 0xE1, 0xD3, 0xB5, 0x35, 0x59, 0x46, 0xE5, 0x1D, 0xFB, 0x12, 0x82,
+    0xDC, 0x90, 0x24, 0xFA, 0x9D, 0x0D, 0xB8, 0x82, 0x2C, 0x9E, 0x9E, 0xE2, 0x5A, 0x65, 0x2E, 0x81,
+    0x4B, 0x2D, 0x59, 0x50, 0x35, 0xD2, 0x69, 0x56, 0xD0, 0x9E, 0xA9, 0x23, 0xAB, 0x23, 0xA9, 0x44,
+    0x95, 0x14, 0xA7, 0x00, 0xE5, 0xC1, 0x14, 0xB8, 0xB1, 0x71, 0xCA, 0x4A, 0x82, 0x1B, 0xB1, 0xC2,
+    0xAC, 0x1D, 0xBD, 0xE1, 0x55, 0x06, 0x93, 0xBA, 0x84, 0xEF, 0xED, 0x92, 0x06, 0x9D, 0x48, 0x3A,
+    0xF0, 0x63, 0xBA, 0xDB, 0x5E, 0xEC, 0x59, 0x6B, 0x37, 0xBE, 0x60, 0x93, 0xA0, 0x00, 0xE2, 0x0F,
+    0x7F, 0x0A, 0x33, 0xFE, 0xD5, 0x7F, 0x05, 0xED, 0xC4, 0x7F, 0x33, 0x2A, 0x87, 0x7F, 0x39, 0x0F,
+    0x0B, 0x1E, 0xFC, 0x67, 0xD2, 0x43, 0xC6, 0x3E, 0xA0, 0xC9, 0x22, 0x02, 0x47, 0xDA, 0xB4, 0x4B,
+    0x6D, 0x53, 0xA2, 0x13, 0xA6, 0x5D, 0x3E, 0x90, 0x05, 0x25, 0x5E, 0x04, 0x72, 0xFD, 0x83, 0xA3,
+    0x53, 0x1F, 0xFF, 0xCE, 0x95, 0xBF, 0x29, 0xD2, 0x5F, 0xFB, 0xAF, 0xFF, 0x42, 0xB0, 0xFB, 0x9F,
+    0xFE, 0x97, 0x4B, 0xC4, 0xD5, 0x3F, 0xFC, 0x29, 0x27, 0x7D, 0x35, 0x58, 0xD7, 0xCD, 0x17, 0xCD,
+    0x81, 0x47, 0x40, 0xD2, 0x31, 0x4A, 0x4E, 0x5C, 0x25, 0xB1, 0x8D, 0xFB, 0xD8, 0x73, 0x92, 0xBC,
+    0xC4, 0xA0, 0xD9, 0x71, 0x66, 0x90, 0x14, 0x9C, 0x75, 0x94, 0x04, 0x17, 0x1D, 0x7A, 0x3E, 0x52,
+    0x5E, 0x35, 0x5C, 0x4C, 0xEC, 0xF9, 0xC8, 0xC1, 0xA0, 0x87, 0x98, 0xFA, 0xE9, 0xF7, 0xA0, 0x9D,
+    0x76, 0x6C, 0x28, 0xD8, 0x47, 0x19, 0x06, 0xAF, 0x67, 0x3B, 0xF1, 0x91, 0x2C, 0x62, 0x17, 0xA4,
+    0x1F, 0x9C, 0x9A, 0x0C, 0xBE, 0x03, 0xE0, 0x24, 0x80, 0x61, 0x34, 0x4E, 0x2F, 0x83, 0xEF, 0x42,
+    0x1B, 0x6B, 0xEC, 0x74, 0xBB, 0xAA, 0xD1, 0x5C, 0x8D, 0x22, 0xE9, 0x65, 0xB8, 0x4E, 0xD8, 0x1F,
+    0x06, 0x11, 0xB5, 0xEB, 0xDD, 0xC5, 0x43, 0x2A, 0xD1, 0x34, 0xE0, 0xF7, 0xA0, 0x66, 0x33, 0x59,
+    0x28, 0x6F, 0x1C, 0x9D, 0x5C, 0xD5, 0xA2, 0xE7, 0x2E, 0xCA, 0x75, 0xF0, 0x4D, 0x16, 0xB1, 0x5F,
+    0x61, 0x9B, 0xD8, 0x06, 0xFC, 0x4E, 0x01, 0x87, 0xCF, 0xD5, 0x5C, 0x9C, 0x74, 0x40, 0x81, 0xB9,
+    0xE7, 0x96, 0x6F, 0x66, 0x51, 0xC8, 0x8A, 0xF7, 0xE2, 0xAF, 0xA2, 0x9B, 0xDB, 0x04, 0xEB, 0xB4,
+    0x97, 0xA1, 0xCD, 0xD0, 0xBE, 0xA5, 0xEB, 0x09, 0x15, 0x61, 0x5D, 0x1B, 0xD0, 0x8D, 0xB8, 0x17,
+    0x10, 0x23, 0xBE, 0x57, 0x73, 0x05, 0x59, 0xD7, 0x72, 0xEC, 0x22, 0xAC, 0x53, 0x51, 0x66, 0xC1,
+    0x49, 0x2D, 0x4D, 0xC0, 0xEF, 0x03, 0xD3, 0x21, 0xBA, 0xFB, 0xAE, 0xDE, 0x94, 0x86, 0xAD, 0x56,
+    0x45, 0xE1, 0x9D, 0x75, 0x12, 0x74, 0x2D, 0xFD, 0xFD, 0xE7, 0x25, 0x47, 0xD8, 0x5D, 0xE4, 0x72,
+    0x0D, 0xA9, 0xA0, 0x2B, 0x91, 0x73, 0x5C, 0xFA, 0x12, 0xA8, 0x14, 0x54, 0xF1, 0x04, 0x64, 0xCB,
+    0x0A, 0x5D, 0x27, 0x40, 0xAE, 0x03, 0x19, 0x64, 0x18, 0x42, 0x4F, 0x7A, 0x19, 0x86, 0x20, 0x48,
+    0x37, 0x44, 0x15, 0x1B, 0x72, 0x54, 0x51, 0x47, 0x41, 0x42, 0x45, 0x1D, 0x7B, 0xD2, 0xE9, 0x78,
+    0xEC, 0x94, 0x22, 0xFD, 0xB1, 0x53, 0x80, 0x39, 0x08, 0xCF, 0xCF, 0x05, 0x41, 0xA9, 0xB1, 0xBC,
+    0xA1, 0x42, 0x4A, 0x7E, 0x28, 0xC6, 0x87, 0xEB, 0xCB, 0x4C, 0x1B, 0x45, 0xA1, 0x03, 0x02, 0xE4,
+    0xAC, 0x0A, 0x99, 0xEF, 0x70, 0x22, 0xAA, 0x2D, 0xA5, 0x9A, 0xAD, 0x68, 0xE3, 0x86, 0x3A, 0x6E,
+    0xB3, 0x65, 0xC7, 0xE2, 0x5D, 0x70, 0x88, 0x8F, 0x02, 0xFC, 0x57, 0x18, 0xD0, 0xFB, 0x36, 0xC2,
+    0x42, 0x3B, 0xE9, 0x45, 0x04, 0xA1, 0xDD, 0xE0, 0xBB, 0xD8, 0x10, 0xD6, 0x29, 0xDF, 0x47, 0x41,
+    0xD0, 0x0D, 0xBE, 0x89, 0x90, 0x77, 0xAA, 0xF9, 0x1D, 0x5B, 0xCE, 0x36, 0xE8, 0x2C, 0x79, 0x85,
+    0xD7, 0x19, 0x2D, 0x6B, 0x66, 0xA4, 0x3F, 0x00, 0xD0, 0x6E, 0xF1, 0x00, 0xB7, 0x49, 0xDC, 0xA3,
+    0x5C, 0xD0, 0x91, 0x73, 0x5B, 0x59, 0xD9, 0x49, 0x24, 0xF3, 0xA9, 0xFF, 0xFD, 0x2E, 0x70, 0x1C,
+    0xED, 0x0F, 0xC3, 0x46, 0x47, 0x8F, 0xA5, 0xC1, 0xB3, 0x11, 0x32, 0xD8, 0x09, 0x7C, 0x69, 0x2D,
+    0x76, 0x0E, 0x39, 0x17, 0xCD, 0xA1, 0x58, 0xBF, 0xE3, 0x9D, 0x69, 0x39, 0x53, 0xCD, 0x10, 0xF1,
+    0xC0, 0x57, 0xAB, 0x46, 0x7B, 0x75, 0x0C, 0xB4, 0x07, 0x84, 0xA6, 0xB9, 0xF0, 0x78, 0x3A, 0xCE,
+    0x80, 0xC9, 0x40, 0xCF, 0xA5, 0x84, 0x80, 0x48, 0x7A, 0xDC, 0xB9, 0x9A, 0x63, 0x44, 0x17, 0x9A,
+    0x6C, 0xC8, 0x6B, 0x64, 0x1C, 0x48, 0x18, 0x16, 0x02, 0x63, 0x79, 0xFC, 0x11, 0x00, 0xC8, 0x47,
+    0x00, 0x7C, 0xF0, 0x8E, 0x2B, 0x51, 0x46, 0x95, 0xA8, 0x6D, 0x76, 0xB1, 0x4D, 0x86, 0x01, 0x90,
+    0x3F, 0xB8, 0x08, 0xB4, 0x27, 0xFE, 0xDB, 0x3F, 0x41, 0xF3, 0xC1, 0x72, 0xF1, 0x3B, 0x08, 0xFF,
+    0xC5, 0xF0, 0x80, 0xFC, 0x2F, 0xCD, 0x97, 0x7C, 0x9C, 0xB4, 0x19, 0x26, 0xB7, 0x9C, 0x3B, 0xFE,
+    0xD3, 0x22, 0xFF, 0xDE, 0x3D, 0xF3, 0xE5, 0xBB, 0x7F, 0xBA, 0x8E, 0xFF, 0x99, 0x1F, 0x1F, 0x04,
+    0x7E, 0x76, 0xDB, 0x05, 0xA5, 0x8D, 0x3C, 0xDE, 0xAD, 0x5B, 0xFC, 0xBE, 0x72, 0x5B, 0xB8, 0x36,
+    0x51, 0xEC, 0x8A, 0xF2, 0x8E, 0x7E, 0xDD, 0x44, 0x95, 0x76, 0x9B, 0x0C, 0xE3, 0x66, 0x11, 0x76,
+    0x71, 0xCB, 0xEB, 0xA5, 0x7C, 0x5D, 0x65, 0x50, 0x6C, 0xCC, 0xED, 0x1D, 0x7D, 0xDC, 0xD2, 0x70,
+    0xE8, 0xDB, 0x53, 0xA0, 0x1D, 0x7D, 0xA5, 0xA8, 0x57, 0x8D, 0xA5, 0x43, 0x5F, 0x90, 0xCA, 0x00,
+    0x5B, 0x80, 0xD3, 0x54, 0x08, 0x1D, 0xA1, 0x63, 0xC7, 0xC9, 0xF8, 0x61, 0x02, 0x9F, 0x0F, 0x90,
+    0xE1, 0x77, 0x01, 0xE3, 0xCE, 0x95, 0xAF, 0xFD, 0x8A, 0x65, 0x79, 0xBE, 0x33, 0xB4, 0x61, 0xB7,
+    0x08, 0x6F, 0x94, 0xB4, 0x86, 0x53, 0x39, 0x9D, 0x81, 0x25, 0x46, 0xB0, 0x61, 0x02, 0x06, 0xCE,
+    0x05, 0x5E, 0x30, 0x1C, 0xD1, 0x73, 0x2E, 0x01, 0x21, 0xDF, 0x10, 0xD1, 0x55, 0x22, 0xB6, 0xFD,
+    0x96, 0xE2, 0x75, 0xA9, 0xCB, 0x5E, 0x2A, 0x4E, 0x9E, 0x6F, 0x6F, 0xD7, 0xCA, 0xB0, 0x25, 0x34,
+    0xDC, 0x1A, 0xC3, 0xDD, 0x19, 0x62, 0x77, 0x03, 0x2F, 0xD5, 0x81, 0x77, 0xEC, 0x14, 0xD0, 0x1C,
+    0x86, 0xC2, 0x8E, 0xBF, 0x02, 0xE0, 0xDE, 0x1A, 0xF5, 0x30, 0x17, 0xC2, 0xB5, 0x58, 0x4A, 0xD0,
+    0xC3, 0x30, 0xDB, 0xB5, 0xCF, 0x80, 0x19, 0x13, 0xBA, 0x88, 0x26, 0xC1, 0x41, 0xAE, 0xE5, 0xB6,
+    0xAA, 0x05, 0x6A, 0x2E, 0xBD, 0x53, 0x82, 0xDC, 0x6B, 0xD0, 0x4B, 0xAC, 0xF7, 0xB4, 0x04, 0x13,
+    0x81, 0x63, 0x09, 0xDB, 0x88, 0x55, 0x9F, 0x58, 0x4A, 0xA8, 0x23, 0x01, 0xE3, 0x6A, 0x40, 0x54,
+    0x91, 0x82, 0x7D, 0x2C, 0x9D, 0xA1, 0x7C, 0xB1, 0x9D, 0x94, 0x2B, 0x73, 0x6C, 0xA8, 0x08, 0xCF,
+    0x5F, 0xD9, 0xE5, 0x23, 0xEA, 0xAB, 0xA4, 0xFD, 0x5B, 0xDF, 0xAE, 0x9F, 0x8C, 0x03, 0x64, 0x2E,
+    0xB8, 0x96, 0x0E, 0xE8, 0x53, 0xB9, 0x79, 0x3A, 0x14, 0x72, 0x40, 0x91, 0x7E, 0x25, 0x9C, 0x99,
+    0x11, 0x47, 0xF6, 0xB6, 0xA4, 0x02, 0xE5, 0xD6, 0x96, 0xC7, 0x84, 0x67, 0x46, 0x60, 0x19, 0x18,
+    0xD0, 0x04, 0x5B, 0x59, 0x07, 0x74, 0x0D, 0x39, 0x19, 0xDF, 0x72, 0x85, 0x5C, 0xDB, 0x34, 0xA3,
+    0x8F, 0x6D, 0x02, 0xBA, 0x28, 0x0E, 0x97, 0x71, 0x2B, 0xFB, 0x58, 0x82, 0xAD, 0xBA, 0x08, 0xA8,
+    0xB5, 0x8B, 0x68, 0xE8, 0xBB, 0x08, 0x45, 0xD7, 0x47, 0x58, 0xA2, 0x8F, 0x60, 0x44, 0x1F, 0xC1,
+    0x05, 0x6D, 0x04, 0x17, 0xE0, 0x59, 0x70, 0x01, 0xFE, 0x4A, 0x09, 0xCD, 0x2C, 0x22, 0xB5, 0x29,
+    0x9A, 0xFF, 0xF8, 0x4D, 0x24, 0x73, 0x70, 0xC4, 0x90, 0x1B, 0x4E, 0x18, 0xD8, 0x70, 0x82, 0x62,
+    0x4B, 0x07, 0x4D, 0x71, 0xA8, 0x7C, 0x78, 0x6F, 0xAC, 0x98, 0xCB, 0x81, 0x15, 0x37, 0xEF, 0xB2,
+    0xAC, 0x68, 0xB7, 0xE5, 0xCF, 0x2C, 0x56, 0x9D, 0x3C, 0xC8, 0xB4, 0xA7, 0xE6, 0x5D, 0xF4, 0xC8,
+    0xF6, 0xAE, 0x3E, 0xC2, 0x8E, 0xA0, 0x93, 0xBE, 0x42, 0x29, 0x9C, 0xD5, 0x82, 0x21, 0x89, 0x84,
+    0x96, 0x8B, 0x76, 0x38, 0xB6, 0x57, 0xFC, 0xEA, 0xBC, 0xF3, 0xB3, 0x96, 0x1D, 0x0B, 0xCD, 0xB8,
+    0x6D, 0xC6, 0x97, 0x98, 0x31, 0xB9, 0xEE, 0xDE, 0xA5, 0x7D, 0x73, 0x0A, 0x22, 0xC3, 0x3A, 0x18,
+    0xD7, 0x97, 0x2E, 0x9A, 0xC1, 0x49, 0x66, 0xC8, 0xB5, 0xE1, 0xD2, 0x12, 0x03, 0x8B, 0x8C, 0x28,
+    0x58, 0x93, 0x99, 0x0F, 0x3E, 0xCB, 0x55, 0x90, 0xAD, 0x0C, 0x80, 0xBB, 0xDE, 0x55, 0x50, 0xCA,
+    0xBC, 0x8B, 0xD2, 0x68, 0xDD, 0xA1, 0x4C, 0x57, 0xCB, 0xF7, 0xBE, 0xFF, 0xFD, 0x3F, 0xFC, 0x5F,
+    0xFF, 0x87, 0xBF, 0xF8, 0xD7, 0x5F, 0xFC, 0xEB, 0xCF, 0x1F, 0xB8, 0xF8, 0x90, 0x49, 0x3A, 0xCA,
+    0x22, 0x89, 0x7E, 0x0F, 0x72, 0x92, 0x4B, 0xFF, 0xFD, 0xEE, 0x3F, 0x15, 0x57, 0x2F, 0x33, 0x5A,
+    0x42, 0xA1, 0x77, 0x3A, 0x9A, 0xF8, 0x7D, 0x7C, 0x1F, 0x66, 0xB1, 0x11, 0x0F, 0xE1, 0x81, 0xBF,
+    0xF1, 0x03, 0x93, 0x6C, 0x3C, 0xBD, 0x74, 0xA9, 0xE7, 0xA3, 0xAE, 0xF9, 0x64, 0xB2, 0x51, 0x9F,
+    0x78, 0x71, 0xBA, 0xB1, 0x3C, 0xF8, 0xDC, 0x69, 0xC9, 0xD1, 0x8E, 0x80, 0xE2, 0x1B, 0xF4, 0x78,
+    0x16, 0x0F, 0x40, 0x4E, 0xDD, 0xDC, 0xAE, 0x88, 0xD0, 0x18, 0x9C, 0x5C, 0x9A, 0x93, 0xE8, 0x57,
+    0x79, 0xE1, 0xD1, 0x4B, 0x8B, 0xFF, 0x99, 0x8A, 0x1D, 0xBB, 0xCB, 0x9F, 0x2D, 0x0F, 0xBE, 0x6E,
+    0x06, 0x3E, 0x6F, 0xA7, 0x7E, 0x91, 0x7C, 0xEC, 0xE1, 0xF7, 0xDD, 0x83, 0x3F, 0x95, 0x0F, 0xF4,
+    0xD7, 0xB8, 0xAA, 0x78, 0xEF, 0x30, 0xF0, 0xEC, 0x06, 0x25, 0x75, 0xD7, 0xED, 0xCB, 0x4D, 0x05,
+    0xDF, 0xBD, 0x22, 0x53, 0x9F, 0x61, 0x2F, 0x13, 0xD2, 0x73, 0x12, 0x51, 0xCF, 0xE0, 0x89, 0x15,
+    0xFA, 0x5A, 0x86, 0x5C, 0x39, 0x89, 0xAC, 0x17, 0xF0, 0xC5, 0x08, 0xF3, 0x31, 0x31, 0xDC, 0xA4,
+    0xEB, 0x69, 0x7C, 0xCB, 0x4F, 0x23, 0xAC, 0xEF, 0x97, 0xFE, 0x25, 0x71, 0xE9, 0xED, 0xFF, 0xEB,
+    0xC1, 0xBF, 0x78, 0xF3, 0x7B, 0x5F, 0xBC, 0xF9, 0x3F, 0xDF, 0xF0, 0x17, 0x5F, 0x37, 0x92, 0x8F,
+    0xD0, 0xA9, 0xA9, 0x19, 0x95, 0xD3, 0xEE, 0x3F, 0x74, 0x9D, 0xEB, 0x5C, 0xE7, 0x7A, 0xD7, 0xBB,
+    0xD3, 0x7F, 0x69, 0x93, 0x4D, 0xC3, 0x32, 0xF0, 0xF1, 0x47, 0x3D, 0x9E, 0xC5, 0x00, 0x39, 0xC9,
+    0x59, 0x2E, 0x83, 0x97, 0xB7, 0xCE, 0xF2, 0x06, 0xE3, 0xF1, 0x73, 0x92, 0x4D, 0xB3, 0xE0, 0x41,
+    0xFC, 0xBE, 0x20, 0x38, 0xE3, 0xE2, 0x77, 0x06, 0xC9, 0xAB, 0x7C, 0xCF, 0xCE, 0x00, 0x24, 0xA4,
+    0xEB, 0x7D, 0x77, 0x51, 0xBC, 0x29, 0xAE, 0x5C, 0xFE, 0x32, 0x91, 0x7F, 0xF7, 0xF4, 0xD4, 0xCD,
+    0xCD, 0x7A, 0xFF, 0x79, 0x13, 0xFF, 0x14, 0x7F, 0x0A, 0x7B, 0xCE, 0x46, 0x7C, 0x0F, 0x0F, 0xFD,
+    0xC9, 0x73, 0x26, 0xD9, 0x70, 0xFA, 0x5C, 0x9B, 0x3B, 0x9E, 0x99, 0x9B, 0x05, 0xFF, 0xFB, 0x87,
+    0x8A, 0x27, 0xDE, 0xFE, 0xCC, 0x3F, 0x78, 0x51, 0x3E, 0xFD, 0xE7, 0x57, 0xB8, 0xA8, 0xC5, 0x52,
+    0xD1, 0x35, 0x1E, 0x17, 0xF1, 0x10, 0x86, 0xB1, 0x9F, 0x85, 0x47, 0x84, 0x81, 0x9A, 0x8E, 0x9C,
+    0x6C, 0x4E, 0x76, 0x14, 0x6F, 0x7B, 0xFF, 0xE0, 0xF7, 0x54, 0xCF, 0x87, 0xF9, 0x96, 0x7F, 0xF6,
+    0x67, 0xF2, 0xF4, 0x85, 0x6B, 0xF4, 0x6A, 0x39, 0x7A, 0xAE, 0x67, 0xF7, 0xC2, 0xFB, 0xEE, 0xC1,
+    0x9F, 0xCA, 0x3F, 0xEA, 0xAE, 0x71, 0xD5, 0x09, 0xF2, 0x77, 0x1F, 0xBF, 0xCA, 0xF7, 0xAA, 0x14,
+    0xB8, 0x05, 0x70, 0x82, 0x71, 0xD0, 0x33, 0x94, 0x87, 0xF4, 0xE8, 0x23, 0x44, 0x42, 0x4B, 0x80,
+    0x23, 0x8C, 0x83, 0xF2, 0x90, 0x2B, 0x44, 0x44, 0x43, 0xC0, 0x4E, 0x50, 0x25, 0xA5, 0x4C, 0x02,
+    0x2A, 0xF4, 0x18, 0x2A, 0xAE, 0x59, 0x93, 0x82, 0x37, 0x1C, 0xA1, 0x17, 0xC8, 0x88, 0x96, 0x23,
+    0x4C, 0x6D, 0x4D, 0x30, 0x1E, 0x32, 0xA3, 0xE1, 0x0C, 0x1D, 0xD1, 0x71, 0x04, 0x3D, 0xEE, 0x79,
+    0xB5, 0xF7, 0x10, 0xA9, 0xD8, 0x8F, 0x11, 0xE0, 0x08, 0x55, 0x76, 0x58, 0x07, 0xB9, 0xA2, 0xAD,
+    0x12, 0x75, 0x45, 0x9B, 0x4B, 0xCB, 0x6F, 0xDF, 0xAC, 0x16, 0xF4, 0xA1, 0x64, 0x20, 0x9F, 0xA0,
+    0x97, 0xDD, 0x69, 0x8C, 0x30, 0xE5, 0x4A, 0x22, 0x44, 0x91, 0x8F, 0x74, 0x30, 0x1E, 0x7A, 0xC5,
+    0x10, 0x21, 0x33, 0x7A, 0x42, 0x70, 0xAA, 0x09, 0xDA, 0xF6, 0x5F, 0x06, 0x80, 0xF3, 0xF7, 0x03,
+    0x30, 0xD2, 0x01, 0xEA, 0xAC, 0x07, 0xE4, 0x5B, 0x01, 0x10, 0xFE, 0x35, 0x00, 0x51, 0x6F, 0x47,
+    0xCC, 0x17, 0xA1, 0x04, 0xEE, 0x88, 0xCD, 0x45, 0xB9, 0x88, 0x1A, 0x70, 0xFC, 0x49, 0x02, 0xF9,
+    0x56, 0x80, 0xA5, 0x7F, 0x1D, 0x3A, 0x45, 0x3D, 0x0E, 0xD9, 0x48, 0xD7, 0xF3, 0xE9, 0x33, 0x5E,
+    0xF0, 0x8D, 0xB7, 0x02, 0xF8, 0xD9, 0xFA, 0x3A, 0x74, 0x8C, 0x7A, 0x1C, 0xA8, 0xA5, 0x13, 0xFC,
+    0xF4, 0x8C, 0x07, 0xF9, 0x5E, 0x84, 0xE6, 0xFA, 0xFA, 0xEF, 0xF4, 0xA4, 0xFD, 0xF4, 0xE1, 0x1D,
+    0xC9, 0x7E, 0xED, 0x77, 0xC9, 0xF3, 0xA6, 0x9D, 0x97, 0x2A, 0x94, 0xFC, 0x8A, 0xFD, 0x7B, 0x11,
+    0x68, 0xD7, 0x1F, 0x00, 0x88, 0x6A, 0x02, 0xB4, 0x9C, 0x81, 0xE1, 0x8A, 0x07, 0x9A, 0xF1, 0xD4,
+    0xE1, 0xB4, 0x01, 0x7F, 0xF9, 0x4D, 0x69, 0x03, 0x86, 0x12, 0x8B, 0xB3, 0x4B, 0x1B, 0xD0, 0x17,
+    0xAD, 0x7C, 0x4B, 0x1B, 0x70, 0x1A, 0xF4, 0x1D, 0x57, 0x49, 0x18, 0x3E, 0x4C, 0xDF, 0x25, 0x48,
+    0xC2, 0x00, 0x0C, 0x9D, 0x87, 0xE4, 0x6C, 0xBA, 0xD1, 0xF2, 0x93, 0xEA, 0x4F, 0x2C, 0x69, 0x03,
+    0xDA, 0xDD, 0xD9, 0x86, 0x4A, 0xEB, 0x29, 0xA9, 0xEA, 0x37, 0x86, 0xCF, 0xA1, 0x9C, 0xC3, 0x25,
+    0x36, 0x82, 0xE4, 0xD8, 0xF2, 0xCF, 0xE8, 0x44, 0xC4, 0x03, 0xA3, 0x08, 0xC5, 0x83, 0x9E, 0x0E,
+    0x15, 0xC7, 0xB8, 0x77, 0xAA, 0x46, 0xB5, 0x99, 0xB1, 0x90, 0x85, 0x0E, 0x15, 0x45, 0xE0, 0x1E,
+    0x14, 0xCA, 0xD7, 0x14, 0x07, 0x03, 0x3F, 0x04, 0x06, 0x32, 0x4F, 0xC3, 0x46, 0x9C, 0x5B, 0x87,
+    0x1D, 0x3A, 0x24, 0x57, 0xA0, 0xD9, 0x9F, 0x4A, 0xCD, 0x05, 0xC3, 0x5A, 0xE2, 0xC1, 0x4B, 0xBD,
+    0xD6, 0xBA, 0xA4, 0xA7, 0x15, 0x4C, 0xB5, 0xE6, 0x56, 0x8F, 0xC5, 0x1F, 0x4F, 0x77, 0x7B, 0x6D,
+    0x17, 0x5D, 0x8C, 0xF7, 0x2D, 0x73, 0xF3, 0xE1, 0x1A, 0x3D, 0xCF, 0xE6, 0xE2, 0x76, 0x3A, 0xC3,
+    0x52, 0xBF, 0x40, 0x2E, 0x80, 0xE4, 0xB4, 0xD5, 0xB6, 0xA4, 0xF9, 0x71, 0xA6, 0xD6, 0x35, 0xED,
+    0x8F, 0x1B, 0x6A, 0x2D, 0x4B, 0x48, 0xB7, 0xEB, 0xE9, 0x80, 0xFB, 0xF7, 0x5F, 0x29, 0xEE, 0x8A,
+    0x12, 0x10, 0x5E, 0xB2, 0x19, 0x71, 0x05, 0xF4, 0xDC, 0xD5, 0x44, 0x97, 0x7C, 0x97, 0x24, 0xF9,
+    0xF9, 0x13, 0xFC, 0xD1, 0x93, 0x3C, 0x05, 0x33, 0x83, 0x0E, 0xC3, 0xCD, 0x27, 0xE8, 0xD1, 0xED,
+    0x88, 0x01, 0x85, 0xA8, 0x50, 0x68, 0xB2, 0x85, 0x6D, 0x9C, 0x80, 0xB6, 0x84, 0x1B, 0x96, 0xB5,
+    0x59, 0x87, 0x83, 0x88, 0x4E, 0x71, 0x1B, 0xA1, 0x3A, 0xDE, 0x79, 0xA0, 0xD9, 0xC2, 0xDE, 0x96,
+    0x6A, 0x96, 0xEF, 0xE2, 0x4D, 0x4B, 0xBE, 0xF7, 0x9F, 0x1B, 0x57, 0x92, 0x2F, 0xCB, 0x92, 0x63,
+    0xCD, 0xF5, 0x73, 0xAD, 0x97, 0xBB, 0xEA, 0x2E, 0x8F, 0x83, 0x93, 0x0B, 0x34, 0x9D, 0x72, 0x6A,
+    0x86, 0xB9, 0xE0, 0x14, 0xE9, 0x70, 0xB1, 0x19, 0x15, 0x39, 0xE2, 0x62, 0x0D, 0xE5, 0x7C, 0x0E,
+    0x50, 0x2C, 0x52, 0x48, 0x67, 0x3A, 0xA8, 0x5C, 0xDC, 0x55, 0x3D, 0x67, 0xED, 0x87, 0x05, 0x0D,
+    0xBD, 0xF6, 0x83, 0x07, 0xFA, 0x50, 0x6A, 0x11, 0xB5, 0x1F, 0x56, 0xFC, 0x47, 0x22, 0x6A, 0x3F,
+    0x04, 0xD8, 0x0B, 0x51, 0xFB, 0x21, 0x36, 0x64, 0xD0, 0x7E, 0x88, 0x82, 0xF4, 0xDA, 0x0F, 0xA9,
+    0x25, 0xDD, 0xB1, 0x93, 0x47, 0x4E, 0xE1, 0xBE, 0x3B, 0x09, 0xEE, 0xC8, 0x40, 0x13, 0xA1, 0x27,
+    0xC0, 0x40, 0x7A, 0x40, 0xB9, 0x36, 0x02, 0x72, 0x81, 0x05, 0x44, 0xC0, 0xE0, 0x80, 0x84, 0x6E,
+    0x3D, 0x32, 0xEA, 0x11, 0x49, 0xF8, 0xC1, 0x29, 0x92, 0xE4, 0x2F, 0x48, 0x92, 0xBF, 0xAA, 0xE3,
+    0xC1, 0x0E, 0x49, 0x4F, 0x50, 0x57, 0x79, 0x62, 0x46, 0xF7, 0x2B, 0x7E, 0xB0, 0xA2, 0x49, 0x4C,
+    0x11, 0xD0, 0xA4, 0x05, 0x24, 0x3F, 0xA5, 0x83, 0xE0, 0x67, 0x5C, 0x00, 0x46, 0x1B, 0x00, 0x95,
+    0x87, 0x54, 0xC6, 0xCF, 0x88, 0x86, 0x73, 0xF1, 0x2A, 0x14, 0xCF, 0x43, 0x1F, 0x01, 0x91, 0x77,
+    0x51, 0x64, 0xCD, 0xAD, 0xFF, 0x1E, 0x5B, 0xC0, 0xC1, 0x40, 0x7A, 0x64, 0x43, 0x7A, 0x71, 0x93,
+    0x1F, 0x59, 0x2F, 0x3F, 0x8E, 0x50, 0x4E, 0xBF, 0xE4, 0xA0, 0xC7, 0x6C, 0x80, 0xD7, 0xC5, 0xCD,
+    0xF8, 0x1F, 0xB4, 0x41, 0x7E, 0xEC, 0xD9, 0x2F, 0xFA, 0xA5, 0x2B, 0x51, 0xB9, 0x6C, 0xA4, 0xB7,
+    0xE2, 0x66, 0xD4, 0x97, 0xA3, 0xFC, 0xD8, 0xB3, 0xF9, 0x13, 0xF3, 0xD2, 0x95, 0x88, 0x26, 0x9B,
+    0x3E, 0xA0, 0xBB, 0x19, 0x87, 0x00, 0xFD, 0xB1, 0xD7, 0xF9, 0x49, 0xBE, 0xE4, 0x0C, 0x99, 0x4D,
+    0xC9, 0xDC, 0x8A, 0xFB, 0x0A, 0x77, 0xF1, 0xBB, 0x17, 0xA6, 0x92, 0x01, 0x7B, 0xCB, 0xA3, 0x2F,
+    0x4B, 0x3E, 0xB5, 0x08, 0x28, 0xD2, 0xA1, 0xF9, 0x09, 0xCF, 0xD7, 0x04, 0xDC, 0xFD, 0x87, 0x11,
+    0xE8, 0x6A, 0x32, 0xD0, 0x08, 0xE8, 0x77, 0xE8, 0xD0, 0x79, 0x19, 0x81, 0xD7, 0x60, 0x1C, 0xA4,
+    0xEB, 0x22, 0x10, 0x61, 0x1C, 0xFA, 0xB9, 0x8F, 0x80, 0xFD, 0x33, 0xBA, 0x9A, 0x5D, 0x4B, 0xD5,
+    0xD4, 0x94, 0x11, 0x68, 0xF8, 0xB4, 0x3B, 0xC8, 0x88, 0xE3, 0x0A, 0x68, 0x66, 0xC9, 0x03, 0xB6,
+    0x50, 0xF3, 0xCC, 0xC9, 0x22, 0x71, 0x1A, 0x32, 0x96, 0x0F, 0xE8, 0x8B, 0x48, 0x1C, 0xBF, 0x53,
+    0xE0, 0x0C, 0x45, 0x8F, 0xA1, 0xCA, 0xAD, 0x92, 0x08, 0x11, 0xFB, 0x76, 0xD9, 0x30, 0x29, 0xBD,
+    0x00, 0xF7, 0xD8, 0x42, 0xA8, 0xA9, 0x6F, 0x29, 0xBF, 0x0F, 0x32, 0x84, 0xED, 0xB7, 0x0A, 0x24,
+    0x6F, 0x9D, 0x2F, 0x24, 0xCF, 0xAE, 0xE6, 0x38, 0x8D, 0x80, 0x61, 0x04, 0x8E, 0x56, 0xA9, 0x63,
+    0x48, 0xF2, 0xFA, 0xA1, 0xA0, 0xE5, 0xE1, 0x00, 0x8D, 0xF3, 0x00, 0xDD, 0x08, 0x08, 0xAA, 0x1D,
+    0x64, 0xAF, 0x6B, 0x6A, 0x0B, 0x57, 0xC3, 0x34, 0x65, 0xCD, 0x05, 0x56, 0xF2, 0x9A, 0x5F, 0x9A,
+    0xD0, 0x3E, 0x46, 0x8B, 0x2D, 0x6D, 0x5D, 0xB5, 0x8E, 0x39, 0x41, 0xD4, 0x1F, 0x17, 0x48, 0x3B,
+    0xB7, 0xDC, 0xAF, 0x38, 0x03, 0x4D, 0xCF, 0x71, 0x73, 0xDA, 0x95, 0xE4, 0x30, 0xED, 0x7E, 0x71,
+    0x7E, 0x70, 0xF3, 0xDA, 0x6D, 0x99, 0x03, 0x09, 0xEC, 0x3D, 0x99, 0x9F, 0xE0, 0xE7, 0x7B, 0x55,
+    0x7C, 0x39, 0xE8, 0x19, 0x76, 0xAA, 0x74, 0xFC, 0x88, 0x2E, 0x57, 0x43, 0xEC, 0x47, 0x17, 0x58,
+    0xAF, 0x6C, 0xDA, 0xE5, 0x8C, 0xEB, 0x0B, 0x89, 0x75, 0xA3, 0xB7, 0x96, 0x9F, 0x3C, 0x81, 0x62,
+    0x3E, 0xF4, 0xA3, 0x04, 0x9B, 0x6F, 0x70, 0xCB, 0xBA, 0x18, 0x0F, 0x47, 0x8D, 0x57, 0x21, 0x73,
+    0xC7, 0xC1, 0x81, 0x77, 0x50, 0x79, 0xDD, 0x41, 0x6A, 0xAD, 0xAF, 0x7F, 0x71, 0x94, 0x7C, 0xA5,
+    0x9C, 0x92, 0xAB, 0xA1, 0xA2, 0x4D, 0xC1, 0x3D, 0x35, 0xC9, 0x04, 0xC9, 0x2F, 0x62, 0x73, 0x0E,
+    0x0C, 0xDA, 0x01, 0x8A, 0xA2, 0x80, 0x18, 0xDA, 0x01, 0x3A, 0x96, 0x17, 0x93, 0x9E, 0x00, 0x1D,
+    0x44, 0x28, 0x2F, 0x66, 0xC0, 0x04, 0x41, 0xFE, 0x58, 0x14, 0x2A, 0x93, 0x0E, 0x82, 0xE4, 0xA3,
+    0x74, 0x9A, 0x0C, 0x3A, 0x89, 0x9B, 0xA7, 0x79, 0x85, 0x5E, 0x4F, 0xF6, 0xFF, 0x50, 0xBC, 0x12,
+    0x64, 0x04, 0xC9, 0x3F, 0x2F, 0x89, 0x18, 0x2A, 0x92, 0x5B, 0xB1, 0xDD, 0x58, 0x12, 0x51, 0x39,
+    0xC8, 0x02, 0xC3, 0xF6, 0xA5, 0x7F, 0xBA, 0x15, 0xDB, 0x5A, 0x77, 0xC7, 0x8B, 0xE6, 0x64, 0x09,
+    0x10, 0x28, 0x6E, 0xE4, 0xCA, 0x8D, 0xDD, 0xA2, 0x88, 0xFB, 0x5B, 0xC5, 0x3F, 0x73, 0xEF, 0x96,
+    0xD2, 0xBB, 0xA6, 0xB2, 0x85, 0x9E, 0xD1, 0xEC, 0xED, 0xED, 0x3D, 0x99, 0xAB, 0xAB, 0x64, 0x0B,
+    0xFA, 0xDE, 0xAD, 0x4C, 0x9B, 0x1D, 0x78, 0xAC, 0x78, 0x21, 0x1E, 0xBD, 0xFD, 0xE8, 0xF6, 0xE6,
+    0x86, 0x0E, 0x6D, 0x49, 0xF8, 0xD3, 0x45, 0x00, 0xCC, 0xA7, 0xB9, 0xD4, 0xC0, 0xE4, 0xB1, 0x46,
+    0x64, 0xD4, 0x81, 0x30, 0x02, 0xF8, 0xDB, 0xBC, 0x79, 0x87, 0x15, 0xA7, 0x4B, 0x92, 0xFD, 0x36,
+    0x02, 0x8A, 0x63, 0xCF, 0x0C, 0xC3, 0x20, 0xC8, 0x45, 0x7D, 0xE9, 0xC1, 0xD3, 0xAE, 0x8B, 0x06,
+    0xC3, 0xF5, 0x08, 0x73, 0xD5, 0x37, 0x1C, 0x5C, 0x97, 0x0C, 0xE4, 0xCD, 0x04, 0xCD, 0x04, 0xC3,
+    0x84, 0x12, 0x72, 0x14, 0x71, 0x9A, 0x23, 0xE4, 0x5C, 0xB2, 0xF1, 0x94, 0x08, 0x1C, 0xD2, 0xDC,
+    0xE5, 0x50, 0xC1, 0x2E, 0xBB, 0x67, 0x65, 0x3E, 0xDD, 0x56, 0x1E, 0x39, 0x29, 0x63, 0x73, 0x6A,
+    0xB3, 0x8F, 0xEE, 0x2E, 0x87, 0x6F, 0x51, 0x96, 0x59, 0xF4, 0x4D, 0xE5, 0xB1, 0xE2, 0x9C, 0x4A,
+    0xDB, 0xB6, 0x85, 0x1B, 0x1E, 0xDE, 0x77, 0xFF, 0x85, 0x7C, 0x5E, 0x73, 0x85, 0xA6, 0x87, 0xA6,
+    0x83, 0xE6, 0x02, 0xCD, 0x15, 0xF7, 0x0E, 0xB1, 0xDC, 0xC1, 0x2E, 0x17, 0x07, 0x5A, 0xCF, 0xA2,
+    0x9E, 0xF5, 0xE5, 0x47, 0x4B, 0x70, 0x74, 0x7F, 0xC2, 0x05, 0xEC, 0x72, 0x47, 0x9C, 0x84, 0xBC,
+    0xFE, 0x7A, 0xC9, 0xB5, 0x2D, 0x99, 0x71, 0x1F, 0x39, 0x77, 0xE4, 0x04, 0xC3, 0xBF, 0xB7, 0x74,
+    0xFC, 0x32, 0xE3, 0x9F, 0x94, 0x48, 0xA5, 0x0C, 0xCD, 0xFC, 0xF4, 0x3B, 0x4C, 0x6D, 0x32, 0x84,
+    0xB9, 0xFA, 0x89, 0x57, 0xE1, 0x4F, 0xCC, 0xD3, 0x2C, 0x52, 0xC6, 0x70, 0x41, 0xC7, 0x05, 0x30,
+    0x3B, 0x9A, 0xE0, 0x33, 0xBB, 0x94, 0xA4, 0x9D, 0xDF, 0x19, 0xD0, 0xF6, 0x1C, 0xD0, 0x92, 0x63,
+    0x11, 0x4B, 0xED, 0xC6, 0xDA, 0x5D, 0x60, 0xF8, 0x69, 0xC4, 0xF0, 0xE5, 0xE7, 0x44, 0x1F, 0x93,
+    0x76, 0x6D, 0xD6, 0x27, 0x56, 0xD8, 0x13, 0x6F, 0x27, 0xA8, 0x6B, 0xC1, 0x8E, 0xBD, 0xCF, 0x6A,
+    0x6E, 0xA3, 0xFE, 0xE1, 0x0A, 0x2B, 0xDF, 0x4F, 0x50, 0x57, 0x82, 0x1D, 0xFB, 0x35, 0xAB, 0xB9,
+    0x4D, 0xFA, 0x87, 0x2B, 0xEC, 0x8B, 0x1F, 0x24, 0xA8, 0xCF, 0x22, 0xC7, 0x2E, 0x52, 0xCF, 0x9B,
+    0x8A, 0x53, 0x23, 0xBF, 0x8B, 0x74, 0x12, 0x35, 0x0E, 0x7E, 0xEE, 0x08, 0x88, 0x9A, 0xEC, 0x72,
+    0x86, 0x9D, 0xD0, 0x25, 0xF4, 0xE5, 0x77, 0x06, 0xE8, 0xD0, 0xE5, 0x3D, 0x5B, 0xE3, 0xD9, 0x26,
+    0x59, 0xE4, 0x2B, 0x77, 0x24, 0xAF, 0x9A, 0xED, 0xA5, 0x10, 0x8E, 0xCF, 0x55, 0x35, 0x47, 0x1C,
+    0x64, 0x83, 0xC9, 0xDB, 0x8B, 0x63, 0x4F, 0xF0, 0xF3, 0xBD, 0x03, 0xB1, 0xB4, 0xE9, 0x36, 0x38,
+    0x50, 0x74, 0xF0, 0x37, 0x00, 0x20, 0xA2, 0xFA, 0x86, 0xFA, 0x83, 0xE4, 0xBA, 0x4B, 0x35, 0xF6,
+    0x05, 0xAB, 0x48, 0x2D, 0x1C, 0x3D, 0xBD, 0x93, 0xFB, 0x5D, 0xDE, 0x19, 0xEE, 0x76, 0xDE, 0x90,
+    0x42, 0x19, 0x77, 0xA0, 0xC1, 0x8A, 0xEA, 0x5C, 0x28, 0xD0, 0x99, 0x9C, 0x36, 0x5C, 0x6C, 0xA0,
+    0xAB, 0x32, 0x5F, 0x91, 0x33, 0x14, 0x99, 0xA0, 0x6F, 0x25, 0x2E, 0x3A, 0x58, 0x99, 0x87, 0x55,
+    0x39, 0x3E, 0xBC, 0xF6, 0xBE, 0x1F, 0xEF, 0x2D, 0x12, 0xD0, 0xEE, 0x44, 0x62, 0xEF, 0x77, 0x62,
+    0xF1, 0x8E, 0x9D, 0xCD, 0x79, 0x00, 0xF8, 0xDD, 0x1D, 0x54, 0x60, 0xDC, 0x86, 0x27, 0x94, 0x33,
+    0xCA, 0xA8, 0x18, 0x21, 0xCC, 0xBC, 0xCB, 0x72, 0x1C, 0x0D, 0x0B, 0x98, 0x5B, 0xEE, 0xCF, 0xB2,
+    0x71, 0x95, 0xB8, 0xFD, 0x9B, 0x5A, 0xB7, 0x3C, 0xF2, 0x72, 0x02, 0xD0, 0x02, 0xFF, 0x0F, 0xAD,
+    0x97, 0xBF, 0xAF, 0xE4, 0x56, 0x15, 0xC7, 0x3F, 0xB6, 0xC9, 0x0E, 0x89, 0x45, 0x4C, 0x93, 0x86,
+    0x45, 0xB8, 0xA1, 0x49, 0x84, 0x64, 0xFE, 0x00, 0x90, 0x27, 0xA2, 0xA0, 0xA0, 0x79, 0x05, 0x69,
+    0x42, 0xF1, 0x52, 0x07, 0xA1, 0xED, 0x91, 0x88, 0x27, 0x4A, 0x91, 0xE2, 0x15, 0x6C, 0x11, 0x1A,
+    0xAA, 0x14, 0x8B, 0x10, 0x8F, 0x22, 0x14, 0x14, 0x69, 0x76, 0xED, 0xEC, 0x16, 0x5B, 0xE2, 0x80,
+    0x10, 0x12, 0xCD, 0x5A, 0xAB, 0x48, 0x28, 0xA4, 0x58, 0x07, 0x19, 0xE2, 0xDD, 0x5C, 0xFB, 0x43,
+    0x71, 0x67, 0xE6, 0x6D, 0x76, 0x13, 0x12, 0xA4, 0x58, 0x9E, 0xEF, 0x39, 0xB6, 0xEF, 0x1C, 0xDF,
+    0x7B, 0x7E, 0x7C, 0xCF, 0x35, 0x00, 0x50, 0x75, 0x40, 0x3E, 0x02, 0x69, 0x00, 0x68, 0x3F, 0xE3,
+    0x66, 0xD6, 0x55, 0xDD, 0x37, 0xB3, 0x90, 0x8F, 0xE5, 0x3B, 0xFE, 0x39, 0x54, 0xA1, 0x5C, 0xDA,
+    0x2A, 0xA0, 0xCE, 0x14, 0x3A, 0x83, 0x4E, 0x90, 0x3B, 0x01, 0xED, 0x08, 0x6C, 0x46, 0x80, 0x97,
+    0x80, 0x14, 0x76, 0xB0, 0xE9, 0xB2, 0x1E, 0xCA, 0x21, 0x9F, 0xA0, 0xEE, 0xB2, 0x00, 0x82, 0x64,
+    0x01, 0xEA, 0x2E, 0x9F, 0xA0, 0x1C, 0x2A, 0xD5, 0xB9, 0x51, 0x5D, 0xA2, 0x5E, 0x4C, 0x50, 0x8E,
+    0x71, 0x4C, 0x1C, 0x4F, 0xB3, 0x4B, 0x17, 0xA8, 0xFA, 0xCD, 0x0C, 0x79, 0x97, 0x0D, 0x07, 0xFB,
+    0x5C, 0x05, 0x6E, 0x00, 0x0E, 0xA0, 0x24, 0x3A, 0x26, 0x6A, 0x6A, 0x75, 0x3A, 0x99, 0xBF, 0xBB,
+    0x7C, 0x2B, 0x9D, 0xBE, 0x06, 0xD7, 0x81, 0x6A, 0x0B, 0x79, 0x0F, 0xE9, 0x04, 0x5C, 0x27, 0x19,
+    0xAA, 0x6D, 0x6F, 0xDE, 0x2F, 0xD5, 0xBF, 0xFE, 0xED, 0xF3, 0xEA, 0xB6, 0x54, 0x50, 0x28, 0x56,
+    0x60, 0x05, 0x9E, 0x8C, 0xDE, 0xE2, 0x89, 0x17, 0xDF, 0xCE, 0xD5, 0x54, 0xDD, 0xA9, 0x43, 0xED,
+    0x09, 0x85, 0x03, 0x99, 0x2B, 0xAC, 0x0E, 0xD4, 0xBF, 0x5C, 0x29, 0x06, 0x87, 0xCD, 0x54, 0xAC,
+    0xC9, 0x82, 0x43, 0xB3, 0x2D, 0xD6, 0xB2, 0xC3, 0x0E, 0x8A, 0x0E, 0xD8, 0x3D, 0xFD, 0xBB, 0x13,
+    0x32, 0x15, 0xB5, 0xAF, 0x75, 0x22, 0x69, 0x16, 0xA8, 0xDD, 0x51, 0x3B, 0x50, 0x7F, 0x3C, 0x53,
+    0x4F, 0x2B, 0xF5, 0x54, 0x77, 0xF5, 0x54, 0x8C, 0xF5, 0x94, 0x85, 0x7A, 0xA2, 0x2D, 0x27, 0xAA,
+    0x9B, 0x13, 0xF0, 0x6D, 0xE0, 0x12, 0x71, 0x05, 0xF9, 0xC2, 0xA5, 0xAB, 0x76, 0x59, 0x28, 0x02,
+    0x62, 0x57, 0xEF, 0xCA, 0x50, 0x0C, 0x89, 0xAF, 0x4F, 0x54, 0x0F, 0x02, 0xA9, 0x42, 0x6D, 0x47,
+    0xE6, 0x58, 0xEA, 0x9C, 0xEB, 0x92, 0xAA, 0xDB, 0x97, 0xCF, 0xCF, 0x3B, 0xE0, 0xBB, 0x40, 0x9D,
+    0xBC, 0x49, 0xF5, 0xE1, 0x42, 0x35, 0x35, 0xDB, 0x6A, 0x2E, 0x86, 0x72, 0xCE, 0x42, 0x19, 0xB0,
+    0x08, 0x54, 0x7F, 0x0A, 0xE4, 0x06, 0x12, 0x17, 0xA8, 0x17, 0x28, 0x34, 0x1C, 0xA6, 0xDE, 0x3D,
+    0x77, 0x7E, 0xFE, 0xE6, 0xDE, 0x2B, 0x05, 0x00, 0x0D, 0x40, 0xB6, 0x00, 0x94, 0x13, 0x80, 0x3B,
+    0xA0, 0x88, 0x19, 0xD4, 0x01, 0x1B, 0xD5, 0xB1, 0x51, 0xBD, 0xA5, 0x6A, 0x39, 0x03, 0x54, 0xAA,
+    0x63, 0xA9, 0xDA, 0x55, 0xAA, 0x54, 0x33, 0x40, 0x3D, 0x01, 0xD4, 0x3D, 0xC0, 0x2B, 0x00, 0xFC,
+    0x81, 0x87, 0x8E, 0xAF, 0x02, 0xA4, 0x77, 0x3B, 0x20, 0x9D, 0xAF, 0x03, 0xE9, 0x5A, 0xF5, 0x90,
+    0x7A, 0xB6, 0x40, 0xEA, 0x5D, 0x7B, 0x12, 0xE7, 0x76, 0x21, 0x71, 0xAD, 0xEC, 0x13, 0xEF, 0x9D,
+    0x7D, 0xBC, 0x26, 0xDE, 0xBE, 0x3B, 0xB7, 0x83, 0xEF, 0xCE, 0x37, 0x8A, 0xA5, 0xEE, 0x5F, 0xA9,
+    0x76, 0x6B, 0xD6, 0x97, 0x67, 0xC3, 0xD3, 0x7C, 0x7D, 0x73, 0x77, 0x06, 0x92, 0xF9, 0x06, 0xC0,
+    0x2B, 0xD5, 0x0E, 0x28, 0xCF, 0x06, 0xE0, 0x8B, 0x3D, 0xD8, 0x1F, 0x7F, 0xE4, 0x98, 0xFB, 0x71,
+    0xE6, 0x76, 0x47, 0x57, 0x24, 0x6E, 0x81, 0x54, 0x1A, 0xD5, 0x44, 0xD5, 0x8D, 0xEA, 0x0A, 0x50,
+    0x86, 0x46, 0xF5, 0x1D, 0xD5, 0xB0, 0x51, 0xED, 0x8E, 0xEE, 0xB3, 0x07, 0xB2, 0x15, 0x20, 0x1B,
+    0x01, 0x36, 0xDB, 0xE3, 0x1B, 0xFF, 0x9F, 0x49, 0x3E, 0xF4, 0xE0, 0x64, 0x73, 0x77, 0x86, 0xEF,
+    0x27, 0xF3, 0x0D, 0xC6, 0xE8, 0x88, 0x62, 0x29, 0xCF, 0x06, 0x7B, 0xFF, 0x76, 0x77, 0xB6, 0x2F,
+    0x9C, 0x5B, 0x7B, 0x5C, 0x2B, 0x7B, 0x4A, 0xCF, 0xEC, 0x49, 0xBC, 0x6B, 0x07, 0xE5, 0xDC, 0x76,
+    0x90, 0xAC, 0x55, 0x07, 0x94, 0x67, 0xDD, 0x31, 0x0A, 0x70, 0x31, 0x29, 0xBE, 0x47, 0xD6, 0xC1,
+    0x66, 0x64, 0x01, 0xDC, 0x96, 0x23, 0x94, 0x53, 0xE2, 0x96, 0x6C, 0x25, 0x0F, 0x60, 0x47, 0x3D,
+    0x52, 0x8D, 0xE0, 0x6E, 0xA3, 0xBA, 0x44, 0x7F, 0x4C, 0xB5, 0xAA, 0xB7, 0x57, 0x20, 0x8F, 0x2C,
+    0xE0, 0xAE, 0x51, 0xED, 0x53, 0xD5, 0x99, 0x7C, 0x25, 0x5F, 0xA1, 0x9E, 0x12, 0x77, 0x07, 0xD3,
+    0x9B, 0x81, 0xEB, 0xC0, 0x77, 0xC8, 0x76, 0xFB, 0x18, 0xA4, 0x2B, 0x90, 0xBB, 0x83, 0x2A, 0x12,
+    0x42, 0x60, 0xE3, 0x1D, 0x77, 0x95, 0xA7, 0xCE, 0x8D, 0xA7, 0x2E, 0xB5, 0xA7, 0x67, 0x21, 0xBF,
+    0x72, 0xFA, 0xEA, 0x40, 0x75, 0xBA, 0xE3, 0xD3, 0x20, 0xBF, 0x72, 0xFA, 0xEA, 0x50, 0x7B, 0x7A,
+    0x16, 0x1A, 0x4F, 0x5D, 0x2A, 0x4F, 0x9D, 0x37, 0xDE, 0x71, 0x47, 0x6B, 0xD8, 0x5B, 0xCE, 0xDD,
+    0xED, 0xDF, 0x16, 0x63, 0x9F, 0x9E, 0x00, 0xCD, 0x00, 0x85, 0x3B, 0x12, 0xC3, 0x3E, 0x11, 0x92,
+    0x15, 0x28, 0x7B, 0x48, 0x16, 0xA0, 0xEC, 0x93, 0x1B, 0xCF, 0x2F, 0x89, 0x56, 0x5D, 0xA3, 0xA1,
+    0x50, 0x6F, 0xFA, 0xAA, 0xA1, 0x1E, 0x32, 0x5F, 0x5F, 0xA8, 0xA6, 0xA6, 0x4B, 0xFC, 0x61, 0xA0,
+    0x18, 0x9B, 0x3E, 0x31, 0x73, 0xDB, 0xF6, 0xB5, 0x86, 0x44, 0xDD, 0xE5, 0x3A, 0x52, 0x19, 0xA0,
+    0x59, 0x81, 0x67, 0x0E, 0x1E, 0x7F, 0x12, 0xB8, 0xEC, 0xD5, 0x74, 0x82, 0x52, 0x87, 0xB6, 0x27,
+    0x57, 0xEF, 0xCD, 0xA4, 0xFB, 0x14, 0x6B, 0x97, 0x44, 0x77, 0x94, 0x2B, 0xA9, 0x03, 0xA9, 0x1D,
+    0x95, 0x50, 0x8F, 0xE4, 0x4E, 0xE4, 0x92, 0xEA, 0x0E, 0x7B, 0x1A, 0x03, 0x45, 0xA0, 0x0C, 0x76,
+    0xD8, 0x6D, 0x2C, 0x16, 0x8A, 0x90, 0xD8, 0xD9, 0x27, 0x76, 0xCD, 0x98, 0x2F, 0x94, 0xA1, 0x0C,
+    0xD8, 0xE3, 0x6D, 0x29, 0x16, 0x8A, 0xC5, 0x0E, 0x3B, 0x74, 0xA4, 0x0A, 0x14, 0x06, 0x36, 0x76,
+    0xE8, 0x1B, 0x3F, 0x31, 0x90, 0xC7, 0x18, 0xC6, 0xA4, 0x9F, 0x28, 0x54, 0x8D, 0x5C, 0x60, 0x1F,
+    0x83, 0x3E, 0x53, 0x8F, 0xAD, 0x2E, 0xA4, 0x81, 0x2B, 0xBE, 0x0F, 0x39, 0x8F, 0x1C, 0xCF, 0xBD,
+    0xC9, 0x9E, 0xDA, 0xC9, 0xED, 0x88, 0x74, 0x19, 0xF9, 0x8D, 0xC2, 0x05, 0x68, 0xEF, 0x05, 0xC8,
+    0xAC, 0x26, 0xA8, 0xE6, 0x66, 0x04, 0x7B, 0x7B, 0x72, 0x53, 0x3B, 0xEA, 0x29, 0x73, 0x9B, 0xDA,
+    0x15, 0x2B, 0xC5, 0x4A, 0x19, 0x68, 0x47, 0xEA, 0x39, 0xB3, 0xA3, 0x1D, 0xCB, 0x05, 0x1C, 0x1C,
+    0xC9, 0xBC, 0xED, 0x5F, 0x5F, 0x38, 0xF5, 0x54, 0x75, 0x6D, 0x54, 0xEF, 0xAB, 0xFA, 0x8F, 0x8B,
+    0x24, 0x5C, 0x54, 0x3F, 0x52, 0xFD, 0xBB, 0xFF, 0x6C, 0x1F, 0x64, 0x2B, 0x6E, 0x8B, 0x39, 0x5B,
+    0xA8, 0x87, 0x62, 0xC2, 0x5D, 0xDD, 0x7F, 0x09, 0xB7, 0x00, 0x48, 0x7E, 0xCC, 0x0B, 0x7C, 0xE9,
+    0xA6, 0xEB, 0xA1, 0x98, 0x4A, 0xD5, 0xE3, 0x62, 0xFE, 0x73, 0x7E, 0x7E, 0x7E, 0xBE, 0x6B, 0xE2,
+    0xD5, 0x47, 0xEA, 0x9D, 0xF5, 0xFC, 0xBC, 0x9A, 0x22, 0xFB, 0xD6, 0x63, 0xFC, 0x35, 0x23, 0xB4,
+    0x43, 0x64, 0x71, 0x21, 0x0B, 0xD0, 0x74, 0x87, 0x32, 0x2E, 0x17, 0x12, 0x1F, 0x9C, 0xFF, 0x56,
+    0xBD, 0x13, 0x2D, 0x2F, 0xEA, 0x08, 0x9C, 0x7C, 0x23, 0xD6, 0xF3, 0x5C, 0x6B, 0x68, 0xD7, 0xF3,
+    0x37, 0x80, 0x48, 0x76, 0x1A, 0x20, 0xD1, 0x19, 0x32, 0x7F, 0x43, 0x34, 0x09, 0x9B, 0x19, 0x20,
+    0x9F, 0x00, 0x8A, 0x09, 0xA0, 0x1C, 0x01, 0xAA, 0xC8, 0xA7, 0x03, 0x40, 0xD3, 0x1F, 0xFB, 0x49,
+    0xE4, 0xD6, 0xC4, 0x1D, 0x90, 0xBA, 0x85, 0x6D, 0x26, 0xF0, 0xF6, 0x46, 0xA0, 0xFD, 0xD1, 0x0A,
+    0x34, 0xF7, 0x16, 0xA0, 0x76, 0x01, 0x4A, 0x03, 0x50, 0x18, 0x80, 0x8D, 0x33, 0x90, 0x39, 0x01,
+    0xC9, 0xB1, 0x8F, 0x01, 0xD5, 0x4A, 0x3B, 0x50, 0x3B, 0xBA, 0x52, 0xAB, 0xC6, 0x5D, 0x49, 0x28,
+    0x96, 0x4B, 0xF6, 0xCD, 0x6B, 0x81, 0xAA, 0xDB, 0x7C, 0xB8, 0x90, 0x0D, 0x84, 0x66, 0xCB, 0x4C,
+    0x5D, 0xF6, 0xD4, 0xDB, 0xEA, 0x56, 0xA0, 0xD1, 0x31, 0x66, 0x73, 0xFC, 0x47, 0x16, 0xCB, 0xAE,
+    0x71, 0x72, 0x25, 0x73, 0xCC, 0xEF, 0xC3, 0x13, 0x47, 0x86, 0xBC, 0x32, 0x00, 0x85, 0x3D, 0xA0,
+    0x5B, 0xC8, 0xD7, 0x9F, 0x01, 0x75, 0xFF, 0x15, 0x40, 0x80, 0x4D, 0x00, 0xA8, 0x06, 0x00, 0xB7,
+    0xC7, 0xCE, 0x5A, 0x8C, 0x00, 0x4D, 0x5C, 0x38, 0x40, 0x3E, 0x5F, 0xF8, 0xE6, 0xD3, 0xC7, 0xA5,
+    0x8F, 0x8E, 0x4B, 0xDC, 0xC2, 0x2F, 0x8A, 0x00, 0xB9, 0x8E, 0x24, 0xEA, 0x8E, 0x4C, 0x03, 0x64,
+    0x3A, 0x40, 0x1A, 0x3B, 0xD2, 0xCB, 0x57, 0x2F, 0xDC, 0x32, 0xD5, 0x53, 0x3D, 0xD7, 0xA1, 0x09,
+    0x6D, 0x68, 0xC3, 0xC3, 0x95, 0xF9, 0x29, 0x4F, 0xAA, 0x21, 0x39, 0x29, 0xEC, 0xEB, 0x9B, 0xFA,
+    0x5A, 0xA8, 0xFF, 0xB2, 0xD4, 0xB7, 0x42, 0xE9, 0x5C, 0xF5, 0x8D, 0x40, 0xBB, 0x7B, 0x74, 0xCC,
+    0x0F, 0x42, 0x7D, 0x7B, 0x69, 0x6E, 0x5F, 0x8C, 0x49, 0xF6, 0x63, 0x00, 0x9E, 0x3D, 0x2E, 0x26,
+    0x59, 0x01, 0xEA, 0xEE, 0x90, 0x21, 0x71, 0xF9, 0x75, 0x0F, 0xE4, 0x7B, 0x96, 0x49, 0x2E, 0x3A,
+    0xC8, 0xED, 0xF5, 0x5C, 0xC3, 0x3E, 0x81, 0x62, 0x76, 0xB5, 0x1F, 0xAC, 0xB4, 0x6A, 0xAC, 0x80,
+    0x5B, 0xAA, 0xE1, 0xE7, 0x6F, 0x4D, 0x87, 0x66, 0x11, 0x4D, 0x17, 0xF3, 0x85, 0xE9, 0x21, 0x9A,
+    0x06, 0x5E, 0x38, 0xC6, 0x6D, 0x0B, 0x90, 0x8E, 0x00, 0x97, 0x03, 0x40, 0x23, 0x90, 0x6A, 0x07,
+    0xB9, 0x6E, 0xA1, 0x71, 0x81, 0x44, 0xDF, 0x83, 0x5C, 0x77, 0xB0, 0x71, 0x05, 0x92, 0xE8, 0xD3,
+    0xC6, 0x75, 0x0B, 0xB5, 0x7A, 0x95, 0xA4, 0x55, 0xAF, 0x42, 0xA3, 0x02, 0x57, 0x62, 0xC7, 0xBF,
+    0xE2, 0x18, 0xB7, 0x03, 0x3C, 0x7B, 0x02, 0x97, 0x29, 0x5C, 0xDF, 0xD8, 0xEF, 0x9D, 0xAE, 0x65,
+    0x91, 0x3C, 0x9F, 0xF8, 0xA9, 0xDA, 0x03, 0xCF, 0xBC, 0x35, 0x7F, 0x82, 0x26, 0xD3, 0xDD, 0xC5,
+    0x1E, 0x2C, 0x8B, 0x9B, 0x86, 0xF8, 0xDA, 0x76, 0x4F, 0x9D, 0x6E, 0x81, 0xD6, 0x89, 0xC3, 0xE4,
+    0x8E, 0x17, 0x33, 0x50, 0x39, 0xC1, 0x65, 0x9D, 0xC9, 0xD5, 0xE5, 0x92, 0xBA, 0x6E, 0x0B, 0xF5,
+    0x2A, 0x85, 0xF6, 0x50, 0xF8, 0x1E, 0x50, 0xDC, 0x07, 0x78, 0x6A, 0x0B, 0x2F, 0xEE, 0xE0, 0x45,
+    0xED, 0x9E, 0xBA, 0xA8, 0x94, 0xB1, 0xD6, 0xF5, 0x57, 0xB4, 0xEF, 0x9F, 0x3C, 0x94, 0x23, 0x81,
+    0x32, 0x60, 0xC0, 0x90, 0x1A, 0x12, 0x43, 0x16, 0xCF, 0x40, 0x16, 0xC8, 0xE6, 0x0B, 0x6C, 0x55,
+    0x97, 0xC7, 0x71, 0xB3, 0xF0, 0xB9, 0x67, 0x7E, 0xC0, 0xB8, 0x41, 0xF8, 0x1F, 0xE7, 0xA1, 0xBA,
+    0xF2, 0x00, 0x14, 0x0B, 0x55, 0x28, 0x16, 0x0C, 0xC5, 0x9A, 0x1A, 0xCA, 0x35, 0x33, 0x94, 0x6B,
+    0x16, 0x80, 0x6C, 0x3E, 0x40, 0xEB, 0x92, 0x5E, 0x6B, 0x5D, 0xB2, 0x70, 0x84, 0x79, 0xB3, 0xF0,
+    0x08, 0x6C, 0x2E, 0x20, 0xE4, 0x17, 0xB0, 0x46, 0xC8, 0x2F, 0x60, 0xC9, 0x57, 0xF2, 0x05, 0xE0,
+    0x1C, 0xAA, 0x80, 0x60, 0x40, 0x52, 0x03, 0x92, 0x45, 0x0C, 0x24, 0x92, 0xCD, 0x24, 0xEB, 0x1E,
+    0x5B, 0x97, 0xF4, 0x71, 0x5C, 0xD8, 0x2C, 0x44, 0xCC, 0x3E, 0x1B, 0xF3, 0x23, 0x06, 0xF2, 0xF5,
+    0x80, 0xCE, 0xF9, 0x4A, 0x66, 0x78, 0x18, 0x63, 0xC4, 0x2E, 0x5D, 0xDB, 0xEF, 0xEC, 0xC3, 0x51,
+    0x56, 0x81, 0x2A, 0x94, 0x21, 0x31, 0x60, 0x28, 0xF7, 0x21, 0xAC, 0x96, 0xCC, 0x39, 0x73, 0xAE,
+    0x96, 0xCD, 0x1C, 0xE9, 0x3B, 0x9F, 0x62, 0x79, 0x1E, 0xA4, 0xAA, 0xE1, 0xD2, 0xB5, 0x28, 0xF3,
+    0xE9, 0x51, 0x99, 0x07, 0xF2, 0xC0, 0xE3, 0xB2, 0x08, 0x14, 0x9F, 0x2F, 0x8B, 0xF9, 0x11, 0x19,
+    0x8A, 0x40, 0xB1, 0x50, 0x84, 0x62, 0xF9, 0xA4, 0xDC, 0xA7, 0xE2, 0xF9, 0x31, 0x1B, 0xA3, 0xCF,
+    0xF7, 0x6E, 0x4F, 0x0E, 0x9E, 0x3F, 0x3A, 0xFF, 0xE8, 0xFF, 0x2C, 0xEC, 0x43, 0x10, 0x95, 0x98,
+    0x90, 0x47, 0x25, 0x7D, 0x5C, 0x39, 0x24, 0xE4, 0x51, 0xC9, 0xBE, 0x98, 0x92, 0x3F, 0xA4, 0xE4,
+    0x2B, 0xD9, 0x21, 0x93, 0x2F, 0x14, 0xE7, 0x83, 0x12, 0x1E, 0x57, 0xE2, 0xB6, 0x61, 0xCF, 0x9C,
+    0x4D, 0x14, 0x9B, 0xFD, 0xB2, 0x63, 0x1B, 0x8D, 0xFD, 0xE0, 0xCA, 0xBA, 0x4D, 0x84, 0x42, 0x6F,
+    0xEA, 0x42, 0xF3, 0xC1, 0x52, 0xE8, 0x9C, 0x06, 0x5E, 0x6A, 0x74, 0x2C, 0x06, 0x92, 0xDF, 0x7B,
+    0xBE, 0xAB, 0xBA, 0xD8, 0x32, 0xEA, 0xFB, 0x91, 0x08, 0x1B, 0x7B, 0xDC, 0x41, 0xE3, 0x98, 0xAD,
+    0x40, 0xE9, 0x58, 0x44, 0x16, 0x1E, 0x0E, 0xDF, 0x39, 0x6E, 0xC9, 0xFA, 0xCC, 0x6C, 0xFD, 0x35,
+    0xF5, 0x83, 0x36, 0x14, 0x2E, 0x59, 0xFC, 0x44, 0x9E, 0xAB, 0xF8, 0xCD, 0x38, 0x34, 0x3A, 0xA4,
+    0xDA, 0x5D, 0xF2, 0x13, 0xB4, 0xF5, 0x5F,
 };
 
 static const EpdGlyph opendyslexic_14_boldGlyphs[] = {
@@ -2308,7 +2305,7 @@ static const EpdGlyph opendyslexic_14_boldGlyphs[] = {
     { 5, 27, 11, 3, 22, 34, 9920 }, // |
     { 14, 30, 16, 1, 23, 105, 9954 }, // }
     { 12, 6, 14, 1, 22, 18, 10059 }, // ~
-    { 0, 0, 25, 0, 0, 0, 0 }, //  
+    { 0, 0, 25, 0, 0, 0, 10077 }, //  
     { 9, 37, 22, 6, 32, 84, 0 }, // ¡
     { 15, 27, 23, 4, 22, 102, 84 }, // ¢
     { 19, 26, 20, 1, 25, 124, 186 }, // £
@@ -2319,625 +2316,631 @@ static const EpdGlyph opendyslexic_14_boldGlyphs[] = {
     { 15, 7, 16, 0, 24, 27, 664 }, // ¨
     { 14, 13, 20, 3, 28, 46, 691 }, // ©
     { 10, 10, 19, 6, 22, 25, 737 }, // ª
-    { 16, 16, 16, 0, 15, 64, 762 }, // «
-    { 16, 11, 18, 1, 11, 44, 826 }, // ¬
-    { 16, 4, 18, 1, 11, 16, 870 }, // ­
-    { 14, 13, 20, 3, 32, 46, 886 }, // ®
-    { 13, 5, 15, 1, 22, 17, 932 }, // ¯
-    { 14, 13, 20, 3, 22, 46, 949 }, // °
-    { 16, 18, 18, 1, 16, 72, 995 }, // ±
-    { 8, 11, 9, 1, 24, 22, 1067 }, // ²
-    { 8, 11, 10, 1, 24, 22, 1089 }, // ³
-    { 7, 7, 8, 1, 23, 13, 1111 }, // ´
-    { 18, 22, 25, 3, 17, 99, 1124 }, // µ
-    { 17, 25, 22, 2, 21, 107, 1223 }, // ¶
-    { 7, 7, 8, 0, 14, 13, 1330 }, // ·
-    { 8, 9, 10, 1, 1, 18, 1343 }, // ¸
-    { 7, 12, 9, 1, 25, 21, 1361 }, // ¹
-    { 10, 10, 19, 6, 21, 25, 1382 }, // º
-    { 16, 16, 22, 3, 15, 64, 1407 }, // »
-    { 27, 27, 36, 4, 25, 183, 1471 }, // ¼
-    { 30, 27, 36, 4, 25, 203, 1654 }, // ½
-    { 27, 26, 36, 4, 24, 176, 1857 }, // ¾
-    { 18, 37, 19, 1, 21, 167, 2033 }, // ¿
-    { 25, 33, 28, 2, 33, 207, 2200 }, // À
-    { 25, 38, 28, 2, 38, 238, 2407 }, // Á
-    { 25, 35, 28, 2, 35, 219, 2645 }, // Â
-    { 25, 34, 28, 2, 34, 213, 2864 }, // Ã
-    { 25, 35, 28, 2, 35, 219, 3077 }, // Ä
-    { 25, 35, 28, 2, 35, 219, 3296 }, // Å
-    { 36, 26, 40, 2, 25, 234, 3515 }, // Æ
-    { 22, 35, 29, 3, 27, 193, 3749 }, // Ç
-    { 19, 35, 27, 4, 35, 167, 3942 }, // È
-    { 19, 39, 27, 4, 39, 186, 4109 }, // É
-    { 19, 36, 27, 4, 36, 171, 4295 }, // Ê
-    { 19, 36, 27, 4, 36, 171, 4466 }, // Ë
-    { 13, 36, 16, 0, 36, 117, 4637 }, // Ì
-    { 8, 41, 16, 4, 41, 82, 4754 }, // Í
-    { 16, 38, 16, 0, 38, 152, 4836 }, // Î
-    { 15, 38, 16, 0, 38, 143, 4988 }, // Ï
-    { 27, 25, 31, -1, 25, 169, 5131 }, // Ð
-    { 22, 34, 30, 4, 34, 187, 5300 }, // Ñ
-    { 25, 36, 33, 4, 34, 225, 5487 }, // Ò
-    { 25, 41, 33, 4, 39, 257, 5712 }, // Ó
-    { 25, 38, 33, 4, 36, 238, 5969 }, // Ô
-    { 25, 37, 33, 4, 35, 232, 6207 }, // Õ
-    { 25, 38, 33, 4, 36, 238, 6439 }, // Ö
-    { 17, 10, 17, 0, 12, 43, 6677 }, // ×
-    { 41, 59, 33, -4, 43, 605, 6720 }, // Ø
-    { 22, 36, 30, 4, 35, 198, 7325 }, // Ù
-    { 22, 41, 30, 4, 40, 226, 7523 }, // Ú
-    { 22, 38, 30, 4, 37, 209, 7749 }, // Û
-    { 22, 38, 30, 4, 37, 209, 7958 }, // Ü
-    { 23, 42, 31, 4, 42, 242, 8167 }, // Ý
-    { 14, 24, 16, 1, 24, 84, 8409 }, // Þ
-    { 18, 26, 20, 1, 24, 117, 8493 }, // ß
-    { 17, 27, 25, 4, 26, 115, 8610 }, // à
-    { 17, 31, 25, 4, 30, 132, 8725 }, // á
-    { 17, 28, 25, 4, 27, 119, 8857 }, // â
-    { 17, 27, 25, 4, 26, 115, 8976 }, // ã
-    { 17, 28, 25, 4, 27, 119, 9091 }, // ä
-    { 17, 28, 25, 4, 27, 119, 9210 }, // å
-    { 29, 19, 37, 4, 18, 138, 9329 }, // æ
-    { 15, 25, 23, 4, 18, 94, 9467 }, // ç
-    { 17, 30, 25, 4, 29, 128, 9561 }, // è
-    { 17, 35, 25, 4, 34, 149, 9689 }, // é
-    { 17, 32, 25, 4, 31, 136, 9838 }, // ê
-    { 17, 32, 25, 4, 31, 136, 9974 }, // ë
-    { 12, 25, 14, 0, 25, 75, 10110 }, // ì
-    { 7, 30, 14, 4, 30, 53, 10185 }, // í
-    { 17, 27, 14, -1, 27, 115, 10238 }, // î
-    { 14, 25, 14, 0, 25, 88, 10353 }, // ï
-    { 23, 26, 20, -1, 24, 150, 10441 }, // ð
-    { 17, 27, 25, 4, 27, 115, 10591 }, // ñ
-    { 17, 27, 25, 4, 26, 115, 10706 }, // ò
-    { 17, 32, 25, 4, 31, 136, 10821 }, // ó
-    { 17, 29, 25, 4, 28, 124, 10957 }, // ô
-    { 17, 28, 25, 4, 27, 119, 11081 }, // õ
-    { 17, 29, 25, 4, 28, 124, 11200 }, // ö
-    { 22, 21, 26, 2, 20, 116, 11324 }, // ÷
-    { 19, 51, 25, 3, 35, 243, 11440 }, // ø
-    { 17, 27, 25, 4, 26, 115, 11683 }, // ù
-    { 17, 32, 25, 4, 31, 136, 11798 }, // ú
-    { 17, 29, 25, 4, 28, 124, 11934 }, // û
-    { 17, 29, 25, 4, 28, 124, 12058 }, // ü
-    { 19, 43, 27, 4, 34, 205, 12182 }, // ý
-    { 14, 31, 16, 1, 25, 109, 12387 }, // þ
-    { 19, 39, 27, 4, 30, 186, 12496 }, // ÿ
-    { 25, 35, 28, 2, 35, 219, 0 }, // Ā
-    { 17, 29, 25, 4, 28, 124, 219 }, // ā
-    { 25, 35, 28, 2, 35, 219, 343 }, // Ă
-    { 17, 28, 25, 4, 27, 119, 562 }, // ă
-    { 25, 33, 28, 2, 25, 207, 681 }, // Ą
-    { 19, 27, 25, 4, 18, 129, 888 }, // ą
-    { 22, 36, 29, 3, 36, 198, 1017 }, // Ć
-    { 15, 25, 23, 4, 25, 94, 1215 }, // ć
-    { 22, 38, 29, 3, 38, 209, 1309 }, // Ĉ
-    { 17, 27, 23, 3, 27, 115, 1518 }, // ĉ
-    { 22, 36, 29, 3, 36, 198, 1633 }, // Ċ
-    { 15, 26, 23, 4, 26, 98, 1831 }, // ċ
-    { 22, 38, 29, 3, 38, 209, 1929 }, // Č
-    { 16, 28, 23, 4, 28, 112, 2138 }, // č
-    { 22, 37, 31, 4, 37, 204, 2250 }, // Ď
-    { 23, 26, 26, 4, 25, 150, 2454 }, // ď
-    { 27, 25, 31, -1, 25, 169, 2604 }, // Đ
-    { 22, 26, 26, 4, 25, 143, 2773 }, // đ
-    { 19, 36, 27, 4, 36, 171, 2916 }, // Ē
-    { 17, 32, 25, 4, 31, 136, 3087 }, // ē
-    { 19, 36, 27, 4, 36, 171, 3223 }, // Ĕ
-    { 17, 32, 25, 4, 31, 136, 3394 }, // ĕ
-    { 19, 36, 27, 4, 36, 171, 3530 }, // Ė
-    { 17, 32, 25, 4, 31, 136, 3701 }, // ė
-    { 19, 32, 27, 4, 25, 152, 3837 }, // Ę
-    { 17, 29, 25, 4, 17, 124, 3989 }, // ę
-    { 19, 38, 27, 4, 38, 181, 4113 }, // Ě
-    { 17, 34, 25, 4, 33, 145, 4294 }, // ě
-    { 26, 40, 34, 4, 39, 260, 4439 }, // Ĝ
-    { 18, 39, 25, 4, 30, 176, 4699 }, // ĝ
-    { 26, 38, 34, 4, 37, 247, 4875 }, // Ğ
-    { 17, 37, 25, 4, 28, 158, 5122 }, // ğ
-    { 26, 39, 34, 4, 38, 254, 5280 }, // Ġ
-    { 17, 37, 25, 4, 28, 158, 5534 }, // ġ
-    { 26, 44, 34, 4, 43, 286, 5692 }, // Ģ
-    { 17, 39, 25, 4, 30, 166, 5978 }, // ģ
-    { 22, 37, 31, 4, 37, 204, 6144 }, // Ĥ
-    { 22, 35, 26, 0, 35, 193, 6348 }, // ĥ
-    { 25, 25, 31, 3, 25, 157, 6541 }, // Ħ
-    { 22, 25, 26, 0, 25, 138, 6698 }, // ħ
-    { 11, 38, 16, 2, 38, 105, 6836 }, // Ĩ
-    { 12, 27, 14, 1, 27, 81, 6941 }, // ĩ
-    { 16, 37, 16, -1, 37, 148, 7022 }, // Ī
-    { 17, 27, 14, -2, 27, 115, 7170 }, // ī
-    { 9, 32, 16, 3, 25, 72, 7285 }, // Į
-    { 8, 36, 14, 3, 27, 72, 7357 }, // į
-    { 8, 38, 16, 4, 38, 76, 7429 }, // İ
-    { 6, 17, 14, 4, 17, 26, 7505 }, // ı
-    { 23, 36, 46, 11, 25, 207, 7531 }, // Ĳ
-    { 18, 34, 14, 3, 27, 153, 7738 }, // ĳ
-    { 20, 43, 26, 4, 36, 215, 7891 }, // Ĵ
-    { 17, 37, 18, 3, 29, 158, 8106 }, // ĵ
-    { 22, 40, 31, 4, 40, 220, 8264 }, // Ķ
-    { 18, 40, 26, 4, 25, 180, 8484 }, // ķ
-    { 15, 16, 19, 2, 16, 60, 8664 }, // ĸ
-    { 18, 34, 26, 4, 34, 153, 8724 }, // Ĺ
-    { 9, 38, 17, 4, 38, 86, 8877 }, // ĺ
-    { 20, 39, 26, 2, 39, 195, 8963 }, // Ļ
-    { 11, 41, 17, 2, 25, 113, 9158 }, // ļ
-    { 18, 25, 26, 4, 25, 113, 9271 }, // Ľ
-    { 14, 30, 17, 4, 30, 105, 9384 }, // ľ
-    { 18, 25, 26, 4, 25, 113, 9489 }, // Ŀ
-    { 14, 25, 17, 4, 25, 88, 9602 }, // ŀ
-    { 32, 45, 26, -8, 35, 360, 9690 }, // Ł
-    { 22, 25, 17, -6, 25, 138, 10050 }, // ł
-    { 22, 35, 30, 4, 35, 193, 10188 }, // Ń
-    { 17, 29, 25, 4, 29, 124, 10381 }, // ń
-    { 22, 37, 30, 4, 25, 204, 10505 }, // Ņ
-    { 17, 30, 25, 4, 18, 128, 10709 }, // ņ
-    { 22, 38, 30, 4, 38, 209, 10837 }, // Ň
-    { 18, 31, 25, 4, 31, 140, 11046 }, // ň
-    { 17, 30, 25, 4, 30, 128, 11186 }, // ŉ
-    { 22, 32, 30, 4, 25, 176, 11314 }, // Ŋ
-    { 17, 24, 25, 4, 18, 102, 11490 }, // ŋ
-    { 25, 38, 33, 4, 36, 238, 11592 }, // Ō
-    { 17, 29, 25, 4, 28, 124, 11830 }, // ō
-    { 25, 38, 33, 4, 36, 238, 11954 }, // Ŏ
-    { 17, 29, 25, 4, 28, 124, 12192 }, // ŏ
-    { 27, 37, 33, 4, 35, 250, 12316 }, // Ő
-    { 25, 28, 25, 2, 27, 175, 12566 }, // ő
-    { 35, 28, 35, 4, 26, 245, 12741 }, // Œ
-    { 29, 19, 31, 4, 18, 138, 12986 }, // œ
-    { 20, 34, 28, 4, 34, 170, 13124 }, // Ŕ
-    { 13, 25, 21, 4, 25, 82, 13294 }, // ŕ
-    { 20, 40, 28, 4, 40, 200, 13376 }, // Ŗ
-    { 14, 30, 21, 3, 30, 105, 13576 }, // ŗ
-    { 20, 37, 28, 4, 37, 185, 13681 }, // Ř
-    { 17, 27, 21, 1, 27, 115, 13866 }, // ř
-    { 23, 36, 31, 4, 34, 207, 13981 }, // Ś
-    { 17, 27, 25, 4, 25, 115, 14188 }, // ś
-    { 23, 37, 31, 4, 35, 213, 14303 }, // Ŝ
-    { 17, 29, 25, 4, 27, 124, 14516 }, // ŝ
-    { 23, 33, 31, 4, 25, 190, 14640 }, // Ş
-    { 17, 26, 25, 4, 18, 111, 14830 }, // ş
-    { 23, 38, 31, 4, 36, 219, 14941 }, // Š
-    { 17, 30, 25, 4, 28, 128, 15160 }, // š
-    { 23, 33, 31, 4, 25, 190, 15288 }, // Ţ
-    { 15, 29, 23, 4, 22, 109, 15478 }, // ţ
-    { 23, 37, 31, 4, 37, 213, 15587 }, // Ť
-    { 19, 28, 23, 4, 27, 133, 15800 }, // ť
-    { 23, 25, 31, 4, 25, 144, 15933 }, // Ŧ
-    { 16, 23, 23, 3, 22, 92, 16077 }, // ŧ
-    { 22, 38, 30, 4, 37, 209, 16169 }, // Ũ
-    { 17, 29, 25, 4, 28, 124, 16378 }, // ũ
-    { 22, 38, 30, 4, 37, 209, 16502 }, // Ū
-    { 17, 28, 25, 4, 27, 119, 16711 }, // ū
-    { 22, 38, 30, 4, 37, 209, 16830 }, // Ŭ
-    { 17, 29, 25, 4, 28, 124, 17039 }, // ŭ
-    { 22, 40, 30, 4, 39, 220, 17163 }, // Ů
-    { 17, 31, 25, 4, 30, 132, 17383 }, // ů
-    { 26, 37, 30, 4, 36, 241, 17515 }, // Ű
-    { 25, 27, 25, 2, 26, 169, 17756 }, // ű
-    { 22, 32, 30, 4, 25, 176, 17925 }, // Ų
-    { 17, 26, 25, 4, 17, 111, 18101 }, // ų
-    { 33, 37, 42, 4, 37, 306, 18212 }, // Ŵ
-    { 24, 31, 32, 4, 30, 186, 18518 }, // ŵ
-    { 23, 39, 31, 4, 39, 225, 18704 }, // Ŷ
-    { 19, 40, 27, 4, 31, 190, 18929 }, // ŷ
-    { 23, 39, 31, 4, 39, 225, 19119 }, // Ÿ
-    { 23, 34, 32, 4, 34, 196, 19344 }, // Ź
-    { 18, 28, 26, 4, 28, 126, 19540 }, // ź
-    { 23, 34, 32, 4, 34, 196, 19666 }, // Ż
-    { 18, 28, 26, 4, 28, 126, 19862 }, // ż
-    { 23, 36, 32, 4, 36, 207, 19988 }, // Ž
-    { 18, 30, 26, 4, 30, 135, 20195 }, // ž
-    { 11, 24, 18, 3, 24, 66, 20330 }, // ſ
-    { 12, 6, 0, 0, 23, 18, 0 }, // ̀
-    { 7, 7, 0, 1, 23, 13, 18 }, // ́
-    { 16, 8, 0, 0, 1, 32, 31 }, // ̂
-    { 12, 6, 0, 1, 22, 18, 63 }, // ̃
-    { 16, 5, 0, 1, 21, 20, 81 }, // ̄
-    { 21, 5, 0, 0, 27, 27, 101 }, // ̅
-    { 14, 6, 0, 1, 21, 21, 128 }, // ̆
-    { 7, 7, 0, 4, 24, 13, 149 }, // ̇
-    { 14, 6, 0, 0, 21, 21, 162 }, // ̈
-    { 6, 7, 0, 6, 19, 11, 183 }, // ̉
-    { 8, 8, 0, 1, 23, 16, 194 }, // ̊
-    { 25, 6, 0, 1, 23, 38, 210 }, // ̋
-    { 16, 8, 0, 0, 23, 32, 248 }, // ̌
-    { 25, 6, 0, -7, 23, 38, 280 }, // ̏
-    { 10, 10, 0, 0, 23, 25, 318 }, // ̒
-    { 10, 10, 0, 0, 22, 25, 343 }, // ̓
-    { 10, 10, 0, -1, 22, 25, 368 }, // ̔
-    { 7, 9, 0, 1, 0, 16, 393 }, // ̘
-    { 7, 9, 0, 1, 0, 16, 409 }, // ̙
-    { 14, 9, 0, 1, 24, 32, 425 }, // ̚
-    { 7, 9, 0, 0, 20, 16, 457 }, // ̛
-    { 5, 9, 0, 1, 0, 12, 473 }, // ̜
-    { 8, 7, 0, 1, 4, 14, 485 }, // ̝
-    { 8, 6, 0, 1, 0, 12, 499 }, // ̞
-    { 7, 7, 0, 2, -2, 13, 511 }, // ̟
-    { 16, 5, 0, 1, -3, 20, 524 }, // ̠
-    { 8, 7, 0, 0, 3, 14, 544 }, // ̣
-    { 14, 6, 0, 0, -2, 21, 558 }, // ̤
-    { 8, 8, 0, 1, 23, 16, 579 }, // ̥
-    { 10, 10, 0, 0, 5, 25, 595 }, // ̦
-    { 8, 9, 0, 1, 1, 18, 620 }, // ̧
-    { 9, 10, 0, 1, 1, 23, 638 }, // ̨
-    { 6, 10, 0, 1, -1, 15, 661 }, // ̩
-    { 13, 7, 0, 0, 0, 23, 676 }, // ̪
-    { 18, 9, 0, -1, 1, 41, 699 }, // ̬
-    { 18, 9, 0, -1, 1, 41, 740 }, // ̭
-    { 13, 8, 0, 1, 25, 26, 781 }, // ̰
-    { 15, 5, 0, 1, 24, 19, 807 }, // ̱
-    { 16, 5, 0, 0, -1, 20, 826 }, // ̲
-    { 13, 8, 0, 1, 25, 26, 846 }, // ̴
-    { 16, 4, 0, 0, 11, 16, 872 }, // ̵
-    { 5, 10, 0, 1, 0, 13, 888 }, // ̹
-    { 13, 9, 0, 0, 1, 30, 901 }, // ̺
-    { 12, 10, 0, 0, 1, 30, 931 }, // ̻
-    { 11, 8, 0, 1, 1, 22, 961 }, // ̼
-    { 9, 7, 0, 2, 22, 16, 983 }, // ̽
-    { 12, 6, 0, 1, 22, 18, 999 }, // ͂
-    { 6, 8, 0, 7, 26, 12, 1017 }, // ̓
-    { 14, 22, 0, 1, 37, 77, 1029 }, // ̈́
-    { 13, 7, 0, 0, 24, 23, 1106 }, // ͆
-    { 16, 11, 0, 1, 0, 44, 1129 }, // ͇
-    { 13, 9, 0, 1, 1, 30, 1173 }, // ͈
-    { 11, 9, 0, 1, -1, 25, 1203 }, // ͉
-    { 15, 23, 0, 1, 31, 87, 1228 }, // ͊
-    { 26, 22, 0, 1, 33, 143, 1315 }, // ͋
-    { 18, 17, 0, 12, 17, 77, 1458 }, // ͌
-    { 15, 7, 0, 2, -3, 27, 1535 }, // ͍
-    { 5, 5, 0, 1, 4, 7, 1562 }, // ͎
-    { 25, 8, 0, 1, 2, 50, 1569 }, // ͜
-    { 25, 8, 0, 1, 24, 50, 1619 }, // ͡
-    { 31, 9, 0, 1, -1, 70, 1669 }, // ͢
-    { 18, 36, 26, 4, 36, 162, 0 }, // Ѐ
-    { 19, 36, 27, 4, 36, 171, 162 }, // Ё
-    { 25, 27, 20, -4, 25, 169, 333 }, // Ђ
-    { 17, 34, 19, 1, 33, 145, 502 }, // Ѓ
-    { 22, 25, 24, 1, 23, 138, 647 }, // Є
-    { 23, 27, 31, 4, 25, 156, 785 }, // Ѕ
-    { 8, 25, 16, 4, 25, 50, 941 }, // І
-    { 13, 36, 16, 1, 36, 117, 991 }, // Ї
-    { 18, 32, 26, 4, 25, 144, 1108 }, // Ј
-    { 29, 24, 34, 2, 22, 174, 1252 }, // Љ
-    { 27, 24, 18, -5, 23, 162, 1426 }, // Њ
-    { 27, 27, 31, 4, 27, 183, 1588 }, // Ћ
-    { 22, 34, 31, 4, 34, 187, 1771 }, // Ќ
-    { 22, 38, 30, 4, 38, 209, 1958 }, // Ѝ
-    { 19, 37, 23, 2, 34, 176, 2167 }, // Ў
-    { 19, 28, 23, 2, 21, 133, 2343 }, // Џ
-    { 25, 25, 28, 2, 25, 157, 2476 }, // А
-    { 15, 21, 19, 2, 21, 79, 2633 }, // Б
-    { 16, 23, 20, 2, 22, 92, 2712 }, // В
-    { 17, 23, 19, 1, 22, 98, 2804 }, // Г
-    { 23, 26, 24, 1, 22, 150, 2902 }, // Д
-    { 18, 25, 26, 4, 25, 113, 3052 }, // Е
-    { 36, 25, 32, -1, 25, 225, 3165 }, // Ж
-    { 15, 22, 19, 2, 21, 83, 3390 }, // З
-    { 22, 25, 30, 4, 25, 138, 3473 }, // И
-    { 22, 38, 30, 4, 38, 209, 3611 }, // Й
-    { 22, 25, 31, 4, 25, 138, 3820 }, // К
-    { 19, 24, 18, -1, 22, 114, 3958 }, // Л
-    { 23, 23, 25, 1, 22, 133, 4072 }, // М
-    { 22, 25, 31, 4, 25, 138, 4205 }, // Н
-    { 25, 28, 33, 4, 26, 175, 4343 }, // О
-    { 18, 24, 20, 1, 23, 108, 4518 }, // П
-    { 19, 25, 27, 4, 25, 119, 4626 }, // Р
-    { 22, 27, 29, 3, 27, 149, 4745 }, // С
-    { 23, 25, 31, 4, 25, 144, 4894 }, // Т
-    { 19, 25, 23, 2, 22, 119, 5038 }, // У
-    { 22, 22, 25, 2, 22, 121, 5157 }, // Ф
-    { 24, 25, 33, 4, 25, 150, 5278 }, // Х
-    { 19, 28, 21, 1, 22, 133, 5428 }, // Ц
-    { 16, 22, 19, 2, 22, 88, 5561 }, // Ч
-    { 22, 23, 24, 1, 22, 127, 5649 }, // Ш
-    { 24, 28, 26, 1, 22, 168, 5776 }, // Щ
-    { 21, 22, 18, -5, 22, 116, 5944 }, // Ъ
-    { 29, 25, 34, 1, 25, 182, 6060 }, // Ы
-    { 15, 22, 18, 1, 22, 83, 6242 }, // Ь
-    { 22, 25, 24, 1, 23, 138, 6325 }, // Э
-    { 23, 22, 27, 2, 22, 127, 6463 }, // Ю
-    { 20, 25, 28, 4, 25, 125, 6590 }, // Я
-    { 17, 19, 25, 4, 18, 81, 6715 }, // а
-    { 18, 28, 20, 1, 26, 126, 6796 }, // б
-    { 15, 17, 21, 3, 17, 64, 6922 }, // в
-    { 15, 18, 17, 1, 17, 68, 6986 }, // г
-    { 20, 21, 22, 1, 17, 105, 7054 }, // д
-    { 17, 18, 25, 4, 17, 77, 7159 }, // е
-    { 34, 21, 41, 4, 21, 179, 7236 }, // ж
-    { 11, 16, 13, 1, 16, 44, 7415 }, // з
-    { 18, 18, 20, 1, 17, 81, 7459 }, // и
-    { 16, 28, 20, 1, 28, 112, 7540 }, // й
-    { 17, 16, 24, 3, 16, 68, 7652 }, // к
-    { 13, 17, 12, -1, 15, 56, 7720 }, // л
-    { 19, 18, 25, 3, 18, 86, 7776 }, // м
-    { 18, 18, 24, 3, 18, 81, 7862 }, // н
-    { 17, 19, 25, 4, 18, 81, 7943 }, // о
-    { 17, 18, 19, 1, 17, 77, 8024 }, // п
-    { 19, 26, 27, 4, 17, 124, 8101 }, // р
-    { 15, 18, 23, 4, 18, 68, 8225 }, // с
-    { 18, 18, 20, 1, 17, 81, 8293 }, // т
-    { 19, 25, 27, 4, 16, 119, 8374 }, // у
-    { 24, 24, 25, 1, 17, 144, 8493 }, // ф
-    { 21, 18, 21, 0, 17, 95, 8637 }, // х
-    { 19, 22, 21, 1, 17, 105, 8732 }, // ц
-    { 11, 15, 13, 1, 15, 42, 8837 }, // ч
-    { 22, 18, 24, 1, 17, 99, 8879 }, // ш
-    { 24, 23, 26, 1, 17, 138, 8978 }, // щ
-    { 17, 16, 14, -4, 16, 68, 9116 }, // ъ
-    { 21, 19, 25, 1, 19, 100, 9184 }, // ы
-    { 12, 17, 14, 1, 17, 51, 9284 }, // ь
-    { 15, 16, 19, 2, 16, 60, 9335 }, // э
-    { 19, 18, 22, 1, 18, 86, 9395 }, // ю
-    { 17, 20, 24, 3, 19, 85, 9481 }, // я
-    { 17, 32, 25, 4, 31, 136, 9566 }, // ѐ
-    { 17, 30, 25, 4, 29, 128, 9702 }, // ё
-    { 23, 29, 26, 0, 25, 167, 9830 }, // ђ
-    { 15, 26, 17, 1, 25, 98, 9997 }, // ѓ
-    { 15, 17, 17, 1, 16, 64, 10095 }, // є
-    { 17, 20, 25, 4, 18, 85, 10159 }, // ѕ
-    { 7, 27, 14, 3, 27, 48, 10244 }, // і
-    { 14, 25, 14, 0, 25, 88, 10292 }, // ї
-    { 11, 34, 18, 4, 26, 94, 10380 }, // ј
-    { 20, 17, 23, 2, 15, 85, 10474 }, // љ
-    { 19, 17, 12, -4, 16, 81, 10559 }, // њ
-    { 22, 25, 26, 0, 25, 138, 10640 }, // ћ
-    { 17, 25, 24, 3, 25, 107, 10778 }, // ќ
-    { 18, 28, 20, 1, 27, 126, 10885 }, // ѝ
-    { 19, 39, 27, 4, 30, 186, 11011 }, // ў
-    { 14, 22, 17, 2, 16, 77, 11197 }, // џ
-    { 20, 24, 22, 0, 22, 120, 11274 }, // Ѣ
-    { 20, 24, 19, -1, 22, 120, 11394 }, // ѣ
-    { 27, 23, 25, -1, 22, 156, 11514 }, // Ѫ
-    { 19, 17, 18, -1, 16, 81, 11670 }, // ѫ
-    { 23, 32, 32, 5, 31, 184, 11751 }, // Ѳ
-    { 18, 26, 25, 4, 25, 117, 11935 }, // ѳ
-    { 28, 31, 33, 4, 31, 217, 12052 }, // Ѵ
-    { 20, 21, 25, 3, 21, 105, 12269 }, // ѵ
-    { 12, 11, 0, 3, 28, 33, 12374 }, // ҆
-    { 17, 26, 19, 1, 25, 111, 12407 }, // Ґ
-    { 15, 22, 17, 1, 21, 83, 12518 }, // ґ
-    { 20, 24, 19, -2, 22, 120, 12601 }, // Ғ
-    { 14, 16, 13, -1, 15, 56, 12721 }, // ғ
-    { 19, 27, 18, -1, 25, 129, 12777 }, // Ҕ
-    { 11, 17, 11, 0, 15, 47, 12906 }, // ҕ
-    { 38, 30, 43, 3, 25, 285, 12953 }, // Җ
-    { 26, 21, 29, 2, 17, 137, 13238 }, // җ
-    { 15, 26, 19, 2, 21, 98, 13375 }, // Ҙ
-    { 11, 23, 13, 1, 16, 64, 13473 }, // ҙ
-    { 23, 30, 21, 3, 25, 173, 13537 }, // Қ
-    { 16, 20, 15, 2, 17, 80, 13710 }, // қ
-    { 28, 24, 32, 2, 22, 168, 13790 }, // Ҝ
-    { 20, 17, 22, 1, 16, 85, 13958 }, // ҝ
-    { 22, 25, 31, 4, 25, 138, 14043 }, // Ҟ
-    { 21, 25, 26, 1, 25, 132, 14181 }, // ҟ
-    { 26, 25, 31, 0, 25, 163, 14313 }, // Ҡ
-    { 18, 17, 21, 0, 17, 77, 14476 }, // ҡ
-    { 24, 29, 22, 0, 25, 174, 14553 }, // Ң
-    { 16, 20, 16, 0, 17, 80, 14727 }, // ң
-    { 32, 25, 31, 4, 25, 200, 14807 }, // Ҥ
-    { 22, 17, 21, 3, 17, 94, 15007 }, // ҥ
-    { 31, 27, 37, 3, 25, 210, 15101 }, // Ҧ
-    { 28, 29, 37, 4, 20, 203, 15311 }, // ҧ
-    { 28, 25, 20, -4, 22, 175, 15514 }, // Ҩ
-    { 22, 20, 16, -3, 18, 110, 15689 }, // ҩ
-    { 22, 31, 29, 3, 27, 171, 15799 }, // Ҫ
-    { 15, 21, 23, 4, 18, 79, 15970 }, // ҫ
-    { 22, 29, 23, 1, 25, 160, 16049 }, // Ҭ
-    { 16, 20, 16, 0, 17, 80, 16209 }, // ҭ
-    { 23, 25, 31, 4, 25, 144, 16289 }, // Ү
-    { 18, 23, 22, 2, 16, 104, 16433 }, // ү
-    { 23, 25, 31, 4, 25, 144, 16537 }, // Ұ
-    { 19, 23, 22, 1, 16, 110, 16681 }, // ұ
-    { 24, 30, 23, 4, 25, 180, 16791 }, // Ҳ
-    { 17, 20, 16, 2, 17, 85, 16971 }, // ҳ
-    { 27, 28, 18, -5, 21, 189, 17056 }, // Ҵ
-    { 19, 20, 13, -3, 15, 95, 17245 }, // ҵ
-    { 20, 29, 20, 0, 22, 145, 17340 }, // Ҷ
-    { 14, 21, 14, 0, 16, 74, 17485 }, // ҷ
-    { 16, 22, 19, 2, 22, 88, 17559 }, // Ҹ
-    { 11, 15, 13, 1, 15, 42, 17647 }, // ҹ
-    { 18, 25, 20, 1, 24, 113, 17689 }, // Һ
-    { 18, 25, 26, 4, 25, 113, 17802 }, // һ
-    { 33, 23, 28, -6, 22, 190, 17915 }, // Ҽ
-    { 23, 16, 20, -4, 15, 92, 18105 }, // ҽ
-    { 32, 28, 26, -4, 22, 224, 18197 }, // Ҿ
-    { 23, 19, 19, -3, 15, 110, 18421 }, // ҿ
-    { 8, 25, 16, 4, 25, 50, 18531 }, // Ӏ
-    { 36, 39, 32, -1, 39, 351, 18581 }, // Ӂ
-    { 34, 34, 41, 4, 34, 289, 18932 }, // ӂ
-    { 19, 31, 21, 1, 23, 148, 19221 }, // Ӄ
-    { 13, 21, 15, 1, 15, 69, 19369 }, // ӄ
-    { 21, 29, 18, -1, 22, 153, 19438 }, // Ӆ
-    { 15, 20, 12, -1, 15, 75, 19591 }, // ӆ
-    { 24, 33, 31, 4, 25, 198, 19666 }, // Ӈ
-    { 16, 22, 21, 3, 17, 88, 19864 }, // ӈ
-    { 24, 35, 31, 4, 25, 210, 19952 }, // Ӊ
-    { 17, 24, 21, 3, 17, 102, 20162 }, // ӊ
-    { 18, 28, 20, 1, 22, 126, 20264 }, // Ӌ
-    { 12, 20, 18, 3, 15, 60, 20390 }, // ӌ
-    { 28, 35, 34, 4, 25, 245, 20450 }, // Ӎ
-    { 19, 24, 23, 3, 17, 114, 20695 }, // ӎ
-    { 6, 22, 18, 6, 21, 33, 20809 }, // ӏ
-    { 25, 35, 28, 2, 35, 219, 20842 }, // Ӑ
-    { 17, 27, 25, 4, 26, 115, 21061 }, // ӑ
-    { 25, 34, 28, 2, 34, 213, 21176 }, // Ӓ
-    { 17, 28, 25, 4, 27, 119, 21389 }, // ӓ
-    { 36, 26, 40, 2, 25, 234, 21508 }, // Ӕ
-    { 29, 19, 37, 4, 18, 138, 21742 }, // ӕ
-    { 18, 35, 26, 4, 35, 158, 21880 }, // Ӗ
-    { 17, 31, 25, 4, 30, 132, 22038 }, // ӗ
-    { 22, 24, 31, 5, 22, 132, 22170 }, // Ә
-    { 17, 19, 25, 5, 18, 81, 22302 }, // ә
-    { 22, 34, 31, 5, 32, 187, 22383 }, // Ӛ
-    { 17, 24, 25, 5, 18, 102, 22570 }, // ӛ
-    { 37, 38, 41, 2, 38, 352, 22672 }, // Ӝ
-    { 34, 33, 41, 4, 33, 281, 23024 }, // ӝ
-    { 15, 35, 19, 2, 34, 132, 23305 }, // Ӟ
-    { 14, 23, 13, -1, 23, 81, 23437 }, // ӟ
-    { 16, 24, 20, 2, 22, 96, 23518 }, // Ӡ
-    { 16, 23, 20, 2, 16, 92, 23614 }, // ӡ
-    { 22, 38, 30, 4, 38, 209, 23706 }, // Ӣ
-    { 18, 28, 20, 1, 27, 126, 23915 }, // ӣ
-    { 22, 36, 30, 4, 36, 198, 24041 }, // Ӥ
-    { 18, 27, 20, 1, 26, 122, 24239 }, // ӥ
-    { 25, 37, 33, 4, 35, 232, 24361 }, // Ӧ
-    { 18, 31, 25, 3, 30, 140, 24593 }, // ӧ
-    { 22, 24, 33, 5, 23, 132, 24733 }, // Ө
-    { 17, 19, 25, 4, 18, 81, 24865 }, // ө
-    { 22, 33, 33, 5, 32, 182, 24946 }, // Ӫ
-    { 17, 28, 25, 4, 27, 119, 25128 }, // ӫ
-    { 22, 37, 24, 1, 35, 204, 25247 }, // Ӭ
-    { 16, 24, 19, 1, 24, 96, 25451 }, // ӭ
-    { 19, 37, 23, 2, 34, 176, 25547 }, // Ӯ
-    { 19, 39, 27, 4, 30, 186, 25723 }, // ӯ
-    { 19, 37, 23, 2, 34, 176, 25909 }, // Ӱ
-    { 19, 38, 27, 4, 29, 181, 26085 }, // ӱ
-    { 26, 37, 23, 1, 34, 241, 26266 }, // Ӳ
-    { 26, 38, 27, 3, 29, 247, 26507 }, // ӳ
-    { 16, 29, 19, 2, 29, 116, 26754 }, // Ӵ
-    { 13, 22, 13, 0, 22, 72, 26870 }, // ӵ
-    { 17, 27, 19, 1, 22, 115, 26942 }, // Ӷ
-    { 12, 19, 13, 1, 15, 57, 27057 }, // ӷ
-    { 29, 38, 34, 1, 38, 276, 27114 }, // Ӹ
-    { 21, 30, 25, 1, 30, 158, 27390 }, // ӹ
-    { 27, 28, 33, 4, 25, 189, 27548 }, // Ӽ
-    { 19, 19, 23, 3, 17, 91, 27737 }, // ӽ
-    { 0, 0, 19, 0, 0, 0, 0 }, //  
-    { 0, 0, 34, 0, 0, 0, 0 }, //  
-    { 0, 0, 19, 0, 0, 0, 0 }, //  
-    { 0, 0, 34, 0, 0, 0, 0 }, //  
-    { 0, 0, 14, 0, 0, 0, 0 }, //  
-    { 0, 0, 12, 0, 0, 0, 0 }, //  
-    { 0, 0, 10, 0, 0, 0, 0 }, //  
-    { 0, 0, 21, 0, 0, 0, 0 }, //  
-    { 0, 0, 8, 0, 0, 0, 0 }, //  
-    { 0, 0, 11, 0, 0, 0, 0 }, //  
-    { 0, 0, 9, 0, 0, 0, 0 }, //  
-    { 0, 0, 5, 0, 0, 0, 0 }, // ​
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‍
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‎
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‏
-    { 16, 4, 16, 0, 11, 16, 0 }, // ‐
-    { 16, 4, 16, 0, 11, 16, 16 }, // ‑
-    { 24, 4, 16, -4, 11, 24, 32 }, // ‒
-    { 21, 6, 23, 1, 11, 32, 56 }, // –
-    { 31, 6, 33, 1, 11, 47, 88 }, // —
-    { 31, 6, 33, 1, 11, 47, 135 }, // ―
-    { 14, 27, 16, 3, 22, 95, 182 }, // ‖
-    { 24, 10, 16, -4, -2, 60, 277 }, // ‗
-    { 10, 10, 13, 1, 26, 25, 337 }, // ‘
-    { 10, 10, 13, 1, 26, 25, 362 }, // ’
-    { 10, 10, 9, 0, 5, 25, 387 }, // ‚
-    { 10, 10, 13, 1, 26, 25, 412 }, // ‛
-    { 20, 10, 22, 1, 26, 50, 437 }, // “
-    { 20, 10, 22, 1, 26, 50, 487 }, // ”
-    { 10, 10, 9, 0, 5, 25, 537 }, // „
-    { 20, 10, 22, 1, 26, 50, 562 }, // ‟
-    { 18, 41, 24, 3, 31, 185, 612 }, // †
-    { 17, 41, 25, 5, 30, 175, 797 }, // ‡
-    { 23, 23, 15, -4, 26, 133, 972 }, // •
-    { 10, 10, 18, 4, 13, 25, 1105 }, // ‣
-    { 7, 7, 18, 5, 7, 13, 1130 }, // ․
-    { 7, 7, 18, 5, 7, 13, 1143 }, // ‥
-    { 27, 7, 28, 0, 7, 48, 1156 }, // …
-    { 4, 4, 16, 6, 11, 4, 1204 }, // ‧
-    { 0, 0, 32, 0, 0, 0, 1208 }, //  
-    { 21, 26, 33, 6, 23, 137, 1208 }, // ‰
-    { 10, 10, 16, 5, 26, 25, 1345 }, // ′
-    { 19, 10, 23, 5, 26, 48, 1370 }, // ″
-    { 23, 9, 12, 2, 25, 52, 1418 }, // ‴
-    { 8, 9, 12, 2, 24, 18, 1470 }, // ‵
-    { 14, 9, 12, 0, 24, 32, 1488 }, // ‶
-    { 24, 9, 12, -6, 25, 54, 1520 }, // ‷
-    { 17, 7, 19, 1, 25, 30, 1574 }, // ‸
-    { 10, 16, 12, 1, 16, 40, 1604 }, // ‹
-    { 10, 16, 12, 1, 16, 40, 1644 }, // ›
-    { 32, 38, 40, 5, 30, 304, 1684 }, // ※
-    { 9, 37, 18, 4, 32, 84, 1988 }, // ‼
-    { 18, 46, 25, 3, 39, 207, 2072 }, // ‽
-    { 16, 4, 16, 0, 24, 16, 2279 }, // ‾
-    { 14, 7, 16, 1, 20, 25, 2295 }, // ‿
-    { 21, 22, 19, -1, 28, 116, 2320 }, // ⁂
-    { 20, 25, 36, 8, 23, 125, 2436 }, // ⁄
-    { 36, 37, 44, 4, 33, 333, 2561 }, // ⁇
-    { 31, 38, 35, 2, 33, 295, 2894 }, // ⁈
-    { 24, 38, 23, -1, 33, 228, 3189 }, // ⁉
-    { 22, 51, 27, 2, 35, 281, 3417 }, // ⁒
-    { 0, 0, 136, 0, 0, 0, 3698 }, //  
-    { 8, 12, 10, 1, 24, 24, 0 }, // ⁰
-    { 9, 11, 10, 1, 25, 25, 24 }, // ⁴
-    { 8, 12, 10, 1, 25, 24, 49 }, // ⁵
-    { 9, 11, 10, 1, 24, 25, 73 }, // ⁶
-    { 9, 13, 11, 1, 25, 30, 98 }, // ⁷
-    { 9, 11, 11, 1, 24, 25, 128 }, // ⁸
-    { 9, 12, 11, 1, 24, 27, 153 }, // ⁹
-    { 17, 18, 25, 4, 18, 77, 180 }, // ⁿ
-    { 9, 12, 10, 1, 7, 27, 257 }, // ₀
-    { 8, 12, 10, 1, 7, 24, 284 }, // ₁
-    { 9, 12, 11, 1, 7, 27, 308 }, // ₂
-    { 9, 12, 10, 1, 7, 27, 335 }, // ₃
-    { 9, 12, 11, 1, 7, 27, 362 }, // ₄
-    { 8, 12, 10, 1, 7, 24, 389 }, // ₅
-    { 9, 12, 11, 1, 7, 27, 413 }, // ₆
-    { 9, 12, 11, 1, 7, 27, 440 }, // ₇
-    { 9, 12, 11, 1, 7, 27, 467 }, // ₈
-    { 9, 13, 11, 1, 7, 30, 494 }, // ₉
-    { 13, 40, 14, 1, 30, 130, 524 }, // ₍
-    { 13, 40, 13, -2, 30, 130, 654 }, // ₎
-    { 21, 39, 29, 4, 33, 205, 0 }, // ₡
-    { 22, 27, 29, 3, 27, 149, 205 }, // ₢
-    { 20, 27, 20, 0, 26, 135, 354 }, // ₤
-    { 32, 25, 30, -1, 25, 200, 489 }, // ₦
-    { 25, 25, 27, 1, 25, 157, 689 }, // ₧
-    { 32, 27, 38, 3, 25, 216, 846 }, // ₨
-    { 25, 26, 25, 0, 26, 163, 1062 }, // ₩
-    { 23, 23, 31, 4, 23, 133, 1225 }, // ₪
-    { 22, 25, 15, -2, 24, 138, 1358 }, // ₫
-    { 20, 28, 22, 1, 24, 140, 1496 }, // €
-    { 23, 25, 31, 4, 25, 144, 1636 }, // ₮
-    { 29, 25, 19, -1, 25, 182, 1780 }, // ₱
-    { 26, 39, 34, 4, 33, 254, 1962 }, // ₲
-    { 30, 24, 31, 5, 22, 180, 2216 }, // ₴
-    { 15, 24, 17, 4, 21, 90, 2396 }, // ₵
-    { 24, 26, 31, 3, 26, 156, 2486 }, // ₸
-    { 16, 24, 20, 2, 23, 96, 2642 }, // ₹
-    { 18, 22, 20, 1, 20, 99, 2738 }, // ₺
-    { 21, 24, 24, 1, 23, 126, 2837 }, // ₼
-    { 26, 25, 27, -3, 25, 163, 2963 }, // ₽
-    { 20, 20, 21, 0, 18, 100, 0 }, // ←
-    { 21, 20, 22, 1, 19, 105, 100 }, // ↑
-    { 20, 20, 22, 1, 18, 100, 205 }, // →
-    { 21, 20, 22, 1, 19, 105, 305 }, // ↓
-    { 24, 17, 30, 3, 16, 102, 410 }, // ↔
-    { 17, 24, 23, 3, 26, 102, 512 }, // ↕
-    { 17, 16, 23, 3, 15, 68, 614 }, // ↖
-    { 17, 16, 19, 1, 15, 68, 682 }, // ↗
-    { 17, 16, 19, 1, 16, 68, 750 }, // ↘
-    { 17, 16, 19, 1, 16, 68, 818 }, // ↙
-    { 23, 20, 29, 3, 19, 115, 886 }, // ⇐
-    { 25, 24, 31, 3, 23, 150, 1001 }, // ⇑
-    { 23, 20, 29, 3, 19, 115, 1151 }, // ⇒
-    { 25, 24, 31, 3, 22, 150, 1266 }, // ⇓
-    { 26, 20, 32, 3, 19, 130, 1416 }, // ⇔
-    { 20, 25, 26, 3, 14, 125, 1546 }, // ⇕
-    { 18, 26, 20, 1, 24, 117, 0 }, // ∂
-    { 30, 30, 33, 1, 27, 225, 117 }, // ∅
-    { 23, 23, 25, 1, 22, 133, 342 }, // ∆
-    { 19, 23, 22, 1, 21, 110, 475 }, // ∏
-    { 19, 23, 22, 1, 22, 110, 585 }, // ∐
-    { 15, 22, 17, 1, 21, 83, 695 }, // ∑
-    { 16, 5, 18, 1, 11, 20, 778 }, // −
-    { 24, 26, 28, 2, 24, 156, 798 }, // √
-    { 25, 17, 27, 1, 19, 107, 954 }, // ∞
-    { 23, 31, 25, 1, 23, 179, 1061 }, // ∫
-    { 8, 20, 9, 1, 20, 40, 1240 }, // ∶
-    { 18, 17, 42, 12, 17, 77, 1280 }, // ≈
-    { 22, 26, 36, 7, 23, 143, 1357 }, // ≠
-    { 25, 25, 23, -1, 21, 157, 1500 }, // ≤
-    { 24, 26, 25, 1, 22, 156, 1657 }, // ≥
+    { 16, 16, 16, 0, 15, 64, 10077 }, // «
+    { 16, 11, 18, 1, 11, 44, 762 }, // ¬
+    { 16, 4, 18, 1, 11, 16, 806 }, // ­
+    { 14, 13, 20, 3, 32, 46, 822 }, // ®
+    { 13, 5, 15, 1, 22, 17, 868 }, // ¯
+    { 14, 13, 20, 3, 22, 46, 885 }, // °
+    { 16, 18, 18, 1, 16, 72, 931 }, // ±
+    { 8, 11, 9, 1, 24, 22, 1003 }, // ²
+    { 8, 11, 10, 1, 24, 22, 1025 }, // ³
+    { 7, 7, 8, 1, 23, 13, 1047 }, // ´
+    { 18, 22, 25, 3, 17, 99, 1060 }, // µ
+    { 17, 25, 22, 2, 21, 107, 1159 }, // ¶
+    { 7, 7, 8, 0, 14, 13, 1266 }, // ·
+    { 8, 9, 10, 1, 1, 18, 1279 }, // ¸
+    { 7, 12, 9, 1, 25, 21, 1297 }, // ¹
+    { 10, 10, 19, 6, 21, 25, 1318 }, // º
+    { 16, 16, 22, 3, 15, 64, 10141 }, // »
+    { 27, 27, 36, 4, 25, 183, 1343 }, // ¼
+    { 30, 27, 36, 4, 25, 203, 1526 }, // ½
+    { 27, 26, 36, 4, 24, 176, 1729 }, // ¾
+    { 18, 37, 19, 1, 21, 167, 1905 }, // ¿
+    { 25, 33, 28, 2, 33, 207, 10205 }, // À
+    { 25, 38, 28, 2, 38, 238, 10412 }, // Á
+    { 25, 35, 28, 2, 35, 219, 10650 }, // Â
+    { 25, 34, 28, 2, 34, 213, 2072 }, // Ã
+    { 25, 35, 28, 2, 35, 219, 10869 }, // Ä
+    { 25, 35, 28, 2, 35, 219, 2285 }, // Å
+    { 36, 26, 40, 2, 25, 234, 2504 }, // Æ
+    { 22, 35, 29, 3, 27, 193, 11088 }, // Ç
+    { 19, 35, 27, 4, 35, 167, 11281 }, // È
+    { 19, 39, 27, 4, 39, 186, 11448 }, // É
+    { 19, 36, 27, 4, 36, 171, 11634 }, // Ê
+    { 19, 36, 27, 4, 36, 171, 11805 }, // Ë
+    { 13, 36, 16, 0, 36, 117, 11976 }, // Ì
+    { 8, 41, 16, 4, 41, 82, 12093 }, // Í
+    { 16, 38, 16, 0, 38, 152, 12175 }, // Î
+    { 15, 38, 16, 0, 38, 143, 12327 }, // Ï
+    { 27, 25, 31, -1, 25, 169, 2738 }, // Ð
+    { 22, 34, 30, 4, 34, 187, 12470 }, // Ñ
+    { 25, 36, 33, 4, 34, 225, 12657 }, // Ò
+    { 25, 41, 33, 4, 39, 257, 12882 }, // Ó
+    { 25, 38, 33, 4, 36, 238, 13139 }, // Ô
+    { 25, 37, 33, 4, 35, 232, 2907 }, // Õ
+    { 25, 38, 33, 4, 36, 238, 13377 }, // Ö
+    { 17, 10, 17, 0, 12, 43, 3139 }, // ×
+    { 41, 59, 33, -4, 43, 605, 3182 }, // Ø
+    { 22, 36, 30, 4, 35, 198, 13615 }, // Ù
+    { 22, 41, 30, 4, 40, 226, 13813 }, // Ú
+    { 22, 38, 30, 4, 37, 209, 14039 }, // Û
+    { 22, 38, 30, 4, 37, 209, 14248 }, // Ü
+    { 23, 42, 31, 4, 42, 242, 3787 }, // Ý
+    { 14, 24, 16, 1, 24, 84, 4029 }, // Þ
+    { 18, 26, 20, 1, 24, 117, 4113 }, // ß
+    { 17, 27, 25, 4, 26, 115, 14457 }, // à
+    { 17, 31, 25, 4, 30, 132, 14572 }, // á
+    { 17, 28, 25, 4, 27, 119, 14704 }, // â
+    { 17, 27, 25, 4, 26, 115, 4230 }, // ã
+    { 17, 28, 25, 4, 27, 119, 14823 }, // ä
+    { 17, 28, 25, 4, 27, 119, 4345 }, // å
+    { 29, 19, 37, 4, 18, 138, 4464 }, // æ
+    { 15, 25, 23, 4, 18, 94, 14942 }, // ç
+    { 17, 30, 25, 4, 29, 128, 15036 }, // è
+    { 17, 35, 25, 4, 34, 149, 15164 }, // é
+    { 17, 32, 25, 4, 31, 136, 15313 }, // ê
+    { 17, 32, 25, 4, 31, 136, 15449 }, // ë
+    { 12, 25, 14, 0, 25, 75, 15585 }, // ì
+    { 7, 30, 14, 4, 30, 53, 15660 }, // í
+    { 17, 27, 14, -1, 27, 115, 15713 }, // î
+    { 14, 25, 14, 0, 25, 88, 15828 }, // ï
+    { 23, 26, 20, -1, 24, 150, 4602 }, // ð
+    { 17, 27, 25, 4, 27, 115, 15916 }, // ñ
+    { 17, 27, 25, 4, 26, 115, 16031 }, // ò
+    { 17, 32, 25, 4, 31, 136, 16146 }, // ó
+    { 17, 29, 25, 4, 28, 124, 16282 }, // ô
+    { 17, 28, 25, 4, 27, 119, 4752 }, // õ
+    { 17, 29, 25, 4, 28, 124, 16406 }, // ö
+    { 22, 21, 26, 2, 20, 116, 4871 }, // ÷
+    { 19, 51, 25, 3, 35, 243, 4987 }, // ø
+    { 17, 27, 25, 4, 26, 115, 16530 }, // ù
+    { 17, 32, 25, 4, 31, 136, 16645 }, // ú
+    { 17, 29, 25, 4, 28, 124, 16781 }, // û
+    { 17, 29, 25, 4, 28, 124, 16905 }, // ü
+    { 19, 43, 27, 4, 34, 205, 5230 }, // ý
+    { 14, 31, 16, 1, 25, 109, 5435 }, // þ
+    { 19, 39, 27, 4, 30, 186, 5544 }, // ÿ
+    { 25, 35, 28, 2, 35, 219, 5730 }, // Ā
+    { 17, 29, 25, 4, 28, 124, 5949 }, // ā
+    { 25, 35, 28, 2, 35, 219, 6073 }, // Ă
+    { 17, 28, 25, 4, 27, 119, 6292 }, // ă
+    { 25, 33, 28, 2, 25, 207, 6411 }, // Ą
+    { 19, 27, 25, 4, 18, 129, 6618 }, // ą
+    { 22, 36, 29, 3, 36, 198, 6747 }, // Ć
+    { 15, 25, 23, 4, 25, 94, 6945 }, // ć
+    { 22, 38, 29, 3, 38, 209, 7039 }, // Ĉ
+    { 17, 27, 23, 3, 27, 115, 7248 }, // ĉ
+    { 22, 36, 29, 3, 36, 198, 7363 }, // Ċ
+    { 15, 26, 23, 4, 26, 98, 7561 }, // ċ
+    { 22, 38, 29, 3, 38, 209, 7659 }, // Č
+    { 16, 28, 23, 4, 28, 112, 7868 }, // č
+    { 22, 37, 31, 4, 37, 204, 7980 }, // Ď
+    { 23, 26, 26, 4, 25, 150, 8184 }, // ď
+    { 27, 25, 31, -1, 25, 169, 8334 }, // Đ
+    { 22, 26, 26, 4, 25, 143, 8503 }, // đ
+    { 19, 36, 27, 4, 36, 171, 8646 }, // Ē
+    { 17, 32, 25, 4, 31, 136, 8817 }, // ē
+    { 19, 36, 27, 4, 36, 171, 8953 }, // Ĕ
+    { 17, 32, 25, 4, 31, 136, 9124 }, // ĕ
+    { 19, 36, 27, 4, 36, 171, 9260 }, // Ė
+    { 17, 32, 25, 4, 31, 136, 9431 }, // ė
+    { 19, 32, 27, 4, 25, 152, 9567 }, // Ę
+    { 17, 29, 25, 4, 17, 124, 9719 }, // ę
+    { 19, 38, 27, 4, 38, 181, 9843 }, // Ě
+    { 17, 34, 25, 4, 33, 145, 10024 }, // ě
+    { 26, 40, 34, 4, 39, 260, 10169 }, // Ĝ
+    { 18, 39, 25, 4, 30, 176, 10429 }, // ĝ
+    { 26, 38, 34, 4, 37, 247, 10605 }, // Ğ
+    { 17, 37, 25, 4, 28, 158, 10852 }, // ğ
+    { 26, 39, 34, 4, 38, 254, 11010 }, // Ġ
+    { 17, 37, 25, 4, 28, 158, 11264 }, // ġ
+    { 26, 44, 34, 4, 43, 286, 11422 }, // Ģ
+    { 17, 39, 25, 4, 30, 166, 11708 }, // ģ
+    { 22, 37, 31, 4, 37, 204, 11874 }, // Ĥ
+    { 22, 35, 26, 0, 35, 193, 12078 }, // ĥ
+    { 25, 25, 31, 3, 25, 157, 12271 }, // Ħ
+    { 22, 25, 26, 0, 25, 138, 12428 }, // ħ
+    { 11, 38, 16, 2, 38, 105, 12566 }, // Ĩ
+    { 12, 27, 14, 1, 27, 81, 12671 }, // ĩ
+    { 16, 37, 16, -1, 37, 148, 12752 }, // Ī
+    { 17, 27, 14, -2, 27, 115, 12900 }, // ī
+    { 9, 32, 16, 3, 25, 72, 13015 }, // Į
+    { 8, 36, 14, 3, 27, 72, 13087 }, // į
+    { 8, 38, 16, 4, 38, 76, 13159 }, // İ
+    { 6, 17, 14, 4, 17, 26, 13235 }, // ı
+    { 23, 36, 46, 11, 25, 207, 13261 }, // Ĳ
+    { 18, 34, 14, 3, 27, 153, 13468 }, // ĳ
+    { 20, 43, 26, 4, 36, 215, 13621 }, // Ĵ
+    { 17, 37, 18, 3, 29, 158, 13836 }, // ĵ
+    { 22, 40, 31, 4, 40, 220, 13994 }, // Ķ
+    { 18, 40, 26, 4, 25, 180, 14214 }, // ķ
+    { 15, 16, 19, 2, 16, 60, 14394 }, // ĸ
+    { 18, 34, 26, 4, 34, 153, 14454 }, // Ĺ
+    { 9, 38, 17, 4, 38, 86, 14607 }, // ĺ
+    { 20, 39, 26, 2, 39, 195, 14693 }, // Ļ
+    { 11, 41, 17, 2, 25, 113, 14888 }, // ļ
+    { 18, 25, 26, 4, 25, 113, 15001 }, // Ľ
+    { 14, 30, 17, 4, 30, 105, 15114 }, // ľ
+    { 18, 25, 26, 4, 25, 113, 15219 }, // Ŀ
+    { 14, 25, 17, 4, 25, 88, 15332 }, // ŀ
+    { 32, 45, 26, -8, 35, 360, 15420 }, // Ł
+    { 22, 25, 17, -6, 25, 138, 15780 }, // ł
+    { 22, 35, 30, 4, 35, 193, 15918 }, // Ń
+    { 17, 29, 25, 4, 29, 124, 16111 }, // ń
+    { 22, 37, 30, 4, 25, 204, 16235 }, // Ņ
+    { 17, 30, 25, 4, 18, 128, 16439 }, // ņ
+    { 22, 38, 30, 4, 38, 209, 16567 }, // Ň
+    { 18, 31, 25, 4, 31, 140, 16776 }, // ň
+    { 17, 30, 25, 4, 30, 128, 16916 }, // ŉ
+    { 22, 32, 30, 4, 25, 176, 17044 }, // Ŋ
+    { 17, 24, 25, 4, 18, 102, 17220 }, // ŋ
+    { 25, 38, 33, 4, 36, 238, 17322 }, // Ō
+    { 17, 29, 25, 4, 28, 124, 17560 }, // ō
+    { 25, 38, 33, 4, 36, 238, 17684 }, // Ŏ
+    { 17, 29, 25, 4, 28, 124, 17922 }, // ŏ
+    { 27, 37, 33, 4, 35, 250, 18046 }, // Ő
+    { 25, 28, 25, 2, 27, 175, 18296 }, // ő
+    { 35, 28, 35, 4, 26, 245, 17029 }, // Œ
+    { 29, 19, 31, 4, 18, 138, 17274 }, // œ
+    { 20, 34, 28, 4, 34, 170, 18471 }, // Ŕ
+    { 13, 25, 21, 4, 25, 82, 18641 }, // ŕ
+    { 20, 40, 28, 4, 40, 200, 18723 }, // Ŗ
+    { 14, 30, 21, 3, 30, 105, 18923 }, // ŗ
+    { 20, 37, 28, 4, 37, 185, 19028 }, // Ř
+    { 17, 27, 21, 1, 27, 115, 19213 }, // ř
+    { 23, 36, 31, 4, 34, 207, 19328 }, // Ś
+    { 17, 27, 25, 4, 25, 115, 19535 }, // ś
+    { 23, 37, 31, 4, 35, 213, 19650 }, // Ŝ
+    { 17, 29, 25, 4, 27, 124, 19863 }, // ŝ
+    { 23, 33, 31, 4, 25, 190, 19987 }, // Ş
+    { 17, 26, 25, 4, 18, 111, 20177 }, // ş
+    { 23, 38, 31, 4, 36, 219, 20288 }, // Š
+    { 17, 30, 25, 4, 28, 128, 20507 }, // š
+    { 23, 33, 31, 4, 25, 190, 20635 }, // Ţ
+    { 15, 29, 23, 4, 22, 109, 20825 }, // ţ
+    { 23, 37, 31, 4, 37, 213, 20934 }, // Ť
+    { 19, 28, 23, 4, 27, 133, 21147 }, // ť
+    { 23, 25, 31, 4, 25, 144, 21280 }, // Ŧ
+    { 16, 23, 23, 3, 22, 92, 21424 }, // ŧ
+    { 22, 38, 30, 4, 37, 209, 21516 }, // Ũ
+    { 17, 29, 25, 4, 28, 124, 21725 }, // ũ
+    { 22, 38, 30, 4, 37, 209, 21849 }, // Ū
+    { 17, 28, 25, 4, 27, 119, 22058 }, // ū
+    { 22, 38, 30, 4, 37, 209, 22177 }, // Ŭ
+    { 17, 29, 25, 4, 28, 124, 22386 }, // ŭ
+    { 22, 40, 30, 4, 39, 220, 22510 }, // Ů
+    { 17, 31, 25, 4, 30, 132, 22730 }, // ů
+    { 26, 37, 30, 4, 36, 241, 22862 }, // Ű
+    { 25, 27, 25, 2, 26, 169, 23103 }, // ű
+    { 22, 32, 30, 4, 25, 176, 23272 }, // Ų
+    { 17, 26, 25, 4, 17, 111, 23448 }, // ų
+    { 33, 37, 42, 4, 37, 306, 23559 }, // Ŵ
+    { 24, 31, 32, 4, 30, 186, 23865 }, // ŵ
+    { 23, 39, 31, 4, 39, 225, 24051 }, // Ŷ
+    { 19, 40, 27, 4, 31, 190, 24276 }, // ŷ
+    { 23, 39, 31, 4, 39, 225, 24466 }, // Ÿ
+    { 23, 34, 32, 4, 34, 196, 24691 }, // Ź
+    { 18, 28, 26, 4, 28, 126, 24887 }, // ź
+    { 23, 34, 32, 4, 34, 196, 25013 }, // Ż
+    { 18, 28, 26, 4, 28, 126, 25209 }, // ż
+    { 23, 36, 32, 4, 36, 207, 25335 }, // Ž
+    { 18, 30, 26, 4, 30, 135, 25542 }, // ž
+    { 11, 24, 18, 3, 24, 66, 25677 }, // ſ
+    { 12, 6, 0, 0, 23, 18, 25743 }, // ̀
+    { 7, 7, 0, 1, 23, 13, 25761 }, // ́
+    { 16, 8, 0, 0, 1, 32, 25774 }, // ̂
+    { 12, 6, 0, 1, 22, 18, 25806 }, // ̃
+    { 16, 5, 0, 1, 21, 20, 25824 }, // ̄
+    { 21, 5, 0, 0, 27, 27, 25844 }, // ̅
+    { 14, 6, 0, 1, 21, 21, 25871 }, // ̆
+    { 7, 7, 0, 4, 24, 13, 25892 }, // ̇
+    { 14, 6, 0, 0, 21, 21, 25905 }, // ̈
+    { 6, 7, 0, 6, 19, 11, 25926 }, // ̉
+    { 8, 8, 0, 1, 23, 16, 25937 }, // ̊
+    { 25, 6, 0, 1, 23, 38, 25953 }, // ̋
+    { 16, 8, 0, 0, 23, 32, 25991 }, // ̌
+    { 25, 6, 0, -7, 23, 38, 26023 }, // ̏
+    { 10, 10, 0, 0, 23, 25, 26061 }, // ̒
+    { 10, 10, 0, 0, 22, 25, 26086 }, // ̓
+    { 10, 10, 0, -1, 22, 25, 26111 }, // ̔
+    { 7, 9, 0, 1, 0, 16, 26136 }, // ̘
+    { 7, 9, 0, 1, 0, 16, 26152 }, // ̙
+    { 14, 9, 0, 1, 24, 32, 26168 }, // ̚
+    { 7, 9, 0, 0, 20, 16, 26200 }, // ̛
+    { 5, 9, 0, 1, 0, 12, 26216 }, // ̜
+    { 8, 7, 0, 1, 4, 14, 26228 }, // ̝
+    { 8, 6, 0, 1, 0, 12, 26242 }, // ̞
+    { 7, 7, 0, 2, -2, 13, 26254 }, // ̟
+    { 16, 5, 0, 1, -3, 20, 26267 }, // ̠
+    { 8, 7, 0, 0, 3, 14, 26287 }, // ̣
+    { 14, 6, 0, 0, -2, 21, 26301 }, // ̤
+    { 8, 8, 0, 1, 23, 16, 26322 }, // ̥
+    { 10, 10, 0, 0, 5, 25, 26338 }, // ̦
+    { 8, 9, 0, 1, 1, 18, 26363 }, // ̧
+    { 9, 10, 0, 1, 1, 23, 26381 }, // ̨
+    { 6, 10, 0, 1, -1, 15, 26404 }, // ̩
+    { 13, 7, 0, 0, 0, 23, 26419 }, // ̪
+    { 18, 9, 0, -1, 1, 41, 26442 }, // ̬
+    { 18, 9, 0, -1, 1, 41, 26483 }, // ̭
+    { 13, 8, 0, 1, 25, 26, 26524 }, // ̰
+    { 15, 5, 0, 1, 24, 19, 26550 }, // ̱
+    { 16, 5, 0, 0, -1, 20, 26569 }, // ̲
+    { 13, 8, 0, 1, 25, 26, 26589 }, // ̴
+    { 16, 4, 0, 0, 11, 16, 26615 }, // ̵
+    { 5, 10, 0, 1, 0, 13, 26631 }, // ̹
+    { 13, 9, 0, 0, 1, 30, 26644 }, // ̺
+    { 12, 10, 0, 0, 1, 30, 26674 }, // ̻
+    { 11, 8, 0, 1, 1, 22, 26704 }, // ̼
+    { 9, 7, 0, 2, 22, 16, 26726 }, // ̽
+    { 12, 6, 0, 1, 22, 18, 26742 }, // ͂
+    { 6, 8, 0, 7, 26, 12, 26760 }, // ̓
+    { 14, 22, 0, 1, 37, 77, 26772 }, // ̈́
+    { 13, 7, 0, 0, 24, 23, 26849 }, // ͆
+    { 16, 11, 0, 1, 0, 44, 26872 }, // ͇
+    { 13, 9, 0, 1, 1, 30, 26916 }, // ͈
+    { 11, 9, 0, 1, -1, 25, 26946 }, // ͉
+    { 15, 23, 0, 1, 31, 87, 26971 }, // ͊
+    { 26, 22, 0, 1, 33, 143, 27058 }, // ͋
+    { 18, 17, 0, 12, 17, 77, 27201 }, // ͌
+    { 15, 7, 0, 2, -3, 27, 27278 }, // ͍
+    { 5, 5, 0, 1, 4, 7, 27305 }, // ͎
+    { 25, 8, 0, 1, 2, 50, 27312 }, // ͜
+    { 25, 8, 0, 1, 24, 50, 27362 }, // ͡
+    { 31, 9, 0, 1, -1, 70, 27412 }, // ͢
+    { 18, 36, 26, 4, 36, 162, 27482 }, // Ѐ
+    { 19, 36, 27, 4, 36, 171, 0 }, // Ё
+    { 25, 27, 20, -4, 25, 169, 27644 }, // Ђ
+    { 17, 34, 19, 1, 33, 145, 0 }, // Ѓ
+    { 22, 25, 24, 1, 23, 138, 145 }, // Є
+    { 23, 27, 31, 4, 25, 156, 283 }, // Ѕ
+    { 8, 25, 16, 4, 25, 50, 439 }, // І
+    { 13, 36, 16, 1, 36, 117, 489 }, // Ї
+    { 18, 32, 26, 4, 25, 144, 606 }, // Ј
+    { 29, 24, 34, 2, 22, 174, 750 }, // Љ
+    { 27, 24, 18, -5, 23, 162, 924 }, // Њ
+    { 27, 27, 31, 4, 27, 183, 1086 }, // Ћ
+    { 22, 34, 31, 4, 34, 187, 1269 }, // Ќ
+    { 22, 38, 30, 4, 38, 209, 1456 }, // Ѝ
+    { 19, 37, 23, 2, 34, 176, 1665 }, // Ў
+    { 19, 28, 23, 2, 21, 133, 1841 }, // Џ
+    { 25, 25, 28, 2, 25, 157, 171 }, // А
+    { 15, 21, 19, 2, 21, 79, 328 }, // Б
+    { 16, 23, 20, 2, 22, 92, 407 }, // В
+    { 17, 23, 19, 1, 22, 98, 499 }, // Г
+    { 23, 26, 24, 1, 22, 150, 597 }, // Д
+    { 18, 25, 26, 4, 25, 113, 747 }, // Е
+    { 36, 25, 32, -1, 25, 225, 860 }, // Ж
+    { 15, 22, 19, 2, 21, 83, 1085 }, // З
+    { 22, 25, 30, 4, 25, 138, 1168 }, // И
+    { 22, 38, 30, 4, 38, 209, 1306 }, // Й
+    { 22, 25, 31, 4, 25, 138, 1515 }, // К
+    { 19, 24, 18, -1, 22, 114, 1653 }, // Л
+    { 23, 23, 25, 1, 22, 133, 1767 }, // М
+    { 22, 25, 31, 4, 25, 138, 1900 }, // Н
+    { 25, 28, 33, 4, 26, 175, 2038 }, // О
+    { 18, 24, 20, 1, 23, 108, 2213 }, // П
+    { 19, 25, 27, 4, 25, 119, 2321 }, // Р
+    { 22, 27, 29, 3, 27, 149, 2440 }, // С
+    { 23, 25, 31, 4, 25, 144, 2589 }, // Т
+    { 19, 25, 23, 2, 22, 119, 2733 }, // У
+    { 22, 22, 25, 2, 22, 121, 2852 }, // Ф
+    { 24, 25, 33, 4, 25, 150, 2973 }, // Х
+    { 19, 28, 21, 1, 22, 133, 3123 }, // Ц
+    { 16, 22, 19, 2, 22, 88, 3256 }, // Ч
+    { 22, 23, 24, 1, 22, 127, 3344 }, // Ш
+    { 24, 28, 26, 1, 22, 168, 3471 }, // Щ
+    { 21, 22, 18, -5, 22, 116, 3639 }, // Ъ
+    { 29, 25, 34, 1, 25, 182, 3755 }, // Ы
+    { 15, 22, 18, 1, 22, 83, 3937 }, // Ь
+    { 22, 25, 24, 1, 23, 138, 4020 }, // Э
+    { 23, 22, 27, 2, 22, 127, 4158 }, // Ю
+    { 20, 25, 28, 4, 25, 125, 4285 }, // Я
+    { 17, 19, 25, 4, 18, 81, 4410 }, // а
+    { 18, 28, 20, 1, 26, 126, 4491 }, // б
+    { 15, 17, 21, 3, 17, 64, 4617 }, // в
+    { 15, 18, 17, 1, 17, 68, 4681 }, // г
+    { 20, 21, 22, 1, 17, 105, 4749 }, // д
+    { 17, 18, 25, 4, 17, 77, 4854 }, // е
+    { 34, 21, 41, 4, 21, 179, 4931 }, // ж
+    { 11, 16, 13, 1, 16, 44, 5110 }, // з
+    { 18, 18, 20, 1, 17, 81, 5154 }, // и
+    { 16, 28, 20, 1, 28, 112, 5235 }, // й
+    { 17, 16, 24, 3, 16, 68, 5347 }, // к
+    { 13, 17, 12, -1, 15, 56, 5415 }, // л
+    { 19, 18, 25, 3, 18, 86, 5471 }, // м
+    { 18, 18, 24, 3, 18, 81, 5557 }, // н
+    { 17, 19, 25, 4, 18, 81, 5638 }, // о
+    { 17, 18, 19, 1, 17, 77, 5719 }, // п
+    { 19, 26, 27, 4, 17, 124, 5796 }, // р
+    { 15, 18, 23, 4, 18, 68, 5920 }, // с
+    { 18, 18, 20, 1, 17, 81, 5988 }, // т
+    { 19, 25, 27, 4, 16, 119, 6069 }, // у
+    { 24, 24, 25, 1, 17, 144, 6188 }, // ф
+    { 21, 18, 21, 0, 17, 95, 6332 }, // х
+    { 19, 22, 21, 1, 17, 105, 6427 }, // ц
+    { 11, 15, 13, 1, 15, 42, 6532 }, // ч
+    { 22, 18, 24, 1, 17, 99, 6574 }, // ш
+    { 24, 23, 26, 1, 17, 138, 6673 }, // щ
+    { 17, 16, 14, -4, 16, 68, 6811 }, // ъ
+    { 21, 19, 25, 1, 19, 100, 6879 }, // ы
+    { 12, 17, 14, 1, 17, 51, 6979 }, // ь
+    { 15, 16, 19, 2, 16, 60, 7030 }, // э
+    { 19, 18, 22, 1, 18, 86, 7090 }, // ю
+    { 17, 20, 24, 3, 19, 85, 7176 }, // я
+    { 17, 32, 25, 4, 31, 136, 1974 }, // ѐ
+    { 17, 30, 25, 4, 29, 128, 7261 }, // ё
+    { 23, 29, 26, 0, 25, 167, 2110 }, // ђ
+    { 15, 26, 17, 1, 25, 98, 2277 }, // ѓ
+    { 15, 17, 17, 1, 16, 64, 2375 }, // є
+    { 17, 20, 25, 4, 18, 85, 2439 }, // ѕ
+    { 7, 27, 14, 3, 27, 48, 2524 }, // і
+    { 14, 25, 14, 0, 25, 88, 2572 }, // ї
+    { 11, 34, 18, 4, 26, 94, 2660 }, // ј
+    { 20, 17, 23, 2, 15, 85, 2754 }, // љ
+    { 19, 17, 12, -4, 16, 81, 2839 }, // њ
+    { 22, 25, 26, 0, 25, 138, 2920 }, // ћ
+    { 17, 25, 24, 3, 25, 107, 3058 }, // ќ
+    { 18, 28, 20, 1, 27, 126, 3165 }, // ѝ
+    { 19, 39, 27, 4, 30, 186, 3291 }, // ў
+    { 14, 22, 17, 2, 16, 77, 3477 }, // џ
+    { 20, 24, 22, 0, 22, 120, 3554 }, // Ѣ
+    { 20, 24, 19, -1, 22, 120, 3674 }, // ѣ
+    { 27, 23, 25, -1, 22, 156, 3794 }, // Ѫ
+    { 19, 17, 18, -1, 16, 81, 3950 }, // ѫ
+    { 23, 32, 32, 5, 31, 184, 4031 }, // Ѳ
+    { 18, 26, 25, 4, 25, 117, 4215 }, // ѳ
+    { 28, 31, 33, 4, 31, 217, 4332 }, // Ѵ
+    { 20, 21, 25, 3, 21, 105, 4549 }, // ѵ
+    { 12, 11, 0, 3, 28, 33, 4654 }, // ҆
+    { 17, 26, 19, 1, 25, 111, 4687 }, // Ґ
+    { 15, 22, 17, 1, 21, 83, 4798 }, // ґ
+    { 20, 24, 19, -2, 22, 120, 4881 }, // Ғ
+    { 14, 16, 13, -1, 15, 56, 5001 }, // ғ
+    { 19, 27, 18, -1, 25, 129, 5057 }, // Ҕ
+    { 11, 17, 11, 0, 15, 47, 5186 }, // ҕ
+    { 38, 30, 43, 3, 25, 285, 5233 }, // Җ
+    { 26, 21, 29, 2, 17, 137, 5518 }, // җ
+    { 15, 26, 19, 2, 21, 98, 5655 }, // Ҙ
+    { 11, 23, 13, 1, 16, 64, 5753 }, // ҙ
+    { 23, 30, 21, 3, 25, 173, 5817 }, // Қ
+    { 16, 20, 15, 2, 17, 80, 5990 }, // қ
+    { 28, 24, 32, 2, 22, 168, 6070 }, // Ҝ
+    { 20, 17, 22, 1, 16, 85, 6238 }, // ҝ
+    { 22, 25, 31, 4, 25, 138, 6323 }, // Ҟ
+    { 21, 25, 26, 1, 25, 132, 6461 }, // ҟ
+    { 26, 25, 31, 0, 25, 163, 6593 }, // Ҡ
+    { 18, 17, 21, 0, 17, 77, 6756 }, // ҡ
+    { 24, 29, 22, 0, 25, 174, 6833 }, // Ң
+    { 16, 20, 16, 0, 17, 80, 7007 }, // ң
+    { 32, 25, 31, 4, 25, 200, 7087 }, // Ҥ
+    { 22, 17, 21, 3, 17, 94, 7287 }, // ҥ
+    { 31, 27, 37, 3, 25, 210, 7381 }, // Ҧ
+    { 28, 29, 37, 4, 20, 203, 7591 }, // ҧ
+    { 28, 25, 20, -4, 22, 175, 7794 }, // Ҩ
+    { 22, 20, 16, -3, 18, 110, 7969 }, // ҩ
+    { 22, 31, 29, 3, 27, 171, 8079 }, // Ҫ
+    { 15, 21, 23, 4, 18, 79, 8250 }, // ҫ
+    { 22, 29, 23, 1, 25, 160, 8329 }, // Ҭ
+    { 16, 20, 16, 0, 17, 80, 8489 }, // ҭ
+    { 23, 25, 31, 4, 25, 144, 8569 }, // Ү
+    { 18, 23, 22, 2, 16, 104, 8713 }, // ү
+    { 23, 25, 31, 4, 25, 144, 8817 }, // Ұ
+    { 19, 23, 22, 1, 16, 110, 8961 }, // ұ
+    { 24, 30, 23, 4, 25, 180, 9071 }, // Ҳ
+    { 17, 20, 16, 2, 17, 85, 9251 }, // ҳ
+    { 27, 28, 18, -5, 21, 189, 9336 }, // Ҵ
+    { 19, 20, 13, -3, 15, 95, 9525 }, // ҵ
+    { 20, 29, 20, 0, 22, 145, 9620 }, // Ҷ
+    { 14, 21, 14, 0, 16, 74, 9765 }, // ҷ
+    { 16, 22, 19, 2, 22, 88, 9839 }, // Ҹ
+    { 11, 15, 13, 1, 15, 42, 9927 }, // ҹ
+    { 18, 25, 20, 1, 24, 113, 9969 }, // Һ
+    { 18, 25, 26, 4, 25, 113, 10082 }, // һ
+    { 33, 23, 28, -6, 22, 190, 10195 }, // Ҽ
+    { 23, 16, 20, -4, 15, 92, 10385 }, // ҽ
+    { 32, 28, 26, -4, 22, 224, 10477 }, // Ҿ
+    { 23, 19, 19, -3, 15, 110, 10701 }, // ҿ
+    { 8, 25, 16, 4, 25, 50, 10811 }, // Ӏ
+    { 36, 39, 32, -1, 39, 351, 10861 }, // Ӂ
+    { 34, 34, 41, 4, 34, 289, 11212 }, // ӂ
+    { 19, 31, 21, 1, 23, 148, 11501 }, // Ӄ
+    { 13, 21, 15, 1, 15, 69, 11649 }, // ӄ
+    { 21, 29, 18, -1, 22, 153, 11718 }, // Ӆ
+    { 15, 20, 12, -1, 15, 75, 11871 }, // ӆ
+    { 24, 33, 31, 4, 25, 198, 11946 }, // Ӈ
+    { 16, 22, 21, 3, 17, 88, 12144 }, // ӈ
+    { 24, 35, 31, 4, 25, 210, 12232 }, // Ӊ
+    { 17, 24, 21, 3, 17, 102, 12442 }, // ӊ
+    { 18, 28, 20, 1, 22, 126, 12544 }, // Ӌ
+    { 12, 20, 18, 3, 15, 60, 12670 }, // ӌ
+    { 28, 35, 34, 4, 25, 245, 12730 }, // Ӎ
+    { 19, 24, 23, 3, 17, 114, 12975 }, // ӎ
+    { 6, 22, 18, 6, 21, 33, 13089 }, // ӏ
+    { 25, 35, 28, 2, 35, 219, 13122 }, // Ӑ
+    { 17, 27, 25, 4, 26, 115, 13341 }, // ӑ
+    { 25, 34, 28, 2, 34, 213, 13456 }, // Ӓ
+    { 17, 28, 25, 4, 27, 119, 13669 }, // ӓ
+    { 36, 26, 40, 2, 25, 234, 13788 }, // Ӕ
+    { 29, 19, 37, 4, 18, 138, 14022 }, // ӕ
+    { 18, 35, 26, 4, 35, 158, 14160 }, // Ӗ
+    { 17, 31, 25, 4, 30, 132, 14318 }, // ӗ
+    { 22, 24, 31, 5, 22, 132, 14450 }, // Ә
+    { 17, 19, 25, 5, 18, 81, 14582 }, // ә
+    { 22, 34, 31, 5, 32, 187, 14663 }, // Ӛ
+    { 17, 24, 25, 5, 18, 102, 14850 }, // ӛ
+    { 37, 38, 41, 2, 38, 352, 14952 }, // Ӝ
+    { 34, 33, 41, 4, 33, 281, 15304 }, // ӝ
+    { 15, 35, 19, 2, 34, 132, 15585 }, // Ӟ
+    { 14, 23, 13, -1, 23, 81, 15717 }, // ӟ
+    { 16, 24, 20, 2, 22, 96, 15798 }, // Ӡ
+    { 16, 23, 20, 2, 16, 92, 15894 }, // ӡ
+    { 22, 38, 30, 4, 38, 209, 15986 }, // Ӣ
+    { 18, 28, 20, 1, 27, 126, 16195 }, // ӣ
+    { 22, 36, 30, 4, 36, 198, 16321 }, // Ӥ
+    { 18, 27, 20, 1, 26, 122, 16519 }, // ӥ
+    { 25, 37, 33, 4, 35, 232, 16641 }, // Ӧ
+    { 18, 31, 25, 3, 30, 140, 16873 }, // ӧ
+    { 22, 24, 33, 5, 23, 132, 17013 }, // Ө
+    { 17, 19, 25, 4, 18, 81, 17145 }, // ө
+    { 22, 33, 33, 5, 32, 182, 17226 }, // Ӫ
+    { 17, 28, 25, 4, 27, 119, 17408 }, // ӫ
+    { 22, 37, 24, 1, 35, 204, 17527 }, // Ӭ
+    { 16, 24, 19, 1, 24, 96, 17731 }, // ӭ
+    { 19, 37, 23, 2, 34, 176, 17827 }, // Ӯ
+    { 19, 39, 27, 4, 30, 186, 18003 }, // ӯ
+    { 19, 37, 23, 2, 34, 176, 18189 }, // Ӱ
+    { 19, 38, 27, 4, 29, 181, 18365 }, // ӱ
+    { 26, 37, 23, 1, 34, 241, 18546 }, // Ӳ
+    { 26, 38, 27, 3, 29, 247, 18787 }, // ӳ
+    { 16, 29, 19, 2, 29, 116, 19034 }, // Ӵ
+    { 13, 22, 13, 0, 22, 72, 19150 }, // ӵ
+    { 17, 27, 19, 1, 22, 115, 19222 }, // Ӷ
+    { 12, 19, 13, 1, 15, 57, 19337 }, // ӷ
+    { 29, 38, 34, 1, 38, 276, 19394 }, // Ӹ
+    { 21, 30, 25, 1, 30, 158, 19670 }, // ӹ
+    { 27, 28, 33, 4, 25, 189, 19828 }, // Ӽ
+    { 19, 19, 23, 3, 17, 91, 20017 }, // ӽ
+    { 0, 0, 19, 0, 0, 0, 20108 }, //  
+    { 0, 0, 34, 0, 0, 0, 20108 }, //  
+    { 0, 0, 19, 0, 0, 0, 20108 }, //  
+    { 0, 0, 34, 0, 0, 0, 20108 }, //  
+    { 0, 0, 14, 0, 0, 0, 20108 }, //  
+    { 0, 0, 12, 0, 0, 0, 20108 }, //  
+    { 0, 0, 10, 0, 0, 0, 20108 }, //  
+    { 0, 0, 21, 0, 0, 0, 20108 }, //  
+    { 0, 0, 8, 0, 0, 0, 20108 }, //  
+    { 0, 0, 11, 0, 0, 0, 20108 }, //  
+    { 0, 0, 9, 0, 0, 0, 20108 }, //  
+    { 0, 0, 5, 0, 0, 0, 20108 }, // ​
+    { 0, 0, 0, 0, 0, 0, 20108 }, // ‌
+    { 0, 0, 0, 0, 0, 0, 20108 }, // ‍
+    { 0, 0, 0, 0, 0, 0, 20108 }, // ‎
+    { 0, 0, 0, 0, 0, 0, 20108 }, // ‏
+    { 16, 4, 16, 0, 11, 16, 20108 }, // ‐
+    { 16, 4, 16, 0, 11, 16, 20124 }, // ‑
+    { 24, 4, 16, -4, 11, 24, 20140 }, // ‒
+    { 21, 6, 23, 1, 11, 32, 17412 }, // –
+    { 31, 6, 33, 1, 11, 47, 17444 }, // —
+    { 31, 6, 33, 1, 11, 47, 20164 }, // ―
+    { 14, 27, 16, 3, 22, 95, 20211 }, // ‖
+    { 24, 10, 16, -4, -2, 60, 20306 }, // ‗
+    { 10, 10, 13, 1, 26, 25, 17491 }, // ‘
+    { 10, 10, 13, 1, 26, 25, 17516 }, // ’
+    { 10, 10, 9, 0, 5, 25, 20366 }, // ‚
+    { 10, 10, 13, 1, 26, 25, 20391 }, // ‛
+    { 20, 10, 22, 1, 26, 50, 17541 }, // “
+    { 20, 10, 22, 1, 26, 50, 17591 }, // ”
+    { 10, 10, 9, 0, 5, 25, 20416 }, // „
+    { 20, 10, 22, 1, 26, 50, 20441 }, // ‟
+    { 18, 41, 24, 3, 31, 185, 20491 }, // †
+    { 17, 41, 25, 5, 30, 175, 20676 }, // ‡
+    { 23, 23, 15, -4, 26, 133, 20851 }, // •
+    { 10, 10, 18, 4, 13, 25, 20984 }, // ‣
+    { 7, 7, 18, 5, 7, 13, 21009 }, // ․
+    { 7, 7, 18, 5, 7, 13, 21022 }, // ‥
+    { 27, 7, 28, 0, 7, 48, 17641 }, // …
+    { 4, 4, 16, 6, 11, 4, 21035 }, // ‧
+    { 0, 0, 32, 0, 0, 0, 21039 }, //  
+    { 21, 26, 33, 6, 23, 137, 21039 }, // ‰
+    { 10, 10, 16, 5, 26, 25, 21176 }, // ′
+    { 19, 10, 23, 5, 26, 48, 21201 }, // ″
+    { 23, 9, 12, 2, 25, 52, 21249 }, // ‴
+    { 8, 9, 12, 2, 24, 18, 21301 }, // ‵
+    { 14, 9, 12, 0, 24, 32, 21319 }, // ‶
+    { 24, 9, 12, -6, 25, 54, 21351 }, // ‷
+    { 17, 7, 19, 1, 25, 30, 21405 }, // ‸
+    { 10, 16, 12, 1, 16, 40, 21435 }, // ‹
+    { 10, 16, 12, 1, 16, 40, 21475 }, // ›
+    { 32, 38, 40, 5, 30, 304, 21515 }, // ※
+    { 9, 37, 18, 4, 32, 84, 21819 }, // ‼
+    { 18, 46, 25, 3, 39, 207, 21903 }, // ‽
+    { 16, 4, 16, 0, 24, 16, 22110 }, // ‾
+    { 14, 7, 16, 1, 20, 25, 22126 }, // ‿
+    { 21, 22, 19, -1, 28, 116, 22151 }, // ⁂
+    { 20, 25, 36, 8, 23, 125, 22267 }, // ⁄
+    { 36, 37, 44, 4, 33, 333, 22392 }, // ⁇
+    { 31, 38, 35, 2, 33, 295, 22725 }, // ⁈
+    { 24, 38, 23, -1, 33, 228, 23020 }, // ⁉
+    { 22, 51, 27, 2, 35, 281, 23248 }, // ⁒
+    { 0, 0, 136, 0, 0, 0, 23529 }, //  
+    { 8, 12, 10, 1, 24, 24, 23529 }, // ⁰
+    { 9, 11, 10, 1, 25, 25, 23553 }, // ⁴
+    { 8, 12, 10, 1, 25, 24, 23578 }, // ⁵
+    { 9, 11, 10, 1, 24, 25, 23602 }, // ⁶
+    { 9, 13, 11, 1, 25, 30, 23627 }, // ⁷
+    { 9, 11, 11, 1, 24, 25, 23657 }, // ⁸
+    { 9, 12, 11, 1, 24, 27, 23682 }, // ⁹
+    { 17, 18, 25, 4, 18, 77, 23709 }, // ⁿ
+    { 9, 12, 10, 1, 7, 27, 23786 }, // ₀
+    { 8, 12, 10, 1, 7, 24, 23813 }, // ₁
+    { 9, 12, 11, 1, 7, 27, 23837 }, // ₂
+    { 9, 12, 10, 1, 7, 27, 23864 }, // ₃
+    { 9, 12, 11, 1, 7, 27, 23891 }, // ₄
+    { 8, 12, 10, 1, 7, 24, 23918 }, // ₅
+    { 9, 12, 11, 1, 7, 27, 23942 }, // ₆
+    { 9, 12, 11, 1, 7, 27, 23969 }, // ₇
+    { 9, 12, 11, 1, 7, 27, 23996 }, // ₈
+    { 9, 13, 11, 1, 7, 30, 24023 }, // ₉
+    { 13, 40, 14, 1, 30, 130, 24053 }, // ₍
+    { 13, 40, 13, -2, 30, 130, 24183 }, // ₎
+    { 21, 39, 29, 4, 33, 205, 24313 }, // ₡
+    { 22, 27, 29, 3, 27, 149, 24518 }, // ₢
+    { 20, 27, 20, 0, 26, 135, 24667 }, // ₤
+    { 32, 25, 30, -1, 25, 200, 24802 }, // ₦
+    { 25, 25, 27, 1, 25, 157, 25002 }, // ₧
+    { 32, 27, 38, 3, 25, 216, 25159 }, // ₨
+    { 25, 26, 25, 0, 26, 163, 25375 }, // ₩
+    { 23, 23, 31, 4, 23, 133, 25538 }, // ₪
+    { 22, 25, 15, -2, 24, 138, 25671 }, // ₫
+    { 20, 28, 22, 1, 24, 140, 25809 }, // €
+    { 23, 25, 31, 4, 25, 144, 25949 }, // ₮
+    { 29, 25, 19, -1, 25, 182, 26093 }, // ₱
+    { 26, 39, 34, 4, 33, 254, 26275 }, // ₲
+    { 30, 24, 31, 5, 22, 180, 26529 }, // ₴
+    { 15, 24, 17, 4, 21, 90, 26709 }, // ₵
+    { 24, 26, 31, 3, 26, 156, 26799 }, // ₸
+    { 16, 24, 20, 2, 23, 96, 26955 }, // ₹
+    { 18, 22, 20, 1, 20, 99, 27051 }, // ₺
+    { 21, 24, 24, 1, 23, 126, 27150 }, // ₼
+    { 26, 25, 27, -3, 25, 163, 27276 }, // ₽
+    { 20, 20, 21, 0, 18, 100, 27439 }, // ←
+    { 21, 20, 22, 1, 19, 105, 27539 }, // ↑
+    { 20, 20, 22, 1, 18, 100, 27644 }, // →
+    { 21, 20, 22, 1, 19, 105, 0 }, // ↓
+    { 24, 17, 30, 3, 16, 102, 105 }, // ↔
+    { 17, 24, 23, 3, 26, 102, 207 }, // ↕
+    { 17, 16, 23, 3, 15, 68, 309 }, // ↖
+    { 17, 16, 19, 1, 15, 68, 377 }, // ↗
+    { 17, 16, 19, 1, 16, 68, 445 }, // ↘
+    { 17, 16, 19, 1, 16, 68, 513 }, // ↙
+    { 23, 20, 29, 3, 19, 115, 581 }, // ⇐
+    { 25, 24, 31, 3, 23, 150, 696 }, // ⇑
+    { 23, 20, 29, 3, 19, 115, 846 }, // ⇒
+    { 25, 24, 31, 3, 22, 150, 961 }, // ⇓
+    { 26, 20, 32, 3, 19, 130, 1111 }, // ⇔
+    { 20, 25, 26, 3, 14, 125, 1241 }, // ⇕
+    { 18, 26, 20, 1, 24, 117, 1366 }, // ∂
+    { 30, 30, 33, 1, 27, 225, 1483 }, // ∅
+    { 23, 23, 25, 1, 22, 133, 1708 }, // ∆
+    { 19, 23, 22, 1, 21, 110, 1841 }, // ∏
+    { 19, 23, 22, 1, 22, 110, 1951 }, // ∐
+    { 15, 22, 17, 1, 21, 83, 2061 }, // ∑
+    { 16, 5, 18, 1, 11, 20, 2144 }, // −
+    { 24, 26, 28, 2, 24, 156, 2164 }, // √
+    { 25, 17, 27, 1, 19, 107, 2320 }, // ∞
+    { 23, 31, 25, 1, 23, 179, 2427 }, // ∫
+    { 8, 20, 9, 1, 20, 40, 2606 }, // ∶
+    { 18, 17, 42, 12, 17, 77, 2646 }, // ≈
+    { 22, 26, 36, 7, 23, 143, 2723 }, // ≠
+    { 25, 25, 23, -1, 21, 157, 2866 }, // ≤
+    { 24, 26, 25, 1, 22, 156, 3023 }, // ≥
+    { 24, 24, 32, 4, 24, 144, 3179 }, // ﬀ
+    { 20, 27, 28, 4, 27, 135, 3323 }, // ﬁ
+    { 24, 25, 32, 4, 25, 150, 3458 }, // ﬂ
+    { 32, 27, 39, 5, 27, 216, 3608 }, // ﬃ
+    { 36, 25, 44, 4, 25, 225, 3824 }, // ﬄ
+    { 31, 24, 35, 2, 22, 186, 4049 }, // ﬆ
 };
 
 static const EpdUnicodeInterval opendyslexic_14_boldIntervals[] = {
@@ -2997,30 +3000,90 @@ static const EpdUnicodeInterval opendyslexic_14_boldIntervals[] = {
     { 0x2248, 0x2248, 0x2D1 },
     { 0x2260, 0x2260, 0x2D2 },
     { 0x2264, 0x2265, 0x2D3 },
+    { 0xFB00, 0xFB04, 0x2D5 },
+    { 0xFB06, 0xFB06, 0x2DA },
 };
 
 static const EpdFontGroup opendyslexic_14_boldGroups[] = {
-    { 0, 4937, 10077, 95, 0 },
-    { 4937, 4914, 12682, 96, 95 },
-    { 9851, 7124, 20396, 126, 191 },
-    { 16975, 977, 1739, 61, 317 },
-    { 17952, 11746, 27828, 213, 378 },
-    { 29698, 1680, 3698, 63, 591 },
-    { 31378, 581, 784, 20, 654 },
-    { 31959, 1548, 3126, 20, 674 },
-    { 33507, 836, 1671, 16, 694 },
-    { 34343, 871, 1813, 15, 710 },
+    { 0, 7110, 17689, 151, 0 },
+    { 7110, 3655, 7389, 66, 379 },
+    { 10765, 10283, 27813, 236, 96 },
+    { 21048, 12279, 27744, 244, 381 },
+    { 33327, 1832, 4235, 34, 697 },
+};
+
+static const uint8_t opendyslexic_14_boldGlyphGroups[731] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 0,
+    0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 2, 2, 2, 0,
+    0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 2, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 3, 1, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 0, 0, 3, 3, 3, 0, 0, 3, 3, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+};
+
+static const uint16_t opendyslexic_14_boldGlyphLookup[368] = {
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x005F, 0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E,
+    0x006F, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E,
+    0x007F, 0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E,
+    0x008F, 0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E,
+    0x009F, 0x00A0, 0x00A1, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE,
+    0x00AF, 0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE,
+    0x024F, 0x0250, 0x0251, 0x0252, 0x0253, 0x0254, 0x0255, 0x0256, 0x0257, 0x0258, 0x0259, 0x025A, 0x025B, 0x025C, 0x025D, 0x025E,
+    0x025F, 0x0260, 0x0261, 0x0262, 0x0263, 0x0264, 0x0265, 0x0266, 0x0267, 0x0268, 0x0269, 0x026A, 0x026B, 0x026C, 0x026D, 0x026E,
+    0x026F, 0x0270, 0x0271, 0x0272, 0x0273, 0x0274, 0x0275, 0x0276, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0277,
+    0x0278, 0xFFFF, 0x0279, 0x027A, 0x027B, 0x027C, 0x027D, 0x027E, 0x027F, 0x0280, 0x0281, 0x0282, 0x0283, 0x0284, 0x0285, 0x0286,
+    0xFFFF, 0xFFFF, 0x0287, 0xFFFF, 0x0288, 0xFFFF, 0xFFFF, 0x0289, 0x028A, 0x028B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x028C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x028D,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
 };
 
 static const EpdFontData opendyslexic_14_bold = {
     opendyslexic_14_boldBitmaps,
     opendyslexic_14_boldGlyphs,
     opendyslexic_14_boldIntervals,
-    56,
+    58,
     53,
     38,
     -16,
     true,
     opendyslexic_14_boldGroups,
-    10,
+    5,
+    nullptr,
+    nullptr,
+    nullptr,
+    0,
+    nullptr,
+    0,
+    0,
+    opendyslexic_14_boldGlyphLookup,
+    opendyslexic_14_boldGlyphGroups,
+    false,
+    nullptr,
 };
@@ -3,2511 +3,2512 @@
  * name: opendyslexic_14_bolditalic
  * size: 14
  * mode: 2-bit  compressed: true
- * Command used: fontconvert.py opendyslexic_14_bolditalic 14 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-BoldItalic.otf --2bit --compress
+ * Command used: fontconvert.py opendyslexic_14_bolditalic 14 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-BoldItalic.otf --2bit --compress --no-kerning --frequency-corpus ../../../test/hyphenation_eval/resources/english_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/french_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/german_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/italian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/russian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/spanish_hyphenation_tests.txt
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t opendyslexic_14_bolditalicBitmaps[39973] = {
-    0x9D, 0x5A, 0xBF, 0xD3, 0xE5, 0xD6, 0x59, 0x3E, 0x57, 0xCA, 0xAE, 0x88, 0x35, 0x44, 0x69, 0x36,
-    0x33, 0x78, 0x0B, 0x35, 0x14, 0x40, 0x00, 0x35, 0x29, 0xB1, 0x25, 0x3B, 0xC3, 0xA4, 0xF4, 0x16,
-    0xFE, 0x60, 0x82, 0x0B, 0x37, 0x14, 0x60, 0x17, 0xDF, 0x3F, 0xC0, 0xA0, 0x4B, 0xB6, 0xA0, 0xA0,
-    0xF0, 0x97, 0x01, 0x37, 0xB8, 0x60, 0x99, 0x09, 0x33, 0xF1, 0xB7, 0xC5, 0xE6, 0x0F, 0x88, 0x2D,
-    0x2D, 0x9E, 0x09, 0x05, 0x85, 0x2F, 0xCE, 0x18, 0x8A, 0x14, 0x56, 0x98, 0x65, 0x06, 0xBB, 0xB1,
-    0x70, 0x14, 0x5B, 0xBB, 0x96, 0x74, 0x78, 0x9E, 0xE7, 0x3D, 0xD2, 0xBD, 0xFB, 0xC3, 0x49, 0xE0,
-    0x9B, 0xEF, 0xEA, 0xDE, 0x7B, 0xAE, 0x74, 0xCE, 0x7B, 0xDE, 0x1F, 0xCF, 0xFB, 0xEB, 0x38, 0xA7,
-    0xBF, 0x6F, 0xE0, 0xF5, 0x17, 0x78, 0xBD, 0x8D, 0xD7, 0xE2, 0xDC, 0x6E, 0x76, 0x2E, 0x9E, 0xEC,
-    0x95, 0x8C, 0xCE, 0x65, 0x03, 0x5E, 0xBD, 0x73, 0x45, 0xE7, 0x5C, 0x79, 0x70, 0xAE, 0x6E, 0x9D,
-    0x6B, 0xF0, 0xF2, 0x7B, 0xB7, 0xF3, 0xCE, 0x45, 0x78, 0xC5, 0x78, 0x2C, 0xC6, 0x63, 0x0E, 0x8F,
-    0xB8, 0x3F, 0xC0, 0xEB, 0x4B, 0xEE, 0x8B, 0xFE, 0x76, 0xBE, 0x75, 0x31, 0x5E, 0x09, 0x5E, 0x99,
-    0x5E, 0x7B, 0x57, 0xF8, 0xCA, 0x95, 0x78, 0x35, 0x98, 0xAA, 0xF4, 0x89, 0xEF, 0x4A, 0x1F, 0xFB,
-    0x43, 0xC1, 0x4B, 0xBE, 0x44, 0xFE, 0x90, 0xF9, 0x1D, 0x2F, 0xCE, 0x77, 0xA9, 0xAF, 0x7C, 0x9F,
-    0xF8, 0xBD, 0x1F, 0x30, 0x47, 0x33, 0xE2, 0x86, 0x9A, 0x4B, 0x82, 0xEC, 0xA6, 0xE2, 0x7B, 0x34,
-    0x3B, 0xAF, 0x65, 0xE2, 0x69, 0x67, 0x1F, 0xD2, 0x51, 0x84, 0x71, 0x1B, 0xB1, 0x6E, 0x75, 0x79,
-    0x9F, 0x8E, 0xFA, 0x50, 0x76, 0xDC, 0x1A, 0x28, 0xD0, 0xDF, 0xE4, 0x72, 0xFB, 0x30, 0x80, 0x06,
-    0xFD, 0x75, 0x20, 0x48, 0x7F, 0xD8, 0x6C, 0xEC, 0xB9, 0x5F, 0x4E, 0xBC, 0xEC, 0xBC, 0x96, 0x4A,
-    0xA7, 0xC8, 0x56, 0xC8, 0x26, 0x6E, 0x9F, 0x13, 0x8F, 0x89, 0x2D, 0x55, 0x0E, 0x19, 0x97, 0x8A,
-    0xED, 0xE9, 0xD9, 0xA5, 0x5F, 0xBC, 0x02, 0x6E, 0xAA, 0x38, 0x3F, 0x58, 0x8D, 0x15, 0xF4, 0x21,
-    0xC5, 0x96, 0xB5, 0x42, 0x36, 0xC7, 0xB6, 0x42, 0x31, 0x25, 0xF6, 0xA1, 0x1C, 0xD3, 0x79, 0xE3,
-    0xE4, 0xB5, 0xB0, 0x51, 0x23, 0xA2, 0xD3, 0x5B, 0x6D, 0x5C, 0xD0, 0xD8, 0xD3, 0xFE, 0x3E, 0x67,
-    0xC3, 0x32, 0xE4, 0xBA, 0xF7, 0x10, 0x61, 0x1E, 0xBE, 0xCC, 0xE5, 0x3D, 0xEE, 0xBB, 0x22, 0xDD,
-    0x75, 0x1F, 0x0F, 0x94, 0xE2, 0x3E, 0x6F, 0x39, 0xE6, 0x1A, 0xAE, 0xE3, 0xFF, 0x96, 0x2C, 0xC2,
-    0xF6, 0x21, 0x6F, 0x67, 0x84, 0xEE, 0x44, 0x38, 0xEE, 0xB7, 0xB7, 0xAB, 0x9A, 0x90, 0xA3, 0xAD,
-    0xAD, 0xE2, 0x76, 0x7B, 0x3C, 0x37, 0xB9, 0x62, 0xC0, 0x03, 0x5D, 0xE4, 0xFD, 0x6D, 0x8C, 0x69,
-    0x9F, 0x83, 0x31, 0xA2, 0x8A, 0x78, 0xC5, 0x84, 0x2F, 0x69, 0x3E, 0x4E, 0xE5, 0x8E, 0xD4, 0xAE,
-    0x3B, 0x28, 0xB5, 0x83, 0xDD, 0xB4, 0xEE, 0xF2, 0xA9, 0x5B, 0x27, 0xB7, 0x26, 0x83, 0x23, 0x8B,
-    0xEB, 0xBD, 0x6B, 0x66, 0x17, 0x8F, 0x2E, 0xED, 0x26, 0x57, 0xB6, 0xEE, 0xD9, 0xA8, 0x07, 0x1B,
-    0xA2, 0x3E, 0x6D, 0x8B, 0x83, 0xCB, 0xF6, 0xCF, 0x42, 0x0B, 0x5C, 0x19, 0xF7, 0x54, 0x58, 0xEF,
-    0xEF, 0x2E, 0xDC, 0xDD, 0x94, 0xF7, 0xE4, 0xF5, 0x5E, 0x7C, 0xBC, 0x91, 0x0D, 0x0D, 0x85, 0xE9,
-    0x5F, 0xA0, 0x4C, 0xD3, 0x71, 0x2E, 0xB8, 0xD9, 0x7F, 0x6D, 0x9F, 0xA1, 0x54, 0x9F, 0x75, 0xD8,
-    0x5E, 0x7D, 0xB7, 0x4F, 0xA0, 0xA3, 0x73, 0xD2, 0x96, 0x54, 0xFA, 0xE2, 0x8D, 0x81, 0x3A, 0x5E,
-    0x63, 0xAF, 0x65, 0xEF, 0xB0, 0x49, 0x8A, 0x1E, 0x1A, 0x57, 0xF4, 0x4F, 0xD2, 0xF0, 0x86, 0xBC,
-    0x2B, 0x3C, 0x4D, 0x68, 0xE6, 0xE6, 0x8A, 0x96, 0x1C, 0x9E, 0x5C, 0x72, 0x70, 0x49, 0xEF, 0x8A,
-    0xCA, 0xE5, 0x2D, 0x87, 0xCB, 0xAA, 0x24, 0x81, 0xA9, 0x17, 0x8B, 0x7B, 0x52, 0x39, 0xEB, 0xC1,
-    0x3D, 0x29, 0x9D, 0x25, 0x06, 0xA8, 0xF3, 0xF3, 0xFE, 0xE6, 0x14, 0x4F, 0x50, 0xB2, 0xA9, 0xE8,
-    0x9A, 0x43, 0xB2, 0xC0, 0x2A, 0xAA, 0xC4, 0x8F, 0x90, 0x5E, 0xEE, 0xF7, 0xA5, 0xF4, 0xAB, 0x91,
-    0x72, 0x19, 0x77, 0xBD, 0x5F, 0x7E, 0x1D, 0xB4, 0x3D, 0xA8, 0x56, 0x72, 0x9A, 0x39, 0xF7, 0xDF,
-    0xF4, 0xAD, 0xEF, 0xA9, 0x45, 0xB0, 0x9E, 0x72, 0x4A, 0xFD, 0x73, 0x41, 0x00, 0x64, 0xE9, 0x3D,
-    0x6A, 0xAE, 0x04, 0xCB, 0x31, 0x5B, 0x5C, 0x5A, 0x4D, 0x5A, 0x8E, 0xE3, 0xAD, 0x59, 0xBA, 0xF8,
-    0x6F, 0x3F, 0xEA, 0x21, 0x6E, 0x41, 0x88, 0xA0, 0x27, 0x65, 0x73, 0xBA, 0x4D, 0x26, 0x91, 0x4C,
-    0xEB, 0x25, 0xE5, 0x25, 0x1B, 0x9D, 0xA1, 0x89, 0x5D, 0x28, 0x91, 0xC7, 0x2E, 0xC3, 0x76, 0x19,
-    0xD7, 0x75, 0x8E, 0x97, 0x74, 0x31, 0x3B, 0x09, 0x24, 0xC6, 0x34, 0x93, 0xDD, 0xAB, 0x6D, 0xD8,
-    0xC9, 0x75, 0x7E, 0x90, 0x44, 0x82, 0xF5, 0xB9, 0x40, 0xB7, 0xED, 0x40, 0x7B, 0xB1, 0x5F, 0x16,
-    0x29, 0x2E, 0x39, 0x44, 0x1C, 0xB3, 0x3D, 0xD8, 0x83, 0xE3, 0x4A, 0x70, 0xB8, 0x47, 0x53, 0x54,
-    0x61, 0x77, 0xB6, 0xCF, 0x52, 0x97, 0xC3, 0x43, 0xCF, 0x15, 0xFD, 0x17, 0xEC, 0xE7, 0xF8, 0x6B,
-    0xB9, 0x5D, 0x6A, 0x5E, 0x1A, 0x31, 0xF5, 0x10, 0x28, 0xDC, 0x19, 0xC4, 0x90, 0xF7, 0x1F, 0x06,
-    0xCB, 0xA6, 0x25, 0xE7, 0xED, 0x6F, 0x66, 0x69, 0xFF, 0x56, 0xF6, 0xD9, 0x7D, 0x4F, 0x90, 0xBA,
-    0x0B, 0xD9, 0xC2, 0xEE, 0x26, 0x1A, 0xDD, 0x21, 0xC1, 0xC0, 0x0B, 0x1C, 0x5C, 0xEA, 0xA2, 0x7D,
-    0xA6, 0x68, 0xDB, 0x2F, 0x11, 0xA3, 0xA9, 0x68, 0x4E, 0xA2, 0x7F, 0x15, 0x57, 0x58, 0x83, 0x90,
-    0x9B, 0x18, 0xB1, 0xE3, 0x86, 0xBC, 0x30, 0xA9, 0xA7, 0xBA, 0xC0, 0x8C, 0x97, 0xA7, 0x6F, 0xFB,
-    0x4B, 0x27, 0xC0, 0x84, 0x45, 0x3D, 0x74, 0xB7, 0x7B, 0x51, 0xEA, 0x47, 0x74, 0x06, 0x50, 0x47,
-    0xD4, 0xAB, 0xDE, 0xD5, 0xC0, 0xAD, 0x89, 0xFF, 0xF9, 0x42, 0xA0, 0x70, 0xD7, 0xCE, 0xCE, 0xCE,
-    0x48, 0xD7, 0x3B, 0x78, 0xFD, 0x54, 0xE8, 0x70, 0x16, 0x2F, 0xC9, 0x92, 0xCD, 0xF9, 0x5C, 0x4C,
-    0xE5, 0x6A, 0xC1, 0xBB, 0x55, 0xD1, 0x82, 0x9C, 0xF2, 0xF0, 0x1E, 0xEC, 0x5D, 0x4B, 0xEA, 0x77,
-    0x03, 0xE5, 0x15, 0xD0, 0x8C, 0x60, 0xF1, 0x7F, 0x55, 0xE4, 0xA0, 0xD2, 0x65, 0x98, 0x40, 0x32,
-    0x58, 0x19, 0xBD, 0x2A, 0xD5, 0x13, 0x26, 0x8A, 0x1E, 0x9B, 0x68, 0x6F, 0xEF, 0xF5, 0x2F, 0x99,
-    0x28, 0x0D, 0x13, 0x04, 0x07, 0xB2, 0x4D, 0xB4, 0x5B, 0x27, 0xF2, 0x8F, 0x4E, 0x14, 0xB6, 0x54,
-    0xFC, 0x92, 0x89, 0x02, 0xAC, 0x07, 0x1D, 0x5C, 0xB5, 0xF4, 0x17, 0x4D, 0x34, 0x3E, 0x3C, 0x51,
-    0xB2, 0x7C, 0xD1, 0x44, 0xFB, 0x87, 0x79, 0xF5, 0x6C, 0xA0, 0xF4, 0xB7, 0xC2, 0xFB, 0x89, 0x5F,
-    0x8E, 0xDE, 0xE4, 0x96, 0x89, 0x3B, 0x05, 0x9D, 0x42, 0x31, 0x00, 0x2E, 0x73, 0xE2, 0x28, 0xA8,
-    0x6E, 0x00, 0x8A, 0x5F, 0x05, 0x6C, 0x4D, 0x65, 0xD6, 0x47, 0xBE, 0x7C, 0x07, 0xE0, 0xF2, 0x5A,
-    0xEF, 0x5D, 0xFD, 0x2F, 0x53, 0xD3, 0x16, 0x9F, 0x78, 0x38, 0xCE, 0xB1, 0x79, 0x79, 0x88, 0x97,
-    0xEC, 0x35, 0xB8, 0xD9, 0x3D, 0xA8, 0xA9, 0x3B, 0x18, 0x63, 0x31, 0x43, 0x57, 0xE8, 0x6F, 0x0E,
-    0xE6, 0x6E, 0xE4, 0x29, 0xA0, 0x20, 0x23, 0x20, 0x01, 0x17, 0xAC, 0x33, 0x10, 0x1D, 0x2F, 0x56,
-    0x0A, 0x52, 0x6A, 0xF2, 0x84, 0x4D, 0x00, 0xC8, 0x75, 0x67, 0xEF, 0xBE, 0xF2, 0xC4, 0x20, 0xA3,
-    0xB2, 0x20, 0x23, 0x04, 0x1A, 0x74, 0x81, 0xB4, 0xE3, 0x4C, 0xFE, 0x74, 0x2A, 0xC3, 0x0B, 0xAB,
-    0x8D, 0x8D, 0x7C, 0xD3, 0xF5, 0xA5, 0xA2, 0x89, 0x4C, 0xF2, 0x5C, 0x2D, 0x7D, 0xD0, 0xE0, 0xF2,
-    0x7B, 0xA0, 0x32, 0xAD, 0xCC, 0xE0, 0xB9, 0x48, 0x40, 0xA3, 0x0D, 0x56, 0x04, 0xC3, 0x19, 0xF9,
-    0x28, 0x00, 0xAE, 0xB5, 0x30, 0x2E, 0x20, 0xBD, 0xA2, 0xD5, 0x90, 0x06, 0x6E, 0xCA, 0x73, 0x2B,
-    0x0D, 0x2D, 0x91, 0xD8, 0x5B, 0xE5, 0x16, 0x1E, 0xB8, 0x57, 0xB1, 0xA6, 0x23, 0x16, 0x73, 0xD7,
-    0x58, 0xF3, 0xA3, 0x3B, 0xA3, 0xFB, 0x72, 0x50, 0x39, 0x29, 0xAC, 0xD4, 0x3D, 0x15, 0xB2, 0x4D,
-    0xBC, 0x89, 0x0E, 0x80, 0x4C, 0xC9, 0xFD, 0x22, 0xF7, 0x79, 0x90, 0x9F, 0x3F, 0xE2, 0xD6, 0x3E,
-    0xBA, 0xD8, 0x09, 0xCE, 0xB1, 0x66, 0xC3, 0x35, 0x6B, 0xEE, 0xA8, 0xE4, 0x12, 0x99, 0xD6, 0x39,
-    0xF7, 0xF7, 0x8E, 0xC2, 0xCC, 0x0F, 0x41, 0x2D, 0x39, 0xF9, 0xCE, 0x5C, 0x3D, 0x37, 0x80, 0xFB,
-    0xF2, 0x0F, 0x7A, 0x84, 0x74, 0xA0, 0x21, 0x7F, 0x6F, 0x81, 0x51, 0x41, 0xBA, 0x79, 0x57, 0xB6,
-    0x3B, 0x04, 0x19, 0x2E, 0xFF, 0xF9, 0xF9, 0xF2, 0x5D, 0xBA, 0x0D, 0x0A, 0x8D, 0x4C, 0xF4, 0xDD,
-    0x9F, 0x5C, 0x36, 0x9E, 0xDC, 0xDB, 0x07, 0xB6, 0x94, 0x43, 0x40, 0xA7, 0xD4, 0x9F, 0xFA, 0x38,
-    0xC2, 0x08, 0x90, 0xD8, 0x2F, 0x46, 0x4C, 0xF6, 0xE0, 0xF2, 0xFB, 0xA2, 0x01, 0xBE, 0x6E, 0x83,
-    0xC8, 0xBD, 0x22, 0x88, 0x0B, 0xB2, 0x65, 0x91, 0x28, 0xF6, 0x54, 0x8B, 0x76, 0x77, 0xC3, 0xD5,
-    0x1B, 0x7A, 0xD6, 0x87, 0x1D, 0xB5, 0x3F, 0xB9, 0x48, 0x7D, 0x9B, 0xAD, 0xFC, 0xA4, 0x42, 0x6A,
-    0xAB, 0x52, 0xA1, 0x0A, 0x90, 0x67, 0x3B, 0x3D, 0x27, 0x1D, 0x8D, 0x71, 0x0E, 0x04, 0x66, 0x94,
-    0x6B, 0x6C, 0xE8, 0xCC, 0x4B, 0xDE, 0x6D, 0x46, 0x5F, 0xBF, 0x71, 0x5F, 0x71, 0x9D, 0xA0, 0x12,
-    0xBE, 0xAE, 0xE0, 0xAC, 0x31, 0x5C, 0xE0, 0x88, 0x10, 0xCA, 0x49, 0x63, 0x21, 0xFE, 0x06, 0xEC,
-    0xAD, 0xA0, 0x84, 0xB0, 0x7B, 0x90, 0x00, 0xF5, 0x40, 0xC8, 0x72, 0x30, 0x66, 0xC7, 0xA2, 0x39,
-    0xE7, 0x32, 0xAE, 0x58, 0x82, 0x31, 0x91, 0xC0, 0x1F, 0xE3, 0xF5, 0x3F, 0xD4, 0x81, 0x57, 0x6E,
-    0xCB, 0xC1, 0x2F, 0xC1, 0xF8, 0x48, 0x1A, 0xB7, 0x45, 0x84, 0x2F, 0x46, 0x53, 0x2C, 0x32, 0x30,
-    0x96, 0xF6, 0xB4, 0x8E, 0xB2, 0x24, 0x86, 0xBA, 0x1A, 0x3F, 0x12, 0x1B, 0x0B, 0x6F, 0xEA, 0x96,
-    0x2A, 0x1E, 0x96, 0xBD, 0x47, 0x16, 0x0F, 0xE2, 0xCE, 0x9D, 0xE2, 0x34, 0x84, 0x91, 0x03, 0x0C,
-    0x91, 0xC6, 0xEC, 0x69, 0x95, 0x79, 0x0F, 0x11, 0x63, 0x35, 0xF8, 0x0E, 0xED, 0x0D, 0x6C, 0xD0,
-    0xF2, 0xA6, 0xA5, 0xE4, 0xF1, 0x01, 0x4E, 0x8E, 0x01, 0xCA, 0x1E, 0x36, 0x82, 0x0D, 0x62, 0x6A,
-    0xBF, 0xCF, 0x18, 0x92, 0xED, 0x7C, 0x97, 0x7B, 0x85, 0x7F, 0x9D, 0x53, 0xB0, 0x60, 0x61, 0x61,
-    0xA1, 0x0D, 0x7E, 0xDD, 0x36, 0x78, 0x95, 0x9F, 0x93, 0xA0, 0xE9, 0x54, 0xE4, 0xFF, 0x6A, 0x7A,
-    0xF1, 0x86, 0x4C, 0x4D, 0x7B, 0x87, 0x48, 0x08, 0xB8, 0xD0, 0xF1, 0xE3, 0x4C, 0xCD, 0xCE, 0x5A,
-    0xE2, 0xD3, 0xCC, 0x6D, 0x66, 0xF7, 0x5F, 0x32, 0x5D, 0x9D, 0x38, 0x01, 0x96, 0xCD, 0xCD, 0xE0,
-    0x17, 0xBF, 0xA1, 0x18, 0xE2, 0x86, 0xF4, 0xC3, 0x3F, 0x26, 0x45, 0x94, 0x6B, 0xCE, 0x15, 0xA8,
-    0x44, 0x15, 0xC2, 0xD4, 0x65, 0x8B, 0x55, 0x28, 0x04, 0xCC, 0x36, 0xBB, 0x62, 0x26, 0x93, 0x9A,
-    0x89, 0xB1, 0xD6, 0x63, 0x7F, 0x08, 0x8F, 0x61, 0x24, 0x29, 0xBD, 0x13, 0x26, 0x72, 0x25, 0xE0,
-    0x67, 0x39, 0xE2, 0x22, 0x08, 0xC9, 0x67, 0xF1, 0xBC, 0x9C, 0xC4, 0xDD, 0x27, 0x4D, 0xC1, 0xBF,
-    0x57, 0xDE, 0xB4, 0x9F, 0x47, 0xCE, 0x43, 0xF9, 0xE8, 0xFE, 0x8A, 0x52, 0x2A, 0x67, 0xEC, 0x63,
-    0xEF, 0xAE, 0xDD, 0xB0, 0x3B, 0xF5, 0x96, 0x48, 0x46, 0x72, 0xDE, 0x49, 0x08, 0x84, 0x07, 0xF1,
-    0x6B, 0x1F, 0xCC, 0x39, 0x91, 0x11, 0xD7, 0x8A, 0xDC, 0x6A, 0x49, 0xB4, 0xA4, 0xF6, 0x53, 0x59,
-    0x2F, 0x04, 0x0B, 0x78, 0xBB, 0xD2, 0xE8, 0xED, 0xAA, 0x85, 0xE3, 0x57, 0xC5, 0x25, 0x2C, 0x2A,
-    0x0A, 0xAF, 0x1B, 0x9D, 0xBF, 0xE1, 0xAE, 0xBD, 0x72, 0xA7, 0x93, 0x6D, 0xF1, 0x2E, 0x5A, 0xE5,
-    0xEE, 0x45, 0x77, 0x12, 0xF5, 0x7F, 0x1D, 0xA3, 0x14, 0x9F, 0x40, 0xB6, 0x5C, 0x2E, 0x5F, 0x77,
-    0xEE, 0x8A, 0xE1, 0xE9, 0xC1, 0xB2, 0x06, 0x01, 0x82, 0x00, 0x25, 0x17, 0x31, 0x91, 0xA1, 0x4B,
-    0xA9, 0x2F, 0x46, 0x65, 0x20, 0x33, 0xD5, 0x95, 0x21, 0x05, 0x69, 0x99, 0x44, 0xD7, 0xCC, 0xCB,
-    0x72, 0x23, 0x13, 0xA1, 0xB9, 0x68, 0x2F, 0x6D, 0x37, 0xB2, 0xC2, 0x3F, 0x7D, 0x88, 0x87, 0x4F,
-    0x5F, 0x68, 0x2E, 0xED, 0x5B, 0x89, 0x9C, 0xC4, 0x7A, 0x01, 0x89, 0xE7, 0x7B, 0x5A, 0xE5, 0x85,
-    0x41, 0x9E, 0xF9, 0x23, 0x73, 0x87, 0x47, 0x95, 0x30, 0x77, 0x28, 0xF8, 0x24, 0xCC, 0xB8, 0xF3,
-    0x45, 0x88, 0x41, 0x93, 0xE3, 0x8C, 0x66, 0x15, 0xF5, 0xB0, 0x82, 0xB3, 0xD3, 0xF7, 0xDC, 0x76,
-    0xB4, 0x21, 0xCC, 0xEE, 0x0B, 0x33, 0x4D, 0x0B, 0x44, 0x2D, 0xE6, 0x32, 0x87, 0x79, 0x9C, 0x20,
-    0x16, 0x13, 0xAE, 0x6D, 0x7C, 0xBD, 0xF2, 0xA6, 0x85, 0x90, 0x7E, 0x31, 0xE6, 0x49, 0x22, 0x29,
-    0x72, 0xA2, 0x4E, 0xEA, 0xC6, 0xA0, 0x5D, 0x20, 0x33, 0x9A, 0x77, 0x42, 0x2C, 0x93, 0xF6, 0xE7,
-    0x3F, 0x44, 0xAA, 0xBB, 0x43, 0x74, 0xBD, 0x8F, 0xA1, 0x6B, 0x37, 0xFF, 0x6D, 0x40, 0x12, 0x9D,
-    0xF4, 0x43, 0x56, 0xA5, 0x50, 0xAA, 0xAF, 0xB8, 0x1E, 0x37, 0xE7, 0xEF, 0xB5, 0x19, 0x9E, 0x8D,
-    0xE6, 0xDF, 0x8D, 0x7B, 0x84, 0xFE, 0xE5, 0x8F, 0xFD, 0x82, 0xEC, 0x3A, 0x9E, 0x0B, 0xC4, 0x4B,
-    0xC8, 0x96, 0xBA, 0xE6, 0x0E, 0x48, 0x8A, 0xBD, 0xED, 0x9F, 0xAF, 0x1B, 0x2B, 0x69, 0x92, 0xE0,
-    0x95, 0x1F, 0x58, 0xF6, 0xC5, 0x95, 0xE3, 0x90, 0x7E, 0x65, 0xF6, 0x95, 0xAC, 0x1E, 0x2C, 0xCB,
-    0xFB, 0xDE, 0xC3, 0xBB, 0x96, 0x87, 0x13, 0x64, 0xCB, 0x08, 0x9C, 0x94, 0x7C, 0x55, 0x88, 0x52,
-    0xD7, 0xA6, 0x51, 0x3E, 0x47, 0x04, 0x8E, 0x17, 0x8A, 0x22, 0x9D, 0x78, 0xCD, 0x07, 0x5E, 0xCB,
-    0x9E, 0x57, 0xF8, 0xF9, 0x81, 0x6E, 0x20, 0x27, 0xC4, 0x32, 0x18, 0x4F, 0xFD, 0xD9, 0xF9, 0xA8,
-    0xD5, 0x05, 0xCD, 0xB8, 0x1E, 0xB3, 0x8E, 0x49, 0x09, 0xDE, 0x4C, 0x29, 0xE5, 0x73, 0x46, 0xE0,
-    0x5C, 0x08, 0x71, 0xF9, 0xD2, 0xC8, 0xC1, 0x51, 0xE7, 0xEE, 0x39, 0x43, 0x75, 0x03, 0x09, 0xDB,
-    0x0C, 0x66, 0x05, 0x09, 0xA0, 0xB7, 0xD9, 0x63, 0x8D, 0x48, 0x98, 0x8C, 0x68, 0x10, 0x30, 0xDA,
-    0x20, 0xE4, 0x7C, 0xEE, 0x5C, 0x9E, 0x8E, 0x76, 0x49, 0xAD, 0x8A, 0x7C, 0x70, 0x7D, 0x5C, 0x1F,
-    0x37, 0x8D, 0xF4, 0x51, 0x65, 0x0F, 0xA0, 0xC3, 0x07, 0x0C, 0x60, 0x59, 0xFF, 0xFE, 0x1F, 0xF9,
-    0x21, 0x51, 0xC2, 0x4E, 0xC0, 0x97, 0xFD, 0xF8, 0x5E, 0xB4, 0x09, 0xFA, 0x82, 0x23, 0x3D, 0xF9,
-    0xBB, 0xEE, 0x3F, 0x34, 0x56, 0x76, 0xCE, 0x74, 0x57, 0x0B, 0xB4, 0xA2, 0x6F, 0x24, 0xAD, 0x1F,
-    0xDD, 0x21, 0xCF, 0xF6, 0xE2, 0xE2, 0xC1, 0x05, 0xD7, 0xEA, 0x88, 0x0F, 0x32, 0x25, 0x85, 0x6B,
-    0x26, 0x87, 0xCC, 0x6F, 0x10, 0xBE, 0xFE, 0x1E, 0x24, 0xB9, 0xDE, 0xDC, 0x33, 0x43, 0xAE, 0xFD,
-    0x83, 0x57, 0x47, 0xAB, 0x0C, 0x54, 0xE2, 0xE3, 0x60, 0x5F, 0x5C, 0xA0, 0xD0, 0xD9, 0x97, 0xD8,
-    0x72, 0xEE, 0xD4, 0xAF, 0x36, 0x1B, 0xE8, 0x94, 0xAB, 0xD9, 0x48, 0x34, 0xA0, 0xE5, 0x20, 0x04,
-    0x5A, 0x7B, 0x39, 0x1B, 0xC4, 0x10, 0xF4, 0x3D, 0x50, 0x26, 0x42, 0x55, 0x0D, 0x46, 0xAA, 0x4C,
-    0x43, 0x54, 0x48, 0x26, 0x73, 0x4F, 0xBD, 0xB4, 0x03, 0x9E, 0x61, 0x16, 0x2C, 0x97, 0x12, 0x3A,
-    0xC7, 0x60, 0x56, 0xF4, 0x59, 0x35, 0xC6, 0xC6, 0xDD, 0xB9, 0x05, 0x3B, 0x9E, 0xD9, 0xA6, 0xB8,
-    0x5E, 0xD8, 0x8A, 0x56, 0xD2, 0x88, 0x2D, 0xDB, 0xCC, 0x8D, 0x51, 0x8D, 0x11, 0x08, 0x4C, 0xBD,
-    0x0C, 0xA2, 0x5A, 0x65, 0x9C, 0x68, 0x57, 0xE9, 0xF2, 0xFA, 0x8D, 0x10, 0x6C, 0x85, 0x58, 0x56,
-    0xD9, 0x98, 0xD9, 0xA6, 0x2B, 0x7F, 0x7E, 0x66, 0x00, 0x79, 0xD0, 0x4C, 0x6D, 0x88, 0xDB, 0x76,
-    0xDE, 0x7C, 0xD1, 0x7E, 0x0B, 0x8A, 0xAC, 0x0A, 0xA2, 0xB8, 0x04, 0xF2, 0x3E, 0x3B, 0xBB, 0x21,
-    0x71, 0xF5, 0xC1, 0xAF, 0x95, 0x27, 0xD7, 0x7A, 0x2B, 0xDF, 0x50, 0x1E, 0x97, 0xB7, 0x71, 0x13,
-    0xE9, 0x09, 0x08, 0x65, 0x3E, 0x28, 0xF6, 0x67, 0x6B, 0xB2, 0x69, 0x20, 0x64, 0x65, 0x1C, 0xCB,
-    0x02, 0x54, 0xFA, 0x88, 0x57, 0xC1, 0x4C, 0x0F, 0x0F, 0x68, 0x07, 0xCD, 0x61, 0xA3, 0xCB, 0x36,
-    0x26, 0xD7, 0xA0, 0x24, 0x2E, 0x60, 0xB0, 0x06, 0x0C, 0xAA, 0x32, 0x4D, 0x2D, 0x2C, 0x8B, 0x82,
-    0x7D, 0x03, 0x72, 0xEF, 0xBC, 0x59, 0x99, 0x54, 0xED, 0xDA, 0x69, 0x23, 0x8B, 0x78, 0x26, 0x3F,
-    0x7D, 0xE1, 0xBE, 0xAD, 0xBA, 0x18, 0x77, 0x7E, 0x38, 0xAA, 0x5A, 0xBE, 0xB8, 0x6D, 0x62, 0x67,
-    0x79, 0x16, 0x32, 0xFB, 0xDD, 0x3F, 0x81, 0xA6, 0x1E, 0x13, 0xDD, 0x87, 0x2A, 0x42, 0x04, 0x1D,
-    0xFD, 0x98, 0x5F, 0xF8, 0xA5, 0xD1, 0x17, 0x38, 0x4A, 0x05, 0x1C, 0xB0, 0xD9, 0xA5, 0xFA, 0x9A,
-    0xC5, 0x5B, 0xC1, 0x8C, 0x01, 0x61, 0x56, 0x97, 0xCA, 0xFC, 0x46, 0xCD, 0x7E, 0x35, 0x0F, 0xE2,
-    0x5F, 0x66, 0x5A, 0x85, 0x44, 0x1A, 0x22, 0xC3, 0x00, 0x8D, 0x8F, 0x63, 0xB3, 0x76, 0xA9, 0xB1,
-    0x96, 0x1A, 0x94, 0x2D, 0xC2, 0x6A, 0x68, 0x1F, 0xE2, 0xAC, 0x1D, 0xC7, 0x0E, 0xB4, 0x0C, 0x8D,
-    0x8D, 0xA4, 0x55, 0x31, 0x6D, 0xC7, 0x81, 0xC4, 0xBF, 0x7E, 0x56, 0x07, 0xAD, 0xEA, 0x4C, 0xD3,
-    0xF6, 0x89, 0x29, 0x97, 0xC6, 0x82, 0xF6, 0xB5, 0xA2, 0x6C, 0x21, 0x8C, 0x70, 0xFB, 0xD0, 0xB6,
-    0x84, 0x63, 0x07, 0x06, 0x50, 0x1A, 0x1B, 0x19, 0x26, 0x24, 0x0A, 0x9D, 0x3E, 0x92, 0x20, 0x41,
-    0x24, 0xB4, 0x2B, 0x9B, 0x24, 0x1C, 0xD0, 0x09, 0x3C, 0x01, 0xA2, 0xF1, 0xFB, 0xA2, 0x58, 0xAD,
-    0x51, 0x11, 0x07, 0x6A, 0x08, 0xA7, 0xC0, 0xBD, 0x59, 0x51, 0x87, 0x76, 0xB3, 0xD0, 0x82, 0x76,
-    0x96, 0xEC, 0x5A, 0x9A, 0x7B, 0xF5, 0xCE, 0x9A, 0x50, 0x75, 0x47, 0xDF, 0xBA, 0x0B, 0x9C, 0x1F,
-    0x4F, 0x52, 0xB0, 0xA6, 0x7F, 0xEC, 0xF7, 0x22, 0xFC, 0x5E, 0x6D, 0xBA, 0x10, 0x54, 0x37, 0xA4,
-    0x7B, 0xF9, 0xE4, 0x36, 0x85, 0x09, 0x96, 0x10, 0x82, 0x6C, 0x13, 0xB6, 0x69, 0x55, 0x14, 0x7E,
-    0x1F, 0x8E, 0x06, 0x60, 0x7E, 0x4C, 0xCF, 0x47, 0xF7, 0xAE, 0x73, 0x32, 0xA5, 0x38, 0x21, 0xA6,
-    0x33, 0xE3, 0xA1, 0x2A, 0x0D, 0xC2, 0x11, 0xCE, 0xF2, 0xB5, 0xE6, 0xFE, 0x29, 0xEC, 0x15, 0x7D,
-    0x2A, 0x99, 0x32, 0xC6, 0x49, 0x66, 0x5E, 0x63, 0x2F, 0x5F, 0xE1, 0x6F, 0x2A, 0xC4, 0x7E, 0x4F,
-    0x73, 0x7E, 0x42, 0x32, 0xF2, 0xFB, 0xBC, 0xA6, 0x73, 0x08, 0x4D, 0xAD, 0x0E, 0xD8, 0xAF, 0x15,
-    0x2B, 0x2C, 0xAC, 0x02, 0x87, 0xAE, 0x99, 0xB0, 0x55, 0x01, 0x24, 0xF5, 0xCF, 0x6E, 0xF2, 0x56,
-    0x31, 0xA4, 0xF6, 0x7D, 0x4A, 0xE7, 0x9A, 0x4D, 0xA5, 0xC4, 0x9F, 0x0A, 0x43, 0xF6, 0xCA, 0x15,
-    0x0F, 0x39, 0xD5, 0x90, 0x40, 0xDD, 0x06, 0xE6, 0xC8, 0x5D, 0x2B, 0x46, 0x50, 0x61, 0x64, 0x59,
-    0x01, 0x23, 0x54, 0x62, 0x1F, 0xFD, 0x26, 0x83, 0xB4, 0x90, 0xE1, 0xF1, 0x6F, 0x53, 0x90, 0x5E,
-    0xEC, 0x2F, 0x6F, 0xCF, 0x02, 0xD9, 0x26, 0xD4, 0x2C, 0x16, 0x7E, 0x1B, 0x9A, 0x00, 0x36, 0xBD,
-    0xE2, 0xF3, 0x34, 0x94, 0xA6, 0x4B, 0x6A, 0xEC, 0xA2, 0x0C, 0x2A, 0x06, 0x23, 0x99, 0x9F, 0xE6,
-    0x72, 0x45, 0x54, 0x55, 0x6E, 0x6C, 0x9F, 0x5A, 0x14, 0xAD, 0x50, 0xAF, 0x94, 0x0B, 0xAC, 0xC8,
-    0x94, 0xC2, 0x62, 0xE0, 0xBB, 0xDC, 0x73, 0xF1, 0x99, 0x7F, 0x61, 0x01, 0x77, 0xFD, 0x07, 0x4B,
-    0xF3, 0x31, 0x42, 0xCA, 0x05, 0x72, 0x82, 0x20, 0x8B, 0xD1, 0xFB, 0x4F, 0x89, 0xA4, 0x48, 0x26,
-    0xDE, 0x25, 0x6A, 0x67, 0x7E, 0x86, 0x32, 0x15, 0x60, 0xCD, 0x27, 0x52, 0x3E, 0x8F, 0x11, 0x0C,
-    0x7F, 0xC7, 0x8F, 0x30, 0x90, 0x1C, 0x7E, 0xF5, 0x9F, 0xB9, 0x6C, 0x0F, 0xDF, 0xCA, 0xC8, 0xB7,
-    0xAD, 0x7B, 0x0E, 0x23, 0xFE, 0x7B, 0x9E, 0x2E, 0x8D, 0xC9, 0xC6, 0x5A, 0x3F, 0x60, 0x44, 0x75,
-    0x79, 0x4B, 0x65, 0x02, 0x2F, 0x95, 0xE7, 0xB6, 0x10, 0x76, 0x45, 0x20, 0xBF, 0xE8, 0x95, 0x69,
-    0x43, 0xD1, 0x12, 0xBA, 0xD0, 0x4E, 0x61, 0x67, 0xC3, 0x02, 0xFC, 0xE4, 0xE4, 0x48, 0x66, 0x79,
-    0x54, 0xCF, 0xC4, 0xD0, 0x95, 0x9F, 0x79, 0x72, 0xAF, 0xFE, 0x99, 0x57, 0x48, 0xFD, 0x89, 0x67,
-    0xD2, 0x8D, 0xB7, 0x17, 0x58, 0xFA, 0xFC, 0xA9, 0xFF, 0x07, 0xBA, 0xB0, 0x83, 0xFF, 0x98, 0xCE,
-    0xAB, 0xF5, 0xC6, 0x36, 0x2A, 0x47, 0x26, 0x89, 0x62, 0xAE, 0xAA, 0xC1, 0x94, 0x85, 0x57, 0x1A,
-    0x5D, 0xF2, 0xAD, 0x62, 0x8C, 0x4E, 0xA6, 0x36, 0xF6, 0x26, 0xE7, 0xBB, 0x0F, 0x48, 0xEB, 0xB6,
-    0x02, 0x75, 0x64, 0xF8, 0x13, 0xF9, 0xF1, 0x2A, 0xA6, 0xA3, 0x37, 0x2D, 0xB8, 0x89, 0x4E, 0x66,
-    0x44, 0xED, 0x03, 0xEA, 0x36, 0x96, 0x62, 0xD1, 0x22, 0x40, 0x1C, 0x73, 0xE6, 0xC8, 0x7C, 0x19,
-    0x7E, 0x94, 0xC8, 0xCB, 0x41, 0xF9, 0x2B, 0xB6, 0x4F, 0x8C, 0x86, 0xCD, 0x94, 0xBD, 0xDD, 0x33,
-    0x49, 0x31, 0x64, 0x44, 0xBE, 0x27, 0x6B, 0x76, 0xCA, 0xAB, 0xFF, 0xEE, 0xA5, 0xB5, 0x34, 0x1F,
-    0xB0, 0xD7, 0xBB, 0x80, 0x47, 0x86, 0x44, 0x7B, 0xF3, 0x76, 0xFB, 0xCD, 0x03, 0x23, 0x13, 0xFD,
-    0xEF, 0x53, 0x7B, 0xBA, 0xBC, 0xBC, 0x90, 0x75, 0x0C, 0xBA, 0x43, 0x81, 0x03, 0xFD, 0xFA, 0xEC,
-    0xCE, 0x95, 0x40, 0x21, 0x1D, 0xA6, 0xB4, 0xA9, 0xC7, 0x70, 0xC1, 0xB9, 0x3C, 0xB3, 0x7F, 0xFF,
-    0xDC, 0x40, 0xD7, 0x56, 0x56, 0xF2, 0x34, 0x07, 0xB7, 0x9F, 0x07, 0x9F, 0x7A, 0x7F, 0x45, 0x0F,
-    0x43, 0x8A, 0xA6, 0xDF, 0x42, 0x3A, 0xF3, 0x00, 0xCD, 0x70, 0x1C, 0x10, 0x4B, 0x9B, 0x47, 0x32,
-    0x9D, 0x73, 0x01, 0x49, 0x62, 0x18, 0x50, 0x6C, 0xE8, 0xA0, 0xE8, 0x61, 0x48, 0x04, 0xCD, 0x0A,
-    0x1D, 0x8A, 0x59, 0x00, 0x44, 0x40, 0x63, 0xF6, 0xB8, 0xC5, 0x03, 0x78, 0x13, 0xFC, 0x94, 0xBD,
-    0xF1, 0xB5, 0x17, 0xEB, 0xEA, 0x4E, 0x30, 0xD6, 0x1C, 0xC4, 0x73, 0xF8, 0x11, 0x95, 0x1C, 0xF8,
-    0xF6, 0x0D, 0x90, 0x8B, 0xC1, 0xE6, 0x0D, 0xA6, 0x66, 0xAF, 0xAF, 0xF1, 0x1A, 0x56, 0xCF, 0x0C,
-    0xD0, 0x13, 0x0B, 0x1A, 0x42, 0xF4, 0xE3, 0xC4, 0x70, 0xCB, 0x8C, 0xAC, 0xA1, 0x10, 0xE2, 0x29,
-    0x83, 0xBF, 0x3A, 0x84, 0x5A, 0x16, 0xB1, 0x3D, 0x7D, 0xF9, 0x7D, 0xFD, 0x74, 0x4F, 0x8C, 0x56,
-    0x58, 0x29, 0x46, 0x9F, 0xBD, 0xDC, 0x33, 0x3D, 0x2D, 0x0E, 0x4C, 0xFF, 0x99, 0x28, 0x57, 0xF8,
-    0xC6, 0x22, 0x96, 0x38, 0xDF, 0x30, 0x09, 0x49, 0x8D, 0xAF, 0x7D, 0xE8, 0x7E, 0x88, 0xC5, 0x9B,
-    0x67, 0xA7, 0x76, 0xCF, 0xF2, 0x15, 0x7B, 0x60, 0x0A, 0x72, 0x03, 0x16, 0x05, 0xB0, 0x5D, 0xC8,
-    0xA6, 0xCD, 0xE4, 0x75, 0x60, 0x60, 0x7E, 0x8C, 0x39, 0x76, 0x80, 0x9D, 0xE5, 0x54, 0x66, 0x77,
-    0xF6, 0xE2, 0xEE, 0xEC, 0x24, 0x27, 0x4B, 0x95, 0xC2, 0x16, 0x06, 0x73, 0x52, 0x83, 0x52, 0xD4,
-    0xC1, 0x77, 0xFF, 0x59, 0x48, 0x38, 0x5C, 0x3A, 0x1F, 0xBD, 0x45, 0x70, 0x10, 0xF5, 0x6C, 0x81,
-    0xE3, 0x62, 0xE1, 0xFD, 0xE2, 0xD6, 0xA7, 0x23, 0xE3, 0x4F, 0x6A, 0x20, 0x6A, 0x6D, 0x01, 0x35,
-    0xCA, 0x9C, 0x6C, 0x61, 0x30, 0x4F, 0x78, 0x6F, 0x17, 0xC2, 0xEF, 0xD9, 0xF9, 0x2D, 0xDC, 0xB5,
-    0x66, 0xD3, 0xC8, 0xBC, 0x60, 0xB9, 0xB0, 0xA0, 0xD2, 0x4F, 0xD2, 0xE2, 0xD1, 0x7A, 0x31, 0xBA,
-    0xF6, 0xB5, 0x09, 0xC4, 0x2A, 0x31, 0xC1, 0xDF, 0xF8, 0x63, 0xE2, 0xB0, 0x06, 0x5D, 0xD5, 0x31,
-    0xE8, 0xB2, 0x40, 0x67, 0x39, 0xC9, 0x30, 0x27, 0xB7, 0x96, 0xAC, 0x82, 0x2B, 0xAC, 0x87, 0xA3,
-    0x27, 0x34, 0xE1, 0xC9, 0x51, 0x59, 0x4C, 0x6C, 0xC1, 0x70, 0xBC, 0xF6, 0xBA, 0x5A, 0x86, 0xC5,
-    0x29, 0xBD, 0xF3, 0x64, 0x5A, 0x38, 0x29, 0x82, 0x56, 0x08, 0xA2, 0xA7, 0xF3, 0x45, 0xE0, 0x15,
-    0xCC, 0xBF, 0x9C, 0x14, 0xEF, 0x94, 0xA3, 0x66, 0xA8, 0x07, 0xB9, 0xCD, 0x86, 0x1A, 0x55, 0x85,
-    0x70, 0x82, 0x9B, 0xC8, 0x16, 0xD1, 0x9F, 0xCD, 0xBA, 0x39, 0x97, 0x54, 0xED, 0x99, 0x2A, 0x3C,
-    0xB3, 0x93, 0x16, 0x3E, 0x60, 0xDA, 0x15, 0x94, 0xD1, 0xF2, 0x05, 0x7B, 0x53, 0xA1, 0xCF, 0x2F,
-    0x26, 0x80, 0xD1, 0x54, 0xF3, 0xE2, 0xD1, 0xAC, 0xB2, 0x54, 0x23, 0x29, 0x13, 0xEC, 0xDC, 0x54,
-    0x37, 0xAD, 0x55, 0x6D, 0xE7, 0x40, 0x40, 0x6A, 0x7A, 0xB2, 0xA8, 0xEE, 0xC3, 0xC2, 0x16, 0x47,
-    0xE0, 0xBF, 0x98, 0x43, 0xB1, 0x42, 0xDD, 0x4C, 0x9A, 0x2E, 0xF7, 0x5E, 0x2C, 0x64, 0x44, 0x8A,
-    0x69, 0x0E, 0xF8, 0xE1, 0x67, 0x12, 0xC8, 0x42, 0x05, 0x30, 0xE5, 0x36, 0xC3, 0xDD, 0x6D, 0x56,
-    0x62, 0x99, 0xA9, 0x29, 0x8B, 0x3C, 0xA5, 0x65, 0xC1, 0x62, 0x6F, 0x66, 0x0C, 0x7F, 0xEA, 0xD2,
-    0x00, 0xE9, 0x1F, 0x43, 0x88, 0x30, 0x1B, 0x52, 0xC4, 0xF0, 0x47, 0xA1, 0x7C, 0x91, 0x87, 0xE8,
-    0x79, 0xA7, 0x01, 0x10, 0x5F, 0x2C, 0x26, 0x41, 0x15, 0xF9, 0x2B, 0x70, 0x92, 0xB5, 0x17, 0xA8,
-    0x57, 0x87, 0x01, 0x10, 0x09, 0x01, 0x94, 0xF0, 0x0C, 0x93, 0x4C, 0xE2, 0x50, 0xFA, 0xB6, 0x61,
-    0x79, 0x04, 0x4E, 0x43, 0xD1, 0x12, 0xDC, 0xE8, 0x7B, 0xAA, 0xB4, 0x34, 0x7E, 0x11, 0xA3, 0x3F,
-    0xF6, 0xFE, 0x73, 0x75, 0x71, 0xFD, 0x07, 0xC1, 0xCE, 0xA6, 0x50, 0xAA, 0x62, 0x91, 0x71, 0xAF,
-    0xF2, 0x43, 0xA3, 0x8D, 0xFA, 0x29, 0xE5, 0xC6, 0x12, 0xB9, 0xD0, 0x56, 0x55, 0x84, 0xC4, 0x76,
-    0x3D, 0xD1, 0xC4, 0x08, 0x80, 0x6B, 0x61, 0x4C, 0xAA, 0x49, 0x4E, 0x2D, 0xC6, 0xFE, 0x5A, 0xBE,
-    0x8D, 0x62, 0xB5, 0x60, 0x60, 0x92, 0x06, 0xEF, 0x4C, 0x04, 0x60, 0x85, 0xA9, 0x69, 0xF3, 0x99,
-    0xB4, 0x38, 0x09, 0xDD, 0xC6, 0xD2, 0x87, 0x78, 0xCA, 0x87, 0xF4, 0xDA, 0x7C, 0xA6, 0x85, 0xD4,
-    0x21, 0xC9, 0x5B, 0x4B, 0x31, 0x51, 0x78, 0xC6, 0x7C, 0xD3, 0x9A, 0x6B, 0xA7, 0xF0, 0xD6, 0x6A,
-    0x83, 0xF5, 0xBA, 0xAB, 0x99, 0x15, 0x75, 0xC2, 0xD9, 0xD1, 0xA1, 0xE1, 0x33, 0x03, 0x05, 0x7A,
-    0x14, 0x4E, 0xCD, 0x1D, 0x78, 0x83, 0x55, 0x70, 0x53, 0xF2, 0xFD, 0x0E, 0x96, 0xC8, 0xD5, 0xC9,
-    0x05, 0x8C, 0x28, 0x76, 0x16, 0x9B, 0xD5, 0xD5, 0xA6, 0xC2, 0xD6, 0x0C, 0x33, 0xA8, 0x38, 0xF9,
-    0xCC, 0xA0, 0xBE, 0x7C, 0x60, 0x99, 0xD0, 0xBC, 0x92, 0x93, 0x06, 0x0D, 0xB0, 0xB8, 0x4B, 0x65,
-    0xCF, 0xF1, 0x51, 0x07, 0x30, 0x6E, 0x96, 0x76, 0xE2, 0x11, 0x8C, 0x8B, 0x79, 0xE8, 0x11, 0xD4,
-    0x27, 0x0A, 0x2F, 0x8C, 0xDA, 0x14, 0x3F, 0xF4, 0x02, 0xD4, 0x22, 0x46, 0x22, 0x17, 0xA2, 0x54,
-    0x1F, 0x22, 0xD3, 0x10, 0xCD, 0x2E, 0x06, 0x60, 0xC6, 0x2E, 0x2B, 0x73, 0x59, 0x61, 0x9F, 0x8C,
-    0x0F, 0x18, 0xA7, 0x95, 0x76, 0x01, 0xC7, 0x1B, 0xFB, 0xB1, 0x30, 0xCE, 0x66, 0x3E, 0x64, 0x72,
-    0xFE, 0x7D, 0xA4, 0x6F, 0x3B, 0x7F, 0xCC, 0x37, 0x42, 0x8A, 0xE6, 0x7D, 0xA0, 0xA9, 0xDF, 0x7C,
-    0x71, 0x13, 0x68, 0x93, 0x7E, 0x7F, 0x6F, 0x2D, 0x38, 0xC5, 0xDE, 0x2A, 0xF6, 0xD3, 0xDA, 0x37,
-    0xB1, 0xF4, 0xCD, 0x8A, 0x4C, 0x1A, 0x88, 0xFE, 0x4F, 0x03, 0x65, 0xBB, 0x95, 0x8C, 0x4E, 0x06,
-    0xAC, 0xD7, 0x63, 0x39, 0xEB, 0xC9, 0x80, 0x9D, 0x20, 0x28, 0x0F, 0xBF, 0xD2, 0x80, 0x95, 0xBC,
-    0xAC, 0x77, 0x73, 0x32, 0x90, 0x4C, 0x47, 0xFF, 0x26, 0x66, 0x27, 0xDA, 0x51, 0x11, 0x06, 0x0E,
-    0xC7, 0x86, 0xB2, 0xFB, 0x35, 0x77, 0x2B, 0x6E, 0x73, 0x37, 0x25, 0x7D, 0xD1, 0x36, 0xCF, 0xCD,
-    0xC9, 0x98, 0x77, 0xF5, 0x5F, 0xF9, 0x64, 0xCA, 0xFB, 0xB2, 0xF5, 0xF1, 0x9C, 0x0D, 0x65, 0xE7,
-    0x6F, 0x2E, 0x88, 0xAD, 0x7B, 0xFF, 0xCE, 0x92, 0xF5, 0x65, 0x35, 0x46, 0xED, 0x97, 0xDD, 0x57,
-    0x11, 0x98, 0xEC, 0x57, 0x9D, 0xAE, 0x43, 0x04, 0x7F, 0x6C, 0xB9, 0x49, 0x4A, 0x81, 0xAA, 0x76,
-    0x2B, 0xC7, 0x15, 0xDD, 0x71, 0xD7, 0xC3, 0xD6, 0x2D, 0x4B, 0x8E, 0xC4, 0x47, 0x27, 0x59, 0xF2,
-    0x09, 0x73, 0x4C, 0x04, 0x27, 0xB7, 0x3D, 0x79, 0xA5, 0xFA, 0xFF, 0xB7, 0x92, 0x6E, 0x13, 0xAB,
-    0x22, 0xB1, 0xCA, 0xC4, 0x2E, 0x26, 0xA5, 0x7E, 0xED, 0x4C, 0x94, 0xA1, 0x91, 0xA9, 0xC8, 0x11,
-    0x51, 0xF8, 0x82, 0x68, 0x04, 0x9C, 0x29, 0xDB, 0x64, 0xBA, 0x66, 0x1D, 0xCD, 0x10, 0x06, 0x31,
-    0x58, 0xC5, 0x5F, 0x72, 0x74, 0x88, 0xA4, 0xEA, 0xCA, 0x8B, 0x8C, 0x8A, 0x91, 0x3D, 0x36, 0x9D,
-    0x99, 0xE5, 0x51, 0x00, 0xF4, 0xD0, 0xA5, 0x65, 0xC9, 0x33, 0x0D, 0x73, 0x00, 0x69, 0x4D, 0x9B,
-    0x75, 0x3B, 0x1E, 0x97, 0x48, 0xA6, 0x98, 0x3D, 0x95, 0x1C, 0x46, 0x5F, 0xC1, 0xF3, 0xCC, 0x31,
-    0xD0, 0xA9, 0xCF, 0x5A, 0xDC, 0x50, 0xBF, 0x7E, 0xAE, 0x2A, 0xED, 0xA8, 0xB8, 0x4E, 0x95, 0x3B,
-    0x15, 0xEE, 0xD3, 0xAD, 0xE2, 0x1D, 0xAF, 0xDA, 0x2B, 0xEE, 0x90, 0x4F, 0xE2, 0x98, 0x0F, 0xED,
-    0x8C, 0x48, 0xA7, 0x00, 0x7E, 0x34, 0x5B, 0x1E, 0xC7, 0x8E, 0x08, 0x69, 0xAE, 0x9A, 0xE5, 0x5B,
-    0xEA, 0xFF, 0xC3, 0xF1, 0xEC, 0x26, 0xB6, 0xC1, 0xEE, 0xFA, 0x2A, 0x62, 0x09, 0xAF, 0xBE, 0xC9,
-    0x46, 0x41, 0x39, 0x10, 0x47, 0x3C, 0x8F, 0xD1, 0x58, 0x69, 0x8E, 0x4F, 0xB6, 0xC6, 0xAD, 0x3F,
-    0x3F, 0x06, 0x87, 0xAC, 0xE9, 0x2D, 0x76, 0xC6, 0x60, 0x99, 0xE8, 0xF1, 0x29, 0x96, 0x34, 0x1C,
-    0xF8, 0x21, 0xD7, 0x59, 0x1F, 0xD4, 0x4B, 0x18, 0xF6, 0x7B, 0xEA, 0x13, 0x82, 0xFE, 0x56, 0x25,
-    0xE4, 0x50, 0x72, 0x4F, 0x7F, 0x81, 0x65, 0xB8, 0x47, 0x06, 0xEA, 0xCE, 0x07, 0xD7, 0x16, 0xC9,
-    0xF5, 0x2A, 0x22, 0xDD, 0xF9, 0xEF, 0xB2, 0x02, 0x3F, 0xD0, 0xFD, 0x34, 0x55, 0xA2, 0x66, 0x03,
-    0xD0, 0x31, 0x3F, 0x28, 0xD4, 0x67, 0xC0, 0x64, 0x03, 0x59, 0xAF, 0x38, 0xE0, 0x41, 0xA3, 0x34,
-    0x4B, 0x47, 0x30, 0x56, 0xC8, 0x68, 0xAD, 0x13, 0xB5, 0xA6, 0xCA, 0xEE, 0xFA, 0xFD, 0x80, 0x50,
-    0xA9, 0x7A, 0x3F, 0x63, 0xC2, 0x9A, 0x62, 0x04, 0xAC, 0xFD, 0xFB, 0x66, 0xDC, 0xC4, 0x31, 0x92,
-    0x93, 0x60, 0xD4, 0xE5, 0x99, 0xB1, 0xDC, 0xCE, 0x25, 0x20, 0xE3, 0x57, 0x5D, 0x84, 0x7B, 0xB4,
-    0xF8, 0x7C, 0x6F, 0x49, 0xEC, 0x75, 0x05, 0x02, 0xC5, 0x23, 0x1D, 0xCB, 0xC1, 0xC4, 0x54, 0x30,
-    0x8C, 0xF8, 0xD1, 0x2D, 0x76, 0xF1, 0xC8, 0x9F, 0x5C, 0xAD, 0xAE, 0x87, 0x9B, 0x96, 0x3C, 0x36,
-    0x91, 0x5A, 0xD3, 0x52, 0x91, 0x13, 0x8B, 0x03, 0x2A, 0xFA, 0x9A, 0x3B, 0x0B, 0xDA, 0x16, 0x2D,
-    0x89, 0x22, 0xFF, 0xFA, 0xA0, 0x90, 0x19, 0xC3, 0x1F, 0x53, 0x5D, 0x06, 0x42, 0x7A, 0x5D, 0xB1,
-    0x94, 0x33, 0xAA, 0x50, 0xD1, 0xF2, 0xFE, 0xB7, 0x39, 0x39, 0xB6, 0x45, 0xE6, 0xA8, 0xA8, 0x52,
-    0xEE, 0xF3, 0x95, 0x39, 0x96, 0x48, 0xA4, 0x82, 0x76, 0xEB, 0x15, 0x65, 0xF2, 0x21, 0x57, 0x3F,
-    0xB4, 0x98, 0x6E, 0x0A, 0x5D, 0xE6, 0x98, 0x1C, 0x77, 0xC5, 0xE7, 0xC4, 0x68, 0x1F, 0x58, 0x36,
-    0x86, 0xFE, 0x9A, 0x7B, 0x29, 0x98, 0x80, 0x9D, 0x95, 0xA9, 0x82, 0x40, 0x65, 0x95, 0xB2, 0x60,
-    0x29, 0x6F, 0x7A, 0x3C, 0xD4, 0xF1, 0x29, 0x78, 0x54, 0x84, 0xD3, 0x4D, 0xF4, 0xE1, 0x77, 0x90,
-    0x80, 0x0D, 0x11, 0xB3, 0xCB, 0x88, 0x6D, 0xE2, 0x88, 0x07, 0xA6, 0xE2, 0x91, 0x12, 0x1D, 0xD9,
-    0xE8, 0x19, 0xD8, 0xA4, 0xEA, 0xA9, 0xBE, 0x7D, 0xCE, 0xCA, 0x24, 0x73, 0xBA, 0xAE, 0x64, 0x5B,
-    0x0E, 0x9E, 0x10, 0x71, 0x06, 0xB2, 0xB8, 0xF6, 0xEA, 0x0F, 0x76, 0x37, 0x8C, 0x52, 0x32, 0x90,
-    0xA9, 0x65, 0x08, 0x04, 0x21, 0x88, 0xB3, 0xEA, 0x24, 0x2A, 0xFB, 0xFD, 0xBD, 0xC8, 0x81, 0xF9,
-    0xB3, 0xE1, 0xE0, 0x65, 0x47, 0x3C, 0x41, 0x00, 0xD1, 0x70, 0x1C, 0x0A, 0x4A, 0xCE, 0x92, 0x1B,
-    0x83, 0x14, 0x55, 0xD9, 0xB0, 0x0A, 0x5A, 0x57, 0xDF, 0x36, 0x4B, 0x1C, 0xD6, 0xEE, 0xA5, 0x5F,
-    0x19, 0x54, 0xF6, 0x4F, 0x3E, 0xC1, 0xB6, 0xA1, 0x12, 0xBB, 0x1A, 0x62, 0x82, 0x34, 0x88, 0xD0,
-    0x13, 0xFD, 0x4A, 0xDF, 0xCA, 0xC7, 0x7E, 0x13, 0x3F, 0x65, 0x67, 0x64, 0x3C, 0xE5, 0x95, 0x92,
-    0xF9, 0xCA, 0x94, 0x5F, 0xB9, 0xD8, 0xA4, 0xC0, 0xFB, 0x65, 0x66, 0x3C, 0xAB, 0x71, 0xC4, 0x8E,
-    0xE1, 0x21, 0xC8, 0x20, 0x8E, 0xBD, 0xE3, 0xB1, 0x5F, 0xF0, 0xA9, 0x41, 0xB4, 0xC6, 0xBA, 0xCC,
-    0x8E, 0xF6, 0x51, 0x28, 0x93, 0xE5, 0xE9, 0x26, 0x45, 0x9D, 0xCA, 0x85, 0xC0, 0xFD, 0xCF, 0x19,
-    0xEA, 0x95, 0x2C, 0xA2, 0xFB, 0x39, 0x59, 0xA0, 0xD7, 0x0D, 0xC3, 0x3C, 0xE7, 0x1E, 0x68, 0x76,
-    0x9E, 0xA8, 0xEA, 0xC9, 0xBC, 0x48, 0x4D, 0xBF, 0x93, 0xA1, 0x49, 0xAA, 0xC0, 0x32, 0x76, 0x4B,
-    0x2C, 0x07, 0x63, 0xE3, 0x49, 0xD4, 0x81, 0x52, 0x98, 0x3B, 0x38, 0x94, 0x32, 0x22, 0x64, 0x8E,
-    0xC2, 0x3A, 0x40, 0x7E, 0x02, 0xA8, 0x2E, 0xFF, 0x74, 0xA9, 0xB8, 0x07, 0xE8, 0xDC, 0xDF, 0x6C,
-    0x8E, 0x9F, 0x7D, 0xDA, 0x3B, 0x7E, 0x69, 0xA0, 0xDD, 0x3D, 0xE0, 0x4D, 0x68, 0x50, 0x8C, 0x91,
-    0xC5, 0x49, 0x6D, 0xC6, 0x0B, 0x4C, 0xA9, 0x6C, 0xA1, 0x37, 0xAC, 0x61, 0x5B, 0xA7, 0x33, 0xA3,
-    0x6A, 0x61, 0xA4, 0xEC, 0x78, 0x41, 0xBE, 0x5A, 0x29, 0x69, 0xD5, 0x30, 0x74, 0xAB, 0xEE, 0x11,
-    0x67, 0xD5, 0xD8, 0xE0, 0x9E, 0x49, 0x2C, 0xB2, 0x53, 0x1E, 0x74, 0x9B, 0x42, 0x39, 0x8E, 0x12,
-    0xF8, 0x77, 0x6C, 0x20, 0x0F, 0x85, 0xE3, 0xDE, 0xF2, 0xB6, 0x66, 0x48, 0xD8, 0x3B, 0x8D, 0x71,
-    0xC1, 0xC6, 0x23, 0xAA, 0x2A, 0xE4, 0x93, 0xF1, 0x92, 0xF7, 0x30, 0xE2, 0x82, 0x4A, 0x5B, 0xF6,
-    0xF9, 0x88, 0x89, 0xA1, 0xB4, 0x0A, 0x3B, 0x59, 0x95, 0x89, 0x18, 0x1C, 0x2B, 0x1C, 0x3B, 0x1F,
-    0x82, 0x37, 0x2F, 0x88, 0x4E, 0xCD, 0x03, 0xDF, 0x31, 0xD0, 0x66, 0x16, 0x9D, 0xF7, 0x09, 0xB1,
-    0x0C, 0x3E, 0x33, 0xEF, 0x95, 0xA3, 0x82, 0x4D, 0x45, 0x07, 0xF6, 0x95, 0x07, 0xF5, 0x42, 0x44,
-    0x7C, 0x19, 0x9A, 0xE0, 0x8B, 0xD5, 0x9E, 0xB3, 0x00, 0x74, 0x7B, 0xEB, 0x1E, 0xF3, 0xEF, 0xDB,
-    0xF2, 0x4A, 0xB5, 0xC5, 0x0B, 0x7E, 0xB2, 0x8C, 0x45, 0x0A, 0x53, 0xD5, 0x0A, 0x09, 0xE3, 0x5E,
-    0xF9, 0x58, 0xA9, 0xCC, 0x2D, 0x36, 0x80, 0xA9, 0x05, 0x3F, 0x69, 0xA7, 0x24, 0x69, 0x56, 0x63,
-    0xA2, 0xDE, 0x7A, 0x1D, 0x8D, 0xF0, 0xC6, 0xDA, 0x1F, 0x91, 0xF5, 0x9A, 0xCA, 0xCF, 0xD5, 0xD6,
-    0x5C, 0xAE, 0x7E, 0xF8, 0x58, 0xCD, 0xF2, 0xA4, 0xA6, 0x69, 0xD9, 0xA0, 0x3B, 0xAD, 0x79, 0x3E,
-    0xDC, 0x93, 0x4B, 0x67, 0xEE, 0xD1, 0xFF, 0x24, 0xE0, 0x82, 0xEA, 0x80, 0xC5, 0x81, 0xFE, 0xEB,
-    0xC0, 0x86, 0x03, 0xFD, 0x2D, 0x08, 0x84, 0x44, 0x55, 0x63, 0x7E, 0x9B, 0x70, 0x59, 0x56, 0x80,
-    0x8A, 0x0C, 0x52, 0x6B, 0x63, 0x68, 0x44, 0x38, 0x05, 0x51, 0x04, 0x60, 0x5B, 0x2C, 0x19, 0xAA,
-    0xA2, 0xE5, 0xFC, 0x27, 0x87, 0x90, 0xF9, 0xC4, 0xC6, 0x03, 0x15, 0x24, 0x54, 0xA3, 0x60, 0xAF,
-    0xF2, 0xB7, 0x37, 0x12, 0xB2, 0x9F, 0x37, 0x4A, 0x9A, 0x76, 0xD6, 0x04, 0x02, 0x11, 0xCB, 0x1F,
-    0x0A, 0x8A, 0x89, 0x2A, 0x8A, 0x1B, 0xB9, 0xA3, 0xBA, 0x35, 0x1B, 0x64, 0x40, 0xB3, 0xF6, 0xEE,
-    0x8F, 0x7D, 0x7B, 0xDC, 0xFD, 0x74, 0x73, 0x72, 0xC8, 0xEF, 0x41, 0x25, 0x87, 0x18, 0xF9, 0xDB,
-    0x03, 0x0F, 0x77, 0x54, 0x3A, 0xA2, 0xB8, 0xB3, 0xB3, 0x63, 0x55, 0x08, 0x98, 0x53, 0x23, 0xEB,
-    0xE4, 0x28, 0x5D, 0x74, 0x40, 0x84, 0x0F, 0x2F, 0x36, 0xAD, 0x0E, 0x7A, 0xB1, 0xC6, 0xC7, 0xF5,
-    0x63, 0x1B, 0xEF, 0x2A, 0xFE, 0xAD, 0xCF, 0x48, 0x63, 0x4A, 0xED, 0x23, 0x6E, 0xBA, 0x89, 0x9B,
-    0x59, 0x5E, 0xBA, 0xF4, 0x97, 0x17, 0x74, 0x25, 0x74, 0xA9, 0xDE, 0xA0, 0xAA, 0x38, 0xF9, 0x78,
-    0xFF, 0x96, 0xB3, 0xAA, 0xB9, 0xCB, 0x15, 0x33, 0xF0, 0xF4, 0x07, 0x2C, 0x13, 0x78, 0x83, 0x40,
-    0x05, 0x2C, 0x1E, 0x75, 0xC4, 0x27, 0xA6, 0x02, 0x26, 0xAC, 0x0A, 0xB2, 0xB3, 0xDF, 0xA9, 0xED,
-    0x86, 0x0B, 0x83, 0x1A, 0xA6, 0x27, 0x34, 0x18, 0x55, 0x89, 0x55, 0xF1, 0x2A, 0xD6, 0x0E, 0x1A,
-    0xF5, 0x63, 0xB1, 0xAE, 0x94, 0xF2, 0x47, 0xD1, 0x48, 0x76, 0xF9, 0x6F, 0xAA, 0xD6, 0xCE, 0x5E,
-    0x1E, 0x1B, 0x87, 0xF5, 0x01, 0x00, 0x5F, 0x72, 0x26, 0x96, 0x95, 0xD8, 0x50, 0xCC, 0xE6, 0x9C,
-    0x65, 0xC8, 0xD7, 0xC6, 0xD0, 0x2C, 0x57, 0x67, 0xDA, 0xB2, 0x09, 0xEF, 0xD7, 0xFC, 0x2B, 0xB3,
-    0x8A, 0x6E, 0x1F, 0x70, 0x2D, 0xF2, 0xB9, 0xF0, 0xEE, 0x5B, 0x8A, 0x8D, 0x10, 0xE3, 0x5C, 0xC3,
-    0xC4, 0xF5, 0xA1, 0x68, 0xCB, 0x2E, 0x1F, 0x8A, 0xA1, 0xE8, 0x13, 0xA4, 0xB7, 0x19, 0x5C, 0xFA,
-    0xCB, 0xFE, 0x5D, 0x98, 0xF4, 0xC7, 0xFE, 0xF3, 0xC5, 0x0A, 0x1E, 0x96, 0x39, 0xE8, 0xB8, 0x89,
-    0x52, 0x31, 0x2B, 0xAA, 0x7D, 0xA0, 0x94, 0xE2, 0x3F, 0x95, 0xA4, 0xB1, 0x82, 0x6A, 0xD8, 0xE0,
-    0x9E, 0xBA, 0x15, 0x5D, 0x86, 0xD2, 0x4C, 0x46, 0xE7, 0x62, 0xA7, 0x32, 0xEF, 0x0A, 0x87, 0xFF,
-    0xC3, 0x32, 0xEF, 0x71, 0x4B, 0xB3, 0x0B, 0x6B, 0xEF, 0x58, 0xCA, 0x1C, 0xEA, 0x96, 0x95, 0x6C,
-    0xBD, 0xD5, 0x71, 0x07, 0x56, 0x28, 0x7B, 0x59, 0x6B, 0x5B, 0xEB, 0x5C, 0x01, 0x1C, 0x15, 0x9B,
-    0x1C, 0x8B, 0x1A, 0x4D, 0xB1, 0x4E, 0x65, 0x40, 0xA2, 0x72, 0x7A, 0x4E, 0xA8, 0xC5, 0x1A, 0xA6,
-    0xAC, 0xD0, 0x29, 0x0B, 0x7B, 0x5E, 0x71, 0xCC, 0x5F, 0x2B, 0xEF, 0x7F, 0x77, 0xDC, 0xEA, 0xEC,
-    0x96, 0x0E, 0x34, 0x76, 0x0A, 0xD1, 0xDA, 0xDA, 0xCB, 0xB1, 0xFB, 0x63, 0xCD, 0x01, 0x3B, 0x34,
-    0x26, 0x3B, 0x54, 0x69, 0x35, 0x0F, 0xE9, 0x84, 0x5C, 0x99, 0x92, 0xB0, 0xD2, 0x4E, 0x43, 0x8E,
-    0x0F, 0xF5, 0xC8, 0x43, 0x88, 0xD3, 0x19, 0xF6, 0x3D, 0x75, 0xA9, 0x94, 0x51, 0x05, 0x1D, 0xDD,
-    0xA8, 0x22, 0xA3, 0xEF, 0x43, 0xEB, 0x53, 0x52, 0x8F, 0x2C, 0xFD, 0x52, 0x6D, 0xF5, 0xFD, 0x33,
-    0x0B, 0xC1, 0x0C, 0x32, 0x54, 0x3D, 0x69, 0xD6, 0x42, 0xDE, 0x2B, 0xB7, 0xEC, 0x1C, 0x55, 0x62,
-    0x05, 0x80, 0xCE, 0x02, 0x34, 0x55, 0x61, 0xEB, 0x2E, 0x64, 0x08, 0xFA, 0x56, 0x86, 0x2E, 0xBB,
-    0xE0, 0x45, 0x8D, 0x6A, 0xBF, 0x84, 0xB4, 0x35, 0xB7, 0xE3, 0x15, 0xA7, 0x77, 0xEA, 0xBC, 0x4D,
-    0xB6, 0x3A, 0x68, 0x7D, 0x53, 0xF4, 0x5C, 0x3E, 0xB8, 0xA1, 0xC2, 0xBC, 0xE1, 0x40, 0x6C, 0xE5,
-    0xE4, 0x76, 0xDB, 0xE9, 0x8B, 0xB4, 0x83, 0x48, 0xC5, 0x41, 0xF8, 0xFA, 0x84, 0x41, 0x3A, 0xED,
-    0x16, 0x81, 0x26, 0xBC, 0x3E, 0x3C, 0x72, 0x59, 0xF1, 0xE8, 0x33, 0x56, 0x9A, 0x69, 0xC5, 0xBC,
-    0x71, 0xE4, 0x79, 0xE3, 0x54, 0x77, 0x65, 0x76, 0x57, 0xCB, 0xBB, 0x6A, 0xA7, 0x33, 0xD2, 0xEE,
-    0x77, 0x68, 0xB1, 0x56, 0xC2, 0xE0, 0x31, 0x2B, 0x3F, 0x6C, 0xE7, 0x38, 0xD7, 0xA4, 0xA8, 0x3E,
-    0x9C, 0x1E, 0xA6, 0xB5, 0x3D, 0x2B, 0x21, 0x53, 0xA2, 0xDD, 0x9A, 0x10, 0x23, 0x2B, 0x1B, 0xEF,
-    0xED, 0xF0, 0x5E, 0xBA, 0x05, 0x1E, 0xFA, 0x36, 0x9F, 0x7C, 0xBB, 0x72, 0x27, 0xB0, 0xD1, 0xD9,
-    0x91, 0x31, 0xDA, 0xDF, 0x56, 0x86, 0x8E, 0xBA, 0x67, 0xF2, 0xF1, 0xD9, 0x72, 0x7E, 0xEB, 0x2F,
-    0xEB, 0xE9, 0xAD, 0x62, 0xF8, 0xA1, 0x8E, 0x9B, 0xFD, 0x2F, 0xE5, 0x5B, 0x3D, 0xCC, 0xDD, 0xD6,
-    0x79, 0x3E, 0x24, 0x23, 0xB1, 0x08, 0xD1, 0xB2, 0x8B, 0x0A, 0xC4, 0x6E, 0xC1, 0x8E, 0x45, 0x00,
-    0x9B, 0x4B, 0x86, 0x0E, 0xB6, 0xC9, 0xD8, 0x28, 0x3C, 0x64, 0xB0, 0x06, 0x7D, 0x46, 0x11, 0x0F,
-    0xE9, 0x1A, 0x35, 0xA8, 0x96, 0x0E, 0x1D, 0x62, 0xF3, 0x26, 0x19, 0x32, 0x78, 0xA8, 0x1A, 0x44,
-    0x28, 0xD0, 0xA5, 0x1E, 0x5C, 0xA0, 0xF9, 0x3C, 0xC8, 0x43, 0x07, 0x23, 0x90, 0x44, 0xDA, 0x02,
-    0xDA, 0xC1, 0x43, 0xE9, 0xB8, 0xE9, 0x5A, 0xDA, 0x96, 0x9B, 0xD4, 0x05, 0x6A, 0x3A, 0x61, 0x62,
-    0x4A, 0x22, 0xF9, 0xF6, 0x7D, 0x9E, 0xF7, 0xF0, 0xFE, 0x28, 0xFA, 0x14, 0x3B, 0xAE, 0xD3, 0xDA,
-    0xBD, 0x1F, 0x3E, 0xF2, 0x5E, 0xF2, 0xF0, 0x9C, 0xF7, 0xFF, 0xEF, 0xBC, 0x74, 0x91, 0x8C, 0x2E,
-    0x95, 0xD6, 0x55, 0xE2, 0x02, 0x19, 0x5C, 0x2C, 0x8D, 0xCB, 0x16, 0xE7, 0xEA, 0xC1, 0x85, 0xFA,
-    0xF5, 0x84, 0x4F, 0xA0, 0xFF, 0x7F, 0xEE, 0x5C, 0xD2, 0xE8, 0x33, 0xCE, 0xA5, 0xA3, 0x73, 0x45,
-    0xCB, 0xAF, 0xC9, 0xE4, 0x5C, 0xDE, 0x39, 0x27, 0x1B, 0x17, 0xCD, 0x7A, 0xA7, 0x77, 0xAE, 0x6A,
-    0x5C, 0xA8, 0x13, 0x26, 0x83, 0x0E, 0xD2, 0x09, 0x75, 0x50, 0xA4, 0xE3, 0xB3, 0x56, 0xD7, 0x70,
-    0x2E, 0xD4, 0xB1, 0xBF, 0xB9, 0x9D, 0x36, 0xD2, 0x8B, 0x71, 0x63, 0xFF, 0x3A, 0xB7, 0x4B, 0x37,
-    0xCE, 0x5D, 0x18, 0x15, 0xA6, 0xC5, 0x15, 0x32, 0x3B, 0x91, 0x2B, 0xA1, 0x5C, 0x73, 0xF1, 0xFC,
-    0xB0, 0x4B, 0xC6, 0xAF, 0xBB, 0x74, 0xB8, 0xE2, 0xB2, 0x7E, 0x74, 0x45, 0x37, 0xD8, 0xFF, 0x7B,
-    0xBD, 0x2B, 0x7E, 0x3E, 0xEB, 0x50, 0x71, 0x99, 0xC8, 0x26, 0x16, 0x45, 0xAB, 0x5E, 0x76, 0x53,
-    0xA5, 0xA5, 0xAE, 0xAB, 0xCB, 0x9C, 0xDA, 0xC3, 0xE4, 0xAC, 0xFE, 0x87, 0x4A, 0x02, 0x3D, 0x88,
-    0x02, 0x2B, 0xA2, 0x48, 0xE7, 0x37, 0xE3, 0xD9, 0x45, 0x13, 0xC6, 0x15, 0x25, 0xC0, 0xEA, 0x31,
-    0xB2, 0x20, 0x84, 0x03, 0xBF, 0xF2, 0xAA, 0x3E, 0x84, 0x75, 0xC4, 0x45, 0x82, 0x67, 0x75, 0x59,
-    0x5D, 0x4B, 0x1F, 0x73, 0x86, 0xA8, 0x7D, 0x0D, 0x40, 0x44, 0x10, 0x16, 0x0B, 0xE8, 0x63, 0x18,
-    0x55, 0xE2, 0x81, 0x49, 0x29, 0xAE, 0x00, 0x26, 0x82, 0x19, 0x9C, 0xC3, 0x8C, 0x8A, 0xF6, 0x8B,
-    0x2E, 0x97, 0xB7, 0x46, 0x57, 0x8B, 0xA2, 0x5B, 0x61, 0x50, 0xBE, 0x80, 0x37, 0x9D, 0x4E, 0x58,
-    0x6F, 0xF4, 0x20, 0x65, 0xAD, 0x87, 0x6F, 0x2A, 0x79, 0xF5, 0x31, 0xCE, 0x53, 0x02, 0x84, 0xA6,
-    0xC0, 0x5C, 0xD9, 0xFB, 0x8B, 0x94, 0xC9, 0xC6, 0x7D, 0x1D, 0xFC, 0xF9, 0x6D, 0xE7, 0x8E, 0x1C,
-    0xFE, 0x8B, 0x5E, 0x97, 0x56, 0x62, 0xE0, 0xE8, 0xA4, 0x8B, 0xF4, 0x98, 0x4F, 0x38, 0x46, 0xF2,
-    0x4F, 0x7A, 0xC4, 0x5A, 0xA0, 0x0D, 0x8F, 0x21, 0x8F, 0xBA, 0x32, 0x8E, 0x29, 0xE0, 0xC5, 0x25,
-    0xC7, 0x41, 0x0D, 0x8F, 0x60, 0x28, 0x80, 0x73, 0x9F, 0xBF, 0xBC, 0x90, 0x20, 0x1C, 0x44, 0x2C,
-    0xDD, 0x79, 0x10, 0x1C, 0x18, 0x0E, 0x3C, 0xCE, 0x46, 0x9E, 0x12, 0x83, 0x30, 0x9F, 0xC3, 0x5D,
-    0x9D, 0x84, 0xD4, 0xBC, 0xEF, 0x79, 0xA3, 0xFF, 0x3F, 0xB8, 0xB4, 0x51, 0xD2, 0x06, 0xA3, 0x4B,
-    0xDA, 0xBD, 0x33, 0xE9, 0xB1, 0xFD, 0x24, 0xA5, 0x9B, 0x5C, 0xDC, 0xB9, 0x1C, 0x67, 0xE5, 0x46,
-    0xB6, 0x9E, 0x37, 0xEE, 0x2A, 0x65, 0x51, 0x3F, 0xF7, 0xDF, 0x24, 0xC8, 0x23, 0x56, 0xC3, 0x42,
-    0xD5, 0x5F, 0x5D, 0xD3, 0xDF, 0x6D, 0xA4, 0x80, 0x4D, 0x20, 0x46, 0x7A, 0x93, 0x70, 0x02, 0x1C,
-    0x82, 0x56, 0x01, 0x97, 0x74, 0xBE, 0x20, 0x65, 0x38, 0xBB, 0x78, 0x00, 0x4F, 0x0B, 0xF0, 0x34,
-    0xE9, 0x0D, 0xF6, 0x88, 0xA2, 0x90, 0x79, 0x8C, 0xC1, 0xEB, 0xFB, 0x41, 0x08, 0x95, 0x3A, 0xE7,
-    0x36, 0x90, 0xE2, 0xE2, 0x62, 0xD5, 0x83, 0x6C, 0x36, 0x14, 0xB7, 0x49, 0x0A, 0x08, 0x54, 0xB4,
-    0x44, 0x73, 0xAC, 0x7F, 0xE9, 0x9C, 0x4E, 0x99, 0xFE, 0x15, 0xFC, 0xAB, 0xA6, 0x33, 0xE7, 0xCE,
-    0x9C, 0x73, 0xA7, 0x67, 0x05, 0x63, 0x76, 0xD9, 0xAD, 0x39, 0x98, 0xDD, 0x98, 0xBE, 0xFB, 0x4A,
-    0x5F, 0xB5, 0xF1, 0x2B, 0x8B, 0xCB, 0xD3, 0xAB, 0x5F, 0x1C, 0xF2, 0x2A, 0x6B, 0x9E, 0x09, 0x21,
-    0xEA, 0xAD, 0xC3, 0xA2, 0x5F, 0x35, 0xFC, 0xFF, 0x2B, 0x92, 0x76, 0x78, 0xF8, 0xF7, 0xA2, 0xEB,
-    0xCD, 0x43, 0x5F, 0x88, 0xAF, 0xCB, 0x58, 0xC8, 0x66, 0x51, 0x02, 0x7E, 0x06, 0xC8, 0xFF, 0x81,
-    0xFB, 0x5D, 0x17, 0x0C, 0xEE, 0x8A, 0x42, 0x1E, 0x8F, 0xAE, 0x6A, 0xF3, 0x3E, 0x94, 0x40, 0x36,
-    0xD9, 0xA8, 0xBA, 0x58, 0x34, 0xAA, 0x8C, 0x75, 0xAB, 0x22, 0x50, 0xF7, 0x85, 0x6A, 0xCA, 0x94,
-    0xCD, 0x2E, 0x5D, 0x54, 0x16, 0xA2, 0x49, 0x75, 0x52, 0x89, 0xAD, 0x22, 0xFA, 0xA2, 0xFB, 0x43,
-    0xE7, 0x7E, 0x5F, 0x49, 0x94, 0x7F, 0xEF, 0x2C, 0x51, 0xD7, 0xFF, 0x09, 0xB2, 0x77, 0xE6, 0xC9,
-    0xCB, 0x93, 0x29, 0x77, 0xA6, 0x38, 0xE7, 0x4A, 0x87, 0x02, 0xFF, 0x1D, 0x20, 0x3A, 0x73, 0x74,
-    0x74, 0x04, 0x51, 0x86, 0x2C, 0xD4, 0x90, 0xD3, 0x3D, 0xAC, 0xA4, 0x1F, 0xD3, 0xE1, 0x3B, 0xFD,
-    0x33, 0xD7, 0x1F, 0x7F, 0xE5, 0xFD, 0x51, 0xB1, 0x6A, 0xC7, 0xE2, 0xAD, 0xBF, 0x6C, 0xEA, 0x27,
-    0x16, 0x27, 0x75, 0x17, 0x40, 0x49, 0x6A, 0x8A, 0x43, 0x70, 0x5C, 0xBF, 0xA6, 0xB2, 0x42, 0x6E,
-    0xE0, 0x73, 0x0E, 0xF2, 0x52, 0xAA, 0x90, 0xB5, 0xD0, 0xC5, 0x78, 0x49, 0xFA, 0x74, 0x88, 0x87,
-    0xAC, 0x4F, 0xFA, 0xAC, 0xCB, 0xFA, 0xFC, 0x96, 0x0A, 0xB8, 0xB2, 0x24, 0xA5, 0xC2, 0x29, 0x50,
-    0xF5, 0x45, 0xCA, 0xD1, 0x45, 0x77, 0xA0, 0x74, 0x09, 0x15, 0x14, 0x9C, 0xA2, 0x8E, 0x41, 0x00,
-    0x37, 0x21, 0xF5, 0xD3, 0x8F, 0xAA, 0xC1, 0xA4, 0xB4, 0x5F, 0x47, 0xB9, 0xCF, 0x5E, 0xBC, 0x9B,
-    0x81, 0x3B, 0xF3, 0xC7, 0x94, 0xF6, 0x16, 0x13, 0x2C, 0x64, 0x70, 0xB7, 0xDE, 0xFA, 0x33, 0x25,
-    0x63, 0xF4, 0x58, 0xEB, 0xD4, 0x08, 0x35, 0xE1, 0xA0, 0x3C, 0x94, 0x32, 0x97, 0x48, 0x38, 0xE3,
-    0x57, 0x55, 0xB5, 0x82, 0xA0, 0x73, 0x0F, 0xA8, 0x01, 0x54, 0x82, 0xA9, 0xD1, 0x79, 0x29, 0x97,
-    0xC7, 0xA4, 0xCB, 0x21, 0x3F, 0x2A, 0xAE, 0x69, 0x93, 0x76, 0xCA, 0xA6, 0x01, 0xB6, 0x23, 0x00,
-    0x17, 0x60, 0x1A, 0xE3, 0x09, 0x5F, 0x94, 0xCE, 0x38, 0x0E, 0x90, 0xC1, 0xAC, 0x07, 0x1E, 0x98,
-    0xA0, 0x07, 0xBD, 0xF5, 0x67, 0xD5, 0xE2, 0xA7, 0xEA, 0xBE, 0xFE, 0x54, 0xB1, 0xAC, 0x3A, 0x2A,
-    0x73, 0x9F, 0x28, 0xBD, 0x60, 0x40, 0xCA, 0x50, 0x56, 0x43, 0x24, 0x6A, 0x2E, 0x01, 0x73, 0x72,
-    0x1B, 0x84, 0x4D, 0xDF, 0x00, 0xE0, 0x59, 0xB3, 0xA5, 0x8F, 0xFB, 0xBC, 0xD7, 0xAC, 0xFB, 0x16,
-    0x35, 0xC1, 0xA9, 0xFC, 0x40, 0x17, 0x97, 0x09, 0x96, 0x45, 0xBE, 0xA5, 0x0B, 0xCB, 0x50, 0xC1,
-    0xAA, 0x50, 0x09, 0x3A, 0x4C, 0x38, 0xA7, 0x9D, 0x7E, 0x7D, 0x59, 0x59, 0x24, 0x63, 0xDE, 0xE8,
-    0xDC, 0xA0, 0x62, 0xD5, 0x17, 0x1B, 0x97, 0x2C, 0xAA, 0x35, 0x0A, 0x8C, 0x5A, 0xF1, 0x7C, 0x52,
-    0x40, 0x55, 0xC9, 0xC1, 0xDA, 0x9E, 0xD3, 0x86, 0x8A, 0x99, 0xC0, 0x6A, 0x29, 0xAD, 0x60, 0xC0,
-    0x9B, 0x4A, 0x01, 0x1D, 0x75, 0xDA, 0x4C, 0x1C, 0xA6, 0xED, 0x75, 0xDA, 0x0A, 0x0A, 0xA0, 0xC3,
-    0xA2, 0x25, 0x51, 0x4D, 0xC9, 0x55, 0x43, 0x54, 0x3B, 0x46, 0x15, 0xE4, 0x47, 0x14, 0xD7, 0x74,
-    0x39, 0x95, 0xBE, 0xA2, 0x20, 0xF4, 0x15, 0x09, 0x9F, 0x35, 0x69, 0x7B, 0xAA, 0x77, 0x0F, 0xB9,
-    0x07, 0xD5, 0x8A, 0x47, 0x4D, 0xA0, 0x98, 0x5F, 0x97, 0xEE, 0xE8, 0xAC, 0xB2, 0x53, 0xCD, 0xD4,
-    0xF8, 0x60, 0xDC, 0xFC, 0xC5, 0x03, 0x61, 0x37, 0xE6, 0x2A, 0x19, 0x89, 0x34, 0x26, 0x04, 0x44,
-    0xF4, 0x45, 0xF7, 0x05, 0xA7, 0xAC, 0xCA, 0x81, 0xBE, 0x42, 0x96, 0x0D, 0xA9, 0x22, 0xBC, 0x04,
-    0x4A, 0xB7, 0xAA, 0x55, 0x5A, 0xA6, 0x7D, 0xA2, 0xEE, 0x6F, 0x4A, 0xD4, 0x6B, 0x8C, 0xD9, 0x04,
-    0x2D, 0x19, 0xD4, 0x96, 0x29, 0xCD, 0x68, 0x68, 0xAF, 0xC1, 0x12, 0x3D, 0xA4, 0xDC, 0x54, 0xFD,
-    0xF8, 0x0D, 0xE5, 0xD8, 0xDF, 0x1B, 0xE9, 0x0C, 0x24, 0x6F, 0xFA, 0x44, 0x1F, 0x87, 0xDC, 0xF5,
-    0xEE, 0x31, 0x88, 0x00, 0xA8, 0x51, 0x9A, 0x18, 0xE2, 0xB2, 0xA2, 0x0D, 0xEF, 0x11, 0x43, 0x89,
-    0x36, 0xC6, 0x82, 0xD9, 0x24, 0x11, 0x97, 0xF1, 0x33, 0x6F, 0xE1, 0x29, 0xD5, 0x8A, 0xAB, 0xAD,
-    0x6F, 0xB3, 0xB2, 0x96, 0x2E, 0x5C, 0x02, 0xB5, 0xCF, 0x6A, 0xD8, 0xFB, 0xAC, 0xA7, 0xCD, 0x0A,
-    0xCD, 0x1C, 0xF7, 0xF9, 0xD3, 0x94, 0xDA, 0x47, 0x7F, 0x32, 0xD0, 0x0E, 0xE5, 0x29, 0x18, 0x2A,
-    0xDF, 0x54, 0x96, 0xC1, 0xF1, 0xE6, 0xB4, 0x3F, 0x75, 0x03, 0xB1, 0xD7, 0x9F, 0xC1, 0x97, 0xEB,
-    0xE7, 0x1C, 0xE4, 0x46, 0x59, 0xA1, 0x2E, 0x53, 0x1F, 0xE8, 0x4C, 0x79, 0xD5, 0xD0, 0x85, 0xCB,
-    0xEA, 0xC7, 0x3D, 0x46, 0xB1, 0xBF, 0x60, 0x28, 0x1D, 0x83, 0xAD, 0x06, 0x3C, 0x71, 0xD2, 0x73,
-    0x88, 0x25, 0xAB, 0x8D, 0x21, 0x55, 0x6C, 0xCC, 0x1B, 0x02, 0xFC, 0x15, 0xAB, 0xB4, 0xB5, 0x33,
-    0xD0, 0x52, 0x94, 0x9C, 0xDA, 0x30, 0x3D, 0x7F, 0xD9, 0xF0, 0x7A, 0x53, 0xE6, 0x44, 0x45, 0x32,
-    0xEB, 0x45, 0xB9, 0x06, 0xC4, 0x1E, 0xA6, 0x4B, 0x85, 0x16, 0x5E, 0xF5, 0x26, 0xB5, 0xF0, 0xE7,
-    0xBC, 0x31, 0x93, 0x83, 0x39, 0x94, 0x35, 0xA4, 0x35, 0x82, 0x8A, 0xDA, 0xCE, 0x01, 0xC4, 0x39,
-    0x86, 0x70, 0xB5, 0xC4, 0x2A, 0x80, 0x8E, 0x02, 0x3B, 0x68, 0x78, 0xB4, 0xC0, 0x54, 0x53, 0xA7,
-    0xDC, 0xA9, 0xA3, 0x73, 0xDE, 0x18, 0x83, 0x29, 0xB3, 0xC7, 0x8E, 0x16, 0xC0, 0x7D, 0xCE, 0x8D,
-    0xE6, 0xBE, 0xA3, 0xCE, 0x23, 0x51, 0x92, 0x4A, 0x2F, 0x4C, 0x5C, 0x3F, 0x55, 0x72, 0x43, 0x32,
-    0x0B, 0x9D, 0x26, 0xD3, 0x11, 0xFA, 0x3D, 0x58, 0xCC, 0xF7, 0x03, 0xE2, 0x52, 0x87, 0x08, 0x1D,
-    0xA6, 0x02, 0x9C, 0x94, 0x95, 0x7A, 0xBB, 0xBA, 0x9C, 0x95, 0x61, 0x9B, 0x64, 0x4C, 0xFB, 0xD3,
-    0x72, 0x43, 0xCD, 0x1B, 0xC9, 0x17, 0x4F, 0xE9, 0x35, 0x8A, 0x4B, 0x73, 0x13, 0xD4, 0x8B, 0xE6,
-    0xF4, 0x59, 0x5C, 0x2E, 0xD4, 0x1E, 0xD2, 0x47, 0xA4, 0xFF, 0xBA, 0x94, 0x88, 0x96, 0x68, 0x00,
-    0x55, 0x0D, 0x68, 0xA4, 0x54, 0xCB, 0x9F, 0xD4, 0xCB, 0x10, 0x50, 0x15, 0x29, 0x5A, 0x5E, 0x90,
-    0x1B, 0x12, 0x30, 0x1B, 0x45, 0x3C, 0xC7, 0xB8, 0x44, 0x8D, 0x89, 0x13, 0xD9, 0x3A, 0x57, 0x8A,
-    0x22, 0x07, 0xBB, 0x53, 0x67, 0xDD, 0x89, 0x9F, 0xAF, 0x81, 0xF5, 0x35, 0x59, 0xBC, 0x37, 0x01,
-    0xA4, 0x3A, 0x9D, 0xE9, 0xF2, 0x1B, 0x1C, 0x26, 0x1A, 0x51, 0xC6, 0x2C, 0x1B, 0x1F, 0x0D, 0x98,
-    0x24, 0xD2, 0x05, 0x24, 0xB6, 0x14, 0xE4, 0xC5, 0x8B, 0x29, 0x7E, 0x23, 0xF6, 0x23, 0xFD, 0xFF,
-    0x04, 0x57, 0x55, 0x13, 0xA4, 0xAC, 0x26, 0x87, 0x20, 0x67, 0x03, 0xDF, 0x82, 0xA0, 0x8F, 0x80,
-    0x9E, 0xDF, 0xF7, 0xEF, 0x36, 0x95, 0xC9, 0x9C, 0x47, 0xC1, 0x02, 0x0A, 0x97, 0xCD, 0x27, 0x60,
-    0x40, 0xE0, 0xD5, 0x0E, 0xD1, 0xAE, 0xF1, 0x89, 0x9C, 0xEB, 0x67, 0x46, 0x06, 0x21, 0x5A, 0xB7,
-    0x17, 0x72, 0x01, 0x30, 0x47, 0x0B, 0xFC, 0x57, 0x28, 0x58, 0x2A, 0x90, 0x47, 0xE9, 0x1F, 0x1A,
-    0x4C, 0x52, 0x37, 0xF9, 0x00, 0x29, 0x83, 0x0C, 0x15, 0x7D, 0x80, 0xE0, 0x68, 0x3E, 0x52, 0x61,
-    0x4B, 0xE9, 0x3E, 0x52, 0x1A, 0x54, 0xC6, 0x68, 0x0D, 0x8D, 0x6B, 0xCF, 0xE3, 0x0C, 0x0A, 0xC5,
-    0x52, 0x2A, 0xC9, 0x02, 0xD8, 0x28, 0x9D, 0x60, 0xAC, 0xA1, 0xE2, 0x62, 0xD0, 0xA5, 0x0C, 0x74,
-    0x42, 0x43, 0xAB, 0xB2, 0x4B, 0xB4, 0x19, 0xE6, 0x82, 0xCC, 0x07, 0x7D, 0xB8, 0x4F, 0xB2, 0x4F,
-    0x16, 0xC3, 0x38, 0xE1, 0x8F, 0xC0, 0xDC, 0x67, 0x41, 0xC4, 0x0D, 0xE5, 0x40, 0xC8, 0xA1, 0xE2,
-    0x4D, 0xE1, 0x83, 0xC0, 0xDC, 0xE3, 0x5C, 0xF4, 0xF8, 0x91, 0x4C, 0xA1, 0x40, 0xC4, 0x36, 0x94,
-    0x2E, 0x22, 0x9D, 0xC8, 0x91, 0x06, 0xDA, 0xF4, 0x25, 0x0D, 0x18, 0x25, 0x93, 0xC7, 0x9A, 0x97,
-    0x26, 0x5E, 0x42, 0xB0, 0x4A, 0x96, 0x18, 0xDA, 0x00, 0x22, 0x5B, 0x12, 0x28, 0x0B, 0x9D, 0x5F,
-    0x64, 0x56, 0xD1, 0x7C, 0x7B, 0xEA, 0x83, 0x43, 0xCA, 0x6B, 0xCD, 0xFB, 0x99, 0xC6, 0x39, 0xA4,
-    0x00, 0xCC, 0xC8, 0x19, 0xBA, 0xFB, 0x4F, 0x0E, 0x72, 0xEA, 0x77, 0x4C, 0x38, 0x1F, 0xA1, 0x7E,
-    0xBC, 0x8E, 0x6B, 0x45, 0x01, 0xE0, 0xE2, 0x37, 0x08, 0xE9, 0xD3, 0x49, 0xF7, 0xC9, 0xE5, 0xDC,
-    0x12, 0xD1, 0xBE, 0x2D, 0x74, 0x03, 0xC9, 0x9C, 0xCC, 0xB4, 0x04, 0xB4, 0x05, 0xF9, 0x94, 0xD3,
-    0xE4, 0x4F, 0x84, 0x9C, 0x01, 0xAC, 0xBB, 0xA7, 0x4E, 0x7A, 0x44, 0x23, 0x3B, 0x25, 0x5E, 0x8F,
-    0x2D, 0xF4, 0x2F, 0x7C, 0x06, 0x00, 0x63, 0xBE, 0xE2, 0x6A, 0x9A, 0xE9, 0x91, 0x55, 0x7B, 0xC7,
-    0x93, 0x61, 0xEB, 0x95, 0xD3, 0xA3, 0x1B, 0x69, 0x56, 0x37, 0xBA, 0x15, 0x5F, 0xD3, 0x4F, 0x8F,
-    0x30, 0x42, 0x35, 0x9C, 0x0C, 0x63, 0x53, 0x51, 0xE7, 0x51, 0x86, 0x24, 0x6A, 0x42, 0x6B, 0x38,
-    0xBB, 0x3D, 0x2D, 0x0D, 0x47, 0x83, 0x13, 0xF2, 0x1A, 0xDC, 0x26, 0x93, 0x67, 0x8B, 0x23, 0x17,
-    0xB7, 0x35, 0x8A, 0xEE, 0xDA, 0x3D, 0xB9, 0x1A, 0xCB, 0x0E, 0xD7, 0x50, 0xFA, 0x1D, 0x53, 0x2D,
-    0x17, 0x30, 0x44, 0xAB, 0x7F, 0x1E, 0xB7, 0x3C, 0xCD, 0x7B, 0x50, 0xC9, 0xB0, 0xD4, 0xB0, 0x63,
-    0x5A, 0x59, 0xAA, 0x94, 0x57, 0xED, 0x30, 0x14, 0x43, 0xF9, 0xE1, 0x53, 0xCB, 0xCA, 0x51, 0x1A,
-    0x1D, 0x8F, 0x1F, 0x59, 0xE9, 0x19, 0x0A, 0xAE, 0x54, 0x83, 0x21, 0x97, 0x0A, 0x20, 0x79, 0x76,
-    0x27, 0xAC, 0xEE, 0xE8, 0xF8, 0x58, 0xBC, 0xD8, 0x09, 0xD3, 0x31, 0xC7, 0xA8, 0xD0, 0xEE, 0xA6,
-    0x36, 0x33, 0xF9, 0xB1, 0x5C, 0x32, 0x53, 0xE4, 0x6F, 0xAD, 0x69, 0x30, 0x1F, 0x98, 0xD7, 0x98,
-    0x37, 0x7B, 0xCF, 0xF8, 0xA6, 0x0F, 0xBC, 0x26, 0x3F, 0x3C, 0xE2, 0x13, 0x9A, 0x83, 0x5A, 0xAE,
-    0x18, 0x4A, 0x68, 0x49, 0x9E, 0x0A, 0x4E, 0x68, 0xB9, 0xAC, 0x22, 0x11, 0x31, 0x19, 0x06, 0x23,
-    0x63, 0xF1, 0x2B, 0x34, 0x9E, 0xA2, 0x91, 0xCF, 0x78, 0x9D, 0x4B, 0xB6, 0xDF, 0x10, 0xA6, 0xCB,
-    0x11, 0x66, 0x46, 0x52, 0x6C, 0xE0, 0xC9, 0xFA, 0x2D, 0xD2, 0x35, 0x6B, 0x7E, 0x03, 0xA2, 0xF6,
-    0x2D, 0x9F, 0x57, 0x02, 0x55, 0xA3, 0x21, 0x79, 0xF7, 0x5A, 0xC5, 0xFD, 0xF2, 0x1F, 0xF4, 0x0D,
-    0x40, 0x25, 0xA7, 0xA3, 0x4D, 0xFD, 0x9C, 0x22, 0xD4, 0x9A, 0x77, 0x2E, 0x7B, 0xFF, 0xA6, 0xD0,
-    0x10, 0x49, 0xA3, 0x16, 0x55, 0xDB, 0x3B, 0x59, 0xF3, 0xB2, 0x5C, 0xDC, 0x59, 0x00, 0xB2, 0xDE,
-    0x8F, 0xBC, 0x58, 0xFB, 0xC1, 0x08, 0x0E, 0x14, 0x81, 0x7F, 0x39, 0xF5, 0x92, 0x51, 0x9B, 0x2E,
-    0x4F, 0xE7, 0xF3, 0x18, 0x67, 0xB2, 0x96, 0x18, 0xC4, 0xAD, 0x29, 0x45, 0xE2, 0xB3, 0x9F, 0x2B,
-    0x66, 0x5E, 0x36, 0xC6, 0x02, 0xA3, 0x35, 0xE5, 0xF3, 0x94, 0x5D, 0x3B, 0x04, 0x61, 0xDF, 0x7D,
-    0xF8, 0xD1, 0x9E, 0xA1, 0xFD, 0xCE, 0x6B, 0xC6, 0x72, 0x0F, 0x2F, 0x73, 0xFE, 0x58, 0xD7, 0x0D,
-    0xB7, 0xEA, 0x32, 0x10, 0x60, 0xCD, 0x3A, 0x96, 0x4B, 0x67, 0x57, 0x17, 0x9C, 0x72, 0xFD, 0x7C,
-    0xD8, 0xCD, 0x5B, 0xFC, 0xEC, 0xE8, 0x22, 0x39, 0xD4, 0xAE, 0x05, 0x01, 0xD2, 0x32, 0x20, 0xFF,
-    0x2D, 0x34, 0x88, 0x64, 0xA7, 0x16, 0xC9, 0x62, 0x9E, 0xE0, 0x48, 0xC3, 0xF4, 0x94, 0xD3, 0x67,
-    0x44, 0xBA, 0xD8, 0x3B, 0x56, 0x3C, 0xD6, 0xDB, 0xFC, 0xCA, 0xEA, 0x2B, 0x89, 0xA1, 0x61, 0x28,
-    0x6D, 0xB6, 0xA9, 0x5A, 0x38, 0xBB, 0x0F, 0xFF, 0xF9, 0x3F, 0x8A, 0x29, 0x97, 0x0C, 0x97, 0x9D,
-    0x09, 0x4A, 0x79, 0x3D, 0xA7, 0xDA, 0x56, 0x2F, 0xB3, 0x4C, 0xC1, 0xE8, 0xF3, 0x9C, 0x0B, 0xCE,
-    0x7E, 0x22, 0x30, 0x92, 0x0D, 0x66, 0x29, 0x3A, 0x44, 0xEC, 0xF9, 0x80, 0xB5, 0xCD, 0x85, 0x24,
-    0x92, 0x50, 0xDE, 0xAF, 0x63, 0xD1, 0xA3, 0xB3, 0x47, 0xF7, 0x88, 0x4B, 0x83, 0xE3, 0x17, 0x64,
-    0xF0, 0xA8, 0x39, 0x59, 0xCB, 0x34, 0xFA, 0x74, 0x7E, 0x0B, 0xB6, 0xC1, 0x70, 0xA3, 0xAF, 0x72,
-    0xA1, 0x49, 0xB7, 0x17, 0x7B, 0x22, 0x97, 0xD1, 0xD2, 0x25, 0x7C, 0xD8, 0x4A, 0x32, 0x86, 0x1D,
-    0x73, 0x87, 0xAD, 0x6E, 0x4C, 0x3B, 0xF4, 0x22, 0xB9, 0x84, 0x2C, 0xC1, 0x14, 0xB2, 0xDA, 0x2A,
-    0xAC, 0x05, 0x7F, 0xA3, 0xCF, 0xA3, 0x43, 0xF1, 0x86, 0xCE, 0x93, 0x15, 0xCB, 0xD3, 0xC7, 0xA1,
-    0x8E, 0x95, 0x4F, 0x77, 0xC5, 0x23, 0x7A, 0xC7, 0xA8, 0x09, 0x7F, 0x0A, 0x67, 0x0A, 0xC0, 0xD3,
-    0x13, 0x6A, 0x29, 0x08, 0x8A, 0xE0, 0x13, 0xC8, 0x12, 0x58, 0xF0, 0x0D, 0x71, 0x8B, 0xC4, 0xA6,
-    0x00, 0xED, 0x60, 0xE5, 0x41, 0x49, 0xE8, 0x35, 0xFC, 0x18, 0xFE, 0xD5, 0xEC, 0xB9, 0xF3, 0x96,
-    0x0D, 0x20, 0x0D, 0xA4, 0xDE, 0xD4, 0x5E, 0x69, 0x58, 0x99, 0x94, 0x0F, 0xA1, 0x23, 0x8F, 0x3C,
-    0xE7, 0xB9, 0xCF, 0x6C, 0x6B, 0xF6, 0x74, 0x25, 0xB9, 0x81, 0x7A, 0x36, 0x78, 0x33, 0x03, 0x98,
-    0x49, 0x7E, 0x00, 0x4D, 0x0F, 0x28, 0x3E, 0x5D, 0x03, 0xD8, 0x94, 0xB7, 0x68, 0x1D, 0x47, 0x6B,
-    0x0F, 0xC9, 0x00, 0xE4, 0x01, 0x0B, 0x83, 0x93, 0x77, 0x95, 0x80, 0xFD, 0xF4, 0x65, 0xDA, 0xDC,
-    0xD6, 0x43, 0x0A, 0x7B, 0x1E, 0x83, 0x7D, 0x14, 0xAF, 0xAE, 0x6E, 0x34, 0xD3, 0xA9, 0xCB, 0x73,
-    0x07, 0x51, 0xE2, 0xFF, 0x2E, 0xA8, 0xD1, 0xAC, 0x69, 0x7A, 0x02, 0x97, 0x9D, 0x4E, 0xBA, 0x5C,
-    0x86, 0xB8, 0x88, 0x51, 0x51, 0x35, 0xEA, 0xA0, 0x7B, 0xCB, 0x35, 0xE4, 0xC1, 0x96, 0xF3, 0x11,
-    0xD6, 0x9A, 0xE7, 0xD8, 0x81, 0x85, 0xE4, 0xC1, 0x99, 0x5C, 0x98, 0x9C, 0x32, 0x34, 0x02, 0xE8,
-    0x16, 0x55, 0x51, 0xCC, 0x01, 0x77, 0x60, 0x55, 0xDA, 0xD2, 0x4F, 0xC7, 0x03, 0xC1, 0x67, 0xC0,
-    0xCD, 0x88, 0x8D, 0xD6, 0xBF, 0x98, 0xD6, 0x03, 0x30, 0x58, 0x25, 0xA5, 0x92, 0xE5, 0xA2, 0xB9,
-    0x43, 0xCC, 0xE0, 0x43, 0xA8, 0x48, 0xB6, 0x96, 0x00, 0x0C, 0xA8, 0xA1, 0xD8, 0xFA, 0xAC, 0xD5,
-    0xFF, 0x01, 0x60, 0x31, 0xD0, 0x28, 0x30, 0xEB, 0xDE, 0x30, 0xCF, 0x63, 0x7D, 0xB5, 0x39, 0xAA,
-    0x6F, 0x9E, 0x53, 0x90, 0x59, 0x0E, 0x4E, 0xC7, 0x9C, 0xA5, 0xA7, 0x99, 0xEE, 0x35, 0x14, 0xAA,
-    0x08, 0x26, 0xD0, 0xE9, 0x62, 0x1D, 0x5E, 0x8C, 0xC1, 0x05, 0xE9, 0x2D, 0xF4, 0x30, 0x83, 0x85,
-    0x3C, 0xDD, 0x02, 0x35, 0xE7, 0x4F, 0x85, 0x6C, 0x6B, 0xC6, 0x8C, 0xF3, 0x0C, 0x58, 0x96, 0xDC,
-    0xB0, 0x31, 0xA0, 0x53, 0x7E, 0x8B, 0x01, 0xA3, 0xBC, 0xCA, 0xEC, 0xFA, 0x47, 0x24, 0x4A, 0xF2,
-    0x8A, 0xC5, 0x1E, 0xCD, 0xBD, 0x7C, 0x03, 0xB6, 0x22, 0x8E, 0x9F, 0xA3, 0x18, 0x00, 0x88, 0x89,
-    0x71, 0x52, 0x0A, 0x0C, 0x59, 0x65, 0x43, 0x9A, 0xA2, 0x54, 0x8F, 0x11, 0x62, 0x75, 0xBA, 0xF0,
-    0x04, 0xA2, 0xA7, 0x7A, 0x62, 0x01, 0x78, 0x0E, 0x68, 0x17, 0x16, 0x88, 0x55, 0xF1, 0xBE, 0x80,
-    0xE4, 0xD5, 0x4F, 0x05, 0x8C, 0x94, 0x9F, 0x08, 0x58, 0xA9, 0xA7, 0x27, 0x80, 0xCC, 0x1B, 0xF2,
-    0xB7, 0x23, 0x42, 0x02, 0x79, 0x17, 0x2E, 0xBF, 0xA1, 0x4D, 0xC6, 0x09, 0xF6, 0x64, 0x63, 0xB5,
-    0xC4, 0xB2, 0x46, 0xEC, 0x22, 0x2C, 0xB0, 0x17, 0x38, 0x69, 0xBC, 0x80, 0xBD, 0x0D, 0x87, 0x7D,
-    0x8A, 0xC2, 0x54, 0x36, 0xEF, 0x7D, 0x98, 0xE4, 0x43, 0xAE, 0xDE, 0xED, 0xCC, 0xF2, 0x5A, 0x3D,
-    0x77, 0x27, 0x04, 0x3B, 0x16, 0x2B, 0x30, 0xA8, 0x0A, 0x2C, 0xDA, 0xB0, 0xC2, 0x20, 0xB6, 0x38,
-    0x4E, 0x2B, 0x20, 0xA1, 0xFE, 0xE7, 0x56, 0x45, 0x41, 0xA9, 0x07, 0x32, 0x5F, 0xB7, 0x66, 0xC9,
-    0x46, 0xF0, 0x19, 0xF2, 0x09, 0x9B, 0xA6, 0x8C, 0xA6, 0x2C, 0xD5, 0xAD, 0x29, 0xC9, 0x40, 0xB9,
-    0x53, 0xC2, 0xD5, 0x2D, 0x41, 0x29, 0x7A, 0x1B, 0x43, 0xBD, 0x6A, 0x09, 0x9B, 0xF4, 0x20, 0x6A,
-    0xA0, 0xA4, 0xAC, 0xE4, 0xBB, 0x4F, 0xF9, 0xD2, 0xAB, 0xDA, 0x4F, 0xF2, 0x5A, 0x7C, 0x38, 0xB7,
-    0xA1, 0xEC, 0x71, 0xEF, 0xC1, 0xAC, 0xAA, 0x17, 0x45, 0x77, 0x41, 0x7E, 0x7C, 0x07, 0x32, 0x85,
-    0x45, 0x2F, 0xB9, 0x99, 0x5E, 0x8B, 0x05, 0x7C, 0x16, 0xED, 0xCB, 0xB7, 0xBE, 0xD6, 0xFB, 0x2B,
-    0x7C, 0x4E, 0x9B, 0xC7, 0xCA, 0x2D, 0x6A, 0xE4, 0x3E, 0xCB, 0x1A, 0x58, 0x2A, 0x23, 0x02, 0x24,
-    0x09, 0xFA, 0x0F, 0xBD, 0x82, 0xF6, 0x50, 0x7C, 0x69, 0x32, 0x40, 0x1A, 0x75, 0x1D, 0x66, 0x26,
-    0x36, 0xD4, 0xBB, 0xBA, 0x63, 0xCD, 0x4C, 0x6F, 0xD2, 0xBE, 0xCC, 0xB4, 0x4B, 0x4A, 0x34, 0x4B,
-    0x5C, 0x1A, 0x52, 0x08, 0x63, 0x3C, 0x15, 0x1B, 0x6A, 0x65, 0x05, 0x03, 0xBE, 0x28, 0x85, 0xDE,
-    0xFE, 0x1D, 0x5F, 0xAF, 0x55, 0x62, 0x04, 0xB2, 0xCB, 0xE1, 0xA4, 0xB3, 0xE0, 0xB8, 0x33, 0xBA,
-    0x59, 0xA0, 0xC8, 0x60, 0xF3, 0x7E, 0xB9, 0x75, 0x88, 0x4B, 0xB6, 0xD9, 0xA7, 0x85, 0x15, 0xF0,
-    0xD6, 0xC4, 0x3B, 0x14, 0x9F, 0x68, 0xC6, 0x96, 0x94, 0x30, 0xA0, 0xB8, 0x23, 0xF7, 0xFE, 0x54,
-    0x11, 0xC3, 0xBD, 0x64, 0x27, 0xB9, 0xDE, 0x59, 0xD4, 0x4C, 0x32, 0x58, 0xA2, 0xEE, 0xB2, 0x2F,
-    0xD1, 0xEB, 0xC7, 0xED, 0xB5, 0xFF, 0x1F, 0x92, 0x91, 0x8E, 0xF4, 0x2C, 0xF1, 0x12, 0x5B, 0x51,
-    0xEF, 0x31, 0xAB, 0x57, 0xB7, 0x56, 0x39, 0xEC, 0x69, 0x49, 0x7C, 0x5E, 0x7F, 0xEA, 0xE8, 0xD4,
-    0xD1, 0xC9, 0x51, 0x59, 0x3D, 0xFA, 0x6C, 0xAD, 0x5F, 0x77, 0x3C, 0x4D, 0x71, 0x61, 0x36, 0x64,
-    0x73, 0x41, 0xA9, 0x9A, 0x2F, 0x34, 0xF6, 0xD8, 0x38, 0x56, 0x2B, 0x92, 0x5A, 0xD8, 0x93, 0xD0,
-    0xEE, 0x6C, 0x48, 0x05, 0x6C, 0x58, 0x34, 0xB4, 0x32, 0x80, 0x15, 0xE5, 0xF6, 0x9E, 0xC2, 0x9A,
-    0x8D, 0x96, 0x1A, 0xCE, 0xAC, 0xE6, 0x91, 0x18, 0x18, 0xE3, 0x09, 0xD6, 0x33, 0xE5, 0xC9, 0x98,
-    0x3B, 0x6D, 0x62, 0xB9, 0xF9, 0x47, 0x6A, 0x3E, 0x8D, 0x18, 0x16, 0x7D, 0xAE, 0x1E, 0x65, 0x34,
-    0x33, 0x37, 0x9A, 0x0F, 0xB1, 0xCD, 0x5C, 0xE6, 0x71, 0xA7, 0x65, 0xD9, 0xEC, 0x61, 0x52, 0x75,
-    0xD8, 0x09, 0xFB, 0xD1, 0x62, 0x61, 0x86, 0xB3, 0xBA, 0x2B, 0x33, 0x43, 0x66, 0x84, 0x0D, 0x26,
-    0x55, 0xE6, 0x69, 0x26, 0x7D, 0xFE, 0xF9, 0xCF, 0x1E, 0xDF, 0x21, 0x19, 0x07, 0xFB, 0x44, 0xD5,
-    0xB8, 0xFF, 0x2B, 0x5F, 0xF6, 0x7F, 0xC5, 0xB2, 0xBF, 0x66, 0x20, 0xDD, 0xC9, 0x0F, 0x66, 0x72,
-    0xF8, 0x60, 0x73, 0xF0, 0xE0, 0x81, 0xA9, 0xAF, 0xA6, 0xFF, 0x81, 0x07, 0x2F, 0x2C, 0xD9, 0x5E,
-    0x56, 0x58, 0x7B, 0xC9, 0xF1, 0xE3, 0xD6, 0x4A, 0x81, 0xF3, 0x1A, 0x20, 0x3B, 0x97, 0x9A, 0x48,
-    0x97, 0xEF, 0xD6, 0x08, 0xB1, 0x8B, 0x3C, 0xED, 0xA3, 0xB4, 0x37, 0x4F, 0x6A, 0x7B, 0xF5, 0xDB,
-    0xA1, 0x9A, 0xF6, 0xEF, 0x28, 0x50, 0x0C, 0xA1, 0xDC, 0x5E, 0x76, 0xB3, 0xBA, 0x6A, 0xAE, 0xB7,
-    0x37, 0xB1, 0xBF, 0xF7, 0xA5, 0xED, 0x93, 0xE9, 0x14, 0x4B, 0xB7, 0x9D, 0x56, 0x95, 0x4A, 0xC6,
-    0x74, 0xBB, 0x66, 0x3E, 0x14, 0x12, 0x6C, 0x01, 0x8A, 0x24, 0x95, 0x26, 0xDF, 0x12, 0xB6, 0xF8,
-    0x29, 0xCA, 0xB4, 0xE5, 0x96, 0x36, 0xE8, 0x1C, 0xE8, 0xF7, 0xB0, 0x2C, 0xAB, 0x65, 0x47, 0x38,
-    0x79, 0xBB, 0xDE, 0x21, 0x56, 0x79, 0x29, 0xDA, 0xDE, 0x5C, 0xEB, 0x13, 0x56, 0x2C, 0xD9, 0xDF,
-    0x05, 0x8C, 0x0F, 0x86, 0x06, 0xE6, 0xEB, 0x0E, 0xE6, 0x29, 0x77, 0xBC, 0x7A, 0x76, 0x4F, 0x35,
-    0xE3, 0x03, 0x79, 0x08, 0xE4, 0x80, 0xAD, 0x95, 0x1C, 0x32, 0xB9, 0x39, 0x60, 0xF2, 0x01, 0x5B,
-    0x0F, 0x1F, 0x2C, 0x0E, 0x92, 0xFD, 0x74, 0x8F, 0xAD, 0x20, 0xCF, 0x81, 0x9F, 0x94, 0x9B, 0x07,
-    0x0F, 0x1E, 0x48, 0xE7, 0x6F, 0xFD, 0x92, 0xC2, 0xB4, 0x8F, 0x4D, 0x3C, 0x23, 0x7C, 0x88, 0xB2,
-    0x32, 0xE2, 0x5E, 0xA1, 0xC9, 0x1D, 0xC2, 0x5A, 0xC0, 0x3A, 0x6C, 0x20, 0x9A, 0xD8, 0x56, 0xA8,
-    0x27, 0x56, 0x36, 0x14, 0x4C, 0x9E, 0x7A, 0xD8, 0x11, 0x08, 0xB1, 0x8F, 0x54, 0x8A, 0x89, 0xC6,
-    0xA5, 0x18, 0x19, 0x92, 0x57, 0x03, 0x13, 0xE6, 0xBA, 0x67, 0x81, 0x83, 0xE6, 0x90, 0x86, 0x38,
-    0x5D, 0x08, 0x48, 0x3A, 0x9B, 0x25, 0x9A, 0x38, 0x8A, 0xCF, 0x94, 0xFE, 0x19, 0x4C, 0x19, 0xCB,
-    0xAD, 0xCB, 0xD2, 0x19, 0xF7, 0x5A, 0x3B, 0x35, 0x76, 0x2A, 0x19, 0x93, 0x2C, 0x66, 0x3B, 0x46,
-    0x63, 0xE2, 0x5D, 0xB7, 0x86, 0xD7, 0xC8, 0xA4, 0x36, 0xE4, 0x3D, 0x29, 0xC6, 0xFD, 0xC0, 0x24,
-    0x6F, 0xDD, 0x47, 0xFD, 0x7C, 0xC2, 0xA9, 0x64, 0x55, 0x2B, 0xDB, 0x0E, 0x5A, 0x4B, 0x59, 0x4E,
-    0x96, 0xBD, 0xA0, 0x24, 0x9E, 0x98, 0xF2, 0xA4, 0x3D, 0xF7, 0xD6, 0x4E, 0x95, 0x08, 0x4B, 0x3E,
-    0x95, 0x94, 0x30, 0x2F, 0x9C, 0x8E, 0x74, 0x75, 0x6A, 0xB8, 0x06, 0xDA, 0x41, 0x9E, 0xBC, 0x13,
-    0x96, 0x9E, 0xAA, 0x7D, 0xEF, 0x1C, 0xF2, 0xD3, 0xA3, 0x40, 0x56, 0x81, 0xE9, 0xB6, 0x7B, 0x63,
-    0xBE, 0xA7, 0xAA, 0xF9, 0x55, 0x2B, 0x7C, 0x87, 0x1F, 0xD6, 0x51, 0x5E, 0xC7, 0xF6, 0xE9, 0x82,
-    0x2A, 0x4F, 0xD5, 0x13, 0x13, 0xC4, 0x12, 0x4A, 0x72, 0xD1, 0x7C, 0x46, 0x03, 0x92, 0x4D, 0x8E,
-    0x4D, 0x12, 0x64, 0xFA, 0xF9, 0x84, 0x60, 0xA5, 0x1A, 0x58, 0x98, 0xFD, 0x4F, 0xAB, 0xCB, 0x5A,
-    0x11, 0x69, 0xB3, 0x2D, 0xC6, 0x59, 0xF2, 0x3D, 0xD3, 0xE0, 0x75, 0xDB, 0x2A, 0x2C, 0xDD, 0x6A,
-    0xE8, 0x2F, 0x94, 0xBB, 0x0B, 0xDC, 0xD8, 0xB6, 0x2E, 0x2A, 0x43, 0x26, 0xF6, 0x6D, 0x01, 0x96,
-    0xBC, 0x2C, 0xCE, 0xBA, 0x5C, 0xD8, 0x56, 0x05, 0x47, 0x19, 0xB3, 0xBE, 0x5F, 0x6A, 0x32, 0xD5,
-    0x47, 0x93, 0xDE, 0xAE, 0x9A, 0xAC, 0x49, 0xC7, 0x70, 0x52, 0xB2, 0x17, 0xFF, 0x08, 0x47, 0xCB,
-    0x8C, 0x0A, 0xEC, 0x5E, 0xCC, 0x76, 0x63, 0x73, 0x91, 0x56, 0x27, 0x5F, 0x4B, 0x3D, 0xD5, 0xCE,
-    0x6A, 0x87, 0x48, 0xD0, 0x38, 0x34, 0x15, 0xF2, 0xF4, 0xF1, 0x09, 0x89, 0x7B, 0x05, 0xCA, 0x5E,
-    0x68, 0x9C, 0x80, 0x85, 0xD5, 0x37, 0x90, 0xEF, 0xB6, 0x72, 0x43, 0x95, 0xAF, 0x2E, 0xF5, 0x76,
-    0xB1, 0x71, 0xE1, 0x82, 0x69, 0xE5, 0x31, 0x54, 0xDC, 0x1A, 0x75, 0xC9, 0x68, 0xC0, 0x50, 0x99,
-    0x55, 0x12, 0x45, 0x48, 0xEE, 0x43, 0x29, 0xC3, 0xC5, 0xC9, 0x8D, 0x40, 0x81, 0x02, 0xC7, 0x59,
-    0x0C, 0x44, 0xE8, 0xD5, 0xB1, 0x8E, 0xAD, 0xEE, 0x4F, 0xE3, 0xAC, 0xF3, 0x9E, 0xDB, 0x15, 0xE3,
-    0xCB, 0x76, 0xDD, 0x93, 0xC6, 0x21, 0x30, 0x87, 0x74, 0xA7, 0x77, 0x09, 0x16, 0xEB, 0x88, 0x53,
-    0x96, 0x28, 0x86, 0xC5, 0x2D, 0x19, 0x74, 0x95, 0xBA, 0x49, 0x75, 0x42, 0xA5, 0x58, 0x3C, 0xA9,
-    0x64, 0x64, 0x9D, 0xA6, 0x7E, 0x55, 0xA9, 0x42, 0x39, 0x47, 0xE8, 0x87, 0x49, 0x1B, 0x1D, 0x50,
-    0x5D, 0xBA, 0x20, 0x70, 0xB9, 0x63, 0xB4, 0xC2, 0x51, 0xA6, 0xDC, 0xF8, 0x5A, 0xFC, 0x0A, 0xD7,
-    0x56, 0xCB, 0x4C, 0xD9, 0x22, 0xE1, 0xF3, 0xC6, 0x77, 0x30, 0x7C, 0xD0, 0x4F, 0x75, 0x91, 0xD2,
-    0x80, 0xEE, 0x48, 0x15, 0x09, 0x00, 0xE7, 0x6A, 0x34, 0xF5, 0xA0, 0x8F, 0x21, 0xD4, 0xF4, 0xB6,
-    0x27, 0x74, 0xCA, 0xDD, 0xAC, 0x55, 0xDA, 0xE5, 0x2D, 0xFA, 0xD8, 0x1A, 0x82, 0x97, 0xBD, 0xFD,
-    0x94, 0x91, 0x68, 0x93, 0xAE, 0x87, 0xD2, 0x0A, 0x92, 0xF5, 0x8D, 0x6D, 0x27, 0x21, 0x41, 0x91,
-    0xCE, 0x77, 0x25, 0x24, 0x8B, 0xCA, 0x44, 0x36, 0xA8, 0x37, 0x2E, 0x9A, 0x78, 0xBC, 0x33, 0x45,
-    0xFB, 0x18, 0x61, 0xB1, 0xCF, 0xD5, 0x04, 0x3D, 0x06, 0xD7, 0x7B, 0x64, 0x37, 0xA3, 0x4F, 0x98,
-    0xB2, 0x6F, 0xA3, 0x9D, 0xB1, 0x7B, 0xE6, 0x2E, 0x06, 0xC8, 0x5A, 0xED, 0xAC, 0x50, 0x8A, 0x70,
-    0xBF, 0x56, 0xF1, 0x54, 0x19, 0x81, 0x34, 0x56, 0x0D, 0xE1, 0x71, 0x33, 0x7A, 0x5E, 0x2A, 0xF4,
-    0x4E, 0xA8, 0xBB, 0xAC, 0x4B, 0x02, 0xA4, 0x0C, 0xCC, 0xD5, 0xDC, 0x1F, 0xD5, 0xEC, 0x7D, 0x5C,
-    0x18, 0xBB, 0x83, 0xF5, 0x48, 0xA3, 0xA0, 0x05, 0xA1, 0xD9, 0x8B, 0xBC, 0x67, 0x4D, 0x06, 0xD5,
-    0xBB, 0xBA, 0xC3, 0x56, 0x3C, 0xCA, 0xC8, 0x81, 0xBC, 0x86, 0x61, 0x48, 0x57, 0x82, 0xA3, 0x2F,
-    0x1E, 0x9D, 0x14, 0xA7, 0x10, 0xB4, 0xC8, 0xEF, 0xED, 0x28, 0x49, 0x49, 0x2A, 0xC2, 0x46, 0x5A,
-    0xA9, 0x14, 0xA0, 0xED, 0x0A, 0xC4, 0x32, 0xE0, 0x48, 0x2D, 0x67, 0x0D, 0x58, 0x20, 0x97, 0x41,
-    0x47, 0x7A, 0x39, 0xF1, 0x04, 0xC7, 0x34, 0x4C, 0x76, 0x56, 0x8A, 0x65, 0x1B, 0xDF, 0x09, 0x91,
-    0xBD, 0x8B, 0xAD, 0x9B, 0x2B, 0x5E, 0xED, 0x59, 0x06, 0x49, 0xEE, 0x1E, 0x04, 0x65, 0x37, 0x3C,
-    0x58, 0x68, 0x82, 0x88, 0xE4, 0xB2, 0x94, 0x79, 0x97, 0x4C, 0x84, 0x49, 0x9F, 0xA8, 0x9A, 0xA2,
-    0x0C, 0x16, 0x15, 0xD8, 0x78, 0x20, 0x40, 0x05, 0x72, 0x75, 0x15, 0xE7, 0x29, 0xBE, 0xF9, 0xA4,
-    0xF4, 0x84, 0x86, 0xDD, 0xA5, 0x8C, 0xD0, 0x69, 0x71, 0xF7, 0x99, 0x47, 0x35, 0xBA, 0x60, 0x9D,
-    0x97, 0x97, 0xD1, 0x06, 0x23, 0x96, 0x1A, 0x29, 0xEE, 0x32, 0x64, 0x1D, 0x54, 0x4A, 0x69, 0x4D,
-    0xAD, 0xFA, 0xD9, 0x65, 0x2A, 0x16, 0xAA, 0x6F, 0x20, 0x02, 0x86, 0x65, 0xCC, 0x7A, 0xA4, 0x81,
-    0xD9, 0xBF, 0x75, 0xA9, 0x84, 0x92, 0x8D, 0x56, 0x54, 0xA6, 0x6F, 0x82, 0xAA, 0x0D, 0xEE, 0x41,
-    0xCB, 0xBA, 0x64, 0x88, 0xFC, 0xA6, 0x5C, 0x6A, 0x67, 0x4B, 0xBF, 0x14, 0x2D, 0xD5, 0xBC, 0x80,
-    0x5B, 0x6D, 0x96, 0x66, 0x8C, 0xB4, 0x41, 0xEC, 0xD9, 0x5D, 0xA6, 0xD0, 0x37, 0x03, 0xA3, 0x79,
-    0x05, 0x2D, 0x3E, 0x68, 0x17, 0xC9, 0xD7, 0x66, 0x24, 0x54, 0xC1, 0x87, 0x07, 0x90, 0x6E, 0x00,
-    0x1C, 0x24, 0x0B, 0x6D, 0x80, 0x9E, 0xDD, 0xDC, 0x6F, 0xFD, 0x00, 0x88, 0xBF, 0xEE, 0xE9, 0xCD,
-    0xE0, 0x96, 0xAC, 0xF8, 0xCF, 0xC8, 0x21, 0x99, 0x77, 0x3D, 0x58, 0xED, 0xDA, 0xCA, 0xE2, 0x3E,
-    0xF3, 0xCB, 0xD4, 0x1A, 0x7D, 0xA2, 0x81, 0x70, 0xE3, 0x1C, 0xC5, 0xB0, 0x31, 0x46, 0x73, 0x5D,
-    0xA8, 0x64, 0xFD, 0x9B, 0x7A, 0xDC, 0xDA, 0x94, 0x11, 0x24, 0x1A, 0x12, 0x39, 0x3E, 0xB2, 0x90,
-    0x2E, 0x1D, 0x2C, 0xB3, 0x39, 0x4D, 0xC4, 0x9B, 0x78, 0x15, 0x5C, 0x0A, 0x09, 0x52, 0xEF, 0x8B,
-    0xBB, 0x62, 0x15, 0x4B, 0x55, 0xEC, 0x00, 0xE1, 0xA3, 0x14, 0x88, 0x78, 0xFC, 0x28, 0x2E, 0xED,
-    0x34, 0xCC, 0x5A, 0x06, 0x99, 0xCE, 0x59, 0x42, 0x03, 0xCC, 0x4A, 0x82, 0xAB, 0x2E, 0xBD, 0xF9,
-    0x02, 0xDB, 0x9C, 0xCD, 0x0C, 0x13, 0xFC, 0xD9, 0xD5, 0xB7, 0xFE, 0xEE, 0xAC, 0x79, 0x53, 0x42,
-    0x0D, 0xBF, 0xFD, 0xE2, 0xB6, 0x19, 0xD2, 0x7A, 0x19, 0xB9, 0xCF, 0xD1, 0x68, 0x62, 0x7F, 0x73,
-    0xDD, 0x3F, 0x30, 0x08, 0x23, 0xAB, 0x2E, 0xB3, 0x47, 0xA6, 0xA6, 0x3F, 0x58, 0x58, 0x35, 0xEA,
-    0x7F, 0xC1, 0x20, 0xFD, 0x9A, 0x41, 0x0C, 0xCE, 0x05, 0xE7, 0x60, 0x18, 0x20, 0x2E, 0xD2, 0x80,
-    0x79, 0x74, 0xEE, 0xC5, 0xC8, 0x32, 0xF5, 0x0F, 0xE0, 0xE9, 0xE4, 0x89, 0x0F, 0xB1, 0xE3, 0x11,
-    0xB0, 0x79, 0xB4, 0xF2, 0xE5, 0x13, 0x54, 0x41, 0xE1, 0x66, 0xE2, 0x19, 0x1D, 0x4B, 0xC5, 0xBF,
-    0x5F, 0x5E, 0x98, 0xD0, 0x99, 0xF2, 0x5B, 0xA5, 0xA1, 0x0C, 0xE5, 0x9D, 0x4B, 0xA5, 0x8F, 0xEF,
-    0x8B, 0xD6, 0xF7, 0x4B, 0x7D, 0xCD, 0xB7, 0x7E, 0x53, 0x1E, 0x30, 0xDA, 0xFC, 0x6E, 0x8F, 0xC2,
-    0x83, 0x57, 0x50, 0xBD, 0xCE, 0x2D, 0x7D, 0xD0, 0x64, 0x6D, 0x8A, 0xF0, 0xD9, 0xEF, 0x73, 0xB0,
-    0x3A, 0x88, 0x7E, 0xD5, 0x09, 0x2B, 0x31, 0x74, 0x6E, 0x65, 0x02, 0x22, 0x20, 0x61, 0x34, 0xA4,
-    0x26, 0x0A, 0xDD, 0xA0, 0x33, 0x2B, 0xEE, 0xE8, 0xFC, 0xEC, 0x31, 0xD3, 0xE9, 0x6D, 0xF1, 0x2A,
-    0xB3, 0x5E, 0x42, 0x38, 0x37, 0x8D, 0x2E, 0xE2, 0x61, 0x6D, 0xF0, 0x3C, 0xE1, 0x13, 0xFE, 0xD8,
-    0xB7, 0xE3, 0x6F, 0xB8, 0x46, 0x6A, 0xED, 0x87, 0xC1, 0x61, 0x67, 0x7E, 0x6C, 0x9D, 0xFC, 0x68,
-    0xEB, 0x8A, 0x27, 0x4B, 0xF7, 0x10, 0xDE, 0xE9, 0xA0, 0xFB, 0x18, 0xBD, 0x7A, 0xA1, 0x4E, 0xC4,
-    0x76, 0x6B, 0xD0, 0xF4, 0x16, 0x2D, 0xC9, 0xA4, 0x13, 0xE6, 0xED, 0x6E, 0xB3, 0xE6, 0xFB, 0x6B,
-    0x6F, 0x60, 0x67, 0x93, 0xB3, 0xEB, 0x49, 0xBC, 0xCF, 0x43, 0x6E, 0x94, 0xFA, 0x6E, 0x5C, 0x86,
-    0xFE, 0xEC, 0x30, 0x6B, 0xCD, 0x2C, 0x24, 0x93, 0x65, 0x95, 0x2C, 0x37, 0xFF, 0x29, 0xDC, 0xF6,
-    0xF7, 0xC2, 0xE7, 0x93, 0x31, 0xEF, 0x8A, 0x4E, 0xBE, 0x21, 0x8F, 0xAB, 0x23, 0x28, 0xFA, 0xEA,
-    0xBD, 0xC3, 0xBD, 0xFE, 0xEF, 0xDB, 0x5C, 0x58, 0x4C, 0x09, 0x89, 0xAF, 0x77, 0x47, 0x93, 0x5D,
-    0x86, 0xBB, 0xB7, 0x14, 0x8A, 0x9E, 0xAB, 0x6C, 0xE9, 0xF9, 0x5D, 0xDF, 0xF4, 0xE0, 0x76, 0x6D,
-    0x3A, 0xA1, 0x4F, 0xF0, 0xF3, 0xCE, 0x6D, 0x37, 0xEC, 0x7D, 0x47, 0x3B, 0x7B, 0x9E, 0xD5, 0x13,
-    0xD5, 0x97, 0xCE, 0xBA, 0xF0, 0x5A, 0x68, 0x55, 0xC2, 0x27, 0xFA, 0xF5, 0x7E, 0x60, 0x5B, 0x2B,
-    0xE9, 0x12, 0x59, 0x89, 0x1D, 0xAE, 0x41, 0x4D, 0x17, 0x36, 0x1F, 0xAD, 0x99, 0x57, 0xDD, 0x77,
-    0x60, 0xD7, 0x52, 0x6E, 0x94, 0xB2, 0x3A, 0x56, 0x6C, 0xCB, 0x8D, 0x8C, 0x9B, 0x98, 0x2E, 0x85,
-    0x56, 0x73, 0xF0, 0x6D, 0x25, 0x77, 0x24, 0x49, 0x71, 0xF7, 0x30, 0x6E, 0xA1, 0xD8, 0x59, 0xCC,
-    0x4F, 0xEB, 0xEF, 0xB7, 0x30, 0xCD, 0x55, 0x54, 0x18, 0xE3, 0xF6, 0xEA, 0x49, 0x92, 0x30, 0x5F,
-    0x18, 0x08, 0x67, 0xE7, 0x77, 0x49, 0x0B, 0x1A, 0x70, 0x29, 0x95, 0x64, 0xD2, 0xA8, 0x0B, 0x57,
-    0x9A, 0x55, 0x1B, 0xF5, 0x1A, 0xCA, 0x3A, 0xA5, 0x97, 0x86, 0x0B, 0x33, 0x80, 0xAE, 0xB1, 0xAB,
-    0xA3, 0x89, 0x3F, 0xBB, 0x8E, 0xB0, 0x4D, 0x30, 0x32, 0x9A, 0x2E, 0xF5, 0x52, 0xD5, 0xB3, 0xCC,
-    0x43, 0xAA, 0x59, 0x73, 0x02, 0xA3, 0x3F, 0xA6, 0x38, 0xDC, 0x46, 0xF0, 0xAD, 0x08, 0x07, 0x4E,
-    0x1B, 0x40, 0xC4, 0xDC, 0xDB, 0xA5, 0x3F, 0xBB, 0x85, 0x28, 0xB2, 0xC9, 0x51, 0x02, 0xCC, 0x7A,
-    0x95, 0x3D, 0x8D, 0xF4, 0xD0, 0x07, 0xAD, 0xB0, 0xB0, 0x0D, 0x36, 0xEF, 0x94, 0x09, 0x05, 0x3A,
-    0x76, 0xEB, 0xA6, 0xD0, 0xE5, 0xE0, 0x0F, 0x05, 0x8F, 0xA2, 0x56, 0x6A, 0x8D, 0x7A, 0x74, 0x7C,
-    0x9B, 0x6D, 0x85, 0x8D, 0xED, 0x3D, 0x8C, 0xBD, 0x69, 0x8B, 0xA9, 0x1B, 0xB5, 0xF3, 0x32, 0xF7,
-    0x01, 0x3E, 0x1F, 0x33, 0x7C, 0xD3, 0xDA, 0x32, 0x49, 0x9B, 0x9B, 0xC0, 0x66, 0x64, 0xB7, 0xB1,
-    0x09, 0xD6, 0xD6, 0x1B, 0x33, 0xB9, 0x7B, 0x1B, 0xFF, 0x1F, 0x33, 0x2C, 0x49, 0x7B, 0x05, 0xFA,
-    0x70, 0x05, 0xBF, 0x15, 0xAE, 0x09, 0xCD, 0x26, 0x13, 0x4C, 0xED, 0x98, 0x35, 0xBF, 0x6E, 0xBA,
-    0xD4, 0x0D, 0x4D, 0x1D, 0x8D, 0x9D, 0x8A, 0x58, 0xBA, 0xA4, 0xD8, 0x42, 0x7A, 0x1C, 0x41, 0xEB,
-    0xEB, 0xBA, 0xDE, 0x5D, 0x73, 0xE4, 0xD3, 0x42, 0xE7, 0x33, 0x79, 0x98, 0xF2, 0xA5, 0x56, 0x10,
-    0x26, 0x13, 0xD7, 0xAA, 0x21, 0x50, 0x11, 0xDB, 0xEC, 0xB1, 0x2D, 0x89, 0xF4, 0x44, 0x63, 0x67,
-    0x40, 0xA5, 0x90, 0x12, 0x70, 0x88, 0x32, 0xDF, 0xB5, 0x59, 0xF7, 0xAB, 0x9C, 0xB9, 0xF5, 0x94,
-    0x1A, 0xE8, 0xE5, 0x29, 0x38, 0xB7, 0xED, 0x71, 0x4B, 0xB7, 0x2F, 0xF6, 0x58, 0x65, 0xC3, 0x0A,
-    0xBE, 0x07, 0x55, 0xB6, 0x53, 0xE5, 0x7D, 0x30, 0x11, 0x4C, 0x8C, 0x5F, 0xE6, 0x6E, 0x67, 0x21,
-    0xB7, 0x8E, 0x8F, 0xBD, 0x06, 0xD8, 0x5C, 0x55, 0x7B, 0x38, 0x17, 0x9B, 0x09, 0xAC, 0x19, 0xA4,
-    0xBE, 0x4B, 0xBC, 0x10, 0x7A, 0x5E, 0xAC, 0x8D, 0x86, 0xBE, 0xD6, 0xB4, 0xDD, 0x05, 0xF3, 0xBD,
-    0xA5, 0xBB, 0x1C, 0x7A, 0xF5, 0x87, 0x6B, 0x69, 0x70, 0x4D, 0x7E, 0x56, 0x37, 0x91, 0xDD, 0x39,
-    0xD1, 0x78, 0xF7, 0x89, 0x02, 0x3F, 0xD1, 0x05, 0x9B, 0x28, 0xF0, 0xBD, 0x56, 0xA1, 0x59, 0x2B,
-    0xB7, 0xB6, 0x7F, 0x05, 0xF2, 0x6F, 0x56, 0xA1, 0x94, 0x57, 0xED, 0x46, 0x75, 0x7D, 0xE6, 0x93,
-    0xC5, 0x9B, 0x62, 0xBE, 0xBE, 0x97, 0xAF, 0x30, 0x18, 0x9A, 0xEA, 0x57, 0x47, 0x76, 0xBF, 0x14,
-    0xD7, 0x7D, 0xB3, 0xDC, 0x5B, 0x36, 0x50, 0x6E, 0xFB, 0x56, 0x18, 0xF1, 0x1D, 0x75, 0xBE, 0xE0,
-    0x5A, 0xF9, 0xA6, 0xB4, 0x64, 0x6D, 0x4E, 0x5B, 0x0B, 0xB1, 0xB5, 0xC7, 0x6D, 0xAD, 0x62, 0xFA,
-    0xFA, 0xA4, 0x05, 0x88, 0xBB, 0x42, 0xE5, 0x6A, 0xD6, 0xB7, 0x9B, 0xAA, 0xE1, 0x4A, 0x93, 0xB5,
-    0x54, 0x5F, 0x37, 0x07, 0xAD, 0xFD, 0xEB, 0xAE, 0x2B, 0x5F, 0x53, 0xDB, 0xAB, 0x67, 0xB9, 0x64,
-    0xEF, 0x05, 0xB8, 0x83, 0x32, 0xEE, 0xC9, 0x56, 0x6F, 0x7F, 0x18, 0x5E, 0x2B, 0x0B, 0x91, 0x91,
-    0xF3, 0x85, 0x0F, 0xBE, 0xEF, 0xC1, 0xD7, 0x3D, 0x62, 0xEC, 0x43, 0xE3, 0xA5, 0x8B, 0x0E, 0xC6,
-    0xB7, 0x4D, 0x7B, 0x66, 0xC1, 0x6A, 0x8E, 0x33, 0xBC, 0xE8, 0x91, 0xE3, 0x3D, 0x0F, 0xEE, 0x94,
-    0x72, 0x93, 0x3D, 0xF3, 0x81, 0xF7, 0x62, 0xDD, 0x63, 0x07, 0x1B, 0x0C, 0xEC, 0xD3, 0xDF, 0xB3,
-    0x7A, 0x9B, 0xD5, 0xEA, 0x7D, 0xA0, 0xC2, 0xCA, 0xC7, 0x0E, 0xDF, 0xB4, 0x36, 0xAC, 0x31, 0x12,
-    0x62, 0x9B, 0x76, 0xFE, 0xFE, 0xC2, 0x9A, 0x83, 0xA6, 0x5E, 0x07, 0xC9, 0xD3, 0xC7, 0x09, 0xCB,
-    0x99, 0xF2, 0x4C, 0x69, 0x46, 0x86, 0x65, 0xB9, 0x04, 0x46, 0x26, 0xC2, 0xFE, 0x18, 0x62, 0xC9,
-    0x66, 0xAD, 0xC7, 0xDD, 0x25, 0xBB, 0xC4, 0x1B, 0x00, 0x84, 0x09, 0x2F, 0xB1, 0x2C, 0x8E, 0x2F,
-    0xE4, 0xE1, 0x4D, 0x96, 0x86, 0x40, 0x85, 0x7C, 0x8B, 0x07, 0x5D, 0x10, 0x7A, 0x07, 0xE6, 0x07,
-    0x50, 0x69, 0x48, 0x55, 0x2B, 0x60, 0xE8, 0xE0, 0xE3, 0x5B, 0x7D, 0xF9, 0xFA, 0x8A, 0x0E, 0x7B,
-    0x3B, 0x3B, 0xFC, 0x1E, 0xEE, 0xDC, 0x24, 0xF2, 0x35, 0xB2, 0x7B, 0x36, 0xC3, 0x7D, 0xD4, 0x4F,
-    0xC6, 0xD8, 0x52, 0xE1, 0xE5, 0x0B, 0x30, 0x7C, 0xE5, 0x68, 0x86, 0x1E, 0xA1, 0x13, 0x15, 0xBB,
-    0x61, 0x8E, 0x05, 0xBD, 0x47, 0x59, 0xCF, 0xFB, 0x36, 0x1D, 0x3B, 0xDB, 0x58, 0x4D, 0x03, 0x2D,
-    0x42, 0xA9, 0xFD, 0xCB, 0x82, 0xBB, 0xA6, 0x59, 0x8B, 0x9B, 0x8A, 0x61, 0xA7, 0x93, 0x54, 0x64,
-    0x36, 0x26, 0x64, 0x7E, 0xDF, 0x90, 0x9D, 0x29, 0x34, 0x96, 0x85, 0x6D, 0xB2, 0xFE, 0x82, 0xAD,
-    0xA3, 0x01, 0xA2, 0x75, 0x42, 0xA3, 0x3C, 0x7F, 0xD1, 0x46, 0x55, 0x8B, 0x7F, 0x8B, 0x32, 0x65,
-    0x4E, 0xFE, 0xAE, 0x9A, 0xF3, 0x05, 0xFB, 0x8C, 0x83, 0xA2, 0x50, 0x34, 0x3A, 0x44, 0xAC, 0x7A,
-    0xA2, 0xC1, 0x49, 0x9B, 0xE0, 0x57, 0xD5, 0x44, 0x93, 0x32, 0x23, 0x43, 0x15, 0xA1, 0xFE, 0x0A,
-    0x13, 0x8B, 0xDE, 0xAC, 0x7A, 0xC5, 0xF6, 0x94, 0x1B, 0x3E, 0x01, 0x81, 0x79, 0x62, 0x5C, 0x90,
-    0xAC, 0xBF, 0x48, 0xE3, 0x6D, 0xD6, 0xA6, 0x0E, 0x8C, 0x5D, 0x44, 0xBE, 0x8F, 0x08, 0x60, 0xB3,
-    0xFF, 0x67, 0xED, 0x6A, 0x63, 0x0B, 0xD0, 0xBD, 0x37, 0x51, 0xEF, 0xC5, 0x04, 0x58, 0x21, 0xF5,
-    0xFA, 0xC6, 0x05, 0xF4, 0x5C, 0x2C, 0xCE, 0xB3, 0x41, 0x85, 0x34, 0x65, 0xA7, 0x12, 0xF8, 0xA0,
-    0x7E, 0xAA, 0x6A, 0xB6, 0x8C, 0x48, 0x6D, 0x6B, 0xCA, 0x38, 0x91, 0x58, 0xA4, 0x5A, 0xF9, 0x76,
-    0xE4, 0x6E, 0xC7, 0x0B, 0xBF, 0x11, 0x66, 0xCC, 0x30, 0x73, 0x78, 0xBF, 0x35, 0x12, 0x91, 0x91,
-    0xC6, 0x8E, 0xC8, 0x2C, 0xB8, 0xF1, 0xE3, 0x70, 0xFB, 0xF2, 0xBF, 0x01, 0xE5, 0x5C, 0xBF, 0x8F,
-    0xE5, 0xD6, 0x75, 0xBE, 0x24, 0xBD, 0x43, 0x44, 0x2C, 0xE8, 0xC2, 0x2B, 0x04, 0xAB, 0x82, 0x6D,
-    0x22, 0x27, 0x66, 0x93, 0x32, 0x31, 0x29, 0x1B, 0x86, 0x8B, 0x14, 0x9A, 0x62, 0x5E, 0x0C, 0x43,
-    0x85, 0x5C, 0xA4, 0x48, 0x56, 0x06, 0xE6, 0x2F, 0x90, 0xF9, 0x9C, 0xC6, 0xA5, 0xD7, 0x80, 0x17,
-    0x01, 0xD2, 0x64, 0x0B, 0x29, 0xB0, 0x66, 0x8B, 0x49, 0xE1, 0x26, 0x81, 0xBC, 0xA4, 0xE2, 0xC2,
-    0x85, 0x0B, 0x3F, 0xC7, 0x70, 0x1A, 0x17, 0xA2, 0x9C, 0xB5, 0x1D, 0xAD, 0x0B, 0xD1, 0x11, 0x15,
-    0x71, 0x46, 0x24, 0x6F, 0xCE, 0xF9, 0xCE, 0xB9, 0x97, 0x9C, 0xD9, 0xD9, 0xD9, 0x91, 0x9D, 0xC4,
-    0xDA, 0x78, 0xB0, 0xFB, 0xF8, 0x86, 0xC3, 0x1F, 0xF7, 0x9E, 0xDF, 0xE7, 0x3B, 0xE7, 0x5E, 0x63,
-    0xF8, 0xE7, 0x63, 0xF4, 0x3F, 0x3C, 0xB6, 0x33, 0x1D, 0x12, 0x6B, 0x2D, 0x1D, 0x32, 0x39, 0x14,
-    0xF6, 0xC1, 0x6B, 0xE6, 0x6A, 0x3F, 0x75, 0xC3, 0x9F, 0x81, 0xC5, 0x21, 0x92, 0x43, 0x22, 0x87,
-    0xCC, 0xEE, 0x0C, 0x1E, 0x86, 0x43, 0x5D, 0xB7, 0xB8, 0xB0, 0xE0, 0x43, 0x34, 0xE7, 0x1D, 0x5F,
-    0x38, 0xE2, 0x90, 0xF5, 0x38, 0x14, 0x1D, 0x0E, 0x75, 0x93, 0xF7, 0x7C, 0xE1, 0x36, 0xEB, 0xF9,
-    0x89, 0x26, 0x1B, 0xF8, 0x89, 0x9B, 0x43, 0x3A, 0xA4, 0x34, 0xBC, 0x91, 0x9F, 0x88, 0x43, 0x2D,
-    0x07, 0x8B, 0x43, 0xC4, 0x87, 0x89, 0x2E, 0xA4, 0xC7, 0x4D, 0x26, 0xA5, 0x39, 0x65, 0xB3, 0x29,
-    0x46, 0x1C, 0xEA, 0x81, 0x07, 0xE3, 0x87, 0x7C, 0xB3, 0xA6, 0xF1, 0xC5, 0x98, 0x69, 0xA1, 0xB7,
-    0x9E, 0xDE, 0xB9, 0xCA, 0x5C, 0xB3, 0xFB, 0x98, 0xA3, 0x1D, 0x70, 0xE3, 0x8E, 0xBE, 0x1E, 0xDB,
-    0xD2, 0xE4, 0x6D, 0x42, 0xAF, 0x99, 0x4D, 0xD6, 0x99, 0xA4, 0x33, 0x55, 0x63, 0x8A, 0x32, 0x98,
-    0x4D, 0x30, 0x9A, 0xB8, 0x37, 0xE9, 0xCE, 0xE4, 0x3B, 0x53, 0xD0, 0x20, 0x8D, 0x19, 0x69, 0xBA,
-    0x26, 0x3E, 0xF9, 0x0B, 0xDB, 0x81, 0xCC, 0x5B, 0x7E, 0xC6, 0x8C, 0xE1, 0xF7, 0xF8, 0x24, 0x9A,
-    0xD5, 0xF7, 0xF5, 0x4D, 0x07, 0xE6, 0x3A, 0x68, 0x56, 0xE6, 0x3B, 0x50, 0xD0, 0x76, 0xC2, 0xA3,
-    0x9E, 0xCF, 0xEA, 0x21, 0xB1, 0x2D, 0xAE, 0xBD, 0x76, 0xC9, 0x88, 0x79, 0x64, 0xF4, 0x13, 0xCB,
-    0xE4, 0x95, 0x3D, 0x21, 0x9E, 0x46, 0x14, 0x9E, 0x8C, 0x3C, 0xAE, 0x5C, 0xF8, 0x63, 0xAA, 0x1F,
-    0x0C, 0x60, 0xDA, 0x4F, 0x71, 0x4B, 0xDE, 0x81, 0xBF, 0xCA, 0xA0, 0x74, 0xC4, 0xF3, 0x92, 0x31,
-    0xE4, 0x5B, 0xE2, 0xD9, 0x54, 0x3B, 0xCF, 0xA1, 0xD0, 0xFE, 0xF8, 0x85, 0xD9, 0x08, 0x37, 0x1A,
-    0x39, 0x74, 0x9E, 0x45, 0xCC, 0x30, 0xAB, 0x07, 0xA2, 0x08, 0x9D, 0xA9, 0x7A, 0xC7, 0xA3, 0xD4,
-    0xF2, 0xF8, 0xB6, 0x09, 0x11, 0x24, 0xC0, 0xC0, 0xAE, 0x95, 0x66, 0x1F, 0x53, 0x6F, 0xE9, 0xA1,
-    0x16, 0x7F, 0xB5, 0xC2, 0xFB, 0xAD, 0x9F, 0xF4, 0xFE, 0x47, 0x81, 0x49, 0x20, 0x8D, 0x48, 0xBE,
-    0x50, 0x56, 0xE4, 0x5E, 0xC4, 0x5E, 0xA4, 0x1E, 0x44, 0x15, 0x99, 0x17, 0x91, 0x17, 0x89, 0x17,
-    0x7A, 0x8A, 0xBC, 0x43, 0xDC, 0x45, 0xDA, 0x85, 0x94, 0x22, 0xEB, 0x22, 0xEA, 0x22, 0xE9, 0x42,
-    0x45, 0xC8, 0xB9, 0x88, 0xB9, 0x48, 0xB9, 0x10, 0x50, 0x64, 0x7C, 0x11, 0xF1, 0x1C, 0xC2, 0x51,
-    0x81, 0xD3, 0x56, 0xF8, 0x0C, 0x21, 0x90, 0xCF, 0x1A, 0xDC, 0x4D, 0xFA, 0x35, 0xC5, 0x82, 0xB9,
-    0x04, 0xAD, 0xB6, 0x11, 0x6B, 0x50, 0x71, 0x6A, 0xFB, 0x90, 0x74, 0xA6, 0x49, 0xDB, 0xC0, 0x9A,
-    0xDA, 0xC4, 0x63, 0xD4, 0x9B, 0xAC, 0xCD, 0x1A, 0x53, 0x95, 0x93, 0x09, 0xA7, 0xA8, 0x33, 0x69,
-    0x97, 0x36, 0x74, 0x41, 0x75, 0xFB, 0xD0, 0x06, 0x34, 0x9C, 0x81, 0x07, 0xD5, 0xF2, 0x80, 0xCB,
-    0x94, 0xA9, 0x95, 0xCC, 0xCF, 0xF3, 0xBB, 0x98, 0x00, 0x90, 0x97, 0x82, 0xC6, 0x12, 0xF2, 0x97,
-    0x94, 0x4F, 0xE5, 0x2C, 0x3B, 0x3C, 0x68, 0xF3, 0x8C, 0xC8, 0xAF, 0x11, 0x19, 0x2D, 0xB6, 0x18,
-    0x99, 0x88, 0xE6, 0xB4, 0x3A, 0x95, 0x76, 0x97, 0x6B, 0x65, 0x50, 0xCF, 0xB7, 0x58, 0xFE, 0x98,
-    0x4F, 0x21, 0x04, 0xCC, 0x2C, 0x52, 0xB7, 0xA5, 0x97, 0xCE, 0x47, 0x1D, 0x91, 0x16, 0x13, 0xAF,
-    0x27, 0x31, 0x4C, 0xA2, 0x0D, 0xB0, 0x4B, 0x15, 0x5E, 0x9F, 0x8A, 0x12, 0x88, 0x66, 0xE4, 0xF3,
-    0xEA, 0xEF, 0xC5, 0xB4, 0xBE, 0x98, 0xEE, 0xFC, 0x7D, 0x16, 0xC8, 0x7F, 0xA8, 0x21, 0x1A, 0xB6,
-    0x17, 0xC3, 0x53, 0xE2, 0x97, 0xCE, 0x04, 0x22, 0xE8, 0xA9, 0x48, 0xBF, 0xC8, 0x0E, 0xB3, 0x4F,
-    0x9E, 0xC4, 0xFF, 0xE9, 0x35, 0x39, 0xD1, 0x23, 0xA3, 0x33, 0x69, 0x7B, 0x6E, 0x72, 0xC7, 0x03,
-    0x4F, 0x80, 0xD9, 0xB0, 0x8B, 0xEC, 0x07, 0x5D, 0xC8, 0x02, 0xCF, 0xE3, 0xA2, 0x77, 0x99, 0x82,
-    0x6E, 0x20, 0xE1, 0x35, 0xE9, 0xC0, 0xA2, 0xC4, 0x43, 0xA5, 0xA7, 0x14, 0xFD, 0x1F, 0xB3, 0x55,
-    0x68, 0x0C, 0xCF, 0x37, 0xE3, 0x61, 0x54, 0xF3, 0x19, 0xDA, 0xDC, 0x93, 0x83, 0x4C, 0x2E, 0x14,
-    0xDD, 0x49, 0x84, 0x14, 0xD9, 0x29, 0xA8, 0x50, 0xEC, 0x58, 0x89, 0xE9, 0x8A, 0x78, 0x30, 0x57,
-    0xA1, 0x33, 0xF1, 0x8F, 0x1F, 0xA3, 0x84, 0x4E, 0x45, 0x25, 0x84, 0xD2, 0x34, 0x8A, 0x07, 0xC7,
-    0xC6, 0x91, 0x3A, 0x91, 0x49, 0xAB, 0xDD, 0x15, 0x2A, 0x2A, 0xB1, 0x8D, 0x18, 0x30, 0xA5, 0xB6,
-    0x0E, 0x4B, 0x29, 0x7C, 0xF6, 0x10, 0x33, 0x4D, 0xB7, 0x8E, 0xE0, 0x4A, 0xEA, 0xF5, 0xC1, 0x38,
-    0x92, 0x1B, 0xEB, 0x5C, 0x97, 0xF3, 0x67, 0xD3, 0x62, 0x05, 0xF9, 0x59, 0xD1, 0x84, 0x77, 0xED,
-    0xF8, 0x63, 0xE6, 0xDB, 0x8E, 0xE9, 0xED, 0xF6, 0x39, 0x7A, 0xD0, 0xF9, 0xB9, 0xEF, 0xF1, 0x5C,
-    0x72, 0x31, 0x20, 0x13, 0x7F, 0xD4, 0xF4, 0x2B, 0x5F, 0x91, 0xF2, 0xB0, 0x93, 0xC1, 0x3D, 0x2C,
-    0xC0, 0xD4, 0xF8, 0x62, 0x03, 0xA7, 0x96, 0x8E, 0x18, 0xF8, 0x67, 0x76, 0xCC, 0xF2, 0x11, 0xC4,
-    0x69, 0x78, 0x78, 0x3D, 0xCF, 0x43, 0x65, 0x3D, 0x50, 0x72, 0x74, 0x2B, 0xB3, 0x2C, 0x7F, 0x4B,
-    0x67, 0xE3, 0x06, 0x68, 0xCC, 0xF5, 0x83, 0x27, 0x5D, 0xD8, 0xAF, 0x97, 0xAA, 0xFD, 0x2C, 0x1F,
-    0xD9, 0xC8, 0x0F, 0x25, 0x42, 0x55, 0x83, 0x7F, 0xFB, 0x42, 0xEB, 0x84, 0x6E, 0x64, 0x99, 0x37,
-    0x76, 0x1E, 0x41, 0x68, 0x50, 0x97, 0x85, 0x3E, 0xED, 0x95, 0x62, 0x62, 0x40, 0x95, 0x70, 0x20,
-    0x71, 0xCE, 0xAF, 0xE6, 0x99, 0xC7, 0x7C, 0xA7, 0xD2, 0x37, 0x6B, 0x61, 0xF2, 0xC2, 0x39, 0xC4,
-    0xA4, 0x8A, 0xF7, 0x75, 0x3A, 0x67, 0x84, 0x2F, 0x95, 0x43, 0x20, 0x07, 0xF3, 0x89, 0xC7, 0xFB,
-    0x7D, 0x95, 0xFC, 0x04, 0x4E, 0x85, 0xDF, 0x3C, 0x89, 0xA0, 0xA9, 0xBC, 0xF1, 0xC4, 0x0A, 0x7B,
-    0x7A, 0x17, 0x8A, 0x00, 0x93, 0x95, 0xCB, 0x14, 0x55, 0xF6, 0x75, 0xC2, 0xB1, 0x8B, 0x91, 0x76,
-    0x2B, 0xE1, 0x57, 0x83, 0xEC, 0xF4, 0x43, 0x2F, 0xD5, 0x6B, 0x60, 0xB9, 0xBF, 0xC4, 0x8C, 0x38,
-    0x7D, 0x49, 0xA3, 0x9F, 0xC9, 0x38, 0x1E, 0x38, 0x4F, 0x9B, 0x09, 0xF9, 0x23, 0x11, 0x03, 0xC7,
-    0x86, 0xD0, 0xDA, 0x15, 0x99, 0xAB, 0x6D, 0x3C, 0x2A, 0x55, 0xD2, 0x19, 0xF6, 0x97, 0xEF, 0x0C,
-    0x40, 0x34, 0xC8, 0xB3, 0xA9, 0x2E, 0x9A, 0xF7, 0x9E, 0x78, 0xDC, 0xD9, 0x08, 0x7B, 0xC0, 0x1F,
-    0xD1, 0x04, 0x70, 0x08, 0x2C, 0x12, 0xA5, 0x10, 0xB1, 0xD6, 0xD0, 0xCE, 0x0B, 0xB8, 0xE8, 0x42,
-    0xAE, 0xEA, 0x39, 0x1A, 0xE1, 0x95, 0x57, 0x86, 0x03, 0x13, 0x1C, 0x20, 0xC8, 0xC9, 0x10, 0xFD,
-    0xB5, 0xF2, 0x38, 0x61, 0x56, 0x2C, 0x26, 0x22, 0x14, 0x9A, 0x19, 0xBB, 0xF6, 0x14, 0x8F, 0xFE,
-    0xA1, 0xE7, 0xBF, 0xAD, 0xC1, 0xEC, 0xCE, 0x47, 0x8B, 0xA9, 0x88, 0x69, 0x26, 0x64, 0xA3, 0xE1,
-    0x67, 0xF4, 0xD0, 0xA2, 0xC7, 0xB3, 0x79, 0x98, 0x74, 0x69, 0xD5, 0xC1, 0x63, 0xB2, 0xB3, 0xA6,
-    0x03, 0xDF, 0xCB, 0x07, 0xF6, 0xF5, 0x0D, 0xFC, 0x3B, 0xDB, 0xE4, 0x92, 0x26, 0x59, 0x92, 0x87,
-    0x66, 0x2F, 0xCD, 0x8A, 0x4B, 0x3E, 0x38, 0xA1, 0xA9, 0x56, 0x08, 0x36, 0x5F, 0xA0, 0x17, 0xE1,
-    0x3D, 0xBD, 0xBC, 0xA7, 0xE3, 0x59, 0x33, 0x7B, 0x8A, 0x45, 0x61, 0x26, 0x66, 0x24, 0x8C, 0x67,
-    0x2D, 0xC3, 0x34, 0x9E, 0xFA, 0xCE, 0x0D, 0x64, 0x1D, 0x88, 0x97, 0xFF, 0x14, 0x34, 0x28, 0x7E,
-    0x84, 0xF9, 0x16, 0xDF, 0x13, 0x6D, 0xFE, 0xBA, 0x04, 0x7F, 0xCF, 0xF3, 0x58, 0x5B, 0x4B, 0xD1,
-    0x11, 0xCD, 0x76, 0x2E, 0x76, 0x4E, 0x1E, 0x6B, 0x4C, 0x36, 0xB0, 0xDF, 0xB0, 0xA2, 0x41, 0x75,
-    0x0F, 0x3F, 0xCF, 0x53, 0xA3, 0xA7, 0xF3, 0x81, 0x7C, 0x4E, 0xBD, 0x83, 0xFB, 0x81, 0xCD, 0x96,
-    0xA9, 0x15, 0x4D, 0x0C, 0xF9, 0x3D, 0xAD, 0x45, 0x2E, 0xC0, 0xAC, 0x5C, 0x0E, 0xA9, 0x1C, 0x62,
-    0x11, 0x29, 0x53, 0xAB, 0x0D, 0xAB, 0xAC, 0x73, 0x04, 0x7C, 0x8B, 0x52, 0x39, 0x92, 0xF9, 0x06,
-    0x42, 0x04, 0xBE, 0x96, 0xCD, 0x87, 0x92, 0x99, 0x55, 0x8E, 0xBE, 0x32, 0xD9, 0x58, 0x10, 0x11,
-    0xEA, 0x19, 0xA5, 0xF3, 0xA6, 0x3E, 0x39, 0xA0, 0x38, 0xB3, 0xE2, 0x59, 0xA4, 0x03, 0xDE, 0x1C,
-    0x4F, 0xF0, 0x2B, 0xA1, 0x45, 0x74, 0xC5, 0x0F, 0xA8, 0x79, 0xB6, 0x14, 0xA3, 0x0D, 0xC1, 0x21,
-    0xD1, 0x56, 0x29, 0x1D, 0x4B, 0xE4, 0x1F, 0x4A, 0xE4, 0x6F, 0xF4, 0xA0, 0xA4, 0x66, 0x36, 0x20,
-    0x71, 0x90, 0xC1, 0xAE, 0x68, 0x5D, 0x34, 0x8B, 0x21, 0xC6, 0x5B, 0xF1, 0x84, 0xCE, 0x3B, 0xB3,
-    0xEB, 0x2F, 0x9E, 0x1C, 0x88, 0x67, 0x34, 0xA0, 0xB4, 0xA4, 0x45, 0x83, 0xB7, 0xB7, 0xB9, 0xBA,
-    0x1D, 0x10, 0x3A, 0xED, 0x61, 0xB1, 0xEB, 0x92, 0xE7, 0x16, 0x8D, 0xB0, 0x74, 0x4A, 0xE7, 0xDA,
-    0x44, 0xCB, 0xB9, 0xB4, 0x83, 0xB6, 0x29, 0x99, 0x85, 0x64, 0xE1, 0xA2, 0xB9, 0x8D, 0xA7, 0x72,
-    0x28, 0x16, 0xC4, 0x47, 0xF6, 0x9F, 0x84, 0xC4, 0x20, 0x4F, 0xD1, 0xEC, 0x2C, 0xB5, 0x47, 0xAF,
-    0x95, 0x57, 0x4B, 0xCE, 0x82, 0xA3, 0xBB, 0xB6, 0xC7, 0x7B, 0x24, 0x4F, 0x52, 0x11, 0xA4, 0x39,
-    0x9C, 0x6E, 0x4A, 0x67, 0x09, 0x23, 0x75, 0x3C, 0xE2, 0x13, 0x40, 0x9C, 0xE2, 0xBD, 0xCD, 0x2D,
-    0xBC, 0xAE, 0x07, 0x05, 0x95, 0xBD, 0xE2, 0x6B, 0x4B, 0x27, 0x08, 0xE2, 0xC3, 0x32, 0x3C, 0x23,
-    0x51, 0x27, 0x72, 0x7B, 0x73, 0xE0, 0x3C, 0x71, 0xE5, 0xC2, 0x67, 0x1A, 0x7F, 0x0A, 0x66, 0x30,
-    0xBF, 0x66, 0x61, 0xD7, 0x6A, 0x8E, 0x37, 0x6B, 0x99, 0xD9, 0xE8, 0x66, 0x29, 0x8C, 0xBB, 0xE2,
-    0x0C, 0xCF, 0xFD, 0x3C, 0x73, 0x02, 0xD6, 0x8A, 0xDD, 0x62, 0xC2, 0xE5, 0x43, 0xCC, 0xFA, 0xB2,
-    0x0B, 0x39, 0x7C, 0xFF, 0x3B, 0x32, 0xB6, 0x08, 0x58, 0x31, 0x1D, 0x19, 0x50, 0x4F, 0x17, 0x1E,
-    0x6D, 0x9C, 0x06, 0xC2, 0x98, 0xB1, 0x42, 0xEF, 0x35, 0x2A, 0x0E, 0x31, 0x46, 0x1B, 0xB9, 0x00,
-    0x87, 0xA5, 0xE1, 0x19, 0x2B, 0x12, 0x75, 0x9D, 0x53, 0x15, 0xD2, 0xB1, 0x70, 0x32, 0x2E, 0x37,
-    0xD0, 0x14, 0xAD, 0x10, 0x23, 0x56, 0xCF, 0x57, 0xF0, 0x30, 0x7B, 0x47, 0xC7, 0x24, 0x41, 0xE1,
-    0xE2, 0xC5, 0x4B, 0xBC, 0x93, 0x33, 0x83, 0xB7, 0x37, 0x8B, 0xBB, 0x52, 0xC7, 0xD2, 0x0B, 0x9D,
-    0xCD, 0xC2, 0xA5, 0xD8, 0xAB, 0x7F, 0x03, 0x11, 0x1E, 0x3D, 0x9B, 0x60, 0xA9, 0xDD, 0xC5, 0x55,
-    0xB7, 0xF0, 0xC9, 0xD8, 0x9F, 0x6D, 0x36, 0xCE, 0x71, 0x07, 0xE0, 0x8A, 0x32, 0x2A, 0x92, 0x5F,
-    0xC4, 0x4E, 0x25, 0x56, 0x15, 0x3F, 0xD8, 0xE7, 0x39, 0xC4, 0x9C, 0x16, 0xA8, 0x38, 0x48, 0x4A,
-    0x16, 0x81, 0xC4, 0x34, 0x4D, 0x66, 0x56, 0x50, 0x7E, 0x74, 0x39, 0x85, 0xC8, 0xD9, 0x49, 0xAC,
-    0x50, 0xC2, 0x0A, 0x1A, 0xD1, 0xFA, 0x98, 0x2B, 0xD8, 0x5C, 0x32, 0x81, 0x9B, 0x47, 0x44, 0xE4,
-    0xD0, 0x03, 0x0D, 0xBD, 0xB2, 0x28, 0x99, 0x6F, 0xEF, 0x3B, 0x0E, 0xA5, 0xC3, 0xC2, 0x20, 0x79,
-    0x91, 0xF0, 0xA7, 0x82, 0xD1, 0xA8, 0x5D, 0x56, 0xDC, 0x28, 0x77, 0x44, 0xCF, 0x85, 0x39, 0x12,
-    0x07, 0x0A, 0x6F, 0xD2, 0x79, 0xB3, 0xD9, 0x57, 0xD6, 0x64, 0x60, 0x43, 0xB1, 0xFA, 0x14, 0xC6,
-    0xD4, 0xE2, 0x46, 0x5C, 0x60, 0x8F, 0x3C, 0x14, 0xAF, 0xCC, 0x47, 0x17, 0x48, 0xC2, 0xA8, 0x5F,
-    0x3A, 0xA5, 0xB3, 0x01, 0x0E, 0x04, 0x69, 0x56, 0x5E, 0x24, 0x33, 0x27, 0xC6, 0x93, 0xC9, 0xCB,
-    0x68, 0xBE, 0x69, 0x5B, 0x61, 0x04, 0x84, 0x81, 0xDF, 0x5F, 0xE6, 0xF3, 0x6B, 0x07, 0xC2, 0x05,
-    0x09, 0x03, 0xE8, 0x8E, 0x2F, 0x8B, 0xE7, 0x10, 0x16, 0x38, 0x95, 0xA7, 0x2B, 0x0E, 0x21, 0x1A,
-    0x1F, 0x49, 0xEA, 0xC1, 0xBC, 0x4B, 0x60, 0x11, 0x8A, 0x1D, 0x5C, 0x09, 0x03, 0x0C, 0x38, 0xA0,
-    0x08, 0x27, 0xAB, 0x10, 0x55, 0x50, 0x07, 0x82, 0x0A, 0x39, 0x65, 0x31, 0xF5, 0x09, 0xF0, 0x00,
-    0x19, 0x85, 0x88, 0x82, 0x36, 0x10, 0x50, 0xC8, 0x27, 0xC4, 0x13, 0xA4, 0x89, 0x1C, 0x7D, 0x56,
-    0xA2, 0x29, 0x60, 0x46, 0xDC, 0x39, 0x29, 0xAD, 0x78, 0x66, 0x33, 0xD2, 0xF2, 0x7D, 0xA3, 0x90,
-    0x08, 0x46, 0x96, 0xED, 0x16, 0x7E, 0x4D, 0x48, 0x94, 0xA3, 0x19, 0x5E, 0x2C, 0x9A, 0xAB, 0x16,
-    0x74, 0x98, 0x56, 0xE0, 0x9B, 0x9A, 0x8D, 0xAC, 0xB9, 0x6A, 0x90, 0xEB, 0xDD, 0x05, 0x1C, 0x5C,
-    0xE3, 0xFC, 0x85, 0xDA, 0x22, 0x71, 0x18, 0xEA, 0x1E, 0xC4, 0x63, 0x28, 0xB7, 0xDC, 0x39, 0xBB,
-    0xF9, 0xA2, 0x71, 0x3E, 0x43, 0x19, 0x16, 0x79, 0x50, 0xB1, 0xF7, 0xE1, 0x83, 0x9A, 0x23, 0x71,
-    0x1B, 0xFE, 0x1C, 0xFC, 0x86, 0x26, 0x12, 0x95, 0xD7, 0xE3, 0xD9, 0xA8, 0xE7, 0x50, 0xCE, 0x2D,
-    0xAE, 0xE3, 0xA9, 0x5B, 0xE6, 0xA6, 0x44, 0x39, 0xA5, 0xC3, 0xAA, 0x62, 0xBC, 0x4B, 0x6D, 0x6E,
-    0x3A, 0xAD, 0x60, 0x84, 0x3F, 0x34, 0xBF, 0xBE, 0x2F, 0xA1, 0x37, 0xC3, 0xC4, 0x49, 0x6E, 0xC3,
-    0x28, 0x88, 0x9A, 0xA8, 0xE2, 0xE7, 0xC7, 0xB3, 0x51, 0x8C, 0x28, 0xC5, 0xE8, 0xC4, 0x46, 0x85,
-    0xF6, 0xC1, 0xED, 0xD2, 0x05, 0xAC, 0x22, 0x63, 0x62, 0xA4, 0x22, 0x3F, 0x3B, 0x09, 0xE5, 0x15,
-    0x2C, 0x43, 0x98, 0xED, 0x10, 0xA5, 0xA4, 0x31, 0xEB, 0x70, 0x37, 0x77, 0xE8, 0x9D, 0x12, 0x5A,
-    0x94, 0x9E, 0x02, 0xE5, 0x46, 0x30, 0x1C, 0x9E, 0x3C, 0x45, 0xD1, 0xE6, 0xE0, 0xC3, 0x4E, 0x6D,
-    0xEF, 0x18, 0x11, 0x44, 0xBE, 0x44, 0x7B, 0xAD, 0xCC, 0x65, 0x16, 0x86, 0xF3, 0xAF, 0x96, 0x04,
-    0xF4, 0x8B, 0xEC, 0x17, 0x34, 0x79, 0xD9, 0xAD, 0x33, 0xF7, 0x4C, 0x24, 0xC0, 0x85, 0xE7, 0x85,
-    0x1B, 0x68, 0x19, 0xBC, 0xCA, 0x74, 0xE2, 0xF0, 0xF7, 0x84, 0x91, 0xBD, 0x90, 0x1F, 0x45, 0xD3,
-    0x2E, 0x2C, 0x80, 0xBE, 0xB0, 0x96, 0x5F, 0x4D, 0x31, 0x23, 0xD5, 0xE1, 0x04, 0xD1, 0xCE, 0xE5,
-    0xD3, 0x56, 0x6C, 0xB8, 0x03, 0x75, 0x95, 0xFD, 0xFC, 0x2E, 0x0D, 0xDE, 0x31, 0xC6, 0x2D, 0x2C,
-    0xFA, 0xDB, 0x67, 0x66, 0x52, 0xC8, 0x8B, 0xD7, 0xB0, 0x82, 0x20, 0x6F, 0xC9, 0x04, 0x0B, 0x68,
-    0x25, 0x7D, 0x6C, 0xC2, 0xE9, 0x0A, 0x64, 0xC9, 0xDB, 0x0A, 0x99, 0xFF, 0x9B, 0xBD, 0x8B, 0x7D,
-    0x23, 0x5B, 0xC3, 0x13, 0x97, 0x9C, 0x9F, 0x65, 0x3B, 0x86, 0xF9, 0xC2, 0x01, 0x7C, 0x29, 0x90,
-    0xD0, 0x26, 0x2D, 0xAC, 0xD5, 0x77, 0x60, 0x84, 0xD2, 0x1D, 0x14, 0x75, 0xE6, 0x9C, 0xC0, 0x05,
-    0x93, 0x3E, 0x0A, 0xD5, 0xE8, 0x1A, 0xDA, 0x0C, 0xDE, 0x07, 0xFF, 0x5C, 0xED, 0xD6, 0x63, 0xA7,
-    0x37, 0xFF, 0x09, 0x7C, 0x53, 0x32, 0x5B, 0x0D, 0x28, 0xB6, 0x0E, 0x6D, 0x11, 0x38, 0xD3, 0x3C,
-    0x6D, 0x3D, 0x4E, 0xF1, 0xD7, 0xAC, 0x02, 0xF4, 0x96, 0x93, 0x17, 0x04, 0xDC, 0xB3, 0x0A, 0x40,
-    0x4A, 0x56, 0x59, 0x08, 0xD8, 0x67, 0x0E, 0x07, 0xF3, 0x3B, 0x28, 0x1A, 0xD7, 0x39, 0x60, 0x01,
-    0x1F, 0xC4, 0x06, 0xCD, 0x92, 0xCA, 0x74, 0x62, 0x8A, 0x56, 0x95, 0x89, 0xC7, 0x06, 0x99, 0xF5,
-    0x57, 0x67, 0xE3, 0x04, 0x42, 0xC3, 0xF4, 0xE2, 0x03, 0x7E, 0x04, 0x89, 0x13, 0x0F, 0x41, 0x24,
-    0xC2, 0xDC, 0x43, 0xD9, 0x21, 0xA2, 0xB9, 0x10, 0xBD, 0xF3, 0x2D, 0x2C, 0xA2, 0x88, 0x44, 0xD4,
-    0xE3, 0x5C, 0xDA, 0x82, 0x48, 0x85, 0x47, 0xAA, 0x96, 0x6C, 0x42, 0x6D, 0xA4, 0x72, 0xD8, 0x09,
-    0x85, 0xC2, 0x44, 0xF0, 0x8A, 0x3B, 0xE4, 0x69, 0x2A, 0x15, 0x85, 0x43, 0xDF, 0x74, 0x52, 0xED,
-    0x59, 0xB1, 0x30, 0xD7, 0xF6, 0x57, 0x55, 0x19, 0xB5, 0xB5, 0x12, 0x07, 0x2A, 0xCC, 0x14, 0x0B,
-    0xD3, 0x8A, 0xE9, 0xC3, 0x08, 0xC5, 0x8D, 0x7B, 0xAF, 0x7A, 0x99, 0x48, 0x30, 0xFC, 0x40, 0x44,
-    0x21, 0xB3, 0xEA, 0xD1, 0x58, 0x20, 0x52, 0x85, 0x8D, 0xD6, 0x18, 0x92, 0x4A, 0x43, 0xDD, 0xAD,
-    0xEA, 0x0F, 0xD9, 0x64, 0xF6, 0xBE, 0xE9, 0x44, 0x81, 0xCF, 0xD5, 0x76, 0x20, 0x09, 0xE0, 0x68,
-    0x92, 0xA4, 0xE5, 0x29, 0x7A, 0xA0, 0xC8, 0x41, 0x84, 0xB8, 0x98, 0x1E, 0x7B, 0x3F, 0x38, 0x14,
-    0x28, 0x9C, 0xCE, 0xD7, 0xEE, 0x8D, 0x3E, 0xE7, 0x93, 0x32, 0xC3, 0x7C, 0xC6, 0x38, 0x48, 0xDD,
-    0xA3, 0x68, 0x7D, 0x42, 0x25, 0x0E, 0xA1, 0xEE, 0xFC, 0x28, 0xAE, 0x6D, 0x1E, 0xC3, 0x76, 0x70,
-    0x5D, 0x98, 0x0E, 0x9E, 0x0B, 0xCB, 0x85, 0xE3, 0x60, 0xB8, 0xF0, 0x5B, 0xD8, 0x0D, 0x6E, 0x0B,
-    0xB3, 0x85, 0xD7, 0xC2, 0x6A, 0x90, 0x4A, 0x18, 0x1D, 0xA9, 0x3D, 0x61, 0x5E, 0x29, 0x97, 0x85,
-    0xC9, 0xCC, 0x63, 0xB0, 0x58, 0x38, 0x5C, 0xA8, 0xA3, 0x9B, 0x1D, 0x7B, 0x57, 0xDC, 0xDD, 0x1C,
-    0xAC, 0xF4, 0x2D, 0xB7, 0x2B, 0xAD, 0x53, 0xCA, 0xAA, 0xC3, 0x50, 0x40, 0x51, 0x03, 0xFF, 0x61,
-    0x75, 0xC1, 0x8D, 0xD7, 0x7E, 0x1D, 0x4F, 0x78, 0xF3, 0xF4, 0x9B, 0x1E, 0x60, 0xC8, 0xBD, 0xAF,
-    0x23, 0xBA, 0x56, 0xB0, 0x0B, 0x11, 0xE9, 0x69, 0xF0, 0x97, 0x6A, 0x0E, 0x02, 0x19, 0x90, 0x02,
-    0x59, 0xF2, 0x72, 0xB5, 0x05, 0x6E, 0x40, 0xBD, 0xB9, 0xB1, 0x2F, 0x59, 0xBD, 0xBD, 0xAF, 0x86,
-    0xA0, 0x00, 0x7C, 0xC2, 0x7C, 0xFF, 0xA4, 0x9D, 0x31, 0x56, 0x16, 0x09, 0x58, 0x81, 0xC2, 0xDE,
-    0xBA, 0x46, 0x7C, 0xB3, 0x56, 0x20, 0x01, 0x7D, 0xE3, 0x82, 0x46, 0x36, 0x20, 0x30, 0xBF, 0xE7,
-    0xD0, 0xBE, 0xB2, 0x1E, 0xB5, 0x96, 0x3D, 0x04, 0x9E, 0xEA, 0x7C, 0x68, 0xE7, 0x4A, 0x35, 0x8B,
-    0x74, 0x16, 0xAB, 0xCA, 0x88, 0x3D, 0x5F, 0x6C, 0x08, 0x67, 0x06, 0x87, 0xC5, 0x04, 0x40, 0xD8,
-    0xC4, 0x25, 0x24, 0x3D, 0x4B, 0xA7, 0x48, 0x43, 0xBE, 0x05, 0x94, 0x04, 0x87, 0x70, 0x0F, 0x4A,
-    0x27, 0xCA, 0x2F, 0x65, 0x48, 0x71, 0x07, 0x76, 0x95, 0xDA, 0xD6, 0x30, 0x5F, 0x85, 0xC3, 0x1C,
-    0xDA, 0x45, 0xED, 0xB5, 0x6A, 0x43, 0x36, 0x0E, 0x78, 0x82, 0x48, 0x44, 0x8A, 0x9B, 0x72, 0x87,
-    0x03, 0x6C, 0xCF, 0x2A, 0x3C, 0x98, 0xDB, 0xAF, 0x92, 0x1C, 0xE3, 0x18, 0x20, 0xA8, 0xD1, 0x9B,
-    0x03, 0x7C, 0x4C, 0x3C, 0x5E, 0xC1, 0x0D, 0x32, 0x06, 0x40, 0x71, 0x23, 0x87, 0x8E, 0x15, 0x1C,
-    0x1B, 0x9D, 0x08, 0x38, 0xBE, 0x19, 0xA1, 0x3F, 0xE4, 0x9C, 0x70, 0x0E, 0xC0, 0x11, 0x4D, 0x2D,
-    0x11, 0x80, 0xA7, 0x60, 0x6B, 0x40, 0xE7, 0x76, 0xCC, 0x60, 0x9C, 0x1B, 0x98, 0xA4, 0x7C, 0x02,
-    0x49, 0x24, 0xD1, 0xE2, 0xF6, 0xA6, 0x1A, 0x05, 0x11, 0x6B, 0x85, 0x91, 0xDB, 0x58, 0x14, 0x38,
-    0x17, 0x05, 0x16, 0xE6, 0x46, 0xC2, 0x5C, 0x46, 0x4D, 0x69, 0x0E, 0xC8, 0xFA, 0x1A, 0xA6, 0x32,
-    0x49, 0x3A, 0xCE, 0x0D, 0xA6, 0x1E, 0x15, 0x3C, 0x2C, 0x3C, 0x68, 0x06, 0x46, 0x26, 0x82, 0xB1,
-    0x33, 0xE1, 0xA6, 0x64, 0xE0, 0xB8, 0xB0, 0x68, 0x38, 0x2A, 0x3A, 0x53, 0x26, 0x5C, 0x80, 0x7B,
-    0x89, 0xAF, 0x00, 0x37, 0x22, 0x42, 0x93, 0x07, 0xAD, 0xFE, 0x7C, 0x78, 0xA2, 0x40, 0x76, 0x21,
-    0x85, 0x95, 0x5F, 0xF2, 0xC4, 0xCA, 0x9C, 0x46, 0x43, 0x71, 0x37, 0x51, 0x84, 0x12, 0x06, 0xB2,
-    0xB0, 0x33, 0x93, 0xA3, 0xD8, 0x66, 0x64, 0x04, 0x76, 0x09, 0x31, 0xBB, 0x63, 0x64, 0x70, 0x0C,
-    0x78, 0xD0, 0x1C, 0xD8, 0xDA, 0x2D, 0x11, 0xA2, 0xDE, 0x91, 0xB5, 0x2B, 0x3A, 0xBA, 0x9B, 0x22,
-    0xDE, 0x1B, 0x0D, 0x27, 0x14, 0x4A, 0x65, 0x96, 0x93, 0x6C, 0xC0, 0x81, 0x02, 0xE9, 0x78, 0x46,
-    0xDE, 0x93, 0x08, 0x99, 0x99, 0xDA, 0x24, 0xF3, 0xD9, 0x04, 0x5D, 0x06, 0x75, 0xC6, 0xC0, 0x2E,
-    0x05, 0x40, 0xC9, 0x38, 0x58, 0x8C, 0x88, 0x78, 0x6C, 0xD1, 0x85, 0xD0, 0x01, 0xE5, 0xF5, 0x2F,
-    0x5A, 0x09, 0x93, 0xAD, 0x51, 0x72, 0xC6, 0xAE, 0x30, 0x0E, 0x11, 0x4C, 0x57, 0x87, 0xC1, 0x91,
-    0x9A, 0x5C, 0x2E, 0x6B, 0x48, 0x31, 0xA1, 0x34, 0x5C, 0x8D, 0x48, 0x85, 0x3C, 0xAD, 0x41, 0x27,
-    0x56, 0xE7, 0xC0, 0xDE, 0x85, 0xE1, 0x2D, 0x11, 0xB7, 0x06, 0x96, 0xF3, 0x13, 0x50, 0x0D, 0xF4,
-    0xCB, 0xFE, 0x8B, 0x9C, 0x40, 0xCE, 0x63, 0x02, 0xD1, 0x2A, 0x7B, 0x4C, 0x44, 0xEA, 0x89, 0x52,
-    0xA4, 0xB5, 0x23, 0x68, 0x46, 0xB6, 0x3C, 0xA2, 0x81, 0xD3, 0x07, 0xCD, 0x36, 0xE9, 0x41, 0x32,
-    0x22, 0x44, 0xD6, 0x11, 0x69, 0x8A, 0x8E, 0xBC, 0x54, 0xD1, 0x82, 0x62, 0x64, 0x20, 0x6C, 0x53,
-    0xF7, 0x44, 0xC8, 0xBD, 0x7F, 0x0C, 0x3C, 0x0B, 0xBF, 0x93, 0xB0, 0x20, 0x12, 0xE3, 0xEB, 0x13,
-    0xA2, 0xDA, 0xBB, 0x24, 0x82, 0xD9, 0xD7, 0x88, 0x68, 0x9F, 0x4E, 0xDA, 0xCB, 0x8D, 0x57, 0xFA,
-    0x2D, 0x4D, 0x29, 0x03, 0x60, 0x0D, 0x93, 0x4B, 0x30, 0x91, 0xA0, 0xCC, 0x28, 0x6E, 0xAB, 0xC3,
-    0x84, 0xBB, 0x84, 0xCB, 0xAD, 0x50, 0x25, 0x72, 0x59, 0x54, 0xD1, 0x5E, 0x78, 0x33, 0x24, 0x8F,
-    0xBD, 0xBB, 0x11, 0x50, 0xDB, 0x95, 0x35, 0x59, 0xAD, 0x91, 0x7E, 0xDF, 0xB8, 0xE7, 0xA3, 0xD4,
-    0xA8, 0x8D, 0x6C, 0xDA, 0xE4, 0xF3, 0xCB, 0x66, 0xB4, 0x5D, 0xF2, 0x96, 0xDD, 0xA6, 0x9F, 0x79,
-    0x28, 0x34, 0x4B, 0xEE, 0x00, 0x9B, 0x0C, 0x66, 0xA9, 0xCF, 0x32, 0x4C, 0xC9, 0x78, 0x29, 0xEB,
-    0xFE, 0x0E, 0x5F, 0xA3, 0x11, 0x15, 0x0E, 0xE6, 0x05, 0xCB, 0x69, 0x86, 0xE2, 0xB1, 0x93, 0x23,
-    0xF3, 0x52, 0xEB, 0xEA, 0x19, 0x7B, 0x35, 0x43, 0xA9, 0xA8, 0xE5, 0xB2, 0x00, 0xD4, 0xF6, 0xE8,
-    0xD5, 0xAB, 0x58, 0xF9, 0xE8, 0x81, 0x0B, 0x19, 0x62, 0x54, 0xD0, 0x26, 0x37, 0x7F, 0xF9, 0x18,
-    0x1C, 0xA9, 0xB4, 0x57, 0xC3, 0xF9, 0x57, 0x58, 0x2E, 0xC4, 0x1B, 0x30, 0xAC, 0x12, 0x75, 0x6F,
-    0x15, 0x50, 0x8C, 0xAC, 0x7B, 0x26, 0xA8, 0x05, 0x68, 0x02, 0xAE, 0x38, 0x9B, 0x9C, 0xE1, 0xC5,
-    0x07, 0xFC, 0xC4, 0x4D, 0x25, 0xC9, 0x06, 0xE9, 0x23, 0xF9, 0x96, 0x9E, 0xC6, 0x3F, 0xE5, 0x0F,
-    0x8E, 0x1E, 0xE1, 0xAA, 0xC3, 0xFF, 0x50, 0x55, 0x46, 0xD4, 0xBE, 0x13, 0x39, 0x64, 0x22, 0x05,
-    0x48, 0xD6, 0x4A, 0xA1, 0x21, 0x9F, 0x8C, 0x5D, 0x51, 0x89, 0xC7, 0xC4, 0x46, 0x96, 0xE7, 0xC0,
-    0xD3, 0xE2, 0x99, 0x06, 0xC7, 0x5B, 0x27, 0x27, 0x7C, 0x8A, 0x69, 0xC9, 0x99, 0x6D, 0xD1, 0xE9,
-    0xFF, 0x56, 0xE6, 0xC8, 0x53, 0x94, 0x5A, 0x00, 0x17, 0x02, 0x20, 0x1E, 0xC0, 0x77, 0x67, 0x79,
-    0x0A, 0x93, 0x8B, 0x6F, 0xE7, 0xFF, 0xC8, 0x0F, 0x06, 0x18, 0x47, 0xF6, 0x76, 0x90, 0x08, 0x20,
-    0x6D, 0xE4, 0xD9, 0xC7, 0x7D, 0xA4, 0xEE, 0x9C, 0xCC, 0x73, 0x79, 0x9B, 0xE3, 0x30, 0xA6, 0x00,
-    0x02, 0x16, 0xC9, 0xE3, 0xF8, 0x85, 0xF1, 0xA4, 0x62, 0x95, 0x8D, 0xEA, 0x3E, 0xF9, 0xA2, 0x87,
-    0xF1, 0x9C, 0x4F, 0x6D, 0x65, 0xC6, 0x20, 0x01, 0xAA, 0xFA, 0x56, 0xF5, 0x11, 0x34, 0x60, 0xA2,
-    0x44, 0xAE, 0x04, 0x8F, 0x22, 0x27, 0x10, 0x7B, 0x57, 0x55, 0xCB, 0x3B, 0x65, 0x0E, 0xE3, 0x07,
-    0xC9, 0xAC, 0x8C, 0xE3, 0xF7, 0x83, 0xDB, 0x50, 0x0E, 0x40, 0x2E, 0x48, 0x61, 0xE8, 0x4F, 0x4F,
-    0x75, 0x3E, 0x57, 0xE1, 0x5B, 0x98, 0x4C, 0xCC, 0x4D, 0x44, 0xBF, 0x3C, 0xC8, 0xCD, 0xFE, 0x25,
-    0xA2, 0xC5, 0x17, 0xF8, 0xBB, 0x46, 0x7D, 0x33, 0x1E, 0xB5, 0x5B, 0x18, 0x12, 0x61, 0x14, 0xA5,
-    0x90, 0xBB, 0xD0, 0x7A, 0x77, 0x3C, 0xAB, 0x38, 0x59, 0x3D, 0xC9, 0x04, 0x4E, 0x51, 0x96, 0x2A,
-    0xE1, 0x67, 0x24, 0x71, 0x90, 0x66, 0x1F, 0xCA, 0x60, 0xB6, 0xA0, 0x0C, 0x4D, 0xBC, 0xDA, 0x12,
-    0x4D, 0x2C, 0x83, 0xEF, 0x33, 0xD1, 0x82, 0x4E, 0x14, 0x0D, 0x51, 0xC1, 0x96, 0x29, 0x19, 0x17,
-    0x7A, 0x25, 0x8D, 0xA0, 0x6A, 0xF7, 0x48, 0x4B, 0xC3, 0x53, 0x7A, 0xCE, 0x51, 0x09, 0x8A, 0xB3,
-    0xD5, 0x17, 0xD6, 0x2B, 0x2B, 0x63, 0x54, 0xCD, 0x30, 0x00, 0x7E, 0x1F, 0x08, 0x22, 0x95, 0x23,
-    0x32, 0xF2, 0xA9, 0xB0, 0x99, 0xF9, 0x95, 0x8D, 0x10, 0x0A, 0xA6, 0xA3, 0x6D, 0x70, 0x29, 0x53,
-    0x92, 0xED, 0x54, 0x0F, 0x6B, 0x9E, 0x48, 0x11, 0x84, 0xA7, 0x9D, 0x8E, 0x78, 0x06, 0xFB, 0xF8,
-    0xBA, 0x45, 0x84, 0xCA, 0xA2, 0xC2, 0x1E, 0x74, 0x84, 0xFD, 0xE7, 0x3F, 0xE4, 0x83, 0x94, 0x4E,
-    0xC4, 0x07, 0xF0, 0x5D, 0xD5, 0x80, 0x4B, 0xF3, 0x49, 0x2E, 0xB5, 0x18, 0x64, 0x78, 0xDC, 0x38,
-    0x30, 0x45, 0x62, 0x5C, 0xD1, 0xB4, 0xB0, 0x15, 0x1C, 0x48, 0x92, 0x0C, 0x0E, 0xD4, 0x3A, 0xC9,
-    0x1E, 0x7A, 0xE3, 0x50, 0x62, 0x85, 0x72, 0x5D, 0xEA, 0x61, 0x6E, 0x78, 0x18, 0x42, 0xD3, 0xA8,
-    0x12, 0x05, 0xB7, 0xA2, 0x05, 0x3E, 0x56, 0xEF, 0x20, 0x49, 0xF4, 0xB4, 0x44, 0x06, 0x9F, 0x0E,
-    0x2E, 0xA8, 0xD4, 0xC2, 0xE6, 0x85, 0x3F, 0x2C, 0xA0, 0x24, 0x9B, 0x2C, 0x7F, 0xA4, 0x90, 0x2C,
-    0xA5, 0x16, 0xDF, 0x58, 0x3C, 0x25, 0x8F, 0x52, 0xCB, 0xC6, 0x27, 0xA2, 0x01, 0x27, 0xE2, 0x1E,
-    0xAF, 0x22, 0x29, 0xC6, 0xA1, 0x85, 0xE4, 0x92, 0xC2, 0xB0, 0xDC, 0xE6, 0x0D, 0x0E, 0xF4, 0x3C,
-    0x36, 0x7F, 0x55, 0x09, 0xC1, 0xA9, 0x45, 0x2A, 0x2C, 0xE4, 0x8B, 0x9F, 0x40, 0xB6, 0x30, 0x5A,
-    0x17, 0x7B, 0xB5, 0x20, 0x1E, 0x49, 0x74, 0x97, 0xB8, 0xF8, 0xB8, 0x59, 0x65, 0x28, 0x4B, 0x0D,
-    0xB1, 0x5D, 0xF7, 0x4C, 0x88, 0xA1, 0xF2, 0x4F, 0x30, 0x9A, 0x60, 0xE7, 0x1D, 0xCC, 0x1E, 0x0D,
-    0x0C, 0xDE, 0xF1, 0xFA, 0xE5, 0x18, 0x8C, 0xA2, 0xEE, 0x46, 0xB3, 0x4E, 0x65, 0x57, 0xA4, 0x55,
-    0x10, 0x81, 0x3B, 0x35, 0x22, 0x3D, 0x7F, 0x91, 0x2B, 0x07, 0x15, 0xFD, 0xBA, 0x91, 0xCB, 0x95,
-    0xE2, 0x5C, 0x29, 0xDB, 0xE5, 0xDA, 0x83, 0x59, 0xA5, 0x7D, 0x9A, 0x74, 0x39, 0xB1, 0x50, 0x9C,
-    0xCE, 0x65, 0x83, 0x91, 0xCE, 0xAF, 0xD2, 0x8B, 0xE6, 0xD5, 0x93, 0x3E, 0xF5, 0x5C, 0xAD, 0x82,
-    0x21, 0xF8, 0xB2, 0x4C, 0x5A, 0xA5, 0x46, 0x8B, 0x0B, 0x2C, 0x4B, 0xE8, 0x7F, 0x7A, 0x69, 0x01,
-    0x32, 0xCF, 0x60, 0x32, 0x1A, 0xCB, 0x4A, 0x0A, 0x36, 0xC2, 0xAB, 0x88, 0xF1, 0xC9, 0x5B, 0x54,
-    0x1D, 0xC7, 0xC7, 0x92, 0x6D, 0x7F, 0xC9, 0x84, 0x25, 0x6E, 0x15, 0x9E, 0xCA, 0x67, 0xDC, 0x2F,
-    0x75, 0x53, 0xF9, 0xCC, 0x40, 0x93, 0xBC, 0x59, 0x6A, 0x7C, 0x80, 0x52, 0x59, 0x3A, 0x7C, 0x2B,
-    0xD4, 0xBC, 0x82, 0x7B, 0xE5, 0x31, 0xC3, 0x52, 0x4C, 0x28, 0x64, 0x96, 0xAD, 0x97, 0x8D, 0x5C,
-    0x7A, 0x3B, 0x70, 0xEB, 0x0D, 0x9F, 0x5B, 0x5C, 0xDF, 0x08, 0x84, 0xB0, 0xF5, 0x60, 0xAB, 0xE6,
-    0xBA, 0x22, 0x1A, 0x55, 0xBF, 0xE4, 0x14, 0xF9, 0xB4, 0x48, 0x98, 0x64, 0x3F, 0x7B, 0x47, 0xE5,
-    0xE5, 0xDD, 0x94, 0x7C, 0x4B, 0xD1, 0xF1, 0x2D, 0x59, 0xCF, 0x9F, 0xE9, 0x98, 0xC2, 0xCB, 0xF0,
-    0x67, 0x68, 0xFF, 0x1C, 0x36, 0xF3, 0xFB, 0x70, 0x63, 0xBF, 0x40, 0x8D, 0xE7, 0x7D, 0x1E, 0x87,
-    0xF4, 0xC6, 0xC5, 0x0E, 0x74, 0x15, 0xC5, 0x6F, 0xC0, 0x3A, 0xD4, 0x06, 0x04, 0x3F, 0x06, 0x80,
-    0x90, 0xB8, 0x8B, 0xB4, 0x4E, 0xC4, 0x1E, 0xED, 0x27, 0xE8, 0x75, 0xE9, 0xF8, 0x21, 0xF9, 0x98,
-    0x5B, 0x6E, 0xCD, 0xA3, 0x0B, 0x28, 0x05, 0x29, 0x2B, 0xDB, 0x91, 0x11, 0x4A, 0xAD, 0x74, 0x55,
-    0x78, 0x3A, 0x82, 0xB7, 0xB9, 0x0F, 0x9D, 0x91, 0x5C, 0x84, 0x4B, 0x64, 0x0D, 0xBA, 0xE7, 0x3B,
-    0xF2, 0x56, 0x69, 0xC7, 0x66, 0x6E, 0xE0, 0x24, 0x6D, 0x16, 0x38, 0x8C, 0xED, 0x81, 0x00, 0x5B,
-    0x5B, 0x6D, 0x08, 0x8B, 0xB5, 0x16, 0xDA, 0x68, 0x93, 0x40, 0xF5, 0x0E, 0x8F, 0xE3, 0x5D, 0x1A,
-    0x13, 0x85, 0x7B, 0x34, 0x8A, 0x99, 0xA2, 0x7B, 0x32, 0xBE, 0xD6, 0x5E, 0x16, 0xBB, 0x08, 0xB0,
-    0xD6, 0xBB, 0x2E, 0x0F, 0x10, 0x3E, 0xF5, 0x71, 0x07, 0xC2, 0x31, 0x58, 0x2B, 0x69, 0x36, 0x12,
-    0x03, 0x10, 0xEC, 0x6F, 0x4C, 0xD8, 0xD3, 0x60, 0x47, 0xF2, 0xC4, 0x5F, 0x21, 0x91, 0xC9, 0x0F,
-    0xC9, 0xBA, 0xBC, 0xD3, 0xC0, 0xA0, 0x45, 0xEA, 0x0B, 0xA0, 0x45, 0x40, 0xFF, 0xD8, 0xF4, 0xBD,
-    0x43, 0xB1, 0xF1, 0x7B, 0x94, 0xEC, 0x8C, 0xC4, 0xDF, 0x79, 0xB1, 0x7B, 0x0C, 0x08, 0x03, 0x6A,
-    0x47, 0x53, 0x49, 0xDA, 0x2A, 0x21, 0xCE, 0xB6, 0xD9, 0x41, 0x2D, 0x39, 0xBA, 0x38, 0x17, 0x6C,
-    0xD6, 0x3B, 0xF7, 0xDB, 0xF8, 0xD0, 0x6F, 0x55, 0xAB, 0x9A, 0x7A, 0xD1, 0x6F, 0x9D, 0x9A, 0x87,
-    0x74, 0x3E, 0x3A, 0xEE, 0x39, 0x15, 0xFF, 0x17, 0x8E, 0xEA, 0x81, 0x98, 0xF3, 0x6F, 0xFF, 0xAA,
-    0xF8, 0x98, 0x49, 0x1B, 0x4D, 0x11, 0xEF, 0xE9, 0x28, 0x25, 0x12, 0xB8, 0x3C, 0x1A, 0x3C, 0xD5,
-    0x84, 0x12, 0x6C, 0xF5, 0xE1, 0x03, 0x07, 0x55, 0x88, 0x2E, 0xEC, 0x3A, 0xBA, 0x60, 0x71, 0x48,
-    0x7C, 0x74, 0xD1, 0xA9, 0xA8, 0x14, 0x17, 0xFE, 0x39, 0xF3, 0x7F, 0x06, 0x91, 0x47, 0x11, 0x87,
-    0x58, 0xCC, 0x2B, 0x34, 0x10, 0xC5, 0x8C, 0xB3, 0x01, 0xE5, 0xF9, 0x58, 0xF2, 0x6C, 0x68, 0x0A,
-    0x9A, 0xC2, 0x40, 0x2E, 0xF7, 0x43, 0x23, 0xA5, 0xC9, 0xA5, 0x51, 0x32, 0x45, 0xF6, 0xE8, 0xEE,
-    0xC4, 0xD9, 0xD0, 0xC8, 0xB9, 0xD0, 0x08, 0x3A, 0x31, 0x7E, 0xD5, 0xE7, 0xD6, 0xDA, 0x4B, 0x7A,
-    0x0C, 0xA1, 0xFF, 0xC0, 0xCB, 0x20, 0x5A, 0x75, 0xAF, 0xAA, 0x1E, 0x4A, 0xD5, 0x7E, 0xAB, 0x82,
-    0x86, 0x3E, 0xAA, 0x67, 0xBF, 0x25, 0xF7, 0x7C, 0x7A, 0xAB, 0x5A, 0xE1, 0x09, 0x36, 0x3F, 0x44,
-    0x30, 0x17, 0xAD, 0x65, 0x0F, 0x11, 0xCC, 0xB5, 0x3E, 0x3D, 0xFC, 0xE7, 0xD8, 0xFF, 0x19, 0x31,
-    0x25, 0xDA, 0x5A, 0x5A, 0x4E, 0xC5, 0x2E, 0xC7, 0xB5, 0x11, 0xBA, 0x68, 0x88, 0x84, 0x11, 0xB3,
-    0x50, 0x67, 0xB3, 0xEA, 0x44, 0xDD, 0xCB, 0x14, 0x9C, 0x19, 0x6B, 0x1C, 0x11, 0xB5, 0xE9, 0xD7,
-    0x55, 0x7C, 0x88, 0x0B, 0xE4, 0x85, 0xC9, 0x1C, 0x30, 0x0E, 0x40, 0x03, 0xCD, 0xB9, 0x20, 0x4C,
-    0x7F, 0xE6, 0x54, 0x93, 0xA6, 0x44, 0xC1, 0x23, 0xC5, 0x0A, 0x76, 0x87, 0x3F, 0x3B, 0xB6, 0xC0,
-    0xF9, 0x80, 0x69, 0xE2, 0x5A, 0xE0, 0xB8, 0x8A, 0xD3, 0x23, 0xBB, 0x43, 0xDF, 0x52, 0xE2, 0x52,
-    0xDA, 0x19, 0xE9, 0x6D, 0x59, 0x2B, 0x90, 0xED, 0x6D, 0x88, 0x37, 0x31, 0xF4, 0xB0, 0x53, 0x0E,
-    0xE1, 0xAB, 0x37, 0x38, 0x36, 0xDA, 0x11, 0x0D, 0xD2, 0x8E, 0x28, 0x02, 0xA9, 0x5C, 0x9B, 0x9E,
-    0x8B, 0x2C, 0xD3, 0xEC, 0xFD, 0x39, 0xFC, 0x42, 0xDE, 0x3A, 0x93, 0x1F, 0x8D, 0xDE, 0xC3, 0x2C,
-    0x68, 0x40, 0xB6, 0xA0, 0x01, 0xF0, 0x5B, 0x50, 0x22, 0xD8, 0xAC, 0xCC, 0x55, 0x5D, 0x1B, 0x37,
-    0xBD, 0x50, 0xFA, 0x9E, 0xBA, 0xE0, 0x80, 0x49, 0xC4, 0x2D, 0x44, 0x3B, 0x00, 0x28, 0x3C, 0x59,
-    0xDB, 0x14, 0x4C, 0xA3, 0x98, 0xCB, 0x7E, 0x8C, 0x2E, 0x81, 0x28, 0xF1, 0xEC, 0x7D, 0x7C, 0x2A,
-    0x2F, 0xDF, 0x3A, 0xE1, 0x15, 0xB7, 0x0D, 0x7F, 0x2C, 0x01, 0x83, 0x7D, 0x70, 0x44, 0x14, 0x67,
-    0x32, 0x21, 0xA3, 0x97, 0x22, 0x66, 0x8C, 0x6C, 0xDE, 0xD1, 0xE9, 0x62, 0x2D, 0x15, 0x35, 0x64,
-    0x8E, 0xD0, 0x3B, 0xF2, 0x1F, 0xDA, 0x26, 0x1A, 0x29, 0x8E, 0xAD, 0xBE, 0x6B, 0xB7, 0xC9, 0x40,
-    0xCC, 0xB6, 0xD7, 0x36, 0x17, 0x08, 0x1D, 0x53, 0x2E, 0xBD, 0x92, 0x96, 0xFA, 0x72, 0xE1, 0xAA,
-    0x7E, 0xEC, 0xBD, 0x5A, 0x60, 0x1F, 0xFB, 0x75, 0x7B, 0xE9, 0x57, 0xFB, 0x86, 0xFF, 0x5A, 0xBD,
-    0xE5, 0xBF, 0xE6, 0xBF, 0xF2, 0xC6, 0x36, 0x9D, 0xFC, 0xD7, 0xC8, 0x2E, 0x26, 0x78, 0xF9, 0x6A,
-    0x56, 0x5F, 0x8B, 0xE5, 0x6B, 0xBE, 0x7C, 0x55, 0xA4, 0x7A, 0xDD, 0x8E, 0x87, 0x31, 0x2C, 0x15,
-    0xD6, 0xF5, 0xD7, 0xEE, 0x1C, 0xA4, 0x28, 0x5F, 0x17, 0x24, 0x6D, 0xE5, 0x99, 0xCE, 0x0C, 0xA2,
-    0x5D, 0xBE, 0x9E, 0x1E, 0xD5, 0x5A, 0x24, 0xB1, 0xDE, 0xD8, 0xD4, 0x5A, 0xD6, 0xE0, 0xAF, 0xEF,
-    0xBA, 0x56, 0x0B, 0x53, 0xFF, 0xCA, 0xBA, 0xD6, 0xBD, 0xBA, 0xF3, 0xEA, 0x80, 0x50, 0xAE, 0x5C,
-    0x47, 0x75, 0xC6, 0x99, 0xA2, 0x4B, 0xBF, 0x2E, 0xB3, 0xF8, 0xA7, 0xC7, 0xD8, 0xFA, 0xA5, 0x12,
-    0x25, 0xEA, 0xB3, 0x78, 0x08, 0xD7, 0x1C, 0x7B, 0xFE, 0xF4, 0x78, 0xF9, 0xE9, 0xB3, 0x61, 0x74,
-    0xE4, 0x4F, 0x5F, 0xBB, 0x65, 0x7C, 0x0D, 0x64, 0x8F, 0x26, 0xF8, 0x0A, 0x3E, 0xDF, 0x83, 0x8E,
-    0x9D, 0x80, 0xDF, 0xD7, 0xF6, 0xA3, 0x69, 0xDD, 0xB6, 0xA1, 0xCA, 0xE9, 0xF4, 0x51, 0x8D, 0x9F,
-    0x53, 0x4A, 0xB3, 0x36, 0x7F, 0xD5, 0xBA, 0x4F, 0x30, 0x92, 0x81, 0x27, 0xDA, 0x5B, 0xB7, 0x5B,
-    0x75, 0x7F, 0x3D, 0x06, 0x09, 0xA1, 0xD7, 0x1F, 0xDD, 0x91, 0x12, 0x54, 0x27, 0xC9, 0x5A, 0xC7,
-    0x06, 0x23, 0xA4, 0x00, 0x23, 0x97, 0xF6, 0xDA, 0xA2, 0x43, 0xDC, 0x52, 0x30, 0xEE, 0x06, 0x30,
-    0x30, 0xE5, 0x0E, 0xFD, 0x86, 0x83, 0xAC, 0x00, 0x6D, 0x4F, 0x33, 0x9B, 0x86, 0xE2, 0x7D, 0x8B,
-    0xC4, 0xED, 0x5D, 0xCB, 0x7A, 0x6F, 0xFF, 0xD3, 0xB2, 0xE7, 0xA2, 0xC3, 0xF3, 0x9C, 0x2A, 0xBE,
-    0x65, 0xFF, 0x9E, 0x53, 0xA8, 0x9D, 0x7D, 0x87, 0x93, 0xC2, 0x06, 0x1D, 0x11, 0x7C, 0xE0, 0xDE,
-    0x89, 0x2D, 0xA7, 0x6D, 0x19, 0xDB, 0xC3, 0x86, 0xE1, 0xCF, 0x0A, 0x8F, 0xA4, 0x03, 0x1A, 0xBC,
-    0xD9, 0x21, 0xD5, 0xB3, 0xC6, 0xA5, 0x6E, 0xD5, 0x03, 0x4F, 0x2B, 0xDD, 0xB9, 0xE8, 0x03, 0x73,
-    0x8E, 0xFB, 0x15, 0xE1, 0x1F, 0x01, 0x8E, 0xFD, 0x9B, 0xB4, 0x1B, 0x0D, 0x5A, 0x9F, 0x90, 0x06,
-    0x89, 0x3E, 0xC6, 0x04, 0x67, 0x34, 0x0E, 0x92, 0xCD, 0xE0, 0xDC, 0x79, 0x62, 0x02, 0x50, 0x34,
-    0xC6, 0x93, 0xA5, 0xA9, 0xD1, 0x9F, 0x6D, 0x43, 0x26, 0xB0, 0x6A, 0xC9, 0x56, 0x15, 0x3D, 0x45,
-    0x25, 0x30, 0x7A, 0x14, 0x6D, 0xD5, 0x5D, 0xE4, 0x94, 0xE0, 0xC9, 0xA3, 0x63, 0x78, 0x74, 0x67,
-    0x55, 0x62, 0x71, 0xAD, 0x14, 0x22, 0xC3, 0x5A, 0xBE, 0xD0, 0x1A, 0x8B, 0xE6, 0x5A, 0x6E, 0x29,
-    0x4D, 0xBB, 0x2A, 0xB2, 0x04, 0x9B, 0xF3, 0x14, 0xCE, 0xB4, 0x07, 0x85, 0xAB, 0x9D, 0x0C, 0x63,
-    0x33, 0x81, 0xC9, 0x2A, 0xD3, 0x07, 0x69, 0x57, 0xC8, 0x60, 0x28, 0xE8, 0x4B, 0x1F, 0x59, 0x47,
-    0xD4, 0xCA, 0x19, 0x16, 0xA5, 0x24, 0x80, 0xC9, 0x4B, 0xE9, 0x9A, 0xDD, 0x15, 0x8C, 0x88, 0x56,
-    0x1C, 0x8A, 0xAF, 0xA8, 0x5B, 0xCC, 0xAE, 0xD8, 0x86, 0x6C, 0xCD, 0x5E, 0x16, 0x97, 0x14, 0x17,
-    0x49, 0x41, 0xBD, 0x45, 0x0C, 0x12, 0xCD, 0xB1, 0x76, 0x85, 0xCF, 0x6B, 0xAD, 0xD2, 0x46, 0x18,
-    0xCD, 0x8D, 0xB8, 0xA6, 0xF1, 0x61, 0x7E, 0xD8, 0xAD, 0x28, 0xEB, 0x79, 0x14, 0x00, 0x4D, 0x3A,
-    0xC9, 0xE0, 0x6D, 0x29, 0xD8, 0x99, 0x78, 0xC4, 0x8A, 0xE8, 0x80, 0xBE, 0xA3, 0x51, 0x10, 0x36,
-    0x0A, 0x2F, 0xD0, 0x0F, 0x08, 0xF6, 0x73, 0x49, 0x10, 0x2B, 0x65, 0x84, 0xFF, 0xB1, 0x2D, 0x3A,
-    0x0E, 0x4C, 0x54, 0x00, 0x52, 0x9B, 0xF7, 0x28, 0xFF, 0x40, 0x02, 0x28, 0x44, 0x43, 0x6F, 0xB3,
-    0x8A, 0x00, 0x11, 0x25, 0x95, 0x22, 0x1A, 0x64, 0x20, 0xE0, 0xD6, 0x1C, 0x94, 0xAF, 0x30, 0x3F,
-    0x8A, 0x86, 0xD0, 0x55, 0xA1, 0x52, 0x90, 0xD8, 0x56, 0xB1, 0x81, 0xBD, 0x3B, 0xE6, 0x59, 0xC6,
-    0xC0, 0x9A, 0x0C, 0x51, 0xEE, 0xF3, 0x03, 0xC4, 0x60, 0xF2, 0x71, 0xA0, 0x4B, 0xA3, 0xD5, 0xA8,
-    0xFC, 0xC1, 0xD5, 0x29, 0x02, 0x41, 0xE0, 0x94, 0x6B, 0xF6, 0x2B, 0xBA, 0xB4, 0x57, 0x0D, 0xE2,
-    0xC0, 0xEA, 0x51, 0x00, 0x1E, 0x01, 0xE2, 0xDB, 0x72, 0xE4, 0x28, 0x4A, 0x47, 0xB4, 0xE4, 0x10,
-    0x05, 0x72, 0xC1, 0xAF, 0x57, 0xC0, 0xB7, 0x02, 0x70, 0xC4, 0xF1, 0x15, 0xA4, 0x83, 0xA1, 0x01,
-    0x16, 0x4D, 0x27, 0x20, 0x37, 0xDC, 0x8A, 0xB6, 0xC8, 0x1B, 0x47, 0xEF, 0x9B, 0xF2, 0xDE, 0xF7,
-    0x4B, 0x3F, 0xE4, 0xEF, 0x0A, 0xE7, 0xE2, 0xAF, 0xFD, 0x7A, 0x1D, 0x98, 0x67, 0xA7, 0x6B, 0xFC,
-    0x8C, 0x97, 0x65, 0x6C, 0x7E, 0xDE, 0xC6, 0x4D, 0xDD, 0xF8, 0xD9, 0x1B, 0x47, 0x00, 0xE3, 0x68,
-    0x20, 0x66, 0x44, 0x85, 0x50, 0x28, 0x61, 0x3C, 0x31, 0x8C, 0xA3, 0x87, 0x71, 0x24, 0x11, 0xC8,
-    0x44, 0x21, 0x0F, 0x21, 0x8C, 0xCC, 0x53, 0xD5, 0x76, 0xD1, 0x9F, 0xFF, 0x53, 0xE3, 0xF4, 0xC3,
-    0xDF, 0xD0, 0x38, 0x69, 0xB9, 0xBE, 0x96, 0x4A, 0xA5, 0x84, 0x61, 0x42, 0x4D, 0xE9, 0xCC, 0x37,
-    0x61, 0xFD, 0xF6, 0x85, 0x1C, 0xF8, 0x1F, 0xB7, 0x3C, 0x91, 0x74, 0x6C, 0x62, 0xF9, 0x8D, 0xF6,
-    0x0C, 0x32, 0x55, 0xCC, 0xDE, 0xBD, 0x5B, 0x0F, 0xE1, 0xF3, 0xC7, 0x7E, 0x29, 0xC2, 0x56, 0xC0,
-    0x06, 0xE9, 0x7E, 0x79, 0xF0, 0xCA, 0x15, 0x65, 0x28, 0xD0, 0xD5, 0x6A, 0xBE, 0x77, 0xC3, 0xB5,
-    0x7B, 0x74, 0xC0, 0x0F, 0x0E, 0x67, 0x58, 0x37, 0xB6, 0x77, 0x9C, 0xCB, 0x14, 0xB2, 0xA4, 0x30,
-    0x91, 0x45, 0xA0, 0xA1, 0xF4, 0xEC, 0xD3, 0x3C, 0x60, 0x0F, 0x31, 0x19, 0xFC, 0x51, 0x56, 0x90,
-    0x94, 0x08, 0xDF, 0xC9, 0x61, 0x21, 0xAF, 0xEB, 0x20, 0x43, 0x7C, 0x4D, 0x83, 0x94, 0x05, 0x4D,
-    0xF3, 0x52, 0x75, 0xCC, 0xB8, 0x56, 0x79, 0xF2, 0xB9, 0x9A, 0x2B, 0x9C, 0xD6, 0x77, 0x11, 0xBA,
-    0x26, 0x74, 0xA9, 0xEE, 0xEB, 0x5A, 0x43, 0xD7, 0xD5, 0xD1, 0xA3, 0xA7, 0x6B, 0xDE, 0x9E, 0x9B,
-    0x4C, 0x69, 0x9E, 0xE2, 0x65, 0x41, 0x81, 0x5B, 0x17, 0xC0, 0x55, 0xB8, 0xD3, 0xCB, 0xE1, 0x20,
-    0x73, 0x08, 0x44, 0x43, 0xE6, 0xCB, 0x2D, 0x02, 0xF6, 0x98, 0x4B, 0x75, 0x4D, 0xCE, 0x29, 0x56,
-    0xC0, 0xD5, 0x46, 0x76, 0xD1, 0x76, 0x1B, 0x30, 0xC6, 0x4D, 0x1C, 0xA4, 0x23, 0xF1, 0x94, 0x14,
-    0xA7, 0xD8, 0x91, 0xDA, 0x73, 0xF1, 0xBC, 0x0B, 0xA5, 0xEB, 0x10, 0x0B, 0x12, 0x66, 0x7D, 0x79,
-    0xAA, 0x0B, 0x76, 0x06, 0x5F, 0xA1, 0xC7, 0xF0, 0x0E, 0x24, 0x95, 0x82, 0xD2, 0x69, 0xE0, 0x99,
-    0x5B, 0xAD, 0x99, 0xBB, 0x9E, 0x83, 0xED, 0xE3, 0xDA, 0x09, 0xFF, 0x1F, 0xF1, 0xEC, 0x3A, 0x13,
-    0x45, 0xBA, 0x9E, 0x6B, 0x6D, 0x30, 0xC6, 0x4D, 0xB3, 0xEF, 0x79, 0xFE, 0xC4, 0x6F, 0x97, 0x67,
-    0x3E, 0xB3, 0x91, 0xE2, 0x02, 0x5B, 0xA8, 0xBC, 0x13, 0xB4, 0x04, 0xEB, 0x5F, 0x66, 0xD1, 0x56,
-    0x6E, 0x4A, 0xB9, 0x14, 0x20, 0x78, 0xC6, 0x79, 0x7C, 0x89, 0xAF, 0x95, 0x69, 0x2E, 0xC9, 0x0C,
-    0xED, 0xB0, 0xC7, 0xF1, 0x0D, 0x57, 0x80, 0x1C, 0x6E, 0xC0, 0x09, 0x6B, 0xA1, 0x85, 0x32, 0x3E,
-    0xC7, 0xA0, 0x32, 0xCA, 0x55, 0x52, 0xB4, 0xE0, 0xDF, 0xC1, 0xC9, 0x5C, 0xEA, 0x1D, 0x28, 0x91,
-    0xE8, 0xF2, 0x2D, 0xE5, 0x9E, 0xA2, 0x5D, 0xAD, 0x1C, 0xD9, 0x10, 0x8E, 0x12, 0x40, 0x29, 0x03,
-    0xE9, 0xFF, 0xCF, 0x9E, 0xF6, 0xEB, 0x76, 0xB4, 0xD5, 0xD2, 0x2F, 0xE7, 0xD1, 0x9E, 0x3A, 0xED,
-    0x8D, 0x13, 0x6F, 0x52, 0xEB, 0x92, 0xBF, 0x87, 0x55, 0x4F, 0xFC, 0x03, 0xAA, 0x34, 0xF4, 0x2F,
-    0xE0, 0x00, 0x64, 0xCB, 0xAF, 0xE6, 0x0E, 0xA4, 0x91, 0xFF, 0x25, 0x8F, 0x00, 0xC3, 0xF6, 0xE0,
-    0xC3, 0xA4, 0xB3, 0x54, 0xA9, 0x53, 0x9F, 0xA2, 0x21, 0x6E, 0xD4, 0xFA, 0x5F, 0x26, 0x2B, 0x87,
-    0x2C, 0x72, 0xE7, 0x0C, 0x45, 0x08, 0x76, 0x51, 0xF4, 0x8D, 0x97, 0x2F, 0xCF, 0xF0, 0x32, 0xE4,
-    0x3F, 0xA4, 0x4E, 0x9B, 0x0F, 0xAE, 0x07, 0x2C, 0xF4, 0x7D, 0x75, 0xA3, 0x6F, 0x03, 0x8D, 0x64,
-    0x1A, 0xB1, 0xCB, 0x79, 0x9F, 0xC1, 0x34, 0x3E, 0x81, 0x8B, 0x3F, 0x90, 0x39, 0x83, 0x06, 0x7E,
-    0x61, 0x35, 0x6A, 0x3B, 0xA1, 0x34, 0x1E, 0xA3, 0x39, 0x79, 0xAB, 0xB9, 0x9F, 0xE3, 0xD0, 0x52,
-    0x85, 0x14, 0x2E, 0x89, 0xDC, 0x00, 0xD4, 0x1C, 0x1C, 0x22, 0x63, 0x07, 0x57, 0x0C, 0xD0, 0xE6,
-    0x3A, 0x87, 0xF0, 0xC7, 0xBA, 0xC2, 0x50, 0xE0, 0x36, 0x49, 0x0F, 0x52, 0x7C, 0x3B, 0x3D, 0x10,
-    0xF0, 0x42, 0x56, 0x78, 0x66, 0x93, 0x83, 0xCB, 0x33, 0x2C, 0x4E, 0xD9, 0xE2, 0xDB, 0xE9, 0x4D,
-    0x49, 0x62, 0x65, 0xC4, 0x9B, 0x4D, 0xE9, 0xC6, 0xEE, 0xFA, 0xF9, 0xAC, 0xE8, 0x86, 0xFB, 0x16,
-    0xF9, 0x6F, 0x6E, 0x6A, 0x0D, 0x93, 0xDF, 0x7D, 0x3B, 0xAF, 0x5E, 0xFC, 0xE0, 0x91, 0xBB, 0xD6,
-    0x99, 0x2B, 0xAC, 0x6B, 0xF9, 0x5C, 0x13, 0x8D, 0xB8, 0x37, 0x23, 0xB7, 0x6D, 0xB6, 0x23, 0x66,
-    0x50, 0x64, 0x9C, 0x6D, 0x89, 0xEE, 0xF6, 0xE7, 0xC7, 0x73, 0x24, 0x6D, 0x10, 0x43, 0xA6, 0x5D,
-    0xE1, 0xCC, 0x31, 0xFA, 0xF9, 0x1B, 0x56, 0x90, 0x07, 0xB7, 0x4B, 0xBA, 0x5A, 0xE1, 0x43, 0x85,
-    0x87, 0xE9, 0xE7, 0xBE, 0xF9, 0x72, 0xA8, 0xD4, 0x8E, 0x75, 0x18, 0x32, 0x6E, 0x6E, 0x4F, 0x9C,
-    0x53, 0xE9, 0x62, 0xDF, 0xFA, 0xD6, 0xDD, 0x62, 0xE9, 0xC3, 0x41, 0x05, 0x42, 0x56, 0x17, 0x22,
-    0x17, 0xBB, 0x18, 0x69, 0x8D, 0xB8, 0x67, 0x4E, 0xDB, 0x7F, 0x2A, 0x2C, 0xBD, 0x98, 0x36, 0x34,
-    0x2C, 0x32, 0x09, 0xA8, 0x93, 0x91, 0x1D, 0x66, 0xC7, 0xCC, 0x6B, 0xAD, 0x39, 0x65, 0xAD, 0x1A,
-    0x91, 0x25, 0xD2, 0x27, 0x69, 0x2C, 0xAD, 0x5C, 0x33, 0xFD, 0x56, 0xEB, 0x32, 0x95, 0x24, 0x71,
-    0x3D, 0xD7, 0x2D, 0x67, 0x4E, 0xFC, 0x2B, 0x06, 0xCD, 0x49, 0xA1, 0x52, 0xB4, 0x57, 0x92, 0x20,
-    0x54, 0x24, 0xB3, 0x14, 0xE6, 0xB6, 0x29, 0xCF, 0xA4, 0xE4, 0x48, 0x83, 0x32, 0xB6, 0x31, 0xD8,
-    0xEC, 0x5F, 0x5B, 0xCA, 0xB6, 0xF7, 0x34, 0x87, 0xE6, 0x65, 0xCA, 0x1C, 0x8F, 0x61, 0xA9, 0xB2,
-    0x66, 0xF2, 0xE9, 0x7B, 0x35, 0x00, 0x97, 0x40, 0xDA, 0xF0, 0xC8, 0x50, 0xCD, 0x9F, 0x93, 0x22,
-    0xFA, 0xE4, 0x96, 0x24, 0x6B, 0x75, 0xDD, 0xD5, 0x6D, 0x93, 0xF3, 0x25, 0x5A, 0x06, 0x50, 0x6F,
-    0xD4, 0xEA, 0x28, 0x36, 0x22, 0x1F, 0xA5, 0x8B, 0x6B, 0x04, 0x89, 0x91, 0x2C, 0x4B, 0x1B, 0xF5,
-    0xB6, 0x2E, 0x75, 0x09, 0xB5, 0x2A, 0x83, 0x6E, 0xB4, 0x57, 0x2E, 0xC3, 0x6A, 0x4F, 0x5C, 0x83,
-    0xAD, 0xAC, 0xA7, 0x2A, 0x7E, 0xFC, 0x05, 0x0E, 0xF0, 0x18, 0x6D, 0x8D, 0x07, 0x2C, 0xF3, 0xDF,
-    0x31, 0x3F, 0x2C, 0xE7, 0xC5, 0x64, 0x89, 0x61, 0x76, 0x43, 0xE9, 0x68, 0xC1, 0x52, 0x52, 0x71,
-    0xCD, 0x83, 0x3A, 0xC0, 0x58, 0xD7, 0x30, 0x7D, 0x96, 0x6F, 0x69, 0x49, 0x0F, 0x62, 0x5B, 0x12,
-    0x0B, 0x68, 0x48, 0x68, 0x56, 0x8D, 0xD8, 0xCF, 0x34, 0xE4, 0xCE, 0x28, 0x15, 0xE3, 0xC8, 0xB0,
-    0x47, 0x5A, 0xD1, 0x64, 0xB6, 0xB9, 0xBE, 0x31, 0xBC, 0xC2, 0x06, 0x4D, 0x7A, 0x29, 0xD4, 0xAA,
-    0x91, 0x24, 0x11, 0x54, 0xE8, 0x65, 0x56, 0xF9, 0xE4, 0x74, 0xA6, 0x3C, 0x8F, 0x3F, 0x1C, 0x36,
-    0x08, 0xEF, 0x2A, 0x8B, 0xB6, 0x29, 0xBA, 0xE2, 0x1B, 0xA5, 0x68, 0x66, 0x29, 0x80, 0xB8, 0x5F,
-    0x0D, 0xAE, 0x25, 0x73, 0x59, 0x2A, 0xBE, 0x5B, 0x9E, 0xCD, 0xCF, 0xDD, 0x3B, 0x5E, 0x6B, 0x4E,
-    0xB5, 0xE5, 0xB8, 0x3A, 0x9C, 0xD1, 0x5A, 0x40, 0x99, 0x92, 0x90, 0x6B, 0xBB, 0x64, 0xAF, 0x1A,
-    0x63, 0x7F, 0xE5, 0xF2, 0x98, 0xCC, 0x42, 0xE2, 0xB5, 0x6D, 0x4D, 0xD7, 0xBE, 0x82, 0xC6, 0x0C,
-    0x08, 0xF3, 0x00, 0x58, 0x74, 0xF9, 0x59, 0xD2, 0xBF, 0x82, 0x9E, 0x95, 0x8E, 0x01, 0x1C, 0x91,
-    0x5E, 0xB5, 0x7F, 0xB1, 0xEF, 0x8E, 0x6E, 0xD7, 0x8B, 0x96, 0xD0, 0xE1, 0xF6, 0x59, 0x58, 0xD6,
-    0x6D, 0x8E, 0xE6, 0x09, 0x34, 0x4B, 0x41, 0x7C, 0x85, 0xDE, 0x3C, 0xB1, 0x9A, 0x05, 0x9D, 0xC5,
-    0x98, 0xC3, 0x62, 0xB0, 0x8D, 0x49, 0x6E, 0x36, 0x07, 0x01, 0x1A, 0x24, 0xF3, 0x6D, 0xF0, 0x1D,
-    0xE2, 0x2D, 0x0F, 0xA3, 0xFE, 0xC9, 0xA4, 0xE1, 0xA9, 0xD8, 0x39, 0xF4, 0xAF, 0x08, 0x2C, 0x74,
-    0xAE, 0xF0, 0x68, 0x5F, 0xE8, 0xB4, 0x6D, 0x3A, 0xD3, 0x26, 0x57, 0xB6, 0x49, 0xF7, 0xF7, 0x1D,
-    0x1C, 0xBE, 0xF3, 0x8B, 0xBC, 0x7B, 0x07, 0x72, 0x45, 0xCB, 0xF2, 0x6F, 0x41, 0xB5, 0x7B, 0x57,
-    0x2E, 0x4E, 0xAD, 0xAB, 0x8A, 0x07, 0x77, 0xCF, 0x15, 0x16, 0xEE, 0xAD, 0x60, 0xAA, 0xA2, 0x5C,
-    0x00, 0x29, 0x29, 0x5B, 0x66, 0xED, 0xA3, 0x1A, 0xF3, 0xD8, 0x58, 0x24, 0xCE, 0xFF, 0x4D, 0x6E,
-    0x01, 0x41, 0x6A, 0x77, 0x37, 0x5C, 0x4B, 0xEF, 0x99, 0x05, 0x7C, 0x52, 0xD5, 0x15, 0xE5, 0x12,
-    0x4B, 0xA3, 0xFD, 0xE4, 0xA9, 0x5F, 0x2D, 0xB6, 0x5B, 0x1C, 0x7E, 0xAD, 0xD7, 0xB5, 0xDA, 0xB2,
-    0xF9, 0x67, 0x48, 0x38, 0x8A, 0x13, 0x5E, 0xC2, 0x29, 0x0B, 0x58, 0xF1, 0xB9, 0x95, 0xEF, 0xA1,
-    0xF8, 0xE3, 0xBD, 0x5A, 0xDB, 0x2D, 0xA3, 0x4E, 0xE7, 0x82, 0xBA, 0x2A, 0x80, 0xA8, 0xD9, 0x9C,
-    0xDF, 0xB6, 0xE1, 0x70, 0xBE, 0x25, 0x44, 0xAD, 0x1F, 0x4C, 0xCC, 0x81, 0x8F, 0xCB, 0x85, 0x20,
-    0x84, 0xBD, 0xA5, 0x6B, 0xF2, 0x43, 0xF8, 0xC1, 0xDA, 0x97, 0x78, 0x28, 0x9A, 0xF8, 0x36, 0x69,
-    0x5A, 0x3A, 0x1F, 0x5B, 0x00, 0x86, 0x6C, 0xFA, 0xB6, 0x58, 0x4D, 0xB2, 0x77, 0x66, 0x19, 0xC0,
-    0xB8, 0xC6, 0x29, 0x8B, 0x61, 0x05, 0x15, 0xE6, 0x1F, 0xC8, 0x42, 0xFD, 0xCF, 0xCA, 0x88, 0x50,
-    0x85, 0xB9, 0xA4, 0xEA, 0x9C, 0xD8, 0xB9, 0x74, 0x5E, 0x4F, 0x9B, 0x25, 0x22, 0xB7, 0xBE, 0xBB,
-    0xFC, 0x2B, 0x8F, 0x10, 0x27, 0xD3, 0xAA, 0x70, 0x1F, 0xB8, 0x14, 0x73, 0xA7, 0x20, 0x4A, 0xE9,
-    0xDB, 0xB4, 0x5D, 0xBF, 0x45, 0x2E, 0x07, 0xD7, 0x9D, 0x9F, 0xBB, 0x4B, 0xB7, 0xCE, 0x59, 0xF7,
-    0x80, 0x6F, 0xD2, 0xB9, 0xCC, 0x6C, 0xA3, 0xAD, 0xCD, 0xE9, 0xD2, 0x2D, 0x39, 0x89, 0x4F, 0xE4,
-    0x8E, 0xB2, 0x65, 0x31, 0xAB, 0x83, 0xFB, 0xA4, 0x66, 0x21, 0xB6, 0x33, 0x17, 0xA5, 0xE4, 0x8D,
-    0x0D, 0xD2, 0x9E, 0x65, 0xDD, 0xE7, 0xD2, 0x4B, 0x40, 0xF3, 0xB6, 0xD1, 0xDD, 0x09, 0x92, 0xF9,
-    0x18, 0x3D, 0x48, 0x81, 0x73, 0x56, 0xB1, 0xD4, 0xD2, 0x4F, 0x8C, 0x7B, 0x12, 0x7D, 0x4A, 0x87,
-    0x65, 0xE7, 0xB1, 0x64, 0x4E, 0x7B, 0x93, 0x92, 0xA3, 0x49, 0xFB, 0x40, 0xE3, 0xE9, 0xAD, 0xF1,
-    0x0D, 0xE1, 0xA5, 0xF0, 0xF9, 0x62, 0xAA, 0xE6, 0x6E, 0x97, 0x00, 0x31, 0x02, 0x83, 0xA3, 0xA9,
-    0x34, 0x58, 0x24, 0xD3, 0xD2, 0xB9, 0xA0, 0x14, 0x95, 0x3E, 0x72, 0x21, 0x68, 0xE4, 0x61, 0x93,
-    0xDE, 0xAF, 0x6D, 0x57, 0x72, 0x86, 0x76, 0x5A, 0xA8, 0xC9, 0xA6, 0x4C, 0x88, 0x69, 0xEF, 0x07,
-    0xBA, 0x67, 0xCA, 0x64, 0xC4, 0x6D, 0xD7, 0xF8, 0xAE, 0xEB, 0x82, 0x0F, 0x41, 0xC9, 0xA0, 0x5F,
-    0xAD, 0xAD, 0x94, 0xC2, 0xFD, 0xC7, 0x5F, 0x5E, 0xB0, 0x3E, 0x09, 0xC5, 0xC2, 0xB5, 0x79, 0x0E,
-    0xEA, 0xD3, 0x12, 0x26, 0x39, 0xB4, 0x77, 0x7B, 0xF6, 0xEF, 0x25, 0x64, 0x38, 0x90, 0x22, 0x59,
-    0xA9, 0xBB, 0x6B, 0x24, 0x52, 0xD2, 0x1E, 0x1D, 0xD6, 0x42, 0x09, 0xCD, 0x8E, 0x8C, 0x57, 0x71,
-    0x5A, 0x8F, 0x6C, 0xF9, 0xDA, 0x42, 0xFA, 0x5C, 0xD1, 0xC5, 0x43, 0x4A, 0xF4, 0xBA, 0x93, 0x5E,
-    0xF8, 0xBA, 0xBF, 0x75, 0xFD, 0x83, 0xD2, 0x4D, 0x78, 0x36, 0x96, 0x75, 0xAB, 0x7E, 0xEC, 0x57,
-    0xA5, 0xB4, 0xFB, 0x81, 0x2C, 0xD0, 0xD4, 0x6A, 0x44, 0x3E, 0x9D, 0x01, 0xDB, 0xAF, 0x00, 0xD9,
-    0xE5, 0x70, 0x98, 0xBA, 0x5E, 0xCB, 0x75, 0x0B, 0xE9, 0xF2, 0x42, 0x3B, 0x05, 0x77, 0x3C, 0x5D,
-    0x1C, 0x68, 0x94, 0x9E, 0xD9, 0x51, 0x48, 0xBB, 0xBD, 0xD5, 0xEF, 0x6A, 0xAB, 0xB2, 0x7F, 0x8E,
-    0xDB, 0x84, 0x23, 0xB7, 0x6E, 0x5F, 0xA8, 0x7E, 0x41, 0x2E, 0x65, 0x92, 0xD1, 0x0E, 0xB2, 0x1B,
-    0xD9, 0x5B, 0x31, 0x7A, 0xAB, 0x97, 0xBE, 0xEE, 0xC1, 0x2F, 0xF4, 0xD0, 0x45, 0x28, 0xE6, 0x25,
-    0x7B, 0x5A, 0x3E, 0xE4, 0xD0, 0xF2, 0xB6, 0xD8, 0xB9, 0x5D, 0x0D, 0x22, 0x6D, 0x50, 0x69, 0x17,
-    0xA6, 0x3E, 0xC2, 0x9B, 0x1D, 0xEA, 0x2E, 0x1A, 0x9D, 0xD3, 0x03, 0x70, 0x52, 0x57, 0xCB, 0xC9,
-    0xA7, 0x28, 0x82, 0x6C, 0x96, 0x22, 0x86, 0xC9, 0x55, 0x90, 0xA4, 0xAA, 0xC2, 0x60, 0xD3, 0xB7,
-    0xA5, 0x35, 0xEB, 0xAE, 0x06, 0xB5, 0x6E, 0xB7, 0x20, 0x59, 0xF0, 0x06, 0x51, 0x71, 0xC9, 0x07,
-    0x92, 0x17, 0x74, 0x3B, 0x0F, 0xB0, 0xA2, 0xBD, 0x2C, 0x67, 0xD0, 0xBC, 0x54, 0xFC, 0x8B, 0x59,
-    0xD5, 0x5F, 0x45, 0x07, 0xDC, 0x32, 0xC7, 0x72, 0x59, 0xE6, 0x68, 0x97, 0x6E, 0x1D, 0x41, 0xB9,
-    0xA4, 0x51, 0x48, 0xE0, 0x2D, 0xB1, 0x7D, 0x55, 0xBF, 0xD4, 0x89, 0x6C, 0xB7, 0xEA, 0xC2, 0x69,
-    0xBD, 0xA5, 0x50, 0x10, 0xEC, 0x75, 0xF0, 0xB0, 0x5F, 0x64, 0x46, 0x1E, 0xFF, 0x7B, 0x87, 0x8B,
-    0x0E, 0x88, 0x48, 0x15, 0xCE, 0x31, 0x7D, 0x89, 0x6C, 0x88, 0x36, 0x53, 0x02, 0x8A, 0xD3, 0xAD,
-    0x69, 0x62, 0x69, 0x49, 0x9E, 0x81, 0xF5, 0x1C, 0xD9, 0xA3, 0x5B, 0xD2, 0xBF, 0xA7, 0x3D, 0x99,
-    0xEC, 0x2E, 0x65, 0x91, 0xB4, 0xD6, 0x19, 0xF3, 0x93, 0x3B, 0x70, 0xCB, 0x11, 0xFA, 0x88, 0x11,
-    0x73, 0x51, 0x08, 0xAF, 0x01, 0x33, 0x90, 0x80, 0x17, 0x05, 0x30, 0x96, 0xEE, 0x8B, 0x56, 0xDB,
-    0x42, 0x79, 0xBB, 0x88, 0x7A, 0x9B, 0xA1, 0x3B, 0x4F, 0x9C, 0xD9, 0x64, 0x64, 0x8F, 0x18, 0xBF,
-    0xC6, 0x40, 0xC4, 0xF2, 0xF5, 0x47, 0x0B, 0xFC, 0x47, 0x94, 0x13, 0x3E, 0x2E, 0xC9, 0x96, 0x65,
-    0xA9, 0xC2, 0x12, 0x2E, 0xA4, 0xFD, 0x11, 0x9F, 0xC8, 0x5A, 0xA6, 0x23, 0xF9, 0xE2, 0x56, 0x8B,
-    0x6C, 0x52, 0x62, 0x5B, 0x50, 0xE5, 0xD4, 0xAD, 0x2E, 0xA0, 0xCC, 0xF3, 0xEE, 0xCC, 0xC8, 0x92,
-    0x60, 0xA4, 0xE2, 0xDD, 0xC7, 0xA5, 0xA0, 0x56, 0x3F, 0x74, 0xE2, 0xE7, 0xE8, 0x8F, 0x90, 0x3D,
-    0x1F, 0x46, 0x07, 0x5F, 0x68, 0x35, 0xF3, 0x37, 0xA7, 0xD8, 0xB5, 0x17, 0xEC, 0x6D, 0x79, 0x4E,
-    0xA9, 0x8B, 0x88, 0x74, 0x97, 0x92, 0x2B, 0x51, 0xAC, 0x7B, 0x14, 0xC5, 0x3E, 0x8C, 0x2C, 0xEA,
-    0xE0, 0x27, 0x1E, 0xC4, 0xB5, 0x2F, 0xCC, 0x94, 0x7B, 0x5C, 0x2A, 0x8B, 0xEB, 0x88, 0x2D, 0x96,
-    0xD9, 0x7C, 0x1E, 0x0D, 0x7F, 0xF6, 0x07, 0x58, 0x3D, 0xF2, 0x3D, 0x59, 0x54, 0xF4, 0x5D, 0x91,
-    0x81, 0x37, 0x46, 0xF3, 0x21, 0x7E, 0x62, 0x09, 0x5C, 0x39, 0x5D, 0xAF, 0x46, 0x04, 0xFF, 0xF5,
-    0x28, 0x45, 0x92, 0x5E, 0x0E, 0x1D, 0xC7, 0x04, 0x2C, 0xFD, 0xF9, 0x08, 0x63, 0x56, 0x8C, 0xB2,
-    0x57, 0x89, 0x34, 0x5C, 0x56, 0x3D, 0x12, 0xA3, 0x7A, 0xDD, 0xF8, 0x8F, 0x7E, 0xD0, 0x59, 0xDA,
-    0x32, 0x27, 0x01, 0xD7, 0x46, 0x5C, 0x55, 0x08, 0x0E, 0x23, 0xF7, 0x04, 0x58, 0x2C, 0x70, 0x7A,
-    0xEC, 0xD6, 0xEF, 0xEC, 0xE4, 0x20, 0x69, 0x8E, 0x6E, 0xA8, 0xA4, 0x49, 0xFF, 0x20, 0x3D, 0xA3,
-    0xB7, 0x2E, 0x80, 0x44, 0xDA, 0x3F, 0xE5, 0xC0, 0xEC, 0x65, 0x76, 0x4F, 0xA4, 0x66, 0x2F, 0x73,
-    0x4A, 0x37, 0x72, 0x24, 0xF4, 0x7A, 0xBA, 0x7B, 0x34, 0x28, 0x48, 0x31, 0xDF, 0x18, 0x72, 0xC6,
-    0x45, 0x52, 0x97, 0x0E, 0xFC, 0xD1, 0x47, 0x8C, 0x97, 0xC4, 0x8C, 0xB5, 0x27, 0x94, 0xE2, 0xB6,
-    0x5C, 0x6A, 0xE4, 0xD6, 0x11, 0xDE, 0x77, 0x8C, 0x4B, 0x8B, 0x2D, 0xC9, 0x4F, 0xCE, 0xEB, 0x26,
-    0xB0, 0xCD, 0x08, 0xA4, 0x06, 0xB8, 0x94, 0xEC, 0x30, 0xC6, 0x8E, 0x25, 0xB0, 0x67, 0xA2, 0xE5,
-    0xA7, 0x6A, 0xB7, 0x3B, 0x8F, 0x0E, 0x5E, 0x90, 0x95, 0x07, 0xDF, 0xFA, 0xF0, 0xB5, 0x8B, 0x27,
-    0x9B, 0x43, 0xE6, 0xFA, 0x4D, 0x05, 0x05, 0x64, 0xF5, 0x1A, 0xD6, 0x6D, 0x3D, 0xF5, 0xEA, 0xE5,
-    0x7B, 0x01, 0x80, 0x43, 0x9C, 0x85, 0x54, 0x0D, 0x58, 0xC4, 0x69, 0x89, 0x2D, 0xC1, 0x23, 0x53,
-    0x71, 0xC1, 0x0E, 0x4C, 0xE2, 0x80, 0x12, 0xA8, 0x04, 0x56, 0xBF, 0xF0, 0xDA, 0x0D, 0x66, 0x13,
-    0xFD, 0xB5, 0xEE, 0x65, 0x3B, 0x98, 0xD0, 0xAF, 0xBC, 0xD7, 0x28, 0x42, 0x42, 0x00, 0xD7, 0x63,
-    0x1B, 0xEC, 0x23, 0xF4, 0xD6, 0x2D, 0x33, 0x96, 0x36, 0xE4, 0x7E, 0x85, 0x31, 0xEB, 0xA6, 0x19,
-    0x57, 0xDC, 0x4E, 0xE2, 0xC9, 0x66, 0xD5, 0x4D, 0x5E, 0xC5, 0x9B, 0x9C, 0xBC, 0x30, 0x2D, 0x08,
-    0x33, 0x60, 0x63, 0x26, 0xCB, 0xE1, 0xC9, 0x6F, 0x95, 0x55, 0xAE, 0x0F, 0x5A, 0xDB, 0x85, 0x2B,
-    0x71, 0xA9, 0xAF, 0xEB, 0x02, 0xC3, 0x61, 0xDD, 0x8A, 0x92, 0x37, 0xE6, 0x77, 0x4E, 0xC7, 0x3E,
-    0xE6, 0x1C, 0x2B, 0xBC, 0x51, 0xFC, 0x0B, 0x6E, 0xE8, 0x7B, 0xB3, 0xD1, 0x96, 0x01, 0x04, 0x08,
-    0xC1, 0x60, 0x7E, 0xAB, 0xF6, 0x70, 0xA9, 0x0A, 0xEC, 0x7C, 0x55, 0xA0, 0xFE, 0x30, 0x55, 0x81,
-    0x0B, 0xF9, 0xE5, 0x18, 0xE6, 0x38, 0xE6, 0x58, 0xE6, 0x78, 0xE6, 0x98, 0xE6, 0xB8, 0xE6, 0xD8,
-    0xE6, 0xF8, 0xE6, 0x18, 0xE7, 0x38, 0xE7, 0x58, 0xA7, 0xBC, 0x73, 0xCC, 0x73, 0xDC, 0x73, 0xEC,
-    0x73, 0xFC, 0x73, 0x0C, 0x74, 0x1C, 0x74, 0x2C, 0x74, 0x3C, 0x74, 0x4C, 0x74, 0x5C, 0xF4, 0x6C,
-    0x7C, 0x14, 0x1F, 0x11, 0x39, 0x50, 0x18, 0x40, 0x41, 0x0C, 0x25, 0xCC, 0x24, 0xEC, 0x09, 0xD6,
-    0x35, 0x86, 0xBC, 0xD4, 0xB4, 0xE1, 0x41, 0x7E, 0x5C, 0x79, 0x7D, 0x41, 0x24, 0xB9, 0x63, 0xCD,
-    0x03, 0x17, 0x81, 0xE2, 0x70, 0x36, 0x33, 0x4A, 0xC1, 0x9E, 0x8B, 0x3B, 0x06, 0xBC, 0xC4, 0x36,
-    0x50, 0xB3, 0x6C, 0xC1, 0x85, 0x55, 0x5C, 0x89, 0x2C, 0x69, 0xB0, 0x58, 0xE8, 0xC5, 0xCA, 0x05,
-    0xA6, 0xBA, 0x1A, 0x54, 0xEE, 0xB7, 0x59, 0xEA, 0xFC, 0x26, 0x11, 0x82, 0xD5, 0x38, 0xEE, 0x3E,
-    0x69, 0x7A, 0xA3, 0xAD, 0x5C, 0xE9, 0x19, 0x53, 0xA1, 0x09, 0xA0, 0xA6, 0xAB, 0x0A, 0xA7, 0xC0,
-    0x35, 0x3C, 0x46, 0x33, 0x7A, 0xD2, 0x8C, 0x64, 0xD1, 0x0C, 0x34, 0x21, 0xB5, 0xBC, 0x79, 0x6A,
-    0x47, 0x03, 0xCD, 0x4F, 0x0E, 0x55, 0x33, 0x72, 0xAF, 0x19, 0xA9, 0x68, 0xC6, 0x3B, 0x8D, 0x43,
-    0xDA, 0x66, 0x17, 0x69, 0xC7, 0x9C, 0x9D, 0xC5, 0xBE, 0xA4, 0xCD, 0x6B, 0x49, 0x1E, 0xFA, 0x71,
-    0x71, 0x9D, 0xEB, 0x43, 0xF3, 0xCD, 0x82, 0x6E, 0x73, 0xBD, 0xFC, 0x7D, 0x4D, 0x65, 0x47, 0xB7,
-    0x8D, 0xC3, 0xB9, 0xA6, 0xEF, 0x87, 0xE0, 0x53, 0x81, 0x5A, 0xE7, 0x4C, 0x37, 0xDD, 0x7A, 0x43,
-    0xF7, 0xF4, 0x18, 0xE4, 0x44, 0x62, 0x5D, 0xF6, 0xDA, 0xCA, 0x89, 0x7C, 0x74, 0xA1, 0xEF, 0x36,
-    0x47, 0x1B, 0x44, 0xDD, 0x85, 0xBC, 0x3B, 0x28, 0x63, 0x30, 0x74, 0xA2, 0x1E, 0x42, 0xAC, 0x91,
-    0xCD, 0x6C, 0xC3, 0xAB, 0x6E, 0xA7, 0x98, 0x9B, 0x9B, 0xD1, 0x0C, 0x65, 0x1B, 0xF0, 0xBE, 0xB0,
-    0x53, 0xCE, 0xCC, 0xFC, 0xBE, 0xB5, 0xFF, 0xCE, 0x1C, 0x9D, 0x89, 0x32, 0x35, 0x12, 0xED, 0xC9,
-    0x6D, 0xFB, 0xF4, 0x75, 0xAD, 0xBF, 0x74, 0xB5, 0xEC, 0xB4, 0x32, 0x25, 0x8A, 0xD0, 0x36, 0xB5,
-    0x14, 0x27, 0xBA, 0x58, 0xB6, 0x7C, 0x9A, 0xA4, 0x35, 0xA8, 0xE2, 0xCD, 0x6C, 0x3A, 0xC1, 0x85,
-    0x8A, 0xB5, 0x05, 0x49, 0x9B, 0xA5, 0x01, 0xD0, 0x85, 0xEA, 0xB2, 0xE9, 0x66, 0xD5, 0xFA, 0xAD,
-    0x38, 0x2E, 0x27, 0x50, 0x85, 0x7A, 0xA3, 0xF4, 0xDE, 0x7C, 0x7E, 0x94, 0x6E, 0xD0, 0xF2, 0x3A,
-    0xF1, 0xBB, 0xDA, 0xE5, 0x4D, 0xD1, 0x66, 0x7D, 0xDE, 0xE7, 0x5D, 0x3C, 0x65, 0x73, 0x3A, 0x04,
-    0xF6, 0x45, 0xFB, 0x83, 0x91, 0x57, 0x0B, 0x7C, 0x30, 0x4B, 0x8E, 0xA2, 0xAB, 0xD2, 0x03, 0xEB,
-    0x2A, 0x24, 0xD8, 0xA0, 0xE0, 0x4D, 0xC8, 0xED, 0x4F, 0x2D, 0x6F, 0xB2, 0xDB, 0x55, 0x58, 0x5F,
-    0xC5, 0x06, 0xE6, 0xA9, 0x3B, 0xE1, 0xD1, 0x82, 0x77, 0x8B, 0x94, 0x0A, 0x14, 0xE5, 0xB6, 0x56,
-    0x60, 0xD5, 0x7B, 0x83, 0x0B, 0x61, 0x58, 0xE4, 0x73, 0xAD, 0x94, 0x2D, 0x99, 0x2F, 0x61, 0x2D,
-    0x03, 0xDA, 0x3F, 0xE2, 0x45, 0xEB, 0x33, 0x36, 0x06, 0xEC, 0xA0, 0x45, 0x58, 0x35, 0xDD, 0x1B,
-    0xE6, 0xD9, 0x96, 0x99, 0x38, 0x82, 0xC7, 0xBC, 0x09, 0x32, 0x9B, 0xBB, 0xAA, 0x47, 0x1F, 0xF7,
-    0x2F, 0x65, 0x6B, 0x00, 0xD9, 0x6D, 0x6D, 0xEB, 0x22, 0x80, 0x4A, 0x30, 0x99, 0xC9, 0x63, 0xB3,
-    0x92, 0x91, 0x57, 0xEB, 0x82, 0x48, 0xB9, 0x9C, 0xE8, 0x3C, 0x0A, 0x56, 0x4D, 0x17, 0x60, 0xCE,
-    0x0A, 0x12, 0xB7, 0xB0, 0x21, 0x00, 0xC3, 0xB1, 0x01, 0xAC, 0xEC, 0xFF, 0x5A, 0x3F, 0x7E, 0xFB,
-    0x57, 0x5F, 0x45, 0xE5, 0xBA, 0xD4, 0xC0, 0x0D, 0xD2, 0x58, 0xBB, 0x8B, 0xF2, 0x7C, 0x8B, 0xCD,
-    0xA0, 0x51, 0xE3, 0x84, 0x25, 0xF8, 0x0C, 0x0C, 0xC1, 0xD7, 0x80, 0xEA, 0x63, 0x3F, 0x69, 0xD7,
-    0xFA, 0x81, 0xB5, 0xA2, 0x32, 0x46, 0xBB, 0x18, 0x02, 0xE9, 0x4E, 0xD3, 0x8A, 0x65, 0xEB, 0xF3,
-    0xC8, 0x67, 0xA4, 0xE7, 0x5A, 0x1A, 0x08, 0x64, 0x6F, 0xCB, 0xDE, 0xB7, 0xF4, 0x9E, 0xAD, 0x81,
-    0x17, 0x6D, 0xC1, 0x6D, 0xF0, 0xBC, 0x9B, 0x6B, 0x3A, 0xC9, 0x5A, 0xF5, 0x8A, 0x97, 0xAA, 0x7F,
-    0x17, 0xC8, 0x0C, 0xD3, 0xED, 0xFA, 0xC1, 0xF5, 0x2B, 0x6F, 0x93, 0x23, 0xBB, 0x3C, 0x3E, 0x3F,
-    0x71, 0xF4, 0x93, 0x63, 0x75, 0x3B, 0xEA, 0xD5, 0x68, 0xEA, 0x56, 0xDD, 0xE3, 0x1A, 0x1B, 0x9B,
-    0x58, 0xB6, 0xA2, 0x75, 0x87, 0x25, 0xF0, 0x3F, 0x82, 0x1A, 0x1D, 0x0B, 0x44, 0x8F, 0x7D, 0x02,
-    0xC5, 0x7A, 0x43, 0x98, 0xA5, 0xC0, 0xDB, 0x7B, 0x16, 0x15, 0xA3, 0xDF, 0x96, 0x20, 0x91, 0x13,
-    0xD3, 0xEA, 0x44, 0xE3, 0x48, 0xE3, 0xF0, 0xB5, 0xF3, 0x9D, 0x9E, 0x8A, 0xBA, 0xAB, 0x3D, 0x5B,
-    0x0C, 0x6B, 0xDC, 0x9F, 0x69, 0xC6, 0x3D, 0xE7, 0xC1, 0xAD, 0xAB, 0x14, 0xAE, 0xB7, 0x51, 0xD1,
-    0xBD, 0xB9, 0x43, 0xCD, 0xE6, 0x9F, 0x3E, 0x3A, 0x16, 0xE8, 0x3C, 0xD0, 0xB6, 0x66, 0x61, 0x97,
-    0xAE, 0x21, 0x22, 0x76, 0x0C, 0xF2, 0x2C, 0xB5, 0x5F, 0x5A, 0x74, 0x70, 0x3B, 0xBD, 0x4B, 0xF9,
-    0xD9, 0x6D, 0x44, 0xA5, 0x22, 0xA7, 0xC8, 0x8C, 0x2E, 0x8F, 0xB2, 0x13, 0x57, 0xC6, 0x74, 0x97,
-    0x4C, 0x5D, 0xAA, 0xEE, 0x36, 0xF7, 0x88, 0xEC, 0xB2, 0x77, 0x20, 0x3A, 0xA5, 0xDC, 0x12, 0x16,
-    0xC7, 0xE6, 0x12, 0xF5, 0x1D, 0xDF, 0xEF, 0xDA, 0xFA, 0xC5, 0xFB, 0xFD, 0x23, 0x11, 0x7D, 0xDD,
-    0x2E, 0x42, 0xB7, 0x25, 0x7B, 0xF6, 0xC8, 0x6F, 0xA8, 0x15, 0xC8, 0x4E, 0x2A, 0x3B, 0x17, 0xC3,
-    0xF9, 0xB6, 0xC9, 0x44, 0xB6, 0xB5, 0x64, 0x3C, 0xD0, 0x6E, 0x0E, 0x64, 0x27, 0x20, 0x6C, 0x29,
-    0x8A, 0x6D, 0xBE, 0x42, 0x3F, 0xA6, 0xD0, 0x1A, 0xB3, 0x02, 0xC7, 0xCE, 0xAD, 0xF2, 0x73, 0x58,
-    0xAC, 0xA2, 0x15, 0x17, 0x49, 0xDF, 0x93, 0xCD, 0x91, 0x0B, 0xF7, 0x9E, 0xF3, 0xAB, 0xAD, 0x1E,
-    0xB9, 0xF7, 0xDC, 0xFF, 0x22, 0x47, 0x6E, 0x6C, 0x79, 0x57, 0x30, 0x0E, 0xE9, 0xB0, 0x0C, 0x24,
-    0x1E, 0x85, 0x33, 0xB9, 0xDB, 0x3F, 0xEB, 0x0C, 0x74, 0xED, 0x3A, 0xC1, 0x83, 0x3B, 0x97, 0x05,
-    0xBD, 0x4F, 0x2E, 0x83, 0x28, 0xB3, 0x7C, 0xB6, 0xE4, 0x16, 0x14, 0xC0, 0x62, 0x6F, 0x69, 0x50,
-    0x8C, 0xE7, 0xCD, 0xAB, 0xA8, 0x4B, 0x84, 0xF6, 0xD9, 0x2B, 0x58, 0xC5, 0xDA, 0xED, 0x40, 0xE2,
-    0xF7, 0x2F, 0x0B, 0x69, 0xE2, 0x0B, 0x08, 0xAA, 0x01, 0xCB, 0xB4, 0x58, 0x74, 0xD9, 0x70, 0x59,
-    0x2C, 0xB5, 0x74, 0xA6, 0xE8, 0x6E, 0x2C, 0xEF, 0x6D, 0x4A, 0xDD, 0x4D, 0x45, 0xBB, 0x76, 0x64,
-    0x17, 0x65, 0xBF, 0x10, 0x2B, 0x3B, 0x91, 0x6D, 0xBC, 0x72, 0x64, 0xA8, 0x1C, 0xDF, 0x3E, 0xA7,
-    0x9D, 0x29, 0xE6, 0xEC, 0x6E, 0xE8, 0x89, 0x5F, 0xD8, 0x6F, 0x1E, 0x5E, 0xD8, 0x7F, 0x76, 0xC9,
-    0xF8, 0xE0, 0xDA, 0x57, 0x14, 0xA0, 0xFC, 0x6F, 0xBD, 0x55, 0xBF, 0x8F, 0xDC, 0x44, 0x14, 0x7E,
-    0xB6, 0xB9, 0x58, 0x3A, 0x4B, 0x19, 0x0A, 0x0E, 0xA1, 0x2B, 0x98, 0x16, 0x45, 0x70, 0x6E, 0x52,
-    0xB2, 0x37, 0x96, 0xAE, 0xA0, 0x48, 0xB3, 0xC5, 0xAD, 0x28, 0x68, 0x53, 0x5D, 0x73, 0x0D, 0x05,
-    0x45, 0x88, 0x7D, 0xA1, 0xA4, 0x60, 0x1B, 0xFA, 0x2B, 0x2E, 0x52, 0xB4, 0xCD, 0xB5, 0x11, 0xBA,
-    0xC3, 0xCE, 0x9D, 0x44, 0x43, 0x63, 0x85, 0x7F, 0xC0, 0x89, 0x90, 0x10, 0x0D, 0x4C, 0x24, 0x23,
-    0x86, 0xDC, 0xD8, 0x8F, 0xEF, 0x8D, 0x37, 0xE1, 0xB7, 0xD2, 0x31, 0xEB, 0x9D, 0xD9, 0x9D, 0x79,
-    0xF3, 0x66, 0xDE, 0xF7, 0x7D, 0xEF, 0xD9, 0x74, 0x54, 0x76, 0x54, 0x77, 0xC4, 0xE1, 0x09, 0x4D,
-    0x57, 0xAA, 0x51, 0x5D, 0x66, 0xD3, 0x3E, 0x71, 0x44, 0x06, 0x33, 0xCA, 0x12, 0x65, 0x4C, 0x94,
-    0x72, 0x4F, 0x09, 0x73, 0x95, 0x8C, 0x99, 0x8F, 0x07, 0x32, 0xCD, 0x3E, 0xD1, 0x3C, 0xEE, 0x66,
-    0xDA, 0xED, 0x9A, 0xE1, 0xFC, 0x6E, 0xE9, 0xCF, 0xF3, 0xFE, 0x4C, 0xAD, 0xDD, 0xBC, 0x11, 0xD7,
-    0x3C, 0x2A, 0xE6, 0x31, 0x67, 0x66, 0x33, 0xAE, 0xEE, 0x13, 0x6D, 0x2C, 0x56, 0x84, 0x3F, 0xDC,
-    0x4A, 0xE7, 0xA4, 0xFB, 0x71, 0xB2, 0xDD, 0x28, 0x68, 0x5E, 0x17, 0xF9, 0x53, 0xCC, 0xA4, 0x58,
-    0xC1, 0xAE, 0x2A, 0x93, 0xEB, 0xCC, 0x71, 0xA6, 0x57, 0xF8, 0xE4, 0xDE, 0xB8, 0xDA, 0x2D, 0xE6,
-    0x89, 0xD3, 0x5D, 0x7D, 0x6F, 0x54, 0xBD, 0x79, 0xCC, 0xB7, 0x06, 0x63, 0xF9, 0x62, 0xB5, 0xFD,
-    0x40, 0x57, 0x75, 0x75, 0x3D, 0xEA, 0xF3, 0xAA, 0x17, 0x5F, 0x45, 0xE6, 0x60, 0x3D, 0xFB, 0xF4,
-    0xBC, 0xF4, 0xA6, 0x57, 0x2D, 0x29, 0x47, 0xC9, 0x48, 0xC6, 0x92, 0xF2, 0xC4, 0x0D, 0x7E, 0x24,
-    0x5C, 0x44, 0xDC, 0xEA, 0x01, 0xE1, 0x14, 0xD3, 0xF1, 0xA6, 0x8A, 0x07, 0x6D, 0xB5, 0xCD, 0x06,
-    0xC4, 0xC6, 0x03, 0x11, 0x23, 0xE0, 0xBA, 0x99, 0x82, 0x7F, 0x8D, 0xD6, 0x9B, 0xF1, 0x24, 0x8C,
-    0x4D, 0x14, 0x71, 0x83, 0x87, 0x4A, 0x4B, 0xB5, 0xA5, 0xDC, 0xAF, 0x7D, 0xC8, 0x52, 0x43, 0x40,
-    0x48, 0x8F, 0xB0, 0xC3, 0x41, 0x0E, 0x98, 0x15, 0xE2, 0x2A, 0x9F, 0x26, 0xEA, 0x81, 0xD8, 0x8B,
-    0x01, 0xDB, 0x98, 0xDB, 0x84, 0x2B, 0xC5, 0x62, 0x6B, 0x3C, 0xD5, 0xBD, 0x6C, 0xCF, 0xFE, 0xB2,
-    0xBD, 0x74, 0x84, 0xF5, 0xB0, 0x7D, 0x08, 0x13, 0x44, 0x3E, 0xF2, 0xA5, 0xAB, 0x7B, 0xB6, 0xA9,
-    0x9D, 0x40, 0x56, 0x4D, 0xD2, 0x63, 0xB3, 0x1E, 0xB1, 0x3E, 0x92, 0x16, 0x1B, 0xB3, 0xDA, 0x07,
-    0x82, 0xBE, 0x66, 0xFE, 0x66, 0x75, 0x0A, 0xFA, 0xEA, 0x22, 0xB0, 0x07, 0x4F, 0x7A, 0xE2, 0xA5,
-    0x48, 0xAC, 0x6E, 0xBE, 0x4E, 0x7F, 0xE1, 0x6F, 0xBD, 0x6E, 0x6E, 0x62, 0x22, 0x6D, 0xEA, 0xD4,
-    0xE5, 0x54, 0x47, 0x3E, 0xB6, 0xC1, 0xC2, 0x21, 0x6C, 0x6E, 0xCC, 0xA0, 0xB8, 0x3D, 0xEC, 0xE9,
-    0x3D, 0xCC, 0xDC, 0xA6, 0xF2, 0xFB, 0x92, 0x73, 0x70, 0x93, 0x76, 0x49, 0x17, 0x30, 0xA6, 0xF7,
-    0xF5, 0xF8, 0xD1, 0xF2, 0x5D, 0x5A, 0x06, 0xFA, 0xE8, 0x90, 0xB9, 0x29, 0x99, 0x7B, 0xC3, 0x3C,
-    0xE4, 0x2C, 0x5C, 0x2F, 0x92, 0x31, 0x1D, 0xD5, 0xA0, 0x07, 0xE3, 0x8D, 0xCF, 0xFA, 0xBC, 0xE5,
-    0x3D, 0x60, 0x5C, 0x5E, 0xB2, 0xF2, 0xE5, 0x33, 0x5C, 0x6E, 0xFB, 0xE4, 0x1F, 0x4C, 0xE5, 0x5C,
-    0x28, 0x6E, 0x12, 0x6E, 0x23, 0x70, 0x0F, 0x68, 0x01, 0x01, 0xC0, 0x41, 0xF8, 0x00, 0x42, 0x09,
-    0x57, 0x8E, 0xCE, 0x68, 0x97, 0x72, 0xAB, 0xC6, 0x0D, 0x75, 0xC1, 0x1D, 0x5B, 0x68, 0x97, 0xDE,
-    0x2E, 0xF2, 0xCE, 0x58, 0x03, 0xFA, 0x14, 0xA8, 0xB5, 0xEC, 0x35, 0xD3, 0x61, 0x15, 0x71, 0x32,
-    0x26, 0x03, 0xC4, 0xE3, 0x54, 0x9F, 0x63, 0xD5, 0x74, 0x07, 0xCB, 0xCD, 0xD5, 0xEA, 0x08, 0xEA,
-    0xC2, 0x1D, 0xF7, 0x18, 0x7B, 0x1B, 0xCE, 0x7A, 0xDD, 0x71, 0x02, 0x21, 0xB7, 0x78, 0xCA, 0x2E,
-    0x03, 0x13, 0x4F, 0x85, 0x28, 0x06, 0x70, 0x8C, 0x03, 0x23, 0xD1, 0x41, 0xCC, 0x02, 0xD2, 0x04,
-    0x0D, 0x5A, 0x5E, 0x91, 0xE8, 0x89, 0xA8, 0x84, 0xDA, 0x14, 0x2E, 0x8A, 0x84, 0xC0, 0x96, 0x1F,
-    0xB8, 0xD0, 0x2E, 0xC5, 0x91, 0x94, 0xB9, 0x60, 0x17, 0x3B, 0xD5, 0x70, 0xE7, 0x73, 0x56, 0x97,
-    0x57, 0x57, 0xAE, 0xD4, 0x9C, 0x59, 0xEE, 0x76, 0x93, 0x69, 0x91, 0xA2, 0x39, 0xB2, 0xE2, 0x11,
-    0xE4, 0x0E, 0xA9, 0xAF, 0x05, 0x14, 0x12, 0x66, 0x00, 0x79, 0x00, 0x9E, 0x07, 0x24, 0xCC, 0x09,
-    0x5C, 0x54, 0xDC, 0x06, 0x17, 0xBF, 0x5E, 0xB9, 0x5A, 0xB3, 0xEA, 0xB8, 0xBB, 0x9B, 0x04, 0x95,
-    0x6F, 0x2D, 0x16, 0x0B, 0xD8, 0xF1, 0x25, 0xBE, 0x4F, 0xF0, 0x45, 0x62, 0x76, 0x12, 0xA9, 0x6A,
-    0x0F, 0xEF, 0x8D, 0xA9, 0xD5, 0x30, 0xD9, 0x5E, 0x6E, 0x2F, 0x27, 0x60, 0x00, 0x4D, 0x8F, 0x0F,
-    0x62, 0xCF, 0x70, 0x9C, 0xE8, 0x03, 0x97, 0x1E, 0xC4, 0x0D, 0xC6, 0xCE, 0xF0, 0x80, 0xE9, 0x66,
-    0x8C, 0xBD, 0x6A, 0xCD, 0x91, 0x4F, 0x7A, 0x5C, 0x0D, 0xF3, 0xD6, 0xF0, 0x18, 0x2D, 0x16, 0x45,
-    0x34, 0x9E, 0x01, 0x8C, 0xE6, 0x2B, 0xB6, 0x33, 0x73, 0x47, 0xEB, 0x1D, 0xF5, 0xF9, 0x17, 0x7B,
-    0x97, 0xDF, 0x89, 0xD6, 0xC8, 0x76, 0xC9, 0x4F, 0x94, 0x76, 0x94, 0x17, 0x00, 0x69, 0x67, 0x16,
-    0x2D, 0x6F, 0xD3, 0x7F, 0x54, 0x83, 0x4F, 0x22, 0x9F, 0x39, 0xFD, 0x84, 0x3F, 0xE8, 0xB7, 0x5E,
-    0x00, 0xA9, 0xE0, 0x02, 0xA4, 0x53, 0x66, 0x27, 0x78, 0x05, 0x9A, 0xE4, 0x05, 0x16, 0xAF, 0x6A,
-    0x52, 0x07, 0xE2, 0x11, 0x50, 0x43, 0x55, 0x54, 0x3F, 0xE6, 0x02, 0xA5, 0xA0, 0xD9, 0x7C, 0x70,
-    0x70, 0x4C, 0x20, 0xB9, 0x62, 0x11, 0x01, 0x5F, 0x08, 0xD7, 0x0D, 0xEF, 0x79, 0x65, 0xCB, 0x23,
-    0x30, 0xB6, 0x75, 0x50, 0x37, 0x02, 0x77, 0x2C, 0x15, 0x08, 0x62, 0x1D, 0x36, 0xE6, 0x7F, 0x38,
-    0xDC, 0x17, 0x09, 0xB7, 0x82, 0x3C, 0x42, 0xE7, 0xAE, 0x7C, 0xBE, 0xFA, 0x92, 0xA2, 0x93, 0x6B,
-    0xC7, 0xCA, 0x9A, 0xA6, 0x2C, 0xC6, 0x04, 0x12, 0x0E, 0x3F, 0x8F, 0xA0, 0x97, 0xCC, 0xE1, 0x67,
-    0x5B, 0x3E, 0xE2, 0x10, 0x86, 0x9C, 0x05, 0x8E, 0xBC, 0x81, 0x6A, 0x74, 0x0F, 0x75, 0x4A, 0xB9,
-    0xB8, 0x11, 0xF2, 0x42, 0xCA, 0x4B, 0x14, 0x00, 0x40, 0x7C, 0xD1, 0xF8, 0xCC, 0x41, 0x51, 0x7D,
-    0x0D, 0x6D, 0x0D, 0xA6, 0x82, 0xCA, 0x18, 0xB2, 0x3B, 0x85, 0xC4, 0xF4, 0xCF, 0xA0, 0x2F, 0xE5,
-    0x0C, 0x96, 0xA7, 0x55, 0xC8, 0x48, 0x89, 0xB0, 0x15, 0x11, 0xC9, 0xE6, 0x28, 0x68, 0x2F, 0xB0,
-    0xFE, 0x50, 0xBA, 0x3B, 0xD2, 0xCD, 0x42, 0xCD, 0x91, 0x6E, 0x47, 0xBA, 0xB7, 0xFE, 0x86, 0xCF,
-    0xFE, 0x34, 0xF0, 0x34, 0x94, 0xD5, 0x54, 0xA2, 0x26, 0x2E, 0x74, 0x70, 0x45, 0xD9, 0xF0, 0x4A,
-    0x94, 0xC1, 0xD5, 0xA2, 0x40, 0x5D, 0x42, 0x1E, 0x0E, 0xC8, 0x4E, 0x06, 0x7C, 0x15, 0xB2, 0xC7,
-    0xA3, 0x52, 0x19, 0x0E, 0x85, 0xDC, 0x70, 0x24, 0x43, 0xCE, 0x15, 0x96, 0xDB, 0x94, 0xBB, 0x48,
-    0xF2, 0x66, 0x9C, 0x43, 0xE0, 0xA8, 0x3D, 0xEB, 0xCA, 0xD8, 0x4C, 0xC7, 0xDA, 0x7F, 0x3B, 0xE2,
-    0xB0, 0x8F, 0x8F, 0xE1, 0xBA, 0x35, 0x0D, 0x34, 0x98, 0x82, 0xCF, 0x5B, 0x3D, 0x17, 0x48, 0x58,
-    0x79, 0x1F, 0xC5, 0x21, 0x35, 0xB2, 0x71, 0x6D, 0x9A, 0x8E, 0x74, 0x03, 0xD9, 0xE8, 0x61, 0x55,
-    0x23, 0xCF, 0x0B, 0x6D, 0x31, 0x24, 0x90, 0xAA, 0xA7, 0xCD, 0xEE, 0xA5, 0x95, 0xB4, 0x6B, 0x38,
-    0x5C, 0x03, 0xBF, 0xDD, 0x50, 0x9B, 0xFE, 0x97, 0xF6, 0xB1, 0xBC, 0xA9, 0xD6, 0x75, 0xA2, 0x78,
-    0x5D, 0x65, 0xF6, 0xE6, 0x75, 0x79, 0x73, 0xA0, 0x7D, 0x16, 0xE2, 0x9E, 0x69, 0xE1, 0x00, 0x55,
-    0xB0, 0x90, 0xCA, 0x11, 0xF3, 0xF3, 0x53, 0x5C, 0x1B, 0x99, 0xC8, 0xBF, 0xE1, 0xBA, 0xCC, 0x27,
-    0xC2, 0xF3, 0xC1, 0xFD, 0x22, 0xFC, 0x41, 0xEC, 0xA2, 0x51, 0x81, 0x60, 0x49, 0x6F, 0x02, 0x5D,
-    0x6C, 0x8D, 0x38, 0xF8, 0x89, 0xFC, 0x3B, 0xA1, 0xB8, 0x54, 0x7F, 0x3E, 0x7B, 0xFD, 0x16, 0x8B,
-    0x7B, 0xBC, 0x60, 0xD1, 0x3E, 0x04, 0x80, 0x81, 0x1D, 0x49, 0xED, 0xD0, 0xDC, 0x7A, 0x9C, 0x0C,
-    0xD5, 0xC4, 0x3F, 0x5D, 0x2F, 0x5E, 0x7A, 0xF8, 0x1D, 0xDD, 0x7D, 0xC1, 0xAF, 0xDD, 0xE6, 0x95,
-    0x1F, 0x2F, 0x6F, 0xF4, 0x38, 0x23, 0xA2, 0x60, 0x16, 0x23, 0x03, 0x95, 0x80, 0x72, 0x57, 0xA0,
-    0x1E, 0x4C, 0xB8, 0x2E, 0x30, 0x31, 0x69, 0xBB, 0x85, 0x17, 0x5E, 0x58, 0x05, 0xF4, 0x12, 0xCC,
-    0x78, 0xE1, 0x6D, 0x47, 0x53, 0x8C, 0xFE, 0x81, 0x24, 0x64, 0xEC, 0x45, 0x16, 0x59, 0x8C, 0x50,
-    0xC4, 0x1D, 0x60, 0xBA, 0x88, 0x0A, 0x78, 0x50, 0xE9, 0x09, 0xA8, 0xBA, 0xE8, 0x22, 0x28, 0x6C,
-    0x93, 0xB6, 0x17, 0x59, 0x78, 0x61, 0xC6, 0xAE, 0x3B, 0x8B, 0x59, 0x84, 0x49, 0x64, 0x64, 0xEC,
-    0x59, 0x88, 0xB6, 0xA9, 0x98, 0xEF, 0x89, 0xE4, 0xD7, 0xF3, 0xFB, 0x9D, 0xF3, 0xF1, 0xDE, 0x27,
-    0xCB, 0x8E, 0x3C, 0x4E, 0xDA, 0x4C, 0x9F, 0x65, 0xBE, 0xF7, 0xEE, 0xE3, 0x25, 0x3F, 0x7E, 0xDF,
-    0xF9, 0xCE, 0xF9, 0x9D, 0x73, 0x7E, 0xE7, 0xDC, 0x20, 0xB0, 0xAF, 0x64, 0xC2, 0x71, 0xEB, 0xF8,
-    0x8B, 0x6B, 0x70, 0x2C, 0x7B, 0x1C, 0xB3, 0x29, 0x78, 0x98, 0xAF, 0xF0, 0x96, 0x73, 0xA3, 0xBC,
-    0xDF, 0xB9, 0x3E, 0x88, 0xE4, 0xD8, 0x06, 0xB1, 0x1C, 0xAB, 0x20, 0x19, 0xF1, 0xD7, 0x74, 0xE0,
-    0xA5, 0x78, 0xC1, 0xBC, 0xE3, 0xC5, 0x5B, 0x1C, 0x6B, 0x9C, 0x12, 0xC8, 0x89, 0x05, 0x8F, 0x41,
-    0xB0, 0xE1, 0x71, 0xEB, 0x5E, 0x2C, 0xFC, 0x60, 0xA2, 0x05, 0xC7, 0x78, 0xE6, 0x20, 0xE7, 0xC3,
-    0xC3, 0x22, 0x48, 0xE5, 0x9C, 0x26, 0xC8, 0x78, 0xCC, 0xF7, 0x8E, 0x25, 0x8F, 0x8E, 0x47, 0x3C,
-    0x44, 0x85, 0x6B, 0xE7, 0x5D, 0x29, 0xF7, 0xCB, 0x86, 0x6C, 0xC0, 0xDB, 0x13, 0xB9, 0x4C, 0xEC,
-    0x62, 0xDE, 0xE2, 0x0D, 0x9C, 0x76, 0x78, 0xF1, 0xF0, 0xE2, 0x67, 0x3F, 0xD4, 0xE6, 0xE8, 0xA6,
-    0x1B, 0x82, 0x50, 0xAE, 0x38, 0x71, 0x7C, 0xF2, 0xEE, 0x92, 0x03, 0xCC, 0x4E, 0x64, 0x1C, 0x7E,
-    0xCE, 0x38, 0xC0, 0x10, 0x8F, 0xE0, 0x67, 0x2E, 0xBF, 0x7B, 0x78, 0x35, 0xC0, 0x38, 0x07, 0xDC,
-    0x0E, 0x6F, 0xDE, 0xAE, 0x4F, 0x27, 0xA7, 0xD5, 0x9C, 0x81, 0x9C, 0xB3, 0x91, 0xF2, 0x1A, 0xF1,
-    0xA2, 0xB3, 0xFF, 0xE2, 0xE1, 0x25, 0xDE, 0xC8, 0xE9, 0x8D, 0x2A, 0x3E, 0x59, 0x17, 0x24, 0x0E,
-    0x93, 0x8B, 0x69, 0x5D, 0x38, 0x1A, 0x3C, 0x98, 0x7D, 0x5D, 0xE0, 0xAF, 0xB8, 0xB0, 0xBC, 0x09,
-    0x73, 0xE2, 0x26, 0x9C, 0x71, 0x72, 0x74, 0x2D, 0x48, 0x79, 0x83, 0xA0, 0x6E, 0x76, 0xA3, 0x0C,
-    0x12, 0x2E, 0x44, 0x50, 0x36, 0x3A, 0x66, 0x7D, 0x6D, 0x71, 0x18, 0x50, 0x89, 0xA5, 0xE3, 0xE5,
-    0xE5, 0x5B, 0xE2, 0xEE, 0xC9, 0x12, 0x06, 0xF9, 0x88, 0x27, 0xDA, 0xB8, 0x06, 0xA7, 0xC6, 0x53,
-    0x10, 0x4D, 0x5C, 0xBF, 0x54, 0xCE, 0x97, 0x07, 0x91, 0x7F, 0xFE, 0xB5, 0xFE, 0x0C, 0x1E, 0xCA,
-    0x55, 0xB5, 0xC3, 0x8A, 0x85, 0x32, 0x5A, 0x99, 0xF3, 0x84, 0x8B, 0xDB, 0xE4, 0xB7, 0x4F, 0xCF,
-    0x6A, 0xCA, 0xD1, 0xF3, 0xB9, 0x13, 0x95, 0x02, 0xAE, 0x33, 0x47, 0x56, 0x56, 0xBF, 0x46, 0xCE,
-    0xB8, 0x16, 0x31, 0x07, 0x99, 0x73, 0x22, 0x38, 0x29, 0xD1, 0xBC, 0x93, 0x2F, 0x2E, 0x81, 0x4A,
-    0x4D, 0x36, 0xAC, 0x2F, 0xA8, 0x30, 0xE9, 0x6C, 0x73, 0xFE, 0xB7, 0x5C, 0x30, 0x7B, 0xA1, 0xE7,
-    0x0B, 0x15, 0x27, 0x83, 0xC3, 0x18, 0x38, 0x3D, 0x78, 0x63, 0xC2, 0x37, 0x96, 0x10, 0xE3, 0x8D,
-    0x6B, 0x6D, 0x14, 0x8F, 0xFC, 0x00, 0xBF, 0xD6, 0x98, 0x37, 0x5D, 0xD9, 0xC8, 0x04, 0xBF, 0x4D,
-    0x67, 0x5E, 0xC8, 0x35, 0x38, 0x66, 0xFD, 0x46, 0x8E, 0x32, 0x41, 0xB8, 0xD2, 0x9F, 0x9B, 0xCC,
-    0xAB, 0xB0, 0x26, 0x5C, 0x58, 0xBC, 0x0D, 0x02, 0x76, 0xC8, 0x75, 0x6F, 0xBC, 0x58, 0x5C, 0x94,
-    0x3F, 0x17, 0x07, 0x6E, 0x88, 0xB8, 0x9E, 0x14, 0x88, 0x85, 0xEF, 0x73, 0x7C, 0x1F, 0xA6, 0x9E,
-    0xC7, 0x94, 0xF7, 0x0E, 0xAE, 0xB8, 0xBF, 0xFF, 0xF4, 0x44, 0xC5, 0x6E, 0x91, 0x07, 0xCC, 0xB8,
-    0x9A, 0x39, 0x25, 0x31, 0x87, 0x10, 0xC9, 0xB1, 0xF8, 0xF7, 0xF2, 0xDC, 0xF3, 0x6E, 0x57, 0xE9,
-    0xD4, 0x6C, 0x6C, 0xD3, 0xEB, 0x46, 0xE3, 0x9B, 0xB7, 0xB8, 0xAD, 0x7F, 0x77, 0xA8, 0xB2, 0x1B,
-    0xF3, 0x82, 0xF2, 0x9B, 0x9D, 0x57, 0xF1, 0xAD, 0x5D, 0x20, 0x67, 0xC8, 0x59, 0xEE, 0xF6, 0xC6,
-    0xC6, 0x3B, 0xDB, 0xA8, 0xF5, 0xE7, 0x98, 0x02, 0x1C, 0x9C, 0x77, 0xCB, 0x55, 0xDC, 0xF0, 0x03,
-    0x3E, 0xAC, 0x6C, 0x4C, 0x59, 0x20, 0xD9, 0x44, 0x18, 0x80, 0x5C, 0x48, 0xA6, 0x47, 0x56, 0x10,
-    0xBF, 0x2F, 0x72, 0xC9, 0x02, 0x82, 0x2B, 0x93, 0x21, 0x0A, 0x24, 0x5A, 0xB8, 0xBD, 0x1C, 0x7F,
-    0x17, 0x7D, 0x24, 0x6B, 0x24, 0xAB, 0x87, 0xD5, 0x80, 0x14, 0x4C, 0x41, 0xBA, 0x04, 0x07, 0xB7,
-    0x64, 0x20, 0xE1, 0xF5, 0xB3, 0xD7, 0x82, 0xF2, 0xB5, 0x45, 0xDE, 0x93, 0x77, 0x1B, 0xF7, 0xBD,
-    0x39, 0xC8, 0x07, 0xD7, 0x6E, 0xDD, 0x33, 0x9F, 0xA9, 0xC2, 0x1E, 0xBB, 0x66, 0x8F, 0x0F, 0x25,
-    0xC1, 0xD9, 0xC0, 0x2C, 0x70, 0x5F, 0xE3, 0xC9, 0xD2, 0xC1, 0x36, 0x09, 0x16, 0x85, 0x3B, 0x08,
-    0x4B, 0x18, 0x4F, 0xFE, 0xBC, 0x11, 0xCF, 0x5E, 0xA9, 0x9C, 0x6D, 0xFD, 0x79, 0xD0, 0x2E, 0x01,
-    0x24, 0x03, 0xCA, 0x86, 0x22, 0x93, 0x53, 0x01, 0x34, 0x2A, 0x45, 0x1C, 0x69, 0xB0, 0x8A, 0x21,
-    0xCF, 0x5A, 0x67, 0x3F, 0x1F, 0xF7, 0xB4, 0x30, 0xA5, 0xF2, 0xF4, 0xDF, 0x33, 0xFB, 0x7B, 0xB1,
-    0xD3, 0xCF, 0xAA, 0x3A, 0x4C, 0x78, 0x52, 0xD3, 0xE2, 0xD5, 0x4E, 0xC1, 0xC4, 0xA6, 0xD2, 0xDB,
-    0x9D, 0x96, 0x0F, 0xED, 0xEF, 0xDC, 0x1D, 0x91, 0xFD, 0xBD, 0xF3, 0xEF, 0x0F, 0x6F, 0x5F, 0xC0,
-    0xC5, 0x72, 0xAF, 0xBD, 0x9C, 0xEE, 0xBA, 0xC6, 0x2B, 0xB4, 0x2D, 0x15, 0x5A, 0xF0, 0x48, 0x7D,
-    0x7C, 0x5A, 0xDC, 0x28, 0x2B, 0x26, 0x64, 0xFE, 0x1D, 0xFE, 0xFD, 0x41, 0xD6, 0x86, 0xFA, 0xB2,
-    0x6E, 0xF9, 0xED, 0x18, 0x94, 0xBC, 0x5F, 0x1B, 0x4E, 0xF6, 0x72, 0xA7, 0x2F, 0xE7, 0xEE, 0x36,
-    0x5E, 0xDE, 0xA8, 0xCA, 0x55, 0xED, 0x89, 0x97, 0xDF, 0xBD, 0x35, 0xC8, 0x45, 0x36, 0x33, 0xD4,
-    0x8F, 0xBC, 0xDC, 0x07, 0x75, 0x11, 0xC9, 0xCB, 0xCD, 0x76, 0x96, 0x97, 0x83, 0x05, 0x92, 0xE3,
-    0x82, 0x68, 0x94, 0xA1, 0xC7, 0x23, 0xA4, 0x7E, 0x0E, 0x21, 0x1E, 0xB2, 0xC7, 0x64, 0xFF, 0x52,
-    0x8E, 0xEB, 0x01, 0x2F, 0x17, 0x36, 0x37, 0xC1, 0x99, 0xE2, 0x7E, 0x5D, 0x7F, 0x49, 0xBF, 0xE7,
-    0x9C, 0x48, 0xB9, 0x54, 0xB0, 0xC5, 0xFC, 0xD5, 0x05, 0x47, 0x9A, 0xF4, 0x41, 0xDC, 0x71, 0xA0,
-    0x01, 0xD6, 0x43, 0x14, 0x60, 0x22, 0xE7, 0x85, 0x73, 0xC0, 0xF1, 0xCB, 0x7B, 0xF2, 0x4A, 0x55,
-    0xC1, 0xA4, 0x56, 0xCD, 0xC9, 0x63, 0x70, 0xAB, 0xCA, 0xBC, 0xF2, 0x9B, 0x6B, 0x44, 0x1D, 0x27,
-    0x5D, 0x3C, 0x85, 0x22, 0xDC, 0x53, 0x90, 0xB7, 0x78, 0x8F, 0x8C, 0x7E, 0xAB, 0x8F, 0xD7, 0x88,
-    0xE2, 0x2B, 0x8B, 0x64, 0x8A, 0x87, 0x20, 0x1E, 0x2E, 0x88, 0xE9, 0xE2, 0x0C, 0xF6, 0x72, 0x5B,
-    0xB9, 0xCA, 0xBC, 0x59, 0xD4, 0x74, 0xC8, 0x93, 0x66, 0xB2, 0x33, 0xB7, 0x26, 0xCF, 0x29, 0xD5,
-    0x83, 0x2A, 0x7D, 0x6A, 0x87, 0x91, 0xC7, 0x01, 0xA6, 0xC3, 0xF5, 0x97, 0x5F, 0xAC, 0xEF, 0x5E,
-    0xBE, 0xE6, 0xC5, 0x48, 0xD7, 0x97, 0x52, 0xA0, 0xB2, 0x14, 0x9A, 0x5A, 0xAC, 0x28, 0x03, 0x77,
-    0x16, 0x5D, 0x2B, 0xAF, 0x98, 0x44, 0x01, 0xC8, 0xFB, 0x52, 0x57, 0xC9, 0x08, 0xB2, 0x05, 0x8F,
-    0x2F, 0x42, 0x8C, 0xE3, 0x88, 0x67, 0x2F, 0xB1, 0x16, 0xDC, 0x7C, 0x3C, 0x96, 0xCD, 0x46, 0x8E,
-    0xB5, 0x18, 0x09, 0x79, 0xD8, 0x6A, 0xEB, 0x64, 0xF5, 0xE4, 0xD8, 0x60, 0xCF, 0x5E, 0x68, 0x36,
-    0xA7, 0x26, 0x9A, 0x93, 0x18, 0x44, 0x1C, 0xD2, 0x96, 0xF2, 0xA7, 0x0F, 0xA3, 0x62, 0xB0, 0x59,
-    0xEE, 0x57, 0x62, 0x13, 0x96, 0x71, 0xEB, 0xA0, 0x61, 0x36, 0xEE, 0x71, 0x3C, 0x84, 0x6B, 0xA8,
-    0xD1, 0x3A, 0x1C, 0xB3, 0x01, 0x0F, 0x97, 0x4C, 0xB2, 0xB6, 0xA2, 0x24, 0x4A, 0xEE, 0x56, 0x6A,
-    0x6A, 0x15, 0xC2, 0x92, 0xAB, 0x91, 0xF3, 0x98, 0xF0, 0x18, 0xF3, 0xB8, 0xA5, 0xA8, 0x6E, 0x1C,
-    0x67, 0xA3, 0xB6, 0x93, 0x4C, 0xC0, 0x27, 0xEC, 0xB8, 0x5A, 0x66, 0x65, 0xEB, 0x12, 0xB9, 0x48,
-    0xE8, 0x5E, 0xA7, 0xBA, 0xED, 0x72, 0x11, 0xFD, 0x12, 0x0A, 0x19, 0x0A, 0x48, 0x75, 0xA0, 0x7D,
-    0xA9, 0xED, 0x31, 0x5B, 0x63, 0xFB, 0xCC, 0x76, 0xA8, 0x6A, 0xD9, 0x7D, 0x94, 0xA4, 0x9B, 0x4D,
-    0x64, 0xF8, 0xEC, 0x11, 0xDE, 0x08, 0xF5, 0x20, 0x6A, 0xAE, 0x9C, 0xB0, 0x33, 0x13, 0xA0, 0x17,
-    0x99, 0xB8, 0x11, 0x7A, 0xA7, 0x76, 0x45, 0x08, 0x83, 0x2E, 0x73, 0xDC, 0xE1, 0xAE, 0x11, 0x14,
-    0x6A, 0x27, 0x27, 0xE7, 0xA2, 0x4E, 0x93, 0x49, 0x6C, 0xB6, 0x9C, 0xFC, 0xBC, 0x93, 0x77, 0xA6,
-    0x43, 0xF9, 0x0E, 0xDE, 0x96, 0x8E, 0x32, 0x0D, 0xF9, 0xC7, 0x32, 0x6C, 0x99, 0x0B, 0xF7, 0x1A,
-    0x56, 0xC4, 0x0D, 0x58, 0x3B, 0xB7, 0x6C, 0xB9, 0x17, 0x9A, 0x7A, 0xC2, 0x05, 0x13, 0xD8, 0xA6,
-    0x79, 0xE3, 0xB0, 0xD7, 0xAA, 0xCC, 0x15, 0x91, 0xEB, 0xB7, 0x38, 0x79, 0x92, 0xF9, 0xC2, 0xE0,
-    0x0E, 0xAE, 0x05, 0x37, 0x64, 0xA6, 0x8E, 0x9F, 0x9D, 0x3D, 0x78, 0x89, 0x3C, 0x32, 0x80, 0xC4,
-    0x64, 0xC7, 0x0F, 0x85, 0x07, 0x81, 0x34, 0x44, 0xD4, 0x13, 0xE2, 0x03, 0xD1, 0x98, 0xF2, 0xAB,
-    0x3C, 0x82, 0xEC, 0x52, 0x51, 0x6E, 0x39, 0x96, 0x14, 0xCF, 0x1D, 0xCA, 0x92, 0x62, 0x21, 0x5E,
-    0xC0, 0x7A, 0xB8, 0x1F, 0x53, 0xAF, 0xFE, 0x74, 0xE0, 0xA2, 0xF4, 0x5C, 0xBF, 0x96, 0xC7, 0x8A,
-    0x0B, 0xC4, 0x89, 0x5B, 0x76, 0x90, 0x54, 0x27, 0x5C, 0x95, 0x1C, 0x4F, 0xBC, 0x80, 0x13, 0x13,
-    0xEA, 0x9B, 0x94, 0xE6, 0x29, 0x83, 0xBA, 0x92, 0x77, 0x62, 0xD8, 0xF9, 0xB1, 0x09, 0x14, 0xD6,
-    0xC0, 0x0C, 0x0E, 0xF0, 0x55, 0x0B, 0x95, 0x2E, 0x5B, 0x53, 0x46, 0x16, 0x4F, 0x66, 0x7C, 0xA0,
-    0xE9, 0x61, 0x5F, 0x0A, 0xE0, 0x24, 0x19, 0x66, 0x86, 0x45, 0x80, 0xB6, 0xD7, 0x87, 0x88, 0x76,
-    0xD7, 0x68, 0x78, 0x8D, 0xEE, 0x41, 0xD7, 0x10, 0x9B, 0x8E, 0x6B, 0x70, 0x4F, 0xD5, 0x2B, 0x5E,
-    0x19, 0xB9, 0xBF, 0x38, 0x38, 0x55, 0xC8, 0xFD, 0x6E, 0x0F, 0x98, 0xF4, 0xAB, 0x88, 0x9C, 0xF3,
-    0xDB, 0x86, 0xF0, 0x6D, 0x63, 0x9B, 0x55, 0x55, 0x6A, 0xC3, 0x27, 0x6C, 0xF9, 0x6C, 0x14, 0x61,
-    0x58, 0x92, 0x8D, 0x03, 0xB0, 0xDE, 0x2E, 0x00, 0x41, 0xF1, 0x84, 0x63, 0x3A, 0xE0, 0x98, 0xF7,
-    0x38, 0xD6, 0x8D, 0x4C, 0x97, 0x6C, 0x4B, 0x91, 0x2C, 0x19, 0x78, 0x3A, 0xCA, 0x55, 0x0E, 0xAF,
-    0xE8, 0x60, 0x26, 0x0E, 0x6C, 0xE2, 0x20, 0xD5, 0x76, 0x4F, 0x5B, 0x5A, 0x6D, 0x58, 0x8E, 0x74,
-    0x06, 0x20, 0x4A, 0x17, 0x98, 0xB0, 0x74, 0xA9, 0x47, 0xDC, 0x18, 0xE7, 0x4F, 0x0A, 0x17, 0x6B,
-    0xA7, 0x53, 0x10, 0xD8, 0xA1, 0xC0, 0x38, 0x28, 0xE7, 0x97, 0xA8, 0x0E, 0x3B, 0x1C, 0x66, 0xC2,
-    0x9C, 0x20, 0x1E, 0x65, 0xD6, 0x64, 0x06, 0x1D, 0x1E, 0x7A, 0xC1, 0x7C, 0x89, 0x3C, 0x74, 0xD1,
-    0xA4, 0x26, 0x23, 0xB7, 0x19, 0x02, 0x8C, 0x5F, 0x20, 0x00, 0x57, 0x4F, 0x4B, 0x93, 0xC1, 0x1D,
-    0x99, 0xE4, 0x0A, 0xFA, 0xB2, 0x10, 0x1D, 0x5A, 0x42, 0x91, 0xBE, 0x0A, 0xF5, 0x39, 0xE3, 0x6A,
-    0x70, 0x3A, 0x36, 0x86, 0x90, 0x7B, 0xD5, 0xF9, 0x5B, 0x9C, 0x2E, 0xCA, 0x26, 0x69, 0x44, 0xEF,
-    0x24, 0xAD, 0x98, 0x9E, 0xAC, 0x4D, 0xB0, 0xA4, 0xE9, 0xFF, 0xBE, 0xE5, 0x1A, 0x28, 0xCE, 0x0A,
-    0xCF, 0x8E, 0x67, 0xE1, 0xF3, 0x7B, 0x78, 0xA7, 0x6E, 0x4C, 0xE6, 0xFD, 0x89, 0x85, 0x2F, 0x8C,
-    0xE6, 0xC5, 0xD4, 0x7B, 0x70, 0x92, 0x36, 0xAD, 0x6E, 0xD7, 0x17, 0xD4, 0xBE, 0x96, 0xFD, 0x6A,
-    0x64, 0xD5, 0x7A, 0xDB, 0x0B, 0xCD, 0x8A, 0x2F, 0xF3, 0x1D, 0x9C, 0x54, 0xFB, 0x8C, 0xF9, 0x25,
-    0x8E, 0xC2, 0x6E, 0x2B, 0x56, 0x93, 0xEA, 0xF8, 0xE4, 0x8B, 0xD7, 0x4C, 0x19, 0x8F, 0x79, 0x0B,
-    0x04, 0x92, 0x37, 0x80, 0x1F, 0x65, 0x03, 0x44, 0xEF, 0x0A, 0x60, 0x7D, 0x07, 0x01, 0x94, 0xE9,
-    0x17, 0x39, 0x90, 0x9D, 0x27, 0x22, 0x29, 0xB6, 0x51, 0x06, 0xAB, 0xF0, 0x33, 0x26, 0x92, 0x4F,
-    0x86, 0x0D, 0x61, 0x29, 0x54, 0x73, 0xDD, 0xC9, 0x98, 0x43, 0x28, 0x03, 0xFA, 0x1A, 0xAE, 0xAB,
-    0x77, 0xC7, 0x86, 0xC7, 0x8A, 0x47, 0x5C, 0x43, 0x04, 0x1A, 0xD7, 0x98, 0xF0, 0xB3, 0x7A, 0x74,
-    0xF8, 0x3A, 0x5B, 0x63, 0x85, 0x39, 0x83, 0x1B, 0x02, 0x59, 0x75, 0xF9, 0xE8, 0xE0, 0x6D, 0xF8,
-    0x14, 0x84, 0x4A, 0xA7, 0x5E, 0x30, 0x0C, 0x8A, 0x47, 0xF7, 0xC0, 0x19, 0x0F, 0x73, 0x7C, 0xE9,
-    0x81, 0xC8, 0xFD, 0x5D, 0xC1, 0xC5, 0xD1, 0xE9, 0xC5, 0x70, 0x66, 0x66, 0x53, 0xBE, 0xEC, 0xBD,
-    0x3D, 0x51, 0x7A, 0x6A, 0xEB, 0xE5, 0x89, 0x5A, 0xD1, 0xD5, 0x44, 0xED, 0xE5, 0x28, 0x5A, 0x9F,
-    0x3F, 0x25, 0x4E, 0x74, 0x7E, 0x8C, 0x11, 0x84, 0xEE, 0x27, 0xCE, 0xE9, 0x14, 0x97, 0x63, 0xE9,
-    0x7E, 0xAC, 0xAB, 0xE4, 0x32, 0xF7, 0x0E, 0x7F, 0x0A, 0xDD, 0x9B, 0xEE, 0x63, 0xC3, 0x62, 0xF7,
-    0xDC, 0x89, 0xFE, 0x94, 0xAC, 0x3E, 0x25, 0x9D, 0x2F, 0x95, 0x92, 0x7C, 0xFD, 0x49, 0x2D, 0xA6,
-    0xA2, 0x34, 0xFF, 0x93, 0x79, 0x53, 0xE6, 0xE3, 0xBA, 0xD5, 0x77, 0xD1, 0x3F, 0x6F, 0x14, 0x1B,
-    0xFB, 0x0B, 0xF2, 0x3A, 0x91, 0x9B, 0xE4, 0xCE, 0xB3, 0x1A, 0xA9, 0x7C, 0xAC, 0x09, 0x30, 0xDD,
-    0x24, 0x1B, 0x10, 0x13, 0x94, 0xBA, 0x29, 0x16, 0x2B, 0x48, 0xBF, 0x57, 0xB6, 0xA7, 0x58, 0x81,
-    0x91, 0x86, 0xCD, 0xC1, 0x38, 0x60, 0xD7, 0xDD, 0x3A, 0x86, 0x78, 0x40, 0x71, 0x41, 0x5C, 0x4F,
-    0x6E, 0xD2, 0xDA, 0xF5, 0x86, 0x67, 0x68, 0x76, 0x4A, 0xAE, 0x4F, 0x21, 0x67, 0xC1, 0x8A, 0x0A,
-    0xBE, 0xDF, 0x5C, 0xE6, 0x34, 0x38, 0xAF, 0x80, 0xA0, 0x27, 0x44, 0xD1, 0xFC, 0x8B, 0xE2, 0xCA,
-    0x82, 0x41, 0xF7, 0x98, 0xE7, 0x2A, 0xB1, 0xCD, 0x59, 0x89, 0x7A, 0xBD, 0xFA, 0x4F, 0xC9, 0x8C,
-    0x05, 0x7F, 0x16, 0x9C, 0x95, 0x01, 0x27, 0xC7, 0xCF, 0x4E, 0x2B, 0x1C, 0x35, 0xE7, 0x45, 0x11,
-    0x41, 0x70, 0x65, 0x15, 0x64, 0xF3, 0x1C, 0xA1, 0xF7, 0xC5, 0x6F, 0x86, 0x32, 0x9F, 0xE9, 0xD9,
-    0x62, 0x70, 0xF2, 0x6F, 0x82, 0xCC, 0xE7, 0xF0, 0xB2, 0x8B, 0x58, 0xA4, 0x1C, 0xDB, 0xC7, 0xE1,
-    0xE4, 0x12, 0xD8, 0xA7, 0x95, 0x81, 0xC9, 0xC9, 0x5B, 0xAC, 0xA2, 0x60, 0x93, 0x3B, 0x38, 0x39,
-    0xFB, 0xC4, 0x09, 0x24, 0x7A, 0x6A, 0x96, 0x6D, 0x9E, 0x7F, 0xE8, 0xBE, 0x0F, 0xD4, 0x99, 0xF7,
-    0x38, 0xF9, 0xCE, 0x94, 0x12, 0xD3, 0x3E, 0x41, 0x58, 0xD8, 0xE5, 0x33, 0x96, 0x38, 0x06, 0x54,
-    0x72, 0x01, 0x15, 0x71, 0x9B, 0x72, 0xEA, 0x42, 0xA0, 0x0D, 0x28, 0x5A, 0x68, 0xFB, 0x88, 0x83,
-    0xCE, 0x7A, 0xC8, 0x6F, 0x32, 0x45, 0xF0, 0x28, 0xE7, 0x88, 0x08, 0x85, 0x06, 0xC1, 0xBD, 0x80,
-    0x63, 0xFD, 0x36, 0x41, 0xFB, 0x47, 0x90, 0xA5, 0xF4, 0x18, 0xC7, 0x78, 0x36, 0xF7, 0x94, 0xC6,
-    0x81, 0xD7, 0xF0, 0x8F, 0xCF, 0xEB, 0xF1, 0x98, 0x10, 0x28, 0xA9, 0x0C, 0x85, 0xFE, 0x24, 0xB7,
-    0xCA, 0x6F, 0xFE, 0x2B, 0x88, 0x54, 0x22, 0xE8, 0xB2, 0x63, 0xDC, 0x84, 0xCE, 0x2D, 0xF5, 0xAC,
-    0x0C, 0x54, 0xB4, 0x01, 0x64, 0xC4, 0xC3, 0xFC, 0x82, 0x1B, 0xB3, 0xE1, 0x05, 0x3A, 0x5E, 0x00,
-    0x3E, 0xE7, 0xF1, 0x73, 0x40, 0x54, 0xD3, 0x96, 0x5B, 0x1D, 0x56, 0x42, 0x54, 0x0F, 0x14, 0xA6,
-    0x88, 0x30, 0x8D, 0x13, 0x34, 0x66, 0x36, 0x44, 0xBC, 0x0B, 0xB4, 0x92, 0x6A, 0x1A, 0xF9, 0x09,
-    0x3A, 0x53, 0x74, 0x34, 0x74, 0x5C, 0x07, 0x2D, 0x2A, 0x27, 0x39, 0x3D, 0xA9, 0x82, 0xCF, 0xE3,
-    0x00, 0x85, 0x0B, 0xF8, 0x87, 0x82, 0xAC, 0x11, 0x11, 0x68, 0xE9, 0x15, 0xB6, 0x40, 0x5E, 0x87,
-    0xFC, 0x17, 0xAC, 0xCA, 0xBC, 0x82, 0x1A, 0x8E, 0xA1, 0xF8, 0x54, 0x3A, 0x4B, 0x13, 0x52, 0x91,
-    0x50, 0x08, 0x11, 0xFC, 0x85, 0x16, 0x0B, 0xCB, 0xE9, 0x87, 0x15, 0xEA, 0x72, 0x8A, 0x5D, 0x5F,
-    0x73, 0x99, 0x3E, 0x74, 0x32, 0x60, 0x57, 0x7F, 0xEC, 0x6A, 0x59, 0x54, 0xC1, 0x94, 0x58, 0x2E,
-    0xD9, 0x7F, 0x58, 0xA8, 0xCC, 0x7D, 0x24, 0x92, 0xB7, 0x40, 0x7B, 0xC8, 0x7C, 0x67, 0xEE, 0x0D,
-    0x31, 0x6E, 0xB2, 0xC4, 0x11, 0x80, 0x4F, 0xBA, 0x88, 0x43, 0x99, 0x8E, 0xE9, 0x24, 0x8F, 0x98,
-    0x0D, 0x67, 0x2E, 0xCA, 0x28, 0xF1, 0xC8, 0xF2, 0x44, 0x78, 0x34, 0x71, 0xBE, 0xE0, 0x73, 0xE6,
-    0xBD, 0x86, 0x8E, 0x12, 0x6E, 0x1D, 0xBC, 0x24, 0xAF, 0x84, 0x00, 0x0E, 0x15, 0x5F, 0x9B, 0x69,
-    0x3C, 0xF8, 0x5A, 0x03, 0x10, 0x20, 0x0F, 0x09, 0x83, 0x21, 0xEF, 0x16, 0xD9, 0xDA, 0xE0, 0xB5,
-    0x16, 0xBA, 0x8F, 0xAF, 0x8D, 0xB0, 0x22, 0xF4, 0x8A, 0xB1, 0x58, 0x32, 0xDD, 0x2F, 0x1E, 0x96,
-    0x93, 0xC6, 0x84, 0xCC, 0x09, 0xA9, 0x22, 0x75, 0xC7, 0xF9, 0x9A, 0x2A, 0x4F, 0x4C, 0x00, 0x95,
-    0x51, 0xEA, 0xD4, 0x83, 0x47, 0x9C, 0xA9, 0xD9, 0x72, 0x7A, 0xF5, 0xB5, 0x11, 0x7B, 0x2A, 0x52,
-    0xC5, 0x75, 0x41, 0xBD, 0xA7, 0x9A, 0x22, 0xB2, 0x71, 0x6B, 0xC4, 0x88, 0x7A, 0x77, 0x3C, 0x90,
-    0x93, 0xE0, 0x03, 0x64, 0x13, 0x4D, 0xD9, 0x96, 0xC0, 0x99, 0xF6, 0xB1, 0xD6, 0x07, 0xCF, 0x89,
-    0xD3, 0x89, 0xDF, 0x64, 0x19, 0x69, 0x1B, 0xEB, 0x56, 0x1D, 0x67, 0x1A, 0x26, 0x3C, 0x32, 0x84,
-    0x43, 0x56, 0x5A, 0x27, 0xA6, 0x52, 0x57, 0xBC, 0xA5, 0x93, 0xEA, 0x7A, 0xB8, 0x19, 0xD8, 0xF1,
-    0xA5, 0xFB, 0xC1, 0xB3, 0x66, 0x02, 0x10, 0xFC, 0xD1, 0xE0, 0x97, 0x3D, 0xA2, 0x3E, 0x5C, 0x45,
-    0x61, 0xA4, 0x6F, 0xAE, 0x71, 0x8B, 0x07, 0x06, 0x49, 0xB2, 0x75, 0x6A, 0x8A, 0x7D, 0xA3, 0x52,
-    0xAB, 0x02, 0x83, 0xFD, 0x94, 0x8D, 0x9F, 0x62, 0x93, 0xCB, 0x6B, 0x5B, 0xEE, 0xF9, 0x84, 0x50,
-    0x56, 0xD6, 0xA9, 0x84, 0x7F, 0xB3, 0x75, 0x7C, 0x61, 0xC4, 0x70, 0x4B, 0xB8, 0x3D, 0x21, 0xE4,
-    0x00, 0xAF, 0xE5, 0xC4, 0x8C, 0x58, 0xA0, 0x82, 0xD2, 0xC0, 0x25, 0xEB, 0xF9, 0x82, 0xAC, 0x02,
-    0x4E, 0x4A, 0x07, 0x55, 0x3B, 0x47, 0x47, 0x57, 0xB9, 0x4D, 0x07, 0x8E, 0x67, 0xE4, 0x73, 0x0C,
-    0xB8, 0xF7, 0x95, 0x1E, 0xF7, 0xCE, 0x55, 0x07, 0xE1, 0xDE, 0x11, 0xB4, 0x24, 0xE4, 0xC1, 0xBD,
-    0x7B, 0x05, 0x03, 0xF4, 0x23, 0x6E, 0x35, 0x36, 0xB9, 0xE5, 0xD3, 0xA4, 0xBC, 0x46, 0xED, 0x8E,
-    0x1F, 0x18, 0xE2, 0x22, 0x74, 0xA4, 0xE5, 0x81, 0xCF, 0xE4, 0x5F, 0xA0, 0xC2, 0xAC, 0xEF, 0x8B,
-    0x92, 0x5C, 0x70, 0xEF, 0xEB, 0x14, 0x75, 0x3C, 0xCE, 0x6A, 0xE8, 0x1A, 0xC3, 0x42, 0x72, 0xCB,
-    0x0F, 0x6E, 0x41, 0x97, 0x54, 0xDC, 0xFE, 0xEA, 0x57, 0x6A, 0x7C, 0x77, 0xD6, 0xB0, 0x82, 0x06,
-    0x61, 0x87, 0x60, 0x8D, 0xA1, 0x85, 0x2A, 0x43, 0xB9, 0x05, 0x9D, 0xDA, 0xFD, 0x93, 0x65, 0x5D,
-    0xC5, 0x01, 0x76, 0x27, 0x7F, 0xAE, 0x31, 0x64, 0x19, 0x78, 0xAE, 0xD3, 0xA0, 0x4B, 0xAB, 0xEB,
-    0x62, 0x91, 0x51, 0x7D, 0x4E, 0xE8, 0x9C, 0xF9, 0x94, 0x0F, 0x6C, 0xDE, 0x2F, 0x8F, 0xBD, 0xFA,
-    0xC0, 0x3E, 0xCE, 0xAC, 0x37, 0x73, 0xCD, 0x9E, 0xF7, 0x5B, 0xAD, 0x6E, 0x9A, 0x46, 0x40, 0x14,
-    0x87, 0x29, 0x3C, 0x53, 0xD4, 0xA6, 0x13, 0xA7, 0xCE, 0x86, 0x06, 0x66, 0xCA, 0x61, 0x17, 0x97,
-    0x71, 0x3B, 0xB7, 0x5A, 0x1F, 0x4C, 0x9F, 0x48, 0x67, 0x34, 0x38, 0xFB, 0x52, 0x10, 0xDE, 0xD8,
-    0xF3, 0x7E, 0x46, 0x58, 0x3E, 0x59, 0x4D, 0x59, 0xC5, 0x3D, 0xEF, 0xA7, 0x90, 0xFB, 0xDF, 0xE7,
-    0xFD, 0x8C, 0xAB, 0x9A, 0xAE, 0xCD, 0xFB, 0x69, 0x7E, 0x73, 0xDE, 0x8F, 0x7E, 0xFD, 0xA1, 0x87,
-    0x6A, 0xB2, 0xD9, 0xFE, 0xC1, 0xDD, 0x9C, 0xE2, 0x21, 0x19, 0xB7, 0x7D, 0x2E, 0x3B, 0x2F, 0x79,
-    0x6D, 0x80, 0x7B, 0x16, 0x37, 0xA2, 0xB0, 0xA7, 0xAC, 0xAA, 0xBB, 0xB2, 0xE3, 0xA6, 0x22, 0x5E,
-    0x19, 0xB7, 0xAB, 0x0A, 0x11, 0xD5, 0x73, 0x8B, 0x11, 0xC2, 0xFC, 0xFE, 0x38, 0xE9, 0xE7, 0x01,
-    0x5B, 0x5D, 0x00, 0xE0, 0xC8, 0x45, 0x47, 0x5E, 0x32, 0xDA, 0x87, 0x55, 0xA0, 0x0E, 0x80, 0x63,
-    0xDD, 0xF2, 0xDD, 0xBC, 0x6C, 0xE2, 0x74, 0x31, 0xEA, 0x4F, 0x2C, 0x46, 0x61, 0xE2, 0xE3, 0x2C,
-    0x86, 0xE5, 0x2C, 0x06, 0xA2, 0xF1, 0x1A, 0x15, 0x34, 0x93, 0x47, 0xF3, 0xF3, 0x71, 0x52, 0xB7,
-    0xD3, 0x57, 0x90, 0xE2, 0x81, 0x7F, 0x7C, 0xCB, 0x11, 0x14, 0xF5, 0x1A, 0xAD, 0x99, 0xA9, 0xDC,
-    0x52, 0xB1, 0x26, 0x34, 0x52, 0x02, 0x8B, 0x07, 0x6A, 0x99, 0x94, 0xCE, 0x88, 0x5C, 0x7A, 0xD6,
-    0x78, 0x50, 0x22, 0xB8, 0xA5, 0xD8, 0xCC, 0x70, 0x5F, 0x32, 0xD9, 0xC6, 0x00, 0x4D, 0x99, 0xE8,
-    0x81, 0x4A, 0xB6, 0x6A, 0x3C, 0x70, 0x9F, 0x62, 0xB5, 0x13, 0x46, 0x42, 0x16, 0x2A, 0x05, 0xD9,
-    0x98, 0x08, 0xD6, 0x40, 0x83, 0x40, 0x7D, 0x88, 0x20, 0x40, 0x27, 0x54, 0x11, 0x37, 0x3F, 0xE2,
-    0x25, 0xA6, 0x29, 0xE4, 0xA5, 0x85, 0x92, 0x3C, 0x53, 0x99, 0x36, 0xF4, 0x14, 0xA9, 0xD6, 0x08,
-    0xCD, 0xB9, 0x75, 0xE7, 0xD5, 0xF7, 0x20, 0x00, 0x37, 0x08, 0xE6, 0x43, 0xEA, 0x4D, 0x30, 0x8B,
-    0x1F, 0x94, 0x35, 0xB9, 0x8C, 0x4A, 0x1C, 0x9E, 0xBC, 0x12, 0xA7, 0x6B, 0x10, 0x57, 0xC7, 0x85,
-    0x32, 0x6E, 0x59, 0xDB, 0x70, 0x89, 0xE0, 0xA5, 0xBE, 0x1A, 0x20, 0xC4, 0x14, 0x13, 0xDF, 0xF3,
-    0x06, 0x05, 0xFD, 0x2E, 0x37, 0xD7, 0x41, 0x70, 0xC8, 0x10, 0x1C, 0x25, 0xA7, 0x31, 0x44, 0x88,
-    0xA0, 0x16, 0xE2, 0xF2, 0xF1, 0xB4, 0xB9, 0x14, 0x8F, 0x74, 0x25, 0xF1, 0x4C, 0x95, 0xE0, 0x1C,
-    0x91, 0xE7, 0xED, 0x22, 0x8F, 0x9B, 0xF5, 0xE2, 0x66, 0xE2, 0xA1, 0xEA, 0x46, 0x34, 0x9D, 0xBC,
-    0x86, 0x59, 0xE9, 0x93, 0x01, 0x0E, 0x59, 0x53, 0x36, 0x75, 0xB5, 0x5D, 0x42, 0xB7, 0xC5, 0x03,
-    0xC7, 0x23, 0xA7, 0x26, 0x6F, 0x39, 0x17, 0x0E, 0x53, 0x34, 0x44, 0x13, 0x94, 0x69, 0x93, 0xB5,
-    0x39, 0x26, 0x43, 0xE4, 0x4C, 0x1E, 0x6E, 0x3B, 0xE1, 0x56, 0x6D, 0xDA, 0xE5, 0xAD, 0xA5, 0x35,
-    0x62, 0x8A, 0x9F, 0x06, 0xC0, 0x5B, 0x55, 0xF3, 0x81, 0x85, 0xC6, 0x83, 0xE0, 0xE0, 0xBA, 0xEC,
-    0xB6, 0xEB, 0xBF, 0x7E, 0x6C, 0x5B, 0x99, 0x5B, 0xAE, 0x05, 0xC7, 0x26, 0xE3, 0xE0, 0xD8, 0x36,
-    0x18, 0x5B, 0xD2, 0xEF, 0x8F, 0x6D, 0xB9, 0x6F, 0x6C, 0x5D, 0x8E, 0xE5, 0x44, 0xA4, 0x22, 0x19,
-    0x74, 0x6C, 0xCD, 0x6E, 0x6C, 0xB7, 0x63, 0x0D, 0xF2, 0xE5, 0x3A, 0x2A, 0x1E, 0x75, 0xE5, 0xDC,
-    0x7E, 0xDA, 0x25, 0x1D, 0xF6, 0x82, 0xB4, 0x16, 0x30, 0x3A, 0x77, 0x31, 0x38, 0x77, 0x78, 0x1D,
-    0x56, 0x74, 0xC0, 0xD3, 0x30, 0xA3, 0x85, 0x85, 0x1D, 0x7D, 0x5E, 0x24, 0x07, 0xAE, 0x9F, 0x7C,
-    0x90, 0x00, 0x81, 0xD1, 0x8D, 0xC5, 0xD2, 0x27, 0x8D, 0x87, 0x2E, 0xF0, 0x9F, 0x45, 0x90, 0xAA,
-    0x8C, 0xA3, 0x06, 0x44, 0x92, 0x7B, 0x37, 0x99, 0x45, 0xDF, 0xBB, 0xAD, 0xDA, 0x75, 0x77, 0x2A,
-    0xA7, 0x92, 0xFC, 0xFD, 0x7E, 0xC2, 0x6F, 0xF7, 0x1D, 0x31, 0x81, 0x56, 0x15, 0x4B, 0xD2, 0xA8,
-    0x6A, 0x49, 0xED, 0x7B, 0xD6, 0x28, 0xD8, 0x87, 0x38, 0x40, 0xA1, 0x62, 0x60, 0xC4, 0xFB, 0xF6,
-    0x4C, 0xB5, 0xA6, 0xDB, 0x02, 0x77, 0xA8, 0x6E, 0x9E, 0xE6, 0x34, 0x34, 0x97, 0x47, 0x1F, 0x13,
-    0xF6, 0x75, 0x81, 0x48, 0xB9, 0x4A, 0x0C, 0x9F, 0x08, 0x6A, 0x0D, 0xE3, 0x1F, 0x63, 0xE8, 0x09,
-    0x77, 0x8C, 0xAB, 0x52, 0x7C, 0x87, 0xAB, 0x80, 0x00, 0xA3, 0x40, 0x8F, 0x5C, 0xA3, 0xB8, 0x50,
-    0xB9, 0x8C, 0x0F, 0xD4, 0x8C, 0x0E, 0x74, 0x0C, 0x37, 0xD2, 0xCD, 0x31, 0xEF, 0xEA, 0xA6, 0xF9,
-    0x5B, 0x0C, 0x26, 0xE2, 0x51, 0x30, 0xA8, 0xAC, 0xD2, 0x29, 0xC4, 0x8B, 0x9C, 0xC1, 0xDA, 0x26,
-    0x50, 0x26, 0xA3, 0xC5, 0xFC, 0x6D, 0xE7, 0x3F, 0x75, 0x05, 0xA6, 0xAF, 0x2C, 0xE2, 0x11, 0xB3,
-    0x87, 0x7B, 0x3F, 0x25, 0x93, 0xF7, 0x3A, 0x44, 0xCC, 0x16, 0xB4, 0xDB, 0x9F, 0xBA, 0xF3, 0x3F,
-    0x50, 0xAF, 0x4E, 0x75, 0xAA, 0x2A, 0x0C, 0xFC, 0x59, 0x5C, 0xC9, 0x1A, 0x70, 0x87, 0xE9, 0x08,
-    0x11, 0x40, 0x00, 0x34, 0x60, 0xD6, 0x7E, 0xF3, 0xFE, 0x1A, 0xC8, 0x87, 0xFF, 0xEB, 0xBC, 0x1B,
-    0x2F, 0xA7, 0x59, 0x42, 0xF1, 0xDC, 0xE1, 0xA1, 0xF9, 0x97, 0xA2, 0x4F, 0x0B, 0x06, 0xC6, 0x90,
-    0xF5, 0xE9, 0x35, 0xFA, 0xA2, 0xE2, 0x4E, 0x2B, 0x6F, 0xB1, 0xA3, 0x49, 0xFD, 0xC6, 0xC0, 0xDC,
-    0x6C, 0xCB, 0xF0, 0xDC, 0xF7, 0x75, 0x46, 0x1C, 0xFB, 0x11, 0x4F, 0x4F, 0x5F, 0x2F, 0x6D, 0x18,
-    0x52, 0xC9, 0x1A, 0x9A, 0xCC, 0xFC, 0x79, 0x77, 0x1B, 0xB1, 0xAC, 0xA7, 0x18, 0x82, 0x29, 0x65,
-    0xEA, 0xC5, 0x43, 0x7C, 0x55, 0x64, 0x33, 0xEE, 0xE9, 0x95, 0xF1, 0x9B, 0x60, 0xCC, 0x6E, 0xA3,
-    0xDF, 0x42, 0xBA, 0x8B, 0x02, 0xD0, 0x80, 0x2E, 0x1B, 0xB8, 0x6F, 0xB2, 0x60, 0x71, 0xC7, 0xD0,
-    0x58, 0xD2, 0xBA, 0x46, 0x34, 0x7C, 0xF2, 0x9A, 0x5B, 0x64, 0xAC, 0x69, 0xC3, 0xF1, 0x65, 0x85,
-    0x0E, 0x16, 0x5A, 0x4B, 0x66, 0x03, 0x8F, 0x1B, 0x04, 0xDF, 0x91, 0xE7, 0x3D, 0x95, 0x01, 0x3C,
-    0x6F, 0xA9, 0xD0, 0xC5, 0xDB, 0xF0, 0xEC, 0xBD, 0x6F, 0x02, 0xFB, 0x32, 0xAE, 0x4D, 0xB5, 0xBA,
-    0x59, 0xA0, 0x6F, 0xC3, 0x19, 0x50, 0x8B, 0xFB, 0x93, 0x41, 0xAB, 0xDE, 0xE2, 0x32, 0x66, 0xFF,
-    0x9D, 0x0F, 0x22, 0x34, 0xE6, 0x78, 0x00, 0x79, 0x23, 0x45, 0x04, 0xC0, 0x5F, 0x76, 0xF0, 0xF1,
-    0xC5, 0x29, 0x80, 0xFF, 0xD9, 0xC0, 0x97, 0x14, 0x37, 0x01, 0xD9, 0xB3, 0x4A, 0x8C, 0x68, 0x26,
-    0x47, 0xCC, 0x6F, 0x51, 0xCE, 0xB2, 0x08, 0xC1, 0xE1, 0x25, 0x9F, 0x02, 0xA0, 0x49, 0xD3, 0x49,
-    0x97, 0xBF, 0x9F, 0xB8, 0x41, 0x36, 0x7E, 0xDD, 0x60, 0x3E, 0x44, 0x82, 0xA2, 0x49, 0xC4, 0x29,
-    0xED, 0x64, 0x53, 0x94, 0xC5, 0x2C, 0x83, 0xDB, 0x8A, 0xF5, 0xEA, 0x19, 0x4D, 0x2A, 0x5F, 0xBC,
-    0x42, 0x13, 0x49, 0x0B, 0xD9, 0x01, 0x25, 0x15, 0x09, 0xD3, 0x94, 0xF7, 0xAD, 0x0F, 0x85, 0xE9,
-    0x8F, 0x88, 0xAD, 0x64, 0xFC, 0x07, 0x8A, 0x9A, 0x21, 0x51, 0x25, 0x86, 0xAF, 0x91, 0x90, 0xF2,
-    0x58, 0x5C, 0x17, 0x8D, 0x4F, 0xD0, 0xB8, 0x6F, 0xDC, 0x95, 0x63, 0x45, 0x5E, 0xC1, 0x2E, 0xD2,
-    0x02, 0x27, 0xE0, 0xAE, 0x88, 0x9D, 0x3C, 0x85, 0xEC, 0x0B, 0x27, 0xE3, 0x83, 0x4A, 0x8D, 0x18,
-    0xD8, 0x83, 0x7F, 0x21, 0x2F, 0xC0, 0x45, 0xCB, 0x9C, 0xCD, 0x58, 0xE2, 0xB3, 0x85, 0x8A, 0x31,
-    0x0B, 0x1F, 0x3E, 0xDC, 0x5C, 0x54, 0x9B, 0xC9, 0x0C, 0x73, 0x11, 0x9D, 0xDC, 0xEA, 0x65, 0xF2,
-    0x67, 0xF9, 0x4F, 0x56, 0x50, 0x76, 0x7B, 0xA6, 0xFE, 0x3F, 0x3C, 0x84, 0x29, 0x14, 0xB0, 0x20,
-    0x3B, 0x26, 0xE9, 0xF2, 0x22, 0x1A, 0xD3, 0xF7, 0x9E, 0x9D, 0x21, 0x84, 0xB8, 0xFA, 0xE3, 0xB8,
-    0x36, 0xE1, 0xA6, 0xC6, 0x05, 0x71, 0x43, 0x28, 0xC0, 0x2A, 0x3B, 0x39, 0xBA, 0x41, 0x8D, 0x47,
-    0x1D, 0x48, 0xBC, 0xC2, 0xDF, 0x9C, 0x87, 0x56, 0x75, 0x67, 0x08, 0x8C, 0x2A, 0x08, 0x4E, 0x11,
-    0xC1, 0x13, 0xAD, 0x3E, 0x90, 0xD6, 0xE6, 0xA8, 0xF2, 0x69, 0x8E, 0x02, 0x03, 0xE4, 0x3A, 0xC3,
-    0x13, 0x22, 0xFC, 0x84, 0x16, 0x2D, 0x9F, 0xC7, 0xAC, 0xB4, 0x58, 0xFB, 0x5E, 0x36, 0x59, 0x3C,
-    0x22, 0xBC, 0x39, 0x33, 0xC6, 0x1B, 0x3A, 0xE2, 0x2B, 0x01, 0xE4, 0x55, 0xDE, 0x3E, 0xE2, 0xDE,
-    0xBB, 0x72, 0xFC, 0x34, 0x36, 0xCF, 0xDB, 0xDC, 0x4E, 0x08, 0xC9, 0x8C, 0xC0, 0x8C, 0x50, 0xE7,
-    0x62, 0xB2, 0x90, 0x5E, 0x09, 0x8E, 0x0A, 0xFC, 0x93, 0xB5, 0x39, 0xA6, 0x74, 0x56, 0x10, 0x4E,
-    0xF1, 0x65, 0xC6, 0x08, 0xD0, 0x3E, 0x14, 0xCF, 0xE8, 0xAF, 0xEB, 0x71, 0x5D, 0x65, 0xEA, 0x78,
-    0x31, 0xA4, 0x47, 0x87, 0xAA, 0x9D, 0x99, 0x57, 0x97, 0x91, 0x1F, 0x34, 0x04, 0xC9, 0x91, 0xDF,
-    0xBA, 0x95, 0xBA, 0xD3, 0x8C, 0x9D, 0x5C, 0xBE, 0x76, 0x70, 0x23, 0x78, 0xF4, 0xEA, 0xF9, 0x1B,
-    0x02, 0x8A, 0x64, 0xF4, 0x65, 0x83, 0x64, 0xCA, 0x12, 0xC1, 0xE1, 0xA5, 0xC7, 0x06, 0x6B, 0xF4,
-    0x24, 0x3D, 0x97, 0x37, 0x64, 0xF8, 0x98, 0x86, 0x8D, 0xF8, 0x95, 0xDB, 0x99, 0x98, 0x4A, 0xDC,
-    0xCF, 0x78, 0x22, 0x9A, 0x11, 0xB9, 0x4C, 0xEE, 0x51, 0x31, 0xC9, 0xC4, 0xA4, 0x1A, 0x46, 0x92,
-    0xA1, 0x96, 0xCE, 0x72, 0x83, 0xAE, 0xF6, 0x68, 0x6B, 0x25, 0x0A, 0x38, 0x1F, 0x82, 0x8A, 0x56,
-    0xC3, 0x64, 0x2E, 0xA0, 0xC5, 0xA2, 0x2C, 0x39, 0x32, 0x8B, 0x73, 0x4B, 0x6F, 0xCC, 0xFD, 0xCC,
-    0x4D, 0x25, 0x33, 0xFF, 0xEE, 0xBB, 0x98, 0xA9, 0x1E, 0xCA, 0x66, 0x83, 0xB0, 0x1A, 0x82, 0x14,
-    0x32, 0x0D, 0x3D, 0xB5, 0xC1, 0x06, 0xA2, 0x0A, 0x8B, 0x1C, 0xFC, 0x73, 0x24, 0x80, 0x13, 0x41,
-    0xB3, 0x7D, 0xF0, 0x28, 0xA4, 0xB3, 0x80, 0xDF, 0x48, 0x03, 0x32, 0x05, 0x57, 0x33, 0x31, 0x49,
-    0x98, 0x35, 0x40, 0xDA, 0x0D, 0x56, 0x9D, 0x3E, 0x4D, 0x2A, 0xCA, 0xBC, 0x13, 0x1B, 0xE0, 0xC4,
-    0xAA, 0xC2, 0xF9, 0xC0, 0x9F, 0x05, 0x4D, 0xD5, 0x22, 0x39, 0xAD, 0x9C, 0x98, 0xF4, 0xE5, 0x1D,
-    0x11, 0xC7, 0xF2, 0x17, 0xD3, 0x66, 0x29, 0x7F, 0x26, 0xFB, 0xB0, 0xEE, 0x11, 0xAD, 0x15, 0x23,
-    0x2F, 0x3E, 0x7A, 0xDA, 0xC7, 0xAE, 0x47, 0xD0, 0x65, 0x80, 0xE1, 0x13, 0xDF, 0xB1, 0x28, 0x01,
-    0xA8, 0xCE, 0x5F, 0x0F, 0x1E, 0xBD, 0x16, 0x20, 0x7F, 0x7E, 0x0E, 0x99, 0xBB, 0xAC, 0xD5, 0xB0,
-    0x72, 0x4C, 0xC1, 0xB7, 0x7C, 0x26, 0xE6, 0xE6, 0xCC, 0xEA, 0x00, 0x62, 0xC1, 0x93, 0x46, 0x46,
-    0x11, 0xF5, 0x08, 0xEB, 0x8F, 0x90, 0xCE, 0x09, 0x0A, 0x24, 0x07, 0x9C, 0x4F, 0x9F, 0xC7, 0xE6,
-    0x79, 0xFB, 0xDE, 0x14, 0x6C, 0x3F, 0x9C, 0x67, 0x31, 0x25, 0x93, 0x18, 0x92, 0x57, 0x67, 0xA4,
-    0xEE, 0x16, 0x01, 0x16, 0xE9, 0x92, 0x00, 0x48, 0x47, 0xC8, 0x60, 0x03, 0x8F, 0x41, 0xDE, 0x64,
-    0x52, 0x20, 0x80, 0x5B, 0x44, 0xE0, 0xA3, 0x01, 0xE1, 0xD2, 0x8F, 0xE0, 0xBF, 0xFC, 0x1D, 0xC2,
-    0x1C, 0x77, 0x7A, 0xC3, 0xE3, 0x35, 0x11, 0xFF, 0x88, 0xED, 0xCF, 0x84, 0xEA, 0x6C, 0x21, 0x98,
-    0xE4, 0x13, 0xDC, 0xF4, 0x43, 0x84, 0x22, 0x3A, 0x68, 0x20, 0xD1, 0xDE, 0x85, 0xE6, 0x5D, 0x72,
-    0x25, 0xD7, 0x14, 0x41, 0x29, 0x6A, 0x27, 0xEE, 0xC5, 0xC8, 0xCD, 0x02, 0xD7, 0xD2, 0x06, 0x09,
-    0x48, 0x99, 0xE5, 0xFC, 0x09, 0xF1, 0x34, 0x7A, 0xB1, 0xCF, 0xAF, 0x0A, 0x1E, 0x48, 0xDA, 0x5A,
-    0x86, 0x9A, 0x00, 0xF8, 0x88, 0xAB, 0x3F, 0xA4, 0x8D, 0x40, 0x9F, 0x69, 0x17, 0xE8, 0xCA, 0x10,
-    0xF7, 0x15, 0xF9, 0xA3, 0x37, 0x2A, 0x2B, 0x05, 0xD8, 0x3D, 0x44, 0xD8, 0xE9, 0x15, 0x56, 0x76,
-    0x44, 0x58, 0xC5, 0xFD, 0x58, 0xCC, 0xD0, 0x3D, 0x08, 0x43, 0x59, 0xBA, 0x9F, 0x76, 0xF1, 0xC7,
-    0xEE, 0x44, 0x20, 0x45, 0xEE, 0x04, 0xFA, 0xFC, 0xC2, 0xFD, 0x72, 0x0A, 0xE7, 0x6C, 0xAA, 0xAB,
-    0xFC, 0x6D, 0xF7, 0x8C, 0xAC, 0x5D, 0xF6, 0xA1, 0xEC, 0xFF, 0xD7, 0xA6, 0xBC, 0x4F, 0x46, 0x6E,
-    0xEE, 0x83, 0x97, 0x82, 0xB3, 0xD7, 0x90, 0xDE, 0x28, 0x45, 0xF8, 0xA1, 0xC4, 0x15, 0x14, 0x03,
-    0x2A, 0xCB, 0xB2, 0x17, 0x21, 0xFD, 0xD8, 0x84, 0xCE, 0x2F, 0x5E, 0x80, 0xCB, 0x1C, 0xD1, 0xD1,
-    0xCE, 0x56, 0x78, 0x47, 0x39, 0x9D, 0xBC, 0x7B, 0xFE, 0xC1, 0x4D, 0xEF, 0x43, 0x67, 0xEA, 0xFD,
-    0x36, 0xEA, 0xBD, 0x5D, 0x19, 0x38, 0x6D, 0x94, 0x65, 0x51, 0xC3, 0x27, 0xD4, 0x83, 0x59, 0x4F,
-    0x53, 0xC1, 0x7B, 0xD2, 0x79, 0x4F, 0xE0, 0x45, 0x23, 0x39, 0xD3, 0xC9, 0x08, 0xF2, 0x36, 0x67,
-    0xF0, 0xB1, 0x0F, 0x2D, 0xF2, 0x9F, 0x19, 0x44, 0x42, 0x44, 0x48, 0x4D, 0x4B, 0x65, 0x64, 0x0F,
-    0xD2, 0x34, 0x60, 0xAF, 0x3B, 0x68, 0x3A, 0xF1, 0x8B, 0x0E, 0x9F, 0x9D, 0x74, 0xB4, 0x25, 0x60,
-    0x26, 0xEC, 0x68, 0x8B, 0x21, 0xF5, 0x0C, 0x0A, 0x6C, 0x88, 0x70, 0x10, 0x20, 0x42, 0x4C, 0xAA,
-    0x6E, 0x52, 0xA0, 0x65, 0xC6, 0x7F, 0xB6, 0x74, 0xF6, 0x35, 0xCC, 0x8E, 0x80, 0xC0, 0xF9, 0x6B,
-    0xC1, 0x65, 0x0D, 0xA4, 0xFE, 0x09, 0x4D, 0x0E, 0xA3, 0x95, 0x1A, 0xD8, 0x0F, 0xD5, 0xB0, 0xC1,
-    0x30, 0x51, 0x17, 0x22, 0x01, 0x0D, 0xFC, 0x43, 0x5F, 0x0A, 0xBF, 0xC8, 0x5F, 0x4B, 0xAA, 0xCB,
-    0xB8, 0xA3, 0x1F, 0x3B, 0xD3, 0x81, 0x2E, 0x57, 0x9F, 0xBC, 0xF6, 0x19, 0x03, 0x86, 0xD0, 0x34,
-    0x00, 0x77, 0x8F, 0x19, 0xBC, 0xE5, 0xE0, 0xFD, 0x4F, 0x91, 0x04, 0xF6, 0x48, 0x04, 0xEA, 0xF0,
-    0x06, 0xFB, 0x24, 0x83, 0xCD, 0xBE, 0xE5, 0xBA, 0x82, 0x84, 0x11, 0x28, 0x28, 0xF2, 0x24, 0x0B,
-    0x43, 0x70, 0xF0, 0x47, 0x00, 0x74, 0xA0, 0xF8, 0xD2, 0x5E, 0x31, 0x4E, 0x6E, 0x01, 0xAD, 0x7C,
-    0xF8, 0x23, 0x82, 0xD9, 0x44, 0x35, 0xA1, 0x48, 0xC2, 0xA2, 0x99, 0x26, 0x38, 0x33, 0x3F, 0xC7,
-    0x02, 0x3F, 0xF3, 0x7E, 0xFD, 0xD7, 0x93, 0xFA, 0x34, 0x54, 0x9F, 0xE0, 0x23, 0x85, 0x8B, 0xD7,
-    0xA3, 0xF0, 0xD9, 0xE9, 0xDF, 0xA8, 0x61, 0xE8, 0x8C, 0x5D, 0xC5, 0xDF, 0x2C, 0x2E, 0x24, 0x98,
-    0xFF, 0x86, 0x01, 0x6B, 0x8D, 0xD2, 0xC8, 0x58, 0x12, 0x7A, 0x5A, 0x31, 0x29, 0x02, 0x22, 0x2F,
-    0x9C, 0x96, 0x80, 0x61, 0xC9, 0x27, 0x16, 0xBC, 0xE9, 0x7B, 0x13, 0xB4, 0xDD, 0x5B, 0x3B, 0x0F,
-    0xDB, 0x27, 0x80, 0x09, 0x6B, 0xF7, 0x3C, 0xEC, 0x7C, 0xDA, 0xD1, 0x23, 0x94, 0xAD, 0xC6, 0x89,
-    0xA1, 0x87, 0x4D, 0x48, 0x83, 0x20, 0x3C, 0x45, 0x64, 0xE7, 0x61, 0x97, 0xE3, 0x69, 0x8E, 0x93,
-    0x82, 0x52, 0xE6, 0x7D, 0x6A, 0x8F, 0xF9, 0x10, 0xC7, 0x39, 0x71, 0x37, 0x05, 0xE7, 0x0D, 0x69,
-    0x07, 0x07, 0x43, 0x36, 0x47, 0x5D, 0xC8, 0xAF, 0xA2, 0x80, 0xD2, 0x0E, 0xF0, 0xF8, 0x09, 0x79,
-    0xA1, 0x4A, 0xFB, 0xAC, 0x11, 0x57, 0x03, 0xDE, 0x8A, 0xE8, 0xC4, 0x4E, 0xBC, 0x98, 0xBE, 0x9C,
-    0x54, 0x4D, 0x17, 0x89, 0x46, 0xF3, 0x32, 0x5D, 0xDC, 0x2B, 0x8E, 0xC8, 0x2A, 0x1A, 0xF6, 0x12,
-    0x87, 0x9A, 0x51, 0xB4, 0x5C, 0xA2, 0x26, 0x19, 0xB7, 0xF3, 0xA9, 0x94, 0x3A, 0xB6, 0x1B, 0x3D,
-    0x32, 0xCC, 0x8F, 0xCC, 0xF5, 0xC6, 0x31, 0x37, 0xE3, 0xBE, 0x87, 0xF7, 0xD4, 0x3F, 0x1D, 0x0D,
-    0x12, 0x78, 0x67, 0x5A, 0xA3, 0x43, 0xD9, 0xAC, 0x86, 0x44, 0x4D, 0x4C, 0x11, 0xA8, 0x41, 0x16,
-    0x98, 0xCE, 0xCC, 0x7C, 0x57, 0x83, 0xFC, 0x54, 0x95, 0x30, 0x68, 0x10, 0xC9, 0x47, 0xAF, 0x07,
-    0x62, 0xE6, 0x02, 0xB0, 0x70, 0xD4, 0xD5, 0xA5, 0xEB, 0xBB, 0xD5, 0xFC, 0x5F, 0x25, 0x0F, 0x96,
-    0xC3, 0x81, 0x86, 0x1F, 0x56, 0xD1, 0xD9, 0x53, 0x90, 0x47, 0xFF, 0xB9, 0x84, 0xB7, 0x95, 0xC1,
-    0xD5, 0x4E, 0xE0, 0x54, 0x6F, 0x97, 0xCB, 0xB7, 0xD4, 0xAF, 0x6A, 0x20, 0x3D, 0x6D, 0x46, 0x5A,
-    0x84, 0x8A, 0x3B, 0xA9, 0x67, 0x0A, 0x2F, 0x34, 0xBB, 0x24, 0xD0, 0x29, 0xAC, 0xCE, 0x6E, 0xFA,
-    0xA8, 0xF9, 0x51, 0xD8, 0xFF, 0x71, 0x30, 0xA6, 0xC1, 0xB7, 0xE3, 0x22, 0xDB, 0x36, 0x69, 0x33,
-    0x88, 0x77, 0xE8, 0xC6, 0x44, 0xE4, 0xB7, 0xFE, 0xA1, 0xCC, 0x81, 0x88, 0x86, 0x0C, 0x5B, 0xA6,
-    0xED, 0x65, 0x72, 0xD7, 0x2E, 0xE6, 0x6D, 0xB4, 0x6C, 0xA1, 0xC8, 0xE1, 0x03, 0x0A, 0xE2, 0x9B,
-    0x22, 0x20, 0x03, 0x75, 0x1C, 0xD3, 0x21, 0x19, 0xE9, 0x9A, 0xC0, 0x05, 0xCC, 0x65, 0x31, 0x44,
-    0x81, 0xAA, 0xDF, 0x58, 0xB6, 0x70, 0x0E, 0xC5, 0x0C, 0xCD, 0xC8, 0xB1, 0x55, 0xF0, 0x28, 0x65,
-    0x55, 0xC7, 0x58, 0xEC, 0xD1, 0x8B, 0xF2, 0x9F, 0xD9, 0xD8, 0xED, 0x1E, 0x7D, 0xAB, 0xF5, 0x6E,
-    0xEB, 0x6F, 0xED, 0xA6, 0x2F, 0xF1, 0xA6, 0x44, 0x66, 0x72, 0x6F, 0xDE, 0x74, 0xDE, 0xF3, 0x47,
-    0xD3, 0x7D, 0x82, 0x91, 0x11, 0x88, 0xD6, 0xBD, 0x5F, 0x42, 0xB3, 0xCE, 0xC1, 0xC1, 0xCD, 0x9E,
-    0x53, 0x14, 0x3C, 0x26, 0x2F, 0x8F, 0xD0, 0xB1, 0xB7, 0x19, 0x4C, 0x5A, 0x6E, 0xF5, 0x51, 0x97,
-    0x34, 0x59, 0x91, 0x07, 0x02, 0x07, 0xB7, 0xFD, 0x15, 0x38, 0x48, 0xC8, 0xCE, 0x28, 0x9F, 0xC2,
-    0xBE, 0x7E, 0xB0, 0x93, 0x45, 0x11, 0xC2, 0x7F, 0x05, 0x7B, 0x18, 0x7C, 0x9D, 0x04, 0x8F, 0x6F,
-    0x91, 0xE0, 0xF3, 0x32, 0xDD, 0xB2, 0x91, 0x24, 0x10, 0x18, 0xE4, 0x3E, 0x3C, 0xB9, 0x2A, 0xB0,
-    0x12, 0xD7, 0x48, 0xE0, 0x6A, 0x54, 0x69, 0x13, 0xB5, 0x99, 0xB8, 0xE7, 0x71, 0x93, 0xC8, 0x51,
-    0xEE, 0xD7, 0x94, 0x55, 0xF2, 0x5D, 0xB1, 0x31, 0x05, 0x6E, 0x07, 0xE3, 0x34, 0x21, 0xC9, 0xE9,
-    0x5A, 0x0D, 0x81, 0x84, 0xAF, 0xD2, 0x9E, 0x87, 0x1D, 0xC7, 0x1B, 0xB5, 0x5C, 0x53, 0x78, 0xB0,
-    0xCC, 0x55, 0x5F, 0x0D, 0x91, 0xE3, 0xBD, 0x39, 0x6D, 0xBB, 0xA4, 0x7D, 0x45, 0x6C, 0xA6, 0x88,
-    0xC2, 0x74, 0x41, 0xFC, 0x04, 0xF7, 0x84, 0x43, 0x9E, 0xB0, 0xDB, 0x8D, 0xBB, 0xBE, 0xAD, 0xB4,
-    0x91, 0xE4, 0xB6, 0x00, 0x13, 0x38, 0x2F, 0x1C, 0xAD, 0xC5, 0x40, 0x98, 0x29, 0xAF, 0x14, 0xAC,
-    0xF3, 0xD9, 0xF2, 0xEE, 0xF7, 0x44, 0x8F, 0x6E, 0x4E, 0x6A, 0x46, 0x50, 0x5A, 0xA6, 0x4E, 0xC2,
-    0xFA, 0x3E, 0xA2, 0xE3, 0x81, 0xE0, 0xFF, 0x57, 0x60, 0xDD, 0x93, 0x06, 0x7F, 0x9F, 0xF2, 0xBB,
-    0x65, 0x91, 0x3E, 0x3D, 0x86, 0x63, 0xD8, 0x8B, 0xD1, 0xA9, 0xF2, 0x2B, 0xCD, 0x66, 0x44, 0xB0,
-    0x29, 0x2B, 0x44, 0xFB, 0x84, 0x3D, 0xB0, 0x49, 0x1E, 0x00, 0xDC, 0x77, 0xC9, 0x4F, 0xBB, 0x60,
-    0xDE, 0xF4, 0x0E, 0xF1, 0x87, 0x64, 0xA9, 0xC7, 0x2D, 0xE2, 0x70, 0xC1, 0xD7, 0xA1, 0x4C, 0xA3,
-    0x06, 0x6B, 0xF1, 0x23, 0x5A, 0x3F, 0xFB, 0x3A, 0xBC, 0x88, 0xFC, 0x20, 0x24, 0x4C, 0x3C, 0x5F,
-    0xA4, 0xB9, 0xB7, 0xC3, 0x16, 0xD1, 0x01, 0xD1, 0x84, 0x22, 0x1F, 0x49, 0x1F, 0x2F, 0x37, 0x89,
-    0xCB, 0xF1, 0x10, 0x90, 0x40, 0x31, 0xDA, 0x17, 0x96, 0x50, 0xC4, 0xA9, 0x92, 0x2D, 0xDB, 0x97,
-    0x5D, 0x3A, 0x09, 0xCA, 0x75, 0x89, 0xA8, 0x81, 0x1F, 0xCB, 0x2E, 0x5B, 0xAF, 0xAB, 0xBB, 0x7F,
-    0x5C, 0xA3, 0xA5, 0xC4, 0xA1, 0x5B, 0x57, 0x05, 0x0F, 0xFF, 0xB5, 0xA9, 0xAF, 0x42, 0x7E, 0xD4,
-    0xD3, 0x13, 0x8C, 0xBB, 0x6C, 0xA8, 0x7D, 0x32, 0x31, 0x96, 0x97, 0x61, 0xAE, 0x31, 0xE1, 0xDC,
-    0x1D, 0x25, 0xE9, 0x4D, 0xCB, 0x8D, 0x4B, 0xAA, 0xBF, 0x54, 0x63, 0xC9, 0x3B, 0xFE, 0x83, 0x3A,
-    0x3D, 0x91, 0x87, 0xD2, 0x9D, 0xDA, 0xE9, 0xE0, 0x0A, 0x5D, 0xAB, 0x78, 0x80, 0x82, 0x73, 0x4F,
-    0x22, 0x0E, 0xDC, 0x53, 0xDF, 0x33, 0x89, 0xF2, 0xA1, 0xC8, 0xF2, 0xC1, 0x8D, 0xF3, 0x2F, 0x3D,
-    0xC4, 0x00, 0x01, 0xF6, 0x65, 0xF2, 0x46, 0x1B, 0xA0, 0x3C, 0x68, 0x19, 0x28, 0xDC, 0x4F, 0x8E,
-    0x6F, 0x2A, 0xAF, 0x56, 0x03, 0x4F, 0x95, 0x52, 0x35, 0xEB, 0x93, 0xBF, 0xB9, 0x68, 0x2A, 0x96,
-    0x1A, 0x87, 0x90, 0x5F, 0x49, 0xA9, 0x91, 0x27, 0xEC, 0x8E, 0x9E, 0xCB, 0xAC, 0x0C, 0xB9, 0x7A,
-    0xC7, 0x8C, 0xB8, 0x59, 0x05, 0x9E, 0xBD, 0x29, 0xBF, 0x2D, 0x17, 0xD5, 0x84, 0xEA, 0xF5, 0xD2,
-    0x5F, 0x89, 0x8F, 0xC0, 0x08, 0xA5, 0xD1, 0x2B, 0x6E, 0x89, 0x62, 0x18, 0x42, 0x24, 0xEF, 0xC3,
-    0x09, 0x99, 0x85, 0x09, 0xA4, 0x13, 0xC0, 0x89, 0xED, 0x28, 0xD6, 0x2D, 0x1E, 0x90, 0x67, 0xE8,
-    0x69, 0xF3, 0x98, 0x59, 0x42, 0x7A, 0xA5, 0x93, 0x25, 0xAA, 0x5B, 0x59, 0x41, 0xD7, 0xD6, 0xC3,
-    0xBF, 0x74, 0xCD, 0xC1, 0x7F, 0x57, 0xB8, 0xA9, 0x59, 0x39, 0x7F, 0xA0, 0xC1, 0x3B, 0xB8, 0x8F,
-    0xC6, 0xF3, 0x8A, 0xCF, 0x17, 0x97, 0xAB, 0xE0, 0x2B, 0xC1, 0x2D, 0xF0, 0xD9, 0xEE, 0xDF, 0x86,
-    0x6B, 0x77, 0xA6, 0xD0, 0x08, 0xAE, 0x4C, 0xBE, 0xD8, 0x7F, 0xF8, 0x98, 0x01, 0xB6, 0x68, 0xF0,
-    0x4A, 0xA8, 0x56, 0x08, 0xAE, 0x84, 0x18, 0xCF, 0x45, 0x5C, 0x74, 0x86, 0xC4, 0x44, 0x46, 0xA8,
-    0xFC, 0xE9, 0xFC, 0x5B, 0x6A, 0x5A, 0x86, 0x78, 0xE5, 0x78, 0x27, 0x70, 0x27, 0x05, 0xB1, 0x47,
-    0xE8, 0x6E, 0x0E, 0x88, 0xD8, 0x2A, 0x7D, 0x6F, 0xA3, 0x86, 0x82, 0xFC, 0xD5, 0xD1, 0xC2, 0xC3,
-    0x21, 0x6D, 0x38, 0x07, 0x5F, 0x76, 0xA1, 0xA8, 0x9E, 0x2A, 0x3F, 0xA9, 0x49, 0x7D, 0x41, 0xF0,
-    0x67, 0xD1, 0x18, 0xC6, 0x05, 0xB7, 0x4A, 0x11, 0x50, 0xC5, 0xCC, 0x60, 0x7B, 0x3A, 0x31, 0xE6,
-    0x8D, 0x6C, 0xDB, 0xE1, 0xBE, 0x87, 0xFF, 0xB5, 0x8A, 0x61, 0x53, 0xC1, 0xBD, 0xF1, 0x40, 0x35,
-    0x21, 0x0B, 0x0B, 0x43, 0x2C, 0x42, 0xBA, 0x25, 0x63, 0x03, 0x8A, 0x04, 0xA2, 0x90, 0x0C, 0xA4,
-    0xC9, 0x28, 0x1B, 0x0A, 0x00, 0xE7, 0x40, 0x94, 0x58, 0x70, 0x23, 0x7C, 0x29, 0x1E, 0x45, 0xB9,
-    0x77, 0xE2, 0x73, 0x3D, 0x35, 0x27, 0x73, 0xDE, 0x53, 0x92, 0xF7, 0xBE, 0xFE, 0xA7, 0xC6, 0x65,
-    0x41, 0xBF, 0xAE, 0x0B, 0xFE, 0x08, 0xD1, 0x91, 0xFB, 0x61, 0x9D, 0xF0, 0xA3, 0xDC, 0x02, 0x37,
-    0x04, 0x8A, 0xCA, 0x5B, 0xDE, 0x83, 0x54, 0x91, 0x9E, 0x34, 0x55, 0xDE, 0xC4, 0x87, 0xCA, 0x18,
-    0xD3, 0x73, 0xDE, 0x86, 0xE6, 0xFD, 0x83, 0xB7, 0x2F, 0x4D, 0x86, 0xD1, 0x20, 0x35, 0x24, 0xAC,
-    0x70, 0xAD, 0x32, 0xC6, 0xDE, 0xAF, 0xFD, 0x2D, 0xFF, 0xD4, 0xDF, 0xB8, 0xB5, 0x89, 0x12, 0xC9,
-    0x0E, 0x9F, 0xCC, 0x27, 0x63, 0x86, 0x43, 0x81, 0x71, 0x64, 0x49, 0x1E, 0xF9, 0xF3, 0x72, 0x4B,
-    0x86, 0xF9, 0xF5, 0x0D, 0xC8, 0x4C, 0xD0, 0xE7, 0x49, 0x23, 0x96, 0x64, 0x8B, 0x1C, 0xF9, 0xA6,
-    0xC7, 0x1A, 0x4E, 0x5B, 0xD1, 0xA8, 0x5F, 0x0F, 0x46, 0x31, 0x18, 0xC1, 0xB7, 0xC3, 0x41, 0x6C,
-    0x45, 0x38, 0x89, 0x89, 0x72, 0x4B, 0x02, 0xAB, 0x1B, 0x8D, 0x62, 0xCD, 0xC2, 0x7D, 0x5C, 0x76,
-    0x4E, 0xE9, 0xE7, 0x67, 0xE5, 0x9E, 0xED, 0x56, 0xD4, 0x45, 0x8F, 0x2B, 0x8F, 0xA2, 0x4C, 0x83,
-    0x6F, 0xC3, 0x46, 0x65, 0x1F, 0xC8, 0x5E, 0x85, 0x78, 0xB5, 0x34, 0x9F, 0x82, 0x0F, 0x8E, 0x9F,
-    0x6B, 0x5E, 0xC6, 0x95, 0xF3, 0x20, 0x0B, 0xA6, 0xA4, 0x4A, 0x9A, 0x3A, 0xC2, 0xDF, 0x9E, 0xEF,
-    0x11, 0x20, 0x00, 0x65, 0xA8, 0x78, 0xCC, 0x9B, 0x8F, 0xFF, 0x17, 0xBB, 0xBC, 0xA9, 0xC5, 0xEA,
-    0xCB, 0x2E, 0xDF, 0xEC, 0xD5, 0x30, 0x30, 0x88, 0x4B, 0x82, 0x25, 0x0F, 0xDC, 0xCA, 0x5C, 0xB9,
-    0xF0, 0x34, 0x19, 0xB1, 0x7C, 0x02, 0xB1, 0x93, 0xD7, 0xE1, 0x9C, 0xBE, 0x0D, 0x51, 0x85, 0x9B,
-    0x1A, 0xFD, 0x0A, 0x21, 0xA9, 0xC5, 0x79, 0xA4, 0x47, 0x3F, 0x95, 0x98, 0x38, 0x53, 0xC8, 0x37,
-    0x98, 0xA3, 0xBA, 0x9D, 0x99, 0x23, 0x49, 0xF1, 0x94, 0x2F, 0xE0, 0x61, 0xE8, 0xA9, 0x5A, 0x6A,
-    0xC2, 0x0C, 0xC7, 0xB4, 0xA6, 0x86, 0x3E, 0xB7, 0x84, 0x64, 0x8B, 0xCC, 0xB7, 0x08, 0xAD, 0xE8,
-    0x06, 0x81, 0x7C, 0x62, 0x4E, 0xC5, 0x27, 0x85, 0xCD, 0x12, 0x55, 0x33, 0xCA, 0x66, 0x0D, 0x67,
-    0xB0, 0x0E, 0x5C, 0x24, 0x83, 0xCA, 0x7F, 0xBC, 0x88, 0xFF, 0xF9, 0xCB, 0x25, 0xED, 0xE2, 0x7B,
-    0x2E, 0x41, 0x40, 0x61, 0x3B, 0x6F, 0x90, 0x9C, 0x42, 0xE0, 0x00, 0x8C, 0x92, 0x22, 0x97, 0xB5,
-    0x17, 0xE8, 0x14, 0xB9, 0x22, 0x9E, 0x44, 0xC5, 0x84, 0x47, 0xBA, 0xE8, 0xA0, 0xA0, 0x6E, 0xE8,
-    0x10, 0x60, 0xF4, 0xB3, 0x52, 0x76, 0x94, 0x03, 0xB1, 0x04, 0x2B, 0x97, 0x2E, 0xD8, 0x14, 0xC1,
-    0x17, 0xFD, 0x02, 0xEC, 0x44, 0x3E, 0x6F, 0xA1, 0xF7, 0xA2, 0x0E, 0x08, 0x54, 0x0A, 0xBD, 0xC8,
-    0x2E, 0x52, 0xA2, 0x78, 0x8E, 0x48, 0x34, 0x7D, 0x10, 0x31, 0x80, 0xDC, 0x4D, 0xE9, 0x64, 0x9C,
-    0x46, 0x25, 0x3F, 0xF3, 0xF6, 0xA1, 0x8E, 0x45, 0xC9, 0x1E, 0x46, 0xAC, 0x37, 0x4F, 0xC4, 0x93,
-    0x4A, 0x15, 0x65, 0xE9, 0x5E, 0xBD, 0x60, 0x5E, 0x8B, 0xCE, 0xB2, 0x65, 0xE0, 0xE6, 0x60, 0xF5,
-    0x47, 0x36, 0xFB, 0xD8, 0xC6, 0x33, 0x55, 0xC1, 0xBB, 0xAB, 0x41, 0x84, 0xEB, 0x36, 0x88, 0xF3,
-    0x65, 0xA2, 0x6A, 0xB7, 0xA3, 0x08, 0x5F, 0x5E, 0xE4, 0x55, 0xD4, 0x8B, 0x5E, 0x78, 0x55, 0xB4,
-    0x65, 0xD2, 0x8A, 0x77, 0x89, 0x3F, 0xA7, 0x02, 0xBE, 0x04, 0xAB, 0xCC, 0x87, 0x25, 0xB3, 0x44,
-    0x5B, 0x4B, 0x47, 0x89, 0x95, 0xA4, 0xDB, 0xE3, 0xFD, 0x9B, 0xEF, 0xAC, 0x74, 0xB0, 0x8B, 0xCA,
-    0xFE, 0x3B, 0x77, 0xE5, 0xEE, 0x21, 0xD5, 0x68, 0x49, 0x12, 0x21, 0x9D, 0xF3, 0xC2, 0xE4, 0xDF,
-    0x05, 0x9E, 0x55, 0xAF, 0x5B, 0x00, 0x39, 0x0A, 0x70, 0x3D, 0x64, 0xAD, 0x27, 0x84, 0xA9, 0x65,
-    0x3C, 0x22, 0x43, 0x35, 0x82, 0x8A, 0x7D, 0x6A, 0x99, 0xC7, 0x36, 0x31, 0x7A, 0x5E, 0x11, 0x72,
-    0xAA, 0x0E, 0x03, 0x06, 0x19, 0x02, 0x78, 0x09, 0xBA, 0xE7, 0x94, 0xBE, 0xD4, 0xA9, 0xE8, 0x85,
-    0xF6, 0x16, 0x17, 0x9C, 0xAB, 0x5F, 0xBC, 0xA8, 0xB3, 0x96, 0x20, 0x3E, 0x59, 0x2A, 0x84, 0x43,
-    0xA4, 0xE3, 0x3F, 0x01, 0x54, 0x6F, 0x66, 0xE4, 0xE2, 0x7B, 0xB8, 0x26, 0x4D, 0x76, 0x7C, 0x8B,
-    0xB5, 0x0A, 0x03, 0x43, 0xC9, 0xE4, 0xDC, 0x65, 0x46, 0x3B, 0x5B, 0x95, 0xC7, 0x8B, 0x87, 0x87,
-    0x7F, 0x72, 0x69, 0x65, 0x6C, 0x25, 0xC6, 0x3A, 0xC8, 0x15, 0xD1, 0x87, 0x46, 0xF6, 0x46, 0x44,
-    0x07, 0xEB, 0xB0, 0x45, 0x20, 0x98, 0x02, 0xD7, 0xD0, 0x55, 0x89, 0xDD, 0x5F, 0xEA, 0x0E, 0x31,
-    0x5E, 0x58, 0xEA, 0x97, 0x5B, 0xBF, 0xD7, 0xFA, 0x5D, 0xFE, 0x7A, 0x87, 0xF6, 0xF3, 0xE7, 0x2E,
-    0x21, 0x57, 0x22, 0x19, 0x33, 0x3A, 0xD5, 0xC8, 0x4C, 0x91, 0x2E, 0x8B, 0x09, 0x4E, 0xA7, 0x78,
-    0x82, 0x6C, 0x09, 0x82, 0xED, 0xE0, 0xF1, 0xC2, 0x7F, 0x13, 0x3F, 0xAE, 0x1C, 0x48, 0xA1, 0x11,
-    0x4B, 0x5B, 0xF7, 0x48, 0xB1, 0x52, 0xDB, 0x5D, 0x5A, 0x3D, 0xD2, 0xD3, 0x6C, 0xC6, 0x41, 0x70,
-    0x3F, 0x2C, 0xB4, 0xDC, 0x00, 0x14, 0xEA, 0x8F, 0x16, 0xBF, 0x0F, 0x36, 0xE6, 0xE0, 0x42, 0x13,
-    0xCC, 0xB3, 0x98, 0x8C, 0xF4, 0x9D, 0x5E, 0xEE, 0xB5, 0xA4, 0x6F, 0x20, 0xF0, 0xF4, 0x8A, 0x20,
-    0xEB, 0xF2, 0xC9, 0x1E, 0x69, 0x46, 0x04, 0x9F, 0xB2, 0xD6, 0x89, 0x82, 0x59, 0xC3, 0x69, 0xFE,
-    0x6E, 0xE0, 0x8D, 0x2B, 0x01, 0x9B, 0xD4, 0x1D, 0x84, 0xDE, 0x34, 0xD1, 0xEB, 0xA6, 0x8C, 0x0E,
-    0xC5, 0x33, 0x5A, 0x64, 0xB4, 0x68, 0x52, 0x37, 0x99, 0x95, 0x46, 0x94, 0x22, 0x6D, 0x45, 0x1B,
-    0x3D, 0x30, 0x06, 0x91, 0x39, 0x2B, 0x2F, 0x71, 0x46, 0x8C, 0x54, 0xFC, 0x9D, 0x8A, 0x13, 0x3D,
-    0xA9, 0x62, 0xA2, 0x66, 0xA9, 0x07, 0x2B, 0xB5, 0xE8, 0xF8, 0x1D, 0x48, 0x43, 0xBF, 0x17, 0x81,
-    0xD6, 0x7B, 0xA9, 0x32, 0x02, 0xF8, 0xC8, 0xFD, 0xF7, 0x51, 0xBF, 0xE3, 0x7A, 0x2C, 0x10, 0x80,
-    0x85, 0x71, 0x1F, 0x30, 0xE5, 0xEE, 0xD9, 0x7E, 0x89, 0x45, 0x4D, 0x63, 0x23, 0xEC, 0x5A, 0x8C,
-    0x85, 0xC3, 0x69, 0x35, 0x19, 0xA4, 0x1B, 0xF2, 0x60, 0x25, 0xC6, 0x5D, 0xC2, 0x04, 0x88, 0xCE,
-    0xCB, 0x01, 0x45, 0x27, 0x58, 0x7F, 0xE7, 0xBE, 0x0F, 0x93, 0xFF, 0x0C, 0x43, 0xFB, 0xAF, 0xE1,
-    0x0D, 0x59, 0x97, 0x2D, 0x78, 0x96, 0x9F, 0xBC, 0xE4, 0x93, 0xD8, 0x4A, 0xAF, 0x8E, 0x9C, 0x48,
-    0xA0, 0x31, 0x03, 0x34, 0xDB, 0xA1, 0x29, 0x66, 0xB1, 0x2C, 0x1B, 0xE6, 0x5F, 0xA0, 0xBF, 0x18,
-    0xC7, 0x62, 0xAC, 0x63, 0x80, 0x60, 0xC3, 0xB8, 0xBB, 0x86, 0xE9, 0xF4, 0xBD, 0xC4, 0xD0, 0x46,
-    0xC7, 0xAF, 0x94, 0x76, 0xB5, 0xA3, 0xC6, 0xF9, 0x38, 0x4D, 0x7E, 0x51, 0x05, 0x61, 0xB4, 0x0F,
-    0x67, 0x5E, 0xE0, 0xA2, 0x8C, 0x1B, 0x47, 0x2C, 0x57, 0x77, 0xC4, 0x75, 0x60, 0x20, 0x0D, 0x0C,
-    0x88, 0x90, 0x88, 0x35, 0xD2, 0x09, 0xC0, 0x94, 0x62, 0xC6, 0x75, 0x56, 0x13, 0xC6, 0x9D, 0x18,
-    0xF8, 0xDD, 0x22, 0xE8, 0x03, 0x98, 0x39, 0x10, 0xF3, 0x65, 0x73, 0xA8, 0x6C, 0x8D, 0xEF, 0x2A,
-    0x59, 0xA8, 0xE3, 0x1A, 0xD6, 0x13, 0x97, 0x30, 0x75, 0xF5, 0xBC, 0xDB, 0x05, 0x1B, 0x0B, 0x53,
-    0x97, 0xCE, 0x87, 0xB7, 0x1B, 0xFD, 0xA3, 0xB2, 0x37, 0x8C, 0x5E, 0xE2, 0x15, 0xA4, 0x79, 0xB2,
-    0xF7, 0xD9, 0x96, 0x57, 0x3D, 0x85, 0x54, 0x74, 0xAC, 0x9C, 0xFC, 0x92, 0x1C, 0xA0, 0xF3, 0x08,
-    0x2D, 0x91, 0x2B, 0x2D, 0x90, 0xE8, 0x15, 0x23, 0x23, 0xD3, 0x2A, 0x26, 0xBB, 0xFC, 0x2E, 0xF0,
-    0xD7, 0x1B, 0x48, 0x25, 0xBC, 0x89, 0x15, 0x42, 0x84, 0xB6, 0x54, 0xF6, 0x1A, 0x67, 0xB0, 0x30,
-    0x60, 0x42, 0x9A, 0x8A, 0x72, 0x40, 0xC0, 0xCC, 0x86, 0x29, 0x25, 0x9A, 0x53, 0x47, 0x12, 0x6E,
-    0x36, 0x51, 0x99, 0xBD, 0x6E, 0xA5, 0x24, 0xE1, 0xF5, 0x1D, 0xB7, 0x3B, 0x1E, 0xFD, 0xAE, 0x5B,
-    0x13, 0x32, 0xBD, 0x11, 0x47, 0x4F, 0xD5, 0x46, 0xF2, 0x58, 0x76, 0x2B, 0xAD, 0xD8, 0x42, 0x72,
-    0x0F, 0xCF, 0x5C, 0x59, 0x76, 0x75, 0x07, 0xC6, 0x5C, 0x99, 0xD6, 0xFA, 0xB5, 0x60, 0xE7, 0xDB,
-    0x5D, 0x5E, 0x4B, 0x5D, 0x68, 0x90, 0x62, 0x3A, 0x39, 0xB3, 0xE6, 0x99, 0x08, 0xF1, 0x43, 0x07,
-    0x5E, 0x92, 0x6B, 0x7C, 0x08, 0x8C, 0x38, 0x39, 0x99, 0x7C, 0xF0, 0x40, 0xC7, 0xC2, 0x0A, 0xA6,
-    0x7C, 0xFD, 0x4B, 0xE4, 0x56, 0x02, 0x8C, 0x56, 0x14, 0xE2, 0x2F, 0xE7, 0xAF, 0x7F, 0x11, 0x4A,
-    0xF5, 0xE6, 0xCA, 0x7C, 0x78, 0xC8, 0xD3, 0x94, 0x8A, 0x4E, 0x7F, 0x03, 0xF9, 0xBC, 0xFB, 0x29,
-    0xD5, 0x79, 0xFF, 0x50, 0xCC, 0x13, 0x1D, 0x48, 0xEC, 0xF6, 0x4C, 0x7B, 0xCD, 0x4B, 0x4F, 0xC1,
-    0x72, 0xF4, 0x12, 0xDC, 0x82, 0x50, 0xF9, 0xC8, 0x88, 0x2E, 0x35, 0xCF, 0xDD, 0xD5, 0x74, 0x0E,
-    0x98, 0x10, 0x69, 0xAB, 0x20, 0x19, 0x93, 0x04, 0x14, 0x0B, 0x80, 0xB7, 0x77, 0x99, 0xFB, 0x82,
-    0xD5, 0xB2, 0x23, 0x8F, 0x51, 0x9B, 0x9A, 0x2B, 0x11, 0x2A, 0x38, 0xCD, 0x7D, 0xD6, 0x37, 0x46,
-    0x93, 0xD1, 0x8A, 0x2B, 0x4B, 0x5E, 0x46, 0x56, 0xC8, 0x8A, 0x57, 0x60, 0x79, 0x30, 0x05, 0xCA,
-    0xF1, 0x22, 0x1B, 0x81, 0xD1, 0x2F, 0x00, 0x0B, 0xBC, 0x80, 0x20, 0xDA, 0x23, 0x88, 0x22, 0x6F,
-    0x48, 0x9C, 0x05, 0x4C, 0x28, 0x91, 0x27, 0x47, 0x92, 0x6B, 0x47, 0x95, 0x3F, 0x27, 0x8E, 0x92,
-    0x53, 0x4E, 0x70, 0xA6, 0xF9, 0xF0, 0x08, 0xEC, 0xAD, 0x7F, 0x83, 0x1B, 0x82, 0xE2, 0x26, 0x4F,
-    0xF5, 0xAA, 0xB8, 0x7A, 0xE3, 0xB6, 0x17, 0x14, 0x5D, 0x65, 0xC1, 0x2B, 0xB1, 0xFC, 0x58, 0x36,
-    0xC9, 0xEB, 0xE3, 0xCA, 0xB3, 0xC7, 0x3E, 0x8B, 0x99, 0x76, 0x68, 0x73, 0x37, 0xC6, 0x1A, 0x0F,
-    0x4F, 0x1C, 0x19, 0xA7, 0xE4, 0x51, 0x2B, 0xEB, 0x94, 0x3C, 0xEA, 0x17, 0x2C, 0xF4, 0x59, 0x6A,
-    0x31, 0x2D, 0x79, 0xD4, 0x1F, 0x99, 0x94, 0xBE, 0xE9, 0xEE, 0x1A, 0xC5, 0xEB, 0x9E, 0x9B, 0xAD,
-    0xFA, 0x6C, 0x25, 0x40, 0x87, 0xEB, 0x4F, 0xD4, 0x5C, 0xFD, 0xCA, 0xA3, 0xEE, 0x57, 0x1E, 0x75,
-    0xBF, 0xF2, 0xA8, 0xC7, 0x1D, 0x8F, 0xBA, 0x58, 0xD3, 0x59, 0xFD, 0xCA, 0xA3, 0x76, 0x3B, 0x1E,
-    0x35, 0x51, 0xAF, 0xDC, 0x8D, 0xAC, 0x55, 0xF2, 0xA8, 0xC9, 0x5C, 0x25, 0x8F, 0x9A, 0xEC, 0x55,
-    0xE5, 0x51, 0x57, 0x1A, 0x42, 0x15, 0x5F, 0xAF, 0x4D, 0x99, 0x68, 0x17, 0x81, 0xF0, 0x4C, 0x56,
-    0x1D, 0xD3, 0x1A, 0xE3, 0x48, 0xDB, 0x15, 0x57, 0xAF, 0x2E, 0xD2, 0x76, 0xE7, 0x52, 0xDC, 0xE0,
-    0x06, 0x4F, 0x11, 0xB7, 0xC5, 0x37, 0xD9, 0x46, 0xE1, 0x92, 0x2D, 0x2C, 0x8F, 0xCD, 0x90, 0x26,
-    0x0A, 0x5C, 0x3E, 0x91, 0x4D, 0x5B, 0xDE, 0xB3, 0x2A, 0x23, 0xA5, 0x72, 0x70, 0x3E, 0x52, 0x67,
-    0x88, 0xC0, 0x17, 0xCE, 0xD9, 0x13, 0x29, 0x51, 0x99, 0x4E, 0xD1, 0x89, 0x2B, 0x81, 0xB3, 0x7F,
-    0xBE, 0x90, 0x29, 0xFC, 0xC2, 0x2C, 0xB0, 0xB0, 0x9C, 0xA3, 0x29, 0xB6, 0xA1, 0xA6, 0x26, 0x8B,
-    0x56, 0xCC, 0xB8, 0x83, 0xA5, 0xBF, 0x11, 0x36, 0xF8, 0x86, 0x6C, 0xF0, 0xC7, 0xEB, 0xCF, 0x66,
-    0x83, 0x27, 0xFE, 0x92, 0x0C, 0x37, 0xC7, 0x83, 0xA1, 0xE8, 0x2F, 0x9E, 0x13, 0x84, 0x59, 0xD6,
-    0x9C, 0x82, 0x6C, 0xF4, 0xDF, 0xBF, 0x52, 0x80, 0xDE, 0x81, 0x4A, 0x5A, 0x46, 0x79, 0xC0, 0x1E,
-    0x86, 0x15, 0x6A, 0xB5, 0x8E, 0x32, 0xA4, 0x91, 0x1E, 0xA9, 0xE3, 0xEA, 0x9F, 0x28, 0xC7, 0x99,
-    0x6A, 0x2F, 0x1D, 0x95, 0x37, 0xF7, 0xA6, 0xAA, 0x21, 0xD2, 0xF4, 0x6C, 0x8E, 0x15, 0x38, 0x98,
-    0x2D, 0xCC, 0x7C, 0x85, 0xA2, 0x5A, 0x17, 0xD5, 0x95, 0x1E, 0x8A, 0xAB, 0x1E, 0x73, 0xE3, 0xAE,
-    0x94, 0xD1, 0xBD, 0xA5, 0x89, 0xC3, 0x94, 0x84, 0xE8, 0x91, 0xF6, 0xC7, 0xB5, 0x25, 0xF3, 0x8A,
-    0xF2, 0x86, 0x9F, 0x8B, 0x90, 0xC9, 0xB7, 0x3B, 0x26, 0xCD, 0x94, 0xD0, 0xCD, 0xB4, 0x2F, 0x32,
-    0x26, 0x4D, 0xA8, 0x88, 0x19, 0x44, 0x3F, 0xA4, 0xAF, 0xCB, 0x1D, 0x91, 0x3E, 0xDC, 0x7E, 0x08,
-    0x38, 0xF0, 0x43, 0x39, 0x69, 0x71, 0x06, 0xFC, 0x33, 0x67, 0x54, 0xB6, 0x68, 0x35, 0x3D, 0x1A,
-    0x3C, 0x83, 0x61, 0xF9, 0xE1, 0x1C, 0x6C, 0xE6, 0x1C, 0xA4, 0x8D, 0x72, 0xFA, 0x83, 0xBC, 0x71,
-    0x0B, 0x13, 0xCF, 0xB8, 0xF8, 0xD7, 0x71, 0x4F, 0xF9, 0x0D, 0xFE, 0x8E, 0x68, 0x6D, 0x46, 0x02,
-    0x26, 0x8D, 0x04, 0x30, 0x41, 0x4E, 0xA5, 0x4C, 0x76, 0x05, 0x4B, 0x81, 0x14, 0x06, 0x9D, 0xC8,
-    0xAE, 0x06, 0xFD, 0x30, 0x7F, 0x12, 0x13, 0x9A, 0x7D, 0x3C, 0x30, 0x17, 0xB9, 0xE4, 0xF4, 0xF7,
-    0xCA, 0xBF, 0x35, 0x8A, 0x89, 0x6E, 0x53, 0x83, 0x40, 0x46, 0xC3, 0xDC, 0x1A, 0x42, 0xCA, 0x3F,
-    0x9C, 0x31, 0xBA, 0x68, 0xC9, 0xDE, 0x64, 0x82, 0xF5, 0x9D, 0x29, 0x27, 0x0D, 0x83, 0x18, 0x12,
-    0xCA, 0x9A, 0xE9, 0x62, 0x56, 0x1E, 0x77, 0x91, 0x92, 0x1D, 0x0A, 0x98, 0x8C, 0xB3, 0x47, 0xD7,
-    0x77, 0xA2, 0x5A, 0x20, 0x08, 0x34, 0x31, 0xC4, 0x5A, 0xC9, 0x88, 0x43, 0x70, 0xAE, 0x82, 0xFC,
-    0x0F, 0xC0, 0xF9, 0xB8, 0xF7, 0x82, 0x8C, 0xF3, 0x95, 0x11, 0x38, 0xEE, 0xAD, 0xBA, 0x55, 0xA6,
-    0x94, 0x22, 0xD3, 0x2D, 0x97, 0xA6, 0x7C, 0x0C, 0x6D, 0x06, 0x3E, 0xFE, 0x25, 0x8B, 0x32, 0x51,
-    0x07, 0xDC, 0x08, 0x06, 0x0C, 0x41, 0x06, 0x17, 0x7F, 0x46, 0xF5, 0xFF, 0x3E, 0x6B, 0xBE, 0x74,
-    0x7F, 0x4B, 0x7A, 0xF0, 0x27, 0x4C, 0x6C, 0x7F, 0x9A, 0x35, 0x7F, 0xF7, 0x01, 0xAC, 0xF9, 0xEE,
-    0x61, 0x58, 0xF3, 0xC3, 0x3F, 0x92, 0x35, 0x0F, 0x93, 0xC2, 0x50, 0x90, 0xA6, 0x07, 0xDA, 0xCD,
-    0xB3, 0xF3, 0x25, 0xCD, 0x85, 0xC5, 0x3E, 0xCE, 0x0C, 0x55, 0x12, 0xCE, 0x67, 0x2E, 0x05, 0xF9,
-    0x1B, 0x28, 0x6F, 0x85, 0x2B, 0x55, 0x77, 0xBC, 0xFF, 0x86, 0x60, 0x92, 0x74, 0x81, 0x41, 0xF1,
-    0x4A, 0xAC, 0x24, 0x68, 0x99, 0x87, 0x7B, 0x32, 0x0D, 0x2E, 0x77, 0x55, 0xDE, 0x8B, 0xDE, 0x5E,
-    0x04, 0x4E, 0xD7, 0xA2, 0xCB, 0xE1, 0xD5, 0xC8, 0x6C, 0x3C, 0x25, 0x67, 0x44, 0xEE, 0x79, 0xA6,
-    0x05, 0xAA, 0xC3, 0x6F, 0xFE, 0xAE, 0xD4, 0x10, 0xC8, 0xEE, 0xCA, 0x5F, 0x43, 0xE0, 0xE6, 0xCC,
-    0x73, 0x6F, 0x23, 0xD3, 0x2E, 0x1E, 0x63, 0xF6, 0x43, 0xD9, 0x23, 0x9F, 0x8C, 0x9A, 0x9B, 0xA3,
-    0x33, 0xC5, 0x2D, 0xA2, 0xCE, 0x15, 0x5E, 0x2D, 0x74, 0x63, 0xB0, 0x52, 0xF5, 0x1D, 0xB1, 0x8D,
-    0x13, 0x78, 0x63, 0x15, 0x46, 0x03, 0x2C, 0x91, 0x32, 0x23, 0x08, 0x18, 0x55, 0x92, 0x8B, 0x1E,
-    0x9E, 0xA2, 0xD4, 0x97, 0x88, 0xBD, 0x55, 0xA1, 0xFA, 0x0A, 0x50, 0x1F, 0x0A, 0x72, 0x1F, 0x44,
-    0xB3, 0xE7, 0x6B, 0x9D, 0xC2, 0x5B, 0x52, 0xEA, 0xF3, 0x3D, 0x4A, 0x7D, 0x61, 0x19, 0x9D, 0x7C,
-    0x8F, 0x52, 0xBF, 0xD2, 0xEC, 0x95, 0xA7, 0x46, 0xD4, 0x47, 0x4C, 0x9C, 0xBB, 0xA3, 0x8C, 0x6B,
-    0x34, 0x68, 0x3B, 0x87, 0x66, 0x2F, 0x6F, 0x67, 0x56, 0xC5, 0x0C, 0xCE, 0x65, 0x28, 0xCA, 0x0D,
-    0x5C, 0x62, 0xB8, 0xE7, 0xCC, 0x98, 0x15, 0x28, 0x9A, 0x2E, 0x22, 0x2B, 0xA0, 0xC3, 0x41, 0xB6,
-    0x4B, 0xDA, 0x85, 0xB3, 0x52, 0xB4, 0x94, 0xC8, 0xDF, 0xC4, 0xA6, 0xA6, 0x5D, 0x91, 0xDC, 0xFD,
-    0x06, 0xEA, 0xC2, 0xC0, 0xA9, 0x03, 0xA5, 0x35, 0x27, 0xAF, 0x55, 0x56, 0x88, 0x51, 0xA1, 0x4E,
-    0xB7, 0x5E, 0xA8, 0xCC, 0x1A, 0xD7, 0x6B, 0x8C, 0x50, 0x71, 0x59, 0x60, 0x30, 0x8D, 0xD3, 0x86,
-    0x8E, 0x14, 0x36, 0x65, 0xC1, 0x4A, 0xDE, 0x0D, 0x3C, 0xFA, 0x57, 0x08, 0x66, 0x88, 0x6C, 0x34,
-    0x54, 0x08, 0xDD, 0x95, 0x7B, 0xD2, 0xB9, 0x75, 0x55, 0x70, 0x1E, 0x7C, 0x6A, 0x6D, 0x02, 0x3D,
-    0x92, 0xC3, 0x43, 0x6B, 0x25, 0xE0, 0x76, 0xB5, 0xE3, 0x3B, 0x4F, 0x4F, 0xF5, 0x72, 0xBD, 0x2B,
-    0xF0, 0x32, 0x96, 0x8A, 0xA7, 0xF9, 0x07, 0xBE, 0x62, 0x41, 0xC5, 0x41, 0xB3, 0x94, 0x62, 0x26,
-    0x43, 0x43, 0x01, 0x8D, 0x25, 0x73, 0x77, 0xC5, 0x0B, 0xD4, 0x0F, 0xA0, 0x12, 0x32, 0x77, 0x89,
-    0x2A, 0xC2, 0x17, 0x0F, 0x51, 0x6A, 0x4E, 0x43, 0x42, 0x65, 0xCD, 0xC4, 0x24, 0xE0, 0x1F, 0xED,
-    0x59, 0x59, 0x60, 0x1B, 0xFA, 0xD7, 0x56, 0x91, 0x1E, 0xD7, 0x44, 0xBD, 0xD2, 0xAA, 0x82, 0xF2,
-    0xDD, 0x67, 0x19, 0x4E, 0x26, 0x86, 0x4F, 0x46, 0x06, 0x7F, 0xF2, 0x36, 0x3A, 0x1D, 0x6E, 0xAB,
-    0x6D, 0xF8, 0x89, 0x1F, 0xBD, 0x33, 0x77, 0x32, 0x55, 0xBA, 0xBB, 0xBC, 0xFF, 0xC5, 0x6F, 0xEA,
-    0xD6, 0xEA, 0x55, 0xF1, 0xB3, 0x88, 0xB4, 0xD3, 0x74, 0x38, 0xBB, 0x32, 0xC4, 0x93, 0xD5, 0x7E,
-    0x6A, 0x4D, 0x52, 0xA0, 0xC5, 0x56, 0x77, 0x40, 0x5E, 0x62, 0xA2, 0x82, 0xFC, 0x88, 0x4C, 0x53,
-    0x8E, 0xD8, 0xB3, 0x77, 0xC8, 0x45, 0xC8, 0xE1, 0x8B, 0x47, 0x0B, 0x27, 0xA1, 0x6E, 0x50, 0xC9,
-    0x02, 0x52, 0x3A, 0xDF, 0x5A, 0x89, 0x06, 0x82, 0x6C, 0x03, 0x5E, 0x82, 0x39, 0x86, 0x70, 0x25,
-    0x03, 0x08, 0xE8, 0xE6, 0x01, 0xD9, 0x5F, 0x42, 0x80, 0x24, 0xD8, 0xF3, 0x1C, 0x99, 0xA2, 0xA0,
-    0x16, 0x47, 0xBD, 0x8B, 0x91, 0xCC, 0x6F, 0xF2, 0x4F, 0x87, 0x97, 0xAC, 0xB3, 0x85, 0x75, 0x2E,
-    0xF1, 0x78, 0x0D, 0xD2, 0x48, 0x04, 0x9C, 0x2E, 0x3A, 0x49, 0xDC, 0xBF, 0xDA, 0x13, 0x61, 0xE1,
-    0x37, 0x70, 0xA1, 0x46, 0xAD, 0xFD, 0x18, 0x74, 0x02, 0x59, 0xBC, 0xCA, 0x72, 0x02, 0xD6, 0x5A,
-    0x8D, 0x24, 0xF5, 0x21, 0x4E, 0xC4, 0x70, 0x51, 0x7B, 0x4E, 0x36, 0xDD, 0xE2, 0xD8, 0x6A, 0x01,
-    0x4F, 0x18, 0x28, 0x87, 0x94, 0x1B, 0x9E, 0x6F, 0x51, 0x03, 0xD8, 0x53, 0x79, 0xE6, 0x64, 0x65,
-    0xCA, 0x1C, 0x9E, 0xA3, 0x86, 0x6B, 0x34, 0xEA, 0xDC, 0x94, 0xA4, 0x20, 0x56, 0xB5, 0x56, 0xA2,
-    0xD4, 0x57, 0x1F, 0x10, 0xDA, 0xBB, 0x1E, 0xEC, 0xD5, 0x31, 0x44, 0x6E, 0xDC, 0xDC, 0xE0, 0xC2,
-    0x3F, 0x05, 0xC1, 0xAC, 0x05, 0xB3, 0xD3, 0x9D, 0xF9, 0x8F, 0xBA, 0xDD, 0xAB, 0x7C, 0x88, 0x51,
-    0x8C, 0x07, 0xD2, 0x77, 0x95, 0xA1, 0xD0, 0x35, 0x1A, 0xF1, 0x74, 0xE0, 0x84, 0xD7, 0xEC, 0x48,
-    0x00, 0x32, 0x8A, 0x2B, 0xE2, 0x79, 0xA3, 0x7B, 0xB2, 0xC2, 0xF3, 0xC9, 0xFE, 0xA0, 0xD4, 0xE4,
-    0x73, 0x91, 0x0D, 0xA1, 0x7B, 0x0E, 0x75, 0x5F, 0xAC, 0x4A, 0x6D, 0x52, 0xD2, 0xEA, 0x2C, 0xE9,
-    0xAF, 0xD1, 0xAC, 0x95, 0x12, 0xBA, 0xA8, 0xEC, 0x80, 0xA5, 0x56, 0x2F, 0x8F, 0x3F, 0xA0, 0x7B,
-    0x4D, 0xD6, 0xEC, 0xB9, 0x46, 0xAF, 0x33, 0x27, 0xF5, 0x43, 0xA8, 0xA1, 0xBB, 0x0C, 0x6F, 0x3D,
-    0xB1, 0x6C, 0x87, 0x68, 0x8A, 0x86, 0x70, 0x48, 0xFA, 0xA4, 0xDB, 0xF6, 0x60, 0x34, 0xC6, 0x9D,
-    0xC0, 0xB1, 0x2A, 0x6D, 0xF3, 0x26, 0xAF, 0xCA, 0x4A, 0x8E, 0x48, 0x3A, 0x37, 0xF9, 0xF7, 0x11,
-    0xC9, 0x80, 0x6F, 0x94, 0xA3, 0xA8, 0x82, 0xA9, 0x77, 0x1B, 0x0B, 0xB5, 0x9E, 0xCC, 0xEE, 0x95,
-    0xDB, 0xA7, 0xB3, 0x7D, 0x68, 0xEF, 0xA1, 0x25, 0x9E, 0x5A, 0x31, 0x92, 0xAF, 0x21, 0x32, 0x8C,
-    0xE2, 0xE4, 0x66, 0x63, 0x9C, 0x82, 0xCC, 0x90, 0xEF, 0xEE, 0x18, 0x99, 0xDB, 0xD0, 0xEE, 0x6A,
-    0x2B, 0xEA, 0x71, 0x57, 0x21, 0xA2, 0x27, 0x6D, 0xAD, 0xCE, 0x44, 0x56, 0xED, 0xAB, 0x22, 0x66,
-    0xFF, 0xEB, 0xCC, 0x8F, 0xB8, 0x7D, 0x16, 0x5F, 0x33, 0xE2, 0xD6, 0xCE, 0x40, 0xBD, 0x6F, 0xC6,
-    0x50, 0x72, 0xC2, 0x22, 0x93, 0xC5, 0x7E, 0xE7, 0x18, 0x2A, 0xA1, 0x21, 0x19, 0x3F, 0x83, 0xE4,
-    0xF2, 0xF2, 0x83, 0x48, 0x2E, 0xD9, 0x4A, 0x72, 0xF9, 0x8A, 0xA8, 0xBB, 0xBF, 0x58, 0x49, 0x2E,
-    0xC8, 0xAB, 0x9E, 0xAB, 0x55, 0x9A, 0xE1, 0x87, 0xD6, 0x3E, 0x8C, 0xB4, 0xF0, 0x38, 0x7F, 0xBA,
-    0x48, 0xC5, 0xBB, 0xFA, 0x7A, 0xAC, 0xBB, 0x2F, 0x59, 0xA4, 0x92, 0x7F, 0xCA, 0xD5, 0xAF, 0x55,
-    0xDB, 0x7E, 0x78, 0x1D, 0x17, 0xFB, 0x88, 0x62, 0xFE, 0x8B, 0xC9, 0x1A, 0x5B, 0xAC, 0x58, 0x5D,
-    0x13, 0x99, 0xDC, 0x3B, 0x32, 0x28, 0x10, 0x24, 0xDF, 0xC0, 0xDC, 0xDD, 0xB8, 0xF2, 0xEE, 0x4B,
-    0xF4, 0x81, 0x4F, 0xF3, 0xA7, 0x2B, 0x85, 0x23, 0xA6, 0x14, 0xD5, 0x6E, 0x95, 0xD4, 0x75, 0x72,
-    0x8D, 0x8F, 0x3B, 0xD1, 0x2A, 0xB8, 0xE8, 0xB7, 0x2C, 0x36, 0x7C, 0xC6, 0x73, 0x81, 0x48, 0x7E,
-    0x79, 0x9E, 0x11, 0xA3, 0x88, 0x35, 0xF3, 0x29, 0x8D, 0xB0, 0xE8, 0x17, 0x47, 0x06, 0x20, 0x8B,
-    0x90, 0xE9, 0x8E, 0x30, 0xAC, 0x34, 0x73, 0x12, 0x4F, 0x34, 0x5B, 0x39, 0xFB, 0x1A, 0x8E, 0xD8,
-    0x0A, 0x5B, 0x14, 0x7B, 0x14, 0x46, 0x9F, 0x3B, 0x5D, 0xBF, 0x34, 0xAE, 0x12, 0xB2, 0x57, 0xD0,
-    0xA4, 0x2A, 0x34, 0x55, 0x42, 0x6D, 0x17, 0xE4, 0xBF, 0x40, 0xCD, 0x45, 0xDE, 0x83, 0x69, 0x29,
-    0xBF, 0x0B, 0x3C, 0x9C, 0x42, 0x84, 0x4F, 0x65, 0x13, 0xCA, 0x6B, 0x4F, 0xC3, 0xF9, 0x86, 0x32,
-    0xAD, 0x7B, 0x8D, 0xA6, 0xB3, 0x83, 0x15, 0x01, 0xFF, 0xBC, 0x07, 0x41, 0x38, 0xFF, 0x04, 0x49,
-    0x93, 0x6D, 0xB4, 0x7C, 0xB4, 0x75, 0x3A, 0x77, 0x71, 0xAD, 0x73, 0x69, 0x2D, 0x58, 0x56, 0xA3,
-    0xCD, 0x0F, 0xFE, 0x61, 0x51, 0x15, 0x65, 0xC8, 0xA9, 0x1A, 0x85, 0x0C, 0x49, 0xD4, 0x6A, 0x60,
-    0x5C, 0xD3, 0x59, 0x83, 0x98, 0xBF, 0x50, 0x3F, 0xBB, 0xEE, 0x57, 0x77, 0x84, 0x7E, 0x5A, 0x70,
-    0xE8, 0xDC, 0xDD, 0x8B, 0x26, 0xEE, 0x56, 0x86, 0x9C, 0x9B, 0x4D, 0xD1, 0x75, 0x37, 0x4D, 0xA5,
-    0xBB, 0x46, 0xF7, 0x8B, 0x55, 0x64, 0xD1, 0xAB, 0xB0, 0x99, 0xB0, 0x06, 0x3F, 0xEC, 0x66, 0x30,
-    0x2A, 0x07, 0x50, 0xFE, 0x81, 0x11, 0xC4, 0xC2, 0x71, 0x4C, 0x47, 0xC0, 0xC2, 0x09, 0x28, 0x4B,
-    0x06, 0x13, 0x9F, 0xA6, 0x8A, 0xC6, 0x22, 0x0B, 0xAE, 0x5C, 0xA1, 0x1F, 0x55, 0xFC, 0xD6, 0x4C,
-    0x9A, 0x60, 0xF3, 0xC3, 0xD2, 0x1D, 0x2A, 0x3B, 0x89, 0xFA, 0x7F, 0xF4, 0x95, 0xD2, 0x9F, 0x2E,
-    0x7D, 0xA7, 0xE4, 0x59, 0xDE, 0x14, 0x91, 0xAE, 0xB2, 0x55, 0xB8, 0x36, 0x70, 0xB6, 0x22, 0xD2,
-    0x5E, 0x1B, 0xAD, 0x06, 0x9C, 0xF5, 0xED, 0xAE, 0x4F, 0xD5, 0x2D, 0x7B, 0xCA, 0x8C, 0xBC, 0x75,
-    0x43, 0xD0, 0x9A, 0x9F, 0xD4, 0x87, 0x2E, 0x35, 0x65, 0x92, 0xB8, 0x53, 0x71, 0xCD, 0xD4, 0x37,
-    0xE4, 0xB0, 0xE6, 0x0A, 0x3E, 0x88, 0x68, 0xB0, 0xC4, 0xFA, 0x81, 0xFC, 0x03, 0xCF, 0x92, 0xCD,
-    0xA9, 0xFD, 0x8E, 0xB6, 0xDA, 0x02, 0xAB, 0x51, 0x78, 0xDD, 0xD3, 0xDA, 0x32, 0x3A, 0xC6, 0xA2,
-    0x53, 0xA4, 0x9B, 0x76, 0x91, 0xBD, 0xD5, 0xBF, 0x8B, 0x7C, 0xBD, 0xF7, 0x3E, 0x0D, 0xAC, 0x95,
-    0x5F, 0xB5, 0xD9, 0x4D, 0x8D, 0x43, 0xDA, 0x81, 0xD9, 0x37, 0x95, 0x68, 0x02, 0x56, 0x33, 0xF7,
-    0x5D, 0x79, 0x4A, 0x05, 0x63, 0x60, 0x7C, 0xDC, 0x72, 0xF1, 0x75, 0x5F, 0xE5, 0x1D, 0x40, 0xFB,
-    0x77, 0x00, 0x9E, 0x5A, 0xD4, 0x5B, 0x74, 0xA0, 0x15, 0x76, 0xCA, 0xDE, 0xF9, 0x16, 0x33, 0xCE,
-    0x7C, 0x62, 0x66, 0xBC, 0xDD, 0xEB, 0x33, 0xE4, 0xE1, 0x0D, 0x76, 0x82, 0x79, 0x81, 0x47, 0xD9,
-    0xEA, 0xC0, 0x0C, 0x83, 0x19, 0xC8, 0x84, 0xF6, 0x31, 0xA5, 0x5D, 0x04, 0x0F, 0xB4, 0xE5, 0x86,
-    0x68, 0x68, 0x22, 0x19, 0x5D, 0x96, 0xCD, 0x5C, 0x33, 0x57, 0x83, 0x78, 0x94, 0x56, 0x72, 0xC0,
-    0x62, 0x87, 0xEC, 0x66, 0xF1, 0xCD, 0xE5, 0xD2, 0x76, 0x57, 0xDD, 0x32, 0xB0, 0xEE, 0xA5, 0xD7,
-    0x88, 0x4E, 0xB2, 0x56, 0xC5, 0x6B, 0x5F, 0xB1, 0xBA, 0x59, 0xB3, 0x80, 0x81, 0xC9, 0xA1, 0xCD,
-    0xC7, 0xA3, 0x47, 0x47, 0xFF, 0xF6, 0x49, 0x79, 0x1F, 0x86, 0x97, 0x54, 0xDB, 0x7E, 0x33, 0x80,
-    0x68, 0x1E, 0xC4, 0x62, 0x87, 0xC4, 0x85, 0xFB, 0x8E, 0x20, 0xB4, 0x18, 0x1D, 0x81, 0x00, 0x79,
-    0x93, 0x66, 0x3B, 0x6C, 0x30, 0x73, 0x99, 0x56, 0x17, 0xFB, 0xDB, 0xF9, 0x6C, 0x00, 0xD3, 0x78,
-    0x8D, 0xE9, 0xA7, 0xF3, 0xC5, 0x26, 0x08, 0x0E, 0x2E, 0x81, 0x6B, 0x09, 0x42, 0x75, 0x0C, 0x7E,
-    0x75, 0x32, 0xB1, 0xF0, 0x0E, 0x24, 0xD0, 0x81, 0x74, 0x53, 0xB4, 0xAF, 0x11, 0x73, 0x27, 0x4F,
-    0x8D, 0x65, 0x69, 0xB3, 0x16, 0x74, 0x51, 0xD1, 0x3F, 0x55, 0xEA, 0x99, 0x75, 0xD6, 0x72, 0xE1,
-    0xE8, 0xAF, 0x16, 0x5F, 0xA6, 0x13, 0x4F, 0x3E, 0xB8, 0x49, 0x4B, 0x41, 0x7A, 0x62, 0xDA, 0x7B,
-    0x0B, 0xA6, 0xB1, 0xE1, 0xC5, 0xEF, 0x2A, 0x0A, 0x44, 0xB4, 0x9E, 0xFC, 0x15, 0x41, 0x96, 0x4B,
-    0xD6, 0x24, 0x6F, 0x8F, 0x9B, 0x29, 0x2F, 0xB2, 0x17, 0xFA, 0xED, 0xF0, 0x58, 0x90, 0x47, 0x6D,
-    0xD2, 0x7F, 0xE7, 0x60, 0xD9, 0xB2, 0xCC, 0x6B, 0x0A, 0x2E, 0xCB, 0xA4, 0x43, 0xCD, 0xE6, 0x2A,
-    0x40, 0x75, 0x61, 0x41, 0x7D, 0x5E, 0x22, 0x2B, 0x34, 0xC5, 0xF6, 0x6B, 0x2A, 0xBC, 0xA6, 0xA4,
-    0xCF, 0xD3, 0xD7, 0x97, 0xE8, 0xE7, 0x63, 0xD9, 0xBE, 0x9A, 0x3F, 0x33, 0xC5, 0xF7, 0xEE, 0x3D,
-    0xA8, 0xC2, 0x2B, 0x04, 0x65, 0x38, 0x2F, 0x64, 0xAB, 0xF7, 0x02, 0x11, 0xCA, 0xFD, 0x0A, 0xAF,
-    0xB0, 0x3A, 0x5B, 0xF4, 0xDB, 0x96, 0xAC, 0xB9, 0x29, 0xFD, 0xEA, 0x63, 0xF1, 0x5F, 0x64, 0x4F,
-    0xBE, 0xF5, 0x5C, 0x73, 0xEF, 0xCE, 0x1E, 0x6B, 0x2E, 0x89, 0x9B, 0xE8, 0x8D, 0x6E, 0xF3, 0xEF,
-    0x94, 0x35, 0x17, 0x9E, 0x7E, 0xE0, 0xF8, 0x41, 0x53, 0xD4, 0xFB, 0xF8, 0x27, 0xA3, 0xA2, 0xF5,
-    0x1D, 0xA5, 0xF0, 0xD0, 0x49, 0x12, 0xF4, 0xE3, 0x6A, 0x51, 0x12, 0xAD, 0xE0, 0x24, 0x41, 0x9C,
-    0x00, 0x4B, 0xD1, 0x80, 0x5A, 0xC9, 0x21, 0x59, 0x99, 0xBB, 0x2C, 0x90, 0x65, 0xEF, 0x15, 0x56,
-    0xD7, 0x82, 0x57, 0xDB, 0x92, 0x42, 0xAB, 0x4A, 0x76, 0x97, 0x72, 0xA7, 0x25, 0x22, 0x7D, 0x74,
-    0xBB, 0x8E, 0x2A, 0x5E, 0xC7, 0x92, 0xFC, 0xB6, 0x52, 0xEE, 0x7F, 0x86, 0x5B, 0xFF, 0xE1, 0x31,
-    0xF9, 0xB2, 0x70, 0x8E, 0xA3, 0x45, 0x43, 0x23, 0x1B, 0x77, 0x9B, 0x80, 0xA3, 0x13, 0xC4, 0xF3,
-    0x94, 0x3C, 0xE1, 0x14, 0x5B, 0x0C, 0xBB, 0x80, 0x66, 0x3C, 0xFE, 0x53, 0x31, 0x08, 0x57, 0x9C,
-    0xC1, 0xFF, 0x0B, 0xDE, 0xF9, 0xC9, 0xCD, 0x2F, 0x48, 0xDD, 0xCE, 0xB7, 0x58, 0x5E, 0xF2, 0xAD,
-    0x10, 0xD7, 0x44, 0x80, 0x77, 0xC4, 0xD4, 0xC6, 0x85, 0x4C, 0xF0, 0x1C, 0x17, 0xCF, 0x59, 0x8C,
-    0x86, 0x0A, 0x31, 0xDB, 0xCB, 0x57, 0xF9, 0x74, 0x8A, 0x57, 0x98, 0x1A, 0x2A, 0x66, 0x65, 0xAF,
-    0xA0, 0xD9, 0xE8, 0x78, 0xCB, 0xC4, 0x65, 0x72, 0x0C, 0xAA, 0x4D, 0xE6, 0x7E, 0xB9, 0x04, 0x2F,
-    0xA3, 0x48, 0xE4, 0x91, 0x01, 0x9C, 0x55, 0xCB, 0x71, 0x16, 0x9A, 0x19, 0xD8, 0xB8, 0x1B, 0x97,
-    0x7C, 0x44, 0x4B, 0x60, 0xD0, 0xEF, 0xC9, 0xF4, 0x9F, 0x3C, 0xDB, 0x5B, 0xBC, 0x32, 0xE4, 0x33,
-    0xA8, 0x42, 0x06, 0xEB, 0xE9, 0x5F, 0xB3, 0x8E, 0x62, 0xD1, 0x8D, 0x53, 0x3B, 0xB2, 0xEA, 0x71,
-    0x66, 0x65, 0xDD, 0x14, 0xFB, 0xCC, 0x2D, 0x4F, 0xB8, 0x2E, 0x5C, 0xB6, 0x66, 0xC8, 0x88, 0x7A,
-    0x65, 0x66, 0x7A, 0x9D, 0x10, 0xE8, 0xDB, 0x03, 0x1F, 0xDB, 0xCD, 0xF6, 0xF3, 0x71, 0xBD, 0x26,
-    0x8B, 0x6E, 0x5C, 0x5A, 0xBB, 0x98, 0x79, 0xF4, 0xB4, 0x26, 0xCB, 0xD5, 0x1E, 0x91, 0x42, 0xEC,
-    0xAA, 0x0B, 0xBD, 0x4D, 0xC0, 0xEA, 0x7B, 0x79, 0x8F, 0xB3, 0x5A, 0x83, 0xF8, 0x41, 0xFC, 0x91,
-    0x7E, 0xDF, 0x8E, 0x07, 0xAC, 0x79, 0x0E, 0xBC, 0xEB, 0x56, 0x06, 0xA7, 0x7A, 0x82, 0x69, 0x93,
-    0x32, 0x4E, 0xDD, 0x01, 0x92, 0x4A, 0x68, 0x50, 0x54, 0x5F, 0x0D, 0xDD, 0x9D, 0xBE, 0x74, 0xFF,
-    0x79, 0xDA, 0x0C, 0x9C, 0xBB, 0x91, 0x8B, 0xAB, 0x64, 0x6C, 0x65, 0x82, 0xE1, 0x78, 0x74, 0x48,
-    0x22, 0xA4, 0xE9, 0xC2, 0x8B, 0x72, 0x7C, 0xFF, 0x59, 0x5F, 0xBD, 0xA4, 0x5D, 0x74, 0x34, 0xDB,
-    0x99, 0xBC, 0x0E, 0x46, 0x2F, 0x83, 0x7A, 0x41, 0x5A, 0xEC, 0x05, 0x77, 0xD5, 0xE2, 0xFC, 0x96,
-    0x1A, 0xE7, 0x9D, 0xEE, 0x51, 0x85, 0x30, 0x83, 0x31, 0x00, 0x5F, 0xAC, 0x9B, 0xD5, 0xB5, 0xEB,
-    0xD6, 0xAE, 0x34, 0xFD, 0xDA, 0x8B, 0xD1, 0x3B, 0x81, 0x07, 0x5F, 0x88, 0x15, 0xF8, 0xEB, 0xBF,
-    0xA0, 0xEA, 0x17, 0x0B, 0xF7, 0x80, 0x6E, 0xAC, 0xEB, 0x5E, 0x39, 0x6D, 0xFE, 0x15, 0x20, 0xE3,
-    0xD6, 0x11, 0xE1, 0x66, 0x82, 0xAD, 0x7B, 0x46, 0x16, 0x22, 0xF7, 0x3D, 0x37, 0x29, 0xF6, 0x75,
-    0x1F, 0x39, 0x2D, 0x9A, 0x91, 0x67, 0xAE, 0x5D, 0x6E, 0x74, 0xF7, 0x1A, 0x1B, 0xDF, 0x07, 0x10,
-    0xA6, 0x35, 0x89, 0x33, 0xAF, 0xE9, 0xA9, 0x79, 0xED, 0xD2, 0xB2, 0xAC, 0x29, 0x73, 0xFB, 0x29,
-    0x5A, 0x7B, 0xB8, 0xC4, 0xA7, 0xD2, 0x15, 0xCB, 0xAE, 0x0F, 0x5B, 0xB7, 0x56, 0xD5, 0x68, 0xCB,
-    0x1F, 0xF7, 0x96, 0xB3, 0xEE, 0x4C, 0x02, 0xAA, 0xBF, 0xEF, 0x34, 0xAB, 0xFA, 0x1A, 0x8A, 0x0B,
-    0x59, 0x56, 0xD3, 0xD4, 0x7D, 0xAA, 0xB4, 0x81, 0x26, 0x07, 0xE9, 0x0C, 0xD5, 0x42, 0x4D, 0xB2,
-    0x58, 0x85, 0x21, 0xCB, 0xE4, 0xAA, 0xD0, 0xB8, 0x67, 0xD9, 0x7B, 0x9E, 0xEC, 0x99, 0xAD, 0x93,
-    0x9F, 0xAE, 0xE9, 0x8A, 0x64, 0xA5, 0x28, 0x6C, 0xEA, 0xEE, 0xCB, 0x4D, 0xFB, 0xE5, 0x6B, 0x07,
-    0xD7, 0x83, 0x47, 0xAF, 0x9E, 0xF5, 0x15, 0x4A, 0x2D, 0x2A, 0x94, 0x66, 0x5F, 0xA1, 0x94, 0x38,
-    0x14, 0xDB, 0x68, 0x85, 0xD2, 0x0B, 0xFB, 0x15, 0x4A, 0xCB, 0xFF, 0xCD, 0x0A, 0xA5, 0xD9, 0x2A,
-    0x94, 0x3E, 0x7C, 0xA8, 0x0A, 0x25, 0x54, 0x59, 0x0D, 0x28, 0xD6, 0xC3, 0xDE, 0xEA, 0xD9, 0x4D,
-    0x04, 0x1E, 0xF1, 0x76, 0x21, 0x23, 0x80, 0xF4, 0xBA, 0xFA, 0x2D, 0x86, 0x22, 0x54, 0xC5, 0xCC,
-    0xBE, 0xF0, 0x5E, 0x01, 0x63, 0x6A, 0x95, 0xF8, 0xB3, 0xEF, 0xF3, 0x99, 0x9E, 0xB0, 0x0A, 0xB2,
-    0xC9, 0x09, 0x98, 0x65, 0x4B, 0xA5, 0x0A, 0xA2, 0x5B, 0xAD, 0xF0, 0xD8, 0x6A, 0x01, 0x2B, 0x0B,
-    0xD9, 0xD9, 0xD9, 0x22, 0xDA, 0x75, 0x0F, 0xBD, 0xA5, 0x74, 0x10, 0x2D, 0xCD, 0x27, 0xDC, 0x5C,
-    0x49, 0x89, 0xC6, 0xA0, 0x38, 0xFB, 0xF8, 0xF5, 0x20, 0x7B, 0x4A, 0xEC, 0x94, 0xE8, 0x99, 0xEF,
-    0x88, 0x65, 0x7E, 0x05, 0xC9, 0xEB, 0x89, 0x28, 0x3E, 0x64, 0xF5, 0x1B, 0xCA, 0x4D, 0x65, 0x17,
-    0xFF, 0x83, 0xF8, 0x30, 0x4D, 0x59, 0xC0, 0x67, 0xCF, 0x2B, 0xF9, 0xBF, 0xC8, 0x2B, 0xA2, 0x4B,
-    0x40, 0xF7, 0x7C, 0xB2, 0xDA, 0x7A, 0x99, 0xD7, 0x3F, 0x08, 0xBE, 0x44, 0x6B, 0x96, 0xB2, 0xDB,
-    0x6F, 0xCD, 0x02, 0xE7, 0x26, 0x5A, 0x5B, 0xB3, 0xB0, 0x0D, 0x1F, 0x32, 0xC2, 0x7A, 0x52, 0xDE,
-    0x9F, 0x6E, 0xCD, 0xF2, 0x1E, 0x2A, 0xE9, 0xD9, 0x4C, 0x45, 0xF4, 0x7A, 0x0F, 0x3A, 0x17, 0x02,
-    0x0F, 0x8D, 0xE5, 0xEA, 0xCD, 0xF1, 0x5E, 0x76, 0x8D, 0x21, 0x22, 0xF3, 0x73, 0xE9, 0xF9, 0xB2,
-    0x1F, 0x6F, 0xC4, 0x04, 0x02, 0x53, 0xC5, 0x02, 0x59, 0x9E, 0x1C, 0x04, 0xFE, 0xA0, 0xE8, 0xA5,
-    0x46, 0x06, 0xA5, 0xDA, 0x4C, 0x49, 0x1B, 0xBC, 0x0A, 0x0C, 0xF4, 0x04, 0x62, 0xFE, 0x28, 0x4A,
-    0x2C, 0x8B, 0xED, 0x90, 0x35, 0xF1, 0x94, 0x38, 0x50, 0xEA, 0x9F, 0x5F, 0xE8, 0x70, 0x80, 0x1B,
-    0xCC, 0x6C, 0xEE, 0xA0, 0x5E, 0xEF, 0xEF, 0x5E, 0x9F, 0x95, 0x56, 0xFB, 0xAC, 0x34, 0x7C, 0xCD,
-    0x69, 0xA8, 0x72, 0xDA, 0xF9, 0x6A, 0x1A, 0x52, 0x37, 0x9A, 0x98, 0x25, 0x23, 0x6C, 0xB7, 0x1B,
-    0x75, 0x9D, 0x94, 0xB5, 0x53, 0x81, 0x62, 0x8B, 0x11, 0x33, 0x9E, 0xE9, 0x3B, 0xAD, 0x75, 0x1B,
-    0xC6, 0x88, 0x11, 0xC8, 0xDC, 0xAE, 0xD5, 0x89, 0xBB, 0x40, 0x71, 0x7A, 0xF7, 0x1B, 0x8E, 0x81,
-    0x36, 0xFA, 0x16, 0x45, 0xDE, 0x46, 0x6B, 0x1F, 0x37, 0x02, 0x5C, 0xFA, 0x23, 0x1C, 0x03, 0xF8,
-    0x99, 0xFF, 0x34, 0xBA, 0xD5, 0x58, 0x8F, 0x91, 0x7E, 0xE7, 0x0B, 0x1B, 0x3C, 0xB0, 0x08, 0x53,
-    0x62, 0xEE, 0x60, 0xBF, 0x93, 0xBF, 0xD3, 0x27, 0x98, 0x6E, 0x6D, 0x82, 0x53, 0x31, 0xF8, 0xBD,
-    0xF9, 0x7D, 0x98, 0x18, 0x7C, 0x75, 0x3A, 0x06, 0xCF, 0xF9, 0x3D, 0xDD, 0x27, 0x6F, 0x5E, 0x3D,
-    0x86, 0xDE, 0x53, 0x72, 0xCE, 0x15, 0xE0, 0xDD, 0x86, 0x87, 0xD0, 0x1E, 0x0B, 0xAB, 0xC7, 0x56,
-    0x67, 0xC6, 0x3C, 0x9A, 0x41, 0xCB, 0xDA, 0xD4, 0xA3, 0xE9, 0xC4, 0xA3, 0xA9, 0x5B, 0x74, 0x4C,
-    0x6D, 0x52, 0x71, 0x66, 0x58, 0xB2, 0xA6, 0xEB, 0xAA, 0x46, 0xEB, 0xF2, 0xAF, 0x77, 0x66, 0x36,
-    0xCA, 0xCC, 0x69, 0x6D, 0x0F, 0xF2, 0xC0, 0x30, 0x11, 0xE0, 0xDE, 0x41, 0x71, 0x2E, 0xA9, 0x1E,
-    0x4B, 0x82, 0xAF, 0x7F, 0x2D, 0xF8, 0x96, 0x38, 0x07, 0xDF, 0x0A, 0xC6, 0xFF, 0xB1, 0x1D, 0x7E,
-    0x94, 0xF6, 0x35, 0x7A, 0xAC, 0x74, 0xE9, 0xC7, 0x2D, 0x6A, 0x2E, 0x12, 0x52, 0x16, 0xF0, 0x0F,
-    0x7D, 0xF6, 0x10, 0x81, 0x54, 0xA7, 0x98, 0x57, 0xA6, 0x6E, 0x6E, 0x34, 0x24, 0xEF, 0xE8, 0x2F,
-    0x6D, 0x98, 0x04, 0x42, 0xC8, 0x67, 0xA0, 0x83, 0x9E, 0x73, 0xC9, 0xE9, 0xC2, 0xC7, 0xDA, 0xDE,
-    0x99, 0x2C, 0x9C, 0x9C, 0x9D, 0x08, 0x11, 0xD6, 0xEB, 0x33, 0x25, 0xD8, 0xBF, 0xC6, 0xA8, 0xEB,
-    0x27, 0xEE, 0x99, 0x05, 0xBE, 0xC4, 0x4F, 0x97, 0xFA, 0x8E, 0x78, 0x41, 0x8B, 0x80, 0x13, 0x11,
-    0xB1, 0x6C, 0x74, 0xEE, 0x57, 0x50, 0x19, 0xEF, 0x38, 0xB1, 0xBD, 0xEC, 0xDF, 0x09, 0x14, 0x90,
-    0x89, 0xAF, 0xF9, 0x11, 0x11, 0x8F, 0x73, 0xA4, 0x7A, 0x3D, 0xEF, 0x46, 0xB4, 0x1B, 0x9B, 0x63,
-    0xF7, 0x3A, 0xFB, 0x09, 0xA0, 0xC3, 0x1A, 0x48, 0x73, 0x65, 0x8F, 0x97, 0x05, 0xBD, 0x3F, 0x81,
-    0x16, 0x40, 0xA3, 0xC5, 0x7B, 0x76, 0x62, 0xE4, 0x39, 0x99, 0x1E, 0x67, 0x7A, 0x86, 0x65, 0x62,
-    0xE6, 0xD7, 0xC8, 0x35, 0xD6, 0x00, 0xC6, 0xD4, 0xDC, 0x7D, 0x67, 0x61, 0xC1, 0xD0, 0x37, 0x08,
-    0x9C, 0xC3, 0x81, 0x5D, 0x52, 0x2B, 0x19, 0x62, 0x39, 0xC6, 0xE8, 0x2C, 0xD6, 0x30, 0xD2, 0x90,
-    0x43, 0x90, 0xDF, 0x14, 0x70, 0x7C, 0x32, 0x2F, 0x73, 0x90, 0xDF, 0x72, 0x77, 0x9A, 0xED, 0xAF,
-    0xDC, 0x27, 0xE2, 0xB3, 0xA4, 0x4B, 0x59, 0x89, 0xC9, 0x7A, 0x73, 0x0C, 0x5C, 0x3A, 0x8A, 0x58,
-    0x75, 0x2E, 0xED, 0xB7, 0x73, 0xF2, 0xB6, 0xA3, 0x13, 0xDF, 0x9D, 0xEE, 0x0F, 0x12, 0xB8, 0xB5,
-    0xFE, 0x4B, 0xE3, 0x14, 0xDA, 0x0B, 0xA8, 0x0B, 0xB4, 0x1E, 0x0B, 0xA5, 0x58, 0x23, 0x0A, 0x1D,
-    0xD6, 0xAE, 0x24, 0x05, 0x1B, 0x66, 0xA0, 0x3A, 0x8B, 0x8D, 0x6A, 0x6A, 0x70, 0x4F, 0xD8, 0x00,
-    0xC3, 0xBA, 0x94, 0x74, 0x5A, 0x62, 0x15, 0x08, 0x28, 0x79, 0x74, 0x0F, 0x1B, 0x1A, 0x30, 0xF4,
-    0xA8, 0xD0, 0x70, 0xD0, 0xE7, 0xE2, 0x41, 0xA5, 0x3A, 0x59, 0xE4, 0xD2, 0x4F, 0x5F, 0xEC, 0xE3,
-    0xEC, 0xDA, 0x14, 0x56, 0x37, 0x70, 0xB8, 0x18, 0x01, 0xD0, 0x58, 0x34, 0xDF, 0xD7, 0xAC, 0xD2,
-    0xEB, 0x6A, 0x54, 0x5B, 0x1D, 0x00, 0xFB, 0x5B, 0x22, 0xD1, 0xCB, 0x0C, 0xF5, 0xB8, 0xB1, 0xB2,
-    0x03, 0x76, 0x74, 0x66, 0x93, 0x4B, 0xEF, 0x09, 0x59, 0xDA, 0x3A, 0x74, 0xBB, 0x66, 0x42, 0x93,
-    0xA5, 0x93, 0x0A, 0xA4, 0xAA, 0xD8, 0xC1, 0x61, 0xA4, 0xB5, 0xD6, 0x76, 0x97, 0x81, 0x32, 0xF5,
-    0x1A, 0x2D, 0x54, 0xB8, 0x84, 0xE5, 0x0B, 0x67, 0x1F, 0x35, 0x4A, 0x9C, 0xB1, 0xA1, 0x5B, 0x4B,
-    0xD2, 0x7F, 0x26, 0x81, 0xB8, 0xBC, 0x1A, 0xF8, 0x8C, 0xB5, 0xBE, 0x09, 0x9D, 0x05, 0xE0, 0xBE,
-    0x62, 0xE0, 0x6C, 0x84, 0x19, 0x92, 0x38, 0xCC, 0xF6, 0x02, 0x88, 0x02, 0xA4, 0x2D, 0x37, 0x51,
-    0x0B, 0xF5, 0x23, 0x4B, 0xCB, 0x1E, 0x03, 0x41, 0xFA, 0xDE, 0xB3, 0x4C, 0x93, 0x6A, 0x48, 0xD2,
-    0x1F, 0x0B, 0xC3, 0x25, 0x81, 0xAF, 0x3D, 0xDA, 0x5C, 0x3F, 0xB8, 0x46, 0x41, 0xA3, 0xCF, 0x52,
-    0xBE, 0xAE, 0x5C, 0x08, 0x6E, 0xFA, 0x74, 0x22, 0xB1, 0x4C, 0x23, 0x8C, 0x0F, 0x6E, 0xE2, 0xEF,
-    0xF6, 0x57, 0xC6, 0xF5, 0x7B, 0x0B, 0x53, 0x5A, 0x00, 0x5E, 0xD9, 0x12, 0x77, 0xC6, 0xDD, 0xB2,
-    0x24, 0x23, 0xD7, 0x41, 0x57, 0x25, 0x9A, 0xE3, 0x69, 0x5D, 0x14, 0xB9, 0x1C, 0xF0, 0x84, 0xAD,
-    0x89, 0xD8, 0x9D, 0x65, 0x5D, 0x92, 0x7C, 0x8D, 0xD1, 0x5B, 0xC0, 0xDE, 0xF9, 0x05, 0x49, 0xD4,
-    0x8F, 0xD5, 0xF5, 0x50, 0xC8, 0x53, 0xE9, 0x72, 0x90, 0x47, 0x58, 0xD2, 0x16, 0x5E, 0x02, 0xC5,
-    0x2E, 0x47, 0xCD, 0xFF, 0x46, 0xE0, 0x9F, 0x4C, 0xC5, 0x02, 0xDB, 0x93, 0x0F, 0xE5, 0xC0, 0x8E,
-    0xBD, 0xE8, 0x62, 0x9C, 0xB8, 0xCF, 0x14, 0xC0, 0xF4, 0xF6, 0xBA, 0x20, 0xA4, 0xE2, 0x6C, 0xDD,
-    0x2D, 0x30, 0x61, 0x3A, 0x0C, 0x9D, 0xEB, 0x11, 0xB3, 0x34, 0x39, 0x2F, 0x36, 0xEC, 0xD5, 0xCC,
-    0x92, 0x6A, 0x86, 0xCB, 0xB8, 0xAB, 0xD8, 0xD0, 0x29, 0x3A, 0xFE, 0x06, 0x28, 0x2A, 0xBE, 0xE4,
-    0x67, 0xB1, 0xAE, 0x5D, 0xDE, 0xA1, 0x5B, 0xD3, 0x22, 0x87, 0x47, 0x47, 0x6A, 0xD1, 0x37, 0xDE,
-    0x3D, 0x57, 0x84, 0xDB, 0x9F, 0xEE, 0x2B, 0x29, 0xEE, 0xB7, 0x77, 0xF3, 0x3D, 0xC0, 0x0F, 0xD7,
-    0x9F, 0xA2, 0xD9, 0xFB, 0x59, 0xE9, 0x87, 0xDE, 0x38, 0xE5, 0x3F, 0x71, 0xEF, 0x6A, 0x0C, 0x15,
-    0xA9, 0x7C, 0x6B, 0x5D, 0x69, 0x2D, 0xDA, 0xC5, 0x62, 0x84, 0x06, 0xA7, 0x51, 0x7E, 0x6C, 0xB9,
-    0xD5, 0xDE, 0xF7, 0x15, 0x65, 0xDF, 0x8E, 0x60, 0x3F, 0x40, 0xA0, 0x0D, 0x76, 0x76, 0xAE, 0x0C,
-    0x88, 0x6C, 0xDA, 0x13, 0xD4, 0x83, 0x46, 0x67, 0x6D, 0x36, 0xDE, 0x3D, 0xAC, 0xAD, 0x49, 0xB4,
-    0xE6, 0xF7, 0x1A, 0xAA, 0x39, 0xFD, 0x6B, 0x39, 0x06, 0x9B, 0xF5, 0x81, 0x3E, 0x95, 0x4D, 0x13,
-    0x98, 0x7B, 0xA5, 0xE5, 0x7C, 0xDF, 0xF2, 0x0B, 0x0F, 0x1F, 0x54, 0xE0, 0xF4, 0x20, 0xF6, 0x73,
-    0x41, 0xA9, 0x41, 0xC2, 0x4E, 0x1B, 0x77, 0x6F, 0xB1, 0xD9, 0x06, 0xDB, 0xD0, 0x0E, 0xCA, 0x38,
-    0x49, 0xED, 0xB3, 0x1D, 0x90, 0xDC, 0x3D, 0x79, 0xB1, 0xD8, 0xF6, 0x66, 0xBF, 0x1A, 0x6D, 0xC5,
-    0x85, 0xF6, 0x1B, 0x43, 0xF0, 0x35, 0x4B, 0x96, 0x0D, 0x5B, 0x1B, 0xAE, 0x26, 0xCD, 0xAC, 0x63,
-    0xBE, 0xAC, 0x75, 0xBC, 0x08, 0x4E, 0x79, 0xDF, 0x97, 0x1D, 0x5D, 0x64, 0x74, 0x36, 0x52, 0x12,
-    0xAA, 0xD1, 0x8A, 0x3D, 0xC0, 0x52, 0x9D, 0xA3, 0xFA, 0xFB, 0xCC, 0x43, 0x7D, 0xEE, 0x85, 0xD1,
-    0x1B, 0xED, 0x93, 0x2F, 0x7C, 0x83, 0x16, 0x4B, 0x2E, 0x59, 0xF3, 0x1F, 0x53, 0x7B, 0x96, 0x38,
-    0xD5, 0xBE, 0x64, 0xF6, 0x01, 0x18, 0xF6, 0x09, 0x18, 0x46, 0x9B, 0x30, 0x1A, 0xAC, 0x45, 0x7E,
-    0xAC, 0x56, 0x53, 0xDB, 0xA2, 0xFA, 0x62, 0x4D, 0xFD, 0x20, 0x0C, 0xE3, 0x74, 0x5B, 0xBA, 0xDE,
-    0xA7, 0x5F, 0xF7, 0xB2, 0xB0, 0x4D, 0xB0, 0xFB, 0x38, 0x8C, 0x4F, 0xB7, 0x75, 0x8E, 0x3D, 0x99,
-    0xA7, 0x39, 0xDD, 0x0C, 0xF3, 0x61, 0xBE, 0x58, 0x37, 0xB7, 0xF1, 0x1C, 0x21, 0x70, 0x0C, 0xD1,
-    0x27, 0x43, 0x2B, 0xE7, 0xD8, 0x29, 0x23, 0xD0, 0xD2, 0xB9, 0xED, 0xFA, 0xC9, 0x15, 0xB0, 0xF6,
-    0x88, 0x82, 0x58, 0xCE, 0x69, 0x08, 0xD6, 0xEA, 0x39, 0xAD, 0x57, 0x8F, 0xD6, 0xAE, 0x7D, 0x95,
-    0x9F, 0x88, 0xBD, 0x8E, 0xA3, 0x68, 0x38, 0x56, 0x05, 0xDA, 0xA8, 0xD7, 0x32, 0xCB, 0x6E, 0xED,
-    0x08, 0xCB, 0x42, 0x42, 0xD7, 0xCB, 0xAD, 0x2F, 0xB8, 0x7E, 0xB3, 0x76, 0x68, 0xF3, 0x19, 0x36,
-    0x86, 0x94, 0x7A, 0xCD, 0x5E, 0x6A, 0x30, 0x49, 0x5B, 0x04, 0xAA, 0xDA, 0xC9, 0xDE, 0xC5, 0x30,
-    0x44, 0xE5, 0xE6, 0xDA, 0x81, 0x08, 0x99, 0x9F, 0xDA, 0x7A, 0xCA, 0x04, 0xC6, 0x39, 0x0A, 0x2E,
-    0xEC, 0x75, 0x72, 0x39, 0xF8, 0x6F, 0x57, 0x11, 0x9C, 0x1A, 0x34, 0xA6, 0xE8, 0x2B, 0x7C, 0xBB,
-    0xB4, 0xB8, 0xA0, 0xC1, 0x7C, 0xCD, 0xB1, 0x9D, 0xF9, 0xD3, 0x9A, 0xAD, 0x74, 0x39, 0x01, 0xAC,
-    0x29, 0xCA, 0xDD, 0x7F, 0x75, 0xC1, 0x2B, 0xA2, 0x5E, 0x36, 0x33, 0x93, 0xEC, 0xDA, 0xDD, 0xCE,
-    0x6A, 0x24, 0xBD, 0xA9, 0xF8, 0x2E, 0xB1, 0xF6, 0x93, 0xCC, 0x04, 0x3D, 0x35, 0x79, 0xD5, 0x1D,
-    0x39, 0xA8, 0xE4, 0x83, 0xA3, 0xF3, 0xD7, 0x3F, 0xA7, 0x14, 0xE5, 0x77, 0x66, 0x82, 0x82, 0xCB,
-    0xEF, 0x07, 0x3A, 0x43, 0xA1, 0x1F, 0x47, 0xAF, 0x4A, 0xD2, 0xE6, 0x48, 0x6F, 0x0C, 0x84, 0x79,
-    0x78, 0x73, 0xD1, 0xA6, 0x05, 0xB9, 0xDF, 0xB1, 0xA2, 0xF2, 0x4F, 0xC4, 0x87, 0x78, 0x85, 0x79,
-    0x8A, 0x36, 0x1B, 0x2C, 0xAA, 0xC8, 0xA4, 0x13, 0x67, 0x2A, 0x6F, 0x98, 0xA0, 0x42, 0xA5, 0xD6,
-    0xC8, 0x42, 0x7F, 0xD6, 0xB1, 0x3F, 0x23, 0x33, 0x76, 0xF4, 0xFC, 0x91, 0xAD, 0xD0, 0xB5, 0xF3,
-    0x95, 0x2F, 0x2E, 0x4A, 0x56, 0x75, 0x1A, 0x7B, 0xA6, 0xB8, 0x36, 0xDC, 0x0B, 0xB4, 0xCC, 0xC2,
-    0x4E, 0x64, 0x9A, 0xF2, 0x37, 0xF8, 0xC5, 0x16, 0xBD, 0x03, 0x1D, 0x0B, 0xC4, 0xB2, 0x94, 0xC1,
-    0x98, 0xCE, 0x5B, 0x34, 0xB1, 0x25, 0xC4, 0x16, 0x24, 0xFB, 0xA4, 0x92, 0x39, 0x04, 0x46, 0xBF,
-    0xAE, 0x59, 0xCB, 0x39, 0x73, 0x3F, 0xB3, 0x26, 0x82, 0x7F, 0xE9, 0x3E, 0xB4, 0x8E, 0xFD, 0x1F,
-    0xBB, 0xC9, 0x3E, 0x9B, 0x01, 0xB1, 0x8F, 0x7E, 0x55, 0xDC, 0xFD, 0x4A, 0x2B, 0xE9, 0x57, 0xCD,
-    0xDD, 0xAF, 0x7A, 0x7D, 0x58, 0x59, 0x27, 0xBB, 0xC8, 0xD1, 0xB4, 0x63, 0x69, 0x54, 0x9E, 0x5B,
-    0x6B, 0xE4, 0xDA, 0xDA, 0x79, 0x72, 0xAD, 0xDB, 0x8B, 0xBA, 0x94, 0xB3, 0x0F, 0x97, 0xA6, 0x4B,
-    0x6E, 0xBA, 0x22, 0x96, 0x61, 0x13, 0x15, 0xE1, 0x41, 0x6A, 0xFA, 0x6E, 0x0B, 0x88, 0x0F, 0x68,
-    0x02, 0x85, 0xA2, 0xC9, 0x21, 0xDC, 0xB5, 0xD1, 0x3E, 0x7F, 0xF5, 0xB2, 0x49, 0x45, 0xDE, 0x7A,
-    0xEA, 0x74, 0xF9, 0x9A, 0xB7, 0xCB, 0x06, 0xE3, 0x70, 0xCF, 0x37, 0x9C, 0x5F, 0xA4, 0x37, 0xDD,
-    0x97, 0x9B, 0xF7, 0x7A, 0x40, 0x67, 0x13, 0x7C, 0x0A, 0x8B, 0xF5, 0xD8, 0x11, 0x44, 0xA0, 0x3D,
-    0x76, 0xBE, 0xCB, 0x8F, 0x24, 0xD2, 0x1E, 0x3B, 0x85, 0xEF, 0xB1, 0x63, 0x19, 0xD7, 0xED, 0xCC,
-    0xAC, 0xA4, 0x46, 0xB0, 0xD8, 0x7A, 0x6D, 0x41, 0x04, 0xCB, 0xEA, 0x75, 0x2C, 0xC1, 0xF8, 0xF9,
-    0x11, 0xAC, 0xCD, 0x3A, 0x83, 0xF1, 0x9E, 0x55, 0x7F, 0x40, 0x04, 0xEB, 0xF8, 0x0B, 0xF6, 0xD8,
-    0x51, 0x28, 0xB7, 0x71, 0xFA, 0xD1, 0x3B, 0xC0, 0x43, 0x0B, 0x6A, 0xB2, 0xC5, 0xCB, 0x29, 0x82,
-    0xB3, 0xD7, 0xD9, 0xEE, 0xE6, 0xA1, 0xBE, 0xCE, 0x3B, 0xE5, 0x66, 0x54, 0x4A, 0x0A, 0x0E, 0x92,
-    0x0F, 0x6E, 0xF5, 0x6B, 0xBA, 0x32, 0xE9, 0x3D, 0xFA, 0x23, 0x83, 0xBE, 0x56, 0xC6, 0x2B, 0xD9,
-    0xAF, 0xD8, 0xD8, 0x67, 0x6E, 0xCE, 0x3B, 0xBA, 0x80, 0x5B, 0x8D, 0x19, 0x72, 0xDA, 0xB7, 0x0F,
-    0xB4, 0x1D, 0xC5, 0x64, 0xAA, 0x3B, 0xB7, 0xA6, 0xEF, 0xF8, 0xA4, 0x93, 0xFD, 0xB6, 0x5F, 0x47,
-    0xA8, 0x86, 0x70, 0x6C, 0x9D, 0x8F, 0xF6, 0x38, 0x0B, 0x5A, 0x76, 0x2C, 0xD9, 0x28, 0x96, 0x2C,
-    0x1F, 0x56, 0x26, 0xA8, 0xE5, 0xD1, 0xA8, 0x57, 0xAE, 0x26, 0x85, 0xE6, 0x36, 0x95, 0xE6, 0xFC,
-    0xE8, 0xE2, 0x49, 0x0D, 0x5A, 0x84, 0x43, 0x61, 0x96, 0xC3, 0xEF, 0x87, 0x93, 0x31, 0x7A, 0x29,
-    0xA1, 0x8C, 0xDD, 0x5D, 0xD8, 0x15, 0xBB, 0x80, 0xD5, 0x1F, 0x5A, 0x66, 0x6F, 0x0A, 0xCE, 0x1F,
-    0xD5, 0xD6, 0x6F, 0x97, 0xDE, 0x5A, 0x4C, 0xFE, 0x6B, 0x6F, 0xD5, 0x31, 0xF5, 0x62, 0x45, 0x78,
-    0x67, 0xEB, 0x35, 0x81, 0x94, 0x5A, 0x4D, 0xD9, 0x57, 0x45, 0x96, 0xE2, 0xAE, 0x64, 0x10, 0xA2,
-    0x4A, 0xAC, 0xEF, 0x6A, 0xAB, 0xF1, 0xC2, 0x83, 0x05, 0x02, 0xF0, 0xC8, 0xD1, 0x91, 0xB5, 0x0D,
-    0xD3, 0x1A, 0xFB, 0xD9, 0xBC, 0x31, 0xDC, 0x27, 0x53, 0x6F, 0x42, 0xCB, 0x10, 0xB4, 0xE4, 0xA8,
-    0xF3, 0xC6, 0xD3, 0x3E, 0x3E, 0x04, 0x41, 0x80, 0xAF, 0x20, 0x86, 0xD8, 0xE7, 0x4C, 0x9D, 0x63,
-    0x47, 0xA2, 0xFF, 0xDA, 0xC4, 0xFD, 0xF5, 0xA9, 0x4E, 0x62, 0xB2, 0x24, 0x97, 0x6B, 0x23, 0xA2,
-    0xAD, 0x5A, 0x5F, 0xBD, 0x82, 0xA0, 0xF8, 0x2C, 0x58, 0xFF, 0xBB, 0xDD, 0xAE, 0x1B, 0x94, 0x9E,
-    0xE0, 0xB2, 0x5B, 0x0D, 0x0B, 0xB3, 0x4E, 0xF2, 0x7C, 0x47, 0x9F, 0x2F, 0xE1, 0x2C, 0x1F, 0x0D,
-    0xD8, 0x4B, 0x4A, 0xEB, 0x47, 0xB5, 0x99, 0x14, 0x0B, 0x48, 0xB5, 0x9B, 0x94, 0x56, 0x90, 0xB2,
-    0x9D, 0x94, 0x96, 0x90, 0x6A, 0x3F, 0x29, 0xD6, 0x90, 0x06, 0x6C, 0x28, 0xA5, 0x45, 0xA4, 0xEC,
-    0x28, 0x15, 0xB0, 0x8A, 0x54, 0x5B, 0x4A, 0xB1, 0x8C, 0x34, 0xF0, 0x3D, 0xA5, 0x82, 0xCB, 0x64,
-    0x84, 0xA9, 0x63, 0x65, 0xD6, 0x24, 0xEF, 0x19, 0x2A, 0xE1, 0x86, 0x3C, 0xE5, 0x57, 0xFD, 0x13,
-    0xE8, 0x27, 0x7E, 0xF6, 0xEA, 0xA3, 0x45, 0x80, 0x7A, 0xF3, 0x60, 0x3B, 0x93, 0x84, 0xFC, 0xD4,
-    0x6C, 0x9A, 0xF8, 0xFE, 0xAA, 0x73, 0x1F, 0xB8, 0xE8, 0xF1, 0x81, 0x3B, 0xA3, 0x78, 0xC0, 0x72,
-    0x1B, 0x08, 0x09, 0xD3, 0x76, 0x0D, 0xBA, 0x35, 0x76, 0xF1, 0x90, 0xA1, 0xAB, 0x44, 0x7A, 0x6F,
-    0x62, 0x6C, 0x22, 0x28, 0x7F, 0x38, 0x96, 0x55, 0x76, 0x67, 0x42, 0x41, 0xEE, 0x94, 0x88, 0x1D,
-    0x9C, 0xA2, 0x29, 0xC4, 0x27, 0x93, 0x81, 0x46, 0xC1, 0xEE, 0x7B, 0x25, 0x74, 0x74, 0xD6, 0x1F,
-    0x1C, 0xA1, 0x79, 0xE7, 0xCE, 0x66, 0x9B, 0xC1, 0xF6, 0xD6, 0xDA, 0x2C, 0x43, 0xF9, 0x33, 0x6B,
-    0x40, 0xE1, 0x3E, 0x3B, 0xC1, 0x71, 0xB0, 0x66, 0x60, 0x9A, 0xC0, 0xEF, 0x08, 0xF3, 0x51, 0x64,
-    0x6B, 0x6F, 0xB0, 0x5B, 0xEA, 0x91, 0xA1, 0x47, 0x44, 0xE3, 0xCD, 0xD5, 0x07, 0x61, 0x72, 0xE2,
-    0x67, 0x28, 0xA9, 0x29, 0xA8, 0x62, 0x2D, 0x7B, 0x23, 0x97, 0x07, 0x75, 0xBC, 0x8D, 0xB2, 0x50,
-    0x48, 0x82, 0x66, 0x0D, 0xD4, 0x46, 0x60, 0xCA, 0x64, 0xE7, 0x58, 0xDF, 0xEA, 0x86, 0x21, 0x21,
-    0x38, 0xA6, 0x25, 0x02, 0x93, 0xEF, 0x3D, 0xE2, 0xDB, 0x93, 0xFA, 0xCF, 0x65, 0x6B, 0x3C, 0xB3,
-    0x35, 0x76, 0x6B, 0xEB, 0x42, 0x23, 0x35, 0x59, 0xEB, 0xDE, 0x93, 0xD3, 0x01, 0x03, 0xA0, 0x40,
-    0xA2, 0x14, 0x20, 0xC1, 0xD0, 0x3D, 0x3D, 0x2B, 0x0E, 0xFC, 0x7C, 0x00, 0x68, 0x24, 0xB6, 0xDF,
-    0x6A, 0x53, 0x2C, 0x4F, 0x70, 0xD2, 0x2C, 0x55, 0xE9, 0x7B, 0x43, 0x93, 0x89, 0xAD, 0x0D, 0x2A,
-    0x67, 0x14, 0x7F, 0xE4, 0x8B, 0x86, 0x7E, 0x2B, 0x6D, 0x4F, 0x88, 0x59, 0xC7, 0x34, 0xD7, 0xDA,
-    0x0B, 0xC7, 0x7F, 0xDE, 0x44, 0xAC, 0xE1, 0xDD, 0xFA, 0xE4, 0xE8, 0xAF, 0xD8, 0xA2, 0x11, 0xEB,
-    0x43, 0x58, 0x2D, 0xDB, 0xF8, 0xA4, 0xB6, 0x88, 0xAF, 0x7E, 0x76, 0x18, 0xD9, 0xFB, 0x7B, 0xAC,
-    0xBE, 0x64, 0x4D, 0x9A, 0xB3, 0xB5, 0xB7, 0x6A, 0xC7, 0x87, 0x7C, 0x74, 0x5F, 0x5A, 0x2C, 0x72,
-    0xFB, 0x41, 0x7D, 0xDF, 0xA3, 0x17, 0x9F, 0xF7, 0xE8, 0x8F, 0x16, 0x37, 0x68, 0x17, 0xB4, 0xD0,
-    0xF8, 0x49, 0x86, 0x9B, 0x86, 0xB2, 0x5D, 0xE3, 0x2B, 0x0F, 0xDA, 0x37, 0x66, 0xDA, 0x0E, 0x83,
-    0x35, 0x9C, 0xAF, 0xB5, 0x8E, 0xD6, 0x9D, 0x4B, 0xE5, 0x33, 0x75, 0x6D, 0x39, 0x33, 0xE6, 0x0F,
-    0x25, 0x46, 0x21, 0x45, 0x7C, 0x1A, 0xEC, 0x50, 0xB0, 0xFA, 0x0D, 0x47, 0x44, 0x1A, 0xF9, 0x26,
-    0x54, 0x6B, 0xC5, 0x97, 0xBA, 0x51, 0x4E, 0x1A, 0x5A, 0xAD, 0xD8, 0xE4, 0x12, 0xAE, 0xC8, 0x4D,
-    0xEF, 0xEE, 0xB6, 0x3C, 0x4D, 0x1D, 0x2F, 0xB7, 0xBA, 0x84, 0x2A, 0x75, 0xC6, 0x9B, 0xF2, 0xD6,
-    0xF9, 0xF2, 0xE3, 0x37, 0xF4, 0x69, 0x36, 0x3B, 0xEB, 0x8C, 0xE7, 0x89, 0xDD, 0x03, 0xCA, 0xF6,
-    0x7F, 0xDB, 0x53, 0xAC, 0xA1, 0x82, 0xC8, 0xFF, 0x12, 0x8F, 0x2B, 0xCD, 0x78, 0x87, 0x20, 0xB9,
-    0x1F, 0x7C, 0xEF, 0xDA, 0xB5, 0x71, 0xC5, 0xE5, 0xFF, 0x72, 0xF4, 0x9B, 0x48, 0x41, 0x6B, 0x9B,
-    0xD7, 0x7D, 0x5A, 0xD9, 0xFA, 0x31, 0x78, 0x06, 0x27, 0xD6, 0x8C, 0x70, 0xE1, 0x1B, 0xA6, 0xB3,
-    0xF4, 0x3A, 0xF0, 0x8D, 0xB6, 0x4C, 0x45, 0x65, 0x9D, 0xFF, 0xCC, 0xB6, 0xBD, 0x46, 0xB0, 0xFB,
-    0x8C, 0xD3, 0xE4, 0xD4, 0x67, 0x85, 0xD8, 0xC3, 0x85, 0x6B, 0x6A, 0x3A, 0x38, 0x73, 0x78, 0x58,
-    0xEE, 0xBA, 0x72, 0xF8, 0x4F, 0x2D, 0x5B, 0xFB, 0xF5, 0x6A, 0xAB, 0xD8, 0x15, 0x83, 0xEA, 0xFB,
-    0xB7, 0x6E, 0x45, 0xF4, 0xBB, 0xD8, 0xD2, 0x4A, 0x13, 0xDC, 0xA3, 0x82, 0x04, 0x9E, 0x9E, 0x60,
-    0xBE, 0xC1, 0x83, 0x3E, 0xD3, 0x29, 0x7C, 0xE9, 0xEC, 0xD5, 0xA0, 0x7E, 0x1E, 0x51, 0x60, 0x98,
-    0xC8, 0xA7, 0x67, 0x9A, 0x3B, 0x75, 0x45, 0xD7, 0xA2, 0xB8, 0xA5, 0xD0, 0x80, 0xC9, 0xF2, 0xF8,
-    0x12, 0xFC, 0x33, 0x25, 0x2B, 0xF1, 0x93, 0xD0, 0x46, 0xE5, 0x86, 0x3A, 0x7E, 0xB8, 0x82, 0xB3,
-    0xEA, 0x7F, 0x31, 0x71, 0x15, 0xD2, 0x14, 0x37, 0x19, 0xA4, 0x99, 0xB5, 0x94, 0xE7, 0x0F, 0xF7,
-    0xA0, 0xCD, 0xE1, 0xD1, 0xCB, 0x3E, 0xBC, 0x9A, 0x7B, 0xF6, 0xAE, 0x4C, 0xE9, 0xDA, 0xA0, 0xF5,
-    0xE1, 0xBE, 0x7E, 0x67, 0x7B, 0xAF, 0x6F, 0xBE, 0x51, 0xF9, 0x96, 0xB7, 0x56, 0x44, 0xAE, 0xA1,
-    0xC3, 0x83, 0xA3, 0xBF, 0x39, 0xFC, 0x32, 0x42, 0xAB, 0x4D, 0xF0, 0x02, 0xF2, 0xF9, 0x7D, 0x13,
-    0x8A, 0xBA, 0xDD, 0xB2, 0x34, 0x8B, 0x94, 0xBC, 0xBC, 0x4F, 0x86, 0xB5, 0x07, 0x45, 0x36, 0xE2,
-    0x25, 0x6B, 0x84, 0x67, 0xE9, 0x44, 0x67, 0x75, 0xB3, 0x5A, 0x25, 0xBC, 0x4F, 0x17, 0xCD, 0xF7,
-    0x9B, 0x05, 0xEA, 0x6E, 0x54, 0x09, 0xE4, 0x33, 0x6F, 0x7C, 0x1F, 0x8D, 0x69, 0xED, 0x0B, 0x67,
-    0x4F, 0x1D, 0xDD, 0x17, 0x64, 0xA6, 0x34, 0x59, 0xC3, 0x26, 0x08, 0x14, 0x7D, 0xF8, 0xC6, 0x43,
-    0xA8, 0xF2, 0xA3, 0xCF, 0x52, 0x9D, 0xF7, 0xE3, 0x90, 0xD1, 0x3E, 0x84, 0x21, 0x5E, 0x3F, 0x55,
-    0x6C, 0xF1, 0x9F, 0x2A, 0xA6, 0xFD, 0xFE, 0xAA, 0xF5, 0x53, 0xC5, 0xDE, 0xD8, 0x5B, 0xDB, 0x3B,
-    0xF7, 0x7F, 0xAA, 0x58, 0xFE, 0x9B, 0xFC, 0x54, 0x31, 0xB1, 0x0D, 0xD5, 0x0D, 0x3A, 0xB7, 0x8B,
-    0x8F, 0x2F, 0x28, 0x9E, 0xD2, 0xC0, 0xC4, 0xF6, 0xD4, 0x9E, 0x79, 0xC8, 0xE5, 0xFC, 0xDD, 0xEB,
-    0x69, 0xB8, 0x8E, 0x8E, 0xAD, 0x77, 0x3B, 0x50, 0x1F, 0x8C, 0xD2, 0x6C, 0xE4, 0xE6, 0x74, 0xDE,
-    0x7D, 0x78, 0xD5, 0x17, 0xD8, 0xA9, 0xB6, 0x55, 0x6D, 0xAF, 0xDA, 0x66, 0xB5, 0xDD, 0x6A, 0xDB,
-    0xD5, 0xF6, 0xAB, 0xDF, 0xB0, 0xB6, 0xAA, 0xB6, 0x65, 0x7D, 0xCC, 0xBC, 0xF6, 0x6D, 0x19, 0xCC,
-    0xF9, 0x0E, 0x76, 0x4F, 0xEF, 0x5B, 0xD0, 0xD8, 0x87, 0xF4, 0x99, 0xD5, 0xD0, 0xF3, 0x2F, 0x78,
-    0x2A, 0xF0, 0x9E, 0xD6, 0xD7, 0x35, 0xB6, 0x69, 0xD8, 0xDB, 0xC1, 0xF6, 0xE9, 0x56, 0x46, 0xBD,
-    0x32, 0x62, 0x15, 0x10, 0x22, 0x37, 0x08, 0x52, 0x96, 0xE3, 0x97, 0xB5, 0x40, 0x65, 0xAB, 0xC1,
-    0x51, 0xDD, 0xCD, 0x56, 0x12, 0x1E, 0x98, 0x08, 0x68, 0x32, 0x45, 0x1F, 0x41, 0x43, 0xA8, 0xAE,
-    0xAD, 0x35, 0xF8, 0xFF, 0x3D, 0x23, 0x81, 0xDB, 0x1E, 0xB5, 0x78, 0x7E, 0x6E, 0xF1, 0x9F, 0xDA,
-    0x47, 0x29, 0xA6, 0x60, 0x6F, 0x73, 0xAF, 0xB9, 0x4B, 0xEF, 0x83, 0xDB, 0xA6, 0x35, 0x1B, 0x63,
-    0x90, 0x3A, 0xB5, 0x6B, 0xD5, 0x6B, 0xF4, 0xA9, 0xD0, 0xF7, 0xEA, 0x2C, 0x7E, 0x4A, 0x4A, 0xD4,
-    0x70, 0x3C, 0x31, 0x73, 0x9F, 0x13, 0x50, 0x60, 0x93, 0xAF, 0x78, 0xE2, 0x2B, 0xEA, 0xBE, 0x27,
-    0x6D, 0x5E, 0xA1, 0x8B, 0xA0, 0xEC, 0x5B, 0x50, 0xA4, 0x13, 0x81, 0x2C, 0x05, 0x10, 0x44, 0x56,
-    0x04, 0x0E, 0x9F, 0xDB, 0xD6, 0x7D, 0x07, 0xC9, 0x24, 0xD0, 0x3D, 0x6B, 0xB1, 0xB4, 0x8C, 0xA8,
-    0x97, 0x16, 0xDD, 0x97, 0x5B, 0xFF, 0x5D, 0x1F, 0x9C, 0xB9, 0xC8, 0x8E, 0x29, 0x6D, 0xB0, 0x7E,
-    0x06, 0xA7, 0x99, 0x9D, 0x62, 0xD7, 0x4A, 0xAB, 0x15, 0xCF, 0xE8, 0xE9, 0x19, 0x30, 0xC1, 0x83,
-    0xB3, 0x6B, 0x61, 0x15, 0x35, 0x69, 0xF0, 0xB5, 0xE0, 0xE5, 0xA0, 0xDF, 0x76, 0xF2, 0x63, 0xF1,
-    0x47, 0xF8, 0x31, 0xEA, 0xB7, 0x68, 0xC1, 0xC8, 0xF2, 0x0F, 0x81, 0xA0, 0xBF, 0x6C, 0x94, 0x78,
-    0x37, 0x6A, 0x47, 0xC1, 0xEC, 0xE1, 0x1B, 0x18, 0x98, 0x7D, 0xFF, 0x62, 0x9F, 0x09, 0xF7, 0x19,
-    0x0D, 0x0C, 0x54, 0xE2, 0x35, 0x6C, 0xD4, 0xEF, 0x98, 0xE6, 0xD3, 0x8E, 0x6D, 0x7E, 0x5E, 0x77,
-    0xDB, 0xE5, 0xA3, 0xEB, 0x6B, 0x5B, 0x83, 0x49, 0xE7, 0x03, 0x53, 0x01, 0x5E, 0x31, 0xCE, 0x43,
-    0x1A, 0x9F, 0x45, 0x1E, 0x9D, 0x66, 0x84, 0x73, 0x6B, 0x6B, 0x00, 0xB7, 0x86, 0x1F, 0xB7, 0xD3,
-    0x68, 0xBF, 0xC7, 0x03, 0xDB, 0xBB, 0x97, 0xAD, 0xF6, 0xC9, 0xD9, 0x67, 0x73, 0x9A, 0x33, 0x66,
-    0x30, 0xD7, 0xFB, 0xBB, 0x82, 0x51, 0xBF, 0xB4, 0xB4, 0xFF, 0x7F, 0xF9, 0x61, 0x04, 0xD1, 0x98,
-    0xDE, 0xEF, 0x21, 0x84, 0x2E, 0xD9, 0xC5, 0x0B, 0x1E, 0xC6, 0x8D, 0xE3, 0xD7, 0xEF, 0x17, 0x7B,
-    0xF5, 0xA1, 0x72, 0x4D, 0x6D, 0xA6, 0xB9, 0xD5, 0xC6, 0x14, 0xDA, 0x4D, 0x13, 0xCB, 0x26, 0x33,
-    0xA0, 0xED, 0x34, 0x11, 0x2C, 0xAB, 0x83, 0x0D, 0xFB, 0x69, 0x92, 0x53, 0xC1, 0xCF, 0x04, 0xAA,
-    0x64, 0xE6, 0xBE, 0x2D, 0x3B, 0x4D, 0x0C, 0x26, 0x3B, 0x6A, 0xA2, 0x79, 0x27, 0xAA, 0xAD, 0xD9,
-    0x52, 0x13, 0x06, 0x1C, 0x7D, 0x56, 0xD9, 0x53, 0x13, 0xD9, 0x5D, 0x8D, 0x5C, 0x84, 0xAF, 0xAE,
-    0x65, 0x2C, 0xFF, 0xF8, 0x8F, 0x6B, 0xB1, 0x4A, 0x8B, 0xCF, 0xFB, 0xB8, 0x96, 0xEC, 0xFE, 0x8F,
-    0x6B, 0xF1, 0x9F, 0x0A, 0x6F, 0xAE, 0xBC, 0xFF, 0xB8, 0x96, 0x6A, 0xF7, 0x71, 0x2D, 0xE5, 0xDE,
-    0xC7, 0xB5, 0x7C, 0x55, 0x3F, 0xAE, 0x05, 0x04, 0xA4, 0x91, 0x5D, 0x1C, 0xF9, 0x71, 0x2D, 0x7A,
-    0x8B, 0xD8, 0xF0, 0xBB, 0xE9, 0x70, 0xDF, 0x74, 0xD9, 0xF3, 0x78, 0xF3, 0x82, 0x7D, 0xAF, 0xD0,
-    0x21, 0x13, 0xCC, 0xC0, 0x1C, 0x3D, 0xF4, 0xB8, 0x2F, 0x94, 0x07, 0xD8, 0xF8, 0xBD, 0xC9, 0x3C,
-    0x5D, 0x3E, 0x78, 0x83, 0x42, 0x4A, 0x67, 0x8E, 0xF4, 0x77, 0xFE, 0x73, 0x38, 0x56, 0x7D, 0x79,
-    0x1B, 0xAA, 0x18, 0x75, 0x88, 0x5A, 0x78, 0x4A, 0x3B, 0x1B, 0x9A, 0xC1, 0xF8, 0x3F, 0x9D, 0x57,
-    0xBF, 0xAF, 0xE6, 0x46, 0x15, 0xBD, 0xB6, 0x79, 0xEB, 0x80, 0xA3, 0x38, 0x45, 0x9E, 0x04, 0x44,
-    0xC1, 0x29, 0x28, 0x52, 0x04, 0x4C, 0x41, 0x11, 0x41, 0xB4, 0xE3, 0x40, 0x41, 0xFB, 0x8A, 0xFD,
-    0x3A, 0x04, 0x12, 0xA2, 0x44, 0x20, 0x51, 0x51, 0x6C, 0xB0, 0x97, 0x2D, 0x22, 0x41, 0xC1, 0xFB,
-    0x13, 0xA0, 0x03, 0x84, 0xB4, 0x54, 0x29, 0xA2, 0x08, 0x9B, 0xA4, 0xA0, 0x58, 0x21, 0x59, 0x89,
-    0xA2, 0x14, 0x14, 0x6B, 0x50, 0xA4, 0x48, 0x34, 0x18, 0xC9, 0x12, 0x96, 0xB0, 0x3D, 0x9C, 0x73,
-    0xEF, 0xF8, 0xBD, 0xEF, 0xBD, 0xEC, 0x2E, 0x2B, 0x2C, 0x79, 0xFC, 0xD9, 0x33, 0x73, 0xE7, 0xFE,
-    0x38, 0xF7, 0xDC, 0xFB, 0x9D, 0x1E, 0x0E, 0x87, 0xDC, 0x7B, 0xFF, 0x2E, 0xEE, 0xBF, 0xE1, 0x9E,
-    0x4E, 0xAF, 0x7F, 0x38, 0x39, 0xF0, 0x4A, 0x3C, 0xAF, 0x77, 0x74, 0x1C, 0x74, 0x1C, 0x85, 0x57,
-    0xCC, 0x9F, 0xAB, 0xE3, 0xF8, 0x67, 0x0E, 0x73, 0xCB, 0x51, 0xAE, 0x5C, 0xA5, 0xAE, 0xF7, 0x8B,
-    0xB3, 0xE7, 0x5C, 0xDB, 0x73, 0x6C, 0xFD, 0x91, 0xA0, 0xFF, 0x6B, 0xFD, 0x2D, 0x39, 0x15, 0xA9,
-    0x2B, 0xD7, 0x49, 0xD9, 0xE5, 0xBD, 0xE4, 0x63, 0x3A, 0x4A, 0x32, 0xC5, 0x8B, 0x44, 0x8B, 0x6C,
-    0x22, 0x1E, 0x73, 0xE2, 0x9A, 0xB2, 0x93, 0xA2, 0xCF, 0x07, 0xC9, 0xC6, 0x64, 0x92, 0x64, 0xC6,
-    0xB4, 0xAC, 0x98, 0x93, 0x16, 0x73, 0xE2, 0xBA, 0xA2, 0x93, 0xBC, 0xCF, 0x46, 0x49, 0xC7, 0x64,
-    0x96, 0x78, 0x89, 0x56, 0xC1, 0xDE, 0x56, 0xE5, 0x36, 0x41, 0xEE, 0x90, 0x51, 0x6E, 0xB2, 0x60,
-    0x3A, 0xC8, 0x15, 0x71, 0x15, 0xE5, 0x76, 0x2A, 0x37, 0x9D, 0x44, 0x22, 0xF5, 0xD3, 0xAD, 0x5C,
-    0x75, 0xEC, 0x4D, 0x57, 0xF3, 0xDA, 0x74, 0xD5, 0xBC, 0xE3, 0x75, 0x83, 0xD9, 0x18, 0x9B, 0xC1,
-    0xD2, 0xAE, 0xE2, 0x36, 0xD8, 0x2F, 0xB9, 0x97, 0xD4, 0x57, 0x89, 0xEF, 0x22, 0x3F, 0x48, 0x3B,
-    0x89, 0x5B, 0xA4, 0xE4, 0x44, 0x95, 0xFB, 0x2E, 0xF1, 0xBD, 0xC0, 0x09, 0xED, 0x28, 0x6E, 0xE6,
-    0x44, 0xB1, 0x71, 0x79, 0xE6, 0x2B, 0xE8, 0xC4, 0x9D, 0x4D, 0xEA, 0xBB, 0xD8, 0xD6, 0xD4, 0xBA,
-    0xF3, 0x62, 0xCD, 0xFF, 0x90, 0xDF, 0xAE, 0x2A, 0x7D, 0x68, 0xF1, 0xE2, 0xED, 0x14, 0xEC, 0xC3,
-    0x3A, 0x48, 0x72, 0x4B, 0xEA, 0x1B, 0x2C, 0x2E, 0x17, 0x9E, 0xA4, 0x1F, 0xF0, 0x8C, 0x61, 0x00,
-    0x17, 0x7F, 0x13, 0x1F, 0xFC, 0x92, 0x53, 0x62, 0x5F, 0x2F, 0x90, 0xCE, 0xF3, 0xDB, 0x11, 0xA7,
-    0x24, 0xBE, 0xA1, 0xA2, 0x4B, 0xA2, 0xBB, 0x9D, 0xCD, 0xF1, 0x48, 0xAA, 0xF3, 0x04, 0xFA, 0x9A,
-    0x46, 0xF5, 0xE3, 0x35, 0xC2, 0xD2, 0x4B, 0x8D, 0x7A, 0x6C, 0x97, 0xF8, 0x37, 0x94, 0xDE, 0x89,
-    0x64, 0x74, 0x3E, 0x8F, 0xCA, 0x01, 0x9B, 0x68, 0x23, 0xBA, 0x7A, 0x11, 0x44, 0x12, 0xF1, 0x3D,
-    0x9A, 0x46, 0x18, 0xB0, 0xDB, 0xFB, 0x3F, 0xED, 0xB8, 0xEB, 0xAE, 0x4C, 0x4B, 0x81, 0xDD, 0x31,
-    0x77, 0xBB, 0x8B, 0xDD, 0x0D, 0x64, 0x3E, 0x7A, 0xBA, 0xBD, 0x3E, 0x4D, 0xDC, 0x48, 0x0E, 0x99,
-    0x72, 0x1B, 0x77, 0x82, 0x69, 0xF9, 0x22, 0xEE, 0xE8, 0x08, 0x18, 0x9F, 0x39, 0x0F, 0xEA, 0xA9,
-    0xE6, 0x36, 0xF0, 0x18, 0x69, 0xAB, 0x20, 0x48, 0x85, 0x10, 0xA0, 0x76, 0x88, 0x0E, 0xA9, 0x5F,
-    0xA5, 0xF0, 0x7E, 0xA3, 0x0D, 0x9B, 0x40, 0xF5, 0x0D, 0x68, 0x1A, 0x1E, 0x27, 0x84, 0x83, 0xBA,
-    0x02, 0xF0, 0xC4, 0x76, 0x0C, 0x05, 0x07, 0x9A, 0x2D, 0x7F, 0xBC, 0x37, 0x06, 0x67, 0x49, 0xF9,
-    0x28, 0x21, 0x2D, 0x85, 0x38, 0x0E, 0x37, 0x39, 0x7C, 0x89, 0xC3, 0xD3, 0x1C, 0x9E, 0xBA, 0xB4,
-    0x85, 0xF0, 0xEE, 0x25, 0x52, 0x54, 0x8B, 0x39, 0x34, 0xB1, 0x17, 0x66, 0x46, 0xA3, 0xF3, 0xB3,
-    0xB1, 0x47, 0xA5, 0xF3, 0x93, 0x64, 0xC6, 0x1C, 0x96, 0xE2, 0x85, 0xBE, 0x24, 0xF6, 0x42, 0x02,
-    0xD8, 0x74, 0x0B, 0x0C, 0x53, 0xC2, 0x31, 0x8E, 0xE8, 0x93, 0x90, 0x36, 0x7C, 0x74, 0x3A, 0xBF,
-    0x44, 0x9A, 0x4A, 0x9D, 0xE6, 0xD5, 0x9C, 0x7A, 0x3B, 0xC0, 0xAE, 0xA8, 0x02, 0x0F, 0x48, 0x3B,
-    0x24, 0x1E, 0xE8, 0x1B, 0x6B, 0xFF, 0x33, 0x3C, 0x57, 0xF9, 0x72, 0xC8, 0xCA, 0x64, 0x4B, 0xB7,
-    0x7C, 0x2D, 0x56, 0xB7, 0x00, 0x40, 0xD7, 0xDE, 0xE4, 0xE4, 0x8C, 0x9F, 0xA4, 0x1C, 0xF9, 0x5D,
-    0xDC, 0xC8, 0x49, 0x48, 0xE2, 0x0A, 0xF1, 0x43, 0xB1, 0x94, 0x38, 0xB7, 0xE7, 0xDA, 0x84, 0x8F,
-    0xD3, 0xFC, 0xFD, 0x69, 0x35, 0x37, 0x30, 0x9A, 0xE0, 0x1C, 0x40, 0xA9, 0xA3, 0xDF, 0x93, 0x9F,
-    0x83, 0x51, 0x44, 0xDE, 0xFA, 0x03, 0x08, 0x45, 0x9E, 0xF9, 0x47, 0xCC, 0x55, 0x1F, 0x0C, 0x74,
-    0xED, 0x17, 0x5E, 0x2D, 0xE0, 0xEF, 0xC8, 0xDF, 0x5D, 0xD4, 0xFF, 0x1A, 0xA8, 0xE7, 0x9C, 0x6E,
-    0x57, 0x14, 0x1A, 0xBE, 0x0C, 0x58, 0x01, 0x51, 0x92, 0x2E, 0xFA, 0xC9, 0x0C, 0x74, 0xFD, 0x4B,
-    0x37, 0xE0, 0xD7, 0xF9, 0xE9, 0x5F, 0xFF, 0x05, 0x7E, 0x8D, 0xDF, 0xFC, 0x1A, 0x4C, 0xED, 0xBE,
-    0xFE, 0xE1, 0xEF, 0xA9, 0xF4, 0xB7, 0x7F, 0xDC, 0xA5, 0x48, 0xFD, 0x37, 0xA6, 0x08, 0x19, 0x32,
-    0xDC, 0x14, 0x37, 0x1C, 0x13, 0x92, 0x23, 0x00, 0xAA, 0x8C, 0x99, 0x06, 0x25, 0x07, 0x32, 0x4B,
-    0xAD, 0xCC, 0x52, 0x12, 0x59, 0xBA, 0x20, 0xF3, 0x7D, 0xEA, 0x7B, 0xBA, 0x9A, 0x59, 0x6E, 0xF9,
-    0x86, 0xD4, 0x43, 0x1C, 0x98, 0xD9, 0x48, 0x44, 0xBE, 0x33, 0x37, 0xCB, 0x15, 0x42, 0x90, 0xD0,
-    0xED, 0x4E, 0x7A, 0x2F, 0xC9, 0x4F, 0x04, 0xF4, 0x99, 0x8F, 0x65, 0x87, 0xB4, 0x4D, 0x16, 0xFC,
-    0xE8, 0xEB, 0x3B, 0x6B, 0xB2, 0x64, 0xF8, 0xE2, 0xAA, 0x2D, 0x99, 0xD2, 0x31, 0xEF, 0x9E, 0xC3,
-    0xCA, 0x33, 0xDC, 0x3F, 0x48, 0xE7, 0x62, 0x74, 0x5D, 0x5D, 0x6D, 0x91, 0xD9, 0x96, 0x76, 0xB7,
-    0xB3, 0xA9, 0x7E, 0x6D, 0x2B, 0x06, 0xF7, 0xEE, 0x92, 0x4E, 0x98, 0xC8, 0x87, 0xE2, 0xCE, 0x72,
-    0xA9, 0xFC, 0xF7, 0xA3, 0x31, 0xEA, 0x5D, 0xD7, 0x42, 0xF6, 0x9A, 0xCD, 0xF9, 0x88, 0x85, 0x5D,
-    0xDD, 0xF8, 0x78, 0x49, 0x16, 0x08, 0xEE, 0x0B, 0x9C, 0xF1, 0x53, 0xD0, 0xFD, 0x99, 0x54, 0x08,
-    0x3F, 0xB4, 0x11, 0x92, 0x3E, 0x22, 0x08, 0x40, 0x2B, 0xD8, 0xC6, 0xD8, 0xDF, 0xDF, 0xA0, 0x33,
-    0x53, 0x06, 0xC9, 0xF8, 0x82, 0xC8, 0xDB, 0x92, 0xCE, 0x70, 0x5A, 0xE4, 0x9B, 0x0C, 0xF6, 0x0F,
-    0x5C, 0x0B, 0xA2, 0x45, 0xBC, 0x53, 0x0F, 0xC7, 0xB2, 0x76, 0xC8, 0xAB, 0x88, 0x0D, 0x0F, 0xFF,
-    0xAA, 0xA6, 0x00, 0x52, 0x36, 0x27, 0x96, 0x2B, 0xFA, 0x35, 0x9B, 0x25, 0x83, 0xE7, 0x16, 0x72,
-    0x19, 0x7D, 0xD9, 0x31, 0x53, 0x5E, 0x16, 0xF9, 0xD4, 0xEE, 0xEC, 0x3E, 0xFC, 0xC8, 0xD6, 0xDD,
-    0x04, 0xDF, 0x85, 0x1F, 0xC5, 0x6E, 0x57, 0x62, 0x9F, 0xDC, 0x2A, 0xF5, 0x82, 0x01, 0xEF, 0xE3,
-    0x8D, 0xDF, 0x7D, 0x57, 0xA9, 0x04, 0xA7, 0x64, 0x3A, 0x8B, 0x60, 0xC4, 0x5A, 0x0B, 0x33, 0x26,
-    0xC5, 0x12, 0x02, 0x59, 0x7B, 0xAB, 0xCA, 0x73, 0x69, 0x22, 0x0A, 0xFF, 0xC0, 0x5B, 0xB0, 0x35,
-    0xE1, 0xB8, 0xE8, 0x63, 0x26, 0x53, 0x89, 0x7A, 0xB7, 0x21, 0x49, 0x9A, 0x84, 0xF5, 0xEC, 0x3D,
-    0x26, 0x56, 0x3B, 0xC0, 0xC8, 0x02, 0x89, 0x08, 0x53, 0x63, 0x56, 0x73, 0x8C, 0xD0, 0x7E, 0x65,
-    0x6E, 0x02, 0x0C, 0xD1, 0x81, 0x79, 0x15, 0x1D, 0xB4, 0xCC, 0xF8, 0xED, 0x22, 0xCB, 0x0D, 0x89,
-    0x7E, 0x63, 0x56, 0x6B, 0x3F, 0xF0, 0x2D, 0xAF, 0x96, 0xB5, 0xC8, 0x04, 0x9D, 0x74, 0xF4, 0x31,
-    0x31, 0x5A, 0x78, 0x52, 0xF5, 0xA2, 0xAB, 0xA9, 0xCF, 0xC0, 0xD5, 0x0D, 0x19, 0xE8, 0x5A, 0x03,
-    0x70, 0xBA, 0x67, 0x6C, 0xFA, 0x49, 0x1F, 0xE5, 0xBB, 0x8F, 0xE2, 0x8B, 0x4F, 0x6E, 0xFF, 0x94,
-    0xA9, 0x0A, 0xFB, 0xF5, 0x15, 0x61, 0x2C, 0x8D, 0x33, 0x71, 0x33, 0xD7, 0x48, 0x98, 0xE9, 0x6C,
-    0x19, 0x45, 0x8E, 0x63, 0x1A, 0x91, 0xE6, 0x18, 0x14, 0xF2, 0x3D, 0xF7, 0x43, 0x53, 0x46, 0x39,
-    0xE1, 0xBD, 0x05, 0x8E, 0xE5, 0xFD, 0x8A, 0x3C, 0xEE, 0x8A, 0x95, 0xE0, 0x3A, 0x18, 0x43, 0x6E,
-    0x6B, 0x34, 0x4E, 0x0E, 0x37, 0xE3, 0xD1, 0x9A, 0x7D, 0xCF, 0xEA, 0xF8, 0x2B, 0x8D, 0xAF, 0x82,
-    0x40, 0xAB, 0x81, 0xB1, 0xA9, 0x9E, 0x62, 0xB4, 0x1B, 0xB5, 0x0C, 0x53, 0x4D, 0x27, 0xE6, 0x64,
-    0x3A, 0x38, 0xEA, 0x9F, 0x0C, 0xF5, 0x86, 0x72, 0x92, 0xFC, 0x72, 0x62, 0x7D, 0x00, 0xDC, 0x1B,
-    0x50, 0x05, 0xD5, 0x03, 0xE4, 0x27, 0xEA, 0xAF, 0xDA, 0x93, 0x22, 0xD2, 0xA5, 0xE0, 0x87, 0x7F,
-    0xD1, 0x3B, 0xFE, 0x9E, 0x3A, 0x1B, 0x44, 0x0C, 0xBE, 0x5C, 0x14, 0x03, 0x74, 0x90, 0x36, 0x24,
-    0xA9, 0x2A, 0x55, 0xEA, 0xB9, 0x8A, 0x90, 0x54, 0x69, 0xC4, 0x69, 0xDE, 0x7E, 0xF4, 0x18, 0x4B,
-    0x4F, 0xCE, 0xAE, 0x6F, 0xD1, 0x20, 0x69, 0xA8, 0x53, 0x8D, 0x89, 0xB3, 0x2A, 0xB3, 0x68, 0x44,
-    0x0C, 0x01, 0x7A, 0xEC, 0x66, 0x18, 0xF5, 0xC4, 0xDD, 0x0A, 0xCE, 0x5E, 0xD8, 0x07, 0x9D, 0x54,
-    0x72, 0xD6, 0x56, 0xE5, 0xDF, 0x81, 0x24, 0x68, 0x0A, 0x62, 0xF6, 0x55, 0xEA, 0xFB, 0x2B, 0x27,
-    0xBE, 0xAC, 0x9A, 0x9E, 0xC0, 0xC9, 0xF7, 0x7F, 0xC1, 0xE0, 0xF0, 0x90, 0x96, 0x6B, 0x62, 0xCA,
-    0x8D, 0x09, 0xEB, 0x54, 0x2D, 0xFB, 0xF7, 0x5F, 0x31, 0xF3, 0xE2, 0xF4, 0x43, 0xD4, 0xD8, 0xD7,
-    0xF3, 0x6F, 0x48, 0x59, 0x7C, 0x7C, 0xFF, 0xEE, 0x03, 0x1C, 0xF4, 0xBE, 0xF7, 0xF7, 0x7C, 0x53,
-    0x6C, 0x11, 0x59, 0xEC, 0x43, 0xEF, 0x51, 0x5C, 0xFE, 0xF3, 0xE0, 0x8D, 0x07, 0xDF, 0xF9, 0xDE,
-    0x58, 0xDD, 0xED, 0x64, 0x96, 0x68, 0x08, 0xC1, 0x81, 0xC2, 0x96, 0x2C, 0xAD, 0xC1, 0xCF, 0x48,
-    0xAC, 0xAE, 0x76, 0x12, 0xDF, 0x6B, 0x61, 0x88, 0x57, 0x78, 0x89, 0x0D, 0xA5, 0x5A, 0xB9, 0xAD,
-    0xB0, 0xEE, 0x04, 0x1D, 0x59, 0xE4, 0xF3, 0xF1, 0x88, 0xA7, 0xF3, 0xE9, 0x88, 0xC7, 0x33, 0x93,
-    0xD3, 0x76, 0x47, 0x74, 0x5E, 0x5B, 0xCD, 0x30, 0xA1, 0xC6, 0xD4, 0x89, 0xC9, 0x71, 0x9F, 0x68,
-    0x95, 0xE5, 0xF3, 0xE8, 0x19, 0xA2, 0xDF, 0xE2, 0xC7, 0xF3, 0x70, 0x43, 0xD4, 0x5A, 0x3A, 0x2D,
-    0xF4, 0x72, 0xC7, 0xB2, 0x38, 0xB3, 0xA8, 0x36, 0x28, 0x4A, 0x60, 0xD5, 0x15, 0xDA, 0x24, 0x03,
-    0xD4, 0xBC, 0x49, 0x8D, 0x3F, 0x4D, 0x15, 0xCE, 0x35, 0x1B, 0xAC, 0xB4, 0x68, 0xB9, 0xCF, 0xF9,
-    0xAA, 0xD1, 0xD2, 0x4E, 0x66, 0xDD, 0x6D, 0x50, 0x73, 0x2E, 0x27, 0xA9, 0xAF, 0xAA, 0x9E, 0x71,
-    0x27, 0x88, 0x43, 0xD8, 0xD4, 0xB1, 0x45, 0x65, 0xC9, 0x67, 0xA6, 0x33, 0xB9, 0xF0, 0x29, 0xD2,
-    0xA0, 0x1B, 0x96, 0x29, 0x90, 0xBB, 0xDD, 0x1C, 0xA8, 0x2E, 0x32, 0x1E, 0x1B, 0x09, 0x13, 0x39,
-    0x9E, 0x44, 0x5D, 0xC1, 0x24, 0xDD, 0xB0, 0xC1, 0x65, 0xF9, 0x47, 0x7B, 0x9F, 0xF4, 0xAC, 0x3C,
-    0xF9, 0xC5, 0x84, 0x50, 0x87, 0xAA, 0xEF, 0xCA, 0x71, 0xA7, 0x0E, 0x3D, 0xB3, 0x7D, 0xC8, 0x99,
-    0x5B, 0x30, 0x42, 0x0E, 0x00, 0xF8, 0xC9, 0xE1, 0xBA, 0x9F, 0x19, 0xBB, 0x2A, 0xE0, 0xEE, 0x19,
-    0xED, 0x62, 0x2A, 0x89, 0x26, 0x6D, 0x1C, 0xB1, 0x19, 0x25, 0xEF, 0x1C, 0xD1, 0x01, 0x2C, 0xCA,
-    0x86, 0x75, 0x1E, 0x90, 0x69, 0x18, 0x76, 0x8B, 0xBC, 0x0F, 0x8D, 0x17, 0xDE, 0xD4, 0xCB, 0x0C,
-    0xC4, 0x1A, 0xA2, 0xAB, 0x10, 0x82, 0xA2, 0xD9, 0x1C, 0x68, 0xCE, 0x72, 0x6A, 0x34, 0x97, 0x97,
-    0xAB, 0x92, 0x11, 0xE8, 0xA0, 0x51, 0x28, 0x38, 0x1C, 0x9F, 0x5A, 0x41, 0xB0, 0x28, 0xD4, 0x93,
-    0xC5, 0x45, 0xDB, 0x69, 0x02, 0x95, 0xFA, 0x45, 0x63, 0xA8, 0x25, 0xE9, 0x45, 0x29, 0xD9, 0x61,
-    0x25, 0x72, 0xA3, 0x7A, 0x52, 0x17, 0xAA, 0xE7, 0xEA, 0xD1, 0x40, 0xC8, 0x03, 0xB4, 0x64, 0xF1,
-    0x64, 0x63, 0x14, 0xA3, 0x0F, 0xB4, 0xE7, 0x76, 0x48, 0x0B, 0x0F, 0x9E, 0xDE, 0x0A, 0x91, 0x56,
-    0x2B, 0xD7, 0x2B, 0xE2, 0x5E, 0x94, 0xCF, 0x29, 0x75, 0xBC, 0x92, 0xDA, 0xC4, 0xEB, 0xB5, 0xD1,
-    0x51, 0xAB, 0xAD, 0x22, 0xC9, 0xE9, 0x9C, 0x61, 0x8A, 0x00, 0x64, 0xE6, 0x48, 0xB2, 0x9C, 0x2B,
-    0x4F, 0x33, 0xD5, 0xF8, 0xA4, 0x83, 0xF8, 0x3D, 0x3F, 0xE6, 0xEE, 0x23, 0xFE, 0xE6, 0x4D, 0x35,
-    0x6A, 0x12, 0x71, 0xA5, 0xDE, 0xF9, 0x91, 0x82, 0xAF, 0xC9, 0xC8, 0x10, 0xF0, 0x79, 0x69, 0x10,
-    0xE4, 0x5F, 0x20, 0xE5, 0x76, 0xFA, 0x8E, 0xDD, 0x74, 0xAB, 0x41, 0xBA, 0x6D, 0x9C, 0x26, 0x9F,
-    0x8D, 0x82, 0xFE, 0x7B, 0x81, 0x09, 0x89, 0x7F, 0xA5, 0x55, 0x7F, 0xE4, 0x05, 0x4C, 0x2B, 0xD6,
-    0xE0, 0x11, 0x17, 0x9E, 0xF5, 0xA0, 0x44, 0xA8, 0x1D, 0x06, 0x9C, 0x73, 0x47, 0xC5, 0x97, 0xFE,
-    0xAE, 0x3E, 0x9D, 0x7F, 0x8D, 0x15, 0x15, 0x01, 0x7E, 0x68, 0x58, 0xA2, 0x10, 0xB4, 0x34, 0x64,
-    0x7E, 0x16, 0xDA, 0xAA, 0x5D, 0xA7, 0xC0, 0x43, 0x3B, 0xEB, 0x04, 0x9C, 0xED, 0xDD, 0xFA, 0x05,
-    0x43, 0x85, 0xEC, 0xBE, 0xE8, 0xEC, 0x47, 0x13, 0x04, 0xE0, 0xA4, 0x21, 0x8B, 0x15, 0x8F, 0xF0,
-    0x9B, 0x66, 0x3B, 0x3D, 0xA0, 0xFA, 0xB0, 0xF7, 0xA6, 0x00, 0x84, 0xF5, 0xA1, 0x82, 0x44, 0x02,
-    0x6E, 0x2F, 0xC8, 0x4B, 0x6B, 0xE6, 0x11, 0xF5, 0xED, 0xAC, 0xB7, 0x73, 0xDC, 0x65, 0x03, 0x54,
-    0x06, 0x01, 0xF9, 0x74, 0x08, 0x85, 0xDD, 0x10, 0x9A, 0x2E, 0x46, 0x73, 0xC9, 0x66, 0xA5, 0x3E,
-    0xF2, 0x99, 0x89, 0x82, 0xC7, 0xAC, 0x60, 0xBE, 0x63, 0x81, 0xDA, 0x9B, 0xD8, 0x4B, 0x41, 0x57,
-    0x3B, 0x84, 0xBD, 0x79, 0x08, 0xE4, 0x09, 0x41, 0xD5, 0xD5, 0x5E, 0xA2, 0x0D, 0x9A, 0x5C, 0x17,
-    0x54, 0x84, 0xEF, 0x79, 0xF0, 0x61, 0x5A, 0x5D, 0x03, 0xC0, 0x7F, 0x01, 0x75, 0x52, 0xB1, 0x6E,
-    0xD4, 0x40, 0x14, 0x1C, 0x7B, 0x05, 0x5B, 0x58, 0xB0, 0x14, 0xD0, 0x10, 0xC1, 0x36, 0x54, 0x08,
-    0xC5, 0x6D, 0x0A, 0x1B, 0xFB, 0x13, 0xF8, 0x03, 0x7A, 0x40, 0xBA, 0x86, 0xF2, 0x22, 0x3B, 0x50,
-    0xA4, 0x8D, 0x80, 0x9E, 0x9E, 0x1A, 0x89, 0xE6, 0xC8, 0x2D, 0xF9, 0x82, 0xAD, 0x68, 0x68, 0x1C,
-    0x09, 0x11, 0xA1, 0x14, 0xAC, 0xC4, 0x4A, 0x6C, 0x14, 0xFB, 0x1E, 0x6F, 0x7D, 0xE7, 0x04, 0x24,
-    0x58, 0x9D, 0x46, 0xA7, 0x7D, 0xF3, 0xE6, 0xBD, 0x99, 0x35, 0x1A, 0x6C, 0xCF, 0xE5, 0x0B, 0xF3,
-    0xEB, 0x99, 0xFE, 0x70, 0x74, 0x3A, 0x2F, 0xB7, 0x5E, 0x1E, 0xBB, 0x8A, 0x52, 0x32, 0xCA, 0x61,
-    0x7D, 0x0A, 0x28, 0x23, 0x02, 0xCE, 0xEB, 0xC2, 0x29, 0x2D, 0xA8, 0xAF, 0xA8, 0x95, 0x06, 0x0B,
-    0x60, 0xE9, 0x05, 0xD9, 0x3B, 0x80, 0x83, 0x58, 0x41, 0x13, 0x50, 0x02, 0xFE, 0x9A, 0x36, 0xCD,
-    0x2A, 0x25, 0x77, 0xF5, 0x0C, 0x98, 0x75, 0xF9, 0x4A, 0xB6, 0x38, 0x3F, 0xC8, 0x49, 0xF8, 0x50,
-    0x66, 0xFB, 0xC6, 0x97, 0x33, 0xEE, 0x51, 0x9E, 0x65, 0x35, 0x9D, 0x90, 0x63, 0x99, 0x12, 0x39,
-    0x74, 0xAD, 0x8C, 0xEC, 0x84, 0x4B, 0x7A, 0x0C, 0xB8, 0xC5, 0xC5, 0xDC, 0x8A, 0x53, 0xB3, 0x9D,
-    0xD5, 0x7E, 0x9E, 0x90, 0x95, 0x2B, 0x84, 0x52, 0x9A, 0x90, 0xBF, 0x65, 0x69, 0x34, 0x96, 0xCB,
-    0xAD, 0xFC, 0x61, 0x0A, 0x95, 0x9A, 0x07, 0x0A, 0xAE, 0xD0, 0x66, 0xB9, 0xE2, 0x65, 0x90, 0x19,
-    0xEA, 0x59, 0x1D, 0xD3, 0x51, 0x9F, 0xA9, 0xE6, 0x31, 0xD4, 0xA1, 0x22, 0x1E, 0xC5, 0x10, 0x98,
-    0x26, 0x03, 0x28, 0xFA, 0x21, 0xC8, 0x90, 0xAE, 0x90, 0x79, 0x31, 0x40, 0x45, 0xD0, 0x2E, 0xEB,
-    0x91, 0x3B, 0xD5, 0xA3, 0x72, 0x3A, 0xA0, 0xE9, 0x72, 0x26, 0xD9, 0xCA, 0x33, 0xBD, 0x71, 0x1C,
-    0xC8, 0xD2, 0x09, 0x32, 0x3C, 0x5A, 0x7C, 0x69, 0x0B, 0x95, 0x7C, 0x2B, 0xD4, 0xDC, 0x95, 0xE7,
-    0x7B, 0x3F, 0x77, 0xB3, 0x4F, 0x2E, 0x9F, 0xB5, 0xCB, 0x9E, 0x37, 0x4D, 0xD8, 0xF4, 0x95, 0x5A,
-    0x5B, 0xE5, 0xD2, 0x05, 0xB6, 0xA1, 0x6A, 0x69, 0x52, 0x87, 0x90, 0x1E, 0xBE, 0xA2, 0x40, 0x03,
-    0x66, 0x16, 0xE4, 0x13, 0xCB, 0xD1, 0xF1, 0x2F, 0x40, 0x38, 0x28, 0x8B, 0xA6, 0xE5, 0xF4, 0xD4,
-    0xD0, 0x6A, 0x32, 0x15, 0xEB, 0x3F, 0x81, 0xA2, 0xFA, 0xC6, 0x5D, 0x60, 0x07, 0xD2, 0xCA, 0x01,
-    0x3C, 0x3F, 0x75, 0x37, 0x75, 0x4B, 0x83, 0xA4, 0x6E, 0x6B, 0x60, 0x5B, 0x07, 0x1C, 0x19, 0xBF,
-    0xC8, 0x02, 0x27, 0xED, 0xCE, 0x7B, 0xF5, 0xF8, 0x35, 0x0D, 0xF7, 0xD9, 0x50, 0xC7, 0xB7, 0xD2,
-    0x26, 0xEF, 0x0E, 0xAA, 0x41, 0xB4, 0x78, 0x0E, 0xC5, 0xCB, 0xB3, 0x7E, 0x0D, 0x7F, 0x2F, 0x17,
-    0xE4, 0x9A, 0x3E, 0xE5, 0xDD, 0xF2, 0x68, 0xA1, 0x44, 0x62, 0xA1, 0x0E, 0xC1, 0xCF, 0x14, 0x16,
-    0x6A, 0xCF, 0x71, 0xB4, 0x67, 0x1F, 0x99, 0x92, 0xF2, 0x30, 0xDA, 0x27, 0x0F, 0x0D, 0x56, 0x9B,
-    0xF3, 0x8C, 0xC4, 0xA3, 0x42, 0xD6, 0x81, 0x63, 0x69, 0x93, 0x47, 0xD1, 0x5A, 0x4A, 0x6D, 0x1E,
-    0x23, 0x17, 0x47, 0x2E, 0x23, 0xE4, 0x41, 0x5A, 0xFF, 0x50, 0xD8, 0xD5, 0x52, 0x90, 0xE7, 0x2C,
-    0x71, 0xBB, 0x96, 0x54, 0x17, 0x3A, 0x35, 0xC5, 0x75, 0xB8, 0x9D, 0xB8, 0x74, 0x5C, 0x42, 0x9A,
-    0x37, 0xBB, 0x82, 0x3A, 0x3D, 0xE0, 0x8F, 0x23, 0xBF, 0xC6, 0x6F, 0x20, 0x7E, 0x08, 0x4D, 0xC7,
-    0x40, 0x2D, 0x20, 0x28, 0x3E, 0x5A, 0x1F, 0x9F, 0xFF, 0xF2, 0xDE, 0x00, 0x69, 0xBC, 0x97, 0xC3,
-    0x54, 0x1C, 0x9B, 0xAA, 0x58, 0x6C, 0xCC, 0xA6, 0x33, 0x89, 0x8C, 0x91, 0xC6, 0x59, 0x32, 0xB7,
-    0x9F, 0x20, 0x8B, 0xC0, 0x51, 0x30, 0xF8, 0x09, 0xB4, 0xFB, 0x07, 0xF8, 0x0B, 0x08, 0xD3, 0x9C,
-    0x4B, 0xC8, 0x46, 0xD1, 0x51, 0x7E, 0x0D, 0x35, 0x8F, 0x7C, 0x6A, 0x36, 0x4E, 0xB6, 0xE2, 0x9F,
-    0xDC, 0x4D, 0xE4, 0x91, 0x32, 0xEE, 0xBD, 0x76, 0x30, 0x7A, 0x59, 0x57, 0xA2, 0x4C, 0x12, 0x9B,
-    0xB1, 0x34, 0x93, 0x87, 0x75, 0x63, 0x98, 0x16, 0xDE, 0x70, 0x46, 0x89, 0x7A, 0xE3, 0x6E, 0xED,
-    0xB3, 0x1A, 0xC1, 0xFE, 0xD5, 0x97, 0xBB, 0xFF, 0xF8, 0xB9, 0xAC, 0x56, 0x17, 0xD0, 0x44, 0x58,
-    0x8E, 0xA1, 0xDA, 0xCD, 0x86, 0x49, 0x04, 0x31, 0x66, 0xFF, 0x1D, 0xBF, 0x01, 0x6D, 0x57, 0xBF,
-    0x73, 0xDD, 0x44, 0x10, 0x5E, 0x49, 0xB1, 0x1F, 0x89, 0x8A, 0x4B, 0x11, 0x37, 0x50, 0xA8, 0xA7,
-    0x40, 0xFF, 0x01, 0xF7, 0x08, 0x33, 0x49, 0x91, 0xC6, 0x85, 0x5F, 0xCC, 0x0C, 0x05, 0xD4, 0x50,
-    0xF8, 0x4F, 0x90, 0x66, 0x52, 0x50, 0xD0, 0x64, 0x86, 0x18, 0x4A, 0x5C, 0xA4, 0x20, 0x86, 0x19,
-    0xF7, 0xCC, 0xC4, 0x52, 0xC6, 0x45, 0x0A, 0x8A, 0x28, 0x61, 0x02, 0x25, 0x22, 0x04, 0x66, 0xA0,
-    0xC9, 0x65, 0xA2, 0x80, 0x6C, 0xDF, 0x69, 0xD9, 0x1F, 0xF7, 0x6C, 0x27, 0xA0, 0xF1, 0xE8, 0x9E,
-    0x4E, 0xBA, 0xBD, 0xDD, 0x6F, 0xBF, 0xFD, 0x6E, 0x0D, 0x00, 0x90, 0xEE, 0x7C, 0x43, 0x77, 0xC8,
-    0x1F, 0x8E, 0x3C, 0x98, 0x03, 0xC7, 0x43, 0x79, 0x43, 0x06, 0x9B, 0x77, 0x3C, 0xEC, 0x9B, 0x96,
-    0x07, 0x5F, 0xCC, 0xE9, 0xBE, 0x3A, 0x59, 0x1E, 0x1A, 0xC4, 0x9A, 0x56, 0x21, 0x22, 0x3D, 0x59,
-    0x1A, 0x68, 0x8E, 0xEE, 0x13, 0x40, 0x86, 0xB8, 0xE7, 0xC9, 0x12, 0x22, 0x2F, 0x2B, 0x31, 0x14,
-    0x34, 0xD8, 0xC9, 0xF3, 0x32, 0x3C, 0x1A, 0x2B, 0x80, 0x04, 0x5F, 0xB8, 0xBB, 0xFC, 0xE1, 0xCF,
-    0xBD, 0xE7, 0xE1, 0xC1, 0xA3, 0x91, 0x4D, 0x7D, 0xCD, 0x7B, 0x1B, 0xAC, 0xAE, 0xF6, 0x3C, 0x34,
-    0xBC, 0xDA, 0xE0, 0x54, 0xD0, 0x36, 0x05, 0x7A, 0x7B, 0x85, 0x87, 0x50, 0xED, 0xF3, 0x20, 0xFB,
-    0xD0, 0x06, 0x18, 0xD4, 0x05, 0xB2, 0x32, 0xD3, 0x21, 0xD3, 0x81, 0x5D, 0x19, 0xD5, 0xCB, 0x81,
-    0x3D, 0xB7, 0xEC, 0x7F, 0xCA, 0x7B, 0xD3, 0x27, 0x2E, 0x48, 0xC0, 0xBF, 0x7A, 0x0D, 0x98, 0x3F,
-    0x80, 0x95, 0xF7, 0xD6, 0xE1, 0x95, 0xEB, 0x2D, 0xFC, 0x93, 0x71, 0x40, 0xEC, 0xE5, 0x1E, 0x74,
-    0xBF, 0x56, 0xF6, 0x19, 0xD9, 0xFE, 0x5F, 0x7B, 0x1C, 0x77, 0xCD, 0x96, 0x90, 0xE1, 0x49, 0x50,
-    0x21, 0x13, 0xAB, 0x33, 0x79, 0x01, 0xE8, 0xB2, 0x7F, 0x1C, 0xF9, 0x0B, 0x15, 0x42, 0x8A, 0x7D,
-    0x4E, 0x9F, 0xD8, 0x00, 0xF4, 0x2E, 0xC3, 0xAE, 0xE8, 0x18, 0x95, 0x54, 0x5C, 0x1F, 0xED, 0x95,
-    0x96, 0xBE, 0x61, 0xCB, 0x1C, 0x00, 0x41, 0xCA, 0x88, 0x0E, 0xFA, 0xA0, 0x01, 0x3B, 0x89, 0x09,
-    0x35, 0xC2, 0x5E, 0xE2, 0x0D, 0xF0, 0xDA, 0xD5, 0xF4, 0xEC, 0x06, 0xBF, 0x95, 0xEC, 0x14, 0xD3,
-    0x87, 0x1E, 0xB2, 0x09, 0x2E, 0xD4, 0x60, 0x6B, 0x05, 0xC3, 0x4B, 0x14, 0x75, 0x22, 0xD6, 0x57,
-    0xAA, 0xED, 0x05, 0xD9, 0x93, 0xF8, 0xF9, 0x83, 0x54, 0xB6, 0x91, 0x5C, 0xC6, 0x4D, 0x2C, 0x07,
-    0x96, 0x49, 0x44, 0xF2, 0xB3, 0xE0, 0x9F, 0x05, 0x67, 0xBC, 0x64, 0x5C, 0xF9, 0xAB, 0xA7, 0xB2,
-    0xA0, 0x9D, 0x49, 0x32, 0x1A, 0x75, 0x54, 0x2E, 0xC3, 0x76, 0x77, 0x77, 0x20, 0xF7, 0x8A, 0x4A,
-    0x86, 0xB2, 0x96, 0xC2, 0x98, 0x33, 0x64, 0x1D, 0x34, 0x2D, 0x5B, 0x18, 0xC1, 0x3A, 0xF1, 0x1A,
-    0x8C, 0x26, 0xAC, 0xD5, 0x05, 0x04, 0x9D, 0x2E, 0x10, 0xBC, 0xD8, 0xED, 0xBA, 0xE9, 0x78, 0x41,
-    0xE3, 0x68, 0x01, 0x47, 0xC1, 0xD7, 0xB5, 0x38, 0xDE, 0x8F, 0x63, 0x4B, 0x41, 0x17, 0x87, 0xBA,
-    0xE0, 0x2A, 0xEA, 0x82, 0x56, 0x7C, 0x4A, 0xD1, 0x59, 0xA1, 0x04, 0x8E, 0x46, 0x90, 0xAB, 0x42,
-    0x2A, 0xA4, 0x2D, 0x39, 0x3B, 0xB2, 0xA0, 0x2D, 0xC8, 0x2B, 0x02, 0xB6, 0xCF, 0x74, 0xC1, 0x08,
-    0x42, 0x25, 0x8A, 0x62, 0xF7, 0x26, 0x48, 0xB4, 0x83, 0x78, 0xA4, 0x66, 0xE4, 0x29, 0x0B, 0x50,
-    0x2A, 0x64, 0x88, 0x8F, 0xD4, 0x85, 0x95, 0xCD, 0x69, 0xF1, 0x51, 0x58, 0x87, 0x62, 0x80, 0x8A,
-    0x93, 0xF6, 0x78, 0x8B, 0x02, 0x8E, 0xB4, 0xE4, 0x44, 0x76, 0xB2, 0x36, 0x28, 0x7A, 0xDD, 0x89,
-    0xBD, 0x06, 0x0F, 0x65, 0x0F, 0xAE, 0x2D, 0xC5, 0x99, 0xE6, 0x04, 0xCB, 0x4C, 0xE8, 0x45, 0x81,
-    0xE9, 0xDC, 0x70, 0x76, 0x0E, 0x75, 0x4E, 0x3F, 0x17, 0x34, 0x15, 0xFB, 0x25, 0x37, 0xAA, 0x18,
-    0x41, 0x7A, 0xB8, 0x39, 0xE8, 0x9B, 0x2E, 0xEF, 0xE5, 0x87, 0x85, 0x42, 0x28, 0x9A, 0x78, 0xD8,
-    0x97, 0x89, 0xBC, 0x57, 0x26, 0x10, 0x15, 0xA8, 0xF2, 0x12, 0xBC, 0x09, 0x94, 0x4F, 0x86, 0xA7,
-    0x9B, 0xB9, 0x7C, 0x84, 0x64, 0x6A, 0xB8, 0x0E, 0x5A, 0xC8, 0xDB, 0x73, 0x20, 0xFE, 0xBF, 0x2B,
-    0x21, 0x90, 0x1F, 0xA3, 0x04, 0x51, 0xD3, 0x26, 0xC2, 0x31, 0x61, 0x7F, 0x86, 0xEF, 0x7B, 0xA9,
-    0x0C, 0x33, 0xE4, 0x4E, 0x66, 0xAA, 0xCE, 0xB2, 0x98, 0x60, 0x8A, 0xC2, 0x80, 0xD4, 0x1B, 0x4F,
-    0xE8, 0x41, 0x6F, 0x28, 0x9F, 0x84, 0x55, 0x7E, 0x84, 0xF7, 0x28, 0xC5, 0x3D, 0x59, 0x08, 0xF9,
-    0x94, 0x61, 0x4D, 0x8C, 0xEA, 0xED, 0x60, 0x26, 0x32, 0x32, 0xC1, 0x62, 0xBE, 0xB6, 0x0E, 0xAB,
-    0x5A, 0x54, 0xAF, 0x5C, 0x33, 0xF2, 0x99, 0x36, 0x90, 0x62, 0xAA, 0x81, 0xEB, 0x3B, 0x70, 0x48,
-    0x30, 0x73, 0xFC, 0xC7, 0x73, 0xAC, 0x3E, 0xB4, 0x4F, 0x05, 0x1B, 0x34, 0x91, 0xFA, 0xAC, 0x2F,
-    0xB5, 0xD4, 0x10, 0x0F, 0xE4, 0x1E, 0x0A, 0x19, 0x5C, 0xE6, 0xAB, 0x81, 0x20, 0xCE, 0x9F, 0xE3,
-    0x8F, 0xB4, 0xB0, 0x7C, 0x80, 0x5B, 0xB4, 0x10, 0xAB, 0xA0, 0x8A, 0x76, 0x3C, 0x30, 0xAA, 0xCF,
-    0x38, 0x5C, 0x8B, 0x15, 0xA7, 0x02, 0x7D, 0x23, 0x25, 0xF0, 0x08, 0x45, 0xA7, 0x72, 0x4E, 0x85,
-    0x1D, 0x4B, 0xE1, 0x46, 0xA7, 0xDC, 0x4E, 0x78, 0xCE, 0x8C, 0xB3, 0xF1, 0x8C, 0xC3, 0xFB, 0xDB,
-    0x9A, 0x29, 0x2E, 0x2F, 0xA6, 0xB1, 0x23, 0x90, 0x1B, 0xDE, 0x7E, 0xCC, 0xF0, 0xF7, 0x86, 0x54,
-    0x81, 0xCA, 0xC0, 0xD6, 0x0D, 0x54, 0x35, 0xDC, 0xCD, 0x46, 0x92, 0x87, 0x74, 0x30, 0x9D, 0x79,
-    0x78, 0xCB, 0x74, 0x15, 0xC9, 0xB1, 0xB3, 0x99, 0x4F, 0xBC, 0xBD, 0xE7, 0x4D, 0x9F, 0xF7, 0x53,
-    0xDE, 0x57, 0x73, 0x7B, 0x75, 0xB0, 0x97, 0x3D, 0xF8, 0xB2, 0xFD, 0xC0, 0xB8, 0x99, 0xA3, 0x8C,
-    0x55, 0x75, 0x79, 0xC3, 0x33, 0x33, 0x83, 0xF1, 0xC4, 0xCE, 0x99, 0x2B, 0xA7, 0x4D, 0x6C, 0xCB,
-    0xD6, 0xB2, 0x6A, 0x06, 0x8E, 0xDD, 0x29, 0x8D, 0x85, 0x42, 0xD7, 0x35, 0xFB, 0x90, 0xCC, 0x55,
-    0x22, 0xE5, 0x41, 0xD8, 0x23, 0x22, 0xCB, 0xDC, 0xA6, 0x37, 0x6F, 0x36, 0x47, 0x8C, 0x3D, 0x43,
-    0x0A, 0xE5, 0x1F, 0xA3, 0x30, 0x4B, 0x8A, 0x48, 0x4A, 0xC8, 0x7E, 0x25, 0xB8, 0x50, 0x8A, 0xC9,
-    0x6E, 0x6D, 0xE8, 0xA3, 0xBC, 0x9D, 0xB1, 0x18, 0xBB, 0x94, 0x4D, 0x8C, 0x92, 0xF0, 0xEA, 0x4B,
-    0x05, 0x8A, 0x77, 0xCF, 0x94, 0xF3, 0x6A, 0x23, 0x9D, 0xAA, 0x25, 0x38, 0x89, 0x4A, 0x9C, 0x56,
-    0xB2, 0x55, 0x0D, 0x3A, 0xB9, 0x56, 0x16, 0xA2, 0xB5, 0x64, 0x2B, 0x59, 0x16, 0x93, 0x8A, 0x62,
-    0x4D, 0x56, 0xEB, 0x4B, 0x20, 0xE5, 0x46, 0xA6, 0xF7, 0x7A, 0xB1, 0xC3, 0xB3, 0x1C, 0x81, 0xA8,
-    0xEA, 0xEA, 0x9E, 0x70, 0xBB, 0x6A, 0x65, 0x3F, 0xFE, 0xB9, 0x27, 0x5C, 0x96, 0xED, 0x2A, 0x36,
-    0x47, 0x2E, 0x4D, 0x3B, 0x14, 0xDC, 0x70, 0x52, 0x78, 0x29, 0x1E, 0x6D, 0xCB, 0x86, 0x27, 0x7B,
-    0x59, 0x39, 0xF3, 0x4A, 0xF1, 0xFA, 0xC2, 0x89, 0xD0, 0x09, 0x7F, 0x7C, 0xC9, 0xF7, 0x51, 0x94,
-    0x60, 0x90, 0xBB, 0x13, 0x92, 0xD1, 0x47, 0x55, 0x77, 0x91, 0xD1, 0xFC, 0x49, 0xD8, 0xCF, 0x18,
-    0x24, 0x72, 0xCF, 0xD9, 0x58, 0x22, 0x40, 0x64, 0x82, 0xF1, 0x4C, 0xB0, 0x24, 0xB6, 0x9F, 0x07,
-    0x38, 0x6F, 0x50, 0xA5, 0x56, 0xB5, 0x90, 0xBE, 0x59, 0x8D, 0x1E, 0x04, 0x15, 0x47, 0x41, 0x8F,
-    0xEF, 0xDF, 0x0B, 0x46, 0x97, 0x59, 0x49, 0xF8, 0x54, 0x39, 0xD5, 0x06, 0x78, 0x7B, 0xF7, 0x36,
-    0x68, 0x1E, 0x83, 0x1E, 0x49, 0x92, 0x4F, 0x0E, 0x82, 0x9E, 0x93, 0x05, 0x6E, 0x6F, 0x85, 0xC5,
-    0x7A, 0xA3, 0xA2, 0x35, 0x67, 0x15, 0x26, 0x89, 0x8F, 0xBA, 0xEA, 0x20, 0x0F, 0x7A, 0x92, 0xD9,
-    0x97, 0x9F, 0xA2, 0x3A, 0x2E, 0xDE, 0xCD, 0x54, 0xF6, 0x24, 0x37, 0xF3, 0x13, 0x15, 0x3C, 0x63,
-    0x7B, 0x12, 0x1A, 0xC9, 0x12, 0x9E, 0x56, 0x84, 0xCA, 0xA8, 0x4F, 0x11, 0xB2, 0x78, 0x38, 0x42,
-    0x19, 0x5E, 0x9B, 0x56, 0xBF, 0x4B, 0x7C, 0xBD, 0xC8, 0x33, 0x65, 0x65, 0x25, 0xB6, 0x67, 0xFA,
-    0x75, 0xA3, 0x72, 0xD6, 0x9F, 0xF2, 0x35, 0x69, 0xF0, 0x8E, 0x7A, 0xE8, 0xE4, 0x3E, 0x29, 0x9D,
-    0x7A, 0xA9, 0xF6, 0x89, 0xB0, 0x3C, 0x76, 0xB0, 0x9E, 0xE1, 0xC0, 0x2B, 0x2B, 0x6F, 0xA4, 0xC9,
-    0x98, 0x4F, 0x9C, 0x8E, 0x5E, 0xE4, 0xC3, 0xA7, 0xD2, 0x3F, 0xB4, 0x7C, 0xD2, 0x55, 0x43, 0x36,
-    0xDD, 0xA2, 0x5C, 0x70, 0xA0, 0x3D, 0x3A, 0x8E, 0xCF, 0x20, 0xD7, 0x29, 0x3D, 0x98, 0x63, 0x79,
-    0x20, 0x8D, 0xEA, 0x70, 0x2C, 0xA8, 0xD4, 0x0D, 0xFE, 0x1D, 0xB6, 0x3C, 0xE8, 0x01, 0x94, 0x0B,
-    0x0F, 0xF4, 0x48, 0x98, 0x83, 0x82, 0x99, 0x69, 0xCF, 0x40, 0xE7, 0x0D, 0x9F, 0x23, 0x30, 0x45,
-    0x25, 0x8E, 0xF2, 0x2B, 0x31, 0x6B, 0xE8, 0xEB, 0xB1, 0xF5, 0x78, 0xBA, 0x24, 0x56, 0x17, 0xC5,
-    0x22, 0x9E, 0x07, 0x7B, 0x8A, 0xDC, 0x39, 0xA5, 0x3A, 0xB3, 0x25, 0x22, 0x9B, 0x32, 0x66, 0xC9,
-    0x62, 0xB1, 0xC0, 0xC7, 0x8B, 0x8D, 0x4C, 0x93, 0x38, 0x25, 0xF1, 0x50, 0x84, 0x38, 0xD6, 0xA7,
-    0x95, 0x24, 0xD7, 0xC6, 0x4C, 0xE7, 0xFD, 0x7F, 0x16, 0xB0, 0x8A, 0xED, 0xB0, 0x8F, 0x13, 0x70,
-    0x1D, 0x03, 0x4B, 0x13, 0xC6, 0x16, 0x42, 0xB2, 0x65, 0x22, 0x1F, 0x64, 0x62, 0xAE, 0xE0, 0x3F,
-    0x7D, 0x35, 0x69, 0xC9, 0xBA, 0xE6, 0x8A, 0xE5, 0x9F, 0xC1, 0x6E, 0x46, 0xC2, 0x33, 0x08, 0x83,
-    0x11, 0xBF, 0x4B, 0xB1, 0x81, 0x59, 0x68, 0x48, 0x1D, 0x27, 0x30, 0xD4, 0x90, 0x95, 0xCF, 0x49,
-    0xAB, 0x9E, 0x78, 0xB0, 0xBF, 0x11, 0x76, 0x2F, 0x06, 0xF9, 0xAC, 0xE4, 0xA6, 0x00, 0xE5, 0x24,
-    0xA0, 0x6E, 0x61, 0xD2, 0x26, 0x85, 0xBB, 0xC8, 0xB5, 0x48, 0x48, 0x0C, 0xEA, 0xF1, 0x00, 0xFF,
-    0x77, 0x69, 0x5D, 0x42, 0x79, 0x26, 0x21, 0x03, 0xC4, 0xA2, 0x5C, 0x9B, 0x37, 0xFD, 0x1A, 0xA3,
-    0x1D, 0x39, 0xA7, 0x43, 0xAA, 0x10, 0xC5, 0x43, 0x38, 0x53, 0x1E, 0xE6, 0x3A, 0x18, 0xCD, 0x5A,
-    0x11, 0xCE, 0x32, 0xDA, 0x46, 0x62, 0x0E, 0x67, 0x8E, 0xEB, 0x48, 0xE7, 0x44, 0xB5, 0x2B, 0x5D,
-    0xA6, 0x50, 0xF7, 0x59, 0x23, 0xD4, 0x55, 0x6F, 0xC4, 0x29, 0xF5, 0x5D, 0x92, 0x4F, 0x74, 0xE0,
-    0xFE, 0xAB, 0x97, 0xAE, 0x80, 0x6F, 0x6D, 0xFA, 0x2D, 0xEE, 0xCE, 0x0D, 0xC3, 0x6C, 0x54, 0x82,
-    0xA4, 0x13, 0x15, 0x11, 0xA0, 0x45, 0x17, 0xA5, 0x5D, 0x32, 0x7E, 0x79, 0x93, 0x96, 0xA1, 0xF4,
-    0xCB, 0x0E, 0xB4, 0xF2, 0xCB, 0xBE, 0xE0, 0x13, 0x69, 0xEF, 0x77, 0x97, 0x8D, 0x5C, 0xE1, 0xDE,
-    0xA0, 0x17, 0x9F, 0x0B, 0x29, 0x6B, 0x69, 0xAF, 0x56, 0xB9, 0x46, 0xD8, 0x11, 0xEA, 0x43, 0xDF,
-    0xA1, 0x1D, 0x9E, 0x0D, 0x70, 0x4C, 0xDB, 0x27, 0x85, 0xC2, 0xFF, 0xC5, 0xED, 0x06, 0x6F, 0x96,
-    0x07, 0x38, 0x66, 0x93, 0x79, 0xD6, 0x35, 0xEE, 0xE3, 0xAA, 0xE4, 0x66, 0x16, 0x9D, 0x76, 0x19,
-    0x15, 0xEB, 0xB1, 0x56, 0xBD, 0x5E, 0x1B, 0x02, 0x9A, 0x3B, 0xE9, 0x19, 0x95, 0xEE, 0x72, 0x06,
-    0xA6, 0xF1, 0x44, 0x99, 0x96, 0x9C, 0xB6, 0xBC, 0x2D, 0xD9, 0xA2, 0x83, 0x83, 0x62, 0x24, 0x4B,
-    0xD5, 0x2F, 0x4F, 0x02, 0x4D, 0xD8, 0x6B, 0x64, 0xFD, 0xA5, 0xA7, 0xF5, 0xF6, 0x07, 0x47, 0x75,
-    0x1C, 0xEC, 0x67, 0xD4, 0x21, 0xB8, 0x40, 0x48, 0xD9, 0xFB, 0x8E, 0x10, 0x99, 0xCA, 0x83, 0x91,
-    0xCE, 0xFE, 0xA9, 0xEC, 0xA0, 0x3C, 0x18, 0xF8, 0xC8, 0x28, 0x0E, 0x48, 0xC3, 0x7D, 0x43, 0x13,
-    0xC5, 0x0B, 0xB6, 0xB4, 0x32, 0x87, 0x4B, 0xE2, 0xCF, 0x85, 0xDD, 0x3B, 0x70, 0xDA, 0xBD, 0x25,
-    0xB1, 0x0E, 0x96, 0x3A, 0xD6, 0xAD, 0x4A, 0x97, 0x29, 0xE2, 0xC7, 0x40, 0xF2, 0xE1, 0x95, 0x29,
-    0xEB, 0x13, 0x9C, 0x8B, 0x80, 0x71, 0x07, 0x57, 0xC7, 0xEA, 0x56, 0x1A, 0x75, 0xCA, 0xFF, 0x4E,
-    0xFB, 0x73, 0x3D, 0x6E, 0xD8, 0x2A, 0x25, 0xF6, 0x50, 0xE2, 0x8E, 0x9A, 0xC8, 0x0B, 0x52, 0x3C,
-    0x6D, 0xDE, 0x09, 0x83, 0xB5, 0xEB, 0xF8, 0x72, 0xE3, 0xB4, 0x8F, 0x8B, 0xFF, 0x2E, 0x2C, 0x1B,
-    0x39, 0xFD, 0x4F, 0x02, 0xFE, 0x05, 0x75, 0x55, 0x31, 0x8F, 0xDE, 0x44, 0x10, 0x1D, 0xDB, 0x82,
-    0x15, 0x58, 0x62, 0xAF, 0x40, 0x08, 0x11, 0x81, 0x29, 0x28, 0x91, 0xDC, 0xD2, 0xAD, 0x05, 0x45,
-    0xCA, 0xA3, 0xCE, 0x3F, 0xA0, 0x0A, 0x05, 0x2D, 0xB7, 0x46, 0x29, 0x28, 0xAE, 0x20, 0x45, 0x7A,
-    0x1A, 0xA8, 0x69, 0x69, 0xB8, 0x5D, 0x38, 0x89, 0x2B, 0x28, 0xE2, 0xF0, 0x15, 0x29, 0x68, 0x4C,
-    0xA0, 0x8F, 0x0F, 0xB9, 0x30, 0x61, 0xED, 0xE1, 0xCD, 0xAC, 0x2F, 0x77, 0x0A, 0xC2, 0xD2, 0x8E,
-    0x3F, 0xDB, 0xBB, 0x33, 0x6F, 0xDE, 0xBC, 0x99, 0x8F, 0xE8, 0x5D, 0xC2, 0xF5, 0x03, 0x56, 0xB1,
-    0xC1, 0x54, 0x09, 0xA6, 0x9E, 0x61, 0x9A, 0x91, 0x0A, 0x72, 0xB1, 0x08, 0xC4, 0x45, 0xE0, 0x72,
-    0x0B, 0xCC, 0x15, 0x33, 0xFF, 0x6D, 0xB1, 0xA8, 0xC5, 0x22, 0xB7, 0x75, 0xD8, 0xC6, 0xD8, 0x6B,
-    0x78, 0x80, 0x65, 0x39, 0xE6, 0x56, 0x71, 0x20, 0x5E, 0x4A, 0x79, 0xA4, 0x8F, 0xC5, 0xD0, 0x91,
-    0x98, 0xCF, 0xC5, 0x84, 0x88, 0x48, 0x8C, 0xEF, 0x25, 0x73, 0x24, 0x78, 0x4C, 0x38, 0xCD, 0xDC,
-    0xDB, 0x2D, 0xF8, 0xA5, 0x59, 0xDD, 0x05, 0x1F, 0x27, 0x3B, 0xFA, 0x1F, 0x67, 0x33, 0x9B, 0xFE,
-    0xA8, 0x14, 0x47, 0x24, 0x21, 0xC8, 0xF5, 0x30, 0xAD, 0xC4, 0xB1, 0xD3, 0x15, 0x50, 0x85, 0x4C,
-    0x41, 0xCC, 0x5B, 0xF2, 0x99, 0x5E, 0xD1, 0x9D, 0x62, 0xFC, 0xCD, 0xED, 0x47, 0xB2, 0xDD, 0xF7,
-    0xC5, 0x4A, 0x7E, 0xEB, 0x98, 0x3C, 0x6F, 0x21, 0xB6, 0x88, 0x3A, 0xD2, 0x5D, 0x16, 0xD4, 0x77,
-    0x05, 0x10, 0xBE, 0x89, 0xB3, 0x05, 0xBE, 0xF1, 0x81, 0x2C, 0x77, 0x7B, 0x36, 0xAD, 0xC4, 0xB3,
-    0x51, 0x52, 0xA2, 0xFD, 0xD2, 0xE8, 0x39, 0x70, 0x23, 0x31, 0xAA, 0xE5, 0x39, 0xCE, 0x56, 0x36,
-    0x1A, 0xCD, 0x1D, 0xFE, 0xAA, 0xDE, 0xC5, 0x37, 0xAB, 0x54, 0xCF, 0x4D, 0xE4, 0xDF, 0x37, 0x9B,
-    0x6A, 0x76, 0x0F, 0x37, 0x00, 0x60, 0x16, 0x02, 0x58, 0xF8, 0x93, 0x53, 0x6A, 0x6A, 0x89, 0x48,
-    0x5E, 0x4C, 0xD9, 0x5F, 0x45, 0x2A, 0xE4, 0x97, 0xAC, 0xB4, 0xAF, 0x33, 0x89, 0x81, 0x17, 0x5E,
-    0xC2, 0x22, 0x8C, 0xEB, 0xA8, 0x93, 0x87, 0xB6, 0xBF, 0xC5, 0xF7, 0xEB, 0x91, 0x9A, 0x9F, 0xE1,
-    0xF7, 0xCF, 0x15, 0xF8, 0xF5, 0x8A, 0xB8, 0xDF, 0x2F, 0x40, 0x73, 0x2D, 0x25, 0x43, 0x25, 0xEF,
-    0xB1, 0xFA, 0x0E, 0x93, 0x53, 0x8C, 0x61, 0x2C, 0xF5, 0x45, 0x18, 0xA9, 0x95, 0x24, 0xC2, 0x40,
-    0xC5, 0xBA, 0xA7, 0xF5, 0x8E, 0x20, 0x19, 0xE8, 0x85, 0xCB, 0xF4, 0x59, 0x21, 0x0D, 0xE0, 0xB6,
-    0x3C, 0x91, 0x03, 0x78, 0xFF, 0xF4, 0xE9, 0xC4, 0xA7, 0x87, 0xCD, 0x7D, 0x34, 0x39, 0x43, 0x09,
-    0x3C, 0x9D, 0x08, 0xCC, 0x2E, 0xF3, 0x66, 0x40, 0x60, 0x29, 0xCE, 0xD7, 0xBD, 0x3A, 0x35, 0x9C,
-    0x16, 0xCB, 0xFE, 0x60, 0x87, 0xFD, 0x2B, 0x92, 0xF8, 0xDE, 0xC6, 0x4F, 0xFD, 0xF9, 0xEC, 0x6F,
-    0xAF, 0x67, 0x7E, 0x80, 0xE3, 0xB1, 0x90, 0x22, 0x59, 0x44, 0x01, 0xE0, 0xEC, 0x28, 0x0B, 0xF6,
-    0x13, 0xA2, 0x37, 0x78, 0x41, 0x3A, 0x3C, 0xA2, 0x90, 0xCF, 0xBA, 0xC0, 0x0F, 0x20, 0x2B, 0x16,
-    0x29, 0x22, 0x1D, 0x90, 0x3A, 0x90, 0xBF, 0x40, 0x69, 0xB9, 0xE4, 0x05, 0xC5, 0x0A, 0x1B, 0x54,
-    0xE0, 0x36, 0x17, 0x21, 0xEB, 0x67, 0x44, 0xAF, 0x12, 0x7D, 0xAB, 0x05, 0x13, 0x05, 0x83, 0xA4,
-    0x6F, 0x44, 0x07, 0x20, 0xF7, 0x96, 0x18, 0x23, 0xC6, 0xC3, 0x94, 0xF2, 0xAE, 0xE5, 0x2F, 0x53,
-    0xC1, 0xAB, 0x49, 0x96, 0x07, 0x93, 0xDC, 0x46, 0xF5, 0x62, 0x47, 0x98, 0xAA, 0xA3, 0x97, 0x97,
-    0x02, 0xC7, 0xEB, 0x98, 0x75, 0x26, 0xAA, 0xAC, 0xE7, 0x62, 0x31, 0xA9, 0x4C, 0xD5, 0x5A, 0x2D,
-    0x05, 0xA3, 0x3A, 0x7C, 0x7B, 0x22, 0x7F, 0x8A, 0xD0, 0x0F, 0x51, 0x18, 0xE8, 0xDD, 0x72, 0x7C,
-    0xDD, 0x70, 0x8F, 0xCC, 0x3A, 0x68, 0x80, 0x82, 0x2E, 0xC8, 0xE4, 0xCE, 0xBA, 0x93, 0x2B, 0x0A,
-    0x33, 0x31, 0x7B, 0x6B, 0x26, 0x4F, 0x6E, 0x70, 0xE4, 0xA3, 0xEB, 0xB8, 0x6B, 0xBF, 0x60, 0x6A,
-    0x7E, 0x42, 0x5D, 0xCF, 0x13, 0xD9, 0xDF, 0x66, 0xA8, 0x65, 0xD2, 0xBE, 0xAB, 0xE0, 0x52, 0xDA,
-    0x48, 0xD0, 0x4A, 0x9D, 0x49, 0xD7, 0x83, 0xEC, 0xEE, 0x3D, 0x7A, 0xDE, 0x78, 0x14, 0x3A, 0x4D,
-    0x59, 0x6C, 0xA1, 0x4A, 0xAD, 0x34, 0xA8, 0x51, 0x29, 0xAB, 0x5A, 0xB4, 0x27, 0x58, 0x78, 0x07,
-    0xAD, 0x7E, 0x54, 0x35, 0xCB, 0xEF, 0x59, 0x3A, 0x94, 0x17, 0x61, 0x4A, 0x18, 0xD1, 0x03, 0xB5,
-    0xBA, 0x28, 0xD5, 0xEA, 0xF8, 0x20, 0xFA, 0x80, 0xFE, 0x7B, 0x69, 0xB1, 0xEC, 0x6B, 0xDA, 0x28,
-    0x17, 0x22, 0xA5, 0xF6, 0x89, 0xB6, 0xD4, 0x0C, 0x32, 0xC8, 0x25, 0xA7, 0x54, 0x37, 0x28, 0x99,
-    0xE7, 0x53, 0x94, 0x2B, 0xF0, 0xE1, 0x1F, 0xEE, 0xF8, 0x8F, 0xCB, 0xE4, 0x27, 0x7E, 0x94, 0x42,
-    0xBD, 0xBA, 0x78, 0xE6, 0xFA, 0xD5, 0x44, 0x77, 0x3C, 0xBC, 0x4D, 0x9D, 0xBD, 0x10, 0x05, 0x98,
-    0xBF, 0xF2, 0x7C, 0xD1, 0xEE, 0x4F, 0x4E, 0x32, 0x72, 0x8D, 0xB4, 0x5D, 0x73, 0x2A, 0xA0, 0xEB,
-    0x83, 0x28, 0xBB, 0x9A, 0x74, 0x42, 0x24, 0xE9, 0x13, 0x3A, 0x6B, 0xFB, 0x9B, 0x84, 0xA4, 0xEB,
-    0x1E, 0xCE, 0x24, 0x64, 0x42, 0x32, 0x39, 0xE0, 0xBB, 0x56, 0x1E, 0x94, 0x93, 0xC9, 0xE6, 0xDC,
-    0xC5, 0x7B, 0x52, 0x66, 0x26, 0xB5, 0xBD, 0xF4, 0x70, 0x1E, 0x3F, 0xB3, 0x3A, 0x88, 0xD7, 0x6E,
-    0x72, 0x31, 0x3F, 0x7B, 0x81, 0x0A, 0x7B, 0x3E, 0x5D, 0xA3, 0x3E, 0xD1, 0x31, 0x91, 0xD3, 0xA9,
-    0x66, 0x3D, 0x70, 0xA6, 0x13, 0xAE, 0xF9, 0x45, 0x5F, 0x5D, 0x2A, 0xB8, 0x15, 0xB9, 0x15, 0x5D,
-    0xFB, 0x15, 0xB2, 0x5A, 0xCC, 0x65, 0xAA, 0x62, 0x88, 0xC9, 0x95, 0x6B, 0x93, 0xDA, 0xE3, 0x47,
-    0x1C, 0xF9, 0xF1, 0x93, 0x45, 0x50, 0x26, 0x8F, 0xE6, 0x0D, 0x6C, 0x55, 0x10, 0x07, 0xE9, 0x15,
-    0xBF, 0x48, 0xB7, 0x54, 0xDC, 0x08, 0xB4, 0xF6, 0x20, 0xE8, 0xCB, 0x45, 0x3D, 0x36, 0xEF, 0x2B,
-    0x96, 0x97, 0x76, 0x2A, 0x30, 0x5D, 0xCC, 0x90, 0x15, 0x22, 0xF2, 0xC0, 0xCC, 0xB7, 0xB3, 0xA6,
-    0xA1, 0x99, 0xE0, 0xB7, 0x1B, 0x74, 0x96, 0xAA, 0x48, 0x40, 0x55, 0x9E, 0x29, 0x53, 0x9B, 0xEF,
-    0xF7, 0xF2, 0x2D, 0x65, 0xA9, 0x84, 0x5F, 0xF3, 0xE3, 0xA2, 0x6A, 0xE1, 0xAB, 0x09, 0x44, 0x22,
-    0x98, 0x4A, 0x66, 0x0C, 0x30, 0xC9, 0x60, 0x85, 0x66, 0xEC, 0x92, 0x87, 0xC0, 0x49, 0x96, 0x4D,
-    0x15, 0x6F, 0xD0, 0x24, 0x90, 0xCB, 0xED, 0xEA, 0x4F, 0xA5, 0x91, 0x16, 0x75, 0x2A, 0xBE, 0xAF,
-    0x39, 0x21, 0xA3, 0xEF, 0x66, 0xCB, 0xCD, 0x87, 0xD0, 0x68, 0xD3, 0x01, 0x0D, 0x8C, 0x0F, 0x30,
-    0x85, 0x6B, 0x64, 0x5A, 0xFF, 0x8F, 0xD1, 0xAF, 0xBA, 0x4F, 0x4F, 0xE8, 0x59, 0xF5, 0xA2, 0xFE,
-    0xD4, 0xB3, 0xC4, 0x48, 0x39, 0x9A, 0x51, 0x90, 0xDB, 0x8E, 0xE5, 0x5F, 0x6D, 0x55, 0x3B, 0x8E,
-    0xDC, 0x46, 0x10, 0xAD, 0x21, 0xA1, 0x25, 0x60, 0xC2, 0xA0, 0x92, 0x75, 0xA0, 0x09, 0x98, 0x2B,
-    0xE1, 0x05, 0x0C, 0x34, 0x1D, 0x3B, 0xF0, 0x1A, 0xF0, 0x26, 0xBE, 0xC4, 0x5E, 0xC0, 0x00, 0x07,
-    0xF0, 0x01, 0xAC, 0x23, 0x38, 0xB0, 0x00, 0x61, 0x14, 0xF8, 0x06, 0x6E, 0xE6, 0x4E, 0x26, 0x77,
-    0xC2, 0xC0, 0xD1, 0x46, 0x04, 0xCC, 0x80, 0xBB, 0x20, 0xBB, 0xF4, 0x5E, 0x15, 0x67, 0xB5, 0xA3,
-    0x35, 0x81, 0xE9, 0x9E, 0x2E, 0xD6, 0xE7, 0xD5, 0xAB, 0xAA, 0xA6, 0x88, 0xC8, 0x4F, 0xF8, 0x49,
-    0xB1, 0x72, 0x0D, 0x0B, 0x96, 0x4C, 0x67, 0xFE, 0xAF, 0x07, 0xAE, 0xDD, 0x81, 0x12, 0x8A, 0xA5,
-    0x1A, 0x4D, 0xE5, 0x20, 0xD9, 0x5F, 0x14, 0x44, 0xFD, 0x61, 0x94, 0x5A, 0x55, 0x5B, 0xC1, 0xB2,
-    0x48, 0x95, 0x72, 0x1D, 0x24, 0x9E, 0x0A, 0x6D, 0xF3, 0x24, 0xD5, 0x22, 0xF5, 0x28, 0xE1, 0x24,
-    0xB1, 0xDF, 0xA9, 0x50, 0x30, 0x49, 0xB5, 0x66, 0xDA, 0x4B, 0xA0, 0x32, 0xAC, 0xF5, 0x24, 0x30,
-    0x4C, 0x22, 0x3B, 0x85, 0x1D, 0x56, 0x43, 0x70, 0x2D, 0x2F, 0x9E, 0x8A, 0xCB, 0x95, 0x0E, 0x08,
-    0x04, 0x6C, 0x66, 0x2D, 0x1D, 0xF6, 0x5E, 0xA4, 0xC4, 0x46, 0xB3, 0x98, 0x76, 0x04, 0x5D, 0xEA,
-    0xA1, 0x52, 0xA0, 0xEC, 0x66, 0xA1, 0xFB, 0x9C, 0x47, 0x58, 0x35, 0x8B, 0xE8, 0x3F, 0x08, 0xA4,
-    0xA7, 0x6A, 0x6D, 0x66, 0x68, 0x01, 0x65, 0x1C, 0x24, 0x4C, 0x25, 0x00, 0x01, 0x7D, 0x1F, 0xF1,
-    0x42, 0x8A, 0x54, 0xAE, 0x12, 0x46, 0x69, 0xA6, 0x78, 0xDA, 0xC1, 0xB9, 0xFE, 0x9D, 0xA4, 0x4C,
-    0x70, 0x62, 0xAA, 0xC8, 0x94, 0xFF, 0x7B, 0x44, 0x1E, 0xA4, 0x4B, 0x04, 0xFD, 0xE3, 0x1D, 0x62,
-    0x15, 0xCA, 0xE7, 0x60, 0x44, 0x10, 0x19, 0x81, 0x41, 0xC3, 0xC4, 0xC9, 0xD2, 0xE4, 0xB1, 0x4C,
-    0xD1, 0x80, 0x36, 0xC3, 0x5E, 0x1F, 0x81, 0xF7, 0xEB, 0x97, 0x59, 0x66, 0x47, 0xAE, 0xC0, 0x46,
-    0xEA, 0x99, 0x2A, 0x88, 0xE2, 0x4A, 0xE7, 0x4C, 0x1B, 0xD9, 0x16, 0x89, 0x6B, 0xB5, 0x90, 0xB9,
-    0x30, 0x71, 0x8D, 0x03, 0xC0, 0x01, 0x6C, 0x24, 0x10, 0xE9, 0x46, 0x14, 0x81, 0x2B, 0x12, 0x06,
-    0x62, 0x08, 0xC3, 0xBC, 0x83, 0x5A, 0x58, 0x08, 0x3C, 0x2C, 0x15, 0x9C, 0x37, 0x4B, 0xAD, 0xB7,
-    0xB7, 0xDD, 0x1A, 0x0C, 0xAF, 0xAF, 0x86, 0x79, 0x36, 0xA8, 0x93, 0xD8, 0xFF, 0x9C, 0xEB, 0xC9,
-    0x72, 0x92, 0xBB, 0xF4, 0x51, 0x3F, 0xA0, 0x98, 0x25, 0xAB, 0x76, 0x08, 0x83, 0xE4, 0xAB, 0x00,
-    0x59, 0x35, 0x16, 0x14, 0xF4, 0xCD, 0xC8, 0xEA, 0x02, 0x64, 0x35, 0xE1, 0x85, 0x74, 0x3D, 0xCA,
-    0x9E, 0x81, 0xE1, 0x5E, 0xAA, 0x19, 0x2F, 0xD0, 0x02, 0xA8, 0x3C, 0x5A, 0xA0, 0xEB, 0xA5, 0x5C,
-    0x32, 0x0A, 0x06, 0x08, 0xE0, 0x01, 0x82, 0x62, 0xC9, 0x08, 0x69, 0xA8, 0x66, 0x0A, 0xD0, 0x2C,
-    0xDB, 0x73, 0xDD, 0x5E, 0xDF, 0xD0, 0x06, 0x4E, 0xF2, 0x15, 0x3B, 0x5D, 0x91, 0xBD, 0xB1, 0x9C,
-    0xB7, 0x08, 0xAE, 0xEE, 0x81, 0x4B, 0xF3, 0x52, 0x1B, 0x1E, 0x8B, 0x06, 0x21, 0x60, 0x3A, 0x88,
-    0x7C, 0x31, 0x7B, 0xC3, 0xE6, 0x81, 0x3A, 0x42, 0xA6, 0x7D, 0x6F, 0xF6, 0xD6, 0xBD, 0x3A, 0x59,
-    0xC6, 0x03, 0xFB, 0x49, 0xFB, 0x37, 0x47, 0x3C, 0x30, 0x62, 0x6F, 0x53, 0x8E, 0x0E, 0x56, 0x94,
-    0x3A, 0x3E, 0x1E, 0xFF, 0x90, 0xDA, 0x27, 0xC4, 0xEA, 0xC3, 0x79, 0x40, 0x87, 0xB0, 0x48, 0x84,
-    0x6E, 0xAF, 0xF2, 0xB4, 0x0D, 0x09, 0xC2, 0xF5, 0x6C, 0x54, 0x2E, 0x2C, 0x5B, 0xC6, 0x3A, 0x16,
-    0xBE, 0xDC, 0x1F, 0x0F, 0xB9, 0xF5, 0x85, 0x31, 0xDE, 0xB1, 0x71, 0x1A, 0x52, 0xED, 0x03, 0xF0,
-    0x27, 0x22, 0xA2, 0x18, 0x23, 0xE5, 0x21, 0x1D, 0xDF, 0x8B, 0xB7, 0x04, 0x9D, 0xA0, 0x03, 0xD5,
-    0xA6, 0x30, 0xFA, 0xB4, 0x54, 0x8F, 0x36, 0xBC, 0xF9, 0xE2, 0xBC, 0xD9, 0xB0, 0x9E, 0x07, 0x55,
-    0xB2, 0xE4, 0xD2, 0xD0, 0xBB, 0xD4, 0xA6, 0x9A, 0xB4, 0xBA, 0xD4, 0xC6, 0x5B, 0xCA, 0xCD, 0x54,
-    0xDD, 0x34, 0xB8, 0x69, 0x61, 0x4A, 0xAF, 0x3D, 0xAF, 0xFC, 0xD4, 0x98, 0x52, 0xF8, 0xD5, 0xD2,
-    0x3E, 0x43, 0x08, 0x0E, 0xC1, 0x5B, 0x93, 0x00, 0x27, 0x77, 0xE4, 0xFE, 0x2B, 0xF5, 0x6A, 0x1E,
-    0x3F, 0x5C, 0x74, 0xF9, 0x5E, 0xDB, 0xC8, 0xFE, 0xD0, 0xDF, 0xE0, 0xC4, 0xBA, 0x6F, 0x30, 0xE6,
-    0xB5, 0xAF, 0x1F, 0x0A, 0x3D, 0x75, 0xC0, 0x91, 0xCF, 0xB2, 0xE0, 0x57, 0x1D, 0xF2, 0x11, 0x0C,
-    0x7E, 0x0B, 0x1A, 0x55, 0xB2, 0x39, 0x5B, 0x91, 0x24, 0x18, 0x19, 0x2B, 0x1F, 0x38, 0xEF, 0x5C,
-    0x9F, 0x2F, 0xCC, 0xAA, 0xFE, 0xC7, 0xF9, 0x8F, 0xEB, 0x2E, 0xB5, 0x17, 0x77, 0x48, 0xC6, 0x33,
-    0x41, 0x7A, 0x9A, 0xD1, 0xB1, 0x36, 0xEB, 0x2F, 0xE2, 0xB5, 0xB2, 0xB7, 0x71, 0x23, 0xC8, 0x13,
-    0xC8, 0xCE, 0x04, 0x79, 0x02, 0xC5, 0x25, 0x41, 0xF5, 0xFF, 0x72, 0xFB, 0xC4, 0x62, 0xFB, 0x5C,
-    0x29, 0x4F, 0x17, 0x9E, 0xBE, 0x50, 0x6A, 0x36, 0xAA, 0x4D, 0xE9, 0xEA, 0x3B, 0x43, 0x86, 0xFE,
-    0x9B, 0x9D, 0x62, 0x75, 0x8A, 0x9D, 0x45, 0x97, 0x42, 0x6C, 0x8C, 0xCB, 0xD5, 0xF1, 0xF2, 0xEA,
-    0xC0, 0xDD, 0x8D, 0xFB, 0x0B, 0xED, 0x87, 0xEB, 0xBB, 0x03, 0x27, 0xB8, 0xEE, 0xE6, 0x97, 0x17,
-    0x4C, 0xAE, 0x2C, 0x2B, 0xEE, 0x00, 0xDC, 0x11, 0x4D, 0x92, 0xB0, 0x82, 0xAE, 0xF3, 0xBB, 0xBB,
-    0x29, 0xFB, 0x1D, 0x2D, 0x78, 0x0A, 0x3D, 0x10, 0x14, 0xB8, 0x3D, 0xBF, 0x9F, 0xB4, 0x6D, 0xC6,
-    0xC0, 0x16, 0x75, 0xEE, 0xCA, 0x74, 0x0E, 0x96, 0xE4, 0x2D, 0xF9, 0x84, 0x56, 0xD4, 0x51, 0xDB,
-    0x7A, 0xC4, 0x96, 0x6B, 0x0E, 0xAD, 0xAF, 0x86, 0x27, 0x2D, 0x6F, 0xB5, 0x1B, 0x79, 0x1A, 0x06,
-    0xC9, 0xE7, 0x67, 0x84, 0x6D, 0x0D, 0xBB, 0x1D, 0xD6, 0xCF, 0x0D, 0x19, 0x6D, 0xD2, 0x7C, 0x0C,
-    0xBD, 0xB8, 0x6D, 0x71, 0x8F, 0xFD, 0xE1, 0x89, 0xB7, 0xAD, 0x4A, 0xF1, 0x1E, 0x37, 0x5F, 0xEE,
-    0x7A, 0xD6, 0x0B, 0x7E, 0x58, 0xE4, 0xAD, 0x5E, 0x44, 0x38, 0x3D, 0x2B, 0x84, 0x33, 0xBE, 0xD5,
-    0x77, 0xA3, 0xFF, 0xF6, 0x33, 0xDC, 0xD7, 0x0E, 0xDA, 0xFD, 0xDB, 0x30, 0x63, 0x58, 0x16, 0xEF,
-    0xED, 0x55, 0xCE, 0xDF, 0x29, 0x4E, 0xA2, 0x1F, 0x26, 0x3F, 0x10, 0x55, 0xB3, 0x7D, 0x32, 0x4D,
-    0x81, 0x17, 0xC7, 0x3B, 0x13, 0xDA, 0xFE, 0x2A, 0xFA, 0xBE, 0x8B, 0xFE, 0xE9, 0xBA, 0xF2, 0x4F,
-    0x16, 0x76, 0x47, 0xC5, 0x2B, 0xFF, 0x0D, 0x98, 0xDA, 0xD3, 0xE2, 0xF1, 0x66, 0x33, 0x4C, 0x07,
-    0x4F, 0x0B, 0x28, 0x7F, 0x8E, 0x1E, 0x4B, 0x5E, 0x7D, 0x5C, 0xBE, 0x2C, 0xEA, 0xF6, 0x21, 0x69,
-    0xBC, 0xC3, 0xC2, 0xC6, 0xA4, 0x77, 0x4D, 0xFD, 0x34, 0xA0, 0x76, 0x6C, 0xFC, 0x58, 0x6C, 0xC7,
-    0xCE, 0x53, 0x2B, 0x1D, 0xF9, 0x9D, 0x45, 0xD8, 0x5B, 0xBC, 0x3D, 0xBF, 0x00, 0xB6, 0x3E, 0x58,
-    0x0B, 0x26, 0x73, 0x69, 0x83, 0xD4, 0xF9, 0x14, 0xC4, 0x77, 0x16, 0xE7, 0x5F, 0x8C, 0x1A, 0xC7,
-    0xFB, 0x9B, 0x08, 0x5F, 0x59, 0x34, 0xFA, 0x4B, 0xAF, 0x02, 0x3F, 0x1D, 0xEF, 0x5B, 0x09, 0xF7,
-    0x37, 0xCF, 0xC0, 0x7E, 0x02,
+static const uint8_t opendyslexic_14_bolditalicBitmaps[39997] = {
+    0xDD, 0x9C, 0xBF, 0xCF, 0xE6, 0xD8, 0x75, 0xDF, 0x3F, 0x24, 0x35, 0x43, 0x5B, 0x44, 0x7C, 0x55,
+    0x64, 0x0D, 0x64, 0x37, 0x00, 0x5D, 0xA4, 0x70, 0xE2, 0x38, 0x6C, 0x5C, 0xA4, 0xB0, 0x74, 0x29,
+    0x09, 0x86, 0x4A, 0x4D, 0x31, 0x6F, 0x02, 0x47, 0x85, 0x9B, 0x14, 0xC9, 0xCA, 0xC8, 0xFC, 0x03,
+    0x4E, 0x48, 0x7B, 0x8B, 0x14, 0x29, 0x3C, 0x46, 0xB2, 0x08, 0x10, 0x17, 0xD9, 0x00, 0x32, 0x60,
+    0xCD, 0x16, 0xAB, 0x32, 0x30, 0x24, 0xF1, 0xAE, 0x17, 0xB0, 0x0B, 0x17, 0xA2, 0xA5, 0x28, 0x29,
+    0x5C, 0x88, 0x76, 0xD6, 0x8E, 0xB5, 0x8D, 0xAE, 0x65, 0x4A, 0xE2, 0xCE, 0x5E, 0xF2, 0x9B, 0xE2,
+    0x5C, 0x3E, 0xEF, 0x33, 0xBB, 0x33, 0xD2, 0xDA, 0xC6, 0x26, 0x96, 0x1E, 0xE0, 0x7D, 0x7E, 0xF0,
+    0xE1, 0xCB, 0xE7, 0xDC, 0x73, 0xCF, 0xEF, 0xF3, 0x3D, 0x04, 0x00, 0x7E, 0x0E, 0xF8, 0x15, 0xE0,
+    0xCB, 0xC0, 0x01, 0xC5, 0x0E, 0x55, 0xB2, 0xBF, 0x7A, 0x03, 0xB7, 0x82, 0x8B, 0xD0, 0x2D, 0xE0,
+    0x67, 0x18, 0x02, 0x4C, 0x01, 0x34, 0x52, 0x08, 0x4A, 0x41, 0x75, 0x40, 0xB5, 0x03, 0x09, 0xF8,
+    0x79, 0xE0, 0x43, 0x3C, 0xEB, 0x51, 0x28, 0x50, 0x29, 0x50, 0x2B, 0xE0, 0x14, 0x70, 0x1A, 0xE9,
+    0xD4, 0xE3, 0xD5, 0x33, 0x09, 0xBC, 0x6A, 0x2D, 0x5E, 0x95, 0xE6, 0x4E, 0x95, 0xE6, 0xF6, 0x28,
+    0x35, 0x3B, 0x15, 0x9A, 0x9D, 0xD0, 0xD2, 0xA8, 0x57, 0xAC, 0x35, 0x6A, 0xAD, 0x14, 0xA6, 0xAD,
+    0xD2, 0x3C, 0x24, 0x80, 0x83, 0xA9, 0x07, 0x28, 0x77, 0x04, 0x40, 0x95, 0x0A, 0x7B, 0xD3, 0x6C,
+    0xD5, 0x0E, 0x80, 0x5B, 0xAB, 0x04, 0x40, 0x1B, 0x9B, 0x0D, 0x00, 0xBF, 0xB8, 0x15, 0x70, 0x92,
+    0x24, 0x25, 0x5A, 0x7B, 0xB3, 0xE2, 0xED, 0xCD, 0xC2, 0x64, 0x6F, 0x02, 0x54, 0x42, 0x23, 0x40,
+    0x75, 0x14, 0xEA, 0x01, 0x9A, 0x54, 0xDA, 0x2F, 0xB8, 0x54, 0x1D, 0x76, 0xE1, 0xAD, 0xB6, 0x9F,
+    0xF2, 0xAB, 0x4B, 0x40, 0x65, 0xFF, 0xBD, 0xD3, 0x3C, 0xFB, 0x17, 0xA8, 0xD4, 0x2B, 0x00, 0xD4,
+    0xC2, 0xDE, 0x34, 0x47, 0x69, 0xBF, 0xE0, 0xF6, 0xCA, 0x7E, 0xA1, 0x4B, 0xB5, 0xBD, 0xF1, 0x5B,
+    0xB3, 0x5F, 0x38, 0xF9, 0x5C, 0x5E, 0xA8, 0x11, 0xB1, 0x00, 0x30, 0x18, 0x17, 0x12, 0xC0, 0xF3,
+    0x7A, 0x1B, 0x68, 0x24, 0x41, 0x21, 0x29, 0x42, 0x9B, 0x3F, 0xEC, 0xFE, 0x4D, 0x70, 0xEA, 0x0F,
+    0x60, 0x88, 0xD5, 0x0A, 0xA5, 0xC6, 0x36, 0x80, 0x13, 0x13, 0xE0, 0xF5, 0x1F, 0x37, 0x60, 0x92,
+    0x66, 0xC0, 0x08, 0x2D, 0x24, 0xAD, 0xC0, 0x60, 0x2F, 0x77, 0xA5, 0x08, 0x14, 0x52, 0xB0, 0x5F,
+    0xA1, 0x18, 0xF1, 0x4A, 0x74, 0x2B, 0xD2, 0x52, 0x4A, 0xAF, 0x4A, 0xB6, 0xCE, 0xD5, 0x18, 0xD1,
+    0x97, 0x92, 0x34, 0xC3, 0x67, 0xA4, 0x4C, 0x2D, 0xB7, 0xD4, 0x9E, 0x2B, 0xF0, 0x3D, 0x40, 0x91,
+    0xCE, 0x55, 0x7E, 0xF8, 0x95, 0xAB, 0x53, 0xEB, 0x95, 0x7A, 0x87, 0x61, 0x64, 0xDA, 0xA9, 0x36,
+    0x9A, 0x25, 0xE1, 0x03, 0x1F, 0x2B, 0x63, 0x95, 0x28, 0x63, 0x13, 0xBA, 0x19, 0x37, 0x7E, 0xAC,
+    0xDC, 0xC1, 0x57, 0xB1, 0x5B, 0x40, 0x7A, 0xFD, 0x80, 0x52, 0xA9, 0x8D, 0x50, 0x69, 0x14, 0xC0,
+    0x3D, 0xB7, 0x4E, 0x23, 0xA0, 0x4F, 0x6B, 0x84, 0x66, 0xDB, 0x3B, 0x60, 0xFA, 0x83, 0xF0, 0x51,
+    0x68, 0xD2, 0xC7, 0x58, 0x61, 0x78, 0x3D, 0xD6, 0x81, 0x7A, 0xAF, 0x83, 0x07, 0x3F, 0x77, 0xBF,
+    0xB9, 0x52, 0x1D, 0x0C, 0x0A, 0xF8, 0x88, 0x12, 0xA5, 0x60, 0xEA, 0xE9, 0xE2, 0xD3, 0x24, 0x7C,
+    0xDA, 0x80, 0x4E, 0x09, 0xAA, 0xBD, 0x4C, 0xD0, 0x85, 0x6A, 0x85, 0x44, 0x3D, 0x53, 0x47, 0xBA,
+    0x9E, 0x36, 0x94, 0x09, 0x7C, 0xEF, 0x17, 0x50, 0x23, 0x40, 0x8A, 0x50, 0x6A, 0x07, 0x3A, 0x8D,
+    0x50, 0x69, 0x07, 0xBC, 0x76, 0xF4, 0x09, 0xBD, 0x94, 0xAA, 0xE4, 0x52, 0x95, 0xBA, 0x65, 0x9A,
+    0xEB, 0x43, 0x95, 0xFA, 0x5A, 0x9B, 0x53, 0xDF, 0x6A, 0xF4, 0x92, 0x76, 0x26, 0x49, 0x09, 0xE3,
+    0xAE, 0x74, 0xFC, 0x1D, 0x98, 0x1E, 0xF7, 0x27, 0x39, 0xD3, 0xDE, 0xEA, 0x93, 0x0A, 0x8A, 0x5D,
+    0xAA, 0xD5, 0x2B, 0xFA, 0xD4, 0xE8, 0xE3, 0x79, 0x03, 0x80, 0xFA, 0x4D, 0xA0, 0x5D, 0x81, 0x61,
+    0x01, 0xEC, 0xC7, 0x01, 0x97, 0x80, 0xEE, 0xF6, 0x78, 0x30, 0x4D, 0xA7, 0xDE, 0xCF, 0x2F, 0xDB,
+    0x15, 0xF0, 0x0B, 0x66, 0x11, 0xD0, 0x08, 0x85, 0xC8, 0xA7, 0x55, 0x07, 0x50, 0xA7, 0xF3, 0xA9,
+    0x49, 0x80, 0xDB, 0x30, 0x6B, 0x62, 0x4F, 0x6D, 0x7C, 0xCA, 0xD3, 0x7A, 0x79, 0xDA, 0xCE, 0xDF,
+    0xB9, 0x7D, 0x6A, 0x0E, 0xD3, 0x93, 0x4C, 0x62, 0xA5, 0x1E, 0x8A, 0xCF, 0x86, 0xBC, 0x92, 0x17,
+    0x02, 0xD8, 0x8E, 0x64, 0xED, 0x23, 0xD3, 0x6D, 0x2B, 0xE8, 0xD6, 0xCB, 0x37, 0x07, 0x60, 0x5A,
+    0x3C, 0x85, 0x73, 0x0D, 0xF6, 0x8F, 0xDB, 0x49, 0x70, 0x3E, 0x07, 0x40, 0x7D, 0x5E, 0x9D, 0xAD,
+    0xD3, 0x07, 0xCC, 0x0E, 0x5E, 0xFD, 0x5F, 0x17, 0x9F, 0xB1, 0x9E, 0xDB, 0x6F, 0xFD, 0xE5, 0x69,
+    0x88, 0xC0, 0xB4, 0x00, 0xA6, 0x5D, 0xC1, 0x8C, 0x22, 0x95, 0x46, 0xA8, 0xBE, 0x99, 0x35, 0x7B,
+    0xE8, 0xA1, 0x0D, 0xFF, 0xC0, 0x35, 0xF1, 0x4B, 0xEE, 0x7B, 0x6F, 0xCB, 0x49, 0x7A, 0x5D, 0x3A,
+    0xB8, 0xAB, 0x44, 0x21, 0xCD, 0xB5, 0xA4, 0x4F, 0x4B, 0x7A, 0xFD, 0x18, 0xBA, 0xF0, 0xD1, 0x2E,
+    0x84, 0x0F, 0xB9, 0x08, 0xD5, 0x0A, 0xF4, 0x00, 0x9F, 0xED, 0xA1, 0x9B, 0xCD, 0x72, 0x57, 0x09,
+    0x8A, 0x03, 0x10, 0x95, 0xA4, 0x28, 0x29, 0x0D, 0xD2, 0xF1, 0xFC, 0xAB, 0x7A, 0x04, 0x02, 0x86,
+    0xF1, 0xC9, 0xB3, 0xB9, 0x0F, 0x78, 0xE1, 0x34, 0xD6, 0x0A, 0xA5, 0x66, 0x14, 0x19, 0x56, 0x7C,
+    0xC2, 0x27, 0xDA, 0x03, 0x27, 0x78, 0xEE, 0xE6, 0xE6, 0xC6, 0x49, 0x7A, 0x43, 0xD2, 0x1F, 0x4B,
+    0x5A, 0xB9, 0xA9, 0x8E, 0xFA, 0x70, 0x7B, 0xBB, 0x77, 0xC9, 0x9F, 0x1A, 0x5C, 0x9C, 0x82, 0x96,
+    0xF7, 0xA9, 0xCD, 0xAF, 0x59, 0xDF, 0x71, 0x59, 0x87, 0x6A, 0x33, 0xCA, 0xA7, 0x41, 0x33, 0x82,
+    0x81, 0x6C, 0xD0, 0xC9, 0x16, 0x3E, 0x6F, 0xC0, 0xB9, 0x07, 0x27, 0xA3, 0x4F, 0xA1, 0x7A, 0xCA,
+    0x85, 0xCA, 0xF7, 0x5C, 0x68, 0xB4, 0xD7, 0xE1, 0x07, 0x5C, 0xA8, 0xC9, 0x17, 0xC8, 0x0E, 0xE4,
+    0x72, 0xA1, 0xE2, 0xBC, 0x90, 0xDE, 0x7D, 0xA1, 0xBC, 0xA4, 0xEE, 0x07, 0x5C, 0x28, 0x9B, 0xF5,
+    0x2C, 0x83, 0xA7, 0x94, 0x7E, 0xBF, 0x0B, 0x6D, 0x4F, 0x5E, 0xA8, 0x3E, 0x9E, 0x75, 0xA1, 0xF1,
+    0x49, 0x5E, 0x7D, 0x2C, 0x53, 0xFA, 0xD3, 0xF9, 0xF5, 0xCA, 0x2F, 0x97, 0x9F, 0x07, 0x5A, 0x45,
+    0xE8, 0x24, 0xE8, 0xD6, 0x6E, 0xA1, 0x8D, 0x55, 0xC2, 0xAD, 0x4C, 0x34, 0xDB, 0x47, 0xBA, 0x50,
+    0x25, 0xEF, 0x62, 0x29, 0xFF, 0x46, 0x42, 0xBF, 0x1E, 0xC5, 0xF0, 0xFB, 0x69, 0x0A, 0xDD, 0xB7,
+    0xE5, 0x17, 0xB7, 0x4D, 0xBF, 0xB4, 0x56, 0x87, 0xFB, 0xF5, 0x54, 0x68, 0xAC, 0x0F, 0x86, 0xA5,
+    0x52, 0xDF, 0xED, 0xB5, 0x42, 0x23, 0x69, 0x36, 0x77, 0x33, 0x48, 0x2B, 0x4E, 0xDA, 0x28, 0xA5,
+    0x0D, 0x3A, 0xAD, 0x50, 0x4C, 0x0F, 0x4F, 0x0A, 0x9A, 0x44, 0xA1, 0x44, 0xA5, 0x8D, 0x46, 0x2B,
+    0x4E, 0x91, 0x9F, 0x78, 0x6A, 0x90, 0xD1, 0x5B, 0x90, 0x91, 0x03, 0x8D, 0x66, 0x37, 0x3D, 0x76,
+    0x89, 0x56, 0x4A, 0x3E, 0xFF, 0x0D, 0xD2, 0x36, 0x49, 0x2B, 0xBC, 0x70, 0xF4, 0x14, 0x52, 0x02,
+    0x49, 0x01, 0x2F, 0xAD, 0xB4, 0x6F, 0xD6, 0x07, 0x4D, 0x6F, 0x0A, 0xDF, 0x2D, 0x17, 0x6B, 0x74,
+    0x31, 0x2B, 0x8D, 0x00, 0xA7, 0x3E, 0x1B, 0xE0, 0x41, 0x23, 0x85, 0x34, 0x52, 0x4A, 0x3D, 0x95,
+    0xD4, 0x53, 0x4A, 0x8A, 0x48, 0xDA, 0x98, 0xA4, 0x03, 0x2F, 0xA9, 0x6F, 0x2D, 0x3C, 0xE0, 0xB3,
+    0x47, 0x0F, 0xD2, 0x0E, 0x83, 0x14, 0xF0, 0x6F, 0xBD, 0xB6, 0xF1, 0xE3, 0x59, 0xE4, 0x7C, 0x38,
+    0xC5, 0xBD, 0x59, 0x81, 0x36, 0xC1, 0xA0, 0x04, 0x5E, 0x1B, 0xB4, 0x3A, 0xA0, 0x31, 0x47, 0xDB,
+    0x5D, 0xD9, 0xAD, 0xB1, 0x7C, 0x58, 0x68, 0x46, 0x52, 0x64, 0x92, 0x36, 0x06, 0x29, 0xE1, 0xA5,
+    0x1D, 0x27, 0xED, 0xF0, 0x40, 0x6F, 0xDE, 0x6E, 0x66, 0x3B, 0x67, 0xB1, 0x6C, 0x13, 0x14, 0xE6,
+    0xEA, 0x47, 0x0A, 0xED, 0xD0, 0x7E, 0x23, 0x52, 0xEC, 0x3E, 0xD0, 0x7E, 0xF5, 0xA0, 0x38, 0xDC,
+    0x4A, 0xBB, 0xF8, 0x50, 0x1C, 0xA5, 0x68, 0xBF, 0xF3, 0xE0, 0xF8, 0x0D, 0x49, 0x6A, 0x64, 0x4C,
+    0xD4, 0xF2, 0x2F, 0x1E, 0x4D, 0xEA, 0x29, 0x34, 0x66, 0xB6, 0xF8, 0x35, 0x5B, 0xA7, 0x46, 0xD7,
+    0x3E, 0xAE, 0x92, 0x44, 0x2D, 0x1D, 0x46, 0x8C, 0x7B, 0xFC, 0xE8, 0xB7, 0x69, 0x67, 0xA0, 0xBB,
+    0x35, 0x91, 0x23, 0x30, 0xE9, 0x21, 0x48, 0x07, 0x48, 0x1A, 0x0B, 0x49, 0xA1, 0xB8, 0xC7, 0x70,
+    0xB1, 0x9E, 0xC3, 0x5C, 0x80, 0x42, 0xFD, 0xB0, 0x51, 0x70, 0x27, 0x3F, 0xE9, 0xF2, 0x52, 0x23,
+    0x83, 0xD4, 0x73, 0x37, 0xAF, 0xF4, 0x81, 0x02, 0x4C, 0xC6, 0x39, 0x8D, 0x38, 0x69, 0x35, 0x1F,
+    0x60, 0x26, 0xBA, 0x5D, 0x2E, 0x4A, 0x3F, 0xFC, 0xE6, 0xDB, 0xE0, 0x64, 0xA6, 0x52, 0x0B, 0x9D,
+    0x24, 0x2A, 0xC5, 0x6E, 0xC3, 0x6F, 0x68, 0xAC, 0x0F, 0xDC, 0xC6, 0x34, 0xA3, 0xBE, 0x49, 0xB4,
+    0x11, 0x85, 0xFA, 0xA0, 0xD1, 0xAB, 0x9A, 0x8D, 0xD9, 0x95, 0x74, 0x40, 0x2B, 0x8D, 0xD0, 0x1D,
+    0x59, 0x99, 0x9C, 0xA4, 0xAF, 0x49, 0xFA, 0x0B, 0x49, 0xDB, 0x8B, 0xAF, 0x2A, 0x99, 0x3C, 0x16,
+    0xEA, 0x4D, 0x83, 0x87, 0xD9, 0x2C, 0x7C, 0xB7, 0x99, 0x60, 0x35, 0x87, 0xF9, 0xA8, 0x4A, 0x81,
+    0x42, 0x33, 0x28, 0xC2, 0xB0, 0x81, 0x4F, 0xD0, 0xC9, 0xC4, 0xAD, 0x51, 0xA0, 0x32, 0x77, 0x5C,
+    0x5A, 0x3C, 0xA8, 0x99, 0x42, 0x12, 0xF8, 0xD5, 0xAD, 0x34, 0x1B, 0x53, 0x8F, 0x70, 0x2B, 0x6D,
+    0x2C, 0x44, 0xA1, 0x7E, 0x5A, 0x6C, 0x6D, 0x78, 0x1D, 0x5C, 0xA4, 0xF4, 0x00, 0xCD, 0xDD, 0x8A,
+    0x8F, 0x68, 0x6C, 0x76, 0xDC, 0x86, 0x02, 0x1A, 0x5D, 0xA2, 0x5B, 0x0B, 0x2D, 0xAD, 0x68, 0x25,
+    0x2D, 0x48, 0x4A, 0x39, 0x2C, 0xEC, 0xA4, 0x11, 0x7E, 0xC6, 0x16, 0x78, 0x57, 0x23, 0xD4, 0x59,
+    0xD2, 0x77, 0x18, 0xFE, 0x74, 0x8A, 0xB4, 0x11, 0x51, 0x25, 0x9A, 0x88, 0x87, 0x89, 0x66, 0xA1,
+    0x89, 0xEC, 0x20, 0x5C, 0xA0, 0x8B, 0xEC, 0x34, 0x07, 0xEE, 0xED, 0xCF, 0x98, 0xAC, 0x26, 0x6A,
+    0x49, 0x81, 0xD6, 0x14, 0xFE, 0xD0, 0xC5, 0x8A, 0xD5, 0x3B, 0xCD, 0x37, 0xFF, 0xB9, 0x82, 0x49,
+    0x74, 0x2B, 0xED, 0x54, 0x92, 0x7A, 0x9E, 0xD7, 0x71, 0x89, 0x55, 0xEA, 0x83, 0xE6, 0xC0, 0xED,
+    0x74, 0x3B, 0x3E, 0x31, 0x25, 0x94, 0xDE, 0x1B, 0x60, 0x95, 0xEA, 0x2B, 0xD1, 0x08, 0x27, 0x5A,
+    0xE1, 0x0F, 0x86, 0xE3, 0xD6, 0x2E, 0x6A, 0xA6, 0xDD, 0xA9, 0x14, 0xF0, 0x89, 0x46, 0xE1, 0xA9,
+    0x97, 0x00, 0x78, 0xF1, 0xF3, 0xF6, 0xF5, 0x86, 0x13, 0x85, 0x66, 0x3B, 0xBF, 0x47, 0x11, 0xBF,
+    0x53, 0x6B, 0xE4, 0xB9, 0x7B, 0x76, 0xE6, 0x3D, 0x80, 0x7A, 0xE1, 0x74, 0xDE, 0x75, 0x0E, 0x84,
+    0x57, 0xA8, 0x65, 0xD6, 0x22, 0x41, 0x2D, 0xCD, 0x30, 0x68, 0x07, 0x06, 0x2D, 0x80, 0xD7, 0x43,
+    0xC0, 0x4B, 0x0F, 0x61, 0x90, 0xF4, 0x90, 0x3B, 0x93, 0xA4, 0x87, 0xDC, 0xB5, 0x70, 0xFC, 0xAE,
+    0xB4, 0x01, 0x8D, 0x51, 0xF8, 0x82, 0xD1, 0xF9, 0xF7, 0x78, 0xEE, 0xC5, 0xD7, 0x96, 0x5A, 0x3A,
+    0x90, 0x14, 0xBD, 0xA4, 0xE2, 0x3E, 0x57, 0x51, 0xFF, 0xCF, 0x48, 0xB1, 0x91, 0x54, 0x48, 0x8A,
+    0xFE, 0x78, 0xF4, 0x32, 0xDC, 0x31, 0x7B, 0x3A, 0x5B, 0xD6, 0x00, 0xD0, 0x6A, 0x06, 0x5A, 0xED,
+    0x40, 0x69, 0xD6, 0xC5, 0x6B, 0xE7, 0xA4, 0x32, 0x93, 0xD9, 0x68, 0x07, 0xEE, 0x2A, 0xC1, 0x5D,
+    0x29, 0x71, 0x57, 0xD2, 0x7E, 0x57, 0xD2, 0x71, 0xCF, 0x49, 0x7A, 0x48, 0x2B, 0x3D, 0x04, 0x6F,
+    0xAB, 0x79, 0x13, 0xE0, 0x5F, 0x3E, 0xC1, 0xC3, 0xE7, 0x1F, 0x02, 0x83, 0xAD, 0x5B, 0x23, 0x9D,
+    0x6D, 0xEB, 0xC3, 0x2E, 0xD2, 0x8E, 0xA8, 0xE7, 0xA1, 0x99, 0x3C, 0xF3, 0x47, 0xE6, 0x0E, 0x6F,
+    0x45, 0xC2, 0xDC, 0xA1, 0x42, 0x36, 0x33, 0x3C, 0x38, 0x80, 0x49, 0x23, 0x74, 0x9A, 0xC9, 0x5A,
+    0x31, 0xAC, 0xA7, 0x71, 0x46, 0x0B, 0xD0, 0xDA, 0x8A, 0x2E, 0x16, 0xA6, 0x78, 0x66, 0xA6, 0x69,
+    0x81, 0xA8, 0xC5, 0x5C, 0xE6, 0x30, 0x6F, 0x2F, 0x50, 0x69, 0x06, 0x9E, 0xBB, 0xF0, 0xF5, 0xCE,
+    0xE7, 0x2D, 0x84, 0xD4, 0x61, 0xCC, 0x53, 0x02, 0x1A, 0x8D, 0xED, 0x02, 0xA5, 0x7A, 0xBA, 0xDE,
+    0x8C, 0xCC, 0x66, 0xDE, 0xA9, 0x0E, 0x34, 0xF1, 0xC1, 0x17, 0xF9, 0x79, 0x8A, 0xBD, 0xD5, 0x58,
+    0x05, 0xFC, 0x4B, 0x7F, 0xB8, 0xF2, 0x2B, 0xD4, 0x71, 0x75, 0x7D, 0x13, 0xD0, 0x4F, 0x10, 0xD9,
+    0x68, 0xBF, 0x1A, 0x1C, 0x5D, 0x5F, 0xEE, 0xFF, 0xB8, 0x8A, 0x75, 0xC4, 0x7F, 0x4D, 0x47, 0xB1,
+    0x53, 0xED, 0x9D, 0xFE, 0x58, 0x23, 0x7E, 0x99, 0x5E, 0xD3, 0x42, 0x25, 0x5B, 0xBF, 0x5F, 0xE1,
+    0xDE, 0x49, 0x1A, 0xB4, 0x9A, 0xEF, 0x7C, 0xC1, 0xB2, 0x2F, 0xF5, 0x66, 0x71, 0xCF, 0x6C, 0xB5,
+    0x07, 0x3A, 0xFB, 0xC8, 0xF3, 0xFA, 0xDC, 0x93, 0xAB, 0x9E, 0x42, 0xCE, 0xB2, 0xA1, 0xCA, 0xB9,
+    0x59, 0xB8, 0x08, 0x84, 0xD7, 0x0C, 0x4C, 0xD3, 0x02, 0x85, 0xFC, 0x02, 0xD5, 0xD1, 0x45, 0x68,
+    0x52, 0x17, 0xA1, 0x5D, 0xBB, 0x08, 0x3E, 0x76, 0x11, 0xA6, 0xD0, 0xAD, 0x14, 0x1A, 0xDB, 0x95,
+    0x4A, 0xB4, 0x1B, 0x8D, 0x6E, 0x1E, 0x6C, 0x38, 0x65, 0xD3, 0xAC, 0x74, 0x95, 0x75, 0xA4, 0x4A,
+    0x92, 0xF6, 0x46, 0xD0, 0xEE, 0xEE, 0x80, 0xF6, 0xF0, 0x09, 0xDA, 0x63, 0xDA, 0xA0, 0x15, 0xB5,
+    0xF4, 0x26, 0x66, 0xD5, 0xCD, 0x48, 0xD8, 0x62, 0xDA, 0x0D, 0xBF, 0x30, 0x05, 0xA6, 0xB1, 0x12,
+    0xE5, 0x81, 0xDB, 0x70, 0x91, 0x61, 0x66, 0x0A, 0xA5, 0x3E, 0xFE, 0x60, 0xC7, 0x49, 0x9A, 0xCD,
+    0xE9, 0x95, 0xCA, 0xAE, 0x4F, 0x09, 0x1F, 0x19, 0xB6, 0x42, 0x23, 0x3E, 0x36, 0x3B, 0x85, 0x46,
+    0x1F, 0x71, 0x07, 0xFA, 0xFA, 0x3F, 0xD3, 0x5A, 0x4B, 0x52, 0xE8, 0x94, 0xF5, 0x47, 0xB1, 0x92,
+    0x64, 0xA6, 0x2F, 0x3B, 0xD2, 0xAB, 0xC7, 0x0B, 0xFA, 0xA6, 0xB1, 0x72, 0xC1, 0x64, 0x17, 0x27,
+    0x29, 0x50, 0x49, 0xDA, 0x40, 0x7A, 0xEB, 0x35, 0xF0, 0x1A, 0x81, 0x46, 0x33, 0xD9, 0xB5, 0x82,
+    0xDF, 0x2D, 0x63, 0x0F, 0x00, 0xB6, 0x0F, 0x4E, 0x17, 0x13, 0x7E, 0x7E, 0x9F, 0x77, 0xF2, 0x3C,
+    0x39, 0x52, 0x8C, 0x0C, 0x7A, 0xFC, 0xD9, 0xCD, 0x2A, 0x03, 0x3D, 0x5E, 0xE6, 0xC2, 0x24, 0x91,
+    0x29, 0xC4, 0x3E, 0x54, 0x96, 0x73, 0x37, 0x3A, 0x75, 0x36, 0xD3, 0xA9, 0xDE, 0xCE, 0x30, 0x12,
+    0xCD, 0xD0, 0x4A, 0x3D, 0xD3, 0xC2, 0x20, 0x2A, 0xF5, 0x74, 0x09, 0x97, 0xC0, 0xAF, 0x0C, 0x11,
+    0x86, 0x50, 0x5A, 0x99, 0xC6, 0xED, 0x50, 0x27, 0x73, 0x4F, 0xB1, 0x50, 0x00, 0x8D, 0x6E, 0x87,
+    0x7A, 0xC7, 0x47, 0xF0, 0xB1, 0x50, 0xA0, 0x54, 0x68, 0x0E, 0x18, 0x76, 0xFC, 0x56, 0x3C, 0xB0,
+    0x60, 0x47, 0xEA, 0x6B, 0x2B, 0x5E, 0x74, 0xF6, 0x8B, 0x56, 0xD2, 0xA8, 0x2C, 0xDB, 0x6C, 0x8D,
+    0x51, 0x93, 0x11, 0x08, 0x2F, 0x3E, 0xCA, 0x5B, 0x75, 0xEE, 0x71, 0x2D, 0x29, 0xD2, 0x1C, 0x2F,
+    0xDF, 0xCB, 0xC1, 0x56, 0x8E, 0x65, 0xBB, 0xF5, 0xA2, 0x9B, 0xF8, 0xEF, 0xDC, 0x98, 0x81, 0x9C,
+    0x61, 0x92, 0x42, 0x8E, 0xDB, 0x0A, 0x99, 0x2F, 0x1A, 0x2F, 0x41, 0x91, 0x55, 0x41, 0x9A, 0x03,
+    0xC0, 0x1D, 0x37, 0x37, 0xF7, 0x70, 0xA7, 0x37, 0xD1, 0x82, 0xBF, 0x7A, 0x1E, 0x2E, 0xE5, 0x9B,
+    0x05, 0x78, 0xF4, 0xAA, 0x22, 0x95, 0x2E, 0x16, 0xCA, 0x7C, 0x50, 0xA5, 0x9B, 0x33, 0xD9, 0x34,
+    0x23, 0x64, 0x65, 0x1C, 0xCB, 0x02, 0x26, 0x69, 0xB6, 0x28, 0x27, 0x5B, 0x83, 0xEB, 0x03, 0x1B,
+    0xC0, 0x34, 0x5F, 0xE8, 0xB2, 0x85, 0x0D, 0x91, 0x9C, 0xC4, 0x65, 0x1B, 0x3C, 0xC4, 0x8B, 0xA9,
+    0x72, 0x07, 0xA7, 0x2D, 0x2B, 0xB3, 0x7E, 0xC3, 0xDD, 0xD7, 0x3E, 0xDF, 0xDB, 0xAE, 0xDA, 0xF3,
+    0x42, 0x2B, 0xE9, 0xA0, 0x56, 0xF6, 0xD3, 0x0F, 0xF9, 0x45, 0xBC, 0x7A, 0xA0, 0xB6, 0x7F, 0x32,
+    0x51, 0x6B, 0x0F, 0x2E, 0x17, 0xC6, 0xF2, 0xAC, 0x5A, 0x7D, 0xF1, 0x5B, 0x30, 0x45, 0x3A, 0xBD,
+    0xED, 0x44, 0x29, 0x2D, 0x8A, 0x78, 0x1D, 0x4E, 0x94, 0x93, 0x16, 0x45, 0xF0, 0x87, 0x53, 0x4F,
+    0x93, 0xD0, 0xD1, 0xFF, 0xA4, 0xC5, 0x5B, 0x59, 0x8D, 0x35, 0x56, 0x56, 0x97, 0x72, 0xBA, 0x50,
+    0x33, 0x9E, 0xEA, 0x51, 0xAA, 0xC7, 0x99, 0x54, 0x0D, 0x0B, 0x3E, 0x52, 0xAA, 0x2F, 0x34, 0xE2,
+    0x12, 0x6E, 0x87, 0x21, 0xDA, 0xB1, 0x50, 0x28, 0xE0, 0x0E, 0x1A, 0x33, 0x67, 0x7E, 0xA3, 0x50,
+    0x28, 0x34, 0xE3, 0x64, 0xC7, 0x36, 0x7C, 0xA2, 0xD0, 0x8C, 0x16, 0x1A, 0x51, 0xEB, 0xE5, 0x9B,
+    0x21, 0x4B, 0xD5, 0x62, 0x92, 0x36, 0xD6, 0x26, 0x5C, 0x9D, 0xCE, 0x50, 0x5B, 0x0A, 0x95, 0x24,
+    0x1D, 0xB4, 0x02, 0xAD, 0x68, 0xA3, 0x56, 0xA8, 0x34, 0xD3, 0xC9, 0x8E, 0x6D, 0x4C, 0x89, 0x5A,
+    0x0B, 0x54, 0x6F, 0x81, 0x02, 0xC3, 0x42, 0xB7, 0xE2, 0x12, 0x95, 0x40, 0x23, 0xC3, 0x4C, 0x17,
+    0x71, 0x89, 0xEA, 0xA0, 0x50, 0xCF, 0x14, 0xF0, 0x11, 0xB7, 0x51, 0x1F, 0x94, 0xEA, 0xB1, 0xA2,
+    0x4E, 0x97, 0x70, 0x07, 0x95, 0xFA, 0xC2, 0x92, 0x5D, 0x4B, 0x73, 0xEF, 0xBE, 0x76, 0x26, 0x54,
+    0xCB, 0xAD, 0x6F, 0x2D, 0x32, 0xE7, 0xB7, 0xAB, 0x14, 0x6C, 0x8A, 0xEF, 0xF9, 0xBE, 0xCB, 0xDF,
+    0xF7, 0x17, 0x59, 0xC8, 0xA2, 0x9B, 0xD3, 0xBD, 0x36, 0x71, 0x11, 0x98, 0xAC, 0x09, 0x39, 0xC8,
+    0xB6, 0xCD, 0x36, 0xA9, 0x2A, 0xF3, 0xF7, 0xEB, 0xAD, 0x02, 0x98, 0x1F, 0xA3, 0x4D, 0x50, 0xBE,
+    0xF9, 0x82, 0x02, 0x96, 0xE2, 0xE4, 0x98, 0xCE, 0x94, 0x87, 0x56, 0x5A, 0xA1, 0x32, 0x4F, 0xF6,
+    0x93, 0xD3, 0xDB, 0xD7, 0x66, 0xAF, 0x8B, 0x8D, 0x7A, 0x5C, 0xAA, 0x35, 0x52, 0xEF, 0xB5, 0x46,
+    0x2A, 0x55, 0x0A, 0xA0, 0x97, 0x14, 0x60, 0xFA, 0xAA, 0x02, 0xF8, 0x6F, 0x6B, 0x86, 0xF6, 0x6D,
+    0xCD, 0xD0, 0xEC, 0x39, 0x34, 0xB5, 0x3A, 0x60, 0x3C, 0x2B, 0x56, 0x78, 0x45, 0xA0, 0x53, 0x04,
+    0x9C, 0x36, 0x72, 0x00, 0x49, 0x79, 0x9E, 0x24, 0xAB, 0x18, 0x46, 0xF0, 0xDF, 0xD5, 0x01, 0x2E,
+    0x79, 0x2D, 0x34, 0x6A, 0xB4, 0x53, 0x69, 0x94, 0xE6, 0x42, 0x73, 0xAB, 0xC4, 0x14, 0x2B, 0xCB,
+    0xA4, 0x14, 0xB2, 0xBB, 0xEE, 0x62, 0xFE, 0x54, 0x1D, 0xA7, 0xC1, 0xC8, 0x95, 0xD8, 0x77, 0x7F,
+    0x6A, 0xB7, 0xCC, 0xB4, 0xA7, 0x7D, 0x4A, 0x79, 0xF7, 0x2A, 0x3D, 0x7A, 0x75, 0x6F, 0x25, 0xC5,
+    0x29, 0xD7, 0x2C, 0x8E, 0x56, 0xD2, 0x3A, 0x65, 0x63, 0x13, 0x41, 0x91, 0x26, 0x97, 0xA6, 0xBD,
+    0xC0, 0x1F, 0x14, 0xDA, 0xA9, 0xB4, 0xD2, 0x68, 0xA5, 0xD5, 0x8C, 0xD7, 0x82, 0x04, 0xD2, 0xD8,
+    0x58, 0x14, 0xCD, 0xA0, 0x05, 0xAF, 0x54, 0x49, 0x3D, 0x52, 0xEC, 0x2C, 0x06, 0x7E, 0x5D, 0x8A,
+    0x74, 0xDF, 0xD3, 0xA7, 0x0F, 0x8D, 0xE8, 0x1B, 0xC7, 0xF4, 0xAD, 0x9D, 0xFA, 0xF0, 0x92, 0x5F,
+    0xE9, 0x36, 0xE9, 0xBB, 0x0A, 0xE8, 0x6B, 0xD2, 0x57, 0x44, 0x25, 0xA7, 0xDD, 0x6F, 0x74, 0xC9,
+    0xEB, 0xDB, 0x9A, 0x51, 0x94, 0x9C, 0xA8, 0xF4, 0x6B, 0xDA, 0x86, 0x44, 0xBB, 0x37, 0xFA, 0x5D,
+    0x2D, 0x28, 0xB6, 0xBB, 0x53, 0x5F, 0x29, 0x0C, 0x71, 0x48, 0xB4, 0x2A, 0xF4, 0x09, 0x45, 0xA6,
+    0x0D, 0xDC, 0x59, 0x3F, 0xA8, 0x76, 0x78, 0xF4, 0x0A, 0x4D, 0x02, 0x45, 0x5C, 0xA2, 0x50, 0xC4,
+    0xAD, 0x94, 0x5A, 0xE9, 0x22, 0x95, 0x36, 0x7C, 0xA4, 0x56, 0xC2, 0x2F, 0x34, 0x4A, 0x4C, 0x01,
+    0xA7, 0x84, 0x02, 0xAD, 0xF6, 0x42, 0x23, 0x5E, 0x47, 0x29, 0xF0, 0xDF, 0x53, 0x25, 0x18, 0xFE,
+    0x52, 0xF5, 0x01, 0xFA, 0xB6, 0x9A, 0x1D, 0xF4, 0x6D, 0x7D, 0x3A, 0x51, 0xEA, 0x8F, 0xF5, 0x5F,
+    0x37, 0x2A, 0xCD, 0xFA, 0xD6, 0x4A, 0xA5, 0x20, 0x63, 0x9B, 0xB4, 0xE0, 0x34, 0x9A, 0x57, 0xE8,
+    0x27, 0x05, 0x3A, 0x31, 0x68, 0xC4, 0x8B, 0x41, 0x3D, 0xC3, 0x81, 0x17, 0x4C, 0xF6, 0x02, 0xBC,
+    0x60, 0x92, 0x3D, 0x49, 0x5C, 0x0A, 0xD4, 0xA5, 0xD9, 0x9F, 0x52, 0xDB, 0x5D, 0x2D, 0x94, 0x5A,
+    0xE8, 0x12, 0x85, 0x16, 0x2A, 0xF5, 0x68, 0x81, 0x69, 0x66, 0xB2, 0x14, 0xCB, 0xAF, 0x50, 0x1F,
+    0x74, 0x09, 0x4A, 0xF3, 0x65, 0x4C, 0x73, 0x25, 0xC0, 0xAF, 0x85, 0x46, 0x70, 0x89, 0x69, 0x86,
+    0x5A, 0xF8, 0x68, 0xE7, 0x24, 0x40, 0x73, 0x2D, 0x40, 0xB1, 0x50, 0xA4, 0xD0, 0xC6, 0xA0, 0xFF,
+    0xF4, 0x99, 0xB3, 0x34, 0x9F, 0x6D, 0xAF, 0xC8, 0xF6, 0xC8, 0x2C, 0xD1, 0x68, 0xDE, 0x6E, 0xBC,
+    0x78, 0x60, 0x1E, 0xE8, 0xCF, 0xAF, 0xF5, 0xE9, 0xD1, 0xA3, 0x87, 0x50, 0x49, 0x2B, 0x74, 0x39,
+    0x70, 0xD0, 0x4A, 0xB5, 0xF3, 0x20, 0xD2, 0x46, 0x7C, 0x40, 0x01, 0x51, 0x1D, 0xD4, 0x89, 0x76,
+    0x65, 0x88, 0xE8, 0xEB, 0x0F, 0xCC, 0xE8, 0xDA, 0x2F, 0xCF, 0x5C, 0xBC, 0xEA, 0x92, 0x93, 0xA7,
+    0x49, 0x6F, 0x9F, 0xD6, 0xC3, 0x2C, 0xC5, 0x14, 0x2F, 0x21, 0x9D, 0x79, 0x80, 0x69, 0xBD, 0x3D,
+    0x20, 0x80, 0xE9, 0x5D, 0x99, 0xCE, 0x03, 0xCD, 0xA6, 0x91, 0x89, 0xD3, 0xCF, 0x5C, 0xA2, 0x87,
+    0xB5, 0xD6, 0x8C, 0xB3, 0xD0, 0xA1, 0xDB, 0xC1, 0x47, 0xFC, 0x06, 0x3E, 0xA2, 0x4B, 0x3C, 0x80,
+    0x8F, 0xA5, 0x46, 0xF0, 0xD1, 0xF8, 0x1A, 0x6B, 0x01, 0xC3, 0xD2, 0x1C, 0xC0, 0x34, 0xBB, 0x1D,
+    0x50, 0x70, 0x09, 0x0A, 0x05, 0x97, 0xF8, 0xB9, 0x4A, 0xBD, 0xDB, 0x99, 0x7E, 0x53, 0x38, 0xBD,
+    0x7C, 0xC6, 0x6B, 0x4A, 0xF6, 0x12, 0x8D, 0xB9, 0xF3, 0x19, 0xFD, 0x20, 0xE9, 0x30, 0xF3, 0x20,
+    0x6B, 0x28, 0xE4, 0x78, 0xCA, 0xCC, 0xDF, 0x90, 0x43, 0x2D, 0x8B, 0xD8, 0x9E, 0x7F, 0xF4, 0xDB,
+    0x80, 0xF4, 0x26, 0x54, 0xB2, 0xBA, 0x89, 0x36, 0xD0, 0xCD, 0x2F, 0x45, 0xAA, 0x44, 0x37, 0xD3,
+    0x2E, 0x4C, 0x3D, 0xEA, 0xAB, 0x44, 0x95, 0x70, 0x91, 0x36, 0x32, 0x8D, 0xA8, 0x6F, 0x8C, 0xAF,
+    0x31, 0x77, 0x3F, 0x24, 0x2D, 0xB7, 0x9E, 0xFD, 0x00, 0xED, 0x2E, 0x51, 0x69, 0xEC, 0x56, 0xDA,
+    0x9D, 0x69, 0x46, 0xB1, 0xD2, 0x58, 0x29, 0xB8, 0x83, 0x56, 0x4C, 0x1B, 0xDA, 0x2A, 0xC5, 0x4A,
+    0xB3, 0x53, 0x68, 0xC5, 0x20, 0x6E, 0xEE, 0x17, 0x37, 0x57, 0x39, 0x59, 0xA3, 0xC3, 0x1C, 0x79,
+    0x3C, 0x4D, 0xB1, 0x97, 0x36, 0xF0, 0xEA, 0xFF, 0x55, 0x4E, 0x38, 0x68, 0xF6, 0x5B, 0x6F, 0x91,
+    0x1D, 0xC4, 0xB0, 0x5B, 0xE0, 0x78, 0x58, 0x78, 0x7F, 0x70, 0xFE, 0x77, 0x69, 0xFC, 0x69, 0xCC,
+    0x88, 0x5A, 0x5B, 0x00, 0xA7, 0x11, 0x28, 0xB4, 0xB0, 0x9A, 0x27, 0x7C, 0xB3, 0xC8, 0xE1, 0xF7,
+    0x8E, 0x2E, 0xE1, 0xAE, 0x35, 0x9B, 0x36, 0x78, 0x5E, 0xC7, 0x43, 0x0B, 0x2A, 0x95, 0x3A, 0x49,
+    0xDA, 0xAC, 0x17, 0xE3, 0x25, 0x29, 0x0E, 0xB6, 0x21, 0x56, 0x89, 0xC9, 0xFE, 0x46, 0xB7, 0x89,
+    0xC3, 0x19, 0x74, 0xF5, 0xB7, 0x41, 0x97, 0x05, 0x3A, 0xC7, 0x55, 0x86, 0x99, 0x38, 0x4B, 0x56,
+    0xD9, 0x15, 0x0E, 0xEB, 0xAD, 0x27, 0xB4, 0xCD, 0xD3, 0x72, 0x89, 0x89, 0x2D, 0x18, 0xAE, 0xCE,
+    0x5E, 0x57, 0xC0, 0xEF, 0x34, 0x1A, 0x19, 0x92, 0x49, 0x61, 0xC2, 0x99, 0x87, 0x77, 0x02, 0x45,
+    0xDA, 0x83, 0x42, 0xF1, 0x54, 0x7F, 0x9F, 0x28, 0x15, 0xF0, 0x1B, 0x95, 0x02, 0xC3, 0x4A, 0xA5,
+    0x91, 0x29, 0x52, 0x9B, 0x59, 0x68, 0x04, 0x9A, 0x71, 0x07, 0x85, 0x02, 0x6E, 0xA7, 0x54, 0xA0,
+    0x4D, 0x54, 0x1A, 0xED, 0x7F, 0xFA, 0xFC, 0x3F, 0x85, 0x22, 0xB5, 0x1E, 0xBF, 0xA6, 0xE5, 0x14,
+    0x46, 0xCB, 0x17, 0xEC, 0xA5, 0xA7, 0x32, 0x99, 0x2C, 0x8D, 0x87, 0x0C, 0xD2, 0xC3, 0x77, 0x67,
+    0x95, 0x3E, 0x42, 0x25, 0x97, 0xA0, 0xD4, 0x4B, 0x82, 0x42, 0x41, 0x33, 0x68, 0xF6, 0x2B, 0x4C,
+    0xD1, 0x1D, 0x30, 0xC4, 0xFC, 0xC3, 0x16, 0x47, 0xF8, 0x44, 0xB7, 0xE7, 0x62, 0x45, 0xA9, 0xD9,
+    0x09, 0xA6, 0xB5, 0xD1, 0x48, 0x77, 0xD4, 0x0A, 0x34, 0x7A, 0x49, 0x33, 0xA5, 0xFE, 0x52, 0x11,
+    0x86, 0x43, 0xEB, 0x29, 0xDC, 0xA6, 0xB8, 0xC5, 0x45, 0x4B, 0x2C, 0x33, 0x35, 0x61, 0x09, 0x80,
+    0x3D, 0x5B, 0x72, 0xEE, 0x8C, 0xE1, 0x1F, 0x7E, 0x64, 0x06, 0xE9, 0xBF, 0xE5, 0x10, 0x61, 0x37,
+    0x4B, 0x51, 0xE9, 0x75, 0xE5, 0xF2, 0x45, 0x9B, 0xA3, 0xE7, 0x42, 0x8B, 0x6D, 0x77, 0x77, 0xD8,
+    0x0E, 0x96, 0x9A, 0x51, 0xDF, 0x88, 0x6E, 0xC7, 0xAF, 0x68, 0x29, 0x35, 0x37, 0x1A, 0xBB, 0x84,
+    0xDF, 0x0B, 0xA5, 0x4A, 0x63, 0xA5, 0xD9, 0x2B, 0x4C, 0x11, 0xBF, 0x3B, 0x25, 0x77, 0x50, 0xE9,
+    0x0D, 0xE9, 0xAB, 0x0A, 0xF8, 0x34, 0xE9, 0xF0, 0x1B, 0x95, 0xBE, 0x25, 0xBD, 0x23, 0xF0, 0xD2,
+    0x37, 0xB2, 0x9E, 0xA5, 0x5C, 0xAA, 0x52, 0x23, 0x8D, 0xD4, 0xD2, 0x3C, 0x29, 0xC2, 0xA0, 0xD4,
+    0xE8, 0x80, 0x5A, 0x62, 0x50, 0x80, 0x41, 0x73, 0x6D, 0xAB, 0x4E, 0x0C, 0x02, 0x26, 0x9D, 0x85,
+    0x31, 0x14, 0x40, 0x81, 0xE6, 0x30, 0xF6, 0x0F, 0x11, 0x97, 0xA0, 0x52, 0x6F, 0xC1, 0x40, 0x42,
+    0x33, 0x14, 0xB6, 0x05, 0x38, 0x99, 0x98, 0x4E, 0xDF, 0xD3, 0x68, 0xE6, 0xCF, 0x72, 0x32, 0xE5,
+    0x78, 0x4A, 0x39, 0xBD, 0x36, 0x9F, 0x69, 0x21, 0x75, 0x4E, 0xF2, 0xCE, 0x52, 0x4C, 0x99, 0xFF,
+    0xC7, 0x7C, 0xD3, 0x99, 0x6B, 0x37, 0xFA, 0x8A, 0xB5, 0xC1, 0xA2, 0x12, 0x30, 0xED, 0xB5, 0x16,
+    0x68, 0xD5, 0x7B, 0x41, 0xAD, 0xA5, 0xD2, 0x4A, 0xA1, 0x8D, 0x56, 0x81, 0x41, 0x20, 0x33, 0xAB,
+    0xF8, 0x55, 0x33, 0xA5, 0x7E, 0x4D, 0x23, 0x6D, 0xAA, 0x05, 0x0A, 0x6D, 0xC2, 0x65, 0x36, 0xA3,
+    0xA5, 0x11, 0xA5, 0xC2, 0xB0, 0xD2, 0xA8, 0xD2, 0x48, 0xBB, 0xFB, 0x04, 0xFE, 0xB1, 0x65, 0x42,
+    0xFB, 0x49, 0x4E, 0x93, 0x25, 0xC0, 0xE2, 0xAE, 0x1E, 0xD0, 0xF6, 0x6E, 0x07, 0xB0, 0x5D, 0x34,
+    0xED, 0xCA, 0x23, 0x18, 0x17, 0xDB, 0xDC, 0x23, 0x18, 0xAE, 0x04, 0x7E, 0xC3, 0x3A, 0xB4, 0x26,
+    0xF8, 0xB9, 0x17, 0x20, 0x41, 0xF1, 0xE2, 0xA3, 0x6C, 0x8D, 0xED, 0xF7, 0x68, 0x94, 0xA3, 0xD9,
+    0xC3, 0x0C, 0x98, 0xB1, 0xCB, 0xCA, 0x5C, 0x56, 0xD8, 0x07, 0xA7, 0x6C, 0xE3, 0xD4, 0xDB, 0x39,
+    0xB3, 0xF1, 0x70, 0xE5, 0xEC, 0x87, 0x82, 0x53, 0xCE, 0xE4, 0xF4, 0xF5, 0x9B, 0x7B, 0x14, 0xBA,
+    0xCD, 0x37, 0x72, 0x8A, 0x26, 0x65, 0x9A, 0xE2, 0xC5, 0x17, 0x4F, 0x99, 0x36, 0xE0, 0xC3, 0x8F,
+    0x3E, 0x77, 0x16, 0x9C, 0x2A, 0x59, 0xC5, 0x3E, 0x9D, 0x7D, 0x13, 0x4B, 0xDF, 0xAC, 0xC8, 0x34,
+    0x84, 0x4B, 0xBF, 0xE6, 0xFD, 0x1E, 0xF0, 0xE1, 0x52, 0x32, 0xBA, 0x3A, 0x60, 0xBD, 0x1E, 0xCB,
+    0x59, 0xAF, 0x0E, 0x18, 0x82, 0xC0, 0xCF, 0xEF, 0xEB, 0x80, 0x95, 0xBC, 0xAC, 0x77, 0x73, 0x75,
+    0xA0, 0x4E, 0xB7, 0xFE, 0x4D, 0x0A, 0xA6, 0x0A, 0xD0, 0xE5, 0x03, 0xF3, 0x6D, 0x43, 0x99, 0x1F,
+    0xE3, 0x95, 0x2A, 0xB4, 0xA4, 0x3A, 0x76, 0x61, 0xFA, 0xF8, 0x5E, 0x6F, 0xED, 0x32, 0xFC, 0xAA,
+    0xEA, 0xD4, 0x46, 0x1F, 0x54, 0xED, 0x6E, 0xF5, 0x8B, 0x5E, 0x3A, 0x5C, 0xF2, 0x51, 0x6F, 0x1C,
+    0x2E, 0xFA, 0x7E, 0x2B, 0xC3, 0x8F, 0xF3, 0x11, 0x1E, 0x3D, 0x1A, 0x4F, 0x99, 0x1E, 0x72, 0x04,
+    0x7F, 0xDB, 0x72, 0x53, 0x7F, 0x4B, 0x55, 0xB8, 0x94, 0xE3, 0xBA, 0xE5, 0x76, 0xD5, 0xEB, 0xA5,
+    0x5B, 0x56, 0xDF, 0x12, 0x5F, 0x5E, 0x65, 0xC9, 0x57, 0xCC, 0xB1, 0x2D, 0xB8, 0x3A, 0xED, 0xE9,
+    0xBF, 0x34, 0xFC, 0xF5, 0x7E, 0xA9, 0xD0, 0xC9, 0xAA, 0x52, 0x0A, 0xE7, 0xB6, 0x4B, 0xF3, 0xA9,
+    0x16, 0x00, 0x3E, 0x37, 0x32, 0xB5, 0x50, 0x2A, 0x51, 0x1F, 0xEA, 0xDD, 0xEA, 0x17, 0x1F, 0xEA,
+    0xF4, 0x9C, 0x75, 0x34, 0x73, 0x18, 0xA4, 0x20, 0x49, 0xAA, 0x6F, 0x1D, 0x62, 0x00, 0xEE, 0xDC,
+    0xC7, 0x2F, 0x0C, 0x0B, 0xD3, 0x62, 0x6A, 0x79, 0xBB, 0x01, 0x47, 0x6F, 0x3D, 0x87, 0x4A, 0xDA,
+    0xF1, 0x8F, 0xB5, 0x96, 0x07, 0x53, 0x70, 0x4B, 0x21, 0x26, 0xEA, 0x54, 0xAD, 0xB4, 0x4B, 0x1B,
+    0x18, 0xFA, 0x9D, 0x72, 0xAF, 0x22, 0x2E, 0xBA, 0xC0, 0x14, 0x86, 0x97, 0x1F, 0xA8, 0x90, 0xB4,
+    0x55, 0x92, 0x16, 0x27, 0xA9, 0x77, 0x52, 0xA2, 0xB9, 0x54, 0xBC, 0xAB, 0x53, 0x7A, 0x9B, 0x94,
+    0xF9, 0xE4, 0x62, 0xE6, 0x6B, 0xBB, 0x40, 0xB9, 0x03, 0xFE, 0xF7, 0x76, 0xCB, 0xE3, 0xBC, 0x14,
+    0x6B, 0x49, 0xFD, 0x74, 0x7C, 0x6A, 0x73, 0xEA, 0xDB, 0xA0, 0xB9, 0x48, 0x2E, 0xD1, 0xBE, 0xAE,
+    0xBE, 0x4C, 0x5D, 0x64, 0x78, 0x49, 0xB8, 0xD5, 0xAF, 0x8D, 0x2A, 0x49, 0x8B, 0xCF, 0xA5, 0x39,
+    0xBC, 0x15, 0x6E, 0x66, 0xF8, 0xD7, 0xB7, 0xC1, 0xE1, 0x46, 0xA3, 0xC3, 0x30, 0x06, 0x47, 0x2A,
+    0x35, 0x52, 0xED, 0x26, 0xB6, 0x6E, 0x35, 0xAE, 0xFB, 0x25, 0xFF, 0x45, 0xF0, 0xEB, 0xCF, 0xD2,
+    0x49, 0x38, 0x29, 0xD4, 0xD2, 0x7C, 0x96, 0xDC, 0x9B, 0xEF, 0xA3, 0x19, 0xBC, 0xEB, 0xC0, 0xB0,
+    0x28, 0xBB, 0xB6, 0x52, 0xD2, 0x6C, 0x11, 0x69, 0xA1, 0xDF, 0xD0, 0x86, 0x5B, 0x4B, 0xCD, 0x4C,
+    0x7D, 0x2D, 0xAA, 0x44, 0x9B, 0x68, 0x67, 0xA6, 0x99, 0x89, 0xEA, 0x3C, 0xE0, 0x62, 0xA1, 0x05,
+    0xFF, 0x78, 0x52, 0x6F, 0x35, 0xC4, 0xF2, 0x62, 0x32, 0x82, 0x75, 0xA2, 0xCE, 0x54, 0x99, 0x17,
+    0xDE, 0xCE, 0x16, 0xAA, 0x91, 0x16, 0xBA, 0xAD, 0x8E, 0x0C, 0x73, 0xB9, 0xA2, 0xFF, 0x32, 0x6D,
+    0x97, 0xED, 0xD8, 0x6A, 0x49, 0x6B, 0xA3, 0x47, 0x37, 0xC6, 0x72, 0xC3, 0x25, 0x1C, 0xDC, 0x0D,
+    0x4E, 0xB6, 0x46, 0x8B, 0xCF, 0x47, 0x4B, 0x62, 0x5F, 0xD0, 0x43, 0xF3, 0x34, 0x4F, 0x74, 0x2C,
+    0x57, 0xDB, 0xA6, 0x6E, 0xA6, 0xD6, 0xEF, 0xBD, 0xD2, 0x48, 0xB3, 0x93, 0x42, 0x2B, 0x8D, 0xEF,
+    0x6E, 0x5A, 0xD6, 0xBB, 0xED, 0xB1, 0x4B, 0x16, 0x39, 0x75, 0x5B, 0x2E, 0xFA, 0x9A, 0x3B, 0xCB,
+    0xD2, 0x56, 0x1E, 0xF5, 0x06, 0x93, 0x86, 0x19, 0x67, 0xC1, 0xEA, 0xB7, 0x94, 0x68, 0xD6, 0x4A,
+    0x33, 0x43, 0xEF, 0x44, 0xB9, 0xD1, 0x25, 0x5C, 0x40, 0x0B, 0x5F, 0xA6, 0x12, 0xE5, 0x4A, 0x9B,
+    0x70, 0x33, 0x5A, 0xF0, 0x63, 0x7B, 0x32, 0xC7, 0x12, 0x89, 0x46, 0x52, 0x9F, 0x7B, 0x45, 0x4E,
+    0x5A, 0xE0, 0xEE, 0x37, 0x2D, 0xA6, 0x4B, 0xB9, 0xCB, 0x5C, 0xF5, 0xB5, 0xA0, 0x7B, 0x47, 0xAB,
+    0x75, 0xE8, 0x68, 0x4E, 0xA7, 0x30, 0xC2, 0x67, 0xB2, 0x0A, 0x18, 0x56, 0xA6, 0xCF, 0x1B, 0x5A,
+    0x1E, 0xA7, 0x06, 0x57, 0xE9, 0xDC, 0x5E, 0x63, 0xDE, 0x77, 0xF5, 0xD0, 0x5C, 0xA5, 0x97, 0x12,
+    0x83, 0x5E, 0x4B, 0x4C, 0x6B, 0x99, 0x50, 0x28, 0x53, 0xA1, 0xB1, 0x4C, 0xA5, 0xA8, 0xB6, 0x4A,
+    0x54, 0x5B, 0x7D, 0xD0, 0xAC, 0xCD, 0x8E, 0x8B, 0x2E, 0xD1, 0xC6, 0x36, 0xE1, 0x63, 0xB7, 0xE1,
+    0x17, 0xBF, 0x31, 0xCD, 0xC3, 0x8A, 0xC2, 0xB4, 0x16, 0x0A, 0x77, 0xBF, 0x50, 0xDC, 0x33, 0x4A,
+    0xEB, 0xDD, 0x5A, 0x3B, 0x39, 0x10, 0x4C, 0x14, 0x37, 0xFD, 0x55, 0x54, 0xF6, 0x4F, 0x46, 0xAA,
+    0x04, 0xC3, 0x48, 0xB3, 0x82, 0xC0, 0x45, 0x8A, 0x03, 0xBA, 0x99, 0x2A, 0x81, 0x0F, 0xD4, 0x1B,
+    0xA8, 0xC7, 0xAD, 0x14, 0xC2, 0xB2, 0x61, 0x18, 0x16, 0xEE, 0x7E, 0xD9, 0x34, 0x71, 0x3D, 0xBB,
+    0x97, 0x3A, 0x19, 0xE4, 0xE3, 0xD3, 0x11, 0x6C, 0x17, 0xAB, 0x34, 0xF5, 0x99, 0x09, 0x2E, 0x66,
+    0xD3, 0x53, 0xBE, 0xAF, 0x4F, 0xFE, 0x3D, 0xDF, 0x55, 0x7B, 0xFE, 0x3D, 0xAF, 0x11, 0x94, 0xA0,
+    0xD1, 0x82, 0x65, 0xCA, 0x2F, 0x3E, 0xBC, 0xEC, 0x82, 0x8B, 0x59, 0xCD, 0xBA, 0xF9, 0xDA, 0x76,
+    0xAC, 0x4F, 0x98, 0x8C, 0x3B, 0xF7, 0xF1, 0x6F, 0x88, 0x7A, 0x53, 0x60, 0x9A, 0x22, 0x4E, 0x1B,
+    0x85, 0x0E, 0x6B, 0x6C, 0x57, 0x5A, 0x61, 0x50, 0x30, 0xB3, 0x29, 0x25, 0xDA, 0x77, 0xB4, 0x94,
+    0xF2, 0x1A, 0x7D, 0xD4, 0x5E, 0x1F, 0x8D, 0xD6, 0x69, 0xF6, 0x0A, 0xF0, 0x18, 0x86, 0x40, 0x37,
+    0xE3, 0x22, 0xF5, 0x46, 0xB9, 0x83, 0xAE, 0x0F, 0x25, 0xCA, 0x03, 0xD4, 0xE3, 0x03, 0xDD, 0x82,
+    0x5B, 0xA9, 0x12, 0x85, 0x60, 0x1A, 0xF1, 0x33, 0x6D, 0xA4, 0xD9, 0xA8, 0x94, 0x90, 0x18, 0x34,
+    0xB6, 0x57, 0x06, 0x95, 0xF6, 0xBB, 0x47, 0xDF, 0xCD, 0x20, 0xE9, 0x3F, 0x5C, 0x1C, 0xFF, 0x42,
+    0xA7, 0xD7, 0x74, 0x4C, 0x01, 0x45, 0xA7, 0x7E, 0xEA, 0x6B, 0xD1, 0x6D, 0xA5, 0xC5, 0x49, 0xC1,
+    0xAD, 0x28, 0x54, 0x07, 0x3E, 0x34, 0x3B, 0x5D, 0x2C, 0x64, 0x9D, 0x4E, 0x97, 0x0A, 0x8D, 0xCD,
+    0x8E, 0x5F, 0x9A, 0x1D, 0x1F, 0x4B, 0xF5, 0x3E, 0x96, 0xF9, 0xB0, 0x4B, 0x0C, 0xD1, 0xED, 0x0C,
+    0x4B, 0xA9, 0xD1, 0xC7, 0x4A, 0xBD, 0xDB, 0x4B, 0x8D, 0x6D, 0xCA, 0xE5, 0x38, 0xC0, 0xFD, 0x4F,
+    0xF5, 0xB4, 0xB9, 0x70, 0x1C, 0x2D, 0x6F, 0x9B, 0xD6, 0x7A, 0x43, 0xA1, 0xDA, 0x10, 0xF5, 0x56,
+    0x1E, 0x34, 0x6B, 0xB5, 0xE3, 0xD6, 0x6A, 0xA7, 0x8D, 0x4D, 0xA2, 0x8B, 0x2E, 0xE1, 0x63, 0xBB,
+    0x31, 0x2C, 0xDD, 0x66, 0x91, 0xBF, 0xC2, 0x10, 0x4B, 0x85, 0x29, 0x56, 0x0A, 0xF0, 0x60, 0xCD,
+    0xDE, 0xBC, 0x93, 0x02, 0xD3, 0x63, 0x2D, 0x85, 0x42, 0x17, 0x2B, 0xD1, 0xC6, 0x3A, 0xE1, 0xA2,
+    0xDB, 0x68, 0xA3, 0x8B, 0xB4, 0xB1, 0x8D, 0x74, 0x4B, 0xB7, 0xE0, 0x67, 0xBF, 0x30, 0x05, 0x1F,
+    0x4B, 0x43, 0x75, 0xD1, 0x59, 0xD5, 0xD3, 0xB2, 0xE7, 0x48, 0x65, 0x8D, 0xC6, 0xDC, 0xBE, 0xF8,
+    0x45, 0xA0, 0x38, 0x06, 0x8B, 0x17, 0x94, 0x2C, 0x63, 0x59, 0xC0, 0xAB, 0x1F, 0xA0, 0x52, 0xA8,
+    0x22, 0x0C, 0x2B, 0x1E, 0x1A, 0x51, 0x99, 0x81, 0x19, 0xC0, 0x25, 0x9A, 0x85, 0x42, 0x81, 0x1D,
+    0xFC, 0xCE, 0x70, 0xE9, 0x75, 0x4C, 0x92, 0xCE, 0xF6, 0x47, 0x69, 0xBD, 0x26, 0xFF, 0x8E, 0x12,
+    0xD4, 0xC7, 0xDD, 0x6F, 0xBE, 0xA7, 0x66, 0x79, 0x55, 0xD3, 0xB4, 0x6C, 0x90, 0xEB, 0x9A, 0xE7,
+    0x93, 0x3D, 0xB9, 0x66, 0x6F, 0x23, 0x9D, 0xFE, 0x28, 0xDB, 0x05, 0xFF, 0x5D, 0x1D, 0x74, 0xB3,
+    0x53, 0xDF, 0xCE, 0xA5, 0x42, 0xB3, 0x30, 0x2D, 0x55, 0xA4, 0x8B, 0x45, 0xC2, 0x25, 0xBE, 0x4C,
+    0x75, 0xE0, 0xFB, 0x52, 0xB8, 0xA5, 0x54, 0xA8, 0xF4, 0xDA, 0x89, 0x82, 0xE8, 0xB2, 0x61, 0x3B,
+    0x2C, 0x19, 0xEA, 0xCB, 0xE3, 0xC1, 0x1F, 0xCD, 0x39, 0xF3, 0xA9, 0x8C, 0x07, 0x3B, 0x60, 0x25,
+    0xC7, 0x37, 0x81, 0x7F, 0x78, 0x21, 0xC1, 0x7D, 0x67, 0xA2, 0x92, 0x42, 0x61, 0x4D, 0xA0, 0x84,
+    0x3F, 0x7E, 0x01, 0x97, 0xCC, 0x2C, 0x57, 0x47, 0x36, 0x6F, 0x43, 0x30, 0x1D, 0x74, 0xDB, 0x6D,
+    0xEF, 0xFE, 0xB6, 0x6F, 0x9F, 0xE0, 0xF9, 0xE9, 0x0A, 0xE4, 0xF7, 0xB8, 0xA7, 0x93, 0x28, 0xF5,
+    0xEA, 0x8A, 0x5B, 0xE8, 0x19, 0x4E, 0xDC, 0x62, 0x75, 0xF4, 0x39, 0x60, 0x6E, 0x8C, 0xAC, 0x2B,
+    0x28, 0x5D, 0x39, 0x57, 0x1A, 0xFD, 0xE3, 0x29, 0x9D, 0x0E, 0xFA, 0xB0, 0xC6, 0xC7, 0x0B, 0xB7,
+    0x6D, 0xBC, 0xBB, 0x70, 0xD7, 0xFA, 0x8C, 0x85, 0xCC, 0xBE, 0xFA, 0x99, 0x41, 0x7A, 0x49, 0x3A,
+    0x3A, 0x69, 0x7B, 0xA4, 0x47, 0x0F, 0x9B, 0x64, 0x2E, 0x55, 0x66, 0xAA, 0xBA, 0xAB, 0xB7, 0x6F,
+    0xBF, 0x82, 0x55, 0xCD, 0x69, 0x95, 0xF0, 0x8A, 0x14, 0x3B, 0x55, 0x2A, 0x13, 0x75, 0xAA, 0x12,
+    0x6E, 0xAB, 0x12, 0x6E, 0xAD, 0x36, 0xDA, 0x58, 0xAF, 0x74, 0xB1, 0x89, 0xF8, 0xC5, 0x45, 0x86,
+    0xD9, 0x45, 0xA6, 0xE0, 0x16, 0x14, 0xDA, 0xA5, 0xD4, 0xD8, 0xC5, 0x46, 0x7D, 0x27, 0xD9, 0x93,
+    0x55, 0x4F, 0x9C, 0x74, 0x58, 0x57, 0xAA, 0xD0, 0x92, 0x69, 0x74, 0x1B, 0xE8, 0x93, 0x02, 0x8D,
+    0x53, 0xB0, 0xC6, 0xE1, 0x30, 0xD7, 0x07, 0x7E, 0x41, 0xC1, 0x47, 0x6B, 0x28, 0xBA, 0xBD, 0x5D,
+    0x29, 0xF5, 0xEB, 0x5B, 0x6E, 0x96, 0xB7, 0xDA, 0xCF, 0x6C, 0x42, 0x3A, 0xF3, 0x2F, 0x67, 0x15,
+    0xDD, 0x98, 0xED, 0x5A, 0xA9, 0x36, 0x42, 0xA1, 0x4F, 0x25, 0x40, 0xAF, 0xAB, 0x7F, 0x8E, 0x61,
+    0x1E, 0xE6, 0x2E, 0xF8, 0xA5, 0x5D, 0xBB, 0xB5, 0x8B, 0xF5, 0xDE, 0x1E, 0x6E, 0x2B, 0xF4, 0x4B,
+    0xFA, 0x4A, 0x62, 0xF8, 0x96, 0xDE, 0x39, 0xAC, 0xE0, 0x61, 0x99, 0xC3, 0x58, 0x58, 0x64, 0x37,
+    0xE4, 0xA2, 0xDA, 0x37, 0x14, 0xA9, 0xF5, 0x27, 0x5A, 0x29, 0x14, 0x87, 0x84, 0xD9, 0x06, 0x3E,
+    0xFC, 0x4A, 0xF9, 0x28, 0x97, 0x66, 0x5C, 0xA2, 0x94, 0xA1, 0x32, 0x5F, 0xD7, 0x08, 0xFA, 0x5F,
+    0x96, 0x79, 0x6F, 0x97, 0x34, 0xBB, 0xB3, 0xF6, 0x8E, 0xA5, 0xCC, 0xB9, 0x6E, 0xD9, 0x43, 0x2D,
+    0x05, 0xE8, 0x0E, 0x2D, 0x30, 0x45, 0x45, 0x2A, 0x85, 0x61, 0xC3, 0x09, 0x9F, 0x18, 0x12, 0xDD,
+    0x01, 0xED, 0x4A, 0xB5, 0xE3, 0x36, 0x9A, 0x0D, 0x97, 0x68, 0x23, 0xCD, 0x8E, 0x5F, 0xA8, 0x0F,
+    0xD3, 0x42, 0xD4, 0x53, 0xE9, 0x13, 0x07, 0x94, 0xFA, 0xF7, 0x09, 0x0A, 0x7D, 0x65, 0xBB, 0xD4,
+    0xD9, 0x2D, 0x1D, 0x98, 0x0C, 0x85, 0x68, 0x6D, 0xED, 0xE3, 0xB6, 0xFB, 0x63, 0xCD, 0x01, 0x03,
+    0x8D, 0x29, 0x9C, 0xA5, 0xD5, 0x36, 0xA7, 0x13, 0x09, 0xF0, 0x5A, 0x01, 0x6F, 0x68, 0xC8, 0xED,
+    0x89, 0x1E, 0x79, 0x0E, 0x71, 0x16, 0xB3, 0x7D, 0x1F, 0x7E, 0x34, 0xA5, 0xB3, 0xA0, 0x33, 0x6C,
+    0x67, 0x91, 0x51, 0x31, 0xB7, 0x3E, 0x0B, 0x2D, 0xB9, 0x83, 0x55, 0x69, 0x86, 0x5A, 0x5F, 0xBF,
+    0xB1, 0x10, 0xCC, 0x4C, 0x86, 0xA4, 0x83, 0xE9, 0x2C, 0xE4, 0xBD, 0xF8, 0x8A, 0xE1, 0xA8, 0x6A,
+    0x2B, 0x00, 0x2C, 0x16, 0xA0, 0xB9, 0x94, 0x11, 0x99, 0xE5, 0x05, 0x66, 0xEA, 0x73, 0x97, 0x9D,
+    0x36, 0xE5, 0x46, 0xB5, 0x8E, 0x9C, 0xB6, 0xB6, 0x06, 0xAF, 0xB8, 0x3E, 0xB3, 0x50, 0x7F, 0x7E,
+    0x8A, 0xF9, 0x53, 0x93, 0x00, 0xFF, 0xF8, 0x1E, 0x18, 0x18, 0x66, 0xCF, 0x62, 0x54, 0x9E, 0x85,
+    0x71, 0xE0, 0x3E, 0xC5, 0x4E, 0x99, 0xA8, 0x12, 0xD5, 0x4A, 0x1D, 0x71, 0x11, 0xB7, 0xD0, 0xCE,
+    0x74, 0x01, 0x3F, 0xE2, 0x7B, 0x26, 0x10, 0xEC, 0x14, 0x89, 0x32, 0x51, 0x6D, 0xD4, 0x2B, 0x4D,
+    0xC4, 0x2D, 0x38, 0x3B, 0x2B, 0xE0, 0x7B, 0x06, 0x98, 0x00, 0xFE, 0xD1, 0xE7, 0x30, 0x42, 0x6B,
+    0xED, 0xD0, 0x6A, 0xBD, 0xE0, 0x38, 0xCF, 0xA4, 0x68, 0x98, 0xAF, 0xC1, 0xB4, 0xB6, 0xE6, 0x11,
+    0x1A, 0x4B, 0xB4, 0x83, 0x6D, 0x62, 0x69, 0x65, 0xE3, 0xD1, 0xC0, 0x7B, 0xCD, 0x25, 0xF0, 0xD0,
+    0x98, 0x8B, 0x86, 0xE7, 0xA7, 0x3B, 0xAF, 0x65, 0x36, 0x62, 0x90, 0xB1, 0x05, 0xFC, 0xA5, 0x0C,
+    0x5D, 0x2E, 0x1F, 0x6D, 0xB7, 0x8F, 0xF9, 0xFD, 0x4B, 0xFF, 0x6E, 0x48, 0x5F, 0xEA, 0xD6, 0x2F,
+    0x66, 0x74, 0xE5, 0x87, 0x28, 0xE0, 0xA7, 0xF9, 0xFB, 0x14, 0x2B, 0x5F, 0xA4, 0x89, 0xF5, 0xC6,
+    0x30, 0x77, 0xB1, 0x54, 0xA1, 0xB1, 0xDD, 0x9A, 0x84, 0x0F, 0xDD, 0xC2, 0x34, 0xFB, 0xC8, 0x14,
+    0xFD, 0x86, 0x4F, 0xED, 0x8E, 0x3B, 0x6A, 0x51, 0xA5, 0xF2, 0xA0, 0xD8, 0x48, 0xF0, 0x05, 0xFE,
+    0x29, 0xFC, 0x14, 0x1F, 0x31, 0x60, 0xE9, 0x17, 0xF8, 0x39, 0xF8, 0x28, 0x1D, 0xF8, 0xD0, 0xCE,
+    0xB4, 0xAB, 0x4B, 0x19, 0x14, 0x3F, 0xCC, 0x7E, 0xC1, 0xC5, 0x66, 0xC3, 0xA5, 0x66, 0xC7, 0x6F,
+    0x6D, 0x62, 0x8A, 0x7E, 0x2D, 0x14, 0xB4, 0xA0, 0x7E, 0x0A, 0x7C, 0x19, 0x0F, 0x3F, 0xCF, 0xCF,
+    0xC2, 0x4F, 0xF1, 0x63, 0x57, 0x88, 0x46, 0xDB, 0x27, 0xEB, 0x78, 0xE5, 0xEA, 0x68, 0xBB, 0x3F,
+    0x03, 0xD6, 0x31, 0x85, 0x5B, 0xE7, 0x63, 0xF2, 0xDF, 0xE9, 0x16, 0xF2, 0xE2, 0xAC, 0x54, 0xF3,
+    0x8E, 0xE1, 0x8F, 0x35, 0x9E, 0x10, 0x87, 0x52, 0x4D, 0x82, 0x42, 0x9F, 0x10, 0xA0, 0x30, 0x85,
+    0x8C, 0x71, 0x60, 0x58, 0xEA, 0xDD, 0x0A, 0xDE, 0x23, 0xDD, 0x7E, 0x63, 0xE0, 0xAA, 0xB3, 0x66,
+    0x6D, 0xD0, 0x7D, 0xEB, 0x41, 0x1A, 0x92, 0x60, 0x2F, 0x15, 0xA8, 0xD5, 0x6B, 0xA1, 0xB0, 0xB6,
+    0xEA, 0xB0, 0x65, 0x98, 0x83, 0xB9, 0x9A, 0xF9, 0x0A, 0xD3, 0x3E, 0x5C, 0x21, 0x5D, 0x33, 0x1C,
+    0x75, 0xEA, 0xF9, 0xAB, 0x3E, 0x9A, 0x6B, 0xB6, 0xD8, 0x8A, 0x9B, 0x5C, 0xAC, 0xDD, 0xB9, 0x80,
+    0x3A, 0x6C, 0xC9, 0x86, 0xEA, 0xC0, 0xFF, 0x89, 0x38, 0x61, 0x1D, 0x79, 0xCD, 0x86, 0xEB, 0x68,
+    0x52, 0x69, 0xF8, 0xBE, 0x76, 0x3D, 0x17, 0x6D, 0xC8, 0x8E, 0xDC, 0x18, 0xF0, 0x17, 0x74, 0x58,
+    0x6E, 0xF5, 0x1B, 0xDA, 0x43, 0xB3, 0x81, 0x3B, 0xB0, 0x65, 0x1B, 0xBA, 0xA3, 0xD1, 0x98, 0x01,
+    0x11, 0xD5, 0x55, 0xA2, 0x90, 0xAD, 0x63, 0x65, 0x05, 0xA3, 0x49, 0x86, 0x85, 0x1E, 0x2C, 0x60,
+    0x1D, 0x46, 0xB8, 0xCD, 0xC5, 0x7F, 0x48, 0x16, 0x77, 0x54, 0x07, 0x50, 0x1D, 0xF5, 0x01, 0x34,
+    0x7B, 0xB3, 0x03, 0x6E, 0x77, 0x3B, 0xD0, 0xA5, 0x2E, 0x01, 0xDE, 0xE0, 0xCE, 0xCF, 0xDD, 0x7F,
+    0xEE, 0xFE, 0x33, 0x77, 0xD1, 0xC4, 0x36, 0x2F, 0x34, 0xD7, 0xC1, 0x9B, 0xB3, 0xC6, 0x36, 0xDF,
+    0x2E, 0xD5, 0xD0, 0x39, 0xE7, 0x5A, 0x4D, 0x78, 0xF3, 0x62, 0x33, 0x42, 0x27, 0xAF, 0x36, 0xCB,
+    0x6F, 0x5E, 0xAE, 0xA1, 0x74, 0xCE, 0xF5, 0x9A, 0x08, 0xE7, 0x05, 0x67, 0xA4, 0x4E, 0x5E, 0x71,
+    0x75, 0xB6, 0x09, 0xA0, 0xDD, 0x31, 0xB4, 0x0E, 0xB6, 0x66, 0xAE, 0x05, 0xF9, 0xAF, 0x07, 0x90,
+    0xC9, 0xF5, 0xD4, 0x27, 0x00, 0x32, 0xD3, 0x15, 0x40, 0xA6, 0xF8, 0xBE, 0x00, 0x19, 0x7A, 0x06,
+    0xFD, 0x8F, 0x3B, 0xFF, 0x3D, 0x3B, 0xF0, 0xF7, 0x0D, 0x90, 0xE1, 0x8B, 0xA6, 0x68, 0xE3, 0x2D,
+    0xEC, 0x2B, 0xF7, 0x24, 0xEE, 0xD8, 0xB1, 0x27, 0x49, 0xE8, 0xDF, 0x03, 0x12, 0xCB, 0x06, 0xC8,
+    0x32, 0xBE, 0x36, 0xD3, 0xF3, 0x7D, 0x34, 0xF5, 0x6F, 0x27, 0xCE, 0x25, 0x67, 0xB1, 0x34, 0xF1,
+    0x16, 0x68, 0xEF, 0xC7, 0x4B, 0x25, 0xA6, 0xDC, 0xF9, 0xAB, 0x3F, 0xFE, 0x96, 0xAE, 0x74, 0xBB,
+    0x05, 0xE4, 0x67, 0xC8, 0x4D, 0x8E, 0xCF, 0x12, 0x30, 0xBC, 0xAE, 0x1E, 0x44, 0xBB, 0xC0, 0x7D,
+    0x8A, 0x7B, 0x3F, 0x14, 0x2B, 0xD2, 0xA8, 0x11, 0xFC, 0x32, 0x2C, 0xD0, 0xAD, 0xDD, 0x7A, 0xDA,
+    0x98, 0x46, 0x8D, 0xA0, 0xD2, 0x1B, 0x0A, 0x70, 0x73, 0xEF, 0xE6, 0xDE, 0xB3, 0xF7, 0xAA, 0x78,
+    0xF4, 0xAA, 0xD6, 0xBC, 0x34, 0x6B, 0x28, 0xE7, 0xE6, 0x6A, 0xF7, 0xF8, 0xE6, 0x8C, 0x99, 0x72,
+    0x99, 0x3C, 0x8F, 0x98, 0x65, 0xB1, 0xFF, 0xCE, 0xCD, 0xC3, 0x13, 0x31, 0xD2, 0x48, 0x29, 0xE3,
+    0xBB, 0xF3, 0xEA, 0x32, 0xF6, 0x25, 0xEB, 0x46, 0xBA, 0x5D, 0x5E, 0xA5, 0x97, 0x6F, 0xEE, 0x9F,
+    0x0A, 0x39, 0x5C, 0x14, 0xD6, 0x1C, 0xE8, 0x46, 0x2D, 0xE9, 0xB0, 0x8E, 0xFE, 0x78, 0x3B, 0xC6,
+    0x60, 0x88, 0xE9, 0x60, 0x7D, 0xC2, 0xEE, 0xE9, 0xD0, 0xDC, 0xEA, 0x2D, 0xE3, 0x66, 0xFD, 0x24,
+    0xDA, 0x1F, 0xB7, 0x19, 0x5E, 0xCB, 0x60, 0x8A, 0x16, 0x0D, 0x0E, 0x73, 0x1E, 0x14, 0x38, 0x87,
+    0x05, 0x46, 0x4A, 0xF5, 0x56, 0x77, 0x93, 0xF5, 0x2D, 0xDD, 0x61, 0x59, 0x6A, 0xBB, 0x9B, 0x87,
+    0xF1, 0xC9, 0x62, 0xDB, 0x17, 0x2D, 0x10, 0x76, 0x21, 0xEB, 0xCD, 0x94, 0x95, 0xA6, 0xDA, 0xAE,
+    0x86, 0x45, 0xDE, 0xCF, 0xE3, 0x63, 0xAF, 0xE4, 0xDD, 0x1F, 0x96, 0x1C, 0xB3, 0x29, 0x64, 0x76,
+    0x6B, 0x34, 0x92, 0x4B, 0x9D, 0xAD, 0xC3, 0x23, 0x07, 0x86, 0x56, 0xF1, 0x0D, 0xB6, 0xAA, 0x42,
+    0xA3, 0xC9, 0x5B, 0x75, 0x9E, 0x67, 0x63, 0x61, 0x8B, 0x51, 0x5E, 0x68, 0x36, 0xB2, 0x2B, 0x05,
+    0xA3, 0xDD, 0x80, 0x49, 0xCD, 0x9C, 0x29, 0xED, 0xF6, 0x8C, 0x4A, 0x96, 0x16, 0xFC, 0x32, 0x85,
+    0x66, 0x63, 0xEA, 0xEF, 0x3F, 0xE1, 0x69, 0xFF, 0xFF, 0x92, 0x5A, 0xED, 0xD5, 0x4E, 0x93, 0x9A,
+    0x84, 0x4B, 0x2E, 0xD1, 0xA6, 0x2E, 0x99, 0xDB, 0x1C, 0xB6, 0x61, 0xFB, 0x01, 0x72, 0x5D, 0xBD,
+    0x75, 0xAA, 0x57, 0x76, 0xC1, 0x4F, 0x8E, 0x86, 0x6D, 0x27, 0x8C, 0xEF, 0x6A, 0xD0, 0x6A, 0xC9,
+    0xA4, 0x9B, 0xDB, 0xD5, 0xED, 0x80, 0xDA, 0x98, 0x65, 0xBF, 0xBA, 0x8C, 0x91, 0xD9, 0xE4, 0xC7,
+    0x71, 0x96, 0x32, 0xDA, 0xFD, 0x0C, 0x44, 0x7C, 0x3A, 0x93, 0xA0, 0x17, 0xCF, 0x94, 0xE9, 0xDF,
+    0x54, 0xD6, 0xE1, 0x79, 0xC9, 0x5A, 0xDA, 0x7F, 0x10, 0x80, 0xFA, 0xFF, 0x18, 0xCC, 0xF6, 0x77,
+    0xAD, 0xCD, 0x11, 0xBE, 0x9F, 0x95, 0xFD, 0xA1, 0x02, 0xE8, 0xE4, 0xE9, 0xA3, 0x73, 0xC8, 0x28,
+    0x97, 0x43, 0x33, 0x06, 0x2D, 0xF7, 0xF9, 0x9F, 0xFE, 0xF8, 0xD1, 0x81, 0xF6, 0x5C, 0x26, 0x52,
+    0xE9, 0xC6, 0xEB, 0xF1, 0xB5, 0x9C, 0x5F, 0xE5, 0xE1, 0xB5, 0x66, 0xE5, 0xAF, 0xF7, 0xB8, 0x7B,
+    0x36, 0x50, 0x2D, 0x33, 0x37, 0xA4, 0x4E, 0x4E, 0xA0, 0xA7, 0xA3, 0x98, 0x36, 0x98, 0x36, 0x1A,
+    0x99, 0x1C, 0x6A, 0xC6, 0x6F, 0xD0, 0xAD, 0x74, 0x36, 0x5E, 0x62, 0x0A, 0x37, 0x36, 0x02, 0xA6,
+    0xA5, 0x52, 0x0F, 0xDD, 0x6A, 0x9A, 0xBA, 0x33, 0x2C, 0x50, 0x09, 0x8B, 0x11, 0x83, 0x4B, 0xF9,
+    0x9C, 0xCC, 0xC5, 0x40, 0xAE, 0x4D, 0x30, 0x1C, 0xB4, 0xFA, 0xD3, 0x9F, 0x3C, 0xCB, 0x26, 0xB9,
+    0x6E, 0x92, 0xC3, 0xE5, 0xDC, 0x45, 0xD0, 0x62, 0x7C, 0xB3, 0x90, 0x4B, 0x33, 0xF0, 0x82, 0x1E,
+    0x3F, 0xB9, 0x96, 0x76, 0xBC, 0xE6, 0x45, 0xAE, 0x11, 0xE6, 0x34, 0xC0, 0xBA, 0x76, 0x14, 0xB2,
+    0x09, 0x69, 0x73, 0xCD, 0xEF, 0xCA, 0x04, 0x7E, 0xA4, 0x98, 0xE1, 0x36, 0x9B, 0x25, 0x3D, 0x6A,
+    0x9B, 0x57, 0xF8, 0xA4, 0xF5, 0x4F, 0x66, 0x05, 0x60, 0x8A, 0x53, 0xBC, 0xCD, 0x1A, 0xEE, 0xDC,
+    0xDC, 0xB9, 0x79, 0xB6, 0x4B, 0x9F, 0x36, 0x4B, 0x14, 0x2C, 0x8F, 0x52, 0xAE, 0xE9, 0xE4, 0x5E,
+    0xFD, 0xF8, 0xE0, 0x80, 0xEE, 0x30, 0xB8, 0xCB, 0x01, 0x7E, 0xC5, 0x99, 0xCF, 0x6C, 0x04, 0xA5,
+    0xC6, 0x4A, 0x3D, 0x0C, 0x4B, 0xA9, 0x00, 0xDD, 0x86, 0x61, 0x39, 0x33, 0x84, 0xA5, 0x37, 0xA0,
+    0x64, 0x68, 0x76, 0x9B, 0x02, 0x97, 0xD5, 0x6F, 0x4F, 0x86, 0x45, 0x32, 0x64, 0x85, 0x56, 0x63,
+    0xAD, 0xB7, 0x7F, 0x61, 0x52, 0x28, 0x72, 0x9D, 0x3E, 0xC3, 0x87, 0x9C, 0x61, 0x08, 0xCA, 0x2B,
+    0x28, 0x81, 0x75, 0x68, 0xF3, 0x84, 0xF8, 0x31, 0xF2, 0x24, 0xEC, 0x94, 0xDB, 0x2C, 0xFF, 0x34,
+    0x2B, 0x39, 0x21, 0xFA, 0xBE, 0xE6, 0xE4, 0xEA, 0xF1, 0xC3, 0x8C, 0x1C, 0xBA, 0xB6, 0x26, 0x56,
+    0x49, 0xCE, 0x63, 0xEE, 0xD5, 0x76, 0x6D, 0x4C, 0xBA, 0x99, 0xBF, 0xE9, 0xE3, 0x87, 0x9C, 0x4B,
+    0x96, 0xB3, 0x19, 0x40, 0xE0, 0x4C, 0xE4, 0xD0, 0x71, 0x65, 0x48, 0xEA, 0xD4, 0xAE, 0x80, 0x8B,
+    0xC5, 0x01, 0xDC, 0xE9, 0xF3, 0xCD, 0x10, 0x7E, 0xF4, 0x38, 0x61, 0x66, 0xC4, 0x6D, 0xED, 0x06,
+    0x74, 0xAB, 0x5F, 0x01, 0x6F, 0x2F, 0xD9, 0x8A, 0x28, 0x2A, 0xF2, 0x83, 0x32, 0x83, 0x1F, 0x15,
+    0x86, 0x0C, 0xE1, 0x9C, 0xBC, 0xD0, 0xF9, 0x54, 0x58, 0x11, 0xE1, 0xDD, 0xC9, 0xFA, 0x07, 0x86,
+    0xD9, 0xF8, 0xF2, 0xA5, 0xCD, 0xB3, 0x9E, 0x71, 0x40, 0x17, 0x72, 0x1B, 0xF7, 0xFD, 0x3E, 0x86,
+    0x87, 0x19, 0xC6, 0xEA, 0xA4, 0x15, 0xFF, 0x58, 0x2B, 0xD3, 0xD8, 0x45, 0x0E, 0xDA, 0x58, 0x26,
+    0xDA, 0x58, 0xAD, 0xB4, 0x4B, 0x1D, 0x69, 0x67, 0x37, 0xD3, 0xCD, 0x2E, 0xE0, 0x83, 0x0B, 0x4C,
+    0xA1, 0xFD, 0xD3, 0xCF, 0x28, 0xB4, 0x92, 0x46, 0x77, 0x3E, 0xF5, 0x96, 0xAC, 0x4D, 0x6F, 0x9E,
+    0x18, 0x18, 0x23, 0xC5, 0xF0, 0x3E, 0x09, 0x9A, 0x43, 0x3D, 0xED, 0xEA, 0x17, 0x7C, 0xA8, 0xB7,
+    0x77, 0x3B, 0xDD, 0x0F, 0x90, 0x96, 0x2E, 0x76, 0x91, 0x4A, 0xD5, 0x01, 0xD3, 0x32, 0x2D, 0x96,
+    0xCF, 0x16, 0xFA, 0x43, 0xCD, 0xE6, 0xFA, 0x8A, 0x9B, 0x8F, 0xDF, 0x3C, 0xAB, 0xC6, 0x52, 0xBF,
+    0xCD, 0x89, 0xF4, 0xB5, 0x51, 0xA9, 0xC7, 0x5A, 0x69, 0xB6, 0x52, 0x70, 0xD0, 0x46, 0xBA, 0x50,
+    0x88, 0x6A, 0xA5, 0x5D, 0x18, 0x28, 0x76, 0xDC, 0x4C, 0x37, 0x63, 0xD0, 0xDF, 0xC0, 0x14, 0x8A,
+    0xE3, 0x66, 0xB2, 0xC8, 0x6F, 0xB4, 0x91, 0x6D, 0x77, 0x4E, 0x5C, 0xC5, 0x93, 0xBC, 0xF7, 0x89,
+    0x82, 0xE9, 0x9E, 0x82, 0x82, 0x69, 0xA5, 0xD0, 0x48, 0x73, 0x31, 0x1D, 0xD0, 0xE5, 0x2A, 0xCB,
+    0x14, 0xE1, 0x3F, 0x47, 0x0A, 0x45, 0x4A, 0x85, 0x73, 0x9A, 0x68, 0x3D, 0x13, 0x96, 0x3C, 0xA9,
+    0x3C, 0x5F, 0x80, 0xB2, 0x1F, 0xFA, 0x41, 0x52, 0xF2, 0xC1, 0xE1, 0x58, 0x72, 0x34, 0xDB, 0x86,
+    0xB3, 0x60, 0xED, 0xE2, 0x59, 0x36, 0xAA, 0xB7, 0xBF, 0x89, 0xE3, 0xB9, 0x7B, 0xF4, 0xD0, 0xDA,
+    0xB0, 0xBF, 0x46, 0xA3, 0xB9, 0x5D, 0xF9, 0x12, 0xEE, 0xED, 0x57, 0x6D, 0xBC, 0x67, 0xA9, 0x24,
+    0x6D, 0x85, 0xDD, 0xB7, 0xE4, 0xF1, 0x6F, 0xDD, 0xCB, 0xD3, 0xF1, 0x06, 0x65, 0x1F, 0x8B, 0x2F,
+    0x70, 0x62, 0xE2, 0x8F, 0x3C, 0xB1, 0xE5, 0xA5, 0x40, 0x61, 0x03, 0x2C, 0x2E, 0x9C, 0x14, 0x56,
+    0x96, 0xC8, 0x25, 0x28, 0x34, 0xCD, 0xA0, 0x4F, 0x1E, 0x20, 0xDA, 0xF8, 0x1E, 0xF9, 0xFE, 0x7F,
+    0x4C, 0x62, 0x71, 0xBF, 0xB8, 0x0F, 0x5D, 0xF4, 0x11, 0x14, 0x34, 0xD2, 0x1C, 0xCD, 0x01, 0x7E,
+    0xF3, 0x2B, 0xA5, 0xBE, 0xAA, 0x19, 0xA7, 0x4F, 0xFF, 0x15, 0x8A, 0x0B, 0x76, 0xBF, 0x84, 0x21,
+    0x07, 0x9B, 0x0B, 0x4C, 0x4B, 0x1B, 0xA8, 0x77, 0xBA, 0x1E, 0xFF, 0x67, 0xAF, 0x1D, 0x14, 0x17,
+    0xF1, 0xB6, 0xB8, 0xAC, 0x2F, 0xF5, 0xD6, 0xCB, 0x7D, 0x0E, 0x26, 0x32, 0x0E, 0x6B, 0xE1, 0x97,
+    0x33, 0x06, 0xBE, 0x56, 0x1E, 0x9D, 0x3F, 0x30, 0x5C, 0xC1, 0x65, 0xBA, 0x1E, 0x8D, 0xB4, 0x1B,
+    0xA5, 0x46, 0xBA, 0xED, 0x2C, 0x50, 0xE7, 0x1A, 0xFD, 0x2B, 0x54, 0x89, 0xE2, 0x80, 0xA9, 0xC7,
+    0x87, 0x27, 0x01, 0x21, 0x3E, 0xD0, 0x1A, 0xFA, 0x63, 0x37, 0xF4, 0x47, 0xC0, 0x47, 0xDA, 0xED,
+    0x04, 0xD6, 0x64, 0x39, 0xDB, 0xCD, 0x56, 0x4E, 0x50, 0xAF, 0xB7, 0xF7, 0xF0, 0x78, 0xFA, 0xDC,
+    0xEE, 0x9F, 0x9B, 0x40, 0x0E, 0x23, 0xE5, 0x6E, 0x6F, 0x7D, 0xA0, 0x38, 0x2C, 0xB7, 0xF0, 0xC1,
+    0x7A, 0xDD, 0x79, 0x14, 0x57, 0xBD, 0xB5, 0xBD, 0x23, 0x28, 0x50, 0x1F, 0xF0, 0xFC, 0x86, 0x29,
+    0xA5, 0xCB, 0xB5, 0x89, 0xDA, 0x6A, 0xC8, 0x63, 0x75, 0x34, 0xA9, 0xDC, 0xE9, 0xE6, 0xDB, 0xBA,
+    0xC8, 0xEF, 0x64, 0xF0, 0x5A, 0xBB, 0xD8, 0xC5, 0xAB, 0xC4, 0xD3, 0x6F, 0x88, 0x52, 0x9C, 0x20,
+    0x01, 0x3F, 0x9B, 0x59, 0x68, 0x92, 0x85, 0xB0, 0x85, 0x46, 0xF8, 0xEC, 0x02, 0x7C, 0xBE, 0xFC,
+    0x5C, 0xB3, 0x75, 0x8B, 0x5F, 0xF4, 0xAB, 0xFA, 0xD4, 0xEE, 0x76, 0x1F, 0x87, 0xBF, 0xD0, 0x13,
+    0xEB, 0xFC, 0x1D, 0xBB, 0x56, 0xBB, 0xC0, 0xD4, 0x53, 0xA5, 0x67, 0x2D, 0xD3, 0xAD, 0xB7, 0xED,
+    0xFF, 0x04, 0x3E, 0x52, 0x68, 0xBC, 0xE2, 0x27, 0x50, 0x2F, 0x1F, 0x85, 0x42, 0x6F, 0x2C, 0xE0,
+    0xF7, 0x7F, 0x0B, 0xF5, 0xFF, 0x56, 0x80, 0x2F, 0x75, 0x2B, 0xD4, 0xF3, 0x97, 0x9E, 0xC5, 0xD9,
+    0xFD, 0x81, 0x81, 0xCB, 0xCF, 0x01, 0x08, 0x2F, 0x6D, 0x34, 0xEA, 0x87, 0xD1, 0xF0, 0x2E, 0x2E,
+    0x32, 0x8C, 0xE5, 0x41, 0xB3, 0xE2, 0x67, 0xD4, 0x57, 0x3B, 0x6D, 0x64, 0x0A, 0xA5, 0x70, 0xC9,
+    0x3A, 0x2A, 0xF5, 0x61, 0x89, 0x44, 0xA5, 0xDE, 0x25, 0x86, 0x58, 0x2A, 0x34, 0xC2, 0xA7, 0xCB,
+    0x1D, 0x75, 0xE6, 0xB3, 0x21, 0xED, 0xF6, 0xDB, 0x2A, 0xFA, 0x13, 0x66, 0xFE, 0x83, 0x46, 0xC7,
+    0x94, 0x1B, 0x50, 0xC7, 0xD3, 0xB6, 0xF9, 0x90, 0xE3, 0xED, 0xCB, 0x1D, 0x65, 0x7E, 0xC0, 0xE3,
+    0x03, 0xA6, 0x2F, 0x9D, 0x58, 0xC9, 0xEA, 0xD2, 0x0C, 0x6E, 0xDF, 0xD9, 0xC1, 0xCF, 0xD3, 0x68,
+    0x26, 0xEC, 0xAA, 0x66, 0xFD, 0x01, 0xD3, 0x32, 0x85, 0x29, 0xE0, 0xA3, 0x8F, 0xB4, 0x5B, 0xB7,
+    0xE1, 0x0E, 0x77, 0x50, 0xEB, 0x53, 0xEA, 0x2B, 0x7D, 0x4D, 0xE1, 0xE9, 0x41, 0xE5, 0x5D, 0xF5,
+    0xD0, 0x2A, 0x65, 0x9A, 0xBA, 0x63, 0xDA, 0x68, 0x93, 0x89, 0xC8, 0x10, 0xEA, 0x84, 0x8B, 0x36,
+    0xE9, 0x24, 0x0A, 0x31, 0x04, 0xA6, 0xB1, 0x5B, 0xF0, 0xB3, 0xDB, 0xE8, 0x62, 0x25, 0xBA, 0x8D,
+    0x73, 0x9E, 0xD8, 0x8A, 0x32, 0x79, 0x4E, 0xD0, 0xD9, 0x9C, 0xC3, 0x76, 0x75, 0xAB, 0xB8, 0x67,
+    0x0B, 0xD4, 0xB5, 0x85, 0xFC, 0xC0, 0xE0, 0x2D, 0x17, 0x83, 0xB4, 0x3E, 0x29, 0x50, 0xE3, 0x29,
+    0x50, 0xEF, 0xAB, 0xA1, 0xF2, 0x81, 0xD3, 0x97, 0x2E, 0x37, 0xDD, 0x32, 0x68, 0xF4, 0x0A, 0xDD,
+    0xF7, 0x0E, 0x18, 0xC2, 0x14, 0x8A, 0x23, 0x77, 0x83, 0x3E, 0x78, 0x5A, 0x9E, 0xEB, 0x9F, 0xEB,
+    0x4D, 0x96, 0xDC, 0xD6, 0x6E, 0x34, 0x87, 0x3B, 0xA8, 0xF4, 0x49, 0xF5, 0xA5, 0xBE, 0xAA, 0x70,
+    0xE6, 0x29, 0x4F, 0x09, 0xF5, 0x56, 0x5C, 0x2C, 0x93, 0x49, 0x4C, 0x75, 0xE0, 0x03, 0xEA, 0xDD,
+    0xC2, 0x10, 0xEA, 0x95, 0x2E, 0x96, 0x09, 0xB7, 0x21, 0xEA, 0x1D, 0x1F, 0x4A, 0xE1, 0x16, 0x14,
+    0xEA, 0x8D, 0x69, 0x29, 0xC5, 0xB4, 0x32, 0x9D, 0x13, 0xC3, 0xF9, 0xD6, 0x23, 0xE7, 0x0D, 0x5F,
+    0xD6, 0x5B, 0x1E, 0xBD, 0x70, 0x8C, 0xC0, 0xDF, 0x85, 0x52, 0x7A, 0x47, 0xE7, 0xF8, 0x58, 0x9E,
+    0x2A, 0xC8, 0xF7, 0xF8, 0x9B, 0x29, 0x2D, 0x96, 0xD2, 0x48, 0xA3, 0x31, 0x77, 0x0C, 0x73, 0x51,
+    0x25, 0x67, 0xA1, 0xFE, 0x32, 0xE0, 0x64, 0x52, 0xAA, 0x39, 0x8F, 0x5C, 0xD8, 0x40, 0xFD, 0x76,
+    0x46, 0x79, 0xB9, 0xB0, 0x78, 0x36, 0x50, 0xEA, 0x9C, 0xD6, 0x58, 0x20, 0x68, 0x96, 0xD7, 0xED,
+    0x50, 0xE9, 0xF1, 0xFD, 0x7C, 0xA7, 0x18, 0x1B, 0xD9, 0xD8, 0xCF, 0x51, 0xCE, 0x56, 0xE7, 0xBC,
+    0x57, 0xAB, 0xC7, 0x2F, 0x5A, 0x61, 0xD2, 0x28, 0xBE, 0xB9, 0xE9, 0x4F, 0xDA, 0x15, 0xCE, 0x5B,
+    0x17, 0x1A, 0x9C, 0x53, 0x57, 0x37, 0x06, 0xC8, 0x45, 0xB3, 0xCB, 0xBB, 0xBB, 0x97, 0x77, 0xEF,
+    0xB2, 0x73, 0x40, 0xAB, 0x54, 0x4C, 0x0F, 0x29, 0xA5, 0x34, 0x28, 0xD2, 0x1D, 0xD3, 0x3B, 0x52,
+    0x2C, 0x34, 0x76, 0x5A, 0xDA, 0xD9, 0x6D, 0x0C, 0x3B, 0xED, 0x38, 0x05, 0xF4, 0x67, 0xAF, 0x1D,
+    0x95, 0xA9, 0xEC, 0xD6, 0xE6, 0x8E, 0xD6, 0x60, 0x8D, 0xF4, 0x5F, 0x3B, 0xA8, 0xF4, 0xD6, 0xCB,
+    0xBD, 0xB3, 0xE2, 0x2D, 0x3E, 0xDA, 0xD4, 0x97, 0x24, 0xBD, 0xC9, 0x2F, 0x97, 0x99, 0xDB, 0x75,
+    0x26, 0xC3, 0xE8, 0x3E, 0x70, 0x3A, 0x9C, 0x75, 0xE0, 0xC6, 0x4B, 0x18, 0x62, 0xE5, 0xA4, 0xDD,
+    0x4B, 0xD2, 0xEF, 0x4B, 0x76, 0x57, 0x27, 0xBD, 0x2B, 0x62, 0xEA, 0xF2, 0x1D, 0x15, 0xF3, 0x7D,
+    0x14, 0xB7, 0x21, 0xFF, 0xC0, 0x74, 0xD9, 0xD6, 0xF3, 0xE6, 0x77, 0xF8, 0x83, 0x4E, 0x38, 0x51,
+    0xAB, 0xAF, 0x14, 0x0A, 0x2D, 0x4C, 0x2B, 0x3E, 0xD1, 0x1D, 0x74, 0xEA, 0x9D, 0x4D, 0x93, 0x2B,
+    0x32, 0xC5, 0x3C, 0xA3, 0x6E, 0xB7, 0x37, 0x6B, 0xD4, 0x33, 0xED, 0x4E, 0xA1, 0xD2, 0x32, 0x25,
+    0x3A, 0xD9, 0x69, 0xED, 0x41, 0xAD, 0x5E, 0x11, 0x9F, 0x6A, 0x8D, 0x85, 0x96, 0x2E, 0xD1, 0xE4,
+    0x03, 0x8D, 0xFA, 0x52, 0x8B, 0x4F, 0x74, 0xFA, 0xA4, 0x22, 0x4A, 0x4E, 0xBD, 0xDD, 0xA2, 0xD2,
+    0xA9, 0xD4, 0xCC, 0x14, 0x9D, 0xA8, 0x34, 0x4E, 0x11, 0x9F, 0x2A, 0x8D, 0x06, 0x36, 0x70, 0x2A,
+    0xB5, 0x30, 0xAD, 0x4E, 0xC0, 0x0D, 0x77, 0xEE, 0x71, 0x53, 0x1D, 0x74, 0xB1, 0x3A, 0xEA, 0x03,
+    0x1F, 0xEB, 0xC3, 0xED, 0x4C, 0x8B, 0xDB, 0xDB, 0x1D, 0x2D, 0x6D, 0xEA, 0x52, 0xA1, 0xD9, 0x27,
+    0x9F, 0x2A, 0xCD, 0x3E, 0xFD, 0x5F, 0xB5, 0x9A, 0x31, 0xAF, 0xE7, 0xC6, 0x75, 0xC5, 0x7F, 0xE4,
+    0x40, 0xCB, 0x60, 0x59, 0x4C, 0xA5, 0x00, 0xD1, 0x02, 0x61, 0x1D, 0x05, 0xC6, 0x7C, 0x81, 0xD8,
+    0x43, 0xCB, 0x85, 0x0B, 0x17, 0xDE, 0x42, 0x0F, 0x41, 0xA2, 0x22, 0x75, 0x94, 0x62, 0xBF, 0x40,
+    0x12, 0xD2, 0x76, 0xE1, 0x22, 0xCD, 0x16, 0x56, 0xE3, 0x26, 0x2A, 0x14, 0x40, 0xDA, 0x2D, 0xB6,
+    0x75, 0x61, 0x6B, 0x46, 0x71, 0xA1, 0x22, 0x85, 0x19, 0x09, 0x4E, 0x93, 0x42, 0xE3, 0x78, 0x8D,
+    0x44, 0x4E, 0xA1, 0x91, 0x45, 0xC7, 0xDC, 0xD5, 0x90, 0x27, 0xC5, 0xF0, 0xFF, 0xDF, 0x95, 0x8D,
+    0xC0, 0x55, 0x58, 0x3C, 0x12, 0x24, 0xDF, 0xE3, 0xCC, 0xBD, 0x77, 0xCE, 0x3D, 0xE7, 0xCC, 0x03,
+    0x34, 0x6B, 0x06, 0x9F, 0xA6, 0x04, 0x6E, 0x75, 0x2B, 0xD8, 0xDD, 0xEE, 0xD0, 0xAB, 0x17, 0x18,
+    0xFD, 0x58, 0x11, 0x6E, 0xEE, 0xDE, 0xDC, 0xE5, 0xFF, 0x3C, 0x9A, 0x07, 0x0F, 0xB5, 0xD2, 0x4A,
+    0x2A, 0x20, 0x69, 0x87, 0x49, 0x12, 0xB8, 0xA7, 0x37, 0x23, 0xD8, 0x02, 0x60, 0x0E, 0x80, 0x56,
+    0x23, 0x80, 0x22, 0x80, 0xFF, 0xF5, 0xCD, 0x7D, 0x18, 0xA4, 0x15, 0x7A, 0xA9, 0x80, 0x91, 0x04,
+    0x8D, 0xA4, 0x11, 0x42, 0x02, 0xF0, 0x19, 0x60, 0x28, 0x00, 0xFD, 0x01, 0x60, 0xF4, 0xC6, 0xCD,
+    0xAB, 0x20, 0x49, 0xF5, 0x43, 0x33, 0x5E, 0x52, 0xC2, 0x4A, 0xDA, 0xE8, 0x24, 0x1D, 0xB4, 0x92,
+    0x34, 0x03, 0x10, 0x22, 0xD0, 0x28, 0x02, 0x46, 0x11, 0xE8, 0x15, 0x81, 0x41, 0x0B, 0xE0, 0xB5,
+    0x00, 0x21, 0x24, 0x68, 0xE4, 0x13, 0x98, 0xC3, 0x65, 0xE8, 0x8B, 0xCB, 0x30, 0xAC, 0x2E, 0x83,
+    0xCF, 0x2E, 0x43, 0x88, 0x6E, 0xA5, 0xD1, 0x3C, 0xAC, 0x18, 0x31, 0x6C, 0xF4, 0xBA, 0xB9, 0xB7,
+    0x61, 0x25, 0x15, 0xBC, 0xA4, 0x42, 0x90, 0x54, 0x90, 0xA4, 0x62, 0x24, 0x69, 0xEF, 0x05, 0xC3,
+    0x6E, 0x0F, 0x18, 0x0E, 0x5F, 0x60, 0x38, 0xC2, 0x06, 0x83, 0xF0, 0x52, 0x61, 0x92, 0x32, 0x41,
+    0x8A, 0x68, 0x86, 0xF3, 0xC7, 0x08, 0x8D, 0x80, 0x56, 0xAF, 0x82, 0x91, 0x12, 0x46, 0xDA, 0xE9,
+    0x24, 0xD1, 0x6F, 0xAD, 0xB0, 0x2B, 0xC2, 0x66, 0x0E, 0x86, 0xCC, 0x8E, 0x4B, 0x5D, 0xC1, 0x4B,
+    0x1B, 0x5E, 0xCA, 0x78, 0x29, 0x32, 0xE9, 0x80, 0xA0, 0xFB, 0x5F, 0x48, 0x92, 0x95, 0x46, 0x06,
+    0x29, 0xE3, 0x66, 0xB3, 0xE1, 0xC7, 0xA6, 0x30, 0xD1, 0x14, 0xDE, 0xC5, 0x6C, 0xEC, 0x0C, 0x19,
+    0x49, 0x4B, 0x73, 0x06, 0x2F, 0x63, 0xA4, 0x03, 0x93, 0x71, 0x73, 0x97, 0xB1, 0xB1, 0x4F, 0xD8,
+    0xC5, 0x2E, 0xB8, 0xC5, 0x46, 0x42, 0x1C, 0xFE, 0xED, 0x91, 0xA2, 0x93, 0x34, 0x7B, 0x49, 0x4C,
+    0xE7, 0xFC, 0x97, 0xF3, 0x6B, 0x46, 0x52, 0xC6, 0x49, 0x8A, 0x48, 0x3A, 0x30, 0x92, 0x36, 0x86,
+    0xF5, 0x9A, 0x10, 0x23, 0x80, 0x61, 0x03, 0x08, 0xCB, 0xF5, 0x46, 0x2D, 0x96, 0x29, 0x03, 0xAD,
+    0x66, 0xC0, 0xEE, 0xCF, 0xDD, 0x88, 0x80, 0x3D, 0x00, 0xFC, 0x06, 0x34, 0x5A, 0x80, 0x5E, 0x00,
+    0xBE, 0x00, 0x8D, 0x12, 0xD0, 0xD5, 0x22, 0x83, 0x5E, 0x12, 0x58, 0xE9, 0x80, 0x41, 0x2A, 0xE0,
+    0xA4, 0x02, 0x7E, 0xE9, 0x0B, 0xF8, 0x68, 0x37, 0x98, 0xA2, 0x5D, 0x41, 0xE3, 0x90, 0x41, 0xB8,
+    0x4C, 0x23, 0x7C, 0xA2, 0x3D, 0x98, 0x16, 0xCC, 0x4E, 0x88, 0x74, 0x05, 0x45, 0xFA, 0x0D, 0x45,
+    0xEC, 0xDA, 0x68, 0xC6, 0xE5, 0x56, 0x23, 0x21, 0x19, 0xD1, 0x2A, 0x1A, 0x31, 0x49, 0x52, 0x0A,
+    0xCF, 0x7E, 0xC6, 0x20, 0x49, 0x73, 0x90, 0x24, 0x42, 0xC4, 0x1C, 0x28, 0xD2, 0x17, 0x42, 0xC4,
+    0x6E, 0x97, 0xA4, 0xDC, 0x0E, 0x52, 0xC2, 0x4B, 0xA2, 0x91, 0xB4, 0xD2, 0xD7, 0x72, 0x4E, 0x40,
+    0xA3, 0x11, 0xE8, 0x0B, 0xF0, 0x85, 0x1B, 0xD2, 0x06, 0x5E, 0x5A, 0x40, 0x12, 0x74, 0x75, 0x4A,
+    0x4F, 0x5E, 0xBD, 0xAC, 0xAB, 0xEE, 0x00, 0x70, 0x2B, 0x80, 0x7E, 0x7A, 0xF3, 0x2A, 0xDD, 0x17,
+    0x93, 0x21, 0x8C, 0xA4, 0xC2, 0x20, 0x29, 0x23, 0xA9, 0x86, 0x55, 0x48, 0xC9, 0x0A, 0x5A, 0x2D,
+    0x5E, 0xAB, 0x15, 0x30, 0x6D, 0x56, 0xC5, 0x0A, 0xB0, 0x32, 0x3A, 0x7A, 0x8D, 0xD0, 0xEA, 0x5F,
+    0xA5, 0x1A, 0xE2, 0x69, 0x9B, 0xF4, 0x7E, 0xCD, 0x92, 0x9C, 0x3E, 0xD4, 0x0C, 0xB4, 0xFA, 0x17,
+    0x7D, 0x76, 0xAE, 0xEF, 0xCF, 0xF5, 0xB4, 0x5E, 0xD9, 0xCB, 0x57, 0xEA, 0xBA, 0xAC, 0x55, 0xE2,
+    0xAF, 0x57, 0x56, 0x52, 0xAA, 0x50, 0x72, 0xBD, 0xAA, 0xCB, 0xA3, 0x2E, 0x60, 0x49, 0xF5, 0x4A,
+    0x97, 0xC7, 0x8D, 0x24, 0x1D, 0xD7, 0x3F, 0xA8, 0x05, 0xE8, 0x54, 0xF4, 0x99, 0x76, 0xA0, 0x57,
+    0xF1, 0x5B, 0x50, 0x04, 0xAB, 0x32, 0xEC, 0x56, 0x05, 0x06, 0x95, 0x5E, 0x8D, 0x14, 0x71, 0x2A,
+    0x46, 0xD1, 0x6B, 0xC3, 0xAB, 0xA0, 0xD4, 0x49, 0x23, 0x34, 0x8F, 0x9E, 0x80, 0xD3, 0x01, 0xD2,
+    0x81, 0x79, 0xFA, 0xB0, 0x00, 0x7D, 0x06, 0x7C, 0x84, 0x56, 0xC0, 0xB4, 0xD2, 0x4B, 0x23, 0x4E,
+    0x09, 0x74, 0x8C, 0x34, 0xAF, 0x6B, 0x04, 0x04, 0x98, 0x02, 0xB8, 0x0C, 0x8D, 0xE2, 0x1F, 0x8F,
+    0xF7, 0x0E, 0x82, 0x94, 0x8D, 0xA4, 0xD9, 0x9E, 0x8B, 0x73, 0xE6, 0xCE, 0xB3, 0x25, 0xD9, 0xD6,
+    0x09, 0xF9, 0xC4, 0xED, 0x07, 0x74, 0x3B, 0x8D, 0x16, 0x42, 0x64, 0x2A, 0xD8, 0x82, 0x55, 0x44,
+    0xB3, 0xA9, 0xEB, 0x25, 0x68, 0x6C, 0x85, 0x53, 0xC6, 0xA7, 0x4E, 0xA2, 0xDB, 0x91, 0x12, 0x21,
+    0x7A, 0xED, 0xD8, 0x62, 0x0F, 0x45, 0xF4, 0x6D, 0x4D, 0x85, 0x61, 0x9D, 0x3E, 0xD4, 0x6C, 0x34,
+    0x6C, 0x61, 0xC5, 0x7F, 0x26, 0x2B, 0xBA, 0x43, 0xEF, 0x29, 0x13, 0xB4, 0xBA, 0x03, 0xAB, 0xC3,
+    0x68, 0x41, 0x8A, 0xA1, 0xE0, 0x94, 0xAD, 0xA2, 0xD1, 0xDE, 0x68, 0xC3, 0x6B, 0x76, 0x1A, 0x3B,
+    0x65, 0xA3, 0x4C, 0x28, 0x4C, 0x75, 0x74, 0x7F, 0xCD, 0xED, 0xFB, 0x60, 0x9F, 0xBC, 0x56, 0x6A,
+    0xE8, 0x23, 0xF4, 0x35, 0x29, 0x5E, 0x05, 0xE0, 0xDE, 0xB5, 0x90, 0x71, 0xF9, 0x02, 0xF2, 0x0F,
+    0xDE, 0x64, 0x5A, 0x18, 0x76, 0xFA, 0x42, 0xA7, 0x88, 0x22, 0x2A, 0xD8, 0x0D, 0xAF, 0xB9, 0xD1,
+    0xD8, 0x6B, 0xC5, 0xE5, 0x56, 0xC2, 0x1C, 0x4C, 0xCA, 0x4C, 0x8B, 0xD5, 0x41, 0x5F, 0x8C, 0xB4,
+    0xA0, 0xA8, 0x4F, 0x0A, 0x76, 0x73, 0xBF, 0x51, 0x6C, 0xF4, 0xF5, 0xDD, 0x6F, 0xF8, 0x4F, 0xF5,
+    0x0F, 0x1A, 0x8D, 0x7C, 0x56, 0x66, 0xFA, 0xA4, 0x0C, 0xA2, 0x97, 0x5E, 0x51, 0x42, 0x4A, 0x7E,
+    0xC7, 0xAA, 0xF4, 0x8A, 0xAD, 0x84, 0x0A, 0x5E, 0xCB, 0xA0, 0xD9, 0x68, 0x6B, 0xB5, 0x32, 0x09,
+    0x2F, 0x7A, 0xC5, 0x4E, 0x19, 0x70, 0xB9, 0xD7, 0x88, 0x2D, 0x9D, 0x66, 0xBA, 0xBD, 0xD3, 0x8C,
+    0x91, 0x51, 0x04, 0x7D, 0x47, 0x11, 0xC2, 0x07, 0x8A, 0xE0, 0x7F, 0xA5, 0x05, 0x86, 0x27, 0x5A,
+    0xA0, 0xDF, 0x95, 0x4E, 0x10, 0xA6, 0xA9, 0x13, 0xBF, 0x4C, 0x3F, 0x03, 0x4E, 0x19, 0xB0, 0xDA,
+    0x80, 0x5A, 0x43, 0xED, 0xE5, 0x25, 0x5D, 0xEB, 0xD7, 0xFF, 0x8F, 0x0E, 0xB0, 0xC5, 0x2B, 0xD1,
+    0xAB, 0xD7, 0x8E, 0xD1, 0x2C, 0x2D, 0x8D, 0x96, 0x41, 0x85, 0x90, 0x8D, 0xCE, 0x9E, 0x24, 0x8D,
+    0x98, 0x1A, 0xE5, 0x5A, 0xE5, 0x93, 0xB4, 0x82, 0x7F, 0xF2, 0x57, 0x05, 0x6C, 0x31, 0x82, 0x4E,
+    0x68, 0xA6, 0xD5, 0x18, 0x16, 0x50, 0xF4, 0x19, 0x7C, 0xB6, 0x05, 0xDC, 0xDA, 0x1D, 0x60, 0x4B,
+    0xAB, 0xF1, 0x44, 0x9A, 0x56, 0xE3, 0x94, 0x41, 0xD1, 0x6D, 0x30, 0x25, 0xBB, 0x83, 0x5B, 0x3B,
+    0xD5, 0x97, 0x66, 0xFA, 0x03, 0x2D, 0x38, 0x8D, 0x3E, 0x63, 0x15, 0x87, 0x42, 0xAF, 0xC5, 0x1E,
+    0x18, 0x2D, 0x46, 0x23, 0x37, 0x23, 0x37, 0xE3, 0x35, 0xB7, 0x46, 0x33, 0x76, 0xA7, 0xD7, 0x8C,
+    0xAB, 0xD5, 0x39, 0x9D, 0x45, 0xBA, 0x31, 0x28, 0x1A, 0x6D, 0x38, 0x2D, 0xBD, 0xD6, 0x1A, 0xFE,
+    0x8C, 0x57, 0xF2, 0xCA, 0x04, 0xE5, 0xA0, 0x84, 0xF4, 0xA9, 0xC2, 0x82, 0xC2, 0x67, 0x0A, 0xB1,
+    0xD1, 0xA4, 0xA2, 0xD8, 0xCA, 0x6B, 0xD3, 0x6C, 0xE4, 0xF4, 0x2B, 0x8D, 0xDD, 0xE1, 0xF4, 0xA1,
+    0xE8, 0x77, 0xA7, 0x1F, 0x0B, 0x5B, 0x06, 0x75, 0x07, 0xB6, 0x0C, 0x47, 0xBF, 0x33, 0x6C, 0x43,
+    0xB1, 0x05, 0xB7, 0xBE, 0x70, 0x77, 0x28, 0xF8, 0x0C, 0x6E, 0x63, 0xCA, 0xE0, 0x57, 0xA6, 0x54,
+    0xF9, 0x41, 0xAB, 0x11, 0x5B, 0xB0, 0x05, 0xA6, 0x84, 0xCF, 0xB4, 0x1A, 0x1B, 0xCD, 0xD8, 0x82,
+    0xDD, 0x61, 0xCA, 0xF5, 0x5E, 0x6C, 0x14, 0xB1, 0x07, 0xBD, 0xC0, 0xAF, 0xF8, 0x8D, 0x46, 0xB1,
+    0xD1, 0x82, 0x55, 0xBD, 0xB7, 0xE1, 0x0B, 0x8D, 0x16, 0x94, 0xE8, 0x45, 0xA7, 0x37, 0x6E, 0xA6,
+    0x82, 0xAB, 0xA8, 0x23, 0x49, 0x9A, 0x3B, 0x49, 0xDA, 0xEB, 0xBD, 0x0A, 0x9E, 0x8A, 0xA6, 0x82,
+    0xD1, 0x20, 0xD0, 0x8A, 0x36, 0x3A, 0x45, 0xA3, 0x05, 0xA7, 0x7A, 0x6F, 0x23, 0x14, 0xBA, 0x0A,
+    0x5C, 0x77, 0x2A, 0x29, 0x09, 0xD2, 0x89, 0x62, 0xF9, 0x84, 0x30, 0x68, 0xB5, 0xDD, 0x52, 0xA2,
+    0x55, 0xC2, 0x15, 0x1A, 0x25, 0x8C, 0x46, 0x94, 0x20, 0x2C, 0x84, 0x3A, 0x71, 0xBF, 0x42, 0x77,
+    0xE0, 0x0A, 0xB4, 0x9A, 0xED, 0x0E, 0x84, 0xC5, 0x08, 0xF0, 0x6B, 0xA3, 0x19, 0x6C, 0x21, 0x2C,
+    0xD0, 0xE9, 0x0C, 0xCC, 0x6C, 0x0B, 0xA0, 0xA5, 0x13, 0xA0, 0xDC, 0x28, 0xD3, 0x68, 0x63, 0xD2,
+    0xF7, 0x5E, 0x3B, 0x5B, 0x80, 0x0E, 0x3A, 0xD5, 0x11, 0xD4, 0x29, 0xD6, 0xC9, 0xCD, 0x98, 0x93,
+    0x42, 0xB9, 0x4A, 0xC7, 0xB8, 0xA7, 0xFF, 0xFA, 0x1D, 0xEA, 0xE7, 0xAE, 0xA1, 0x19, 0x9F, 0x6F,
+    0x2A, 0xA1, 0x02, 0x18, 0x66, 0xC7, 0x6E, 0x0C, 0x99, 0x69, 0x21, 0x44, 0x23, 0xCC, 0x81, 0x2D,
+    0xD8, 0x95, 0x29, 0x31, 0xC5, 0x56, 0xA3, 0x11, 0xB6, 0xA2, 0x43, 0x66, 0x5A, 0x1A, 0xCD, 0xAD,
+    0xE8, 0x77, 0x6C, 0xC1, 0x67, 0x7C, 0x42, 0xB1, 0xD1, 0xD8, 0x1D, 0xD8, 0x82, 0x5F, 0xF1, 0x19,
+    0xC5, 0x46, 0x73, 0x27, 0xFA, 0x9D, 0x61, 0xAD, 0xB0, 0xF3, 0xE0, 0xC1, 0x7D, 0x30, 0xD2, 0x0A,
+    0x4E, 0xDA, 0x40, 0xD2, 0x8A, 0xD9, 0xB9, 0x97, 0x19, 0x32, 0xBE, 0x62, 0x10, 0xE6, 0xA0, 0x2B,
+    0x0C, 0x2B, 0x53, 0x46, 0x3F, 0xBD, 0xA7, 0xF9, 0xD9, 0x88, 0x97, 0x4A, 0x5B, 0x8D, 0xA4, 0xC4,
+    0x20, 0x6D, 0x10, 0xF4, 0x04, 0x8C, 0xC6, 0x2B, 0xF9, 0x0C, 0xF9, 0x4A, 0x20, 0x87, 0x03, 0x20,
+    0xAC, 0xCF, 0x6E, 0x08, 0x20, 0x94, 0x2F, 0x06, 0xE7, 0x8E, 0x3E, 0xAE, 0x21, 0x4A, 0xE0, 0xA4,
+    0xBD, 0x36, 0xBA, 0x78, 0x72, 0x21, 0xA4, 0x5F, 0x3E, 0x02, 0xAF, 0x19, 0xE8, 0xB5, 0x00, 0x4D,
+    0xED, 0x78, 0x7E, 0x07, 0xE8, 0x6A, 0xC3, 0xD4, 0x5A, 0x3B, 0x64, 0xED, 0x1A, 0xE9, 0xD9, 0x73,
+    0x53, 0x9B, 0xE7, 0xE5, 0xE5, 0x4C, 0x33, 0x33, 0xE9, 0xE9, 0xDF, 0x6C, 0x35, 0x71, 0x23, 0xBE,
+    0x86, 0xA1, 0xA6, 0xB6, 0xE6, 0xE5, 0x24, 0xCD, 0x75, 0x9E, 0xF4, 0xD2, 0x5E, 0x9F, 0xA8, 0x38,
+    0x49, 0xDA, 0xBC, 0x24, 0xAD, 0x5E, 0x92, 0xF2, 0x54, 0x4B, 0x9C, 0x69, 0x01, 0xA8, 0x1F, 0xD3,
+    0x33, 0x2A, 0x5D, 0xD9, 0x59, 0x0D, 0x50, 0x27, 0xAE, 0x3C, 0xAC, 0xD2, 0xB3, 0xCA, 0xDA, 0x6A,
+    0xE0, 0x5C, 0xB9, 0x12, 0x36, 0xA6, 0xF5, 0x1A, 0x4A, 0xEA, 0x64, 0x95, 0xAE, 0x13, 0xAB, 0x33,
+    0xAA, 0x11, 0xE5, 0xF6, 0x5B, 0xB4, 0xEF, 0x60, 0x0B, 0x5D, 0xA1, 0x2F, 0xD8, 0x8D, 0x6E, 0x67,
+    0xC8, 0x98, 0x03, 0xBF, 0x60, 0x44, 0x88, 0xB4, 0x1A, 0x35, 0xD2, 0xE8, 0x3B, 0x07, 0xA0, 0xF7,
+    0x0B, 0xA0, 0x8F, 0xB6, 0x2B, 0x4C, 0x07, 0x2D, 0xC0, 0xA4, 0x08, 0xF8, 0x4A, 0x12, 0x8F, 0x67,
+    0x03, 0xAA, 0x04, 0xA9, 0xCA, 0x0B, 0x2D, 0x97, 0xA5, 0x69, 0x25, 0x60, 0xD0, 0x0E, 0x38, 0xAD,
+    0x80, 0xAF, 0xBF, 0xFF, 0xE4, 0xB9, 0xC4, 0xFE, 0xE9, 0x85, 0xAA, 0x15, 0xC2, 0x7F, 0xEB, 0x61,
+    0xE9, 0x57, 0xBB, 0x99, 0xEC, 0x09, 0x8B, 0x7D, 0x6F, 0x35, 0xC2, 0xF7, 0xD1, 0x16, 0x53, 0xDC,
+    0x1C, 0xD2, 0x94, 0x24, 0x49, 0x8D, 0x24, 0x6D, 0xE6, 0x0A, 0x21, 0x1B, 0xCD, 0x23, 0x1D, 0x23,
+    0xF8, 0xF5, 0x19, 0xB1, 0xD5, 0xEF, 0x23, 0xB6, 0x35, 0x01, 0x8A, 0xF4, 0x47, 0x1D, 0xF9, 0x94,
+    0xB1, 0x05, 0x8C, 0x46, 0xA3, 0x3A, 0x31, 0x2D, 0xD0, 0x68, 0xF1, 0x2B, 0x60, 0x55, 0x93, 0x11,
+    0x7E, 0xA3, 0xB9, 0xF6, 0xA8, 0x5A, 0x3E, 0xB5, 0x79, 0xB7, 0x27, 0xA9, 0x1A, 0x6A, 0xBC, 0xCF,
+    0x42, 0x3B, 0xEB, 0x91, 0xFE, 0xFA, 0x52, 0x7A, 0x86, 0x57, 0x38, 0x69, 0x05, 0x7A, 0xFD, 0x44,
+    0x11, 0x5A, 0x65, 0x15, 0x20, 0xEC, 0x9D, 0x12, 0x0C, 0x1A, 0xBD, 0xA0, 0x53, 0x32, 0x5A, 0x69,
+    0x6A, 0x73, 0x60, 0x12, 0x68, 0x07, 0xBA, 0x0D, 0x9B, 0x08, 0x63, 0xB3, 0x63, 0x33, 0x2E, 0x36,
+    0xC2, 0x14, 0x5C, 0x62, 0x9A, 0xCD, 0x4E, 0xBF, 0xE2, 0x23, 0xA2, 0x2B, 0xD8, 0x4C, 0x88, 0xED,
+    0x81, 0xDD, 0xF0, 0x0B, 0x1A, 0x4D, 0x61, 0xC8, 0x4C, 0xD1, 0x88, 0xBE, 0xE0, 0x13, 0x9A, 0xBB,
+    0x9D, 0x61, 0x25, 0xC4, 0x56, 0x27, 0x52, 0x68, 0xEE, 0x0E, 0x06, 0x49, 0x7B, 0x2B, 0x49, 0xD1,
+    0x4B, 0xDA, 0x3A, 0x9D, 0xD2, 0x44, 0x19, 0x30, 0xFB, 0x55, 0x7B, 0xD8, 0xED, 0x19, 0x05, 0x3B,
+    0x8F, 0x21, 0xB2, 0x9B, 0x0D, 0x17, 0x3D, 0xA6, 0x74, 0x19, 0x3F, 0xEF, 0x74, 0xAB, 0x8D, 0xA8,
+    0xDD, 0xB0, 0xD9, 0xD3, 0x1E, 0x5D, 0x62, 0x5A, 0xDE, 0xC5, 0x96, 0x7E, 0xED, 0x15, 0xC3, 0xF9,
+    0x81, 0xD1, 0x4B, 0x19, 0xED, 0x01, 0x6E, 0x6C, 0x02, 0x76, 0xC0, 0xC5, 0x93, 0x11, 0xFA, 0x19,
+    0xBA, 0x15, 0xFA, 0xD2, 0xBC, 0xDA, 0x6F, 0xF8, 0xEC, 0xB2, 0x5F, 0xD0, 0xAC, 0x28, 0xBA, 0xDD,
+    0x1C, 0x5D, 0xC1, 0xE5, 0x61, 0x75, 0x09, 0xCD, 0x21, 0x6A, 0xEC, 0x76, 0x73, 0x98, 0x82, 0xCB,
+    0x76, 0x1D, 0x32, 0x8A, 0x53, 0x0C, 0xB3, 0x39, 0x5A, 0x99, 0x9D, 0x61, 0xED, 0x37, 0x9B, 0x09,
+    0xD1, 0x2F, 0x53, 0x34, 0x42, 0xED, 0x81, 0x5D, 0xBB, 0x62, 0x57, 0xA6, 0xE8, 0x16, 0x1F, 0x5B,
+    0xA1, 0x46, 0xD8, 0xCD, 0x94, 0x7E, 0xC3, 0x2F, 0x43, 0xF2, 0x4B, 0x53, 0x91, 0xBD, 0x97, 0x4E,
+    0x16, 0x7A, 0x62, 0x9D, 0x54, 0x41, 0xBF, 0x00, 0xB7, 0xDE, 0x86, 0xDB, 0x6F, 0xFF, 0xFE, 0xB1,
+    0x99, 0xBD, 0x95, 0x29, 0x0C, 0x75, 0x6C, 0x21, 0xFA, 0x18, 0x66, 0x73, 0x34, 0x32, 0x3B, 0x36,
+    0x3F, 0x3F, 0xB6, 0xE3, 0xB7, 0xC6, 0x96, 0x7C, 0x6C, 0x0F, 0xF4, 0x55, 0x61, 0xD7, 0x3A, 0xB6,
+    0xF8, 0x6C, 0x6C, 0x8F, 0x7B, 0x49, 0x52, 0xF2, 0x75, 0x54, 0xD2, 0x35, 0x73, 0xB5, 0x2E, 0xAB,
+    0x6F, 0x70, 0x2A, 0xC7, 0xD3, 0x38, 0xE8, 0x76, 0x00, 0x5E, 0xBC, 0xCB, 0x8B, 0x37, 0x6F, 0xD3,
+    0x48, 0x2B, 0x5D, 0x65, 0xF6, 0x02, 0xDA, 0x0D, 0xB0, 0x0B, 0xE0, 0x47, 0x68, 0x0A, 0x60, 0x2B,
+    0x6B, 0x7B, 0x4C, 0x23, 0xED, 0xD5, 0x6B, 0xF0, 0x3F, 0x7D, 0xB4, 0x72, 0xE0, 0x52, 0xB7, 0x12,
+    0x66, 0x17, 0xCD, 0x81, 0x70, 0x6B, 0xB7, 0x75, 0x8A, 0x4E, 0xDA, 0x91, 0x94, 0x4C, 0xED, 0xEB,
+    0xA7, 0x91, 0x70, 0x51, 0xD2, 0x67, 0x1B, 0xB4, 0xE5, 0x8B, 0xE7, 0x61, 0xA3, 0x5F, 0x2A, 0xB0,
+    0xD8, 0x58, 0xA1, 0x65, 0x38, 0xCF, 0x2E, 0x56, 0xB2, 0xEF, 0x67, 0x60, 0x5A, 0xF0, 0x63, 0x2D,
+    0xC5, 0xE9, 0x9C, 0x53, 0xA0, 0x1A, 0x00, 0xBA, 0xA9, 0x32, 0x4F, 0x5A, 0x69, 0xAB, 0x26, 0xC4,
+    0x88, 0x56, 0xD2, 0x68, 0x0E, 0x4C, 0x41, 0x73, 0xBF, 0x63, 0x36, 0xC2, 0x6C, 0x77, 0xFA, 0x95,
+    0x30, 0xDB, 0x82, 0xCD, 0x68, 0x1E, 0x0A, 0x36, 0xB7, 0xC2, 0x6D, 0x0C, 0xC9, 0x09, 0xBF, 0xD5,
+    0xA6, 0x33, 0xAD, 0xD5, 0x1F, 0x08, 0x19, 0x2F, 0x25, 0x94, 0xAB, 0x41, 0x70, 0x51, 0x57, 0x0F,
+    0x4F, 0xBD, 0x65, 0x56, 0xA0, 0x00, 0x13, 0xE0, 0xE6, 0x1A, 0x42, 0xB3, 0x9E, 0x11, 0x0C, 0x67,
+    0x00, 0x07, 0x69, 0xE9, 0xA5, 0x62, 0xF6, 0xBF, 0xD4, 0x78, 0xE0, 0xD2, 0x34, 0xF6, 0x9B, 0x8B,
+    0xE6, 0xB0, 0xB9, 0xD5, 0xD7, 0xB7, 0x4E, 0xFF, 0x2C, 0x69, 0x39, 0x13, 0x9A, 0x9E, 0x0F, 0xDD,
+    0x4B, 0xDF, 0xAB, 0xAA, 0xAE, 0x62, 0x6A, 0x05, 0x0C, 0x69, 0xA6, 0xD3, 0x18, 0x0A, 0x8D, 0xC6,
+    0x46, 0x0B, 0x7E, 0xC1, 0x1E, 0xF4, 0x1B, 0x4C, 0xB9, 0xF9, 0xF8, 0x62, 0x0A, 0xE0, 0x13, 0xD5,
+    0x46, 0x38, 0xBB, 0xF5, 0xE9, 0x35, 0xBD, 0x78, 0x73, 0x73, 0xEA, 0xCB, 0x8D, 0x66, 0xC4, 0x08,
+    0xAF, 0xF1, 0x56, 0xD5, 0x5D, 0xDA, 0x6B, 0xB9, 0xCF, 0xA6, 0xF6, 0xB1, 0x6A, 0xD1, 0x34, 0xB5,
+    0x01, 0x56, 0x99, 0x4D, 0xAF, 0x63, 0xFC, 0x1D, 0x4A, 0xF3, 0xC2, 0x48, 0xD8, 0xC0, 0x2E, 0xBD,
+    0x34, 0x32, 0x44, 0x2F, 0x45, 0x5C, 0x94, 0x94, 0xF0, 0xDF, 0xD6, 0x63, 0x97, 0xF1, 0x5F, 0x17,
+    0x36, 0x33, 0xD9, 0x42, 0x9F, 0x79, 0x77, 0x58, 0xE9, 0x33, 0x52, 0xAA, 0xA7, 0x88, 0x4D, 0x4D,
+    0x3D, 0xB5, 0xD2, 0x88, 0x5B, 0x8C, 0x04, 0x3E, 0x76, 0x12, 0x84, 0xB9, 0x4F, 0x1A, 0x1B, 0x8D,
+    0x76, 0x51, 0xEC, 0x85, 0x7D, 0x4F, 0x87, 0x76, 0x86, 0x28, 0xA9, 0xE0, 0xC6, 0x3A, 0x58, 0x26,
+    0x69, 0xC1, 0x33, 0x48, 0xF0, 0xF7, 0xB4, 0x7A, 0xFC, 0xFC, 0x10, 0x5F, 0x3A, 0x5D, 0xB2, 0xE3,
+    0xD2, 0xC3, 0xDD, 0x2F, 0xFE, 0xBC, 0xC0, 0x34, 0x9A, 0x02, 0xC2, 0x14, 0x9A, 0x83, 0x6E, 0xA3,
+    0xDD, 0xB1, 0x2B, 0x66, 0xC7, 0x66, 0x8C, 0x18, 0xF2, 0xE9, 0xCB, 0x9C, 0xFD, 0x5F, 0x17, 0x13,
+    0x21, 0x9E, 0xC2, 0xC3, 0x96, 0x41, 0x11, 0x9F, 0x8D, 0x66, 0xA6, 0xD4, 0x69, 0x44, 0x8B, 0xD5,
+    0xD8, 0x2A, 0x5A, 0xD1, 0x29, 0x0E, 0xC2, 0x6A, 0xF6, 0x07, 0x4E, 0xB3, 0xDF, 0xF1, 0x1A, 0xA7,
+    0x9D, 0x17, 0x6F, 0xB8, 0x79, 0xF5, 0xE2, 0x04, 0x1E, 0x23, 0xF8, 0x1A, 0xF4, 0x1D, 0xFF, 0x54,
+    0x6B, 0x7B, 0x10, 0xA2, 0x4D, 0x8D, 0x08, 0x74, 0xC5, 0xAC, 0x0C, 0x69, 0x88, 0x4C, 0xE3, 0x4E,
+    0xBB, 0x9B, 0x8C, 0xCD, 0x36, 0x12, 0xE2, 0xF4, 0xC6, 0x3D, 0x35, 0x97, 0x0E, 0x99, 0xAC, 0xA4,
+    0xD1, 0x4A, 0x85, 0xFE, 0xB7, 0xF2, 0x33, 0x03, 0x7C, 0x09, 0xE0, 0x4E, 0x82, 0x5B, 0x95, 0x35,
+    0x6B, 0x85, 0x49, 0x8A, 0xA7, 0x13, 0x32, 0x3D, 0xB9, 0x19, 0x4F, 0x0B, 0xC8, 0x67, 0xA0, 0xD1,
+    0xBD, 0x27, 0x95, 0x79, 0xF1, 0xCC, 0x69, 0x39, 0xE8, 0xF5, 0xEB, 0x50, 0xF0, 0x3B, 0x21, 0xA3,
+    0xD4, 0x28, 0x1A, 0xD1, 0x89, 0x61, 0xC3, 0x6D, 0x4C, 0xA9, 0xD1, 0xD2, 0x68, 0x71, 0x3A, 0x23,
+    0x66, 0x75, 0xDA, 0x67, 0x95, 0x63, 0x8E, 0x17, 0xFB, 0xB0, 0xB9, 0x5B, 0x7B, 0x66, 0xC2, 0x4A,
+    0x63, 0xF7, 0xF4, 0x51, 0x36, 0x85, 0x9D, 0x1D, 0xCF, 0x84, 0x9F, 0x5D, 0xD5, 0xFF, 0xD1, 0x48,
+    0xA5, 0x2D, 0x84, 0xF1, 0xC0, 0x26, 0x3F, 0x76, 0xDB, 0xF0, 0x8B, 0xD7, 0xF6, 0x5E, 0x92, 0x91,
+    0xF4, 0x55, 0x49, 0x63, 0xD0, 0x93, 0xBA, 0x2E, 0x0A, 0x92, 0x72, 0x27, 0x69, 0x76, 0x4F, 0x1F,
+    0xBC, 0x83, 0xE2, 0x89, 0x81, 0x6E, 0x3D, 0xF1, 0xCF, 0xE8, 0x42, 0xAD, 0x42, 0x3A, 0x19, 0x98,
+    0x2D, 0xA7, 0x47, 0x66, 0x14, 0x4F, 0x0A, 0x36, 0xAD, 0xD0, 0x3C, 0x98, 0xCF, 0x16, 0xAF, 0x11,
+    0x7B, 0xE6, 0x39, 0xD3, 0x56, 0xFA, 0xD9, 0xED, 0x30, 0x7D, 0x5B, 0xE0, 0x17, 0x45, 0x6C, 0xF6,
+    0x89, 0x7E, 0x1B, 0x56, 0xCC, 0xDE, 0x17, 0x5A, 0xB5, 0xA2, 0xD5, 0xA8, 0xB9, 0xD5, 0xEC, 0x97,
+    0x3F, 0xD4, 0x2F, 0xEE, 0x3D, 0xF9, 0x86, 0x24, 0x7D, 0x20, 0x49, 0x39, 0x48, 0xDA, 0x9C, 0xA4,
+    0xD2, 0x6F, 0x98, 0xC3, 0x1C, 0x34, 0xE2, 0xC1, 0xC8, 0x83, 0x11, 0xB8, 0xF3, 0x04, 0x1A, 0x69,
+    0xA6, 0x97, 0x12, 0x6E, 0xEB, 0x32, 0xD3, 0xD2, 0xAE, 0xE8, 0xFB, 0x61, 0xBB, 0x66, 0x79, 0xEB,
+    0x24, 0xAD, 0xBD, 0x1E, 0xDC, 0x54, 0x74, 0xB6, 0x6B, 0x25, 0x8F, 0xB7, 0xA2, 0x95, 0x14, 0xBB,
+    0xCB, 0xD2, 0x9D, 0xAB, 0x9C, 0xBE, 0xA3, 0xFB, 0xF0, 0xFA, 0x9B, 0xB7, 0xDE, 0xE1, 0xE5, 0xFB,
+    0x2F, 0xBD, 0x83, 0x2F, 0xDD, 0xCE, 0x14, 0xFD, 0xC6, 0x70, 0x74, 0x07, 0x8A, 0x4A, 0xF4, 0x32,
+    0x47, 0xA3, 0xAF, 0x69, 0xC6, 0xE8, 0xC7, 0x6A, 0x65, 0x0F, 0x68, 0xF4, 0xA1, 0xCC, 0xEE, 0x37,
+    0x20, 0x7C, 0xA6, 0xBE, 0x28, 0x01, 0xFE, 0xA9, 0xEC, 0xE7, 0x9A, 0x6B, 0x60, 0x86, 0x6A, 0x23,
+    0xF5, 0xD2, 0xA4, 0xED, 0xB4, 0x2E, 0xC3, 0x85, 0x6D, 0x5D, 0x3D, 0x64, 0x5D, 0x2C, 0xA8, 0xEE,
+    0xDA, 0x98, 0x4E, 0x09, 0x78, 0x7A, 0x51, 0x2A, 0x40, 0xAF, 0x5D, 0x45, 0x02, 0xBC, 0x7E, 0xA6,
+    0x32, 0x29, 0xD2, 0x48, 0xDF, 0xD2, 0xE6, 0x94, 0xE9, 0x75, 0x34, 0x5A, 0xAD, 0x0A, 0x5E, 0x5B,
+    0xA3, 0xDC, 0x49, 0xD0, 0x8C, 0x74, 0x5A, 0x90, 0xF8, 0x23, 0x56, 0xB0, 0x23, 0x4D, 0xE6, 0xE5,
+    0x83, 0x5E, 0x23, 0xDA, 0x60, 0x88, 0x50, 0xB8, 0xEF, 0xA2, 0xD3, 0x66, 0x24, 0x82, 0x96, 0x26,
+    0x24, 0xAA, 0xA6, 0x19, 0x12, 0x4A, 0xFD, 0x8A, 0x56, 0x53, 0x08, 0x05, 0x11, 0xC4, 0x34, 0x07,
+    0xCD, 0x6E, 0x09, 0x5A, 0x6C, 0x9E, 0x3E, 0xC9, 0xA6, 0x4C, 0x3F, 0x2F, 0xCD, 0x31, 0xFD, 0xEC,
+    0x20, 0x84, 0xAC, 0xD9, 0x2B, 0xFB, 0x65, 0x50, 0x1E, 0x72, 0xAF, 0xDC, 0x17, 0xA3, 0xD5, 0x1C,
+    0x68, 0x6D, 0x34, 0x4E, 0x2B, 0x21, 0xBE, 0xF4, 0x36, 0x2F, 0xBF, 0x09, 0xDC, 0xE5, 0x45, 0x08,
+    0xA3, 0x5B, 0xAA, 0xAD, 0xDC, 0x4B, 0x2B, 0x9C, 0x46, 0x7D, 0x02, 0x5E, 0xB8, 0x0A, 0xC0, 0x11,
+    0xB0, 0xB1, 0x5F, 0xE9, 0x72, 0x57, 0x68, 0x37, 0x23, 0x28, 0x46, 0x33, 0xDE, 0x68, 0x61, 0xF8,
+    0xB6, 0x32, 0xF6, 0x83, 0xCF, 0x0B, 0xE6, 0xD3, 0x7D, 0xA7, 0x29, 0x25, 0xC0, 0xBB, 0xBB, 0x8F,
+    0xF8, 0xC3, 0x25, 0x86, 0xC3, 0xAE, 0xF4, 0xEA, 0x0A, 0x46, 0xAD, 0x40, 0xA3, 0x66, 0x68, 0xF6,
+    0xBE, 0x60, 0x8A, 0xCB, 0x74, 0x6B, 0x88, 0xD8, 0x5F, 0x09, 0x86, 0x7F, 0x2F, 0xE0, 0x3E, 0xC9,
+    0x27, 0x1F, 0x0F, 0x07, 0xA0, 0x0D, 0x5A, 0xAD, 0x60, 0xB4, 0x9F, 0x16, 0x8C, 0xFD, 0x8D, 0x16,
+    0x86, 0x4F, 0xB5, 0xE2, 0x93, 0x76, 0x7C, 0xF4, 0x1A, 0x69, 0xA5, 0x88, 0xD7, 0x86, 0x91, 0x46,
+    0x26, 0x93, 0xE9, 0xF3, 0x04, 0xBB, 0x4D, 0x0C, 0x71, 0xA7, 0x2D, 0x43, 0xC4, 0xBF, 0x52, 0xE8,
+    0xB2, 0x9F, 0x79, 0xB7, 0x5B, 0xB1, 0x4B, 0xA0, 0x29, 0x36, 0xA1, 0x79, 0xC7, 0xAD, 0x43, 0x34,
+    0x7B, 0x5B, 0x9E, 0x19, 0x5D, 0x2E, 0x19, 0xD1, 0xED, 0x55, 0x8D, 0xF6, 0x1A, 0x5D, 0x41, 0x6B,
+    0xA7, 0xD9, 0x6A, 0xD6, 0xD6, 0x68, 0x73, 0x1A, 0xBD, 0xDE, 0x57, 0x36, 0x9F, 0x17, 0x89, 0x69,
+    0xD2, 0x47, 0xA9, 0xFF, 0x4C, 0x4F, 0x77, 0xE4, 0xE5, 0xE3, 0xF0, 0x73, 0xFD, 0x67, 0x69, 0x77,
+    0x57, 0xC2, 0xEC, 0x3F, 0xD0, 0x37, 0x57, 0x53, 0xDC, 0xA7, 0x1A, 0xC3, 0x7B, 0xC5, 0x67, 0xBB,
+    0x61, 0x04, 0xB7, 0xDE, 0xE2, 0xF6, 0x9B, 0xB8, 0x85, 0x69, 0x46, 0xB4, 0xFB, 0x49, 0x8A, 0x5D,
+    0x62, 0x8A, 0x68, 0x6C, 0x0F, 0xBA, 0x82, 0x5D, 0x71, 0x99, 0x29, 0xA2, 0xB9, 0x15, 0xDD, 0x8E,
+    0xDD, 0x70, 0x57, 0x7A, 0x47, 0x57, 0xDB, 0x49, 0x95, 0xE7, 0xBF, 0x7C, 0x78, 0xD1, 0xD0, 0xAE,
+    0xAA, 0xDF, 0x58, 0xD5, 0xDB, 0xBD, 0x15, 0x3A, 0x09, 0x9C, 0x14, 0x09, 0x4F, 0x95, 0x1A, 0x45,
+    0x97, 0x8D, 0x18, 0x72, 0x57, 0xB0, 0xD9, 0x6E, 0x0C, 0xD9, 0x66, 0x86, 0x3C, 0x64, 0x5C, 0x72,
+    0x09, 0xBF, 0xF8, 0x44, 0x88, 0x3E, 0xB7, 0xA7, 0xF3, 0xEF, 0x4E, 0x8A, 0x54, 0xB0, 0x67, 0x6B,
+    0x99, 0x61, 0xDA, 0x4E, 0x7F, 0x37, 0x0E, 0x92, 0x52, 0x2F, 0x69, 0x35, 0xBA, 0x79, 0xAD, 0xD4,
+    0xD1, 0x4E, 0x0B, 0x9A, 0x5D, 0xC6, 0x2F, 0xB6, 0xE0, 0xB2, 0x39, 0xB0, 0xA5, 0xD1, 0x68, 0x0E,
+    0x42, 0x6C, 0x34, 0xFA, 0x4C, 0x88, 0xC3, 0x86, 0xCF, 0xFD, 0xCE, 0xB0, 0x19, 0xD1, 0xEF, 0x54,
+    0x9B, 0x3D, 0xA1, 0xF8, 0xD2, 0x9B, 0xBC, 0x5E, 0x8D, 0xD4, 0xBF, 0x00, 0x9A, 0x63, 0x12, 0x17,
+    0x63, 0xBF, 0xAD, 0x8D, 0xCD, 0x6B, 0x9C, 0xC0, 0x28, 0x9A, 0x0C, 0xD3, 0x8A, 0x87, 0x5E, 0x98,
+    0x0C, 0x4A, 0x4C, 0x60, 0x0B, 0x7D, 0xA2, 0x51, 0x64, 0x07, 0xBF, 0x33, 0x5D, 0x35, 0x79, 0xB8,
+    0xEC, 0x18, 0x28, 0xD2, 0xAA, 0x1A, 0x70, 0x9F, 0xAB, 0x40, 0x77, 0xDC, 0xFA, 0xF8, 0xCA, 0x3F,
+    0xAB, 0xAE, 0xAD, 0xDA, 0xB7, 0x6E, 0x4D, 0x9C, 0x82, 0xF7, 0x7C, 0xEE, 0x36, 0x80, 0xE6, 0xF9,
+    0xCE, 0x75, 0x6F, 0xA3, 0xD7, 0x81, 0xD7, 0x8E, 0x8E, 0xD2, 0x6A, 0xC6, 0xEC, 0xD0, 0x6F, 0x15,
+    0xF8, 0x86, 0x5C, 0x39, 0x8E, 0x3F, 0x0D, 0x2D, 0xBF, 0x7E, 0x09, 0x27, 0x61, 0x2B, 0x12, 0x2E,
+    0x4C, 0x47, 0xDD, 0x69, 0x9A, 0x24, 0xFD, 0x87, 0x24, 0x7D, 0xF3, 0xE3, 0xF0, 0xFD, 0x52, 0x35,
+    0x8D, 0xCD, 0xC0, 0x14, 0xA1, 0x3D, 0x2E, 0x38, 0x3A, 0x2D, 0xA7, 0xBE, 0xA9, 0x8D, 0x21, 0x9D,
+    0x1B, 0x6F, 0xB6, 0x70, 0x31, 0xCC, 0x66, 0xB8, 0xFD, 0xCE, 0x49, 0xAC, 0xAB, 0x4B, 0xD3, 0x6F,
+    0xD8, 0xC2, 0x90, 0xE9, 0x77, 0x7C, 0xA2, 0x3B, 0x6A, 0x58, 0xD0, 0x88, 0xD1, 0x2B, 0x07, 0xB4,
+    0xFA, 0x6E, 0x81, 0x46, 0x3F, 0x79, 0xA6, 0xB0, 0xAB, 0xF1, 0x1E, 0x34, 0xC3, 0x69, 0x1A, 0x57,
+    0x85, 0xED, 0xAB, 0xE4, 0x5F, 0xAF, 0x7B, 0x17, 0x35, 0x30, 0x77, 0x34, 0x53, 0x29, 0x0D, 0x4E,
+    0x05, 0xF0, 0xCF, 0x29, 0xEC, 0x69, 0xFB, 0x42, 0xAB, 0x1F, 0x2A, 0x29, 0xCD, 0x40, 0x1B, 0x2E,
+    0x9C, 0x4F, 0x11, 0x3D, 0xD5, 0x43, 0xE1, 0xD7, 0x21, 0xD9, 0xB5, 0x2B, 0xED, 0x4E, 0x18, 0x85,
+    0x8F, 0xFD, 0x3A, 0x24, 0x53, 0xD0, 0x2B, 0x3B, 0x61, 0x1E, 0xB2, 0x8B, 0x76, 0x35, 0x32, 0x05,
+    0x11, 0x92, 0xCB, 0x43, 0x9E, 0x4A, 0x85, 0xE9, 0xD1, 0x56, 0x37, 0xCF, 0xD5, 0xE4, 0xDE, 0x93,
+    0x1E, 0x53, 0x25, 0xDA, 0x69, 0xE4, 0x9F, 0xF1, 0xA4, 0xA9, 0xBA, 0xC3, 0x2D, 0x5C, 0xB5, 0xE3,
+    0x79, 0xF4, 0x85, 0x6E, 0xC7, 0xEC, 0xD4, 0xAD, 0xC0, 0x69, 0xA1, 0x51, 0xA3, 0x11, 0xF4, 0xDD,
+    0x03, 0x08, 0x1F, 0x6D, 0x27, 0x25, 0xB8, 0x88, 0xE9, 0xEA, 0x0E, 0xB9, 0xBD, 0x36, 0x92, 0xDA,
+    0x62, 0x46, 0x6A, 0x43, 0xC6, 0x6F, 0x4A, 0x34, 0x4A, 0x21, 0xD3, 0x69, 0x9E, 0x36, 0x86, 0x03,
+    0xBF, 0xF3, 0xF2, 0xDB, 0xBC, 0xF4, 0x0E, 0xF8, 0xD4, 0xA8, 0x4A, 0xDD, 0xBE, 0xE0, 0x93, 0xA9,
+    0xFB, 0x7F, 0xB3, 0x29, 0xF8, 0xD8, 0x88, 0x21, 0x13, 0xE6, 0x7E, 0xC3, 0x2F, 0x95, 0xE4, 0x89,
+    0xAE, 0x30, 0xC5, 0xF6, 0xC0, 0x25, 0xC2, 0x68, 0x57, 0x7C, 0x34, 0xC7, 0xEB, 0x8F, 0xAA, 0xAE,
+    0x8A, 0x93, 0xA4, 0xC5, 0x49, 0xCA, 0x75, 0xAB, 0x14, 0xBA, 0x72, 0x91, 0x58, 0x75, 0x77, 0xE9,
+    0x66, 0xA4, 0x9D, 0x6F, 0x37, 0xB9, 0x8B, 0x3F, 0x68, 0xF3, 0x9F, 0xB1, 0x0D, 0xFC, 0x5D, 0x3F,
+    0x3A, 0x13, 0x87, 0xB8, 0xBA, 0xEC, 0xB5, 0x59, 0xED, 0x84, 0x7F, 0x84, 0x3E, 0x62, 0x12, 0xCD,
+    0x0A, 0x3F, 0x04, 0x9F, 0x5F, 0xB8, 0xEB, 0x97, 0xEE, 0x30, 0xEA, 0x0A, 0x21, 0xFA, 0x25, 0x44,
+    0x5B, 0xBA, 0xD2, 0x6F, 0xA7, 0x70, 0x1C, 0x56, 0xBB, 0xD9, 0xDC, 0x0A, 0x7D, 0x55, 0xF8, 0x3C,
+    0x64, 0x97, 0x4E, 0xDD, 0x38, 0x2D, 0x2E, 0xF9, 0xD8, 0x17, 0xB3, 0x77, 0x05, 0xCD, 0x3E, 0x86,
+    0xD9, 0xAE, 0xDD, 0xD6, 0xAF, 0x8D, 0xDE, 0xD0, 0x1B, 0x3A, 0x7B, 0xEC, 0xE9, 0xAF, 0x56, 0xF5,
+    0x7A, 0x91, 0xAD, 0xFF, 0x6F, 0x1F, 0x7D, 0xCB, 0x49, 0x27, 0x33, 0x93, 0xB2, 0x97, 0xA4, 0xFD,
+    0x39, 0x3D, 0x3A, 0x9C, 0x24, 0x81, 0x67, 0x6B, 0xBF, 0xBF, 0xAE, 0xFD, 0x49, 0xB1, 0xD5, 0xCE,
+    0xAD, 0x87, 0x19, 0xFA, 0x08, 0x5F, 0x01, 0x36, 0xE8, 0xF4, 0x18, 0xA7, 0x95, 0xE3, 0x51, 0xEE,
+    0x92, 0x8D, 0x6E, 0xF4, 0x94, 0xB6, 0x98, 0x7C, 0x2F, 0x0D, 0x12, 0x41, 0xAB, 0xA9, 0x24, 0xA4,
+    0x1E, 0xDF, 0x7B, 0x56, 0x8B, 0xCD, 0xC1, 0x9F, 0x40, 0xB3, 0xF3, 0x65, 0x68, 0x0B, 0x7F, 0x0B,
+    0x66, 0xE3, 0x87, 0x60, 0x56, 0x36, 0xE8, 0x32, 0x2B, 0xF4, 0xB9, 0x7D, 0x7A, 0x1F, 0x9B, 0x8C,
+    0x0E, 0xEC, 0x62, 0xA4, 0x79, 0x88, 0xDD, 0xE2, 0xA2, 0x8F, 0x7D, 0xB4, 0xD1, 0x47, 0x1B, 0x5D,
+    0x9C, 0x66, 0xFB, 0x2D, 0x8D, 0x61, 0x1C, 0x24, 0x34, 0x7A, 0x95, 0x46, 0x78, 0x2D, 0xD5, 0x02,
+    0x69, 0xDF, 0x85, 0x17, 0xA0, 0x4D, 0xF0, 0x15, 0xE8, 0x16, 0xF8, 0x21, 0xD8, 0x08, 0x1B, 0x0C,
+    0xBA, 0xDF, 0x4A, 0xB3, 0x7F, 0x58, 0x4C, 0xB2, 0xCB, 0x8F, 0xD8, 0x6D, 0x1C, 0x62, 0xB9, 0x53,
+    0x06, 0xE9, 0x15, 0x69, 0xF1, 0x97, 0xCD, 0x3A, 0x80, 0xF0, 0x18, 0xA4, 0x0D, 0xFB, 0x78, 0x48,
+    0x2C, 0x78, 0xC0, 0x6C, 0x17, 0x0F, 0x64, 0xC3, 0x4A, 0x73, 0x25, 0xEB, 0x08, 0xF0, 0xE9, 0x0F,
+    0x18, 0x4A, 0xF3, 0x34, 0x68, 0xF4, 0xD2, 0xD2, 0x4A, 0x99, 0x36, 0x3C, 0xFE, 0xA2, 0x16, 0xBB,
+    0x75, 0x8C, 0xFC, 0xC8, 0x68, 0xC7, 0x46, 0x29, 0x53, 0xFC, 0xAF, 0xA7, 0x71, 0xF8, 0xC6, 0xD6,
+    0x6E, 0x6D, 0x3E, 0x18, 0x66, 0x7F, 0x2F, 0x36, 0x9B, 0xD1, 0x8A, 0x1B, 0x27, 0xD1, 0xE6, 0x5E,
+    0x09, 0x8F, 0x0E, 0xFA, 0x64, 0x3F, 0x4A, 0xEC, 0x4D, 0x16, 0x53, 0x74, 0xF6, 0x08, 0x9B, 0x49,
+    0x92, 0xF8, 0x72, 0x27, 0x2D, 0x5D, 0x74, 0x5A, 0xF9, 0x01, 0xF7, 0xD6, 0xEB, 0x77, 0x6E, 0xEE,
+    0x32, 0xD4, 0x6D, 0x7C, 0xDC, 0x6C, 0x17, 0xBB, 0x98, 0xD5, 0xAC, 0x1C, 0xEC, 0xF8, 0xD9, 0x47,
+    0x9B, 0xFB, 0xE3, 0x61, 0x41, 0x15, 0x90, 0x97, 0x4E, 0x5A, 0x4D, 0xB9, 0x73, 0xB4, 0x47, 0xA3,
+    0x59, 0xF3, 0x94, 0xA7, 0x34, 0x14, 0xB7, 0x75, 0xB2, 0x6A, 0xF4, 0xBE, 0xE2, 0xB4, 0x42, 0xBF,
+    0xBA, 0x05, 0xF4, 0xB5, 0x1D, 0x86, 0x3C, 0x45, 0x8C, 0x6C, 0x81, 0xE9, 0x53, 0x45, 0x6E, 0xBD,
+    0xF3, 0xD2, 0x5B, 0xFC, 0xFE, 0xE3, 0xCE, 0x13, 0x60, 0xD0, 0x46, 0x65, 0xD1, 0xAD, 0xE6, 0x89,
+    0x4A, 0xA3, 0xED, 0x93, 0x87, 0x9A, 0x9B, 0xAB, 0xA1, 0x33, 0x77, 0x92, 0x56, 0xC2, 0xD3, 0x7F,
+    0xBA, 0x7B, 0x42, 0x97, 0xC6, 0x0B, 0x95, 0x46, 0x52, 0xA1, 0xBB, 0xFC, 0x8F, 0xC4, 0x76, 0xEE,
+    0x4D, 0x35, 0xE1, 0x09, 0xFC, 0x2F, 0xE5, 0xBD, 0x3D, 0xD0, 0xE5, 0xD8, 0x79, 0xE7, 0xF7, 0x03,
+    0xA0, 0x6E, 0x94, 0x07, 0xE5, 0x3D, 0x0C, 0x34, 0x2A, 0x7B, 0x58, 0x36, 0x52, 0x9B, 0xBB, 0x22,
+    0x12, 0x85, 0xA2, 0x0E, 0x44, 0xD6, 0x96, 0x02, 0x05, 0xEC, 0xA0, 0x5F, 0xC9, 0xBB, 0x0C, 0xA8,
+    0x60, 0x03, 0x6B, 0xB8, 0xE5, 0x4E, 0x1C, 0x38, 0x58, 0x12, 0x90, 0x1C, 0x6C, 0xA0, 0x40, 0x2D,
+    0x97, 0xA6, 0x5C, 0xB5, 0x89, 0x19, 0x90, 0x2E, 0xB1, 0x19, 0xF4, 0x06, 0x0A, 0xD6, 0xAE, 0x99,
+    0x01, 0xC8, 0xA9, 0x92, 0x02, 0x05, 0x82, 0xA4, 0x92, 0x92, 0x0D, 0x04, 0x4A, 0xA3, 0xD5, 0x92,
+    0x5B, 0x65, 0x1E, 0x4A, 0xE0, 0x12, 0xDD, 0x04, 0xF0, 0x77, 0xF0, 0x9C, 0x83, 0x7B, 0xDF, 0xFE,
+    0x9A, 0xA1, 0x24, 0xEF, 0x92, 0xD6, 0xAD, 0xEA, 0xBE, 0xF7, 0xC5, 0xC5, 0xC5, 0xC5, 0x79, 0x9E,
+    0xE7, 0x3C, 0x1F, 0xFF, 0xE7, 0xE3, 0x52, 0x68, 0xC5, 0x69, 0xA2, 0x13, 0x99, 0x16, 0x4A, 0x8D,
+    0xD4, 0x07, 0x0C, 0x0B, 0xB9, 0x46, 0x5E, 0xF2, 0xC8, 0x80, 0xFF, 0x19, 0xAA, 0x91, 0x4C, 0xE0,
+    0x56, 0xF0, 0x13, 0x99, 0xA0, 0xDA, 0xA0, 0x99, 0x41, 0x3D, 0xC5, 0x0E, 0x2E, 0x40, 0x37, 0x92,
+    0x1F, 0x50, 0x2D, 0xE0, 0x47, 0x10, 0x14, 0x2B, 0xD4, 0x13, 0x0C, 0x90, 0xCF, 0xF0, 0x5F, 0x9E,
+    0x97, 0x2D, 0x26, 0x28, 0x47, 0xFB, 0x57, 0x8D, 0xE0, 0x7A, 0x78, 0xB0, 0x52, 0xEA, 0xC0, 0x6B,
+    0x47, 0x7A, 0x3B, 0xD7, 0xBB, 0x94, 0xFB, 0x27, 0xA8, 0xD6, 0x7F, 0x81, 0x5B, 0xDE, 0xA6, 0x0E,
+    0x2B, 0x7E, 0x5E, 0xEC, 0xDF, 0x77, 0x02, 0xFE, 0x3F, 0xEE, 0x78, 0x89, 0x5A, 0xEA, 0x4B, 0x69,
+    0x62, 0x38, 0x2E, 0x97, 0x72, 0x2D, 0xD4, 0xC0, 0x9D, 0xAB, 0x95, 0xDC, 0x03, 0x72, 0xAD, 0x90,
+    0x4B, 0x01, 0x24, 0x8D, 0x34, 0x4F, 0xCA, 0x9D, 0x62, 0xE3, 0x0E, 0xF8, 0x16, 0x28, 0x02, 0x80,
+    0x07, 0x28, 0x16, 0x48, 0x47, 0x57, 0xA0, 0x96, 0x44, 0x21, 0x29, 0xE0, 0xA5, 0x03, 0x8A, 0x0D,
+    0x6C, 0xA1, 0xF6, 0x32, 0xD3, 0x08, 0x99, 0x16, 0xC8, 0xA5, 0x16, 0xBC, 0x74, 0xB4, 0x85, 0xA4,
+    0x8D, 0x4E, 0xD2, 0x54, 0x49, 0x12, 0xD0, 0x02, 0xE5, 0xC8, 0xBF, 0xA6, 0xD1, 0x9F, 0xAF, 0x0C,
+    0xD2, 0x4E, 0x27, 0x6D, 0x34, 0x87, 0x26, 0xBA, 0xD9, 0x8F, 0x0C, 0xBD, 0x1F, 0x51, 0x3B, 0x8C,
+    0xE8, 0x57, 0xD5, 0x23, 0xA9, 0x2D, 0x24, 0xB5, 0xB5, 0xA4, 0xD1, 0x4B, 0x9A, 0xEA, 0xEF, 0x1D,
+    0x6A, 0xAB, 0x9E, 0x7F, 0x41, 0x06, 0x1F, 0x81, 0x1B, 0xE0, 0x06, 0x1F, 0xC8, 0xD5, 0x97, 0x22,
+    0x57, 0x8F, 0xE6, 0x42, 0x3D, 0xCD, 0x56, 0xA8, 0xA7, 0xD0, 0xEF, 0xAA, 0x87, 0x41, 0xEA, 0xC1,
+    0x49, 0x3D, 0xE4, 0x52, 0x0F, 0x74, 0xEA, 0x01, 0xA7, 0x16, 0xC8, 0x25, 0x60, 0x90, 0x46, 0x18,
+    0xA4, 0x00, 0x9D, 0xB4, 0xC3, 0xC7, 0x1E, 0x1F, 0x00, 0x85, 0xDA, 0xB4, 0x4A, 0xDE, 0x94, 0x26,
+    0xF0, 0xD2, 0x02, 0x5E, 0xDA, 0x8D, 0x3C, 0x2D, 0x14, 0xEA, 0x01, 0x34, 0x01, 0x0C, 0x01, 0xE0,
+    0x8D, 0x2F, 0x19, 0xFD, 0x7F, 0x1B, 0x37, 0xE2, 0xC9, 0x56, 0xAA, 0xE9, 0xEA, 0x99, 0xF6, 0x5A,
+    0xDC, 0xAA, 0x96, 0x8D, 0x72, 0xA6, 0x69, 0xD9, 0x28, 0x02, 0x75, 0x7A, 0xEE, 0x79, 0x87, 0xCC,
+    0xCE, 0xF9, 0xE8, 0x13, 0xC0, 0x69, 0x85, 0x42, 0x9A, 0xA0, 0xFB, 0x8D, 0x77, 0xC1, 0x4D, 0xC5,
+    0x08, 0x1B, 0x1F, 0x01, 0xF7, 0x04, 0xC8, 0xA4, 0x16, 0xA4, 0x1D, 0x3A, 0x29, 0xE0, 0xF6, 0x07,
+    0x6A, 0xF3, 0x9D, 0x72, 0xC1, 0xB7, 0x78, 0x8A, 0x95, 0x2A, 0xD8, 0xBD, 0x17, 0x92, 0x46, 0xEA,
+    0xB8, 0xE2, 0x15, 0xF8, 0xA8, 0x00, 0xDC, 0x02, 0x3D, 0x02, 0xFF, 0xB0, 0x0B, 0xB8, 0x74, 0x2A,
+    0x7C, 0x54, 0x6A, 0xA3, 0x40, 0x15, 0x47, 0xB1, 0x97, 0x7B, 0xB9, 0xBB, 0xDD, 0x6D, 0xF5, 0x56,
+    0x6F, 0x7E, 0xF3, 0x9B, 0xDF, 0xBA, 0xED, 0xF5, 0xFB, 0xAF, 0xDF, 0xE7, 0xEE, 0x4E, 0xA6, 0x9D,
+    0xFA, 0xE9, 0x9E, 0xED, 0xAC, 0xEE, 0xDB, 0x5F, 0x0F, 0xDD, 0x54, 0x7E, 0xFD, 0xA0, 0x71, 0xEF,
+    0xFC, 0xEC, 0xD2, 0x74, 0xF5, 0xF8, 0x85, 0x7C, 0x47, 0x9A, 0xD0, 0x0A, 0xBF, 0x6C, 0xEB, 0xFF,
+    0x7F, 0x0A, 0x4D, 0xCB, 0x27, 0xFE, 0x9B, 0xE2, 0xBD, 0xF1, 0xA7, 0x7F, 0xAA, 0x7C, 0x4F, 0xAB,
+    0x57, 0x7F, 0x7C, 0xA9, 0xF9, 0xCA, 0x3D, 0xBC, 0xB4, 0x7B, 0x69, 0xEB, 0xA4, 0xED, 0xF5, 0x5F,
+    0x78, 0xBC, 0xD9, 0x66, 0xAC, 0x17, 0x68, 0x02, 0xF8, 0x00, 0x7E, 0x06, 0x78, 0xFD, 0xE6, 0xE6,
+    0xC6, 0x4B, 0x47, 0x27, 0xED, 0x83, 0xB4, 0x5D, 0xDF, 0x85, 0xC2, 0xEA, 0x96, 0xFF, 0x2D, 0x7C,
+    0xE1, 0xBD, 0x9F, 0xFB, 0xFA, 0xF7, 0xD6, 0xC6, 0xBD, 0x33, 0xAD, 0xFE, 0xCF, 0x7F, 0x7D, 0x1C,
+    0x3E, 0x7D, 0xA0, 0x61, 0xCE, 0x74, 0xC0, 0xD0, 0x03, 0x64, 0x8F, 0x86, 0x3F, 0x90, 0x16, 0x69,
+    0x37, 0x8A, 0xDF, 0x87, 0x5A, 0x2D, 0x83, 0xA6, 0x5C, 0x0A, 0xE5, 0x51, 0x05, 0xB7, 0x94, 0x4B,
+    0x1D, 0xAA, 0x50, 0xCF, 0x75, 0x68, 0x9E, 0x6A, 0xAA, 0xA5, 0xD1, 0x49, 0x14, 0x5A, 0x61, 0x78,
+    0x08, 0xF0, 0xC6, 0x43, 0x6E, 0x6D, 0x92, 0x6A, 0x01, 0x10, 0x20, 0x69, 0xA3, 0x96, 0xD4, 0xE7,
+    0x92, 0x42, 0x3A, 0x6B, 0x68, 0x31, 0x3D, 0x62, 0x67, 0xF1, 0xDA, 0xC3, 0x17, 0x29, 0xA4, 0xD7,
+    0xFF, 0x07, 0x18, 0xA4, 0x89, 0x5A, 0x3A, 0x28, 0x24, 0xCD, 0xE9, 0xAD, 0xFF, 0x09, 0xBF, 0x15,
+    0x9F, 0x9A, 0xF8, 0x04, 0xD5, 0x98, 0x2F, 0xD9, 0x8E, 0xDA, 0x46, 0x85, 0x02, 0xC0, 0x2F, 0xD3,
+    0x6C, 0x59, 0x36, 0xF3, 0x93, 0xA8, 0x6F, 0x02, 0xAE, 0xE7, 0xDF, 0x34, 0xFA, 0x94, 0xE6, 0x66,
+    0x05, 0xA8, 0x7B, 0x37, 0xBA, 0xB9, 0x0A, 0xE5, 0x52, 0xAC, 0x90, 0x89, 0x62, 0x23, 0x3F, 0x28,
+    0x37, 0x8A, 0x0D, 0xB7, 0x52, 0x6C, 0xB8, 0x85, 0x62, 0xA5, 0x0E, 0x54, 0x0B, 0x4D, 0xC0, 0x05,
+    0xFC, 0x4C, 0x1D, 0xE8, 0x26, 0x9A, 0xC0, 0x30, 0xE2, 0x67, 0x34, 0xD2, 0xCD, 0xB9, 0x7A, 0x14,
+    0x2A, 0xB5, 0x48, 0x52, 0x9B, 0x2B, 0x29, 0x0E, 0x51, 0x4A, 0x3A, 0xA8, 0xBE, 0x2F, 0xED, 0xB8,
+    0x6F, 0x68, 0x86, 0x7A, 0x3C, 0xE9, 0xC3, 0xC7, 0xE2, 0x4E, 0x78, 0xE3, 0xA8, 0x27, 0x9C, 0xFE,
+    0x70, 0xA3, 0xD0, 0xE6, 0x47, 0xA4, 0xFF, 0x75, 0xA5, 0xD6, 0xD2, 0xB5, 0x85, 0x54, 0x05, 0xBC,
+    0x66, 0x51, 0x68, 0x77, 0x33, 0x5E, 0x5F, 0xDB, 0x41, 0x6B, 0x33, 0x52, 0xAA, 0xD8, 0xA0, 0x0B,
+    0xBE, 0xA7, 0x3A, 0xCA, 0x05, 0x34, 0x0E, 0xD0, 0x6C, 0x2E, 0x50, 0xA8, 0x3F, 0x60, 0x08, 0xF5,
+    0x84, 0x53, 0xBE, 0x91, 0x6B, 0xF6, 0x23, 0x7E, 0x2B, 0x56, 0x4A, 0x8D, 0x5D, 0x8B, 0xD6, 0x2A,
+    0x50, 0x0B, 0x51, 0x28, 0xB8, 0x99, 0x6E, 0xCF, 0x76, 0xC8, 0x55, 0x1C, 0xD5, 0xEE, 0xF6, 0x66,
+    0xF3, 0xDB, 0xEB, 0xF7, 0x59, 0x79, 0x9B, 0x9F, 0xA1, 0x09, 0xEE, 0xB8, 0xE3, 0xBE, 0xAE, 0x59,
+    0xA1, 0x9B, 0x01, 0xEA, 0xD1, 0x4D, 0x77, 0x02, 0x3F, 0xCD, 0xC7, 0x71, 0x6D, 0x31, 0x66, 0xA1,
+    0xD2, 0x7B, 0x9A, 0x6F, 0xEE, 0x31, 0xB4, 0x4E, 0xED, 0xFA, 0xF1, 0x72, 0xFC, 0x5F, 0x7E, 0x32,
+    0x9F, 0xD7, 0xA6, 0xD0, 0x5A, 0x69, 0x34, 0x21, 0x20, 0xFB, 0x2D, 0x5B, 0xAA, 0x5D, 0x22, 0xAA,
+    0x16, 0xE1, 0x36, 0xA0, 0x0A, 0x7C, 0x2A, 0x00, 0x03, 0x34, 0xAD, 0x89, 0xCD, 0x06, 0x74, 0x2D,
+    0x45, 0x80, 0x72, 0x85, 0xBA, 0x37, 0x92, 0xED, 0x26, 0x39, 0x45, 0xB0, 0x3F, 0x9B, 0x89, 0x62,
+    0xA7, 0xAD, 0xB5, 0xD1, 0x4C, 0x75, 0x3B, 0x68, 0xCE, 0x8F, 0x6C, 0x2B, 0xA4, 0xB6, 0x0E, 0x75,
+    0x00, 0x32, 0xE5, 0xA6, 0xEE, 0x42, 0xF3, 0x79, 0x00, 0x7D, 0xF2, 0xAF, 0x16, 0xC0, 0x2D, 0x8D,
+    0x1B, 0x01, 0xFD, 0xEA, 0xD2, 0xB5, 0x50, 0x6D, 0x8D, 0xD4, 0xC2, 0x30, 0x4A, 0x1B, 0x54, 0x5B,
+    0xF6, 0x4F, 0x87, 0x2F, 0x42, 0x37, 0x91, 0x6F, 0x50, 0xEE, 0xE0, 0x66, 0xDB, 0x6C, 0xBE, 0x25,
+    0x3F, 0x92, 0x9D, 0x8C, 0x2B, 0x2A, 0xE3, 0x01, 0x5B, 0xD2, 0x23, 0xD0, 0x68, 0x37, 0xFF, 0xA9,
+    0x60, 0xCF, 0xF9, 0x02, 0x74, 0xBD, 0x2D, 0xCA, 0xF7, 0x66, 0x6D, 0xFC, 0x78, 0x59, 0x95, 0x9B,
+    0xEC, 0xB9, 0x08, 0xD0, 0x4C, 0x90, 0xEF, 0xD0, 0x4C, 0xFF, 0xD4, 0xD6, 0xF5, 0x67, 0xDA, 0x2B,
+    0x1D, 0xD4, 0x41, 0x7A, 0x4F, 0x6A, 0xEB, 0xF0, 0x89, 0x22, 0xC4, 0x5D, 0xF3, 0x4E, 0x54, 0x59,
+    0x3E, 0x3E, 0x37, 0xA3, 0xA9, 0x88, 0x66, 0x82, 0x6A, 0x35, 0x5A, 0x57, 0x1B, 0x0C, 0xF6, 0x9C,
+    0x69, 0x86, 0x72, 0x23, 0xD7, 0x04, 0xE5, 0x4E, 0x26, 0x4D, 0x94, 0x3B, 0x48, 0x81, 0xE2, 0x80,
+    0x4E, 0x1B, 0xF9, 0x01, 0x77, 0x6E, 0xEE, 0x47, 0x65, 0x07, 0x0C, 0x7B, 0x5C, 0xDD, 0x06, 0xC0,
+    0x7F, 0xCD, 0x6A, 0xE6, 0xB1, 0x98, 0xE3, 0x22, 0x5A, 0xF2, 0x0D, 0xBE, 0xBA, 0x41, 0x33, 0xE2,
+    0xD4, 0x93, 0xED, 0xE0, 0x0F, 0xA8, 0x67, 0xC8, 0x76, 0xB2, 0xC3, 0x6C, 0xAB, 0x0B, 0xD0, 0x36,
+    0x23, 0x02, 0x27, 0xE1, 0x96, 0xAA, 0xED, 0xB4, 0x30, 0xB4, 0x7B, 0x21, 0xF5, 0xD5, 0xEA, 0xC2,
+    0x5D, 0xBD, 0xCF, 0xD0, 0x6B, 0x04, 0xCA, 0xCD, 0xBD, 0x0B, 0xD0, 0x8D, 0x4F, 0x16, 0xA0, 0xD8,
+    0xDD, 0xAF, 0x8D, 0x80, 0x9F, 0x56, 0x0F, 0x14, 0x87, 0xFB, 0x93, 0xA3, 0x85, 0x66, 0x96, 0x4C,
+    0x6C, 0xA5, 0x00, 0x4D, 0xE0, 0x17, 0x8E, 0x96, 0x4C, 0x2D, 0x55, 0x30, 0x4D, 0xE9, 0x7B, 0x50,
+    0x0F, 0xBB, 0x51, 0x24, 0x72, 0x4C, 0x23, 0x30, 0x2C, 0x40, 0xA5, 0xD3, 0x78, 0xB9, 0x0D, 0xEC,
+    0x64, 0xEE, 0xDC, 0xE3, 0xA5, 0x8F, 0x7F, 0x0E, 0x64, 0xC3, 0x08, 0x74, 0x57, 0x17, 0x98, 0x01,
+    0xB7, 0x83, 0x39, 0x56, 0xB9, 0x36, 0x20, 0xFA, 0x04, 0x7D, 0xB4, 0xB6, 0x26, 0x89, 0x7E, 0xC6,
+    0x98, 0x02, 0x6A, 0x81, 0x28, 0xA6, 0x60, 0xBE, 0x15, 0xF9, 0x01, 0xBF, 0x44, 0x1D, 0x68, 0x5A,
+    0xD4, 0x76, 0x1B, 0x95, 0xA4, 0x1E, 0x2F, 0x4D, 0x30, 0x68, 0x02, 0xDE, 0xBC, 0x65, 0x3F, 0x3F,
+    0x0E, 0x80, 0xDB, 0x7E, 0x06, 0xC8, 0xF5, 0x47, 0x01, 0xF0, 0x7E, 0x07, 0xCA, 0x6F, 0x68, 0x04,
+    0x3E, 0x5F, 0xCD, 0x2F, 0x59, 0x89, 0xDD, 0x85, 0x99, 0x77, 0xFC, 0x06, 0x50, 0x69, 0x04, 0x32,
+    0xB3, 0x02, 0x5E, 0x13, 0x50, 0x7D, 0xFF, 0x00, 0x32, 0xF9, 0x19, 0xF0, 0x7F, 0x26, 0xA0, 0xDA,
+    0x9A, 0x00, 0x99, 0x3E, 0x29, 0xC0, 0x87, 0x26, 0x40, 0xB5, 0xE5, 0x6A, 0xC9, 0xD4, 0xD7, 0x0B,
+    0xF8, 0x90, 0xA9, 0xA7, 0xD2, 0xCD, 0x83, 0x15, 0x24, 0x69, 0xC4, 0x4B, 0xB2, 0xB5, 0x68, 0x44,
+    0x92, 0x36, 0xBC, 0xCC, 0x47, 0x82, 0x7A, 0x47, 0x33, 0x99, 0x66, 0xBF, 0x41, 0x7D, 0x54, 0xEA,
+    0xC9, 0x4C, 0x87, 0xE7, 0xAB, 0xC9, 0x5E, 0x0F, 0x64, 0xDF, 0x0F, 0x00, 0xBB, 0xD9, 0x97, 0x83,
+    0x93, 0xF8, 0xBC, 0xFB, 0xCA, 0x05, 0x96, 0xB2, 0x6B, 0x8C, 0x40, 0xAE, 0x70, 0x59, 0x9F, 0xD9,
+    0xF4, 0x61, 0x98, 0x81, 0xEE, 0xF7, 0xD7, 0x73, 0x79, 0x4D, 0x18, 0x46, 0xA8, 0x97, 0x26, 0x80,
+    0xDB, 0xAA, 0x2D, 0xAD, 0xAE, 0x3C, 0xE8, 0x26, 0x0A, 0x51, 0xAF, 0xE4, 0xFA, 0xE3, 0xCF, 0x1C,
+    0x69, 0x71, 0x92, 0x14, 0x18, 0x2E, 0xAB, 0x8A, 0x6B, 0x6B, 0x36, 0xE8, 0x16, 0x77, 0x40, 0x7D,
+    0x38, 0x41, 0xA9, 0x5F, 0xBB, 0x2C, 0x8D, 0x9B, 0x47, 0x8F, 0x14, 0x39, 0x20, 0x69, 0xB1, 0x5B,
+    0x35, 0xEB, 0x08, 0xCE, 0xAE, 0x0C, 0x78, 0x1D, 0x6F, 0x19, 0xC3, 0xE3, 0x5B, 0xC9, 0x9D, 0x05,
+    0x28, 0xF7, 0x64, 0x0B, 0xEB, 0xEF, 0x98, 0x07, 0x06, 0xFE, 0x0F, 0xF4, 0xC7, 0x37, 0x2D, 0x80,
+    0x7E, 0x55, 0xE6, 0xF3, 0xE5, 0xCA, 0xCD, 0x59, 0xA3, 0xDA, 0x73, 0xF3, 0x49, 0xA9, 0xD7, 0x42,
+    0x3A, 0x00, 0x7C, 0x28, 0x15, 0xBF, 0x61, 0x8C, 0x14, 0x2D, 0xA2, 0xE7, 0x0A, 0xD5, 0xF9, 0xAA,
+    0x96, 0xA4, 0x9B, 0x9B, 0x16, 0x3A, 0x29, 0xDE, 0x9E, 0xD2, 0xAB, 0x42, 0x7F, 0x7C, 0x33, 0x48,
+    0x1A, 0x71, 0x02, 0x7B, 0xD5, 0xEC, 0x89, 0x40, 0xDD, 0x6A, 0x8B, 0xBC, 0x1D, 0x73, 0x74, 0x3A,
+    0x1E, 0x02, 0x8D, 0xDD, 0x9A, 0x93, 0xB4, 0xC5, 0x6F, 0x1E, 0x4F, 0x9A, 0x0C, 0x33, 0x9D, 0xC0,
+    0x5B, 0xC4, 0xE2, 0x36, 0xF0, 0x0B, 0xA5, 0xA2, 0x1E, 0xEB, 0xC9, 0x64, 0xBB, 0xB7, 0x1B, 0x6F,
+    0x86, 0x27, 0xF7, 0x69, 0x42, 0x27, 0xED, 0xB8, 0xB5, 0x91, 0x44, 0xB9, 0x3B, 0x49, 0x63, 0x2E,
+    0x32, 0x8D, 0xE4, 0x1A, 0x19, 0x66, 0x4A, 0x4D, 0xF8, 0x35, 0x7B, 0xA0, 0x60, 0x44, 0x5E, 0x8C,
+    0xEA, 0x1B, 0xB9, 0x24, 0xC5, 0x5B, 0xDE, 0xC1, 0xEB, 0xF4, 0x72, 0x57, 0xA8, 0x64, 0x37, 0x0B,
+    0xF0, 0x6F, 0xEC, 0x49, 0xEF, 0xCD, 0x00, 0xC3, 0xB2, 0x72, 0xEE, 0x39, 0xEA, 0x9F, 0x3F, 0x00,
+    0xCA, 0xE9, 0xDD, 0x97, 0x6B, 0x90, 0xBB, 0xC6, 0xB3, 0xC6, 0xE8, 0xD1, 0x49, 0x1B, 0x89, 0x64,
+    0x0C, 0x47, 0x36, 0xAC, 0x30, 0xAC, 0x54, 0x82, 0x6E, 0x05, 0x4D, 0xF8, 0x15, 0x9A, 0x85, 0x66,
+    0x83, 0xEA, 0xC0, 0xED, 0x90, 0xA9, 0xAF, 0x04, 0x0C, 0x73, 0xA1, 0x16, 0x9A, 0x05, 0x8D, 0xE0,
+    0x76, 0xBA, 0x19, 0x0A, 0xD1, 0x2C, 0x90, 0x69, 0x74, 0x5B, 0x3C, 0x07, 0xF0, 0x4B, 0xA6, 0x11,
+    0xFC, 0x46, 0xB7, 0x41, 0x77, 0x50, 0xEB, 0x2F, 0x7E, 0x22, 0x7A, 0x28, 0x52, 0x9F, 0xE9, 0xB2,
+    0x51, 0x35, 0x1B, 0xDB, 0x67, 0x23, 0xC6, 0x6C, 0x52, 0x30, 0x01, 0x1F, 0xD5, 0xD3, 0x5B, 0x1C,
+    0x9C, 0x7D, 0x60, 0xF8, 0xCB, 0x03, 0xEC, 0xE4, 0x1D, 0x72, 0xCD, 0xD0, 0x68, 0xA4, 0x90, 0x46,
+    0x3A, 0xA9, 0xAF, 0xF4, 0x6B, 0xEA, 0xDF, 0xFC, 0xD2, 0x6B, 0x8F, 0x9E, 0xA1, 0xC2, 0x2D, 0x5F,
+    0xAF, 0x5B, 0xAF, 0xFF, 0x6A, 0x8E, 0xEB, 0xBF, 0x4A, 0x8B, 0x30, 0x92, 0xD9, 0xD5, 0xFC, 0xF2,
+    0x0F, 0xD6, 0xBA, 0xFD, 0xC1, 0xF1, 0xD6, 0x07, 0xC3, 0xAD, 0x0F, 0x6E, 0x7F, 0x07, 0x1F, 0x7C,
+    0x70, 0xD4, 0xBA, 0x68, 0xE3, 0x21, 0x52, 0x29, 0x89, 0x77, 0xDC, 0xD5, 0x44, 0x6E, 0x27, 0xDF,
+    0x1A, 0xA8, 0x34, 0x37, 0x97, 0xEF, 0xC8, 0x35, 0x27, 0xF3, 0x1A, 0x97, 0x74, 0x75, 0x1D, 0x67,
+    0xF1, 0xF1, 0x79, 0xEA, 0x58, 0x5D, 0xF9, 0xBF, 0x7E, 0xC9, 0xF5, 0xFD, 0xE3, 0x72, 0x55, 0xBA,
+    0x7D, 0x38, 0xDF, 0xD4, 0x54, 0xEB, 0xE7, 0xCF, 0x4F, 0xBA, 0xAD, 0xD4, 0x7C, 0x5E, 0x36, 0x53,
+    0xAF, 0xD5, 0x9D, 0xDF, 0xD9, 0x2C, 0x5E, 0xD9, 0x79, 0x43, 0x85, 0x9C, 0xC6, 0xE6, 0x24, 0xAC,
+    0xFF, 0x6B, 0x85, 0xE2, 0x5C, 0x66, 0x29, 0xED, 0x5C, 0x28, 0xD2, 0x49, 0x6D, 0x77, 0x5C, 0x08,
+    0xA7, 0xBF, 0x18, 0x2E, 0x0B, 0xEB, 0x64, 0xBB, 0xE7, 0x7C, 0x33, 0xE9, 0x12, 0x53, 0x6C, 0xD7,
+    0x9E, 0x7C, 0x79, 0xEB, 0xD4, 0x4C, 0x8A, 0xCA, 0xE9, 0x72, 0x9D, 0xF6, 0xC2, 0xAB, 0x5F, 0xBB,
+    0x12, 0xC3, 0xF2, 0x96, 0x3C, 0x64, 0xDA, 0x6E, 0xAB, 0x98, 0xDB, 0x4C, 0x1E, 0x6F, 0x31, 0xF9,
+    0x16, 0x5B, 0x6F, 0x7F, 0xD0, 0xEB, 0xDA, 0xC8, 0xBA, 0x2B, 0xB6, 0x42, 0x71, 0xC5, 0x56, 0x40,
+    0x4F, 0x6E, 0x7D, 0xF0, 0x96, 0x74, 0xFE, 0x83, 0x96, 0x57, 0x3F, 0xCC, 0xEA, 0xCE, 0x00, 0xDD,
+    0x15, 0x06, 0x31, 0x62, 0x5E, 0xE0, 0xDF, 0xF2, 0xA1, 0x11, 0xF4, 0x47, 0x6A, 0xA9, 0x8E, 0xEA,
+    0x80, 0x2E, 0xD4, 0x1B, 0x85, 0xE8, 0x02, 0x7E, 0x41, 0x53, 0xA1, 0xBE, 0x50, 0xDF, 0x6C, 0x54,
+    0xCA, 0x34, 0xD1, 0x6C, 0xEE, 0x80, 0x6E, 0x51, 0x00, 0xFD, 0x07, 0x41, 0x21, 0x2D, 0x50, 0x49,
+    0x3D, 0x34, 0xDA, 0x80, 0x4E, 0x23, 0xB6, 0xCF, 0x29, 0xCC, 0xE7, 0xD1, 0xB9, 0x25, 0xF2, 0x78,
+    0xA0, 0xBD, 0x1C, 0x08, 0x80, 0x33, 0xD4, 0xC1, 0x16, 0x53, 0x46, 0x37, 0x1F, 0x37, 0x03, 0x07,
+    0x16, 0x65, 0xE6, 0x12, 0x78, 0xED, 0x94, 0x52, 0x60, 0x68, 0xD5, 0xBB, 0x50, 0x6C, 0x1C, 0x74,
+    0x63, 0x3D, 0xBA, 0x35, 0xDF, 0x0A, 0xB5, 0xFE, 0x77, 0x34, 0x17, 0xD2, 0x4A, 0xA7, 0x9D, 0x4A,
+    0x87, 0xD1, 0xDD, 0x4D, 0x90, 0x6D, 0x98, 0xEB, 0x5B, 0xAC, 0xE6, 0x6F, 0x9F, 0x7B, 0x65, 0x98,
+    0xB0, 0x53, 0x9D, 0x34, 0xE1, 0x8E, 0x9F, 0xDB, 0x28, 0x37, 0x3A, 0xF2, 0x9D, 0x07, 0x23, 0xCA,
+    0x14, 0xE8, 0x7E, 0x45, 0x2B, 0x7E, 0xD2, 0xFB, 0xB8, 0x30, 0xB4, 0x94, 0x9B, 0xEF, 0xC9, 0x0F,
+    0x37, 0x81, 0x3E, 0xB5, 0x43, 0x37, 0x0E, 0x33, 0x4D, 0x70, 0x07, 0x6E, 0xCD, 0x34, 0x15, 0x3B,
+    0x6E, 0xCD, 0xD5, 0xE6, 0x07, 0x7A, 0x3F, 0x53, 0xEB, 0x25, 0x8D, 0xB5, 0xA4, 0xD9, 0x49, 0x9A,
+    0x0B, 0x49, 0x73, 0x26, 0x1D, 0x3D, 0x6F, 0xDE, 0xD2, 0x6E, 0xEF, 0x54, 0x3D, 0xE8, 0xBD, 0x00,
+    0xC3, 0xBA, 0x46, 0x5B, 0x51, 0xFF, 0xCB, 0x03, 0x8A, 0xF9, 0x0B, 0xCF, 0x73, 0xAD, 0x34, 0xB4,
+    0x43, 0x33, 0x4E, 0x5A, 0x70, 0xC7, 0xB0, 0x53, 0xAD, 0xB9, 0x28, 0x56, 0xBA, 0x31, 0xDF, 0xA8,
+    0x03, 0x3B, 0xE5, 0x4A, 0x47, 0xB6, 0xE3, 0x5B, 0x86, 0xD6, 0x8D, 0xF8, 0xB1, 0x08, 0x34, 0x21,
+    0x3B, 0x6E, 0x86, 0x8D, 0x4E, 0x3A, 0x70, 0x92, 0xFA, 0x42, 0xD2, 0x84, 0x97, 0x02, 0xB9, 0xEC,
+    0xA6, 0xEA, 0x3E, 0x3A, 0xA3, 0xF5, 0xB7, 0x81, 0xB7, 0xDF, 0x8E, 0x9C, 0x2A, 0x65, 0xA1, 0xD8,
+    0x8B, 0x1E, 0xF5, 0xFB, 0x50, 0x48, 0x2B, 0x5E, 0x9A, 0x0A, 0x3D, 0x56, 0xDB, 0xCC, 0xD5, 0xC6,
+    0x41, 0x1D, 0xAA, 0x40, 0x37, 0xFA, 0x36, 0x3B, 0xB2, 0x8D, 0x72, 0x71, 0x13, 0xCD, 0xE4, 0x41,
+    0x6C, 0x54, 0x5B, 0xF9, 0xE4, 0x17, 0x14, 0x6A, 0x49, 0xBD, 0x97, 0x0E, 0x24, 0x2D, 0x86, 0xC2,
+    0x0D, 0xEF, 0x5F, 0xEF, 0xD9, 0xA3, 0xE5, 0x81, 0x81, 0x4B, 0x8F, 0x15, 0xCC, 0x03, 0x50, 0xC0,
+    0x3F, 0x95, 0x96, 0x7A, 0xCE, 0x0F, 0x86, 0x03, 0x37, 0xBA, 0x39, 0xD3, 0x77, 0x1F, 0x8B, 0x81,
+    0x52, 0xD2, 0x56, 0x2C, 0xD4, 0x92, 0x42, 0x3D, 0xD2, 0x49, 0x1A, 0x77, 0x72, 0x3D, 0x7D, 0xAB,
+    0x2D, 0x02, 0x6E, 0x05, 0xDC, 0x68, 0x58, 0x54, 0xF7, 0xD6, 0x03, 0x2D, 0x7C, 0xDC, 0xAC, 0x9B,
+    0x96, 0x22, 0xFA, 0x2B, 0xCE, 0x9E, 0xCD, 0x03, 0xD0, 0x4A, 0x75, 0xB4, 0x99, 0xBE, 0x69, 0xB7,
+    0xF3, 0x9B, 0xD1, 0xB3, 0xE2, 0xE2, 0x16, 0xE7, 0x51, 0x33, 0x35, 0x73, 0xF4, 0x8D, 0xE6, 0x13,
+    0xFE, 0x1A, 0xA4, 0x0D, 0xB2, 0x9B, 0xE1, 0xAD, 0x7B, 0xE4, 0xEF, 0xE6, 0x66, 0xCA, 0x3F, 0x1D,
+    0xD2, 0xFB, 0x99, 0x79, 0x35, 0xEE, 0x28, 0x34, 0xC3, 0x30, 0x95, 0x82, 0xE2, 0xA0, 0xDE, 0x88,
+    0x48, 0x02, 0x43, 0x9F, 0xD9, 0x31, 0xB7, 0x80, 0xDB, 0x73, 0x8D, 0xE0, 0x4F, 0x9F, 0x60, 0x02,
+    0x4C, 0x13, 0xE6, 0xA6, 0x2C, 0xA3, 0xEF, 0xCA, 0xEB, 0x49, 0xE7, 0x4F, 0x6F, 0x83, 0x0F, 0x6F,
+    0x43, 0xB7, 0x6E, 0xB0, 0x0D, 0x0B, 0x6C, 0x3E, 0xC0, 0x5A, 0x3F, 0x8F, 0xF0, 0x3E, 0x58, 0xA0,
+    0x94, 0xA2, 0xEF, 0x31, 0x3C, 0xD5, 0x9C, 0x69, 0x6C, 0x42, 0x21, 0xEA, 0x50, 0x6E, 0xB8, 0xE0,
+    0x56, 0xEA, 0xE0, 0x02, 0x75, 0xA8, 0x03, 0xCD, 0xDC, 0xCC, 0xF8, 0xC9, 0xCF, 0x0C, 0xA3, 0x0F,
+    0xB9, 0x7A, 0x2F, 0x89, 0x46, 0x3A, 0xA8, 0xA5, 0x0D, 0x27, 0xE3, 0x56, 0x9F, 0xAC, 0x70, 0x76,
+    0x1F, 0x60, 0x18, 0x53, 0x30, 0x65, 0x16, 0xC5, 0xAF, 0xA7, 0x0D, 0xBF, 0xA5, 0x38, 0xEF, 0xB4,
+    0x6F, 0x0C, 0xD2, 0x56, 0x4A, 0xD2, 0xD7, 0x24, 0x69, 0xF3, 0x7A, 0xFA, 0xE8, 0x51, 0xDC, 0xBF,
+    0x76, 0xAD, 0x6E, 0xBA, 0x7D, 0xAD, 0x66, 0x3B, 0xC3, 0x81, 0x61, 0x7D, 0x5E, 0x4C, 0xF3, 0xB8,
+    0xE4, 0x14, 0xF2, 0xB8, 0x28, 0xCD, 0x11, 0x83, 0x88, 0xA8, 0xD3, 0x95, 0x6A, 0x4D, 0xE6, 0x21,
+    0x69, 0xFB, 0x2E, 0x7A, 0x1A, 0x3E, 0x5E, 0xA8, 0x7E, 0xF6, 0x42, 0xEB, 0x8B, 0x2F, 0x94, 0xC5,
+    0x0B, 0x3D, 0xB0, 0x0B, 0x65, 0xD1, 0xD5, 0xCD, 0x8D, 0x8F, 0x24, 0xEF, 0x3B, 0xD3, 0x9F, 0x9A,
+    0xD1, 0xD1, 0xEF, 0xD9, 0x1B, 0xDD, 0x7B, 0xBB, 0xB0, 0xC0, 0xC3, 0x8F, 0x80, 0x0B, 0xFA, 0x6C,
+    0x00, 0xCA, 0x6D, 0xF8, 0xBD, 0x15, 0xC8, 0x0F, 0xFF, 0x5E, 0x8C, 0x55, 0xFE, 0xDC, 0x4E, 0xD4,
+    0xF7, 0x23, 0x7E, 0xAB, 0x18, 0xD0, 0x44, 0x1B, 0xDA, 0xC5, 0x98, 0xA0, 0x4A, 0xB1, 0x41, 0xB2,
+    0xAD, 0x43, 0x5C, 0x5B, 0x32, 0x4C, 0x4D, 0x5C, 0x4A, 0xBD, 0x24, 0xBF, 0x80, 0x6B, 0x81, 0xA7,
+    0x50, 0xF2, 0x34, 0x22, 0x4D, 0x92, 0xF7, 0x35, 0x8C, 0xB7, 0x10, 0x1C, 0x7C, 0xBA, 0x50, 0xB4,
+    0x8D, 0x2E, 0x9E, 0x57, 0x5D, 0xE5, 0x11, 0x5E, 0x68, 0xEE, 0xCC, 0xC6, 0x99, 0xA6, 0x89, 0x68,
+    0x58, 0x7F, 0xCD, 0x8C, 0xBF, 0xD5, 0xA3, 0x5E, 0x28, 0x76, 0xDC, 0x4A, 0xB5, 0xE2, 0x36, 0xEA,
+    0x40, 0xB5, 0xE3, 0x67, 0xCA, 0x83, 0x6E, 0xA4, 0x10, 0x6A, 0x29, 0xF4, 0xC9, 0x03, 0x72, 0xFD,
+    0xCB, 0x0D, 0x32, 0xFD, 0xFE, 0x7A, 0xC6, 0x56, 0xB6, 0xDF, 0x86, 0x88, 0x93, 0x5F, 0xE2, 0x4C,
+    0xD3, 0x02, 0x7E, 0xB9, 0xD0, 0x51, 0x23, 0xF0, 0x51, 0xF5, 0x50, 0x4B, 0x24, 0xF3, 0xE8, 0xB5,
+    0x00, 0xDE, 0xFC, 0xFA, 0xE7, 0xE4, 0xB3, 0xD8, 0x92, 0x44, 0x0D, 0x6D, 0xFC, 0xCB, 0x05, 0xA0,
+    0x3B, 0x62, 0x02, 0xC1, 0x49, 0x2D, 0xFE, 0xDB, 0x22, 0x3B, 0xAA, 0x9D, 0x6A, 0xA9, 0x56, 0xFC,
+    0xE8, 0x02, 0xC2, 0x8F, 0xE5, 0xCA, 0x41, 0x33, 0x55, 0x01, 0xD1, 0x8D, 0xC5, 0x56, 0xEE, 0xD4,
+    0xF3, 0x30, 0x33, 0x7C, 0xF6, 0xA0, 0x90, 0x02, 0x4E, 0x87, 0xD9, 0xE7, 0x5C, 0xEF, 0x1B, 0x1C,
+    0x84, 0x1F, 0x31, 0xF4, 0xA5, 0x4A, 0x7F, 0x21, 0x0C, 0x50, 0x33, 0x0E, 0x4E, 0x7E, 0x82, 0x6A,
+    0xAB, 0x36, 0x40, 0xA3, 0x46, 0xA8, 0xB7, 0x66, 0x83, 0x42, 0xEF, 0x69, 0x84, 0x6E, 0xED, 0x56,
+    0xB8, 0x73, 0x73, 0xE7, 0xE6, 0x6F, 0xC4, 0x04, 0xD4, 0x33, 0xF4, 0x91, 0x0B, 0x0C, 0x53, 0x71,
+    0x10, 0xD9, 0x80, 0x0F, 0x6E, 0x21, 0xF2, 0x81, 0x66, 0xED, 0xC6, 0x93, 0x11, 0xCE, 0x3C, 0x44,
+    0xE3, 0x44, 0x65, 0x7A, 0xB7, 0x8B, 0x11, 0xFC, 0x7C, 0xE1, 0x45, 0xF4, 0x47, 0x8D, 0x19, 0x26,
+    0xC2, 0x1F, 0x55, 0x0F, 0x99, 0x31, 0xD2, 0xD8, 0x51, 0xD8, 0xAE, 0x33, 0x7E, 0xDC, 0x8E, 0x22,
+    0xEC, 0xF1, 0x63, 0x40, 0xFE, 0x58, 0x47, 0x8C, 0x73, 0x53, 0xCE, 0x07, 0xBC, 0xBE, 0xF5, 0x95,
+    0x0F, 0xB9, 0x56, 0xDB, 0x16, 0xD1, 0x79, 0x36, 0x94, 0x21, 0xC2, 0x28, 0xD4, 0xE6, 0x36, 0xFA,
+    0x98, 0x1B, 0x19, 0xE6, 0x0B, 0x90, 0x52, 0x1C, 0x4D, 0x38, 0x91, 0x94, 0x88, 0x35, 0x44, 0x28,
+    0x85, 0x61, 0xB4, 0xF0, 0xAD, 0xAF, 0x17, 0x22, 0xDC, 0x90, 0xC0, 0x94, 0x18, 0x24, 0x1B, 0x9A,
+    0x12, 0x11, 0x87, 0x08, 0xA7, 0x14, 0x16, 0xB7, 0x46, 0x3C, 0xC5, 0x40, 0x07, 0x0C, 0x50, 0x61,
+    0x58, 0x6F, 0x45, 0x38, 0x6F, 0x0E, 0x1A, 0x29, 0x65, 0x5E, 0x97, 0x7D, 0xF4, 0xE9, 0x17, 0x3F,
+    0x14, 0x5F, 0xDF, 0x27, 0xFA, 0x01, 0x06, 0x48, 0x15, 0x7A, 0xAC, 0x96, 0x66, 0xAE, 0x36, 0x38,
+    0xA8, 0x03, 0x55, 0xA0, 0x1B, 0xF1, 0x6D, 0x76, 0x90, 0x6D, 0x94, 0x0B, 0x6E, 0xA2, 0x99, 0xF0,
+    0x20, 0xD8, 0xA8, 0x36, 0xCA, 0x27, 0xBF, 0xA0, 0x60, 0xA9, 0x80, 0x98, 0x55, 0xB3, 0x30, 0x29,
+    0x86, 0xBF, 0xC9, 0x2F, 0xB8, 0x6F, 0x06, 0x6E, 0x68, 0x9B, 0xC9, 0x42, 0x85, 0x60, 0x3C, 0xB2,
+    0x8C, 0x82, 0x3D, 0x55, 0x51, 0xC3, 0xDD, 0x79, 0xC5, 0x1D, 0x1B, 0x04, 0x14, 0x31, 0xA0, 0xC4,
+    0x1E, 0x73, 0x4C, 0x4F, 0x53, 0x1A, 0x43, 0x0B, 0xE3, 0x4F, 0x44, 0x82, 0x22, 0x14, 0x14, 0xB1,
+    0xA0, 0xC4, 0x20, 0x43, 0x83, 0x22, 0x1C, 0x14, 0xF1, 0xA0, 0xC4, 0xA1, 0x88, 0x08, 0x71, 0x85,
+    0x8C, 0x84, 0x93, 0x45, 0x86, 0x0A, 0x45, 0x58, 0x08, 0xC3, 0x85, 0x12, 0x8F, 0x0C, 0x19, 0xEA,
+    0x2F, 0xA8, 0xD7, 0x9D, 0x96, 0x7B, 0x30, 0xB4, 0xCD, 0x8C, 0x81, 0x35, 0xA5, 0xB4, 0xA6, 0x2C,
+    0x5E, 0x5C, 0xF4, 0xBD, 0x1F, 0x06, 0x26, 0x0D, 0xE3, 0x29, 0xF9, 0x46, 0x59, 0x93, 0x7B, 0x13,
+    0x7B, 0x93, 0xFA, 0x61, 0x98, 0x93, 0xCC, 0x9B, 0xC8, 0x9B, 0xC4, 0x1B, 0x3D, 0x4D, 0xDE, 0x87,
+    0xB1, 0x59, 0xA2, 0xB4, 0x1B, 0x29, 0x4D, 0xD6, 0xDD, 0x09, 0xA7, 0x6D, 0x91, 0x8A, 0x92, 0xB4,
+    0x99, 0x98, 0x9B, 0x94, 0x1B, 0x01, 0x4D, 0xC6, 0x2F, 0x22, 0xDE, 0x2C, 0x06, 0x1C, 0x9F, 0x26,
+    0x25, 0xC6, 0x84, 0xF6, 0xBF, 0xB9, 0x0D, 0xD5, 0xAD, 0x08, 0x2E, 0x3B, 0x2C, 0x79, 0xDB, 0x17,
+    0xD2, 0x8E, 0x7F, 0xAA, 0x25, 0x3F, 0x18, 0x46, 0x37, 0x67, 0x62, 0xA0, 0xDC, 0x8A, 0x85, 0x7A,
+    0xAE, 0x47, 0xBA, 0x76, 0x27, 0xDF, 0x8B, 0x80, 0x0B, 0x6E, 0x64, 0x18, 0xBB, 0xB7, 0x1E, 0x28,
+    0x93, 0xB4, 0x16, 0x29, 0x04, 0x68, 0x9D, 0x74, 0x50, 0x1D, 0x9F, 0xDE, 0x22, 0xAA, 0x5C, 0x6D,
+    0x51, 0xF3, 0xE6, 0x5B, 0x8A, 0x23, 0x1B, 0xB5, 0x51, 0x8B, 0x7D, 0x74, 0xBE, 0xB2, 0x8A, 0xD1,
+    0x08, 0x9A, 0x59, 0xCC, 0xF6, 0xAB, 0x43, 0x2E, 0xBC, 0x7A, 0x57, 0x66, 0xC3, 0xF1, 0x10, 0x72,
+    0xC9, 0xEC, 0x88, 0xA6, 0x98, 0x6F, 0xC3, 0x4B, 0xEA, 0x71, 0x3A, 0x1E, 0x05, 0x4B, 0xD3, 0x25,
+    0x34, 0xBF, 0x8E, 0x0A, 0x75, 0xBA, 0xE0, 0x19, 0x16, 0xB7, 0xC5, 0xC0, 0xBE, 0x39, 0xAE, 0xDE,
+    0x37, 0x60, 0x2B, 0x9D, 0x2C, 0xF8, 0xAF, 0x28, 0xA5, 0xFF, 0x73, 0xE8, 0xF1, 0x92, 0x16, 0x53,
+    0x3C, 0x2D, 0x5E, 0x52, 0xB0, 0xC0, 0xDD, 0xF4, 0x54, 0x20, 0xCA, 0x4E, 0xF2, 0x63, 0x2D, 0xEF,
+    0xD1, 0x5A, 0xB0, 0x56, 0x4F, 0x16, 0x04, 0xDE, 0x5A, 0xDC, 0xE3, 0x95, 0xDC, 0xD8, 0x30, 0x15,
+    0xFA, 0x7E, 0xC8, 0xD5, 0x9B, 0x6B, 0x36, 0xF4, 0xE0, 0x27, 0x03, 0xCB, 0xDD, 0x0A, 0xC5, 0x11,
+    0x4D, 0xB0, 0x5F, 0x7E, 0x92, 0xCA, 0x20, 0xD8, 0x8D, 0x5A, 0x6A, 0xE9, 0x6E, 0x41, 0x47, 0x09,
+    0x1A, 0xB6, 0xC5, 0x59, 0x84, 0x9A, 0xAC, 0x4A, 0xFD, 0xD4, 0x2C, 0xFC, 0xD4, 0x4D, 0x80, 0xDA,
+    0x72, 0xE5, 0xC3, 0xD0, 0x99, 0x46, 0x9A, 0x4F, 0x42, 0x47, 0x3F, 0xCC, 0x28, 0x8D, 0xF4, 0xAD,
+    0xC7, 0x24, 0x52, 0x57, 0xB6, 0xE8, 0xA8, 0x77, 0x8D, 0x8A, 0x09, 0x3C, 0x8A, 0x8E, 0x70, 0x04,
+    0xB9, 0xED, 0xB6, 0x22, 0x85, 0x6F, 0x3F, 0x95, 0x0A, 0x64, 0x7D, 0x22, 0x78, 0x24, 0xF5, 0xF5,
+    0x13, 0x89, 0xE4, 0x28, 0x99, 0xAE, 0x64, 0xCF, 0xAE, 0xE0, 0xA6, 0x09, 0x28, 0x2C, 0x3D, 0x31,
+    0x41, 0xAE, 0x03, 0x32, 0x3D, 0x0E, 0xA0, 0x9F, 0x55, 0xFB, 0xDC, 0xDA, 0xEF, 0x5A, 0xC0, 0xBF,
+    0x5A, 0x50, 0x8E, 0xD7, 0x00, 0xCD, 0x1A, 0x93, 0x4C, 0xE6, 0x03, 0x17, 0xFB, 0xE9, 0xF5, 0x5E,
+    0xD2, 0x1A, 0xCE, 0x8C, 0xEE, 0x27, 0x27, 0x18, 0xB4, 0x81, 0x8B, 0x48, 0xEE, 0x72, 0x85, 0xD2,
+    0x44, 0x4F, 0xD9, 0x9C, 0xC7, 0xA8, 0x96, 0xED, 0x3D, 0x77, 0x90, 0x6E, 0x10, 0x5E, 0xBF, 0xFF,
+    0xA3, 0x2E, 0xEC, 0xAF, 0xB7, 0x71, 0xF7, 0x9B, 0x5B, 0x15, 0xC3, 0x96, 0x6E, 0x3D, 0xBF, 0xFD,
+    0x42, 0xEB, 0xCA, 0xD2, 0xDA, 0x13, 0x3A, 0x36, 0x9A, 0x35, 0x52, 0x77, 0xE8, 0x8D, 0xE0, 0x99,
+    0x22, 0x7D, 0x8B, 0x23, 0x12, 0xAE, 0xD0, 0x27, 0x27, 0x1A, 0x09, 0xA4, 0x8D, 0x52, 0x9A, 0x12,
+    0x7D, 0xEB, 0x19, 0x01, 0xF9, 0x61, 0x59, 0x4A, 0xFF, 0xBD, 0xB8, 0x9C, 0x5B, 0xC2, 0x17, 0x3D,
+    0xFE, 0x2C, 0x3A, 0xFE, 0x3F, 0xFE, 0xC1, 0x76, 0x3F, 0x4A, 0x7E, 0x65, 0x08, 0x5D, 0x63, 0xA2,
+    0xE5, 0x4F, 0x79, 0x53, 0x0F, 0x5E, 0x4F, 0xBF, 0x3A, 0xC6, 0x74, 0x57, 0xD4, 0x71, 0xA7, 0xEC,
+    0xC7, 0x05, 0x97, 0xC9, 0x47, 0x9A, 0xAE, 0x84, 0x3F, 0xC5, 0x71, 0x71, 0x7F, 0xC4, 0x53, 0xE3,
+    0x39, 0x99, 0x36, 0xF8, 0x25, 0xE8, 0xF4, 0xF4, 0x73, 0xD1, 0xFB, 0xD9, 0x49, 0x3C, 0x48, 0x96,
+    0xB6, 0x8E, 0x15, 0x05, 0x26, 0x06, 0x89, 0x0D, 0xF9, 0x35, 0x62, 0x48, 0xD7, 0x97, 0x5B, 0xA4,
+    0x8A, 0x3B, 0x2C, 0x2D, 0x37, 0x26, 0x28, 0xD9, 0x62, 0xBA, 0xEE, 0xC5, 0x48, 0x7D, 0x1F, 0x11,
+    0x24, 0xAB, 0x3B, 0xD1, 0xB1, 0xC5, 0x9D, 0x50, 0xEC, 0x44, 0x16, 0xD9, 0xA6, 0x30, 0xB1, 0x8E,
+    0xAE, 0xDD, 0x29, 0xE0, 0xB6, 0x17, 0x9A, 0xB8, 0x3D, 0x37, 0x8C, 0x57, 0xE7, 0x66, 0xB8, 0x6F,
+    0x51, 0xEE, 0xD0, 0xD6, 0x01, 0xF0, 0xB3, 0x5D, 0xCE, 0x98, 0x55, 0x9A, 0x8A, 0x48, 0x75, 0x5A,
+    0xBA, 0xB6, 0x14, 0x2F, 0x7F, 0x94, 0xD2, 0x37, 0x39, 0xE1, 0xFA, 0xE8, 0x2D, 0x3A, 0x13, 0xD3,
+    0xDA, 0xC8, 0xD6, 0xAC, 0xD4, 0x1A, 0x53, 0x46, 0xC5, 0x07, 0xD0, 0x44, 0x67, 0xB5, 0x5C, 0xC3,
+    0x0C, 0xDD, 0x18, 0x13, 0x2A, 0x68, 0x84, 0x61, 0xCC, 0x34, 0x82, 0xFA, 0x42, 0x2D, 0x99, 0xDA,
+    0x42, 0x50, 0x88, 0x52, 0x50, 0x89, 0xEA, 0x80, 0x6E, 0xC7, 0x1D, 0x7C, 0xC6, 0xF0, 0x00, 0xC9,
+    0x60, 0x19, 0x05, 0x9A, 0xAB, 0x7C, 0x42, 0x9B, 0xB2, 0x29, 0x9D, 0x85, 0xAB, 0x83, 0x12, 0xD8,
+    0x92, 0x22, 0xEA, 0x68, 0x06, 0xEA, 0x70, 0x00, 0x34, 0x7F, 0x66, 0x09, 0xC8, 0x3F, 0xB2, 0xB8,
+    0xEB, 0x77, 0x6D, 0x37, 0xFF, 0xBA, 0x39, 0x7F, 0x9F, 0x0E, 0xD0, 0xCD, 0x6A, 0x66, 0x4A, 0xE9,
+    0xF0, 0x53, 0x92, 0xC7, 0x88, 0xC4, 0xE8, 0x37, 0x64, 0x3B, 0x68, 0x58, 0xA0, 0x5A, 0xE8, 0x02,
+    0xB8, 0x40, 0x17, 0xA0, 0x9E, 0x18, 0x26, 0x68, 0x6C, 0x69, 0xDE, 0x96, 0xE6, 0xC7, 0x52, 0x3D,
+    0xF8, 0xA7, 0x43, 0x2C, 0xE1, 0x52, 0x44, 0xEB, 0x63, 0x94, 0x6D, 0x54, 0x3D, 0xC0, 0xF2, 0xE8,
+    0x3F, 0xCA, 0x89, 0xAB, 0x48, 0x6B, 0x3F, 0x5E, 0x14, 0x71, 0x17, 0x13, 0xE8, 0x52, 0x38, 0x8D,
+    0xD9, 0xEB, 0x9F, 0x7D, 0x72, 0xDF, 0x2C, 0x23, 0xD0, 0xCD, 0x31, 0x2C, 0x5A, 0x4F, 0x7D, 0xDB,
+    0x44, 0xB3, 0xF3, 0x1B, 0x5A, 0xC1, 0x2D, 0xB9, 0x26, 0x18, 0xDA, 0x52, 0x50, 0x6C, 0x86, 0x6C,
+    0x19, 0x9D, 0x07, 0x8A, 0xCB, 0x31, 0x17, 0x32, 0xCD, 0x27, 0x99, 0x8D, 0x64, 0xF9, 0x65, 0xE7,
+    0x8E, 0x27, 0x95, 0xF3, 0xAB, 0x38, 0xED, 0x0E, 0xF0, 0x0F, 0xA5, 0x39, 0x21, 0x62, 0x75, 0xD4,
+    0xB7, 0x8F, 0xBE, 0xD2, 0x7E, 0xB8, 0xE0, 0x2C, 0x7B, 0xF4, 0x55, 0x2D, 0xE4, 0x67, 0x9C, 0x14,
+    0x45, 0x10, 0x9A, 0xA7, 0x37, 0x6D, 0xD2, 0x84, 0xC5, 0x71, 0x85, 0x77, 0xC4, 0xA4, 0xEB, 0x77,
+    0x6F, 0x1E, 0x42, 0x9D, 0xF0, 0xEF, 0xC8, 0x5E, 0xB3, 0xB5, 0x6D, 0x12, 0x04, 0xB3, 0x61, 0xB5,
+    0x41, 0xF8, 0xD1, 0x88, 0xBC, 0x75, 0x73, 0x3F, 0x59, 0xE2, 0x2E, 0xB9, 0xCF, 0x06, 0xE4, 0x6A,
+    0x8D, 0xC5, 0x40, 0xB9, 0x62, 0x56, 0x36, 0xAE, 0xF1, 0xCD, 0xC1, 0x56, 0xB6, 0xA5, 0x55, 0x1A,
+    0xE3, 0x3E, 0xE4, 0x0A, 0x9F, 0x79, 0x7C, 0x34, 0x56, 0xC2, 0xF5, 0x60, 0x79, 0xA2, 0x66, 0x2D,
+    0x03, 0x74, 0x53, 0xBE, 0x80, 0xFE, 0xD5, 0x60, 0x89, 0xD8, 0x95, 0xE2, 0xBC, 0xA1, 0x85, 0x4A,
+    0x8F, 0x6E, 0xD2, 0x0E, 0x74, 0x4B, 0x34, 0xC5, 0x77, 0xC7, 0x28, 0x0E, 0xA5, 0x24, 0xF3, 0x3C,
+    0x7A, 0xB0, 0xFD, 0xF0, 0xD1, 0x08, 0x24, 0xBF, 0xCE, 0x9D, 0x16, 0xAA, 0x25, 0xDF, 0x49, 0xB1,
+    0x41, 0x0C, 0xD1, 0x62, 0xC6, 0x6A, 0x38, 0x3E, 0x84, 0x85, 0xB9, 0xFB, 0xE8, 0xB1, 0xA6, 0xC4,
+    0x23, 0x2F, 0xA9, 0xA5, 0x8C, 0xC1, 0xD3, 0x37, 0x6F, 0x2E, 0xE6, 0x2A, 0x1A, 0x96, 0xE5, 0x0A,
+    0xA3, 0x32, 0x2E, 0x95, 0xE7, 0xF6, 0x1F, 0xC1, 0x45, 0x25, 0x20, 0xB5, 0x51, 0x53, 0xA7, 0x93,
+    0xBB, 0x70, 0xE1, 0x13, 0xFA, 0x8B, 0x9B, 0x9B, 0x64, 0xB8, 0x33, 0x4B, 0x35, 0x19, 0xA3, 0x0A,
+    0xFB, 0xA3, 0x3B, 0x93, 0xA0, 0x07, 0x40, 0x76, 0x8F, 0x1F, 0x87, 0x72, 0xC9, 0x8F, 0x24, 0x0E,
+    0x16, 0x92, 0x15, 0x06, 0xB2, 0x0D, 0x47, 0x0B, 0x64, 0xED, 0x0F, 0x2F, 0xA7, 0xAC, 0xCC, 0x24,
+    0x4A, 0xAC, 0x51, 0x22, 0xA2, 0xC9, 0xF3, 0xE9, 0x73, 0x65, 0x37, 0xAF, 0x58, 0xC0, 0x9B, 0x8F,
+    0xB4, 0x47, 0x1E, 0x15, 0xA7, 0xEE, 0x09, 0x54, 0xC7, 0x5B, 0xF7, 0x12, 0x87, 0xDC, 0x7A, 0x61,
+    0x90, 0x7D, 0x91, 0xF1, 0xA7, 0x8B, 0xA5, 0x2B, 0x31, 0x2A, 0x1E, 0x23, 0x77, 0x6C, 0x9F, 0x1B,
+    0x73, 0xCC, 0x0F, 0x34, 0xDE, 0xB8, 0xE3, 0xE6, 0xE6, 0x5E, 0x64, 0x4D, 0x2D, 0x69, 0x8E, 0x9C,
+    0xB1, 0xFF, 0x8D, 0x31, 0xC3, 0x99, 0x39, 0xB4, 0x12, 0x8E, 0x31, 0x7D, 0x65, 0xB3, 0x25, 0x47,
+    0xB2, 0x54, 0xFF, 0x01, 0x4B, 0xBA, 0xED, 0xE0, 0x3C, 0x84, 0x52, 0x47, 0xE4, 0x45, 0x75, 0x64,
+    0x1B, 0xE5, 0x4E, 0xD3, 0x16, 0xC7, 0x9B, 0x9A, 0x8D, 0x11, 0x92, 0x0E, 0x3A, 0x49, 0x6D, 0x73,
+    0x7C, 0xE5, 0xBE, 0x71, 0xC1, 0xDC, 0x00, 0xCD, 0xFC, 0x73, 0xB3, 0x1C, 0xC6, 0x82, 0xB4, 0xE5,
+    0x03, 0x3C, 0x38, 0xDA, 0x1F, 0x56, 0xEA, 0xF9, 0xE9, 0x74, 0x2C, 0xF2, 0xED, 0x02, 0xB0, 0x45,
+    0x07, 0x7C, 0x98, 0x0C, 0xA3, 0x3F, 0x65, 0x35, 0x93, 0x7A, 0xA3, 0x4E, 0xB3, 0x96, 0xC1, 0xE4,
+    0x54, 0xFF, 0x6A, 0x58, 0xCF, 0x00, 0x78, 0x2D, 0x25, 0x2D, 0x95, 0x1E, 0xDD, 0x18, 0x6D, 0xDC,
+    0x92, 0xE4, 0xD3, 0x49, 0x1A, 0xCB, 0x94, 0x8D, 0xEA, 0x89, 0x25, 0xB5, 0x0F, 0xAF, 0xEB, 0xB4,
+    0xCB, 0x90, 0xA4, 0xB4, 0xEB, 0x63, 0x6A, 0x30, 0x3B, 0xEE, 0xA5, 0xE4, 0xBB, 0xE6, 0x2B, 0xA0,
+    0xD9, 0xE2, 0xE3, 0x2A, 0x40, 0x71, 0x64, 0x02, 0x8A, 0xA3, 0x9B, 0x81, 0xD2, 0x94, 0x4E, 0x04,
+    0xDF, 0xA2, 0xDA, 0x88, 0x59, 0x90, 0x1F, 0xFF, 0x01, 0xCC, 0x05, 0xCD, 0x09, 0xE1, 0xEC, 0x24,
+    0x5D, 0x64, 0x06, 0x23, 0x9A, 0x07, 0xB3, 0x18, 0x91, 0x5B, 0xE9, 0x98, 0x6E, 0xFE, 0x09, 0xC9,
+    0x66, 0x44, 0x86, 0x15, 0x27, 0xA8, 0xB8, 0x9C, 0xEE, 0x43, 0x54, 0x47, 0x66, 0x36, 0xCE, 0x63,
+    0x6F, 0xDD, 0xDC, 0x3F, 0x03, 0x89, 0xEE, 0xDC, 0xC7, 0x96, 0xBA, 0xD4, 0x9A, 0x14, 0xD2, 0xC5,
+    0x74, 0xBC, 0xF6, 0x90, 0x37, 0xCD, 0xCB, 0x69, 0x13, 0x56, 0x55, 0x1A, 0x72, 0x6A, 0x3A, 0xD7,
+    0xED, 0x57, 0x30, 0xC2, 0x7F, 0xCF, 0xDF, 0xDC, 0x96, 0xD0, 0x99, 0x8A, 0xB3, 0xD8, 0x66, 0xAE,
+    0xC7, 0xA4, 0xA2, 0xFC, 0xBF, 0x7B, 0x7C, 0x10, 0x31, 0x22, 0x27, 0x69, 0x8E, 0x3A, 0x2A, 0xD7,
+    0xB7, 0xDE, 0x6A, 0x93, 0xC3, 0x6A, 0x32, 0x66, 0x4A, 0xAA, 0x38, 0x57, 0x67, 0xAE, 0x7C, 0x04,
+    0xCB, 0x80, 0xBB, 0x4A, 0x88, 0x52, 0x35, 0xDE, 0xCA, 0xCB, 0x34, 0x09, 0xBD, 0x5B, 0xAE, 0x53,
+    0x1A, 0x7E, 0x1E, 0x62, 0x75, 0xF1, 0xD0, 0x5A, 0xA9, 0xF2, 0xFD, 0x1F, 0x74, 0x69, 0x77, 0x1F,
+    0x7F, 0xA5, 0xBD, 0xB8, 0x79, 0xCD, 0x25, 0xA3, 0x77, 0xC4, 0x4A, 0x84, 0x19, 0xA4, 0x87, 0xFC,
+    0x93, 0xB3, 0x12, 0xA0, 0x4C, 0x51, 0x8B, 0xDD, 0x4A, 0x7D, 0x70, 0xED, 0x9E, 0xFB, 0x74, 0xA3,
+    0x6D, 0xF6, 0x65, 0x2B, 0x83, 0x6F, 0xF4, 0x04, 0x27, 0xCB, 0xDA, 0x29, 0xE0, 0x75, 0xE0, 0x44,
+    0x3E, 0xD8, 0x9F, 0xF8, 0x03, 0xA7, 0x96, 0x6A, 0x03, 0x1D, 0xED, 0x4F, 0xC8, 0x74, 0x78, 0x02,
+    0x75, 0x23, 0xFB, 0xB5, 0x9C, 0xCE, 0x3B, 0x4D, 0xE4, 0xFC, 0x47, 0x4F, 0xCF, 0x39, 0x62, 0xF8,
+    0xF6, 0xC5, 0xD7, 0xB0, 0x42, 0xAC, 0xDB, 0xDB, 0x0D, 0x0F, 0xB7, 0xF0, 0x71, 0xFC, 0x50, 0xD5,
+    0x04, 0xCD, 0xDC, 0xF5, 0xD0, 0xE8, 0x4F, 0x97, 0xE4, 0xFB, 0x16, 0x1A, 0x14, 0x60, 0x68, 0xFD,
+    0x0E, 0xF5, 0x54, 0x68, 0x24, 0x5F, 0x69, 0x36, 0xF0, 0x14, 0xEA, 0xA9, 0x66, 0x7C, 0x80, 0x77,
+    0x28, 0x05, 0x6E, 0x42, 0x33, 0x1C, 0x74, 0xFB, 0xE9, 0x4C, 0x9E, 0x5E, 0x68, 0xF4, 0xAE, 0xC3,
+    0x99, 0xD0, 0xCC, 0xFE, 0xEF, 0x6E, 0xBA, 0xBE, 0xF7, 0x1E, 0x7E, 0x8A, 0x2E, 0x40, 0x75, 0x28,
+    0x3A, 0x14, 0x7D, 0x42, 0x5B, 0x0C, 0xCE, 0xE4, 0x27, 0x2E, 0x15, 0x22, 0xBF, 0x6C, 0xC5, 0xE2,
+    0xEE, 0xC9, 0x67, 0x0C, 0xDC, 0x53, 0x04, 0x20, 0x2D, 0xAA, 0xF4, 0xB1, 0x9A, 0xE3, 0xC1, 0xCA,
+    0xDF, 0x43, 0xD1, 0x78, 0x9D, 0xEC, 0x1E, 0x60, 0xA9, 0x96, 0x58, 0xE5, 0x67, 0xE6, 0x28, 0x66,
+    0xAB, 0x52, 0x66, 0xE2, 0x03, 0x9D, 0xCC, 0xE1, 0x57, 0x0E, 0x92, 0x40, 0x44, 0x37, 0xDD, 0x7F,
+    0x5F, 0x82, 0x7C, 0x47, 0x4B, 0x92, 0x08, 0xDE, 0xA5, 0x12, 0x14, 0xC1, 0x2A, 0xD5, 0x7A, 0x34,
+    0x26, 0x91, 0x28, 0x16, 0xFC, 0x0A, 0x6E, 0x2E, 0x63, 0xFB, 0x48, 0x44, 0xAA, 0x2E, 0xD1, 0x44,
+    0xD4, 0x91, 0x91, 0xC3, 0x49, 0x28, 0x22, 0x4C, 0xE4, 0x56, 0x60, 0xCA, 0x34, 0x9E, 0x52, 0xE1,
+    0x13, 0xFA, 0x76, 0xA4, 0x22, 0x89, 0x5B, 0x62, 0x91, 0x4A, 0x77, 0x87, 0xF1, 0x4A, 0xD7, 0xC6,
+    0x52, 0x26, 0xD3, 0x1E, 0xB1, 0xD6, 0xD1, 0xFF, 0x40, 0xD5, 0x35, 0x6F, 0xBC, 0xFB, 0xE5, 0x53,
+    0x26, 0x2A, 0x49, 0xB1, 0x9E, 0x71, 0xB6, 0x60, 0xB7, 0x8F, 0x02, 0x11, 0xCB, 0x84, 0xBA, 0x6B,
+    0x0C, 0x29, 0x4A, 0x83, 0x35, 0xC6, 0xC4, 0xFC, 0x43, 0xBD, 0x73, 0xF7, 0x37, 0x93, 0x28, 0x14,
+    0x1A, 0x19, 0xB4, 0x3A, 0x51, 0x48, 0xB3, 0xDF, 0x78, 0x4D, 0xEA, 0x4D, 0x0E, 0x0A, 0x4D, 0xE4,
+    0xC2, 0xE9, 0xFD, 0xEC, 0x41, 0xAC, 0x2C, 0x0D, 0x49, 0x08, 0xAE, 0x62, 0x3E, 0x4B, 0x33, 0x1C,
+    0xB7, 0x94, 0x83, 0xE5, 0x3D, 0xFC, 0x7C, 0x06, 0x54, 0x66, 0x10, 0x86, 0x70, 0xDE, 0xC5, 0xAB,
+    0x92, 0x7A, 0xC3, 0xAF, 0x1C, 0x91, 0xEB, 0xC6, 0x74, 0xFF, 0x7D, 0x29, 0xB2, 0xDC, 0x38, 0xFE,
+    0x2E, 0x95, 0x22, 0xBF, 0x8D, 0xDD, 0xEF, 0x50, 0x2A, 0x32, 0xDB, 0x78, 0x6D, 0xAC, 0x96, 0xB4,
+    0x46, 0x46, 0x17, 0x51, 0x9F, 0x68, 0x3D, 0xB9, 0x6C, 0x4C, 0x76, 0x6B, 0x64, 0xB1, 0x71, 0xD8,
+    0x47, 0x43, 0x77, 0x24, 0xF6, 0x5E, 0x71, 0xF7, 0xE6, 0xFE, 0xD5, 0x7E, 0x6B, 0x74, 0xB5, 0xEB,
+    0x22, 0x65, 0xA3, 0xC1, 0x88, 0x80, 0xA2, 0xAE, 0x2A, 0x04, 0xE3, 0x09, 0x6F, 0x7C, 0xE5, 0x6F,
+    0x62, 0x09, 0xDF, 0x7C, 0xFA, 0x9B, 0x27, 0xC0, 0xD0, 0x9C, 0xB6, 0x4E, 0x3D, 0x9D, 0xAC, 0x25,
+    0xE5, 0x68, 0xB3, 0x7F, 0x16, 0xD5, 0x41, 0x66, 0x37, 0x14, 0x81, 0x2C, 0xFB, 0xF2, 0xA8, 0x0B,
+    0xD2, 0x0D, 0x2D, 0xBC, 0x71, 0xCF, 0xA2, 0x7A, 0xBD, 0x1F, 0x15, 0x81, 0xDF, 0x70, 0xC6, 0xF7,
+    0x7F, 0xA8, 0xA3, 0xD0, 0x08, 0x5A, 0xA3, 0x16, 0xF0, 0x7A, 0x78, 0x67, 0x08, 0x56, 0x6A, 0x3B,
+    0xE6, 0x52, 0x6A, 0x82, 0x49, 0x68, 0xE4, 0x48, 0x1E, 0x4B, 0xE7, 0x1E, 0xE8, 0x4B, 0xCF, 0x57,
+    0xB4, 0x69, 0x39, 0x4B, 0x18, 0xCD, 0xB5, 0x4B, 0xA9, 0x9A, 0x8B, 0x74, 0xFA, 0xAB, 0xCC, 0x88,
+    0x9E, 0x4D, 0x36, 0xE4, 0x47, 0xB9, 0x26, 0x15, 0x20, 0xAB, 0xF8, 0x18, 0x14, 0xA8, 0x96, 0x42,
+    0x53, 0x94, 0x86, 0xA6, 0xCF, 0x35, 0x46, 0x83, 0xF0, 0x2E, 0x85, 0xD2, 0xE6, 0xB7, 0x34, 0xA4,
+    0x99, 0x03, 0x5D, 0x85, 0xB6, 0x43, 0xEA, 0x22, 0x0B, 0x89, 0xC7, 0x69, 0xDB, 0xC7, 0xAC, 0x4D,
+    0x4F, 0xD1, 0x96, 0x4A, 0x7B, 0xDE, 0x49, 0x6B, 0x32, 0x04, 0x5E, 0xEA, 0x6F, 0x6F, 0xF8, 0x4B,
+    0x45, 0x41, 0x0C, 0x72, 0x48, 0x0C, 0x30, 0xD4, 0xE8, 0x4F, 0x57, 0xA0, 0xDC, 0xCA, 0xED, 0x43,
+    0x98, 0xC1, 0x5C, 0x2D, 0x6E, 0xC3, 0x6D, 0xD0, 0xCD, 0xD6, 0x5C, 0xD7, 0x66, 0xEA, 0x71, 0x1B,
+    0x6E, 0x87, 0x2E, 0xD8, 0xB1, 0x31, 0xD3, 0x88, 0x3B, 0xA8, 0x0C, 0xE0, 0xF1, 0x2B, 0x99, 0xC6,
+    0x4C, 0x13, 0x4E, 0x76, 0x6C, 0xC5, 0x6F, 0x64, 0x9A, 0xD0, 0x4C, 0x25, 0x4A, 0xBD, 0x75, 0xD3,
+    0x6D, 0x86, 0x88, 0xCD, 0xC6, 0xC8, 0xBE, 0xB4, 0x0D, 0xDC, 0xD8, 0x06, 0x36, 0xE6, 0x16, 0xC6,
+    0xDC, 0x5A, 0xA0, 0x05, 0xAD, 0x94, 0x1A, 0x0B, 0x4D, 0x34, 0xB2, 0x63, 0x2B, 0xC3, 0x16, 0xC1,
+    0x43, 0x7F, 0x82, 0x66, 0x95, 0x80, 0xCA, 0x30, 0x76, 0xF5, 0x14, 0x7B, 0xB5, 0x52, 0xEC, 0xF8,
+    0x91, 0xFB, 0xCF, 0xA4, 0x09, 0x2F, 0xC0, 0xBD, 0xF9, 0x57, 0x43, 0x9F, 0x3C, 0x34, 0xBB, 0xD0,
+    0xD5, 0xDB, 0x0F, 0x9E, 0x44, 0x20, 0xDB, 0x5B, 0x62, 0xE5, 0x3F, 0x88, 0x4A, 0x6D, 0x33, 0x16,
+    0xA2, 0x0A, 0x99, 0xFA, 0x7C, 0x63, 0x18, 0x39, 0xF0, 0x01, 0xDF, 0xD7, 0x2B, 0xCD, 0x54, 0xED,
+    0xB8, 0x50, 0x88, 0x72, 0xCB, 0x34, 0x16, 0x62, 0x98, 0x51, 0xEF, 0x57, 0x86, 0xA9, 0xDE, 0xF1,
+    0xA1, 0x52, 0x5B, 0x6F, 0xBC, 0x31, 0xDE, 0x69, 0x4F, 0x2A, 0x17, 0x82, 0x7A, 0xA5, 0x10, 0x34,
+    0x0B, 0xE5, 0x01, 0x3E, 0x50, 0x19, 0x99, 0xDD, 0x0E, 0x43, 0xA0, 0xDE, 0x21, 0x51, 0x6C, 0xB3,
+    0x1A, 0x2E, 0x4B, 0x00, 0x5A, 0xC4, 0x21, 0x2D, 0x28, 0x50, 0xAA, 0x8D, 0x84, 0xCE, 0xF4, 0x17,
+    0x37, 0x9F, 0x95, 0xB9, 0xC9, 0xB1, 0x03, 0xEB, 0xA0, 0x4C, 0x89, 0x71, 0x29, 0x81, 0x94, 0xF1,
+    0x69, 0x4D, 0xA4, 0xF6, 0x07, 0x99, 0x02, 0x7E, 0x27, 0x57, 0xA0, 0xDB, 0x28, 0x34, 0x5F, 0x68,
+    0x3D, 0xF4, 0x31, 0xD0, 0xCC, 0xF4, 0x55, 0xEB, 0xCD, 0x44, 0x12, 0x99, 0x8E, 0x7B, 0x91, 0x6A,
+    0x2E, 0x00, 0xF5, 0x7F, 0xD4, 0x43, 0x1A, 0x69, 0x31, 0xA2, 0x75, 0x7A, 0xBC, 0x31, 0x2C, 0xF9,
+    0x86, 0xC6, 0x7C, 0xCB, 0xD4, 0xE7, 0x5B, 0x2E, 0x8A, 0xB5, 0x10, 0xC5, 0x5A, 0x1E, 0x54, 0x4B,
+    0xB5, 0xE3, 0x82, 0xDB, 0xA8, 0x43, 0xBD, 0xE1, 0x43, 0xB3, 0xE2, 0x67, 0xBF, 0x32, 0x4C, 0xDD,
+    0x82, 0xC6, 0x61, 0xC9, 0x34, 0xDE, 0xFD, 0xD7, 0xD9, 0xBD, 0xEB, 0x22, 0x42, 0xB7, 0x79, 0x18,
+    0x9E, 0xAC, 0x14, 0x7F, 0xAD, 0xD1, 0x4A, 0x08, 0x7F, 0xE6, 0xA5, 0xFD, 0x1D, 0xA9, 0x78, 0xF5,
+    0xB7, 0x62, 0x48, 0x99, 0xA9, 0x87, 0x6A, 0x4F, 0x01, 0xA6, 0xC6, 0x18, 0xC8, 0xD4, 0x4B, 0x34,
+    0x98, 0x85, 0x92, 0xC9, 0xED, 0x26, 0xC8, 0x95, 0xA2, 0x28, 0x3F, 0xBF, 0xF0, 0xC3, 0x95, 0x52,
+    0x75, 0x97, 0x81, 0xDA, 0x29, 0xAD, 0x69, 0xC5, 0x84, 0x3D, 0xBC, 0x71, 0x16, 0xC1, 0xFB, 0x62,
+    0x2E, 0xE4, 0xC6, 0xE6, 0xF8, 0x3C, 0x9B, 0x42, 0xF5, 0x0D, 0xF5, 0xEE, 0x93, 0xCF, 0xB9, 0x66,
+    0xD5, 0x17, 0xC1, 0x8F, 0x64, 0xB7, 0x1B, 0x8A, 0xCB, 0xD8, 0xD0, 0x64, 0x50, 0x22, 0xF5, 0x0C,
+    0x6A, 0x29, 0x76, 0xDB, 0xEE, 0xC3, 0x98, 0xE4, 0x88, 0xCF, 0xCD, 0x29, 0x9F, 0x71, 0x77, 0xD0,
+    0x6E, 0xDD, 0x9B, 0x5E, 0x3A, 0x18, 0xF4, 0xE8, 0xCB, 0x1F, 0x46, 0xCB, 0x17, 0xDF, 0x4A, 0x2E,
+    0x43, 0x79, 0x10, 0x17, 0xEB, 0xB6, 0xF3, 0xBF, 0x35, 0x91, 0x2A, 0xD6, 0x6A, 0x24, 0xFB, 0xDA,
+    0x4D, 0xC9, 0xDF, 0xB0, 0xE2, 0xD8, 0x3E, 0x12, 0x2B, 0xB7, 0xEE, 0xD8, 0x74, 0xCD, 0x4A, 0x09,
+    0x9A, 0x70, 0xBB, 0xF9, 0x00, 0x91, 0x5C, 0x7E, 0x4B, 0x76, 0xE2, 0xCD, 0x48, 0x92, 0x1B, 0x06,
+    0x69, 0xEC, 0xA4, 0xC5, 0x4B, 0x7B, 0xF3, 0xAD, 0x47, 0x2F, 0x31, 0xD5, 0xF9, 0xBF, 0x8F, 0x5B,
+    0xB9, 0xEB, 0x8D, 0x46, 0x2E, 0x18, 0x91, 0xB2, 0x23, 0x16, 0x19, 0xF9, 0xD1, 0x0E, 0x96, 0x29,
+    0xA9, 0xA4, 0xD6, 0x94, 0xAC, 0xF5, 0xB6, 0xD8, 0x4A, 0xB3, 0xC7, 0x7D, 0x92, 0x13, 0xB7, 0x19,
+    0x2D, 0x9B, 0x25, 0x36, 0x98, 0x06, 0x5B, 0x64, 0x37, 0xD9, 0x12, 0x2D, 0x17, 0x40, 0xA6, 0x96,
+    0xDC, 0x32, 0x01, 0xC4, 0xAA, 0x1E, 0xAA, 0xDD, 0x3E, 0xEE, 0x36, 0x33, 0xC3, 0x7E, 0xB5, 0x8A,
+    0xA9, 0x6E, 0x31, 0x89, 0x50, 0x20, 0xD3, 0x4C, 0xBE, 0xDD, 0xB3, 0xE6, 0xAC, 0x29, 0xF6, 0xC2,
+    0xED, 0x46, 0x81, 0x6A, 0x23, 0xC5, 0x71, 0x7E, 0x8E, 0xD5, 0x68, 0x9A, 0x2C, 0x4E, 0xCE, 0x63,
+    0xE3, 0xC2, 0x0B, 0xF0, 0x9C, 0x8F, 0xF7, 0xB1, 0x92, 0xAA, 0xEB, 0x63, 0x56, 0x5F, 0x71, 0x3F,
+    0x66, 0x07, 0x46, 0x94, 0x22, 0xA5, 0xE0, 0xCB, 0x35, 0x12, 0xE0, 0xCC, 0xAA, 0x35, 0x21, 0x32,
+    0xA7, 0x9B, 0x0D, 0x40, 0xC9, 0xD4, 0xDB, 0xF7, 0xBB, 0xF5, 0xAC, 0x4F, 0x1E, 0xC9, 0x2C, 0x84,
+    0xE9, 0xE1, 0xB5, 0x70, 0xC6, 0x2A, 0xDD, 0x6C, 0x64, 0x72, 0xBB, 0xF1, 0xB6, 0xD0, 0x08, 0x37,
+    0xF7, 0x5E, 0x21, 0x5A, 0x1A, 0xAF, 0x3E, 0xB5, 0xC5, 0x6F, 0x56, 0x6F, 0xD4, 0x4D, 0x0C, 0x29,
+    0x0E, 0xC8, 0xAC, 0x19, 0xD1, 0xC8, 0xEF, 0x56, 0xA3, 0x6F, 0xAE, 0x36, 0xE6, 0xBC, 0x83, 0x11,
+    0xD8, 0x1D, 0x56, 0x06, 0x95, 0x69, 0x32, 0x0A, 0xC7, 0x62, 0x1F, 0xEE, 0x3E, 0xEE, 0x81, 0x8F,
+    0xF7, 0xC5, 0x46, 0xD7, 0x57, 0x0B, 0xC2, 0x85, 0xEC, 0xA0, 0x99, 0x8A, 0xCD, 0x0A, 0xC9, 0xD4,
+    0xBA, 0x25, 0x13, 0x4D, 0x28, 0x44, 0x37, 0xDF, 0x7D, 0x17, 0xF2, 0xA7, 0x2D, 0xD9, 0xA3, 0x16,
+    0x4D, 0xD6, 0x70, 0x62, 0xAC, 0x8F, 0xAC, 0x2C, 0x0F, 0x70, 0x07, 0xB9, 0x5A, 0x0A, 0xB5, 0x68,
+    0x24, 0x8B, 0x99, 0xA3, 0x61, 0xB6, 0xF9, 0x00, 0x0B, 0xE5, 0x0E, 0xF5, 0x46, 0x2E, 0xA3, 0xA3,
+    0x46, 0x0A, 0xB5, 0xF8, 0x19, 0x34, 0x52, 0x2F, 0x30, 0x04, 0x2A, 0x4B, 0x82, 0x14, 0x02, 0xB7,
+    0x91, 0x69, 0xA4, 0x14, 0x0C, 0x33, 0xB9, 0x7A, 0xFC, 0x02, 0x9A, 0xCC, 0xF4, 0x06, 0x4A, 0x41,
+    0xB3, 0x5A, 0xEA, 0xC4, 0x6C, 0x40, 0x61, 0xED, 0x30, 0xB9, 0x7A, 0xEB, 0x2B, 0x9A, 0x70, 0x02,
+    0x1F, 0xC8, 0x1F, 0x8F, 0x09, 0x4C, 0x31, 0x1F, 0xD7, 0x76, 0x5A, 0x3E, 0x1B, 0x0E, 0x14, 0x5B,
+    0x32, 0x62, 0x79, 0xA4, 0xF5, 0xAF, 0x47, 0x94, 0x38, 0x42, 0xB9, 0x29, 0xF4, 0xE0, 0x0D, 0xBD,
+    0x7F, 0x8B, 0x69, 0xAF, 0xB7, 0xB0, 0x81, 0x9F, 0xC9, 0x37, 0x18, 0x26, 0x8A, 0x0D, 0x34, 0x59,
+    0x2B, 0xE5, 0x88, 0x5B, 0x93, 0x53, 0x59, 0xBE, 0x7C, 0x98, 0x02, 0x1F, 0xEF, 0xA1, 0xEB, 0xF1,
+    0x23, 0x0C, 0x2D, 0x5D, 0x0F, 0x82, 0xA1, 0x25, 0x3B, 0xC0, 0xE2, 0xA8, 0xA8, 0xD9, 0xB2, 0x03,
+    0x8A, 0x95, 0x7C, 0x87, 0x72, 0xA1, 0xD8, 0xC0, 0x05, 0x7B, 0x9A, 0xAD, 0x05, 0x76, 0x4A, 0x3D,
+    0x9E, 0xCE, 0x94, 0x63, 0x1D, 0xA0, 0x6B, 0x69, 0x02, 0x0C, 0x26, 0x15, 0x82, 0x6E, 0x26, 0xDF,
+    0xE1, 0x73, 0x73, 0x2A, 0x51, 0x8D, 0x29, 0x0E, 0x45, 0x27, 0x38, 0x5C, 0x15, 0x4E, 0xB9, 0x18,
+    0x8D, 0x1C, 0xCF, 0xE4, 0x10, 0xE7, 0x5B, 0x35, 0xB1, 0x75, 0xEA, 0xFF, 0x5C, 0xAF, 0x9B, 0xD0,
+    0x9A, 0xD0, 0x4D, 0x56, 0x4A, 0x38, 0xF4, 0x56, 0x8D, 0xFC, 0x2A, 0x0C, 0x26, 0xA2, 0xEE, 0x71,
+    0x48, 0x40, 0x62, 0x57, 0x9C, 0x1C, 0x90, 0x0A, 0x49, 0x63, 0xEB, 0xD9, 0x33, 0x27, 0xA5, 0x74,
+    0x90, 0x15, 0x5F, 0xA6, 0x8A, 0x81, 0x94, 0x8A, 0x4B, 0xA9, 0xEC, 0x14, 0x6B, 0xAF, 0xB7, 0x4A,
+    0x58, 0x2D, 0xE8, 0x4A, 0x62, 0x11, 0x71, 0xBA, 0x14, 0x0D, 0xA6, 0x8E, 0x96, 0x2E, 0x70, 0xA9,
+    0x3E, 0x88, 0x57, 0xFA, 0xF8, 0xCF, 0x0E, 0x51, 0x30, 0x0C, 0x5F, 0x56, 0xEC, 0x64, 0xD0, 0xC6,
+    0x99, 0x5C, 0xC0, 0x1B, 0xE4, 0x90, 0x7D, 0x4E, 0x0F, 0x9F, 0x59, 0xAE, 0x61, 0x32, 0xD1, 0x97,
+    0xB5, 0x10, 0x6C, 0x03, 0xCA, 0xC3, 0x94, 0x4F, 0x33, 0x83, 0x1F, 0xCB, 0xED, 0x03, 0xC9, 0x76,
+    0xEF, 0x12, 0x09, 0x9B, 0xDF, 0x6A, 0x3C, 0xB5, 0xFF, 0xCB, 0xE5, 0x92, 0x37, 0xB5, 0xFF, 0xAD,
+    0x58, 0xB9, 0x19, 0x2F, 0x39, 0x3E, 0x2B, 0x67, 0x1E, 0x2E, 0x90, 0x5A, 0x76, 0x5C, 0xC1, 0xBD,
+    0x76, 0x99, 0xF5, 0x92, 0x4C, 0xF0, 0xB6, 0xCA, 0xF9, 0x94, 0x8D, 0xC6, 0x6A, 0x3B, 0x04, 0x97,
+    0xA1, 0x0E, 0xF0, 0xFA, 0x8D, 0x41, 0x08, 0xFD, 0x09, 0xB6, 0xC6, 0x58, 0xD7, 0x44, 0xA3, 0x5B,
+    0x2E, 0x31, 0x45, 0xB3, 0x5F, 0x24, 0xCC, 0xA2, 0x9F, 0xBB, 0x8F, 0xDA, 0x57, 0x57, 0x53, 0x36,
+    0x3B, 0xF8, 0x50, 0x1F, 0x50, 0x2F, 0xF5, 0x01, 0x6E, 0x73, 0x82, 0xE2, 0x70, 0x82, 0x5C, 0x3F,
+    0x2F, 0xAB, 0x9E, 0x6E, 0xA1, 0xFB, 0x4B, 0xB5, 0xD0, 0x7C, 0xEF, 0x32, 0xE1, 0xA2, 0x4C, 0xA0,
+    0xAB, 0x6D, 0xFC, 0x11, 0xB0, 0x66, 0x24, 0x6F, 0xF8, 0xB1, 0x76, 0xDB, 0xF4, 0x76, 0x52, 0xCC,
+    0x13, 0x8D, 0xA0, 0x7F, 0xAB, 0x15, 0x7C, 0x90, 0x7A, 0x9A, 0xAD, 0xD1, 0x82, 0x3B, 0x0A, 0xA9,
+    0x2D, 0xD5, 0x76, 0x0A, 0xB9, 0xCD, 0x39, 0x20, 0x76, 0x7E, 0xEB, 0xE4, 0x6D, 0x73, 0xBA, 0xCE,
+    0xE5, 0x76, 0xB2, 0x48, 0x27, 0xDD, 0x9B, 0xE9, 0xA6, 0xC5, 0x05, 0x8D, 0x94, 0xAB, 0x46, 0xF2,
+    0xC3, 0xE0, 0xB0, 0x3E, 0x8E, 0xE0, 0x68, 0xEC, 0xBE, 0x27, 0x28, 0x63, 0x2E, 0x74, 0x8C, 0x45,
+    0x02, 0xDD, 0xB7, 0xD5, 0xD3, 0xFC, 0xB5, 0x56, 0xDC, 0xE6, 0xD5, 0x96, 0x47, 0xA5, 0x25, 0x57,
+    0xAB, 0x57, 0xD5, 0x47, 0xDB, 0xCE, 0xD6, 0x92, 0xAA, 0x3C, 0x9A, 0x3D, 0x51, 0xBC, 0x52, 0xCA,
+    0x86, 0x14, 0xD6, 0x9A, 0x3C, 0x9F, 0x01, 0x72, 0x76, 0xEF, 0x86, 0x7C, 0xE9, 0x7A, 0x36, 0xDF,
+    0xF3, 0x05, 0x3F, 0xD2, 0x3C, 0x18, 0x71, 0xDF, 0x1E, 0x29, 0x35, 0x1A, 0x4F, 0x35, 0xD9, 0x2E,
+    0xF2, 0xBB, 0x61, 0x46, 0xD5, 0xB7, 0x37, 0x8A, 0xEF, 0x6A, 0xCC, 0x36, 0xBF, 0x71, 0x5C, 0xF4,
+    0x5E, 0xBE, 0x44, 0xA8, 0x3D, 0xDB, 0x52, 0x73, 0x8F, 0x9E, 0x2B, 0xB3, 0x2B, 0x84, 0x79, 0x17,
+    0xCF, 0x38, 0x9B, 0xC3, 0x94, 0xFE, 0xDA, 0x9E, 0xFB, 0xCB, 0xFA, 0x19, 0xDB, 0x17, 0xFF, 0x15,
+    0xA2, 0x7A, 0x70, 0xC7, 0xA3, 0xC7, 0x4B, 0x27, 0xE9, 0xEB, 0x92, 0xE4, 0x24, 0xAD, 0x9D, 0xA4,
+    0x3F, 0x4C, 0xED, 0x66, 0x6E, 0x8C, 0x21, 0xE2, 0xBB, 0xF1, 0x2E, 0xCD, 0x13, 0x78, 0xB5, 0x37,
+    0xF8, 0x34, 0x06, 0x94, 0xF9, 0x7E, 0xED, 0x3E, 0x0C, 0x6D, 0xF4, 0x2E, 0x74, 0xED, 0x5D, 0x74,
+    0x63, 0x0C, 0x04, 0x14, 0xDF, 0xCE, 0x8F, 0x18, 0x5A, 0x3D, 0xFF, 0x76, 0x7D, 0xBE, 0xAD, 0xD1,
+    0xBA, 0xEA, 0x3B, 0xF5, 0x94, 0xA6, 0x5E, 0x7D, 0x48, 0x05, 0xF6, 0xB7, 0x1D, 0xCA, 0x67, 0x7D,
+    0xC9, 0xDB, 0xAE, 0x69, 0xBD, 0x26, 0x05, 0x79, 0xF9, 0xBC, 0x75, 0x8E, 0x8C, 0x51, 0xA3, 0xE5,
+    0xC6, 0xFF, 0x47, 0x5F, 0xDD, 0x4B, 0x49, 0x5B, 0x25, 0x69, 0x73, 0x92, 0xD6, 0x5A, 0xD2, 0xD2,
+    0x48, 0x7A, 0x45, 0x8D, 0xA1, 0x57, 0xC2, 0xCB, 0xBA, 0x8D, 0xD8, 0x37, 0xAF, 0x10, 0xDD, 0xB2,
+    0xD2, 0xC4, 0x38, 0xD5, 0x51, 0x7D, 0x2C, 0x0E, 0x45, 0xF8, 0x99, 0x3E, 0xEE, 0x8A, 0x93, 0x60,
+    0xC7, 0x73, 0x04, 0x4B, 0xDE, 0x5A, 0xFD, 0x1C, 0xC1, 0x52, 0xE9, 0xD3, 0xF3, 0x6F, 0x97, 0xE7,
+    0xDB, 0x36, 0xD1, 0x07, 0x6A, 0xCD, 0x64, 0x3A, 0x5E, 0x8D, 0x6B, 0xAB, 0xB5, 0x1D, 0xE2, 0xB7,
+    0x78, 0xC7, 0x43, 0x30, 0xB5, 0x54, 0x68, 0xB4, 0x15, 0x39, 0x5D, 0xD4, 0xD8, 0x98, 0x88, 0x18,
+    0x8B, 0x7E, 0x53, 0xC6, 0x27, 0x57, 0x5B, 0x4F, 0x68, 0x74, 0x01, 0x1F, 0x8A, 0x8D, 0x66, 0xC9,
+    0x0F, 0xDC, 0x86, 0x28, 0x44, 0x37, 0x66, 0xEA, 0xFD, 0x8C, 0x26, 0x17, 0x8C, 0x0F, 0xF5, 0x9A,
+    0x8C, 0x4F, 0xA1, 0xD3, 0xB4, 0x0C, 0x33, 0xE0, 0x9F, 0x3E, 0xD2, 0x54, 0x4B, 0x0A, 0x55, 0x0A,
+    0x69, 0x8F, 0x4C, 0x92, 0xDA, 0xE1, 0xEC, 0x92, 0x8E, 0x3A, 0xE4, 0x54, 0x31, 0x2B, 0x3C, 0x2D,
+    0x76, 0xE8, 0xBE, 0x26, 0x68, 0xA6, 0xA1, 0xC7, 0x05, 0x3F, 0x99, 0x54, 0x5E, 0xAB, 0x9E, 0x17,
+    0x69, 0xA6, 0xE3, 0xB4, 0xE7, 0x7E, 0x4C, 0x6D, 0x4C, 0x6E, 0xE1, 0x1C, 0x63, 0x74, 0x1B, 0x0D,
+    0xA8, 0x2F, 0x68, 0x40, 0x9C, 0x63, 0x40, 0xD4, 0x59, 0x75, 0xCA, 0xBA, 0x8E, 0x69, 0x79, 0xB9,
+    0xD5, 0x3D, 0x85, 0xEC, 0x3E, 0xC5, 0x41, 0x37, 0x32, 0x4C, 0x6E, 0xC3, 0x6D, 0x99, 0x46, 0x34,
+    0xFA, 0x8D, 0x66, 0x29, 0xD5, 0x17, 0x62, 0x58, 0x8D, 0x28, 0x36, 0x2D, 0x43, 0x57, 0x7D, 0x3D,
+    0x7D, 0x12, 0x5E, 0x33, 0xDB, 0x5D, 0x38, 0x1D, 0x06, 0x7D, 0xEB, 0x91, 0x8D, 0x40, 0x0A, 0xF9,
+    0xD9, 0x55, 0x3F, 0x97, 0x92, 0xF6, 0xD4, 0x2E, 0xFD, 0x92, 0x5D, 0x6A, 0xDB, 0xB0, 0x1B, 0x33,
+    0xB9, 0x8D, 0xE6, 0x0F, 0x34, 0x16, 0x5B, 0xB3, 0xD1, 0xBD, 0xA7, 0xBE, 0x5A, 0x87, 0x05, 0xDD,
+    0xB9, 0x79, 0x81, 0xD0, 0x75, 0x63, 0xD4, 0x47, 0x1F, 0xB8, 0x4B, 0x79, 0xAE, 0xC3, 0x25, 0x1B,
+    0x4E, 0xAB, 0x96, 0xE9, 0x03, 0x5F, 0xF6, 0xAF, 0x7C, 0xA9, 0xAF, 0x9D, 0x2F, 0xBB, 0x6F, 0x9C,
+    0x2F, 0x9B, 0xEF, 0x9C, 0xCA, 0xD6, 0xED, 0x57, 0x9D, 0xBA, 0x17, 0x15, 0x7C, 0xD5, 0x5E, 0x7F,
+    0xF5, 0xD2, 0x5F, 0x5E, 0x5E, 0x75, 0x1C, 0x5F, 0x35, 0xB4, 0x16, 0x97, 0x97, 0xD9, 0x55, 0x9B,
+    0xEB, 0xF5, 0xCB, 0xF0, 0x0C, 0xA4, 0x68, 0x2F, 0x2F, 0x48, 0xDA, 0x95, 0x65, 0xBA, 0x75, 0x13,
+    0xF3, 0xE5, 0xE5, 0xD3, 0x47, 0x43, 0x4C, 0x92, 0x9C, 0x23, 0x0E, 0x0C, 0xC9, 0x8E, 0x69, 0xD0,
+    0xBF, 0x3E, 0xFB, 0x7D, 0x87, 0xEF, 0x9C, 0xCD, 0xBE, 0x43, 0x38, 0xB7, 0xC3, 0x10, 0xCE, 0x6C,
+    0xC5, 0x70, 0xB9, 0x9D, 0x61, 0xF9, 0xA0, 0x97, 0x97, 0x55, 0xFC, 0x5F, 0x1F, 0xA0, 0xEB, 0x2F,
+    0x99, 0x28, 0xDB, 0x3E, 0x17, 0x0B, 0x91, 0x8A, 0x63, 0x9F, 0x3D, 0xBC, 0xBD, 0xFA, 0xF0, 0x6D,
+    0x37, 0xBA, 0x38, 0x0F, 0xDF, 0x79, 0xC8, 0x99, 0x03, 0xB9, 0x3B, 0x48, 0x5F, 0xE2, 0xEE, 0x20,
+    0x7D, 0x17, 0xE8, 0xF4, 0x24, 0x8E, 0x1F, 0x29, 0xF6, 0xEB, 0xB2, 0x8D, 0x34, 0xA4, 0xE9, 0x1C,
+    0xC2, 0xE2, 0x22, 0x05, 0x6D, 0x96, 0xD7, 0xB5, 0xFA, 0xEB, 0xAE, 0xEB, 0x04, 0x0B, 0xBB, 0xF1,
+    0xD8, 0xD3, 0x19, 0xD3, 0xE7, 0x7E, 0xFC, 0x10, 0x48, 0xC8, 0x0E, 0x8F, 0xBE, 0x68, 0x29, 0xA8,
+    0x60, 0xC1, 0x5A, 0xC0, 0x2D, 0xE4, 0x5A, 0x68, 0xAC, 0xBC, 0xD6, 0x07, 0x4A, 0x6D, 0xF8, 0x99,
+    0x4A, 0x1B, 0xC3, 0x88, 0xD3, 0x86, 0x46, 0x6A, 0xED, 0x99, 0x7A, 0xBC, 0x8E, 0x5C, 0xE0, 0xBF,
+    0xA7, 0x42, 0xD0, 0xFD, 0xB5, 0xCA, 0x03, 0xF4, 0x57, 0xAA, 0x76, 0xD0, 0x5F, 0xE9, 0xD3, 0x1B,
+    0xB9, 0xBE, 0xA1, 0xFF, 0x63, 0xA5, 0xD0, 0xA4, 0x6F, 0x2F, 0x14, 0x1A, 0xA5, 0x40, 0xA5, 0xD1,
+    0x6A, 0x27, 0x7A, 0x9B, 0xF7, 0xD4, 0x0E, 0x1A, 0x69, 0x44, 0xA7, 0x1E, 0x2F, 0x3A, 0x2B, 0xF0,
+    0xF6, 0x82, 0xE1, 0x88, 0x7E, 0x69, 0xEA, 0x7A, 0x18, 0xB1, 0x76, 0x60, 0xF3, 0x3E, 0xAA, 0x90,
+    0x5C, 0xE4, 0xE2, 0x95, 0x35, 0x93, 0xEE, 0x4F, 0xAC, 0xDC, 0x68, 0x8D, 0xF9, 0x09, 0x2B, 0x90,
+    0x58, 0xCA, 0x15, 0x1F, 0x38, 0x70, 0x81, 0xAE, 0xAF, 0x56, 0x9A, 0xA9, 0xD8, 0x71, 0x0B, 0x6A,
+    0xCB, 0x8D, 0x61, 0xCC, 0x85, 0x0F, 0x68, 0xAC, 0x57, 0xBA, 0xB9, 0x3A, 0xF0, 0x4B, 0xA1, 0xD6,
+    0x6D, 0x99, 0xC6, 0x4A, 0x0C, 0xA1, 0x48, 0x9B, 0xE0, 0x47, 0x8F, 0x8E, 0xF9, 0xA3, 0x2F, 0x5E,
+    0xA5, 0x58, 0x52, 0x29, 0x85, 0xC9, 0x70, 0x4C, 0x5F, 0xC4, 0x1C, 0x4B, 0x8C, 0xB5, 0x52, 0x2B,
+    0xCD, 0x7C, 0x95, 0x64, 0xC9, 0x6E, 0x9E, 0xA5, 0x70, 0x1D, 0x6B, 0x50, 0x02, 0x5E, 0x5A, 0x8D,
+    0xC0, 0x1A, 0x8B, 0x15, 0x51, 0xAE, 0xF9, 0x41, 0xB5, 0x14, 0x3B, 0x6E, 0x29, 0x76, 0xEA, 0x50,
+    0x6D, 0x34, 0xC1, 0x6D, 0xF8, 0x50, 0xAF, 0x74, 0x73, 0xB3, 0xA2, 0xC9, 0x2F, 0x68, 0xEC, 0x42,
+    0xAE, 0xF1, 0x8A, 0xBA, 0xFE, 0x48, 0xC9, 0xB6, 0x61, 0x4B, 0xCE, 0xEF, 0xCB, 0xFC, 0x12, 0xFF,
+    0x22, 0x29, 0x18, 0xFA, 0x6A, 0x01, 0x8A, 0xA3, 0x8C, 0x55, 0xE1, 0xC7, 0xF5, 0xAE, 0x8A, 0x85,
+    0x30, 0x31, 0x36, 0xB2, 0x69, 0x4B, 0x1F, 0xFE, 0xE1, 0xA7, 0x93, 0xF5, 0x4E, 0x18, 0x68, 0x12,
+    0x2C, 0x82, 0x57, 0x6B, 0xD8, 0x99, 0x59, 0xC4, 0x4E, 0x63, 0x71, 0x90, 0xB8, 0x8F, 0x6C, 0x6A,
+    0x47, 0x64, 0x7F, 0x21, 0xCD, 0x4D, 0x38, 0xF9, 0x5F, 0xCA, 0x87, 0x6E, 0x3E, 0x05, 0xC0, 0xA9,
+    0x59, 0x34, 0x26, 0x09, 0xC0, 0xEF, 0xEE, 0x50, 0x9B, 0x44, 0x80, 0x61, 0x73, 0x96, 0x44, 0xEB,
+    0xA5, 0x89, 0x4C, 0x4B, 0x65, 0xE9, 0x2B, 0x3A, 0xF5, 0x14, 0x0A, 0xA5, 0x16, 0x92, 0x14, 0x54,
+    0x9A, 0x23, 0x36, 0x70, 0xF7, 0x8B, 0x7C, 0xAC, 0x07, 0x3F, 0xD6, 0x01, 0x32, 0x7D, 0x7A, 0x05,
+    0xAA, 0x34, 0x0F, 0xE8, 0x2A, 0x8C, 0x8E, 0x4A, 0xE5, 0xBF, 0xFB, 0xF0, 0x14, 0x71, 0x7F, 0x62,
+    0x18, 0xBA, 0x8E, 0xB3, 0xA3, 0x2B, 0xD6, 0xAA, 0x0D, 0x4B, 0xB9, 0x82, 0xDB, 0x6C, 0x5A, 0x93,
+    0x21, 0xBE, 0x33, 0x43, 0x8B, 0x6D, 0x3A, 0xFC, 0x14, 0xC7, 0x4F, 0x36, 0x01, 0x34, 0x46, 0xC0,
+    0xB7, 0x9B, 0xC9, 0xD5, 0xBB, 0x1D, 0xFC, 0x82, 0x81, 0x49, 0xCD, 0xC6, 0xB9, 0xFD, 0xDE, 0x48,
+    0x1D, 0x6D, 0xC5, 0xA9, 0x1C, 0x4F, 0xDB, 0xD4, 0x2C, 0x67, 0xBD, 0xF4, 0x73, 0xF6, 0xCE, 0x27,
+    0x13, 0x7F, 0xE7, 0x6F, 0x56, 0x81, 0x79, 0x7B, 0xB9, 0x9C, 0x2B, 0xBE, 0xB4, 0xB1, 0x9D, 0xEB,
+    0x26, 0x2D, 0x9D, 0x73, 0xF5, 0x24, 0x02, 0x90, 0x68, 0x60, 0x6A, 0x24, 0x0A, 0xA1, 0x51, 0x82,
+    0x93, 0x18, 0x24, 0x7A, 0x90, 0x48, 0x62, 0x90, 0x49, 0x84, 0x3C, 0x8C, 0x30, 0xB6, 0xCE, 0xB8,
+    0x6D, 0x2F, 0xFB, 0xE7, 0x3F, 0xA9, 0x72, 0xFA, 0x83, 0xBF, 0xA5, 0x72, 0x8A, 0xE9, 0xFA, 0xC1,
+    0x32, 0x95, 0xE6, 0x86, 0x19, 0x35, 0xAD, 0x32, 0x9F, 0x7C, 0xF8, 0xE6, 0x0B, 0x39, 0xF0, 0x77,
+    0xAE, 0x79, 0x0A, 0xAB, 0xD8, 0x6C, 0x29, 0xAC, 0x35, 0xEF, 0x00, 0xA7, 0x0D, 0xEE, 0xBE, 0xFB,
+    0xF0, 0x39, 0x7C, 0xFE, 0xF1, 0xD9, 0x8A, 0xD0, 0x1B, 0xD8, 0x60, 0xD5, 0x2F, 0xDF, 0xFA, 0xD2,
+    0x87, 0x94, 0xA1, 0x2C, 0x76, 0xAB, 0x9D, 0xB5, 0x1B, 0xA9, 0xDC, 0x23, 0x40, 0xA3, 0xFE, 0xC1,
+    0x01, 0xCD, 0x41, 0x1E, 0xC7, 0xBA, 0x7A, 0x6B, 0x29, 0xAC, 0xAC, 0x09, 0x34, 0xB7, 0x9A, 0x7D,
+    0xBA, 0x39, 0xD7, 0x08, 0xCD, 0x6A, 0xFD, 0x68, 0x7B, 0xEC, 0x20, 0x69, 0xEB, 0x15, 0xD0, 0x58,
+    0xED, 0x40, 0x17, 0x0A, 0x19, 0x32, 0x96, 0xC6, 0x08, 0x05, 0x70, 0x96, 0x75, 0xAC, 0xD5, 0x97,
+    0x7A, 0xF2, 0x8F, 0x07, 0x8D, 0x96, 0x80, 0xB3, 0x2A, 0xC2, 0x54, 0x84, 0x6E, 0xD9, 0xFD, 0xD8,
+    0x6B, 0x98, 0xAA, 0x3A, 0x16, 0xE0, 0xAE, 0x8E, 0xFE, 0x99, 0xC5, 0xB4, 0xBC, 0x36, 0x68, 0x8B,
+    0xA0, 0x8B, 0xB7, 0x2C, 0xDC, 0xD3, 0x57, 0xC3, 0x41, 0x3C, 0x58, 0x80, 0xCE, 0xD6, 0xAB, 0x91,
+    0x4A, 0x8F, 0x0F, 0x32, 0x8D, 0x4D, 0xC0, 0x87, 0x4C, 0x94, 0x1B, 0x2E, 0xA0, 0x3E, 0x13, 0x2E,
+    0x50, 0x87, 0x4C, 0xE4, 0x07, 0xCD, 0x8C, 0x9F, 0x8A, 0x83, 0x6A, 0xC3, 0x87, 0xDC, 0xAA, 0x0E,
+    0x83, 0x0D, 0x2E, 0xC8, 0xE2, 0x8C, 0x2A, 0x6B, 0xD8, 0x59, 0xB9, 0xF4, 0x69, 0x67, 0x2D, 0xF7,
+    0x2D, 0x94, 0x1A, 0xDA, 0x4B, 0x41, 0x51, 0xA3, 0x98, 0x33, 0x4F, 0x35, 0x07, 0xFD, 0x07, 0x95,
+    0x13, 0xFE, 0xFF, 0x88, 0x67, 0xAF, 0x93, 0xB5, 0xB1, 0xEA, 0x79, 0x88, 0x05, 0xC6, 0x2B, 0x78,
+    0x2B, 0x05, 0x3C, 0xDA, 0x97, 0xD1, 0xE1, 0x3F, 0x1D, 0xCF, 0xCE, 0xC8, 0xC6, 0x92, 0x0B, 0x0C,
+    0x23, 0x4D, 0x30, 0xB4, 0x44, 0x13, 0xB8, 0xC3, 0x76, 0xAB, 0x5F, 0x13, 0xBC, 0xFB, 0xB2, 0x4A,
+    0xC7, 0x64, 0xF1, 0xCD, 0xBF, 0x8E, 0x4C, 0x4B, 0x41, 0x66, 0xAE, 0xF5, 0xAE, 0x0D, 0xC1, 0xEA,
+    0x4F, 0xDC, 0xC0, 0x2F, 0xA4, 0xB1, 0x5C, 0x0C, 0xC1, 0x40, 0x65, 0x4D, 0xD8, 0x68, 0x38, 0x63,
+    0x5D, 0x9A, 0xCC, 0x15, 0xA7, 0x6F, 0x59, 0xE4, 0x1B, 0x53, 0xDC, 0x74, 0x21, 0xA2, 0x5D, 0xB3,
+    0x3D, 0x6B, 0x8A, 0x3D, 0x62, 0x63, 0x62, 0x60, 0x9A, 0xCF, 0x65, 0x25, 0x46, 0xB1, 0xD4, 0xF2,
+    0x6C, 0xE7, 0x89, 0x35, 0x75, 0xB1, 0x36, 0xCE, 0xAC, 0xC9, 0x10, 0x5B, 0xFE, 0x9E, 0xDF, 0x7A,
+    0x66, 0x1F, 0x16, 0xCA, 0xDD, 0xE6, 0x3E, 0xB6, 0xB9, 0x7A, 0x86, 0x99, 0x21, 0xD0, 0x6C, 0x34,
+    0xDB, 0x89, 0xBD, 0x3F, 0xDF, 0x00, 0xD5, 0x9E, 0x95, 0xA5, 0x91, 0x3A, 0xC3, 0x53, 0xCD, 0x50,
+    0x6F, 0x31, 0xFF, 0x57, 0x5B, 0xE7, 0x90, 0x4D, 0x8A, 0xAE, 0x03, 0x88, 0x4C, 0x50, 0x07, 0x9A,
+    0x99, 0xFC, 0xA0, 0xD8, 0xC1, 0xCF, 0x31, 0x4F, 0xDB, 0xAC, 0xA9, 0x06, 0x2C, 0x3F, 0xEB, 0xEA,
+    0xB6, 0xB3, 0x0C, 0xD4, 0x46, 0x89, 0x5C, 0x35, 0xEA, 0x5F, 0x4D, 0x65, 0x6E, 0xC6, 0xB3, 0x63,
+    0xCD, 0xCD, 0xBC, 0x0C, 0xBD, 0x2B, 0xA4, 0x87, 0xA9, 0xA4, 0xA4, 0x93, 0x66, 0x8A, 0xFD, 0xA6,
+    0x1B, 0x71, 0xC1, 0x72, 0x2F, 0xF9, 0x4E, 0xB1, 0xE3, 0x6C, 0x94, 0xEB, 0x48, 0x37, 0xDA, 0xFD,
+    0x35, 0x4B, 0x2C, 0x56, 0xEC, 0x52, 0x81, 0x76, 0x1F, 0xB1, 0xFE, 0xCE, 0x02, 0x83, 0xC5, 0x07,
+    0xDC, 0xC1, 0x30, 0xD1, 0x2D, 0xB9, 0xDA, 0x42, 0xA3, 0x3B, 0x70, 0xC2, 0xAF, 0x74, 0x5B, 0xAE,
+    0xB9, 0xD0, 0xEC, 0x34, 0x3A, 0xB5, 0x5E, 0x74, 0x5B, 0xA6, 0x2D, 0xBB, 0xB9, 0x77, 0xE7, 0x92,
+    0x0A, 0x7C, 0x37, 0xC6, 0x65, 0xBE, 0xB5, 0x94, 0x67, 0x33, 0x5E, 0x0D, 0x16, 0xF9, 0xEE, 0x40,
+    0x21, 0x8D, 0x99, 0x95, 0x76, 0x6D, 0xF8, 0xE3, 0x1F, 0x5B, 0x62, 0x76, 0x4F, 0x6D, 0xAE, 0x31,
+    0x63, 0x9B, 0x72, 0x81, 0xD5, 0xB3, 0x69, 0xBF, 0x6E, 0x83, 0x37, 0x86, 0xA8, 0x7C, 0x6E, 0x5A,
+    0x6C, 0xA6, 0x52, 0xB4, 0x95, 0x16, 0xDD, 0x9B, 0xE7, 0x1E, 0x8B, 0xBF, 0xFA, 0xE4, 0x0E, 0xE7,
+    0x57, 0x13, 0x9C, 0xDE, 0xFC, 0xD2, 0xAB, 0xF0, 0xBF, 0x27, 0xA9, 0x68, 0xD3, 0x7A, 0x74, 0xFC,
+    0x1F, 0xFF, 0xE2, 0x06, 0xA2, 0x5A, 0x28, 0x57, 0x9A, 0x09, 0x3F, 0x21, 0x10, 0xC5, 0x46, 0xB9,
+    0xD9, 0x56, 0xCE, 0xAD, 0x4A, 0x62, 0xA3, 0x4C, 0xEA, 0x7E, 0x8D, 0x4A, 0xB5, 0x8C, 0x7D, 0x31,
+    0x9F, 0x12, 0x68, 0xAE, 0x76, 0x4A, 0xB5, 0xCD, 0x82, 0xDF, 0xD0, 0x8C, 0x42, 0xA1, 0xBE, 0xD4,
+    0xD8, 0x1C, 0xF8, 0x03, 0x6D, 0x68, 0x29, 0x14, 0x4A, 0x8D, 0xB5, 0xC6, 0xD7, 0x6F, 0xB8, 0xB9,
+    0x89, 0x85, 0x5F, 0x4E, 0x3D, 0x85, 0x46, 0x0B, 0x3C, 0x14, 0x2C, 0xEB, 0xE0, 0x37, 0x03, 0xBE,
+    0x6B, 0x3D, 0xD3, 0x64, 0x69, 0xEE, 0xCE, 0x83, 0x11, 0x29, 0xD0, 0x69, 0xA3, 0x91, 0x70, 0xFA,
+    0x8D, 0xB6, 0x50, 0x84, 0x66, 0xD4, 0x5F, 0x75, 0x18, 0xC7, 0x34, 0xAC, 0xB5, 0x1F, 0x4F, 0x97,
+    0x6B, 0xD7, 0x82, 0xBB, 0x8F, 0xAF, 0xE3, 0xE7, 0xAE, 0x2F, 0x57, 0xC8, 0x8F, 0x72, 0x07, 0xDC,
+    0x11, 0x47, 0xB4, 0xF4, 0x97, 0x88, 0x28, 0xFA, 0x6D, 0x5F, 0x78, 0xB5, 0x9D, 0x97, 0xDE, 0x3F,
+    0xAB, 0x19, 0xB3, 0xD8, 0x4F, 0xF9, 0xC7, 0xBF, 0xB8, 0x41, 0xB1, 0xD1, 0x4C, 0x98, 0xE8, 0xE2,
+    0x96, 0x58, 0x13, 0x51, 0xD8, 0xF4, 0xA0, 0xA1, 0x8F, 0xD2, 0x1B, 0xF7, 0x54, 0x79, 0x56, 0xDC,
+    0xCE, 0xD7, 0x8D, 0x30, 0x33, 0x91, 0xD8, 0x85, 0xFA, 0x66, 0xC1, 0x64, 0x38, 0x8A, 0xAF, 0xD1,
+    0x9B, 0x5A, 0x0C, 0x2B, 0x26, 0xC6, 0xF8, 0x1D, 0x6D, 0x18, 0xC9, 0xB9, 0xB9, 0x9F, 0xDD, 0xDC,
+    0x07, 0x9A, 0x3E, 0x7B, 0x87, 0x72, 0xCB, 0x77, 0x18, 0xFE, 0xED, 0x1E, 0x5D, 0x1E, 0x74, 0xD6,
+    0x44, 0x18, 0xD4, 0xF0, 0x4C, 0x32, 0x4B, 0x9F, 0x09, 0xB1, 0x14, 0xB7, 0x8E, 0x85, 0x93, 0x23,
+    0x85, 0xDE, 0xBF, 0x97, 0x20, 0xD6, 0x29, 0x95, 0x50, 0xB8, 0x25, 0x01, 0x27, 0xC5, 0xA5, 0xA5,
+    0xD8, 0x90, 0xD2, 0x25, 0xA5, 0x20, 0x9D, 0x52, 0xA6, 0x35, 0xFB, 0xEA, 0x33, 0x60, 0xF5, 0xBB,
+    0x57, 0xD0, 0x87, 0x6F, 0x2F, 0x20, 0x87, 0xA5, 0xC2, 0xEA, 0xF9, 0x65, 0xC5, 0x5E, 0x7A, 0x98,
+    0x72, 0xC0, 0x4E, 0xB1, 0xD0, 0xEC, 0x00, 0xA7, 0xE9, 0x8D, 0x54, 0x26, 0x7A, 0xAB, 0x29, 0xCC,
+    0x32, 0x85, 0xB6, 0xB9, 0x4C, 0xD3, 0xC4, 0x1A, 0x65, 0x77, 0x76, 0x20, 0x4D, 0x17, 0x23, 0x32,
+    0xC4, 0xF3, 0xE6, 0x58, 0x06, 0xF8, 0x09, 0xF0, 0x3B, 0xFE, 0x09, 0x5D, 0x1C, 0x0F, 0xDA, 0x7A,
+    0xC5, 0xC9, 0x58, 0x71, 0x66, 0xF4, 0x01, 0x77, 0x87, 0x58, 0xC2, 0x57, 0x84, 0xB8, 0x96, 0x7C,
+    0x4B, 0xE0, 0xC6, 0xC1, 0xB3, 0xA3, 0x00, 0x1E, 0x1C, 0x0F, 0x8D, 0xA8, 0xC3, 0xB7, 0x76, 0x8A,
+    0x95, 0x8F, 0xD8, 0x89, 0x1D, 0x80, 0x1E, 0xC6, 0x3E, 0xEF, 0x34, 0xE3, 0x3D, 0xA5, 0x0D, 0xEA,
+    0x95, 0xDF, 0x46, 0xB3, 0x3B, 0x1E, 0x0B, 0x49, 0xAB, 0x93, 0xD4, 0xD7, 0xD2, 0xC2, 0xDD, 0x5B,
+    0xA5, 0xE5, 0xDB, 0x35, 0xF6, 0xE5, 0xD7, 0x2B, 0xF8, 0xA9, 0xF9, 0xBE, 0x35, 0x7F, 0x7F, 0xCA,
+    0xEE, 0x28, 0x3B, 0x5E, 0x9D, 0x00, 0xAE, 0x74, 0xB4, 0xC4, 0x49, 0x16, 0x31, 0x01, 0x5F, 0xA4,
+    0x9E, 0xE1, 0xF6, 0x7F, 0x3C, 0x51, 0xC7, 0x6A, 0xBF, 0x4A, 0x06, 0x67, 0x29, 0x6C, 0x99, 0x62,
+    0x60, 0xDE, 0x9E, 0xA5, 0xBF, 0x29, 0x87, 0xDF, 0xD8, 0x53, 0xAA, 0xF8, 0x6E, 0xD2, 0xA9, 0x7D,
+    0xCA, 0x38, 0x2E, 0xA0, 0x05, 0x77, 0xB4, 0x75, 0x1C, 0xD1, 0xBA, 0x9B, 0xE9, 0x9C, 0x53, 0xED,
+    0xEC, 0x60, 0x77, 0xF1, 0xC6, 0xA5, 0x41, 0x32, 0x41, 0x48, 0x86, 0x83, 0x9B, 0xEE, 0x6C, 0x6C,
+    0x53, 0x3E, 0x0E, 0xE0, 0x96, 0x7A, 0xB9, 0x8A, 0xCF, 0x2E, 0x46, 0xF2, 0x9B, 0xC4, 0x8E, 0xF7,
+    0xEA, 0x78, 0x3C, 0x81, 0xEF, 0xB3, 0x64, 0xAC, 0x4A, 0xCB, 0xCF, 0x3E, 0x21, 0x5D, 0x89, 0x26,
+    0x8E, 0x32, 0x09, 0x27, 0x3E, 0x99, 0xA9, 0xA7, 0x6A, 0xDD, 0x01, 0xFA, 0x56, 0xF4, 0xD1, 0x7A,
+    0xCE, 0x22, 0xE3, 0xD6, 0xF8, 0xFC, 0x62, 0xAA, 0x36, 0xA9, 0xF3, 0xDC, 0x94, 0xC0, 0x9A, 0x68,
+    0x6A, 0x49, 0xFB, 0x6A, 0xBF, 0x64, 0xC3, 0x23, 0x45, 0xAD, 0x36, 0xD9, 0x08, 0x5A, 0x9C, 0xA1,
+    0xF8, 0x72, 0xF6, 0x4B, 0x47, 0x72, 0xE6, 0xDA, 0x2F, 0xD4, 0xCC, 0x34, 0x47, 0x62, 0xEA, 0xFD,
+    0x2C, 0xCE, 0xE1, 0xD8, 0x31, 0xAF, 0x64, 0x90, 0xB4, 0xA7, 0x5E, 0xD3, 0x07, 0x3A, 0x1E, 0x42,
+    0xB6, 0x5C, 0xF5, 0xEB, 0x59, 0x32, 0xF8, 0x23, 0x9F, 0xBF, 0xE0, 0x47, 0x65, 0x9C, 0x48, 0xDB,
+    0x5E, 0xBB, 0xCC, 0x4F, 0x5B, 0x1A, 0x89, 0x5C, 0x5F, 0x5D, 0x70, 0x33, 0x2D, 0x5D, 0x32, 0xF7,
+    0xC5, 0xD1, 0xC6, 0x89, 0x0D, 0x95, 0xA5, 0x49, 0xB7, 0x14, 0xBF, 0x77, 0x73, 0x3E, 0x15, 0xEA,
+    0xFD, 0xD3, 0x61, 0x2B, 0x25, 0xCD, 0x3E, 0x0E, 0x26, 0x9B, 0x70, 0xFA, 0x12, 0xBC, 0x9D, 0xA4,
+    0xD7, 0x6F, 0xC0, 0xFF, 0x9E, 0x6A, 0xD2, 0xAC, 0x42, 0xED, 0xB6, 0x7F, 0x94, 0x3A, 0x49, 0xF4,
+    0x2B, 0x96, 0x2E, 0xB4, 0x89, 0x9A, 0x69, 0x3C, 0x4C, 0xB3, 0xDF, 0x02, 0x70, 0x3F, 0x04, 0x0C,
+    0xD4, 0xD8, 0x48, 0xC8, 0x41, 0xD7, 0x15, 0x28, 0xB1, 0x65, 0x4D, 0x7B, 0xF6, 0xC5, 0x93, 0x2E,
+    0x09, 0x88, 0x70, 0xB7, 0xA6, 0xD4, 0xC4, 0x0A, 0xE2, 0x68, 0x77, 0x63, 0xF9, 0xEB, 0x79, 0x9D,
+    0x34, 0xD8, 0x21, 0x8E, 0x8F, 0xB5, 0xD2, 0xCF, 0x84, 0x86, 0xD9, 0x22, 0x8B, 0x89, 0x42, 0x13,
+    0x85, 0x1E, 0x96, 0x69, 0x9E, 0x5E, 0xAC, 0x15, 0x5E, 0xCF, 0xE6, 0x81, 0xD8, 0xD8, 0xC0, 0xE7,
+    0xF4, 0xB4, 0x7D, 0xCE, 0xA0, 0x35, 0xB3, 0x9F, 0x52, 0xA7, 0x7C, 0x11, 0x8B, 0x1E, 0xE6, 0x0B,
+    0x53, 0x5F, 0x62, 0xCD, 0x1E, 0xC4, 0xC9, 0x0C, 0x21, 0xED, 0x03, 0x37, 0xD3, 0xA6, 0x0E, 0x2C,
+    0xFB, 0xDF, 0x36, 0x82, 0x0D, 0xE0, 0x30, 0xC5, 0x94, 0xB2, 0x12, 0x86, 0xD4, 0x77, 0x33, 0xFC,
+    0xB6, 0x95, 0xFB, 0x7C, 0x35, 0x36, 0x3E, 0xA4, 0x09, 0x34, 0xD6, 0x44, 0x95, 0x0D, 0x97, 0xDB,
+    0x35, 0x87, 0xB8, 0x91, 0xA4, 0xD5, 0x4B, 0x56, 0x2E, 0x27, 0x85, 0x18, 0xEB, 0x98, 0x7D, 0xE1,
+    0x2A, 0xA7, 0x97, 0xC5, 0x91, 0x69, 0xFD, 0x59, 0xFE, 0x11, 0x5B, 0xE7, 0x74, 0xA9, 0x00, 0x31,
+    0xE4, 0xC4, 0x8A, 0x4F, 0x0C, 0x32, 0x31, 0xDD, 0x67, 0x0C, 0xB3, 0xDC, 0x43, 0x9C, 0xE1, 0x36,
+    0x9F, 0x3E, 0x54, 0x71, 0x55, 0x58, 0xCD, 0xDB, 0x90, 0x36, 0x41, 0xB1, 0x5D, 0x2E, 0xFF, 0x5F,
+    0x3C, 0xB8, 0xEC, 0x01, 0x13, 0xA9, 0x73, 0x54, 0xE8, 0x2F, 0xC1, 0xDD, 0x58, 0xA0, 0x97, 0x89,
+    0x73, 0xDC, 0x49, 0x69, 0x65, 0xAE, 0x47, 0x2E, 0xA9, 0x7F, 0xA4, 0x47, 0x0F, 0xAD, 0x26, 0x2C,
+    0xD6, 0xF9, 0x95, 0x5B, 0xCC, 0x7A, 0x29, 0xE6, 0xAE, 0x9A, 0x27, 0x5F, 0xC4, 0x99, 0x03, 0x6B,
+    0x03, 0xE8, 0xBC, 0x02, 0x4D, 0x74, 0x98, 0x2B, 0x41, 0xFE, 0x59, 0x03, 0x21, 0x2D, 0xA3, 0x3F,
+    0xC7, 0x52, 0xC3, 0xEC, 0x3E, 0x0C, 0x7D, 0x1D, 0xC0, 0x07, 0x33, 0x66, 0x3B, 0x69, 0x38, 0x6A,
+    0xAC, 0x5B, 0x37, 0xB1, 0x7C, 0xFB, 0xE5, 0x02, 0xFF, 0x43, 0xCA, 0x89, 0xD3, 0x2F, 0xB1, 0xD4,
+    0x87, 0x2E, 0x2C, 0x69, 0x66, 0xF8, 0x47, 0x08, 0xEA, 0xB9, 0xDC, 0x40, 0xAD, 0x9F, 0x63, 0xE2,
+    0xC6, 0xD2, 0x36, 0x17, 0xA4, 0xD2, 0xA5, 0x8A, 0xF5, 0x99, 0xFC, 0xAB, 0xC7, 0xA3, 0x36, 0x0D,
+    0xD0, 0x33, 0xEB, 0xBE, 0x5D, 0x92, 0x34, 0xC3, 0x73, 0x07, 0xFE, 0x5D, 0x8F, 0x81, 0x44, 0xD1,
+    0x5B, 0xEA, 0x22, 0xFC, 0x33, 0xFE, 0x9D, 0x50, 0xEC, 0xCE, 0x67, 0xF4, 0x56, 0x9A, 0x32, 0xD9,
+    0xA4, 0xE9, 0x52, 0xC7, 0x87, 0xA5, 0x58, 0x78, 0x19, 0xC5, 0x7E, 0x10, 0x59, 0x8C, 0x37, 0xBF,
+    0xD7, 0x92, 0xEE, 0xFC, 0xE2, 0x71, 0xD3, 0xBE, 0x5A, 0x16, 0xAF, 0x3D, 0xB6, 0xD2, 0x56, 0xF3,
+    0x73, 0x13, 0x50, 0xEA, 0xF7, 0x47, 0xA0, 0xFA, 0x5D, 0x6B, 0x54, 0x79, 0xCF, 0x64, 0xE0, 0x6B,
+    0x1B, 0x3F, 0xC0, 0xA3, 0x34, 0xC7, 0xB5, 0x52, 0x4F, 0xB7, 0xE1, 0xD4, 0x32, 0x6C, 0x06, 0xBC,
+    0x2F, 0xF6, 0x14, 0xA8, 0xAD, 0xC8, 0xBB, 0xB1, 0x1F, 0x42, 0xF0, 0x9B, 0xCD, 0xBF, 0xB0, 0x22,
+    0xBE, 0x6E, 0xA1, 0xB0, 0xE8, 0xFE, 0x52, 0x4C, 0x8E, 0x26, 0xDC, 0x61, 0xA5, 0x7E, 0xBB, 0x01,
+    0x36, 0x1B, 0x85, 0x7A, 0xFB, 0x4C, 0x1B, 0x3F, 0x93, 0x29, 0x50, 0xEA, 0xE9, 0xE3, 0xD4, 0x13,
+    0x32, 0xD9, 0x93, 0x85, 0x39, 0x71, 0x48, 0x4F, 0x1C, 0x55, 0xB3, 0x5A, 0x1D, 0xE2, 0xC3, 0x17,
+    0x84, 0xD9, 0xF3, 0x4F, 0x43, 0xBD, 0x7E, 0x1E, 0xFC, 0xF6, 0x36, 0x7C, 0xBE, 0xDB, 0xE2, 0x10,
+    0xCF, 0xB7, 0xDD, 0xF4, 0x72, 0xA0, 0x69, 0xA7, 0xD8, 0xF2, 0x8D, 0x72, 0x2B, 0x36, 0xDC, 0x5A,
+    0x6C, 0xB8, 0xA5, 0x58, 0xA9, 0x43, 0xB9, 0xD0, 0x84, 0x2A, 0xE0, 0x67, 0x17, 0xE8, 0x26, 0x17,
+    0x18, 0x46, 0x37, 0xA3, 0xB1, 0x9E, 0x73, 0xF5, 0x4D, 0xA8, 0xD4, 0x36, 0x92, 0xFD, 0x67, 0x58,
+    0x87, 0x4D, 0xAD, 0x92, 0xF6, 0x67, 0xA7, 0x6B, 0xBF, 0x36, 0xA4, 0x89, 0x2F, 0xF1, 0xE6, 0x2D,
+    0x5A, 0xFF, 0xD6, 0x6F, 0xFD, 0xE0, 0x78, 0xF8, 0x8F, 0x36, 0x87, 0x78, 0xFD, 0xCD, 0x08, 0x0A,
+    0x58, 0x47, 0xD4, 0x20, 0x6D, 0xBC, 0xF6, 0xE5, 0x57, 0xF7, 0x97, 0x67, 0x3B, 0xC5, 0x46, 0x33,
+    0xD2, 0x8D, 0xF6, 0xA3, 0x32, 0x7E, 0x44, 0xAD, 0xFD, 0xA6, 0x4C, 0xD7, 0xE6, 0xA2, 0x0A, 0xF8,
+    0x19, 0x51, 0xEE, 0xB8, 0x60, 0x1D, 0x15, 0x6E, 0xA3, 0x9E, 0x73, 0xF5, 0xB9, 0x18, 0x16, 0x1B,
+    0x31, 0x92, 0x9F, 0xDD, 0xDC, 0xD1, 0x8B, 0x30, 0x17, 0x20, 0xD5, 0x6D, 0x66, 0xF7, 0xB8, 0xCF,
+    0x39, 0x86, 0xE1, 0x52, 0xDA, 0xBA, 0x5C, 0xE1, 0x96, 0x71, 0x10, 0x43, 0xD6, 0xFE, 0x3D, 0x60,
+    0xD5, 0x9B, 0xBC, 0xF6, 0x90, 0xEA, 0xC9, 0x67, 0xF6, 0x0B, 0x6A, 0x19, 0xD2, 0x44, 0xC8, 0x07,
+    0x4F, 0xFE, 0xB3, 0xB2, 0x2A, 0xD5, 0xD6, 0xC6, 0x12, 0xD4, 0xCE, 0x4C, 0xEA, 0xDB, 0xB1, 0x69,
+    0x6D, 0xBD, 0x2E, 0x6F, 0x68, 0x46, 0xFE, 0xDE, 0xED, 0xB1, 0x1F, 0x4B, 0x86, 0xB5, 0xD0, 0x08,
+    0xE5, 0x5F, 0x8E, 0x50, 0xFD, 0xE9, 0x18, 0xD3, 0xD0, 0xA5, 0x80, 0x6C, 0xE5, 0x3F, 0xAB, 0x3E,
+    0xBC, 0x20, 0xCD, 0xD3, 0x89, 0x34, 0x0F, 0x3F, 0x08, 0xD2, 0xFC, 0x42, 0x7E, 0x25, 0x86, 0x25,
+    0x8E, 0x25, 0x96, 0x25, 0x9E, 0x25, 0xA6, 0x25, 0xAE, 0x25, 0xB6, 0x25, 0xBE, 0x25, 0xC6, 0x25,
+    0xCE, 0x25, 0xD6, 0x45, 0xDE, 0x25, 0xE6, 0x25, 0xEE, 0x25, 0xF6, 0x25, 0xFE, 0x25, 0x06, 0x26,
+    0x0E, 0x26, 0x16, 0x26, 0x1E, 0x26, 0x26, 0x26, 0x2E, 0x9E, 0x6C, 0x7C, 0x19, 0x1F, 0xC9, 0x04,
+    0xDD, 0x48, 0x37, 0x51, 0x2F, 0x34, 0x2B, 0xD5, 0x41, 0x25, 0x72, 0x8D, 0xB9, 0x46, 0x86, 0xC0,
+    0x47, 0x22, 0xAF, 0x5F, 0xE0, 0x49, 0x4E, 0xF8, 0x91, 0x7C, 0xA3, 0xDC, 0xC0, 0x8F, 0xA8, 0x8F,
+    0xBF, 0xC4, 0x85, 0xEF, 0x33, 0x41, 0xB9, 0xC4, 0x82, 0xF7, 0xE2, 0xB0, 0xB1, 0x4E, 0x13, 0xC8,
+    0xB2, 0xEC, 0x33, 0x1A, 0xC9, 0x0E, 0x9A, 0x15, 0x9A, 0x50, 0xD9, 0x5C, 0xF9, 0x14, 0xEA, 0x9C,
+    0xE9, 0x37, 0x77, 0x3D, 0xA5, 0x2D, 0x71, 0xF7, 0x47, 0x6D, 0xDF, 0xC4, 0xF2, 0x20, 0x77, 0x4B,
+    0x55, 0xC4, 0x00, 0x30, 0x86, 0xAB, 0xD5, 0xE5, 0x87, 0xDC, 0x3E, 0x68, 0x67, 0x2C, 0xF8, 0xB9,
+    0xBA, 0xEC, 0x8C, 0x80, 0xC6, 0x7A, 0xCE, 0xD4, 0xD7, 0xA1, 0x50, 0xDB, 0x3C, 0x79, 0x10, 0x77,
+    0x46, 0x73, 0xEE, 0x0C, 0x67, 0x3B, 0xE3, 0xDB, 0x63, 0x42, 0xDA, 0x8E, 0xE4, 0x69, 0x97, 0x4F,
+    0xDB, 0x08, 0xD2, 0x19, 0xCE, 0xDC, 0xBD, 0xC0, 0xE0, 0x24, 0xBF, 0x2E, 0xD5, 0x36, 0x9D, 0x05,
+    0x68, 0x69, 0x60, 0x5B, 0xF3, 0xBD, 0x18, 0xCA, 0x6E, 0x69, 0x34, 0xC0, 0x33, 0x85, 0xC4, 0xCF,
+    0xC1, 0xA7, 0x06, 0xB5, 0x1E, 0x75, 0x1C, 0xE4, 0xF4, 0xB5, 0x38, 0x27, 0x62, 0xAD, 0xE3, 0xAF,
+    0x04, 0xA5, 0xE8, 0x75, 0xB6, 0x03, 0xCD, 0x96, 0x5C, 0xDF, 0xBE, 0xD9, 0x71, 0x0B, 0x43, 0xC8,
+    0x35, 0x15, 0x6A, 0xDD, 0x41, 0xB3, 0x33, 0xAC, 0xB9, 0xC6, 0x42, 0x53, 0xAD, 0xD1, 0xAF, 0xF8,
+    0xBD, 0xD4, 0x56, 0x89, 0x42, 0x93, 0x34, 0x6A, 0xC6, 0x6F, 0x5E, 0x7B, 0xB3, 0x51, 0xE8, 0xF7,
+    0xA4, 0x3F, 0x57, 0x8F, 0x3F, 0x24, 0x0D, 0x81, 0x42, 0xDA, 0xD3, 0x28, 0xA1, 0x5F, 0x37, 0xAC,
+    0x53, 0x61, 0xB0, 0xE9, 0x1D, 0x7B, 0x15, 0x11, 0xDA, 0x71, 0xB0, 0xE4, 0x44, 0x28, 0x6D, 0x8C,
+    0xD0, 0x6E, 0xE5, 0x26, 0x9D, 0xC6, 0x52, 0xC1, 0x70, 0x21, 0x7F, 0xAD, 0x41, 0xDC, 0x78, 0x29,
+    0x2A, 0x4B, 0xAE, 0xBA, 0x0D, 0x72, 0xEC, 0xE6, 0x73, 0xBC, 0xC3, 0xAB, 0x09, 0xD4, 0x8D, 0x90,
+    0xCB, 0xEA, 0x39, 0x7E, 0x6E, 0xB3, 0x0A, 0xC3, 0xF6, 0x75, 0xBA, 0xA9, 0x9B, 0x9A, 0xD1, 0xCF,
+    0xF5, 0xD2, 0x2C, 0x4D, 0x28, 0xF7, 0xFA, 0x70, 0x6B, 0xA6, 0xCF, 0xEA, 0xF7, 0x37, 0xBA, 0x6F,
+    0xEB, 0xFB, 0x87, 0xC5, 0x28, 0xB1, 0xD3, 0x39, 0xFE, 0x7C, 0x4F, 0x17, 0x9B, 0xDE, 0xFF, 0x54,
+    0x81, 0x52, 0x7F, 0xA6, 0x85, 0x4C, 0xA1, 0xDB, 0xA0, 0x0B, 0x6E, 0x87, 0xD7, 0xBE, 0x98, 0x3F,
+    0xBA, 0xE0, 0xDD, 0x26, 0xA5, 0x06, 0x45, 0xA5, 0x76, 0x7D, 0x60, 0xF8, 0x9A, 0xDA, 0xD8, 0x38,
+    0x72, 0xA7, 0x3D, 0xE7, 0xD8, 0xBF, 0x8C, 0xB5, 0xE3, 0x0F, 0xD9, 0x2F, 0x58, 0xDC, 0xC6, 0x9C,
+    0x23, 0x48, 0x3C, 0x43, 0xAC, 0x0D, 0xB5, 0xA1, 0xA2, 0x36, 0x53, 0x74, 0xF8, 0xE0, 0x91, 0xA2,
+    0x67, 0x66, 0xEE, 0x87, 0x71, 0x66, 0xB9, 0x9F, 0xFD, 0x4C, 0xA6, 0x9F, 0x55, 0x8B, 0xDB, 0xAD,
+    0xFF, 0xB9, 0x0B, 0xE4, 0x7A, 0x4F, 0x23, 0x4E, 0x4E, 0xF0, 0xFA, 0xFD, 0xD7, 0x3F, 0xF4, 0xE8,
+    0x15, 0x9B, 0x1C, 0xF8, 0xE9, 0x1D, 0x9A, 0xB5, 0x59, 0xC9, 0x34, 0x76, 0x21, 0x15, 0x0A, 0xC7,
+    0xBD, 0xE7, 0x0E, 0xCB, 0x48, 0x96, 0x6A, 0x19, 0x82, 0x5F, 0xC9, 0xF4, 0x47, 0x1A, 0x29, 0xF4,
+    0x78, 0x8B, 0xBF, 0xE1, 0x41, 0x13, 0xB5, 0x77, 0x80, 0x2C, 0x26, 0x0D, 0x97, 0x93, 0x45, 0xDE,
+    0x90, 0x2A, 0xC3, 0x57, 0xFB, 0x54, 0x35, 0x92, 0x0E, 0x8C, 0x89, 0x34, 0x99, 0x9E, 0xDB, 0x2C,
+    0x71, 0x4A, 0x50, 0x11, 0x55, 0x52, 0xDC, 0x80, 0x51, 0xB1, 0x96, 0xCB, 0xAD, 0x02, 0xCF, 0x67,
+    0x2C, 0xB8, 0x52, 0xA6, 0xF0, 0x7A, 0x34, 0x47, 0x9C, 0xF7, 0x9C, 0xC7, 0x68, 0xFE, 0x27, 0x1E,
+    0x3D, 0x3E, 0x7F, 0xEA, 0x2B, 0x96, 0xBE, 0xF6, 0x9C, 0x7D, 0x29, 0xD4, 0x66, 0x4D, 0x4B, 0x45,
+    0xFD, 0x15, 0x93, 0x0E, 0x69, 0x7A, 0xF8, 0xC2, 0xD9, 0xBC, 0x42, 0xA5, 0xF4, 0xC3, 0xAD, 0xE3,
+    0x55, 0x37, 0x56, 0xA7, 0xFD, 0xE6, 0x86, 0x34, 0x79, 0x31, 0xB6, 0x3F, 0xA7, 0x81, 0x11, 0x85,
+    0x2E, 0xF3, 0xE8, 0x14, 0x2C, 0x6D, 0x7C, 0xBD, 0x14, 0xDF, 0x02, 0x4D, 0x7F, 0xD6, 0x50, 0xCE,
+    0xC9, 0xB2, 0xBC, 0x54, 0xA7, 0x54, 0x69, 0x04, 0x41, 0x1C, 0x75, 0xF5, 0xB1, 0x47, 0xE7, 0x90,
+    0xA6, 0xCC, 0xA6, 0x73, 0x4C, 0xC9, 0x87, 0x3B, 0x4B, 0xF1, 0x2A, 0x1B, 0x95, 0xD8, 0x42, 0xAD,
+    0x9B, 0xFB, 0x36, 0x5D, 0xA6, 0x92, 0x34, 0x15, 0x92, 0xD6, 0xFC, 0xBC, 0xA7, 0x5C, 0x49, 0xF8,
+    0x5E, 0xD4, 0x39, 0x96, 0xB0, 0xD8, 0x88, 0x56, 0xBC, 0x48, 0xFA, 0x7E, 0xB4, 0x39, 0xF2, 0xC2,
+    0x79, 0x66, 0x67, 0x07, 0xCF, 0x4B, 0xE7, 0x99, 0xFD, 0x7F, 0xC8, 0x91, 0x37, 0x7A, 0xDE, 0x34,
+    0x97, 0xAE, 0x1B, 0x81, 0x72, 0x33, 0xCE, 0x34, 0x69, 0x26, 0xD3, 0x2D, 0xE8, 0x3A, 0x55, 0x17,
+    0x67, 0x5F, 0x7C, 0x95, 0xD3, 0xFB, 0xA3, 0xCB, 0xA0, 0xD7, 0x1E, 0xF2, 0xB1, 0x96, 0xFC, 0x30,
+    0x58, 0xEC, 0x1B, 0xD1, 0x29, 0x06, 0xE2, 0xDC, 0xE9, 0xE8, 0x75, 0x99, 0xD0, 0x7E, 0xEC, 0x43,
+    0x68, 0xC5, 0x21, 0x4D, 0xB5, 0x38, 0x67, 0x62, 0xE5, 0x8F, 0x1E, 0x5F, 0x81, 0xA0, 0xD1, 0x61,
+    0xD9, 0x2F, 0x1A, 0xDD, 0x86, 0xF8, 0x9A, 0xA6, 0xB6, 0x4A, 0xF7, 0x38, 0xE1, 0xE3, 0xBB, 0x37,
+    0x6D, 0x9C, 0xD0, 0x11, 0x2B, 0x41, 0x6C, 0x32, 0xEF, 0xD9, 0xDC, 0x53, 0x3F, 0xB1, 0xD1, 0x50,
+    0x8D, 0x02, 0xB5, 0x36, 0x9C, 0x7E, 0x16, 0xCB, 0x7F, 0x73, 0x7B, 0xC2, 0x76, 0x75, 0x36, 0x8B,
+    0xF3, 0x7C, 0xB3, 0xF8, 0xED, 0x36, 0xE4, 0xD5, 0x60, 0x5A, 0xBB, 0xCC, 0x08, 0x7E, 0xA6, 0x9B,
+    0x19, 0x66, 0x34, 0x73, 0xFE, 0x32, 0xE1, 0xAD, 0x5F, 0xDA, 0xF5, 0x51, 0xBB, 0x54, 0xB2, 0xB9,
+    0x5E, 0x85, 0xD4, 0x17, 0x47, 0xB5, 0xE5, 0x3B, 0x7E, 0xBC, 0x0F, 0xF7, 0xF2, 0xF9, 0x13, 0xF5,
+    0xFA, 0x33, 0x7E, 0x7F, 0xE7, 0x0B, 0xDD, 0xF6, 0x4E, 0xB3, 0xBC, 0xED, 0xE2, 0x65, 0x7E, 0x3C,
+    0x1F, 0x74, 0x38, 0xE9, 0x68, 0x24, 0xF9, 0xE3, 0xD1, 0x97, 0xE1, 0xCE, 0xCD, 0x23, 0x24, 0x69,
+    0x92, 0xA4, 0x55, 0x3A, 0xA7, 0xCA, 0xDE, 0x69, 0xB9, 0x37, 0xB4, 0xCD, 0x9F, 0x49, 0x2A, 0x2D,
+    0xC5, 0xD9, 0x57, 0x9A, 0xE1, 0x1E, 0x94, 0x9B, 0xDB, 0xDC, 0xD6, 0x6C, 0x7E, 0x1D, 0xD6, 0x9B,
+    0x7B, 0xC5, 0x5A, 0xCF, 0xC3, 0xAF, 0x1E, 0x6E, 0xF1, 0x7F, 0xA8, 0x9F, 0xDF, 0x7D, 0xD0, 0xD7,
+    0x1F, 0xBD, 0xF1, 0x5B, 0x75, 0x3F, 0xF4, 0xFF, 0x20, 0x5B, 0x9A, 0x7E, 0x01, 0x68, 0xAB, 0xB5,
+    0xD9, 0xFC, 0x27, 0x3E, 0xFF, 0x4E, 0xB7, 0xF9, 0xC5, 0x4D, 0xB8, 0x95, 0xE2, 0x88, 0xDD, 0xD1,
+    0x1A, 0xF1, 0xA1, 0x50, 0x9B, 0x69, 0xAA, 0xF7, 0x34, 0x59, 0x08, 0x7C, 0x9F, 0xEF, 0x75, 0xA8,
+    0x43, 0xB5, 0xAB, 0x2F, 0xB4, 0x5B, 0x0C, 0x37, 0x8C, 0xB6, 0xF8, 0x1F, 0x4B, 0xAD, 0xD5, 0x36,
+    0x02, 0xA3, 0x94, 0x0D, 0x0F, 0x19, 0xE9, 0x42, 0xAC, 0xC7, 0x49, 0x4D, 0x57, 0xA5, 0x46, 0xB4,
+    0x50, 0x1F, 0x14, 0x16, 0x6B, 0x54, 0x6A, 0x51, 0xA0, 0xB1, 0x03, 0xC3, 0x6E, 0xF5, 0x11, 0xC8,
+    0xBC, 0xD7, 0xDE, 0x29, 0xFE, 0xE4, 0xC3, 0xB0, 0xE0, 0x45, 0x75, 0xEB, 0xE3, 0xDD, 0x9A, 0x22,
+    0x99, 0x66, 0x8F, 0xFA, 0x73, 0xCB, 0xB6, 0x6E, 0x1D, 0x16, 0x85, 0x32, 0x18, 0x91, 0xDD, 0x58,
+    0x2C, 0x0C, 0x4B, 0x7D, 0x14, 0x1A, 0x0F, 0xB3, 0x06, 0xFE, 0xD1, 0xFD, 0x52, 0xDA, 0x06, 0xE9,
+    0x77, 0x1E, 0x3D, 0x5E, 0x61, 0x68, 0x71, 0x01, 0x43, 0xCE, 0x01, 0x68, 0x8B, 0x50, 0x8F, 0xEF,
+    0x96, 0xDF, 0xD5, 0xEF, 0x6D, 0xF5, 0xF8, 0x53, 0x40, 0x39, 0x0E, 0xE5, 0xDA, 0x30, 0x64, 0x5B,
+    0x6E, 0xD6, 0x74, 0xC5, 0xA3, 0xD1, 0xEF, 0x4E, 0xD3, 0x83, 0x85, 0x9F, 0x04, 0xFE, 0x19, 0xDD,
+    0xFB, 0x9D, 0x1A, 0x95, 0x2A, 0xE7, 0x62, 0x06, 0xDA, 0x8A, 0x9F, 0xAE, 0x8F, 0xCF, 0x3C, 0xFC,
+    0x47, 0x3C, 0x04, 0xB8, 0xC3, 0x83, 0xEB, 0xF9, 0x07, 0x7A, 0xF4, 0x65, 0xB8, 0x29, 0x8E, 0xF2,
+    0x70, 0x7B, 0xBD, 0xFB, 0xCD, 0x6F, 0xD5, 0xD2, 0x4C, 0xFA, 0xD4, 0x5E, 0x87, 0xEE, 0x3D, 0xB9,
+    0xAD, 0xFB, 0x8E, 0x7E, 0xE7, 0xD1, 0x1B, 0x5F, 0x7A, 0x8E, 0x53, 0x8D, 0x5A, 0xA7, 0xB1, 0xD0,
+    0x94, 0x69, 0x66, 0x08, 0x74, 0x2B, 0x7E, 0xA3, 0xD9, 0x71, 0x32, 0xBD, 0xF7, 0xC2, 0xDF, 0x37,
+    0xFE, 0x6F, 0xDB, 0x66, 0xF6, 0xC1, 0x87, 0x3A, 0xB8, 0x50, 0x28, 0x68, 0xAB, 0xC5, 0x83, 0xFE,
+    0xFF, 0x05, 0xCD, 0xBD, 0x4F, 0xAC, 0x26, 0xD7, 0x99, 0xDE, 0xF7, 0xAB, 0x3A, 0xEA, 0x2E, 0x8B,
+    0x65, 0xCF, 0xD1, 0x42, 0x14, 0x6C, 0x36, 0x3C, 0xE5, 0x85, 0x11, 0x4C, 0xE8, 0xB1, 0x2A, 0x0B,
+    0x2F, 0x26, 0x09, 0xC9, 0x53, 0x22, 0x13, 0x73, 0xA1, 0x85, 0x3A, 0x40, 0xDF, 0x91, 0x63, 0x05,
+    0x11, 0x10, 0x78, 0x91, 0xF4, 0x0C, 0xA6, 0x81, 0xC0, 0x0B, 0x2F, 0x28, 0x55, 0x51, 0x5C, 0x08,
+    0x88, 0x16, 0xD3, 0x70, 0x86, 0x1E, 0x20, 0x59, 0x88, 0x06, 0x68, 0x84, 0x6C, 0x05, 0x69, 0x2F,
+    0x8C, 0x64, 0x30, 0x20, 0x59, 0x87, 0xE4, 0x62, 0x16, 0x42, 0xA0, 0x92, 0x14, 0x79, 0x16, 0xB3,
+    0x50, 0x49, 0xC3, 0xB1, 0x2C, 0x0D, 0x10, 0x1E, 0x4A, 0x45, 0xA9, 0xBA, 0xFB, 0x54, 0x3D, 0x59,
+    0x9C, 0x53, 0xDF, 0xBD, 0xDD, 0xA4, 0x24, 0x2A, 0x9A, 0x49, 0xE6, 0x2E, 0xEE, 0x77, 0xEF, 0xF7,
+    0xA7, 0xBE, 0xAA, 0x73, 0xDE, 0xBF, 0xCF, 0xFB, 0xBC, 0x6F, 0x15, 0x32, 0xBB, 0xD9, 0xAA, 0x68,
+    0x57, 0xBB, 0xB4, 0xC1, 0x05, 0x37, 0x5F, 0xBF, 0xF9, 0xD0, 0xAD, 0x5B, 0xCF, 0x4A, 0xAB, 0x93,
+    0x9E, 0x92, 0x42, 0xEF, 0x55, 0x2F, 0xCD, 0x2C, 0xB3, 0xE1, 0x26, 0xDC, 0xD4, 0xCF, 0x75, 0x64,
+    0xFC, 0xAE, 0x3C, 0xA3, 0x56, 0x90, 0x3A, 0x0A, 0x05, 0x28, 0x05, 0x54, 0x81, 0xFC, 0xD3, 0x0E,
+    0x60, 0x76, 0xA0, 0x5F, 0xC0, 0x6A, 0xC6, 0x48, 0x9E, 0xF1, 0x7B, 0xEA, 0x9A, 0xB5, 0xDA, 0xCD,
+    0x46, 0xBD, 0x02, 0x50, 0xAE, 0xD6, 0x6B, 0x8E, 0xAD, 0xEC, 0x9B, 0xF7, 0xEE, 0xAD, 0x7D, 0xA3,
+    0x3A, 0x68, 0x7E, 0xC2, 0xA4, 0x17, 0x29, 0xAE, 0xB6, 0xD2, 0xEB, 0x92, 0xAC, 0x14, 0xF3, 0x91,
+    0x3F, 0x5A, 0x8E, 0xDA, 0x2A, 0x69, 0xB3, 0xD2, 0xE6, 0xF6, 0x5B, 0x2F, 0x96, 0xAB, 0x1D, 0x34,
+    0xC5, 0x56, 0xF6, 0xCD, 0x9F, 0xDC, 0x5B, 0xC7, 0x46, 0x76, 0xD6, 0xFC, 0x79, 0xB3, 0x00, 0x3C,
+    0x7C, 0x76, 0x76, 0x66, 0x25, 0xBD, 0x29, 0xE9, 0x3B, 0x92, 0x16, 0xCC, 0x6C, 0x97, 0x36, 0xD8,
+    0xE9, 0xC6, 0x17, 0xF6, 0x2A, 0x34, 0xC0, 0x23, 0x37, 0x1F, 0xB9, 0xE9, 0x82, 0x0B, 0x4D, 0x68,
+    0x82, 0x5D, 0xEC, 0x62, 0xA5, 0xB5, 0x96, 0x62, 0x25, 0x45, 0x23, 0x6D, 0x00, 0x46, 0x9A, 0x9D,
+    0xB6, 0x5A, 0xF2, 0x7B, 0x19, 0xED, 0xE4, 0x9E, 0x8D, 0x66, 0x69, 0x25, 0x23, 0x05, 0xA7, 0xBD,
+    0x38, 0x3B, 0xEB, 0x8A, 0xFD, 0x15, 0x24, 0xFF, 0x87, 0x0A, 0x8F, 0xBB, 0x67, 0x9A, 0xE6, 0xE3,
+    0xF6, 0x4B, 0xBF, 0xFB, 0xD4, 0x9B, 0xDF, 0xF4, 0x00, 0x61, 0x36, 0xFF, 0x37, 0xD5, 0x4C, 0xDB,
+    0x95, 0xE2, 0xE3, 0x8F, 0x17, 0x37, 0xFF, 0x09, 0xE5, 0xFC, 0x78, 0xB3, 0x3E, 0xE1, 0xB6, 0x57,
+    0x3F, 0xDF, 0xC7, 0x57, 0xDB, 0xE5, 0x15, 0x3B, 0x03, 0xF0, 0xCF, 0x8A, 0x58, 0xAF, 0xCD, 0x77,
+    0xF4, 0xF4, 0xF2, 0xF0, 0xB1, 0x90, 0xD6, 0x83, 0x9D, 0xA0, 0x0E, 0x69, 0x79, 0xCD, 0x0A, 0xE6,
+    0x58, 0x8B, 0x9F, 0xF7, 0x63, 0xD6, 0x66, 0x2E, 0xF7, 0x7A, 0x45, 0x4F, 0x6D, 0x8C, 0xDF, 0x50,
+    0xE7, 0x82, 0xFC, 0x43, 0x2F, 0x5D, 0x7F, 0x81, 0x87, 0x6E, 0xDD, 0x1A, 0xA4, 0xD8, 0x48, 0x6F,
+    0x48, 0xAB, 0xF3, 0x7A, 0x2A, 0xDA, 0xD0, 0x3F, 0xBB, 0xC3, 0xC3, 0xD7, 0x47, 0x6F, 0xA5, 0x58,
+    0x4A, 0x9A, 0x7A, 0x69, 0xBB, 0x74, 0xF5, 0xFC, 0x80, 0xD7, 0xB8, 0x21, 0x4D, 0x56, 0xDA, 0x8C,
+    0xA4, 0xB9, 0xBF, 0x7B, 0xEB, 0x79, 0x8A, 0x17, 0x2F, 0xBF, 0x60, 0x83, 0xF3, 0x7D, 0xB7, 0x9B,
+    0x58, 0x2F, 0x36, 0x38, 0xDF, 0x3F, 0x2B, 0xB3, 0xD5, 0xAB, 0x0D, 0x6E, 0xEA, 0x5F, 0x17, 0x80,
+    0x55, 0x6C, 0x14, 0x5B, 0x45, 0xA7, 0x95, 0x66, 0xA1, 0x0D, 0xB8, 0xC0, 0xA3, 0x37, 0x01, 0x3A,
+    0xA0, 0x98, 0x01, 0x02, 0x14, 0xFB, 0x3B, 0x2B, 0x85, 0x96, 0x11, 0xB4, 0xB9, 0x81, 0x51, 0x9A,
+    0x70, 0xB7, 0x15, 0x68, 0xDE, 0xD6, 0x42, 0xA5, 0x7A, 0x86, 0xDB, 0x03, 0x50, 0x79, 0xC0, 0x4C,
+    0x40, 0x39, 0x03, 0x45, 0x00, 0x58, 0x00, 0xFE, 0x00, 0xE0, 0x19, 0x80, 0xC7, 0x01, 0x1C, 0xC0,
+    0xC7, 0x01, 0xFE, 0xE6, 0x03, 0xEB, 0x73, 0x2D, 0x3D, 0x28, 0x3D, 0xF4, 0x03, 0x00, 0x2E, 0xED,
+    0x45, 0xB3, 0x00, 0x50, 0x6F, 0x3F, 0x77, 0x95, 0x1F, 0x86, 0xB3, 0x8E, 0x5A, 0x2B, 0x6E, 0xA3,
+    0x95, 0xBC, 0xD5, 0xE0, 0xA4, 0x58, 0xCB, 0x3B, 0x49, 0xD2, 0xE4, 0x54, 0x48, 0x9A, 0x5A, 0x0D,
+    0xAD, 0x34, 0x55, 0x9A, 0x0B, 0xA9, 0x63, 0xBF, 0x4A, 0x71, 0x15, 0xC6, 0x74, 0x14, 0xE7, 0xD3,
+    0xD7, 0x86, 0xF7, 0xFB, 0x8A, 0x1B, 0x4B, 0xF9, 0x02, 0xAD, 0x26, 0xE7, 0x6B, 0xA9, 0x5A, 0xD1,
+    0x27, 0x17, 0x75, 0x6D, 0x70, 0x9A, 0x51, 0xA9, 0x08, 0xD4, 0x7B, 0x7E, 0x6B, 0xB5, 0xF3, 0x28,
+    0xA5, 0x62, 0xB5, 0x32, 0x2A, 0xA8, 0x6B, 0xC2, 0xA8, 0x60, 0x64, 0x14, 0x79, 0x68, 0x3E, 0xBD,
+    0x0B, 0xE0, 0xF2, 0x55, 0x68, 0x26, 0x78, 0x02, 0xB8, 0xC4, 0xFF, 0x27, 0x3F, 0xFF, 0x14, 0xAA,
+    0x98, 0xED, 0x44, 0xF7, 0x11, 0x5B, 0x87, 0x7F, 0xF0, 0x2B, 0x7C, 0x08, 0x80, 0xE7, 0x02, 0xC0,
+    0xE3, 0xCD, 0x00, 0xB4, 0x93, 0x3A, 0xE8, 0x97, 0x52, 0x77, 0x6F, 0x2B, 0x52, 0x49, 0xBA, 0x03,
+    0x97, 0xA5, 0x17, 0x81, 0xE2, 0xFA, 0xBF, 0xEA, 0xE0, 0xB2, 0xA4, 0x99, 0x52, 0x92, 0x66, 0x74,
+    0x93, 0x8F, 0x69, 0x6A, 0x07, 0x28, 0xF4, 0x5C, 0x00, 0x8A, 0xF8, 0x6B, 0x00, 0xE5, 0x70, 0xF1,
+    0xBB, 0xBB, 0xF4, 0x50, 0x2E, 0x5C, 0x3A, 0x3B, 0x3B, 0x3B, 0xFB, 0xB4, 0xBA, 0x56, 0x92, 0xA4,
+    0x39, 0xED, 0x92, 0xD6, 0xFC, 0x98, 0xDE, 0x68, 0xD3, 0xFE, 0xF3, 0x2B, 0xDD, 0x7B, 0x2F, 0xC3,
+    0xC6, 0x64, 0x15, 0x92, 0xF4, 0x78, 0x80, 0x3E, 0x00, 0xB4, 0x1F, 0x4C, 0x33, 0xCB, 0xDB, 0xD2,
+    0x8A, 0x91, 0x14, 0xA8, 0x24, 0x4D, 0xD4, 0x92, 0x06, 0xEC, 0x7A, 0x2E, 0x79, 0x6D, 0x38, 0x17,
+    0xC6, 0x7E, 0x02, 0x18, 0xA5, 0x01, 0xD2, 0x09, 0x4A, 0x82, 0x42, 0x12, 0x18, 0x3D, 0xDF, 0x1D,
+    0x27, 0x53, 0xED, 0xE7, 0x32, 0x6B, 0xB7, 0xB3, 0xB3, 0x8E, 0x46, 0x92, 0xA7, 0x95, 0xE4, 0x71,
+    0x17, 0x7E, 0xF7, 0x92, 0x3C, 0x92, 0xD2, 0xE9, 0x03, 0x70, 0x45, 0x92, 0x86, 0x42, 0x92, 0x44,
+    0x2B, 0x65, 0x2B, 0x70, 0xF7, 0xD6, 0x0B, 0x87, 0x58, 0x8E, 0x1E, 0xB2, 0x61, 0x3F, 0xAD, 0x50,
+    0xEF, 0x21, 0xDB, 0x7F, 0xB0, 0xBB, 0x66, 0xA0, 0x57, 0xF2, 0x09, 0x52, 0x00, 0xAB, 0x7B, 0x9A,
+    0xC0, 0xAD, 0xC8, 0x53, 0xC8, 0x97, 0x82, 0x3A, 0x52, 0x45, 0x70, 0x33, 0xCD, 0x0C, 0xEA, 0x50,
+    0x77, 0x7A, 0x2E, 0x5C, 0x1A, 0x67, 0xD0, 0x30, 0x0A, 0xAA, 0xBD, 0xD4, 0x0A, 0xED, 0x62, 0x35,
+    0x80, 0xBC, 0x7B, 0xEB, 0xFE, 0x95, 0x6C, 0x06, 0x80, 0x08, 0xC9, 0x4A, 0x66, 0x6D, 0xAA, 0x96,
+    0x0B, 0xFA, 0xFC, 0xD3, 0x7F, 0x24, 0x45, 0x6A, 0x49, 0x01, 0x27, 0x69, 0x40, 0xD2, 0x4E, 0xB5,
+    0x9D, 0x2F, 0xBF, 0xFC, 0x69, 0x51, 0xDB, 0xE5, 0xF4, 0x44, 0x5A, 0xEB, 0x26, 0x02, 0x8C, 0x33,
+    0x60, 0xD4, 0x9D, 0x3F, 0x11, 0x00, 0xA3, 0x01, 0xB0, 0x3B, 0xD9, 0x03, 0x52, 0xCA, 0x03, 0x56,
+    0x00, 0xFD, 0x0A, 0x14, 0x9A, 0xF2, 0x59, 0x7C, 0xEC, 0xF7, 0x80, 0x62, 0xD4, 0x0C, 0x46, 0x12,
+    0x54, 0x59, 0x2E, 0xA6, 0x66, 0xC3, 0x68, 0x40, 0xDE, 0x68, 0xA0, 0x0D, 0x85, 0x06, 0xAA, 0x88,
+    0x3C, 0xFC, 0x56, 0x16, 0x89, 0xB4, 0x97, 0x56, 0xD2, 0x4C, 0x25, 0x69, 0xA1, 0xD4, 0xD9, 0xD9,
+    0xB5, 0x43, 0x28, 0x5D, 0x80, 0xAB, 0x58, 0x75, 0x97, 0xB5, 0x54, 0x92, 0x14, 0x91, 0xA4, 0x1D,
+    0x27, 0x49, 0xD8, 0x24, 0xED, 0xE9, 0x77, 0x23, 0x09, 0xB8, 0xA1, 0x7F, 0xFF, 0xDE, 0x85, 0xAA,
+    0xB5, 0x77, 0xD0, 0x4A, 0x01, 0x9C, 0xB4, 0x80, 0x93, 0x56, 0x70, 0xEA, 0xFE, 0x5B, 0x68, 0xB6,
+    0x73, 0xA1, 0x4B, 0x4B, 0x53, 0x64, 0x9D, 0x48, 0x72, 0xA8, 0xBD, 0x03, 0x23, 0xED, 0x1C, 0x9F,
+    0x2E, 0x93, 0x10, 0xD7, 0x52, 0x00, 0x4A, 0xE5, 0xF7, 0x0D, 0x40, 0xA1, 0x99, 0x05, 0xB4, 0xA0,
+    0xB7, 0x8A, 0x7C, 0xBE, 0x5B, 0x3E, 0xEB, 0xF4, 0x77, 0x2D, 0x69, 0x85, 0x47, 0xB4, 0xDF, 0x04,
+    0xCC, 0x0F, 0x40, 0x9E, 0x7E, 0xA6, 0x5D, 0xB0, 0x11, 0x23, 0xD0, 0x40, 0x3F, 0xD1, 0x06, 0x6C,
+    0xC4, 0xEC, 0x14, 0xEA, 0x18, 0x3D, 0x2E, 0x60, 0x57, 0xAA, 0x9D, 0x52, 0x1D, 0xF2, 0xB8, 0x40,
+    0x1B, 0xB1, 0x3B, 0x46, 0x5D, 0xA1, 0x09, 0x05, 0x5C, 0xA4, 0xD9, 0xB9, 0x7C, 0x7B, 0x80, 0xF2,
+    0xA5, 0x87, 0x5E, 0xA0, 0x7F, 0x7D, 0xC7, 0xAE, 0x6E, 0x2E, 0xF4, 0xC5, 0x0D, 0xB7, 0x68, 0x32,
+    0xFA, 0xD4, 0x4F, 0xD5, 0xF0, 0x27, 0x5E, 0xC8, 0x97, 0xDF, 0xCF, 0x79, 0x35, 0xE4, 0xB3, 0xA9,
+    0xD0, 0x90, 0xB4, 0xBA, 0x54, 0xDE, 0x94, 0x14, 0x1A, 0x4D, 0x50, 0xC7, 0xE3, 0x7D, 0x2B, 0x14,
+    0x1A, 0x92, 0x9C, 0x99, 0xE3, 0x7D, 0xB5, 0x00, 0xCD, 0x60, 0xB7, 0x2C, 0x32, 0x2E, 0x82, 0x91,
+    0x4F, 0x52, 0x74, 0xF9, 0xF6, 0x21, 0xE2, 0xE3, 0x9C, 0x54, 0xFE, 0xC2, 0xEA, 0xBB, 0xF5, 0x82,
+    0x91, 0x1A, 0xC3, 0x7B, 0x5E, 0x6F, 0xF3, 0xEB, 0xDD, 0xB9, 0xF9, 0xCA, 0xEE, 0x21, 0xBD, 0xDE,
+    0x64, 0x23, 0x37, 0x1C, 0x92, 0x94, 0x4F, 0x07, 0x92, 0xE8, 0x26, 0x23, 0x58, 0xE6, 0xD7, 0x17,
+    0x80, 0x2A, 0xBF, 0x3E, 0x1F, 0x9F, 0x2F, 0xDF, 0xBA, 0x22, 0x7F, 0xEC, 0x7A, 0x9D, 0x24, 0x2C,
+    0x99, 0x9C, 0x46, 0x5A, 0xC0, 0xA4, 0xB8, 0xEE, 0x63, 0xE3, 0x9D, 0xFB, 0xC5, 0x4D, 0x7B, 0x96,
+    0xEE, 0x95, 0xD3, 0x27, 0x8E, 0xCF, 0xD3, 0x4E, 0x65, 0x7A, 0x3A, 0xA9, 0xBC, 0x59, 0xE9, 0x01,
+    0x9A, 0xA9, 0x8C, 0xF9, 0xE9, 0x39, 0x3D, 0xED, 0xF4, 0x16, 0x34, 0x53, 0x21, 0x45, 0x10, 0xB5,
+    0x14, 0x31, 0x2B, 0xEE, 0x5B, 0xB7, 0x17, 0xDA, 0xA9, 0xD8, 0x70, 0x33, 0xA2, 0x0E, 0x8C, 0x5D,
+    0xB5, 0xE2, 0xBC, 0xD9, 0x68, 0x27, 0x76, 0xDA, 0x80, 0xA8, 0xD6, 0x2B, 0xF2, 0xF5, 0x4A, 0x2B,
+    0x6D, 0xA5, 0x26, 0x24, 0xCD, 0x56, 0x49, 0x8E, 0xC7, 0x85, 0x56, 0xEA, 0xF2, 0xDA, 0x70, 0xE9,
+    0x41, 0x17, 0x51, 0x5C, 0xBB, 0xCF, 0xA7, 0x57, 0x2B, 0x26, 0x00, 0x63, 0x47, 0x0F, 0xD8, 0x40,
+    0x3D, 0xA7, 0xB0, 0x63, 0x03, 0x9A, 0x19, 0xEB, 0xA1, 0xDC, 0x28, 0x63, 0xFA, 0x8C, 0x1B, 0x92,
+    0x29, 0x88, 0xC9, 0xE8, 0x4B, 0x6F, 0x25, 0x55, 0xD5, 0x4C, 0xF2, 0x50, 0xBE, 0x09, 0xD8, 0xB9,
+    0x8E, 0xE5, 0x4E, 0x11, 0x71, 0x93, 0xF3, 0x38, 0x6F, 0x36, 0x93, 0x2E, 0xCF, 0xF7, 0x03, 0x7D,
+    0x67, 0x63, 0xBD, 0x50, 0x2F, 0x57, 0x34, 0x08, 0x24, 0x05, 0x1B, 0xB0, 0xD2, 0x56, 0xEC, 0x14,
+    0x92, 0xBA, 0x76, 0xA2, 0xD5, 0xDE, 0x1D, 0xB1, 0x64, 0x23, 0x49, 0x31, 0x19, 0x7D, 0x77, 0xEE,
+    0x0D, 0x97, 0x5E, 0x92, 0xC2, 0xF5, 0xE7, 0xC7, 0x77, 0xAF, 0xBF, 0x70, 0x88, 0x51, 0xDA, 0x5F,
+    0x4D, 0x27, 0x59, 0x2A, 0xB3, 0x59, 0x1C, 0x80, 0x4A, 0x6F, 0xEF, 0x69, 0xAF, 0x0E, 0xC3, 0x64,
+    0xB5, 0x8F, 0x81, 0x46, 0x83, 0x0D, 0xB4, 0x3B, 0x36, 0xE0, 0x22, 0x36, 0xE0, 0x56, 0x9A, 0x99,
+    0x7E, 0xA1, 0x4D, 0xCA, 0x37, 0xA1, 0x40, 0xEF, 0x0B, 0x05, 0x46, 0x5F, 0x6A, 0x46, 0x83, 0xD1,
+    0x54, 0x68, 0x30, 0xF2, 0xA5, 0x3A, 0xAE, 0xF8, 0xE2, 0xBE, 0x85, 0xAE, 0x67, 0x4E, 0x39, 0x47,
+    0x0A, 0xF7, 0xD3, 0xC5, 0x24, 0x31, 0x28, 0xF6, 0x07, 0x8D, 0x58, 0x2C, 0x35, 0x61, 0x54, 0x68,
+    0xA6, 0xD0, 0x27, 0x34, 0x83, 0xBC, 0x02, 0xB8, 0x59, 0x01, 0xDA, 0x65, 0x0C, 0x60, 0xE3, 0xB8,
+    0x40, 0xB5, 0xF7, 0x0B, 0x94, 0xEA, 0x57, 0x20, 0x09, 0x61, 0xAF, 0x08, 0x38, 0xC5, 0x14, 0xCC,
+    0x02, 0xB5, 0x22, 0x60, 0xB4, 0x03, 0x85, 0x34, 0x01, 0x63, 0x7E, 0x53, 0x16, 0xF0, 0x08, 0x76,
+    0x1B, 0x35, 0x60, 0x64, 0xB5, 0x52, 0xEA, 0x0D, 0xA9, 0x43, 0xB3, 0xD3, 0x42, 0xBF, 0x54, 0x12,
+    0x6D, 0x24, 0xD9, 0xC0, 0x23, 0x78, 0x4B, 0xD1, 0x66, 0xF2, 0x35, 0x59, 0xCF, 0xB2, 0x86, 0x36,
+    0x0F, 0x06, 0xA2, 0xD9, 0xE3, 0xBA, 0x99, 0x87, 0x6E, 0x51, 0x6D, 0x14, 0x9A, 0x18, 0x3D, 0x7D,
+    0xC4, 0x46, 0xAC, 0x3C, 0x1A, 0x4C, 0x0A, 0xB6, 0x47, 0x75, 0xA5, 0x68, 0x15, 0x70, 0x73, 0x25,
+    0x51, 0x6D, 0x48, 0x33, 0xA3, 0x77, 0xDA, 0xB0, 0xD1, 0xEE, 0xF2, 0xE8, 0x0B, 0xEA, 0x23, 0xCD,
+    0xD2, 0x7F, 0x53, 0x83, 0x51, 0xB3, 0x8E, 0x0B, 0xEE, 0x47, 0xB2, 0xA2, 0xDA, 0xF5, 0xBA, 0x02,
+    0xA3, 0x96, 0x76, 0xC7, 0x6A, 0x37, 0x9A, 0x90, 0xFC, 0x18, 0x69, 0x15, 0xAC, 0xBC, 0xD1, 0x56,
+    0x68, 0xC5, 0x69, 0x68, 0xD5, 0x55, 0x0A, 0x46, 0x81, 0x31, 0xD2, 0x0B, 0xE0, 0xF2, 0x0B, 0xBC,
+    0x0C, 0xF5, 0x9D, 0xCF, 0x6C, 0x24, 0xF5, 0xA3, 0x3A, 0x22, 0x03, 0x0F, 0xB4, 0x77, 0x3E, 0x58,
+    0xD8, 0x68, 0x17, 0xCA, 0x1D, 0x1B, 0xA9, 0x22, 0x75, 0xC4, 0x2E, 0x54, 0x1B, 0x6D, 0xC0, 0x08,
+    0x37, 0x61, 0xC4, 0xE8, 0x29, 0xF5, 0x09, 0x41, 0xA1, 0xE7, 0x76, 0x40, 0x7F, 0x14, 0x01, 0x7D,
+    0x7B, 0x01, 0x46, 0x05, 0xA0, 0xD7, 0x04, 0xF4, 0x1A, 0x00, 0x27, 0x00, 0xB7, 0x9F, 0x47, 0x6C,
+    0x69, 0xC1, 0x93, 0x91, 0xD3, 0x04, 0x5C, 0xD1, 0x00, 0x56, 0x02, 0x1A, 0x6D, 0x40, 0xAB, 0x05,
+    0x70, 0xF2, 0x80, 0xBB, 0x93, 0x05, 0x8A, 0x52, 0x87, 0xC3, 0xD1, 0x80, 0x9B, 0xE8, 0x27, 0x9A,
+    0x40, 0x1B, 0xA8, 0x63, 0x76, 0x3E, 0x66, 0x07, 0x75, 0x85, 0x3A, 0x7A, 0xCF, 0xE8, 0x69, 0x03,
+    0x6E, 0xC6, 0xAE, 0xF9, 0x22, 0xAA, 0xF3, 0x63, 0x78, 0x34, 0xE0, 0xE6, 0xF7, 0x3B, 0x86, 0xCE,
+    0xCE, 0xD4, 0x15, 0x29, 0x58, 0x1B, 0x4F, 0xF1, 0xCA, 0x8A, 0x55, 0x4A, 0x50, 0xDB, 0x64, 0x90,
+    0xC3, 0xB9, 0x0E, 0x64, 0xE9, 0x4F, 0x22, 0xF2, 0xF0, 0x45, 0xB5, 0xD1, 0x00, 0x34, 0xEB, 0xC9,
+    0x74, 0xBB, 0xF5, 0xDC, 0xCA, 0x7F, 0xC0, 0x9F, 0x62, 0xBC, 0x09, 0x95, 0x92, 0x9A, 0xCF, 0xD4,
+    0x7B, 0x11, 0xA9, 0x36, 0xDA, 0xCE, 0xEC, 0xD7, 0x35, 0x17, 0x92, 0xD6, 0x14, 0x4A, 0xF5, 0x92,
+    0xBA, 0x76, 0x7F, 0xF9, 0x5A, 0x3A, 0x37, 0xB3, 0x65, 0xEB, 0xF1, 0xDB, 0x38, 0x49, 0x54, 0x47,
+    0xD0, 0x35, 0x63, 0xA5, 0x00, 0x37, 0xF6, 0x0E, 0x18, 0x07, 0x40, 0x1D, 0x14, 0xFA, 0xCA, 0xC0,
+    0x11, 0xA2, 0x50, 0x68, 0xBF, 0x4A, 0xC2, 0x0D, 0x6C, 0x00, 0x9A, 0x1F, 0xEB, 0x26, 0xAD, 0xB4,
+    0xE0, 0xA4, 0x48, 0xAF, 0xDB, 0x91, 0x71, 0x29, 0x23, 0xF2, 0x65, 0x2C, 0x34, 0x94, 0xB1, 0x14,
+    0x66, 0x35, 0xC2, 0xAC, 0xD5, 0x4E, 0xBD, 0xD4, 0x1B, 0x36, 0xD8, 0x48, 0x13, 0x9A, 0x88, 0x0B,
+    0xED, 0x8A, 0x9B, 0xDD, 0xCA, 0x38, 0xF5, 0x0B, 0x9A, 0xC6, 0xE5, 0x3F, 0x90, 0xBF, 0xFC, 0xAF,
+    0x9D, 0x3C, 0x8C, 0xF2, 0xA0, 0xD3, 0xAF, 0x51, 0x03, 0x5C, 0x7E, 0x40, 0x56, 0x5F, 0x25, 0x25,
+    0xE5, 0xF4, 0xC9, 0xD9, 0x24, 0x6B, 0x5F, 0x1E, 0x5A, 0xEA, 0x72, 0xB0, 0x15, 0x2A, 0x49, 0x43,
+    0x7B, 0xF7, 0xD6, 0xCB, 0xC8, 0x67, 0xC7, 0xDF, 0x2E, 0xD9, 0xC9, 0x1A, 0x1D, 0x7E, 0x76, 0x9C,
+    0xB3, 0xA2, 0xDB, 0x98, 0xBD, 0xB1, 0x91, 0xCF, 0x11, 0x64, 0xBF, 0x40, 0x71, 0xEB, 0xDC, 0xD5,
+    0x34, 0xF2, 0xD4, 0x12, 0xE5, 0x5E, 0x46, 0x46, 0xAC, 0x6F, 0x3C, 0xAF, 0x96, 0x2B, 0xE0, 0xB4,
+    0x53, 0x4B, 0x13, 0xFB, 0xD9, 0xB5, 0xE4, 0x1C, 0xD5, 0xB5, 0xC1, 0x4A, 0x42, 0x29, 0x6F, 0x5F,
+    0x71, 0xDA, 0xE0, 0xC6, 0x9D, 0xF3, 0xBD, 0xBC, 0xDB, 0xD1, 0x4A, 0x94, 0xFA, 0xCA, 0x82, 0x9D,
+    0x49, 0x3E, 0xAA, 0x88, 0x80, 0xD9, 0x3B, 0xA8, 0xB5, 0x66, 0x5B, 0x97, 0x12, 0xCD, 0x76, 0x01,
+    0xFA, 0xB9, 0x9C, 0x8C, 0x06, 0x77, 0x77, 0x8C, 0x26, 0x67, 0x50, 0x3B, 0xBD, 0x34, 0x71, 0x45,
+    0x2F, 0x1E, 0x87, 0x76, 0x33, 0xD5, 0x06, 0x9A, 0x68, 0x22, 0xA5, 0x3C, 0x2E, 0x52, 0x9C, 0x5D,
+    0x94, 0xC5, 0x8F, 0x0F, 0x98, 0x08, 0xFD, 0x40, 0xBD, 0x80, 0xC0, 0x06, 0x8A, 0x1D, 0xDA, 0x09,
+    0x13, 0xC1, 0x79, 0xAA, 0x15, 0xD4, 0x61, 0x17, 0x0A, 0x91, 0x55, 0x9E, 0x7E, 0xE6, 0xF2, 0x6B,
+    0xC0, 0xCB, 0xE5, 0x8B, 0xF5, 0xDA, 0xCE, 0x6E, 0xD6, 0xB3, 0x7A, 0x7A, 0xB3, 0x9B, 0x0B, 0xFD,
+    0x3B, 0x17, 0xD2, 0x19, 0xE0, 0x0F, 0x93, 0x3E, 0x34, 0x33, 0x8C, 0x1D, 0x26, 0x26, 0xD1, 0xE9,
+    0x07, 0xCA, 0x2D, 0xFD, 0xE9, 0x3C, 0xC5, 0x9E, 0x52, 0x19, 0x37, 0x51, 0xA4, 0xCC, 0x04, 0x17,
+    0x28, 0x34, 0xA4, 0x2F, 0x39, 0x9C, 0x4B, 0xEB, 0xB3, 0x3E, 0x55, 0xF1, 0x64, 0x2A, 0xDE, 0xAB,
+    0x19, 0xA7, 0x14, 0x7E, 0xEC, 0xB2, 0x2A, 0xDA, 0x90, 0x53, 0x91, 0xF2, 0x03, 0xFD, 0xE7, 0xDE,
+    0xF3, 0x9A, 0xD9, 0xF2, 0xF7, 0x39, 0x0D, 0xA0, 0x08, 0xB5, 0xE6, 0x6C, 0xC4, 0xAE, 0xDF, 0x4C,
+    0x61, 0x97, 0xC0, 0x48, 0x03, 0xEC, 0xB7, 0x3D, 0x3C, 0x5E, 0x04, 0x68, 0x58, 0xC1, 0xFA, 0xC7,
+    0xC1, 0x4C, 0x8D, 0x86, 0x22, 0xD4, 0x8A, 0x44, 0xF3, 0x6E, 0xDF, 0x3D, 0xCE, 0x5A, 0x4D, 0x2D,
+    0x9F, 0x2B, 0x17, 0xEB, 0xDB, 0x32, 0x56, 0xB3, 0xD5, 0x6E, 0x83, 0x91, 0xAA, 0xB5, 0xD4, 0x56,
+    0xAE, 0xF7, 0x43, 0x1B, 0xD0, 0x0C, 0x0F, 0x41, 0x3D, 0x19, 0x8F, 0x09, 0x45, 0x80, 0x95, 0x3F,
+    0x80, 0xCF, 0xF1, 0x38, 0xB4, 0x3F, 0x18, 0x07, 0xAC, 0xA4, 0xC9, 0x48, 0x52, 0xB1, 0x70, 0xE7,
+    0xB3, 0xFE, 0x15, 0x3E, 0x57, 0x2E, 0x8E, 0x96, 0x68, 0x07, 0xEB, 0xC7, 0x6A, 0x32, 0xD2, 0x17,
+    0x42, 0x21, 0x0D, 0x91, 0x51, 0xDD, 0x13, 0x47, 0xC4, 0xFA, 0xFF, 0x87, 0x96, 0xFB, 0x71, 0x29,
+    0xE4, 0x2F, 0xFF, 0xEB, 0xE2, 0x02, 0xA6, 0x55, 0x4F, 0x47, 0x14, 0x51, 0x85, 0x43, 0x95, 0x4D,
+    0xE4, 0x82, 0x2E, 0x67, 0x78, 0xE8, 0x49, 0x81, 0x7B, 0x43, 0xD0, 0x7C, 0x43, 0x60, 0x7F, 0x28,
+    0xA8, 0x7E, 0x2C, 0x28, 0xF7, 0x14, 0xD6, 0x02, 0xE3, 0x7E, 0x38, 0x96, 0x56, 0x1D, 0x58, 0x2D,
+    0x50, 0x49, 0x1D, 0x66, 0xD3, 0x42, 0xA1, 0x46, 0x1D, 0x7A, 0x4E, 0x0B, 0xCE, 0x3B, 0x75, 0x90,
+    0x33, 0xFE, 0x64, 0x93, 0xE3, 0x29, 0x92, 0xFA, 0x99, 0x30, 0x82, 0x89, 0xD8, 0x58, 0xEC, 0xD8,
+    0x9D, 0xB1, 0xB3, 0xEA, 0x9C, 0xAF, 0xE5, 0x6D, 0xA8, 0x15, 0xAA, 0xB5, 0xD6, 0x5A, 0x6E, 0xB5,
+    0x36, 0x54, 0xED, 0xC2, 0xFD, 0xD1, 0xEE, 0x7C, 0xF3, 0xBD, 0xBD, 0x99, 0xEB, 0x7B, 0xB2, 0xAB,
+    0x91, 0xCC, 0x56, 0x48, 0x85, 0x18, 0xC5, 0xE8, 0x9D, 0x3A, 0x37, 0x5B, 0x75, 0xCD, 0x52, 0xA9,
+    0xAB, 0x63, 0x71, 0x6B, 0x28, 0x6F, 0xA5, 0x4D, 0x2F, 0x3A, 0x28, 0x76, 0x7A, 0x0F, 0x55, 0xF2,
+    0x30, 0xC9, 0x3E, 0xD3, 0xA6, 0xC0, 0xBC, 0x49, 0x91, 0x49, 0xD1, 0xFD, 0xC2, 0x00, 0x50, 0xA1,
+    0x0E, 0x37, 0x61, 0x76, 0xCA, 0x1D, 0x6C, 0xA4, 0x09, 0xD0, 0x2E, 0x68, 0x80, 0x7E, 0xAE, 0x52,
+    0x36, 0xE4, 0x26, 0x30, 0x7A, 0x72, 0x07, 0xEA, 0xBD, 0x09, 0x40, 0x13, 0xB3, 0xE3, 0x4E, 0x11,
+    0xBE, 0x26, 0xA0, 0x4C, 0xE7, 0x52, 0xA5, 0xF8, 0xC9, 0xE6, 0x3C, 0x24, 0x5E, 0x8C, 0x9C, 0x92,
+    0x13, 0x4C, 0xBA, 0x7A, 0x45, 0xC3, 0x29, 0x8C, 0xCB, 0xE1, 0x87, 0x4D, 0x89, 0x67, 0x72, 0xEA,
+    0x45, 0x8A, 0x6A, 0xEF, 0xFB, 0xA9, 0x02, 0x3B, 0x23, 0x76, 0xB2, 0x73, 0x11, 0xD9, 0x68, 0x7D,
+    0xE3, 0xCD, 0x5A, 0x46, 0x5C, 0xE7, 0x86, 0x2A, 0x98, 0x85, 0xD7, 0xE8, 0xB1, 0x53, 0x3D, 0x13,
+    0xD9, 0x68, 0xBC, 0xF5, 0xE5, 0x5A, 0x6E, 0x67, 0x7D, 0xE7, 0xA4, 0x60, 0x24, 0xD1, 0x4B, 0x33,
+    0xE5, 0x92, 0x61, 0x48, 0x13, 0x80, 0xCF, 0x1F, 0x87, 0x7F, 0xE8, 0x2A, 0x14, 0x82, 0x87, 0x6F,
+    0xBC, 0x7B, 0x96, 0xF0, 0x54, 0x69, 0x4B, 0x91, 0xF3, 0xD8, 0x65, 0xF9, 0x17, 0x47, 0xEA, 0x98,
+    0x54, 0x60, 0x36, 0x92, 0xBA, 0x3E, 0x54, 0x6B, 0x1D, 0x69, 0xBD, 0xBC, 0x59, 0xED, 0xCA, 0xF8,
+    0x09, 0x49, 0xA1, 0x91, 0x12, 0xD0, 0x68, 0xA5, 0xC8, 0x28, 0x75, 0xA5, 0x34, 0xC1, 0x19, 0x70,
+    0xF9, 0x45, 0xA0, 0x9D, 0xB3, 0xCE, 0x99, 0x78, 0xFA, 0x6F, 0xA0, 0xCC, 0x1F, 0x11, 0x0F, 0x8F,
+    0xCF, 0x5F, 0x4D, 0xAB, 0x66, 0x75, 0x07, 0x7A, 0x69, 0x28, 0x25, 0x0D, 0x56, 0xFF, 0x42, 0xB8,
+    0x50, 0x6C, 0x85, 0x86, 0x2A, 0xD4, 0x11, 0xE7, 0xDB, 0x3B, 0xB7, 0x77, 0x24, 0x2D, 0x46, 0x92,
+    0xB7, 0xD2, 0x9E, 0xF0, 0x81, 0x56, 0x3A, 0x19, 0x8F, 0xE7, 0xCF, 0xCE, 0xFE, 0xCB, 0x6B, 0x09,
+    0xA4, 0xD3, 0x94, 0x53, 0x98, 0x84, 0x59, 0x28, 0xE6, 0xA7, 0x67, 0x4A, 0x2D, 0x68, 0x03, 0xA3,
+    0xD9, 0xCA, 0x43, 0x25, 0xAF, 0x15, 0xA8, 0xF5, 0xBB, 0x49, 0x43, 0x72, 0x80, 0xDC, 0x1C, 0xDB,
+    0x9D, 0x1E, 0xC7, 0xF4, 0x68, 0xA5, 0xB7, 0x23, 0x30, 0x7E, 0x57, 0x76, 0x81, 0x6A, 0xB7, 0x6B,
+    0x3B, 0x83, 0x0B, 0x6E, 0xEA, 0x53, 0x4C, 0x58, 0x08, 0x9A, 0x58, 0xC7, 0x2A, 0x82, 0x26, 0x37,
+    0x37, 0x81, 0x5A, 0x85, 0xBA, 0x7E, 0xA2, 0x5F, 0x6C, 0x2C, 0xD5, 0x19, 0xF9, 0x31, 0xD4, 0x7B,
+    0xB6, 0x76, 0xD7, 0x4E, 0xD0, 0xD2, 0x81, 0x90, 0xED, 0x18, 0x49, 0x0B, 0xF5, 0x66, 0xD4, 0x61,
+    0xD7, 0x36, 0x80, 0xFD, 0xE1, 0x7E, 0xE8, 0x41, 0x21, 0x41, 0xBA, 0xEE, 0x72, 0xDB, 0x5E, 0x83,
+    0xE6, 0x9B, 0x21, 0xC2, 0xDE, 0xBC, 0x19, 0xA8, 0xC3, 0xAB, 0xD6, 0xD3, 0x3F, 0x15, 0x1C, 0x26,
+    0x36, 0x7E, 0xA3, 0x9D, 0x64, 0xD6, 0x0B, 0x68, 0xEB, 0xB5, 0xE3, 0xBB, 0x06, 0x9B, 0xB2, 0x8C,
+    0xD9, 0x6E, 0x80, 0xB4, 0xD8, 0x98, 0xD2, 0xE3, 0x76, 0x85, 0x4A, 0x9F, 0x4A, 0x48, 0xDA, 0x5E,
+    0x29, 0xA1, 0x01, 0x26, 0xE5, 0x18, 0x1B, 0x19, 0x48, 0x59, 0xDA, 0x35, 0x9D, 0x44, 0xC2, 0x50,
+    0xA4, 0x39, 0xAD, 0x95, 0x16, 0xA0, 0xD1, 0xDD, 0x94, 0x98, 0xEC, 0xC9, 0xB2, 0x8C, 0x4B, 0xC6,
+    0x13, 0x66, 0xEC, 0x96, 0x22, 0x8D, 0xF4, 0xD8, 0x61, 0xB7, 0x94, 0xE5, 0x37, 0x31, 0x05, 0x1F,
+    0xEE, 0x78, 0x5C, 0xD3, 0xA3, 0x16, 0xB0, 0xC2, 0x28, 0x40, 0xA3, 0x1F, 0x8C, 0x9A, 0x48, 0x1B,
+    0xEB, 0xF3, 0x63, 0xCE, 0xD3, 0xB7, 0x54, 0x35, 0xD1, 0x9A, 0x4F, 0x67, 0x02, 0xE8, 0xD3, 0xD6,
+    0x71, 0x59, 0x37, 0x4F, 0x97, 0x7F, 0x0D, 0x4A, 0x79, 0xE7, 0x31, 0x8A, 0x36, 0x50, 0x48, 0x5F,
+    0x5A, 0x41, 0x9F, 0x52, 0x84, 0xFE, 0x75, 0xED, 0xD0, 0xCE, 0xED, 0x0E, 0x95, 0xBE, 0xFE, 0x22,
+    0x94, 0x12, 0x47, 0x0E, 0x51, 0xE9, 0xF6, 0x4E, 0x0E, 0xFE, 0x8D, 0x68, 0x02, 0x85, 0x30, 0x11,
+    0xC6, 0xA1, 0x10, 0x38, 0x4F, 0xEF, 0x69, 0x02, 0xED, 0x4C, 0xBD, 0x62, 0x17, 0xCC, 0x4E, 0x1D,
+    0x41, 0xBE, 0xDE, 0x93, 0x14, 0x92, 0x61, 0xD7, 0x22, 0x9D, 0x7F, 0xCA, 0xDB, 0x92, 0x1F, 0xA5,
+    0xD9, 0xDF, 0x63, 0x0D, 0xDA, 0x64, 0x20, 0xC6, 0x6C, 0x62, 0x92, 0x77, 0xD0, 0x9E, 0x10, 0x1E,
+    0x19, 0xA5, 0x30, 0x4E, 0x1E, 0xFA, 0x80, 0x5B, 0xC0, 0xA5, 0x75, 0x6E, 0x57, 0x8C, 0x06, 0x9A,
+    0x08, 0x9A, 0x8F, 0x55, 0xB5, 0x02, 0x2B, 0x6A, 0x75, 0x18, 0xF9, 0x4A, 0x1E, 0xC6, 0xC5, 0xC8,
+    0x43, 0xBB, 0x95, 0x9A, 0xA1, 0xD6, 0xB3, 0x29, 0x53, 0x9A, 0xB5, 0x00, 0x63, 0x54, 0x04, 0x1A,
+    0x8D, 0xDB, 0xB9, 0x16, 0x14, 0x19, 0x11, 0xE9, 0xF3, 0x39, 0x27, 0xB3, 0x56, 0xE5, 0xE5, 0xCE,
+    0x8A, 0xE3, 0x0E, 0x03, 0x99, 0xF1, 0x9E, 0x07, 0x7C, 0xCB, 0x6B, 0x07, 0xC2, 0xD9, 0x44, 0x81,
+    0x7B, 0x51, 0xB0, 0x33, 0x52, 0x46, 0x46, 0xAA, 0x85, 0xB1, 0xB3, 0x81, 0xB1, 0x73, 0x9E, 0x71,
+    0x18, 0x07, 0xFA, 0x67, 0x05, 0xFD, 0x9B, 0x1B, 0xF4, 0x5F, 0x8D, 0xD0, 0xBF, 0x1D, 0xA0, 0xD7,
+    0x0C, 0x7D, 0x5A, 0xC1, 0x2E, 0x07, 0x26, 0x6E, 0x3B, 0x21, 0x50, 0x3C, 0xDC, 0x51, 0x6E, 0x39,
+    0x9A, 0x6B, 0xA4, 0x27, 0xA5, 0xE0, 0x24, 0x68, 0xE6, 0xE3, 0xF9, 0x8C, 0x97, 0x94, 0x2F, 0x9D,
+    0x27, 0x30, 0xF5, 0x7A, 0x68, 0x9D, 0xA4, 0x80, 0x3D, 0xFD, 0x9E, 0xEF, 0xC7, 0xC7, 0x03, 0x19,
+    0x71, 0x83, 0x71, 0x3A, 0x07, 0xAF, 0xB2, 0x49, 0xF7, 0xA7, 0x34, 0x27, 0x65, 0xD1, 0x09, 0xA0,
+    0x4A, 0x30, 0x56, 0x42, 0x67, 0xD3, 0xEF, 0x94, 0x5C, 0x27, 0xB7, 0x9B, 0x5C, 0x48, 0xBF, 0x9E,
+    0xB0, 0x5B, 0x00, 0xAE, 0x9F, 0xF0, 0x9C, 0x26, 0xA4, 0xD3, 0x73, 0xD2, 0x86, 0x3D, 0xE5, 0x31,
+    0xA5, 0x6E, 0xDD, 0xBA, 0x99, 0xBE, 0xD7, 0xCD, 0x47, 0x9C, 0x6C, 0xE3, 0x01, 0xC1, 0xA5, 0x73,
+    0x19, 0xE7, 0x03, 0x2B, 0xB3, 0xF1, 0x38, 0x1D, 0x23, 0x7F, 0x60, 0x2A, 0xFD, 0x02, 0x3C, 0xF2,
+    0x12, 0xB9, 0xE6, 0x98, 0xCC, 0xE9, 0x45, 0x23, 0xB4, 0xE6, 0x8B, 0x1F, 0x4F, 0x30, 0x74, 0x71,
+    0x63, 0x3B, 0x3B, 0xA3, 0x3D, 0x61, 0xBB, 0xA1, 0x92, 0xA4, 0x21, 0x01, 0x7A, 0xE9, 0xD2, 0x13,
+    0xEA, 0xE7, 0xC2, 0x03, 0x30, 0xB4, 0x3B, 0x87, 0xA1, 0xD3, 0x82, 0xA4, 0x0B, 0xD7, 0x0C, 0xD4,
+    0xBA, 0xE0, 0xDA, 0x47, 0x45, 0xA4, 0xC8, 0x7E, 0xEB, 0xC5, 0x22, 0x42, 0xB9, 0x26, 0x55, 0xE9,
+    0x25, 0xFF, 0xD9, 0x77, 0xCF, 0xB0, 0x01, 0xEC, 0x9C, 0x4A, 0x49, 0xAD, 0x4F, 0x8B, 0xE4, 0x86,
+    0x14, 0xE0, 0x5D, 0x38, 0x4C, 0x2B, 0x25, 0x14, 0x2D, 0xAD, 0xD7, 0x8A, 0xBD, 0x73, 0x76, 0xD6,
+    0xE1, 0x12, 0x8A, 0x94, 0xF3, 0xE9, 0x53, 0xC5, 0x23, 0xED, 0x56, 0x7A, 0xE2, 0x5E, 0x2E, 0x7B,
+    0x4C, 0x54, 0xB9, 0x98, 0x71, 0x4F, 0x03, 0x5A, 0x8C, 0x30, 0xA2, 0x8A, 0x34, 0x0B, 0x36, 0x30,
+    0x7A, 0x9C, 0x4F, 0x81, 0x45, 0xB3, 0x60, 0x17, 0x46, 0xFF, 0x31, 0x79, 0xA3, 0x42, 0x1B, 0x36,
+    0x56, 0x0A, 0xF4, 0x73, 0x2B, 0x4A, 0x75, 0x27, 0xF3, 0x03, 0x0F, 0x9F, 0x5D, 0x43, 0x9A, 0x2B,
+    0xA9, 0x6B, 0x53, 0x21, 0xA1, 0x9A, 0xA1, 0xFD, 0xCF, 0x40, 0xEA, 0x8C, 0x44, 0x33, 0xBD, 0xC6,
+    0xAB, 0xAC, 0x26, 0x98, 0xA9, 0x19, 0x5A, 0x5E, 0xAD, 0x57, 0x13, 0x7A, 0x6F, 0xDF, 0x38, 0xA2,
+    0x64, 0x2B, 0xA4, 0x50, 0xAB, 0xA3, 0xD4, 0xE4, 0xB4, 0xD6, 0x1A, 0xA0, 0x5F, 0xAD, 0xB6, 0x2A,
+    0x41, 0x08, 0x46, 0x32, 0xF2, 0x50, 0xEA, 0xEB, 0xD2, 0x73, 0xF2, 0x40, 0xBF, 0xF6, 0x7A, 0x33,
+    0xEF, 0x44, 0xAB, 0x1F, 0x66, 0x29, 0xFD, 0xAA, 0xDE, 0x4D, 0x7A, 0xEB, 0xEE, 0x69, 0xCB, 0x10,
+    0xAB, 0xB2, 0x25, 0x3F, 0x2A, 0x5D, 0x07, 0xE6, 0x1F, 0x38, 0x5E, 0x0E, 0x39, 0xAC, 0x3A, 0xC1,
+    0x48, 0x7D, 0x06, 0x4D, 0x13, 0x74, 0xD8, 0x1D, 0x85, 0x8E, 0xF4, 0x72, 0xAE, 0xED, 0x1C, 0x07,
+    0x54, 0x00, 0x2A, 0x6D, 0xFA, 0xB1, 0xF6, 0x84, 0x68, 0xB9, 0xE8, 0x34, 0xE7, 0x72, 0x6D, 0xAD,
+    0x0D, 0x1A, 0xC5, 0x5A, 0x83, 0x34, 0xD3, 0x2A, 0x1A, 0x4D, 0x8D, 0x36, 0x9C, 0x22, 0x0A, 0xE6,
+    0x42, 0xE9, 0xC8, 0x9D, 0xE0, 0x83, 0x66, 0x3A, 0xC5, 0xD5, 0xE1, 0xBC, 0x0C, 0x7D, 0x5A, 0xEF,
+    0x97, 0x01, 0x13, 0x1B, 0x3D, 0xB9, 0x61, 0x62, 0xA3, 0x7A, 0xA5, 0xDC, 0xDB, 0xBD, 0x99, 0x41,
+    0xED, 0xE6, 0x3C, 0xC8, 0x45, 0x01, 0x7D, 0x7F, 0x2F, 0x43, 0x69, 0x21, 0x3D, 0x4C, 0xC9, 0xBE,
+    0xA5, 0x88, 0xE0, 0x40, 0x87, 0xF3, 0x15, 0xF9, 0x64, 0xC8, 0x67, 0x70, 0x77, 0xD5, 0x2F, 0x14,
+    0xFA, 0xEE, 0xEE, 0x36, 0xAC, 0x9E, 0xDB, 0xAC, 0x86, 0x7E, 0xAB, 0x62, 0x9D, 0x4F, 0xB5, 0xC9,
+    0xB2, 0x98, 0x11, 0xFB, 0xF3, 0xB0, 0xF4, 0xF6, 0x9D, 0x1C, 0xDC, 0x4A, 0x3B, 0xE6, 0xEE, 0x57,
+    0xE2, 0x71, 0x01, 0xCE, 0x67, 0xA4, 0xAD, 0x5F, 0xA8, 0xA5, 0x8E, 0x56, 0x33, 0x68, 0xEF, 0x28,
+    0xAE, 0xAB, 0xCB, 0x01, 0x5A, 0x0A, 0xA7, 0x42, 0x41, 0x21, 0xFF, 0xAB, 0x9F, 0x18, 0x77, 0xC6,
+    0x1C, 0xFE, 0x0D, 0x39, 0xE5, 0xD6, 0xC0, 0x15, 0xDD, 0x3C, 0x52, 0x3C, 0x9F, 0xF1, 0x99, 0x7A,
+    0xC9, 0x51, 0x74, 0xA5, 0x09, 0x89, 0xBF, 0xC5, 0x02, 0xB6, 0xA3, 0x08, 0x3C, 0xBA, 0x53, 0xAB,
+    0x43, 0x2B, 0x34, 0x1E, 0x22, 0x37, 0x5B, 0xDF, 0x6A, 0x35, 0x12, 0xA3, 0xA6, 0x62, 0x8C, 0x60,
+    0x07, 0xCC, 0x06, 0x7D, 0xE0, 0xC3, 0x37, 0x3A, 0x14, 0x68, 0xB6, 0x94, 0xB1, 0x63, 0x63, 0xAA,
+    0x10, 0x4C, 0xA9, 0x58, 0x50, 0x6A, 0x02, 0xBB, 0x36, 0x1B, 0x30, 0x7E, 0x3D, 0xD5, 0x99, 0xEC,
+    0x0E, 0x34, 0xAB, 0x02, 0x30, 0x7E, 0x35, 0x99, 0xA1, 0x31, 0x9C, 0xAF, 0x71, 0x0A, 0x1C, 0xB2,
+    0x2F, 0x6C, 0x0F, 0x18, 0x3E, 0x79, 0x97, 0x64, 0x2B, 0x8F, 0x50, 0x3C, 0xD9, 0x31, 0xAD, 0xE7,
+    0x78, 0xBD, 0xBE, 0x96, 0xD0, 0xFE, 0x46, 0x01, 0xDC, 0xEA, 0x14, 0x40, 0x53, 0xAF, 0x40, 0x2D,
+    0xA4, 0xEF, 0x46, 0x17, 0x91, 0xDE, 0xCE, 0xD2, 0xDC, 0x71, 0xC0, 0x0D, 0x27, 0x91, 0xC9, 0xD2,
+    0x74, 0x0D, 0xCC, 0xE2, 0x26, 0x9A, 0x37, 0x36, 0xD8, 0xDB, 0x19, 0xF3, 0xCE, 0x0E, 0xED, 0x97,
+    0x03, 0xEC, 0xCA, 0x81, 0x7F, 0x2B, 0x52, 0x50, 0x52, 0x9D, 0x5C, 0x4F, 0xC2, 0xA5, 0x36, 0x70,
+    0x5F, 0xDE, 0x28, 0x36, 0x17, 0xA9, 0x43, 0x1F, 0x3F, 0xEA, 0xBC, 0xF6, 0x00, 0xD8, 0x21, 0xF3,
+    0x02, 0x8A, 0x00, 0xB7, 0x80, 0x5B, 0x37, 0x13, 0x12, 0x10, 0x13, 0x12, 0x20, 0x12, 0xA6, 0xE8,
+    0x31, 0x11, 0x14, 0x60, 0xF4, 0x29, 0x0C, 0xBA, 0xBB, 0x5A, 0x75, 0x14, 0x72, 0x4F, 0x69, 0x82,
+    0xF6, 0x47, 0x8B, 0x16, 0x30, 0xBB, 0x73, 0x3B, 0xD0, 0xFF, 0xB1, 0x34, 0x9C, 0xE4, 0x90, 0x1C,
+    0x02, 0x35, 0x49, 0xC7, 0x4C, 0x8E, 0x90, 0xDC, 0x3B, 0x9B, 0x76, 0xA8, 0xF6, 0xF6, 0xAB, 0x5A,
+    0x40, 0xDF, 0x8C, 0x4E, 0x1E, 0x1B, 0x29, 0x24, 0x4A, 0x0D, 0x58, 0xC5, 0x14, 0x39, 0x68, 0xAE,
+    0x04, 0xA5, 0xD4, 0x8D, 0x33, 0x3C, 0x74, 0xEB, 0xA5, 0x73, 0x51, 0xED, 0xB8, 0xD4, 0x11, 0xA9,
+    0x56, 0xEC, 0x50, 0xEC, 0x94, 0x0B, 0xBD, 0xC7, 0x7D, 0xD4, 0x06, 0xCC, 0xBD, 0xE7, 0x22, 0xBC,
+    0xBA, 0xAA, 0xC3, 0x7E, 0x6D, 0x9C, 0x28, 0xA4, 0x25, 0x47, 0xA6, 0x46, 0x5A, 0xA1, 0x7F, 0x42,
+    0x13, 0xF5, 0x8F, 0xBE, 0x27, 0xD8, 0x70, 0x91, 0xC6, 0x17, 0x9A, 0xCB, 0x48, 0xAD, 0xCE, 0x0D,
+    0xC9, 0xFE, 0xB7, 0xA1, 0x56, 0x87, 0x8D, 0x95, 0x06, 0x7A, 0xFD, 0xB1, 0x06, 0x5A, 0xFD, 0x44,
+    0x9E, 0x22, 0xD9, 0xAE, 0xF1, 0x1B, 0xF2, 0xE0, 0x7E, 0xA8, 0x09, 0x9A, 0x77, 0x35, 0x41, 0xBD,
+    0xE5, 0xCA, 0xE5, 0x0C, 0xC5, 0x71, 0xF1, 0xE1, 0x14, 0x77, 0xB4, 0x0A, 0xA7, 0xE0, 0xA3, 0x92,
+    0xBA, 0x9C, 0xC9, 0xE4, 0x0A, 0x76, 0x2E, 0x14, 0xBB, 0x1F, 0x6B, 0x07, 0x1B, 0x9D, 0x66, 0x6A,
+    0xD5, 0xDA, 0x30, 0x1A, 0xA4, 0xA9, 0xD0, 0xD4, 0x28, 0x32, 0x1E, 0xB6, 0x66, 0x1C, 0x48, 0x50,
+    0x50, 0x2A, 0x61, 0x4E, 0xC5, 0x67, 0xB6, 0x6B, 0xA9, 0x00, 0x5D, 0x2F, 0x47, 0xAE, 0x34, 0x43,
+    0xB9, 0x5D, 0xBA, 0x86, 0x7B, 0x53, 0x54, 0xAB, 0x3C, 0xE3, 0x38, 0x63, 0xB5, 0x52, 0x68, 0x87,
+    0x56, 0x03, 0x46, 0x4B, 0x8A, 0x57, 0x6A, 0x29, 0x49, 0x70, 0x73, 0x4F, 0x73, 0x29, 0xA7, 0xC1,
+    0x05, 0x6D, 0xD5, 0x5E, 0x6B, 0x19, 0x27, 0x27, 0x6F, 0xA5, 0x50, 0xEB, 0x69, 0x29, 0x56, 0xFA,
+    0x82, 0xB4, 0x55, 0x1A, 0xCE, 0x3E, 0x9D, 0xAC, 0xF9, 0xFB, 0xAC, 0xC6, 0x9D, 0xF7, 0x59, 0x8D,
+    0xF0, 0x41, 0x56, 0x23, 0xFC, 0xBF, 0x5A, 0x8D, 0x46, 0xC1, 0xBD, 0xAE, 0xDD, 0x86, 0x4B, 0x9F,
+    0xFD, 0xC6, 0x46, 0x11, 0xC7, 0x8E, 0xF6, 0xCB, 0x33, 0xE6, 0x27, 0x2B, 0xF4, 0x02, 0x2B, 0x9F,
+    0xC4, 0xB7, 0x4D, 0xC9, 0x15, 0xF4, 0xEA, 0x92, 0x62, 0xEC, 0x63, 0xA0, 0xF9, 0xA6, 0xBC, 0x89,
+    0xAD, 0x70, 0x83, 0xD6, 0x14, 0x4B, 0x34, 0x2B, 0x36, 0xC2, 0x38, 0xD1, 0xCF, 0x18, 0x75, 0xA5,
+    0x06, 0x6C, 0xC4, 0x26, 0x23, 0xD3, 0x07, 0x8C, 0x86, 0x32, 0xE5, 0x0A, 0x76, 0x3F, 0x82, 0xDC,
+    0x52, 0xBE, 0x90, 0xC7, 0xEE, 0xD4, 0x02, 0xB7, 0xE0, 0xD6, 0xF4, 0xDC, 0x9C, 0xC2, 0xDB, 0xE7,
+    0xCF, 0xFA, 0x98, 0x52, 0xBE, 0x5C, 0xBC, 0xEA, 0x72, 0x21, 0xDA, 0x25, 0xFF, 0x23, 0x49, 0x1A,
+    0xAA, 0x54, 0xDA, 0x6D, 0x77, 0x50, 0x40, 0x0B, 0x75, 0x8A, 0x89, 0x9D, 0x6E, 0xB5, 0x02, 0x69,
+    0xD1, 0x4A, 0x75, 0x38, 0x1C, 0x5D, 0xF4, 0x2A, 0xD9, 0xE1, 0x5C, 0x87, 0xC6, 0x17, 0x91, 0xD6,
+    0x97, 0x11, 0x37, 0x98, 0x88, 0xEB, 0xCC, 0x4A, 0xDF, 0x55, 0x0B, 0xC2, 0x06, 0x84, 0x0D, 0xC5,
+    0x4E, 0x33, 0x97, 0x1B, 0xED, 0x64, 0x24, 0x79, 0x23, 0xC9, 0xD7, 0xD9, 0x4C, 0xAB, 0xB3, 0xEF,
+    0xFE, 0xA6, 0xBA, 0x26, 0x94, 0xA2, 0x9D, 0x8D, 0x16, 0x37, 0x1B, 0x2D, 0x40, 0x19, 0x00, 0x33,
+    0x27, 0xD5, 0x2B, 0xD5, 0x65, 0xB7, 0xEB, 0x02, 0x45, 0x8E, 0xCB, 0xC8, 0x61, 0x5A, 0x3F, 0x63,
+    0xF4, 0xFC, 0xD9, 0xB5, 0x63, 0xC9, 0x52, 0x1C, 0x9A, 0x8A, 0xAA, 0x39, 0xFA, 0x4F, 0x21, 0x58,
+    0x8E, 0xC8, 0xD6, 0x1C, 0x15, 0x56, 0xEA, 0x72, 0xF0, 0x35, 0x86, 0x83, 0x3A, 0xA0, 0x23, 0xF8,
+    0xD4, 0x9C, 0xC3, 0xB3, 0x66, 0x3F, 0x3B, 0xCB, 0xF5, 0x72, 0x9D, 0x17, 0x48, 0xCF, 0x33, 0xBD,
+    0x64, 0x97, 0xC7, 0x83, 0xD2, 0x61, 0x95, 0x2B, 0x88, 0x79, 0x89, 0x81, 0x46, 0xC9, 0x56, 0x62,
+    0x34, 0xD3, 0xA4, 0x98, 0x6F, 0xA3, 0xCC, 0x51, 0x80, 0xCF, 0x15, 0x91, 0x31, 0x52, 0xE5, 0x50,
+    0xA3, 0xF1, 0x85, 0xB4, 0x32, 0x62, 0x25, 0x6F, 0x56, 0xDC, 0xF3, 0x67, 0x34, 0x53, 0xB1, 0x01,
+    0x23, 0x75, 0x00, 0x13, 0x71, 0x1E, 0xEC, 0x5C, 0xEC, 0x40, 0xDF, 0xD5, 0xCB, 0xF9, 0x73, 0x27,
+    0x91, 0x5E, 0xD3, 0x29, 0xCF, 0xE9, 0xB9, 0x0E, 0xFA, 0x6F, 0x7D, 0x26, 0x42, 0x29, 0xDA, 0x00,
+    0x76, 0x45, 0x03, 0xB8, 0xA9, 0xBA, 0x1F, 0x6E, 0x1B, 0xF3, 0xE9, 0xDB, 0xE3, 0xEC, 0x95, 0xD3,
+    0xC9, 0x26, 0x73, 0x74, 0x4A, 0x3D, 0xFF, 0xE9, 0xA4, 0x5A, 0x21, 0x19, 0x7E, 0xB3, 0x27, 0x39,
+    0xA7, 0x9F, 0x12, 0xF5, 0xA0, 0x8E, 0x24, 0xC7, 0x2F, 0x4F, 0x3A, 0x56, 0xC4, 0xEA, 0xED, 0x9D,
+    0x22, 0xB1, 0x5C, 0x22, 0xED, 0x42, 0x2B, 0x29, 0x18, 0x61, 0xA4, 0xB7, 0xD5, 0xB9, 0x80, 0xD3,
+    0x60, 0xD7, 0x6A, 0xA7, 0xD2, 0xCC, 0xE8, 0xC7, 0x09, 0x45, 0xAA, 0x68, 0x23, 0x56, 0x03, 0xE3,
+    0x20, 0x5F, 0x68, 0xC1, 0x2E, 0xCD, 0x4A, 0x2B, 0x0A, 0x95, 0xEA, 0x8C, 0xC2, 0xA5, 0x71, 0x76,
+    0x0B, 0x6E, 0x2F, 0x15, 0x8D, 0xA8, 0x34, 0x39, 0x0D, 0x7D, 0x60, 0xDC, 0x8C, 0xE6, 0x7A, 0xC7,
+    0xCA, 0xBB, 0xF7, 0xC2, 0x4B, 0x99, 0xBE, 0x41, 0x9F, 0xAE, 0x30, 0xC7, 0x6B, 0x1A, 0xAC, 0x00,
+    0x75, 0xCD, 0x9E, 0x16, 0x69, 0x03, 0xA3, 0x54, 0xF8, 0xDF, 0x71, 0x11, 0xAA, 0x8D, 0x7E, 0x05,
+    0x1B, 0x19, 0x97, 0xB4, 0x80, 0x01, 0x9A, 0xA5, 0x50, 0x80, 0x36, 0x94, 0xD2, 0x8A, 0x0B, 0x09,
+    0x27, 0x9A, 0x8D, 0xA4, 0xE9, 0xE1, 0xAE, 0xD2, 0xAE, 0x00, 0xB5, 0x3A, 0x17, 0xD2, 0x3A, 0x84,
+    0xA4, 0xF0, 0x01, 0xDA, 0x90, 0x1C, 0x60, 0xA0, 0x99, 0x49, 0x2C, 0x4F, 0xE8, 0xA7, 0x87, 0xE5,
+    0x61, 0xF4, 0x09, 0x75, 0xF6, 0xBD, 0xA0, 0xD0, 0x30, 0x46, 0x28, 0x35, 0x8C, 0x37, 0xDF, 0x07,
+    0xDA, 0x4B, 0x3E, 0xAA, 0x4A, 0x4A, 0x5A, 0x69, 0x2D, 0x5E, 0x86, 0x52, 0x7A, 0x5A, 0x1B, 0x8C,
+    0xBA, 0x97, 0xD2, 0x99, 0x7F, 0x9E, 0xD4, 0x7D, 0x70, 0x4B, 0x1D, 0xD1, 0x6C, 0x57, 0xDC, 0xD0,
+    0xAE, 0xA5, 0xA8, 0x56, 0xB3, 0xE3, 0x3C, 0x62, 0xF4, 0xF5, 0x4A, 0x1B, 0xEC, 0x8A, 0xBA, 0x7A,
+    0x2B, 0x92, 0x4E, 0x0E, 0xCD, 0x52, 0x88, 0x31, 0x94, 0xA2, 0x0D, 0x6E, 0xEB, 0xDA, 0xA5, 0xD4,
+    0x67, 0xB5, 0x96, 0xF2, 0xAD, 0x24, 0xDF, 0xE8, 0x13, 0x92, 0x62, 0x8A, 0x6F, 0x13, 0x9A, 0x25,
+    0x6D, 0x49, 0x41, 0xF6, 0x24, 0x3B, 0x77, 0xA0, 0x18, 0xF7, 0x4F, 0x5C, 0x7D, 0xEF, 0x99, 0xB7,
+    0xFE, 0x42, 0x6A, 0xF4, 0x86, 0x06, 0x9C, 0xBE, 0xAC, 0x80, 0xDE, 0x95, 0x16, 0xA3, 0x27, 0x77,
+    0xB3, 0x54, 0xB1, 0x5A, 0xCA, 0xC5, 0x06, 0x3B, 0x9B, 0xD0, 0xCC, 0x8D, 0xAF, 0xE7, 0xD6, 0xB7,
+    0x43, 0x33, 0x39, 0xEF, 0x86, 0x7E, 0x70, 0xDE, 0x7D, 0x42, 0x38, 0xEF, 0xBE, 0x24, 0xEF, 0xBC,
+    0x93, 0xBC, 0x5B, 0x9C, 0x34, 0xB5, 0xE7, 0xE7, 0xD2, 0x55, 0x49, 0x03, 0x6E, 0xBC, 0x75, 0x7F,
+    0x21, 0x6D, 0xBF, 0x09, 0xB5, 0xB4, 0x42, 0x2B, 0x6D, 0x07, 0x2C, 0x91, 0xD8, 0x48, 0x4E, 0x77,
+    0xBF, 0xE2, 0x13, 0xEA, 0x9F, 0xE0, 0x64, 0xEC, 0x85, 0xDF, 0x55, 0x4E, 0x1B, 0x52, 0xD2, 0x1B,
+    0x00, 0xC6, 0x95, 0x23, 0xF5, 0xCE, 0x6F, 0x32, 0xB9, 0x48, 0x1F, 0xE1, 0x23, 0xF4, 0xFA, 0xBF,
+    0x2E, 0xFD, 0x01, 0xCD, 0x29, 0x99, 0xCC, 0xD4, 0x9F, 0xC4, 0x0E, 0x0B, 0x07, 0xE3, 0xA0, 0x97,
+    0xF6, 0x64, 0x50, 0xBA, 0xE3, 0xB8, 0xC9, 0x36, 0xB5, 0xE9, 0xB8, 0x17, 0xCA, 0x03, 0x37, 0x56,
+    0x6A, 0xED, 0x38, 0x6D, 0x68, 0x7F, 0xA5, 0x54, 0x0A, 0x48, 0xEB, 0x35, 0xD5, 0x53, 0x9A, 0x90,
+    0x20, 0x13, 0x37, 0x83, 0x0B, 0x1F, 0xC2, 0xAD, 0xBF, 0x43, 0x9B, 0x58, 0x47, 0xDE, 0x4A, 0xD3,
+    0xC3, 0x63, 0x92, 0x66, 0xB7, 0xA6, 0xD4, 0xDD, 0x4A, 0xD2, 0x6E, 0x25, 0x69, 0xBB, 0xC0, 0x46,
+    0xC8, 0x3C, 0x84, 0x23, 0xD5, 0x4F, 0xBF, 0xC7, 0x73, 0x06, 0xC2, 0x2F, 0x90, 0xEA, 0x6F, 0xE7,
+    0xB4, 0x16, 0xF7, 0x9E, 0x54, 0x7F, 0x4C, 0xD6, 0xF6, 0x9D, 0x97, 0xA0, 0xD0, 0x0F, 0x23, 0x94,
+    0xFA, 0xD3, 0x98, 0xD9, 0x1B, 0xA7, 0x58, 0x3D, 0x95, 0x58, 0x6D, 0x48, 0x56, 0xE8, 0x93, 0x99,
+    0x59, 0x1C, 0x5E, 0xBE, 0xF1, 0xAD, 0x17, 0xB1, 0x73, 0xAA, 0x14, 0x15, 0x31, 0xD3, 0xD0, 0xDC,
+    0x90, 0xC2, 0x91, 0x6C, 0x14, 0x93, 0xDF, 0xEA, 0x07, 0x70, 0x13, 0xD8, 0x1F, 0xCD, 0x54, 0x71,
+    0xC9, 0x44, 0x55, 0x97, 0x28, 0x98, 0x2E, 0x80, 0x5B, 0x34, 0x51, 0xEA, 0x0B, 0x1A, 0x68, 0x62,
+    0x25, 0x90, 0x6F, 0x22, 0x76, 0xC3, 0x2D, 0x68, 0x46, 0x73, 0x2D, 0x4A, 0xF9, 0x7E, 0xA1, 0x96,
+    0xD1, 0x40, 0xB3, 0xB9, 0x08, 0xEE, 0x6E, 0xAA, 0x56, 0x6E, 0x50, 0x2A, 0xC1, 0x47, 0xA9, 0x76,
+    0x9D, 0x62, 0x8F, 0x0E, 0xD0, 0x7A, 0x02, 0x1B, 0x92, 0xED, 0x1F, 0xD7, 0x93, 0x84, 0xE4, 0x27,
+    0x62, 0xF6, 0x0D, 0xD0, 0xA8, 0x4B, 0xB9, 0xB8, 0xFB, 0x53, 0x61, 0xA3, 0x0B, 0x85, 0x9E, 0x12,
+    0x6E, 0x6E, 0x43, 0x1D, 0x4B, 0x15, 0xEA, 0xDA, 0xE0, 0x42, 0xA1, 0x4F, 0x46, 0x9A, 0x45, 0x43,
+    0xA1, 0x31, 0x24, 0x34, 0x5D, 0x1A, 0xB0, 0x0A, 0x09, 0x1E, 0x3B, 0x85, 0x20, 0x76, 0xCF, 0xBB,
+    0xD5, 0xC4, 0xAC, 0x68, 0x6E, 0xCD, 0xFB, 0xF4, 0xF0, 0xD5, 0x63, 0x0F, 0x35, 0x65, 0xB0, 0x6C,
+    0x9C, 0xA9, 0x44, 0x25, 0x0A, 0xF9, 0x1C, 0x65, 0x18, 0x75, 0x09, 0x85, 0x2C, 0xE5, 0x29, 0xE5,
+    0xFB, 0x00, 0xCD, 0x96, 0x40, 0xCC, 0x3F, 0x4D, 0x79, 0xF6, 0x18, 0x4E, 0xE9, 0x48, 0x2D, 0x75,
+    0x70, 0x26, 0xBD, 0x7B, 0x35, 0x8B, 0x7B, 0x99, 0x20, 0x68, 0x97, 0x7D, 0x4A, 0xDA, 0xF7, 0x6C,
+    0xA9, 0x92, 0xD6, 0x24, 0x7D, 0x29, 0x92, 0xC0, 0xB7, 0xE2, 0xB4, 0x12, 0x99, 0xC5, 0x86, 0x5D,
+    0xB1, 0x2B, 0x2E, 0x20, 0x8F, 0x7C, 0xB5, 0x61, 0x84, 0x9B, 0xA9, 0x63, 0x29, 0x68, 0x43, 0xB3,
+    0xC0, 0xE8, 0x35, 0x50, 0xE8, 0x93, 0x11, 0xAA, 0xCD, 0x4D, 0xD0, 0xDC, 0xD3, 0x29, 0xF4, 0x93,
+    0x86, 0x03, 0x7D, 0xB3, 0x9A, 0x28, 0xCE, 0x7A, 0x9D, 0x75, 0x09, 0x32, 0xED, 0x25, 0xAD, 0xF9,
+    0x14, 0x0F, 0xE0, 0xC6, 0x9F, 0xC4, 0x36, 0x51, 0xAB, 0x72, 0xDD, 0xB4, 0x9F, 0xA1, 0x9F, 0x52,
+    0xB8, 0xB6, 0x40, 0xBB, 0x52, 0xED, 0x50, 0xC8, 0x17, 0x1A, 0xC0, 0x6E, 0xE9, 0xE3, 0x0A, 0x4D,
+    0x4A, 0xCB, 0x9E, 0xCE, 0x4E, 0x3E, 0xF3, 0x73, 0xB4, 0x70, 0x22, 0x34, 0xE4, 0x33, 0x4A, 0xEC,
+    0xFC, 0x0B, 0xB8, 0x66, 0x73, 0xB0, 0x4E, 0x32, 0x83, 0xE0, 0x00, 0x11, 0x73, 0x58, 0x92, 0x49,
+    0x2F, 0x7F, 0xAE, 0x09, 0xD0, 0xEA, 0x12, 0xA9, 0xCF, 0x24, 0x9E, 0xA7, 0x4F, 0xE1, 0x75, 0x40,
+    0x11, 0xB4, 0x61, 0x35, 0xD1, 0xAA, 0x63, 0x14, 0xE7, 0xC8, 0xDE, 0x29, 0xBF, 0x3B, 0xBA, 0x05,
+    0xC6, 0x8B, 0x7C, 0xCE, 0x89, 0x31, 0x33, 0xBA, 0x46, 0x7A, 0x68, 0xE6, 0x1E, 0x4C, 0xEC, 0x3B,
+    0x18, 0xC7, 0x0E, 0x9A, 0xB4, 0x8A, 0xC3, 0x81, 0x81, 0xF5, 0x01, 0xE8, 0x77, 0x32, 0x00, 0xD9,
+    0xBF, 0xBD, 0x40, 0xFF, 0x4D, 0x41, 0x3F, 0x8D, 0x9E, 0x7E, 0x6E, 0x56, 0xDC, 0x9C, 0x38, 0x70,
+    0xCF, 0x9C, 0x68, 0xE0, 0xB6, 0xA3, 0x95, 0xF4, 0xC6, 0xE6, 0x24, 0xBD, 0x19, 0x9D, 0xA4, 0xE7,
+    0xA2, 0x93, 0x54, 0xAD, 0xD4, 0x91, 0x7A, 0xC9, 0x0E, 0xD2, 0xAE, 0xD8, 0x40, 0x13, 0x68, 0x66,
+    0xDA, 0x40, 0x3B, 0xE1, 0x66, 0x9C, 0xC7, 0x4D, 0x19, 0x5D, 0xEE, 0x07, 0x46, 0xCF, 0xD8, 0xA1,
+    0x01, 0x51, 0xA8, 0x43, 0x94, 0xA2, 0xDC, 0x31, 0x3A, 0xFB, 0xF4, 0x7E, 0xCD, 0x48, 0xD2, 0x5A,
+    0x49, 0xD2, 0x52, 0x4B, 0x52, 0x48, 0x88, 0x8E, 0xD5, 0x09, 0x12, 0xF7, 0xE7, 0xB4, 0xDA, 0xB4,
+    0x1D, 0x59, 0x0E, 0xF3, 0x7A, 0x3C, 0x7A, 0xEB, 0xD6, 0x7F, 0xFE, 0x94, 0x14, 0xA2, 0x93, 0xEC,
+    0x60, 0x42, 0xB1, 0xD0, 0xE3, 0xA8, 0x67, 0x13, 0xD8, 0xF8, 0x3C, 0x8D, 0xAF, 0xA7, 0x32, 0x12,
+    0x71, 0x83, 0xF5, 0x66, 0x29, 0x56, 0x7A, 0x5A, 0x6A, 0x49, 0xDD, 0xF1, 0x75, 0x47, 0x35, 0x60,
+    0xCB, 0xDD, 0x04, 0x45, 0x04, 0x1E, 0xE9, 0x0A, 0xB8, 0x7C, 0xCD, 0x88, 0x7A, 0xAF, 0x76, 0xEA,
+    0x58, 0x6D, 0xD8, 0x58, 0x47, 0xEC, 0x6A, 0x57, 0x9A, 0xC5, 0x2E, 0xB4, 0xC1, 0x06, 0x5C, 0x68,
+    0x66, 0xDC, 0xDC, 0x4C, 0x8C, 0x53, 0x3B, 0x15, 0xF2, 0xED, 0x5C, 0x6B, 0x68, 0x24, 0x75, 0x56,
+    0x52, 0xE6, 0xE4, 0xDD, 0xFA, 0xFD, 0xFD, 0x20, 0x2F, 0xD5, 0xF1, 0x00, 0x37, 0xED, 0x7A, 0x70,
+    0x84, 0x9B, 0x70, 0x78, 0xB0, 0x84, 0x0D, 0xEF, 0x87, 0x56, 0x99, 0x78, 0xA0, 0x7C, 0x76, 0x05,
+    0x3E, 0x54, 0x6C, 0xEC, 0xAD, 0xB7, 0xDF, 0x58, 0x8B, 0xE8, 0xBA, 0xF6, 0xB9, 0x60, 0x96, 0x27,
+    0x70, 0xD5, 0x64, 0xC3, 0xE7, 0x2F, 0xEF, 0x46, 0xF2, 0x4E, 0x91, 0xEB, 0xFD, 0x80, 0x59, 0xC0,
+    0x25, 0x01, 0x1A, 0xBB, 0x0C, 0xEA, 0x63, 0x57, 0x68, 0xBB, 0x54, 0x62, 0x03, 0x1A, 0xCF, 0x66,
+    0x56, 0x5A, 0xEF, 0x30, 0xB1, 0x0A, 0xB8, 0x61, 0xA3, 0x5A, 0xAC, 0x47, 0xE5, 0x1A, 0x6D, 0x70,
+    0xCD, 0x1B, 0x7B, 0xF5, 0xDD, 0xB5, 0x9F, 0x5E, 0x73, 0x9F, 0x8A, 0xF5, 0xBD, 0x7B, 0xF2, 0x63,
+    0xDE, 0xAA, 0xCE, 0x49, 0x01, 0x6D, 0x23, 0xE5, 0x66, 0x67, 0x5C, 0xB7, 0x61, 0x42, 0xEB, 0xE9,
+    0x4D, 0xCC, 0xB2, 0x5B, 0x2D, 0x94, 0xC3, 0x43, 0x5D, 0x30, 0xD3, 0x1F, 0x94, 0xE1, 0x31, 0x62,
+    0xF3, 0x91, 0x27, 0xEA, 0xDF, 0x69, 0x9F, 0xFA, 0xDA, 0x67, 0xFD, 0xBD, 0xB7, 0x83, 0xD3, 0x6A,
+    0xB5, 0x31, 0x7E, 0x19, 0x5B, 0xFB, 0xEA, 0xCD, 0xB9, 0xF8, 0x2F, 0x16, 0x78, 0x25, 0x57, 0x93,
+    0xCF, 0x2F, 0xB8, 0x7E, 0xBF, 0x25, 0x0A, 0x07, 0xFE, 0xE9, 0x26, 0x60, 0x7C, 0x3B, 0xB1, 0x63,
+    0x02, 0x92, 0x96, 0x42, 0x1A, 0xD7, 0x52, 0x53, 0xB5, 0x1A, 0x75, 0x66, 0x35, 0x3B, 0xD5, 0x52,
+    0x45, 0xEA, 0xC5, 0x46, 0x6C, 0xB0, 0x2B, 0x4D, 0x68, 0x16, 0xDA, 0xD0, 0x06, 0xDC, 0xEC, 0x02,
+    0xFD, 0xE4, 0x02, 0xE3, 0xD4, 0xCF, 0xC8, 0x27, 0x23, 0x7B, 0x5E, 0x72, 0x47, 0x40, 0xB9, 0x1F,
+    0x94, 0x1C, 0x13, 0x39, 0x4A, 0xEE, 0x0B, 0x60, 0xFF, 0xB2, 0x4A, 0xEE, 0xFF, 0x5D, 0x07, 0xFC,
+    0xBD, 0x3B, 0xB4, 0x6B, 0x4A, 0x8E, 0xAB, 0x3D, 0x41, 0x23, 0x85, 0xDE, 0xA2, 0x4A, 0x34, 0x92,
+    0xBB, 0x4F, 0x6B, 0xAA, 0x62, 0x9D, 0x31, 0xEC, 0xAE, 0x97, 0x74, 0xE7, 0x1F, 0x8F, 0x33, 0x37,
+    0x94, 0xC3, 0xFF, 0x2B, 0x47, 0xF2, 0xE3, 0x72, 0x5E, 0xD0, 0xE8, 0x3C, 0xB7, 0xD8, 0x5F, 0x3C,
+    0xE8, 0xF0, 0xA7, 0x42, 0xC0, 0x91, 0x88, 0x25, 0x1F, 0x57, 0x7A, 0x30, 0xBA, 0xD3, 0x7D, 0x36,
+    0x63, 0x34, 0x5A, 0x32, 0x32, 0x7D, 0xD4, 0xAB, 0x8E, 0x72, 0xCA, 0x61, 0x30, 0x13, 0x54, 0x7C,
+    0x45, 0xDF, 0x87, 0x97, 0xA1, 0xBA, 0x63, 0x22, 0xA5, 0x64, 0xEF, 0xE0, 0xB4, 0xB7, 0xFA, 0xDE,
+    0xCE, 0x2B, 0x8D, 0xB4, 0x7C, 0x6C, 0x29, 0xC7, 0x53, 0x8D, 0xB3, 0x4B, 0x95, 0x81, 0x42, 0x2F,
+    0x5F, 0x3B, 0x10, 0xAD, 0x76, 0xE6, 0xAF, 0xC1, 0x78, 0xF7, 0x33, 0x21, 0xE3, 0x95, 0xA5, 0xB4,
+    0x1F, 0x06, 0xB9, 0x18, 0xEF, 0xF0, 0x1F, 0x77, 0xC0, 0x95, 0x3D, 0x29, 0xCE, 0xA8, 0xD5, 0x64,
+    0x76, 0xFF, 0xA0, 0x25, 0xB1, 0xE8, 0x5B, 0xED, 0x4F, 0x6A, 0x2E, 0x77, 0x93, 0x1D, 0x99, 0x6F,
+    0xD3, 0xCA, 0x84, 0xB4, 0x20, 0x8A, 0xA9, 0x25, 0xE2, 0x28, 0x45, 0x9E, 0xD7, 0xE3, 0x42, 0x2A,
+    0x16, 0xBD, 0x7C, 0xED, 0x44, 0xD5, 0x3D, 0xA2, 0xA7, 0x53, 0xB1, 0x3C, 0xF9, 0xA3, 0x09, 0x4A,
+    0x69, 0xB8, 0x12, 0xF2, 0x02, 0x9C, 0x72, 0xAF, 0x23, 0xE3, 0x1C, 0x4E, 0x20, 0x3E, 0xF5, 0x0F,
+    0xD3, 0xA3, 0x59, 0x2F, 0xEB, 0xFB, 0x64, 0xDB, 0x42, 0xE6, 0x42, 0x5D, 0x20, 0xBE, 0x92, 0xFB,
+    0x9A, 0x5E, 0x86, 0xCB, 0x3B, 0x23, 0xF4, 0x9A, 0xC6, 0x9B, 0xA5, 0xDE, 0x0E, 0xBD, 0xFE, 0xE7,
+    0x58, 0x2C, 0x8D, 0xB4, 0x7C, 0x6C, 0xE5, 0x46, 0xDA, 0xDA, 0x51, 0xA9, 0xA3, 0x4C, 0x2B, 0xE8,
+    0xD6, 0x19, 0x14, 0x99, 0xAE, 0x0C, 0x57, 0x29, 0xF4, 0xFD, 0xCF, 0x4C, 0x07, 0x15, 0x78, 0x94,
+    0x7C, 0xAE, 0x76, 0xDA, 0x37, 0xF4, 0x56, 0x06, 0xF5, 0x68, 0xBA, 0x0B, 0xE0, 0x6E, 0xF2, 0x38,
+    0x7F, 0x49, 0xEC, 0xF0, 0xFB, 0x89, 0x98, 0x2B, 0x7D, 0xAE, 0x73, 0xE8, 0xF9, 0xD1, 0x9F, 0x52,
+    0xBB, 0xF9, 0xC4, 0x66, 0x0E, 0xA7, 0x86, 0x83, 0x23, 0x09, 0xBC, 0xFC, 0x0B, 0x11, 0xEE, 0x7E,
+    0xFE, 0x8F, 0x82, 0xD5, 0x9E, 0xE1, 0x1E, 0x23, 0x75, 0x69, 0xDF, 0x07, 0x25, 0x86, 0x2B, 0x0A,
+    0x4E, 0xF3, 0xB8, 0x00, 0xED, 0xD6, 0x28, 0xF4, 0x0B, 0x50, 0xE9, 0x8B, 0x8A, 0x29, 0xF6, 0xD5,
+    0x0F, 0xB5, 0xA5, 0x62, 0x5D, 0x1B, 0x47, 0xB9, 0x4C, 0xFC, 0x1E, 0x75, 0x3B, 0x9E, 0xCA, 0x07,
+    0xF1, 0x54, 0xC4, 0xD9, 0x4E, 0xE5, 0xA9, 0xED, 0xD4, 0x46, 0xB1, 0x9F, 0x4A, 0xE6, 0xF9, 0xAF,
+    0x4A, 0x07, 0x0F, 0xA0, 0xBE, 0xAF, 0x5C, 0xB1, 0x9F, 0x93, 0x8D, 0xE7, 0xE3, 0x80, 0xE9, 0x38,
+    0xBD, 0xBE, 0x26, 0x97, 0x59, 0xB4, 0x6F, 0xEA, 0x4B, 0x4A, 0x55, 0xD5, 0xD7, 0x35, 0x49, 0x9E,
+    0x42, 0xF2, 0x63, 0x68, 0x12, 0x6D, 0xC0, 0xBB, 0x68, 0xA4, 0xC1, 0x48, 0xDE, 0xEE, 0xF4, 0x3A,
+    0x6A, 0x74, 0x8F, 0x0C, 0x65, 0xE6, 0x9E, 0xB5, 0x7F, 0x76, 0x63, 0x39, 0x55, 0x9D, 0x4E, 0xEA,
+    0x7F, 0x18, 0x04, 0x7B, 0xA2, 0x28, 0x14, 0xE3, 0xFC, 0xCB, 0x2D, 0xFB, 0xF5, 0x17, 0x2E, 0xBF,
+    0xC4, 0xA3, 0x37, 0x1F, 0x7A, 0x19, 0x17, 0xAB, 0x8D, 0x7E, 0x72, 0x2B, 0xCD, 0x56, 0xED, 0xC8,
+    0x6B, 0xC6, 0xCA, 0xEC, 0xE8, 0x29, 0x0D, 0x18, 0x3D, 0xA7, 0x52, 0x76, 0x87, 0x42, 0xDF, 0x94,
+    0xD9, 0xDD, 0x0A, 0x8C, 0x3F, 0x52, 0x1D, 0x35, 0x03, 0xEE, 0xAE, 0xEC, 0xBD, 0xA3, 0x84, 0x9B,
+    0x89, 0x0E, 0xB5, 0xD4, 0x1F, 0x25, 0x5B, 0x8D, 0x59, 0x70, 0x0E, 0x3D, 0x4C, 0x7F, 0x9D, 0x56,
+    0x3A, 0x13, 0xFA, 0x8F, 0x8A, 0x4E, 0x71, 0x98, 0x04, 0x6A, 0x6D, 0xDA, 0x94, 0x82, 0xD0, 0x77,
+    0x14, 0xFB, 0xB4, 0x94, 0xCF, 0x6A, 0x6D, 0x15, 0xA8, 0xB5, 0x17, 0x5A, 0xAC, 0x22, 0x4E, 0x6B,
+    0xA1, 0x50, 0x25, 0xC0, 0xC6, 0xBB, 0x85, 0x72, 0x33, 0x1A, 0xB0, 0xA1, 0x5D, 0xA1, 0x7F, 0x43,
+    0x03, 0x66, 0x6F, 0x22, 0xD8, 0x77, 0xE4, 0x61, 0xFC, 0x5A, 0x04, 0xB3, 0x27, 0x13, 0xB3, 0x01,
+    0xA3, 0xA6, 0x23, 0x60, 0x4C, 0x09, 0xC7, 0x98, 0x08, 0x1D, 0x12, 0x34, 0x77, 0x25, 0x18, 0xBD,
+    0xDB, 0x30, 0xA2, 0x8D, 0x34, 0x29, 0x88, 0x9E, 0x90, 0x4F, 0x05, 0xBC, 0x76, 0xA5, 0x89, 0x68,
+    0x62, 0x9C, 0x8C, 0x72, 0xDA, 0xD6, 0xAF, 0xC0, 0xED, 0x44, 0x07, 0x49, 0xEC, 0xDB, 0x89, 0xC4,
+    0x7D, 0xCB, 0x25, 0x8E, 0xC4, 0xA0, 0x78, 0xE8, 0x13, 0x2F, 0xD1, 0x3E, 0xBD, 0xE0, 0xEC, 0xCC,
+    0xE7, 0xDD, 0xC0, 0xAB, 0x82, 0x3D, 0x52, 0x28, 0x50, 0xCA, 0x63, 0x34, 0x50, 0x29, 0x62, 0xFF,
+    0x5C, 0x58, 0xDF, 0x77, 0xAD, 0x6F, 0x07, 0x37, 0xB4, 0x83, 0xEB, 0xDC, 0x30, 0xD2, 0xA7, 0xC2,
+    0x8E, 0x4B, 0x7C, 0x3F, 0xFA, 0x01, 0x3E, 0x7A, 0x08, 0x6C, 0x87, 0x51, 0xE6, 0x7F, 0x26, 0xE4,
+    0x54, 0x0B, 0xB8, 0x3B, 0x9F, 0x8D, 0xA9, 0xB8, 0x02, 0x95, 0x12, 0x73, 0xA6, 0x1B, 0x27, 0x90,
+    0x77, 0x01, 0xFA, 0xD9, 0x46, 0x68, 0x97, 0x6A, 0x4F, 0x6F, 0xEA, 0xA8, 0x76, 0xE4, 0x29, 0xD5,
+    0xF5, 0x33, 0xC8, 0xB7, 0xCB, 0xF1, 0x26, 0x17, 0x2A, 0x81, 0x8D, 0xA5, 0x06, 0xEA, 0x1D, 0xFD,
+    0x59, 0xE7, 0x84, 0xD3, 0xD4, 0xC8, 0xB7, 0x0A, 0xB5, 0xBC, 0xD5, 0x62, 0xE4, 0x73, 0xAD, 0x3E,
+    0x27, 0xDE, 0x3B, 0xA7, 0xD2, 0x6D, 0x95, 0xF3, 0x5C, 0x0F, 0x14, 0x67, 0x57, 0x33, 0x05, 0xB0,
+    0x4C, 0xA5, 0xE2, 0x19, 0xF7, 0xD4, 0x42, 0xE3, 0x23, 0xF5, 0x3C, 0x62, 0x16, 0x37, 0x14, 0xD1,
+    0x4E, 0xBC, 0x56, 0x05, 0xDC, 0x93, 0x91, 0xC6, 0xEF, 0xD8, 0xB9, 0xEF, 0xCC, 0xD2, 0xFA, 0x3A,
+    0x5A, 0x55, 0xBB, 0xD1, 0x17, 0xF6, 0x52, 0x3E, 0xD1, 0x88, 0x6D, 0x48, 0x51, 0x40, 0xB5, 0x92,
+    0xC0, 0xCE, 0x88, 0x8D, 0xD0, 0xCF, 0xB8, 0x40, 0xA9, 0xAE, 0xB8, 0x0F, 0x14, 0x76, 0xE1, 0x7D,
+    0x01, 0xE0, 0x42, 0xBE, 0xD0, 0x94, 0x00, 0x60, 0x70, 0x2B, 0x2E, 0x52, 0x68, 0xCA, 0x58, 0x66,
+    0x95, 0x40, 0xE1, 0xF6, 0x02, 0x28, 0x7C, 0x02, 0x80, 0x2F, 0x80, 0xC2, 0xDE, 0x24, 0x57, 0x9F,
+    0x51, 0x4B, 0xAD, 0x54, 0x9A, 0x8C, 0x26, 0x5A, 0xF9, 0x46, 0x20, 0x25, 0xA8, 0x32, 0x9E, 0xE7,
+    0x6A, 0x09, 0x52, 0xCF, 0x34, 0xB1, 0x5C, 0x8C, 0xC8, 0xDA, 0xEE, 0x92, 0x06, 0x15, 0x1D, 0x0F,
+    0x00, 0xC5, 0x19, 0x23, 0x1E, 0xA9, 0x13, 0x46, 0xCC, 0x4E, 0x33, 0x17, 0x1B, 0xED, 0x64, 0x22,
+    0x2E, 0x61, 0xC4, 0x95, 0xA4, 0xE1, 0x1C, 0x28, 0x6E, 0xDE, 0xFD, 0x4D, 0xD1, 0x86, 0x52, 0xB8,
+    0xD9, 0xA8, 0x73, 0x53, 0x95, 0x78, 0x8C, 0x07, 0xB5, 0xBC, 0xDF, 0x0F, 0x61, 0xBD, 0x7E, 0xF3,
+    0xAF, 0xE2, 0x2A, 0xFA, 0xB4, 0x8A, 0xE9, 0xB9, 0x35, 0xAD, 0x62, 0xEE, 0xDE, 0x0A, 0xE7, 0xB9,
+    0x70, 0x0E, 0x0F, 0x32, 0xC2, 0x64, 0x73, 0x3A, 0x18, 0xCE, 0xE5, 0xEF, 0xFE, 0x37, 0x9C, 0xDA,
+    0x95, 0xEF, 0xC3, 0xE0, 0x2F, 0xAC, 0xEF, 0x07, 0xC1, 0xE0, 0x87, 0xFB, 0x31, 0x78, 0xDC, 0x9C,
+    0x72, 0xBD, 0xD3, 0xFA, 0x96, 0xDB, 0x29, 0x63, 0x08, 0x07, 0x25, 0xE7, 0xE1, 0x8E, 0x02, 0xCA,
+    0x33, 0x23, 0xAA, 0xDD, 0x88, 0x7A, 0x3B, 0x25, 0x33, 0x39, 0xA3, 0x59, 0x68, 0x82, 0x0D, 0x39,
+    0xA3, 0x99, 0x9B, 0x99, 0x71, 0x6A, 0xA6, 0x42, 0xBE, 0x99, 0x6B, 0xF9, 0xE6, 0xB4, 0xAF, 0xC9,
+    0x69, 0x5D, 0xFF, 0xF9, 0xC9, 0x4C, 0xEE, 0x78, 0x9F, 0xB2, 0x0E, 0x1A, 0xF9, 0x0C, 0x13, 0xD5,
+    0x01, 0x2E, 0x77, 0x0F, 0xDB, 0xE1, 0x09, 0xCB, 0xE3, 0x1F, 0xE7, 0x99, 0xC7, 0x88, 0xCF, 0xB0,
+    0xFE, 0x1B, 0xB3, 0xFC, 0x41, 0x13, 0x46, 0x85, 0x5E, 0x73, 0xF3, 0xA3, 0x89, 0x6A, 0xC2, 0x2E,
+    0xD8, 0x80, 0x0D, 0xD8, 0x19, 0x3B, 0xD1, 0xFA, 0x9C, 0x14, 0x17, 0x0A, 0xA0, 0x40, 0x2D, 0x9F,
+    0x20, 0x79, 0x81, 0xDB, 0x29, 0xB4, 0x61, 0xB4, 0x50, 0x6B, 0xA1, 0xD1, 0x84, 0xD3, 0x4C, 0x2A,
+    0x5E, 0x0D, 0x75, 0xEA, 0x61, 0xA4, 0xD7, 0x8C, 0x53, 0x34, 0x09, 0xD6, 0x0B, 0x6D, 0x6A, 0x9C,
+    0x7D, 0x5D, 0x0A, 0xB4, 0x3F, 0xD1, 0xA7, 0x76, 0x0D, 0xE8, 0xDB, 0xFB, 0xF8, 0xF6, 0x46, 0xB5,
+    0x3B, 0xC9, 0x2D, 0xB4, 0xAB, 0xF4, 0x63, 0x79, 0xF4, 0x4D, 0xE9, 0x6B, 0xC2, 0xC8, 0x6A, 0x73,
+    0x2B, 0x6D, 0x74, 0xFA, 0xA1, 0x26, 0x14, 0x24, 0x2B, 0x8C, 0xBE, 0xA0, 0xB5, 0x8F, 0x34, 0x5B,
+    0xAD, 0x37, 0x34, 0xA3, 0xD0, 0x6C, 0x56, 0x9D, 0x91, 0xEF, 0x43, 0x1F, 0x69, 0x54, 0xE8, 0x49,
+    0x05, 0xC6, 0x35, 0xE3, 0x3D, 0xE7, 0x62, 0x74, 0x70, 0x32, 0x8F, 0x38, 0xF3, 0x60, 0x58, 0xDA,
+    0xA3, 0xDF, 0x7A, 0xC9, 0xEF, 0x4E, 0x9F, 0x4A, 0x66, 0xEE, 0x81, 0x77, 0xD9, 0x80, 0xF3, 0xA5,
+    0xBA, 0x3A, 0xE2, 0x96, 0x42, 0x83, 0xD1, 0xE0, 0x56, 0xFA, 0xB5, 0x56, 0x57, 0xCB, 0x2B, 0xA0,
+    0xE8, 0x44, 0xA3, 0xAF, 0x6A, 0x2E, 0xEF, 0x6E, 0xFB, 0x86, 0xBB, 0xAD, 0xB7, 0xBD, 0xF9, 0xB1,
+    0x7E, 0x12, 0x19, 0x9B, 0xBD, 0x1F, 0xEC, 0x3B, 0xFA, 0xEA, 0x8A, 0x9A, 0x55, 0x5D, 0x33, 0xAB,
+    0x09, 0x66, 0xB3, 0xDF, 0x10, 0xCE, 0x67, 0x9E, 0xC9, 0xE8, 0xCF, 0x49, 0xB8, 0x1C, 0x9D, 0x14,
+    0x09, 0xA7, 0x48, 0x3D, 0x9D, 0x33, 0x34, 0x0B, 0xA3, 0x37, 0xC2, 0xAE, 0xF4, 0x53, 0x29, 0xEA,
+    0x88, 0x9B, 0x51, 0x57, 0x45, 0xDA, 0x80, 0x06, 0xB3, 0xD1, 0x04, 0x46, 0x6F, 0x76, 0xEC, 0x42,
+    0xEF, 0x4B, 0x61, 0x23, 0x6E, 0x2E, 0x92, 0x1A, 0x95, 0x2F, 0xF2, 0xE8, 0x85, 0xD8, 0x30, 0x07,
+    0x86, 0x47, 0x54, 0x98, 0xE3, 0xA0, 0x9F, 0x19, 0x0F, 0x26, 0xAA, 0x53, 0x46, 0x2E, 0x8F, 0xE5,
+    0xAB, 0x0F, 0x9C, 0x3D, 0x75, 0x3E, 0x25, 0x05, 0x2E, 0xF7, 0x4C, 0x00, 0xCC, 0x2C, 0x9A, 0x2F,
+    0xA5, 0xAA, 0xD2, 0x1B, 0xC9, 0xA9, 0x4E, 0xE9, 0x04, 0x42, 0x9B, 0x92, 0xCD, 0x7A, 0x03, 0x9A,
+    0xB5, 0xC8, 0x6D, 0x07, 0xFD, 0x0C, 0xB5, 0xCE, 0x6E, 0xAC, 0xA7, 0x4C, 0x28, 0x97, 0xAD, 0xCB,
+    0x1C, 0x57, 0xE4, 0xA0, 0x22, 0xF7, 0x48, 0x8F, 0x81, 0x42, 0x13, 0x6E, 0x85, 0x7E, 0xC5, 0x45,
+    0x68, 0x76, 0x12, 0x53, 0xCF, 0xA7, 0x46, 0x85, 0x6B, 0x60, 0x43, 0xB9, 0x1D, 0xA8, 0x91, 0x55,
+    0x66, 0x43, 0x4F, 0xB9, 0x48, 0xFF, 0x53, 0x09, 0xC4, 0xFD, 0x4D, 0x8E, 0x8A, 0x75, 0xFA, 0x90,
+    0xBB, 0xAB, 0x05, 0xC6, 0xA1, 0x0D, 0xB0, 0xD3, 0x04, 0xCA, 0x48, 0x13, 0x30, 0x0B, 0xCD, 0x4C,
+    0x15, 0x68, 0x26, 0xEC, 0x44, 0x3B, 0x61, 0x3D, 0xCE, 0x63, 0x3D, 0xA3, 0xA7, 0xF9, 0xB3, 0xCF,
+    0xC8, 0xD3, 0xA4, 0xC6, 0xEA, 0xD3, 0xEF, 0x2E, 0xC7, 0x25, 0x8C, 0x6F, 0x1D, 0x65, 0x8B, 0xCB,
+    0x2F, 0x00, 0x36, 0x38, 0x0F, 0xF4, 0x6F, 0x24, 0x2E, 0x84, 0x8D, 0x40, 0x13, 0xFB, 0x19, 0x48,
+    0x08, 0xE3, 0xFB, 0x37, 0x72, 0xEB, 0xE2, 0xCE, 0x28, 0x5C, 0xD8, 0x98, 0x3E, 0x03, 0xF0, 0x89,
+    0x2D, 0xF1, 0xF6, 0x7A, 0xBE, 0x2D, 0x76, 0x1D, 0xFD, 0x69, 0x57, 0xAA, 0xAD, 0x8E, 0xA7, 0x4D,
+    0x29, 0xC5, 0x38, 0x9D, 0xF6, 0x44, 0xBE, 0xDA, 0x4F, 0x5B, 0xE2, 0x4E, 0x18, 0x7D, 0x06, 0xEC,
+    0x75, 0x6C, 0x88, 0x4D, 0x79, 0x6C, 0xDA, 0x8F, 0x14, 0xF2, 0x0C, 0x69, 0x3B, 0x4A, 0xCD, 0xD0,
+    0x47, 0xA0, 0xB8, 0x56, 0x5C, 0x03, 0x17, 0xDC, 0x4C, 0xA1, 0x67, 0x35, 0x60, 0x77, 0xBB, 0x81,
+    0x5B, 0xFA, 0x85, 0x52, 0x6F, 0xC8, 0x63, 0x65, 0xF5, 0x53, 0x05, 0xB0, 0x79, 0xEB, 0xB4, 0x21,
+    0x4E, 0x9A, 0x30, 0xBA, 0xAD, 0x8E, 0x76, 0xAE, 0x63, 0xDE, 0x8F, 0x3A, 0xD0, 0x7B, 0x5C, 0x57,
+    0xEC, 0x14, 0x91, 0x6A, 0xC9, 0xDB, 0xE1, 0x40, 0x10, 0xA9, 0x23, 0xD5, 0x9D, 0xDF, 0x54, 0xC8,
+    0xBB, 0xE1, 0x8E, 0x9A, 0xCC, 0x72, 0x4A, 0xE8, 0x4E, 0x65, 0x91, 0xB3, 0x5B, 0xB7, 0x92, 0x47,
+    0x2F, 0x8E, 0xF4, 0x3C, 0x45, 0xB8, 0xE1, 0xC4, 0x87, 0x4A, 0xCD, 0xAD, 0xDA, 0x8F, 0x34, 0xFF,
+    0x08, 0xF0, 0xCB, 0xD3, 0x5F, 0xD5, 0x76, 0xE4, 0x59, 0xCD, 0x3B, 0x87, 0x73, 0x72, 0x5F, 0xD7,
+    0xB7, 0x12, 0x86, 0xAA, 0x2F, 0xE4, 0x20, 0xBA, 0x54, 0xEE, 0x43, 0xA6, 0xDE, 0xCA, 0x1C, 0x4E,
+    0x37, 0xAB, 0x39, 0x6A, 0xAB, 0xA1, 0x3A, 0xD8, 0x53, 0x3E, 0xF7, 0xBD, 0x9E, 0x00, 0x02, 0xEA,
+    0xD3, 0x5F, 0x8D, 0x24, 0x9D, 0x9D, 0x75, 0x29, 0x69, 0x3E, 0x05, 0x8D, 0xE9, 0x2F, 0xA3, 0x6F,
+    0x9D, 0x8D, 0xB9, 0x13, 0x32, 0xD5, 0xF7, 0x3C, 0xED, 0x46, 0x2E, 0xBB, 0xF4, 0x2B, 0xC5, 0xFD,
+    0x0D, 0xF8, 0x17, 0x4B, 0x43, 0x7B, 0xC7, 0x8D, 0x09, 0x9C, 0x74, 0xFB, 0xD8, 0x78, 0x05, 0xDC,
+    0x5D, 0x69, 0x69, 0xE6, 0x72, 0x67, 0xDC, 0xB1, 0xDE, 0xCE, 0x85, 0xDE, 0xBD, 0x2D, 0x46, 0x2A,
+    0x49, 0xD1, 0x2C, 0x89, 0x71, 0xD2, 0xE4, 0xFE, 0xFE, 0x8D, 0x52, 0x77, 0x9F, 0xEF, 0x4C, 0xC8,
+    0xFE, 0xCB, 0xA7, 0x06, 0xCE, 0xFE, 0xF9, 0x1B, 0x5A, 0xF8, 0x78, 0x2E, 0x96, 0x2D, 0x26, 0x9F,
+    0x6E, 0x2A, 0x9A, 0xE5, 0xB6, 0x70, 0xAD, 0xD4, 0x7B, 0x57, 0xA4, 0xF4, 0x9E, 0x4B, 0x1D, 0x57,
+    0x81, 0x66, 0xAA, 0x12, 0x09, 0x35, 0xD3, 0x8A, 0x8F, 0x00, 0x2B, 0xD9, 0x9C, 0x64, 0xBF, 0x7F,
+    0xDE, 0x24, 0x89, 0x34, 0xFB, 0x20, 0xD3, 0x1B, 0xF3, 0xF4, 0x83, 0xCC, 0xC3, 0x3D, 0x8A, 0x4B,
+    0x79, 0xF4, 0x46, 0x36, 0x7B, 0xB9, 0x70, 0x9A, 0x1A, 0xDE, 0xF3, 0x10, 0x84, 0x3C, 0x05, 0x21,
+    0xD3, 0x26, 0x32, 0x0D, 0x36, 0x23, 0x3F, 0xB9, 0xE3, 0x39, 0x75, 0xED, 0x1F, 0xF3, 0x3B, 0xD2,
+    0x30, 0x84, 0xCC, 0xE9, 0xCE, 0xE5, 0xFA, 0xA3, 0xFC, 0x7A, 0xA1, 0x0A, 0xEB, 0x39, 0x1F, 0x89,
+    0xF0, 0xDE, 0xDE, 0xC5, 0xFA, 0x20, 0xF3, 0xF8, 0x54, 0xFC, 0xFA, 0x45, 0x7E, 0xAE, 0xDC, 0x49,
+    0x27, 0x3A, 0xE4, 0xA6, 0x39, 0xDA, 0xB5, 0x0A, 0xD0, 0x4F, 0xE5, 0x02, 0xFA, 0x9F, 0xC6, 0x24,
+    0x0B, 0x6B, 0x66, 0x79, 0x56, 0x99, 0xFA, 0x7A, 0xEB, 0xEC, 0x54, 0x73, 0x5A, 0x72, 0x14, 0x76,
+    0x39, 0xB5, 0xD5, 0xFA, 0xDC, 0x3D, 0x67, 0x74, 0x4C, 0x85, 0x80, 0xC4, 0x31, 0x3B, 0x51, 0xDA,
+    0x34, 0x40, 0x2F, 0xC5, 0xA3, 0xB2, 0xAC, 0xD3, 0xC8, 0x87, 0xB9, 0x90, 0xA4, 0x50, 0x2E, 0x5C,
+    0x51, 0x28, 0x4E, 0xED, 0xE1, 0x47, 0x85, 0xED, 0x8A, 0x12, 0xE4, 0xA4, 0xA3, 0x86, 0xE9, 0x5B,
+    0x49, 0x1A, 0x92, 0xD9, 0x69, 0xBF, 0x85, 0xDD, 0x69, 0xA6, 0xD4, 0xC5, 0x5B, 0x2A, 0x60, 0x35,
+    0xCA, 0x67, 0xBB, 0x9A, 0x38, 0x47, 0x5C, 0xD9, 0xCF, 0x4D, 0xFB, 0xE5, 0xFF, 0xED, 0x26, 0x97,
+    0xA5, 0x25, 0x61, 0x8A, 0xCA, 0xD4, 0xB8, 0xB9, 0xE9, 0xAE, 0x24, 0x30, 0x3F, 0xD5, 0xD8, 0x2E,
+    0xFD, 0xE3, 0x71, 0x1E, 0x25, 0x19, 0x49, 0xAB, 0x4D, 0x53, 0x53, 0xFE, 0x17, 0xF1, 0x2A, 0x4D,
+    0x28, 0xB6, 0x52, 0x9D, 0x91, 0x16, 0x8C, 0x94, 0xDB, 0x0F, 0x0F, 0x57, 0xF1, 0xEC, 0x0E, 0xE8,
+    0xA9, 0x0D, 0x0A, 0x3D, 0x1D, 0x0F, 0xD3, 0x5D, 0xA9, 0x89, 0x70, 0xF9, 0xD6, 0x23, 0x2F, 0xFD,
+    0x8C, 0x56, 0x94, 0xBF, 0x32, 0x0B, 0xC4, 0xF5, 0xEF, 0x93, 0x56, 0xA8, 0x3C, 0xCE, 0x23, 0x24,
+    0x23, 0x99, 0xD7, 0x28, 0x7D, 0x71, 0xB5, 0xC2, 0xD9, 0x57, 0x76, 0x46, 0x49, 0x49, 0x68, 0x73,
+    0xEB, 0xD5, 0xDD, 0x3E, 0xF0, 0x2A, 0x4D, 0xA0, 0x99, 0xDA, 0x25, 0xA3, 0x8A, 0x4E, 0x21, 0xAF,
+    0x94, 0xF3, 0x82, 0x36, 0x8C, 0x03, 0x76, 0x75, 0x33, 0xD5, 0xDE, 0x2C, 0x18, 0x7D, 0x6A, 0x83,
+    0x5B, 0x5F, 0xB8, 0x95, 0x77, 0xE8, 0x85, 0x47, 0x86, 0xA3, 0xB9, 0xC8, 0x9E, 0xCC, 0x69, 0x7D,
+    0x30, 0xC5, 0x53, 0x4F, 0x2D, 0xA9, 0xCD, 0x22, 0xBF, 0xD1, 0x2D, 0x17, 0xC3, 0xFE, 0x5F, 0xFE,
+    0xC7, 0xC8, 0x3B, 0x2D, 0x95, 0x86, 0x84, 0x65, 0x25, 0x06, 0x63, 0xB3, 0x19, 0xED, 0x39, 0xC4,
+    0x7E, 0x5D, 0x7A, 0x2A, 0x91, 0x39, 0x42, 0xAF, 0x37, 0x52, 0xD5, 0x72, 0x6B, 0xF5, 0x1D, 0x4D,
+    0x80, 0xD1, 0xEF, 0xEA, 0x9D, 0xDC, 0x96, 0xFE, 0x23, 0xC5, 0x3C, 0x80, 0x60, 0xD3, 0x96, 0x5C,
+    0x82, 0x39, 0x79, 0x90, 0xDC, 0x3E, 0xCB, 0x39, 0x37, 0x2F, 0xBF, 0xBC, 0x9C, 0x58, 0x27, 0xE7,
+    0xC8, 0x51, 0x3C, 0x67, 0x69, 0x0C, 0x07, 0xB7, 0x36, 0x93, 0x6B, 0xC7, 0xD3, 0xA0, 0x18, 0x5D,
+    0x40, 0x5D, 0xFA, 0xED, 0x80, 0x4B, 0x9B, 0xDD, 0x65, 0x5B, 0x51, 0xEB, 0xA9, 0x54, 0x50, 0xDF,
+    0x8D, 0xFC, 0xA8, 0x99, 0x5A, 0x3B, 0x9A, 0xAD, 0x36, 0x1A, 0xED, 0xF4, 0x4B, 0xA9, 0xD3, 0x4A,
+    0x3E, 0x72, 0xF3, 0x7A, 0x96, 0x0A, 0x37, 0x1D, 0xD4, 0xE9, 0x3C, 0x40, 0xE9, 0x3C, 0x8C, 0x03,
+    0xF4, 0xA6, 0x8E, 0x4D, 0xFA, 0xAA, 0x7E, 0xB9, 0x75, 0x1F, 0x97, 0x6A, 0xC3, 0x4D, 0xCD, 0x96,
+    0x11, 0x2C, 0xDF, 0x2F, 0x34, 0x7B, 0xB5, 0xA3, 0x67, 0x35, 0x51, 0xCB, 0xEC, 0x85, 0x9E, 0x52,
+    0x87, 0xD1, 0x9B, 0x2A, 0x75, 0x54, 0x5C, 0xCD, 0xE6, 0x96, 0x13, 0x82, 0x35, 0x01, 0x6E, 0x97,
+    0xBD, 0x77, 0xF4, 0xEB, 0xE4, 0x02, 0xE3, 0xCF, 0x46, 0xB0, 0x8A, 0xD3, 0x0A, 0xD6, 0x17, 0xBC,
+    0xFA, 0xFB, 0x20, 0x58, 0x77, 0x14, 0x33, 0x82, 0xF5, 0x9D, 0x0F, 0x86, 0x60, 0xD9, 0xE0, 0x3C,
+    0x85, 0xD2, 0x7C, 0x19, 0x0D, 0x54, 0x7B, 0xB3, 0x82, 0xBE, 0xA9, 0x8E, 0x87, 0x5E, 0x7A, 0xF4,
+    0x85, 0x0F, 0xBA, 0x32, 0x8F, 0x28, 0x71, 0x33, 0x86, 0x44, 0x0A, 0xC6, 0xFE, 0xE0, 0x76, 0x38,
+    0x95, 0x2B, 0x6D, 0x38, 0xA2, 0xBF, 0x42, 0x13, 0x8C, 0x89, 0xF1, 0xBA, 0x92, 0xA8, 0xC1, 0x5C,
+    0xFA, 0xCA, 0x76, 0x4E, 0x17, 0xD0, 0xC9, 0x99, 0x55, 0xA2, 0x78, 0xEB, 0xB2, 0xE6, 0x24, 0x5C,
+    0xE6, 0x08, 0x86, 0xE6, 0x1C, 0x5B, 0x5D, 0xD6, 0x05, 0x76, 0xC8, 0xAD, 0xF2, 0x25, 0x50, 0x15,
+    0x93, 0x22, 0x9A, 0xDD, 0xAE, 0xD4, 0x7B, 0xBB, 0x62, 0xD3, 0xD2, 0x1F, 0xD1, 0x73, 0xBF, 0xE5,
+    0xDE, 0xC3, 0xE2, 0xA6, 0xED, 0x52, 0x6D, 0x33, 0xD1, 0x9C, 0x1F, 0xDD, 0x0F, 0x52, 0x43, 0x6A,
+    0xC2, 0x89, 0x79, 0x50, 0xCE, 0x87, 0xCB, 0x98, 0x19, 0xBD, 0x4E, 0x21, 0x63, 0x77, 0x57, 0xCE,
+    0x9B, 0x5D, 0x7A, 0xC9, 0x97, 0xB9, 0xB2, 0x17, 0x79, 0xE4, 0xD6, 0x18, 0x12, 0x82, 0x41, 0xBF,
+    0xA4, 0xB6, 0x80, 0x42, 0x21, 0x77, 0xC7, 0x8C, 0x7B, 0x6E, 0xC2, 0x7B, 0x68, 0x3C, 0x15, 0x90,
+    0x9A, 0xDC, 0x53, 0xF6, 0x91, 0x6A, 0xA3, 0x9E, 0xFB, 0x40, 0x4E, 0xAE, 0x23, 0x4D, 0xAA, 0x8F,
+    0x6C, 0x70, 0x79, 0x1F, 0x80, 0x8F, 0xDD, 0xBA, 0x35, 0x98, 0xCC, 0xD1, 0x99, 0x72, 0x97, 0xE1,
+    0xE8, 0xD3, 0xF7, 0xB4, 0x29, 0x9B, 0x48, 0x6D, 0x08, 0xCA, 0x13, 0xE4, 0xB2, 0xF3, 0xCC, 0x33,
+    0x32, 0xA8, 0x22, 0x1F, 0x42, 0xDE, 0x04, 0xB7, 0x96, 0x92, 0x18, 0xA5, 0xB9, 0x4C, 0x03, 0x7D,
+    0x76, 0xA8, 0xF7, 0x07, 0x53, 0x8B, 0x4B, 0xD7, 0xC7, 0x4C, 0x44, 0x3B, 0x59, 0xFD, 0x94, 0x15,
+    0xD0, 0xFD, 0xB4, 0xB0, 0xFE, 0xAF, 0xF4, 0x68, 0x05, 0xE0, 0x23, 0x70, 0x5D, 0x27, 0xC7, 0xE2,
+    0xA4, 0x8D, 0x52, 0xBA, 0xF5, 0xB3, 0x25, 0xDC, 0x44, 0x6C, 0xA4, 0x99, 0xD1, 0x9C, 0xFA, 0x47,
+    0x4D, 0x64, 0x8C, 0xD8, 0x50, 0x2B, 0xD0, 0x0F, 0xA3, 0x86, 0xD4, 0x41, 0x6A, 0x43, 0xFF, 0x76,
+    0x48, 0x2D, 0xA4, 0xC5, 0xDE, 0x7F, 0x67, 0xA7, 0xBE, 0x27, 0xBB, 0xE2, 0x14, 0xDC, 0x94, 0x9A,
+    0x48, 0x6B, 0x85, 0x3A, 0xE2, 0xD4, 0xB9, 0x19, 0x2D, 0x85, 0xBA, 0x4A, 0x5D, 0x1D, 0x79, 0xE4,
+    0x25, 0x92, 0x92, 0x5D, 0x2F, 0x5E, 0x3A, 0x25, 0x56, 0xD9, 0x9B, 0xB8, 0x20, 0x4F, 0x56, 0xC8,
+    0xFB, 0xF2, 0xAA, 0x14, 0xEB, 0x99, 0x1D, 0x6E, 0xBD, 0x40, 0x3F, 0xD1, 0x6C, 0xD4, 0x91, 0x4A,
+    0x3E, 0x73, 0xF7, 0xEC, 0x8A, 0xD3, 0x50, 0xA8, 0xAB, 0xB5, 0x24, 0x8E, 0x1B, 0x66, 0xA7, 0x57,
+    0xA0, 0x9F, 0xAC, 0x76, 0xEA, 0x68, 0xA4, 0x09, 0x79, 0xBD, 0x1D, 0xB1, 0x6B, 0xFB, 0x13, 0xF9,
+    0x42, 0x4F, 0x6F, 0x6E, 0xC5, 0xBD, 0xA3, 0x2F, 0xA9, 0x33, 0x72, 0x41, 0x81, 0xFE, 0xED, 0xD8,
+    0x88, 0x5A, 0x7A, 0x52, 0x33, 0xD2, 0xEC, 0x36, 0xAC, 0x62, 0x2D, 0x5F, 0x4A, 0x28, 0x26, 0x0C,
+    0x76, 0x30, 0x5A, 0x4B, 0x2D, 0xF4, 0xC2, 0x29, 0x31, 0x51, 0x03, 0xF0, 0xD0, 0xCD, 0x47, 0x3B,
+    0xEA, 0xB5, 0x9D, 0x31, 0x9B, 0x5D, 0x28, 0xF4, 0xF4, 0x96, 0x2D, 0xF1, 0x83, 0x5D, 0xE7, 0x07,
+    0x70, 0x11, 0xAA, 0x15, 0xB7, 0x96, 0x1B, 0x6E, 0x43, 0xB4, 0xC2, 0xF9, 0x56, 0xBE, 0x99, 0x5B,
+    0xCD, 0xF5, 0xD2, 0x6A, 0x31, 0xB1, 0xB9, 0x17, 0x51, 0xB3, 0x8A, 0xFE, 0xCB, 0x6B, 0x3F, 0xB4,
+    0x6F, 0x47, 0x37, 0x5B, 0x45, 0xBB, 0x54, 0x8A, 0x55, 0x2C, 0x15, 0x4B, 0xA1, 0x0D, 0x0D, 0x6E,
+    0xA3, 0x9F, 0x9A, 0x8D, 0x36, 0x5C, 0xBE, 0xC5, 0x43, 0x2F, 0x5D, 0xF0, 0xD9, 0xD9, 0x61, 0x1F,
+    0xDE, 0x3A, 0x7B, 0x86, 0xFE, 0x3B, 0x79, 0xB6, 0x83, 0x7E, 0x7A, 0x81, 0xE3, 0xF2, 0xA9, 0x02,
+    0xE3, 0x39, 0x34, 0x22, 0xE7, 0x28, 0x8C, 0x7B, 0x31, 0xAE, 0x30, 0xAE, 0xD4, 0x4A, 0x68, 0x7C,
+    0x4E, 0xF5, 0xDB, 0x85, 0x36, 0x42, 0xBD, 0xE7, 0x0E, 0xC2, 0xA1, 0x4E, 0x6D, 0x6F, 0x46, 0x5D,
+    0xEA, 0xE3, 0xF5, 0x89, 0x85, 0x32, 0x83, 0x11, 0xED, 0x02, 0x85, 0x7C, 0xAA, 0x6A, 0x26, 0x1A,
+    0x86, 0x5B, 0x0A, 0x79, 0x70, 0x91, 0x3E, 0x42, 0xBF, 0xD3, 0xE8, 0xCF, 0x3E, 0x96, 0x7B, 0x82,
+    0x4E, 0xC3, 0xC7, 0xFC, 0xC1, 0x6C, 0xAD, 0x73, 0xA1, 0x28, 0x3F, 0xD4, 0x99, 0x36, 0x71, 0x45,
+    0x77, 0xEF, 0x07, 0x0C, 0x9E, 0xDD, 0x73, 0x94, 0xA2, 0xA7, 0x36, 0x4A, 0x7D, 0x72, 0x4B, 0x71,
+    0xE0, 0xCF, 0x0E, 0x00, 0x8F, 0xD1, 0x7A, 0xB9, 0x81, 0xBE, 0x95, 0x3C, 0xE3, 0x5D, 0xCD, 0x85,
+    0x7C, 0x1B, 0x8C, 0x68, 0x42, 0x75, 0x2A, 0xAD, 0xDB, 0x40, 0x13, 0x9A, 0x40, 0x3B, 0xB7, 0x33,
+    0x6E, 0x72, 0x33, 0xA3, 0x77, 0xA1, 0xD4, 0xE0, 0xF2, 0xAC, 0xB4, 0x3D, 0x0D, 0x7C, 0xB1, 0x39,
+    0x4B, 0x1F, 0x0E, 0x5A, 0x59, 0x26, 0x38, 0xA5, 0x2A, 0x55, 0x9F, 0x22, 0x7F, 0x49, 0x1D, 0xB5,
+    0xA4, 0x48, 0xA1, 0xAD, 0xD2, 0x84, 0xDB, 0x13, 0xF4, 0x3B, 0x30, 0x86, 0x8C, 0xEF, 0xB6, 0x91,
+    0x44, 0xF5, 0x3E, 0x18, 0x42, 0x9A, 0xEB, 0x04, 0xEF, 0x8E, 0x77, 0x6F, 0xFD, 0xBE, 0xBC, 0x15,
+    0x8C, 0x2B, 0x5A, 0x68, 0xD5, 0x59, 0xDD, 0x1D, 0x33, 0xE2, 0x9B, 0x06, 0x64, 0x69, 0xA0, 0xBF,
+    0xC8, 0xEA, 0xB3, 0xA7, 0xA2, 0x79, 0xC7, 0x31, 0x67, 0xE3, 0x83, 0x5E, 0xFA, 0xD1, 0x5A, 0x3C,
+    0xB7, 0xFA, 0xC1, 0xF8, 0xC0, 0xA5, 0x77, 0x3F, 0xEB, 0xD2, 0x1F, 0xED, 0x5E, 0x86, 0xA4, 0x32,
+    0x39, 0x46, 0xA7, 0x59, 0xFA, 0xE9, 0x84, 0xAF, 0xBC, 0x9F, 0xDE, 0x64, 0xD7, 0x76, 0xC6, 0x09,
+    0xCE, 0x4F, 0xBD, 0x8E, 0x65, 0x8A, 0xD1, 0x92, 0x7C, 0x36, 0x9A, 0xFA, 0x0D, 0xA3, 0x64, 0xC4,
+    0x56, 0x6A, 0x61, 0x77, 0x18, 0x43, 0x29, 0x4F, 0xAD, 0x1C, 0x47, 0x54, 0x09, 0xF9, 0x1E, 0x25,
+    0x69, 0xAA, 0x75, 0xEB, 0xE5, 0x3E, 0x26, 0x68, 0x75, 0xB0, 0xEA, 0x4A, 0x2D, 0x48, 0x5F, 0x39,
+    0xD2, 0xDD, 0x89, 0xF1, 0x94, 0x78, 0xE9, 0x94, 0x12, 0x26, 0xA9, 0xCB, 0xBC, 0xA9, 0xC3, 0x3B,
+    0x5F, 0xFF, 0xC4, 0xCB, 0xE9, 0x6A, 0x8A, 0x73, 0xEF, 0x2C, 0x1B, 0xA9, 0xF5, 0x3E, 0x6D, 0xFB,
+    0x7F, 0xD9, 0x4B, 0x9C, 0xA0, 0x82, 0xEA, 0xF8, 0xA7, 0x5E, 0x4F, 0x34, 0xE3, 0xF3, 0x08, 0xB2,
+    0xD4, 0x27, 0xB7, 0xD3, 0xE0, 0xC2, 0xD3, 0xE0, 0x8A, 0xEB, 0xFF, 0xF2, 0xD6, 0x5F, 0x44, 0x09,
+    0xFA, 0x91, 0xDF, 0x3B, 0xEF, 0x97, 0xDE, 0x4E, 0xB1, 0xFC, 0x51, 0x06, 0xCE, 0x6C, 0xD2, 0xB4,
+    0x99, 0x5D, 0x66, 0x98, 0xD1, 0x4F, 0x27, 0xEC, 0x77, 0x3B, 0xA6, 0x49, 0xD1, 0xCE, 0xC7, 0x60,
+    0xB2, 0xE2, 0xFB, 0xA7, 0x24, 0xFE, 0x22, 0xE3, 0xD4, 0x9E, 0x3A, 0xE0, 0xD2, 0x5C, 0x99, 0x03,
+    0xF4, 0x39, 0xC2, 0xF4, 0x4B, 0x67, 0x67, 0x7D, 0xB8, 0x7F, 0xCC, 0x0D, 0x5C, 0x3A, 0xE6, 0x94,
+    0xE1, 0xD4, 0x5D, 0xCE, 0xF1, 0xFE, 0xF9, 0x94, 0x47, 0xA3, 0x53, 0x44, 0x7F, 0x8E, 0x2D, 0x9D,
+    0x68, 0x82, 0x17, 0xA8, 0x20, 0x1C, 0xF4, 0x84, 0x9C, 0x1B, 0xBC, 0xDF, 0xE0, 0xA2, 0xF2, 0xC5,
+    0x87, 0x6E, 0x32, 0x7E, 0x61, 0xC7, 0x2E, 0x6E, 0x2A, 0xF4, 0xC9, 0x0D, 0x17, 0xE4, 0x53, 0x2A,
+    0x7A, 0x6A, 0x8A, 0xDB, 0xBB, 0x04, 0x98, 0xEC, 0x9F, 0xD8, 0xF9, 0x1B, 0x89, 0xAC, 0xE4, 0x86,
+    0xDC, 0xCC, 0xD0, 0x0F, 0x48, 0x2B, 0xAD, 0x94, 0xBB, 0xFF, 0xCD, 0xCE, 0x50, 0xC8, 0x37, 0x5F,
+    0xD1, 0x62, 0x72, 0x61, 0x07, 0xFE, 0xDE, 0x85, 0xD0, 0xE6, 0xEC, 0xD6, 0x2B, 0x07, 0xBC, 0xEA,
+    0x0E, 0xF6, 0xEE, 0x06, 0x67, 0xD7, 0x7E, 0xA1, 0x3D, 0x7C, 0xE8, 0x45, 0xCA, 0x97, 0x2F, 0x8C,
+    0x57, 0x5A, 0xA9, 0x36, 0x9A, 0x80, 0xD9, 0x2F, 0x8E, 0x57, 0xEA, 0xD4, 0x3D, 0x38, 0x5E, 0x69,
+    0x3D, 0xE1, 0x6F, 0x63, 0x1E, 0xAF, 0xE4, 0xFF, 0xE2, 0xC6, 0x2B, 0x01, 0xC5, 0x6F, 0x26, 0xB8,
+    0x64, 0x3B, 0x35, 0x91, 0x27, 0xE8, 0xF0, 0xF2, 0xAD, 0x7F, 0x75, 0xF6, 0xCB, 0x08, 0x6D, 0xB3,
+    0x24, 0xC9, 0x1B, 0x18, 0x87, 0x63, 0x08, 0xC5, 0x38, 0x99, 0x1D, 0xAA, 0x34, 0xF5, 0xC2, 0x05,
+    0xBB, 0x9C, 0x66, 0x50, 0xB4, 0x6B, 0xEF, 0xA1, 0xD0, 0xD7, 0xD6, 0xF3, 0x72, 0xA2, 0x72, 0xDF,
+    0x6C, 0xEA, 0x12, 0xBE, 0x48, 0x17, 0x3D, 0xD8, 0x13, 0xDD, 0x39, 0x76, 0x95, 0x24, 0xF0, 0x8A,
+    0x86, 0x53, 0x4F, 0x50, 0x9B, 0x69, 0x94, 0xB9, 0x5C, 0xE9, 0xCF, 0x6B, 0x6A, 0xF7, 0x4B, 0x13,
+    0xF5, 0xD2, 0x4E, 0x60, 0x17, 0x37, 0x41, 0x1B, 0x46, 0x7F, 0x84, 0x50, 0xFD, 0x0F, 0x7F, 0x9A,
+    0xE9, 0x7C, 0x30, 0x0E, 0x59, 0x31, 0x3B, 0x36, 0x52, 0x9F, 0x46, 0x67, 0xED, 0xC7, 0xE8, 0x2C,
+    0x8F, 0xC9, 0x65, 0xEC, 0x34, 0x3A, 0xEB, 0xCD, 0x0B, 0x7B, 0xFB, 0xF6, 0x83, 0xA3, 0xB3, 0xDC,
+    0x5F, 0xE4, 0xE8, 0x2C, 0x78, 0x74, 0x78, 0x19, 0xE8, 0x5F, 0xDF, 0x0F, 0x7C, 0x21, 0xC5, 0x53,
+    0x09, 0x98, 0x30, 0xF7, 0xE9, 0xCC, 0x07, 0xDC, 0x4E, 0xBB, 0x52, 0xAF, 0x79, 0x37, 0xEB, 0x0D,
+    0x37, 0xE7, 0xCD, 0x34, 0x42, 0x5D, 0xDE, 0xCB, 0x52, 0x5F, 0x8C, 0xA7, 0xAD, 0x3C, 0x3A, 0xAF,
+    0x12, 0xE7, 0x64, 0x38, 0x6D, 0x64, 0xBA, 0xBA, 0xCC, 0x10, 0x5F, 0x2E, 0xF4, 0x24, 0xFB, 0xE3,
+    0xEA, 0x9A, 0xCC, 0xB3, 0x4A, 0x2D, 0xAA, 0xE7, 0x57, 0xD7, 0xAF, 0xEF, 0x7F, 0x76, 0xD5, 0x06,
+    0xFD, 0x4C, 0xB3, 0x1E, 0x94, 0xE6, 0x4C, 0x6E, 0x6E, 0x36, 0x2A, 0x75, 0xBF, 0xB0, 0xA6, 0x66,
+    0x55, 0xCD, 0xBA, 0x9A, 0x95, 0x35, 0x6B, 0x6B, 0x56, 0xD7, 0xAC, 0xAF, 0x87, 0xC2, 0xE6, 0x5D,
+    0xCD, 0x2A, 0x7B, 0x60, 0xE6, 0xE3, 0x31, 0x96, 0x21, 0x27, 0xDF, 0x9C, 0x5F, 0xFD, 0x31, 0x82,
+    0x26, 0x4F, 0xA2, 0xCB, 0x5E, 0x23, 0xBD, 0xFF, 0xCA, 0x41, 0x05, 0xBE, 0x60, 0xF5, 0xD3, 0x1E,
+    0xE7, 0x65, 0xB8, 0xA0, 0xC1, 0x69, 0xA4, 0xD9, 0x41, 0xBD, 0xCA, 0xC4, 0x2A, 0xEC, 0x96, 0x14,
+    0x44, 0xF3, 0x31, 0x23, 0xE0, 0x97, 0xF8, 0xE9, 0xA7, 0x04, 0x8E, 0x26, 0x6D, 0xCE, 0x2D, 0xE1,
+    0x64, 0x11, 0x48, 0xC5, 0x94, 0x74, 0x09, 0x09, 0x42, 0xD5, 0x34, 0x26, 0xF0, 0xFF, 0x8B, 0x99,
+    0x04, 0x9E, 0x75, 0x34, 0xE3, 0xF9, 0x2E, 0xE3, 0x3F, 0xE3, 0x81, 0x52, 0x44, 0x2E, 0x28, 0xF7,
+    0xA9, 0x76, 0x79, 0xE4, 0xE0, 0x59, 0x69, 0xB3, 0x8F, 0xC9, 0x21, 0x75, 0x93, 0x8F, 0x35, 0x9E,
+    0xD0, 0xA7, 0x2E, 0x7D, 0x36, 0xAD, 0xE2, 0x7B, 0xA4, 0x24, 0x39, 0x8E, 0x27, 0x37, 0xEC, 0xE2,
+    0xA6, 0x52, 0x75, 0xC4, 0x05, 0xF9, 0x53, 0x3C, 0xF1, 0xA1, 0x94, 0xBE, 0xDB, 0xC9, 0x0D, 0x65,
+    0x34, 0x01, 0xE7, 0x47, 0xCC, 0x6A, 0x27, 0xC6, 0x2E, 0x62, 0x43, 0xDB, 0x21, 0x13, 0x68, 0xE7,
+    0xCF, 0x53, 0x6D, 0xF5, 0x8C, 0xFC, 0xD8, 0x8D, 0xB1, 0x96, 0x34, 0xF4, 0x19, 0xDD, 0xC7, 0xEA,
+    0x4F, 0x02, 0x97, 0xAE, 0xEE, 0xA4, 0x31, 0xB9, 0xC7, 0xA0, 0xC9, 0xEC, 0x76, 0xBA, 0xF3, 0x51,
+    0x5A, 0x93, 0x9E, 0xD4, 0x27, 0x37, 0x1B, 0xCF, 0x47, 0x69, 0xBD, 0x50, 0x0E, 0x95, 0x6F, 0xF8,
+    0x38, 0xAF, 0x10, 0xCC, 0x5C, 0xF9, 0xA6, 0xFB, 0xFB, 0xBC, 0x42, 0xA8, 0x82, 0x99, 0x46, 0x6F,
+    0xB5, 0xE3, 0xB4, 0xD0, 0x7E, 0xCF, 0x27, 0xE2, 0xDD, 0x0A, 0xD5, 0x94, 0xFE, 0xFC, 0x80, 0x03,
+    0x0C, 0xB2, 0x7F, 0x1F, 0xA7, 0xF3, 0x27, 0xE2, 0x89, 0xB6, 0x79, 0x71, 0x80, 0x41, 0xFF, 0xF3,
+    0x07, 0x18, 0x24, 0x89, 0x4F, 0xB0, 0x51, 0x38, 0x67, 0x9A, 0xC7, 0x73, 0xB6, 0xF9, 0x23, 0x49,
+    0xDB, 0xAE, 0xDF, 0x7A, 0xE9, 0x34, 0xD6, 0x20, 0xA6, 0xF5, 0x30, 0x6B, 0x6A, 0xDF, 0xA8, 0x42,
+    0x2A, 0xE3, 0xDB, 0x90, 0xD0, 0x8C, 0x76, 0xCA, 0x23, 0x0D, 0x7C, 0x62, 0xDF, 0x8F, 0x53, 0x1A,
+    0x3D, 0x5E, 0x7B, 0xB8, 0x9C, 0x75, 0xF7, 0x7A, 0xEE, 0x7D, 0x52, 0x1E, 0x40, 0x99, 0x93, 0xB1,
+    0x1C, 0xE6, 0x1E, 0xF9, 0x2E, 0x76, 0xFF, 0xA5, 0xA5, 0xDD, 0xFE, 0x7B, 0x2E, 0x0A, 0xDC, 0xE9,
+    0xB1, 0x59, 0xD3, 0x1C, 0xAB, 0x76, 0xC1, 0xA6, 0x22, 0x2F, 0x4D, 0x7E, 0x6C, 0xF3, 0x48, 0x0A,
+    0x37, 0x24, 0x65, 0x71, 0x5D, 0x5A, 0xFF, 0x3E, 0xDB, 0xB4, 0x31, 0xCB, 0xB1, 0xCE, 0xD2, 0x78,
+    0xA6, 0x84, 0x43, 0xA7, 0xA2, 0x8A, 0x51, 0x82, 0xA4, 0xCD, 0x8E, 0x89, 0x68, 0xA8, 0x37, 0xCC,
+    0xCA, 0x38, 0xD8, 0x8D, 0x7A, 0x61, 0x1C, 0x12, 0x4F, 0x5E, 0x43, 0x93, 0x90, 0x6E, 0xDA, 0x95,
+    0x66, 0x6E, 0x85, 0x4B, 0x73, 0x53, 0xE9, 0x97, 0xD4, 0x14, 0x3E, 0x86, 0x84, 0x73, 0x29, 0xA4,
+    0x21, 0x30, 0x47, 0xA5, 0xEE, 0x2B, 0x73, 0xEA, 0xB0, 0x69, 0x1E, 0xCC, 0x10, 0xCA, 0xB4, 0x74,
+    0xC9, 0xD9, 0x7D, 0x90, 0x34, 0x0E, 0x80, 0x0F, 0x77, 0x17, 0xFA, 0x43, 0x9B, 0x99, 0xFF, 0x10,
+    0x8A, 0x0D, 0x93, 0x06, 0x53, 0x3C, 0x03, 0x66, 0xA5, 0xF6, 0xE0, 0x3A, 0x56, 0xA8, 0x02, 0xB6,
+    0x83, 0x91, 0xE2, 0xEE, 0x4D, 0xEC, 0x8C, 0xD3, 0xCC, 0x86, 0x91, 0x86, 0xC6, 0xF3, 0xB9, 0x32,
+    0x9A, 0x48, 0xED, 0xAD, 0x77, 0x9E, 0x58, 0xC6, 0x6A, 0xC5, 0x3E, 0xAB, 0x6E, 0xEC, 0x0A, 0x29,
+    0xD8, 0x05, 0xA7, 0x58, 0x08, 0xA3, 0x2D, 0x23, 0x17, 0xE5, 0x6B, 0xA7, 0x36, 0x96, 0xD4, 0xF1,
+    0xE9, 0x02, 0xF4, 0x81, 0x34, 0xC5, 0xA7, 0x33, 0x4A, 0x26, 0x35, 0xCD, 0x0B, 0x9A, 0xD2, 0x04,
+    0x90, 0xD4, 0x84, 0xCF, 0xF8, 0x93, 0x3C, 0x37, 0xF5, 0xE8, 0xB4, 0xC8, 0x32, 0x74, 0xD4, 0x17,
+    0x73, 0xCF, 0x6B, 0xAE, 0x89, 0x25, 0x83, 0x53, 0x9F, 0xDE, 0x34, 0xE5, 0xD0, 0x34, 0xA7, 0xF2,
+    0x0B, 0x50, 0xEB, 0x6B, 0x1A, 0xA0, 0x54, 0x50, 0x04, 0xFA, 0xAD, 0xD2, 0x0C, 0x8D, 0x3A, 0xA7,
+    0x8F, 0x50, 0x69, 0x36, 0x52, 0x57, 0x68, 0xA5, 0xD1, 0x4A, 0xAF, 0xA3, 0xAF, 0x3F, 0xB5, 0x06,
+    0x9F, 0xDB, 0xF0, 0x3C, 0x5B, 0xEE, 0xC4, 0xE3, 0x75, 0x5D, 0x19, 0x71, 0x1D, 0x6E, 0x70, 0x03,
+    0x36, 0xB8, 0x81, 0x72, 0x73, 0x3E, 0xBF, 0xDD, 0xA6, 0x09, 0x17, 0xFE, 0xA8, 0xD3, 0xB9, 0xE5,
+    0x70, 0x28, 0x4E, 0x13, 0xB8, 0xB7, 0x57, 0x70, 0xDF, 0x15, 0xB8, 0xD0, 0xBF, 0x85, 0x0B, 0x56,
+    0x9D, 0x0B, 0xA9, 0xF1, 0xD4, 0x45, 0xA0, 0xBC, 0x73, 0x8C, 0xE3, 0x78, 0xE0, 0x7E, 0x0D, 0xEF,
+    0x79, 0xE2, 0xD2, 0xD9, 0xD9, 0xD9, 0xD9, 0x59, 0x4A, 0x8B, 0xDF, 0x48, 0x23, 0xA4, 0x74, 0x8E,
+    0xEE, 0x1F, 0x2C, 0xC8, 0x63, 0x88, 0xAD, 0xB4, 0xE6, 0xB2, 0x6C, 0x18, 0x75, 0xFF, 0xFB, 0xE0,
+    0x1A, 0x0F, 0x43, 0xDF, 0x39, 0x4F, 0xEB, 0xED, 0x84, 0x0D, 0x55, 0xC0, 0x2C, 0x65, 0xA4, 0x88,
+    0xEC, 0x20, 0xFA, 0x0E, 0x37, 0xB4, 0x9E, 0x66, 0xB2, 0x33, 0x75, 0x30, 0x0B, 0x66, 0x2D, 0x23,
+    0x6C, 0x08, 0x46, 0xDC, 0x80, 0xF3, 0x8D, 0xC7, 0x4E, 0x75, 0xA0, 0x0A, 0x66, 0xA5, 0x8C, 0xC5,
+    0x96, 0xC6, 0xE7, 0xD0, 0x77, 0x6E, 0xC8, 0xC7, 0x9D, 0xEB, 0x80, 0x59, 0x4C, 0xA4, 0x3C, 0x8E,
+    0x0B, 0xAE, 0x6B, 0x3D, 0x8D, 0xB7, 0x33, 0x75, 0xA8, 0x16, 0x28, 0xCE, 0xCE, 0xCE, 0xCE, 0xCE,
+    0xAE, 0xA5, 0xD2, 0xEB, 0x94, 0xCE, 0x35, 0x5D, 0xE4, 0x72, 0xBF, 0x88, 0x5F, 0x7C, 0x5F, 0x1E,
+    0x5C, 0x5F, 0x1E, 0x60, 0xB9, 0x13, 0x56, 0x43, 0x25, 0x5F, 0x26, 0xC2, 0x72, 0xBF, 0xE0, 0x62,
+    0xA6, 0x2D, 0x5B, 0xC1, 0xB8, 0xE1, 0x76, 0x5A, 0x61, 0x45, 0xA5, 0xCE, 0xA4, 0x36, 0xED, 0x71,
+    0xC1, 0x45, 0xDA, 0xFD, 0x03, 0x7C, 0xDC, 0xCA, 0x1B, 0xCD, 0x7D, 0xA4, 0x95, 0xD1, 0x84, 0x42,
+    0xB3, 0x53, 0xA9, 0x53, 0xC0, 0xC5, 0x4A, 0x43, 0xA1, 0xB9, 0x8D, 0x58, 0x25, 0xB2, 0x74, 0xAD,
+    0xAE, 0xD4, 0xE4, 0x62, 0x9E, 0xEB, 0xE3, 0x2E, 0x76, 0xE9, 0xDB, 0x90, 0x47, 0x60, 0xB4, 0x53,
+    0xA6, 0xDB, 0x5C, 0x6C, 0xE2, 0x4F, 0x37, 0x4F, 0x48, 0x77, 0xFE, 0x88, 0x79, 0x5C, 0xFD, 0x7D,
+    0x3D, 0xFE, 0x21, 0x77, 0x2F, 0xB8, 0xD3, 0xA7, 0x87, 0x5C, 0x21, 0x7D, 0xFF, 0x97, 0xC7, 0x07,
+    0x5F, 0x66, 0xCF, 0xCD, 0x30, 0x3C, 0x03, 0x98, 0x01, 0xF8, 0xBB, 0xE4, 0xF1, 0x8D, 0x47, 0xA8,
+    0x75, 0xF3, 0xA0, 0x03, 0x39, 0x7F, 0xFC, 0xEA, 0x07, 0xD2, 0x64, 0xC7, 0x64, 0x62, 0x76, 0x32,
+    0x47, 0xDD, 0xC4, 0x53, 0x6F, 0x87, 0xB6, 0xC4, 0x82, 0x76, 0x79, 0x60, 0xF9, 0x9E, 0xDA, 0xF1,
+    0x7E, 0xFA, 0x41, 0x44, 0x5E, 0x0A, 0x93, 0x51, 0xB0, 0x34, 0x89, 0xDD, 0x49, 0xE2, 0xB5, 0xDB,
+    0xE1, 0x3E, 0xA6, 0xDB, 0xFB, 0x1D, 0x64, 0x24, 0xF7, 0x0F, 0xA6, 0x71, 0x26, 0x7F, 0x1F, 0xE0,
+    0xAF, 0x03, 0xFC, 0xB5, 0x0B, 0xEA, 0x2B, 0x69, 0xA2, 0x38, 0xA4, 0xE4, 0xC0, 0x8C, 0x73, 0xE1,
+    0x33, 0x11, 0x63, 0xD6, 0xC4, 0xF3, 0xE9, 0x70, 0xA7, 0xB1, 0x4B, 0x3A, 0x26, 0xC7, 0x34, 0x4A,
+    0xCE, 0x40, 0x52, 0xA0, 0x97, 0xB4, 0x1F, 0xA3, 0x69, 0x2E, 0x10, 0x0E, 0xD3, 0x0C, 0xC8, 0x98,
+    0x3B, 0xD0, 0x53, 0xFB, 0x79, 0x86, 0xF3, 0xDC, 0x79, 0x1F, 0xD4, 0x29, 0xDC, 0x2D, 0x3A, 0x9A,
+    0x89, 0x71, 0x36, 0x5A, 0xAC, 0x42, 0xAF, 0x2F, 0x68, 0xB1, 0x5B, 0xEA, 0xCF, 0x82, 0x33, 0xB3,
+    0x57, 0xBB, 0xDD, 0x9A, 0xCD, 0x45, 0x17, 0xEF, 0xFF, 0xEF, 0x61, 0xFB, 0xCD, 0x25, 0xD7, 0xF4,
+    0xA7, 0x63, 0x0C, 0x40, 0xED, 0x11, 0x98, 0xFF, 0x81, 0xD6, 0xC3, 0x1F, 0xFE, 0xEB, 0x3A, 0xC0,
+    0xAF, 0xFC, 0xA0, 0xDC, 0x80, 0x6F, 0xCD, 0xFD, 0x00, 0xBF, 0xFA, 0x58, 0x33, 0x43, 0xA1, 0xE7,
+    0x12, 0x71, 0x50, 0x00, 0x1F, 0x75, 0xD3, 0x79, 0x5F, 0x67, 0xB9, 0x9F, 0x37, 0xC8, 0xE4, 0x7B,
+    0x1D, 0x54, 0x99, 0xD3, 0x93, 0xF2, 0xB8, 0xE9, 0xD7, 0x2E, 0x0F, 0xD8, 0xF5, 0xAF, 0xFF, 0xCB,
+    0xFF, 0x93, 0x52, 0xE5, 0xFF, 0xFE, 0x9F, 0x4C, 0x8C, 0xFE, 0x3F, 0xFD, 0xE3, 0xFF, 0x95, 0x36,
+    0x98, 0xFF, 0xEA, 0xBF, 0xF7, 0xD5, 0x86, 0xFB, 0xE2, 0x52, 0xA8, 0x2B, 0xE7, 0x27, 0xB8, 0xBF,
+    0xD1, 0xDB, 0x89, 0x46, 0x5D, 0x2D, 0x6F, 0xE4, 0xD1, 0xCC, 0x18, 0x32, 0x5D, 0xAA, 0xDD, 0x52,
+    0xD7, 0xA5, 0x53, 0xAD, 0xA9, 0xD2, 0xA4, 0xC8, 0x18, 0xAD, 0xBA, 0xA4, 0x3E, 0x9A, 0xDB, 0x8D,
+    0x36, 0x1A, 0x0D, 0x95, 0x06, 0x85, 0xA4, 0x6A, 0xED, 0x96, 0x46, 0x85, 0x8D, 0x87, 0x4D, 0xF8,
+    0x35, 0xFE, 0x19, 0x73, 0x1D, 0x6C, 0x68, 0xBD, 0x3A, 0x99, 0x68, 0x43, 0x3B, 0xF5, 0xCF, 0x6E,
+    0x26, 0xD6, 0xA1, 0xF5, 0xAE, 0xDB, 0xCD, 0x52, 0x05, 0xEB, 0x3F, 0x0A, 0x5C, 0x05, 0x7E, 0xBB,
+    0x5A, 0x9B, 0x74, 0x9F, 0x96, 0x3C, 0x6E, 0xA5, 0xF2, 0xCF, 0xD4, 0x4B, 0xFF, 0x89, 0xBD, 0x99,
+    0xDD, 0x9B, 0xB1, 0x5A, 0xFA, 0x6E, 0xB7, 0x73, 0xF3, 0xEC, 0x85, 0xCC, 0xEB, 0x9F, 0x14, 0xA1,
+    0x98, 0x9C, 0x1F, 0xBB, 0x7C, 0x3B, 0x97, 0x66, 0x76, 0xBE, 0x1F, 0x54, 0x46, 0x13, 0xAB, 0x60,
+    0xA7, 0xC6, 0xBB, 0xEE, 0xF3, 0x6C, 0x5C, 0xA5, 0x2B, 0x3A, 0xF8, 0xB5, 0x1C, 0x70, 0xB9, 0x40,
+    0xF6, 0x2B, 0xA1, 0xD4, 0x57, 0x77, 0x23, 0xAF, 0x19, 0x0A, 0xF8, 0xDB, 0xF0, 0x0A, 0xD5, 0x9A,
+    0x6E, 0x65, 0x50, 0x6F, 0x34, 0x33, 0x2E, 0xE0, 0x56, 0xEC, 0x46, 0x25, 0xCA, 0x34, 0x10, 0xFD,
+    0xB1, 0xCC, 0xC3, 0xFE, 0x07, 0xF0, 0x04, 0xB4, 0x13, 0x76, 0xA5, 0x54, 0x87, 0x9B, 0xA9, 0x57,
+    0xEA, 0x48, 0x1B, 0xE9, 0x17, 0x34, 0x33, 0x7A, 0x1C, 0xFC, 0x3A, 0xF9, 0x16, 0x22, 0xB9, 0x6D,
+    0xEA, 0x02, 0xEB, 0xE3, 0x42, 0x17, 0x10, 0xA7, 0x8C, 0x32, 0xF3, 0x0D, 0xDD, 0x46, 0x1F, 0xDD,
+    0x06, 0x46, 0xE1, 0xF2, 0xAD, 0xCF, 0x2A, 0x37, 0xBD, 0xE6, 0x81, 0x01, 0x31, 0x8F, 0x45, 0xA8,
+    0x35, 0x27, 0x26, 0x2F, 0x4E, 0x39, 0x3D, 0x2C, 0xB5, 0xB6, 0x79, 0x42, 0xBE, 0xBE, 0x7D, 0x5E,
+    0xD5, 0x4C, 0xBD, 0xD7, 0xDF, 0x93, 0x76, 0xDA, 0x90, 0x38, 0x96, 0x83, 0xD9, 0x41, 0xDF, 0x90,
+    0x66, 0xC6, 0x19, 0xBB, 0x35, 0x5A, 0xB0, 0x1B, 0xA5, 0xFE, 0x48, 0x4A, 0x03, 0x71, 0x37, 0x69,
+    0x49, 0x63, 0x71, 0x25, 0xF9, 0xE2, 0xAC, 0x3B, 0x10, 0x8E, 0x8B, 0xD3, 0x9D, 0x2A, 0xED, 0x07,
+    0x61, 0x29, 0x35, 0xD3, 0xC3, 0xA8, 0xC9, 0x1D, 0x63, 0x45, 0x4A, 0xA9, 0x83, 0x46, 0x31, 0xCD,
+    0x25, 0xAF, 0x12, 0xB7, 0x6A, 0xA6, 0x94, 0x86, 0x84, 0x3D, 0xDE, 0xF7, 0x73, 0x1A, 0x06, 0x5D,
+    0xBD, 0x77, 0x8D, 0x8E, 0x68, 0x32, 0xBB, 0xF2, 0x8B, 0x3D, 0x42, 0xD4, 0xF7, 0xE1, 0x13, 0xFF,
+    0x11, 0xF0, 0x4A, 0x36, 0x81, 0x7B, 0xA2, 0xE5, 0x9A, 0x98, 0x28, 0x0A, 0xF5, 0x92, 0x83, 0xE7,
+    0xA3, 0xFF, 0x7B, 0x4A, 0xD6, 0x5D, 0x69, 0x1E, 0x58, 0xA9, 0x14, 0xE7, 0x9B, 0x3D, 0x9B, 0xCC,
+    0x08, 0xFC, 0xC6, 0xCF, 0xA6, 0x0C, 0xC9, 0x63, 0xE4, 0xA9, 0x34, 0x60, 0x35, 0xD0, 0xA8, 0xC3,
+    0xA9, 0xA3, 0x17, 0x47, 0x6B, 0xE9, 0x47, 0x00, 0x78, 0x01, 0xF2, 0x2D, 0x81, 0x92, 0x71, 0x4F,
+    0xC6, 0x31, 0x05, 0xE5, 0x36, 0x00, 0xC5, 0x98, 0xA6, 0x2C, 0x26, 0x52, 0xE2, 0x06, 0xD2, 0xDB,
+    0x91, 0x52, 0xBB, 0x5D, 0x30, 0xBF, 0xBB, 0xA4, 0x58, 0x7F, 0x1C, 0x28, 0x64, 0x76, 0xA8, 0xD7,
+    0x34, 0x17, 0xB8, 0xF7, 0xA0, 0x72, 0x87, 0x2A, 0x36, 0x0B, 0xB8, 0x77, 0xE4, 0x41, 0xB7, 0xE3,
+    0xC1, 0x66, 0x6C, 0x73, 0xB3, 0xCA, 0x70, 0xC4, 0x69, 0xA9, 0x89, 0xA1, 0x3D, 0x9F, 0xA7, 0x96,
+    0xB2, 0xFC, 0x94, 0x34, 0xBE, 0xF5, 0x33, 0xAE, 0x34, 0xDD, 0x6B, 0xE9, 0xE2, 0x47, 0xB6, 0x13,
+    0xB1, 0xB0, 0xBA, 0x00, 0xAE, 0x5D, 0xC8, 0x71, 0x12, 0x2E, 0x73, 0x9A, 0x07, 0xB2, 0x3B, 0x69,
+    0x1B, 0xA5, 0x78, 0x76, 0x76, 0x76, 0xED, 0x52, 0xC7, 0xD5, 0xB1, 0x6B, 0xBF, 0x2B, 0xA9, 0x92,
+    0x16, 0x2B, 0x75, 0xD5, 0x03, 0xB4, 0x8D, 0x5F, 0x07, 0x68, 0x2F, 0x41, 0xF9, 0xD5, 0x2F, 0x75,
+    0x79, 0x30, 0xEA, 0xA8, 0x29, 0xA7, 0x5E, 0xA5, 0x56, 0xA8, 0xA4, 0x01, 0x7E, 0xF2, 0x27, 0x1E,
+    0xFE, 0xCE, 0xF2, 0x3B, 0xF0, 0xCC, 0xE7, 0xEC, 0x93, 0xB4, 0xCD, 0xF7, 0xBE, 0xFA, 0xDC, 0xB7,
+    0x47, 0xE9, 0x9B, 0xD2, 0x6D, 0x0D, 0xCD, 0x5E, 0x68, 0xAA, 0xF4, 0xC7, 0x52, 0x23, 0xDD, 0xFB,
+    0xF6, 0x17, 0xBF, 0xFD, 0x5F, 0xFF, 0x37, 0xA1, 0x7B, 0xCE, 0xB3, 0x52, 0xCC, 0x79, 0x73, 0x8E,
+    0x81, 0xFD, 0xB9, 0xDF, 0xB7, 0xCA, 0x77, 0x8F, 0xE9, 0x2E, 0xCC, 0x72, 0x49, 0x6D, 0x63, 0xB9,
+    0x4D, 0x38, 0xFD, 0x93, 0x87, 0xF0, 0xA6, 0x09, 0xE7, 0x79, 0xAA, 0x79, 0x32, 0xD0, 0xB9, 0x47,
+    0x36, 0xF3, 0x55, 0x72, 0x8A, 0xBD, 0x5C, 0xB0, 0xE3, 0x99, 0xBF, 0x92, 0x3A, 0xB2, 0xB2, 0x39,
+    0x4F, 0x2C, 0x32, 0xB3, 0x5D, 0x60, 0x96, 0x65, 0xA8, 0xF9, 0x7D, 0x26, 0x3A, 0x3F, 0x72, 0x13,
+    0x8A, 0x97, 0x81, 0x2B, 0x5A, 0x29, 0xC6, 0xA4, 0x4E, 0x31, 0xCD, 0x89, 0x1C, 0xD3, 0x6D, 0xC2,
+    0x34, 0x18, 0x4D, 0x4D, 0x70, 0x5B, 0x21, 0xCC, 0x4C, 0x3B, 0x3D, 0x41, 0xB9, 0xF1, 0x61, 0x18,
+    0x87, 0x9B, 0x89, 0x12, 0x5E, 0xEE, 0x87, 0xF7, 0xB6, 0xEB, 0x01, 0x18, 0xB8, 0x29, 0x9F, 0x43,
+    0x71, 0x0A, 0x48, 0xCE, 0x5F, 0x1C, 0x7D, 0x3E, 0xF5, 0x7A, 0xCF, 0xBD, 0x7A, 0xA5, 0x66, 0x68,
+    0xF7, 0x3C, 0x6A, 0xB4, 0x49, 0xB3, 0x37, 0xE7, 0x34, 0xD0, 0x28, 0x37, 0xDA, 0x4F, 0xB9, 0x2B,
+    0xDA, 0xAD, 0xD9, 0xD4, 0x15, 0x99, 0x2B, 0x93, 0x73, 0xE3, 0xF3, 0x17, 0xDB, 0xE3, 0x4E, 0x22,
+    0xEC, 0x1D, 0xD8, 0xB7, 0x8E, 0xB0, 0xE7, 0x23, 0xBF, 0x08, 0xE4, 0xE2, 0xF3, 0x82, 0xA6, 0xBC,
+    0x26, 0x1C, 0xA6, 0x23, 0x0D, 0x69, 0x7A, 0x9F, 0xEF, 0xDC, 0xF3, 0x45, 0x70, 0x76, 0x15, 0x2E,
+    0x3D, 0x88, 0xDD, 0x3E, 0xD2, 0x01, 0x5D, 0x96, 0xBB, 0x5F, 0x81, 0x51, 0xEA, 0x28, 0x72, 0xFB,
+    0x29, 0xAD, 0xAF, 0x74, 0xD3, 0x05, 0x4C, 0xA4, 0x1D, 0x10, 0xF4, 0x1D, 0x43, 0x66, 0xCF, 0xA7,
+    0xF8, 0xE9, 0x60, 0x8A, 0xB7, 0x73, 0x5A, 0xD2, 0xB4, 0xBD, 0xA9, 0x57, 0x1B, 0xAA, 0x98, 0x6F,
+    0x36, 0x27, 0x9F, 0xA4, 0xC4, 0x85, 0xDC, 0x6E, 0xBB, 0xE5, 0xC9, 0x6E, 0x19, 0xA4, 0x72, 0x9A,
+    0xA8, 0xB6, 0x4C, 0x5F, 0x3F, 0xA8, 0x08, 0x76, 0xCD, 0x70, 0x43, 0xDF, 0x25, 0xFC, 0xAB, 0x08,
+    0xD9, 0x97, 0x54, 0xE7, 0xD4, 0xF5, 0x83, 0x9C, 0x78, 0x02, 0x04, 0x3E, 0x08, 0xDF, 0x29, 0x43,
+    0x1A, 0x6E, 0x4E, 0x5F, 0x90, 0xEE, 0x18, 0x13, 0xD2, 0x97, 0xB4, 0x4A, 0xE6, 0xC3, 0x68, 0x4E,
+    0x5F, 0x32, 0xEE, 0xF0, 0xF0, 0xB5, 0xBC, 0xD3, 0x17, 0xD8, 0x96, 0xC7, 0xCF, 0xDF, 0xE1, 0x6F,
+    0x5D, 0x05, 0xF8, 0x8D, 0xDC, 0xC9, 0xF1, 0xB9, 0x3C, 0x12, 0x74, 0xCC, 0x15, 0x53, 0xE9, 0x66,
+    0x1B, 0xA0, 0xD0, 0x8A, 0x5D, 0xC0, 0xC4, 0x9B, 0xA7, 0xB1, 0x14, 0xF5, 0x72, 0x3E, 0xB3, 0xC3,
+    0x5E, 0xB4, 0xDD, 0x17, 0xEC, 0xB7, 0x9B, 0xD2, 0xE6, 0xF6, 0x3E, 0x01, 0x77, 0xA3, 0xE7, 0xC6,
+    0x0E, 0x68, 0xA8, 0xB5, 0x42, 0xA1, 0xD4, 0xA1, 0x65, 0x94, 0xE0, 0x43, 0xB3, 0xA7, 0x02, 0x4F,
+    0xB1, 0x65, 0xE2, 0xDC, 0x33, 0xB9, 0xCA, 0xF3, 0x37, 0x8F, 0xDB, 0x1E, 0x1D, 0x0E, 0xE6, 0x74,
+    0xA7, 0xBF, 0x0F, 0xB2, 0x66, 0x85, 0x7C, 0x1B, 0x32, 0x57, 0x2C, 0x3F, 0xF6, 0x89, 0x4B, 0xEF,
+    0x33, 0x13, 0xF5, 0x59, 0x4D, 0x40, 0xAB, 0xE7, 0x32, 0x64, 0xFD, 0x89, 0xB3, 0xEE, 0x44, 0xC5,
+    0x7E, 0xEF, 0xE1, 0xF2, 0xA6, 0x1D, 0x73, 0x08, 0xEA, 0x1C, 0x56, 0x1D, 0xE7, 0x74, 0x8C, 0x2B,
+    0x38, 0xDD, 0x49, 0xE4, 0x70, 0xA5, 0xC7, 0x8D, 0xA5, 0x8E, 0x2E, 0xD7, 0x3C, 0x18, 0x36, 0x07,
+    0xEA, 0x21, 0x1D, 0xC8, 0xAE, 0x19, 0x87, 0xDC, 0x73, 0x93, 0xB5, 0xBA, 0xE2, 0xE0, 0x0B, 0x25,
+    0xEE, 0x6A, 0x48, 0xDD, 0xFF, 0x0F, 0x5F, 0x7B, 0xFF, 0x03, 0x1D, 0x94, 0x9A, 0x73, 0xE3, 0x75,
+    0x0C, 0xB4, 0x3E, 0x1F, 0x0F, 0x70, 0x5C, 0xD8, 0xA9, 0xEB, 0x74, 0xBA, 0xAF, 0x63, 0x00, 0xBB,
+    0x9C, 0x65, 0xC7, 0x9E, 0x24, 0xB4, 0xCA, 0xF5, 0x3F, 0x93, 0xA6, 0xD6, 0x52, 0xE8, 0xB8, 0xA5,
+    0xCF, 0x73, 0x79, 0x18, 0xC6, 0x1B, 0xB9, 0x8A, 0x31, 0x3F, 0x78, 0xA0, 0xFB, 0x23, 0x84, 0x23,
+    0x78, 0x38, 0xEA, 0x74, 0xC5, 0x71, 0x26, 0xA7, 0x6A, 0xD9, 0xC1, 0xBB, 0x7E, 0xE0, 0x40, 0xC7,
+    0x7C, 0x48, 0x9B, 0xD7, 0xB0, 0xEA, 0x1E, 0x14, 0x80, 0x9E, 0x8F, 0x3F, 0x53, 0x7D, 0xC1, 0xFF,
+    0xE4, 0xB7, 0x9B, 0xFF, 0xE3, 0x8D, 0x3F, 0x7F, 0xE6, 0xF1, 0x2B, 0xCF, 0x7D, 0x27, 0x38, 0x95,
+    0xF2, 0xC7, 0xA2, 0xF0, 0x18, 0xD6, 0x9B, 0x95, 0x7B, 0xDD, 0x63, 0xC1, 0x36, 0x46, 0xD1, 0x69,
+    0xA8, 0x3C, 0xAF, 0xA4, 0x01, 0xBA, 0xD3, 0xDF, 0x86, 0x80, 0x49, 0x0D, 0x4F, 0x8F, 0xC3, 0xF2,
+    0x37, 0x1A, 0xDF, 0xEF, 0xA5, 0xC2, 0xE5, 0x3B, 0x70, 0x63, 0x6E, 0xF7, 0x6A, 0xE0, 0xDE, 0xCD,
+    0x56, 0x66, 0x59, 0x1F, 0xAF, 0xBF, 0xE8, 0x97, 0xC7, 0x6F, 0x18, 0x4D, 0xA9, 0xB1, 0x47, 0xDF,
+    0x53, 0xE0, 0x15, 0x1E, 0xA7, 0xA5, 0xE9, 0xAC, 0xAF, 0x66, 0x13, 0x8A, 0xC8, 0xC6, 0xC3, 0x40,
+    0x3B, 0x99, 0x3F, 0xF7, 0x1F, 0xAF, 0xBB, 0xE5, 0x99, 0x42, 0x53, 0xB5, 0xB3, 0x3E, 0x5E, 0xF9,
+    0xB5, 0xFD, 0xB2, 0xEF, 0x77, 0xFA, 0x09, 0xDA, 0xA1, 0x7A, 0xDB, 0x3F, 0x66, 0x4B, 0xFF, 0xEB,
+    0x96, 0xF0, 0x58, 0xE3, 0xC7, 0x9D, 0x71, 0xA1, 0xF6, 0x8A, 0xE6, 0x82, 0xBF, 0xB5, 0xFF, 0x36,
+    0xDD, 0x67, 0x6B, 0x4E, 0x73, 0x2D, 0x13, 0x32, 0xB6, 0x54, 0x2B, 0xF2, 0x66, 0x45, 0x54, 0x6B,
+    0xB9, 0x53, 0x2F, 0x66, 0xC3, 0x2E, 0x66, 0xA3, 0x09, 0x75, 0xA4, 0x0D, 0x36, 0xE2, 0x42, 0xB3,
+    0xD2, 0xCF, 0xED, 0x8A, 0x26, 0xB7, 0x20, 0xDF, 0x87, 0x52, 0x7E, 0x0C, 0x46, 0x9E, 0x76, 0x30,
+    0x7F, 0x32, 0x3C, 0x66, 0x8B, 0x7F, 0xF7, 0x98, 0x7D, 0x26, 0x3C, 0x7E, 0xEF, 0xD9, 0x1F, 0x7D,
+    0xAE, 0x7E, 0x3D, 0xB4, 0x37, 0x86, 0x31, 0x16, 0x9A, 0x8A, 0x3B, 0x70, 0xA9, 0x6B, 0x26, 0x1B,
+    0xCA, 0x57, 0xF8, 0x38, 0xB6, 0xAB, 0x7C, 0x19, 0x58, 0xCB, 0xD7, 0xFE, 0xB9, 0x56, 0x6D, 0xDC,
+    0x98, 0xD0, 0x52, 0x4C, 0xAF, 0xC0, 0x2B, 0xB0, 0x62, 0x02, 0x76, 0xA2, 0x1F, 0xCC, 0x8E, 0xDD,
+    0x86, 0x46, 0xDE, 0xC9, 0x73, 0x1D, 0xAB, 0xEE, 0x23, 0xBF, 0x0A, 0xBF, 0x41, 0x35, 0x55, 0x1B,
+    0x6E, 0xA1, 0x0C, 0x1F, 0x6D, 0x06, 0x6D, 0x95, 0xE6, 0x2B, 0x1B, 0x70, 0x93, 0xC7, 0xB1, 0xDE,
+    0xBC, 0xC2, 0xF7, 0x86, 0xDF, 0xF8, 0x37, 0xF6, 0xB3, 0xFF, 0xA3, 0xB6, 0x47, 0xE5, 0xCD, 0xCC,
+    0xE3, 0x54, 0x53, 0x71, 0xEB, 0xA6, 0xDB, 0xCC, 0xC0, 0x3F, 0xCD, 0x63, 0xAA, 0x6C, 0xC7, 0xF2,
+    0x77, 0x5B, 0xA3, 0xD0, 0xC7, 0xF2, 0x0E, 0xB4, 0xC1, 0xC8, 0x3F, 0x4E, 0x31, 0x61, 0x5F, 0xA3,
+    0xDF, 0xCB, 0xF5, 0x15, 0xFB, 0x6C, 0x78, 0xBC, 0xF2, 0x77, 0x5E, 0x35, 0x0A, 0xE5, 0x86, 0xD3,
+    0x17, 0xB5, 0xD0, 0x60, 0x66, 0x9E, 0xC1, 0xFA, 0x62, 0xC1, 0x51, 0xCF, 0x44, 0xDA, 0xA1, 0xB8,
+    0x0A, 0x97, 0xBA, 0x52, 0x43, 0x6B, 0x09, 0x8F, 0x99, 0x37, 0x42, 0x2D, 0xDA, 0xB5, 0x9A, 0x96,
+    0x27, 0xCC, 0xB4, 0x8F, 0x46, 0x4B, 0xB9, 0xC3, 0x23, 0x5D, 0xA5, 0xEE, 0xB1, 0xA6, 0xF4, 0x8F,
+    0xFD, 0x0A, 0xE1, 0x37, 0x9A, 0x41, 0x1B, 0x0A, 0x54, 0xFE, 0xF7, 0x3E, 0x67, 0x34, 0xDF, 0x7F,
+    0x47, 0x9D, 0xEA, 0xAD, 0x83, 0x79, 0xDE, 0x67, 0x0E, 0x5B, 0x12, 0x6E, 0x7B, 0xE1, 0xA6, 0x17,
+    0x59, 0xBE, 0xD3, 0xBD, 0x4E, 0xB7, 0xE3, 0xC5, 0x66, 0x39, 0xE4, 0xBC, 0xF7, 0xF9, 0x93, 0xA9,
+    0x57, 0x4D, 0x87, 0xCA, 0x56, 0x3F, 0x6D, 0xEC, 0xC3, 0xF9, 0xEC, 0x87, 0x07, 0x7F, 0x2D, 0xA7,
+    0x5F, 0xEB, 0xA9, 0x07, 0xED, 0xF4, 0xAB, 0xDE, 0x39, 0x0D, 0x0F, 0x3E, 0x8A, 0x8D, 0xC5, 0x6F,
+    0x1D, 0x21, 0xFB, 0x15, 0x7F, 0x9F, 0x53, 0x4E, 0x2A, 0x9A, 0xB0, 0xB9, 0x99, 0xFB, 0x06, 0x13,
+    0xEF, 0x27, 0xCD, 0x1D, 0xFD, 0x71, 0x0D, 0xED, 0x29, 0x1A, 0xA9, 0x2E, 0xBC, 0xE7, 0x64, 0x6C,
+    0x52, 0x9D, 0xEC, 0x84, 0x43, 0xB8, 0xE9, 0xBE, 0xCF, 0xB5, 0xE1, 0xA7, 0x5C, 0xCF, 0xF9, 0xAB,
+    0xEE, 0xF4, 0xAB, 0x0F, 0xC7, 0x2C, 0x82, 0xE4, 0xA2, 0x7C, 0x8E, 0x5A, 0x8C, 0x06, 0x30, 0xA9,
+    0xF1, 0xA0, 0x7C, 0xE1, 0x25, 0x80, 0xFA, 0xEB, 0x09, 0x40, 0x7F, 0x33, 0x00, 0xB4, 0xE9, 0x66,
+    0x91, 0xAE, 0x9E, 0x00, 0x5E, 0x4B, 0xA1, 0x7E, 0x6C, 0x3A, 0xE0, 0xF2, 0x9E, 0xE0, 0xED, 0xD3,
+    0x30, 0xCE, 0xEE, 0x98, 0xA9, 0x95, 0xDB, 0xD4, 0x8D, 0x74, 0x3B, 0xF1, 0x61, 0xAC, 0x87, 0x56,
+    0x5B, 0xE3, 0xC1, 0xED, 0xD1, 0x75, 0xA0, 0xBB, 0x6B, 0x0F, 0x85, 0x7E, 0x14, 0x5E, 0x05, 0xA3,
+    0x3F, 0x9E, 0x23, 0x18, 0x7D, 0xED, 0x1B, 0x2B, 0xD4, 0xFA, 0xF2, 0x9B, 0x01, 0xAC, 0xFA, 0xA7,
+    0x67, 0xB0, 0x1A, 0xAD, 0x07, 0xAB, 0xBD, 0x19, 0xA0, 0x51, 0x74, 0xFF, 0x10, 0x1A, 0x6D, 0xFD,
+    0x6B, 0xE4, 0x81, 0x43, 0xC7, 0xAD, 0x79, 0x12, 0xCB, 0x27, 0x75, 0x67, 0x9C, 0xDF, 0xD4, 0x2B,
+    0xA7, 0x8B, 0x99, 0x6C, 0x1C, 0x5D, 0x9A, 0x22, 0xD0, 0x03, 0x98, 0x90, 0xB8, 0xB3, 0xDF, 0x49,
+    0x49, 0xCB, 0x9B, 0x0B, 0xC0, 0xA5, 0x07, 0xA7, 0x96, 0x5D, 0xD1, 0xF7, 0x13, 0xD4, 0x39, 0x1F,
+    0x83, 0xC3, 0xCE, 0x7B, 0x02, 0x56, 0x90, 0x7E, 0x70, 0xFB, 0xC8, 0x0C, 0xEA, 0x3C, 0x1F, 0x2B,
+    0x9C, 0x67, 0x73, 0xB9, 0xD4, 0xAC, 0x60, 0x7E, 0x12, 0x68, 0x44, 0x2F, 0x4A, 0xCD, 0xB5, 0x02,
+    0x6E, 0x43, 0x03, 0x46, 0x53, 0x33, 0x81, 0xDB, 0xCB, 0x08, 0x95, 0x56, 0xF7, 0x0F, 0x7D, 0xA6,
+    0x3E, 0x9B, 0x8B, 0x10, 0x51, 0x6E, 0x87, 0x69, 0xCE, 0xBB, 0xC3, 0xD2, 0x15, 0xCE, 0xA7, 0xBB,
+    0x46, 0xDC, 0xCF, 0x34, 0x9E, 0x8F, 0x9E, 0xDC, 0x51, 0x1A, 0x68, 0xF6, 0xCF, 0x44, 0xCC, 0xCE,
+    0x43, 0x43, 0xAA, 0x4C, 0x8C, 0x47, 0x2F, 0xD3, 0x50, 0x48, 0x5A, 0xB8, 0xD4, 0x3F, 0x7F, 0x76,
+    0xDC, 0xD7, 0xCB, 0x0D, 0xC7, 0xCD, 0x24, 0xDD, 0x01, 0x44, 0xCD, 0x59, 0x00, 0x93, 0x93, 0x4E,
+    0x83, 0xB9, 0x63, 0xCE, 0xE1, 0x53, 0x35, 0xD2, 0x48, 0x7A, 0x2B, 0xA1, 0x5D, 0x55, 0xE2, 0x4D,
+    0x5D, 0x80, 0x7F, 0xED, 0x02, 0xDC, 0x7A, 0x21, 0xD3, 0x49, 0x73, 0x75, 0xB2, 0x51, 0x12, 0xF2,
+    0x3A, 0xD1, 0x3D, 0x31, 0x5A, 0x71, 0x21, 0x85, 0xDD, 0x36, 0x6D, 0x98, 0x4F, 0x1F, 0x50, 0x30,
+    0x47, 0x7D, 0x3B, 0x57, 0xBB, 0x87, 0x71, 0x4A, 0x33, 0x74, 0x5D, 0xC8, 0x0D, 0x34, 0x69, 0x3E,
+    0x98, 0x24, 0xFD, 0xD1, 0xA9, 0x21, 0xA8, 0xD9, 0x9B, 0x3B, 0xE9, 0x03, 0x4F, 0x2B, 0x7D, 0xC0,
+    0xE7, 0xFB, 0x61, 0x05, 0x97, 0xD8, 0xC3, 0x6B, 0x6A, 0xA9, 0xEF, 0xB7, 0x32, 0xD7, 0x98, 0xD3,
+    0x3D, 0xAB, 0xAC, 0x7C, 0xA3, 0x89, 0x04, 0xDF, 0x87, 0x94, 0x98, 0xE5, 0xD2, 0xE4, 0xAD, 0x5B,
+    0xB9, 0x5D, 0x2E, 0xF7, 0xE4, 0xA4, 0xD2, 0xB6, 0x16, 0x30, 0x1B, 0x6D, 0x5A, 0x32, 0xE9, 0x1B,
+    0xE9, 0x14, 0x2E, 0x7D, 0x7A, 0x3F, 0xFB, 0xEC, 0x76, 0x95, 0x66, 0xA1, 0x0F, 0xA0, 0x6F, 0xDD,
+    0xC8, 0x1D, 0x71, 0x31, 0x6D, 0xE4, 0x74, 0x8C, 0xAE, 0x35, 0xE9, 0x9F, 0xE6, 0x90, 0xD4, 0x3B,
+    0xE7, 0xA4, 0x86, 0x8C, 0xA4, 0x8C, 0xE1, 0x02, 0x9A, 0x92, 0xC7, 0xE5, 0x8F, 0xCB, 0xC5, 0xE7,
+    0x72, 0x15, 0xF4, 0x08, 0x5E, 0x74, 0x22, 0xF2, 0x6C, 0x07, 0xB9, 0x26, 0xBD, 0x54, 0xDE, 0xF9,
+    0xF4, 0x92, 0x11, 0xBD, 0x9C, 0x22, 0xBA, 0x7C, 0x63, 0xCF, 0x22, 0xF2, 0x5A, 0x4E, 0x1D, 0x4D,
+    0xAE, 0x44, 0x0F, 0xD6, 0x53, 0xE8, 0x26, 0x1B, 0x23, 0xB4, 0x9A, 0xAA, 0x50, 0xAF, 0x14, 0xFB,
+    0x98, 0x18, 0x56, 0xB5, 0xFF, 0x50, 0x9A, 0x82, 0xF6, 0xC4, 0xD1, 0xA8, 0xB3, 0x42, 0x23, 0x0D,
+    0x94, 0x77, 0x72, 0x9D, 0xA4, 0xD2, 0x60, 0xF4, 0x54, 0x84, 0x5A, 0xDE, 0x2E, 0x75, 0x80, 0x4A,
+    0x43, 0x3F, 0xB9, 0x09, 0x50, 0x29, 0xD4, 0x41, 0x19, 0x6D, 0x34, 0x1B, 0xCC, 0x36, 0xB8, 0xD0,
+    0x2C, 0xD4, 0x77, 0xF5, 0xBA, 0x86, 0x71, 0x66, 0xD4, 0x56, 0xEF, 0x46, 0x43, 0x25, 0xCD, 0x6E,
+    0xB1, 0x3B, 0xB5, 0x76, 0xCE, 0xBA, 0x87, 0xAF, 0xBE, 0x6F, 0x07, 0x67, 0xB5, 0x40, 0x1D, 0x68,
+    0x26, 0x70, 0x03, 0x3D, 0xB0, 0x51, 0xA4, 0xFB, 0xDF, 0x56, 0x01, 0xDC, 0x40, 0xE3, 0x61, 0x83,
+    0x9E, 0x6B, 0x55, 0xA0, 0x8C, 0x66, 0x6E, 0x7D, 0x6E, 0x24, 0x7B, 0x53, 0xE7, 0x93, 0xF0, 0x14,
+    0x4C, 0xEC, 0x97, 0x1D, 0xEA, 0x77, 0xF4, 0xCD, 0x00, 0xED, 0xD7, 0x74, 0xC3, 0x83, 0xFA, 0x2D,
+    0x59, 0xB4, 0x7B, 0x0B, 0x58, 0xBD, 0x9D, 0x9A, 0x99, 0x72, 0xF7, 0xF9, 0xB8, 0x80, 0xD1, 0x37,
+    0x52, 0x75, 0xA6, 0x16, 0xE0, 0xD6, 0x76, 0x4D, 0x05, 0x70, 0x0F, 0x46, 0x85, 0x00, 0xBB, 0x56,
+    0x17, 0x4B, 0x92, 0xAF, 0x3D, 0x9F, 0x0B, 0xD6, 0xB9, 0xB1, 0x2B, 0x30, 0xA6, 0x59, 0xD6, 0xAB,
+    0xD1, 0x9F, 0x8D, 0x53, 0x33, 0xD9, 0x15, 0x37, 0x8C, 0xF4, 0x03, 0xAF, 0x9A, 0xB5, 0x8C, 0x94,
+    0x8B, 0x9D, 0xEC, 0xD7, 0x7F, 0xCF, 0x4E, 0x3D, 0xAE, 0x0E, 0xCE, 0xC4, 0x22, 0xBA, 0xD7, 0xA3,
+    0x9D, 0xEB, 0x79, 0xAF, 0xE7, 0xBE, 0x73, 0x4F, 0x2F, 0xEE, 0xC9, 0x48, 0x6C, 0xFD, 0x3F, 0xB2,
+    0xA1, 0x0A, 0x23, 0xF4, 0x43, 0xFB, 0x5C, 0xC4, 0x6C, 0x6C, 0x36, 0xD2, 0x86, 0x2A, 0xB4, 0xFB,
+    0xA7, 0xE5, 0x5B, 0xEF, 0xA4, 0x9D, 0x2D, 0x4F, 0xC0, 0x3D, 0x0D, 0xEB, 0xF8, 0xCD, 0xD7, 0x2E,
+    0x50, 0xDD, 0xC9, 0xB7, 0x26, 0x4A, 0x90, 0xC8, 0x05, 0x3E, 0xE3, 0x23, 0xE3, 0xDD, 0xE1, 0x88,
+    0xE3, 0xDB, 0x7F, 0x77, 0x42, 0x78, 0xE8, 0x53, 0xDF, 0xC0, 0xEF, 0xCB, 0x83, 0x1B, 0xFA, 0x09,
+    0x9A, 0xC1, 0x06, 0xA8, 0x7D, 0x15, 0xC1, 0x84, 0x72, 0x07, 0x56, 0xD4, 0x41, 0xFF, 0x2F, 0xF2,
+    0xC4, 0x9C, 0x70, 0x34, 0x3A, 0xE6, 0x63, 0x94, 0x7B, 0x7F, 0x9E, 0x7E, 0x9C, 0x20, 0xF1, 0x44,
+    0x50, 0xBD, 0x08, 0xF4, 0x5E, 0x3A, 0x23, 0x0F, 0x9E, 0x2B, 0x0E, 0x65, 0x4A, 0x46, 0x71, 0xC0,
+    0x6A, 0xF8, 0x68, 0xF6, 0x76, 0x46, 0xB7, 0xE7, 0x34, 0xD8, 0x27, 0x33, 0x32, 0x25, 0xAD, 0x5C,
+    0xBE, 0xBD, 0x1C, 0x59, 0x75, 0x46, 0xA2, 0x6F, 0x2B, 0x8D, 0x27, 0x56, 0x26, 0xE6, 0x1A, 0x69,
+    0x7F, 0xE1, 0x60, 0x63, 0x8C, 0xA9, 0x10, 0x7E, 0xF7, 0xF9, 0xA3, 0x2F, 0xAD, 0x39, 0x6E, 0xCC,
+    0x3A, 0x40, 0xAB, 0x0D, 0x78, 0xE8, 0x64, 0xE8, 0xDE, 0x3B, 0x49, 0x31, 0x91, 0x23, 0xFB, 0x5C,
+    0x0C, 0xEB, 0xA7, 0x8F, 0x00, 0xFA, 0xB7, 0x29, 0x49, 0xF4, 0x50, 0x1C, 0xF3, 0xD4, 0x07, 0x8A,
+    0xA3, 0x53, 0xAF, 0xCB, 0x24, 0x46, 0x6A, 0xED, 0x1F, 0x86, 0x0F, 0xDB, 0x7C, 0x2F, 0x8A, 0x64,
+    0x0B, 0x57, 0xB8, 0x9C, 0xCF, 0x60, 0xE3, 0x18, 0x77, 0xD7, 0x2B, 0x00, 0x7F, 0xA8, 0x19, 0x78,
+    0x32, 0xF7, 0xE8, 0x4C, 0x17, 0xBA, 0xBD, 0x1F, 0xBD, 0xF5, 0x62, 0x46, 0x4E, 0xB7, 0x4C, 0xF5,
+    0x3C, 0x10, 0xAC, 0x0D, 0x8A, 0x33, 0x3D, 0x7F, 0x63, 0x3B, 0xBB, 0x3A, 0x1E, 0x37, 0x64, 0x76,
+    0x01, 0xE7, 0x0F, 0xBB, 0x9A, 0xE8, 0x3D, 0x11, 0x70, 0xEF, 0xFE, 0x56, 0xCE, 0x6E, 0x8F, 0xFB,
+    0x82, 0x64, 0x32, 0xCE, 0xA9, 0x3B, 0x70, 0xB9, 0xEF, 0xD8, 0x89, 0x39, 0x97, 0x23, 0xF2, 0x7C,
+    0xB3, 0xD2, 0xD3, 0xCD, 0x96, 0xF2, 0x92, 0x1D, 0x3C, 0xAC, 0x76, 0x7B, 0xE0, 0xE9, 0xDC, 0xA5,
+    0x9E, 0x3F, 0xF5, 0xFF, 0x00, 0x75, 0x98, 0x31, 0xAC, 0xE5, 0xC6, 0x75, 0x86, 0x3F, 0x92, 0xD1,
+    0x63, 0x22, 0x22, 0x19, 0x15, 0x5A, 0x23, 0xD0, 0x22, 0xA1, 0x8B, 0x54, 0x42, 0x60, 0xB6, 0x2E,
+    0x02, 0x0C, 0x63, 0x17, 0x2E, 0x5C, 0x68, 0x03, 0xEC, 0x4B, 0xE1, 0x2A, 0x6D, 0xD2, 0x6C, 0x8A,
+    0x14, 0x29, 0x12, 0x91, 0x81, 0x0B, 0x17, 0x2A, 0xBC, 0x40, 0xD4, 0xDB, 0x85, 0x04, 0xC8, 0x4F,
+    0x01, 0xD4, 0xA8, 0x48, 0xA3, 0x9D, 0x49, 0x16, 0xF0, 0x16, 0x2A, 0x44, 0x47, 0x30, 0x52, 0xB8,
+    0x08, 0x23, 0x2B, 0x40, 0xA2, 0x46, 0xB3, 0x11, 0x9D, 0x70, 0x57, 0x43, 0xFE, 0x29, 0x0E, 0xEF,
+    0x7D, 0xFB, 0xD6, 0x0A, 0x81, 0xF7, 0x08, 0xDE, 0x3B, 0x97, 0x73, 0xE6, 0xFC, 0xFF, 0x39, 0xFF,
+    0x39, 0x07, 0x4E, 0x57, 0xB5, 0x02, 0x30, 0xF4, 0x00, 0x75, 0x02, 0x20, 0x00, 0xE0, 0x66, 0x00,
+    0x36, 0x80, 0x22, 0xE8, 0x27, 0x50, 0x4B, 0x4A, 0xD4, 0x92, 0x76, 0x0A, 0x49, 0x9A, 0x19, 0x24,
+    0xED, 0xB4, 0xFA, 0x32, 0x71, 0xA7, 0xD2, 0x12, 0x80, 0x21, 0xBB, 0x19, 0x9C, 0xFA, 0x1D, 0x0A,
+    0xCD, 0xED, 0x04, 0x3E, 0x97, 0x19, 0x2A, 0x45, 0x1F, 0x61, 0x58, 0xAA, 0xFD, 0x4D, 0x1A, 0xE1,
+    0xA5, 0x59, 0xA9, 0x96, 0x76, 0x27, 0x82, 0x34, 0x2B, 0xB9, 0x2F, 0xB5, 0x3B, 0xB1, 0x57, 0x9A,
+    0xB4, 0xB6, 0x53, 0x88, 0x4E, 0xFF, 0xB3, 0xDD, 0xCB, 0x48, 0x92, 0x62, 0x23, 0x49, 0x2B, 0x5E,
+    0x92, 0x7A, 0x24, 0x29, 0x51, 0x49, 0x5A, 0xA1, 0x94, 0xEE, 0x03, 0xEC, 0x66, 0xFA, 0x04, 0x50,
+    0x64, 0x00, 0xBA, 0x08, 0xC0, 0x1D, 0x00, 0x6E, 0xEB, 0x53, 0x00, 0x5A, 0x69, 0x02, 0xA8, 0x24,
+    0x5B, 0x15, 0xDE, 0xD3, 0x08, 0xF0, 0x1B, 0x0C, 0xE6, 0x04, 0x1A, 0xFB, 0x82, 0x52, 0x40, 0x71,
+    0x79, 0x79, 0xA9, 0x9F, 0x5F, 0xDE, 0xAD, 0x24, 0x49, 0xDA, 0x0B, 0xBB, 0x8B, 0xE3, 0x3E, 0x9E,
+    0xFC, 0xF9, 0xC2, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xE5, 0xDD, 0xDA, 0x3E, 0xCF, 0xBF, 0xF6, 0x83,
+    0x6E, 0x85, 0x1F, 0x03, 0x6E, 0xA7, 0xCE, 0x40, 0xA5, 0xFF, 0x08, 0x1A, 0x81, 0x20, 0x29, 0x01,
+    0x4E, 0x92, 0x38, 0x3E, 0xE8, 0xCD, 0xF9, 0x9F, 0x72, 0xE3, 0x2A, 0xEE, 0x18, 0x56, 0x4D, 0x32,
+    0x98, 0xC2, 0x4A, 0xA3, 0x0D, 0xAF, 0x0D, 0xE9, 0x1F, 0x4A, 0x05, 0xEA, 0x2D, 0xE0, 0xD6, 0x1D,
+    0x97, 0x36, 0xBA, 0xC7, 0x99, 0xEE, 0x93, 0x8C, 0xFF, 0xE5, 0x8A, 0xFF, 0x62, 0xC1, 0x6B, 0xA3,
+    0x93, 0x70, 0xD2, 0x58, 0x4B, 0x13, 0x61, 0x07, 0x3F, 0x82, 0xEF, 0xE1, 0x16, 0xD8, 0x99, 0x36,
+    0xB3, 0x78, 0xE1, 0xAB, 0xAE, 0x56, 0x92, 0x32, 0xDD, 0x33, 0x80, 0x2C, 0x0C, 0x86, 0xC8, 0xAD,
+    0x3E, 0xCC, 0xB7, 0xEE, 0x00, 0x32, 0xC7, 0xDB, 0xAD, 0x34, 0x17, 0x55, 0xEA, 0xED, 0x66, 0x2E,
+    0xB6, 0x9B, 0x33, 0xD4, 0xDA, 0xCD, 0xF0, 0x32, 0xBF, 0xFB, 0x83, 0x98, 0x66, 0x40, 0x30, 0x50,
+    0x94, 0x00, 0x0A, 0xCD, 0xF6, 0xCA, 0x03, 0x42, 0xDB, 0xE7, 0xD6, 0xE5, 0xE5, 0x5D, 0x06, 0x29,
+    0x23, 0x69, 0xC5, 0x6C, 0xEF, 0xA2, 0xD1, 0xA1, 0x94, 0x34, 0x57, 0x92, 0xA6, 0x4A, 0x52, 0x2C,
+    0xDF, 0xD5, 0x55, 0xEF, 0x24, 0x70, 0xCA, 0xD0, 0x6A, 0x86, 0x4E, 0x09, 0xBC, 0x16, 0x78, 0xC9,
+    0xAD, 0x80, 0xCB, 0xA7, 0x7F, 0x6D, 0x3E, 0x99, 0xE5, 0x33, 0x30, 0x64, 0x20, 0x64, 0xE0, 0x2F,
+    0xDE, 0x01, 0xB8, 0x02, 0xAA, 0x0C, 0xB4, 0xE9, 0x37, 0x21, 0xBC, 0x91, 0xA8, 0xA4, 0x91, 0x56,
+    0x1B, 0x17, 0xD2, 0x8C, 0xB4, 0x50, 0x6B, 0xFD, 0x06, 0x9D, 0x3E, 0x5F, 0xF8, 0x52, 0x8A, 0x45,
+    0x6B, 0xEE, 0xFF, 0xFB, 0xB7, 0x82, 0xEE, 0x77, 0x0F, 0xB5, 0x56, 0xBB, 0xFB, 0x7C, 0x0A, 0xE9,
+    0xCF, 0x86, 0x4E, 0x94, 0x52, 0xC2, 0x69, 0x83, 0x41, 0x3D, 0xC5, 0xDE, 0x5F, 0xBB, 0xFD, 0x2E,
+    0x18, 0xE8, 0xE0, 0xE3, 0x99, 0xEE, 0xF5, 0x0A, 0x94, 0xDA, 0x01, 0xAF, 0xFD, 0xC4, 0x69, 0x2F,
+    0x2D, 0x94, 0xD2, 0x30, 0xE1, 0x94, 0xD5, 0x33, 0xFC, 0xDB, 0x27, 0x1B, 0xA5, 0xFC, 0x77, 0x13,
+    0xEE, 0x57, 0xD9, 0x47, 0xFC, 0x87, 0x69, 0xA7, 0xD8, 0xFC, 0x0F, 0x16, 0x9A, 0xB4, 0x75, 0x11,
+    0xFF, 0x28, 0x09, 0xF6, 0xEE, 0xE1, 0x4A, 0xBD, 0xEC, 0xDD, 0x44, 0xF7, 0x70, 0x11, 0xA8, 0x7D,
+    0x98, 0xA9, 0x72, 0xE8, 0x26, 0xDA, 0x2F, 0xB2, 0x7A, 0x5E, 0xE8, 0x79, 0x19, 0x80, 0x17, 0xAF,
+    0x7E, 0x72, 0x04, 0xD1, 0x02, 0x14, 0x47, 0x1C, 0x1C, 0xAC, 0xF1, 0xD3, 0x85, 0x80, 0x36, 0xE1,
+    0x23, 0xB8, 0x8C, 0x4B, 0x50, 0x19, 0xEB, 0x0B, 0xF5, 0xB5, 0x00, 0xFD, 0xFC, 0x9E, 0xC6, 0x23,
+    0xBA, 0x8D, 0x46, 0x93, 0xF1, 0x7F, 0xA2, 0xB2, 0x04, 0x53, 0x1C, 0xD1, 0x35, 0x48, 0x4F, 0x00,
+    0xFC, 0x82, 0x25, 0x22, 0x45, 0x4A, 0x23, 0x1C, 0xC6, 0x42, 0x6E, 0xFD, 0xA9, 0x7E, 0x75, 0x17,
+    0x20, 0x18, 0x67, 0x7C, 0x3E, 0xB8, 0x7A, 0x70, 0xCD, 0x68, 0xC2, 0xD7, 0x01, 0x3E, 0x00, 0x8A,
+    0xFD, 0x04, 0x5C, 0xB3, 0x00, 0xED, 0x4C, 0x81, 0x8F, 0x45, 0x40, 0x45, 0x50, 0xB9, 0x07, 0xA9,
+    0x92, 0xF4, 0xC4, 0x49, 0x4F, 0xE8, 0xF4, 0x04, 0xFC, 0xDE, 0x1F, 0xAF, 0xAB, 0x35, 0x01, 0x76,
+    0xCC, 0xED, 0x94, 0x2B, 0xCA, 0xE5, 0x3A, 0xCF, 0xBC, 0x04, 0xF0, 0xB7, 0x00, 0x21, 0x42, 0xA1,
+    0x0C, 0xA5, 0x14, 0x0D, 0x9B, 0x5A, 0xD2, 0xE8, 0xF6, 0x30, 0xAC, 0xED, 0xE6, 0x1F, 0xE9, 0xB5,
+    0xEC, 0xE6, 0xE1, 0x9F, 0x96, 0x7A, 0xA9, 0xC7, 0x97, 0xCA, 0x0C, 0x20, 0xB0, 0x88, 0xA4, 0x9B,
+    0x00, 0x97, 0x4E, 0x86, 0x16, 0xFB, 0x39, 0x3F, 0xBF, 0x32, 0x02, 0xFC, 0x16, 0x80, 0x07, 0x18,
+    0x9E, 0x5D, 0xFE, 0x12, 0x55, 0x66, 0x18, 0x8B, 0x8D, 0x61, 0xEF, 0xC5, 0xA0, 0x3D, 0xC4, 0x4E,
+    0xD2, 0xCC, 0x3D, 0x69, 0x81, 0x7B, 0xCA, 0xC0, 0xB0, 0x03, 0x61, 0x85, 0x4A, 0x96, 0xB1, 0x8F,
+    0xD3, 0x74, 0x09, 0x70, 0x11, 0x28, 0xCF, 0x32, 0x91, 0xCF, 0x1B, 0xB7, 0xD3, 0x59, 0x36, 0x74,
+    0xCE, 0xAF, 0xF5, 0x72, 0xD0, 0xB1, 0x1A, 0x7D, 0xFC, 0xDD, 0x2A, 0x37, 0x4B, 0x1B, 0xF5, 0xEF,
+    0xBB, 0xCB, 0x8D, 0xFC, 0x47, 0x3B, 0x83, 0x24, 0x4A, 0x49, 0xD0, 0x4A, 0x80, 0x04, 0x34, 0xEA,
+    0x4F, 0xD2, 0x53, 0x9E, 0x13, 0x68, 0x31, 0x02, 0x23, 0x90, 0x8F, 0xBF, 0x07, 0x40, 0x37, 0xC2,
+    0x00, 0x54, 0x0B, 0xF8, 0x9E, 0x9E, 0x01, 0xBA, 0xF1, 0xB6, 0xEE, 0x37, 0x33, 0xED, 0x4F, 0x25,
+    0x7D, 0xBA, 0x19, 0x6F, 0xA4, 0xE8, 0xA4, 0xFB, 0x85, 0x94, 0x1B, 0x3D, 0x81, 0x22, 0xE8, 0xFB,
+    0x96, 0x79, 0x42, 0xF2, 0x0B, 0x40, 0x98, 0x2D, 0x15, 0x85, 0x99, 0x6E, 0x05, 0xC2, 0x44, 0xB1,
+    0x1D, 0xC7, 0xFA, 0x7D, 0xA0, 0x9C, 0x9E, 0x4F, 0x76, 0xF5, 0x68, 0x0C, 0x69, 0xD5, 0xD3, 0x29,
+    0xE1, 0x25, 0x86, 0xCF, 0x3F, 0x4F, 0x7A, 0xE3, 0xE3, 0xDD, 0x7F, 0x3B, 0xF9, 0x9A, 0x5C, 0xC2,
+    0xEB, 0x40, 0xD7, 0x9B, 0xDF, 0xEA, 0x04, 0xE5, 0x7A, 0x88, 0xA7, 0x07, 0x9A, 0x09, 0x8A, 0xF5,
+    0x78, 0x70, 0xD3, 0xF1, 0xED, 0x00, 0xFF, 0xE8, 0xE2, 0x5F, 0x0E, 0x0F, 0x97, 0xE1, 0x3B, 0xDB,
+    0x83, 0x61, 0xF2, 0xD2, 0x5C, 0x48, 0x33, 0x4E, 0xC9, 0x52, 0x5E, 0x9D, 0x4E, 0x84, 0xFD, 0x73,
+    0xF8, 0x9A, 0xD6, 0x22, 0x48, 0x73, 0x27, 0x3D, 0xED, 0x83, 0xDE, 0xA4, 0x90, 0xA0, 0xB6, 0x5C,
+    0xA3, 0x89, 0xE1, 0x91, 0x16, 0x54, 0x6A, 0xAD, 0x32, 0x61, 0x77, 0x09, 0xBF, 0xFB, 0x48, 0x3B,
+    0x3F, 0x85, 0x17, 0xE1, 0x6D, 0x00, 0xED, 0x3D, 0x48, 0x7A, 0x8B, 0x7B, 0x52, 0x86, 0xDB, 0xCA,
+    0x50, 0x2B, 0xC3, 0xA0, 0x4C, 0x69, 0x39, 0xFD, 0x07, 0xB9, 0xD0, 0x56, 0x67, 0xA7, 0xA9, 0xCE,
+    0x7E, 0xA7, 0x59, 0xDD, 0x4C, 0xB3, 0x56, 0x3D, 0x17, 0x6B, 0xD1, 0x43, 0x13, 0x8D, 0x67, 0x2E,
+    0x41, 0xB3, 0x14, 0x6B, 0x9D, 0xCB, 0x5C, 0x6D, 0xD5, 0x5A, 0xA8, 0x5A, 0xD0, 0x77, 0x12, 0xC3,
+    0x1B, 0x09, 0xFF, 0xD1, 0x4C, 0xAB, 0x88, 0x53, 0x7C, 0xB9, 0xD6, 0xE8, 0xA5, 0x7E, 0x90, 0x08,
+    0x12, 0x41, 0x3B, 0x7C, 0x6F, 0x3B, 0x9C, 0x5B, 0x02, 0x75, 0xB4, 0xB7, 0xB5, 0x69, 0xC0, 0x4F,
+    0x9E, 0x21, 0xFA, 0x5E, 0x7D, 0xF7, 0x77, 0xA2, 0xFD, 0xE7, 0x0D, 0xF7, 0x30, 0xE3, 0x7E, 0xB1,
+    0xD0, 0x28, 0x51, 0x6B, 0xA2, 0x52, 0x7C, 0xB9, 0x92, 0x72, 0x29, 0xE5, 0xC2, 0xD2, 0x7D, 0x46,
+    0x6F, 0xDA, 0xEB, 0xFE, 0x80, 0x73, 0xE0, 0x11, 0x7A, 0x00, 0x93, 0x50, 0x01, 0x54, 0x1B, 0x60,
+    0xAA, 0x6B, 0x6C, 0x89, 0x9D, 0x24, 0x4D, 0x5E, 0x92, 0xE6, 0x61, 0x06, 0x4C, 0xD2, 0x96, 0x5A,
+    0x27, 0x0D, 0x51, 0x3E, 0x04, 0xC9, 0xB4, 0xAA, 0xB4, 0x64, 0xF2, 0x01, 0x00, 0xDF, 0xFC, 0x0A,
+    0x65, 0xFC, 0x3A, 0x80, 0xFB, 0x1D, 0x80, 0xF6, 0xD1, 0x04, 0x74, 0x9F, 0x6C, 0x40, 0xB7, 0x28,
+    0x82, 0xCF, 0x3E, 0xC3, 0xA0, 0x56, 0x23, 0x83, 0xDE, 0xD0, 0x42, 0xD0, 0xC7, 0x5F, 0xAA, 0xD7,
+    0x2F, 0x1F, 0xE7, 0x21, 0xE9, 0x67, 0x39, 0x34, 0x9B, 0x8F, 0x0F, 0xFC, 0xB8, 0xD5, 0xD1, 0xBF,
+    0x36, 0xFD, 0x1E, 0xBD, 0x7B, 0x94, 0x80, 0xFA, 0xBF, 0x2D, 0xBF, 0xEC, 0x00, 0xD9, 0xF7, 0x80,
+    0x6F, 0x23, 0xD0, 0xBE, 0x31, 0x03, 0xCD, 0xC7, 0x0B, 0x50, 0xA5, 0x0C, 0x14, 0x79, 0x00, 0x78,
+    0xD0, 0x8D, 0xCF, 0x3A, 0x24, 0x5F, 0xC7, 0xB0, 0x39, 0xC1, 0x1C, 0x62, 0xCE, 0x61, 0xB0, 0xCA,
+    0x6A, 0x72, 0x92, 0x94, 0xDC, 0x91, 0x4E, 0xA1, 0xCD, 0x5E, 0x92, 0x92, 0x97, 0xA4, 0xD1, 0x4A,
+    0xBD, 0x53, 0x7A, 0x2D, 0x14, 0xAF, 0x5F, 0x63, 0x60, 0xFE, 0xD5, 0x73, 0xAE, 0x70, 0x0F, 0xD3,
+    0xB5, 0xD5, 0xAF, 0x9B, 0x12, 0x3F, 0x4A, 0x40, 0xB5, 0x6C, 0x00, 0x0F, 0xFC, 0x08, 0xB4, 0x1F,
+    0x26, 0xA0, 0x7A, 0x9C, 0x01, 0x36, 0xDF, 0x53, 0xF4, 0xDD, 0x0F, 0x67, 0x58, 0xEB, 0xC7, 0xB9,
+    0x8A, 0x21, 0x66, 0x5F, 0x6E, 0x6D, 0xEE, 0x5E, 0xFB, 0x99, 0xA2, 0xFE, 0xF5, 0x93, 0x55, 0x93,
+    0x53, 0x1E, 0xC2, 0x4C, 0x90, 0x53, 0xA2, 0xD6, 0xC7, 0x4A, 0x30, 0xAC, 0x21, 0x41, 0xA5, 0x76,
+    0x01, 0xBA, 0x8F, 0x57, 0xA0, 0x5C, 0x33, 0x40, 0xFB, 0x87, 0x56, 0x96, 0x1D, 0xAE, 0x28, 0x46,
+    0xEA, 0xC9, 0x18, 0x12, 0x7A, 0x68, 0x67, 0xDC, 0x02, 0x85, 0xEC, 0x24, 0x6E, 0xC1, 0x4F, 0xC0,
+    0x30, 0x5A, 0x69, 0xB6, 0x1D, 0xE5, 0x5D, 0xEA, 0xEC, 0xFE, 0xFD, 0xA3, 0xA8, 0x33, 0xAA, 0x84,
+    0x7F, 0xB1, 0xC7, 0xD5, 0x6A, 0xBD, 0x53, 0x06, 0x82, 0x2E, 0x53, 0x69, 0x84, 0x90, 0xD0, 0x0C,
+    0xA5, 0x70, 0xAB, 0x25, 0x81, 0xD7, 0x8D, 0x36, 0x55, 0x7C, 0xC6, 0x4D, 0x0B, 0x50, 0xEE, 0x27,
+    0x51, 0x69, 0xB5, 0xF7, 0x78, 0x69, 0x45, 0x3F, 0x52, 0xAE, 0xD4, 0xBE, 0xB7, 0x38, 0xB5, 0xDF,
+    0x9A, 0xBC, 0xDA, 0x1E, 0xA9, 0xED, 0x19, 0x42, 0xDB, 0x53, 0xF8, 0xB6, 0x87, 0xFF, 0xEF, 0x5F,
+    0xE1, 0x4F, 0xEB, 0xA4, 0xB6, 0xC7, 0xAB, 0xED, 0x71, 0x6A, 0xBF, 0x35, 0x55, 0x6A, 0xDF, 0x5B,
+    0xD0, 0x8F, 0x94, 0xF1, 0x52, 0xB6, 0xDD, 0x6A, 0xCD, 0x87, 0x05, 0x2C, 0xCF, 0xD4, 0x19, 0xF5,
+    0x76, 0x16, 0xD1, 0xF2, 0xE0, 0xC3, 0x7C, 0x16, 0x1A, 0xD3, 0x29, 0x97, 0x0E, 0xA1, 0x2A, 0x1F,
+    0x94, 0x19, 0x82, 0x5E, 0x4B, 0xB4, 0xA7, 0xE2, 0x3C, 0xE3, 0xF6, 0x4A, 0x33, 0x61, 0xAA, 0xD5,
+    0x57, 0x3B, 0x2E, 0xD3, 0x26, 0xFC, 0x44, 0x88, 0x85, 0xA8, 0x76, 0xDC, 0x82, 0xDB, 0x4A, 0x13,
+    0xFE, 0x0C, 0x41, 0x9A, 0x40, 0xDA, 0xA1, 0x90, 0x66, 0x28, 0xB4, 0x81, 0x55, 0xA4, 0xCF, 0x33,
+    0x0B, 0xE0, 0x42, 0xB3, 0x7A, 0x28, 0x65, 0x25, 0xFC, 0x20, 0x29, 0x42, 0x23, 0x69, 0x03, 0xC2,
+    0x5E, 0x68, 0x85, 0x46, 0xA3, 0x33, 0x82, 0x60, 0x45, 0xC5, 0xE8, 0xA4, 0x9E, 0x2E, 0xA3, 0x5F,
+    0xEC, 0xA0, 0xC9, 0x6D, 0xDD, 0x4A, 0x23, 0xC2, 0x14, 0x66, 0xFC, 0xD2, 0x6C, 0xA5, 0x7A, 0x14,
+    0xC3, 0xE4, 0x36, 0xEA, 0xBD, 0xD9, 0xF0, 0x89, 0x6E, 0x09, 0x53, 0xA1, 0x88, 0x3E, 0xDC, 0x69,
+    0x76, 0x2A, 0x85, 0x19, 0xBF, 0xD0, 0x6A, 0xA7, 0x52, 0x64, 0xD0, 0xCC, 0xB0, 0x53, 0x48, 0x7F,
+    0x72, 0xEF, 0xE8, 0x8F, 0x8E, 0x9C, 0x2C, 0xCB, 0xAC, 0x92, 0x66, 0xFB, 0x78, 0xB7, 0xAA, 0x5E,
+    0x33, 0xCD, 0x1E, 0xA4, 0x0D, 0xBA, 0xF9, 0xB6, 0x9E, 0x02, 0xBF, 0xFD, 0xEB, 0xA7, 0x2C, 0xAF,
+    0xAE, 0xF3, 0x4E, 0xAB, 0x1E, 0xF0, 0xEA, 0x01, 0x69, 0x3C, 0xAA, 0x09, 0xEA, 0x5D, 0x11, 0x5C,
+    0xD6, 0x04, 0x7E, 0xD1, 0x04, 0x61, 0x0E, 0x33, 0x85, 0x62, 0x48, 0xD4, 0x62, 0x48, 0xB8, 0x9D,
+    0x21, 0xD1, 0x65, 0xFC, 0x42, 0x48, 0xF8, 0xB5, 0xD0, 0x84, 0xCF, 0x95, 0x22, 0x3E, 0x3B, 0x41,
+    0x97, 0x5B, 0x5D, 0x5E, 0x0E, 0x9B, 0x97, 0x24, 0x8B, 0xF8, 0x3C, 0x48, 0xD2, 0x1A, 0xAC, 0xAE,
+    0x97, 0xA4, 0xB5, 0x92, 0xA4, 0xA9, 0x95, 0x24, 0xEE, 0xED, 0xEF, 0xEA, 0x1D, 0xDA, 0xD4, 0x64,
+    0x08, 0xA3, 0x9F, 0xA9, 0x36, 0xD4, 0xE3, 0x52, 0x9D, 0x21, 0xC4, 0x2E, 0x51, 0xED, 0x68, 0xC4,
+    0x2D, 0xD5, 0x06, 0x43, 0x6C, 0x13, 0xA5, 0x08, 0x11, 0xB7, 0x56, 0x3B, 0xF8, 0xC9, 0x2D, 0x14,
+    0x62, 0x88, 0x34, 0xB9, 0xDC, 0xC1, 0xCF, 0x6E, 0x01, 0xF5, 0x43, 0xA4, 0xCE, 0xA5, 0xA0, 0x9B,
+    0xDD, 0x0A, 0xEA, 0xFD, 0x59, 0x8B, 0x6F, 0xF5, 0xB7, 0xEE, 0x50, 0x88, 0x10, 0xA9, 0xB6, 0x42,
+    0xE0, 0xD6, 0x6A, 0x83, 0x2E, 0x35, 0xEB, 0xB1, 0x83, 0x2D, 0xB7, 0x8D, 0x9B, 0x5C, 0x0A, 0xDA,
+    0x54, 0xE7, 0x63, 0x37, 0x34, 0xFA, 0xF9, 0x30, 0xA2, 0xCA, 0x85, 0x38, 0x6C, 0xB3, 0x8D, 0x86,
+    0xD8, 0xD9, 0xEF, 0x23, 0xD5, 0xCE, 0xD1, 0x5A, 0x2E, 0x56, 0x80, 0x36, 0x92, 0x14, 0x5F, 0xB9,
+    0xBA, 0xBA, 0xBA, 0x32, 0xD1, 0xE8, 0x2B, 0x49, 0xB1, 0x90, 0x94, 0x08, 0x4F, 0xAF, 0xDE, 0xB2,
+    0xEE, 0xA0, 0x34, 0x7C, 0x12, 0xD0, 0xEC, 0x00, 0x9A, 0x4E, 0x8D, 0x43, 0xB5, 0x5F, 0x57, 0x73,
+    0x11, 0x18, 0xE2, 0xD1, 0x14, 0x95, 0x1A, 0xA1, 0xB6, 0x7F, 0x9F, 0x5D, 0x8D, 0x95, 0xAC, 0x59,
+    0xB0, 0x4E, 0xCA, 0x9A, 0x2B, 0x3B, 0x3B, 0xEF, 0x49, 0x31, 0x48, 0x69, 0x90, 0xB2, 0xDF, 0xAF,
+    0xDE, 0x3E, 0xF5, 0x60, 0xD1, 0x8A, 0xEF, 0x64, 0xDD, 0xE2, 0x06, 0xE0, 0x9E, 0xDE, 0xBD, 0xCE,
+    0xF5, 0x47, 0xB0, 0x9E, 0x02, 0xF5, 0x08, 0xF2, 0x53, 0xF3, 0x60, 0x59, 0xE9, 0x9C, 0xC4, 0xF1,
+    0xF3, 0x8D, 0xBE, 0xF7, 0xE8, 0x69, 0xBD, 0xFD, 0xB4, 0x96, 0x95, 0xB5, 0x9A, 0x80, 0x6A, 0x32,
+    0x4D, 0xF4, 0xDF, 0x57, 0xFF, 0x8C, 0x09, 0xDE, 0x4C, 0x30, 0x6A, 0x42, 0x7B, 0x34, 0x8F, 0xC7,
+    0x31, 0x9C, 0xB5, 0x6B, 0x5C, 0xBD, 0x73, 0x83, 0xE5, 0xB7, 0xD5, 0x87, 0x44, 0x29, 0xFD, 0xD0,
+    0x4A, 0xAB, 0xA3, 0x4F, 0x93, 0x62, 0xFB, 0xA4, 0xD6, 0x34, 0xA0, 0xB1, 0x5A, 0xC9, 0xD5, 0x8A,
+    0x1B, 0xAB, 0xD4, 0x45, 0xFE, 0x88, 0x2E, 0x8A, 0x72, 0x2D, 0xB7, 0x2A, 0x33, 0x9C, 0x04, 0x4B,
+    0xA3, 0x31, 0xD7, 0xE2, 0x2B, 0x22, 0x7D, 0xA1, 0x15, 0xC2, 0x56, 0xEC, 0xFD, 0x8D, 0x1C, 0x52,
+    0x5A, 0x43, 0x55, 0x9E, 0xFA, 0x7E, 0xB3, 0xB5, 0xDB, 0xFE, 0x06, 0xC3, 0xAA, 0x3F, 0x15, 0xED,
+    0xA6, 0x07, 0xCF, 0x88, 0x3E, 0x07, 0x1D, 0xEB, 0x9B, 0x0E, 0x6A, 0xBF, 0xD2, 0xB7, 0x67, 0x2F,
+    0xF6, 0xCF, 0x2E, 0xAA, 0xF6, 0x1B, 0x6F, 0x7A, 0x6E, 0x51, 0x77, 0xB8, 0x7A, 0x07, 0xB8, 0xF8,
+    0x63, 0x45, 0xA0, 0x31, 0x2D, 0xAE, 0x0E, 0x32, 0xF8, 0x63, 0x6E, 0x71, 0x28, 0x74, 0x65, 0x1E,
+    0xE7, 0xE2, 0xEA, 0xB9, 0x92, 0x75, 0xC3, 0x6D, 0xB4, 0x19, 0x9F, 0x19, 0x32, 0x21, 0x63, 0xEB,
+    0x6F, 0x5E, 0x95, 0xA8, 0x85, 0x13, 0x6E, 0xA7, 0xDB, 0xF1, 0x1B, 0xE1, 0x54, 0x96, 0x71, 0x6F,
+    0x29, 0x7F, 0x4C, 0xA7, 0xC9, 0xC7, 0x46, 0xAA, 0x57, 0xF4, 0xDD, 0x45, 0x7D, 0x97, 0xBC, 0x66,
+    0x64, 0xBE, 0x6B, 0xF6, 0xD3, 0x66, 0x3B, 0xAF, 0x52, 0x2A, 0xD7, 0x2B, 0x41, 0x49, 0x7D, 0x9B,
+    0x82, 0x52, 0xA5, 0x4A, 0x99, 0x17, 0xE7, 0xF3, 0xAA, 0xF3, 0xE0, 0xE2, 0x14, 0x0C, 0xA7, 0xD1,
+    0x93, 0x39, 0xEC, 0x20, 0xEC, 0xF1, 0xB0, 0x5D, 0x13, 0xD2, 0xC6, 0x22, 0x16, 0x86, 0x06, 0x6E,
+    0x5F, 0x7F, 0x16, 0xAC, 0x1B, 0x34, 0xBF, 0x1D, 0x28, 0x85, 0xCF, 0xC2, 0x6C, 0x5D, 0xE3, 0xD1,
+    0x4A, 0xDA, 0x43, 0xE6, 0x55, 0xDD, 0xD8, 0x61, 0x7A, 0x06, 0x08, 0xF3, 0xF8, 0x81, 0xEF, 0xE1,
+    0xFE, 0xCB, 0x6B, 0x73, 0x5F, 0x32, 0xA3, 0xED, 0xFD, 0x6D, 0xB6, 0x60, 0xB1, 0xB2, 0x42, 0x1B,
+    0x27, 0x9D, 0x3A, 0x5A, 0x9A, 0xC2, 0xDA, 0xDE, 0xD6, 0x86, 0x36, 0xDD, 0x21, 0x99, 0x36, 0xAA,
+    0x70, 0x36, 0x9E, 0xEA, 0x24, 0xDD, 0x87, 0x17, 0x82, 0xDD, 0x8B, 0x60, 0xD2, 0x75, 0x61, 0x92,
+    0xC5, 0x85, 0xD5, 0x57, 0x34, 0x82, 0x57, 0xEE, 0xC0, 0x6D, 0xE8, 0xF4, 0xF4, 0xCE, 0xF1, 0xC3,
+    0x7D, 0xB4, 0x63, 0x25, 0xF8, 0x5E, 0x38, 0x06, 0x33, 0x2F, 0xBC, 0x9B, 0x9F, 0x07, 0xF5, 0x10,
+    0x92, 0xCE, 0x18, 0xE6, 0x0F, 0x4F, 0x1A, 0x6B, 0xDA, 0x73, 0x80, 0x4E, 0x56, 0xEB, 0x5A, 0x41,
+    0x7C, 0x3C, 0x0E, 0x3A, 0x0A, 0xDD, 0x15, 0xE0, 0x9E, 0x16, 0xE0, 0xB6, 0x94, 0xE0, 0xB6, 0xA4,
+    0x95, 0xDB, 0x92, 0x9E, 0x80, 0xD7, 0x69, 0xD4, 0xD0, 0x03, 0xC3, 0xD1, 0x5D, 0xDD, 0x07, 0xE0,
+    0x53, 0xB8, 0xF5, 0x0E, 0xF0, 0xB5, 0xA0, 0x4C, 0x19, 0x24, 0x65, 0x83, 0x2E, 0xD3, 0x4A, 0x7A,
+    0xBB, 0xC7, 0x7F, 0x76, 0xE7, 0x86, 0xB9, 0x8D, 0x68, 0x04, 0xAD, 0xA2, 0xB5, 0x0B, 0xB3, 0xD3,
+    0x4C, 0xA3, 0xA5, 0xD1, 0x42, 0x95, 0xA9, 0x32, 0x94, 0x9B, 0x05, 0x97, 0x40, 0xBD, 0xE9, 0xE8,
+    0x4F, 0x27, 0xCB, 0x11, 0xC9, 0x0A, 0xB4, 0x6C, 0x22, 0xBB, 0x53, 0xA8, 0x2F, 0xD4, 0x43, 0x88,
+    0x84, 0x08, 0x3E, 0xE1, 0x13, 0xB8, 0x15, 0xB7, 0x42, 0xBD, 0x51, 0x6F, 0x50, 0xC9, 0xC6, 0x4F,
+    0x8A, 0x28, 0xC2, 0x30, 0x33, 0xCC, 0xD0, 0x2D, 0x74, 0x8B, 0x8D, 0x29, 0x32, 0xD4, 0xB6, 0xA6,
+    0x54, 0x2C, 0x15, 0x41, 0x33, 0x86, 0x23, 0xF0, 0xEA, 0x78, 0x5D, 0x1C, 0xA1, 0x08, 0x21, 0xB5,
+    0x19, 0x06, 0x55, 0x66, 0xBF, 0xCF, 0x94, 0xDA, 0x6A, 0xF5, 0x07, 0x97, 0x1B, 0x63, 0xB9, 0x8C,
+    0x3C, 0x8F, 0xDF, 0xB7, 0x20, 0xAE, 0x3E, 0xA5, 0x92, 0xD2, 0x30, 0x32, 0x68, 0x6F, 0x16, 0x18,
+    0x26, 0x04, 0x8D, 0x4D, 0x49, 0x14, 0x8B, 0x1D, 0xDC, 0x4A, 0x17, 0x29, 0xD4, 0x57, 0x19, 0x7C,
+    0x62, 0x18, 0xA9, 0x44, 0xB3, 0xC2, 0x30, 0xA3, 0x9E, 0x66, 0xA3, 0x4D, 0xA0, 0x58, 0x0A, 0xDA,
+    0x8C, 0x4F, 0x94, 0x8A, 0xD5, 0x0E, 0x7E, 0x25, 0xCC, 0x00, 0x17, 0x1F, 0x1C, 0x56, 0x7F, 0x63,
+    0x84, 0x90, 0xAA, 0x0C, 0x83, 0x18, 0xCC, 0xD1, 0x0B, 0xA5, 0x36, 0x04, 0x3E, 0xD2, 0xCE, 0x34,
+    0x2B, 0xD5, 0x86, 0x3D, 0x17, 0x7A, 0xFC, 0x7E, 0xBD, 0xE2, 0x25, 0xD4, 0x57, 0x52, 0x72, 0x89,
+    0x41, 0x7B, 0x21, 0x18, 0x26, 0xBA, 0x89, 0xC6, 0xA0, 0x51, 0x64, 0x88, 0xB8, 0x95, 0x66, 0xA5,
+    0x50, 0x8F, 0x7A, 0x7C, 0xA2, 0x4D, 0x54, 0xA2, 0xDC, 0x61, 0x98, 0xF1, 0x13, 0xCD, 0x76, 0x5E,
+    0xAC, 0xBE, 0xCD, 0x38, 0xA5, 0x52, 0x11, 0x09, 0xBF, 0x5A, 0xAF, 0x6B, 0xD7, 0xC5, 0x5B, 0xDC,
+    0x50, 0x22, 0x0A, 0x8D, 0x5C, 0x28, 0x5E, 0xE8, 0xA3, 0x0D, 0xC2, 0x4E, 0xD8, 0x87, 0x85, 0x5A,
+    0x4B, 0xA3, 0xFF, 0x55, 0xC4, 0x2B, 0x7A, 0x7D, 0x24, 0x8A, 0xFD, 0x88, 0x60, 0x97, 0xAE, 0x2B,
+    0xD2, 0x21, 0x9E, 0xC2, 0xE6, 0xF6, 0x69, 0xA2, 0xB9, 0xFF, 0xE7, 0x51, 0x9B, 0x7D, 0x9E, 0xAC,
+    0xCD, 0xD3, 0x10, 0x71, 0x99, 0x26, 0x17, 0x3B, 0xF8, 0x19, 0x3F, 0x37, 0xE9, 0x38, 0x86, 0x8F,
+    0x34, 0xE7, 0x6F, 0x12, 0x3E, 0x35, 0xCB, 0xC1, 0x18, 0x1F, 0xA9, 0x77, 0xEA, 0xBD, 0xD0, 0x41,
+    0x9A, 0x66, 0x3D, 0x7D, 0x33, 0x51, 0x8B, 0x5A, 0xA8, 0xA7, 0x5B, 0xE9, 0xD6, 0x26, 0x83, 0x26,
+    0x34, 0xF9, 0x74, 0xB0, 0xEE, 0x34, 0x83, 0x2A, 0xC3, 0x75, 0x04, 0x18, 0x34, 0xCF, 0xA0, 0x73,
+    0x06, 0x48, 0x73, 0xB3, 0x50, 0x6A, 0xBB, 0x86, 0xE9, 0x40, 0x6A, 0x79, 0x06, 0x2C, 0xF5, 0xF8,
+    0x58, 0x48, 0xD2, 0xE3, 0xF7, 0xEB, 0x6C, 0x29, 0xE2, 0x40, 0x4D, 0x27, 0xE0, 0x6C, 0x00, 0x0D,
+    0xC3, 0x74, 0x0D, 0xDF, 0x35, 0x82, 0x67, 0x10, 0xCF, 0x38, 0x5E, 0x43, 0x79, 0x46, 0xF3, 0x1A,
+    0xD0, 0x33, 0xA6, 0xD7, 0xB0, 0x5E, 0x23, 0x9B, 0x69, 0x94, 0x8E, 0xB0, 0x31, 0x7C, 0x6F, 0x42,
+    0x7C, 0xFF, 0x88, 0xFA, 0xE3, 0x83, 0x93, 0x94, 0x56, 0x27, 0xDD, 0x11, 0xD0, 0xE9, 0x3E, 0x43,
+    0x84, 0x41, 0x9B, 0x93, 0x12, 0xFE, 0xA9, 0x6A, 0x29, 0xD3, 0xC5, 0xE2, 0xDB, 0x92, 0x70, 0x13,
+    0xC5, 0xBB, 0xBA, 0x1A, 0xAB, 0xE5, 0x90, 0x80, 0xF0, 0xA6, 0x55, 0x55, 0x4E, 0x33, 0xDD, 0x6C,
+    0x15, 0xB2, 0xB3, 0x39, 0xE1, 0x62, 0x3B, 0xD4, 0x3A, 0xE4, 0x59, 0x51, 0x3D, 0xFC, 0x35, 0x21,
+    0xF9, 0xFF, 0xBA, 0xCF, 0xF0, 0x54, 0x6B, 0xAB, 0x95, 0x20, 0xE5, 0x46, 0x3B, 0xC1, 0x06, 0xF6,
+    0x63, 0x23, 0xAD, 0x04, 0xCD, 0xDC, 0xD6, 0xFD, 0x1B, 0xD9, 0xEA, 0xFF, 0x00,
 };
 
 static const EpdGlyph opendyslexic_14_bolditalicGlyphs[] = {
@@ -2606,7 +2607,7 @@ static const EpdGlyph opendyslexic_14_bolditalicGlyphs[] = {
     { 12, 27, 11, 2, 22, 81, 12011 }, // |
     { 19, 30, 20, -1, 23, 143, 12092 }, // }
     { 12, 7, 14, 6, 22, 21, 12235 }, // ~
-    { 0, 0, 25, 0, 0, 0, 0 }, //  
+    { 0, 0, 25, 0, 0, 0, 12256 }, //  
     { 15, 37, 15, 3, 32, 139, 0 }, // ¡
     { 16, 27, 23, 3, 22, 108, 139 }, // ¢
     { 22, 26, 20, 1, 25, 143, 247 }, // £
@@ -2617,625 +2618,631 @@ static const EpdGlyph opendyslexic_14_bolditalicGlyphs[] = {
     { 16, 7, 16, 5, 24, 28, 853 }, // ¨
     { 15, 13, 20, 8, 28, 49, 881 }, // ©
     { 10, 10, 19, 9, 22, 25, 930 }, // ª
-    { 20, 16, 24, 3, 15, 80, 955 }, // «
-    { 16, 11, 18, 3, 11, 44, 1035 }, // ¬
-    { 16, 4, 18, 3, 11, 16, 1079 }, // ­
-    { 15, 13, 20, 9, 32, 49, 1095 }, // ®
-    { 13, 5, 15, 6, 22, 17, 1144 }, // ¯
-    { 16, 13, 20, 6, 22, 52, 1161 }, // °
-    { 22, 21, 24, 0, 16, 116, 1213 }, // ±
-    { 10, 11, 9, 10, 24, 28, 1329 }, // ²
-    { 10, 11, 10, 10, 24, 28, 1357 }, // ³
-    { 9, 7, 8, 5, 23, 16, 1385 }, // ´
-    { 24, 21, 25, -1, 17, 126, 1401 }, // µ
-    { 22, 25, 22, 2, 21, 138, 1527 }, // ¶
-    { 8, 7, 8, 2, 14, 14, 1665 }, // ·
-    { 9, 9, 10, -1, 1, 21, 1679 }, // ¸
-    { 9, 12, 9, 10, 25, 27, 1700 }, // ¹
-    { 11, 10, 19, 9, 21, 28, 1727 }, // º
-    { 20, 16, 22, -4, 15, 80, 1755 }, // »
-    { 31, 27, 38, 2, 25, 210, 1835 }, // ¼
-    { 33, 27, 38, 2, 25, 223, 2045 }, // ½
-    { 31, 28, 38, 2, 26, 217, 2268 }, // ¾
-    { 22, 37, 19, -2, 21, 204, 2485 }, // ¿
-    { 25, 33, 33, 2, 33, 207, 2689 }, // À
-    { 26, 38, 33, 2, 38, 247, 2896 }, // Á
-    { 26, 34, 33, 2, 34, 221, 3143 }, // Â
-    { 26, 34, 33, 2, 34, 221, 3364 }, // Ã
-    { 28, 35, 33, 2, 35, 245, 3585 }, // Ä
-    { 25, 35, 33, 2, 35, 219, 3830 }, // Å
-    { 40, 26, 40, 2, 25, 260, 4049 }, // Æ
-    { 26, 35, 28, 2, 27, 228, 4309 }, // Ç
-    { 24, 35, 26, 2, 35, 210, 4537 }, // È
-    { 24, 39, 26, 2, 39, 234, 4747 }, // É
-    { 24, 35, 26, 2, 35, 210, 4981 }, // Ê
-    { 25, 36, 26, 2, 36, 225, 5191 }, // Ë
-    { 16, 38, 15, 2, 37, 152, 5416 }, // Ì
-    { 18, 42, 15, 2, 41, 189, 5568 }, // Í
-    { 18, 38, 15, 2, 37, 171, 5757 }, // Î
-    { 20, 39, 15, 2, 38, 195, 5928 }, // Ï
-    { 29, 25, 30, 0, 25, 182, 6123 }, // Ð
-    { 28, 34, 30, 2, 34, 238, 6305 }, // Ñ
-    { 29, 36, 32, 3, 34, 261, 6543 }, // Ò
-    { 29, 41, 32, 3, 39, 298, 6804 }, // Ó
-    { 29, 37, 32, 3, 35, 269, 7102 }, // Ô
-    { 29, 37, 32, 3, 35, 269, 7371 }, // Õ
-    { 29, 38, 32, 3, 36, 276, 7640 }, // Ö
-    { 19, 10, 17, 0, 12, 48, 7916 }, // ×
-    { 58, 54, 32, -12, 40, 783, 7964 }, // Ø
-    { 28, 37, 29, 2, 35, 259, 8747 }, // Ù
-    { 28, 42, 29, 2, 40, 294, 9006 }, // Ú
-    { 28, 38, 29, 2, 36, 266, 9300 }, // Û
-    { 28, 39, 29, 2, 37, 273, 9566 }, // Ü
-    { 23, 42, 31, 8, 42, 242, 9839 }, // Ý
-    { 18, 24, 16, 1, 23, 108, 10081 }, // Þ
-    { 21, 25, 20, 1, 23, 132, 10189 }, // ß
-    { 19, 27, 25, 2, 26, 129, 10321 }, // à
-    { 20, 32, 25, 2, 31, 160, 10450 }, // á
-    { 20, 28, 25, 2, 27, 140, 10610 }, // â
-    { 21, 28, 25, 2, 27, 147, 10750 }, // ã
-    { 22, 29, 25, 2, 28, 160, 10897 }, // ä
-    { 19, 29, 25, 2, 28, 138, 11057 }, // å
-    { 31, 19, 37, 2, 18, 148, 11195 }, // æ
-    { 16, 25, 23, 3, 18, 100, 11343 }, // ç
-    { 20, 30, 25, 2, 29, 150, 11443 }, // è
-    { 21, 35, 25, 2, 34, 184, 11593 }, // é
-    { 21, 31, 25, 2, 30, 163, 11777 }, // ê
-    { 23, 32, 25, 2, 31, 184, 11940 }, // ë
-    { 13, 27, 12, 1, 26, 88, 12124 }, // ì
-    { 15, 32, 12, 1, 31, 120, 12212 }, // í
-    { 17, 27, 12, -1, 26, 115, 12332 }, // î
-    { 15, 27, 12, 1, 26, 102, 12447 }, // ï
-    { 27, 26, 20, 0, 24, 176, 12549 }, // ð
-    { 22, 28, 25, 2, 28, 154, 12725 }, // ñ
-    { 20, 27, 25, 3, 26, 135, 12879 }, // ò
-    { 20, 32, 25, 3, 31, 160, 13014 }, // ó
-    { 20, 28, 25, 3, 27, 140, 13174 }, // ô
-    { 20, 28, 25, 3, 27, 140, 13314 }, // õ
-    { 21, 29, 25, 3, 28, 153, 13454 }, // ö
-    { 22, 21, 26, 5, 20, 116, 13607 }, // ÷
-    { 33, 51, 25, -4, 35, 421, 13723 }, // ø
-    { 20, 27, 25, 3, 26, 135, 14144 }, // ù
-    { 20, 32, 25, 3, 31, 160, 14279 }, // ú
-    { 20, 28, 25, 3, 27, 140, 14439 }, // û
-    { 21, 29, 25, 3, 28, 153, 14579 }, // ü
-    { 24, 43, 27, 1, 34, 258, 14732 }, // ý
-    { 19, 31, 16, 0, 25, 148, 14990 }, // þ
-    { 26, 39, 27, 1, 30, 254, 15138 }, // ÿ
-    { 28, 35, 33, 2, 35, 245, 0 }, // Ā
-    { 23, 29, 25, 2, 28, 167, 245 }, // ā
-    { 29, 35, 33, 2, 35, 254, 412 }, // Ă
-    { 23, 29, 25, 2, 28, 167, 666 }, // ă
-    { 24, 33, 33, 2, 25, 198, 833 }, // Ą
-    { 19, 27, 25, 2, 18, 129, 1031 }, // ą
-    { 26, 36, 28, 2, 36, 234, 1160 }, // Ć
-    { 17, 25, 23, 3, 25, 107, 1394 }, // ć
-    { 28, 38, 28, 2, 38, 266, 1501 }, // Ĉ
-    { 21, 27, 23, 3, 27, 142, 1767 }, // ĉ
-    { 26, 36, 28, 2, 36, 234, 1909 }, // Ċ
-    { 18, 26, 23, 3, 26, 117, 2143 }, // ċ
-    { 29, 38, 28, 2, 38, 276, 2260 }, // Č
-    { 22, 28, 23, 3, 28, 154, 2536 }, // č
-    { 28, 37, 30, 2, 37, 259, 2690 }, // Ď
-    { 28, 26, 26, 3, 25, 182, 2949 }, // ď
-    { 29, 25, 30, 0, 25, 182, 3131 }, // Đ
-    { 27, 26, 26, 3, 25, 176, 3313 }, // đ
-    { 25, 36, 26, 2, 36, 225, 3489 }, // Ē
-    { 24, 32, 25, 2, 31, 192, 3714 }, // ē
-    { 26, 36, 26, 2, 36, 234, 3906 }, // Ĕ
-    { 24, 32, 25, 2, 31, 192, 4140 }, // ĕ
-    { 24, 36, 26, 2, 36, 216, 4332 }, // Ė
-    { 21, 32, 25, 2, 31, 168, 4548 }, // ė
-    { 24, 32, 26, 2, 25, 192, 4716 }, // Ę
-    { 20, 29, 25, 2, 17, 145, 4908 }, // ę
-    { 27, 38, 26, 2, 38, 257, 5053 }, // Ě
-    { 25, 34, 25, 2, 33, 213, 5310 }, // ě
-    { 30, 40, 33, 3, 39, 300, 5523 }, // Ĝ
-    { 26, 39, 25, 0, 30, 254, 5823 }, // ĝ
-    { 30, 38, 33, 3, 37, 285, 6077 }, // Ğ
-    { 27, 37, 25, 0, 28, 250, 6362 }, // ğ
-    { 27, 39, 33, 3, 38, 264, 6612 }, // Ġ
-    { 23, 37, 25, 0, 28, 213, 6876 }, // ġ
-    { 27, 44, 33, 3, 43, 297, 7089 }, // Ģ
-    { 24, 39, 25, 0, 30, 234, 7386 }, // ģ
-    { 27, 37, 30, 2, 37, 250, 7620 }, // Ĥ
-    { 21, 36, 26, 2, 35, 189, 7870 }, // ĥ
-    { 28, 25, 30, 2, 25, 175, 8059 }, // Ħ
-    { 20, 26, 26, 2, 25, 130, 8234 }, // ħ
-    { 19, 40, 15, 2, 39, 190, 8364 }, // Ĩ
-    { 15, 29, 12, 1, 28, 109, 8554 }, // ĩ
-    { 20, 39, 15, 2, 38, 195, 8663 }, // Ī
-    { 17, 28, 12, 1, 27, 119, 8858 }, // ī
-    { 16, 34, 15, -1, 26, 136, 8977 }, // Į
-    { 18, 36, 12, -3, 27, 162, 9113 }, // į
-    { 17, 39, 15, 2, 38, 166, 9275 }, // İ
-    { 10, 18, 12, 1, 17, 45, 9441 }, // ı
-    { 29, 38, 46, 8, 26, 276, 9486 }, // Ĳ
-    { 28, 35, 12, 1, 27, 245, 9762 }, // ĳ
-    { 30, 43, 26, 0, 36, 323, 10007 }, // Ĵ
-    { 24, 37, 18, 2, 29, 222, 10330 }, // ĵ
-    { 25, 40, 30, 2, 40, 250, 10552 }, // Ķ
-    { 21, 40, 26, -1, 25, 210, 10802 }, // ķ
-    { 17, 16, 19, -3, 16, 68, 11012 }, // ĸ
-    { 19, 34, 26, 2, 34, 162, 11080 }, // Ĺ
-    { 18, 38, 17, 2, 38, 171, 11242 }, // ĺ
-    { 20, 40, 26, 1, 25, 200, 11413 }, // Ļ
-    { 18, 42, 17, -3, 26, 189, 11613 }, // ļ
-    { 21, 25, 26, 2, 25, 132, 11802 }, // Ľ
-    { 21, 30, 17, 2, 30, 158, 11934 }, // ľ
-    { 22, 25, 26, 2, 25, 138, 12092 }, // Ŀ
-    { 18, 26, 17, 2, 26, 117, 12230 }, // ŀ
-    { 45, 41, 26, -14, 33, 462, 12347 }, // Ł
-    { 31, 26, 17, -10, 26, 202, 12809 }, // ł
-    { 28, 35, 30, 2, 35, 245, 13011 }, // Ń
-    { 21, 29, 25, 2, 29, 153, 13256 }, // ń
-    { 28, 37, 30, 2, 25, 259, 13409 }, // Ņ
-    { 20, 30, 25, 2, 18, 150, 13668 }, // ņ
-    { 30, 38, 30, 2, 38, 285, 13818 }, // Ň
-    { 26, 31, 25, 2, 31, 202, 14103 }, // ň
-    { 38, 30, 25, -16, 30, 285, 14305 }, // ŉ
-    { 28, 32, 30, 2, 25, 224, 14590 }, // Ŋ
-    { 20, 25, 25, 2, 18, 125, 14814 }, // ŋ
-    { 29, 38, 32, 3, 36, 276, 14939 }, // Ō
-    { 22, 29, 25, 3, 28, 160, 15215 }, // ō
-    { 29, 38, 32, 3, 36, 276, 15375 }, // Ŏ
-    { 22, 29, 25, 3, 28, 160, 15651 }, // ŏ
-    { 32, 37, 32, 3, 35, 296, 15811 }, // Ő
-    { 26, 28, 25, 3, 27, 182, 16107 }, // ő
-    { 40, 28, 35, 3, 26, 280, 16289 }, // Œ
-    { 31, 19, 31, 3, 18, 148, 16569 }, // œ
-    { 23, 34, 28, 2, 34, 196, 16717 }, // Ŕ
-    { 17, 26, 21, 2, 25, 111, 16913 }, // ŕ
-    { 23, 40, 28, 2, 40, 230, 17024 }, // Ŗ
-    { 17, 31, 21, 2, 30, 132, 17254 }, // ŗ
-    { 26, 37, 28, 2, 37, 241, 17386 }, // Ř
-    { 21, 28, 21, 2, 27, 147, 17627 }, // ř
-    { 25, 35, 30, 2, 34, 219, 17774 }, // Ś
-    { 19, 27, 25, 2, 25, 129, 17993 }, // ś
-    { 27, 36, 30, 2, 35, 243, 18122 }, // Ŝ
-    { 23, 29, 25, 2, 27, 167, 18365 }, // ŝ
-    { 25, 33, 30, 2, 25, 207, 18532 }, // Ş
-    { 19, 26, 25, 2, 18, 124, 18739 }, // ş
-    { 29, 37, 30, 2, 36, 269, 18863 }, // Š
-    { 24, 30, 25, 2, 28, 180, 19132 }, // š
-    { 24, 33, 30, 7, 25, 198, 19312 }, // Ţ
-    { 17, 29, 23, 3, 22, 124, 19510 }, // ţ
-    { 24, 37, 30, 7, 37, 222, 19634 }, // Ť
-    { 23, 27, 23, 5, 27, 156, 19856 }, // ť
-    { 24, 25, 30, 7, 25, 150, 20012 }, // Ŧ
-    { 17, 22, 23, 3, 22, 94, 20162 }, // ŧ
-    { 28, 40, 29, 2, 38, 280, 20256 }, // Ũ
-    { 20, 29, 25, 3, 28, 145, 20536 }, // ũ
-    { 28, 39, 29, 2, 37, 273, 20681 }, // Ū
-    { 22, 28, 25, 3, 27, 154, 20954 }, // ū
-    { 28, 39, 29, 2, 37, 273, 21108 }, // Ŭ
-    { 22, 28, 25, 3, 27, 154, 21381 }, // ŭ
-    { 28, 41, 29, 2, 39, 287, 21535 }, // Ů
-    { 20, 31, 25, 3, 30, 155, 21822 }, // ů
-    { 32, 38, 29, 2, 36, 304, 21977 }, // Ű
-    { 26, 27, 25, 3, 26, 176, 22281 }, // ű
-    { 28, 32, 29, 2, 25, 224, 22457 }, // Ų
-    { 20, 26, 25, 3, 17, 130, 22681 }, // ų
-    { 34, 36, 41, 7, 36, 306, 22811 }, // Ŵ
-    { 25, 30, 32, 6, 29, 188, 23117 }, // ŵ
-    { 23, 38, 31, 8, 38, 219, 23305 }, // Ŷ
-    { 24, 39, 27, 1, 30, 234, 23524 }, // ŷ
-    { 23, 39, 31, 8, 39, 225, 23758 }, // Ÿ
-    { 30, 34, 31, 2, 34, 255, 23983 }, // Ź
-    { 21, 28, 26, 2, 28, 147, 24238 }, // ź
-    { 30, 34, 31, 2, 34, 255, 24385 }, // Ż
-    { 21, 28, 26, 2, 28, 147, 24640 }, // ż
-    { 30, 36, 31, 2, 36, 270, 24787 }, // Ž
-    { 25, 30, 26, 2, 30, 188, 25057 }, // ž
-    { 17, 24, 18, 3, 24, 102, 25245 }, // ſ
-    { 11, 6, 0, 6, 23, 17, 0 }, // ̀
-    { 9, 7, 0, 5, 23, 16, 17 }, // ́
-    { 17, 8, 0, -1, 1, 34, 33 }, // ̂
-    { 12, 7, 0, 6, 22, 21, 67 }, // ̃
-    { 16, 5, 0, 6, 21, 20, 88 }, // ̄
-    { 21, 5, 0, 7, 27, 27, 108 }, // ̅
-    { 15, 7, 0, 6, 21, 27, 135 }, // ̆
-    { 8, 7, 0, 6, 24, 14, 162 }, // ̇
-    { 14, 6, 0, 4, 21, 21, 176 }, // ̈
-    { 7, 7, 0, 10, 19, 13, 197 }, // ̉
-    { 8, 8, 0, 6, 23, 16, 210 }, // ̊
-    { 24, 6, 0, 5, 23, 36, 226 }, // ̋
-    { 16, 8, 0, 6, 23, 32, 262 }, // ̌
-    { 24, 6, 0, -11, 23, 36, 294 }, // ̏
-    { 13, 10, 0, 3, 23, 33, 330 }, // ̒
-    { 12, 10, 0, 4, 22, 30, 363 }, // ̓
-    { 13, 10, 0, -7, 22, 33, 393 }, // ̔
-    { 8, 9, 0, 0, 0, 18, 426 }, // ̘
-    { 9, 9, 0, 1, 0, 21, 444 }, // ̙
-    { 14, 9, 0, 7, 24, 32, 465 }, // ̚
-    { 7, 9, 0, 4, 20, 16, 497 }, // ̛
-    { 7, 9, 0, -1, 0, 16, 513 }, // ̜
-    { 9, 9, 0, 2, 6, 21, 529 }, // ̝
-    { 8, 8, 0, -1, 0, 16, 550 }, // ̞
-    { 7, 7, 0, 0, -2, 13, 566 }, // ̟
-    { 17, 5, 0, -2, -3, 22, 579 }, // ̠
-    { 8, 7, 0, -4, 3, 14, 601 }, // ̣
-    { 14, 6, 0, -2, -2, 21, 615 }, // ̤
-    { 8, 8, 0, 6, 23, 16, 636 }, // ̥
-    { 13, 10, 0, -1, 5, 33, 652 }, // ̦
-    { 9, 9, 0, -1, 1, 21, 685 }, // ̧
-    { 9, 10, 0, 0, 1, 23, 706 }, // ̨
-    { 8, 10, 0, -2, -1, 20, 729 }, // ̩
-    { 14, 7, 0, -1, 0, 25, 749 }, // ̪
-    { 19, 9, 0, -1, 1, 43, 774 }, // ̬
-    { 18, 9, 0, -1, 1, 41, 817 }, // ̭
-    { 14, 8, 0, 7, 25, 28, 858 }, // ̰
-    { 15, 5, 0, 7, 24, 19, 886 }, // ̱
-    { 16, 5, 0, -2, -1, 20, 905 }, // ̲
-    { 14, 8, 0, 8, 25, 28, 925 }, // ̴
-    { 17, 4, 0, 2, 11, 17, 953 }, // ̵
-    { 7, 10, 0, 2, 0, 18, 970 }, // ̹
-    { 16, 9, 0, -5, 1, 36, 988 }, // ̺
-    { 14, 10, 0, -2, 1, 35, 1024 }, // ̻
-    { 13, 8, 0, -1, 1, 26, 1059 }, // ̼
-    { 11, 7, 0, 5, 22, 20, 1085 }, // ̽
-    { 12, 7, 0, 6, 22, 21, 1105 }, // ͂
-    { 7, 8, 0, 12, 26, 14, 1126 }, // ̓
-    { 17, 22, 0, 5, 37, 94, 1140 }, // ̈́
-    { 14, 7, 0, 5, 24, 25, 1234 }, // ͆
-    { 18, 11, 0, -2, 0, 50, 1259 }, // ͇
-    { 15, 9, 0, -1, 1, 34, 1309 }, // ͈
-    { 12, 9, 0, -1, -1, 27, 1343 }, // ͉
-    { 21, 23, 0, 5, 31, 121, 1370 }, // ͊
-    { 29, 23, 0, 10, 34, 167, 1491 }, // ͋
-    { 22, 16, 0, 15, 16, 88, 1658 }, // ͌
-    { 16, 33, 0, 1, 11, 132, 1746 }, // ͍
-    { 5, 5, 0, 15, 4, 7, 1878 }, // ͎
-    { 26, 7, 0, 0, 1, 46, 1885 }, // ͜
-    { 26, 8, 0, 5, 24, 52, 1931 }, // ͡
-    { 32, 9, 0, -1, -1, 72, 1983 }, // ͢
-    { 24, 36, 25, 2, 36, 216, 0 }, // Ѐ
-    { 25, 36, 26, 2, 36, 225, 216 }, // Ё
-    { 27, 27, 20, 3, 25, 183, 441 }, // Ђ
-    { 23, 34, 19, 1, 33, 196, 624 }, // Ѓ
-    { 25, 25, 24, 2, 23, 157, 820 }, // Є
-    { 25, 26, 30, 2, 25, 163, 977 }, // Ѕ
-    { 13, 27, 15, 2, 26, 88, 1140 }, // І
-    { 18, 38, 15, 2, 37, 171, 1228 }, // Ї
-    { 26, 32, 26, 0, 25, 208, 1399 }, // Ј
-    { 31, 25, 34, 2, 22, 194, 1607 }, // Љ
-    { 30, 24, 18, -6, 23, 180, 1801 }, // Њ
-    { 24, 28, 30, 7, 27, 168, 1981 }, // Ћ
-    { 25, 34, 30, 2, 34, 213, 2149 }, // Ќ
-    { 26, 33, 28, 2, 33, 215, 2362 }, // Ѝ
-    { 24, 37, 23, 0, 34, 222, 2577 }, // Ў
-    { 25, 28, 23, 2, 21, 175, 2799 }, // Џ
-    { 24, 25, 33, 2, 25, 150, 2974 }, // А
-    { 20, 22, 19, 3, 21, 110, 3124 }, // Б
-    { 20, 23, 20, 2, 22, 115, 3234 }, // В
-    { 23, 23, 19, 1, 22, 133, 3349 }, // Г
-    { 24, 26, 24, 2, 22, 156, 3482 }, // Д
-    { 23, 25, 25, 2, 25, 144, 3638 }, // Е
-    { 41, 25, 44, 1, 25, 257, 3782 }, // Ж
-    { 19, 23, 19, 2, 21, 110, 4039 }, // З
-    { 26, 25, 28, 2, 25, 163, 4149 }, // И
-    { 26, 32, 28, 2, 32, 208, 4312 }, // Й
-    { 25, 25, 30, 2, 25, 157, 4520 }, // К
-    { 25, 25, 18, -1, 22, 157, 4677 }, // Л
-    { 28, 23, 25, 1, 22, 161, 4834 }, // М
-    { 27, 25, 30, 2, 25, 169, 4995 }, // Н
-    { 29, 28, 32, 3, 26, 203, 5164 }, // О
-    { 23, 24, 20, 1, 23, 138, 5367 }, // П
-    { 23, 25, 26, 2, 25, 144, 5505 }, // Р
-    { 26, 27, 28, 2, 27, 176, 5649 }, // С
-    { 24, 25, 30, 7, 25, 150, 5825 }, // Т
-    { 24, 25, 23, 0, 22, 150, 5975 }, // У
-    { 23, 22, 25, 5, 22, 127, 6125 }, // Ф
-    { 30, 25, 32, 2, 25, 188, 6252 }, // Х
-    { 22, 28, 21, 1, 22, 154, 6440 }, // Ц
-    { 18, 22, 19, 5, 22, 99, 6594 }, // Ч
-    { 27, 23, 24, 1, 22, 156, 6693 }, // Ш
-    { 27, 28, 26, 1, 22, 189, 6849 }, // Щ
-    { 19, 23, 18, -1, 22, 110, 7038 }, // Ъ
-    { 32, 27, 33, 1, 26, 216, 7148 }, // Ы
-    { 17, 23, 18, 1, 22, 98, 7364 }, // Ь
-    { 26, 25, 28, 2, 23, 163, 7462 }, // Э
-    { 28, 24, 27, 2, 23, 168, 7625 }, // Ю
-    { 24, 25, 26, 1, 25, 150, 7793 }, // Я
-    { 19, 19, 25, 2, 18, 91, 7943 }, // а
-    { 23, 28, 20, 3, 26, 161, 8034 }, // б
-    { 17, 17, 21, -1, 17, 73, 8195 }, // в
-    { 19, 18, 17, 1, 17, 86, 8268 }, // г
-    { 21, 21, 22, 2, 17, 111, 8354 }, // д
-    { 20, 18, 25, 2, 17, 90, 8465 }, // е
-    { 40, 21, 43, 1, 21, 210, 8555 }, // ж
-    { 14, 16, 13, -2, 16, 56, 8765 }, // з
-    { 21, 18, 20, 1, 17, 95, 8821 }, // и
-    { 21, 24, 19, 0, 24, 126, 8916 }, // й
-    { 20, 16, 24, -1, 16, 80, 9042 }, // к
-    { 18, 17, 12, -4, 15, 77, 9122 }, // л
-    { 22, 18, 25, -1, 18, 99, 9199 }, // м
-    { 23, 18, 24, -1, 18, 104, 9298 }, // н
-    { 20, 19, 25, 3, 18, 95, 9402 }, // о
-    { 21, 18, 19, 1, 17, 95, 9497 }, // п
-    { 26, 26, 27, -1, 17, 169, 9592 }, // р
-    { 16, 18, 23, 3, 18, 72, 9761 }, // с
-    { 19, 18, 20, 4, 17, 86, 9833 }, // т
-    { 24, 25, 27, 1, 16, 150, 9919 }, // у
-    { 26, 24, 25, 2, 17, 156, 10069 }, // ф
-    { 24, 18, 21, 0, 17, 108, 10225 }, // х
-    { 21, 22, 21, 1, 17, 116, 10333 }, // ц
-    { 13, 15, 13, 0, 15, 49, 10449 }, // ч
-    { 26, 18, 24, 1, 17, 117, 10498 }, // ш
-    { 26, 23, 26, 1, 17, 150, 10615 }, // щ
-    { 15, 17, 14, -3, 16, 64, 10765 }, // ъ
-    { 24, 20, 25, -2, 19, 120, 10829 }, // ы
-    { 14, 18, 14, -2, 17, 63, 10949 }, // ь
-    { 18, 18, 19, 2, 17, 81, 11012 }, // э
-    { 22, 20, 22, 0, 19, 110, 11093 }, // ю
-    { 17, 19, 24, 2, 19, 81, 11203 }, // я
-    { 21, 32, 25, 2, 31, 168, 11284 }, // ѐ
-    { 22, 30, 25, 2, 29, 165, 11452 }, // ё
-    { 20, 32, 26, 2, 25, 160, 11617 }, // ђ
-    { 19, 26, 17, 1, 25, 124, 11777 }, // ѓ
-    { 18, 17, 17, -2, 16, 77, 11901 }, // є
-    { 19, 20, 25, 2, 18, 95, 11978 }, // ѕ
-    { 14, 28, 12, 1, 27, 98, 12073 }, // і
-    { 15, 27, 12, 1, 26, 102, 12171 }, // ї
-    { 19, 34, 18, 2, 26, 162, 12273 }, // ј
-    { 21, 17, 23, -1, 15, 90, 12435 }, // љ
-    { 21, 17, 12, -7, 16, 90, 12525 }, // њ
-    { 20, 26, 26, 2, 25, 130, 12615 }, // ћ
-    { 21, 25, 24, -1, 25, 132, 12745 }, // ќ
-    { 21, 28, 20, 1, 27, 147, 12877 }, // ѝ
-    { 27, 39, 27, 1, 30, 264, 13024 }, // ў
-    { 18, 22, 17, -1, 16, 99, 13288 }, // џ
-    { 18, 24, 22, 5, 22, 108, 13387 }, // Ѣ
-    { 19, 24, 19, 3, 22, 114, 13495 }, // ѣ
-    { 31, 24, 25, -1, 22, 186, 13609 }, // Ѫ
-    { 23, 18, 18, -4, 16, 104, 13795 }, // ѫ
-    { 32, 32, 33, 3, 31, 256, 13899 }, // Ѳ
-    { 25, 26, 25, 3, 25, 163, 14155 }, // ѳ
-    { 29, 30, 32, 8, 30, 218, 14318 }, // Ѵ
-    { 20, 21, 25, 6, 21, 105, 14536 }, // ѵ
-    { 14, 11, 0, 8, 28, 39, 14641 }, // ҆
-    { 24, 26, 19, 1, 25, 156, 14680 }, // Ґ
-    { 21, 22, 17, 1, 21, 116, 14836 }, // ґ
-    { 23, 24, 19, 1, 22, 138, 14952 }, // Ғ
-    { 16, 16, 13, -2, 15, 64, 15090 }, // ғ
-    { 23, 27, 18, 0, 25, 156, 15154 }, // Ҕ
-    { 15, 17, 11, -4, 15, 64, 15310 }, // ҕ
-    { 41, 30, 44, 1, 25, 308, 15374 }, // Җ
-    { 28, 21, 29, -2, 17, 147, 15682 }, // җ
-    { 19, 26, 19, 2, 21, 124, 15829 }, // Ҙ
-    { 14, 23, 13, -2, 16, 81, 15953 }, // ҙ
-    { 27, 30, 21, 0, 25, 203, 16034 }, // Қ
-    { 19, 20, 15, -3, 17, 95, 16237 }, // қ
-    { 30, 24, 32, 2, 22, 180, 16332 }, // Ҝ
-    { 22, 17, 22, 0, 16, 94, 16512 }, // ҝ
-    { 25, 25, 30, 2, 25, 157, 16606 }, // Ҟ
-    { 18, 25, 26, 2, 25, 113, 16763 }, // ҟ
-    { 25, 25, 30, 2, 25, 157, 16876 }, // Ҡ
-    { 18, 17, 21, -2, 17, 77, 17033 }, // ҡ
-    { 27, 29, 22, -2, 25, 196, 17110 }, // Ң
-    { 20, 20, 16, -5, 17, 100, 17306 }, // ң
-    { 38, 25, 30, 2, 25, 238, 17406 }, // Ҥ
-    { 27, 17, 21, -2, 17, 115, 17644 }, // ҥ
-    { 34, 27, 37, 3, 25, 230, 17759 }, // Ҧ
-    { 28, 29, 37, 5, 20, 203, 17989 }, // ҧ
-    { 30, 25, 20, -3, 22, 188, 18192 }, // Ҩ
-    { 24, 20, 29, 2, 18, 120, 18380 }, // ҩ
-    { 25, 31, 28, 3, 27, 194, 18500 }, // Ҫ
-    { 16, 21, 23, 3, 18, 84, 18694 }, // ҫ
-    { 24, 29, 23, 3, 25, 174, 18778 }, // Ҭ
-    { 17, 20, 16, -1, 17, 85, 18952 }, // ҭ
-    { 23, 25, 31, 8, 25, 144, 19037 }, // Ү
-    { 18, 23, 22, 6, 16, 104, 19181 }, // ү
-    { 26, 25, 31, 5, 25, 163, 19285 }, // Ұ
-    { 23, 23, 22, 1, 16, 133, 19448 }, // ұ
-    { 30, 30, 23, 1, 25, 225, 19581 }, // Ҳ
-    { 21, 20, 23, 1, 17, 105, 19806 }, // ҳ
-    { 24, 28, 18, 0, 21, 168, 19911 }, // Ҵ
-    { 18, 20, 25, 4, 15, 90, 20079 }, // ҵ
-    { 20, 29, 20, 3, 22, 145, 20169 }, // Ҷ
-    { 14, 21, 14, 0, 16, 74, 20314 }, // ҷ
-    { 18, 22, 19, 5, 22, 99, 20388 }, // Ҹ
-    { 13, 15, 13, 0, 15, 49, 20487 }, // ҹ
-    { 20, 26, 20, 1, 24, 130, 20536 }, // Һ
-    { 20, 26, 26, 2, 25, 130, 20666 }, // һ
-    { 33, 23, 41, 6, 22, 190, 20796 }, // Ҽ
-    { 23, 16, 20, 2, 15, 92, 20986 }, // ҽ
-    { 33, 27, 26, 7, 22, 223, 21078 }, // Ҿ
-    { 24, 20, 19, 3, 15, 120, 21301 }, // ҿ
-    { 13, 27, 15, 2, 26, 88, 21421 }, // Ӏ
-    { 41, 39, 44, 1, 39, 400, 21509 }, // Ӂ
-    { 40, 33, 43, 1, 33, 330, 21909 }, // ӂ
-    { 23, 30, 21, 1, 22, 173, 22239 }, // Ӄ
-    { 16, 21, 15, -2, 15, 84, 22412 }, // ӄ
-    { 25, 29, 18, -1, 22, 182, 22496 }, // Ӆ
-    { 17, 20, 12, -1, 15, 85, 22678 }, // ӆ
-    { 27, 32, 30, 2, 25, 216, 22763 }, // Ӈ
-    { 20, 22, 21, -2, 17, 110, 22979 }, // ӈ
-    { 27, 35, 30, 2, 25, 237, 23089 }, // Ӊ
-    { 20, 24, 21, 0, 17, 120, 23326 }, // ӊ
-    { 20, 28, 20, 4, 22, 140, 23446 }, // Ӌ
-    { 12, 20, 18, 3, 15, 60, 23586 }, // ӌ
-    { 31, 35, 34, 2, 25, 272, 23646 }, // Ӎ
-    { 22, 24, 23, 0, 17, 132, 23918 }, // ӎ
-    { 11, 22, 18, 6, 21, 61, 24050 }, // ӏ
-    { 29, 34, 33, 2, 34, 247, 24111 }, // Ӑ
-    { 24, 28, 25, 2, 27, 168, 24358 }, // ӑ
-    { 27, 34, 33, 2, 34, 230, 24526 }, // Ӓ
-    { 23, 29, 25, 2, 28, 167, 24756 }, // ӓ
-    { 40, 26, 40, 2, 25, 260, 24923 }, // Ӕ
-    { 31, 19, 37, 2, 18, 148, 25183 }, // ӕ
-    { 28, 35, 25, 2, 35, 245, 25331 }, // Ӗ
-    { 24, 31, 25, 2, 30, 186, 25576 }, // ӗ
-    { 24, 24, 31, 10, 22, 144, 25762 }, // Ә
-    { 19, 19, 25, 9, 18, 91, 25906 }, // ә
-    { 24, 33, 31, 10, 31, 198, 25997 }, // Ӛ
-    { 21, 24, 25, 7, 18, 126, 26195 }, // ӛ
-    { 41, 38, 41, 5, 38, 390, 26321 }, // Ӝ
-    { 40, 33, 43, 1, 33, 330, 26711 }, // ӝ
-    { 22, 36, 19, 2, 34, 198, 27041 }, // Ӟ
-    { 20, 23, 13, -2, 23, 115, 27239 }, // ӟ
-    { 19, 23, 20, 3, 22, 110, 27354 }, // Ӡ
-    { 18, 23, 20, 2, 16, 104, 27464 }, // ӡ
-    { 26, 33, 26, 2, 33, 215, 27568 }, // Ӣ
-    { 23, 28, 20, 1, 27, 161, 27783 }, // ӣ
-    { 26, 32, 28, 2, 32, 208, 27944 }, // Ӥ
-    { 21, 27, 20, 1, 26, 142, 28152 }, // ӥ
-    { 29, 37, 32, 3, 35, 269, 28294 }, // Ӧ
-    { 20, 31, 25, 3, 30, 155, 28563 }, // ӧ
-    { 26, 24, 32, 4, 23, 156, 28718 }, // Ө
-    { 20, 19, 25, 3, 18, 95, 28874 }, // ө
-    { 26, 33, 32, 4, 32, 215, 28969 }, // Ӫ
-    { 20, 28, 25, 3, 27, 140, 29184 }, // ӫ
-    { 43, 37, 28, 2, 35, 398, 29324 }, // Ӭ
-    { 18, 25, 19, 2, 24, 113, 29722 }, // ӭ
-    { 24, 37, 23, 0, 34, 222, 29835 }, // Ӯ
-    { 26, 39, 27, 1, 30, 254, 30057 }, // ӯ
-    { 24, 37, 23, 0, 34, 222, 30311 }, // Ӱ
-    { 24, 38, 27, 1, 29, 228, 30533 }, // ӱ
-    { 28, 37, 23, 0, 34, 259, 30761 }, // Ӳ
-    { 31, 38, 27, 1, 29, 295, 31020 }, // ӳ
-    { 18, 29, 19, 5, 29, 131, 31315 }, // Ӵ
-    { 15, 22, 13, 0, 22, 83, 31446 }, // ӵ
-    { 23, 27, 19, 1, 22, 156, 31529 }, // Ӷ
-    { 16, 19, 13, -2, 15, 76, 31685 }, // ӷ
-    { 32, 40, 33, 1, 39, 320, 31761 }, // Ӹ
-    { 26, 31, 25, -2, 30, 202, 32081 }, // ӹ
-    { 30, 29, 32, 2, 25, 218, 32283 }, // Ӽ
-    { 21, 20, 23, -2, 17, 105, 32501 }, // ӽ
-    { 0, 0, 19, 0, 0, 0, 0 }, //  
-    { 0, 0, 34, 0, 0, 0, 0 }, //  
-    { 0, 0, 19, 0, 0, 0, 0 }, //  
-    { 0, 0, 34, 0, 0, 0, 0 }, //  
-    { 0, 0, 14, 0, 0, 0, 0 }, //  
-    { 0, 0, 12, 0, 0, 0, 0 }, //  
-    { 0, 0, 10, 0, 0, 0, 0 }, //  
-    { 0, 0, 21, 0, 0, 0, 0 }, //  
-    { 0, 0, 8, 0, 0, 0, 0 }, //  
-    { 0, 0, 11, 0, 0, 0, 0 }, //  
-    { 0, 0, 9, 0, 0, 0, 0 }, //  
-    { 0, 0, 5, 0, 0, 0, 0 }, // ​
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‍
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‎
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‏
-    { 17, 4, 16, 2, 11, 17, 0 }, // ‐
-    { 17, 4, 16, 2, 11, 17, 17 }, // ‑
-    { 25, 4, 16, -1, 11, 25, 34 }, // ‒
-    { 22, 6, 23, 3, 11, 33, 59 }, // –
-    { 32, 6, 33, 3, 11, 48, 92 }, // —
-    { 32, 6, 33, 3, 11, 48, 140 }, // ―
-    { 21, 27, 16, 2, 22, 142, 188 }, // ‖
-    { 27, 10, 16, -6, -2, 68, 330 }, // ‗
-    { 12, 10, 13, 6, 26, 30, 398 }, // ‘
-    { 13, 10, 13, 5, 26, 33, 428 }, // ’
-    { 13, 10, 9, -2, 5, 33, 461 }, // ‚
-    { 12, 10, 13, 6, 26, 30, 494 }, // ‛
-    { 22, 10, 22, 6, 26, 55, 524 }, // “
-    { 23, 10, 22, 5, 26, 58, 579 }, // ”
-    { 13, 10, 9, -2, 5, 33, 637 }, // „
-    { 22, 10, 22, 6, 26, 55, 670 }, // ‟
-    { 18, 40, 24, 7, 30, 180, 725 }, // †
-    { 20, 41, 25, 6, 30, 205, 905 }, // ‡
-    { 26, 23, 15, -3, 26, 150, 1110 }, // •
-    { 11, 10, 18, 5, 13, 28, 1260 }, // ‣
-    { 8, 7, 18, 5, 7, 14, 1288 }, // ․
-    { 8, 7, 18, 5, 7, 14, 1302 }, // ‥
-    { 28, 7, 28, 0, 7, 49, 1316 }, // …
-    { 5, 4, 16, 6, 11, 5, 1365 }, // ‧
-    { 0, 0, 32, 0, 0, 0, 1370 }, //  
-    { 26, 26, 33, 4, 23, 169, 1370 }, // ‰
-    { 13, 10, 16, 9, 26, 33, 1539 }, // ′
-    { 22, 10, 23, 9, 26, 55, 1572 }, // ″
-    { 22, 9, 12, -3, 25, 50, 1627 }, // ‴
-    { 7, 9, 12, 8, 25, 16, 1677 }, // ‵
-    { 13, 9, 12, 6, 25, 30, 1693 }, // ‶
-    { 22, 9, 12, 0, 25, 50, 1723 }, // ‷
-    { 17, 7, 19, 6, 25, 30, 1773 }, // ‸
-    { 12, 16, 12, 3, 16, 48, 1803 }, // ‹
-    { 12, 16, 12, -3, 16, 48, 1851 }, // ›
-    { 38, 38, 40, 2, 30, 361, 1899 }, // ※
-    { 16, 37, 18, 3, 32, 148, 2260 }, // ‼
-    { 23, 46, 25, 5, 39, 265, 2408 }, // ‽
-    { 16, 4, 16, 6, 24, 16, 2673 }, // ‾
-    { 15, 7, 22, 6, 20, 27, 2689 }, // ‿
-    { 21, 21, 19, 2, 28, 111, 2716 }, // ⁂
-    { 27, 25, 38, 6, 23, 169, 2827 }, // ⁄
-    { 39, 37, 44, 8, 33, 361, 2996 }, // ⁇
-    { 34, 38, 35, 6, 33, 323, 3357 }, // ⁈
-    { 32, 38, 23, -2, 33, 304, 3680 }, // ⁉
-    { 33, 51, 27, -2, 35, 421, 3984 }, // ⁒
-    { 0, 0, 136, 0, 0, 0, 4405 }, //  
-    { 10, 12, 10, 11, 24, 30, 0 }, // ⁰
-    { 10, 11, 10, 11, 25, 28, 30 }, // ⁴
-    { 11, 12, 10, 10, 25, 33, 58 }, // ⁵
-    { 10, 11, 10, 11, 24, 28, 91 }, // ⁶
-    { 9, 13, 11, 13, 25, 30, 119 }, // ⁷
-    { 11, 11, 11, 10, 24, 31, 149 }, // ⁸
-    { 11, 12, 11, 10, 24, 33, 180 }, // ⁹
-    { 20, 18, 25, 2, 18, 90, 213 }, // ⁿ
-    { 11, 12, 10, -9, 7, 33, 303 }, // ₀
-    { 9, 12, 10, -10, 7, 27, 336 }, // ₁
-    { 12, 12, 11, -10, 7, 36, 363 }, // ₂
-    { 11, 12, 10, -9, 7, 33, 399 }, // ₃
-    { 10, 12, 11, -9, 7, 30, 432 }, // ₄
-    { 10, 12, 10, -9, 7, 30, 462 }, // ₅
-    { 11, 12, 11, -9, 7, 33, 492 }, // ₆
-    { 10, 12, 11, -7, 7, 30, 525 }, // ₇
-    { 11, 12, 11, -9, 7, 33, 555 }, // ₈
-    { 11, 13, 11, -9, 7, 36, 588 }, // ₉
-    { 20, 41, 14, 2, 31, 205, 624 }, // ₍
-    { 20, 41, 13, -9, 31, 205, 829 }, // ₎
-    { 28, 39, 28, 3, 33, 273, 0 }, // ₡
-    { 26, 27, 28, 2, 27, 176, 273 }, // ₢
-    { 22, 27, 20, 1, 26, 149, 449 }, // ₤
-    { 33, 25, 30, -1, 25, 207, 598 }, // ₦
-    { 27, 25, 26, 2, 25, 169, 805 }, // ₧
-    { 35, 27, 38, -1, 25, 237, 974 }, // ₨
-    { 27, 26, 25, -2, 26, 176, 1211 }, // ₩
-    { 27, 23, 31, 5, 23, 156, 1387 }, // ₪
-    { 25, 25, 15, -2, 24, 157, 1543 }, // ₫
-    { 23, 28, 24, 2, 24, 161, 1700 }, // €
-    { 24, 25, 30, 7, 25, 150, 1861 }, // ₮
-    { 31, 25, 19, 1, 25, 194, 2011 }, // ₱
-    { 26, 38, 33, 3, 32, 247, 2205 }, // ₲
-    { 33, 24, 31, 9, 22, 198, 2452 }, // ₴
-    { 16, 24, 17, 3, 21, 96, 2650 }, // ₵
-    { 28, 26, 30, 7, 26, 182, 2746 }, // ₸
-    { 20, 24, 20, 4, 23, 120, 2928 }, // ₹
-    { 19, 22, 20, 2, 20, 105, 3048 }, // ₺
-    { 23, 25, 24, 4, 23, 144, 3153 }, // ₼
-    { 29, 25, 26, -4, 25, 182, 3297 }, // ₽
-    { 20, 20, 21, -5, 15, 100, 0 }, // ←
-    { 21, 20, 22, 3, 19, 105, 100 }, // ↑
-    { 20, 20, 22, 6, 15, 100, 205 }, // →
-    { 21, 21, 22, 8, 19, 111, 305 }, // ↓
-    { 33, 17, 30, -1, 14, 141, 416 }, // ↔
-    { 17, 32, 23, 5, 31, 136, 557 }, // ↕
-    { 19, 14, 23, -2, 13, 67, 693 }, // ↖
-    { 20, 14, 19, 3, 13, 70, 760 }, // ↗
-    { 16, 20, 19, 6, 17, 80, 830 }, // ↘
-    { 16, 20, 19, -3, 17, 80, 910 }, // ↙
-    { 24, 20, 29, 1, 18, 120, 990 }, // ⇐
-    { 25, 24, 31, 6, 23, 150, 1110 }, // ⇑
-    { 24, 20, 29, 4, 18, 120, 1260 }, // ⇒
-    { 25, 24, 31, 12, 22, 150, 1380 }, // ⇓
-    { 30, 20, 32, 1, 18, 150, 1530 }, // ⇔
-    { 20, 29, 26, 8, 16, 145, 1680 }, // ⇕
-    { 23, 26, 20, 2, 24, 150, 0 }, // ∂
-    { 31, 31, 32, 0, 28, 241, 150 }, // ∅
-    { 24, 23, 25, 1, 22, 138, 391 }, // ∆
-    { 23, 23, 22, 3, 21, 133, 529 }, // ∏
-    { 23, 23, 22, 9, 22, 133, 662 }, // ∐
-    { 21, 22, 17, 1, 21, 116, 795 }, // ∑
-    { 17, 5, 18, 2, 11, 22, 911 }, // −
-    { 30, 26, 28, 3, 24, 195, 933 }, // √
-    { 27, 17, 27, 3, 19, 115, 1128 }, // ∞
-    { 30, 31, 25, 0, 23, 233, 1243 }, // ∫
-    { 12, 20, 9, 1, 20, 60, 1476 }, // ∶
-    { 22, 16, 42, 15, 16, 88, 1536 }, // ≈
-    { 27, 26, 38, 6, 23, 176, 1624 }, // ≠
-    { 28, 25, 23, -4, 21, 175, 1800 }, // ≤
-    { 28, 26, 25, 0, 22, 182, 1975 }, // ≥
+    { 20, 16, 24, 3, 15, 80, 12256 }, // «
+    { 16, 11, 18, 3, 11, 44, 955 }, // ¬
+    { 16, 4, 18, 3, 11, 16, 999 }, // ­
+    { 15, 13, 20, 9, 32, 49, 1015 }, // ®
+    { 13, 5, 15, 6, 22, 17, 1064 }, // ¯
+    { 16, 13, 20, 6, 22, 52, 1081 }, // °
+    { 22, 21, 24, 0, 16, 116, 1133 }, // ±
+    { 10, 11, 9, 10, 24, 28, 1249 }, // ²
+    { 10, 11, 10, 10, 24, 28, 1277 }, // ³
+    { 9, 7, 8, 5, 23, 16, 1305 }, // ´
+    { 24, 21, 25, -1, 17, 126, 1321 }, // µ
+    { 22, 25, 22, 2, 21, 138, 1447 }, // ¶
+    { 8, 7, 8, 2, 14, 14, 1585 }, // ·
+    { 9, 9, 10, -1, 1, 21, 1599 }, // ¸
+    { 9, 12, 9, 10, 25, 27, 1620 }, // ¹
+    { 11, 10, 19, 9, 21, 28, 1647 }, // º
+    { 20, 16, 22, -4, 15, 80, 12336 }, // »
+    { 31, 27, 38, 2, 25, 210, 1675 }, // ¼
+    { 33, 27, 38, 2, 25, 223, 1885 }, // ½
+    { 31, 28, 38, 2, 26, 217, 2108 }, // ¾
+    { 22, 37, 19, -2, 21, 204, 2325 }, // ¿
+    { 25, 33, 33, 2, 33, 207, 12416 }, // À
+    { 26, 38, 33, 2, 38, 247, 12623 }, // Á
+    { 26, 34, 33, 2, 34, 221, 12870 }, // Â
+    { 26, 34, 33, 2, 34, 221, 2529 }, // Ã
+    { 28, 35, 33, 2, 35, 245, 13091 }, // Ä
+    { 25, 35, 33, 2, 35, 219, 2750 }, // Å
+    { 40, 26, 40, 2, 25, 260, 2969 }, // Æ
+    { 26, 35, 28, 2, 27, 228, 13336 }, // Ç
+    { 24, 35, 26, 2, 35, 210, 13564 }, // È
+    { 24, 39, 26, 2, 39, 234, 13774 }, // É
+    { 24, 35, 26, 2, 35, 210, 14008 }, // Ê
+    { 25, 36, 26, 2, 36, 225, 14218 }, // Ë
+    { 16, 38, 15, 2, 37, 152, 14443 }, // Ì
+    { 18, 42, 15, 2, 41, 189, 14595 }, // Í
+    { 18, 38, 15, 2, 37, 171, 14784 }, // Î
+    { 20, 39, 15, 2, 38, 195, 14955 }, // Ï
+    { 29, 25, 30, 0, 25, 182, 3229 }, // Ð
+    { 28, 34, 30, 2, 34, 238, 15150 }, // Ñ
+    { 29, 36, 32, 3, 34, 261, 15388 }, // Ò
+    { 29, 41, 32, 3, 39, 298, 15649 }, // Ó
+    { 29, 37, 32, 3, 35, 269, 15947 }, // Ô
+    { 29, 37, 32, 3, 35, 269, 3411 }, // Õ
+    { 29, 38, 32, 3, 36, 276, 16216 }, // Ö
+    { 19, 10, 17, 0, 12, 48, 3680 }, // ×
+    { 58, 54, 32, -12, 40, 783, 3728 }, // Ø
+    { 28, 37, 29, 2, 35, 259, 16492 }, // Ù
+    { 28, 42, 29, 2, 40, 294, 16751 }, // Ú
+    { 28, 38, 29, 2, 36, 266, 17045 }, // Û
+    { 28, 39, 29, 2, 37, 273, 17311 }, // Ü
+    { 23, 42, 31, 8, 42, 242, 4511 }, // Ý
+    { 18, 24, 16, 1, 23, 108, 4753 }, // Þ
+    { 21, 25, 20, 1, 23, 132, 4861 }, // ß
+    { 19, 27, 25, 2, 26, 129, 17584 }, // à
+    { 20, 32, 25, 2, 31, 160, 17713 }, // á
+    { 20, 28, 25, 2, 27, 140, 17873 }, // â
+    { 21, 28, 25, 2, 27, 147, 4993 }, // ã
+    { 22, 29, 25, 2, 28, 160, 18013 }, // ä
+    { 19, 29, 25, 2, 28, 138, 5140 }, // å
+    { 31, 19, 37, 2, 18, 148, 5278 }, // æ
+    { 16, 25, 23, 3, 18, 100, 18173 }, // ç
+    { 20, 30, 25, 2, 29, 150, 18273 }, // è
+    { 21, 35, 25, 2, 34, 184, 18423 }, // é
+    { 21, 31, 25, 2, 30, 163, 18607 }, // ê
+    { 23, 32, 25, 2, 31, 184, 18770 }, // ë
+    { 13, 27, 12, 1, 26, 88, 18954 }, // ì
+    { 15, 32, 12, 1, 31, 120, 19042 }, // í
+    { 17, 27, 12, -1, 26, 115, 19162 }, // î
+    { 15, 27, 12, 1, 26, 102, 19277 }, // ï
+    { 27, 26, 20, 0, 24, 176, 5426 }, // ð
+    { 22, 28, 25, 2, 28, 154, 19379 }, // ñ
+    { 20, 27, 25, 3, 26, 135, 19533 }, // ò
+    { 20, 32, 25, 3, 31, 160, 19668 }, // ó
+    { 20, 28, 25, 3, 27, 140, 19828 }, // ô
+    { 20, 28, 25, 3, 27, 140, 5602 }, // õ
+    { 21, 29, 25, 3, 28, 153, 19968 }, // ö
+    { 22, 21, 26, 5, 20, 116, 5742 }, // ÷
+    { 33, 51, 25, -4, 35, 421, 5858 }, // ø
+    { 20, 27, 25, 3, 26, 135, 20121 }, // ù
+    { 20, 32, 25, 3, 31, 160, 20256 }, // ú
+    { 20, 28, 25, 3, 27, 140, 20416 }, // û
+    { 21, 29, 25, 3, 28, 153, 20556 }, // ü
+    { 24, 43, 27, 1, 34, 258, 6279 }, // ý
+    { 19, 31, 16, 0, 25, 148, 6537 }, // þ
+    { 26, 39, 27, 1, 30, 254, 6685 }, // ÿ
+    { 28, 35, 33, 2, 35, 245, 6939 }, // Ā
+    { 23, 29, 25, 2, 28, 167, 7184 }, // ā
+    { 29, 35, 33, 2, 35, 254, 7351 }, // Ă
+    { 23, 29, 25, 2, 28, 167, 7605 }, // ă
+    { 24, 33, 33, 2, 25, 198, 7772 }, // Ą
+    { 19, 27, 25, 2, 18, 129, 7970 }, // ą
+    { 26, 36, 28, 2, 36, 234, 8099 }, // Ć
+    { 17, 25, 23, 3, 25, 107, 8333 }, // ć
+    { 28, 38, 28, 2, 38, 266, 8440 }, // Ĉ
+    { 21, 27, 23, 3, 27, 142, 8706 }, // ĉ
+    { 26, 36, 28, 2, 36, 234, 8848 }, // Ċ
+    { 18, 26, 23, 3, 26, 117, 9082 }, // ċ
+    { 29, 38, 28, 2, 38, 276, 9199 }, // Č
+    { 22, 28, 23, 3, 28, 154, 9475 }, // č
+    { 28, 37, 30, 2, 37, 259, 9629 }, // Ď
+    { 28, 26, 26, 3, 25, 182, 9888 }, // ď
+    { 29, 25, 30, 0, 25, 182, 10070 }, // Đ
+    { 27, 26, 26, 3, 25, 176, 10252 }, // đ
+    { 25, 36, 26, 2, 36, 225, 10428 }, // Ē
+    { 24, 32, 25, 2, 31, 192, 10653 }, // ē
+    { 26, 36, 26, 2, 36, 234, 10845 }, // Ĕ
+    { 24, 32, 25, 2, 31, 192, 11079 }, // ĕ
+    { 24, 36, 26, 2, 36, 216, 11271 }, // Ė
+    { 21, 32, 25, 2, 31, 168, 11487 }, // ė
+    { 24, 32, 26, 2, 25, 192, 11655 }, // Ę
+    { 20, 29, 25, 2, 17, 145, 11847 }, // ę
+    { 27, 38, 26, 2, 38, 257, 11992 }, // Ě
+    { 25, 34, 25, 2, 33, 213, 12249 }, // ě
+    { 30, 40, 33, 3, 39, 300, 12462 }, // Ĝ
+    { 26, 39, 25, 0, 30, 254, 12762 }, // ĝ
+    { 30, 38, 33, 3, 37, 285, 13016 }, // Ğ
+    { 27, 37, 25, 0, 28, 250, 13301 }, // ğ
+    { 27, 39, 33, 3, 38, 264, 13551 }, // Ġ
+    { 23, 37, 25, 0, 28, 213, 13815 }, // ġ
+    { 27, 44, 33, 3, 43, 297, 14028 }, // Ģ
+    { 24, 39, 25, 0, 30, 234, 14325 }, // ģ
+    { 27, 37, 30, 2, 37, 250, 14559 }, // Ĥ
+    { 21, 36, 26, 2, 35, 189, 14809 }, // ĥ
+    { 28, 25, 30, 2, 25, 175, 14998 }, // Ħ
+    { 20, 26, 26, 2, 25, 130, 15173 }, // ħ
+    { 19, 40, 15, 2, 39, 190, 15303 }, // Ĩ
+    { 15, 29, 12, 1, 28, 109, 15493 }, // ĩ
+    { 20, 39, 15, 2, 38, 195, 15602 }, // Ī
+    { 17, 28, 12, 1, 27, 119, 15797 }, // ī
+    { 16, 34, 15, -1, 26, 136, 15916 }, // Į
+    { 18, 36, 12, -3, 27, 162, 16052 }, // į
+    { 17, 39, 15, 2, 38, 166, 16214 }, // İ
+    { 10, 18, 12, 1, 17, 45, 16380 }, // ı
+    { 29, 38, 46, 8, 26, 276, 16425 }, // Ĳ
+    { 28, 35, 12, 1, 27, 245, 16701 }, // ĳ
+    { 30, 43, 26, 0, 36, 323, 16946 }, // Ĵ
+    { 24, 37, 18, 2, 29, 222, 17269 }, // ĵ
+    { 25, 40, 30, 2, 40, 250, 17491 }, // Ķ
+    { 21, 40, 26, -1, 25, 210, 17741 }, // ķ
+    { 17, 16, 19, -3, 16, 68, 17951 }, // ĸ
+    { 19, 34, 26, 2, 34, 162, 18019 }, // Ĺ
+    { 18, 38, 17, 2, 38, 171, 18181 }, // ĺ
+    { 20, 40, 26, 1, 25, 200, 18352 }, // Ļ
+    { 18, 42, 17, -3, 26, 189, 18552 }, // ļ
+    { 21, 25, 26, 2, 25, 132, 18741 }, // Ľ
+    { 21, 30, 17, 2, 30, 158, 18873 }, // ľ
+    { 22, 25, 26, 2, 25, 138, 19031 }, // Ŀ
+    { 18, 26, 17, 2, 26, 117, 19169 }, // ŀ
+    { 45, 41, 26, -14, 33, 462, 19286 }, // Ł
+    { 31, 26, 17, -10, 26, 202, 19748 }, // ł
+    { 28, 35, 30, 2, 35, 245, 19950 }, // Ń
+    { 21, 29, 25, 2, 29, 153, 20195 }, // ń
+    { 28, 37, 30, 2, 25, 259, 20348 }, // Ņ
+    { 20, 30, 25, 2, 18, 150, 20607 }, // ņ
+    { 30, 38, 30, 2, 38, 285, 20757 }, // Ň
+    { 26, 31, 25, 2, 31, 202, 21042 }, // ň
+    { 38, 30, 25, -16, 30, 285, 21244 }, // ŉ
+    { 28, 32, 30, 2, 25, 224, 21529 }, // Ŋ
+    { 20, 25, 25, 2, 18, 125, 21753 }, // ŋ
+    { 29, 38, 32, 3, 36, 276, 21878 }, // Ō
+    { 22, 29, 25, 3, 28, 160, 22154 }, // ō
+    { 29, 38, 32, 3, 36, 276, 22314 }, // Ŏ
+    { 22, 29, 25, 3, 28, 160, 22590 }, // ŏ
+    { 32, 37, 32, 3, 35, 296, 22750 }, // Ő
+    { 26, 28, 25, 3, 27, 182, 23046 }, // ő
+    { 40, 28, 35, 3, 26, 280, 20709 }, // Œ
+    { 31, 19, 31, 3, 18, 148, 20989 }, // œ
+    { 23, 34, 28, 2, 34, 196, 23228 }, // Ŕ
+    { 17, 26, 21, 2, 25, 111, 23424 }, // ŕ
+    { 23, 40, 28, 2, 40, 230, 23535 }, // Ŗ
+    { 17, 31, 21, 2, 30, 132, 23765 }, // ŗ
+    { 26, 37, 28, 2, 37, 241, 23897 }, // Ř
+    { 21, 28, 21, 2, 27, 147, 24138 }, // ř
+    { 25, 35, 30, 2, 34, 219, 24285 }, // Ś
+    { 19, 27, 25, 2, 25, 129, 24504 }, // ś
+    { 27, 36, 30, 2, 35, 243, 24633 }, // Ŝ
+    { 23, 29, 25, 2, 27, 167, 24876 }, // ŝ
+    { 25, 33, 30, 2, 25, 207, 25043 }, // Ş
+    { 19, 26, 25, 2, 18, 124, 25250 }, // ş
+    { 29, 37, 30, 2, 36, 269, 25374 }, // Š
+    { 24, 30, 25, 2, 28, 180, 25643 }, // š
+    { 24, 33, 30, 7, 25, 198, 25823 }, // Ţ
+    { 17, 29, 23, 3, 22, 124, 26021 }, // ţ
+    { 24, 37, 30, 7, 37, 222, 26145 }, // Ť
+    { 23, 27, 23, 5, 27, 156, 26367 }, // ť
+    { 24, 25, 30, 7, 25, 150, 26523 }, // Ŧ
+    { 17, 22, 23, 3, 22, 94, 26673 }, // ŧ
+    { 28, 40, 29, 2, 38, 280, 26767 }, // Ũ
+    { 20, 29, 25, 3, 28, 145, 27047 }, // ũ
+    { 28, 39, 29, 2, 37, 273, 27192 }, // Ū
+    { 22, 28, 25, 3, 27, 154, 27465 }, // ū
+    { 28, 39, 29, 2, 37, 273, 27619 }, // Ŭ
+    { 22, 28, 25, 3, 27, 154, 27892 }, // ŭ
+    { 28, 41, 29, 2, 39, 287, 28046 }, // Ů
+    { 20, 31, 25, 3, 30, 155, 28333 }, // ů
+    { 32, 38, 29, 2, 36, 304, 28488 }, // Ű
+    { 26, 27, 25, 3, 26, 176, 28792 }, // ű
+    { 28, 32, 29, 2, 25, 224, 28968 }, // Ų
+    { 20, 26, 25, 3, 17, 130, 29192 }, // ų
+    { 34, 36, 41, 7, 36, 306, 29322 }, // Ŵ
+    { 25, 30, 32, 6, 29, 188, 29628 }, // ŵ
+    { 23, 38, 31, 8, 38, 219, 29816 }, // Ŷ
+    { 24, 39, 27, 1, 30, 234, 30035 }, // ŷ
+    { 23, 39, 31, 8, 39, 225, 30269 }, // Ÿ
+    { 30, 34, 31, 2, 34, 255, 30494 }, // Ź
+    { 21, 28, 26, 2, 28, 147, 30749 }, // ź
+    { 30, 34, 31, 2, 34, 255, 30896 }, // Ż
+    { 21, 28, 26, 2, 28, 147, 31151 }, // ż
+    { 30, 36, 31, 2, 36, 270, 31298 }, // Ž
+    { 25, 30, 26, 2, 30, 188, 31568 }, // ž
+    { 17, 24, 18, 3, 24, 102, 31756 }, // ſ
+    { 11, 6, 0, 6, 23, 17, 31858 }, // ̀
+    { 9, 7, 0, 5, 23, 16, 31875 }, // ́
+    { 17, 8, 0, -1, 1, 34, 31891 }, // ̂
+    { 12, 7, 0, 6, 22, 21, 31925 }, // ̃
+    { 16, 5, 0, 6, 21, 20, 31946 }, // ̄
+    { 21, 5, 0, 7, 27, 27, 31966 }, // ̅
+    { 15, 7, 0, 6, 21, 27, 31993 }, // ̆
+    { 8, 7, 0, 6, 24, 14, 32020 }, // ̇
+    { 14, 6, 0, 4, 21, 21, 32034 }, // ̈
+    { 7, 7, 0, 10, 19, 13, 32055 }, // ̉
+    { 8, 8, 0, 6, 23, 16, 32068 }, // ̊
+    { 24, 6, 0, 5, 23, 36, 32084 }, // ̋
+    { 16, 8, 0, 6, 23, 32, 32120 }, // ̌
+    { 24, 6, 0, -11, 23, 36, 32152 }, // ̏
+    { 13, 10, 0, 3, 23, 33, 32188 }, // ̒
+    { 12, 10, 0, 4, 22, 30, 32221 }, // ̓
+    { 13, 10, 0, -7, 22, 33, 32251 }, // ̔
+    { 8, 9, 0, 0, 0, 18, 32284 }, // ̘
+    { 9, 9, 0, 1, 0, 21, 32302 }, // ̙
+    { 14, 9, 0, 7, 24, 32, 32323 }, // ̚
+    { 7, 9, 0, 4, 20, 16, 32355 }, // ̛
+    { 7, 9, 0, -1, 0, 16, 32371 }, // ̜
+    { 9, 9, 0, 2, 6, 21, 32387 }, // ̝
+    { 8, 8, 0, -1, 0, 16, 32408 }, // ̞
+    { 7, 7, 0, 0, -2, 13, 32424 }, // ̟
+    { 17, 5, 0, -2, -3, 22, 32437 }, // ̠
+    { 8, 7, 0, -4, 3, 14, 32459 }, // ̣
+    { 14, 6, 0, -2, -2, 21, 32473 }, // ̤
+    { 8, 8, 0, 6, 23, 16, 32494 }, // ̥
+    { 13, 10, 0, -1, 5, 33, 32510 }, // ̦
+    { 9, 9, 0, -1, 1, 21, 32543 }, // ̧
+    { 9, 10, 0, 0, 1, 23, 32564 }, // ̨
+    { 8, 10, 0, -2, -1, 20, 0 }, // ̩
+    { 14, 7, 0, -1, 0, 25, 20 }, // ̪
+    { 19, 9, 0, -1, 1, 43, 45 }, // ̬
+    { 18, 9, 0, -1, 1, 41, 88 }, // ̭
+    { 14, 8, 0, 7, 25, 28, 129 }, // ̰
+    { 15, 5, 0, 7, 24, 19, 157 }, // ̱
+    { 16, 5, 0, -2, -1, 20, 176 }, // ̲
+    { 14, 8, 0, 8, 25, 28, 196 }, // ̴
+    { 17, 4, 0, 2, 11, 17, 224 }, // ̵
+    { 7, 10, 0, 2, 0, 18, 241 }, // ̹
+    { 16, 9, 0, -5, 1, 36, 259 }, // ̺
+    { 14, 10, 0, -2, 1, 35, 295 }, // ̻
+    { 13, 8, 0, -1, 1, 26, 330 }, // ̼
+    { 11, 7, 0, 5, 22, 20, 356 }, // ̽
+    { 12, 7, 0, 6, 22, 21, 376 }, // ͂
+    { 7, 8, 0, 12, 26, 14, 397 }, // ̓
+    { 17, 22, 0, 5, 37, 94, 411 }, // ̈́
+    { 14, 7, 0, 5, 24, 25, 505 }, // ͆
+    { 18, 11, 0, -2, 0, 50, 530 }, // ͇
+    { 15, 9, 0, -1, 1, 34, 580 }, // ͈
+    { 12, 9, 0, -1, -1, 27, 614 }, // ͉
+    { 21, 23, 0, 5, 31, 121, 641 }, // ͊
+    { 29, 23, 0, 10, 34, 167, 762 }, // ͋
+    { 22, 16, 0, 15, 16, 88, 929 }, // ͌
+    { 16, 33, 0, 1, 11, 132, 1017 }, // ͍
+    { 5, 5, 0, 15, 4, 7, 1149 }, // ͎
+    { 26, 7, 0, 0, 1, 46, 1156 }, // ͜
+    { 26, 8, 0, 5, 24, 52, 1202 }, // ͡
+    { 32, 9, 0, -1, -1, 72, 1254 }, // ͢
+    { 24, 36, 25, 2, 36, 216, 1326 }, // Ѐ
+    { 25, 36, 26, 2, 36, 225, 0 }, // Ё
+    { 27, 27, 20, 3, 25, 183, 1542 }, // Ђ
+    { 23, 34, 19, 1, 33, 196, 1725 }, // Ѓ
+    { 25, 25, 24, 2, 23, 157, 1921 }, // Є
+    { 25, 26, 30, 2, 25, 163, 2078 }, // Ѕ
+    { 13, 27, 15, 2, 26, 88, 2241 }, // І
+    { 18, 38, 15, 2, 37, 171, 2329 }, // Ї
+    { 26, 32, 26, 0, 25, 208, 2500 }, // Ј
+    { 31, 25, 34, 2, 22, 194, 2708 }, // Љ
+    { 30, 24, 18, -6, 23, 180, 2902 }, // Њ
+    { 24, 28, 30, 7, 27, 168, 3082 }, // Ћ
+    { 25, 34, 30, 2, 34, 213, 3250 }, // Ќ
+    { 26, 33, 28, 2, 33, 215, 3463 }, // Ѝ
+    { 24, 37, 23, 0, 34, 222, 3678 }, // Ў
+    { 25, 28, 23, 2, 21, 175, 3900 }, // Џ
+    { 24, 25, 33, 2, 25, 150, 225 }, // А
+    { 20, 22, 19, 3, 21, 110, 375 }, // Б
+    { 20, 23, 20, 2, 22, 115, 485 }, // В
+    { 23, 23, 19, 1, 22, 133, 600 }, // Г
+    { 24, 26, 24, 2, 22, 156, 733 }, // Д
+    { 23, 25, 25, 2, 25, 144, 889 }, // Е
+    { 41, 25, 44, 1, 25, 257, 1033 }, // Ж
+    { 19, 23, 19, 2, 21, 110, 1290 }, // З
+    { 26, 25, 28, 2, 25, 163, 1400 }, // И
+    { 26, 32, 28, 2, 32, 208, 1563 }, // Й
+    { 25, 25, 30, 2, 25, 157, 1771 }, // К
+    { 25, 25, 18, -1, 22, 157, 1928 }, // Л
+    { 28, 23, 25, 1, 22, 161, 2085 }, // М
+    { 27, 25, 30, 2, 25, 169, 2246 }, // Н
+    { 29, 28, 32, 3, 26, 203, 2415 }, // О
+    { 23, 24, 20, 1, 23, 138, 2618 }, // П
+    { 23, 25, 26, 2, 25, 144, 2756 }, // Р
+    { 26, 27, 28, 2, 27, 176, 2900 }, // С
+    { 24, 25, 30, 7, 25, 150, 3076 }, // Т
+    { 24, 25, 23, 0, 22, 150, 3226 }, // У
+    { 23, 22, 25, 5, 22, 127, 3376 }, // Ф
+    { 30, 25, 32, 2, 25, 188, 3503 }, // Х
+    { 22, 28, 21, 1, 22, 154, 3691 }, // Ц
+    { 18, 22, 19, 5, 22, 99, 3845 }, // Ч
+    { 27, 23, 24, 1, 22, 156, 3944 }, // Ш
+    { 27, 28, 26, 1, 22, 189, 4100 }, // Щ
+    { 19, 23, 18, -1, 22, 110, 4289 }, // Ъ
+    { 32, 27, 33, 1, 26, 216, 4399 }, // Ы
+    { 17, 23, 18, 1, 22, 98, 4615 }, // Ь
+    { 26, 25, 28, 2, 23, 163, 4713 }, // Э
+    { 28, 24, 27, 2, 23, 168, 4876 }, // Ю
+    { 24, 25, 26, 1, 25, 150, 5044 }, // Я
+    { 19, 19, 25, 2, 18, 91, 5194 }, // а
+    { 23, 28, 20, 3, 26, 161, 5285 }, // б
+    { 17, 17, 21, -1, 17, 73, 5446 }, // в
+    { 19, 18, 17, 1, 17, 86, 5519 }, // г
+    { 21, 21, 22, 2, 17, 111, 5605 }, // д
+    { 20, 18, 25, 2, 17, 90, 5716 }, // е
+    { 40, 21, 43, 1, 21, 210, 5806 }, // ж
+    { 14, 16, 13, -2, 16, 56, 6016 }, // з
+    { 21, 18, 20, 1, 17, 95, 6072 }, // и
+    { 21, 24, 19, 0, 24, 126, 6167 }, // й
+    { 20, 16, 24, -1, 16, 80, 6293 }, // к
+    { 18, 17, 12, -4, 15, 77, 6373 }, // л
+    { 22, 18, 25, -1, 18, 99, 6450 }, // м
+    { 23, 18, 24, -1, 18, 104, 6549 }, // н
+    { 20, 19, 25, 3, 18, 95, 6653 }, // о
+    { 21, 18, 19, 1, 17, 95, 6748 }, // п
+    { 26, 26, 27, -1, 17, 169, 6843 }, // р
+    { 16, 18, 23, 3, 18, 72, 7012 }, // с
+    { 19, 18, 20, 4, 17, 86, 7084 }, // т
+    { 24, 25, 27, 1, 16, 150, 7170 }, // у
+    { 26, 24, 25, 2, 17, 156, 7320 }, // ф
+    { 24, 18, 21, 0, 17, 108, 7476 }, // х
+    { 21, 22, 21, 1, 17, 116, 7584 }, // ц
+    { 13, 15, 13, 0, 15, 49, 7700 }, // ч
+    { 26, 18, 24, 1, 17, 117, 7749 }, // ш
+    { 26, 23, 26, 1, 17, 150, 7866 }, // щ
+    { 15, 17, 14, -3, 16, 64, 8016 }, // ъ
+    { 24, 20, 25, -2, 19, 120, 8080 }, // ы
+    { 14, 18, 14, -2, 17, 63, 8200 }, // ь
+    { 18, 18, 19, 2, 17, 81, 8263 }, // э
+    { 22, 20, 22, 0, 19, 110, 8344 }, // ю
+    { 17, 19, 24, 2, 19, 81, 8454 }, // я
+    { 21, 32, 25, 2, 31, 168, 4075 }, // ѐ
+    { 22, 30, 25, 2, 29, 165, 8535 }, // ё
+    { 20, 32, 26, 2, 25, 160, 4243 }, // ђ
+    { 19, 26, 17, 1, 25, 124, 4403 }, // ѓ
+    { 18, 17, 17, -2, 16, 77, 4527 }, // є
+    { 19, 20, 25, 2, 18, 95, 4604 }, // ѕ
+    { 14, 28, 12, 1, 27, 98, 4699 }, // і
+    { 15, 27, 12, 1, 26, 102, 4797 }, // ї
+    { 19, 34, 18, 2, 26, 162, 4899 }, // ј
+    { 21, 17, 23, -1, 15, 90, 5061 }, // љ
+    { 21, 17, 12, -7, 16, 90, 5151 }, // њ
+    { 20, 26, 26, 2, 25, 130, 5241 }, // ћ
+    { 21, 25, 24, -1, 25, 132, 5371 }, // ќ
+    { 21, 28, 20, 1, 27, 147, 5503 }, // ѝ
+    { 27, 39, 27, 1, 30, 264, 5650 }, // ў
+    { 18, 22, 17, -1, 16, 99, 5914 }, // џ
+    { 18, 24, 22, 5, 22, 108, 6013 }, // Ѣ
+    { 19, 24, 19, 3, 22, 114, 6121 }, // ѣ
+    { 31, 24, 25, -1, 22, 186, 6235 }, // Ѫ
+    { 23, 18, 18, -4, 16, 104, 6421 }, // ѫ
+    { 32, 32, 33, 3, 31, 256, 6525 }, // Ѳ
+    { 25, 26, 25, 3, 25, 163, 6781 }, // ѳ
+    { 29, 30, 32, 8, 30, 218, 6944 }, // Ѵ
+    { 20, 21, 25, 6, 21, 105, 7162 }, // ѵ
+    { 14, 11, 0, 8, 28, 39, 7267 }, // ҆
+    { 24, 26, 19, 1, 25, 156, 7306 }, // Ґ
+    { 21, 22, 17, 1, 21, 116, 7462 }, // ґ
+    { 23, 24, 19, 1, 22, 138, 7578 }, // Ғ
+    { 16, 16, 13, -2, 15, 64, 7716 }, // ғ
+    { 23, 27, 18, 0, 25, 156, 7780 }, // Ҕ
+    { 15, 17, 11, -4, 15, 64, 7936 }, // ҕ
+    { 41, 30, 44, 1, 25, 308, 8000 }, // Җ
+    { 28, 21, 29, -2, 17, 147, 8308 }, // җ
+    { 19, 26, 19, 2, 21, 124, 8455 }, // Ҙ
+    { 14, 23, 13, -2, 16, 81, 8579 }, // ҙ
+    { 27, 30, 21, 0, 25, 203, 8660 }, // Қ
+    { 19, 20, 15, -3, 17, 95, 8863 }, // қ
+    { 30, 24, 32, 2, 22, 180, 8958 }, // Ҝ
+    { 22, 17, 22, 0, 16, 94, 9138 }, // ҝ
+    { 25, 25, 30, 2, 25, 157, 9232 }, // Ҟ
+    { 18, 25, 26, 2, 25, 113, 9389 }, // ҟ
+    { 25, 25, 30, 2, 25, 157, 9502 }, // Ҡ
+    { 18, 17, 21, -2, 17, 77, 9659 }, // ҡ
+    { 27, 29, 22, -2, 25, 196, 9736 }, // Ң
+    { 20, 20, 16, -5, 17, 100, 9932 }, // ң
+    { 38, 25, 30, 2, 25, 238, 10032 }, // Ҥ
+    { 27, 17, 21, -2, 17, 115, 10270 }, // ҥ
+    { 34, 27, 37, 3, 25, 230, 10385 }, // Ҧ
+    { 28, 29, 37, 5, 20, 203, 10615 }, // ҧ
+    { 30, 25, 20, -3, 22, 188, 10818 }, // Ҩ
+    { 24, 20, 29, 2, 18, 120, 11006 }, // ҩ
+    { 25, 31, 28, 3, 27, 194, 11126 }, // Ҫ
+    { 16, 21, 23, 3, 18, 84, 11320 }, // ҫ
+    { 24, 29, 23, 3, 25, 174, 11404 }, // Ҭ
+    { 17, 20, 16, -1, 17, 85, 11578 }, // ҭ
+    { 23, 25, 31, 8, 25, 144, 11663 }, // Ү
+    { 18, 23, 22, 6, 16, 104, 11807 }, // ү
+    { 26, 25, 31, 5, 25, 163, 11911 }, // Ұ
+    { 23, 23, 22, 1, 16, 133, 12074 }, // ұ
+    { 30, 30, 23, 1, 25, 225, 12207 }, // Ҳ
+    { 21, 20, 23, 1, 17, 105, 12432 }, // ҳ
+    { 24, 28, 18, 0, 21, 168, 12537 }, // Ҵ
+    { 18, 20, 25, 4, 15, 90, 12705 }, // ҵ
+    { 20, 29, 20, 3, 22, 145, 12795 }, // Ҷ
+    { 14, 21, 14, 0, 16, 74, 12940 }, // ҷ
+    { 18, 22, 19, 5, 22, 99, 13014 }, // Ҹ
+    { 13, 15, 13, 0, 15, 49, 13113 }, // ҹ
+    { 20, 26, 20, 1, 24, 130, 13162 }, // Һ
+    { 20, 26, 26, 2, 25, 130, 13292 }, // һ
+    { 33, 23, 41, 6, 22, 190, 13422 }, // Ҽ
+    { 23, 16, 20, 2, 15, 92, 13612 }, // ҽ
+    { 33, 27, 26, 7, 22, 223, 13704 }, // Ҿ
+    { 24, 20, 19, 3, 15, 120, 13927 }, // ҿ
+    { 13, 27, 15, 2, 26, 88, 14047 }, // Ӏ
+    { 41, 39, 44, 1, 39, 400, 14135 }, // Ӂ
+    { 40, 33, 43, 1, 33, 330, 14535 }, // ӂ
+    { 23, 30, 21, 1, 22, 173, 14865 }, // Ӄ
+    { 16, 21, 15, -2, 15, 84, 15038 }, // ӄ
+    { 25, 29, 18, -1, 22, 182, 15122 }, // Ӆ
+    { 17, 20, 12, -1, 15, 85, 15304 }, // ӆ
+    { 27, 32, 30, 2, 25, 216, 15389 }, // Ӈ
+    { 20, 22, 21, -2, 17, 110, 15605 }, // ӈ
+    { 27, 35, 30, 2, 25, 237, 15715 }, // Ӊ
+    { 20, 24, 21, 0, 17, 120, 15952 }, // ӊ
+    { 20, 28, 20, 4, 22, 140, 16072 }, // Ӌ
+    { 12, 20, 18, 3, 15, 60, 16212 }, // ӌ
+    { 31, 35, 34, 2, 25, 272, 16272 }, // Ӎ
+    { 22, 24, 23, 0, 17, 132, 16544 }, // ӎ
+    { 11, 22, 18, 6, 21, 61, 16676 }, // ӏ
+    { 29, 34, 33, 2, 34, 247, 16737 }, // Ӑ
+    { 24, 28, 25, 2, 27, 168, 16984 }, // ӑ
+    { 27, 34, 33, 2, 34, 230, 17152 }, // Ӓ
+    { 23, 29, 25, 2, 28, 167, 17382 }, // ӓ
+    { 40, 26, 40, 2, 25, 260, 17549 }, // Ӕ
+    { 31, 19, 37, 2, 18, 148, 17809 }, // ӕ
+    { 28, 35, 25, 2, 35, 245, 17957 }, // Ӗ
+    { 24, 31, 25, 2, 30, 186, 18202 }, // ӗ
+    { 24, 24, 31, 10, 22, 144, 18388 }, // Ә
+    { 19, 19, 25, 9, 18, 91, 18532 }, // ә
+    { 24, 33, 31, 10, 31, 198, 18623 }, // Ӛ
+    { 21, 24, 25, 7, 18, 126, 18821 }, // ӛ
+    { 41, 38, 41, 5, 38, 390, 18947 }, // Ӝ
+    { 40, 33, 43, 1, 33, 330, 19337 }, // ӝ
+    { 22, 36, 19, 2, 34, 198, 19667 }, // Ӟ
+    { 20, 23, 13, -2, 23, 115, 19865 }, // ӟ
+    { 19, 23, 20, 3, 22, 110, 19980 }, // Ӡ
+    { 18, 23, 20, 2, 16, 104, 20090 }, // ӡ
+    { 26, 33, 26, 2, 33, 215, 20194 }, // Ӣ
+    { 23, 28, 20, 1, 27, 161, 20409 }, // ӣ
+    { 26, 32, 28, 2, 32, 208, 20570 }, // Ӥ
+    { 21, 27, 20, 1, 26, 142, 20778 }, // ӥ
+    { 29, 37, 32, 3, 35, 269, 20920 }, // Ӧ
+    { 20, 31, 25, 3, 30, 155, 21189 }, // ӧ
+    { 26, 24, 32, 4, 23, 156, 21344 }, // Ө
+    { 20, 19, 25, 3, 18, 95, 21500 }, // ө
+    { 26, 33, 32, 4, 32, 215, 21595 }, // Ӫ
+    { 20, 28, 25, 3, 27, 140, 21810 }, // ӫ
+    { 43, 37, 28, 2, 35, 398, 21950 }, // Ӭ
+    { 18, 25, 19, 2, 24, 113, 22348 }, // ӭ
+    { 24, 37, 23, 0, 34, 222, 22461 }, // Ӯ
+    { 26, 39, 27, 1, 30, 254, 22683 }, // ӯ
+    { 24, 37, 23, 0, 34, 222, 22937 }, // Ӱ
+    { 24, 38, 27, 1, 29, 228, 23159 }, // ӱ
+    { 28, 37, 23, 0, 34, 259, 23387 }, // Ӳ
+    { 31, 38, 27, 1, 29, 295, 23646 }, // ӳ
+    { 18, 29, 19, 5, 29, 131, 23941 }, // Ӵ
+    { 15, 22, 13, 0, 22, 83, 24072 }, // ӵ
+    { 23, 27, 19, 1, 22, 156, 24155 }, // Ӷ
+    { 16, 19, 13, -2, 15, 76, 24311 }, // ӷ
+    { 32, 40, 33, 1, 39, 320, 24387 }, // Ӹ
+    { 26, 31, 25, -2, 30, 202, 24707 }, // ӹ
+    { 30, 29, 32, 2, 25, 218, 24909 }, // Ӽ
+    { 21, 20, 23, -2, 17, 105, 25127 }, // ӽ
+    { 0, 0, 19, 0, 0, 0, 25232 }, //  
+    { 0, 0, 34, 0, 0, 0, 25232 }, //  
+    { 0, 0, 19, 0, 0, 0, 25232 }, //  
+    { 0, 0, 34, 0, 0, 0, 25232 }, //  
+    { 0, 0, 14, 0, 0, 0, 25232 }, //  
+    { 0, 0, 12, 0, 0, 0, 25232 }, //  
+    { 0, 0, 10, 0, 0, 0, 25232 }, //  
+    { 0, 0, 21, 0, 0, 0, 25232 }, //  
+    { 0, 0, 8, 0, 0, 0, 25232 }, //  
+    { 0, 0, 11, 0, 0, 0, 25232 }, //  
+    { 0, 0, 9, 0, 0, 0, 25232 }, //  
+    { 0, 0, 5, 0, 0, 0, 25232 }, // ​
+    { 0, 0, 0, 0, 0, 0, 25232 }, // ‌
+    { 0, 0, 0, 0, 0, 0, 25232 }, // ‍
+    { 0, 0, 0, 0, 0, 0, 25232 }, // ‎
+    { 0, 0, 0, 0, 0, 0, 25232 }, // ‏
+    { 17, 4, 16, 2, 11, 17, 25232 }, // ‐
+    { 17, 4, 16, 2, 11, 17, 25249 }, // ‑
+    { 25, 4, 16, -1, 11, 25, 25266 }, // ‒
+    { 22, 6, 23, 3, 11, 33, 21137 }, // –
+    { 32, 6, 33, 3, 11, 48, 21170 }, // —
+    { 32, 6, 33, 3, 11, 48, 25291 }, // ―
+    { 21, 27, 16, 2, 22, 142, 25339 }, // ‖
+    { 27, 10, 16, -6, -2, 68, 25481 }, // ‗
+    { 12, 10, 13, 6, 26, 30, 21218 }, // ‘
+    { 13, 10, 13, 5, 26, 33, 21248 }, // ’
+    { 13, 10, 9, -2, 5, 33, 25549 }, // ‚
+    { 12, 10, 13, 6, 26, 30, 25582 }, // ‛
+    { 22, 10, 22, 6, 26, 55, 21281 }, // “
+    { 23, 10, 22, 5, 26, 58, 21336 }, // ”
+    { 13, 10, 9, -2, 5, 33, 25612 }, // „
+    { 22, 10, 22, 6, 26, 55, 25645 }, // ‟
+    { 18, 40, 24, 7, 30, 180, 25700 }, // †
+    { 20, 41, 25, 6, 30, 205, 25880 }, // ‡
+    { 26, 23, 15, -3, 26, 150, 26085 }, // •
+    { 11, 10, 18, 5, 13, 28, 26235 }, // ‣
+    { 8, 7, 18, 5, 7, 14, 26263 }, // ․
+    { 8, 7, 18, 5, 7, 14, 26277 }, // ‥
+    { 28, 7, 28, 0, 7, 49, 21394 }, // …
+    { 5, 4, 16, 6, 11, 5, 26291 }, // ‧
+    { 0, 0, 32, 0, 0, 0, 26296 }, //  
+    { 26, 26, 33, 4, 23, 169, 26296 }, // ‰
+    { 13, 10, 16, 9, 26, 33, 26465 }, // ′
+    { 22, 10, 23, 9, 26, 55, 26498 }, // ″
+    { 22, 9, 12, -3, 25, 50, 26553 }, // ‴
+    { 7, 9, 12, 8, 25, 16, 26603 }, // ‵
+    { 13, 9, 12, 6, 25, 30, 26619 }, // ‶
+    { 22, 9, 12, 0, 25, 50, 26649 }, // ‷
+    { 17, 7, 19, 6, 25, 30, 26699 }, // ‸
+    { 12, 16, 12, 3, 16, 48, 26729 }, // ‹
+    { 12, 16, 12, -3, 16, 48, 26777 }, // ›
+    { 38, 38, 40, 2, 30, 361, 26825 }, // ※
+    { 16, 37, 18, 3, 32, 148, 27186 }, // ‼
+    { 23, 46, 25, 5, 39, 265, 27334 }, // ‽
+    { 16, 4, 16, 6, 24, 16, 27599 }, // ‾
+    { 15, 7, 22, 6, 20, 27, 27615 }, // ‿
+    { 21, 21, 19, 2, 28, 111, 27642 }, // ⁂
+    { 27, 25, 38, 6, 23, 169, 27753 }, // ⁄
+    { 39, 37, 44, 8, 33, 361, 27922 }, // ⁇
+    { 34, 38, 35, 6, 33, 323, 28283 }, // ⁈
+    { 32, 38, 23, -2, 33, 304, 28606 }, // ⁉
+    { 33, 51, 27, -2, 35, 421, 28910 }, // ⁒
+    { 0, 0, 136, 0, 0, 0, 29331 }, //  
+    { 10, 12, 10, 11, 24, 30, 29331 }, // ⁰
+    { 10, 11, 10, 11, 25, 28, 29361 }, // ⁴
+    { 11, 12, 10, 10, 25, 33, 29389 }, // ⁵
+    { 10, 11, 10, 11, 24, 28, 29422 }, // ⁶
+    { 9, 13, 11, 13, 25, 30, 29450 }, // ⁷
+    { 11, 11, 11, 10, 24, 31, 29480 }, // ⁸
+    { 11, 12, 11, 10, 24, 33, 29511 }, // ⁹
+    { 20, 18, 25, 2, 18, 90, 29544 }, // ⁿ
+    { 11, 12, 10, -9, 7, 33, 29634 }, // ₀
+    { 9, 12, 10, -10, 7, 27, 29667 }, // ₁
+    { 12, 12, 11, -10, 7, 36, 29694 }, // ₂
+    { 11, 12, 10, -9, 7, 33, 29730 }, // ₃
+    { 10, 12, 11, -9, 7, 30, 29763 }, // ₄
+    { 10, 12, 10, -9, 7, 30, 29793 }, // ₅
+    { 11, 12, 11, -9, 7, 33, 29823 }, // ₆
+    { 10, 12, 11, -7, 7, 30, 29856 }, // ₇
+    { 11, 12, 11, -9, 7, 33, 29886 }, // ₈
+    { 11, 13, 11, -9, 7, 36, 29919 }, // ₉
+    { 20, 41, 14, 2, 31, 205, 29955 }, // ₍
+    { 20, 41, 13, -9, 31, 205, 30160 }, // ₎
+    { 28, 39, 28, 3, 33, 273, 30365 }, // ₡
+    { 26, 27, 28, 2, 27, 176, 30638 }, // ₢
+    { 22, 27, 20, 1, 26, 149, 30814 }, // ₤
+    { 33, 25, 30, -1, 25, 207, 30963 }, // ₦
+    { 27, 25, 26, 2, 25, 169, 31170 }, // ₧
+    { 35, 27, 38, -1, 25, 237, 31339 }, // ₨
+    { 27, 26, 25, -2, 26, 176, 31576 }, // ₩
+    { 27, 23, 31, 5, 23, 156, 31752 }, // ₪
+    { 25, 25, 15, -2, 24, 157, 31908 }, // ₫
+    { 23, 28, 24, 2, 24, 161, 32065 }, // €
+    { 24, 25, 30, 7, 25, 150, 32226 }, // ₮
+    { 31, 25, 19, 1, 25, 194, 32376 }, // ₱
+    { 26, 38, 33, 3, 32, 247, 0 }, // ₲
+    { 33, 24, 31, 9, 22, 198, 247 }, // ₴
+    { 16, 24, 17, 3, 21, 96, 445 }, // ₵
+    { 28, 26, 30, 7, 26, 182, 541 }, // ₸
+    { 20, 24, 20, 4, 23, 120, 723 }, // ₹
+    { 19, 22, 20, 2, 20, 105, 843 }, // ₺
+    { 23, 25, 24, 4, 23, 144, 948 }, // ₼
+    { 29, 25, 26, -4, 25, 182, 1092 }, // ₽
+    { 20, 20, 21, -5, 15, 100, 1274 }, // ←
+    { 21, 20, 22, 3, 19, 105, 1374 }, // ↑
+    { 20, 20, 22, 6, 15, 100, 1479 }, // →
+    { 21, 21, 22, 8, 19, 111, 1579 }, // ↓
+    { 33, 17, 30, -1, 14, 141, 1690 }, // ↔
+    { 17, 32, 23, 5, 31, 136, 1831 }, // ↕
+    { 19, 14, 23, -2, 13, 67, 1967 }, // ↖
+    { 20, 14, 19, 3, 13, 70, 2034 }, // ↗
+    { 16, 20, 19, 6, 17, 80, 2104 }, // ↘
+    { 16, 20, 19, -3, 17, 80, 2184 }, // ↙
+    { 24, 20, 29, 1, 18, 120, 2264 }, // ⇐
+    { 25, 24, 31, 6, 23, 150, 2384 }, // ⇑
+    { 24, 20, 29, 4, 18, 120, 2534 }, // ⇒
+    { 25, 24, 31, 12, 22, 150, 2654 }, // ⇓
+    { 30, 20, 32, 1, 18, 150, 2804 }, // ⇔
+    { 20, 29, 26, 8, 16, 145, 2954 }, // ⇕
+    { 23, 26, 20, 2, 24, 150, 3099 }, // ∂
+    { 31, 31, 32, 0, 28, 241, 3249 }, // ∅
+    { 24, 23, 25, 1, 22, 138, 3490 }, // ∆
+    { 23, 23, 22, 3, 21, 133, 3628 }, // ∏
+    { 23, 23, 22, 9, 22, 133, 3761 }, // ∐
+    { 21, 22, 17, 1, 21, 116, 3894 }, // ∑
+    { 17, 5, 18, 2, 11, 22, 4010 }, // −
+    { 30, 26, 28, 3, 24, 195, 4032 }, // √
+    { 27, 17, 27, 3, 19, 115, 4227 }, // ∞
+    { 30, 31, 25, 0, 23, 233, 4342 }, // ∫
+    { 12, 20, 9, 1, 20, 60, 4575 }, // ∶
+    { 22, 16, 42, 15, 16, 88, 4635 }, // ≈
+    { 27, 26, 38, 6, 23, 176, 4723 }, // ≠
+    { 28, 25, 23, -4, 21, 175, 4899 }, // ≤
+    { 28, 26, 25, 0, 22, 182, 5074 }, // ≥
+    { 29, 24, 32, 3, 24, 174, 5256 }, // ﬀ
+    { 26, 28, 28, 3, 27, 182, 5430 }, // ﬁ
+    { 26, 25, 32, 3, 25, 163, 5612 }, // ﬂ
+    { 35, 28, 39, 4, 27, 245, 5775 }, // ﬃ
+    { 38, 25, 44, 3, 25, 238, 6020 }, // ﬄ
+    { 33, 24, 35, 1, 22, 198, 6258 }, // ﬆ
 };
 
 static const EpdUnicodeInterval opendyslexic_14_bolditalicIntervals[] = {
@@ -3295,30 +3302,98 @@ static const EpdUnicodeInterval opendyslexic_14_bolditalicIntervals[] = {
     { 0x2248, 0x2248, 0x2D1 },
     { 0x2260, 0x2260, 0x2D2 },
     { 0x2264, 0x2265, 0x2D3 },
+    { 0xFB00, 0xFB04, 0x2D5 },
+    { 0xFB06, 0xFB06, 0x2DA },
 };
 
 static const EpdFontGroup opendyslexic_14_bolditalicGroups[] = {
-    { 0, 5498, 12256, 95, 0 },
-    { 5498, 5522, 15392, 96, 95 },
-    { 11020, 8364, 25347, 126, 191 },
-    { 19384, 1153, 2055, 61, 317 },
-    { 20537, 13237, 32606, 213, 378 },
-    { 33774, 1918, 4405, 63, 591 },
-    { 35692, 609, 1034, 20, 654 },
-    { 36301, 1705, 3479, 20, 674 },
-    { 38006, 966, 1825, 16, 694 },
-    { 38972, 1001, 2157, 15, 710 },
+    { 0, 7766, 21443, 151, 0 },
+    { 7766, 4224, 8700, 66, 379 },
+    { 11990, 11228, 32587, 205, 96 },
+    { 23218, 13795, 32570, 264, 349 },
+    { 37013, 2984, 6456, 45, 686 },
+};
+
+static const uint8_t opendyslexic_14_bolditalicGlyphGroups[731] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 0,
+    0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 2, 2, 2, 0,
+    0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 1, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 3, 1, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 0, 0, 3, 3, 3, 0, 0, 3, 3, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+};
+
+static const EpdLigaturePair opendyslexic_14_bolditalicLigatures[] = {
+    { 0x66, 0x66, 0xFB00 },
+    { 0x66, 0x69, 0xFB01 },
+    { 0x66, 0x6C, 0xFB02 },
+    { 0xFB00, 0x69, 0xFB03 },
+    { 0xFB00, 0x6C, 0xFB04 },
+};
+
+static const uint16_t opendyslexic_14_bolditalicGlyphLookup[368] = {
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x005F, 0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E,
+    0x006F, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E,
+    0x007F, 0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E,
+    0x008F, 0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E,
+    0x009F, 0x00A0, 0x00A1, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE,
+    0x00AF, 0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE,
+    0x024F, 0x0250, 0x0251, 0x0252, 0x0253, 0x0254, 0x0255, 0x0256, 0x0257, 0x0258, 0x0259, 0x025A, 0x025B, 0x025C, 0x025D, 0x025E,
+    0x025F, 0x0260, 0x0261, 0x0262, 0x0263, 0x0264, 0x0265, 0x0266, 0x0267, 0x0268, 0x0269, 0x026A, 0x026B, 0x026C, 0x026D, 0x026E,
+    0x026F, 0x0270, 0x0271, 0x0272, 0x0273, 0x0274, 0x0275, 0x0276, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0277,
+    0x0278, 0xFFFF, 0x0279, 0x027A, 0x027B, 0x027C, 0x027D, 0x027E, 0x027F, 0x0280, 0x0281, 0x0282, 0x0283, 0x0284, 0x0285, 0x0286,
+    0xFFFF, 0xFFFF, 0x0287, 0xFFFF, 0x0288, 0xFFFF, 0xFFFF, 0x0289, 0x028A, 0x028B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x028C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x028D,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
 };
 
 static const EpdFontData opendyslexic_14_bolditalic = {
     opendyslexic_14_bolditalicBitmaps,
     opendyslexic_14_bolditalicGlyphs,
     opendyslexic_14_bolditalicIntervals,
-    56,
+    58,
     53,
     38,
     -16,
     true,
     opendyslexic_14_bolditalicGroups,
-    10,
+    5,
+    nullptr,
+    nullptr,
+    nullptr,
+    0,
+    opendyslexic_14_bolditalicLigatures,
+    5,
+    0x4000000001ull,
+    opendyslexic_14_bolditalicGlyphLookup,
+    opendyslexic_14_bolditalicGlyphGroups,
+    false,
+    nullptr,
 };
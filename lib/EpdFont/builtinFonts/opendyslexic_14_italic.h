@@ -3,2259 +3,2238 @@
  * name: opendyslexic_14_italic
  * size: 14
  * mode: 2-bit  compressed: true
- * Command used: fontconvert.py opendyslexic_14_italic 14 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Italic.otf --2bit --compress
+ * Command used: fontconvert.py opendyslexic_14_italic 14 ../builtinFonts/source/OpenDyslexic/OpenDyslexic-Italic.otf --2bit --compress --no-kerning --frequency-corpus ../../../test/hyphenation_eval/resources/english_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/french_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/german_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/italian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/russian_hyphenation_tests.txt --frequency-corpus ../../../test/hyphenation_eval/resources/spanish_hyphenation_tests.txt
  */
 #pragma once
 #include "EpdFontData.h"
 
-static const uint8_t opendyslexic_14_italicBitmaps[35951] = {
-    0x85, 0x5A, 0x3D, 0xAC, 0xDC, 0x56, 0x76, 0xBE, 0x1C, 0xAE, 0x1E, 0x01, 0x13, 0x58, 0x6E, 0x91,
-    0x0D, 0x0C, 0x0B, 0x31, 0xDB, 0x60, 0xB3, 0x36, 0xB7, 0xD8, 0xC2, 0x0B, 0xC8, 0x8F, 0xF4, 0xAA,
-    0x70, 0xB1, 0x40, 0xAC, 0x05, 0xFC, 0x5C, 0xD8, 0x4D, 0xCA, 0x20, 0x29, 0x5E, 0x0A, 0x17, 0x0E,
-    0x60, 0x8B, 0x84, 0x5D, 0xA4, 0x48, 0x11, 0x01, 0x1B, 0x55, 0x69, 0xD4, 0x2C, 0x60, 0xBF, 0x2D,
-    0xBC, 0x85, 0x0A, 0x07, 0x90, 0x44, 0xDA, 0x06, 0x92, 0x22, 0x85, 0xE9, 0xB8, 0x70, 0x61, 0x20,
-    0x66, 0x22, 0x3B, 0x3F, 0xDA, 0x42, 0xF4, 0x86, 0x0B, 0x8F, 0x24, 0x0E, 0x6F, 0xBE, 0xEF, 0x3B,
-    0x77, 0x66, 0xDE, 0x93, 0xE5, 0xCD, 0x40, 0x8F, 0xD4, 0xF0, 0xE7, 0xDE, 0x73, 0xCF, 0xCF, 0x77,
-    0xBE, 0x73, 0xEE, 0x38, 0x17, 0x5D, 0x71, 0xEE, 0x59, 0xE7, 0xD2, 0xCE, 0xB9, 0xD9, 0xB9, 0xAC,
-    0x72, 0xAB, 0xD1, 0xB9, 0xD2, 0xB9, 0x78, 0x70, 0xEE, 0x26, 0x2E, 0x74, 0x2E, 0xC2, 0xF5, 0xA2,
-    0x71, 0xF1, 0xE4, 0x5C, 0x8D, 0x07, 0x71, 0x7B, 0x71, 0x2E, 0xEF, 0xDD, 0x0A, 0xD7, 0xCB, 0xC6,
-    0x25, 0xB8, 0x7E, 0xEC, 0xB6, 0x9F, 0xB2, 0x73, 0xE9, 0xDA, 0x39, 0xDF, 0xB8, 0x62, 0x72, 0xB1,
-    0xAF, 0x5C, 0x8B, 0xE7, 0xDB, 0xDE, 0xBF, 0xEF, 0x7F, 0xEA, 0xE3, 0x4D, 0x3A, 0x67, 0xEB, 0x7C,
-    0x2C, 0xFA, 0xB2, 0xAB, 0x3B, 0x5F, 0xF9, 0xD5, 0x12, 0x6F, 0x92, 0x39, 0xBC, 0x99, 0x74, 0x9C,
-    0x19, 0x13, 0x8F, 0x6E, 0xAD, 0x0B, 0x93, 0x7B, 0x5D, 0xE7, 0x1B, 0x14, 0x87, 0x43, 0xBB, 0xAC,
-    0xE1, 0x39, 0xAF, 0x28, 0x2C, 0x45, 0x8B, 0xF9, 0x82, 0xD7, 0x67, 0x76, 0xAD, 0xCE, 0x1B, 0xF7,
-    0xC4, 0xC9, 0x72, 0xD2, 0x9E, 0xBC, 0x83, 0x3B, 0xB7, 0x5C, 0x51, 0x85, 0x17, 0xF5, 0x42, 0xDE,
-    0xA5, 0x83, 0x5E, 0xEC, 0xF5, 0xA2, 0x4B, 0xC6, 0x48, 0x93, 0xC7, 0x6B, 0xB7, 0xE1, 0x65, 0x1B,
-    0xA9, 0x49, 0xED, 0xDC, 0xAD, 0x4E, 0xDA, 0x3B, 0xEF, 0xDE, 0x39, 0xB9, 0xC2, 0x17, 0x13, 0xBD,
-    0x90, 0x8D, 0xB1, 0x44, 0x4B, 0xEC, 0x05, 0x6A, 0xA0, 0x95, 0x68, 0x9E, 0x8A, 0xC0, 0xE7, 0xFB,
-    0xD5, 0xB9, 0x2A, 0x2C, 0x27, 0x7E, 0xB3, 0xE7, 0xE9, 0xBD, 0x0B, 0x3C, 0xA6, 0x17, 0x29, 0x40,
-    0xE4, 0xFD, 0x5A, 0x47, 0xDF, 0x49, 0x6C, 0x7C, 0x29, 0xFD, 0xBB, 0x07, 0x95, 0x4B, 0xFD, 0xFB,
-    0x5A, 0xC9, 0x85, 0x27, 0x71, 0x2C, 0xFE, 0x99, 0x6F, 0xC6, 0xEB, 0xEB, 0x7C, 0xB3, 0xFC, 0x88,
-    0x6F, 0xC6, 0x7E, 0x7A, 0x8D, 0xF2, 0x43, 0x38, 0x9C, 0xB0, 0xD0, 0xDE, 0x4E, 0xF8, 0x16, 0x7F,
-    0xEA, 0x3D, 0xBE, 0x5C, 0x28, 0x38, 0x5A, 0xF2, 0xD6, 0xE7, 0x1C, 0xFA, 0xFA, 0x05, 0x4F, 0x53,
-    0x5E, 0xBC, 0xEB, 0xBB, 0xF4, 0xEA, 0xEF, 0x5A, 0x3F, 0xC5, 0x5C, 0xCF, 0x62, 0x9A, 0x6A, 0x4A,
-    0x1E, 0x7B, 0x2D, 0x72, 0x70, 0x07, 0x38, 0x52, 0xE2, 0xC4, 0xA4, 0xD5, 0x9C, 0x2E, 0x8B, 0x3B,
-    0xF7, 0x88, 0xCF, 0xAB, 0x3C, 0x44, 0x83, 0xC3, 0x12, 0xF1, 0x00, 0xEC, 0x9A, 0xB9, 0xB8, 0x7F,
-    0xD5, 0x5D, 0x70, 0xA9, 0x7B, 0x06, 0xC6, 0xFA, 0xAE, 0x7B, 0x66, 0xD5, 0xBB, 0x3F, 0x72, 0xCF,
-    0xA4, 0x8D, 0xFB, 0xA1, 0xFB, 0x35, 0x96, 0xF2, 0x54, 0x34, 0xBE, 0x4E, 0xA9, 0xB9, 0xB8, 0xD4,
-    0x73, 0xD0, 0xE8, 0xEF, 0xB3, 0x45, 0x16, 0xF9, 0x15, 0x67, 0xB8, 0x11, 0xE1, 0xB8, 0x9A, 0xA2,
-    0x9E, 0x5E, 0xC5, 0xFF, 0xE7, 0x23, 0x1F, 0x7A, 0x63, 0x4C, 0xB0, 0xB0, 0xF5, 0xD2, 0xD2, 0x09,
-    0x5B, 0xAE, 0xA4, 0xCB, 0x07, 0x17, 0x9C, 0xE0, 0xEC, 0xE7, 0x3C, 0x85, 0x8F, 0xB8, 0x10, 0x97,
-    0xDC, 0x5B, 0x4D, 0x72, 0x57, 0xE8, 0x21, 0x6F, 0x22, 0x1C, 0x8B, 0x8A, 0x2E, 0x5B, 0x34, 0x7C,
-    0x39, 0xEB, 0x5B, 0x8C, 0x99, 0x3C, 0xA0, 0xD9, 0x56, 0x7C, 0xDC, 0x25, 0x5A, 0x77, 0x21, 0x8D,
-    0xFA, 0xCF, 0x07, 0x2A, 0x19, 0x8F, 0xBF, 0x0D, 0x77, 0x9C, 0xA3, 0x39, 0x9B, 0x5C, 0x9D, 0xAC,
-    0x8B, 0xD1, 0xE5, 0x9F, 0x8F, 0x38, 0xA6, 0xBE, 0x2B, 0x47, 0x7A, 0x73, 0xB1, 0x71, 0xC7, 0x0B,
-    0xED, 0x00, 0xA5, 0xD3, 0x5D, 0xFE, 0xAE, 0x5A, 0xC1, 0x8C, 0xE7, 0x30, 0xCE, 0xB2, 0xB5, 0xBB,
-    0xAB, 0x3F, 0xF6, 0x17, 0x97, 0x6C, 0x5D, 0x0C, 0x70, 0xF1, 0x78, 0xB3, 0x13, 0x95, 0xBE, 0x4B,
-    0xBF, 0x4D, 0xB0, 0xDA, 0x64, 0x90, 0x9B, 0x2B, 0xD4, 0x22, 0xC8, 0x28, 0x87, 0xBF, 0x81, 0xBF,
-    0x37, 0x9C, 0xAD, 0x33, 0xAF, 0xB4, 0x14, 0x3D, 0x2C, 0x5F, 0xDD, 0x3E, 0x50, 0x86, 0x91, 0x78,
-    0x43, 0xE1, 0x42, 0x07, 0x3E, 0x3C, 0x75, 0x51, 0xC3, 0x71, 0x98, 0xC2, 0xD9, 0x7C, 0xD4, 0x0A,
-    0x03, 0x59, 0x63, 0xEA, 0x09, 0x8E, 0x55, 0x3B, 0x9B, 0x40, 0x83, 0x53, 0xC8, 0xA2, 0x31, 0x31,
-    0x0F, 0xC3, 0x93, 0x69, 0x77, 0x6A, 0xE6, 0xED, 0x78, 0x8F, 0x14, 0xE9, 0x70, 0x7B, 0xB3, 0xB1,
-    0x07, 0xD2, 0xDE, 0xC0, 0xE3, 0x1B, 0x0B, 0x9C, 0xC3, 0xDF, 0x8D, 0x53, 0x7F, 0x37, 0x1F, 0xFA,
-    0xBB, 0x71, 0xEA, 0x39, 0xFC, 0x45, 0xE1, 0x6F, 0x85, 0xF7, 0x69, 0x4C, 0xDA, 0x0D, 0xD3, 0x3C,
-    0xE5, 0xA2, 0x6A, 0xFC, 0x6E, 0xFE, 0xD6, 0x07, 0x53, 0xFD, 0x6F, 0x37, 0xE5, 0x04, 0x40, 0xA5,
-    0x15, 0x62, 0xFF, 0xD6, 0x5F, 0xFB, 0xEC, 0xE3, 0xFE, 0xBD, 0xC7, 0x53, 0x57, 0x39, 0xBA, 0xB2,
-    0xC2, 0x9D, 0xEF, 0x42, 0xA6, 0x9C, 0xD1, 0x18, 0xFE, 0x5B, 0x25, 0x30, 0x5E, 0xC1, 0x08, 0x04,
-    0xE0, 0x11, 0x66, 0x28, 0x28, 0x17, 0x00, 0x24, 0x74, 0xD7, 0xCC, 0x5E, 0x73, 0xE4, 0xAB, 0x72,
-    0x8C, 0x67, 0x57, 0x37, 0xD9, 0xB8, 0x5A, 0x5C, 0x4D, 0x97, 0x45, 0xF0, 0x7C, 0x0D, 0x90, 0x41,
-    0xEC, 0x75, 0xC9, 0xB0, 0xE4, 0xB7, 0x37, 0x75, 0x6F, 0x7A, 0x8B, 0xCC, 0xFE, 0x21, 0x72, 0x62,
-    0xBB, 0x1A, 0x8D, 0x2E, 0x20, 0x59, 0x00, 0x32, 0x7D, 0x9E, 0xB5, 0xD3, 0xD3, 0x76, 0xCA, 0xF7,
-    0xEE, 0x21, 0x10, 0xB4, 0xF7, 0x25, 0xB8, 0x59, 0xF8, 0xDB, 0xDE, 0x0F, 0xF1, 0x90, 0xDB, 0xC4,
-    0x86, 0x70, 0x2E, 0x7D, 0xE4, 0xFB, 0x86, 0xA7, 0x2E, 0x20, 0xED, 0x1B, 0xBF, 0xEF, 0x7D, 0x13,
-    0xDC, 0xF0, 0x71, 0x7B, 0x8A, 0xCE, 0xBE, 0x7F, 0xF9, 0xCC, 0xFB, 0xC5, 0xA3, 0xDE, 0x4F, 0xC2,
-    0xFB, 0x26, 0x78, 0x34, 0x9F, 0x79, 0x3F, 0x2C, 0xE3, 0xC7, 0x76, 0xFA, 0xDE, 0x2E, 0x42, 0x72,
-    0x22, 0xD8, 0x17, 0x6F, 0x50, 0xC0, 0x0B, 0x74, 0xB3, 0xEB, 0x70, 0xAD, 0xD5, 0x80, 0x35, 0xA4,
-    0x4D, 0xD6, 0x34, 0x87, 0xEE, 0x66, 0xD6, 0xAC, 0xE3, 0xF1, 0x30, 0xEE, 0xF3, 0x37, 0xA7, 0xC2,
-    0xDD, 0x4C, 0xBB, 0x39, 0x1E, 0x9F, 0x4C, 0x06, 0xCC, 0x5C, 0x56, 0x35, 0x26, 0xC1, 0x34, 0xD9,
-    0x80, 0xE4, 0x83, 0x30, 0xBD, 0x77, 0x0C, 0xB3, 0x11, 0x66, 0x99, 0x10, 0x62, 0xE2, 0x43, 0x8C,
-    0xFF, 0xC0, 0x45, 0x4C, 0xCB, 0x15, 0x91, 0x3B, 0xC6, 0xED, 0xCB, 0x6B, 0xF7, 0x58, 0xBE, 0x4B,
-    0x79, 0xC9, 0x2E, 0xE5, 0xB9, 0x7D, 0xCA, 0x2B, 0x6D, 0x35, 0xCB, 0x36, 0x15, 0xC2, 0x6B, 0x6E,
-    0x63, 0x54, 0x8C, 0xFE, 0x2F, 0x06, 0xE7, 0x86, 0x40, 0x4A, 0x1F, 0xBD, 0xCB, 0xAF, 0xE4, 0xA3,
-    0x7B, 0xDC, 0x14, 0x27, 0xED, 0xC7, 0xBB, 0x43, 0x46, 0x9B, 0x14, 0x54, 0x13, 0xA1, 0x68, 0x45,
-    0xD4, 0xCE, 0xA9, 0x91, 0x56, 0xE8, 0x88, 0x4B, 0xB5, 0x24, 0x9C, 0xF8, 0xAD, 0xD3, 0x70, 0x9A,
-    0x6C, 0xA6, 0xCF, 0xAD, 0xB9, 0x1A, 0xDC, 0x89, 0xDE, 0xBD, 0x47, 0xA0, 0xC2, 0xFD, 0xC7, 0x2A,
-    0xD3, 0xF1, 0xB8, 0xF3, 0x8F, 0xDD, 0x94, 0xF4, 0xA1, 0xA3, 0x16, 0x20, 0xAD, 0x94, 0xE0, 0xBF,
-    0xA0, 0x05, 0x96, 0x9D, 0xC5, 0xF6, 0x07, 0x62, 0x40, 0xB4, 0x71, 0x07, 0x57, 0xA1, 0xAC, 0x8C,
-    0xC3, 0x17, 0x5C, 0x41, 0xC9, 0x84, 0x70, 0xE0, 0xAF, 0xED, 0xCC, 0xF2, 0x9A, 0x85, 0x30, 0xA7,
-    0xC3, 0xDA, 0x5C, 0x3D, 0xBA, 0xE8, 0xFE, 0xE0, 0x92, 0xDB, 0x58, 0xEC, 0xDF, 0xF4, 0xAE, 0x4E,
-    0x3B, 0xC0, 0x25, 0xF2, 0x63, 0xDE, 0xE4, 0x5D, 0xD1, 0xD4, 0x77, 0x5A, 0x06, 0xC7, 0xCC, 0x3F,
-    0xA6, 0x45, 0xCD, 0xBC, 0xC2, 0xC2, 0x10, 0x47, 0xFA, 0x4B, 0xB7, 0xE9, 0x3E, 0xE7, 0x2A, 0xF0,
-    0x98, 0xC5, 0x4A, 0xC6, 0x4B, 0x4C, 0xF7, 0x2B, 0x6A, 0x89, 0x41, 0x69, 0xDF, 0x7E, 0x47, 0x20,
-    0xA4, 0xE9, 0x4A, 0xAA, 0xF8, 0x12, 0x52, 0x7A, 0xF0, 0x23, 0xA9, 0x34, 0xA7, 0x36, 0x17, 0xB8,
-    0x10, 0x04, 0xDB, 0xBC, 0x82, 0x90, 0x0C, 0x3A, 0xA3, 0xDD, 0xD7, 0x2E, 0x6A, 0xEF, 0x6B, 0xA6,
-    0x03, 0x3F, 0xD2, 0x42, 0x9D, 0x2B, 0xBE, 0x3C, 0x72, 0x4A, 0xE0, 0xF4, 0x59, 0xC1, 0x92, 0xBC,
-    0x96, 0x13, 0xC5, 0xBF, 0x85, 0x8F, 0x40, 0xA4, 0xD1, 0xB5, 0x53, 0x3E, 0xC4, 0x0B, 0xEE, 0xC0,
-    0x5E, 0x25, 0x75, 0x34, 0xC3, 0xFD, 0xE3, 0x11, 0x8E, 0x8D, 0x15, 0x36, 0x98, 0xBB, 0xAE, 0x8A,
-    0x81, 0xA9, 0x14, 0xB6, 0xF2, 0x4C, 0x0A, 0xCB, 0xDE, 0xAF, 0x78, 0xF9, 0x53, 0xDE, 0x72, 0xE7,
-    0xD6, 0x16, 0x8B, 0xA5, 0x01, 0x30, 0x05, 0x5D, 0x4C, 0x87, 0x20, 0x0A, 0x8C, 0x87, 0x8C, 0xB4,
-    0xA8, 0x92, 0x4A, 0x30, 0x1C, 0x35, 0x95, 0xE1, 0x15, 0xA0, 0x49, 0x8C, 0xFF, 0xE6, 0x78, 0xC5,
-    0x2B, 0xA0, 0x1E, 0x63, 0x5E, 0x69, 0xFF, 0x61, 0xA0, 0x65, 0x27, 0x5A, 0xF6, 0x06, 0x91, 0xE2,
-    0x06, 0x35, 0xB4, 0x46, 0xE8, 0x62, 0xEC, 0xAC, 0xC1, 0xA8, 0x59, 0x7F, 0xDC, 0xC1, 0xD4, 0xD4,
-    0x37, 0xDD, 0xA4, 0x78, 0x80, 0xC9, 0x80, 0x5E, 0x0D, 0x56, 0x2B, 0xEE, 0x82, 0xD5, 0xF4, 0x4C,
-    0xA3, 0xD0, 0x41, 0x07, 0xE6, 0x56, 0x37, 0xF9, 0x74, 0xE0, 0xCD, 0xC5, 0x14, 0x1D, 0xEE, 0x58,
-    0xAA, 0xFA, 0x13, 0x4A, 0x4D, 0x6D, 0x6F, 0x18, 0x4B, 0x1D, 0x46, 0xBF, 0x81, 0xA0, 0x80, 0x81,
-    0x8A, 0xA6, 0x20, 0x9D, 0x5A, 0x63, 0x31, 0x80, 0x96, 0xAC, 0x87, 0xDE, 0x5A, 0xAC, 0x24, 0x15,
-    0xEB, 0x1A, 0x78, 0xA8, 0x5C, 0x7D, 0x6F, 0xDE, 0x22, 0x8F, 0xF4, 0x3B, 0xD3, 0x2E, 0x3D, 0xD9,
-    0x0E, 0xC6, 0x84, 0xA6, 0x64, 0xC1, 0xD6, 0x5F, 0x51, 0x28, 0xC0, 0xEF, 0xCA, 0x1E, 0xB9, 0xD6,
-    0x77, 0xE7, 0x5E, 0xFC, 0x66, 0x5A, 0x6F, 0xA1, 0x9E, 0x08, 0x9C, 0x6A, 0x4C, 0x16, 0x17, 0x78,
-    0x16, 0x14, 0x85, 0xD0, 0x86, 0x8E, 0x8A, 0xC9, 0x3D, 0xF2, 0xE3, 0x3B, 0xE0, 0x35, 0x94, 0x87,
-    0x07, 0x41, 0xCF, 0xA0, 0x5E, 0xA8, 0xB5, 0x3E, 0xCB, 0x63, 0xDE, 0xD3, 0xD8, 0x8A, 0x40, 0x0E,
-    0xD2, 0xAE, 0xCF, 0x1E, 0x98, 0x06, 0x4B, 0x1E, 0x68, 0x02, 0x52, 0x83, 0x2B, 0x62, 0x59, 0xF7,
-    0xC4, 0x33, 0xF8, 0xE5, 0x40, 0x01, 0xEF, 0x8E, 0x65, 0x9A, 0x54, 0xA9, 0x3D, 0x42, 0x9C, 0x44,
-    0x2F, 0xC2, 0x13, 0xE6, 0x54, 0x1E, 0x7F, 0xE6, 0x53, 0x3D, 0x01, 0xAF, 0xC3, 0xB2, 0xFB, 0x23,
-    0x7E, 0xFB, 0xCE, 0x1E, 0xCA, 0x6D, 0x0D, 0x12, 0x42, 0xF6, 0x3A, 0x73, 0x5C, 0x85, 0xA3, 0x48,
-    0xCA, 0x26, 0xCC, 0x17, 0x81, 0xC5, 0x49, 0x8A, 0x48, 0x02, 0x15, 0x8C, 0xEA, 0x58, 0x9C, 0xE3,
-    0xC7, 0xA7, 0x26, 0xA4, 0x2E, 0x53, 0x88, 0x01, 0x4F, 0x18, 0xA3, 0xE5, 0xB9, 0xB6, 0xCB, 0x44,
-    0xD2, 0x61, 0xB0, 0x90, 0xE5, 0xE9, 0xEF, 0x42, 0x63, 0xA6, 0x7B, 0x01, 0xC8, 0x12, 0x40, 0x89,
-    0xB4, 0x3E, 0x16, 0x00, 0x01, 0x0E, 0xB9, 0xC0, 0x96, 0xAC, 0x69, 0x12, 0xB7, 0x85, 0x43, 0x0E,
-    0x16, 0xC5, 0xA4, 0xF7, 0xF2, 0xD9, 0x53, 0xB0, 0xBD, 0x45, 0x7D, 0xB1, 0x88, 0x3E, 0xDC, 0x6E,
-    0xBB, 0x87, 0x89, 0x9A, 0x22, 0xA4, 0x66, 0xB4, 0x00, 0x13, 0x2A, 0x42, 0x2D, 0x93, 0xFA, 0xB3,
-    0x16, 0xC9, 0x48, 0x9B, 0x0A, 0xE8, 0x5F, 0xE3, 0x54, 0xFF, 0x08, 0xF4, 0x31, 0x1E, 0xFF, 0xF1,
-    0x06, 0x78, 0x65, 0x34, 0xFD, 0x15, 0x96, 0xD0, 0xB9, 0xF9, 0x47, 0x71, 0x03, 0x80, 0xBB, 0xF5,
-    0xC7, 0x11, 0xD3, 0x42, 0xF9, 0xA7, 0xAA, 0x0D, 0xB2, 0x4F, 0x7E, 0x33, 0x23, 0x57, 0x24, 0x53,
-    0xEB, 0x01, 0xDB, 0xD1, 0x92, 0xDE, 0xFE, 0x0C, 0x32, 0xC0, 0xE6, 0x8C, 0xF1, 0xDC, 0x72, 0x56,
-    0x1C, 0x22, 0xB3, 0x5D, 0x7E, 0xFE, 0x97, 0x95, 0x51, 0xFC, 0xDE, 0xE2, 0x74, 0x12, 0x07, 0xF4,
-    0x1B, 0x93, 0xEE, 0x7F, 0xCE, 0x8A, 0x2B, 0xB7, 0x4B, 0x35, 0x44, 0x29, 0x00, 0x97, 0xC9, 0x73,
-    0x91, 0xFD, 0x59, 0x1A, 0xFD, 0x84, 0xEF, 0xD7, 0x99, 0xC8, 0x50, 0x59, 0x51, 0xA1, 0xB7, 0xA8,
-    0x5A, 0xAE, 0x29, 0xEB, 0xA9, 0xCC, 0x96, 0x6A, 0x85, 0x8A, 0x6B, 0x86, 0x3C, 0x74, 0x0E, 0x43,
-    0xA0, 0x52, 0x62, 0x18, 0xF6, 0x6E, 0x57, 0x66, 0x2C, 0x8C, 0x0A, 0xBF, 0x16, 0x3F, 0x1F, 0x45,
-    0x72, 0x3B, 0xAA, 0xDB, 0x73, 0xEA, 0x78, 0xA6, 0xFB, 0x02, 0x0A, 0xA2, 0xA3, 0xA3, 0x8A, 0xAA,
-    0xC3, 0x52, 0x52, 0x81, 0xCB, 0x46, 0x23, 0x75, 0x08, 0x7D, 0xDA, 0x72, 0x4D, 0x63, 0xE6, 0x15,
-    0xF4, 0x87, 0x7F, 0x25, 0x11, 0x3D, 0x15, 0xA9, 0xE7, 0x1C, 0x5A, 0x70, 0xC5, 0xD9, 0x37, 0x7C,
-    0x0A, 0xF5, 0x8B, 0x8A, 0x38, 0xE5, 0x34, 0x9A, 0xDF, 0x13, 0x50, 0xF3, 0x01, 0x22, 0xC1, 0xF6,
-    0x33, 0x0D, 0x4F, 0x6E, 0xBB, 0x5E, 0x89, 0xE0, 0x52, 0xB4, 0x3E, 0x91, 0xAA, 0x14, 0xE5, 0x67,
-    0xCC, 0x79, 0x65, 0x5B, 0xCE, 0x08, 0x73, 0x31, 0xE5, 0xD5, 0x97, 0xB1, 0xF2, 0xC5, 0x98, 0xD3,
-    0xFE, 0x68, 0x3A, 0xB4, 0x1A, 0x4F, 0x8E, 0x11, 0x52, 0x91, 0xBC, 0x0A, 0xA2, 0xC8, 0x3A, 0x85,
-    0x48, 0x83, 0x9C, 0x0D, 0x4E, 0xAD, 0x87, 0x0C, 0xFD, 0xEA, 0x99, 0x8E, 0x96, 0xFB, 0x7B, 0x2F,
-    0xC9, 0xA7, 0xE9, 0x3C, 0x5E, 0x6B, 0x2B, 0x54, 0x43, 0x51, 0x6D, 0xA3, 0x34, 0xB3, 0xA6, 0xE3,
-    0xFA, 0xFF, 0xDE, 0xC9, 0x07, 0x54, 0x36, 0x01, 0x69, 0x7E, 0xCB, 0x45, 0xA5, 0x5E, 0x01, 0x02,
-    0xD6, 0x6B, 0x63, 0x8B, 0x72, 0x13, 0x80, 0x84, 0x25, 0xA7, 0x5A, 0x32, 0x31, 0x12, 0x4A, 0x22,
-    0x7F, 0x50, 0x55, 0x3C, 0x2B, 0x5A, 0xBC, 0xCA, 0xBC, 0xBA, 0x63, 0x91, 0x57, 0x50, 0x5B, 0x10,
-    0x96, 0xEA, 0xCB, 0x66, 0x86, 0x57, 0xBE, 0xB8, 0xE5, 0xE8, 0xA5, 0xA0, 0x30, 0x5F, 0xA9, 0x3A,
-    0x68, 0x54, 0x4C, 0x36, 0x32, 0x6C, 0x15, 0xA9, 0x2E, 0x85, 0x1C, 0x14, 0xCA, 0x02, 0xF5, 0x92,
-    0x8C, 0xD4, 0xF1, 0x95, 0x8D, 0x16, 0x35, 0xA8, 0x8E, 0xC6, 0xEC, 0xD5, 0x8E, 0x29, 0x59, 0x82,
-    0x37, 0x62, 0x2E, 0x37, 0x4D, 0x7E, 0xF7, 0xD2, 0x35, 0x67, 0xF9, 0xCD, 0x49, 0x19, 0xB1, 0xDC,
-    0x38, 0xEF, 0x77, 0x2E, 0x6B, 0x84, 0x4B, 0x69, 0xD1, 0x2A, 0x53, 0xAB, 0x57, 0x73, 0x29, 0xAD,
-    0x0D, 0x64, 0x08, 0xEF, 0x58, 0x1C, 0xB4, 0xF2, 0x26, 0x90, 0x85, 0x97, 0x4F, 0x1A, 0x4A, 0x12,
-    0x32, 0x60, 0x36, 0x6E, 0x47, 0x32, 0xE2, 0xB6, 0xEC, 0xE4, 0xD2, 0xC0, 0xA9, 0xA5, 0x3D, 0x26,
-    0x58, 0x5B, 0xD6, 0xC9, 0x2F, 0x9D, 0x95, 0xBF, 0x12, 0x24, 0x1D, 0xB7, 0xA6, 0x36, 0x4B, 0xB7,
-    0x55, 0x80, 0x0D, 0x1B, 0x57, 0x0E, 0x61, 0x65, 0x91, 0x77, 0xDF, 0x04, 0x8A, 0x27, 0x3C, 0x40,
-    0x2D, 0xF2, 0x61, 0x8A, 0x13, 0xA6, 0xA7, 0xDE, 0x45, 0x6A, 0x24, 0x04, 0xCE, 0xC4, 0xC4, 0xE6,
-    0x02, 0x89, 0x0A, 0x03, 0x2B, 0x83, 0xEE, 0x1C, 0x68, 0xE7, 0x65, 0x57, 0x35, 0x79, 0xE9, 0x87,
-    0x12, 0x41, 0xE7, 0x67, 0x4E, 0x7F, 0xDE, 0xEB, 0xF6, 0xBD, 0x8A, 0x63, 0xDC, 0x54, 0x6C, 0x97,
-    0x55, 0xE6, 0x7F, 0xF9, 0x92, 0xEF, 0x2C, 0x06, 0xA5, 0x93, 0xB5, 0xF4, 0xB3, 0x38, 0xD3, 0x18,
-    0xB1, 0x97, 0x76, 0x8B, 0xDE, 0x86, 0x04, 0xD7, 0xB4, 0x3E, 0xB8, 0x09, 0x17, 0xBC, 0x30, 0xD8,
-    0x68, 0xB7, 0xED, 0xB5, 0x4E, 0x8B, 0x5A, 0xA4, 0xF6, 0xC4, 0x2C, 0x13, 0xAE, 0x79, 0x17, 0x12,
-    0x13, 0xA9, 0x0A, 0xFD, 0x1D, 0xE2, 0x7B, 0x29, 0x22, 0x59, 0x8E, 0x8E, 0x8E, 0x47, 0x79, 0xB4,
-    0x78, 0x0B, 0x27, 0x96, 0x2C, 0x93, 0xD5, 0x99, 0x76, 0xCD, 0x2B, 0x30, 0x90, 0xFE, 0x48, 0x0D,
-    0xC0, 0x12, 0xA0, 0xB6, 0x95, 0xD2, 0x1D, 0xE3, 0x4C, 0xCC, 0x01, 0xA2, 0xF7, 0x46, 0x44, 0x30,
-    0xB9, 0xCD, 0x95, 0x4A, 0xB2, 0x8C, 0xF4, 0xC0, 0x29, 0xF5, 0x53, 0x6A, 0x18, 0xB2, 0x0D, 0x62,
-    0x42, 0x49, 0xC0, 0x85, 0x78, 0x97, 0x5C, 0x27, 0xFE, 0x43, 0xB9, 0x0B, 0xB5, 0xD4, 0x83, 0x3B,
-    0xB6, 0x88, 0x3F, 0xD9, 0xC5, 0xA9, 0xC2, 0x54, 0x46, 0x54, 0x3C, 0xAF, 0xF6, 0x46, 0x94, 0x15,
-    0xF6, 0xB7, 0x4F, 0x5B, 0x7F, 0x77, 0x9B, 0xE8, 0x46, 0x89, 0xB6, 0x16, 0x7A, 0xD8, 0x39, 0x94,
-    0xEE, 0x26, 0x4B, 0xF6, 0x67, 0x6E, 0x13, 0x05, 0x2B, 0x66, 0xA3, 0x92, 0xC1, 0x9E, 0x1B, 0x41,
-    0x5E, 0xAB, 0x29, 0xC2, 0xF9, 0xAF, 0x9C, 0xF2, 0x1E, 0xD8, 0x72, 0xA4, 0xD3, 0xC2, 0xBA, 0xA8,
-    0x04, 0x48, 0xDE, 0x2B, 0xE8, 0x79, 0x35, 0x53, 0xEF, 0xD9, 0xC0, 0x81, 0xCA, 0x8B, 0xAC, 0x26,
-    0x67, 0x4E, 0x99, 0xDD, 0xE6, 0x02, 0x6A, 0x16, 0x70, 0x2B, 0xA5, 0xA5, 0x4C, 0x18, 0x57, 0x7B,
-    0x79, 0x9A, 0x18, 0xBB, 0x8E, 0xB5, 0xD7, 0x13, 0xE2, 0xE4, 0xFF, 0xCB, 0x63, 0xFD, 0xB7, 0xD0,
-    0x72, 0xBC, 0xC9, 0x38, 0xCB, 0x58, 0x78, 0x6A, 0xA7, 0x5C, 0x68, 0x4A, 0x30, 0x08, 0xF2, 0x16,
-    0x90, 0xA2, 0x46, 0xDC, 0xDB, 0xBD, 0x13, 0x62, 0x46, 0x4B, 0xA2, 0xC7, 0x28, 0xAA, 0xDA, 0xED,
-    0x72, 0x37, 0xE1, 0x76, 0xBC, 0xBD, 0xAD, 0x88, 0xF7, 0xE1, 0x76, 0xB4, 0x09, 0xA9, 0x59, 0x31,
-    0x5C, 0x57, 0x21, 0xB4, 0x94, 0x8E, 0xEF, 0xFF, 0xCA, 0x7F, 0x40, 0x47, 0x25, 0xE2, 0x5C, 0xA4,
-    0xDF, 0x86, 0x50, 0x46, 0x1C, 0xBB, 0x1F, 0x5C, 0x53, 0xB8, 0x10, 0x42, 0xF3, 0xC5, 0x30, 0x99,
-    0xC2, 0xB4, 0x6C, 0xC7, 0x8D, 0x80, 0x51, 0x5C, 0x16, 0xF0, 0xD0, 0xBD, 0xB1, 0x2E, 0x86, 0xD8,
-    0x8C, 0x4B, 0x08, 0xFE, 0xCF, 0x27, 0xE7, 0xA1, 0xF2, 0x5B, 0xF5, 0x90, 0xDE, 0x87, 0x5F, 0xAC,
-    0x7D, 0x53, 0x7F, 0x34, 0xBA, 0xFC, 0x13, 0x1F, 0x6F, 0xA0, 0xBB, 0x36, 0x9B, 0x8B, 0xFF, 0xC0,
-    0x3A, 0xE7, 0xF2, 0x2B, 0x4F, 0x47, 0x1C, 0xDA, 0xCF, 0x27, 0x7A, 0xE2, 0x9B, 0x1E, 0xB2, 0x60,
-    0xF9, 0x09, 0x42, 0x0C, 0x03, 0x8D, 0x50, 0x23, 0x9D, 0x11, 0xC4, 0x07, 0xDE, 0x08, 0xAF, 0xF5,
-    0x53, 0x06, 0xBD, 0x4C, 0xC8, 0xC4, 0xF2, 0xD1, 0x74, 0x5E, 0x31, 0xD8, 0xE0, 0x2E, 0x99, 0xB7,
-    0x24, 0x01, 0x40, 0xA6, 0x79, 0x57, 0x7E, 0x5B, 0x4A, 0xBF, 0x2D, 0x87, 0xA3, 0x56, 0xBC, 0x25,
-    0x73, 0x9C, 0x04, 0xD9, 0x3D, 0xFD, 0x2B, 0x86, 0xA8, 0xD0, 0x4F, 0x82, 0x13, 0x5C, 0x2E, 0x25,
-    0xB3, 0xEC, 0x64, 0x2A, 0xBC, 0x93, 0xFF, 0x66, 0xA2, 0xD3, 0x14, 0x9F, 0xAE, 0xA9, 0xA7, 0xF2,
-    0xC3, 0x35, 0xBD, 0xB0, 0xFE, 0x70, 0xA6, 0xAF, 0xB6, 0x6F, 0xCD, 0x1A, 0xF2, 0xA7, 0x9B, 0x84,
-    0xD0, 0x05, 0xBE, 0x30, 0x11, 0x51, 0x3C, 0x87, 0x84, 0x94, 0xF0, 0x4F, 0xB0, 0x2D, 0x4F, 0xAC,
-    0x80, 0x01, 0xB1, 0xDE, 0x8C, 0x25, 0x64, 0x47, 0x22, 0x51, 0x42, 0x9D, 0xE5, 0x24, 0x95, 0x95,
-    0x8C, 0x54, 0xD5, 0x6C, 0x85, 0xB5, 0x76, 0x8E, 0x45, 0x30, 0x52, 0x63, 0x86, 0xB5, 0x6F, 0x45,
-    0xC1, 0x7B, 0xC6, 0x21, 0xB9, 0x2B, 0xC2, 0x94, 0xA8, 0x84, 0x41, 0xCB, 0x41, 0x30, 0xC5, 0x40,
-    0xC2, 0x4C, 0x7E, 0x4B, 0x82, 0xD5, 0x8C, 0x34, 0x8A, 0x26, 0xDF, 0x08, 0x9D, 0xC6, 0xA2, 0x93,
-    0xAD, 0xE1, 0xCF, 0x72, 0x49, 0x73, 0x17, 0xAF, 0xE8, 0x82, 0x9F, 0x31, 0xDE, 0x73, 0xD6, 0x6C,
-    0x97, 0xFE, 0x30, 0x60, 0xB9, 0x1F, 0x95, 0x4F, 0x42, 0x4E, 0x14, 0x85, 0x33, 0x3A, 0x5A, 0x5B,
-    0xE2, 0x3E, 0x10, 0x8B, 0xDD, 0x73, 0x65, 0xD1, 0x47, 0x3D, 0x91, 0xDF, 0xE1, 0x51, 0x8C, 0x02,
-    0xF4, 0x21, 0x1D, 0xE8, 0x90, 0x28, 0x73, 0x16, 0xD2, 0xFD, 0x58, 0xD7, 0x72, 0x01, 0x5B, 0xEB,
-    0xCE, 0x5B, 0xF2, 0x50, 0x92, 0x58, 0x42, 0xFB, 0x31, 0xF6, 0x27, 0x55, 0x08, 0x6D, 0x0B, 0x56,
-    0x43, 0xF6, 0x7C, 0xDC, 0x41, 0xBB, 0xE5, 0x73, 0x83, 0x66, 0xBB, 0xE0, 0xF7, 0xEC, 0xA0, 0xDD,
-    0x92, 0x8A, 0x03, 0xB3, 0x7D, 0x61, 0xCD, 0xC8, 0x7A, 0x31, 0x42, 0xDE, 0x0B, 0xEA, 0xDB, 0xC6,
-    0x8A, 0xA5, 0x46, 0x11, 0x41, 0x05, 0x02, 0xC2, 0x14, 0xC0, 0xC3, 0x36, 0x3C, 0xA4, 0x9E, 0xC5,
-    0x05, 0x9D, 0x29, 0x5E, 0xB2, 0x5E, 0xDA, 0x85, 0x36, 0x5B, 0x83, 0x1C, 0x55, 0xDE, 0x1B, 0x03,
-    0xA8, 0x76, 0x17, 0x72, 0x70, 0xDC, 0x06, 0x63, 0x95, 0xC3, 0xCA, 0x43, 0x98, 0xCC, 0x9F, 0x84,
-    0xCC, 0x23, 0x62, 0xD1, 0xDA, 0x29, 0xB3, 0x53, 0xE8, 0xD8, 0xAA, 0x65, 0x6A, 0xAC, 0xD7, 0x5B,
-    0x97, 0xC3, 0x38, 0x24, 0x84, 0xEF, 0x8C, 0x7A, 0x28, 0xE5, 0xFE, 0xC5, 0x3B, 0x46, 0x37, 0x1B,
-    0x66, 0xB3, 0x85, 0xDD, 0x1E, 0x48, 0xC7, 0x4A, 0xAA, 0x02, 0x73, 0x45, 0x61, 0x85, 0xE2, 0xB0,
-    0x20, 0x77, 0x83, 0x80, 0xB9, 0x80, 0x78, 0x8C, 0x8C, 0x0E, 0x4C, 0x64, 0x3A, 0x8C, 0x57, 0x0E,
-    0xAB, 0xB2, 0xDC, 0xF9, 0xAB, 0xD0, 0x5C, 0xC1, 0x05, 0xC5, 0x6C, 0x71, 0x70, 0xF1, 0x0B, 0x0B,
-    0x69, 0x3A, 0x52, 0xB3, 0x5A, 0xA8, 0x5D, 0x2E, 0x80, 0x1E, 0x07, 0xFF, 0x6C, 0x07, 0xA8, 0x18,
-    0x51, 0x8F, 0xF5, 0x18, 0x69, 0x8B, 0x8E, 0x2E, 0x6D, 0xEB, 0x6D, 0xFA, 0xC3, 0xE8, 0xAC, 0xA3,
-    0x80, 0x5A, 0xA7, 0x42, 0x4D, 0x52, 0x58, 0x67, 0x7B, 0xD8, 0x33, 0x8E, 0xD5, 0xFA, 0x14, 0x43,
-    0x2B, 0xE5, 0x38, 0x89, 0x57, 0xAD, 0xD1, 0x0A, 0x27, 0x13, 0x23, 0xCF, 0x07, 0xD6, 0x8D, 0xB6,
-    0x72, 0xC5, 0x15, 0x46, 0x99, 0xBD, 0x99, 0x78, 0x64, 0x8B, 0x05, 0x73, 0xB4, 0x77, 0xDE, 0x0D,
-    0x9D, 0xF9, 0xCD, 0x99, 0x63, 0xA1, 0xFC, 0x86, 0xC4, 0xBA, 0x6F, 0x9B, 0x9A, 0x1B, 0xD7, 0x3C,
-    0x7E, 0xA0, 0x2C, 0xF8, 0xD8, 0xD5, 0x74, 0x8C, 0x2E, 0x05, 0x6A, 0x11, 0x08, 0x90, 0x31, 0xA2,
-    0x6E, 0x97, 0x20, 0x8C, 0x33, 0xD9, 0x05, 0x1F, 0x3A, 0xF3, 0x3B, 0x42, 0xE9, 0xF7, 0x74, 0xC0,
-    0x3C, 0x54, 0xF2, 0x7E, 0x8B, 0x87, 0xE6, 0x0F, 0x7B, 0xA8, 0x7C, 0xB6, 0x46, 0xFD, 0x5A, 0x51,
-    0xD5, 0xD4, 0x12, 0x60, 0xCB, 0x72, 0x30, 0xC2, 0x19, 0xD5, 0x29, 0x93, 0x60, 0x41, 0xA0, 0xE3,
-    0x08, 0x21, 0xCA, 0xBD, 0x72, 0xA3, 0xB9, 0x2B, 0xA1, 0x07, 0x10, 0x53, 0x88, 0x00, 0x50, 0x0C,
-    0x5A, 0x4E, 0x4E, 0x4C, 0xA9, 0x15, 0x52, 0xB2, 0xA7, 0x35, 0x02, 0xBC, 0x72, 0x67, 0x46, 0x90,
-    0xC6, 0xE0, 0x5F, 0xBE, 0xC2, 0x5E, 0x92, 0x62, 0x38, 0xB2, 0x80, 0xCE, 0x14, 0x7A, 0x54, 0xDF,
-    0x5A, 0x8C, 0x64, 0x1F, 0xCF, 0x3F, 0xA0, 0x0A, 0xDF, 0xB1, 0xC2, 0x8C, 0xC7, 0x74, 0xB2, 0xE0,
-    0x28, 0xC5, 0x65, 0x79, 0x6C, 0x1B, 0x93, 0xB8, 0x10, 0xCD, 0x27, 0x68, 0xAE, 0x89, 0x45, 0xB9,
-    0x6A, 0x64, 0x00, 0x93, 0xAD, 0x22, 0x1F, 0xB9, 0xD6, 0x7C, 0xE4, 0x22, 0xF3, 0x91, 0x7D, 0x9A,
-    0x7C, 0x64, 0x15, 0x95, 0x4F, 0xA4, 0x49, 0xD9, 0xD4, 0xF6, 0xC1, 0xA1, 0x79, 0x94, 0xC1, 0x2C,
-    0x69, 0x0A, 0xBD, 0xE4, 0x04, 0x59, 0xC8, 0x9A, 0xBB, 0x7C, 0x8E, 0xA9, 0x8D, 0x80, 0x62, 0xE1,
-    0x4B, 0xD8, 0x1E, 0x32, 0xCA, 0x9F, 0x0F, 0x66, 0x92, 0x6C, 0x4C, 0xC2, 0x8E, 0x8A, 0xF1, 0x05,
-    0xB5, 0x5B, 0xA1, 0x19, 0x7C, 0x83, 0x9C, 0x40, 0x61, 0x4F, 0x1D, 0xD2, 0xAB, 0x1B, 0x60, 0x38,
-    0xAA, 0x73, 0xEA, 0xAD, 0x2A, 0x7D, 0x53, 0x10, 0xFD, 0x0B, 0x3F, 0x4A, 0x69, 0xF9, 0x83, 0x19,
-    0x4B, 0x42, 0x4A, 0x5E, 0x8B, 0xDF, 0xF9, 0x17, 0xE6, 0xF2, 0x5F, 0xD9, 0x33, 0xFA, 0x6C, 0x93,
-    0xDD, 0xA3, 0x62, 0x1F, 0x2C, 0xF1, 0xE2, 0xD9, 0x10, 0x03, 0x91, 0x37, 0xF2, 0x5C, 0x15, 0x44,
-    0x9C, 0x92, 0x55, 0x98, 0x22, 0xBC, 0x53, 0xED, 0x4D, 0xB2, 0xC9, 0x9A, 0x23, 0x62, 0x8A, 0x11,
-    0x3B, 0x18, 0xB7, 0xDE, 0xA0, 0xEE, 0xF4, 0x65, 0xCB, 0xD7, 0xB5, 0xDB, 0x6E, 0x86, 0xD1, 0x86,
-    0xCC, 0xCC, 0xEC, 0xA9, 0x54, 0x82, 0xA2, 0x5A, 0x71, 0x62, 0x84, 0x29, 0x1F, 0x74, 0x42, 0x21,
-    0xA7, 0x35, 0xB7, 0xC6, 0x75, 0xF3, 0x2D, 0x4E, 0x18, 0xF3, 0x0D, 0x04, 0xB8, 0xB6, 0xB6, 0x46,
-    0x6D, 0x6A, 0xAA, 0x43, 0xFD, 0x73, 0x57, 0xCA, 0xA9, 0x6F, 0x4B, 0x86, 0x7A, 0x50, 0xB3, 0xB9,
-    0x1E, 0x2D, 0x6B, 0x8E, 0x22, 0xC5, 0xE4, 0x6A, 0xA3, 0x4E, 0xBC, 0x5A, 0x4E, 0xA2, 0x80, 0xE5,
-    0xE4, 0xEC, 0x2A, 0xC1, 0xF2, 0x05, 0xFE, 0xE7, 0x4D, 0x3A, 0x6B, 0x07, 0xE1, 0x8A, 0x0E, 0x1A,
-    0xCB, 0x7B, 0x03, 0x92, 0xB6, 0x52, 0x9F, 0x04, 0x87, 0x64, 0x26, 0x5D, 0xF2, 0x3F, 0x23, 0x2C,
-    0xFC, 0xD7, 0x1C, 0xBA, 0x40, 0x91, 0x90, 0xAD, 0x36, 0x33, 0x4B, 0xE4, 0x6A, 0x1B, 0x45, 0x25,
-    0x25, 0x11, 0x74, 0x48, 0x98, 0x74, 0xD9, 0xDE, 0xB6, 0xCA, 0xCD, 0x88, 0xD3, 0x7A, 0xD7, 0xE9,
-    0xA3, 0xC3, 0x08, 0x55, 0x1B, 0xAB, 0xE0, 0x7A, 0xAB, 0xC7, 0x0C, 0x3F, 0xCB, 0xF5, 0xE9, 0x53,
-    0x7D, 0xE6, 0xD4, 0x9A, 0x5A, 0x0C, 0x63, 0x22, 0x7B, 0x21, 0x9C, 0x8C, 0xA3, 0x89, 0x0E, 0xEC,
-    0x4F, 0x89, 0x9D, 0x52, 0xCB, 0x27, 0xD9, 0xF6, 0x74, 0x5A, 0xF1, 0xB9, 0xED, 0x7C, 0x65, 0xB6,
-    0x6B, 0x18, 0x1B, 0xBB, 0x8E, 0x6C, 0xCB, 0xCF, 0x36, 0x11, 0xC7, 0x80, 0xE7, 0x55, 0x18, 0x21,
-    0xE1, 0x15, 0x43, 0xC5, 0xCD, 0xB6, 0x71, 0x6A, 0x75, 0x99, 0x1A, 0x2B, 0xD6, 0xEC, 0xDD, 0xDF,
-    0x2E, 0x77, 0x35, 0xD8, 0xFE, 0xB6, 0x55, 0x52, 0x37, 0xCF, 0xDE, 0xD6, 0x6E, 0xE4, 0xA9, 0xDB,
-    0xB7, 0x1E, 0x2A, 0xB4, 0x86, 0x5D, 0x45, 0xF7, 0xD0, 0x6D, 0xB5, 0x2D, 0x93, 0xF1, 0xEC, 0xED,
-    0x53, 0x52, 0xE9, 0xB6, 0x15, 0xC5, 0x2A, 0x5F, 0x69, 0xBC, 0xEF, 0x1F, 0x09, 0x6A, 0xBF, 0x13,
-    0x47, 0xFD, 0xF5, 0xA7, 0xD2, 0x37, 0x87, 0x1B, 0x45, 0xFA, 0xFE, 0xF8, 0x7A, 0xFE, 0xFC, 0xC7,
-    0xD3, 0xE5, 0xFC, 0xAD, 0x71, 0x2E, 0xB3, 0x0F, 0xC7, 0xF9, 0x30, 0x8B, 0x41, 0xB5, 0x37, 0xEA,
-    0x97, 0x6C, 0xA9, 0xB0, 0xCD, 0xB8, 0x1F, 0x57, 0x6B, 0x92, 0x68, 0x7B, 0x01, 0xB4, 0x78, 0x5B,
-    0xC3, 0x5E, 0xD2, 0x7A, 0xDF, 0x6D, 0xDE, 0x2D, 0xE9, 0xA1, 0x11, 0xE2, 0x47, 0x8D, 0xB0, 0x79,
-    0xC4, 0x08, 0x9A, 0x7E, 0x3F, 0xC2, 0xA9, 0xE9, 0xCF, 0xD4, 0xAA, 0x64, 0xB2, 0xC1, 0x6B, 0x05,
-    0x4E, 0x47, 0x47, 0xEE, 0xBA, 0xA6, 0x2F, 0x50, 0x4C, 0xA5, 0x4D, 0xE6, 0x5E, 0x7F, 0xCC, 0x45,
-    0x61, 0xA3, 0x85, 0x86, 0xFE, 0x50, 0xAE, 0x70, 0x82, 0xCF, 0xB5, 0x43, 0xA3, 0x0A, 0x08, 0x85,
-    0x73, 0x01, 0x57, 0x57, 0x6A, 0xEC, 0x6E, 0x46, 0x95, 0xDA, 0x65, 0x5F, 0x0C, 0x78, 0x60, 0x83,
-    0x8C, 0x9D, 0x75, 0x48, 0xDC, 0x73, 0xCC, 0x7E, 0xEA, 0xEB, 0x2E, 0x5A, 0x67, 0x08, 0xB7, 0x06,
-    0xF9, 0x7C, 0xCA, 0x40, 0xFA, 0x9D, 0x7F, 0x19, 0x90, 0xE4, 0x85, 0x33, 0x1E, 0x79, 0x78, 0xB9,
-    0x8C, 0xD0, 0x78, 0xBE, 0x37, 0x72, 0xBF, 0xE5, 0xFE, 0xE9, 0xB6, 0xEF, 0x46, 0x45, 0x68, 0xCD,
-    0xAA, 0x11, 0xA8, 0x81, 0xF2, 0x67, 0x20, 0xD8, 0x0F, 0xB0, 0x80, 0x7A, 0x79, 0x65, 0x4C, 0x3D,
-    0x98, 0x18, 0x7C, 0x92, 0x95, 0x6B, 0xD6, 0xE1, 0x85, 0x19, 0xCF, 0x65, 0x88, 0xE4, 0x15, 0x11,
-    0xBE, 0x26, 0xA7, 0xE9, 0xCB, 0x2F, 0x8F, 0xD5, 0x3D, 0x62, 0x38, 0x75, 0x2B, 0xFA, 0x75, 0xAA,
-    0x7D, 0x82, 0x4B, 0x3B, 0x62, 0xD5, 0x70, 0x73, 0xA2, 0xB8, 0xF7, 0xE7, 0xC4, 0x57, 0x4E, 0x78,
-    0xCB, 0x94, 0x06, 0x8E, 0x47, 0x77, 0xA4, 0xEA, 0x78, 0x55, 0x65, 0xEA, 0x97, 0xD7, 0xF0, 0x6C,
-    0xAF, 0x52, 0xA7, 0xDD, 0x6F, 0x5C, 0x5A, 0xCB, 0xD2, 0x36, 0xA6, 0xCA, 0xFD, 0x76, 0xD2, 0x37,
-    0x2F, 0x70, 0x63, 0x6D, 0x2A, 0xC4, 0x80, 0x58, 0x90, 0xFA, 0x07, 0x3D, 0xD6, 0x8C, 0x45, 0xB8,
-    0x43, 0x82, 0x04, 0x9B, 0x53, 0x3D, 0x39, 0x8F, 0xE7, 0xF3, 0x2C, 0x50, 0x7B, 0x31, 0x38, 0x65,
-    0xBF, 0x99, 0x69, 0x93, 0xE8, 0x39, 0x2A, 0x2E, 0x1B, 0x12, 0x04, 0x6B, 0xFA, 0xAB, 0xBF, 0x73,
-    0x17, 0x73, 0x15, 0xEB, 0xC3, 0xBD, 0x48, 0xAC, 0x4D, 0x89, 0x91, 0x28, 0x22, 0xB8, 0x6B, 0xF3,
-    0x6A, 0x84, 0xBC, 0xD9, 0x1D, 0xBA, 0x97, 0x67, 0x75, 0x55, 0x48, 0xD4, 0xF2, 0xAB, 0xB6, 0xAD,
-    0x23, 0x09, 0xAD, 0xE9, 0x3F, 0xB9, 0xC7, 0xA3, 0xD0, 0x9A, 0x99, 0xAC, 0x1B, 0x7D, 0xBC, 0xA5,
-    0x1F, 0xE9, 0x22, 0xEC, 0xBF, 0xAC, 0x7D, 0x38, 0xEE, 0xDA, 0x3D, 0xAD, 0x4E, 0x36, 0x3B, 0xEA,
-    0xD0, 0xE9, 0xB9, 0xE5, 0x45, 0x6D, 0xFE, 0x68, 0x4F, 0x59, 0xDA, 0x2B, 0x77, 0xBF, 0x83, 0x80,
-    0xF2, 0xF4, 0xFB, 0x08, 0x2B, 0x54, 0xEA, 0xCA, 0xAC, 0x0B, 0x50, 0x7D, 0x82, 0x12, 0xBE, 0xD0,
-    0x91, 0x71, 0x31, 0x39, 0xB0, 0x4C, 0xA1, 0x1A, 0x0A, 0x11, 0x78, 0xE6, 0xFB, 0x84, 0xBC, 0x7A,
-    0x35, 0x90, 0x9B, 0x4C, 0xF4, 0x3B, 0x69, 0x29, 0xBB, 0x83, 0xC8, 0x5B, 0x09, 0x2F, 0x69, 0x51,
-    0x58, 0xF3, 0x01, 0x97, 0xFA, 0x8B, 0x71, 0xBB, 0x0A, 0xE6, 0xB7, 0xFE, 0xBC, 0xF1, 0xEF, 0xB0,
-    0x2B, 0x92, 0x2B, 0xBE, 0x8F, 0x4F, 0x31, 0xFC, 0xD7, 0x77, 0x7B, 0x4E, 0xCD, 0xFF, 0xF7, 0xED,
-    0x78, 0xA2, 0xC3, 0x85, 0x0D, 0xA0, 0xFA, 0x0B, 0x94, 0x21, 0x1B, 0xF8, 0x06, 0x0C, 0xF3, 0x2C,
-    0xC2, 0x2F, 0x9A, 0xD8, 0xC8, 0xE8, 0xB8, 0xC3, 0xC6, 0x60, 0x5C, 0xF3, 0x5B, 0x8F, 0x15, 0xA3,
-    0xAC, 0x66, 0x08, 0xCC, 0x58, 0x2C, 0x04, 0x2F, 0x1B, 0x90, 0x9D, 0x8D, 0x76, 0x54, 0x94, 0x53,
-    0x38, 0xC2, 0x78, 0xBA, 0xDC, 0xB8, 0x44, 0x5D, 0x66, 0x22, 0xBE, 0x3A, 0x5F, 0xA0, 0x65, 0x30,
-    0xFD, 0xB3, 0x3A, 0x73, 0x70, 0x38, 0xBF, 0x86, 0x0D, 0x3B, 0x85, 0x3A, 0x89, 0xA9, 0x33, 0x73,
-    0x8A, 0xA0, 0x65, 0xDF, 0xD2, 0xF6, 0xE7, 0x66, 0xE8, 0x7E, 0x2B, 0xE7, 0x70, 0xFB, 0x2D, 0x7D,
-    0xF4, 0x37, 0xF7, 0x7B, 0xBE, 0xED, 0x46, 0x61, 0xA4, 0x1C, 0xB4, 0xA2, 0xC9, 0xD5, 0x36, 0xAF,
-    0x6C, 0x3F, 0x7C, 0x48, 0x0D, 0xEB, 0xD1, 0x1C, 0x9E, 0xCF, 0xF3, 0x8F, 0xE1, 0xC4, 0x4D, 0xF0,
-    0x12, 0x2A, 0xBA, 0x8C, 0xA5, 0xDC, 0x00, 0xE8, 0xCC, 0x1B, 0x75, 0xF4, 0x59, 0xB6, 0xB2, 0x0D,
-    0x9D, 0xE0, 0x9C, 0xDE, 0xC5, 0x82, 0x3F, 0x83, 0xB6, 0x3F, 0x04, 0xBF, 0xF9, 0x80, 0x3B, 0x34,
-    0xBE, 0x87, 0x32, 0xC7, 0xD6, 0x95, 0x58, 0xF2, 0x15, 0x0E, 0x59, 0xD2, 0xCF, 0xD2, 0x87, 0xCF,
-    0xDD, 0xE9, 0xEF, 0x33, 0x01, 0xB0, 0x24, 0xD6, 0xC2, 0xF7, 0x31, 0x11, 0x1B, 0xC8, 0x43, 0xCE,
-    0x74, 0x05, 0xCC, 0x3A, 0x0F, 0x83, 0x7E, 0xED, 0x27, 0x16, 0xAB, 0x70, 0xA3, 0x92, 0xBB, 0x33,
-    0xBC, 0x37, 0x23, 0xFA, 0x50, 0x22, 0xE4, 0xA4, 0x2A, 0x2D, 0xC6, 0xA3, 0xDD, 0xAA, 0x78, 0x88,
-    0xD5, 0x48, 0x5E, 0xAF, 0x34, 0xE4, 0x4D, 0xE0, 0x9B, 0x7A, 0xC8, 0x35, 0x0D, 0x92, 0xB3, 0xDD,
-    0xB9, 0xC1, 0x75, 0x92, 0x1B, 0x00, 0x45, 0x3A, 0xAA, 0x91, 0xAD, 0x2D, 0x25, 0xE7, 0xA3, 0x39,
-    0xF0, 0x59, 0x62, 0x4D, 0xF4, 0x9F, 0x98, 0xA6, 0x54, 0xBF, 0xF3, 0x39, 0x12, 0xB8, 0x94, 0x2D,
-    0xD4, 0x1B, 0x6E, 0xB6, 0x2D, 0xA7, 0x19, 0x93, 0x60, 0xB0, 0x6A, 0xB5, 0x4E, 0x38, 0x29, 0x3C,
-    0x7F, 0xA4, 0x9F, 0xAC, 0x58, 0x8C, 0xB1, 0x94, 0x81, 0x1F, 0xE5, 0x7D, 0xDB, 0xC4, 0x6A, 0xB5,
-    0x89, 0xE3, 0x62, 0xC2, 0x3B, 0xBE, 0x42, 0x09, 0xB7, 0x8E, 0xE9, 0x20, 0x6F, 0x60, 0xA9, 0x6C,
-    0x77, 0xBF, 0x0F, 0xE5, 0xCF, 0xD0, 0x72, 0x71, 0x71, 0xB4, 0xAE, 0x3B, 0x68, 0xDD, 0x51, 0xDB,
-    0x15, 0x44, 0x09, 0xE2, 0x45, 0x42, 0xD0, 0x4F, 0x15, 0xD3, 0xDF, 0x3B, 0x40, 0x85, 0xBB, 0xFA,
-    0x4A, 0xAD, 0xE9, 0xBB, 0xF7, 0x67, 0xB1, 0x0B, 0x12, 0x9C, 0x86, 0x51, 0x0D, 0x3D, 0x36, 0x8C,
-    0xD8, 0x43, 0x45, 0xF0, 0xA4, 0x6E, 0x5D, 0xA7, 0x66, 0x1D, 0xE9, 0xD8, 0x8A, 0x1C, 0xBC, 0xC7,
-    0xED, 0xC2, 0xF6, 0x30, 0x05, 0xAA, 0x5F, 0x73, 0xE8, 0xF2, 0x79, 0xAF, 0x68, 0xBF, 0xB4, 0xA5,
-    0xB7, 0xF5, 0xA9, 0x16, 0xEB, 0xA9, 0x1A, 0xE4, 0x9B, 0xAE, 0xFA, 0x44, 0xF5, 0x22, 0xA4, 0xFB,
-    0x0A, 0xE1, 0xFF, 0xE0, 0xFE, 0x84, 0x49, 0xEB, 0x11, 0x0A, 0x2E, 0x99, 0x51, 0xCA, 0x9E, 0xB6,
-    0xED, 0x10, 0x0D, 0x75, 0x93, 0x6B, 0xD7, 0x80, 0xA3, 0x1C, 0xD2, 0x92, 0x25, 0x0B, 0x8F, 0xF2,
-    0x4A, 0xAD, 0x2D, 0x4D, 0xF5, 0x24, 0xC9, 0x46, 0xEF, 0xB3, 0x5E, 0xF8, 0xC5, 0xB0, 0xFD, 0x91,
-    0x41, 0xFA, 0x4F, 0x7D, 0x20, 0x38, 0x72, 0x80, 0x82, 0x28, 0xF0, 0x93, 0x33, 0x01, 0x72, 0xBE,
-    0x8F, 0x1E, 0x78, 0xF1, 0xF4, 0xF2, 0xDE, 0x9F, 0xA1, 0x0A, 0x10, 0x42, 0x85, 0x5D, 0xC8, 0xED,
-    0x7F, 0x37, 0x16, 0x6E, 0x65, 0xA7, 0x1E, 0xAB, 0xFA, 0x89, 0xB6, 0xC0, 0xFB, 0x6C, 0x5E, 0x77,
-    0xD1, 0xE6, 0xE7, 0x95, 0x82, 0x85, 0xE0, 0x91, 0x37, 0x61, 0xEB, 0xA9, 0x5E, 0x42, 0xF5, 0xC7,
-    0x41, 0xA1, 0xCF, 0xE4, 0x4A, 0x3E, 0xB2, 0x76, 0xE5, 0x4E, 0x98, 0x9A, 0x0B, 0xE7, 0xB5, 0xF7,
-    0x8C, 0xCF, 0x0F, 0x45, 0x9D, 0x81, 0x9D, 0xB0, 0x62, 0xC2, 0xCD, 0x53, 0xEE, 0x0F, 0x53, 0x7B,
-    0xE1, 0xD2, 0xA8, 0xEC, 0xB7, 0x91, 0x42, 0xB9, 0x4D, 0xC1, 0xC4, 0xA1, 0xDF, 0x73, 0x80, 0xA8,
-    0x97, 0xBE, 0x67, 0x75, 0x81, 0xC0, 0x4B, 0x7B, 0x25, 0x5E, 0x7A, 0x04, 0x83, 0x01, 0x03, 0x15,
-    0xD5, 0x4D, 0x6E, 0xCD, 0x02, 0x64, 0x1D, 0x1D, 0x18, 0x4A, 0xDC, 0x20, 0x48, 0x50, 0x17, 0x74,
-    0xEC, 0x32, 0x41, 0xF0, 0x22, 0x6C, 0x66, 0x54, 0xB9, 0xFF, 0x1A, 0x44, 0x79, 0x5D, 0xEF, 0x7E,
-    0x01, 0x11, 0xDF, 0xC6, 0x02, 0x67, 0x18, 0xBC, 0x80, 0x77, 0x26, 0x3D, 0x66, 0x5D, 0x43, 0x21,
-    0xFC, 0xA5, 0x18, 0x62, 0x8C, 0xA3, 0xA0, 0x80, 0x82, 0xA2, 0x29, 0xDD, 0x6F, 0xC9, 0xA6, 0x6F,
-    0x39, 0xB5, 0xCE, 0x54, 0x1E, 0xE8, 0xA7, 0x43, 0x04, 0x08, 0x0E, 0x97, 0xFE, 0xBB, 0x5A, 0x09,
-    0x64, 0x23, 0xF1, 0x9A, 0x5E, 0x90, 0x77, 0xB5, 0xFB, 0x03, 0xB7, 0x44, 0xF3, 0x6A, 0xE2, 0x26,
-    0x4B, 0x31, 0x96, 0x4D, 0xFE, 0x81, 0xFF, 0x18, 0x71, 0x51, 0xF8, 0x8F, 0x86, 0x68, 0xF1, 0xBE,
-    0x75, 0x49, 0xE8, 0xEF, 0xDE, 0xC5, 0x90, 0xF5, 0x5C, 0x12, 0x28, 0x3A, 0xF6, 0x70, 0x36, 0xDC,
-    0x7E, 0x2B, 0x7A, 0xF5, 0x57, 0x21, 0x57, 0x41, 0x37, 0x45, 0x60, 0x46, 0x9B, 0x58, 0x1D, 0x4C,
-    0x91, 0x32, 0x15, 0x1A, 0x22, 0xB6, 0xDA, 0x46, 0x5C, 0xA9, 0x62, 0xA8, 0xC7, 0x2D, 0x63, 0x4D,
-    0xBF, 0x66, 0x87, 0x73, 0xC3, 0x12, 0xD8, 0x3F, 0xC7, 0x14, 0xD1, 0x5B, 0x5D, 0x89, 0x00, 0x9B,
-    0xAD, 0x0C, 0x6D, 0xA8, 0xF3, 0xD9, 0x34, 0x4A, 0x97, 0xBF, 0xC5, 0x33, 0xE4, 0x67, 0x94, 0x10,
-    0x4E, 0x62, 0xC6, 0x29, 0x26, 0x66, 0x3C, 0xCE, 0x85, 0x3A, 0xA5, 0xEA, 0xB4, 0xB6, 0x3B, 0x62,
-    0x5D, 0xCF, 0xBB, 0x6A, 0xC0, 0xB6, 0xC7, 0x8C, 0x16, 0x77, 0x5B, 0x9C, 0x4E, 0xBC, 0x0B, 0xEA,
-    0x52, 0xCF, 0xD6, 0x5A, 0x22, 0xFC, 0x79, 0x83, 0x4B, 0xBF, 0x08, 0xFB, 0x33, 0xB6, 0x4B, 0x19,
-    0x0E, 0x21, 0x9E, 0x08, 0xF6, 0xEA, 0x2A, 0x2B, 0x7D, 0xB0, 0xC1, 0xAF, 0x81, 0x55, 0x9A, 0xB3,
-    0x4C, 0xB2, 0x44, 0xB0, 0x9C, 0x5C, 0x63, 0x40, 0x4C, 0xBB, 0xDF, 0x45, 0x6C, 0x0B, 0x10, 0x48,
-    0x15, 0x59, 0xEF, 0x5D, 0xF0, 0x9C, 0x0E, 0x46, 0x6D, 0x08, 0xCF, 0xDA, 0xD7, 0xA9, 0x64, 0x30,
-    0xFA, 0xBA, 0xEA, 0xA3, 0x4A, 0x1D, 0x26, 0xD1, 0x48, 0xA1, 0xF9, 0xF6, 0x95, 0xCE, 0x82, 0xB9,
-    0xB0, 0x46, 0x93, 0xD5, 0x50, 0xDE, 0x1A, 0x1C, 0x07, 0x14, 0x27, 0xEA, 0x91, 0xC0, 0xE2, 0xCE,
-    0xBD, 0xE6, 0xD2, 0xCA, 0x8D, 0xEE, 0x49, 0xB7, 0x0A, 0x17, 0xDE, 0xE3, 0xAF, 0x18, 0x76, 0x17,
-    0x92, 0x06, 0xDC, 0x53, 0x17, 0x9E, 0xE6, 0xCD, 0x70, 0x81, 0x7A, 0xEC, 0x6D, 0xA3, 0x37, 0x0D,
-    0xBF, 0x69, 0x8A, 0xA7, 0x53, 0x93, 0xF7, 0xA7, 0x04, 0xE8, 0xAC, 0x91, 0x91, 0xCF, 0xD6, 0x40,
-    0x66, 0x2D, 0x7E, 0xCB, 0x18, 0xF6, 0x6A, 0xFD, 0x90, 0xCC, 0x7D, 0x28, 0x4C, 0x2B, 0x57, 0x2E,
-    0x56, 0x3B, 0xE9, 0x37, 0x26, 0x53, 0xB2, 0xBA, 0xBB, 0xEA, 0x86, 0x7E, 0xB8, 0xFE, 0xF4, 0x78,
-    0xC1, 0x4A, 0x85, 0xFF, 0x03, 0xDD, 0x5B, 0x3D, 0xAC, 0xDD, 0xE6, 0x79, 0x7E, 0x49, 0xDA, 0xA2,
-    0x6B, 0xCA, 0xA6, 0x87, 0xB8, 0x48, 0x22, 0xDB, 0xCC, 0xE0, 0xC1, 0x8D, 0x6D, 0xD1, 0x83, 0x5A,
-    0xA8, 0x80, 0xEE, 0x25, 0x6B, 0x03, 0xD5, 0xD0, 0x21, 0x1A, 0xAC, 0x0C, 0xF6, 0xD0, 0x0C, 0x19,
-    0xD2, 0x06, 0x85, 0x34, 0x78, 0x30, 0xD0, 0x2B, 0x1D, 0x16, 0x1E, 0x3A, 0x14, 0x68, 0xB5, 0xB8,
-    0x4B, 0x87, 0x7A, 0x70, 0x01, 0x5B, 0x2D, 0x2A, 0x0D, 0x1E, 0x3C, 0x48, 0x97, 0xB4, 0x35, 0x64,
-    0x6B, 0x88, 0xA4, 0x45, 0x96, 0x00, 0x61, 0x0B, 0x19, 0x69, 0xDD, 0xC1, 0x4C, 0x42, 0x23, 0x94,
-    0xCD, 0x73, 0xBE, 0xBE, 0xCF, 0xF3, 0x7E, 0x3C, 0xE7, 0x5C, 0xEB, 0xCA, 0x7F, 0x70, 0xDA, 0x26,
-    0xD4, 0xBD, 0xBC, 0xE7, 0xF0, 0xE7, 0xFB, 0xDE, 0x9F, 0xE7, 0xFD, 0xFD, 0x3E, 0x89, 0xEB, 0x23,
-    0x57, 0xA5, 0x93, 0x14, 0xBD, 0xB8, 0x32, 0x9A, 0xC4, 0x8E, 0x7F, 0x96, 0x78, 0x90, 0xBC, 0x91,
-    0x5A, 0xA2, 0x51, 0xD2, 0x56, 0x16, 0x12, 0x4C, 0x92, 0x74, 0x52, 0x94, 0x32, 0x49, 0xD4, 0x4B,
-    0x56, 0xC9, 0x75, 0xFC, 0x4D, 0x1B, 0xD9, 0x95, 0x60, 0x90, 0xB8, 0x91, 0x5C, 0xE4, 0x3B, 0x7C,
-    0xB7, 0x14, 0x49, 0xF5, 0xF7, 0x94, 0x48, 0xD0, 0x89, 0x24, 0xF6, 0xF1, 0x98, 0x93, 0xD8, 0x4D,
-    0x52, 0x2F, 0xCF, 0xC4, 0x43, 0x2F, 0x45, 0x52, 0x86, 0xE3, 0x29, 0x7D, 0xBB, 0x97, 0x8B, 0x71,
-    0x15, 0x0E, 0xFA, 0xB1, 0xD5, 0xAB, 0xA7, 0x2B, 0x71, 0x3B, 0x12, 0xB9, 0x0F, 0xAA, 0xD8, 0xB9,
-    0x32, 0x71, 0x4E, 0x42, 0x37, 0x48, 0xD4, 0x88, 0x3C, 0xA9, 0xE3, 0x5E, 0x95, 0xCD, 0xF1, 0xA0,
-    0x8E, 0x2A, 0x99, 0xD3, 0xF1, 0xF5, 0xC9, 0x5E, 0xA4, 0xBE, 0x19, 0xF7, 0x20, 0x35, 0xD4, 0xB9,
-    0x2B, 0x3C, 0xB0, 0x87, 0x53, 0xD0, 0xE3, 0xAC, 0xB4, 0xE1, 0x61, 0x59, 0x5F, 0x16, 0x5E, 0x8E,
-    0x5A, 0x9C, 0x41, 0xA9, 0xDC, 0x5B, 0x5F, 0x7E, 0x4D, 0x64, 0xE1, 0x74, 0xBC, 0xD0, 0xE9, 0xAC,
-    0xFA, 0x34, 0xDF, 0xD9, 0xE7, 0xEB, 0x03, 0xCE, 0x35, 0x46, 0xCD, 0x47, 0xBC, 0xB1, 0xC2, 0x2B,
-    0x85, 0x73, 0xFF, 0x25, 0x81, 0xC3, 0xD3, 0x4A, 0xA7, 0x5B, 0x79, 0xBA, 0x94, 0xE3, 0x3D, 0xA9,
-    0xEB, 0x2B, 0xAD, 0x92, 0x35, 0x4A, 0xDE, 0xAE, 0x24, 0xEA, 0x74, 0xA2, 0x49, 0x76, 0x94, 0xAE,
-    0xA4, 0x0D, 0x46, 0x15, 0x63, 0xD6, 0xD6, 0x95, 0x4E, 0x33, 0x88, 0xBE, 0xD7, 0x14, 0xEF, 0xB9,
-    0x65, 0xD0, 0x3F, 0x98, 0x96, 0xF7, 0x88, 0x9C, 0x11, 0x79, 0x56, 0x87, 0x28, 0x55, 0xCE, 0xFA,
-    0x98, 0x8A, 0x7A, 0x5F, 0xC2, 0x49, 0xF2, 0x4A, 0xB2, 0x2E, 0x55, 0x4E, 0xDD, 0x69, 0x9D, 0x3E,
-    0x5E, 0xAE, 0x38, 0xBB, 0x92, 0x13, 0x80, 0x7D, 0x49, 0x47, 0x92, 0x47, 0x5E, 0x5C, 0x0B, 0x92,
-    0x96, 0xB8, 0xFF, 0xAF, 0xE0, 0x90, 0xDA, 0x2C, 0x40, 0x79, 0x42, 0x26, 0xDC, 0x5D, 0x78, 0x48,
-    0x5F, 0x8B, 0x8C, 0xE2, 0xA2, 0x59, 0x3F, 0xB5, 0xE0, 0x53, 0x14, 0x4C, 0xD0, 0xAA, 0xC2, 0x54,
-    0xE8, 0x2F, 0x42, 0x77, 0xBD, 0x3C, 0x22, 0x21, 0x2E, 0x6C, 0x1F, 0xBC, 0x10, 0x57, 0xF2, 0x86,
-    0xA4, 0x10, 0xE6, 0x71, 0x3C, 0xED, 0x2F, 0xE0, 0x48, 0x30, 0x76, 0x60, 0x72, 0x2C, 0x53, 0xCA,
-    0xFB, 0x4B, 0x4A, 0x39, 0xC4, 0x46, 0x45, 0xAA, 0x60, 0xF1, 0x39, 0x77, 0xB7, 0xA8, 0x3E, 0x7D,
-    0xBA, 0xB8, 0x74, 0x64, 0x92, 0xB0, 0x97, 0x60, 0x84, 0x42, 0xA2, 0x4E, 0xC5, 0xA5, 0xAF, 0xCA,
-    0xEA, 0x8C, 0x4A, 0x2E, 0x74, 0x1F, 0x5C, 0xE9, 0x28, 0x6A, 0x01, 0x8C, 0xBA, 0x35, 0xC9, 0xA9,
-    0xF1, 0xD4, 0x60, 0x8C, 0xA5, 0x57, 0x5F, 0xC4, 0x8F, 0x47, 0xDC, 0x07, 0xE5, 0x4C, 0x6B, 0xD2,
-    0x26, 0xED, 0x52, 0x96, 0x79, 0x9B, 0xDF, 0x98, 0xA2, 0xA9, 0x6E, 0x6A, 0x45, 0x6A, 0x27, 0x2F,
-    0xC6, 0xF2, 0xE7, 0xCD, 0xD7, 0x76, 0xE5, 0xE8, 0xE3, 0x12, 0xDD, 0x5F, 0xC9, 0x8D, 0xAB, 0x72,
-    0xE9, 0x27, 0xED, 0xF9, 0x47, 0xCF, 0x9C, 0x8F, 0xFE, 0xE0, 0x0D, 0xC9, 0x2F, 0xF1, 0xC5, 0x1F,
-    0x47, 0x3F, 0x6A, 0xBA, 0x27, 0x1E, 0x8A, 0xDE, 0xAE, 0x4E, 0x9E, 0x48, 0x9E, 0xF9, 0xDB, 0xA1,
-    0x70, 0xB2, 0x3A, 0x0F, 0x2D, 0xDD, 0x25, 0x89, 0x48, 0xA7, 0xA4, 0xE5, 0xAA, 0x9C, 0x68, 0x88,
-    0x06, 0xB9, 0xA8, 0xFF, 0xD2, 0x36, 0xE6, 0xB5, 0x46, 0x01, 0x53, 0x34, 0x4A, 0xDC, 0xA2, 0x49,
-    0x7B, 0xA9, 0xCB, 0xAC, 0x93, 0x6B, 0x92, 0x97, 0xD2, 0xCA, 0x13, 0x18, 0xF6, 0x01, 0x29, 0x5E,
-    0x3F, 0x03, 0x8A, 0xBF, 0xEB, 0x54, 0x5D, 0xFA, 0x02, 0x6C, 0x48, 0xF9, 0xC6, 0x23, 0x6A, 0x50,
-    0xF2, 0x20, 0xA0, 0xF5, 0x4B, 0xBD, 0x5F, 0x2B, 0x3A, 0xE4, 0x58, 0x27, 0x27, 0xA3, 0xB2, 0xE8,
-    0x9E, 0xFA, 0xBD, 0xA3, 0xF7, 0x7C, 0xE5, 0x0F, 0xC3, 0xA3, 0xB5, 0xDC, 0xF8, 0xDD, 0xE6, 0xFC,
-    0x8F, 0x9F, 0x3A, 0x91, 0x3F, 0x74, 0x32, 0xFA, 0x8B, 0x37, 0xC0, 0x0A, 0xB4, 0xEF, 0xFE, 0xE3,
-    0xF2, 0x3F, 0x18, 0xC7, 0xE7, 0xD4, 0x26, 0x15, 0x5A, 0xAB, 0xA8, 0x4F, 0xDB, 0xA8, 0xBD, 0x20,
-    0xE9, 0x4B, 0xBD, 0xEC, 0xA4, 0x4D, 0xD8, 0x2F, 0xD4, 0x66, 0x57, 0xE1, 0xA4, 0xC0, 0x6B, 0x23,
-    0x95, 0x51, 0xE4, 0xAA, 0x19, 0xB2, 0xA5, 0x37, 0x14, 0x00, 0x69, 0xC7, 0x2C, 0xE5, 0xF2, 0x95,
-    0x77, 0x2F, 0x15, 0x80, 0x68, 0xB8, 0x7D, 0x43, 0x2D, 0x5C, 0xEE, 0x2E, 0x37, 0x30, 0xF8, 0xE6,
-    0xE5, 0x09, 0x18, 0x96, 0xB3, 0x67, 0xEC, 0x7B, 0xDE, 0x85, 0xCF, 0x54, 0xF2, 0x98, 0x44, 0x80,
-    0xCD, 0x9E, 0x3E, 0x9E, 0x55, 0x91, 0x6B, 0x16, 0xCA, 0x62, 0x5D, 0xCA, 0x51, 0x91, 0x46, 0xEF,
-    0x2D, 0x61, 0xC7, 0xFA, 0xC0, 0xF9, 0xBB, 0x32, 0xBD, 0x07, 0xF2, 0xBF, 0x1D, 0x37, 0x3B, 0x51,
-    0x97, 0xAB, 0x13, 0x91, 0xB8, 0x55, 0x29, 0x84, 0xF4, 0x2A, 0xF4, 0x32, 0x05, 0x04, 0x43, 0x57,
-    0xA3, 0x2E, 0xA8, 0xA0, 0xDF, 0x69, 0x42, 0xFA, 0x21, 0xB5, 0x2B, 0x15, 0x70, 0x15, 0x2E, 0xD5,
-    0x6F, 0x85, 0x0E, 0xA0, 0x76, 0x0D, 0xEC, 0xB0, 0x8B, 0xDE, 0x53, 0xB2, 0x83, 0x9F, 0xBA, 0xE5,
-    0x24, 0xFD, 0x62, 0x5C, 0x18, 0x70, 0x09, 0xBA, 0x7B, 0x67, 0x7E, 0xCF, 0x28, 0x18, 0x17, 0xED,
-    0x8E, 0x02, 0xAB, 0x39, 0xA5, 0xC6, 0xDB, 0xEC, 0xE9, 0xEB, 0xE5, 0x9B, 0x0A, 0x47, 0x19, 0x70,
-    0xEA, 0x25, 0x57, 0x8B, 0x94, 0x7C, 0x0A, 0x3B, 0x49, 0x27, 0x35, 0x5E, 0xD5, 0x70, 0xA3, 0xA6,
-    0xA1, 0x6E, 0x24, 0xED, 0x13, 0x35, 0xC6, 0x56, 0x21, 0xAA, 0x0A, 0xD6, 0x41, 0x1A, 0x15, 0x95,
-    0x2B, 0x8F, 0x2B, 0x38, 0x55, 0x3E, 0xD1, 0x0A, 0x66, 0xB3, 0x54, 0xC6, 0x93, 0x49, 0xDE, 0x84,
-    0x5D, 0xEA, 0x70, 0x83, 0x0E, 0x57, 0xF4, 0x3A, 0x5C, 0xD2, 0xAD, 0xB2, 0x1F, 0x2E, 0x17, 0x4D,
-    0x50, 0x46, 0x72, 0x8F, 0xA8, 0x39, 0x9F, 0x90, 0x13, 0x8F, 0x77, 0xEA, 0x55, 0xBE, 0x24, 0x53,
-    0xF0, 0xA2, 0x7E, 0x3B, 0xAF, 0x88, 0x6A, 0x83, 0x26, 0x6A, 0x8A, 0x69, 0x01, 0x81, 0x67, 0x43,
-    0xF2, 0xF4, 0x5B, 0xCD, 0xD1, 0x27, 0x82, 0x1B, 0xD5, 0xC9, 0x9D, 0xE7, 0x9F, 0x76, 0xAD, 0x72,
-    0xFD, 0x80, 0x42, 0x4F, 0x4E, 0xC2, 0x92, 0xF2, 0x52, 0x8D, 0x44, 0xF1, 0xA6, 0xE2, 0x5C, 0xC2,
-    0x43, 0x28, 0x0E, 0x7B, 0x21, 0xFE, 0xD2, 0x5E, 0x85, 0x92, 0x77, 0xF1, 0xA8, 0xE2, 0x51, 0xFC,
-    0x39, 0x78, 0xF1, 0x6B, 0x30, 0xA6, 0x13, 0x72, 0x3F, 0xD0, 0xB7, 0x3E, 0x32, 0x02, 0xA0, 0xA6,
-    0x3E, 0xFF, 0x8A, 0x57, 0x60, 0xAA, 0x2F, 0xAA, 0xBD, 0xC3, 0x60, 0x55, 0x64, 0x34, 0x6A, 0x5C,
-    0x3C, 0x45, 0x09, 0xBE, 0x29, 0x30, 0x6F, 0x85, 0x44, 0x87, 0xFB, 0x2A, 0x8D, 0xC7, 0x3F, 0xA8,
-    0x32, 0x98, 0x5D, 0x75, 0x0A, 0x08, 0x2C, 0x07, 0x45, 0x38, 0xBC, 0x9D, 0xFA, 0x94, 0xA4, 0x52,
-    0x0D, 0xAA, 0xFE, 0x77, 0xF5, 0x7C, 0x4D, 0x7E, 0x51, 0x29, 0xBE, 0xA2, 0xEF, 0x95, 0xAA, 0xDE,
-    0x54, 0x3D, 0x4A, 0x5A, 0x9D, 0xD2, 0x31, 0x77, 0x05, 0x7E, 0x1B, 0xF8, 0xE9, 0x80, 0xFA, 0x5D,
-    0x49, 0xF4, 0xD9, 0x0B, 0x30, 0x02, 0x7D, 0xE3, 0x41, 0xA1, 0x61, 0x1C, 0x6B, 0x0C, 0x55, 0x38,
-    0xFF, 0x96, 0x79, 0x7F, 0x0B, 0x2A, 0xF7, 0xF3, 0x8C, 0xC8, 0xD2, 0x33, 0x3A, 0xF4, 0xF3, 0x8F,
-    0xD1, 0xB8, 0xC3, 0x0F, 0x29, 0xCF, 0x57, 0xDE, 0x95, 0xBD, 0xAF, 0x96, 0x4A, 0xE4, 0x05, 0x37,
-    0xE5, 0xAE, 0x3D, 0xF5, 0x02, 0xE6, 0xD9, 0xE1, 0xC3, 0xBB, 0x1C, 0xEE, 0x38, 0x7F, 0x72, 0xC2,
-    0x3E, 0xA7, 0xD7, 0xC1, 0x87, 0x0A, 0x1F, 0x6A, 0x10, 0x1B, 0x38, 0x3B, 0xD3, 0x4E, 0x15, 0x65,
-    0x7A, 0x5E, 0xB8, 0x4E, 0x47, 0xF9, 0xFA, 0xE5, 0x57, 0x67, 0x51, 0x9E, 0xBB, 0x89, 0xF3, 0xEF,
-    0x3F, 0x6F, 0xB6, 0xF1, 0x0A, 0xCF, 0x8F, 0x41, 0x53, 0x72, 0x1F, 0xE7, 0xC8, 0x70, 0x4E, 0x96,
-    0x38, 0x87, 0x57, 0x4A, 0xC2, 0x71, 0xC0, 0xAC, 0xFA, 0xE9, 0x11, 0xCA, 0x3D, 0x63, 0xC8, 0xC9,
-    0xE0, 0xB8, 0x01, 0x2C, 0x25, 0x34, 0x2D, 0xEF, 0x3B, 0xB2, 0x5F, 0xA6, 0x15, 0x74, 0x62, 0xE2,
-    0x4C, 0x9A, 0xF4, 0x2A, 0xCF, 0x27, 0x11, 0xD2, 0xD2, 0x87, 0xC5, 0xCB, 0x33, 0xEA, 0x52, 0x95,
-    0x81, 0x9E, 0xD5, 0x12, 0x23, 0x0D, 0xE6, 0xAE, 0x0A, 0xC9, 0x1C, 0xCE, 0x59, 0x19, 0x0E, 0x78,
-    0x07, 0x71, 0x25, 0xA2, 0x73, 0xCF, 0x71, 0x56, 0x96, 0xCC, 0x87, 0x22, 0xAC, 0xA8, 0x61, 0x6D,
-    0x1F, 0x74, 0x07, 0x70, 0xE0, 0x69, 0xEF, 0x23, 0x04, 0xBF, 0x31, 0x80, 0x2C, 0x40, 0x06, 0xDC,
-    0x30, 0xBC, 0x30, 0x03, 0x8F, 0x9B, 0x07, 0xC1, 0x33, 0x31, 0xDF, 0xC0, 0xFB, 0x18, 0x3B, 0xE9,
-    0xFC, 0x37, 0x80, 0xD4, 0x62, 0x73, 0x32, 0xC2, 0x4F, 0xAE, 0xAE, 0xA8, 0x1D, 0xC3, 0xEB, 0x1F,
-    0x59, 0xFB, 0x20, 0x00, 0x87, 0xB1, 0x96, 0x67, 0x0B, 0x43, 0x9C, 0x9F, 0x41, 0xF1, 0x90, 0x83,
-    0xF1, 0x36, 0x61, 0xE8, 0x2B, 0xF0, 0x9C, 0xFA, 0x12, 0x88, 0x90, 0x61, 0x70, 0x22, 0x67, 0x3F,
-    0x24, 0xC1, 0x29, 0x30, 0xD9, 0x83, 0x8A, 0xBC, 0xDA, 0x07, 0x61, 0xA1, 0xBE, 0x93, 0xB6, 0x98,
-    0xA1, 0x86, 0x65, 0x28, 0xC9, 0x0B, 0x84, 0x48, 0xA5, 0x58, 0x1D, 0x8B, 0x7A, 0x6E, 0x7D, 0x41,
-    0x7F, 0x10, 0xD7, 0x2B, 0x8B, 0xEB, 0xEA, 0x06, 0xDD, 0x18, 0xE1, 0x42, 0xAF, 0x9E, 0x5C, 0x05,
-    0x42, 0xFE, 0x31, 0x75, 0x34, 0x41, 0x1E, 0xD9, 0x60, 0x61, 0x86, 0xBA, 0x8F, 0xAB, 0x4D, 0xC2,
-    0x61, 0xF9, 0x85, 0x49, 0x3D, 0x78, 0x55, 0x3E, 0xE3, 0xC1, 0xA8, 0xED, 0xB1, 0x9F, 0x5A, 0xB8,
-    0x73, 0x1C, 0xFB, 0x3D, 0xC6, 0xEC, 0x5F, 0x90, 0xE9, 0x01, 0x92, 0x0D, 0x26, 0x0A, 0x79, 0x02,
-    0xAB, 0xB2, 0x0F, 0xFE, 0x94, 0xA5, 0x7D, 0xCA, 0x3E, 0x87, 0x15, 0x36, 0x60, 0x36, 0x6B, 0xA0,
-    0x13, 0xD5, 0xD4, 0x82, 0xE2, 0xCD, 0xE0, 0xD5, 0xF8, 0x43, 0x1E, 0x43, 0xF2, 0x4B, 0xAE, 0x3B,
-    0x9E, 0x27, 0xE6, 0x03, 0x8E, 0xEA, 0x2F, 0xE8, 0xA5, 0xD3, 0x3E, 0xEB, 0x91, 0x7D, 0x90, 0x38,
-    0x0B, 0xF3, 0x9C, 0x16, 0x2E, 0x0E, 0x92, 0x4F, 0x2A, 0x02, 0x79, 0x8F, 0x8E, 0x36, 0xD8, 0xD2,
-    0x2B, 0x75, 0x14, 0x5A, 0x7E, 0x44, 0x25, 0x89, 0xA3, 0x48, 0x2E, 0x5A, 0x72, 0x42, 0xF0, 0x15,
-    0xDF, 0x00, 0xED, 0xD9, 0x0D, 0x0C, 0x95, 0x36, 0x4B, 0x82, 0x47, 0x4D, 0x50, 0xB5, 0x03, 0x10,
-    0x45, 0x83, 0xAA, 0x06, 0xEA, 0xA9, 0x89, 0x2C, 0xA4, 0x66, 0x2B, 0x62, 0xAD, 0x96, 0x60, 0x49,
-    0x32, 0xF0, 0x43, 0xDA, 0x73, 0x28, 0x8B, 0xD1, 0x60, 0xC5, 0xB3, 0x6B, 0x62, 0xE8, 0xBB, 0x07,
-    0xD8, 0xA3, 0x89, 0x54, 0x38, 0x98, 0xB2, 0xFA, 0x7F, 0xCC, 0x7B, 0x2D, 0x04, 0x41, 0xBB, 0x3D,
-    0x82, 0x44, 0xFC, 0xD2, 0x69, 0xF0, 0x73, 0xF5, 0x78, 0x4F, 0x46, 0x96, 0x77, 0x52, 0xCC, 0x4A,
-    0x36, 0x8A, 0x89, 0x9C, 0x6C, 0x18, 0x32, 0xF0, 0x99, 0x66, 0x64, 0x49, 0xE1, 0x18, 0x47, 0x86,
-    0x3F, 0xAF, 0x9A, 0xAC, 0x01, 0x63, 0xC6, 0x92, 0x41, 0xD0, 0xEB, 0x46, 0x05, 0x05, 0xCE, 0x8C,
-    0x27, 0x43, 0xA1, 0x29, 0x47, 0x7D, 0x2B, 0x58, 0x33, 0xA6, 0x0C, 0x88, 0x5E, 0x3B, 0xB0, 0x10,
-    0x75, 0xF7, 0xE4, 0x4A, 0x36, 0x58, 0x8C, 0x7A, 0x1A, 0x62, 0xDE, 0x30, 0xBD, 0x73, 0x66, 0xBE,
-    0x23, 0x8D, 0xA5, 0x68, 0x8B, 0xF6, 0xE3, 0x19, 0x33, 0x9B, 0x32, 0xA3, 0xF2, 0x56, 0xE5, 0x39,
-    0x33, 0xBB, 0xF2, 0x86, 0x65, 0x96, 0x35, 0xB3, 0x46, 0xDB, 0xF2, 0xC6, 0xE5, 0xAD, 0xCB, 0xF3,
-    0x66, 0xF6, 0x65, 0x06, 0xE6, 0x2D, 0xCC, 0x33, 0x67, 0x36, 0x36, 0x27, 0xCF, 0xB4, 0xB2, 0x99,
-    0x3B, 0xB3, 0x33, 0xFA, 0x16, 0x27, 0x66, 0x69, 0x5B, 0xEC, 0x59, 0x4E, 0x22, 0xF7, 0x3D, 0x84,
-    0xF3, 0x89, 0xA3, 0x3C, 0x9F, 0x5C, 0xBB, 0x36, 0x49, 0xAA, 0x8F, 0x33, 0xAB, 0xD5, 0x06, 0x8D,
-    0xA6, 0x3C, 0xB3, 0x2A, 0xE3, 0xD0, 0xC0, 0xB8, 0x34, 0x0F, 0x86, 0xB3, 0xB1, 0x67, 0x58, 0x34,
-    0xC5, 0x99, 0x4D, 0x91, 0x37, 0x83, 0xA2, 0xA9, 0xCD, 0x4C, 0xCA, 0x18, 0x33, 0x24, 0xD6, 0x6B,
-    0x5B, 0xEA, 0x8C, 0x2B, 0x03, 0xA2, 0xA9, 0xCC, 0x0C, 0x6A, 0x8B, 0xA5, 0xB9, 0xA2, 0x51, 0xBF,
-    0x08, 0xE3, 0x23, 0x75, 0x40, 0x2F, 0xD1, 0xA5, 0x07, 0xE3, 0x4B, 0xE1, 0xBC, 0xEE, 0x92, 0xF7,
-    0x7C, 0x99, 0x16, 0xDC, 0x9A, 0x3D, 0xE8, 0x62, 0x1E, 0x28, 0x7D, 0xCB, 0x79, 0xC3, 0x1B, 0xB2,
-    0xCE, 0x3E, 0x2D, 0xC3, 0xD5, 0xD9, 0x3F, 0xA1, 0x80, 0xAA, 0xDC, 0xC6, 0x8C, 0x35, 0x67, 0xE2,
-    0x34, 0x28, 0x33, 0x1C, 0xC7, 0x28, 0xE6, 0xDA, 0x0F, 0x3E, 0x82, 0x83, 0xAA, 0x32, 0xAD, 0xB6,
-    0x90, 0xFA, 0xDD, 0xCB, 0x36, 0x4F, 0x46, 0x2D, 0xCD, 0xD4, 0x55, 0x33, 0x75, 0x4C, 0xCD, 0x0B,
-    0xE6, 0xE1, 0xCA, 0x33, 0x22, 0x45, 0x0D, 0xA5, 0x32, 0x66, 0xF2, 0x12, 0x38, 0xDD, 0x2A, 0x92,
-    0x0E, 0x1E, 0xC7, 0xDC, 0x25, 0x56, 0x0B, 0x23, 0x8B, 0x81, 0x09, 0x11, 0xE6, 0xE5, 0xE7, 0x50,
-    0x66, 0x6D, 0xB9, 0xBE, 0x69, 0x03, 0xCD, 0xD8, 0xC4, 0xC3, 0x73, 0xE0, 0xDD, 0x8A, 0xAC, 0x2B,
-    0x18, 0x2D, 0xB9, 0x36, 0xA5, 0x41, 0xC4, 0xDB, 0x81, 0x89, 0x11, 0x69, 0xE8, 0x03, 0xCA, 0xC1,
-    0xAD, 0x6F, 0x4E, 0x24, 0x74, 0x65, 0xB4, 0x97, 0xF4, 0x19, 0x0D, 0x39, 0xEA, 0x59, 0x44, 0xE8,
-    0x2C, 0x41, 0xED, 0xFE, 0x13, 0xEF, 0x3C, 0xC5, 0x81, 0xBF, 0x36, 0xCB, 0x85, 0xB0, 0x33, 0xE1,
-    0x52, 0x59, 0x57, 0xAA, 0x75, 0x65, 0xE8, 0xB3, 0x64, 0x8B, 0x7C, 0x12, 0x6E, 0xD1, 0x88, 0xD2,
-    0xE7, 0xE0, 0x11, 0x3C, 0x4B, 0x87, 0xDB, 0x53, 0x38, 0xF4, 0x5C, 0x23, 0x8D, 0x9E, 0x96, 0x31,
-    0xC7, 0x63, 0x1B, 0x88, 0x31, 0xD4, 0x1C, 0x6D, 0xB0, 0x3C, 0xFB, 0x1A, 0x64, 0x03, 0x2A, 0x4D,
-    0x67, 0x2C, 0x75, 0xAC, 0x3A, 0xB5, 0x68, 0xC1, 0x31, 0x62, 0x0B, 0xF3, 0xCD, 0x1A, 0xED, 0x60,
-    0xB6, 0x25, 0x97, 0x25, 0x38, 0x5E, 0x92, 0xD5, 0xC1, 0xB3, 0xCD, 0xA9, 0x2E, 0xCD, 0xC9, 0x1F,
-    0xD2, 0x92, 0xB5, 0x09, 0xED, 0x6D, 0xC2, 0xF2, 0xA7, 0x3E, 0xCE, 0x9A, 0x38, 0x29, 0x5A, 0x0B,
-    0x2E, 0xC8, 0x97, 0xD7, 0xB4, 0x59, 0x30, 0xDC, 0xAA, 0xAD, 0x23, 0x0B, 0x1E, 0xFF, 0xF6, 0x5C,
-    0x45, 0xCC, 0x10, 0x58, 0x23, 0x51, 0xA3, 0x2F, 0x2D, 0xCA, 0x75, 0xFC, 0x30, 0xC1, 0x2C, 0x36,
-    0xB2, 0x35, 0x6D, 0x2C, 0xC0, 0x4E, 0xC8, 0xB9, 0x52, 0x72, 0x09, 0xDB, 0x2B, 0xC3, 0xD9, 0x86,
-    0xE4, 0x2B, 0xE6, 0xB7, 0x28, 0x05, 0x12, 0xB0, 0x7B, 0x81, 0x81, 0xD9, 0x52, 0xAF, 0x64, 0xAB,
-    0x9D, 0xF0, 0xFF, 0x4B, 0x25, 0x13, 0x68, 0x56, 0x77, 0xCA, 0xA8, 0x05, 0x18, 0xC5, 0x13, 0xC0,
-    0x9F, 0x8E, 0xDE, 0x20, 0x6F, 0x3B, 0x1E, 0x3C, 0xE3, 0xE9, 0x8F, 0x38, 0xB2, 0x09, 0xDE, 0xE8,
-    0x30, 0x06, 0xD2, 0x66, 0x23, 0xF9, 0xBC, 0xDA, 0x44, 0xEF, 0xC5, 0xD9, 0x3F, 0x15, 0x2F, 0x7A,
-    0x31, 0x03, 0x25, 0x0B, 0xC6, 0xBB, 0xC9, 0xDE, 0x74, 0x64, 0x3C, 0xF8, 0xCC, 0xAC, 0x9B, 0x9D,
-    0x41, 0xE9, 0x99, 0x28, 0xB6, 0xCE, 0xB5, 0x55, 0xEA, 0x77, 0xEB, 0xEF, 0x75, 0x1B, 0x03, 0xCF,
-    0x9F, 0x3B, 0xC4, 0x2D, 0xE3, 0x1E, 0xDC, 0xC6, 0xC8, 0x32, 0x04, 0x63, 0x3B, 0xD2, 0x0B, 0x41,
-    0xE7, 0x8D, 0xDD, 0xDE, 0x5C, 0xEF, 0x68, 0xEE, 0x6A, 0xDF, 0x10, 0x88, 0xBE, 0x06, 0x89, 0x20,
-    0x37, 0xD7, 0x8A, 0xC4, 0x31, 0x60, 0xC5, 0x7A, 0xFB, 0x9C, 0xE1, 0xF5, 0x5E, 0xDF, 0xD9, 0x01,
-    0x92, 0x91, 0x8D, 0x45, 0xED, 0x0C, 0xBE, 0x4F, 0x73, 0x80, 0x5E, 0x4C, 0x42, 0xF7, 0x82, 0x02,
-    0x09, 0xAA, 0x83, 0xE7, 0x86, 0x28, 0x82, 0xC9, 0xB7, 0x5B, 0xA0, 0x60, 0x08, 0x17, 0xF4, 0xD1,
-    0xD4, 0x57, 0xDE, 0x09, 0xC1, 0x05, 0xA5, 0xFE, 0xA2, 0x05, 0xE7, 0x12, 0x91, 0xD7, 0x02, 0x14,
-    0x5C, 0x19, 0x08, 0x0D, 0xCC, 0x6D, 0x68, 0xAD, 0x80, 0xC2, 0x57, 0xCB, 0x46, 0x49, 0x7E, 0x52,
-    0xC9, 0x23, 0x5A, 0x29, 0x9E, 0x94, 0x87, 0x6F, 0x93, 0x12, 0x31, 0x30, 0x5A, 0x16, 0x9E, 0xF4,
-    0x36, 0x3C, 0xE6, 0xCE, 0x1A, 0x23, 0xAE, 0xA8, 0x4C, 0xA1, 0xB5, 0xF7, 0x86, 0x2B, 0x23, 0x5E,
-    0x2B, 0x41, 0xB1, 0xD4, 0xC7, 0xBC, 0x27, 0xDC, 0x22, 0x7E, 0x41, 0x08, 0x22, 0xFC, 0xA2, 0xF3,
-    0x12, 0x43, 0x93, 0x44, 0xB1, 0xAA, 0x85, 0x63, 0x9B, 0x37, 0x84, 0x1C, 0x1B, 0x25, 0x87, 0x1F,
-    0x84, 0x05, 0x72, 0x0B, 0x50, 0x44, 0xF9, 0x10, 0x16, 0xCE, 0x83, 0x8D, 0x02, 0x02, 0x51, 0xF6,
-    0xDC, 0x81, 0xDB, 0x9D, 0x17, 0x2A, 0x44, 0x44, 0x99, 0x61, 0x18, 0xFA, 0x75, 0xC8, 0x08, 0xA4,
-    0x41, 0x97, 0xA4, 0x0D, 0x42, 0x9A, 0xD5, 0xE9, 0xDC, 0xAB, 0x06, 0xB8, 0x51, 0x3C, 0xCE, 0x89,
-    0x35, 0xA6, 0xEF, 0x99, 0x23, 0xDB, 0x9A, 0x86, 0x62, 0x74, 0x95, 0xAA, 0xF1, 0x9C, 0x31, 0x73,
-    0x35, 0x0B, 0x32, 0xF1, 0xDC, 0x60, 0xFE, 0x34, 0xD5, 0xF4, 0x13, 0xDF, 0x87, 0x8B, 0xD0, 0x50,
-    0x42, 0x0D, 0x57, 0x20, 0x3B, 0x1D, 0x98, 0x85, 0x39, 0x98, 0x47, 0xA8, 0x41, 0xFB, 0xD6, 0xD9,
-    0xE7, 0x91, 0x06, 0x33, 0x46, 0x24, 0x9B, 0xCC, 0xD8, 0xB2, 0xCB, 0x89, 0xFD, 0xA8, 0x25, 0x2A,
-    0x35, 0x37, 0xA7, 0xF6, 0x67, 0x02, 0xFA, 0xAB, 0x89, 0xB1, 0x21, 0xF9, 0xEB, 0x98, 0x48, 0x8A,
-    0xE9, 0x56, 0x1F, 0x89, 0x68, 0x4F, 0x0F, 0xCB, 0xC1, 0x32, 0x20, 0x78, 0x8D, 0x61, 0x1F, 0x82,
-    0xA8, 0x0D, 0xEE, 0x60, 0x69, 0x60, 0xC4, 0x4A, 0x61, 0xCB, 0x2D, 0x78, 0x8A, 0x90, 0xD7, 0xB6,
-    0xEA, 0x66, 0x7A, 0x48, 0x2B, 0xC5, 0x9F, 0x4A, 0xD2, 0xFF, 0x1E, 0x20, 0xF9, 0xFC, 0x47, 0x23,
-    0x04, 0x5B, 0x7C, 0x6F, 0x84, 0x58, 0x17, 0x37, 0x26, 0x68, 0xBC, 0x7E, 0x89, 0x3E, 0xC3, 0x3D,
-    0xBD, 0x54, 0x05, 0x05, 0x9A, 0xFF, 0x25, 0x34, 0x11, 0x87, 0x21, 0x57, 0xE2, 0x34, 0x2D, 0x50,
-    0x67, 0xE8, 0x30, 0xA4, 0xAA, 0x59, 0x43, 0x73, 0x0A, 0x36, 0x1B, 0xC9, 0x46, 0x15, 0xAA, 0x1A,
-    0xF1, 0xA0, 0x7F, 0xA8, 0x82, 0x1C, 0x92, 0x45, 0x37, 0x84, 0xC4, 0xDE, 0xED, 0x6D, 0xC3, 0x50,
-    0xE1, 0x8D, 0x29, 0xF0, 0x69, 0xF2, 0x95, 0xF2, 0x8E, 0xC6, 0x74, 0x8E, 0x79, 0x42, 0x62, 0x89,
-    0xC3, 0xC2, 0xD5, 0x0E, 0x11, 0xB9, 0x0D, 0xE1, 0x9F, 0x56, 0xE4, 0x1B, 0x5A, 0x57, 0xEB, 0x28,
-    0x3A, 0x66, 0xD5, 0x30, 0x20, 0xA5, 0xD0, 0xD0, 0xC2, 0xE1, 0xD3, 0xD6, 0x4A, 0xD5, 0x96, 0x8E,
-    0x28, 0x6B, 0x7C, 0x72, 0x9B, 0x58, 0xB1, 0x49, 0x5F, 0xB4, 0x30, 0x97, 0x64, 0x19, 0xB1, 0xCA,
-    0x1A, 0x6E, 0x32, 0x9B, 0x54, 0x56, 0x67, 0x7E, 0xDB, 0x87, 0x06, 0x95, 0x5A, 0xE2, 0xD6, 0x81,
-    0x5E, 0xD9, 0x9C, 0x83, 0x04, 0xBB, 0x86, 0x28, 0x45, 0x6F, 0x7D, 0x84, 0xEE, 0x2F, 0xCB, 0x56,
-    0xC3, 0xD8, 0x3A, 0xC6, 0x73, 0x34, 0x4C, 0x4C, 0x06, 0x59, 0x29, 0x9F, 0xE7, 0xF8, 0xF5, 0x14,
-    0x88, 0x2F, 0xE9, 0xBC, 0xDE, 0x63, 0x9F, 0x2B, 0xFE, 0x31, 0x45, 0xB0, 0x13, 0x52, 0x2E, 0x57,
-    0x0F, 0x74, 0x89, 0x7F, 0x4D, 0xF5, 0x7E, 0x26, 0x20, 0x7F, 0x23, 0xED, 0x36, 0x7D, 0xF2, 0x7E,
-    0xFC, 0x79, 0x22, 0xBD, 0xC6, 0xDE, 0x53, 0x34, 0xFC, 0x86, 0x29, 0x35, 0x6B, 0x98, 0x11, 0xF8,
-    0x4A, 0xB1, 0x68, 0x98, 0x42, 0xD7, 0x15, 0x79, 0x71, 0xA5, 0x2B, 0x7F, 0x83, 0xB8, 0x0D, 0xFB,
-    0xA4, 0x49, 0x6F, 0x28, 0x2D, 0x23, 0x63, 0xB2, 0x52, 0x96, 0xB9, 0x2A, 0xF9, 0x99, 0xBA, 0xC8,
-    0xE4, 0x8E, 0x5A, 0xFD, 0xB3, 0xDB, 0xFA, 0x31, 0xB2, 0x5D, 0x0A, 0x6C, 0xF5, 0x37, 0x0E, 0x94,
-    0xD0, 0x87, 0xBC, 0xB0, 0x95, 0x7A, 0xAC, 0x97, 0xD8, 0x36, 0x95, 0x8B, 0x7F, 0xA1, 0x39, 0xEC,
-    0x85, 0x73, 0xAB, 0x97, 0xD6, 0x2F, 0xF8, 0xCC, 0xCA, 0xAA, 0x1D, 0x95, 0xFA, 0xFC, 0x42, 0xB6,
-    0xB4, 0x95, 0x29, 0x22, 0x17, 0xDD, 0x9C, 0xF9, 0x06, 0xB2, 0xB1, 0xB9, 0x91, 0x51, 0xA0, 0x3B,
-    0xE2, 0x09, 0xD7, 0xB8, 0x90, 0xBC, 0xBF, 0x5A, 0xD3, 0x10, 0x2E, 0x67, 0x8E, 0x34, 0x57, 0xAF,
-    0xCB, 0xE5, 0x9A, 0xD0, 0xBC, 0xCD, 0x7C, 0xC9, 0x59, 0x94, 0xC9, 0x18, 0x78, 0x42, 0x62, 0xB4,
-    0x1C, 0x72, 0x3F, 0x47, 0xAD, 0x78, 0x99, 0xED, 0x22, 0xED, 0xF2, 0xCE, 0x92, 0x74, 0xC8, 0x42,
-    0xC3, 0xFA, 0xCC, 0x46, 0xFA, 0xF3, 0x95, 0x44, 0x33, 0x21, 0x9A, 0x9A, 0x06, 0x33, 0x85, 0xA9,
-    0x1B, 0xA0, 0xCD, 0xF9, 0xC6, 0x86, 0xBF, 0x64, 0x5D, 0xFE, 0x7A, 0xBE, 0xE7, 0x87, 0xF2, 0x75,
-    0x72, 0x2F, 0x07, 0x16, 0xDE, 0x42, 0xB7, 0xA5, 0xEE, 0xED, 0xD4, 0x25, 0xDF, 0x92, 0x7D, 0xB2,
-    0xD5, 0xD5, 0x09, 0xB7, 0xE1, 0x5D, 0x6F, 0x75, 0x45, 0xF2, 0xE1, 0xF0, 0x17, 0x82, 0xAD, 0x6E,
-    0x25, 0x33, 0xA7, 0xB5, 0x15, 0x5D, 0xDA, 0x7C, 0x3E, 0xF2, 0xC9, 0x31, 0xC1, 0x7A, 0x9C, 0x3E,
-    0x0B, 0xF7, 0x90, 0x99, 0x41, 0x71, 0x78, 0xB3, 0x13, 0x7A, 0xD4, 0x90, 0x8D, 0x12, 0xBF, 0x6E,
-    0x90, 0x20, 0x61, 0xB9, 0x16, 0x0B, 0x82, 0x15, 0x84, 0x9A, 0xF5, 0xA8, 0xAF, 0xF5, 0x72, 0x32,
-    0x51, 0xCB, 0xFA, 0x30, 0xCC, 0xA5, 0x67, 0xBB, 0xD6, 0x31, 0xBD, 0x42, 0x27, 0xA0, 0x2E, 0x91,
-    0x0C, 0xA5, 0x4C, 0x22, 0xB0, 0x7C, 0x32, 0x52, 0xDB, 0x0B, 0xA6, 0x1F, 0xB0, 0x3B, 0x6B, 0xB8,
-    0xA8, 0x31, 0xA4, 0x96, 0x6F, 0x23, 0x15, 0xD0, 0xEC, 0x6A, 0x75, 0x56, 0x11, 0x14, 0x98, 0x36,
-    0x32, 0xD3, 0x83, 0x49, 0x3D, 0xB1, 0x0E, 0xC0, 0x31, 0xE7, 0x2E, 0x1D, 0x24, 0xD6, 0xE4, 0x7D,
-    0x5C, 0x36, 0x9D, 0x50, 0xAB, 0x2A, 0x7D, 0x9F, 0xF9, 0x48, 0xF5, 0x59, 0x03, 0xE6, 0xE5, 0x52,
-    0x8E, 0xBC, 0x7E, 0x47, 0xEE, 0x87, 0x83, 0xDC, 0xD7, 0x1F, 0xE1, 0x3E, 0x5E, 0x73, 0xBF, 0x5C,
-    0x73, 0xEF, 0xB6, 0xB8, 0x0F, 0xBF, 0x50, 0xEE, 0xAD, 0x0B, 0x6C, 0x15, 0xA7, 0x07, 0x52, 0x7C,
-    0xA3, 0xE3, 0x4A, 0x34, 0x45, 0xF1, 0x98, 0x1C, 0xF9, 0x9C, 0x6C, 0x55, 0x33, 0x5B, 0xC5, 0xFF,
-    0x01, 0x5B, 0xBB, 0x72, 0x91, 0xC5, 0x1F, 0xED, 0x79, 0x65, 0x19, 0x3C, 0x6C, 0x5D, 0x69, 0x8A,
-    0x96, 0x1F, 0xA7, 0x3A, 0x44, 0x84, 0x25, 0x10, 0xFA, 0xF1, 0xC0, 0x1D, 0x6F, 0x03, 0x6E, 0xF0,
-    0xBF, 0x0E, 0x5C, 0xEB, 0x82, 0xF4, 0x6B, 0xB8, 0xBE, 0xC9, 0x06, 0x31, 0x4E, 0x17, 0x3E, 0x03,
-    0x56, 0x59, 0xAC, 0x0D, 0x68, 0x64, 0x8C, 0xEA, 0x21, 0xC3, 0x49, 0xB3, 0x79, 0xA5, 0xDE, 0x21,
-    0x51, 0x56, 0x3A, 0x57, 0x20, 0xD3, 0x21, 0x00, 0x39, 0x30, 0x89, 0xF5, 0xA5, 0x01, 0x9A, 0x5D,
-    0xA1, 0x41, 0x56, 0xA3, 0xE7, 0x91, 0xE1, 0x14, 0xD3, 0x4F, 0xB3, 0xAB, 0x5C, 0x0C, 0xF3, 0x12,
-    0x3F, 0x05, 0xCD, 0xEA, 0xC8, 0xDA, 0xE8, 0x75, 0x37, 0xDF, 0xCE, 0xA6, 0xB9, 0x8F, 0x19, 0x9B,
-    0x8B, 0xA2, 0x87, 0xC9, 0x67, 0x20, 0x46, 0xEF, 0xB3, 0x76, 0xAA, 0x6C, 0x86, 0x68, 0x50, 0xD7,
-    0x95, 0x55, 0x2A, 0xC1, 0xEB, 0x1A, 0x77, 0xB1, 0xA2, 0x8A, 0x94, 0x7E, 0x4F, 0x15, 0x1C, 0x75,
-    0xE1, 0x80, 0xA8, 0xDB, 0x28, 0x8D, 0xBB, 0xEA, 0x1D, 0x03, 0x0B, 0xB0, 0xEA, 0x54, 0x8B, 0x5B,
-    0xBE, 0xBD, 0x15, 0xB7, 0xB3, 0x19, 0x4F, 0x1B, 0x47, 0x26, 0xC1, 0xB7, 0xE9, 0x97, 0x1B, 0x65,
-    0x52, 0xCB, 0x57, 0x1D, 0xF2, 0x2A, 0x32, 0xE4, 0x17, 0x50, 0x80, 0x9F, 0xC7, 0x22, 0x70, 0xAF,
-    0xF8, 0xB9, 0xAE, 0x59, 0x22, 0x76, 0x83, 0xEC, 0x61, 0xB9, 0x6E, 0x8A, 0x2A, 0x3B, 0x05, 0xA3,
-    0x66, 0xD4, 0xE1, 0x10, 0x8E, 0x78, 0xCB, 0xA1, 0x9A, 0xCB, 0xAB, 0xA4, 0x53, 0x12, 0xD0, 0x49,
-    0x6D, 0x94, 0xC6, 0xAC, 0xCA, 0xFF, 0xE5, 0x6C, 0x8D, 0x72, 0x6D, 0x25, 0xC5, 0xDF, 0x68, 0xBA,
-    0x51, 0x9F, 0x5E, 0x7B, 0xE1, 0xA4, 0xDD, 0x5E, 0x5F, 0x8A, 0xB7, 0xE3, 0x30, 0x22, 0x7C, 0xE8,
-    0x96, 0x3D, 0x5B, 0x1A, 0x45, 0x9B, 0x77, 0x3A, 0xF2, 0x52, 0x39, 0x48, 0x9B, 0x1C, 0x13, 0x63,
-    0xF0, 0x3D, 0x9D, 0x3C, 0xAD, 0x34, 0x4A, 0x0F, 0xAA, 0x93, 0xB4, 0xD2, 0xBA, 0xCF, 0x3D, 0xE7,
-    0x7A, 0xA4, 0x15, 0x08, 0x37, 0x5D, 0xE4, 0x56, 0x17, 0x25, 0x59, 0x9D, 0x6E, 0x6D, 0x4F, 0x07,
-    0x57, 0xF1, 0xD8, 0x51, 0x60, 0xF3, 0x99, 0xAB, 0x1C, 0x77, 0xF4, 0x63, 0x5F, 0xEC, 0xEC, 0x80,
-    0x65, 0x38, 0xCC, 0x00, 0x48, 0xFF, 0x5E, 0xA7, 0x3D, 0x0E, 0x8A, 0x5E, 0xB0, 0xED, 0x04, 0x7E,
-    0x2D, 0x82, 0xF3, 0x71, 0x6B, 0x07, 0x26, 0x84, 0x1A, 0x5B, 0xCE, 0xC8, 0xC5, 0x74, 0x4E, 0xA9,
-    0xFE, 0x27, 0xAB, 0x38, 0x67, 0x8A, 0x95, 0x4D, 0x4E, 0x9A, 0xBE, 0x7F, 0xC5, 0xD6, 0xCE, 0x61,
-    0x14, 0x58, 0x5C, 0xD0, 0x69, 0xA5, 0xBE, 0x79, 0x81, 0xE1, 0xE9, 0x84, 0x04, 0x1F, 0x3E, 0xAD,
-    0xA9, 0x5C, 0xAA, 0x39, 0xF0, 0x8B, 0x6A, 0x5B, 0x41, 0xF3, 0xD5, 0x2D, 0x06, 0x95, 0xCE, 0x3D,
-    0x9B, 0xD0, 0x95, 0x75, 0x45, 0x0E, 0x77, 0x55, 0x8B, 0x9C, 0x0F, 0xEB, 0xE3, 0xB2, 0x67, 0xDA,
-    0x4D, 0x3B, 0x4E, 0xB7, 0x0B, 0xD3, 0x07, 0x8F, 0x91, 0x5F, 0xA9, 0xC7, 0xFA, 0xCC, 0xAD, 0x71,
-    0x66, 0xF2, 0xBA, 0xFE, 0x53, 0xF4, 0x60, 0x11, 0x4E, 0xAD, 0x3A, 0x9A, 0xB4, 0xBE, 0x48, 0xA6,
-    0x74, 0x3B, 0x53, 0xFA, 0xD5, 0x70, 0x49, 0xDB, 0x7E, 0xE2, 0x29, 0x85, 0x0F, 0xAA, 0xF6, 0x57,
-    0x4E, 0xA8, 0x5A, 0x13, 0xBF, 0x3A, 0x14, 0xBC, 0xF2, 0x2B, 0x53, 0xE9, 0x7A, 0xCC, 0x70, 0x85,
-    0xA4, 0x75, 0xF9, 0x73, 0xDF, 0x8C, 0x5E, 0x95, 0x6F, 0x60, 0x70, 0xF5, 0xE3, 0x48, 0x88, 0xD5,
-    0xA0, 0x9E, 0xC4, 0x14, 0x7D, 0xF0, 0xDD, 0x36, 0xB7, 0xFB, 0x98, 0x08, 0x0D, 0x3E, 0x9D, 0x6B,
-    0xF9, 0x2C, 0x77, 0x3A, 0x31, 0xCB, 0x1C, 0xAC, 0x85, 0x82, 0x49, 0xB9, 0xE2, 0xF3, 0x1C, 0x1C,
-    0x5C, 0xC5, 0x14, 0x19, 0x5B, 0xAE, 0xF8, 0xB7, 0x51, 0x02, 0xD8, 0xDC, 0x56, 0x1A, 0x7E, 0x50,
-    0xDF, 0xF4, 0xD9, 0x0A, 0x52, 0x31, 0x27, 0xF9, 0xAD, 0xEF, 0xC0, 0xA7, 0xA3, 0x0B, 0xB2, 0x6F,
-    0x25, 0x1E, 0xF6, 0x06, 0x5C, 0xB7, 0x7E, 0x17, 0xAE, 0x32, 0xBA, 0xBC, 0xF3, 0x8A, 0xED, 0x1D,
-    0x71, 0x4D, 0x80, 0xA4, 0xB2, 0xF2, 0x0E, 0xE0, 0xBC, 0x8A, 0x4A, 0x6F, 0x3F, 0x42, 0x17, 0x2E,
-    0xAF, 0xAF, 0x1D, 0x61, 0x3F, 0xF7, 0x1B, 0xEB, 0x75, 0xD3, 0xF6, 0xF0, 0x5A, 0xA2, 0x13, 0xB6,
-    0x1F, 0xF2, 0x36, 0xC5, 0x80, 0x2F, 0x04, 0xD8, 0xF0, 0xB5, 0x2B, 0xCF, 0x4D, 0xF0, 0xD3, 0x0D,
-    0x3A, 0x2E, 0xD9, 0xCB, 0xA5, 0x99, 0x5D, 0x31, 0xE7, 0xDB, 0x1A, 0x59, 0xBF, 0x0C, 0xD7, 0x0E,
-    0x1E, 0xD1, 0xAE, 0x70, 0xC8, 0x93, 0xCB, 0x75, 0xF6, 0xC1, 0xFE, 0xF5, 0xDE, 0xBC, 0x04, 0x8B,
-    0xB7, 0x0E, 0x28, 0xF3, 0x93, 0x8F, 0x63, 0x5C, 0x8B, 0xE0, 0xBE, 0x95, 0x53, 0x24, 0x0A, 0x38,
-    0xE9, 0xA3, 0xEE, 0xEE, 0x2B, 0x0D, 0xDB, 0xDB, 0xA0, 0x2A, 0x7E, 0xE7, 0xCC, 0xB6, 0x93, 0x1D,
-    0x2D, 0x5B, 0x3C, 0x62, 0x5D, 0xAA, 0xC2, 0x37, 0xA3, 0xFD, 0xEA, 0x86, 0x45, 0x7D, 0x12, 0xE2,
-    0xE6, 0xB2, 0x79, 0x50, 0x2A, 0x13, 0x89, 0x3E, 0xEA, 0x45, 0xD8, 0x17, 0x84, 0x3C, 0x12, 0xEC,
-    0x3A, 0xB9, 0x28, 0x71, 0xA9, 0x4E, 0x37, 0x15, 0x08, 0x84, 0x9D, 0x2F, 0x68, 0xB5, 0xBA, 0x78,
-    0xD6, 0x3B, 0x22, 0x76, 0x63, 0x88, 0x01, 0xCD, 0x60, 0xBF, 0x45, 0x91, 0x44, 0xBE, 0x9F, 0xAC,
-    0x06, 0x5B, 0xDF, 0xB2, 0xAE, 0xF9, 0x02, 0x71, 0x51, 0x63, 0x10, 0x22, 0x77, 0xB4, 0x8A, 0x56,
-    0x9F, 0x14, 0xB6, 0xCF, 0x75, 0x9E, 0x7D, 0xE8, 0x84, 0x34, 0x50, 0x29, 0xE4, 0x9F, 0x5A, 0x21,
-    0x11, 0x50, 0x8B, 0x09, 0xA0, 0x58, 0xD7, 0x3B, 0x50, 0x8C, 0x49, 0x20, 0xF5, 0x0B, 0x00, 0xBD,
-    0xA9, 0x46, 0xA9, 0xB5, 0x05, 0x67, 0xB4, 0xB7, 0xBE, 0xB5, 0x9E, 0xE9, 0x38, 0xC0, 0xAB, 0x36,
-    0xCB, 0xBF, 0x11, 0xF7, 0x10, 0x8E, 0xD0, 0x1A, 0xAC, 0x0A, 0x10, 0xCA, 0xD1, 0xCE, 0xD3, 0xB7,
-    0x08, 0x24, 0x84, 0x8E, 0x81, 0xEF, 0xC4, 0xF6, 0xE9, 0xEB, 0x77, 0x66, 0x01, 0x1D, 0x89, 0x1D,
-    0x7B, 0xF0, 0x9A, 0x39, 0xEE, 0x9E, 0xDB, 0x30, 0xA2, 0xCD, 0x75, 0xDB, 0x79, 0x15, 0x5A, 0x93,
-    0x19, 0x48, 0x5F, 0xF8, 0x0D, 0x26, 0x28, 0x46, 0x55, 0x01, 0xBB, 0x59, 0x99, 0x54, 0xC7, 0xD5,
-    0xFF, 0x3E, 0x7A, 0xC8, 0x80, 0xD5, 0xA7, 0x1D, 0x30, 0xEC, 0xA3, 0x1E, 0x65, 0xB6, 0x2A, 0x20,
-    0x56, 0xB7, 0x56, 0xF4, 0xC5, 0x6D, 0x2B, 0x2A, 0x6F, 0x1A, 0x50, 0xB3, 0xCD, 0xC7, 0xD4, 0x52,
-    0x0F, 0x8C, 0x9D, 0x96, 0xF6, 0xB1, 0x37, 0x65, 0xEF, 0x6F, 0x8C, 0xD2, 0x17, 0x5A, 0xE1, 0xCD,
-    0x39, 0xD3, 0xDA, 0xB4, 0x67, 0xAE, 0xF9, 0x72, 0xAA, 0x99, 0x6B, 0xE1, 0xDC, 0x0A, 0x28, 0xEB,
-    0xD3, 0x08, 0xDB, 0xAC, 0xEA, 0x44, 0x54, 0xC9, 0x4B, 0x48, 0x73, 0x4C, 0xBE, 0x4F, 0xAE, 0x51,
-    0x49, 0x0F, 0x48, 0xAE, 0x82, 0x91, 0x42, 0xB8, 0xC6, 0xDE, 0x74, 0x31, 0x73, 0xC6, 0x6E, 0x7E,
-    0xB0, 0x6F, 0x43, 0x5B, 0x3F, 0x96, 0x29, 0x09, 0x73, 0x92, 0x63, 0xB7, 0xB6, 0x1A, 0x28, 0x81,
-    0xC3, 0xC2, 0xFA, 0xCF, 0x5A, 0x84, 0x29, 0xD4, 0x5F, 0xA7, 0xC2, 0x43, 0x6A, 0xEC, 0x40, 0xED,
-    0x27, 0xFE, 0x3B, 0xA5, 0xDB, 0xD6, 0x7C, 0x5C, 0xBB, 0x40, 0xFB, 0x5C, 0x33, 0x87, 0xA2, 0x9A,
-    0xB7, 0x80, 0xC5, 0xD8, 0x02, 0x66, 0xEA, 0x5F, 0x62, 0xE1, 0x65, 0x81, 0x2F, 0x05, 0x96, 0xCB,
-    0xB5, 0x60, 0xAD, 0x91, 0x4C, 0x15, 0x4D, 0xC4, 0x2F, 0x0E, 0xC0, 0xAA, 0x2B, 0x83, 0xF5, 0xB3,
-    0xB7, 0xFB, 0x9F, 0x7F, 0xBA, 0x13, 0x50, 0x02, 0xE4, 0x51, 0x48, 0x8C, 0x16, 0xEF, 0xBA, 0x32,
-    0x6D, 0x35, 0x66, 0x61, 0xEE, 0x0B, 0xD8, 0x4F, 0xA1, 0xB1, 0xEF, 0x2D, 0xA5, 0x7B, 0x52, 0x30,
-    0xE6, 0xCF, 0xF4, 0xB6, 0x18, 0xAC, 0xD6, 0x73, 0xB6, 0x86, 0x13, 0xE8, 0xB9, 0x50, 0x12, 0x33,
-    0xA1, 0x5C, 0x6D, 0xF6, 0xFD, 0x1C, 0x74, 0x3D, 0xBB, 0xEB, 0xD5, 0xEA, 0x4F, 0xDF, 0x1D, 0x44,
-    0x97, 0xDF, 0x21, 0x73, 0xFD, 0x47, 0xCD, 0x85, 0x95, 0x1E, 0x1A, 0x02, 0x7C, 0x40, 0xA3, 0x8A,
-    0x28, 0xA0, 0x90, 0x49, 0x65, 0x94, 0xB4, 0xF8, 0x06, 0xE3, 0x18, 0x49, 0x51, 0x02, 0x4F, 0xCF,
-    0x65, 0xB3, 0x0C, 0xC2, 0xF4, 0x24, 0xDD, 0x2B, 0x33, 0x11, 0x88, 0xD8, 0xD9, 0x39, 0xF8, 0x47,
-    0x05, 0x54, 0xEA, 0xF7, 0xA9, 0x6C, 0x1D, 0x47, 0xE6, 0xFC, 0x30, 0xFB, 0xA0, 0xC6, 0x4A, 0x40,
-    0x86, 0x2D, 0x47, 0x05, 0xDC, 0xDE, 0x14, 0x81, 0xF5, 0x4C, 0xDF, 0x6A, 0x14, 0x56, 0xD7, 0xF9,
-    0x0D, 0xAB, 0xDC, 0x55, 0xF1, 0xCE, 0xF3, 0x0C, 0x2E, 0x0D, 0x25, 0x11, 0x30, 0xA9, 0xB6, 0xC0,
-    0x92, 0x35, 0x27, 0x45, 0x3E, 0xAC, 0x5A, 0x49, 0xFE, 0x48, 0xA3, 0xE9, 0x29, 0x4D, 0x5F, 0x83,
-    0x2E, 0xBB, 0x73, 0xD9, 0x77, 0x8C, 0xC1, 0x55, 0xD3, 0x76, 0xA8, 0x80, 0x9B, 0x29, 0x01, 0x39,
-    0xB8, 0x9C, 0x1E, 0x3A, 0x80, 0x32, 0x0A, 0x95, 0x62, 0x38, 0xF0, 0x1B, 0x94, 0x20, 0xEE, 0xE5,
-    0x73, 0x3D, 0x77, 0xEA, 0x46, 0x00, 0x36, 0xB5, 0x10, 0x5A, 0x3A, 0xBF, 0x0F, 0x13, 0x59, 0xE9,
-    0xBF, 0x70, 0xA9, 0xA5, 0x11, 0x1D, 0x1D, 0xEC, 0xEE, 0xCE, 0x02, 0x27, 0x00, 0x12, 0x6E, 0x20,
-    0xD5, 0xE9, 0xC9, 0x3A, 0x21, 0x40, 0x91, 0x73, 0x46, 0xF2, 0x0E, 0x10, 0x94, 0x94, 0x39, 0x09,
-    0x20, 0xF3, 0xB9, 0x5F, 0x31, 0x6C, 0x8D, 0x82, 0x99, 0xFB, 0x6A, 0xDE, 0x0E, 0x65, 0x3B, 0x2E,
-    0x60, 0x0E, 0xE5, 0x61, 0x4B, 0x76, 0x08, 0x25, 0x3F, 0xB0, 0xCE, 0xD5, 0x26, 0xCB, 0x99, 0x77,
-    0x4F, 0xB1, 0xD4, 0x42, 0x59, 0x10, 0x6E, 0x7A, 0x44, 0x81, 0x6C, 0x17, 0xD5, 0x51, 0xB3, 0xF6,
-    0x74, 0x9B, 0xB2, 0x5B, 0xC6, 0x03, 0x6D, 0xEB, 0x5D, 0xDF, 0xA1, 0xF0, 0xDD, 0x96, 0x72, 0xBB,
-    0x7D, 0x6D, 0xFB, 0x93, 0x66, 0x7C, 0xDA, 0x56, 0xE9, 0xA0, 0xB6, 0xED, 0x3A, 0x46, 0x53, 0xBC,
-    0xAA, 0x6D, 0x9B, 0x51, 0x7E, 0x91, 0x16, 0x95, 0x7D, 0x03, 0xBB, 0xC1, 0x86, 0xF4, 0x6D, 0x5C,
-    0x9D, 0xE2, 0x16, 0x74, 0x5E, 0x88, 0x3A, 0x4C, 0x92, 0x87, 0x3D, 0x48, 0x57, 0x83, 0x81, 0x97,
-    0x8A, 0xFA, 0xC9, 0x9A, 0x77, 0xFB, 0xE7, 0x7A, 0xEB, 0xD9, 0xD8, 0x1E, 0x2D, 0xEB, 0xE2, 0x2C,
-    0xAC, 0x0D, 0x95, 0x9A, 0xC2, 0x7C, 0x15, 0xE1, 0x3D, 0xD7, 0xEC, 0x28, 0xBC, 0xC2, 0xAE, 0xFB,
-    0x6E, 0x8B, 0x6C, 0x6D, 0x38, 0xF2, 0xAB, 0x98, 0xF3, 0x4A, 0x44, 0x72, 0xE8, 0xFB, 0x5E, 0x28,
-    0x97, 0x3E, 0xAA, 0xEC, 0xD2, 0xCB, 0x98, 0x0A, 0x62, 0xD0, 0x3E, 0xF6, 0x11, 0x7F, 0xAC, 0xB8,
-    0x4B, 0xDA, 0xDC, 0x70, 0x0F, 0x9B, 0x0B, 0x46, 0xA5, 0x30, 0x2F, 0xB1, 0xDB, 0x5D, 0x05, 0xB7,
-    0x10, 0x6C, 0x3F, 0x55, 0xF7, 0xBF, 0x0C, 0x46, 0x2E, 0x96, 0x25, 0x0C, 0xCB, 0xF0, 0x08, 0x23,
-    0x3E, 0x94, 0x99, 0xFB, 0xA5, 0x96, 0xB5, 0xE3, 0x62, 0x13, 0x89, 0x2A, 0xAF, 0x9C, 0xE3, 0xB3,
-    0xEA, 0x86, 0xDB, 0xF6, 0xDC, 0x1D, 0x76, 0x28, 0xEA, 0xAE, 0x87, 0x46, 0x02, 0x69, 0xC9, 0xAA,
-    0x8B, 0xCA, 0x5D, 0x82, 0x7D, 0xB0, 0xD7, 0xD4, 0x31, 0x2A, 0xF7, 0xFB, 0xC8, 0x0E, 0xDB, 0xAC,
-    0x52, 0xA4, 0x63, 0xBD, 0x4E, 0x49, 0x20, 0x2D, 0xD8, 0xE4, 0x31, 0xA8, 0x39, 0x2E, 0x14, 0x95,
-    0x7F, 0x39, 0x3B, 0x9F, 0x47, 0xE7, 0x82, 0x89, 0x6B, 0x91, 0x17, 0xE1, 0xA8, 0xF6, 0xB0, 0xD1,
-    0xFB, 0x8D, 0x2F, 0x7E, 0x2E, 0x6E, 0x88, 0xCE, 0xDA, 0xAC, 0x61, 0xD2, 0x41, 0xE3, 0xB3, 0x66,
-    0xC1, 0x6D, 0x52, 0x86, 0xAF, 0xB7, 0xF0, 0xA2, 0xAE, 0xBE, 0xA3, 0x98, 0x73, 0xFC, 0xFF, 0x02,
-    0xCC, 0xC9, 0xE0, 0x0F, 0x39, 0xAB, 0x3B, 0x48, 0x06, 0x4E, 0x8A, 0xD4, 0x03, 0x58, 0x1A, 0xE1,
-    0x75, 0x5A, 0xCE, 0x1A, 0xB8, 0x7F, 0xDF, 0x32, 0x6D, 0x7A, 0x35, 0x03, 0xF2, 0x0E, 0x11, 0x52,
-    0xAD, 0xF1, 0xFD, 0x3B, 0x9F, 0x67, 0xA5, 0x66, 0x04, 0x69, 0xCA, 0x3C, 0xC4, 0x03, 0x80, 0x29,
-    0xD4, 0xAE, 0xB3, 0x31, 0xDD, 0x60, 0xA3, 0x25, 0x42, 0x63, 0xB5, 0x40, 0x6E, 0xCB, 0x95, 0xD8,
-    0xB7, 0xB9, 0x04, 0x0C, 0x88, 0xA6, 0x1F, 0x72, 0xFF, 0x13, 0xAB, 0x52, 0x26, 0xE4, 0xAC, 0xD2,
-    0x6D, 0xBB, 0x11, 0xB7, 0x5F, 0x99, 0x3B, 0xA2, 0x89, 0x2D, 0x7A, 0xBF, 0x35, 0x25, 0x62, 0x18,
-    0xE5, 0xBE, 0xFE, 0x98, 0xFB, 0x7C, 0xF6, 0xB7, 0xBD, 0xC2, 0x0C, 0xF0, 0xDD, 0xB9, 0x08, 0xBF,
-    0x26, 0x7E, 0x87, 0x0C, 0x1C, 0x57, 0x76, 0x7A, 0x44, 0x7F, 0xBB, 0xD5, 0xDB, 0x1A, 0x2E, 0xDB,
-    0x00, 0x9B, 0xAF, 0x53, 0x98, 0x79, 0xAF, 0x2C, 0x1C, 0x57, 0xB3, 0x8F, 0x9B, 0x00, 0x1F, 0x73,
-    0xDC, 0xEE, 0x54, 0x31, 0x3B, 0xE9, 0xE0, 0xF3, 0x5B, 0x74, 0x8F, 0x6E, 0x7A, 0x4C, 0x66, 0xB3,
-    0xB4, 0x76, 0x67, 0xEF, 0xB0, 0xB7, 0xE9, 0xD7, 0x85, 0x3D, 0xF7, 0x93, 0x72, 0xC1, 0xC0, 0xB1,
-    0x03, 0x45, 0xAF, 0xAA, 0xF9, 0xCC, 0xA7, 0x89, 0x6F, 0x9A, 0xC9, 0xD8, 0x7F, 0x16, 0xC9, 0xB0,
-    0x75, 0x19, 0xD6, 0xBD, 0x0F, 0x38, 0x62, 0xFB, 0x91, 0x78, 0x59, 0xA6, 0x9D, 0x2D, 0x66, 0x43,
-    0x6C, 0x0B, 0x2E, 0x04, 0x50, 0x98, 0xD1, 0x8A, 0x7B, 0x49, 0x29, 0x92, 0xCC, 0x44, 0x38, 0xAC,
-    0x7B, 0x20, 0x16, 0xEE, 0xB3, 0x7E, 0x2D, 0x4E, 0xB6, 0x42, 0x28, 0xF4, 0x94, 0x5D, 0x62, 0xFF,
-    0xFF, 0x24, 0xF0, 0x46, 0x62, 0x79, 0xD2, 0xFF, 0x00, 0xDD, 0x5C, 0x3F, 0xAC, 0xDD, 0xD6, 0x79,
-    0x3F, 0x24, 0x2D, 0xB1, 0x16, 0xEB, 0x30, 0x43, 0x1C, 0x38, 0x91, 0x63, 0x76, 0x48, 0x81, 0xA4,
-    0xB1, 0xC5, 0x25, 0x43, 0x06, 0x49, 0x64, 0x12, 0x14, 0x1D, 0x3C, 0x44, 0x05, 0x2C, 0xA3, 0xB0,
-    0x17, 0x0F, 0x1D, 0x02, 0x67, 0x78, 0x19, 0x32, 0xA8, 0x80, 0xF4, 0xC8, 0x34, 0x43, 0x86, 0x2C,
-    0x1A, 0xA2, 0xAE, 0xD5, 0xE0, 0x02, 0xB5, 0x3C, 0xC8, 0x83, 0x07, 0x0F, 0x92, 0xC8, 0x5A, 0x40,
-    0x3B, 0x86, 0x49, 0x10, 0x74, 0xC8, 0x90, 0xDB, 0xC6, 0xAE, 0xD3, 0x64, 0x10, 0x8B, 0x5E, 0x23,
-    0xF7, 0xC9, 0xBC, 0x3C, 0xFD, 0x7E, 0xBF, 0xEF, 0x1C, 0x92, 0xEF, 0x49, 0x4F, 0x4F, 0x6E, 0xEA,
-    0xD4, 0xCE, 0x85, 0x74, 0xEF, 0xBB, 0xE4, 0xBD, 0xE4, 0xF9, 0x7E, 0xDF, 0xFF, 0x3F, 0xE7, 0x1A,
-    0x23, 0x8F, 0x63, 0xE7, 0xE4, 0xC9, 0xDA, 0x51, 0x9E, 0x0B, 0x6B, 0x57, 0xE6, 0x41, 0x8F, 0x94,
-    0xA7, 0xC3, 0x91, 0x6F, 0x8A, 0x9E, 0x87, 0x2C, 0x9E, 0x83, 0xF7, 0xF9, 0xA6, 0x28, 0x78, 0xE8,
-    0xA7, 0x6B, 0x1C, 0x1A, 0x8A, 0x12, 0x87, 0x22, 0xBC, 0x49, 0x56, 0x79, 0x8D, 0x43, 0xE1, 0x06,
-    0x87, 0xCA, 0xBC, 0x95, 0x43, 0x7D, 0x38, 0xE0, 0x90, 0xC9, 0xE4, 0x4D, 0x51, 0xCB, 0x1F, 0x72,
-    0xC8, 0x64, 0x9D, 0x31, 0x5B, 0xFE, 0x93, 0xC5, 0xC8, 0x6A, 0x12, 0xCB, 0xA5, 0x59, 0xBE, 0xC1,
-    0x21, 0x6B, 0x62, 0xB9, 0x46, 0xDA, 0x1B, 0xDC, 0xD7, 0x9A, 0x7C, 0x85, 0x37, 0x31, 0xAE, 0x64,
-    0x71, 0xBB, 0xE0, 0x39, 0x13, 0x5A, 0x3B, 0xE0, 0x7B, 0xC3, 0x72, 0xE5, 0xF8, 0x5C, 0x68, 0xB7,
-    0xBD, 0xAC, 0x17, 0x17, 0xEA, 0xE4, 0x7D, 0x65, 0xD2, 0xCE, 0x6C, 0x4C, 0xDA, 0x86, 0x72, 0xB4,
-    0x8D, 0x3A, 0x79, 0x8A, 0x5B, 0x93, 0xD5, 0x69, 0x2D, 0xCB, 0x49, 0x4B, 0xD3, 0x94, 0x69, 0x1D,
-    0x59, 0x93, 0xBE, 0x77, 0xDD, 0xE2, 0x5B, 0x16, 0xD7, 0x1C, 0x4D, 0x64, 0xC7, 0x5D, 0x63, 0x9A,
-    0xB7, 0x2F, 0xE1, 0xAA, 0x27, 0x8C, 0xB9, 0x2C, 0x2F, 0xBD, 0x79, 0x1A, 0x64, 0xD7, 0x89, 0x50,
-    0x62, 0x1A, 0x0B, 0x28, 0x22, 0xBD, 0x7D, 0xB2, 0x67, 0x1E, 0xE6, 0xF1, 0x51, 0xC7, 0x35, 0xB8,
-    0x6C, 0xBE, 0x60, 0xC2, 0xCE, 0x5C, 0x30, 0x61, 0x1F, 0xF4, 0xF8, 0x5A, 0x07, 0x42, 0x65, 0x1D,
-    0x27, 0xDF, 0xBE, 0x97, 0x9A, 0x0F, 0x07, 0x6B, 0x43, 0x74, 0x92, 0xCD, 0x04, 0x51, 0x64, 0x01,
-    0x77, 0xD6, 0xE0, 0xC0, 0x30, 0x4C, 0xF8, 0x54, 0x72, 0x27, 0x13, 0xF5, 0x00, 0x29, 0xAF, 0x6F,
-    0x79, 0x70, 0xD2, 0x4E, 0x40, 0x30, 0x8D, 0x11, 0x84, 0xE2, 0x5E, 0x96, 0xA3, 0xC8, 0x08, 0x52,
-    0xF1, 0x1A, 0x4B, 0x93, 0x7F, 0xC0, 0xA0, 0x56, 0x58, 0x80, 0xC7, 0x26, 0xC2, 0x81, 0x3E, 0x13,
-    0x5A, 0x8A, 0x96, 0x98, 0xE0, 0xD6, 0xD1, 0x50, 0xC9, 0x4D, 0x33, 0xDC, 0xC7, 0xBC, 0x41, 0x9E,
-    0x70, 0x69, 0x64, 0x52, 0xCC, 0x3F, 0x33, 0xFE, 0x7D, 0xB2, 0x5D, 0x02, 0x02, 0xC6, 0x12, 0x10,
-    0x5E, 0x5C, 0xF0, 0x90, 0x25, 0x6C, 0x09, 0x47, 0x2E, 0x4B, 0x27, 0x1A, 0x17, 0x4D, 0xB0, 0x21,
-    0x18, 0x6B, 0x93, 0xAC, 0x89, 0x85, 0x7D, 0xC1, 0xF6, 0x84, 0xA2, 0x11, 0x14, 0x89, 0x44, 0x32,
-    0xEE, 0x08, 0x69, 0x14, 0x32, 0xC8, 0xCB, 0xE7, 0x70, 0x69, 0xF0, 0x20, 0xEC, 0xF5, 0x36, 0x17,
-    0xF8, 0x7C, 0x9A, 0xCF, 0x67, 0x95, 0x13, 0xBA, 0xA4, 0x92, 0xB2, 0x5A, 0x9B, 0x0F, 0xF8, 0x38,
-    0x69, 0x2F, 0x83, 0xFD, 0x56, 0xE8, 0x8E, 0xA9, 0x4E, 0x89, 0xBD, 0xF2, 0x82, 0x90, 0x4C, 0x46,
-    0xA4, 0xC3, 0xFC, 0xAC, 0x4C, 0x89, 0xF9, 0x77, 0xC4, 0xE7, 0x40, 0x45, 0x99, 0x32, 0x6C, 0x2A,
-    0xDE, 0x39, 0xEF, 0xF8, 0x05, 0x42, 0x17, 0xF1, 0x74, 0x40, 0x06, 0x9A, 0x4A, 0xBE, 0xF1, 0x49,
-    0x93, 0xD9, 0xBD, 0xE7, 0x07, 0xDC, 0xC7, 0x8B, 0x65, 0x69, 0x72, 0x79, 0x6E, 0x0D, 0xF8, 0x20,
-    0x04, 0x56, 0x5C, 0x87, 0xE8, 0xF6, 0xAF, 0x16, 0x2B, 0x3C, 0x81, 0x9B, 0xCB, 0xD5, 0x45, 0x96,
-    0x4C, 0x04, 0xB6, 0xAF, 0x66, 0x34, 0xEE, 0x79, 0x1C, 0xB7, 0xB5, 0xDC, 0xA5, 0x37, 0xF9, 0xDE,
-    0x37, 0x0D, 0xD8, 0x0A, 0x39, 0x49, 0x56, 0x90, 0x15, 0x59, 0x0A, 0x28, 0xB8, 0x49, 0x1D, 0xD2,
-    0x13, 0x24, 0xC3, 0xBE, 0x73, 0x55, 0xBE, 0xB1, 0xC5, 0x5D, 0x5B, 0x21, 0xBE, 0x9B, 0x2E, 0xF5,
-    0x04, 0x9F, 0x23, 0xBD, 0x53, 0x43, 0x2A, 0xB2, 0x1D, 0xA0, 0x1C, 0xB5, 0xCF, 0xA8, 0x3C, 0x5C,
-    0x78, 0x18, 0x80, 0x8F, 0x5B, 0x68, 0x4F, 0x26, 0x72, 0xC7, 0xE7, 0xDE, 0x23, 0x1C, 0x59, 0x22,
-    0xA6, 0xF0, 0xA8, 0x39, 0x50, 0x88, 0x03, 0x05, 0xB4, 0xE0, 0x89, 0x78, 0xB3, 0xC0, 0x38, 0x53,
-    0x0B, 0xB2, 0xD5, 0xF3, 0xDD, 0x0C, 0xB2, 0xA9, 0x54, 0x38, 0xE5, 0x62, 0x01, 0x50, 0x7C, 0xE7,
-    0xC5, 0xDE, 0xA3, 0x0C, 0x31, 0xEF, 0x40, 0x1C, 0x78, 0x9B, 0x12, 0x6C, 0x07, 0xB3, 0xC8, 0xDC,
-    0xDD, 0xC5, 0x3A, 0xE3, 0xDA, 0x21, 0x13, 0x72, 0xA5, 0xCF, 0xCA, 0x53, 0x1F, 0xB5, 0xE6, 0xB8,
-    0x09, 0x16, 0x32, 0x15, 0x34, 0x2B, 0x7C, 0x5D, 0x80, 0x1A, 0x5F, 0x50, 0x9E, 0xD3, 0x42, 0xC1,
-    0x3E, 0x19, 0x80, 0x19, 0x63, 0x85, 0x39, 0x40, 0xC2, 0x22, 0x79, 0x2E, 0xC5, 0xD2, 0x0A, 0x61,
-    0x87, 0x7C, 0x6F, 0xED, 0x2C, 0x67, 0x4E, 0x33, 0xEE, 0x1E, 0x19, 0x09, 0x4D, 0xFA, 0x59, 0xB0,
-    0x9C, 0x8D, 0x5C, 0x7E, 0xE8, 0x88, 0x47, 0xD0, 0xEC, 0x4D, 0x20, 0x57, 0xA4, 0xB1, 0xD9, 0x3B,
-    0x7F, 0x55, 0x2E, 0xB1, 0x9A, 0x31, 0xD6, 0xE7, 0x86, 0xD4, 0x54, 0xED, 0x0C, 0xB1, 0xA2, 0x9A,
-    0xF6, 0x33, 0xDC, 0x0E, 0x61, 0xBD, 0x7F, 0xC1, 0xD3, 0xD9, 0x30, 0x03, 0x2C, 0xDA, 0x72, 0x65,
-    0xA7, 0xC5, 0x7D, 0xE4, 0xF2, 0x80, 0x74, 0xED, 0xF1, 0x05, 0xD8, 0xD4, 0x23, 0xAC, 0x23, 0xB7,
-    0xE3, 0x02, 0x39, 0x48, 0x2C, 0x28, 0xB5, 0xAA, 0x43, 0x45, 0x7F, 0x1F, 0xC9, 0x95, 0x0B, 0x43,
-    0x70, 0xA1, 0x57, 0x10, 0xCF, 0x5B, 0x2A, 0x7D, 0x59, 0x4D, 0xA9, 0x05, 0x98, 0x38, 0x8A, 0x45,
-    0x8B, 0xCC, 0xCA, 0x67, 0x3B, 0x8A, 0x6C, 0xB3, 0xF5, 0x57, 0x38, 0x67, 0xFE, 0x88, 0xC6, 0x0A,
-    0xD2, 0x19, 0xF4, 0x17, 0xA9, 0x8F, 0xAA, 0xAE, 0x2A, 0x44, 0x17, 0xCD, 0x1F, 0x9A, 0x71, 0x78,
-    0xCC, 0xC4, 0x65, 0xB8, 0xCA, 0x04, 0x94, 0x53, 0xEE, 0x92, 0xBB, 0xCE, 0x60, 0xDC, 0x4B, 0xCA,
-    0xA8, 0x82, 0xDB, 0x88, 0xBA, 0x63, 0x39, 0xEA, 0x3A, 0x64, 0x39, 0xAD, 0x4A, 0x6D, 0xB8, 0x76,
-    0x42, 0x4B, 0xE3, 0xD0, 0x43, 0x3F, 0xFF, 0xAE, 0xA6, 0xC8, 0x26, 0xE0, 0x69, 0x7E, 0x50, 0x18,
-    0xDF, 0xA0, 0xF6, 0xA7, 0x25, 0xA9, 0xB9, 0xDB, 0xCF, 0x82, 0xE4, 0x0C, 0xC6, 0x4B, 0x0F, 0x0C,
-    0x05, 0xEC, 0xDD, 0x92, 0x90, 0xD2, 0x67, 0x90, 0x3A, 0x7A, 0x67, 0xF1, 0x59, 0x81, 0xC8, 0x94,
-    0xF8, 0xAF, 0x64, 0x60, 0xBC, 0xD0, 0xD4, 0x64, 0x7B, 0x0F, 0x07, 0x2F, 0xB8, 0x36, 0x44, 0xB4,
-    0xC0, 0xF2, 0x5B, 0xC8, 0x82, 0x38, 0x6F, 0xAC, 0x74, 0x60, 0x30, 0x60, 0xE9, 0x3C, 0x9B, 0x1A,
-    0x04, 0x14, 0x1D, 0x03, 0x83, 0x1E, 0x5A, 0x55, 0x6D, 0xA2, 0xBD, 0xF3, 0x2F, 0x0A, 0xF7, 0x70,
-    0x8B, 0x2D, 0xC5, 0x56, 0xBD, 0xDF, 0x48, 0xE1, 0xDD, 0x12, 0x72, 0x8A, 0xF0, 0x5D, 0x4F, 0xE3,
-    0x5A, 0x95, 0xAA, 0x77, 0x16, 0x90, 0x7E, 0x26, 0x5A, 0xD1, 0xE9, 0xC4, 0xED, 0x0D, 0x52, 0xD0,
-    0x92, 0xE3, 0xE9, 0x77, 0xF9, 0xD1, 0xEC, 0x6B, 0x90, 0xD3, 0x75, 0x1E, 0x8A, 0xB8, 0xD8, 0xF1,
-    0x2C, 0x35, 0xC5, 0xC2, 0xD2, 0x66, 0x1D, 0x25, 0xF0, 0xAC, 0x8A, 0xC9, 0x40, 0xE6, 0x23, 0x3A,
-    0xE8, 0x69, 0xC6, 0xF1, 0x12, 0x77, 0x24, 0x54, 0x1C, 0x1E, 0xC4, 0x43, 0xB8, 0x01, 0xD5, 0x4C,
-    0x57, 0x94, 0x8C, 0x54, 0x15, 0x29, 0xA1, 0x2C, 0x50, 0x0C, 0x28, 0x33, 0x96, 0xD1, 0x40, 0xBE,
-    0x39, 0xBB, 0x84, 0xD4, 0xDA, 0x57, 0xD4, 0x02, 0x6C, 0x26, 0x48, 0x0B, 0x4A, 0x8F, 0x20, 0x94,
-    0x59, 0x44, 0x05, 0x26, 0x5F, 0x3B, 0x4C, 0xC1, 0xE7, 0xC8, 0xC5, 0x4E, 0x6D, 0xA8, 0xD0, 0x12,
-    0xD4, 0xDB, 0x0C, 0x48, 0x86, 0x06, 0x26, 0xB3, 0xF8, 0x11, 0x24, 0x5E, 0x44, 0x5A, 0x51, 0x25,
-    0xDC, 0x6B, 0xF2, 0xC1, 0x42, 0x70, 0x42, 0xF1, 0xD7, 0x0A, 0x6B, 0x45, 0x59, 0x4D, 0x34, 0xCA,
-    0xC2, 0xF3, 0x86, 0x0B, 0x1F, 0xB0, 0x52, 0x41, 0x17, 0x42, 0xFC, 0x8A, 0xD9, 0x07, 0x6C, 0xDC,
-    0x2E, 0x1C, 0xB7, 0x21, 0x90, 0x39, 0x57, 0x6C, 0xD4, 0x3E, 0xAB, 0x60, 0x10, 0x1B, 0xC2, 0xCA,
-    0x38, 0x68, 0x03, 0x04, 0x2B, 0xFB, 0x5B, 0x39, 0x16, 0xAF, 0x13, 0x3B, 0xA1, 0x2A, 0xF2, 0x06,
-    0x13, 0x95, 0xAB, 0xAE, 0x6D, 0xA8, 0x7E, 0x0E, 0x54, 0x39, 0xD6, 0x94, 0x80, 0x1D, 0x8A, 0x29,
-    0x46, 0x00, 0x5E, 0x22, 0xF5, 0xC6, 0xC9, 0x6E, 0x35, 0x19, 0xE8, 0x79, 0xD9, 0x3B, 0xED, 0xBD,
-    0x90, 0x1A, 0x68, 0xA5, 0x39, 0xC1, 0x7C, 0xA1, 0xC1, 0xC2, 0x24, 0xEE, 0xBE, 0xFF, 0xE3, 0xD8,
-    0x73, 0x0E, 0xF3, 0x94, 0xAC, 0x2A, 0x80, 0x41, 0x40, 0xBB, 0x94, 0x52, 0xE7, 0x19, 0xD9, 0x06,
-    0x6A, 0x29, 0xA8, 0x24, 0x8C, 0x6E, 0x83, 0xED, 0xF9, 0x7F, 0x24, 0x77, 0x95, 0x57, 0x35, 0xC8,
-    0xDF, 0x82, 0x3A, 0x7E, 0x82, 0x26, 0x83, 0xD7, 0x88, 0x29, 0x87, 0x79, 0x3B, 0xC5, 0x87, 0x31,
-    0x7D, 0x5A, 0xCE, 0x7B, 0x11, 0xE3, 0x88, 0x12, 0xAC, 0xD6, 0x02, 0x8F, 0xE7, 0x34, 0xD9, 0x89,
-    0x1C, 0x8E, 0x0F, 0x7A, 0xEC, 0xAC, 0x70, 0xBD, 0x01, 0xD6, 0x29, 0x85, 0xF9, 0x88, 0xCB, 0x60,
-    0x2D, 0x1E, 0x3E, 0x5A, 0x1D, 0xBB, 0xDE, 0x82, 0xA7, 0x2D, 0x01, 0xCB, 0xAE, 0x94, 0x8E, 0x5F,
-    0xC5, 0xB4, 0x38, 0x11, 0xA7, 0x27, 0x54, 0xE0, 0x52, 0xDC, 0x3D, 0x22, 0x1D, 0x3B, 0x23, 0x28,
-    0x0B, 0x5B, 0xF3, 0x15, 0x18, 0x07, 0x79, 0x15, 0x6F, 0xB8, 0x4B, 0x84, 0x41, 0x44, 0xC3, 0xE5,
-    0xBC, 0xFC, 0x40, 0xBF, 0x76, 0x9E, 0x60, 0x0F, 0xA4, 0xA9, 0xC3, 0xA5, 0x61, 0xB8, 0x4A, 0xEF,
-    0x4D, 0x69, 0xAF, 0x60, 0x27, 0x70, 0x97, 0xCD, 0x8C, 0x70, 0x75, 0xFE, 0x65, 0xA3, 0x49, 0x91,
-    0x06, 0xE4, 0x00, 0xB4, 0xF4, 0x3C, 0x58, 0x40, 0x3E, 0xCC, 0xBE, 0x96, 0x44, 0x04, 0x44, 0x2E,
-    0xE1, 0xBD, 0x8A, 0x19, 0xD0, 0x44, 0x35, 0xC8, 0x98, 0xAB, 0xE6, 0x51, 0x97, 0xFA, 0x6C, 0xCC,
-    0x9B, 0xCE, 0x7B, 0x17, 0x54, 0xCA, 0xCD, 0xC3, 0xB9, 0x90, 0x0F, 0x05, 0x5F, 0x0D, 0x36, 0x3C,
-    0x1D, 0x40, 0x24, 0xA4, 0xA3, 0x49, 0x1F, 0xB8, 0xA8, 0xF3, 0xEA, 0x50, 0xA8, 0x65, 0xBC, 0x1E,
-    0x62, 0xC5, 0x6E, 0x12, 0x33, 0x35, 0xDC, 0x1A, 0x8D, 0xDC, 0x32, 0x13, 0xE0, 0xD9, 0xCF, 0x5E,
-    0xA8, 0xC9, 0x12, 0x5A, 0xA0, 0x0D, 0xF1, 0xED, 0x3C, 0x4B, 0x96, 0x1C, 0x20, 0x4B, 0x86, 0x19,
-    0xF0, 0xCA, 0x6A, 0x54, 0x29, 0xF7, 0x4A, 0x67, 0x7C, 0x5D, 0xA4, 0xE0, 0xBE, 0x00, 0x0B, 0x48,
-    0x4F, 0x09, 0x15, 0x8E, 0xB6, 0x0F, 0x0E, 0x24, 0x47, 0x45, 0x52, 0xA2, 0x93, 0x9E, 0x40, 0x4A,
-    0xC8, 0x7F, 0x9A, 0x38, 0x42, 0x5E, 0x70, 0x8B, 0xEF, 0xEE, 0x3D, 0xA7, 0x28, 0x92, 0x14, 0x80,
-    0x18, 0xDA, 0x32, 0xA8, 0x89, 0x21, 0xEE, 0x4D, 0x08, 0x35, 0x1E, 0x65, 0x49, 0x80, 0xF8, 0x63,
-    0x59, 0x5B, 0x62, 0xB2, 0xF2, 0xAA, 0x57, 0x4E, 0x08, 0x3B, 0xD5, 0x5B, 0xE8, 0xE2, 0x7B, 0xCF,
-    0x5F, 0xA5, 0xF5, 0x68, 0x5D, 0x3D, 0x21, 0x02, 0x7D, 0x0E, 0xC6, 0x71, 0x81, 0x9A, 0x06, 0x5B,
-    0x73, 0xF4, 0x91, 0x51, 0xB8, 0x9A, 0x59, 0x5B, 0x15, 0x93, 0x46, 0x8D, 0x3A, 0x03, 0xEA, 0xB0,
-    0x55, 0x9F, 0x3E, 0x47, 0xB7, 0x79, 0x79, 0x40, 0x92, 0xE0, 0xC1, 0x21, 0x48, 0xE2, 0xB1, 0xBF,
-    0x43, 0x39, 0x3A, 0x6B, 0x5E, 0x18, 0x48, 0x06, 0xEC, 0x2E, 0xA4, 0x88, 0x99, 0x41, 0xE1, 0x6F,
-    0x0B, 0x19, 0x82, 0x88, 0xD7, 0x14, 0xA1, 0x02, 0xF7, 0xA2, 0x04, 0xBD, 0xE1, 0x72, 0xA8, 0xD4,
-    0xDF, 0xF6, 0xB4, 0x97, 0xA1, 0xE3, 0x1A, 0x07, 0x96, 0x01, 0x12, 0x87, 0x1A, 0x21, 0x53, 0xFA,
-    0x83, 0x7A, 0x0A, 0x5B, 0x74, 0x41, 0x5F, 0x31, 0x1F, 0x1F, 0x05, 0x56, 0x6A, 0x24, 0xB8, 0x4F,
-    0x6A, 0x21, 0x3A, 0xBD, 0xE3, 0xA2, 0x1B, 0x55, 0xB6, 0x4F, 0x1E, 0x19, 0x56, 0xD7, 0x2E, 0xDC,
-    0x5F, 0x4B, 0x2A, 0x00, 0x99, 0x83, 0x67, 0x31, 0x00, 0x9D, 0xF6, 0x9E, 0xBA, 0xBB, 0x7B, 0xDE,
-    0xE5, 0x63, 0xA4, 0x8C, 0x8B, 0x6A, 0x3A, 0xF3, 0x12, 0x61, 0x8F, 0x1C, 0xBF, 0x7B, 0x17, 0xA1,
-    0xCB, 0xE3, 0x51, 0xBD, 0xF2, 0x7A, 0xC1, 0xE6, 0xF4, 0x17, 0xF8, 0x12, 0x03, 0x39, 0x24, 0xB8,
-    0xCF, 0x1C, 0x22, 0xFF, 0x0D, 0xA2, 0xD1, 0x8C, 0x02, 0x93, 0xDA, 0xF1, 0xB5, 0x5E, 0x2E, 0xDC,
-    0x21, 0xDF, 0xD1, 0x9C, 0x2D, 0xD7, 0x04, 0x42, 0x75, 0x48, 0xA3, 0x7C, 0x8D, 0xE9, 0x7D, 0xC5,
-    0xA5, 0x9B, 0x83, 0x53, 0x44, 0x80, 0x7F, 0x5A, 0x0A, 0x55, 0xA8, 0x3E, 0x18, 0x7A, 0xAC, 0x1E,
-    0x1F, 0x3E, 0x69, 0xE9, 0x44, 0xCF, 0x9E, 0x03, 0xB7, 0x93, 0x8E, 0x29, 0xC3, 0x56, 0x6E, 0xF6,
-    0x0F, 0xCF, 0xCB, 0x5F, 0xD6, 0xBA, 0x9A, 0x13, 0xEC, 0x06, 0xAB, 0x07, 0x46, 0xE5, 0x59, 0x64,
-    0xCA, 0xE9, 0xD4, 0x33, 0xB3, 0x02, 0x34, 0xF4, 0xDD, 0xC8, 0x5B, 0xA3, 0x36, 0xA3, 0x21, 0x7D,
-    0xE2, 0x40, 0xFD, 0xE4, 0xB3, 0x20, 0xE6, 0xA7, 0x4C, 0xD4, 0xB6, 0xC2, 0x68, 0x54, 0x3A, 0x0A,
-    0x78, 0x74, 0x09, 0x85, 0x64, 0x45, 0x6B, 0xAC, 0x3E, 0x83, 0x53, 0x0F, 0x57, 0x88, 0x2C, 0xCF,
-    0x60, 0xE9, 0x12, 0x33, 0xE1, 0x53, 0xD7, 0xE4, 0xD6, 0xA1, 0xC3, 0x01, 0x5C, 0x6E, 0x2C, 0x4A,
-    0x20, 0xE3, 0x37, 0xDA, 0x49, 0xDB, 0xE4, 0xD4, 0x63, 0xC8, 0xD5, 0x42, 0x9F, 0x96, 0xD0, 0x69,
-    0xB6, 0xC8, 0x32, 0x2E, 0x2F, 0x16, 0xF1, 0x28, 0x93, 0xBB, 0x60, 0x45, 0x89, 0xCE, 0x4A, 0xD6,
-    0x10, 0x68, 0xDD, 0xE4, 0xD3, 0xA4, 0xE2, 0xE4, 0x43, 0x59, 0xF9, 0x8F, 0x3E, 0x67, 0x4E, 0x9B,
-    0xA8, 0x56, 0x7F, 0x1C, 0xF5, 0xF1, 0xCA, 0xB9, 0xE3, 0x84, 0xD9, 0xE1, 0xA1, 0xDE, 0x38, 0x1C,
-    0x83, 0xAB, 0xC0, 0x61, 0x50, 0x0E, 0xC5, 0xEB, 0xD4, 0xC2, 0xB0, 0x5A, 0x94, 0xB7, 0x64, 0xC9,
-    0x64, 0xD0, 0x45, 0x2C, 0xFB, 0x14, 0x4C, 0x78, 0x2A, 0x8A, 0xE7, 0xF8, 0x33, 0xBE, 0x86, 0x18,
-    0x1E, 0x9C, 0x89, 0x08, 0x3F, 0xD9, 0x13, 0xEF, 0xCD, 0x9E, 0x4D, 0x3C, 0x16, 0xB9, 0x93, 0xB8,
-    0xCF, 0xF4, 0xD0, 0xE2, 0xFE, 0x20, 0x73, 0x5C, 0xA8, 0xA4, 0xE2, 0xE4, 0x53, 0x52, 0x33, 0x67,
-    0xAF, 0x87, 0x3D, 0x3E, 0x6B, 0xC5, 0xC2, 0x05, 0xD6, 0x5D, 0xFB, 0xDA, 0xE0, 0x98, 0x11, 0x31,
-    0x83, 0x51, 0x3F, 0xE9, 0x52, 0x5B, 0xE5, 0x85, 0x66, 0xC1, 0xF9, 0x6A, 0x91, 0x9C, 0x4D, 0x19,
-    0xDC, 0x15, 0x46, 0x90, 0x85, 0x5D, 0x15, 0xB0, 0x64, 0x83, 0x72, 0x82, 0xA7, 0xF7, 0x4A, 0x5C,
-    0xE3, 0x26, 0x13, 0xD9, 0xA2, 0x54, 0x46, 0x68, 0x35, 0x8D, 0x36, 0x5D, 0x63, 0xE0, 0xD1, 0xF3,
-    0x21, 0x68, 0x1C, 0x69, 0xB4, 0x11, 0x34, 0x5F, 0xBC, 0x8A, 0x4A, 0x80, 0x3D, 0xAC, 0x6A, 0x95,
-    0x6C, 0x8E, 0xD7, 0xAA, 0x24, 0x19, 0xAC, 0x5C, 0xD6, 0x15, 0x03, 0x2A, 0x8B, 0x56, 0x75, 0x24,
-    0x12, 0x8B, 0xD7, 0x06, 0xCC, 0x26, 0xDE, 0x44, 0xE6, 0x4E, 0x15, 0x61, 0x59, 0x2D, 0xBA, 0x7B,
-    0x5D, 0xAE, 0xC9, 0x98, 0x95, 0x1A, 0x12, 0xDA, 0x51, 0x44, 0x22, 0x7B, 0x7B, 0x98, 0xBC, 0x94,
-    0xC0, 0xF0, 0x65, 0xD4, 0x8A, 0x72, 0xF7, 0x99, 0xD6, 0xE9, 0xC7, 0xC9, 0xB1, 0xFC, 0x78, 0x01,
-    0x7A, 0x68, 0x8A, 0x49, 0xCD, 0x4D, 0x86, 0x65, 0xB2, 0xAD, 0x0A, 0x58, 0xCE, 0x6B, 0x54, 0xCD,
-    0xCB, 0xEE, 0x2D, 0xA6, 0x69, 0x9D, 0x9D, 0xD1, 0x34, 0x3F, 0x43, 0x62, 0xA8, 0xB4, 0x8C, 0xFB,
-    0x98, 0xE8, 0x87, 0x07, 0xC2, 0x95, 0xA6, 0xFE, 0xA6, 0x7C, 0x6F, 0x5B, 0x10, 0xAA, 0x52, 0x0D,
-    0xDA, 0x00, 0x72, 0x6E, 0x00, 0x05, 0x32, 0x87, 0xF6, 0x4C, 0x6C, 0x62, 0x55, 0x93, 0x77, 0x12,
-    0x53, 0xCA, 0x69, 0x9A, 0x33, 0x2D, 0xE5, 0x5B, 0x4D, 0xB5, 0xEF, 0xD4, 0xDE, 0x9A, 0xA5, 0xEE,
-    0xBE, 0x51, 0xB9, 0xB3, 0x71, 0xC6, 0x8C, 0x4F, 0x15, 0x9E, 0x82, 0x66, 0x59, 0x97, 0xD6, 0x22,
-    0xAD, 0x46, 0x6E, 0xC8, 0xD1, 0x58, 0x20, 0xA5, 0x47, 0x09, 0xBB, 0xA4, 0xA4, 0xB1, 0x0B, 0x0F,
-    0xF2, 0x36, 0x90, 0xFC, 0xE3, 0xF8, 0x55, 0xCD, 0x95, 0x5A, 0xEA, 0xE6, 0x48, 0x97, 0x2B, 0x71,
-    0x10, 0x64, 0x14, 0xC7, 0xB4, 0x64, 0x33, 0xD2, 0xB0, 0x8A, 0x55, 0x42, 0x96, 0xEA, 0x8E, 0x59,
-    0xF2, 0x15, 0x15, 0x23, 0x31, 0xCF, 0x48, 0x5E, 0x85, 0xFB, 0x96, 0x76, 0x2E, 0x1E, 0xCF, 0x9F,
-    0xDF, 0xE9, 0x19, 0x6C, 0x3A, 0xEB, 0xC4, 0x5C, 0x84, 0x22, 0x3C, 0x1F, 0xB3, 0xE4, 0x8B, 0xF0,
-    0x09, 0x95, 0xE6, 0xAA, 0x43, 0x89, 0x31, 0x44, 0x8C, 0xC6, 0x9A, 0x0A, 0xD8, 0x27, 0xE9, 0x5A,
-    0xD3, 0x69, 0x39, 0xCE, 0x3C, 0xE5, 0x23, 0xB0, 0x18, 0xBC, 0xBC, 0x94, 0xC3, 0xAD, 0xA4, 0xA8,
-    0x51, 0x1E, 0x77, 0xE9, 0x64, 0xE1, 0x53, 0xC9, 0x07, 0xBE, 0xFB, 0x67, 0x58, 0xD4, 0x46, 0x17,
-    0x50, 0xC6, 0x63, 0xB9, 0x15, 0xF6, 0x06, 0x1B, 0x21, 0x2F, 0xEA, 0x90, 0x27, 0x97, 0x02, 0xC1,
-    0x45, 0x61, 0x5A, 0x84, 0xBA, 0x42, 0x5A, 0xCB, 0xBB, 0x4B, 0x72, 0xD3, 0x68, 0x9D, 0xA0, 0xA0,
-    0x2F, 0x64, 0x37, 0xB0, 0x71, 0x1B, 0x11, 0x01, 0xC4, 0x7B, 0x08, 0x45, 0xF0, 0xB1, 0x15, 0xAD,
-    0x1A, 0xA2, 0x93, 0x51, 0x8F, 0x1D, 0x00, 0x0F, 0x62, 0x1F, 0x7B, 0xF0, 0x08, 0x83, 0xED, 0x52,
-    0x05, 0x20, 0x1F, 0xAF, 0x5D, 0x6B, 0x36, 0x14, 0x31, 0x04, 0x2E, 0x0A, 0xA8, 0xCA, 0x7C, 0xAE,
-    0xD6, 0x5C, 0xC1, 0x8B, 0xED, 0x94, 0xE0, 0x61, 0xED, 0x3F, 0x93, 0xBC, 0xDB, 0xC4, 0x82, 0x46,
-    0xB6, 0xA1, 0x73, 0x69, 0xE8, 0x0F, 0x22, 0x05, 0x34, 0x1B, 0x10, 0xF5, 0x19, 0x14, 0x2A, 0x59,
-    0xF1, 0x62, 0x2C, 0x9C, 0x02, 0xC3, 0xDD, 0x6F, 0xD1, 0x8E, 0xA0, 0x06, 0x54, 0x1E, 0x3C, 0x77,
-    0x71, 0x47, 0x3C, 0xCE, 0xFB, 0x22, 0x55, 0x0C, 0x14, 0xAB, 0xB7, 0xD3, 0x4E, 0xF8, 0x98, 0xD5,
-    0x29, 0x1C, 0x6F, 0x25, 0xD1, 0x8A, 0x70, 0x3F, 0x6E, 0x53, 0x78, 0x68, 0x89, 0xDC, 0x36, 0x78,
-    0xD7, 0x49, 0xDC, 0x56, 0x94, 0x0D, 0x6A, 0xFB, 0xE2, 0x7B, 0xE0, 0xA4, 0x8A, 0xBA, 0xA9, 0x19,
-    0xB0, 0x9D, 0x83, 0xEB, 0x0B, 0x5A, 0xB3, 0x5E, 0xF5, 0xE6, 0x82, 0x2C, 0xE6, 0xE9, 0x70, 0x73,
-    0x44, 0x5F, 0x08, 0x16, 0x80, 0x79, 0x00, 0xB4, 0x13, 0x99, 0x2E, 0x2B, 0x24, 0x6B, 0x17, 0xEF,
-    0x35, 0xCE, 0x71, 0xB0, 0x98, 0xDD, 0x3B, 0x73, 0x32, 0xBA, 0xBA, 0x1A, 0xCB, 0x26, 0xEE, 0x20,
-    0xCD, 0xA9, 0x2D, 0x55, 0x69, 0x81, 0x0C, 0x0A, 0x04, 0x90, 0x18, 0x06, 0x72, 0x12, 0xC0, 0x75,
-    0xD9, 0x1B, 0x4F, 0x46, 0x6F, 0xDD, 0x6E, 0x2F, 0xA4, 0xEB, 0xB8, 0xFC, 0xE2, 0x41, 0x87, 0x27,
-    0x0B, 0x39, 0xA3, 0x22, 0xF3, 0x26, 0xB2, 0x57, 0xB6, 0x3C, 0x72, 0x2D, 0xB8, 0x9F, 0xD1, 0x9E,
-    0xC4, 0x40, 0x0B, 0x0E, 0x72, 0x84, 0xDF, 0x58, 0x5F, 0xE5, 0x14, 0xA9, 0x14, 0x83, 0xC4, 0x52,
-    0x48, 0xCB, 0x56, 0xE3, 0x21, 0x0F, 0x10, 0xC1, 0xC5, 0x63, 0xE1, 0x10, 0x08, 0x92, 0x46, 0xBB,
-    0xB2, 0x75, 0x49, 0x03, 0x33, 0xA8, 0xC2, 0x17, 0x96, 0xA7, 0xD3, 0xA3, 0xAB, 0xAF, 0xD1, 0xE8,
-    0x40, 0xAE, 0x78, 0x19, 0x50, 0x45, 0x0B, 0x0B, 0x9A, 0xF3, 0xDE, 0xE9, 0x7D, 0xB5, 0xD2, 0x64,
-    0x89, 0x49, 0x8E, 0x30, 0xFC, 0x9F, 0xB4, 0x7E, 0xB4, 0xDF, 0xB3, 0xD4, 0xA4, 0x09, 0x14, 0x82,
-    0x2E, 0xF7, 0x27, 0x48, 0x3F, 0xAB, 0x65, 0x1A, 0xD4, 0x5E, 0x0A, 0x4D, 0x83, 0xE0, 0x87, 0x21,
-    0xDE, 0x5B, 0x9F, 0x0F, 0x99, 0xFC, 0x32, 0x17, 0x22, 0xEB, 0x40, 0xB8, 0x25, 0xC1, 0x3D, 0xB8,
-    0x62, 0xC9, 0x4A, 0x08, 0x80, 0x30, 0x10, 0xCB, 0x13, 0x2A, 0x90, 0x50, 0x35, 0x24, 0x01, 0xDC,
-    0x15, 0x56, 0x45, 0xFA, 0x35, 0x18, 0x50, 0x91, 0xEE, 0x14, 0x65, 0xB7, 0x12, 0x46, 0x10, 0x0B,
-    0x97, 0xE8, 0x51, 0x0C, 0x55, 0xD8, 0x31, 0x1B, 0x81, 0x5F, 0xD1, 0x5C, 0x44, 0xA2, 0x32, 0xB9,
-    0x2E, 0x22, 0xA2, 0xAD, 0xB7, 0xE1, 0xF3, 0xE3, 0x1C, 0x17, 0x2C, 0xBC, 0x92, 0xA5, 0x83, 0x7F,
-    0x6B, 0x7E, 0x39, 0xA7, 0x54, 0x8B, 0x8D, 0x45, 0x55, 0x73, 0x20, 0x21, 0x92, 0xC3, 0xC9, 0x55,
-    0x04, 0x54, 0x48, 0x94, 0x64, 0x02, 0xAF, 0x33, 0x8D, 0x01, 0x78, 0x37, 0xBD, 0x1C, 0x76, 0xCB,
-    0xC5, 0x37, 0xED, 0xA1, 0x2C, 0xC4, 0x69, 0x61, 0x60, 0x32, 0xD1, 0x06, 0x64, 0x84, 0x77, 0xA1,
-    0xD2, 0x1C, 0xCD, 0xC7, 0x47, 0x32, 0xCD, 0x43, 0x35, 0x90, 0x61, 0xB8, 0x25, 0x4A, 0xBB, 0x4A,
-    0xB3, 0xF0, 0xCA, 0xB1, 0xEA, 0x94, 0x30, 0xE1, 0xA2, 0x08, 0xDE, 0xDA, 0xF4, 0x61, 0x1F, 0xAD,
-    0xA2, 0x2E, 0x11, 0x7D, 0x4B, 0xDB, 0xBC, 0x2E, 0xCA, 0xA2, 0xAC, 0x68, 0x7F, 0x63, 0xC6, 0x5C,
-    0x22, 0xDB, 0x15, 0x2C, 0xAD, 0x5C, 0x16, 0x66, 0xA5, 0x77, 0x26, 0xD9, 0x62, 0x19, 0x72, 0x20,
-    0xE6, 0x81, 0xBC, 0x55, 0xB3, 0x2D, 0x07, 0x64, 0x3D, 0xD3, 0x01, 0xCB, 0x28, 0x9A, 0xF6, 0x4B,
-    0x16, 0x86, 0xB2, 0x60, 0x89, 0x03, 0x03, 0xDE, 0xC9, 0xA5, 0x1B, 0x56, 0x5C, 0x07, 0x20, 0x8D,
-    0x03, 0x6B, 0xA8, 0x63, 0xD3, 0xE2, 0x80, 0x05, 0x7A, 0x62, 0x6E, 0xE4, 0xC0, 0xCE, 0x4A, 0xDD,
-    0x39, 0x52, 0xF6, 0x20, 0xB6, 0xCC, 0x6D, 0xB5, 0x9D, 0xD2, 0xFA, 0x96, 0x70, 0x46, 0xCF, 0x59,
-    0xBD, 0xBD, 0xC8, 0x74, 0x34, 0x87, 0xA3, 0x7E, 0x17, 0x25, 0xA4, 0x00, 0xCD, 0xDB, 0xDE, 0x47,
-    0xC2, 0x2E, 0xA4, 0x0B, 0xC7, 0x7B, 0xD9, 0x6B, 0xA6, 0x8E, 0x17, 0x34, 0x32, 0xAD, 0x69, 0xB8,
-    0x2E, 0x91, 0xD9, 0xF3, 0x31, 0xA4, 0xAF, 0x67, 0x98, 0x85, 0xE1, 0x98, 0x96, 0xB5, 0xCF, 0x4C,
-    0xC7, 0x10, 0x23, 0xB5, 0x14, 0xF4, 0x82, 0x65, 0x43, 0xE8, 0x2F, 0x8E, 0x69, 0xA3, 0x11, 0xA2,
-    0x7D, 0x96, 0x62, 0xE1, 0x96, 0x9A, 0xB4, 0x8B, 0xEE, 0xA2, 0x86, 0x9F, 0x6E, 0x7D, 0x56, 0xD3,
-    0x51, 0xED, 0xAA, 0x54, 0xBF, 0xDA, 0xEF, 0x4B, 0x17, 0xD1, 0x2A, 0x9D, 0x94, 0xC9, 0x9E, 0xD5,
-    0xCC, 0xBA, 0x67, 0x39, 0xFC, 0x89, 0x7D, 0x19, 0xB2, 0x0F, 0x47, 0x34, 0x88, 0x50, 0x40, 0xE3,
-    0x45, 0x2B, 0x41, 0x61, 0x49, 0x17, 0x75, 0xF5, 0x62, 0xD1, 0xB2, 0xD1, 0x7E, 0x82, 0x46, 0x32,
-    0x76, 0xEE, 0x36, 0x2C, 0x2F, 0xA6, 0x79, 0x50, 0xB2, 0x5E, 0x5C, 0x4C, 0x1B, 0x39, 0xDD, 0x5C,
-    0x4C, 0x2C, 0xE6, 0xCB, 0x70, 0x35, 0x8F, 0x24, 0x23, 0xC9, 0x53, 0x16, 0xB2, 0xB1, 0x45, 0x52,
-    0x0B, 0x9A, 0x8F, 0x62, 0x7F, 0x17, 0x3C, 0xAC, 0xE7, 0xA2, 0x91, 0xAE, 0x39, 0xDB, 0x61, 0xAA,
-    0x01, 0x05, 0xBE, 0x4F, 0x73, 0x30, 0x2D, 0xE7, 0x36, 0x6D, 0xB1, 0x00, 0x58, 0xFB, 0xDE, 0x37,
-    0xE6, 0x52, 0xB0, 0x72, 0x41, 0x3B, 0x9C, 0x91, 0x82, 0xDA, 0xCD, 0x6C, 0x49, 0xEB, 0xF9, 0x62,
-    0xF9, 0x3D, 0x97, 0x19, 0xA6, 0x26, 0xD6, 0xF1, 0x86, 0xBE, 0x8D, 0x19, 0x58, 0xB1, 0x4F, 0xAC,
-    0x24, 0xB8, 0xEC, 0xC1, 0x6E, 0x0B, 0xBB, 0x02, 0x80, 0xC4, 0x8B, 0xD5, 0xA2, 0xBC, 0x1C, 0x0D,
-    0x58, 0x81, 0xD1, 0xC5, 0xD7, 0xE1, 0x4B, 0x06, 0x60, 0x9D, 0xFE, 0x12, 0x98, 0x56, 0x12, 0x9E,
-    0x20, 0x88, 0x9E, 0x98, 0x5F, 0x59, 0x86, 0xBE, 0x7A, 0x0B, 0xAD, 0x20, 0xF3, 0x13, 0xAC, 0xDA,
-    0xFF, 0x37, 0x7B, 0x8C, 0x3F, 0x10, 0xFB, 0x16, 0x6D, 0x53, 0xDC, 0xA5, 0xCF, 0xA1, 0xE9, 0xB5,
-    0x2C, 0x43, 0x04, 0xBF, 0xD9, 0xA2, 0x9F, 0x21, 0x18, 0x8B, 0xA6, 0xD9, 0x03, 0x7E, 0x31, 0xDB,
-    0x4C, 0x8D, 0x3A, 0x4D, 0x17, 0x35, 0x75, 0x24, 0xFC, 0x2A, 0x1D, 0x5A, 0xEC, 0x3B, 0xA0, 0x26,
-    0x40, 0x0C, 0x8C, 0x88, 0xB4, 0x9F, 0x40, 0x61, 0xC7, 0x7F, 0x74, 0xCE, 0x72, 0x8E, 0x51, 0x6C,
-    0xCC, 0xAE, 0x48, 0xFB, 0x0D, 0x11, 0xF5, 0x01, 0x46, 0x14, 0x66, 0xB7, 0x63, 0x07, 0x36, 0x96,
-    0xD7, 0xE4, 0x8E, 0xE8, 0xC2, 0xCF, 0xC5, 0xF5, 0xDF, 0x1E, 0x4D, 0xFE, 0x96, 0x95, 0x20, 0xC8,
-    0x76, 0x82, 0x49, 0xDF, 0x98, 0x62, 0xB8, 0xAF, 0x0D, 0x44, 0xC0, 0xC6, 0x30, 0xBD, 0x53, 0x3B,
-    0x69, 0x75, 0x49, 0x10, 0xBC, 0xA9, 0x02, 0xF9, 0x78, 0x70, 0x2E, 0xEA, 0x6E, 0x98, 0xD3, 0x99,
-    0x49, 0xBE, 0x2F, 0xC9, 0xA2, 0x44, 0x7E, 0xA2, 0x77, 0x12, 0xD8, 0xCA, 0xF7, 0x62, 0x35, 0xAF,
-    0x92, 0x4E, 0x06, 0xBF, 0x95, 0xE0, 0x47, 0x82, 0xA2, 0xCE, 0x9A, 0x8B, 0xE9, 0x26, 0x6D, 0x01,
-    0xB3, 0xF9, 0xBC, 0xAF, 0x4B, 0xAD, 0x9C, 0x5C, 0x40, 0x66, 0xA2, 0xFB, 0xCF, 0xEC, 0xDC, 0xE3,
-    0x35, 0xE3, 0xC9, 0x6B, 0xAE, 0xDC, 0xE9, 0xDC, 0x3B, 0x4B, 0xE8, 0x39, 0xFD, 0x97, 0x75, 0xA7,
-    0x83, 0xE9, 0x34, 0x16, 0x8D, 0x12, 0x55, 0xE2, 0x4F, 0x67, 0x77, 0x5F, 0xB3, 0x6F, 0x21, 0xEB,
-    0x40, 0x36, 0xFD, 0x75, 0x04, 0x64, 0xAE, 0x50, 0xC7, 0x40, 0xF4, 0xB4, 0xBA, 0xC8, 0xD0, 0x79,
-    0xCC, 0xFB, 0x0D, 0x1D, 0x9C, 0x5B, 0x70, 0x65, 0xC5, 0x8C, 0x7D, 0xE6, 0x48, 0xA9, 0x0A, 0xB0,
-    0xEB, 0xC8, 0x1B, 0xB4, 0x33, 0x1F, 0xBA, 0x8F, 0x63, 0x89, 0xF0, 0xB8, 0xFB, 0x98, 0x58, 0xAA,
-    0x10, 0xE3, 0x7F, 0x45, 0xC1, 0x78, 0xF5, 0xF0, 0x70, 0x61, 0xB5, 0xC0, 0x25, 0x9A, 0x70, 0xF9,
-    0x9D, 0x09, 0x3F, 0xF8, 0xB0, 0x6E, 0x46, 0x84, 0x09, 0x20, 0x24, 0x81, 0x6A, 0x67, 0x5D, 0xB2,
-    0x14, 0xCF, 0x92, 0xF3, 0x79, 0x2A, 0xE7, 0x00, 0x22, 0x85, 0x46, 0x21, 0x31, 0x5E, 0x01, 0x8F,
-    0x14, 0xA3, 0x31, 0x10, 0xCF, 0x82, 0x50, 0xDC, 0xE4, 0x47, 0x06, 0xD8, 0x66, 0xF9, 0x88, 0x7E,
-    0x0A, 0x33, 0x2B, 0x28, 0x5D, 0xD6, 0xD9, 0x81, 0xF8, 0xA5, 0x62, 0xC0, 0x8B, 0x62, 0x32, 0xD3,
-    0x8D, 0x0D, 0x2C, 0x5C, 0xEE, 0x24, 0xE4, 0x55, 0x5F, 0xB6, 0xA5, 0x8D, 0x1B, 0xBD, 0x4D, 0x76,
-    0xEF, 0x12, 0x34, 0x14, 0xCF, 0x08, 0x36, 0x21, 0x86, 0x80, 0x24, 0x59, 0xDE, 0xC8, 0xE2, 0xF8,
-    0xAE, 0xF1, 0x46, 0x93, 0x16, 0xF2, 0x3E, 0xEF, 0x06, 0x07, 0x0F, 0xCA, 0xCD, 0x23, 0x6B, 0xB8,
-    0x1C, 0x27, 0xF0, 0xF8, 0x44, 0xAD, 0x39, 0x51, 0xDE, 0x10, 0xAE, 0x63, 0xC2, 0x45, 0x78, 0x1F,
-    0xAF, 0x84, 0xB6, 0x9B, 0xE8, 0xF2, 0xB5, 0x6E, 0xF4, 0x62, 0xAA, 0x4C, 0xEF, 0x7A, 0x6B, 0xC6,
-    0x4B, 0xD6, 0xAE, 0xF9, 0x5A, 0xF8, 0x85, 0xDF, 0xF2, 0x75, 0x02, 0x7F, 0x9A, 0x04, 0x14, 0x2C,
-    0x36, 0xAF, 0xBC, 0x00, 0x90, 0xC5, 0x8C, 0x8E, 0x29, 0x02, 0x5C, 0x2B, 0x85, 0x5F, 0x58, 0x89,
-    0xDE, 0xA9, 0x9C, 0x92, 0x18, 0x5E, 0x72, 0x81, 0x56, 0x58, 0x51, 0xB4, 0xA2, 0x97, 0xAC, 0x9F,
-    0x56, 0x93, 0xCB, 0x18, 0x8D, 0x13, 0x84, 0x7B, 0xBF, 0xEF, 0x3C, 0x06, 0x89, 0x45, 0xCE, 0x51,
-    0xB3, 0xB0, 0x5A, 0xB8, 0x39, 0x1D, 0x3B, 0xF7, 0xF2, 0x26, 0x99, 0x5D, 0xCA, 0x6B, 0xB9, 0x2B,
-    0xA4, 0x8C, 0x82, 0xC1, 0xD6, 0x5C, 0x12, 0xEE, 0x0C, 0x72, 0x7F, 0x27, 0xE2, 0x93, 0x8D, 0x5A,
-    0x68, 0x04, 0xFE, 0xE7, 0xAE, 0x1F, 0xBD, 0x5F, 0xC4, 0xDD, 0xE3, 0x53, 0xCB, 0x09, 0x02, 0x17,
-    0xBC, 0x4E, 0x43, 0x2A, 0x73, 0x81, 0xDC, 0x45, 0x71, 0xE1, 0x2B, 0xE1, 0xDA, 0x15, 0x7D, 0x7B,
-    0xFF, 0xB1, 0xA4, 0xF7, 0x1F, 0x4B, 0x57, 0xB7, 0xBC, 0x37, 0xFA, 0x89, 0x37, 0x54, 0xF9, 0xBF,
-    0x78, 0xD3, 0x52, 0xFC, 0xBD, 0x57, 0xE4, 0xD9, 0x61, 0x54, 0x93, 0x85, 0x9E, 0xCB, 0xC9, 0xB6,
-    0x9D, 0xAA, 0x04, 0xD3, 0xDA, 0x26, 0x71, 0x8F, 0x37, 0x4B, 0x2B, 0x69, 0x16, 0xD3, 0x29, 0xFC,
-    0x82, 0xBF, 0x57, 0x3C, 0x0D, 0xDA, 0x64, 0xD3, 0xE5, 0x2A, 0x5F, 0xD7, 0x0A, 0xB6, 0xD5, 0xAF,
-    0xAF, 0xF3, 0xDA, 0xF1, 0xBA, 0x71, 0x3D, 0xBC, 0xAC, 0xD3, 0x6E, 0x2A, 0xF4, 0xD5, 0xB5, 0x50,
-    0x82, 0xD1, 0x37, 0x53, 0xE6, 0x9B, 0xA6, 0xAB, 0x65, 0xAE, 0x61, 0xE6, 0x99, 0xB2, 0xC5, 0x1C,
-    0xC4, 0xE4, 0x3F, 0xEF, 0x2D, 0x81, 0xBB, 0x0A, 0x41, 0xDC, 0xCD, 0xC5, 0x2A, 0x15, 0xC1, 0x19,
-    0x6B, 0xF5, 0xDD, 0x94, 0xE1, 0xC9, 0x6F, 0xAB, 0xDF, 0x55, 0x29, 0x9F, 0x18, 0xE5, 0x06, 0x01,
-    0x62, 0x5D, 0x51, 0xF2, 0xE3, 0xEB, 0x48, 0xE7, 0x76, 0xD0, 0x0B, 0xFE, 0x16, 0x9B, 0x9D, 0x27,
-    0xC7, 0xCB, 0xFB, 0x2F, 0xB9, 0xFF, 0xCA, 0x8E, 0xA1, 0xCE, 0x45, 0x5A, 0x37, 0x1A, 0xE4, 0x31,
-    0xFD, 0x8C, 0x59, 0x8E, 0x74, 0xF4, 0x66, 0x0E, 0x16, 0x7C, 0xF8, 0x96, 0x3D, 0xC4, 0xF4, 0x4C,
-    0xA0, 0x21, 0x39, 0x54, 0xDB, 0x32, 0x97, 0x41, 0xDB, 0x3D, 0xE9, 0xE9, 0x1D, 0x51, 0x75, 0xC1,
-    0x7C, 0xCB, 0x4A, 0x78, 0xA5, 0x23, 0x09, 0x22, 0x01, 0x45, 0x4B, 0x7F, 0x2F, 0xF1, 0x57, 0xF6,
-    0x1B, 0x46, 0xC7, 0xF9, 0xBF, 0x6E, 0xA0, 0x4E, 0xC5, 0xED, 0x01, 0x21, 0x58, 0x75, 0x7B, 0x40,
-    0x0C, 0xD6, 0x7C, 0x6F, 0xE0, 0x25, 0xBF, 0xB6, 0x8D, 0x71, 0xC9, 0x60, 0x4C, 0xE0, 0x70, 0x8D,
-    0xC5, 0x25, 0x47, 0x63, 0x25, 0x9E, 0x93, 0xE4, 0xDD, 0xA2, 0x02, 0x26, 0x51, 0x80, 0x30, 0x3D,
-    0x1D, 0xD8, 0x64, 0x10, 0xEF, 0x8F, 0x48, 0xAB, 0x40, 0xA3, 0x86, 0x0E, 0x16, 0x61, 0x83, 0x84,
-    0x31, 0xB9, 0x53, 0x87, 0x2F, 0xF8, 0x81, 0x3C, 0x0E, 0x26, 0x44, 0xAD, 0x8F, 0x86, 0xF2, 0x07,
-    0x92, 0x28, 0x9E, 0xE8, 0xA9, 0x9D, 0xD1, 0x75, 0x98, 0x8B, 0xB5, 0x78, 0x85, 0x0A, 0x33, 0x9C,
-    0x23, 0x70, 0x42, 0x35, 0x31, 0x60, 0x49, 0x51, 0xFC, 0x33, 0x9E, 0xF2, 0x5A, 0x2C, 0x10, 0x03,
-    0xA4, 0x0A, 0x94, 0x37, 0xC8, 0x1C, 0x2C, 0xA8, 0x1E, 0x51, 0x6A, 0xDC, 0x22, 0x66, 0xD9, 0xCE,
-    0xA5, 0xA3, 0x6A, 0x09, 0x9D, 0x39, 0x14, 0xBA, 0xEE, 0x08, 0xE8, 0x36, 0x1F, 0x3E, 0x74, 0x07,
-    0x1D, 0x97, 0xAF, 0xF0, 0xF9, 0x42, 0x99, 0xA3, 0xCA, 0xE9, 0x91, 0xCB, 0x49, 0x9C, 0x47, 0x39,
-    0x50, 0x6D, 0x16, 0x40, 0x83, 0xFF, 0xD0, 0x79, 0x52, 0x09, 0xE0, 0xBE, 0x3A, 0x10, 0x4E, 0x21,
-    0xF5, 0x06, 0xD1, 0x14, 0x78, 0x07, 0x82, 0x59, 0x94, 0xE1, 0x86, 0x58, 0x5A, 0xB1, 0x44, 0x80,
-    0x32, 0x44, 0xDC, 0x07, 0x24, 0x91, 0x6D, 0x75, 0x33, 0x90, 0xBC, 0xEF, 0xD6, 0xAD, 0x2B, 0x5D,
-    0x3A, 0xD4, 0xC4, 0x3B, 0xD4, 0xE2, 0xDE, 0xE0, 0xE7, 0xB4, 0x4E, 0x46, 0xA6, 0x1A, 0x2C, 0xC7,
-    0x3F, 0xDF, 0x97, 0x3E, 0x39, 0x35, 0x7F, 0xE0, 0x08, 0xCE, 0xC7, 0x89, 0x7F, 0x2F, 0xA1, 0x69,
-    0x76, 0x9A, 0x45, 0x99, 0xBF, 0x40, 0xA0, 0x61, 0xBD, 0xC5, 0x0D, 0xFA, 0xDF, 0xB7, 0xE8, 0x9F,
-    0xF5, 0xD6, 0x8E, 0x25, 0x2D, 0xBA, 0x6B, 0xA6, 0x67, 0x67, 0x1F, 0x7E, 0xF0, 0xF4, 0x71, 0xF9,
-    0xF2, 0xBB, 0x0C, 0xBF, 0xD1, 0x85, 0x1F, 0xBF, 0xCA, 0xD2, 0x20, 0xC7, 0x9D, 0x38, 0x92, 0x33,
-    0xC0, 0x1D, 0x8A, 0xCB, 0x16, 0xF9, 0x91, 0x95, 0xC8, 0xC2, 0x1A, 0x3C, 0x49, 0x26, 0xDF, 0xCB,
-    0x22, 0x92, 0x1E, 0x62, 0xB4, 0x62, 0xC2, 0x2E, 0x7E, 0x35, 0xEF, 0x44, 0x46, 0x34, 0x25, 0xFC,
-    0xA8, 0x33, 0xB4, 0xD8, 0xA7, 0x90, 0x2E, 0xB1, 0x70, 0xDE, 0x55, 0x5D, 0xEB, 0x0E, 0x5D, 0x62,
-    0xA4, 0xEE, 0x2E, 0xD1, 0x3E, 0xC4, 0xB1, 0x0F, 0x43, 0xE9, 0x98, 0xD7, 0xA1, 0x84, 0x67, 0x9D,
-    0x1F, 0x9E, 0xEE, 0x82, 0xA7, 0x2F, 0xD1, 0x39, 0x19, 0x1D, 0x13, 0xD2, 0x54, 0xFD, 0xB0, 0xD1,
-    0x0E, 0x7E, 0x22, 0xD1, 0x61, 0xD2, 0xCA, 0x36, 0x16, 0x56, 0xA5, 0x43, 0xBD, 0x1A, 0xF9, 0x3F,
-    0x32, 0x9C, 0x35, 0x15, 0x99, 0xE3, 0x49, 0x2B, 0x26, 0xED, 0x5A, 0x74, 0x41, 0x78, 0xB6, 0x65,
-    0xC5, 0x89, 0x41, 0xA5, 0xBC, 0xAC, 0x19, 0xAF, 0xBB, 0xB0, 0x95, 0x11, 0x98, 0x48, 0x22, 0x13,
-    0x4D, 0xF5, 0xE8, 0x56, 0x4B, 0x9C, 0x5B, 0xAE, 0x3B, 0x43, 0x95, 0xF6, 0xDC, 0xA7, 0xDD, 0x0C,
-    0x81, 0x80, 0x97, 0xD8, 0x69, 0x4E, 0x50, 0x30, 0xF7, 0x41, 0x41, 0xA5, 0x1B, 0x1D, 0x8E, 0xDB,
-    0x7D, 0xE3, 0xF9, 0xCF, 0xBF, 0xC6, 0x86, 0xF4, 0xD6, 0x1C, 0xBF, 0x76, 0xE5, 0xB9, 0x23, 0xDB,
-    0xDF, 0x08, 0xD4, 0x10, 0x75, 0x54, 0xBF, 0x96, 0x0B, 0xA3, 0x20, 0x1C, 0xA1, 0x94, 0x82, 0x26,
-    0x38, 0x8A, 0xC1, 0x82, 0x7C, 0xA9, 0xF3, 0xDD, 0x79, 0x59, 0xC0, 0x7F, 0x4B, 0x10, 0x27, 0xDA,
-    0xF2, 0xCE, 0x8B, 0x83, 0xB6, 0xFF, 0x38, 0x29, 0x12, 0x93, 0xA1, 0xAE, 0x55, 0x71, 0xDA, 0xC4,
-    0x25, 0x5F, 0x52, 0x75, 0xF8, 0xBB, 0x66, 0x2A, 0x1F, 0xB9, 0x76, 0xA4, 0x09, 0x5E, 0x3D, 0x7A,
-    0xA6, 0xE6, 0xE3, 0x08, 0x3C, 0x1B, 0xE0, 0x3D, 0x72, 0xC7, 0x35, 0x42, 0x67, 0x7E, 0xA6, 0xFA,
-    0x00, 0x93, 0x44, 0xFF, 0xF7, 0xCC, 0xF8, 0x33, 0xFE, 0x43, 0x5C, 0xC7, 0xFC, 0xB2, 0x76, 0x83,
-    0x95, 0xD4, 0x8F, 0x2F, 0x96, 0xF8, 0x77, 0xE4, 0x78, 0x2C, 0x39, 0xD6, 0x50, 0x55, 0x02, 0x3B,
-    0xB2, 0x29, 0xA5, 0x8C, 0x08, 0xD0, 0x5B, 0xEC, 0x59, 0xBA, 0x80, 0xCE, 0xE1, 0x03, 0x4D, 0xED,
-    0x39, 0x51, 0x68, 0xEA, 0xC9, 0xD4, 0x6A, 0xEB, 0x06, 0xA4, 0x4B, 0xC7, 0x0A, 0xA6, 0x34, 0x89,
-    0x4B, 0xC7, 0xD6, 0x5C, 0x52, 0x30, 0x78, 0x5E, 0xE8, 0xC0, 0x7A, 0x69, 0x78, 0x03, 0x59, 0xE8,
-    0xB6, 0x7C, 0x51, 0x47, 0x4C, 0xB4, 0xC9, 0x39, 0x8F, 0x3D, 0xAE, 0xCD, 0x34, 0x01, 0xE2, 0xB8,
-    0x11, 0x34, 0xFB, 0x3B, 0x9B, 0x1B, 0xC3, 0xBD, 0x09, 0xB8, 0xE3, 0x96, 0xB5, 0xC8, 0x0E, 0xFF,
-    0x7E, 0x68, 0xF0, 0xEF, 0x61, 0xC6, 0xBA, 0x36, 0xC6, 0x71, 0x23, 0xB0, 0xA2, 0x51, 0x22, 0x4A,
-    0x08, 0x7E, 0x07, 0x26, 0xAE, 0xCC, 0x6D, 0xC9, 0x82, 0x80, 0xE5, 0x67, 0xF1, 0x36, 0x92, 0x8A,
-    0xF0, 0x00, 0xBA, 0x49, 0x92, 0xE0, 0x8E, 0xE7, 0x9B, 0xD6, 0xB5, 0xFC, 0x74, 0x9A, 0x4A, 0x55,
-    0x20, 0xF1, 0x4B, 0xDC, 0xC1, 0xE4, 0xF4, 0xE3, 0x25, 0xA1, 0xB5, 0xAE, 0xE1, 0xD7, 0x68, 0x43,
-    0x28, 0xDB, 0xB2, 0x0D, 0xB4, 0x52, 0x51, 0xEF, 0x5C, 0xFB, 0x58, 0x83, 0x09, 0xC8, 0x3B, 0xDB,
-    0x95, 0x9C, 0x77, 0xF4, 0x7D, 0x5E, 0xF6, 0x03, 0x08, 0x76, 0x32, 0xA5, 0x7B, 0xF6, 0x9D, 0xBF,
-    0xD2, 0x0C, 0x21, 0x73, 0x23, 0xA2, 0xAE, 0xB9, 0xD8, 0x18, 0xE7, 0x2D, 0xD9, 0x94, 0x61, 0x88,
-    0x44, 0x81, 0xE9, 0x5D, 0x6A, 0xA1, 0x93, 0xCF, 0x38, 0xCE, 0x28, 0x4A, 0xDE, 0x06, 0x8D, 0xD6,
-    0xAC, 0xAC, 0x4B, 0x0C, 0xA9, 0x12, 0x3A, 0xF3, 0xA3, 0x7F, 0xAD, 0x94, 0x31, 0x3C, 0x14, 0xFB,
-    0x43, 0xA2, 0x1C, 0x77, 0xED, 0x3C, 0x9D, 0x88, 0x48, 0xEB, 0x24, 0x86, 0x72, 0xE1, 0x99, 0xC6,
-    0xEC, 0xED, 0x54, 0xA8, 0xBB, 0xFE, 0x3E, 0xC6, 0x32, 0xB6, 0xF0, 0x24, 0x51, 0x5B, 0x80, 0x92,
-    0x4F, 0xDF, 0x88, 0x95, 0xD9, 0xAD, 0xB6, 0x4A, 0x07, 0x11, 0xF8, 0xEC, 0x67, 0x1C, 0x79, 0xF2,
-    0x09, 0x74, 0xA1, 0x52, 0xC3, 0x2A, 0x94, 0x88, 0xBE, 0xC8, 0xC1, 0x13, 0xEE, 0xEE, 0x98, 0x80,
-    0xFA, 0x39, 0x7B, 0x5B, 0xB6, 0xCF, 0xB1, 0x54, 0x51, 0x02, 0x3F, 0x4C, 0x97, 0x6A, 0x97, 0x74,
-    0x4A, 0x28, 0x98, 0x1D, 0x69, 0x36, 0xF1, 0xCD, 0xFB, 0x8D, 0x7B, 0x5C, 0xFB, 0x21, 0x29, 0xDE,
-    0x10, 0xBE, 0x15, 0x0A, 0x55, 0x0D, 0x4B, 0xCD, 0x6B, 0x94, 0x83, 0x44, 0x97, 0x6E, 0xB8, 0x2A,
-    0x74, 0x85, 0x00, 0x05, 0xCD, 0x51, 0x58, 0x8E, 0x88, 0x36, 0xA2, 0x02, 0xB8, 0x09, 0x79, 0xCE,
-    0xF7, 0xE9, 0xDE, 0x8B, 0x9C, 0x68, 0xCB, 0x3A, 0x0D, 0x35, 0x22, 0xCA, 0x7A, 0xD3, 0x62, 0xA2,
-    0x62, 0x03, 0x5C, 0x6C, 0x29, 0x8C, 0x14, 0x4D, 0xAA, 0x56, 0x68, 0xFB, 0x8F, 0x70, 0xA5, 0x76,
-    0x25, 0xAF, 0xCA, 0x89, 0xAB, 0xBA, 0xD8, 0x37, 0xB5, 0x10, 0x75, 0x66, 0x4A, 0xBA, 0xFC, 0xE3,
-    0xCC, 0xC9, 0x2E, 0x78, 0xDF, 0xB2, 0xA4, 0x5B, 0xEC, 0xBD, 0x84, 0x7C, 0x15, 0x36, 0x4E, 0x18,
-    0xEF, 0x76, 0x4C, 0xF1, 0xCF, 0xAD, 0x46, 0xBC, 0x45, 0xCB, 0xD0, 0x93, 0x9D, 0x57, 0xD2, 0xFE,
-    0xF2, 0xAB, 0x25, 0xE5, 0x13, 0xCA, 0x06, 0x56, 0x9D, 0xC2, 0x37, 0xA2, 0x0E, 0x14, 0x5E, 0x04,
-    0xB1, 0x98, 0x59, 0x86, 0x16, 0xA1, 0x73, 0x8A, 0x0A, 0x74, 0xD8, 0x07, 0x3A, 0x4E, 0xB7, 0x06,
-    0xA3, 0x39, 0x83, 0xB2, 0x35, 0xDA, 0x50, 0x34, 0xF6, 0x4A, 0x83, 0xC9, 0x35, 0xB9, 0x97, 0x52,
-    0x48, 0x62, 0x13, 0xF6, 0x1D, 0x6C, 0x2D, 0x71, 0xAB, 0x58, 0xEC, 0x62, 0x25, 0xB7, 0x8F, 0x49,
-    0x61, 0x03, 0x62, 0x85, 0x42, 0x31, 0x79, 0x47, 0x6C, 0xD6, 0x33, 0x2C, 0x19, 0xEA, 0x10, 0x3E,
-    0xC5, 0x95, 0x15, 0x53, 0x55, 0x07, 0x56, 0xC9, 0x69, 0x5D, 0xEE, 0xE9, 0x2B, 0x44, 0x3F, 0x96,
-    0xF4, 0x72, 0x97, 0xA3, 0x0F, 0x90, 0xA5, 0x77, 0x6A, 0xF6, 0x22, 0xC2, 0x7D, 0xD5, 0xB2, 0x66,
-    0x59, 0x2D, 0x9B, 0x5B, 0x6E, 0x2E, 0x78, 0x08, 0xEC, 0x43, 0x44, 0x7C, 0x58, 0x5C, 0xE2, 0x6C,
-    0x16, 0xEF, 0xC0, 0x85, 0x55, 0xAE, 0xBF, 0xE9, 0x56, 0xF5, 0x18, 0xB3, 0xEE, 0x0B, 0x90, 0xBF,
-    0xF0, 0xBF, 0xFA, 0x89, 0x9A, 0xCA, 0xF8, 0x24, 0xEF, 0x23, 0x2C, 0x7F, 0x26, 0xAE, 0xE3, 0x3A,
-    0xA9, 0xDF, 0xE4, 0x60, 0x5D, 0xAA, 0xED, 0xD2, 0x65, 0x49, 0xE1, 0x77, 0x92, 0x3F, 0x9F, 0xF2,
-    0x8A, 0xE0, 0x31, 0x4C, 0x58, 0x54, 0x2E, 0xB4, 0x0B, 0x90, 0xB4, 0x0F, 0x61, 0xA9, 0x8F, 0x9D,
-    0x2F, 0xD5, 0x0B, 0xE8, 0xAC, 0x60, 0xEB, 0x46, 0x3D, 0x8D, 0x7D, 0x0F, 0x0B, 0x6D, 0x16, 0x8D,
-    0x10, 0xB7, 0x11, 0x67, 0xB5, 0x98, 0xC6, 0xD2, 0xE9, 0xA9, 0x8C, 0x9E, 0x3C, 0xD4, 0x78, 0x23,
-    0xD3, 0x01, 0xB1, 0x93, 0x2E, 0x4E, 0xD5, 0x3A, 0x4E, 0xE3, 0x86, 0xD8, 0xB5, 0x3D, 0xD4, 0x06,
-    0x8C, 0x66, 0x42, 0x7B, 0xAD, 0xB1, 0x3D, 0xED, 0xCF, 0x7A, 0xF9, 0x4C, 0xAB, 0xDE, 0x89, 0x09,
-    0xDC, 0x1F, 0x20, 0x9C, 0x70, 0x96, 0xC8, 0xEF, 0xF5, 0x8A, 0xBB, 0x43, 0xCB, 0xDE, 0x20, 0xE5,
-    0x3F, 0xA1, 0x64, 0x26, 0x7E, 0xEF, 0xCF, 0xD9, 0x1E, 0x09, 0x7C, 0x5D, 0x31, 0xDD, 0xC3, 0xC9,
-    0x8D, 0x5B, 0x59, 0xAC, 0xED, 0xF3, 0xA7, 0xCA, 0xAA, 0x85, 0xA8, 0xE4, 0x3A, 0xB3, 0xD8, 0x4B,
-    0x04, 0xA5, 0xD3, 0x33, 0x4F, 0x2D, 0x7B, 0x5C, 0x8D, 0x36, 0x88, 0xB0, 0xF3, 0x49, 0xA7, 0x2B,
-    0x0E, 0xB4, 0xAD, 0xDC, 0x9D, 0xCF, 0x9F, 0xD3, 0x11, 0xF4, 0x5E, 0xED, 0xB9, 0xF1, 0x80, 0x8A,
-    0x37, 0x7E, 0xC4, 0x4F, 0xDC, 0xB8, 0x9A, 0x93, 0x22, 0xEA, 0xBA, 0xFF, 0x9A, 0xA7, 0x44, 0x7A,
-    0x67, 0x85, 0x54, 0x90, 0x18, 0x75, 0x86, 0x73, 0xAB, 0x71, 0xDD, 0x66, 0x81, 0x69, 0xAE, 0x3D,
-    0x2D, 0x4D, 0x0E, 0x24, 0x56, 0x57, 0x50, 0x4D, 0xF3, 0xEB, 0xEB, 0x76, 0xD0, 0x51, 0x08, 0xDD,
-    0x74, 0xD0, 0x85, 0xF3, 0x74, 0xC4, 0x1A, 0x17, 0xD9, 0x37, 0x19, 0x94, 0x7A, 0x5D, 0xA2, 0x37,
-    0x3B, 0x25, 0x82, 0x13, 0xAC, 0x04, 0xDD, 0x47, 0x4D, 0xB0, 0x0C, 0x07, 0xAA, 0xBB, 0xE2, 0x4A,
-    0xB0, 0x65, 0x61, 0xFB, 0x97, 0xA5, 0x8A, 0xD8, 0x45, 0x5F, 0xCF, 0x8A, 0x46, 0x6E, 0x55, 0xE1,
-    0x76, 0xCF, 0xB5, 0x9F, 0x16, 0xCA, 0x5B, 0xF3, 0x37, 0x22, 0xCD, 0x34, 0x73, 0x18, 0xB3, 0xE2,
-    0xA0, 0x9B, 0x0F, 0x31, 0x14, 0xA1, 0xCC, 0x6F, 0x35, 0xD3, 0x90, 0x64, 0xE3, 0x01, 0xCA, 0x17,
-    0xCD, 0x38, 0x6D, 0xA7, 0x87, 0xCB, 0x3D, 0x6E, 0xC5, 0x9E, 0x96, 0x07, 0x79, 0x29, 0x85, 0x27,
-    0x26, 0x5D, 0x90, 0x17, 0x8E, 0x89, 0x6A, 0x0D, 0x2C, 0x77, 0xE2, 0xC7, 0x5E, 0x91, 0xDC, 0x03,
-    0xE1, 0xE7, 0xC6, 0x81, 0xD3, 0xB0, 0x54, 0xB8, 0x7C, 0x56, 0x6C, 0x82, 0x46, 0x2F, 0x6B, 0xEA,
-    0xA9, 0x82, 0x6C, 0x74, 0x73, 0xAF, 0xD7, 0xB4, 0xA7, 0x17, 0xC5, 0x90, 0x57, 0x26, 0x68, 0x84,
-    0x3F, 0x2D, 0x91, 0x59, 0x3B, 0x60, 0x58, 0x94, 0xC6, 0xA5, 0xAA, 0xD1, 0x2D, 0x88, 0xA5, 0xD0,
-    0xBC, 0x8D, 0x2F, 0x67, 0x3D, 0x40, 0x41, 0x6C, 0x43, 0x4C, 0x4E, 0x42, 0x83, 0x90, 0x5F, 0x85,
-    0x9E, 0x50, 0xF6, 0x0D, 0xBF, 0x2D, 0xFF, 0xBF, 0xA3, 0xBA, 0x1E, 0xFE, 0xD0, 0xD5, 0x21, 0x1F,
-    0x21, 0xB7, 0x52, 0xA6, 0xF5, 0xD4, 0xF8, 0xEC, 0xE6, 0x42, 0x13, 0xB5, 0xD2, 0xF7, 0xC8, 0x1F,
-    0x88, 0xAE, 0x07, 0x34, 0x9C, 0xE6, 0x4D, 0x11, 0xB5, 0xF4, 0x8E, 0x6F, 0x9B, 0xF8, 0x0C, 0xF4,
-    0x43, 0xD0, 0x75, 0x0D, 0x91, 0x19, 0x91, 0xBD, 0xC5, 0x58, 0xEC, 0xC4, 0x95, 0xA4, 0x47, 0x7D,
-    0xE4, 0x81, 0xDB, 0x4C, 0xD6, 0xF3, 0x01, 0x3B, 0x97, 0xC7, 0x74, 0x1B, 0x9B, 0x9D, 0x91, 0xD3,
-    0xFE, 0x34, 0x85, 0x53, 0x45, 0x47, 0x07, 0xEA, 0x08, 0xB7, 0x46, 0xA1, 0x5A, 0x0A, 0xD7, 0x03,
-    0x2A, 0xE6, 0x7F, 0xB2, 0x18, 0xEA, 0x7C, 0x72, 0x6A, 0x9F, 0xEB, 0xC9, 0x13, 0xB3, 0xFE, 0x3E,
-    0x4D, 0x42, 0x73, 0x24, 0x36, 0x28, 0x24, 0x8B, 0x44, 0x61, 0x23, 0x42, 0x35, 0x1D, 0xEA, 0x29,
-    0x53, 0x5B, 0x6A, 0x38, 0x26, 0x3C, 0x3A, 0x2C, 0x3A, 0x14, 0x81, 0x67, 0xBF, 0xA2, 0x4B, 0x85,
-    0x01, 0x7F, 0xAC, 0xEB, 0x8E, 0x38, 0xE8, 0x2E, 0x0E, 0xF9, 0xB3, 0x25, 0x61, 0xFE, 0x24, 0x86,
-    0x4D, 0x30, 0x17, 0x97, 0x7E, 0x95, 0x3E, 0xF7, 0xD6, 0x4C, 0xC9, 0x59, 0x73, 0xE8, 0x6C, 0x38,
-    0x43, 0x49, 0x46, 0xB1, 0x03, 0x2D, 0xD0, 0xEA, 0xD5, 0x73, 0x0D, 0x0A, 0x3A, 0x0F, 0xDE, 0x08,
-    0x51, 0xCE, 0x07, 0xFA, 0x29, 0x30, 0x51, 0xE2, 0xD3, 0x79, 0x0B, 0x87, 0xF6, 0xF0, 0xB5, 0x81,
-    0xCA, 0x28, 0x5E, 0xDB, 0x0B, 0xC9, 0x34, 0x6C, 0xE1, 0x6A, 0x96, 0xEE, 0x40, 0x7F, 0x60, 0x72,
-    0xC9, 0x2B, 0xE7, 0xB7, 0x65, 0xF9, 0x1B, 0x89, 0x8C, 0x6F, 0xBA, 0x71, 0x07, 0xD1, 0x55, 0x8C,
-    0xD8, 0x32, 0xBE, 0x67, 0x72, 0x75, 0xD3, 0x95, 0xDA, 0xA1, 0x02, 0xDC, 0x1A, 0xEC, 0xC7, 0xAC,
-    0x6E, 0xB9, 0x26, 0x29, 0x53, 0x05, 0xEE, 0x10, 0xE1, 0xBE, 0x88, 0x92, 0x71, 0xF9, 0xFD, 0x45,
-    0xE8, 0xD8, 0x11, 0x22, 0xE4, 0x36, 0x43, 0x4C, 0x12, 0x93, 0xF8, 0x79, 0x6C, 0x8E, 0xFC, 0xDA,
-    0x7A, 0x12, 0xA1, 0x7E, 0x1A, 0x1F, 0x7D, 0x68, 0x11, 0xF2, 0x02, 0x82, 0x06, 0x43, 0xCE, 0x6D,
-    0x5E, 0xEC, 0x19, 0x6A, 0x4B, 0x8E, 0x4B, 0x41, 0x5F, 0x09, 0x43, 0xD2, 0x76, 0x90, 0x3B, 0xFE,
-    0x3B, 0x77, 0x80, 0xE8, 0x60, 0x1E, 0x37, 0xC0, 0x61, 0x1E, 0xCF, 0x62, 0x4B, 0x7C, 0x09, 0x42,
-    0x53, 0x35, 0xAB, 0xC7, 0xCA, 0x4F, 0x91, 0x37, 0x11, 0x96, 0x72, 0xE1, 0xF5, 0x2F, 0x83, 0x23,
-    0xF1, 0x37, 0x70, 0x66, 0xE5, 0xCA, 0xC1, 0xAF, 0x3C, 0xC8, 0x00, 0x9D, 0x90, 0xB3, 0x2F, 0x5F,
-    0x06, 0x9F, 0x84, 0x4B, 0xCC, 0x7F, 0x5B, 0x37, 0xE4, 0x28, 0x1C, 0x95, 0xC3, 0xD0, 0x51, 0x39,
-    0x2C, 0x64, 0x44, 0xA3, 0xAF, 0x52, 0xE8, 0x8E, 0x58, 0x08, 0x42, 0x55, 0x43, 0x06, 0x12, 0xCE,
-    0xEB, 0xB8, 0x6C, 0x97, 0x63, 0x75, 0x08, 0x91, 0xA0, 0x8C, 0x39, 0x26, 0x10, 0x19, 0xA2, 0xF5,
-    0x1C, 0xDB, 0xB0, 0x3C, 0x9F, 0x82, 0x53, 0x72, 0xF1, 0x77, 0x90, 0x0B, 0x67, 0xD3, 0xCE, 0x3B,
-    0x04, 0x77, 0xD6, 0xEF, 0x5D, 0xDB, 0x70, 0x62, 0x76, 0x69, 0x82, 0x6E, 0x06, 0x12, 0x2A, 0xBE,
-    0xFE, 0xB4, 0x89, 0x6E, 0x7F, 0xAF, 0x36, 0x6F, 0x9C, 0x92, 0xCB, 0x4C, 0x83, 0x50, 0xFB, 0x5A,
-    0xFD, 0x22, 0x48, 0xFC, 0x39, 0x83, 0x02, 0x83, 0x7E, 0x12, 0x4D, 0xD6, 0xBB, 0x12, 0x67, 0x32,
-    0x9D, 0xBD, 0x81, 0x1A, 0x5B, 0x2B, 0x52, 0x23, 0x79, 0x74, 0x97, 0xD5, 0xE1, 0x56, 0x44, 0xBC,
-    0x41, 0xBF, 0x90, 0x7B, 0x23, 0x6A, 0xF9, 0x63, 0x2D, 0xEB, 0xA8, 0xC4, 0x74, 0x7D, 0x7F, 0x21,
-    0xAB, 0xB0, 0xE0, 0xBA, 0xA5, 0xCE, 0xED, 0x4E, 0x7B, 0xBC, 0x3C, 0x72, 0x8E, 0xB7, 0xE9, 0x18,
-    0x39, 0xEE, 0x43, 0x74, 0xAD, 0x88, 0x1A, 0x8F, 0x68, 0x3D, 0x21, 0xDA, 0x3A, 0x44, 0x21, 0x42,
-    0x0D, 0x72, 0x0B, 0x1C, 0xCE, 0xDB, 0x09, 0xD1, 0xD5, 0x02, 0xD1, 0xE2, 0x50, 0x44, 0xC7, 0x0F,
-    0x8C, 0x28, 0x9A, 0xFE, 0x5F, 0x82, 0xA7, 0x44, 0x50, 0x74, 0x9F, 0x29, 0xC0, 0x4B, 0x02, 0x1C,
-    0xA1, 0x64, 0x75, 0xA0, 0x90, 0xE8, 0x42, 0xE2, 0x8B, 0xA4, 0x23, 0x96, 0x39, 0x34, 0x70, 0x10,
-    0x75, 0x94, 0x80, 0xAF, 0x28, 0x01, 0x26, 0x0A, 0xD0, 0xF4, 0x27, 0x2D, 0x7F, 0x25, 0x22, 0xD7,
-    0xD4, 0xF5, 0x17, 0x62, 0xC2, 0x36, 0xD5, 0x74, 0xC9, 0x9E, 0x5D, 0x80, 0x54, 0xD3, 0x84, 0x21,
-    0xD0, 0x9A, 0xC4, 0x68, 0xA6, 0x91, 0x9D, 0x23, 0xB6, 0xDA, 0x79, 0xA3, 0x56, 0xA2, 0x86, 0x0B,
-    0x05, 0x6B, 0xDA, 0x50, 0xC7, 0x6F, 0x61, 0x6E, 0x2C, 0xAB, 0xA5, 0x82, 0x62, 0xC5, 0xC0, 0x1C,
-    0x66, 0xA7, 0x58, 0xB9, 0x82, 0x0E, 0xA5, 0x95, 0x40, 0x63, 0x18, 0x16, 0x88, 0x94, 0xA1, 0x93,
-    0xD6, 0x16, 0xAA, 0x0F, 0x7B, 0x28, 0x5A, 0x2F, 0x96, 0x8F, 0xC3, 0xA1, 0x9E, 0x2B, 0x09, 0x07,
-    0xD8, 0x38, 0x88, 0xC6, 0xA9, 0xBF, 0x6C, 0x3C, 0xDF, 0x6C, 0x15, 0xDB, 0x96, 0x40, 0xB3, 0x30,
-    0x06, 0x0A, 0x12, 0xB5, 0x0E, 0x27, 0xF7, 0x05, 0x73, 0x71, 0x29, 0x14, 0x9F, 0xC2, 0xCB, 0x4D,
-    0x34, 0x1E, 0xB9, 0x25, 0x93, 0x7E, 0xFA, 0xDA, 0xFD, 0xC7, 0x54, 0xF4, 0x73, 0x51, 0x1F, 0x39,
-    0xD4, 0x77, 0x0D, 0x84, 0x57, 0xD2, 0xA4, 0xB4, 0x15, 0xE3, 0x58, 0x09, 0xEE, 0xE2, 0x3D, 0x20,
-    0xBD, 0x62, 0x37, 0x9A, 0x32, 0x6F, 0x13, 0x86, 0x4E, 0x44, 0x1D, 0x3F, 0x92, 0x21, 0x98, 0xD8,
-    0xDF, 0x62, 0x91, 0xD9, 0x22, 0xCF, 0xD0, 0x66, 0xDB, 0x27, 0xD4, 0x67, 0xB5, 0x3C, 0xF1, 0x65,
-    0xBE, 0x89, 0xBE, 0x57, 0xCF, 0x13, 0x3B, 0xC8, 0xC8, 0x8F, 0x7C, 0xA4, 0x9C, 0x7B, 0xFE, 0xDF,
-    0x1A, 0x8B, 0x66, 0x32, 0x16, 0x1F, 0x54, 0xB4, 0x3F, 0xB8, 0xB1, 0xA0, 0x64, 0x7D, 0x47, 0x8C,
-    0xD2, 0x63, 0x27, 0x40, 0xB5, 0x7C, 0xEC, 0xC9, 0x27, 0x9D, 0xCB, 0x3F, 0x7E, 0xF9, 0xC3, 0xB7,
-    0x1A, 0x9F, 0xE2, 0x8E, 0x56, 0xCC, 0x8F, 0x6C, 0x98, 0x35, 0xBA, 0xF1, 0x6A, 0x10, 0x7E, 0xCB,
-    0x4F, 0xBC, 0x3F, 0x1C, 0xD8, 0x4E, 0xCA, 0x1D, 0xDA, 0x4E, 0xCC, 0x9D, 0x25, 0x71, 0x72, 0xEE,
-    0xF0, 0x9E, 0x2A, 0x97, 0x1A, 0x58, 0xA9, 0xA4, 0x3B, 0xC4, 0x9D, 0xA8, 0x3B, 0xC8, 0x9D, 0xAC,
-    0x3B, 0xCC, 0x9D, 0xB0, 0x3B, 0xD0, 0x9D, 0xB4, 0x2B, 0xEA, 0x4E, 0xDC, 0x1D, 0xEC, 0x5E, 0xDE,
-    0x1D, 0xEE, 0x4E, 0xE0, 0x0F, 0x00, 0x2F, 0xE8, 0x1E, 0xC7, 0x6F, 0xB8, 0x04, 0xE8, 0x05, 0xC9,
-    0x3F, 0x52, 0x8D, 0x83, 0x87, 0x6D, 0x7E, 0xA0, 0xCC, 0x13, 0x7A, 0xF8, 0x78, 0xD6, 0x23, 0x25,
-    0x00, 0xD8, 0x65, 0xB9, 0x86, 0x35, 0xC8, 0x1B, 0x9C, 0x59, 0x07, 0x03, 0xC8, 0x01, 0x43, 0x5B,
-    0x43, 0x1E, 0xC0, 0xC6, 0x0C, 0x2C, 0xD6, 0xD5, 0x6A, 0x6E, 0xC8, 0x87, 0x7D, 0x8C, 0x38, 0x42,
-    0x62, 0xCD, 0xFF, 0x97, 0xC4, 0x0E, 0x0B, 0xE0, 0x74, 0xEE, 0xF0, 0x73, 0x66, 0x51, 0x3E, 0xF1,
-    0x8D, 0xDC, 0x7D, 0x13, 0x73, 0x49, 0x97, 0xAB, 0x70, 0x42, 0x4A, 0x83, 0x8D, 0x98, 0x80, 0xBC,
-    0xBC, 0x29, 0x78, 0xD1, 0x32, 0xC0, 0x14, 0x4B, 0xAA, 0xB8, 0x15, 0xDC, 0xF3, 0x0E, 0x86, 0x81,
-    0x96, 0x58, 0x50, 0xD9, 0xE0, 0x8F, 0x92, 0x76, 0x41, 0x0D, 0xF1, 0x29, 0x97, 0xB1, 0x33, 0x04,
-    0xFB, 0x8A, 0x1A, 0x29, 0x17, 0xBF, 0xE9, 0x48, 0xE2, 0xF4, 0xF3, 0x21, 0x7E, 0x44, 0xC4, 0x4F,
-    0x16, 0x5F, 0x72, 0xFE, 0xF6, 0x8C, 0x56, 0x1E, 0xCD, 0x69, 0xF3, 0x89, 0x03, 0xA3, 0xE2, 0x88,
-    0x1A, 0xDD, 0x40, 0xC7, 0xE8, 0x66, 0x37, 0xAC, 0xFB, 0x5D, 0x89, 0xAA, 0xAE, 0xDC, 0x5E, 0x1B,
-    0x8D, 0x59, 0xB3, 0x55, 0xEC, 0xE6, 0x46, 0x51, 0x88, 0xE3, 0xB6, 0x8C, 0x46, 0xF2, 0x36, 0xA0,
-    0x89, 0x3E, 0x66, 0x2B, 0x6E, 0x50, 0x80, 0x17, 0xA6, 0x72, 0x6E, 0x58, 0x2C, 0xAC, 0x38, 0xCC,
-    0xA6, 0x6C, 0x2C, 0x76, 0x35, 0x14, 0x5D, 0x75, 0xA7, 0xCF, 0x31, 0xEF, 0x5B, 0xFC, 0x12, 0x3B,
-    0x72, 0xA2, 0x6D, 0xD1, 0xDB, 0x67, 0x61, 0x8A, 0x77, 0xD6, 0xC5, 0xBB, 0x30, 0xFB, 0x77, 0x36,
-    0xE9, 0xFB, 0x2C, 0xE5, 0x01, 0x07, 0xC3, 0xC0, 0x90, 0x3F, 0x8C, 0x44, 0xC7, 0xD4, 0x32, 0x3B,
-    0x8F, 0x35, 0x46, 0x94, 0x7B, 0xB2, 0x2E, 0x80, 0x7E, 0xAB, 0xFE, 0xBE, 0x85, 0x56, 0xB3, 0xDC,
-    0xF6, 0x94, 0x66, 0xEE, 0xB9, 0x9F, 0xC5, 0x80, 0x86, 0x6E, 0x4D, 0x39, 0xB8, 0x33, 0x85, 0x3B,
-    0x83, 0xFF, 0x8D, 0xAD, 0x14, 0xFE, 0xBE, 0xC3, 0x06, 0x06, 0x38, 0x6B, 0x2B, 0x49, 0x52, 0xC7,
-    0x60, 0x88, 0xD6, 0x71, 0x1F, 0xF7, 0x45, 0x5F, 0xD4, 0xD9, 0x6D, 0xFB, 0xE3, 0xC1, 0x54, 0x85,
-    0xFD, 0xD1, 0x2A, 0x18, 0xF1, 0xB3, 0x08, 0xB1, 0xDB, 0x63, 0x72, 0x47, 0xEE, 0x5B, 0x0D, 0x05,
-    0x5C, 0x4B, 0x8B, 0x36, 0xCD, 0x16, 0x53, 0xE6, 0x79, 0xA7, 0x43, 0x69, 0x9F, 0x99, 0x46, 0x5B,
-    0xF8, 0x3E, 0x7A, 0x17, 0x75, 0x96, 0xEE, 0x14, 0x2B, 0xC0, 0xAF, 0x1F, 0xE0, 0x40, 0xF1, 0x0D,
-    0xA8, 0xF3, 0xDF, 0x42, 0xAC, 0x5B, 0x71, 0x66, 0x79, 0x8B, 0x4D, 0x89, 0x9D, 0x2B, 0x92, 0x95,
-    0x9C, 0x3A, 0x4B, 0x31, 0xD0, 0x88, 0x31, 0x52, 0xFB, 0x2C, 0x72, 0xFC, 0x77, 0x87, 0xA9, 0x2F,
-    0xC0, 0x5A, 0x9F, 0xCE, 0x8C, 0xFA, 0xFA, 0x83, 0x66, 0x49, 0xBA, 0xA5, 0x68, 0x2A, 0xF5, 0x71,
-    0xEA, 0x96, 0xA7, 0xF5, 0xF7, 0x40, 0xB4, 0x6D, 0xE1, 0xBB, 0x42, 0x17, 0xA6, 0x44, 0x42, 0x4B,
-    0x8E, 0x67, 0x72, 0x56, 0xC1, 0x9E, 0xA1, 0x64, 0xDD, 0xA7, 0xC5, 0xCF, 0x36, 0x04, 0x1A, 0x1B,
-    0xB0, 0x04, 0x22, 0xDE, 0x12, 0xE2, 0xDF, 0x64, 0x3B, 0x0B, 0x7B, 0xFF, 0x10, 0xF4, 0x16, 0x75,
-    0x45, 0xC1, 0x42, 0xDB, 0xE1, 0x2D, 0xEE, 0xA4, 0xE0, 0x4F, 0x7E, 0xF0, 0x47, 0xB8, 0xF8, 0x63,
-    0x2A, 0xB1, 0xEE, 0x7B, 0x5A, 0x4F, 0xAC, 0x9A, 0x7A, 0x0A, 0xAE, 0xC6, 0xCA, 0x79, 0xA6, 0x8A,
-    0x3F, 0x05, 0xC1, 0xF1, 0x04, 0xAC, 0x4B, 0x07, 0x9A, 0x6E, 0x95, 0x5E, 0xD6, 0xD9, 0x4C, 0x68,
-    0x20, 0xA0, 0x22, 0x61, 0xF9, 0x8A, 0xE2, 0x95, 0xAE, 0x0F, 0xDD, 0x00, 0x92, 0xFE, 0x94, 0xD6,
-    0xA0, 0x81, 0x7D, 0x17, 0x63, 0x9A, 0xF4, 0x11, 0x7F, 0xB5, 0x0A, 0xDB, 0x6D, 0xB0, 0x6B, 0x46,
-    0xF4, 0x71, 0x13, 0x41, 0xF1, 0x39, 0x4B, 0xFF, 0x13, 0xD8, 0x9C, 0x3D, 0xCB, 0x34, 0x1D, 0x45,
-    0x08, 0x56, 0x57, 0x99, 0x4C, 0x28, 0x7E, 0x9D, 0x4F, 0x98, 0x78, 0x43, 0xE6, 0x4B, 0x91, 0x0E,
-    0xEC, 0xD6, 0xFE, 0x34, 0x49, 0x60, 0x17, 0x3A, 0x1B, 0x17, 0x43, 0x15, 0xAA, 0x90, 0x66, 0x51,
-    0x75, 0x74, 0x65, 0x47, 0x57, 0x71, 0x7C, 0x88, 0x1F, 0x98, 0x0A, 0x16, 0x6D, 0x28, 0xDD, 0x2D,
-    0x0F, 0x41, 0x88, 0x7C, 0x7F, 0xC4, 0xFF, 0xEE, 0x91, 0x7B, 0x89, 0xF7, 0xBD, 0x24, 0x1A, 0xB5,
-    0xA5, 0xFA, 0x92, 0xB9, 0x5F, 0x3D, 0xD2, 0x97, 0xDC, 0x2E, 0x47, 0xD3, 0xDC, 0x4B, 0xA5, 0x2F,
-    0xEE, 0x37, 0x70, 0xAC, 0x7B, 0xD1, 0xDD, 0x76, 0xFE, 0x65, 0xFE, 0x41, 0x19, 0xAD, 0xCE, 0x63,
-    0x75, 0xD9, 0x62, 0xCB, 0xA8, 0xF5, 0xFD, 0x49, 0x97, 0x84, 0x73, 0xCB, 0x14, 0x6B, 0x60, 0xF9,
-    0x62, 0xC2, 0xEB, 0xBE, 0x0F, 0x96, 0x78, 0xE2, 0xE9, 0xC9, 0xC9, 0x29, 0x2C, 0x13, 0xB3, 0x5B,
-    0x26, 0x71, 0x48, 0xEA, 0x98, 0xD3, 0x31, 0x83, 0x83, 0xF1, 0x63, 0x42, 0x97, 0x8E, 0xD7, 0xAE,
-    0xAA, 0x9B, 0x61, 0x71, 0xAC, 0xF2, 0xBF, 0x0A, 0xE0, 0x66, 0xCE, 0x12, 0x37, 0xD2, 0x35, 0xEC,
-    0x1B, 0xB4, 0x6B, 0x0E, 0x47, 0x3F, 0x53, 0x4A, 0x22, 0xED, 0x92, 0x91, 0xDC, 0x4E, 0x99, 0xA0,
-    0x57, 0x2A, 0x36, 0xCB, 0x97, 0x6A, 0xDF, 0x4B, 0xA3, 0x72, 0xA9, 0x19, 0x60, 0xA0, 0x5F, 0x70,
-    0x2F, 0xAE, 0xFC, 0x18, 0x69, 0x1B, 0xC2, 0xBD, 0xC4, 0xFA, 0xE2, 0xEA, 0x41, 0xA9, 0x7F, 0x69,
-    0x17, 0xE3, 0x7C, 0x99, 0x9D, 0x7E, 0x1D, 0xC9, 0x6D, 0x85, 0xB7, 0x56, 0x79, 0x81, 0xFD, 0x57,
-    0x76, 0x5E, 0x56, 0xE9, 0x0B, 0x04, 0xD6, 0xD3, 0x19, 0x8E, 0xBF, 0x2F, 0xB0, 0xFF, 0x5A, 0x6D,
-    0x61, 0x52, 0xEA, 0x8E, 0xF3, 0xCD, 0x8D, 0xC5, 0xCE, 0x49, 0x5F, 0x95, 0xF4, 0x4A, 0xF1, 0x07,
-    0x28, 0xF1, 0x4C, 0xA0, 0xC4, 0xE2, 0x9F, 0x46, 0x1F, 0x21, 0xBB, 0xE5, 0xB7, 0x4B, 0x70, 0xB7,
-    0x41, 0x50, 0xFE, 0xDE, 0x24, 0xDE, 0xB5, 0x3C, 0x50, 0x7C, 0x7E, 0x84, 0xFD, 0x3B, 0x8E, 0xC6,
-    0xD6, 0x3A, 0xC1, 0x58, 0xB8, 0x7A, 0xD4, 0xAE, 0x2B, 0xDC, 0xE8, 0xCF, 0x08, 0x91, 0x39, 0xD1,
-    0x62, 0x60, 0x9C, 0x26, 0xB4, 0xD3, 0x9A, 0x0E, 0xA2, 0x2B, 0xF8, 0x2E, 0x48, 0xD5, 0xFF, 0x00,
-    0x6D, 0x53, 0xBF, 0x6F, 0x1C, 0x45, 0x14, 0xFE, 0x66, 0x86, 0xBB, 0x35, 0x59, 0x9F, 0xA7, 0x71,
-    0x24, 0xA2, 0x20, 0x1F, 0xC5, 0x15, 0x96, 0xB9, 0x64, 0x5C, 0x5C, 0x61, 0x89, 0xBB, 0xEC, 0xC6,
-    0x14, 0x14, 0x14, 0xB8, 0xC0, 0x12, 0x1D, 0x29, 0xA8, 0x52, 0x51, 0xB8, 0x34, 0xBA, 0x4D, 0xF8,
-    0x07, 0x2C, 0xF1, 0x07, 0xE4, 0x0A, 0x28, 0xB0, 0x84, 0x9C, 0xE2, 0x3A, 0x1C, 0x76, 0x1C, 0x17,
-    0xA9, 0x40, 0x13, 0x21, 0xFA, 0x01, 0x41, 0x03, 0x05, 0x53, 0x2C, 0xE2, 0x84, 0xF6, 0xEE, 0xF1,
-    0x66, 0xEF, 0x92, 0x08, 0x92, 0xA7, 0xA7, 0x99, 0x9D, 0x1F, 0x6F, 0xF6, 0xFB, 0xBE, 0xF7, 0xDE,
-    0x2D, 0x24, 0x01, 0x25, 0x74, 0x40, 0x0B, 0xF8, 0x24, 0xB1, 0x23, 0xE5, 0x8D, 0xA8, 0x80, 0x29,
-    0x90, 0xB1, 0x57, 0x30, 0xBA, 0xD8, 0xC2, 0xF1, 0x15, 0xC8, 0x42, 0x56, 0x89, 0xFC, 0x53, 0x5A,
-    0xEF, 0xFC, 0xF4, 0x66, 0x18, 0x2A, 0xBE, 0x14, 0xAD, 0x75, 0x40, 0x44, 0x86, 0xC8, 0x63, 0x65,
-    0x3B, 0x67, 0x44, 0x97, 0xBC, 0x47, 0xCD, 0x6A, 0x88, 0xE4, 0x03, 0xA8, 0x4B, 0x9F, 0xB8, 0x92,
-    0xBC, 0x26, 0x87, 0xBB, 0x39, 0xF4, 0xD3, 0x3A, 0x7B, 0x52, 0x97, 0x45, 0xEA, 0x52, 0x37, 0xC7,
-    0xDC, 0x38, 0x73, 0x59, 0xAB, 0xBA, 0xB4, 0xA5, 0x35, 0x4F, 0x6F, 0x5B, 0x2D, 0xC2, 0x06, 0x07,
-    0xCA, 0xAA, 0xB3, 0xBE, 0xBD, 0x3E, 0xE8, 0x9B, 0x90, 0x16, 0x78, 0x04, 0x9C, 0xCB, 0x8A, 0xF7,
-    0xB4, 0x87, 0xF6, 0x99, 0x45, 0x66, 0x0F, 0x80, 0x03, 0x1C, 0xE1, 0xC6, 0x4D, 0x11, 0xF4, 0x83,
-    0x42, 0xCD, 0xF9, 0x10, 0x38, 0xC1, 0x26, 0xD8, 0xB5, 0x8B, 0x3E, 0x07, 0x3B, 0xCF, 0x5D, 0x27,
-    0xBE, 0x01, 0xBB, 0x09, 0xA0, 0x22, 0xAD, 0x91, 0x39, 0xB9, 0x88, 0x84, 0xC7, 0x96, 0xA3, 0x1A,
-    0x4B, 0x16, 0x20, 0xAB, 0x2B, 0x49, 0x7C, 0x96, 0xCC, 0x40, 0x30, 0x91, 0x8D, 0x5A, 0x34, 0x21,
-    0x79, 0xC2, 0x21, 0x56, 0x10, 0x74, 0xC5, 0x21, 0xB8, 0x23, 0x2F, 0x3E, 0xD6, 0x95, 0xB0, 0x29,
-    0xDF, 0xE8, 0xC1, 0xCB, 0x9F, 0x92, 0xBA, 0x83, 0x3D, 0x5E, 0x94, 0x5F, 0xB3, 0x12, 0xF3, 0xD6,
-    0x61, 0x0D, 0xB0, 0xCF, 0xC0, 0x2A, 0xCA, 0x00, 0x74, 0x60, 0xFB, 0xE9, 0xBB, 0xBE, 0x87, 0xE4,
-    0x3D, 0x95, 0xDB, 0xBE, 0x40, 0xDC, 0x1A, 0x74, 0xBD, 0xA9, 0xC4, 0xE4, 0x4B, 0x49, 0x45, 0x29,
-    0x9B, 0xA7, 0x80, 0x36, 0x7A, 0xBA, 0x56, 0x78, 0x63, 0xA9, 0xEA, 0x6D, 0x7E, 0x2B, 0x23, 0xD6,
-    0x8B, 0xD1, 0xB9, 0xB9, 0xF9, 0x91, 0xE5, 0x51, 0x41, 0x05, 0x63, 0x8D, 0x25, 0x50, 0x52, 0xA7,
-    0xB5, 0xF1, 0xC6, 0xFF, 0x47, 0x24, 0x40, 0xD7, 0x82, 0xF2, 0x2C, 0xA8, 0x1A, 0xE3, 0x42, 0x07,
-    0x66, 0xC9, 0x78, 0x01, 0x91, 0x2B, 0xAC, 0xB1, 0x6C, 0x18, 0x60, 0xF0, 0xB6, 0x2F, 0x0B, 0xF4,
-    0x84, 0x4F, 0x8A, 0x0D, 0xF4, 0xD1, 0x0D, 0x6D, 0x46, 0xA8, 0xFC, 0x28, 0xB5, 0x75, 0xF7, 0x7E,
-    0x95, 0xC9, 0xC9, 0x95, 0xD3, 0xC9, 0x98, 0x1E, 0xBB, 0x2D, 0x8D, 0xE9, 0xB6, 0x2C, 0xEE, 0xE0,
-    0xDA, 0x08, 0x53, 0xFD, 0xBE, 0x65, 0x81, 0x24, 0x33, 0xF2, 0x10, 0x27, 0x50, 0x01, 0xAC, 0x88,
-    0x7E, 0x90, 0x8F, 0xA4, 0x9F, 0xA2, 0xFF, 0xEA, 0xAA, 0x40, 0x49, 0xBF, 0x9C, 0x7E, 0x95, 0xC7,
-    0x3C, 0x12, 0x3D, 0x26, 0x9A, 0x34, 0x19, 0x7D, 0xF9, 0x26, 0x53, 0xFC, 0x9B, 0x99, 0x96, 0x44,
-    0x76, 0x4F, 0x15, 0xBB, 0xEB, 0x5A, 0x60, 0x53, 0xE4, 0x21, 0xDD, 0x77, 0x5B, 0xC9, 0xEF, 0xB5,
-    0xA6, 0xD0, 0xDC, 0xB9, 0xB0, 0x1B, 0x29, 0x06, 0x7B, 0xC2, 0xBA, 0x34, 0xA1, 0x59, 0xEB, 0x30,
-    0x57, 0x3F, 0x17, 0xDB, 0x47, 0xC5, 0xC5, 0xE7, 0xED, 0xB5, 0xED, 0xC1, 0xAE, 0xCB, 0xF7, 0xD1,
-    0x5E, 0x53, 0x47, 0xD2, 0x29, 0xDB, 0xF1, 0x47, 0x9F, 0xBE, 0xEA, 0x3F, 0x6F, 0x26, 0x76, 0xF7,
-    0xB8, 0x17, 0x41, 0x14, 0x4D, 0x6D, 0x77, 0x99, 0xB6, 0x8D, 0x59, 0x82, 0x79, 0x56, 0xB7, 0x2F,
-    0x57, 0xE3, 0xCE, 0xE9, 0x17, 0x34, 0x1F, 0xAA, 0x27, 0xC5, 0x70, 0xD2, 0x8E, 0x54, 0x5E, 0xC3,
-    0x19, 0xCD, 0x15, 0xC3, 0x15, 0x1F, 0xE2, 0x7F, 0x76, 0xF5, 0x40, 0x73, 0x0B, 0x64, 0xAB, 0x36,
-    0x48, 0xAC, 0xDE, 0x0F, 0xA9, 0x9D, 0xA9, 0xF0, 0x19, 0x66, 0x19, 0xCE, 0xB5, 0xCD, 0x12, 0xDF,
-    0xBD, 0x37, 0x69, 0x9F, 0x5C, 0x3B, 0x94, 0x54, 0x67, 0x64, 0xC5, 0x0C, 0x26, 0x67, 0x68, 0x3B,
-    0xAB, 0xF8, 0x0E, 0xA7, 0x89, 0x91, 0xED, 0xAE, 0xBE, 0x64, 0xF5, 0x0E, 0xBE, 0xFD, 0xFE, 0xE1,
-    0x86, 0xFE, 0x41, 0xBA, 0xD2, 0x0E, 0xB9, 0xF2, 0x84, 0x6D, 0x4E, 0xB9, 0x33, 0xE2, 0xD7, 0x20,
-    0x82, 0x69, 0xEC, 0xBC, 0x19, 0x55, 0x68, 0x26, 0x63, 0x9B, 0x69, 0x11, 0x87, 0xEB, 0xC4, 0xA9,
-    0xAA, 0x14, 0x9D, 0x79, 0xAE, 0xDE, 0xCC, 0x69, 0x2F, 0x99, 0x15, 0xD2, 0x7F, 0xC8, 0x1A, 0x87,
-    0x36, 0xFD, 0x8A, 0x5B, 0xCD, 0x5D, 0x4E, 0x6B, 0x34, 0xBD, 0x6C, 0xDF, 0xAB, 0x78, 0xD6, 0xD4,
-    0x3C, 0x8C, 0x6B, 0x8C, 0x44, 0x6D, 0x70, 0xAC, 0x82, 0xBE, 0x57, 0xA5, 0x56, 0x35, 0xE4, 0xEE,
-    0xE6, 0x2F, 0x58, 0x4B, 0xCA, 0x45, 0xAE, 0xFF, 0x70, 0x89, 0xCB, 0x50, 0xE9, 0xE2, 0x11, 0xC6,
-    0x84, 0x8F, 0xD0, 0x5D, 0x3E, 0xD9, 0x20, 0x9C, 0x2F, 0x15, 0x7F, 0x61, 0xB1, 0xFE, 0x59, 0x72,
-    0xF9, 0x30, 0x2E, 0x36, 0x47, 0xEB, 0x6B, 0x6F, 0x35, 0xB5, 0xDF, 0x54, 0xFD, 0x8D, 0xD8, 0x08,
-    0x32, 0x88, 0xBF, 0x20, 0xCA, 0x9C, 0x09, 0x30, 0x83, 0x95, 0x5D, 0xA7, 0x45, 0x0E, 0xF9, 0x1B,
-    0x5A, 0xDF, 0x45, 0x05, 0xD0, 0x76, 0x83, 0xB8, 0xBB, 0xD7, 0xC4, 0xBE, 0xFE, 0xFC, 0xDD, 0x68,
-    0x33, 0x49, 0x8D, 0xB9, 0xE5, 0xB4, 0x2C, 0x47, 0xED, 0x96, 0x70, 0x9F, 0x43, 0xFF, 0x17, 0xD5,
-    0x7D, 0x3D, 0x90, 0xE5, 0xD6, 0x95, 0xDE, 0x05, 0xA0, 0x19, 0xEC, 0x12, 0x5E, 0x81, 0x81, 0xA8,
-    0x52, 0x91, 0x2B, 0xC2, 0x81, 0xEC, 0x5A, 0xD3, 0xE4, 0x20, 0x51, 0xC0, 0x72, 0x4D, 0x37, 0x20,
-    0x4D, 0xC0, 0x80, 0x01, 0xC7, 0x55, 0x1C, 0x95, 0x4B, 0x0C, 0xE4, 0x60, 0x03, 0x69, 0xE5, 0xDA,
-    0x71, 0xC0, 0x80, 0xAE, 0xEA, 0x6E, 0x40, 0xA2, 0xAB, 0x14, 0x6C, 0xB0, 0x13, 0x2C, 0x9D, 0x8A,
-    0x01, 0x65, 0x4B, 0xC3, 0x60, 0x18, 0x4C, 0x30, 0xB6, 0xBB, 0x1B, 0x10, 0x19, 0x6C, 0xA0, 0x80,
-    0x20, 0x29, 0x17, 0x03, 0x05, 0x84, 0x96, 0x43, 0x6B, 0x97, 0x0C, 0x06, 0x22, 0x41, 0x11, 0x3D,
-    0x03, 0xE0, 0xFA, 0x7C, 0xDF, 0xB9, 0x78, 0xEF, 0xF5, 0xFC, 0x71, 0x64, 0x53, 0x96, 0xD4, 0x1C,
-    0xBE, 0xEE, 0xC6, 0xC3, 0xC3, 0xBD, 0xF7, 0xDC, 0xF3, 0xF3, 0x9D, 0xBF, 0xDB, 0xC6, 0xF0, 0x2B,
-    0x6C, 0xE5, 0xC5, 0x1F, 0xF0, 0xE3, 0x8C, 0x97, 0xAC, 0x34, 0x37, 0x7D, 0x9D, 0x38, 0x77, 0xEE,
-    0x69, 0x13, 0x5B, 0x3B, 0x9A, 0x04, 0x2F, 0x19, 0xEF, 0xC2, 0xCB, 0x1E, 0x5E, 0x0E, 0xF0, 0x32,
-    0x2E, 0x2F, 0xDE, 0x74, 0xEE, 0x5C, 0xEE, 0x5B, 0x6B, 0xF3, 0x40, 0x5E, 0x4C, 0xD0, 0x2D, 0x23,
-    0x44, 0xB5, 0xBC, 0xC4, 0x7C, 0xC1, 0x00, 0xC9, 0x0B, 0xF2, 0xCC, 0x94, 0x8F, 0xB3, 0x76, 0x30,
-    0x85, 0xB5, 0xBD, 0xA9, 0xAC, 0xED, 0x96, 0x31, 0x53, 0xB3, 0x65, 0xCC, 0x36, 0x5E, 0xB6, 0xCC,
-    0xFE, 0xEF, 0x73, 0x2E, 0x27, 0x3C, 0xF9, 0xAC, 0x7D, 0x13, 0x2F, 0x83, 0x3E, 0xC2, 0x1B, 0x56,
-    0x43, 0x71, 0x64, 0x3E, 0x28, 0xC2, 0x73, 0x83, 0x7E, 0x35, 0x7E, 0x71, 0x49, 0x88, 0x99, 0xE2,
-    0x21, 0xF1, 0xE4, 0xCD, 0x26, 0x18, 0xE5, 0x36, 0x7F, 0x34, 0x7E, 0x67, 0x26, 0x63, 0x76, 0xF0,
-    0xC1, 0xD4, 0x24, 0xA5, 0x8C, 0x1F, 0x35, 0x26, 0x6C, 0xE4, 0xB9, 0x61, 0x27, 0x1F, 0x2C, 0x7A,
-    0x53, 0x98, 0x6C, 0x90, 0x3D, 0x88, 0xAF, 0x72, 0xF4, 0x2F, 0xE1, 0x25, 0xE1, 0x28, 0x66, 0x99,
-    0x2E, 0x67, 0x1F, 0x36, 0xE6, 0xD3, 0xBE, 0xBC, 0x73, 0xE7, 0xCE, 0x19, 0xAC, 0xBC, 0x36, 0x16,
-    0x13, 0x21, 0x85, 0x52, 0x3C, 0x21, 0xC6, 0x87, 0x43, 0xAC, 0xC5, 0x1F, 0xD7, 0xFB, 0x9E, 0x63,
-    0x28, 0xAE, 0x05, 0xEF, 0x04, 0xEB, 0x77, 0x2A, 0xBC, 0x93, 0x91, 0x5C, 0x24, 0x21, 0xD6, 0xEF,
-    0xF3, 0x1D, 0xBB, 0x7A, 0x27, 0xED, 0x8E, 0x8D, 0x5D, 0xE1, 0x9E, 0xC8, 0x5A, 0x19, 0xAD, 0x68,
-    0x92, 0xD6, 0xF8, 0x13, 0x88, 0x83, 0x07, 0x8F, 0x1C, 0x63, 0xE4, 0x70, 0xFF, 0x4E, 0x56, 0xBB,
-    0xA2, 0x18, 0xE8, 0x5C, 0x1A, 0x6E, 0x17, 0x67, 0x6D, 0x94, 0xDA, 0x3A, 0x4F, 0x9D, 0x93, 0x89,
-    0xE4, 0xCE, 0xC3, 0x32, 0xB2, 0xFF, 0x74, 0xC9, 0xD6, 0x11, 0xB6, 0x24, 0x0F, 0xE5, 0x65, 0xE6,
-    0xFD, 0xF2, 0x96, 0xBC, 0xCA, 0x36, 0x3C, 0x64, 0x8F, 0x8E, 0x51, 0xE1, 0x2C, 0xD6, 0x05, 0x2A,
-    0x60, 0x67, 0xE5, 0x31, 0xDC, 0x64, 0x93, 0x4D, 0xF9, 0xE7, 0x96, 0x69, 0xC7, 0xED, 0x7A, 0x20,
-    0x95, 0x04, 0x63, 0xF9, 0x9A, 0xF1, 0x49, 0xA1, 0x9D, 0xB1, 0xCE, 0xCA, 0xCE, 0xFC, 0xC5, 0x62,
-    0x97, 0x4F, 0x72, 0x6D, 0x32, 0x5D, 0x6E, 0x79, 0x4A, 0x6A, 0x44, 0x18, 0x43, 0xE6, 0xD2, 0x99,
-    0x5C, 0xDE, 0x18, 0x4C, 0xF5, 0xFE, 0x25, 0x99, 0x95, 0x70, 0x92, 0x9D, 0x8E, 0xBD, 0x0A, 0x5B,
-    0xC8, 0xC7, 0xBC, 0x4A, 0x1F, 0xAB, 0x5F, 0xC1, 0x00, 0x8A, 0x0B, 0x69, 0x23, 0x92, 0x49, 0x08,
-    0x2D, 0x9B, 0x24, 0x94, 0x4A, 0x6B, 0x08, 0xA4, 0x10, 0xAB, 0xE2, 0x9C, 0x66, 0x23, 0xCC, 0x04,
-    0x62, 0x8E, 0xF8, 0x17, 0x0D, 0x26, 0xEE, 0xF1, 0x4F, 0x96, 0x91, 0x75, 0xA6, 0x68, 0xCD, 0xF9,
-    0x16, 0xFC, 0x98, 0x08, 0xAB, 0xC9, 0xCE, 0x66, 0x75, 0x56, 0x47, 0x83, 0xDC, 0x64, 0x73, 0x9B,
-    0xDF, 0x81, 0x49, 0x82, 0xC1, 0xED, 0x20, 0x77, 0x15, 0x3B, 0x4D, 0x4A, 0x5B, 0xC7, 0x25, 0x1E,
-    0xB6, 0x46, 0xE6, 0xE0, 0xEE, 0x3B, 0xF6, 0xB6, 0x0C, 0xE5, 0x61, 0xDD, 0x69, 0xE3, 0xB8, 0x05,
-    0x8F, 0x89, 0x06, 0xC7, 0x16, 0x32, 0x2B, 0x21, 0x02, 0xAE, 0xCA, 0x07, 0x42, 0xDC, 0x77, 0xBE,
-    0x75, 0x63, 0x5E, 0xA4, 0x80, 0x94, 0xEE, 0xA3, 0x8E, 0xA9, 0xF0, 0x00, 0x59, 0xD8, 0x42, 0x7A,
-    0x65, 0xAA, 0xD5, 0xDB, 0x7C, 0xBE, 0xA7, 0xDC, 0xB8, 0x7A, 0x3B, 0xA1, 0x2C, 0xF7, 0x77, 0x64,
-    0x56, 0xBC, 0x1D, 0xF6, 0xC7, 0xB9, 0x9C, 0x6F, 0x17, 0xF2, 0x76, 0x5E, 0xB5, 0x60, 0x85, 0x0E,
-    0xBC, 0xD1, 0x63, 0xEF, 0x06, 0x6C, 0x1D, 0xEE, 0xB6, 0x17, 0x8E, 0x93, 0xE8, 0x2C, 0xA7, 0x4B,
-    0xD6, 0x22, 0xA3, 0xE1, 0x09, 0x71, 0x2E, 0x42, 0x6C, 0x20, 0xC9, 0x3E, 0xC5, 0xA8, 0x55, 0xD1,
-    0x94, 0xCB, 0x5B, 0xB8, 0x7C, 0x5A, 0x2F, 0x7B, 0x9D, 0xD3, 0x32, 0xB9, 0x8C, 0xF4, 0x22, 0x2E,
-    0x7B, 0xDC, 0xF9, 0x4E, 0x64, 0xD8, 0xEF, 0x79, 0x19, 0x1F, 0x3D, 0x6D, 0xCC, 0x60, 0xC2, 0x5A,
-    0x2E, 0x8B, 0x54, 0xA7, 0x7A, 0x59, 0xAE, 0x9C, 0x86, 0x60, 0x44, 0x8D, 0x3C, 0x29, 0x6C, 0x3D,
-    0x8B, 0x01, 0x52, 0x7C, 0x7A, 0x9F, 0x7C, 0x5E, 0x0A, 0x59, 0x03, 0x30, 0xB2, 0xC5, 0x02, 0xAE,
-    0x1B, 0x7F, 0x35, 0xE9, 0x13, 0xBA, 0xD5, 0x81, 0xD0, 0xAE, 0xE3, 0x14, 0x38, 0x53, 0xF9, 0xD4,
-    0x29, 0x03, 0x8D, 0xCA, 0x89, 0xCA, 0x10, 0x78, 0x3F, 0xAC, 0x39, 0x4F, 0xBF, 0x53, 0x11, 0x1C,
-    0xF8, 0x3E, 0xE4, 0xC3, 0xDA, 0xAB, 0x10, 0x19, 0xF9, 0x6A, 0x44, 0xDB, 0x88, 0x1C, 0x8E, 0x41,
-    0x8B, 0xF7, 0xE3, 0x5C, 0x08, 0xB4, 0x6B, 0x82, 0x76, 0x87, 0xBA, 0x6F, 0xD8, 0xA6, 0xF6, 0xDB,
-    0x92, 0xC7, 0x89, 0x5E, 0xCD, 0xF0, 0x38, 0xD1, 0x9C, 0xDF, 0xEF, 0x38, 0xC3, 0x7A, 0xE0, 0xA3,
-    0x9A, 0x2D, 0x4A, 0x5F, 0x93, 0x80, 0xC6, 0x6B, 0x86, 0x8F, 0xF1, 0xF0, 0xAE, 0xC0, 0xEB, 0xAB,
-    0x78, 0x99, 0xEF, 0xFB, 0xD1, 0x93, 0xDD, 0x03, 0x67, 0xDD, 0xD6, 0x99, 0x69, 0x2D, 0x90, 0x69,
-    0xBD, 0xDA, 0xBC, 0xF0, 0x63, 0xEC, 0x4D, 0xCA, 0xAD, 0xA0, 0x5E, 0x0B, 0x6C, 0x59, 0xE4, 0x26,
-    0xED, 0x65, 0x4E, 0xC2, 0x74, 0x5E, 0x4F, 0x19, 0xAA, 0xC1, 0x18, 0x29, 0xB9, 0x50, 0x84, 0x4A,
-    0x64, 0xA5, 0x35, 0x49, 0x67, 0x52, 0x11, 0xA1, 0x5A, 0x96, 0x19, 0xCC, 0x78, 0x6E, 0xD2, 0x43,
-    0xAC, 0xE4, 0x02, 0x74, 0x87, 0xF2, 0x10, 0xB6, 0x91, 0xA6, 0x2F, 0xE0, 0x80, 0x3E, 0xB9, 0xD5,
-    0x53, 0xB5, 0xD6, 0xAF, 0xD5, 0xD4, 0x9D, 0xE4, 0xA8, 0xC7, 0x4E, 0x88, 0xB8, 0x80, 0x3D, 0x66,
-    0xB2, 0x59, 0x96, 0x57, 0x25, 0xA6, 0x0F, 0x4E, 0x8F, 0x5B, 0xF0, 0x5C, 0xD0, 0x63, 0x75, 0xFE,
-    0xC8, 0x35, 0xCE, 0x19, 0xB8, 0xBB, 0x28, 0xF0, 0x9A, 0x92, 0xB9, 0x62, 0xBE, 0x86, 0x34, 0x3C,
-    0xBE, 0x9A, 0x1F, 0x6B, 0x95, 0xF9, 0xF4, 0x26, 0x4C, 0x20, 0xFE, 0xC8, 0x52, 0x5A, 0xA1, 0x61,
-    0x83, 0x29, 0xC6, 0x70, 0x96, 0x37, 0x17, 0x65, 0x26, 0x44, 0xCA, 0x9A, 0x48, 0x6E, 0x8E, 0x3B,
-    0xCF, 0x52, 0x3D, 0x64, 0xD4, 0x52, 0xB0, 0x34, 0xF8, 0x3A, 0x5C, 0x8B, 0xBC, 0x93, 0x2B, 0x99,
-    0xF2, 0x5A, 0x33, 0xFC, 0xD8, 0x38, 0x7A, 0xAB, 0xC1, 0x32, 0x59, 0x0B, 0x22, 0xC5, 0x13, 0x84,
-    0x28, 0x90, 0x51, 0x45, 0xF2, 0xAA, 0x11, 0x9F, 0x4B, 0x6C, 0x29, 0xB7, 0x84, 0xC2, 0x8C, 0x22,
-    0xA1, 0xB0, 0xAC, 0xA2, 0x6B, 0xDE, 0x91, 0x9B, 0xEB, 0xE8, 0x63, 0xDC, 0xEC, 0x4F, 0x19, 0x6E,
-    0x2E, 0x9E, 0xC7, 0xCD, 0x71, 0x57, 0xC9, 0xCD, 0xC1, 0x08, 0x2D, 0xD5, 0x58, 0x0F, 0x37, 0xA7,
-    0x0D, 0xF4, 0xD5, 0xDF, 0x0F, 0xD8, 0x8A, 0xA3, 0x59, 0x0C, 0x84, 0xB1, 0x55, 0x2D, 0xAA, 0x3D,
-    0x96, 0x65, 0xD8, 0xDA, 0x13, 0x0D, 0x99, 0x0C, 0xB2, 0x5A, 0xB1, 0xDA, 0xF2, 0xAF, 0x85, 0x02,
-    0xC9, 0x64, 0x31, 0x56, 0x05, 0x2B, 0xCC, 0xB1, 0x41, 0x1D, 0x58, 0x75, 0x17, 0x64, 0xC2, 0x02,
-    0x63, 0xD2, 0xE7, 0xC1, 0x0B, 0xB7, 0xD9, 0x17, 0xE1, 0xA8, 0x2F, 0x80, 0x47, 0xE5, 0xDF, 0x3E,
-    0x2C, 0x37, 0xF8, 0x14, 0xBC, 0x2B, 0x66, 0x17, 0x6C, 0x0D, 0x83, 0x28, 0x5A, 0xCD, 0x1B, 0xC1,
-    0x6B, 0x49, 0x0D, 0xB6, 0x9B, 0xC1, 0x70, 0xF1, 0x47, 0x3D, 0x35, 0x3E, 0xF7, 0x03, 0x0F, 0xCF,
-    0x46, 0x4A, 0x7F, 0xBE, 0x98, 0xBA, 0x80, 0x1C, 0x5A, 0xAC, 0x4C, 0x5F, 0x22, 0xBF, 0xFB, 0x15,
-    0x26, 0x93, 0xE1, 0xFE, 0x80, 0x5B, 0x59, 0x5C, 0x58, 0x24, 0xD2, 0x3B, 0x0B, 0xD4, 0xB0, 0x07,
-    0x2E, 0x8C, 0xEB, 0x80, 0xF2, 0x96, 0x61, 0x5B, 0x04, 0x36, 0x88, 0xC8, 0x4C, 0x98, 0x51, 0x0C,
-    0x41, 0x83, 0xBE, 0xDD, 0x83, 0x91, 0x8E, 0x9A, 0xD5, 0x5D, 0x71, 0x2D, 0x93, 0x96, 0x8F, 0x0B,
-    0xE2, 0x48, 0xF3, 0xB8, 0x76, 0xF3, 0x2E, 0xB0, 0xA9, 0xA2, 0x1D, 0x7A, 0xDE, 0x05, 0x69, 0x08,
-    0x09, 0x51, 0x2A, 0xD5, 0x50, 0x54, 0x43, 0x21, 0x39, 0x79, 0x7F, 0x85, 0x1C, 0x94, 0x8F, 0x4F,
-    0x2C, 0xB4, 0x51, 0xA3, 0x45, 0x6E, 0xC8, 0xB8, 0x26, 0xDA, 0xAF, 0x84, 0x0A, 0x76, 0x24, 0xAF,
-    0xBD, 0x85, 0x0F, 0x14, 0x30, 0x04, 0x41, 0x07, 0xE5, 0x9F, 0x96, 0x87, 0x60, 0x72, 0xD8, 0xC8,
-    0xB8, 0x81, 0x25, 0xA8, 0xC0, 0x2E, 0x42, 0xBB, 0x02, 0xB8, 0x51, 0x26, 0x2F, 0x9A, 0x56, 0x98,
-    0x45, 0x3E, 0x10, 0x83, 0x31, 0x64, 0x73, 0x22, 0xDA, 0x67, 0xCC, 0x6F, 0x08, 0x28, 0xF2, 0x50,
-    0xDA, 0x59, 0x0D, 0xC2, 0x5A, 0x0C, 0x1D, 0x8C, 0xA0, 0x21, 0xC4, 0x11, 0x16, 0x5C, 0xA1, 0xD7,
-    0x6A, 0x6E, 0xD3, 0x0A, 0xC9, 0x8D, 0x8B, 0x65, 0x0E, 0xEC, 0x5C, 0x42, 0xF1, 0xF5, 0x18, 0x75,
-    0x1F, 0xB0, 0x6B, 0x1B, 0x63, 0x9D, 0x02, 0xF9, 0x4E, 0xC1, 0x60, 0x6E, 0x81, 0x7A, 0x80, 0x17,
-    0x0F, 0x81, 0xFB, 0x2D, 0x1F, 0xDC, 0xE0, 0xC1, 0x22, 0xFF, 0xF6, 0xEA, 0x5A, 0xFD, 0x1C, 0x51,
-    0xA7, 0x43, 0xF7, 0xF1, 0xB3, 0xA7, 0xA1, 0xFA, 0x3A, 0x68, 0x90, 0x3A, 0xC2, 0x93, 0x44, 0x31,
-    0xF7, 0x82, 0x1F, 0xAB, 0x3C, 0x82, 0xB6, 0xC9, 0xC0, 0x66, 0x50, 0xC6, 0xB2, 0x13, 0x51, 0x9D,
-    0x62, 0x23, 0x64, 0x46, 0x93, 0x68, 0x96, 0xB8, 0x4B, 0xCA, 0x2F, 0xDA, 0x52, 0xA8, 0x3E, 0x62,
-    0x7D, 0x0D, 0x51, 0xA9, 0x22, 0x85, 0xDF, 0x1F, 0x08, 0x8B, 0x31, 0x92, 0x07, 0xC2, 0x9B, 0xF4,
-    0xE2, 0xA5, 0x06, 0x1A, 0x70, 0x84, 0xDE, 0x96, 0x75, 0x46, 0x35, 0x18, 0x71, 0x00, 0x23, 0x26,
-    0xB9, 0x70, 0x92, 0xAC, 0x9F, 0xF2, 0x20, 0x0B, 0x13, 0xE3, 0x33, 0x81, 0x5B, 0x28, 0x2D, 0xA0,
-    0xF8, 0x80, 0x89, 0xA6, 0xD0, 0x17, 0x42, 0xE6, 0x2C, 0xC7, 0xDE, 0x76, 0x98, 0x87, 0xE5, 0xD6,
-    0xCE, 0x54, 0xE1, 0x35, 0x81, 0x31, 0xD6, 0x92, 0x61, 0x8C, 0xB0, 0x8D, 0x89, 0xEE, 0xFE, 0x7F,
-    0xE3, 0x74, 0x2B, 0xC3, 0x40, 0xCB, 0x0B, 0x82, 0x28, 0x06, 0x51, 0x32, 0x82, 0x27, 0x7C, 0xDB,
-    0x80, 0x52, 0x71, 0x2F, 0x9A, 0x03, 0x24, 0x4A, 0xBA, 0x6C, 0x00, 0x28, 0x01, 0xF7, 0x35, 0xD0,
-    0xCC, 0xA6, 0x7A, 0xDE, 0x2A, 0xF7, 0xDB, 0x78, 0xA0, 0x24, 0x8B, 0xE2, 0x7A, 0x9B, 0xB3, 0x0A,
-    0x27, 0xCB, 0x0B, 0x26, 0xBE, 0x61, 0xC9, 0x84, 0x34, 0x61, 0x0A, 0x09, 0x97, 0xBD, 0x5D, 0x1C,
-    0x84, 0x78, 0x79, 0x87, 0x9B, 0xEC, 0x4C, 0x5B, 0xED, 0x00, 0x2D, 0xD5, 0xAF, 0x7C, 0xF6, 0x1A,
-    0x66, 0xE0, 0xD9, 0x8F, 0xEC, 0x0F, 0x2D, 0x35, 0x79, 0x32, 0x41, 0x59, 0x8B, 0xDE, 0xB6, 0x7D,
-    0x05, 0xE9, 0xB7, 0x67, 0x6C, 0x23, 0xEB, 0x12, 0x00, 0x92, 0x5A, 0x40, 0xC7, 0x4C, 0x20, 0xDB,
-    0xA8, 0x70, 0xC4, 0x10, 0x6D, 0x5E, 0x85, 0x36, 0x92, 0x1B, 0xAE, 0xBF, 0x4C, 0x45, 0x84, 0xA1,
-    0x23, 0x1A, 0x85, 0x85, 0x88, 0xB2, 0x05, 0x27, 0x9E, 0x99, 0x70, 0x17, 0xE4, 0x63, 0x5A, 0xC1,
-    0xA5, 0x71, 0xB1, 0x62, 0x24, 0x66, 0x46, 0xFD, 0x2F, 0xB6, 0xAD, 0xAA, 0x63, 0x27, 0x98, 0xAD,
-    0x21, 0xA3, 0x9C, 0x5F, 0xDB, 0xE6, 0x3F, 0x02, 0x3B, 0x20, 0x06, 0xE0, 0xCF, 0xE8, 0x14, 0xD1,
-    0x58, 0x8F, 0x74, 0xC9, 0x42, 0xDD, 0x99, 0x54, 0x4D, 0xDE, 0x5F, 0xDD, 0x82, 0x78, 0xD7, 0xCB,
-    0xBA, 0x78, 0xCB, 0xB2, 0xFC, 0x5B, 0x97, 0x15, 0x1C, 0x5F, 0x56, 0xB7, 0x2C, 0x6B, 0xF8, 0x1D,
-    0x2E, 0x2B, 0xCB, 0x65, 0x78, 0x05, 0x11, 0x71, 0x0B, 0x54, 0x42, 0x0C, 0xE1, 0x8F, 0x90, 0x76,
-    0x85, 0x10, 0xD9, 0x99, 0x71, 0x41, 0x10, 0xF1, 0xBB, 0xD3, 0x02, 0x20, 0x7C, 0x2E, 0x5D, 0xF1,
-    0x43, 0x61, 0x57, 0xF0, 0x21, 0xE6, 0x2B, 0xD1, 0x83, 0x4F, 0x9E, 0x54, 0xF0, 0x50, 0xFC, 0x0D,
-    0x78, 0x84, 0xD8, 0x21, 0xEE, 0x52, 0xEB, 0xA0, 0x83, 0x58, 0x34, 0x61, 0x45, 0x45, 0x0E, 0x55,
-    0x19, 0x00, 0x0F, 0x83, 0x95, 0x7B, 0xA2, 0xB8, 0x9A, 0x8E, 0x19, 0x74, 0x0F, 0xB4, 0xB0, 0x4C,
-    0xB3, 0xC1, 0x34, 0x0B, 0xA8, 0xA9, 0x9B, 0x2F, 0xB4, 0x50, 0x67, 0x72, 0xA1, 0xC5, 0x05, 0xD1,
-    0x67, 0xAB, 0x0B, 0x9D, 0xBB, 0x10, 0xB7, 0xDE, 0x72, 0x01, 0x4E, 0x4A, 0x29, 0x70, 0xCD, 0x13,
-    0xBA, 0x5A, 0xA8, 0x3C, 0x81, 0x72, 0xB2, 0xB4, 0x9F, 0xE8, 0x86, 0xC1, 0xDB, 0xC3, 0x0E, 0xD4,
-    0xF0, 0x0E, 0x12, 0xF8, 0x77, 0xB5, 0x7F, 0xA3, 0xA1, 0x7F, 0xBC, 0x6B, 0xA2, 0x77, 0xF2, 0xE0,
-    0x57, 0xAD, 0xF7, 0x9B, 0xCE, 0xEC, 0xEE, 0x99, 0x4C, 0x0C, 0xFA, 0x6B, 0x5D, 0xFC, 0x96, 0xE8,
-    0xB9, 0xCC, 0x1B, 0x0E, 0x4C, 0xF2, 0x7C, 0x97, 0x89, 0xBF, 0xDD, 0x67, 0x4F, 0x35, 0x32, 0xC2,
-    0x99, 0xDF, 0x8C, 0x49, 0x29, 0x06, 0xCC, 0x8A, 0xB1, 0x2C, 0x84, 0xE4, 0x62, 0x6B, 0xDB, 0x14,
-    0x16, 0x7F, 0xF2, 0x6D, 0x7E, 0x28, 0xEA, 0x36, 0x6D, 0xE3, 0xC6, 0x1F, 0xBD, 0x1F, 0x7B, 0x9C,
-    0x8E, 0xB0, 0x08, 0x1C, 0x79, 0x51, 0x7B, 0x95, 0xD3, 0xC8, 0x9E, 0xB0, 0x8E, 0xFF, 0x22, 0x55,
-    0xB2, 0xFA, 0x63, 0xF0, 0xC3, 0x26, 0x3A, 0x17, 0xCB, 0xB5, 0xDA, 0xB9, 0x67, 0xF8, 0x18, 0x7C,
-    0x8E, 0xA4, 0x59, 0xAE, 0x59, 0xE3, 0x3C, 0x3B, 0xA2, 0x50, 0xD9, 0x0A, 0xD9, 0x51, 0x4B, 0x00,
-    0x11, 0xCE, 0xE7, 0xCE, 0x9D, 0xEF, 0xE8, 0x0E, 0xAA, 0x79, 0x70, 0x9E, 0xAC, 0xD0, 0x3C, 0x59,
-    0x5F, 0xB3, 0x80, 0xAC, 0x26, 0x1E, 0x60, 0x24, 0xC1, 0x4C, 0x15, 0xF6, 0x42, 0x38, 0x47, 0xAE,
-    0x8D, 0xB8, 0x6C, 0x0A, 0x51, 0xCA, 0x8D, 0x5C, 0x23, 0xDB, 0x9F, 0xE7, 0xB7, 0x88, 0x2E, 0xAE,
-    0xEC, 0x3C, 0x10, 0x8C, 0x67, 0x1B, 0xBC, 0x09, 0x1F, 0x4C, 0x3E, 0x0B, 0x15, 0x28, 0xC8, 0x53,
-    0x98, 0xDF, 0xA4, 0x2D, 0xBD, 0x30, 0xB1, 0xC8, 0xEA, 0xCF, 0x61, 0x49, 0xA2, 0x47, 0x02, 0x55,
-    0x27, 0x0C, 0x66, 0x24, 0x35, 0x2D, 0x54, 0x5A, 0xD3, 0x1C, 0x71, 0x57, 0x01, 0x3D, 0xF8, 0xCD,
-    0xD2, 0x12, 0xC9, 0x3A, 0x30, 0x89, 0x04, 0xFC, 0x7D, 0xF6, 0x8B, 0x32, 0x75, 0x45, 0xF6, 0x26,
-    0xB2, 0x0E, 0xA1, 0x13, 0x8F, 0xF8, 0xEA, 0xA0, 0x2F, 0x6E, 0xD4, 0xC9, 0x63, 0x2E, 0xBA, 0xA2,
-    0x52, 0x38, 0xEF, 0x1E, 0x17, 0x7F, 0x78, 0xEE, 0xDC, 0xA8, 0x56, 0x09, 0xA6, 0xA8, 0x84, 0xCD,
-    0x05, 0xCE, 0x51, 0xDC, 0xC3, 0x77, 0x08, 0x91, 0x52, 0x30, 0x1D, 0xD1, 0x54, 0x08, 0xDC, 0x24,
-    0x7C, 0x78, 0x08, 0xC8, 0x90, 0xE5, 0xFA, 0x41, 0x4E, 0x5D, 0x98, 0x6F, 0x00, 0x36, 0x9F, 0x1C,
-    0x77, 0x56, 0xCB, 0x06, 0x1A, 0xB8, 0x38, 0x18, 0x54, 0x1E, 0x99, 0xBC, 0x8F, 0x57, 0x55, 0x6F,
-    0xF8, 0x08, 0x0C, 0xB0, 0x80, 0xAB, 0x19, 0x80, 0x39, 0xE0, 0xB5, 0x84, 0x3B, 0x5C, 0x99, 0x87,
-    0x26, 0x9D, 0x27, 0xF6, 0x07, 0xE4, 0xB4, 0x54, 0xB6, 0x17, 0x73, 0xE7, 0x8B, 0xAA, 0x91, 0x56,
-    0x68, 0x98, 0xD0, 0x3A, 0x54, 0x8C, 0x08, 0x50, 0x2F, 0xD1, 0xF6, 0xB8, 0x0B, 0x14, 0xF6, 0x98,
-    0xA6, 0xA6, 0x6A, 0x8F, 0xD3, 0xE1, 0x21, 0xB8, 0x38, 0x1E, 0xF7, 0x2F, 0xE4, 0xEC, 0x22, 0xFB,
-    0xC2, 0x37, 0xE5, 0xE6, 0x79, 0xFD, 0x11, 0x7D, 0x55, 0xD3, 0x45, 0xBF, 0xD9, 0xE1, 0x04, 0x55,
-    0xF8, 0x2E, 0x74, 0x41, 0xFF, 0x5A, 0x3D, 0x68, 0x37, 0xB4, 0x4E, 0xC3, 0x53, 0x23, 0x55, 0xC8,
-    0x27, 0xEE, 0x97, 0x65, 0x1C, 0x7D, 0x63, 0x34, 0x1A, 0x43, 0x31, 0xBA, 0x53, 0xE9, 0x6A, 0xDB,
-    0x3A, 0x6E, 0xD7, 0x40, 0xDD, 0xF1, 0x8F, 0x77, 0xF6, 0xDB, 0x5E, 0x88, 0x3A, 0xEF, 0xEC, 0x12,
-    0x36, 0xBC, 0x83, 0xDF, 0xD6, 0xAF, 0x2F, 0x70, 0x76, 0x44, 0x2F, 0x6E, 0x72, 0x76, 0xBD, 0x00,
-    0x25, 0x22, 0x39, 0xF8, 0x0E, 0x44, 0x4C, 0x6E, 0x26, 0x22, 0x90, 0x41, 0x04, 0xBF, 0x4E, 0xD0,
-    0x4A, 0x04, 0xEF, 0x59, 0x78, 0x43, 0x18, 0x46, 0x79, 0x25, 0xCB, 0x65, 0x1B, 0xFD, 0x21, 0x20,
-    0xB6, 0x87, 0xF3, 0x33, 0xC5, 0xD4, 0x9B, 0x0C, 0x75, 0x14, 0x34, 0x19, 0xED, 0x1A, 0xDB, 0x97,
-    0x0B, 0x0E, 0x56, 0x58, 0x45, 0x44, 0x45, 0x22, 0x33, 0x8C, 0xE1, 0x41, 0x8B, 0xFE, 0x6B, 0x8D,
-    0x12, 0x60, 0x6E, 0x19, 0x83, 0x41, 0x9B, 0x6C, 0x7C, 0x52, 0x79, 0xE2, 0x83, 0xEB, 0x97, 0x1A,
-    0x8C, 0xE9, 0x77, 0x11, 0x38, 0xB0, 0x8B, 0xC1, 0x51, 0xFD, 0xC3, 0x22, 0x51, 0x5E, 0xF7, 0x98,
-    0xCC, 0x23, 0xE8, 0xB6, 0x21, 0x4F, 0x6D, 0x56, 0x66, 0x65, 0x51, 0x53, 0xF8, 0xCB, 0x84, 0x3B,
-    0x10, 0x92, 0xFB, 0xCD, 0x77, 0xED, 0xF5, 0x7C, 0x21, 0xA5, 0xBF, 0xB1, 0xBD, 0xEA, 0xB7, 0x29,
-    0x2D, 0x35, 0x1C, 0xA6, 0x2E, 0x9C, 0x52, 0x8D, 0x98, 0x6A, 0x4F, 0xC1, 0x63, 0xA1, 0xA1, 0xC8,
-    0x42, 0xA3, 0x25, 0x45, 0x4E, 0x75, 0x84, 0x6F, 0xF2, 0x88, 0x82, 0xA1, 0x2C, 0x65, 0x8F, 0xA4,
-    0xE5, 0x37, 0xC1, 0xE0, 0xDC, 0xBC, 0x8A, 0x74, 0x15, 0xA6, 0xA8, 0xCD, 0xCA, 0x1B, 0x70, 0xC4,
-    0x36, 0x08, 0x4D, 0xF2, 0x9B, 0xF2, 0x58, 0xE1, 0xB8, 0xE8, 0x1A, 0xE7, 0x54, 0xBC, 0xAB, 0x6E,
-    0x6A, 0x4B, 0x67, 0xB6, 0xE8, 0xC8, 0xA0, 0x45, 0x47, 0x77, 0x09, 0x71, 0xA9, 0x8E, 0xDF, 0x70,
-    0x35, 0xEB, 0xA9, 0xA8, 0xB2, 0x9E, 0x6A, 0x8B, 0x5F, 0x9F, 0xC3, 0x16, 0x9E, 0xD2, 0xD0, 0x49,
-    0x02, 0x0F, 0x2F, 0x05, 0x08, 0xDD, 0xC6, 0x86, 0xEE, 0xC2, 0x63, 0xD9, 0x07, 0x7C, 0x19, 0xB1,
-    0xA3, 0x22, 0xC9, 0xAD, 0x20, 0xF4, 0x10, 0x21, 0x91, 0x08, 0x72, 0x4F, 0xCF, 0x28, 0x41, 0x08,
-    0x95, 0x8E, 0x11, 0xC5, 0x3E, 0x83, 0xE8, 0x42, 0x3F, 0x9C, 0x9B, 0x73, 0xBA, 0x45, 0x7C, 0x71,
-    0x5E, 0xD1, 0x06, 0x04, 0x1D, 0x57, 0x91, 0x5C, 0xF7, 0x25, 0x1E, 0xD3, 0x7E, 0x08, 0x7D, 0x23,
-    0xFE, 0x52, 0x2F, 0x53, 0x4A, 0x0C, 0x44, 0x5F, 0x66, 0x94, 0x31, 0x02, 0x23, 0x13, 0x9A, 0x42,
-    0x84, 0xE4, 0x76, 0x84, 0x5E, 0xF2, 0x83, 0x60, 0x7E, 0x53, 0xF5, 0xD8, 0x32, 0xB1, 0x8F, 0x37,
-    0xC4, 0xB2, 0x8F, 0xC2, 0x60, 0x4F, 0xDF, 0x3E, 0x66, 0x16, 0xAE, 0x82, 0xA3, 0xE2, 0xE1, 0x9D,
-    0x0D, 0x60, 0xFF, 0x46, 0x59, 0xC8, 0xA1, 0xEC, 0xD0, 0xBE, 0x4C, 0x29, 0xCD, 0x31, 0x73, 0xF9,
-    0x4F, 0x54, 0x5D, 0xD0, 0x85, 0xD0, 0x75, 0x83, 0x8F, 0x35, 0xEF, 0x22, 0x24, 0x2C, 0xF4, 0x10,
-    0x86, 0x29, 0xE3, 0x3A, 0x91, 0x35, 0x06, 0x2D, 0x16, 0xEE, 0x75, 0xF2, 0xFF, 0x20, 0x9F, 0x85,
-    0x53, 0x88, 0x20, 0xB9, 0x7C, 0x3E, 0x4F, 0x40, 0x8E, 0x3A, 0x92, 0x67, 0xF8, 0x5D, 0xC0, 0x67,
-    0x08, 0xDD, 0xAC, 0x75, 0x70, 0x59, 0xD8, 0x2B, 0xB1, 0x8E, 0x08, 0xB7, 0xCE, 0xE4, 0xE0, 0x5E,
-    0x66, 0xB2, 0xA7, 0x33, 0xC9, 0x37, 0x66, 0x22, 0xDB, 0x11, 0xC0, 0x69, 0xC2, 0x4C, 0xF6, 0xE9,
-    0x91, 0x63, 0x26, 0x29, 0x94, 0x36, 0x9E, 0x51, 0x73, 0x26, 0xD7, 0x7F, 0x32, 0x5F, 0x3C, 0x52,
-    0x53, 0xD6, 0x66, 0xEA, 0x03, 0x6A, 0x34, 0x7D, 0xE5, 0x09, 0xE8, 0xB6, 0xA8, 0xF3, 0xA3, 0xDE,
-    0x0F, 0x7C, 0xE6, 0x54, 0x78, 0x0C, 0x08, 0x26, 0xA0, 0xE5, 0xD8, 0xD6, 0x38, 0x1A, 0x7D, 0x5A,
-    0x06, 0xD7, 0x06, 0xDD, 0x33, 0xB9, 0xED, 0x2A, 0xB4, 0x12, 0x26, 0x83, 0xA5, 0xC4, 0x32, 0x91,
-    0xA0, 0xC9, 0x74, 0x0F, 0x77, 0x84, 0x35, 0x8A, 0x00, 0x4E, 0x0B, 0x98, 0x40, 0xB4, 0x16, 0xE4,
-    0x4D, 0x90, 0xEF, 0xBC, 0x09, 0x0E, 0x3F, 0xE7, 0x82, 0x3F, 0xB3, 0xFA, 0xCB, 0x59, 0x4D, 0x8F,
-    0x19, 0x11, 0xFB, 0x52, 0xF5, 0x68, 0xAF, 0x61, 0xC6, 0x44, 0xB5, 0x15, 0x07, 0x8F, 0x5B, 0x4E,
-    0x08, 0xB8, 0xA5, 0xD1, 0xDD, 0xAE, 0x44, 0x6F, 0xE3, 0x33, 0xD0, 0x9E, 0x05, 0x22, 0x4F, 0x05,
-    0x84, 0x34, 0xC9, 0x05, 0xA9, 0xF2, 0x33, 0x31, 0xF0, 0x0E, 0xA6, 0x85, 0x71, 0x84, 0x6B, 0x61,
-    0x84, 0x0F, 0x84, 0x33, 0x42, 0x66, 0x06, 0x26, 0x88, 0x19, 0xE6, 0x08, 0x3B, 0x2F, 0x14, 0xF2,
-    0x2C, 0x1C, 0xA2, 0x91, 0xE0, 0x50, 0x6C, 0xA5, 0xD3, 0x75, 0xEB, 0xA0, 0x76, 0xE7, 0xFC, 0xFA,
-    0xDB, 0x52, 0x65, 0xF7, 0x6E, 0x54, 0x49, 0xEE, 0x91, 0x2A, 0x08, 0x67, 0xB4, 0x04, 0x14, 0x70,
-    0x54, 0x26, 0xCF, 0x96, 0xD4, 0xAF, 0x35, 0x43, 0x18, 0x2D, 0xC6, 0x90, 0xE5, 0xFD, 0xDD, 0xC2,
-    0xDB, 0xC1, 0xEA, 0x35, 0x5B, 0x0C, 0x47, 0x4B, 0xFB, 0xD8, 0xAC, 0x32, 0x24, 0xEA, 0xF5, 0x0A,
-    0x6D, 0x1E, 0x69, 0xA1, 0x51, 0x33, 0xFB, 0x5F, 0x05, 0x6E, 0x66, 0x2B, 0xFE, 0xEC, 0x9C, 0xE5,
-    0xA1, 0x5B, 0x82, 0xE0, 0xF8, 0x2D, 0xD1, 0x1C, 0x91, 0xAD, 0xF3, 0x47, 0x0C, 0x87, 0xC0, 0xEC,
-    0x26, 0x65, 0xDA, 0x26, 0x10, 0xFC, 0x02, 0xC3, 0x66, 0x1E, 0x73, 0x2B, 0x99, 0xFC, 0x28, 0xB4,
-    0xD9, 0x93, 0x4D, 0x91, 0x6F, 0xD0, 0xF6, 0xE0, 0x5E, 0xD9, 0x04, 0x5F, 0xE4, 0x45, 0x56, 0x1F,
-    0x08, 0x1C, 0xD8, 0x83, 0x73, 0x49, 0x1D, 0x2E, 0x0C, 0x8C, 0x6F, 0xD0, 0x22, 0xF0, 0xC1, 0xCA,
-    0xA8, 0x86, 0xFE, 0x96, 0xDF, 0x85, 0xF8, 0xB3, 0xEC, 0xBE, 0x7D, 0xEF, 0x92, 0xE0, 0x4E, 0x43,
-    0xAD, 0x9C, 0x62, 0x49, 0x8D, 0xD0, 0x3B, 0x01, 0x0C, 0xDE, 0x92, 0x15, 0x5C, 0xDD, 0x9C, 0xDB,
-    0xC9, 0x8B, 0x2F, 0xD1, 0x5E, 0x37, 0x34, 0xA3, 0xE4, 0x8F, 0x1D, 0x30, 0xB7, 0x78, 0x5A, 0x08,
-    0x12, 0xE4, 0xA0, 0xDA, 0x2E, 0x74, 0xBA, 0xCC, 0x87, 0xB9, 0x20, 0xF8, 0x1D, 0xDB, 0x46, 0x23,
-    0x14, 0x1A, 0xA2, 0x60, 0x38, 0x02, 0xB0, 0x49, 0xB8, 0xBD, 0x7A, 0x41, 0x68, 0x1F, 0xD1, 0xD9,
-    0x2E, 0x18, 0xC2, 0x1C, 0x61, 0x0A, 0x93, 0x96, 0x5C, 0x92, 0xC3, 0xB1, 0x18, 0x61, 0xD4, 0xA1,
-    0x5B, 0x1B, 0x31, 0xE8, 0xC2, 0x1E, 0x82, 0x0F, 0x62, 0xCD, 0x1F, 0x2D, 0x78, 0xC2, 0xA7, 0x83,
-    0x39, 0x75, 0x74, 0xEF, 0xB2, 0x26, 0x6D, 0x01, 0x78, 0x11, 0xC3, 0x45, 0xFC, 0x62, 0x0C, 0x00,
-    0x9D, 0x76, 0x44, 0x03, 0x0A, 0x93, 0x67, 0xA5, 0xE0, 0x58, 0x11, 0x17, 0x79, 0x8C, 0xFD, 0xA6,
-    0xED, 0x60, 0xE2, 0xB1, 0x75, 0x42, 0xA4, 0x79, 0xCF, 0x44, 0xF3, 0x13, 0x4B, 0xAA, 0xC9, 0xBB,
-    0x78, 0x05, 0xB3, 0x64, 0xE0, 0xB9, 0x51, 0x50, 0x41, 0x91, 0x3D, 0x58, 0x54, 0x69, 0xD0, 0xFD,
-    0x95, 0x08, 0xC1, 0x07, 0xCE, 0x94, 0xE5, 0x91, 0xCD, 0xC5, 0xCD, 0x44, 0x1E, 0x22, 0x06, 0xF2,
-    0xC5, 0x6E, 0xD5, 0x4C, 0x69, 0xA4, 0x18, 0x53, 0x58, 0x49, 0x5C, 0xF6, 0x56, 0x60, 0x69, 0x0C,
-    0x65, 0x10, 0x81, 0x05, 0x7C, 0x2A, 0xA8, 0xE2, 0x2A, 0x53, 0x2A, 0x17, 0xF0, 0x86, 0x38, 0x78,
-    0xB2, 0x69, 0x9D, 0x79, 0x4E, 0x66, 0xFE, 0xB0, 0xD0, 0x5D, 0xF4, 0x9C, 0x18, 0xF5, 0x48, 0x63,
-    0x05, 0x62, 0x57, 0x45, 0x2B, 0xED, 0x08, 0xF7, 0x6F, 0xCB, 0x7E, 0x0B, 0x95, 0x47, 0x91, 0x83,
-    0x43, 0xFF, 0xE3, 0x6F, 0xDA, 0xDC, 0x69, 0x7E, 0xB1, 0xAC, 0x0B, 0x57, 0x87, 0x1A, 0x99, 0x11,
-    0x46, 0xAF, 0x9D, 0xFA, 0x87, 0xA6, 0xF1, 0x8F, 0xE9, 0xE8, 0x6A, 0x31, 0xAA, 0xB0, 0x72, 0x49,
-    0xE3, 0x32, 0x12, 0x40, 0x02, 0x34, 0xC1, 0xD5, 0x46, 0x6A, 0x14, 0x24, 0x08, 0xB1, 0x63, 0xDB,
-    0xD0, 0xF7, 0x7D, 0x84, 0xC0, 0x90, 0x3C, 0x67, 0x5B, 0x9E, 0xEC, 0x75, 0x21, 0x6C, 0x93, 0xAC,
-    0x72, 0x5B, 0x28, 0x1E, 0x74, 0xE0, 0x4F, 0xD1, 0x98, 0x32, 0x94, 0xA8, 0x50, 0xF1, 0x4A, 0x40,
-    0xE0, 0x99, 0x3C, 0x0F, 0x3D, 0xF8, 0xBC, 0x8C, 0xB7, 0x8F, 0xB0, 0x5E, 0xFB, 0x88, 0x31, 0x0F,
-    0xBA, 0x3C, 0x09, 0xEC, 0x6B, 0xDA, 0xC4, 0xD0, 0x14, 0xCF, 0x32, 0x28, 0xB5, 0x6D, 0xBE, 0x39,
-    0x46, 0x2E, 0xDE, 0x32, 0x24, 0x2F, 0xE4, 0x2A, 0xED, 0xD9, 0x02, 0x0B, 0xC4, 0x6F, 0xFA, 0x12,
-    0x13, 0x68, 0xB1, 0x0B, 0x79, 0x2D, 0x0E, 0x7D, 0x21, 0x76, 0x16, 0x4B, 0x13, 0x57, 0x07, 0xA1,
-    0xF2, 0x60, 0x88, 0x46, 0x20, 0x88, 0xB0, 0xCB, 0x3A, 0x20, 0x81, 0xB8, 0xB1, 0x67, 0xB0, 0x8F,
-    0xE9, 0x6B, 0x23, 0xB7, 0xB2, 0xF8, 0xD6, 0xBB, 0xB4, 0xF3, 0x73, 0x45, 0x9C, 0xE0, 0x6B, 0xB2,
-    0x0B, 0x1B, 0x9E, 0x2B, 0xFA, 0x53, 0xAD, 0x5D, 0x11, 0x37, 0x61, 0xCF, 0x9A, 0x8D, 0xC8, 0x47,
-    0xA2, 0xF1, 0x0E, 0xDF, 0x5E, 0xFA, 0x84, 0x96, 0x7F, 0xB0, 0x3F, 0x83, 0xA3, 0x63, 0x7F, 0x60,
-    0x81, 0x5E, 0x8B, 0x21, 0x1B, 0xB2, 0x49, 0x3E, 0x53, 0xDA, 0x16, 0xE8, 0xD3, 0xE4, 0xF2, 0x81,
-    0xFC, 0x4F, 0xCD, 0x2B, 0x06, 0xAE, 0x7C, 0x20, 0x2B, 0x12, 0x69, 0x85, 0x5D, 0x35, 0xDF, 0xED,
-    0x98, 0xF3, 0x14, 0xD7, 0x5E, 0x84, 0x18, 0xE4, 0x1A, 0x43, 0x3B, 0x7A, 0xD5, 0x55, 0x84, 0x72,
-    0xA9, 0xE6, 0xC4, 0xED, 0x2E, 0x65, 0x33, 0xB6, 0x4C, 0x34, 0xC9, 0x1D, 0x07, 0x00, 0x5A, 0x6F,
-    0x0B, 0x85, 0x76, 0x4F, 0x99, 0x3E, 0x6C, 0x7B, 0xE1, 0x86, 0xB0, 0x4E, 0x83, 0x2E, 0x35, 0x22,
-    0xF2, 0x43, 0xF0, 0x6E, 0x17, 0xB6, 0xC9, 0x79, 0x11, 0xC0, 0xC3, 0x5E, 0xD8, 0xDE, 0xE6, 0x61,
-    0x27, 0x20, 0x32, 0x2D, 0x65, 0x2F, 0xB1, 0xB7, 0xF7, 0x7B, 0xA5, 0xE0, 0xE6, 0x79, 0xC1, 0xC5,
-    0xFD, 0x46, 0xCE, 0x27, 0x02, 0xE8, 0xDF, 0x86, 0x1C, 0xC9, 0xFD, 0xF2, 0x54, 0xFF, 0x13, 0x91,
-    0x9C, 0xE4, 0x5B, 0x62, 0x57, 0xFB, 0x2B, 0x41, 0x93, 0x3C, 0xDF, 0x24, 0x66, 0x48, 0xB0, 0x75,
-    0xFB, 0x41, 0x3B, 0x06, 0x6D, 0xFC, 0xB7, 0x75, 0x52, 0xEE, 0xEE, 0x9B, 0x03, 0xF1, 0x51, 0x83,
-    0x4E, 0xC4, 0x3B, 0xA9, 0x05, 0x0E, 0x1D, 0xCA, 0xC7, 0xE9, 0x4D, 0x76, 0xA2, 0xBE, 0x76, 0x91,
-    0x03, 0x45, 0x90, 0x79, 0x10, 0x62, 0xA7, 0x4F, 0x35, 0x26, 0x40, 0x98, 0x79, 0x0F, 0xAA, 0x88,
-    0x71, 0xFC, 0x86, 0x7E, 0x14, 0x33, 0x88, 0xC2, 0x01, 0xA2, 0x70, 0xDF, 0x96, 0xB7, 0x46, 0x01,
-    0x4B, 0x49, 0x29, 0x42, 0x8E, 0x40, 0x16, 0xB3, 0xC3, 0xC2, 0x77, 0x23, 0xB7, 0x02, 0xE9, 0x98,
-    0x44, 0x0C, 0xCC, 0x29, 0xA1, 0xC2, 0x96, 0xA8, 0x9A, 0x1D, 0x91, 0xEA, 0x2B, 0x22, 0x02, 0x7D,
-    0x54, 0x8B, 0x38, 0x94, 0x7E, 0x1B, 0xE7, 0x41, 0x93, 0x52, 0x3C, 0x32, 0xA1, 0xD6, 0xA1, 0xE6,
-    0xAC, 0x44, 0x5B, 0xBD, 0x68, 0xBC, 0x97, 0xC0, 0xD6, 0xE2, 0x79, 0xCB, 0xC0, 0x22, 0xA9, 0x33,
-    0x9C, 0x6D, 0x79, 0xB4, 0x80, 0x32, 0x2B, 0xB8, 0xAD, 0x8E, 0xAE, 0xD5, 0xE9, 0xA1, 0xD9, 0xAE,
-    0xBC, 0xB9, 0x37, 0x47, 0x63, 0xFC, 0x7A, 0x1D, 0xBD, 0xDD, 0x1F, 0xCA, 0xE0, 0xF1, 0xAF, 0x3E,
-    0x14, 0xC4, 0x90, 0xD9, 0xA7, 0xDA, 0xB0, 0xB5, 0x43, 0x91, 0x67, 0x5F, 0xB7, 0xAF, 0x4E, 0x66,
-    0x8A, 0xA6, 0x58, 0xB8, 0x2C, 0xE9, 0x8A, 0x3A, 0xAB, 0x0B, 0x59, 0xF1, 0x2C, 0x48, 0xA8, 0x0F,
-    0xD5, 0x5F, 0x85, 0xE7, 0x2C, 0xA3, 0x31, 0x5A, 0x0D, 0x55, 0x91, 0x41, 0x5F, 0x7B, 0x4C, 0x03,
-    0x8B, 0xD0, 0x1C, 0x42, 0xFA, 0x84, 0x2C, 0xEE, 0x42, 0xC7, 0x0B, 0x25, 0x2E, 0x4C, 0xE4, 0xA7,
-    0x8E, 0x01, 0xED, 0x3A, 0x58, 0x21, 0x98, 0x1E, 0x4A, 0x31, 0xAB, 0x45, 0x1E, 0x3D, 0xA8, 0x0F,
-    0x20, 0x74, 0x5C, 0x68, 0xF4, 0x82, 0xFB, 0x3A, 0x7F, 0x15, 0x2E, 0x54, 0xED, 0xCD, 0xDE, 0x80,
-    0x07, 0x03, 0x3E, 0x36, 0x32, 0x74, 0x2F, 0xF2, 0xB2, 0x2B, 0xD6, 0x20, 0x95, 0xAD, 0x8D, 0x5F,
-    0x13, 0x10, 0xD9, 0x08, 0x3F, 0x76, 0xD9, 0xFB, 0xD5, 0x40, 0x87, 0x59, 0xA3, 0x95, 0x42, 0xDF,
-    0x6A, 0x53, 0xB7, 0xC3, 0x75, 0xA5, 0x4E, 0x2C, 0xE5, 0xD3, 0x07, 0x1E, 0x8A, 0x00, 0x22, 0x28,
-    0x4F, 0xBA, 0xA1, 0x62, 0x75, 0xFA, 0x45, 0xD8, 0x0B, 0xA8, 0x77, 0x38, 0x1B, 0x71, 0x03, 0x7F,
-    0x51, 0x56, 0xE2, 0x8D, 0xB2, 0x90, 0x18, 0x21, 0xD1, 0x2C, 0xAF, 0x14, 0x17, 0xDE, 0x7F, 0x52,
-    0x9E, 0xED, 0xFF, 0x9A, 0x8E, 0xDD, 0xB5, 0xEB, 0x40, 0xC4, 0x03, 0x98, 0xCE, 0x96, 0x62, 0x26,
-    0x90, 0xFD, 0x2D, 0x61, 0x62, 0xB7, 0xA9, 0x80, 0x7A, 0xC6, 0x12, 0x6A, 0x86, 0x12, 0x00, 0xC3,
-    0xE1, 0x02, 0xDB, 0x06, 0x16, 0x78, 0x9D, 0xEC, 0x8E, 0x3E, 0x81, 0xB5, 0xCC, 0x9E, 0xB0, 0x0C,
-    0xBF, 0x9C, 0x5D, 0x52, 0xD9, 0xC5, 0xDA, 0x5F, 0x48, 0x36, 0xBC, 0xAE, 0xFE, 0x26, 0x8B, 0x7A,
-    0xD2, 0x96, 0x42, 0x26, 0x93, 0x1E, 0x7D, 0x1B, 0xAE, 0x23, 0xB0, 0xEB, 0xA1, 0x1A, 0x71, 0xE4,
-    0x8B, 0x0E, 0xD4, 0x89, 0x60, 0x68, 0x17, 0x91, 0x8C, 0xF7, 0x5E, 0x94, 0x7B, 0x1B, 0xC6, 0x91,
-    0xAA, 0xC9, 0x39, 0x01, 0xF8, 0xBA, 0x36, 0x9F, 0x8D, 0x6A, 0x82, 0x78, 0xA0, 0x1D, 0x06, 0x24,
-    0x33, 0xF7, 0xFF, 0xA1, 0x73, 0x63, 0x46, 0x05, 0xC5, 0x98, 0x50, 0xD0, 0xAB, 0xAA, 0xA5, 0x03,
-    0x23, 0x9F, 0x89, 0xE1, 0xBB, 0x89, 0x86, 0x8B, 0xB8, 0xC8, 0x43, 0x7C, 0x0F, 0xD5, 0x77, 0x83,
-    0x56, 0x0E, 0x86, 0x90, 0xF1, 0x95, 0x09, 0x0F, 0x60, 0x5E, 0x86, 0xEA, 0xC9, 0x56, 0x54, 0x3E,
-    0x8D, 0xF3, 0x63, 0x5D, 0x5E, 0x26, 0xBB, 0x29, 0x2F, 0x43, 0x03, 0x15, 0x6A, 0x0A, 0xA7, 0x76,
-    0xB9, 0x5E, 0x0D, 0x6B, 0x15, 0xB8, 0x29, 0x5A, 0x36, 0x79, 0x67, 0x95, 0xDC, 0xA3, 0xD5, 0xE2,
-    0xB2, 0x5A, 0x6F, 0x08, 0x7A, 0x81, 0xD9, 0xC8, 0xC2, 0xF4, 0x91, 0xE8, 0x0C, 0x81, 0x93, 0xA0,
-    0x6D, 0x7F, 0x6A, 0xC3, 0x8F, 0xCB, 0x60, 0xCF, 0x9A, 0xEC, 0xBD, 0xE2, 0xBF, 0x58, 0xF5, 0xE3,
-    0xF2, 0x84, 0xF9, 0x7D, 0xE7, 0xC7, 0x31, 0x3A, 0xA0, 0xBB, 0xBE, 0xF8, 0x71, 0xC3, 0xFA, 0x55,
-    0x73, 0x8E, 0xF1, 0x46, 0xD9, 0x44, 0x02, 0xEB, 0x21, 0xE3, 0x6D, 0x1B, 0x62, 0x71, 0xA1, 0x4E,
-    0xC6, 0xBC, 0x0B, 0x10, 0x5D, 0x46, 0xE5, 0xBB, 0xF8, 0xA2, 0x1A, 0x67, 0x20, 0x3C, 0xE3, 0x56,
-    0x54, 0x20, 0x8D, 0x05, 0x69, 0xAD, 0x46, 0x9C, 0x18, 0xD2, 0x09, 0x5C, 0xBE, 0x52, 0x58, 0x36,
-    0xAA, 0x49, 0x5F, 0xA6, 0x95, 0xC5, 0xDF, 0x6F, 0x98, 0x67, 0x06, 0x0C, 0x80, 0x64, 0xB4, 0x48,
-    0x90, 0x8A, 0x59, 0x95, 0x51, 0xF7, 0xD5, 0x5A, 0xC5, 0xA5, 0xEC, 0xCC, 0x16, 0xD2, 0xD5, 0x1D,
-    0x8C, 0x0A, 0x0D, 0x0F, 0xA1, 0xFB, 0x42, 0x28, 0x86, 0x9E, 0x31, 0x27, 0x11, 0x6C, 0xDF, 0xF8,
-    0x5E, 0xED, 0xD7, 0xAF, 0x98, 0xEE, 0x71, 0xF3, 0xDC, 0x97, 0xCD, 0x63, 0x91, 0x89, 0x03, 0x71,
-    0x44, 0x44, 0xEB, 0x6E, 0x3F, 0x23, 0x2A, 0x4B, 0x6C, 0xEE, 0x0F, 0x0D, 0xF8, 0xDA, 0x25, 0xA4,
-    0x77, 0x96, 0xE5, 0x1E, 0x9A, 0x07, 0x04, 0x12, 0x4D, 0x22, 0x44, 0xFB, 0xF2, 0xCC, 0x03, 0xF1,
-    0x43, 0x30, 0x9B, 0x41, 0xAC, 0xA4, 0x00, 0x56, 0x21, 0xBE, 0x38, 0x1E, 0xE2, 0x44, 0x8B, 0x7F,
-    0xA1, 0x0E, 0x4D, 0xD4, 0x04, 0xAD, 0x38, 0x15, 0xB5, 0xFC, 0x54, 0xAB, 0xA3, 0x23, 0x30, 0xA0,
-    0x16, 0x67, 0x23, 0x97, 0xD9, 0x6A, 0xCE, 0xDA, 0xF9, 0x39, 0x05, 0x37, 0xE1, 0xB7, 0x1C, 0xA5,
-    0xBD, 0xE7, 0x51, 0xFA, 0x6C, 0x1D, 0x02, 0xB9, 0x05, 0xDD, 0xAA, 0x0B, 0xC3, 0x0C, 0x96, 0x0C,
-    0x8A, 0x08, 0x2B, 0x78, 0xCF, 0x7F, 0xB9, 0x73, 0x84, 0x83, 0xEB, 0x99, 0xE6, 0x9A, 0x7F, 0x0A,
-    0xAE, 0xBF, 0x0C, 0x9F, 0xF6, 0x14, 0x12, 0xEA, 0x62, 0x59, 0x44, 0x63, 0xD7, 0x62, 0xAE, 0x5A,
-    0x6F, 0xF2, 0x14, 0x80, 0x21, 0x3A, 0xBF, 0xE9, 0xA0, 0xE6, 0xA8, 0x31, 0x0A, 0x00, 0x32, 0xA8,
-    0xD1, 0x8C, 0xB9, 0x02, 0x51, 0x15, 0x4B, 0x04, 0xC9, 0xA3, 0xAC, 0xED, 0x0B, 0x62, 0xCB, 0xC5,
-    0x12, 0xBD, 0x7F, 0x49, 0xA6, 0xBC, 0x67, 0xC2, 0x72, 0x1F, 0xD0, 0x5F, 0xF4, 0x55, 0x6D, 0x76,
-    0xC0, 0x4D, 0x41, 0x47, 0x8F, 0xF2, 0xEB, 0x1D, 0xB0, 0x50, 0x4C, 0xD4, 0xBF, 0x87, 0x40, 0xD8,
-    0xDA, 0x0F, 0xFE, 0x82, 0x93, 0x87, 0x2B, 0xCE, 0x95, 0xE8, 0xD5, 0xD7, 0xF0, 0x29, 0x3A, 0x73,
-    0x1E, 0xBE, 0xFF, 0x32, 0x1E, 0x76, 0x25, 0xE6, 0x03, 0xCD, 0x95, 0x24, 0xF7, 0x86, 0xD4, 0x3C,
-    0xD4, 0x65, 0xCA, 0x1F, 0x79, 0x65, 0x37, 0x55, 0xCC, 0xA5, 0x23, 0x08, 0x01, 0xCC, 0x54, 0x84,
-    0x92, 0x18, 0xAC, 0x9B, 0x0F, 0x75, 0x00, 0x8C, 0xB9, 0xDB, 0x8C, 0x9F, 0x20, 0x7B, 0xB7, 0xF7,
-    0x0B, 0xCB, 0xFA, 0x57, 0x43, 0xEE, 0x63, 0x4D, 0x78, 0xE7, 0xDB, 0x63, 0xD1, 0x31, 0x71, 0x26,
-    0x85, 0xA2, 0x3B, 0xFE, 0x6C, 0x85, 0xA3, 0x0F, 0x64, 0x72, 0x03, 0x8C, 0x5B, 0x2C, 0x9C, 0xB5,
-    0xE3, 0x75, 0x57, 0x60, 0xE7, 0x62, 0x99, 0x7E, 0xF0, 0xA6, 0xE8, 0xC5, 0x72, 0x77, 0x0B, 0xA8,
-    0x4C, 0x88, 0x9F, 0x98, 0x19, 0xBE, 0x41, 0x2C, 0xF3, 0xDE, 0xF5, 0xBA, 0x43, 0x91, 0xD9, 0x53,
-    0xD1, 0x7C, 0xA9, 0x0F, 0xC4, 0xF1, 0x99, 0xCC, 0x69, 0x20, 0xCE, 0xB0, 0x3C, 0x69, 0x6F, 0x2A,
-    0x7A, 0x03, 0xFE, 0x8A, 0x2F, 0x20, 0x25, 0x28, 0xA3, 0x44, 0xD0, 0xC2, 0x8C, 0x4B, 0xB4, 0x8C,
-    0x41, 0x04, 0x0E, 0xF9, 0x81, 0xB9, 0xBD, 0xF9, 0x09, 0xC4, 0x0B, 0x45, 0x7A, 0xC0, 0x57, 0x8C,
-    0x46, 0x1E, 0x88, 0x34, 0x09, 0x6E, 0xDB, 0x37, 0x85, 0x73, 0x8B, 0x16, 0x78, 0xCC, 0x1A, 0x31,
-    0x0D, 0x3E, 0xDE, 0xB5, 0x70, 0xEB, 0xE4, 0xAC, 0x26, 0x5E, 0xC0, 0x27, 0x12, 0x86, 0x21, 0x64,
-    0xF3, 0x74, 0xD0, 0x9E, 0xB8, 0x84, 0x30, 0xC6, 0x08, 0x53, 0xF4, 0xBD, 0xA3, 0xA7, 0x55, 0xD3,
-    0x72, 0x80, 0x8C, 0xA0, 0x2B, 0xF7, 0x10, 0x46, 0x82, 0x15, 0x23, 0x36, 0xEE, 0x34, 0x69, 0xA4,
-    0x9E, 0x53, 0x0E, 0x12, 0xC9, 0x37, 0xEF, 0x45, 0xF3, 0xED, 0xE3, 0xFA, 0xDF, 0xF8, 0x57, 0xCF,
-    0x63, 0x71, 0x49, 0x19, 0xC0, 0x66, 0x9D, 0x12, 0x26, 0x02, 0xFB, 0xB5, 0x18, 0x25, 0x87, 0x23,
-    0x89, 0x04, 0xB3, 0xE6, 0x2A, 0x19, 0x10, 0x13, 0x96, 0x3F, 0x1B, 0xB8, 0xC2, 0x2B, 0x46, 0x0E,
-    0x5B, 0xF1, 0xD5, 0x5E, 0x5A, 0xD4, 0x68, 0xD0, 0x2D, 0xB9, 0xBA, 0xBD, 0xEF, 0x76, 0x5A, 0x74,
-    0x55, 0xBD, 0x97, 0xDF, 0xFC, 0xDE, 0xCE, 0x79, 0xB1, 0x64, 0x37, 0x88, 0x61, 0x64, 0xF7, 0x8B,
-    0xAB, 0x71, 0x23, 0x5A, 0x3B, 0x29, 0x45, 0xBD, 0x6E, 0x09, 0xCD, 0x44, 0x2C, 0xA1, 0xB0, 0x18,
-    0xCA, 0x11, 0x3B, 0x36, 0xC0, 0x08, 0x36, 0x32, 0x01, 0x35, 0xA1, 0xA8, 0x7A, 0xEA, 0xE0, 0x49,
-    0x0B, 0x80, 0xFB, 0x22, 0xB3, 0xC8, 0xA3, 0x2B, 0x99, 0x60, 0xDE, 0x27, 0x5D, 0xF3, 0xDF, 0x5F,
-    0x18, 0xAA, 0x1D, 0xF5, 0x95, 0xB7, 0xDC, 0xD8, 0x7E, 0x77, 0x13, 0xAD, 0x3F, 0x3B, 0xAF, 0x00,
-    0x69, 0xF5, 0x4A, 0x18, 0xE2, 0x08, 0x00, 0x4C, 0xFC, 0x15, 0x38, 0xDD, 0x57, 0x58, 0xB2, 0xA0,
-    0x25, 0x46, 0x31, 0xD2, 0x77, 0x35, 0x53, 0x57, 0x30, 0xD0, 0xF7, 0x5D, 0x10, 0xF2, 0xF4, 0x81,
-    0xA6, 0xEC, 0x87, 0x8D, 0xCD, 0x32, 0xC5, 0xF5, 0x9C, 0xE0, 0x65, 0xFA, 0xB7, 0x39, 0xF1, 0xE8,
-    0x8E, 0x2B, 0xE0, 0x08, 0x00, 0xE8, 0x8B, 0xD9, 0x15, 0x9D, 0x11, 0xEC, 0xA4, 0x75, 0x78, 0x21,
-    0x81, 0x34, 0x03, 0xC0, 0x8C, 0x8C, 0x66, 0x3F, 0x84, 0x07, 0x41, 0xEC, 0xC5, 0x59, 0xCC, 0x41,
-    0xD7, 0xEE, 0x78, 0x39, 0x84, 0xBA, 0xA3, 0x3B, 0x2C, 0x59, 0xCA, 0xB5, 0x50, 0x89, 0xCA, 0xDE,
-    0xEF, 0x34, 0x7A, 0x26, 0x4B, 0x27, 0xB1, 0x61, 0xB7, 0xA0, 0x1B, 0x85, 0xB7, 0x6B, 0xB1, 0x2A,
-    0xE1, 0x18, 0x8E, 0x59, 0x97, 0xB5, 0x37, 0xF3, 0xEA, 0x15, 0xAD, 0x34, 0x4A, 0xD6, 0x3F, 0xC6,
-    0x1A, 0x9A, 0x40, 0xC1, 0x10, 0x22, 0x13, 0xFB, 0xBA, 0xF3, 0x20, 0xEF, 0xE1, 0x1A, 0x51, 0x14,
-    0x4E, 0x2C, 0xC6, 0x85, 0xB4, 0x45, 0xE9, 0x42, 0xBC, 0x71, 0x7F, 0x7B, 0xA1, 0xC0, 0x0E, 0x7A,
-    0xFD, 0xA2, 0x3D, 0xB6, 0x97, 0xDF, 0xA2, 0xDB, 0xFF, 0x66, 0xEE, 0xF2, 0xDB, 0xEA, 0x29, 0x00,
-    0x3D, 0x27, 0x2B, 0xC6, 0x2C, 0x72, 0x57, 0xB1, 0xB1, 0xA4, 0x22, 0xE4, 0xF5, 0x7F, 0x5C, 0x94,
-    0x0B, 0x91, 0xF9, 0xB2, 0xFC, 0xD8, 0x8A, 0x6B, 0x22, 0x4E, 0x8A, 0xEC, 0xA4, 0x5F, 0x07, 0x3F,
-    0x37, 0xE6, 0x71, 0x6C, 0x43, 0x90, 0x47, 0xE6, 0x59, 0xF1, 0x5E, 0xBA, 0xA0, 0xFE, 0xBC, 0xF9,
-    0xBC, 0xBC, 0xD9, 0xF8, 0x4D, 0x50, 0x3E, 0x2A, 0x3F, 0xF4, 0x41, 0x19, 0xBC, 0xCF, 0x64, 0x93,
-    0x15, 0xE4, 0x1D, 0xAD, 0x1E, 0xFC, 0x2C, 0xCA, 0x39, 0x1F, 0x95, 0x67, 0x22, 0x6F, 0x29, 0x06,
-    0xB1, 0xF4, 0x04, 0xB5, 0x35, 0x70, 0x80, 0x5E, 0xC1, 0xB3, 0x45, 0xEB, 0xCD, 0x79, 0x72, 0xF1,
-    0xD2, 0x0B, 0x57, 0x22, 0x19, 0x27, 0x42, 0x95, 0x8B, 0x5F, 0xB7, 0xC2, 0x49, 0xDD, 0xB3, 0xE6,
-    0x31, 0x73, 0xE5, 0x51, 0x13, 0xBF, 0x3C, 0xC6, 0x88, 0x3E, 0xCB, 0x07, 0xD7, 0x86, 0xE1, 0x33,
-    0x15, 0xBB, 0xF0, 0xF6, 0x62, 0x67, 0x8E, 0x89, 0x1D, 0xD3, 0x44, 0xCA, 0xCA, 0x57, 0x5C, 0x75,
-    0x2A, 0xF6, 0x9D, 0xAA, 0xFD, 0xC1, 0x9B, 0xB7, 0x2D, 0x43, 0x5E, 0xA5, 0x11, 0x51, 0xDA, 0x47,
-    0xB2, 0xE6, 0xF9, 0x5E, 0xF4, 0x09, 0x62, 0x2D, 0x72, 0x21, 0xBC, 0x86, 0x5C, 0x18, 0xF8, 0x01,
-    0xA5, 0x33, 0x8A, 0xD0, 0x20, 0x8F, 0xF2, 0x98, 0x03, 0x71, 0x1B, 0xE2, 0xD7, 0x44, 0xA3, 0x0D,
-    0x88, 0x1E, 0xE4, 0x95, 0xF8, 0x16, 0xC1, 0x4A, 0x43, 0xEF, 0xAD, 0x2A, 0x99, 0x66, 0x73, 0x3B,
-    0x55, 0xFA, 0xD9, 0xFB, 0x88, 0x51, 0x2E, 0x8A, 0xDF, 0x5C, 0x96, 0x4D, 0x10, 0xE0, 0xF3, 0xD0,
-    0x02, 0x25, 0x7D, 0xEE, 0xC1, 0xC9, 0x97, 0xCC, 0xA7, 0x7F, 0xFD, 0x21, 0xE0, 0xDC, 0xDE, 0x3C,
-    0x2C, 0x9A, 0xE7, 0x31, 0xA1, 0xCC, 0x69, 0x18, 0x03, 0xD9, 0x3E, 0xF5, 0x14, 0x4B, 0xD3, 0x89,
-    0x5D, 0xE8, 0x62, 0x51, 0x08, 0x89, 0xEC, 0xE3, 0x29, 0xD9, 0xD8, 0x2D, 0xE1, 0x83, 0xD3, 0xB2,
-    0xEA, 0x42, 0xE3, 0x40, 0xE0, 0x77, 0x30, 0x2F, 0xD8, 0x54, 0xB5, 0x17, 0xBE, 0xFE, 0x95, 0x4A,
-    0x13, 0xC2, 0x7D, 0x99, 0xC2, 0xA1, 0xF6, 0x18, 0x5A, 0xE8, 0x1C, 0xD6, 0x67, 0x1C, 0xE8, 0x65,
-    0xF0, 0x4E, 0x2F, 0x34, 0x78, 0x4E, 0xB4, 0xEB, 0x73, 0x02, 0x95, 0x2E, 0x67, 0xA5, 0xDF, 0x65,
-    0xD7, 0x2B, 0x7C, 0xB6, 0x81, 0xB9, 0x4F, 0x78, 0x9F, 0x4B, 0xA7, 0x3C, 0xA2, 0xDC, 0x84, 0xD0,
-    0x6A, 0xAA, 0x3F, 0x8A, 0xC5, 0x81, 0xA6, 0x3E, 0x31, 0x9D, 0xCB, 0xE9, 0x9F, 0x80, 0x75, 0xA0,
-    0x3D, 0xDF, 0x1F, 0xE4, 0xC1, 0x9D, 0x70, 0xEF, 0x9B, 0xC2, 0xA0, 0x4F, 0x09, 0x27, 0x67, 0xB2,
-    0x77, 0xF6, 0x03, 0xFB, 0xBC, 0x40, 0x40, 0x54, 0xC1, 0x08, 0xC4, 0x31, 0x27, 0x50, 0x01, 0xEC,
-    0x6F, 0xA4, 0x57, 0x35, 0x89, 0xC7, 0x72, 0x0B, 0x66, 0x24, 0x10, 0xDB, 0x04, 0xE5, 0xAA, 0x9A,
-    0x1A, 0x28, 0x6B, 0x49, 0xD1, 0xB8, 0xA3, 0xC1, 0x0B, 0x3F, 0x9E, 0xCD, 0x46, 0xA1, 0x2F, 0x13,
-    0xED, 0xFE, 0x5C, 0xC1, 0x4A, 0x44, 0xED, 0x1E, 0xB4, 0x5C, 0x5A, 0x1E, 0x60, 0xC5, 0xE2, 0x0C,
-    0x6A, 0x21, 0xE5, 0xC8, 0xA8, 0x85, 0x2F, 0xEE, 0x03, 0xD1, 0x34, 0x74, 0x71, 0xC3, 0x6F, 0xA2,
-    0xAD, 0x5B, 0xD1, 0x0A, 0xC8, 0x7C, 0xC3, 0xC0, 0x24, 0x0E, 0xB2, 0xCE, 0x48, 0x38, 0x43, 0xEB,
-    0xC6, 0xAD, 0x96, 0x59, 0x79, 0xFD, 0xE8, 0xE0, 0x7D, 0x08, 0x65, 0x7E, 0x6A, 0x4B, 0x74, 0xDF,
-    0xE5, 0xD3, 0xB1, 0xF1, 0xDA, 0xD3, 0x28, 0x78, 0x78, 0x2E, 0x16, 0xBB, 0x76, 0x59, 0xDC, 0x11,
-    0xE4, 0x96, 0xB6, 0x19, 0xF7, 0x72, 0x86, 0x83, 0x55, 0xA8, 0xF2, 0x50, 0x41, 0x1F, 0xD5, 0x13,
-    0x6D, 0x80, 0xB2, 0xAC, 0x03, 0x19, 0x49, 0x06, 0xFC, 0x40, 0x3C, 0xDB, 0x9F, 0x56, 0xB2, 0xF2,
-    0x93, 0xFF, 0xCD, 0x82, 0xCA, 0x31, 0x21, 0x72, 0x3C, 0xBF, 0x80, 0x8C, 0xF0, 0xE0, 0xEA, 0x8E,
-    0xC5, 0xD0, 0x31, 0x4D, 0x0D, 0xE7, 0x1A, 0xDC, 0x39, 0xD3, 0x6F, 0xA9, 0x28, 0x64, 0xA0, 0x45,
-    0x06, 0x5D, 0x21, 0xB4, 0x87, 0x1F, 0x19, 0x77, 0x4C, 0x80, 0x0F, 0x50, 0xDC, 0xC8, 0xCE, 0x0F,
-    0x26, 0x71, 0xD4, 0xD5, 0x44, 0xA2, 0x5B, 0x9E, 0x2B, 0x1B, 0x90, 0x5F, 0xC8, 0xAF, 0x0F, 0xB2,
-    0x96, 0xD6, 0x3B, 0x6B, 0xBE, 0x82, 0x82, 0xB9, 0x1D, 0xB3, 0x17, 0x0B, 0xCF, 0x8C, 0xE1, 0xAB,
-    0x9D, 0xF7, 0xEB, 0xCA, 0xD6, 0xFE, 0xFF, 0xC4, 0xBD, 0xC5, 0xFB, 0x16, 0xD8, 0x19, 0x19, 0x7B,
-    0x84, 0x66, 0x1B, 0x26, 0x24, 0x50, 0xD4, 0x9C, 0x6B, 0xE8, 0x12, 0x39, 0x0A, 0x95, 0x1A, 0x01,
-    0xC8, 0xEF, 0x3D, 0x33, 0xBA, 0x2A, 0x7B, 0x8D, 0xC7, 0x61, 0x77, 0x8E, 0x79, 0xEF, 0xC7, 0xBF,
-    0x5C, 0xB2, 0xD5, 0x77, 0xFE, 0x81, 0xAB, 0x18, 0x01, 0x93, 0xFA, 0x2F, 0x69, 0x3C, 0x4B, 0x53,
-    0xE1, 0xF3, 0xD7, 0xB4, 0x98, 0x79, 0x54, 0xEB, 0x44, 0xC7, 0x75, 0x74, 0xE6, 0xDE, 0xBA, 0x04,
-    0x61, 0xD6, 0xA8, 0x0D, 0x06, 0xE1, 0x20, 0x97, 0x00, 0x05, 0x5A, 0x56, 0x54, 0xBA, 0xBA, 0xC0,
-    0x96, 0x59, 0x76, 0x3C, 0x85, 0x85, 0x59, 0x88, 0x57, 0xF4, 0x2A, 0xB5, 0xB1, 0xBA, 0xE6, 0x5D,
-    0xA4, 0xD5, 0x46, 0x63, 0xE8, 0x52, 0xB3, 0x67, 0x5C, 0xD9, 0xF9, 0x9B, 0x4B, 0xB8, 0x4D, 0xB5,
-    0x5E, 0xE0, 0x2A, 0x8B, 0x8C, 0x75, 0xB6, 0x24, 0x5B, 0xD5, 0x1E, 0xF5, 0xCE, 0x62, 0x39, 0x5F,
-    0xCF, 0xDE, 0x54, 0xA3, 0x1A, 0xBD, 0x81, 0xB8, 0x92, 0xA8, 0xE8, 0xF8, 0xE7, 0x02, 0xE6, 0x76,
-    0x11, 0x4A, 0x6C, 0x59, 0x02, 0x19, 0x97, 0xF2, 0xF3, 0xB6, 0xAA, 0x25, 0xC4, 0x28, 0xE5, 0x22,
-    0x43, 0x1A, 0x19, 0xD6, 0x3A, 0x09, 0x77, 0x07, 0xD0, 0xD3, 0xAC, 0x28, 0x81, 0x5A, 0x66, 0x41,
-    0x3F, 0x95, 0x74, 0xA4, 0xA4, 0x7B, 0x9A, 0x65, 0xB5, 0x27, 0xCE, 0xED, 0x57, 0x20, 0x7E, 0xAE,
-    0x85, 0xD0, 0xF1, 0x06, 0x8A, 0xA6, 0x9F, 0x27, 0x36, 0xF7, 0x81, 0x73, 0xE7, 0x06, 0x66, 0x8D,
-    0x8D, 0x16, 0xC0, 0xB1, 0x14, 0x55, 0x8B, 0xEC, 0xE9, 0x2C, 0x69, 0xFE, 0xA0, 0x5A, 0x97, 0xE1,
-    0x4F, 0xAB, 0xA8, 0x85, 0x3A, 0xCD, 0x94, 0x42, 0xF5, 0x99, 0xE9, 0xF6, 0xAA, 0xCB, 0x6C, 0x57,
-    0x99, 0x4F, 0x97, 0xAD, 0x6D, 0x56, 0x79, 0x52, 0x97, 0xB0, 0x94, 0xAF, 0x17, 0x37, 0xCB, 0x9E,
-    0x0C, 0xEC, 0xB1, 0x30, 0x19, 0xA6, 0x12, 0x2F, 0x17, 0x09, 0x40, 0x14, 0x97, 0xE7, 0xCB, 0x6F,
-    0xDD, 0x32, 0xE8, 0xBC, 0xC4, 0x4C, 0x98, 0xA8, 0xB6, 0xCB, 0x00, 0x69, 0x7B, 0x0F, 0x85, 0x7D,
-    0xC1, 0xAA, 0xB0, 0x0F, 0xD1, 0x80, 0xCE, 0xB7, 0x0E, 0x9A, 0x4F, 0xFF, 0x2F, 0x85, 0x7D, 0x8F,
-    0x5C, 0x7C, 0x09, 0x31, 0x18, 0xA0, 0xDA, 0x2D, 0x55, 0xC5, 0xD0, 0x6F, 0x78, 0xF2, 0x86, 0xB6,
-    0x1C, 0x15, 0x7B, 0x25, 0x6B, 0xEC, 0xC5, 0x80, 0xAD, 0xD5, 0x5D, 0x60, 0x29, 0xA4, 0xAB, 0xB1,
-    0x73, 0xFB, 0xB5, 0x6B, 0x16, 0x98, 0xEF, 0x5C, 0xD9, 0x6C, 0xE5, 0xB1, 0xE8, 0x5A, 0x4C, 0x76,
-    0x69, 0xD6, 0x72, 0x36, 0xA1, 0xCE, 0x8C, 0xBD, 0x92, 0x49, 0x4D, 0xD8, 0x29, 0x18, 0xB4, 0x16,
-    0xD6, 0x3F, 0x43, 0x39, 0x21, 0x86, 0xDE, 0x67, 0xF6, 0xBD, 0x85, 0xB3, 0x57, 0xE0, 0x8E, 0x02,
-    0xF1, 0x32, 0x30, 0x4E, 0x5A, 0xD3, 0x10, 0xA5, 0x16, 0x79, 0xBD, 0x58, 0xA3, 0xBB, 0xB4, 0xAA,
-    0xE6, 0xF4, 0x17, 0x50, 0xC0, 0x1B, 0xB5, 0x62, 0x97, 0xC2, 0xBC, 0xF3, 0x9A, 0xE7, 0xCC, 0x2B,
-    0x8F, 0x99, 0xD3, 0xB1, 0x60, 0xFD, 0xFA, 0xCA, 0x46, 0x69, 0x1F, 0xEA, 0x93, 0x6E, 0x57, 0xDA,
-    0x47, 0x3E, 0xD8, 0x2C, 0xED, 0xCB, 0x6F, 0x2E, 0xED, 0xD3, 0x7A, 0x82, 0xDB, 0x94, 0xF6, 0x8D,
-    0x37, 0x97, 0xF6, 0x4D, 0xFF, 0x57, 0xA5, 0x7D, 0xD4, 0x28, 0x1F, 0xD9, 0x4B, 0x77, 0x28, 0xED,
-    0x0B, 0x8E, 0x95, 0xF6, 0x5D, 0x76, 0xA5, 0x7D, 0x9F, 0x2C, 0x5C, 0x1A, 0x2F, 0xDC, 0xFA, 0xDC,
-    0x12, 0x70, 0x6C, 0x6E, 0x7E, 0x47, 0x50, 0x38, 0xD0, 0xCC, 0x41, 0x38, 0x40, 0x13, 0xBE, 0xAA,
-    0x79, 0xAD, 0x0A, 0x9B, 0xB5, 0x9D, 0xFE, 0x0D, 0xD0, 0xC2, 0xEB, 0xBF, 0x40, 0xDE, 0xF9, 0xC6,
-    0x27, 0x74, 0xD3, 0x5C, 0x15, 0x79, 0xBB, 0xB2, 0x5A, 0x3E, 0x55, 0x30, 0x7D, 0x42, 0x78, 0xF1,
-    0x33, 0x89, 0x20, 0x02, 0x13, 0x4E, 0xC5, 0xCF, 0xC4, 0x87, 0x9B, 0xD2, 0x5F, 0xDB, 0xFF, 0x1C,
-    0x4D, 0xF1, 0x90, 0x7D, 0xA2, 0x96, 0x44, 0x67, 0xF6, 0xCA, 0x0A, 0x4D, 0xD1, 0x55, 0x84, 0x56,
-    0x85, 0xC7, 0xEC, 0xCF, 0x5A, 0x81, 0xD8, 0x2F, 0x45, 0x9A, 0x74, 0xEB, 0x47, 0x15, 0xDF, 0x13,
-    0xDF, 0x40, 0xA0, 0xDF, 0x5E, 0x58, 0x34, 0xEC, 0xE1, 0x52, 0x7F, 0x4C, 0xCC, 0x1D, 0x2E, 0x51,
-    0xA3, 0x60, 0x94, 0xAD, 0xAF, 0x9A, 0xC8, 0x19, 0xC0, 0x6E, 0xA3, 0x02, 0x91, 0x48, 0x32, 0x5E,
-    0x87, 0xE5, 0xF8, 0x75, 0xBF, 0x10, 0xBC, 0x37, 0x5F, 0x51, 0x14, 0x6E, 0x4C, 0x03, 0x14, 0x0D,
-    0x54, 0x26, 0x5B, 0xF0, 0xE0, 0xA8, 0x98, 0x23, 0xD6, 0x6F, 0x07, 0x86, 0x58, 0xA2, 0xF3, 0xC4,
-    0x70, 0xC2, 0x21, 0x03, 0xA0, 0xF8, 0x2A, 0xB3, 0x0B, 0xB2, 0x9E, 0x50, 0xE6, 0xF4, 0x1D, 0xB3,
-    0xAA, 0xB3, 0x43, 0x30, 0xBD, 0x81, 0x10, 0x42, 0xCE, 0x26, 0xA6, 0xCB, 0x46, 0x96, 0x24, 0x0F,
-    0x09, 0xC1, 0x0B, 0xD8, 0x24, 0xEA, 0x68, 0x0F, 0x58, 0x69, 0x97, 0xBC, 0xD3, 0xAF, 0x4A, 0xF5,
-    0xB5, 0xAE, 0xBE, 0xD0, 0x60, 0xDC, 0xB8, 0xAA, 0xD4, 0xF7, 0x98, 0x27, 0x51, 0x75, 0x1D, 0x8C,
-    0xA0, 0xB7, 0x16, 0xEA, 0xC7, 0x7D, 0x46, 0x53, 0x82, 0x62, 0xBB, 0xB4, 0x4D, 0x10, 0xF7, 0x68,
-    0x50, 0xB4, 0x9E, 0xD5, 0x70, 0x5D, 0x59, 0x6D, 0xF7, 0x30, 0x27, 0xF6, 0x98, 0x31, 0xCE, 0x65,
-    0x5C, 0xF8, 0xE1, 0x2F, 0x5D, 0xC2, 0x17, 0xE1, 0x16, 0xF6, 0x5A, 0xD4, 0x26, 0x01, 0x17, 0xC8,
-    0xBE, 0x07, 0xB2, 0xEB, 0xDE, 0x0D, 0xA4, 0x1C, 0x5B, 0xA3, 0x05, 0x5D, 0xBD, 0x46, 0x09, 0x83,
-    0x6B, 0x82, 0x40, 0x3E, 0x9C, 0x91, 0x3B, 0x68, 0xCC, 0x1E, 0xEC, 0x8F, 0x90, 0x4A, 0xD4, 0x7B,
-    0xFF, 0xEF, 0x8D, 0x82, 0xB9, 0x3F, 0x73, 0x84, 0xED, 0x59, 0x1D, 0xB2, 0x63, 0xB4, 0x68, 0x8A,
-    0xE5, 0x90, 0x48, 0xCD, 0x99, 0xE8, 0x17, 0x88, 0x33, 0x07, 0x1F, 0xF5, 0xD0, 0xC3, 0xC3, 0x88,
-    0xD7, 0x03, 0x96, 0x81, 0x67, 0xE9, 0xEB, 0xF0, 0xF6, 0x5E, 0xBF, 0x06, 0xDF, 0xE8, 0x5D, 0x8C,
-    0xAB, 0x6C, 0xE5, 0x69, 0x79, 0xD7, 0x9C, 0x12, 0x81, 0x3E, 0x05, 0xF4, 0x99, 0xBE, 0x76, 0x84,
-    0x02, 0xC3, 0x5F, 0x4E, 0xE8, 0x54, 0xE9, 0x2B, 0x11, 0x55, 0x94, 0x2D, 0x5A, 0xC2, 0x8A, 0x74,
-    0xC6, 0xB8, 0x01, 0xA4, 0xEB, 0xCB, 0x02, 0x07, 0x02, 0xA4, 0xDC, 0x9F, 0x13, 0x4F, 0x22, 0xFA,
-    0x8E, 0xF0, 0xC8, 0x47, 0x6F, 0x08, 0x56, 0x15, 0xCC, 0x13, 0xBC, 0xFD, 0x4E, 0x6E, 0xB6, 0xE5,
-    0x1E, 0xF6, 0xE6, 0xF4, 0x08, 0xE5, 0x24, 0x95, 0xAC, 0xEB, 0xA3, 0xC1, 0x6C, 0x67, 0x49, 0x1B,
-    0xBE, 0xD6, 0xD9, 0x7C, 0xE4, 0xA6, 0x6E, 0xD4, 0x4D, 0xCA, 0x44, 0x9E, 0xEC, 0xCD, 0x7D, 0xF6,
-    0x1F, 0x7F, 0x9F, 0x75, 0x93, 0xE0, 0x76, 0x31, 0x87, 0x27, 0x9E, 0x39, 0x42, 0xF9, 0x78, 0x4D,
-    0x33, 0x0E, 0x69, 0x85, 0xED, 0x83, 0xB8, 0x64, 0x48, 0x05, 0x8A, 0xB8, 0x1C, 0x08, 0xA9, 0xC7,
-    0x99, 0xCC, 0x2D, 0x2A, 0x8D, 0x25, 0x48, 0xE8, 0x36, 0x88, 0x64, 0xFB, 0xE2, 0x5F, 0x88, 0x9F,
-    0xF6, 0x9A, 0x40, 0xC3, 0x57, 0x6D, 0x9E, 0x95, 0xB6, 0x86, 0x17, 0x54, 0x99, 0x6C, 0x64, 0x0B,
-    0x90, 0x65, 0x61, 0xB5, 0x7D, 0x02, 0x62, 0xF3, 0x07, 0xD6, 0x69, 0x22, 0x9F, 0xED, 0xE3, 0xD7,
-    0xED, 0x28, 0x66, 0x77, 0x1B, 0x69, 0x92, 0x27, 0x45, 0xCD, 0xFC, 0xBD, 0x2C, 0xED, 0x57, 0x32,
-    0xE0, 0x8D, 0xD6, 0x2C, 0xB5, 0x40, 0x2C, 0x06, 0x8A, 0xE8, 0x76, 0xCB, 0x2F, 0x47, 0x32, 0xF6,
-    0x3E, 0xCA, 0x71, 0xC3, 0x89, 0xA9, 0xAE, 0xA8, 0x4E, 0x06, 0xC6, 0x96, 0x91, 0xA9, 0x82, 0x75,
-    0x46, 0xD1, 0x5E, 0xFE, 0x29, 0x55, 0x97, 0xC0, 0x61, 0xE9, 0xED, 0xAA, 0x2E, 0xDB, 0x7B, 0xAE,
-    0xBA, 0x4C, 0xEF, 0x5A, 0x75, 0x29, 0xDE, 0x82, 0xAB, 0xBA, 0x4C, 0x58, 0x75, 0xF9, 0x6D, 0x56,
-    0x5D, 0x3E, 0xDF, 0x6E, 0xEA, 0x6A, 0x55, 0x5A, 0x3E, 0xEA, 0x3B, 0x58, 0xBA, 0x84, 0xEC, 0xB5,
-    0xB6, 0x74, 0x8D, 0xF2, 0x5E, 0x00, 0x4C, 0x9E, 0xE4, 0x22, 0x63, 0xFB, 0x08, 0xFA, 0x76, 0x3E,
-    0x32, 0x7B, 0x84, 0xE2, 0x85, 0xC3, 0x08, 0x35, 0x91, 0x52, 0x26, 0xEB, 0x11, 0x6E, 0x8E, 0xC5,
-    0x28, 0x42, 0x49, 0xE5, 0xFE, 0x08, 0xEF, 0xCB, 0xAF, 0x97, 0x71, 0xEE, 0xDF, 0xC8, 0x4E, 0x91,
-    0x8E, 0x98, 0xEE, 0x60, 0xB4, 0x76, 0x82, 0x21, 0x16, 0xA6, 0x21, 0x9C, 0xA3, 0xB4, 0x50, 0x4B,
-    0x01, 0xC6, 0xAA, 0x73, 0x6E, 0xD5, 0x80, 0xB7, 0x02, 0x20, 0xAB, 0xC6, 0x3B, 0xEB, 0x0A, 0x08,
-    0xBD, 0x05, 0x86, 0xAC, 0x1A, 0xF3, 0xB4, 0x0F, 0xCF, 0xBE, 0x70, 0xEE, 0x99, 0xD1, 0xA5, 0xC6,
-    0xEC, 0xE8, 0x8A, 0x37, 0xED, 0xB0, 0xFC, 0xD0, 0x2B, 0x94, 0xB6, 0x4E, 0x96, 0x96, 0x1F, 0x06,
-    0x55, 0x52, 0x0B, 0x45, 0x15, 0xD5, 0x10, 0xAC, 0x81, 0x21, 0x68, 0x57, 0xC5, 0x83, 0xD1, 0x3C,
-    0xEC, 0xBA, 0xA0, 0x75, 0x8B, 0x71, 0x62, 0x21, 0xA0, 0xD8, 0xE2, 0x10, 0xED, 0x1D, 0xAC, 0xC7,
-    0xA4, 0x57, 0x08, 0x68, 0xB7, 0x4B, 0xB0, 0x93, 0x52, 0xE4, 0x44, 0xC4, 0x0E, 0x8C, 0xEB, 0xF0,
-    0xF1, 0xD5, 0x52, 0x6B, 0x47, 0xA8, 0x56, 0x59, 0x24, 0x5A, 0x4E, 0xD9, 0xB8, 0xF2, 0x38, 0xC1,
-    0x6A, 0xA4, 0x31, 0xDD, 0x9E, 0x63, 0x41, 0xB2, 0xCC, 0x59, 0x79, 0x2D, 0x8B, 0x5C, 0xD2, 0x39,
-    0x90, 0x5C, 0x52, 0x71, 0x72, 0x58, 0xB0, 0x53, 0x54, 0x9A, 0xD4, 0x4A, 0xE5, 0x43, 0x77, 0xB9,
-    0x57, 0x22, 0x41, 0x4F, 0x6B, 0xA4, 0xCF, 0x54, 0xD7, 0x6C, 0x8E, 0x32, 0x54, 0x84, 0x4D, 0x11,
-    0x05, 0x99, 0xF3, 0x02, 0x53, 0x14, 0x1A, 0xEC, 0xA1, 0x6C, 0x05, 0x7A, 0x3A, 0x42, 0x27, 0x89,
-    0x2C, 0x05, 0x7A, 0x18, 0x4A, 0x78, 0x22, 0xA7, 0xEF, 0xA2, 0x82, 0x15, 0x5E, 0xA4, 0xF2, 0x7A,
-    0x5A, 0xCE, 0x60, 0xF6, 0x14, 0x59, 0xC5, 0xB0, 0x17, 0x42, 0xB1, 0x98, 0x22, 0xBC, 0x7A, 0xAC,
-    0x84, 0x56, 0x29, 0x9E, 0x33, 0x4E, 0x32, 0x12, 0xD7, 0xB9, 0xF0, 0x1B, 0xB0, 0x69, 0xC6, 0xD9,
-    0x7B, 0xDA, 0xC8, 0x1C, 0xB1, 0xC1, 0x54, 0xC3, 0x11, 0xB8, 0x97, 0xEE, 0x7A, 0x4B, 0x45, 0xA5,
-    0xFD, 0xA6, 0xEC, 0x96, 0xB3, 0xCC, 0x6F, 0x0A, 0x05, 0x90, 0xE1, 0xBC, 0x1A, 0x75, 0x3F, 0x01,
-    0x33, 0x20, 0xFF, 0x13, 0x6B, 0xCF, 0x63, 0xC1, 0x30, 0x00, 0x00, 0xBD, 0xEE, 0x40, 0xA8, 0x8F,
-    0xCC, 0x38, 0x0C, 0x2E, 0x47, 0xAD, 0x57, 0xF1, 0x91, 0x09, 0xA3, 0x1B, 0xF4, 0x91, 0xC4, 0x03,
-    0x3C, 0x56, 0x6B, 0xA4, 0x09, 0x13, 0x57, 0xDA, 0xAF, 0x56, 0xD5, 0xB3, 0xEF, 0x29, 0x5C, 0x33,
-    0xCE, 0x35, 0x40, 0x2E, 0x00, 0x44, 0xB0, 0x2C, 0xE4, 0x9D, 0x3D, 0xF5, 0x5B, 0xCC, 0x96, 0xC7,
-    0x72, 0x9A, 0x2D, 0xEC, 0xA8, 0xC8, 0x5F, 0xC8, 0xFC, 0xD9, 0x10, 0x21, 0xFE, 0xEE, 0xF7, 0x74,
-    0x6F, 0x22, 0x24, 0x60, 0x07, 0xD6, 0x9E, 0x78, 0xE8, 0x85, 0xC5, 0x37, 0x79, 0x6C, 0x5A, 0x7B,
-    0x63, 0x36, 0xFC, 0x09, 0x52, 0xE0, 0xF6, 0x8D, 0x83, 0x84, 0x59, 0x17, 0xED, 0x69, 0xB1, 0x73,
-    0xA8, 0xD5, 0x6A, 0x84, 0x79, 0x47, 0xAE, 0x26, 0x77, 0x55, 0x7B, 0x75, 0x99, 0x9C, 0x8F, 0xF9,
-    0xDB, 0x25, 0xFA, 0x0E, 0x82, 0x9C, 0x6F, 0x3D, 0x68, 0x41, 0x71, 0xA2, 0x92, 0xFC, 0x74, 0x58,
-    0x07, 0xB5, 0x5F, 0x23, 0xB5, 0x7B, 0x1A, 0x95, 0x79, 0xD1, 0xF7, 0x3B, 0xBF, 0xF1, 0x3B, 0x94,
-    0xEA, 0x1D, 0x88, 0x12, 0xA8, 0xB3, 0x52, 0x7E, 0x4C, 0xDA, 0x33, 0x9D, 0x98, 0x8B, 0x9D, 0xEC,
-    0xE7, 0xD9, 0xD2, 0x60, 0x1E, 0xB1, 0xF3, 0xF2, 0xA1, 0xE3, 0x85, 0x58, 0xBF, 0xC3, 0x8A, 0xE0,
-    0x69, 0xB3, 0x22, 0x78, 0xD0, 0x8A, 0xE0, 0xAB, 0x27, 0xF6, 0xEF, 0x5E, 0x11, 0x3C, 0xB2, 0x3C,
-    0x8B, 0xA1, 0x9A, 0x7F, 0xA9, 0x3A, 0xFF, 0xAB, 0x7C, 0xFD, 0x0F, 0xEB, 0xFD, 0xF2, 0x5E, 0xBA,
-    0x35, 0xC5, 0xEC, 0xDF, 0x39, 0xC5, 0xDC, 0x3A, 0xB5, 0xF3, 0xBF, 0x37, 0x52, 0xCC, 0xB3, 0xB6,
-    0x63, 0xDE, 0x27, 0x5E, 0x4F, 0x47, 0x15, 0xAF, 0x8A, 0x04, 0xD5, 0x00, 0xF6, 0xB5, 0x55, 0xE5,
-    0xF1, 0x89, 0xDB, 0x55, 0x1E, 0x67, 0xBF, 0x7D, 0xE5, 0xB1, 0xFA, 0x74, 0xDC, 0x54, 0x57, 0x8A,
-    0xAC, 0x46, 0xF1, 0x96, 0xCA, 0xE3, 0x7E, 0x5D, 0x19, 0x9B, 0x2C, 0x01, 0x70, 0x87, 0x5A, 0xD1,
-    0xC1, 0x86, 0xFF, 0x1F, 0x78, 0xB2, 0xBE, 0x7F, 0xE9, 0xB2, 0xE5, 0x4D, 0xA9, 0x0B, 0x3C, 0xEF,
-    0x3A, 0x30, 0x3C, 0xAA, 0x77, 0xE5, 0xF7, 0x2E, 0x4C, 0xE6, 0xD2, 0xE1, 0xDC, 0x93, 0xFF, 0xB8,
-    0x42, 0xDE, 0x5C, 0x57, 0xF6, 0x14, 0x54, 0xF6, 0xF7, 0x47, 0x5A, 0x77, 0xE8, 0x1F, 0xB4, 0xA7,
-    0xA0, 0xD6, 0x81, 0xE1, 0x7D, 0x94, 0x55, 0xB5, 0xF2, 0x12, 0x8E, 0x0C, 0x42, 0x3C, 0x09, 0x0D,
-    0xFB, 0x2B, 0x32, 0x08, 0x44, 0x8D, 0x10, 0xBC, 0x98, 0x97, 0xCC, 0xB1, 0x06, 0x0F, 0xB5, 0xCA,
-    0x79, 0xD1, 0xBE, 0xCA, 0x38, 0xD1, 0xBC, 0xBC, 0xAD, 0xAC, 0xA0, 0xE8, 0xC7, 0x9D, 0x72, 0xE0,
-    0x0D, 0x87, 0x32, 0xC3, 0x3D, 0xE1, 0xF0, 0x3D, 0x91, 0xB3, 0x82, 0x59, 0xE4, 0x3D, 0x36, 0x7B,
-    0x65, 0x88, 0x65, 0x41, 0xDB, 0x3E, 0x25, 0x52, 0x79, 0x5E, 0x26, 0x27, 0x52, 0x9C, 0xA2, 0x9C,
-    0x5E, 0x5B, 0x1D, 0xA8, 0x15, 0x41, 0x79, 0x0D, 0x1D, 0x69, 0x1D, 0x72, 0xE5, 0xDC, 0xFC, 0xB8,
-    0x81, 0x31, 0x19, 0xB0, 0x6C, 0x0B, 0xC6, 0x4C, 0x11, 0x73, 0x0A, 0xD1, 0xFC, 0xA1, 0xFD, 0xED,
-    0xA8, 0x4D, 0x41, 0xCC, 0xD0, 0xB3, 0xE0, 0xD1, 0xB8, 0x87, 0xD2, 0xB0, 0x97, 0x3A, 0xCD, 0xB9,
-    0x81, 0x0B, 0x73, 0xD7, 0x63, 0xC9, 0xE0, 0x8F, 0x1E, 0x17, 0xC0, 0x5E, 0x26, 0xC7, 0x80, 0x5A,
-    0x8F, 0xA4, 0x36, 0x8A, 0x2B, 0xEE, 0x57, 0xFA, 0x85, 0xAB, 0x4B, 0x54, 0x30, 0x1E, 0xCC, 0xCD,
-    0x23, 0x00, 0x18, 0x69, 0x2E, 0x1B, 0xC2, 0xBA, 0x61, 0x36, 0x0E, 0xB0, 0x39, 0x94, 0xFD, 0x97,
-    0xAC, 0x68, 0xC4, 0x66, 0xC5, 0x35, 0xFC, 0xEA, 0x0E, 0xA5, 0x6E, 0x13, 0x93, 0xB8, 0x85, 0x71,
-    0x55, 0x3B, 0xBE, 0x13, 0x8E, 0xD1, 0x5B, 0xB5, 0xF8, 0x1F, 0xF3, 0xEF, 0x59, 0x48, 0x95, 0xD6,
-    0x6B, 0x79, 0xBE, 0x7D, 0xA1, 0xB6, 0xD5, 0x6F, 0x49, 0x7D, 0x73, 0xA1, 0x76, 0xFE, 0xDB, 0x16,
-    0x6A, 0x77, 0xF7, 0x50, 0xA8, 0x5D, 0xDD, 0x5A, 0xA8, 0x5D, 0x68, 0xA1, 0x76, 0xA1, 0x85, 0xDA,
-    0x05, 0x8A, 0x4D, 0xCA, 0x2F, 0x14, 0x2C, 0xD4, 0x7E, 0xEC, 0x98, 0x3F, 0xAA, 0xFD, 0xD1, 0xF4,
-    0xDE, 0xF1, 0x75, 0x99, 0x69, 0x36, 0xC4, 0x8C, 0x35, 0x39, 0x2A, 0x9A, 0xBA, 0x93, 0x0B, 0x5E,
-    0xCF, 0x60, 0x04, 0xF8, 0xBD, 0x5A, 0x45, 0x54, 0x18, 0xF1, 0xA9, 0xCA, 0x25, 0x94, 0x84, 0x0C,
-    0x40, 0xFA, 0x03, 0xA0, 0x00, 0xA1, 0x82, 0xAF, 0x49, 0x06, 0x51, 0xE7, 0x42, 0xAC, 0x99, 0x1E,
-    0xCA, 0x3F, 0xC3, 0xCB, 0x9F, 0xAF, 0xDD, 0x50, 0x90, 0xB9, 0x3C, 0x2D, 0x14, 0xEE, 0x43, 0x06,
-    0x20, 0x06, 0x16, 0x52, 0x22, 0x55, 0xE5, 0xB1, 0xC1, 0x3B, 0xA5, 0x51, 0xA6, 0xFD, 0xDF, 0x62,
-    0x47, 0x23, 0x01, 0x81, 0x76, 0x34, 0xA2, 0x7F, 0xD3, 0xD0, 0xEA, 0x27, 0xA0, 0xB9, 0xF6, 0x3D,
-    0x6E, 0x41, 0x63, 0x84, 0x35, 0x37, 0x8D, 0x65, 0x79, 0xDA, 0xDA, 0xD8, 0x25, 0xCE, 0xF4, 0x6B,
-    0xA1, 0x83, 0x76, 0x2A, 0x32, 0x36, 0xA2, 0x51, 0x91, 0xD4, 0xE9, 0xE7, 0x47, 0x2E, 0xBE, 0xF4,
-    0xB9, 0xC2, 0x0E, 0x8F, 0x09, 0xB4, 0x3B, 0x2D, 0x8A, 0xE0, 0x71, 0xD3, 0x99, 0x67, 0xE5, 0xFF,
-    0x57, 0x04, 0xFF, 0x75, 0xA2, 0x12, 0x44, 0xD1, 0x7B, 0x82, 0x59, 0xFC, 0x3A, 0x2A, 0x83, 0x3A,
-    0xCE, 0x03, 0x40, 0xBD, 0x01, 0x39, 0xDA, 0x54, 0x01, 0x85, 0x6B, 0xCF, 0x47, 0xA7, 0xB9, 0x5F,
-    0x8A, 0x49, 0x3C, 0x79, 0x16, 0x86, 0x0D, 0xA7, 0x3F, 0xA0, 0x58, 0x69, 0x24, 0x2B, 0x0E, 0xB0,
-    0x62, 0x02, 0x0A, 0x70, 0x38, 0x40, 0x27, 0x14, 0x3D, 0x44, 0xDE, 0x0E, 0x51, 0xFA, 0xD1, 0xEF,
-    0x4F, 0x12, 0x2E, 0x8A, 0xD0, 0xCC, 0xC5, 0xA2, 0xFB, 0x0E, 0x97, 0x39, 0x8F, 0x4B, 0x8E, 0x6B,
-    0x70, 0x0A, 0x28, 0xF8, 0x50, 0xAC, 0xC8, 0xB6, 0xA8, 0xA0, 0xF0, 0x17, 0x4B, 0xA6, 0x13, 0x3A,
-    0xCA, 0xD3, 0x00, 0xE2, 0x7D, 0xE6, 0xBE, 0x33, 0x75, 0xF0, 0x46, 0x67, 0xBA, 0xCB, 0x66, 0xE7,
-    0x51, 0x73, 0x2A, 0x36, 0xF1, 0x99, 0x32, 0xAC, 0xDB, 0xB0, 0xDD, 0xBE, 0xD4, 0x87, 0x76, 0x9F,
-    0x8A, 0x6C, 0x5D, 0xC4, 0x21, 0xAE, 0xE9, 0x63, 0x32, 0x4D, 0x41, 0xBB, 0x0F, 0xD3, 0x11, 0x5F,
-    0x9A, 0xC8, 0x07, 0x8D, 0x31, 0x9A, 0x7D, 0xDF, 0x09, 0x8F, 0x58, 0x5A, 0x91, 0xA5, 0x9E, 0x87,
-    0x08, 0x00, 0x1C, 0xB4, 0x48, 0x85, 0x34, 0xC9, 0xD7, 0xBA, 0xA4, 0x4E, 0xBF, 0xDE, 0x66, 0x75,
-    0x76, 0xE6, 0x0D, 0x5B, 0x66, 0x6F, 0x7D, 0x60, 0xF3, 0x94, 0x71, 0x39, 0x22, 0x59, 0xDB, 0x0B,
-    0xED, 0x13, 0x00, 0xA0, 0x04, 0xF0, 0xF6, 0x14, 0x84, 0x69, 0x0B, 0x8A, 0xFB, 0xB4, 0x56, 0x0D,
-    0x75, 0xE6, 0xA4, 0xF1, 0xCA, 0x4E, 0x4C, 0xAB, 0x89, 0xBE, 0xD6, 0x98, 0xEE, 0x51, 0x54, 0x9C,
-    0xF8, 0xED, 0x73, 0x5F, 0xDD, 0x0A, 0x7F, 0x10, 0xD7, 0xBB, 0x37, 0x90, 0x08, 0x2D, 0xA3, 0xA1,
-    0x37, 0x7F, 0x9E, 0x18, 0xFF, 0xD5, 0xCE, 0x3C, 0xBE, 0x6D, 0xBC, 0xD5, 0x79, 0x29, 0xDB, 0x4B,
-    0x20, 0x62, 0x7F, 0xD9, 0xD3, 0x61, 0xC9, 0xAF, 0x2E, 0x95, 0x08, 0x2B, 0x4A, 0xC6, 0x1F, 0xB0,
-    0x3B, 0xD2, 0x96, 0xC9, 0x91, 0xAC, 0x46, 0x10, 0x35, 0x8A, 0x2F, 0x76, 0xC8, 0x32, 0xB2, 0x41,
-    0x0C, 0xC6, 0x94, 0xC8, 0xEA, 0xC8, 0xA7, 0x33, 0x36, 0x0A, 0x01, 0x37, 0x01, 0x2E, 0xB5, 0xB7,
-    0xE4, 0xDE, 0xEE, 0xF6, 0xDB, 0x67, 0x9A, 0x97, 0x3B, 0x91, 0x9B, 0xFF, 0xC4, 0xF0, 0x4B, 0x01,
-    0xC0, 0x5B, 0x16, 0x79, 0x75, 0x35, 0x6C, 0xB2, 0x1B, 0x02, 0x28, 0xBB, 0xC8, 0xCE, 0x17, 0x0C,
-    0xAB, 0x43, 0x2F, 0xC8, 0x38, 0x0F, 0x31, 0x22, 0x89, 0xC0, 0x20, 0x61, 0xCE, 0x20, 0x66, 0xF7,
-    0xE2, 0x39, 0x77, 0x84, 0x4D, 0xB8, 0x71, 0xF2, 0x8A, 0x5A, 0x4C, 0x8D, 0x50, 0x07, 0x82, 0x4E,
-    0xFE, 0x9A, 0x62, 0x38, 0x19, 0x55, 0x77, 0x0E, 0x10, 0x24, 0x6C, 0xA7, 0x32, 0x2F, 0xFF, 0x88,
-    0x62, 0x91, 0x9F, 0x32, 0x76, 0x8A, 0xDE, 0x98, 0xFC, 0x5A, 0x86, 0x78, 0x3C, 0xB4, 0x47, 0xB1,
-    0xF9, 0xEF, 0x15, 0xEB, 0x71, 0xC5, 0x6D, 0xBE, 0xFE, 0x77, 0x2C, 0x58, 0x6F, 0x1C, 0x6F, 0xB2,
-    0x0A, 0x75, 0xBE, 0x08, 0xEF, 0x07, 0x5D, 0x91, 0xF2, 0x5C, 0x8D, 0xDF, 0xCB, 0x3A, 0xFE, 0x8D,
-    0xFC, 0x3C, 0xA3, 0xA1, 0x03, 0xB5, 0xBC, 0x65, 0x71, 0x35, 0x6C, 0x99, 0x7E, 0x41, 0xD3, 0xC5,
-    0x05, 0x00, 0x3A, 0x19, 0x73, 0x44, 0xED, 0x9B, 0x3B, 0x64, 0x65, 0xD4, 0x6E, 0x07, 0xCF, 0x5E,
-    0xFF, 0xD1, 0xD9, 0xA5, 0xD4, 0xAA, 0xDF, 0x28, 0xBB, 0x52, 0x5C, 0x24, 0xE6, 0xE0, 0x21, 0x75,
-    0x5C, 0x16, 0x80, 0x5F, 0x70, 0x1D, 0x09, 0x5F, 0x97, 0xBA, 0xF3, 0xDE, 0x35, 0x99, 0xAE, 0xF5,
-    0x5C, 0x0E, 0x74, 0xF4, 0xE0, 0x85, 0x44, 0x14, 0x6B, 0xD0, 0xCC, 0x5F, 0x6B, 0xC5, 0xE7, 0x7F,
-    0xD4, 0xB7, 0xD7, 0x9F, 0xC8, 0x77, 0x2B, 0x66, 0xB0, 0x44, 0xB0, 0xAF, 0xBF, 0x04, 0x8F, 0x04,
-    0xFE, 0x88, 0x59, 0x1D, 0x87, 0x62, 0x2F, 0xF6, 0xAE, 0xAE, 0x50, 0xC6, 0xAB, 0x5C, 0x38, 0x8A,
-    0x3A, 0xED, 0xE4, 0x67, 0x7B, 0xEA, 0x0B, 0xC3, 0xDD, 0x5F, 0x5A, 0x14, 0xB4, 0x8B, 0x5F, 0x96,
-    0xD1, 0xE2, 0x94, 0x0F, 0x8B, 0x6B, 0xE3, 0x42, 0xF4, 0x69, 0x6B, 0xEE, 0xED, 0x0B, 0x0E, 0x7E,
-    0x87, 0xB0, 0x6B, 0xDA, 0x84, 0x22, 0x08, 0xB0, 0x10, 0x75, 0x3A, 0x11, 0x3B, 0xD9, 0xBC, 0xEA,
-    0x62, 0x96, 0x22, 0x08, 0x55, 0x69, 0x91, 0xC7, 0x78, 0x22, 0x08, 0x8D, 0x86, 0xAC, 0x63, 0x2E,
-    0x24, 0xEE, 0xEC, 0x0F, 0x14, 0x60, 0xBD, 0x35, 0x69, 0xD8, 0xB5, 0x78, 0xE7, 0x13, 0x0D, 0xBB,
-    0x0A, 0xEB, 0x35, 0xEE, 0xDC, 0x9F, 0x69, 0xD1, 0xEE, 0xED, 0x12, 0x76, 0x5D, 0xE2, 0xB0, 0xD3,
-    0x72, 0x61, 0x5C, 0xE2, 0xB0, 0xA3, 0x0B, 0xD9, 0x72, 0x45, 0xE8, 0x71, 0xA7, 0x2A, 0x4D, 0x6C,
-    0x76, 0xA4, 0x49, 0xD9, 0x5F, 0xDB, 0xB7, 0x14, 0x17, 0xC4, 0xF6, 0x49, 0xC6, 0x54, 0xFA, 0x6C,
-    0x8A, 0xC5, 0xDA, 0x64, 0xF6, 0xEB, 0xE0, 0xBE, 0x32, 0x80, 0xA2, 0xAF, 0x33, 0x4D, 0xB0, 0xF8,
-    0xB9, 0x41, 0x48, 0x4C, 0xB4, 0x98, 0x1A, 0xB5, 0x5D, 0x0D, 0x86, 0x1B, 0xBB, 0x4C, 0x4D, 0xC7,
-    0xF7, 0xAA, 0xD2, 0xDC, 0xF3, 0x57, 0x52, 0x27, 0xA3, 0x36, 0xB8, 0x56, 0x68, 0x50, 0x30, 0xB3,
-    0x6F, 0x3D, 0x7A, 0x3E, 0xF1, 0x88, 0x5F, 0x83, 0x21, 0x7B, 0x83, 0x69, 0xD9, 0xCE, 0xD2, 0x6D,
-    0x4C, 0xDE, 0x1E, 0x26, 0x8D, 0xB1, 0xBF, 0xD3, 0xA8, 0xC1, 0x9E, 0x36, 0xA7, 0x10, 0xB8, 0x5F,
-    0xDD, 0x0E, 0x2E, 0x05, 0xD9, 0xDA, 0x65, 0x41, 0x9C, 0xCE, 0x2A, 0xC0, 0x0F, 0x26, 0xDC, 0x1E,
-    0xCF, 0xD9, 0x87, 0xF4, 0x7A, 0x7F, 0x29, 0x10, 0x59, 0x0C, 0xDD, 0x1C, 0x8B, 0x43, 0x93, 0x8B,
-    0xE3, 0x94, 0x09, 0x77, 0x6E, 0x54, 0x52, 0xA0, 0xE7, 0x96, 0x7E, 0x66, 0x9D, 0xA1, 0xEE, 0x3C,
-    0xC5, 0xB9, 0x2D, 0x3C, 0x95, 0x09, 0x2F, 0x7B, 0x00, 0xE9, 0x28, 0x4E, 0x36, 0xF1, 0xCF, 0x80,
-    0xA7, 0x10, 0xB5, 0xD1, 0x3A, 0x2C, 0x0E, 0x5D, 0xF0, 0xF0, 0xA4, 0xEF, 0x55, 0x38, 0xE2, 0xC1,
-    0x1F, 0xD9, 0xB3, 0x5B, 0x42, 0x27, 0xF1, 0x60, 0x2B, 0x66, 0x0B, 0x0B, 0x3C, 0x1A, 0x95, 0x91,
-    0x9A, 0x3D, 0x88, 0x56, 0x59, 0x0D, 0xE2, 0x31, 0x6E, 0x20, 0x3B, 0xEE, 0x88, 0xA8, 0xD5, 0x72,
-    0x7C, 0x59, 0xAC, 0xDA, 0x2B, 0x62, 0xBD, 0x45, 0x59, 0x3F, 0x2C, 0x86, 0xE6, 0xB2, 0x58, 0xF1,
-    0xD7, 0x73, 0xF3, 0x70, 0xCF, 0xE0, 0x04, 0xC2, 0x84, 0x89, 0x80, 0xB4, 0x01, 0x9E, 0x53, 0x58,
-    0x27, 0x32, 0xF7, 0x01, 0xA5, 0xCE, 0xCC, 0x72, 0xA8, 0x16, 0x41, 0x5C, 0xAE, 0x77, 0x27, 0x5B,
-    0x44, 0xEB, 0x9E, 0x65, 0x6F, 0xB3, 0x67, 0xB9, 0xD4, 0x16, 0xE5, 0x8C, 0x3D, 0xCB, 0xE3, 0x92,
-    0xCD, 0xD4, 0x16, 0x65, 0x9E, 0xBB, 0x91, 0x95, 0x7A, 0x3E, 0xD5, 0xFA, 0x42, 0xEE, 0x2E, 0x94,
-    0x58, 0xC4, 0xE4, 0x2E, 0xE0, 0x19, 0x35, 0x44, 0xD5, 0x3E, 0xED, 0xA3, 0x0C, 0xAA, 0x49, 0x91,
-    0x82, 0xC4, 0x14, 0x6C, 0xBF, 0xCA, 0xC9, 0xAB, 0x67, 0xE5, 0xBC, 0x0A, 0xFA, 0x41, 0x3F, 0x36,
-    0x5A, 0xD4, 0x15, 0xB1, 0x20, 0xEE, 0x32, 0xEB, 0xB6, 0x53, 0x57, 0xB7, 0x8D, 0x8C, 0xFC, 0xBE,
-    0xD6, 0x6D, 0x9B, 0x55, 0xDD, 0x76, 0x02, 0x73, 0x73, 0x36, 0x2B, 0xB3, 0xF6, 0x90, 0xCF, 0x44,
-    0x42, 0x27, 0x53, 0xF8, 0xF8, 0x07, 0xD4, 0x8F, 0xDC, 0x6E, 0xF6, 0x23, 0x5B, 0xED, 0x47, 0x1E,
-    0x35, 0x7C, 0xA3, 0xC7, 0x69, 0xA9, 0xC2, 0x89, 0x95, 0x8B, 0x2B, 0xCD, 0x83, 0xF2, 0x5A, 0xAC,
-    0xA2, 0xAC, 0x11, 0x47, 0x73, 0x2E, 0xD7, 0x58, 0x0F, 0x70, 0xD3, 0x36, 0x42, 0x65, 0x0D, 0x6A,
-    0x0C, 0x89, 0xF0, 0x64, 0xE1, 0x68, 0x42, 0x4B, 0x4A, 0x9C, 0xC9, 0xC1, 0xE8, 0x4E, 0xA5, 0x15,
-    0xD9, 0xB3, 0x59, 0x4E, 0xDC, 0x40, 0x20, 0x4D, 0x6C, 0x33, 0xCB, 0x28, 0xB2, 0xA6, 0x52, 0x1F,
-    0x78, 0x39, 0x8E, 0x2A, 0x66, 0x1A, 0x1A, 0xF6, 0xC6, 0xFC, 0x51, 0xB5, 0x72, 0x7B, 0x2E, 0x09,
-    0xAC, 0xAA, 0x8F, 0x3E, 0x9B, 0x2B, 0xFF, 0x5D, 0x8A, 0xA4, 0x54, 0xA3, 0xBA, 0x3A, 0xDF, 0x4D,
-    0x8D, 0xBE, 0x0D, 0x7C, 0xDB, 0xB3, 0x0D, 0x8F, 0xDD, 0x81, 0x5E, 0xC7, 0x70, 0x59, 0x88, 0xE2,
-    0x93, 0x14, 0x12, 0xE3, 0xCE, 0x32, 0xC9, 0xB4, 0x96, 0xDC, 0xB2, 0xD9, 0x47, 0xEB, 0x97, 0x47,
-    0x41, 0x3E, 0x61, 0xC7, 0xF8, 0x58, 0x02, 0x90, 0x5D, 0xA9, 0x0F, 0x1D, 0x2D, 0xED, 0x26, 0x5A,
-    0xC9, 0x58, 0xBB, 0x42, 0x1C, 0x21, 0x25, 0x82, 0x39, 0xF7, 0x9D, 0x15, 0xB9, 0x9F, 0x10, 0xC4,
-    0x12, 0x37, 0xC9, 0x1B, 0x19, 0x6D, 0x42, 0xDF, 0xF5, 0xAA, 0x7B, 0xF2, 0x14, 0x4E, 0x4B, 0x81,
-    0x69, 0x13, 0xC4, 0x3D, 0x06, 0x82, 0x5C, 0x51, 0xAB, 0x28, 0x20, 0x64, 0xAE, 0x16, 0x9C, 0x71,
-    0xB0, 0x2E, 0x0C, 0x55, 0x38, 0xE6, 0x2F, 0x70, 0x2C, 0x38, 0xF6, 0x36, 0x7E, 0x39, 0xE5, 0x14,
-    0xC7, 0x49, 0x73, 0xD2, 0xAF, 0x83, 0xBA, 0x35, 0xED, 0xB3, 0xE6, 0xF2, 0xA3, 0xC0, 0x83, 0x02,
-    0x04, 0xA3, 0xB2, 0x0D, 0x9B, 0xAD, 0x6F, 0x75, 0xE0, 0xAF, 0xEA, 0xAF, 0xE9, 0x85, 0x47, 0x3C,
-    0xA3, 0x06, 0x42, 0xDF, 0x31, 0xB9, 0xF2, 0xF0, 0x72, 0x10, 0x99, 0x0C, 0xF3, 0xC8, 0x8B, 0x74,
-    0x7D, 0xE1, 0xF9, 0xC2, 0x29, 0x44, 0x54, 0x85, 0x2D, 0x00, 0x3D, 0x43, 0xD3, 0xA8, 0xA8, 0x49,
-    0x68, 0x3D, 0x78, 0x1A, 0x90, 0xCF, 0x44, 0x1E, 0xAC, 0x79, 0xCB, 0x74, 0x90, 0x15, 0xF5, 0x74,
-    0x58, 0xB4, 0xD1, 0x75, 0xB1, 0xCD, 0x83, 0x80, 0xAD, 0xD7, 0x85, 0x4D, 0xDF, 0x12, 0x97, 0x55,
-    0x36, 0xA6, 0x8A, 0xC7, 0xF4, 0x1F, 0x70, 0x7E, 0x46, 0xF6, 0x6B, 0x8B, 0x1D, 0x6F, 0xAB, 0x77,
-    0x7A, 0x6C, 0xF9, 0xF7, 0xD1, 0x38, 0x2D, 0x2C, 0x23, 0xBA, 0x00, 0x91, 0x64, 0x99, 0x66, 0x8B,
-    0x5D, 0x17, 0x8B, 0x24, 0xDB, 0x2E, 0xEC, 0x21, 0xE6, 0x69, 0x92, 0xFD, 0xC5, 0xC9, 0x56, 0x60,
-    0x86, 0x68, 0xF4, 0xD9, 0xDF, 0x95, 0x36, 0x90, 0xAE, 0x51, 0x1D, 0xF3, 0xAA, 0x75, 0x1C, 0x6D,
-    0x36, 0x0E, 0x7D, 0x71, 0x96, 0x3D, 0x74, 0x15, 0x00, 0x4B, 0xA9, 0x9E, 0xD3, 0xFB, 0x4B, 0x59,
-    0x9D, 0xB2, 0x8C, 0xD3, 0x4F, 0x2B, 0x8B, 0x85, 0xAE, 0xCE, 0x0E, 0x4E, 0xB8, 0x26, 0x32, 0x72,
-    0x19, 0xC8, 0xA2, 0x33, 0x6B, 0x1B, 0xC5, 0x50, 0x49, 0x11, 0x7C, 0xD2, 0x44, 0x3F, 0xFC, 0xE9,
-    0x6F, 0xBA, 0xE0, 0xDD, 0x6E, 0x1C, 0xBD, 0x7E, 0x1A, 0xF7, 0xCC, 0x7E, 0x36, 0x8B, 0x6A, 0x8A,
-    0xAC, 0x80, 0xF9, 0xEF, 0xDB, 0x27, 0xBA, 0xA8, 0x29, 0x9E, 0x97, 0x7D, 0x4D, 0x6A, 0xEB, 0x8D,
-    0xFE, 0x85, 0xA2, 0xAC, 0x16, 0x86, 0x9D, 0x56, 0xED, 0x08, 0x74, 0x9A, 0xF4, 0xAC, 0x44, 0xBC,
-    0x83, 0x03, 0xCB, 0x4E, 0xE4, 0x2C, 0x88, 0x19, 0xD9, 0xB4, 0xCB, 0x13, 0x8F, 0xD8, 0x65, 0x8A,
-    0xEE, 0xD2, 0x8E, 0x07, 0x1E, 0xA1, 0x6D, 0x2A, 0x74, 0x3F, 0x3A, 0x17, 0xD4, 0x6B, 0xC8, 0x04,
-    0xA7, 0xF9, 0xB0, 0x44, 0xB3, 0x70, 0x9A, 0xEA, 0xA4, 0x81, 0xFC, 0xD4, 0x7A, 0xAC, 0x79, 0x43,
-    0x58, 0x5C, 0x5B, 0xA5, 0x6A, 0x2A, 0x3D, 0xF7, 0x28, 0xF8, 0x88, 0xBF, 0x4C, 0x7A, 0x10, 0xCF,
-    0x6B, 0x0C, 0xF7, 0xF0, 0xE8, 0x23, 0xF1, 0xBC, 0x34, 0xDA, 0x9B, 0xD2, 0x55, 0x60, 0x6A, 0x9F,
-    0xA7, 0x09, 0xC8, 0x25, 0xD7, 0xDC, 0x00, 0xEB, 0x59, 0x51, 0x9B, 0xE8, 0x01, 0x48, 0xDA, 0xB4,
-    0x42, 0x6C, 0xDA, 0xD2, 0xB5, 0x71, 0x3A, 0xA1, 0x63, 0x28, 0x4E, 0x8F, 0x4F, 0x10, 0xE3, 0x34,
-    0x73, 0x97, 0xDC, 0x31, 0x48, 0xC4, 0x9B, 0x8F, 0xD2, 0x31, 0x7C, 0x1C, 0xC2, 0xC6, 0x82, 0x55,
-    0xC5, 0x02, 0x8A, 0x59, 0xEE, 0xBA, 0xC0, 0x54, 0x29, 0x31, 0x75, 0xC4, 0x4C, 0x08, 0xAB, 0x35,
-    0xB8, 0x54, 0xD0, 0x12, 0xD3, 0x5B, 0xD6, 0x32, 0x4F, 0x76, 0xFF, 0xB1, 0xB7, 0x64, 0xC9, 0xF8,
-    0x89, 0x94, 0x08, 0x2F, 0xB3, 0x07, 0xD0, 0xC4, 0x1F, 0x5F, 0xB2, 0xC6, 0xD5, 0x6C, 0x44, 0x5C,
-    0x02, 0x3B, 0x01, 0x51, 0x59, 0xA3, 0xF0, 0x28, 0x6C, 0xB8, 0x85, 0x33, 0x77, 0x37, 0x6D, 0x78,
-    0x00, 0xE0, 0x44, 0x35, 0x54, 0xD4, 0x55, 0x7D, 0x77, 0x38, 0xD9, 0x9A, 0x55, 0x7D, 0x83, 0x56,
-    0xB2, 0x69, 0x74, 0xCA, 0x78, 0x37, 0x34, 0x76, 0xA7, 0x47, 0x6A, 0xF2, 0xE0, 0x29, 0x4F, 0x7B,
-    0xD2, 0x32, 0xA2, 0xF8, 0xA8, 0x4D, 0xCB, 0xE5, 0xEC, 0x29, 0xE1, 0x8B, 0xB4, 0x5E, 0xEC, 0xB8,
-    0x76, 0x0E, 0xE9, 0xF1, 0x53, 0x6C, 0xB9, 0x6D, 0x8C, 0x16, 0x27, 0x30, 0x8E, 0xDF, 0x9A, 0x68,
-    0x1D, 0xCB, 0x6C, 0x5D, 0x9F, 0x00, 0xD3, 0x82, 0x9D, 0x62, 0x58, 0xD2, 0x2C, 0x46, 0x1B, 0xAE,
-    0x53, 0xB8, 0x87, 0x74, 0xFD, 0xB8, 0x36, 0x7F, 0x42, 0xE2, 0x43, 0x97, 0x86, 0x02, 0xD8, 0xDF,
-    0x23, 0xC9, 0xF9, 0xF5, 0x40, 0xBE, 0x80, 0xDF, 0x71, 0x09, 0x87, 0x68, 0x78, 0x47, 0x4F, 0xEC,
-    0x33, 0xEE, 0xF0, 0x31, 0xA2, 0xA0, 0x6B, 0x4B, 0xF7, 0xC7, 0xD1, 0x02, 0xF9, 0x8B, 0xC4, 0xE9,
-    0x80, 0xF8, 0xA7, 0x76, 0x39, 0xB4, 0xCE, 0x9D, 0x1D, 0x80, 0xF4, 0xF7, 0xB9, 0xEF, 0x68, 0x05,
-    0x4B, 0xAA, 0xCF, 0x0C, 0x3B, 0x5F, 0x87, 0xF1, 0x46, 0x3D, 0xFE, 0x8A, 0x8D, 0x5A, 0xE3, 0xB2,
-    0x89, 0x1A, 0x88, 0x42, 0xB1, 0xB0, 0xEB, 0x08, 0x7C, 0xFF, 0xA2, 0x3B, 0x6A, 0x6E, 0x69, 0xED,
-    0x0E, 0x96, 0x1A, 0x09, 0x35, 0x7D, 0x8C, 0xD0, 0xD5, 0x0E, 0xB1, 0x46, 0xDA, 0x1E, 0x33, 0xB3,
-    0x82, 0x2A, 0xE6, 0xA5, 0xA2, 0x5E, 0x25, 0x5C, 0x6E, 0xF9, 0x12, 0x76, 0xF1, 0x67, 0x1C, 0x22,
-    0x32, 0x7D, 0xE8, 0xB6, 0x72, 0x16, 0x04, 0x25, 0x84, 0x46, 0x7B, 0x68, 0x88, 0x53, 0x75, 0xCC,
-    0x63, 0xA0, 0x75, 0xE7, 0x7D, 0xB7, 0x49, 0xF5, 0x7D, 0x90, 0x1B, 0xE8, 0x60, 0x47, 0xE4, 0xF1,
-    0x69, 0xE3, 0x28, 0x0E, 0xBF, 0x8E, 0xFE, 0x09, 0x88, 0xCE, 0x48, 0xE7, 0x37, 0x31, 0xC5, 0x52,
-    0xA3, 0xFE, 0xEA, 0x45, 0xB2, 0xF5, 0x60, 0xE6, 0xC1, 0x17, 0xD1, 0xFC, 0xC4, 0x9B, 0x74, 0x46,
-    0xFF, 0x02, 0xCE, 0x1A, 0xCF, 0x1A, 0x12, 0xD4, 0xD9, 0xB8, 0x32, 0xAC, 0x44, 0x91, 0x77, 0x79,
-    0xFB, 0x73, 0x57, 0xB5, 0x64, 0x84, 0x07, 0x8E, 0xAE, 0x0F, 0x89, 0xD5, 0xA3, 0x76, 0xD7, 0x87,
-    0xC4, 0xF2, 0x9D, 0xE4, 0x7F, 0x9D, 0x7B, 0x1A, 0x7B, 0x3E, 0xB9, 0x30, 0xE6, 0xB8, 0x2A, 0x72,
-    0x4D, 0x57, 0x1F, 0xA4, 0x4F, 0xE9, 0x1D, 0x9D, 0x3B, 0x97, 0xEB, 0x81, 0x57, 0x3C, 0xFF, 0x8A,
-    0x1E, 0x6B, 0xE4, 0xBA, 0x72, 0x5E, 0x34, 0x7F, 0x0A, 0xB5, 0xF8, 0x28, 0x78, 0xEE, 0x0A, 0x88,
-    0xDB, 0x39, 0x67, 0x2F, 0x1A, 0x3E, 0xD5, 0x63, 0x39, 0xDF, 0x2A, 0x34, 0x65, 0xC7, 0x29, 0x1B,
-    0x0E, 0xD8, 0x72, 0xCA, 0x8E, 0x83, 0x68, 0x49, 0x4A, 0x96, 0x68, 0x3A, 0xD5, 0x29, 0x65, 0xAB,
-    0x63, 0x82, 0xD1, 0x76, 0x6A, 0x12, 0x57, 0x5B, 0xD4, 0xBB, 0x5A, 0x00, 0xD6, 0x71, 0x9C, 0x44,
-    0x3B, 0xBC, 0x2B, 0xCC, 0xEB, 0xD8, 0x0E, 0xEE, 0x95, 0xCC, 0x03, 0xA9, 0x31, 0x58, 0x0E, 0xB1,
-    0x3A, 0x71, 0x7E, 0x39, 0x3A, 0xED, 0x46, 0x17, 0xFD, 0x53, 0x9E, 0xE4, 0x8F, 0x61, 0x01, 0x8F,
-    0x43, 0x48, 0x2E, 0x87, 0xAC, 0xFB, 0x94, 0x67, 0x9D, 0x5F, 0xB2, 0x2F, 0x5E, 0x35, 0x68, 0x22,
-    0x04, 0x47, 0x40, 0xB2, 0x90, 0xEB, 0x2B, 0x8C, 0x36, 0x73, 0x32, 0x9E, 0x8B, 0xE3, 0x78, 0xDF,
-    0x60, 0x87, 0x0E, 0x4F, 0x63, 0xCB, 0x7E, 0x64, 0x46, 0xD9, 0xB5, 0x14, 0x55, 0xD7, 0x8D, 0xC1,
-    0x89, 0x4A, 0x5C, 0x67, 0x74, 0xB4, 0x71, 0x6E, 0x63, 0x40, 0x88, 0x97, 0xD4, 0xAE, 0x79, 0x4A,
-    0xE5, 0x3C, 0x6D, 0xEF, 0xD9, 0x41, 0xD6, 0xB5, 0xBA, 0xB5, 0xC7, 0xEB, 0xEE, 0xF7, 0x65, 0xBD,
-    0x9B, 0x67, 0xDC, 0x12, 0xCA, 0xC8, 0x9A, 0xB1, 0x8B, 0x40, 0x12, 0x38, 0x38, 0x82, 0xCB, 0x36,
-    0x5C, 0xB7, 0x2E, 0x5C, 0x57, 0xAE, 0x4B, 0x5F, 0xAF, 0x5D, 0x57, 0xCF, 0x98, 0x8E, 0x9E, 0x80,
-    0xC9, 0xC8, 0xB7, 0x5B, 0x3F, 0x23, 0x1C, 0xDE, 0xF2, 0xE2, 0x7D, 0xA3, 0x63, 0xB6, 0x86, 0x24,
-    0x08, 0xAE, 0x9F, 0x15, 0x73, 0x0A, 0x1A, 0x04, 0x88, 0x86, 0x7A, 0x4A, 0x04, 0x6C, 0xCC, 0x0D,
-    0x54, 0xE3, 0xB5, 0x09, 0xAA, 0x14, 0x05, 0x2C, 0x3C, 0x90, 0xAB, 0x76, 0x91, 0x7B, 0x0E, 0x36,
-    0x28, 0xA3, 0x0A, 0xDE, 0x55, 0x1F, 0x3A, 0x30, 0x11, 0x8D, 0xD1, 0x78, 0x6F, 0x94, 0x11, 0x7D,
-    0x21, 0xDE, 0x80, 0x88, 0x76, 0xD4, 0x7B, 0x02, 0x28, 0x46, 0xD6, 0x3C, 0xDA, 0x9C, 0x19, 0x01,
-    0xF1, 0x9B, 0x88, 0x42, 0x8A, 0x5A, 0xFC, 0x53, 0x16, 0xD8, 0x05, 0xF6, 0xEB, 0x5A, 0x5D, 0x2B,
-    0xD0, 0x89, 0x87, 0xAD, 0x8E, 0xD9, 0x2F, 0xAD, 0xF6, 0xCA, 0xD9, 0x6F, 0xA9, 0x8D, 0xFE, 0x64,
-    0x72, 0x15, 0x92, 0xD7, 0x5C, 0xE5, 0x63, 0xB1, 0x1C, 0x69, 0xB1, 0x1C, 0x28, 0xB1, 0xAA, 0x95,
-    0xCC, 0xDC, 0x3B, 0x81, 0x93, 0x10, 0xB3, 0x34, 0xB0, 0x85, 0x8B, 0x9A, 0x91, 0xCF, 0xB2, 0x7D,
-    0x2E, 0xB4, 0xAF, 0xCF, 0xAC, 0xAF, 0xAE, 0xC6, 0xA2, 0xC7, 0x63, 0x22, 0x71, 0x9F, 0xDF, 0xC4,
-    0x00, 0x28, 0x22, 0x3E, 0x43, 0x26, 0x6E, 0xAA, 0x11, 0x85, 0xFC, 0x76, 0x0A, 0xE0, 0x7A, 0xA8,
-    0x6B, 0xDE, 0x05, 0xEE, 0xA0, 0x9B, 0x25, 0xBF, 0x64, 0x37, 0xA9, 0x93, 0xB6, 0xD9, 0xA7, 0xB3,
-    0x90, 0xB8, 0x23, 0x17, 0xCB, 0xFB, 0x4A, 0x9C, 0x03, 0x31, 0x33, 0xC9, 0xD5, 0xA6, 0x3D, 0x8B,
-    0x6C, 0x6B, 0x5B, 0xB3, 0xC8, 0xF4, 0xCC, 0x44, 0x8B, 0x59, 0xC5, 0xDD, 0x4C, 0x5D, 0x5C, 0xFC,
-    0x2D, 0x29, 0x73, 0x7D, 0x72, 0x27, 0x0E, 0x6B, 0xC8, 0x24, 0x76, 0x7A, 0x53, 0x6B, 0xBF, 0x16,
-    0x0F, 0x0B, 0x2C, 0x92, 0x6F, 0x50, 0xA0, 0x58, 0xF2, 0xD9, 0xD5, 0x3B, 0xEC, 0x1A, 0x7C, 0xD7,
-    0x22, 0x5D, 0x13, 0xCF, 0xC9, 0x98, 0x41, 0xAE, 0x5A, 0xF9, 0x4F, 0x60, 0xFF, 0x1C, 0xD8, 0xEF,
-    0x69, 0x62, 0x93, 0xA7, 0x54, 0x63, 0x71, 0x38, 0xE6, 0xCC, 0xF0, 0x24, 0xE1, 0x60, 0x3E, 0x86,
-    0x1C, 0x17, 0xC6, 0x3C, 0x62, 0x64, 0x02, 0x79, 0xBA, 0x8B, 0x76, 0xA5, 0xB4, 0x54, 0xD1, 0xED,
-    0xAF, 0x35, 0x86, 0xA0, 0xEC, 0x6F, 0xF0, 0x2C, 0xA8, 0x79, 0xC5, 0xDE, 0x1A, 0x5C, 0xCC, 0x56,
-    0x87, 0x55, 0x6A, 0x7F, 0x8E, 0x4B, 0x9E, 0x44, 0xA5, 0x6F, 0x35, 0xE6, 0xCF, 0x20, 0xAC, 0x9A,
-    0x21, 0x0E, 0xB6, 0x7C, 0xA1, 0xE7, 0xCA, 0xC3, 0x51, 0xC7, 0x01, 0x22, 0xA1, 0x14, 0xDD, 0x78,
-    0x88, 0x6F, 0xD5, 0x78, 0xF9, 0x52, 0x0C, 0x7F, 0x21, 0xE2, 0xCE, 0xE5, 0xCB, 0x4B, 0xB4, 0x14,
-    0x5D, 0x71, 0xAF, 0xBE, 0xDB, 0xAD, 0x6A, 0x38, 0x4E, 0x2F, 0x3F, 0xF9, 0xBD, 0x2B, 0xB7, 0x65,
-    0x26, 0xE5, 0xFC, 0xD1, 0xC6, 0x41, 0x48, 0x4D, 0xA0, 0xD1, 0x98, 0x7D, 0x85, 0x95, 0xDE, 0xA4,
-    0x45, 0xC0, 0x44, 0x0B, 0xBD, 0xEB, 0xD7, 0x21, 0x57, 0x02, 0xFA, 0x06, 0x4B, 0x0B, 0x60, 0x41,
-    0x7D, 0x15, 0xD4, 0xA8, 0x9F, 0xA1, 0x8C, 0xC2, 0x6D, 0xEC, 0x64, 0x5D, 0xED, 0xAA, 0xF7, 0xCC,
-    0x95, 0xDD, 0xD3, 0x0A, 0xA8, 0x6F, 0x4A, 0x6F, 0xD3, 0x9A, 0xA5, 0xA0, 0x85, 0xAE, 0xCA, 0x83,
-    0x3C, 0xFA, 0xB4, 0xD6, 0x58, 0x2A, 0xFE, 0x67, 0xE0, 0xA6, 0x8E, 0xF2, 0xAA, 0xC4, 0x23, 0x0A,
-    0x36, 0x4C, 0x0F, 0x42, 0xEE, 0x0B, 0xEB, 0x73, 0x4E, 0xEE, 0x23, 0xC3, 0xF8, 0xCA, 0x08, 0x0F,
-    0x6C, 0xA4, 0x99, 0x93, 0x66, 0xA9, 0x26, 0x41, 0x54, 0xB1, 0x46, 0xBC, 0x17, 0x4A, 0xC5, 0xF2,
-    0xDC, 0xA0, 0x8C, 0xC7, 0xE2, 0xC5, 0xD8, 0x07, 0x96, 0x14, 0xCA, 0x0C, 0x0A, 0x94, 0x73, 0xB1,
-    0x50, 0x2A, 0x13, 0xAF, 0x81, 0x37, 0xDB, 0x14, 0x37, 0xA7, 0x6F, 0xE1, 0xE6, 0x10, 0x07, 0x2A,
-    0x5A, 0x6F, 0x8E, 0xE0, 0xF9, 0x64, 0x38, 0x50, 0x63, 0x8A, 0x3B, 0x71, 0x9A, 0xB3, 0x57, 0x27,
-    0xEC, 0xE9, 0x58, 0xE4, 0x42, 0xF0, 0xEA, 0x87, 0x6D, 0x28, 0x0E, 0xC7, 0x8D, 0xD1, 0xD0, 0x3F,
-    0x66, 0x65, 0x0D, 0x0E, 0xC8, 0x2B, 0x31, 0x46, 0x86, 0xBC, 0x86, 0xD6, 0xDC, 0x94, 0x1A, 0x37,
-    0xE0, 0x0A, 0x2E, 0x29, 0x88, 0x16, 0xE4, 0xF0, 0xF4, 0x2D, 0x5D, 0x1F, 0xA8, 0xB7, 0x19, 0xE1,
-    0xE8, 0x0E, 0xEC, 0xD8, 0x67, 0xDB, 0x87, 0xDF, 0x79, 0x1F, 0x77, 0x41, 0x1B, 0xBE, 0xD9, 0xB2,
-    0x65, 0x9F, 0x7D, 0x1F, 0x51, 0x3D, 0x46, 0x75, 0xFC, 0x7C, 0x17, 0x97, 0xEC, 0xD9, 0x67, 0xE3,
-    0x47, 0x0A, 0x0F, 0x23, 0xC3, 0xF1, 0xEB, 0x68, 0xDA, 0x37, 0xAE, 0xF3, 0xC3, 0x81, 0xC1, 0xB8,
-    0x8D, 0x9B, 0x05, 0x0D, 0x8A, 0xE2, 0xE2, 0x71, 0xD9, 0x9B, 0x70, 0xF0, 0x33, 0x3A, 0x30, 0xF1,
-    0x77, 0x79, 0xB2, 0xE0, 0x21, 0x31, 0xB1, 0xB0, 0xA8, 0xAC, 0x62, 0x25, 0x2E, 0xC7, 0xD4, 0xF8,
-    0xEF, 0x88, 0x82, 0x02, 0x28, 0x15, 0x3B, 0x6A, 0xEE, 0x2F, 0x67, 0xB5, 0x91, 0xAA, 0x4A, 0xCF,
-    0x7A, 0x77, 0x6E, 0x84, 0xFC, 0xA3, 0x3C, 0xC8, 0x0E, 0xFA, 0xC8, 0x77, 0xFA, 0x68, 0x50, 0x8D,
-    0x19, 0x0F, 0x77, 0xE8, 0x68, 0xF3, 0xAA, 0x0B, 0x30, 0xE7, 0xC8, 0xB5, 0x96, 0x7B, 0xF4, 0x62,
-    0xA0, 0x23, 0xE2, 0x1C, 0x55, 0x73, 0x38, 0xCD, 0x8A, 0x2D, 0xD9, 0xEC, 0xD2, 0xA6, 0x22, 0x3E,
-    0xD0, 0x13, 0x58, 0x71, 0x58, 0x81, 0xDA, 0x7F, 0x9E, 0x34, 0x74, 0x4B, 0xC7, 0xC3, 0x49, 0x57,
-    0xCB, 0x38, 0x2F, 0x25, 0x50, 0xE8, 0xF1, 0x20, 0x95, 0x62, 0x14, 0x9A, 0x22, 0xB2, 0x89, 0xFA,
-    0xDF, 0x5E, 0x95, 0x14, 0x48, 0x13, 0x75, 0xD1, 0xBC, 0x1C, 0x71, 0x20, 0xAF, 0x50, 0x2E, 0xAD,
-    0x6A, 0x12, 0xE8, 0x84, 0xA2, 0x4E, 0x90, 0x85, 0xCF, 0xE3, 0x23, 0xF3, 0x90, 0xE6, 0xE7, 0x46,
-    0x52, 0x84, 0x60, 0x0F, 0xA7, 0x0E, 0xA8, 0x6D, 0x29, 0xA8, 0x08, 0xBD, 0x9F, 0xE8, 0xC2, 0x78,
-    0xF4, 0x4F, 0xC3, 0x4E, 0x8E, 0xB8, 0xF1, 0x78, 0x24, 0x42, 0xBD, 0xAB, 0x19, 0x4D, 0xF1, 0x3D,
-    0xE4, 0x11, 0xE9, 0xFB, 0x17, 0xCF, 0x3F, 0xDF, 0x69, 0x73, 0xFB, 0x61, 0x30, 0x9F, 0xAB, 0x6A,
-    0xAD, 0x6B, 0x64, 0xF3, 0xFC, 0x8C, 0x8A, 0x84, 0x5C, 0xB9, 0x91, 0xFE, 0x1D, 0xDD, 0xEB, 0x71,
-    0xED, 0x84, 0xC5, 0x63, 0x3C, 0x98, 0xDF, 0xE2, 0xEB, 0x0F, 0x80, 0x26, 0xB2, 0x7D, 0xFB, 0xBA,
-    0x92, 0x0D, 0x4B, 0x35, 0xC6, 0x9F, 0x06, 0xA3, 0x48, 0x4A, 0x56, 0x73, 0xDC, 0xB1, 0x2B, 0x06,
-    0x0B, 0x02, 0x39, 0xCB, 0xCC, 0x31, 0xCA, 0xE1, 0xAA, 0x2B, 0xA6, 0xBF, 0xB5, 0x2B, 0x26, 0x44,
-    0xF7, 0x07, 0x94, 0x0B, 0x97, 0xC4, 0xB3, 0x98, 0x09, 0xBE, 0xB2, 0xA6, 0xB8, 0xCB, 0x1F, 0x94,
-    0xF8, 0x83, 0x39, 0x09, 0x8A, 0xD3, 0x07, 0x50, 0xC2, 0xDC, 0xC5, 0x2F, 0x9F, 0x44, 0xD7, 0xDC,
-    0x3C, 0xF1, 0xFB, 0xE4, 0x7E, 0xFE, 0xE5, 0x09, 0x9C, 0x24, 0xFD, 0x39, 0xD7, 0xBF, 0x5C, 0xAE,
-    0x53, 0xE2, 0xC8, 0xA4, 0xE8, 0x79, 0x36, 0x9C, 0xEA, 0xEC, 0xC1, 0x2F, 0x3D, 0x95, 0xA3, 0x0A,
-    0x82, 0x13, 0x98, 0x97, 0x3F, 0xE7, 0xB0, 0xEC, 0x01, 0x0F, 0xF6, 0xEE, 0xE9, 0xD1, 0xE5, 0xCB,
-    0xE9, 0xFA, 0x37, 0x7D, 0x0D, 0xC0, 0x0A, 0x7A, 0xCA, 0xF8, 0x01, 0x46, 0x0C, 0x5B, 0x9E, 0x88,
-    0xCD, 0x20, 0x50, 0xEF, 0xAD, 0x4F, 0x19, 0x67, 0x99, 0x4F, 0xC3, 0x53, 0xC6, 0x19, 0x9D, 0xFE,
-    0xA4, 0x5F, 0xEA, 0xDD, 0xEE, 0x70, 0xCA, 0xB8, 0x36, 0xB4, 0x94, 0xF7, 0x72, 0xCA, 0x38, 0x3C,
-    0x8B, 0xB3, 0xC4, 0x7C, 0xCB, 0x61, 0xAD, 0x9F, 0xFE, 0xB5, 0x4D, 0xEC, 0xC5, 0xC6, 0x44, 0xFC,
-    0x3D, 0x02, 0x9E, 0xC8, 0x72, 0xC0, 0x0E, 0xB0, 0xCE, 0xF5, 0x58, 0xB1, 0xD0, 0x4E, 0x74, 0x1A,
-    0xB8, 0x3F, 0xEC, 0x58, 0xBE, 0xC3, 0xD6, 0xC4, 0xEC, 0x5A, 0xBD, 0x9C, 0x3E, 0xE1, 0xD9, 0x6E,
-    0x35, 0x6B, 0xE5, 0x68, 0xC2, 0x79, 0xD5, 0xED, 0x54, 0x7E, 0x5A, 0x56, 0x44, 0x88, 0xAD, 0xA5,
-    0xF1, 0x54, 0xEA, 0x89, 0x86, 0x5B, 0x1C, 0x41, 0x69, 0x20, 0x42, 0x1E, 0x1A, 0x43, 0xEB, 0x90,
-    0x00, 0x2E, 0xF8, 0xD6, 0xBF, 0x4D, 0x40, 0xE0, 0xBE, 0xDC, 0x9C, 0x2C, 0xF5, 0x2C, 0x50, 0x1E,
-    0xFD, 0x27, 0x38, 0x09, 0x75, 0x1F, 0x1D, 0x4F, 0x97, 0xC9, 0xC5, 0x93, 0xF3, 0x07, 0x3A, 0x75,
-    0x75, 0xC1, 0x23, 0x1F, 0x81, 0x8C, 0xFE, 0x81, 0xF0, 0x1E, 0xB9, 0xE6, 0x48, 0xAB, 0x9B, 0xA6,
-    0x55, 0xE1, 0x4C, 0xD6, 0xAF, 0xE2, 0xEA, 0x9C, 0x77, 0x34, 0xDE, 0xD3, 0x91, 0x8F, 0x2A, 0x49,
-    0x16, 0xC0, 0x8F, 0x82, 0xE4, 0x13, 0x19, 0xDF, 0x5D, 0x8E, 0x36, 0xD8, 0x85, 0x45, 0x8B, 0xA2,
-    0xE0, 0x0F, 0xDC, 0x91, 0xA3, 0x07, 0xB4, 0x46, 0x28, 0x93, 0xC0, 0xD4, 0xB3, 0xB2, 0x58, 0x88,
-    0x9E, 0xBC, 0xCA, 0xC2, 0x7A, 0x6C, 0x45, 0xCC, 0x10, 0x99, 0x73, 0x59, 0x56, 0x53, 0x0F, 0xD6,
-    0x53, 0x57, 0x48, 0x42, 0xB2, 0xB2, 0x0A, 0xA8, 0x18, 0x97, 0x66, 0x66, 0x86, 0x02, 0x94, 0xC7,
-    0x16, 0x82, 0x3F, 0xC2, 0x7F, 0x5A, 0xAA, 0x89, 0xB2, 0x53, 0x56, 0x9E, 0x8A, 0x19, 0xFD, 0x17,
-    0x39, 0xFE, 0xDD, 0xD9, 0xA5, 0x6B, 0x97, 0xBF, 0x17, 0x31, 0x10, 0xD8, 0xEE, 0x33, 0xAC, 0xB1,
-    0x67, 0xDC, 0xC9, 0xAC, 0x7A, 0xE6, 0xA6, 0xD6, 0x5C, 0x82, 0xE1, 0xD9, 0x2C, 0x71, 0x86, 0xB5,
-    0x0E, 0x3C, 0x76, 0xD3, 0x9F, 0xC6, 0x75, 0x75, 0x92, 0x46, 0xFE, 0x5C, 0x6B, 0xAF, 0xBA, 0x6D,
-    0xEA, 0x76, 0x6B, 0x8F, 0x97, 0x86, 0x2E, 0x14, 0xA4, 0x80, 0xF3, 0x45, 0xB4, 0xE7, 0x75, 0x4A,
-    0x54, 0xFD, 0xBD, 0xE2, 0xA6, 0x63, 0xE2, 0xC8, 0x15, 0x6E, 0x3D, 0xA8, 0x50, 0x6D, 0x99, 0x63,
-    0x1F, 0x56, 0x5E, 0xC0, 0x3D, 0x26, 0xBD, 0xB5, 0x5E, 0x9F, 0x82, 0xE1, 0x5A, 0x76, 0xB5, 0x67,
-    0xD7, 0x35, 0xED, 0x3A, 0xD9, 0xD0, 0xB6, 0x5D, 0xED, 0xDB, 0x75, 0x8D, 0xBB, 0x4E, 0x3C, 0xB4,
-    0x75, 0xD7, 0xF5, 0xEE, 0x2A, 0xE7, 0x3B, 0x09, 0x71, 0x41, 0x4F, 0xE7, 0x46, 0xB9, 0x56, 0x24,
-    0x2D, 0xBA, 0x70, 0xDE, 0x69, 0xBD, 0x6A, 0xF0, 0x0B, 0xDC, 0x1A, 0x79, 0xEF, 0x72, 0x5E, 0x4D,
-    0x88, 0xF3, 0xBC, 0x52, 0x64, 0x6E, 0x05, 0x5F, 0x0B, 0x8D, 0xC4, 0x16, 0x0A, 0x24, 0xBD, 0x89,
-    0xEB, 0x3C, 0xD4, 0xE4, 0xE0, 0xD8, 0x39, 0xF8, 0x30, 0x08, 0x22, 0x07, 0x0D, 0x8F, 0xB4, 0xDC,
-    0x32, 0x6C, 0x4F, 0xC5, 0xE1, 0x8D, 0xC2, 0x7D, 0x38, 0xD3, 0x12, 0x07, 0x6A, 0x76, 0x21, 0xD2,
-    0x5E, 0x09, 0x0E, 0x96, 0xC3, 0xA1, 0x96, 0x9E, 0x3B, 0x71, 0xA9, 0x92, 0x09, 0x7C, 0x38, 0xB8,
-    0x53, 0x2D, 0xE9, 0xB7, 0xF8, 0xE3, 0x12, 0xC2, 0x5D, 0xB5, 0xCB, 0xED, 0xC9, 0x7F, 0xA2, 0x91,
-    0x3D, 0xF9, 0x0F, 0xCE, 0x61, 0x30, 0x85, 0xB7, 0x38, 0x88, 0x7E, 0x7E, 0xD2, 0x84, 0xE2, 0x6A,
-    0xA1, 0x65, 0xF5, 0xF3, 0xE6, 0x61, 0xF3, 0x65, 0xF1, 0xB8, 0xD0, 0x27, 0x7F, 0x1A, 0x75, 0x53,
-    0xDE, 0x60, 0xB6, 0x9F, 0xE9, 0xE9, 0x02, 0x45, 0x47, 0xAE, 0x1A, 0x0A, 0x31, 0x36, 0x24, 0xE4,
-    0xE1, 0x12, 0xFE, 0x6E, 0x0F, 0xD0, 0x9F, 0xD6, 0x7D, 0x76, 0xAC, 0x89, 0x1C, 0x57, 0x75, 0x6E,
-    0x01, 0x86, 0x60, 0xB2, 0x41, 0x4B, 0x04, 0x50, 0xEC, 0x85, 0xC0, 0x5F, 0x58, 0x6A, 0xFE, 0xA9,
-    0xD7, 0xE9, 0xB9, 0xFE, 0xE4, 0xE5, 0x0C, 0x84, 0xFD, 0xE3, 0xC5, 0xAD, 0xA3, 0x56, 0x73, 0xE2,
-    0x59, 0x7F, 0xB2, 0xE4, 0x5A, 0x38, 0xF7, 0x60, 0x50, 0x9E, 0x2C, 0x4A, 0xD6, 0xF7, 0xC5, 0xBD,
-    0xD3, 0x93, 0x5F, 0xB3, 0xBF, 0x0D, 0xB0, 0x81, 0xB4, 0xEC, 0xE8, 0x2A, 0x23, 0x77, 0x74, 0xE5,
-    0xA0, 0x4B, 0x8B, 0x15, 0x6C, 0x7B, 0xAE, 0x5E, 0x2A, 0x55, 0x2A, 0x30, 0x8C, 0x28, 0x08, 0x66,
-    0x57, 0x69, 0xC6, 0x7E, 0x6B, 0xF0, 0x91, 0xD5, 0xBF, 0xDA, 0x50, 0xE2, 0x78, 0x7F, 0x9E, 0x1D,
-    0xE1, 0x3E, 0x83, 0xBF, 0x69, 0x42, 0x4C, 0x9A, 0x42, 0xC2, 0xBD, 0x2E, 0x98, 0xB4, 0x7C, 0xBE,
-    0x40, 0x59, 0x75, 0xDA, 0xD0, 0xF3, 0x40, 0xFA, 0xB0, 0x24, 0xE2, 0x49, 0xD8, 0x40, 0x51, 0xD3,
-    0x65, 0x13, 0x1B, 0x9C, 0x6D, 0xD6, 0xD4, 0xF3, 0x3C, 0x0F, 0x7C, 0x72, 0x41, 0x72, 0x54, 0xEF,
-    0x22, 0xF3, 0xF6, 0xEE, 0x95, 0x15, 0x20, 0x56, 0xCC, 0x80, 0xD4, 0x4E, 0x40, 0xE6, 0xE0, 0x01,
-    0xBE, 0x39, 0x98, 0x60, 0x07, 0x99, 0x00, 0xBF, 0xC3, 0x49, 0x3A, 0x71, 0x99, 0x5D, 0xAC, 0x84,
-    0xB7, 0x07, 0xF3, 0xB0, 0xD7, 0x09, 0x36, 0x3A, 0x1D, 0xF3, 0x3C, 0x1D, 0x9C, 0xC5, 0x17, 0xFF,
-    0x14, 0x27, 0x94, 0x4E, 0x11, 0x80, 0x52, 0xC7, 0xCC, 0xB1, 0x87, 0x3F, 0x44, 0x71, 0x21, 0x5C,
-    0xC7, 0x66, 0x0E, 0xEF, 0x78, 0x70, 0xAE, 0x52, 0xAB, 0x70, 0x81, 0x2C, 0x25, 0xE9, 0x52, 0x8F,
-    0x99, 0x6F, 0xD6, 0x63, 0x2E, 0xA1, 0xEF, 0xBB, 0x1D, 0x9C, 0x6B, 0xEF, 0x7A, 0x70, 0x6E, 0xBB,
-    0x59, 0x8F, 0xE9, 0xDF, 0x74, 0x70, 0xEE, 0xF4, 0xCF, 0xF5, 0xE0, 0xDC, 0x59, 0x0F, 0xCE, 0x75,
-    0xE5, 0xC7, 0x4B, 0x98, 0x5D, 0x95, 0x5B, 0x7A, 0xF5, 0x18, 0x64, 0xF9, 0x02, 0x58, 0xE0, 0x8A,
-    0x50, 0x06, 0xE9, 0x57, 0xFC, 0x49, 0x8B, 0xA0, 0x4D, 0xC1, 0x9B, 0xC2, 0xA0, 0x38, 0x33, 0x5D,
-    0x0F, 0x9B, 0x73, 0x7F, 0x0D, 0x69, 0x31, 0xD6, 0x21, 0x96, 0x91, 0xBC, 0x03, 0x3A, 0xE0, 0xF4,
-    0xF6, 0x49, 0x24, 0x88, 0x70, 0x38, 0x69, 0x82, 0xB9, 0x2C, 0x4A, 0xCD, 0xA1, 0x13, 0x72, 0x38,
-    0x1B, 0xF2, 0x7F, 0x00, 0x95, 0x56, 0xCF, 0xAF, 0xD5, 0x44, 0x14, 0x3E, 0xED, 0xC8, 0xAB, 0x58,
-    0xC8, 0x18, 0xE3, 0x33, 0xC8, 0x0F, 0x6B, 0x4C, 0x4C, 0x08, 0x11, 0xCA, 0x82, 0x05, 0x89, 0x0F,
-    0x5A, 0xC2, 0x02, 0x12, 0x16, 0x1A, 0x03, 0x89, 0xAE, 0x74, 0x69, 0xDC, 0xE0, 0xC2, 0x05, 0x0B,
-    0xE5, 0x36, 0x61, 0xE3, 0x4A, 0x59, 0xE8, 0xCE, 0x05, 0x4B, 0xC3, 0xFA, 0x2D, 0x4C, 0x04, 0xDA,
-    0xF8, 0x56, 0x46, 0x8D, 0x15, 0xFE, 0x00, 0x4B, 0xDC, 0xB9, 0xA1, 0xD1, 0x1A, 0x0A, 0xF6, 0xDE,
-    0xF1, 0xFB, 0xCE, 0xF4, 0xDE, 0x77, 0xDF, 0xCB, 0xD3, 0x60, 0x93, 0x69, 0xE7, 0xC7, 0x99, 0x73,
-    0xCE, 0x9C, 0xF3, 0x7D, 0x67, 0x9A, 0x39, 0xF7, 0xD0, 0xB9, 0x69, 0xE9, 0x5C, 0x95, 0x6D, 0xE9,
-    0x3A, 0xF7, 0x39, 0x5F, 0x3F, 0xF0, 0xD5, 0x1E, 0xB9, 0x79, 0xF3, 0xE6, 0xD7, 0x9C, 0x1C, 0xB0,
-    0xEA, 0x7A, 0xE1, 0xC3, 0x39, 0x3C, 0xD7, 0x9C, 0x3E, 0x7D, 0xE9, 0xBF, 0xB9, 0xC8, 0x13, 0xAC,
-    0x4A, 0x50, 0x4B, 0x23, 0x56, 0xA2, 0x42, 0xD6, 0xE4, 0xA8, 0x04, 0x8D, 0xB4, 0x12, 0xE7, 0x51,
-    0xB5, 0x3C, 0x32, 0x1C, 0xBD, 0x24, 0xE8, 0x77, 0x12, 0x17, 0x9B, 0xA3, 0x75, 0xEC, 0xC2, 0xE8,
-    0xA8, 0x24, 0x5B, 0x46, 0x96, 0xA3, 0x2B, 0x62, 0x2A, 0x53, 0xCB, 0xB1, 0xCD, 0x51, 0x58, 0x63,
-    0x17, 0x46, 0xEB, 0xF2, 0xB1, 0x88, 0xA1, 0x0F, 0xB3, 0x88, 0xEF, 0xC1, 0xBA, 0xC5, 0x49, 0xB6,
-    0x3C, 0xA9, 0x1E, 0x58, 0x03, 0x50, 0xAB, 0xD7, 0x55, 0x59, 0xD9, 0x3E, 0x74, 0x92, 0xD5, 0x71,
-    0x2F, 0x4E, 0x92, 0xD6, 0x4C, 0x29, 0x37, 0x69, 0xEC, 0x20, 0x2E, 0x4F, 0x39, 0x9C, 0x54, 0xB6,
-    0x0D, 0x67, 0xA3, 0x02, 0x3B, 0x04, 0x2E, 0xCF, 0x5A, 0x33, 0xC8, 0xA4, 0xD0, 0xE9, 0x49, 0x85,
-    0xD9, 0x1D, 0x95, 0x94, 0x1B, 0x98, 0xB9, 0x4F, 0x25, 0xAE, 0xB2, 0x5D, 0x56, 0xC5, 0x7D, 0x5A,
-    0x9B, 0xC1, 0xB6, 0x81, 0xA3, 0xD4, 0x59, 0xB5, 0x23, 0x93, 0xFB, 0x54, 0xA7, 0x02, 0x75, 0x3C,
-    0xD0, 0x9E, 0xED, 0xBC, 0x00, 0x4C, 0x94, 0xD7, 0x66, 0x0B, 0xCF, 0x77, 0x36, 0x3C, 0xB9, 0xEB,
-    0x72, 0x3B, 0x64, 0x4D, 0xE0, 0xA2, 0x41, 0xB2, 0xC6, 0x15, 0xD1, 0x90, 0xB4, 0xAA, 0xDC, 0xB6,
-    0x93, 0x2A, 0x9C, 0xC5, 0xF3, 0x18, 0xBC, 0x88, 0x76, 0x1A, 0xED, 0x14, 0x1A, 0x62, 0x25, 0xB7,
-    0xD0, 0xB8, 0xD6, 0x21, 0x5B, 0xAD, 0x48, 0x88, 0x66, 0x1A, 0xB4, 0x5A, 0x04, 0x89, 0x92, 0x03,
-    0x6E, 0x40, 0xA8, 0x86, 0x89, 0xFB, 0xF2, 0x22, 0x33, 0x21, 0xE9, 0xFF, 0xDB, 0x1E, 0xA3, 0xD9,
-    0x02, 0x0D, 0x90, 0xD8, 0xBE, 0xFD, 0x20, 0xDA, 0x1E, 0xB4, 0xA7, 0xBC, 0x63, 0x87, 0xC5, 0x6F,
-    0x57, 0x79, 0x15, 0xA0, 0x42, 0xD5, 0xA0, 0x5B, 0x68, 0x42, 0x75, 0xAA, 0x12, 0xF9, 0x46, 0xBC,
-    0x15, 0x79, 0xD7, 0xE1, 0x9C, 0xC8, 0x9F, 0x75, 0x7F, 0x5D, 0xF2, 0x86, 0xD4, 0xB1, 0xFF, 0x54,
-    0xF5, 0xE8, 0x86, 0x24, 0xD8, 0xC2, 0x7D, 0x12, 0x5C, 0xEA, 0xE7, 0xAA, 0xE8, 0xA1, 0x9E, 0x88,
-    0x47, 0xD8, 0xA6, 0x2A, 0xA2, 0xAA, 0xBD, 0x14, 0x78, 0x79, 0x13, 0x45, 0x88, 0x8C, 0xC4, 0xCE,
-    0x35, 0x02, 0x20, 0x15, 0x21, 0x58, 0x25, 0xC0, 0x5B, 0x27, 0x13, 0xE8, 0x26, 0x08, 0x69, 0x64,
-    0xA0, 0x91, 0x96, 0x60, 0x2C, 0x20, 0x34, 0x0B, 0xD0, 0xE9, 0x08, 0xCA, 0x1A, 0x42, 0x8E, 0x42,
-    0x43, 0x42, 0x81, 0x0F, 0xC0, 0x22, 0xD8, 0x0B, 0x0B, 0x99, 0x4A, 0xD6, 0x25, 0xCE, 0xBA, 0xB3,
-    0x8F, 0x84, 0x5E, 0x48, 0xD4, 0xCC, 0x92, 0xDF, 0xA6, 0x93, 0x7A, 0xF3, 0x2B, 0x19, 0x27, 0x25,
-    0x6E, 0x65, 0x96, 0x34, 0x84, 0xD9, 0xBD, 0xA9, 0xA4, 0x8D, 0xC1, 0x9A, 0x21, 0x1A, 0x32, 0xBB,
-    0xD1, 0x2E, 0x21, 0xFD, 0x23, 0x09, 0xDE, 0x23, 0xD9, 0x56, 0x9E, 0x06, 0x4F, 0x64, 0xCF, 0x1E,
-    0xD2, 0x64, 0xDF, 0xA7, 0xA0, 0x99, 0xBC, 0xFA, 0x3E, 0x63, 0x7A, 0xE2, 0x43, 0x90, 0x07, 0x90,
-    0x89, 0x71, 0xC0, 0xA4, 0xD0, 0x10, 0xE8, 0xA9, 0x49, 0xAD, 0x79, 0x60, 0x7C, 0x20, 0x41, 0xB8,
-    0x79, 0x80, 0x7C, 0x40, 0x25, 0xF2, 0x8B, 0xE7, 0xDF, 0x42, 0x0E, 0x4F, 0xAF, 0xAE, 0x9E, 0x17,
-    0x19, 0x5E, 0x79, 0xFB, 0x0B, 0x31, 0xED, 0xF1, 0x1F, 0x8F, 0x23, 0xDC, 0xAF, 0x7F, 0xD6, 0x48,
-    0x9A, 0x1F, 0x43, 0xE8, 0x56, 0xBD, 0x2F, 0xFF, 0xC2, 0xA6, 0x27, 0xC6, 0x3E, 0x02, 0x94, 0x9B,
-    0x7C, 0xB7, 0x0C, 0x41, 0x6F, 0xDA, 0xAB, 0xF8, 0x74, 0x29, 0x12, 0x3A, 0x58, 0xB8, 0x7D, 0xCA,
-    0x54, 0x71, 0x91, 0x84, 0xB5, 0x29, 0xE2, 0x45, 0xF9, 0xB9, 0x91, 0x85, 0xAD, 0x2D, 0x6E, 0x99,
-    0xEA, 0x90, 0x0E, 0xF7, 0x63, 0xC2, 0xB4, 0x69, 0xD8, 0xD9, 0xBC, 0x8F, 0x2B, 0x4C, 0xAF, 0x05,
-    0xF5, 0xA1, 0x85, 0xE2, 0x22, 0x96, 0xDD, 0xA6, 0xB5, 0x95, 0xAD, 0x6E, 0x05, 0x1D, 0x3A, 0x79,
-    0x26, 0x9F, 0x84, 0x6D, 0x54, 0xD9, 0x62, 0x4D, 0xBA, 0xA0, 0x8D, 0xF3, 0xFD, 0xF2, 0xDA, 0x28,
-    0x0B, 0x0B, 0x69, 0x21, 0x0F, 0xEB, 0xF8, 0x6E, 0x97, 0xE5, 0x4A, 0xDF, 0xBD, 0x40, 0x66, 0xD8,
-    0x05, 0x83, 0xDC, 0x46, 0x72, 0x90, 0x98, 0xAC, 0x0A, 0x90, 0xA0, 0x0E, 0x03, 0x44, 0x71, 0x17,
-    0x23, 0x45, 0xE4, 0x61, 0x3D, 0xEC, 0x24, 0x6A, 0xC5, 0x56, 0x32, 0x93, 0xD4, 0x17, 0x09, 0xF4,
-    0xD7, 0x25, 0x98, 0x93, 0xBB, 0x52, 0x58, 0xC1, 0x44, 0x7B, 0x24, 0x67, 0x56, 0xC4, 0x0C, 0xE4,
-    0x37, 0x48, 0x1D, 0xCE, 0x4A, 0x26, 0xC1, 0x15, 0x00, 0x14, 0x3B, 0x69, 0x27, 0x81, 0x56, 0x5A,
-    0xE3, 0x24, 0xF4, 0x25, 0xB7, 0xAC, 0x8D, 0xEF, 0xD8, 0x21, 0x72, 0xAA, 0xCF, 0xB8, 0x0B, 0x6E,
-    0x0C, 0xBD, 0xF3, 0x9D, 0xE4, 0x67, 0x37, 0x53, 0x16, 0xD8, 0x3F, 0xD8, 0x49, 0x2B, 0x89, 0xFA,
-    0x0C, 0x1D, 0x0B, 0x53, 0xB3, 0x84, 0x96, 0x41, 0x07, 0x77, 0x19, 0x98, 0xD6, 0xDA, 0x95, 0x01,
-    0xC0, 0xF3, 0xFD, 0xEA, 0x9B, 0x94, 0xBD, 0xEB, 0x3C, 0xF8, 0xFB, 0x44, 0x55, 0x06, 0xAE, 0x33,
-    0xAE, 0xD6, 0x4E, 0x2B, 0x13, 0x8A, 0x87, 0xE8, 0x58, 0x3A, 0x69, 0xA0, 0x66, 0x05, 0x03, 0x89,
-    0xD0, 0x89, 0xE9, 0x41, 0x0C, 0x49, 0xA0, 0xBE, 0xF6, 0x31, 0x9F, 0x2E, 0x88, 0x34, 0xCF, 0xD9,
-    0xEA, 0xD8, 0x09, 0xAE, 0x2B, 0x71, 0x49, 0xD9, 0x41, 0xA9, 0x48, 0x12, 0x66, 0x9E, 0x99, 0xB7,
-    0x35, 0x4E, 0x08, 0x26, 0xB3, 0x60, 0xE0, 0xCC, 0x84, 0xF1, 0x12, 0x84, 0x54, 0x92, 0x5A, 0x42,
-    0xCC, 0x67, 0x85, 0x44, 0x98, 0xBF, 0xBC, 0x80, 0x4D, 0x56, 0xF9, 0x73, 0x15, 0x0C, 0x1B, 0x83,
-    0x54, 0x2E, 0x51, 0xA4, 0x9D, 0x73, 0x9C, 0xBA, 0xA4, 0x84, 0x10, 0xE8, 0x8A, 0x13, 0x3C, 0xF8,
-    0x75, 0x10, 0x6B, 0xBF, 0xA3, 0xFD, 0x02, 0x9E, 0x26, 0x4C, 0x75, 0x0A, 0x7E, 0x4A, 0x46, 0xDB,
-    0x93, 0x10, 0x0A, 0xEF, 0x18, 0xEC, 0x9B, 0x22, 0x76, 0x32, 0xA4, 0x74, 0xC9, 0xF1, 0xF0, 0x53,
-    0x1E, 0x5C, 0x0F, 0xCD, 0x0A, 0x48, 0xF4, 0x5A, 0x2A, 0xB6, 0x34, 0x91, 0x90, 0xD3, 0x69, 0xED,
-    0x5D, 0x52, 0x47, 0x97, 0x9E, 0x80, 0xB2, 0x46, 0x5F, 0x8C, 0x4C, 0x3C, 0xD5, 0x54, 0x72, 0x17,
-    0x5F, 0x29, 0x5F, 0xAB, 0x17, 0x39, 0x44, 0x0D, 0xC1, 0xA5, 0xB5, 0xE1, 0x7C, 0x4E, 0x4F, 0xCA,
-    0xCA, 0x1B, 0x62, 0x36, 0x9A, 0x08, 0x37, 0x59, 0xC3, 0x00, 0xBF, 0xC3, 0x20, 0x06, 0x85, 0xA2,
-    0x1A, 0x9D, 0x7B, 0x17, 0xF0, 0xFA, 0x9B, 0x05, 0x33, 0xE1, 0xDC, 0x04, 0xCE, 0x44, 0x3F, 0x81,
-    0xFF, 0x81, 0x96, 0xB3, 0x83, 0xC0, 0xDE, 0x3E, 0xE2, 0xF3, 0xE4, 0x73, 0xE7, 0x9E, 0x39, 0x7A,
-    0xFC, 0xCF, 0xDF, 0xD7, 0xE3, 0x6F, 0xF3, 0xCB, 0x79, 0xD0, 0x03, 0x4E, 0xF1, 0x83, 0x0B, 0x5F,
-    0xF5, 0x57, 0xEE, 0x7D, 0x7F, 0xF8, 0x59, 0xA9, 0x60, 0x26, 0x58, 0x78, 0x7B, 0x45, 0xDF, 0x5A,
-    0x9F, 0x8C, 0xC2, 0xC2, 0xEA, 0xC4, 0x29, 0x7D, 0xAF, 0x6B, 0x6E, 0x7D, 0xF1, 0xD2, 0x1D, 0xBE,
-    0xA8, 0xAC, 0xC9, 0xBC, 0x8A, 0x3F, 0x49, 0x51, 0x49, 0x14, 0x08, 0x5A, 0xAD, 0xF5, 0x82, 0x11,
-    0xA3, 0x8B, 0x5A, 0xC3, 0x51, 0x54, 0xF8, 0x7E, 0x7E, 0xDB, 0x9D, 0xBE, 0x82, 0xCC, 0xAD, 0xB8,
-    0xEB, 0xC0, 0xA1, 0xC3, 0x3D, 0x88, 0x0C, 0xA4, 0x8F, 0x5D, 0x93, 0x3C, 0x46, 0x07, 0x57, 0x62,
-    0x85, 0x1A, 0x59, 0x87, 0xB9, 0x64, 0x67, 0x0A, 0x1F, 0x75, 0x06, 0xF7, 0xCE, 0x98, 0x74, 0xA6,
-    0x52, 0xB9, 0x67, 0x69, 0x7B, 0x22, 0x0A, 0x35, 0x31, 0xFD, 0xB8, 0x92, 0x54, 0xBE, 0xE9, 0x1E,
-    0xCD, 0x67, 0xE3, 0x1B, 0x99, 0x1A, 0x30, 0x07, 0x69, 0xEB, 0x1B, 0x69, 0x77, 0x60, 0xE6, 0xA9,
-    0x10, 0x00, 0xF3, 0x9A, 0xC3, 0x88, 0x89, 0xCB, 0xEA, 0x31, 0xEF, 0x6E, 0x6C, 0x51, 0x3F, 0xAE,
-    0x70, 0x36, 0x6D, 0x96, 0x56, 0x68, 0x37, 0x78, 0x53, 0x76, 0x78, 0x82, 0x6E, 0x5E, 0x27, 0x20,
-    0x1F, 0x31, 0x20, 0x65, 0xEE, 0x41, 0x44, 0xC0, 0x28, 0x7C, 0x70, 0xEB, 0x7B, 0xB8, 0x29, 0x69,
-    0xEB, 0xA5, 0xCD, 0xAB, 0xAA, 0x92, 0xF0, 0x66, 0x84, 0x06, 0xCA, 0x9F, 0x71, 0x85, 0xCD, 0x4F,
-    0x82, 0x3C, 0x7A, 0xAF, 0x0E, 0x1A, 0xE2, 0x2C, 0x57, 0xB0, 0x56, 0xCC, 0x48, 0xD4, 0xFA, 0x38,
-    0x30, 0x53, 0xC1, 0x10, 0x53, 0xDB, 0x4C, 0x85, 0x1C, 0x59, 0x29, 0x25, 0x03, 0x88, 0xF3, 0x67,
-    0xA0, 0xA7, 0x16, 0xB2, 0xD8, 0x91, 0x88, 0x80, 0x3C, 0x8E, 0x40, 0x8F, 0xA6, 0x7A, 0xA0, 0x12,
-    0x8E, 0x14, 0xC4, 0x3B, 0x4E, 0x0A, 0xC7, 0xC1, 0x03, 0x54, 0x46, 0x54, 0xF6, 0x00, 0x26, 0xF2,
-    0xAD, 0x07, 0x84, 0x1C, 0xAC, 0xB0, 0xEC, 0x75, 0x92, 0x74, 0xE4, 0xB2, 0x55, 0x1D, 0x8C, 0x6B,
-    0x59, 0x85, 0x63, 0x09, 0x5A, 0x3C, 0xBB, 0x7C, 0x94, 0x12, 0xFF, 0x87, 0xA7, 0x37, 0x31, 0x43,
-    0xA1, 0xE5, 0x30, 0x38, 0xE4, 0x03, 0xD9, 0xFA, 0xDC, 0x9D, 0x16, 0xAD, 0x18, 0x44, 0x1E, 0x59,
-    0xF0, 0xB1, 0x4F, 0x3C, 0x73, 0x9E, 0x79, 0x84, 0xC5, 0x8D, 0x82, 0x4E, 0x85, 0x58, 0x6B, 0x72,
-    0x5D, 0x61, 0xA0, 0xB1, 0xA2, 0x89, 0x9A, 0xB2, 0xD4, 0x72, 0x8F, 0x12, 0x1B, 0xBE, 0xA9, 0xB9,
-    0xAC, 0x48, 0x7C, 0xED, 0xF0, 0xD5, 0xAC, 0xF4, 0xC4, 0xB6, 0x8D, 0xD1, 0xC2, 0x39, 0xE5, 0x91,
-    0x58, 0x66, 0x63, 0x46, 0x15, 0x73, 0x97, 0x38, 0xFB, 0x42, 0xB1, 0x2D, 0xB1, 0x5A, 0xF7, 0x81,
-    0xCF, 0xC1, 0x73, 0x3F, 0xF3, 0xFF, 0x92, 0xFA, 0xD3, 0xC6, 0x1B, 0xB3, 0x60, 0x59, 0xF1, 0x67,
-    0xCF, 0x86, 0x1D, 0x70, 0x11, 0x7A, 0x7D, 0x91, 0x17, 0xF1, 0xEC, 0x1A, 0xD9, 0x34, 0x32, 0x6E,
-    0x64, 0xD8, 0x9C, 0xA2, 0xFE, 0x1F, 0x6A, 0x4E, 0x5B, 0xCF, 0xC4, 0xB0, 0xF7, 0xFB, 0xA7, 0xFA,
-    0xF7, 0x23, 0xE5, 0x99, 0xD6, 0x57, 0x4E, 0x8D, 0x6D, 0xD2, 0xEE, 0xB8, 0xDF, 0xB3, 0x74, 0xBC,
-    0xB6, 0x46, 0xE6, 0xFA, 0xBF, 0xA7, 0xB1, 0xA4, 0xCE, 0xD9, 0xBB, 0xB0, 0x7F, 0x75, 0x2C, 0xC8,
-    0xE3, 0xFE, 0x73, 0x2A, 0x64, 0x37, 0xF4, 0x54, 0xF1, 0x2F, 0x33, 0xCF, 0x74, 0xBD, 0xE0, 0xC2,
-    0x2E, 0x53, 0x7D, 0xE3, 0x81, 0x87, 0x9D, 0xF6, 0xA7, 0xC5, 0xB2, 0xFD, 0x78, 0xB4, 0xEF, 0x0D,
-    0x1B, 0x7F, 0xF0, 0x60, 0xDC, 0x38, 0xDE, 0x35, 0xFE, 0xD7, 0x46, 0x4E, 0x6C, 0x0D, 0xE0, 0x3F,
-    0x6D, 0x52, 0xB1, 0x6E, 0x13, 0x41, 0x14, 0x9C, 0xDB, 0x95, 0x58, 0xA1, 0x8B, 0xBD, 0x69, 0x22,
-    0x21, 0x74, 0xC9, 0xB5, 0x29, 0x8C, 0x8F, 0xE2, 0x0A, 0x17, 0x4E, 0xEE, 0x2C, 0x0A, 0x5A, 0xBE,
-    0x00, 0xF1, 0x03, 0x48, 0x46, 0xBA, 0x06, 0x09, 0xE4, 0x4D, 0xF2, 0x03, 0x54, 0x54, 0x14, 0xE6,
-    0x0B, 0x70, 0xE1, 0x02, 0x24, 0x27, 0x7E, 0x9F, 0x70, 0x12, 0x05, 0xED, 0x51, 0x90, 0x0A, 0xC4,
-    0x16, 0x29, 0x0E, 0xE9, 0xEC, 0xE5, 0xAD, 0x7D, 0x41, 0x16, 0xCA, 0x4A, 0xD3, 0xBC, 0x37, 0x6F,
-    0xDE, 0xEC, 0xEC, 0xE2, 0x00, 0x9D, 0x48, 0xE6, 0xF4, 0x6A, 0xAF, 0x9B, 0xD2, 0xD7, 0xDE, 0xA1,
-    0x3C, 0x2B, 0x67, 0xF1, 0x15, 0x1C, 0xA9, 0x0A, 0x7C, 0x3A, 0x18, 0xE2, 0xA7, 0xFC, 0xD0, 0x1D,
-    0x0C, 0x5F, 0x4F, 0xD6, 0xB0, 0xB0, 0x81, 0x2F, 0xEB, 0xB5, 0x30, 0x48, 0x21, 0x81, 0x49, 0x19,
-    0xA8, 0x1C, 0x03, 0xA8, 0xD1, 0x7B, 0x9B, 0xAD, 0xC4, 0x9A, 0x2B, 0x34, 0xC7, 0x14, 0x8F, 0xD1,
-    0x6F, 0xF4, 0x93, 0x0B, 0xF3, 0x91, 0x06, 0x45, 0x4F, 0xAF, 0xF0, 0x85, 0xA7, 0x58, 0x20, 0x62,
-    0xB9, 0xC2, 0x8B, 0x48, 0x52, 0x46, 0xE7, 0x09, 0x4E, 0xFC, 0x92, 0x87, 0x79, 0xF7, 0xBE, 0x30,
-    0xD3, 0xB4, 0x23, 0xBE, 0x19, 0x5D, 0x85, 0x4F, 0x47, 0x34, 0xEC, 0xC9, 0xF3, 0x6B, 0x1B, 0xD6,
-    0xC0, 0x25, 0x8A, 0xA2, 0x23, 0xCF, 0x68, 0x70, 0x2C, 0xCF, 0x69, 0xAE, 0x1D, 0x0E, 0xA6, 0x38,
-    0x54, 0xCE, 0x2C, 0x4B, 0x1E, 0x0C, 0x9E, 0x21, 0xB8, 0x76, 0x15, 0x32, 0xE7, 0x8C, 0x74, 0xA3,
-    0x06, 0x13, 0x13, 0x92, 0xAE, 0xB0, 0x40, 0x03, 0x4D, 0x31, 0xA1, 0x91, 0x37, 0x88, 0x29, 0xCB,
-    0x45, 0xAD, 0x2C, 0xB2, 0xDC, 0x41, 0x59, 0x6E, 0x2F, 0xC5, 0x0A, 0xDA, 0x66, 0x84, 0xB5, 0x6C,
-    0x10, 0x97, 0x4B, 0x23, 0x57, 0xC0, 0xBD, 0x1A, 0xD2, 0x4C, 0x61, 0x15, 0x7A, 0x18, 0xCB, 0x0B,
-    0x95, 0xCF, 0x67, 0x33, 0xAD, 0x35, 0xEC, 0xF7, 0x2A, 0xC6, 0x89, 0xB0, 0x8A, 0x92, 0xA0, 0x16,
-    0x6B, 0x87, 0xD8, 0x95, 0x70, 0x35, 0xC4, 0x1F, 0x6F, 0x1D, 0x7D, 0xFC, 0xE2, 0x5B, 0x0D, 0x38,
-    0x8D, 0x31, 0x66, 0xA8, 0x82, 0x32, 0x59, 0x67, 0xAC, 0x06, 0xE9, 0xF0, 0x40, 0x83, 0xB5, 0x50,
-    0x21, 0xCC, 0xF1, 0x19, 0xDA, 0x88, 0x9A, 0x2D, 0x08, 0x67, 0xB5, 0x23, 0x0E, 0x6A, 0xFF, 0x18,
-    0x01, 0xA1, 0xE0, 0xD5, 0x41, 0x09, 0x66, 0x56, 0xFB, 0x2F, 0xDB, 0x6B, 0x09, 0x48, 0x12, 0x95,
-    0x48, 0x45, 0x24, 0x42, 0xE1, 0xCA, 0x4F, 0x0D, 0x47, 0xF6, 0xC8, 0x53, 0x00, 0x57, 0xBE, 0xE0,
-    0x4D, 0x7B, 0x50, 0x9B, 0xA9, 0x62, 0xFF, 0x4D, 0xBC, 0x0A, 0x57, 0x1B, 0x1F, 0x50, 0x8D, 0x28,
-    0xD9, 0x43, 0x07, 0xC1, 0xEF, 0xB2, 0x1F, 0x4A, 0x1A, 0xA7, 0x4A, 0x9E, 0x55, 0x49, 0xC3, 0x09,
-    0x6E, 0xA2, 0x3F, 0x64, 0x2F, 0xB7, 0xD1, 0x53, 0x1B, 0x7D, 0xFF, 0x9D, 0x34, 0x14, 0x29, 0x8C,
-    0x0B, 0x2C, 0xF3, 0xF0, 0x39, 0x6C, 0xA4, 0xF2, 0xD9, 0x91, 0x32, 0x59, 0x8D, 0x03, 0x9E, 0xBA,
-    0x42, 0x3A, 0xEC, 0x0A, 0xA2, 0x5E, 0x24, 0xE9, 0x47, 0xAD, 0x5C, 0xCE, 0xFA, 0x47, 0xD2, 0xD1,
-    0xA4, 0x42, 0x7B, 0xB4, 0x01, 0x42, 0xE2, 0xE5, 0x6C, 0xDB, 0x7F, 0x18, 0x69, 0xD9, 0x3E, 0x23,
-    0xB8, 0xE1, 0x26, 0xBF, 0x1E, 0xBF, 0x04, 0xF0, 0x96, 0x91, 0x31, 0xE2, 0x9C, 0x07, 0x5A, 0xB2,
-    0x27, 0xFE, 0x23, 0x64, 0xAD, 0x92, 0x6F, 0xF8, 0x69, 0x7E, 0x3D, 0xE0, 0x74, 0xA7, 0xB8, 0x91,
-    0xF3, 0x32, 0x09, 0xB6, 0xFB, 0x84, 0x2F, 0x5C, 0xB6, 0x9A, 0x1B, 0x86, 0xD7, 0x9A, 0x60, 0xBB,
-    0x60, 0x23, 0xEE, 0x63, 0x49, 0xCC, 0xD6, 0xE6, 0x69, 0xCB, 0x0C, 0x69, 0x67, 0xF3, 0xAD, 0xDE,
-    0x9D, 0x96, 0x4E, 0x6F, 0x9B, 0x66, 0x4B, 0x08, 0x3D, 0xE1, 0xAE, 0x0B, 0x36, 0x2D, 0x16, 0x3B,
-    0xB8, 0xFC, 0x0F, 0x8B, 0x1D, 0x1E, 0x23, 0x68, 0xC1, 0xFF, 0x01, 0xF2, 0xE6, 0x2F, 0x75, 0x56,
-    0x31, 0x6F, 0xDD, 0x54, 0x14, 0x3E, 0xF6, 0x6D, 0x6A, 0xA9, 0x96, 0x70, 0x07, 0x40, 0x88, 0x4A,
-    0xF5, 0xC2, 0x40, 0x87, 0xC4, 0x7F, 0xA0, 0x89, 0x5D, 0x31, 0xB0, 0x76, 0x68, 0x3A, 0xB0, 0xC0,
-    0xC0, 0x4C, 0xD7, 0x0E, 0x69, 0xDF, 0xEB, 0x2F, 0x20, 0x88, 0x76, 0x62, 0xE9, 0x52, 0x09, 0x85,
-    0x21, 0x4B, 0x87, 0x08, 0xBD, 0xC4, 0x86, 0x8E, 0x1D, 0xB0, 0x8A, 0xC4, 0xC2, 0x80, 0x25, 0x82,
-    0x80, 0x0C, 0x70, 0x55, 0xB9, 0xC8, 0x69, 0xFD, 0x7C, 0xF9, 0xBE, 0x73, 0xFD, 0x5E, 0xD2, 0x16,
-    0xAC, 0xBE, 0x7B, 0x53, 0xFB, 0xDE, 0x73, 0xCF, 0xF9, 0xCE, 0x77, 0xBE, 0x7B, 0x44, 0x44, 0x82,
-    0xFB, 0x97, 0x30, 0x8A, 0xA9, 0x6F, 0x71, 0x8A, 0xAB, 0x8E, 0x53, 0x72, 0xC5, 0x72, 0xCA, 0x4C,
-    0xC3, 0x69, 0x3D, 0xAA, 0x38, 0x39, 0x57, 0x63, 0x8C, 0x9C, 0xE3, 0xCB, 0x89, 0x73, 0x78, 0x19,
-    0xBA, 0xC3, 0x83, 0x29, 0x96, 0xBB, 0x69, 0x8B, 0x77, 0xB9, 0x0B, 0xB9, 0xCD, 0x0D, 0x06, 0x0B,
-    0xC3, 0x61, 0x16, 0x63, 0x45, 0xD4, 0xB7, 0x49, 0x81, 0x15, 0x4F, 0x6D, 0x8E, 0x4F, 0xE9, 0xAF,
-    0xF5, 0x16, 0x17, 0x3E, 0xD6, 0x63, 0xF2, 0xCF, 0xF5, 0x98, 0x72, 0xA2, 0xC7, 0xB8, 0x7D, 0x3D,
-    0xC6, 0x75, 0x09, 0x2C, 0x06, 0xCE, 0x66, 0xA2, 0xD3, 0xBA, 0x14, 0x98, 0x86, 0xF9, 0x8D, 0x0A,
-    0x13, 0x9E, 0x29, 0x1D, 0x71, 0x0E, 0x36, 0x4B, 0x4C, 0xB2, 0x9C, 0x30, 0x0E, 0x38, 0xF5, 0xA9,
-    0x73, 0x87, 0x8C, 0x66, 0xEB, 0x7F, 0xA3, 0xB9, 0xE5, 0xA3, 0xD9, 0x8B, 0xA7, 0xF2, 0xD2, 0x73,
-    0xC1, 0x6D, 0xF3, 0x40, 0xD7, 0x69, 0x8C, 0x3D, 0x76, 0xBB, 0x7B, 0x1F, 0x61, 0xF3, 0xA0, 0x26,
-    0xE6, 0x3A, 0xF6, 0x6A, 0x55, 0x47, 0xE3, 0x47, 0x7D, 0x1F, 0xE8, 0x1A, 0x71, 0x12, 0x5C, 0x29,
-    0x24, 0x9F, 0xCA, 0x8B, 0x56, 0xB2, 0x5A, 0x26, 0xBD, 0x24, 0x2D, 0xFF, 0x8B, 0x45, 0x88, 0x29,
-    0x70, 0x15, 0x4F, 0x9E, 0xF4, 0xC6, 0x9E, 0x97, 0xD4, 0x1D, 0x0F, 0x3D, 0xCF, 0xA1, 0xD3, 0x3E,
-    0x9E, 0xDC, 0x11, 0x52, 0x83, 0xD1, 0x2A, 0xBC, 0x1D, 0xE1, 0x75, 0x7F, 0xC8, 0xAB, 0xCF, 0x5B,
-    0x05, 0x81, 0x64, 0x12, 0x22, 0x5D, 0x5A, 0x1E, 0x46, 0x8D, 0x98, 0x4E, 0x42, 0xE1, 0x29, 0x78,
-    0x34, 0xF4, 0x40, 0x43, 0x5E, 0x24, 0x0E, 0xA8, 0x61, 0x31, 0x7C, 0xCD, 0x74, 0x0B, 0xF3, 0x83,
-    0xD5, 0x34, 0x74, 0xAE, 0xDC, 0xF9, 0x5A, 0x8F, 0x6B, 0x78, 0x1A, 0x81, 0x4C, 0x75, 0xCF, 0x81,
-    0x6E, 0x67, 0x56, 0xA5, 0xA4, 0xD5, 0x8C, 0x48, 0x26, 0x43, 0xA1, 0x69, 0x76, 0x7F, 0xFA, 0x5C,
-    0x00, 0x22, 0x0D, 0xC0, 0x3F, 0x13, 0x26, 0x1D, 0x8B, 0x70, 0x40, 0x8E, 0x1F, 0xFE, 0x34, 0xB0,
-    0x97, 0xC1, 0x5C, 0xD9, 0x2A, 0x5C, 0xA0, 0x09, 0xE1, 0x08, 0x00, 0x6E, 0x6C, 0xE9, 0x4B, 0x05,
-    0xC8, 0xB0, 0xA8, 0x97, 0x14, 0xD1, 0x4C, 0x76, 0xEB, 0x10, 0x1E, 0xC6, 0xCF, 0x06, 0xC9, 0xB1,
-    0xC7, 0x25, 0x36, 0xC2, 0x99, 0xA9, 0x75, 0x52, 0x16, 0x0A, 0x11, 0x20, 0xC9, 0xFC, 0x1C, 0xEE,
-    0x0E, 0xDF, 0x0C, 0xE5, 0xD1, 0xB6, 0xB8, 0x2A, 0x7F, 0x44, 0xC3, 0x9D, 0xE9, 0x27, 0x34, 0x5C,
-    0xE4, 0x3F, 0xB4, 0x3C, 0x3D, 0x1C, 0xD4, 0x30, 0x60, 0x22, 0x96, 0x8D, 0x30, 0x74, 0xA4, 0x30,
-    0x21, 0x67, 0xF1, 0x2B, 0xB1, 0x27, 0x83, 0x13, 0x64, 0x11, 0xE1, 0x39, 0xF4, 0x51, 0xE1, 0x63,
-    0x7A, 0xA4, 0x99, 0xAF, 0x79, 0xA6, 0xB1, 0x12, 0x37, 0x12, 0xF4, 0x12, 0x74, 0x4A, 0x32, 0xD7,
-    0x4C, 0x9C, 0x66, 0x07, 0x08, 0x21, 0x2A, 0x84, 0x30, 0xA9, 0x35, 0x5F, 0x8D, 0x42, 0xDC, 0x28,
-    0x15, 0xC1, 0xA1, 0xFC, 0xF9, 0x03, 0x62, 0xA5, 0x64, 0x8B, 0xDB, 0x13, 0x96, 0x30, 0x58, 0xC2,
-    0xA9, 0xF8, 0xE6, 0xFA, 0x39, 0x69, 0x4F, 0x11, 0xCA, 0x7F, 0x76, 0xFA, 0xB9, 0x6C, 0x3C, 0xA6,
-    0xC6, 0xF9, 0x3F, 0x02, 0xE7, 0x7D, 0x95, 0x6F, 0x77, 0x35, 0xB1, 0x72, 0x59, 0xB4, 0x5E, 0xE5,
-    0x0D, 0x9F, 0x46, 0x89, 0x0A, 0x9F, 0xD4, 0xB0, 0x12, 0xB5, 0x29, 0x56, 0x66, 0xE2, 0xD9, 0x50,
-    0xE2, 0x84, 0x63, 0x59, 0xBB, 0x0E, 0x0B, 0xA9, 0x9B, 0x26, 0x24, 0x43, 0xF2, 0x45, 0x61, 0x68,
-    0x31, 0x56, 0xCB, 0x60, 0x28, 0x93, 0x44, 0xC6, 0x11, 0xBD, 0xED, 0x09, 0x07, 0x49, 0x2A, 0xD4,
-    0x6F, 0xE4, 0x8A, 0xC8, 0xB2, 0xAA, 0xB3, 0x36, 0xEC, 0x65, 0xAE, 0x59, 0x46, 0x7E, 0x58, 0xD1,
-    0x55, 0x5E, 0xA4, 0xB5, 0x5C, 0x8A, 0x6C, 0x5A, 0x23, 0xCA, 0x14, 0x75, 0x6B, 0x11, 0x67, 0xEA,
-    0x7A, 0xA4, 0xDA, 0x15, 0xB1, 0x9B, 0xA3, 0x2A, 0x00, 0xD0, 0xE4, 0x98, 0xCE, 0xF2, 0xC7, 0x71,
-    0xA6, 0x63, 0xAB, 0xA3, 0xE5, 0x08, 0xDB, 0xE0, 0x2B, 0x2A, 0x73, 0x4B, 0xAE, 0xC2, 0x8B, 0xAD,
-    0xC0, 0xC6, 0x55, 0x42, 0x98, 0xFB, 0xF4, 0x24, 0xE3, 0x58, 0x93, 0xB6, 0x1B, 0xD8, 0x9D, 0x77,
-    0xEB, 0x18, 0x6F, 0x77, 0x08, 0x6D, 0xD6, 0xF7, 0xF0, 0x77, 0xBF, 0xEB, 0x5B, 0xF2, 0xEB, 0x80,
-    0x85, 0x60, 0x89, 0x5A, 0x59, 0x97, 0x35, 0x41, 0x26, 0xCC, 0x6E, 0x3A, 0xE1, 0x28, 0x93, 0x42,
-    0x47, 0x9C, 0x39, 0xD7, 0x71, 0x7C, 0x0E, 0xEE, 0x79, 0x88, 0x15, 0x63, 0x1C, 0x8A, 0x62, 0xC5,
-    0xF6, 0x1B, 0x56, 0x3A, 0x94, 0x53, 0x5C, 0x47, 0x75, 0x52, 0xA1, 0xA4, 0x32, 0xB9, 0x2D, 0xB2,
-    0x21, 0x5D, 0x88, 0x83, 0x5A, 0xBE, 0x7B, 0xCF, 0xD4, 0x99, 0x6C, 0x04, 0x36, 0x95, 0x3E, 0x68,
-    0xE3, 0x6A, 0x66, 0x9A, 0xB8, 0xDA, 0x30, 0x4D, 0x5A, 0xE4, 0x02, 0xAD, 0x9B, 0x49, 0x17, 0x55,
-    0xEF, 0x18, 0x1B, 0xD5, 0x29, 0xE8, 0x84, 0xDD, 0xF0, 0x75, 0x1F, 0xBB, 0xAD, 0xF0, 0x1D, 0x4A,
-    0x35, 0xAB, 0x32, 0x49, 0x8E, 0xA3, 0x41, 0x40, 0x7B, 0xAD, 0x46, 0x56, 0x91, 0x26, 0xFD, 0xFA,
-    0xC1, 0xA9, 0x32, 0x4F, 0x96, 0x55, 0xFC, 0xD6, 0x67, 0xD7, 0xD4, 0x4B, 0x8A, 0x07, 0xD9, 0x29,
-    0x54, 0xAE, 0xB8, 0x69, 0xB9, 0xF1, 0x17, 0x7C, 0x79, 0xCE, 0xB0, 0xF7, 0x58, 0x3B, 0x6B, 0xA4,
-    0xA6, 0xA9, 0xC0, 0x57, 0xD9, 0x93, 0xAC, 0x00, 0x35, 0xC0, 0x61, 0x78, 0x39, 0x68, 0x78, 0x4A,
-    0xD0, 0x39, 0x4D, 0xBD, 0xA8, 0x48, 0x89, 0xF7, 0x45, 0x56, 0x36, 0x37, 0x37, 0xB5, 0xEE, 0xAD,
-    0xCA, 0xCF, 0xC9, 0xE9, 0xC1, 0x4E, 0xA1, 0xF2, 0x53, 0x8D, 0x8A, 0x98, 0x1F, 0xAE, 0x14, 0x23,
-    0x99, 0x95, 0xCB, 0x19, 0x35, 0xC1, 0xD8, 0x37, 0xC7, 0xBA, 0x89, 0x55, 0x30, 0x45, 0x79, 0xAC,
-    0x22, 0xC4, 0x1A, 0xA7, 0xD8, 0xD4, 0x60, 0xD0, 0x33, 0xE5, 0xBB, 0x92, 0xD4, 0x8E, 0x3A, 0xB1,
-    0x28, 0x8C, 0xF2, 0xE4, 0x46, 0xC9, 0x29, 0x24, 0x81, 0xDE, 0x31, 0x41, 0xD9, 0x2F, 0x40, 0xD0,
-    0xEC, 0x6B, 0xD9, 0x7D, 0xCF, 0x61, 0x38, 0x77, 0x2F, 0xB6, 0xC1, 0x55, 0xA1, 0x8C, 0x2C, 0x5C,
-    0x89, 0x20, 0xA7, 0x38, 0xEB, 0x67, 0xBD, 0x3C, 0x06, 0x85, 0x73, 0x9B, 0x43, 0xAD, 0x77, 0x03,
-    0xDD, 0xFC, 0xBD, 0xFB, 0x54, 0xE4, 0x4C, 0xE6, 0x96, 0x2B, 0x32, 0x16, 0x53, 0xA2, 0x69, 0xCF,
-    0x79, 0xA1, 0x04, 0x5F, 0xAA, 0xA5, 0xD4, 0x2E, 0xEB, 0xD3, 0xA8, 0xAA, 0xA5, 0xED, 0xC9, 0x8B,
-    0x11, 0x1C, 0x2F, 0x16, 0xE2, 0xC1, 0x0A, 0x86, 0x5D, 0x1A, 0x35, 0xA0, 0x7F, 0x4D, 0x38, 0x04,
-    0xE9, 0x8D, 0x54, 0xA1, 0xE6, 0xAC, 0x7F, 0xA8, 0x87, 0x24, 0xB5, 0xFE, 0xD3, 0x97, 0xB8, 0x15,
-    0xAA, 0x80, 0x47, 0xE7, 0x5E, 0x35, 0xBD, 0xC8, 0x8F, 0xAA, 0x21, 0xEE, 0xE8, 0xEE, 0xC9, 0x55,
-    0x12, 0x7A, 0xC5, 0x18, 0x85, 0xC3, 0xDF, 0x35, 0xA3, 0x4E, 0x40, 0xED, 0xE4, 0x44, 0x3B, 0x24,
-    0xF3, 0x7A, 0x90, 0xBF, 0x34, 0x2D, 0xE4, 0x43, 0x7C, 0xED, 0x8D, 0x6C, 0x92, 0x48, 0x51, 0x0B,
-    0xEB, 0x51, 0x20, 0xF0, 0xBC, 0xED, 0x86, 0x42, 0xB5, 0xDC, 0x32, 0xDB, 0x47, 0x3D, 0xE2, 0x7C,
-    0x52, 0x07, 0x18, 0x0B, 0xCB, 0xFC, 0x73, 0x37, 0x3C, 0xBE, 0xA8, 0xB7, 0x40, 0x4C, 0xCF, 0x2B,
-    0x4A, 0x45, 0xD6, 0x70, 0x37, 0x1C, 0xD8, 0x52, 0xDF, 0xD6, 0xD4, 0xED, 0xF8, 0x37, 0x2C, 0xA2,
-    0xAC, 0x34, 0x79, 0x0D, 0x7C, 0x7A, 0xDC, 0x03, 0x37, 0x2F, 0x38, 0x7C, 0x5E, 0x95, 0xE3, 0xC2,
-    0x15, 0x09, 0xAA, 0x20, 0xB7, 0x06, 0xAA, 0x91, 0xB8, 0x07, 0xFF, 0xB8, 0xCA, 0xF8, 0xC2, 0xA6,
-    0xB0, 0x76, 0x8A, 0xCF, 0xA0, 0x48, 0xCC, 0x99, 0xFE, 0x81, 0x78, 0xC8, 0xC3, 0xD7, 0xFC, 0x0F,
-    0xC7, 0x2B, 0x7B, 0xF3, 0xEE, 0x82, 0x1D, 0xCD, 0x38, 0x77, 0xE3, 0xAC, 0x78, 0x9D, 0x91, 0x74,
-    0xBC, 0x94, 0x82, 0x05, 0xA5, 0x17, 0xF3, 0xE2, 0xB2, 0xF2, 0xB8, 0x4A, 0xD8, 0x2F, 0x48, 0x06,
-    0xBE, 0x66, 0x63, 0x92, 0x72, 0xE7, 0x5D, 0x7B, 0xE5, 0x09, 0xFD, 0xDD, 0xD3, 0xC4, 0x7E, 0xF6,
-    0x2A, 0x05, 0x11, 0xCD, 0x46, 0xDB, 0x9C, 0x57, 0x74, 0x3E, 0xDA, 0x75, 0x3A, 0xFB, 0x36, 0x45,
-    0xD7, 0x55, 0xE2, 0x89, 0x51, 0x8D, 0x0D, 0x0B, 0x53, 0x70, 0xD6, 0xB9, 0xE3, 0xD7, 0x6E, 0xF7,
-    0x8B, 0x3E, 0x70, 0xA2, 0x4C, 0xFD, 0x50, 0x9C, 0xE0, 0xD1, 0xB5, 0x70, 0x7E, 0x53, 0xD2, 0x27,
-    0xB5, 0x1C, 0x24, 0xE0, 0xD9, 0x65, 0x49, 0xEF, 0x34, 0xB2, 0x1F, 0x17, 0xA6, 0xBD, 0x0C, 0x7A,
-    0x35, 0x68, 0xA8, 0x0A, 0x29, 0x87, 0xFB, 0x2C, 0x1F, 0x2D, 0xDA, 0x72, 0xAE, 0xF9, 0x0D, 0x68,
-    0xF1, 0xDD, 0x1D, 0x3C, 0x53, 0xF5, 0xBA, 0x93, 0xFF, 0x78, 0xF8, 0x79, 0x47, 0x54, 0x6D, 0xAD,
-    0x26, 0x65, 0x58, 0xD4, 0x37, 0x89, 0xBD, 0x2C, 0x58, 0xBD, 0xB2, 0x97, 0x08, 0xA6, 0xF5, 0x29,
-    0x5E, 0xFA, 0x62, 0xF4, 0x15, 0x3D, 0x22, 0xED, 0x4B, 0x29, 0xF4, 0x8B, 0x73, 0x5D, 0x1C, 0xF5,
-    0xA7, 0xEE, 0x37, 0x4F, 0xDE, 0xD0, 0x9D, 0x26, 0x2D, 0xE1, 0xD1, 0x46, 0x84, 0x7D, 0xA3, 0xD2,
-    0x73, 0x95, 0x66, 0x0B, 0xD6, 0x49, 0xAD, 0x8D, 0x0B, 0x85, 0xED, 0x6C, 0x8F, 0x6D, 0x98, 0x99,
-    0xA0, 0x1C, 0xF6, 0x57, 0x3E, 0xA6, 0x62, 0x74, 0xA3, 0x9B, 0x6C, 0x5E, 0xD8, 0x80, 0xD0, 0x33,
-    0x4D, 0x3E, 0x8B, 0x37, 0x5F, 0xE6, 0x72, 0x36, 0x2A, 0x51, 0x32, 0xFD, 0x44, 0xA2, 0x9F, 0x68,
-    0x69, 0x8E, 0x5F, 0x8B, 0x1C, 0x15, 0xEC, 0x06, 0xCE, 0x9B, 0xAF, 0xBE, 0xDB, 0x13, 0xF3, 0x02,
-    0x57, 0x3E, 0x52, 0x43, 0x09, 0x49, 0x9C, 0x98, 0x1F, 0xFF, 0xAE, 0x4C, 0xF3, 0x61, 0x13, 0xE3,
-    0x1E, 0x44, 0x58, 0x73, 0x68, 0x16, 0x45, 0x23, 0x7D, 0xB5, 0x33, 0x7B, 0xB8, 0x64, 0xAB, 0x92,
-    0x35, 0xAE, 0x17, 0x42, 0x33, 0xF1, 0x0D, 0x1D, 0x7C, 0xCD, 0xFF, 0x42, 0xDF, 0x90, 0x3D, 0xFE,
-    0xC0, 0x4A, 0xF2, 0xA8, 0x42, 0xFF, 0x51, 0xDB, 0x35, 0x64, 0xF3, 0x26, 0x6E, 0xF0, 0x76, 0x15,
-    0xD7, 0xF7, 0x56, 0x82, 0xAA, 0x5B, 0x33, 0xD5, 0x1E, 0x3B, 0xD6, 0x75, 0x70, 0x60, 0x2F, 0xC1,
-    0x0D, 0xB0, 0x8A, 0x26, 0x6E, 0x96, 0x84, 0x8D, 0x6C, 0x98, 0x0A, 0x9E, 0xDE, 0x69, 0xB6, 0xD0,
-    0xBF, 0x3D, 0x5C, 0x3B, 0xA5, 0x46, 0xC6, 0xAB, 0xAF, 0xEF, 0x5D, 0x40, 0x6D, 0xB6, 0x6D, 0xBE,
-    0x79, 0x21, 0x1E, 0xE9, 0x54, 0x93, 0x76, 0xA0, 0xE9, 0xE4, 0x7D, 0x80, 0x77, 0xDA, 0x60, 0xC9,
-    0x85, 0xB9, 0x4F, 0x7B, 0xA3, 0x94, 0x1C, 0x3C, 0xC3, 0xA7, 0x24, 0xEC, 0x8E, 0xF6, 0x98, 0x5E,
-    0x44, 0xCA, 0x62, 0x24, 0xB3, 0x6F, 0x73, 0x9C, 0x67, 0x72, 0xBF, 0x14, 0xC9, 0x85, 0x10, 0xF9,
-    0xBE, 0x66, 0xD4, 0x49, 0xDF, 0x29, 0x8F, 0x3A, 0xF4, 0x2F, 0x6D, 0x54, 0xB1, 0x6E, 0xDC, 0x46,
-    0x10, 0x9D, 0x25, 0x15, 0xAF, 0x00, 0x46, 0xDE, 0x14, 0x81, 0x61, 0x44, 0x27, 0x31, 0xA5, 0x8B,
-    0x93, 0xD9, 0xA8, 0x50, 0x71, 0x27, 0xD2, 0x31, 0x60, 0xB7, 0x2E, 0xC2, 0xA4, 0x48, 0x93, 0x3F,
-    0x90, 0x0A, 0x15, 0x2E, 0x0E, 0xE6, 0x1A, 0x01, 0x92, 0x32, 0xFE, 0x01, 0x97, 0x01, 0x52, 0xBA,
-    0x50, 0xA1, 0xE2, 0x22, 0xAE, 0xED, 0xD2, 0x0D, 0x9B, 0x54, 0x69, 0x68, 0x59, 0x41, 0x10, 0x04,
-    0x48, 0x18, 0x84, 0x51, 0x78, 0x06, 0x79, 0x9B, 0x37, 0x4B, 0xF1, 0xE4, 0xC2, 0x0B, 0x70, 0x39,
-    0xBB, 0xB3, 0x33, 0xF3, 0xDE, 0xCC, 0xEC, 0x12, 0x25, 0x44, 0xB4, 0x83, 0x4F, 0x1A, 0x4C, 0x15,
-    0xBE, 0xFD, 0xAB, 0xC5, 0x66, 0x39, 0xA5, 0x83, 0x65, 0xF0, 0xAD, 0x5D, 0x08, 0x6B, 0xCF, 0x29,
-    0x5E, 0x26, 0x24, 0x1B, 0x68, 0xC2, 0x02, 0x53, 0x06, 0x4B, 0xD1, 0x41, 0xF0, 0x79, 0x4B, 0xB1,
-    0xC5, 0xA7, 0x34, 0x8C, 0x6D, 0x7C, 0xDE, 0x12, 0x53, 0x8C, 0x29, 0xB0, 0x38, 0xD6, 0x9D, 0x74,
-    0x14, 0x7E, 0x53, 0xB4, 0x5E, 0xAD, 0xA8, 0x8D, 0x69, 0x26, 0xAA, 0xAF, 0xBD, 0x52, 0xC0, 0x90,
-    0x01, 0x4C, 0xF0, 0x09, 0x0E, 0x1E, 0x68, 0x4C, 0x53, 0xBA, 0x84, 0xE2, 0x60, 0xB8, 0x15, 0x7D,
-    0xC4, 0xCB, 0xF7, 0x29, 0x4F, 0x13, 0xAA, 0x02, 0xFB, 0x44, 0x9A, 0x6B, 0x76, 0x71, 0x9B, 0x28,
-    0xB7, 0x35, 0xD1, 0xA6, 0x85, 0xCE, 0x63, 0x6C, 0xB1, 0xEE, 0xD1, 0x4A, 0xEC, 0x7A, 0x2D, 0x6F,
-    0xB0, 0xB9, 0xBE, 0x0C, 0x7B, 0x9B, 0x17, 0xB3, 0xC1, 0xA1, 0x5F, 0x0C, 0x00, 0x42, 0xEA, 0x31,
-    0x7D, 0x4C, 0x35, 0x25, 0x8D, 0x57, 0x06, 0xBA, 0x93, 0x26, 0xA3, 0x53, 0x25, 0x2B, 0xCA, 0xA6,
-    0x70, 0x11, 0x59, 0x18, 0x84, 0x16, 0x3E, 0x54, 0x3D, 0x18, 0xF1, 0xB8, 0xC6, 0xB4, 0x2F, 0xF9,
-    0x28, 0x88, 0xA6, 0x4F, 0x05, 0x67, 0x83, 0xC6, 0x1C, 0xE5, 0x66, 0x02, 0x5D, 0x40, 0x9B, 0xFF,
-    0x2D, 0xE8, 0x21, 0x1D, 0x1D, 0x2C, 0xEF, 0xD9, 0xF3, 0x63, 0xDF, 0x2E, 0x18, 0x72, 0x15, 0x9F,
-    0xF3, 0xB1, 0xBC, 0x6C, 0x9D, 0xAB, 0x50, 0xFF, 0xC4, 0x3F, 0xD1, 0x90, 0xFB, 0x47, 0x9A, 0x4E,
-    0xD9, 0x39, 0xC2, 0x3D, 0xA4, 0x1E, 0x7E, 0x42, 0x57, 0x83, 0xB1, 0x67, 0x06, 0x99, 0x36, 0xE2,
-    0xE2, 0x95, 0x89, 0x94, 0x7A, 0x59, 0xEE, 0xA9, 0xA7, 0xA2, 0x58, 0x47, 0xB0, 0x1E, 0x4E, 0x09,
-    0x98, 0x49, 0x2F, 0x02, 0xBB, 0x84, 0xB8, 0x06, 0x71, 0xAF, 0x5F, 0x32, 0x50, 0xDE, 0xBA, 0xEE,
-    0x0E, 0x0B, 0x3A, 0xA6, 0x6D, 0x51, 0xEE, 0x84, 0x77, 0x9F, 0xD7, 0xEA, 0xFB, 0x30, 0x09, 0xFE,
-    0x6C, 0x48, 0x5A, 0x4D, 0x1E, 0x0A, 0x2D, 0x98, 0xD2, 0x8D, 0x92, 0x3E, 0xB1, 0xAD, 0xB4, 0xCB,
-    0x07, 0x1E, 0xE7, 0x20, 0x07, 0xA8, 0x08, 0xD1, 0xE5, 0x8B, 0x25, 0xAA, 0x18, 0xD4, 0x48, 0x69,
-    0x56, 0x84, 0x24, 0xAC, 0x0F, 0x44, 0x35, 0x94, 0xB7, 0x7A, 0x90, 0xBF, 0x33, 0x70, 0xFB, 0x2B,
-    0xD2, 0x94, 0x73, 0x81, 0x36, 0x41, 0xD4, 0x83, 0x20, 0x96, 0x73, 0x9C, 0xBD, 0x6F, 0x28, 0x4F,
-    0x66, 0x94, 0xEB, 0xC0, 0xC0, 0xD5, 0x3C, 0x2E, 0x28, 0x30, 0xC0, 0x7C, 0xE2, 0x2C, 0x01, 0x55,
-    0x14, 0x7D, 0x5D, 0x6A, 0xAE, 0xBC, 0x6F, 0xA6, 0x34, 0xF1, 0x2A, 0xA9, 0x55, 0x72, 0x4C, 0x73,
-    0x05, 0xFA, 0x15, 0x45, 0xC8, 0xF2, 0x05, 0xAC, 0xE0, 0x35, 0x36, 0xF9, 0x1F, 0x8D, 0xB2, 0x36,
-    0xF9, 0x20, 0x07, 0x39, 0xD1, 0x3B, 0x60, 0x9E, 0x70, 0xE0, 0x97, 0x47, 0x34, 0x83, 0xA1, 0x9E,
-    0x88, 0xCA, 0x37, 0xFB, 0xB4, 0x23, 0x8D, 0x28, 0x1B, 0x52, 0x50, 0xFD, 0x53, 0x52, 0x30, 0x47,
-    0x1E, 0xF5, 0x9A, 0xFF, 0x36, 0x37, 0xB1, 0xED, 0x3C, 0xFB, 0x83, 0xB3, 0x5C, 0xD5, 0x96, 0x68,
-    0x4E, 0x43, 0xB3, 0xBB, 0x7E, 0xED, 0x5B, 0xC8, 0xB5, 0x22, 0x75, 0x69, 0x9A, 0x3E, 0x88, 0x2C,
-    0x86, 0xE4, 0x4E, 0xA2, 0x47, 0xAE, 0x7E, 0x9D, 0x2B, 0x0F, 0xEF, 0x9A, 0xE0, 0xDF, 0x34, 0xFD,
-    0x9C, 0x22, 0x77, 0x38, 0x73, 0x4A, 0x6E, 0x1E, 0x57, 0xA1, 0x61, 0x08, 0x37, 0x8F, 0x37, 0xD8,
-    0xA6, 0xE4, 0x5A, 0x65, 0x77, 0xC0, 0x47, 0xB6, 0x01, 0x52, 0x7F, 0x5A, 0x4D, 0x6B, 0x52, 0x6F,
-    0xF4, 0x59, 0x4D, 0xDD, 0x96, 0xBC, 0x5B, 0x85, 0xE6, 0xD9, 0x58, 0xFE, 0xDD, 0xF8, 0xA6, 0x0A,
-    0x5E, 0x26, 0x1B, 0x52, 0xAF, 0x13, 0x1D, 0xF2, 0x4D, 0xF6, 0x0C, 0x23, 0xBB, 0xEE, 0x73, 0x53,
-    0xEE, 0x6E, 0xB1, 0x53, 0xF3, 0x8C, 0xC3, 0xF8, 0x1C, 0x78, 0x8F, 0x4B, 0x4C, 0xC5, 0x11, 0xA3,
-    0x76, 0xED, 0x39, 0x51, 0xEF, 0x84, 0xA7, 0x0F, 0x87, 0x66, 0xEA, 0xDF, 0x81, 0x4B, 0x92, 0x4A,
-    0xF7, 0x17, 0x05, 0x04, 0xBF, 0x2C, 0x15, 0x73, 0x49, 0xAE, 0x72, 0xC1, 0x87, 0x65, 0x15, 0x63,
-    0xB3, 0x11, 0x69, 0xFA, 0x85, 0xE3, 0x1B, 0x27, 0x83, 0xC6, 0x73, 0x14, 0x37, 0x56, 0x01, 0xD6,
-    0x5D, 0x1A, 0x77, 0xDD, 0x8D, 0xA8, 0x26, 0x2B, 0xB4, 0xF2, 0x4E, 0xB1, 0xC2, 0x3C, 0x76, 0x88,
-    0x0E, 0xC7, 0x2B, 0xA0, 0xBE, 0x2E, 0x49, 0x24, 0x8C, 0x5F, 0xE9, 0x51, 0x40, 0x93, 0xD0, 0xEC,
-    0x6E, 0x79, 0x8D, 0x2A, 0xCA, 0x89, 0x32, 0xEA, 0xCC, 0x54, 0x2D, 0x05, 0xBF, 0x79, 0xBF, 0x14,
-    0x24, 0x97, 0xB2, 0xE3, 0x64, 0x29, 0xF4, 0x8D, 0x5F, 0x45, 0xEC, 0xBC, 0x38, 0xE4, 0x59, 0xBF,
-    0x7B, 0x55, 0x78, 0xDC, 0x64, 0x6A, 0x1A, 0x1D, 0x06, 0x65, 0x85, 0xB3, 0x8E, 0x8C, 0xE3, 0x0A,
-    0xAA, 0x27, 0x3D, 0xEF, 0x59, 0x9F, 0x84, 0x18, 0xA4, 0xD3, 0xAF, 0x8C, 0xAB, 0xAB, 0x6D, 0x43,
-    0xE7, 0x49, 0x7D, 0x57, 0xBA, 0xC2, 0x95, 0x59, 0xCF, 0xD3, 0x95, 0xD7, 0x16, 0x14, 0xFD, 0x9C,
-    0xA6, 0x68, 0x5E, 0x7E, 0x68, 0xB8, 0xCA, 0xA1, 0xE1, 0x6B, 0xCB, 0x55, 0x76, 0x09, 0x1C, 0xF7,
-    0xEF, 0xC1, 0x30, 0x78, 0x2B, 0x82, 0xBD, 0xE4, 0x64, 0x5E, 0xE0, 0x69, 0xDD, 0xDF, 0xB6, 0x4F,
-    0xD4, 0xF3, 0x17, 0x9D, 0xDF, 0x8C, 0xFC, 0xC4, 0x3E, 0x36, 0x14, 0xFF, 0x38, 0x22, 0x79, 0x06,
-    0x61, 0xED, 0xD6, 0x08, 0x40, 0x21, 0xD0, 0xFB, 0x85, 0xCF, 0x20, 0x3C, 0x82, 0xE0, 0xBF, 0x85,
-    0xA0, 0x1A, 0xEC, 0xC4, 0x8F, 0xCD, 0x2E, 0xB5, 0xA3, 0xA8, 0xF0, 0x5F, 0xFF, 0xB5, 0x20, 0x75,
-    0x80, 0x2A, 0x64, 0xFC, 0x04, 0x36, 0x7D, 0x31, 0xFE, 0x07, 0x8D, 0x55, 0x3D, 0x8F, 0xD5, 0x56,
-    0x10, 0x3D, 0xF6, 0x15, 0xCF, 0x20, 0x17, 0xB7, 0x09, 0x34, 0x48, 0xB8, 0x49, 0x8D, 0x9B, 0x94,
-    0xB0, 0x36, 0x34, 0x69, 0x29, 0x56, 0x11, 0xE1, 0x27, 0x90, 0x62, 0xF3, 0x03, 0x92, 0xB5, 0x53,
-    0xD1, 0xEE, 0x3F, 0xA0, 0x61, 0xEB, 0x50, 0x52, 0xEC, 0xAE, 0xDD, 0x53, 0xC4, 0x52, 0x94, 0x3A,
-    0x2E, 0xB6, 0x41, 0x69, 0x2C, 0xE4, 0x48, 0x8E, 0xF2, 0xFC, 0x86, 0x33, 0x73, 0x6D, 0x78, 0x8F,
-    0xA4, 0xC0, 0x5A, 0xCD, 0x7D, 0xF7, 0xDE, 0xF9, 0x38, 0x73, 0x66, 0xE6, 0x2E, 0x80, 0xF8, 0x1A,
-    0x40, 0x24, 0x25, 0xA5, 0x1B, 0x28, 0x70, 0xA1, 0xE2, 0xBE, 0x0A, 0x6F, 0x87, 0xAD, 0xDE, 0xDB,
-    0xCD, 0x88, 0x58, 0xBA, 0x07, 0x48, 0x64, 0xBE, 0x8F, 0x64, 0x4A, 0x7F, 0x43, 0x32, 0x40, 0x5A,
-    0x37, 0x22, 0xEB, 0xA2, 0x49, 0x37, 0x17, 0x88, 0x46, 0x14, 0xC0, 0x16, 0xBE, 0xC5, 0x25, 0xDC,
-    0x14, 0x5D, 0x01, 0x22, 0x02, 0x64, 0x2A, 0x62, 0x15, 0xB8, 0xFB, 0x0F, 0x0E, 0xBE, 0x93, 0x5D,
-    0xFD, 0x80, 0x4B, 0x23, 0xF2, 0x92, 0xA1, 0x2A, 0x69, 0xA4, 0xA7, 0xFE, 0x8C, 0x7C, 0x0B, 0x24,
-    0x3B, 0x5E, 0xF0, 0x94, 0xF0, 0x78, 0x82, 0xA2, 0x47, 0xCA, 0xDB, 0x64, 0x42, 0xFC, 0x37, 0x6F,
-    0xE8, 0xED, 0xC2, 0xF7, 0x8C, 0xCE, 0x98, 0x33, 0x9C, 0x46, 0xD5, 0xDF, 0xA5, 0x1B, 0xA2, 0x2D,
-    0xE1, 0x10, 0x53, 0xDE, 0xA2, 0xC1, 0x29, 0x08, 0xD1, 0xF7, 0x59, 0x8D, 0x0A, 0xD8, 0xA5, 0x1D,
-    0xFC, 0x00, 0xFF, 0x7E, 0x84, 0xA3, 0x47, 0x99, 0x99, 0x7B, 0x0B, 0x2F, 0x67, 0x77, 0x64, 0x34,
-    0xAC, 0x8A, 0x31, 0xD5, 0xA5, 0x0D, 0x5B, 0x9E, 0x16, 0x5C, 0x08, 0xC6, 0xBF, 0x10, 0x61, 0x54,
-    0xD7, 0x6F, 0x44, 0x53, 0xF8, 0x1A, 0x9F, 0x7D, 0x3B, 0x15, 0xB9, 0x32, 0x95, 0x68, 0x9E, 0x50,
-    0x53, 0x14, 0x4D, 0x4D, 0x7F, 0xEF, 0x69, 0x1E, 0x6D, 0x89, 0x06, 0xC5, 0x23, 0xF5, 0x34, 0x10,
-    0x67, 0xBC, 0x55, 0x8B, 0xAA, 0x54, 0x34, 0x3D, 0x73, 0x21, 0xFE, 0x74, 0x44, 0x53, 0xF2, 0x2F,
-    0xD3, 0x1C, 0xB9, 0x47, 0xD5, 0x32, 0x73, 0xB7, 0xCD, 0xC9, 0x48, 0xF1, 0xBB, 0xA2, 0x99, 0x2B,
-    0x95, 0x6F, 0x25, 0x20, 0xD2, 0x4F, 0x0F, 0xFA, 0x9C, 0x62, 0x60, 0xA2, 0x59, 0x89, 0x1C, 0x29,
-    0xF3, 0x69, 0x59, 0x4B, 0xD7, 0x93, 0x01, 0x16, 0xE4, 0x52, 0x6B, 0xCA, 0xAA, 0x14, 0x5A, 0x95,
-    0xAC, 0x4E, 0x48, 0x62, 0x17, 0x8F, 0x5A, 0xED, 0xAD, 0x96, 0xEA, 0x08, 0x5F, 0x64, 0x88, 0x63,
-    0xDC, 0x66, 0x5D, 0x4A, 0xF2, 0xE7, 0x7A, 0x4C, 0x6A, 0xC9, 0xAB, 0xBC, 0xA4, 0x51, 0xD2, 0x53,
-    0x39, 0x78, 0x32, 0x55, 0x73, 0x4F, 0x17, 0xA7, 0xCB, 0xDE, 0x9C, 0x06, 0x7F, 0x47, 0x04, 0x10,
-    0xF6, 0xB1, 0x85, 0xFF, 0x59, 0x23, 0xFB, 0x9A, 0x1E, 0x0D, 0x8E, 0x67, 0x1E, 0x93, 0x93, 0xB5,
-    0x65, 0x46, 0xED, 0x8A, 0x36, 0xEA, 0xD7, 0x36, 0x34, 0x91, 0xD4, 0xDA, 0x9A, 0x58, 0xC5, 0x3D,
-    0x15, 0xDA, 0x40, 0xF8, 0x71, 0xBD, 0x7C, 0xB3, 0xF4, 0xAE, 0xA2, 0x62, 0x5A, 0x5A, 0x32, 0x25,
-    0x4A, 0x7F, 0xA8, 0xE7, 0x8F, 0x8E, 0xD7, 0xC2, 0xDD, 0x7E, 0x4C, 0x36, 0xAB, 0x4F, 0x07, 0xDE,
-    0xFA, 0x14, 0xB9, 0xBC, 0xD2, 0xE5, 0x34, 0x1C, 0x06, 0xBA, 0xE3, 0xD1, 0x96, 0x30, 0x29, 0xF0,
-    0x9D, 0x2D, 0x59, 0x30, 0x2C, 0x82, 0xE2, 0x95, 0xC9, 0x28, 0xE8, 0xBB, 0xC9, 0x96, 0x34, 0xE8,
-    0x67, 0x7D, 0x50, 0x0C, 0xFA, 0x8D, 0x8E, 0xD7, 0x4D, 0x58, 0xAC, 0x23, 0x6D, 0x46, 0xDE, 0x7C,
-    0x6B, 0x66, 0xC5, 0x9F, 0x63, 0x00, 0x60, 0xFA, 0x59, 0x00, 0xE6, 0xA5, 0x0E, 0x4B, 0xF0, 0x7F,
-    0xBC, 0x80, 0xFD, 0x1E, 0x9B, 0x33, 0xFA, 0x9A, 0x1D, 0xB5, 0x0A, 0x19, 0x08, 0xDD, 0x5F, 0x67,
-    0x55, 0x3D, 0x10, 0x69, 0xD1, 0x26, 0xE5, 0x43, 0xC5, 0xFA, 0x0D, 0x8B, 0x74, 0x84, 0xA4, 0x64,
-    0xD1, 0x3B, 0xBC, 0xF6, 0x4A, 0xFB, 0x3D, 0xB0, 0xED, 0x86, 0xB4, 0xF3, 0x75, 0xAA, 0xAD, 0x24,
-    0xF2, 0x2F, 0x2D, 0xF9, 0x33, 0x17, 0x4E, 0x90, 0xB4, 0x0D, 0x23, 0x3F, 0xAF, 0xF1, 0x64, 0xA5,
-    0x28, 0xBF, 0x0E, 0x79, 0x04, 0x44, 0x68, 0x1E, 0x95, 0xB6, 0x0D, 0xBB, 0x35, 0x73, 0x17, 0xC8,
-    0x59, 0xF9, 0xD0, 0x7A, 0xEF, 0x91, 0x85, 0xBC, 0xDE, 0x67, 0x92, 0x5D, 0x73, 0x60, 0xBC, 0x10,
-    0xC6, 0xE6, 0x39, 0x38, 0x8E, 0xA7, 0xA5, 0x26, 0x8B, 0xCF, 0xEA, 0x30, 0xD4, 0x7A, 0x7C, 0xF5,
-    0x59, 0xA8, 0xE5, 0x78, 0x5E, 0xB4, 0xEC, 0xF8, 0x16, 0xEC, 0x95, 0x8B, 0x97, 0xD1, 0x59, 0x0B,
-    0xCE, 0xA1, 0x0A, 0x39, 0x49, 0x88, 0x7C, 0x32, 0x1D, 0x8E, 0xB5, 0xEF, 0xA3, 0x19, 0x45, 0x97,
-    0x90, 0xA4, 0xF6, 0xC6, 0x31, 0xFE, 0xF3, 0x35, 0x74, 0x1F, 0x09, 0x8A, 0x41, 0x1F, 0xAB, 0x1B,
-    0xCA, 0x58, 0xB5, 0xC5, 0x43, 0x4E, 0x3B, 0x7E, 0x72, 0x83, 0xFF, 0x65, 0x4C, 0x5B, 0x67, 0xAC,
-    0x3D, 0x2F, 0x3F, 0xD9, 0xC4, 0x52, 0x46, 0xA5, 0xFF, 0xAB, 0x4B, 0xBA, 0x02, 0xA3, 0xAF, 0x2F,
-    0x09, 0x06, 0x4F, 0x91, 0xED, 0x47, 0x0E, 0xCF, 0x8B, 0x01, 0x77, 0x06, 0x2C, 0x2D, 0x3F, 0x3E,
-    0xCC, 0xD6, 0xE1, 0xCB, 0xA3, 0x9C, 0x74, 0x4F, 0x6C, 0x6C, 0x46, 0x7B, 0xA6, 0xD4, 0x83, 0x79,
-    0xB1, 0x96, 0x47, 0x6A, 0x94, 0x67, 0xEB, 0x43, 0xC1, 0xB7, 0x4E, 0x07, 0x20, 0x91, 0x3F, 0xCA,
-    0xF5, 0x79, 0xD7, 0xA1, 0x5D, 0x1D, 0xC6, 0xE6, 0x30, 0x35, 0x56, 0xF2, 0xC3, 0x24, 0x37, 0x7B,
-    0x85, 0xAD, 0x46, 0xFB, 0x8F, 0xD1, 0xDB, 0x43, 0xD7, 0x5A, 0x83, 0xAA, 0xA7, 0x6A, 0xB6, 0x63,
-    0x8B, 0xBE, 0x34, 0xAE, 0xBD, 0xF4, 0x4E, 0x76, 0x7A, 0x7D, 0x57, 0xE4, 0xCC, 0x2C, 0x44, 0x5B,
-    0x69, 0x23, 0xC6, 0x76, 0xD4, 0x98, 0x7A, 0xD4, 0x84, 0x28, 0x25, 0xBE, 0x5A, 0x06, 0xF0, 0x7C,
-    0x19, 0xD6, 0x77, 0x34, 0xFD, 0xEE, 0xD7, 0xA5, 0x42, 0xCF, 0xEA, 0x95, 0x96, 0xA5, 0xFC, 0x45,
-    0x58, 0x9A, 0xFD, 0x25, 0x92, 0xFF, 0x59, 0xE2, 0x50, 0x6A, 0x2B, 0xED, 0xC6, 0xA6, 0xFB, 0x44,
-    0x51, 0x6D, 0x8C, 0x30, 0x17, 0x90, 0x55, 0x86, 0xD6, 0x5F, 0x2F, 0x48, 0xD6, 0x4F, 0x11, 0x45,
-    0x3F, 0xD0, 0xFE, 0x4E, 0xA3, 0x8D, 0x43, 0xAA, 0xCF, 0x4B, 0xC4, 0xE7, 0xA6, 0xF0, 0x01,
+static const uint8_t opendyslexic_14_italicBitmaps[35606] = {
+    0xDD, 0x9C, 0x3D, 0xCC, 0x26, 0xD7, 0x75, 0xDF, 0x7F, 0x33, 0x57, 0xDC, 0x01, 0x38, 0x88, 0xAF,
+    0x0A, 0xCB, 0x50, 0x44, 0x88, 0x93, 0xC2, 0x85, 0xA1, 0x48, 0x1C, 0x17, 0x2E, 0x14, 0x60, 0xB9,
+    0x77, 0x64, 0x16, 0x2E, 0x0C, 0x44, 0x6B, 0x80, 0x2B, 0x04, 0x52, 0x61, 0x97, 0x81, 0x53, 0xAC,
+    0x0B, 0x15, 0x0A, 0xB0, 0xDC, 0x19, 0x50, 0x85, 0x8B, 0x00, 0xC9, 0x02, 0x0E, 0x2B, 0x17, 0x61,
+    0x11, 0x03, 0xD2, 0x3A, 0x00, 0x5D, 0xB0, 0x50, 0x80, 0xDD, 0x9D, 0x2B, 0x11, 0x88, 0x8B, 0x14,
+    0x1E, 0x45, 0x30, 0x5C, 0x08, 0x88, 0x46, 0x21, 0x99, 0x0F, 0xBA, 0xE0, 0x95, 0x3D, 0x82, 0x66,
+    0xC9, 0x3B, 0xF3, 0x4F, 0x71, 0xE6, 0x79, 0xDE, 0x77, 0x97, 0x4B, 0x59, 0x32, 0x18, 0xD8, 0xCE,
+    0x00, 0xCF, 0x33, 0xEF, 0x33, 0x9F, 0xF7, 0xE3, 0x7C, 0xFC, 0xCF, 0xF9, 0x9F, 0xFB, 0x42, 0x71,
+    0x07, 0x9E, 0x87, 0x3A, 0x42, 0x06, 0xDF, 0x51, 0x26, 0x08, 0xE0, 0x66, 0xB8, 0x0F, 0x3E, 0x52,
+    0x64, 0x68, 0x07, 0xDC, 0x02, 0x3D, 0xD4, 0x09, 0x76, 0x68, 0x26, 0xCA, 0x0C, 0x61, 0xA0, 0x5A,
+    0xE0, 0x26, 0xA7, 0x2D, 0x44, 0xEA, 0x15, 0x34, 0xD0, 0x2E, 0x38, 0x75, 0x8C, 0x09, 0xC6, 0x49,
+    0xDF, 0xD6, 0xAF, 0xCB, 0x6D, 0x75, 0xF6, 0x6B, 0x93, 0xDA, 0x29, 0xC4, 0x3E, 0xAA, 0x53, 0xB9,
+    0xBB, 0xAD, 0xCA, 0xC7, 0x9D, 0x55, 0x2C, 0x13, 0x80, 0x4B, 0xAC, 0x00, 0x2C, 0xDC, 0x02, 0xE0,
+    0x1E, 0xC1, 0x1E, 0x8D, 0x1F, 0x00, 0x9A, 0xAE, 0x8E, 0x00, 0x3E, 0xBA, 0x04, 0x48, 0x92, 0x94,
+    0x19, 0x25, 0x49, 0x1B, 0x9F, 0xBA, 0xBB, 0xDF, 0x1D, 0xEF, 0x7E, 0x13, 0x78, 0x40, 0xDB, 0x1D,
+    0x37, 0x46, 0x80, 0x26, 0xD6, 0x33, 0x80, 0x9F, 0x5C, 0x02, 0xA8, 0x52, 0x91, 0x01, 0xDC, 0xCA,
+    0x06, 0x78, 0x7B, 0xD2, 0x50, 0xDB, 0x3E, 0x96, 0x77, 0xC7, 0x77, 0x5E, 0x7B, 0xE7, 0xEE, 0x1D,
+    0x68, 0x62, 0x95, 0x00, 0x7C, 0x72, 0x2B, 0x40, 0x65, 0x37, 0x50, 0x66, 0x46, 0x00, 0x44, 0x18,
+    0x00, 0x3E, 0xD1, 0x3D, 0xD5, 0x1D, 0xDD, 0x71, 0x2F, 0x4F, 0x00, 0xDF, 0xBA, 0x0A, 0x50, 0xBF,
+    0x10, 0x81, 0x42, 0x5A, 0xA1, 0x90, 0x14, 0x41, 0xD2, 0x0A, 0x41, 0xAF, 0x5D, 0xE9, 0xA8, 0xF5,
+    0xED, 0x04, 0xE8, 0xEA, 0xB3, 0x40, 0xFB, 0xA7, 0x2F, 0x4F, 0xE0, 0xD6, 0xD7, 0xAF, 0x02, 0xE1,
+    0xCF, 0x5E, 0x88, 0xE0, 0xB4, 0x7C, 0x0D, 0x68, 0xA4, 0x01, 0x18, 0xA5, 0xC9, 0x76, 0x03, 0xB8,
+    0xBF, 0x90, 0x80, 0xAB, 0xAD, 0x56, 0xA8, 0xBE, 0xFE, 0x03, 0x45, 0x78, 0xFD, 0xAA, 0x32, 0xF8,
+    0x17, 0xDE, 0x55, 0xAC, 0x5F, 0xF9, 0xF1, 0xA8, 0xC5, 0x49, 0xD2, 0x6E, 0x23, 0x35, 0x04, 0x49,
+    0x9A, 0x6A, 0x49, 0x9A, 0xB9, 0x22, 0xA9, 0x03, 0x2A, 0x6B, 0xED, 0xEB, 0x57, 0x01, 0xBC, 0x8B,
+    0x3C, 0x61, 0xFB, 0x2A, 0x40, 0x31, 0xF3, 0x54, 0x87, 0x8B, 0x8C, 0x09, 0x8F, 0x9B, 0xBE, 0xCA,
+    0x55, 0x6A, 0x3E, 0xCF, 0xC2, 0x2F, 0xF0, 0xF9, 0x72, 0xE2, 0xD3, 0x7C, 0xBE, 0x1E, 0xF8, 0x2C,
+    0x7F, 0xF2, 0x2C, 0x7C, 0xAE, 0x48, 0xB7, 0xA0, 0xD1, 0xB7, 0x13, 0xD4, 0x72, 0x11, 0x8A, 0x7F,
+    0xEF, 0x77, 0x80, 0xF0, 0xC7, 0x11, 0xB8, 0x57, 0x44, 0x28, 0x97, 0x62, 0x82, 0x3A, 0x15, 0x11,
+    0x9A, 0xE4, 0x22, 0xBC, 0x94, 0xAA, 0x01, 0xD6, 0x7D, 0x04, 0x37, 0x8F, 0x19, 0x7C, 0x6C, 0x66,
+    0x0E, 0x21, 0x78, 0x74, 0x7B, 0x46, 0x1D, 0x14, 0xD2, 0x0C, 0xD5, 0xC3, 0x72, 0x01, 0x1F, 0x59,
+    0xA1, 0x19, 0x8A, 0x15, 0xDA, 0xCE, 0x2D, 0xD0, 0x0E, 0xCD, 0x0C, 0x7E, 0x1A, 0x07, 0xA8, 0xDE,
+    0xDF, 0x80, 0x52, 0x33, 0x50, 0xA9, 0x03, 0x5A, 0x0D, 0x80, 0x7E, 0x30, 0x83, 0x93, 0x5B, 0xF8,
+    0x46, 0x95, 0xC9, 0x45, 0xF6, 0x0B, 0x7D, 0xB5, 0xB6, 0x89, 0xE6, 0x07, 0xA9, 0x4D, 0xD4, 0x8A,
+    0x21, 0xE1, 0xD4, 0xB5, 0x1B, 0x37, 0x77, 0x1A, 0x49, 0xC2, 0x4B, 0xFA, 0x77, 0x5D, 0x29, 0xAD,
+    0x4F, 0x41, 0xBB, 0x9F, 0xE6, 0x9D, 0xFE, 0xBB, 0x7A, 0x61, 0xF7, 0x6B, 0x3B, 0xF7, 0x51, 0x6E,
+    0x3B, 0x37, 0xD5, 0x0F, 0xA6, 0x64, 0xD5, 0x04, 0xD5, 0x0C, 0x2E, 0x41, 0x99, 0xA0, 0x58, 0x80,
+    0x15, 0xB8, 0x07, 0xBC, 0x84, 0xF5, 0xB3, 0xE9, 0xC0, 0x1F, 0x17, 0xBB, 0x74, 0xE9, 0x82, 0x70,
+    0x3C, 0xA9, 0x9A, 0xEC, 0x6E, 0x32, 0x70, 0xED, 0xD2, 0xC1, 0x62, 0x39, 0x1E, 0xD3, 0x62, 0xEF,
+    0x2B, 0x17, 0xE0, 0xFE, 0xF1, 0xCC, 0x6A, 0x82, 0x62, 0x05, 0x7A, 0xEC, 0x05, 0x2E, 0x01, 0x1B,
+    0xD0, 0x0E, 0xD6, 0xCC, 0x6B, 0xC7, 0x95, 0x75, 0xBC, 0xF4, 0xE6, 0xD3, 0xF3, 0x9E, 0xD8, 0xA4,
+    0x6B, 0xA7, 0x93, 0x83, 0x5D, 0x50, 0x4F, 0x66, 0x3C, 0x3E, 0xD0, 0xC1, 0x7C, 0x7C, 0xEE, 0x5D,
+    0xFA, 0xDC, 0x7F, 0xEC, 0x73, 0xEF, 0xD2, 0x75, 0x19, 0x8A, 0xE3, 0x53, 0xAE, 0xE0, 0x16, 0x33,
+    0x13, 0x03, 0x7C, 0x8E, 0xA2, 0x4B, 0xBF, 0xD0, 0x7C, 0xFD, 0x3B, 0x4B, 0xFF, 0xDF, 0xEF, 0xF3,
+    0x8C, 0x3A, 0xEA, 0x44, 0xA9, 0x8D, 0x07, 0xFF, 0x5A, 0xFE, 0xBB, 0xD3, 0xB7, 0x3E, 0x59, 0xD3,
+    0x71, 0x15, 0x98, 0xB1, 0x77, 0xBB, 0x09, 0x1A, 0xE0, 0x5B, 0xC7, 0x9F, 0x5D, 0x25, 0xA9, 0x95,
+    0x56, 0x7C, 0x07, 0xB7, 0xAC, 0xA1, 0x7E, 0x80, 0xE7, 0x81, 0x57, 0x6D, 0xBE, 0x72, 0xA1, 0x2E,
+    0x24, 0x97, 0xE9, 0x07, 0x9F, 0xCA, 0x9D, 0x3E, 0x02, 0x41, 0xFA, 0x89, 0xB4, 0x8D, 0x52, 0xAC,
+    0xE6, 0xBD, 0x79, 0x73, 0xEB, 0x27, 0x1B, 0xB7, 0xC2, 0xE6, 0xFF, 0xD0, 0x1C, 0x67, 0x47, 0x8B,
+    0xC4, 0x61, 0xC9, 0x0E, 0x43, 0x06, 0xD8, 0x3B, 0x80, 0xE7, 0x6C, 0xD7, 0x5C, 0x88, 0x07, 0x50,
+    0x1D, 0xF7, 0xCF, 0xC0, 0x31, 0xC3, 0x1F, 0x76, 0xFF, 0xA1, 0x0F, 0x8D, 0xBD, 0xD8, 0x2C, 0x1C,
+    0xF5, 0x13, 0xEF, 0x37, 0x7B, 0xCA, 0x61, 0x69, 0x5F, 0xFA, 0x69, 0xF7, 0x5B, 0xC3, 0xCD, 0x3E,
+    0x9E, 0x76, 0xC5, 0xA3, 0xF7, 0xDF, 0x7E, 0xE4, 0xFE, 0xF6, 0x49, 0xF7, 0x57, 0xC7, 0xFD, 0xD6,
+    0xF0, 0x22, 0x3F, 0x72, 0xFF, 0xD1, 0x8D, 0x5F, 0xB3, 0xDD, 0xC7, 0xCF, 0x1A, 0xD2, 0xAC, 0x50,
+    0xBD, 0xF5, 0x12, 0xBC, 0xC4, 0x55, 0xAA, 0x89, 0xD7, 0xB9, 0x46, 0x39, 0x97, 0x89, 0x7A, 0xF0,
+    0xC3, 0x70, 0x8D, 0xFB, 0x7E, 0x58, 0x5D, 0xBA, 0xE6, 0xA6, 0xE6, 0xE5, 0xA5, 0xE5, 0x7E, 0x1D,
+    0xB3, 0x4B, 0xCF, 0x56, 0xB3, 0x8F, 0x84, 0xAE, 0xA7, 0xC8, 0x45, 0xC6, 0xCF, 0xF5, 0x8A, 0xBA,
+    0xF6, 0xE1, 0xCD, 0x4C, 0x2F, 0x45, 0xA4, 0x0D, 0x27, 0xCD, 0x38, 0x6D, 0x50, 0xCA, 0x46, 0xB9,
+    0xA3, 0xCC, 0x38, 0x45, 0x6E, 0xAF, 0x3C, 0xDD, 0x9C, 0x5D, 0x5E, 0x75, 0x76, 0x79, 0x5C, 0xB8,
+    0xBC, 0x60, 0xBD, 0xD9, 0x4F, 0xAE, 0xB0, 0x95, 0xDE, 0x94, 0xB6, 0x5E, 0xFA, 0xAF, 0x66, 0xCE,
+    0xCD, 0x02, 0x81, 0x97, 0x26, 0x9A, 0x3B, 0x4D, 0xE2, 0x93, 0x36, 0x70, 0x65, 0x3A, 0x0D, 0xA1,
+    0x4B, 0x80, 0x9F, 0x81, 0x36, 0x02, 0xE3, 0x00, 0xA5, 0x80, 0x26, 0x03, 0x63, 0x82, 0x5A, 0x03,
+    0xF4, 0x1B, 0x94, 0x5A, 0xA0, 0x56, 0x04, 0x2F, 0x65, 0x5A, 0x29, 0x13, 0xA4, 0x95, 0x5E, 0x5A,
+    0xA0, 0x78, 0xED, 0x21, 0x38, 0x29, 0xF2, 0x74, 0x67, 0x63, 0x9C, 0xCE, 0xF2, 0x71, 0x7E, 0x65,
+    0x15, 0xE1, 0xC6, 0xD8, 0xE1, 0xB4, 0x42, 0xA5, 0xB7, 0x80, 0x62, 0x3F, 0xCF, 0xD8, 0xC5, 0x57,
+    0x0F, 0x14, 0x1B, 0x57, 0x5E, 0xB9, 0x99, 0xF1, 0xD2, 0x42, 0x2B, 0x4D, 0x04, 0xA9, 0xE3, 0x8A,
+    0x5E, 0x3D, 0x4F, 0xCB, 0xD7, 0x4C, 0x85, 0xAB, 0x04, 0x4D, 0x82, 0x3E, 0x51, 0xBC, 0x37, 0x53,
+    0xBD, 0x39, 0xD1, 0xFC, 0xFE, 0x44, 0x5F, 0xC7, 0x22, 0xFB, 0x58, 0xA5, 0x66, 0x68, 0x62, 0x3B,
+    0xF4, 0xEF, 0x8C, 0xDB, 0x28, 0xE5, 0x51, 0xCA, 0x20, 0x7B, 0x73, 0xB9, 0x81, 0xCB, 0xF6, 0xA9,
+    0x4F, 0xEE, 0xBE, 0x91, 0x22, 0xA3, 0x64, 0xBA, 0xE2, 0x01, 0x6E, 0x01, 0xE5, 0x0C, 0xF8, 0xEE,
+    0xF4, 0xEB, 0xC7, 0x1D, 0x78, 0x6D, 0x10, 0x24, 0xB8, 0xCE, 0x83, 0x93, 0x1C, 0xB9, 0x04, 0x34,
+    0x11, 0xD8, 0xF9, 0x38, 0x4D, 0x62, 0xFB, 0x8A, 0x62, 0x75, 0x8C, 0x59, 0x44, 0x5A, 0x29, 0xC6,
+    0xF7, 0x00, 0xB8, 0xA2, 0x44, 0x21, 0x45, 0xDA, 0xB7, 0x6F, 0xE0, 0xD6, 0x43, 0x66, 0x8B, 0xE5,
+    0x24, 0xB5, 0xB7, 0x00, 0xF7, 0x57, 0x9A, 0x69, 0xA4, 0xC4, 0xB8, 0x34, 0xB3, 0xDB, 0xF1, 0xD1,
+    0xCF, 0x04, 0x7A, 0xC8, 0xC5, 0x8A, 0x4B, 0xF5, 0x44, 0x33, 0x34, 0x03, 0x99, 0xBE, 0x6B, 0x67,
+    0x24, 0x51, 0x4A, 0x09, 0xA7, 0xFD, 0x42, 0xAE, 0x90, 0xF4, 0x17, 0x92, 0xE0, 0xA9, 0xD5, 0x74,
+    0x31, 0x98, 0x01, 0x6E, 0x22, 0xEC, 0x36, 0x86, 0x61, 0xA0, 0xC8, 0xE0, 0x13, 0x8C, 0x1D, 0x2E,
+    0x43, 0x3B, 0x83, 0xC0, 0xAF, 0xD0, 0x4F, 0x38, 0x41, 0xB3, 0x80, 0x22, 0xC0, 0xD3, 0x7B, 0x07,
+    0xE3, 0x1F, 0xCE, 0x94, 0x89, 0x85, 0x2A, 0x72, 0x0F, 0x3F, 0x70, 0x0F, 0xDF, 0xB1, 0xD2, 0x74,
+    0xE5, 0x82, 0x1F, 0xAA, 0x84, 0x9F, 0x6E, 0x46, 0x2A, 0x09, 0x0A, 0x2D, 0xD0, 0xBE, 0xBF, 0x83,
+    0xBA, 0x30, 0xB8, 0xD5, 0xB0, 0x8B, 0x8F, 0x7E, 0xC2, 0xC7, 0x26, 0xD2, 0xC6, 0x66, 0xA2, 0x1F,
+    0x9A, 0xE5, 0x8A, 0x4C, 0xC4, 0x9C, 0x34, 0xC3, 0xCD, 0xF7, 0x00, 0xFE, 0xE9, 0x0A, 0xB5, 0x36,
+    0xD8, 0x8A, 0x8C, 0x8F, 0xE5, 0xC2, 0x3D, 0xAA, 0xD9, 0x4D, 0xB4, 0x43, 0x0B, 0x0F, 0x58, 0x29,
+    0x17, 0x37, 0xE3, 0x27, 0x1F, 0x19, 0x09, 0x43, 0x9D, 0x19, 0xA5, 0x99, 0x51, 0xEA, 0xE8, 0x1F,
+    0xE6, 0x93, 0xE5, 0x69, 0x3B, 0x28, 0x32, 0x1F, 0xA7, 0x99, 0x0A, 0x49, 0xD4, 0x52, 0xB2, 0x19,
+    0x1C, 0x75, 0x07, 0xF0, 0x73, 0xB1, 0x11, 0xA6, 0x2A, 0xA3, 0xF8, 0xD4, 0x8B, 0x1F, 0x74, 0xEB,
+    0x23, 0x3E, 0x15, 0x22, 0xA4, 0x6A, 0xE7, 0xC0, 0x59, 0x2E, 0x53, 0xAF, 0xF8, 0x95, 0x76, 0xE1,
+    0x89, 0x9B, 0x62, 0xA1, 0xCE, 0x09, 0x97, 0xA9, 0x56, 0x7C, 0xA2, 0x9D, 0xCD, 0x64, 0x5F, 0x6C,
+    0xDF, 0x02, 0x18, 0x23, 0x30, 0x2E, 0xC0, 0xB8, 0x3E, 0xFA, 0xB5, 0x01, 0x61, 0x03, 0x9C, 0x00,
+    0x5A, 0xDD, 0x01, 0x46, 0x3D, 0x04, 0x9E, 0x91, 0xEE, 0xC0, 0x15, 0x69, 0x05, 0x6E, 0x2A, 0x02,
+    0xF5, 0x06, 0x50, 0xBC, 0x0A, 0xC5, 0x8B, 0xA5, 0x94, 0x6B, 0x29, 0x3F, 0xD6, 0xA4, 0xEE, 0x53,
+    0x52, 0x0C, 0xD2, 0x74, 0x03, 0xE0, 0x63, 0x17, 0xA6, 0xDC, 0xFA, 0x30, 0x2E, 0x1C, 0xF3, 0xF5,
+    0xC8, 0x77, 0x79, 0x7C, 0xCF, 0x40, 0xB5, 0x1D, 0xEF, 0x2B, 0x46, 0x2D, 0x3C, 0x23, 0xDD, 0x29,
+    0x46, 0x3D, 0x84, 0x56, 0x6F, 0x81, 0xDB, 0xBB, 0x0B, 0x33, 0x0A, 0xC0, 0x53, 0x2F, 0x42, 0xAD,
+    0x4C, 0x25, 0xA5, 0x62, 0xFF, 0xC2, 0x18, 0x3D, 0x65, 0x06, 0xFC, 0x74, 0x78, 0x79, 0x1F, 0x0F,
+    0x6B, 0xDC, 0x0E, 0x87, 0x91, 0xDE, 0x0F, 0xA3, 0x54, 0x27, 0x70, 0x1B, 0x94, 0xEA, 0x28, 0x15,
+    0x61, 0x9C, 0xC1, 0x2F, 0x80, 0x80, 0x66, 0x36, 0x2D, 0x26, 0x44, 0x53, 0xE3, 0x4B, 0x66, 0xFB,
+    0x64, 0xF5, 0x37, 0xA0, 0x9D, 0x8E, 0xD3, 0x63, 0x7C, 0x1C, 0xA8, 0x0D, 0x00, 0xBD, 0x76, 0xA0,
+    0xD8, 0xBB, 0x6A, 0x36, 0xA7, 0xFE, 0xBC, 0x69, 0xB2, 0x8B, 0xA6, 0xD0, 0x7F, 0x82, 0x4B, 0xFD,
+    0xAF, 0xF2, 0x59, 0x5C, 0xFA, 0xCF, 0xF7, 0xA8, 0x29, 0x96, 0xDF, 0xF3, 0x94, 0x91, 0xFC, 0xAB,
+    0x6E, 0x20, 0xF1, 0xE0, 0x57, 0x8A, 0x89, 0xD7, 0x09, 0xFF, 0x9C, 0x85, 0x5B, 0xF8, 0xEF, 0xFD,
+    0x65, 0xE6, 0x25, 0xAA, 0x65, 0x14, 0xF7, 0x29, 0xF6, 0xFA, 0xCD, 0xEF, 0x6F, 0xD0, 0x47, 0xDC,
+    0x6A, 0xCE, 0x04, 0x70, 0x87, 0x66, 0x8E, 0xFB, 0x6F, 0xFD, 0xAB, 0xCE, 0x20, 0xFE, 0x64, 0x7A,
+    0xBA, 0x00, 0x95, 0xB4, 0x59, 0xEB, 0xFE, 0xCF, 0xA3, 0xCD, 0xDD, 0x01, 0xEA, 0x15, 0x20, 0x24,
+    0xC0, 0x29, 0x02, 0xCD, 0x08, 0x90, 0x33, 0xE0, 0xBF, 0xB7, 0x00, 0xBD, 0x9F, 0xC0, 0xA5, 0xD0,
+    0x41, 0x3B, 0x3C, 0x80, 0x22, 0x97, 0x2B, 0xF8, 0xA9, 0x4E, 0x30, 0xD2, 0x46, 0xAA, 0x44, 0x0F,
+    0x61, 0x28, 0x32, 0x65, 0xA6, 0x5A, 0xF0, 0x13, 0x7E, 0xE2, 0x1C, 0x66, 0xEC, 0x04, 0x49, 0xAB,
+    0x93, 0xA4, 0xD4, 0xCC, 0x10, 0xA2, 0x00, 0xD5, 0x2B, 0xB8, 0xDC, 0x47, 0x68, 0x16, 0x8A, 0x1B,
+    0x37, 0x3A, 0xE8, 0xA5, 0x81, 0x5A, 0x12, 0x6C, 0x54, 0x0B, 0x3E, 0xE2, 0x87, 0x22, 0xC3, 0x4A,
+    0x3B, 0xD0, 0x74, 0x2E, 0xE1, 0x12, 0x81, 0x62, 0xA3, 0x96, 0xD4, 0x21, 0x69, 0xC0, 0x4B, 0xEA,
+    0x8A, 0x4C, 0xB9, 0xD1, 0x0E, 0xF8, 0x64, 0x41, 0x5C, 0x80, 0x2A, 0x55, 0x09, 0xC4, 0x03, 0x68,
+    0x66, 0x3F, 0xE1, 0x36, 0x32, 0xA5, 0x62, 0x23, 0x69, 0x2D, 0x25, 0x89, 0x20, 0x69, 0xAA, 0x24,
+    0x2D, 0xA6, 0xE5, 0x8F, 0x4C, 0xE7, 0x9D, 0x53, 0x38, 0x53, 0x49, 0x19, 0x6A, 0xBD, 0xF2, 0x65,
+    0x30, 0x70, 0xEF, 0xF3, 0xC5, 0xB7, 0x8D, 0xA1, 0xC5, 0x78, 0x2E, 0x73, 0x76, 0x45, 0xC8, 0xB0,
+    0xF2, 0xC0, 0x21, 0x35, 0x87, 0xB0, 0xE1, 0x76, 0x80, 0xC2, 0xAC, 0x5F, 0x9F, 0xE1, 0xE3, 0x34,
+    0x7A, 0xF8, 0xA5, 0x4C, 0x25, 0x69, 0xB7, 0x68, 0xAF, 0xA3, 0x95, 0x14, 0x71, 0x92, 0x12, 0xF4,
+    0xD2, 0x0A, 0xA5, 0xF4, 0xBF, 0xCF, 0xED, 0x73, 0xDA, 0xAD, 0x81, 0x1A, 0xC0, 0x7C, 0x51, 0x90,
+    0x14, 0x69, 0x22, 0xFD, 0x6A, 0x68, 0x11, 0xB7, 0x42, 0x3B, 0x63, 0xCE, 0xA9, 0x07, 0x44, 0x1B,
+    0x21, 0x44, 0x3F, 0x73, 0x0C, 0x95, 0xCB, 0x45, 0x06, 0xC4, 0x08, 0xF4, 0x31, 0x0C, 0xD0, 0xCE,
+    0x7E, 0x02, 0xBF, 0x54, 0x09, 0x7C, 0x2E, 0x33, 0x34, 0x3B, 0xFB, 0x8D, 0x2F, 0x1D, 0x03, 0xA6,
+    0xAE, 0x91, 0xA4, 0xC1, 0x4B, 0xD2, 0xE0, 0x24, 0xA9, 0x2B, 0x24, 0x6D, 0x30, 0x6A, 0xBF, 0x73,
+    0x52, 0xD4, 0xEB, 0xD4, 0x92, 0x22, 0x41, 0xDA, 0x40, 0xD2, 0x4C, 0xB5, 0x00, 0x84, 0xEE, 0x8C,
+    0x94, 0xCC, 0xC1, 0x1B, 0x30, 0xDF, 0x00, 0xAA, 0x1F, 0x7F, 0xE9, 0x55, 0xCC, 0xBF, 0x21, 0xED,
+    0xE0, 0xA4, 0x05, 0x9A, 0xE9, 0x2C, 0xB2, 0x06, 0xB8, 0x9A, 0x68, 0x46, 0xD4, 0x42, 0x5B, 0xF3,
+    0xB5, 0xEA, 0x18, 0x0F, 0x30, 0xA4, 0xE5, 0xD0, 0x83, 0x51, 0x12, 0xC0, 0x8D, 0x2F, 0xDF, 0x1D,
+    0x08, 0x3A, 0x79, 0x40, 0x9F, 0x4E, 0x4F, 0x32, 0xE0, 0xB6, 0x9F, 0xDB, 0xD5, 0x44, 0x30, 0x63,
+    0xEE, 0xA4, 0x95, 0xC2, 0xBA, 0x75, 0xF7, 0x8F, 0xB0, 0xF0, 0xB7, 0x99, 0x30, 0x43, 0x62, 0x53,
+    0x6D, 0x33, 0x3D, 0x76, 0x87, 0xD9, 0xB0, 0xE7, 0xD6, 0x2B, 0x66, 0x68, 0x0E, 0x11, 0x78, 0xCC,
+    0x50, 0x7C, 0x4A, 0x7B, 0x47, 0xA1, 0xE3, 0x15, 0x77, 0x33, 0x4E, 0x13, 0x05, 0x4E, 0x1D, 0x07,
+    0x66, 0x02, 0x75, 0x1C, 0x20, 0xEA, 0x78, 0x30, 0xED, 0x7C, 0x49, 0x80, 0xCE, 0x52, 0xF6, 0x0A,
+    0x8C, 0x1D, 0x41, 0x73, 0x98, 0xF0, 0xCA, 0x3E, 0xC1, 0x33, 0x72, 0x19, 0x78, 0xD8, 0xA9, 0x83,
+    0xFB, 0x84, 0x04, 0xA1, 0xF3, 0xFA, 0xA3, 0x2F, 0x29, 0x9A, 0x0E, 0x32, 0x4A, 0x5A, 0xF1, 0x26,
+    0x6C, 0xA3, 0xB4, 0x41, 0x61, 0x4E, 0xAB, 0xF8, 0x06, 0x94, 0xAF, 0x52, 0x27, 0x68, 0x23, 0x61,
+    0x80, 0x9D, 0x62, 0x83, 0x6A, 0x39, 0x1F, 0x8B, 0x20, 0xD8, 0xC1, 0xAD, 0x54, 0x36, 0x33, 0xC7,
+    0x31, 0x71, 0x38, 0x26, 0x9A, 0x44, 0x3B, 0xC1, 0x38, 0x20, 0x70, 0x1B, 0xD5, 0x7E, 0xE3, 0xC6,
+    0xCD, 0x44, 0x2B, 0x19, 0x6E, 0x91, 0x76, 0x9C, 0x24, 0x2D, 0x16, 0x67, 0xDA, 0x31, 0xE1, 0x76,
+    0xF0, 0x2B, 0xCD, 0x02, 0xFD, 0xC4, 0x18, 0x29, 0xD5, 0x39, 0x81, 0xCF, 0x86, 0x1C, 0x12, 0xE3,
+    0x64, 0x40, 0xC4, 0xAD, 0xC7, 0xBB, 0xEA, 0x85, 0x3A, 0xE1, 0x13, 0x7E, 0xA2, 0x89, 0x47, 0xAB,
+    0x43, 0xC7, 0x78, 0x34, 0xB3, 0xD8, 0x29, 0x37, 0xDC, 0xD9, 0xB9, 0x2E, 0xF8, 0x85, 0x36, 0x11,
+    0x12, 0xFD, 0xCC, 0x4D, 0xD3, 0xF8, 0xBB, 0x67, 0x3D, 0x6D, 0xA7, 0xD3, 0x24, 0x56, 0x99, 0xC3,
+    0x1F, 0xD8, 0x24, 0x86, 0xF8, 0xC8, 0xE9, 0xCB, 0xB3, 0x7F, 0x3E, 0xDD, 0xCC, 0x40, 0xBD, 0x9C,
+    0x67, 0xE8, 0x71, 0xE1, 0x98, 0xC1, 0x54, 0xA0, 0x7C, 0xEC, 0x74, 0x1F, 0xA1, 0x1B, 0x67, 0x08,
+    0x4A, 0xD0, 0x18, 0x40, 0x5E, 0xC1, 0x69, 0x01, 0x74, 0xE7, 0x92, 0xF4, 0x84, 0xCE, 0x27, 0x8A,
+    0x8C, 0x3A, 0xFC, 0x5C, 0x2F, 0x10, 0xBA, 0x71, 0xA0, 0xCC, 0xD5, 0x0A, 0x7E, 0xEE, 0x23, 0x84,
+    0x17, 0x32, 0x94, 0x39, 0x44, 0xF0, 0x6F, 0x6E, 0x40, 0xDF, 0x4F, 0x50, 0x6A, 0x07, 0xBC, 0x66,
+    0xA0, 0x17, 0x50, 0x2A, 0x01, 0x5E, 0x09, 0xE8, 0x35, 0x41, 0x29, 0x45, 0xF0, 0x7F, 0xAD, 0x08,
+    0xFD, 0xBF, 0xD1, 0x80, 0xDB, 0xBC, 0x3A, 0x7C, 0x6A, 0x05, 0xFD, 0x10, 0x76, 0xDC, 0xC6, 0xB8,
+    0xE1, 0x53, 0xA1, 0xCC, 0x38, 0x38, 0xAD, 0xC0, 0x37, 0x0F, 0x9D, 0x29, 0x33, 0xA6, 0x22, 0x6E,
+    0x39, 0xC6, 0xC4, 0xCF, 0x87, 0x52, 0x37, 0x27, 0x87, 0x1A, 0x4E, 0x1E, 0x59, 0xC7, 0xE9, 0x62,
+    0x3B, 0x5C, 0xB3, 0x5B, 0x81, 0xBE, 0x3B, 0x54, 0x4B, 0x40, 0xF3, 0xDE, 0x1F, 0xEB, 0x3B, 0x92,
+    0xD6, 0x20, 0xE9, 0x05, 0x49, 0xE9, 0x50, 0xE5, 0xBB, 0x03, 0x7C, 0xE6, 0x55, 0x9C, 0x3A, 0x0A,
+    0x45, 0x9A, 0xDD, 0x6C, 0xB2, 0x56, 0x18, 0x17, 0x9C, 0x12, 0x95, 0x22, 0x8D, 0x22, 0x41, 0x30,
+    0x8A, 0x52, 0x19, 0xA7, 0x4C, 0xA3, 0x99, 0xE6, 0x07, 0x0B, 0x1A, 0x3B, 0x1E, 0xF4, 0x73, 0xFD,
+    0xDE, 0x86, 0x5B, 0x35, 0xF4, 0x7F, 0x96, 0x68, 0xBE, 0x27, 0xB7, 0xF5, 0x91, 0xD1, 0xE7, 0xF6,
+    0x7F, 0xEC, 0xB8, 0x1C, 0x7E, 0x24, 0xBF, 0xD2, 0xCC, 0xE3, 0x0F, 0x96, 0x7E, 0x62, 0x7C, 0x59,
+    0xFA, 0x8E, 0x70, 0x5B, 0xA5, 0xEC, 0x33, 0x4D, 0xF2, 0x9A, 0xFB, 0xC4, 0x18, 0x83, 0x4A, 0x0D,
+    0x6E, 0x47, 0x8B, 0xDF, 0xF0, 0x8B, 0xD3, 0xD0, 0x27, 0xC6, 0xA9, 0xCE, 0xA5, 0xA2, 0x13, 0xED,
+    0xE4, 0x65, 0x4E, 0xA2, 0x5F, 0x19, 0x67, 0x28, 0x75, 0x0A, 0xA5, 0xBF, 0x01, 0xFD, 0x80, 0xCB,
+    0x20, 0x73, 0xE6, 0x8A, 0x66, 0xB2, 0x27, 0x7C, 0xC2, 0x69, 0xC6, 0xCF, 0x54, 0x9A, 0x69, 0x27,
+    0x6A, 0x25, 0x42, 0xC4, 0x2B, 0xD1, 0x0F, 0x34, 0x7F, 0xB9, 0x30, 0x76, 0xB4, 0x7F, 0xB1, 0x22,
+    0x08, 0x6F, 0xAC, 0xC5, 0x0E, 0xFD, 0x1B, 0xB9, 0xDC, 0x60, 0xFC, 0x7A, 0x76, 0x19, 0xF4, 0xEB,
+    0x5B, 0xB5, 0x52, 0xA8, 0xD8, 0xEB, 0x85, 0x52, 0xC8, 0x27, 0xDC, 0x8E, 0x9A, 0x99, 0x6A, 0x43,
+    0x61, 0xC2, 0x67, 0xC6, 0x3E, 0xE2, 0x33, 0xBD, 0x22, 0xCD, 0x4A, 0x50, 0x47, 0x58, 0x08, 0x82,
+    0x90, 0x68, 0x05, 0x63, 0xA2, 0xB5, 0xD4, 0xCE, 0x4D, 0x0D, 0x66, 0x13, 0x57, 0xA0, 0xD7, 0x28,
+    0x28, 0x34, 0x95, 0x1A, 0xA8, 0x76, 0x18, 0x23, 0x7E, 0x81, 0x30, 0x11, 0x66, 0x68, 0x67, 0xFA,
+    0x01, 0x9A, 0xF9, 0x98, 0xE3, 0x62, 0xB3, 0x64, 0xA4, 0x41, 0x34, 0xB7, 0x70, 0xCE, 0x34, 0xB6,
+    0xB1, 0x4E, 0x26, 0xCF, 0x33, 0xD0, 0x9B, 0xB8, 0x08, 0x6F, 0x20, 0xCD, 0xAF, 0xD0, 0x64, 0xBC,
+    0xAE, 0xFF, 0xD2, 0x61, 0xCB, 0x95, 0xA8, 0x75, 0xF6, 0x89, 0xEA, 0x28, 0x65, 0x70, 0xB4, 0x37,
+    0xC7, 0x7D, 0x45, 0x0F, 0x1F, 0xC1, 0xCA, 0x7A, 0x0B, 0x9C, 0x94, 0xA1, 0x79, 0x47, 0xF9, 0x40,
+    0x14, 0x2E, 0x51, 0xCF, 0x34, 0x91, 0x66, 0x60, 0x87, 0x07, 0xB8, 0x05, 0x97, 0x68, 0x22, 0x21,
+    0x32, 0xF2, 0x8C, 0x39, 0x8F, 0x99, 0xE6, 0x64, 0x1B, 0x07, 0x9C, 0xEE, 0x76, 0x87, 0x6A, 0x9B,
+    0xB2, 0x9A, 0x65, 0x6F, 0xD2, 0xD9, 0xB4, 0x9B, 0x3F, 0x37, 0xD3, 0x6C, 0x07, 0x74, 0x81, 0x0E,
+    0xC6, 0x13, 0xA8, 0xB8, 0x62, 0x73, 0xDF, 0x5A, 0x32, 0xB2, 0xDF, 0x0D, 0x90, 0x4F, 0xA8, 0x83,
+    0x71, 0xB0, 0x60, 0x69, 0xA0, 0xD8, 0xCC, 0x12, 0x85, 0x8E, 0x10, 0xC1, 0xCF, 0x27, 0xF5, 0xF0,
+    0x33, 0xB0, 0x73, 0x8C, 0x99, 0x5B, 0x01, 0x3F, 0x15, 0x9B, 0xF9, 0xD0, 0xD1, 0x4C, 0x4E, 0x1B,
+    0x81, 0xCD, 0x0C, 0xD4, 0x78, 0x56, 0x39, 0xE1, 0x86, 0x10, 0x09, 0x73, 0xA9, 0x71, 0xC6, 0xEB,
+    0xEE, 0xE1, 0x79, 0xA4, 0x04, 0xA3, 0xED, 0xBC, 0xED, 0x8E, 0x8C, 0x2D, 0x57, 0x0E, 0xAF, 0x49,
+    0x2D, 0xCB, 0x72, 0x18, 0x86, 0xA4, 0x35, 0xCC, 0x62, 0x9A, 0xCF, 0xEF, 0x7E, 0xD3, 0xE0, 0xE6,
+    0x40, 0x21, 0xED, 0xF0, 0x1C, 0x75, 0xC2, 0x4D, 0xB4, 0x1D, 0xB7, 0x28, 0x17, 0xEA, 0x48, 0x0B,
+    0x2B, 0x55, 0xA2, 0xA1, 0xD8, 0x29, 0x53, 0x61, 0x70, 0x60, 0xA1, 0x92, 0x56, 0x18, 0xB5, 0x61,
+    0x61, 0x39, 0x7A, 0x65, 0x8C, 0xB4, 0x53, 0xB1, 0xE1, 0x32, 0x7E, 0x26, 0x44, 0x76, 0xEA, 0x4C,
+    0x33, 0xA3, 0xA1, 0xDC, 0xF1, 0x0B, 0x61, 0x2E, 0x45, 0xB5, 0x13, 0x12, 0xE3, 0xEC, 0x84, 0xDF,
+    0x19, 0x67, 0x0C, 0xB4, 0x15, 0x37, 0xAE, 0x9F, 0xE2, 0x6D, 0x7A, 0x29, 0x61, 0x19, 0x05, 0xC2,
+    0xD6, 0x7D, 0x0C, 0x5A, 0xCB, 0x6C, 0xCF, 0x17, 0x88, 0xA3, 0x5C, 0x2F, 0x21, 0xB4, 0xF0, 0x10,
+    0xA0, 0xD2, 0xDE, 0x01, 0xA3, 0x76, 0x43, 0xCD, 0x8B, 0x8D, 0xC3, 0x70, 0x0E, 0x57, 0x68, 0x0D,
+    0x32, 0xCB, 0xA6, 0x38, 0xD1, 0x51, 0x6A, 0x65, 0x7C, 0xE7, 0xB5, 0x23, 0x33, 0xBF, 0x3D, 0xF2,
+    0xDD, 0x4A, 0x5A, 0x28, 0x46, 0x5D, 0xA4, 0x4D, 0x4D, 0x8C, 0x7B, 0x49, 0xFA, 0x8E, 0x24, 0xED,
+    0x4F, 0xBF, 0x52, 0xA7, 0xE2, 0xFA, 0x01, 0x2D, 0x0E, 0x00, 0x64, 0x88, 0x28, 0x9E, 0x1D, 0x84,
+    0x61, 0x26, 0x3B, 0xA0, 0x23, 0x33, 0x7F, 0x06, 0x94, 0xBA, 0x80, 0x03, 0x26, 0xA1, 0x1A, 0x3E,
+    0x5C, 0x42, 0x9B, 0xC7, 0x25, 0x14, 0xBF, 0x40, 0x3F, 0x15, 0xEA, 0xA8, 0x33, 0x6D, 0x02, 0xC5,
+    0xC3, 0x07, 0x87, 0x89, 0x42, 0x54, 0x19, 0xDA, 0xC4, 0x18, 0x71, 0xFB, 0x49, 0xCB, 0x05, 0x55,
+    0x3E, 0xC4, 0xB5, 0xD8, 0xA1, 0x5E, 0x68, 0x23, 0x08, 0x97, 0xC1, 0xCF, 0x84, 0x81, 0x62, 0xA3,
+    0x5A, 0x30, 0x95, 0xC2, 0xE5, 0x53, 0x22, 0x40, 0xE0, 0x13, 0x7E, 0xC1, 0x89, 0x42, 0x6F, 0x7F,
+    0x45, 0x13, 0x8D, 0xA4, 0x4C, 0x61, 0x0A, 0xED, 0x25, 0xCD, 0x30, 0x5A, 0xCE, 0x69, 0xBC, 0xA4,
+    0xCF, 0x9F, 0xE9, 0x80, 0x6F, 0x5A, 0x60, 0x16, 0x22, 0xD4, 0x8B, 0x29, 0x47, 0x88, 0x10, 0x62,
+    0x88, 0x30, 0x0E, 0xD6, 0xE2, 0x76, 0xC2, 0x6D, 0xB4, 0x13, 0xF5, 0x4A, 0x3B, 0xD3, 0x24, 0xDA,
+    0x99, 0x30, 0x1F, 0xBD, 0x68, 0x52, 0xA1, 0x8E, 0x26, 0xB9, 0x1D, 0x9A, 0x54, 0x67, 0x68, 0x52,
+    0xB3, 0x42, 0xB3, 0x84, 0x04, 0x7E, 0x19, 0xA7, 0x43, 0xA0, 0xF1, 0x12, 0xE0, 0x0F, 0xA7, 0x99,
+    0x01, 0xAF, 0xE5, 0xEC, 0x2F, 0xBD, 0xCE, 0xFE, 0x1C, 0x46, 0x03, 0xA0, 0x84, 0x61, 0x3F, 0xE8,
+    0x21, 0x83, 0xFC, 0xCD, 0x6C, 0x53, 0xE2, 0x53, 0x75, 0x30, 0x2A, 0x86, 0x17, 0x5C, 0xA6, 0x1F,
+    0x18, 0x29, 0x76, 0xDA, 0x89, 0x3E, 0x22, 0xEA, 0x85, 0x90, 0x18, 0x87, 0x72, 0x23, 0x6C, 0x84,
+    0xC8, 0xD8, 0x05, 0x0D, 0xED, 0x4C, 0x3B, 0xB5, 0x4A, 0x3E, 0xE1, 0x97, 0xE6, 0xFD, 0x5C, 0xAF,
+    0xB8, 0xCD, 0xAF, 0x72, 0x19, 0xF4, 0xC5, 0x1C, 0xFE, 0xDB, 0x06, 0xE1, 0xFB, 0x9B, 0x7F, 0x28,
+    0xF0, 0xEF, 0xEF, 0x6E, 0x57, 0x87, 0x93, 0x18, 0x0D, 0x3C, 0x77, 0xAD, 0x26, 0x08, 0x1A, 0x6A,
+    0xD3, 0xF0, 0x58, 0x68, 0x01, 0xA7, 0x89, 0x3E, 0x43, 0xA1, 0x19, 0xBF, 0x01, 0x7D, 0x3A, 0x49,
+    0x03, 0xF7, 0x2D, 0xF3, 0xD9, 0x44, 0xE8, 0x39, 0x91, 0x61, 0x8C, 0xE6, 0x99, 0x9B, 0x89, 0xBE,
+    0x03, 0xB7, 0xD2, 0x77, 0xC0, 0x68, 0x80, 0xA9, 0x99, 0xFB, 0x01, 0x70, 0xD9, 0xFA, 0x3C, 0x1A,
+    0xD6, 0x6D, 0x4E, 0x76, 0xC2, 0x90, 0xEF, 0x01, 0x80, 0x7B, 0x4B, 0x6B, 0xF4, 0x36, 0x4C, 0xFD,
+    0x11, 0xFF, 0xBC, 0xBB, 0x02, 0xF4, 0x6F, 0x0A, 0xA0, 0x9F, 0xFB, 0x09, 0xE8, 0x93, 0x79, 0xCD,
+    0xE4, 0xD4, 0x41, 0x48, 0xF4, 0x09, 0x42, 0xC2, 0x67, 0x08, 0x0B, 0xA5, 0x06, 0xC2, 0x82, 0x1D,
+    0x1D, 0x20, 0x7C, 0x31, 0x41, 0x78, 0x39, 0x43, 0x1B, 0xFB, 0x8E, 0x36, 0xFA, 0x44, 0x33, 0x99,
+    0x21, 0x19, 0x3B, 0x9F, 0x68, 0x67, 0x9F, 0xA8, 0x72, 0xBD, 0x80, 0x7E, 0x73, 0x85, 0xF0, 0xBF,
+    0xF2, 0x91, 0x05, 0x2A, 0xB4, 0x9D, 0x9A, 0xE4, 0x05, 0x07, 0x0A, 0xD7, 0x00, 0x84, 0x89, 0xC3,
+    0x74, 0xF8, 0x0C, 0xD4, 0xFB, 0xE9, 0xB4, 0x45, 0x6E, 0x06, 0x9C, 0xD6, 0x73, 0xA6, 0x4F, 0xC2,
+    0xAC, 0xEA, 0x60, 0x11, 0xDC, 0x64, 0xF1, 0x98, 0xD9, 0xCF, 0xB0, 0x5E, 0xDE, 0xF5, 0x8F, 0xEC,
+    0x46, 0x1B, 0x16, 0xB3, 0x31, 0x85, 0xDD, 0x70, 0xEC, 0x0C, 0xA3, 0xE1, 0xCC, 0xC8, 0x1D, 0xBB,
+    0xCA, 0x76, 0xB5, 0xF9, 0x13, 0x7F, 0xDA, 0x5D, 0x1E, 0xF8, 0xC6, 0x98, 0x2F, 0x6F, 0xAC, 0xA1,
+    0x33, 0x74, 0x5D, 0x18, 0xE5, 0x67, 0x24, 0x62, 0x3A, 0xEC, 0x79, 0x77, 0x3C, 0xA1, 0x52, 0x3A,
+    0x59, 0xC5, 0xED, 0x94, 0x38, 0xB5, 0xB8, 0xCC, 0x4F, 0xA7, 0x54, 0xE4, 0xA5, 0xD3, 0xE1, 0x1C,
+    0x83, 0x5D, 0x9C, 0xB6, 0x48, 0xEA, 0xFE, 0xA3, 0xA7, 0xEB, 0xF9, 0xD1, 0xD3, 0x0F, 0x1E, 0x0B,
+    0xB4, 0xE6, 0x73, 0x44, 0xF7, 0xD8, 0x69, 0x1F, 0x4F, 0xC6, 0xF0, 0xD2, 0xE9, 0x4B, 0xAD, 0x8A,
+    0x40, 0x65, 0x41, 0x71, 0x06, 0x24, 0xE0, 0x13, 0x37, 0x3A, 0x80, 0x8F, 0xB9, 0x62, 0x7A, 0xFD,
+    0x73, 0xF5, 0xCB, 0xF3, 0xBD, 0xB6, 0xFE, 0x76, 0xBA, 0xD5, 0xFC, 0xC6, 0x77, 0x97, 0xDB, 0xCD,
+    0xD7, 0x53, 0x0E, 0xFE, 0x8D, 0x94, 0xAF, 0x79, 0x47, 0x37, 0x6E, 0xC0, 0xB8, 0x9F, 0xA0, 0xB0,
+    0xBD, 0xF1, 0xE2, 0xB9, 0x7E, 0x3A, 0x35, 0xED, 0xA2, 0x01, 0xE5, 0x7A, 0xEE, 0xC3, 0x45, 0x4B,
+    0xFB, 0x8B, 0x6C, 0xF3, 0xB9, 0x4B, 0x8F, 0x3D, 0xC1, 0x3D, 0xE9, 0x09, 0xDB, 0x13, 0x9E, 0xD0,
+    0x0E, 0x8F, 0x3C, 0xE1, 0xD2, 0xEB, 0x1F, 0x89, 0x55, 0x9D, 0xF2, 0x49, 0x6A, 0xB5, 0x03, 0x37,
+    0x6E, 0xF0, 0x3A, 0x84, 0x8E, 0x76, 0xA1, 0xA9, 0x07, 0xCF, 0xAD, 0xA7, 0x29, 0x0E, 0xA2, 0x45,
+    0x92, 0xDE, 0x90, 0xA4, 0xF9, 0xEE, 0xDD, 0xBB, 0x77, 0x5F, 0xBD, 0x66, 0x50, 0xC1, 0x27, 0x9E,
+    0x3A, 0xEC, 0x6A, 0xB9, 0x43, 0xA9, 0x2D, 0x21, 0xED, 0x84, 0xA9, 0x9D, 0xAB, 0xC4, 0xC6, 0x8A,
+    0x8F, 0x2D, 0x64, 0x37, 0xE1, 0xE3, 0x2D, 0x8A, 0xD5, 0x0F, 0x84, 0x61, 0xA1, 0x5E, 0xFC, 0xE0,
+    0x84, 0xBE, 0xAC, 0xE4, 0x25, 0x31, 0x4A, 0xB3, 0xD3, 0x7E, 0x9B, 0x7A, 0xFF, 0x8D, 0xC9, 0xC0,
+    0xFD, 0x09, 0xFB, 0xD7, 0xA7, 0xBC, 0x9B, 0x9F, 0x8E, 0x3E, 0x37, 0xF1, 0x18, 0x81, 0xF0, 0x9B,
+    0x3B, 0xEE, 0x7D, 0x6D, 0xF4, 0xFB, 0x57, 0x52, 0x2D, 0x9A, 0x41, 0x91, 0xEC, 0x13, 0x3E, 0xEE,
+    0x90, 0x9B, 0x88, 0x7F, 0x39, 0x53, 0x2E, 0x21, 0xD2, 0xBB, 0x4C, 0x3B, 0x85, 0xB7, 0x6F, 0xAE,
+    0xEE, 0x48, 0xD6, 0xC4, 0x52, 0x9A, 0xA9, 0xB5, 0x40, 0x71, 0xFD, 0x0C, 0xAC, 0x86, 0x42, 0xA2,
+    0x7D, 0xF8, 0x2F, 0x8B, 0xDD, 0x5E, 0xF8, 0xC0, 0x06, 0xAD, 0x19, 0xE0, 0xBE, 0x0D, 0x9D, 0x9F,
+    0x2C, 0x06, 0xD3, 0xDB, 0xAF, 0x16, 0xD2, 0x54, 0x4A, 0xD1, 0x92, 0xA1, 0x5C, 0x62, 0x9F, 0x8C,
+    0x98, 0x0A, 0x17, 0x74, 0xD2, 0x07, 0x0F, 0x4C, 0xD0, 0x2C, 0x2D, 0x38, 0xAD, 0x2B, 0xF4, 0x7A,
+    0x7F, 0xA2, 0x5A, 0x6A, 0xC1, 0x35, 0x7C, 0xC6, 0x25, 0xC2, 0x44, 0x0B, 0x02, 0x0B, 0x50, 0x27,
+    0xFC, 0x4C, 0x0B, 0x63, 0x47, 0xA6, 0xCA, 0xB8, 0x95, 0x3E, 0xE1, 0x25, 0x0D, 0xB4, 0x3A, 0x92,
+    0xFE, 0x09, 0x7A, 0xBD, 0x1B, 0xA1, 0x5D, 0xAF, 0x5D, 0x34, 0xE9, 0xE6, 0x6C, 0x36, 0xB2, 0x9D,
+    0x3C, 0xD5, 0xCC, 0x57, 0x8B, 0x05, 0x17, 0xAF, 0xF1, 0xE5, 0x5C, 0x4B, 0x8A, 0x92, 0xD6, 0xE6,
+    0x15, 0xA3, 0x75, 0x08, 0xA7, 0x2C, 0x48, 0xBB, 0xF0, 0xC9, 0xE2, 0x48, 0xCD, 0x2C, 0x96, 0x8D,
+    0xBE, 0x79, 0x82, 0x1F, 0xF5, 0x8E, 0xD3, 0xC4, 0x6D, 0xF0, 0x03, 0x45, 0x82, 0xE7, 0xC0, 0xCD,
+    0x54, 0x12, 0xD2, 0xFC, 0xD4, 0xFE, 0x22, 0x3E, 0x62, 0x9C, 0x32, 0xCE, 0xC8, 0xA2, 0xA3, 0x0E,
+    0xC2, 0x4F, 0x56, 0x1F, 0x61, 0x81, 0x4A, 0xDF, 0xD9, 0xEC, 0xD2, 0xCE, 0x9F, 0x82, 0x5E, 0x5F,
+    0x8C, 0xF4, 0xD2, 0x44, 0xDF, 0x29, 0x11, 0xF0, 0x99, 0x16, 0xB7, 0xE1, 0x3B, 0x44, 0x15, 0x09,
+    0xB1, 0x9C, 0x69, 0x66, 0x16, 0x7C, 0xB2, 0x51, 0xF2, 0xEF, 0x8C, 0x3B, 0xA5, 0x24, 0x08, 0x52,
+    0xA4, 0xD6, 0xFB, 0x33, 0xF4, 0x7F, 0x90, 0x4E, 0xBD, 0x70, 0x19, 0xA6, 0x67, 0x0C, 0x7F, 0x1F,
+    0xAC, 0x48, 0x23, 0x01, 0x37, 0x2F, 0x21, 0xFC, 0x5B, 0x67, 0xCE, 0x69, 0xF8, 0x9B, 0x7E, 0xDD,
+    0x5C, 0x70, 0xEF, 0xEB, 0x20, 0x80, 0xFA, 0xB7, 0xFC, 0xE4, 0x36, 0x9A, 0xC1, 0xCF, 0x3C, 0x4F,
+    0x4F, 0xB1, 0xB8, 0x95, 0x2A, 0xFA, 0x68, 0x4C, 0xC8, 0xEA, 0x56, 0xAA, 0xC9, 0x4F, 0x84, 0x6E,
+    0x84, 0xEC, 0x32, 0x75, 0xF2, 0x89, 0x30, 0x8C, 0x43, 0xB1, 0x41, 0xB1, 0x98, 0x4F, 0x71, 0xDB,
+    0x01, 0xAF, 0x4E, 0xDB, 0x75, 0xDC, 0x8C, 0xEF, 0xB8, 0x45, 0x39, 0xE3, 0x3B, 0xAE, 0x52, 0x26,
+    0xFC, 0xC0, 0xF3, 0x94, 0x09, 0x1F, 0x09, 0x94, 0x2B, 0x7E, 0x22, 0x74, 0x07, 0x53, 0x58, 0xE4,
+    0x53, 0x2A, 0xA1, 0x1F, 0x0E, 0x80, 0xE6, 0x3F, 0x24, 0xED, 0xFF, 0x3C, 0x97, 0xA9, 0x9C, 0x6B,
+    0xA7, 0x5F, 0xF5, 0x93, 0x7F, 0xF1, 0x53, 0x7E, 0x9D, 0x9F, 0x52, 0xEC, 0x70, 0x65, 0x4C, 0x10,
+    0xD4, 0x9D, 0xFC, 0xCA, 0x69, 0x2B, 0x96, 0x23, 0x61, 0x9D, 0x4C, 0xE0, 0x7D, 0xB4, 0x4F, 0x33,
+    0x18, 0x09, 0x1E, 0xDC, 0xCA, 0x6D, 0x3F, 0x71, 0x2F, 0x74, 0xE4, 0x8D, 0x42, 0x0B, 0xA5, 0x26,
+    0x9C, 0x06, 0x2A, 0x4D, 0xD4, 0xEF, 0x26, 0xFC, 0xF7, 0x33, 0xFE, 0x8D, 0x9D, 0xF6, 0x3B, 0xEA,
+    0xC2, 0xA0, 0x29, 0x74, 0x63, 0x1A, 0x09, 0x19, 0xEE, 0x50, 0x4D, 0x04, 0x8A, 0x95, 0xFA, 0xF1,
+    0x7D, 0xBC, 0xFC, 0x3B, 0x53, 0xCF, 0x04, 0xC8, 0x54, 0x33, 0xA1, 0x43, 0xAB, 0xD3, 0xDC, 0xA8,
+    0x83, 0x72, 0xE7, 0x99, 0x05, 0xF7, 0x13, 0x2D, 0x41, 0x20, 0x29, 0x68, 0x66, 0x9C, 0x1B, 0x75,
+    0x99, 0x30, 0x95, 0xA2, 0xA1, 0x99, 0x18, 0xA9, 0xA3, 0x4F, 0x84, 0xCE, 0xCD, 0x6E, 0xC1, 0x47,
+    0xD6, 0x32, 0x53, 0xCF, 0xDC, 0x67, 0xB3, 0x1C, 0x72, 0x4F, 0xB9, 0xD2, 0xC4, 0x30, 0xB0, 0x51,
+    0xCF, 0xCD, 0x44, 0x8F, 0x5B, 0xEA, 0x44, 0x18, 0x8A, 0xEC, 0x56, 0x9A, 0x88, 0x8A, 0x7C, 0xE0,
+    0x59, 0x8A, 0xEB, 0x14, 0xFF, 0x53, 0x33, 0x41, 0x1A, 0x9C, 0xBE, 0x90, 0xE9, 0x87, 0x3A, 0xFA,
+    0x99, 0x7B, 0x64, 0xA3, 0x9C, 0xB2, 0x5B, 0x68, 0x62, 0xE8, 0xCA, 0xB5, 0x4A, 0x84, 0x4E, 0x54,
+    0xC9, 0xCF, 0x8C, 0xE5, 0x86, 0x4F, 0x21, 0xB2, 0xBB, 0x4C, 0x33, 0x8D, 0x83, 0xDB, 0xA0, 0x18,
+    0x67, 0x18, 0x35, 0xD1, 0xBF, 0xA3, 0xCE, 0x4F, 0xC5, 0xEA, 0x12, 0x3E, 0xBE, 0x04, 0xD9, 0x47,
+    0xFC, 0xB7, 0x17, 0xC8, 0x2D, 0xB4, 0x2F, 0x24, 0xCB, 0xBA, 0xEF, 0x6E, 0xBF, 0x31, 0xC6, 0x56,
+    0x4A, 0x48, 0x1B, 0x95, 0x76, 0xA8, 0xF7, 0x0E, 0xF8, 0xF8, 0x95, 0xB7, 0xA0, 0xFC, 0x91, 0x32,
+    0xD4, 0xEF, 0xBE, 0x97, 0x21, 0xAC, 0x2C, 0xA0, 0xC1, 0xCD, 0x54, 0x2B, 0xF5, 0x40, 0x1B, 0xB9,
+    0x06, 0x3B, 0x2C, 0xB8, 0x95, 0x2A, 0xD2, 0x4C, 0x04, 0x18, 0x63, 0xB9, 0xE0, 0x34, 0xB5, 0xD1,
+    0xC8, 0x57, 0xCB, 0xCD, 0xD6, 0x3F, 0xD1, 0x0E, 0xE1, 0x37, 0x34, 0x51, 0x64, 0xAE, 0x9F, 0xE0,
+    0x6D, 0x7F, 0x29, 0xC5, 0x7A, 0x29, 0x06, 0xF9, 0xA0, 0xA8, 0x7E, 0xAA, 0x7B, 0x91, 0x4A, 0x3F,
+    0xCA, 0xB4, 0xEF, 0xBF, 0xB7, 0xB0, 0xD3, 0xA7, 0x72, 0x25, 0xCC, 0x55, 0x22, 0x4C, 0x75, 0x24,
+    0x44, 0x3F, 0xD0, 0x0F, 0x0D, 0x8C, 0x66, 0x21, 0xAF, 0x51, 0xEE, 0x04, 0xEA, 0x4C, 0xB8, 0xD3,
+    0x67, 0xDA, 0x23, 0x27, 0x99, 0x70, 0x7A, 0x2F, 0xC1, 0xF8, 0x07, 0xF3, 0xA9, 0xC8, 0xA0, 0xFE,
+    0x2F, 0xD3, 0x01, 0x70, 0x1A, 0x75, 0xD0, 0x3E, 0x04, 0xFE, 0xD9, 0x23, 0x0A, 0xF2, 0xCC, 0x54,
+    0xBC, 0x2F, 0xBC, 0x32, 0xE1, 0xE1, 0xEF, 0x14, 0x32, 0xCB, 0x75, 0xB0, 0x90, 0xA7, 0x3F, 0x37,
+    0x53, 0xB7, 0x10, 0x29, 0x4F, 0x4C, 0xA4, 0x75, 0xF0, 0xBD, 0xAE, 0x90, 0x62, 0xB1, 0xFD, 0x56,
+    0xC7, 0x72, 0x18, 0x8F, 0x66, 0x38, 0xA8, 0xA7, 0x7E, 0x3F, 0xA2, 0xBF, 0x42, 0x40, 0x1B, 0xAB,
+    0x3B, 0x4D, 0xAA, 0xA4, 0xB5, 0x96, 0xB2, 0x93, 0x32, 0xCF, 0xE8, 0x2D, 0x6B, 0xC3, 0x67, 0xE1,
+    0x36, 0xB4, 0x1D, 0x3E, 0x52, 0xCD, 0x18, 0x3F, 0x4C, 0x7F, 0x3E, 0x94, 0x28, 0x57, 0xD8, 0xA0,
+    0x87, 0x76, 0xC0, 0x4F, 0x54, 0x0B, 0xA5, 0x36, 0xA4, 0x2E, 0x68, 0xF2, 0x5A, 0x28, 0x16, 0xEA,
+    0xA9, 0x85, 0xEC, 0x12, 0x3E, 0x06, 0x8A, 0xB5, 0x9A, 0x69, 0xBB, 0xFB, 0xB8, 0x54, 0x47, 0x7A,
+    0x32, 0xF5, 0xEC, 0x07, 0xB6, 0x62, 0xA5, 0x9D, 0xDA, 0x58, 0xE7, 0x52, 0x52, 0x6C, 0x0F, 0x32,
+    0xA3, 0x6B, 0xF4, 0x93, 0x44, 0xBF, 0xF6, 0xE7, 0x0A, 0x08, 0xF7, 0xE6, 0x0C, 0x39, 0x40, 0xEB,
+    0x16, 0xAA, 0xA9, 0x1D, 0x58, 0x8B, 0x4C, 0xC0, 0xC7, 0x7A, 0x62, 0x2B, 0x56, 0xFC, 0x1C, 0x60,
+    0xF4, 0x91, 0xEA, 0xAF, 0x16, 0xE8, 0x1F, 0x40, 0xA5, 0x68, 0x94, 0x44, 0xA5, 0xCE, 0x68, 0xFB,
+    0x1E, 0xA8, 0x7F, 0x98, 0x81, 0x50, 0x25, 0x70, 0x6B, 0x13, 0xA1, 0x89, 0x3D, 0xBF, 0xC8, 0x5E,
+    0xE4, 0x72, 0xA9, 0x52, 0x95, 0xDA, 0x14, 0x86, 0xE6, 0x3B, 0xFA, 0x6E, 0xA6, 0x6F, 0xF5, 0x67,
+    0x73, 0xB1, 0x4B, 0x23, 0xD5, 0x91, 0xDF, 0x7D, 0x57, 0x91, 0x3E, 0x87, 0x8D, 0x42, 0x51, 0x89,
+    0x7A, 0x2B, 0xD5, 0xD1, 0x4E, 0x55, 0x36, 0x54, 0xD3, 0x0E, 0xB4, 0xB1, 0x9E, 0x29, 0x36, 0xB7,
+    0x82, 0x9F, 0x77, 0xA0, 0xEF, 0x3B, 0x0B, 0x54, 0x0E, 0x1A, 0xB1, 0xDC, 0xB1, 0x40, 0xE5, 0x40,
+    0xAC, 0xF5, 0x4F, 0x32, 0x94, 0x5B, 0x3B, 0x81, 0xBE, 0x20, 0x08, 0x93, 0xC5, 0x95, 0xE3, 0x60,
+    0x89, 0x5E, 0xFC, 0x80, 0x8F, 0x64, 0x1B, 0x51, 0x02, 0x3C, 0xA0, 0x9E, 0xA8, 0x12, 0x19, 0x02,
+    0xA1, 0xC3, 0xAD, 0x55, 0x82, 0x36, 0x6E, 0x50, 0xE4, 0x36, 0x82, 0x7F, 0x73, 0x01, 0x34, 0x9E,
+    0x81, 0x75, 0x9F, 0xCF, 0xD1, 0x80, 0xD1, 0x63, 0x06, 0x8B, 0xE3, 0xC9, 0x4E, 0x57, 0xE2, 0x18,
+    0xAE, 0xA0, 0x74, 0x4A, 0x89, 0xF4, 0x1B, 0x50, 0xBF, 0x75, 0xF0, 0x33, 0xC6, 0x52, 0x1E, 0x5F,
+    0x87, 0x3E, 0xF5, 0xC3, 0x91, 0x55, 0x6E, 0xD2, 0x91, 0xE0, 0x77, 0xDB, 0x29, 0x34, 0x1F, 0xE3,
+    0xC9, 0x11, 0xEC, 0x77, 0x5F, 0xA5, 0x3D, 0x5C, 0xF8, 0x4A, 0x6F, 0xF7, 0xD7, 0x3B, 0xF4, 0x99,
+    0xC2, 0x72, 0xEF, 0xB8, 0x64, 0x20, 0xD1, 0x1F, 0x26, 0xBA, 0x8D, 0x86, 0x42, 0x7B, 0x4B, 0xAB,
+    0x86, 0xC5, 0xC2, 0xB6, 0x71, 0x32, 0x18, 0xE9, 0x92, 0xED, 0xEB, 0xF9, 0xB0, 0xE6, 0xD1, 0x20,
+    0x67, 0xE8, 0x8E, 0x18, 0x4A, 0x96, 0xE0, 0xB8, 0xB2, 0x01, 0xC5, 0xC4, 0x55, 0x5C, 0xE4, 0x6B,
+    0xD4, 0x1D, 0x89, 0x67, 0x29, 0x8F, 0x03, 0xDF, 0xC2, 0x73, 0x71, 0xA0, 0x1A, 0x78, 0xDD, 0x0E,
+    0x3C, 0x87, 0x8B, 0xA7, 0x03, 0x80, 0x26, 0x23, 0x7A, 0xEB, 0xA3, 0xA6, 0xC9, 0x2D, 0x97, 0x5E,
+    0x3E, 0x5D, 0x6A, 0x40, 0xB4, 0x44, 0x46, 0x93, 0x2D, 0x81, 0xDC, 0xAC, 0x06, 0x8B, 0x4F, 0xE5,
+    0x50, 0xE9, 0xD1, 0xDB, 0x9A, 0x08, 0x7D, 0x47, 0xD8, 0x2D, 0x76, 0x1A, 0x07, 0x28, 0x97, 0xAA,
+    0x7C, 0xB7, 0x8C, 0xF3, 0x34, 0xBF, 0xFE, 0x5C, 0xBA, 0x7A, 0x14, 0xE3, 0x70, 0x9D, 0x8F, 0x51,
+    0xC3, 0x4C, 0xA6, 0xA5, 0x1D, 0xDC, 0xE2, 0x16, 0x6E, 0x73, 0x1B, 0x3F, 0x55, 0x33, 0x99, 0x36,
+    0x56, 0x0B, 0x21, 0xFA, 0x85, 0x3E, 0xFA, 0xC4, 0xD8, 0x35, 0x33, 0xF7, 0x68, 0x3B, 0x26, 0x3E,
+    0x6B, 0xF5, 0x3A, 0x1F, 0xE7, 0x63, 0xF0, 0x79, 0xAA, 0x8E, 0xB6, 0x73, 0x33, 0xD5, 0xCC, 0x06,
+    0x1B, 0xED, 0x40, 0x3B, 0xB8, 0x44, 0x35, 0x93, 0xF1, 0xA9, 0xDC, 0x68, 0xE7, 0x6A, 0xA5, 0x1F,
+    0x7C, 0x32, 0x66, 0xED, 0x1E, 0x4D, 0xC7, 0xAF, 0xF1, 0x0B, 0x67, 0xF2, 0xD8, 0xAA, 0x94, 0x2A,
+    0x8B, 0xD8, 0x8E, 0x02, 0xCB, 0xA3, 0x89, 0x4F, 0xDA, 0xFE, 0x5E, 0x91, 0xB2, 0x00, 0x75, 0x77,
+    0x2A, 0x48, 0x3B, 0xC1, 0x61, 0xAB, 0xFB, 0xB2, 0xB2, 0xA9, 0xE2, 0x3F, 0xF2, 0x73, 0x6E, 0x96,
+    0xE9, 0x3A, 0xC8, 0x2C, 0x23, 0x51, 0xCD, 0xA1, 0xBC, 0x1B, 0x01, 0xF7, 0xD7, 0x16, 0xEB, 0x6C,
+    0x40, 0x91, 0x43, 0x07, 0x64, 0x3F, 0x01, 0x0F, 0x4A, 0xAB, 0xE8, 0x7B, 0x00, 0x84, 0xAE, 0x8D,
+    0xA7, 0xF4, 0x71, 0x13, 0x0B, 0xCB, 0x3A, 0x59, 0xD5, 0x6E, 0x33, 0xE1, 0x16, 0xDC, 0x82, 0x93,
+    0x64, 0x20, 0x53, 0x03, 0x16, 0x0C, 0x5B, 0x2C, 0xDC, 0x0F, 0x20, 0x2C, 0x6F, 0xD4, 0xCE, 0xE0,
+    0x53, 0x93, 0x8E, 0x1A, 0x04, 0x4C, 0x76, 0x0F, 0x7A, 0xD2, 0xEA, 0x17, 0x9A, 0x7A, 0x00, 0x3C,
+    0xB7, 0x80, 0x73, 0x5C, 0x75, 0xE1, 0x11, 0xCB, 0x83, 0xE8, 0x35, 0xC7, 0x98, 0x00, 0x6E, 0x67,
+    0x80, 0x60, 0x41, 0xE1, 0x17, 0x27, 0xA0, 0x79, 0xC3, 0x50, 0xD7, 0x06, 0xD4, 0xB3, 0x55, 0x25,
+    0xD4, 0x33, 0xB8, 0xA5, 0xCC, 0xA7, 0xFA, 0xDA, 0x22, 0x1F, 0xF5, 0x33, 0x55, 0x82, 0xD1, 0x14,
+    0xB8, 0x23, 0x74, 0x04, 0x49, 0x33, 0xED, 0x25, 0xC6, 0xCE, 0x4B, 0x52, 0xAC, 0x56, 0xF0, 0xC9,
+    0x2A, 0x8E, 0xCA, 0x1D, 0x50, 0x21, 0xA0, 0xB7, 0x68, 0xFC, 0x48, 0xB0, 0x87, 0x08, 0xA8, 0xD8,
+    0x81, 0x7A, 0xAD, 0x57, 0x20, 0x4C, 0x61, 0xFA, 0xB0, 0xA9, 0xB1, 0xBE, 0xD4, 0x47, 0xA6, 0x22,
+    0x5D, 0x4A, 0xE0, 0x98, 0xFC, 0x99, 0x00, 0x1E, 0x12, 0x68, 0x22, 0x78, 0xC8, 0xA0, 0x09, 0xE1,
+    0x21, 0x85, 0x87, 0x18, 0x9A, 0x1C, 0x1E, 0x82, 0x68, 0x92, 0x78, 0x88, 0xE2, 0x21, 0x8B, 0x26,
+    0x8C, 0x98, 0x34, 0x9A, 0x38, 0x9E, 0xB2, 0xD2, 0x26, 0x90, 0x08, 0x90, 0xD9, 0x90, 0xCC, 0x25,
+    0x99, 0xFC, 0x7B, 0xCB, 0xCF, 0x17, 0xA3, 0xF1, 0xF3, 0xBF, 0x0A, 0xC0, 0x3F, 0xE1, 0x22, 0xEB,
+    0xCC, 0x3F, 0x32, 0xA9, 0xE9, 0x00, 0x5E, 0x1B, 0x2E, 0xC8, 0xDD, 0x23, 0xB0, 0xB4, 0xA0, 0xA0,
+    0xBC, 0xD4, 0x46, 0x7E, 0xF1, 0xF1, 0xF9, 0x29, 0x5E, 0xA4, 0x94, 0x64, 0xE1, 0x63, 0x67, 0xAE,
+    0xA1, 0xD8, 0x38, 0x65, 0x1B, 0x2C, 0x4E, 0xB5, 0x07, 0x59, 0x0D, 0x78, 0xE8, 0x80, 0x62, 0xBB,
+    0xF1, 0x8D, 0x83, 0xD0, 0x26, 0x1C, 0xC9, 0xA9, 0xED, 0x04, 0xE0, 0x7E, 0x6A, 0xDE, 0x59, 0xD2,
+    0x44, 0x7B, 0xAA, 0xB3, 0x38, 0xD1, 0xEA, 0xD6, 0x6D, 0x80, 0xE2, 0x0E, 0xA7, 0xAA, 0x36, 0x8B,
+    0x9F, 0xEB, 0xE1, 0x14, 0x98, 0x9D, 0x8A, 0x33, 0x7F, 0xD6, 0xED, 0x86, 0x0D, 0xE7, 0x51, 0xB4,
+    0xE2, 0x24, 0x0D, 0x07, 0xE5, 0xBF, 0x5D, 0x18, 0x1B, 0x83, 0x9F, 0x0F, 0x2E, 0xD5, 0x00, 0xFC,
+    0xF9, 0x97, 0x87, 0x23, 0x48, 0x74, 0xD2, 0x7A, 0x94, 0x27, 0x5A, 0x7A, 0xD2, 0xF4, 0xD3, 0x06,
+    0xA6, 0xBF, 0x18, 0xDB, 0x03, 0xD3, 0x4A, 0x1B, 0xE5, 0xA5, 0x2A, 0x81, 0x20, 0xA9, 0x3B, 0xF1,
+    0x49, 0xF0, 0x8F, 0x2F, 0x4A, 0x39, 0xCD, 0x32, 0x5C, 0x7B, 0x09, 0x70, 0xD3, 0x73, 0xC0, 0xE7,
+    0xA8, 0x2F, 0xDA, 0xFD, 0x89, 0xBF, 0x5F, 0x53, 0x92, 0xAD, 0x9E, 0xB8, 0xCC, 0xE0, 0xB2, 0xCB,
+    0x50, 0xE5, 0x7A, 0x05, 0xBF, 0xFA, 0xF5, 0xC9, 0xE3, 0xFE, 0x89, 0xEB, 0x47, 0xFB, 0x9D, 0xA4,
+    0xE9, 0x18, 0x78, 0x6B, 0x87, 0x75, 0xE0, 0xB4, 0xA8, 0xE0, 0xA2, 0x4A, 0xC3, 0xAC, 0x63, 0x7F,
+    0xE3, 0x77, 0x39, 0x86, 0xDE, 0xCA, 0x34, 0xAC, 0x0B, 0xD6, 0x77, 0x1B, 0x7B, 0x9B, 0x23, 0xEB,
+    0x43, 0x7D, 0x89, 0x80, 0x69, 0xCE, 0xDA, 0x63, 0xD6, 0xED, 0xF4, 0x7D, 0xD0, 0xBB, 0x4F, 0x59,
+    0x0E, 0xD1, 0xC0, 0x20, 0xDC, 0x1C, 0x3E, 0xD8, 0x6A, 0xB7, 0x42, 0x88, 0x54, 0x2B, 0x8C, 0x96,
+    0x8C, 0xD0, 0xE3, 0x49, 0x8A, 0x70, 0x71, 0x7C, 0xA6, 0xD8, 0xA1, 0x9D, 0x70, 0xF9, 0x62, 0xE9,
+    0x46, 0x87, 0x5F, 0x28, 0x8D, 0xEC, 0xAC, 0x76, 0x4E, 0x85, 0x00, 0x4F, 0x1F, 0x85, 0x99, 0xF5,
+    0x60, 0xDE, 0xCE, 0x4D, 0xE7, 0x02, 0xE1, 0x9F, 0x61, 0xF3, 0xB3, 0x29, 0x6F, 0xB1, 0x1F, 0x54,
+    0x61, 0x1B, 0xCD, 0xDD, 0xBB, 0xE5, 0x90, 0x82, 0xF1, 0x98, 0x60, 0x3F, 0x1D, 0xD5, 0x68, 0xF9,
+    0x98, 0xDA, 0x7E, 0x30, 0x13, 0xE4, 0x8F, 0x83, 0x66, 0xD2, 0x3B, 0x4B, 0x42, 0xB7, 0xC9, 0x4C,
+    0x59, 0xB5, 0x43, 0x61, 0x66, 0xE3, 0xD5, 0x23, 0x4C, 0xDF, 0xA0, 0xFE, 0xC1, 0xC0, 0xB3, 0x45,
+    0xE2, 0xF3, 0x7C, 0xFA, 0x03, 0xA3, 0xE4, 0xB2, 0xD1, 0x45, 0xF5, 0x62, 0xEF, 0xF3, 0xE9, 0x02,
+    0x48, 0xB5, 0xF1, 0x00, 0x7E, 0x9D, 0xB5, 0x4B, 0xD6, 0x94, 0x0F, 0x14, 0xB3, 0xAE, 0x66, 0x16,
+    0xFD, 0x62, 0x0D, 0x09, 0xC9, 0x02, 0xA7, 0x9B, 0x33, 0x50, 0x4F, 0xF5, 0xC4, 0xC6, 0x46, 0x3B,
+    0xB5, 0xD1, 0x65, 0x97, 0x19, 0xE3, 0x18, 0x3F, 0x64, 0x78, 0xDC, 0x7A, 0x14, 0x42, 0x54, 0xEB,
+    0x31, 0x3E, 0x67, 0xB2, 0xFF, 0x9C, 0x25, 0x3C, 0xD7, 0x02, 0x84, 0x47, 0x4E, 0xCF, 0xC7, 0xA0,
+    0x9E, 0x6B, 0xEF, 0x42, 0x3C, 0xEC, 0xBA, 0x3A, 0x6B, 0x5A, 0xA9, 0xC3, 0x69, 0x55, 0x3B, 0xE7,
+    0xE9, 0x84, 0xEB, 0x45, 0x07, 0xB8, 0xEC, 0x3A, 0xA0, 0xFE, 0xB7, 0x15, 0x80, 0xAF, 0x3C, 0xC0,
+    0xB3, 0x86, 0xE8, 0x3F, 0xCD, 0xA3, 0x18, 0xA6, 0xF8, 0x06, 0x7C, 0xC2, 0x8A, 0x56, 0xC7, 0x33,
+    0x33, 0x5F, 0x2D, 0x14, 0x8A, 0xC6, 0xCC, 0x4F, 0xF8, 0x19, 0xF7, 0x01, 0x66, 0x3E, 0x0C, 0xF8,
+    0x47, 0x99, 0xF9, 0x3F, 0xFD, 0xF9, 0x99, 0xF9, 0x76, 0xA2, 0xFE, 0x79, 0x98, 0xF9, 0x23, 0x8F,
+    0x7B, 0x14, 0xA6, 0x9F, 0x4A, 0xD9, 0x8F, 0xBC, 0xE6, 0x6B, 0xDD, 0x87, 0x4A, 0xEA, 0x3F, 0x48,
+    0x46, 0x1F, 0xF8, 0xE4, 0x45, 0xEE, 0xEF, 0x54, 0x17, 0x7E, 0x72, 0x35, 0xC7, 0xAA, 0x80, 0xA6,
+    0xE3, 0x6F, 0xB3, 0xFD, 0xC3, 0x1C, 0x90, 0x03, 0x8F, 0x1E, 0xF3, 0x7E, 0xAC, 0x32, 0xF3, 0xBF,
+    0xDD, 0x01, 0x3C, 0x5F, 0xCE, 0x00, 0x7F, 0xC2, 0xD5, 0x7F, 0xF0, 0xDD, 0x6C, 0x62, 0x13, 0x2F,
+    0xF0, 0xEC, 0x41, 0xAF, 0x8E, 0x83, 0x2D, 0x6B, 0xEA, 0xD4, 0xFD, 0xFF, 0x26, 0xE5, 0x17, 0x11,
+    0xE3, 0x69, 0xC9, 0x92, 0xE1, 0xD5, 0x03, 0x18, 0x7E, 0x48, 0xE8, 0x88, 0x3A, 0xAA, 0x8D, 0x66,
+    0x81, 0x31, 0x96, 0x56, 0x35, 0x17, 0x66, 0xD0, 0xE0, 0x36, 0x68, 0x12, 0x7D, 0xA4, 0x14, 0x75,
+    0x86, 0x30, 0xA3, 0x0E, 0x67, 0x95, 0x22, 0x7D, 0x44, 0x50, 0xAF, 0x34, 0x33, 0x8C, 0x5D, 0x69,
+    0x85, 0xFB, 0x21, 0xC2, 0x6E, 0x55, 0xC6, 0x13, 0x7D, 0x87, 0xCB, 0x96, 0x48, 0xB3, 0x8B, 0x17,
+    0xBC, 0x79, 0x57, 0x75, 0x84, 0x44, 0xB3, 0xDF, 0x18, 0x37, 0xE3, 0x17, 0x23, 0x8D, 0x15, 0x1E,
+    0x1B, 0x54, 0xAE, 0x8D, 0x0F, 0xB5, 0xDA, 0xF2, 0xCB, 0x5B, 0xBA, 0xB4, 0x3E, 0xE8, 0x58, 0x10,
+    0xB4, 0x5C, 0x5A, 0x72, 0x73, 0x65, 0xF8, 0x79, 0x35, 0xF8, 0x6E, 0xC7, 0x95, 0x6F, 0x7E, 0x68,
+    0xEF, 0x97, 0x47, 0x7B, 0x3F, 0x3E, 0xD6, 0xFB, 0xEA, 0xDC, 0xFB, 0xED, 0xDC, 0x7B, 0x5D, 0xEA,
+    0x7D, 0xF9, 0x91, 0xF6, 0xDE, 0x62, 0xEA, 0x63, 0xA9, 0x90, 0xC5, 0x99, 0xD5, 0x1B, 0x33, 0x50,
+    0xA4, 0x2A, 0x02, 0xBF, 0xC2, 0x95, 0xBF, 0x65, 0xB7, 0x86, 0x53, 0xB7, 0xC2, 0xDF, 0x41, 0xB7,
+    0xAE, 0x71, 0x1B, 0x8C, 0x2E, 0x81, 0xDD, 0xFC, 0xF5, 0xDC, 0xCE, 0xE0, 0xB6, 0x4B, 0x6B, 0x04,
+    0x9F, 0x24, 0xB8, 0x03, 0x95, 0xF1, 0x29, 0x3F, 0x55, 0x70, 0xD7, 0x0F, 0x08, 0x6E, 0xF1, 0x77,
+    0x20, 0xB8, 0xB6, 0x10, 0x20, 0x74, 0x07, 0x48, 0xAF, 0x2E, 0x23, 0xEB, 0x8F, 0x92, 0x4E, 0x85,
+    0x62, 0x06, 0xAE, 0x1E, 0x88, 0xB4, 0x4C, 0x87, 0xDF, 0x7B, 0xFA, 0x43, 0x35, 0xE3, 0xA3, 0x7D,
+    0xFB, 0x1D, 0x8E, 0x75, 0x95, 0x6E, 0x03, 0xFC, 0x7F, 0x18, 0xE0, 0xB9, 0x62, 0x86, 0xAF, 0x5A,
+    0x8A, 0xEC, 0x48, 0xE2, 0x94, 0xDA, 0x12, 0x5E, 0x9A, 0x09, 0x53, 0x3B, 0xD3, 0xE3, 0x27, 0x56,
+    0x7C, 0x2C, 0x13, 0x3E, 0xBA, 0x09, 0x1F, 0xAB, 0x48, 0x33, 0xF8, 0x81, 0x30, 0xF8, 0x8E, 0xB1,
+    0xF3, 0x83, 0x13, 0xFE, 0xC7, 0xAF, 0xD9, 0xDA, 0x52, 0x6A, 0x2B, 0x05, 0xDE, 0x6F, 0xC3, 0xF8,
+    0xD6, 0x4B, 0xC0, 0x7D, 0xEE, 0x53, 0x6C, 0x45, 0xA6, 0xCC, 0x2E, 0xE3, 0x72, 0x95, 0xA9, 0xB3,
+    0x7F, 0x64, 0xD5, 0xC9, 0xFF, 0x93, 0xF7, 0xFE, 0xFC, 0x3C, 0x72, 0x29, 0x4D, 0x4E, 0x8A, 0xC5,
+    0xB8, 0xC1, 0x70, 0x58, 0xEC, 0xDF, 0x83, 0x22, 0xC2, 0xB3, 0x10, 0x66, 0xAB, 0x8D, 0xBD, 0xF0,
+    0xD0, 0x4D, 0x3C, 0x22, 0x80, 0x32, 0x7F, 0x38, 0x0E, 0xF9, 0x68, 0x49, 0xDF, 0x74, 0x8A, 0xCA,
+    0x6F, 0x9D, 0x12, 0x77, 0xE1, 0x58, 0xD0, 0xF3, 0x73, 0x6C, 0xCF, 0xAC, 0x50, 0x29, 0xC3, 0xD8,
+    0x5D, 0xA5, 0x9A, 0xF9, 0x2A, 0x2F, 0x41, 0x72, 0xF3, 0x53, 0xAF, 0xC5, 0x56, 0x12, 0x92, 0xD6,
+    0xEA, 0xED, 0xEB, 0x46, 0x0E, 0xDA, 0xC2, 0xB5, 0xD5, 0x16, 0x0F, 0x5D, 0xA1, 0x91, 0x56, 0xC2,
+    0x11, 0x62, 0x1F, 0x39, 0x1B, 0xB3, 0x6E, 0x81, 0x83, 0x54, 0xF1, 0xBF, 0xDD, 0xC1, 0x52, 0x0F,
+    0xD4, 0xB8, 0xC7, 0x65, 0xBB, 0x18, 0x07, 0x1B, 0x8F, 0x7A, 0x71, 0x91, 0xDB, 0x54, 0x5D, 0x35,
+    0xE1, 0xB9, 0xC6, 0x97, 0x73, 0x29, 0x99, 0xE4, 0x0E, 0xB7, 0x6F, 0x1C, 0xEA, 0xE1, 0xE3, 0x29,
+    0x7E, 0x1E, 0x27, 0x7E, 0xA7, 0x38, 0x16, 0x27, 0x6C, 0x38, 0x29, 0x51, 0x8C, 0x0F, 0x2D, 0x17,
+    0xD0, 0x83, 0x10, 0xC5, 0x5E, 0xEC, 0xB8, 0xDD, 0xED, 0x7F, 0x93, 0x79, 0xBA, 0x39, 0x1F, 0xDD,
+    0x6F, 0x27, 0x0F, 0xB7, 0xA9, 0xBA, 0x62, 0xC1, 0x45, 0x37, 0x3F, 0xF5, 0x5A, 0xAC, 0x25, 0x45,
+    0x2F, 0x69, 0x68, 0x5E, 0xE9, 0x8E, 0x01, 0x08, 0xE7, 0x28, 0xBE, 0x5D, 0xF8, 0xA4, 0x8D, 0x80,
+    0x3F, 0xD2, 0x1A, 0xC9, 0xA6, 0xA6, 0x4C, 0x47, 0x9A, 0xB2, 0x5A, 0x28, 0x7E, 0xE7, 0xFC, 0xA6,
+    0xE7, 0xB0, 0xF5, 0x6F, 0xCF, 0xC1, 0x82, 0x3B, 0x8A, 0x27, 0xDD, 0x44, 0x0B, 0x19, 0x97, 0x68,
+    0x07, 0x36, 0xDC, 0x62, 0x82, 0xE4, 0x22, 0x2C, 0xF0, 0x9C, 0xB9, 0xCF, 0x05, 0x3E, 0xF3, 0xE1,
+    0x5D, 0x28, 0x67, 0x78, 0xDE, 0x2E, 0xBC, 0x67, 0xE6, 0x24, 0x41, 0x63, 0xD0, 0xF9, 0x38, 0x9E,
+    0xC1, 0x47, 0x4A, 0x0B, 0x9D, 0x4F, 0x95, 0x5F, 0x5C, 0xB5, 0x00, 0x5E, 0x91, 0x6B, 0x4D, 0x57,
+    0x0F, 0xCF, 0x71, 0x87, 0x5F, 0x7E, 0xC2, 0x03, 0x87, 0x9F, 0xF5, 0x81, 0x65, 0x72, 0xA9, 0x89,
+    0x4D, 0x14, 0xAA, 0x72, 0x95, 0x43, 0x0A, 0x1F, 0xC8, 0x13, 0x7D, 0xEB, 0x03, 0x2B, 0x99, 0xBD,
+    0xAD, 0xA7, 0x75, 0xB3, 0x35, 0xFD, 0x9E, 0xA9, 0x93, 0x8F, 0xA6, 0x9F, 0x87, 0x52, 0xF6, 0xA7,
+    0x78, 0x0F, 0x0A, 0x95, 0x11, 0x7E, 0x34, 0xCD, 0xF0, 0xD5, 0x36, 0xC1, 0xD5, 0xF2, 0x09, 0xBC,
+    0x7A, 0x71, 0x1D, 0xAA, 0x3F, 0xD4, 0x70, 0x64, 0x8E, 0x34, 0xF5, 0xD0, 0x0F, 0x75, 0x24, 0x0C,
+    0x46, 0xD8, 0x67, 0xAA, 0x44, 0x38, 0x86, 0x7B, 0xA3, 0x9E, 0xE9, 0x71, 0x0B, 0x21, 0x1A, 0x2B,
+    0x3C, 0x52, 0x2F, 0x84, 0x68, 0x35, 0x66, 0xA2, 0x5A, 0x30, 0x76, 0x17, 0x5E, 0xFC, 0xA0, 0xBE,
+    0xFF, 0xA7, 0x0F, 0x9B, 0x98, 0x8F, 0x8C, 0x0B, 0xB6, 0x15, 0xDD, 0x8F, 0xAA, 0xFA, 0xB5, 0x4B,
+    0xAB, 0xA3, 0x7F, 0xD6, 0x30, 0xE8, 0x58, 0x1C, 0x59, 0xE8, 0x8F, 0x37, 0xFC, 0x54, 0xAC, 0x64,
+    0x5C, 0xAA, 0x26, 0x7C, 0x0C, 0x10, 0x8A, 0x05, 0x72, 0x1D, 0xA9, 0xA7, 0x00, 0x81, 0x0D, 0xB7,
+    0xBA, 0xFD, 0xC6, 0x18, 0x6B, 0x59, 0x75, 0xC5, 0x44, 0xA3, 0xF5, 0xDC, 0xA4, 0xA7, 0x4F, 0x6B,
+    0xED, 0xCB, 0x1D, 0x68, 0x6E, 0x02, 0xC9, 0x77, 0xF8, 0x83, 0x4D, 0xB8, 0xB4, 0x5D, 0xB1, 0x25,
+    0x4C, 0x13, 0xCD, 0x7B, 0xE3, 0xC4, 0x46, 0x33, 0xF8, 0x48, 0xE0, 0x25, 0xA3, 0x42, 0x5D, 0x6A,
+    0x3A, 0x7C, 0xBC, 0x07, 0xF7, 0x5D, 0xC2, 0x25, 0x3F, 0x11, 0x86, 0xF0, 0xF6, 0x57, 0x32, 0xE3,
+    0x69, 0xF9, 0x73, 0x61, 0x8B, 0xA0, 0xDE, 0xB2, 0x04, 0xE1, 0x03, 0xD8, 0xD9, 0x29, 0xB7, 0x72,
+    0x33, 0xE5, 0xAE, 0x72, 0xF5, 0xE1, 0x26, 0xD7, 0x26, 0xA1, 0xD6, 0x06, 0xFD, 0x3B, 0xEA, 0xD8,
+    0x68, 0x06, 0x97, 0xF0, 0xB1, 0x9A, 0xF0, 0xD1, 0x47, 0x7C, 0x6C, 0x3A, 0x73, 0xA2, 0x6D, 0x17,
+    0x0E, 0xFE, 0x70, 0x27, 0xBC, 0xFD, 0x95, 0x4C, 0x7B, 0xE4, 0xFE, 0x26, 0x9B, 0x0B, 0x6B, 0x41,
+    0xD1, 0x9D, 0x96, 0x8C, 0xEF, 0x27, 0x5B, 0xF8, 0xCC, 0x63, 0x62, 0xFE, 0x91, 0x32, 0xBD, 0x40,
+    0x39, 0x1C, 0xC6, 0xFE, 0xB9, 0x13, 0x9C, 0x5E, 0x78, 0xF2, 0x7F, 0x93, 0x78, 0x74, 0x6B, 0x3A,
+    0xEE, 0x97, 0xD6, 0x04, 0xB2, 0x4B, 0x34, 0xC3, 0x6D, 0xCA, 0xA5, 0x9E, 0x08, 0xDC, 0xA3, 0x4A,
+    0x3E, 0xF2, 0x80, 0x15, 0x3F, 0x35, 0x43, 0xB9, 0x95, 0x99, 0x31, 0xB6, 0x52, 0x2E, 0x25, 0x0D,
+    0xAD, 0xB4, 0x14, 0x52, 0x4F, 0xA5, 0xDF, 0x3F, 0xC9, 0xD8, 0x2F, 0x9F, 0xD0, 0x91, 0x3A, 0x08,
+    0xB7, 0xA1, 0x1E, 0x6E, 0x51, 0x4C, 0x07, 0xAD, 0xF2, 0x91, 0xBE, 0xCB, 0x2D, 0x6E, 0xA1, 0x99,
+    0x9A, 0x88, 0x90, 0xCD, 0xAF, 0x61, 0xCD, 0x0F, 0x8C, 0x72, 0x1D, 0x09, 0x56, 0x48, 0x92, 0xA9,
+    0xE6, 0x6A, 0xA6, 0xED, 0xDA, 0x8E, 0xCC, 0x3D, 0xAA, 0xE4, 0x12, 0xED, 0xE0, 0x07, 0x36, 0x6E,
+    0x53, 0x2F, 0x65, 0x66, 0x8C, 0xB5, 0x24, 0xAB, 0x45, 0x18, 0xA5, 0xA9, 0x90, 0x7A, 0x0A, 0xFD,
+    0xF0, 0x42, 0x7A, 0x6E, 0xEE, 0x03, 0x7C, 0xA2, 0xE3, 0xF8, 0x57, 0x2C, 0xD9, 0x02, 0x4B, 0x4B,
+    0x58, 0x5B, 0xCD, 0xF7, 0x6C, 0xD1, 0xE5, 0x74, 0x20, 0x5B, 0x33, 0x0A, 0x61, 0x3E, 0xEA, 0x49,
+    0xAB, 0x7C, 0xE2, 0x17, 0xC4, 0x51, 0x81, 0xD0, 0x4C, 0xC7, 0x4A, 0xDB, 0x32, 0x03, 0x7A, 0xFB,
+    0x5F, 0x98, 0xFB, 0x68, 0xA4, 0x48, 0x95, 0xA0, 0x94, 0xF2, 0x91, 0x3A, 0x94, 0x06, 0xCB, 0x32,
+    0xEA, 0x24, 0x5E, 0xE3, 0x69, 0xD9, 0xBD, 0xF1, 0x1E, 0xEA, 0x0E, 0x36, 0xCA, 0xEF, 0x14, 0xE3,
+    0xCA, 0xE9, 0x7F, 0xC7, 0x58, 0xC1, 0xA8, 0x6C, 0xE9, 0x15, 0xBD, 0xFD, 0x35, 0x1B, 0x41, 0x26,
+    0xED, 0x47, 0xAD, 0xA0, 0x34, 0xC3, 0x15, 0xBD, 0x67, 0x87, 0xCE, 0x60, 0xEB, 0x99, 0x9D, 0xA0,
+    0x89, 0x5A, 0x7B, 0xF3, 0x96, 0xA7, 0xDA, 0x5F, 0x7B, 0x7F, 0xE6, 0xF3, 0x6C, 0x34, 0x2B, 0x2E,
+    0x06, 0x10, 0xBF, 0x74, 0xAF, 0x9A, 0xF0, 0x92, 0xA2, 0x55, 0x93, 0xE4, 0xA6, 0xA3, 0xF9, 0xF3,
+    0x8E, 0x32, 0x19, 0x86, 0x0C, 0x07, 0x5C, 0x59, 0xF0, 0x2B, 0x10, 0xDE, 0xFE, 0x8A, 0x16, 0x3E,
+    0x79, 0xBC, 0x7D, 0xF0, 0xD2, 0xF7, 0xA5, 0x85, 0x5E, 0xA9, 0x95, 0x60, 0x7C, 0x8B, 0x9B, 0x7B,
+    0xC7, 0x67, 0xEE, 0xDE, 0xBD, 0xFB, 0x8D, 0x20, 0xAB, 0xA4, 0xB0, 0x15, 0x07, 0x7C, 0xE6, 0xEE,
+    0xDD, 0xBB, 0x77, 0xEF, 0xDE, 0xFD, 0xBA, 0xDD, 0xB9, 0xDA, 0x24, 0x9C, 0x33, 0x00, 0x63, 0xF4,
+    0x6B, 0x29, 0xC2, 0x54, 0xAF, 0x88, 0x26, 0x1D, 0x9C, 0xFD, 0xEC, 0x33, 0xEA, 0xDA, 0xE4, 0x36,
+    0xFA, 0xE8, 0x93, 0x91, 0x76, 0xE3, 0x1B, 0x22, 0xFC, 0x50, 0x5D, 0x9B, 0x14, 0xFD, 0x12, 0x62,
+    0xBD, 0xB6, 0x93, 0xCB, 0x3E, 0x15, 0xAA, 0x57, 0xF4, 0x82, 0x21, 0x82, 0xFE, 0x87, 0xEA, 0x82,
+    0x5D, 0x30, 0xD5, 0xB9, 0x4D, 0x6E, 0xF3, 0x8B, 0x5D, 0xE0, 0x32, 0xE3, 0xD7, 0xF7, 0x73, 0xAC,
+    0x1E, 0xA8, 0xE6, 0x9D, 0x3A, 0xB1, 0x37, 0x33, 0xA2, 0xF9, 0xDE, 0x46, 0x3B, 0xBB, 0xAD, 0x9F,
+    0xDC, 0x4E, 0x1F, 0xFF, 0x2F, 0xBD, 0x99, 0x3F, 0x8C, 0xE5, 0xC6, 0x7D, 0xC7, 0x3F, 0x33, 0x63,
+    0x8B, 0x48, 0x08, 0x63, 0x54, 0x38, 0x46, 0x10, 0x21, 0x9E, 0xDE, 0x81, 0x8F, 0x6D, 0x0A, 0xDD,
+    0xCE, 0xC0, 0x2A, 0x5C, 0x5A, 0x85, 0x2E, 0x85, 0x5C, 0xB8, 0x35, 0xEC, 0xE2, 0x9A, 0x14, 0x2E,
+    0x6E, 0x97, 0x04, 0x54, 0xA4, 0x48, 0x11, 0x15, 0x51, 0x5A, 0xAB, 0x10, 0x02, 0x5B, 0x2A, 0xE4,
+    0x52, 0xC5, 0xDE, 0x72, 0x60, 0x17, 0x29, 0x52, 0x84, 0x88, 0x0B, 0x95, 0x26, 0xA0, 0x33, 0x1C,
+    0xC8, 0x85, 0x26, 0x31, 0x6D, 0xF3, 0xA4, 0x21, 0xBF, 0x29, 0xF8, 0xDE, 0xEE, 0x49, 0x4A, 0x02,
+    0xA7, 0x48, 0x08, 0x2C, 0x17, 0xF8, 0x3D, 0xF0, 0x71, 0x7E, 0xFF, 0xBF, 0xDF, 0xEF, 0x03, 0x00,
+    0x3A, 0xEE, 0xC3, 0x05, 0xF7, 0xE1, 0x3E, 0xD7, 0xDC, 0x5D, 0x5F, 0x7C, 0xF0, 0xE0, 0x15, 0xBC,
+    0x54, 0x09, 0x52, 0x25, 0x02, 0xC7, 0xED, 0x0A, 0xE0, 0x31, 0x40, 0x3D, 0xDF, 0xCC, 0xF6, 0xE0,
+    0x41, 0xB2, 0x92, 0x92, 0x93, 0x84, 0x2B, 0x40, 0x33, 0x03, 0x6D, 0x06, 0x7C, 0x06, 0xFC, 0x00,
+    0x84, 0x37, 0x1E, 0xBC, 0x42, 0x27, 0x55, 0xA2, 0xB4, 0xD2, 0x4B, 0x0B, 0xA3, 0x54, 0x00, 0xD8,
+    0x01, 0xDA, 0x15, 0x20, 0x16, 0xC0, 0x29, 0x03, 0x61, 0x04, 0xA8, 0x15, 0xF0, 0x3F, 0x5F, 0x80,
+    0xDE, 0x4F, 0xE0, 0x4A, 0x4C, 0xD0, 0x0D, 0x37, 0x60, 0xAA, 0x5D, 0xC1, 0x4F, 0x6D, 0x81, 0x91,
+    0x2E, 0xD3, 0x14, 0x7A, 0x88, 0x83, 0xA9, 0xD8, 0x4A, 0xB3, 0xE0, 0x27, 0xFC, 0x84, 0x24, 0x0D,
+    0xAD, 0xA4, 0x9D, 0x28, 0x69, 0x75, 0x92, 0x54, 0xC2, 0x0C, 0x31, 0x0B, 0x50, 0xBB, 0x82, 0xAB,
+    0x7D, 0x86, 0xB0, 0x10, 0xA5, 0x7A, 0x3A, 0xDF, 0xED, 0xD9, 0xB6, 0x5B, 0x77, 0x2B, 0x60, 0x57,
+    0xC0, 0x69, 0x1F, 0x70, 0xD2, 0x42, 0x53, 0xB8, 0xA6, 0x9D, 0xB9, 0xC0, 0x4F, 0xDC, 0xC3, 0x67,
+    0xEE, 0x11, 0x32, 0xF7, 0xE9, 0x06, 0x2A, 0x31, 0xBD, 0xB0, 0x12, 0xA5, 0x85, 0x28, 0x4D, 0xF4,
+    0x52, 0x62, 0xD4, 0x93, 0x73, 0xAC, 0xBD, 0x9E, 0x42, 0x2F, 0x61, 0xCB, 0xF1, 0xEC, 0x8B, 0x5C,
+    0x40, 0x31, 0x0B, 0x2E, 0xB7, 0x99, 0x7B, 0x44, 0xEC, 0x62, 0xB6, 0x07, 0x63, 0x6A, 0xA5, 0x99,
+    0x28, 0x0D, 0x54, 0xDA, 0xA9, 0x99, 0x69, 0x73, 0x07, 0x5D, 0xAA, 0xB0, 0xB9, 0x19, 0x5F, 0xC2,
+    0xF0, 0x15, 0x0D, 0xA3, 0x54, 0x9D, 0xA4, 0x29, 0x48, 0x95, 0x51, 0xFB, 0xF9, 0x45, 0xE6, 0xC1,
+    0x83, 0x07, 0x38, 0x49, 0x19, 0x49, 0xE5, 0xC8, 0x65, 0x37, 0x00, 0x7E, 0x02, 0x9A, 0x02, 0xD8,
+    0x7A, 0xEB, 0x71, 0x4C, 0x40, 0xC8, 0x40, 0x5B, 0x00, 0x77, 0xF7, 0xC9, 0x98, 0x80, 0x98, 0x01,
+    0x5F, 0x80, 0x66, 0x05, 0xEC, 0x0E, 0xA0, 0xDB, 0x4F, 0xBA, 0x72, 0xF6, 0x4E, 0x05, 0x23, 0xED,
+    0xD0, 0xBD, 0xFD, 0xEE, 0x84, 0x9B, 0xA9, 0x70, 0x89, 0xCF, 0xB4, 0xD9, 0xAC, 0xB0, 0xD2, 0x25,
+    0x42, 0x72, 0x05, 0x5B, 0x88, 0x10, 0x69, 0x66, 0x9A, 0x89, 0x0D, 0xAE, 0xF1, 0x19, 0x9F, 0x4D,
+    0x85, 0x95, 0x6E, 0xA0, 0xC3, 0xAD, 0xB4, 0x33, 0x31, 0xD9, 0x4A, 0x53, 0x18, 0x13, 0x42, 0x92,
+    0x76, 0x2F, 0x49, 0x59, 0x92, 0x56, 0x3F, 0x41, 0xA4, 0x42, 0x33, 0xFB, 0x0C, 0xF5, 0xFF, 0xBD,
+    0x98, 0x45, 0x10, 0xA1, 0x60, 0x37, 0xFA, 0xD5, 0x08, 0x9A, 0x6A, 0x35, 0xF9, 0x02, 0x7E, 0x69,
+    0x85, 0x12, 0x84, 0x12, 0x57, 0xBF, 0x00, 0x31, 0x6B, 0x1A, 0x07, 0x60, 0x7C, 0x4D, 0x47, 0xF5,
+    0xCB, 0xAF, 0x7D, 0x06, 0xEC, 0x16, 0xDF, 0xAF, 0x00, 0xCD, 0xA6, 0x3E, 0x03, 0xF8, 0x4F, 0xB4,
+    0x01, 0x10, 0xA4, 0x09, 0x80, 0x78, 0xCE, 0xED, 0xB9, 0x8B, 0xFC, 0xF9, 0x13, 0x49, 0xF9, 0x64,
+    0x50, 0x06, 0x8C, 0x24, 0x0D, 0xC7, 0xB3, 0x1F, 0x29, 0x81, 0xD1, 0x6F, 0xF4, 0x43, 0x01, 0x9D,
+    0xC2, 0x16, 0x77, 0xB0, 0x2A, 0x5A, 0xC6, 0x0D, 0xA2, 0x5E, 0xD2, 0xA4, 0x8A, 0xD3, 0xD2, 0xC9,
+    0x6A, 0x25, 0x2A, 0xA9, 0x3A, 0x2D, 0xA7, 0x2A, 0x7A, 0x4E, 0x4F, 0x60, 0x54, 0xC5, 0x7D, 0xFC,
+    0x4E, 0x85, 0x23, 0x44, 0xED, 0x04, 0x74, 0xE7, 0x20, 0xFA, 0x89, 0x2F, 0x7E, 0x7B, 0x83, 0x51,
+    0x03, 0x4E, 0x1B, 0x60, 0xF6, 0xDB, 0x00, 0x97, 0x73, 0x30, 0x23, 0xE0, 0x56, 0x3B, 0x33, 0x66,
+    0x7F, 0x6A, 0xCC, 0x19, 0x69, 0x87, 0x87, 0x7B, 0x3A, 0xD7, 0xEC, 0x8F, 0x8E, 0x31, 0x95, 0x31,
+    0x3B, 0xAE, 0x42, 0x9C, 0x89, 0x03, 0x7E, 0xA3, 0x59, 0x70, 0xCA, 0x8C, 0x30, 0x56, 0x7C, 0x21,
+    0x68, 0x30, 0x3B, 0x8D, 0x16, 0xBA, 0x09, 0x09, 0x57, 0x89, 0xBF, 0x98, 0x89, 0xB9, 0xFD, 0xED,
+    0x46, 0xB3, 0xD8, 0x2D, 0x66, 0x46, 0xFA, 0xD7, 0x2A, 0xBE, 0xF8, 0x32, 0x0E, 0x66, 0x77, 0xD5,
+    0x2F, 0x74, 0x93, 0x8C, 0x70, 0xB5, 0x9B, 0xBA, 0x42, 0xFC, 0xA7, 0xD5, 0xED, 0x34, 0x4F, 0x77,
+    0xFA, 0x09, 0x8D, 0xB9, 0xAD, 0x78, 0x15, 0x94, 0x8D, 0x36, 0xC2, 0x4A, 0xA7, 0xE4, 0x94, 0x9C,
+    0x66, 0x62, 0x21, 0x56, 0x5A, 0x01, 0x50, 0xF8, 0x12, 0xE0, 0x71, 0x19, 0xA8, 0x66, 0x05, 0x9A,
+    0x23, 0x33, 0x9D, 0x06, 0x80, 0xEF, 0x25, 0x3E, 0x73, 0xDD, 0xB9, 0xF5, 0xF6, 0xE7, 0xDC, 0xB2,
+    0x9F, 0x77, 0xCB, 0x7D, 0xDA, 0xAD, 0x72, 0x76, 0x6B, 0xFD, 0x3F, 0x74, 0x2B, 0x26, 0x5F, 0x30,
+    0x15, 0x25, 0xFC, 0xDC, 0x2E, 0x10, 0xD3, 0x38, 0x60, 0x6B, 0xB3, 0x82, 0x9F, 0xFB, 0x0C, 0xF1,
+    0xA5, 0x0A, 0xB6, 0xC6, 0x0C, 0xFE, 0x83, 0x0D, 0xE8, 0xFB, 0x09, 0xAC, 0x76, 0xC0, 0x6B, 0x06,
+    0x7A, 0x01, 0x56, 0x05, 0xF0, 0x2A, 0x40, 0xAF, 0x09, 0xAC, 0x94, 0xC1, 0xFF, 0x46, 0x19, 0xFA,
+    0xBF, 0xD5, 0x80, 0xDB, 0xBC, 0x12, 0xBE, 0x74, 0x82, 0x7E, 0x88, 0x3B, 0x6E, 0x63, 0xDC, 0xF0,
+    0xC5, 0xA8, 0x32, 0x0E, 0x4E, 0xEB, 0x51, 0xCA, 0x0B, 0x44, 0x29, 0x63, 0x25, 0x81, 0x2F, 0x76,
+    0x85, 0x98, 0xFC, 0x84, 0xA9, 0xF4, 0xD0, 0x7E, 0xCE, 0x30, 0xDB, 0x0A, 0x31, 0xF9, 0x19, 0x53,
+    0x89, 0xE9, 0xCE, 0x50, 0x4E, 0x06, 0x3F, 0x9B, 0xB3, 0xC1, 0x56, 0xE2, 0x40, 0x98, 0xCD, 0x46,
+    0x23, 0xDA, 0x42, 0xB7, 0x10, 0x33, 0x3F, 0x3E, 0x12, 0xD6, 0x56, 0xE8, 0x26, 0x94, 0x69, 0x2A,
+    0xA1, 0x82, 0xB2, 0xFD, 0x64, 0x22, 0xAE, 0xC4, 0x4B, 0xDA, 0x5F, 0x24, 0xF7, 0xAB, 0xD9, 0xFC,
+    0xAE, 0x70, 0x79, 0x45, 0x8C, 0xB4, 0x3F, 0x2B, 0xFE, 0xE7, 0x33, 0x35, 0x9A, 0xF5, 0x31, 0xE1,
+    0xB5, 0x12, 0x7D, 0xB6, 0x4B, 0xFC, 0xD6, 0x54, 0x89, 0x2F, 0xFD, 0xAE, 0x86, 0xC1, 0x95, 0x28,
+    0xBB, 0xD0, 0x3B, 0xCD, 0x11, 0x3F, 0x77, 0xB5, 0x29, 0x6C, 0x56, 0xE9, 0x86, 0x90, 0xBB, 0xD9,
+    0x4F, 0xB6, 0x9A, 0x1F, 0x99, 0x4A, 0x1C, 0xA0, 0xCB, 0x6E, 0x01, 0xB7, 0x32, 0x9E, 0x26, 0xB2,
+    0xF9, 0x11, 0xD8, 0x37, 0x69, 0x0B, 0x74, 0x99, 0x38, 0xC0, 0x8E, 0xD9, 0xA0, 0x59, 0x6E, 0x6D,
+    0x19, 0x04, 0x3B, 0xB8, 0x95, 0x66, 0x81, 0x30, 0x9D, 0x6D, 0x02, 0x57, 0x69, 0x56, 0x08, 0x85,
+    0x6E, 0x82, 0x71, 0x40, 0xE0, 0x36, 0x9A, 0xFD, 0xC1, 0x83, 0x87, 0x85, 0x4E, 0xE7, 0xF5, 0xA0,
+    0x1D, 0x27, 0x49, 0x0B, 0xE1, 0xCE, 0x26, 0xDC, 0x0E, 0x7E, 0x25, 0x2C, 0xD0, 0x4F, 0x8C, 0x19,
+    0xAB, 0xE4, 0x04, 0xBE, 0xE2, 0x57, 0xE8, 0x0B, 0xE3, 0x84, 0x3D, 0xCA, 0xFE, 0xA1, 0x06, 0xA0,
+    0x95, 0x56, 0xA0, 0xD7, 0x28, 0x30, 0x9A, 0xAC, 0x06, 0x9A, 0x1D, 0xC6, 0x8C, 0x5F, 0x20, 0x4E,
+    0xC4, 0x19, 0xBA, 0x99, 0x7E, 0x80, 0x30, 0x23, 0xC0, 0xCF, 0x66, 0x03, 0xFC, 0xE4, 0x8E, 0x71,
+    0xE2, 0x16, 0x20, 0xE4, 0xA6, 0x00, 0x5D, 0x6E, 0x0B, 0xA7, 0xAC, 0x42, 0x8F, 0x9F, 0x01, 0xE1,
+    0x0B, 0xB8, 0x0D, 0xBF, 0x42, 0xA8, 0x78, 0xBD, 0xFC, 0x15, 0x2D, 0x78, 0x49, 0x2A, 0xB4, 0x87,
+    0x07, 0x4E, 0x92, 0x12, 0x56, 0x52, 0x05, 0x7A, 0x69, 0x06, 0x9E, 0xD3, 0xD3, 0xCF, 0x76, 0xA7,
+    0x93, 0x34, 0x1B, 0x49, 0x0B, 0x37, 0x0F, 0x1E, 0xD4, 0x63, 0x2B, 0xF9, 0x8C, 0x1F, 0x9A, 0x99,
+    0x76, 0xB2, 0x0B, 0xAE, 0x50, 0xA1, 0x12, 0xE1, 0x8A, 0x6E, 0xA0, 0x4B, 0x7E, 0xC2, 0x67, 0x57,
+    0x68, 0x8A, 0xA9, 0xD8, 0x95, 0x1B, 0xD8, 0x88, 0xE9, 0x78, 0x30, 0xE4, 0xA6, 0xD0, 0xCE, 0x76,
+    0xC5, 0x2D, 0x6C, 0xA7, 0xEA, 0x1C, 0xCF, 0x09, 0x44, 0x7A, 0x02, 0x4E, 0xAA, 0x10, 0x3E, 0x54,
+    0x85, 0x63, 0xBC, 0x15, 0xDA, 0x99, 0x90, 0x09, 0x03, 0x3B, 0xDC, 0xE0, 0x16, 0x5C, 0x21, 0x64,
+    0x62, 0x66, 0xE4, 0x85, 0xED, 0x38, 0x27, 0x41, 0xDA, 0x61, 0x94, 0x06, 0x9C, 0xDE, 0x4E, 0x10,
+    0xE6, 0xDB, 0x25, 0xED, 0x36, 0x80, 0x50, 0x00, 0xC6, 0x0C, 0xB8, 0x1D, 0xC0, 0x2F, 0x77, 0x06,
+    0x01, 0xF8, 0x0A, 0x30, 0xCE, 0x9F, 0x8E, 0xC3, 0x0B, 0x7A, 0x1D, 0x8C, 0xB4, 0x42, 0x23, 0x55,
+    0x68, 0xF5, 0xC6, 0xAB, 0xE0, 0xF7, 0xBB, 0x47, 0x8E, 0xFB, 0xB1, 0xBA, 0x9A, 0xCA, 0x2D, 0x4E,
+    0x38, 0x06, 0x3E, 0xC7, 0x80, 0xEC, 0x07, 0x80, 0x6E, 0xBA, 0x7B, 0xF5, 0x71, 0x0C, 0x73, 0x2C,
+    0xA9, 0xBE, 0xC2, 0xF3, 0x04, 0x3D, 0xFD, 0xAB, 0x4A, 0x23, 0x69, 0x87, 0x23, 0x53, 0xDD, 0x6D,
+    0xDA, 0x0A, 0xF4, 0xD2, 0x0A, 0x56, 0xFA, 0xB7, 0x3B, 0xE0, 0x24, 0xA9, 0xF4, 0x92, 0xF4, 0x53,
+    0x49, 0xDA, 0xFF, 0xF8, 0x8D, 0xB6, 0x98, 0x97, 0x39, 0x82, 0x7A, 0x20, 0xB6, 0xA6, 0x9C, 0x06,
+    0xED, 0x19, 0xBB, 0x34, 0xCB, 0x9D, 0x41, 0x9C, 0xD1, 0xCB, 0xE9, 0x70, 0xBA, 0x73, 0xE0, 0x08,
+    0xA2, 0x86, 0xFF, 0x3E, 0x88, 0xE1, 0xB3, 0x41, 0xC4, 0x0F, 0xB4, 0x99, 0x0A, 0x2B, 0xED, 0x44,
+    0x07, 0x57, 0x34, 0xF3, 0xA9, 0x56, 0x62, 0x0A, 0x03, 0x76, 0x75, 0x05, 0x42, 0xBE, 0x01, 0x36,
+    0x9F, 0xC1, 0x7F, 0xB0, 0x02, 0x63, 0x0F, 0x34, 0x9A, 0x81, 0x58, 0x01, 0xA7, 0xE1, 0x8C, 0x83,
+    0x0F, 0x58, 0x15, 0xF3, 0x39, 0xC8, 0x56, 0x80, 0xD1, 0x04, 0x7F, 0xA1, 0x95, 0xD3, 0x76, 0x8D,
+    0x3B, 0xD0, 0x3C, 0x5B, 0xC6, 0xCF, 0x1D, 0x35, 0xF1, 0xEB, 0x8F, 0xDF, 0x9D, 0xEC, 0xEA, 0x8A,
+    0x2D, 0x6D, 0x6E, 0x0A, 0xC5, 0xD3, 0xCE, 0x2C, 0x5F, 0xC5, 0x4F, 0xA6, 0x7C, 0x9D, 0x90, 0x5D,
+    0xB9, 0xA0, 0xCB, 0xED, 0x1C, 0x87, 0x38, 0xF4, 0xB9, 0x93, 0xA4, 0x21, 0x48, 0xDA, 0x69, 0x24,
+    0x2D, 0xF0, 0x7D, 0x7D, 0x9C, 0xCE, 0xA1, 0xB4, 0xCF, 0xA4, 0xD7, 0xAD, 0x77, 0xB1, 0x6C, 0x0B,
+    0x67, 0x24, 0x78, 0x8A, 0x1A, 0x8F, 0x0F, 0x70, 0x15, 0x32, 0xF4, 0xE0, 0x16, 0xE8, 0x81, 0x11,
+    0xFA, 0x04, 0x61, 0xA2, 0x4F, 0xE0, 0x56, 0xFA, 0x04, 0x8C, 0x47, 0x79, 0x84, 0xB9, 0x1F, 0x00,
+    0x57, 0x8F, 0x62, 0x19, 0xC7, 0x7C, 0x40, 0x9D, 0xCC, 0x2D, 0x1B, 0x38, 0x05, 0x1B, 0xFA, 0x03,
+    0x8B, 0xF4, 0x47, 0x8D, 0xF5, 0xA7, 0x2A, 0xFA, 0x68, 0x05, 0xE8, 0x3F, 0x10, 0x40, 0x3F, 0xF7,
+    0x13, 0xD0, 0x17, 0x5F, 0x81, 0xBE, 0x38, 0x25, 0x88, 0x85, 0xBE, 0x40, 0x2C, 0xF8, 0x0A, 0x71,
+    0xC1, 0x6A, 0x20, 0x2E, 0xD0, 0x9F, 0xC0, 0xEA, 0x17, 0xF0, 0x03, 0xF7, 0xF0, 0x89, 0xFB, 0x04,
+    0x78, 0x91, 0x0E, 0xAE, 0xB9, 0x80, 0x95, 0x4B, 0x58, 0xB8, 0xC6, 0x14, 0x2A, 0xAE, 0xB0, 0xE2,
+    0x66, 0xB3, 0xD0, 0x4C, 0xB6, 0xD0, 0x66, 0x57, 0xF0, 0xB9, 0x99, 0x09, 0x43, 0x3B, 0xD1, 0x25,
+    0x9F, 0x8F, 0xB6, 0x8F, 0x84, 0x81, 0x2B, 0xBA, 0xE1, 0xC1, 0x9E, 0xA2, 0xA4, 0x1C, 0x25, 0xE5,
+    0x51, 0x3A, 0x60, 0xF2, 0x2D, 0x04, 0xAD, 0x80, 0x59, 0x9F, 0x49, 0xDF, 0x7D, 0xB8, 0x6E, 0x32,
+    0x7E, 0xB8, 0x86, 0xC5, 0x0F, 0x04, 0x16, 0x5C, 0x09, 0x10, 0x6D, 0xA1, 0x99, 0x2F, 0x60, 0x6B,
+    0x26, 0x42, 0x7E, 0x84, 0xAB, 0xCD, 0x84, 0x86, 0x91, 0x71, 0x69, 0x24, 0x11, 0xF5, 0x49, 0x41,
+    0xF5, 0x06, 0x5E, 0xF1, 0xD3, 0x89, 0xAC, 0x74, 0xF9, 0x94, 0xB0, 0x98, 0xCE, 0x0D, 0x01, 0xE0,
+    0x8A, 0x79, 0xD9, 0xCD, 0xA6, 0x52, 0xCD, 0xC2, 0x0D, 0x3D, 0xD7, 0x44, 0xBA, 0x14, 0xF1, 0xD9,
+    0x67, 0x3F, 0x34, 0xB3, 0x2B, 0xCD, 0x64, 0x17, 0x56, 0x5B, 0xA8, 0x5C, 0x52, 0xE9, 0xE9, 0xB8,
+    0xA0, 0x1B, 0x7C, 0x0E, 0xC9, 0x67, 0x37, 0xB7, 0xD9, 0x15, 0x53, 0x5C, 0x31, 0x2B, 0xD7, 0xAC,
+    0x3C, 0xE6, 0x82, 0xFB, 0x44, 0x7C, 0x0A, 0xF8, 0xDC, 0xE4, 0x76, 0x68, 0x66, 0x5B, 0xDC, 0x64,
+    0x17, 0x56, 0x53, 0x90, 0x4E, 0x70, 0x59, 0xFB, 0xB1, 0x53, 0xD2, 0x7F, 0x79, 0x92, 0xC7, 0x7F,
+    0xC8, 0x49, 0xAE, 0x8E, 0x93, 0xA4, 0x67, 0x4E, 0x32, 0x9B, 0xC5, 0x15, 0xB3, 0x70, 0xCD, 0xCA,
+    0x35, 0x17, 0x5C, 0x12, 0xF1, 0xA9, 0xC3, 0x0F, 0x4D, 0xF6, 0x43, 0x93, 0x6D, 0x71, 0x93, 0xFD,
+    0xF8, 0xC7, 0xFB, 0xDB, 0x4F, 0x8F, 0x55, 0x36, 0xC7, 0x83, 0x03, 0x4A, 0xC7, 0x82, 0x3A, 0x31,
+    0x81, 0x23, 0x2D, 0x07, 0xF9, 0x39, 0xD8, 0x0F, 0x5F, 0x4C, 0x74, 0xCA, 0x78, 0x15, 0x9C, 0x2A,
+    0x70, 0x01, 0xF8, 0x04, 0x4D, 0x06, 0x5B, 0x80, 0xF5, 0xC8, 0x19, 0x9D, 0x9E, 0xE0, 0xA5, 0xEC,
+    0x66, 0x53, 0xCD, 0x82, 0xE7, 0x1A, 0x37, 0xC5, 0x23, 0x87, 0x8F, 0xDA, 0x89, 0xDE, 0x15, 0xC6,
+    0x24, 0x29, 0xF7, 0x52, 0xEE, 0xA4, 0xEC, 0xB5, 0x3F, 0x0B, 0x0E, 0xBF, 0x70, 0xFC, 0xB3, 0x3B,
+    0x4D, 0x3E, 0xFA, 0xFE, 0xFA, 0xE8, 0x39, 0x3F, 0x1C, 0x73, 0x74, 0x01, 0xDA, 0x85, 0x70, 0x4C,
+    0x2B, 0x5B, 0x00, 0x3F, 0x73, 0x01, 0x98, 0x8D, 0x66, 0x3A, 0xB2, 0x3D, 0xEA, 0x75, 0x5C, 0xC5,
+    0x4B, 0x99, 0x3E, 0xB1, 0xD2, 0xD3, 0x16, 0x42, 0xA2, 0x1C, 0xCF, 0xF8, 0xE4, 0x0B, 0x11, 0x16,
+    0xBB, 0xD3, 0xCC, 0x04, 0xE2, 0xC4, 0x63, 0x9A, 0xD2, 0x54, 0x7C, 0xB6, 0x1B, 0x63, 0x46, 0x52,
+    0xF6, 0x2B, 0x41, 0x2A, 0x46, 0xC9, 0x4A, 0x95, 0x58, 0x88, 0x7A, 0x7A, 0x9E, 0x75, 0xB7, 0x97,
+    0x29, 0xC0, 0xF5, 0x7F, 0x17, 0x95, 0xCB, 0xFF, 0x29, 0x2A, 0xE1, 0x0F, 0x8C, 0x0A, 0xD8, 0x71,
+    0x06, 0x1E, 0x6A, 0x07, 0xBB, 0x19, 0x0D, 0xB4, 0x13, 0x5D, 0xA6, 0x4B, 0xF8, 0x99, 0x4B, 0x68,
+    0x0B, 0x7F, 0x7F, 0xAE, 0x6D, 0x77, 0x7B, 0x8F, 0xE7, 0xC5, 0x31, 0xC3, 0x78, 0xA2, 0x46, 0x3E,
+    0xDF, 0xB2, 0x5E, 0xFA, 0xF4, 0xB5, 0x19, 0x2B, 0xA2, 0xFE, 0x71, 0xDC, 0x88, 0xB7, 0xF5, 0x59,
+    0x4E, 0x9B, 0xC7, 0x4B, 0x3B, 0x98, 0x51, 0xAF, 0x7F, 0x16, 0x21, 0xF8, 0x89, 0x87, 0x4F, 0xC1,
+    0xE7, 0x46, 0x1A, 0x08, 0x43, 0x37, 0x87, 0x89, 0x2E, 0xF5, 0xB8, 0x42, 0x34, 0x15, 0x5B, 0x88,
+    0xAE, 0x60, 0x0A, 0x57, 0xCD, 0x84, 0x29, 0x6C, 0x3E, 0x63, 0x0B, 0x35, 0x24, 0x6C, 0x31, 0x6B,
+    0x04, 0x37, 0xDB, 0xF5, 0x0A, 0x9A, 0xD9, 0x69, 0x83, 0x36, 0x3B, 0x6D, 0xE0, 0x73, 0x33, 0x6F,
+    0x10, 0x87, 0x36, 0xEF, 0x30, 0xE2, 0xB3, 0x92, 0xDD, 0xF1, 0x83, 0x7E, 0xF9, 0x6E, 0x25, 0x20,
+    0x69, 0xA1, 0xA3, 0x97, 0x26, 0x2E, 0x08, 0x12, 0xDC, 0xC7, 0xDE, 0x69, 0x09, 0x00, 0xCF, 0xBD,
+    0xFD, 0x16, 0x34, 0xD2, 0x04, 0x07, 0x4E, 0x9E, 0x79, 0x04, 0x8F, 0xB1, 0x33, 0x6E, 0xC6, 0x27,
+    0xBA, 0xC4, 0x25, 0x6C, 0xD8, 0x82, 0xAB, 0xF8, 0x8C, 0xDF, 0xB8, 0xE0, 0x50, 0x28, 0x0E, 0x89,
+    0x82, 0x5E, 0x82, 0x56, 0xAA, 0x30, 0xBE, 0x31, 0xCE, 0xB4, 0x85, 0x31, 0xD1, 0xE3, 0x36, 0x5C,
+    0x25, 0x14, 0xC2, 0xCC, 0x98, 0x51, 0x72, 0x3B, 0x4D, 0xC5, 0x2F, 0xC4, 0x42, 0x3F, 0x19, 0x65,
+    0x27, 0xFC, 0x8E, 0xAF, 0xF4, 0x0B, 0xFD, 0x19, 0x4F, 0xD8, 0x1D, 0xAC, 0xB6, 0x82, 0xB4, 0x13,
+    0xA7, 0x6E, 0x6E, 0x0A, 0x1B, 0x2B, 0x3E, 0x77, 0x50, 0xDD, 0x84, 0xCF, 0x8F, 0x30, 0xAB, 0x1F,
+    0x88, 0xC3, 0x42, 0xBB, 0xF8, 0xC1, 0x09, 0xBD, 0xAA, 0xE2, 0x25, 0x31, 0x4A, 0xB3, 0xD3, 0x7E,
+    0x45, 0xBB, 0x7F, 0x73, 0x3A, 0x57, 0xDD, 0xDB, 0xEF, 0x41, 0xAF, 0x82, 0x93, 0xA6, 0x03, 0x54,
+    0xC4, 0x74, 0xEA, 0x61, 0xB3, 0x02, 0xAE, 0x7C, 0xEF, 0x75, 0xDC, 0xAF, 0x4F, 0xAB, 0x2C, 0xB5,
+    0x4A, 0x63, 0xF6, 0x95, 0x98, 0x7D, 0xA1, 0x9B, 0xC2, 0x44, 0x97, 0x43, 0xA6, 0xCB, 0xDD, 0x40,
+    0x1C, 0xBA, 0x8C, 0x08, 0x73, 0xB3, 0xE3, 0xA5, 0x95, 0x56, 0x2A, 0x58, 0x29, 0x41, 0xFF, 0x04,
+    0xE8, 0xF6, 0xD7, 0xF1, 0x12, 0x2E, 0xBB, 0xD9, 0x16, 0x7E, 0xC0, 0xCA, 0x57, 0xB9, 0x8F, 0x4F,
+    0x21, 0x85, 0xA1, 0x3D, 0xB4, 0x82, 0x99, 0x85, 0x2B, 0x1E, 0xD1, 0xE4, 0x0B, 0x4C, 0xF1, 0x89,
+    0xDA, 0x64, 0x6E, 0xEC, 0x6F, 0x5F, 0x55, 0x3A, 0x4D, 0xFE, 0x21, 0xDC, 0x56, 0x75, 0x73, 0x28,
+    0x33, 0xCA, 0x3E, 0x9F, 0xC6, 0x7F, 0xC8, 0x27, 0x51, 0xE9, 0x76, 0x46, 0x8F, 0xE7, 0xA5, 0xBA,
+    0x03, 0x61, 0x02, 0xBB, 0x9D, 0x90, 0x80, 0xAB, 0xC0, 0x38, 0xDC, 0x65, 0x5C, 0x9A, 0x68, 0x24,
+    0xB8, 0x30, 0x15, 0x96, 0x76, 0xA6, 0xCD, 0x31, 0x71, 0x41, 0xC5, 0x94, 0xA6, 0xE0, 0x73, 0x37,
+    0x70, 0xC1, 0x86, 0x2B, 0xAE, 0x10, 0x93, 0xCF, 0x76, 0xE5, 0x8A, 0x2E, 0xDB, 0xC5, 0x4B, 0xDA,
+    0xA3, 0xA4, 0x22, 0x49, 0xAF, 0x15, 0xB8, 0xF6, 0x19, 0x37, 0x7F, 0x0D, 0xFE, 0x0C, 0x78, 0x38,
+    0x1F, 0xFB, 0xB5, 0x9B, 0x3C, 0xCD, 0xCC, 0x5F, 0x9B, 0x05, 0x97, 0x2F, 0x78, 0xB5, 0xB6, 0x27,
+    0xBD, 0x65, 0x0D, 0x6F, 0xA4, 0xA3, 0xDB, 0xE3, 0x19, 0x16, 0x74, 0x0B, 0x7F, 0x6A, 0x24, 0x0D,
+    0xFE, 0x24, 0x79, 0x9D, 0x09, 0x7D, 0x4F, 0x5F, 0x9A, 0x02, 0x9B, 0xD5, 0xD0, 0x27, 0xDC, 0xDA,
+    0xD6, 0x66, 0x81, 0xA6, 0xC4, 0xD2, 0x27, 0xF0, 0x93, 0x5E, 0x5A, 0x80, 0xEE, 0x67, 0x35, 0x26,
+    0xA0, 0xFF, 0xCE, 0x07, 0x0B, 0xC0, 0x3E, 0xF6, 0x09, 0xB0, 0x3A, 0x24, 0x08, 0x77, 0x5A, 0x1C,
+    0xFE, 0x34, 0xB5, 0x47, 0xCD, 0x1C, 0x34, 0x63, 0x7A, 0x46, 0xF9, 0x08, 0x87, 0xDE, 0x61, 0xF5,
+    0xEE, 0xEF, 0x95, 0x20, 0xAE, 0xFA, 0x67, 0x81, 0xD3, 0xDF, 0xC8, 0xEF, 0xD0, 0xAF, 0x71, 0x8D,
+    0x1B, 0xAD, 0x06, 0xCD, 0x7D, 0x05, 0x12, 0x41, 0xE9, 0x8F, 0xF8, 0x09, 0x7C, 0x09, 0x5C, 0xC2,
+    0x66, 0xEC, 0x84, 0x06, 0xBE, 0x5F, 0x20, 0x80, 0xCB, 0x98, 0x82, 0x5D, 0xBC, 0x6A, 0xA3, 0x6A,
+    0xC6, 0x27, 0xF0, 0x65, 0xC0, 0x16, 0x7C, 0xF1, 0x03, 0xE3, 0x70, 0x9F, 0x76, 0x33, 0x85, 0xC7,
+    0xA5, 0xCD, 0xCD, 0xFB, 0xF9, 0x82, 0xCB, 0x7B, 0x2C, 0xCD, 0xBC, 0x34, 0xF9, 0xA2, 0xC9, 0x9D,
+    0x2B, 0x1D, 0x6B, 0x64, 0x75, 0x1F, 0x94, 0x66, 0x0E, 0x0F, 0xE9, 0xD2, 0xCD, 0x42, 0x75, 0x4A,
+    0x4D, 0x09, 0x0B, 0xDD, 0x30, 0x0E, 0x6C, 0xC0, 0xF3, 0x66, 0xC0, 0xEC, 0xFB, 0x19, 0x17, 0x9F,
+    0x05, 0x97, 0x97, 0x0F, 0xC1, 0x24, 0xE6, 0x0B, 0xEC, 0xCE, 0x42, 0xB7, 0x34, 0xD9, 0xFE, 0x3E,
+    0x77, 0x84, 0xEF, 0xB0, 0x9A, 0xE5, 0x3D, 0x37, 0x85, 0xD7, 0xA6, 0xC0, 0x1A, 0xB8, 0xF6, 0xF9,
+    0xDA, 0xCD, 0xD5, 0xCD, 0xFE, 0xEF, 0x72, 0x18, 0x2E, 0xAF, 0x79, 0x6C, 0x3F, 0x99, 0x5C, 0xF1,
+    0x1B, 0x21, 0xF7, 0x13, 0x37, 0x76, 0xC7, 0x2D, 0xE0, 0x8A, 0x9F, 0xB8, 0x74, 0x0B, 0x6D, 0xDE,
+    0x60, 0x8D, 0x89, 0xEE, 0x5B, 0x13, 0xEE, 0x37, 0x0B, 0x5C, 0x6D, 0xD0, 0x2A, 0x81, 0x26, 0x08,
+    0x15, 0xDC, 0x31, 0x41, 0x07, 0xDA, 0xF7, 0x37, 0xA8, 0x71, 0x21, 0x0C, 0xCA, 0x6E, 0x69, 0x45,
+    0x4F, 0x5C, 0xA1, 0x51, 0xC5, 0x6B, 0xC5, 0xA7, 0x85, 0x40, 0xE1, 0x9E, 0x29, 0xDC, 0xB7, 0x33,
+    0x8F, 0xDC, 0xC4, 0x7B, 0x4D, 0x66, 0x69, 0xB3, 0x29, 0x7E, 0xB0, 0xB3, 0x4F, 0x6E, 0xEA, 0x68,
+    0xF2, 0x05, 0x71, 0xB8, 0xCF, 0x0D, 0x8F, 0x4E, 0xD3, 0xEA, 0x4D, 0xCC, 0x5B, 0xC4, 0x4C, 0x98,
+    0x8D, 0x12, 0x4A, 0xED, 0x4E, 0x5B, 0x89, 0x2B, 0x7D, 0x41, 0xC5, 0x29, 0xB7, 0x1F, 0xE5, 0xEE,
+    0x86, 0x8B, 0xD1, 0xEC, 0x0B, 0x4F, 0xAB, 0xFF, 0x97, 0xDC, 0xBE, 0xBF, 0xDC, 0xF4, 0x44, 0xFF,
+    0xAB, 0xFF, 0xA8, 0xD4, 0xA8, 0x6F, 0xCD, 0xCD, 0xAC, 0xB5, 0x4F, 0xF1, 0x1B, 0xFA, 0xE9, 0xC6,
+    0xD6, 0x6E, 0xBE, 0x34, 0x25, 0x94, 0x3E, 0xC7, 0xDC, 0xDB, 0x9D, 0x9D, 0x57, 0xFC, 0xD2, 0x1C,
+    0x7C, 0x15, 0xFB, 0x26, 0xE6, 0x2D, 0xC2, 0x40, 0x3B, 0xF1, 0x18, 0x22, 0xAE, 0x60, 0x2A, 0x21,
+    0xD3, 0xCE, 0xDC, 0x40, 0x4C, 0x6E, 0x39, 0x1B, 0x0A, 0x37, 0x10, 0x07, 0xB7, 0x60, 0x36, 0x82,
+    0xA4, 0xC2, 0x28, 0x29, 0xBB, 0x5B, 0x04, 0xB3, 0x30, 0x26, 0x62, 0x76, 0x15, 0x23, 0xC2, 0x4C,
+    0xBB, 0x32, 0x26, 0xE2, 0x74, 0x18, 0x4E, 0xD7, 0xC3, 0x27, 0x18, 0x29, 0x9B, 0xDD, 0xAC, 0xA6,
+    0x12, 0xA8, 0xB8, 0xE9, 0x31, 0x2C, 0x11, 0x2E, 0x43, 0xA2, 0x6B, 0x33, 0xFE, 0x67, 0x85, 0x76,
+    0xDA, 0x68, 0x4B, 0xFC, 0x70, 0x5C, 0x5B, 0x69, 0xE5, 0x50, 0x2B, 0x57, 0x18, 0x9F, 0x9D, 0xED,
+    0x56, 0x3A, 0x66, 0xE2, 0x10, 0xE1, 0xB1, 0x59, 0x71, 0xA5, 0x9D, 0xF0, 0x39, 0xC2, 0x15, 0x15,
+    0xBB, 0x9C, 0x9B, 0xBD, 0x67, 0x3B, 0xC8, 0x86, 0x9F, 0x42, 0x26, 0x72, 0x83, 0xA9, 0x6E, 0xC1,
+    0xCF, 0x3E, 0x13, 0xD3, 0x78, 0xE0, 0xC2, 0xE7, 0x9F, 0x7B, 0x02, 0xF6, 0xDF, 0x55, 0xA1, 0xFD,
+    0xE8, 0xE3, 0x0A, 0x71, 0x65, 0x01, 0x0D, 0x6E, 0xA6, 0x59, 0x69, 0x07, 0xBA, 0xCC, 0x05, 0xEC,
+    0xB0, 0xE0, 0x56, 0x9A, 0x4C, 0x98, 0x88, 0x30, 0x66, 0xBB, 0xE0, 0x34, 0x75, 0xF9, 0x90, 0x40,
+    0x91, 0x34, 0xD3, 0xFE, 0x5E, 0x3B, 0xC4, 0x6F, 0x6A, 0xC2, 0x54, 0x5E, 0xE6, 0x60, 0xE6, 0xF4,
+    0x77, 0x7C, 0x21, 0x3C, 0xC3, 0xBA, 0x96, 0xCF, 0x6C, 0xD4, 0xE7, 0x34, 0x18, 0x89, 0xEE, 0xE9,
+    0x77, 0xCD, 0x7E, 0x08, 0xD2, 0x37, 0xC7, 0x12, 0x0F, 0x03, 0x3C, 0x3E, 0x48, 0x84, 0x9F, 0x8E,
+    0x01, 0xA8, 0x5F, 0xBE, 0x69, 0xA4, 0xC9, 0x4A, 0x99, 0x71, 0x3B, 0x91, 0x00, 0x49, 0xFA, 0x68,
+    0x7F, 0xB9, 0xCD, 0x5F, 0xC0, 0x0F, 0x10, 0xD2, 0x21, 0x48, 0xC6, 0xD3, 0xDF, 0xCD, 0x89, 0xC6,
+    0xD4, 0x03, 0x14, 0xBB, 0xF5, 0xF8, 0xCA, 0xA6, 0x9C, 0x08, 0x8C, 0x1F, 0xF0, 0x99, 0x8A, 0x59,
+    0x68, 0x27, 0x22, 0xDC, 0xD0, 0x4E, 0x34, 0x07, 0x77, 0x23, 0x26, 0xDC, 0xDA, 0x14, 0xE8, 0xF2,
+    0x06, 0xA6, 0x76, 0x19, 0xFC, 0x07, 0x0B, 0xA0, 0x11, 0x68, 0x35, 0x9D, 0x78, 0x2C, 0xEE, 0xC0,
+    0xF6, 0xE5, 0x96, 0x37, 0xF6, 0xF9, 0xCC, 0x7A, 0x1B, 0x01, 0x8D, 0x32, 0x44, 0x15, 0x38, 0x64,
+    0xAD, 0x7E, 0x03, 0xDA, 0x73, 0x92, 0x8F, 0xA6, 0xA8, 0xC7, 0x8A, 0x50, 0xA2, 0x97, 0x34, 0x9B,
+    0xD5, 0x2D, 0xA6, 0xB8, 0xC9, 0x15, 0x96, 0x36, 0x35, 0x85, 0xC5, 0xE3, 0x67, 0x96, 0x7B, 0xCF,
+    0xF0, 0xB8, 0x48, 0x97, 0xC3, 0x14, 0x7F, 0xD9, 0xFF, 0x83, 0x0E, 0x1E, 0x97, 0x82, 0xA4, 0xED,
+    0xCC, 0xE3, 0x46, 0x69, 0x38, 0xB1, 0x81, 0x33, 0x8F, 0x5B, 0xEF, 0xEE, 0xED, 0x72, 0xC7, 0xE0,
+    0x8E, 0x2B, 0x24, 0x2E, 0x70, 0x85, 0x0B, 0xB8, 0x26, 0x82, 0x1F, 0x22, 0xB8, 0x12, 0x81, 0xCB,
+    0x08, 0x78, 0x9D, 0xB9, 0xE8, 0xA1, 0x33, 0x8C, 0x33, 0x1C, 0xA9, 0x18, 0xBB, 0x0C, 0x72, 0x0B,
+    0xE8, 0x50, 0x9C, 0xC2, 0x8C, 0x4E, 0xAC, 0x11, 0xCC, 0x4A, 0x9B, 0xDB, 0x89, 0x48, 0x84, 0x95,
+    0x4A, 0x33, 0x35, 0x13, 0x1D, 0x1D, 0x54, 0x2A, 0x6E, 0x76, 0x33, 0x21, 0x85, 0xC4, 0x35, 0xD7,
+    0xC7, 0xB6, 0xF2, 0x83, 0x1F, 0xB8, 0xCF, 0x8B, 0x98, 0x62, 0x24, 0xD5, 0xF6, 0x0C, 0xDD, 0xCF,
+    0x81, 0x6A, 0xA7, 0x53, 0x86, 0xCD, 0x5B, 0x58, 0xAC, 0xC9, 0x36, 0xFF, 0x84, 0xF2, 0x97, 0xFC,
+    0xE0, 0xCF, 0xF9, 0x7A, 0x8B, 0x77, 0xB9, 0xC9, 0xA5, 0x99, 0x2F, 0xBE, 0xBD, 0xB4, 0xAA, 0x8C,
+    0x3F, 0x84, 0x76, 0xC0, 0x4D, 0x50, 0xCE, 0xD1, 0x06, 0x6E, 0xF8, 0x13, 0x2E, 0xD9, 0xB8, 0xE2,
+    0x9A, 0xCA, 0x63, 0xAA, 0xA9, 0x54, 0x56, 0xBB, 0x52, 0xCD, 0xE2, 0x16, 0xB3, 0xDA, 0xE2, 0x8A,
+    0x5D, 0x5C, 0x39, 0x08, 0x4D, 0x3B, 0xB9, 0xB9, 0xC9, 0x3E, 0xBB, 0xA9, 0xCD, 0x07, 0xD1, 0x09,
+    0x43, 0x9B, 0x7D, 0xEA, 0x92, 0x1F, 0x3C, 0x51, 0x07, 0x11, 0x93, 0x76, 0x7A, 0xE9, 0x24, 0xDA,
+    0xFF, 0x2F, 0xDE, 0x32, 0xFF, 0xC1, 0x6F, 0x59, 0xE2, 0x9D, 0x04, 0xF2, 0x39, 0x74, 0x7B, 0x50,
+    0x98, 0x91, 0x43, 0x0B, 0xF1, 0x4A, 0x34, 0xCA, 0xD8, 0x77, 0xCA, 0x29, 0x70, 0x57, 0x40, 0x97,
+    0x8E, 0xDF, 0x9F, 0xDC, 0xC7, 0xEF, 0x14, 0x56, 0xEE, 0x71, 0x89, 0xCB, 0x1D, 0xA6, 0xF8, 0xCC,
+    0xEA, 0x66, 0xB3, 0x99, 0x03, 0x80, 0xED, 0x44, 0x3D, 0x4B, 0x50, 0x53, 0x3B, 0x83, 0xCB, 0x31,
+    0x41, 0xA0, 0x02, 0xEF, 0xB9, 0x02, 0x6E, 0x0A, 0x03, 0x04, 0x6E, 0x80, 0x6B, 0xA7, 0x3D, 0xB9,
+    0xD9, 0x7F, 0xF8, 0x6E, 0xF6, 0xE9, 0x8A, 0x66, 0xB8, 0x36, 0x0B, 0xDE, 0x95, 0x36, 0xF3, 0xC8,
+    0x0F, 0x11, 0x57, 0x2E, 0xA9, 0xF4, 0xDF, 0x28, 0x8D, 0x54, 0x7D, 0xEE, 0xA4, 0x7C, 0x85, 0xF4,
+    0xE4, 0x8E, 0x07, 0x7F, 0xF9, 0xD4, 0x0F, 0xEF, 0x9D, 0xA8, 0xC4, 0x72, 0x70, 0x0D, 0x5B, 0xC0,
+    0x69, 0x4F, 0xCD, 0x87, 0xEF, 0x94, 0x36, 0xF3, 0x9E, 0xCF, 0x3C, 0xF2, 0x03, 0xEF, 0x85, 0x64,
+    0xD6, 0x8E, 0x17, 0x4A, 0x3C, 0xEA, 0x23, 0x8D, 0x7A, 0x76, 0xC4, 0xBC, 0xFB, 0x14, 0x46, 0xAD,
+    0xF8, 0xD4, 0x16, 0x12, 0x5D, 0x3A, 0x7D, 0xE9, 0x09, 0x80, 0x59, 0x69, 0x20, 0x6A, 0x39, 0x95,
+    0x92, 0x9F, 0x9F, 0xC7, 0x55, 0xFB, 0xA4, 0x11, 0xF1, 0x98, 0xF8, 0x33, 0x56, 0x9F, 0x52, 0xC7,
+    0xDC, 0x64, 0x95, 0x78, 0x64, 0x77, 0xD1, 0xE6, 0xC7, 0x2C, 0xAC, 0x1D, 0x4D, 0xF6, 0x6E, 0xE2,
+    0x91, 0x29, 0xEF, 0xD1, 0xE4, 0x0B, 0x0F, 0x8F, 0xDC, 0xBF, 0xCE, 0xB4, 0xC3, 0xE5, 0x7D, 0x58,
+    0x5A, 0x65, 0x02, 0x7B, 0xC5, 0x16, 0xDF, 0x66, 0x2E, 0x4D, 0xB9, 0xA1, 0xCB, 0xF7, 0xDA, 0xFD,
+    0xDD, 0xC5, 0xE5, 0x5E, 0x1B, 0x2F, 0x5A, 0x29, 0x35, 0xC3, 0x73, 0x1A, 0x3E, 0x3D, 0x19, 0x7B,
+    0x65, 0xFC, 0xEB, 0x17, 0x50, 0x58, 0x68, 0x69, 0xF2, 0xA1, 0x4B, 0xCC, 0xAC, 0xB8, 0xD9, 0x9D,
+    0x90, 0x5F, 0xAB, 0x8A, 0xD9, 0xBF, 0x39, 0x13, 0x72, 0x48, 0x54, 0xEA, 0xA1, 0x46, 0x3E, 0x26,
+    0xA4, 0x66, 0xE6, 0x9A, 0xFE, 0x44, 0x8B, 0x00, 0x9F, 0xDC, 0xC4, 0x23, 0x7C, 0x32, 0x6F, 0xF2,
+    0xDD, 0x4F, 0x4F, 0x60, 0xEC, 0x93, 0x87, 0x99, 0x17, 0x09, 0x83, 0xCB, 0x44, 0xEE, 0xC1, 0xB5,
+    0x91, 0x34, 0x7B, 0x49, 0xE9, 0x12, 0xB0, 0xCB, 0xF9, 0xD7, 0xC2, 0x98, 0x01, 0x4D, 0xBC, 0xEC,
+    0x24, 0xA5, 0x46, 0xAA, 0x34, 0xD2, 0x8C, 0x19, 0xDF, 0x82, 0xFF, 0x04, 0xDD, 0xBD, 0x4D, 0xAC,
+    0x25, 0xC7, 0x95, 0xDF, 0xF9, 0x8B, 0x0C, 0x56, 0xA5, 0xC4, 0x24, 0x19, 0x5A, 0x90, 0x86, 0xA4,
+    0x62, 0x33, 0x7B, 0xA1, 0x01, 0xD8, 0x12, 0xAB, 0x52, 0x8B, 0x9A, 0x01, 0x07, 0xF3, 0xEA, 0x45,
+    0x4A, 0xC2, 0x0C, 0x17, 0x5A, 0xA8, 0x0C, 0xB0, 0x84, 0x81, 0xB8, 0x18, 0x2D, 0x7A, 0xA1, 0x51,
+    0xC3, 0x28, 0x2E, 0xB8, 0xA0, 0x31, 0x55, 0x95, 0x29, 0x6B, 0xE1, 0x45, 0x2F, 0xA6, 0x80, 0x69,
+    0x7A, 0xDB, 0xB5, 0x90, 0x81, 0x16, 0x05, 0x4F, 0x71, 0x51, 0x0B, 0x02, 0x53, 0x55, 0x19, 0x22,
+    0x81, 0xE9, 0xD5, 0xB8, 0x53, 0x2D, 0x37, 0xBC, 0xB0, 0x81, 0x4E, 0xDB, 0xE4, 0xC8, 0x96, 0x17,
+    0x0C, 0xBB, 0x53, 0x50, 0x16, 0x95, 0x99, 0x67, 0x16, 0x27, 0xF2, 0xDE, 0xFB, 0xEA, 0x83, 0xA4,
+    0x6C, 0xCB, 0x23, 0x75, 0xA2, 0xEA, 0xE5, 0x7B, 0x79, 0xEF, 0xCD, 0x8C, 0x38, 0x71, 0xE2, 0x7C,
+    0xFC, 0xCF, 0x3F, 0xE2, 0x22, 0xD1, 0x4A, 0xEB, 0x66, 0x7C, 0x44, 0x6A, 0x3B, 0xA3, 0xC7, 0xFF,
+    0x49, 0x3E, 0x52, 0x05, 0x3A, 0xEC, 0x84, 0xEB, 0x69, 0x30, 0x33, 0xC5, 0x80, 0xAF, 0x99, 0xB1,
+    0x91, 0xB2, 0xE5, 0x0E, 0x36, 0xE2, 0x02, 0xC7, 0x98, 0x91, 0x3C, 0x50, 0xC1, 0x77, 0x00, 0xA8,
+    0xC1, 0xD5, 0x70, 0x04, 0x66, 0x80, 0x42, 0x7F, 0x3D, 0x23, 0xE4, 0x32, 0xD3, 0x2D, 0x17, 0xF3,
+    0x31, 0xE2, 0x8B, 0x3A, 0x9B, 0x8E, 0x70, 0x21, 0x72, 0x2D, 0x6F, 0xB3, 0xF1, 0x08, 0xD7, 0x47,
+    0xFC, 0x4B, 0x2D, 0x72, 0x01, 0x2B, 0x1F, 0xB6, 0xB9, 0x48, 0x5D, 0x88, 0x90, 0xC9, 0x88, 0x0D,
+    0x70, 0x16, 0x78, 0x8B, 0xFD, 0xF1, 0x4C, 0x0D, 0x94, 0x32, 0x40, 0x2E, 0x12, 0xA1, 0x7B, 0x2F,
+    0x8F, 0xD8, 0x89, 0x0C, 0x5C, 0x0B, 0x70, 0x05, 0xC0, 0x44, 0x80, 0x3C, 0x00, 0x94, 0xEC, 0x2E,
+    0x13, 0x01, 0x6C, 0x0F, 0xDA, 0x52, 0x1E, 0xEF, 0xDE, 0xFC, 0x33, 0x68, 0x44, 0x06, 0x32, 0x11,
+    0x01, 0xCA, 0x00, 0x70, 0x17, 0x20, 0x1F, 0x01, 0xBA, 0x16, 0xA8, 0x26, 0xC0, 0xAD, 0x35, 0xE0,
+    0x45, 0xFE, 0x1D, 0x46, 0x44, 0x84, 0x42, 0x44, 0xD6, 0xD4, 0x2E, 0x33, 0x70, 0x85, 0xAE, 0xBB,
+    0xD9, 0xE7, 0x22, 0x13, 0x55, 0xBF, 0x62, 0x07, 0xDB, 0x33, 0x73, 0x01, 0xD7, 0x16, 0xBD, 0x99,
+    0xCC, 0x4C, 0xD9, 0x77, 0x6D, 0x26, 0x32, 0x22, 0x22, 0xC1, 0x7F, 0x20, 0x8B, 0x89, 0xCF, 0xB8,
+    0xFA, 0x53, 0x70, 0x11, 0x5E, 0x06, 0x53, 0x17, 0x03, 0x66, 0xC6, 0xD7, 0xDC, 0x25, 0x9B, 0xA9,
+    0x5A, 0xCA, 0xC1, 0x0D, 0x20, 0x2F, 0x4D, 0x90, 0x2F, 0x2B, 0xE0, 0xA5, 0x05, 0x23, 0x03, 0xE0,
+    0x26, 0x80, 0x0E, 0xC0, 0x49, 0x8F, 0x11, 0x59, 0xC0, 0xCB, 0x3F, 0x03, 0x74, 0x34, 0x7D, 0x0B,
+    0x14, 0x23, 0x80, 0x3C, 0x06, 0x4E, 0x64, 0xC0, 0x6A, 0x8B, 0x7D, 0xD8, 0xBD, 0xAB, 0x69, 0x81,
+    0x22, 0x02, 0x98, 0x9E, 0x23, 0x6C, 0xE0, 0x75, 0x8A, 0x9A, 0xC8, 0x73, 0x64, 0x3D, 0x47, 0x1C,
+    0x1E, 0x59, 0xCF, 0x11, 0x79, 0xCB, 0x2D, 0x1C, 0x44, 0xCE, 0x61, 0xC3, 0x76, 0x01, 0xA0, 0x58,
+    0x01, 0xA3, 0x72, 0xAC, 0x1D, 0x10, 0x79, 0x1A, 0xF2, 0x1A, 0x74, 0x20, 0xE1, 0x6E, 0x0D, 0x54,
+    0x72, 0x0F, 0x72, 0x91, 0x15, 0xFC, 0xF5, 0xD3, 0x33, 0x59, 0xC4, 0x4C, 0xB8, 0x1A, 0x3B, 0x70,
+    0x01, 0xCA, 0x9A, 0xF5, 0x22, 0x33, 0x99, 0x7C, 0x78, 0x73, 0xC0, 0xE8, 0xB8, 0x9C, 0x91, 0x61,
+    0xD7, 0x64, 0xA7, 0x7D, 0x0A, 0xE4, 0x22, 0x4B, 0x1A, 0x3E, 0x2B, 0xB2, 0xC0, 0x69, 0xF9, 0xB0,
+    0xDE, 0xDA, 0x5A, 0xF4, 0x45, 0xBF, 0xB0, 0x54, 0x7D, 0xF5, 0xEE, 0x6C, 0xE7, 0x2E, 0x74, 0x81,
+    0x6A, 0xE0, 0xF5, 0x9C, 0xFF, 0x2D, 0xFC, 0xFE, 0x31, 0x4F, 0x7C, 0x09, 0xFB, 0x54, 0xCB, 0xBB,
+    0x6F, 0x71, 0xFD, 0xAF, 0xFB, 0x57, 0xBF, 0x70, 0xF1, 0x55, 0xFB, 0x95, 0x5B, 0x54, 0xD7, 0x01,
+    0x8A, 0x7F, 0x69, 0xFF, 0x79, 0x18, 0x5E, 0x78, 0xD6, 0xBE, 0xD3, 0xBE, 0x78, 0xBE, 0xF8, 0xDA,
+    0x3F, 0x1A, 0xBD, 0xB0, 0xBE, 0xEA, 0x7F, 0x78, 0x31, 0x17, 0x59, 0xFE, 0x48, 0xA4, 0x87, 0x19,
+    0x5C, 0xC0, 0x4C, 0x50, 0xD5, 0xD8, 0x08, 0xCF, 0xE0, 0x45, 0x7E, 0x29, 0xB2, 0x74, 0x22, 0x81,
+    0x33, 0x03, 0x2F, 0xDA, 0xDA, 0x0F, 0x5F, 0xFE, 0xEF, 0x9E, 0xF8, 0xD4, 0xE7, 0xFE, 0xA7, 0xEC,
+    0x89, 0x8E, 0x77, 0xFF, 0xDB, 0xF0, 0xEA, 0xBF, 0xFC, 0xF2, 0xF9, 0xEA, 0xD9, 0x17, 0xED, 0xF7,
+    0x6E, 0x51, 0x0D, 0x00, 0x9D, 0xFC, 0xEB, 0x37, 0xFF, 0xB1, 0x36, 0xF7, 0x72, 0xC4, 0xC9, 0xC8,
+    0x6A, 0xA3, 0xEB, 0x6D, 0x7F, 0x15, 0xF7, 0xFD, 0xC8, 0x05, 0x17, 0xB2, 0xD8, 0x50, 0xB6, 0x6B,
+    0x36, 0x67, 0x22, 0xBD, 0x95, 0x05, 0x2B, 0xED, 0xA6, 0x6F, 0x75, 0xD2, 0xF2, 0x09, 0xB8, 0xA0,
+    0x6A, 0xFE, 0xE6, 0xCD, 0x9F, 0x5F, 0xF7, 0x22, 0x23, 0xD9, 0xE1, 0x0B, 0x15, 0x70, 0xAA, 0xDE,
+    0x8F, 0xE1, 0x37, 0xDF, 0x9C, 0x11, 0x11, 0x2E, 0x5D, 0xD4, 0xBF, 0xAB, 0x21, 0xFB, 0x5A, 0xCB,
+    0xF3, 0xD8, 0x9A, 0xC8, 0x15, 0x2A, 0xCA, 0xD6, 0x4A, 0x68, 0x66, 0xE8, 0x6A, 0x9E, 0x80, 0xC0,
+    0xF3, 0x2C, 0xF0, 0x16, 0xB6, 0xE6, 0xD5, 0xC7, 0x4A, 0x2B, 0xA1, 0x1A, 0xE0, 0x0F, 0xF3, 0x70,
+    0xC1, 0x0E, 0x95, 0x19, 0x21, 0xEF, 0xA9, 0xEA, 0x2C, 0xE2, 0x82, 0x9A, 0x08, 0x8F, 0x99, 0xD4,
+    0x4E, 0xB8, 0x1E, 0x8F, 0x8D, 0x94, 0x21, 0x9B, 0x29, 0x06, 0x56, 0xEC, 0x48, 0xD3, 0x66, 0x0B,
+    0x3E, 0x66, 0x82, 0x13, 0x91, 0x50, 0x88, 0xC8, 0x60, 0x3F, 0x10, 0x19, 0xCD, 0xCF, 0x64, 0x99,
+    0x89, 0xCD, 0xD4, 0xA8, 0xD6, 0x9D, 0x05, 0x78, 0x7C, 0xEB, 0xEF, 0xC5, 0xA7, 0xA1, 0xE9, 0x2F,
+    0x90, 0x49, 0x38, 0xA2, 0x90, 0x70, 0x05, 0x27, 0xF5, 0xDB, 0x54, 0xC2, 0x48, 0x25, 0x44, 0xAA,
+    0xC5, 0x44, 0xAA, 0x39, 0x1B, 0x70, 0xB3, 0xED, 0xB1, 0xA3, 0x0D, 0x14, 0x31, 0x0F, 0xB8, 0x58,
+    0xB4, 0x94, 0xBD, 0xAB, 0xF1, 0xC1, 0x41, 0x13, 0x4A, 0x90, 0xFA, 0x1C, 0x46, 0xB8, 0x80, 0x5D,
+    0x39, 0xC2, 0x2E, 0x5C, 0xA1, 0x98, 0x79, 0x1B, 0x37, 0x31, 0x52, 0x8D, 0x44, 0x7C, 0x34, 0x91,
+    0x62, 0x58, 0xCB, 0x9F, 0x2E, 0x4D, 0x30, 0xB5, 0xE5, 0x53, 0xB8, 0x81, 0xF3, 0x9C, 0xFF, 0xD2,
+    0xD0, 0xB5, 0x3C, 0xCD, 0x6C, 0x5E, 0xE7, 0x3C, 0xAF, 0x32, 0xD0, 0x9B, 0x60, 0x83, 0x9F, 0x9B,
+    0x09, 0x28, 0xC7, 0xE2, 0xAB, 0x3F, 0x0E, 0x4F, 0xBC, 0x60, 0xDE, 0x6D, 0x5F, 0xBC, 0xF0, 0xCA,
+    0x57, 0xA5, 0x2F, 0x86, 0x4D, 0xEE, 0x65, 0x0B, 0xD0, 0xD5, 0x00, 0x7F, 0x0C, 0x80, 0x03, 0x5E,
+    0xE7, 0x39, 0x20, 0x72, 0x16, 0x9D, 0x4B, 0x38, 0x38, 0x82, 0xB3, 0xF0, 0x36, 0xDC, 0x82, 0x91,
+    0x6C, 0x80, 0x48, 0x1E, 0xF8, 0xD2, 0x87, 0x6D, 0x09, 0x8D, 0xB4, 0x47, 0xD0, 0x49, 0x3D, 0xD2,
+    0x83, 0x1D, 0x6C, 0x80, 0xA2, 0x75, 0x01, 0x2A, 0x8E, 0x03, 0xDC, 0xE6, 0x6F, 0x5A, 0x4C, 0xB4,
+    0x7F, 0x5E, 0x93, 0xF7, 0xAE, 0xA8, 0x71, 0xED, 0x91, 0x83, 0x63, 0x44, 0x22, 0x33, 0x22, 0x83,
+    0x8D, 0x70, 0x4C, 0x11, 0xE0, 0x2A, 0x55, 0x0D, 0xB7, 0x79, 0x06, 0x98, 0xE1, 0x4C, 0x50, 0x7D,
+    0x00, 0xF8, 0xB4, 0x1A, 0x5D, 0xB5, 0xE5, 0x4F, 0x81, 0x19, 0x28, 0x6A, 0x88, 0xD8, 0x00, 0x71,
+    0xFB, 0xA7, 0x6D, 0xBC, 0x00, 0x6F, 0x83, 0x83, 0xB7, 0xE1, 0xE6, 0xCF, 0xB9, 0xF2, 0xF9, 0xBA,
+    0x91, 0xF6, 0xAA, 0xCC, 0x95, 0xF4, 0x47, 0xAF, 0x15, 0x01, 0x2E, 0x40, 0x84, 0x63, 0x38, 0x82,
+    0x73, 0x70, 0x0E, 0x2A, 0x28, 0xF5, 0x67, 0x4D, 0x09, 0x55, 0x4B, 0x59, 0xD3, 0xD5, 0xB8, 0xD6,
+    0x88, 0xFE, 0x04, 0x17, 0x10, 0x09, 0x2E, 0xD0, 0xC8, 0x50, 0x04, 0xBE, 0xF8, 0xE6, 0x0F, 0x36,
+    0x51, 0x5E, 0x7E, 0x0F, 0xE0, 0xBF, 0x7F, 0x45, 0xB5, 0xFA, 0x06, 0x00, 0xCF, 0xC3, 0x8B, 0xF0,
+    0x24, 0x1C, 0x41, 0x09, 0x47, 0x14, 0x0B, 0x1C, 0x91, 0xDD, 0xAC, 0x39, 0x0B, 0x8C, 0x9C, 0x03,
+    0xCE, 0xF2, 0x1C, 0xE0, 0x28, 0x81, 0x32, 0x94, 0xE0, 0x25, 0x38, 0xA8, 0xA4, 0x77, 0xF5, 0x93,
+    0xA7, 0xEF, 0xD6, 0xAE, 0x75, 0x6C, 0xE2, 0x2C, 0x82, 0x7B, 0x0B, 0x8A, 0xE0, 0x5E, 0x84, 0x3C,
+    0xB8, 0xDF, 0x23, 0xC9, 0xD3, 0x0E, 0xCE, 0x06, 0xEC, 0xE0, 0x44, 0xB0, 0xD1, 0x8A, 0xB4, 0x59,
+    0x84, 0x63, 0xB2, 0x08, 0x65, 0x9D, 0x8D, 0x50, 0x04, 0x5E, 0x06, 0x1B, 0x01, 0xAA, 0x08, 0x48,
+    0x9D, 0x4C, 0x97, 0x1B, 0x00, 0x7F, 0xC2, 0xA4, 0x9A, 0x1A, 0xCC, 0x0A, 0xB8, 0x98, 0x0C, 0xB3,
+    0x59, 0x37, 0xBB, 0xDD, 0x04, 0x28, 0x04, 0x90, 0x21, 0xD9, 0x7B, 0xD9, 0x6E, 0xB2, 0x02, 0x79,
+    0x04, 0x7C, 0x0D, 0x66, 0x06, 0x8A, 0x21, 0xFD, 0xC5, 0x02, 0xEA, 0x12, 0x8B, 0x89, 0x6B, 0xB8,
+    0xF5, 0x66, 0xA4, 0x94, 0x15, 0x4E, 0xEF, 0xAC, 0x07, 0x70, 0x3B, 0x0B, 0xC0, 0x71, 0x3C, 0x02,
+    0xF2, 0xEF, 0xBF, 0x54, 0x03, 0x6F, 0x9D, 0x8B, 0x80, 0x63, 0xE1, 0x11, 0xC7, 0xCA, 0x5E, 0x41,
+    0xAC, 0x00, 0x20, 0x11, 0xA0, 0xEC, 0x00, 0xEC, 0xDF, 0x44, 0x80, 0xC5, 0xD7, 0x40, 0xF9, 0xEE,
+    0x08, 0xD8, 0xE8, 0x6B, 0xE0, 0x6E, 0x36, 0x01, 0x65, 0xA8, 0x5A, 0xB0, 0x63, 0x36, 0x03, 0x1D,
+    0x55, 0x80, 0x32, 0x98, 0x19, 0xEC, 0x44, 0x19, 0xA0, 0xC3, 0x2C, 0xE0, 0x7A, 0x5C, 0x8F, 0x55,
+    0xDF, 0xDA, 0x89, 0xC8, 0x80, 0x13, 0x91, 0x15, 0x2B, 0x22, 0x12, 0x69, 0x5A, 0x10, 0x5C, 0x04,
+    0x17, 0xB3, 0x15, 0x10, 0x9A, 0x00, 0xE5, 0xA8, 0x1E, 0x2A, 0x02, 0x3C, 0xF9, 0x2C, 0xC0, 0xF9,
+    0x27, 0x00, 0xCE, 0xBF, 0xB8, 0x1B, 0x07, 0x8A, 0x96, 0x8F, 0x38, 0x56, 0x80, 0x6C, 0xDD, 0xF7,
+    0xCE, 0xC9, 0xBE, 0x73, 0xDE, 0xEF, 0xFA, 0x66, 0x66, 0x5F, 0x6F, 0x5D, 0x2B, 0x86, 0xAA, 0xDD,
+    0x7A, 0xE6, 0xEB, 0x2A, 0xA4, 0x8E, 0x99, 0x99, 0x32, 0xA4, 0x7E, 0x15, 0x91, 0xB2, 0x4F, 0xDD,
+    0xF2, 0x22, 0x32, 0xA4, 0x5E, 0x89, 0x88, 0x0C, 0xDA, 0xA9, 0x7C, 0x02, 0x17, 0xB5, 0x4F, 0xD5,
+    0x00, 0x2E, 0x1E, 0x74, 0x69, 0x8B, 0x7A, 0x28, 0x45, 0x64, 0xD6, 0xD6, 0x89, 0x48, 0x00, 0x10,
+    0x11, 0x79, 0x0F, 0xC0, 0x4B, 0x9F, 0xDC, 0xDE, 0x07, 0x29, 0x94, 0x33, 0xF7, 0xB6, 0xE1, 0x6E,
+    0xB6, 0x1B, 0xB9, 0x1F, 0xEB, 0xA0, 0x61, 0xC7, 0x32, 0xD9, 0xA5, 0x25, 0x5B, 0x2F, 0xFD, 0xAF,
+    0x00, 0x55, 0x5B, 0xE9, 0x3D, 0xF3, 0x98, 0xE9, 0x63, 0xCC, 0x8C, 0x17, 0x69, 0x01, 0xBF, 0xC5,
+    0x87, 0x6E, 0xD0, 0x78, 0x81, 0x6C, 0x4A, 0xF1, 0x07, 0xDD, 0xCF, 0xDF, 0xD4, 0xE7, 0x94, 0x22,
+    0x32, 0xED, 0x5A, 0xD7, 0x6E, 0xAD, 0x13, 0x11, 0xF0, 0x81, 0x5C, 0x44, 0x06, 0x8A, 0x11, 0x3A,
+    0x91, 0x15, 0x23, 0xE0, 0x44, 0x64, 0xA0, 0x09, 0x70, 0x10, 0x48, 0xE9, 0x21, 0xF2, 0x03, 0xBD,
+    0xE5, 0x04, 0x99, 0x88, 0x44, 0xF0, 0x22, 0x12, 0xC8, 0x23, 0xA5, 0x40, 0x07, 0xD5, 0x88, 0x1B,
+    0xA0, 0x6B, 0x59, 0xC0, 0xCE, 0x94, 0x01, 0x7C, 0xC8, 0x66, 0xB0, 0x33, 0xBE, 0x05, 0xFF, 0xAE,
+    0xC8, 0x8A, 0x9D, 0x3B, 0x91, 0x1E, 0xFF, 0x17, 0x22, 0x33, 0xF9, 0xCC, 0x0A, 0x74, 0xAD, 0xEB,
+    0xC1, 0x8D, 0x66, 0x06, 0x2B, 0x54, 0x2D, 0x99, 0x0C, 0xF6, 0xDE, 0xA5, 0x57, 0x64, 0xA6, 0x11,
+    0xD1, 0x10, 0x74, 0x1B, 0xA2, 0x09, 0x27, 0x22, 0x33, 0x46, 0x44, 0x16, 0xA8, 0xB4, 0x69, 0x00,
+    0x17, 0x0D, 0x40, 0x3E, 0x39, 0x00, 0x77, 0xF6, 0x29, 0x80, 0x17, 0xDC, 0x6D, 0x80, 0x23, 0x3B,
+    0x3E, 0x52, 0xCD, 0x2E, 0x4B, 0x0B, 0x14, 0x2A, 0xAD, 0x46, 0x3A, 0x01, 0x23, 0x7D, 0x26, 0x2D,
+    0xF9, 0x0A, 0x5D, 0xC0, 0x8D, 0xE0, 0x7B, 0xFC, 0x00, 0x95, 0x0A, 0xBC, 0x1C, 0xD2, 0xCC, 0x37,
+    0x0B, 0xE0, 0x7A, 0x35, 0x26, 0xBD, 0x1D, 0x81, 0x32, 0xE4, 0x11, 0xA8, 0x42, 0xA1, 0xE6, 0xC0,
+    0x0D, 0x40, 0xA3, 0x56, 0x42, 0xE7, 0x89, 0x5D, 0x70, 0x13, 0x94, 0x33, 0x4E, 0x2E, 0xFE, 0x1D,
+    0x19, 0x71, 0x3A, 0x93, 0x0A, 0x55, 0x23, 0x2B, 0x22, 0x52, 0x93, 0x25, 0xED, 0x6A, 0x44, 0x06,
+    0xE0, 0xB4, 0xDC, 0x3B, 0x88, 0xFB, 0x62, 0x11, 0xDC, 0xBB, 0x03, 0xCD, 0x44, 0xB6, 0x82, 0x1F,
+    0x28, 0xA5, 0x2D, 0xFE, 0xC3, 0x92, 0x4F, 0xC5, 0x23, 0xFB, 0xF9, 0xF7, 0x0E, 0x7E, 0xF7, 0x07,
+    0xF3, 0xCE, 0x0D, 0xFB, 0xDF, 0xED, 0xF4, 0x80, 0x75, 0x79, 0xC8, 0x07, 0xE2, 0xC1, 0x07, 0xE6,
+    0x43, 0x25, 0x39, 0xFC, 0x40, 0x78, 0xD8, 0x07, 0x2E, 0xAF, 0xDF, 0xDF, 0x7D, 0xA0, 0xD3, 0x40,
+    0x52, 0x67, 0x84, 0x74, 0xB2, 0x7D, 0xA0, 0x5C, 0x34, 0xBC, 0x07, 0xC8, 0x57, 0xB2, 0xDD, 0x0B,
+    0x52, 0xD3, 0x6D, 0xA6, 0xD0, 0x0F, 0x54, 0x92, 0x1A, 0x9E, 0x4F, 0x14, 0xBF, 0x58, 0x77, 0x6D,
+    0xC8, 0x96, 0xAD, 0x47, 0x65, 0x4F, 0x57, 0x2F, 0xBB, 0x86, 0x56, 0x7D, 0x99, 0xE6, 0xA4, 0xAF,
+    0x8B, 0xC9, 0xA4, 0x86, 0xE4, 0x31, 0x5B, 0xA9, 0xD2, 0x33, 0x3A, 0xBA, 0x76, 0xD3, 0x14, 0x37,
+    0x54, 0x03, 0xCD, 0x26, 0x8B, 0x62, 0xDA, 0x75, 0xC3, 0xFD, 0xC7, 0x15, 0xBB, 0xEC, 0x26, 0x46,
+    0x6B, 0xB6, 0x16, 0x3A, 0x19, 0xFF, 0x8E, 0x8C, 0xBB, 0x17, 0xF6, 0xFD, 0x2B, 0x76, 0xF6, 0x21,
+    0xF5, 0x7B, 0x7B, 0x53, 0xB5, 0x59, 0x90, 0xF4, 0xA6, 0xAD, 0x17, 0x99, 0x1C, 0x0C, 0x77, 0x77,
+    0x20, 0xCA, 0xEA, 0x40, 0xF6, 0xC5, 0x81, 0x5F, 0xC8, 0xE4, 0x20, 0xA2, 0xEC, 0xFA, 0x83, 0x0F,
+    0x8C, 0x0F, 0xFF, 0x80, 0x39, 0xF4, 0x3D, 0xCD, 0x81, 0x0A, 0x94, 0xD7, 0xF7, 0xBF, 0x9F, 0xAE,
+    0x3F, 0xC2, 0x3A, 0x9B, 0xEB, 0xBB, 0x0C, 0x6E, 0x04, 0x78, 0x1B, 0xE0, 0x36, 0xC0, 0x55, 0x3E,
+    0xF9, 0x61, 0x27, 0xB0, 0xA3, 0x80, 0x9D, 0xAA, 0x40, 0x36, 0xE7, 0x23, 0xD9, 0x8C, 0x60, 0x16,
+    0x7C, 0x60, 0xA5, 0x18, 0x11, 0xB2, 0x15, 0x81, 0x26, 0x74, 0x35, 0x6E, 0xEC, 0x5A, 0xEC, 0xDA,
+    0x04, 0xE8, 0xA4, 0x87, 0x52, 0x7A, 0xC8, 0x65, 0xD8, 0x5C, 0x9F, 0x1F, 0xB7, 0x54, 0xCC, 0x2E,
+    0x40, 0x26, 0x29, 0x35, 0x81, 0x6E, 0xD8, 0x5E, 0x2E, 0xE7, 0xCD, 0x97, 0xE4, 0x2A, 0x85, 0x7C,
+    0x48, 0x71, 0x39, 0x33, 0x60, 0x7F, 0x01, 0x94, 0xD2, 0xEA, 0x13, 0xEC, 0xD8, 0x0C, 0x94, 0x6D,
+    0xD9, 0x73, 0x87, 0x32, 0xD8, 0x48, 0x89, 0x0B, 0x5C, 0xE1, 0x1A, 0x76, 0xC8, 0x46, 0x1A, 0x5C,
+    0x28, 0x46, 0x8E, 0x33, 0xA9, 0x8D, 0xCE, 0xE1, 0x7B, 0xE0, 0xEF, 0xA5, 0x78, 0x3F, 0xEF, 0xB7,
+    0xF8, 0x62, 0xDE, 0x1E, 0x03, 0x98, 0x3F, 0x04, 0x2A, 0x09, 0x98, 0xC5, 0x44, 0x6C, 0xE4, 0x2D,
+    0x8A, 0xC0, 0x6B, 0xB8, 0x9A, 0x57, 0xA9, 0x28, 0x23, 0xC7, 0xDC, 0x81, 0x0B, 0x66, 0x80, 0x2B,
+    0x36, 0xC0, 0x6C, 0x5B, 0xFD, 0x61, 0x26, 0x3B, 0x90, 0x8D, 0xD9, 0x84, 0x8D, 0x08, 0x79, 0xA4,
+    0x6A, 0x8B, 0x01, 0x17, 0x5C, 0x8F, 0x0B, 0x65, 0x4F, 0xD9, 0x56, 0xFF, 0xF4, 0x52, 0x87, 0xFF,
+    0x0B, 0x59, 0xF1, 0xFF, 0xBB, 0x4C, 0x74, 0x2F, 0x49, 0x0B, 0x54, 0xED, 0x79, 0xCC, 0xAF, 0xBE,
+    0x1A, 0x70, 0xEE, 0x29, 0x78, 0xDD, 0x45, 0x4C, 0xF8, 0xFC, 0xA6, 0x3B, 0x2B, 0xD0, 0xC9, 0x15,
+    0xCD, 0x48, 0xA5, 0xEE, 0xDA, 0x3C, 0xB2, 0x70, 0x8C, 0x8D, 0x59, 0xC4, 0x05, 0x57, 0xE3, 0xB9,
+    0xA2, 0xCF, 0x76, 0x83, 0xAB, 0xE9, 0xEA, 0x63, 0xDC, 0x8C, 0x7C, 0x4B, 0xA2, 0x4D, 0x29, 0xC3,
+    0x8A, 0x93, 0x7B, 0x13, 0xC5, 0xFA, 0x52, 0xBF, 0x69, 0xC0, 0x0B, 0x5F, 0x86, 0xDC, 0xD6, 0x70,
+    0xE3, 0x3C, 0x3C, 0x5E, 0x00, 0x4D, 0x0F, 0xE6, 0xC6, 0x61, 0xFA, 0xBA, 0x42, 0x26, 0x4B, 0x44,
+    0x64, 0xC5, 0xF7, 0xD5, 0x90, 0x47, 0x16, 0x26, 0x5C, 0xA8, 0x60, 0xB6, 0x3D, 0x2E, 0x5C, 0xC1,
+    0x4C, 0xAE, 0xC5, 0xB7, 0x23, 0xC5, 0xE8, 0x5A, 0x2B, 0xC8, 0xB7, 0x24, 0x3A, 0x11, 0xA1, 0x13,
+    0x19, 0xAC, 0xAC, 0xD7, 0x76, 0x4F, 0xDD, 0xEE, 0x99, 0xAD, 0x35, 0x99, 0x2C, 0xFF, 0x51, 0x56,
+    0xF5, 0x64, 0xF5, 0x2D, 0x7C, 0x5F, 0x09, 0x36, 0xE4, 0x11, 0x09, 0x9C, 0x65, 0xC2, 0x45, 0xF3,
+    0x47, 0x7D, 0xA5, 0xAF, 0xDB, 0x1E, 0x27, 0x22, 0xFD, 0x15, 0xCC, 0xF2, 0x32, 0xB8, 0x56, 0xCD,
+    0xDD, 0x48, 0x31, 0x01, 0xAE, 0xB5, 0x12, 0x00, 0xF9, 0x96, 0x48, 0x4B, 0xEB, 0x44, 0x44, 0x64,
+    0xA6, 0x13, 0x11, 0x91, 0x60, 0x65, 0x6D, 0x44, 0x26, 0x8A, 0xF5, 0xA5, 0xBF, 0xEC, 0xDE, 0x03,
+    0xC8, 0xDE, 0xD3, 0xF9, 0xDF, 0xC2, 0x16, 0x74, 0xEA, 0xB4, 0x50, 0x1B, 0xA0, 0xE6, 0xBC, 0x52,
+    0x1B, 0x90, 0xA9, 0x46, 0x8C, 0x90, 0x49, 0x7F, 0x05, 0x72, 0x59, 0xCE, 0x41, 0x3E, 0x15, 0x7F,
+    0x01, 0xDA, 0x56, 0x3B, 0x52, 0xF6, 0x98, 0x89, 0x3C, 0xC2, 0x6D, 0xCC, 0x08, 0x7E, 0xCB, 0x77,
+    0xEF, 0x80, 0x9D, 0xCC, 0x5D, 0xBD, 0xB5, 0xBA, 0x67, 0x20, 0x53, 0xB3, 0x73, 0x26, 0xD9, 0x8F,
+    0x32, 0xBC, 0x08, 0xBF, 0x6A, 0x7B, 0x8A, 0xAF, 0x17, 0x70, 0xE4, 0x26, 0xCC, 0x50, 0x3E, 0x3A,
+    0xEC, 0x3A, 0xB3, 0x42, 0x26, 0x52, 0xD3, 0xFC, 0x5C, 0x6A, 0x3B, 0x72, 0x0D, 0x0F, 0xB3, 0x19,
+    0xB1, 0xD1, 0x05, 0x5C, 0xB8, 0x0A, 0x3E, 0x8B, 0x64, 0xA3, 0x0B, 0xB8, 0xE0, 0x6B, 0x56, 0xE4,
+    0x8D, 0xCB, 0x31, 0x13, 0x11, 0xAC, 0xC8, 0x48, 0x2E, 0x2B, 0x64, 0x72, 0x7D, 0x97, 0x62, 0xAD,
+    0x6A, 0xA2, 0xC1, 0xF7, 0x60, 0xE4, 0x21, 0x26, 0xE5, 0x99, 0x8B, 0x95, 0x88, 0xFC, 0xA5, 0xBA,
+    0xBD, 0xBD, 0xE5, 0xDA, 0x02, 0x69, 0x17, 0x53, 0xE8, 0x9D, 0xED, 0x1D, 0x8C, 0x49, 0xC6, 0x5B,
+    0x4D, 0xA3, 0xD5, 0x53, 0x92, 0x26, 0xC9, 0x46, 0x26, 0x27, 0xA2, 0x48, 0x13, 0xC7, 0x49, 0x1C,
+    0xC9, 0x54, 0xEB, 0x83, 0x8A, 0xF4, 0xF9, 0xFE, 0x20, 0x56, 0x4D, 0x60, 0x95, 0xE9, 0x26, 0x35,
+    0xAC, 0x52, 0x03, 0xF9, 0xDA, 0x45, 0xC0, 0x8E, 0xD5, 0x35, 0xC0, 0xC6, 0xF2, 0x1B, 0x01, 0xCC,
+    0xE8, 0xDE, 0x89, 0xC0, 0x9C, 0xF7, 0x33, 0x70, 0xD5, 0x0E, 0xC7, 0x40, 0x95, 0xC5, 0xAA, 0x06,
+    0xF7, 0xE3, 0xD1, 0x05, 0xB0, 0x71, 0x56, 0xCF, 0x7F, 0xF7, 0x72, 0x54, 0x83, 0x1F, 0x35, 0x24,
+    0x1B, 0xD5, 0xEF, 0x0D, 0xEA, 0x38, 0xAE, 0xB3, 0xB7, 0x0F, 0x49, 0x67, 0xB2, 0x64, 0xB9, 0x93,
+    0x7F, 0xB8, 0x93, 0x4C, 0xF5, 0xE6, 0xC1, 0xD2, 0xE0, 0x6A, 0x6F, 0xF4, 0x54, 0x3C, 0xF4, 0xF3,
+    0x49, 0x28, 0xD7, 0x1F, 0x94, 0x7B, 0xDE, 0xEE, 0x7A, 0x7B, 0x01, 0x12, 0x60, 0xA7, 0x42, 0xF8,
+    0x03, 0xFE, 0x13, 0x8E, 0x09, 0x66, 0x5C, 0xA0, 0xAC, 0x15, 0x93, 0x2C, 0x06, 0xEE, 0x40, 0x83,
+    0x0B, 0xD8, 0x68, 0x47, 0xF0, 0x6D, 0x03, 0xD9, 0xEC, 0x7A, 0x28, 0xDF, 0x99, 0x81, 0xD5, 0xD7,
+    0xE0, 0x7E, 0x15, 0x41, 0x5D, 0x7B, 0x2E, 0x61, 0x33, 0xD2, 0x1A, 0xF1, 0xFB, 0x1E, 0xC8, 0xE7,
+    0xE4, 0xFE, 0xA1, 0x89, 0x40, 0x33, 0x83, 0x15, 0xD9, 0xE0, 0xB7, 0x5C, 0xFA, 0x0D, 0xC9, 0xDA,
+    0x54, 0x67, 0x93, 0xC2, 0xF1, 0x66, 0x83, 0x6F, 0x03, 0x6E, 0x05, 0x64, 0x81, 0xF2, 0xA5, 0x89,
+    0x2C, 0x16, 0x3D, 0xC7, 0x78, 0x6C, 0x6F, 0x22, 0x57, 0x70, 0x14, 0x81, 0xC8, 0xC4, 0x39, 0x5C,
+    0x9D, 0x07, 0x13, 0x99, 0xA8, 0xF0, 0xD8, 0xA1, 0x0C, 0x5C, 0x70, 0x23, 0xB9, 0xCC, 0xDA, 0x48,
+    0xF7, 0x5E, 0xF2, 0x78, 0xE5, 0x26, 0xAD, 0xE3, 0x4D, 0x85, 0xAE, 0x00, 0xA7, 0xDB, 0xA4, 0x4B,
+    0x59, 0x84, 0x32, 0x94, 0x01, 0x04, 0x81, 0x7C, 0xCE, 0x67, 0xF0, 0xD1, 0xC7, 0x4F, 0xE2, 0x15,
+    0x87, 0x84, 0xE9, 0x96, 0x35, 0x55, 0xCD, 0x0C, 0x77, 0x29, 0x7A, 0xCC, 0x8C, 0x27, 0xC9, 0xD2,
+    0x0D, 0x65, 0x80, 0x2A, 0x2C, 0x40, 0x53, 0xC4, 0x4D, 0x98, 0x76, 0x9D, 0x81, 0x42, 0x7A, 0xA0,
+    0x54, 0x11, 0x8E, 0x3B, 0x17, 0xA8, 0x51, 0x4B, 0x19, 0x77, 0xE2, 0x2C, 0xE7, 0x4D, 0xE8, 0x4E,
+    0xE6, 0x3D, 0x9C, 0x39, 0x02, 0xC5, 0x7B, 0xFB, 0xE6, 0x9C, 0xBA, 0x08, 0x24, 0xA4, 0x52, 0x64,
+    0xF8, 0xC8, 0xA6, 0x6B, 0xF0, 0xA5, 0x59, 0x1B, 0xDA, 0x59, 0x4D, 0xDB, 0xCC, 0xAF, 0xE2, 0x3E,
+    0x6F, 0x73, 0x3F, 0x1D, 0xD9, 0x12, 0x37, 0xBC, 0x1D, 0xD9, 0x32, 0x37, 0x33, 0x67, 0x13, 0x5B,
+    0xEA, 0x56, 0xC4, 0x6C, 0x26, 0xE5, 0x6E, 0xF8, 0xD6, 0xCC, 0xA4, 0xE4, 0x8D, 0x05, 0x16, 0x52,
+    0xF6, 0x96, 0x02, 0x27, 0xCD, 0x10, 0xBC, 0x88, 0x08, 0x9A, 0xBF, 0x21, 0x80, 0xA0, 0x09, 0x5C,
+    0x3E, 0x6F, 0xD6, 0xC7, 0xBC, 0x4C, 0x26, 0x32, 0x53, 0xEC, 0x63, 0xAF, 0x5D, 0x1E, 0x9D, 0xC9,
+    0x12, 0xD5, 0x0F, 0xFA, 0xBE, 0x1A, 0x68, 0x70, 0x3D, 0x13, 0x2E, 0x64, 0x11, 0x17, 0x6C, 0x8F,
+    0x0B, 0x79, 0xA0, 0x6C, 0x5D, 0x8B, 0x6F, 0x5D, 0x4D, 0x57, 0xBB, 0xD6, 0x0A, 0xEE, 0x17, 0x37,
+    0x15, 0x3D, 0xA3, 0xD0, 0xC4, 0x78, 0xBD, 0x06, 0xDD, 0x7B, 0x57, 0x13, 0x60, 0x76, 0x1D, 0x88,
+    0xBC, 0x00, 0xB8, 0xB6, 0x08, 0x40, 0x97, 0x8C, 0xC0, 0x0C, 0x50, 0xDC, 0xFB, 0x44, 0x93, 0xEB,
+    0xB7, 0x5D, 0xAE, 0xE6, 0x3A, 0xCF, 0x93, 0xF5, 0xBC, 0x4E, 0x16, 0x4D, 0x04, 0x91, 0x1E, 0x3A,
+    0xA9, 0xE1, 0xCC, 0x7B, 0x0F, 0xF6, 0xE6, 0x37, 0x23, 0x6B, 0x4D, 0x59, 0x8A, 0x69, 0x27, 0x22,
+    0xF5, 0xDC, 0x0A, 0x18, 0xCC, 0xF3, 0x4E, 0x3E, 0x8D, 0xEB, 0x37, 0xBC, 0xA0, 0x6A, 0xEF, 0x6E,
+    0xC2, 0x71, 0x7D, 0x11, 0x13, 0x5C, 0x90, 0x47, 0x9A, 0x24, 0x99, 0x6C, 0x26, 0x1F, 0x13, 0x5A,
+    0x20, 0x22, 0xD2, 0xAA, 0x58, 0xBC, 0x88, 0x4C, 0x0A, 0x16, 0x94, 0x03, 0xF8, 0x20, 0x80, 0x14,
+    0x13, 0xD8, 0x79, 0x8F, 0x15, 0xDC, 0xDA, 0x60, 0xC5, 0xE4, 0x94, 0x72, 0xF6, 0x13, 0xF0, 0x4C,
+    0xE0, 0x37, 0x11, 0x0A, 0x5D, 0xEE, 0x93, 0x5B, 0x1B, 0x80, 0xDF, 0xDB, 0x66, 0x7A, 0x72, 0x6D,
+    0xBC, 0xBE, 0xA1, 0x88, 0x3B, 0x8F, 0x58, 0x69, 0x93, 0x6A, 0x80, 0xC7, 0xDB, 0x5F, 0xD7, 0xE4,
+    0x9F, 0x91, 0xEB, 0x60, 0x44, 0x26, 0xC8, 0x45, 0x66, 0x28, 0xE4, 0x8D, 0x6F, 0x25, 0x53, 0x8B,
+    0x9B, 0xF7, 0x3F, 0x75, 0x50, 0xD4, 0x92, 0x6B, 0xD2, 0x68, 0xD6, 0x83, 0xA4, 0x51, 0x51, 0x8C,
+    0xAA, 0xDF, 0x97, 0x13, 0xEC, 0xAA, 0x69, 0x4A, 0x20, 0x59, 0xFC, 0xCF, 0x50, 0xCA, 0xBD, 0x6F,
+    0xCE, 0xE4, 0x7B, 0xB5, 0xAC, 0xA9, 0x76, 0x19, 0x73, 0x84, 0x66, 0x83, 0x27, 0xFE, 0xED, 0x41,
+    0x0B, 0x1F, 0x4F, 0x30, 0x53, 0x1E, 0xD4, 0x48, 0xDB, 0x61, 0x2F, 0x8D, 0x07, 0x8E, 0xD3, 0xD2,
+    0x52, 0x4A, 0xA4, 0xBA, 0xF7, 0x1D, 0xCA, 0x01, 0x5C, 0xAF, 0x5E, 0xD5, 0x46, 0x30, 0x53, 0xF2,
+    0xC2, 0xBE, 0xD6, 0x17, 0xEC, 0x0C, 0xC8, 0xFB, 0x37, 0x28, 0x65, 0x21, 0x13, 0x09, 0xC9, 0xEC,
+    0xEA, 0xF1, 0xD9, 0x43, 0x5F, 0xAC, 0x29, 0x5C, 0x79, 0xB9, 0x06, 0x6C, 0x38, 0xAB, 0xFA, 0xF0,
+    0xFA, 0x27, 0x11, 0xF0, 0x69, 0x79, 0x4F, 0x23, 0xBB, 0x16, 0x4A, 0x91, 0xB8, 0x49, 0x38, 0x55,
+    0x1E, 0x54, 0x3C, 0x6A, 0x0E, 0x54, 0xC4, 0x46, 0x0E, 0xF2, 0xEF, 0x7C, 0x3A, 0x90, 0xB1, 0x42,
+    0x4C, 0x99, 0x26, 0x81, 0xBE, 0xDF, 0x0B, 0x59, 0xBD, 0x2A, 0xB9, 0x04, 0x0C, 0x34, 0xF2, 0xFE,
+    0x2B, 0x71, 0x93, 0xB2, 0x17, 0x91, 0x7E, 0x83, 0x22, 0xDC, 0x2E, 0x82, 0x9D, 0x80, 0x4E, 0x3E,
+    0xBC, 0x3F, 0x96, 0xF0, 0x35, 0x64, 0xD2, 0x42, 0xF9, 0xF5, 0x16, 0xA2, 0x0D, 0x9C, 0xC6, 0x1C,
+    0xE8, 0x94, 0xE9, 0x06, 0x68, 0x24, 0x50, 0xAC, 0xDF, 0xD2, 0x31, 0xB7, 0x23, 0x50, 0xB5, 0x87,
+    0x09, 0x52, 0xB5, 0x83, 0x4C, 0xC7, 0x1D, 0x0A, 0x7B, 0xEF, 0x3B, 0xD0, 0xC8, 0x98, 0x2C, 0x67,
+    0x75, 0x18, 0x26, 0x6A, 0x08, 0xA4, 0x05, 0x33, 0x55, 0xAC, 0x64, 0x23, 0xA5, 0xFE, 0xC4, 0x5A,
+    0x6C, 0xBA, 0x7B, 0x3B, 0x21, 0x37, 0x22, 0x01, 0xBA, 0x7B, 0x97, 0x6E, 0x28, 0xCC, 0xBB, 0xC9,
+    0x58, 0x7F, 0x76, 0x2D, 0x29, 0x18, 0xDD, 0x44, 0xAC, 0x52, 0x55, 0x6C, 0x40, 0xC5, 0x9D, 0x24,
+    0xAC, 0xCF, 0xF7, 0x03, 0x9B, 0x9F, 0x4D, 0x02, 0x36, 0x22, 0x6F, 0x5C, 0x0E, 0x34, 0x3B, 0x24,
+    0x75, 0xDC, 0xE4, 0xEB, 0x45, 0x04, 0x72, 0x45, 0xEB, 0x2A, 0x59, 0xDB, 0x43, 0xC0, 0x47, 0x7B,
+    0x2A, 0x3A, 0x87, 0x1E, 0x0C, 0x22, 0x4E, 0x4B, 0x6B, 0x44, 0xA8, 0xEE, 0x7D, 0xC7, 0xAC, 0xAA,
+    0x9E, 0x77, 0x55, 0xFB, 0xCA, 0x16, 0xEE, 0xA8, 0x30, 0x5D, 0xAF, 0x8D, 0x96, 0xF7, 0x6F, 0x18,
+    0x91, 0x3E, 0x13, 0x09, 0x7B, 0x44, 0x85, 0x8B, 0x7C, 0x0A, 0x70, 0x9C, 0x05, 0x4C, 0xBC, 0x02,
+    0x50, 0xCD, 0x07, 0xA0, 0xD0, 0x15, 0xFE, 0xB6, 0x19, 0x87, 0x27, 0xC9, 0xEB, 0x6C, 0x28, 0xC1,
+    0x9F, 0x4B, 0xB7, 0xBC, 0x76, 0x50, 0xE1, 0x7A, 0x20, 0x2D, 0x6A, 0x24, 0xD0, 0xBD, 0x7F, 0x83,
+    0xA6, 0x55, 0x4D, 0xAF, 0x5A, 0x8D, 0xBC, 0xF3, 0x21, 0x05, 0xDB, 0xCB, 0x66, 0x1C, 0x22, 0x58,
+    0xF9, 0x47, 0x2D, 0x8D, 0x8C, 0x14, 0x22, 0xF7, 0x69, 0xAC, 0x3A, 0x86, 0xD7, 0x01, 0x57, 0x8F,
+    0x00, 0x1F, 0xC6, 0xBD, 0x22, 0x25, 0x83, 0xF1, 0xED, 0x8F, 0x0C, 0x05, 0xE4, 0xC3, 0x7A, 0x2B,
+    0xD8, 0x26, 0x30, 0x56, 0xC1, 0xA6, 0x06, 0x23, 0x03, 0x55, 0xA0, 0x98, 0x13, 0x16, 0x6B, 0x47,
+    0x70, 0xD1, 0x28, 0x08, 0xDB, 0x01, 0xA2, 0x50, 0x6C, 0x70, 0x3D, 0xB8, 0x98, 0x47, 0xB0, 0x73,
+    0x36, 0x83, 0x91, 0x84, 0xC4, 0xFA, 0x1A, 0x7C, 0x5F, 0x06, 0xF0, 0xB1, 0x88, 0xD0, 0x4C, 0x09,
+    0x88, 0x15, 0x11, 0x59, 0x68, 0x76, 0xDE, 0x6F, 0xC5, 0x89, 0xC8, 0x42, 0xBE, 0xA9, 0xF0, 0xAE,
+    0xD4, 0x3B, 0x1E, 0xA4, 0x51, 0xD8, 0x78, 0xAC, 0x11, 0xED, 0x91, 0x26, 0x6C, 0xB7, 0x35, 0x61,
+    0x99, 0x00, 0xDC, 0xF7, 0x46, 0x80, 0xF2, 0xAB, 0x11, 0xCA, 0xB1, 0xCA, 0xAE, 0x83, 0xAC, 0xC7,
+    0x40, 0x2E, 0x72, 0x07, 0x28, 0xFB, 0x6A, 0x06, 0x8E, 0x55, 0x4D, 0x66, 0xDC, 0x08, 0x59, 0x54,
+    0xF9, 0x0E, 0xB8, 0x08, 0x79, 0x8F, 0x1B, 0xA0, 0x08, 0x54, 0x3D, 0xB8, 0x40, 0x13, 0xC0, 0x0D,
+    0x46, 0x43, 0x5A, 0x91, 0x56, 0x71, 0xB5, 0x5A, 0x51, 0x70, 0xAD, 0x86, 0x77, 0x00, 0xD5, 0x74,
+    0xFC, 0x3B, 0x87, 0x6F, 0x27, 0xC1, 0xA6, 0xA4, 0xB7, 0x3A, 0xC8, 0x72, 0x53, 0x5A, 0xA9, 0xF6,
+    0x39, 0x4F, 0x38, 0x62, 0xDE, 0x03, 0xE5, 0x58, 0x01, 0x56, 0x26, 0x85, 0x92, 0x7F, 0xD9, 0x43,
+    0x3E, 0x16, 0xB2, 0x93, 0xAA, 0x8D, 0x8A, 0x6B, 0xEB, 0x5C, 0x9B, 0xB0, 0xF3, 0x4E, 0xA8, 0x95,
+    0x56, 0x47, 0x67, 0x72, 0x2D, 0x09, 0x35, 0x71, 0x27, 0xD3, 0x4A, 0x64, 0xD1, 0x64, 0x20, 0x02,
+    0x8D, 0x7C, 0x10, 0x1E, 0x14, 0x29, 0xF0, 0x19, 0x78, 0x5C, 0x64, 0x80, 0x4E, 0x24, 0x60, 0x5E,
+    0x7E, 0x84, 0x3E, 0x9F, 0x7A, 0x39, 0xC9, 0xDC, 0x89, 0x48, 0x8D, 0x17, 0x99, 0x30, 0x0B, 0xA8,
+    0xC5, 0x4A, 0x00, 0x9A, 0xE2, 0xB5, 0x9A, 0xE2, 0xFA, 0x1A, 0x30, 0xCB, 0xA5, 0x3F, 0x83, 0x62,
+    0x1B, 0xAB, 0x16, 0x44, 0x96, 0x8D, 0x25, 0xA2, 0x78, 0xF5, 0xC2, 0x56, 0x95, 0x4B, 0x08, 0xAF,
+    0xCA, 0x45, 0x44, 0x7A, 0x2A, 0x11, 0xA9, 0x11, 0x91, 0x05, 0x2B, 0x22, 0x63, 0xB2, 0x16, 0x00,
+    0x2F, 0x6B, 0xB2, 0x63, 0xEF, 0x2F, 0x82, 0x3C, 0xAC, 0x76, 0x30, 0xA0, 0x99, 0x61, 0xD5, 0x3B,
+    0xB8, 0x46, 0x5E, 0x9B, 0x11, 0x1B, 0xEC, 0x70, 0xEA, 0x66, 0x28, 0x44, 0x24, 0x38, 0x11, 0x69,
+    0xCB, 0x37, 0xEA, 0x34, 0x5E, 0x7E, 0xD7, 0xB8, 0x6A, 0xE4, 0xB3, 0xAA, 0x70, 0x4E, 0x64, 0xC4,
+    0x8A, 0x44, 0xB8, 0xBC, 0xD6, 0x40, 0x16, 0x78, 0x11, 0x5C, 0x9D, 0x05, 0xA8, 0xEA, 0x6B, 0x40,
+    0x23, 0x11, 0xE8, 0x56, 0x80, 0xEF, 0x7E, 0xA4, 0x5F, 0xBB, 0x04, 0x9D, 0xC8, 0x8C, 0x15, 0x91,
+    0x1E, 0x27, 0xB2, 0x42, 0x53, 0x6F, 0xDE, 0x34, 0x21, 0x05, 0x4D, 0x2A, 0x19, 0xED, 0x24, 0xDC,
+    0x5C, 0xFA, 0x2E, 0x9A, 0x14, 0x69, 0x40, 0x8E, 0x17, 0xA9, 0xB7, 0x31, 0x38, 0x10, 0xF9, 0xBC,
+    0xF7, 0xB5, 0xBE, 0xD5, 0xD9, 0xA4, 0x26, 0x4E, 0xB4, 0x94, 0x96, 0x04, 0x5A, 0xE8, 0x0C, 0x82,
+    0x1B, 0x7C, 0x3A, 0xA5, 0x3E, 0x13, 0x6F, 0x27, 0xEF, 0xED, 0xA5, 0xDD, 0x2C, 0xFE, 0xC7, 0x1F,
+    0xBF, 0x11, 0xF9, 0x26, 0x4C, 0x25, 0xF5, 0x23, 0xEC, 0x60, 0x62, 0xF7, 0x91, 0x8D, 0xBA, 0xA4,
+    0x0E, 0x05, 0x24, 0xDD, 0x4F, 0x5A, 0xB4, 0xA0, 0xB0, 0xEC, 0x0D, 0xF7, 0x01, 0x5D, 0x49, 0x05,
+    0x5E, 0xFE, 0xD5, 0xB7, 0x5A, 0xE8, 0x44, 0xC0, 0x8A, 0x4C, 0xE0, 0x44, 0xFA, 0x6D, 0x48, 0x0E,
+    0x47, 0x00, 0x20, 0x9B, 0xF7, 0x02, 0x6F, 0x44, 0xA3, 0xCA, 0x54, 0x1E, 0x4A, 0xF2, 0xCD, 0x76,
+    0x05, 0x83, 0x26, 0x45, 0x1D, 0x66, 0x4D, 0x51, 0x86, 0x5D, 0x3E, 0x3A, 0x90, 0x5C, 0x55, 0x92,
+    0xD9, 0x42, 0xE4, 0x1A, 0x79, 0x5D, 0xD6, 0x1C, 0xD9, 0xE1, 0xD4, 0xCD, 0xD0, 0x89, 0xCC, 0x4E,
+    0x44, 0xBE, 0x77, 0xEF, 0xE5, 0x03, 0xE8, 0xC4, 0xB7, 0x90, 0x49, 0x6D, 0xDA, 0x52, 0x64, 0x42,
+    0x44, 0x6A, 0x2B, 0x12, 0x53, 0x3C, 0x0A, 0xA7, 0x2E, 0x52, 0x88, 0x48, 0xC0, 0x8B, 0x2C, 0x20,
+    0x22, 0xC3, 0x36, 0xF5, 0xEA, 0x9D, 0x84, 0xD3, 0xD4, 0x3B, 0x98, 0x8B, 0xBF, 0xF8, 0xE6, 0x0D,
+    0xD0, 0xC2, 0xA6, 0xC8, 0xBA, 0x01, 0x61, 0x2A, 0xC6, 0xF5, 0x40, 0x6A, 0x61, 0xC7, 0xA5, 0x52,
+    0x21, 0x95, 0x22, 0x52, 0xD3, 0xED, 0x67, 0xAB, 0xCA, 0x24, 0xD5, 0x90, 0xCE, 0xA2, 0xB3, 0x06,
+    0x78, 0xF2, 0x20, 0xBA, 0xAD, 0xEA, 0xFB, 0x34, 0xA9, 0x91, 0x40, 0xD5, 0x3B, 0xF2, 0x81, 0xD7,
+    0xCC, 0x88, 0x0D, 0xC7, 0x7C, 0x6B, 0x2E, 0x44, 0x24, 0x88, 0xC8, 0x54, 0xBE, 0x51, 0x6B, 0x66,
+    0xE0, 0xB7, 0xC7, 0x56, 0x23, 0x9F, 0x35, 0x22, 0xD2, 0x3A, 0x91, 0x11, 0x2F, 0x92, 0x34, 0xE8,
+    0x56, 0xCA, 0xA1, 0xDC, 0xF6, 0xD8, 0xA3, 0x4D, 0x87, 0x4E, 0x6B, 0x1C, 0x58, 0x9B, 0x1E, 0x8A,
+    0xF6, 0x0A, 0xE0, 0xFE, 0xB8, 0xDD, 0x85, 0x2D, 0xDA, 0xA0, 0x17, 0xF9, 0xDD, 0x99, 0xC0, 0xDA,
+    0x9B, 0xBC, 0xA5, 0x68, 0x6F, 0x81, 0xFB, 0x20, 0x45, 0x37, 0x3A, 0xD9, 0x3E, 0xF3, 0xB1, 0x61,
+    0x75, 0x9B, 0xC2, 0xFD, 0xD1, 0x06, 0xAE, 0x91, 0xD7, 0x79, 0x8F, 0xE3, 0x98, 0x6F, 0xCD, 0x99,
+    0x88, 0xA6, 0xAE, 0xED, 0xB5, 0x4B, 0x29, 0x1F, 0x73, 0x61, 0x6B, 0x54, 0xD7, 0xF3, 0x6D, 0x23,
+    0x22, 0xAD, 0x4D, 0xE3, 0x1D, 0x53, 0x84, 0x0E, 0x7C, 0x5A, 0xEF, 0x3C, 0x1E, 0x0C, 0xB3, 0xFB,
+    0xEB, 0x16, 0xC8, 0x86, 0x52, 0x13, 0xDC, 0xB3, 0x8F, 0xD0, 0xFF, 0x4E, 0xAE, 0xAB, 0x1E, 0x81,
+    0x93, 0xF5, 0x47, 0x11, 0x2B, 0x3D, 0x06, 0x34, 0x67, 0xD3, 0xC2, 0x5A, 0x9A, 0x43, 0x1A, 0xE5,
+    0x6B, 0x4C, 0xBF, 0x21, 0x2E, 0xFD, 0x41, 0xB9, 0xB3, 0x69, 0xF9, 0x6F, 0x6A, 0x8A, 0x11, 0x2B,
+    0x2B, 0x52, 0xE3, 0x25, 0xBA, 0x08, 0x67, 0x04, 0x01, 0x8E, 0x2F, 0xBA, 0x11, 0x8A, 0x1E, 0x09,
+    0xB0, 0xE0, 0xE4, 0x1F, 0x7F, 0x53, 0x02, 0x5A, 0x35, 0x28, 0xB4, 0x16, 0xEF, 0xB5, 0x36, 0xDF,
+    0xA9, 0x1B, 0xBD, 0x9C, 0xE6, 0xD4, 0xD9, 0xFD, 0x04, 0xE8, 0x7A, 0xA0, 0x2C, 0x5A, 0xB0, 0xA1,
+    0x04, 0x6E, 0xA4, 0x7C, 0x72, 0x8F, 0x9F, 0x7C, 0x1E, 0x4A, 0xF9, 0x69, 0x54, 0xCE, 0x9D, 0x59,
+    0xAC, 0x04, 0x3C, 0x6E, 0xA6, 0x08, 0x48, 0xCD, 0x88, 0x8B, 0x94, 0x20, 0x64, 0x03, 0xE5, 0xC0,
+    0x05, 0xEC, 0x8C, 0x1D, 0x90, 0x80, 0x7F, 0x53, 0xA6, 0xC4, 0xAE, 0x74, 0x4A, 0xD9, 0x94, 0xBB,
+    0x60, 0xD6, 0x6F, 0x84, 0xDD, 0x6C, 0x13, 0x78, 0xD2, 0x74, 0x43, 0x52, 0x28, 0x9F, 0xB2, 0x92,
+    0x00, 0xA7, 0xE5, 0x10, 0x46, 0xFE, 0x34, 0xA6, 0x05, 0x33, 0xF0, 0x22, 0x50, 0xD6, 0x65, 0x4D,
+    0x82, 0x7D, 0xC8, 0x15, 0xDE, 0x3E, 0xF3, 0x89, 0xAC, 0xFC, 0x6F, 0xFF, 0xC8, 0x1C, 0x61, 0x5B,
+    0xF5, 0xC7, 0x36, 0xE6, 0x43, 0x72, 0xC7, 0x85, 0x0C, 0x1F, 0xE5, 0x8D, 0xB3, 0xD5, 0xDC, 0x20,
+    0x97, 0x71, 0xD6, 0x11, 0xCA, 0x47, 0x27, 0xD8, 0x88, 0x84, 0x2C, 0xE2, 0x7B, 0x1D, 0xA0, 0x2B,
+    0xD8, 0x99, 0x73, 0x98, 0x15, 0x57, 0x23, 0x69, 0x7C, 0xD6, 0x1F, 0xC9, 0xA0, 0x01, 0x9D, 0x15,
+    0x99, 0xD3, 0xF0, 0xE4, 0xF7, 0xF6, 0x9E, 0xCD, 0x07, 0x1D, 0x9D, 0x22, 0xBD, 0x27, 0x62, 0x44,
+    0xE2, 0xFD, 0x83, 0x93, 0x42, 0x25, 0x55, 0xA7, 0x2D, 0x25, 0x65, 0x9F, 0xBD, 0x3E, 0xEA, 0xF8,
+    0xBC, 0xAC, 0x35, 0x46, 0xD2, 0xBD, 0xDF, 0x9C, 0xD3, 0x60, 0x58, 0xA9, 0x77, 0x7E, 0x32, 0xA5,
+    0xB6, 0x3A, 0x16, 0xFE, 0x80, 0xA4, 0x96, 0x92, 0xB3, 0x5D, 0x06, 0xF7, 0x06, 0x74, 0x35, 0x5E,
+    0x06, 0xDF, 0xE3, 0x64, 0xD6, 0x91, 0xB0, 0x33, 0x70, 0xAF, 0x96, 0x1A, 0xEE, 0xE0, 0x23, 0xF8,
+    0x5A, 0x07, 0x22, 0xF1, 0x89, 0xBA, 0x5D, 0x0C, 0xBC, 0x6E, 0xE3, 0x60, 0xBA, 0xD4, 0x35, 0x17,
+    0x36, 0xF3, 0x65, 0xE7, 0x9D, 0x06, 0xC8, 0xA3, 0x50, 0xAB, 0x62, 0x3A, 0xDD, 0xEA, 0x24, 0x29,
+    0x45, 0x46, 0xCA, 0xDE, 0xCF, 0xB8, 0x60, 0x45, 0xE7, 0x88, 0xED, 0xF1, 0xC1, 0x44, 0x5C, 0xE4,
+    0x6D, 0xF2, 0x49, 0xA7, 0x88, 0x6B, 0xAD, 0x60, 0x3F, 0xBC, 0x29, 0xAD, 0xC6, 0xAC, 0x4E, 0x24,
+    0x92, 0xC9, 0x3A, 0x41, 0xF9, 0xDE, 0xBC, 0xF3, 0x52, 0x02, 0xE7, 0x4F, 0x4B, 0xAB, 0x9E, 0xCC,
+    0x89, 0x52, 0x5F, 0x03, 0x9C, 0x59, 0xEB, 0xDF, 0x2D, 0x81, 0x3E, 0x32, 0xC5, 0x9C, 0x00, 0x8A,
+    0xF9, 0x30, 0xD9, 0x66, 0xCF, 0x97, 0xD4, 0x36, 0xEA, 0xCC, 0x2B, 0x1F, 0x04, 0xD3, 0x14, 0x67,
+    0xD7, 0x5A, 0x4E, 0xBF, 0x75, 0xC6, 0xC5, 0x2D, 0xD3, 0xCF, 0xE7, 0xBD, 0x4A, 0xEE, 0x49, 0x0B,
+    0xED, 0x77, 0x30, 0xB2, 0x78, 0x8C, 0x88, 0xD4, 0x6A, 0xD0, 0x66, 0x7C, 0xE4, 0x36, 0x6E, 0xD4,
+    0xC1, 0x29, 0x41, 0x28, 0x5A, 0x9A, 0xD6, 0xF6, 0xF8, 0xC0, 0x84, 0x8F, 0x6A, 0xCE, 0x14, 0xCA,
+    0x17, 0x4D, 0xB5, 0x3F, 0x68, 0x37, 0x6B, 0xE6, 0xD2, 0x73, 0x6D, 0x7D, 0x79, 0x4A, 0xC6, 0x4C,
+    0x64, 0x86, 0x46, 0x66, 0x30, 0xDD, 0x21, 0x2E, 0xAD, 0x20, 0xAD, 0x46, 0x6E, 0x1B, 0x97, 0xEE,
+    0xB8, 0x54, 0x8E, 0x75, 0x51, 0x03, 0x9F, 0x26, 0xBB, 0x7F, 0x6C, 0xCD, 0x9F, 0xC1, 0xE9, 0x1B,
+    0x9A, 0x2B, 0x05, 0x7C, 0x0B, 0x2B, 0x46, 0x53, 0x90, 0x22, 0xEA, 0x35, 0x85, 0x6C, 0x56, 0xB0,
+    0x13, 0xC5, 0x08, 0x55, 0xBF, 0x5D, 0x13, 0xB0, 0x33, 0xF9, 0x04, 0xE5, 0x40, 0xD5, 0x43, 0xD7,
+    0x22, 0x60, 0x17, 0xF2, 0xF5, 0xD2, 0xA5, 0xCB, 0x91, 0x4A, 0x49, 0x23, 0xB2, 0xE7, 0xDA, 0x8D,
+    0x94, 0xFB, 0x6B, 0x82, 0x5D, 0xC1, 0x4D, 0x94, 0x23, 0x34, 0x3D, 0x5D, 0x20, 0x93, 0xDA, 0x0A,
+    0xB8, 0x19, 0x37, 0x41, 0x13, 0xE9, 0x7A, 0x85, 0xE3, 0x78, 0x6E, 0x8B, 0xC0, 0xF2, 0x15, 0xB8,
+    0x5A, 0x81, 0x0D, 0x0E, 0x3E, 0xCB, 0xE9, 0x94, 0x4E, 0xFA, 0x2D, 0x95, 0xFC, 0xC8, 0xBF, 0xFE,
+    0x6F, 0xA9, 0xF1, 0x9D, 0x36, 0xA0, 0xCE, 0xD7, 0x7A, 0xC1, 0xF7, 0x66, 0x62, 0xC5, 0xF6, 0x79,
+    0xA4, 0xAC, 0x7D, 0xCB, 0x15, 0x66, 0x6C, 0xCC, 0x23, 0xAE, 0xF5, 0x2D, 0x57, 0x59, 0xB0, 0x63,
+    0x11, 0x71, 0xC1, 0x07, 0x3A, 0x04, 0x3B, 0x15, 0x13, 0x65, 0xAF, 0xA1, 0x48, 0x1E, 0x71, 0x03,
+    0xF8, 0x16, 0x5F, 0xC3, 0xAA, 0xD7, 0xEE, 0x13, 0x9E, 0x59, 0x95, 0xE1, 0x33, 0x42, 0xD5, 0x5B,
+    0x11, 0x11, 0xE9, 0xB5, 0x06, 0x4F, 0xB5, 0xBE, 0xF9, 0x66, 0x37, 0xE1, 0x7B, 0x90, 0x7A, 0x13,
+    0xA8, 0xEA, 0x7C, 0xA5, 0xD6, 0x5C, 0x85, 0x97, 0xCB, 0x2E, 0xC1, 0x93, 0x80, 0xFC, 0xD5, 0xA5,
+    0x57, 0x84, 0x7C, 0x81, 0x72, 0xA2, 0x8A, 0xD0, 0xF5, 0x48, 0xC0, 0xAA, 0x40, 0xCB, 0x99, 0x6A,
+    0x4C, 0x64, 0x91, 0x2B, 0x5B, 0x2C, 0xEC, 0x5A, 0xE0, 0xDA, 0x1F, 0x45, 0x4A, 0x91, 0x40, 0xF7,
+    0x7E, 0x7D, 0xFF, 0x6B, 0x57, 0x2E, 0x8F, 0xD8, 0x5F, 0xC9, 0xAC, 0xB9, 0x46, 0xF3, 0x9E, 0xEB,
+    0xED, 0x42, 0xD9, 0xBA, 0x81, 0x0B, 0x34, 0x98, 0xD1, 0x4E, 0xE4, 0xC1, 0x05, 0x3C, 0x0D, 0x4C,
+    0x76, 0x22, 0xEF, 0x5D, 0x8F, 0xAF, 0x3B, 0x98, 0xED, 0x4C, 0x11, 0x5D, 0xC4, 0xB7, 0x5D, 0x6B,
+    0x96, 0x44, 0x63, 0x13, 0x13, 0x18, 0x87, 0xC8, 0xEB, 0xD5, 0xC8, 0x0B, 0xD9, 0xF4, 0x31, 0x75,
+    0x21, 0x3B, 0xA7, 0x3C, 0xA0, 0xAB, 0x35, 0xD3, 0x75, 0x51, 0x2D, 0xBF, 0x99, 0x53, 0x18, 0xED,
+    0xDB, 0x04, 0x66, 0xC7, 0x64, 0x4E, 0xD6, 0x84, 0xAB, 0x55, 0x7D, 0x7A, 0xF7, 0x9C, 0xCC, 0xA9,
+    0xD4, 0x3A, 0x69, 0xAB, 0xA8, 0xE8, 0x5C, 0xBE, 0xA6, 0x40, 0x8E, 0x6B, 0xF4, 0xE5, 0xAD, 0x67,
+    0xED, 0x3B, 0xEF, 0x86, 0xD7, 0xDD, 0x98, 0xD7, 0xF7, 0x97, 0x88, 0xB3, 0x01, 0x2E, 0xA8, 0xCA,
+    0xBC, 0xAD, 0x05, 0xF6, 0x08, 0x95, 0x02, 0xEE, 0x17, 0xB4, 0x26, 0xA1, 0xB4, 0x85, 0x6C, 0x02,
+    0x5F, 0x63, 0xC7, 0x5D, 0x35, 0xDB, 0xD4, 0xA6, 0x53, 0x28, 0x24, 0x9C, 0xBA, 0xF8, 0xE8, 0xAE,
+    0xFA, 0x36, 0x35, 0xBE, 0x69, 0x13, 0x21, 0xB7, 0xDB, 0xEC, 0xCA, 0x92, 0x92, 0x86, 0x6C, 0xDE,
+    0xDE, 0x77, 0xE2, 0xE5, 0x35, 0xE1, 0x6B, 0xD9, 0x92, 0x8C, 0x97, 0x9D, 0x93, 0xBD, 0x75, 0x63,
+    0xEA, 0x73, 0x15, 0xD3, 0xBC, 0x6F, 0x06, 0x4D, 0x96, 0x80, 0x53, 0x17, 0x4B, 0x91, 0x1F, 0x9F,
+    0xA4, 0x25, 0xB0, 0xF1, 0x56, 0x2F, 0x68, 0x51, 0x27, 0xF1, 0xA9, 0x89, 0xDA, 0xF5, 0x63, 0x85,
+    0x69, 0xF2, 0x5E, 0xE7, 0xCD, 0xAC, 0x7E, 0xD8, 0xD7, 0xB0, 0x6C, 0xF9, 0x10, 0xD5, 0x75, 0xB2,
+    0x05, 0x7C, 0xC0, 0x4E, 0xD0, 0xD4, 0x14, 0x11, 0x04, 0xDC, 0x80, 0x59, 0xA0, 0x0A, 0xD8, 0x19,
+    0x7C, 0x4B, 0x3E, 0x42, 0x07, 0x2E, 0x62, 0x56, 0xA8, 0x7A, 0xAC, 0x7E, 0x2C, 0x9F, 0x41, 0x5A,
+    0xDC, 0x48, 0x26, 0x35, 0x3E, 0x62, 0x05, 0xCE, 0x42, 0x51, 0x93, 0xF5, 0x70, 0xA4, 0x7E, 0x45,
+    0x73, 0x91, 0xB2, 0xC6, 0x0D, 0x14, 0x23, 0x76, 0xD9, 0x6C, 0xF8, 0xFE, 0xB8, 0x08, 0xC7, 0xE0,
+    0x6A, 0xF2, 0x40, 0x36, 0xC0, 0x08, 0x47, 0x50, 0x81, 0x6B, 0xB1, 0x3D, 0xD9, 0x08, 0x33, 0x78,
+    0xA8, 0x5A, 0xDC, 0x80, 0x1D, 0x31, 0x33, 0xDC, 0x82, 0xB7, 0xE0, 0x45, 0x15, 0xDE, 0x9D, 0x4D,
+    0x0F, 0xFB, 0xC3, 0xC6, 0x77, 0xE1, 0x91, 0x43, 0x68, 0x67, 0x68, 0x5A, 0x65, 0x9E, 0xEA, 0xF0,
+    0x2C, 0x50, 0x06, 0x32, 0xED, 0xB3, 0xDD, 0x5F, 0x5F, 0xA1, 0x1C, 0x76, 0xA2, 0x9A, 0xA1, 0x6B,
+    0x71, 0x23, 0x48, 0x4D, 0xA5, 0x7D, 0x6E, 0x86, 0x6D, 0xA8, 0xCE, 0x71, 0x81, 0x2B, 0xBC, 0xCD,
+    0x48, 0xCC, 0xA2, 0x1D, 0x6C, 0x5F, 0x04, 0x17, 0x5C, 0xA8, 0x5A, 0x5F, 0xFB, 0xBA, 0x01, 0x3B,
+    0x91, 0x8F, 0xB8, 0x88, 0xEF, 0x69, 0x5A, 0x84, 0x6C, 0x21, 0x9F, 0x28, 0x62, 0x32, 0xC9, 0x02,
+    0x0B, 0xF9, 0x44, 0x1E, 0xA9, 0x7A, 0xAA, 0xA0, 0x66, 0x3B, 0x9F, 0xB0, 0xE3, 0xFE, 0x82, 0x60,
+    0x67, 0xEC, 0x44, 0xD9, 0x27, 0x06, 0x68, 0x57, 0xDB, 0x19, 0x3B, 0x53, 0x0E, 0xB8, 0x48, 0x07,
+    0x5D, 0x6B, 0x67, 0xEC, 0x42, 0x39, 0xE0, 0x46, 0xBA, 0x9A, 0x2E, 0xD8, 0x19, 0x2B, 0xB8, 0x81,
+    0x72, 0xA2, 0xAB, 0xB9, 0x3C, 0xA4, 0xD5, 0x40, 0x03, 0x98, 0x5C, 0x69, 0x3B, 0x5A, 0x4E, 0x09,
+    0x5B, 0x49, 0xB8, 0x94, 0x00, 0x34, 0xEF, 0x1D, 0x64, 0x3A, 0x89, 0xD2, 0xD8, 0xD5, 0xE0, 0x6B,
+    0xBB, 0x68, 0xF1, 0x36, 0xEE, 0xA8, 0x95, 0x1A, 0xD2, 0x65, 0xEB, 0x83, 0xC3, 0xCB, 0xAE, 0xE2,
+    0xE5, 0x6A, 0x70, 0x2D, 0x57, 0x80, 0xAB, 0x64, 0x27, 0xAE, 0x1D, 0x01, 0x17, 0xC8, 0xA2, 0x5E,
+    0x53, 0x58, 0xFB, 0xC2, 0xEE, 0x9A, 0x89, 0x28, 0xFF, 0x1E, 0x0F, 0x1C, 0x93, 0x4D, 0x7A, 0x4D,
+    0x0B, 0x8D, 0xBE, 0x86, 0x63, 0xCC, 0xBC, 0x6B, 0x6A, 0xE2, 0xD4, 0x1C, 0xB3, 0x0F, 0x3F, 0x53,
+    0xFB, 0x44, 0xD3, 0x51, 0xAD, 0xAA, 0x34, 0xFF, 0xF6, 0xA4, 0x2F, 0x3D, 0x88, 0x56, 0xF3, 0x15,
+    0xA0, 0xFC, 0xBA, 0x66, 0xD6, 0x11, 0xF8, 0xF6, 0x61, 0xFA, 0x73, 0x69, 0x1F, 0x8E, 0x68, 0x10,
+    0xA1, 0x02, 0xCD, 0x0F, 0x4A, 0x09, 0x2A, 0x16, 0x77, 0x80, 0xAB, 0xFB, 0x83, 0x92, 0x4D, 0x73,
+    0xB0, 0xF2, 0x43, 0xF6, 0xD5, 0x86, 0xC3, 0x9B, 0x69, 0x1E, 0xA4, 0x64, 0xDA, 0x74, 0xB3, 0x21,
+    0x51, 0x4A, 0x77, 0x60, 0xA2, 0xDF, 0xDF, 0xC6, 0x08, 0xF0, 0x58, 0xB1, 0xB2, 0x11, 0x29, 0x4A,
+    0x19, 0x21, 0x51, 0x54, 0xBD, 0xD4, 0x80, 0x3F, 0x59, 0x05, 0xCF, 0x0E, 0xE8, 0x61, 0xDA, 0xE6,
+    0xF2, 0x32, 0xC0, 0x51, 0xD6, 0x3F, 0xB4, 0x38, 0xA8, 0x84, 0x25, 0x2D, 0xD3, 0xFA, 0x03, 0x01,
+    0x5F, 0xDD, 0xF3, 0xCB, 0x14, 0x0A, 0xD6, 0x51, 0xD0, 0x0A, 0xA7, 0x1D, 0xF6, 0xEC, 0x26, 0x1D,
+    0x16, 0x5D, 0x93, 0xA7, 0x37, 0xAB, 0x1E, 0xB8, 0xCD, 0xBC, 0x2B, 0x62, 0x9D, 0xEE, 0x62, 0x5A,
+    0xC7, 0x06, 0xFE, 0x84, 0x5A, 0xF9, 0xDA, 0x45, 0xCC, 0x8C, 0xD4, 0xB8, 0xA1, 0x18, 0xC1, 0xD7,
+    0x5D, 0x4B, 0x36, 0xE7, 0x13, 0xB8, 0xA1, 0x09, 0xE0, 0xBF, 0x36, 0x43, 0x36, 0xFB, 0x00, 0xEE,
+    0xDF, 0x2C, 0x40, 0xD3, 0xF4, 0x90, 0xC9, 0xBA, 0x1B, 0xFC, 0x46, 0x79, 0x6A, 0xFA, 0x08, 0x45,
+    0x90, 0x7B, 0xB4, 0x84, 0x8A, 0xFB, 0x1B, 0x09, 0xD0, 0xFC, 0xB1, 0xB4, 0xD8, 0xC5, 0x49, 0x8D,
+    0x8B, 0x95, 0x40, 0xD3, 0xFA, 0x15, 0xBB, 0xD0, 0x2D, 0xB8, 0x68, 0x64, 0xA6, 0x6B, 0xAD, 0xDC,
+    0xE7, 0x17, 0xCB, 0xE9, 0x3E, 0xA6, 0x4B, 0xB5, 0x67, 0xBA, 0xA8, 0x76, 0x28, 0xD8, 0x77, 0xDF,
+    0x34, 0x31, 0xA3, 0x0E, 0x84, 0xD5, 0x7A, 0x02, 0x2E, 0xE8, 0xFF, 0xB2, 0x55, 0x19, 0x79, 0x3B,
+    0x71, 0xCD, 0xF5, 0xDC, 0xF6, 0x35, 0xF3, 0x82, 0x91, 0x91, 0x4C, 0x7A, 0xAC, 0xB4, 0xE4, 0xD2,
+    0x53, 0x7C, 0x10, 0x71, 0xFF, 0x62, 0xC6, 0xBD, 0xBB, 0x52, 0xBD, 0x23, 0xB5, 0x6F, 0xA5, 0xF7,
+    0x75, 0x17, 0x3B, 0xFC, 0xFC, 0x50, 0x1B, 0x58, 0x8E, 0x5A, 0xC0, 0xF3, 0xBD, 0xDA, 0x49, 0xD1,
+    0x26, 0xD9, 0xF9, 0x00, 0x81, 0x7C, 0xC6, 0x5C, 0xB4, 0xFD, 0x6D, 0x8E, 0x4A, 0x8A, 0x7F, 0xD8,
+    0x33, 0x8E, 0x94, 0xC7, 0x64, 0x1F, 0xB4, 0xF8, 0x48, 0xAE, 0xE6, 0xD5, 0x09, 0xE6, 0x97, 0x13,
+    0xBE, 0xEA, 0x6D, 0x2F, 0x5C, 0x71, 0x93, 0x0B, 0x4D, 0x0F, 0x7C, 0x61, 0xC3, 0xA5, 0x86, 0xA4,
+    0x17, 0x65, 0xBD, 0x29, 0xC2, 0x03, 0xC7, 0x03, 0x5E, 0x33, 0xDF, 0x79, 0xCD, 0x21, 0xBD, 0x5C,
+    0x6D, 0xCE, 0xD2, 0xD7, 0xC9, 0x7F, 0x6D, 0x4B, 0x5E, 0xCC, 0xEE, 0xE5, 0x09, 0x85, 0xA8, 0x8A,
+    0xED, 0xE5, 0xF2, 0xC3, 0x1F, 0xC9, 0x3B, 0x22, 0x32, 0x79, 0x11, 0xF9, 0x9A, 0x88, 0xC4, 0x8D,
+    0xEC, 0xFD, 0x5C, 0x02, 0xCB, 0xB4, 0x90, 0x43, 0x1E, 0x1E, 0x4E, 0x3A, 0xB8, 0x78, 0x30, 0x2A,
+    0x03, 0x14, 0xFD, 0xC1, 0x88, 0xD4, 0x3A, 0x01, 0xAE, 0xA5, 0xEE, 0xCD, 0x5A, 0x99, 0xCF, 0xD2,
+    0xDB, 0xF3, 0xA8, 0x1E, 0xF7, 0xC4, 0x20, 0xD6, 0xAA, 0xC4, 0x7E, 0x85, 0x66, 0x01, 0xF8, 0xE1,
+    0xA3, 0xC3, 0x85, 0xE1, 0x40, 0x2E, 0x76, 0x27, 0x97, 0xFF, 0xEC, 0x8E, 0xDF, 0x7F, 0x48, 0xE2,
+    0x88, 0x64, 0x92, 0x92, 0xA4, 0x7C, 0x5B, 0x4E, 0x54, 0x0D, 0x9B, 0xB6, 0x82, 0x8E, 0xE7, 0x55,
+    0x98, 0x31, 0x13, 0xD9, 0x88, 0x8D, 0xE4, 0x03, 0x45, 0x8F, 0x0B, 0x94, 0x2D, 0x15, 0x78, 0xB8,
+    0x06, 0x77, 0x60, 0xC6, 0xCC, 0x28, 0x33, 0x58, 0xDF, 0xE5, 0x7A, 0x9C, 0xB4, 0x4E, 0xDA, 0xF2,
+    0xBE, 0xF8, 0xA5, 0xE9, 0x91, 0x80, 0xD4, 0x99, 0x60, 0x17, 0xF2, 0x09, 0x17, 0x53, 0xBE, 0xA9,
+    0x92, 0x49, 0xEB, 0x17, 0x52, 0xDC, 0xA4, 0x25, 0x7A, 0xFD, 0xAB, 0x68, 0xED, 0xC8, 0x05, 0xCA,
+    0x90, 0x45, 0x04, 0xD7, 0xDA, 0x89, 0xAB, 0xFA, 0x57, 0xB7, 0x19, 0xCD, 0xB2, 0x4F, 0x92, 0xBC,
+    0xEF, 0xAF, 0x39, 0x89, 0x27, 0x74, 0x22, 0xAB, 0x15, 0x91, 0xD1, 0x89, 0x48, 0xD8, 0xE4, 0x63,
+    0x03, 0x8F, 0xD7, 0xB7, 0x31, 0xA3, 0x6B, 0xF1, 0x66, 0x24, 0x1F, 0x2A, 0xB8, 0x63, 0x07, 0x5C,
+    0x48, 0xD4, 0x8B, 0x1D, 0x32, 0x7D, 0x6D, 0xB3, 0x66, 0x73, 0xA2, 0x98, 0x66, 0x63, 0x32, 0x8A,
+    0x79, 0x4C, 0x29, 0x9C, 0x3B, 0x7C, 0xD9, 0x8E, 0xC9, 0x88, 0x59, 0x19, 0x36, 0x05, 0x60, 0xD9,
+    0xD0, 0xD0, 0x6C, 0xDE, 0xDA, 0x9A, 0x8F, 0x0A, 0x2E, 0xCC, 0xB8, 0xC1, 0xCC, 0xBA, 0xAA, 0xA3,
+    0x0A, 0xF9, 0x8C, 0x0F, 0x6E, 0x52, 0xFC, 0xB4, 0xD9, 0xB9, 0x8C, 0x95, 0xA4, 0x08, 0x0F, 0x7E,
+    0x3E, 0x79, 0x8C, 0xF2, 0xC3, 0x1F, 0x49, 0xA8, 0x44, 0xA4, 0xF5, 0x22, 0x52, 0xFB, 0xC4, 0xD3,
+    0x91, 0x7D, 0x2D, 0x6F, 0xA7, 0xB3, 0x87, 0xFA, 0x5A, 0x5F, 0xC3, 0xB3, 0xE2, 0xCD, 0xC2, 0x55,
+    0xBB, 0x30, 0xE7, 0xF3, 0xA6, 0xE2, 0x3B, 0x1B, 0x75, 0x30, 0x23, 0x5C, 0x50, 0x7C, 0xDD, 0x3F,
+    0xA0, 0xE2, 0xE9, 0x78, 0xFA, 0x90, 0x41, 0x90, 0x82, 0xD7, 0xFE, 0x90, 0x62, 0x7B, 0x82, 0x5D,
+    0x9A, 0xFD, 0x60, 0x63, 0x8D, 0xE6, 0x71, 0x7B, 0x5B, 0x11, 0xB7, 0xB7, 0xB9, 0xE1, 0xEE, 0xE6,
+    0x8D, 0xFE, 0x72, 0x33, 0x54, 0xD5, 0x9F, 0x6F, 0xA6, 0xC5, 0xFF, 0xE9, 0x36, 0x91, 0xF7, 0x0E,
+    0xA3, 0xD9, 0x59, 0xE8, 0x3D, 0x9C, 0xBC, 0x5B, 0x08, 0xB1, 0x8F, 0x46, 0xB3, 0x9D, 0xBA, 0xE7,
+    0xD3, 0xA1, 0x95, 0xE4, 0x80, 0x9D, 0xC2, 0xB6, 0xCE, 0x5A, 0x4B, 0x78, 0x5B, 0x1F, 0xCA, 0xDD,
+    0xED, 0x9A, 0x0D, 0xD7, 0x32, 0x4B, 0xF3, 0xF3, 0x9B, 0x02, 0x90, 0x8F, 0x5D, 0xAA, 0xE1, 0x95,
+    0xBD, 0x56, 0x53, 0xA1, 0xA9, 0x53, 0x09, 0xC5, 0xAC, 0x5B, 0x31, 0x65, 0xFF, 0xD0, 0xFD, 0x5A,
+    0x98, 0xFD, 0x82, 0x97, 0xF5, 0xC1, 0xC5, 0x31, 0xAE, 0x3E, 0xA8, 0x70, 0x1E, 0x3A, 0x75, 0xBD,
+    0x9E, 0xF7, 0x87, 0xAC, 0xDC, 0x44, 0xB6, 0x4E, 0x42, 0x4C, 0x8B, 0x0D, 0xAF, 0x71, 0xE0, 0xB7,
+    0x13, 0xC5, 0xD7, 0x4C, 0x87, 0x03, 0x95, 0x88, 0x00, 0x89, 0x13, 0x5C, 0xFC, 0xE4, 0xE6, 0x08,
+    0xE6, 0xB2, 0xFC, 0x00, 0xFE, 0x48, 0xA4, 0x85, 0x33, 0xEB, 0xF5, 0x93, 0xB7, 0x3C, 0x79, 0xE7,
+    0x34, 0xA0, 0xC9, 0x45, 0x4A, 0xA2, 0x06, 0x6D, 0x32, 0xFD, 0xDC, 0x09, 0x6A, 0x74, 0x64, 0x1F,
+    0x2C, 0x6C, 0xE1, 0x5B, 0xF9, 0x09, 0xD8, 0x33, 0x46, 0x43, 0x72, 0x3B, 0x83, 0x04, 0xEC, 0x84,
+    0x91, 0x40, 0x11, 0xC9, 0xA4, 0xC7, 0x45, 0xAC, 0x0C, 0xB8, 0x81, 0x3C, 0x51, 0x12, 0x24, 0xE2,
+    0x03, 0x4E, 0x57, 0x0C, 0x96, 0xFF, 0x7E, 0xA4, 0xAB, 0xA9, 0xFE, 0xF9, 0x84, 0x80, 0x7F, 0x77,
+    0x36, 0x2B, 0x34, 0xEF, 0xCE, 0xD9, 0x02, 0xDD, 0xF7, 0x67, 0x3B, 0x83, 0x7C, 0x75, 0xC9, 0x27,
+    0x8C, 0x98, 0xB5, 0x18, 0xC9, 0x04, 0x71, 0x11, 0xBB, 0x22, 0xE5, 0x40, 0xBE, 0x20, 0xBE, 0xC7,
+    0xCD, 0x74, 0x4D, 0xC0, 0xCD, 0x34, 0x12, 0x28, 0x27, 0xBC, 0xD4, 0xF8, 0x11, 0x2F, 0xE0, 0x23,
+    0x95, 0x40, 0x17, 0xA9, 0xD2, 0x74, 0x78, 0x7E, 0x23, 0xE4, 0x99, 0xB8, 0x51, 0xC6, 0x5D, 0xBB,
+    0xAF, 0xA3, 0x3F, 0xA2, 0x8B, 0x17, 0xE1, 0xB9, 0xCB, 0x6B, 0xAA, 0x30, 0xFB, 0xB1, 0x0C, 0x34,
+    0x6D, 0x11, 0x58, 0x29, 0x02, 0x33, 0x2E, 0x98, 0x19, 0x17, 0xEC, 0x48, 0x19, 0xEC, 0x48, 0xD5,
+    0xE6, 0x51, 0x03, 0xA4, 0x06, 0x37, 0xD0, 0x51, 0xF5, 0x88, 0xAE, 0x63, 0xF1, 0xC1, 0x2C, 0x74,
+    0xED, 0x56, 0xA4, 0x33, 0x7F, 0x06, 0xCD, 0xA1, 0xE8, 0x78, 0xA4, 0xE8, 0xFA, 0x8F, 0x11, 0xDD,
+    0xF4, 0x9B, 0x17, 0xDD, 0xFD, 0x8E, 0x6B, 0xC7, 0xE3, 0x4F, 0x40, 0x59, 0xEA, 0x55, 0x9A, 0x47,
+    0x29, 0x27, 0x49, 0x1E, 0xE5, 0x3E, 0xB4, 0xD9, 0x5C, 0xC4, 0xFC, 0xBF, 0xCA, 0x27, 0x6D, 0xAD,
+    0x7C, 0x65, 0xA6, 0x69, 0x8B, 0xE0, 0x06, 0x6E, 0x33, 0xE3, 0x42, 0x19, 0x98, 0xED, 0x48, 0x19,
+    0x7C, 0x9D, 0x4D, 0x79, 0xC4, 0xD7, 0x42, 0x1E, 0xDD, 0x40, 0x97, 0x2D, 0xB8, 0xE8, 0x03, 0xAB,
+    0xD5, 0x7D, 0x1B, 0x0E, 0xAB, 0x9D, 0xF9, 0x92, 0xDA, 0xE5, 0x0E, 0x1D, 0x6A, 0xB1, 0x39, 0x54,
+    0xFF, 0x60, 0xF0, 0x73, 0xA4, 0xCC, 0x48, 0xA7, 0xC1, 0x72, 0xFE, 0x2F, 0x4E, 0xA4, 0x4F, 0x69,
+    0x9A, 0x7F, 0x24, 0x05, 0xE7, 0x77, 0x69, 0xFC, 0xBE, 0xCD, 0xA7, 0xE1, 0x88, 0xB7, 0xC1, 0xBD,
+    0xD4, 0x43, 0x2E, 0x9B, 0xC5, 0x35, 0xF1, 0xBF, 0xB6, 0xEA, 0x1F, 0x6F, 0xD6, 0x2E, 0x9B, 0x36,
+    0x77, 0x5D, 0x0E, 0xC0, 0xF1, 0x27, 0x27, 0x9E, 0x3E, 0x03, 0xD9, 0xCF, 0xA4, 0xD7, 0xCA, 0xB1,
+    0x5D, 0xBF, 0x32, 0x51, 0x8C, 0xCC, 0xB8, 0x81, 0x99, 0x32, 0x30, 0x53, 0xB5, 0xCC, 0xF8, 0x3A,
+    0x9B, 0x68, 0xB0, 0x23, 0x1D, 0x76, 0x64, 0x25, 0x8F, 0x66, 0xA1, 0x88, 0xD9, 0x82, 0x1B, 0xEC,
+    0x4C, 0x39, 0xE4, 0x33, 0x55, 0x5F, 0x4C, 0xDB, 0x42, 0xC5, 0xDF, 0xF2, 0x01, 0xF5, 0x27, 0x26,
+    0x64, 0x4A, 0x2C, 0x92, 0x77, 0x55, 0xD7, 0x7A, 0x59, 0x7A, 0xC0, 0xAA, 0xBB, 0x2B, 0xB4, 0x0E,
+    0x71, 0xEA, 0x37, 0x31, 0xE9, 0x7C, 0xD0, 0x3C, 0xC5, 0x4B, 0xF2, 0xC3, 0xA7, 0x0E, 0xD7, 0xE4,
+    0x7C, 0x49, 0x97, 0x1A, 0xA7, 0x15, 0xC7, 0x97, 0x3E, 0x8A, 0xDA, 0xF1, 0xBB, 0xB7, 0xEC, 0x16,
+    0xBE, 0xF9, 0xA3, 0x45, 0xB7, 0x36, 0x39, 0xFD, 0xE6, 0x1B, 0x2F, 0x7F, 0x6C, 0xF9, 0x7B, 0x80,
+    0x42, 0x16, 0x68, 0x7E, 0x2E, 0x35, 0x0B, 0x65, 0x6B, 0x23, 0x2E, 0xE4, 0x3D, 0x2E, 0xB8, 0x80,
+    0x0B, 0x65, 0xAD, 0xFC, 0xEE, 0xAA, 0xF6, 0xE0, 0xF1, 0x35, 0x2B, 0xFE, 0xFD, 0x57, 0x66, 0x2D,
+    0xFF, 0x39, 0x91, 0x5E, 0x97, 0x53, 0x91, 0x4A, 0x15, 0x47, 0xBA, 0x77, 0xCB, 0x91, 0x56, 0x2B,
+    0xBC, 0xFA, 0x7A, 0x85, 0x8F, 0x52, 0x39, 0x12, 0xF3, 0xC3, 0x8F, 0xE7, 0xD4, 0xFC, 0x2E, 0x0A,
+    0xFE, 0x06, 0x9F, 0x85, 0xC8, 0x11, 0x8C, 0x8C, 0x20, 0x32, 0x40, 0xF3, 0x6B, 0x30, 0x89, 0xFE,
+    0xCB, 0x0F, 0xC6, 0x17, 0xE1, 0x8B, 0x1A, 0xD7, 0x55, 0xB5, 0xD6, 0x30, 0x5A, 0xF0, 0x5A, 0xB6,
+    0xF8, 0x83, 0x9A, 0x3F, 0xF8, 0xD8, 0x00, 0x4A, 0xB7, 0xD0, 0xA1, 0x13, 0x5D, 0x74, 0xB3, 0xCA,
+    0xBC, 0x1B, 0x08, 0x23, 0x2D, 0x55, 0x04, 0xA9, 0xB1, 0x8B, 0x56, 0x38, 0xBB, 0x76, 0x1B, 0x09,
+    0xAF, 0xA9, 0x67, 0xD9, 0x03, 0x4B, 0x22, 0x48, 0xD7, 0x69, 0x28, 0x74, 0xE7, 0x89, 0x94, 0x8E,
+    0x8D, 0xF8, 0x16, 0xCC, 0xBC, 0x8D, 0x85, 0x12, 0xD6, 0x6B, 0xA4, 0xC5, 0x48, 0xC0, 0x2F, 0xF5,
+    0x2B, 0x4A, 0x31, 0xD1, 0x22, 0xE7, 0x9E, 0xF6, 0x38, 0xB2, 0x63, 0x80, 0xA4, 0xD1, 0x30, 0xDD,
+    0xC9, 0xCA, 0xE6, 0x04, 0x13, 0x2E, 0x50, 0x06, 0xB3, 0x60, 0x66, 0xCA, 0x9E, 0xB2, 0xE7, 0x4F,
+    0xE0, 0x4F, 0x3E, 0x19, 0xAD, 0x6B, 0x22, 0x8D, 0x86, 0x91, 0x1F, 0x2D, 0xE0, 0x7A, 0x33, 0xA1,
+    0xBB, 0xD5, 0xE4, 0x3D, 0x2E, 0xE0, 0xC1, 0x63, 0x46, 0x98, 0x29, 0x02, 0x45, 0xAF, 0x17, 0x58,
+    0xB0, 0x13, 0x76, 0xBD, 0xD4, 0x85, 0x54, 0xF2, 0x53, 0x36, 0x95, 0x4E, 0x81, 0x62, 0xD7, 0x44,
+    0xA7, 0x75, 0xBB, 0x5D, 0x88, 0xEB, 0xEA, 0x5D, 0x7C, 0xFB, 0x9D, 0x87, 0x11, 0x10, 0xDE, 0xFC,
+    0x13, 0x40, 0x64, 0x82, 0x52, 0x64, 0x20, 0x1B, 0xE8, 0xE0, 0x02, 0x99, 0x6E, 0xA7, 0x55, 0x73,
+    0x3B, 0xE1, 0xA2, 0x0D, 0x26, 0x52, 0x0E, 0x54, 0x94, 0x4A, 0xD0, 0xA9, 0x69, 0x44, 0x5A, 0x0A,
+    0x91, 0x1E, 0x44, 0xA4, 0xC6, 0xDD, 0x7B, 0x65, 0x26, 0x5B, 0x28, 0x7B, 0x75, 0x7E, 0x76, 0xC6,
+    0x0D, 0x74, 0xC1, 0xAC, 0xB8, 0x89, 0x6A, 0x40, 0x6A, 0xBB, 0x52, 0x45, 0x9A, 0xC1, 0x0A, 0xC5,
+    0x8A, 0x8F, 0xC8, 0x50, 0xAC, 0x89, 0x15, 0x7D, 0x43, 0x1B, 0xFB, 0xB6, 0x42, 0x23, 0x17, 0x76,
+    0x69, 0xC0, 0x76, 0x5C, 0x38, 0xD3, 0x9B, 0x5F, 0x09, 0x4E, 0x66, 0xFC, 0xBD, 0x6F, 0x1B, 0xD1,
+    0x84, 0xD3, 0xB7, 0xA4, 0x35, 0x3C, 0xF8, 0x56, 0x37, 0xED, 0x88, 0xE0, 0x03, 0x99, 0xA8, 0xAD,
+    0xD6, 0x05, 0xDE, 0xDF, 0xFD, 0x61, 0x0D, 0x4E, 0xA4, 0xC5, 0x88, 0xAC, 0x70, 0x8E, 0x22, 0x62,
+    0x7B, 0xAA, 0x9A, 0x2B, 0x64, 0x23, 0x45, 0xA0, 0x82, 0x89, 0x3C, 0x52, 0x62, 0x56, 0xB2, 0x68,
+    0x94, 0xE0, 0x35, 0x92, 0x27, 0x56, 0xC4, 0x82, 0x96, 0xB8, 0x90, 0x37, 0xBA, 0x40, 0xD5, 0x9B,
+    0x25, 0xF5, 0x50, 0x17, 0x6B, 0xCF, 0x94, 0x03, 0xD2, 0x66, 0x2B, 0x6E, 0xC4, 0x0F, 0x99, 0x90,
+    0xAF, 0xF8, 0x48, 0x37, 0x58, 0xC1, 0xAD, 0x74, 0x03, 0x1F, 0xB3, 0x7C, 0x8C, 0xA6, 0xDF, 0xD1,
+    0xC2, 0xA5, 0xDE, 0x30, 0x3C, 0x8D, 0xF6, 0x9A, 0x76, 0x8B, 0x2E, 0x1F, 0x40, 0xBA, 0xED, 0x4F,
+    0xEE, 0xC0, 0x35, 0x09, 0x0A, 0xBF, 0xCA, 0xFB, 0x2D, 0x65, 0x3C, 0xC4, 0xB5, 0xE2, 0x01, 0xBC,
+    0x63, 0x4E, 0x16, 0x81, 0x92, 0x3B, 0x33, 0xF2, 0x09, 0x62, 0x90, 0xA6, 0x4F, 0x45, 0x71, 0xA9,
+    0xB5, 0xF0, 0x6D, 0x97, 0x14, 0xE2, 0xBA, 0xB8, 0x6B, 0xD5, 0x93, 0x64, 0x35, 0xBC, 0x9E, 0xF5,
+    0x90, 0xFD, 0x87, 0xB8, 0xEB, 0x4D, 0x03, 0xBB, 0x95, 0xAA, 0xBF, 0xB5, 0xFA, 0x47, 0xDE, 0xE6,
+    0x6D, 0xD1, 0xBE, 0x8D, 0xFB, 0xA0, 0xC6, 0x69, 0x01, 0xEF, 0x30, 0xC9, 0xFD, 0xCF, 0xD2, 0xBF,
+    0x2D, 0x09, 0xE3, 0x9C, 0xA6, 0x98, 0x07, 0xB9, 0xB4, 0xE2, 0xD2, 0x45, 0xF8, 0x04, 0xB6, 0xE3,
+    0xD4, 0xA5, 0x5A, 0xED, 0x92, 0xB2, 0xD7, 0x42, 0x22, 0x1F, 0x22, 0xBF, 0xE0, 0x33, 0x5B, 0xE1,
+    0x49, 0xB3, 0xF7, 0xB4, 0x34, 0x64, 0x38, 0xE0, 0x07, 0x29, 0x9F, 0xA7, 0x94, 0x7B, 0x40, 0xA6,
+    0x1E, 0xB0, 0x54, 0xCA, 0xD2, 0x99, 0x14, 0x39, 0x29, 0xB2, 0xD0, 0x25, 0x5A, 0xB5, 0x16, 0x2C,
+    0x82, 0x81, 0x42, 0x86, 0x4C, 0xDE, 0xEC, 0x24, 0x66, 0x22, 0x22, 0xE3, 0xE1, 0x4F, 0x3A, 0x11,
+    0xE9, 0x39, 0x2D, 0x27, 0x5D, 0xD6, 0xE3, 0xC9, 0x12, 0x6D, 0xAB, 0x8F, 0xF2, 0xFE, 0x91, 0x40,
+    0x2C, 0x18, 0xF9, 0x77, 0xE4, 0x22, 0xE4, 0xBF, 0xF8, 0x1F, 0xB1, 0x7D, 0x8A, 0xCD, 0xAF, 0x01,
+    0xEE, 0x1E, 0x18, 0x99, 0x52, 0xCB, 0x72, 0x2D, 0xE8, 0x3E, 0x57, 0x37, 0xA1, 0x14, 0x19, 0x2A,
+    0x65, 0xD1, 0x45, 0x2E, 0x27, 0x3E, 0xC7, 0x73, 0x87, 0x55, 0x97, 0x4E, 0x4B, 0x16, 0x5F, 0x6F,
+    0x49, 0xF5, 0xFE, 0xFB, 0x0A, 0x29, 0xE9, 0xC9, 0x97, 0x2E, 0xB2, 0xED, 0xDE, 0x97, 0x2B, 0x3E,
+    0xA5, 0x02, 0xF5, 0x4B, 0xFD, 0xD8, 0xC6, 0x01, 0x49, 0x28, 0x88, 0x4A, 0x34, 0xD5, 0xA3, 0x35,
+    0x72, 0xB6, 0x69, 0xA9, 0xB7, 0xF6, 0xBD, 0x93, 0xB4, 0xE5, 0xDC, 0xA2, 0x91, 0xC6, 0x74, 0x20,
+    0xD3, 0x4A, 0xAB, 0x2C, 0x1A, 0xAE, 0x7A, 0x41, 0x85, 0x4A, 0xF7, 0xF3, 0x9B, 0x32, 0x6B, 0x71,
+    0x5E, 0x69, 0xF0, 0x7D, 0xB6, 0xAF, 0xD7, 0x8F, 0x70, 0x59, 0x4E, 0x70, 0x55, 0xDC, 0x36, 0x97,
+    0xAC, 0xD4, 0x70, 0xCE, 0xB5, 0x98, 0x21, 0x0F, 0x7C, 0x1A, 0x73, 0xE8, 0xA0, 0x9A, 0x0F, 0x6B,
+    0x4A, 0x99, 0x31, 0xCB, 0xDF, 0xAD, 0x55, 0xC5, 0xAE, 0x6C, 0x08, 0x8B, 0x5D, 0xEB, 0xB4, 0x63,
+    0x44, 0x26, 0xE3, 0xC6, 0x5F, 0xA9, 0x02, 0x7F, 0xDF, 0x88, 0x9A, 0xB9, 0x4E, 0x24, 0x58, 0x91,
+    0x79, 0xE7, 0xF4, 0x54, 0x42, 0xE5, 0xB6, 0xF8, 0x49, 0x9D, 0xE4, 0xB4, 0x09, 0xA8, 0x3A, 0x28,
+    0x0F, 0x69, 0x81, 0x37, 0x3B, 0x5C, 0x75, 0xE5, 0xEF, 0x29, 0x60, 0xB5, 0xD6, 0x3B, 0xF1, 0xE4,
+    0xBA, 0xFA, 0xFB, 0xB4, 0xC6, 0xC8, 0xDA, 0x8A, 0x24, 0x9D, 0x42, 0xAB, 0x17, 0x12, 0xA9, 0xC9,
+    0x64, 0x4A, 0xC2, 0xE9, 0x44, 0x64, 0x39, 0xF1, 0x53, 0x65, 0x63, 0x3A, 0xBD, 0x2D, 0xED, 0x0E,
+    0xD3, 0x64, 0x5B, 0xE9, 0xAD, 0x33, 0xED, 0x85, 0x83, 0xF4, 0xFC, 0x07, 0x3B, 0xD1, 0x18, 0x91,
+    0x60, 0x96, 0xBF, 0x5B, 0x33, 0x26, 0xC1, 0x94, 0x6D, 0x92, 0x4B, 0xB3, 0xA6, 0x06, 0x19, 0x01,
+    0xAA, 0x90, 0x5F, 0x2F, 0x63, 0x2E, 0x32, 0x15, 0x22, 0xB3, 0x15, 0x99, 0x39, 0x23, 0xEF, 0x69,
+    0xC4, 0x9F, 0x6D, 0x1D, 0xCD, 0x5A, 0xE0, 0x55, 0xE0, 0x35, 0x9D, 0xEB, 0xD9, 0x9F, 0x24, 0x64,
+    0xEC, 0x31, 0xC0, 0xE1, 0x00, 0x13, 0xCF, 0x01, 0x94, 0x77, 0x0E, 0x66, 0xA2, 0x62, 0x4F, 0x8F,
+    0xFD, 0x2D, 0x99, 0xEB, 0x86, 0xBC, 0xCD, 0x5B, 0xDE, 0x76, 0x35, 0xEE, 0x83, 0x0D, 0xC8, 0x67,
+    0xB7, 0x4F, 0xC1, 0x7F, 0xF1, 0xB9, 0xAE, 0x41, 0x5B, 0x23, 0x22, 0xF2, 0x8E, 0x88, 0xC8, 0xFA,
+    0xF8, 0x1B, 0x45, 0x34, 0x17, 0x3F, 0x66, 0xE1, 0xC3, 0xB8, 0xBF, 0x20, 0x7B, 0xC0, 0x46, 0x17,
+    0x56, 0xC9, 0x5E, 0x72, 0x5A, 0x31, 0x95, 0x96, 0x93, 0x2B, 0xC6, 0xBB, 0xB0, 0x23, 0x83, 0x29,
+    0x38, 0xAB, 0x17, 0x54, 0xCD, 0x7F, 0xFF, 0x80, 0x66, 0xF8, 0xEC, 0xAE, 0xA0, 0xAB, 0x2F, 0x3E,
+    0xBE, 0x9F, 0xBF, 0x2F, 0xC0, 0x35, 0xA8, 0x6A, 0x5C, 0x20, 0x1F, 0x10, 0x99, 0x3B, 0x11, 0x9A,
+    0xDD, 0xA5, 0x48, 0x36, 0xC1, 0x02, 0x8D, 0x72, 0x0E, 0x7A, 0xF2, 0x91, 0x4C, 0x16, 0x44, 0x6A,
+    0x2F, 0xBD, 0x93, 0x91, 0x27, 0xB4, 0xDD, 0x16, 0xB2, 0x40, 0xD3, 0xF3, 0xF9, 0x1A, 0x0C, 0x7C,
+    0x06, 0x8A, 0xBA, 0xA8, 0xC1, 0x7D, 0x25, 0x02, 0xEE, 0xEE, 0xBE, 0x27, 0xC7, 0x3C, 0x92, 0xAD,
+    0x2C, 0x22, 0x22, 0xB9, 0x88, 0xC8, 0x5C, 0x89, 0x88, 0x0C, 0x3F, 0xBC, 0xD8, 0xF1, 0xCC, 0xC7,
+    0x51, 0xF3, 0xEB, 0xFD, 0x85, 0xB8, 0x0B, 0x4C, 0xB4, 0xF3, 0x6E, 0xBF, 0xA8, 0x40, 0xAB, 0xCA,
+    0x5A, 0xD2, 0xF3, 0xFD, 0x0E, 0xF0, 0x2E, 0x76, 0xE5, 0xFF, 0x84, 0xA2, 0xA5, 0x0B, 0xF1, 0x3E,
+    0x2E, 0xCD, 0x36, 0x39, 0x5F, 0x3D, 0x86, 0xA9, 0xAC, 0xB9, 0x93, 0x0A, 0xF0, 0x65, 0x8B, 0x15,
+    0xD1, 0x4D, 0xC1, 0xCC, 0x9C, 0xA0, 0x5E, 0x9F, 0xA6, 0x40, 0x31, 0x1C, 0x10, 0x7F, 0xEE, 0xA6,
+    0xB2, 0x5D, 0xD9, 0x43, 0x21, 0x23, 0x56, 0x99, 0xFA, 0xB5, 0x6E, 0x4E, 0xF6, 0x50, 0x15, 0x3A,
+    0xF5, 0x31, 0x2A, 0x94, 0xE8, 0xF9, 0x3B, 0x8D, 0x29, 0x36, 0x86, 0x70, 0xC4, 0x68, 0xCE, 0x9F,
+    0x54, 0x28, 0xEE, 0x08, 0x8D, 0x9F, 0x58, 0x85, 0x36, 0x05, 0xC9, 0x07, 0x45, 0xCB, 0x67, 0xC8,
+    0x07, 0x9C, 0x16, 0x89, 0xC8, 0xA3, 0x56, 0x3A, 0x16, 0x9C, 0xC8, 0xEC, 0x45, 0xFE, 0xB5, 0x88,
+    0xD4, 0x56, 0xA9, 0x62, 0x2C, 0xDA, 0xB4, 0x4A, 0x7A, 0x44, 0x6A, 0x2B, 0x0B, 0x4E, 0xCD, 0xEA,
+    0xA9, 0xFA, 0x69, 0x20, 0x5B, 0x6C, 0x0B, 0xBC, 0xFE, 0xD6, 0x79, 0xC0, 0xE5, 0xDF, 0x00, 0x18,
+    0x12, 0x40, 0xF9, 0x83, 0x8F, 0x32, 0x40, 0x8F, 0xFF, 0x00, 0xBE, 0x7B, 0xDD, 0x48, 0x4D, 0x31,
+    0x6B, 0x46, 0x16, 0x12, 0xED, 0xCE, 0xF7, 0x18, 0xA9, 0xF3, 0x19, 0xAA, 0x48, 0x17, 0xB0, 0xEB,
+    0x96, 0x37, 0xEB, 0x1A, 0x4D, 0x17, 0xA1, 0x69, 0xCD, 0x0A, 0xC5, 0x48, 0xD5, 0x6F, 0xF9, 0x97,
+    0x8B, 0x29, 0x44, 0xCA, 0x47, 0x74, 0x5F, 0x5F, 0xAC, 0xBE, 0xB9, 0xAB, 0x11, 0x70, 0x11, 0x37,
+    0x62, 0x05, 0x23, 0xEF, 0xBF, 0x22, 0x7D, 0xDA, 0x63, 0xCE, 0x68, 0x8A, 0xAC, 0x1B, 0xB4, 0xD1,
+    0x89, 0x4C, 0x60, 0xBA, 0x13, 0x26, 0xE8, 0x8E, 0x09, 0x54, 0x6F, 0xBD, 0x80, 0x7D, 0xF7, 0xFB,
+    0x2D, 0xB7, 0xCE, 0x45, 0xDC, 0x8E, 0x9A, 0x73, 0xA2, 0xF8, 0x5C, 0x73, 0x27, 0x8B, 0xB8, 0xE0,
+    0x61, 0xB6, 0x91, 0xB2, 0xBD, 0x46, 0x36, 0x16, 0x3D, 0x9E, 0xDB, 0xE4, 0xD1, 0x05, 0xEE, 0x32,
+    0xE1, 0xFA, 0xB2, 0xCD, 0x96, 0x6C, 0xA6, 0x0B, 0x95, 0xC8, 0x9C, 0x89, 0x48, 0x5B, 0x89, 0x8C,
+    0x46, 0xA4, 0x21, 0x97, 0x7F, 0x78, 0xA0, 0xAB, 0x8F, 0xB1, 0x2D, 0xF2, 0x4A, 0xEB, 0xA5, 0x9E,
+    0xA9, 0x3F, 0x96, 0x59, 0xDA, 0xF5, 0x46, 0xB8, 0x4F, 0xA2, 0xA3, 0x4A, 0x94, 0x4D, 0xA2, 0xED,
+    0x4E, 0xA2, 0x21, 0x49, 0xB4, 0x8C, 0xD0, 0xB5, 0x99, 0xBE, 0xB9, 0x0A, 0x3B, 0x89, 0x0E, 0x07,
+    0x12, 0xF5, 0x8F, 0x94, 0xE8, 0xFA, 0x6B, 0x4B, 0x14, 0x2E, 0xF2, 0x25, 0x91, 0x60, 0x44, 0x84,
+    0x87, 0xF0, 0xD2, 0xAE, 0x92, 0x8D, 0xBA, 0x41, 0x52, 0xC0, 0xE3, 0x31, 0x93, 0x99, 0x28, 0xFA,
+    0xA2, 0xC7, 0x53, 0x61, 0x66, 0x66, 0x8A, 0xC1, 0x0E, 0xF8, 0xBA, 0x6C, 0xB3, 0x85, 0x8E, 0x2A,
+    0x66, 0xBB, 0xED, 0x92, 0x2A, 0x91, 0x91, 0x46, 0xFE, 0x3A, 0xD0, 0x4C, 0xCD, 0xEE, 0x96, 0x91,
+    0xDF, 0x03, 0x9C, 0xA6, 0x09, 0xB3, 0xD1, 0x2C, 0x79, 0x65, 0x47, 0x22, 0xF9, 0x98, 0xC5, 0x5F,
+    0x9B, 0x51, 0xAB, 0xC9, 0x17, 0xCA, 0x11, 0xBA, 0x90, 0x29, 0x21, 0xD4, 0x0F, 0x20, 0xAD, 0x5D,
+    0xA0, 0x8C, 0x34, 0x81, 0x4C, 0x28, 0x66, 0xF0, 0x43, 0x82, 0x18, 0x5C, 0x84, 0x26, 0x20, 0x50,
+    0x4C, 0x94, 0x03, 0x74, 0x75, 0x96, 0xB4, 0x35, 0xC0, 0x8A, 0x9D, 0xA0, 0xEC, 0x69, 0x6A, 0xEC,
+    0xAC, 0x71, 0xBE, 0xBE, 0x79, 0xC4, 0x29, 0x77, 0x4D, 0x79, 0x68, 0xE5, 0x7A, 0xA9, 0x5B, 0x54,
+    0xB6, 0x81, 0x52, 0xE3, 0x37, 0xE5, 0x1D, 0x17, 0x6A, 0x1D, 0xCE, 0x9C, 0x08, 0xE6, 0xF2, 0x9A,
+    0xC8, 0x39, 0xF2, 0x9A, 0x3B, 0xDC, 0x06, 0x91, 0xA0, 0xEE, 0x8F, 0x37, 0x1F, 0x4E, 0x9C, 0xD0,
+    0xF7, 0xD9, 0x68, 0x93, 0xD4, 0xAF, 0x71, 0x8D, 0x6C, 0xCC, 0x46, 0x5C, 0x28, 0x02, 0x0D, 0x9E,
+    0x6C, 0x62, 0xC2, 0xF5, 0xF9, 0x40, 0x57, 0x57, 0xA1, 0x98, 0xE9, 0xD4, 0x54, 0x4A, 0x5B, 0x88,
+    0x2C, 0x94, 0xF2, 0xCB, 0x48, 0xB9, 0x96, 0x07, 0x79, 0x86, 0x96, 0x7F, 0x9E, 0x52, 0x9F, 0x15,
+    0x02, 0xC0, 0xF9, 0x67, 0x01, 0xEC, 0xF7, 0xDB, 0x3D, 0x87, 0x44, 0x77, 0x37, 0xFB, 0x98, 0xC3,
+    0x8D, 0xD0, 0xF4, 0xFF, 0xA9, 0xC6, 0xA2, 0xDB, 0x19, 0x8B, 0x5F, 0x57, 0xB5, 0x7F, 0x7D, 0x63,
+    0x61, 0x26, 0xE0, 0xB5, 0x1E, 0x9E, 0x7C, 0x1C, 0x4C, 0x18, 0xE0, 0xD9, 0x67, 0x93, 0xCB, 0x3F,
+    0x7D, 0xFD, 0x37, 0x6F, 0x35, 0x9E, 0xD6, 0xFD, 0xB5, 0x27, 0xB2, 0x09, 0x8A, 0xB8, 0x11, 0x7E,
+    0xAB, 0x00, 0x77, 0x37, 0x0E, 0xF6, 0x27, 0x13, 0x76, 0xD2, 0xF2, 0x24, 0xED, 0xA4, 0xE6, 0xC9,
+    0x92, 0x24, 0x3D, 0x4F, 0xF2, 0xDE, 0x61, 0x69, 0x1A, 0x58, 0xA9, 0xA6, 0x27, 0x89, 0x27, 0x55,
+    0x4F, 0x22, 0x4F, 0xBA, 0x9E, 0x64, 0x9E, 0x94, 0x3D, 0x09, 0x3D, 0x69, 0xBB, 0x4A, 0x3D, 0xA9,
+    0xFB, 0xB6, 0x0F, 0x68, 0xD2, 0xF7, 0x24, 0xF7, 0xA4, 0xF0, 0xF7, 0x09, 0xFE, 0xF4, 0x75, 0x4E,
+    0xB7, 0x66, 0xC6, 0x4C, 0x34, 0xD0, 0x68, 0xAF, 0x4F, 0x5F, 0x7F, 0xB8, 0xD4, 0x77, 0x3A, 0xAF,
+    0x9B, 0x39, 0x7B, 0x76, 0x5B, 0xBE, 0x5F, 0x23, 0x1B, 0x13, 0x2A, 0x76, 0x9B, 0x3C, 0xE2, 0x02,
+    0x77, 0x61, 0xC2, 0xF5, 0x94, 0x6D, 0xB6, 0x90, 0xCD, 0x74, 0x81, 0x4A, 0x64, 0x26, 0x13, 0xD1,
+    0x85, 0x0A, 0x23, 0x46, 0xA4, 0xE1, 0xC4, 0x40, 0x7C, 0x8C, 0xC6, 0xF2, 0xFF, 0x97, 0xC6, 0xCE,
+    0x07, 0x82, 0x53, 0x26, 0xDC, 0xEF, 0x71, 0x00, 0x9F, 0x6C, 0xA5, 0xC5, 0x13, 0x1C, 0xAE, 0xA2,
+    0xAF, 0x54, 0x39, 0x5D, 0xF0, 0x98, 0x29, 0x1F, 0xA8, 0xEA, 0x3B, 0xD8, 0x58, 0x04, 0x1A, 0x66,
+    0x8A, 0xC1, 0xB5, 0x2C, 0x66, 0xA2, 0xEA, 0xAB, 0x50, 0xCC, 0x99, 0x88, 0x84, 0x4A, 0x64, 0xCA,
+    0x44, 0xA4, 0x2E, 0xE5, 0x97, 0x31, 0x19, 0xE2, 0x73, 0x29, 0x63, 0xCF, 0x86, 0xB4, 0x54, 0x2F,
+    0xAF, 0xB7, 0xF8, 0x4D, 0x49, 0x72, 0xBB, 0x0D, 0x2D, 0x36, 0xD2, 0xC2, 0xC6, 0x75, 0xBD, 0x9A,
+    0xFC, 0xED, 0x05, 0x45, 0x1E, 0x39, 0xE2, 0xA9, 0xFB, 0xC8, 0xCB, 0x90, 0xCD, 0x89, 0x62, 0xB0,
+    0x26, 0x36, 0x81, 0xA4, 0x9D, 0x0E, 0x9A, 0xB6, 0x49, 0xAB, 0x3F, 0x34, 0x66, 0x2D, 0x87, 0x3C,
+    0x31, 0x19, 0xCD, 0x4A, 0x36, 0x93, 0x4F, 0x74, 0xB5, 0x11, 0xDD, 0xC7, 0x12, 0x09, 0x99, 0x6E,
+    0x8D, 0x38, 0x2A, 0x93, 0x55, 0x56, 0xBA, 0x96, 0xAE, 0xEE, 0x24, 0xF8, 0x80, 0xEF, 0x9B, 0x0F,
+    0x62, 0x35, 0xE0, 0x46, 0xFF, 0x6F, 0x66, 0x17, 0xB1, 0x8B, 0x8F, 0xF2, 0xF5, 0x11, 0xE4, 0xF2,
+    0xE8, 0x7F, 0x36, 0x83, 0xFF, 0x60, 0x72, 0xBF, 0x5A, 0xC0, 0xC9, 0x9C, 0xE9, 0xCA, 0xD4, 0x45,
+    0xB7, 0xEA, 0x91, 0x95, 0x4A, 0x02, 0x78, 0xD1, 0xD2, 0x8E, 0x93, 0xDA, 0x28, 0x2E, 0xD0, 0xE2,
+    0x47, 0xDD, 0x71, 0xC1, 0xCD, 0x07, 0x0B, 0x26, 0xBA, 0x7D, 0x15, 0xF8, 0xB8, 0xAC, 0xB7, 0xC5,
+    0x12, 0xF7, 0xAF, 0x95, 0x68, 0x00, 0xF7, 0xAF, 0x66, 0xA0, 0xC9, 0x23, 0xD8, 0xA9, 0x0C, 0x50,
+    0x86, 0x86, 0xE7, 0x59, 0xCD, 0x6C, 0xC7, 0x3C, 0xE6, 0xD1, 0x47, 0xDF, 0x96, 0xEF, 0xCA, 0x4F,
+    0x66, 0x1A, 0x2F, 0x7F, 0x31, 0x98, 0x55, 0xA4, 0x4B, 0x7B, 0x0B, 0x94, 0xF2, 0x81, 0x04, 0x9A,
+    0xD9, 0x2F, 0x18, 0x09, 0x12, 0x29, 0x96, 0x4C, 0x6A, 0xAA, 0x5E, 0x69, 0x52, 0x9F, 0xDB, 0x91,
+    0x2D, 0xF2, 0x19, 0xB0, 0x3F, 0xEB, 0xC1, 0xF6, 0xE7, 0x20, 0xEB, 0x4F, 0x7C, 0x55, 0x81, 0x6F,
+    0xC1, 0x7F, 0x23, 0x82, 0xFF, 0x07, 0x33, 0x54, 0xA1, 0xA9, 0xA9, 0x82, 0x8B, 0x94, 0x7D, 0x02,
+    0xC9, 0x6A, 0x17, 0xA9, 0x06, 0x17, 0xC9, 0xE7, 0x62, 0x04, 0xF9, 0xFA, 0x04, 0xFE, 0x67, 0xF3,
+    0x0E, 0xA9, 0x5E, 0xD0, 0x04, 0x59, 0x37, 0x5E, 0xD2, 0x05, 0x3C, 0xBA, 0x1F, 0x6F, 0xBF, 0x39,
+    0x0A, 0x37, 0x93, 0xB6, 0xDD, 0xB7, 0x52, 0x6F, 0x3B, 0x54, 0x28, 0x90, 0xBE, 0xD5, 0x29, 0x5E,
+    0xDF, 0x25, 0x12, 0x0A, 0x39, 0x5E, 0xA8, 0x00, 0x57, 0x9F, 0x05, 0xD3, 0x3E, 0xAC, 0xE8, 0xFC,
+    0x5B, 0xB1, 0xAB, 0xDA, 0xCC, 0x0C, 0x1D, 0x1D, 0xF8, 0xE0, 0x03, 0xD5, 0x50, 0x0D, 0xB8, 0xD1,
+    0x8D, 0x8F, 0x5C, 0x92, 0xE0, 0x7E, 0x3A, 0x83, 0x1B, 0x3A, 0x28, 0x62, 0xD9, 0x53, 0x44, 0x3B,
+    0x93, 0x8F, 0x08, 0x76, 0xA2, 0xEA, 0xED, 0x4C, 0x31, 0xD9, 0x19, 0x23, 0xD9, 0x02, 0xFE, 0x2F,
+    0x57, 0x70, 0xF7, 0x64, 0xDB, 0x6D, 0xAF, 0x91, 0x3A, 0x6D, 0xC0, 0x99, 0x76, 0x5E, 0xEC, 0xB7,
+    0x84, 0xC9, 0x8D, 0x5B, 0xBE, 0x64, 0x95, 0x42, 0xDA, 0x6E, 0x2F, 0x37, 0x71, 0xAB, 0x8B, 0x96,
+    0xEB, 0x41, 0x99, 0x5F, 0x27, 0x24, 0x07, 0xA8, 0xE3, 0x6E, 0x07, 0x40, 0x9D, 0xC6, 0x1F, 0xBF,
+    0xE5, 0x91, 0x39, 0x28, 0x8C, 0xE8, 0xFA, 0x6D, 0x59, 0xD2, 0xA6, 0xCA, 0x69, 0xB1, 0x50, 0x7B,
+    0x70, 0xCA, 0x4F, 0x9C, 0x0A, 0x8D, 0xDA, 0x9C, 0x9E, 0xCA, 0xB4, 0x0F, 0x8F, 0x9E, 0x2A, 0x39,
+    0x24, 0x4B, 0xA5, 0x53, 0xA3, 0xA7, 0xB4, 0x2B, 0x8B, 0xA4, 0x93, 0xAE, 0xFF, 0xDA, 0x4E, 0xFB,
+    0x2D, 0x4E, 0x14, 0x9D, 0x17, 0x89, 0xBA, 0x30, 0x28, 0x2D, 0x62, 0x94, 0xAD, 0x62, 0x96, 0x92,
+    0xF0, 0x3C, 0x6C, 0x30, 0x6B, 0x75, 0xC0, 0x39, 0x7A, 0xE8, 0x61, 0x45, 0x66, 0xDD, 0xAB, 0x45,
+    0x37, 0x6C, 0x51, 0x3D, 0x6D, 0xDA, 0x94, 0xDD, 0x96, 0x31, 0x25, 0x75, 0x76, 0xD9, 0x32, 0xB8,
+    0x2E, 0xA4, 0x84, 0xCE, 0xAD, 0x6F, 0xDE, 0x50, 0x37, 0xE3, 0x45, 0x26, 0x9A, 0x6D, 0x9D, 0xFA,
+    0xB6, 0x37, 0x61, 0x22, 0x19, 0xCD, 0x27, 0xA8, 0x5F, 0xDD, 0xA3, 0xA5, 0x5F, 0x6A, 0x4F, 0xB6,
+    0xCD, 0xAB, 0x45, 0x44, 0x7A, 0x1D, 0x04, 0xBD, 0x93, 0x9F, 0x0E, 0x4F, 0xCD, 0x89, 0x53, 0xA7,
+    0x7A, 0xA9, 0x19, 0xA0, 0xD1, 0x0F, 0xA4, 0x53, 0x82, 0x1F, 0xAD, 0x96, 0x21, 0xD2, 0x49, 0xF7,
+    0x8F, 0xDD, 0xF0, 0x20, 0xB7, 0x9D, 0xC2, 0x01, 0xC1, 0xAC, 0x94, 0xDD, 0x7E, 0x3D, 0x69, 0x71,
+    0xB6, 0x88, 0x8E, 0x85, 0x04, 0xDD, 0x0B, 0x34, 0x35, 0xAB, 0xDE, 0x00, 0x02, 0xD9, 0xFA, 0x99,
+    0xAD, 0xFF, 0xB5, 0x84, 0xFD, 0x87, 0x6A, 0x0B, 0x8B, 0x5A, 0xD7, 0x40, 0x4F, 0xB7, 0x0F, 0xD6,
+    0xF2, 0x6D, 0xA8, 0xE4, 0x7D, 0xDF, 0x20, 0xF2, 0xB7, 0x49, 0xE3, 0x81, 0xC8, 0x5B, 0x70, 0x54,
+    0x04, 0x28, 0xEF, 0x6E, 0x04, 0x7E, 0xDB, 0xC3, 0x49, 0x74, 0xF8, 0x37, 0xAB, 0xF1, 0xA9, 0xE4,
+    0x31, 0x63, 0x96, 0xC7, 0xB0, 0x31, 0x91, 0x35, 0x5B, 0xE5, 0xD4, 0xF9, 0x84, 0x47, 0x5D, 0x4B,
+    0xC0, 0x8D, 0x6E, 0x6C, 0x43, 0x36, 0x29, 0x80, 0xB1, 0x51, 0x98, 0xDD, 0xA0, 0xE8, 0x93, 0xEE,
+    0xF1, 0xA8, 0xBE, 0xAB, 0xA9, 0xE1, 0x98, 0x3C, 0xD2, 0xE1, 0x22, 0xA7, 0x4E, 0x7C, 0xE7, 0xC7,
+    0x2D, 0xF0, 0xE0, 0x47, 0x2A, 0xD7, 0x3E, 0xC7, 0x95, 0xC7, 0xC9, 0xDA, 0x6C, 0xCC, 0xB3, 0x0F,
+    0xB2, 0x30, 0xF4, 0xC3, 0xAD, 0x73, 0x71, 0xB7, 0xFF, 0xF9, 0xA9, 0x8B, 0x22, 0x52, 0x1D, 0x6C,
+    0xE2, 0xF8, 0xC5, 0x9B, 0x22, 0xEF, 0xEE, 0x64, 0x78, 0x44, 0xFE, 0x0D, 0xEC, 0xBB, 0x43, 0xDE,
+    0x77, 0x32, 0x38, 0xE9, 0xF9, 0x6E, 0x8D, 0xFB, 0xC9, 0xEC, 0xFF, 0x7C, 0xEE, 0xDA, 0x07, 0xBF,
+    0xC0, 0xA5, 0xFA, 0xC9, 0x57, 0x82, 0x33, 0xF1, 0x29, 0x20, 0x1B, 0x9F, 0x7C, 0xE2, 0xF9, 0x27,
+    0xCE, 0xBF, 0x50, 0xC5, 0xA2, 0xE5, 0x0E, 0xDC, 0xCE, 0x46, 0xB2, 0xD1, 0x0D, 0xB8, 0xC1, 0x07,
+    0x7C, 0xB8, 0x08, 0x17, 0x79, 0x8D, 0xB3, 0xE7, 0x4C, 0x74, 0x7F, 0xDA, 0xDA, 0x85, 0x6C, 0x84,
+    0xEB, 0x3C, 0x0D, 0x4F, 0xA7, 0xCD, 0xF5, 0x16, 0x58, 0x70, 0x3D, 0x65, 0x6F, 0xFE, 0x09, 0xE6,
+    0x9F, 0x50, 0x45, 0xA4, 0x2D, 0x66, 0x7C, 0x9F, 0xAD, 0xB8, 0x48, 0x13, 0x36, 0xCE, 0x57, 0xBE,
+    0x22, 0xC1, 0x8D, 0x99, 0xE0, 0xFB, 0x7C, 0x4A, 0x3B, 0x11, 0xA2, 0x65, 0x2D, 0xA9, 0xF3, 0x19,
+    0x1F, 0x8C, 0xE0, 0x46, 0x9A, 0xC0, 0xB7, 0xB3, 0x1F, 0xFF, 0x2F, 0x6E, 0x34, 0xA1, 0x00, 0xBE,
+    0xC0, 0x90, 0xFD, 0x55, 0x3E, 0x3F, 0xC9, 0x8B, 0x40, 0xF7, 0xC3, 0x8B, 0x22, 0xCB, 0xA9, 0x4B,
+    0x33, 0xCC, 0x30, 0x61, 0xF4, 0x6B, 0x5A, 0x9E, 0x24, 0xBC, 0x50, 0x7C, 0x6D, 0xF8, 0x02, 0xF9,
+    0x4B, 0xB6, 0x0E, 0x2F, 0x18, 0xE0, 0x49, 0xCE, 0x97, 0x43, 0x35, 0x9A, 0x1B, 0x3F, 0xC8, 0xA4,
+    0xED, 0xB2, 0x50, 0x68, 0x24, 0xCF, 0x17, 0xDC, 0x6C, 0x53, 0x39, 0xE5, 0xD4, 0x57, 0x44, 0x16,
+    0x9F, 0xD6, 0xBE, 0xF7, 0x4B, 0xF5, 0xD3, 0xB9, 0x0B, 0x36, 0xDA, 0x58, 0x85, 0x2A, 0x08, 0x92,
+    0xCF, 0xC5, 0x5C, 0x0D, 0xD5, 0x70, 0x42, 0x48, 0xE0, 0x66, 0x23, 0xB5, 0x8F, 0x76, 0xA6, 0x69,
+    0x5D, 0xCC, 0x56, 0xE5, 0xCA, 0x3D, 0xF0, 0xDD, 0x26, 0x5F, 0x30, 0x43, 0xDE, 0x3E, 0xC5, 0x0B,
+    0x94, 0xF1, 0x74, 0x04, 0x3B, 0x5C, 0x28, 0xC2, 0x5C, 0xFE, 0x83, 0xD1, 0x67, 0x37, 0x1E, 0x7F,
+    0xF3, 0x46, 0x23, 0xEF, 0xF4, 0xCF, 0x39, 0x6E, 0x3D, 0x9F, 0xB5, 0xDF, 0xE6, 0x73, 0x17, 0xB8,
+    0xE5, 0xBE, 0x1E, 0xF2, 0x95, 0x6C, 0xC2, 0x0C, 0x98, 0xEB, 0xD8, 0x48, 0x3E, 0xE3, 0xFE, 0xB4,
+    0xBE, 0x90, 0x0D, 0xB7, 0x78, 0xE1, 0xE1, 0x5A, 0xB1, 0xFF, 0xEE, 0x9B, 0x4C, 0xE4, 0x1D, 0x91,
+    0x1B, 0xC0, 0xC3, 0xDE, 0x79, 0xF0, 0xA5, 0x3A, 0x2F, 0xDA, 0xF6, 0xCB, 0x4F, 0x38, 0xC3, 0xD3,
+    0xA6, 0x8E, 0xC5, 0x57, 0xFB, 0xE7, 0xF2, 0x9F, 0xCF, 0xBA, 0x96, 0xC3, 0xCB, 0x8F, 0xC3, 0x53,
+    0x05, 0xE7, 0x5F, 0x34, 0xA1, 0x2F, 0x72, 0x99, 0x4E, 0x5D, 0xAA, 0xED, 0xBF, 0x6A, 0x9F, 0x7F,
+    0xAD, 0xFD, 0xF1, 0xF7, 0x4F, 0x7F, 0xEA, 0xF9, 0xF3, 0x5F, 0xEE, 0xEB, 0xAF, 0x72, 0xFA, 0x53,
+    0xF6, 0xB5, 0xAC, 0xB7, 0xE1, 0xC9, 0xE1, 0xB5, 0x57, 0x1F, 0xF6, 0x9C, 0x67, 0xF3, 0xF0, 0xE5,
+    0x2B, 0x5F, 0x48, 0xC5, 0x85, 0x5B, 0x50, 0x6A, 0xE8, 0x3F, 0x1D, 0xB0, 0x35, 0x1F, 0xD4, 0xC6,
+    0x2F, 0xBE, 0xF9, 0x7F, 0xC8, 0x72, 0x64, 0xFF, 0xBC, 0x3D, 0xBA, 0x71, 0xBA, 0x06, 0x1E, 0xE3,
+    0xA6, 0x2C, 0x56, 0x64, 0x79, 0x70, 0xE3, 0xA1, 0x67, 0x2E, 0x3A, 0x91, 0x61, 0xDB, 0xCB, 0x34,
+    0x0F, 0xEE, 0xAB, 0xB1, 0x08, 0x93, 0x8D, 0x57, 0x99, 0x3C, 0xB7, 0x5D, 0xF0, 0xF9, 0x50, 0x7E,
+    0xEF, 0xC6, 0xE9, 0xEB, 0x9F, 0xBB, 0x94, 0xC9, 0xEC, 0x25, 0x98, 0x89, 0xAA, 0xB6, 0x23, 0x5F,
+    0x4C, 0x9F, 0x7F, 0x52, 0xD3, 0x80, 0x2F, 0xA7, 0xDF, 0xB2, 0xF1, 0x7F, 0xE0, 0xFF, 0xFA, 0x7F,
+    0xDE, 0x7A, 0xCA, 0xFD, 0xD3, 0xAC, 0xEF, 0xC2, 0x91, 0x1B, 0x31, 0x01, 0xBE, 0x0C, 0x4F, 0x81,
+    0x09, 0x70, 0x7E, 0x57, 0xE8, 0xB8, 0x7D, 0xC8, 0xED, 0x4D, 0xBB, 0xCE, 0xAF, 0x4A, 0x06, 0xB9,
+    0x8E, 0x1D, 0xAD, 0xDC, 0x1C, 0xF0, 0xC1, 0xF7, 0x6E, 0xC8, 0x66, 0x3B, 0x53, 0x7C, 0x28, 0xA1,
+    0xEA, 0x39, 0x2D, 0xEF, 0x25, 0x10, 0x3B, 0x19, 0xF1, 0x94, 0x44, 0x3C, 0xB3, 0x95, 0x49, 0x2E,
+    0x6A, 0xFC, 0x76, 0xC1, 0xCC, 0x15, 0x57, 0x6C, 0x74, 0xDF, 0x1B, 0x8B, 0x60, 0x1F, 0xD8, 0x9F,
+    0x20, 0x93, 0xDA, 0xD4, 0xEE, 0xDF, 0xF7, 0x79, 0xEF, 0x19, 0x5D, 0x7B, 0x87, 0x46, 0xF8, 0x9F,
+    0xD3, 0xAA, 0x19, 0x6D, 0xE1, 0xB2, 0x2D, 0x4C, 0xE2, 0x80, 0xD3, 0x55, 0x41, 0xF6, 0x16, 0xC0,
+    0xD3, 0x17, 0x9E, 0xF8, 0xD4, 0xEF, 0x03, 0x9C, 0xFE, 0x2C, 0xC0, 0xD9, 0x02, 0xC8, 0xA2, 0xF9,
+    0x05, 0xA6, 0xAB, 0x4F, 0x20, 0x3B, 0x67, 0x64, 0xAD, 0xC9, 0xDE, 0xE7, 0xD4, 0x5D, 0x9E, 0x02,
+    0x4E, 0xF7, 0xE7, 0x01, 0x5E, 0xFC, 0x7D, 0xD8, 0x6D, 0xE0, 0xB1, 0x05, 0xB7, 0x99, 0x7E, 0x25,
+    0x45, 0xAF, 0xA7, 0x91, 0x3D, 0xEC, 0xFE, 0xE0, 0x7A, 0xEB, 0x7C, 0xD8, 0x49, 0x60, 0x3D, 0xC9,
+    0xD1, 0xDE, 0xD7, 0x8B, 0x2E, 0xBD, 0x8C, 0x13, 0x99, 0x29, 0x45, 0xE6, 0xB4, 0x1B, 0xD0, 0x8E,
+    0x15, 0x7D, 0x67, 0x97, 0xB5, 0xCD, 0x80, 0x59, 0x2E, 0x5D, 0xAA, 0xB3, 0xB4, 0xB1, 0x8D, 0xE8,
+    0x98, 0xE4, 0xC3, 0x56, 0x85, 0x76, 0x3B, 0x7E, 0x70, 0xF9, 0xC6, 0xA5, 0x97, 0x35, 0x95, 0xDE,
+    0xCC, 0xFC, 0x48, 0xB7, 0xB9, 0xFB, 0x53, 0x46, 0xB6, 0xAD, 0xAB, 0x27, 0xBD, 0x85, 0xB2, 0xB8,
+    0xEF, 0xEC, 0x9E, 0xAC, 0x5B, 0x16, 0x0C, 0x3B, 0xEC, 0x5C, 0xB9, 0x00, 0x37, 0xD7, 0xB4, 0x69,
+    0x97, 0x5B, 0x8C, 0x16, 0xE9, 0x43, 0x36, 0x93, 0x45, 0x16, 0xB8, 0x82, 0x87, 0x8A, 0xB2, 0xC5,
+    0xB5, 0x45, 0x4F, 0xDE, 0xDB, 0x48, 0x1E, 0x99, 0x69, 0x46, 0x1A, 0xFC, 0x84, 0x6F, 0xDD, 0x7B,
+    0xFC, 0x7F, 0xCD, 0xBD, 0x4D, 0x8C, 0x26, 0xC7, 0x99, 0xE7, 0xF7, 0x8B, 0x0C, 0x76, 0xE7, 0x0C,
+    0x53, 0x54, 0x10, 0x86, 0x28, 0xC8, 0xFC, 0xCA, 0x85, 0x31, 0x63, 0x68, 0xE8, 0xEE, 0xCE, 0x39,
+    0xF0, 0x40, 0xD8, 0x55, 0x15, 0xC1, 0x21, 0x60, 0x2E, 0xA0, 0x83, 0xDA, 0x06, 0x5B, 0x58, 0xEF,
+    0x00, 0x1E, 0x1D, 0xF6, 0x30, 0xE3, 0xB1, 0xA7, 0x65, 0x80, 0x07, 0x2E, 0x50, 0xDD, 0x99, 0x12,
+    0x0D, 0x8F, 0x81, 0x01, 0xAC, 0x36, 0x2C, 0xFA, 0xE2, 0x35, 0x96, 0x06, 0x24, 0x5B, 0xDB, 0x3A,
+    0x90, 0x87, 0x3E, 0x70, 0x77, 0xAB, 0x3A, 0x43, 0xE4, 0x61, 0x61, 0xC8, 0x86, 0x52, 0xE4, 0xD8,
+    0x3A, 0xE8, 0xC0, 0xD4, 0xB2, 0x35, 0xB3, 0xA2, 0xEC, 0x65, 0x8C, 0x94, 0x12, 0xB3, 0xC9, 0xC8,
+    0x7C, 0x7C, 0x88, 0xC8, 0xB7, 0xAA, 0x9B, 0x1F, 0xE2, 0xC2, 0x33, 0xF0, 0xBC, 0x40, 0xD5, 0x5B,
+    0xEF, 0x9B, 0xEF, 0x47, 0x66, 0xC4, 0xF3, 0xF9, 0x7F, 0xFE, 0xCF, 0x53, 0x00, 0x9F, 0x03, 0xA8,
+    0x01, 0x0C, 0x80, 0xE9, 0x80, 0xCA, 0x03, 0xE5, 0xC0, 0xAF, 0xBB, 0xA9, 0x4B, 0x97, 0x2E, 0xA1,
+    0x45, 0xC4, 0x23, 0x22, 0x81, 0xAB, 0x00, 0x4D, 0x07, 0x98, 0x01, 0x28, 0x03, 0x50, 0x44, 0x80,
+    0x15, 0xC0, 0x3A, 0xA0, 0xF6, 0x40, 0x15, 0x00, 0x7D, 0x72, 0xA4, 0x77, 0x80, 0xF5, 0x80, 0x09,
+    0x40, 0x39, 0x03, 0xC5, 0x0A, 0x20, 0xBB, 0x23, 0x4D, 0xB8, 0xE3, 0xBB, 0xFB, 0x19, 0xA8, 0x44,
+    0x3A, 0x68, 0x87, 0x7A, 0xA4, 0x58, 0xD0, 0x13, 0x55, 0x80, 0x48, 0xED, 0x21, 0x62, 0x1D, 0xFC,
+    0x3D, 0x5A, 0x00, 0x22, 0x80, 0x12, 0x91, 0x8E, 0x42, 0x44, 0x1C, 0x5A, 0x44, 0x40, 0x07, 0xB6,
+    0xF3, 0x4C, 0xE7, 0x44, 0x15, 0xE1, 0x66, 0x57, 0xC9, 0x4F, 0x5F, 0x12, 0x5F, 0x89, 0x88, 0xB8,
+    0x52, 0x44, 0x56, 0xB4, 0x88, 0x44, 0x10, 0x91, 0x11, 0x1E, 0x92, 0xDB, 0x77, 0xAC, 0xC2, 0x45,
+    0xA0, 0x16, 0xF1, 0xD0, 0x8A, 0x04, 0xB0, 0x22, 0x33, 0xD8, 0xC5, 0xDD, 0xB3, 0x9D, 0xB6, 0x19,
+    0x4F, 0xBE, 0xA8, 0x98, 0x01, 0x10, 0x00, 0xEC, 0x6D, 0x80, 0x52, 0x56, 0x07, 0xF4, 0xB2, 0x02,
+    0xA5, 0xC8, 0x04, 0x9C, 0x15, 0xE9, 0x80, 0x42, 0x26, 0x80, 0x66, 0x05, 0xA8, 0xC4, 0x03, 0x5A,
+    0x02, 0x8E, 0x42, 0x66, 0xFA, 0xB7, 0x5F, 0x92, 0x48, 0x2F, 0x22, 0xCB, 0x1D, 0xBF, 0x1B, 0x11,
+    0x99, 0x50, 0x7D, 0xFA, 0xD8, 0x74, 0xD3, 0x33, 0x3A, 0x52, 0xCE, 0x54, 0x13, 0x55, 0xC0, 0x04,
+    0xCC, 0x40, 0xED, 0x69, 0x3C, 0xB6, 0xC3, 0x3A, 0x7A, 0x10, 0x58, 0x51, 0x2B, 0xC5, 0x82, 0x8E,
+    0xE8, 0x48, 0x35, 0x63, 0x26, 0xCC, 0x44, 0x13, 0xB0, 0x81, 0x76, 0xE4, 0xF2, 0x08, 0xC6, 0xD7,
+    0xBE, 0x88, 0x45, 0xC4, 0x7A, 0xEB, 0xAB, 0xB9, 0x9A, 0x11, 0x27, 0xEE, 0x23, 0x84, 0x44, 0xCF,
+    0x79, 0x07, 0xCB, 0x39, 0xEF, 0x74, 0x15, 0xF2, 0xE5, 0x9B, 0x01, 0x54, 0x04, 0x1A, 0xBF, 0xBD,
+    0xEE, 0x8E, 0xC3, 0x23, 0xA8, 0x15, 0x68, 0x86, 0x2C, 0x2D, 0xD6, 0x43, 0x35, 0x67, 0xB1, 0x30,
+    0x13, 0x14, 0x02, 0xD8, 0x00, 0xE5, 0x0A, 0x5C, 0x1E, 0xF3, 0x77, 0x5E, 0x07, 0x68, 0xBB, 0xFC,
+    0xD6, 0x2C, 0x54, 0x11, 0x28, 0x96, 0xDD, 0xD2, 0x27, 0xA1, 0xDA, 0x1D, 0xD6, 0x91, 0xFC, 0x6D,
+    0xF4, 0xBB, 0xC3, 0xF5, 0x08, 0x54, 0xD3, 0x47, 0x0A, 0xEB, 0x08, 0x94, 0xD3, 0x9D, 0x52, 0xDE,
+    0x3B, 0xA0, 0xF5, 0xE0, 0xFA, 0x11, 0xAC, 0x04, 0xA8, 0x65, 0x82, 0x4A, 0x66, 0xD0, 0x32, 0x01,
+    0x72, 0xED, 0xCE, 0x25, 0xBA, 0x08, 0xD0, 0x8A, 0x8C, 0x80, 0x16, 0x11, 0x07, 0x18, 0xC7, 0x21,
+    0xC0, 0x21, 0x45, 0x00, 0x8A, 0x31, 0xA9, 0xA6, 0x71, 0xEC, 0x03, 0xEC, 0xA5, 0xA7, 0x55, 0xC0,
+    0xF8, 0xF4, 0xB4, 0x95, 0x17, 0x61, 0x0F, 0x25, 0x32, 0xA1, 0x02, 0x95, 0x2F, 0x26, 0x8C, 0xC3,
+    0x52, 0x8C, 0xEC, 0xC1, 0x4C, 0xE9, 0x55, 0xA0, 0x1C, 0x68, 0xD2, 0xD3, 0xCC, 0xEC, 0x41, 0xA4,
+    0x1A, 0x8A, 0x40, 0x39, 0x2A, 0xC1, 0x74, 0x34, 0x22, 0x13, 0x47, 0x20, 0x22, 0x9D, 0x0D, 0x68,
+    0x91, 0x19, 0x81, 0x5A, 0xDE, 0xA3, 0xD8, 0x9D, 0xF4, 0x99, 0xB4, 0xD5, 0x7A, 0x80, 0x00, 0x2A,
+    0xC0, 0x21, 0x70, 0x04, 0x17, 0x80, 0x83, 0x64, 0x43, 0x8C, 0x43, 0x0F, 0x50, 0x7A, 0x8A, 0x00,
+    0x45, 0x48, 0x2A, 0x38, 0xC3, 0x01, 0x60, 0x45, 0x44, 0x6E, 0x51, 0x8B, 0x88, 0xC8, 0x50, 0x79,
+    0x74, 0x20, 0xEA, 0x11, 0x66, 0x8C, 0x9B, 0xE0, 0x0A, 0x7A, 0x3C, 0x04, 0x0B, 0xF3, 0x01, 0x18,
+    0xCF, 0xBE, 0x71, 0x94, 0x23, 0xB6, 0xF4, 0x14, 0x13, 0xFD, 0xD7, 0x02, 0x88, 0x88, 0x9F, 0xC1,
+    0x8A, 0x0C, 0xFB, 0x50, 0x8B, 0x0C, 0x35, 0x54, 0xA7, 0x04, 0xDE, 0x88, 0x88, 0x84, 0x56, 0x44,
+    0xE4, 0x55, 0x11, 0x91, 0xF5, 0xDE, 0x6F, 0x7D, 0x21, 0x3C, 0x70, 0x31, 0x6F, 0x1D, 0xCB, 0x89,
+    0x42, 0x36, 0x7E, 0xB7, 0x79, 0xE5, 0x2F, 0xE5, 0x1A, 0x34, 0x22, 0x63, 0xFA, 0x06, 0xB4, 0x74,
+    0xAD, 0xA3, 0x99, 0xB8, 0x02, 0xE2, 0xD4, 0x84, 0x8E, 0x94, 0x9E, 0x7A, 0xA4, 0x01, 0x71, 0xCC,
+    0xE8, 0x05, 0x3D, 0x52, 0x07, 0x1A, 0x47, 0xEF, 0x89, 0xE8, 0x95, 0x32, 0x50, 0x4F, 0xD8, 0x8E,
+    0xDE, 0xB3, 0xA2, 0x25, 0xC9, 0x10, 0x50, 0x74, 0x00, 0xDA, 0x93, 0xB6, 0x34, 0xED, 0x20, 0xC0,
+    0x74, 0x62, 0xA6, 0x3E, 0x4A, 0x8F, 0x26, 0x04, 0x54, 0x44, 0x1C, 0xAC, 0xF4, 0x0E, 0xAC, 0xEB,
+    0x3B, 0x68, 0x7C, 0xDB, 0x81, 0x19, 0x5B, 0x0F, 0x7A, 0xB2, 0x1E, 0x8A, 0x68, 0x3D, 0xB0, 0xDA,
+    0x01, 0x68, 0xDB, 0x01, 0x68, 0x64, 0x04, 0x8C, 0x8C, 0x40, 0x29, 0x01, 0x28, 0x24, 0x00, 0x88,
+    0x24, 0xE1, 0x4B, 0x2F, 0x8A, 0x80, 0xF9, 0x85, 0x78, 0x28, 0xE7, 0x7E, 0x06, 0xBD, 0x18, 0x71,
+    0x20, 0x85, 0x04, 0x68, 0x3B, 0xBB, 0x82, 0x1D, 0x2A, 0x19, 0x30, 0x41, 0x49, 0xA4, 0x9A, 0xB1,
+    0xD2, 0x01, 0xD4, 0x1D, 0x00, 0x37, 0x4F, 0x54, 0x3E, 0xEB, 0x15, 0xA8, 0x13, 0xCB, 0xF0, 0x6D,
+    0xF2, 0x7A, 0xAB, 0x15, 0x1D, 0xC1, 0x8E, 0xD8, 0x0E, 0xB3, 0x50, 0x4E, 0x68, 0xF1, 0xF4, 0xD0,
+    0x47, 0x4C, 0xA0, 0x96, 0x4E, 0xAD, 0x94, 0x32, 0xD1, 0x0C, 0x88, 0xA0, 0x23, 0xF6, 0xCD, 0x11,
+    0xEB, 0xAB, 0x5F, 0x2E, 0x94, 0x53, 0xB1, 0x58, 0x4F, 0x4F, 0xFB, 0x7C, 0xC4, 0x04, 0x13, 0xFA,
+    0x4E, 0xAD, 0x3A, 0x9A, 0x89, 0x66, 0x10, 0x25, 0xE8, 0xD8, 0x0C, 0x4D, 0xC0, 0xFE, 0x8B, 0x59,
+    0xAF, 0x94, 0xB7, 0x57, 0xDA, 0x01, 0xE9, 0x7D, 0x15, 0x31, 0x12, 0x10, 0xAF, 0x64, 0xA1, 0x9E,
+    0x69, 0xC4, 0x69, 0x71, 0x5A, 0x46, 0x6C, 0xC0, 0x46, 0x2A, 0x49, 0x8A, 0x55, 0x3A, 0xB4, 0x27,
+    0xC0, 0x01, 0x57, 0xA0, 0x10, 0xE9, 0xC0, 0xC8, 0x00, 0x3C, 0x78, 0xED, 0x43, 0xF6, 0xE5, 0x22,
+    0x7C, 0x06, 0xE3, 0x31, 0x9E, 0x23, 0xD4, 0x4C, 0x39, 0x62, 0xC1, 0x52, 0x0D, 0xE8, 0x40, 0x84,
+    0xA6, 0xB3, 0x0E, 0x15, 0xCB, 0x00, 0xB5, 0x5F, 0x80, 0xB5, 0xF1, 0x60, 0x7E, 0x31, 0x01, 0xBD,
+    0x00, 0xA5, 0x0C, 0x80, 0x8D, 0x80, 0x16, 0xB7, 0xB9, 0x3A, 0xBD, 0x90, 0x0D, 0x49, 0x7A, 0x5C,
+    0x2F, 0x50, 0xF4, 0xD2, 0x81, 0x95, 0x01, 0xB4, 0x8C, 0x40, 0x7B, 0x6D, 0xD3, 0x48, 0x75, 0x51,
+    0xCD, 0x70, 0x95, 0xC6, 0x61, 0xBC, 0x0E, 0x10, 0xB1, 0x50, 0x77, 0xD5, 0x48, 0x31, 0xB1, 0x80,
+    0xC5, 0x78, 0x74, 0x50, 0x11, 0xAE, 0xD2, 0x74, 0x54, 0xC3, 0xEE, 0x55, 0xC6, 0x97, 0x23, 0x6A,
+    0xE6, 0x18, 0x1A, 0x67, 0x7C, 0x3E, 0xEF, 0x96, 0xBA, 0xA3, 0x1A, 0x8A, 0x09, 0x22, 0x56, 0x44,
+    0x7C, 0x29, 0x22, 0x33, 0x7D, 0xB2, 0x50, 0xFB, 0x00, 0xA5, 0x27, 0xA9, 0x7E, 0x8E, 0x1C, 0x92,
+    0x1C, 0x9F, 0x39, 0xE5, 0x1C, 0x67, 0xA0, 0x1A, 0x01, 0xDB, 0xED, 0x9C, 0xDE, 0x47, 0xDD, 0xCE,
+    0xAE, 0x50, 0x4A, 0xA4, 0x58, 0x08, 0x5C, 0xA5, 0x74, 0xB5, 0x63, 0x4F, 0x8F, 0x67, 0x5E, 0xF2,
+    0xBD, 0x48, 0x34, 0x22, 0xF2, 0xD5, 0xDB, 0xCF, 0x40, 0x43, 0xF6, 0xDC, 0xB6, 0x83, 0x42, 0x9C,
+    0xEA, 0x6A, 0x91, 0x19, 0x11, 0x71, 0x5A, 0x24, 0x70, 0x56, 0x6E, 0x91, 0x6C, 0x92, 0x0E, 0xDB,
+    0x89, 0x5D, 0xFD, 0xE3, 0x90, 0x5C, 0x74, 0xFF, 0x13, 0x77, 0xF7, 0xB1, 0xC3, 0xCB, 0x13, 0xFA,
+    0x7D, 0x89, 0x18, 0x91, 0x89, 0xF6, 0x96, 0x19, 0xF4, 0x42, 0xDD, 0x99, 0x91, 0x7D, 0x5A, 0xD4,
+    0xA4, 0x67, 0x2A, 0x6F, 0x3C, 0x96, 0x16, 0x66, 0x3D, 0x53, 0x0E, 0x66, 0xC0, 0xBA, 0x1E, 0x15,
+    0x75, 0xA4, 0x0A, 0x26, 0x60, 0xBB, 0xBE, 0xFB, 0xAC, 0x00, 0x12, 0xB3, 0x82, 0x35, 0xD2, 0x41,
+    0x33, 0xED, 0x2E, 0xEE, 0xF3, 0x40, 0xD5, 0x65, 0x85, 0xDF, 0xCF, 0xDF, 0x5D, 0x84, 0xBB, 0x96,
+    0xA0, 0x94, 0xE4, 0xD0, 0xBD, 0xF1, 0xD9, 0x1E, 0xD4, 0x3E, 0x87, 0x0C, 0xD6, 0x65, 0x83, 0xD5,
+    0x6F, 0xBA, 0xB5, 0x02, 0xF5, 0x90, 0xBD, 0x9A, 0xF5, 0xD9, 0x4B, 0xF5, 0x49, 0x15, 0xCF, 0x00,
+    0x7D, 0x44, 0xDD, 0x2E, 0x3D, 0x13, 0xCF, 0x31, 0x61, 0x78, 0x05, 0xD8, 0x23, 0x39, 0x24, 0x23,
+    0x31, 0x19, 0xA2, 0x00, 0xB4, 0xDC, 0x7B, 0xAD, 0x16, 0x99, 0x74, 0xDA, 0xE0, 0x39, 0xAF, 0x21,
+    0x00, 0xED, 0x7B, 0x4E, 0x89, 0x78, 0xB5, 0xFC, 0x47, 0x8E, 0x29, 0x2F, 0x6C, 0xDD, 0x81, 0x5E,
+    0x1D, 0xB4, 0x6B, 0x0E, 0x51, 0x94, 0x00, 0x8D, 0x2F, 0xAF, 0xD5, 0xA1, 0x14, 0x99, 0x2B, 0x91,
+    0xA8, 0x45, 0x22, 0x0F, 0xC9, 0x2D, 0x50, 0x13, 0x66, 0xA4, 0x77, 0x7A, 0xA1, 0x0E, 0x77, 0x2A,
+    0x8F, 0x1E, 0x93, 0xAB, 0x2B, 0x46, 0x8C, 0x4B, 0x6E, 0xCD, 0x74, 0xEC, 0x53, 0x04, 0x8C, 0xC7,
+    0x52, 0xCC, 0x98, 0x01, 0xEB, 0x54, 0x84, 0x22, 0xE8, 0x50, 0xFB, 0xDA, 0x0B, 0x52, 0xC6, 0x32,
+    0xDA, 0x60, 0xC7, 0xBB, 0x45, 0xE8, 0x95, 0xE4, 0x97, 0xEA, 0x93, 0x3F, 0x4D, 0x12, 0x50, 0x3D,
+    0x82, 0x71, 0xE9, 0xCF, 0x00, 0xC6, 0xC3, 0x4D, 0xD0, 0x53, 0x8A, 0x42, 0xDA, 0x2C, 0xAD, 0x71,
+    0x5B, 0xDA, 0xB6, 0x03, 0xBD, 0x92, 0xA2, 0x8C, 0x0F, 0xBB, 0xED, 0x03, 0x6A, 0x22, 0x7D, 0x12,
+    0x07, 0xDB, 0xA3, 0xEA, 0xC3, 0x1F, 0xF1, 0x31, 0x8F, 0x76, 0x9F, 0xA2, 0x56, 0x38, 0xDB, 0x07,
+    0xB0, 0xE2, 0xB2, 0x7E, 0x27, 0x73, 0x2A, 0x02, 0xFC, 0xB3, 0xEB, 0x23, 0x54, 0x3C, 0x02, 0x8C,
+    0x85, 0x87, 0xFB, 0xD8, 0x83, 0xC2, 0xEB, 0x3F, 0x87, 0x27, 0x68, 0x57, 0xB4, 0xAB, 0x78, 0x96,
+    0x97, 0x09, 0xDA, 0x7F, 0x9A, 0x4F, 0xB3, 0xC7, 0x50, 0x0C, 0xBA, 0x3B, 0xC7, 0x1E, 0x93, 0xEE,
+    0xF4, 0xDB, 0x52, 0x4C, 0xB4, 0xE2, 0x0F, 0xA8, 0x76, 0x1F, 0xFC, 0x2C, 0x9F, 0x83, 0x73, 0x54,
+    0x60, 0xD0, 0x1D, 0xBA, 0x53, 0x03, 0x6A, 0xE0, 0x65, 0x78, 0x99, 0x3D, 0xB0, 0x22, 0xAB, 0xAB,
+    0xAF, 0xBF, 0xF4, 0xC2, 0x2B, 0x15, 0x85, 0xAF, 0xB4, 0x27, 0x14, 0x7E, 0xE4, 0x39, 0xC2, 0xB3,
+    0x9C, 0xE7, 0x95, 0x73, 0x98, 0xEF, 0x44, 0x83, 0x96, 0x45, 0x77, 0x4A, 0xE6, 0xED, 0x64, 0xFF,
+    0x5A, 0xD5, 0xAE, 0xFC, 0x70, 0xB5, 0xE3, 0x0E, 0xB5, 0x53, 0xCB, 0xCE, 0xA7, 0xBE, 0x92, 0x73,
+    0x19, 0x3D, 0xA4, 0x60, 0x83, 0x07, 0xEF, 0xDE, 0x36, 0xCB, 0x42, 0x39, 0x58, 0xC7, 0x91, 0x19,
+    0x30, 0xCF, 0x4F, 0x14, 0xD3, 0x02, 0xD6, 0x3A, 0xCA, 0x77, 0x06, 0xE8, 0x27, 0x30, 0x0B, 0x14,
+    0xE2, 0xC1, 0x0A, 0x94, 0x32, 0xC3, 0x71, 0x3B, 0x60, 0x5E, 0x13, 0xA7, 0x66, 0x13, 0xB1, 0xAE,
+    0x0F, 0x65, 0xD0, 0xC9, 0xED, 0x41, 0x4A, 0x7A, 0x6E, 0xEE, 0x22, 0x88, 0x0F, 0x58, 0xB8, 0xCF,
+    0x00, 0x45, 0xC0, 0x04, 0xD3, 0xD1, 0x77, 0xFB, 0x54, 0x8B, 0x0A, 0x1C, 0x87, 0xCA, 0x97, 0x3F,
+    0xF4, 0x07, 0x5C, 0xB9, 0xC0, 0x54, 0x8E, 0x53, 0xE9, 0x0F, 0x4A, 0xDF, 0xE8, 0xD0, 0x30, 0x5B,
+    0x66, 0xFD, 0x56, 0x28, 0xC7, 0xFA, 0x32, 0x8D, 0xBB, 0x39, 0x11, 0xB5, 0xB8, 0x32, 0xD4, 0x13,
+    0x4D, 0xD7, 0x77, 0x2C, 0x40, 0xE5, 0x18, 0xE1, 0x06, 0xE7, 0xA1, 0x1A, 0x1E, 0xF2, 0x39, 0xC8,
+    0x2C, 0x64, 0x06, 0xCE, 0x7E, 0x93, 0x5F, 0x7F, 0x33, 0x1D, 0xC6, 0x13, 0x51, 0x13, 0xD5, 0x80,
+    0x85, 0x9B, 0x54, 0x03, 0x65, 0x20, 0x82, 0xC5, 0x3A, 0xF4, 0x5C, 0x06, 0x68, 0xFC, 0x02, 0x2A,
+    0x36, 0x1E, 0xCC, 0x5B, 0x13, 0x20, 0x3D, 0x50, 0xC9, 0x00, 0xB4, 0x27, 0xDE, 0xCA, 0xDE, 0xE5,
+    0xAD, 0xCC, 0x04, 0x94, 0xC9, 0xB1, 0x6D, 0x27, 0xA7, 0x65, 0x06, 0xDA, 0x05, 0xA8, 0x6E, 0xE5,
+    0x80, 0xE7, 0x51, 0x02, 0xE7, 0x8B, 0xC0, 0x9E, 0x1E, 0x38, 0xD4, 0x9E, 0x57, 0x4A, 0xCF, 0x54,
+    0x75, 0x04, 0xE3, 0x54, 0x30, 0x14, 0x63, 0x8D, 0x1E, 0x2E, 0xA0, 0xFD, 0x3E, 0xA5, 0xDF, 0xA3,
+    0x72, 0xAD, 0x08, 0xBD, 0x08, 0x3C, 0x01, 0x3C, 0x0B, 0xBC, 0x9C, 0xAD, 0x17, 0xC0, 0xEF, 0x24,
+    0x6D, 0xB2, 0x22, 0xC1, 0xA6, 0xB8, 0x6F, 0x64, 0x4A, 0xD6, 0xB6, 0x08, 0x49, 0xEC, 0xF4, 0x04,
+    0xA5, 0x88, 0xAB, 0xE4, 0x3B, 0xC1, 0x04, 0x26, 0xE3, 0x79, 0xAE, 0xF6, 0x3C, 0xD7, 0x74, 0xDC,
+    0xB0, 0x5D, 0x11, 0xEC, 0x7B, 0x7D, 0xB0, 0x22, 0x83, 0x15, 0xF1, 0xB5, 0x88, 0xAB, 0xB6, 0x34,
+    0xEF, 0xB1, 0x24, 0x4D, 0xE5, 0x90, 0x7C, 0xCF, 0x0C, 0x22, 0x52, 0x8A, 0xC4, 0x33, 0xCB, 0x25,
+    0xA7, 0x43, 0x32, 0xC2, 0xBD, 0x4C, 0x5A, 0xDE, 0x9E, 0x4D, 0x20, 0xB4, 0xA8, 0xD7, 0x23, 0xD5,
+    0x17, 0x47, 0xF6, 0xAD, 0x2B, 0x83, 0xFC, 0x4C, 0x9E, 0x17, 0x59, 0x8C, 0x48, 0x68, 0x44, 0x38,
+    0x73, 0xE9, 0x22, 0x14, 0xB2, 0x4B, 0x2B, 0x65, 0x49, 0x77, 0x11, 0x2D, 0x60, 0x27, 0x94, 0x74,
+    0x88, 0x87, 0xDE, 0xEB, 0x15, 0xB0, 0xA3, 0x99, 0x00, 0x13, 0xAC, 0x07, 0xCA, 0x5F, 0xAE, 0x9C,
+    0x4A, 0x0B, 0x65, 0x05, 0x8A, 0xB5, 0xAF, 0x3D, 0x54, 0xE3, 0x55, 0x3D, 0x42, 0xD3, 0x1D, 0x17,
+    0x01, 0xAE, 0x12, 0x53, 0xD8, 0x1D, 0x55, 0xA0, 0x98, 0x8A, 0x49, 0x05, 0x74, 0xD0, 0x41, 0x4D,
+    0x98, 0x41, 0x07, 0x35, 0xD1, 0xF8, 0x72, 0x2C, 0x26, 0xAC, 0x33, 0xA1, 0x98, 0xA1, 0x16, 0x11,
+    0xAC, 0xC8, 0x4A, 0xE3, 0xF5, 0x8C, 0x19, 0xCC, 0x88, 0x0E, 0xD6, 0xA1, 0xA6, 0x08, 0xF4, 0x23,
+    0x94, 0x72, 0x0B, 0x2E, 0xEC, 0xEF, 0xC3, 0x8D, 0x3D, 0x83, 0x1A, 0xF7, 0x0C, 0xDA, 0x3F, 0x67,
+    0xA8, 0xBA, 0x1B, 0x06, 0x43, 0x30, 0x1C, 0xA8, 0x60, 0xB6, 0x78, 0xAF, 0x1D, 0x31, 0x1D, 0x22,
+    0x94, 0x23, 0xFD, 0xD3, 0xA3, 0x0E, 0xB4, 0x1C, 0x17, 0x33, 0xD6, 0x99, 0x9F, 0x45, 0xEA, 0xEF,
+    0xF6, 0xB2, 0x70, 0xF6, 0x7F, 0x15, 0xB9, 0x0D, 0x46, 0x64, 0x01, 0xB3, 0xBE, 0xD0, 0x7B, 0xCC,
+    0x9C, 0xB3, 0x54, 0x7A, 0xCA, 0x19, 0x6A, 0xAF, 0x23, 0x94, 0x81, 0x15, 0x8A, 0x48, 0x0F, 0x08,
+    0xD6, 0x83, 0xED, 0xCC, 0x08, 0xF5, 0x50, 0x4E, 0x60, 0x82, 0x5A, 0xA0, 0x9C, 0x69, 0x3B, 0xCA,
+    0x48, 0x3D, 0x53, 0xE7, 0xD5, 0x85, 0xF4, 0xBB, 0x16, 0x91, 0xB4, 0xEE, 0x40, 0x2D, 0x0B, 0xC0,
+    0x83, 0x17, 0x01, 0xD4, 0x45, 0x7E, 0x8B, 0x7A, 0xE1, 0x90, 0xAB, 0x86, 0x89, 0x58, 0xBE, 0x1A,
+    0xD4, 0x5F, 0xF5, 0xE2, 0x8B, 0x7F, 0x2E, 0x02, 0xED, 0xDB, 0x02, 0x0B, 0x75, 0xA7, 0x03, 0xC6,
+    0x97, 0x03, 0xC6, 0x1B, 0x8F, 0xF1, 0xB5, 0xC3, 0xF8, 0x06, 0x1A, 0x67, 0xB3, 0xD6, 0xAC, 0xD8,
+    0x9F, 0xFC, 0x7E, 0xA4, 0x11, 0x09, 0x18, 0x91, 0x81, 0x52, 0x56, 0xA0, 0xBF, 0xF5, 0x91, 0x8A,
+    0xD8, 0x27, 0x53, 0x5C, 0xA4, 0xB3, 0xC9, 0xAF, 0x87, 0x52, 0xA4, 0xF8, 0x66, 0x82, 0x37, 0x52,
+    0x22, 0xBC, 0x3E, 0x99, 0x52, 0xDF, 0x98, 0xBC, 0x93, 0x9E, 0x93, 0xAB, 0xD7, 0x31, 0x19, 0x9C,
+    0x62, 0x05, 0xEC, 0x90, 0x7C, 0x70, 0x35, 0xA5, 0xF4, 0xB8, 0x58, 0x72, 0x28, 0xD0, 0x77, 0x39,
+    0x8A, 0x1C, 0xB1, 0x63, 0x82, 0x38, 0x9A, 0x00, 0x28, 0xA1, 0x9E, 0x92, 0xD6, 0x9A, 0x19, 0xA0,
+    0x0E, 0x55, 0x04, 0x28, 0x63, 0xB9, 0x26, 0xBC, 0xE4, 0xA9, 0x0C, 0x52, 0xBC, 0x9E, 0xB2, 0x7B,
+    0x93, 0x20, 0x09, 0xB4, 0x88, 0x4F, 0x18, 0x46, 0xF6, 0x25, 0x36, 0xE5, 0x12, 0x98, 0x24, 0x95,
+    0x68, 0xC9, 0x99, 0x8C, 0xDC, 0x95, 0xD1, 0x54, 0x3F, 0x70, 0x20, 0x35, 0x98, 0x3F, 0xBF, 0x02,
+    0x57, 0xD4, 0x84, 0x1E, 0xCB, 0x11, 0x8B, 0xE9, 0xD4, 0xC4, 0x41, 0x32, 0x4B, 0x0B, 0x3A, 0x94,
+    0x23, 0xC6, 0x5B, 0xB0, 0x7A, 0x86, 0xA5, 0xF6, 0xE8, 0x69, 0xC9, 0xF9, 0x8B, 0x95, 0x0C, 0xFF,
+    0x14, 0xE2, 0xA1, 0x4A, 0x4B, 0xF7, 0x0C, 0x7A, 0xA4, 0x3E, 0x73, 0xE9, 0xA8, 0x97, 0x90, 0x03,
+    0x8A, 0x90, 0x43, 0xD2, 0x13, 0xBF, 0x44, 0xE5, 0x79, 0xE0, 0xD2, 0xA5, 0x19, 0xB3, 0xC9, 0x45,
+    0x48, 0x89, 0x4B, 0x82, 0x64, 0xAC, 0xDB, 0xA5, 0x84, 0xFD, 0x09, 0x68, 0xB3, 0xB0, 0xA1, 0x56,
+    0x29, 0xC9, 0xB7, 0x7E, 0x97, 0xE1, 0xF4, 0x6E, 0x97, 0xE5, 0x08, 0x1B, 0x5C, 0x90, 0x70, 0x2B,
+    0x3B, 0xEC, 0x40, 0x83, 0xDE, 0x6F, 0xE7, 0xF0, 0xE2, 0xE6, 0xF6, 0x6D, 0xB2, 0x80, 0xAD, 0x88,
+    0x2F, 0x44, 0x24, 0xC5, 0x10, 0x76, 0x0B, 0x40, 0x52, 0xB8, 0xEC, 0xB6, 0x47, 0x61, 0xFB, 0xD2,
+    0x75, 0x43, 0x1B, 0x9A, 0x21, 0x7F, 0xA3, 0x8E, 0x69, 0x5F, 0x7F, 0x3D, 0x16, 0xA7, 0x77, 0x58,
+    0x5C, 0x29, 0x22, 0xA1, 0x90, 0x1C, 0x31, 0x2F, 0xFF, 0x5F, 0xB0, 0xB8, 0xC7, 0xAE, 0x7F, 0x53,
+    0x89, 0x0C, 0x55, 0x97, 0xC2, 0xA1, 0x00, 0x8D, 0x08, 0x22, 0xF3, 0x69, 0x6B, 0x19, 0x53, 0xEC,
+    0x55, 0x9F, 0xC4, 0x5E, 0x40, 0x2F, 0x92, 0x76, 0x61, 0xA0, 0x15, 0x91, 0xFC, 0x74, 0xDA, 0xAF,
+    0x2B, 0x00, 0xC5, 0xC4, 0x16, 0x5B, 0xA5, 0xD5, 0x52, 0x33, 0xDB, 0xB5, 0x60, 0x5F, 0x5A, 0x13,
+    0x9A, 0x07, 0xD5, 0x4A, 0x0F, 0xD6, 0xB3, 0xC0, 0x82, 0x9A, 0xA8, 0x46, 0xF4, 0x80, 0x75, 0xD4,
+    0x8E, 0x08, 0x47, 0x94, 0x23, 0x7A, 0xA4, 0x71, 0xB4, 0xB0, 0xD0, 0xCE, 0xE8, 0x50, 0x88, 0xA7,
+    0xF1, 0xD5, 0x2D, 0xA0, 0x11, 0x1A, 0xF1, 0x06, 0xB4, 0x47, 0x8D, 0x70, 0x03, 0xF6, 0x3E, 0x83,
+    0x91, 0xA1, 0x1A, 0xF7, 0xF4, 0x50, 0xBA, 0xA0, 0x86, 0xE7, 0x78, 0xF9, 0x3C, 0x7B, 0x46, 0x45,
+    0xED, 0x5F, 0x01, 0x84, 0x5A, 0xA8, 0x03, 0x7A, 0xA1, 0x9F, 0x95, 0x40, 0x19, 0x0B, 0x19, 0x4C,
+    0x00, 0x33, 0x55, 0x49, 0x5F, 0xEB, 0xD1, 0xCE, 0x66, 0x02, 0xAC, 0x97, 0xA1, 0x77, 0x40, 0xFF,
+    0xBC, 0x54, 0x33, 0x80, 0x98, 0xB9, 0xED, 0x00, 0xBD, 0xD8, 0x1F, 0x26, 0x65, 0x5B, 0xA4, 0xF5,
+    0x00, 0xE6, 0xFD, 0xAC, 0x2C, 0xB5, 0xC8, 0x90, 0xB5, 0x6A, 0xC9, 0x5A, 0xB4, 0x53, 0xAF, 0x7C,
+    0x44, 0xB2, 0x02, 0x9A, 0xFC, 0x87, 0x12, 0x49, 0xAA, 0x59, 0x8B, 0xBC, 0x23, 0x40, 0x21, 0xBF,
+    0x90, 0x97, 0x04, 0x68, 0xA4, 0x5E, 0xEC, 0x0A, 0x85, 0x04, 0x99, 0xFA, 0x05, 0xAC, 0x68, 0x19,
+    0x24, 0xA2, 0x65, 0x6A, 0xA4, 0x90, 0xF9, 0x86, 0x15, 0x27, 0x51, 0xCB, 0xBB, 0x9B, 0x94, 0x9A,
+    0x4D, 0x5A, 0x9F, 0xCB, 0xF7, 0xC5, 0x70, 0xF7, 0x11, 0x1D, 0xEA, 0x60, 0x3A, 0x8E, 0xCB, 0xD9,
+    0x78, 0xCC, 0xAB, 0x8B, 0xF1, 0x14, 0xA1, 0x37, 0x1E, 0x0E, 0x9A, 0x3F, 0xF3, 0x60, 0xBE, 0xFF,
+    0xA3, 0x01, 0xD4, 0xFB, 0xEF, 0x0E, 0x80, 0xCD, 0x98, 0xC3, 0xB8, 0xF3, 0x5A, 0x85, 0x48, 0x32,
+    0x22, 0x01, 0xB4, 0xAC, 0x2B, 0x94, 0x8B, 0xD8, 0x81, 0x72, 0x69, 0xBF, 0x17, 0x29, 0x97, 0xE6,
+    0xAF, 0xE4, 0xBF, 0xAA, 0x16, 0x33, 0xDB, 0x77, 0x93, 0x27, 0x49, 0x67, 0xF6, 0xF2, 0x2E, 0x9A,
+    0x02, 0x38, 0xDB, 0xDF, 0x82, 0x56, 0x16, 0x8A, 0xF5, 0x3B, 0x31, 0xA1, 0x23, 0x50, 0x8E, 0x40,
+    0xE3, 0x72, 0xE2, 0x64, 0x46, 0xCE, 0x7C, 0x69, 0x85, 0x56, 0xAE, 0x6D, 0x16, 0xF6, 0xE6, 0x96,
+    0xAD, 0xAA, 0x69, 0x43, 0xB8, 0x2D, 0xA0, 0xA3, 0x1A, 0xE9, 0x87, 0x2A, 0x3B, 0xC0, 0x80, 0xC8,
+    0x0A, 0x97, 0x57, 0x97, 0x23, 0x49, 0xB3, 0x33, 0x20, 0xE9, 0x76, 0x3F, 0x4A, 0x26, 0x7E, 0x2B,
+    0x45, 0xE1, 0x30, 0xC0, 0x39, 0xA8, 0x1C, 0xD2, 0xF1, 0x60, 0x4C, 0x31, 0x87, 0x49, 0x77, 0xC7,
+    0x88, 0xF8, 0x5A, 0x82, 0x92, 0x5B, 0x9C, 0x01, 0x6E, 0x03, 0x8F, 0x83, 0x76, 0xF0, 0x32, 0xE5,
+    0x02, 0x7F, 0x94, 0x76, 0xDA, 0x99, 0x00, 0x2D, 0x76, 0x80, 0x15, 0x71, 0xB0, 0x14, 0x2B, 0x14,
+    0xB1, 0x9A, 0x41, 0xCF, 0x75, 0x00, 0x3D, 0xB5, 0x1E, 0xAA, 0x20, 0x80, 0x79, 0x6B, 0x01, 0xEA,
+    0x37, 0xA7, 0x1D, 0xB0, 0x93, 0x50, 0x98, 0x56, 0x48, 0x49, 0xDF, 0x86, 0xEB, 0x28, 0x11, 0xB7,
+    0x99, 0x6B, 0x1D, 0x25, 0x6C, 0xB0, 0x8E, 0x99, 0x6C, 0x04, 0x13, 0x1A, 0x81, 0x66, 0xAC, 0xA5,
+    0xC3, 0x0E, 0x46, 0x06, 0xAC, 0x2F, 0x25, 0xD0, 0x77, 0x5A, 0xE6, 0x47, 0x01, 0x38, 0x0F, 0x39,
+    0x65, 0xDC, 0xE4, 0xE1, 0x1F, 0xA4, 0x44, 0x29, 0x98, 0x8E, 0x57, 0x8C, 0x67, 0xDF, 0x78, 0x6A,
+    0xE3, 0x31, 0x7F, 0xE6, 0xD1, 0x3F, 0x1A, 0x50, 0xEF, 0x0F, 0x20, 0x23, 0xD8, 0x31, 0x65, 0xBF,
+    0x46, 0x40, 0xBF, 0x13, 0x28, 0x7E, 0xBE, 0x42, 0xB4, 0x03, 0x57, 0xAB, 0x48, 0x83, 0x74, 0xC6,
+    0xDB, 0xE9, 0xCB, 0xA4, 0x60, 0xEE, 0xBE, 0xBC, 0xB0, 0x13, 0xB4, 0x8E, 0x43, 0xB0, 0x0E, 0x0B,
+    0xB6, 0xC3, 0x74, 0xD8, 0x8E, 0xEA, 0x47, 0x43, 0xE3, 0xD1, 0xBF, 0x98, 0x6A, 0x0F, 0x73, 0xAC,
+    0x3D, 0x1C, 0xB7, 0x66, 0x00, 0xDB, 0x7C, 0x7F, 0x80, 0xFA, 0xFB, 0xEF, 0x8C, 0x50, 0xBD, 0x25,
+    0xE3, 0x26, 0x56, 0x4A, 0x24, 0x02, 0x6B, 0x23, 0x1E, 0xEC, 0x17, 0x65, 0x86, 0xE6, 0xB5, 0xDB,
+    0xE2, 0x30, 0x3F, 0x5E, 0x6C, 0x40, 0x4F, 0x7D, 0x25, 0x14, 0xD1, 0x7A, 0x09, 0xAC, 0xD0, 0xAC,
+    0xB4, 0x0E, 0x2D, 0x03, 0x3C, 0x82, 0xBA, 0xA8, 0x3D, 0x47, 0x3C, 0x47, 0x4D, 0xF5, 0x47, 0xE5,
+    0xC0, 0x2F, 0x7E, 0x30, 0xF1, 0xE8, 0xFE, 0x3E, 0xFA, 0x87, 0x6F, 0x3A, 0x0E, 0x64, 0x48, 0x48,
+    0xEE, 0x24, 0x9E, 0xBA, 0xEE, 0x29, 0x7E, 0xFE, 0x8B, 0x99, 0x03, 0x5B, 0x8F, 0xE5, 0x6B, 0x41,
+    0x5C, 0xA4, 0x5C, 0xB6, 0xFD, 0x54, 0x11, 0x71, 0x4A, 0xE4, 0x0B, 0x13, 0xF7, 0xCA, 0xBF, 0xEA,
+    0x3B, 0x8A, 0x58, 0xCE, 0x1B, 0x50, 0x67, 0x9F, 0x8A, 0x1B, 0x4E, 0x97, 0x76, 0xB3, 0x6D, 0x07,
+    0x28, 0x64, 0xDD, 0xA1, 0x74, 0xAD, 0xEC, 0x40, 0x3A, 0x23, 0x61, 0xC3, 0xE8, 0x0A, 0x11, 0xBF,
+    0x41, 0x74, 0xED, 0x9F, 0x49, 0x97, 0x11, 0xBA, 0xB4, 0x95, 0x6D, 0x67, 0x57, 0xF4, 0x42, 0xBF,
+    0x64, 0x7C, 0xAE, 0xEF, 0xB4, 0xCC, 0x49, 0xDA, 0x8B, 0xC0, 0x99, 0xDF, 0xBF, 0xED, 0x2A, 0x11,
+    0x6F, 0x44, 0x3A, 0x8C, 0x4F, 0x59, 0x7C, 0xE3, 0xC0, 0x16, 0x33, 0x57, 0xCD, 0xC8, 0xB1, 0xED,
+    0x88, 0x2B, 0x4A, 0x26, 0x0A, 0x19, 0xD0, 0xD2, 0x51, 0xCA, 0x40, 0xF5, 0x4E, 0xC0, 0xFC, 0x28,
+    0x62, 0x5E, 0x5B, 0x69, 0x5E, 0x15, 0x67, 0x3B, 0xF1, 0xD6, 0xF5, 0xA1, 0xC7, 0xC6, 0x46, 0x64,
+    0x42, 0x8C, 0x48, 0x44, 0x9E, 0x16, 0xF9, 0x5B, 0x87, 0x4B, 0xD2, 0xC8, 0x64, 0xBE, 0x2F, 0xB1,
+    0xF2, 0x1C, 0x54, 0x03, 0xE6, 0x0B, 0x03, 0xE5, 0xBF, 0x18, 0xD0, 0x7F, 0x39, 0xC2, 0xFB, 0x23,
+    0xB4, 0x21, 0x25, 0x30, 0x26, 0x42, 0x25, 0x0E, 0x2D, 0x01, 0x6E, 0x0B, 0x1C, 0xD9, 0x11, 0x5B,
+    0x2E, 0xD4, 0x9D, 0xF8, 0xCA, 0xD7, 0x33, 0xA8, 0x6F, 0xC2, 0xD9, 0x17, 0xA9, 0x46, 0x68, 0x3C,
+    0xD6, 0xC1, 0x8A, 0x5A, 0xA0, 0x4C, 0x65, 0xA7, 0xC6, 0x63, 0x7D, 0x2E, 0xA1, 0xA0, 0x53, 0x00,
+    0xDB, 0x0C, 0xDB, 0x73, 0x42, 0xAE, 0xBE, 0x50, 0x8F, 0x34, 0x03, 0xF4, 0x1D, 0x02, 0x7A, 0xA1,
+    0x5C, 0x2F, 0x5D, 0xBA, 0x1C, 0x68, 0x64, 0xF3, 0xDD, 0x5B, 0x5A, 0x30, 0x9D, 0x7E, 0x4E, 0xD0,
+    0x2B, 0x98, 0x99, 0x7A, 0x82, 0x76, 0xA0, 0xF7, 0x68, 0x41, 0x0B, 0x98, 0x48, 0x3D, 0x43, 0x1B,
+    0xFE, 0xB0, 0x1F, 0x28, 0xE4, 0xF9, 0xF1, 0xB4, 0xAD, 0x4E, 0x46, 0xAB, 0x18, 0xA9, 0x61, 0xE2,
+    0x08, 0xED, 0xF5, 0x98, 0x0A, 0x00, 0x91, 0x43, 0xF4, 0xA8, 0x03, 0xB5, 0x33, 0x1D, 0x47, 0x5C,
+    0x41, 0x87, 0x62, 0xA2, 0xEE, 0x8C, 0xC8, 0x42, 0x9B, 0x63, 0x04, 0x6F, 0x44, 0x04, 0x8B, 0x9E,
+    0x55, 0xC4, 0x0C, 0xD5, 0x48, 0x8B, 0x75, 0x45, 0x7C, 0x16, 0x28, 0xFC, 0xF6, 0x3D, 0xF7, 0x9F,
+    0x98, 0xC6, 0x22, 0x42, 0x25, 0x22, 0xE8, 0x19, 0x8C, 0xC8, 0x9A, 0x20, 0x16, 0x91, 0x85, 0x32,
+    0x27, 0x4A, 0xDB, 0x6A, 0xA5, 0x00, 0x63, 0x57, 0x67, 0xD9, 0x95, 0x6B, 0x76, 0x01, 0xC8, 0xAE,
+    0x4C, 0x23, 0xB9, 0x9C, 0xA3, 0xB6, 0x30, 0x64, 0x57, 0xC6, 0x49, 0x55, 0x1B, 0x79, 0xE1, 0xD2,
+    0xEF, 0x47, 0x72, 0x52, 0x15, 0x73, 0x11, 0x45, 0xE6, 0xED, 0x8F, 0x29, 0x85, 0xD2, 0x92, 0x75,
+    0x69, 0xFB, 0x63, 0x4E, 0x46, 0x6A, 0x5B, 0xD1, 0x14, 0xD5, 0xF4, 0x3E, 0x67, 0xB4, 0xE2, 0x53,
+    0x06, 0xA3, 0xC4, 0x03, 0xFD, 0x40, 0x91, 0x04, 0x6A, 0x9F, 0x42, 0xA4, 0x33, 0x0E, 0x91, 0xA1,
+    0xF4, 0xEC, 0x83, 0x0E, 0xD4, 0xC0, 0x4C, 0xE5, 0x53, 0xE9, 0x02, 0x1A, 0xD4, 0x04, 0xC6, 0x73,
+    0x4C, 0xC6, 0x83, 0x8B, 0xE4, 0xA9, 0x53, 0xFD, 0xD0, 0x8A, 0x4C, 0x50, 0x8B, 0x44, 0xA8, 0x06,
+    0x5A, 0xD0, 0x13, 0x4D, 0x87, 0x8A, 0x98, 0x01, 0xFA, 0x1C, 0x84, 0xEE, 0x30, 0x8B, 0xEC, 0xE5,
+    0x45, 0xB6, 0xFA, 0xA0, 0x4C, 0xC9, 0xD1, 0x35, 0x3E, 0x05, 0xA8, 0x92, 0x22, 0x3C, 0x3D, 0xA7,
+    0x50, 0xB5, 0x1E, 0x92, 0xAF, 0x93, 0xE4, 0x18, 0x75, 0x4C, 0xA1, 0x54, 0x9D, 0x90, 0x3E, 0xFA,
+    0x77, 0xC4, 0x15, 0x73, 0xAA, 0x34, 0x99, 0x01, 0xB3, 0xBA, 0x16, 0x0B, 0xED, 0xC0, 0x55, 0x15,
+    0x29, 0x56, 0x88, 0xD5, 0x88, 0x09, 0xE8, 0xD1, 0xBA, 0x64, 0x84, 0x17, 0xD4, 0x02, 0x57, 0xCA,
+    0x40, 0x15, 0xD0, 0x21, 0xC9, 0x7A, 0xD3, 0xAD, 0xB0, 0xD2, 0x44, 0x3D, 0x51, 0x4E, 0x4A, 0x7C,
+    0xED, 0x69, 0x7C, 0x79, 0xEB, 0x14, 0x6E, 0x25, 0x63, 0x5A, 0x71, 0x07, 0x57, 0x21, 0x42, 0x31,
+    0x6D, 0xF0, 0x5B, 0xD3, 0x81, 0x85, 0x05, 0xD4, 0x8C, 0x0E, 0x50, 0x0D, 0xD4, 0x9E, 0x04, 0x47,
+    0x40, 0x4C, 0xE9, 0xFA, 0x88, 0xF1, 0xE4, 0xEA, 0x24, 0x11, 0xBD, 0xCA, 0x54, 0x06, 0x8C, 0xC8,
+    0xD4, 0x74, 0xB4, 0xB7, 0xAA, 0xF0, 0x4F, 0x28, 0x16, 0xAA, 0x01, 0x4C, 0xAA, 0x90, 0xB5, 0x70,
+    0x90, 0x02, 0xFA, 0xB4, 0x03, 0x65, 0xFA, 0x48, 0x0B, 0x6A, 0xA6, 0x98, 0xA1, 0x1A, 0x55, 0xEF,
+    0xC1, 0xBA, 0x7A, 0x01, 0x15, 0xE9, 0x3B, 0x50, 0x17, 0xB9, 0xA3, 0x7C, 0xD9, 0xA7, 0x64, 0x25,
+    0x65, 0x3F, 0xC9, 0xAB, 0x2A, 0xF9, 0x49, 0x0A, 0xD7, 0xC8, 0xA9, 0x41, 0x21, 0x23, 0xD6, 0xD3,
+    0x48, 0xA4, 0x85, 0x55, 0xA5, 0xBC, 0x85, 0x7D, 0x15, 0x31, 0x9E, 0x7D, 0x3D, 0xD1, 0xC0, 0x61,
+    0x19, 0x38, 0x80, 0xB9, 0x1A, 0x39, 0xA2, 0x98, 0x8C, 0x27, 0x52, 0x8D, 0xC6, 0x33, 0xD3, 0xF8,
+    0xDA, 0xAB, 0x19, 0x71, 0xB5, 0x57, 0x73, 0xB9, 0xD0, 0x78, 0x15, 0xED, 0xFC, 0x1B, 0xF5, 0xA8,
+    0x44, 0x7E, 0x70, 0x5C, 0x2F, 0x4A, 0x44, 0x56, 0x23, 0x22, 0x22, 0x6B, 0x29, 0x22, 0x22, 0xA3,
+    0x12, 0x11, 0xB9, 0x0D, 0x0F, 0x9D, 0x2E, 0x20, 0xAA, 0x1B, 0x40, 0x21, 0x0E, 0x90, 0x0D, 0x14,
+    0xA7, 0x1A, 0xB8, 0x3C, 0xAA, 0x19, 0x2B, 0xDE, 0x52, 0xBB, 0xBD, 0xD2, 0x6B, 0x5F, 0xF8, 0x99,
+    0x89, 0x3D, 0xE3, 0x6A, 0xAA, 0xAF, 0x85, 0x62, 0x28, 0xC2, 0x01, 0xFB, 0x1C, 0xEB, 0x51, 0x7B,
+    0xDB, 0x1D, 0xB0, 0x5F, 0x8F, 0x4F, 0x05, 0x2D, 0xF3, 0xA1, 0xFD, 0x73, 0x2B, 0xF2, 0xBA, 0x48,
+    0x42, 0x71, 0xE5, 0x16, 0x0F, 0xAD, 0x77, 0x2C, 0xCE, 0x43, 0x72, 0x0D, 0x94, 0xC8, 0x9C, 0xD1,
+    0x6A, 0x2A, 0x79, 0xE1, 0xEF, 0x83, 0x59, 0x21, 0xD9, 0xD1, 0xED, 0x77, 0x8A, 0x78, 0xCB, 0xC8,
+    0x2E, 0xC1, 0x48, 0x0A, 0x9C, 0x31, 0xB2, 0xB6, 0x63, 0xCB, 0x65, 0x32, 0xCA, 0x9A, 0x40, 0xA4,
+    0xA4, 0x71, 0xB4, 0x33, 0xDC, 0x4F, 0x2D, 0xB7, 0xCE, 0x1C, 0x91, 0x6A, 0xF0, 0x88, 0x88, 0x38,
+    0x9A, 0x5C, 0x98, 0x13, 0x09, 0xD0, 0x8A, 0x44, 0x50, 0x7D, 0x82, 0x6A, 0xFE, 0xDD, 0x64, 0xF3,
+    0x1F, 0x07, 0xE0, 0x3F, 0x3F, 0xD9, 0x2F, 0xB5, 0x43, 0xC5, 0xCE, 0x4A, 0xA7, 0x44, 0x68, 0x6E,
+    0xFF, 0x61, 0xB1, 0xA6, 0x74, 0xE2, 0x66, 0x4A, 0x4A, 0xEA, 0x0E, 0x8E, 0x33, 0x20, 0x3C, 0x66,
+    0xB3, 0xF3, 0x17, 0x2F, 0x2A, 0x91, 0xA1, 0x10, 0xF1, 0xF4, 0x6B, 0x2A, 0xDE, 0xDD, 0x0B, 0x8F,
+    0x05, 0x58, 0x37, 0x43, 0xD2, 0x8B, 0x88, 0xBC, 0x96, 0xEA, 0x8B, 0x2F, 0x54, 0xE1, 0xCC, 0xC5,
+    0xBC, 0x01, 0xA7, 0xEB, 0x8B, 0xF6, 0x54, 0x7D, 0x71, 0x3A, 0x29, 0x38, 0x0A, 0x5B, 0x7A, 0x95,
+    0x17, 0x41, 0x4E, 0x16, 0x2A, 0xE5, 0x74, 0xE2, 0x76, 0x4F, 0x24, 0xD8, 0x3C, 0x95, 0xFF, 0x57,
+    0xB2, 0xD5, 0x4A, 0x78, 0x25, 0x3A, 0x2D, 0x58, 0xBD, 0x01, 0xE0, 0x39, 0x6A, 0xB5, 0x22, 0xD1,
+    0x8A, 0xC4, 0x07, 0xBE, 0xE0, 0xEF, 0xDF, 0x6A, 0xB2, 0xD4, 0xA4, 0xAC, 0xEC, 0x20, 0x27, 0x5A,
+    0x47, 0x29, 0x58, 0x56, 0x73, 0x4A, 0xB9, 0x74, 0x86, 0xCA, 0xAA, 0x90, 0xF7, 0xE4, 0x2B, 0xBB,
+    0xC8, 0x1B, 0xDB, 0x81, 0xFD, 0x62, 0x00, 0xFB, 0xB5, 0x08, 0x8D, 0x6F, 0x1D, 0x8D, 0x37, 0x81,
+    0x7A, 0xD0, 0x31, 0xC1, 0xFB, 0x26, 0xD0, 0x8C, 0x26, 0x50, 0xC6, 0x6A, 0x02, 0xF9, 0xC2, 0x0C,
+    0xF6, 0x2F, 0x23, 0x54, 0xB2, 0x80, 0x92, 0x85, 0x54, 0x2F, 0xC0, 0xC8, 0x0E, 0x3C, 0x94, 0x6E,
+    0x4B, 0x96, 0x9B, 0xB0, 0x09, 0x4E, 0xB5, 0x6E, 0x87, 0x93, 0x28, 0xA4, 0xE8, 0x67, 0x06, 0x38,
+    0x46, 0xCD, 0x37, 0xD1, 0xE1, 0x2A, 0xD5, 0x70, 0x15, 0xE3, 0x5B, 0x2C, 0x96, 0xAB, 0x58, 0x22,
+    0xB6, 0x98, 0xB0, 0xE5, 0x88, 0xFD, 0xA2, 0xA7, 0xB9, 0xEC, 0x68, 0x7A, 0x68, 0x22, 0xD4, 0x73,
+    0x5A, 0xBE, 0x7A, 0x48, 0x2B, 0x9F, 0xA0, 0x23, 0x68, 0x5D, 0x2E, 0xA5, 0x8C, 0x60, 0x06, 0x01,
+    0x3D, 0x57, 0x01, 0x84, 0xB6, 0xA3, 0xF1, 0x3A, 0x52, 0x4E, 0x58, 0x9F, 0xD8, 0x10, 0xD6, 0x53,
+    0x07, 0x13, 0x50, 0xA2, 0x17, 0x30, 0x53, 0xDF, 0x81, 0xBC, 0x14, 0xA0, 0x92, 0x08, 0xB4, 0x29,
+    0xCC, 0x1E, 0x49, 0xE0, 0x4F, 0x22, 0x97, 0x58, 0x91, 0x71, 0x13, 0x40, 0xF1, 0x40, 0x9D, 0x7C,
+    0x54, 0x07, 0xD8, 0x69, 0x67, 0x5F, 0x24, 0x00, 0x75, 0x52, 0x8C, 0x07, 0x1D, 0x8F, 0x51, 0x8D,
+    0x34, 0x4E, 0xCD, 0xD4, 0x1D, 0x57, 0x31, 0x9E, 0xDA, 0x57, 0x03, 0x3A, 0xE8, 0x00, 0x51, 0x07,
+    0xB0, 0x6A, 0x06, 0xE3, 0x23, 0xE8, 0x70, 0x0C, 0x2C, 0x57, 0x81, 0xA6, 0x25, 0x05, 0x30, 0x14,
+    0x59, 0x39, 0xA2, 0xDA, 0x11, 0x42, 0xEE, 0xC8, 0xEF, 0x5B, 0xB7, 0x93, 0xC0, 0x74, 0x3B, 0x4E,
+    0x20, 0x76, 0xED, 0xC9, 0x9E, 0x88, 0x36, 0x09, 0x63, 0x9B, 0xBC, 0x49, 0xEB, 0x40, 0xCF, 0xE9,
+    0x7D, 0x7D, 0xBA, 0xAB, 0xC7, 0x94, 0xC4, 0xC6, 0xA4, 0xC3, 0x7D, 0x82, 0x38, 0xEA, 0x24, 0x87,
+    0x59, 0x1C, 0x37, 0xDC, 0xA3, 0x4D, 0xBE, 0xAC, 0x5D, 0xB3, 0x31, 0x4D, 0xCA, 0xFD, 0xCE, 0x0C,
+    0xD0, 0xBE, 0x95, 0x5C, 0xFB, 0xD8, 0x0F, 0x40, 0x1B, 0x4C, 0x04, 0xDA, 0xA0, 0xC5, 0x41, 0x1B,
+    0x68, 0x03, 0xB4, 0x01, 0x13, 0xA1, 0x9D, 0xD0, 0xD2, 0x7D, 0xA6, 0x9D, 0xA0, 0x0D, 0xE7, 0xEF,
+    0xC8, 0x47, 0x53, 0x35, 0x1D, 0x95, 0xCB, 0x1A, 0x37, 0xA0, 0xEA, 0xD8, 0xA7, 0xF4, 0xCC, 0xE8,
+    0x51, 0x8F, 0x14, 0xA1, 0xEA, 0x50, 0x53, 0x03, 0xC4, 0x23, 0xA0, 0xDF, 0x21, 0x2A, 0xD6, 0xE5,
+    0x7A, 0x59, 0x82, 0x92, 0xDE, 0x19, 0xA0, 0xF9, 0xD3, 0x00, 0xBD, 0x9E, 0x28, 0x52, 0x91, 0x41,
+    0x45, 0x1A, 0xCF, 0x7A, 0x1F, 0xC0, 0xA7, 0x00, 0x1E, 0x3E, 0x49, 0x43, 0xB5, 0x88, 0x74, 0x7B,
+    0xBD, 0xC8, 0x54, 0x7A, 0x16, 0x98, 0x31, 0x1E, 0xE3, 0x54, 0x44, 0x05, 0x1A, 0x47, 0x83, 0x0E,
+    0xE8, 0x11, 0x0B, 0xFB, 0x94, 0x23, 0xA5, 0xE7, 0x18, 0x8E, 0x30, 0x1E, 0xD3, 0x11, 0x61, 0xA2,
+    0xE9, 0xA8, 0xD1, 0x13, 0x45, 0xC8, 0xAF, 0x0A, 0x94, 0x9E, 0x5E, 0x44, 0x26, 0x23, 0x22, 0x82,
+    0x88, 0x48, 0xA8, 0xB3, 0xEB, 0xA7, 0x1A, 0x76, 0x34, 0x01, 0xE3, 0x77, 0xA8, 0x48, 0x93, 0xED,
+    0xF3, 0x63, 0xD7, 0xBF, 0x79, 0x4F, 0x2B, 0xF3, 0x79, 0x0E, 0xD9, 0xE3, 0x15, 0x9E, 0x20, 0xF0,
+    0x2C, 0x81, 0x97, 0x8B, 0x91, 0xA0, 0x07, 0x46, 0xED, 0xD5, 0x50, 0xFA, 0xC2, 0x57, 0x9D, 0xF6,
+    0xC6, 0xE9, 0xCE, 0x88, 0xCC, 0xB5, 0xC8, 0xDC, 0xA4, 0x80, 0x22, 0x93, 0x39, 0x8A, 0x11, 0x8A,
+    0x4E, 0x5D, 0xE4, 0xEC, 0xC5, 0x16, 0xD6, 0x2A, 0x60, 0x86, 0x63, 0x88, 0xC6, 0x53, 0xFB, 0x99,
+    0x62, 0x32, 0x0E, 0xAB, 0x02, 0x65, 0x68, 0xE0, 0x66, 0x31, 0x62, 0x86, 0x0B, 0xE8, 0x58, 0x4C,
+    0x67, 0xC5, 0x1B, 0x91, 0x09, 0xBB, 0xB6, 0x9B, 0xED, 0xBB, 0xB9, 0x9D, 0x73, 0xDC, 0x6A, 0x5C,
+    0x73, 0x36, 0x40, 0xFA, 0xE7, 0xD7, 0xE0, 0xE0, 0x0A, 0x94, 0x3F, 0xDA, 0x2A, 0x9D, 0xA6, 0xCB,
+    0x89, 0x39, 0xDC, 0xCB, 0xBD, 0x4F, 0x79, 0xFD, 0x83, 0x40, 0xB8, 0xC1, 0xE1, 0x39, 0x2E, 0x18,
+    0xCC, 0x53, 0x5D, 0xE9, 0xC7, 0x72, 0x3C, 0x78, 0x69, 0x2A, 0xE5, 0x08, 0x6A, 0xA8, 0xBA, 0x8D,
+    0x83, 0xF2, 0x1C, 0x9C, 0x0F, 0x98, 0x43, 0x78, 0x14, 0x2A, 0xB7, 0xA3, 0x1C, 0xCC, 0x09, 0x63,
+    0xE4, 0xA8, 0xC8, 0xCA, 0xA3, 0xE6, 0x72, 0x40, 0x4F, 0x95, 0x47, 0x07, 0xE3, 0x29, 0x47, 0xD3,
+    0x61, 0x86, 0xFA, 0xC9, 0x50, 0xFB, 0xE6, 0xF7, 0x46, 0xEB, 0xED, 0x53, 0x3F, 0x90, 0xCE, 0xBE,
+    0xF1, 0x33, 0x71, 0x8D, 0x88, 0x24, 0x9C, 0x50, 0xCB, 0xB4, 0x42, 0xAD, 0x16, 0xA8, 0x8B, 0x08,
+    0x17, 0x74, 0x84, 0xFD, 0x72, 0x86, 0xBD, 0x2A, 0xA4, 0x28, 0xF6, 0x2C, 0xAA, 0x0B, 0xEC, 0x19,
+    0xAA, 0x27, 0x07, 0xC2, 0x39, 0x8C, 0xF6, 0xC5, 0xF8, 0xDC, 0xE3, 0xFB, 0xE5, 0x9F, 0x1A, 0x7F,
+    0xE5, 0xFD, 0xA8, 0x45, 0xBA, 0x6A, 0x9E, 0x78, 0xB8, 0xA6, 0x78, 0x35, 0xF0, 0xC4, 0x01, 0x6A,
+    0xC7, 0xAE, 0x3B, 0xD8, 0x80, 0x88, 0xA3, 0x6D, 0x4F, 0xE7, 0xAD, 0xBE, 0x3A, 0x65, 0x78, 0x62,
+    0xB7, 0x92, 0xE6, 0x67, 0x32, 0x22, 0x22, 0x5D, 0x7D, 0x9B, 0xA8, 0x17, 0x4A, 0x6F, 0x1D, 0x87,
+    0x65, 0xA0, 0xF4, 0xC7, 0x30, 0x1B, 0x8F, 0xE9, 0x22, 0x6A, 0xAA, 0x3B, 0xAC, 0x9E, 0x12, 0x78,
+    0xDF, 0x97, 0x01, 0x33, 0x7E, 0xA0, 0xF6, 0xF6, 0x71, 0x8F, 0xFE, 0x5A, 0xEB, 0x72, 0x67, 0x1C,
+    0xFF, 0x90, 0x42, 0x16, 0x5A, 0x6A, 0x91, 0xAE, 0x75, 0xFD, 0xAD, 0x72, 0xB0, 0xEF, 0x2F, 0xA8,
+    0x50, 0xC9, 0x7A, 0x8D, 0x09, 0x2B, 0x72, 0x6D, 0xA2, 0x7D, 0x48, 0x64, 0x46, 0x7A, 0x91, 0x59,
+    0x89, 0x88, 0xCC, 0x85, 0xC8, 0xF5, 0x4B, 0x69, 0x11, 0xB2, 0x1F, 0xCD, 0xBF, 0x53, 0x54, 0xB1,
+    0x26, 0x05, 0xBC, 0xC5, 0x9F, 0xA0, 0x45, 0x64, 0x21, 0x99, 0xBB, 0x1C, 0x10, 0xD4, 0x22, 0xB7,
+    0x80, 0xEF, 0x7C, 0x0B, 0xE0, 0x31, 0x77, 0x01, 0x59, 0xAA, 0x1F, 0x2C, 0x85, 0x97, 0x99, 0x27,
+    0x4A, 0xB9, 0x6D, 0xF8, 0xA7, 0xBD, 0x78, 0x2B, 0x12, 0x1A, 0x79, 0xEF, 0x1B, 0xC6, 0xA5, 0x2D,
+    0x50, 0x73, 0x36, 0x8F, 0x66, 0xBD, 0x1E, 0x0A, 0x91, 0x99, 0x46, 0x16, 0x54, 0xC2, 0xEF, 0xCF,
+    0x38, 0xFE, 0x7D, 0x54, 0xBF, 0x62, 0xA9, 0x45, 0xBC, 0xED, 0xDA, 0x5B, 0xE5, 0xD8, 0xC8, 0x0A,
+    0x53, 0x29, 0x72, 0x8D, 0x99, 0x46, 0xE4, 0x56, 0xC4, 0x3E, 0x9D, 0x2B, 0xF8, 0x12, 0x91, 0x64,
+    0x86, 0xDF, 0xFB, 0xD6, 0xC5, 0x0C, 0x18, 0xA7, 0xAB, 0xC9, 0x7F, 0xA7, 0xB8, 0x48, 0x3A, 0x1E,
+    0x4A, 0x89, 0xCB, 0x16, 0xE0, 0xB7, 0x22, 0x0B, 0xD4, 0x22, 0x0B, 0xA8, 0x3E, 0x85, 0x7A, 0x49,
+    0x2B, 0xC2, 0x29, 0x3B, 0xE7, 0xE0, 0x7E, 0x1E, 0xBC, 0x56, 0xD3, 0xAE, 0x7A, 0x58, 0x9F, 0x1C,
+    0xFB, 0x85, 0x73, 0x85, 0xBC, 0xF7, 0xB4, 0xBB, 0xD2, 0xCB, 0x60, 0x45, 0xE6, 0x5A, 0xDE, 0xFB,
+    0x66, 0xE5, 0x13, 0xF8, 0xCA, 0x8E, 0x3C, 0x27, 0xD7, 0x27, 0x44, 0x22, 0xB5, 0x08, 0xF4, 0x19,
+    0x8E, 0xE2, 0x61, 0xE0, 0xEC, 0x5F, 0x2F, 0x47, 0x10, 0x78, 0x31, 0x91, 0x4B, 0x33, 0x9B, 0x06,
+    0x30, 0x5D, 0xB5, 0x25, 0xE5, 0xF3, 0x96, 0xDA, 0x64, 0x88, 0xBE, 0x19, 0xF9, 0x64, 0x37, 0x13,
+    0x94, 0x04, 0x25, 0xD0, 0x0C, 0xA5, 0x74, 0x75, 0x80, 0xD6, 0x37, 0x0B, 0x02, 0x88, 0xEB, 0x83,
+    0x99, 0x40, 0x89, 0x96, 0x4E, 0x1C, 0xE8, 0x68, 0x96, 0x6A, 0x06, 0xAA, 0xD9, 0x86, 0xBE, 0x03,
+    0x4C, 0x90, 0x3F, 0x4D, 0x01, 0xD6, 0x1B, 0x4B, 0x82, 0x5D, 0xDB, 0x37, 0xDF, 0x4D, 0xB0, 0xAB,
+    0xF4, 0x09, 0x5C, 0x55, 0x92, 0x61, 0x57, 0xBD, 0x55, 0x37, 0x8C, 0xC8, 0x86, 0xC3, 0x2E, 0xDB,
+    0x13, 0x71, 0xC3, 0x61, 0x63, 0x86, 0x6C, 0x65, 0x4E, 0xEF, 0x5D, 0x65, 0x02, 0x6A, 0xB1, 0xB7,
+    0x53, 0x51, 0xF6, 0xAF, 0xE4, 0x8D, 0x14, 0x17, 0x18, 0xF9, 0x82, 0x0C, 0x68, 0x99, 0xEC, 0x62,
+    0xC4, 0x63, 0xE5, 0xF7, 0x24, 0x34, 0xD2, 0x69, 0x99, 0x8C, 0x78, 0x9B, 0x0A, 0x2C, 0x85, 0xE3,
+    0xCB, 0x00, 0x8F, 0x66, 0xA7, 0x76, 0x25, 0x81, 0xE1, 0xC8, 0x76, 0x6A, 0xE9, 0xFB, 0x55, 0xDF,
+    0xF1, 0x89, 0x6F, 0xB5, 0xAF, 0xA3, 0x8A, 0x60, 0x5D, 0x3F, 0xD6, 0x03, 0xAC, 0x85, 0xA8, 0x05,
+    0x54, 0x34, 0xB1, 0x1E, 0x40, 0xCF, 0xF6, 0x07, 0x0B, 0x50, 0x05, 0xA9, 0x07, 0xA0, 0xFE, 0xE1,
+    0xBC, 0x24, 0x8C, 0xFD, 0xCD, 0x21, 0x39, 0xEC, 0xE5, 0xF4, 0x29, 0xE8, 0xFC, 0x30, 0xEF, 0x60,
+    0x91, 0x3C, 0x47, 0x42, 0x4D, 0x53, 0x6A, 0x3A, 0x02, 0xFD, 0xCF, 0x16, 0x19, 0xC0, 0xAC, 0xF6,
+    0xE7, 0xE2, 0x41, 0x7E, 0x2C, 0xAF, 0x49, 0x47, 0xBD, 0x9A, 0xD5, 0x88, 0x2B, 0x64, 0xB4, 0x73,
+    0x2D, 0xA7, 0x98, 0x14, 0xB6, 0xA3, 0xC6, 0x76, 0x18, 0x6F, 0x3D, 0x7A, 0x6C, 0x3C, 0xC5, 0x54,
+    0x7B, 0x88, 0xB5, 0x87, 0xAB, 0x66, 0x80, 0xE6, 0x8B, 0x03, 0x98, 0xEF, 0x8D, 0x50, 0xBE, 0x3F,
+    0x42, 0x21, 0x23, 0x20, 0x13, 0xD0, 0xCA, 0x0C, 0xF6, 0xAB, 0xFD, 0x80, 0x19, 0x8A, 0x48, 0x15,
+    0x68, 0x3A, 0x3D, 0x53, 0x06, 0x16, 0x88, 0xF4, 0xD0, 0x62, 0x3B, 0x1A, 0x5F, 0x0F, 0xA9, 0x7A,
+    0x50, 0xED, 0xAA, 0x1A, 0x75, 0xDC, 0x2A, 0x54, 0x36, 0x6E, 0x11, 0x75, 0xF2, 0x1C, 0x8F, 0x14,
+    0x23, 0x2F, 0x37, 0xE8, 0x57, 0x03, 0x8F, 0xD6, 0x70, 0x23, 0xA0, 0xBF, 0xEF, 0x78, 0x74, 0x82,
+    0x3E, 0xC1, 0x84, 0x75, 0x35, 0x32, 0xEB, 0x51, 0xFB, 0xD2, 0xD7, 0xD4, 0xCC, 0x1C, 0xEA, 0x41,
+    0x8F, 0x50, 0x27, 0x2B, 0x22, 0x1D, 0x7A, 0xCA, 0x3C, 0xA8, 0x4A, 0x64, 0x02, 0x2B, 0xE2, 0x73,
+    0xC9, 0x22, 0x55, 0x5B, 0x6D, 0x67, 0x06, 0x54, 0xC4, 0x42, 0x15, 0x8A, 0xB8, 0x55, 0x33, 0x23,
+    0xD6, 0xA5, 0xA8, 0x03, 0xDB, 0x25, 0x36, 0xF3, 0xC9, 0x13, 0x2E, 0x3F, 0xD1, 0x51, 0x05, 0x96,
+    0xFC, 0x84, 0x8A, 0x58, 0x8F, 0x09, 0xC8, 0x33, 0x85, 0xB8, 0x52, 0x86, 0x26, 0xD2, 0x08, 0xD2,
+    0xA5, 0xF5, 0x49, 0xB5, 0xBF, 0x94, 0x59, 0xE5, 0xAC, 0x02, 0xE0, 0xEC, 0xB7, 0x49, 0x5C, 0xAB,
+    0x4A, 0x66, 0x8C, 0xBB, 0x41, 0x4D, 0xA0, 0x51, 0x81, 0xFD, 0x62, 0x64, 0x4F, 0x0F, 0x1C, 0x95,
+    0x9E, 0xA9, 0xF2, 0x04, 0xD3, 0x15, 0xA3, 0x71, 0x7A, 0xA8, 0x29, 0xBD, 0xBD, 0x68, 0x3B, 0x3B,
+    0xDE, 0xA4, 0xF5, 0xA9, 0xA0, 0x63, 0x53, 0xF8, 0xA8, 0xBE, 0x0D, 0xC5, 0x8B, 0x3B, 0x14, 0xAC,
+    0xFB, 0x35, 0xC8, 0x58, 0x39, 0x41, 0xFD, 0x61, 0xC8, 0x58, 0xF8, 0xC4, 0xC8, 0x58, 0xFD, 0x51,
+    0xC8, 0xD8, 0x48, 0xEF, 0x29, 0xC4, 0x69, 0x01, 0x23, 0x98, 0x19, 0xDA, 0x98, 0xE0, 0x9B, 0x44,
+    0xBE, 0x4E, 0x06, 0xC7, 0x24, 0x29, 0xEE, 0x53, 0x1D, 0x54, 0x3A, 0xC0, 0x24, 0x55, 0x4E, 0x88,
+    0x23, 0x97, 0x5C, 0xC2, 0x7A, 0x82, 0x1E, 0x38, 0xE0, 0x10, 0x3D, 0x18, 0xCF, 0x21, 0x73, 0x2A,
+    0xFC, 0xCE, 0x45, 0xA0, 0xEE, 0x2C, 0xC5, 0x54, 0x8E, 0x58, 0x7A, 0x91, 0x60, 0x44, 0x56, 0x44,
+    0x64, 0xA8, 0x45, 0x62, 0x31, 0x51, 0x7B, 0xEB, 0xF4, 0x5C, 0x06, 0xEC, 0xD0, 0xA7, 0x1C, 0x78,
+    0x23, 0x2F, 0x1B, 0x81, 0x42, 0x06, 0x50, 0xFC, 0xAD, 0x5A, 0xBA, 0xE1, 0xF4, 0xD2, 0xC5, 0xB4,
+    0x74, 0xE1, 0x14, 0xF2, 0xA5, 0x72, 0x11, 0x38, 0x99, 0x3E, 0x3B, 0xA4, 0xE5, 0xE4, 0x24, 0x7D,
+    0x4F, 0xA2, 0x96, 0x1D, 0xDB, 0x1D, 0x16, 0xFD, 0x80, 0x22, 0x30, 0x61, 0xBA, 0xD2, 0xB3, 0x8F,
+    0x45, 0x05, 0x66, 0x2A, 0x5F, 0x0E, 0x58, 0x1A, 0xD4, 0x4C, 0xA4, 0x1A, 0xCA, 0x11, 0x4B, 0x93,
+    0xFD, 0xE6, 0xA8, 0x45, 0xC4, 0xD5, 0x22, 0x91, 0x9B, 0x94, 0x41, 0x4F, 0x34, 0x5D, 0xED, 0x59,
+    0xE8, 0x53, 0x0E, 0x9D, 0xAA, 0xA2, 0x3B, 0x82, 0xA1, 0xCF, 0x44, 0x9C, 0xE2, 0x45, 0x50, 0x17,
+    0xB9, 0xF7, 0x62, 0x0F, 0x4B, 0x35, 0x62, 0x7C, 0x44, 0x45, 0xE3, 0x69, 0xBA, 0x19, 0x3D, 0xD5,
+    0x60, 0x8B, 0x40, 0x39, 0x5E, 0x80, 0x45, 0x0F, 0xD4, 0x7E, 0x9F, 0x32, 0xEA, 0xE9, 0xAC, 0x74,
+    0xB5, 0xC8, 0x44, 0xBB, 0xF6, 0x5B, 0x9C, 0x71, 0xBC, 0x85, 0x63, 0x31, 0x87, 0x63, 0xC5, 0x16,
+    0x8E, 0xE9, 0x3B, 0x0E, 0x07, 0x12, 0xEF, 0x59, 0x39, 0x38, 0xCB, 0xD9, 0xC2, 0x6B, 0x3F, 0x32,
+    0x3E, 0xCB, 0x8D, 0x73, 0xEC, 0x19, 0x8C, 0xF6, 0x55, 0x37, 0x96, 0xC3, 0xFE, 0x1F, 0x04, 0x23,
+    0x91, 0xFE, 0x4F, 0xC0, 0x38, 0x2A, 0x4F, 0x19, 0x28, 0x22, 0x04, 0xD8, 0x83, 0x47, 0x37, 0xDA,
+    0x7A, 0x07, 0x8F, 0xBD, 0x88, 0x16, 0x87, 0x12, 0x4F, 0xBD, 0x26, 0x54, 0x45, 0x66, 0xE8, 0x27,
+    0xB4, 0x04, 0x4A, 0xF1, 0xD4, 0xE2, 0xB1, 0x02, 0xBD, 0x50, 0x48, 0x44, 0x4B, 0xA4, 0x96, 0x91,
+    0xFA, 0xCD, 0x09, 0xE9, 0x1D, 0x37, 0xDB, 0xB1, 0x7A, 0x6F, 0x41, 0xCF, 0xD2, 0xB5, 0xDF, 0x0F,
+    0xD4, 0x6F, 0x88, 0x5E, 0x5A, 0x4F, 0x6F, 0x62, 0xF3, 0x2F, 0x57, 0x74, 0xB4, 0x7F, 0x25, 0x66,
+    0xA6, 0x1E, 0xFB, 0x37, 0xA7, 0x76, 0xA0, 0xFF, 0x9A, 0xC8, 0xAB, 0x82, 0x5E, 0x4A, 0x89, 0x26,
+    0x52, 0x07, 0x23, 0x63, 0x1B, 0xE8, 0xBD, 0x95, 0x42, 0x3A, 0xBD, 0x22, 0x93, 0x59, 0x30, 0x93,
+    0x96, 0xAE, 0x0D, 0xF4, 0x43, 0x15, 0x0B, 0xF1, 0x5A, 0x68, 0x06, 0x23, 0x49, 0x14, 0xDA, 0x99,
+    0x7E, 0xCC, 0x12, 0xCD, 0xA9, 0x3E, 0x8D, 0xEC, 0xD9, 0xCB, 0xCC, 0x00, 0xD8, 0xA8, 0x7A, 0xD9,
+    0xEE, 0x6F, 0xB4, 0xBA, 0x24, 0x32, 0xD9, 0x3E, 0xED, 0x3C, 0x16, 0x8D, 0x33, 0x81, 0xC6, 0xEB,
+    0x54, 0xC8, 0x70, 0x26, 0x22, 0x63, 0xB9, 0x72, 0x10, 0xB5, 0xB8, 0xBA, 0xD5, 0xEF, 0x0E, 0xD5,
+    0x3F, 0xFE, 0xEE, 0xAF, 0x82, 0x7E, 0x2B, 0xC4, 0xA8, 0xA6, 0x25, 0x5E, 0xE5, 0xC8, 0xAE, 0xB6,
+    0xB3, 0x95, 0x98, 0xA1, 0xFE, 0x9A, 0x3C, 0x1D, 0xAA, 0xA1, 0x7D, 0x3E, 0xEA, 0xA9, 0xF6, 0xA2,
+    0x62, 0x71, 0xAD, 0xED, 0xFA, 0x4D, 0x60, 0x13, 0x4D, 0x69, 0x97, 0x34, 0x19, 0xBF, 0x25, 0x28,
+    0xC5, 0x35, 0x38, 0xE3, 0xCA, 0xB1, 0x98, 0x88, 0x58, 0xEA, 0xAE, 0x1A, 0x74, 0x20, 0x72, 0x95,
+    0xC6, 0x19, 0xAF, 0x83, 0x9A, 0x39, 0xC6, 0x3A, 0xE3, 0xCB, 0xFC, 0x67, 0x4E, 0x41, 0xD5, 0x00,
+    0x04, 0xF6, 0x00, 0xE3, 0xEB, 0x54, 0x85, 0x4B, 0xA5, 0xCE, 0x99, 0x4F, 0xC2, 0xC7, 0x5A, 0x4F,
+    0x29, 0x8B, 0x4E, 0x8B, 0x93, 0x2C, 0x55, 0xDD, 0x03, 0xE8, 0x5F, 0x04, 0x80, 0x25, 0xF5, 0xCE,
+    0xBC, 0x36, 0x41, 0x0A, 0xEB, 0xE1, 0x66, 0x91, 0xD0, 0xDE, 0xA6, 0x03, 0x3D, 0x15, 0x11, 0xE8,
+    0x69, 0x3C, 0xD4, 0x5E, 0x45, 0xD0, 0x33, 0xB5, 0x87, 0x1E, 0xB5, 0x80, 0x19, 0x30, 0x03, 0x3A,
+    0xC5, 0x97, 0xBD, 0x88, 0x8C, 0x98, 0x13, 0x9B, 0x10, 0x68, 0x3B, 0x10, 0x4C, 0x00, 0x13, 0x8A,
+    0x15, 0x90, 0x64, 0xE2, 0xA7, 0x14, 0x6F, 0x9E, 0x03, 0x15, 0x78, 0x02, 0xD4, 0x5C, 0x84, 0x5D,
+    0x2C, 0x90, 0x62, 0x96, 0x8F, 0xBD, 0xC0, 0x26, 0xAD, 0xC4, 0x12, 0xC0, 0x24, 0xE4, 0x7B, 0x68,
+    0x46, 0x68, 0x31, 0x43, 0xCE, 0x96, 0x13, 0xCD, 0x53, 0x0F, 0x19, 0xAA, 0xAD, 0xB7, 0x8A, 0x9F,
+    0x71, 0xF4, 0x0E, 0xD3, 0x69, 0x01, 0xF3, 0xCB, 0x97, 0x84, 0xCC, 0xD9, 0xA8, 0x44, 0x56, 0xD0,
+    0xB2, 0x5E, 0x05, 0xFA, 0x5B, 0x29, 0x3C, 0x2A, 0x87, 0x6A, 0x00, 0x56, 0x16, 0xA0, 0x19, 0x9A,
+    0x01, 0xF4, 0xA2, 0x23, 0xD0, 0xFA, 0xDE, 0x7F, 0x7C, 0x38, 0x39, 0xB2, 0xE3, 0x37, 0x24, 0x26,
+    0x5B, 0x42, 0xA7, 0x50, 0xEF, 0x27, 0xEC, 0xCE, 0x02, 0x98, 0x37, 0x26, 0x40, 0x45, 0xEB, 0x00,
+    0xAB, 0x27, 0xA0, 0x1A, 0x9B, 0x0E, 0x54, 0xCC, 0xD4, 0xDC, 0xC6, 0x6F, 0x7E, 0x5C, 0xA5, 0xFE,
+    0x23, 0xDB, 0xA9, 0x08, 0x55, 0xA0, 0x1E, 0x48, 0xE4, 0x04, 0xAC, 0x88, 0x8C, 0x54, 0x27, 0x58,
+    0xE6, 0x98, 0x3A, 0x21, 0x28, 0x67, 0x30, 0x21, 0xC5, 0xB0, 0x34, 0x23, 0x98, 0x50, 0xC6, 0xCD,
+    0xE0, 0xDE, 0xE4, 0xE6, 0x76, 0x6D, 0xC5, 0x52, 0x2C, 0xDB, 0xA5, 0x95, 0xB1, 0x8C, 0xFF, 0x3F,
+    0x2E, 0x39, 0x00, 0x0F, 0xB8, 0x2D, 0xF8, 0x8D, 0x1B, 0x1C, 0x92, 0xE0, 0x9D, 0xD4, 0xDF, 0x41,
+    0xA6, 0xAA, 0x03, 0x54, 0xEF, 0xE4, 0xB3, 0x55, 0xB7, 0xB7, 0x90, 0xBF, 0xAD, 0xB3, 0x0D, 0x30,
+    0xDF, 0x95, 0xAD, 0xC5, 0xA1, 0xCE, 0x56, 0x62, 0x29, 0xD6, 0x4B, 0x7F, 0x94, 0x18, 0x2C, 0x4D,
+    0xFA, 0xCC, 0x32, 0x14, 0xE9, 0x6B, 0x54, 0xC4, 0x26, 0x8F, 0x6D, 0x5D, 0x76, 0x35, 0x66, 0xCC,
+    0x60, 0x72, 0x31, 0x93, 0xA8, 0x4C, 0xF4, 0x6F, 0x5F, 0xCF, 0x8D, 0x09, 0x39, 0x34, 0x4F, 0x67,
+    0xD7, 0x6D, 0x67, 0x97, 0x10, 0x3A, 0x9F, 0x23, 0xD6, 0x6A, 0x82, 0x5E, 0x64, 0x45, 0xE5, 0xAB,
+    0x1E, 0x69, 0xFD, 0xAE, 0xE0, 0xF2, 0x81, 0x5B, 0xB1, 0x52, 0xAC, 0x8E, 0x42, 0x96, 0x9F, 0xE7,
+    0xAD, 0x5C, 0xDD, 0x0D, 0xEC, 0xD0, 0x08, 0xDA, 0x97, 0x01, 0xF1, 0x9C, 0x67, 0xC6, 0x04, 0xF5,
+    0xC7, 0x43, 0x93, 0x8E, 0xEB, 0x21, 0xD1, 0x5D, 0x0E, 0x51, 0xCB, 0x33, 0xE4, 0x15, 0x87, 0x29,
+    0x81, 0xE4, 0xA6, 0x4B, 0xA0, 0x99, 0xFC, 0x7D, 0x91, 0x8E, 0x2E, 0xA1, 0xFE, 0x29, 0x8B, 0x14,
+    0xF1, 0x5A, 0xD6, 0x56, 0x64, 0xA6, 0x5A, 0x9F, 0x7E, 0xBD, 0xBF, 0x05, 0x7C, 0x9E, 0xB3, 0x60,
+    0xD0, 0x1E, 0x3D, 0xE8, 0x21, 0xD3, 0xB0, 0xEA, 0x14, 0x79, 0x77, 0x1F, 0xDE, 0xA5, 0x97, 0x28,
+    0x23, 0xAD, 0x48, 0x48, 0x96, 0xCB, 0xF8, 0x8D, 0x2F, 0x91, 0x98, 0x36, 0x71, 0x47, 0xB4, 0xA9,
+    0xFF, 0xCF, 0x4B, 0xCF, 0x50, 0x6D, 0xAC, 0xC4, 0x7C, 0x24, 0xB1, 0x89, 0x76, 0x6F, 0xD4, 0x23,
+    0xA0, 0x6E, 0x5F, 0xBA, 0xE4, 0xE8, 0x45, 0x42, 0x6A, 0x78, 0xAB, 0x45, 0x96, 0x54, 0xFB, 0x03,
+    0x5E, 0xE4, 0x37, 0x21, 0x70, 0x0E, 0x66, 0x5E, 0x81, 0x3E, 0xB5, 0xC5, 0x75, 0x5B, 0x51, 0xE0,
+    0x63, 0x6F, 0x97, 0xC7, 0x14, 0x9A, 0xD2, 0x0C, 0x06, 0xAE, 0x52, 0x3A, 0x35, 0xA1, 0xBD, 0x1E,
+    0xCF, 0xBC, 0xE4, 0xAB, 0xAD, 0x28, 0xD9, 0xD5, 0x2F, 0xB8, 0x7C, 0x4A, 0x76, 0x43, 0xA7, 0x69,
+    0x26, 0x3E, 0x47, 0x9D, 0xB9, 0x45, 0x53, 0xE6, 0x02, 0x5C, 0x5E, 0x1D, 0x9C, 0x95, 0x6B, 0xE9,
+    0xA1, 0x11, 0x09, 0xB4, 0x22, 0xA3, 0xEA, 0x54, 0xEF, 0x37, 0x67, 0x10, 0xB3, 0x5F, 0x3F, 0x73,
+    0xB9, 0xEB, 0x13, 0x73, 0xFD, 0xFD, 0x50, 0xFD, 0xD4, 0xD5, 0xEE, 0x3C, 0xCC, 0x3C, 0x41, 0xDD,
+    0x71, 0xA3, 0x9C, 0x41, 0xC4, 0xC1, 0xE5, 0xAD, 0xFA, 0xA2, 0xFA, 0x39, 0x15, 0x42, 0x1A, 0x91,
+    0xB1, 0x10, 0x11, 0x7E, 0x8B, 0x7A, 0xCE, 0x27, 0xA3, 0x32, 0x8E, 0xA3, 0xBE, 0x34, 0x59, 0x11,
+    0xD1, 0x22, 0x32, 0xD8, 0x6F, 0x11, 0xB5, 0xA7, 0xE1, 0x1C, 0xD5, 0xC0, 0x58, 0x4D, 0xE9, 0x3A,
+    0xAB, 0xDB, 0xA7, 0xBA, 0x7C, 0xF4, 0x04, 0xF5, 0x50, 0x7B, 0x10, 0x64, 0xD3, 0xF3, 0x66, 0xFC,
+    0xC4, 0x09, 0x72, 0xBA, 0xD6, 0x7C, 0xED, 0x66, 0x2B, 0x92, 0x8C, 0x6C, 0xD7, 0x7B, 0xBA, 0x23,
+    0x52, 0x07, 0xE0, 0xCC, 0xE5, 0x8E, 0x3E, 0xD1, 0x4F, 0xE5, 0xFD, 0x40, 0xF5, 0x53, 0x57, 0x3B,
+    0xCE, 0xC3, 0x4C, 0xBA, 0xF0, 0x74, 0xE5, 0xE9, 0xD2, 0x4F, 0xAE, 0x3D, 0x5D, 0x3D, 0xB5, 0x48,
+    0x97, 0xFA, 0xA5, 0x1A, 0x91, 0xB0, 0x5D, 0xBF, 0x9E, 0xB7, 0xC8, 0x4C, 0xCD, 0xA0, 0xBE, 0x14,
+    0xB4, 0x88, 0x04, 0x2D, 0x22, 0x83, 0x7E, 0xEF, 0xA2, 0xF1, 0xDA, 0xD3, 0xA0, 0x3D, 0xC7, 0xA8,
+    0xB4, 0x08, 0x12, 0x30, 0xEF, 0x4B, 0xA0, 0x1E, 0xEB, 0x11, 0x3B, 0xDA, 0x91, 0x07, 0x5C, 0xB2,
+    0x2E, 0x1C, 0x73, 0x7C, 0x6A, 0x65, 0x92, 0x81, 0xCF, 0xEC, 0xC3, 0x1C, 0x4C, 0x54, 0xB1, 0x8A,
+    0x9F, 0x6C, 0x65, 0x74, 0xA4, 0x8D, 0xB4, 0x9E, 0x6A, 0x52, 0x32, 0x96, 0x11, 0xEA, 0x50, 0x89,
+    0xB3, 0x1E, 0xEC, 0xD0, 0x44, 0xBD, 0x00, 0xAD, 0x97, 0xD1, 0x0E, 0x80, 0x68, 0xF9, 0xBD, 0xC4,
+    0xAE, 0x35, 0xB1, 0x19, 0x01, 0x1D, 0xED, 0x8F, 0x05, 0xA0, 0x9A, 0xE4, 0x0F, 0x92, 0x8F, 0x7E,
+    0x77, 0xC9, 0x0C, 0xC9, 0x77, 0x32, 0xF3, 0xB1, 0x95, 0xDC, 0x08, 0x99, 0xAD, 0xCE, 0x09, 0x57,
+    0xD2, 0xE6, 0x23, 0x3A, 0x6B, 0x08, 0x36, 0xFF, 0x51, 0x6E, 0x66, 0xA6, 0x15, 0xE9, 0x17, 0xA0,
+    0x94, 0xEF, 0xAF, 0x6D, 0x04, 0xFA, 0xD8, 0x4E, 0x32, 0x43, 0x25, 0xAF, 0xC9, 0xEB, 0x32, 0x81,
+    0x2C, 0x46, 0x9E, 0x92, 0x80, 0x91, 0xA1, 0x8F, 0x95, 0x8C, 0xC8, 0xA2, 0x25, 0x98, 0x9C, 0x9A,
+    0x07, 0x9D, 0xDB, 0xD9, 0xB6, 0xFA, 0x92, 0x9C, 0x5E, 0x9D, 0x66, 0xB4, 0xBF, 0x5E, 0x84, 0xD4,
+    0xB7, 0xB9, 0xDE, 0xDD, 0xDB, 0x51, 0x86, 0x72, 0x65, 0x05, 0x33, 0x36, 0x93, 0x19, 0xA1, 0xF6,
+    0xE2, 0x57, 0xC0, 0x3E, 0xB5, 0x98, 0x11, 0xE8, 0x4D, 0x58, 0x01, 0x15, 0xDB, 0xAF, 0x8F, 0x80,
+    0x7E, 0x6F, 0xC9, 0xFD, 0xA9, 0x09, 0x32, 0x31, 0xD9, 0x6E, 0x26, 0xEE, 0xD7, 0x96, 0x61, 0xD1,
+    0xA4, 0x25, 0xD8, 0x56, 0xA0, 0xDD, 0xEA, 0xD9, 0xFD, 0x9B, 0x0B, 0xD0, 0xBF, 0x25, 0x4D, 0x04,
+    0xB3, 0xD6, 0xD1, 0xCE, 0x28, 0x19, 0x65, 0x94, 0x89, 0x66, 0xD5, 0xF2, 0xD5, 0x54, 0xD8, 0xC4,
+    0xE6, 0x8B, 0x33, 0xC1, 0x04, 0xAA, 0xB9, 0x9A, 0xD1, 0xEB, 0x1D, 0x91, 0xE3, 0x26, 0x98, 0xB7,
+    0xA1, 0x10, 0x09, 0xB0, 0x5E, 0x97, 0x9D, 0xD1, 0x4A, 0x86, 0xEE, 0xE8, 0xC4, 0x62, 0x38, 0xD4,
+    0x97, 0xC4, 0x65, 0xD2, 0x4D, 0x3A, 0xB5, 0x04, 0x2E, 0xDA, 0x5D, 0x6B, 0x53, 0xEA, 0xCF, 0xC9,
+    0xC5, 0x93, 0xAA, 0x2B, 0x24, 0x61, 0xFE, 0x88, 0x48, 0x97, 0xDC, 0x90, 0xEA, 0x4F, 0xF5, 0x02,
+    0x47, 0x22, 0x2A, 0x16, 0x11, 0x1D, 0x75, 0x4C, 0xAA, 0x6B, 0x66, 0xF3, 0x41, 0x8B, 0xE7, 0x36,
+    0x32, 0xFC, 0xB5, 0x0A, 0x12, 0x1D, 0x2C, 0xFD, 0xAA, 0x36, 0xD2, 0x95, 0x1D, 0x81, 0x3F, 0x0E,
+    0x3B, 0x0E, 0xC7, 0xDE, 0xF6, 0x57, 0x31, 0x65, 0xBA, 0x6D, 0x2B, 0x1E, 0x2E, 0xDF, 0x3E, 0xD5,
+    0xEE, 0x38, 0xE8, 0x84, 0xC6, 0x1C, 0xA5, 0xB0, 0x52, 0x2D, 0x89, 0x04, 0xAC, 0x63, 0xAA, 0x3B,
+    0xEA, 0xD5, 0xA5, 0x5C, 0x82, 0xC6, 0x65, 0xD5, 0x8F, 0xD9, 0x1C, 0xD8, 0x4E, 0x7B, 0x3B, 0x54,
+    0x49, 0x47, 0x03, 0x8D, 0x04, 0x54, 0xBF, 0x49, 0xCB, 0x8E, 0x76, 0xCF, 0xD5, 0x14, 0x40, 0x97,
+    0x89, 0xD9, 0x82, 0xB0, 0x11, 0x5A, 0xA8, 0x57, 0x78, 0x50, 0xBA, 0xB4, 0xD2, 0xE5, 0x90, 0x7E,
+    0xCC, 0x00, 0x8D, 0xAF, 0x5C, 0xDF, 0xB5, 0x22, 0xB4, 0xB2, 0x52, 0xCB, 0x4C, 0xB1, 0x15, 0xAF,
+    0xEF, 0x01, 0xEE, 0x15, 0x19, 0xA1, 0x48, 0x82, 0xF0, 0xC0, 0xA9, 0x32, 0x73, 0x3D, 0x6C, 0x6C,
+    0x92, 0x26, 0x60, 0x3D, 0xE5, 0x8A, 0x9E, 0x41, 0x06, 0x5A, 0x87, 0x8D, 0x98, 0x80, 0x91, 0x0E,
+    0xA1, 0x90, 0x89, 0x7A, 0xA4, 0x15, 0x8A, 0xD4, 0xDF, 0x67, 0xBD, 0x5E, 0x56, 0xF4, 0x8C, 0x34,
+    0x03, 0xAD, 0x6B, 0xDE, 0x88, 0x98, 0x50, 0xCE, 0xAD, 0x47, 0xD4, 0x5A, 0xCD, 0xD4, 0xA3, 0xF5,
+    0xE2, 0x8A, 0xC5, 0x84, 0x3A, 0x60, 0x5F, 0x5D, 0x0A, 0x41, 0xC7, 0xD6, 0xD9, 0x91, 0xFE, 0x1F,
+    0x8F, 0xE5, 0x82, 0x79, 0x3F, 0x22, 0x1E, 0x11, 0x4C, 0xA4, 0x16, 0xAF, 0xA4, 0x2B, 0x64, 0xC2,
+    0x4E, 0xD8, 0x35, 0x71, 0x6E, 0xBA, 0x84, 0x1B, 0xC0, 0x3D, 0xF0, 0x52, 0x0A, 0xA2, 0x57, 0xD4,
+    0x33, 0x1F, 0xE8, 0xFA, 0xE0, 0x08, 0x1D, 0x99, 0xA9, 0x66, 0x26, 0x9A, 0x49, 0x05, 0x8E, 0x43,
+    0x11, 0xD4, 0x2F, 0x83, 0x1E, 0xCB, 0xD7, 0x47, 0x3D, 0xD4, 0xCF, 0x0F, 0xA5, 0x3F, 0x28, 0x7D,
+    0xE5, 0x63, 0xE5, 0xCD, 0xF3, 0xC1, 0x74, 0xE6, 0xEB, 0xBE, 0xEE, 0xEA, 0xCB, 0x34, 0xAE, 0x39,
+    0xC6, 0x62, 0x27, 0x5A, 0xDA, 0x81, 0x9B, 0xE4, 0xCE, 0x8F, 0x1C, 0x0C, 0x9A, 0xD1, 0x0C, 0x5B,
+    0x34, 0x88, 0x1D, 0xAC, 0xBF, 0x2B, 0x1C, 0xFC, 0x6B, 0x6A, 0xB3, 0x9C, 0xFF, 0x06, 0xDB, 0x2C,
+    0x6F, 0xB2, 0xC0, 0xA2, 0x16, 0x8A, 0xE5, 0x44, 0x5D, 0xEE, 0x30, 0xE3, 0x7F, 0x43, 0x2B, 0xD8,
+    0x74, 0x4D, 0x8A, 0x1D, 0x53, 0xED, 0xCF, 0xF5, 0x6E, 0x67, 0x2A, 0x95, 0xA8, 0x8F, 0xEE, 0x4F,
+    0xBC, 0x2C, 0x5D, 0x32, 0x70, 0x33, 0xD0, 0x4A, 0x2F, 0xA0, 0x64, 0x28, 0xA4, 0xA3, 0x5C, 0xA1,
+    0xF7, 0x98, 0x09, 0xEC, 0x90, 0x78, 0x8F, 0x29, 0x1E, 0xAD, 0xC7, 0xDC, 0xC6, 0xAE, 0x16, 0xC0,
+    0x0C, 0x89, 0x87, 0x33, 0xE8, 0x09, 0xA8, 0x7D, 0x19, 0x80, 0xC6, 0x27, 0x20, 0xC3, 0x99, 0x11,
+    0x68, 0x53, 0x3A, 0x92, 0x32, 0x31, 0xBD, 0x60, 0x66, 0xA8, 0x23, 0x46, 0x2E, 0x7E, 0x56, 0xA6,
+    0x8D, 0xB9, 0x54, 0xC9, 0x8E, 0xFF, 0x20, 0x8E, 0x22, 0x07, 0xDF, 0xB9, 0x7B, 0xFC, 0xEC, 0x1D,
+    0x93, 0x09, 0x88, 0x44, 0x8A, 0x6C, 0x8F, 0xE6, 0x64, 0x31, 0xCD, 0xFC, 0x11, 0x1D, 0x6D, 0xAA,
+    0xBF, 0x06, 0xB5, 0x44, 0x68, 0xBB, 0xAB, 0xA8, 0x48, 0x8D, 0x0E, 0x18, 0x57, 0x0D, 0x18, 0x67,
+    0x3C, 0xB5, 0xAB, 0x1D, 0x0D, 0x4D, 0x36, 0xC4, 0xC7, 0x58, 0x57, 0x44, 0xEC, 0xDB, 0x7D, 0x0A,
+    0x7F, 0x30, 0x22, 0xFE, 0x83, 0x1D, 0x0F, 0x67, 0x33, 0x97, 0x71, 0xDD, 0x28, 0x50, 0x66, 0x7D,
+    0xA1, 0x1F, 0xB0, 0x23, 0x26, 0xD0, 0x77, 0x54, 0x41, 0xAD, 0x50, 0x4E, 0xC9, 0x48, 0xE9, 0x09,
+    0xAA, 0x50, 0xAD, 0x92, 0x00, 0x35, 0x91, 0x60, 0x46, 0xA8, 0xC7, 0x64, 0x49, 0xEA, 0x01, 0x5A,
+    0x5F, 0x07, 0x94, 0x38, 0x73, 0x9B, 0x87, 0x52, 0x7D, 0x2E, 0x52, 0x49, 0x0E, 0xF6, 0x64, 0xC8,
+    0x10, 0x2B, 0xAD, 0x4C, 0x80, 0xFA, 0x27, 0xE9, 0xC2, 0x46, 0xE8, 0x65, 0xA0, 0x7D, 0x5B, 0x30,
+    0x83, 0x9A, 0x75, 0xC0, 0xF8, 0x2B, 0xA9, 0xA2, 0x69, 0xBE, 0x2B, 0x22, 0xB1, 0x79, 0xFB, 0xFA,
+    0xE5, 0xE7, 0x03, 0x3A, 0x58, 0xB8, 0xA9, 0xD7, 0x4B, 0xBD, 0x4F, 0xBC, 0x46, 0x59, 0xD2, 0x15,
+    0x55, 0x89, 0x01, 0x73, 0x44, 0x04, 0x15, 0x55, 0x24, 0x49, 0x6C, 0xD6, 0x3A, 0x13, 0xCD, 0xCC,
+    0xBF, 0xC1, 0xED, 0x6F, 0xC1, 0x9A, 0x70, 0xCC, 0x51, 0xBA, 0x92, 0x53, 0x9E, 0x2A, 0x9A, 0x5F,
+    0x17, 0x46, 0xA9, 0x7E, 0xCC, 0x6C, 0x8E, 0x8F, 0xEC, 0x8A, 0x11, 0x11, 0xDF, 0xBC, 0x7D, 0xFD,
+    0x72, 0x67, 0xB3, 0xA0, 0xDC, 0xDC, 0x75, 0xC5, 0x4C, 0x1F, 0xEC, 0x8A, 0x29, 0xC7, 0x72, 0x04,
+    0x93, 0x2F, 0xA9, 0x1E, 0xC1, 0x8E, 0x76, 0x00, 0x3B, 0xB4, 0x1F, 0x33, 0x7E, 0xA4, 0xE8, 0x47,
+    0xE0, 0xB2, 0xAC, 0x50, 0x2C, 0x4A, 0x3A, 0xAA, 0x81, 0xC6, 0xD3, 0x38, 0xCC, 0xC8, 0x15, 0xA8,
+    0x02, 0xDF, 0xD8, 0xCA, 0x85, 0x7A, 0xF7, 0xDB, 0x9E, 0xC4, 0xC2, 0xF4, 0xB9, 0x9C, 0x91, 0x1A,
+    0x0C, 0x9A, 0x2E, 0x11, 0x23, 0x1E, 0x1B, 0x29, 0x04, 0x2B, 0xFF, 0x4B, 0xBF, 0x60, 0x45, 0x24,
+    0xB5, 0x3D, 0x87, 0xCC, 0x38, 0x32, 0x22, 0xEB, 0x49, 0x45, 0x8E, 0xDD, 0xE9, 0xAF, 0xAC, 0xD4,
+    0x63, 0x3D, 0xEA, 0x45, 0x2F, 0xB4, 0x1F, 0x38, 0xF1, 0x7B, 0xE5, 0x5A, 0x9A, 0x53, 0x32, 0xD1,
+    0x73, 0x4F, 0x8A, 0x42, 0x4C, 0x77, 0x52, 0x12, 0x6F, 0x64, 0x46, 0x27, 0x9E, 0x76, 0x00, 0x56,
+    0x05, 0xD6, 0x5F, 0x70, 0x6D, 0xD0, 0xE9, 0x04, 0xD6, 0x6D, 0xF8, 0xC7, 0xB6, 0x07, 0x50, 0xF4,
+    0x32, 0x81, 0x88, 0xB8, 0x6D, 0x16, 0xC3, 0x5D, 0xB7, 0x19, 0x0E, 0x73, 0x4F, 0xFA, 0x31, 0xC5,
+    0x44, 0x39, 0xD2, 0x82, 0xC5, 0x0C, 0xE8, 0x49, 0x9D, 0xF4, 0xA4, 0x57, 0x01, 0xCC, 0xB0, 0x00,
+    0xAB, 0xF5, 0x50, 0xBD, 0x3B, 0x6D, 0x7C, 0xB7, 0x8F, 0xE8, 0x49, 0x4F, 0x0D, 0x2D, 0xDD, 0x27,
+    0xE9, 0x49, 0x07, 0xCE, 0x5C, 0x84, 0x46, 0xC4, 0x6F, 0x5D, 0x57, 0xBF, 0xF6, 0x76, 0x00, 0x96,
+    0xD4, 0x98, 0x58, 0x4C, 0x18, 0x4F, 0x35, 0x72, 0x0C, 0xB5, 0xD7, 0x21, 0xF7, 0x58, 0xB1, 0xAA,
+    0x08, 0x45, 0x34, 0x03, 0x94, 0xA1, 0x67, 0x6B, 0x4D, 0xB4, 0xEF, 0x78, 0xA0, 0x5F, 0x00, 0x25,
+    0x61, 0x77, 0xD6, 0x49, 0xA2, 0xED, 0x40, 0x6E, 0x50, 0x4E, 0xB8, 0x63, 0xA2, 0x15, 0xB5, 0x11,
+    0x48, 0xD4, 0x78, 0x99, 0x81, 0x3A, 0xC1, 0x2D, 0x79, 0x41, 0xAD, 0xB3, 0x8E, 0x72, 0x2A, 0xA7,
+    0xEC, 0x1D, 0xEA, 0x50, 0x07, 0x0A, 0x29, 0x3E, 0x04, 0x10, 0xB8, 0xD7, 0x71, 0xB6, 0x23, 0xA6,
+    0x61, 0x1A, 0x34, 0x8E, 0xAB, 0xE8, 0x80, 0x0E, 0x1C, 0x83, 0x75, 0xB5, 0xA7, 0x98, 0xF5, 0x04,
+    0xB5, 0x6F, 0x81, 0xC5, 0x0C, 0x60, 0xFE, 0x65, 0x04, 0xFA, 0xD6, 0x41, 0x95, 0xD8, 0x4D, 0xCB,
+    0x8E, 0x38, 0x63, 0xA7, 0x1D, 0xAE, 0x6E, 0x87, 0x3C, 0x91, 0x26, 0x3D, 0x56, 0x32, 0xC0, 0xBF,
+    0x97, 0xC6, 0x88, 0x2C, 0x80, 0x5D, 0x81, 0xF2, 0xF6, 0x29, 0x51, 0x44, 0x58, 0xB3, 0x22, 0x15,
+    0xAB, 0x5E, 0x7E, 0x9D, 0x1E, 0x9D, 0x12, 0x97, 0x88, 0xF1, 0xD4, 0x8E, 0x63, 0x74, 0xC8, 0xAB,
+    0xDE, 0xA6, 0x81, 0x01, 0x7A, 0x02, 0xDB, 0xB5, 0xDB, 0xA2, 0xD7, 0xAF, 0x46, 0x60, 0xB5, 0x0E,
+    0xCC, 0xFB, 0x61, 0x5B, 0xF3, 0xF2, 0xE4, 0xD4, 0xF5, 0xC9, 0xA9, 0xA7, 0x90, 0x44, 0xDC, 0xC6,
+    0x02, 0x6A, 0xE3, 0xD6, 0xCC, 0x6C, 0xA5, 0xDB, 0x64, 0x6C, 0x5B, 0xF0, 0xC7, 0xE0, 0xB1, 0x8D,
+    0xAA, 0x69, 0x1D, 0x89, 0x79, 0xDA, 0x76, 0xFC, 0xB6, 0xE3, 0xB7, 0xDD, 0xC7, 0xA4, 0x74, 0xE3,
+    0x36, 0x5D, 0x64, 0x86, 0xC6, 0x71, 0x04, 0xE5, 0xC8, 0x55, 0xF2, 0x68, 0x03, 0xAC, 0xAB, 0x3B,
+    0x12, 0xE7, 0x12, 0x15, 0x53, 0x6B, 0xD5, 0x53, 0x01, 0x30, 0x6F, 0xCD, 0x40, 0xB1, 0xC4, 0x13,
+    0x76, 0x52, 0x42, 0xFE, 0x72, 0x6B, 0x6F, 0x4A, 0xDB, 0x52, 0xDA, 0x9D, 0x7A, 0xBC, 0x12, 0x74,
+    0x91, 0x82, 0x94, 0x7A, 0x01, 0xEE, 0x95, 0xF5, 0xA4, 0x24, 0x9A, 0xF2, 0xBD, 0xF6, 0xAE, 0x11,
+    0x11, 0x11, 0xE2, 0x76, 0x3D, 0x66, 0xC4, 0x8C, 0xE8, 0x79, 0x9B, 0x8F, 0xE1, 0x3E, 0xB1, 0xC7,
+    0x48, 0x0D, 0xBB, 0x49, 0x31, 0x72, 0xCB, 0x6E, 0xEA, 0xD9, 0xCD, 0x4D, 0xBB, 0x59, 0x37, 0x52,
+    0xDB, 0x6E, 0xEA, 0xDB, 0xCD, 0x8D, 0xBB, 0x59, 0x3D, 0x52, 0xEB, 0x6E, 0xEE, 0xDD, 0x4D, 0x92,
+    0x9F, 0x35, 0x24, 0x83, 0x9E, 0x39, 0x8D, 0xCA, 0xAD, 0x48, 0x89, 0x74, 0x91, 0xB3, 0x53, 0xBF,
+    0x6B, 0xF0, 0xD3, 0xF9, 0x1A, 0x17, 0x4E, 0xFA, 0x78, 0x29, 0x43, 0x19, 0x68, 0xBC, 0xF5, 0x88,
+    0x5A, 0xA9, 0x66, 0x33, 0x63, 0x07, 0x7B, 0x97, 0xD4, 0x29, 0x87, 0x72, 0xC6, 0xD1, 0x70, 0x08,
+    0x73, 0x11, 0xD0, 0x83, 0xE9, 0xA8, 0xD9, 0x87, 0xA8, 0x02, 0x7A, 0xAC, 0x3C, 0xB5, 0x3B, 0x80,
+    0x45, 0x4D, 0x94, 0xA1, 0xF4, 0x58, 0x5F, 0x3B, 0xBD, 0xD2, 0xD3, 0x4F, 0x2A, 0x81, 0x60, 0xD2,
+    0xA3, 0xE5, 0xE7, 0x33, 0x3C, 0x63, 0x86, 0x9C, 0xB7, 0x14, 0x71, 0x83, 0x70, 0x77, 0xED, 0x72,
+    0x57, 0xB9, 0xCA, 0xCA, 0xAA, 0x56, 0xB5, 0xEA, 0x55, 0x2F, 0x7A, 0x29, 0x3F, 0x90, 0x20, 0x16,
+    0xEE, 0x2C, 0x25, 0x15, 0x06, 0xC3, 0xA7, 0x79, 0x94, 0x47, 0x38, 0xCF, 0x39, 0xF6, 0xD8, 0xE3,
+    0x90, 0x3D, 0x35, 0x73, 0xF0, 0xFB, 0x13, 0x8D, 0x04, 0xAA, 0xDB, 0x99, 0x0D, 0xA5, 0x87, 0xC4,
+    0x32, 0x2B, 0xFD, 0xDF, 0xF4, 0xCC, 0xAB, 0xE5, 0xA4, 0xCF, 0x6E, 0x20, 0xD1, 0x17, 0x33, 0xCF,
+    0x4D, 0x77, 0x90, 0x8A, 0x0D, 0x89, 0x22, 0xC0, 0x63, 0xD7, 0xBF, 0x89, 0xC8, 0x58, 0x76, 0xA9,
+    0xFE, 0x34, 0xA5, 0xD3, 0xCB, 0xFD, 0xC9, 0xDB, 0x0C, 0x84, 0xA3, 0x3B, 0xC9, 0xAD, 0x31, 0xB1,
+    0x39, 0x75, 0x07, 0xBF, 0xB1, 0xD5, 0x5A, 0x9A, 0x0E, 0xD0, 0x73, 0x92, 0xC9, 0xB6, 0x6B, 0x1D,
+    0x60, 0xA6, 0x6C, 0x27, 0x9F, 0x94, 0x7F, 0x93, 0xC0, 0x86, 0x66, 0x4C, 0x5C, 0xA2, 0x98, 0xDB,
+    0x1C, 0x3D, 0x73, 0xBA, 0x34, 0x93, 0x82, 0x6D, 0x95, 0xF9, 0x52, 0x4D, 0x5A, 0x05, 0x3D, 0xA6,
+    0x4C, 0xEF, 0x4A, 0x5A, 0xB3, 0x4A, 0x6E, 0x83, 0xF5, 0x88, 0x44, 0xCA, 0x09, 0xD3, 0x95, 0x81,
+    0x1E, 0x35, 0x61, 0xF2, 0x7B, 0x26, 0x24, 0xC5, 0xA4, 0xCD, 0xC8, 0x55, 0x54, 0xD0, 0x4B, 0xA2,
+    0xCF, 0xB7, 0x9E, 0x48, 0x33, 0x54, 0x31, 0x31, 0x33, 0xA4, 0x53, 0x22, 0x42, 0x3D, 0xD1, 0x88,
+    0x78, 0x2D, 0x68, 0x91, 0x6B, 0x59, 0xCE, 0xB7, 0x3E, 0x54, 0x6F, 0x3C, 0xB4, 0xB4, 0x5B, 0x24,
+    0x57, 0x87, 0x3A, 0x80, 0x78, 0xF9, 0x78, 0x66, 0x45, 0xD3, 0x81, 0xE1, 0x18, 0x38, 0xD4, 0x01,
+    0x8A, 0xD1, 0x78, 0x30, 0xEE, 0x2A, 0x70, 0x58, 0xCC, 0x50, 0x04, 0x23, 0xB7, 0x31, 0x9D, 0xBD,
+    0xDE, 0xB3, 0xCF, 0xCC, 0xA3, 0x2A, 0x94, 0x03, 0x7B, 0xC6, 0x37, 0xA8, 0x70, 0x40, 0xC4, 0x7C,
+    0x77, 0xD2, 0x41, 0x2D, 0x95, 0xAF, 0x45, 0x82, 0xA5, 0x17, 0x51, 0xB3, 0x16, 0xB9, 0x56, 0x9E,
+    0x60, 0x33, 0x37, 0x3F, 0x94, 0x8F, 0xD9, 0x67, 0x3E, 0xE6, 0x40, 0x9B, 0x81, 0xAC, 0xB4, 0xA4,
+    0x1B, 0x1F, 0xD3, 0x9D, 0xE6, 0x63, 0x6E, 0xD0, 0xF7, 0x87, 0xF2, 0x31, 0xA7, 0x53, 0xAC, 0xF6,
+    0x8F, 0xE2, 0x63, 0xB6, 0xE3, 0x69, 0x3E, 0x66, 0x21, 0x0E, 0x6C, 0xD8, 0x9A, 0x65, 0xCC, 0xF2,
+    0x77, 0xB0, 0x13, 0x85, 0xAC, 0xD8, 0x69, 0xF7, 0x11, 0xF5, 0x06, 0xB3, 0x27, 0xE3, 0xD6, 0xDC,
+    0xBA, 0x23, 0x64, 0xF9, 0x0C, 0xC6, 0xF1, 0x0A, 0xA6, 0x2B, 0x02, 0xA5, 0xAF, 0x3C, 0x7A, 0x6C,
+    0x40, 0x87, 0x23, 0x50, 0xBF, 0x0A, 0x80, 0x0C, 0xBB, 0xD9, 0x59, 0x9B, 0xB3, 0x2E, 0xA5, 0x83,
+    0xFA, 0x4D, 0x0F, 0xAD, 0x19, 0x51, 0x4B, 0x15, 0x52, 0x38, 0x5C, 0x0F, 0x7A, 0xED, 0xDA, 0x2E,
+    0xD5, 0xD0, 0x65, 0x3C, 0xF1, 0x21, 0x56, 0xE4, 0x5D, 0x91, 0xA5, 0x17, 0xF1, 0x77, 0xFE, 0x29,
+    0xF2, 0x75, 0x11, 0x91, 0xEF, 0x89, 0x88, 0x84, 0xC7, 0xAE, 0x5F, 0xBF, 0x7E, 0xFD, 0xFA, 0xF5,
+    0xE7, 0x53, 0x15, 0x60, 0x4E, 0x20, 0xFB, 0xC9, 0xF8, 0x32, 0x35, 0x30, 0x62, 0x28, 0x3B, 0xF6,
+    0x38, 0x8F, 0x1A, 0x09, 0x54, 0xAE, 0xF4, 0xA7, 0x1F, 0x69, 0xCF, 0x1E, 0x8F, 0x42, 0x60, 0xA2,
+    0xEA, 0x4E, 0x1E, 0xDD, 0xA0, 0xEC, 0xB4, 0xE7, 0x3C, 0xF5, 0x1D, 0x8F, 0x0C, 0x04, 0x9E, 0x43,
+    0x7B, 0x3D, 0x70, 0xE1, 0xE4, 0x51, 0x31, 0xF0, 0x28, 0x06, 0x6E, 0x70, 0x98, 0xAB, 0x13, 0x89,
+    0xE7, 0x1F, 0xCD, 0xD6, 0xBD, 0x72, 0xB7, 0xF0, 0x89, 0xA4, 0xE9, 0x06, 0x22, 0x43, 0xBF, 0xD5,
+    0x5A, 0x4C, 0x54, 0xE2, 0x6C, 0xD0, 0x91, 0xB6, 0x33, 0xA1, 0x58, 0x93, 0x09, 0xEF, 0xBD, 0x99,
+    0x0B, 0xC1, 0x0E, 0xD5, 0x8C, 0x50, 0x87, 0x0D, 0x25, 0xFB, 0xF0, 0x57, 0xB7, 0xAF, 0x8B, 0x33,
+    0xD1, 0x8E, 0x4A, 0xCA, 0x88, 0x1D, 0xA5, 0x2B, 0x63, 0x1D, 0x90, 0xA7, 0x16, 0x4C, 0x68, 0x7D,
+    0xB1, 0xEE, 0x30, 0xFB, 0x7F, 0x3B, 0x13, 0x16, 0xF7, 0xD9, 0xCD, 0xFC, 0x62, 0x4E, 0xC6, 0x67,
+    0x37, 0x68, 0x21, 0xDB, 0xCB, 0xD2, 0xC3, 0x43, 0x12, 0x1B, 0x91, 0xD8, 0xCA, 0x0B, 0xCF, 0xDC,
+    0x41, 0x3C, 0xFF, 0x84, 0x6F, 0xAF, 0x3C, 0x1F, 0xCA, 0x5B, 0xDF, 0xCF, 0x8C, 0xB5, 0x4F, 0x65,
+    0x10, 0x29, 0x0F, 0xD7, 0x29, 0x76, 0x0C, 0xC6, 0xFD, 0x6D, 0xAE, 0xD6, 0x9D, 0x13, 0x57, 0x4A,
+    0xBF, 0x15, 0x31, 0x5E, 0xD9, 0x38, 0xF2, 0x7F, 0x20, 0x81, 0x54, 0x51, 0xF8, 0xE5, 0xA5, 0xF4,
+    0x45, 0x09, 0x64, 0xFB, 0xB8, 0x8F, 0xBA, 0xFD, 0x62, 0x1A, 0x69, 0x22, 0x22, 0xA8, 0x4B, 0xF3,
+    0xF6, 0x51, 0xF5, 0x86, 0x2E, 0xEA, 0x91, 0xBB, 0x3F, 0xAA, 0xEC, 0xB6, 0x26, 0xC7, 0xBF, 0x73,
+    0xB2, 0x9D, 0x39, 0x4D, 0x1B, 0xB1, 0x22, 0x5D, 0x21, 0xB2, 0x64, 0xC2, 0x65, 0x72, 0x76, 0x92,
+    0xFA, 0x83, 0x44, 0x24, 0x94, 0x22, 0xD2, 0x59, 0x91, 0x55, 0x6D, 0xB4, 0xE0, 0xA1, 0xCD, 0x15,
+    0x85, 0x58, 0x8B, 0x48, 0xF8, 0xCF, 0xAE, 0x5F, 0xBF, 0xEE, 0xA0, 0xE8, 0x58, 0xB0, 0x53, 0x2D,
+    0x46, 0x9E, 0xBA, 0xCD, 0x98, 0xA2, 0xC2, 0xB5, 0x7E, 0x6B, 0x69, 0x87, 0xED, 0xDE, 0x9A, 0xD7,
+    0x4E, 0x9B, 0xC1, 0x67, 0x51, 0x5F, 0x46, 0x8D, 0x9C, 0xFD, 0x0D, 0xB4, 0xE7, 0x53, 0x9F, 0xC2,
+    0xC0, 0xE7, 0xFE, 0x1B, 0xF6, 0xE0, 0xB7, 0xFF, 0x90, 0x09, 0x1E, 0xFF, 0x4A, 0x31, 0x80, 0x1D,
+    0xAB, 0x0E, 0xEA, 0xAE, 0x3E, 0xD5, 0x52, 0x16, 0x76, 0x6D, 0x06, 0xB9, 0x6B, 0xFB, 0x02, 0x3B,
+    0x74, 0x35, 0x8D, 0x34, 0x4B, 0x0C, 0x57, 0xF3, 0x77, 0xFF, 0xE3, 0x7B, 0xE0, 0xE0, 0x81, 0x07,
+    0xFE, 0x2E, 0xC4, 0x7F, 0xE7, 0xEF, 0x7D, 0x03, 0x1D, 0x7E, 0xF7, 0x7F, 0xFF, 0x5D, 0x2A, 0xFF,
+    0x1F, 0xFC, 0xB7, 0x23, 0x8D, 0xBB, 0x50, 0x76, 0x3C, 0xB0, 0x4D, 0x8B, 0x30, 0x11, 0x71, 0x4D,
+    0xD0, 0x0B, 0xAD, 0xCF, 0x75, 0x68, 0x68, 0x7F, 0x2C, 0xCE, 0x06, 0xF1, 0x66, 0xB2, 0x43, 0x15,
+    0x9B, 0xA0, 0x17, 0x33, 0x29, 0xA9, 0x66, 0x44, 0x47, 0xFA, 0xE7, 0xD7, 0x3B, 0xFC, 0xBA, 0x76,
+    0xBF, 0x49, 0x54, 0xB3, 0x0E, 0x57, 0x89, 0x6A, 0x6A, 0x38, 0x20, 0x9A, 0xAE, 0x66, 0x5F, 0xFB,
+    0xAA, 0xAB, 0x8B, 0x41, 0x77, 0xD5, 0x4E, 0xCD, 0x5F, 0xB4, 0x45, 0x30, 0xDD, 0x91, 0xF6, 0x8F,
+    0x24, 0xE6, 0x3D, 0x2F, 0x5A, 0x1D, 0x9A, 0x62, 0x32, 0x6E, 0xAE, 0xFC, 0x91, 0xF6, 0x7B, 0x6A,
+    0x78, 0x64, 0xF7, 0xC1, 0x5D, 0xC5, 0x6F, 0xEA, 0x60, 0xBC, 0xF1, 0x47, 0x6A, 0xD2, 0xC1, 0x38,
+    0xCB, 0x95, 0x22, 0x94, 0xDE, 0x74, 0x7B, 0x4C, 0x2A, 0x54, 0xEE, 0x41, 0xCE, 0x6D, 0x9E, 0xC5,
+    0xD1, 0x74, 0xBC, 0x3B, 0x54, 0xAF, 0x4F, 0xD6, 0x2D, 0x00, 0xF7, 0x51, 0xFA, 0x62, 0x52, 0x91,
+    0x63, 0x2C, 0x55, 0x48, 0x3D, 0x05, 0xD5, 0x84, 0x85, 0xC0, 0x19, 0xA0, 0x84, 0x03, 0x54, 0xA4,
+    0x98, 0x28, 0x03, 0xC6, 0xB3, 0xD2, 0x24, 0xC5, 0x35, 0x9E, 0x1B, 0xA8, 0x2D, 0x08, 0xDC, 0xBA,
+    0x46, 0xAA, 0xF0, 0x98, 0x03, 0x3B, 0xA2, 0x63, 0xEB, 0xA1, 0x8C, 0x14, 0x6B, 0xDF, 0x25, 0xCA,
+    0x45, 0x42, 0xDA, 0x9B, 0x29, 0x17, 0x8F, 0xB5, 0xE4, 0xD6, 0x20, 0xFA, 0x41, 0x6F, 0xFC, 0x9D,
+    0x14, 0xD8, 0xA1, 0xE5, 0x0B, 0x72, 0x82, 0xF0, 0x02, 0xD4, 0xDF, 0x97, 0x35, 0x4D, 0xF0, 0xFB,
+    0xB9, 0xAC, 0xD0, 0x78, 0xCA, 0xD9, 0xAE, 0x60, 0x46, 0xF4, 0x5A, 0x4B, 0x8A, 0x80, 0xE5, 0xB2,
+    0x8C, 0x29, 0x5C, 0xB4, 0xDB, 0x74, 0x87, 0x76, 0xAB, 0x71, 0xF4, 0x73, 0x2E, 0x83, 0x48, 0x26,
+    0xF8, 0x29, 0x99, 0xB4, 0x0C, 0x39, 0x29, 0x6B, 0x63, 0x6E, 0xEF, 0x34, 0xD2, 0xA5, 0x64, 0xF1,
+    0xAC, 0x84, 0xD4, 0x1A, 0x5E, 0xA5, 0x42, 0xF3, 0x80, 0xDE, 0x5A, 0xDC, 0x8B, 0x5D, 0xD8, 0xB6,
+    0x33, 0xCD, 0x1B, 0x3E, 0xAC, 0xAE, 0xC1, 0x7E, 0xD2, 0xC8, 0x08, 0xC6, 0x51, 0x04, 0xB0, 0x49,
+    0xF1, 0x8E, 0xC1, 0x78, 0x52, 0x8A, 0xBB, 0xF9, 0xCE, 0x2A, 0x35, 0xEC, 0xD4, 0x03, 0x89, 0x67,
+    0x47, 0x39, 0xC1, 0xE5, 0x93, 0xF6, 0x3A, 0x9F, 0xAE, 0xAB, 0xA3, 0x99, 0xD0, 0xE2, 0x36, 0x74,
+    0x77, 0x27, 0xE7, 0x45, 0xD8, 0xA8, 0xBB, 0xBD, 0x74, 0xB9, 0x58, 0xF5, 0xCE, 0x9B, 0x11, 0x63,
+    0x5E, 0x8D, 0x60, 0xBA, 0x05, 0x6A, 0xB7, 0x40, 0xC3, 0x02, 0x56, 0x45, 0x68, 0x8B, 0x19, 0x6E,
+    0xEA, 0x00, 0x8B, 0x19, 0x21, 0x36, 0x1E, 0x15, 0x25, 0x0F, 0xFA, 0xD0, 0xE9, 0xA2, 0x7D, 0x6E,
+    0x74, 0xC9, 0xC3, 0x5D, 0xB6, 0xF1, 0x11, 0xCD, 0xB0, 0x6B, 0x4E, 0xB8, 0x23, 0x14, 0x51, 0xEB,
+    0xD6, 0xFA, 0xA3, 0x17, 0xF2, 0xD8, 0x0B, 0x13, 0x37, 0x16, 0x63, 0x13, 0x81, 0x07, 0x9E, 0x49,
+    0xF5, 0xEE, 0xA9, 0x4F, 0x2D, 0x49, 0x00, 0x4F, 0x70, 0xF6, 0x8B, 0xE8, 0xD7, 0xC6, 0x72, 0xE8,
+    0x65, 0xAC, 0x64, 0xE0, 0x3F, 0x71, 0x80, 0xEA, 0x48, 0xED, 0x4C, 0xEA, 0x8D, 0x2F, 0x80, 0x7A,
+    0xFF, 0x95, 0xCC, 0x71, 0xA2, 0x9D, 0xA0, 0xFC, 0x3F, 0xF6, 0x40, 0xDD, 0x07, 0xF0, 0xB0, 0x82,
+    0xCF, 0x51, 0xC2, 0x13, 0xFF, 0xD6, 0xD3, 0xF7, 0x9E, 0xFF, 0xDD, 0x5F, 0xBC, 0x7D, 0xA3, 0xFA,
+    0xE7, 0xEE, 0xB2, 0x53, 0x33, 0xFD, 0x50, 0xBD, 0xF3, 0x85, 0x7F, 0x34, 0x3F, 0xF7, 0xC6, 0xFF,
+    0xF6, 0xF9, 0xFB, 0xF1, 0x3C, 0x91, 0x3E, 0xF2, 0x54, 0x9F, 0xF8, 0x78, 0xD2, 0x9A, 0x61, 0x76,
+    0x03, 0xB3, 0xE0, 0x46, 0xEE, 0x47, 0xDD, 0x8C, 0x62, 0xEE, 0x5A, 0xDA, 0x63, 0xC7, 0x72, 0xFE,
+    0x04, 0x46, 0xA5, 0x76, 0x1B, 0x73, 0x3E, 0xF9, 0x8F, 0x0C, 0xF2, 0x54, 0xFE, 0xA4, 0x19, 0xE2,
+    0x33, 0x1F, 0xC0, 0xDC, 0x3A, 0xCE, 0xCA, 0x35, 0x54, 0x6A, 0xA3, 0x0B, 0x34, 0xEF, 0xC9, 0x58,
+    0xBF, 0x27, 0x81, 0x88, 0xF5, 0x0B, 0xCD, 0x50, 0x38, 0xEC, 0x93, 0xB9, 0x2C, 0xBF, 0xE4, 0x30,
+    0x4C, 0x4F, 0x79, 0x36, 0x88, 0xF1, 0x39, 0xBE, 0x6F, 0x37, 0x12, 0xD8, 0x9C, 0x8F, 0xD4, 0x3E,
+    0xC7, 0xF7, 0x4B, 0x0E, 0xEC, 0xCD, 0xC8, 0x06, 0xE3, 0xE6, 0xA1, 0x68, 0x21, 0xFD, 0x94, 0x02,
+    0x0F, 0xAD, 0x49, 0x15, 0x94, 0x8C, 0x69, 0x0F, 0x13, 0x33, 0x70, 0x38, 0x35, 0xD3, 0x43, 0x72,
+    0x32, 0x50, 0xC6, 0x2C, 0x0D, 0xCD, 0x78, 0xEA, 0x88, 0x9E, 0x41, 0x5D, 0xFC, 0x50, 0x6C, 0x6E,
+    0x3A, 0x45, 0x69, 0x49, 0x73, 0xE2, 0x5C, 0x12, 0x22, 0xBD, 0x64, 0xF1, 0xA9, 0xC3, 0xA9, 0x79,
+    0x66, 0x77, 0x00, 0x03, 0x0F, 0x5C, 0xDC, 0xC5, 0x8D, 0xA9, 0x75, 0x5E, 0xAD, 0x4F, 0x4A, 0x67,
+    0xDC, 0x13, 0x54, 0xA1, 0xF4, 0xE4, 0xCE, 0x23, 0xAC, 0x4B, 0xB3, 0xCA, 0x8E, 0x80, 0x32, 0xA4,
+    0x75, 0x30, 0x1D, 0xA8, 0x98, 0x08, 0x38, 0x3A, 0x00, 0x42, 0xE2, 0x22, 0xDD, 0x04, 0x25, 0x58,
+    0x47, 0x21, 0x18, 0x4F, 0x25, 0x54, 0x81, 0x6A, 0x45, 0xCF, 0xE8, 0x65, 0x6B, 0x5B, 0xED, 0xA1,
+    0xED, 0xB0, 0x9E, 0x66, 0xC0, 0x8C, 0x98, 0x40, 0x35, 0xA1, 0x23, 0xEA, 0xE8, 0x03, 0xF9, 0x71,
+    0xDB, 0x51, 0x0D, 0xD8, 0x11, 0x3D, 0x51, 0x4F, 0x14, 0x11, 0xB3, 0x80, 0x50, 0x0A, 0xF4, 0xBE,
+    0x90, 0xBB, 0x88, 0x3E, 0x67, 0x2E, 0x72, 0x2A, 0x2C, 0xCD, 0x95, 0x49, 0xBD, 0x14, 0xE2, 0x40,
+    0x3D, 0x92, 0x16, 0x32, 0xA4, 0xBD, 0x3B, 0x48, 0xB9, 0xA3, 0x1E, 0x92, 0x16, 0x1C, 0xE6, 0x36,
+    0xC0, 0xD4, 0x39, 0xCA, 0x9C, 0x26, 0xB2, 0xD4, 0x2E, 0xBD, 0x28, 0xA4, 0xA4, 0xCE, 0xA6, 0x85,
+    0xAE, 0xC6, 0xB4, 0x51, 0x4B, 0xC2, 0x3D, 0x8C, 0x2F, 0xC5, 0x43, 0x11, 0x49, 0x63, 0x19, 0xBA,
+    0x3A, 0xD9, 0x8E, 0x64, 0xCD, 0xFA, 0x6D, 0x6C, 0x6C, 0x4A, 0x03, 0x97, 0xDC, 0xF3, 0xEC, 0xB7,
+    0x09, 0xB3, 0x97, 0x00, 0x3E, 0x7B, 0x77, 0x06, 0x62, 0x3C, 0xD0, 0x0C, 0x45, 0x4C, 0xBA, 0x6F,
+    0x53, 0x7C, 0x97, 0x78, 0x23, 0x11, 0xD9, 0xBA, 0x97, 0x36, 0xB8, 0xEE, 0x03, 0xD9, 0x6E, 0xE6,
+    0xE1, 0x65, 0xA2, 0xDD, 0xC0, 0x89, 0x36, 0x6D, 0x7D, 0x05, 0x49, 0xC3, 0x36, 0x15, 0x4D, 0x21,
+    0xD2, 0xAE, 0xBD, 0xCA, 0xA4, 0x01, 0x39, 0xE9, 0xFD, 0x8B, 0x1E, 0x01, 0xFA, 0x27, 0x73, 0x63,
+    0x63, 0x9E, 0x1B, 0xF4, 0xA1, 0xEF, 0x4F, 0x5A, 0x9A, 0xDD, 0xD6, 0x36, 0x4E, 0x5A, 0xE7, 0x89,
+    0x47, 0x81, 0x13, 0xED, 0xDD, 0x7D, 0xFF, 0xD5, 0x6C, 0x90, 0xF3, 0xFB, 0x9F, 0x4E, 0x74, 0xAC,
+    0xD7, 0x52, 0x33, 0xE9, 0x0F, 0x52, 0xC7, 0x47, 0x48, 0x53, 0x91, 0x27, 0x7B, 0xD2, 0x09, 0xB5,
+    0xBB, 0xBB, 0xF3, 0xFD, 0x09, 0xD5, 0xDD, 0xBE, 0xBF, 0xCA, 0xDF, 0x1F, 0x38, 0x69, 0xC4, 0x48,
+    0x88, 0xC1, 0xC6, 0x0A, 0xDC, 0x8D, 0xF8, 0x78, 0xFC, 0xAE, 0x15, 0x7C, 0x80, 0xFB, 0x1E, 0xD6,
+    0xCE, 0xFF, 0x97, 0x9F, 0xFA, 0xF4, 0xE3, 0xFE, 0x8D, 0x73, 0x8F, 0xE8, 0xAF, 0x0E, 0x2F, 0xD7,
+    0x37, 0x11, 0x9F, 0x72, 0xB6, 0xFB, 0xD8, 0xE3, 0xFF, 0xD6, 0xFF, 0xE8, 0xD3, 0x4F, 0xEC, 0xFD,
+    0xC3, 0x76, 0x25, 0x10, 0xD4, 0x08, 0x98, 0xB5, 0xE8, 0x78, 0x1C, 0x0D, 0xED, 0xA0, 0x4A, 0xC7,
+    0x13, 0x94, 0x4F, 0xFE, 0x0F, 0xC1, 0x2E, 0xC5, 0x0A, 0xAD, 0xBF, 0xC1, 0x8B, 0xFC, 0x2E, 0x17,
+    0xA2, 0x79, 0xEA, 0xF9, 0xEE, 0x7F, 0xF6, 0x4F, 0x3C, 0x7B, 0xCE, 0x2C, 0xFC, 0xD3, 0x04, 0x43,
+    0x3D, 0xCC, 0x1E, 0xCF, 0x12, 0xD4, 0xA8, 0x7D, 0xD9, 0x19, 0xD7, 0xA4, 0x45, 0x7D, 0xD0, 0x7D,
+    0xFA, 0x37, 0x8B, 0xEE, 0xC5, 0xC7, 0xEF, 0x2B, 0x7E, 0xD8, 0x99, 0xB1, 0x7A, 0xFA, 0x49, 0xBF,
+    0x77, 0x4E, 0x7F, 0xED, 0x2F, 0x42, 0x35, 0xC3, 0x31, 0xCF, 0x3E, 0x7B, 0x9F, 0xFE, 0xAA, 0x7F,
+    0xE2, 0xF3, 0xFA, 0x6B, 0xFE, 0x86, 0x11, 0x1E, 0x78, 0x91, 0x47, 0x4A, 0xE9, 0xFA, 0x01, 0x50,
+    0x17, 0x51, 0x7F, 0x91, 0x63, 0x4C, 0x2D, 0x4F, 0x46, 0xDA, 0xAE, 0xF2, 0x66, 0xE4, 0x88, 0x88,
+    0xF1, 0xB5, 0x27, 0xEA, 0xC4, 0x55, 0x2E, 0xE6, 0x32, 0x60, 0x9D, 0x50, 0x06, 0x33, 0xD2, 0x17,
+    0x4B, 0x1A, 0x38, 0xB6, 0xEA, 0x48, 0x3D, 0xF4, 0x9D, 0x5E, 0xE0, 0xEC, 0x8C, 0xEE, 0x5E, 0x24,
+    0x94, 0x9C, 0xE3, 0x2B, 0xFA, 0xF9, 0xD2, 0xDD, 0x78, 0xF9, 0x65, 0x63, 0x0C, 0xE1, 0xC7, 0x63,
+    0xCD, 0x7E, 0x11, 0x4A, 0xDF, 0xA8, 0xB9, 0x58, 0x85, 0x5A, 0x06, 0x64, 0xA6, 0x48, 0xD0, 0xE4,
+    0x05, 0xFE, 0x1F, 0x1E, 0xE6, 0x09, 0x1E, 0xE7, 0x2B, 0xBC, 0xCC, 0xA8, 0x86, 0x66, 0xB5, 0x09,
+    0xEE, 0xE4, 0x73, 0x06, 0xCE, 0xC1, 0x48, 0x95, 0x93, 0xC3, 0x19, 0xEB, 0x0A, 0x09, 0x46, 0x7C,
+    0xB1, 0x72, 0xFF, 0xE7, 0x51, 0x9E, 0x67, 0xF5, 0x82, 0x1A, 0x30, 0x30, 0xDE, 0xFF, 0x5F, 0xE4,
+    0xCB, 0x2A, 0xD0, 0xBE, 0x18, 0x8B, 0xC7, 0x8B, 0x87, 0x8B, 0xAA, 0x90, 0xE1, 0xA5, 0xC8, 0xB3,
+    0x29, 0xCF, 0x02, 0x19, 0xBE, 0xCC, 0xE3, 0x7C, 0x8A, 0x72, 0x41, 0x0D, 0x3C, 0x7B, 0xFF, 0x61,
+    0xBD, 0xE4, 0x11, 0x51, 0x94, 0xB1, 0x18, 0xF8, 0x0A, 0xF7, 0xA1, 0xDE, 0x19, 0x2E, 0x54, 0xDA,
+    0x7F, 0xE5, 0xF1, 0x52, 0x7F, 0x75, 0x6C, 0x22, 0xC7, 0x69, 0xE9, 0x1F, 0xE1, 0xDC, 0x6E, 0xE9,
+    0x7D, 0x5E, 0xFA, 0x0B, 0xD7, 0x74, 0xE7, 0x1F, 0x2E, 0xF9, 0xCA, 0xB3, 0xF4, 0xAE, 0xFA, 0x4F,
+    0x09, 0x0F, 0x97, 0xEE, 0xE5, 0x47, 0xCB, 0xCE, 0xCE, 0x3C, 0x00, 0xDC, 0xE4, 0xF1, 0xBD, 0x4F,
+    0x17, 0xDE, 0x9F, 0x7B, 0x58, 0xFB, 0x9F, 0xCC, 0xA5, 0x38, 0xBE, 0xC2, 0xA3, 0x5A, 0x7C, 0x3B,
+    0x9E, 0x82, 0xEE, 0xA8, 0xB6, 0xA2, 0xF8, 0x98, 0x04, 0xB0, 0x08, 0xD9, 0x5C, 0xCF, 0x59, 0xF6,
+    0xAF, 0x64, 0xA9, 0xAD, 0xDD, 0x49, 0x05, 0x5D, 0x87, 0x53, 0x2F, 0xB0, 0xF9, 0x93, 0xCA, 0x21,
+    0xEB, 0x4E, 0xCC, 0x0E, 0x70, 0x7B, 0x52, 0x4D, 0xF9, 0x63, 0x9A, 0xEC, 0x08, 0x8B, 0x29, 0xB3,
+    0x94, 0xEB, 0x3B, 0xBA, 0x9B, 0xB2, 0x42, 0xE8, 0x90, 0xA5, 0x3E, 0x2B, 0x09, 0x07, 0xF9, 0x95,
+    0x95, 0x3F, 0xF5, 0xCD, 0xDB, 0xE7, 0x7D, 0xE8, 0x29, 0x1D, 0x6C, 0x07, 0x73, 0xD5, 0xBF, 0x1A,
+    0x72, 0xF6, 0x76, 0xF7, 0x05, 0xC6, 0xFC, 0x73, 0x74, 0xEA, 0xE7, 0xF8, 0xAE, 0x9F, 0xA3, 0x53,
+    0xAF, 0x4B, 0x1C, 0x4A, 0x54, 0x4C, 0x1E, 0x36, 0xA9, 0xAA, 0x7A, 0xF1, 0x77, 0x92, 0xF9, 0xBA,
+    0x92, 0x3C, 0x7D, 0x9A, 0x06, 0x95, 0xCC, 0x50, 0x93, 0x8C, 0xCA, 0x7E, 0xE9, 0x4F, 0x1A, 0x55,
+    0x4A, 0xC9, 0x45, 0x36, 0xF1, 0x50, 0xC8, 0xAD, 0x9B, 0x1D, 0x18, 0xE9, 0x26, 0xC0, 0x4A, 0x22,
+    0xB1, 0xAE, 0x7A, 0x80, 0x62, 0x3D, 0xAA, 0x3C, 0x94, 0x71, 0x32, 0x0E, 0xCC, 0xCF, 0x83, 0x05,
+    0xEA, 0xB7, 0x86, 0x43, 0xC0, 0x7E, 0xCF, 0xCF, 0x80, 0xFD, 0xFA, 0x93, 0x01, 0xE8, 0x5B, 0x3D,
+    0x02, 0x72, 0x5C, 0x7A, 0x40, 0x92, 0xDF, 0x93, 0xD0, 0xA4, 0xE0, 0x76, 0x1F, 0x87, 0x92, 0x75,
+    0xB9, 0xEC, 0x77, 0xC3, 0x98, 0x32, 0xAA, 0x90, 0x1A, 0x70, 0xB7, 0xBB, 0xC4, 0xF5, 0x29, 0x7E,
+    0x2E, 0x72, 0x0B, 0xF4, 0x70, 0xF8, 0x91, 0x57, 0x73, 0x25, 0x5D, 0xCD, 0x2B, 0xD5, 0x5D, 0xEE,
+    0xE0, 0xE3, 0xBB, 0xEF, 0x97, 0x53, 0xDD, 0xF7, 0xA7, 0xFA, 0xEE, 0x73, 0x63, 0xFD, 0xD6, 0x7D,
+    0xAF, 0x9E, 0x74, 0xD8, 0x8E, 0xF7, 0x27, 0x9A, 0x81, 0x36, 0x62, 0x26, 0x6C, 0x87, 0x5E, 0x30,
+    0x1D, 0x4A, 0x7C, 0xE9, 0xA1, 0x8D, 0x3A, 0xDC, 0x4F, 0x2D, 0xB7, 0xD7, 0x78, 0x67, 0xF7, 0xBD,
+    0xBD, 0xAB, 0xFB, 0x7E, 0x86, 0x42, 0xE4, 0x5F, 0x7D, 0xC0, 0xED, 0x3C, 0xE0, 0xC8, 0x9C, 0xC4,
+    0x52, 0x24, 0x40, 0x7F, 0xAB, 0x1C, 0xD1, 0x33, 0xC5, 0x16, 0xDB, 0x1D, 0x9E, 0x8A, 0xEA, 0x36,
+    0xD2, 0x68, 0x47, 0x29, 0xB2, 0xE4, 0x2E, 0xEA, 0x2D, 0x12, 0x74, 0xC0, 0xBD, 0xFD, 0xF5, 0x6F,
+    0xE7, 0xDA, 0xDD, 0x36, 0xC1, 0xCF, 0xEF, 0x06, 0x3A, 0xA5, 0xA6, 0xFA, 0x54, 0x95, 0x9A, 0x01,
+    0xB3, 0xBA, 0x04, 0x06, 0xFD, 0x34, 0xED, 0xC5, 0x46, 0xB9, 0xCD, 0x61, 0x44, 0xA2, 0xFB, 0x9A,
+    0x3C, 0xF8, 0x65, 0x4D, 0x15, 0x8B, 0xC6, 0x27, 0x8E, 0x7D, 0x04, 0x23, 0x1D, 0xB6, 0x43, 0x49,
+    0x4C, 0x2D, 0x18, 0xE2, 0x91, 0x34, 0xD2, 0xAE, 0x1E, 0xA1, 0x7D, 0x69, 0x28, 0x16, 0xA8, 0x7E,
+    0xB9, 0xA6, 0x2E, 0x0C, 0x13, 0x52, 0xFF, 0x85, 0xD0, 0xBB, 0xCC, 0x2C, 0x9D, 0x9B, 0x74, 0x5F,
+    0xBC, 0xB4, 0x7E, 0x67, 0xED, 0xDF, 0xBE, 0x86, 0x78, 0xFB, 0x5A, 0x04, 0x33, 0xEB, 0xD8, 0x76,
+    0x28, 0x71, 0xF6, 0xFB, 0x13, 0xD8, 0x50, 0xAC, 0x02, 0x5A, 0xA8, 0x25, 0x40, 0x3B, 0x22, 0x0B,
+    0x98, 0x05, 0x23, 0x1E, 0xC4, 0xD3, 0x47, 0x68, 0x62, 0xEA, 0xEA, 0x86, 0xC4, 0xA8, 0xB5, 0x22,
+    0x1E, 0xEA, 0xB7, 0xF3, 0xE8, 0x90, 0xDE, 0xE5, 0x7A, 0x8D, 0x8A, 0xA8, 0x34, 0x9A, 0x59, 0xC6,
+    0x36, 0x11, 0x05, 0x52, 0xDF, 0x5E, 0x15, 0x68, 0x87, 0x6D, 0x14, 0x87, 0x6C, 0xC5, 0xCF, 0x6B,
+    0x60, 0xDF, 0xFB, 0xD6, 0x8E, 0xFF, 0x5C, 0x9D, 0x1A, 0xBF, 0x90, 0x49, 0x75, 0x09, 0x2D, 0x4C,
+    0x94, 0xB1, 0x14, 0x33, 0x66, 0x81, 0xCA, 0x1C, 0x75, 0x0F, 0xBB, 0xF9, 0x85, 0xBB, 0x61, 0xB5,
+    0x6A, 0xC3, 0xD1, 0xFE, 0xD9, 0x4B, 0x21, 0xC7, 0xF5, 0x89, 0x2E, 0xFC, 0xE9, 0xB4, 0x8D, 0x94,
+    0x2E, 0x6D, 0x6A, 0xE1, 0x77, 0x2D, 0x8D, 0x47, 0xD9, 0xF5, 0xF6, 0x50, 0xDD, 0xE6, 0xC2, 0x97,
+    0xC4, 0x51, 0x4B, 0x97, 0x66, 0x14, 0xFD, 0x77, 0x4E, 0x8B, 0x38, 0xAA, 0x4C, 0x21, 0xD3, 0x1E,
+    0x7A, 0x49, 0xA3, 0x3D, 0xEC, 0xB5, 0x16, 0xEC, 0x35, 0x8C, 0xAF, 0x3C, 0xA5, 0xB8, 0x32, 0x14,
+    0x01, 0x9A, 0xA9, 0x88, 0x2C, 0x40, 0xCB, 0x8A, 0x75, 0x60, 0xBC, 0x75, 0xF5, 0xC0, 0xEF, 0x94,
+    0xA1, 0x1E, 0xAA, 0x89, 0x5A, 0x66, 0x13, 0xF4, 0x42, 0x2D, 0x51, 0x47, 0xC4, 0x55, 0xB2, 0xA8,
+    0x95, 0x76, 0xA0, 0xBD, 0x9D, 0x92, 0x90, 0x3D, 0xF6, 0x80, 0x23, 0xF6, 0x80, 0x89, 0xBD, 0x8D,
+    0xDB, 0x5F, 0x04, 0x0E, 0x41, 0x8F, 0x1C, 0x72, 0x51, 0x7B, 0x0E, 0x55, 0xA8, 0xBC, 0x91, 0x0D,
+    0x80, 0xC9, 0x3B, 0x1E, 0x38, 0xAC, 0xA7, 0x03, 0x38, 0xB2, 0xF3, 0x3E, 0x1C, 0x5D, 0x9D, 0x8F,
+    0xE0, 0x28, 0xC6, 0x19, 0x8E, 0xE7, 0x38, 0x41, 0x3F, 0xDD, 0x0C, 0xD0, 0x87, 0x7E, 0x84, 0x7E,
+    0xE8, 0x07, 0xE8, 0x7D, 0xEF, 0x41, 0xBA, 0xD6, 0x83, 0xD0, 0x3A, 0x10, 0xDA, 0x14, 0x19, 0x9E,
+    0x68, 0xD2, 0xCD, 0x17, 0x4E, 0x75, 0x23, 0xA6, 0x06, 0x6B, 0xFA, 0xE1, 0x72, 0x60, 0xD6, 0x33,
+    0xD5, 0x50, 0x0E, 0xC6, 0x63, 0xBA, 0x86, 0xAB, 0x70, 0xC0, 0x5C, 0x4C, 0x30, 0x95, 0x83, 0xF1,
+    0xBF, 0xA5, 0x87, 0x86, 0x03, 0x15, 0x6A, 0xA2, 0x9A, 0x2A, 0x7F, 0xA4, 0xC7, 0xCA, 0x1F, 0xE8,
+    0xB1, 0x76, 0x96, 0xC9, 0xB8, 0x23, 0xE6, 0xD2, 0x7F, 0x4E, 0x87, 0x72, 0xA8, 0xA1, 0xEE, 0x1A,
+    0x8E, 0xE0, 0x38, 0x55, 0x66, 0x42, 0x39, 0x94, 0x23, 0x8D, 0x6F, 0x30, 0xB7, 0xCB, 0x95, 0x48,
+    0x9D, 0x9A, 0xFB, 0xAA, 0x9C, 0xE5, 0x7F, 0xE9, 0xE6, 0xE9, 0xE0, 0x74, 0xA7, 0xC5, 0x0F, 0xFC,
+    0xC9, 0x33, 0x1B, 0xDB, 0xB1, 0x95, 0x48, 0x1A, 0x76, 0x5D, 0x8D, 0x13, 0x54, 0xF2, 0x26, 0xE8,
+    0xF7, 0xFA, 0x11, 0x5E, 0x29, 0x16, 0xB8, 0x40, 0xED, 0xD1, 0x5E, 0xCD, 0xF0, 0x0A, 0x8D, 0xC3,
+    0x38, 0x1D, 0x20, 0xAA, 0x75, 0xA3, 0xAC, 0xF7, 0x29, 0x4D, 0x7E, 0xDF, 0x43, 0x75, 0xFB, 0xF3,
+    0x70, 0xE6, 0xD2, 0xA5, 0x4B, 0x14, 0x92, 0x99, 0xC6, 0xA7, 0x4A, 0x12, 0xEA, 0xBA, 0xCB, 0x23,
+    0xB1, 0x92, 0x45, 0xB4, 0xB7, 0xCE, 0xB8, 0x2C, 0xCC, 0xCB, 0x2E, 0x04, 0xD4, 0xE1, 0x33, 0x59,
+    0x6F, 0xAA, 0xC4, 0x95, 0x89, 0xBB, 0xB0, 0x56, 0x49, 0x84, 0x26, 0x91, 0x12, 0x7E, 0x79, 0xC2,
+    0xFC, 0x0B, 0x3B, 0x9A, 0x6C, 0xFA, 0xAC, 0xFE, 0xC4, 0xA3, 0x58, 0x49, 0xA3, 0x07, 0x07, 0x50,
+    0x7D, 0x3C, 0xE1, 0xDE, 0xDD, 0xF5, 0xAF, 0x06, 0x5E, 0xA8, 0x82, 0xBA, 0x7B, 0x14, 0xC8, 0xFD,
+    0x40, 0xF3, 0x23, 0x0F, 0xC8, 0x0A, 0x54, 0x72, 0x6D, 0x2B, 0xC8, 0xF5, 0x02, 0xE8, 0xBF, 0x9C,
+    0xFF, 0x01, 0xDC, 0xD3, 0xC8, 0xEE, 0x15, 0x8D, 0xB8, 0x6D, 0x34, 0x96, 0x95, 0x0E, 0xD4, 0x7F,
+    0xBF, 0x9C, 0x8C, 0x02, 0xE9, 0x3F, 0x30, 0x0A, 0xC4, 0x9F, 0x68, 0x67, 0x36, 0x16, 0xA4, 0xC5,
+    0x52, 0xEB, 0x4B, 0xE2, 0x41, 0x4F, 0xD4, 0xC9, 0x89, 0x97, 0x23, 0x69, 0xA2, 0xCC, 0x82, 0x19,
+    0xA9, 0xC6, 0xAD, 0x41, 0x24, 0xF1, 0xCE, 0x27, 0x1A, 0xAF, 0xC4, 0xA5, 0x01, 0xD0, 0x6C, 0x46,
+    0x3E, 0x5B, 0x0D, 0xE4, 0xED, 0x6F, 0x9C, 0xB8, 0x92, 0x0C, 0xD2, 0x64, 0xC3, 0x91, 0xD9, 0xF8,
+    0x99, 0xC5, 0x95, 0x39, 0x31, 0x39, 0xDF, 0xCC, 0x5D, 0x41, 0xF6, 0x8E, 0xBB, 0xFE, 0xA4, 0xE8,
+    0xB1, 0x77, 0x2A, 0xE5, 0x48, 0xC0, 0x40, 0x1E, 0x3B, 0x18, 0x00, 0x3E, 0x2B, 0xAB, 0x43, 0x89,
+    0x48, 0xA0, 0x10, 0x79, 0x3B, 0xA2, 0xE5, 0xF5, 0x41, 0xA1, 0xC5, 0x05, 0x28, 0x84, 0x3D, 0x50,
+    0xE2, 0x1E, 0x05, 0xFA, 0xAE, 0x72, 0x60, 0xBD, 0xF6, 0xD0, 0x8C, 0xA4, 0x84, 0xF7, 0x10, 0x74,
+    0xE4, 0x02, 0xA8, 0x95, 0xEA, 0x27, 0xD0, 0x3B, 0x2D, 0x32, 0xDA, 0x01, 0x91, 0x68, 0x02, 0xCF,
+    0x3D, 0x24, 0x3A, 0x72, 0x9E, 0xDB, 0x4E, 0x9C, 0xE1, 0x18, 0x1B, 0xB4, 0xB7, 0xCE, 0xC8, 0xB7,
+    0x7E, 0x95, 0x90, 0x58, 0x09, 0xF4, 0xB2, 0x0D, 0xAC, 0x4C, 0x0D, 0x34, 0x0B, 0xA8, 0x7E, 0xBD,
+    0xB6, 0x43, 0x34, 0xEE, 0x38, 0xFF, 0x9C, 0x71, 0x71, 0xE9, 0x1B, 0x9B, 0x74, 0x64, 0x52, 0x6C,
+    0x4A, 0x45, 0x4D, 0x6E, 0x23, 0xBE, 0x67, 0x9B, 0xFA, 0xC1, 0x8E, 0x76, 0x26, 0x77, 0x34, 0x05,
+    0xED, 0xF2, 0x92, 0x54, 0xE6, 0xCC, 0x4D, 0x01, 0x4D, 0xDE, 0x24, 0x2B, 0xDB, 0x24, 0xAB, 0x3B,
+    0xD3, 0xBD, 0xE4, 0x7B, 0xC6, 0x2A, 0xDD, 0x27, 0x2B, 0x25, 0xE2, 0x1A, 0xD9, 0x8A, 0x08, 0xA9,
+    0x2F, 0xB5, 0x91, 0xB7, 0xF3, 0x80, 0xC8, 0x14, 0xA6, 0x98, 0x5C, 0x50, 0x28, 0xB7, 0xC2, 0x42,
+    0x2F, 0x29, 0x92, 0x3A, 0x2B, 0x77, 0x72, 0xCA, 0x48, 0x0D, 0xCA, 0x70, 0x23, 0xE1, 0x3B, 0x35,
+    0xD4, 0xE2, 0xB5, 0x08, 0x56, 0x9E, 0x29, 0x96, 0xE7, 0xA8, 0x5F, 0x1F, 0xB8, 0x69, 0xD0, 0x61,
+    0x8F, 0xFA, 0xAB, 0x23, 0xC7, 0x95, 0xD3, 0xD3, 0x1E, 0x66, 0x18, 0xB1, 0xDF, 0x73, 0xF4, 0xEB,
+    0xA9, 0xA1, 0x3A, 0x4B, 0x1A, 0x3A, 0x01, 0xF0, 0xE0, 0xF5, 0xEB, 0xD7, 0xAF, 0x77, 0xD5, 0x47,
+    0x94, 0x3E, 0xE0, 0xFA, 0xF5, 0xEB, 0xD7, 0xAF, 0xA7, 0xE6, 0xC5, 0x90, 0x8A, 0x25, 0xBB, 0xE8,
+    0x35, 0x27, 0x73, 0xC9, 0x64, 0xA6, 0x7F, 0xE3, 0x93, 0x57, 0x30, 0xB1, 0x48, 0xB3, 0x5C, 0x26,
+    0x65, 0xCC, 0xFF, 0x89, 0x23, 0x03, 0x9E, 0xE1, 0x74, 0xF7, 0xCF, 0x70, 0xAA, 0x5F, 0x4D, 0x4E,
+    0x15, 0xC2, 0x73, 0x93, 0x63, 0x16, 0x5A, 0x11, 0xF1, 0xAD, 0xC8, 0x98, 0xE0, 0xA6, 0x90, 0xF9,
+    0xBA, 0x95, 0xA3, 0x15, 0x19, 0x1A, 0x91, 0x80, 0x9A, 0xE1, 0x6C, 0x4C, 0x1D, 0x60, 0x12, 0x12,
+    0x4F, 0xE3, 0xCC, 0x1F, 0x9C, 0x0E, 0xC1, 0x6B, 0x9F, 0x07, 0xF9, 0xC6, 0xBC, 0xF9, 0xBD, 0xE7,
+    0x54, 0x81, 0xF2, 0x24, 0xE2, 0xFF, 0x32, 0xE5, 0xFF, 0x15, 0x29, 0x64, 0xA1, 0x90, 0x09, 0x23,
+    0x8E, 0x4A, 0xDC, 0xFD, 0xFA, 0x7F, 0xFC, 0xEE, 0x2B, 0xE8, 0xF7, 0x23, 0x4A, 0x6E, 0x53, 0xC9,
+    0x80, 0x11, 0xF4, 0x1B, 0xEF, 0x78, 0x3D, 0x3E, 0x3D, 0x56, 0xA1, 0x08, 0x75, 0x60, 0xE9, 0x07,
+    0xAC, 0x74, 0xD4, 0x77, 0x47, 0x66, 0x37, 0x76, 0xD2, 0x6A, 0x76, 0x69, 0x71, 0x23, 0x0E, 0xDA,
+    0x14, 0xD0, 0xAD, 0x60, 0xFF, 0x75, 0xE3, 0x69, 0xBE, 0xF7, 0x54, 0xC0, 0xBC, 0xE6, 0x23, 0xD5,
+    0x10, 0x2E, 0xA0, 0xC3, 0x73, 0xC6, 0x31, 0x9D, 0xD7, 0x03, 0x87, 0xC6, 0x05, 0x2E, 0x68, 0xFF,
+    0x0A, 0xE6, 0xC9, 0xB0, 0x8F, 0xF6, 0xAF, 0x18, 0x54, 0x38, 0x5F, 0x7A, 0x8E, 0x4C, 0x31, 0x72,
+    0xA0, 0xFD, 0x84, 0xF9, 0xEA, 0x78, 0x88, 0x1E, 0x6E, 0x5C, 0x38, 0x65, 0x8D, 0x74, 0xB2, 0xBE,
+    0x29, 0x76, 0x61, 0x49, 0x9C, 0xE4, 0x90, 0xB0, 0x15, 0x4F, 0xDD, 0xC1, 0xBA, 0xCD, 0xE4, 0xD7,
+    0x09, 0x98, 0x49, 0x6D, 0xAE, 0x0F, 0x2D, 0x69, 0xDB, 0x47, 0x7A, 0x11, 0x59, 0x93, 0x84, 0x77,
+    0x18, 0x91, 0xEB, 0x6E, 0x43, 0x4D, 0x73, 0xE9, 0xB0, 0xD9, 0x85, 0x39, 0x92, 0x24, 0x39, 0xEE,
+    0x8C, 0xE4, 0x66, 0x88, 0x7A, 0x7F, 0x2A, 0x8A, 0xC9, 0x84, 0xB7, 0xCD, 0x0E, 0xB9, 0xBC, 0x99,
+    0xE5, 0xB6, 0xB3, 0x07, 0x27, 0x0F, 0x1E, 0x1A, 0xF7, 0xB9, 0xBC, 0x56, 0xFF, 0xB5, 0xDC, 0x56,
+    0x22, 0xB7, 0xB0, 0xAB, 0xCB, 0x4D, 0xE4, 0x43, 0x1E, 0x1A, 0xA1, 0x96, 0xAD, 0xF1, 0xC1, 0xF8,
+    0x3B, 0x0A, 0x3D, 0x8F, 0x6E, 0x22, 0x66, 0xD7, 0x4C, 0x9E, 0x5B, 0x5E, 0x59, 0xA8, 0x9F, 0x1F,
+    0x62, 0x31, 0x19, 0xA2, 0xE5, 0x50, 0x85, 0x2F, 0x17, 0xA3, 0xCA, 0xA1, 0xEE, 0xDE, 0xAE, 0xE2,
+    0xB4, 0xD5, 0x9F, 0x08, 0xDB, 0x69, 0x24, 0x80, 0xE5, 0xFE, 0xCD, 0x46, 0xDE, 0x7D, 0xF0, 0xA6,
+    0x23, 0x54, 0x72, 0xAD, 0xF4, 0x67, 0xE5, 0xF6, 0x05, 0xE8, 0x65, 0x82, 0x87, 0xC4, 0x6F, 0xFF,
+    0x20, 0xA2, 0x4B, 0x67, 0x5B, 0x4E, 0xD9, 0xA2, 0x58, 0x80, 0x5C, 0x5F, 0x4B, 0x50, 0xEB, 0xE1,
+    0xF6, 0x81, 0x7A, 0xD8, 0x4E, 0xA0, 0xCE, 0xF2, 0xF2, 0x19, 0x26, 0xDC, 0x5C, 0x8C, 0x55, 0xB7,
+    0x94, 0xBE, 0xE5, 0xA6, 0x29, 0x03, 0xED, 0xBE, 0x85, 0x26, 0xFD, 0x87, 0x23, 0x97, 0x57, 0x78,
+    0x97, 0xAF, 0x9C, 0x05, 0x8A, 0x7C, 0x3D, 0x26, 0x4F, 0x0B, 0x7C, 0x34, 0xF7, 0xBA, 0x9E, 0x83,
+    0xC0, 0xE7, 0x1C, 0x7B, 0x54, 0x3C, 0xF4, 0xEE, 0x6D, 0x9E, 0xE3, 0xD9, 0xCB, 0xEB, 0x7F, 0x28,
+    0xB7, 0x6E, 0xE8, 0x34, 0xDE, 0x2C, 0xD8, 0x5B, 0x69, 0x5F, 0xF2, 0x44, 0xDC, 0xEE, 0x98, 0xD4,
+    0x4B, 0x72, 0x9C, 0xBD, 0xFA, 0xCD, 0xCC, 0x84, 0x7F, 0x2E, 0x27, 0x08, 0xA7, 0xA1, 0x42, 0x3D,
+    0x40, 0xEB, 0xA9, 0xC4, 0xAB, 0x5F, 0x7D, 0xCF, 0x37, 0xC6, 0xBC, 0x36, 0x3E, 0x61, 0xFE, 0x27,
+    0x35, 0xFC, 0x06, 0x55, 0x3E, 0x9D, 0x11, 0x2A, 0x47, 0x8E, 0xEE, 0x28, 0x5D, 0x2A, 0x23, 0x3E,
+    0x91, 0x1E, 0x16, 0x3E, 0x3D, 0xF5, 0x69, 0x60, 0x0F, 0xC5, 0x0D, 0x1E, 0x55, 0xE3, 0xF9, 0xFA,
+    0xA9, 0xEF, 0x4E, 0xE6, 0xEB, 0xB5, 0xAB, 0xFE, 0xF5, 0x4C, 0x29, 0x1D, 0xC5, 0x0C, 0xCA, 0x03,
+    0x9F, 0x1D, 0x79, 0x50, 0x62, 0x29, 0xEB, 0xC5, 0x42, 0x5C, 0x1A, 0xC8, 0xD5, 0xB4, 0x9E, 0xF2,
+    0xD5, 0x15, 0x15, 0xAA, 0x89, 0x43, 0xDA, 0xA1, 0x46, 0x89, 0xF6, 0x54, 0xD3, 0x94, 0x2A, 0x95,
+    0xC0, 0x4F, 0x01, 0x23, 0x3F, 0x81, 0xB3, 0xBD, 0x78, 0x78, 0x28, 0x26, 0x14, 0x4F, 0xAD, 0x47,
+    0x28, 0x79, 0xDA, 0xD3, 0xBB, 0x43, 0xFA, 0xAE, 0xF2, 0xAD, 0xE7, 0xC8, 0x0E, 0x54, 0x7E, 0xCC,
+    0xA3, 0xBD, 0xB8, 0x27, 0xD1, 0x40, 0xEA, 0x8D, 0xF3, 0xA1, 0xFD, 0x3E, 0x7B, 0x45, 0x28, 0x3B,
+    0xE3, 0x6E, 0x70, 0x64, 0xD0, 0x43, 0xA0, 0x79, 0x14, 0x7E, 0x35, 0x50, 0x45, 0xB0, 0xBE, 0xFF,
+    0xD9, 0x6C, 0x44, 0xDC, 0x99, 0x3E, 0x9B, 0xDA, 0x7B, 0xD2, 0x75, 0xD6, 0xA0, 0xC7, 0x67, 0x39,
+    0x2C, 0x3B, 0xD3, 0xED, 0xA9, 0xA0, 0xFD, 0x01, 0xE7, 0x4B, 0xAF, 0xC6, 0x19, 0x53, 0xC3, 0x2F,
+    0x46, 0xAA, 0x23, 0x68, 0xBB, 0x7B, 0xF4, 0x7B, 0xBD, 0xB7, 0xB2, 0x14, 0xF2, 0x2D, 0xEE, 0x81,
+    0xFF, 0x17, 0x8D, 0x96, 0xBB, 0x93, 0xDD, 0x48, 0x15, 0xC6, 0x7F, 0x52, 0x33, 0x23, 0x2F, 0x62,
+    0xB7, 0x93, 0xF5, 0x16, 0x55, 0x1E, 0x5B, 0x09, 0xC1, 0x06, 0x66, 0x94, 0x38, 0x20, 0x18, 0x8F,
+    0xDA, 0x4B, 0x40, 0xEA, 0xC0, 0xD7, 0xBC, 0xFE, 0x83, 0x25, 0xB0, 0x03, 0xC2, 0xF1, 0x48, 0x13,
+    0x6D, 0xEA, 0xFF, 0x60, 0x13, 0x5C, 0x45, 0x79, 0x83, 0x75, 0xE8, 0x60, 0x66, 0x6E, 0x03, 0x21,
+    0x01, 0xAA, 0x82, 0x8D, 0x08, 0x10, 0xC6, 0x55, 0xBC, 0x02, 0x37, 0x5B, 0x32, 0x25, 0x2F, 0x7D,
+    0xEF, 0x47, 0xD0, 0xBA, 0xF3, 0x30, 0x1B, 0xD0, 0xC1, 0xED, 0xAB, 0xD6, 0xD1, 0x79, 0x7C, 0xE7,
+    0x3B, 0xE7, 0x34, 0x00, 0x6C, 0x03, 0x70, 0x0C, 0x60, 0x3D, 0x90, 0x05, 0x80, 0x5D, 0x80, 0xC2,
+    0x03, 0xAC, 0x16, 0x8B, 0xC5, 0xDD, 0x5A, 0x92, 0x8A, 0x1E, 0xE0, 0x10, 0x20, 0x5B, 0x01, 0x18,
+    0x49, 0xF2, 0xE5, 0xEB, 0xC5, 0xE2, 0x1E, 0xB5, 0x07, 0x68, 0x01, 0xB2, 0x11, 0xA0, 0xE4, 0x7C,
+    0x65, 0x00, 0xDC, 0x7C, 0x17, 0x30, 0xC3, 0x1E, 0xD0, 0xDE, 0x89, 0x50, 0xC4, 0x72, 0x82, 0xD3,
+    0x70, 0x7B, 0xC4, 0xFE, 0xA5, 0x7B, 0x31, 0xB2, 0xBA, 0x5E, 0x7C, 0x3F, 0x54, 0xFE, 0xD9, 0xCD,
+    0xE2, 0x5F, 0x93, 0xF1, 0xA1, 0xFC, 0x8D, 0x7B, 0xB7, 0xE8, 0xAE, 0xC0, 0xC3, 0xEF, 0x02, 0xB9,
+    0x0F, 0xC0, 0x7B, 0xA6, 0x03, 0x6E, 0x5D, 0x07, 0x32, 0xFF, 0x0C, 0x28, 0x8D, 0x07, 0xBE, 0xF7,
+    0x1E, 0x40, 0xFF, 0x73, 0xA0, 0xC8, 0x3D, 0xB0, 0x67, 0x2F, 0x98, 0xE7, 0x5B, 0x00, 0xA6, 0x07,
+    0xD8, 0xE7, 0x2C, 0x48, 0xDB, 0x01, 0x1C, 0xB0, 0x58, 0x2C, 0x7E, 0x38, 0x58, 0x49, 0x72, 0xE7,
+    0x58, 0xF4, 0x40, 0x11, 0x1A, 0x49, 0x53, 0xB6, 0x58, 0xDC, 0x5F, 0x01, 0x34, 0x6E, 0xF3, 0x26,
+    0x1F, 0x01, 0xDE, 0x3D, 0x33, 0x70, 0x65, 0x1B, 0xE0, 0xD6, 0x0D, 0x80, 0xB0, 0x77, 0xE6, 0x6D,
+    0x71, 0xA7, 0x3F, 0xF3, 0xF9, 0xA6, 0x05, 0x78, 0x78, 0xF3, 0xCC, 0x51, 0xD3, 0x0D, 0x64, 0xAE,
+    0x34, 0x1E, 0xDB, 0xED, 0x94, 0xEC, 0x55, 0xFE, 0xD6, 0xF5, 0x7C, 0xB2, 0xFD, 0xB0, 0x67, 0xBD,
+    0x7D, 0xE1, 0x43, 0xA4, 0xFC, 0x6B, 0xFE, 0xC7, 0x9E, 0x62, 0x5D, 0xAC, 0xA0, 0x88, 0x76, 0x00,
+    0x13, 0x6A, 0x20, 0xEF, 0x1F, 0x02, 0x79, 0xE7, 0xB8, 0xBC, 0xBE, 0x0D, 0x64, 0x1D, 0xA5, 0x87,
+    0x3C, 0x60, 0x02, 0x70, 0x9C, 0x62, 0xB5, 0x1D, 0xCF, 0x53, 0xDC, 0x07, 0x09, 0x84, 0x66, 0xB1,
+    0x58, 0x2C, 0x7E, 0xEA, 0x6B, 0x49, 0x52, 0xAC, 0x1C, 0x80, 0xFD, 0x64, 0x00, 0x28, 0x87, 0x36,
+    0xC5, 0x69, 0x24, 0x49, 0x3D, 0xF5, 0x17, 0x8B, 0x45, 0xEB, 0xC9, 0x23, 0xD4, 0x1E, 0x2A, 0x4F,
+    0xDD, 0x41, 0x36, 0x26, 0x00, 0x6F, 0x92, 0xFB, 0x0B, 0x3E, 0x74, 0x40, 0xED, 0xA0, 0x90, 0x83,
+    0x7F, 0xAF, 0x1D, 0xFB, 0x37, 0xF4, 0xD8, 0xFE, 0xEA, 0xD7, 0x2B, 0x33, 0xED, 0x18, 0xA7, 0x23,
+    0x4F, 0xF3, 0xCB, 0x1D, 0x8A, 0x17, 0x47, 0x9E, 0x6F, 0x7C, 0xB8, 0x03, 0xF9, 0x91, 0x87, 0xAF,
+    0xFF, 0xF3, 0xD1, 0x91, 0xE7, 0xF0, 0xC3, 0x1D, 0xCC, 0x57, 0x47, 0x1E, 0x3B, 0xED, 0x40, 0x73,
+    0xE4, 0x6F, 0x11, 0x77, 0xEA, 0xDE, 0xFC, 0xF9, 0xD5, 0x1B, 0xEC, 0x83, 0x11, 0xDA, 0x11, 0xF2,
+    0xE9, 0x2C, 0x19, 0xF9, 0x4B, 0x20, 0x93, 0x83, 0x14, 0x7F, 0xCA, 0xE6, 0x2E, 0x80, 0x75, 0x80,
+    0x39, 0xE7, 0xF8, 0x48, 0xAE, 0x7E, 0x8F, 0x42, 0xAB, 0x5D, 0x8A, 0xA9, 0xFC, 0x1D, 0x45, 0x40,
+    0xDE, 0x8C, 0x54, 0x7D, 0x36, 0x51, 0x04, 0x8E, 0xC9, 0x46, 0x1A, 0x88, 0x58, 0xCF, 0x09, 0x66,
+    0xCA, 0x4E, 0x41, 0x12, 0x54, 0x12, 0xE4, 0x12, 0x70, 0xED, 0xCD, 0xE5, 0x1C, 0x3C, 0x58, 0x77,
+    0x7B, 0xC0, 0x52, 0xFA, 0xD4, 0x43, 0xAB, 0xA5, 0x06, 0xA8, 0x56, 0xD4, 0x11, 0x8A, 0x35, 0x2C,
+    0x3D, 0xC8, 0x51, 0xAD, 0xA0, 0x19, 0x28, 0x35, 0x50, 0x4C, 0xE4, 0xAF, 0xD7, 0x20, 0x38, 0xB6,
+    0x03, 0x55, 0x4F, 0xC3, 0x0A, 0x13, 0xB1, 0xBE, 0xEA, 0x69, 0x9C, 0x09, 0x59, 0xA4, 0x08, 0xD9,
+    0x44, 0xED, 0x59, 0x72, 0x88, 0x19, 0xB1, 0x43, 0xD5, 0xD1, 0xC2, 0xBA, 0xEC, 0xB1, 0x01, 0xFB,
+    0xE5, 0x88, 0x59, 0x81, 0x56, 0x64, 0xF2, 0x58, 0x3D, 0xFE, 0x40, 0x23, 0x48, 0x92, 0xA0, 0x94,
+    0x24, 0x9F, 0x1E, 0x47, 0x68, 0x24, 0x45, 0xB0, 0x9F, 0x48, 0x6B, 0x30, 0xC3, 0xB6, 0xDE, 0x00,
+    0xDF, 0x79, 0x8B, 0x4B, 0xAC, 0x01, 0xEA, 0x00, 0x14, 0x02, 0xD0, 0x08, 0x34, 0xCB, 0x0E, 0xCA,
+    0x2F, 0x23, 0x64, 0xB1, 0xF6, 0xD0, 0xDC, 0x89, 0x60, 0x43, 0xD5, 0x93, 0x47, 0xD6, 0xD0, 0x3A,
+    0x1B, 0xB0, 0x03, 0xC2, 0x44, 0xCA, 0x91, 0xA5, 0x63, 0xE9, 0xAA, 0x81, 0x62, 0x32, 0x11, 0x5A,
+    0x2F, 0x87, 0x89, 0xF5, 0x00, 0xCD, 0xEF, 0x25, 0x69, 0xD5, 0x4A, 0xD2, 0x6F, 0x95, 0x3C, 0x02,
+    0x68, 0x25, 0x0D, 0xB5, 0xA4, 0xC0, 0x21, 0x95, 0xA3, 0xA6, 0xF4, 0x58, 0x6F, 0x02, 0x66, 0xC8,
+    0x26, 0xB2, 0x91, 0x13, 0x38, 0xA6, 0x81, 0x06, 0xEB, 0xA9, 0xBA, 0x62, 0xA0, 0xEC, 0xF3, 0x11,
+    0x13, 0x88, 0x10, 0xD9, 0xE7, 0xFF, 0xFA, 0x90, 0x7B, 0x5C, 0x85, 0xCA, 0x95, 0x3D, 0x66, 0x60,
+    0x82, 0x48, 0x03, 0xB5, 0x2B, 0x3D, 0xC5, 0x90, 0x8D, 0xB3, 0xA6, 0x06, 0xEB, 0x93, 0xFA, 0x6C,
+    0xE2, 0x70, 0x7E, 0xB6, 0xDE, 0x84, 0x59, 0xDF, 0x3E, 0x55, 0x97, 0x9E, 0xF3, 0x40, 0x84, 0x47,
+    0x54, 0x0E, 0xDB, 0x99, 0x21, 0xB9, 0x63, 0x25, 0x4D, 0x46, 0x1B, 0xCA, 0x8C, 0x2C, 0x25, 0x9F,
+    0x0D, 0x1B, 0x1A, 0x1A, 0x0F, 0x14, 0x1D, 0x60, 0xD9, 0xFC, 0xDC, 0x00, 0xD8, 0x03, 0x78, 0xB8,
+    0x79, 0xF9, 0x7C, 0xE6, 0x6E, 0x36, 0x02, 0x35, 0x60, 0x86, 0xB9, 0xD3, 0x1A, 0x49, 0xE7, 0x8A,
+    0x37, 0x89, 0xBB, 0xFA, 0x91, 0x14, 0xDB, 0xF3, 0x03, 0x2B, 0x01, 0xD4, 0xFA, 0xC5, 0x59, 0xFB,
+    0x86, 0x04, 0x77, 0x6A, 0x63, 0x73, 0xA5, 0xA4, 0xCE, 0x06, 0x55, 0xFA, 0xB0, 0x49, 0x82, 0xA7,
+    0xA9, 0x81, 0x27, 0x79, 0x33, 0x01, 0x50, 0x26, 0xF9, 0x6A, 0x48, 0x82, 0x49, 0x7E, 0xE9, 0x80,
+    0x2B, 0x08, 0x60, 0xDF, 0xA4, 0x7E, 0xF9, 0x83, 0x08, 0xD0, 0xFC, 0x69, 0x4C, 0x0E, 0x0C, 0x00,
+    0x55, 0x72, 0xCC, 0xAA, 0x4B, 0x5B, 0xD2, 0x7F, 0x6F, 0x76, 0xF6, 0xC7, 0x6C, 0x3F, 0x86, 0xE5,
+    0xCA, 0xC8, 0xD3, 0x28, 0x48, 0xD8, 0x97, 0x55, 0xDB, 0x85, 0x7C, 0xA4, 0xF1, 0x85, 0xBB, 0x8D,
+    0x09, 0xDC, 0x2A, 0x3D, 0xFB, 0x14, 0x6E, 0xC4, 0xF4, 0x3C, 0xB3, 0xF0, 0x88, 0x1B, 0x04, 0x6C,
+    0x28, 0x7B, 0xDB, 0x95, 0x52, 0x44, 0xFA, 0x8F, 0x44, 0x29, 0xD5, 0xEA, 0x69, 0xE4, 0x97, 0x03,
+    0x7C, 0xDC, 0x71, 0x77, 0x03, 0x51, 0xFD, 0x32, 0xC5, 0x91, 0x3C, 0x62, 0x79, 0xC7, 0xA5, 0xC6,
+    0xC7, 0xC5, 0xC8, 0x4D, 0x02, 0x67, 0x83, 0x07, 0x27, 0x5C, 0x04, 0x8B, 0xBA, 0xBB, 0x88, 0x24,
+    0xC5, 0xE5, 0x8F, 0x67, 0xC0, 0x28, 0xFB, 0x4B, 0xC7, 0xF9, 0x34, 0xE7, 0x64, 0xD6, 0xD9, 0x5E,
+    0x36, 0xB5, 0x39, 0x3E, 0x7D, 0xCB, 0xD4, 0x7C, 0xBC, 0x9A, 0xA5, 0x02, 0xC0, 0x3B, 0xC8, 0x01,
+    0xF9, 0x5C, 0x3A, 0x9B, 0x84, 0x4B, 0x49, 0x6A, 0xA9, 0x64, 0xF9, 0xC1, 0x74, 0xB9, 0xAC, 0xED,
+    0x90, 0xAD, 0x68, 0xFA, 0x22, 0x22, 0xBF, 0x75, 0x8F, 0xFF, 0x59, 0x4B, 0x6C, 0xC8, 0x44, 0x13,
+    0x8A, 0x35, 0x6C, 0xDD, 0x05, 0xDA, 0xC8, 0xED, 0x2C, 0xD6, 0x1C, 0x98, 0x60, 0x8F, 0xC6, 0xD2,
+    0x1B, 0x0D, 0xC0, 0xC7, 0x17, 0x86, 0x4F, 0x2E, 0x97, 0x39, 0xFB, 0xCF, 0xBE, 0xE8, 0x1B, 0x46,
+    0xDB, 0x9D, 0xD0, 0x8A, 0x1F, 0x51, 0x5D, 0xB4, 0x9C, 0xDA, 0x4B, 0x38, 0x9F, 0xC3, 0xA5, 0x3B,
+    0x6B, 0xCC, 0x3C, 0x3F, 0x9F, 0xC9, 0x45, 0x7F, 0x17, 0x2B, 0x69, 0xA4, 0x91, 0x34, 0x01, 0x13,
+    0x1B, 0xCA, 0x53, 0x76, 0x00, 0xD5, 0xA6, 0x51, 0x90, 0x49, 0x12, 0x85, 0xBE, 0x70, 0x9B, 0xF6,
+    0x9E, 0xC6, 0x7B, 0x52, 0x98, 0x07, 0x80, 0xD2, 0x33, 0x97, 0xCD, 0x85, 0xB5, 0x7D, 0x21, 0xB1,
+    0xED, 0x08, 0x64, 0x1A, 0x80, 0x42, 0x1E, 0xA8, 0xE4, 0x80, 0x76, 0x05, 0x64, 0x9A, 0x00, 0x66,
+    0xE2, 0xBE, 0x49, 0x77, 0x9E, 0xB5, 0x03, 0xAE, 0x49, 0x8F, 0x81, 0x42, 0x7A, 0x09, 0x6C, 0x4B,
+    0x3D, 0x90, 0x2D, 0x27, 0x80, 0x6C, 0x99, 0xAC, 0x38, 0xDE, 0x9F, 0x0B, 0xF0, 0xC9, 0x5C, 0xAC,
+    0x7F, 0x77, 0x70, 0xFF, 0xF3, 0x39, 0x43, 0x3F, 0xE9, 0x36, 0xB0, 0xCC, 0xE9, 0x6F, 0xD2, 0xB6,
+    0xBC, 0xB8, 0x65, 0xFA, 0x9A, 0x2D, 0x4F, 0xA9, 0x7E, 0x30, 0x25, 0xD3, 0xC0, 0x03, 0xAD, 0x1D,
+    0xDB, 0xD2, 0x04, 0x26, 0x79, 0xD6, 0xBE, 0x01, 0xB0, 0x2F, 0x67, 0x4F, 0x36, 0xEB, 0x7D, 0x20,
+    0xFB, 0x99, 0x3C, 0x1F, 0x2C, 0xA5, 0x88, 0x95, 0x9E, 0x38, 0xF2, 0x27, 0x97, 0x6E, 0x12, 0xF5,
+    0x88, 0x3C, 0x4D, 0x44, 0x81, 0xCA, 0xB1, 0x02, 0xDB, 0xF1, 0x08, 0x0A, 0xCF, 0x2E, 0xE4, 0x03,
+    0xD6, 0xC1, 0x48, 0xE1, 0xD3, 0x64, 0x19, 0x4D, 0xEA, 0xDF, 0x9F, 0xFF, 0xE3, 0xE9, 0xF2, 0x29,
+    0x26, 0x50, 0x75, 0x64, 0x13, 0x65, 0x0F, 0x27, 0x98, 0x00, 0x0D, 0x59, 0x84, 0xCA, 0x73, 0x0A,
+    0xE5, 0x40, 0xE3, 0x30, 0x23, 0xD6, 0x43, 0xA4, 0x0C, 0xD0, 0x62, 0x26, 0x68, 0x3C, 0x2B, 0xB0,
+    0x03, 0x2D, 0x14, 0x23, 0xB5, 0x27, 0x8F, 0xD8, 0x54, 0x54, 0x5B, 0x6E, 0x26, 0x7F, 0xDD, 0x53,
+    0x2A, 0x62, 0x24, 0xCF, 0xA3, 0xAD, 0x7B, 0xD8, 0x6E, 0xE6, 0xCD, 0xEE, 0xCC, 0xAB, 0x52, 0x1A,
+    0x91, 0x5E, 0xB1, 0xB5, 0xBE, 0x1F, 0xB0, 0x7E, 0x97, 0x6C, 0x32, 0x3D, 0xB5, 0x3B, 0xC0, 0x84,
+    0xD2, 0xD3, 0x32, 0x51, 0x0E, 0x95, 0x63, 0x95, 0x07, 0xAC, 0x6F, 0xC8, 0x63, 0x31, 0xD0, 0xF8,
+    0x53, 0xCC, 0x64, 0x7B, 0xDA, 0x3B, 0x91, 0x32, 0xCC, 0x05, 0x9F, 0xDF, 0xA5, 0x5C, 0x71, 0x88,
+    0x91, 0xB7, 0x9E, 0x47, 0x10, 0xB1, 0x1D, 0xB5, 0xCB, 0x02, 0x26, 0xB0, 0x0B, 0x87, 0x98, 0x9E,
+    0xB2, 0x2F, 0x25, 0x22, 0xD2, 0x50, 0x75, 0x5B, 0xEB, 0x7B, 0xF9, 0x88, 0xF5, 0x34, 0x64, 0x13,
+    0xC5, 0x40, 0xED, 0x12, 0x06, 0xD6, 0xD3, 0x42, 0xA4, 0x1C, 0xA8, 0x3B, 0x56, 0x33, 0x00, 0x0D,
+    0x79, 0xA4, 0x08, 0x34, 0x1D, 0xA7, 0x98, 0x09, 0x2B, 0xDF, 0x3A, 0x34, 0x95, 0x81, 0x4A, 0x73,
+    0x7B, 0xB9, 0x7A, 0xA9, 0x09, 0xD9, 0x40, 0x2E, 0x67, 0x15, 0x31, 0xF2, 0x56, 0x22, 0x1B, 0xB1,
+    0xFD, 0xC2, 0x31, 0x51, 0xF4, 0xC0, 0x01, 0xF9, 0x90, 0xE0, 0x18, 0x53, 0x49, 0x1C, 0xA4, 0xBB,
+    0x88, 0x74, 0x4C, 0x23, 0x49, 0xAF, 0xF8, 0xE6, 0xFA, 0xE9, 0x67, 0x5F, 0x7D, 0xD6, 0xD1, 0x24,
+    0x68, 0xAA, 0x8E, 0x93, 0x2C, 0x50, 0xF6, 0x34, 0x1C, 0x63, 0x02, 0x95, 0xDF, 0x27, 0x8B, 0x94,
+    0x43, 0x05, 0xA7, 0x98, 0xB1, 0xF4, 0x34, 0x8E, 0x98, 0x82, 0x58, 0xA6, 0x9B, 0x51, 0xD3, 0x9D,
+    0x60, 0x22, 0xB6, 0x6F, 0x60, 0x4D, 0x11, 0x2A, 0x4F, 0xEB, 0xF2, 0x58, 0x06, 0x6A, 0xCF, 0x3A,
+    0x3F, 0x2F, 0xFC, 0x77, 0x66, 0x36, 0x95, 0x33, 0x9F, 0xCC, 0xCC, 0xA8, 0x74, 0x79, 0x7C, 0x04,
+    0x71, 0x66, 0x55, 0x33, 0xF3, 0xAA, 0x76, 0x89, 0x59, 0xD6, 0x27, 0x6E, 0x15, 0x43, 0x62, 0x57,
+    0x3E, 0xCE, 0xFC, 0x8A, 0x33, 0xC3, 0x0E, 0x67, 0x8E, 0x5D, 0x40, 0xB8, 0x21, 0x4B, 0x6F, 0x3D,
+    0xA7, 0xE4, 0xD3, 0xCC, 0xB5, 0x73, 0xB0, 0x13, 0xDF, 0x2A, 0x9F, 0x18, 0x57, 0xF6, 0x89, 0x73,
+    0x66, 0x9C, 0x59, 0xA7, 0x29, 0xF1, 0xAE, 0x5D, 0x25, 0xE6, 0xD5, 0x7A, 0xEB, 0x7E, 0x7D, 0xF0,
+    0x56, 0xA7, 0x77, 0x67, 0x03, 0x20, 0xD7, 0xDF, 0x28, 0x06, 0x68, 0x15, 0xAC, 0xE4, 0x8B, 0xD7,
+    0x5B, 0x2C, 0x25, 0x6E, 0x27, 0xE9, 0x2C, 0x24, 0xE9, 0xA2, 0x4F, 0xD2, 0xD5, 0x94, 0x66, 0x4D,
+    0xAD, 0x8E, 0xC6, 0xC1, 0x35, 0xF5, 0x69, 0x5C, 0xB4, 0x3E, 0x8D, 0xA0, 0x25, 0x8D, 0x23, 0xFB,
+    0x43, 0x11, 0xB3, 0x15, 0xD4, 0x52, 0x5F, 0x6A, 0xCC, 0x25, 0xD1, 0xA8, 0xB7, 0x52, 0x40, 0x72,
+    0xDB, 0x7A, 0x83, 0x51, 0xE4, 0xBF,
 };
 
 static const EpdGlyph opendyslexic_14_italicGlyphs[] = {
@@ -2354,7 +2333,7 @@ static const EpdGlyph opendyslexic_14_italicGlyphs[] = {
     { 10, 25, 7, 1, 21, 63, 10546 }, // |
     { 16, 27, 18, 0, 22, 108, 10609 }, // }
     { 13, 6, 17, 5, 22, 20, 10717 }, // ~
-    { 0, 0, 25, 0, 0, 0, 0 }, //  
+    { 0, 0, 25, 0, 0, 0, 10737 }, //  
     { 11, 29, 13, 3, 22, 80, 0 }, // ¡
     { 15, 25, 20, 2, 22, 94, 80 }, // ¢
     { 23, 27, 20, 1, 27, 156, 174 }, // £
@@ -2365,625 +2344,631 @@ static const EpdGlyph opendyslexic_14_italicGlyphs[] = {
     { 14, 5, 16, 6, 23, 18, 737 }, // ¨
     { 13, 11, 16, 7, 26, 36, 755 }, // ©
     { 10, 10, 12, 5, 22, 25, 791 }, // ª
-    { 19, 14, 24, 3, 14, 67, 816 }, // «
-    { 14, 9, 18, 4, 10, 32, 883 }, // ¬
-    { 14, 3, 16, 4, 10, 11, 915 }, // ­
-    { 13, 11, 16, 8, 31, 36, 926 }, // ®
-    { 11, 3, 15, 7, 21, 9, 962 }, // ¯
-    { 15, 14, 16, 5, 23, 53, 971 }, // °
-    { 17, 17, 21, 1, 16, 73, 1024 }, // ±
-    { 10, 11, 9, 3, 24, 28, 1097 }, // ²
-    { 10, 11, 9, 3, 23, 28, 1125 }, // ³
-    { 7, 6, 8, 6, 23, 11, 1153 }, // ´
-    { 21, 19, 21, -1, 16, 100, 1164 }, // µ
-    { 20, 24, 18, 1, 21, 120, 1264 }, // ¶
-    { 6, 5, 8, 3, 12, 8, 1384 }, // ·
-    { 8, 8, 10, 0, 1, 16, 1392 }, // ¸
-    { 8, 11, 8, 3, 24, 22, 1408 }, // ¹
-    { 10, 9, 12, 5, 21, 23, 1430 }, // º
-    { 20, 14, 19, -4, 14, 70, 1453 }, // »
-    { 24, 28, 32, 7, 26, 168, 1523 }, // ¼
-    { 25, 27, 32, 7, 25, 169, 1691 }, // ½
-    { 25, 27, 32, 6, 25, 169, 1860 }, // ¾
-    { 19, 32, 17, -2, 17, 152, 2029 }, // ¿
-    { 23, 33, 29, 1, 33, 190, 2181 }, // À
-    { 25, 38, 29, 1, 38, 238, 2371 }, // Á
-    { 25, 32, 29, 1, 32, 200, 2609 }, // Â
-    { 26, 33, 29, 1, 33, 215, 2809 }, // Ã
-    { 27, 33, 29, 1, 33, 223, 3024 }, // Ä
-    { 24, 35, 29, 1, 35, 210, 3247 }, // Å
-    { 38, 26, 42, 1, 25, 247, 3457 }, // Æ
-    { 25, 33, 25, 1, 26, 207, 3704 }, // Ç
-    { 23, 32, 23, 1, 32, 184, 3911 }, // È
-    { 23, 38, 23, 1, 38, 219, 4095 }, // É
-    { 23, 32, 23, 1, 32, 184, 4314 }, // Ê
-    { 24, 33, 23, 1, 33, 198, 4498 }, // Ë
-    { 14, 35, 12, 1, 35, 123, 4696 }, // Ì
-    { 17, 40, 12, 1, 40, 170, 4819 }, // Í
-    { 16, 34, 12, 1, 34, 136, 4989 }, // Î
-    { 18, 35, 12, 1, 35, 158, 5125 }, // Ï
-    { 26, 25, 28, 0, 25, 163, 5283 }, // Ð
-    { 28, 32, 27, 1, 32, 224, 5446 }, // Ñ
-    { 28, 34, 29, 2, 33, 238, 5670 }, // Ò
-    { 28, 39, 29, 2, 38, 273, 5908 }, // Ó
-    { 28, 33, 29, 2, 32, 231, 6181 }, // Ô
-    { 28, 34, 29, 2, 33, 238, 6412 }, // Õ
-    { 28, 34, 29, 2, 33, 238, 6650 }, // Ö
-    { 14, 8, 17, 3, 11, 28, 6888 }, // ×
-    { 50, 49, 29, -10, 37, 613, 6916 }, // Ø
-    { 26, 35, 27, 2, 34, 228, 7529 }, // Ù
-    { 26, 39, 27, 2, 38, 254, 7757 }, // Ú
-    { 26, 33, 27, 2, 32, 215, 8011 }, // Û
-    { 26, 35, 27, 2, 34, 228, 8226 }, // Ü
-    { 21, 39, 27, 7, 39, 205, 8454 }, // Ý
-    { 19, 23, 16, 1, 23, 110, 8659 }, // Þ
-    { 20, 23, 20, 2, 23, 115, 8769 }, // ß
-    { 18, 24, 22, 1, 24, 108, 8884 }, // à
-    { 18, 28, 22, 1, 28, 126, 8992 }, // á
-    { 20, 24, 22, 1, 24, 120, 9118 }, // â
-    { 19, 23, 22, 1, 23, 110, 9238 }, // ã
-    { 20, 24, 22, 1, 24, 120, 9348 }, // ä
-    { 18, 26, 22, 1, 26, 117, 9468 }, // å
-    { 30, 18, 36, 1, 18, 135, 9585 }, // æ
-    { 15, 24, 20, 2, 17, 90, 9720 }, // ç
-    { 18, 27, 22, 2, 27, 122, 9810 }, // è
-    { 19, 32, 22, 2, 32, 152, 9932 }, // é
-    { 19, 26, 22, 2, 26, 124, 10084 }, // ê
-    { 20, 27, 22, 2, 27, 135, 10208 }, // ë
-    { 11, 24, 11, 1, 24, 66, 10343 }, // ì
-    { 14, 29, 11, 1, 29, 102, 10409 }, // í
-    { 14, 23, 11, 1, 23, 81, 10511 }, // î
-    { 15, 25, 11, 1, 25, 94, 10592 }, // ï
-    { 25, 23, 24, 3, 23, 144, 10686 }, // ð
-    { 21, 25, 22, 1, 25, 132, 10830 }, // ñ
-    { 18, 26, 22, 2, 26, 117, 10962 }, // ò
-    { 19, 31, 22, 2, 31, 148, 11079 }, // ó
-    { 19, 25, 22, 2, 25, 119, 11227 }, // ô
-    { 19, 26, 22, 2, 26, 124, 11346 }, // õ
-    { 20, 26, 22, 2, 26, 130, 11470 }, // ö
-    { 19, 18, 22, 4, 18, 86, 11600 }, // ÷
-    { 29, 45, 22, -4, 30, 327, 11686 }, // ø
-    { 18, 25, 21, 2, 24, 113, 12013 }, // ù
-    { 18, 30, 21, 2, 29, 135, 12126 }, // ú
-    { 18, 24, 21, 2, 23, 108, 12261 }, // û
-    { 19, 25, 21, 2, 24, 119, 12369 }, // ü
-    { 22, 39, 23, 0, 31, 215, 12488 }, // ý
-    { 18, 30, 16, 1, 24, 135, 12703 }, // þ
-    { 23, 35, 23, 0, 27, 202, 12838 }, // ÿ
-    { 26, 32, 29, 1, 32, 208, 0 }, // Ā
-    { 20, 22, 22, 1, 22, 110, 208 }, // ā
-    { 26, 36, 29, 1, 36, 234, 318 }, // Ă
-    { 20, 26, 22, 1, 26, 130, 552 }, // ă
-    { 23, 32, 29, 1, 25, 184, 682 }, // Ą
-    { 18, 23, 22, 1, 18, 104, 866 }, // ą
-    { 25, 39, 25, 1, 38, 244, 970 }, // Ć
-    { 17, 28, 20, 2, 27, 119, 1214 }, // ć
-    { 26, 37, 25, 1, 36, 241, 1333 }, // Ĉ
-    { 19, 25, 20, 2, 24, 119, 1574 }, // ĉ
-    { 25, 37, 25, 1, 36, 232, 1693 }, // Ċ
-    { 15, 26, 20, 2, 25, 98, 1925 }, // ċ
-    { 25, 39, 25, 1, 38, 244, 2023 }, // Č
-    { 17, 27, 20, 2, 26, 115, 2267 }, // č
-    { 25, 36, 28, 1, 36, 225, 2382 }, // Ď
-    { 28, 26, 23, 1, 25, 182, 2607 }, // ď
-    { 26, 25, 28, 0, 25, 163, 2789 }, // Đ
-    { 27, 26, 23, 1, 25, 176, 2952 }, // đ
-    { 23, 32, 23, 1, 32, 184, 3128 }, // Ē
-    { 20, 26, 22, 2, 26, 130, 3312 }, // ē
-    { 23, 35, 23, 1, 35, 202, 3442 }, // Ĕ
-    { 20, 30, 22, 2, 30, 150, 3644 }, // ĕ
-    { 23, 34, 23, 1, 34, 196, 3794 }, // Ė
-    { 18, 28, 22, 2, 28, 126, 3990 }, // ė
-    { 23, 31, 23, 1, 25, 179, 4116 }, // Ę
-    { 18, 24, 22, 2, 17, 108, 4295 }, // ę
-    { 23, 35, 23, 1, 35, 202, 4403 }, // Ě
-    { 19, 30, 22, 2, 30, 143, 4605 }, // ě
-    { 26, 34, 29, 2, 34, 221, 4748 }, // Ĝ
-    { 22, 32, 22, 0, 24, 176, 4969 }, // ĝ
-    { 26, 36, 29, 2, 36, 234, 5145 }, // Ğ
-    { 21, 34, 22, 0, 26, 179, 5379 }, // ğ
-    { 25, 34, 29, 2, 34, 213, 5558 }, // Ġ
-    { 21, 33, 22, 0, 25, 174, 5771 }, // ġ
-    { 25, 39, 29, 2, 26, 244, 5945 }, // Ģ
-    { 21, 35, 22, 0, 27, 184, 6189 }, // ģ
-    { 27, 33, 27, 1, 33, 223, 6373 }, // Ĥ
-    { 19, 31, 22, 1, 31, 148, 6596 }, // ĥ
-    { 27, 24, 27, 1, 24, 162, 6744 }, // Ħ
-    { 19, 25, 22, 1, 25, 119, 6906 }, // ħ
-    { 17, 36, 12, 1, 36, 153, 7025 }, // Ĩ
-    { 14, 25, 11, 1, 25, 88, 7178 }, // ĩ
-    { 18, 34, 12, 1, 34, 153, 7266 }, // Ī
-    { 15, 23, 11, 1, 23, 87, 7419 }, // ī
-    { 14, 31, 18, 3, 25, 109, 7506 }, // Į
-    { 13, 32, 11, -1, 26, 104, 7615 }, // į
-    { 14, 36, 12, 1, 36, 126, 7719 }, // İ
-    { 8, 17, 11, 1, 17, 34, 7845 }, // ı
-    { 23, 32, 27, 1, 25, 184, 7879 }, // Ĳ
-    { 27, 34, 11, 1, 26, 230, 8063 }, // ĳ
-    { 24, 40, 18, -1, 33, 240, 8293 }, // Ĵ
-    { 24, 31, 19, 2, 24, 186, 8533 }, // ĵ
-    { 23, 36, 26, 1, 25, 207, 8719 }, // Ķ
-    { 16, 38, 22, 1, 24, 152, 8926 }, // ķ
-    { 14, 16, 16, 0, 16, 56, 9078 }, // ĸ
-    { 18, 35, 22, 1, 35, 158, 9134 }, // Ĺ
-    { 16, 34, 14, 1, 34, 136, 9292 }, // ĺ
-    { 18, 38, 22, 1, 25, 171, 9428 }, // Ļ
-    { 12, 37, 14, 0, 24, 111, 9599 }, // ļ
-    { 19, 25, 22, 1, 25, 119, 9710 }, // Ľ
-    { 18, 25, 14, 1, 25, 113, 9829 }, // ľ
-    { 20, 25, 22, 1, 25, 125, 9942 }, // Ŀ
-    { 16, 25, 14, 1, 25, 100, 10067 }, // ŀ
-    { 40, 37, 22, -14, 30, 370, 10167 }, // Ł
-    { 28, 24, 14, -10, 24, 168, 10537 }, // ł
-    { 28, 35, 27, 1, 35, 245, 10705 }, // Ń
-    { 20, 28, 22, 1, 28, 140, 10950 }, // ń
-    { 28, 36, 27, 1, 25, 252, 11090 }, // Ņ
-    { 18, 28, 22, 1, 17, 126, 11342 }, // ņ
-    { 28, 35, 27, 1, 35, 245, 11468 }, // Ň
-    { 20, 28, 22, 1, 28, 140, 11713 }, // ň
-    { 20, 30, 20, -3, 30, 150, 11853 }, // ŉ
-    { 28, 32, 27, 1, 25, 224, 12003 }, // Ŋ
-    { 18, 22, 22, 1, 17, 99, 12227 }, // ŋ
-    { 28, 33, 29, 2, 32, 231, 12326 }, // Ō
-    { 20, 25, 22, 2, 25, 125, 12557 }, // ō
-    { 28, 36, 29, 2, 35, 252, 12682 }, // Ŏ
-    { 20, 29, 22, 2, 29, 145, 12934 }, // ŏ
-    { 29, 35, 29, 2, 34, 254, 13079 }, // Ő
-    { 23, 27, 22, 2, 27, 156, 13333 }, // ő
-    { 38, 25, 35, 2, 25, 238, 13489 }, // Œ
-    { 30, 17, 31, 2, 17, 128, 13727 }, // œ
-    { 22, 34, 24, 1, 34, 187, 13855 }, // Ŕ
-    { 15, 25, 17, 1, 25, 94, 14042 }, // ŕ
-    { 22, 39, 24, 1, 25, 215, 14136 }, // Ŗ
-    { 18, 32, 17, -2, 17, 144, 14351 }, // ŗ
-    { 22, 34, 24, 1, 34, 187, 14495 }, // Ř
-    { 15, 25, 17, 1, 25, 94, 14682 }, // ř
-    { 25, 38, 29, 1, 37, 238, 14776 }, // Ś
-    { 17, 27, 21, 1, 27, 115, 15014 }, // ś
-    { 26, 35, 29, 1, 34, 228, 15129 }, // Ŝ
-    { 19, 24, 21, 1, 24, 114, 15357 }, // ŝ
-    { 25, 33, 29, 1, 26, 207, 15471 }, // Ş
-    { 17, 24, 21, 1, 16, 102, 15678 }, // ş
-    { 25, 38, 29, 1, 37, 238, 15780 }, // Š
-    { 17, 27, 21, 1, 27, 115, 16018 }, // š
-    { 23, 31, 27, 6, 25, 179, 16133 }, // Ţ
-    { 13, 28, 19, 4, 22, 91, 16312 }, // ţ
-    { 23, 35, 27, 6, 35, 202, 16403 }, // Ť
-    { 17, 25, 19, 4, 25, 107, 16605 }, // ť
-    { 23, 25, 27, 6, 25, 144, 16712 }, // Ŧ
-    { 15, 22, 19, 2, 22, 83, 16856 }, // ŧ
-    { 26, 36, 27, 2, 35, 234, 16939 }, // Ũ
-    { 18, 26, 21, 2, 25, 117, 17173 }, // ũ
-    { 26, 34, 27, 2, 33, 221, 17290 }, // Ū
-    { 19, 24, 21, 2, 23, 114, 17511 }, // ū
-    { 26, 37, 27, 2, 36, 241, 17625 }, // Ŭ
-    { 19, 27, 21, 2, 26, 129, 17866 }, // ŭ
-    { 26, 38, 27, 2, 37, 247, 17995 }, // Ů
-    { 18, 28, 21, 2, 27, 126, 18242 }, // ů
-    { 28, 36, 27, 2, 35, 252, 18368 }, // Ű
-    { 22, 26, 21, 2, 25, 143, 18620 }, // ű
-    { 26, 31, 27, 2, 25, 202, 18763 }, // Ų
-    { 18, 23, 21, 2, 16, 104, 18965 }, // ų
-    { 33, 32, 37, 6, 32, 264, 19069 }, // Ŵ
-    { 23, 24, 28, 5, 24, 138, 19333 }, // ŵ
-    { 21, 33, 27, 7, 33, 174, 19471 }, // Ŷ
-    { 22, 33, 23, 0, 25, 182, 19645 }, // ŷ
-    { 21, 34, 27, 7, 34, 179, 19827 }, // Ÿ
-    { 29, 35, 29, 1, 35, 254, 20006 }, // Ź
-    { 20, 27, 22, 1, 27, 135, 20260 }, // ź
-    { 29, 33, 29, 1, 33, 240, 20395 }, // Ż
-    { 20, 25, 22, 1, 25, 125, 20635 }, // ż
-    { 29, 35, 29, 1, 35, 254, 20760 }, // Ž
-    { 20, 27, 22, 1, 27, 135, 21014 }, // ž
-    { 16, 24, 15, 4, 24, 96, 21149 }, // ſ
-    { 9, 5, 0, 7, 22, 12, 0 }, // ̀
-    { 7, 6, 0, 6, 23, 11, 12 }, // ́
-    { 13, 6, 0, -1, 0, 20, 23 }, // ̂
-    { 13, 6, 0, 5, 22, 20, 43 }, // ̃
-    { 14, 4, 0, 5, 20, 14, 63 }, // ̄
-    { 19, 4, 0, 9, 26, 19, 77 }, // ̅
-    { 13, 6, 0, 6, 21, 20, 96 }, // ̆
-    { 6, 5, 0, 6, 22, 8, 116 }, // ̇
-    { 14, 5, 0, 6, 23, 18, 124 }, // ̈
-    { 7, 6, 0, 5, 19, 11, 142 }, // ̉
-    { 8, 6, 0, 6, 22, 12, 153 }, // ̊
-    { 20, 5, 0, 6, 22, 25, 165 }, // ̋
-    { 12, 6, 0, 6, 22, 18, 190 }, // ̌
-    { 21, 5, 0, -9, 24, 27, 208 }, // ̏
-    { 10, 9, 0, 4, 22, 23, 235 }, // ̒
-    { 10, 9, 0, 4, 22, 23, 258 }, // ̓
-    { 10, 9, 0, -5, 22, 23, 281 }, // ̔
-    { 7, 7, 0, 0, -1, 13, 304 }, // ̘
-    { 7, 7, 0, 2, -1, 13, 317 }, // ̙
-    { 12, 7, 0, 8, 23, 21, 330 }, // ̚
-    { 6, 7, 0, 5, 19, 11, 351 }, // ̛
-    { 5, 6, 0, 0, -2, 8, 362 }, // ̜
-    { 7, 6, 0, 3, 5, 11, 370 }, // ̝
-    { 7, 6, 0, 0, -1, 11, 381 }, // ̞
-    { 7, 7, 0, 0, -2, 13, 392 }, // ̟
-    { 14, 4, 0, 0, -4, 14, 405 }, // ̠
-    { 6, 5, 0, 0, 1, 8, 419 }, // ̣
-    { 15, 5, 0, -1, -1, 19, 427 }, // ̤
-    { 8, 6, 0, 6, 22, 12, 446 }, // ̥
-    { 10, 10, 0, 0, 5, 25, 458 }, // ̦
-    { 8, 8, 0, 0, 1, 16, 483 }, // ̧
-    { 8, 8, 0, 0, 1, 16, 499 }, // ̨
-    { 6, 8, 0, -1, -2, 12, 515 }, // ̩
-    { 11, 5, 0, 0, -1, 14, 527 }, // ̪
-    { 12, 6, 0, 0, 0, 18, 541 }, // ̬
-    { 12, 6, 0, -1, -1, 18, 559 }, // ̭
-    { 13, 6, 0, 5, 22, 20, 577 }, // ̰
-    { 11, 3, 0, 7, 21, 9, 597 }, // ̱
-    { 13, 4, 0, 0, -2, 13, 606 }, // ̲
-    { 13, 6, 0, 5, 22, 20, 619 }, // ̴
-    { 14, 3, 0, 4, 10, 11, 639 }, // ̵
-    { 5, 6, 0, 2, -2, 8, 650 }, // ̹
-    { 11, 5, 0, -2, -1, 14, 658 }, // ̺
-    { 11, 8, 0, 0, 0, 22, 672 }, // ̻
-    { 11, 6, 0, 0, 0, 17, 694 }, // ̼
-    { 8, 6, 0, 6, 22, 12, 711 }, // ̽
-    { 13, 6, 0, 5, 22, 20, 723 }, // ͂
-    { 5, 5, 0, 6, 24, 7, 743 }, // ̓
-    { 14, 13, 0, 6, 31, 46, 750 }, // ̈́
-    { 10, 5, 0, 7, 23, 13, 796 }, // ͆
-    { 16, 11, 0, -1, 0, 44, 809 }, // ͇
-    { 13, 8, 0, 0, 0, 26, 853 }, // ͈
-    { 10, 7, 0, 0, -2, 18, 879 }, // ͉
-    { 14, 17, 0, 5, 28, 60, 897 }, // ͊
-    { 27, 13, 0, 10, 26, 88, 957 }, // ͋
-    { 20, 14, 0, 6, 15, 70, 1045 }, // ͌
-    { 15, 9, 0, 2, -1, 34, 1115 }, // ͍
-    { 4, 4, 0, 4, 3, 4, 1149 }, // ͎
-    { 24, 6, 0, 1, 0, 36, 1153 }, // ͜
-    { 24, 5, 0, 6, 23, 30, 1189 }, // ͡
-    { 29, 7, 0, 0, -2, 51, 1219 }, // ͢
-    { 20, 30, 18, 2, 30, 150, 0 }, // Ѐ
-    { 20, 28, 18, 2, 28, 140, 150 }, // Ё
-    { 21, 24, 30, 9, 24, 126, 290 }, // Ђ
-    { 21, 34, 19, 2, 34, 179, 416 }, // Ѓ
-    { 24, 24, 26, 1, 23, 144, 595 }, // Є
-    { 25, 27, 29, 1, 26, 169, 739 }, // Ѕ
-    { 12, 25, 12, 1, 25, 75, 908 }, // І
-    { 18, 35, 12, 1, 35, 158, 983 }, // Ї
-    { 21, 33, 18, -1, 26, 174, 1141 }, // Ј
-    { 31, 23, 34, 3, 22, 179, 1315 }, // Љ
-    { 29, 23, 33, 3, 22, 167, 1494 }, // Њ
-    { 23, 25, 27, 6, 25, 144, 1661 }, // Ћ
-    { 25, 35, 26, 1, 35, 219, 1805 }, // Ќ
-    { 26, 31, 27, 2, 31, 202, 2024 }, // Ѝ
-    { 22, 33, 20, -1, 32, 182, 2226 }, // Ў
-    { 22, 27, 21, 2, 21, 149, 2408 }, // Џ
-    { 23, 25, 29, 1, 25, 144, 2557 }, // А
-    { 20, 22, 19, 3, 21, 110, 2701 }, // Б
-    { 19, 22, 20, 2, 21, 105, 2811 }, // В
-    { 21, 22, 19, 2, 22, 116, 2916 }, // Г
-    { 22, 24, 24, 3, 21, 132, 3032 }, // Д
-    { 20, 22, 18, 2, 22, 110, 3164 }, // Е
-    { 35, 25, 37, 1, 25, 219, 3274 }, // Ж
-    { 19, 24, 21, 1, 23, 114, 3493 }, // З
-    { 26, 25, 27, 2, 25, 163, 3607 }, // И
-    { 26, 33, 27, 2, 33, 215, 3770 }, // Й
-    { 23, 25, 26, 1, 25, 144, 3985 }, // К
-    { 23, 22, 22, 2, 21, 127, 4129 }, // Л
-    { 26, 21, 25, 2, 21, 137, 4256 }, // М
-    { 27, 25, 27, 1, 25, 169, 4393 }, // Н
-    { 28, 26, 29, 2, 25, 182, 4562 }, // О
-    { 21, 22, 20, 2, 22, 116, 4744 }, // П
-    { 23, 25, 23, 1, 25, 144, 4860 }, // Р
-    { 25, 27, 25, 1, 26, 169, 5004 }, // С
-    { 23, 25, 27, 6, 25, 144, 5173 }, // Т
-    { 22, 24, 20, -1, 23, 132, 5317 }, // У
-    { 24, 22, 25, 5, 22, 132, 5449 }, // Ф
-    { 29, 25, 29, 1, 25, 182, 5581 }, // Х
-    { 20, 27, 21, 2, 22, 135, 5763 }, // Ц
-    { 18, 22, 19, 5, 22, 99, 5898 }, // Ч
-    { 25, 22, 24, 2, 22, 138, 5997 }, // Ш
-    { 25, 27, 26, 2, 22, 169, 6135 }, // Щ
-    { 17, 23, 19, 2, 22, 98, 6304 }, // Ъ
-    { 30, 24, 32, 2, 23, 180, 6402 }, // Ы
-    { 17, 23, 19, 2, 22, 98, 6582 }, // Ь
-    { 24, 24, 26, 2, 23, 144, 6680 }, // Э
-    { 28, 23, 29, 3, 22, 161, 6824 }, // Ю
-    { 23, 25, 24, 1, 25, 144, 6985 }, // Я
-    { 18, 18, 22, 1, 18, 81, 7129 }, // а
-    { 20, 23, 20, 3, 23, 115, 7210 }, // б
-    { 17, 18, 18, 0, 18, 77, 7325 }, // в
-    { 18, 17, 17, 2, 17, 77, 7402 }, // г
-    { 19, 20, 22, 3, 17, 95, 7479 }, // д
-    { 18, 17, 22, 2, 17, 77, 7574 }, // е
-    { 31, 20, 31, 0, 20, 155, 7651 }, // ж
-    { 13, 16, 13, 1, 16, 52, 7806 }, // з
-    { 19, 17, 20, 2, 17, 81, 7858 }, // и
-    { 19, 22, 20, 2, 22, 105, 7939 }, // й
-    { 18, 17, 20, 0, 17, 77, 8044 }, // к
-    { 16, 16, 15, 1, 15, 64, 8121 }, // л
-    { 23, 19, 24, 0, 19, 110, 8185 }, // м
-    { 23, 19, 23, 0, 19, 110, 8295 }, // н
-    { 17, 18, 24, 3, 17, 77, 8405 }, // о
-    { 19, 17, 19, 2, 17, 81, 8482 }, // п
-    { 23, 24, 24, -1, 16, 138, 8563 }, // р
-    { 15, 18, 20, 2, 17, 68, 8701 }, // с
-    { 16, 16, 20, 6, 16, 64, 8769 }, // т
-    { 22, 24, 23, 0, 16, 132, 8833 }, // у
-    { 24, 23, 25, 3, 16, 138, 8965 }, // ф
-    { 21, 16, 21, 2, 16, 84, 9103 }, // х
-    { 19, 21, 21, 2, 17, 100, 9187 }, // ц
-    { 13, 15, 13, 2, 15, 49, 9287 }, // ч
-    { 24, 17, 24, 2, 17, 102, 9336 }, // ш
-    { 24, 22, 26, 2, 17, 132, 9438 }, // щ
-    { 17, 17, 22, 5, 16, 73, 9570 }, // ъ
-    { 23, 18, 24, 3, 17, 104, 9643 }, // ы
-    { 16, 18, 18, 2, 17, 72, 9747 }, // ь
-    { 18, 18, 19, 2, 17, 81, 9819 }, // э
-    { 22, 19, 23, 2, 18, 105, 9900 }, // ю
-    { 19, 17, 18, 2, 17, 81, 10005 }, // я
-    { 18, 28, 22, 2, 28, 126, 10086 }, // ѐ
-    { 19, 22, 19, 3, 22, 105, 10212 }, // ё
-    { 19, 30, 22, 1, 25, 143, 10317 }, // ђ
-    { 18, 25, 17, 2, 25, 113, 10460 }, // ѓ
-    { 17, 17, 18, 0, 16, 73, 10573 }, // є
-    { 17, 16, 21, 1, 16, 68, 10646 }, // ѕ
-    { 11, 26, 11, 1, 26, 72, 10714 }, // і
-    { 15, 25, 11, 1, 25, 94, 10786 }, // ї
-    { 19, 32, 19, 2, 25, 152, 10880 }, // ј
-    { 22, 16, 23, 1, 15, 88, 11032 }, // љ
-    { 21, 16, 23, 1, 15, 84, 11120 }, // њ
-    { 19, 25, 22, 1, 25, 119, 11204 }, // ћ
-    { 18, 26, 20, 0, 26, 117, 11323 }, // ќ
-    { 19, 25, 20, 2, 25, 119, 11440 }, // ѝ
-    { 22, 36, 23, 0, 28, 198, 11559 }, // ў
-    { 16, 20, 15, 1, 15, 80, 11757 }, // џ
-    { 16, 23, 24, 8, 22, 92, 11837 }, // Ѣ
-    { 15, 22, 21, 6, 21, 83, 11929 }, // ѣ
-    { 28, 21, 30, 3, 21, 147, 12012 }, // Ѫ
-    { 20, 16, 21, 1, 15, 80, 12159 }, // ѫ
-    { 25, 27, 29, 3, 26, 169, 12239 }, // Ѳ
-    { 20, 20, 22, 2, 20, 100, 12408 }, // ѳ
-    { 33, 31, 30, 7, 31, 256, 12508 }, // Ѵ
-    { 19, 20, 24, 5, 20, 95, 12764 }, // ѵ
-    { 11, 9, 0, 8, 27, 25, 12859 }, // ҆
-    { 22, 25, 19, 2, 25, 138, 12884 }, // Ґ
-    { 19, 20, 17, 2, 20, 95, 13022 }, // ґ
-    { 21, 22, 19, 2, 22, 116, 13117 }, // Ғ
-    { 15, 15, 13, 0, 15, 57, 13233 }, // ғ
-    { 23, 24, 20, 2, 24, 138, 13290 }, // Ҕ
-    { 13, 15, 12, 0, 15, 49, 13428 }, // ҕ
-    { 35, 29, 37, -1, 25, 254, 13477 }, // Җ
-    { 25, 21, 26, -2, 18, 132, 13731 }, // җ
-    { 19, 27, 21, 2, 23, 129, 13863 }, // Ҙ
-    { 14, 23, 13, 0, 16, 81, 13992 }, // ҙ
-    { 24, 29, 26, -1, 25, 174, 14073 }, // Қ
-    { 17, 21, 18, -2, 18, 90, 14247 }, // қ
-    { 25, 21, 28, 3, 21, 132, 14337 }, // Ҝ
-    { 18, 15, 21, 2, 15, 68, 14469 }, // ҝ
-    { 23, 25, 26, 1, 25, 144, 14537 }, // Ҟ
-    { 16, 23, 22, 1, 23, 92, 14681 }, // ҟ
-    { 25, 25, 26, -1, 25, 157, 14773 }, // Ҡ
-    { 17, 18, 18, -1, 18, 77, 14930 }, // ҡ
-    { 27, 28, 27, -1, 25, 189, 15007 }, // Ң
-    { 19, 20, 19, -2, 17, 95, 15196 }, // ң
-    { 36, 26, 27, 1, 26, 234, 15291 }, // Ҥ
-    { 25, 17, 19, 0, 17, 107, 15525 }, // ҥ
-    { 31, 24, 34, 3, 24, 186, 15632 }, // Ҧ
-    { 27, 27, 31, 3, 19, 183, 15818 }, // ҧ
-    { 28, 25, 35, 4, 24, 175, 16001 }, // Ҩ
-    { 22, 20, 27, 3, 19, 110, 16176 }, // ҩ
-    { 25, 31, 25, 1, 26, 194, 16286 }, // Ҫ
-    { 15, 21, 20, 2, 17, 79, 16480 }, // ҫ
-    { 23, 28, 27, 4, 25, 161, 16559 }, // Ҭ
-    { 16, 20, 19, 2, 17, 80, 16720 }, // ҭ
-    { 21, 25, 27, 7, 25, 132, 16800 }, // Ү
-    { 16, 21, 19, 6, 15, 84, 16932 }, // ү
-    { 22, 25, 27, 6, 25, 138, 17016 }, // Ұ
-    { 21, 22, 19, 1, 15, 116, 17154 }, // ұ
-    { 29, 29, 29, -1, 25, 211, 17270 }, // Ҳ
-    { 20, 20, 20, -2, 17, 100, 17481 }, // ҳ
-    { 22, 27, 31, 8, 21, 149, 17581 }, // Ҵ
-    { 16, 19, 22, 5, 15, 76, 17730 }, // ҵ
-    { 18, 28, 24, 5, 21, 126, 17806 }, // Ҷ
-    { 13, 20, 17, 3, 15, 65, 17932 }, // ҷ
-    { 20, 22, 21, 5, 22, 110, 17997 }, // Ҹ
-    { 14, 15, 15, 3, 15, 53, 18107 }, // ҹ
-    { 18, 24, 22, 3, 24, 108, 18160 }, // Һ
-    { 19, 25, 22, 1, 25, 119, 18268 }, // һ
-    { 24, 22, 28, 2, 21, 132, 18387 }, // Ҽ
-    { 17, 16, 20, 1, 16, 68, 18519 }, // ҽ
-    { 24, 25, 32, 5, 21, 150, 18587 }, // Ҿ
-    { 17, 19, 23, 3, 16, 81, 18737 }, // ҿ
-    { 12, 25, 12, 1, 25, 75, 18818 }, // Ӏ
-    { 35, 35, 37, 1, 35, 307, 18893 }, // Ӂ
-    { 31, 31, 31, 0, 31, 241, 19200 }, // ӂ
-    { 21, 29, 23, 3, 22, 153, 19441 }, // Ӄ
-    { 15, 20, 16, 1, 15, 75, 19594 }, // ӄ
-    { 23, 27, 22, 2, 22, 156, 19669 }, // Ӆ
-    { 16, 18, 15, 1, 15, 72, 19825 }, // ӆ
-    { 27, 32, 27, 1, 25, 216, 19897 }, // Ӈ
-    { 18, 22, 19, 0, 17, 99, 20113 }, // ӈ
-    { 27, 34, 27, 1, 25, 230, 20212 }, // Ӊ
-    { 19, 23, 19, 0, 17, 110, 20442 }, // ӊ
-    { 18, 27, 20, 4, 21, 122, 20552 }, // Ӌ
-    { 13, 19, 15, 3, 15, 62, 20674 }, // ӌ
-    { 31, 34, 36, 1, 25, 264, 20736 }, // Ӎ
-    { 21, 23, 25, 0, 17, 121, 21000 }, // ӎ
-    { 9, 21, 8, 2, 21, 48, 21121 }, // ӏ
-    { 26, 35, 29, 1, 35, 228, 21169 }, // Ӑ
-    { 24, 27, 22, 1, 27, 162, 21397 }, // ӑ
-    { 26, 34, 29, 1, 34, 221, 21559 }, // Ӓ
-    { 24, 25, 22, 1, 25, 150, 21780 }, // ӓ
-    { 38, 26, 42, 1, 25, 247, 21930 }, // Ӕ
-    { 30, 18, 36, 1, 18, 135, 22177 }, // ӕ
-    { 21, 31, 18, 2, 31, 163, 22312 }, // Ӗ
-    { 20, 29, 22, 2, 29, 145, 22475 }, // ӗ
-    { 19, 17, 22, 2, 16, 81, 22620 }, // Ә
-    { 18, 19, 24, 10, 18, 86, 22701 }, // ә
-    { 23, 29, 22, 2, 28, 167, 22787 }, // Ӛ
-    { 20, 21, 24, 8, 18, 105, 22954 }, // ӛ
-    { 35, 34, 38, 1, 34, 298, 23059 }, // Ӝ
-    { 31, 29, 31, 0, 29, 225, 23357 }, // ӝ
-    { 21, 31, 21, 1, 30, 163, 23582 }, // Ӟ
-    { 20, 24, 13, 1, 24, 120, 23745 }, // ӟ
-    { 17, 21, 17, 3, 21, 90, 23865 }, // Ӡ
-    { 16, 22, 17, 2, 16, 88, 23955 }, // ӡ
-    { 26, 30, 27, 2, 30, 195, 24043 }, // Ӣ
-    { 20, 23, 20, 2, 23, 115, 24238 }, // ӣ
-    { 26, 31, 27, 2, 31, 202, 24353 }, // Ӥ
-    { 20, 24, 20, 2, 24, 120, 24555 }, // ӥ
-    { 28, 34, 29, 2, 33, 238, 24675 }, // Ӧ
-    { 20, 26, 24, 3, 25, 130, 24913 }, // ӧ
-    { 24, 22, 29, 3, 21, 132, 25043 }, // Ө
-    { 18, 16, 22, 2, 16, 72, 25175 }, // ө
-    { 24, 34, 29, 3, 33, 204, 25247 }, // Ӫ
-    { 20, 27, 22, 2, 27, 135, 25451 }, // ӫ
-    { 24, 32, 26, 2, 31, 192, 25586 }, // Ӭ
-    { 18, 25, 19, 2, 24, 113, 25778 }, // ӭ
-    { 22, 31, 20, -1, 30, 171, 25891 }, // Ӯ
-    { 23, 33, 23, 0, 25, 190, 26062 }, // ӯ
-    { 22, 32, 20, -1, 31, 176, 26252 }, // Ӱ
-    { 22, 35, 23, 0, 27, 193, 26428 }, // ӱ
-    { 25, 33, 20, -1, 32, 207, 26621 }, // Ӳ
-    { 26, 36, 23, 0, 28, 234, 26828 }, // ӳ
-    { 19, 30, 19, 5, 30, 143, 27062 }, // Ӵ
-    { 16, 24, 13, 2, 24, 96, 27205 }, // ӵ
-    { 21, 26, 19, 2, 22, 137, 27301 }, // Ӷ
-    { 15, 18, 13, 0, 15, 68, 27438 }, // ӷ
-    { 30, 33, 32, 2, 32, 248, 27506 }, // Ӹ
-    { 23, 27, 24, 3, 26, 156, 27754 }, // ӹ
-    { 29, 29, 29, 1, 25, 211, 27910 }, // Ӽ
-    { 20, 21, 20, 0, 18, 105, 28121 }, // ӽ
-    { 0, 0, 24, 0, 0, 0, 0 }, //  
-    { 0, 0, 39, 0, 0, 0, 0 }, //  
-    { 0, 0, 24, 0, 0, 0, 0 }, //  
-    { 0, 0, 39, 0, 0, 0, 0 }, //  
-    { 0, 0, 19, 0, 0, 0, 0 }, //  
-    { 0, 0, 17, 0, 0, 0, 0 }, //  
-    { 0, 0, 14, 0, 0, 0, 0 }, //  
-    { 0, 0, 19, 0, 0, 0, 0 }, //  
-    { 0, 0, 8, 0, 0, 0, 0 }, //  
-    { 0, 0, 15, 0, 0, 0, 0 }, //  
-    { 0, 0, 14, 0, 0, 0, 0 }, //  
-    { 0, 0, 9, 0, 0, 0, 0 }, // ​
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‌
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‍
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‎
-    { 0, 0, 0, 0, 0, 0, 0 }, // ‏
-    { 14, 3, 16, 4, 10, 11, 0 }, // ‐
-    { 14, 3, 16, 4, 10, 11, 11 }, // ‑
-    { 21, 3, 22, 5, 10, 16, 22 }, // ‒
-    { 20, 4, 23, 4, 10, 20, 38 }, // –
-    { 30, 4, 33, 4, 10, 30, 58 }, // —
-    { 30, 4, 33, 4, 10, 30, 88 }, // ―
-    { 19, 25, 16, 1, 21, 119, 118 }, // ‖
-    { 24, 9, 23, 0, -3, 54, 237 }, // ‗
-    { 9, 9, 10, 6, 25, 21, 291 }, // ‘
-    { 10, 9, 10, 5, 25, 23, 312 }, // ’
-    { 10, 10, 9, 0, 5, 25, 335 }, // ‚
-    { 9, 9, 10, 6, 25, 21, 360 }, // ‛
-    { 16, 9, 16, 6, 25, 36, 381 }, // “
-    { 17, 9, 17, 5, 25, 39, 417 }, // ”
-    { 10, 10, 9, 0, 5, 25, 456 }, // „
-    { 17, 9, 17, 6, 25, 39, 481 }, // ‟
-    { 16, 38, 17, 5, 30, 152, 520 }, // †
-    { 19, 38, 18, 2, 30, 181, 672 }, // ‡
-    { 19, 17, 15, 0, 20, 81, 853 }, // •
-    { 9, 9, 11, 3, 13, 21, 934 }, // ‣
-    { 6, 5, 8, 1, 5, 8, 955 }, // ․
-    { 6, 5, 8, 1, 5, 8, 963 }, // ‥
-    { 26, 5, 28, 1, 5, 33, 971 }, // …
-    { 5, 3, 7, 2, 10, 4, 1004 }, // ‧
-    { 0, 0, 37, 0, 0, 0, 1008 }, //  
-    { 24, 25, 32, 7, 23, 150, 1008 }, // ‰
-    { 10, 9, 9, 5, 25, 23, 1158 }, // ′
-    { 17, 9, 16, 5, 25, 39, 1181 }, // ″
-    { 21, 9, 25, -3, 25, 48, 1220 }, // ‴
-    { 6, 9, 10, 7, 24, 14, 1268 }, // ‵
-    { 12, 9, 15, 6, 24, 27, 1282 }, // ‶
-    { 21, 9, 25, 7, 25, 48, 1309 }, // ‷
-    { 12, 5, 16, 7, 23, 15, 1357 }, // ‸
-    { 10, 14, 12, 4, 15, 35, 1372 }, // ‹
-    { 10, 14, 12, -2, 15, 35, 1407 }, // ›
-    { 37, 29, 39, 1, 26, 269, 1442 }, // ※
-    { 14, 29, 10, 1, 29, 102, 1711 }, // ‼
-    { 20, 37, 22, 5, 35, 185, 1813 }, // ‽
-    { 15, 4, 16, 7, 24, 15, 1998 }, // ‾
-    { 13, 6, 19, 6, 20, 20, 2013 }, // ‿
-    { 20, 18, 23, 5, 25, 90, 2033 }, // ⁂
-    { 24, 24, 32, 7, 22, 144, 2123 }, // ⁄
-    { 35, 33, 37, 7, 33, 289, 2267 }, // ⁇
-    { 25, 33, 29, 7, 33, 207, 2556 }, // ⁈
-    { 30, 35, 24, 0, 33, 263, 2763 }, // ⁉
-    { 29, 46, 22, -1, 32, 334, 3026 }, // ⁒
-    { 0, 0, 141, 0, 0, 0, 3360 }, //  
-    { 10, 11, 9, 3, 24, 28, 0 }, // ⁰
-    { 8, 11, 9, 4, 24, 22, 28 }, // ⁴
-    { 10, 12, 9, 3, 25, 30, 50 }, // ⁵
-    { 9, 11, 9, 4, 24, 25, 80 }, // ⁶
-    { 8, 13, 10, 6, 25, 26, 105 }, // ⁷
-    { 10, 11, 10, 3, 24, 28, 131 }, // ⁸
-    { 10, 11, 10, 4, 24, 28, 159 }, // ⁹
-    { 18, 17, 22, 1, 17, 77, 187 }, // ⁿ
-    { 14, 15, 13, 1, 15, 53, 264 }, // ₀
-    { 8, 12, 9, -2, 7, 24, 317 }, // ₁
-    { 11, 12, 10, -2, 7, 33, 341 }, // ₂
-    { 10, 11, 9, -1, 6, 28, 374 }, // ₃
-    { 9, 11, 10, -1, 6, 25, 402 }, // ₄
-    { 9, 12, 9, -1, 7, 27, 427 }, // ₅
-    { 10, 12, 10, -1, 7, 30, 454 }, // ₆
-    { 8, 12, 10, 1, 7, 24, 484 }, // ₇
-    { 11, 11, 10, -2, 6, 31, 508 }, // ₈
-    { 10, 11, 10, -1, 6, 28, 539 }, // ₉
-    { 17, 40, 13, 3, 30, 170, 567 }, // ₍
-    { 16, 40, 13, -7, 30, 160, 737 }, // ₎
-    { 28, 37, 25, 0, 31, 259, 0 }, // ₡
-    { 25, 27, 25, 1, 26, 169, 259 }, // ₢
-    { 23, 27, 20, 1, 27, 156, 428 }, // ₤
-    { 30, 25, 27, 0, 25, 188, 584 }, // ₦
-    { 25, 25, 23, 1, 25, 157, 772 }, // ₧
-    { 33, 24, 33, 0, 24, 198, 929 }, // ₨
-    { 24, 24, 23, -1, 24, 144, 1127 }, // ₩
-    { 27, 23, 31, 5, 23, 156, 1271 }, // ₪
-    { 22, 23, 20, 2, 23, 127, 1427 }, // ₫
-    { 22, 26, 24, 3, 23, 143, 1554 }, // €
-    { 23, 25, 27, 6, 25, 144, 1697 }, // ₮
-    { 28, 25, 19, 1, 25, 175, 1841 }, // ₱
-    { 25, 34, 29, 2, 30, 213, 2016 }, // ₲
-    { 32, 27, 27, 3, 26, 216, 2229 }, // ₴
-    { 15, 23, 20, 2, 21, 87, 2445 }, // ₵
-    { 26, 26, 27, 6, 26, 169, 2532 }, // ₸
-    { 17, 22, 18, 4, 22, 94, 2701 }, // ₹
-    { 17, 21, 20, 3, 20, 90, 2795 }, // ₺
-    { 21, 23, 18, 2, 23, 121, 2885 }, // ₼
-    { 27, 25, 23, -3, 25, 169, 3006 }, // ₽
-    { 18, 18, 22, -3, 14, 81, 0 }, // ←
-    { 19, 18, 22, 4, 18, 86, 81 }, // ↑
-    { 18, 18, 22, 7, 14, 81, 167 }, // →
-    { 19, 18, 22, 9, 18, 86, 248 }, // ↓
-    { 31, 15, 26, -2, 13, 117, 334 }, // ↔
-    { 15, 30, 19, 4, 28, 113, 451 }, // ↕
-    { 17, 13, 19, -3, 13, 56, 564 }, // ↖
-    { 18, 13, 19, 4, 13, 59, 620 }, // ↗
-    { 14, 18, 19, 7, 16, 63, 679 }, // ↘
-    { 14, 18, 19, -2, 16, 63, 742 }, // ↙
-    { 22, 19, 25, 0, 18, 105, 805 }, // ⇐
-    { 23, 21, 27, 5, 21, 121, 910 }, // ⇑
-    { 22, 19, 25, 3, 18, 105, 1031 }, // ⇒
-    { 23, 22, 27, 10, 21, 127, 1136 }, // ⇓
-    { 29, 19, 28, 0, 18, 138, 1263 }, // ⇔
-    { 18, 28, 23, 7, 18, 126, 1401 }, // ⇕
-    { 21, 23, 20, 3, 23, 121, 0 }, // ∂
-    { 30, 27, 29, 0, 26, 203, 121 }, // ∅
-    { 22, 22, 25, 2, 22, 121, 324 }, // ∆
-    { 21, 21, 22, 4, 21, 111, 445 }, // ∏
-    { 21, 21, 22, 10, 21, 111, 556 }, // ∐
-    { 19, 22, 17, 2, 21, 105, 667 }, // ∑
-    { 14, 4, 18, 4, 10, 14, 772 }, // −
-    { 28, 25, 27, 3, 23, 175, 786 }, // √
-    { 26, 15, 27, 3, 18, 98, 961 }, // ∞
-    { 31, 33, 25, 0, 26, 256, 1059 }, // ∫
-    { 10, 18, 8, 1, 18, 45, 1315 }, // ∶
-    { 20, 14, 23, 6, 15, 70, 1360 }, // ≈
-    { 24, 24, 32, 7, 22, 144, 1430 }, // ≠
-    { 25, 22, 25, -1, 20, 138, 1574 }, // ≤
-    { 26, 22, 25, 1, 20, 143, 1712 }, // ≥
+    { 19, 14, 24, 3, 14, 67, 10737 }, // «
+    { 14, 9, 18, 4, 10, 32, 816 }, // ¬
+    { 14, 3, 16, 4, 10, 11, 848 }, // ­
+    { 13, 11, 16, 8, 31, 36, 859 }, // ®
+    { 11, 3, 15, 7, 21, 9, 895 }, // ¯
+    { 15, 14, 16, 5, 23, 53, 904 }, // °
+    { 17, 17, 21, 1, 16, 73, 957 }, // ±
+    { 10, 11, 9, 3, 24, 28, 1030 }, // ²
+    { 10, 11, 9, 3, 23, 28, 1058 }, // ³
+    { 7, 6, 8, 6, 23, 11, 1086 }, // ´
+    { 21, 19, 21, -1, 16, 100, 1097 }, // µ
+    { 20, 24, 18, 1, 21, 120, 1197 }, // ¶
+    { 6, 5, 8, 3, 12, 8, 1317 }, // ·
+    { 8, 8, 10, 0, 1, 16, 1325 }, // ¸
+    { 8, 11, 8, 3, 24, 22, 1341 }, // ¹
+    { 10, 9, 12, 5, 21, 23, 1363 }, // º
+    { 20, 14, 19, -4, 14, 70, 10804 }, // »
+    { 24, 28, 32, 7, 26, 168, 1386 }, // ¼
+    { 25, 27, 32, 7, 25, 169, 1554 }, // ½
+    { 25, 27, 32, 6, 25, 169, 1723 }, // ¾
+    { 19, 32, 17, -2, 17, 152, 1892 }, // ¿
+    { 23, 33, 29, 1, 33, 190, 10874 }, // À
+    { 25, 38, 29, 1, 38, 238, 11064 }, // Á
+    { 25, 32, 29, 1, 32, 200, 11302 }, // Â
+    { 26, 33, 29, 1, 33, 215, 2044 }, // Ã
+    { 27, 33, 29, 1, 33, 223, 11502 }, // Ä
+    { 24, 35, 29, 1, 35, 210, 2259 }, // Å
+    { 38, 26, 42, 1, 25, 247, 2469 }, // Æ
+    { 25, 33, 25, 1, 26, 207, 11725 }, // Ç
+    { 23, 32, 23, 1, 32, 184, 11932 }, // È
+    { 23, 38, 23, 1, 38, 219, 12116 }, // É
+    { 23, 32, 23, 1, 32, 184, 12335 }, // Ê
+    { 24, 33, 23, 1, 33, 198, 12519 }, // Ë
+    { 14, 35, 12, 1, 35, 123, 12717 }, // Ì
+    { 17, 40, 12, 1, 40, 170, 12840 }, // Í
+    { 16, 34, 12, 1, 34, 136, 13010 }, // Î
+    { 18, 35, 12, 1, 35, 158, 13146 }, // Ï
+    { 26, 25, 28, 0, 25, 163, 2716 }, // Ð
+    { 28, 32, 27, 1, 32, 224, 13304 }, // Ñ
+    { 28, 34, 29, 2, 33, 238, 13528 }, // Ò
+    { 28, 39, 29, 2, 38, 273, 13766 }, // Ó
+    { 28, 33, 29, 2, 32, 231, 14039 }, // Ô
+    { 28, 34, 29, 2, 33, 238, 2879 }, // Õ
+    { 28, 34, 29, 2, 33, 238, 14270 }, // Ö
+    { 14, 8, 17, 3, 11, 28, 3117 }, // ×
+    { 50, 49, 29, -10, 37, 613, 3145 }, // Ø
+    { 26, 35, 27, 2, 34, 228, 14508 }, // Ù
+    { 26, 39, 27, 2, 38, 254, 14736 }, // Ú
+    { 26, 33, 27, 2, 32, 215, 14990 }, // Û
+    { 26, 35, 27, 2, 34, 228, 15205 }, // Ü
+    { 21, 39, 27, 7, 39, 205, 3758 }, // Ý
+    { 19, 23, 16, 1, 23, 110, 3963 }, // Þ
+    { 20, 23, 20, 2, 23, 115, 4073 }, // ß
+    { 18, 24, 22, 1, 24, 108, 15433 }, // à
+    { 18, 28, 22, 1, 28, 126, 15541 }, // á
+    { 20, 24, 22, 1, 24, 120, 15667 }, // â
+    { 19, 23, 22, 1, 23, 110, 4188 }, // ã
+    { 20, 24, 22, 1, 24, 120, 15787 }, // ä
+    { 18, 26, 22, 1, 26, 117, 4298 }, // å
+    { 30, 18, 36, 1, 18, 135, 4415 }, // æ
+    { 15, 24, 20, 2, 17, 90, 15907 }, // ç
+    { 18, 27, 22, 2, 27, 122, 15997 }, // è
+    { 19, 32, 22, 2, 32, 152, 16119 }, // é
+    { 19, 26, 22, 2, 26, 124, 16271 }, // ê
+    { 20, 27, 22, 2, 27, 135, 16395 }, // ë
+    { 11, 24, 11, 1, 24, 66, 16530 }, // ì
+    { 14, 29, 11, 1, 29, 102, 16596 }, // í
+    { 14, 23, 11, 1, 23, 81, 16698 }, // î
+    { 15, 25, 11, 1, 25, 94, 16779 }, // ï
+    { 25, 23, 24, 3, 23, 144, 4550 }, // ð
+    { 21, 25, 22, 1, 25, 132, 16873 }, // ñ
+    { 18, 26, 22, 2, 26, 117, 17005 }, // ò
+    { 19, 31, 22, 2, 31, 148, 17122 }, // ó
+    { 19, 25, 22, 2, 25, 119, 17270 }, // ô
+    { 19, 26, 22, 2, 26, 124, 4694 }, // õ
+    { 20, 26, 22, 2, 26, 130, 17389 }, // ö
+    { 19, 18, 22, 4, 18, 86, 4818 }, // ÷
+    { 29, 45, 22, -4, 30, 327, 4904 }, // ø
+    { 18, 25, 21, 2, 24, 113, 17519 }, // ù
+    { 18, 30, 21, 2, 29, 135, 17632 }, // ú
+    { 18, 24, 21, 2, 23, 108, 17767 }, // û
+    { 19, 25, 21, 2, 24, 119, 17875 }, // ü
+    { 22, 39, 23, 0, 31, 215, 5231 }, // ý
+    { 18, 30, 16, 1, 24, 135, 5446 }, // þ
+    { 23, 35, 23, 0, 27, 202, 5581 }, // ÿ
+    { 26, 32, 29, 1, 32, 208, 5783 }, // Ā
+    { 20, 22, 22, 1, 22, 110, 5991 }, // ā
+    { 26, 36, 29, 1, 36, 234, 6101 }, // Ă
+    { 20, 26, 22, 1, 26, 130, 6335 }, // ă
+    { 23, 32, 29, 1, 25, 184, 6465 }, // Ą
+    { 18, 23, 22, 1, 18, 104, 6649 }, // ą
+    { 25, 39, 25, 1, 38, 244, 6753 }, // Ć
+    { 17, 28, 20, 2, 27, 119, 6997 }, // ć
+    { 26, 37, 25, 1, 36, 241, 7116 }, // Ĉ
+    { 19, 25, 20, 2, 24, 119, 7357 }, // ĉ
+    { 25, 37, 25, 1, 36, 232, 7476 }, // Ċ
+    { 15, 26, 20, 2, 25, 98, 7708 }, // ċ
+    { 25, 39, 25, 1, 38, 244, 7806 }, // Č
+    { 17, 27, 20, 2, 26, 115, 8050 }, // č
+    { 25, 36, 28, 1, 36, 225, 8165 }, // Ď
+    { 28, 26, 23, 1, 25, 182, 8390 }, // ď
+    { 26, 25, 28, 0, 25, 163, 8572 }, // Đ
+    { 27, 26, 23, 1, 25, 176, 8735 }, // đ
+    { 23, 32, 23, 1, 32, 184, 8911 }, // Ē
+    { 20, 26, 22, 2, 26, 130, 9095 }, // ē
+    { 23, 35, 23, 1, 35, 202, 9225 }, // Ĕ
+    { 20, 30, 22, 2, 30, 150, 9427 }, // ĕ
+    { 23, 34, 23, 1, 34, 196, 9577 }, // Ė
+    { 18, 28, 22, 2, 28, 126, 9773 }, // ė
+    { 23, 31, 23, 1, 25, 179, 9899 }, // Ę
+    { 18, 24, 22, 2, 17, 108, 10078 }, // ę
+    { 23, 35, 23, 1, 35, 202, 10186 }, // Ě
+    { 19, 30, 22, 2, 30, 143, 10388 }, // ě
+    { 26, 34, 29, 2, 34, 221, 10531 }, // Ĝ
+    { 22, 32, 22, 0, 24, 176, 10752 }, // ĝ
+    { 26, 36, 29, 2, 36, 234, 10928 }, // Ğ
+    { 21, 34, 22, 0, 26, 179, 11162 }, // ğ
+    { 25, 34, 29, 2, 34, 213, 11341 }, // Ġ
+    { 21, 33, 22, 0, 25, 174, 11554 }, // ġ
+    { 25, 39, 29, 2, 26, 244, 11728 }, // Ģ
+    { 21, 35, 22, 0, 27, 184, 11972 }, // ģ
+    { 27, 33, 27, 1, 33, 223, 12156 }, // Ĥ
+    { 19, 31, 22, 1, 31, 148, 12379 }, // ĥ
+    { 27, 24, 27, 1, 24, 162, 12527 }, // Ħ
+    { 19, 25, 22, 1, 25, 119, 12689 }, // ħ
+    { 17, 36, 12, 1, 36, 153, 12808 }, // Ĩ
+    { 14, 25, 11, 1, 25, 88, 12961 }, // ĩ
+    { 18, 34, 12, 1, 34, 153, 13049 }, // Ī
+    { 15, 23, 11, 1, 23, 87, 13202 }, // ī
+    { 14, 31, 18, 3, 25, 109, 13289 }, // Į
+    { 13, 32, 11, -1, 26, 104, 13398 }, // į
+    { 14, 36, 12, 1, 36, 126, 13502 }, // İ
+    { 8, 17, 11, 1, 17, 34, 13628 }, // ı
+    { 23, 32, 27, 1, 25, 184, 13662 }, // Ĳ
+    { 27, 34, 11, 1, 26, 230, 13846 }, // ĳ
+    { 24, 40, 18, -1, 33, 240, 14076 }, // Ĵ
+    { 24, 31, 19, 2, 24, 186, 14316 }, // ĵ
+    { 23, 36, 26, 1, 25, 207, 14502 }, // Ķ
+    { 16, 38, 22, 1, 24, 152, 14709 }, // ķ
+    { 14, 16, 16, 0, 16, 56, 14861 }, // ĸ
+    { 18, 35, 22, 1, 35, 158, 14917 }, // Ĺ
+    { 16, 34, 14, 1, 34, 136, 15075 }, // ĺ
+    { 18, 38, 22, 1, 25, 171, 15211 }, // Ļ
+    { 12, 37, 14, 0, 24, 111, 15382 }, // ļ
+    { 19, 25, 22, 1, 25, 119, 15493 }, // Ľ
+    { 18, 25, 14, 1, 25, 113, 15612 }, // ľ
+    { 20, 25, 22, 1, 25, 125, 15725 }, // Ŀ
+    { 16, 25, 14, 1, 25, 100, 15850 }, // ŀ
+    { 40, 37, 22, -14, 30, 370, 15950 }, // Ł
+    { 28, 24, 14, -10, 24, 168, 16320 }, // ł
+    { 28, 35, 27, 1, 35, 245, 16488 }, // Ń
+    { 20, 28, 22, 1, 28, 140, 16733 }, // ń
+    { 28, 36, 27, 1, 25, 252, 16873 }, // Ņ
+    { 18, 28, 22, 1, 17, 126, 17125 }, // ņ
+    { 28, 35, 27, 1, 35, 245, 17251 }, // Ň
+    { 20, 28, 22, 1, 28, 140, 17496 }, // ň
+    { 20, 30, 20, -3, 30, 150, 17636 }, // ŉ
+    { 28, 32, 27, 1, 25, 224, 17786 }, // Ŋ
+    { 18, 22, 22, 1, 17, 99, 18010 }, // ŋ
+    { 28, 33, 29, 2, 32, 231, 18109 }, // Ō
+    { 20, 25, 22, 2, 25, 125, 18340 }, // ō
+    { 28, 36, 29, 2, 35, 252, 18465 }, // Ŏ
+    { 20, 29, 22, 2, 29, 145, 18717 }, // ŏ
+    { 29, 35, 29, 2, 34, 254, 18862 }, // Ő
+    { 23, 27, 22, 2, 27, 156, 19116 }, // ő
+    { 38, 25, 35, 2, 25, 238, 17994 }, // Œ
+    { 30, 17, 31, 2, 17, 128, 18232 }, // œ
+    { 22, 34, 24, 1, 34, 187, 19272 }, // Ŕ
+    { 15, 25, 17, 1, 25, 94, 19459 }, // ŕ
+    { 22, 39, 24, 1, 25, 215, 19553 }, // Ŗ
+    { 18, 32, 17, -2, 17, 144, 19768 }, // ŗ
+    { 22, 34, 24, 1, 34, 187, 19912 }, // Ř
+    { 15, 25, 17, 1, 25, 94, 20099 }, // ř
+    { 25, 38, 29, 1, 37, 238, 20193 }, // Ś
+    { 17, 27, 21, 1, 27, 115, 20431 }, // ś
+    { 26, 35, 29, 1, 34, 228, 20546 }, // Ŝ
+    { 19, 24, 21, 1, 24, 114, 20774 }, // ŝ
+    { 25, 33, 29, 1, 26, 207, 20888 }, // Ş
+    { 17, 24, 21, 1, 16, 102, 21095 }, // ş
+    { 25, 38, 29, 1, 37, 238, 21197 }, // Š
+    { 17, 27, 21, 1, 27, 115, 21435 }, // š
+    { 23, 31, 27, 6, 25, 179, 21550 }, // Ţ
+    { 13, 28, 19, 4, 22, 91, 21729 }, // ţ
+    { 23, 35, 27, 6, 35, 202, 21820 }, // Ť
+    { 17, 25, 19, 4, 25, 107, 22022 }, // ť
+    { 23, 25, 27, 6, 25, 144, 22129 }, // Ŧ
+    { 15, 22, 19, 2, 22, 83, 22273 }, // ŧ
+    { 26, 36, 27, 2, 35, 234, 22356 }, // Ũ
+    { 18, 26, 21, 2, 25, 117, 22590 }, // ũ
+    { 26, 34, 27, 2, 33, 221, 22707 }, // Ū
+    { 19, 24, 21, 2, 23, 114, 22928 }, // ū
+    { 26, 37, 27, 2, 36, 241, 23042 }, // Ŭ
+    { 19, 27, 21, 2, 26, 129, 23283 }, // ŭ
+    { 26, 38, 27, 2, 37, 247, 23412 }, // Ů
+    { 18, 28, 21, 2, 27, 126, 23659 }, // ů
+    { 28, 36, 27, 2, 35, 252, 23785 }, // Ű
+    { 22, 26, 21, 2, 25, 143, 24037 }, // ű
+    { 26, 31, 27, 2, 25, 202, 24180 }, // Ų
+    { 18, 23, 21, 2, 16, 104, 24382 }, // ų
+    { 33, 32, 37, 6, 32, 264, 24486 }, // Ŵ
+    { 23, 24, 28, 5, 24, 138, 24750 }, // ŵ
+    { 21, 33, 27, 7, 33, 174, 24888 }, // Ŷ
+    { 22, 33, 23, 0, 25, 182, 25062 }, // ŷ
+    { 21, 34, 27, 7, 34, 179, 25244 }, // Ÿ
+    { 29, 35, 29, 1, 35, 254, 25423 }, // Ź
+    { 20, 27, 22, 1, 27, 135, 25677 }, // ź
+    { 29, 33, 29, 1, 33, 240, 25812 }, // Ż
+    { 20, 25, 22, 1, 25, 125, 26052 }, // ż
+    { 29, 35, 29, 1, 35, 254, 26177 }, // Ž
+    { 20, 27, 22, 1, 27, 135, 26431 }, // ž
+    { 16, 24, 15, 4, 24, 96, 26566 }, // ſ
+    { 9, 5, 0, 7, 22, 12, 26662 }, // ̀
+    { 7, 6, 0, 6, 23, 11, 26674 }, // ́
+    { 13, 6, 0, -1, 0, 20, 26685 }, // ̂
+    { 13, 6, 0, 5, 22, 20, 26705 }, // ̃
+    { 14, 4, 0, 5, 20, 14, 26725 }, // ̄
+    { 19, 4, 0, 9, 26, 19, 26739 }, // ̅
+    { 13, 6, 0, 6, 21, 20, 26758 }, // ̆
+    { 6, 5, 0, 6, 22, 8, 26778 }, // ̇
+    { 14, 5, 0, 6, 23, 18, 26786 }, // ̈
+    { 7, 6, 0, 5, 19, 11, 26804 }, // ̉
+    { 8, 6, 0, 6, 22, 12, 26815 }, // ̊
+    { 20, 5, 0, 6, 22, 25, 26827 }, // ̋
+    { 12, 6, 0, 6, 22, 18, 26852 }, // ̌
+    { 21, 5, 0, -9, 24, 27, 26870 }, // ̏
+    { 10, 9, 0, 4, 22, 23, 26897 }, // ̒
+    { 10, 9, 0, 4, 22, 23, 26920 }, // ̓
+    { 10, 9, 0, -5, 22, 23, 26943 }, // ̔
+    { 7, 7, 0, 0, -1, 13, 26966 }, // ̘
+    { 7, 7, 0, 2, -1, 13, 26979 }, // ̙
+    { 12, 7, 0, 8, 23, 21, 26992 }, // ̚
+    { 6, 7, 0, 5, 19, 11, 27013 }, // ̛
+    { 5, 6, 0, 0, -2, 8, 27024 }, // ̜
+    { 7, 6, 0, 3, 5, 11, 27032 }, // ̝
+    { 7, 6, 0, 0, -1, 11, 27043 }, // ̞
+    { 7, 7, 0, 0, -2, 13, 27054 }, // ̟
+    { 14, 4, 0, 0, -4, 14, 27067 }, // ̠
+    { 6, 5, 0, 0, 1, 8, 27081 }, // ̣
+    { 15, 5, 0, -1, -1, 19, 27089 }, // ̤
+    { 8, 6, 0, 6, 22, 12, 27108 }, // ̥
+    { 10, 10, 0, 0, 5, 25, 27120 }, // ̦
+    { 8, 8, 0, 0, 1, 16, 27145 }, // ̧
+    { 8, 8, 0, 0, 1, 16, 27161 }, // ̨
+    { 6, 8, 0, -1, -2, 12, 27177 }, // ̩
+    { 11, 5, 0, 0, -1, 14, 27189 }, // ̪
+    { 12, 6, 0, 0, 0, 18, 27203 }, // ̬
+    { 12, 6, 0, -1, -1, 18, 27221 }, // ̭
+    { 13, 6, 0, 5, 22, 20, 27239 }, // ̰
+    { 11, 3, 0, 7, 21, 9, 27259 }, // ̱
+    { 13, 4, 0, 0, -2, 13, 27268 }, // ̲
+    { 13, 6, 0, 5, 22, 20, 27281 }, // ̴
+    { 14, 3, 0, 4, 10, 11, 27301 }, // ̵
+    { 5, 6, 0, 2, -2, 8, 27312 }, // ̹
+    { 11, 5, 0, -2, -1, 14, 27320 }, // ̺
+    { 11, 8, 0, 0, 0, 22, 27334 }, // ̻
+    { 11, 6, 0, 0, 0, 17, 27356 }, // ̼
+    { 8, 6, 0, 6, 22, 12, 27373 }, // ̽
+    { 13, 6, 0, 5, 22, 20, 27385 }, // ͂
+    { 5, 5, 0, 6, 24, 7, 27405 }, // ̓
+    { 14, 13, 0, 6, 31, 46, 27412 }, // ̈́
+    { 10, 5, 0, 7, 23, 13, 27458 }, // ͆
+    { 16, 11, 0, -1, 0, 44, 27471 }, // ͇
+    { 13, 8, 0, 0, 0, 26, 27515 }, // ͈
+    { 10, 7, 0, 0, -2, 18, 27541 }, // ͉
+    { 14, 17, 0, 5, 28, 60, 27559 }, // ͊
+    { 27, 13, 0, 10, 26, 88, 27619 }, // ͋
+    { 20, 14, 0, 6, 15, 70, 27707 }, // ͌
+    { 15, 9, 0, 2, -1, 34, 27777 }, // ͍
+    { 4, 4, 0, 4, 3, 4, 27811 }, // ͎
+    { 24, 6, 0, 1, 0, 36, 27815 }, // ͜
+    { 24, 5, 0, 6, 23, 30, 27851 }, // ͡
+    { 29, 7, 0, 0, -2, 51, 27881 }, // ͢
+    { 20, 30, 18, 2, 30, 150, 27932 }, // Ѐ
+    { 20, 28, 18, 2, 28, 140, 0 }, // Ё
+    { 21, 24, 30, 9, 24, 126, 28082 }, // Ђ
+    { 21, 34, 19, 2, 34, 179, 0 }, // Ѓ
+    { 24, 24, 26, 1, 23, 144, 179 }, // Є
+    { 25, 27, 29, 1, 26, 169, 323 }, // Ѕ
+    { 12, 25, 12, 1, 25, 75, 492 }, // І
+    { 18, 35, 12, 1, 35, 158, 567 }, // Ї
+    { 21, 33, 18, -1, 26, 174, 725 }, // Ј
+    { 31, 23, 34, 3, 22, 179, 899 }, // Љ
+    { 29, 23, 33, 3, 22, 167, 1078 }, // Њ
+    { 23, 25, 27, 6, 25, 144, 1245 }, // Ћ
+    { 25, 35, 26, 1, 35, 219, 1389 }, // Ќ
+    { 26, 31, 27, 2, 31, 202, 1608 }, // Ѝ
+    { 22, 33, 20, -1, 32, 182, 1810 }, // Ў
+    { 22, 27, 21, 2, 21, 149, 1992 }, // Џ
+    { 23, 25, 29, 1, 25, 144, 140 }, // А
+    { 20, 22, 19, 3, 21, 110, 284 }, // Б
+    { 19, 22, 20, 2, 21, 105, 394 }, // В
+    { 21, 22, 19, 2, 22, 116, 499 }, // Г
+    { 22, 24, 24, 3, 21, 132, 615 }, // Д
+    { 20, 22, 18, 2, 22, 110, 747 }, // Е
+    { 35, 25, 37, 1, 25, 219, 857 }, // Ж
+    { 19, 24, 21, 1, 23, 114, 1076 }, // З
+    { 26, 25, 27, 2, 25, 163, 1190 }, // И
+    { 26, 33, 27, 2, 33, 215, 1353 }, // Й
+    { 23, 25, 26, 1, 25, 144, 1568 }, // К
+    { 23, 22, 22, 2, 21, 127, 1712 }, // Л
+    { 26, 21, 25, 2, 21, 137, 1839 }, // М
+    { 27, 25, 27, 1, 25, 169, 1976 }, // Н
+    { 28, 26, 29, 2, 25, 182, 2145 }, // О
+    { 21, 22, 20, 2, 22, 116, 2327 }, // П
+    { 23, 25, 23, 1, 25, 144, 2443 }, // Р
+    { 25, 27, 25, 1, 26, 169, 2587 }, // С
+    { 23, 25, 27, 6, 25, 144, 2756 }, // Т
+    { 22, 24, 20, -1, 23, 132, 2900 }, // У
+    { 24, 22, 25, 5, 22, 132, 3032 }, // Ф
+    { 29, 25, 29, 1, 25, 182, 3164 }, // Х
+    { 20, 27, 21, 2, 22, 135, 3346 }, // Ц
+    { 18, 22, 19, 5, 22, 99, 3481 }, // Ч
+    { 25, 22, 24, 2, 22, 138, 3580 }, // Ш
+    { 25, 27, 26, 2, 22, 169, 3718 }, // Щ
+    { 17, 23, 19, 2, 22, 98, 3887 }, // Ъ
+    { 30, 24, 32, 2, 23, 180, 3985 }, // Ы
+    { 17, 23, 19, 2, 22, 98, 4165 }, // Ь
+    { 24, 24, 26, 2, 23, 144, 4263 }, // Э
+    { 28, 23, 29, 3, 22, 161, 4407 }, // Ю
+    { 23, 25, 24, 1, 25, 144, 4568 }, // Я
+    { 18, 18, 22, 1, 18, 81, 4712 }, // а
+    { 20, 23, 20, 3, 23, 115, 4793 }, // б
+    { 17, 18, 18, 0, 18, 77, 4908 }, // в
+    { 18, 17, 17, 2, 17, 77, 4985 }, // г
+    { 19, 20, 22, 3, 17, 95, 5062 }, // д
+    { 18, 17, 22, 2, 17, 77, 5157 }, // е
+    { 31, 20, 31, 0, 20, 155, 5234 }, // ж
+    { 13, 16, 13, 1, 16, 52, 5389 }, // з
+    { 19, 17, 20, 2, 17, 81, 5441 }, // и
+    { 19, 22, 20, 2, 22, 105, 5522 }, // й
+    { 18, 17, 20, 0, 17, 77, 5627 }, // к
+    { 16, 16, 15, 1, 15, 64, 5704 }, // л
+    { 23, 19, 24, 0, 19, 110, 5768 }, // м
+    { 23, 19, 23, 0, 19, 110, 5878 }, // н
+    { 17, 18, 24, 3, 17, 77, 5988 }, // о
+    { 19, 17, 19, 2, 17, 81, 6065 }, // п
+    { 23, 24, 24, -1, 16, 138, 6146 }, // р
+    { 15, 18, 20, 2, 17, 68, 6284 }, // с
+    { 16, 16, 20, 6, 16, 64, 6352 }, // т
+    { 22, 24, 23, 0, 16, 132, 6416 }, // у
+    { 24, 23, 25, 3, 16, 138, 6548 }, // ф
+    { 21, 16, 21, 2, 16, 84, 6686 }, // х
+    { 19, 21, 21, 2, 17, 100, 6770 }, // ц
+    { 13, 15, 13, 2, 15, 49, 6870 }, // ч
+    { 24, 17, 24, 2, 17, 102, 6919 }, // ш
+    { 24, 22, 26, 2, 17, 132, 7021 }, // щ
+    { 17, 17, 22, 5, 16, 73, 7153 }, // ъ
+    { 23, 18, 24, 3, 17, 104, 7226 }, // ы
+    { 16, 18, 18, 2, 17, 72, 7330 }, // ь
+    { 18, 18, 19, 2, 17, 81, 7402 }, // э
+    { 22, 19, 23, 2, 18, 105, 7483 }, // ю
+    { 19, 17, 18, 2, 17, 81, 7588 }, // я
+    { 18, 28, 22, 2, 28, 126, 2141 }, // ѐ
+    { 19, 22, 19, 3, 22, 105, 7669 }, // ё
+    { 19, 30, 22, 1, 25, 143, 2267 }, // ђ
+    { 18, 25, 17, 2, 25, 113, 2410 }, // ѓ
+    { 17, 17, 18, 0, 16, 73, 2523 }, // є
+    { 17, 16, 21, 1, 16, 68, 2596 }, // ѕ
+    { 11, 26, 11, 1, 26, 72, 2664 }, // і
+    { 15, 25, 11, 1, 25, 94, 2736 }, // ї
+    { 19, 32, 19, 2, 25, 152, 2830 }, // ј
+    { 22, 16, 23, 1, 15, 88, 2982 }, // љ
+    { 21, 16, 23, 1, 15, 84, 3070 }, // њ
+    { 19, 25, 22, 1, 25, 119, 3154 }, // ћ
+    { 18, 26, 20, 0, 26, 117, 3273 }, // ќ
+    { 19, 25, 20, 2, 25, 119, 3390 }, // ѝ
+    { 22, 36, 23, 0, 28, 198, 3509 }, // ў
+    { 16, 20, 15, 1, 15, 80, 3707 }, // џ
+    { 16, 23, 24, 8, 22, 92, 3787 }, // Ѣ
+    { 15, 22, 21, 6, 21, 83, 3879 }, // ѣ
+    { 28, 21, 30, 3, 21, 147, 3962 }, // Ѫ
+    { 20, 16, 21, 1, 15, 80, 4109 }, // ѫ
+    { 25, 27, 29, 3, 26, 169, 4189 }, // Ѳ
+    { 20, 20, 22, 2, 20, 100, 4358 }, // ѳ
+    { 33, 31, 30, 7, 31, 256, 4458 }, // Ѵ
+    { 19, 20, 24, 5, 20, 95, 4714 }, // ѵ
+    { 11, 9, 0, 8, 27, 25, 4809 }, // ҆
+    { 22, 25, 19, 2, 25, 138, 4834 }, // Ґ
+    { 19, 20, 17, 2, 20, 95, 4972 }, // ґ
+    { 21, 22, 19, 2, 22, 116, 5067 }, // Ғ
+    { 15, 15, 13, 0, 15, 57, 5183 }, // ғ
+    { 23, 24, 20, 2, 24, 138, 5240 }, // Ҕ
+    { 13, 15, 12, 0, 15, 49, 5378 }, // ҕ
+    { 35, 29, 37, -1, 25, 254, 5427 }, // Җ
+    { 25, 21, 26, -2, 18, 132, 5681 }, // җ
+    { 19, 27, 21, 2, 23, 129, 5813 }, // Ҙ
+    { 14, 23, 13, 0, 16, 81, 5942 }, // ҙ
+    { 24, 29, 26, -1, 25, 174, 6023 }, // Қ
+    { 17, 21, 18, -2, 18, 90, 6197 }, // қ
+    { 25, 21, 28, 3, 21, 132, 6287 }, // Ҝ
+    { 18, 15, 21, 2, 15, 68, 6419 }, // ҝ
+    { 23, 25, 26, 1, 25, 144, 6487 }, // Ҟ
+    { 16, 23, 22, 1, 23, 92, 6631 }, // ҟ
+    { 25, 25, 26, -1, 25, 157, 6723 }, // Ҡ
+    { 17, 18, 18, -1, 18, 77, 6880 }, // ҡ
+    { 27, 28, 27, -1, 25, 189, 6957 }, // Ң
+    { 19, 20, 19, -2, 17, 95, 7146 }, // ң
+    { 36, 26, 27, 1, 26, 234, 7241 }, // Ҥ
+    { 25, 17, 19, 0, 17, 107, 7475 }, // ҥ
+    { 31, 24, 34, 3, 24, 186, 7582 }, // Ҧ
+    { 27, 27, 31, 3, 19, 183, 7768 }, // ҧ
+    { 28, 25, 35, 4, 24, 175, 7951 }, // Ҩ
+    { 22, 20, 27, 3, 19, 110, 8126 }, // ҩ
+    { 25, 31, 25, 1, 26, 194, 8236 }, // Ҫ
+    { 15, 21, 20, 2, 17, 79, 8430 }, // ҫ
+    { 23, 28, 27, 4, 25, 161, 8509 }, // Ҭ
+    { 16, 20, 19, 2, 17, 80, 8670 }, // ҭ
+    { 21, 25, 27, 7, 25, 132, 8750 }, // Ү
+    { 16, 21, 19, 6, 15, 84, 8882 }, // ү
+    { 22, 25, 27, 6, 25, 138, 8966 }, // Ұ
+    { 21, 22, 19, 1, 15, 116, 9104 }, // ұ
+    { 29, 29, 29, -1, 25, 211, 9220 }, // Ҳ
+    { 20, 20, 20, -2, 17, 100, 9431 }, // ҳ
+    { 22, 27, 31, 8, 21, 149, 9531 }, // Ҵ
+    { 16, 19, 22, 5, 15, 76, 9680 }, // ҵ
+    { 18, 28, 24, 5, 21, 126, 9756 }, // Ҷ
+    { 13, 20, 17, 3, 15, 65, 9882 }, // ҷ
+    { 20, 22, 21, 5, 22, 110, 9947 }, // Ҹ
+    { 14, 15, 15, 3, 15, 53, 10057 }, // ҹ
+    { 18, 24, 22, 3, 24, 108, 10110 }, // Һ
+    { 19, 25, 22, 1, 25, 119, 10218 }, // һ
+    { 24, 22, 28, 2, 21, 132, 10337 }, // Ҽ
+    { 17, 16, 20, 1, 16, 68, 10469 }, // ҽ
+    { 24, 25, 32, 5, 21, 150, 10537 }, // Ҿ
+    { 17, 19, 23, 3, 16, 81, 10687 }, // ҿ
+    { 12, 25, 12, 1, 25, 75, 10768 }, // Ӏ
+    { 35, 35, 37, 1, 35, 307, 10843 }, // Ӂ
+    { 31, 31, 31, 0, 31, 241, 11150 }, // ӂ
+    { 21, 29, 23, 3, 22, 153, 11391 }, // Ӄ
+    { 15, 20, 16, 1, 15, 75, 11544 }, // ӄ
+    { 23, 27, 22, 2, 22, 156, 11619 }, // Ӆ
+    { 16, 18, 15, 1, 15, 72, 11775 }, // ӆ
+    { 27, 32, 27, 1, 25, 216, 11847 }, // Ӈ
+    { 18, 22, 19, 0, 17, 99, 12063 }, // ӈ
+    { 27, 34, 27, 1, 25, 230, 12162 }, // Ӊ
+    { 19, 23, 19, 0, 17, 110, 12392 }, // ӊ
+    { 18, 27, 20, 4, 21, 122, 12502 }, // Ӌ
+    { 13, 19, 15, 3, 15, 62, 12624 }, // ӌ
+    { 31, 34, 36, 1, 25, 264, 12686 }, // Ӎ
+    { 21, 23, 25, 0, 17, 121, 12950 }, // ӎ
+    { 9, 21, 8, 2, 21, 48, 13071 }, // ӏ
+    { 26, 35, 29, 1, 35, 228, 13119 }, // Ӑ
+    { 24, 27, 22, 1, 27, 162, 13347 }, // ӑ
+    { 26, 34, 29, 1, 34, 221, 13509 }, // Ӓ
+    { 24, 25, 22, 1, 25, 150, 13730 }, // ӓ
+    { 38, 26, 42, 1, 25, 247, 13880 }, // Ӕ
+    { 30, 18, 36, 1, 18, 135, 14127 }, // ӕ
+    { 21, 31, 18, 2, 31, 163, 14262 }, // Ӗ
+    { 20, 29, 22, 2, 29, 145, 14425 }, // ӗ
+    { 19, 17, 22, 2, 16, 81, 14570 }, // Ә
+    { 18, 19, 24, 10, 18, 86, 14651 }, // ә
+    { 23, 29, 22, 2, 28, 167, 14737 }, // Ӛ
+    { 20, 21, 24, 8, 18, 105, 14904 }, // ӛ
+    { 35, 34, 38, 1, 34, 298, 15009 }, // Ӝ
+    { 31, 29, 31, 0, 29, 225, 15307 }, // ӝ
+    { 21, 31, 21, 1, 30, 163, 15532 }, // Ӟ
+    { 20, 24, 13, 1, 24, 120, 15695 }, // ӟ
+    { 17, 21, 17, 3, 21, 90, 15815 }, // Ӡ
+    { 16, 22, 17, 2, 16, 88, 15905 }, // ӡ
+    { 26, 30, 27, 2, 30, 195, 15993 }, // Ӣ
+    { 20, 23, 20, 2, 23, 115, 16188 }, // ӣ
+    { 26, 31, 27, 2, 31, 202, 16303 }, // Ӥ
+    { 20, 24, 20, 2, 24, 120, 16505 }, // ӥ
+    { 28, 34, 29, 2, 33, 238, 16625 }, // Ӧ
+    { 20, 26, 24, 3, 25, 130, 16863 }, // ӧ
+    { 24, 22, 29, 3, 21, 132, 16993 }, // Ө
+    { 18, 16, 22, 2, 16, 72, 17125 }, // ө
+    { 24, 34, 29, 3, 33, 204, 17197 }, // Ӫ
+    { 20, 27, 22, 2, 27, 135, 17401 }, // ӫ
+    { 24, 32, 26, 2, 31, 192, 17536 }, // Ӭ
+    { 18, 25, 19, 2, 24, 113, 17728 }, // ӭ
+    { 22, 31, 20, -1, 30, 171, 17841 }, // Ӯ
+    { 23, 33, 23, 0, 25, 190, 18012 }, // ӯ
+    { 22, 32, 20, -1, 31, 176, 18202 }, // Ӱ
+    { 22, 35, 23, 0, 27, 193, 18378 }, // ӱ
+    { 25, 33, 20, -1, 32, 207, 18571 }, // Ӳ
+    { 26, 36, 23, 0, 28, 234, 18778 }, // ӳ
+    { 19, 30, 19, 5, 30, 143, 19012 }, // Ӵ
+    { 16, 24, 13, 2, 24, 96, 19155 }, // ӵ
+    { 21, 26, 19, 2, 22, 137, 19251 }, // Ӷ
+    { 15, 18, 13, 0, 15, 68, 19388 }, // ӷ
+    { 30, 33, 32, 2, 32, 248, 19456 }, // Ӹ
+    { 23, 27, 24, 3, 26, 156, 19704 }, // ӹ
+    { 29, 29, 29, 1, 25, 211, 19860 }, // Ӽ
+    { 20, 21, 20, 0, 18, 105, 20071 }, // ӽ
+    { 0, 0, 24, 0, 0, 0, 20176 }, //  
+    { 0, 0, 39, 0, 0, 0, 20176 }, //  
+    { 0, 0, 24, 0, 0, 0, 20176 }, //  
+    { 0, 0, 39, 0, 0, 0, 20176 }, //  
+    { 0, 0, 19, 0, 0, 0, 20176 }, //  
+    { 0, 0, 17, 0, 0, 0, 20176 }, //  
+    { 0, 0, 14, 0, 0, 0, 20176 }, //  
+    { 0, 0, 19, 0, 0, 0, 20176 }, //  
+    { 0, 0, 8, 0, 0, 0, 20176 }, //  
+    { 0, 0, 15, 0, 0, 0, 20176 }, //  
+    { 0, 0, 14, 0, 0, 0, 20176 }, //  
+    { 0, 0, 9, 0, 0, 0, 20176 }, // ​
+    { 0, 0, 0, 0, 0, 0, 20176 }, // ‌
+    { 0, 0, 0, 0, 0, 0, 20176 }, // ‍
+    { 0, 0, 0, 0, 0, 0, 20176 }, // ‎
+    { 0, 0, 0, 0, 0, 0, 20176 }, // ‏
+    { 14, 3, 16, 4, 10, 11, 20176 }, // ‐
+    { 14, 3, 16, 4, 10, 11, 20187 }, // ‑
+    { 21, 3, 22, 5, 10, 16, 20198 }, // ‒
+    { 20, 4, 23, 4, 10, 20, 18360 }, // –
+    { 30, 4, 33, 4, 10, 30, 18380 }, // —
+    { 30, 4, 33, 4, 10, 30, 20214 }, // ―
+    { 19, 25, 16, 1, 21, 119, 20244 }, // ‖
+    { 24, 9, 23, 0, -3, 54, 20363 }, // ‗
+    { 9, 9, 10, 6, 25, 21, 18410 }, // ‘
+    { 10, 9, 10, 5, 25, 23, 18431 }, // ’
+    { 10, 10, 9, 0, 5, 25, 20417 }, // ‚
+    { 9, 9, 10, 6, 25, 21, 20442 }, // ‛
+    { 16, 9, 16, 6, 25, 36, 18454 }, // “
+    { 17, 9, 17, 5, 25, 39, 18490 }, // ”
+    { 10, 10, 9, 0, 5, 25, 20463 }, // „
+    { 17, 9, 17, 6, 25, 39, 20488 }, // ‟
+    { 16, 38, 17, 5, 30, 152, 20527 }, // †
+    { 19, 38, 18, 2, 30, 181, 20679 }, // ‡
+    { 19, 17, 15, 0, 20, 81, 20860 }, // •
+    { 9, 9, 11, 3, 13, 21, 20941 }, // ‣
+    { 6, 5, 8, 1, 5, 8, 20962 }, // ․
+    { 6, 5, 8, 1, 5, 8, 20970 }, // ‥
+    { 26, 5, 28, 1, 5, 33, 18529 }, // …
+    { 5, 3, 7, 2, 10, 4, 20978 }, // ‧
+    { 0, 0, 37, 0, 0, 0, 20982 }, //  
+    { 24, 25, 32, 7, 23, 150, 20982 }, // ‰
+    { 10, 9, 9, 5, 25, 23, 21132 }, // ′
+    { 17, 9, 16, 5, 25, 39, 21155 }, // ″
+    { 21, 9, 25, -3, 25, 48, 21194 }, // ‴
+    { 6, 9, 10, 7, 24, 14, 21242 }, // ‵
+    { 12, 9, 15, 6, 24, 27, 21256 }, // ‶
+    { 21, 9, 25, 7, 25, 48, 21283 }, // ‷
+    { 12, 5, 16, 7, 23, 15, 21331 }, // ‸
+    { 10, 14, 12, 4, 15, 35, 21346 }, // ‹
+    { 10, 14, 12, -2, 15, 35, 21381 }, // ›
+    { 37, 29, 39, 1, 26, 269, 21416 }, // ※
+    { 14, 29, 10, 1, 29, 102, 21685 }, // ‼
+    { 20, 37, 22, 5, 35, 185, 21787 }, // ‽
+    { 15, 4, 16, 7, 24, 15, 21972 }, // ‾
+    { 13, 6, 19, 6, 20, 20, 21987 }, // ‿
+    { 20, 18, 23, 5, 25, 90, 22007 }, // ⁂
+    { 24, 24, 32, 7, 22, 144, 22097 }, // ⁄
+    { 35, 33, 37, 7, 33, 289, 22241 }, // ⁇
+    { 25, 33, 29, 7, 33, 207, 22530 }, // ⁈
+    { 30, 35, 24, 0, 33, 263, 22737 }, // ⁉
+    { 29, 46, 22, -1, 32, 334, 23000 }, // ⁒
+    { 0, 0, 141, 0, 0, 0, 23334 }, //  
+    { 10, 11, 9, 3, 24, 28, 23334 }, // ⁰
+    { 8, 11, 9, 4, 24, 22, 23362 }, // ⁴
+    { 10, 12, 9, 3, 25, 30, 23384 }, // ⁵
+    { 9, 11, 9, 4, 24, 25, 23414 }, // ⁶
+    { 8, 13, 10, 6, 25, 26, 23439 }, // ⁷
+    { 10, 11, 10, 3, 24, 28, 23465 }, // ⁸
+    { 10, 11, 10, 4, 24, 28, 23493 }, // ⁹
+    { 18, 17, 22, 1, 17, 77, 23521 }, // ⁿ
+    { 14, 15, 13, 1, 15, 53, 23598 }, // ₀
+    { 8, 12, 9, -2, 7, 24, 23651 }, // ₁
+    { 11, 12, 10, -2, 7, 33, 23675 }, // ₂
+    { 10, 11, 9, -1, 6, 28, 23708 }, // ₃
+    { 9, 11, 10, -1, 6, 25, 23736 }, // ₄
+    { 9, 12, 9, -1, 7, 27, 23761 }, // ₅
+    { 10, 12, 10, -1, 7, 30, 23788 }, // ₆
+    { 8, 12, 10, 1, 7, 24, 23818 }, // ₇
+    { 11, 11, 10, -2, 6, 31, 23842 }, // ₈
+    { 10, 11, 10, -1, 6, 28, 23873 }, // ₉
+    { 17, 40, 13, 3, 30, 170, 23901 }, // ₍
+    { 16, 40, 13, -7, 30, 160, 24071 }, // ₎
+    { 28, 37, 25, 0, 31, 259, 24231 }, // ₡
+    { 25, 27, 25, 1, 26, 169, 24490 }, // ₢
+    { 23, 27, 20, 1, 27, 156, 24659 }, // ₤
+    { 30, 25, 27, 0, 25, 188, 24815 }, // ₦
+    { 25, 25, 23, 1, 25, 157, 25003 }, // ₧
+    { 33, 24, 33, 0, 24, 198, 25160 }, // ₨
+    { 24, 24, 23, -1, 24, 144, 25358 }, // ₩
+    { 27, 23, 31, 5, 23, 156, 25502 }, // ₪
+    { 22, 23, 20, 2, 23, 127, 25658 }, // ₫
+    { 22, 26, 24, 3, 23, 143, 25785 }, // €
+    { 23, 25, 27, 6, 25, 144, 25928 }, // ₮
+    { 28, 25, 19, 1, 25, 175, 26072 }, // ₱
+    { 25, 34, 29, 2, 30, 213, 26247 }, // ₲
+    { 32, 27, 27, 3, 26, 216, 26460 }, // ₴
+    { 15, 23, 20, 2, 21, 87, 26676 }, // ₵
+    { 26, 26, 27, 6, 26, 169, 26763 }, // ₸
+    { 17, 22, 18, 4, 22, 94, 26932 }, // ₹
+    { 17, 21, 20, 3, 20, 90, 27026 }, // ₺
+    { 21, 23, 18, 2, 23, 121, 27116 }, // ₼
+    { 27, 25, 23, -3, 25, 169, 27237 }, // ₽
+    { 18, 18, 22, -3, 14, 81, 27406 }, // ←
+    { 19, 18, 22, 4, 18, 86, 27487 }, // ↑
+    { 18, 18, 22, 7, 14, 81, 27573 }, // →
+    { 19, 18, 22, 9, 18, 86, 27654 }, // ↓
+    { 31, 15, 26, -2, 13, 117, 27740 }, // ↔
+    { 15, 30, 19, 4, 28, 113, 27857 }, // ↕
+    { 17, 13, 19, -3, 13, 56, 27970 }, // ↖
+    { 18, 13, 19, 4, 13, 59, 28026 }, // ↗
+    { 14, 18, 19, 7, 16, 63, 28085 }, // ↘
+    { 14, 18, 19, -2, 16, 63, 28148 }, // ↙
+    { 22, 19, 25, 0, 18, 105, 0 }, // ⇐
+    { 23, 21, 27, 5, 21, 121, 105 }, // ⇑
+    { 22, 19, 25, 3, 18, 105, 226 }, // ⇒
+    { 23, 22, 27, 10, 21, 127, 331 }, // ⇓
+    { 29, 19, 28, 0, 18, 138, 458 }, // ⇔
+    { 18, 28, 23, 7, 18, 126, 596 }, // ⇕
+    { 21, 23, 20, 3, 23, 121, 722 }, // ∂
+    { 30, 27, 29, 0, 26, 203, 843 }, // ∅
+    { 22, 22, 25, 2, 22, 121, 1046 }, // ∆
+    { 21, 21, 22, 4, 21, 111, 1167 }, // ∏
+    { 21, 21, 22, 10, 21, 111, 1278 }, // ∐
+    { 19, 22, 17, 2, 21, 105, 1389 }, // ∑
+    { 14, 4, 18, 4, 10, 14, 1494 }, // −
+    { 28, 25, 27, 3, 23, 175, 1508 }, // √
+    { 26, 15, 27, 3, 18, 98, 1683 }, // ∞
+    { 31, 33, 25, 0, 26, 256, 1781 }, // ∫
+    { 10, 18, 8, 1, 18, 45, 2037 }, // ∶
+    { 20, 14, 23, 6, 15, 70, 2082 }, // ≈
+    { 24, 24, 32, 7, 22, 144, 2152 }, // ≠
+    { 25, 22, 25, -1, 20, 138, 2296 }, // ≤
+    { 26, 22, 25, 1, 20, 143, 2434 }, // ≥
+    { 25, 24, 29, 3, 24, 150, 2577 }, // ﬀ
+    { 18, 26, 25, 3, 26, 117, 2727 }, // ﬁ
+    { 22, 24, 29, 3, 24, 132, 2844 }, // ﬂ
+    { 29, 26, 37, 3, 26, 189, 2976 }, // ﬃ
+    { 33, 24, 40, 3, 24, 198, 3165 }, // ﬄ
+    { 31, 21, 36, 1, 21, 163, 3363 }, // ﬆ
 };
 
 static const EpdUnicodeInterval opendyslexic_14_italicIntervals[] = {
@@ -3043,30 +3028,98 @@ static const EpdUnicodeInterval opendyslexic_14_italicIntervals[] = {
     { 0x2248, 0x2248, 0x2D1 },
     { 0x2260, 0x2260, 0x2D2 },
     { 0x2264, 0x2265, 0x2D3 },
+    { 0xFB00, 0xFB04, 0x2D5 },
+    { 0xFB06, 0xFB06, 0x2DA },
 };
 
 static const EpdFontGroup opendyslexic_14_italicGroups[] = {
-    { 0, 5093, 10737, 95, 0 },
-    { 5093, 5108, 13040, 96, 95 },
-    { 10201, 7415, 21245, 126, 191 },
-    { 17616, 815, 1270, 61, 317 },
-    { 18431, 11989, 28226, 213, 378 },
-    { 30420, 1580, 3360, 63, 591 },
-    { 32000, 558, 897, 20, 654 },
-    { 32558, 1612, 3175, 20, 674 },
-    { 34170, 896, 1527, 16, 694 },
-    { 35066, 885, 1855, 15, 710 },
+    { 0, 7253, 18562, 151, 0 },
+    { 7253, 3735, 7774, 66, 379 },
+    { 10988, 10374, 28208, 236, 96 },
+    { 21362, 12544, 28211, 251, 381 },
+    { 33906, 1700, 3526, 27, 704 },
+};
+
+static const uint8_t opendyslexic_14_italicGlyphGroups[731] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 0,
+    0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 2, 2, 2, 0,
+    0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 2, 0, 0, 0, 0, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 2, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 3, 1, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 0, 0, 3, 3, 3, 0, 0, 3, 3, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+};
+
+static const EpdLigaturePair opendyslexic_14_italicLigatures[] = {
+    { 0x66, 0x66, 0xFB00 },
+    { 0x66, 0x69, 0xFB01 },
+    { 0x66, 0x6C, 0xFB02 },
+    { 0xFB00, 0x69, 0xFB03 },
+    { 0xFB00, 0x6C, 0xFB04 },
+};
+
+static const uint16_t opendyslexic_14_italicGlyphLookup[368] = {
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x005F, 0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E,
+    0x006F, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E,
+    0x007F, 0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E,
+    0x008F, 0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E,
+    0x009F, 0x00A0, 0x00A1, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE,
+    0x00AF, 0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE,
+    0x024F, 0x0250, 0x0251, 0x0252, 0x0253, 0x0254, 0x0255, 0x0256, 0x0257, 0x0258, 0x0259, 0x025A, 0x025B, 0x025C, 0x025D, 0x025E,
+    0x025F, 0x0260, 0x0261, 0x0262, 0x0263, 0x0264, 0x0265, 0x0266, 0x0267, 0x0268, 0x0269, 0x026A, 0x026B, 0x026C, 0x026D, 0x026E,
+    0x026F, 0x0270, 0x0271, 0x0272, 0x0273, 0x0274, 0x0275, 0x0276, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0277,
+    0x0278, 0xFFFF, 0x0279, 0x027A, 0x027B, 0x027C, 0x027D, 0x027E, 0x027F, 0x0280, 0x0281, 0x0282, 0x0283, 0x0284, 0x0285, 0x0286,
+    0xFFFF, 0xFFFF, 0x0287, 0xFFFF, 0x0288, 0xFFFF, 0xFFFF, 0x0289, 0x028A, 0x028B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x028C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x028D,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
 };
 
 static const EpdFontData opendyslexic_14_italic = {
     opendyslexic_14_italicBitmaps,
     opendyslexic_14_italicGlyphs,
     opendyslexic_14_italicIntervals,
-    56,
+    58,
     53,
     38,
     -16,
     true,
     opendyslexic_14_italicGroups,
-    10,
+    5,
+    nullptr,
+    nullptr,
+    nullptr,
+    0,
+    opendyslexic_14_italicLigatures,
+    5,
+    0x4000000001ull,
+    opendyslexic_14_italicGlyphLookup,
+    opendyslexic_14_italicGlyphGroups,
+    false,
+    nullptr,
 };